@@ -1,13 +1,80 @@
 
 #include "fs.h"
 
+// Block cache bookkeeping.
+//
+// Every evictable block that is resident under DISKMAP occupies one slot
+// in bc_slots[0..bc_nslots-1].  When bc_fill needs room, a CLOCK hand
+// sweeps the slots, giving recently accessed blocks (PTE_A set) a second
+// chance and evicting the first block it finds that has not been touched
+// since the last sweep.  Pinned blocks (superblock, bitmap, directory
+// contents) are listed in bc_pins instead and are never evicted.
+//
+// Together the two lists cover every resident block, which lets
+// bc_flush find the dirty ones without walking the whole disk.
+//
+// Misses are served by bc_fill on the stack of the thread that faulted,
+// which yields to the server's other threads while the disk works.
+// Blocks being read are marked in bc_busy and only appear in the disk
+// map region once complete.  bc_lock gives one thread at a time the
+// disk and the write-back scratch list.
+static uint32_t bc_slots[BC_MAXSLOTS];
+static uint32_t bc_nslots;
+static uint32_t bc_hand;
+static uint32_t bc_budget = BC_DEFAULT_BUDGET;
+static uint32_t bc_pins[BC_MAXPINS];
+static uint32_t bc_npins;
+static uint32_t bc_pinned[DISKSIZE / BLKSIZE / 32];
+
+// Scratch list of dirty blocks for bc_flush.  Static because bc_flush
+// can run on the one-page user exception stack.
+static uint32_t bc_dirty[BC_MAXSLOTS + BC_MAXPINS];
+
+// When the next periodic write-back is due, in sys_time_msec() time.
+static uint32_t bc_flush_due;
+
+// The readahead stream the running thread's misses belong to: the open
+// file it is serving, set with bc_set_readahead, or else one of the
+// thread's own.
+static struct BcReadahead *bc_ra[1 + FS_NTHREADS];
+static struct BcReadahead bc_ra_own[1 + FS_NTHREADS];
+
+static uint32_t bc_busy[DISKSIZE / BLKSIZE / 32];
+static struct Lock bc_lock;
+
+void bc_resume(void);
+
+struct BcStats bcstats;
+
+// Return the virtual address of this disk block without any checks
+// or statistics.  For the cache's own bookkeeping.
+static void*
+bc_va(uint32_t blockno)
+{
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+}
+
 // Return the virtual address of this disk block.
 void*
 diskaddr(uint32_t blockno)
 {
 	if (blockno == 0 || (super && blockno >= super->s_nblocks))
 		panic("bad block number %08x in diskaddr", blockno);
-	return (char*) (DISKMAP + blockno * BLKSIZE);
+	return bc_va(blockno);
+}
+
+// Return the virtual address of file block 'blockno', looked up to get
+// at a file's contents.  A resident block counts as a cache hit; a miss
+// is counted when the access faults it in.  The server's own metadata
+// accesses go through diskaddr and count as neither.
+void*
+bc_lookup(uint32_t blockno)
+{
+	void *va = diskaddr(blockno);
+
+	if (va_is_mapped(va))
+		bcstats.bs_hits++;
+	return va;
 }
 
 // Is this virtual address mapped?
@@ -24,6 +91,220 @@ va_is_dirty(void *va)
 	return (uvpt[PGNUM(va)] & PTE_D) != 0;
 }
 
+// Is this virtual address accessed since its accessed bit was last cleared?
+static bool
+va_is_accessed(void *va)
+{
+	return (uvpt[PGNUM(va)] & PTE_A) != 0;
+}
+
+// Forget slot i, keeping the slot array dense.
+static void
+bc_slot_drop(uint32_t i)
+{
+	bc_slots[i] = bc_slots[--bc_nslots];
+}
+
+// Give up block 'blockno''s slot, if it has one, so that a later
+// insertion does not give it a second one.
+static void
+bc_slot_forget(uint32_t blockno)
+{
+	uint32_t i;
+
+	for (i = 0; i < bc_nslots; i++)
+		if (bc_slots[i] == blockno) {
+			bc_slot_drop(i);
+			return;
+		}
+}
+
+// Keep block 'blockno' resident for good.  Used for file system
+// metadata that the rest of the server holds pointers into.
+// Past BC_MAXPINS blocks, metadata is merely cached like anything else.
+void
+bc_pin(uint32_t blockno)
+{
+	if (bc_is_pinned(blockno) || bc_npins == BC_MAXPINS)
+		return;
+	bc_pinned[blockno / 32] |= 1 << (blockno % 32);
+	bc_pins[bc_npins++] = blockno;
+	bc_slot_forget(blockno);
+}
+
+// Make block 'blockno' evictable again, e.g. once it has been freed.
+void
+bc_unpin(uint32_t blockno)
+{
+	uint32_t i;
+
+	if (!bc_is_pinned(blockno))
+		return;
+	bc_pinned[blockno / 32] &= ~(1 << (blockno % 32));
+	for (i = 0; i < bc_npins; i++)
+		if (bc_pins[i] == blockno) {
+			bc_pins[i] = bc_pins[--bc_npins];
+			break;
+		}
+
+	// Hand a resident block over to the eviction policy.  Pinned
+	// blocks have no slot, so this is the block's only one.
+	if (va_is_mapped(bc_va(blockno))) {
+		while (bc_nslots > 0 && bc_nslots >= bc_budget)
+			bc_evict();
+		bc_slots[bc_nslots++] = blockno;
+	}
+}
+
+// Cut block 'blockno' loose from any client mappings of its page, e.g.
+// because it has been freed and may soon hold someone else's data.
+// The block just leaves the cache, along with its slot.
+void
+bc_unshare(uint32_t blockno)
+{
+	void *va = bc_va(blockno);
+	int r;
+
+	if (va_is_mapped(va) && pageref(va) > 1) {
+		if ((r = sys_page_unmap(0, va)) < 0)
+			panic("bc_unshare: sys_page_unmap: %e", r);
+		bc_slot_forget(blockno);
+	}
+}
+
+bool
+bc_is_pinned(uint32_t blockno)
+{
+	return (bc_pinned[blockno / 32] & (1 << (blockno % 32))) != 0;
+}
+
+// Set the maximum number of evictable blocks kept in memory.
+// Shrinking the budget evicts blocks until the cache fits again.
+void
+bc_set_budget(uint32_t npages)
+{
+	bc_budget = MAX(1, MIN(npages, BC_MAXSLOTS));
+	while (bc_nslots > bc_budget)
+		bc_evict();
+}
+
+// Is block 'blockno' being read in by some thread?
+static bool
+bc_is_busy(uint32_t blockno)
+{
+	return (bc_busy[blockno / 32] & (1 << (blockno % 32))) != 0;
+}
+
+// Evict one block from the cache using the CLOCK policy.  Running into
+// a dirty block means it has to be written back before it can go; only
+// that block is written, the rest of the dirty set waits.  Blocks
+// that clients have mapped (see serve_map) are passed over for two
+// full sweeps, so they go last: once evicted, a block's mappings no
+// longer see later writes to it.
+void
+bc_evict(void)
+{
+	uint32_t blockno, passed = 0;
+	bool accessed;
+	void *va;
+	int r;
+
+	while (bc_nslots > 0) {
+		if (bc_hand >= bc_nslots)
+			bc_hand = 0;
+		blockno = bc_slots[bc_hand];
+		va = bc_va(blockno);
+
+		// Slots whose block got pinned or unmapped behind our
+		// back (e.g. by check_bc) are simply reclaimed.
+		if (bc_is_pinned(blockno) || !va_is_mapped(va)) {
+			bc_slot_drop(bc_hand);
+			continue;
+		}
+
+		if (pageref(va) > 1 && passed++ < 2 * bc_nslots) {
+			bc_hand++;
+			continue;
+		}
+
+		// Remapping the page to clear PTE_A clears PTE_D as well,
+		// so dirty blocks have to be written back first.  That may
+		// let other threads run and move the slots around, so look
+		// again afterwards.  The write-back cleared PTE_A, so a block
+		// that had it set gets its second chance here.
+		accessed = va_is_accessed(va);
+		if (va_is_dirty(va)) {
+			bc_flush_list(&blockno, 1);
+			if (accessed && bc_hand < bc_nslots
+			    && bc_slots[bc_hand] == blockno)
+				bc_hand++;
+			continue;
+		}
+
+		// Second chance: clear the accessed bit and move on.
+		if (accessed) {
+			if ((r = sys_page_map(0, va, 0, va, uvpt[PGNUM(va)] & PTE_SYSCALL)) < 0)
+				panic("bc_evict: sys_page_map: %e", r);
+			bc_hand++;
+			continue;
+		}
+
+		if ((r = sys_page_unmap(0, va)) < 0)
+			panic("bc_evict: sys_page_unmap: %e", r);
+		bc_slot_drop(bc_hand);
+		bcstats.bs_evictions++;
+		return;
+	}
+}
+
+// Count the running thread's misses from now on toward readahead stream
+// ra, e.g. that of the open file a request names, or toward the
+// thread's own stream if ra is 0.  Each stream is detected separately,
+// so readers interleaving on different files do not break each other's
+// windows.
+void
+bc_set_readahead(struct BcReadahead *ra)
+{
+	bc_ra[thread_current()] = ra;
+}
+
+// Decide how many blocks, starting at 'blockno', to bring in on a fault.
+// A fault on the block right after the stream's previous read window
+// counts as sequential access and doubles the window, up to BC_RA_MAX
+// blocks; anything else collapses it back to the faulting block alone.  The
+// window is cut short at the first block that is already cached or
+// being read, free, or off the end of the disk, so it always covers a physically
+// contiguous run of allocated blocks.  Bitmap blocks that are not yet
+// resident also end the window: faulting them in from here would recurse.
+static uint32_t
+bc_ra_window(uint32_t blockno)
+{
+	struct BcReadahead *ra = bc_ra[thread_current()];
+	uint32_t n;
+
+	if (!ra)
+		ra = &bc_ra_own[thread_current()];
+	if (!super || !bitmap)
+		return 1;
+	if (blockno == ra->ra_next)
+		ra->ra_size = MIN(MAX(ra->ra_size, 1) * 2,
+				  MIN(BC_RA_MAX, MAX(1, bc_budget / 4)));
+	else
+		ra->ra_size = 1;
+
+	for (n = 1; n < ra->ra_size; n++)
+		if (blockno + n >= super->s_nblocks
+		    || va_is_mapped(bc_va(blockno + n))
+		    || bc_is_busy(blockno + n)
+		    || !va_is_mapped(&bitmap[(blockno + n) / 32])
+		    || block_is_free(blockno + n))
+			break;
+	ra->ra_next = blockno + n;
+	if (n > 1)
+		bcstats.bs_readahead += n - 1;
+	return n;
+}
+
 // Fault any disk block that is read in to memory by
 // loading it from disk.
 static void
@@ -31,7 +312,7 @@ bc_pgfault(struct UTrapframe *utf)
 {
 	void *addr = (void *) utf->utf_fault_va;
 	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
-	int r;
+	uint32_t *esp;
 
 	// Check that the fault was within the block cache region
 	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
@@ -42,21 +323,70 @@ bc_pgfault(struct UTrapframe *utf)
 	if (super && blockno >= super->s_nblocks)
 		panic("reading non-existent block %08x\n", blockno);
 
-	// Allocate a page in the disk map region, read the contents
-	// of the block from the disk into that page.
-	// Hint: first round addr to page boundary. fs/ide.c has code to read
-	// the disk.
-	//
-	// LAB 5: you code here:
-	addr = ROUNDDOWN(addr, PGSIZE);
-	if ((r = sys_page_alloc(0, addr, PTE_U | PTE_W | PTE_P)) < 0)
-		panic("bc_pgfault: sys_page_alloc: %e", r);
-	ide_read(blockno * BLKSECTS, addr, BLKSECTS);
+	// Don't wait for the disk here on the exception stack, which all
+	// threads share.  Make the faulting thread call bc_fill(addr) on
+	// its own stack instead, through bc_resume, and then retry.
+	esp = (uint32_t *) utf->utf_esp;
+	esp[-1] = utf->utf_eip;
+	esp[-2] = (uint32_t) addr;
+	utf->utf_esp = (uint32_t) (esp - 2);
+	utf->utf_eip = (uint32_t) bc_resume;
+}
 
-	// Clear the dirty bit for the disk block page since we just read the
-	// block from disk
-	if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
-		panic("in bc_pgfault, sys_page_map: %e", r);
+// Read the block containing addr, and any readahead, in from disk.
+// Called through bc_resume by a thread that faulted on addr.
+void
+bc_fill(void *addr)
+{
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+	uint32_t i, n, nslots;
+	char *stage;
+	int r;
+
+	// Another thread may have read the block in since we faulted, or
+	// be reading it now.
+	while (bc_is_busy(blockno))
+		thread_yield();
+	if (va_is_mapped(addr))
+		return;
+
+	bcstats.bs_misses++;
+	n = bc_ra_window(blockno);
+	for (i = 0; i < n; i++)
+		bc_busy[(blockno + i) / 32] |= 1 << ((blockno + i) % 32);
+
+	// Read the blocks with a single IDE command into pages in this
+	// thread's staging area; other threads keep faulting on the blocks
+	// until they are complete.
+	stage = (char *) BC_STAGE_VA + thread_current() * BC_RA_MAX * BLKSIZE;
+	for (i = 0; i < n; i++)
+		if ((r = sys_page_alloc(0, stage + i * BLKSIZE, PTE_U | PTE_W | PTE_P)) < 0)
+			panic("bc_fill: sys_page_alloc: %e", r);
+	lock_acquire(&bc_lock, 0);
+	r = ide_read(blockno * BLKSECTS, stage, n * BLKSECTS);
+	lock_release(&bc_lock, 0);
+	if (r < 0)
+		panic("bc_fill: ide_read: %e", r);
+
+	// Make room for the whole window before mapping any of it, so that
+	// we never evict the blocks we have just read.
+	for (i = nslots = 0; i < n; i++)
+		if (!bc_is_pinned(blockno + i))
+			nslots++;
+	while (bc_nslots > 0 && bc_nslots + nslots > bc_budget)
+		bc_evict();
+
+	// Move the pages into the disk map region.  Fresh mappings start
+	// out clean.
+	for (i = 0; i < n; i++) {
+		if ((r = sys_page_map(0, stage + i * BLKSIZE,
+				      0, bc_va(blockno + i), PTE_U | PTE_W | PTE_P)) < 0)
+			panic("bc_fill: sys_page_map: %e", r);
+		sys_page_unmap(0, stage + i * BLKSIZE);
+		bc_busy[(blockno + i) / 32] &= ~(1 << ((blockno + i) % 32));
+		if (!bc_is_pinned(blockno + i))
+			bc_slots[bc_nslots++] = blockno + i;
+	}
 
 	// Check that the block we read was allocated. (exercise for
 	// the reader: why do we do this *after* reading the block
@@ -86,9 +416,135 @@ flush_block(void *addr)
 	addr = ROUNDDOWN(addr, PGSIZE);
 	if (!va_is_mapped(addr) || !va_is_dirty(addr))
 		return;
+	lock_acquire(&bc_lock, 0);
 	ide_write(blockno * BLKSECTS, addr, BLKSECTS);
 	if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
 		panic("flush_block: sys_page_map: %e\n", r);
+	lock_release(&bc_lock, 0);
+}
+
+// Sort blocks[0..n-1] into ascending order (Shell sort; the lists are
+// usually nearly sorted already).
+static void
+bc_sort(uint32_t *blocks, uint32_t n)
+{
+	uint32_t gap, i, j, b;
+
+	for (gap = n / 2; gap > 0; gap /= 2)
+		for (i = gap; i < n; i++) {
+			b = blocks[i];
+			for (j = i; j >= gap && blocks[j - gap] > b; j -= gap)
+				blocks[j] = blocks[j - gap];
+			blocks[j] = b;
+		}
+}
+
+// Write back the dirty blocks among blocks[0..n-1].  The list is put in
+// ascending order, so the disk sees a single elevator sweep, and runs of
+// consecutive blocks go out as one multi-sector IDE command.  The
+// list is reordered in place.  The caller holds bc_lock.
+static void
+bc_write_list(uint32_t *blocks, uint32_t n)
+{
+	uint32_t i, j, len, start;
+	void *va;
+	int r;
+
+	// Drop clean, absent and duplicate blocks.
+	bc_sort(blocks, n);
+	for (i = j = 0; i < n; i++) {
+		va = bc_va(blocks[i]);
+		if ((j > 0 && blocks[j - 1] == blocks[i])
+		    || !va_is_mapped(va) || !va_is_dirty(va))
+			continue;
+		blocks[j++] = blocks[i];
+	}
+	n = j;
+
+	for (i = 0; i < n; i += len) {
+		start = blocks[i];
+		for (len = 1; i + len < n && len < BC_RA_MAX; len++)
+			if (blocks[i + len] != start + len)
+				break;
+		if ((r = ide_write(start * BLKSECTS, bc_va(start), len * BLKSECTS)) < 0)
+			panic("bc_flush_list: ide_write: %e", r);
+		for (j = 0; j < len; j++) {
+			va = bc_va(start + j);
+			if ((r = sys_page_map(0, va, 0, va, uvpt[PGNUM(va)] & PTE_SYSCALL)) < 0)
+				panic("bc_flush_list: sys_page_map: %e", r);
+		}
+		bcstats.bs_writes++;
+		bcstats.bs_writebacks += len;
+	}
+}
+
+// Write back the dirty blocks among blocks[0..n-1], as bc_write_list.
+void
+bc_flush_list(uint32_t *blocks, uint32_t n)
+{
+	lock_acquire(&bc_lock, 0);
+	bc_write_list(blocks, n);
+	lock_release(&bc_lock, 0);
+}
+
+// Make page pg, which holds new contents for block 'blockno', the
+// block's cache page, replacing whatever was cached for it, and unmap
+// pg.  For blocks whose contents start out in memory rather than on
+// disk, like delayed allocations.  The block is dirty until written.
+void
+bc_insert(uint32_t blockno, void *pg)
+{
+	void *va = bc_va(blockno);
+	int r;
+
+	while (bc_is_busy(blockno))
+		thread_yield();
+	if (!va_is_mapped(va) && !bc_is_pinned(blockno)) {
+		while (bc_nslots > 0 && bc_nslots >= bc_budget)
+			bc_evict();
+		bc_slots[bc_nslots++] = blockno;
+	}
+	if ((r = sys_page_map(0, pg, 0, va, PTE_U | PTE_W | PTE_P)) < 0)
+		panic("bc_insert: sys_page_map: %e", r);
+	sys_page_unmap(0, pg);
+
+	// Fresh mappings start out clean; write to set PTE_D.
+	*(volatile char *) va = *(volatile char *) va;
+}
+
+// Write back every dirty block in the cache.  The cost is proportional
+// to the number of resident blocks, not to the size of the disk.
+void
+bc_flush(void)
+{
+	uint32_t i, n;
+
+	lock_acquire(&bc_lock, 0);
+	n = 0;
+	for (i = 0; i < bc_nslots; i++)
+		bc_dirty[n++] = bc_slots[i];
+	for (i = 0; i < bc_npins; i++)
+		bc_dirty[n++] = bc_pins[i];
+	bc_write_list(bc_dirty, n);
+	lock_release(&bc_lock, 0);
+	bc_flush_due = sys_time_msec() + BC_FLUSH_MSEC;
+}
+
+// Periodic write-back.  The server calls this after requests, and when
+// it has been idle until bc_tick_due(); once BC_FLUSH_MSEC have passed
+// since the last full flush, flush again.
+void
+bc_tick(void)
+{
+	if ((int32_t) (sys_time_msec() - bc_flush_due) >= 0)
+		bc_flush();
+}
+
+// When bc_tick next has work to do.
+uint32_t
+bc_tick_due(void)
+{
+	return bc_flush_due;
 }
 
 // Test that the block cache works, by smashing the superblock and
@@ -154,6 +610,8 @@ bc_init(void)
 {
 	struct Super super;
 	set_pgfault_handler(bc_pgfault);
+	bc_pin(1);
+	bc_flush_due = sys_time_msec() + BC_FLUSH_MSEC;
 	check_bc();
 
 	// cache the super block by reading it once
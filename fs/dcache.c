@@ -0,0 +1,163 @@
+#include <inc/string.h>
+
+#include "fs.h"
+
+// Path-resolution cache.
+//
+// Maps (directory, name) to the struct File that dir_lookup found for
+// it, or to nothing for names known not to exist, so that walk_path
+// costs one hash probe per component for paths it has seen before.
+// Entries live in a fixed table, hashed into dc_buckets and kept on an
+// LRU list; when the table is full the least recently used entry is
+// recycled.  Bucket heads and hash chains hold entry indices plus one,
+// so that the zeroed table starts out empty.  fs.c keeps the cache
+// coherent by re-entering names it creates or removes and by purging
+// directories it shrinks.
+
+struct Dentry {
+	struct File *d_dir;		// directory searched, 0 if unused
+	struct File *d_file;		// what was found, 0 if nothing
+	char d_name[MAXNAMELEN];
+	int d_hnext;			// next entry in the same bucket, plus one
+	int d_prev, d_next;		// LRU list, most recent first; or free list
+};
+
+static struct Dentry dc_ents[DCACHE_SIZE];
+static int dc_buckets[DCACHE_NBUCKETS];
+static int dc_head = -1, dc_tail = -1;
+static int dc_free = -1;		// entries dropped by dc_remove
+static int dc_nused;			// entries ever handed out
+
+struct DcStats dcstats;
+
+static uint32_t
+dc_hash(struct File *dir, const char *name)
+{
+	return (dir_hash(name) ^ ((uintptr_t) dir / sizeof(struct File)))
+		% DCACHE_NBUCKETS;
+}
+
+static void
+dc_lru_unlink(int i)
+{
+	struct Dentry *d = &dc_ents[i];
+
+	if (d->d_prev >= 0)
+		dc_ents[d->d_prev].d_next = d->d_next;
+	else
+		dc_head = d->d_next;
+	if (d->d_next >= 0)
+		dc_ents[d->d_next].d_prev = d->d_prev;
+	else
+		dc_tail = d->d_prev;
+}
+
+static void
+dc_lru_push(int i)
+{
+	struct Dentry *d = &dc_ents[i];
+
+	d->d_prev = -1;
+	d->d_next = dc_head;
+	if (dc_head >= 0)
+		dc_ents[dc_head].d_prev = i;
+	dc_head = i;
+	if (dc_tail < 0)
+		dc_tail = i;
+}
+
+// Find the entry for (dir, name).  Returns its index, or -1.
+static int
+dc_find(struct File *dir, const char *name)
+{
+	int i;
+
+	for (i = dc_buckets[dc_hash(dir, name)] - 1; i >= 0; i = dc_ents[i].d_hnext - 1)
+		if (dc_ents[i].d_dir == dir && strcmp(dc_ents[i].d_name, name) == 0)
+			return i;
+	return -1;
+}
+
+// Take entry i out of its hash bucket and the LRU list, and put it on
+// the free list.
+static void
+dc_remove(int i)
+{
+	int *pi;
+	struct Dentry *d = &dc_ents[i];
+
+	for (pi = &dc_buckets[dc_hash(d->d_dir, d->d_name)]; *pi - 1 != i;
+	     pi = &dc_ents[*pi - 1].d_hnext)
+		/* do nothing */;
+	*pi = d->d_hnext;
+	dc_lru_unlink(i);
+	d->d_dir = 0;
+	d->d_next = dc_free;
+	dc_free = i;
+}
+
+// Look up (dir, name) in the cache.  On a hit, set *pf to the cached
+// File, or to 0 if the name is known not to exist, and return 1.
+// Return 0 on a miss.
+int
+dcache_lookup(struct File *dir, const char *name, struct File **pf)
+{
+	int i;
+
+	if ((i = dc_find(dir, name)) < 0) {
+		dcstats.ds_misses++;
+		return 0;
+	}
+	dcstats.ds_hits++;
+	dc_lru_unlink(i);
+	dc_lru_push(i);
+	*pf = dc_ents[i].d_file;
+	return 1;
+}
+
+// Remember that looking up 'name' in dir yields f (0 for no such file),
+// replacing anything cached for it before.
+void
+dcache_enter(struct File *dir, const char *name, struct File *f)
+{
+	int i;
+	uint32_t b;
+	struct Dentry *d;
+
+	if (strlen(name) >= MAXNAMELEN)
+		return;
+	if ((i = dc_find(dir, name)) >= 0)
+		dc_remove(i);
+	else if (dc_free < 0 && dc_nused == DCACHE_SIZE) {
+		dc_remove(dc_tail);
+		dcstats.ds_evictions++;
+	}
+	if (dc_free >= 0) {
+		i = dc_free;
+		dc_free = dc_ents[i].d_next;
+	} else
+		i = dc_nused++;
+
+	d = &dc_ents[i];
+	d->d_dir = dir;
+	d->d_file = f;
+	strcpy(d->d_name, name);
+	b = dc_hash(dir, name);
+	d->d_hnext = dc_buckets[b];
+	dc_buckets[b] = i + 1;
+	dc_lru_push(i);
+}
+
+// Forget everything cached about the contents of dir, and about dir
+// itself, e.g. because its entries have moved or are going away.
+void
+dcache_purge(struct File *dir)
+{
+	int i, next;
+
+	for (i = dc_head; i >= 0; i = next) {
+		next = dc_ents[i].d_next;
+		if (dc_ents[i].d_dir == dir || dc_ents[i].d_file == dir)
+			dc_remove(i);
+	}
+}
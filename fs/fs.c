@@ -6,6 +6,10 @@
 struct Super *super;
 uint32_t *bitmap;
 
+// Number of blocks file_flush hands to the block cache at once; enough
+// for a full doubly-indirect block plus the indirect and index blocks.
+#define FLUSH_BATCH	(NINDIRECT + 3)
+
 // --------------------------------------------------------------
 // Super block
 // --------------------------------------------------------------
@@ -39,6 +43,41 @@ block_is_free(uint32_t blockno)
 	return 0;
 }
 
+// Summary of the bitmap: bit i of freemap is set iff bitmap word i
+// has at least one free block.  Lets the allocator skip full regions
+// of the disk 1024 blocks at a time instead of rescanning the bitmap.
+static uint32_t freemap[DISKSIZE / BLKSIZE / 32 / 32];
+static uint32_t nfree;		// free blocks on the disk
+static uint32_t alloc_rotor;	// where goal-less allocations start looking
+
+// Recompute the freemap bit for bitmap word 'idx'.
+static void
+freemap_update(uint32_t idx)
+{
+	if (bitmap[idx])
+		freemap[idx / 32] |= 1 << (idx % 32);
+	else
+		freemap[idx / 32] &= ~(1 << (idx % 32));
+}
+
+// Build the free-space summary from the on-disk bitmap.  Bits past
+// the end of the disk are cleared so they never look free.
+static void
+freemap_init(void)
+{
+	uint32_t idx, nwords, bits;
+
+	nwords = (super->s_nblocks + 31) / 32;
+	if (super->s_nblocks % 32)
+		bitmap[nwords - 1] &= (1 << (super->s_nblocks % 32)) - 1;
+	nfree = 0;
+	for (idx = 0; idx < nwords; idx++) {
+		freemap_update(idx);
+		for (bits = bitmap[idx]; bits; bits &= bits - 1)
+			nfree++;
+	}
+}
+
 // Mark a block free in the bitmap
 void
 free_block(uint32_t blockno)
@@ -46,36 +85,109 @@ free_block(uint32_t blockno)
 	// Blockno zero is the null pointer of block numbers.
 	if (blockno == 0)
 		panic("attempt to free zero block");
+	if (!(bitmap[blockno/32] & (1<<(blockno%32))))
+		nfree++;
 	bitmap[blockno/32] |= 1<<(blockno%32);
+	freemap[blockno/1024] |= 1<<((blockno/32)%32);
+	bc_unpin(blockno);
+	bc_unshare(blockno);
 }
 
-// Search the bitmap for a free block and allocate it.  When you
-// allocate a block, immediately flush the changed bitmap block
-// to disk.
+// Find the first bitmap word at or after 'idx', wrapping around at the
+// end of the disk, that has a free block.  Returns -1 if there is none.
+static int
+freemap_next(uint32_t idx)
+{
+	uint32_t nwords, i, n, w, bits;
+
+	nwords = (super->s_nblocks + 31) / 32;
+	if (idx >= nwords)
+		idx = 0;
+	// Scan one more summary word than exists, to wrap back to the
+	// part of the starting word below idx.
+	for (i = idx / 32, n = 0; n <= (nwords + 31) / 32; n++) {
+		bits = freemap[i];
+		if (n == 0)
+			bits &= ~0U << (idx % 32);
+		if (bits) {
+			w = i * 32 + __builtin_ctz(bits);
+			if (w < nwords)
+				return w;
+		}
+		if (++i * 32 >= nwords)
+			i = 0;
+	}
+	return -1;
+}
+
+// Allocate up to 'want' physically contiguous blocks, preferably
+// starting at block 'goal' or as soon after it as possible, so that
+// file data stays contiguous for readahead and multi-block writes.
+// The changed bitmap blocks are left dirty in the block cache; the
+// write-back in bc_flush batches bitmap updates with everything else.
+//
+// On success sets *pstart to the first block allocated and returns the
+// number of blocks in the extent (at least 1, at most 'want').
+// Returns -E_NO_DISK if we are out of blocks.
+int
+alloc_extent(uint32_t goal, uint32_t want, uint32_t *pstart)
+{
+	uint32_t idx, bits, blockno, n;
+	int w;
+
+	if (nfree == 0 || want == 0)
+		return -E_NO_DISK;
+	if (goal >= super->s_nblocks)
+		goal = 0;
+
+	// Look for a free block in the goal's own word first, then in
+	// the following words with the help of the summary.
+	idx = goal / 32;
+	bits = bitmap[idx] & (~0U << (goal % 32));
+	if (!bits) {
+		if ((w = freemap_next(idx + 1)) < 0)
+			return -E_NO_DISK;
+		idx = w;
+		bits = bitmap[idx];
+	}
+	blockno = idx * 32 + __builtin_ctz(bits);
+
+	// Extend the extent while the following blocks are free.
+	for (n = 0; n < want && blockno + n < super->s_nblocks; n++) {
+		idx = (blockno + n) / 32;
+		if (!(bitmap[idx] & (1 << ((blockno + n) % 32))))
+			break;
+		bitmap[idx] &= ~(1 << ((blockno + n) % 32));
+		freemap_update(idx);
+	}
+	nfree -= n;
+	alloc_rotor = blockno + n;
+	*pstart = blockno;
+	return n;
+}
+
+// Allocate a free block, preferably 'goal' or the first free one after it.
+// Returns 0 and sets *pblockno on success, -E_NO_DISK if we are out of
+// blocks.
+int
+alloc_block_near(uint32_t goal, uint32_t *pblockno)
+{
+	int r;
+
+	if ((r = alloc_extent(goal, 1, pblockno)) < 0)
+		return r;
+	return 0;
+}
+
+// Search the bitmap for a free block and allocate it, continuing
+// where the last allocation left off.
 //
 // Return block number allocated on success,
 // -E_NO_DISK if we are out of blocks.
-//
-// Hint: use free_block as an example for manipulating the bitmap.
 int
 alloc_block(uint32_t *pblockno)
 {
-	// The bitmap consists of one or more blocks.  A single bitmap block
-	// contains the in-use bits for BLKBITSIZE blocks.  There are
-	// super->s_nblocks blocks in the disk altogether.
-
-	// LAB 5: Your code here.
-	for (uint32_t idx = 0; idx * 32 < super->s_nblocks; idx++) {
-		if (bitmap[idx] == 0)
-			continue;
-		uint8_t ctz = __builtin_ctz(bitmap[idx]);
-
-		*pblockno = idx * 32 + ctz;
-		bitmap[idx] &= ~(1 << ctz);
-		flush_block(&bitmap[idx]);
-		return 0;
-	}
-	return -E_NO_DISK;
+	return alloc_block_near(alloc_rotor, pblockno);
 }
 
 // Validate the file system bitmap.
@@ -108,6 +220,8 @@ check_bitmap(void)
 void
 fs_init(void)
 {
+	uint32_t i;
+
 	static_assert(sizeof(struct File) == 256);
 
 	// Find a JOS disk.  Use the second IDE disk (number 1) if available
@@ -123,15 +237,71 @@ fs_init(void)
 
 	// Set "bitmap" to the beginning of the first bitmap block.
 	bitmap = diskaddr(2);
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+		bc_pin(2 + i);
 	check_bitmap();
+	freemap_init();
 
 }
 
+// The leaf table used by the last doubly-indirect lookup.  Sequential
+// access goes through the same leaf NINDIRECT times in a row, so
+// remembering it skips the trip through the doubly-indirect block.
+// The hint is keyed by where the file's inode lives on disk and by its
+// doubly-indirect block, and dropped whenever the file's blocks are
+// freed or moved, so a File slot that gets reused never inherits it.
+static struct {
+	uint32_t ino;		// inode number of the file, plus one; 0 if none
+	uint32_t dind;		// the file's f_dindirect
+	uint32_t idx;		// index of the leaf in f->f_dindirect
+	uint32_t leaf;		// disk block number of the leaf
+} walk_hint;
+
+// The inode number of f: its position among all the File slots on disk.
+static uint32_t
+file_ino(struct File *f)
+{
+	return ((uintptr_t) f - DISKMAP) / sizeof(struct File);
+}
+
+// Forget the walk hint if it belongs to f.
+static void
+walk_hint_drop(struct File *f)
+{
+	if (walk_hint.ino == file_ino(f) + 1)
+		walk_hint.ino = 0;
+}
+
+// Make sure the indirect block whose number is stored at *pblockno
+// exists.  If it does not and 'alloc' is set, allocate one near 'goal'
+// and clear it.  Indirect blocks of directories are pinned along with
+// the directory contents.
+//
+// Returns 0 on success, -E_NOT_FOUND if the block is missing and
+// 'alloc' is 0, -E_NO_DISK if there is no space for it.
+static int
+indirect_block(struct File *f, uint32_t *pblockno, uint32_t goal, bool alloc)
+{
+	int r;
+
+	if (*pblockno == 0) {
+		if (!alloc)
+			return -E_NOT_FOUND;
+		if ((r = alloc_block_near(goal, pblockno)) < 0)
+			return r;
+		memset(diskaddr(*pblockno), 0, BLKSIZE);
+	}
+	if (f->f_type == FTYPE_DIR)
+		bc_pin(*pblockno);
+	return 0;
+}
+
 // Find the disk block number slot for the 'filebno'th block in file 'f'.
 // Set '*ppdiskbno' to point to that slot.
-// The slot will be one of the f->f_direct[] entries,
-// or an entry in the indirect block.
-// When 'alloc' is set, this function will allocate an indirect block
+// The slot will be one of the f->f_direct[] entries, an entry in the
+// indirect block, or an entry in one of the leaf tables hanging off the
+// doubly-indirect block.
+// When 'alloc' is set, this function will allocate indirect blocks
 // if necessary.
 //
 // Returns:
@@ -139,34 +309,294 @@ fs_init(void)
 //	-E_NOT_FOUND if the function needed to allocate an indirect block, but
 //		alloc was 0.
 //	-E_NO_DISK if there's no space on the disk for an indirect block.
-//	-E_INVAL if filebno is out of range (it's >= NDIRECT + NINDIRECT).
+//	-E_INVAL if filebno is out of range (it's >= MAXFILEBLOCKS).
 //
 // Analogy: This is like pgdir_walk for files.
-// Hint: Don't forget to clear any block you allocate.
 static int
 file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool alloc)
 {
-	// LAB 5: Your code here.
-	int r = 0;
+	uint32_t idx, blockno, *pleaf;
+	int r;
 
-	if (filebno < NDIRECT)
+	if (filebno < NDIRECT) {
 		*ppdiskbno = &f->f_direct[filebno];
-	else if (filebno >= NDIRECT + NINDIRECT)
-		r = -E_INVAL;
-	else {
-		filebno -= NDIRECT;
-		if (f->f_indirect == 0) {
-			if (!alloc) {
-				r = -E_NOT_FOUND;
-				goto exit;
-			} else if ((r = alloc_block(&f->f_indirect)) < 0)
-				goto exit;
-			memset(diskaddr(f->f_indirect), 0, BLKSIZE);
-		}
+		return 0;
+	}
+
+	filebno -= NDIRECT;
+	if (filebno < NINDIRECT) {
+		blockno = f->f_indirect;
+		r = indirect_block(f, &blockno, f->f_direct[NDIRECT - 1] + 1, alloc);
+		f->f_indirect = blockno;
+		if (r < 0)
+			return r;
 		*ppdiskbno = (uint32_t *) diskaddr(f->f_indirect) + filebno;
+		return 0;
 	}
-exit:
-	return r;
+
+	filebno -= NINDIRECT;
+	if (filebno >= NDINDIRECT)
+		return -E_INVAL;
+	idx = filebno / NINDIRECT;
+	if (walk_hint.ino != file_ino(f) + 1 || walk_hint.idx != idx
+	    || f->f_dindirect == 0 || walk_hint.dind != f->f_dindirect) {
+		blockno = f->f_dindirect;
+		r = indirect_block(f, &blockno, alloc_rotor, alloc);
+		f->f_dindirect = blockno;
+		if (r < 0)
+			return r;
+		pleaf = (uint32_t *) diskaddr(f->f_dindirect) + idx;
+		if ((r = indirect_block(f, pleaf, alloc_rotor, alloc)) < 0)
+			return r;
+		walk_hint.ino = file_ino(f) + 1;
+		walk_hint.dind = f->f_dindirect;
+		walk_hint.idx = idx;
+		walk_hint.leaf = *pleaf;
+	}
+	*ppdiskbno = (uint32_t *) diskaddr(walk_hint.leaf) + filebno % NINDIRECT;
+	return 0;
+}
+
+// Return the first file block number after 'filebno' that may have a
+// different leaf table, for skipping holes in the doubly-indirect range.
+static uint32_t
+next_leaf(uint32_t filebno)
+{
+	if (filebno < NDIRECT + NINDIRECT)
+		return NDIRECT + NINDIRECT;
+	return ROUNDUP(filebno - NDIRECT - NINDIRECT + 1, NINDIRECT)
+		+ NDIRECT + NINDIRECT;
+}
+
+// Pick the disk block we would like the filebno'th block of file 'f'
+// to land on: the one right after the file's previous block, if any.
+static uint32_t
+file_block_goal(struct File *f, uint32_t filebno)
+{
+	uint32_t *pdiskbno;
+
+	if (filebno > 0 && file_block_walk(f, filebno - 1, &pdiskbno, 0) == 0
+	    && *pdiskbno != 0)
+		return *pdiskbno + 1;
+	return alloc_rotor;
+}
+
+// Allocate disk blocks for any of the 'count' file blocks starting at
+// 'filebno' that do not have one yet.  Each run of missing blocks is
+// allocated as few physically contiguous extents as possible, placed
+// right after the preceding file block.
+//
+// Returns 0 on success, < 0 on error.
+static int
+file_alloc_blocks(struct File *f, uint32_t filebno, uint32_t count)
+{
+	uint32_t *pdiskbno, start, i, n;
+	int r;
+
+	while (count > 0) {
+		if ((r = file_block_walk(f, filebno, &pdiskbno, true)) < 0)
+			return r;
+		if (*pdiskbno) {
+			filebno++;
+			count--;
+			continue;
+		}
+
+		// Measure the run of missing blocks.  Walking it also
+		// allocates the indirect block, if needed, before the run's
+		// own extent rather than in the middle of it.
+		for (n = 1; n < count; n++) {
+			if ((r = file_block_walk(f, filebno + n, &pdiskbno, true)) < 0)
+				return r;
+			if (*pdiskbno)
+				break;
+		}
+
+		if ((r = alloc_extent(file_block_goal(f, filebno), n, &start)) < 0)
+			return r;
+		for (i = 0; i < r; i++) {
+			file_block_walk(f, filebno + i, &pdiskbno, 0);
+			*pdiskbno = start + i;
+		}
+		filebno += r;
+		count -= r;
+	}
+	return 0;
+}
+
+// --------------------------------------------------------------
+// Delayed allocation
+// --------------------------------------------------------------
+
+// Blocks written to regular files get no disk block right away.  They
+// live in pages of their own at DELALLOC_VA, found by (file, block
+// number) through a hash table, while the file's block pointer stays 0.
+// file_commit later gives a file's delayed blocks disk space all at
+// once, in as few contiguous extents as the allocator can find, and
+// hands the pages to the block cache as dirty blocks.  That happens
+// when the file is flushed, on sync, when the table fills up, and from
+// fs_tick once the oldest delayed block is BC_FLUSH_MSEC old.  Disk
+// space for delayed blocks, and the indirect blocks they may need, is
+// reserved as they are added, so that commits do not run out of it.
+//
+// Only requests that hold fs_lock exclusively add or commit entries.
+// Bucket heads and hash chains hold entry indices plus one.
+
+struct Delayed {
+	struct File *d_file;		// 0 if unused
+	uint32_t d_filebno;
+	int d_hnext;			// next entry in the same bucket, plus one;
+					// or next free entry
+};
+
+static struct Delayed da_ents[DELALLOC_MAX];
+static int da_buckets[DELALLOC_NBUCKETS];
+static int da_free = -1;		// entries dropped by da_remove
+static int da_nused;			// entries ever handed out
+static uint32_t da_count;		// entries in use
+static uint32_t da_since;		// sys_time_msec() when the oldest was added
+
+static char *
+da_page(int i)
+{
+	return (char *) DELALLOC_VA + i * PGSIZE;
+}
+
+static uint32_t
+da_hash(struct File *f, uint32_t filebno)
+{
+	return ((uintptr_t) f / sizeof(struct File) * 31 + filebno)
+		% DELALLOC_NBUCKETS;
+}
+
+// Find the delayed block filebno of f.  Returns its index, or -1.
+static int
+da_find(struct File *f, uint32_t filebno)
+{
+	int i;
+
+	if (da_count == 0)
+		return -1;
+	for (i = da_buckets[da_hash(f, filebno)] - 1; i >= 0; i = da_ents[i].d_hnext - 1)
+		if (da_ents[i].d_file == f && da_ents[i].d_filebno == filebno)
+			return i;
+	return -1;
+}
+
+// Make filebno of f a delayed block, backed by a fresh zeroed page, and
+// set *blk to the page.  Returns -E_NO_MEM if the table is full, or
+// -E_NO_DISK if there would be no room on disk for it.
+static int
+da_add(struct File *f, uint32_t filebno, char **blk)
+{
+	uint32_t b;
+	int i, r;
+
+	if (da_free < 0 && da_nused == DELALLOC_MAX)
+		return -E_NO_MEM;
+	if (nfree < da_count + 1 + (da_count + 1) / NINDIRECT + 3)
+		return -E_NO_DISK;
+	i = da_free >= 0 ? da_free : da_nused;
+	if ((r = sys_page_alloc(0, da_page(i), PTE_P | PTE_U | PTE_W)) < 0)
+		return r;
+	if (i == da_free)
+		da_free = da_ents[i].d_hnext;
+	else
+		da_nused++;
+
+	da_ents[i].d_file = f;
+	da_ents[i].d_filebno = filebno;
+	b = da_hash(f, filebno);
+	da_ents[i].d_hnext = da_buckets[b];
+	da_buckets[b] = i + 1;
+	if (da_count++ == 0)
+		da_since = sys_time_msec();
+	*blk = da_page(i);
+	return 0;
+}
+
+// Forget delayed block i, and its page if it still has one.
+static void
+da_remove(int i)
+{
+	int *pi;
+	struct Delayed *d = &da_ents[i];
+
+	for (pi = &da_buckets[da_hash(d->d_file, d->d_filebno)]; *pi - 1 != i;
+	     pi = &da_ents[*pi - 1].d_hnext)
+		/* do nothing */;
+	*pi = d->d_hnext;
+	d->d_file = 0;
+	d->d_hnext = da_free;
+	da_free = i;
+	sys_page_unmap(0, da_page(i));
+	da_count--;
+}
+
+// Drop the delayed blocks of f from filebno on, unwritten, e.g. because
+// f is being truncated.
+static void
+da_discard(struct File *f, uint32_t filebno)
+{
+	int i;
+
+	for (i = 0; da_count > 0 && i < da_nused; i++)
+		if (da_ents[i].d_file == f && da_ents[i].d_filebno >= filebno)
+			da_remove(i);
+}
+
+// Give the delayed blocks of f, or of every file if f is 0, their disk
+// blocks.  Each file's blocks are allocated in file order, so that runs
+// of consecutive file blocks land in contiguous extents.
+// Returns 0 on success, < 0 on error.
+int
+file_commit(struct File *f)
+{
+	static uint32_t bnos[DELALLOC_MAX];
+	struct File *g;
+	uint32_t i, j, m, n, *pdiskbno;
+	int r, k;
+
+	while (da_count > 0) {
+		g = f;
+		for (i = n = 0; i < da_nused; i++)
+			if (da_ents[i].d_file && (!g || da_ents[i].d_file == g)) {
+				g = da_ents[i].d_file;
+				bnos[n++] = da_ents[i].d_filebno;
+			}
+		if (n == 0)
+			return 0;
+
+		// Sort the block numbers (insertion sort; writes mostly
+		// come in order).
+		for (i = 1; i < n; i++)
+			for (j = i; j > 0 && bnos[j - 1] > bnos[j]; j--) {
+				m = bnos[j];
+				bnos[j] = bnos[j - 1];
+				bnos[j - 1] = m;
+			}
+
+		for (i = 0; i < n; i = j) {
+			for (j = i + 1; j < n && bnos[j] == bnos[j - 1] + 1; j++)
+				/* do nothing */;
+			// Hand over whatever part of the run got blocks,
+			// even if the allocation failed half way.
+			r = file_alloc_blocks(g, bnos[i], j - i);
+			for (m = i; m < j; m++) {
+				if (file_block_walk(g, bnos[m], &pdiskbno, 0) < 0
+				    || *pdiskbno == 0)
+					continue;
+				k = da_find(g, bnos[m]);
+				bc_insert(*pdiskbno, da_page(k));
+				da_remove(k);
+			}
+			if (r < 0)
+				return r;
+		}
+		if (f)
+			return 0;
+	}
+	return 0;
 }
 
 // Set *blk to the address in memory where the filebno'th
@@ -184,19 +614,144 @@ file_get_block(struct File *f, uint32_t filebno, char **blk)
 	uint32_t *pdiskbno;
 	int r;
 
+	// Data blocks of regular files are allocated when committed.  If
+	// there is no room to delay one, fall back to allocating it now.
+	if (f->f_type == FTYPE_REG) {
+		r = file_block_walk(f, filebno, &pdiskbno, 0);
+		if (r < 0 && r != -E_NOT_FOUND)
+			return r;
+		if (r == 0 && *pdiskbno) {
+			*blk = bc_lookup(*pdiskbno);
+			return 0;
+		}
+		if ((r = da_find(f, filebno)) >= 0) {
+			*blk = da_page(r);
+			return 0;
+		}
+		if ((r = da_add(f, filebno, blk)) == -E_NO_MEM
+		    && file_commit(0) == 0)
+			r = da_add(f, filebno, blk);
+		if (r == 0)
+			return 0;
+	}
+
 	r = file_block_walk(f, filebno, &pdiskbno, true);
 	if (r < 0)
 		goto exit;
 	if (*pdiskbno == 0) {
-		r = alloc_block(pdiskbno);
+		r = alloc_block_near(file_block_goal(f, filebno), pdiskbno);
 		if (r < 0)
 			goto exit;
 	}
-	*blk = diskaddr(*pdiskbno);
+	// Directory blocks hold the struct Files that open files point
+	// into, so keep them out of the eviction policy.
+	if (f->f_type == FTYPE_DIR)
+		bc_pin(*pdiskbno);
+	*blk = bc_lookup(*pdiskbno);
 exit:
 	return r;
 }
 
+// Like file_get_block, but never allocates anything, so that it is safe
+// for requests that only read the file system.  Returns -E_NOT_FOUND
+// if the block is a hole.  Delayed blocks are found in their pages.
+// Directory blocks are pinned, as by file_get_block.
+int
+file_find_block(struct File *f, uint32_t filebno, char **blk)
+{
+	uint32_t *pdiskbno;
+	int r, i;
+
+	r = file_block_walk(f, filebno, &pdiskbno, 0);
+	if (r < 0 && r != -E_NOT_FOUND)
+		return r;
+	if (r == 0 && *pdiskbno) {
+		if (f->f_type == FTYPE_DIR)
+			bc_pin(*pdiskbno);
+		*blk = bc_lookup(*pdiskbno);
+		return 0;
+	}
+	if ((i = da_find(f, filebno)) < 0)
+		return -E_NOT_FOUND;
+	*blk = da_page(i);
+	return 0;
+}
+
+// --------------------------------------------------------------
+// Directories
+// --------------------------------------------------------------
+
+// A directory may carry a hash index so that lookups and creates do not
+// have to scan every entry.  dir->f_hindex names a block of DIR_NBUCKETS
+// bucket heads.  Each head is the number of the first entry whose name
+// hashes to that bucket, and the rest of the bucket is chained through
+// the entries' f_hnext fields.  Free entries are chained the same way
+// from dir->f_hfree.  Entry number i lives in slot i % BLKFILES of file
+// block i / BLKFILES, and all entry numbers are stored plus one.
+//
+// Directories without an index (from older images) are searched
+// linearly, and get an index the next time an entry is added once they
+// have outgrown a single block.  Lookups leave the directory alone, as
+// they may run alongside other lookups.
+
+// Set *pf to entry number 'i' of dir.  Never allocates, so lookups can
+// use it under a shared fs_lock.
+int
+dir_entry(struct File *dir, uint32_t i, struct File **pf)
+{
+	int r;
+	char *blk;
+
+	if ((r = file_find_block(dir, i / BLKFILES, &blk)) < 0)
+		return r;
+	*pf = (struct File *) blk + i % BLKFILES;
+	return 0;
+}
+
+// Build the hash index of a directory that does not have one.
+static int
+dir_index_build(struct File *dir)
+{
+	int r;
+	uint32_t i, b, blockno, *buckets;
+	struct File *f;
+
+	if ((r = alloc_block(&blockno)) < 0)
+		return r;
+	dir->f_hindex = blockno;
+	bc_pin(dir->f_hindex);
+	buckets = diskaddr(dir->f_hindex);
+	memset(buckets, 0, BLKSIZE);
+	dir->f_hfree = 0;
+
+	// Go backwards so the chains come out in entry order.
+	for (i = dir->f_size / sizeof(struct File); i-- > 0; ) {
+		if ((r = dir_entry(dir, i, &f)) < 0)
+			return r;
+		if (f->f_name[0]) {
+			b = dir_hash(f->f_name);
+			f->f_hnext = buckets[b];
+			buckets[b] = i + 1;
+		} else {
+			f->f_hnext = dir->f_hfree;
+			dir->f_hfree = i + 1;
+		}
+	}
+	return 0;
+}
+
+// Make sure a directory that has outgrown a block has an index.
+// Failing to build one is not fatal: the directory stays linear.
+static void
+dir_index_check(struct File *dir)
+{
+	if (dir->f_hindex == 0 && dir->f_size > BLKSIZE
+	    && dir_index_build(dir) < 0 && dir->f_hindex) {
+		free_block(dir->f_hindex);
+		dir->f_hindex = 0;
+	}
+}
+
 // Try to find a file named "name" in dir.  If so, set *file to it.
 //
 // Returns 0 and sets *file on success, < 0 on error.  Errors are:
@@ -213,9 +768,22 @@ dir_lookup(struct File *dir, const char *name, struct File **file)
 	// We maintain the invariant that the size of a directory-file
 	// is always a multiple of the file system's block size.
 	assert((dir->f_size % BLKSIZE) == 0);
+	if (dir->f_hindex) {
+		i = ((uint32_t *) diskaddr(dir->f_hindex))[dir_hash(name)];
+		for (; i != 0; i = f->f_hnext) {
+			if ((r = dir_entry(dir, i - 1, &f)) < 0)
+				return r;
+			if (strcmp(f->f_name, name) == 0) {
+				*file = f;
+				return 0;
+			}
+		}
+		return -E_NOT_FOUND;
+	}
+
 	nblock = dir->f_size / BLKSIZE;
 	for (i = 0; i < nblock; i++) {
-		if ((r = file_get_block(dir, i, &blk)) < 0)
+		if ((r = file_find_block(dir, i, &blk)) < 0)
 			return r;
 		f = (struct File*) blk;
 		for (j = 0; j < BLKFILES; j++)
@@ -227,36 +795,136 @@ dir_lookup(struct File *dir, const char *name, struct File **file)
 	return -E_NOT_FOUND;
 }
 
-// Set *file to point at a free File structure in dir.  The caller is
-// responsible for filling in the File fields.
+// Grow dir by one zeroed block and set *pblk to it.
 static int
-dir_alloc_file(struct File *dir, struct File **file)
+dir_grow(struct File *dir, struct File **pblk)
 {
 	int r;
-	uint32_t nblock, i, j;
+	char *blk;
+
+	dir->f_size += BLKSIZE;
+	if ((r = file_get_block(dir, dir->f_size / BLKSIZE - 1, &blk)) < 0) {
+		dir->f_size -= BLKSIZE;
+		return r;
+	}
+	memset(blk, 0, BLKSIZE);
+	*pblk = (struct File *) blk;
+	return 0;
+}
+
+// Set *file to point at a free File structure in dir, named 'name' and
+// otherwise cleared.  The caller is responsible for filling in the
+// other File fields.
+static int
+dir_alloc_file(struct File *dir, const char *name, struct File **file)
+{
+	int r;
+	uint32_t nblock, i, j, *buckets;
 	char *blk;
 	struct File *f;
 
 	assert((dir->f_size % BLKSIZE) == 0);
-	nblock = dir->f_size / BLKSIZE;
-	for (i = 0; i < nblock; i++) {
-		if ((r = file_get_block(dir, i, &blk)) < 0)
+	dir_index_check(dir);
+	if (!dir->f_hindex) {
+		nblock = dir->f_size / BLKSIZE;
+		for (i = 0; i < nblock; i++) {
+			if ((r = file_get_block(dir, i, &blk)) < 0)
+				return r;
+			f = (struct File*) blk;
+			for (j = 0; j < BLKFILES; j++)
+				if (f[j].f_name[0] == '\0') {
+					f = &f[j];
+					goto found;
+				}
+		}
+		if ((r = dir_grow(dir, &f)) < 0)
 			return r;
-		f = (struct File*) blk;
-		for (j = 0; j < BLKFILES; j++)
-			if (f[j].f_name[0] == '\0') {
-				*file = &f[j];
-				return 0;
-			}
+		goto found;
 	}
-	dir->f_size += BLKSIZE;
-	if ((r = file_get_block(dir, i, &blk)) < 0)
-		return r;
-	f = (struct File*) blk;
-	*file = &f[0];
+
+	// Take the first free entry, or grow the directory and put the
+	// rest of the new block on the free list.
+	if (dir->f_hfree == 0) {
+		if ((r = dir_grow(dir, &f)) < 0)
+			return r;
+		i = dir->f_size / sizeof(struct File) - BLKFILES;
+		for (j = BLKFILES - 1; j > 0; j--) {
+			f[j].f_hnext = dir->f_hfree;
+			dir->f_hfree = i + j + 1;
+		}
+		i++;
+	} else {
+		i = dir->f_hfree;
+		if ((r = dir_entry(dir, i - 1, &f)) < 0)
+			return r;
+		dir->f_hfree = f->f_hnext;
+	}
+	// Delayed blocks are found by File, so a reused entry must not
+	// inherit any left behind by the file that had it before.
+	da_discard(f, 0);
+	memset(f, 0, sizeof(struct File));
+	strcpy(f->f_name, name);
+	buckets = diskaddr(dir->f_hindex);
+	f->f_hnext = buckets[dir_hash(name)];
+	buckets[dir_hash(name)] = i;
+	*file = f;
+	return 0;
+
+found:
+	da_discard(f, 0);
+	memset(f, 0, sizeof(struct File));
+	strcpy(f->f_name, name);
+	*file = f;
+	return 0;
+}
+
+// Take file f out of dir and mark its entry free.
+static int
+dir_unlink(struct File *dir, struct File *f)
+{
+	int r;
+	uint32_t i, b, *buckets;
+	struct File *e, *prev;
+
+	if (dir->f_hindex) {
+		buckets = diskaddr(dir->f_hindex);
+		b = dir_hash(f->f_name);
+		prev = NULL;
+		for (i = buckets[b]; i != 0; prev = e, i = e->f_hnext) {
+			if ((r = dir_entry(dir, i - 1, &e)) < 0)
+				return r;
+			if (e == f)
+				break;
+		}
+		if (i == 0)
+			panic("dir_unlink: %s missing from its hash bucket", f->f_name);
+		if (prev)
+			prev->f_hnext = f->f_hnext;
+		else
+			buckets[b] = f->f_hnext;
+		f->f_hnext = dir->f_hfree;
+		dir->f_hfree = i;
+	}
+	f->f_name[0] = '\0';
 	return 0;
 }
 
+// dir_lookup, going through the path-resolution cache.
+static int
+dir_lookup_cached(struct File *dir, const char *name, struct File **file)
+{
+	int r;
+
+	if (dcache_lookup(dir, name, file))
+		return *file ? 0 : -E_NOT_FOUND;
+	r = dir_lookup(dir, name, file);
+	if (r == 0)
+		dcache_enter(dir, name, *file);
+	else if (r == -E_NOT_FOUND)
+		dcache_enter(dir, name, 0);
+	return r;
+}
+
 // Skip over slashes.
 static const char*
 skip_slash(const char *p)
@@ -304,7 +972,7 @@ walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem
 		if (dir->f_type != FTYPE_DIR)
 			return -E_NOT_FOUND;
 
-		if ((r = dir_lookup(dir, name, &f)) < 0) {
+		if ((r = dir_lookup_cached(dir, name, &f)) < 0) {
 			if (r == -E_NOT_FOUND && *path == '\0') {
 				if (pdir)
 					*pdir = dir;
@@ -326,10 +994,11 @@ walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem
 // File operations
 // --------------------------------------------------------------
 
-// Create "path".  On success set *pf to point at the file and return 0.
+// Create "path" as a file of the given type (FTYPE_REG or FTYPE_DIR).
+// On success set *pf to point at the file and return 0.
 // On error return < 0.
 int
-file_create(const char *path, struct File **pf)
+file_create(const char *path, int type, struct File **pf)
 {
 	char name[MAXNAMELEN];
 	int r;
@@ -339,10 +1008,11 @@ file_create(const char *path, struct File **pf)
 		return -E_FILE_EXISTS;
 	if (r != -E_NOT_FOUND || dir == 0)
 		return r;
-	if ((r = dir_alloc_file(dir, &f)) < 0)
+	if ((r = dir_alloc_file(dir, name, &f)) < 0)
 		return r;
+	f->f_type = type;
+	dcache_enter(dir, name, f);
 
-	strcpy(f->f_name, name);
 	*pf = f;
 	file_flush(dir);
 	return 0;
@@ -358,6 +1028,7 @@ file_open(const char *path, struct File **pf)
 
 // Read count bytes from f into buf, starting from seek position
 // offset.  This meant to mimic the standard pread function.
+// Holes read as zeros.
 // Returns the number of bytes read, < 0 on error.
 ssize_t
 file_read(struct File *f, void *buf, size_t count, off_t offset)
@@ -372,10 +1043,13 @@ file_read(struct File *f, void *buf, size_t count, off_t offset)
 	count = MIN(count, f->f_size - offset);
 
 	for (pos = offset; pos < offset + count; ) {
-		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
-			return r;
 		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
-		memmove(buf, blk + pos % BLKSIZE, bn);
+		if ((r = file_find_block(f, pos / BLKSIZE, &blk)) == -E_NOT_FOUND)
+			memset(buf, 0, bn);
+		else if (r < 0)
+			return r;
+		else
+			memmove(buf, blk + pos % BLKSIZE, bn);
 		pos += bn;
 		buf += bn;
 	}
@@ -420,7 +1094,9 @@ file_free_block(struct File *f, uint32_t filebno)
 	int r;
 	uint32_t *ptr;
 
-	if ((r = file_block_walk(f, filebno, &ptr, 0)) < 0)
+	if ((r = file_block_walk(f, filebno, &ptr, 0)) == -E_NOT_FOUND)
+		return 0;
+	if (r < 0)
 		return r;
 	if (*ptr) {
 		free_block(*ptr);
@@ -433,33 +1109,76 @@ file_free_block(struct File *f, uint32_t filebno)
 // but not necessary for a file of size 'newsize'.
 // For both the old and new sizes, figure out the number of blocks required,
 // and then clear the blocks from new_nblocks to old_nblocks.
-// If the new_nblocks is no more than NDIRECT, and the indirect block has
-// been allocated (f->f_indirect != 0), then free the indirect block too.
-// (Remember to clear the f->f_indirect pointer so you'll know
-// whether it's valid!)
+// Then free whichever indirect blocks no longer map anything: the
+// indirect block once new_nblocks is no more than NDIRECT, leaf tables
+// past the new end, and the doubly-indirect block once no leaf is left.
 // Do not change f->f_size.
 static void
 file_truncate_blocks(struct File *f, off_t newsize)
 {
 	int r;
-	uint32_t bno, old_nblocks, new_nblocks;
+	uint32_t bno, old_nblocks, new_nblocks, idx, *leaves;
 
 	old_nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
 	new_nblocks = (newsize + BLKSIZE - 1) / BLKSIZE;
-	for (bno = new_nblocks; bno < old_nblocks; bno++)
+	da_discard(f, new_nblocks);
+	for (bno = new_nblocks; bno < old_nblocks; bno++) {
+		if (bno >= NDIRECT + NINDIRECT) {
+			// Without a doubly-indirect block there is
+			// nothing more to free.
+			if (!f->f_dindirect)
+				break;
+			if (((uint32_t *) diskaddr(f->f_dindirect))[(bno - NDIRECT - NINDIRECT) / NINDIRECT] == 0) {
+				bno = next_leaf(bno) - 1;
+				continue;
+			}
+		}
 		if ((r = file_free_block(f, bno)) < 0)
 			cprintf("warning: file_free_block: %e", r);
+	}
+	walk_hint_drop(f);
+
+	if (f->f_dindirect) {
+		idx = 0;
+		if (new_nblocks > NDIRECT + NINDIRECT)
+			idx = ROUNDUP(new_nblocks - NDIRECT - NINDIRECT, NINDIRECT) / NINDIRECT;
+		leaves = diskaddr(f->f_dindirect);
+		for (; idx < NINDIRECT; idx++)
+			if (leaves[idx]) {
+				free_block(leaves[idx]);
+				leaves[idx] = 0;
+			}
+		if (new_nblocks <= NDIRECT + NINDIRECT) {
+			free_block(f->f_dindirect);
+			f->f_dindirect = 0;
+		}
+	}
 
 	if (new_nblocks <= NDIRECT && f->f_indirect) {
 		free_block(f->f_indirect);
 		f->f_indirect = 0;
 	}
+
+	// Cached lookups in a directory point into the blocks just freed.
+	if (f->f_type == FTYPE_DIR && new_nblocks < old_nblocks)
+		dcache_purge(f);
+
+	// A directory's index refers to entries by number, so drop it once
+	// entries are cut off rather than let it point past the end; it is
+	// rebuilt on demand.
+	if (f->f_hindex && ROUNDUP(newsize, sizeof(struct File)) < f->f_size) {
+		free_block(f->f_hindex);
+		f->f_hindex = 0;
+		f->f_hfree = 0;
+	}
 }
 
 // Set the size of file f, truncating or extending as necessary.
 int
 file_set_size(struct File *f, off_t newsize)
 {
+	if (newsize < 0 || newsize > MAXFILESIZE)
+		return -E_INVAL;
 	if (f->f_size > newsize)
 		file_truncate_blocks(f, newsize);
 	f->f_size = newsize;
@@ -467,34 +1186,257 @@ file_set_size(struct File *f, off_t newsize)
 	return 0;
 }
 
-// Flush the contents and metadata of file f out to disk.
+// Does directory dir have no entries left?
+static bool
+dir_is_empty(struct File *dir)
+{
+	uint32_t i;
+	struct File *f;
+
+	for (i = 0; i < dir->f_size / sizeof(struct File); i++)
+		if (dir_entry(dir, i, &f) < 0 || f->f_name[0])
+			return false;
+	return true;
+}
+
+// Remove "path", freeing its blocks.  Returns 0 on success, < 0 on error.
+// Directories can only be removed once they are empty (-E_NOT_EMPTY).
+int
+file_remove(const char *path)
+{
+	int r;
+	struct File *dir, *f;
+
+	if ((r = walk_path(path, &dir, &f, 0)) < 0)
+		return r;
+	if (dir == 0)
+		return -E_INVAL;
+	if (f->f_type == FTYPE_DIR && !dir_is_empty(f))
+		return -E_NOT_EMPTY;
+
+	dcache_enter(dir, f->f_name, 0);
+	file_truncate_blocks(f, 0);
+	walk_hint_drop(f);
+	f->f_size = 0;
+	if ((r = dir_unlink(dir, f)) < 0)
+		return r;
+	flush_block(f);
+	file_flush(dir);
+	return 0;
+}
+
+// Flush f's indirect blocks, hash index and struct File out to disk.
+static void
+file_flush_meta(struct File *f)
+{
+	static uint32_t blocks[FLUSH_BATCH];
+	uint32_t i, n, *leaves;
+
+	n = 0;
+	if (f->f_dindirect) {
+		leaves = diskaddr(f->f_dindirect);
+		for (i = 0; i < NINDIRECT; i++)
+			if (leaves[i])
+				blocks[n++] = leaves[i];
+		blocks[n++] = f->f_dindirect;
+	}
+	if (f->f_indirect)
+		blocks[n++] = f->f_indirect;
+	if (f->f_hindex)
+		blocks[n++] = f->f_hindex;
+	bc_flush_list(blocks, n);
+	flush_block(f);
+}
+
+// Flush the contents and metadata of file f out to disk, committing
+// its delayed blocks first.
 // Loop over all the blocks in file.
-// Translate the file block number into a disk block number
-// and then check whether that disk block is dirty.  If so, write it out.
+// Translate the file block number into a disk block number and collect
+// it; bc_flush_list writes out the dirty ones in disk order, a batch
+// at a time.
 void
 file_flush(struct File *f)
 {
-	int i;
-	uint32_t *pdiskbno;
-
-	for (i = 0; i < (f->f_size + BLKSIZE - 1) / BLKSIZE; i++) {
-		if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
-		    pdiskbno == NULL || *pdiskbno == 0)
+	static uint32_t blocks[FLUSH_BATCH];
+	int r, n;
+	uint32_t i, nblocks, *pdiskbno;
+
+	if (f->f_type == FTYPE_REG && (r = file_commit(f)) < 0)
+		cprintf("warning: file_commit: %e\n", r);
+
+	n = 0;
+	nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+	for (i = 0; i < nblocks; i++) {
+		if ((r = file_block_walk(f, i, &pdiskbno, 0)) == -E_NOT_FOUND) {
+			i = next_leaf(i) - 1;
 			continue;
-		flush_block(diskaddr(*pdiskbno));
+		}
+		if (r < 0 || pdiskbno == NULL || *pdiskbno == 0)
+			continue;
+		blocks[n++] = *pdiskbno;
+		if (n == FLUSH_BATCH) {
+			bc_flush_list(blocks, n);
+			n = 0;
+		}
 	}
-	flush_block(f);
-	if (f->f_indirect)
-		flush_block(diskaddr(f->f_indirect));
+	bc_flush_list(blocks, n);
+
+	// Then the indirect blocks, which the loop above may have dirtied.
+	file_flush_meta(f);
 }
 
 
-// Sync the entire file system.  A big hammer.
+// Sync the entire file system.  A big hammer, but only as big as the
+// set of blocks in the cache.
 void
 fs_sync(void)
 {
-	int i;
-	for (i = 1; i < super->s_nblocks; i++)
-		flush_block(diskaddr(i));
+	int r;
+
+	if ((r = file_commit(0)) < 0)
+		cprintf("warning: file_commit: %e\n", r);
+	bc_flush();
+}
+
+// Periodic work between requests.  Delayed blocks are committed once
+// the oldest is BC_FLUSH_MSEC old, so that they reach the disk about
+// as soon as other dirty blocks do; that needs 'exclusive' use of the
+// file system.
+void
+fs_tick(bool exclusive)
+{
+	int r;
+
+	if (exclusive && da_count > 0
+	    && (int32_t) (sys_time_msec() - da_since) >= BC_FLUSH_MSEC
+	    && (r = file_commit(0)) < 0)
+		cprintf("warning: file_commit: %e\n", r);
+	bc_tick();
+}
+
+// When fs_tick next has work to do, as a sys_time_msec() value.
+uint32_t
+fs_tick_due(void)
+{
+	uint32_t due = bc_tick_due();
+
+	if (da_count > 0 && (int32_t) (da_since + BC_FLUSH_MSEC - due) < 0)
+		due = da_since + BC_FLUSH_MSEC;
+	return due;
+}
+
+// Count the physically contiguous extents of f's blocks.
+int
+file_extents(struct File *f)
+{
+	uint32_t i, nblocks, *pdiskbno, prev;
+	int r, n;
+
+	n = prev = 0;
+	nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+	for (i = 0; i < nblocks; i++) {
+		if ((r = file_block_walk(f, i, &pdiskbno, 0)) == -E_NOT_FOUND) {
+			i = next_leaf(i) - 1;
+			continue;
+		}
+		if (r < 0)
+			return r;
+		if (*pdiskbno == 0)
+			continue;
+		if (n == 0 || *pdiskbno != prev + 1)
+			n++;
+		prev = *pdiskbno;
+	}
+	return n;
+}
+
+// Find the first run of at least 'want' free blocks on the disk.
+// Returns its first block, or -1 if there is none.
+static int
+free_run(uint32_t want)
+{
+	uint32_t b, n;
+
+	for (b = n = 0; b < super->s_nblocks; b++) {
+		if (b % 32 == 0 && bitmap[b / 32] == 0) {
+			b += 31;
+			n = 0;
+		} else if (!block_is_free(b))
+			n = 0;
+		else if (++n == want)
+			return b - want + 1;
+	}
+	return -1;
+}
+
+// Rewrite regular file f's data blocks contiguously, at the first free
+// run on the disk that fits them all, if there is one.  A batch at a
+// time, the blocks are copied to newly allocated ones, which are
+// written out before f is pointed at them; the old blocks are freed
+// only once the new pointers are on disk too, so a crash at any point
+// leaves the file's data intact.  Indirect blocks stay where they are.
+// Returns 0 on success, < 0 on error.
+int
+file_repack(struct File *f)
+{
+	static uint32_t bnos[FLUSH_BATCH], olds[FLUSH_BATCH];
+	static uint32_t news[FLUSH_BATCH], sorted[FLUSH_BATCH];
+	uint32_t bno, nblocks, goal, start, i, j, n, *pdiskbno;
+	int r;
+
+	if (f->f_type != FTYPE_REG)
+		return -E_INVAL;
+	// Commit everyone's delayed blocks, so that the blocks taken here
+	// cannot eat into the space reserved for them.
+	if ((r = file_commit(0)) < 0)
+		return r;
+	if (file_extents(f) <= 1)
+		return 0;
+
+	nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+	goal = (r = free_run(nblocks)) >= 0 ? r : alloc_rotor;
+	for (bno = 0; bno < nblocks; ) {
+		for (n = 0; bno < nblocks && n < FLUSH_BATCH; bno++) {
+			if ((r = file_block_walk(f, bno, &pdiskbno, 0)) == -E_NOT_FOUND) {
+				bno = next_leaf(bno) - 1;
+				continue;
+			}
+			if (r < 0)
+				return r;
+			if (*pdiskbno == 0)
+				continue;
+			bnos[n] = bno;
+			olds[n++] = *pdiskbno;
+		}
+
+		// Copy the batch to new blocks and write those out.
+		for (i = 0; i < n; i += r) {
+			if ((r = alloc_extent(goal, n - i, &start)) < 0) {
+				while (i-- > 0)
+					free_block(news[i]);
+				return r;
+			}
+			for (j = 0; j < r; j++) {
+				news[i + j] = start + j;
+				memmove(diskaddr(start + j), diskaddr(olds[i + j]), BLKSIZE);
+			}
+			goal = start + r;
+		}
+		memmove(sorted, news, n * sizeof(news[0]));
+		bc_flush_list(sorted, n);
+
+		// Switch the file over, make that stick, and only then let
+		// the old blocks go.
+		for (i = 0; i < n; i++) {
+			if ((r = file_block_walk(f, bnos[i], &pdiskbno, 0)) < 0)
+				panic("file_repack: file_block_walk: %e", r);
+			*pdiskbno = news[i];
+		}
+		walk_hint_drop(f);
+		file_flush_meta(f);
+		for (i = 0; i < n; i++)
+			free_block(olds[i]);
+	}
+	return 0;
 }
 
@@ -11,6 +11,64 @@
 /* Maximum disk size we can handle (3GB) */
 #define DISKSIZE	0xC0000000
 
+/* Default and maximum number of evictable blocks in the block cache */
+#define BC_DEFAULT_BUDGET	512
+#define BC_MAXSLOTS		4096
+/* Maximum number of pinned metadata blocks */
+#define BC_MAXPINS		1024
+/* Interval between periodic write-backs of dirty blocks, in ms */
+#define BC_FLUSH_MSEC		1000
+/* Largest readahead window; one IDE command moves at most 256 sectors */
+#define BC_RA_MAX		(256 / BLKSECTS)
+
+/* Where one sequential reader is, for readahead (see bc_ra_window) */
+struct BcReadahead {
+	uint32_t ra_next;	// block right after the last window
+	uint32_t ra_size;	// blocks in the last window
+};
+
+/* Number of entries and hash buckets in the path-resolution cache */
+#define DCACHE_SIZE		512
+#define DCACHE_NBUCKETS		1024
+
+/* Number of server threads handling requests, and their stack size */
+#define FS_NTHREADS		8
+#define FS_STACKSIZE		(4*PGSIZE)
+
+/* Each server thread receives requests in a window of its own below the
+ * disk map: the request page, then room for the pages of a bulk read or
+ * write.  Below those, each thread, the dispatcher included, has a
+ * staging area the block cache reads misses into. */
+#define FSREQ_WINDOW		((1 + FSBULK_MAXPAGES) * PGSIZE)
+#define FSREQ_VA		(DISKMAP - FS_NTHREADS * FSREQ_WINDOW)
+#define BC_STAGE_VA		(FSREQ_VA - (1 + FS_NTHREADS) * BC_RA_MAX * BLKSIZE)
+
+/* Deepest a recursive directory listing descends */
+#define FS_WALKDEPTH		16
+
+/* Clients' request rings, at most one per environment, live below that */
+#define FS_MAXRINGS		16
+#define FSRINGS_VA		(BC_STAGE_VA - FS_MAXRINGS * FSRING_NPAGES * PGSIZE)
+
+/* Most file blocks written but not yet given disk space, and the pages
+ * that hold them until then, below the rings */
+#define DELALLOC_MAX		1024
+#define DELALLOC_NBUCKETS	2048
+#define DELALLOC_VA		(FSRINGS_VA - DELALLOC_MAX * PGSIZE)
+
+// A FIFO lock that can be held shared or exclusive; see thread.c.
+struct Lock {
+	uint32_t l_next;		// next ticket to hand out
+	uint32_t l_serving;		// ticket allowed in next
+	int l_readers;			// number of shared holders
+};
+
+struct DcStats {
+	uint32_t ds_hits;		// lookups answered from the cache
+	uint32_t ds_misses;		// lookups that went to the directory
+	uint32_t ds_evictions;		// entries recycled by LRU
+};
+
 extern struct Super *super;		// superblock
 extern uint32_t *bitmap;		// bitmap blocks mapped in memory
 
@@ -23,26 +81,67 @@ int	ide_write(uint32_t secno, const void *src, size_t nsecs);
 
 /* bc.c */
 void*	diskaddr(uint32_t blockno);
+void*	bc_lookup(uint32_t blockno);
+void	bc_set_readahead(struct BcReadahead *ra);
 bool	va_is_mapped(void *va);
 bool	va_is_dirty(void *va);
 void	flush_block(void *addr);
+void	bc_pin(uint32_t blockno);
+void	bc_unpin(uint32_t blockno);
+void	bc_unshare(uint32_t blockno);
+bool	bc_is_pinned(uint32_t blockno);
+void	bc_set_budget(uint32_t npages);
+void	bc_evict(void);
+void	bc_flush_list(uint32_t *blocks, uint32_t n);
+void	bc_insert(uint32_t blockno, void *pg);
+void	bc_flush(void);
+void	bc_tick(void);
+uint32_t bc_tick_due(void);
 void	bc_init(void);
 
+extern struct BcStats bcstats;
+
+/* dcache.c */
+int	dcache_lookup(struct File *dir, const char *name, struct File **pf);
+void	dcache_enter(struct File *dir, const char *name, struct File *f);
+void	dcache_purge(struct File *dir);
+
+extern struct DcStats dcstats;
+
 /* fs.c */
 void	fs_init(void);
 int	file_get_block(struct File *f, uint32_t file_blockno, char **pblk);
-int	file_create(const char *path, struct File **f);
+int	file_find_block(struct File *f, uint32_t file_blockno, char **pblk);
+int	dir_entry(struct File *dir, uint32_t i, struct File **pf);
+int	file_create(const char *path, int type, struct File **f);
 int	file_open(const char *path, struct File **f);
 ssize_t	file_read(struct File *f, void *buf, size_t count, off_t offset);
 int	file_write(struct File *f, const void *buf, size_t count, off_t offset);
 int	file_set_size(struct File *f, off_t newsize);
 void	file_flush(struct File *f);
+int	file_commit(struct File *f);
+int	file_extents(struct File *f);
+int	file_repack(struct File *f);
 int	file_remove(const char *path);
 void	fs_sync(void);
+void	fs_tick(bool exclusive);
+uint32_t fs_tick_due(void);
 
 /* int	map_block(uint32_t); */
 bool	block_is_free(uint32_t blockno);
 int	alloc_block(uint32_t *pblockno);
+int	alloc_block_near(uint32_t goal, uint32_t *pblockno);
+int	alloc_extent(uint32_t goal, uint32_t want, uint32_t *pstart);
+
+/* thread.c */
+void	thread_create(void (*fn)(int), int arg);
+void	thread_yield(void);
+int	thread_current(void);
+uint32_t lock_ticket(struct Lock *l);
+void	lock_wait(struct Lock *l, uint32_t ticket, bool shared);
+void	lock_acquire(struct Lock *l, bool shared);
+void	lock_release(struct Lock *l, bool shared);
+bool	lock_busy(struct Lock *l);
 
 /* test.c */
 void	fs_test(void);
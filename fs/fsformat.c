@@ -134,17 +134,30 @@ finishdisk(void)
 void
 finishfile(struct File *f, uint32_t start, uint32_t len)
 {
-	int i;
+	int i, n;
+	uint32_t *ind, *dind, *leaf;
+
 	f->f_size = len;
-	len = ROUNDUP(len, BLKSIZE);
-	for (i = 0; i < len / BLKSIZE && i < NDIRECT; ++i)
+	n = ROUNDUP(len, BLKSIZE) / BLKSIZE;
+	for (i = 0; i < n && i < NDIRECT; ++i)
 		f->f_direct[i] = start + i;
-	if (i == NDIRECT) {
-		uint32_t *ind = alloc(BLKSIZE);
+	if (i < n) {
+		ind = alloc(BLKSIZE);
 		f->f_indirect = blockof(ind);
-		for (; i < len / BLKSIZE; ++i)
+		for (; i < n && i < NDIRECT + NINDIRECT; ++i)
 			ind[i - NDIRECT] = start + i;
 	}
+	if (i < n) {
+		dind = alloc(BLKSIZE);
+		f->f_dindirect = blockof(dind);
+		for (leaf = NULL; i < n; ++i) {
+			if ((i - NDIRECT - NINDIRECT) % NINDIRECT == 0) {
+				leaf = alloc(BLKSIZE);
+				dind[(i - NDIRECT - NINDIRECT) / NINDIRECT] = blockof(leaf);
+			}
+			leaf[(i - NDIRECT - NINDIRECT) % NINDIRECT] = start + i;
+		}
+	}
 }
 
 void
@@ -169,12 +182,30 @@ diradd(struct Dir *d, uint32_t type, const char *name)
 void
 finishdir(struct Dir *d)
 {
-	int size = d->n * sizeof(struct File);
+	int i, b, size = d->n * sizeof(struct File);
 	struct File *start = alloc(size);
+	uint32_t *buckets;
+
 	memmove(start, d->ents, size);
 	finishfile(d->f, blockof(start), ROUNDUP(size, BLKSIZE));
 	free(d->ents);
 	d->ents = NULL;
+
+	// Build the directory's hash index (see fs/fs.c), chaining the
+	// slack in the last block onto the free list.
+	buckets = alloc(BLKSIZE);
+	d->f->f_hindex = blockof(buckets);
+	d->f->f_hfree = 0;
+	for (i = d->f->f_size / sizeof(struct File) - 1; i >= 0; i--) {
+		if (i < d->n) {
+			b = dir_hash(start[i].f_name);
+			start[i].f_hnext = buckets[b];
+			buckets[b] = i + 1;
+		} else {
+			start[i].f_hnext = d->f->f_hfree;
+			d->f->f_hfree = i + 1;
+		}
+	}
 }
 
 void
@@ -228,7 +259,8 @@ main(int argc, char **argv)
 		usage();
 
 	nblocks = strtol(argv[2], &s, 0);
-	if (*s || s == argv[2] || nblocks < 2 || nblocks > 1024)
+	// Up to DISKSIZE in fs/fs.h
+	if (*s || s == argv[2] || nblocks < 2 || nblocks > 0xC0000000 / BLKSIZE)
 		usage();
 
 	opendisk(argv[1]);
@@ -14,13 +14,15 @@
 
 static int diskno = 1;
 
+// Wait for the drive to be ready, letting the file server's other
+// threads run meanwhile.  Callers hold the block cache's disk lock.
 static int
 ide_wait_ready(bool check_error)
 {
 	int r;
 
 	while (((r = inb(0x1F7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
-		/* do nothing */;
+		thread_yield();
 
 	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
 		return -1;
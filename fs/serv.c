@@ -28,12 +28,28 @@
 //    communicate with the server.  File IDs are a lot like
 //    environment IDs in the kernel.  Use openfile_lookup to translate
 //    file IDs to struct OpenFile.
+//
+// Requests are served by FS_NTHREADS worker threads (see thread.c), so
+// that one client's request can go ahead while another's waits for the
+// disk.  The main thread receives each request straight into the window
+// of a free worker and queues it on two FIFO locks: the lock of the open
+// file it names, which keeps requests on one file in order, and fs_lock,
+// which requests that only read the file system hold shared and all
+// others hold exclusive.
 
 struct OpenFile {
 	uint32_t o_fileid;	// file id
 	struct File *o_file;	// mapped descriptor for open file
 	int o_mode;		// open mode
 	struct Fd *o_fd;	// Fd page
+	struct Lock o_lock;	// orders requests on this file
+	struct BcReadahead o_ra;	// readahead through this open file
+	// Where a recursive FSREQ_READDIR is: the next entry to look at in
+	// each directory it is in, outermost first.  Directory i > 0 is
+	// entry o_wnext[i-1] - 1 of directory i - 1.
+	uint32_t o_wnext[FS_WALKDEPTH];
+	int o_wdepth;
+	off_t o_woffset;	// fd_offset the walk left behind
 };
 
 // Max number of open files in the file system at once
@@ -45,8 +61,43 @@ struct OpenFile opentab[MAXOPEN] = {
 	{ 0, 0, 1, 0 }
 };
 
-// Virtual address at which to receive page mappings containing client requests.
-union Fsipc *fsreq = (union Fsipc *)0x0ffff000;
+struct Worker {
+	bool w_busy;		// holds a request to serve
+	envid_t w_whom;		// the client
+	uint32_t w_req;		// request type
+	int w_perm;		// permissions of the request page
+	int w_npages;		// pages received, the request page included
+	bool w_shared;		// holds fs_lock shared
+	uint32_t w_ticket;	// ticket for fs_lock
+	struct OpenFile *w_o;	// file whose o_lock it queued on, if any
+	uint32_t w_oticket;	// ticket for w_o->o_lock
+	uint32_t w_pins[FSBULK_MAXPAGES];	// blocks serve_map pinned
+	int w_npins;
+};
+
+static struct Worker workers[FS_NTHREADS];
+static struct Lock fs_lock;
+
+// Each worker receives requests at the start of its window below the
+// disk map, and the buffer pages of a bulk request right behind them.
+static union Fsipc *
+worker_req(struct Worker *w)
+{
+	return (union Fsipc *) (FSREQ_VA + (w - workers) * FSREQ_WINDOW);
+}
+
+static char *
+worker_data(struct Worker *w)
+{
+	return (char *) worker_req(w) + PGSIZE;
+}
+
+// The worker the running thread serves requests for.
+static struct Worker *
+curworker(void)
+{
+	return &workers[thread_current() - 1];
+}
 
 void
 serve_init(void)
@@ -66,8 +117,11 @@ openfile_alloc(struct OpenFile **o)
 {
 	int i, r;
 
-	// Find an available open-file table entry
+	// Find an available open-file table entry.  Skip entries that
+	// requests are still queued on, even if they were closed.
 	for (i = 0; i < MAXOPEN; i++) {
+		if (lock_busy(&opentab[i].o_lock))
+			continue;
 		switch (pageref(opentab[i].o_fd)) {
 		case 0:
 			if ((r = sys_page_alloc(0, opentab[i].o_fd, PTE_P|PTE_U|PTE_W)) < 0)
@@ -105,7 +159,7 @@ serve_open(envid_t envid, struct Fsreq_open *req,
 {
 	char path[MAXPATHLEN];
 	struct File *f;
-	int fileid;
+	int fileid, type;
 	int r;
 	struct OpenFile *o;
 
@@ -116,17 +170,10 @@ serve_open(envid_t envid, struct Fsreq_open *req,
 	memmove(path, req->req_path, MAXPATHLEN);
 	path[MAXPATHLEN-1] = 0;
 
-	// Find an open file ID
-	if ((r = openfile_alloc(&o)) < 0) {
-		if (debug)
-			cprintf("openfile_alloc failed: %e", r);
-		return r;
-	}
-	fileid = r;
-
 	// Open the file
 	if (req->req_omode & O_CREAT) {
-		if ((r = file_create(path, &f)) < 0) {
+		type = (req->req_omode & O_MKDIR) ? FTYPE_DIR : FTYPE_REG;
+		if ((r = file_create(path, type, &f)) < 0) {
 			if (!(req->req_omode & O_EXCL) && r == -E_FILE_EXISTS)
 				goto try_open;
 			if (debug)
@@ -151,8 +198,19 @@ try_open:
 		}
 	}
 
+	// Find an open file ID.  Only now, as opening the file may wait
+	// for the disk, and the entry looks free until the Fd page is sent.
+	if ((r = openfile_alloc(&o)) < 0) {
+		if (debug)
+			cprintf("openfile_alloc failed: %e", r);
+		return r;
+	}
+	fileid = r;
+
 	// Save the file pointer
 	o->o_file = f;
+	o->o_wdepth = 0;
+	o->o_ra.ra_next = o->o_ra.ra_size = 0;
 
 	// Fill out the Fd structure
 	o->o_fd->fd_file.id = o->o_fileid;
@@ -244,6 +302,416 @@ serve_write(envid_t envid, struct Fsreq_write *req)
 	return r;
 }
 
+// Check that the buffer pages received with a bulk request cover
+// [off, off+n) past the worker's request page, and are mapped with
+// permissions perm.
+static int
+fsdata_check(struct Worker *w, size_t off, size_t n, int perm)
+{
+	size_t i;
+
+	perm |= PTE_P | PTE_U;
+	if (off >= PGSIZE || n > FSBULK_MAXPAGES * PGSIZE
+	    || off + n > (w->w_npages - 1) * PGSIZE)
+		return -E_INVAL;
+	for (i = ROUNDDOWN(off, PGSIZE); i < off + n; i += PGSIZE)
+		if ((uvpt[PGNUM(worker_data(w) + i)] & perm) != perm)
+			return -E_INVAL;
+	return 0;
+}
+
+// Read at most req->req_n bytes from the current seek position in
+// req->req_fileid directly into the client's buffer pages, starting
+// req->req_off bytes into the first, then update the seek position.
+// Returns the number of bytes read, or < 0 on error.
+int
+serve_read_bulk(envid_t envid, struct Fsreq_bulk *req)
+{
+	struct Worker *w = curworker();
+	struct OpenFile *o;
+	ssize_t r;
+
+	if (debug)
+		cprintf("serve_read_bulk %08x %08x %08x\n", envid, req->req_fileid, req->req_n);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if ((r = fsdata_check(w, req->req_off, req->req_n, PTE_W)) < 0)
+		return r;
+	r = file_read(o->o_file, worker_data(w) + req->req_off, req->req_n,
+		      o->o_fd->fd_offset);
+	if (r > 0)
+		o->o_fd->fd_offset += r;
+	return r;
+}
+
+// Write req->req_n bytes from the client's buffer pages, starting
+// req->req_off bytes into the first, to req_fileid at the current seek
+// position, and update the seek position accordingly.  Returns the
+// number of bytes written, or < 0 on error.
+int
+serve_write_bulk(envid_t envid, struct Fsreq_bulk *req)
+{
+	struct Worker *w = curworker();
+	struct OpenFile *o;
+	ssize_t r;
+
+	if (debug)
+		cprintf("serve_write_bulk %08x %08x %08x\n", envid, req->req_fileid, req->req_n);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if ((r = fsdata_check(w, req->req_off, req->req_n, 0)) < 0)
+		return r;
+	r = file_write(o->o_file, worker_data(w) + req->req_off, req->req_n,
+		       o->o_fd->fd_offset);
+	if (r > 0)
+		o->o_fd->fd_offset += r;
+	return r;
+}
+
+// Map up to req->req_npages pages of req->req_fileid, starting at the
+// page-aligned offset req->req_offset, into the caller.  The caller gets
+// the block cache pages themselves, read-only, so the data is never
+// copied and every client mapping the same block shares one page.
+// Pages at or past the end of the file, or past a hole, are not mapped.
+// The file's delayed blocks are committed first, so that every page
+// sent is a block cache page and stays the one that holds the block;
+// that needs fs_lock exclusively.
+// The pages to send are stored in pages[], and their number in *npages.
+// Returns the number of pages, or < 0 on error.
+int
+serve_map(envid_t envid, struct Fsreq_map *req, uintptr_t *pages, int *npages)
+{
+	struct Worker *w = curworker();
+	struct OpenFile *o;
+	uint32_t blockno;
+	off_t off;
+	char *blk;
+	int i, n, r;
+
+	if (debug)
+		cprintf("serve_map %08x %08x %08x %d\n", envid, req->req_fileid,
+			req->req_offset, req->req_npages);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if (PGOFF(req->req_offset) || req->req_offset < 0)
+		return -E_INVAL;
+	if (o->o_file->f_type == FTYPE_REG && (r = file_commit(o->o_file)) < 0)
+		return r;
+
+	for (n = 0; n < MIN(req->req_npages, FSBULK_MAXPAGES); n++) {
+		off = req->req_offset + n * PGSIZE;
+		if (off >= o->o_file->f_size)
+			break;
+		if ((r = file_find_block(o->o_file, off / BLKSIZE, &blk)) < 0) {
+			if (n == 0)
+				return r;
+			break;
+		}
+		// Fault the block in, and keep it in until the reply is
+		// out: the pages are sent straight from the cache.
+		*(volatile char *) blk;
+		blockno = ((uintptr_t) blk - DISKMAP) / BLKSIZE;
+		if (!bc_is_pinned(blockno)) {
+			bc_pin(blockno);
+			if (!bc_is_pinned(blockno))
+				break;
+			w->w_pins[w->w_npins++] = blockno;
+		}
+		pages[n] = (uintptr_t) blk | PTE_P | PTE_U;
+	}
+
+	// Blocks that were pinned already may have been unpinned, and
+	// evicted, by another thread while we waited for the disk.  Fault
+	// them back in until all of them are there at once.
+	for (i = 0; i < n; i++)
+		if (!va_is_mapped((void *) ROUNDDOWN(pages[i], PGSIZE))) {
+			*(volatile char *) ROUNDDOWN(pages[i], PGSIZE);
+			i = -1;
+		}
+	*npages = n;
+	return n;
+}
+
+// Return up to req->req_n bytes of packed Fsdirents for the directory
+// req->req_fileid, starting at the current seek position, in
+// ipc->readRet, and move the seek position past them.  With
+// FSREADDIR_RECURSIVE, descend into subdirectories, up to FS_WALKDEPTH
+// levels; the walk picks up where it left off as long as the seek
+// position has not been changed in between.
+// Returns the number of bytes returned, 0 at the end of the directory,
+// or < 0 on error.
+int
+serve_readdir(envid_t envid, union Fsipc *ipc)
+{
+	struct Fsreq_readdir *req = &ipc->readdir;
+	char *buf = ipc->readRet.ret_buf;
+	char path[MAXPATHLEN];
+	struct OpenFile *o;
+	struct Fsdirent *d;
+	struct File *f, *dirs[FS_WALKDEPTH];
+	size_t n, len, reclen, pos;
+	int flags, top, i, r;
+
+	if (debug)
+		cprintf("serve_readdir %08x %08x %08x\n", envid, req->req_fileid, req->req_flags);
+
+	// The reply overwrites the request.
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	n = MIN(req->req_n, PGSIZE);
+	flags = req->req_flags;
+	if (o->o_file->f_type != FTYPE_DIR)
+		return -E_INVAL;
+
+	if (!(flags & FSREADDIR_RECURSIVE) || o->o_wdepth == 0
+	    || o->o_woffset != o->o_fd->fd_offset) {
+		o->o_wnext[0] = o->o_fd->fd_offset / sizeof(struct File);
+		o->o_wdepth = 1;
+	}
+
+	// Find the directories of the walk again from their entry numbers,
+	// since they may have changed between requests.  The walk ends
+	// above one that is no longer a directory.
+	dirs[0] = o->o_file;
+	for (i = 1; i < o->o_wdepth; i++)
+		if (o->o_wnext[i - 1] == 0
+		    || o->o_wnext[i - 1] > dirs[i - 1]->f_size / sizeof(struct File)
+		    || dir_entry(dirs[i - 1], o->o_wnext[i - 1] - 1, &dirs[i]) < 0
+		    || !dirs[i]->f_name[0] || dirs[i]->f_type != FTYPE_DIR) {
+			o->o_wdepth = i;
+			break;
+		}
+
+	for (pos = 0; ; ) {
+		top = o->o_wdepth - 1;
+		f = dirs[top];
+		if (o->o_wnext[top] >= f->f_size / sizeof(struct File)) {
+			if (top == 0)
+				break;
+			o->o_wdepth--;
+			continue;
+		}
+		if ((r = dir_entry(f, o->o_wnext[top], &f)) < 0)
+			return r;
+		if (!f->f_name[0]) {
+			o->o_wnext[top]++;
+			continue;
+		}
+
+		// Name it by its path from the directory being read.
+		for (i = 1, len = strlen(f->f_name); i <= top; i++)
+			len += strlen(dirs[i]->f_name) + 1;
+		if (len >= sizeof path) {
+			o->o_wnext[top]++;
+			continue;
+		}
+		path[0] = 0;
+		for (i = 1; i <= top; i++) {
+			strcat(path, dirs[i]->f_name);
+			strcat(path, "/");
+		}
+		strcat(path, f->f_name);
+
+		reclen = ROUNDUP(offsetof(struct Fsdirent, d_name) + len + 1, 4);
+		if (pos + reclen > n) {
+			if (pos == 0)
+				return -E_INVAL;
+			break;
+		}
+		d = (struct Fsdirent *) (buf + pos);
+		d->d_size = f->f_size;
+		d->d_type = f->f_type;
+		d->d_depth = top;
+		d->d_reclen = reclen;
+		memmove(d->d_name, path, len + 1);
+		pos += reclen;
+
+		o->o_wnext[top]++;
+		if ((flags & FSREADDIR_RECURSIVE) && f->f_type == FTYPE_DIR
+		    && o->o_wdepth < FS_WALKDEPTH) {
+			dirs[o->o_wdepth] = f;
+			o->o_wnext[o->o_wdepth] = 0;
+			o->o_wdepth++;
+		}
+	}
+
+	o->o_fd->fd_offset = o->o_wnext[0] * sizeof(struct File);
+	o->o_woffset = o->o_fd->fd_offset;
+	return pos;
+}
+
+// Open req->req_path, read up to req->req_n bytes from its start, and
+// return its size and type in ipc->slurpRet, all without using an
+// open-file table entry.  The data goes to the buffer pages behind the
+// request page if the client sent any, starting req->req_off bytes into
+// the first, or to ipc->slurpRet.ret_buf if not.  Directories read as
+// empty.
+// Returns the number of bytes read, or < 0 on error.
+int
+serve_slurp(envid_t envid, union Fsipc *ipc)
+{
+	struct Worker *w = curworker();
+	struct Fsreq_slurp *req = &ipc->slurp;
+	struct Fsret_slurp *ret = &ipc->slurpRet;
+	char path[MAXPATHLEN];
+	struct File *f;
+	size_t n, off;
+	char *buf;
+	int r;
+
+	if (debug)
+		cprintf("serve_slurp %08x %s %08x\n", envid, req->req_path, req->req_n);
+
+	// The reply overwrites the request.
+	memmove(path, req->req_path, MAXPATHLEN);
+	path[MAXPATHLEN-1] = 0;
+	n = req->req_n;
+	off = req->req_off;
+
+	if (w->w_npages > 1) {
+		if ((r = fsdata_check(w, off, n, PTE_W)) < 0)
+			return r;
+		buf = worker_data(w) + off;
+	} else {
+		n = MIN(n, sizeof(ret->ret_buf));
+		buf = ret->ret_buf;
+	}
+
+	if ((r = file_open(path, &f)) < 0)
+		return r;
+	ret->ret_size = f->f_size;
+	ret->ret_isdir = (f->f_type == FTYPE_DIR);
+	if (ret->ret_isdir)
+		return 0;
+	return file_read(f, buf, n, 0);
+}
+
+// Request rings, by the environment that set each up.
+static envid_t ring_owners[FS_MAXRINGS];
+
+static struct Fsring *
+ring_va(int i)
+{
+	return (struct Fsring *) (FSRINGS_VA + i * FSRING_NPAGES * PGSIZE);
+}
+
+// Is the environment that set up ring i gone?
+static bool
+ring_abandoned(int i)
+{
+	const volatile struct Env *e = &envs[ENVX(ring_owners[i])];
+
+	return e->env_id != ring_owners[i] || e->env_status == ENV_FREE;
+}
+
+// Take over the ring page and data pages sent behind the request page
+// as envid's request ring, replacing any ring envid had before.
+// Returns the ring's number, or < 0 on error.
+int
+serve_ring_setup(envid_t envid, union Fsipc *ipc)
+{
+	struct Worker *w = curworker();
+	int i, p, r;
+
+	if (debug)
+		cprintf("serve_ring_setup %08x\n", envid);
+
+	if (w->w_npages != 1 + FSRING_NPAGES
+	    || (r = fsdata_check(w, 0, FSRING_NPAGES * PGSIZE, PTE_W)) < 0)
+		return -E_INVAL;
+	for (i = 0; i < FS_MAXRINGS; i++)
+		if (ring_owners[i] == envid)
+			break;
+	if (i == FS_MAXRINGS)
+		for (i = 0; i < FS_MAXRINGS; i++)
+			if (ring_owners[i] == 0 || ring_abandoned(i))
+				break;
+	if (i == FS_MAXRINGS)
+		return -E_MAX_OPEN;
+
+	for (p = 0; p < FSRING_NPAGES; p++)
+		if ((r = sys_page_map(0, worker_data(w) + p * PGSIZE,
+				      0, (char *) ring_va(i) + p * PGSIZE,
+				      PTE_P | PTE_U | PTE_W)) < 0)
+			return r;
+	ring_owners[i] = envid;
+	return i;
+}
+
+// Carry out one submission from a ring of envid's, with data page data.
+static int
+ring_do(envid_t envid, struct Fsring_sqe *sqe, char *data)
+{
+	struct Fsret_stat *st = (struct Fsret_stat *) data;
+	struct OpenFile *o;
+	size_t n = MIN(sqe->sqe_n, PGSIZE);
+	int r;
+
+	if ((r = openfile_lookup(envid, sqe->sqe_fileid, &o)) < 0)
+		return r;
+	if (sqe->sqe_offset < 0)
+		return -E_INVAL;
+	bc_set_readahead(&o->o_ra);
+	switch (sqe->sqe_type) {
+	case FSREQ_READ:
+		return file_read(o->o_file, data, n, sqe->sqe_offset);
+	case FSREQ_WRITE:
+		return file_write(o->o_file, data, n, sqe->sqe_offset);
+	case FSREQ_STAT:
+		strcpy(st->ret_name, o->o_file->f_name);
+		st->ret_size = o->o_file->f_size;
+		st->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+		return 0;
+	default:
+		return -E_INVAL;
+	}
+}
+
+// Work through the submissions on envid's ring, posting a completion
+// for each, until it is empty or the completion queue is full.  The
+// client is not sent a reply.
+int
+serve_ring_kick(envid_t envid, union Fsipc *ipc)
+{
+	struct Fsring *ring;
+	struct Fsring_sqe sqe;
+	struct Fsring_cqe *cqe;
+	int i;
+
+	if (debug)
+		cprintf("serve_ring_kick %08x\n", envid);
+
+	for (i = 0; i < FS_MAXRINGS && ring_owners[i] != envid; i++)
+		/* do nothing */;
+	if (i == FS_MAXRINGS)
+		return -E_INVAL;
+	ring = ring_va(i);
+
+	// The ring is shared with the client, so copy each submission
+	// before looking at it.  r_sqhead is advanced with xchg, a full
+	// barrier, so that the next look at r_sqtail cannot pass it: a
+	// client posting meanwhile either sees the new head and kicks us
+	// again, or still sees the old one and has its submission seen
+	// here (see fsring_post).
+	while (ring->r_sqhead != ring->r_sqtail
+	       && ring->r_cqtail - ring->r_cqhead < FSRING_NSLOTS) {
+		sqe = ring->r_sq[ring->r_sqhead % FSRING_NSLOTS];
+		xchg(&ring->r_sqhead, ring->r_sqhead + 1);
+		cqe = &ring->r_cq[ring->r_cqtail % FSRING_NSLOTS];
+		cqe->cqe_slot = sqe.sqe_slot;
+		if (sqe.sqe_slot < FSRING_NSLOTS)
+			cqe->cqe_result = ring_do(envid, &sqe, (char *) ring
+						  + (1 + sqe.sqe_slot) * PGSIZE);
+		else
+			cqe->cqe_result = -E_INVAL;
+		ring->r_cqtail++;
+	}
+	return 0;
+}
+
 // Stat ipc->stat.req_fileid.  Return the file's struct Stat to the
 // caller in ipc->statRet.
 int
@@ -283,6 +751,22 @@ serve_flush(envid_t envid, struct Fsreq_flush *req)
 }
 
 
+// Remove the file req->req_path.
+int
+serve_remove(envid_t envid, struct Fsreq_remove *req)
+{
+	char path[MAXPATHLEN];
+
+	if (debug)
+		cprintf("serve_remove %08x %s\n", envid, req->req_path);
+
+	// Copy in the path, making sure it's null-terminated
+	memmove(path, req->req_path, MAXPATHLEN);
+	path[MAXPATHLEN-1] = 0;
+
+	return file_remove(path);
+}
+
 int
 serve_sync(envid_t envid, union Fsipc *req)
 {
@@ -290,51 +774,228 @@ serve_sync(envid_t envid, union Fsipc *req)
 	return 0;
 }
 
+// Lay out the blocks of the file req->req_path contiguously, and return
+// how many extents it had before and has now in ipc->defragRet.
+int
+serve_defrag(envid_t envid, union Fsipc *ipc)
+{
+	char path[MAXPATHLEN];
+	struct File *f;
+	int r;
+
+	if (debug)
+		cprintf("serve_defrag %08x %s\n", envid, ipc->defrag.req_path);
+
+	// Copy in the path, making sure it's null-terminated
+	memmove(path, ipc->defrag.req_path, MAXPATHLEN);
+	path[MAXPATHLEN-1] = 0;
+
+	if ((r = file_open(path, &f)) < 0)
+		return r;
+	if ((r = file_commit(f)) < 0 || (r = file_extents(f)) < 0)
+		return r;
+	ipc->defragRet.ret_before = r;
+	if ((r = file_repack(f)) < 0 || (r = file_extents(f)) < 0)
+		return r;
+	ipc->defragRet.ret_after = r;
+	return 0;
+}
+
+// Return the block cache's statistics in ipc->bcstatsRet.
+int
+serve_bcstats(envid_t envid, union Fsipc *ipc)
+{
+	ipc->bcstatsRet = bcstats;
+	return 0;
+}
+
 typedef int (*fshandler)(envid_t envid, union Fsipc *req);
 
 fshandler handlers[] = {
-	// Open is handled specially because it passes pages
+	// Open and map are handled specially because they pass pages
 	/* [FSREQ_OPEN] =	(fshandler)serve_open, */
+	/* [FSREQ_MAP] =	(fshandler)serve_map, */
 	[FSREQ_READ] =		serve_read,
 	[FSREQ_STAT] =		serve_stat,
 	[FSREQ_FLUSH] =		(fshandler)serve_flush,
 	[FSREQ_WRITE] =		(fshandler)serve_write,
 	[FSREQ_SET_SIZE] =	(fshandler)serve_set_size,
-	[FSREQ_SYNC] =		serve_sync
+	[FSREQ_REMOVE] =	(fshandler)serve_remove,
+	[FSREQ_SYNC] =		serve_sync,
+	[FSREQ_READ_BULK] =	(fshandler)serve_read_bulk,
+	[FSREQ_WRITE_BULK] =	(fshandler)serve_write_bulk,
+	[FSREQ_RING_SETUP] =	serve_ring_setup,
+	[FSREQ_RING_KICK] =	serve_ring_kick,
+	[FSREQ_READDIR] =	serve_readdir,
+	[FSREQ_SLURP] =		serve_slurp,
+	[FSREQ_DEFRAG] =	serve_defrag,
+	[FSREQ_BCSTATS] =	serve_bcstats
 };
 
+// Can request 'req' in ipc run alongside other such requests?  Only
+// if it leaves the file system as it is.
+static bool
+req_is_shared(uint32_t req, union Fsipc *ipc)
+{
+	switch (req) {
+	case FSREQ_READ:
+	case FSREQ_READ_BULK:
+	case FSREQ_STAT:
+	case FSREQ_READDIR:
+	case FSREQ_SLURP:
+	case FSREQ_BCSTATS:
+		return true;
+	case FSREQ_OPEN:
+		return !(ipc->open.req_omode & (O_CREAT | O_TRUNC | O_MKDIR));
+	default:
+		return false;
+	}
+}
+
+// Return the open-file table entry request 'req' in ipc names, or 0 for
+// requests that do not name one.  The file ID is not checked yet.
+static struct OpenFile *
+req_openfile(uint32_t req, union Fsipc *ipc)
+{
+	uint32_t fileid;
+
+	switch (req) {
+	case FSREQ_READ:	fileid = ipc->read.req_fileid; break;
+	case FSREQ_WRITE:	fileid = ipc->write.req_fileid; break;
+	case FSREQ_STAT:	fileid = ipc->stat.req_fileid; break;
+	case FSREQ_FLUSH:	fileid = ipc->flush.req_fileid; break;
+	case FSREQ_SET_SIZE:	fileid = ipc->set_size.req_fileid; break;
+	case FSREQ_READ_BULK:
+	case FSREQ_WRITE_BULK:	fileid = ipc->bulk.req_fileid; break;
+	case FSREQ_MAP:		fileid = ipc->map.req_fileid; break;
+	case FSREQ_READDIR:	fileid = ipc->readdir.req_fileid; break;
+	default:
+		return 0;
+	}
+	return &opentab[fileid % MAXOPEN];
+}
+
+// Worker thread i: serve the requests the main thread hands to
+// workers[i], one at a time.
+static void
+worker(int i)
+{
+	struct Worker *w = &workers[i];
+	union Fsipc *ipc = worker_req(w);
+	uintptr_t reply[FSBULK_MAXPAGES];
+	int perm, r, nreply;
+	void *pg;
+
+	while (1) {
+		while (!w->w_busy)
+			thread_yield();
+		if (w->w_o)
+			lock_wait(&w->w_o->o_lock, w->w_oticket, 0);
+		lock_wait(&fs_lock, w->w_ticket, w->w_shared);
+		bc_set_readahead(w->w_o ? &w->w_o->o_ra : NULL);
+
+		pg = NULL;
+		nreply = 0;
+		if (w->w_req == FSREQ_OPEN) {
+			r = serve_open(w->w_whom, &ipc->open, &pg, &perm);
+			if (pg)
+				reply[nreply++] = (uintptr_t) pg | perm;
+		} else if (w->w_req == FSREQ_MAP) {
+			r = serve_map(w->w_whom, &ipc->map, reply, &nreply);
+		} else if (w->w_req < ARRAY_SIZE(handlers) && handlers[w->w_req]) {
+			r = handlers[w->w_req](w->w_whom, ipc);
+		} else {
+			cprintf("Invalid request code %d from %08x\n",
+				w->w_req, w->w_whom);
+			r = -E_INVAL;
+		}
+
+		// Reply before letting go of the locks: a new Fd page looks
+		// free to openfile_alloc until the client has it.  Periodic
+		// write-back happens under fs_lock too, so that no request
+		// dirties a block while it is being written.
+		if (w->w_req != FSREQ_RING_KICK)
+			ipc_sendv(w->w_whom, r, reply, nreply);
+		bc_set_readahead(NULL);
+		fs_tick(!w->w_shared);
+		lock_release(&fs_lock, w->w_shared);
+		if (w->w_o)
+			lock_release(&w->w_o->o_lock, 0);
+		while (w->w_npins > 0)
+			bc_unpin(w->w_pins[--w->w_npins]);
+		for (i = 0; i < w->w_npages; i++)
+			sys_page_unmap(0, (char *) ipc + i * PGSIZE);
+		w->w_busy = false;
+	}
+}
+
+// Receive requests and hand them to free workers, in the order they
+// arrive.  Receives do not block while any worker has work to do, so
+// that the workers keep running; once they are all idle, wait for the
+// next request in the kernel, but no longer than until the periodic
+// write-back is due, so that dirty data does not sit in memory while
+// the server is idle.
 void
 serve(void)
 {
-	uint32_t req, whom;
-	int perm, r;
-	void *pg;
+	struct Worker *w;
+	int i, nbusy;
 
+	for (i = 0; i < FS_NTHREADS; i++)
+		thread_create(worker, i);
+
+	w = NULL;
 	while (1) {
-		perm = 0;
-		req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+		for (i = nbusy = 0; i < FS_NTHREADS; i++)
+			if (workers[i].w_busy)
+				nbusy++;
+			else if (!w) {
+				w = &workers[i];
+				sys_ipc_recvv(worker_req(w), 1 + FSBULK_MAXPAGES,
+					      IPC_NOWAIT);
+			}
+
+		if (!w || thisenv->env_ipc_recving) {
+			if (nbusy > 0)
+				thread_yield();
+			else if (sys_ipc_recv_until(worker_req(w), 1 + FSBULK_MAXPAGES,
+						    fs_tick_due()) == -E_TIMEOUT) {
+				// Idle past the write-back deadline: do it
+				// now, then go back to receiving.
+				lock_acquire(&fs_lock, false);
+				fs_tick(true);
+				lock_release(&fs_lock, false);
+				sys_ipc_recvv(worker_req(w), 1 + FSBULK_MAXPAGES,
+					      IPC_NOWAIT);
+			}
+			continue;
+		}
+
+		w->w_whom = thisenv->env_ipc_from;
+		w->w_req = thisenv->env_ipc_value;
+		w->w_perm = thisenv->env_ipc_perm;
+		w->w_npages = thisenv->env_ipc_npages;
 		if (debug)
 			cprintf("fs req %d from %08x [page %08x: %s]\n",
-				req, whom, uvpt[PGNUM(fsreq)], fsreq);
+				w->w_req, w->w_whom, uvpt[PGNUM(worker_req(w))],
+				worker_req(w));
 
 		// All requests must contain an argument page
-		if (!(perm & PTE_P)) {
+		if (!(w->w_perm & PTE_P)) {
 			cprintf("Invalid request from %08x: no argument page\n",
-				whom);
+				w->w_whom);
+			sys_ipc_recvv(worker_req(w), 1 + FSBULK_MAXPAGES,
+				      IPC_NOWAIT);
 			continue; // just leave it hanging...
 		}
 
-		pg = NULL;
-		if (req == FSREQ_OPEN) {
-			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
-		} else if (req < ARRAY_SIZE(handlers) && handlers[req]) {
-			r = handlers[req](whom, fsreq);
-		} else {
-			cprintf("Invalid request code %d from %08x\n", req, whom);
-			r = -E_INVAL;
-		}
-		ipc_send(whom, r, pg, perm);
-		sys_page_unmap(0, fsreq);
+		w->w_o = req_openfile(w->w_req, worker_req(w));
+		if (w->w_o)
+			w->w_oticket = lock_ticket(&w->w_o->o_lock);
+		w->w_shared = req_is_shared(w->w_req, worker_req(w));
+		w->w_ticket = lock_ticket(&fs_lock);
+		w->w_busy = true;
+		w = NULL;
 	}
 }
 
@@ -10,7 +10,7 @@ fs_test(void)
 {
 	struct File *f;
 	int r;
-	char *blk;
+	char *blk, buf[64];
 	uint32_t *bits;
 	uint32_t bno;
 
@@ -61,7 +61,18 @@ fs_test(void)
 		panic("file_get_block 2: %e", r);
 	strcpy(blk, msg);
 	assert((uvpt[PGNUM(blk)] & PTE_D));
+	// The block is delayed: no disk block yet, but readable
+	assert(f->f_direct[0] == 0);
+	memset(buf, 0, sizeof(buf));
+	if ((r = file_read(f, buf, sizeof(buf), 0)) != strlen(msg))
+		panic("file_read of delayed block: %e", r);
+	if (strcmp(buf, msg) != 0)
+		panic("file_read of delayed block returned wrong data");
 	file_flush(f);
+	assert(f->f_direct[0] != 0);
+	blk = diskaddr(f->f_direct[0]);
+	if (strcmp(blk, msg) != 0)
+		panic("file_flush committed wrong data");
 	assert(!(uvpt[PGNUM(blk)] & PTE_D));
 	assert(!(uvpt[PGNUM(f)] & PTE_D));
 	cprintf("file rewrite is good\n");
@@ -0,0 +1,129 @@
+#include "fs.h"
+
+// Cooperative threads for the file server.
+//
+// Thread 0 is the environment's original thread; thread_create adds up
+// to FS_NTHREADS more, each on a stack of its own.  Threads switch only
+// in thread_yield, which hands the CPU to the next thread round-robin.
+// There is no blocking: a thread that waits for something, like a lock
+// or the disk, yields until it is there.
+
+struct Thread {
+	uint32_t t_esp;			// saved stack pointer
+	void (*t_fn)(int);
+	int t_arg;
+};
+
+static struct Thread threads[1 + FS_NTHREADS];
+static int nthreads = 1;
+static int curthread;
+
+static uint8_t thread_stacks[FS_NTHREADS][FS_STACKSIZE]
+	__attribute__((aligned(PGSIZE)));
+
+void thread_switch(uint32_t *save_esp, uint32_t esp);
+
+static void
+thread_start(void)
+{
+	struct Thread *t = &threads[curthread];
+
+	t->t_fn(t->t_arg);
+	panic("thread %d returned", curthread);
+}
+
+// Start a thread running fn(arg).  It first runs when another thread
+// yields.
+void
+thread_create(void (*fn)(int), int arg)
+{
+	struct Thread *t;
+	uint32_t *sp;
+
+	if (nthreads == ARRAY_SIZE(threads))
+		panic("thread_create: too many threads");
+	t = &threads[nthreads];
+	t->t_fn = fn;
+	t->t_arg = arg;
+
+	// Lay out the frame thread_switch expects to pop: four callee-saved
+	// registers, then the address to return to.
+	sp = (uint32_t *) (thread_stacks[nthreads - 1] + FS_STACKSIZE);
+	*--sp = 0;			// return address for thread_start
+	*--sp = (uint32_t) thread_start;
+	sp -= 4;
+	memset(sp, 0, 4 * sizeof(uint32_t));
+	t->t_esp = (uint32_t) sp;
+	nthreads++;
+}
+
+// Let the next thread run.  Returns once every other thread has had
+// a turn.
+void
+thread_yield(void)
+{
+	int prev = curthread;
+
+	if (nthreads == 1)
+		return;
+	curthread = (curthread + 1) % nthreads;
+	thread_switch(&threads[prev].t_esp, threads[curthread].t_esp);
+}
+
+// Return the number of the running thread, 0 through FS_NTHREADS.
+int
+thread_current(void)
+{
+	return curthread;
+}
+
+// Locks.
+//
+// A lock hands out tickets and lets threads in strictly in ticket
+// order, so waiters are served first come, first served.  Shared
+// holders let the next ticket in right away, as long as it is shared
+// too; an exclusive holder waits until all shared holders are gone.
+// Taking a ticket and waiting for it are separate steps, so that one
+// thread can queue up work in order for others to do.
+
+uint32_t
+lock_ticket(struct Lock *l)
+{
+	return l->l_next++;
+}
+
+// Wait until 'ticket' is let in, then hold l.
+void
+lock_wait(struct Lock *l, uint32_t ticket, bool shared)
+{
+	while (l->l_serving != ticket)
+		thread_yield();
+	if (shared) {
+		l->l_readers++;
+		l->l_serving++;
+	} else
+		while (l->l_readers > 0)
+			thread_yield();
+}
+
+void
+lock_acquire(struct Lock *l, bool shared)
+{
+	lock_wait(l, lock_ticket(l), shared);
+}
+
+void
+lock_release(struct Lock *l, bool shared)
+{
+	if (shared)
+		l->l_readers--;
+	else
+		l->l_serving++;
+}
+
+// Is anyone holding or waiting for l?
+bool
+lock_busy(struct Lock *l)
+{
+	return l->l_next != l->l_serving || l->l_readers > 0;
+}
@@ -29,6 +29,12 @@ typedef int32_t envid_t;
 #define NENV			(1 << LOG2NENV)
 #define ENVX(envid)		((envid) & (NENV - 1))
 
+// Most pages a single IPC can carry (see sys_ipc_try_sendv)
+#define IPC_MAXPAGES		128
+
+// sys_ipc_recvv flags
+#define IPC_NOWAIT		0x1	// start receiving, but don't block
+
 // Values of env_status in struct Env
 enum {
 	ENV_FREE = 0,
@@ -67,6 +73,12 @@ struct Env {
 	uint32_t env_ipc_value;		// Data value sent to us
 	envid_t env_ipc_from;		// envid of the sender
 	int env_ipc_perm;		// Perm of page mapping received
+	int env_ipc_npages;		// Pages wanted at dstva; then received
+	bool env_ipc_nowait;		// Receiving without blocking
+	unsigned env_ipc_deadline;	// time_msec() to give up at, or 0
+
+	// Lab 6 network
+	uint32_t env_net_wait;		// NET_WAIT_* events env is blocked on
 };
 
 #endif // !JOS_INC_ENV_H
@@ -25,6 +25,8 @@ enum {
 	E_FILE_EXISTS	,	// File already exists
 	E_NOT_EXEC	,	// File not a valid executable
 	E_NOT_SUPP	,	// Operation not supported
+	E_NOT_EMPTY	,	// Directory not empty
+	E_TIMEOUT	,	// Deadline passed before the operation completed
 
 	MAXERROR
 };
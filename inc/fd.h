@@ -21,10 +21,17 @@ struct Dev {
 	int (*dev_close)(struct Fd *fd);
 	int (*dev_stat)(struct Fd *fd, struct Stat *stat);
 	int (*dev_trunc)(struct Fd *fd, off_t length);
+	int (*dev_sync)(struct Fd *fd);
 };
 
 struct FdFile {
 	int id;
+	// Client-side buffer, kept in the page at fd2data(fd) (see
+	// lib/file.c).  The server leaves these alone.
+	bool buffered;		// buffer page allocated
+	off_t buf_base;		// file offset of the buffer's first byte
+	size_t buf_rlen;	// bytes of file data held for reading
+	size_t buf_wlen;	// bytes waiting to be written
 };
 
 struct FdSock {
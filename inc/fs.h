@@ -23,8 +23,13 @@
 #define NDIRECT		10
 // Number of direct block pointers in an indirect block
 #define NINDIRECT	(BLKSIZE / 4)
+// Number of direct block pointers reachable through a doubly-indirect block
+#define NDINDIRECT	(NINDIRECT * NINDIRECT)
 
-#define MAXFILESIZE	((NDIRECT + NINDIRECT) * BLKSIZE)
+// Number of blocks a File can address
+#define MAXFILEBLOCKS	(NDIRECT + NINDIRECT + NDINDIRECT)
+// That is more than a 32-bit off_t can describe, so off_t sets the limit
+#define MAXFILESIZE	0x7FFFF000
 
 struct File {
 	char f_name[MAXNAMELEN];	// filename
@@ -35,10 +40,17 @@ struct File {
 	// A block is allocated iff its value is != 0.
 	uint32_t f_direct[NDIRECT];	// direct blocks
 	uint32_t f_indirect;		// indirect block
+	uint32_t f_dindirect;		// doubly-indirect block
+
+	// Directory hash index (see fs/fs.c).  Entry numbers are stored
+	// plus one, so that zero means none.
+	uint32_t f_hindex;		// directories: block of bucket heads
+	uint32_t f_hfree;		// directories: first free entry
+	uint32_t f_hnext;		// next entry in our bucket or free list
 
 	// Pad out to 256 bytes; must do arithmetic in case we're compiling
 	// fsformat on a 64-bit machine.
-	uint8_t f_pad[256 - MAXNAMELEN - 8 - 4*NDIRECT - 4];
+	uint8_t f_pad[256 - MAXNAMELEN - 8 - 4*NDIRECT - 4 - 4 - 12];
 } __attribute__((packed));	// required only on some 64-bit machines
 
 // An inode block contains exactly BLKFILES 'struct File's
@@ -48,6 +60,21 @@ struct File {
 #define FTYPE_REG	0	// Regular file
 #define FTYPE_DIR	1	// Directory
 
+// Number of buckets in a directory hash index; the bucket heads fill
+// exactly one block
+#define DIR_NBUCKETS	(BLKSIZE / 4)
+
+// Bucket of a name in a directory hash index (FNV-1a)
+static inline uint32_t
+dir_hash(const char *name)
+{
+	uint32_t h = 2166136261U;
+
+	while (*name)
+		h = (h ^ (uint8_t) *name++) * 16777619U;
+	return h % DIR_NBUCKETS;
+}
+
 
 // File system super-block (both in-memory and on-disk)
 
@@ -70,7 +97,87 @@ enum {
 	FSREQ_STAT,
 	FSREQ_FLUSH,
 	FSREQ_REMOVE,
-	FSREQ_SYNC
+	FSREQ_SYNC,
+	// Bulk read and write move data through the client's own buffer
+	// pages, which are sent along behind the request page
+	FSREQ_READ_BULK,
+	FSREQ_WRITE_BULK,
+	// Map replies with the file's block cache pages themselves
+	FSREQ_MAP,
+	// Ring setup shares an Fsring and its data pages, sent behind the
+	// request page, with the server.  Kick has the server work through
+	// the sender's ring, and gets no reply.
+	FSREQ_RING_SETUP,
+	FSREQ_RING_KICK,
+	// Readdir returns packed Fsdirents in a Fsret_read on the request page
+	FSREQ_READDIR,
+	// Slurp opens, stats and reads a file in one go, without an open
+	// file ID.  It returns a Fsret_slurp on the request page, and puts
+	// the data there too unless buffer pages come behind the request.
+	FSREQ_SLURP,
+	// Defrag rewrites a file's blocks contiguously, and returns a
+	// Fsret_defrag on the request page
+	FSREQ_DEFRAG,
+	// Bcstats returns the block cache's BcStats on the request page
+	FSREQ_BCSTATS
+};
+
+// Block cache statistics, counted since the file server started
+struct BcStats {
+	uint32_t bs_hits;		// file blocks looked up while resident
+	uint32_t bs_misses;		// blocks faulted in from disk
+	uint32_t bs_evictions;		// blocks dropped to honor the budget
+	uint32_t bs_readahead;		// extra blocks read alongside a miss
+	uint32_t bs_writebacks;		// dirty blocks written back in batches
+	uint32_t bs_writes;		// IDE write commands those took
+};
+
+// Most buffer pages a bulk read or write request can carry
+#define FSBULK_MAXPAGES	64
+
+// A directory entry as FSREQ_READDIR returns it.  Entries are packed
+// one after another, each d_reclen bytes long.  With FSREADDIR_RECURSIVE
+// the whole subtree is listed, each directory's entries right after it,
+// and d_name is the path relative to the directory being read.
+struct Fsdirent {
+	off_t d_size;
+	uint8_t d_type;		// FTYPE_REG or FTYPE_DIR
+	uint8_t d_depth;	// levels below the directory being read
+	uint16_t d_reclen;	// bytes from this entry to the next
+	char d_name[];		// null-terminated
+};
+
+#define FSREADDIR_RECURSIVE	0x1
+
+// Asynchronous request rings.  A client posts read, write and stat
+// requests on its ring's submission queue, each with a data page of its
+// own, and the server posts their results on the completion queue in
+// the order it finishes them.  Requests use explicit offsets and leave
+// the seek position alone.  The client kicks the server only when it
+// posts to an empty submission queue.
+#define FSRING_NSLOTS	16
+#define FSRING_NPAGES	(1 + FSRING_NSLOTS)	// ring page, then data pages
+
+struct Fsring_sqe {
+	uint32_t sqe_type;	// FSREQ_READ, FSREQ_WRITE or FSREQ_STAT
+	int sqe_fileid;
+	off_t sqe_offset;
+	size_t sqe_n;		// at most PGSIZE
+	uint32_t sqe_slot;	// data page; stat fills in a Fsret_stat
+};
+
+struct Fsring_cqe {
+	uint32_t cqe_slot;
+	int cqe_result;
+};
+
+struct Fsring {
+	volatile uint32_t r_sqhead;	// next submission for the server
+	volatile uint32_t r_sqtail;	// next submission the client posts
+	volatile uint32_t r_cqhead;	// next completion for the client
+	volatile uint32_t r_cqtail;	// next completion the server posts
+	struct Fsring_sqe r_sq[FSRING_NSLOTS];
+	struct Fsring_cqe r_cq[FSRING_NSLOTS];
 };
 
 union Fsipc {
@@ -108,6 +215,39 @@ union Fsipc {
 	struct Fsreq_remove {
 		char req_path[MAXPATHLEN];
 	} remove;
+	struct Fsreq_bulk {
+		int req_fileid;
+		size_t req_n;
+		size_t req_off;	// offset of the data in the first buffer page
+	} bulk;
+	struct Fsreq_map {
+		int req_fileid;
+		off_t req_offset;	// page-aligned
+		int req_npages;
+	} map;
+	struct Fsreq_readdir {
+		int req_fileid;
+		size_t req_n;		// most bytes of entries to return
+		int req_flags;
+	} readdir;
+	struct Fsreq_slurp {
+		char req_path[MAXPATHLEN];
+		size_t req_n;
+		size_t req_off;	// offset of the data in the first buffer page
+	} slurp;
+	struct Fsret_slurp {
+		off_t ret_size;
+		int ret_isdir;
+		char ret_buf[PGSIZE - sizeof(off_t) - sizeof(int)];
+	} slurpRet;
+	struct Fsreq_defrag {
+		char req_path[MAXPATHLEN];
+	} defrag;
+	struct Fsret_defrag {
+		uint32_t ret_before;	// extents the file had
+		uint32_t ret_after;	// extents it has now
+	} defragRet;
+	struct BcStats bcstatsRet;
 
 	// Ensure Fsipc is one page
 	char _pad[PGSIZE];
@@ -58,10 +58,20 @@ int	sys_page_map(envid_t src_env, void *src_pg,
 		     envid_t dst_env, void *dst_pg, int perm);
 int	sys_page_unmap(envid_t env, void *pg);
 int	sys_ipc_try_send(envid_t to_env, uint32_t value, void *pg, int perm);
+int	sys_ipc_try_sendv(envid_t to_env, uint32_t value, const uintptr_t *pages, int npages);
 int	sys_ipc_recv(void *rcv_pg);
+int	sys_ipc_recvv(void *rcv_pg, int npages, int flags);
+int	sys_ipc_recv_until(void *rcv_pg, int npages, unsigned int deadline);
 unsigned int sys_time_msec(void);
 size_t	sys_net_try_send(void *packet, size_t length);
 size_t	sys_net_try_recv(uint8_t *buffer);
+int	sys_net_recv_pages(void *dstva, int npages);
+int	sys_net_send_sg(const struct net_sg *sg, int nsg,
+			const struct net_offload *off, struct net_txinfo *info);
+int	sys_net_send_batch(const struct net_sg *pkts, int n);
+int	sys_net_wait(uint32_t events);
+int	sys_net_map(void *va);
+int	sys_net_sync(uint32_t rings);
 
 // This must be inlined.  Exercise for reader: why?
 // Parent can copy memory of the stack to its child only after sys_exofork()
@@ -81,18 +91,22 @@ sys_exofork(void)
 // ipc.c
 void	ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
+void	ipc_sendv(envid_t to_env, uint32_t value, const uintptr_t *pages, int npages);
+int32_t ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store);
 envid_t	ipc_find_env(enum EnvType type);
 
 // fork.c
 #define	PTE_SHARE	0x400
 envid_t	fork(void);
 envid_t	sfork(void);	// Challenge!
+int	cowpage(void *va);
 
 // fd.c
 int	close(int fd);
 ssize_t	read(int fd, void *buf, size_t nbytes);
 ssize_t	write(int fd, const void *buf, size_t nbytes);
 int	seek(int fd, off_t offset);
+int	fsync(int fd);
 void	close_all(void);
 ssize_t	readn(int fd, void *buf, size_t nbytes);
 int	dup(int oldfd, int newfd);
@@ -104,6 +118,16 @@ int	open(const char *path, int mode);
 int	ftruncate(int fd, off_t size);
 int	remove(const char *path);
 int	sync(void);
+int	defrag(const char *path, uint32_t *before, uint32_t *after);
+int	fs_bcstats(struct BcStats *st);
+int	mmap(void *addr, size_t len, int prot, int flags, int fd, off_t offset);
+int	munmap(void *addr, size_t len);
+int	readdir(int fd, void *buf, size_t n, int flags);
+ssize_t	file_slurp(const char *path, void *buf, size_t n, struct Stat *st);
+int	fsring_read(int fd, void *buf, size_t n, off_t offset, uint32_t tag);
+int	fsring_write(int fd, const void *buf, size_t n, off_t offset, uint32_t tag);
+int	fsring_stat(int fd, struct Stat *st, uint32_t tag);
+int	fsring_reap(uint32_t *tag_store, int *result_store, bool wait);
 
 // pageref.c
 int	pageref(void *addr);
@@ -154,5 +178,12 @@ void	wait(envid_t env);
 #define	O_TRUNC		0x0200		/* truncate to zero length */
 #define	O_EXCL		0x0400		/* error if already exists */
 #define O_MKDIR		0x0800		/* create directory, not regular file */
+#define O_NOBUF		0x1000		/* no client-side buffering */
+
+/* mmap protections and flags */
+#define	PROT_READ	0x1		/* pages may be read */
+#define	PROT_WRITE	0x2		/* pages may be written */
+#define	MAP_SHARED	0x1		/* share the file's pages */
+#define	MAP_PRIVATE	0x2		/* writes go to private copies */
 
 #endif	// !JOS_INC_LIB_H
@@ -9,9 +9,18 @@
 
 struct jif_pkt {
 	int jp_len;
+	int jp_csum;	// received: the NET_CSUM_* checksums the NIC found good
 	char jp_data[0];
 };
 
+// Pages a jif_pkt with 'len' bytes of data takes.  A packet too long
+// for one page, like a jumbo frame, goes on in the pages after it.
+#define JIF_PKT_NPAGES(len) \
+	((sizeof(struct jif_pkt) + (len) + PGSIZE - 1) / PGSIZE)
+
+// Most packet pages one NSREQ_INPUT or NSREQ_OUTPUT carries
+#define NSPKT_MAXPAGES	16
+
 // Definitions for requests from clients to network server
 enum {
 	// The following messages pass a page containing an Nsipc.
@@ -27,7 +36,8 @@ enum {
 	NSREQ_SEND,
 	NSREQ_SOCKET,
 
-	// The following two messages pass a page containing a struct jif_pkt
+	// The following two messages pass up to NSPKT_MAXPAGES pages of
+	// packets, each a struct jif_pkt starting a page
 	NSREQ_INPUT,
 	// NSREQ_OUTPUT, unlike all other messages, is sent *from* the
 	// network server, to the output environment
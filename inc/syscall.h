@@ -1,6 +1,8 @@
 #ifndef JOS_INC_SYSCALL_H
 #define JOS_INC_SYSCALL_H
 
+#include <inc/types.h>
+
 /* system call numbers */
 enum {
 	SYS_cputs = 0,
@@ -20,7 +22,112 @@ enum {
 	SYS_time_msec,
 	SYS_net_try_send,
 	SYS_net_try_recv,
+	SYS_net_wait,
+	SYS_net_recv_pages,
+	SYS_net_send_sg,
+	SYS_net_send_batch,
+	SYS_net_map,
+	SYS_net_sync,
+	SYS_ipc_try_sendv,
 	NSYSCALLS
 };
 
+/* events for SYS_net_wait */
+#define NET_WAIT_RX	0x1	/* a received packet is ready */
+#define NET_WAIT_TX	0x2	/* the transmit ring has room */
+
+/* A piece of a packet for SYS_net_send_sg, anywhere in the sender's
+ * memory */
+struct net_sg {
+	const void *sg_va;
+	size_t sg_len;
+};
+
+/* Most pieces in one packet */
+#define NET_SG_MAX	64
+
+/* Most pages SYS_net_recv_pages and packets SYS_net_send_batch take at
+ * once; SYS_net_send_batch gives each packet as one net_sg */
+#define NET_BATCH_MAX	32
+
+/* Largest MTU the network stack can be built with, and the largest
+ * frame the packet calls send or receive: that MTU plus the ethernet
+ * header and a VLAN tag */
+#define NET_MTU_MAX	9000
+#define NET_FRAME_MAX	(NET_MTU_MAX + 18)
+
+/* What SYS_net_send_sg reports about the transmit ring: the sequence
+ * number of the packet just queued, and how many packets the NIC is
+ * done with.  A packet's memory is in use until ti_done counts past
+ * its ti_seq. */
+struct net_txinfo {
+	uint32_t ti_seq;
+	uint32_t ti_done;
+};
+
+/* Checksums: on a packet to send, the ones for the NIC to fill in; on a
+ * received packet, the ones it found good */
+#define NET_CSUM_IP	0x1	/* IPv4 header checksum */
+#define NET_CSUM_L4	0x2	/* TCP or UDP checksum */
+/* Have the NIC split a large TCP segment into ones of no_mss bytes each,
+ * with both checksums filled in */
+#define NET_TSO		0x4
+
+/* Largest packet SYS_net_send_sg takes with NET_TSO */
+#define NET_TSO_MAX	65536
+
+/* Where the checksums SYS_net_send_sg has the NIC fill in go, as byte
+ * offsets from the start of the packet.  The TCP or UDP checksum covers
+ * everything from no_l4hdr on; the sender seeds its field with the sum
+ * of the pseudo-header, which the NIC does not add.  With NET_TSO, the
+ * seed leaves out the TCP length, which differs for each segment, and
+ * the first no_hdrlen bytes are copied to the front of each segment. */
+struct net_offload {
+	uint8_t no_flags;	/* NET_CSUM_*, NET_TSO */
+	uint8_t no_iphdr;	/* IP header */
+	uint8_t no_l4hdr;	/* TCP or UDP header */
+	uint8_t no_l4csum;	/* its checksum field */
+	uint8_t no_hdrlen;	/* NET_TSO: all headers */
+	uint16_t no_mss;	/* NET_TSO: TCP data in each segment */
+};
+
+/* Direct ring access.  SYS_net_map hands the NIC's rings to the caller
+ * and maps NETMAP_SIZE bytes of its memory to them: a struct
+ * netmap_rings, then from NETMAP_BUFS on, NETMAP_NBUFS packet buffers.
+ * Slot i of each ring stands for the NIC's descriptor i, and ns_buf
+ * names the buffer it uses, which the caller may change.
+ *
+ * The slots from nr_head up to, not including, nr_tail belong to the
+ * caller: on the transmit ring, slots to fill with packets to send; on
+ * the receive ring, slots holding received packets.  The caller moves
+ * nr_head past the slots it has filled, or is done with, then calls
+ * SYS_net_sync, which sends or recycles them and moves nr_tail past the
+ * slots the NIC has finished with.  Meanwhile the kernel's own packet
+ * calls find the rings full and empty.  The rings go back to the kernel
+ * when the caller exits. */
+#define NETMAP_TX_SLOTS	256
+#define NETMAP_RX_SLOTS	128
+#define NETMAP_NBUFS	512
+#define NETMAP_BUFSIZE	2048
+#define NETMAP_BUFS	4096
+#define NETMAP_SIZE	(NETMAP_BUFS + NETMAP_NBUFS * NETMAP_BUFSIZE)
+
+struct netmap_slot {
+	uint16_t ns_buf;	/* buffer number */
+	uint16_t ns_len;	/* packet length */
+	uint32_t ns_flags;	/* received: NET_CSUM_* the NIC found good */
+};
+
+struct netmap_ring {
+	uint32_t nr_head;	/* set by the caller */
+	uint32_t nr_tail;	/* set by SYS_net_sync */
+};
+
+struct netmap_rings {
+	struct netmap_ring nm_tx;
+	struct netmap_ring nm_rx;
+	struct netmap_slot nm_txslot[NETMAP_TX_SLOTS];
+	struct netmap_slot nm_rxslot[NETMAP_RX_SLOTS];
+};
+
 #endif /* !JOS_INC_SYSCALL_H */
@@ -1,10 +1,26 @@
 #include <kern/e1000.h>
+#include <kern/env.h>
 #include <kern/pmap.h>
 #include <kern/pci.h>
+#include <kern/syscall.h>
 #include <inc/string.h>
+#include <inc/error.h>
 
 static volatile uint32_t *e1000;
 
+struct e1000_tunables e1000_tunables = {
+	.poll = true,
+	.itr = 488,		/* about 8000 interrupts a second */
+	.rdtr = 32,
+	.radv = 64,
+};
+struct e1000_stats e1000_stats;
+
+#define E1000_ICR_RX	(E1000_ICR_RXT0 | E1000_ICR_RXO | E1000_ICR_RXDMT0)
+
+/* The interrupt causes unmasked in IMS.  */
+static uint32_t intr_armed;
+
 static inline uint32_t
 e1000r(uint32_t index)
 {
@@ -17,13 +33,58 @@ e1000w(uint32_t index, uint32_t value)
 	e1000[index >> 2] = value;
 }
 
-#define TX_QUEUE_SIZE		64
+/* Large enough for a whole TSO packet, page by page.  */
+#define TX_QUEUE_SIZE		256
 #define RX_QUEUE_SIZE		128
 _Static_assert(TX_QUEUE_SIZE % 8 == 0 && RX_QUEUE_SIZE % 8 == 0);
+_Static_assert(TX_QUEUE_SIZE > 2 * NET_SG_MAX + 1);
 static struct tx_desc tx_queue[TX_QUEUE_SIZE];
-static uint8_t tx_buffer[TX_QUEUE_SIZE][TX_BUFFER_SIZE];
+/* Buffers for copied packets, a few to a page allocated at attach time,
+ * to keep them out of the kernel image.  */
+#define TX_BUFFERS_PER_PAGE	(PGSIZE / TX_BUFFER_SIZE)
+static uint8_t *tx_buffer[TX_QUEUE_SIZE];
 static struct rx_desc rx_queue[RX_QUEUE_SIZE];
-static uint8_t rx_buffer[RX_QUEUE_SIZE][RX_BUFFER_SIZE];
+
+/* Transmit descriptors from tx_clean up to TDT are in flight.  Those
+ * sent from user pages hold a reference to the page in tx_pages until
+ * the NIC is done with them.  tx_seq counts packets queued, tx_done
+ * packets the NIC is done with.  */
+static struct PageInfo *tx_pages[TX_QUEUE_SIZE];
+static uint32_t tx_clean;
+static uint32_t tx_seq, tx_done;
+
+/* The checksum offsets the last context descriptor gave the NIC, which
+ * it keeps using until the next one.  */
+_Static_assert(sizeof(struct tx_ctx_desc) == sizeof(struct tx_desc)
+	       && sizeof(struct tx_data_desc) == sizeof(struct tx_desc));
+static struct net_offload tx_ctx;
+static bool tx_ctx_valid;
+
+#define TCTL_ON		(E1000_TCTL_EN | E1000_TCTL_PSP | COL_FULL_DUPLEX)
+/* Frames longer than a receive buffer (LPE) take several descriptors,
+ * the last with EOP; a NET_FRAME_MAX frame takes five.  The netmap
+ * slots hold one buffer per packet, so there LPE stays off.  */
+#define RCTL_ON		(E1000_RCTL_EN | E1000_RCTL_SZ_2048 | E1000_RCTL_BAM | \
+			 E1000_RCTL_SECRC)
+#define RCTL_ON_LPE	(RCTL_ON | E1000_RCTL_LPE)
+_Static_assert(RX_BUFFER_SIZE == 2048 && RX_PKT_OFFSET + 2048 <= PGSIZE);
+
+/* While nm_env has the rings (net_map), it fills the descriptors
+ * through the slots in nm_rings, with buffers in the pages nm_pages[1]
+ * on.  Descriptors nm_rx_tail up to RDT are the receive ring's
+ * unreported ones.  */
+_Static_assert(NETMAP_TX_SLOTS == TX_QUEUE_SIZE
+	       && NETMAP_RX_SLOTS == RX_QUEUE_SIZE);
+_Static_assert(sizeof(struct netmap_rings) <= NETMAP_BUFS
+	       && NETMAP_BUFS == PGSIZE && NETMAP_BUFSIZE <= PGSIZE);
+#define NETMAP_BUFS_PER_PAGE	(PGSIZE / NETMAP_BUFSIZE)
+static struct PageInfo *nm_pages[NETMAP_NPAGES];
+static struct netmap_rings *nm_rings;
+static struct Env *nm_env;
+static uint32_t nm_rx_tail;
+/* The receive buffers the kernel had before net_map, kept for
+ * net_unmap so that it never has to allocate.  */
+static physaddr_t nm_rx_saved[RX_QUEUE_SIZE];
 
 static void net_tx_initialize(void)
 {
@@ -34,30 +95,242 @@ static void net_tx_initialize(void)
 	e1000w(E1000_TDT, 0);
 	e1000w(E1000_TIPG, TIPG_IEEE_802_3);
 
-	/* Statically allocate buffers for transmit descriptors.  */
+	/* Allocate buffers for transmit descriptors.  */
 	for (size_t i = 0; i < TX_QUEUE_SIZE; i++) {
-		tx_queue[i].buffer_addr = PADDR(&tx_buffer[i]);
+		if (i % TX_BUFFERS_PER_PAGE == 0) {
+			struct PageInfo *pp = page_alloc(0);
+
+			if (!pp)
+				panic("net_tx_initialize: out of memory");
+			pp->pp_ref++;
+			tx_buffer[i] = page2kva(pp);
+		} else
+			tx_buffer[i] = tx_buffer[i - 1] + TX_BUFFER_SIZE;
+		tx_queue[i].buffer_addr = PADDR(tx_buffer[i]);
 		tx_queue[i].status = E1000_TXD_STAT_DD;
 	}
-	e1000w(E1000_TCTL, E1000_TCTL_EN | E1000_TCTL_PSP | COL_FULL_DUPLEX);
+	e1000w(E1000_TCTL, TCTL_ON);
+}
+
+/* Does the descriptor end a packet?  Context descriptors never do; they
+ * have TUCMD bits where the others have EOP.  */
+static bool tx_desc_eop(const struct tx_desc *tdesc)
+{
+	const struct tx_data_desc *ddesc = (const struct tx_data_desc *) tdesc;
+
+	if ((ddesc->cmd & E1000_TXD_CMD_DEXT)
+	    && (ddesc->dtyp & 0xF0) == (E1000_TXD_DTYP_C >> 16))
+		return false;
+	return ddesc->cmd & E1000_TXD_CMD_EOP;
+}
+
+/* Walk the in-flight descriptors the NIC has finished with, dropping
+ * the page references they hold.  */
+static void net_tx_reclaim(void)
+{
+	uint32_t tdt = e1000r(E1000_TDT);
+	struct tx_desc *tdesc;
+
+	while (tx_clean != tdt) {
+		tdesc = &tx_queue[tx_clean];
+		if (!(tdesc->status & E1000_TXD_STAT_DD))
+			break;
+		if (tx_pages[tx_clean]) {
+			page_decref(tx_pages[tx_clean]);
+			tx_pages[tx_clean] = NULL;
+		}
+		if (tx_desc_eop(tdesc))
+			tx_done++;
+		tx_clean = (tx_clean + 1) % TX_QUEUE_SIZE;
+	}
+}
+
+/* Number of descriptors free to queue packets on.  One always stays
+ * unused, since TDT == TDH means the ring is empty.  */
+static uint32_t net_tx_free(void)
+{
+	uint32_t tdt = e1000r(E1000_TDT);
+
+	return TX_QUEUE_SIZE - 1 - (tdt + TX_QUEUE_SIZE - tx_clean) % TX_QUEUE_SIZE;
+}
+
+/* Copy the 'length'-byte packet into the buffers of the descriptors
+ * from tdt on, TX_BUFFER_SIZE bytes to each, TX_BUFFERS(length) of
+ * them.  Returns where the next descriptor goes.  */
+static uint32_t net_tx_copy(uint32_t tdt, const uint8_t *packet,
+			    size_t length)
+{
+	struct tx_desc *tdesc;
+	size_t n;
+
+	do {
+		n = MIN(length, TX_BUFFER_SIZE);
+		tdesc = &tx_queue[tdt];
+		tdesc->buffer_addr = PADDR(tx_buffer[tdt]);
+		memcpy(tx_buffer[tdt], packet, n);
+		tdesc->length = n;
+		tdesc->cmd = E1000_TXD_CMD_RS;
+		if (n == length)
+			tdesc->cmd |= E1000_TXD_CMD_EOP;
+		tdesc->status = 0;
+		packet += n;
+		length -= n;
+		tdt = (tdt + 1) % TX_QUEUE_SIZE;
+	} while (length > 0);
+	tx_seq++;
+	return tdt;
+}
+
+static size_t e1000_tx(const void *packet, size_t length)
+{
+	length = MIN(length, NET_FRAME_MAX);
+	net_tx_reclaim();
+	if (net_tx_free() < TX_BUFFERS(length))
+		return 0;
+	e1000w(E1000_TDT, net_tx_copy(e1000r(E1000_TDT), packet, length));
+	return length;
+}
+
+/* Copy up to 'n' packets from pkts[] into the transmit ring, as many as
+ * there is room for, and write TDT once for all of them.  Each packet
+ * must fit in NET_FRAME_MAX.  Returns the number of packets queued.  */
+static int e1000_tx_batch(const struct net_sg *pkts, int n)
+{
+	uint32_t tdt = e1000r(E1000_TDT);
+	uint32_t free;
+	int i;
+
+	net_tx_reclaim();
+	free = net_tx_free();
+	for (i = 0; i < n && TX_BUFFERS(pkts[i].sg_len) <= free; i++) {
+		free -= TX_BUFFERS(pkts[i].sg_len);
+		tdt = net_tx_copy(tdt, pkts[i].sg_va, pkts[i].sg_len);
+	}
+	if (i > 0)
+		e1000w(E1000_TDT, tdt);
+	return i;
+}
+
+/* Put a context descriptor at tdt giving the NIC the checksum offsets
+ * in off, unless the last one gave it the same, and for NET_TSO how to
+ * split the 'length'-byte packet that follows.  Returns where the next
+ * descriptor goes.  */
+static uint32_t net_tx_context(uint32_t tdt, const struct net_offload *off,
+			       size_t length)
+{
+	struct tx_ctx_desc *cdesc = (struct tx_ctx_desc *) &tx_queue[tdt];
+	bool tso = off->no_flags & NET_TSO;
+	uint32_t paylen;
+
+	if (!tso && tx_ctx_valid && tx_ctx.no_iphdr == off->no_iphdr
+	    && tx_ctx.no_l4hdr == off->no_l4hdr
+	    && tx_ctx.no_l4csum == off->no_l4csum)
+		return tdt;
+	memset(cdesc, 0, sizeof(*cdesc));
+	cdesc->ipcss = off->no_iphdr;
+	cdesc->ipcso = off->no_iphdr + 10;	/* IP header checksum */
+	cdesc->ipcse = off->no_l4hdr - 1;
+	cdesc->tucss = off->no_l4hdr;
+	cdesc->tucso = off->no_l4csum;
+	cdesc->tucse = 0;
+	cdesc->dtyp = E1000_TXD_DTYP_C >> 16;
+	cdesc->cmd = E1000_TXD_CMD_DEXT | E1000_TXD_CMD_RS;
+	if (tso) {
+		paylen = length - off->no_hdrlen;
+		cdesc->paylen = paylen & 0xFFFF;
+		cdesc->dtyp |= (paylen >> 16) & 0xF;
+		cdesc->hdr_len = off->no_hdrlen;
+		cdesc->mss = off->no_mss;
+		cdesc->cmd |= (E1000_TXD_CMD_TSE | E1000_TXD_CMD_IP
+			       | E1000_TXD_CMD_TCP) >> 24;
+	}
+	// A TSO context is good for one packet only.
+	tx_ctx = *off;
+	tx_ctx_valid = !tso;
+	return (tdt + 1) % TX_QUEUE_SIZE;
 }
 
-size_t net_packet_tx(const void *packet, size_t length)
+/* Queue one packet made of the 'n' pieces in frags, each within a page,
+ * with one descriptor per piece pointing at the page itself.  The pages
+ * are referenced until the NIC is done with them.  If off is not null,
+ * the NIC fills in the checksums it asks for, and with NET_TSO splits
+ * the packet into TCP segments.  Sets *seq to the
+ * packet's sequence number; the NIC is done with it once
+ * e1000_tx_done() has counted past it.
+ * Returns the packet length, or 0 if there are not enough free
+ * descriptors.  */
+static size_t e1000_tx_frags(const struct tx_frag *frags, int n,
+			     const struct net_offload *off, uint32_t *seq)
 {
 	uint32_t tdt = e1000r(E1000_TDT);
-	struct tx_desc *tdesc = &tx_queue[tdt];
-	size_t n_transmitted = MIN(length, TX_BUFFER_SIZE);
+	struct tx_data_desc *ddesc;
+	size_t length = 0;
+	uint8_t popts = 0, dcmd = 0;
 
-	if (!(tdesc->status & E1000_TXD_STAT_DD))
+	if (off && (off->no_flags & NET_CSUM_IP))
+		popts |= E1000_TXD_POPTS_IXSM;
+	if (off && (off->no_flags & NET_CSUM_L4))
+		popts |= E1000_TXD_POPTS_TXSM;
+
+	net_tx_reclaim();
+	// Leave room for a context descriptor.
+	if (n <= 0 || net_tx_free() < n + (popts != 0))
 		return 0;
-	memcpy(KADDR(tdesc->buffer_addr), packet, n_transmitted);
-	tdesc->length = n_transmitted;
-	tdesc->cmd = E1000_TXD_CMD_RS;
-	if (length == n_transmitted)
-		tdesc->cmd |= E1000_TXD_CMD_EOP;
-	tdesc->status = 0;
-	e1000w(E1000_TDT, ++tdt == TX_QUEUE_SIZE ? 0 : tdt);
-	return n_transmitted;
+	if (off && (off->no_flags & NET_TSO))
+		dcmd = E1000_TXD_CMD_TSE >> 24;
+	if (popts) {
+		for (int i = 0; i < n; i++)
+			length += frags[i].len;
+		tdt = net_tx_context(tdt, off, length);
+		length = 0;
+	}
+	for (int i = 0; i < n; i++) {
+		ddesc = (struct tx_data_desc *) &tx_queue[tdt];
+		ddesc->buffer_addr = page2pa(frags[i].pp) + frags[i].off;
+		ddesc->length = frags[i].len;
+		ddesc->cmd = E1000_TXD_CMD_RS;
+		if (i == n - 1)
+			ddesc->cmd |= E1000_TXD_CMD_EOP;
+		ddesc->dtyp = 0;
+		ddesc->popts = 0;
+		if (popts) {
+			ddesc->dtyp = E1000_TXD_DTYP_D >> 16;
+			ddesc->cmd |= E1000_TXD_CMD_DEXT | dcmd;
+			ddesc->popts = popts;
+		}
+		ddesc->status = 0;
+		frags[i].pp->pp_ref++;
+		tx_pages[tdt] = frags[i].pp;
+		length += frags[i].len;
+		tdt = (tdt + 1) % TX_QUEUE_SIZE;
+	}
+	*seq = tx_seq++;
+	e1000w(E1000_TDT, tdt);
+	return length;
+}
+
+/* Number of packets the NIC has finished sending, counted like the
+ * sequence numbers e1000_tx_frags hands out.  */
+static uint32_t e1000_tx_done(void)
+{
+	net_tx_reclaim();
+	return tx_done;
+}
+
+/* Each receive buffer is a page of its own, so that a received packet
+ * can be handed to user space by mapping the page.  Packets longer
+ * than one buffer get copied.  */
+static void net_rx_fill(void)
+{
+	for (size_t i = 0; i < RX_QUEUE_SIZE; i++) {
+		struct PageInfo *pp = page_alloc(0);
+
+		if (!pp)
+			panic("net_rx_fill: out of memory");
+		pp->pp_ref++;
+		rx_queue[i].buffer_addr = page2pa(pp) + RX_PKT_OFFSET;
+		rx_queue[i].status = 0;
+	}
 }
 
 static void net_rx_initialize(void)
@@ -71,38 +344,517 @@ static void net_rx_initialize(void)
 	e1000w(E1000_RAH0, 0x5634 | E1000_RAH_AV);
 	for (size_t i = 0; i < 128; i++)
 		e1000w(E1000_MTA + i * 4, 0);
-	e1000w(E1000_IMC, 0xFFFFFFFF);
+	net_rx_fill();
+	e1000w(E1000_RXCSUM, E1000_RXCSUM_IPOFL | E1000_RXCSUM_TUOFL);
+	e1000w(E1000_RCTL, RCTL_ON_LPE);
+}
 
-	/* Statically allocate buffers for receive descriptors.  */
-	for (size_t i = 0; i < RX_QUEUE_SIZE; i++) {
-		rx_queue[i].buffer_addr = PADDR(&rx_buffer[i]);
-		rx_queue[i].status = 0;
+/* Has a whole frame come in at the descriptors from 'first' on?  If so,
+ * set *ndesc to how many descriptors it takes and *length to its
+ * length.  The one at RDT is never done, which ends the walk.  */
+static bool net_rx_frame(uint32_t first, int *ndesc, size_t *length)
+{
+	struct rx_desc *rdesc;
+	uint32_t i = first;
+
+	*ndesc = 0;
+	*length = 0;
+	do {
+		rdesc = &rx_queue[i];
+		if (!(rdesc->status & E1000_RXD_STAT_DD))
+			return false;
+		*length += rdesc->length;
+		++*ndesc;
+		i = (i + 1) % RX_QUEUE_SIZE;
+	} while (!(rdesc->status & E1000_RXD_STAT_EOP));
+	return true;
+}
+
+/* Copy the first 'length' bytes of the frame in the descriptors from
+ * 'first' on into 'buffer', or if pps is not NULL, into the run of
+ * pages pps[] laid out as a struct jif_pkt, and give the descriptors
+ * back to the NIC.  Returns the new RDT.  */
+static uint32_t net_rx_copy(uint32_t first, size_t length,
+			    struct PageInfo **pps, uint8_t *buffer)
+{
+	struct rx_desc *rdesc;
+	uint32_t i;
+	size_t off = 0, n, done, at, chunk;
+	bool eop;
+
+	for (i = first;; i = (i + 1) % RX_QUEUE_SIZE) {
+		rdesc = &rx_queue[i];
+		n = MIN(rdesc->length, length - off);
+		if (!pps)
+			memcpy(buffer + off, KADDR(rdesc->buffer_addr), n);
+		else
+			for (done = 0; done < n; done += chunk) {
+				at = RX_PKT_OFFSET + off + done;
+				chunk = MIN(n - done, PGSIZE - at % PGSIZE);
+				memcpy((uint8_t *) page2kva(pps[at / PGSIZE])
+				       + at % PGSIZE,
+				       (uint8_t *) KADDR(rdesc->buffer_addr) + done,
+				       chunk);
+			}
+		off += n;
+		eop = rdesc->status & E1000_RXD_STAT_EOP;
+		rdesc->status = 0;
+		if (eop)
+			return i;
 	}
-	e1000w(E1000_RCTL, E1000_RCTL_EN | E1000_RCTL_SZ_2048 | E1000_RCTL_BAM |
-			   E1000_RCTL_SECRC);
 }
 
-size_t net_packet_rx(uint8_t *buffer)
+/* Frames longer than RX_BUFFER_SIZE are cut short.  */
+static size_t e1000_rx(uint8_t *buffer)
 {
-	uint32_t rdt = (e1000r(E1000_RDT) + 1) % RX_QUEUE_SIZE;
-	struct rx_desc *rdesc = &rx_queue[rdt];
+	uint32_t first = (e1000r(E1000_RDT) + 1) % RX_QUEUE_SIZE;
+	size_t length;
+	int ndesc;
 
-	if (!(rdesc->status & E1000_RXD_STAT_DD))
+	if (!net_rx_frame(first, &ndesc, &length))
 		return 0;
-	memcpy(buffer, KADDR(rdesc->buffer_addr), rdesc->length);
-	rdesc->status = 0;
+	length = MIN(length, RX_BUFFER_SIZE);
+	e1000w(E1000_RDT, net_rx_copy(first, length, NULL, buffer));
+	return length;
+}
+
+// Which checksums of the received packet in rdesc the NIC found good,
+// as NET_CSUM_* bits.
+static int net_rx_csum(const struct rx_desc *rdesc)
+{
+	int csum = 0;
+
+	if (rdesc->status & E1000_RXD_STAT_IXSM)
+		return 0;
+	if ((rdesc->status & E1000_RXD_STAT_IPCS)
+	    && !(rdesc->error & E1000_RXD_ERR_IPE))
+		csum |= NET_CSUM_IP;
+	if ((rdesc->status & (E1000_RXD_STAT_TCPCS | E1000_RXD_STAT_UDPCS))
+	    && !(rdesc->error & E1000_RXD_ERR_TCPE))
+		csum |= NET_CSUM_L4;
+	return csum;
+}
+
+// Take received packets off the ring, up to 'max' pages of them: store
+// the pages holding them in pps[], each with a reference of its own.  A
+// packet that fit in one receive buffer is handed out in that buffer's
+// page, and a fresh page posted in its place; a longer one is copied
+// into RX_PKT_PAGES(length) new pages, consecutive in pps[].  RDT is
+// written once for the whole batch.  Each packet's pages are laid out
+// as a struct jif_pkt, with the length and checksum flags filled in and
+// the rest of the last page zeroed.  A packet that would not fit in
+// 'max' pages on its own is dropped.  Returns the number of pages, or
+// -E_NO_MEM if there are packets but no pages for the first.
+static int e1000_rx_pages(struct PageInfo **pps, int max)
+{
+	uint32_t rdt0 = e1000r(E1000_RDT), rdt = rdt0, first;
+	struct rx_desc *rdesc;
+	struct PageInfo *fresh;
+	size_t length;
+	int n, i, ndesc, npages, npkts = 0, csum;
+
+	for (n = 0; n < max; n += npages) {
+		first = (rdt + 1) % RX_QUEUE_SIZE;
+		if (!net_rx_frame(first, &ndesc, &length))
+			break;
+		npages = RX_PKT_PAGES(length);
+		if (npages > max) {
+			rdt = net_rx_copy(first, 0, NULL, NULL);
+			npages = 0;
+			continue;
+		}
+		if (n + npages > max)
+			break;
+		for (i = 0; i < npages; i++) {
+			if (!(fresh = page_alloc(0)))
+				break;
+			fresh->pp_ref++;
+			pps[n + i] = fresh;
+		}
+		if (i < npages) {
+			while (i-- > 0)
+				page_decref(pps[n + i]);
+			if (n == 0 && rdt == rdt0)
+				return -E_NO_MEM;
+			break;
+		}
+
+		// The last descriptor has the checksum status.
+		csum = net_rx_csum(&rx_queue[(first + ndesc - 1) % RX_QUEUE_SIZE]);
+		if (ndesc == 1) {
+			rdesc = &rx_queue[first];
+			pps[n] = pa2page(rdesc->buffer_addr);
+			rdesc->buffer_addr = page2pa(fresh) + RX_PKT_OFFSET;
+			rdesc->status = 0;
+			rdt = first;
+		} else
+			rdt = net_rx_copy(first, length, pps + n, NULL);
+
+		net_rx_pkt_init(pps + n, length, csum);
+		npkts++;
+	}
+	if (rdt != rdt0)
+		e1000w(E1000_RDT, rdt);
+	if (npkts > 0) {
+		e1000_stats.rx_polls++;
+		e1000_stats.rx_packets += npkts;
+	}
+	return n;
+}
+
+/* Stop the NIC and rewind both rings to empty.  Transmit pages still
+ * in flight are let go, and their packets count as done, sent or
+ * not.  */
+static void net_rings_stop(void)
+{
+	e1000w(E1000_TCTL, 0);
+	e1000w(E1000_RCTL, 0);
+	for (size_t i = 0; i < TX_QUEUE_SIZE; i++) {
+		if (tx_pages[i]) {
+			page_decref(tx_pages[i]);
+			tx_pages[i] = NULL;
+		}
+		tx_queue[i].status = E1000_TXD_STAT_DD;
+	}
+	tx_clean = 0;
+	tx_done = tx_seq;
+	tx_ctx_valid = false;
+	e1000w(E1000_TDH, 0);
+	e1000w(E1000_TDT, 0);
+	e1000w(E1000_RDH, 0);
+	e1000w(E1000_RDT, RX_QUEUE_SIZE - 1);
+}
+
+static void net_rings_start(void)
+{
+	e1000w(E1000_TCTL, TCTL_ON);
+	e1000w(E1000_RCTL, nm_env ? RCTL_ON : RCTL_ON_LPE);
+}
+
+static physaddr_t netmap_buf(uint16_t buf)
+{
+	return page2pa(nm_pages[1 + buf / NETMAP_BUFS_PER_PAGE])
+		+ buf % NETMAP_BUFS_PER_PAGE * NETMAP_BUFSIZE;
+}
+
+// Hand the rings to the environment e: allocate the pages of the
+// struct netmap_rings and the buffers, and post the first
+// NETMAP_TX_SLOTS + NETMAP_RX_SLOTS buffers in the slots.  Packets in
+// the rings are dropped; the kernel's receive buffers are kept for
+// net_unmap.  The caller maps the pages, net_map_page(0)
+// on, into e.
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NOT_SUPP if there is no NIC.
+//	-E_INVAL if the rings are already handed out.
+//	-E_NO_MEM if there is no memory for the pages.
+int net_map(struct Env *e)
+{
+	struct netmap_slot *slot;
+	int i;
+
+	if (!e1000)
+		return -E_NOT_SUPP;
+	if (nm_env)
+		return -E_INVAL;
+	for (i = 0; i < NETMAP_NPAGES; i++) {
+		if (!(nm_pages[i] = page_alloc(ALLOC_ZERO))) {
+			while (--i >= 0)
+				page_decref(nm_pages[i]);
+			return -E_NO_MEM;
+		}
+		nm_pages[i]->pp_ref++;
+	}
+
+	net_rings_stop();
+	nm_env = e;
+	nm_rings = page2kva(nm_pages[0]);
+	nm_rings->nm_tx.nr_tail = NETMAP_TX_SLOTS - 1;
+	for (i = 0; i < NETMAP_TX_SLOTS; i++)
+		nm_rings->nm_txslot[i].ns_buf = i;
+	for (i = 0; i < NETMAP_RX_SLOTS; i++) {
+		slot = &nm_rings->nm_rxslot[i];
+		slot->ns_buf = NETMAP_TX_SLOTS + i;
+		nm_rx_saved[i] = rx_queue[i].buffer_addr;
+		rx_queue[i].buffer_addr = netmap_buf(slot->ns_buf);
+		rx_queue[i].status = 0;
+	}
+	nm_rx_tail = 0;
+	net_rings_start();
+	return 0;
+}
+
+struct PageInfo *net_map_page(int i)
+{
+	return nm_pages[i];
+}
+
+// Which environment has the rings, if any.
+struct Env *net_map_env(void)
+{
+	return nm_env;
+}
+
+// Unmask the interrupt causes in 'causes' that are masked.
+static void net_intr_arm(uint32_t causes)
+{
+	causes &= ~intr_armed;
+	if (causes) {
+		intr_armed |= causes;
+		e1000w(E1000_IMS, causes);
+	}
+}
+
+// If e has the rings, give them back to the kernel, dropping whatever
+// is in them.  Called when e is freed, so it must not fail: the receive
+// ring gets back the buffers net_map put aside.  Environments that blocked in
+// sys_net_wait while e had the rings are woken to try again, and the
+// interrupts polling may have masked are turned back on.
+void net_unmap(struct Env *e)
+{
+	if (!nm_env || nm_env != e)
+		return;
+	net_rings_stop();
+	for (int i = 0; i < RX_QUEUE_SIZE; i++) {
+		rx_queue[i].buffer_addr = nm_rx_saved[i];
+		rx_queue[i].status = 0;
+	}
+	for (int i = 0; i < NETMAP_NPAGES; i++)
+		page_decref(nm_pages[i]);
+	nm_env = NULL;
+	nm_rings = NULL;
+	net_rings_start();
+	net_intr_arm(E1000_ICR_RX | E1000_ICR_TXDW);
+	net_wake(NET_WAIT_RX | NET_WAIT_TX);
+}
+
+/* Slots from 'from' up to 'to' on a ring of n.  */
+static uint32_t ring_dist(uint32_t from, uint32_t to, uint32_t n)
+{
+	return (to + n - from) % n;
+}
+
+// Queue the transmit slots from TDT up to nr_head, then move nr_tail
+// past the ones the NIC is done with.  A slot with a bad buffer or
+// length stops the queueing there.
+static int netmap_txsync(void)
+{
+	struct netmap_ring *ring = &nm_rings->nm_tx;
+	uint32_t tdt = e1000r(E1000_TDT), head = ring->nr_head, tail;
+	struct netmap_slot slot;
+	struct tx_desc *tdesc;
+	int r = 0;
+
+	net_tx_reclaim();
+	tail = (tx_clean + TX_QUEUE_SIZE - 1) % TX_QUEUE_SIZE;
+	if (head >= TX_QUEUE_SIZE
+	    || ring_dist(tdt, head, TX_QUEUE_SIZE)
+	       > ring_dist(tdt, tail, TX_QUEUE_SIZE))
+		return -E_INVAL;
+	for (; tdt != head; tdt = (tdt + 1) % TX_QUEUE_SIZE) {
+		slot = nm_rings->nm_txslot[tdt];
+		if (slot.ns_buf >= NETMAP_NBUFS || slot.ns_len == 0
+		    || slot.ns_len > MIN(NETMAP_BUFSIZE, TX_BUFFER_SIZE)) {
+			r = -E_INVAL;
+			break;
+		}
+		tdesc = &tx_queue[tdt];
+		tdesc->buffer_addr = netmap_buf(slot.ns_buf);
+		tdesc->length = slot.ns_len;
+		tdesc->cmd = E1000_TXD_CMD_RS | E1000_TXD_CMD_EOP;
+		tdesc->status = 0;
+		tx_seq++;
+	}
+	e1000w(E1000_TDT, tdt);
+	ring->nr_tail = tail;
+	return r;
+}
+
+// Give the receive slots from RDT + 1 up to nr_head back to the NIC,
+// with the buffers they now name, then report the packets received
+// since the last call by moving nr_tail past them.  A slot with a bad
+// buffer stops the recycling there.
+static int netmap_rxsync(void)
+{
+	struct netmap_ring *ring = &nm_rings->nm_rx;
+	uint32_t rdt = e1000r(E1000_RDT), head = ring->nr_head, i;
+	struct netmap_slot *slot;
+	struct rx_desc *rdesc;
+	uint16_t buf;
+	int r = 0;
+
+	i = (rdt + 1) % RX_QUEUE_SIZE;
+	if (head >= RX_QUEUE_SIZE
+	    || ring_dist(i, head, RX_QUEUE_SIZE)
+	       > ring_dist(i, nm_rx_tail, RX_QUEUE_SIZE))
+		return -E_INVAL;
+	for (; i != head; i = (i + 1) % RX_QUEUE_SIZE) {
+		if ((buf = nm_rings->nm_rxslot[i].ns_buf) >= NETMAP_NBUFS) {
+			r = -E_INVAL;
+			break;
+		}
+		rx_queue[i].buffer_addr = netmap_buf(buf);
+		rx_queue[i].status = 0;
+		rdt = i;
+	}
 	e1000w(E1000_RDT, rdt);
-	return rdesc->length;
+
+	// The NIC never fills the descriptor at RDT.
+	for (i = nm_rx_tail; i != rdt; i = (i + 1) % RX_QUEUE_SIZE) {
+		rdesc = &rx_queue[i];
+		if (!(rdesc->status & E1000_RXD_STAT_DD))
+			break;
+		slot = &nm_rings->nm_rxslot[i];
+		slot->ns_len = rdesc->length;
+		slot->ns_flags = net_rx_csum(rdesc);
+		e1000_stats.rx_packets++;
+	}
+	if (i != nm_rx_tail)
+		e1000_stats.rx_polls++;
+	nm_rx_tail = ring->nr_tail = i;
+	return r;
+}
+
+// Sync the rings in 'rings', NET_WAIT_TX and NET_WAIT_RX, with the
+// slots of the environment that has them.
+int net_sync(uint32_t rings)
+{
+	int r = 0, r2 = 0;
+
+	if (rings & NET_WAIT_TX)
+		r = netmap_txsync();
+	if (rings & NET_WAIT_RX)
+		r2 = netmap_rxsync();
+	return r < 0 ? r : r2;
 }
 
+// Mask the interrupt causes in 'causes', if polling.
+static void net_intr_disarm(uint32_t causes)
+{
+	if (!e1000_tunables.poll)
+		return;
+	causes &= intr_armed;
+	if (causes) {
+		intr_armed &= ~causes;
+		e1000w(E1000_IMC, causes);
+	}
+}
+
+static bool net_rx_ready(void)
+{
+	uint32_t rdt = e1000r(E1000_RDT);
+	size_t length;
+	int ndesc;
+
+	if (nm_env)
+		return nm_rx_tail != rdt
+			&& (rx_queue[nm_rx_tail].status & E1000_RXD_STAT_DD);
+	return net_rx_frame((rdt + 1) % RX_QUEUE_SIZE, &ndesc, &length);
+}
+
+/* Room for the longest copied frame, so that a sender woken up can
+ * always queue one.  */
+static bool net_tx_ready(void)
+{
+	net_tx_reclaim();
+	return net_tx_free() >= TX_BUFFERS(NET_FRAME_MAX);
+}
+
+// Return which of the NET_WAIT_* 'events' have already happened: a
+// received packet is waiting, or the next transmit descriptor is free.
+// Those that have not get their interrupts unmasked, for the caller to
+// wait on.  Reading ICR in e1000_intr may have swallowed the cause of a
+// masked interrupt, so look again once it is unmasked.
+static uint32_t e1000_ready(uint32_t events)
+{
+	uint32_t ready = 0;
+
+	if (events & NET_WAIT_RX) {
+		if (!net_rx_ready() && !(intr_armed & E1000_ICR_RXT0)) {
+			net_intr_arm(E1000_ICR_RX);
+			e1000_stats.rx_rearms++;
+		}
+		if (net_rx_ready())
+			ready |= NET_WAIT_RX;
+	}
+	if (events & NET_WAIT_TX) {
+		if (!net_tx_ready() && !(intr_armed & E1000_ICR_TXDW)) {
+			net_intr_arm(E1000_ICR_TXDW);
+			e1000_stats.tx_rearms++;
+		}
+		if (net_tx_ready())
+			ready |= NET_WAIT_TX;
+	}
+	return ready;
+}
+
+// Interrupt handler.  Reading ICR acknowledges the interrupt and lets
+// the IRQ line drop; then wake up whoever waits for what happened.
+// Whatever happened stays masked until e1000_ready finds the ring
+// drained again, so that a busy ring is polled rather than interrupting
+// for every packet.
+static void e1000_intr(void)
+{
+	uint32_t icr = e1000r(E1000_ICR), events = 0;
+
+	e1000_stats.intrs++;
+	if (icr & E1000_ICR_RX) {
+		e1000_stats.rx_intrs++;
+		net_intr_disarm(E1000_ICR_RX);
+		events |= NET_WAIT_RX;
+	}
+	if (icr & E1000_ICR_TXDW) {
+		e1000_stats.tx_intrs++;
+		net_intr_disarm(E1000_ICR_TXDW);
+		net_tx_reclaim();
+		events |= NET_WAIT_TX;
+	}
+	if (events)
+		net_wake(events);
+}
+
+// Program the delay timers from e1000_tunables, and with polling off,
+// unmask every interrupt for good.
+void e1000_tune(void)
+{
+	if (!e1000)
+		return;
+	e1000w(E1000_ITR, e1000_tunables.itr);
+	e1000w(E1000_RDTR, e1000_tunables.rdtr);
+	e1000w(E1000_RADV, e1000_tunables.radv);
+	if (!e1000_tunables.poll)
+		net_intr_arm(E1000_ICR_RX | E1000_ICR_TXDW);
+}
+
+static const struct net_driver e1000_driver = {
+	.nd_name = "e1000",
+	.nd_offloads = NET_CSUM_IP | NET_CSUM_L4 | NET_TSO,
+	.nd_tx = e1000_tx,
+	.nd_tx_batch = e1000_tx_batch,
+	.nd_tx_frags = e1000_tx_frags,
+	.nd_tx_done = e1000_tx_done,
+	.nd_rx = e1000_rx,
+	.nd_rx_pages = e1000_rx_pages,
+	.nd_ready = e1000_ready,
+	.nd_intr = e1000_intr,
+};
+
 // LAB 6: Your driver code here
 int
 pci_e1000_attach(struct pci_func *f)
 {
+	if (!net_attach(&e1000_driver, f->irq_line))
+		return 0;
 	pci_func_enable(f);
 	e1000 = mmio_map_region(f->reg_base[0], f->reg_size[0]);
 	cprintf("E1000_STATUS: %x\n", e1000r(E1000_STATUS));
 	net_tx_initialize();
 	net_rx_initialize();
+
+	// Interrupt on received packets and on transmit descriptors
+	// coming back, for sys_net_wait.
+	e1000w(E1000_IMC, 0xFFFFFFFF);
+	e1000r(E1000_ICR);
+	net_intr_arm(E1000_ICR_RX | E1000_ICR_TXDW);
+	e1000_tune();
 	return 1;
 }
@@ -3,6 +3,7 @@
 
 #include <inc/types.h>
 #include <kern/pci.h>
+#include <kern/net.h>
 
 /* Selected Register Set. (82543, 82544)
  *
@@ -19,6 +20,20 @@
 
 #define E1000_STATUS	0x00008  /* Device Status - RO */
 
+/* Interrupts.  IMS, IMC and ICS use the same bits as ICR. */
+#define E1000_ICR	0x000C0  /* Interrupt Cause Read - R/clr */
+#define E1000_ITR	0x000C4  /* Interrupt Throttling Rate - RW */
+#define E1000_ICS	0x000C8  /* Interrupt Cause Set - WO */
+#define E1000_IMS	0x000D0  /* Interrupt Mask Set - RW */
+#define E1000_IMC	0x000D8  /* Interrupt Mask Clear - WO */
+# define E1000_ICR_TXDW		0x00000001    /* Transmit desc written back */
+# define E1000_ICR_TXQE		0x00000002    /* Transmit Queue empty */
+# define E1000_ICR_LSC		0x00000004    /* Link Status Change */
+# define E1000_ICR_RXSEQ	0x00000008    /* rx sequence error */
+# define E1000_ICR_RXDMT0	0x00000010    /* rx desc min. threshold (0) */
+# define E1000_ICR_RXO		0x00000040    /* rx overrun */
+# define E1000_ICR_RXT0		0x00000080    /* rx timer intr (ring 0) */
+
 /* Transmit Control */
 #define E1000_TCTL	0x00400  /* TX Control - RW */
 # define E1000_TCTL_RST		0x00000001    /* software reset */
@@ -75,8 +90,38 @@ struct tx_desc {
 #define E1000_TXD_CMD_TSE	0x04000000 /* TCP Seg enable */
 #define E1000_TXD_STAT_TC	0x00000004 /* Tx Underrun */
 
+/* Extended transmit descriptors, which share the ring with legacy ones.
+ * A context descriptor tells the NIC where the checksums go in the
+ * packets after it, up to the next context descriptor.  Extended data
+ * descriptors then carry packets like legacy ones, with popts saying
+ * which checksums to insert.  Both have DEXT set in cmd, and cmd and
+ * status sit where they do in struct tx_desc.  */
+struct tx_ctx_desc {
+	uint8_t ipcss;		/* IP checksum start */
+	uint8_t ipcso;		/* IP checksum offset */
+	uint16_t ipcse;		/* IP checksum end, inclusive */
+	uint8_t tucss;		/* TCP/UDP checksum start */
+	uint8_t tucso;		/* TCP/UDP checksum offset */
+	uint16_t tucse;		/* TCP/UDP checksum end, 0 for end of packet */
+	uint16_t paylen;	/* TSO payload length, bits 15:0 */
+	uint8_t dtyp;		/* E1000_TXD_DTYP_C >> 16, paylen bits 19:16 */
+	uint8_t cmd;		/* E1000_TXD_CMD_{TCP,IP,TSE} >> 24, RS, DEXT */
+	uint8_t status;
+	uint8_t hdr_len;	/* TSO header length */
+	uint16_t mss;		/* TSO segment size */
+};
+
+struct tx_data_desc {
+	uint64_t buffer_addr;
+	uint16_t length;
+	uint8_t dtyp;		/* E1000_TXD_DTYP_D >> 16, length bits 19:16 */
+	uint8_t cmd;		/* E1000_TXD_CMD_*, with DEXT */
+	uint8_t status;
+	uint8_t popts;		/* E1000_TXD_POPTS_* */
+	uint16_t special;
+};
+
 /* Receive Control */
-#define E1000_IMC	0x000D8  /* Interrupt Mask Clear - WO */
 #define E1000_RCTL	0x00100  /* RX Control - RW */
 # define E1000_RCTL_RST            0x00000001    /* Software reset */
 # define E1000_RCTL_EN             0x00000002    /* enable */
@@ -121,6 +166,12 @@ struct tx_desc {
 #define E1000_RDLEN	0x02808  /* RX Descriptor Length - RW */
 #define E1000_RDH	0x02810  /* RX Descriptor Head - RW */
 #define E1000_RDT	0x02818  /* RX Descriptor Tail - RW */
+#define E1000_RDTR	0x02820  /* RX Delay Timer - RW */
+# define E1000_RDTR_FPD		0x80000000    /* Flush Partial Descriptor Block */
+#define E1000_RADV	0x0282C  /* RX Interrupt Absolute Delay Timer - RW */
+#define E1000_RXCSUM	0x05000  /* RX Checksum Control - RW */
+# define E1000_RXCSUM_IPOFL	0x00000100    /* IPv4 checksum offload */
+# define E1000_RXCSUM_TUOFL	0x00000200    /* TCP / UDP checksum offload */
 #define E1000_MTA	0x05200  /* Multicast Table Array - RW Array */
 #define E1000_RAL0	0x05400  /* Receive Address Low (0) - RW */
 #define E1000_RAH0	0x05404  /* Receive Address High (0) - RW */
@@ -172,9 +223,37 @@ struct rx_desc {
 #define PCI_DEVICE_E1000	0x100E
 int pci_e1000_attach(struct pci_func *f);
 
-#define TX_BUFFER_SIZE		1518
-#define RX_BUFFER_SIZE		2048
-size_t net_packet_tx(const void *packet, size_t length);
-size_t net_packet_rx(uint8_t *buffer);
+#define NETMAP_NPAGES	(1 + NETMAP_NBUFS * NETMAP_BUFSIZE / PGSIZE)
+struct Env;
+int net_map(struct Env *e);
+struct PageInfo *net_map_page(int i);
+struct Env *net_map_env(void);
+void net_unmap(struct Env *e);
+int net_sync(uint32_t rings);
+
+/* Interrupt moderation.  With polling on, an interrupt masks the causes
+ * that raised it, and they stay masked while sys_net_wait callers find
+ * work without waiting, i.e. while the ring is polled in batches; they
+ * are unmasked once a caller would block.  Off, every packet may
+ * interrupt.  The delays are in the units of their registers: ITR in
+ * 256ns, RDTR and RADV in 1.024us.  */
+struct e1000_tunables {
+	bool poll;
+	uint32_t itr;		/* least time between interrupts */
+	uint32_t rdtr;		/* receive interrupt delay after a packet */
+	uint32_t radv;		/* ... and at most after the first one */
+};
+struct e1000_stats {
+	uint32_t intrs;		/* interrupts taken */
+	uint32_t rx_intrs;	/* ... for received packets */
+	uint32_t tx_intrs;	/* ... for sent packets */
+	uint32_t rx_polls;	/* receive polls that found packets */
+	uint32_t rx_packets;	/* packets they took */
+	uint32_t rx_rearms;	/* receive interrupts unmasked again */
+	uint32_t tx_rearms;	/* transmit interrupts unmasked again */
+};
+extern struct e1000_tunables e1000_tunables;
+extern struct e1000_stats e1000_stats;
+void e1000_tune(void);
 
 #endif  // SOL >= 6
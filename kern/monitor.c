@@ -11,6 +11,7 @@
 #include <kern/monitor.h>
 #include <kern/kdebug.h>
 #include <kern/trap.h>
+#include <kern/e1000.h>
 
 #define CMDBUF_SIZE	80	// enough for one VGA text line
 
@@ -26,6 +27,7 @@ static struct Command commands[] = {
 	{ "help", "Display this list of commands", mon_help },
 	{ "kerninfo", "Display information about the kernel", mon_kerninfo },
 	{ "backtrace", "Display backtrace of the stack", mon_backtrace },
+	{ "e1000", "Display or tune e1000 interrupt moderation", mon_e1000 },
 };
 
 /***** Implementations of basic kernel monitor commands *****/
@@ -85,6 +87,44 @@ mon_backtrace(int argc, char **argv, struct Trapframe *tf)
 	return 0;
 }
 
+int
+mon_e1000(int argc, char **argv, struct Trapframe *tf)
+{
+	struct e1000_tunables *t = &e1000_tunables;
+	struct e1000_stats *s = &e1000_stats;
+	char *end;
+	long v;
+
+	if (argc == 3) {
+		v = strtol(argv[2], &end, 0);
+		if (*end || v < 0 || v > 0xFFFF)
+			goto usage;
+		if (strcmp(argv[1], "itr") == 0)
+			t->itr = v;
+		else if (strcmp(argv[1], "rdtr") == 0)
+			t->rdtr = v;
+		else if (strcmp(argv[1], "radv") == 0)
+			t->radv = v;
+		else if (strcmp(argv[1], "poll") == 0)
+			t->poll = v != 0;
+		else
+			goto usage;
+		e1000_tune();
+	} else if (argc != 1)
+		goto usage;
+
+	cprintf("poll %d  itr %u  rdtr %u  radv %u\n",
+		t->poll, t->itr, t->rdtr, t->radv);
+	cprintf("interrupts %u (rx %u, tx %u)  rearmed rx %u, tx %u\n",
+		s->intrs, s->rx_intrs, s->tx_intrs, s->rx_rearms, s->tx_rearms);
+	cprintf("rx polls %u, %u packets\n", s->rx_polls, s->rx_packets);
+	return 0;
+
+usage:
+	cprintf("usage: e1000 [itr|rdtr|radv|poll value]\n");
+	return 0;
+}
+
 
 
 /***** Kernel monitor command interpreter *****/
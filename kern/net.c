@@ -0,0 +1,88 @@
+#include <kern/net.h>
+#include <kern/picirq.h>
+#include <kern/pmap.h>
+#include <inc/stdio.h>
+#include <inc/string.h>
+
+// The NIC driver in use, and its IRQ.  Without one, nothing is ever
+// sent or received.
+const struct net_driver *net_driver;
+uint8_t net_irq;
+
+// Make drv the NIC driver the packet calls go to, and unmask its IRQ,
+// unless another one got there first.  Returns whether it did.
+bool net_attach(const struct net_driver *drv, uint8_t irq)
+{
+	if (net_driver) {
+		cprintf("%s: not used, %s is\n", drv->nd_name,
+			net_driver->nd_name);
+		return false;
+	}
+	net_driver = drv;
+	net_irq = irq;
+	irq_setmask_8259A(irq_mask_8259A & ~(1 << irq));
+	return true;
+}
+
+// Fill in the struct jif_pkt header of the 'length'-byte received
+// packet in the run of pages pps[].  The pages may have held anything
+// before; the rest of the last one is zeroed, so that only the packet
+// is handed out.
+void net_rx_pkt_init(struct PageInfo **pps, size_t length, int csum)
+{
+	int *pkt = page2kva(pps[0]);
+	size_t end = RX_PKT_OFFSET + length
+		- (RX_PKT_PAGES(length) - 1) * PGSIZE;
+
+	pkt[0] = length;
+	pkt[1] = csum;
+	memset((char *) page2kva(pps[RX_PKT_PAGES(length) - 1]) + end, 0,
+	       PGSIZE - end);
+}
+
+size_t net_packet_tx(const void *packet, size_t length)
+{
+	return net_driver ? net_driver->nd_tx(packet, length) : 0;
+}
+
+int net_packet_tx_batch(const struct net_sg *pkts, int n)
+{
+	return net_driver ? net_driver->nd_tx_batch(pkts, n) : 0;
+}
+
+size_t net_packet_tx_frags(const struct tx_frag *frags, int n,
+			   const struct net_offload *off, uint32_t *seq)
+{
+	return net_driver ? net_driver->nd_tx_frags(frags, n, off, seq) : 0;
+}
+
+uint32_t net_tx_done(void)
+{
+	return net_driver ? net_driver->nd_tx_done() : 0;
+}
+
+size_t net_packet_rx(uint8_t *buffer)
+{
+	return net_driver ? net_driver->nd_rx(buffer) : 0;
+}
+
+int net_packet_rx_pages(struct PageInfo **pps, int max)
+{
+	return net_driver ? net_driver->nd_rx_pages(pps, max) : 0;
+}
+
+uint32_t net_ready(uint32_t events)
+{
+	return net_driver ? net_driver->nd_ready(events) : 0;
+}
+
+uint32_t net_offloads(void)
+{
+	return net_driver ? net_driver->nd_offloads : 0;
+}
+
+void net_intr(void)
+{
+	if (net_driver)
+		net_driver->nd_intr();
+}
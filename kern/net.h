@@ -0,0 +1,62 @@
+#ifndef JOS_KERN_NET_H
+#define JOS_KERN_NET_H
+
+#include <inc/types.h>
+
+/* The network interface the packet system calls use.  The first NIC
+ * driver to attach registers itself with net_attach, so which one is
+ * used is up to the devices the machine boots with.  */
+
+#define TX_BUFFER_SIZE		1518
+#define RX_BUFFER_SIZE		2048
+/* Transmit buffers a copied packet of 'len' bytes, up to NET_FRAME_MAX,
+ * is spread over */
+#define TX_BUFFERS(len)		(((len) + TX_BUFFER_SIZE - 1) / TX_BUFFER_SIZE)
+/* Received packets are pages laid out as struct jif_pkt: the length,
+ * the NET_CSUM_* checksums the NIC found good, then the packet data,
+ * which goes on into the pages after the first if it has to */
+#define RX_PKT_OFFSET		(2 * sizeof(int))
+#define RX_PKT_PAGES(len)	((RX_PKT_OFFSET + (len) + PGSIZE - 1) / PGSIZE)
+
+struct PageInfo;
+struct net_sg;
+struct net_offload;
+
+/* A piece of a packet to send, within one page */
+struct tx_frag {
+	struct PageInfo *pp;
+	uint16_t off;
+	uint16_t len;
+};
+
+struct net_driver {
+	const char *nd_name;
+	uint32_t nd_offloads;	/* NET_CSUM_* and NET_TSO it takes */
+	size_t (*nd_tx)(const void *packet, size_t length);
+	int (*nd_tx_batch)(const struct net_sg *pkts, int n);
+	size_t (*nd_tx_frags)(const struct tx_frag *frags, int n,
+			      const struct net_offload *off, uint32_t *seq);
+	uint32_t (*nd_tx_done)(void);
+	size_t (*nd_rx)(uint8_t *buffer);
+	int (*nd_rx_pages)(struct PageInfo **pps, int max);	/* pages */
+	uint32_t (*nd_ready)(uint32_t events);
+	void (*nd_intr)(void);
+};
+
+extern const struct net_driver *net_driver;
+extern uint8_t net_irq;
+bool net_attach(const struct net_driver *drv, uint8_t irq);
+void net_rx_pkt_init(struct PageInfo **pps, size_t length, int csum);
+
+size_t net_packet_tx(const void *packet, size_t length);
+int net_packet_tx_batch(const struct net_sg *pkts, int n);
+size_t net_packet_tx_frags(const struct tx_frag *frags, int n,
+			   const struct net_offload *off, uint32_t *seq);
+uint32_t net_tx_done(void);
+size_t net_packet_rx(uint8_t *buffer);
+int net_packet_rx_pages(struct PageInfo **pps, int max);
+uint32_t net_ready(uint32_t events);
+uint32_t net_offloads(void);
+void net_intr(void);
+
+#endif  // !JOS_KERN_NET_H
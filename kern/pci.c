@@ -4,6 +4,7 @@
 #include <kern/pci.h>
 #include <kern/pcireg.h>
 #include <kern/e1000.h>
+#include <kern/virtio_net.h>
 
 // Flag to do "lspci" at bootup
 static int pci_show_devs = 1;
@@ -32,6 +33,7 @@ struct pci_driver pci_attach_class[] = {
 // and key2 should be the vendor ID and device ID respectively
 struct pci_driver pci_attach_vendor[] = {
 	{ PCI_VENDER_INTEL, PCI_DEVICE_E1000, &pci_e1000_attach },
+	{ PCI_VENDOR_VIRTIO, PCI_DEVICE_VIRTIO_NET, &pci_virtio_net_attach },
 	{ 0, 0, 0 },
 };
 
@@ -13,6 +13,7 @@
 #include <kern/sched.h>
 #include <kern/spinlock.h>
 #include <kern/time.h>
+#include <kern/net.h>
 #include <kern/e1000.h>
 
 // Print a string to the system console.
@@ -330,6 +331,40 @@ exit:
 	return r;
 }
 
+// Return the page mapped at 'srcva' in the current environment if it
+// may be sent over IPC with permissions 'perm', or NULL if not.
+// The checks are those described for sys_ipc_try_send below.
+static struct PageInfo *
+ipc_page_lookup(void *srcva, unsigned perm)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+
+	if ((uintptr_t) srcva >= UTOP || PGOFF(srcva) != 0)
+		return NULL;
+	if (!(perm & PTE_U) || !(perm & PTE_P) || !!(perm & ~PTE_SYSCALL))
+		return NULL;
+	pp = page_lookup(curenv->env_pgdir, srcva, &pte);
+	if (!pp || ((perm & PTE_W) && !(*pte & PTE_W)))
+		return NULL;
+	return pp;
+}
+
+// Deliver 'value' from the current environment to e, which is
+// receiving in sys_ipc_recv, and make e runnable again if it blocked.
+static void
+ipc_wake(struct Env *e, uint32_t value)
+{
+	e->env_ipc_value = value;
+	e->env_ipc_from = curenv->env_id;
+
+	e->env_ipc_recving = false;
+	if (!e->env_ipc_nowait) {
+		e->env_tf.tf_regs.reg_eax = 0;
+		e->env_status = ENV_RUNNABLE;
+	}
+}
+
 // Try to send 'value' to the target env 'envid'.
 // If srcva < UTOP, then also send page currently mapped at 'srcva',
 // so that receiver gets a duplicate mapping of the same page.
@@ -384,19 +419,8 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 	}
 	if ((uintptr_t) e->env_ipc_dstva < UTOP && (uintptr_t) srcva < UTOP) {
 		struct PageInfo *pp;
-		pte_t *pte;
 
-		if (PGOFF(srcva) != 0) {
-			r = -E_INVAL;
-			goto exit;
-		}
-		if (!(perm & PTE_U) || !(perm & PTE_P) ||
-		    !!(perm & ~PTE_SYSCALL)) {
-			r = -E_INVAL;
-			goto exit;
-		}
-		pp = page_lookup(curenv->env_pgdir, srcva, &pte);
-		if (!pp || ((perm & PTE_W) && !(*pte & PTE_W))) {
+		if (!(pp = ipc_page_lookup(srcva, perm))) {
 			r = -E_INVAL;
 			goto exit;
 		}
@@ -404,38 +428,126 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 		if (r < 0)
 			goto exit;
 		e->env_ipc_perm = perm;
-	} else
+		e->env_ipc_npages = 1;
+	} else {
 		e->env_ipc_perm = 0;
-	e->env_ipc_value = value;
-	e->env_ipc_from = curenv->env_id;
-
-	e->env_ipc_recving = false;
-	e->env_tf.tf_regs.reg_eax = 0;
-	e->env_status = ENV_RUNNABLE;
+		e->env_ipc_npages = 0;
+	}
+	ipc_wake(e, value);
 exit:
 	return r;
 }
 
+// Like sys_ipc_try_send, but send up to 'npages' pages at once.
+// Each entry of the array 'pages' is the page-aligned address of a
+// page in the caller's address space or'ed with the permissions to
+// send it with.  The pages are mapped at consecutive addresses in
+// the receiver, starting at its dstva.  If the receiver asked for
+// fewer pages than were sent, only that many are transferred.
+// On success the receiver's env_ipc_npages is set to the number of
+// pages transferred and env_ipc_perm to the permissions of the first.
+//
+// Returns 0 on success, < 0 on error.  Errors are those of
+// sys_ipc_try_send, plus:
+//	-E_INVAL if npages < 0 or npages > IPC_MAXPAGES.
+// Every page is checked, and every page table the receiver needs is
+// allocated, before any page is mapped, so an error leaves the
+// receiver's mappings unchanged and the receiver still waiting.
+static int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *upages,
+		  int npages)
+{
+	uintptr_t pages[IPC_MAXPAGES];
+	struct PageInfo *pps[IPC_MAXPAGES];
+	struct Env *e;
+	uint8_t *dstva;
+	int i, n, r;
+
+	if (npages < 0 || npages > IPC_MAXPAGES)
+		return -E_INVAL;
+	user_mem_assert(curenv, upages, npages * sizeof(uintptr_t), PTE_U);
+	memmove(pages, upages, npages * sizeof(uintptr_t));
+
+	if ((r = envid2env(envid, &e, false)) < 0)
+		return r;
+	if (!e->env_ipc_recving)
+		return -E_IPC_NOT_RECV;
+
+	n = 0;
+	if ((uintptr_t) e->env_ipc_dstva < UTOP)
+		n = MIN(npages, e->env_ipc_npages);
+	// Check every page and make every page table before mapping any;
+	// page_insert cannot fail after that.
+	dstva = e->env_ipc_dstva;
+	for (i = 0; i < n; i++) {
+		if (!(pps[i] = ipc_page_lookup((void *) ROUNDDOWN(pages[i], PGSIZE),
+					       PGOFF(pages[i]))))
+			return -E_INVAL;
+		if (!pgdir_walk(e->env_pgdir, dstva + i * PGSIZE, 1))
+			return -E_NO_MEM;
+	}
+	for (i = 0; i < n; i++)
+		if ((r = page_insert(e->env_pgdir, pps[i], dstva + i * PGSIZE,
+				     PGOFF(pages[i]))) < 0)
+			panic("sys_ipc_try_sendv: page_insert: %e", r);
+
+	e->env_ipc_perm = n > 0 ? PGOFF(pages[0]) : 0;
+	e->env_ipc_npages = n;
+	ipc_wake(e, value);
+	return 0;
+}
+
 // Block until a value is ready.  Record that you want to receive
 // using the env_ipc_recving and env_ipc_dstva fields of struct Env,
 // mark yourself not runnable, and then give up the CPU.
 //
-// If 'dstva' is < UTOP, then you are willing to receive a page of data.
-// 'dstva' is the virtual address at which the sent page should be mapped.
+// If 'dstva' is < UTOP, then you are willing to receive up to 'npages'
+// pages of data.  'dstva' is the virtual address at which the first sent
+// page should be mapped; any others follow it.
+//
+// A nonzero 'deadline' is a time_msec() value: if nothing has arrived
+// by then, the blocked receive gives up and returns -E_TIMEOUT.
+//
+// With IPC_NOWAIT in 'flags', only start receiving and return 0 at once.
+// The message then arrives in the background: the environment sees
+// env_ipc_recving drop to false in its struct Env, with the other ipc
+// fields filled in as usual.  A later blocking sys_ipc_recv returns 0
+// right away if such a message is waiting, instead of receiving anew;
+// if none has come yet, it blocks for it.
 //
 // This function only returns on error, but the system call will eventually
 // return 0 on success.
 // Return < 0 on error.  Errors are:
 //	-E_INVAL if dstva < UTOP but dstva is not page-aligned.
+//	-E_INVAL if dstva < UTOP but npages is not in 1..IPC_MAXPAGES,
+//		or the pages would extend past UTOP.
+//	-E_TIMEOUT if 'deadline' has already passed.
 static int
-sys_ipc_recv(void *dstva)
+sys_ipc_recv(void *dstva, int npages, int flags, unsigned deadline)
 {
 	// LAB 4: Your code here.
-	if ((uintptr_t) dstva < UTOP && PGOFF(dstva) != 0)
+	if ((uintptr_t) dstva < UTOP
+	    && (PGOFF(dstva) != 0 || npages < 1 || npages > IPC_MAXPAGES
+		|| (uintptr_t) dstva + npages * PGSIZE > UTOP))
 		return -E_INVAL;
 
+	if (curenv->env_ipc_nowait && !curenv->env_ipc_recving
+	    && !(flags & IPC_NOWAIT)) {
+		curenv->env_ipc_nowait = false;
+		return 0;
+	}
+
 	curenv->env_ipc_recving = true;
 	curenv->env_ipc_dstva = dstva;
+	curenv->env_ipc_npages = npages;
+	curenv->env_ipc_nowait = !!(flags & IPC_NOWAIT);
+	if (curenv->env_ipc_nowait)
+		return 0;
+	if (deadline && (int32_t) (time_msec() - deadline) >= 0) {
+		curenv->env_ipc_recving = false;
+		return -E_TIMEOUT;
+	}
+	curenv->env_ipc_deadline = deadline;
 	curenv->env_status = ENV_NOT_RUNNABLE;
 	// Not a real return, as curenv has been marked as NOT_RUNNABLE.
 	// Yield scheduler through trap().
@@ -461,10 +573,15 @@ sys_time_msec(void)
 	return time_msec();
 }
 
+// While an environment has the NIC's rings (sys_net_map), the packet
+// calls below find the transmit ring full and nothing received.
+
 static size_t
 sys_net_try_send(const void *packet, size_t length)
 {
 	user_mem_assert(curenv, packet, length, 0);
+	if (net_map_env())
+		return 0;
 	return net_packet_tx(packet, length);
 }
 
@@ -472,9 +589,292 @@ static size_t
 sys_net_try_recv(uint8_t *buffer)
 {
 	user_mem_assert(curenv, buffer, RX_BUFFER_SIZE, PTE_W);
+	if (net_map_env())
+		return 0;
 	return net_packet_rx(buffer);
 }
 
+// Receive packets by mapping up to 'npages' pages the NIC put them in at
+// dstva, dstva + PGSIZE, and so on, in the caller, in place of whatever
+// was there.  Each packet starts a page as a struct jif_pkt, and one
+// longer than fits in that page goes on in the pages after it,
+// JIF_PKT_NPAGES(jp_len) in all.  The packets are not copied.
+// Returns the number of pages received, 0 if no packet is waiting.
+// Returns < 0 on error.  Errors are:
+//	-E_INVAL if dstva is not page-aligned, npages is not in
+//		1..NET_BATCH_MAX, or the pages would extend past UTOP.
+//	-E_NO_MEM if there is no memory to take the pages' place, or to
+//		map the first one.
+// Packets whose pages cannot all be mapped are dropped.
+static int
+sys_net_recv_pages(void *dstva, int npages)
+{
+	struct PageInfo *pps[NET_BATCH_MAX];
+	int i, j, k, n, m;
+
+	if (PGOFF(dstva) || npages < 1 || npages > NET_BATCH_MAX
+	    || (uintptr_t) dstva >= UTOP
+	    || (uintptr_t) dstva + npages * PGSIZE > UTOP)
+		return -E_INVAL;
+	if (net_map_env())
+		return 0;
+	if ((n = net_packet_rx_pages(pps, npages)) <= 0)
+		return n;
+	// Map the packets in order, each whole or not at all, stopping at
+	// the first that fails.
+	for (i = m = 0; i < n; i += k) {
+		k = RX_PKT_PAGES(*(int *) page2kva(pps[i]));
+		for (j = 0; m == i && j < k; j++)
+			if (page_insert(curenv->env_pgdir, pps[i + j],
+					(char *) dstva + (i + j) * PGSIZE,
+					PTE_U | PTE_W | PTE_P) < 0) {
+				while (j-- > 0)
+					page_remove(curenv->env_pgdir,
+						    (char *) dstva + (i + j) * PGSIZE);
+				break;
+			}
+		if (m == i && j == k)
+			m += k;
+		for (j = 0; j < k; j++)
+			page_decref(pps[i + j]);
+	}
+	return m > 0 ? m : -E_NO_MEM;
+}
+
+// Copy up to 'n' packets, each given by one entry in pkts[], into the
+// transmit ring in one go, as many as there is room for.  A bad packet
+// ends the batch: only the ones before it are sent.
+// Returns the number of packets queued, 0 if the ring is full.
+// Returns < 0 on error.  Errors are:
+//	-E_INVAL if n is not in 1..NET_BATCH_MAX, or the first packet is
+//		empty or longer than NET_FRAME_MAX.
+// Destroys the environment if any packet is not readable memory.
+static int
+sys_net_send_batch(const struct net_sg *upkts, int n)
+{
+	struct net_sg pkts[NET_BATCH_MAX];
+	int i;
+
+	if (n < 1 || n > NET_BATCH_MAX)
+		return -E_INVAL;
+	// Check and use a copy of the array, which the caller cannot
+	// change behind our back.
+	user_mem_assert(curenv, upkts, n * sizeof(*upkts), 0);
+	memmove(pkts, upkts, n * sizeof(*upkts));
+	for (i = 0; i < n; i++) {
+		if (pkts[i].sg_len == 0 || pkts[i].sg_len > NET_FRAME_MAX)
+			break;
+		user_mem_assert(curenv, pkts[i].sg_va, pkts[i].sg_len, 0);
+	}
+	if (i == 0)
+		return -E_INVAL;
+	if (net_map_env())
+		return 0;
+	return net_packet_tx_batch(pkts, i);
+}
+
+// Transmit one packet made of the 'nsg' pieces in sg[], straight from
+// the caller's pages: the NIC reads the pages themselves, and they stay
+// allocated until it is done, even if the caller unmaps them.  The caller
+// must not change the data until info->ti_done shows the packet has
+// been sent.  Fills in *info either way.  If off is not null, the NIC
+// fills in the checksums it asks for; with NET_TSO, the packet may be
+// up to NET_TSO_MAX bytes, and goes out as segments of at most
+// NET_FRAME_MAX.  A NIC that cannot fill in checksums on the fly has
+// the kernel write them into the packet, so with off the headers, up to
+// the end of the TCP or UDP checksum field, must be writable.
+// Returns the packet length, or 0 if the transmit ring has no room.
+// Returns < 0 on error.  Errors are:
+//	-E_INVAL if nsg is not in 1..NET_SG_MAX, the packet is too long,
+//		or any of it is not mapped user memory.
+//	-E_INVAL if off is given and the headers are not writable.
+//	-E_INVAL if *off has unknown flags or offsets out of order or past
+//		the end of the packet.
+//	-E_NOT_SUPP if the NIC cannot do what *off asks for.
+static int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+	struct tx_frag frags[2 * NET_SG_MAX];
+	struct net_offload o;
+	struct PageInfo *pp;
+	pte_t *pte;
+	uintptr_t va;
+	size_t left, n, length, wlimit;
+	int i, nfrags;
+
+	if (nsg < 1 || nsg > NET_SG_MAX)
+		return -E_INVAL;
+	user_mem_assert(curenv, sg, nsg * sizeof(*sg), 0);
+	user_mem_assert(curenv, info, sizeof(*info), PTE_W);
+	o.no_flags = 0;
+	if (off) {
+		user_mem_assert(curenv, off, sizeof(*off), 0);
+		o = *off;
+	}
+
+	// Split the pieces at page boundaries.  Checksums may get written
+	// into the first wlimit bytes.
+	wlimit = o.no_flags ? o.no_l4csum + 2 : 0;
+	nfrags = 0;
+	length = 0;
+	for (i = 0; i < nsg; i++) {
+		va = (uintptr_t) sg[i].sg_va;
+		for (left = sg[i].sg_len; left > 0; left -= n, va += n) {
+			n = MIN(left, PGSIZE - PGOFF(va));
+			if (va >= UTOP || nfrags == ARRAY_SIZE(frags)
+			    || !(pp = page_lookup(curenv->env_pgdir, (void *) va, &pte))
+			    || (length < wlimit && !(*pte & PTE_W)))
+				return -E_INVAL;
+			frags[nfrags].pp = pp;
+			frags[nfrags].off = PGOFF(va);
+			frags[nfrags].len = n;
+			nfrags++;
+			length += n;
+		}
+	}
+	if (length == 0
+	    || length > (o.no_flags & NET_TSO ? NET_TSO_MAX : NET_FRAME_MAX))
+		return -E_INVAL;
+	if (o.no_flags
+	    && ((o.no_flags & ~(NET_CSUM_IP | NET_CSUM_L4 | NET_TSO))
+		|| o.no_l4hdr <= o.no_iphdr || o.no_l4csum < o.no_l4hdr
+		|| o.no_l4csum + 2 > length))
+		return -E_INVAL;
+	if ((o.no_flags & NET_TSO)
+	    && (!(o.no_flags & NET_CSUM_IP) || !(o.no_flags & NET_CSUM_L4)
+		|| o.no_hdrlen < o.no_l4csum + 2 || o.no_hdrlen >= length
+		|| o.no_mss == 0 || o.no_hdrlen + o.no_mss > NET_FRAME_MAX))
+		return -E_INVAL;
+	if (o.no_flags & ~net_offloads())
+		return -E_NOT_SUPP;
+
+	if (net_map_env())
+		length = 0;
+	else
+		length = net_packet_tx_frags(frags, nfrags,
+					     o.no_flags ? &o : NULL,
+					     &info->ti_seq);
+	info->ti_done = net_tx_done();
+	return length;
+}
+
+// Block until one of the NET_WAIT_* 'events' happens: a packet has been
+// received, or the transmit ring has room.  Returns the events that
+// happened, at once if any already has.
+// Returns < 0 on error.  Errors are:
+//	-E_INVAL if events has no NET_WAIT_* bits or others.
+static int
+sys_net_wait(uint32_t events)
+{
+	uint32_t ready;
+
+	if (!events || (events & ~(NET_WAIT_RX | NET_WAIT_TX)))
+		return -E_INVAL;
+	// Others wait out the rings' owner, waking up now and then.
+	if ((!net_map_env() || net_map_env() == curenv)
+	    && (ready = net_ready(events)))
+		return ready;
+	curenv->env_net_wait = events;
+	curenv->env_status = ENV_NOT_RUNNABLE;
+	// Not a real return, as curenv has been marked as NOT_RUNNABLE.
+	// net_wake sets the real return value.
+	return -E_UNSPECIFIED;
+}
+
+// Take the NIC's rings over from the kernel, for packet I/O without a
+// system call per packet, and map them and their buffers at va, as
+// inc/syscall.h describes.  Only the network server may, and only one
+// environment at a time.  The kernel only ever puts
+// the caller's buffers in the NIC's descriptors, so the NIC reads and
+// writes no other memory on its behalf.
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if the caller may not take the rings.
+//	-E_INVAL if va is not page-aligned, the mapping would extend past
+//		UTOP, or another environment has the rings.
+//	-E_NOT_SUPP if there is no NIC.
+//	-E_NO_MEM if there is no memory for the rings, buffers or the
+//		page tables to map them.
+static int
+sys_net_map(void *va)
+{
+	int i, r;
+
+	if (curenv->env_type != ENV_TYPE_NS)
+		return -E_BAD_ENV;
+	if (PGOFF(va) || (uintptr_t) va >= UTOP
+	    || (uintptr_t) va + NETMAP_SIZE > UTOP)
+		return -E_INVAL;
+	if ((r = net_map(curenv)) < 0)
+		return r;
+	for (i = 0; i < NETMAP_NPAGES; i++)
+		if (page_insert(curenv->env_pgdir, net_map_page(i),
+				(char *) va + i * PGSIZE,
+				PTE_U | PTE_W | PTE_P) < 0) {
+			while (--i >= 0)
+				page_remove(curenv->env_pgdir,
+					    (char *) va + i * PGSIZE);
+			net_unmap(curenv);
+			return -E_NO_MEM;
+		}
+	return 0;
+}
+
+// Sync the caller's rings, NET_WAIT_TX and NET_WAIT_RX in 'rings',
+// with the NIC: send the transmit slots it has filled, recycle the
+// receive slots it is done with, and report what the NIC has finished
+// since.  Does not block; sys_net_wait does.
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if the caller does not have the rings.
+//	-E_INVAL if rings has no NET_WAIT_* bits or others, an nr_head
+//		is past its nr_tail, or a slot to send or recycle names no
+//		buffer or has a bad length.  Slots before that one are
+//		still synced.
+static int
+sys_net_sync(uint32_t rings)
+{
+	if (!net_map_env() || net_map_env() != curenv)
+		return -E_BAD_ENV;
+	if (!rings || (rings & ~(NET_WAIT_RX | NET_WAIT_TX)))
+		return -E_INVAL;
+	return net_sync(rings);
+}
+
+// Make the environments blocked in sys_net_wait for any of 'events'
+// runnable again.  Called from the network interrupt handler.
+void
+net_wake(uint32_t events)
+{
+	struct Env *e;
+
+	for (e = envs; e < envs + NENV; e++)
+		if ((e->env_net_wait & events)
+		    && e->env_status == ENV_NOT_RUNNABLE) {
+			e->env_tf.tf_regs.reg_eax = e->env_net_wait & events;
+			e->env_net_wait = 0;
+			e->env_status = ENV_RUNNABLE;
+		}
+}
+
+// Give up the blocked receives whose deadline has passed.
+// Called from the timer interrupt handler.
+void
+ipc_expire(void)
+{
+	struct Env *e;
+	unsigned now = time_msec();
+
+	for (e = envs; e < envs + NENV; e++)
+		if (e->env_ipc_recving && !e->env_ipc_nowait
+		    && e->env_ipc_deadline
+		    && e->env_status == ENV_NOT_RUNNABLE
+		    && (int32_t) (now - e->env_ipc_deadline) >= 0) {
+			e->env_ipc_recving = false;
+			e->env_tf.tf_regs.reg_eax = -E_TIMEOUT;
+			e->env_status = ENV_RUNNABLE;
+		}
+}
+
 // Dispatches to the correct kernel function, passing the arguments.
 int32_t
 syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
@@ -525,7 +925,7 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 		r = sys_ipc_try_send(a1, a2, (void *) a3, a4);
 		break;
 	case SYS_ipc_recv:
-		r = sys_ipc_recv((void *) a1);
+		r = sys_ipc_recv((void *) a1, a2, a3, a4);
 		break;
 	case SYS_time_msec:
 		r = sys_time_msec();
@@ -536,6 +936,29 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 	case SYS_net_try_recv:
 		r = sys_net_try_recv((uint8_t *) a1);
 		break;
+	case SYS_net_wait:
+		r = sys_net_wait(a1);
+		break;
+	case SYS_net_recv_pages:
+		r = sys_net_recv_pages((void *) a1, a2);
+		break;
+	case SYS_net_send_batch:
+		r = sys_net_send_batch((const struct net_sg *) a1, a2);
+		break;
+	case SYS_net_send_sg:
+		r = sys_net_send_sg((const struct net_sg *) a1, a2,
+				    (const struct net_offload *) a3,
+				    (struct net_txinfo *) a4);
+		break;
+	case SYS_net_map:
+		r = sys_net_map((void *) a1);
+		break;
+	case SYS_net_sync:
+		r = sys_net_sync(a1);
+		break;
+	case SYS_ipc_try_sendv:
+		r = sys_ipc_try_sendv(a1, a2, (const uintptr_t *) a3, a4);
+		break;
 	default:
 		return -E_INVAL;
 	}
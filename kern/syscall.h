@@ -8,5 +8,7 @@
 
 int32_t syscall(uint32_t num, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5);
 int32_t syscall__lock_kernel(uint32_t num, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4);
+void net_wake(uint32_t events);
+void ipc_expire(void);
 
 #endif /* !JOS_KERN_SYSCALL_H */
@@ -14,6 +14,7 @@
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
 #include <kern/time.h>
+#include <kern/net.h>
 
 /* For debugging, so print_trapframe can distinguish between printing
  * a saved trapframe and printing the current trapframe and print some
@@ -217,8 +218,10 @@ trap_dispatch(struct Trapframe *tf)
 	// interrupt using lapic_eoi() before calling the scheduler!
 	// LAB 4: Your code here.
 	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TIMER) {
-		if (cpunum() == bootcpu->cpu_id)
+		if (cpunum() == bootcpu->cpu_id) {
 			time_tick();
+			ipc_expire();
+		}
 		lapic_eoi();
 		sched_yield();
 	}
@@ -239,6 +242,12 @@ trap_dispatch(struct Trapframe *tf)
 		return;
 	}
 
+	// Network interrupts wake up environments in sys_net_wait.
+	if (net_irq && tf->tf_trapno == IRQ_OFFSET + net_irq) {
+		net_intr();
+		return;
+	}
+
 	// Unexpected trap: The user process or the kernel has a bug.
 	print_trapframe(tf);
 	if (tf->tf_cs == GD_KT)
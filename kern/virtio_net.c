@@ -0,0 +1,633 @@
+#include <kern/virtio_net.h>
+#include <kern/pmap.h>
+#include <kern/pci.h>
+#include <kern/syscall.h>
+#include <inc/x86.h>
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/error.h>
+
+// Legacy virtio-net, as QEMU's virtio-net-pci presents it.
+//
+// Queue 0 receives and queue 1 sends.  Every packet is a chain of
+// descriptors: its struct virtio_net_hdr, then the data.  Receive
+// buffers are runs of pages laid out like the e1000's, long enough for
+// NET_FRAME_MAX, so that packets can be handed out by mapping the
+// pages; buffer i always takes the VNET_RX_DESCS descriptors from
+// VNET_RX_DESCS * i on.  Transmit chains come off a free list linked
+// through the descriptors' next fields.  The device is told about new buffers
+// once per batch, and not at all while it says it is looking anyway;
+// likewise it interrupts only when sys_net_wait callers would block,
+// as with the e1000's polling.
+
+static uint32_t vnet_io;
+static uint32_t vnet_features;
+
+#define VQ_MAX		256
+#define VQ_RX		0
+#define VQ_TX		1
+
+struct virtq {
+	uint16_t num;
+	struct vring_desc *desc;
+	struct vring_avail *avail;
+	struct vring_used *used;
+	uint16_t last_used;		/* next used entry to look at */
+	uint16_t free_head, nfree;	/* free descriptors */
+};
+
+/* The rings must be physically contiguous, which only the kernel image
+ * is.  */
+static uint8_t vq_mem[2][VRING_SIZE(VQ_MAX)]
+	__attribute__((aligned(VIRTIO_PCI_VRING_ALIGN)));
+static struct virtq vqs[2];
+
+/* Receive buffer i's pages, and the header the device writes for it.  */
+#define VNET_RX_PAGES	RX_PKT_PAGES(NET_FRAME_MAX)
+#define VNET_RX_DESCS	(1 + VNET_RX_PAGES)
+static struct PageInfo *vnet_rx_page[VQ_MAX / VNET_RX_DESCS][VNET_RX_PAGES];
+static struct virtio_net_hdr vnet_rx_hdr[VQ_MAX / VNET_RX_DESCS];
+
+/* The header of the transmit chain starting at descriptor i, the page
+ * descriptor i holds a reference to, if any, and descriptor i's buffer
+ * for copied packets, TX_BUFFERS(length) of which hold one.  vnet_tx_seq counts packets queued,
+ * vnet_tx_done packets the device is done with, which it is in
+ * order.  */
+#define TX_BUFFERS_PER_PAGE	(PGSIZE / TX_BUFFER_SIZE)
+static struct virtio_net_hdr vnet_tx_hdr[VQ_MAX];
+static struct PageInfo *vnet_tx_pages[VQ_MAX];
+static uint8_t *vnet_tx_buffer[VQ_MAX];
+static uint32_t vnet_tx_seq, vnet_tx_done;
+
+static inline void
+mb(void)
+{
+	asm volatile("lock; addl $0, 0(%%esp)" : : : "memory");
+}
+
+static inline void
+barrier(void)
+{
+	asm volatile("" : : : "memory");
+}
+
+static uint16_t vq_used_idx(struct virtq *vq)
+{
+	return *(volatile uint16_t *) &vq->used->idx;
+}
+
+// The size of queue q, or 0 if the device has none we can take.
+static uint16_t vq_num(int q)
+{
+	uint16_t num;
+
+	outw(vnet_io + VIRTIO_PCI_QUEUE_SEL, q);
+	num = inw(vnet_io + VIRTIO_PCI_QUEUE_NUM);
+	return num > VQ_MAX || num % VNET_RX_DESCS ? 0 : num;
+}
+
+static void vq_init(int q)
+{
+	struct virtq *vq = &vqs[q];
+	uint16_t num = vq_num(q);
+
+	memset(vq_mem[q], 0, VRING_SIZE(num));
+	vq->num = num;
+	vq->desc = (struct vring_desc *) vq_mem[q];
+	vq->avail = (struct vring_avail *) &vq->desc[num];
+	vq->used = (struct vring_used *) (vq_mem[q] + VRING_USED_OFF(num));
+	vq->last_used = 0;
+	for (uint16_t i = 0; i < num; i++)
+		vq->desc[i].next = (i + 1) % num;
+	vq->free_head = 0;
+	vq->nfree = num;
+	outl(vnet_io + VIRTIO_PCI_QUEUE_PFN,
+	     PADDR(vq_mem[q]) >> VIRTIO_PCI_QUEUE_ADDR_SHIFT);
+}
+
+// Make the chains put in queue q's available ring up to 'idx' visible
+// to the device, and tell it about them unless it does not want to be.
+static void vq_publish(int q, uint16_t idx)
+{
+	barrier();
+	vqs[q].avail->idx = idx;
+	mb();
+	if (!(*(volatile uint16_t *) &vqs[q].used->flags
+	      & VRING_USED_F_NO_NOTIFY))
+		outw(vnet_io + VIRTIO_PCI_QUEUE_NOTIFY, q);
+}
+
+// Ask queue q for interrupts, or not.  Whether one is asked for takes
+// effect before anything the device does next is looked at.
+static void vq_intr(int q, bool on)
+{
+	if (on)
+		vqs[q].avail->flags &= ~VRING_AVAIL_F_NO_INTERRUPT;
+	else
+		vqs[q].avail->flags |= VRING_AVAIL_F_NO_INTERRUPT;
+	mb();
+}
+
+// Take a chain of n descriptors off the transmit queue's free list.
+// Returns the first.
+static uint16_t vq_chain(struct virtq *vq, int n)
+{
+	uint16_t head = vq->free_head, d = head;
+
+	for (int i = 1; i < n; i++)
+		d = vq->desc[d].next;
+	vq->free_head = vq->desc[d].next;
+	vq->nfree -= n;
+	return head;
+}
+
+/* Put the chains the device is done sending back on the free list,
+ * dropping the page references they hold.  */
+static void vnet_tx_reclaim(void)
+{
+	struct virtq *vq = &vqs[VQ_TX];
+	uint16_t head, d;
+
+	while (vq->last_used != vq_used_idx(vq)) {
+		head = vq->used->ring[vq->last_used % vq->num].id;
+		for (d = head; ; d = vq->desc[d].next) {
+			if (vnet_tx_pages[d]) {
+				page_decref(vnet_tx_pages[d]);
+				vnet_tx_pages[d] = NULL;
+			}
+			vq->nfree++;
+			if (!(vq->desc[d].flags & VRING_DESC_F_NEXT))
+				break;
+		}
+		vq->desc[d].next = vq->free_head;
+		vq->free_head = head;
+		vq->last_used++;
+		vnet_tx_done++;
+	}
+}
+
+/* Descriptors a copy of a 'length'-byte packet takes */
+#define VNET_TX_COPY_DESCS(length)	(1 + TX_BUFFERS(length))
+
+/* Take a chain for, and fill it in to send a copy of, the 'length'-byte
+ * packet, with nothing for the device to do to it.  Returns the head of
+ * the chain.  */
+static uint16_t vnet_tx_copy(const uint8_t *packet, size_t length)
+{
+	struct virtq *vq = &vqs[VQ_TX];
+	uint16_t head = vq_chain(vq, VNET_TX_COPY_DESCS(length)), d = head;
+	size_t n;
+
+	memset(&vnet_tx_hdr[head], 0, sizeof(vnet_tx_hdr[head]));
+	vq->desc[head].addr = PADDR(&vnet_tx_hdr[head]);
+	vq->desc[head].len = sizeof(vnet_tx_hdr[head]);
+	vq->desc[head].flags = VRING_DESC_F_NEXT;
+	do {
+		d = vq->desc[d].next;
+		n = MIN(length, TX_BUFFER_SIZE);
+		memcpy(vnet_tx_buffer[d], packet, n);
+		vq->desc[d].addr = PADDR(vnet_tx_buffer[d]);
+		vq->desc[d].len = n;
+		packet += n;
+		length -= n;
+		vq->desc[d].flags = length > 0 ? VRING_DESC_F_NEXT : 0;
+	} while (length > 0);
+	return head;
+}
+
+static size_t vnet_tx(const void *packet, size_t length)
+{
+	struct virtq *vq = &vqs[VQ_TX];
+	uint16_t idx = vq->avail->idx, head;
+
+	length = MIN(length, NET_FRAME_MAX);
+	vnet_tx_reclaim();
+	if (vq->nfree < VNET_TX_COPY_DESCS(length))
+		return 0;
+	head = vnet_tx_copy(packet, length);
+	vq->avail->ring[idx++ % vq->num] = head;
+	vnet_tx_seq++;
+	vq_publish(VQ_TX, idx);
+	return length;
+}
+
+/* Copy up to 'n' packets from pkts[] into the transmit queue, as many
+ * as there is room for, and tell the device once.  Each packet must fit
+ * in NET_FRAME_MAX.  Returns the number of packets queued.  */
+static int vnet_tx_batch(const struct net_sg *pkts, int n)
+{
+	struct virtq *vq = &vqs[VQ_TX];
+	uint16_t idx = vq->avail->idx, head;
+	int i;
+
+	vnet_tx_reclaim();
+	for (i = 0; i < n
+		    && vq->nfree >= VNET_TX_COPY_DESCS(pkts[i].sg_len); i++) {
+		head = vnet_tx_copy(pkts[i].sg_va, pkts[i].sg_len);
+		vq->avail->ring[idx++ % vq->num] = head;
+		vnet_tx_seq++;
+	}
+	if (i > 0)
+		vq_publish(VQ_TX, idx);
+	return i;
+}
+
+/* Where byte 'pos' of the packet in frags is.  */
+static uint8_t *frags_byte(const struct tx_frag *frags, int n, size_t pos)
+{
+	for (int i = 0; i < n; pos -= frags[i].len, i++)
+		if (pos < frags[i].len)
+			return (uint8_t *) page2kva(frags[i].pp) + frags[i].off
+				+ pos;
+	panic("frags_byte: %u past the end", pos);
+}
+
+/* The Internet checksum of bytes start up to end of the packet in
+ * frags.  */
+static uint16_t frags_csum(const struct tx_frag *frags, int n,
+			   size_t start, size_t end)
+{
+	uint32_t sum = 0;
+	size_t pos = 0, j;
+	const uint8_t *p;
+
+	for (int i = 0; i < n && pos < end; pos += frags[i].len, i++) {
+		p = (uint8_t *) page2kva(frags[i].pp) + frags[i].off;
+		for (j = 0; j < frags[i].len; j++)
+			if (pos + j >= start && pos + j < end)
+				sum += (pos + j - start) % 2 ? p[j] : p[j] << 8;
+	}
+	while (sum >> 16)
+		sum = (sum & 0xFFFF) + (sum >> 16);
+	return ~sum;
+}
+
+static void frags_put16(const struct tx_frag *frags, int n, size_t pos,
+			uint16_t v)
+{
+	*frags_byte(frags, n, pos) = v >> 8;
+	*frags_byte(frags, n, pos + 1) = v;
+}
+
+/* Set up hdr for what off asks of the device, for the 'length'-byte
+ * packet in frags, and do in software what the device cannot: the IP
+ * header checksum always, the TCP or UDP one if the device does no
+ * checksums.  */
+static void vnet_tx_offload(struct virtio_net_hdr *hdr,
+			    const struct tx_frag *frags, int n,
+			    const struct net_offload *off, size_t length)
+{
+	uint32_t sum;
+	uint16_t csum;
+
+	if (off->no_flags & NET_CSUM_IP) {
+		frags_put16(frags, n, off->no_iphdr + 10, 0);
+		frags_put16(frags, n, off->no_iphdr + 10,
+			    frags_csum(frags, n, off->no_iphdr, off->no_l4hdr));
+	}
+	if (!(off->no_flags & NET_CSUM_L4))
+		return;
+	if (vnet_features & VIRTIO_NET_F_CSUM) {
+		// The field holds the pseudo-header sum the device adds to.
+		hdr->flags = VIRTIO_NET_HDR_F_NEEDS_CSUM;
+		hdr->csum_start = off->no_l4hdr;
+		hdr->csum_offset = off->no_l4csum - off->no_l4hdr;
+	} else {
+		csum = frags_csum(frags, n, off->no_l4hdr, length);
+		// 0 means no checksum at all to UDP, IP protocol 17
+		if (csum == 0 && *frags_byte(frags, n, off->no_iphdr + 9) == 17)
+			csum = 0xFFFF;
+		frags_put16(frags, n, off->no_l4csum, csum);
+	}
+	if (off->no_flags & NET_TSO) {
+		// The seed leaves the TCP length out, as the e1000 wants;
+		// the device here wants the whole packet's in it.
+		sum = *frags_byte(frags, n, off->no_l4csum) << 8
+			| *frags_byte(frags, n, off->no_l4csum + 1);
+		sum += length - off->no_l4hdr;
+		while (sum >> 16)
+			sum = (sum & 0xFFFF) + (sum >> 16);
+		frags_put16(frags, n, off->no_l4csum, sum);
+		hdr->gso_type = VIRTIO_NET_HDR_GSO_TCPV4;
+		hdr->hdr_len = off->no_hdrlen;
+		hdr->gso_size = off->no_mss;
+	}
+}
+
+/* Queue one packet made of the 'n' pieces in frags, each within a page,
+ * with one descriptor per piece pointing at the page itself, like
+ * e1000_tx_frags.  */
+static size_t vnet_tx_frags(const struct tx_frag *frags, int n,
+			    const struct net_offload *off, uint32_t *seq)
+{
+	struct virtq *vq = &vqs[VQ_TX];
+	uint16_t idx = vq->avail->idx, head, d;
+	size_t length = 0;
+
+	vnet_tx_reclaim();
+	if (n <= 0 || vq->nfree < n + 1)
+		return 0;
+	for (int i = 0; i < n; i++)
+		length += frags[i].len;
+	head = vq_chain(vq, n + 1);
+	memset(&vnet_tx_hdr[head], 0, sizeof(vnet_tx_hdr[head]));
+	if (off)
+		vnet_tx_offload(&vnet_tx_hdr[head], frags, n, off, length);
+	vq->desc[head].addr = PADDR(&vnet_tx_hdr[head]);
+	vq->desc[head].len = sizeof(vnet_tx_hdr[head]);
+	vq->desc[head].flags = VRING_DESC_F_NEXT;
+	d = head;
+	for (int i = 0; i < n; i++) {
+		d = vq->desc[d].next;
+		vq->desc[d].addr = page2pa(frags[i].pp) + frags[i].off;
+		vq->desc[d].len = frags[i].len;
+		vq->desc[d].flags = i < n - 1 ? VRING_DESC_F_NEXT : 0;
+		frags[i].pp->pp_ref++;
+		vnet_tx_pages[d] = frags[i].pp;
+	}
+	vq->avail->ring[idx++ % vq->num] = head;
+	*seq = vnet_tx_seq++;
+	vq_publish(VQ_TX, idx);
+	return length;
+}
+
+static uint32_t vnet_tx_done_count(void)
+{
+	vnet_tx_reclaim();
+	return vnet_tx_done;
+}
+
+/* Look at the next received packet on the queue, leaving it there.
+ * Returns its buffer, and its length in *length, or -1 if there is
+ * none.  */
+static int vnet_rx_peek(size_t *length)
+{
+	struct virtq *vq = &vqs[VQ_RX];
+	struct vring_used_elem *e;
+
+	if (vq->last_used == vq_used_idx(vq))
+		return -1;
+	e = &vq->used->ring[vq->last_used % vq->num];
+	*length = MIN(e->len - MIN(e->len, sizeof(struct virtio_net_hdr)),
+		      NET_FRAME_MAX);
+	return e->id / VNET_RX_DESCS;
+}
+
+/* Split the 'length'-byte packet in receive buffer i at page
+ * boundaries.  Returns the number of pieces.  */
+static int vnet_rx_frags(int i, size_t length, struct tx_frag *frags)
+{
+	size_t off = RX_PKT_OFFSET;
+	int n;
+
+	for (n = 0; length > 0; n++, off = 0) {
+		frags[n].pp = vnet_rx_page[i][n];
+		frags[n].off = off;
+		frags[n].len = MIN(length, PGSIZE - off);
+		length -= frags[n].len;
+	}
+	return n;
+}
+
+/* Which checksums of the 'length'-byte packet in receive buffer i the
+ * device found good, as NET_CSUM_* bits.  One it left for us to fill
+ * in, as it may for packets from this host, is filled in here.  */
+static int vnet_rx_csum(int i, size_t length)
+{
+	struct virtio_net_hdr *hdr = &vnet_rx_hdr[i];
+	struct tx_frag pkt[VNET_RX_PAGES];
+	int n = vnet_rx_frags(i, length, pkt);
+
+	if ((hdr->flags & VIRTIO_NET_HDR_F_NEEDS_CSUM)
+	    && hdr->csum_start + hdr->csum_offset + 2 <= length) {
+		frags_put16(pkt, n, hdr->csum_start + hdr->csum_offset,
+			    frags_csum(pkt, n, hdr->csum_start, length));
+		return NET_CSUM_L4;
+	}
+	return hdr->flags & VIRTIO_NET_HDR_F_DATA_VALID ? NET_CSUM_L4 : 0;
+}
+
+/* Frames longer than RX_BUFFER_SIZE are cut short.  */
+static size_t vnet_rx(uint8_t *buffer)
+{
+	struct virtq *vq = &vqs[VQ_RX];
+	uint16_t idx = vq->avail->idx;
+	size_t length;
+	int i;
+
+	if ((i = vnet_rx_peek(&length)) < 0)
+		return 0;
+	vq->last_used++;
+	vnet_rx_csum(i, length);
+	length = MIN(length, RX_BUFFER_SIZE);
+	_Static_assert(RX_BUFFER_SIZE <= PGSIZE - RX_PKT_OFFSET);
+	memcpy(buffer, (char *) page2kva(vnet_rx_page[i][0]) + RX_PKT_OFFSET,
+	       length);
+	vq->avail->ring[idx++ % vq->num] = VNET_RX_DESCS * i;
+	vq_publish(VQ_RX, idx);
+	return length;
+}
+
+// Take received packets off the queue without copying them, up to
+// 'max' pages of them, like e1000_rx_pages, and give the device fresh
+// pages in their place in one go.  Only the pages a packet fills are
+// handed out and replaced.
+static int vnet_rx_pages(struct PageInfo **pps, int max)
+{
+	struct virtq *vq = &vqs[VQ_RX];
+	uint16_t idx = vq->avail->idx;
+	struct PageInfo *fresh[VNET_RX_PAGES];
+	size_t length;
+	int n, i, j, npages, csum;
+
+	for (n = 0; n < max; n += npages) {
+		if ((i = vnet_rx_peek(&length)) < 0)
+			break;
+		npages = RX_PKT_PAGES(length);
+		if (npages > max) {
+			// It would never fit; drop it.
+			vq->last_used++;
+			vq->avail->ring[idx++ % vq->num] = VNET_RX_DESCS * i;
+			npages = 0;
+			continue;
+		}
+		if (n + npages > max)
+			break;
+		for (j = 0; j < npages; j++) {
+			if (!(fresh[j] = page_alloc(0)))
+				break;
+			fresh[j]->pp_ref++;
+		}
+		if (j < npages) {
+			while (j-- > 0)
+				page_decref(fresh[j]);
+			if (n == 0 && idx == vq->avail->idx)
+				return -E_NO_MEM;
+			break;
+		}
+		vq->last_used++;
+
+		csum = vnet_rx_csum(i, length);
+		for (j = 0; j < npages; j++) {
+			pps[n + j] = vnet_rx_page[i][j];
+			vnet_rx_page[i][j] = fresh[j];
+			vq->desc[VNET_RX_DESCS * i + 1 + j].addr =
+				page2pa(fresh[j]) + (j ? 0 : RX_PKT_OFFSET);
+		}
+		net_rx_pkt_init(pps + n, length, csum);
+		vq->avail->ring[idx++ % vq->num] = VNET_RX_DESCS * i;
+	}
+	if (idx != vq->avail->idx)
+		vq_publish(VQ_RX, idx);
+	return n;
+}
+
+static bool vnet_rx_ready(void)
+{
+	return vqs[VQ_RX].last_used != vq_used_idx(&vqs[VQ_RX]);
+}
+
+static bool vnet_tx_ready(void)
+{
+	vnet_tx_reclaim();
+	return vqs[VQ_TX].nfree >= VNET_TX_COPY_DESCS(NET_FRAME_MAX);
+}
+
+// Return which of the NET_WAIT_* 'events' have already happened.
+// Those that have not get their queue's interrupts turned back on, and
+// are looked at again in case the device got there first.
+static uint32_t vnet_ready(uint32_t events)
+{
+	uint32_t ready = 0;
+
+	if (events & NET_WAIT_RX) {
+		if (!vnet_rx_ready())
+			vq_intr(VQ_RX, true);
+		if (vnet_rx_ready())
+			ready |= NET_WAIT_RX;
+	}
+	if (events & NET_WAIT_TX) {
+		if (!vnet_tx_ready())
+			vq_intr(VQ_TX, true);
+		if (vnet_tx_ready())
+			ready |= NET_WAIT_TX;
+	}
+	return ready;
+}
+
+// Interrupt handler.  Reading the ISR acknowledges the interrupt.  A
+// queue with something to look at stops interrupting until vnet_ready
+// finds it drained.
+static void vnet_intr(void)
+{
+	uint32_t events = 0;
+
+	if (!(inb(vnet_io + VIRTIO_PCI_ISR) & VIRTIO_PCI_ISR_QUEUE))
+		return;
+	if (vnet_rx_ready()) {
+		vq_intr(VQ_RX, false);
+		events |= NET_WAIT_RX;
+	}
+	if (vnet_tx_ready()) {
+		vq_intr(VQ_TX, false);
+		events |= NET_WAIT_TX;
+	}
+	if (events)
+		net_wake(events);
+}
+
+static struct net_driver vnet_driver = {
+	.nd_name = "virtio-net",
+	.nd_tx = vnet_tx,
+	.nd_tx_batch = vnet_tx_batch,
+	.nd_tx_frags = vnet_tx_frags,
+	.nd_tx_done = vnet_tx_done_count,
+	.nd_rx = vnet_rx,
+	.nd_rx_pages = vnet_rx_pages,
+	.nd_ready = vnet_ready,
+	.nd_intr = vnet_intr,
+};
+
+int
+pci_virtio_net_attach(struct pci_func *f)
+{
+	struct virtq *vq;
+	uint32_t host;
+	int i, j, d;
+
+	pci_func_enable(f);
+	vnet_io = f->reg_base[0];
+	outb(vnet_io + VIRTIO_PCI_STATUS, 0);
+	if (!vq_num(VQ_RX) || !vq_num(VQ_TX))
+		return -E_NOT_SUPP;
+	if (!net_attach(&vnet_driver, f->irq_line))
+		return 0;
+	outb(vnet_io + VIRTIO_PCI_STATUS, VIRTIO_CONFIG_S_ACKNOWLEDGE);
+	outb(vnet_io + VIRTIO_PCI_STATUS,
+	     VIRTIO_CONFIG_S_ACKNOWLEDGE | VIRTIO_CONFIG_S_DRIVER);
+
+	// Segmentation needs the device to do checksums too.
+	host = inl(vnet_io + VIRTIO_PCI_HOST_FEATURES);
+	vnet_features = host & (VIRTIO_NET_F_CSUM | VIRTIO_NET_F_GUEST_CSUM
+				| VIRTIO_NET_F_MAC | VIRTIO_NET_F_HOST_TSO4);
+	if (!(vnet_features & VIRTIO_NET_F_CSUM))
+		vnet_features &= ~VIRTIO_NET_F_HOST_TSO4;
+	outl(vnet_io + VIRTIO_PCI_GUEST_FEATURES, vnet_features);
+	vnet_driver.nd_offloads = NET_CSUM_IP | NET_CSUM_L4;
+	if (vnet_features & VIRTIO_NET_F_HOST_TSO4)
+		vnet_driver.nd_offloads |= NET_TSO;
+
+	vq_init(VQ_RX);
+	vq_init(VQ_TX);
+
+	vq = &vqs[VQ_RX];
+	for (i = 0; i < vq->num / VNET_RX_DESCS; i++) {
+		d = VNET_RX_DESCS * i;
+		vq->desc[d].addr = PADDR(&vnet_rx_hdr[i]);
+		vq->desc[d].len = sizeof(vnet_rx_hdr[i]);
+		vq->desc[d].flags = VRING_DESC_F_WRITE | VRING_DESC_F_NEXT;
+		vq->desc[d].next = d + 1;
+		for (j = 0; j < VNET_RX_PAGES; j++) {
+			if (!(vnet_rx_page[i][j] = page_alloc(0)))
+				panic("pci_virtio_net_attach: out of memory");
+			vnet_rx_page[i][j]->pp_ref++;
+			d++;
+			vq->desc[d].addr = page2pa(vnet_rx_page[i][j])
+				+ (j ? 0 : RX_PKT_OFFSET);
+			vq->desc[d].len = PGSIZE - (j ? 0 : RX_PKT_OFFSET);
+			vq->desc[d].flags = VRING_DESC_F_WRITE;
+			if (j < VNET_RX_PAGES - 1) {
+				vq->desc[d].flags |= VRING_DESC_F_NEXT;
+				vq->desc[d].next = d + 1;
+			}
+		}
+		vq->avail->ring[i] = VNET_RX_DESCS * i;
+	}
+	vq->nfree = 0;
+
+	vq = &vqs[VQ_TX];
+	for (i = 0; i < vq->num; i++) {
+		if (i % TX_BUFFERS_PER_PAGE == 0) {
+			struct PageInfo *pp = page_alloc(0);
+
+			if (!pp)
+				panic("pci_virtio_net_attach: out of memory");
+			pp->pp_ref++;
+			vnet_tx_buffer[i] = page2kva(pp);
+		} else
+			vnet_tx_buffer[i] = vnet_tx_buffer[i - 1]
+				+ TX_BUFFER_SIZE;
+	}
+
+	outb(vnet_io + VIRTIO_PCI_STATUS, VIRTIO_CONFIG_S_ACKNOWLEDGE
+	     | VIRTIO_CONFIG_S_DRIVER | VIRTIO_CONFIG_S_DRIVER_OK);
+	vq_publish(VQ_RX, vqs[VQ_RX].num / VNET_RX_DESCS);
+
+	cprintf("virtio-net: features %x", vnet_features);
+	if (vnet_features & VIRTIO_NET_F_MAC)
+		for (i = 0; i < 6; i++)
+			cprintf("%c%02x", i ? ':' : ' ', inb(vnet_io
+				+ VIRTIO_PCI_CONFIG + VIRTIO_NET_CONFIG_MAC + i));
+	cprintf("\n");
+	return 1;
+}
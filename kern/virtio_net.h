@@ -0,0 +1,105 @@
+#ifndef JOS_KERN_VIRTIO_NET_H
+#define JOS_KERN_VIRTIO_NET_H
+
+#include <inc/types.h>
+#include <kern/pci.h>
+#include <kern/net.h>
+
+/* Legacy virtio PCI: registers at offsets into I/O BAR 0.
+ *
+ * The device's config space follows the common registers, as long as
+ * MSI-X is off, which it always is here.
+ */
+#define VIRTIO_PCI_HOST_FEATURES	0x00	/* 32 bits, RO */
+#define VIRTIO_PCI_GUEST_FEATURES	0x04	/* 32 bits, RW */
+#define VIRTIO_PCI_QUEUE_PFN		0x08	/* 32 bits, RW */
+#define VIRTIO_PCI_QUEUE_NUM		0x0C	/* 16 bits, RO */
+#define VIRTIO_PCI_QUEUE_SEL		0x0E	/* 16 bits, RW */
+#define VIRTIO_PCI_QUEUE_NOTIFY		0x10	/* 16 bits, RW */
+#define VIRTIO_PCI_STATUS		0x12	/* 8 bits, RW */
+#define VIRTIO_PCI_ISR			0x13	/* 8 bits, R/clr */
+#define VIRTIO_PCI_CONFIG		0x14
+
+#define VIRTIO_PCI_QUEUE_ADDR_SHIFT	12
+#define VIRTIO_PCI_VRING_ALIGN		4096
+
+/* VIRTIO_PCI_STATUS */
+#define VIRTIO_CONFIG_S_ACKNOWLEDGE	0x01
+#define VIRTIO_CONFIG_S_DRIVER		0x02
+#define VIRTIO_CONFIG_S_DRIVER_OK	0x04
+#define VIRTIO_CONFIG_S_FAILED		0x80
+
+/* VIRTIO_PCI_ISR */
+#define VIRTIO_PCI_ISR_QUEUE		0x01
+#define VIRTIO_PCI_ISR_CONFIG		0x02
+
+/* Feature bits */
+#define VIRTIO_NET_F_CSUM		(1 << 0)   /* host does partial csum */
+#define VIRTIO_NET_F_GUEST_CSUM		(1 << 1)   /* guest may skip csum */
+#define VIRTIO_NET_F_MAC		(1 << 5)   /* config has the MAC */
+#define VIRTIO_NET_F_HOST_TSO4		(1 << 11)  /* host splits TCPv4 */
+
+/* Device config, at VIRTIO_PCI_CONFIG */
+#define VIRTIO_NET_CONFIG_MAC		0x00	/* 6 bytes */
+
+/* Virtqueues */
+struct vring_desc {
+	uint64_t addr;
+	uint32_t len;
+	uint16_t flags;
+	uint16_t next;
+};
+#define VRING_DESC_F_NEXT		1
+#define VRING_DESC_F_WRITE		2
+
+struct vring_avail {
+	uint16_t flags;
+	uint16_t idx;
+	uint16_t ring[];
+};
+#define VRING_AVAIL_F_NO_INTERRUPT	1
+
+struct vring_used_elem {
+	uint32_t id;
+	uint32_t len;
+};
+
+struct vring_used {
+	uint16_t flags;
+	uint16_t idx;
+	struct vring_used_elem ring[];
+};
+#define VRING_USED_F_NO_NOTIFY		1
+
+/* Bytes a queue of 'num' descriptors takes: descriptors and the
+ * available ring, then on a page boundary the used ring.  */
+#define VRING_ALIGN(x) \
+	(((x) + VIRTIO_PCI_VRING_ALIGN - 1) & ~(VIRTIO_PCI_VRING_ALIGN - 1))
+#define VRING_USED_OFF(num) \
+	VRING_ALIGN(sizeof(struct vring_desc) * (num) \
+		    + sizeof(uint16_t) * (3 + (num)))
+#define VRING_SIZE(num) \
+	(VRING_USED_OFF(num) \
+	 + VRING_ALIGN(sizeof(uint16_t) * 3 \
+		       + sizeof(struct vring_used_elem) * (num)))
+
+/* Each packet, both ways, comes after one of these, in a descriptor of
+ * its own */
+struct virtio_net_hdr {
+	uint8_t flags;
+	uint8_t gso_type;
+	uint16_t hdr_len;	/* ethernet, IP and TCP headers */
+	uint16_t gso_size;	/* bytes of data in each segment */
+	uint16_t csum_start;
+	uint16_t csum_offset;	/* from csum_start */
+};
+#define VIRTIO_NET_HDR_F_NEEDS_CSUM	1	/* fill in csum_start etc. */
+#define VIRTIO_NET_HDR_F_DATA_VALID	2	/* checksum is good */
+#define VIRTIO_NET_HDR_GSO_NONE		0
+#define VIRTIO_NET_HDR_GSO_TCPV4	1
+
+#define PCI_VENDOR_VIRTIO		0x1AF4
+#define PCI_DEVICE_VIRTIO_NET		0x1000
+int pci_virtio_net_attach(struct pci_func *f);
+
+#endif  // !JOS_KERN_VIRTIO_NET_H
@@ -261,14 +261,35 @@ int
 seek(int fdnum, off_t offset)
 {
 	int r;
+	struct Dev *dev;
 	struct Fd *fd;
 
-	if ((r = fd_lookup(fdnum, &fd)) < 0)
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
 		return r;
 	fd->fd_offset = offset;
 	return 0;
 }
 
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+		return r;
+	if (!dev->dev_sync)
+		return 0;
+	return (*dev->dev_sync)(fd);
+}
+
 int
 ftruncate(int fdnum, off_t newsize)
 {
@@ -312,7 +333,7 @@ stat(const char *path, struct Stat *stat)
 {
 	int fd, r;
 
-	if ((fd = open(path, O_RDONLY)) < 0)
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
 		return fd;
 	r = fstat(fd, stat);
 	close(fd);
@@ -1,11 +1,16 @@
 #include <inc/fs.h>
 #include <inc/string.h>
+#include <inc/x86.h>
 #include <inc/lib.h>
 
 #define debug 0
 
 union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
 
+static envid_t fsenv;
+
+static int fsipcv(unsigned type, void *dstva, int *npages);
+
 // Send an inter-environment request to the file server, and wait for
 // a reply.  The request body should be in fsipcbuf, and parts of the
 // response may be written back to fsipcbuf.
@@ -15,7 +20,16 @@ union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
 static int
 fsipc(unsigned type, void *dstva)
 {
-	static envid_t fsenv;
+	int npages = 1;
+
+	return fsipcv(type, dstva, &npages);
+}
+
+// Like fsipc, but accept up to *npages reply pages, mapped one after
+// another from dstva.  Stores the number received back in *npages.
+static int
+fsipcv(unsigned type, void *dstva, int *npages)
+{
 	if (fsenv == 0)
 		fsenv = ipc_find_env(ENV_TYPE_FS);
 
@@ -25,7 +39,58 @@ fsipc(unsigned type, void *dstva)
 		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
 
 	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
-	return ipc_recv(NULL, dstva, NULL);
+	return ipc_recvv(NULL, dstva, npages, NULL);
+}
+
+// Send the request in fsipcbuf to the file server together with the
+// pages holding buf[0..n), with permissions perm, so that the data
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+	int npages;
+
+	if (fsenv == 0)
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+	npages = 1;
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+		pages[npages++] = va | perm;
+	assert(npages <= ARRAY_SIZE(pages));
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+	return ipc_recv(NULL, NULL, NULL);
+}
+
+// Send a bulk read or write request for the open file fileid, moving
+// the data through buf's own pages as fsipc_pages.
+static int
+fsipc_bulk(unsigned type, int fileid, const void *buf, size_t n, int perm)
+{
+	fsipcbuf.bulk.req_fileid = fileid;
+	fsipcbuf.bulk.req_n = n;
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+	return fsipc_pages(type, buf, n, perm);
+}
+
+// Make the pages holding buf[0..n) writable by the file server, by
+// writing to each one, which breaks up any copy-on-write sharing.
+static void
+fsipc_touch(void *buf, size_t n)
+{
+	char *p;
+
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+		*(volatile char *) p = *(volatile char *) p;
 }
 
 static int devfile_flush(struct Fd *fd);
@@ -33,6 +98,7 @@ static ssize_t devfile_read(struct Fd *fd, void *buf, size_t n);
 static ssize_t devfile_write(struct Fd *fd, const void *buf, size_t n);
 static int devfile_stat(struct Fd *fd, struct Stat *stat);
 static int devfile_trunc(struct Fd *fd, off_t newsize);
+static int devfile_sync(struct Fd *fd);
 
 struct Dev devfile =
 {
@@ -42,9 +108,24 @@ struct Dev devfile =
 	.dev_close =	devfile_flush,
 	.dev_stat =	devfile_stat,
 	.dev_write =	devfile_write,
-	.dev_trunc =	devfile_trunc
+	.dev_trunc =	devfile_trunc,
+	.dev_sync =	devfile_sync
 };
 
+// Client-side buffering.
+//
+// Unless opened with O_NOBUF, a file gets a one-page buffer at
+// fd2data(fd), so that small reads and writes do not each cost a round
+// trip to the file server.  The buffer holds either data read ahead
+// from the file, or data written but not yet sent, never both.  Its
+// state lives in the Fd page and the page itself is mapped PTE_SHARE,
+// so environments that share the file descriptor share the buffer too,
+// and nothing is written twice after a fork.  Pending writes go out on
+// seek, fsync, close, stat, truncate and mmap, and before any read.
+// Read-ahead data may be stale if another open of the same file writes
+// it; use O_NOBUF where that matters.
+#define FILEBUF_SIZE	PGSIZE
+
 // Open a file (or directory).
 //
 // Returns:
@@ -85,6 +166,11 @@ open(const char *path, int mode)
 		return r;
 	}
 
+	// Without a buffer page the file just goes unbuffered.
+	if (!(mode & O_NOBUF)
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+		fd->fd_file.buffered = 1;
+
 	return fd2num(fd);
 }
 
@@ -99,17 +185,19 @@ open(const char *path, int mode)
 static int
 devfile_flush(struct Fd *fd)
 {
+	int r;
+
+	r = devfile_sync(fd);
+	if (fd->fd_file.buffered)
+		sys_page_unmap(0, fd2data(fd));
 	fsipcbuf.flush.req_fileid = fd->fd_file.id;
-	return fsipc(FSREQ_FLUSH, NULL);
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
 }
 
-// Read at most 'n' bytes from 'fd' at the current position into 'buf'.
-//
-// Returns:
-// 	The number of bytes successfully read.
-// 	< 0 on error.
+// Read at most 'n' bytes from 'fd' at the current position into 'buf',
+// going to the file server.
 static ssize_t
-devfile_read(struct Fd *fd, void *buf, size_t n)
+file_read_direct(struct Fd *fd, void *buf, size_t n)
 {
 	// Make an FSREQ_READ request to the file system server after
 	// filling fsipcbuf.read with the request arguments.  The
@@ -117,6 +205,14 @@ devfile_read(struct Fd *fd, void *buf, size_t n)
 	// system server.
 	int r;
 
+	// Reads of more than a page go straight into buf's own pages.
+	if (n > PGSIZE) {
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+		fsipc_touch(buf, n);
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+				  PTE_P | PTE_W | PTE_U);
+	}
+
 	fsipcbuf.read.req_fileid = fd->fd_file.id;
 	fsipcbuf.read.req_n = n;
 	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
@@ -127,20 +223,24 @@ devfile_read(struct Fd *fd, void *buf, size_t n)
 	return r;
 }
 
-
-// Write at most 'n' bytes from 'buf' to 'fd' at the current seek position.
-//
-// Returns:
-//	 The number of bytes successfully written.
-//	 < 0 on error.
+// Write at most 'n' bytes from 'buf' to 'fd' at the current seek
+// position, going to the file server.
 static ssize_t
-devfile_write(struct Fd *fd, const void *buf, size_t n)
+file_write_direct(struct Fd *fd, const void *buf, size_t n)
 {
 	// Make an FSREQ_WRITE request to the file system server.  Be
 	// careful: fsipcbuf.write.req_buf is only so large, but
 	// remember that write is always allowed to write *fewer*
 	// bytes than requested.
 	// LAB 5: Your code here
+	//
+	// Writes that do not fit in fsipcbuf lend buf's pages to the
+	// server instead.
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+				  PTE_P | PTE_U);
+	}
 	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
 	fsipcbuf.write.req_fileid = fd->fd_file.id;
 	fsipcbuf.write.req_n = n;
@@ -148,11 +248,109 @@ devfile_write(struct Fd *fd, const void *buf, size_t n)
 	return fsipc(FSREQ_WRITE, NULL);
 }
 
+// Send the writes waiting in fd's buffer to the file server, and drop
+// any read-ahead data.  The seek position is left alone.
+static int
+devfile_sync(struct Fd *fd)
+{
+	struct FdFile *ff = &fd->fd_file;
+	char *p = fd2data(fd);
+	off_t pos = fd->fd_offset;
+	size_t done;
+	int r;
+
+	ff->buf_rlen = 0;
+	if (ff->buf_wlen == 0)
+		return 0;
+	fd->fd_offset = ff->buf_base;
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+			break;
+	ff->buf_wlen = 0;
+	fd->fd_offset = pos;
+	return r < 0 ? r : 0;
+}
+
+// Read at most 'n' bytes from 'fd' at the current position into 'buf'.
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+	struct FdFile *ff = &fd->fd_file;
+	char *p = fd2data(fd);
+	off_t pos = fd->fd_offset;
+	ssize_t r;
+
+	if (!ff->buffered)
+		return file_read_direct(fd, buf, n);
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+		return r;
+
+	// Refill the buffer when pos is not in it.  Reads at least as
+	// big as the buffer skip it.
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+		ff->buf_rlen = 0;
+		if (n >= FILEBUF_SIZE)
+			return file_read_direct(fd, buf, n);
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+			return r;
+		ff->buf_base = pos;
+		ff->buf_rlen = r;
+	}
+
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+	memmove(buf, p + (pos - ff->buf_base), n);
+	fd->fd_offset = pos + n;
+	return n;
+}
+
+// Write 'n' bytes from 'buf' to 'fd' at the current seek position.
+// Small writes are buffered, and count as written once they are.
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+	struct FdFile *ff = &fd->fd_file;
+	char *p = fd2data(fd);
+	off_t pos = fd->fd_offset;
+	int r;
+
+	if (!ff->buffered)
+		return file_write_direct(fd, buf, n);
+
+	// Only a write that carries on where the buffered ones left off,
+	// and fits, joins them.
+	ff->buf_rlen = 0;
+	if (ff->buf_wlen > 0
+	    && (pos != ff->buf_base + ff->buf_wlen
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+	    && (r = devfile_sync(fd)) < 0)
+		return r;
+	if (n >= FILEBUF_SIZE)
+		return file_write_direct(fd, buf, n);
+
+	if (ff->buf_wlen == 0)
+		ff->buf_base = pos;
+	memmove(p + ff->buf_wlen, buf, n);
+	ff->buf_wlen += n;
+	fd->fd_offset = pos + n;
+	return n;
+}
+
 static int
 devfile_stat(struct Fd *fd, struct Stat *st)
 {
 	int r;
 
+	if ((r = devfile_sync(fd)) < 0)
+		return r;
 	fsipcbuf.stat.req_fileid = fd->fd_file.id;
 	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
 		return r;
@@ -162,16 +360,376 @@ devfile_stat(struct Fd *fd, struct Stat *st)
 	return 0;
 }
 
+// Read up to n bytes of directory entries from the directory fdnum,
+// packed as struct Fsdirents, into buf.  flags may include
+// FSREADDIR_RECURSIVE to list the whole subtree.  Each call carries on
+// from where the last one stopped.
+//
+// Returns the number of bytes read, 0 at the end of the directory, or
+// < 0 on error.  Errors are:
+//	-E_NOT_SUPP if fdnum is not a file.
+//	-E_INVAL if fdnum is not a directory, or n is too small for the
+//		next entry.
+int
+readdir(int fdnum, void *buf, size_t n, int flags)
+{
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+		return -E_NOT_SUPP;
+	if ((r = devfile_sync(fd)) < 0)
+		return r;
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+	fsipcbuf.readdir.req_n = n;
+	fsipcbuf.readdir.req_flags = flags;
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+		return r;
+	assert(r <= n && r <= PGSIZE);
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+	return r;
+}
+
 // Truncate or extend an open file to 'size' bytes
 static int
 devfile_trunc(struct Fd *fd, off_t newsize)
 {
+	int r;
+
+	if ((r = devfile_sync(fd)) < 0)
+		return r;
 	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
 	fsipcbuf.set_size.req_size = newsize;
 	return fsipc(FSREQ_SET_SIZE, NULL);
 }
 
 
+// Map len bytes of the open file fdnum, starting at 'offset', at 'addr'.
+// The pages mapped are the file server's own cached copies of the file
+// blocks, so nothing is copied and everyone mapping the same file sees
+// the same pages.  MAP_SHARED mappings are read-only; MAP_PRIVATE
+// mappings with PROT_WRITE are copy-on-write.  addr and offset must be
+// page-aligned, and the range must lie within the file (rounded up to
+// a page).  Anything mapped at addr before is replaced.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NOT_SUPP if fdnum is not a file, or for writable MAP_SHARED.
+//	-E_INVAL for bad arguments, or a range past the end of the file.
+int
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset)
+{
+	struct Fd *fd;
+	size_t done;
+	int n, r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+		return -E_NOT_SUPP;
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+		return -E_NOT_SUPP;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+		return -E_INVAL;
+	if ((r = devfile_sync(fd)) < 0)
+		return r;
+
+	len = ROUNDUP(len, PGSIZE);
+	for (done = 0; done < len; done += n * PGSIZE) {
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+		fsipcbuf.map.req_offset = offset + done;
+		fsipcbuf.map.req_npages = n;
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+			munmap(addr, done);
+			return r < 0 ? r : -E_INVAL;
+		}
+	}
+
+	if (prot & PROT_WRITE)
+		for (done = 0; done < len; done += PGSIZE)
+			if ((r = cowpage(addr + done)) < 0) {
+				munmap(addr, len);
+				return r;
+			}
+	return 0;
+}
+
+// Unmap the pages covering [addr, addr+len).
+int
+munmap(void *addr, size_t len)
+{
+	uintptr_t va;
+	int r;
+
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+		return -E_INVAL;
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+			return r;
+	return 0;
+}
+
+// Asynchronous requests.
+//
+// The first fsring_* call in an environment sets up a request ring,
+// shared with the file server, at FSRING_VA.  Each posted request takes
+// one of the ring's data pages until fsring_reap hands back its result,
+// so at most FSRING_NSLOTS requests can be outstanding.  The pages are
+// mapped PTE_SHARE so that a fork cannot break the server's mapping of
+// them with copy-on-write; a child sets up a ring of its own.
+#define FSRING_VA	0xCF000000
+
+static struct Fsring *fsring = (struct Fsring *) FSRING_VA;
+static envid_t fsring_env;	// environment the ring was set up for
+static uint32_t fsring_busy;	// data pages in use, one bit each
+static struct {
+	uint32_t s_type;
+	uint32_t s_tag;
+	void *s_buf;		// where to put what a read or stat returns
+} fsring_slots[FSRING_NSLOTS];
+
+static int
+fsring_setup(void)
+{
+	uintptr_t pages[1 + FSRING_NPAGES];
+	int i, r;
+
+	static_assert(FSRING_NSLOTS <= 32);
+
+	if (fsring_env == thisenv->env_id)
+		return 0;
+	if (fsenv == 0)
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+	for (i = 0; i < FSRING_NPAGES; i++) {
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+					PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+			return r;
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+	}
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+		return r;
+	fsring_env = thisenv->env_id;
+	fsring_busy = 0;
+	return 0;
+}
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+	sqe->sqe_type = type;
+	sqe->sqe_fileid = fd->fd_file.id;
+	sqe->sqe_offset = offset;
+	sqe->sqe_n = n;
+	sqe->sqe_slot = slot;
+
+	// The server works until the ring is empty, so it only needs
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+	if (fsring->r_sqhead == tail)
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+			return slot;
+	return -E_NO_MEM;
+}
+
+// Start reading up to n bytes (at most a page) at 'offset' of fdnum into
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+	fsring_slots[slot].s_type = FSREQ_READ;
+	fsring_slots[slot].s_tag = tag;
+	fsring_slots[slot].s_buf = buf;
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+}
+
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+	fsring_busy |= 1 << slot;
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+	fsring_slots[slot].s_tag = tag;
+	fsring_slots[slot].s_buf = NULL;
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+}
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+		return slot;
+	fsring_busy |= 1 << slot;
+	fsring_slots[slot].s_type = FSREQ_STAT;
+	fsring_slots[slot].s_tag = tag;
+	fsring_slots[slot].s_buf = st;
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+}
+
+// Collect the result of a finished request: store its tag in *tag_store
+// and what the synchronous call would have returned in *result_store.
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+		return 0;
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+		if (!wait || fsring_busy == 0)
+			return 0;
+		sys_yield();
+	}
+
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+	fsring->r_cqhead++;
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+	case FSREQ_READ:
+		if (cqe.cqe_result > 0)
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+				MIN(cqe.cqe_result, PGSIZE));
+		break;
+	case FSREQ_STAT:
+		if (cqe.cqe_result == 0) {
+			ret = (struct Fsret_stat *) data;
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+			strcpy(st->st_name, ret->ret_name);
+			st->st_size = ret->ret_size;
+			st->st_isdir = ret->ret_isdir;
+			st->st_dev = &devfile;
+		}
+		break;
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+
+// Read up to n bytes from the start of the file 'path' into buf in a
+// single round trip, without opening it.  If st is not null, also
+// store the file's name, size and type there.  Reads of up to about a
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+	} else {
+		fsipcbuf.slurp.req_n = n;
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+		st->st_dev = &devfile;
+	}
+	return r;
+}
+
+// Delete a file
+int
+remove(const char *path)
+{
+	if (strlen(path) >= MAXPATHLEN)
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+	return fsipc(FSREQ_REMOVE, NULL);
+}
+
 // Synchronize disk with buffer cache
 int
 sync(void)
@@ -182,3 +740,35 @@ sync(void)
 	return fsipc(FSREQ_SYNC, NULL);
 }
 
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+		return r;
+	if (before)
+		*before = fsipcbuf.defragRet.ret_before;
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+}
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+	return 0;
+}
+
@@ -7,6 +7,12 @@
 // It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
 #define PTE_COW		0x800
 
+extern void (*_pgfault_handler)(struct UTrapframe *utf);
+
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
 static int copy_page_to(envid_t envid, void *va, int perm)
 {
 	int r;
@@ -25,7 +31,8 @@ exit:
 
 //
 // Custom page fault handler - if faulting page is copy-on-write,
-// map in our own private writable copy.
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
 //
 static void
 pgfault(struct UTrapframe *utf)
@@ -40,8 +47,14 @@ pgfault(struct UTrapframe *utf)
 	//   (see <inc/memlayout.h>).
 
 	// LAB 4: Your code here.
-	if (!(err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+		if (pgfault_next) {
+			pgfault_next(utf);
+			return;
+		}
 		goto exit;
+	}
 
 	// Allocate a new page, map it at a temporary location (PFTEMP),
 	// copy the data from the old page to the new page, then move the new
@@ -89,6 +102,24 @@ duppage(envid_t envid, unsigned pn)
 	return r;
 }
 
+//
+// Make the page mapped at 'va' copy-on-write in the current environment,
+// so that the first write to it gets a private copy.  Used for private
+// file mappings (see mmap).  A page fault handler the environment has
+// installed keeps getting the faults that are not copy-on-write ones.
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+	if (_pgfault_handler != pgfault) {
+		pgfault_next = _pgfault_handler;
+		set_pgfault_handler(pgfault);
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+}
+
 //
 // User-level fork with copy-on-write.
 // Set up our page fault handler appropriately.
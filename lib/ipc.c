@@ -59,6 +59,41 @@ ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
 	}
 }
 
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+	if (from_env_store)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+	if (perm_store)
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+	return r ?: thisenv->env_ipc_value;
+}
+
+// Send 'val' and the 'npages' pages listed in 'pages' to 'toenv'.
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+		assert(r == -E_IPC_NOT_RECV);
+		sys_yield();
+	}
+}
+
 // Find the first environment of the given type.  We'll use this to
 // find special environments.
 // Returns 0 if no such environment exists.
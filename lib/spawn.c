@@ -49,13 +49,11 @@ spawn(const char *prog, const char **argv)
 	//
 	//	* If the ELF flags do not include ELF_PROG_FLAG_WRITE,
 	//	  then the segment contains text and read-only data.
-	//	  Use read_map() to read the contents of this segment,
-	//	  and map the pages it returns directly into the child
+	//	  Use mmap() to map the file server's pages for this
+	//	  segment, and map them directly into the child
 	//        so that multiple instances of the same program
 	//	  will share the same copy of the program text.
 	//        Be sure to map the program text read-only in the child.
-	//        Read_map is like read but returns a pointer to the data in
-	//        *blk rather than copying the data into another buffer.
 	//
 	//	* If the ELF segment flags DO include ELF_PROG_FLAG_WRITE,
 	//	  then the segment contains read/write data and bss.
@@ -71,7 +69,7 @@ spawn(const char *prog, const char **argv)
 	//	  page_alloc() returns zeroed pages already.)
 	//        Then insert the page mapping into the child.
 	//        Look at init_stack() for inspiration.
-	//        Be sure you understand why you can't use read_map() here.
+	//        Be sure you understand why you can't use mmap() here.
 	//
 	//     Note: None of the segment addresses or lengths above
 	//     are guaranteed to be page-aligned, so you must deal with
@@ -264,7 +262,7 @@ static int
 map_segment(envid_t child, uintptr_t va, size_t memsz,
 	int fd, size_t filesz, off_t fileoffset, int perm)
 {
-	int i, r;
+	int i, j, n, r;
 	void *blk;
 
 	//cprintf("map_segment %x+%x\n", va, memsz);
@@ -276,22 +274,41 @@ map_segment(envid_t child, uintptr_t va, size_t memsz,
 		fileoffset -= i;
 	}
 
-	for (i = 0; i < memsz; i += PGSIZE) {
+	for (i = 0; i < memsz; i += n * PGSIZE) {
 		if (i >= filesz) {
 			// allocate a blank page
+			n = 1;
 			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
 				return r;
-		} else {
-			// from file
-			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+			continue;
+		}
+
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+			// read-only and all from file: map the file server's
+			// cached pages, so that every instance of the program
+			// shares one copy of its text
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+			n = MIN(n, FSBULK_MAXPAGES);
+			if ((r = mmap(UTEMP, n * PGSIZE, PROT_READ, MAP_SHARED,
+				      fd, fileoffset + i)) < 0)
 				return r;
+		} else {
+			// from file, up to FSBULK_MAXPAGES pages per read so
+			// that the file server can fill them all in one go
+			n = MIN(FSBULK_MAXPAGES, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+			for (j = 0; j < n; j++)
+				if ((r = sys_page_alloc(0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+					return r;
 			if ((r = seek(fd, fileoffset + i)) < 0)
 				return r;
-			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
 				return r;
-			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
+		}
+		for (j = 0; j < n; j++) {
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
 				panic("spawn: sys_page_map data: %e", r);
-			sys_page_unmap(0, UTEMP);
+			sys_page_unmap(0, UTEMP + j * PGSIZE);
 		}
 	}
 	return 0;
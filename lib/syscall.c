@@ -136,10 +136,28 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
 	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
 }
 
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+
 int
 sys_ipc_recv(void *dstva)
 {
-	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
 }
 
 unsigned int
@@ -159,3 +177,42 @@ sys_net_try_recv(uint8_t *buffer)
 {
 	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
 }
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+
+int
+sys_net_wait(uint32_t events)
+{
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+
+int
+sys_net_map(void *va)
+{
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+
+int
+sys_net_sync(uint32_t rings)
+{
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
@@ -1,28 +1,31 @@
 #include "ns.h"
 
-extern union Nsipc nsipcbuf;
-
 void
 input(envid_t ns_envid)
 {
+	uintptr_t pages[NSPKT_MAXPAGES];
+	int i, n;
+
 	binaryname = "ns_input";
 
 	// LAB 6: Your code here:
 	// 	- read a packet from the device driver
 	//	- send it to the network server
-	// Hint: When you IPC a page to the network server, it will be
-	// reading from it for a while, so don't immediately receive
-	// another packet in to the same physical page.
-	// With the current environment forked from serv, nsipcbuf is still
-	// marked COW, which prevents it from being used in sys_net_try_recv.
-	assert(!sys_page_alloc(0, &nsipcbuf, PTE_U | PTE_W | PTE_P));
+	// Packets arrive in pages of their own, which the kernel takes
+	// straight off the receive ring, as many as are waiting, and maps
+	// at PKTVA one after another as struct jif_pkts, a jumbo frame
+	// spilling into the pages after its first.  They all go to
+	// the network server in one IPC.  The next batch replaces the
+	// mappings, so there is no need to wait for the network server to
+	// be done with this one.
 	while (true) {
-		while (!(nsipcbuf.pkt.jp_len =
-			 sys_net_try_recv((uint8_t *) nsipcbuf.pkt.jp_data)))
-			sys_yield();
-		ipc_send(ns_envid, NSREQ_INPUT, &nsipcbuf, PTE_U | PTE_P);
-		while (pageref(&nsipcbuf) > 1) {
-			sys_yield();
-		}
+		while ((n = sys_net_recv_pages((void *) PKTVA, NSPKT_MAXPAGES)) <= 0)
+			if (n == 0)
+				sys_net_wait(NET_WAIT_RX);
+			else
+				sys_yield();
+		for (i = 0; i < n; i++)
+			pages[i] = (PKTVA + i * PGSIZE) | PTE_U | PTE_P;
+		ipc_sendv(ns_envid, NSREQ_INPUT, pages, n);
 	}
 }
@@ -224,7 +224,7 @@ ip_input(struct pbuf *p, struct netif *inp)
 
   /* verify checksum */
 #if CHECKSUM_CHECK_IP
-  if (inet_chksum(iphdr, iphdr_hlen) != 0) {
+  if (!(p->flags & PBUF_FLAG_CSUM_IP) && inet_chksum(iphdr, iphdr_hlen) != 0) {
 
     LWIP_DEBUGF(IP_DEBUG | 2, ("Checksum (0x%"X16_F") failed, IP packet dropped.\n", inet_chksum(iphdr, iphdr_hlen)));
     ip_debug_print(p);
@@ -353,6 +353,8 @@ ip_input(struct pbuf *p, struct netif *inp)
       return ERR_OK;
     }
     iphdr = p->payload;
+    /* the interface saw only fragments, not the whole TCP or UDP checksum */
+    p->flags &= ~PBUF_FLAG_CSUM_L4;
 #else /* IP_REASSEMBLY == 0, no packet fragment reassembly code present */
     pbuf_free(p);
     LWIP_DEBUGF(IP_DEBUG | 2, ("IP packet dropped since it was fragmented (0x%"X16_F") (while IP_REASSEMBLY == 0).\n",
@@ -521,8 +523,10 @@ ip_output_if(struct pbuf *p, struct ip_addr *src, struct ip_addr *dest,
   }
 
 #if IP_FRAG
-  /* don't fragment if interface has mtu set to 0 [loopif] */
-  if (netif->mtu && (p->tot_len > netif->mtu))
+  /* don't fragment if interface has mtu set to 0 [loopif], or TCP
+     segments the interface splits itself */
+  if (netif->mtu && (p->tot_len > netif->mtu) &&
+      !((netif->flags & NETIF_FLAG_TSO) && IPH_PROTO(iphdr) == IP_PROTO_TCP))
     return ip_frag(p,netif,dest);
 #endif
 
@@ -56,8 +56,33 @@
 
 #include <string.h>
 
+#if TCP_TSO
+/**
+ * Segments tcp_output() has built but not sent yet, to go out together
+ * as one large segment that the network interface splits up again (TCP
+ * segmentation offload).  They are in sequence and full-sized, except
+ * that the last one may be short.
+ */
+struct tcp_tso {
+  /** the route to the remote host allows it */
+  u8_t on;
+  u16_t nsegs;
+  u16_t len;
+  struct tcp_seg *segs[TCP_TSO_MAXSEGS];
+};
+
+/* The most data in one large segment, so that it still fits in a pbuf
+   chain once the IP and link headers are on */
+#define TCP_TSO_MAXLEN (0xffff - PBUF_LINK_HLEN - IP_HLEN - TCP_HLEN)
+
+static void tcp_tso_flush(struct tcp_tso *tso, struct tcp_pcb *pcb);
+#endif /* TCP_TSO */
+
 /* Forward declarations.*/
-static void tcp_output_segment(struct tcp_seg *seg, struct tcp_pcb *pcb);
+struct tcp_tso;
+static void tcp_output_segment(struct tcp_seg *seg, struct tcp_pcb *pcb,
+                               struct tcp_tso *tso);
+static void tcp_output_ip(struct pbuf *p, struct tcp_pcb *pcb);
 
 /**
  * Called by tcp_close() to send a segment including flags but not data.
@@ -414,6 +439,10 @@ tcp_output(struct tcp_pcb *pcb)
   struct tcp_hdr *tcphdr;
   struct tcp_seg *seg, *useg;
   u32_t wnd;
+#if TCP_TSO
+  struct tcp_tso tso;
+  struct netif *netif;
+#endif /* TCP_TSO */
 #if TCP_CWND_DEBUG
   s16_t i = 0;
 #endif /* TCP_CWND_DEBUG */
@@ -510,6 +539,15 @@ tcp_output(struct tcp_pcb *pcb)
                  ntohl(seg->tcphdr->seqno), pcb->lastack));
   }
 #endif /* TCP_CWND_DEBUG */
+#if TCP_TSO
+  /* The interface splits large segments at the path MTU, so only use
+     it if that is what the remote host takes. */
+  netif = ip_route(&pcb->remote_ip);
+  tso.on = netif != NULL && (netif->flags & NETIF_FLAG_TSO) &&
+    pcb->mss == netif->mtu - IP_HLEN - TCP_HLEN;
+  tso.nsegs = 0;
+  tso.len = 0;
+#endif /* TCP_TSO */
   /* data available and window allows it to be sent? */
   while (seg != NULL &&
          ntohl(seg->tcphdr->seqno) - pcb->lastack + seg->len <= wnd) {
@@ -542,7 +580,11 @@ tcp_output(struct tcp_pcb *pcb)
       pcb->flags &= ~(TF_ACK_DELAY | TF_ACK_NOW);
     }
 
-    tcp_output_segment(seg, pcb);
+#if TCP_TSO
+    tcp_output_segment(seg, pcb, &tso);
+#else /* TCP_TSO */
+    tcp_output_segment(seg, pcb, NULL);
+#endif /* TCP_TSO */
     pcb->snd_nxt = ntohl(seg->tcphdr->seqno) + TCP_TCPLEN(seg);
     if (TCP_SEQ_LT(pcb->snd_max, pcb->snd_nxt)) {
       pcb->snd_max = pcb->snd_nxt;
@@ -575,6 +617,9 @@ tcp_output(struct tcp_pcb *pcb)
     }
     seg = pcb->unsent;
   }
+#if TCP_TSO
+  tcp_tso_flush(&tso, pcb);
+#endif /* TCP_TSO */
 
   if (seg != NULL && pcb->persist_backoff == 0 && 
       ntohl(seg->tcphdr->seqno) - pcb->lastack + seg->len > pcb->snd_wnd) {
@@ -587,14 +632,114 @@ tcp_output(struct tcp_pcb *pcb)
   return ERR_OK;
 }
 
+#if TCP_TSO
+/**
+ * Send the segments held back in tso as one large segment, or on their
+ * own if there is only one or no memory to put them together.
+ *
+ * @param tso the segments to send
+ * @param pcb the tcp_pcb for the TCP connection used to send them
+ */
+static void
+tcp_tso_flush(struct tcp_tso *tso, struct tcp_pcb *pcb)
+{
+  struct pbuf *p, *q, *r;
+  struct tcp_hdr *tcphdr;
+  u16_t i, skip;
+
+  if (tso->nsegs == 0) {
+    return;
+  }
+  p = NULL;
+  if (tso->nsegs > 1) {
+    p = pbuf_alloc(PBUF_IP, TCP_HLEN, PBUF_RAM);
+  }
+  if (p != NULL) {
+    /* One header, taken from the first segment, then a reference to
+       the data of each.  The segments stay on the unacked queue, so
+       the data outlives the packet. */
+    tcphdr = p->payload;
+    SMEMCPY(tcphdr, tso->segs[0]->tcphdr, TCP_HLEN);
+    tcphdr->chksum = 0;
+    for (i = 0; i < tso->nsegs && p != NULL; i++) {
+      if (TCPH_FLAGS(tso->segs[i]->tcphdr) & TCP_PSH) {
+        TCPH_SET_FLAG(tcphdr, TCP_PSH);
+      }
+      skip = TCP_HLEN;
+      for (q = tso->segs[i]->p; q != NULL; q = q->next) {
+        if (q->len <= skip) {
+          skip -= q->len;
+          continue;
+        }
+        if ((r = pbuf_alloc(PBUF_RAW, q->len - skip, PBUF_REF)) == NULL) {
+          pbuf_free(p);
+          p = NULL;
+          break;
+        }
+        r->payload = (u8_t *)q->payload + skip;
+        skip = 0;
+        pbuf_cat(p, r);
+      }
+    }
+  }
+  if (p != NULL) {
+    LWIP_DEBUGF(TCP_OUTPUT_DEBUG, ("tcp_tso_flush: %"U16_F" segments, %"U16_F" bytes\n",
+                                   tso->nsegs, tso->len));
+    tcp_output_ip(p, pcb);
+    pbuf_free(p);
+  } else {
+    for (i = 0; i < tso->nsegs; i++) {
+      tcp_output_ip(tso->segs[i]->p, pcb);
+    }
+  }
+  tso->nsegs = 0;
+  tso->len = 0;
+}
+
+/**
+ * Hold seg back in tso to send with the segments after it, if it can be.
+ * Sends what tso holds first if seg cannot go out together with it.
+ *
+ * @param tso the segments held back
+ * @param seg the segment to send, with its header complete
+ * @param pcb the tcp_pcb for the TCP connection used to send the segment
+ * @return 1 if seg is held back, 0 if it is to be sent on its own
+ */
+static u8_t
+tcp_tso_add(struct tcp_tso *tso, struct tcp_seg *seg, struct tcp_pcb *pcb)
+{
+  struct tcp_seg *last;
+  u8_t ok;
+
+  ok = tso->on && seg->len > 0 && TCPH_HDRLEN(seg->tcphdr) == 5 &&
+    (TCPH_FLAGS(seg->tcphdr) & (TCP_SYN | TCP_FIN | TCP_RST)) == 0;
+  if (tso->nsegs > 0) {
+    last = tso->segs[tso->nsegs - 1];
+    if (!ok || tso->nsegs == TCP_TSO_MAXSEGS || last->len != pcb->mss ||
+        (u32_t)tso->len + seg->len > TCP_TSO_MAXLEN ||
+        ntohl(seg->tcphdr->seqno) != ntohl(last->tcphdr->seqno) + last->len) {
+      tcp_tso_flush(tso, pcb);
+    }
+  }
+  if (!ok) {
+    return 0;
+  }
+  tso->segs[tso->nsegs++] = seg;
+  tso->len += seg->len;
+  return 1;
+}
+#endif /* TCP_TSO */
+
 /**
  * Called by tcp_output() to actually send a TCP segment over IP.
  *
  * @param seg the tcp_seg to send
  * @param pcb the tcp_pcb for the TCP connection used to send the segment
+ * @param tso segments held back to send as one, or NULL
  */
 static void
-tcp_output_segment(struct tcp_seg *seg, struct tcp_pcb *pcb)
+tcp_output_segment(struct tcp_seg *seg, struct tcp_pcb *pcb,
+                   struct tcp_tso *tso)
 {
   u16_t len;
   struct netif *netif;
@@ -649,19 +794,36 @@ tcp_output_segment(struct tcp_seg *seg, struct tcp_pcb *pcb)
 #endif
   TCP_STATS_INC(tcp.xmit);
 
+#if TCP_TSO
+  if (tso != NULL && tcp_tso_add(tso, seg, pcb)) {
+    return;
+  }
+#endif /* TCP_TSO */
+  tcp_output_ip(seg->p, pcb);
+}
+
+/**
+ * Send a TCP segment in p, header included, over IP.
+ *
+ * @param p the segment to send
+ * @param pcb the tcp_pcb for the TCP connection used to send the segment
+ */
+static void
+tcp_output_ip(struct pbuf *p, struct tcp_pcb *pcb)
+{
 #if LWIP_NETIF_HWADDRHINT
   {
     struct netif *netif;
     netif = ip_route(&pcb->remote_ip);
     if(netif != NULL){
       netif->addr_hint = &(pcb->addr_hint);
-      ip_output_if(seg->p, &(pcb->local_ip), &(pcb->remote_ip), pcb->ttl,
+      ip_output_if(p, &(pcb->local_ip), &(pcb->remote_ip), pcb->ttl,
                    pcb->tos, IP_PROTO_TCP, netif);
       netif->addr_hint = NULL;
     }
   }
 #else /* LWIP_NETIF_HWADDRHINT*/
-  ip_output(seg->p, &(pcb->local_ip), &(pcb->remote_ip), pcb->ttl, pcb->tos,
+  ip_output(p, &(pcb->local_ip), &(pcb->remote_ip), pcb->ttl, pcb->tos,
       IP_PROTO_TCP);
 #endif /* LWIP_NETIF_HWADDRHINT*/
 }
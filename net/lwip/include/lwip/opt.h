@@ -709,6 +709,22 @@
 #define TCP_CALCULATE_EFF_SEND_MSS      1
 #endif
 
+/**
+ * TCP_TSO==1: Send runs of full-sized segments as one large segment
+ * through network interfaces with NETIF_FLAG_TSO set, which split it up
+ * again (TCP segmentation offload).
+ */
+#ifndef TCP_TSO
+#define TCP_TSO                         0
+#endif
+
+/**
+ * TCP_TSO_MAXSEGS: The most segments TCP_TSO sends as one.
+ */
+#ifndef TCP_TSO_MAXSEGS
+#define TCP_TSO_MAXSEGS                 16
+#endif
+
 
 /**
  * TCP_SND_BUF: TCP sender buffer space (bytes). 
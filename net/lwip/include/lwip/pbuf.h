@@ -60,6 +60,10 @@ typedef enum {
 
 /** indicates this packet's data should be immediately passed to the application */
 #define PBUF_FLAG_PUSH 0x01U
+/** the network interface has verified this packet's IP header checksum */
+#define PBUF_FLAG_CSUM_IP 0x02U
+/** the network interface has verified this packet's TCP or UDP checksum */
+#define PBUF_FLAG_CSUM_L4 0x04U
 
 struct pbuf {
   /** next pbuf in singly linked pbuf chain */
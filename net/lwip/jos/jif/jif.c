@@ -40,25 +40,303 @@
 #include "lwip/mem.h"
 #include "lwip/pbuf.h"
 #include "lwip/sys.h"
+#include "lwip/inet_chksum.h"
+#include "lwip/tcp.h"
+#include "lwip/udp.h"
 #include <lwip/stats.h>
 
 #include <netif/etharp.h>
 
 #define PKTMAP		0x10000000
 
+_Static_assert(NET_MTU <= NET_MTU_MAX);
+
 struct jif {
     struct eth_addr *ethaddr;
     envid_t envid;
 };
 
+/*
+ * Packets sent straight from their pbufs, oldest first.  The NIC reads
+ * the pbufs' memory after low_level_output returns, so each one keeps a
+ * reference until the kernel reports it sent.  There are never more in
+ * flight than the NIC has transmit descriptors.
+ */
+#define JIF_TXQ		256
+
+static struct {
+    struct pbuf *p;
+    u32_t seq;
+} jif_txq[JIF_TXQ];
+static u32_t jif_txq_head, jif_txq_tail;
+
+static void
+jif_tx_reap(u32_t done)
+{
+    while (jif_txq_tail != jif_txq_head
+	   && (s32_t) (jif_txq[jif_txq_tail % JIF_TXQ].seq - done) < 0) {
+	pbuf_free(jif_txq[jif_txq_tail % JIF_TXQ].p);
+	jif_txq_tail++;
+    }
+}
+
+/*
+ * Sum of the TCP or UDP pseudo-header for the IP header iphdr, with
+ * 'len' bytes of TCP or UDP header and data, not yet complemented.
+ */
+static u16_t
+jif_pseudo_sum(struct ip_hdr *iphdr, u16_t len)
+{
+    u32_t sum;
+
+    sum = (iphdr->src.addr & 0xffff) + (iphdr->src.addr >> 16)
+	+ (iphdr->dest.addr & 0xffff) + (iphdr->dest.addr >> 16)
+	+ htons(IPH_PROTO(iphdr)) + htons(len);
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return sum;
+}
+
+/*
+ * Work out which checksums of the frame in p the NIC is to fill in,
+ * and where they go, into *off.  The IP, TCP and UDP layers leave them
+ * zero (see CHECKSUM_GEN_* in lwipopts.h); the TCP or UDP one is seeded
+ * here with the sum of the pseudo-header, which the NIC does not add.
+ * TCP segments bigger than the MTU, which TCP_TSO sends, are for the
+ * NIC to split up.
+ * Returns 0 if the frame has no checksums to fill in.
+ */
+static int
+jif_tx_csum(struct netif *netif, struct pbuf *p, struct net_offload *off)
+{
+    struct eth_hdr *ethhdr = p->payload;
+    struct ip_hdr *iphdr;
+    struct tcp_hdr *tcphdr;
+    u16_t hlen, csum, len;
+
+    memset(off, 0, sizeof(*off));
+    if (p->len < sizeof(struct eth_hdr) + IP_HLEN || ethhdr->type != htons(ETHTYPE_IP))
+	return 0;
+    iphdr = (struct ip_hdr *) ((u8_t *) p->payload + sizeof(struct eth_hdr));
+    hlen = IPH_HL(iphdr) * 4;
+    if (IPH_V(iphdr) != 4 || hlen < IP_HLEN || p->len < sizeof(struct eth_hdr) + hlen)
+	return 0;
+    off->no_flags = NET_CSUM_IP;
+    off->no_iphdr = sizeof(struct eth_hdr);
+    off->no_l4hdr = sizeof(struct eth_hdr) + hlen;
+
+    /* Fragments go out with no UDP checksum, which is 0. */
+    if (IPH_OFFSET(iphdr) & htons(IP_OFFMASK | IP_MF))
+	return 1;
+    switch (IPH_PROTO(iphdr)) {
+    case IP_PROTO_TCP:
+	csum = offsetof(struct tcp_hdr, chksum);
+	break;
+    case IP_PROTO_UDP:
+	csum = offsetof(struct udp_hdr, chksum);
+	break;
+    default:
+	return 1;
+    }
+    if (p->len < off->no_l4hdr + csum + 2)
+	return 1;
+    off->no_flags |= NET_CSUM_L4;
+    off->no_l4csum = off->no_l4hdr + csum;
+    len = ntohs(IPH_LEN(iphdr)) - hlen;
+
+    if (IPH_PROTO(iphdr) == IP_PROTO_TCP && ntohs(IPH_LEN(iphdr)) > netif->mtu) {
+	tcphdr = (struct tcp_hdr *) ((u8_t *) p->payload + off->no_l4hdr);
+	off->no_flags |= NET_TSO;
+	off->no_hdrlen = off->no_l4hdr + TCPH_HDRLEN(tcphdr) * 4;
+	off->no_mss = netif->mtu - hlen - TCPH_HDRLEN(tcphdr) * 4;
+	/* The NIC adds each segment's own length. */
+	len = 0;
+    }
+    *(u16_t *) ((u8_t *) p->payload + off->no_l4csum) = jif_pseudo_sum(iphdr, len);
+    return 1;
+}
+
+/*
+ * Fill in the checksums jif_tx_csum set up for the NIC, in a frame
+ * copied to 'frame' that the NIC will not fill them in for.
+ */
+static void
+jif_tx_csum_sw(char *frame, int len, const struct net_offload *off)
+{
+    struct ip_hdr *iphdr = (struct ip_hdr *) (frame + off->no_iphdr);
+    u16_t *csum;
+
+    if (off->no_flags & NET_CSUM_L4) {
+	csum = (u16_t *) (frame + off->no_l4csum);
+	*csum = inet_chksum(frame + off->no_l4hdr, len - off->no_l4hdr);
+	/* 0 means no checksum at all to UDP */
+	if (*csum == 0 && IPH_PROTO(iphdr) == IP_PROTO_UDP)
+	    *csum = 0xffff;
+    }
+    if (off->no_flags & NET_CSUM_IP)
+	IPH_CHKSUM_SET(iphdr, inet_chksum(iphdr, off->no_l4hdr - off->no_iphdr));
+}
+
+/*
+ * Packets copied for the output environment collect in consecutive
+ * pages from PKTMAP on, and go to it together in one NSREQ_OUTPUT, up
+ * to NSPKT_MAXPAGES pages at a time.  jif_flush sends what is there.
+ */
+static int jif_outpages;
+
+/*
+ * Send the packets collected at PKTMAP to the output environment, and
+ * unmap them.
+ */
+static void
+jif_out_flush(struct jif *jif)
+{
+    uintptr_t pages[NSPKT_MAXPAGES];
+    int i;
+
+    if (jif_outpages == 0)
+	return;
+    for (i = 0; i < jif_outpages; i++)
+	pages[i] = (PKTMAP + i * PGSIZE) | PTE_P|PTE_W|PTE_U;
+    ipc_sendv(jif->envid, NSREQ_OUTPUT, pages, jif_outpages);
+    for (i = 0; i < jif_outpages; i++)
+	sys_page_unmap(0, (void *) (PKTMAP + i * PGSIZE));
+    jif_outpages = 0;
+}
+
+/*
+ * Map fresh pages after the packets collected at PKTMAP for a packet
+ * of 'len' bytes, which takes more than one page if it is longer than
+ * a page's worth of jp_data.  Sends the collected ones first if there
+ * is no room left.
+ */
+static struct jif_pkt *
+jif_pkt_alloc(struct jif *jif, int len)
+{
+    uintptr_t va;
+    int i, r;
+
+    if (len > NET_FRAME_MAX)
+	panic("jif: oversized packet, %d bytes", len);
+    if (jif_outpages + JIF_PKT_NPAGES(len) > NSPKT_MAXPAGES)
+	jif_out_flush(jif);
+    va = PKTMAP + jif_outpages * PGSIZE;
+    for (i = 0; i < JIF_PKT_NPAGES(len); i++)
+	if ((r = sys_page_alloc(0, (void *) (va + i * PGSIZE),
+				PTE_U|PTE_W|PTE_P)) < 0)
+	    panic("jif: could not allocate page of memory");
+    return (struct jif_pkt *) va;
+}
+
+/*
+ * Add the packet jif_pkt_alloc mapped to those going to the output
+ * environment with the next jif_flush.
+ */
+static void
+jif_pkt_send(struct jif *jif, struct jif_pkt *pkt)
+{
+    jif_outpages += JIF_PKT_NPAGES(pkt->jp_len);
+}
+
+/*
+ * Send the packets collected for the output environment.  The network
+ * server calls this before it waits for the next request.
+ */
+void
+jif_flush(struct netif *netif)
+{
+    jif_out_flush(netif->state);
+}
+
+/*
+ * Split the large TCP segment in p into segments of off->no_mss bytes
+ * and copy each one to the output environment, as the NIC would have
+ * sent them.
+ */
+static void
+jif_tso_sw(struct jif *jif, struct pbuf *p, const struct net_offload *off)
+{
+    struct jif_pkt *pkt;
+    struct ip_hdr *iphdr;
+    struct tcp_hdr *tcphdr;
+    u16_t hdrlen = off->no_hdrlen;
+    u16_t paylen = p->tot_len - hdrlen;
+    u16_t done, seglen, i;
+
+    for (done = 0, i = 0; done < paylen; done += seglen, i++) {
+	seglen = LWIP_MIN(off->no_mss, paylen - done);
+	pkt = jif_pkt_alloc(jif, hdrlen + seglen);
+	pbuf_copy_partial(p, pkt->jp_data, hdrlen, 0);
+	pbuf_copy_partial(p, pkt->jp_data + hdrlen, seglen, hdrlen + done);
+	pkt->jp_len = hdrlen + seglen;
+
+	iphdr = (struct ip_hdr *) (pkt->jp_data + off->no_iphdr);
+	tcphdr = (struct tcp_hdr *) (pkt->jp_data + off->no_l4hdr);
+	IPH_LEN_SET(iphdr, htons(pkt->jp_len - off->no_iphdr));
+	IPH_ID_SET(iphdr, htons(ntohs(IPH_ID(iphdr)) + i));
+	tcphdr->seqno = htonl(ntohl(tcphdr->seqno) + done);
+	if (done + seglen < paylen)
+	    TCPH_FLAGS_SET(tcphdr, TCPH_FLAGS(tcphdr) & ~(TCP_FIN | TCP_PSH));
+	tcphdr->chksum = jif_pseudo_sum(iphdr, pkt->jp_len - off->no_l4hdr);
+	jif_tx_csum_sw(pkt->jp_data, pkt->jp_len, off);
+	jif_pkt_send(jif, pkt);
+    }
+}
+
+/*
+ * Send the packet in pbuf chain p without copying it, waiting for room
+ * in the transmit ring if need be, with the NIC filling in the
+ * checksums off asks for.  Returns 1 if it did, 0 if the chain has too
+ * many pieces, or the kernel's error, e.g. -E_NOT_SUPP if the NIC
+ * cannot do what off asks.
+ */
+static int
+low_level_output_sg(struct pbuf *p, const struct net_offload *off)
+{
+    /* Too big for a thread stack, and never used by two threads at
+     * once: nothing in here yields. */
+    static struct net_sg sg[NET_SG_MAX];
+    struct net_txinfo ti;
+    struct pbuf *q;
+    int n, r;
+
+    for (q = p, n = 0; q != NULL; q = q->next) {
+	if (q->len == 0)
+	    continue;
+	if (n == NET_SG_MAX)
+	    return 0;
+	sg[n].sg_va = q->payload;
+	sg[n].sg_len = q->len;
+	n++;
+    }
+
+    while (1) {
+	r = sys_net_send_sg(sg, n, off, &ti);
+	if (r < 0)
+	    return r;
+	jif_tx_reap(ti.ti_done);
+	if (r > 0)
+	    break;
+	sys_net_wait(NET_WAIT_TX);
+    }
+
+    if (jif_txq_head - jif_txq_tail == JIF_TXQ)
+	panic("jif: too many packets in flight");
+    pbuf_ref(p);
+    jif_txq[jif_txq_head % JIF_TXQ].p = p;
+    jif_txq[jif_txq_head % JIF_TXQ].seq = ti.ti_seq;
+    jif_txq_head++;
+    return 1;
+}
+
 static void
 low_level_init(struct netif *netif)
 {
     int r;
 
     netif->hwaddr_len = 6;
-    netif->mtu = 1500;
-    netif->flags = NETIF_FLAG_BROADCAST;
+    netif->mtu = NET_MTU;
+    netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_TSO;
 
     // MAC address is hardcoded to eliminate a system call
     netif->hwaddr[0] = 0x52;
@@ -76,18 +354,36 @@ low_level_init(struct netif *netif)
  * contained in the pbuf that is passed to the function. This pbuf
  * might be chained.
  *
+ * Packets normally go to the NIC straight from the pbufs, and the NIC
+ * fills in their checksums and splits up large TCP segments.  Those
+ * that cannot are copied into pages for the output environment, with
+ * that done here.
+ *
  */
 static err_t
 low_level_output(struct netif *netif, struct pbuf *p)
 {
-    int r = sys_page_alloc(0, (void *)PKTMAP, PTE_U|PTE_W|PTE_P);
-    if (r < 0)
-	panic("jif: could not allocate page of memory");
-    struct jif_pkt *pkt = (struct jif_pkt *)PKTMAP;
+    struct net_offload off;
+    int csum = jif_tx_csum(netif, p, &off);
+    int r = low_level_output_sg(p, csum ? &off : NULL);
+
+    if (r > 0)
+	return ERR_OK;
+    /* The NIC does not split TCP segments; have TCP stop making them
+       too big for it. */
+    if (r == -E_NOT_SUPP && (off.no_flags & NET_TSO))
+	netif->flags &= ~NETIF_FLAG_TSO;
 
     struct jif *jif;
     jif = netif->state;
 
+    if (off.no_flags & NET_TSO) {
+	jif_tso_sw(jif, p, &off);
+	return ERR_OK;
+    }
+
+    struct jif_pkt *pkt = jif_pkt_alloc(jif, p->tot_len);
+
     char *txbuf = pkt->jp_data;
     int txsize = 0;
     struct pbuf *q;
@@ -95,17 +391,14 @@ low_level_output(struct netif *netif, struct pbuf *p)
 	/* Send the data from the pbuf to the interface, one pbuf at a
 	   time. The size of the data in each pbuf is kept in the ->len
 	   variable. */
-
-	if (txsize + q->len > 2000)
-	    panic("oversized packet, fragment %d txsize %d\n", q->len, txsize);
 	memcpy(&txbuf[txsize], q->payload, q->len);
 	txsize += q->len;
     }
 
     pkt->jp_len = txsize;
-
-    ipc_send(jif->envid, NSREQ_OUTPUT, (void *)pkt, PTE_P|PTE_W|PTE_U);
-    sys_page_unmap(0, (void *)pkt);
+    if (csum)
+	jif_tx_csum_sw(txbuf, txsize, &off);
+    jif_pkt_send(jif, pkt);
 
     return ERR_OK;
 }
@@ -126,6 +419,10 @@ low_level_input(void *va)
     struct pbuf *p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
     if (p == 0)
 	return 0;
+    if (pkt->jp_csum & NET_CSUM_IP)
+	p->flags |= PBUF_FLAG_CSUM_IP;
+    if (pkt->jp_csum & NET_CSUM_L4)
+	p->flags |= PBUF_FLAG_CSUM_L4;
 
     /* We iterate over the pbuf chain until we have read the entire
      * packet into the pbuf. */
@@ -2,3 +2,4 @@
 
 void	jif_input(struct netif *netif, void *va);
 err_t	jif_init(struct netif *netif);
+void	jif_flush(struct netif *netif);
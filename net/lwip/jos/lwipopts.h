@@ -22,7 +22,7 @@ void *memcpy(void *dst, const void *src, size_t n);
 
 #define MEM_ALIGNMENT		4
 
-#define MEMP_NUM_PBUF		64
+#define MEMP_NUM_PBUF		256	// TCP_TSO references segment data
 #define MEMP_NUM_UDP_PCB	8
 #define MEMP_NUM_TCP_PCB	32
 #define MEMP_NUM_TCP_PCB_LISTEN	16
@@ -34,12 +34,35 @@ void *memcpy(void *dst, const void *src, size_t n);
 #define PER_TCP_PCB_BUFFER	(16 * 4096)
 #define MEM_SIZE		(PER_TCP_PCB_BUFFER*MEMP_NUM_TCP_SEG + 4096*MEMP_NUM_TCP_SEG)
 
+// The interface's MTU, which GNUmakefile's NET_MTU sets.  Received
+// frames longer than a pool pbuf are chained over several.
+#ifndef NET_MTU
+#define NET_MTU			1500
+#endif
+
 #define PBUF_POOL_SIZE		512
 #define PBUF_POOL_BUFSIZE	2000
 
-#define TCP_MSS			1460
+// The NIC fills in outgoing IP, TCP and UDP checksums; jif sets it up,
+// or fills them in itself for packets it has to copy.
+#define CHECKSUM_GEN_IP		0
+#define CHECKSUM_GEN_UDP	0
+#define CHECKSUM_GEN_TCP	0
+
+#define TCP_MSS			(NET_MTU - 40)
+// The NIC splits and checksums segments of up to about 64KB.
+#define TCP_TSO			1
+#if NET_MTU > 1500
+// lwIP keeps the window and send buffer in 16 bits, which a few jumbo
+// segments fill; a TSO frame, headers and all, stays under 64KB too.
+#define TCP_TSO_MAXSEGS		((0xFFFF - 54) / TCP_MSS)
+#define TCP_WND			(0xFFFF / TCP_MSS * TCP_MSS)
+#define TCP_SND_BUF		TCP_WND
+#else
+#define TCP_TSO_MAXSEGS		44
 #define TCP_WND			24000
 #define TCP_SND_BUF		(16 * TCP_MSS)
+#endif
 // lwip prints a warning if TCP_SND_QUEUELEN < (2 * TCP_SND_BUF/TCP_MSS), 
 // but 16 is faster.. 
 #define TCP_SND_QUEUELEN	(2 * TCP_SND_BUF/TCP_MSS)
@@ -8,8 +8,13 @@
 #define TIMER_INTERVAL 250
 
 // Virtual address at which to receive page mappings containing client requests.
+// Each request gets room for NSPKT_MAXPAGES pages, for batches of packets.
 #define QUEUE_SIZE	20
-#define REQVA		(0x0ffff000 - QUEUE_SIZE * PGSIZE)
+#define REQVA		(0x0ffff000 - QUEUE_SIZE * NSPKT_MAXPAGES * PGSIZE)
+
+// Where the input and output environments keep the batch of packet
+// pages they are working on.
+#define PKTVA		(REQVA - NSPKT_MAXPAGES * PGSIZE)
 
 /* timer.c */
 void timer(envid_t ns_envid, uint32_t initial_to);
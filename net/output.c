@@ -1,29 +1,49 @@
 #include "ns.h"
 
-extern union Nsipc nsipcbuf;
-
 void
 output(envid_t ns_envid)
 {
+	struct net_sg pkts[NSPKT_MAXPAGES];
+	struct jif_pkt *pkt;
+	int i, n, m, npkts, sent, r;
+
 	binaryname = "ns_output";
 
 	// LAB 6: Your code here:
 	// 	- read a packet from the network server
 	//	- send the packet to the device driver
+	// A request may carry several packets, each starting a page; they
+	// go to the driver together, as many at a time as the transmit
+	// ring takes.
 	while (true) {
 		envid_t whom;
-		int perm, r;
+		int perm;
 
-		r = ipc_recv(&whom, &nsipcbuf, &perm);
+		n = NSPKT_MAXPAGES;
+		r = ipc_recvv(&whom, (void *) PKTVA, &n, &perm);
 		assert(r == NSREQ_OUTPUT);
 		assert(whom == ns_envid);
 		assert(perm & PTE_P);
 
-		for (size_t off = 0, sent; off < nsipcbuf.pkt.jp_len; off += sent) {
-			sent = sys_net_try_send(&nsipcbuf.pkt.jp_data[off],
-						nsipcbuf.pkt.jp_len - off);
-			if (sent == 0)
-				sys_yield();
+		for (i = npkts = 0; i < n; i += m) {
+			pkt = (struct jif_pkt *) (PKTVA + i * PGSIZE);
+			if (pkt->jp_len <= 0 || pkt->jp_len > NET_FRAME_MAX
+			    || (m = JIF_PKT_NPAGES(pkt->jp_len)) > n - i) {
+				cprintf("ns_output: bad packet, %d bytes\n",
+					pkt->jp_len);
+				break;
+			}
+			pkts[npkts].sg_va = pkt->jp_data;
+			pkts[npkts].sg_len = pkt->jp_len;
+			npkts++;
+		}
+		for (i = 0; i < npkts; i += sent) {
+			sent = sys_net_send_batch(&pkts[i], npkts - i);
+			if (sent < 0) {
+				cprintf("ns_output: dropping packet: %e\n", sent);
+				sent = 1;
+			} else if (sent == 0)
+				sys_net_wait(NET_WAIT_TX);
 		}
 	}
 }
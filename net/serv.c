@@ -64,7 +64,7 @@ get_buffer(void) {
 		return 0;
 	}
 
-	va = (void *)(REQVA + i * PGSIZE);
+	va = (void *)(REQVA + i * NSPKT_MAXPAGES * PGSIZE);
 	buse[i] = 1;
 
 	return va;
@@ -72,7 +72,7 @@ get_buffer(void) {
 
 static void
 put_buffer(void *va) {
-	int i = ((uint32_t)va - REQVA) / PGSIZE;
+	int i = ((uint32_t)va - REQVA) / (NSPKT_MAXPAGES * PGSIZE);
 	buse[i] = 0;
 }
 
@@ -181,13 +181,14 @@ struct st_args {
 	int32_t reqno;
 	uint32_t whom;
 	union Nsipc *req;
+	int npages;
 };
 
 static void
 serve_thread(uint32_t a) {
 	struct st_args *args = (struct st_args *)a;
 	union Nsipc *req = args->req;
-	int r;
+	int i, n, len, r;
 
 	switch (args->reqno) {
 	case NSREQ_ACCEPT:
@@ -231,7 +232,18 @@ serve_thread(uint32_t a) {
 				req->socket.req_protocol);
 		break;
 	case NSREQ_INPUT:
-		jif_input(&nif, (void *)&req->pkt);
+		// Each packet starts a page and may go on into the next
+		// ones.  A bad length, or one that runs past the pages
+		// sent, ends the request.
+		for (i = 0; i < args->npages; i += n) {
+			len = req[i].pkt.jp_len;
+			if (len <= 0 || len > NET_FRAME_MAX
+			    || (n = JIF_PKT_NPAGES(len)) > args->npages - i) {
+				cprintf("NS: bad input packet, %d bytes\n", len);
+				break;
+			}
+			jif_input(&nif, (void *)&req[i].pkt);
+		}
 		r = 0;
 		break;
 	default:
@@ -250,7 +262,8 @@ serve_thread(uint32_t a) {
 		ipc_send(args->whom, r, 0, 0);
 
 	put_buffer(args->req);
-	sys_page_unmap(0, (void*) args->req);
+	for (i = 0; i < args->npages; i++)
+		sys_page_unmap(0, (void*) &args->req[i]);
 	free(args);
 }
 
@@ -258,7 +271,7 @@ void
 serve(void) {
 	int32_t reqno;
 	uint32_t whom;
-	int i, perm;
+	int i, perm, npages;
 	void *va;
 
 	while (1) {
@@ -267,10 +280,14 @@ serve(void) {
 		// number of yields in case there's a rogue thread.
 		for (i = 0; thread_wakeups_pending() && i < 32; ++i)
 			thread_yield();
+		// Packets copied for the output environment wait to go
+		// to it together; send them before we block.
+		jif_flush(&nif);
 
 		perm = 0;
 		va = get_buffer();
-		reqno = ipc_recv((int32_t *) &whom, (void *) va, &perm);
+		npages = NSPKT_MAXPAGES;
+		reqno = ipc_recvv((int32_t *) &whom, (void *) va, &npages, &perm);
 		if (debug) {
 			cprintf("ns req %d from %08x\n", reqno, whom);
 		}
@@ -297,6 +314,7 @@ serve(void) {
 		args->reqno = reqno;
 		args->whom = whom;
 		args->req = va;
+		args->npages = npages;
 
 		thread_create(0, "serve_thread", serve_thread, (uint32_t)args);
 		thread_yield(); // let the thread created run
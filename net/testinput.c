@@ -93,9 +93,9 @@ umain(int argc, char **argv)
 
 	while (1) {
 		envid_t whom;
-		int perm;
+		int perm, n = NSPKT_MAXPAGES;
 
-		int32_t req = ipc_recv((int32_t *)&whom, pkt, &perm);
+		int32_t req = ipc_recvv((int32_t *)&whom, pkt, &n, &perm);
 		if (req < 0)
 			panic("ipc_recv: %e", req);
 		if (whom != input_envid)
@@ -103,9 +103,15 @@ umain(int argc, char **argv)
 		if (req != NSREQ_INPUT)
 			panic("Unexpected IPC %d", req);
 
-		hexdump("input: ", pkt->jp_data, pkt->jp_len);
-		cprintf("\n");
-		sys_page_unmap(0, pkt);
+		for (i = 0; i < n; i++) {
+			struct jif_pkt *p = (struct jif_pkt *) ((char *) pkt + i * PGSIZE);
+
+			hexdump("input: ", p->jp_data, p->jp_len);
+			cprintf("\n");
+			i += JIF_PKT_NPAGES(p->jp_len) - 1;
+		}
+		for (i = 0; i < n; i++)
+			sys_page_unmap(0, (char *) pkt + i * PGSIZE);
 
 		// Only indicate that we're waiting for packets once
 		// we've received the ARP reply
@@ -29,7 +29,7 @@ umain(int argc, char **argv)
 		if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
 			panic("sys_page_alloc: %e", r);
 		pkt->jp_len = snprintf(pkt->jp_data,
-				       PGSIZE - sizeof(pkt->jp_len),
+				       PGSIZE - sizeof(struct jif_pkt),
 				       "Packet %02d", i);
 		cprintf("Transmitting packet %d\n", i);
 		ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
@@ -0,0 +1,16531 @@
+
+obj/fs/fs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 7f 52 00 00       	call   8052b0 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ide_wait_ready>:
+
+// Wait for the drive to be ready, letting the file server's other
+// threads run meanwhile.  Callers hold the block cache's disk lock.
+static int
+ide_wait_ready(bool check_error)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	89 c6                	mov    %eax,%esi
+
+static inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  80003a:	bb f7 01 00 00       	mov    $0x1f7,%ebx
+	int r;
+
+	while (((r = inb(0x1F7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+  80003f:	eb 05                	jmp    800046 <ide_wait_ready+0x13>
+		thread_yield();
+  800041:	e8 2e 4c 00 00       	call   804c74 <thread_yield>
+  800046:	89 da                	mov    %ebx,%edx
+  800048:	ec                   	in     (%dx),%al
+	while (((r = inb(0x1F7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+  800049:	89 c2                	mov    %eax,%edx
+  80004b:	83 e2 c0             	and    $0xffffffc0,%edx
+  80004e:	80 fa 40             	cmp    $0x40,%dl
+  800051:	75 ee                	jne    800041 <ide_wait_ready+0xe>
+
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+		return -1;
+	return 0;
+  800053:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+  800058:	89 f1                	mov    %esi,%ecx
+  80005a:	84 c9                	test   %cl,%cl
+  80005c:	74 0a                	je     800068 <ide_wait_ready+0x35>
+  80005e:	a8 21                	test   $0x21,%al
+  800060:	0f 95 c2             	setne  %dl
+  800063:	0f b6 d2             	movzbl %dl,%edx
+  800066:	f7 da                	neg    %edx
+}
+  800068:	89 d0                	mov    %edx,%eax
+  80006a:	5b                   	pop    %ebx
+  80006b:	5e                   	pop    %esi
+  80006c:	5d                   	pop    %ebp
+  80006d:	c3                   	ret
+
+0080006e <ide_probe_disk1>:
+
+bool
+ide_probe_disk1(void)
+{
+  80006e:	55                   	push   %ebp
+  80006f:	89 e5                	mov    %esp,%ebp
+  800071:	53                   	push   %ebx
+  800072:	83 ec 04             	sub    $0x4,%esp
+	int r, x;
+
+	// wait for Device 0 to be ready
+	ide_wait_ready(0);
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007a:	e8 b4 ff ff ff       	call   800033 <ide_wait_ready>
+}
+
+static inline void
+outb(int port, uint8_t data)
+{
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80007f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  800084:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800089:	ee                   	out    %al,(%dx)
+
+	// switch to Device 1
+	outb(0x1F6, 0xE0 | (1<<4));
+
+	// check for Device 1 to be ready for a while
+	for (x = 0;
+  80008a:	b9 00 00 00 00       	mov    $0x0,%ecx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  80008f:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800094:	ec                   	in     (%dx),%al
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  800095:	a8 a1                	test   $0xa1,%al
+  800097:	74 0b                	je     8000a4 <ide_probe_disk1+0x36>
+	     x++)
+  800099:	83 c1 01             	add    $0x1,%ecx
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  80009c:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+  8000a2:	75 f0                	jne    800094 <ide_probe_disk1+0x26>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8000a4:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  8000a9:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  8000ae:	ee                   	out    %al,(%dx)
+		/* do nothing */;
+
+	// switch back to Device 0
+	outb(0x1F6, 0xE0 | (0<<4));
+
+	cprintf("Device 1 presence: %d\n", (x < 1000));
+  8000af:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+  8000b5:	0f 9e c3             	setle  %bl
+  8000b8:	83 ec 08             	sub    $0x8,%esp
+  8000bb:	0f b6 c3             	movzbl %bl,%eax
+  8000be:	50                   	push   %eax
+  8000bf:	68 c0 89 80 00       	push   $0x8089c0
+  8000c4:	e8 25 53 00 00       	call   8053ee <cprintf>
+	return (x < 1000);
+}
+  8000c9:	89 d8                	mov    %ebx,%eax
+  8000cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000ce:	c9                   	leave
+  8000cf:	c3                   	ret
+
+008000d0 <ide_set_disk>:
+
+void
+ide_set_disk(int d)
+{
+  8000d0:	55                   	push   %ebp
+  8000d1:	89 e5                	mov    %esp,%ebp
+  8000d3:	83 ec 08             	sub    $0x8,%esp
+  8000d6:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (d != 0 && d != 1)
+  8000d9:	83 f8 01             	cmp    $0x1,%eax
+  8000dc:	77 07                	ja     8000e5 <ide_set_disk+0x15>
+		panic("bad disk number");
+	diskno = d;
+  8000de:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  8000e3:	c9                   	leave
+  8000e4:	c3                   	ret
+		panic("bad disk number");
+  8000e5:	83 ec 04             	sub    $0x4,%esp
+  8000e8:	68 d7 89 80 00       	push   $0x8089d7
+  8000ed:	6a 3c                	push   $0x3c
+  8000ef:	68 e7 89 80 00       	push   $0x8089e7
+  8000f4:	e8 1a 52 00 00       	call   805313 <_panic>
+
+008000f9 <ide_read>:
+
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+  8000f9:	55                   	push   %ebp
+  8000fa:	89 e5                	mov    %esp,%ebp
+  8000fc:	57                   	push   %edi
+  8000fd:	56                   	push   %esi
+  8000fe:	53                   	push   %ebx
+  8000ff:	83 ec 0c             	sub    $0xc,%esp
+  800102:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800105:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800108:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	assert(nsecs <= 256);
+  80010b:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+  800111:	0f 87 87 00 00 00    	ja     80019e <ide_read+0xa5>
+
+	ide_wait_ready(0);
+  800117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011c:	e8 12 ff ff ff       	call   800033 <ide_wait_ready>
+  800121:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  800126:	89 f0                	mov    %esi,%eax
+  800128:	ee                   	out    %al,(%dx)
+  800129:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  80012e:	89 f8                	mov    %edi,%eax
+  800130:	ee                   	out    %al,(%dx)
+
+	outb(0x1F2, nsecs);
+	outb(0x1F3, secno & 0xFF);
+	outb(0x1F4, (secno >> 8) & 0xFF);
+  800131:	89 f8                	mov    %edi,%eax
+  800133:	c1 e8 08             	shr    $0x8,%eax
+  800136:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  80013b:	ee                   	out    %al,(%dx)
+	outb(0x1F5, (secno >> 16) & 0xFF);
+  80013c:	89 f8                	mov    %edi,%eax
+  80013e:	c1 e8 10             	shr    $0x10,%eax
+  800141:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800146:	ee                   	out    %al,(%dx)
+	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  800147:	0f b6 05 00 a0 80 00 	movzbl 0x80a000,%eax
+  80014e:	c1 e0 04             	shl    $0x4,%eax
+  800151:	83 e0 10             	and    $0x10,%eax
+  800154:	c1 ef 18             	shr    $0x18,%edi
+  800157:	83 e7 0f             	and    $0xf,%edi
+  80015a:	09 f8                	or     %edi,%eax
+  80015c:	83 c8 e0             	or     $0xffffffe0,%eax
+  80015f:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800164:	ee                   	out    %al,(%dx)
+  800165:	b8 20 00 00 00       	mov    $0x20,%eax
+  80016a:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80016f:	ee                   	out    %al,(%dx)
+  800170:	c1 e6 09             	shl    $0x9,%esi
+  800173:	01 de                	add    %ebx,%esi
+	outb(0x1F7, 0x20);	// CMD 0x20 means read sector
+
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  800175:	39 f3                	cmp    %esi,%ebx
+  800177:	74 3b                	je     8001b4 <ide_read+0xbb>
+		if ((r = ide_wait_ready(1)) < 0)
+  800179:	b8 01 00 00 00       	mov    $0x1,%eax
+  80017e:	e8 b0 fe ff ff       	call   800033 <ide_wait_ready>
+  800183:	85 c0                	test   %eax,%eax
+  800185:	78 32                	js     8001b9 <ide_read+0xc0>
+	asm volatile("cld\n\trepne\n\tinsl"
+  800187:	89 df                	mov    %ebx,%edi
+  800189:	b9 80 00 00 00       	mov    $0x80,%ecx
+  80018e:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800193:	fc                   	cld
+  800194:	f2 6d                	repnz insl (%dx),%es:(%edi)
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  800196:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  80019c:	eb d7                	jmp    800175 <ide_read+0x7c>
+	assert(nsecs <= 256);
+  80019e:	68 f0 89 80 00       	push   $0x8089f0
+  8001a3:	68 fd 89 80 00       	push   $0x8089fd
+  8001a8:	6a 46                	push   $0x46
+  8001aa:	68 e7 89 80 00       	push   $0x8089e7
+  8001af:	e8 5f 51 00 00       	call   805313 <_panic>
+			return r;
+		insl(0x1F0, dst, SECTSIZE/4);
+	}
+
+	return 0;
+  8001b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8001b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001bc:	5b                   	pop    %ebx
+  8001bd:	5e                   	pop    %esi
+  8001be:	5f                   	pop    %edi
+  8001bf:	5d                   	pop    %ebp
+  8001c0:	c3                   	ret
+
+008001c1 <ide_write>:
+
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs)
+{
+  8001c1:	55                   	push   %ebp
+  8001c2:	89 e5                	mov    %esp,%ebp
+  8001c4:	57                   	push   %edi
+  8001c5:	56                   	push   %esi
+  8001c6:	53                   	push   %ebx
+  8001c7:	83 ec 0c             	sub    $0xc,%esp
+  8001ca:	8b 75 08             	mov    0x8(%ebp),%esi
+  8001cd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001d0:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int r;
+
+	assert(nsecs <= 256);
+  8001d3:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+  8001d9:	0f 87 87 00 00 00    	ja     800266 <ide_write+0xa5>
+
+	ide_wait_ready(0);
+  8001df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e4:	e8 4a fe ff ff       	call   800033 <ide_wait_ready>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8001e9:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  8001ee:	89 f8                	mov    %edi,%eax
+  8001f0:	ee                   	out    %al,(%dx)
+  8001f1:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  8001f6:	89 f0                	mov    %esi,%eax
+  8001f8:	ee                   	out    %al,(%dx)
+
+	outb(0x1F2, nsecs);
+	outb(0x1F3, secno & 0xFF);
+	outb(0x1F4, (secno >> 8) & 0xFF);
+  8001f9:	89 f0                	mov    %esi,%eax
+  8001fb:	c1 e8 08             	shr    $0x8,%eax
+  8001fe:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  800203:	ee                   	out    %al,(%dx)
+	outb(0x1F5, (secno >> 16) & 0xFF);
+  800204:	89 f0                	mov    %esi,%eax
+  800206:	c1 e8 10             	shr    $0x10,%eax
+  800209:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  80020e:	ee                   	out    %al,(%dx)
+	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  80020f:	0f b6 05 00 a0 80 00 	movzbl 0x80a000,%eax
+  800216:	c1 e0 04             	shl    $0x4,%eax
+  800219:	83 e0 10             	and    $0x10,%eax
+  80021c:	c1 ee 18             	shr    $0x18,%esi
+  80021f:	83 e6 0f             	and    $0xf,%esi
+  800222:	09 f0                	or     %esi,%eax
+  800224:	83 c8 e0             	or     $0xffffffe0,%eax
+  800227:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  80022c:	ee                   	out    %al,(%dx)
+  80022d:	b8 30 00 00 00       	mov    $0x30,%eax
+  800232:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800237:	ee                   	out    %al,(%dx)
+  800238:	c1 e7 09             	shl    $0x9,%edi
+  80023b:	01 df                	add    %ebx,%edi
+	outb(0x1F7, 0x30);	// CMD 0x30 means write sector
+
+	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  80023d:	39 fb                	cmp    %edi,%ebx
+  80023f:	74 3b                	je     80027c <ide_write+0xbb>
+		if ((r = ide_wait_ready(1)) < 0)
+  800241:	b8 01 00 00 00       	mov    $0x1,%eax
+  800246:	e8 e8 fd ff ff       	call   800033 <ide_wait_ready>
+  80024b:	85 c0                	test   %eax,%eax
+  80024d:	78 32                	js     800281 <ide_write+0xc0>
+}
+
+static inline void
+outsl(int port, const void *addr, int cnt)
+{
+	asm volatile("cld\n\trepne\n\toutsl"
+  80024f:	89 de                	mov    %ebx,%esi
+  800251:	b9 80 00 00 00       	mov    $0x80,%ecx
+  800256:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  80025b:	fc                   	cld
+  80025c:	f2 6f                	repnz outsl %ds:(%esi),(%dx)
+	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  80025e:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  800264:	eb d7                	jmp    80023d <ide_write+0x7c>
+	assert(nsecs <= 256);
+  800266:	68 f0 89 80 00       	push   $0x8089f0
+  80026b:	68 fd 89 80 00       	push   $0x8089fd
+  800270:	6a 5f                	push   $0x5f
+  800272:	68 e7 89 80 00       	push   $0x8089e7
+  800277:	e8 97 50 00 00       	call   805313 <_panic>
+			return r;
+		outsl(0x1F0, src, SECTSIZE/4);
+	}
+
+	return 0;
+  80027c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800281:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800284:	5b                   	pop    %ebx
+  800285:	5e                   	pop    %esi
+  800286:	5f                   	pop    %edi
+  800287:	5d                   	pop    %ebp
+  800288:	c3                   	ret
+
+00800289 <bc_slot_drop>:
+}
+
+// Forget slot i, keeping the slot array dense.
+static void
+bc_slot_drop(uint32_t i)
+{
+  800289:	89 c2                	mov    %eax,%edx
+	bc_slots[i] = bc_slots[--bc_nslots];
+  80028b:	a1 04 c1 85 00       	mov    0x85c104,%eax
+  800290:	83 e8 01             	sub    $0x1,%eax
+  800293:	a3 04 c1 85 00       	mov    %eax,0x85c104
+  800298:	8b 04 85 20 c1 85 00 	mov    0x85c120(,%eax,4),%eax
+  80029f:	89 04 95 20 c1 85 00 	mov    %eax,0x85c120(,%edx,4)
+}
+  8002a6:	c3                   	ret
+
+008002a7 <bc_slot_forget>:
+
+// Give up block 'blockno''s slot, if it has one, so that a later
+// insertion does not give it a second one.
+static void
+bc_slot_forget(uint32_t blockno)
+{
+  8002a7:	89 c2                	mov    %eax,%edx
+	uint32_t i;
+
+	for (i = 0; i < bc_nslots; i++)
+  8002a9:	8b 0d 04 c1 85 00    	mov    0x85c104,%ecx
+  8002af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b4:	eb 03                	jmp    8002b9 <bc_slot_forget+0x12>
+  8002b6:	83 c0 01             	add    $0x1,%eax
+  8002b9:	39 c1                	cmp    %eax,%ecx
+  8002bb:	74 16                	je     8002d3 <bc_slot_forget+0x2c>
+		if (bc_slots[i] == blockno) {
+  8002bd:	39 14 85 20 c1 85 00 	cmp    %edx,0x85c120(,%eax,4)
+  8002c4:	75 f0                	jne    8002b6 <bc_slot_forget+0xf>
+{
+  8002c6:	55                   	push   %ebp
+  8002c7:	89 e5                	mov    %esp,%ebp
+  8002c9:	83 ec 08             	sub    $0x8,%esp
+			bc_slot_drop(i);
+  8002cc:	e8 b8 ff ff ff       	call   800289 <bc_slot_drop>
+			return;
+		}
+}
+  8002d1:	c9                   	leave
+  8002d2:	c3                   	ret
+  8002d3:	c3                   	ret
+
+008002d4 <bc_is_busy>:
+}
+
+// Is block 'blockno' being read in by some thread?
+static bool
+bc_is_busy(uint32_t blockno)
+{
+  8002d4:	89 c1                	mov    %eax,%ecx
+	return (bc_busy[blockno / 32] & (1 << (blockno % 32))) != 0;
+  8002d6:	c1 e8 05             	shr    $0x5,%eax
+  8002d9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8002de:	d3 e2                	shl    %cl,%edx
+  8002e0:	23 14 85 40 60 82 00 	and    0x826040(,%eax,4),%edx
+  8002e7:	0f 95 c0             	setne  %al
+}
+  8002ea:	c3                   	ret
+
+008002eb <bc_pgfault>:
+
+// Fault any disk block that is read in to memory by
+// loading it from disk.
+static void
+bc_pgfault(struct UTrapframe *utf)
+{
+  8002eb:	55                   	push   %ebp
+  8002ec:	89 e5                	mov    %esp,%ebp
+  8002ee:	53                   	push   %ebx
+  8002ef:	83 ec 04             	sub    $0x4,%esp
+  8002f2:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8002f5:	8b 08                	mov    (%eax),%ecx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  8002f7:	8d 91 00 00 00 f0    	lea    -0x10000000(%ecx),%edx
+	uint32_t *esp;
+
+	// Check that the fault was within the block cache region
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  8002fd:	81 fa ff ff ff bf    	cmp    $0xbfffffff,%edx
+  800303:	77 30                	ja     800335 <bc_pgfault+0x4a>
+		panic("page fault in FS: eip %08x, va %08x, err %04x",
+		      utf->utf_eip, addr, utf->utf_err);
+
+	// Sanity check the block number.
+	if (super && blockno >= super->s_nblocks)
+  800305:	8b 1d 24 01 86 00    	mov    0x860124,%ebx
+  80030b:	85 db                	test   %ebx,%ebx
+  80030d:	74 08                	je     800317 <bc_pgfault+0x2c>
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  80030f:	c1 ea 0c             	shr    $0xc,%edx
+	if (super && blockno >= super->s_nblocks)
+  800312:	3b 53 04             	cmp    0x4(%ebx),%edx
+  800315:	73 3c                	jae    800353 <bc_pgfault+0x68>
+		panic("reading non-existent block %08x\n", blockno);
+
+	// Don't wait for the disk here on the exception stack, which all
+	// threads share.  Make the faulting thread call bc_fill(addr) on
+	// its own stack instead, through bc_resume, and then retry.
+	esp = (uint32_t *) utf->utf_esp;
+  800317:	8b 50 30             	mov    0x30(%eax),%edx
+	esp[-1] = utf->utf_eip;
+  80031a:	8b 58 28             	mov    0x28(%eax),%ebx
+  80031d:	89 5a fc             	mov    %ebx,-0x4(%edx)
+	esp[-2] = (uint32_t) addr;
+  800320:	89 4a f8             	mov    %ecx,-0x8(%edx)
+	utf->utf_esp = (uint32_t) (esp - 2);
+  800323:	83 ea 08             	sub    $0x8,%edx
+  800326:	89 50 30             	mov    %edx,0x30(%eax)
+	utf->utf_eip = (uint32_t) bc_resume;
+  800329:	c7 40 28 86 4d 80 00 	movl   $0x804d86,0x28(%eax)
+}
+  800330:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800333:	c9                   	leave
+  800334:	c3                   	ret
+		panic("page fault in FS: eip %08x, va %08x, err %04x",
+  800335:	83 ec 08             	sub    $0x8,%esp
+  800338:	ff 70 04             	push   0x4(%eax)
+  80033b:	51                   	push   %ecx
+  80033c:	ff 70 28             	push   0x28(%eax)
+  80033f:	68 14 8a 80 00       	push   $0x808a14
+  800344:	68 3f 01 00 00       	push   $0x13f
+  800349:	68 10 8b 80 00       	push   $0x808b10
+  80034e:	e8 c0 4f 00 00       	call   805313 <_panic>
+		panic("reading non-existent block %08x\n", blockno);
+  800353:	52                   	push   %edx
+  800354:	68 44 8a 80 00       	push   $0x808a44
+  800359:	68 44 01 00 00       	push   $0x144
+  80035e:	68 10 8b 80 00       	push   $0x808b10
+  800363:	e8 ab 4f 00 00       	call   805313 <_panic>
+
+00800368 <diskaddr>:
+{
+  800368:	55                   	push   %ebp
+  800369:	89 e5                	mov    %esp,%ebp
+  80036b:	83 ec 08             	sub    $0x8,%esp
+  80036e:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  800371:	85 c0                	test   %eax,%eax
+  800373:	74 19                	je     80038e <diskaddr+0x26>
+  800375:	8b 15 24 01 86 00    	mov    0x860124,%edx
+  80037b:	85 d2                	test   %edx,%edx
+  80037d:	74 05                	je     800384 <diskaddr+0x1c>
+  80037f:	3b 42 04             	cmp    0x4(%edx),%eax
+  800382:	73 0a                	jae    80038e <diskaddr+0x26>
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  800384:	05 00 00 01 00       	add    $0x10000,%eax
+  800389:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80038c:	c9                   	leave
+  80038d:	c3                   	ret
+		panic("bad block number %08x in diskaddr", blockno);
+  80038e:	50                   	push   %eax
+  80038f:	68 68 8a 80 00       	push   $0x808a68
+  800394:	6a 3e                	push   $0x3e
+  800396:	68 10 8b 80 00       	push   $0x808b10
+  80039b:	e8 73 4f 00 00       	call   805313 <_panic>
+
+008003a0 <va_is_mapped>:
+{
+  8003a0:	55                   	push   %ebp
+  8003a1:	89 e5                	mov    %esp,%ebp
+  8003a3:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8003a6:	89 d0                	mov    %edx,%eax
+  8003a8:	c1 e8 16             	shr    $0x16,%eax
+  8003ab:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8003b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b7:	f6 c1 01             	test   $0x1,%cl
+  8003ba:	74 0d                	je     8003c9 <va_is_mapped+0x29>
+  8003bc:	c1 ea 0c             	shr    $0xc,%edx
+  8003bf:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8003c6:	83 e0 01             	and    $0x1,%eax
+  8003c9:	83 e0 01             	and    $0x1,%eax
+}
+  8003cc:	5d                   	pop    %ebp
+  8003cd:	c3                   	ret
+
+008003ce <bc_lookup>:
+{
+  8003ce:	55                   	push   %ebp
+  8003cf:	89 e5                	mov    %esp,%ebp
+  8003d1:	53                   	push   %ebx
+  8003d2:	83 ec 10             	sub    $0x10,%esp
+	void *va = diskaddr(blockno);
+  8003d5:	ff 75 08             	push   0x8(%ebp)
+  8003d8:	e8 8b ff ff ff       	call   800368 <diskaddr>
+  8003dd:	89 c3                	mov    %eax,%ebx
+	if (va_is_mapped(va))
+  8003df:	89 04 24             	mov    %eax,(%esp)
+  8003e2:	e8 b9 ff ff ff       	call   8003a0 <va_is_mapped>
+  8003e7:	83 c4 10             	add    $0x10,%esp
+  8003ea:	84 c0                	test   %al,%al
+  8003ec:	74 07                	je     8003f5 <bc_lookup+0x27>
+		bcstats.bs_hits++;
+  8003ee:	83 05 00 60 82 00 01 	addl   $0x1,0x826000
+}
+  8003f5:	89 d8                	mov    %ebx,%eax
+  8003f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003fa:	c9                   	leave
+  8003fb:	c3                   	ret
+
+008003fc <va_is_dirty>:
+{
+  8003fc:	55                   	push   %ebp
+  8003fd:	89 e5                	mov    %esp,%ebp
+	return (uvpt[PGNUM(va)] & PTE_D) != 0;
+  8003ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800402:	c1 e8 0c             	shr    $0xc,%eax
+  800405:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80040c:	c1 e8 06             	shr    $0x6,%eax
+  80040f:	83 e0 01             	and    $0x1,%eax
+}
+  800412:	5d                   	pop    %ebp
+  800413:	c3                   	ret
+
+00800414 <bc_write_list>:
+// ascending order, so the disk sees a single elevator sweep, and runs of
+// consecutive blocks go out as one multi-sector IDE command.  The
+// list is reordered in place.  The caller holds bc_lock.
+static void
+bc_write_list(uint32_t *blocks, uint32_t n)
+{
+  800414:	55                   	push   %ebp
+  800415:	89 e5                	mov    %esp,%ebp
+  800417:	57                   	push   %edi
+  800418:	56                   	push   %esi
+  800419:	53                   	push   %ebx
+  80041a:	83 ec 2c             	sub    $0x2c,%esp
+  80041d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800420:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	for (gap = n / 2; gap > 0; gap /= 2)
+  800423:	d1 ea                	shr    %edx
+  800425:	89 d7                	mov    %edx,%edi
+  800427:	89 c1                	mov    %eax,%ecx
+  800429:	eb 41                	jmp    80046c <bc_write_list+0x58>
+				blocks[j] = blocks[j - gap];
+  80042b:	89 08                	mov    %ecx,(%eax)
+			for (j = i; j >= gap && blocks[j - gap] > b; j -= gap)
+  80042d:	01 d8                	add    %ebx,%eax
+  80042f:	89 f2                	mov    %esi,%edx
+  800431:	39 fa                	cmp    %edi,%edx
+  800433:	72 0c                	jb     800441 <bc_write_list+0x2d>
+  800435:	89 d6                	mov    %edx,%esi
+  800437:	29 fe                	sub    %edi,%esi
+  800439:	8b 0c 18             	mov    (%eax,%ebx,1),%ecx
+  80043c:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+  80043f:	72 ea                	jb     80042b <bc_write_list+0x17>
+			blocks[j] = b;
+  800441:	8b 75 dc             	mov    -0x24(%ebp),%esi
+  800444:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800447:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80044a:	89 04 91             	mov    %eax,(%ecx,%edx,4)
+		for (i = gap; i < n; i++) {
+  80044d:	83 c6 01             	add    $0x1,%esi
+  800450:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800453:	39 c6                	cmp    %eax,%esi
+  800455:	73 13                	jae    80046a <bc_write_list+0x56>
+			b = blocks[i];
+  800457:	8b 04 b1             	mov    (%ecx,%esi,4),%eax
+  80045a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			for (j = i; j >= gap && blocks[j - gap] > b; j -= gap)
+  80045d:	8d 04 b1             	lea    (%ecx,%esi,4),%eax
+  800460:	89 f2                	mov    %esi,%edx
+  800462:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  800465:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  800468:	eb c7                	jmp    800431 <bc_write_list+0x1d>
+	for (gap = n / 2; gap > 0; gap /= 2)
+  80046a:	d1 ef                	shr    %edi
+  80046c:	85 ff                	test   %edi,%edi
+  80046e:	74 64                	je     8004d4 <bc_write_list+0xc0>
+  800470:	8d 1c bd 00 00 00 00 	lea    0x0(,%edi,4),%ebx
+  800477:	f7 db                	neg    %ebx
+		for (i = gap; i < n; i++) {
+  800479:	89 fe                	mov    %edi,%esi
+  80047b:	eb d3                	jmp    800450 <bc_write_list+0x3c>
+	for (i = j = 0; i < n; i++) {
+		va = bc_va(blocks[i]);
+		if ((j > 0 && blocks[j - 1] == blocks[i])
+		    || !va_is_mapped(va) || !va_is_dirty(va))
+			continue;
+		blocks[j++] = blocks[i];
+  80047d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800480:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800483:	89 34 81             	mov    %esi,(%ecx,%eax,4)
+  800486:	8d 40 01             	lea    0x1(%eax),%eax
+  800489:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	for (i = j = 0; i < n; i++) {
+  80048c:	83 c7 01             	add    $0x1,%edi
+  80048f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800492:	39 c7                	cmp    %eax,%edi
+  800494:	74 46                	je     8004dc <bc_write_list+0xc8>
+		va = bc_va(blocks[i]);
+  800496:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800499:	8b 34 b8             	mov    (%eax,%edi,4),%esi
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  80049c:	8d 9e 00 00 01 00    	lea    0x10000(%esi),%ebx
+  8004a2:	c1 e3 0c             	shl    $0xc,%ebx
+		if ((j > 0 && blocks[j - 1] == blocks[i])
+  8004a5:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8004a8:	85 d2                	test   %edx,%edx
+  8004aa:	74 06                	je     8004b2 <bc_write_list+0x9e>
+  8004ac:	3b 74 90 fc          	cmp    -0x4(%eax,%edx,4),%esi
+  8004b0:	74 da                	je     80048c <bc_write_list+0x78>
+		    || !va_is_mapped(va) || !va_is_dirty(va))
+  8004b2:	83 ec 0c             	sub    $0xc,%esp
+  8004b5:	53                   	push   %ebx
+  8004b6:	e8 e5 fe ff ff       	call   8003a0 <va_is_mapped>
+  8004bb:	83 c4 10             	add    $0x10,%esp
+  8004be:	84 c0                	test   %al,%al
+  8004c0:	74 ca                	je     80048c <bc_write_list+0x78>
+  8004c2:	83 ec 0c             	sub    $0xc,%esp
+  8004c5:	53                   	push   %ebx
+  8004c6:	e8 31 ff ff ff       	call   8003fc <va_is_dirty>
+  8004cb:	83 c4 10             	add    $0x10,%esp
+  8004ce:	84 c0                	test   %al,%al
+  8004d0:	75 ab                	jne    80047d <bc_write_list+0x69>
+  8004d2:	eb b8                	jmp    80048c <bc_write_list+0x78>
+	for (i = j = 0; i < n; i++) {
+  8004d4:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  8004d7:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8004da:	eb b3                	jmp    80048f <bc_write_list+0x7b>
+	}
+	n = j;
+
+	for (i = 0; i < n; i += len) {
+  8004dc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8004df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004e2:	e9 98 00 00 00       	jmp    80057f <bc_write_list+0x16b>
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  8004e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004ea:	8d 99 00 00 01 00    	lea    0x10000(%ecx),%ebx
+  8004f0:	c1 e3 0c             	shl    $0xc,%ebx
+		start = blocks[i];
+		for (len = 1; i + len < n && len < BC_RA_MAX; len++)
+			if (blocks[i + len] != start + len)
+				break;
+		if ((r = ide_write(start * BLKSECTS, bc_va(start), len * BLKSECTS)) < 0)
+  8004f3:	83 ec 04             	sub    $0x4,%esp
+  8004f6:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+  8004fd:	50                   	push   %eax
+  8004fe:	53                   	push   %ebx
+  8004ff:	c1 e1 03             	shl    $0x3,%ecx
+  800502:	51                   	push   %ecx
+  800503:	e8 b9 fc ff ff       	call   8001c1 <ide_write>
+  800508:	83 c4 10             	add    $0x10,%esp
+  80050b:	85 c0                	test   %eax,%eax
+  80050d:	78 39                	js     800548 <bc_write_list+0x134>
+			panic("bc_flush_list: ide_write: %e", r);
+		for (j = 0; j < len; j++) {
+  80050f:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  800512:	39 f7                	cmp    %esi,%edi
+  800514:	74 5c                	je     800572 <bc_write_list+0x15e>
+			va = bc_va(start + j);
+			if ((r = sys_page_map(0, va, 0, va, uvpt[PGNUM(va)] & PTE_SYSCALL)) < 0)
+  800516:	89 d8                	mov    %ebx,%eax
+  800518:	c1 e8 0c             	shr    $0xc,%eax
+  80051b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800522:	83 ec 0c             	sub    $0xc,%esp
+  800525:	25 07 0e 00 00       	and    $0xe07,%eax
+  80052a:	50                   	push   %eax
+  80052b:	53                   	push   %ebx
+  80052c:	6a 00                	push   $0x0
+  80052e:	53                   	push   %ebx
+  80052f:	6a 00                	push   $0x0
+  800531:	e8 fd 58 00 00       	call   805e33 <sys_page_map>
+  800536:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80053c:	83 c4 20             	add    $0x20,%esp
+  80053f:	85 c0                	test   %eax,%eax
+  800541:	78 1a                	js     80055d <bc_write_list+0x149>
+		for (j = 0; j < len; j++) {
+  800543:	83 c7 01             	add    $0x1,%edi
+  800546:	eb ca                	jmp    800512 <bc_write_list+0xfe>
+			panic("bc_flush_list: ide_write: %e", r);
+  800548:	50                   	push   %eax
+  800549:	68 18 8b 80 00       	push   $0x808b18
+  80054e:	68 d6 01 00 00       	push   $0x1d6
+  800553:	68 10 8b 80 00       	push   $0x808b10
+  800558:	e8 b6 4d 00 00       	call   805313 <_panic>
+				panic("bc_flush_list: sys_page_map: %e", r);
+  80055d:	50                   	push   %eax
+  80055e:	68 8c 8a 80 00       	push   $0x808a8c
+  800563:	68 da 01 00 00       	push   $0x1da
+  800568:	68 10 8b 80 00       	push   $0x808b10
+  80056d:	e8 a1 4d 00 00       	call   805313 <_panic>
+		}
+		bcstats.bs_writes++;
+  800572:	83 05 14 60 82 00 01 	addl   $0x1,0x826014
+		bcstats.bs_writebacks += len;
+  800579:	01 35 10 60 82 00    	add    %esi,0x826010
+	for (i = 0; i < n; i += len) {
+  80057f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800582:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+  800585:	73 44                	jae    8005cb <bc_write_list+0x1b7>
+		start = blocks[i];
+  800587:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80058a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80058d:	8b 0c 81             	mov    (%ecx,%eax,4),%ecx
+		for (len = 1; i + len < n && len < BC_RA_MAX; len++)
+  800590:	83 c0 01             	add    $0x1,%eax
+  800593:	be 01 00 00 00       	mov    $0x1,%esi
+  800598:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80059b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  80059e:	83 fe 1f             	cmp    $0x1f,%esi
+  8005a1:	0f 87 40 ff ff ff    	ja     8004e7 <bc_write_list+0xd3>
+  8005a7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8005aa:	39 d0                	cmp    %edx,%eax
+  8005ac:	0f 83 35 ff ff ff    	jae    8004e7 <bc_write_list+0xd3>
+			if (blocks[i + len] != start + len)
+  8005b2:	8d 58 01             	lea    0x1(%eax),%ebx
+  8005b5:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8005b8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8005bb:	39 14 87             	cmp    %edx,(%edi,%eax,4)
+  8005be:	0f 85 23 ff ff ff    	jne    8004e7 <bc_write_list+0xd3>
+		for (len = 1; i + len < n && len < BC_RA_MAX; len++)
+  8005c4:	83 c6 01             	add    $0x1,%esi
+  8005c7:	89 d8                	mov    %ebx,%eax
+  8005c9:	eb d3                	jmp    80059e <bc_write_list+0x18a>
+	}
+}
+  8005cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005ce:	5b                   	pop    %ebx
+  8005cf:	5e                   	pop    %esi
+  8005d0:	5f                   	pop    %edi
+  8005d1:	5d                   	pop    %ebp
+  8005d2:	c3                   	ret
+
+008005d3 <bc_unshare>:
+{
+  8005d3:	55                   	push   %ebp
+  8005d4:	89 e5                	mov    %esp,%ebp
+  8005d6:	56                   	push   %esi
+  8005d7:	53                   	push   %ebx
+  8005d8:	8b 75 08             	mov    0x8(%ebp),%esi
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  8005db:	8d 9e 00 00 01 00    	lea    0x10000(%esi),%ebx
+  8005e1:	c1 e3 0c             	shl    $0xc,%ebx
+	if (va_is_mapped(va) && pageref(va) > 1) {
+  8005e4:	83 ec 0c             	sub    $0xc,%esp
+  8005e7:	53                   	push   %ebx
+  8005e8:	e8 b3 fd ff ff       	call   8003a0 <va_is_mapped>
+  8005ed:	83 c4 10             	add    $0x10,%esp
+  8005f0:	84 c0                	test   %al,%al
+  8005f2:	75 07                	jne    8005fb <bc_unshare+0x28>
+}
+  8005f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005f7:	5b                   	pop    %ebx
+  8005f8:	5e                   	pop    %esi
+  8005f9:	5d                   	pop    %ebp
+  8005fa:	c3                   	ret
+	if (va_is_mapped(va) && pageref(va) > 1) {
+  8005fb:	83 ec 0c             	sub    $0xc,%esp
+  8005fe:	53                   	push   %ebx
+  8005ff:	e8 f6 74 00 00       	call   807afa <pageref>
+  800604:	83 c4 10             	add    $0x10,%esp
+  800607:	83 f8 01             	cmp    $0x1,%eax
+  80060a:	7e e8                	jle    8005f4 <bc_unshare+0x21>
+		if ((r = sys_page_unmap(0, va)) < 0)
+  80060c:	83 ec 08             	sub    $0x8,%esp
+  80060f:	53                   	push   %ebx
+  800610:	6a 00                	push   $0x0
+  800612:	e8 5e 58 00 00       	call   805e75 <sys_page_unmap>
+  800617:	83 c4 10             	add    $0x10,%esp
+  80061a:	85 c0                	test   %eax,%eax
+  80061c:	78 09                	js     800627 <bc_unshare+0x54>
+		bc_slot_forget(blockno);
+  80061e:	89 f0                	mov    %esi,%eax
+  800620:	e8 82 fc ff ff       	call   8002a7 <bc_slot_forget>
+}
+  800625:	eb cd                	jmp    8005f4 <bc_unshare+0x21>
+			panic("bc_unshare: sys_page_unmap: %e", r);
+  800627:	50                   	push   %eax
+  800628:	68 ac 8a 80 00       	push   $0x808aac
+  80062d:	68 aa 00 00 00       	push   $0xaa
+  800632:	68 10 8b 80 00       	push   $0x808b10
+  800637:	e8 d7 4c 00 00       	call   805313 <_panic>
+
+0080063c <bc_is_pinned>:
+{
+  80063c:	55                   	push   %ebp
+  80063d:	89 e5                	mov    %esp,%ebp
+  80063f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	return (bc_pinned[blockno / 32] & (1 << (blockno % 32))) != 0;
+  800642:	89 ca                	mov    %ecx,%edx
+  800644:	c1 ea 05             	shr    $0x5,%edx
+  800647:	b8 01 00 00 00       	mov    $0x1,%eax
+  80064c:	d3 e0                	shl    %cl,%eax
+  80064e:	23 04 95 e0 30 84 00 	and    0x8430e0(,%edx,4),%eax
+  800655:	0f 95 c0             	setne  %al
+}
+  800658:	5d                   	pop    %ebp
+  800659:	c3                   	ret
+
+0080065a <bc_pin>:
+{
+  80065a:	55                   	push   %ebp
+  80065b:	89 e5                	mov    %esp,%ebp
+  80065d:	56                   	push   %esi
+  80065e:	53                   	push   %ebx
+  80065f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (bc_is_pinned(blockno) || bc_npins == BC_MAXPINS)
+  800662:	83 ec 0c             	sub    $0xc,%esp
+  800665:	53                   	push   %ebx
+  800666:	e8 d1 ff ff ff       	call   80063c <bc_is_pinned>
+  80066b:	83 c4 10             	add    $0x10,%esp
+  80066e:	84 c0                	test   %al,%al
+  800670:	75 38                	jne    8006aa <bc_pin+0x50>
+  800672:	a1 e0 b0 85 00       	mov    0x85b0e0,%eax
+  800677:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80067c:	74 2c                	je     8006aa <bc_pin+0x50>
+	bc_pinned[blockno / 32] |= 1 << (blockno % 32);
+  80067e:	89 de                	mov    %ebx,%esi
+  800680:	c1 ee 05             	shr    $0x5,%esi
+  800683:	ba 01 00 00 00       	mov    $0x1,%edx
+  800688:	89 d9                	mov    %ebx,%ecx
+  80068a:	d3 e2                	shl    %cl,%edx
+  80068c:	09 14 b5 e0 30 84 00 	or     %edx,0x8430e0(,%esi,4)
+	bc_pins[bc_npins++] = blockno;
+  800693:	8d 50 01             	lea    0x1(%eax),%edx
+  800696:	89 15 e0 b0 85 00    	mov    %edx,0x85b0e0
+  80069c:	89 1c 85 00 b1 85 00 	mov    %ebx,0x85b100(,%eax,4)
+	bc_slot_forget(blockno);
+  8006a3:	89 d8                	mov    %ebx,%eax
+  8006a5:	e8 fd fb ff ff       	call   8002a7 <bc_slot_forget>
+}
+  8006aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8006ad:	5b                   	pop    %ebx
+  8006ae:	5e                   	pop    %esi
+  8006af:	5d                   	pop    %ebp
+  8006b0:	c3                   	ret
+
+008006b1 <bc_set_readahead>:
+{
+  8006b1:	55                   	push   %ebp
+  8006b2:	89 e5                	mov    %esp,%ebp
+  8006b4:	83 ec 08             	sub    $0x8,%esp
+	bc_ra[thread_current()] = ra;
+  8006b7:	e8 ff 45 00 00       	call   804cbb <thread_current>
+  8006bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006bf:	89 14 85 a0 e0 83 00 	mov    %edx,0x83e0a0(,%eax,4)
+}
+  8006c6:	c9                   	leave
+  8006c7:	c3                   	ret
+
+008006c8 <flush_block>:
+{
+  8006c8:	55                   	push   %ebp
+  8006c9:	89 e5                	mov    %esp,%ebp
+  8006cb:	56                   	push   %esi
+  8006cc:	53                   	push   %ebx
+  8006cd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  8006d0:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  8006d6:	81 fe ff ff ff bf    	cmp    $0xbfffffff,%esi
+  8006dc:	77 1d                	ja     8006fb <flush_block+0x33>
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8006de:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!va_is_mapped(addr) || !va_is_dirty(addr))
+  8006e4:	83 ec 0c             	sub    $0xc,%esp
+  8006e7:	53                   	push   %ebx
+  8006e8:	e8 b3 fc ff ff       	call   8003a0 <va_is_mapped>
+  8006ed:	83 c4 10             	add    $0x10,%esp
+  8006f0:	84 c0                	test   %al,%al
+  8006f2:	75 1c                	jne    800710 <flush_block+0x48>
+}
+  8006f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8006f7:	5b                   	pop    %ebx
+  8006f8:	5e                   	pop    %esi
+  8006f9:	5d                   	pop    %ebp
+  8006fa:	c3                   	ret
+		panic("flush_block of bad va %08x", addr);
+  8006fb:	53                   	push   %ebx
+  8006fc:	68 35 8b 80 00       	push   $0x808b35
+  800701:	68 9b 01 00 00       	push   $0x19b
+  800706:	68 10 8b 80 00       	push   $0x808b10
+  80070b:	e8 03 4c 00 00       	call   805313 <_panic>
+	if (!va_is_mapped(addr) || !va_is_dirty(addr))
+  800710:	83 ec 0c             	sub    $0xc,%esp
+  800713:	53                   	push   %ebx
+  800714:	e8 e3 fc ff ff       	call   8003fc <va_is_dirty>
+  800719:	83 c4 10             	add    $0x10,%esp
+  80071c:	84 c0                	test   %al,%al
+  80071e:	74 d4                	je     8006f4 <flush_block+0x2c>
+	lock_acquire(&bc_lock, 0);
+  800720:	83 ec 08             	sub    $0x8,%esp
+  800723:	6a 00                	push   $0x0
+  800725:	68 18 60 82 00       	push   $0x826018
+  80072a:	e8 e6 45 00 00       	call   804d15 <lock_acquire>
+	ide_write(blockno * BLKSECTS, addr, BLKSECTS);
+  80072f:	83 c4 0c             	add    $0xc,%esp
+  800732:	6a 08                	push   $0x8
+  800734:	53                   	push   %ebx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  800735:	c1 ee 0c             	shr    $0xc,%esi
+	ide_write(blockno * BLKSECTS, addr, BLKSECTS);
+  800738:	c1 e6 03             	shl    $0x3,%esi
+  80073b:	56                   	push   %esi
+  80073c:	e8 80 fa ff ff       	call   8001c1 <ide_write>
+	if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
+  800741:	89 d8                	mov    %ebx,%eax
+  800743:	c1 e8 0c             	shr    $0xc,%eax
+  800746:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80074d:	25 07 0e 00 00       	and    $0xe07,%eax
+  800752:	89 04 24             	mov    %eax,(%esp)
+  800755:	53                   	push   %ebx
+  800756:	6a 00                	push   $0x0
+  800758:	53                   	push   %ebx
+  800759:	6a 00                	push   $0x0
+  80075b:	e8 d3 56 00 00       	call   805e33 <sys_page_map>
+  800760:	83 c4 20             	add    $0x20,%esp
+  800763:	85 c0                	test   %eax,%eax
+  800765:	78 17                	js     80077e <flush_block+0xb6>
+	lock_release(&bc_lock, 0);
+  800767:	83 ec 08             	sub    $0x8,%esp
+  80076a:	6a 00                	push   $0x0
+  80076c:	68 18 60 82 00       	push   $0x826018
+  800771:	e8 c0 45 00 00       	call   804d36 <lock_release>
+  800776:	83 c4 10             	add    $0x10,%esp
+  800779:	e9 76 ff ff ff       	jmp    8006f4 <flush_block+0x2c>
+		panic("flush_block: sys_page_map: %e\n", r);
+  80077e:	50                   	push   %eax
+  80077f:	68 cc 8a 80 00       	push   $0x808acc
+  800784:	68 a6 01 00 00       	push   $0x1a6
+  800789:	68 10 8b 80 00       	push   $0x808b10
+  80078e:	e8 80 4b 00 00       	call   805313 <_panic>
+
+00800793 <bc_flush_list>:
+
+// Write back the dirty blocks among blocks[0..n-1], as bc_write_list.
+void
+bc_flush_list(uint32_t *blocks, uint32_t n)
+{
+  800793:	55                   	push   %ebp
+  800794:	89 e5                	mov    %esp,%ebp
+  800796:	83 ec 10             	sub    $0x10,%esp
+	lock_acquire(&bc_lock, 0);
+  800799:	6a 00                	push   $0x0
+  80079b:	68 18 60 82 00       	push   $0x826018
+  8007a0:	e8 70 45 00 00       	call   804d15 <lock_acquire>
+	bc_write_list(blocks, n);
+  8007a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007ab:	e8 64 fc ff ff       	call   800414 <bc_write_list>
+	lock_release(&bc_lock, 0);
+  8007b0:	83 c4 08             	add    $0x8,%esp
+  8007b3:	6a 00                	push   $0x0
+  8007b5:	68 18 60 82 00       	push   $0x826018
+  8007ba:	e8 77 45 00 00       	call   804d36 <lock_release>
+}
+  8007bf:	83 c4 10             	add    $0x10,%esp
+  8007c2:	c9                   	leave
+  8007c3:	c3                   	ret
+
+008007c4 <bc_evict>:
+{
+  8007c4:	55                   	push   %ebp
+  8007c5:	89 e5                	mov    %esp,%ebp
+  8007c7:	57                   	push   %edi
+  8007c8:	56                   	push   %esi
+  8007c9:	53                   	push   %ebx
+  8007ca:	83 ec 2c             	sub    $0x2c,%esp
+	uint32_t blockno, passed = 0;
+  8007cd:	be 00 00 00 00       	mov    $0x0,%esi
+	while (bc_nslots > 0) {
+  8007d2:	eb 07                	jmp    8007db <bc_evict+0x17>
+			bc_slot_drop(bc_hand);
+  8007d4:	89 f8                	mov    %edi,%eax
+  8007d6:	e8 ae fa ff ff       	call   800289 <bc_slot_drop>
+	while (bc_nslots > 0) {
+  8007db:	a1 04 c1 85 00       	mov    0x85c104,%eax
+  8007e0:	85 c0                	test   %eax,%eax
+  8007e2:	0f 84 5b 01 00 00    	je     800943 <bc_evict+0x17f>
+		if (bc_hand >= bc_nslots)
+  8007e8:	39 05 00 c1 85 00    	cmp    %eax,0x85c100
+  8007ee:	72 0a                	jb     8007fa <bc_evict+0x36>
+			bc_hand = 0;
+  8007f0:	c7 05 00 c1 85 00 00 	movl   $0x0,0x85c100
+  8007f7:	00 00 00 
+		blockno = bc_slots[bc_hand];
+  8007fa:	8b 3d 00 c1 85 00    	mov    0x85c100,%edi
+  800800:	8b 1c bd 20 c1 85 00 	mov    0x85c120(,%edi,4),%ebx
+  800807:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+		if (bc_is_pinned(blockno) || !va_is_mapped(va)) {
+  80080a:	83 ec 0c             	sub    $0xc,%esp
+  80080d:	53                   	push   %ebx
+  80080e:	e8 29 fe ff ff       	call   80063c <bc_is_pinned>
+  800813:	83 c4 10             	add    $0x10,%esp
+  800816:	84 c0                	test   %al,%al
+  800818:	75 ba                	jne    8007d4 <bc_evict+0x10>
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  80081a:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  800820:	c1 e3 0c             	shl    $0xc,%ebx
+		if (bc_is_pinned(blockno) || !va_is_mapped(va)) {
+  800823:	83 ec 0c             	sub    $0xc,%esp
+  800826:	53                   	push   %ebx
+  800827:	e8 74 fb ff ff       	call   8003a0 <va_is_mapped>
+  80082c:	83 c4 10             	add    $0x10,%esp
+  80082f:	84 c0                	test   %al,%al
+  800831:	74 a1                	je     8007d4 <bc_evict+0x10>
+		if (pageref(va) > 1 && passed++ < 2 * bc_nslots) {
+  800833:	83 ec 0c             	sub    $0xc,%esp
+  800836:	53                   	push   %ebx
+  800837:	e8 be 72 00 00       	call   807afa <pageref>
+  80083c:	83 c4 10             	add    $0x10,%esp
+  80083f:	83 f8 01             	cmp    $0x1,%eax
+  800842:	7e 78                	jle    8008bc <bc_evict+0xf8>
+  800844:	8d 7e 01             	lea    0x1(%esi),%edi
+  800847:	a1 04 c1 85 00       	mov    0x85c104,%eax
+  80084c:	01 c0                	add    %eax,%eax
+  80084e:	39 c6                	cmp    %eax,%esi
+  800850:	72 5c                	jb     8008ae <bc_evict+0xea>
+	return (uvpt[PGNUM(va)] & PTE_A) != 0;
+  800852:	89 de                	mov    %ebx,%esi
+  800854:	c1 ee 0c             	shr    $0xc,%esi
+  800857:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  80085e:	83 e0 20             	and    $0x20,%eax
+  800861:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+		if (va_is_dirty(va)) {
+  800864:	83 ec 0c             	sub    $0xc,%esp
+  800867:	53                   	push   %ebx
+  800868:	e8 8f fb ff ff       	call   8003fc <va_is_dirty>
+  80086d:	83 c4 10             	add    $0x10,%esp
+  800870:	84 c0                	test   %al,%al
+  800872:	75 4c                	jne    8008c0 <bc_evict+0xfc>
+		if (accessed) {
+  800874:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  800878:	0f 84 a2 00 00 00    	je     800920 <bc_evict+0x15c>
+			if ((r = sys_page_map(0, va, 0, va, uvpt[PGNUM(va)] & PTE_SYSCALL)) < 0)
+  80087e:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  800885:	83 ec 0c             	sub    $0xc,%esp
+  800888:	25 07 0e 00 00       	and    $0xe07,%eax
+  80088d:	50                   	push   %eax
+  80088e:	53                   	push   %ebx
+  80088f:	6a 00                	push   $0x0
+  800891:	53                   	push   %ebx
+  800892:	6a 00                	push   $0x0
+  800894:	e8 9a 55 00 00       	call   805e33 <sys_page_map>
+  800899:	83 c4 20             	add    $0x20,%esp
+  80089c:	85 c0                	test   %eax,%eax
+  80089e:	78 6b                	js     80090b <bc_evict+0x147>
+			bc_hand++;
+  8008a0:	83 05 00 c1 85 00 01 	addl   $0x1,0x85c100
+			continue;
+  8008a7:	89 fe                	mov    %edi,%esi
+  8008a9:	e9 2d ff ff ff       	jmp    8007db <bc_evict+0x17>
+			bc_hand++;
+  8008ae:	83 05 00 c1 85 00 01 	addl   $0x1,0x85c100
+		if (pageref(va) > 1 && passed++ < 2 * bc_nslots) {
+  8008b5:	89 fe                	mov    %edi,%esi
+			continue;
+  8008b7:	e9 1f ff ff ff       	jmp    8007db <bc_evict+0x17>
+  8008bc:	89 f7                	mov    %esi,%edi
+  8008be:	eb 92                	jmp    800852 <bc_evict+0x8e>
+			bc_flush_list(&blockno, 1);
+  8008c0:	83 ec 08             	sub    $0x8,%esp
+  8008c3:	6a 01                	push   $0x1
+  8008c5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8008c8:	50                   	push   %eax
+  8008c9:	e8 c5 fe ff ff       	call   800793 <bc_flush_list>
+			if (accessed && bc_hand < bc_nslots
+  8008ce:	83 c4 10             	add    $0x10,%esp
+  8008d1:	89 fe                	mov    %edi,%esi
+  8008d3:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8008d7:	0f 84 fe fe ff ff    	je     8007db <bc_evict+0x17>
+  8008dd:	a1 00 c1 85 00       	mov    0x85c100,%eax
+  8008e2:	3b 05 04 c1 85 00    	cmp    0x85c104,%eax
+  8008e8:	0f 83 ed fe ff ff    	jae    8007db <bc_evict+0x17>
+			    && bc_slots[bc_hand] == blockno)
+  8008ee:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8008f1:	39 14 85 20 c1 85 00 	cmp    %edx,0x85c120(,%eax,4)
+  8008f8:	0f 85 dd fe ff ff    	jne    8007db <bc_evict+0x17>
+				bc_hand++;
+  8008fe:	83 c0 01             	add    $0x1,%eax
+  800901:	a3 00 c1 85 00       	mov    %eax,0x85c100
+  800906:	e9 d0 fe ff ff       	jmp    8007db <bc_evict+0x17>
+				panic("bc_evict: sys_page_map: %e", r);
+  80090b:	50                   	push   %eax
+  80090c:	68 50 8b 80 00       	push   $0x808b50
+  800911:	68 f7 00 00 00       	push   $0xf7
+  800916:	68 10 8b 80 00       	push   $0x808b10
+  80091b:	e8 f3 49 00 00       	call   805313 <_panic>
+		if ((r = sys_page_unmap(0, va)) < 0)
+  800920:	83 ec 08             	sub    $0x8,%esp
+  800923:	53                   	push   %ebx
+  800924:	6a 00                	push   $0x0
+  800926:	e8 4a 55 00 00       	call   805e75 <sys_page_unmap>
+  80092b:	83 c4 10             	add    $0x10,%esp
+  80092e:	85 c0                	test   %eax,%eax
+  800930:	78 19                	js     80094b <bc_evict+0x187>
+		bc_slot_drop(bc_hand);
+  800932:	a1 00 c1 85 00       	mov    0x85c100,%eax
+  800937:	e8 4d f9 ff ff       	call   800289 <bc_slot_drop>
+		bcstats.bs_evictions++;
+  80093c:	83 05 08 60 82 00 01 	addl   $0x1,0x826008
+}
+  800943:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800946:	5b                   	pop    %ebx
+  800947:	5e                   	pop    %esi
+  800948:	5f                   	pop    %edi
+  800949:	5d                   	pop    %ebp
+  80094a:	c3                   	ret
+			panic("bc_evict: sys_page_unmap: %e", r);
+  80094b:	50                   	push   %eax
+  80094c:	68 6b 8b 80 00       	push   $0x808b6b
+  800951:	68 fd 00 00 00       	push   $0xfd
+  800956:	68 10 8b 80 00       	push   $0x808b10
+  80095b:	e8 b3 49 00 00       	call   805313 <_panic>
+
+00800960 <bc_unpin>:
+{
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	53                   	push   %ebx
+  800964:	83 ec 10             	sub    $0x10,%esp
+  800967:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!bc_is_pinned(blockno))
+  80096a:	53                   	push   %ebx
+  80096b:	e8 cc fc ff ff       	call   80063c <bc_is_pinned>
+  800970:	83 c4 10             	add    $0x10,%esp
+  800973:	84 c0                	test   %al,%al
+  800975:	74 62                	je     8009d9 <bc_unpin+0x79>
+	bc_pinned[blockno / 32] &= ~(1 << (blockno % 32));
+  800977:	89 da                	mov    %ebx,%edx
+  800979:	c1 ea 05             	shr    $0x5,%edx
+  80097c:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  800981:	89 d9                	mov    %ebx,%ecx
+  800983:	d3 c0                	rol    %cl,%eax
+  800985:	21 04 95 e0 30 84 00 	and    %eax,0x8430e0(,%edx,4)
+	for (i = 0; i < bc_npins; i++)
+  80098c:	8b 15 e0 b0 85 00    	mov    0x85b0e0,%edx
+  800992:	b8 00 00 00 00       	mov    $0x0,%eax
+  800997:	39 c2                	cmp    %eax,%edx
+  800999:	74 25                	je     8009c0 <bc_unpin+0x60>
+		if (bc_pins[i] == blockno) {
+  80099b:	39 1c 85 00 b1 85 00 	cmp    %ebx,0x85b100(,%eax,4)
+  8009a2:	74 05                	je     8009a9 <bc_unpin+0x49>
+	for (i = 0; i < bc_npins; i++)
+  8009a4:	83 c0 01             	add    $0x1,%eax
+  8009a7:	eb ee                	jmp    800997 <bc_unpin+0x37>
+			bc_pins[i] = bc_pins[--bc_npins];
+  8009a9:	83 ea 01             	sub    $0x1,%edx
+  8009ac:	89 15 e0 b0 85 00    	mov    %edx,0x85b0e0
+  8009b2:	8b 14 95 00 b1 85 00 	mov    0x85b100(,%edx,4),%edx
+  8009b9:	89 14 85 00 b1 85 00 	mov    %edx,0x85b100(,%eax,4)
+	if (va_is_mapped(bc_va(blockno))) {
+  8009c0:	83 ec 0c             	sub    $0xc,%esp
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  8009c3:	8d 83 00 00 01 00    	lea    0x10000(%ebx),%eax
+  8009c9:	c1 e0 0c             	shl    $0xc,%eax
+	if (va_is_mapped(bc_va(blockno))) {
+  8009cc:	50                   	push   %eax
+  8009cd:	e8 ce f9 ff ff       	call   8003a0 <va_is_mapped>
+  8009d2:	83 c4 10             	add    $0x10,%esp
+  8009d5:	84 c0                	test   %al,%al
+  8009d7:	75 0a                	jne    8009e3 <bc_unpin+0x83>
+}
+  8009d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009dc:	c9                   	leave
+  8009dd:	c3                   	ret
+			bc_evict();
+  8009de:	e8 e1 fd ff ff       	call   8007c4 <bc_evict>
+		while (bc_nslots > 0 && bc_nslots >= bc_budget)
+  8009e3:	a1 04 c1 85 00       	mov    0x85c104,%eax
+  8009e8:	85 c0                	test   %eax,%eax
+  8009ea:	74 08                	je     8009f4 <bc_unpin+0x94>
+  8009ec:	3b 05 04 a0 80 00    	cmp    0x80a004,%eax
+  8009f2:	73 ea                	jae    8009de <bc_unpin+0x7e>
+		bc_slots[bc_nslots++] = blockno;
+  8009f4:	8d 50 01             	lea    0x1(%eax),%edx
+  8009f7:	89 15 04 c1 85 00    	mov    %edx,0x85c104
+  8009fd:	89 1c 85 20 c1 85 00 	mov    %ebx,0x85c120(,%eax,4)
+  800a04:	eb d3                	jmp    8009d9 <bc_unpin+0x79>
+
+00800a06 <bc_set_budget>:
+{
+  800a06:	55                   	push   %ebp
+  800a07:	89 e5                	mov    %esp,%ebp
+  800a09:	83 ec 08             	sub    $0x8,%esp
+  800a0c:	8b 45 08             	mov    0x8(%ebp),%eax
+	bc_budget = MAX(1, MIN(npages, BC_MAXSLOTS));
+  800a0f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a14:	39 d0                	cmp    %edx,%eax
+  800a16:	0f 47 c2             	cmova  %edx,%eax
+  800a19:	85 c0                	test   %eax,%eax
+  800a1b:	ba 01 00 00 00       	mov    $0x1,%edx
+  800a20:	0f 44 c2             	cmove  %edx,%eax
+  800a23:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	while (bc_nslots > bc_budget)
+  800a28:	eb 05                	jmp    800a2f <bc_set_budget+0x29>
+		bc_evict();
+  800a2a:	e8 95 fd ff ff       	call   8007c4 <bc_evict>
+	while (bc_nslots > bc_budget)
+  800a2f:	a1 04 c1 85 00       	mov    0x85c104,%eax
+  800a34:	39 05 04 a0 80 00    	cmp    %eax,0x80a004
+  800a3a:	72 ee                	jb     800a2a <bc_set_budget+0x24>
+}
+  800a3c:	c9                   	leave
+  800a3d:	c3                   	ret
+
+00800a3e <bc_fill>:
+{
+  800a3e:	55                   	push   %ebp
+  800a3f:	89 e5                	mov    %esp,%ebp
+  800a41:	57                   	push   %edi
+  800a42:	56                   	push   %esi
+  800a43:	53                   	push   %ebx
+  800a44:	83 ec 2c             	sub    $0x2c,%esp
+  800a47:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  800a4a:	8d 83 00 00 00 f0    	lea    -0x10000000(%ebx),%eax
+  800a50:	c1 e8 0c             	shr    $0xc,%eax
+  800a53:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	while (bc_is_busy(blockno))
+  800a56:	89 c6                	mov    %eax,%esi
+  800a58:	eb 05                	jmp    800a5f <bc_fill+0x21>
+		thread_yield();
+  800a5a:	e8 15 42 00 00       	call   804c74 <thread_yield>
+	while (bc_is_busy(blockno))
+  800a5f:	89 f0                	mov    %esi,%eax
+  800a61:	e8 6e f8 ff ff       	call   8002d4 <bc_is_busy>
+  800a66:	84 c0                	test   %al,%al
+  800a68:	75 f0                	jne    800a5a <bc_fill+0x1c>
+	if (va_is_mapped(addr))
+  800a6a:	83 ec 0c             	sub    $0xc,%esp
+  800a6d:	53                   	push   %ebx
+  800a6e:	e8 2d f9 ff ff       	call   8003a0 <va_is_mapped>
+  800a73:	83 c4 10             	add    $0x10,%esp
+  800a76:	84 c0                	test   %al,%al
+  800a78:	74 08                	je     800a82 <bc_fill+0x44>
+}
+  800a7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a7d:	5b                   	pop    %ebx
+  800a7e:	5e                   	pop    %esi
+  800a7f:	5f                   	pop    %edi
+  800a80:	5d                   	pop    %ebp
+  800a81:	c3                   	ret
+	bcstats.bs_misses++;
+  800a82:	83 05 04 60 82 00 01 	addl   $0x1,0x826004
+	struct BcReadahead *ra = bc_ra[thread_current()];
+  800a89:	e8 2d 42 00 00       	call   804cbb <thread_current>
+  800a8e:	8b 34 85 a0 e0 83 00 	mov    0x83e0a0(,%eax,4),%esi
+	if (!ra)
+  800a95:	85 f6                	test   %esi,%esi
+  800a97:	0f 84 ad 00 00 00    	je     800b4a <bc_fill+0x10c>
+	if (!super || !bitmap)
+  800a9d:	83 3d 24 01 86 00 00 	cmpl   $0x0,0x860124
+  800aa4:	0f 84 14 01 00 00    	je     800bbe <bc_fill+0x180>
+  800aaa:	83 3d 20 01 86 00 00 	cmpl   $0x0,0x860120
+  800ab1:	0f 84 10 01 00 00    	je     800bc7 <bc_fill+0x189>
+		ra->ra_size = 1;
+  800ab7:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (blockno == ra->ra_next)
+  800abc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800abf:	3b 0e                	cmp    (%esi),%ecx
+  800ac1:	0f 84 94 00 00 00    	je     800b5b <bc_fill+0x11d>
+  800ac7:	89 46 04             	mov    %eax,0x4(%esi)
+  800aca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800acd:	8d 58 01             	lea    0x1(%eax),%ebx
+		ra->ra_size = 1;
+  800ad0:	bf 01 00 00 00       	mov    $0x1,%edi
+	for (n = 1; n < ra->ra_size; n++)
+  800ad5:	3b 7e 04             	cmp    0x4(%esi),%edi
+  800ad8:	0f 83 b0 00 00 00    	jae    800b8e <bc_fill+0x150>
+		if (blockno + n >= super->s_nblocks
+  800ade:	a1 24 01 86 00       	mov    0x860124,%eax
+  800ae3:	3b 58 04             	cmp    0x4(%eax),%ebx
+  800ae6:	0f 83 a2 00 00 00    	jae    800b8e <bc_fill+0x150>
+		    || va_is_mapped(bc_va(blockno + n))
+  800aec:	83 ec 0c             	sub    $0xc,%esp
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  800aef:	89 d8                	mov    %ebx,%eax
+  800af1:	c1 e0 0c             	shl    $0xc,%eax
+  800af4:	05 00 00 00 10       	add    $0x10000000,%eax
+		    || va_is_mapped(bc_va(blockno + n))
+  800af9:	50                   	push   %eax
+  800afa:	e8 a1 f8 ff ff       	call   8003a0 <va_is_mapped>
+  800aff:	83 c4 10             	add    $0x10,%esp
+  800b02:	84 c0                	test   %al,%al
+  800b04:	0f 85 84 00 00 00    	jne    800b8e <bc_fill+0x150>
+		    || bc_is_busy(blockno + n)
+  800b0a:	89 d8                	mov    %ebx,%eax
+  800b0c:	e8 c3 f7 ff ff       	call   8002d4 <bc_is_busy>
+  800b11:	84 c0                	test   %al,%al
+  800b13:	75 79                	jne    800b8e <bc_fill+0x150>
+		    || !va_is_mapped(&bitmap[(blockno + n) / 32])
+  800b15:	83 ec 0c             	sub    $0xc,%esp
+  800b18:	89 da                	mov    %ebx,%edx
+  800b1a:	c1 ea 05             	shr    $0x5,%edx
+  800b1d:	a1 20 01 86 00       	mov    0x860120,%eax
+  800b22:	8d 04 90             	lea    (%eax,%edx,4),%eax
+  800b25:	50                   	push   %eax
+  800b26:	e8 75 f8 ff ff       	call   8003a0 <va_is_mapped>
+  800b2b:	83 c4 10             	add    $0x10,%esp
+  800b2e:	84 c0                	test   %al,%al
+  800b30:	74 5c                	je     800b8e <bc_fill+0x150>
+		    || block_is_free(blockno + n))
+  800b32:	83 ec 0c             	sub    $0xc,%esp
+  800b35:	53                   	push   %ebx
+  800b36:	e8 de 0a 00 00       	call   801619 <block_is_free>
+  800b3b:	83 c3 01             	add    $0x1,%ebx
+  800b3e:	83 c4 10             	add    $0x10,%esp
+  800b41:	84 c0                	test   %al,%al
+  800b43:	75 49                	jne    800b8e <bc_fill+0x150>
+	for (n = 1; n < ra->ra_size; n++)
+  800b45:	83 c7 01             	add    $0x1,%edi
+  800b48:	eb 8b                	jmp    800ad5 <bc_fill+0x97>
+		ra = &bc_ra_own[thread_current()];
+  800b4a:	e8 6c 41 00 00       	call   804cbb <thread_current>
+  800b4f:	8d 34 c5 40 e0 83 00 	lea    0x83e040(,%eax,8),%esi
+  800b56:	e9 42 ff ff ff       	jmp    800a9d <bc_fill+0x5f>
+		ra->ra_size = MIN(MAX(ra->ra_size, 1) * 2,
+  800b5b:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  800b60:	c1 e8 02             	shr    $0x2,%eax
+  800b63:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b68:	0f 44 c2             	cmove  %edx,%eax
+  800b6b:	ba 20 00 00 00       	mov    $0x20,%edx
+  800b70:	39 d0                	cmp    %edx,%eax
+  800b72:	0f 47 c2             	cmova  %edx,%eax
+  800b75:	8b 56 04             	mov    0x4(%esi),%edx
+  800b78:	85 d2                	test   %edx,%edx
+  800b7a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b7f:	0f 44 d1             	cmove  %ecx,%edx
+  800b82:	01 d2                	add    %edx,%edx
+  800b84:	39 d0                	cmp    %edx,%eax
+  800b86:	0f 47 c2             	cmova  %edx,%eax
+  800b89:	e9 39 ff ff ff       	jmp    800ac7 <bc_fill+0x89>
+	ra->ra_next = blockno + n;
+  800b8e:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  800b91:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b94:	01 f8                	add    %edi,%eax
+  800b96:	89 06                	mov    %eax,(%esi)
+	if (n > 1)
+  800b98:	83 ff 01             	cmp    $0x1,%edi
+  800b9b:	76 0e                	jbe    800bab <bc_fill+0x16d>
+		bcstats.bs_readahead += n - 1;
+  800b9d:	a1 0c 60 82 00       	mov    0x82600c,%eax
+  800ba2:	8d 44 07 ff          	lea    -0x1(%edi,%eax,1),%eax
+  800ba6:	a3 0c 60 82 00       	mov    %eax,0x82600c
+	for (i = 0; i < n; i++)
+  800bab:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800bae:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800bb1:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+  800bb4:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+		bc_busy[(blockno + i) / 32] |= 1 << ((blockno + i) % 32);
+  800bb7:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (i = 0; i < n; i++)
+  800bbc:	eb 25                	jmp    800be3 <bc_fill+0x1a5>
+		return 1;
+  800bbe:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+  800bc5:	eb e4                	jmp    800bab <bc_fill+0x16d>
+  800bc7:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+  800bce:	eb db                	jmp    800bab <bc_fill+0x16d>
+		bc_busy[(blockno + i) / 32] |= 1 << ((blockno + i) % 32);
+  800bd0:	89 c8                	mov    %ecx,%eax
+  800bd2:	c1 e8 05             	shr    $0x5,%eax
+  800bd5:	89 d3                	mov    %edx,%ebx
+  800bd7:	d3 e3                	shl    %cl,%ebx
+  800bd9:	09 1c 85 40 60 82 00 	or     %ebx,0x826040(,%eax,4)
+	for (i = 0; i < n; i++)
+  800be0:	83 c1 01             	add    $0x1,%ecx
+  800be3:	39 f1                	cmp    %esi,%ecx
+  800be5:	75 e9                	jne    800bd0 <bc_fill+0x192>
+	stage = (char *) BC_STAGE_VA + thread_current() * BC_RA_MAX * BLKSIZE;
+  800be7:	e8 cf 40 00 00       	call   804cbb <thread_current>
+  800bec:	c1 e0 11             	shl    $0x11,%eax
+  800bef:	05 00 80 cd 0f       	add    $0xfcd8000,%eax
+  800bf4:	89 c7                	mov    %eax,%edi
+  800bf6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	for (i = 0; i < n; i++)
+  800bf9:	be 00 00 00 00       	mov    $0x0,%esi
+  800bfe:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800c01:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  800c04:	39 de                	cmp    %ebx,%esi
+  800c06:	74 34                	je     800c3c <bc_fill+0x1fe>
+		if ((r = sys_page_alloc(0, stage + i * BLKSIZE, PTE_U | PTE_W | PTE_P)) < 0)
+  800c08:	83 ec 04             	sub    $0x4,%esp
+  800c0b:	6a 07                	push   $0x7
+  800c0d:	57                   	push   %edi
+  800c0e:	6a 00                	push   $0x0
+  800c10:	e8 d3 51 00 00       	call   805de8 <sys_page_alloc>
+  800c15:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800c1b:	83 c4 10             	add    $0x10,%esp
+  800c1e:	85 c0                	test   %eax,%eax
+  800c20:	78 05                	js     800c27 <bc_fill+0x1e9>
+	for (i = 0; i < n; i++)
+  800c22:	83 c6 01             	add    $0x1,%esi
+  800c25:	eb dd                	jmp    800c04 <bc_fill+0x1c6>
+			panic("bc_fill: sys_page_alloc: %e", r);
+  800c27:	50                   	push   %eax
+  800c28:	68 88 8b 80 00       	push   $0x808b88
+  800c2d:	68 6c 01 00 00       	push   $0x16c
+  800c32:	68 10 8b 80 00       	push   $0x808b10
+  800c37:	e8 d7 46 00 00       	call   805313 <_panic>
+	lock_acquire(&bc_lock, 0);
+  800c3c:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  800c3f:	83 ec 08             	sub    $0x8,%esp
+  800c42:	6a 00                	push   $0x0
+  800c44:	68 18 60 82 00       	push   $0x826018
+  800c49:	e8 c7 40 00 00       	call   804d15 <lock_acquire>
+	r = ide_read(blockno * BLKSECTS, stage, n * BLKSECTS);
+  800c4e:	83 c4 0c             	add    $0xc,%esp
+  800c51:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800c54:	c1 e0 03             	shl    $0x3,%eax
+  800c57:	50                   	push   %eax
+  800c58:	ff 75 d8             	push   -0x28(%ebp)
+  800c5b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c5e:	c1 e0 03             	shl    $0x3,%eax
+  800c61:	50                   	push   %eax
+  800c62:	e8 92 f4 ff ff       	call   8000f9 <ide_read>
+  800c67:	89 c6                	mov    %eax,%esi
+	lock_release(&bc_lock, 0);
+  800c69:	83 c4 08             	add    $0x8,%esp
+  800c6c:	6a 00                	push   $0x0
+  800c6e:	68 18 60 82 00       	push   $0x826018
+  800c73:	e8 be 40 00 00       	call   804d36 <lock_release>
+	if (r < 0)
+  800c78:	83 c4 10             	add    $0x10,%esp
+  800c7b:	85 f6                	test   %esi,%esi
+  800c7d:	78 10                	js     800c8f <bc_fill+0x251>
+  800c7f:	8b 75 e0             	mov    -0x20(%ebp),%esi
+	for (i = nslots = 0; i < n; i++)
+  800c82:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c87:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+  800c8a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c8d:	eb 29                	jmp    800cb8 <bc_fill+0x27a>
+		panic("bc_fill: ide_read: %e", r);
+  800c8f:	56                   	push   %esi
+  800c90:	68 a4 8b 80 00       	push   $0x808ba4
+  800c95:	68 71 01 00 00       	push   $0x171
+  800c9a:	68 10 8b 80 00       	push   $0x808b10
+  800c9f:	e8 6f 46 00 00       	call   805313 <_panic>
+		if (!bc_is_pinned(blockno + i))
+  800ca4:	83 ec 0c             	sub    $0xc,%esp
+  800ca7:	56                   	push   %esi
+  800ca8:	e8 8f f9 ff ff       	call   80063c <bc_is_pinned>
+  800cad:	83 c4 10             	add    $0x10,%esp
+			nslots++;
+  800cb0:	3c 01                	cmp    $0x1,%al
+  800cb2:	83 d7 00             	adc    $0x0,%edi
+	for (i = nslots = 0; i < n; i++)
+  800cb5:	83 c6 01             	add    $0x1,%esi
+  800cb8:	39 de                	cmp    %ebx,%esi
+  800cba:	75 e8                	jne    800ca4 <bc_fill+0x266>
+  800cbc:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  800cbf:	eb 05                	jmp    800cc6 <bc_fill+0x288>
+		bc_evict();
+  800cc1:	e8 fe fa ff ff       	call   8007c4 <bc_evict>
+	while (bc_nslots > 0 && bc_nslots + nslots > bc_budget)
+  800cc6:	a1 04 c1 85 00       	mov    0x85c104,%eax
+  800ccb:	85 c0                	test   %eax,%eax
+  800ccd:	0f 84 9d 00 00 00    	je     800d70 <bc_fill+0x332>
+  800cd3:	01 f8                	add    %edi,%eax
+  800cd5:	39 05 04 a0 80 00    	cmp    %eax,0x80a004
+  800cdb:	72 e4                	jb     800cc1 <bc_fill+0x283>
+  800cdd:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  800ce0:	e9 8e 00 00 00       	jmp    800d73 <bc_fill+0x335>
+			panic("bc_fill: sys_page_map: %e", r);
+  800ce5:	50                   	push   %eax
+  800ce6:	68 ba 8b 80 00       	push   $0x808bba
+  800ceb:	68 80 01 00 00       	push   $0x180
+  800cf0:	68 10 8b 80 00       	push   $0x808b10
+  800cf5:	e8 19 46 00 00       	call   805313 <_panic>
+	for (i = 0; i < n; i++) {
+  800cfa:	83 c6 01             	add    $0x1,%esi
+  800cfd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800d03:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800d06:	39 c6                	cmp    %eax,%esi
+  800d08:	74 70                	je     800d7a <bc_fill+0x33c>
+		if ((r = sys_page_map(0, stage + i * BLKSIZE,
+  800d0a:	83 ec 0c             	sub    $0xc,%esp
+  800d0d:	6a 07                	push   $0x7
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  800d0f:	89 f0                	mov    %esi,%eax
+  800d11:	c1 e0 0c             	shl    $0xc,%eax
+  800d14:	05 00 00 00 10       	add    $0x10000000,%eax
+		if ((r = sys_page_map(0, stage + i * BLKSIZE,
+  800d19:	50                   	push   %eax
+  800d1a:	6a 00                	push   $0x0
+  800d1c:	53                   	push   %ebx
+  800d1d:	6a 00                	push   $0x0
+  800d1f:	e8 0f 51 00 00       	call   805e33 <sys_page_map>
+  800d24:	83 c4 20             	add    $0x20,%esp
+  800d27:	85 c0                	test   %eax,%eax
+  800d29:	78 ba                	js     800ce5 <bc_fill+0x2a7>
+		sys_page_unmap(0, stage + i * BLKSIZE);
+  800d2b:	83 ec 08             	sub    $0x8,%esp
+  800d2e:	53                   	push   %ebx
+  800d2f:	6a 00                	push   $0x0
+  800d31:	e8 3f 51 00 00       	call   805e75 <sys_page_unmap>
+		bc_busy[(blockno + i) / 32] &= ~(1 << ((blockno + i) % 32));
+  800d36:	89 f2                	mov    %esi,%edx
+  800d38:	c1 ea 05             	shr    $0x5,%edx
+  800d3b:	89 f8                	mov    %edi,%eax
+  800d3d:	89 f1                	mov    %esi,%ecx
+  800d3f:	d3 e0                	shl    %cl,%eax
+  800d41:	f7 d0                	not    %eax
+  800d43:	21 04 95 40 60 82 00 	and    %eax,0x826040(,%edx,4)
+		if (!bc_is_pinned(blockno + i))
+  800d4a:	89 34 24             	mov    %esi,(%esp)
+  800d4d:	e8 ea f8 ff ff       	call   80063c <bc_is_pinned>
+  800d52:	83 c4 10             	add    $0x10,%esp
+  800d55:	84 c0                	test   %al,%al
+  800d57:	75 a1                	jne    800cfa <bc_fill+0x2bc>
+			bc_slots[bc_nslots++] = blockno + i;
+  800d59:	a1 04 c1 85 00       	mov    0x85c104,%eax
+  800d5e:	8d 50 01             	lea    0x1(%eax),%edx
+  800d61:	89 15 04 c1 85 00    	mov    %edx,0x85c104
+  800d67:	89 34 85 20 c1 85 00 	mov    %esi,0x85c120(,%eax,4)
+  800d6e:	eb 8a                	jmp    800cfa <bc_fill+0x2bc>
+  800d70:	8b 75 e0             	mov    -0x20(%ebp),%esi
+		bc_busy[(blockno + i) / 32] &= ~(1 << ((blockno + i) % 32));
+  800d73:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d78:	eb 89                	jmp    800d03 <bc_fill+0x2c5>
+	if (bitmap && block_is_free(blockno))
+  800d7a:	83 3d 20 01 86 00 00 	cmpl   $0x0,0x860120
+  800d81:	0f 84 f3 fc ff ff    	je     800a7a <bc_fill+0x3c>
+  800d87:	83 ec 0c             	sub    $0xc,%esp
+  800d8a:	ff 75 e0             	push   -0x20(%ebp)
+  800d8d:	e8 87 08 00 00       	call   801619 <block_is_free>
+  800d92:	83 c4 10             	add    $0x10,%esp
+  800d95:	84 c0                	test   %al,%al
+  800d97:	0f 84 dd fc ff ff    	je     800a7a <bc_fill+0x3c>
+		panic("reading free block %08x\n", blockno);
+  800d9d:	ff 75 e0             	push   -0x20(%ebp)
+  800da0:	68 d4 8b 80 00       	push   $0x808bd4
+  800da5:	68 8b 01 00 00       	push   $0x18b
+  800daa:	68 10 8b 80 00       	push   $0x808b10
+  800daf:	e8 5f 45 00 00       	call   805313 <_panic>
+
+00800db4 <bc_insert>:
+// block's cache page, replacing whatever was cached for it, and unmap
+// pg.  For blocks whose contents start out in memory rather than on
+// disk, like delayed allocations.  The block is dirty until written.
+void
+bc_insert(uint32_t blockno, void *pg)
+{
+  800db4:	55                   	push   %ebp
+  800db5:	89 e5                	mov    %esp,%ebp
+  800db7:	57                   	push   %edi
+  800db8:	56                   	push   %esi
+  800db9:	53                   	push   %ebx
+  800dba:	83 ec 0c             	sub    $0xc,%esp
+  800dbd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800dc0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  800dc3:	8d b3 00 00 01 00    	lea    0x10000(%ebx),%esi
+  800dc9:	c1 e6 0c             	shl    $0xc,%esi
+	void *va = bc_va(blockno);
+	int r;
+
+	while (bc_is_busy(blockno))
+  800dcc:	eb 05                	jmp    800dd3 <bc_insert+0x1f>
+		thread_yield();
+  800dce:	e8 a1 3e 00 00       	call   804c74 <thread_yield>
+	while (bc_is_busy(blockno))
+  800dd3:	89 d8                	mov    %ebx,%eax
+  800dd5:	e8 fa f4 ff ff       	call   8002d4 <bc_is_busy>
+  800dda:	84 c0                	test   %al,%al
+  800ddc:	75 f0                	jne    800dce <bc_insert+0x1a>
+	if (!va_is_mapped(va) && !bc_is_pinned(blockno)) {
+  800dde:	83 ec 0c             	sub    $0xc,%esp
+  800de1:	56                   	push   %esi
+  800de2:	e8 b9 f5 ff ff       	call   8003a0 <va_is_mapped>
+  800de7:	83 c4 10             	add    $0x10,%esp
+  800dea:	84 c0                	test   %al,%al
+  800dec:	75 10                	jne    800dfe <bc_insert+0x4a>
+  800dee:	83 ec 0c             	sub    $0xc,%esp
+  800df1:	53                   	push   %ebx
+  800df2:	e8 45 f8 ff ff       	call   80063c <bc_is_pinned>
+  800df7:	83 c4 10             	add    $0x10,%esp
+  800dfa:	84 c0                	test   %al,%al
+  800dfc:	74 37                	je     800e35 <bc_insert+0x81>
+		while (bc_nslots > 0 && bc_nslots >= bc_budget)
+			bc_evict();
+		bc_slots[bc_nslots++] = blockno;
+	}
+	if ((r = sys_page_map(0, pg, 0, va, PTE_U | PTE_W | PTE_P)) < 0)
+  800dfe:	83 ec 0c             	sub    $0xc,%esp
+  800e01:	6a 07                	push   $0x7
+  800e03:	56                   	push   %esi
+  800e04:	6a 00                	push   $0x0
+  800e06:	57                   	push   %edi
+  800e07:	6a 00                	push   $0x0
+  800e09:	e8 25 50 00 00       	call   805e33 <sys_page_map>
+  800e0e:	83 c4 20             	add    $0x20,%esp
+  800e11:	85 c0                	test   %eax,%eax
+  800e13:	78 43                	js     800e58 <bc_insert+0xa4>
+		panic("bc_insert: sys_page_map: %e", r);
+	sys_page_unmap(0, pg);
+  800e15:	83 ec 08             	sub    $0x8,%esp
+  800e18:	57                   	push   %edi
+  800e19:	6a 00                	push   $0x0
+  800e1b:	e8 55 50 00 00       	call   805e75 <sys_page_unmap>
+
+	// Fresh mappings start out clean; write to set PTE_D.
+	*(volatile char *) va = *(volatile char *) va;
+  800e20:	0f b6 06             	movzbl (%esi),%eax
+  800e23:	88 06                	mov    %al,(%esi)
+}
+  800e25:	83 c4 10             	add    $0x10,%esp
+  800e28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2b:	5b                   	pop    %ebx
+  800e2c:	5e                   	pop    %esi
+  800e2d:	5f                   	pop    %edi
+  800e2e:	5d                   	pop    %ebp
+  800e2f:	c3                   	ret
+			bc_evict();
+  800e30:	e8 8f f9 ff ff       	call   8007c4 <bc_evict>
+		while (bc_nslots > 0 && bc_nslots >= bc_budget)
+  800e35:	a1 04 c1 85 00       	mov    0x85c104,%eax
+  800e3a:	85 c0                	test   %eax,%eax
+  800e3c:	74 08                	je     800e46 <bc_insert+0x92>
+  800e3e:	3b 05 04 a0 80 00    	cmp    0x80a004,%eax
+  800e44:	73 ea                	jae    800e30 <bc_insert+0x7c>
+		bc_slots[bc_nslots++] = blockno;
+  800e46:	8d 50 01             	lea    0x1(%eax),%edx
+  800e49:	89 15 04 c1 85 00    	mov    %edx,0x85c104
+  800e4f:	89 1c 85 20 c1 85 00 	mov    %ebx,0x85c120(,%eax,4)
+  800e56:	eb a6                	jmp    800dfe <bc_insert+0x4a>
+		panic("bc_insert: sys_page_map: %e", r);
+  800e58:	50                   	push   %eax
+  800e59:	68 ed 8b 80 00       	push   $0x808bed
+  800e5e:	68 fc 01 00 00       	push   $0x1fc
+  800e63:	68 10 8b 80 00       	push   $0x808b10
+  800e68:	e8 a6 44 00 00       	call   805313 <_panic>
+
+00800e6d <bc_flush>:
+
+// Write back every dirty block in the cache.  The cost is proportional
+// to the number of resident blocks, not to the size of the disk.
+void
+bc_flush(void)
+{
+  800e6d:	55                   	push   %ebp
+  800e6e:	89 e5                	mov    %esp,%ebp
+  800e70:	56                   	push   %esi
+  800e71:	53                   	push   %ebx
+	uint32_t i, n;
+
+	lock_acquire(&bc_lock, 0);
+  800e72:	83 ec 08             	sub    $0x8,%esp
+  800e75:	6a 00                	push   $0x0
+  800e77:	68 18 60 82 00       	push   $0x826018
+  800e7c:	e8 94 3e 00 00       	call   804d15 <lock_acquire>
+	n = 0;
+	for (i = 0; i < bc_nslots; i++)
+  800e81:	8b 0d 04 c1 85 00    	mov    0x85c104,%ecx
+  800e87:	83 c4 10             	add    $0x10,%esp
+  800e8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e8f:	eb 11                	jmp    800ea2 <bc_flush+0x35>
+		bc_dirty[n++] = bc_slots[i];
+  800e91:	8b 04 95 20 c1 85 00 	mov    0x85c120(,%edx,4),%eax
+  800e98:	89 04 95 e0 e0 83 00 	mov    %eax,0x83e0e0(,%edx,4)
+	for (i = 0; i < bc_nslots; i++)
+  800e9f:	83 c2 01             	add    $0x1,%edx
+  800ea2:	39 d1                	cmp    %edx,%ecx
+  800ea4:	75 eb                	jne    800e91 <bc_flush+0x24>
+	for (i = 0; i < bc_npins; i++)
+  800ea6:	8b 1d e0 b0 85 00    	mov    0x85b0e0,%ebx
+  800eac:	8d 34 95 00 00 00 00 	lea    0x0(,%edx,4),%esi
+  800eb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb8:	eb 11                	jmp    800ecb <bc_flush+0x5e>
+		bc_dirty[n++] = bc_pins[i];
+  800eba:	8b 0c 85 00 b1 85 00 	mov    0x85b100(,%eax,4),%ecx
+  800ec1:	89 8c 86 e0 e0 83 00 	mov    %ecx,0x83e0e0(%esi,%eax,4)
+	for (i = 0; i < bc_npins; i++)
+  800ec8:	83 c0 01             	add    $0x1,%eax
+  800ecb:	39 c3                	cmp    %eax,%ebx
+  800ecd:	75 eb                	jne    800eba <bc_flush+0x4d>
+	bc_write_list(bc_dirty, n);
+  800ecf:	01 c2                	add    %eax,%edx
+  800ed1:	b8 e0 e0 83 00       	mov    $0x83e0e0,%eax
+  800ed6:	e8 39 f5 ff ff       	call   800414 <bc_write_list>
+	lock_release(&bc_lock, 0);
+  800edb:	83 ec 08             	sub    $0x8,%esp
+  800ede:	6a 00                	push   $0x0
+  800ee0:	68 18 60 82 00       	push   $0x826018
+  800ee5:	e8 4c 3e 00 00       	call   804d36 <lock_release>
+	bc_flush_due = sys_time_msec() + BC_FLUSH_MSEC;
+  800eea:	e8 98 51 00 00       	call   806087 <sys_time_msec>
+  800eef:	05 e8 03 00 00       	add    $0x3e8,%eax
+  800ef4:	a3 c4 e0 83 00       	mov    %eax,0x83e0c4
+}
+  800ef9:	83 c4 10             	add    $0x10,%esp
+  800efc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eff:	5b                   	pop    %ebx
+  800f00:	5e                   	pop    %esi
+  800f01:	5d                   	pop    %ebp
+  800f02:	c3                   	ret
+
+00800f03 <bc_tick>:
+// Periodic write-back.  The server calls this after requests, and when
+// it has been idle until bc_tick_due(); once BC_FLUSH_MSEC have passed
+// since the last full flush, flush again.
+void
+bc_tick(void)
+{
+  800f03:	55                   	push   %ebp
+  800f04:	89 e5                	mov    %esp,%ebp
+  800f06:	83 ec 08             	sub    $0x8,%esp
+	if ((int32_t) (sys_time_msec() - bc_flush_due) >= 0)
+  800f09:	e8 79 51 00 00       	call   806087 <sys_time_msec>
+  800f0e:	3b 05 c4 e0 83 00    	cmp    0x83e0c4,%eax
+  800f14:	79 02                	jns    800f18 <bc_tick+0x15>
+		bc_flush();
+}
+  800f16:	c9                   	leave
+  800f17:	c3                   	ret
+		bc_flush();
+  800f18:	e8 50 ff ff ff       	call   800e6d <bc_flush>
+}
+  800f1d:	eb f7                	jmp    800f16 <bc_tick+0x13>
+
+00800f1f <bc_tick_due>:
+// When bc_tick next has work to do.
+uint32_t
+bc_tick_due(void)
+{
+	return bc_flush_due;
+}
+  800f1f:	a1 c4 e0 83 00       	mov    0x83e0c4,%eax
+  800f24:	c3                   	ret
+
+00800f25 <bc_init>:
+	cprintf("block cache is good\n");
+}
+
+void
+bc_init(void)
+{
+  800f25:	55                   	push   %ebp
+  800f26:	89 e5                	mov    %esp,%ebp
+  800f28:	53                   	push   %ebx
+  800f29:	81 ec 20 02 00 00    	sub    $0x220,%esp
+	struct Super super;
+	set_pgfault_handler(bc_pgfault);
+  800f2f:	68 eb 02 80 00       	push   $0x8002eb
+  800f34:	e8 b0 52 00 00       	call   8061e9 <set_pgfault_handler>
+	bc_pin(1);
+  800f39:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800f40:	e8 15 f7 ff ff       	call   80065a <bc_pin>
+	bc_flush_due = sys_time_msec() + BC_FLUSH_MSEC;
+  800f45:	e8 3d 51 00 00       	call   806087 <sys_time_msec>
+  800f4a:	05 e8 03 00 00       	add    $0x3e8,%eax
+  800f4f:	a3 c4 e0 83 00       	mov    %eax,0x83e0c4
+	memmove(&backup, diskaddr(1), sizeof backup);
+  800f54:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800f5b:	e8 08 f4 ff ff       	call   800368 <diskaddr>
+  800f60:	83 c4 0c             	add    $0xc,%esp
+  800f63:	68 08 01 00 00       	push   $0x108
+  800f68:	50                   	push   %eax
+  800f69:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  800f6f:	50                   	push   %eax
+  800f70:	e8 ed 4b 00 00       	call   805b62 <memmove>
+	strcpy(diskaddr(1), "OOPS!\n");
+  800f75:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800f7c:	e8 e7 f3 ff ff       	call   800368 <diskaddr>
+  800f81:	83 c4 08             	add    $0x8,%esp
+  800f84:	68 09 8c 80 00       	push   $0x808c09
+  800f89:	50                   	push   %eax
+  800f8a:	e8 4d 4a 00 00       	call   8059dc <strcpy>
+	flush_block(diskaddr(1));
+  800f8f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800f96:	e8 cd f3 ff ff       	call   800368 <diskaddr>
+  800f9b:	89 04 24             	mov    %eax,(%esp)
+  800f9e:	e8 25 f7 ff ff       	call   8006c8 <flush_block>
+	assert(va_is_mapped(diskaddr(1)));
+  800fa3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800faa:	e8 b9 f3 ff ff       	call   800368 <diskaddr>
+  800faf:	89 04 24             	mov    %eax,(%esp)
+  800fb2:	e8 e9 f3 ff ff       	call   8003a0 <va_is_mapped>
+  800fb7:	83 c4 10             	add    $0x10,%esp
+  800fba:	84 c0                	test   %al,%al
+  800fbc:	0f 84 d1 01 00 00    	je     801193 <bc_init+0x26e>
+	assert(!va_is_dirty(diskaddr(1)));
+  800fc2:	83 ec 0c             	sub    $0xc,%esp
+  800fc5:	6a 01                	push   $0x1
+  800fc7:	e8 9c f3 ff ff       	call   800368 <diskaddr>
+  800fcc:	89 04 24             	mov    %eax,(%esp)
+  800fcf:	e8 28 f4 ff ff       	call   8003fc <va_is_dirty>
+  800fd4:	83 c4 10             	add    $0x10,%esp
+  800fd7:	84 c0                	test   %al,%al
+  800fd9:	0f 85 cd 01 00 00    	jne    8011ac <bc_init+0x287>
+	sys_page_unmap(0, diskaddr(1));
+  800fdf:	83 ec 0c             	sub    $0xc,%esp
+  800fe2:	6a 01                	push   $0x1
+  800fe4:	e8 7f f3 ff ff       	call   800368 <diskaddr>
+  800fe9:	83 c4 08             	add    $0x8,%esp
+  800fec:	50                   	push   %eax
+  800fed:	6a 00                	push   $0x0
+  800fef:	e8 81 4e 00 00       	call   805e75 <sys_page_unmap>
+	assert(!va_is_mapped(diskaddr(1)));
+  800ff4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800ffb:	e8 68 f3 ff ff       	call   800368 <diskaddr>
+  801000:	89 04 24             	mov    %eax,(%esp)
+  801003:	e8 98 f3 ff ff       	call   8003a0 <va_is_mapped>
+  801008:	83 c4 10             	add    $0x10,%esp
+  80100b:	84 c0                	test   %al,%al
+  80100d:	0f 85 b2 01 00 00    	jne    8011c5 <bc_init+0x2a0>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  801013:	83 ec 0c             	sub    $0xc,%esp
+  801016:	6a 01                	push   $0x1
+  801018:	e8 4b f3 ff ff       	call   800368 <diskaddr>
+  80101d:	83 c4 08             	add    $0x8,%esp
+  801020:	68 09 8c 80 00       	push   $0x808c09
+  801025:	50                   	push   %eax
+  801026:	e8 62 4a 00 00       	call   805a8d <strcmp>
+  80102b:	83 c4 10             	add    $0x10,%esp
+  80102e:	85 c0                	test   %eax,%eax
+  801030:	0f 85 a8 01 00 00    	jne    8011de <bc_init+0x2b9>
+	memmove(diskaddr(1), &backup, sizeof backup);
+  801036:	83 ec 0c             	sub    $0xc,%esp
+  801039:	6a 01                	push   $0x1
+  80103b:	e8 28 f3 ff ff       	call   800368 <diskaddr>
+  801040:	83 c4 0c             	add    $0xc,%esp
+  801043:	68 08 01 00 00       	push   $0x108
+  801048:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  80104e:	53                   	push   %ebx
+  80104f:	50                   	push   %eax
+  801050:	e8 0d 4b 00 00       	call   805b62 <memmove>
+	flush_block(diskaddr(1));
+  801055:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80105c:	e8 07 f3 ff ff       	call   800368 <diskaddr>
+  801061:	89 04 24             	mov    %eax,(%esp)
+  801064:	e8 5f f6 ff ff       	call   8006c8 <flush_block>
+	memmove(&backup, diskaddr(1), sizeof backup);
+  801069:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801070:	e8 f3 f2 ff ff       	call   800368 <diskaddr>
+  801075:	83 c4 0c             	add    $0xc,%esp
+  801078:	68 08 01 00 00       	push   $0x108
+  80107d:	50                   	push   %eax
+  80107e:	53                   	push   %ebx
+  80107f:	e8 de 4a 00 00       	call   805b62 <memmove>
+	strcpy(diskaddr(1), "OOPS!\n");
+  801084:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80108b:	e8 d8 f2 ff ff       	call   800368 <diskaddr>
+  801090:	83 c4 08             	add    $0x8,%esp
+  801093:	68 09 8c 80 00       	push   $0x808c09
+  801098:	50                   	push   %eax
+  801099:	e8 3e 49 00 00       	call   8059dc <strcpy>
+	flush_block(diskaddr(1) + 20);
+  80109e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8010a5:	e8 be f2 ff ff       	call   800368 <diskaddr>
+  8010aa:	83 c0 14             	add    $0x14,%eax
+  8010ad:	89 04 24             	mov    %eax,(%esp)
+  8010b0:	e8 13 f6 ff ff       	call   8006c8 <flush_block>
+	assert(va_is_mapped(diskaddr(1)));
+  8010b5:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8010bc:	e8 a7 f2 ff ff       	call   800368 <diskaddr>
+  8010c1:	89 04 24             	mov    %eax,(%esp)
+  8010c4:	e8 d7 f2 ff ff       	call   8003a0 <va_is_mapped>
+  8010c9:	83 c4 10             	add    $0x10,%esp
+  8010cc:	84 c0                	test   %al,%al
+  8010ce:	0f 84 23 01 00 00    	je     8011f7 <bc_init+0x2d2>
+	sys_page_unmap(0, diskaddr(1));
+  8010d4:	83 ec 0c             	sub    $0xc,%esp
+  8010d7:	6a 01                	push   $0x1
+  8010d9:	e8 8a f2 ff ff       	call   800368 <diskaddr>
+  8010de:	83 c4 08             	add    $0x8,%esp
+  8010e1:	50                   	push   %eax
+  8010e2:	6a 00                	push   $0x0
+  8010e4:	e8 8c 4d 00 00       	call   805e75 <sys_page_unmap>
+	assert(!va_is_mapped(diskaddr(1)));
+  8010e9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8010f0:	e8 73 f2 ff ff       	call   800368 <diskaddr>
+  8010f5:	89 04 24             	mov    %eax,(%esp)
+  8010f8:	e8 a3 f2 ff ff       	call   8003a0 <va_is_mapped>
+  8010fd:	83 c4 10             	add    $0x10,%esp
+  801100:	84 c0                	test   %al,%al
+  801102:	0f 85 08 01 00 00    	jne    801210 <bc_init+0x2eb>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  801108:	83 ec 0c             	sub    $0xc,%esp
+  80110b:	6a 01                	push   $0x1
+  80110d:	e8 56 f2 ff ff       	call   800368 <diskaddr>
+  801112:	83 c4 08             	add    $0x8,%esp
+  801115:	68 09 8c 80 00       	push   $0x808c09
+  80111a:	50                   	push   %eax
+  80111b:	e8 6d 49 00 00       	call   805a8d <strcmp>
+  801120:	83 c4 10             	add    $0x10,%esp
+  801123:	85 c0                	test   %eax,%eax
+  801125:	0f 85 fe 00 00 00    	jne    801229 <bc_init+0x304>
+	memmove(diskaddr(1), &backup, sizeof backup);
+  80112b:	83 ec 0c             	sub    $0xc,%esp
+  80112e:	6a 01                	push   $0x1
+  801130:	e8 33 f2 ff ff       	call   800368 <diskaddr>
+  801135:	83 c4 0c             	add    $0xc,%esp
+  801138:	68 08 01 00 00       	push   $0x108
+  80113d:	8d 95 e8 fd ff ff    	lea    -0x218(%ebp),%edx
+  801143:	52                   	push   %edx
+  801144:	50                   	push   %eax
+  801145:	e8 18 4a 00 00       	call   805b62 <memmove>
+	flush_block(diskaddr(1));
+  80114a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801151:	e8 12 f2 ff ff       	call   800368 <diskaddr>
+  801156:	89 04 24             	mov    %eax,(%esp)
+  801159:	e8 6a f5 ff ff       	call   8006c8 <flush_block>
+	cprintf("block cache is good\n");
+  80115e:	c7 04 24 45 8c 80 00 	movl   $0x808c45,(%esp)
+  801165:	e8 84 42 00 00       	call   8053ee <cprintf>
+	check_bc();
+
+	// cache the super block by reading it once
+	memmove(&super, diskaddr(1), sizeof super);
+  80116a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801171:	e8 f2 f1 ff ff       	call   800368 <diskaddr>
+  801176:	83 c4 0c             	add    $0xc,%esp
+  801179:	68 08 01 00 00       	push   $0x108
+  80117e:	50                   	push   %eax
+  80117f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  801185:	50                   	push   %eax
+  801186:	e8 d7 49 00 00       	call   805b62 <memmove>
+}
+  80118b:	83 c4 10             	add    $0x10,%esp
+  80118e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801191:	c9                   	leave
+  801192:	c3                   	ret
+	assert(va_is_mapped(diskaddr(1)));
+  801193:	68 2b 8c 80 00       	push   $0x808c2b
+  801198:	68 fd 89 80 00       	push   $0x8089fd
+  80119d:	68 33 02 00 00       	push   $0x233
+  8011a2:	68 10 8b 80 00       	push   $0x808b10
+  8011a7:	e8 67 41 00 00       	call   805313 <_panic>
+	assert(!va_is_dirty(diskaddr(1)));
+  8011ac:	68 10 8c 80 00       	push   $0x808c10
+  8011b1:	68 fd 89 80 00       	push   $0x8089fd
+  8011b6:	68 34 02 00 00       	push   $0x234
+  8011bb:	68 10 8b 80 00       	push   $0x808b10
+  8011c0:	e8 4e 41 00 00       	call   805313 <_panic>
+	assert(!va_is_mapped(diskaddr(1)));
+  8011c5:	68 2a 8c 80 00       	push   $0x808c2a
+  8011ca:	68 fd 89 80 00       	push   $0x8089fd
+  8011cf:	68 38 02 00 00       	push   $0x238
+  8011d4:	68 10 8b 80 00       	push   $0x808b10
+  8011d9:	e8 35 41 00 00       	call   805313 <_panic>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  8011de:	68 ec 8a 80 00       	push   $0x808aec
+  8011e3:	68 fd 89 80 00       	push   $0x8089fd
+  8011e8:	68 3b 02 00 00       	push   $0x23b
+  8011ed:	68 10 8b 80 00       	push   $0x808b10
+  8011f2:	e8 1c 41 00 00       	call   805313 <_panic>
+	assert(va_is_mapped(diskaddr(1)));
+  8011f7:	68 2b 8c 80 00       	push   $0x808c2b
+  8011fc:	68 fd 89 80 00       	push   $0x8089fd
+  801201:	68 4c 02 00 00       	push   $0x24c
+  801206:	68 10 8b 80 00       	push   $0x808b10
+  80120b:	e8 03 41 00 00       	call   805313 <_panic>
+	assert(!va_is_mapped(diskaddr(1)));
+  801210:	68 2a 8c 80 00       	push   $0x808c2a
+  801215:	68 fd 89 80 00       	push   $0x8089fd
+  80121a:	68 54 02 00 00       	push   $0x254
+  80121f:	68 10 8b 80 00       	push   $0x808b10
+  801224:	e8 ea 40 00 00       	call   805313 <_panic>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  801229:	68 ec 8a 80 00       	push   $0x808aec
+  80122e:	68 fd 89 80 00       	push   $0x8089fd
+  801233:	68 57 02 00 00       	push   $0x257
+  801238:	68 10 8b 80 00       	push   $0x808b10
+  80123d:	e8 d1 40 00 00       	call   805313 <_panic>
+
+00801242 <freemap_update>:
+static uint32_t alloc_rotor;	// where goal-less allocations start looking
+
+// Recompute the freemap bit for bitmap word 'idx'.
+static void
+freemap_update(uint32_t idx)
+{
+  801242:	89 c1                	mov    %eax,%ecx
+	if (bitmap[idx])
+  801244:	a1 20 01 86 00       	mov    0x860120,%eax
+  801249:	83 3c 88 00          	cmpl   $0x0,(%eax,%ecx,4)
+  80124d:	74 14                	je     801263 <freemap_update+0x21>
+		freemap[idx / 32] |= 1 << (idx % 32);
+  80124f:	89 ca                	mov    %ecx,%edx
+  801251:	c1 ea 05             	shr    $0x5,%edx
+  801254:	b8 01 00 00 00       	mov    $0x1,%eax
+  801259:	d3 e0                	shl    %cl,%eax
+  80125b:	09 04 95 40 c2 86 00 	or     %eax,0x86c240(,%edx,4)
+  801262:	c3                   	ret
+	else
+		freemap[idx / 32] &= ~(1 << (idx % 32));
+  801263:	89 ca                	mov    %ecx,%edx
+  801265:	c1 ea 05             	shr    $0x5,%edx
+  801268:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  80126d:	d3 c0                	rol    %cl,%eax
+  80126f:	21 04 95 40 c2 86 00 	and    %eax,0x86c240(,%edx,4)
+}
+  801276:	c3                   	ret
+
+00801277 <walk_hint_drop>:
+
+// The inode number of f: its position among all the File slots on disk.
+static uint32_t
+file_ino(struct File *f)
+{
+	return ((uintptr_t) f - DISKMAP) / sizeof(struct File);
+  801277:	2d 00 00 00 10       	sub    $0x10000000,%eax
+  80127c:	c1 e8 08             	shr    $0x8,%eax
+
+// Forget the walk hint if it belongs to f.
+static void
+walk_hint_drop(struct File *f)
+{
+	if (walk_hint.ino == file_ino(f) + 1)
+  80127f:	83 c0 01             	add    $0x1,%eax
+  801282:	39 05 20 c2 86 00    	cmp    %eax,0x86c220
+  801288:	74 01                	je     80128b <walk_hint_drop+0x14>
+		walk_hint.ino = 0;
+}
+  80128a:	c3                   	ret
+		walk_hint.ino = 0;
+  80128b:	c7 05 20 c2 86 00 00 	movl   $0x0,0x86c220
+  801292:	00 00 00 
+}
+  801295:	eb f3                	jmp    80128a <walk_hint_drop+0x13>
+
+00801297 <da_find>:
+static int
+da_find(struct File *f, uint32_t filebno)
+{
+	int i;
+
+	if (da_count == 0)
+  801297:	83 3d 04 72 86 00 00 	cmpl   $0x0,0x867204
+  80129e:	74 59                	je     8012f9 <da_find+0x62>
+{
+  8012a0:	55                   	push   %ebp
+  8012a1:	89 e5                	mov    %esp,%ebp
+  8012a3:	53                   	push   %ebx
+  8012a4:	89 c1                	mov    %eax,%ecx
+  8012a6:	89 d3                	mov    %edx,%ebx
+	return ((uintptr_t) f / sizeof(struct File) * 31 + filebno)
+  8012a8:	89 c2                	mov    %eax,%edx
+  8012aa:	c1 ea 08             	shr    $0x8,%edx
+  8012ad:	89 d0                	mov    %edx,%eax
+  8012af:	c1 e0 05             	shl    $0x5,%eax
+  8012b2:	29 d0                	sub    %edx,%eax
+  8012b4:	01 d8                	add    %ebx,%eax
+		% DELALLOC_NBUCKETS;
+  8012b6:	25 ff 07 00 00       	and    $0x7ff,%eax
+		return -1;
+	for (i = da_buckets[da_hash(f, filebno)] - 1; i >= 0; i = da_ents[i].d_hnext - 1)
+  8012bb:	8b 04 85 20 72 86 00 	mov    0x867220(,%eax,4),%eax
+  8012c2:	83 e8 01             	sub    $0x1,%eax
+  8012c5:	eb 0d                	jmp    8012d4 <da_find+0x3d>
+  8012c7:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8012ca:	8b 04 85 28 92 86 00 	mov    0x869228(,%eax,4),%eax
+  8012d1:	83 e8 01             	sub    $0x1,%eax
+  8012d4:	85 c0                	test   %eax,%eax
+  8012d6:	78 17                	js     8012ef <da_find+0x58>
+		if (da_ents[i].d_file == f && da_ents[i].d_filebno == filebno)
+  8012d8:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8012db:	39 0c 95 20 92 86 00 	cmp    %ecx,0x869220(,%edx,4)
+  8012e2:	75 e3                	jne    8012c7 <da_find+0x30>
+  8012e4:	39 1c 95 24 92 86 00 	cmp    %ebx,0x869224(,%edx,4)
+  8012eb:	75 da                	jne    8012c7 <da_find+0x30>
+  8012ed:	eb 05                	jmp    8012f4 <da_find+0x5d>
+			return i;
+	return -1;
+  8012ef:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  8012f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012f7:	c9                   	leave
+  8012f8:	c3                   	ret
+		return -1;
+  8012f9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  8012fe:	c3                   	ret
+
+008012ff <file_flush_meta>:
+}
+
+// Flush f's indirect blocks, hash index and struct File out to disk.
+static void
+file_flush_meta(struct File *f)
+{
+  8012ff:	55                   	push   %ebp
+  801300:	89 e5                	mov    %esp,%ebp
+  801302:	56                   	push   %esi
+  801303:	53                   	push   %ebx
+  801304:	89 c3                	mov    %eax,%ebx
+	static uint32_t blocks[FLUSH_BATCH];
+	uint32_t i, n, *leaves;
+
+	n = 0;
+	if (f->f_dindirect) {
+  801306:	8b 80 b4 00 00 00    	mov    0xb4(%eax),%eax
+  80130c:	85 c0                	test   %eax,%eax
+  80130e:	75 48                	jne    801358 <file_flush_meta+0x59>
+		for (i = 0; i < NINDIRECT; i++)
+			if (leaves[i])
+				blocks[n++] = leaves[i];
+		blocks[n++] = f->f_dindirect;
+	}
+	if (f->f_indirect)
+  801310:	8b 93 b0 00 00 00    	mov    0xb0(%ebx),%edx
+  801316:	85 d2                	test   %edx,%edx
+  801318:	74 0a                	je     801324 <file_flush_meta+0x25>
+		blocks[n++] = f->f_indirect;
+  80131a:	89 14 85 c0 41 86 00 	mov    %edx,0x8641c0(,%eax,4)
+  801321:	8d 40 01             	lea    0x1(%eax),%eax
+	if (f->f_hindex)
+  801324:	8b 93 b8 00 00 00    	mov    0xb8(%ebx),%edx
+  80132a:	85 d2                	test   %edx,%edx
+  80132c:	74 0a                	je     801338 <file_flush_meta+0x39>
+		blocks[n++] = f->f_hindex;
+  80132e:	89 14 85 c0 41 86 00 	mov    %edx,0x8641c0(,%eax,4)
+  801335:	8d 40 01             	lea    0x1(%eax),%eax
+	bc_flush_list(blocks, n);
+  801338:	83 ec 08             	sub    $0x8,%esp
+  80133b:	50                   	push   %eax
+  80133c:	68 c0 41 86 00       	push   $0x8641c0
+  801341:	e8 4d f4 ff ff       	call   800793 <bc_flush_list>
+	flush_block(f);
+  801346:	89 1c 24             	mov    %ebx,(%esp)
+  801349:	e8 7a f3 ff ff       	call   8006c8 <flush_block>
+}
+  80134e:	83 c4 10             	add    $0x10,%esp
+  801351:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801354:	5b                   	pop    %ebx
+  801355:	5e                   	pop    %esi
+  801356:	5d                   	pop    %ebp
+  801357:	c3                   	ret
+		leaves = diskaddr(f->f_dindirect);
+  801358:	83 ec 0c             	sub    $0xc,%esp
+  80135b:	50                   	push   %eax
+  80135c:	e8 07 f0 ff ff       	call   800368 <diskaddr>
+		for (i = 0; i < NINDIRECT; i++)
+  801361:	8d b0 00 10 00 00    	lea    0x1000(%eax),%esi
+  801367:	83 c4 10             	add    $0x10,%esp
+	n = 0;
+  80136a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		for (i = 0; i < NINDIRECT; i++)
+  80136f:	eb 03                	jmp    801374 <file_flush_meta+0x75>
+  801371:	83 c0 04             	add    $0x4,%eax
+  801374:	39 f0                	cmp    %esi,%eax
+  801376:	74 12                	je     80138a <file_flush_meta+0x8b>
+			if (leaves[i])
+  801378:	8b 10                	mov    (%eax),%edx
+  80137a:	85 d2                	test   %edx,%edx
+  80137c:	74 f3                	je     801371 <file_flush_meta+0x72>
+				blocks[n++] = leaves[i];
+  80137e:	89 14 8d c0 41 86 00 	mov    %edx,0x8641c0(,%ecx,4)
+  801385:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801388:	eb e7                	jmp    801371 <file_flush_meta+0x72>
+		blocks[n++] = f->f_dindirect;
+  80138a:	8d 41 01             	lea    0x1(%ecx),%eax
+  80138d:	8b 93 b4 00 00 00    	mov    0xb4(%ebx),%edx
+  801393:	89 14 8d c0 41 86 00 	mov    %edx,0x8641c0(,%ecx,4)
+  80139a:	e9 71 ff ff ff       	jmp    801310 <file_flush_meta+0x11>
+
+0080139f <da_remove>:
+{
+  80139f:	55                   	push   %ebp
+  8013a0:	89 e5                	mov    %esp,%ebp
+  8013a2:	56                   	push   %esi
+  8013a3:	53                   	push   %ebx
+  8013a4:	89 c1                	mov    %eax,%ecx
+	for (pi = &da_buckets[da_hash(d->d_file, d->d_filebno)]; *pi - 1 != i;
+  8013a6:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8013a9:	c1 e2 02             	shl    $0x2,%edx
+	return ((uintptr_t) f / sizeof(struct File) * 31 + filebno)
+  8013ac:	8b 9a 20 92 86 00    	mov    0x869220(%edx),%ebx
+  8013b2:	c1 eb 08             	shr    $0x8,%ebx
+  8013b5:	89 d8                	mov    %ebx,%eax
+  8013b7:	c1 e0 05             	shl    $0x5,%eax
+  8013ba:	29 d8                	sub    %ebx,%eax
+  8013bc:	03 82 24 92 86 00    	add    0x869224(%edx),%eax
+		% DELALLOC_NBUCKETS;
+  8013c2:	25 ff 07 00 00       	and    $0x7ff,%eax
+	for (pi = &da_buckets[da_hash(d->d_file, d->d_filebno)]; *pi - 1 != i;
+  8013c7:	8d 1c 85 20 72 86 00 	lea    0x867220(,%eax,4),%ebx
+  8013ce:	8b 04 85 20 72 86 00 	mov    0x867220(,%eax,4),%eax
+  8013d5:	eb 16                	jmp    8013ed <da_remove+0x4e>
+	     pi = &da_ents[*pi - 1].d_hnext)
+  8013d7:	8d 14 00             	lea    (%eax,%eax,1),%edx
+  8013da:	8d 1c 02             	lea    (%edx,%eax,1),%ebx
+  8013dd:	8d 1c 9d 28 92 86 00 	lea    0x869228(,%ebx,4),%ebx
+  8013e4:	01 c2                	add    %eax,%edx
+  8013e6:	8b 04 95 28 92 86 00 	mov    0x869228(,%edx,4),%eax
+	for (pi = &da_buckets[da_hash(d->d_file, d->d_filebno)]; *pi - 1 != i;
+  8013ed:	83 e8 01             	sub    $0x1,%eax
+  8013f0:	39 c8                	cmp    %ecx,%eax
+  8013f2:	75 e3                	jne    8013d7 <da_remove+0x38>
+	*pi = d->d_hnext;
+  8013f4:	8d 04 49             	lea    (%ecx,%ecx,2),%eax
+  8013f7:	c1 e0 02             	shl    $0x2,%eax
+  8013fa:	8d 90 20 92 86 00    	lea    0x869220(%eax),%edx
+  801400:	8b b0 28 92 86 00    	mov    0x869228(%eax),%esi
+  801406:	89 33                	mov    %esi,(%ebx)
+	d->d_file = 0;
+  801408:	c7 80 20 92 86 00 00 	movl   $0x0,0x869220(%eax)
+  80140f:	00 00 00 
+	d->d_hnext = da_free;
+  801412:	a1 08 a0 80 00       	mov    0x80a008,%eax
+  801417:	89 42 08             	mov    %eax,0x8(%edx)
+	da_free = i;
+  80141a:	89 0d 08 a0 80 00    	mov    %ecx,0x80a008
+	sys_page_unmap(0, da_page(i));
+  801420:	83 ec 08             	sub    $0x8,%esp
+	return (char *) DELALLOC_VA + i * PGSIZE;
+  801423:	c1 e1 0c             	shl    $0xc,%ecx
+  801426:	81 c1 00 80 7c 0f    	add    $0xf7c8000,%ecx
+	sys_page_unmap(0, da_page(i));
+  80142c:	51                   	push   %ecx
+  80142d:	6a 00                	push   $0x0
+  80142f:	e8 41 4a 00 00       	call   805e75 <sys_page_unmap>
+	da_count--;
+  801434:	83 2d 04 72 86 00 01 	subl   $0x1,0x867204
+}
+  80143b:	83 c4 10             	add    $0x10,%esp
+  80143e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801441:	5b                   	pop    %ebx
+  801442:	5e                   	pop    %esi
+  801443:	5d                   	pop    %ebp
+  801444:	c3                   	ret
+
+00801445 <da_discard>:
+{
+  801445:	55                   	push   %ebp
+  801446:	89 e5                	mov    %esp,%ebp
+  801448:	57                   	push   %edi
+  801449:	56                   	push   %esi
+  80144a:	53                   	push   %ebx
+  80144b:	83 ec 1c             	sub    $0x1c,%esp
+  80144e:	89 c7                	mov    %eax,%edi
+  801450:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	for (i = 0; da_count > 0 && i < da_nused; i++)
+  801453:	bb 20 92 86 00       	mov    $0x869220,%ebx
+  801458:	be 00 00 00 00       	mov    $0x0,%esi
+  80145d:	eb 06                	jmp    801465 <da_discard+0x20>
+  80145f:	83 c6 01             	add    $0x1,%esi
+  801462:	83 c3 0c             	add    $0xc,%ebx
+  801465:	83 3d 04 72 86 00 00 	cmpl   $0x0,0x867204
+  80146c:	74 1d                	je     80148b <da_discard+0x46>
+  80146e:	39 35 08 72 86 00    	cmp    %esi,0x867208
+  801474:	7e 15                	jle    80148b <da_discard+0x46>
+		if (da_ents[i].d_file == f && da_ents[i].d_filebno >= filebno)
+  801476:	39 3b                	cmp    %edi,(%ebx)
+  801478:	75 e5                	jne    80145f <da_discard+0x1a>
+  80147a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80147d:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801480:	72 dd                	jb     80145f <da_discard+0x1a>
+			da_remove(i);
+  801482:	89 f0                	mov    %esi,%eax
+  801484:	e8 16 ff ff ff       	call   80139f <da_remove>
+  801489:	eb d4                	jmp    80145f <da_discard+0x1a>
+}
+  80148b:	83 c4 1c             	add    $0x1c,%esp
+  80148e:	5b                   	pop    %ebx
+  80148f:	5e                   	pop    %esi
+  801490:	5f                   	pop    %edi
+  801491:	5d                   	pop    %ebp
+  801492:	c3                   	ret
+
+00801493 <da_add>:
+{
+  801493:	55                   	push   %ebp
+  801494:	89 e5                	mov    %esp,%ebp
+  801496:	57                   	push   %edi
+  801497:	56                   	push   %esi
+  801498:	53                   	push   %ebx
+  801499:	83 ec 1c             	sub    $0x1c,%esp
+  80149c:	89 c6                	mov    %eax,%esi
+  80149e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8014a1:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	if (da_free < 0 && da_nused == DELALLOC_MAX)
+  8014a4:	8b 1d 08 a0 80 00    	mov    0x80a008,%ebx
+  8014aa:	85 db                	test   %ebx,%ebx
+  8014ac:	0f 88 b2 00 00 00    	js     801564 <da_add+0xd1>
+	if (nfree < da_count + 1 + (da_count + 1) / NINDIRECT + 3)
+  8014b2:	8b 15 04 72 86 00    	mov    0x867204,%edx
+  8014b8:	8d 42 01             	lea    0x1(%edx),%eax
+  8014bb:	c1 e8 0a             	shr    $0xa,%eax
+  8014be:	8d 44 02 04          	lea    0x4(%edx,%eax,1),%eax
+  8014c2:	39 05 34 c2 86 00    	cmp    %eax,0x86c234
+  8014c8:	0f 82 ee 00 00 00    	jb     8015bc <da_add+0x129>
+	return (char *) DELALLOC_VA + i * PGSIZE;
+  8014ce:	89 df                	mov    %ebx,%edi
+  8014d0:	c1 e7 0c             	shl    $0xc,%edi
+  8014d3:	81 c7 00 80 7c 0f    	add    $0xf7c8000,%edi
+	if ((r = sys_page_alloc(0, da_page(i), PTE_P | PTE_U | PTE_W)) < 0)
+  8014d9:	83 ec 04             	sub    $0x4,%esp
+  8014dc:	6a 07                	push   $0x7
+  8014de:	57                   	push   %edi
+  8014df:	6a 00                	push   $0x0
+  8014e1:	e8 02 49 00 00       	call   805de8 <sys_page_alloc>
+  8014e6:	83 c4 10             	add    $0x10,%esp
+  8014e9:	85 c0                	test   %eax,%eax
+  8014eb:	78 6f                	js     80155c <da_add+0xc9>
+	if (i == da_free)
+  8014ed:	39 1d 08 a0 80 00    	cmp    %ebx,0x80a008
+  8014f3:	0f 84 9c 00 00 00    	je     801595 <da_add+0x102>
+		da_nused++;
+  8014f9:	83 05 08 72 86 00 01 	addl   $0x1,0x867208
+	da_ents[i].d_file = f;
+  801500:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801503:	c1 e0 02             	shl    $0x2,%eax
+  801506:	8d 90 20 92 86 00    	lea    0x869220(%eax),%edx
+  80150c:	89 b0 20 92 86 00    	mov    %esi,0x869220(%eax)
+	da_ents[i].d_filebno = filebno;
+  801512:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801515:	89 88 24 92 86 00    	mov    %ecx,0x869224(%eax)
+	return ((uintptr_t) f / sizeof(struct File) * 31 + filebno)
+  80151b:	c1 ee 08             	shr    $0x8,%esi
+  80151e:	89 f0                	mov    %esi,%eax
+  801520:	c1 e0 05             	shl    $0x5,%eax
+  801523:	29 f0                	sub    %esi,%eax
+  801525:	01 c8                	add    %ecx,%eax
+		% DELALLOC_NBUCKETS;
+  801527:	25 ff 07 00 00       	and    $0x7ff,%eax
+	da_ents[i].d_hnext = da_buckets[b];
+  80152c:	8b 0c 85 20 72 86 00 	mov    0x867220(,%eax,4),%ecx
+  801533:	89 4a 08             	mov    %ecx,0x8(%edx)
+	da_buckets[b] = i + 1;
+  801536:	83 c3 01             	add    $0x1,%ebx
+  801539:	89 1c 85 20 72 86 00 	mov    %ebx,0x867220(,%eax,4)
+	if (da_count++ == 0)
+  801540:	a1 04 72 86 00       	mov    0x867204,%eax
+  801545:	8d 50 01             	lea    0x1(%eax),%edx
+  801548:	89 15 04 72 86 00    	mov    %edx,0x867204
+  80154e:	85 c0                	test   %eax,%eax
+  801550:	74 57                	je     8015a9 <da_add+0x116>
+	*blk = da_page(i);
+  801552:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801555:	89 38                	mov    %edi,(%eax)
+	return 0;
+  801557:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80155c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80155f:	5b                   	pop    %ebx
+  801560:	5e                   	pop    %esi
+  801561:	5f                   	pop    %edi
+  801562:	5d                   	pop    %ebp
+  801563:	c3                   	ret
+	if (da_free < 0 && da_nused == DELALLOC_MAX)
+  801564:	8b 1d 08 72 86 00    	mov    0x867208,%ebx
+  80156a:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  801570:	74 43                	je     8015b5 <da_add+0x122>
+	if (nfree < da_count + 1 + (da_count + 1) / NINDIRECT + 3)
+  801572:	8b 15 04 72 86 00    	mov    0x867204,%edx
+  801578:	8d 42 01             	lea    0x1(%edx),%eax
+  80157b:	c1 e8 0a             	shr    $0xa,%eax
+  80157e:	8d 44 02 04          	lea    0x4(%edx,%eax,1),%eax
+  801582:	39 05 34 c2 86 00    	cmp    %eax,0x86c234
+  801588:	0f 83 40 ff ff ff    	jae    8014ce <da_add+0x3b>
+		return -E_NO_DISK;
+  80158e:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  801593:	eb c7                	jmp    80155c <da_add+0xc9>
+		da_free = da_ents[i].d_hnext;
+  801595:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801598:	8b 04 85 28 92 86 00 	mov    0x869228(,%eax,4),%eax
+  80159f:	a3 08 a0 80 00       	mov    %eax,0x80a008
+  8015a4:	e9 57 ff ff ff       	jmp    801500 <da_add+0x6d>
+		da_since = sys_time_msec();
+  8015a9:	e8 d9 4a 00 00       	call   806087 <sys_time_msec>
+  8015ae:	a3 00 72 86 00       	mov    %eax,0x867200
+  8015b3:	eb 9d                	jmp    801552 <da_add+0xbf>
+		return -E_NO_MEM;
+  8015b5:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8015ba:	eb a0                	jmp    80155c <da_add+0xc9>
+		return -E_NO_DISK;
+  8015bc:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8015c1:	eb 99                	jmp    80155c <da_add+0xc9>
+
+008015c3 <check_super>:
+{
+  8015c3:	55                   	push   %ebp
+  8015c4:	89 e5                	mov    %esp,%ebp
+  8015c6:	83 ec 08             	sub    $0x8,%esp
+	if (super->s_magic != FS_MAGIC)
+  8015c9:	a1 24 01 86 00       	mov    0x860124,%eax
+  8015ce:	81 38 ae 30 05 4a    	cmpl   $0x4a0530ae,(%eax)
+  8015d4:	75 1b                	jne    8015f1 <check_super+0x2e>
+	if (super->s_nblocks > DISKSIZE/BLKSIZE)
+  8015d6:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%eax)
+  8015dd:	77 26                	ja     801605 <check_super+0x42>
+	cprintf("superblock is good\n");
+  8015df:	83 ec 0c             	sub    $0xc,%esp
+  8015e2:	68 98 8c 80 00       	push   $0x808c98
+  8015e7:	e8 02 3e 00 00       	call   8053ee <cprintf>
+}
+  8015ec:	83 c4 10             	add    $0x10,%esp
+  8015ef:	c9                   	leave
+  8015f0:	c3                   	ret
+		panic("bad file system magic number");
+  8015f1:	83 ec 04             	sub    $0x4,%esp
+  8015f4:	68 5a 8c 80 00       	push   $0x808c5a
+  8015f9:	6a 16                	push   $0x16
+  8015fb:	68 77 8c 80 00       	push   $0x808c77
+  801600:	e8 0e 3d 00 00       	call   805313 <_panic>
+		panic("file system is too large");
+  801605:	83 ec 04             	sub    $0x4,%esp
+  801608:	68 7f 8c 80 00       	push   $0x808c7f
+  80160d:	6a 19                	push   $0x19
+  80160f:	68 77 8c 80 00       	push   $0x808c77
+  801614:	e8 fa 3c 00 00       	call   805313 <_panic>
+
+00801619 <block_is_free>:
+{
+  801619:	55                   	push   %ebp
+  80161a:	89 e5                	mov    %esp,%ebp
+  80161c:	53                   	push   %ebx
+  80161d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	if (super == 0 || blockno >= super->s_nblocks)
+  801620:	a1 24 01 86 00       	mov    0x860124,%eax
+  801625:	85 c0                	test   %eax,%eax
+  801627:	74 29                	je     801652 <block_is_free+0x39>
+		return 0;
+  801629:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (super == 0 || blockno >= super->s_nblocks)
+  80162e:	3b 48 04             	cmp    0x4(%eax),%ecx
+  801631:	73 18                	jae    80164b <block_is_free+0x32>
+	if (bitmap[blockno / 32] & (1 << (blockno % 32)))
+  801633:	89 cb                	mov    %ecx,%ebx
+  801635:	c1 eb 05             	shr    $0x5,%ebx
+  801638:	b8 01 00 00 00       	mov    $0x1,%eax
+  80163d:	d3 e0                	shl    %cl,%eax
+  80163f:	8b 15 20 01 86 00    	mov    0x860120,%edx
+  801645:	23 04 9a             	and    (%edx,%ebx,4),%eax
+  801648:	0f 95 c2             	setne  %dl
+}
+  80164b:	89 d0                	mov    %edx,%eax
+  80164d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801650:	c9                   	leave
+  801651:	c3                   	ret
+		return 0;
+  801652:	ba 00 00 00 00       	mov    $0x0,%edx
+  801657:	eb f2                	jmp    80164b <block_is_free+0x32>
+
+00801659 <free_block>:
+{
+  801659:	55                   	push   %ebp
+  80165a:	89 e5                	mov    %esp,%ebp
+  80165c:	57                   	push   %edi
+  80165d:	56                   	push   %esi
+  80165e:	53                   	push   %ebx
+  80165f:	83 ec 0c             	sub    $0xc,%esp
+  801662:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (blockno == 0)
+  801665:	85 db                	test   %ebx,%ebx
+  801667:	74 5a                	je     8016c3 <free_block+0x6a>
+	if (!(bitmap[blockno/32] & (1<<(blockno%32))))
+  801669:	89 da                	mov    %ebx,%edx
+  80166b:	c1 ea 05             	shr    $0x5,%edx
+  80166e:	a1 20 01 86 00       	mov    0x860120,%eax
+  801673:	8d 34 90             	lea    (%eax,%edx,4),%esi
+  801676:	8b 06                	mov    (%esi),%eax
+  801678:	bf 01 00 00 00       	mov    $0x1,%edi
+  80167d:	89 d9                	mov    %ebx,%ecx
+  80167f:	d3 e7                	shl    %cl,%edi
+  801681:	89 f9                	mov    %edi,%ecx
+  801683:	85 f8                	test   %edi,%eax
+  801685:	75 07                	jne    80168e <free_block+0x35>
+		nfree++;
+  801687:	83 05 34 c2 86 00 01 	addl   $0x1,0x86c234
+	bitmap[blockno/32] |= 1<<(blockno%32);
+  80168e:	09 c8                	or     %ecx,%eax
+  801690:	89 06                	mov    %eax,(%esi)
+	freemap[blockno/1024] |= 1<<((blockno/32)%32);
+  801692:	89 de                	mov    %ebx,%esi
+  801694:	c1 ee 0a             	shr    $0xa,%esi
+  801697:	b8 01 00 00 00       	mov    $0x1,%eax
+  80169c:	89 d1                	mov    %edx,%ecx
+  80169e:	d3 e0                	shl    %cl,%eax
+  8016a0:	09 04 b5 40 c2 86 00 	or     %eax,0x86c240(,%esi,4)
+	bc_unpin(blockno);
+  8016a7:	83 ec 0c             	sub    $0xc,%esp
+  8016aa:	53                   	push   %ebx
+  8016ab:	e8 b0 f2 ff ff       	call   800960 <bc_unpin>
+	bc_unshare(blockno);
+  8016b0:	89 1c 24             	mov    %ebx,(%esp)
+  8016b3:	e8 1b ef ff ff       	call   8005d3 <bc_unshare>
+}
+  8016b8:	83 c4 10             	add    $0x10,%esp
+  8016bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016be:	5b                   	pop    %ebx
+  8016bf:	5e                   	pop    %esi
+  8016c0:	5f                   	pop    %edi
+  8016c1:	5d                   	pop    %ebp
+  8016c2:	c3                   	ret
+		panic("attempt to free zero block");
+  8016c3:	83 ec 04             	sub    $0x4,%esp
+  8016c6:	68 ac 8c 80 00       	push   $0x808cac
+  8016cb:	6a 57                	push   $0x57
+  8016cd:	68 77 8c 80 00       	push   $0x808c77
+  8016d2:	e8 3c 3c 00 00       	call   805313 <_panic>
+
+008016d7 <alloc_extent>:
+{
+  8016d7:	55                   	push   %ebp
+  8016d8:	89 e5                	mov    %esp,%ebp
+  8016da:	57                   	push   %edi
+  8016db:	56                   	push   %esi
+  8016dc:	53                   	push   %ebx
+  8016dd:	83 ec 1c             	sub    $0x1c,%esp
+  8016e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	if (nfree == 0 || want == 0)
+  8016e3:	a1 34 c2 86 00       	mov    0x86c234,%eax
+  8016e8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8016eb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8016ef:	0f 84 53 01 00 00    	je     801848 <alloc_extent+0x171>
+  8016f5:	85 c0                	test   %eax,%eax
+  8016f7:	0f 84 4b 01 00 00    	je     801848 <alloc_extent+0x171>
+	if (goal >= super->s_nblocks)
+  8016fd:	a1 24 01 86 00       	mov    0x860124,%eax
+  801702:	8b 70 04             	mov    0x4(%eax),%esi
+		goal = 0;
+  801705:	39 f1                	cmp    %esi,%ecx
+  801707:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170c:	0f 43 c8             	cmovae %eax,%ecx
+	idx = goal / 32;
+  80170f:	89 c8                	mov    %ecx,%eax
+  801711:	c1 e8 05             	shr    $0x5,%eax
+	bits = bitmap[idx] & (~0U << (goal % 32));
+  801714:	8b 3d 20 01 86 00    	mov    0x860120,%edi
+  80171a:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  80171f:	d3 e3                	shl    %cl,%ebx
+	if (!bits) {
+  801721:	23 1c 87             	and    (%edi,%eax,4),%ebx
+  801724:	0f 84 89 00 00 00    	je     8017b3 <alloc_extent+0xdc>
+	blockno = idx * 32 + __builtin_ctz(bits);
+  80172a:	f3 0f bc db          	tzcnt  %ebx,%ebx
+  80172e:	c1 e0 05             	shl    $0x5,%eax
+  801731:	8d 3c 18             	lea    (%eax,%ebx,1),%edi
+  801734:	89 fb                	mov    %edi,%ebx
+	for (n = 0; n < want && blockno + n < super->s_nblocks; n++) {
+  801736:	be 00 00 00 00       	mov    $0x0,%esi
+  80173b:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  80173e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801741:	a1 24 01 86 00       	mov    0x860124,%eax
+  801746:	3b 58 04             	cmp    0x4(%eax),%ebx
+  801749:	0f 83 e3 00 00 00    	jae    801832 <alloc_extent+0x15b>
+		idx = (blockno + n) / 32;
+  80174f:	89 d8                	mov    %ebx,%eax
+  801751:	c1 e8 05             	shr    $0x5,%eax
+		if (!(bitmap[idx] & (1 << ((blockno + n) % 32))))
+  801754:	8b 15 20 01 86 00    	mov    0x860120,%edx
+  80175a:	8d 14 82             	lea    (%edx,%eax,4),%edx
+  80175d:	8b 3a                	mov    (%edx),%edi
+  80175f:	be 01 00 00 00       	mov    $0x1,%esi
+  801764:	89 d9                	mov    %ebx,%ecx
+  801766:	d3 e6                	shl    %cl,%esi
+  801768:	89 f1                	mov    %esi,%ecx
+  80176a:	83 c3 01             	add    $0x1,%ebx
+  80176d:	85 fe                	test   %edi,%esi
+  80176f:	0f 84 c8 00 00 00    	je     80183d <alloc_extent+0x166>
+		bitmap[idx] &= ~(1 << ((blockno + n) % 32));
+  801775:	f7 d1                	not    %ecx
+  801777:	21 f9                	and    %edi,%ecx
+  801779:	89 0a                	mov    %ecx,(%edx)
+		freemap_update(idx);
+  80177b:	e8 c2 fa ff ff       	call   801242 <freemap_update>
+	for (n = 0; n < want && blockno + n < super->s_nblocks; n++) {
+  801780:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+  801784:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801787:	39 45 0c             	cmp    %eax,0xc(%ebp)
+  80178a:	75 b5                	jne    801741 <alloc_extent+0x6a>
+  80178c:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80178f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	nfree -= n;
+  801792:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801795:	29 f0                	sub    %esi,%eax
+  801797:	a3 34 c2 86 00       	mov    %eax,0x86c234
+	alloc_rotor = blockno + n;
+  80179c:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80179f:	a3 30 c2 86 00       	mov    %eax,0x86c230
+	*pstart = blockno;
+  8017a4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8017a7:	89 38                	mov    %edi,(%eax)
+	return n;
+  8017a9:	89 f0                	mov    %esi,%eax
+}
+  8017ab:	83 c4 1c             	add    $0x1c,%esp
+  8017ae:	5b                   	pop    %ebx
+  8017af:	5e                   	pop    %esi
+  8017b0:	5f                   	pop    %edi
+  8017b1:	5d                   	pop    %ebp
+  8017b2:	c3                   	ret
+		if ((w = freemap_next(idx + 1)) < 0)
+  8017b3:	8d 48 01             	lea    0x1(%eax),%ecx
+	nwords = (super->s_nblocks + 31) / 32;
+  8017b6:	83 c6 1f             	add    $0x1f,%esi
+  8017b9:	c1 ee 05             	shr    $0x5,%esi
+		idx = 0;
+  8017bc:	39 f1                	cmp    %esi,%ecx
+  8017be:	0f 43 cb             	cmovae %ebx,%ecx
+	for (i = idx / 32, n = 0; n <= (nwords + 31) / 32; n++) {
+  8017c1:	89 ca                	mov    %ecx,%edx
+  8017c3:	c1 ea 05             	shr    $0x5,%edx
+  8017c6:	8d 46 1f             	lea    0x1f(%esi),%eax
+  8017c9:	c1 e8 05             	shr    $0x5,%eax
+  8017cc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+			bits &= ~0U << (idx % 32);
+  8017cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017d4:	d3 e0                	shl    %cl,%eax
+  8017d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (i = idx / 32, n = 0; n <= (nwords + 31) / 32; n++) {
+  8017d9:	89 d9                	mov    %ebx,%ecx
+  8017db:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  8017de:	eb 17                	jmp    8017f7 <alloc_extent+0x120>
+		if (++i * 32 >= nwords)
+  8017e0:	83 c2 01             	add    $0x1,%edx
+  8017e3:	89 d0                	mov    %edx,%eax
+  8017e5:	c1 e0 05             	shl    $0x5,%eax
+			i = 0;
+  8017e8:	39 f0                	cmp    %esi,%eax
+  8017ea:	0f 43 d3             	cmovae %ebx,%edx
+	for (i = idx / 32, n = 0; n <= (nwords + 31) / 32; n++) {
+  8017ed:	8d 41 01             	lea    0x1(%ecx),%eax
+  8017f0:	39 4d e0             	cmp    %ecx,-0x20(%ebp)
+  8017f3:	74 33                	je     801828 <alloc_extent+0x151>
+  8017f5:	89 c1                	mov    %eax,%ecx
+		bits = freemap[i];
+  8017f7:	8b 04 95 40 c2 86 00 	mov    0x86c240(,%edx,4),%eax
+			bits &= ~0U << (idx % 32);
+  8017fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801801:	21 c7                	and    %eax,%edi
+  801803:	85 c9                	test   %ecx,%ecx
+  801805:	0f 44 c7             	cmove  %edi,%eax
+		if (bits) {
+  801808:	85 c0                	test   %eax,%eax
+  80180a:	74 d4                	je     8017e0 <alloc_extent+0x109>
+			w = i * 32 + __builtin_ctz(bits);
+  80180c:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801810:	89 d7                	mov    %edx,%edi
+  801812:	c1 e7 05             	shl    $0x5,%edi
+  801815:	01 c7                	add    %eax,%edi
+			if (w < nwords)
+  801817:	39 f7                	cmp    %esi,%edi
+  801819:	73 c5                	jae    8017e0 <alloc_extent+0x109>
+		bits = bitmap[idx];
+  80181b:	89 f8                	mov    %edi,%eax
+  80181d:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  801820:	8b 1c 87             	mov    (%edi,%eax,4),%ebx
+  801823:	e9 02 ff ff ff       	jmp    80172a <alloc_extent+0x53>
+			return -E_NO_DISK;
+  801828:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80182d:	e9 79 ff ff ff       	jmp    8017ab <alloc_extent+0xd4>
+  801832:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801835:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801838:	e9 55 ff ff ff       	jmp    801792 <alloc_extent+0xbb>
+  80183d:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801840:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801843:	e9 4a ff ff ff       	jmp    801792 <alloc_extent+0xbb>
+		return -E_NO_DISK;
+  801848:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80184d:	e9 59 ff ff ff       	jmp    8017ab <alloc_extent+0xd4>
+
+00801852 <alloc_block_near>:
+{
+  801852:	55                   	push   %ebp
+  801853:	89 e5                	mov    %esp,%ebp
+  801855:	83 ec 0c             	sub    $0xc,%esp
+	if ((r = alloc_extent(goal, 1, pblockno)) < 0)
+  801858:	ff 75 0c             	push   0xc(%ebp)
+  80185b:	6a 01                	push   $0x1
+  80185d:	ff 75 08             	push   0x8(%ebp)
+  801860:	e8 72 fe ff ff       	call   8016d7 <alloc_extent>
+  801865:	85 c0                	test   %eax,%eax
+  801867:	ba 00 00 00 00       	mov    $0x0,%edx
+  80186c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80186f:	c9                   	leave
+  801870:	c3                   	ret
+
+00801871 <indirect_block>:
+{
+  801871:	55                   	push   %ebp
+  801872:	89 e5                	mov    %esp,%ebp
+  801874:	56                   	push   %esi
+  801875:	53                   	push   %ebx
+  801876:	89 c6                	mov    %eax,%esi
+  801878:	89 d3                	mov    %edx,%ebx
+  80187a:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (*pblockno == 0) {
+  80187d:	83 3a 00             	cmpl   $0x0,(%edx)
+  801880:	75 32                	jne    8018b4 <indirect_block+0x43>
+		if (!alloc)
+  801882:	84 c0                	test   %al,%al
+  801884:	74 57                	je     8018dd <indirect_block+0x6c>
+		if ((r = alloc_block_near(goal, pblockno)) < 0)
+  801886:	83 ec 08             	sub    $0x8,%esp
+  801889:	52                   	push   %edx
+  80188a:	51                   	push   %ecx
+  80188b:	e8 c2 ff ff ff       	call   801852 <alloc_block_near>
+  801890:	83 c4 10             	add    $0x10,%esp
+  801893:	85 c0                	test   %eax,%eax
+  801895:	78 2b                	js     8018c2 <indirect_block+0x51>
+		memset(diskaddr(*pblockno), 0, BLKSIZE);
+  801897:	83 ec 0c             	sub    $0xc,%esp
+  80189a:	ff 33                	push   (%ebx)
+  80189c:	e8 c7 ea ff ff       	call   800368 <diskaddr>
+  8018a1:	83 c4 0c             	add    $0xc,%esp
+  8018a4:	68 00 10 00 00       	push   $0x1000
+  8018a9:	6a 00                	push   $0x0
+  8018ab:	50                   	push   %eax
+  8018ac:	e8 7c 42 00 00       	call   805b2d <memset>
+  8018b1:	83 c4 10             	add    $0x10,%esp
+	return 0;
+  8018b4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (f->f_type == FTYPE_DIR)
+  8018b9:	83 be 84 00 00 00 01 	cmpl   $0x1,0x84(%esi)
+  8018c0:	74 07                	je     8018c9 <indirect_block+0x58>
+}
+  8018c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018c5:	5b                   	pop    %ebx
+  8018c6:	5e                   	pop    %esi
+  8018c7:	5d                   	pop    %ebp
+  8018c8:	c3                   	ret
+		bc_pin(*pblockno);
+  8018c9:	83 ec 0c             	sub    $0xc,%esp
+  8018cc:	ff 33                	push   (%ebx)
+  8018ce:	e8 87 ed ff ff       	call   80065a <bc_pin>
+  8018d3:	83 c4 10             	add    $0x10,%esp
+	return 0;
+  8018d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018db:	eb e5                	jmp    8018c2 <indirect_block+0x51>
+			return -E_NOT_FOUND;
+  8018dd:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8018e2:	eb de                	jmp    8018c2 <indirect_block+0x51>
+
+008018e4 <file_block_walk>:
+{
+  8018e4:	55                   	push   %ebp
+  8018e5:	89 e5                	mov    %esp,%ebp
+  8018e7:	57                   	push   %edi
+  8018e8:	56                   	push   %esi
+  8018e9:	53                   	push   %ebx
+  8018ea:	83 ec 2c             	sub    $0x2c,%esp
+  8018ed:	89 c3                	mov    %eax,%ebx
+  8018ef:	89 d0                	mov    %edx,%eax
+  8018f1:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  8018f4:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (filebno < NDIRECT) {
+  8018f7:	83 f8 09             	cmp    $0x9,%eax
+  8018fa:	0f 86 f6 00 00 00    	jbe    8019f6 <file_block_walk+0x112>
+	filebno -= NDIRECT;
+  801900:	8d 78 f6             	lea    -0xa(%eax),%edi
+	if (filebno < NINDIRECT) {
+  801903:	81 ff ff 03 00 00    	cmp    $0x3ff,%edi
+  801909:	0f 86 fd 00 00 00    	jbe    801a0c <file_block_walk+0x128>
+	filebno -= NINDIRECT;
+  80190f:	8d b8 f6 fb ff ff    	lea    -0x40a(%eax),%edi
+	if (filebno >= NDINDIRECT)
+  801915:	81 ff ff ff 0f 00    	cmp    $0xfffff,%edi
+  80191b:	0f 87 58 01 00 00    	ja     801a79 <file_block_walk+0x195>
+	idx = filebno / NINDIRECT;
+  801921:	89 fe                	mov    %edi,%esi
+  801923:	c1 ee 0a             	shr    $0xa,%esi
+  801926:	89 75 d0             	mov    %esi,-0x30(%ebp)
+	return ((uintptr_t) f - DISKMAP) / sizeof(struct File);
+  801929:	8d 83 00 00 00 f0    	lea    -0x10000000(%ebx),%eax
+  80192f:	c1 e8 08             	shr    $0x8,%eax
+	if (walk_hint.ino != file_ino(f) + 1 || walk_hint.idx != idx
+  801932:	83 c0 01             	add    $0x1,%eax
+  801935:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801938:	39 05 20 c2 86 00    	cmp    %eax,0x86c220
+  80193e:	75 0c                	jne    80194c <file_block_walk+0x68>
+  801940:	39 35 28 c2 86 00    	cmp    %esi,0x86c228
+  801946:	0f 84 0e 01 00 00    	je     801a5a <file_block_walk+0x176>
+		blockno = f->f_dindirect;
+  80194c:	8b 83 b4 00 00 00    	mov    0xb4(%ebx),%eax
+  801952:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		r = indirect_block(f, &blockno, alloc_rotor, alloc);
+  801955:	0f b6 f2             	movzbl %dl,%esi
+  801958:	83 ec 0c             	sub    $0xc,%esp
+  80195b:	56                   	push   %esi
+  80195c:	8b 0d 30 c2 86 00    	mov    0x86c230,%ecx
+  801962:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  801965:	89 d8                	mov    %ebx,%eax
+  801967:	e8 05 ff ff ff       	call   801871 <indirect_block>
+		f->f_dindirect = blockno;
+  80196c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80196f:	89 93 b4 00 00 00    	mov    %edx,0xb4(%ebx)
+		if (r < 0)
+  801975:	83 c4 10             	add    $0x10,%esp
+  801978:	85 c0                	test   %eax,%eax
+  80197a:	0f 88 84 00 00 00    	js     801a04 <file_block_walk+0x120>
+		pleaf = (uint32_t *) diskaddr(f->f_dindirect) + idx;
+  801980:	83 ec 0c             	sub    $0xc,%esp
+  801983:	52                   	push   %edx
+  801984:	e8 df e9 ff ff       	call   800368 <diskaddr>
+  801989:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80198c:	8d 04 88             	lea    (%eax,%ecx,4),%eax
+		if ((r = indirect_block(f, pleaf, alloc_rotor, alloc)) < 0)
+  80198f:	89 34 24             	mov    %esi,(%esp)
+  801992:	8b 0d 30 c2 86 00    	mov    0x86c230,%ecx
+  801998:	89 c6                	mov    %eax,%esi
+  80199a:	89 c2                	mov    %eax,%edx
+  80199c:	89 d8                	mov    %ebx,%eax
+  80199e:	e8 ce fe ff ff       	call   801871 <indirect_block>
+  8019a3:	83 c4 10             	add    $0x10,%esp
+  8019a6:	85 c0                	test   %eax,%eax
+  8019a8:	78 5a                	js     801a04 <file_block_walk+0x120>
+		walk_hint.ino = file_ino(f) + 1;
+  8019aa:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8019ad:	a3 20 c2 86 00       	mov    %eax,0x86c220
+		walk_hint.dind = f->f_dindirect;
+  8019b2:	8b 83 b4 00 00 00    	mov    0xb4(%ebx),%eax
+  8019b8:	a3 24 c2 86 00       	mov    %eax,0x86c224
+		walk_hint.idx = idx;
+  8019bd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8019c0:	89 0d 28 c2 86 00    	mov    %ecx,0x86c228
+		walk_hint.leaf = *pleaf;
+  8019c6:	8b 06                	mov    (%esi),%eax
+  8019c8:	a3 2c c2 86 00       	mov    %eax,0x86c22c
+	*ppdiskbno = (uint32_t *) diskaddr(walk_hint.leaf) + filebno % NINDIRECT;
+  8019cd:	83 ec 0c             	sub    $0xc,%esp
+  8019d0:	ff 35 2c c2 86 00    	push   0x86c22c
+  8019d6:	e8 8d e9 ff ff       	call   800368 <diskaddr>
+  8019db:	89 c2                	mov    %eax,%edx
+  8019dd:	89 f8                	mov    %edi,%eax
+  8019df:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019e4:	8d 04 82             	lea    (%edx,%eax,4),%eax
+  8019e7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8019ea:	89 07                	mov    %eax,(%edi)
+	return 0;
+  8019ec:	83 c4 10             	add    $0x10,%esp
+  8019ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f4:	eb 0e                	jmp    801a04 <file_block_walk+0x120>
+		*ppdiskbno = &f->f_direct[filebno];
+  8019f6:	8d 84 83 88 00 00 00 	lea    0x88(%ebx,%eax,4),%eax
+  8019fd:	89 01                	mov    %eax,(%ecx)
+		return 0;
+  8019ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a07:	5b                   	pop    %ebx
+  801a08:	5e                   	pop    %esi
+  801a09:	5f                   	pop    %edi
+  801a0a:	5d                   	pop    %ebp
+  801a0b:	c3                   	ret
+		blockno = f->f_indirect;
+  801a0c:	8b 83 b0 00 00 00    	mov    0xb0(%ebx),%eax
+  801a12:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		r = indirect_block(f, &blockno, f->f_direct[NDIRECT - 1] + 1, alloc);
+  801a15:	8b 83 ac 00 00 00    	mov    0xac(%ebx),%eax
+  801a1b:	8d 48 01             	lea    0x1(%eax),%ecx
+  801a1e:	83 ec 0c             	sub    $0xc,%esp
+  801a21:	0f b6 f2             	movzbl %dl,%esi
+  801a24:	56                   	push   %esi
+  801a25:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  801a28:	89 d8                	mov    %ebx,%eax
+  801a2a:	e8 42 fe ff ff       	call   801871 <indirect_block>
+		f->f_indirect = blockno;
+  801a2f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a32:	89 93 b0 00 00 00    	mov    %edx,0xb0(%ebx)
+		if (r < 0)
+  801a38:	83 c4 10             	add    $0x10,%esp
+  801a3b:	85 c0                	test   %eax,%eax
+  801a3d:	78 c5                	js     801a04 <file_block_walk+0x120>
+		*ppdiskbno = (uint32_t *) diskaddr(f->f_indirect) + filebno;
+  801a3f:	83 ec 0c             	sub    $0xc,%esp
+  801a42:	52                   	push   %edx
+  801a43:	e8 20 e9 ff ff       	call   800368 <diskaddr>
+  801a48:	8d 04 b8             	lea    (%eax,%edi,4),%eax
+  801a4b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  801a4e:	89 07                	mov    %eax,(%edi)
+		return 0;
+  801a50:	83 c4 10             	add    $0x10,%esp
+  801a53:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a58:	eb aa                	jmp    801a04 <file_block_walk+0x120>
+	    || f->f_dindirect == 0 || walk_hint.dind != f->f_dindirect) {
+  801a5a:	8b 83 b4 00 00 00    	mov    0xb4(%ebx),%eax
+  801a60:	85 c0                	test   %eax,%eax
+  801a62:	0f 84 e4 fe ff ff    	je     80194c <file_block_walk+0x68>
+  801a68:	3b 05 24 c2 86 00    	cmp    0x86c224,%eax
+  801a6e:	0f 85 d8 fe ff ff    	jne    80194c <file_block_walk+0x68>
+  801a74:	e9 54 ff ff ff       	jmp    8019cd <file_block_walk+0xe9>
+		return -E_INVAL;
+  801a79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a7e:	eb 84                	jmp    801a04 <file_block_walk+0x120>
+
+00801a80 <file_block_goal>:
+	if (filebno > 0 && file_block_walk(f, filebno - 1, &pdiskbno, 0) == 0
+  801a80:	85 d2                	test   %edx,%edx
+  801a82:	75 06                	jne    801a8a <file_block_goal+0xa>
+	return alloc_rotor;
+  801a84:	a1 30 c2 86 00       	mov    0x86c230,%eax
+}
+  801a89:	c3                   	ret
+{
+  801a8a:	55                   	push   %ebp
+  801a8b:	89 e5                	mov    %esp,%ebp
+  801a8d:	83 ec 24             	sub    $0x24,%esp
+	if (filebno > 0 && file_block_walk(f, filebno - 1, &pdiskbno, 0) == 0
+  801a90:	83 ea 01             	sub    $0x1,%edx
+  801a93:	6a 00                	push   $0x0
+  801a95:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801a98:	e8 47 fe ff ff       	call   8018e4 <file_block_walk>
+  801a9d:	83 c4 10             	add    $0x10,%esp
+  801aa0:	85 c0                	test   %eax,%eax
+  801aa2:	75 09                	jne    801aad <file_block_goal+0x2d>
+	    && *pdiskbno != 0)
+  801aa4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa7:	8b 00                	mov    (%eax),%eax
+  801aa9:	85 c0                	test   %eax,%eax
+  801aab:	75 07                	jne    801ab4 <file_block_goal+0x34>
+	return alloc_rotor;
+  801aad:	a1 30 c2 86 00       	mov    0x86c230,%eax
+}
+  801ab2:	c9                   	leave
+  801ab3:	c3                   	ret
+		return *pdiskbno + 1;
+  801ab4:	83 c0 01             	add    $0x1,%eax
+  801ab7:	eb f9                	jmp    801ab2 <file_block_goal+0x32>
+
+00801ab9 <file_truncate_blocks>:
+{
+  801ab9:	55                   	push   %ebp
+  801aba:	89 e5                	mov    %esp,%ebp
+  801abc:	57                   	push   %edi
+  801abd:	56                   	push   %esi
+  801abe:	53                   	push   %ebx
+  801abf:	83 ec 2c             	sub    $0x2c,%esp
+  801ac2:	89 c6                	mov    %eax,%esi
+  801ac4:	89 d7                	mov    %edx,%edi
+  801ac6:	89 55 cc             	mov    %edx,-0x34(%ebp)
+	old_nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  801ac9:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  801acf:	8d 90 fe 1f 00 00    	lea    0x1ffe(%eax),%edx
+  801ad5:	05 ff 0f 00 00       	add    $0xfff,%eax
+  801ada:	0f 48 c2             	cmovs  %edx,%eax
+  801add:	c1 f8 0c             	sar    $0xc,%eax
+  801ae0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	new_nblocks = (newsize + BLKSIZE - 1) / BLKSIZE;
+  801ae3:	8d 87 fe 1f 00 00    	lea    0x1ffe(%edi),%eax
+  801ae9:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  801aef:	0f 49 c7             	cmovns %edi,%eax
+  801af2:	c1 f8 0c             	sar    $0xc,%eax
+  801af5:	89 c3                	mov    %eax,%ebx
+  801af7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	da_discard(f, new_nblocks);
+  801afa:	89 c2                	mov    %eax,%edx
+  801afc:	89 f0                	mov    %esi,%eax
+  801afe:	e8 42 f9 ff ff       	call   801445 <da_discard>
+	for (bno = new_nblocks; bno < old_nblocks; bno++) {
+  801b03:	eb 12                	jmp    801b17 <file_truncate_blocks+0x5e>
+	return ROUNDUP(filebno - NDIRECT - NINDIRECT + 1, NINDIRECT)
+  801b05:	83 eb 0a             	sub    $0xa,%ebx
+  801b08:	81 e3 00 fc ff ff    	and    $0xfffffc00,%ebx
+				bno = next_leaf(bno) - 1;
+  801b0e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+	for (bno = new_nblocks; bno < old_nblocks; bno++) {
+  801b14:	83 c3 01             	add    $0x1,%ebx
+  801b17:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801b1a:	39 c3                	cmp    %eax,%ebx
+  801b1c:	73 6d                	jae    801b8b <file_truncate_blocks+0xd2>
+		if (bno >= NDIRECT + NINDIRECT) {
+  801b1e:	81 fb 09 04 00 00    	cmp    $0x409,%ebx
+  801b24:	76 27                	jbe    801b4d <file_truncate_blocks+0x94>
+			if (!f->f_dindirect)
+  801b26:	8b 86 b4 00 00 00    	mov    0xb4(%esi),%eax
+  801b2c:	85 c0                	test   %eax,%eax
+  801b2e:	74 5b                	je     801b8b <file_truncate_blocks+0xd2>
+			if (((uint32_t *) diskaddr(f->f_dindirect))[(bno - NDIRECT - NINDIRECT) / NINDIRECT] == 0) {
+  801b30:	83 ec 0c             	sub    $0xc,%esp
+  801b33:	50                   	push   %eax
+  801b34:	e8 2f e8 ff ff       	call   800368 <diskaddr>
+  801b39:	89 c2                	mov    %eax,%edx
+  801b3b:	8d 83 f6 fb ff ff    	lea    -0x40a(%ebx),%eax
+  801b41:	c1 e8 0a             	shr    $0xa,%eax
+  801b44:	83 c4 10             	add    $0x10,%esp
+  801b47:	83 3c 82 00          	cmpl   $0x0,(%edx,%eax,4)
+  801b4b:	74 b8                	je     801b05 <file_truncate_blocks+0x4c>
+	if ((r = file_block_walk(f, filebno, &ptr, 0)) == -E_NOT_FOUND)
+  801b4d:	83 ec 0c             	sub    $0xc,%esp
+  801b50:	6a 00                	push   $0x0
+  801b52:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  801b55:	89 da                	mov    %ebx,%edx
+  801b57:	89 f0                	mov    %esi,%eax
+  801b59:	e8 86 fd ff ff       	call   8018e4 <file_block_walk>
+  801b5e:	83 c4 10             	add    $0x10,%esp
+  801b61:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801b64:	74 ae                	je     801b14 <file_truncate_blocks+0x5b>
+	if (r < 0)
+  801b66:	85 c0                	test   %eax,%eax
+  801b68:	0f 88 31 01 00 00    	js     801c9f <file_truncate_blocks+0x1e6>
+	if (*ptr) {
+  801b6e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b71:	8b 07                	mov    (%edi),%eax
+  801b73:	85 c0                	test   %eax,%eax
+  801b75:	74 9d                	je     801b14 <file_truncate_blocks+0x5b>
+		free_block(*ptr);
+  801b77:	83 ec 0c             	sub    $0xc,%esp
+  801b7a:	50                   	push   %eax
+  801b7b:	e8 d9 fa ff ff       	call   801659 <free_block>
+		*ptr = 0;
+  801b80:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  801b86:	83 c4 10             	add    $0x10,%esp
+  801b89:	eb 89                	jmp    801b14 <file_truncate_blocks+0x5b>
+	walk_hint_drop(f);
+  801b8b:	89 f0                	mov    %esi,%eax
+  801b8d:	e8 e5 f6 ff ff       	call   801277 <walk_hint_drop>
+	if (f->f_dindirect) {
+  801b92:	8b 86 b4 00 00 00    	mov    0xb4(%esi),%eax
+  801b98:	85 c0                	test   %eax,%eax
+  801b9a:	0f 84 a7 00 00 00    	je     801c47 <file_truncate_blocks+0x18e>
+			idx = ROUNDUP(new_nblocks - NDIRECT - NINDIRECT, NINDIRECT) / NINDIRECT;
+  801ba0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  801ba3:	8d 59 f5             	lea    -0xb(%ecx),%ebx
+  801ba6:	c1 eb 0a             	shr    $0xa,%ebx
+  801ba9:	81 f9 0a 04 00 00    	cmp    $0x40a,%ecx
+  801baf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb4:	0f 46 da             	cmovbe %edx,%ebx
+		leaves = diskaddr(f->f_dindirect);
+  801bb7:	83 ec 0c             	sub    $0xc,%esp
+  801bba:	50                   	push   %eax
+  801bbb:	e8 a8 e7 ff ff       	call   800368 <diskaddr>
+  801bc0:	89 c7                	mov    %eax,%edi
+		for (; idx < NINDIRECT; idx++)
+  801bc2:	83 c4 10             	add    $0x10,%esp
+  801bc5:	eb 03                	jmp    801bca <file_truncate_blocks+0x111>
+  801bc7:	83 c3 01             	add    $0x1,%ebx
+  801bca:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  801bd0:	77 1c                	ja     801bee <file_truncate_blocks+0x135>
+			if (leaves[idx]) {
+  801bd2:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  801bd5:	85 c0                	test   %eax,%eax
+  801bd7:	74 ee                	je     801bc7 <file_truncate_blocks+0x10e>
+				free_block(leaves[idx]);
+  801bd9:	83 ec 0c             	sub    $0xc,%esp
+  801bdc:	50                   	push   %eax
+  801bdd:	e8 77 fa ff ff       	call   801659 <free_block>
+				leaves[idx] = 0;
+  801be2:	c7 04 9f 00 00 00 00 	movl   $0x0,(%edi,%ebx,4)
+  801be9:	83 c4 10             	add    $0x10,%esp
+  801bec:	eb d9                	jmp    801bc7 <file_truncate_blocks+0x10e>
+		if (new_nblocks <= NDIRECT + NINDIRECT) {
+  801bee:	81 7d d0 0a 04 00 00 	cmpl   $0x40a,-0x30(%ebp)
+  801bf5:	76 35                	jbe    801c2c <file_truncate_blocks+0x173>
+	if (f->f_type == FTYPE_DIR && new_nblocks < old_nblocks)
+  801bf7:	83 be 84 00 00 00 01 	cmpl   $0x1,0x84(%esi)
+  801bfe:	75 08                	jne    801c08 <file_truncate_blocks+0x14f>
+  801c00:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  801c03:	39 4d d0             	cmp    %ecx,-0x30(%ebp)
+  801c06:	72 67                	jb     801c6f <file_truncate_blocks+0x1b6>
+	if (f->f_hindex && ROUNDUP(newsize, sizeof(struct File)) < f->f_size) {
+  801c08:	8b 96 b8 00 00 00    	mov    0xb8(%esi),%edx
+  801c0e:	85 d2                	test   %edx,%edx
+  801c10:	74 12                	je     801c24 <file_truncate_blocks+0x16b>
+  801c12:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  801c15:	05 ff 00 00 00       	add    $0xff,%eax
+  801c1a:	b0 00                	mov    $0x0,%al
+  801c1c:	39 86 80 00 00 00    	cmp    %eax,0x80(%esi)
+  801c22:	7f 59                	jg     801c7d <file_truncate_blocks+0x1c4>
+}
+  801c24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c27:	5b                   	pop    %ebx
+  801c28:	5e                   	pop    %esi
+  801c29:	5f                   	pop    %edi
+  801c2a:	5d                   	pop    %ebp
+  801c2b:	c3                   	ret
+			free_block(f->f_dindirect);
+  801c2c:	83 ec 0c             	sub    $0xc,%esp
+  801c2f:	ff b6 b4 00 00 00    	push   0xb4(%esi)
+  801c35:	e8 1f fa ff ff       	call   801659 <free_block>
+			f->f_dindirect = 0;
+  801c3a:	c7 86 b4 00 00 00 00 	movl   $0x0,0xb4(%esi)
+  801c41:	00 00 00 
+  801c44:	83 c4 10             	add    $0x10,%esp
+	if (new_nblocks <= NDIRECT && f->f_indirect) {
+  801c47:	83 7d d0 0a          	cmpl   $0xa,-0x30(%ebp)
+  801c4b:	77 aa                	ja     801bf7 <file_truncate_blocks+0x13e>
+  801c4d:	8b 86 b0 00 00 00    	mov    0xb0(%esi),%eax
+  801c53:	85 c0                	test   %eax,%eax
+  801c55:	74 a0                	je     801bf7 <file_truncate_blocks+0x13e>
+		free_block(f->f_indirect);
+  801c57:	83 ec 0c             	sub    $0xc,%esp
+  801c5a:	50                   	push   %eax
+  801c5b:	e8 f9 f9 ff ff       	call   801659 <free_block>
+		f->f_indirect = 0;
+  801c60:	c7 86 b0 00 00 00 00 	movl   $0x0,0xb0(%esi)
+  801c67:	00 00 00 
+  801c6a:	83 c4 10             	add    $0x10,%esp
+  801c6d:	eb 88                	jmp    801bf7 <file_truncate_blocks+0x13e>
+		dcache_purge(f);
+  801c6f:	83 ec 0c             	sub    $0xc,%esp
+  801c72:	56                   	push   %esi
+  801c73:	e8 b2 1a 00 00       	call   80372a <dcache_purge>
+  801c78:	83 c4 10             	add    $0x10,%esp
+  801c7b:	eb 8b                	jmp    801c08 <file_truncate_blocks+0x14f>
+		free_block(f->f_hindex);
+  801c7d:	83 ec 0c             	sub    $0xc,%esp
+  801c80:	52                   	push   %edx
+  801c81:	e8 d3 f9 ff ff       	call   801659 <free_block>
+		f->f_hindex = 0;
+  801c86:	c7 86 b8 00 00 00 00 	movl   $0x0,0xb8(%esi)
+  801c8d:	00 00 00 
+		f->f_hfree = 0;
+  801c90:	c7 86 bc 00 00 00 00 	movl   $0x0,0xbc(%esi)
+  801c97:	00 00 00 
+  801c9a:	83 c4 10             	add    $0x10,%esp
+}
+  801c9d:	eb 85                	jmp    801c24 <file_truncate_blocks+0x16b>
+			cprintf("warning: file_free_block: %e", r);
+  801c9f:	83 ec 08             	sub    $0x8,%esp
+  801ca2:	50                   	push   %eax
+  801ca3:	68 c7 8c 80 00       	push   $0x808cc7
+  801ca8:	e8 41 37 00 00       	call   8053ee <cprintf>
+  801cad:	83 c4 10             	add    $0x10,%esp
+  801cb0:	e9 5f fe ff ff       	jmp    801b14 <file_truncate_blocks+0x5b>
+
+00801cb5 <alloc_block>:
+{
+  801cb5:	55                   	push   %ebp
+  801cb6:	89 e5                	mov    %esp,%ebp
+  801cb8:	83 ec 10             	sub    $0x10,%esp
+	return alloc_block_near(alloc_rotor, pblockno);
+  801cbb:	ff 75 08             	push   0x8(%ebp)
+  801cbe:	ff 35 30 c2 86 00    	push   0x86c230
+  801cc4:	e8 89 fb ff ff       	call   801852 <alloc_block_near>
+}
+  801cc9:	c9                   	leave
+  801cca:	c3                   	ret
+
+00801ccb <check_bitmap>:
+{
+  801ccb:	55                   	push   %ebp
+  801ccc:	89 e5                	mov    %esp,%ebp
+  801cce:	56                   	push   %esi
+  801ccf:	53                   	push   %ebx
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  801cd0:	a1 24 01 86 00       	mov    0x860124,%eax
+  801cd5:	8b 70 04             	mov    0x4(%eax),%esi
+  801cd8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cdd:	89 d8                	mov    %ebx,%eax
+  801cdf:	c1 e0 0f             	shl    $0xf,%eax
+  801ce2:	39 f0                	cmp    %esi,%eax
+  801ce4:	73 31                	jae    801d17 <check_bitmap+0x4c>
+		assert(!block_is_free(2+i));
+  801ce6:	83 ec 0c             	sub    $0xc,%esp
+  801ce9:	8d 43 02             	lea    0x2(%ebx),%eax
+  801cec:	50                   	push   %eax
+  801ced:	e8 27 f9 ff ff       	call   801619 <block_is_free>
+  801cf2:	83 c4 10             	add    $0x10,%esp
+  801cf5:	84 c0                	test   %al,%al
+  801cf7:	75 05                	jne    801cfe <check_bitmap+0x33>
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  801cf9:	83 c3 01             	add    $0x1,%ebx
+  801cfc:	eb df                	jmp    801cdd <check_bitmap+0x12>
+		assert(!block_is_free(2+i));
+  801cfe:	68 e4 8c 80 00       	push   $0x808ce4
+  801d03:	68 fd 89 80 00       	push   $0x8089fd
+  801d08:	68 cc 00 00 00       	push   $0xcc
+  801d0d:	68 77 8c 80 00       	push   $0x808c77
+  801d12:	e8 fc 35 00 00       	call   805313 <_panic>
+	assert(!block_is_free(0));
+  801d17:	83 ec 0c             	sub    $0xc,%esp
+  801d1a:	6a 00                	push   $0x0
+  801d1c:	e8 f8 f8 ff ff       	call   801619 <block_is_free>
+  801d21:	83 c4 10             	add    $0x10,%esp
+  801d24:	84 c0                	test   %al,%al
+  801d26:	75 28                	jne    801d50 <check_bitmap+0x85>
+	assert(!block_is_free(1));
+  801d28:	83 ec 0c             	sub    $0xc,%esp
+  801d2b:	6a 01                	push   $0x1
+  801d2d:	e8 e7 f8 ff ff       	call   801619 <block_is_free>
+  801d32:	83 c4 10             	add    $0x10,%esp
+  801d35:	84 c0                	test   %al,%al
+  801d37:	75 30                	jne    801d69 <check_bitmap+0x9e>
+	cprintf("bitmap is good\n");
+  801d39:	83 ec 0c             	sub    $0xc,%esp
+  801d3c:	68 1c 8d 80 00       	push   $0x808d1c
+  801d41:	e8 a8 36 00 00       	call   8053ee <cprintf>
+}
+  801d46:	83 c4 10             	add    $0x10,%esp
+  801d49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d4c:	5b                   	pop    %ebx
+  801d4d:	5e                   	pop    %esi
+  801d4e:	5d                   	pop    %ebp
+  801d4f:	c3                   	ret
+	assert(!block_is_free(0));
+  801d50:	68 f8 8c 80 00       	push   $0x808cf8
+  801d55:	68 fd 89 80 00       	push   $0x8089fd
+  801d5a:	68 cf 00 00 00       	push   $0xcf
+  801d5f:	68 77 8c 80 00       	push   $0x808c77
+  801d64:	e8 aa 35 00 00       	call   805313 <_panic>
+	assert(!block_is_free(1));
+  801d69:	68 0a 8d 80 00       	push   $0x808d0a
+  801d6e:	68 fd 89 80 00       	push   $0x8089fd
+  801d73:	68 d0 00 00 00       	push   $0xd0
+  801d78:	68 77 8c 80 00       	push   $0x808c77
+  801d7d:	e8 91 35 00 00       	call   805313 <_panic>
+
+00801d82 <fs_init>:
+{
+  801d82:	55                   	push   %ebp
+  801d83:	89 e5                	mov    %esp,%ebp
+  801d85:	57                   	push   %edi
+  801d86:	56                   	push   %esi
+  801d87:	53                   	push   %ebx
+  801d88:	83 ec 1c             	sub    $0x1c,%esp
+	if (ide_probe_disk1())
+  801d8b:	e8 de e2 ff ff       	call   80006e <ide_probe_disk1>
+  801d90:	84 c0                	test   %al,%al
+  801d92:	74 62                	je     801df6 <fs_init+0x74>
+		ide_set_disk(1);
+  801d94:	83 ec 0c             	sub    $0xc,%esp
+  801d97:	6a 01                	push   $0x1
+  801d99:	e8 32 e3 ff ff       	call   8000d0 <ide_set_disk>
+  801d9e:	83 c4 10             	add    $0x10,%esp
+	bc_init();
+  801da1:	e8 7f f1 ff ff       	call   800f25 <bc_init>
+	super = diskaddr(1);
+  801da6:	83 ec 0c             	sub    $0xc,%esp
+  801da9:	6a 01                	push   $0x1
+  801dab:	e8 b8 e5 ff ff       	call   800368 <diskaddr>
+  801db0:	a3 24 01 86 00       	mov    %eax,0x860124
+	check_super();
+  801db5:	e8 09 f8 ff ff       	call   8015c3 <check_super>
+	bitmap = diskaddr(2);
+  801dba:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  801dc1:	e8 a2 e5 ff ff       	call   800368 <diskaddr>
+  801dc6:	a3 20 01 86 00       	mov    %eax,0x860120
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  801dcb:	83 c4 10             	add    $0x10,%esp
+  801dce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dd3:	89 da                	mov    %ebx,%edx
+  801dd5:	c1 e2 0f             	shl    $0xf,%edx
+  801dd8:	a1 24 01 86 00       	mov    0x860124,%eax
+  801ddd:	3b 50 04             	cmp    0x4(%eax),%edx
+  801de0:	73 23                	jae    801e05 <fs_init+0x83>
+		bc_pin(2 + i);
+  801de2:	83 ec 0c             	sub    $0xc,%esp
+  801de5:	8d 43 02             	lea    0x2(%ebx),%eax
+  801de8:	50                   	push   %eax
+  801de9:	e8 6c e8 ff ff       	call   80065a <bc_pin>
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  801dee:	83 c3 01             	add    $0x1,%ebx
+  801df1:	83 c4 10             	add    $0x10,%esp
+  801df4:	eb dd                	jmp    801dd3 <fs_init+0x51>
+		ide_set_disk(0);
+  801df6:	83 ec 0c             	sub    $0xc,%esp
+  801df9:	6a 00                	push   $0x0
+  801dfb:	e8 d0 e2 ff ff       	call   8000d0 <ide_set_disk>
+  801e00:	83 c4 10             	add    $0x10,%esp
+  801e03:	eb 9c                	jmp    801da1 <fs_init+0x1f>
+	check_bitmap();
+  801e05:	e8 c1 fe ff ff       	call   801ccb <check_bitmap>
+	nwords = (super->s_nblocks + 31) / 32;
+  801e0a:	a1 24 01 86 00       	mov    0x860124,%eax
+  801e0f:	8b 48 04             	mov    0x4(%eax),%ecx
+  801e12:	8d 41 1f             	lea    0x1f(%ecx),%eax
+  801e15:	c1 e8 05             	shr    $0x5,%eax
+  801e18:	89 c6                	mov    %eax,%esi
+  801e1a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (super->s_nblocks % 32)
+  801e1d:	83 e1 1f             	and    $0x1f,%ecx
+  801e20:	74 14                	je     801e36 <fs_init+0xb4>
+		bitmap[nwords - 1] &= (1 << (super->s_nblocks % 32)) - 1;
+  801e22:	8b 15 20 01 86 00    	mov    0x860120,%edx
+  801e28:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e2d:	d3 e0                	shl    %cl,%eax
+  801e2f:	83 e8 01             	sub    $0x1,%eax
+  801e32:	21 44 b2 fc          	and    %eax,-0x4(%edx,%esi,4)
+	nfree = 0;
+  801e36:	c7 05 34 c2 86 00 00 	movl   $0x0,0x86c234
+  801e3d:	00 00 00 
+	for (idx = 0; idx < nwords; idx++) {
+  801e40:	be 00 00 00 00       	mov    $0x0,%esi
+		for (bits = bitmap[idx]; bits; bits &= bits - 1)
+  801e45:	bb 01 00 00 00       	mov    $0x1,%ebx
+	for (idx = 0; idx < nwords; idx++) {
+  801e4a:	eb 1f                	jmp    801e6b <fs_init+0xe9>
+		for (bits = bitmap[idx]; bits; bits &= bits - 1)
+  801e4c:	8d 50 ff             	lea    -0x1(%eax),%edx
+  801e4f:	21 d0                	and    %edx,%eax
+  801e51:	89 ca                	mov    %ecx,%edx
+  801e53:	89 df                	mov    %ebx,%edi
+  801e55:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801e58:	85 c0                	test   %eax,%eax
+  801e5a:	75 f0                	jne    801e4c <fs_init+0xca>
+  801e5c:	89 f8                	mov    %edi,%eax
+  801e5e:	84 c0                	test   %al,%al
+  801e60:	74 06                	je     801e68 <fs_init+0xe6>
+  801e62:	89 15 34 c2 86 00    	mov    %edx,0x86c234
+	for (idx = 0; idx < nwords; idx++) {
+  801e68:	83 c6 01             	add    $0x1,%esi
+  801e6b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801e6e:	74 1c                	je     801e8c <fs_init+0x10a>
+		freemap_update(idx);
+  801e70:	89 f0                	mov    %esi,%eax
+  801e72:	e8 cb f3 ff ff       	call   801242 <freemap_update>
+		for (bits = bitmap[idx]; bits; bits &= bits - 1)
+  801e77:	a1 20 01 86 00       	mov    0x860120,%eax
+  801e7c:	8b 04 b0             	mov    (%eax,%esi,4),%eax
+  801e7f:	8b 15 34 c2 86 00    	mov    0x86c234,%edx
+  801e85:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e8a:	eb c9                	jmp    801e55 <fs_init+0xd3>
+}
+  801e8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e8f:	5b                   	pop    %ebx
+  801e90:	5e                   	pop    %esi
+  801e91:	5f                   	pop    %edi
+  801e92:	5d                   	pop    %ebp
+  801e93:	c3                   	ret
+
+00801e94 <file_commit>:
+{
+  801e94:	55                   	push   %ebp
+  801e95:	89 e5                	mov    %esp,%ebp
+  801e97:	57                   	push   %edi
+  801e98:	56                   	push   %esi
+  801e99:	53                   	push   %ebx
+  801e9a:	83 ec 3c             	sub    $0x3c,%esp
+	while (da_count > 0) {
+  801e9d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ea0:	83 3d 04 72 86 00 00 	cmpl   $0x0,0x867204
+  801ea7:	0f 84 64 02 00 00    	je     802111 <file_commit+0x27d>
+  801ead:	a1 08 72 86 00       	mov    0x867208,%eax
+  801eb2:	8d 0c 40             	lea    (%eax,%eax,2),%ecx
+  801eb5:	c1 e1 02             	shl    $0x2,%ecx
+		g = f;
+  801eb8:	89 f3                	mov    %esi,%ebx
+		for (i = n = 0; i < da_nused; i++)
+  801eba:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ebf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ec4:	eb 15                	jmp    801edb <file_commit+0x47>
+				bnos[n++] = da_ents[i].d_filebno;
+  801ec6:	8b 98 24 92 86 00    	mov    0x869224(%eax),%ebx
+  801ecc:	89 1c bd 00 62 86 00 	mov    %ebx,0x866200(,%edi,4)
+  801ed3:	8d 7f 01             	lea    0x1(%edi),%edi
+				g = da_ents[i].d_file;
+  801ed6:	89 d3                	mov    %edx,%ebx
+		for (i = n = 0; i < da_nused; i++)
+  801ed8:	83 c0 0c             	add    $0xc,%eax
+  801edb:	39 c8                	cmp    %ecx,%eax
+  801edd:	74 14                	je     801ef3 <file_commit+0x5f>
+			if (da_ents[i].d_file && (!g || da_ents[i].d_file == g)) {
+  801edf:	8b 90 20 92 86 00    	mov    0x869220(%eax),%edx
+  801ee5:	85 d2                	test   %edx,%edx
+  801ee7:	74 ef                	je     801ed8 <file_commit+0x44>
+  801ee9:	85 db                	test   %ebx,%ebx
+  801eeb:	74 d9                	je     801ec6 <file_commit+0x32>
+  801eed:	39 da                	cmp    %ebx,%edx
+  801eef:	75 e7                	jne    801ed8 <file_commit+0x44>
+  801ef1:	eb d3                	jmp    801ec6 <file_commit+0x32>
+		if (n == 0)
+  801ef3:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+  801ef6:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+  801ef9:	89 fb                	mov    %edi,%ebx
+  801efb:	85 ff                	test   %edi,%edi
+  801efd:	0f 84 07 02 00 00    	je     80210a <file_commit+0x276>
+		for (i = 1; i < n; i++)
+  801f03:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f08:	eb 03                	jmp    801f0d <file_commit+0x79>
+  801f0a:	83 c1 01             	add    $0x1,%ecx
+  801f0d:	39 d9                	cmp    %ebx,%ecx
+  801f0f:	74 2b                	je     801f3c <file_commit+0xa8>
+			for (j = i; j > 0 && bnos[j - 1] > bnos[j]; j--) {
+  801f11:	89 c8                	mov    %ecx,%eax
+  801f13:	85 c0                	test   %eax,%eax
+  801f15:	74 f3                	je     801f0a <file_commit+0x76>
+  801f17:	83 e8 01             	sub    $0x1,%eax
+  801f1a:	8b 14 85 00 62 86 00 	mov    0x866200(,%eax,4),%edx
+  801f21:	8b 3c 85 04 62 86 00 	mov    0x866204(,%eax,4),%edi
+  801f28:	39 d7                	cmp    %edx,%edi
+  801f2a:	73 de                	jae    801f0a <file_commit+0x76>
+				bnos[j] = bnos[j - 1];
+  801f2c:	89 14 85 04 62 86 00 	mov    %edx,0x866204(,%eax,4)
+				bnos[j - 1] = m;
+  801f33:	89 3c 85 00 62 86 00 	mov    %edi,0x866200(,%eax,4)
+			for (j = i; j > 0 && bnos[j - 1] > bnos[j]; j--) {
+  801f3a:	eb d7                	jmp    801f13 <file_commit+0x7f>
+		for (i = 0; i < n; i = j) {
+  801f3c:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  801f43:	89 75 08             	mov    %esi,0x8(%ebp)
+  801f46:	e9 9f 01 00 00       	jmp    8020ea <file_commit+0x256>
+			for (j = i + 1; j < n && bnos[j] == bnos[j - 1] + 1; j++)
+  801f4b:	83 c6 01             	add    $0x1,%esi
+  801f4e:	39 ce                	cmp    %ecx,%esi
+  801f50:	74 15                	je     801f67 <file_commit+0xd3>
+  801f52:	8b 04 b5 fc 61 86 00 	mov    0x8661fc(,%esi,4),%eax
+  801f59:	83 c0 01             	add    $0x1,%eax
+  801f5c:	39 04 b5 00 62 86 00 	cmp    %eax,0x866200(,%esi,4)
+  801f63:	74 e6                	je     801f4b <file_commit+0xb7>
+  801f65:	eb 03                	jmp    801f6a <file_commit+0xd6>
+  801f67:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+			r = file_alloc_blocks(g, bnos[i], j - i);
+  801f6a:	89 f0                	mov    %esi,%eax
+  801f6c:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  801f6f:	29 f8                	sub    %edi,%eax
+  801f71:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801f74:	8b 3c bd 00 62 86 00 	mov    0x866200(,%edi,4),%edi
+	while (count > 0) {
+  801f7b:	89 75 c0             	mov    %esi,-0x40(%ebp)
+  801f7e:	e9 98 00 00 00       	jmp    80201b <file_commit+0x187>
+		for (n = 1; n < count; n++) {
+  801f83:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801f88:	89 75 c8             	mov    %esi,-0x38(%ebp)
+  801f8b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  801f8e:	39 de                	cmp    %ebx,%esi
+  801f90:	74 2b                	je     801fbd <file_commit+0x129>
+			if ((r = file_block_walk(f, filebno + n, &pdiskbno, true)) < 0)
+  801f92:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801f95:	83 ec 0c             	sub    $0xc,%esp
+  801f98:	6a 01                	push   $0x1
+  801f9a:	8d 4d dc             	lea    -0x24(%ebp),%ecx
+  801f9d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801fa0:	e8 3f f9 ff ff       	call   8018e4 <file_block_walk>
+  801fa5:	83 c4 10             	add    $0x10,%esp
+  801fa8:	85 c0                	test   %eax,%eax
+  801faa:	0f 88 b4 00 00 00    	js     802064 <file_commit+0x1d0>
+			if (*pdiskbno)
+  801fb0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801fb3:	83 38 00             	cmpl   $0x0,(%eax)
+  801fb6:	75 59                	jne    802011 <file_commit+0x17d>
+		for (n = 1; n < count; n++) {
+  801fb8:	83 c3 01             	add    $0x1,%ebx
+  801fbb:	eb d1                	jmp    801f8e <file_commit+0xfa>
+  801fbd:	8b 75 c8             	mov    -0x38(%ebp),%esi
+  801fc0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+		if ((r = alloc_extent(file_block_goal(f, filebno), n, &start)) < 0)
+  801fc3:	89 fa                	mov    %edi,%edx
+  801fc5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801fc8:	e8 b3 fa ff ff       	call   801a80 <file_block_goal>
+  801fcd:	83 ec 04             	sub    $0x4,%esp
+  801fd0:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  801fd3:	51                   	push   %ecx
+  801fd4:	53                   	push   %ebx
+  801fd5:	50                   	push   %eax
+  801fd6:	e8 fc f6 ff ff       	call   8016d7 <alloc_extent>
+  801fdb:	83 c4 10             	add    $0x10,%esp
+  801fde:	85 c0                	test   %eax,%eax
+  801fe0:	0f 88 8b 00 00 00    	js     802071 <file_commit+0x1dd>
+  801fe6:	89 c3                	mov    %eax,%ebx
+		for (i = 0; i < r; i++) {
+  801fe8:	39 de                	cmp    %ebx,%esi
+  801fea:	74 2a                	je     802016 <file_commit+0x182>
+			file_block_walk(f, filebno + i, &pdiskbno, 0);
+  801fec:	8d 14 37             	lea    (%edi,%esi,1),%edx
+  801fef:	83 ec 0c             	sub    $0xc,%esp
+  801ff2:	6a 00                	push   $0x0
+  801ff4:	8d 4d dc             	lea    -0x24(%ebp),%ecx
+  801ff7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801ffa:	e8 e5 f8 ff ff       	call   8018e4 <file_block_walk>
+			*pdiskbno = start + i;
+  801fff:	89 f2                	mov    %esi,%edx
+  802001:	03 55 e0             	add    -0x20(%ebp),%edx
+  802004:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802007:	89 10                	mov    %edx,(%eax)
+		for (i = 0; i < r; i++) {
+  802009:	83 c6 01             	add    $0x1,%esi
+  80200c:	83 c4 10             	add    $0x10,%esp
+  80200f:	eb d7                	jmp    801fe8 <file_commit+0x154>
+  802011:	8b 75 c8             	mov    -0x38(%ebp),%esi
+  802014:	eb ad                	jmp    801fc3 <file_commit+0x12f>
+		filebno += r;
+  802016:	01 df                	add    %ebx,%edi
+		count -= r;
+  802018:	29 5d d0             	sub    %ebx,-0x30(%ebp)
+	while (count > 0) {
+  80201b:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80201f:	74 2f                	je     802050 <file_commit+0x1bc>
+		if ((r = file_block_walk(f, filebno, &pdiskbno, true)) < 0)
+  802021:	83 ec 0c             	sub    $0xc,%esp
+  802024:	6a 01                	push   $0x1
+  802026:	8d 4d dc             	lea    -0x24(%ebp),%ecx
+  802029:	89 fa                	mov    %edi,%edx
+  80202b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80202e:	e8 b1 f8 ff ff       	call   8018e4 <file_block_walk>
+  802033:	83 c4 10             	add    $0x10,%esp
+  802036:	85 c0                	test   %eax,%eax
+  802038:	78 22                	js     80205c <file_commit+0x1c8>
+		if (*pdiskbno) {
+  80203a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80203d:	8b 30                	mov    (%eax),%esi
+  80203f:	85 f6                	test   %esi,%esi
+  802041:	0f 84 3c ff ff ff    	je     801f83 <file_commit+0xef>
+			filebno++;
+  802047:	83 c7 01             	add    $0x1,%edi
+			count--;
+  80204a:	83 6d d0 01          	subl   $0x1,-0x30(%ebp)
+			continue;
+  80204e:	eb cb                	jmp    80201b <file_commit+0x187>
+	return 0;
+  802050:	8b 75 c0             	mov    -0x40(%ebp),%esi
+  802053:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+  80205a:	eb 0e                	jmp    80206a <file_commit+0x1d6>
+  80205c:	8b 75 c0             	mov    -0x40(%ebp),%esi
+  80205f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  802062:	eb 06                	jmp    80206a <file_commit+0x1d6>
+  802064:	8b 75 c0             	mov    -0x40(%ebp),%esi
+  802067:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			for (m = i; m < j; m++) {
+  80206a:	89 f7                	mov    %esi,%edi
+  80206c:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+  80206f:	eb 0b                	jmp    80207c <file_commit+0x1e8>
+  802071:	8b 75 c0             	mov    -0x40(%ebp),%esi
+  802074:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  802077:	eb f1                	jmp    80206a <file_commit+0x1d6>
+  802079:	83 c3 01             	add    $0x1,%ebx
+  80207c:	39 fb                	cmp    %edi,%ebx
+  80207e:	73 58                	jae    8020d8 <file_commit+0x244>
+				if (file_block_walk(g, bnos[m], &pdiskbno, 0) < 0
+  802080:	8b 14 9d 00 62 86 00 	mov    0x866200(,%ebx,4),%edx
+  802087:	83 ec 0c             	sub    $0xc,%esp
+  80208a:	6a 00                	push   $0x0
+  80208c:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  80208f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802092:	e8 4d f8 ff ff       	call   8018e4 <file_block_walk>
+  802097:	83 c4 10             	add    $0x10,%esp
+  80209a:	85 c0                	test   %eax,%eax
+  80209c:	78 db                	js     802079 <file_commit+0x1e5>
+				    || *pdiskbno == 0)
+  80209e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8020a1:	8b 30                	mov    (%eax),%esi
+  8020a3:	85 f6                	test   %esi,%esi
+  8020a5:	74 d2                	je     802079 <file_commit+0x1e5>
+				k = da_find(g, bnos[m]);
+  8020a7:	8b 14 9d 00 62 86 00 	mov    0x866200(,%ebx,4),%edx
+  8020ae:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8020b1:	e8 e1 f1 ff ff       	call   801297 <da_find>
+				bc_insert(*pdiskbno, da_page(k));
+  8020b6:	83 ec 08             	sub    $0x8,%esp
+	return (char *) DELALLOC_VA + i * PGSIZE;
+  8020b9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8020bc:	c1 e0 0c             	shl    $0xc,%eax
+  8020bf:	05 00 80 7c 0f       	add    $0xf7c8000,%eax
+				bc_insert(*pdiskbno, da_page(k));
+  8020c4:	50                   	push   %eax
+  8020c5:	56                   	push   %esi
+  8020c6:	e8 e9 ec ff ff       	call   800db4 <bc_insert>
+				da_remove(k);
+  8020cb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8020ce:	e8 cc f2 ff ff       	call   80139f <da_remove>
+  8020d3:	83 c4 10             	add    $0x10,%esp
+  8020d6:	eb a1                	jmp    802079 <file_commit+0x1e5>
+			if (r < 0)
+  8020d8:	89 fe                	mov    %edi,%esi
+  8020da:	83 7d c8 00          	cmpl   $0x0,-0x38(%ebp)
+  8020de:	78 38                	js     802118 <file_commit+0x284>
+		for (i = 0; i < n; i = j) {
+  8020e0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8020e3:	39 c7                	cmp    %eax,%edi
+  8020e5:	73 11                	jae    8020f8 <file_commit+0x264>
+  8020e7:	89 75 cc             	mov    %esi,-0x34(%ebp)
+			for (j = i + 1; j < n && bnos[j] == bnos[j - 1] + 1; j++)
+  8020ea:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8020ed:	8d 70 01             	lea    0x1(%eax),%esi
+  8020f0:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+  8020f3:	e9 56 fe ff ff       	jmp    801f4e <file_commit+0xba>
+		if (f)
+  8020f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020fb:	85 f6                	test   %esi,%esi
+  8020fd:	0f 84 9d fd ff ff    	je     801ea0 <file_commit+0xc>
+			return 0;
+  802103:	ba 00 00 00 00       	mov    $0x0,%edx
+  802108:	eb 11                	jmp    80211b <file_commit+0x287>
+			return 0;
+  80210a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80210f:	eb 0a                	jmp    80211b <file_commit+0x287>
+	return 0;
+  802111:	ba 00 00 00 00       	mov    $0x0,%edx
+  802116:	eb 03                	jmp    80211b <file_commit+0x287>
+  802118:	8b 55 c8             	mov    -0x38(%ebp),%edx
+}
+  80211b:	89 d0                	mov    %edx,%eax
+  80211d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802120:	5b                   	pop    %ebx
+  802121:	5e                   	pop    %esi
+  802122:	5f                   	pop    %edi
+  802123:	5d                   	pop    %ebp
+  802124:	c3                   	ret
+
+00802125 <file_get_block>:
+{
+  802125:	55                   	push   %ebp
+  802126:	89 e5                	mov    %esp,%ebp
+  802128:	57                   	push   %edi
+  802129:	56                   	push   %esi
+  80212a:	53                   	push   %ebx
+  80212b:	83 ec 1c             	sub    $0x1c,%esp
+  80212e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (f->f_type == FTYPE_REG) {
+  802131:	83 be 84 00 00 00 00 	cmpl   $0x0,0x84(%esi)
+  802138:	75 7e                	jne    8021b8 <file_get_block+0x93>
+		r = file_block_walk(f, filebno, &pdiskbno, 0);
+  80213a:	83 ec 0c             	sub    $0xc,%esp
+  80213d:	6a 00                	push   $0x0
+  80213f:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  802142:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802145:	89 f0                	mov    %esi,%eax
+  802147:	e8 98 f7 ff ff       	call   8018e4 <file_block_walk>
+  80214c:	89 c3                	mov    %eax,%ebx
+		if (r < 0 && r != -E_NOT_FOUND)
+  80214e:	83 c4 10             	add    $0x10,%esp
+  802151:	85 c0                	test   %eax,%eax
+  802153:	79 09                	jns    80215e <file_get_block+0x39>
+  802155:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802158:	0f 85 98 00 00 00    	jne    8021f6 <file_get_block+0xd1>
+		if (r == 0 && *pdiskbno) {
+  80215e:	85 db                	test   %ebx,%ebx
+  802160:	75 09                	jne    80216b <file_get_block+0x46>
+  802162:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802165:	8b 00                	mov    (%eax),%eax
+  802167:	85 c0                	test   %eax,%eax
+  802169:	75 22                	jne    80218d <file_get_block+0x68>
+		if ((r = da_find(f, filebno)) >= 0) {
+  80216b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80216e:	89 f0                	mov    %esi,%eax
+  802170:	e8 22 f1 ff ff       	call   801297 <da_find>
+  802175:	85 c0                	test   %eax,%eax
+  802177:	78 27                	js     8021a0 <file_get_block+0x7b>
+	return (char *) DELALLOC_VA + i * PGSIZE;
+  802179:	c1 e0 0c             	shl    $0xc,%eax
+  80217c:	05 00 80 7c 0f       	add    $0xf7c8000,%eax
+  802181:	8b 55 10             	mov    0x10(%ebp),%edx
+  802184:	89 02                	mov    %eax,(%edx)
+			return 0;
+  802186:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80218b:	eb 69                	jmp    8021f6 <file_get_block+0xd1>
+			*blk = bc_lookup(*pdiskbno);
+  80218d:	83 ec 0c             	sub    $0xc,%esp
+  802190:	50                   	push   %eax
+  802191:	e8 38 e2 ff ff       	call   8003ce <bc_lookup>
+  802196:	8b 55 10             	mov    0x10(%ebp),%edx
+  802199:	89 02                	mov    %eax,(%edx)
+			return 0;
+  80219b:	83 c4 10             	add    $0x10,%esp
+  80219e:	eb 56                	jmp    8021f6 <file_get_block+0xd1>
+		if ((r = da_add(f, filebno, blk)) == -E_NO_MEM
+  8021a0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8021a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021a6:	89 f0                	mov    %esi,%eax
+  8021a8:	e8 e6 f2 ff ff       	call   801493 <da_add>
+  8021ad:	89 c3                	mov    %eax,%ebx
+  8021af:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8021b2:	74 4c                	je     802200 <file_get_block+0xdb>
+		if (r == 0)
+  8021b4:	85 db                	test   %ebx,%ebx
+  8021b6:	74 3e                	je     8021f6 <file_get_block+0xd1>
+	r = file_block_walk(f, filebno, &pdiskbno, true);
+  8021b8:	83 ec 0c             	sub    $0xc,%esp
+  8021bb:	6a 01                	push   $0x1
+  8021bd:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  8021c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021c3:	89 f0                	mov    %esi,%eax
+  8021c5:	e8 1a f7 ff ff       	call   8018e4 <file_block_walk>
+  8021ca:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8021cc:	83 c4 10             	add    $0x10,%esp
+  8021cf:	85 c0                	test   %eax,%eax
+  8021d1:	78 23                	js     8021f6 <file_get_block+0xd1>
+	if (*pdiskbno == 0) {
+  8021d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8021d6:	83 3f 00             	cmpl   $0x0,(%edi)
+  8021d9:	74 47                	je     802222 <file_get_block+0xfd>
+	if (f->f_type == FTYPE_DIR)
+  8021db:	83 be 84 00 00 00 01 	cmpl   $0x1,0x84(%esi)
+  8021e2:	74 5d                	je     802241 <file_get_block+0x11c>
+	*blk = bc_lookup(*pdiskbno);
+  8021e4:	83 ec 0c             	sub    $0xc,%esp
+  8021e7:	ff 37                	push   (%edi)
+  8021e9:	e8 e0 e1 ff ff       	call   8003ce <bc_lookup>
+  8021ee:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8021f1:	89 07                	mov    %eax,(%edi)
+  8021f3:	83 c4 10             	add    $0x10,%esp
+}
+  8021f6:	89 d8                	mov    %ebx,%eax
+  8021f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021fb:	5b                   	pop    %ebx
+  8021fc:	5e                   	pop    %esi
+  8021fd:	5f                   	pop    %edi
+  8021fe:	5d                   	pop    %ebp
+  8021ff:	c3                   	ret
+		    && file_commit(0) == 0)
+  802200:	83 ec 0c             	sub    $0xc,%esp
+  802203:	6a 00                	push   $0x0
+  802205:	e8 8a fc ff ff       	call   801e94 <file_commit>
+  80220a:	83 c4 10             	add    $0x10,%esp
+  80220d:	85 c0                	test   %eax,%eax
+  80220f:	75 a7                	jne    8021b8 <file_get_block+0x93>
+			r = da_add(f, filebno, blk);
+  802211:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802214:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802217:	89 f0                	mov    %esi,%eax
+  802219:	e8 75 f2 ff ff       	call   801493 <da_add>
+  80221e:	89 c3                	mov    %eax,%ebx
+  802220:	eb 92                	jmp    8021b4 <file_get_block+0x8f>
+		r = alloc_block_near(file_block_goal(f, filebno), pdiskbno);
+  802222:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802225:	89 f0                	mov    %esi,%eax
+  802227:	e8 54 f8 ff ff       	call   801a80 <file_block_goal>
+  80222c:	83 ec 08             	sub    $0x8,%esp
+  80222f:	57                   	push   %edi
+  802230:	50                   	push   %eax
+  802231:	e8 1c f6 ff ff       	call   801852 <alloc_block_near>
+  802236:	89 c3                	mov    %eax,%ebx
+		if (r < 0)
+  802238:	83 c4 10             	add    $0x10,%esp
+  80223b:	85 c0                	test   %eax,%eax
+  80223d:	79 9c                	jns    8021db <file_get_block+0xb6>
+  80223f:	eb b5                	jmp    8021f6 <file_get_block+0xd1>
+		bc_pin(*pdiskbno);
+  802241:	83 ec 0c             	sub    $0xc,%esp
+  802244:	ff 37                	push   (%edi)
+  802246:	e8 0f e4 ff ff       	call   80065a <bc_pin>
+  80224b:	83 c4 10             	add    $0x10,%esp
+  80224e:	eb 94                	jmp    8021e4 <file_get_block+0xbf>
+
+00802250 <dir_grow>:
+{
+  802250:	55                   	push   %ebp
+  802251:	89 e5                	mov    %esp,%ebp
+  802253:	56                   	push   %esi
+  802254:	53                   	push   %ebx
+  802255:	83 ec 14             	sub    $0x14,%esp
+  802258:	89 c3                	mov    %eax,%ebx
+  80225a:	89 d6                	mov    %edx,%esi
+	dir->f_size += BLKSIZE;
+  80225c:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802262:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802268:	89 93 80 00 00 00    	mov    %edx,0x80(%ebx)
+	if ((r = file_get_block(dir, dir->f_size / BLKSIZE - 1, &blk)) < 0) {
+  80226e:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  802271:	51                   	push   %ecx
+  802272:	05 ff 1f 00 00       	add    $0x1fff,%eax
+  802277:	85 d2                	test   %edx,%edx
+  802279:	0f 49 c2             	cmovns %edx,%eax
+  80227c:	c1 f8 0c             	sar    $0xc,%eax
+  80227f:	83 e8 01             	sub    $0x1,%eax
+  802282:	50                   	push   %eax
+  802283:	53                   	push   %ebx
+  802284:	e8 9c fe ff ff       	call   802125 <file_get_block>
+  802289:	83 c4 10             	add    $0x10,%esp
+  80228c:	85 c0                	test   %eax,%eax
+  80228e:	78 24                	js     8022b4 <dir_grow+0x64>
+	memset(blk, 0, BLKSIZE);
+  802290:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+  802293:	83 ec 04             	sub    $0x4,%esp
+  802296:	68 00 10 00 00       	push   $0x1000
+  80229b:	6a 00                	push   $0x0
+  80229d:	53                   	push   %ebx
+  80229e:	e8 8a 38 00 00       	call   805b2d <memset>
+	*pblk = (struct File *) blk;
+  8022a3:	89 1e                	mov    %ebx,(%esi)
+	return 0;
+  8022a5:	83 c4 10             	add    $0x10,%esp
+  8022a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022b0:	5b                   	pop    %ebx
+  8022b1:	5e                   	pop    %esi
+  8022b2:	5d                   	pop    %ebp
+  8022b3:	c3                   	ret
+		dir->f_size -= BLKSIZE;
+  8022b4:	81 ab 80 00 00 00 00 	subl   $0x1000,0x80(%ebx)
+  8022bb:	10 00 00 
+		return r;
+  8022be:	eb ed                	jmp    8022ad <dir_grow+0x5d>
+
+008022c0 <file_find_block>:
+{
+  8022c0:	55                   	push   %ebp
+  8022c1:	89 e5                	mov    %esp,%ebp
+  8022c3:	57                   	push   %edi
+  8022c4:	56                   	push   %esi
+  8022c5:	53                   	push   %ebx
+  8022c6:	83 ec 28             	sub    $0x28,%esp
+  8022c9:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = file_block_walk(f, filebno, &pdiskbno, 0);
+  8022cc:	6a 00                	push   $0x0
+  8022ce:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  8022d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022d4:	89 f0                	mov    %esi,%eax
+  8022d6:	e8 09 f6 ff ff       	call   8018e4 <file_block_walk>
+  8022db:	89 c3                	mov    %eax,%ebx
+	if (r < 0 && r != -E_NOT_FOUND)
+  8022dd:	83 c4 10             	add    $0x10,%esp
+  8022e0:	85 c0                	test   %eax,%eax
+  8022e2:	79 05                	jns    8022e9 <file_find_block+0x29>
+  8022e4:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8022e7:	75 2d                	jne    802316 <file_find_block+0x56>
+	if (r == 0 && *pdiskbno) {
+  8022e9:	85 db                	test   %ebx,%ebx
+  8022eb:	75 09                	jne    8022f6 <file_find_block+0x36>
+  8022ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8022f0:	8b 07                	mov    (%edi),%eax
+  8022f2:	85 c0                	test   %eax,%eax
+  8022f4:	75 2a                	jne    802320 <file_find_block+0x60>
+	if ((i = da_find(f, filebno)) < 0)
+  8022f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022f9:	89 f0                	mov    %esi,%eax
+  8022fb:	e8 97 ef ff ff       	call   801297 <da_find>
+  802300:	85 c0                	test   %eax,%eax
+  802302:	78 47                	js     80234b <file_find_block+0x8b>
+	return (char *) DELALLOC_VA + i * PGSIZE;
+  802304:	c1 e0 0c             	shl    $0xc,%eax
+  802307:	05 00 80 7c 0f       	add    $0xf7c8000,%eax
+  80230c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80230f:	89 07                	mov    %eax,(%edi)
+	return 0;
+  802311:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802316:	89 d8                	mov    %ebx,%eax
+  802318:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80231b:	5b                   	pop    %ebx
+  80231c:	5e                   	pop    %esi
+  80231d:	5f                   	pop    %edi
+  80231e:	5d                   	pop    %ebp
+  80231f:	c3                   	ret
+		if (f->f_type == FTYPE_DIR)
+  802320:	83 be 84 00 00 00 01 	cmpl   $0x1,0x84(%esi)
+  802327:	74 14                	je     80233d <file_find_block+0x7d>
+		*blk = bc_lookup(*pdiskbno);
+  802329:	83 ec 0c             	sub    $0xc,%esp
+  80232c:	ff 37                	push   (%edi)
+  80232e:	e8 9b e0 ff ff       	call   8003ce <bc_lookup>
+  802333:	8b 55 10             	mov    0x10(%ebp),%edx
+  802336:	89 02                	mov    %eax,(%edx)
+		return 0;
+  802338:	83 c4 10             	add    $0x10,%esp
+  80233b:	eb d9                	jmp    802316 <file_find_block+0x56>
+			bc_pin(*pdiskbno);
+  80233d:	83 ec 0c             	sub    $0xc,%esp
+  802340:	50                   	push   %eax
+  802341:	e8 14 e3 ff ff       	call   80065a <bc_pin>
+  802346:	83 c4 10             	add    $0x10,%esp
+  802349:	eb de                	jmp    802329 <file_find_block+0x69>
+		return -E_NOT_FOUND;
+  80234b:	bb f5 ff ff ff       	mov    $0xfffffff5,%ebx
+  802350:	eb c4                	jmp    802316 <file_find_block+0x56>
+
+00802352 <dir_entry>:
+{
+  802352:	55                   	push   %ebp
+  802353:	89 e5                	mov    %esp,%ebp
+  802355:	53                   	push   %ebx
+  802356:	83 ec 18             	sub    $0x18,%esp
+  802359:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = file_find_block(dir, i / BLKFILES, &blk)) < 0)
+  80235c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80235f:	50                   	push   %eax
+  802360:	89 d8                	mov    %ebx,%eax
+  802362:	c1 e8 04             	shr    $0x4,%eax
+  802365:	50                   	push   %eax
+  802366:	ff 75 08             	push   0x8(%ebp)
+  802369:	e8 52 ff ff ff       	call   8022c0 <file_find_block>
+  80236e:	83 c4 10             	add    $0x10,%esp
+  802371:	85 c0                	test   %eax,%eax
+  802373:	78 13                	js     802388 <dir_entry+0x36>
+	*pf = (struct File *) blk + i % BLKFILES;
+  802375:	83 e3 0f             	and    $0xf,%ebx
+  802378:	c1 e3 08             	shl    $0x8,%ebx
+  80237b:	03 5d f4             	add    -0xc(%ebp),%ebx
+  80237e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802381:	89 18                	mov    %ebx,(%eax)
+	return 0;
+  802383:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802388:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80238b:	c9                   	leave
+  80238c:	c3                   	ret
+
+0080238d <walk_path>:
+{
+  80238d:	55                   	push   %ebp
+  80238e:	89 e5                	mov    %esp,%ebp
+  802390:	57                   	push   %edi
+  802391:	56                   	push   %esi
+  802392:	53                   	push   %ebx
+  802393:	81 ec bc 00 00 00    	sub    $0xbc,%esp
+  802399:	89 95 40 ff ff ff    	mov    %edx,-0xc0(%ebp)
+  80239f:	89 8d 3c ff ff ff    	mov    %ecx,-0xc4(%ebp)
+	while (*p == '/')
+  8023a5:	eb 03                	jmp    8023aa <walk_path+0x1d>
+		p++;
+  8023a7:	83 c0 01             	add    $0x1,%eax
+	while (*p == '/')
+  8023aa:	80 38 2f             	cmpb   $0x2f,(%eax)
+  8023ad:	74 f8                	je     8023a7 <walk_path+0x1a>
+	f = &super->s_root;
+  8023af:	8b 3d 24 01 86 00    	mov    0x860124,%edi
+  8023b5:	8d 57 08             	lea    0x8(%edi),%edx
+  8023b8:	89 95 64 ff ff ff    	mov    %edx,-0x9c(%ebp)
+	name[0] = 0;
+  8023be:	c6 85 68 ff ff ff 00 	movb   $0x0,-0x98(%ebp)
+	if (pdir)
+  8023c5:	8b bd 40 ff ff ff    	mov    -0xc0(%ebp),%edi
+  8023cb:	85 ff                	test   %edi,%edi
+  8023cd:	74 06                	je     8023d5 <walk_path+0x48>
+		*pdir = 0;
+  8023cf:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+	*pf = 0;
+  8023d5:	8b bd 3c ff ff ff    	mov    -0xc4(%ebp),%edi
+  8023db:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+	dir = 0;
+  8023e1:	c7 85 54 ff ff ff 00 	movl   $0x0,-0xac(%ebp)
+  8023e8:	00 00 00 
+		memmove(name, p, path - p);
+  8023eb:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	while (*path != '\0') {
+  8023f1:	e9 ef 02 00 00       	jmp    8026e5 <walk_path+0x358>
+			path++;
+  8023f6:	83 c3 01             	add    $0x1,%ebx
+		while (*path != '/' && *path != '\0')
+  8023f9:	0f b6 13             	movzbl (%ebx),%edx
+  8023fc:	80 fa 2f             	cmp    $0x2f,%dl
+  8023ff:	74 04                	je     802405 <walk_path+0x78>
+  802401:	84 d2                	test   %dl,%dl
+  802403:	75 f1                	jne    8023f6 <walk_path+0x69>
+		if (path - p >= MAXNAMELEN)
+  802405:	89 de                	mov    %ebx,%esi
+  802407:	29 c6                	sub    %eax,%esi
+  802409:	83 fe 7f             	cmp    $0x7f,%esi
+  80240c:	0f 8f ac 02 00 00    	jg     8026be <walk_path+0x331>
+		memmove(name, p, path - p);
+  802412:	83 ec 04             	sub    $0x4,%esp
+  802415:	56                   	push   %esi
+  802416:	50                   	push   %eax
+  802417:	57                   	push   %edi
+  802418:	e8 45 37 00 00       	call   805b62 <memmove>
+		name[path - p] = '\0';
+  80241d:	c6 84 35 68 ff ff ff 	movb   $0x0,-0x98(%ebp,%esi,1)
+  802424:	00 
+	while (*p == '/')
+  802425:	83 c4 10             	add    $0x10,%esp
+  802428:	eb 03                	jmp    80242d <walk_path+0xa0>
+		p++;
+  80242a:	83 c3 01             	add    $0x1,%ebx
+	while (*p == '/')
+  80242d:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  802430:	74 f8                	je     80242a <walk_path+0x9d>
+		if (dir->f_type != FTYPE_DIR)
+  802432:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  802438:	83 b9 84 00 00 00 01 	cmpl   $0x1,0x84(%ecx)
+  80243f:	0f 85 80 02 00 00    	jne    8026c5 <walk_path+0x338>
+	if (dcache_lookup(dir, name, file))
+  802445:	83 ec 04             	sub    $0x4,%esp
+  802448:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+  80244e:	50                   	push   %eax
+  80244f:	57                   	push   %edi
+  802450:	51                   	push   %ecx
+  802451:	e8 96 11 00 00       	call   8035ec <dcache_lookup>
+  802456:	83 c4 10             	add    $0x10,%esp
+  802459:	85 c0                	test   %eax,%eax
+  80245b:	74 17                	je     802474 <walk_path+0xe7>
+		return *file ? 0 : -E_NOT_FOUND;
+  80245d:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  802462:	83 bd 64 ff ff ff 00 	cmpl   $0x0,-0x9c(%ebp)
+  802469:	0f 85 74 02 00 00    	jne    8026e3 <walk_path+0x356>
+  80246f:	e9 67 02 00 00       	jmp    8026db <walk_path+0x34e>
+	assert((dir->f_size % BLKSIZE) == 0);
+  802474:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  80247a:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802480:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802485:	0f 85 cf 00 00 00    	jne    80255a <walk_path+0x1cd>
+	if (dir->f_hindex) {
+  80248b:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  802491:	8b 89 b8 00 00 00    	mov    0xb8(%ecx),%ecx
+  802497:	89 8d 4c ff ff ff    	mov    %ecx,-0xb4(%ebp)
+  80249d:	85 c9                	test   %ecx,%ecx
+  80249f:	0f 85 ce 00 00 00    	jne    802573 <walk_path+0x1e6>
+	nblock = dir->f_size / BLKSIZE;
+  8024a5:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  8024ab:	85 c0                	test   %eax,%eax
+  8024ad:	0f 48 c2             	cmovs  %edx,%eax
+  8024b0:	c1 f8 0c             	sar    $0xc,%eax
+  8024b3:	89 85 48 ff ff ff    	mov    %eax,-0xb8(%ebp)
+	for (i = 0; i < nblock; i++) {
+  8024b9:	89 9d 44 ff ff ff    	mov    %ebx,-0xbc(%ebp)
+  8024bf:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  8024c5:	39 8d 48 ff ff ff    	cmp    %ecx,-0xb8(%ebp)
+  8024cb:	0f 84 6f 01 00 00    	je     802640 <walk_path+0x2b3>
+		if ((r = file_find_block(dir, i, &blk)) < 0)
+  8024d1:	83 ec 04             	sub    $0x4,%esp
+  8024d4:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8024da:	50                   	push   %eax
+  8024db:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+  8024e1:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  8024e7:	e8 d4 fd ff ff       	call   8022c0 <file_find_block>
+  8024ec:	83 c4 10             	add    $0x10,%esp
+  8024ef:	85 c0                	test   %eax,%eax
+  8024f1:	0f 88 06 02 00 00    	js     8026fd <walk_path+0x370>
+		f = (struct File*) blk;
+  8024f7:	8b b5 5c ff ff ff    	mov    -0xa4(%ebp),%esi
+  8024fd:	89 b5 60 ff ff ff    	mov    %esi,-0xa0(%ebp)
+		for (j = 0; j < BLKFILES; j++)
+  802503:	89 f3                	mov    %esi,%ebx
+  802505:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80250b:	39 f3                	cmp    %esi,%ebx
+  80250d:	0f 84 21 01 00 00    	je     802634 <walk_path+0x2a7>
+			if (strcmp(f[j].f_name, name) == 0) {
+  802513:	89 9d 50 ff ff ff    	mov    %ebx,-0xb0(%ebp)
+  802519:	83 ec 08             	sub    $0x8,%esp
+  80251c:	57                   	push   %edi
+  80251d:	53                   	push   %ebx
+  80251e:	e8 6a 35 00 00       	call   805a8d <strcmp>
+  802523:	81 c3 00 01 00 00    	add    $0x100,%ebx
+  802529:	83 c4 10             	add    $0x10,%esp
+  80252c:	85 c0                	test   %eax,%eax
+  80252e:	75 db                	jne    80250b <walk_path+0x17e>
+  802530:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+				*file = &f[j];
+  802536:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  80253c:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+		dcache_enter(dir, name, *file);
+  802542:	83 ec 04             	sub    $0x4,%esp
+  802545:	50                   	push   %eax
+  802546:	57                   	push   %edi
+  802547:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  80254d:	e8 ee 10 00 00       	call   803640 <dcache_enter>
+  802552:	83 c4 10             	add    $0x10,%esp
+  802555:	e9 89 01 00 00       	jmp    8026e3 <walk_path+0x356>
+	assert((dir->f_size % BLKSIZE) == 0);
+  80255a:	68 2c 8d 80 00       	push   $0x808d2c
+  80255f:	68 fd 89 80 00       	push   $0x8089fd
+  802564:	68 02 03 00 00       	push   $0x302
+  802569:	68 77 8c 80 00       	push   $0x808c77
+  80256e:	e8 a0 2d 00 00       	call   805313 <_panic>
+		i = ((uint32_t *) diskaddr(dir->f_hindex))[dir_hash(name)];
+  802573:	83 ec 0c             	sub    $0xc,%esp
+  802576:	51                   	push   %ecx
+  802577:	e8 ec dd ff ff       	call   800368 <diskaddr>
+  80257c:	89 c6                	mov    %eax,%esi
+static inline uint32_t
+dir_hash(const char *name)
+{
+	uint32_t h = 2166136261U;
+
+	while (*name)
+  80257e:	83 c4 10             	add    $0x10,%esp
+	uint32_t h = 2166136261U;
+  802581:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+	while (*name)
+  802586:	8d 8d 68 ff ff ff    	lea    -0x98(%ebp),%ecx
+  80258c:	eb 0e                	jmp    80259c <walk_path+0x20f>
+		h = (h ^ (uint8_t) *name++) * 16777619U;
+  80258e:	83 c1 01             	add    $0x1,%ecx
+  802591:	0f b6 c0             	movzbl %al,%eax
+  802594:	31 d0                	xor    %edx,%eax
+  802596:	69 d0 93 01 00 01    	imul   $0x1000193,%eax,%edx
+	while (*name)
+  80259c:	0f b6 01             	movzbl (%ecx),%eax
+  80259f:	84 c0                	test   %al,%al
+  8025a1:	75 eb                	jne    80258e <walk_path+0x201>
+	return h % DIR_NBUCKETS;
+  8025a3:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8025a9:	8b 04 96             	mov    (%esi,%edx,4),%eax
+			if ((r = dir_entry(dir, i - 1, &f)) < 0)
+  8025ac:	8d b5 60 ff ff ff    	lea    -0xa0(%ebp),%esi
+  8025b2:	89 9d 4c ff ff ff    	mov    %ebx,-0xb4(%ebp)
+		for (; i != 0; i = f->f_hnext) {
+  8025b8:	eb 06                	jmp    8025c0 <walk_path+0x233>
+  8025ba:	8b 83 c0 00 00 00    	mov    0xc0(%ebx),%eax
+  8025c0:	85 c0                	test   %eax,%eax
+  8025c2:	74 46                	je     80260a <walk_path+0x27d>
+			if ((r = dir_entry(dir, i - 1, &f)) < 0)
+  8025c4:	83 ec 04             	sub    $0x4,%esp
+  8025c7:	56                   	push   %esi
+  8025c8:	83 e8 01             	sub    $0x1,%eax
+  8025cb:	50                   	push   %eax
+  8025cc:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  8025d2:	e8 7b fd ff ff       	call   802352 <dir_entry>
+  8025d7:	83 c4 10             	add    $0x10,%esp
+  8025da:	85 c0                	test   %eax,%eax
+  8025dc:	0f 88 ea 00 00 00    	js     8026cc <walk_path+0x33f>
+			if (strcmp(f->f_name, name) == 0) {
+  8025e2:	8b 9d 60 ff ff ff    	mov    -0xa0(%ebp),%ebx
+  8025e8:	83 ec 08             	sub    $0x8,%esp
+  8025eb:	57                   	push   %edi
+  8025ec:	53                   	push   %ebx
+  8025ed:	e8 9b 34 00 00       	call   805a8d <strcmp>
+  8025f2:	83 c4 10             	add    $0x10,%esp
+  8025f5:	85 c0                	test   %eax,%eax
+  8025f7:	75 c1                	jne    8025ba <walk_path+0x22d>
+  8025f9:	89 9d 50 ff ff ff    	mov    %ebx,-0xb0(%ebp)
+  8025ff:	8b 9d 4c ff ff ff    	mov    -0xb4(%ebp),%ebx
+  802605:	e9 2c ff ff ff       	jmp    802536 <walk_path+0x1a9>
+  80260a:	8b 9d 4c ff ff ff    	mov    -0xb4(%ebp),%ebx
+		dcache_enter(dir, name, 0);
+  802610:	83 ec 04             	sub    $0x4,%esp
+  802613:	6a 00                	push   $0x0
+  802615:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80261b:	50                   	push   %eax
+  80261c:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  802622:	e8 19 10 00 00       	call   803640 <dcache_enter>
+  802627:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80262a:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  80262f:	e9 a7 00 00 00       	jmp    8026db <walk_path+0x34e>
+	for (i = 0; i < nblock; i++) {
+  802634:	83 85 4c ff ff ff 01 	addl   $0x1,-0xb4(%ebp)
+  80263b:	e9 7f fe ff ff       	jmp    8024bf <walk_path+0x132>
+  802640:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+  802646:	eb c8                	jmp    802610 <walk_path+0x283>
+			if (r == -E_NOT_FOUND && *path == '\0') {
+  802648:	89 c6                	mov    %eax,%esi
+  80264a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80264d:	75 65                	jne    8026b4 <walk_path+0x327>
+  80264f:	80 3b 00             	cmpb   $0x0,(%ebx)
+  802652:	75 60                	jne    8026b4 <walk_path+0x327>
+				if (pdir)
+  802654:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  80265a:	85 c0                	test   %eax,%eax
+  80265c:	74 08                	je     802666 <walk_path+0x2d9>
+					*pdir = dir;
+  80265e:	8b bd 54 ff ff ff    	mov    -0xac(%ebp),%edi
+  802664:	89 38                	mov    %edi,(%eax)
+				if (lastelem)
+  802666:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80266a:	74 15                	je     802681 <walk_path+0x2f4>
+					strcpy(lastelem, name);
+  80266c:	83 ec 08             	sub    $0x8,%esp
+  80266f:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802675:	50                   	push   %eax
+  802676:	ff 75 08             	push   0x8(%ebp)
+  802679:	e8 5e 33 00 00       	call   8059dc <strcpy>
+  80267e:	83 c4 10             	add    $0x10,%esp
+				*pf = 0;
+  802681:	8b 85 3c ff ff ff    	mov    -0xc4(%ebp),%eax
+  802687:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  80268d:	eb 25                	jmp    8026b4 <walk_path+0x327>
+	if (pdir)
+  80268f:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  802695:	85 c0                	test   %eax,%eax
+  802697:	74 08                	je     8026a1 <walk_path+0x314>
+		*pdir = dir;
+  802699:	8b bd 54 ff ff ff    	mov    -0xac(%ebp),%edi
+  80269f:	89 38                	mov    %edi,(%eax)
+	*pf = f;
+  8026a1:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+  8026a7:	8b bd 3c ff ff ff    	mov    -0xc4(%ebp),%edi
+  8026ad:	89 07                	mov    %eax,(%edi)
+	return 0;
+  8026af:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8026b4:	89 f0                	mov    %esi,%eax
+  8026b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026b9:	5b                   	pop    %ebx
+  8026ba:	5e                   	pop    %esi
+  8026bb:	5f                   	pop    %edi
+  8026bc:	5d                   	pop    %ebp
+  8026bd:	c3                   	ret
+			return -E_BAD_PATH;
+  8026be:	be f4 ff ff ff       	mov    $0xfffffff4,%esi
+  8026c3:	eb ef                	jmp    8026b4 <walk_path+0x327>
+			return -E_NOT_FOUND;
+  8026c5:	be f5 ff ff ff       	mov    $0xfffffff5,%esi
+  8026ca:	eb e8                	jmp    8026b4 <walk_path+0x327>
+  8026cc:	8b 9d 4c ff ff ff    	mov    -0xb4(%ebp),%ebx
+	else if (r == -E_NOT_FOUND)
+  8026d2:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8026d5:	0f 84 35 ff ff ff    	je     802610 <walk_path+0x283>
+		if ((r = dir_lookup_cached(dir, name, &f)) < 0) {
+  8026db:	85 c0                	test   %eax,%eax
+  8026dd:	0f 88 65 ff ff ff    	js     802648 <walk_path+0x2bb>
+	dir = 0;
+  8026e3:	89 d8                	mov    %ebx,%eax
+	while (*path != '\0') {
+  8026e5:	80 38 00             	cmpb   $0x0,(%eax)
+  8026e8:	74 a5                	je     80268f <walk_path+0x302>
+		dir = f;
+  8026ea:	8b 8d 64 ff ff ff    	mov    -0x9c(%ebp),%ecx
+  8026f0:	89 8d 54 ff ff ff    	mov    %ecx,-0xac(%ebp)
+		while (*path != '/' && *path != '\0')
+  8026f6:	89 c3                	mov    %eax,%ebx
+  8026f8:	e9 fc fc ff ff       	jmp    8023f9 <walk_path+0x6c>
+  8026fd:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+  802703:	eb cd                	jmp    8026d2 <walk_path+0x345>
+
+00802705 <file_open>:
+{
+  802705:	55                   	push   %ebp
+  802706:	89 e5                	mov    %esp,%ebp
+  802708:	83 ec 14             	sub    $0x14,%esp
+	return walk_path(path, 0, pf, 0);
+  80270b:	6a 00                	push   $0x0
+  80270d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802710:	ba 00 00 00 00       	mov    $0x0,%edx
+  802715:	8b 45 08             	mov    0x8(%ebp),%eax
+  802718:	e8 70 fc ff ff       	call   80238d <walk_path>
+}
+  80271d:	c9                   	leave
+  80271e:	c3                   	ret
+
+0080271f <file_read>:
+{
+  80271f:	55                   	push   %ebp
+  802720:	89 e5                	mov    %esp,%ebp
+  802722:	57                   	push   %edi
+  802723:	56                   	push   %esi
+  802724:	53                   	push   %ebx
+  802725:	83 ec 2c             	sub    $0x2c,%esp
+  802728:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80272b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+	if (offset >= f->f_size)
+  80272e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802731:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+		return 0;
+  802737:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (offset >= f->f_size)
+  80273c:	39 ca                	cmp    %ecx,%edx
+  80273e:	0f 8e 9b 00 00 00    	jle    8027df <file_read+0xc0>
+	count = MIN(count, f->f_size - offset);
+  802744:	29 ca                	sub    %ecx,%edx
+  802746:	39 da                	cmp    %ebx,%edx
+  802748:	0f 46 da             	cmovbe %edx,%ebx
+  80274b:	89 de                	mov    %ebx,%esi
+	for (pos = offset; pos < offset + count; ) {
+  80274d:	89 cb                	mov    %ecx,%ebx
+  80274f:	8d 04 31             	lea    (%ecx,%esi,1),%eax
+  802752:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802755:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  802758:	eb 16                	jmp    802770 <file_read+0x51>
+			memset(buf, 0, bn);
+  80275a:	83 ec 04             	sub    $0x4,%esp
+  80275d:	57                   	push   %edi
+  80275e:	6a 00                	push   $0x0
+  802760:	ff 75 0c             	push   0xc(%ebp)
+  802763:	e8 c5 33 00 00       	call   805b2d <memset>
+  802768:	83 c4 10             	add    $0x10,%esp
+		pos += bn;
+  80276b:	01 fb                	add    %edi,%ebx
+		buf += bn;
+  80276d:	01 7d 0c             	add    %edi,0xc(%ebp)
+	for (pos = offset; pos < offset + count; ) {
+  802770:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802773:	39 c3                	cmp    %eax,%ebx
+  802775:	73 63                	jae    8027da <file_read+0xbb>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  802777:	89 d8                	mov    %ebx,%eax
+  802779:	c1 f8 1f             	sar    $0x1f,%eax
+  80277c:	c1 e8 14             	shr    $0x14,%eax
+  80277f:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+  802782:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802788:	29 c6                	sub    %eax,%esi
+  80278a:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80278f:	29 f7                	sub    %esi,%edi
+  802791:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802794:	29 d8                	sub    %ebx,%eax
+  802796:	39 c7                	cmp    %eax,%edi
+  802798:	0f 47 f8             	cmova  %eax,%edi
+		if ((r = file_find_block(f, pos / BLKSIZE, &blk)) == -E_NOT_FOUND)
+  80279b:	83 ec 04             	sub    $0x4,%esp
+  80279e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8027a1:	50                   	push   %eax
+  8027a2:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  8027a8:	85 db                	test   %ebx,%ebx
+  8027aa:	0f 49 c3             	cmovns %ebx,%eax
+  8027ad:	c1 f8 0c             	sar    $0xc,%eax
+  8027b0:	50                   	push   %eax
+  8027b1:	ff 75 08             	push   0x8(%ebp)
+  8027b4:	e8 07 fb ff ff       	call   8022c0 <file_find_block>
+  8027b9:	83 c4 10             	add    $0x10,%esp
+  8027bc:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8027bf:	74 99                	je     80275a <file_read+0x3b>
+		else if (r < 0)
+  8027c1:	85 c0                	test   %eax,%eax
+  8027c3:	78 1a                	js     8027df <file_read+0xc0>
+			memmove(buf, blk + pos % BLKSIZE, bn);
+  8027c5:	83 ec 04             	sub    $0x4,%esp
+  8027c8:	57                   	push   %edi
+  8027c9:	03 75 e4             	add    -0x1c(%ebp),%esi
+  8027cc:	56                   	push   %esi
+  8027cd:	ff 75 0c             	push   0xc(%ebp)
+  8027d0:	e8 8d 33 00 00       	call   805b62 <memmove>
+  8027d5:	83 c4 10             	add    $0x10,%esp
+  8027d8:	eb 91                	jmp    80276b <file_read+0x4c>
+	return count;
+  8027da:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8027dd:	89 f0                	mov    %esi,%eax
+}
+  8027df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027e2:	5b                   	pop    %ebx
+  8027e3:	5e                   	pop    %esi
+  8027e4:	5f                   	pop    %edi
+  8027e5:	5d                   	pop    %ebp
+  8027e6:	c3                   	ret
+
+008027e7 <file_set_size>:
+{
+  8027e7:	55                   	push   %ebp
+  8027e8:	89 e5                	mov    %esp,%ebp
+  8027ea:	56                   	push   %esi
+  8027eb:	53                   	push   %ebx
+  8027ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (newsize < 0 || newsize > MAXFILESIZE)
+  8027f2:	81 fb 00 f0 ff 7f    	cmp    $0x7ffff000,%ebx
+  8027f8:	77 31                	ja     80282b <file_set_size+0x44>
+	if (f->f_size > newsize)
+  8027fa:	39 9e 80 00 00 00    	cmp    %ebx,0x80(%esi)
+  802800:	7f 1e                	jg     802820 <file_set_size+0x39>
+	f->f_size = newsize;
+  802802:	89 9e 80 00 00 00    	mov    %ebx,0x80(%esi)
+	flush_block(f);
+  802808:	83 ec 0c             	sub    $0xc,%esp
+  80280b:	56                   	push   %esi
+  80280c:	e8 b7 de ff ff       	call   8006c8 <flush_block>
+	return 0;
+  802811:	83 c4 10             	add    $0x10,%esp
+  802814:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802819:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80281c:	5b                   	pop    %ebx
+  80281d:	5e                   	pop    %esi
+  80281e:	5d                   	pop    %ebp
+  80281f:	c3                   	ret
+		file_truncate_blocks(f, newsize);
+  802820:	89 da                	mov    %ebx,%edx
+  802822:	89 f0                	mov    %esi,%eax
+  802824:	e8 90 f2 ff ff       	call   801ab9 <file_truncate_blocks>
+  802829:	eb d7                	jmp    802802 <file_set_size+0x1b>
+		return -E_INVAL;
+  80282b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802830:	eb e7                	jmp    802819 <file_set_size+0x32>
+
+00802832 <file_write>:
+{
+  802832:	55                   	push   %ebp
+  802833:	89 e5                	mov    %esp,%ebp
+  802835:	57                   	push   %edi
+  802836:	56                   	push   %esi
+  802837:	53                   	push   %ebx
+  802838:	83 ec 2c             	sub    $0x2c,%esp
+  80283b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	if (offset + count > f->f_size)
+  80283e:	89 df                	mov    %ebx,%edi
+  802840:	03 7d 10             	add    0x10(%ebp),%edi
+  802843:	8b 45 08             	mov    0x8(%ebp),%eax
+  802846:	39 b8 80 00 00 00    	cmp    %edi,0x80(%eax)
+  80284c:	72 70                	jb     8028be <file_write+0x8c>
+  80284e:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  802851:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (pos = offset; pos < offset + count; ) {
+  802854:	89 de                	mov    %ebx,%esi
+  802856:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802859:	39 c3                	cmp    %eax,%ebx
+  80285b:	73 78                	jae    8028d5 <file_write+0xa3>
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  80285d:	83 ec 04             	sub    $0x4,%esp
+  802860:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802863:	50                   	push   %eax
+  802864:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  80286a:	85 db                	test   %ebx,%ebx
+  80286c:	0f 49 c3             	cmovns %ebx,%eax
+  80286f:	c1 f8 0c             	sar    $0xc,%eax
+  802872:	50                   	push   %eax
+  802873:	ff 75 08             	push   0x8(%ebp)
+  802876:	e8 aa f8 ff ff       	call   802125 <file_get_block>
+  80287b:	83 c4 10             	add    $0x10,%esp
+  80287e:	85 c0                	test   %eax,%eax
+  802880:	78 56                	js     8028d8 <file_write+0xa6>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  802882:	89 da                	mov    %ebx,%edx
+  802884:	c1 fa 1f             	sar    $0x1f,%edx
+  802887:	c1 ea 14             	shr    $0x14,%edx
+  80288a:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  80288d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802892:	29 d0                	sub    %edx,%eax
+  802894:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802899:	29 c1                	sub    %eax,%ecx
+  80289b:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  80289e:	29 f2                	sub    %esi,%edx
+  8028a0:	39 d1                	cmp    %edx,%ecx
+  8028a2:	89 d6                	mov    %edx,%esi
+  8028a4:	0f 46 f1             	cmovbe %ecx,%esi
+		memmove(blk + pos % BLKSIZE, buf, bn);
+  8028a7:	83 ec 04             	sub    $0x4,%esp
+  8028aa:	56                   	push   %esi
+  8028ab:	57                   	push   %edi
+  8028ac:	03 45 e4             	add    -0x1c(%ebp),%eax
+  8028af:	50                   	push   %eax
+  8028b0:	e8 ad 32 00 00       	call   805b62 <memmove>
+		pos += bn;
+  8028b5:	01 f3                	add    %esi,%ebx
+		buf += bn;
+  8028b7:	01 f7                	add    %esi,%edi
+  8028b9:	83 c4 10             	add    $0x10,%esp
+  8028bc:	eb 96                	jmp    802854 <file_write+0x22>
+		if ((r = file_set_size(f, offset + count)) < 0)
+  8028be:	83 ec 08             	sub    $0x8,%esp
+  8028c1:	57                   	push   %edi
+  8028c2:	50                   	push   %eax
+  8028c3:	e8 1f ff ff ff       	call   8027e7 <file_set_size>
+  8028c8:	83 c4 10             	add    $0x10,%esp
+  8028cb:	85 c0                	test   %eax,%eax
+  8028cd:	0f 89 7b ff ff ff    	jns    80284e <file_write+0x1c>
+  8028d3:	eb 03                	jmp    8028d8 <file_write+0xa6>
+	return count;
+  8028d5:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+  8028d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028db:	5b                   	pop    %ebx
+  8028dc:	5e                   	pop    %esi
+  8028dd:	5f                   	pop    %edi
+  8028de:	5d                   	pop    %ebp
+  8028df:	c3                   	ret
+
+008028e0 <file_flush>:
+// Translate the file block number into a disk block number and collect
+// it; bc_flush_list writes out the dirty ones in disk order, a batch
+// at a time.
+void
+file_flush(struct File *f)
+{
+  8028e0:	55                   	push   %ebp
+  8028e1:	89 e5                	mov    %esp,%ebp
+  8028e3:	57                   	push   %edi
+  8028e4:	56                   	push   %esi
+  8028e5:	53                   	push   %ebx
+  8028e6:	83 ec 2c             	sub    $0x2c,%esp
+  8028e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	static uint32_t blocks[FLUSH_BATCH];
+	int r, n;
+	uint32_t i, nblocks, *pdiskbno;
+
+	if (f->f_type == FTYPE_REG && (r = file_commit(f)) < 0)
+  8028ec:	83 bf 84 00 00 00 00 	cmpl   $0x0,0x84(%edi)
+  8028f3:	74 25                	je     80291a <file_flush+0x3a>
+		cprintf("warning: file_commit: %e\n", r);
+
+	n = 0;
+	nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  8028f5:	8b 87 80 00 00 00    	mov    0x80(%edi),%eax
+  8028fb:	8d b0 fe 1f 00 00    	lea    0x1ffe(%eax),%esi
+  802901:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802906:	0f 49 f0             	cmovns %eax,%esi
+  802909:	c1 fe 0c             	sar    $0xc,%esi
+	for (i = 0; i < nblocks; i++) {
+  80290c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	n = 0;
+  802911:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+	for (i = 0; i < nblocks; i++) {
+  802918:	eb 43                	jmp    80295d <file_flush+0x7d>
+	if (f->f_type == FTYPE_REG && (r = file_commit(f)) < 0)
+  80291a:	83 ec 0c             	sub    $0xc,%esp
+  80291d:	57                   	push   %edi
+  80291e:	e8 71 f5 ff ff       	call   801e94 <file_commit>
+  802923:	83 c4 10             	add    $0x10,%esp
+  802926:	85 c0                	test   %eax,%eax
+  802928:	79 cb                	jns    8028f5 <file_flush+0x15>
+		cprintf("warning: file_commit: %e\n", r);
+  80292a:	83 ec 08             	sub    $0x8,%esp
+  80292d:	50                   	push   %eax
+  80292e:	68 49 8d 80 00       	push   $0x808d49
+  802933:	e8 b6 2a 00 00       	call   8053ee <cprintf>
+  802938:	83 c4 10             	add    $0x10,%esp
+  80293b:	eb b8                	jmp    8028f5 <file_flush+0x15>
+		return NDIRECT + NINDIRECT;
+  80293d:	b8 0a 04 00 00       	mov    $0x40a,%eax
+	if (filebno < NDIRECT + NINDIRECT)
+  802942:	81 fb 09 04 00 00    	cmp    $0x409,%ebx
+  802948:	76 0d                	jbe    802957 <file_flush+0x77>
+	return ROUNDUP(filebno - NDIRECT - NINDIRECT + 1, NINDIRECT)
+  80294a:	8d 43 f6             	lea    -0xa(%ebx),%eax
+		+ NDIRECT + NINDIRECT;
+  80294d:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  802952:	05 0a 04 00 00       	add    $0x40a,%eax
+		if ((r = file_block_walk(f, i, &pdiskbno, 0)) == -E_NOT_FOUND) {
+			i = next_leaf(i) - 1;
+  802957:	8d 58 ff             	lea    -0x1(%eax),%ebx
+	for (i = 0; i < nblocks; i++) {
+  80295a:	83 c3 01             	add    $0x1,%ebx
+  80295d:	39 f3                	cmp    %esi,%ebx
+  80295f:	73 60                	jae    8029c1 <file_flush+0xe1>
+		if ((r = file_block_walk(f, i, &pdiskbno, 0)) == -E_NOT_FOUND) {
+  802961:	83 ec 0c             	sub    $0xc,%esp
+  802964:	6a 00                	push   $0x0
+  802966:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  802969:	89 da                	mov    %ebx,%edx
+  80296b:	89 f8                	mov    %edi,%eax
+  80296d:	e8 72 ef ff ff       	call   8018e4 <file_block_walk>
+  802972:	83 c4 10             	add    $0x10,%esp
+  802975:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802978:	74 c3                	je     80293d <file_flush+0x5d>
+			continue;
+		}
+		if (r < 0 || pdiskbno == NULL || *pdiskbno == 0)
+  80297a:	85 c0                	test   %eax,%eax
+  80297c:	78 dc                	js     80295a <file_flush+0x7a>
+  80297e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802981:	85 c0                	test   %eax,%eax
+  802983:	74 d5                	je     80295a <file_flush+0x7a>
+  802985:	8b 00                	mov    (%eax),%eax
+  802987:	85 c0                	test   %eax,%eax
+  802989:	74 cf                	je     80295a <file_flush+0x7a>
+			continue;
+		blocks[n++] = *pdiskbno;
+  80298b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  80298e:	8d 51 01             	lea    0x1(%ecx),%edx
+  802991:	89 04 8d e0 51 86 00 	mov    %eax,0x8651e0(,%ecx,4)
+  802998:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+		if (n == FLUSH_BATCH) {
+  80299b:	81 fa 03 04 00 00    	cmp    $0x403,%edx
+  8029a1:	75 b7                	jne    80295a <file_flush+0x7a>
+			bc_flush_list(blocks, n);
+  8029a3:	83 ec 08             	sub    $0x8,%esp
+  8029a6:	68 03 04 00 00       	push   $0x403
+  8029ab:	68 e0 51 86 00       	push   $0x8651e0
+  8029b0:	e8 de dd ff ff       	call   800793 <bc_flush_list>
+  8029b5:	83 c4 10             	add    $0x10,%esp
+			n = 0;
+  8029b8:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  8029bf:	eb 99                	jmp    80295a <file_flush+0x7a>
+		}
+	}
+	bc_flush_list(blocks, n);
+  8029c1:	83 ec 08             	sub    $0x8,%esp
+  8029c4:	ff 75 d4             	push   -0x2c(%ebp)
+  8029c7:	68 e0 51 86 00       	push   $0x8651e0
+  8029cc:	e8 c2 dd ff ff       	call   800793 <bc_flush_list>
+
+	// Then the indirect blocks, which the loop above may have dirtied.
+	file_flush_meta(f);
+  8029d1:	89 f8                	mov    %edi,%eax
+  8029d3:	e8 27 e9 ff ff       	call   8012ff <file_flush_meta>
+}
+  8029d8:	83 c4 10             	add    $0x10,%esp
+  8029db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029de:	5b                   	pop    %ebx
+  8029df:	5e                   	pop    %esi
+  8029e0:	5f                   	pop    %edi
+  8029e1:	5d                   	pop    %ebp
+  8029e2:	c3                   	ret
+
+008029e3 <file_create>:
+{
+  8029e3:	55                   	push   %ebp
+  8029e4:	89 e5                	mov    %esp,%ebp
+  8029e6:	57                   	push   %edi
+  8029e7:	56                   	push   %esi
+  8029e8:	53                   	push   %ebx
+  8029e9:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+	if ((r = walk_path(path, &dir, &f, name)) == 0)
+  8029ef:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8029f5:	50                   	push   %eax
+  8029f6:	8d 8d 60 ff ff ff    	lea    -0xa0(%ebp),%ecx
+  8029fc:	8d 95 64 ff ff ff    	lea    -0x9c(%ebp),%edx
+  802a02:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a05:	e8 83 f9 ff ff       	call   80238d <walk_path>
+  802a0a:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  802a10:	83 c4 10             	add    $0x10,%esp
+  802a13:	85 c0                	test   %eax,%eax
+  802a15:	0f 84 f2 03 00 00    	je     802e0d <file_create+0x42a>
+	if (r != -E_NOT_FOUND || dir == 0)
+  802a1b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802a1e:	0f 85 9a 02 00 00    	jne    802cbe <file_create+0x2db>
+  802a24:	8b 9d 64 ff ff ff    	mov    -0x9c(%ebp),%ebx
+  802a2a:	85 db                	test   %ebx,%ebx
+  802a2c:	0f 84 8c 02 00 00    	je     802cbe <file_create+0x2db>
+	assert((dir->f_size % BLKSIZE) == 0);
+  802a32:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802a38:	89 c7                	mov    %eax,%edi
+  802a3a:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802a40:	89 bd 54 ff ff ff    	mov    %edi,-0xac(%ebp)
+  802a46:	75 5c                	jne    802aa4 <file_create+0xc1>
+	if (dir->f_hindex == 0 && dir->f_size > BLKSIZE
+  802a48:	83 bb b8 00 00 00 00 	cmpl   $0x0,0xb8(%ebx)
+  802a4f:	75 07                	jne    802a58 <file_create+0x75>
+  802a51:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802a56:	7f 65                	jg     802abd <file_create+0xda>
+	if (!dir->f_hindex) {
+  802a58:	83 bb b8 00 00 00 00 	cmpl   $0x0,0xb8(%ebx)
+  802a5f:	0f 84 55 01 00 00    	je     802bba <file_create+0x1d7>
+	if (dir->f_hfree == 0) {
+  802a65:	8b b3 bc 00 00 00    	mov    0xbc(%ebx),%esi
+  802a6b:	85 f6                	test   %esi,%esi
+  802a6d:	0f 85 f3 02 00 00    	jne    802d66 <file_create+0x383>
+		if ((r = dir_grow(dir, &f)) < 0)
+  802a73:	8d 95 5c ff ff ff    	lea    -0xa4(%ebp),%edx
+  802a79:	89 d8                	mov    %ebx,%eax
+  802a7b:	e8 d0 f7 ff ff       	call   802250 <dir_grow>
+  802a80:	85 c0                	test   %eax,%eax
+  802a82:	0f 88 94 03 00 00    	js     802e1c <file_create+0x439>
+		i = dir->f_size / sizeof(struct File) - BLKFILES;
+  802a88:	8b b3 80 00 00 00    	mov    0x80(%ebx),%esi
+  802a8e:	c1 ee 08             	shr    $0x8,%esi
+		for (j = BLKFILES - 1; j > 0; j--) {
+  802a91:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  802a97:	05 c0 0f 00 00       	add    $0xfc0,%eax
+  802a9c:	8d 4e f1             	lea    -0xf(%esi),%ecx
+  802a9f:	e9 63 02 00 00       	jmp    802d07 <file_create+0x324>
+	assert((dir->f_size % BLKSIZE) == 0);
+  802aa4:	68 2c 8d 80 00       	push   $0x808d2c
+  802aa9:	68 fd 89 80 00       	push   $0x8089fd
+  802aae:	68 3a 03 00 00       	push   $0x33a
+  802ab3:	68 77 8c 80 00       	push   $0x808c77
+  802ab8:	e8 56 28 00 00       	call   805313 <_panic>
+	if ((r = alloc_block(&blockno)) < 0)
+  802abd:	83 ec 0c             	sub    $0xc,%esp
+  802ac0:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  802ac6:	50                   	push   %eax
+  802ac7:	e8 e9 f1 ff ff       	call   801cb5 <alloc_block>
+  802acc:	83 c4 10             	add    $0x10,%esp
+  802acf:	85 c0                	test   %eax,%eax
+  802ad1:	0f 88 d9 00 00 00    	js     802bb0 <file_create+0x1cd>
+	dir->f_hindex = blockno;
+  802ad7:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+  802add:	89 83 b8 00 00 00    	mov    %eax,0xb8(%ebx)
+	bc_pin(dir->f_hindex);
+  802ae3:	83 ec 0c             	sub    $0xc,%esp
+  802ae6:	50                   	push   %eax
+  802ae7:	e8 6e db ff ff       	call   80065a <bc_pin>
+	buckets = diskaddr(dir->f_hindex);
+  802aec:	83 c4 04             	add    $0x4,%esp
+  802aef:	ff b3 b8 00 00 00    	push   0xb8(%ebx)
+  802af5:	e8 6e d8 ff ff       	call   800368 <diskaddr>
+  802afa:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+	memset(buckets, 0, BLKSIZE);
+  802b00:	83 c4 0c             	add    $0xc,%esp
+  802b03:	68 00 10 00 00       	push   $0x1000
+  802b08:	6a 00                	push   $0x0
+  802b0a:	50                   	push   %eax
+  802b0b:	e8 1d 30 00 00       	call   805b2d <memset>
+	dir->f_hfree = 0;
+  802b10:	c7 83 bc 00 00 00 00 	movl   $0x0,0xbc(%ebx)
+  802b17:	00 00 00 
+	for (i = dir->f_size / sizeof(struct File); i-- > 0; ) {
+  802b1a:	8b b3 80 00 00 00    	mov    0x80(%ebx),%esi
+  802b20:	c1 ee 08             	shr    $0x8,%esi
+  802b23:	83 c4 10             	add    $0x10,%esp
+  802b26:	eb 34                	jmp    802b5c <file_create+0x179>
+		h = (h ^ (uint8_t) *name++) * 16777619U;
+  802b28:	83 c1 01             	add    $0x1,%ecx
+  802b2b:	0f b6 c0             	movzbl %al,%eax
+  802b2e:	31 d0                	xor    %edx,%eax
+  802b30:	69 d0 93 01 00 01    	imul   $0x1000193,%eax,%edx
+	while (*name)
+  802b36:	0f b6 01             	movzbl (%ecx),%eax
+  802b39:	84 c0                	test   %al,%al
+  802b3b:	75 eb                	jne    802b28 <file_create+0x145>
+	return h % DIR_NBUCKETS;
+  802b3d:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+			f->f_hnext = buckets[b];
+  802b43:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+  802b49:	8d 04 90             	lea    (%eax,%edx,4),%eax
+  802b4c:	8b 10                	mov    (%eax),%edx
+  802b4e:	89 97 c0 00 00 00    	mov    %edx,0xc0(%edi)
+			buckets[b] = i + 1;
+  802b54:	89 30                	mov    %esi,(%eax)
+	uint32_t h = 2166136261U;
+  802b56:	8b b5 50 ff ff ff    	mov    -0xb0(%ebp),%esi
+	for (i = dir->f_size / sizeof(struct File); i-- > 0; ) {
+  802b5c:	8d 46 ff             	lea    -0x1(%esi),%eax
+  802b5f:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+  802b65:	85 f6                	test   %esi,%esi
+  802b67:	0f 84 eb fe ff ff    	je     802a58 <file_create+0x75>
+		if ((r = dir_entry(dir, i, &f)) < 0)
+  802b6d:	83 ec 04             	sub    $0x4,%esp
+  802b70:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802b76:	50                   	push   %eax
+  802b77:	ff b5 50 ff ff ff    	push   -0xb0(%ebp)
+  802b7d:	53                   	push   %ebx
+  802b7e:	e8 cf f7 ff ff       	call   802352 <dir_entry>
+  802b83:	83 c4 10             	add    $0x10,%esp
+  802b86:	85 c0                	test   %eax,%eax
+  802b88:	78 26                	js     802bb0 <file_create+0x1cd>
+		if (f->f_name[0]) {
+  802b8a:	8b bd 5c ff ff ff    	mov    -0xa4(%ebp),%edi
+			b = dir_hash(f->f_name);
+  802b90:	89 f9                	mov    %edi,%ecx
+  802b92:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+		if (f->f_name[0]) {
+  802b97:	80 3f 00             	cmpb   $0x0,(%edi)
+  802b9a:	75 9a                	jne    802b36 <file_create+0x153>
+			f->f_hnext = dir->f_hfree;
+  802b9c:	8b 83 bc 00 00 00    	mov    0xbc(%ebx),%eax
+  802ba2:	89 87 c0 00 00 00    	mov    %eax,0xc0(%edi)
+			dir->f_hfree = i + 1;
+  802ba8:	89 b3 bc 00 00 00    	mov    %esi,0xbc(%ebx)
+  802bae:	eb a6                	jmp    802b56 <file_create+0x173>
+	    && dir_index_build(dir) < 0 && dir->f_hindex) {
+  802bb0:	8b 83 b8 00 00 00    	mov    0xb8(%ebx),%eax
+  802bb6:	85 c0                	test   %eax,%eax
+  802bb8:	75 72                	jne    802c2c <file_create+0x249>
+		nblock = dir->f_size / BLKSIZE;
+  802bba:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+  802bc0:	8d 82 ff 0f 00 00    	lea    0xfff(%edx),%eax
+  802bc6:	85 d2                	test   %edx,%edx
+  802bc8:	0f 49 c2             	cmovns %edx,%eax
+  802bcb:	c1 f8 0c             	sar    $0xc,%eax
+  802bce:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+		for (i = 0; i < nblock; i++) {
+  802bd4:	be 00 00 00 00       	mov    $0x0,%esi
+			if ((r = file_get_block(dir, i, &blk)) < 0)
+  802bd9:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+		for (i = 0; i < nblock; i++) {
+  802bdf:	39 b5 50 ff ff ff    	cmp    %esi,-0xb0(%ebp)
+  802be5:	0f 84 e9 00 00 00    	je     802cd4 <file_create+0x2f1>
+			if ((r = file_get_block(dir, i, &blk)) < 0)
+  802beb:	83 ec 04             	sub    $0x4,%esp
+  802bee:	57                   	push   %edi
+  802bef:	56                   	push   %esi
+  802bf0:	53                   	push   %ebx
+  802bf1:	e8 2f f5 ff ff       	call   802125 <file_get_block>
+  802bf6:	83 c4 10             	add    $0x10,%esp
+  802bf9:	85 c0                	test   %eax,%eax
+  802bfb:	0f 88 01 02 00 00    	js     802e02 <file_create+0x41f>
+			f = (struct File*) blk;
+  802c01:	8b 8d 58 ff ff ff    	mov    -0xa8(%ebp),%ecx
+  802c07:	89 8d 5c ff ff ff    	mov    %ecx,-0xa4(%ebp)
+			for (j = 0; j < BLKFILES; j++)
+  802c0d:	89 c8                	mov    %ecx,%eax
+  802c0f:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802c15:	39 c8                	cmp    %ecx,%eax
+  802c17:	0f 84 af 00 00 00    	je     802ccc <file_create+0x2e9>
+				if (f[j].f_name[0] == '\0') {
+  802c1d:	8d 90 00 01 00 00    	lea    0x100(%eax),%edx
+  802c23:	80 38 00             	cmpb   $0x0,(%eax)
+  802c26:	74 1f                	je     802c47 <file_create+0x264>
+  802c28:	89 d0                	mov    %edx,%eax
+  802c2a:	eb e9                	jmp    802c15 <file_create+0x232>
+		free_block(dir->f_hindex);
+  802c2c:	83 ec 0c             	sub    $0xc,%esp
+  802c2f:	50                   	push   %eax
+  802c30:	e8 24 ea ff ff       	call   801659 <free_block>
+		dir->f_hindex = 0;
+  802c35:	c7 83 b8 00 00 00 00 	movl   $0x0,0xb8(%ebx)
+  802c3c:	00 00 00 
+  802c3f:	83 c4 10             	add    $0x10,%esp
+  802c42:	e9 73 ff ff ff       	jmp    802bba <file_create+0x1d7>
+					f = &f[j];
+  802c47:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+	da_discard(f, 0);
+  802c4d:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  802c53:	89 c7                	mov    %eax,%edi
+  802c55:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+  802c5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c60:	e8 e0 e7 ff ff       	call   801445 <da_discard>
+	memset(f, 0, sizeof(struct File));
+  802c65:	83 ec 04             	sub    $0x4,%esp
+  802c68:	68 00 01 00 00       	push   $0x100
+  802c6d:	6a 00                	push   $0x0
+  802c6f:	57                   	push   %edi
+  802c70:	e8 b8 2e 00 00       	call   805b2d <memset>
+	strcpy(f->f_name, name);
+  802c75:	83 c4 08             	add    $0x8,%esp
+  802c78:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802c7e:	50                   	push   %eax
+  802c7f:	57                   	push   %edi
+  802c80:	e8 57 2d 00 00       	call   8059dc <strcpy>
+	return 0;
+  802c85:	83 c4 10             	add    $0x10,%esp
+	*file = f;
+  802c88:	8b bd 50 ff ff ff    	mov    -0xb0(%ebp),%edi
+  802c8e:	89 bd 60 ff ff ff    	mov    %edi,-0xa0(%ebp)
+	f->f_type = type;
+  802c94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c97:	89 87 84 00 00 00    	mov    %eax,0x84(%edi)
+	dcache_enter(dir, name, f);
+  802c9d:	83 ec 04             	sub    $0x4,%esp
+  802ca0:	57                   	push   %edi
+  802ca1:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802ca7:	50                   	push   %eax
+  802ca8:	53                   	push   %ebx
+  802ca9:	e8 92 09 00 00       	call   803640 <dcache_enter>
+	*pf = f;
+  802cae:	8b 45 10             	mov    0x10(%ebp),%eax
+  802cb1:	89 38                	mov    %edi,(%eax)
+	file_flush(dir);
+  802cb3:	89 1c 24             	mov    %ebx,(%esp)
+  802cb6:	e8 25 fc ff ff       	call   8028e0 <file_flush>
+	return 0;
+  802cbb:	83 c4 10             	add    $0x10,%esp
+}
+  802cbe:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  802cc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cc7:	5b                   	pop    %ebx
+  802cc8:	5e                   	pop    %esi
+  802cc9:	5f                   	pop    %edi
+  802cca:	5d                   	pop    %ebp
+  802ccb:	c3                   	ret
+		for (i = 0; i < nblock; i++) {
+  802ccc:	83 c6 01             	add    $0x1,%esi
+  802ccf:	e9 0b ff ff ff       	jmp    802bdf <file_create+0x1fc>
+		if ((r = dir_grow(dir, &f)) < 0)
+  802cd4:	8d 95 5c ff ff ff    	lea    -0xa4(%ebp),%edx
+  802cda:	89 d8                	mov    %ebx,%eax
+  802cdc:	e8 6f f5 ff ff       	call   802250 <dir_grow>
+  802ce1:	85 c0                	test   %eax,%eax
+  802ce3:	0f 89 64 ff ff ff    	jns    802c4d <file_create+0x26a>
+			return r;
+  802ce9:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  802cef:	eb cd                	jmp    802cbe <file_create+0x2db>
+			f[j].f_hnext = dir->f_hfree;
+  802cf1:	8b 93 bc 00 00 00    	mov    0xbc(%ebx),%edx
+  802cf7:	89 10                	mov    %edx,(%eax)
+			dir->f_hfree = i + j + 1;
+  802cf9:	89 b3 bc 00 00 00    	mov    %esi,0xbc(%ebx)
+		for (j = BLKFILES - 1; j > 0; j--) {
+  802cff:	2d 00 01 00 00       	sub    $0x100,%eax
+  802d04:	83 ee 01             	sub    $0x1,%esi
+  802d07:	39 ce                	cmp    %ecx,%esi
+  802d09:	75 e6                	jne    802cf1 <file_create+0x30e>
+	da_discard(f, 0);
+  802d0b:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  802d11:	89 c7                	mov    %eax,%edi
+  802d13:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d18:	e8 28 e7 ff ff       	call   801445 <da_discard>
+	memset(f, 0, sizeof(struct File));
+  802d1d:	83 ec 04             	sub    $0x4,%esp
+  802d20:	68 00 01 00 00       	push   $0x100
+  802d25:	6a 00                	push   $0x0
+  802d27:	89 bd 50 ff ff ff    	mov    %edi,-0xb0(%ebp)
+  802d2d:	57                   	push   %edi
+  802d2e:	e8 fa 2d 00 00       	call   805b2d <memset>
+	strcpy(f->f_name, name);
+  802d33:	83 c4 08             	add    $0x8,%esp
+  802d36:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  802d3c:	57                   	push   %edi
+  802d3d:	ff b5 50 ff ff ff    	push   -0xb0(%ebp)
+  802d43:	e8 94 2c 00 00       	call   8059dc <strcpy>
+	buckets = diskaddr(dir->f_hindex);
+  802d48:	83 c4 04             	add    $0x4,%esp
+  802d4b:	ff b3 b8 00 00 00    	push   0xb8(%ebx)
+  802d51:	e8 12 d6 ff ff       	call   800368 <diskaddr>
+  802d56:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+	while (*name)
+  802d5c:	83 c4 10             	add    $0x10,%esp
+	uint32_t h = 2166136261U;
+  802d5f:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+	while (*name)
+  802d64:	eb 44                	jmp    802daa <file_create+0x3c7>
+		if ((r = dir_entry(dir, i - 1, &f)) < 0)
+  802d66:	83 ec 04             	sub    $0x4,%esp
+  802d69:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  802d6f:	50                   	push   %eax
+  802d70:	8d 46 ff             	lea    -0x1(%esi),%eax
+  802d73:	50                   	push   %eax
+  802d74:	53                   	push   %ebx
+  802d75:	e8 d8 f5 ff ff       	call   802352 <dir_entry>
+  802d7a:	83 c4 10             	add    $0x10,%esp
+  802d7d:	85 c0                	test   %eax,%eax
+  802d7f:	0f 88 a2 00 00 00    	js     802e27 <file_create+0x444>
+		dir->f_hfree = f->f_hnext;
+  802d85:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  802d8b:	8b 80 c0 00 00 00    	mov    0xc0(%eax),%eax
+  802d91:	89 83 bc 00 00 00    	mov    %eax,0xbc(%ebx)
+  802d97:	e9 6f ff ff ff       	jmp    802d0b <file_create+0x328>
+		h = (h ^ (uint8_t) *name++) * 16777619U;
+  802d9c:	83 c7 01             	add    $0x1,%edi
+  802d9f:	0f b6 c0             	movzbl %al,%eax
+  802da2:	31 c2                	xor    %eax,%edx
+  802da4:	69 d2 93 01 00 01    	imul   $0x1000193,%edx,%edx
+	while (*name)
+  802daa:	0f b6 07             	movzbl (%edi),%eax
+  802dad:	84 c0                	test   %al,%al
+  802daf:	75 eb                	jne    802d9c <file_create+0x3b9>
+	return h % DIR_NBUCKETS;
+  802db1:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+	f->f_hnext = buckets[dir_hash(name)];
+  802db7:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+  802dbd:	8b 04 90             	mov    (%eax,%edx,4),%eax
+  802dc0:	8b bd 50 ff ff ff    	mov    -0xb0(%ebp),%edi
+  802dc6:	89 87 c0 00 00 00    	mov    %eax,0xc0(%edi)
+	uint32_t h = 2166136261U;
+  802dcc:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+  802dd1:	8d 8d 68 ff ff ff    	lea    -0x98(%ebp),%ecx
+  802dd7:	eb 0e                	jmp    802de7 <file_create+0x404>
+		h = (h ^ (uint8_t) *name++) * 16777619U;
+  802dd9:	83 c1 01             	add    $0x1,%ecx
+  802ddc:	0f b6 c0             	movzbl %al,%eax
+  802ddf:	31 c2                	xor    %eax,%edx
+  802de1:	69 d2 93 01 00 01    	imul   $0x1000193,%edx,%edx
+	while (*name)
+  802de7:	0f b6 01             	movzbl (%ecx),%eax
+  802dea:	84 c0                	test   %al,%al
+  802dec:	75 eb                	jne    802dd9 <file_create+0x3f6>
+	return h % DIR_NBUCKETS;
+  802dee:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+	buckets[dir_hash(name)] = i;
+  802df4:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+  802dfa:	89 34 90             	mov    %esi,(%eax,%edx,4)
+	return 0;
+  802dfd:	e9 86 fe ff ff       	jmp    802c88 <file_create+0x2a5>
+			if ((r = file_get_block(dir, i, &blk)) < 0)
+  802e02:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  802e08:	e9 b1 fe ff ff       	jmp    802cbe <file_create+0x2db>
+		return -E_FILE_EXISTS;
+  802e0d:	c7 85 54 ff ff ff f3 	movl   $0xfffffff3,-0xac(%ebp)
+  802e14:	ff ff ff 
+  802e17:	e9 a2 fe ff ff       	jmp    802cbe <file_create+0x2db>
+			return r;
+  802e1c:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  802e22:	e9 97 fe ff ff       	jmp    802cbe <file_create+0x2db>
+			return r;
+  802e27:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  802e2d:	e9 8c fe ff ff       	jmp    802cbe <file_create+0x2db>
+
+00802e32 <file_remove>:
+{
+  802e32:	55                   	push   %ebp
+  802e33:	89 e5                	mov    %esp,%ebp
+  802e35:	57                   	push   %edi
+  802e36:	56                   	push   %esi
+  802e37:	53                   	push   %ebx
+  802e38:	83 ec 38             	sub    $0x38,%esp
+	if ((r = walk_path(path, &dir, &f, 0)) < 0)
+  802e3b:	6a 00                	push   $0x0
+  802e3d:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802e40:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  802e43:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e46:	e8 42 f5 ff ff       	call   80238d <walk_path>
+  802e4b:	83 c4 10             	add    $0x10,%esp
+  802e4e:	85 c0                	test   %eax,%eax
+  802e50:	78 69                	js     802ebb <file_remove+0x89>
+	if (dir == 0)
+  802e52:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802e55:	85 ff                	test   %edi,%edi
+  802e57:	0f 84 1f 01 00 00    	je     802f7c <file_remove+0x14a>
+	if (f->f_type == FTYPE_DIR && !dir_is_empty(f))
+  802e5d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802e60:	83 bb 84 00 00 00 01 	cmpl   $0x1,0x84(%ebx)
+  802e67:	74 5a                	je     802ec3 <file_remove+0x91>
+	dcache_enter(dir, f->f_name, 0);
+  802e69:	83 ec 04             	sub    $0x4,%esp
+  802e6c:	6a 00                	push   $0x0
+  802e6e:	53                   	push   %ebx
+  802e6f:	57                   	push   %edi
+  802e70:	e8 cb 07 00 00       	call   803640 <dcache_enter>
+	file_truncate_blocks(f, 0);
+  802e75:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e7a:	89 d8                	mov    %ebx,%eax
+  802e7c:	e8 38 ec ff ff       	call   801ab9 <file_truncate_blocks>
+	walk_hint_drop(f);
+  802e81:	89 d8                	mov    %ebx,%eax
+  802e83:	e8 ef e3 ff ff       	call   801277 <walk_hint_drop>
+	f->f_size = 0;
+  802e88:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802e8f:	00 00 00 
+	if (dir->f_hindex) {
+  802e92:	8b 87 b8 00 00 00    	mov    0xb8(%edi),%eax
+  802e98:	83 c4 10             	add    $0x10,%esp
+  802e9b:	85 c0                	test   %eax,%eax
+  802e9d:	75 60                	jne    802eff <file_remove+0xcd>
+	f->f_name[0] = '\0';
+  802e9f:	c6 03 00             	movb   $0x0,(%ebx)
+	flush_block(f);
+  802ea2:	83 ec 0c             	sub    $0xc,%esp
+  802ea5:	53                   	push   %ebx
+  802ea6:	e8 1d d8 ff ff       	call   8006c8 <flush_block>
+	file_flush(dir);
+  802eab:	89 3c 24             	mov    %edi,(%esp)
+  802eae:	e8 2d fa ff ff       	call   8028e0 <file_flush>
+	return 0;
+  802eb3:	83 c4 10             	add    $0x10,%esp
+  802eb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ebb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ebe:	5b                   	pop    %ebx
+  802ebf:	5e                   	pop    %esi
+  802ec0:	5f                   	pop    %edi
+  802ec1:	5d                   	pop    %ebp
+  802ec2:	c3                   	ret
+	for (i = 0; i < dir->f_size / sizeof(struct File); i++)
+  802ec3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ec8:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802ece:	c1 e8 08             	shr    $0x8,%eax
+  802ed1:	39 c6                	cmp    %eax,%esi
+  802ed3:	73 94                	jae    802e69 <file_remove+0x37>
+		if (dir_entry(dir, i, &f) < 0 || f->f_name[0])
+  802ed5:	83 ec 04             	sub    $0x4,%esp
+  802ed8:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  802edb:	50                   	push   %eax
+  802edc:	56                   	push   %esi
+  802edd:	53                   	push   %ebx
+  802ede:	e8 6f f4 ff ff       	call   802352 <dir_entry>
+  802ee3:	83 c4 10             	add    $0x10,%esp
+  802ee6:	85 c0                	test   %eax,%eax
+  802ee8:	0f 88 dc 00 00 00    	js     802fca <file_remove+0x198>
+  802eee:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802ef1:	80 38 00             	cmpb   $0x0,(%eax)
+  802ef4:	0f 85 d0 00 00 00    	jne    802fca <file_remove+0x198>
+	for (i = 0; i < dir->f_size / sizeof(struct File); i++)
+  802efa:	83 c6 01             	add    $0x1,%esi
+  802efd:	eb c9                	jmp    802ec8 <file_remove+0x96>
+		buckets = diskaddr(dir->f_hindex);
+  802eff:	83 ec 0c             	sub    $0xc,%esp
+  802f02:	50                   	push   %eax
+  802f03:	e8 60 d4 ff ff       	call   800368 <diskaddr>
+  802f08:	89 c6                	mov    %eax,%esi
+	while (*name)
+  802f0a:	83 c4 10             	add    $0x10,%esp
+  802f0d:	89 d9                	mov    %ebx,%ecx
+	uint32_t h = 2166136261U;
+  802f0f:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+	while (*name)
+  802f14:	eb 0e                	jmp    802f24 <file_remove+0xf2>
+		h = (h ^ (uint8_t) *name++) * 16777619U;
+  802f16:	83 c1 01             	add    $0x1,%ecx
+  802f19:	0f b6 c0             	movzbl %al,%eax
+  802f1c:	31 d0                	xor    %edx,%eax
+  802f1e:	69 d0 93 01 00 01    	imul   $0x1000193,%eax,%edx
+	while (*name)
+  802f24:	0f b6 01             	movzbl (%ecx),%eax
+  802f27:	84 c0                	test   %al,%al
+  802f29:	75 eb                	jne    802f16 <file_remove+0xe4>
+	return h % DIR_NBUCKETS;
+  802f2b:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+		for (i = buckets[b]; i != 0; prev = e, i = e->f_hnext) {
+  802f31:	8d 14 96             	lea    (%esi,%edx,4),%edx
+  802f34:	8b 32                	mov    (%edx),%esi
+		prev = NULL;
+  802f36:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  802f3d:	89 55 d0             	mov    %edx,-0x30(%ebp)
+		for (i = buckets[b]; i != 0; prev = e, i = e->f_hnext) {
+  802f40:	85 f6                	test   %esi,%esi
+  802f42:	74 71                	je     802fb5 <file_remove+0x183>
+			if ((r = dir_entry(dir, i - 1, &e)) < 0)
+  802f44:	83 ec 04             	sub    $0x4,%esp
+  802f47:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  802f4a:	50                   	push   %eax
+  802f4b:	8d 46 ff             	lea    -0x1(%esi),%eax
+  802f4e:	50                   	push   %eax
+  802f4f:	57                   	push   %edi
+  802f50:	e8 fd f3 ff ff       	call   802352 <dir_entry>
+  802f55:	83 c4 10             	add    $0x10,%esp
+  802f58:	85 c0                	test   %eax,%eax
+  802f5a:	0f 88 5b ff ff ff    	js     802ebb <file_remove+0x89>
+			if (e == f)
+  802f60:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802f63:	39 c3                	cmp    %eax,%ebx
+  802f65:	74 1f                	je     802f86 <file_remove+0x154>
+		for (i = buckets[b]; i != 0; prev = e, i = e->f_hnext) {
+  802f67:	8b b0 c0 00 00 00    	mov    0xc0(%eax),%esi
+  802f6d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802f70:	eb ce                	jmp    802f40 <file_remove+0x10e>
+			buckets[b] = f->f_hnext;
+  802f72:	8b 83 c0 00 00 00    	mov    0xc0(%ebx),%eax
+  802f78:	89 02                	mov    %eax,(%edx)
+  802f7a:	eb 22                	jmp    802f9e <file_remove+0x16c>
+		return -E_INVAL;
+  802f7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f81:	e9 35 ff ff ff       	jmp    802ebb <file_remove+0x89>
+		if (prev)
+  802f86:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  802f89:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802f8d:	74 e3                	je     802f72 <file_remove+0x140>
+			prev->f_hnext = f->f_hnext;
+  802f8f:	8b 83 c0 00 00 00    	mov    0xc0(%ebx),%eax
+  802f95:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  802f98:	89 81 c0 00 00 00    	mov    %eax,0xc0(%ecx)
+		f->f_hnext = dir->f_hfree;
+  802f9e:	8b 87 bc 00 00 00    	mov    0xbc(%edi),%eax
+  802fa4:	89 83 c0 00 00 00    	mov    %eax,0xc0(%ebx)
+		dir->f_hfree = i;
+  802faa:	89 b7 bc 00 00 00    	mov    %esi,0xbc(%edi)
+  802fb0:	e9 ea fe ff ff       	jmp    802e9f <file_remove+0x6d>
+			panic("dir_unlink: %s missing from its hash bucket", f->f_name);
+  802fb5:	53                   	push   %ebx
+  802fb6:	68 64 8d 80 00       	push   $0x808d64
+  802fbb:	68 84 03 00 00       	push   $0x384
+  802fc0:	68 77 8c 80 00       	push   $0x808c77
+  802fc5:	e8 49 23 00 00       	call   805313 <_panic>
+		return -E_NOT_EMPTY;
+  802fca:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802fcf:	e9 e7 fe ff ff       	jmp    802ebb <file_remove+0x89>
+
+00802fd4 <fs_sync>:
+
+// Sync the entire file system.  A big hammer, but only as big as the
+// set of blocks in the cache.
+void
+fs_sync(void)
+{
+  802fd4:	55                   	push   %ebp
+  802fd5:	89 e5                	mov    %esp,%ebp
+  802fd7:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	if ((r = file_commit(0)) < 0)
+  802fda:	6a 00                	push   $0x0
+  802fdc:	e8 b3 ee ff ff       	call   801e94 <file_commit>
+  802fe1:	83 c4 10             	add    $0x10,%esp
+  802fe4:	85 c0                	test   %eax,%eax
+  802fe6:	78 07                	js     802fef <fs_sync+0x1b>
+		cprintf("warning: file_commit: %e\n", r);
+	bc_flush();
+  802fe8:	e8 80 de ff ff       	call   800e6d <bc_flush>
+}
+  802fed:	c9                   	leave
+  802fee:	c3                   	ret
+		cprintf("warning: file_commit: %e\n", r);
+  802fef:	83 ec 08             	sub    $0x8,%esp
+  802ff2:	50                   	push   %eax
+  802ff3:	68 49 8d 80 00       	push   $0x808d49
+  802ff8:	e8 f1 23 00 00       	call   8053ee <cprintf>
+  802ffd:	83 c4 10             	add    $0x10,%esp
+  803000:	eb e6                	jmp    802fe8 <fs_sync+0x14>
+
+00803002 <fs_tick>:
+// the oldest is BC_FLUSH_MSEC old, so that they reach the disk about
+// as soon as other dirty blocks do; that needs 'exclusive' use of the
+// file system.
+void
+fs_tick(bool exclusive)
+{
+  803002:	55                   	push   %ebp
+  803003:	89 e5                	mov    %esp,%ebp
+  803005:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (exclusive && da_count > 0
+  803008:	80 7d 08 00          	cmpb   $0x0,0x8(%ebp)
+  80300c:	74 09                	je     803017 <fs_tick+0x15>
+  80300e:	83 3d 04 72 86 00 00 	cmpl   $0x0,0x867204
+  803015:	75 07                	jne    80301e <fs_tick+0x1c>
+	    && (int32_t) (sys_time_msec() - da_since) >= BC_FLUSH_MSEC
+	    && (r = file_commit(0)) < 0)
+		cprintf("warning: file_commit: %e\n", r);
+	bc_tick();
+  803017:	e8 e7 de ff ff       	call   800f03 <bc_tick>
+}
+  80301c:	c9                   	leave
+  80301d:	c3                   	ret
+	    && (int32_t) (sys_time_msec() - da_since) >= BC_FLUSH_MSEC
+  80301e:	e8 64 30 00 00       	call   806087 <sys_time_msec>
+  803023:	2b 05 00 72 86 00    	sub    0x867200,%eax
+  803029:	3d e7 03 00 00       	cmp    $0x3e7,%eax
+  80302e:	7e e7                	jle    803017 <fs_tick+0x15>
+	    && (r = file_commit(0)) < 0)
+  803030:	83 ec 0c             	sub    $0xc,%esp
+  803033:	6a 00                	push   $0x0
+  803035:	e8 5a ee ff ff       	call   801e94 <file_commit>
+  80303a:	83 c4 10             	add    $0x10,%esp
+  80303d:	85 c0                	test   %eax,%eax
+  80303f:	79 d6                	jns    803017 <fs_tick+0x15>
+		cprintf("warning: file_commit: %e\n", r);
+  803041:	83 ec 08             	sub    $0x8,%esp
+  803044:	50                   	push   %eax
+  803045:	68 49 8d 80 00       	push   $0x808d49
+  80304a:	e8 9f 23 00 00       	call   8053ee <cprintf>
+  80304f:	83 c4 10             	add    $0x10,%esp
+  803052:	eb c3                	jmp    803017 <fs_tick+0x15>
+
+00803054 <fs_tick_due>:
+
+// When fs_tick next has work to do, as a sys_time_msec() value.
+uint32_t
+fs_tick_due(void)
+{
+  803054:	55                   	push   %ebp
+  803055:	89 e5                	mov    %esp,%ebp
+  803057:	83 ec 08             	sub    $0x8,%esp
+	uint32_t due = bc_tick_due();
+  80305a:	e8 c0 de ff ff       	call   800f1f <bc_tick_due>
+
+	if (da_count > 0 && (int32_t) (da_since + BC_FLUSH_MSEC - due) < 0)
+  80305f:	83 3d 04 72 86 00 00 	cmpl   $0x0,0x867204
+  803066:	74 11                	je     803079 <fs_tick_due+0x25>
+  803068:	8b 0d 00 72 86 00    	mov    0x867200,%ecx
+  80306e:	8d 91 e8 03 00 00    	lea    0x3e8(%ecx),%edx
+		due = da_since + BC_FLUSH_MSEC;
+  803074:	39 c2                	cmp    %eax,%edx
+  803076:	0f 48 c2             	cmovs  %edx,%eax
+	return due;
+}
+  803079:	c9                   	leave
+  80307a:	c3                   	ret
+
+0080307b <file_extents>:
+
+// Count the physically contiguous extents of f's blocks.
+int
+file_extents(struct File *f)
+{
+  80307b:	55                   	push   %ebp
+  80307c:	89 e5                	mov    %esp,%ebp
+  80307e:	57                   	push   %edi
+  80307f:	56                   	push   %esi
+  803080:	53                   	push   %ebx
+  803081:	83 ec 2c             	sub    $0x2c,%esp
+	uint32_t i, nblocks, *pdiskbno, prev;
+	int r, n;
+
+	n = prev = 0;
+	nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  803084:	8b 45 08             	mov    0x8(%ebp),%eax
+  803087:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  80308d:	8d b8 fe 1f 00 00    	lea    0x1ffe(%eax),%edi
+  803093:	05 ff 0f 00 00       	add    $0xfff,%eax
+  803098:	0f 49 f8             	cmovns %eax,%edi
+  80309b:	c1 ff 0c             	sar    $0xc,%edi
+	n = prev = 0;
+  80309e:	be 00 00 00 00       	mov    $0x0,%esi
+  8030a3:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+	for (i = 0; i < nblocks; i++) {
+  8030aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030af:	eb 28                	jmp    8030d9 <file_extents+0x5e>
+		return NDIRECT + NINDIRECT;
+  8030b1:	b8 0a 04 00 00       	mov    $0x40a,%eax
+	if (filebno < NDIRECT + NINDIRECT)
+  8030b6:	81 fb 09 04 00 00    	cmp    $0x409,%ebx
+  8030bc:	76 0d                	jbe    8030cb <file_extents+0x50>
+	return ROUNDUP(filebno - NDIRECT - NINDIRECT + 1, NINDIRECT)
+  8030be:	8d 43 f6             	lea    -0xa(%ebx),%eax
+		+ NDIRECT + NINDIRECT;
+  8030c1:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  8030c6:	05 0a 04 00 00       	add    $0x40a,%eax
+		if ((r = file_block_walk(f, i, &pdiskbno, 0)) == -E_NOT_FOUND) {
+			i = next_leaf(i) - 1;
+  8030cb:	8d 58 ff             	lea    -0x1(%eax),%ebx
+			continue;
+  8030ce:	eb 06                	jmp    8030d6 <file_extents+0x5b>
+		if (r < 0)
+			return r;
+		if (*pdiskbno == 0)
+			continue;
+		if (n == 0 || *pdiskbno != prev + 1)
+			n++;
+  8030d0:	83 c6 01             	add    $0x1,%esi
+		prev = *pdiskbno;
+  8030d3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	for (i = 0; i < nblocks; i++) {
+  8030d6:	83 c3 01             	add    $0x1,%ebx
+  8030d9:	39 fb                	cmp    %edi,%ebx
+  8030db:	73 3a                	jae    803117 <file_extents+0x9c>
+		if ((r = file_block_walk(f, i, &pdiskbno, 0)) == -E_NOT_FOUND) {
+  8030dd:	83 ec 0c             	sub    $0xc,%esp
+  8030e0:	6a 00                	push   $0x0
+  8030e2:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  8030e5:	89 da                	mov    %ebx,%edx
+  8030e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030ea:	e8 f5 e7 ff ff       	call   8018e4 <file_block_walk>
+  8030ef:	83 c4 10             	add    $0x10,%esp
+  8030f2:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8030f5:	74 ba                	je     8030b1 <file_extents+0x36>
+		if (r < 0)
+  8030f7:	85 c0                	test   %eax,%eax
+  8030f9:	78 1a                	js     803115 <file_extents+0x9a>
+		if (*pdiskbno == 0)
+  8030fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030fe:	8b 00                	mov    (%eax),%eax
+  803100:	85 c0                	test   %eax,%eax
+  803102:	74 d2                	je     8030d6 <file_extents+0x5b>
+		if (n == 0 || *pdiskbno != prev + 1)
+  803104:	85 f6                	test   %esi,%esi
+  803106:	74 c8                	je     8030d0 <file_extents+0x55>
+  803108:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+  80310c:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  80310f:	39 d0                	cmp    %edx,%eax
+  803111:	75 bd                	jne    8030d0 <file_extents+0x55>
+  803113:	eb c1                	jmp    8030d6 <file_extents+0x5b>
+		if ((r = file_block_walk(f, i, &pdiskbno, 0)) == -E_NOT_FOUND) {
+  803115:	89 c6                	mov    %eax,%esi
+	}
+	return n;
+}
+  803117:	89 f0                	mov    %esi,%eax
+  803119:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80311c:	5b                   	pop    %ebx
+  80311d:	5e                   	pop    %esi
+  80311e:	5f                   	pop    %edi
+  80311f:	5d                   	pop    %ebp
+  803120:	c3                   	ret
+
+00803121 <file_repack>:
+// only once the new pointers are on disk too, so a crash at any point
+// leaves the file's data intact.  Indirect blocks stay where they are.
+// Returns 0 on success, < 0 on error.
+int
+file_repack(struct File *f)
+{
+  803121:	55                   	push   %ebp
+  803122:	89 e5                	mov    %esp,%ebp
+  803124:	57                   	push   %edi
+  803125:	56                   	push   %esi
+  803126:	53                   	push   %ebx
+  803127:	83 ec 3c             	sub    $0x3c,%esp
+	static uint32_t bnos[FLUSH_BATCH], olds[FLUSH_BATCH];
+	static uint32_t news[FLUSH_BATCH], sorted[FLUSH_BATCH];
+	uint32_t bno, nblocks, goal, start, i, j, n, *pdiskbno;
+	int r;
+
+	if (f->f_type != FTYPE_REG)
+  80312a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80312d:	8b b0 84 00 00 00    	mov    0x84(%eax),%esi
+  803133:	89 75 c8             	mov    %esi,-0x38(%ebp)
+  803136:	85 f6                	test   %esi,%esi
+  803138:	0f 85 b5 02 00 00    	jne    8033f3 <file_repack+0x2d2>
+  80313e:	89 f3                	mov    %esi,%ebx
+		return -E_INVAL;
+	// Commit everyone's delayed blocks, so that the blocks taken here
+	// cannot eat into the space reserved for them.
+	if ((r = file_commit(0)) < 0)
+  803140:	83 ec 0c             	sub    $0xc,%esp
+  803143:	6a 00                	push   $0x0
+  803145:	e8 4a ed ff ff       	call   801e94 <file_commit>
+  80314a:	83 c4 10             	add    $0x10,%esp
+  80314d:	85 c0                	test   %eax,%eax
+  80314f:	0f 88 aa 02 00 00    	js     8033ff <file_repack+0x2de>
+		return r;
+	if (file_extents(f) <= 1)
+  803155:	83 ec 0c             	sub    $0xc,%esp
+  803158:	ff 75 08             	push   0x8(%ebp)
+  80315b:	e8 1b ff ff ff       	call   80307b <file_extents>
+  803160:	83 c4 10             	add    $0x10,%esp
+  803163:	83 f8 01             	cmp    $0x1,%eax
+  803166:	0f 8e 8e 02 00 00    	jle    8033fa <file_repack+0x2d9>
+		return 0;
+
+	nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  80316c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80316f:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  803175:	8d 90 fe 1f 00 00    	lea    0x1ffe(%eax),%edx
+  80317b:	05 ff 0f 00 00       	add    $0xfff,%eax
+  803180:	0f 48 c2             	cmovs  %edx,%eax
+  803183:	c1 f8 0c             	sar    $0xc,%eax
+  803186:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	for (b = n = 0; b < super->s_nblocks; b++) {
+  803189:	a1 24 01 86 00       	mov    0x860124,%eax
+  80318e:	8b 78 04             	mov    0x4(%eax),%edi
+		if (b % 32 == 0 && bitmap[b / 32] == 0) {
+  803191:	a1 20 01 86 00       	mov    0x860120,%eax
+  803196:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	for (b = n = 0; b < super->s_nblocks; b++) {
+  803199:	eb 41                	jmp    8031dc <file_repack+0xbb>
+		} else if (!block_is_free(b))
+  80319b:	83 ec 0c             	sub    $0xc,%esp
+  80319e:	53                   	push   %ebx
+  80319f:	e8 75 e4 ff ff       	call   801619 <block_is_free>
+  8031a4:	83 c4 10             	add    $0x10,%esp
+  8031a7:	84 c0                	test   %al,%al
+  8031a9:	74 2b                	je     8031d6 <file_repack+0xb5>
+		else if (++n == want)
+  8031ab:	8d 46 01             	lea    0x1(%esi),%eax
+  8031ae:	39 45 cc             	cmp    %eax,-0x34(%ebp)
+  8031b1:	74 04                	je     8031b7 <file_repack+0x96>
+  8031b3:	89 c6                	mov    %eax,%esi
+  8031b5:	eb 22                	jmp    8031d9 <file_repack+0xb8>
+	goal = (r = free_run(nblocks)) >= 0 ? r : alloc_rotor;
+  8031b7:	29 f3                	sub    %esi,%ebx
+  8031b9:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+  8031bc:	78 3d                	js     8031fb <file_repack+0xda>
+				panic("file_repack: file_block_walk: %e", r);
+			*pdiskbno = news[i];
+		}
+		walk_hint_drop(f);
+		file_flush_meta(f);
+		for (i = 0; i < n; i++)
+  8031be:	8b 7d c8             	mov    -0x38(%ebp),%edi
+	for (bno = 0; bno < nblocks; ) {
+  8031c1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8031c4:	39 c7                	cmp    %eax,%edi
+  8031c6:	0f 83 20 02 00 00    	jae    8033ec <file_repack+0x2cb>
+		for (n = 0; bno < nblocks && n < FLUSH_BATCH; bno++) {
+  8031cc:	8b 75 c8             	mov    -0x38(%ebp),%esi
+		return NDIRECT + NINDIRECT;
+  8031cf:	bb 0a 04 00 00       	mov    $0x40a,%ebx
+  8031d4:	eb 5f                	jmp    803235 <file_repack+0x114>
+			n = 0;
+  8031d6:	8b 75 c8             	mov    -0x38(%ebp),%esi
+	for (b = n = 0; b < super->s_nblocks; b++) {
+  8031d9:	83 c3 01             	add    $0x1,%ebx
+  8031dc:	39 fb                	cmp    %edi,%ebx
+  8031de:	73 1b                	jae    8031fb <file_repack+0xda>
+		if (b % 32 == 0 && bitmap[b / 32] == 0) {
+  8031e0:	f6 c3 1f             	test   $0x1f,%bl
+  8031e3:	75 b6                	jne    80319b <file_repack+0x7a>
+  8031e5:	89 d8                	mov    %ebx,%eax
+  8031e7:	c1 e8 05             	shr    $0x5,%eax
+  8031ea:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  8031ed:	8b 04 82             	mov    (%edx,%eax,4),%eax
+  8031f0:	85 c0                	test   %eax,%eax
+  8031f2:	75 a7                	jne    80319b <file_repack+0x7a>
+			b += 31;
+  8031f4:	83 c3 1f             	add    $0x1f,%ebx
+			n = 0;
+  8031f7:	89 c6                	mov    %eax,%esi
+  8031f9:	eb de                	jmp    8031d9 <file_repack+0xb8>
+	goal = (r = free_run(nblocks)) >= 0 ? r : alloc_rotor;
+  8031fb:	a1 30 c2 86 00       	mov    0x86c230,%eax
+  803200:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803203:	eb b9                	jmp    8031be <file_repack+0x9d>
+		return NDIRECT + NINDIRECT;
+  803205:	89 d8                	mov    %ebx,%eax
+	if (filebno < NDIRECT + NINDIRECT)
+  803207:	81 ff 09 04 00 00    	cmp    $0x409,%edi
+  80320d:	76 0d                	jbe    80321c <file_repack+0xfb>
+	return ROUNDUP(filebno - NDIRECT - NINDIRECT + 1, NINDIRECT)
+  80320f:	8d 47 f6             	lea    -0xa(%edi),%eax
+		+ NDIRECT + NINDIRECT;
+  803212:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  803217:	05 0a 04 00 00       	add    $0x40a,%eax
+				bno = next_leaf(bno) - 1;
+  80321c:	8d 78 ff             	lea    -0x1(%eax),%edi
+				continue;
+  80321f:	eb 11                	jmp    803232 <file_repack+0x111>
+			bnos[n] = bno;
+  803221:	89 3c b5 a0 31 86 00 	mov    %edi,0x8631a0(,%esi,4)
+			olds[n++] = *pdiskbno;
+  803228:	89 04 b5 80 21 86 00 	mov    %eax,0x862180(,%esi,4)
+  80322f:	8d 76 01             	lea    0x1(%esi),%esi
+		for (n = 0; bno < nblocks && n < FLUSH_BATCH; bno++) {
+  803232:	83 c7 01             	add    $0x1,%edi
+  803235:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  803238:	39 c7                	cmp    %eax,%edi
+  80323a:	73 35                	jae    803271 <file_repack+0x150>
+  80323c:	81 fe 02 04 00 00    	cmp    $0x402,%esi
+  803242:	77 2d                	ja     803271 <file_repack+0x150>
+			if ((r = file_block_walk(f, bno, &pdiskbno, 0)) == -E_NOT_FOUND) {
+  803244:	83 ec 0c             	sub    $0xc,%esp
+  803247:	6a 00                	push   $0x0
+  803249:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80324c:	89 fa                	mov    %edi,%edx
+  80324e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803251:	e8 8e e6 ff ff       	call   8018e4 <file_block_walk>
+  803256:	83 c4 10             	add    $0x10,%esp
+  803259:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80325c:	74 a7                	je     803205 <file_repack+0xe4>
+			if (r < 0)
+  80325e:	85 c0                	test   %eax,%eax
+  803260:	0f 88 99 01 00 00    	js     8033ff <file_repack+0x2de>
+			if (*pdiskbno == 0)
+  803266:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803269:	8b 00                	mov    (%eax),%eax
+  80326b:	85 c0                	test   %eax,%eax
+  80326d:	75 b2                	jne    803221 <file_repack+0x100>
+  80326f:	eb c1                	jmp    803232 <file_repack+0x111>
+		for (i = 0; i < n; i += r) {
+  803271:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  803274:	8b 75 c8             	mov    -0x38(%ebp),%esi
+  803277:	89 7d bc             	mov    %edi,-0x44(%ebp)
+  80327a:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  80327d:	89 f7                	mov    %esi,%edi
+  80327f:	eb 78                	jmp    8032f9 <file_repack+0x1d8>
+  803281:	89 fb                	mov    %edi,%ebx
+  803283:	83 eb 01             	sub    $0x1,%ebx
+  803286:	89 c6                	mov    %eax,%esi
+  803288:	eb 15                	jmp    80329f <file_repack+0x17e>
+					free_block(news[i]);
+  80328a:	83 ec 0c             	sub    $0xc,%esp
+  80328d:	ff 34 9d 60 11 86 00 	push   0x861160(,%ebx,4)
+  803294:	e8 c0 e3 ff ff       	call   801659 <free_block>
+  803299:	83 eb 01             	sub    $0x1,%ebx
+  80329c:	83 c4 10             	add    $0x10,%esp
+				while (i-- > 0)
+  80329f:	83 fb ff             	cmp    $0xffffffff,%ebx
+  8032a2:	75 e6                	jne    80328a <file_repack+0x169>
+  8032a4:	89 f0                	mov    %esi,%eax
+  8032a6:	e9 54 01 00 00       	jmp    8033ff <file_repack+0x2de>
+				news[i + j] = start + j;
+  8032ab:	89 df                	mov    %ebx,%edi
+  8032ad:	03 7d e4             	add    -0x1c(%ebp),%edi
+  8032b0:	89 bc 9e 60 11 86 00 	mov    %edi,0x861160(%esi,%ebx,4)
+				memmove(diskaddr(start + j), diskaddr(olds[i + j]), BLKSIZE);
+  8032b7:	83 ec 0c             	sub    $0xc,%esp
+  8032ba:	ff b4 9e 80 21 86 00 	push   0x862180(%esi,%ebx,4)
+  8032c1:	e8 a2 d0 ff ff       	call   800368 <diskaddr>
+  8032c6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8032c9:	89 3c 24             	mov    %edi,(%esp)
+  8032cc:	e8 97 d0 ff ff       	call   800368 <diskaddr>
+  8032d1:	83 c4 0c             	add    $0xc,%esp
+  8032d4:	68 00 10 00 00       	push   $0x1000
+  8032d9:	ff 75 d4             	push   -0x2c(%ebp)
+  8032dc:	50                   	push   %eax
+  8032dd:	e8 80 28 00 00       	call   805b62 <memmove>
+			for (j = 0; j < r; j++) {
+  8032e2:	83 c3 01             	add    $0x1,%ebx
+  8032e5:	83 c4 10             	add    $0x10,%esp
+  8032e8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8032eb:	39 c3                	cmp    %eax,%ebx
+  8032ed:	75 bc                	jne    8032ab <file_repack+0x18a>
+			goal = start + r;
+  8032ef:	8b 7d c0             	mov    -0x40(%ebp),%edi
+  8032f2:	89 c2                	mov    %eax,%edx
+  8032f4:	03 55 e4             	add    -0x1c(%ebp),%edx
+		for (i = 0; i < n; i += r) {
+  8032f7:	01 c7                	add    %eax,%edi
+  8032f9:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8032fc:	39 c7                	cmp    %eax,%edi
+  8032fe:	73 30                	jae    803330 <file_repack+0x20f>
+			if ((r = alloc_extent(goal, n - i, &start)) < 0) {
+  803300:	83 ec 04             	sub    $0x4,%esp
+  803303:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803306:	50                   	push   %eax
+  803307:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80330a:	29 f8                	sub    %edi,%eax
+  80330c:	50                   	push   %eax
+  80330d:	52                   	push   %edx
+  80330e:	e8 c4 e3 ff ff       	call   8016d7 <alloc_extent>
+  803313:	83 c4 10             	add    $0x10,%esp
+  803316:	85 c0                	test   %eax,%eax
+  803318:	0f 88 63 ff ff ff    	js     803281 <file_repack+0x160>
+  80331e:	8d 34 bd 00 00 00 00 	lea    0x0(,%edi,4),%esi
+			for (j = 0; j < r; j++) {
+  803325:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  803328:	89 7d c0             	mov    %edi,-0x40(%ebp)
+  80332b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80332e:	eb b8                	jmp    8032e8 <file_repack+0x1c7>
+		memmove(sorted, news, n * sizeof(news[0]));
+  803330:	8b 7d bc             	mov    -0x44(%ebp),%edi
+  803333:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  803336:	83 ec 04             	sub    $0x4,%esp
+  803339:	89 c6                	mov    %eax,%esi
+  80333b:	8d 04 85 00 00 00 00 	lea    0x0(,%eax,4),%eax
+  803342:	50                   	push   %eax
+  803343:	68 60 11 86 00       	push   $0x861160
+  803348:	68 40 01 86 00       	push   $0x860140
+  80334d:	e8 10 28 00 00       	call   805b62 <memmove>
+		bc_flush_list(sorted, n);
+  803352:	83 c4 08             	add    $0x8,%esp
+  803355:	56                   	push   %esi
+  803356:	68 40 01 86 00       	push   $0x860140
+  80335b:	e8 33 d4 ff ff       	call   800793 <bc_flush_list>
+		for (i = 0; i < n; i++) {
+  803360:	83 c4 10             	add    $0x10,%esp
+  803363:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  803366:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  803369:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80336c:	39 f3                	cmp    %esi,%ebx
+  80336e:	74 43                	je     8033b3 <file_repack+0x292>
+			if ((r = file_block_walk(f, bnos[i], &pdiskbno, 0)) < 0)
+  803370:	8b 14 9d a0 31 86 00 	mov    0x8631a0(,%ebx,4),%edx
+  803377:	83 ec 0c             	sub    $0xc,%esp
+  80337a:	6a 00                	push   $0x0
+  80337c:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80337f:	89 f8                	mov    %edi,%eax
+  803381:	e8 5e e5 ff ff       	call   8018e4 <file_block_walk>
+  803386:	83 c4 10             	add    $0x10,%esp
+  803389:	85 c0                	test   %eax,%eax
+  80338b:	78 11                	js     80339e <file_repack+0x27d>
+			*pdiskbno = news[i];
+  80338d:	8b 14 9d 60 11 86 00 	mov    0x861160(,%ebx,4),%edx
+  803394:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803397:	89 10                	mov    %edx,(%eax)
+		for (i = 0; i < n; i++) {
+  803399:	83 c3 01             	add    $0x1,%ebx
+  80339c:	eb ce                	jmp    80336c <file_repack+0x24b>
+				panic("file_repack: file_block_walk: %e", r);
+  80339e:	50                   	push   %eax
+  80339f:	68 90 8d 80 00       	push   $0x808d90
+  8033a4:	68 98 05 00 00       	push   $0x598
+  8033a9:	68 77 8c 80 00       	push   $0x808c77
+  8033ae:	e8 60 1f 00 00       	call   805313 <_panic>
+		walk_hint_drop(f);
+  8033b3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8033b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033b9:	e8 b9 de ff ff       	call   801277 <walk_hint_drop>
+		file_flush_meta(f);
+  8033be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033c1:	e8 39 df ff ff       	call   8012ff <file_flush_meta>
+		for (i = 0; i < n; i++)
+  8033c6:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8033c9:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8033cc:	eb 15                	jmp    8033e3 <file_repack+0x2c2>
+			free_block(olds[i]);
+  8033ce:	83 ec 0c             	sub    $0xc,%esp
+  8033d1:	ff 34 9d 80 21 86 00 	push   0x862180(,%ebx,4)
+  8033d8:	e8 7c e2 ff ff       	call   801659 <free_block>
+		for (i = 0; i < n; i++)
+  8033dd:	83 c3 01             	add    $0x1,%ebx
+  8033e0:	83 c4 10             	add    $0x10,%esp
+  8033e3:	39 f3                	cmp    %esi,%ebx
+  8033e5:	75 e7                	jne    8033ce <file_repack+0x2ad>
+  8033e7:	e9 d5 fd ff ff       	jmp    8031c1 <file_repack+0xa0>
+	}
+	return 0;
+  8033ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f1:	eb 0c                	jmp    8033ff <file_repack+0x2de>
+		return -E_INVAL;
+  8033f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033f8:	eb 05                	jmp    8033ff <file_repack+0x2de>
+		return 0;
+  8033fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803402:	5b                   	pop    %ebx
+  803403:	5e                   	pop    %esi
+  803404:	5f                   	pop    %edi
+  803405:	5d                   	pop    %ebp
+  803406:	c3                   	ret
+
+00803407 <dc_hash>:
+
+struct DcStats dcstats;
+
+static uint32_t
+dc_hash(struct File *dir, const char *name)
+{
+  803407:	55                   	push   %ebp
+  803408:	89 e5                	mov    %esp,%ebp
+  80340a:	53                   	push   %ebx
+	uint32_t h = 2166136261U;
+  80340b:	bb c5 9d 1c 81       	mov    $0x811c9dc5,%ebx
+	while (*name)
+  803410:	eb 0e                	jmp    803420 <dc_hash+0x19>
+		h = (h ^ (uint8_t) *name++) * 16777619U;
+  803412:	83 c2 01             	add    $0x1,%edx
+  803415:	0f b6 c9             	movzbl %cl,%ecx
+  803418:	31 cb                	xor    %ecx,%ebx
+  80341a:	69 db 93 01 00 01    	imul   $0x1000193,%ebx,%ebx
+	while (*name)
+  803420:	0f b6 0a             	movzbl (%edx),%ecx
+  803423:	84 c9                	test   %cl,%cl
+  803425:	75 eb                	jne    803412 <dc_hash+0xb>
+	return (dir_hash(name) ^ ((uintptr_t) dir / sizeof(struct File)))
+  803427:	c1 e8 08             	shr    $0x8,%eax
+  80342a:	31 d8                	xor    %ebx,%eax
+		% DCACHE_NBUCKETS;
+  80342c:	25 ff 03 00 00       	and    $0x3ff,%eax
+}
+  803431:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803434:	c9                   	leave
+  803435:	c3                   	ret
+
+00803436 <dc_lru_unlink>:
+static void
+dc_lru_unlink(int i)
+{
+	struct Dentry *d = &dc_ents[i];
+
+	if (d->d_prev >= 0)
+  803436:	69 d0 94 00 00 00    	imul   $0x94,%eax,%edx
+  80343c:	8b 92 ec de 86 00    	mov    0x86deec(%edx),%edx
+  803442:	85 d2                	test   %edx,%edx
+  803444:	78 45                	js     80348b <dc_lru_unlink+0x55>
+{
+  803446:	55                   	push   %ebp
+  803447:	89 e5                	mov    %esp,%ebp
+  803449:	53                   	push   %ebx
+		dc_ents[d->d_prev].d_next = d->d_next;
+  80344a:	69 c8 94 00 00 00    	imul   $0x94,%eax,%ecx
+  803450:	8b 99 f0 de 86 00    	mov    0x86def0(%ecx),%ebx
+  803456:	69 ca 94 00 00 00    	imul   $0x94,%edx,%ecx
+  80345c:	89 99 f0 de 86 00    	mov    %ebx,0x86def0(%ecx)
+	else
+		dc_head = d->d_next;
+	if (d->d_next >= 0)
+  803462:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+  803468:	8b 80 f0 de 86 00    	mov    0x86def0(%eax),%eax
+  80346e:	85 c0                	test   %eax,%eax
+  803470:	78 11                	js     803483 <dc_lru_unlink+0x4d>
+		dc_ents[d->d_next].d_prev = d->d_prev;
+  803472:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+  803478:	89 90 ec de 86 00    	mov    %edx,0x86deec(%eax)
+	else
+		dc_tail = d->d_prev;
+}
+  80347e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803481:	c9                   	leave
+  803482:	c3                   	ret
+		dc_tail = d->d_prev;
+  803483:	89 15 10 a0 80 00    	mov    %edx,0x80a010
+}
+  803489:	eb f3                	jmp    80347e <dc_lru_unlink+0x48>
+		dc_head = d->d_next;
+  80348b:	69 c8 94 00 00 00    	imul   $0x94,%eax,%ecx
+  803491:	8b 89 f0 de 86 00    	mov    0x86def0(%ecx),%ecx
+  803497:	89 0d 14 a0 80 00    	mov    %ecx,0x80a014
+	if (d->d_next >= 0)
+  80349d:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+  8034a3:	8b 80 f0 de 86 00    	mov    0x86def0(%eax),%eax
+  8034a9:	85 c0                	test   %eax,%eax
+  8034ab:	78 0d                	js     8034ba <dc_lru_unlink+0x84>
+		dc_ents[d->d_next].d_prev = d->d_prev;
+  8034ad:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+  8034b3:	89 90 ec de 86 00    	mov    %edx,0x86deec(%eax)
+  8034b9:	c3                   	ret
+		dc_tail = d->d_prev;
+  8034ba:	89 15 10 a0 80 00    	mov    %edx,0x80a010
+  8034c0:	c3                   	ret
+
+008034c1 <dc_lru_push>:
+static void
+dc_lru_push(int i)
+{
+	struct Dentry *d = &dc_ents[i];
+
+	d->d_prev = -1;
+  8034c1:	69 d0 94 00 00 00    	imul   $0x94,%eax,%edx
+  8034c7:	c7 82 ec de 86 00 ff 	movl   $0xffffffff,0x86deec(%edx)
+  8034ce:	ff ff ff 
+	d->d_next = dc_head;
+  8034d1:	8b 0d 14 a0 80 00    	mov    0x80a014,%ecx
+  8034d7:	89 8a f0 de 86 00    	mov    %ecx,0x86def0(%edx)
+	if (dc_head >= 0)
+  8034dd:	85 c9                	test   %ecx,%ecx
+  8034df:	78 0c                	js     8034ed <dc_lru_push+0x2c>
+		dc_ents[dc_head].d_prev = i;
+  8034e1:	69 c9 94 00 00 00    	imul   $0x94,%ecx,%ecx
+  8034e7:	89 81 ec de 86 00    	mov    %eax,0x86deec(%ecx)
+	dc_head = i;
+  8034ed:	a3 14 a0 80 00       	mov    %eax,0x80a014
+	if (dc_tail < 0)
+  8034f2:	83 3d 10 a0 80 00 00 	cmpl   $0x0,0x80a010
+  8034f9:	78 01                	js     8034fc <dc_lru_push+0x3b>
+		dc_tail = i;
+}
+  8034fb:	c3                   	ret
+		dc_tail = i;
+  8034fc:	a3 10 a0 80 00       	mov    %eax,0x80a010
+}
+  803501:	eb f8                	jmp    8034fb <dc_lru_push+0x3a>
+
+00803503 <dc_remove>:
+
+// Take entry i out of its hash bucket and the LRU list, and put it on
+// the free list.
+static void
+dc_remove(int i)
+{
+  803503:	55                   	push   %ebp
+  803504:	89 e5                	mov    %esp,%ebp
+  803506:	57                   	push   %edi
+  803507:	56                   	push   %esi
+  803508:	53                   	push   %ebx
+  803509:	83 ec 0c             	sub    $0xc,%esp
+  80350c:	89 c3                	mov    %eax,%ebx
+	int *pi;
+	struct Dentry *d = &dc_ents[i];
+
+	for (pi = &dc_buckets[dc_hash(d->d_dir, d->d_name)]; *pi - 1 != i;
+  80350e:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+  803514:	8d 90 68 de 86 00    	lea    0x86de68(%eax),%edx
+  80351a:	8b 80 60 de 86 00    	mov    0x86de60(%eax),%eax
+  803520:	e8 e2 fe ff ff       	call   803407 <dc_hash>
+  803525:	8d 14 85 60 ce 86 00 	lea    0x86ce60(,%eax,4),%edx
+  80352c:	8b 04 85 60 ce 86 00 	mov    0x86ce60(,%eax,4),%eax
+  803533:	eb 12                	jmp    803547 <dc_remove+0x44>
+	     pi = &dc_ents[*pi - 1].d_hnext)
+  803535:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+  80353b:	8d 90 e8 de 86 00    	lea    0x86dee8(%eax),%edx
+  803541:	8b 80 e8 de 86 00    	mov    0x86dee8(%eax),%eax
+	for (pi = &dc_buckets[dc_hash(d->d_dir, d->d_name)]; *pi - 1 != i;
+  803547:	83 e8 01             	sub    $0x1,%eax
+  80354a:	39 d8                	cmp    %ebx,%eax
+  80354c:	75 e7                	jne    803535 <dc_remove+0x32>
+		/* do nothing */;
+	*pi = d->d_hnext;
+  80354e:	69 fb 94 00 00 00    	imul   $0x94,%ebx,%edi
+  803554:	8b 87 e8 de 86 00    	mov    0x86dee8(%edi),%eax
+  80355a:	89 02                	mov    %eax,(%edx)
+	dc_lru_unlink(i);
+  80355c:	89 d8                	mov    %ebx,%eax
+  80355e:	e8 d3 fe ff ff       	call   803436 <dc_lru_unlink>
+	d->d_dir = 0;
+  803563:	c7 87 60 de 86 00 00 	movl   $0x0,0x86de60(%edi)
+  80356a:	00 00 00 
+	d->d_next = dc_free;
+  80356d:	a1 0c a0 80 00       	mov    0x80a00c,%eax
+  803572:	89 87 f0 de 86 00    	mov    %eax,0x86def0(%edi)
+	dc_free = i;
+  803578:	89 1d 0c a0 80 00    	mov    %ebx,0x80a00c
+}
+  80357e:	83 c4 0c             	add    $0xc,%esp
+  803581:	5b                   	pop    %ebx
+  803582:	5e                   	pop    %esi
+  803583:	5f                   	pop    %edi
+  803584:	5d                   	pop    %ebp
+  803585:	c3                   	ret
+
+00803586 <dc_find>:
+{
+  803586:	55                   	push   %ebp
+  803587:	89 e5                	mov    %esp,%ebp
+  803589:	57                   	push   %edi
+  80358a:	56                   	push   %esi
+  80358b:	53                   	push   %ebx
+  80358c:	83 ec 0c             	sub    $0xc,%esp
+  80358f:	89 c6                	mov    %eax,%esi
+  803591:	89 d7                	mov    %edx,%edi
+	for (i = dc_buckets[dc_hash(dir, name)] - 1; i >= 0; i = dc_ents[i].d_hnext - 1)
+  803593:	e8 6f fe ff ff       	call   803407 <dc_hash>
+  803598:	8b 1c 85 60 ce 86 00 	mov    0x86ce60(,%eax,4),%ebx
+  80359f:	83 eb 01             	sub    $0x1,%ebx
+  8035a2:	eb 0f                	jmp    8035b3 <dc_find+0x2d>
+  8035a4:	69 db 94 00 00 00    	imul   $0x94,%ebx,%ebx
+  8035aa:	8b 9b e8 de 86 00    	mov    0x86dee8(%ebx),%ebx
+  8035b0:	83 eb 01             	sub    $0x1,%ebx
+  8035b3:	85 db                	test   %ebx,%ebx
+  8035b5:	78 26                	js     8035dd <dc_find+0x57>
+		if (dc_ents[i].d_dir == dir && strcmp(dc_ents[i].d_name, name) == 0)
+  8035b7:	69 c3 94 00 00 00    	imul   $0x94,%ebx,%eax
+  8035bd:	39 b0 60 de 86 00    	cmp    %esi,0x86de60(%eax)
+  8035c3:	75 df                	jne    8035a4 <dc_find+0x1e>
+  8035c5:	83 ec 08             	sub    $0x8,%esp
+  8035c8:	57                   	push   %edi
+  8035c9:	05 68 de 86 00       	add    $0x86de68,%eax
+  8035ce:	50                   	push   %eax
+  8035cf:	e8 b9 24 00 00       	call   805a8d <strcmp>
+  8035d4:	83 c4 10             	add    $0x10,%esp
+  8035d7:	85 c0                	test   %eax,%eax
+  8035d9:	75 c9                	jne    8035a4 <dc_find+0x1e>
+  8035db:	eb 05                	jmp    8035e2 <dc_find+0x5c>
+	return -1;
+  8035dd:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+}
+  8035e2:	89 d8                	mov    %ebx,%eax
+  8035e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035e7:	5b                   	pop    %ebx
+  8035e8:	5e                   	pop    %esi
+  8035e9:	5f                   	pop    %edi
+  8035ea:	5d                   	pop    %ebp
+  8035eb:	c3                   	ret
+
+008035ec <dcache_lookup>:
+// Look up (dir, name) in the cache.  On a hit, set *pf to the cached
+// File, or to 0 if the name is known not to exist, and return 1.
+// Return 0 on a miss.
+int
+dcache_lookup(struct File *dir, const char *name, struct File **pf)
+{
+  8035ec:	55                   	push   %ebp
+  8035ed:	89 e5                	mov    %esp,%ebp
+  8035ef:	53                   	push   %ebx
+  8035f0:	83 ec 04             	sub    $0x4,%esp
+	int i;
+
+	if ((i = dc_find(dir, name)) < 0) {
+  8035f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035f9:	e8 88 ff ff ff       	call   803586 <dc_find>
+  8035fe:	85 c0                	test   %eax,%eax
+  803600:	78 30                	js     803632 <dcache_lookup+0x46>
+  803602:	89 c3                	mov    %eax,%ebx
+		dcstats.ds_misses++;
+		return 0;
+	}
+	dcstats.ds_hits++;
+  803604:	83 05 40 ce 86 00 01 	addl   $0x1,0x86ce40
+	dc_lru_unlink(i);
+  80360b:	e8 26 fe ff ff       	call   803436 <dc_lru_unlink>
+	dc_lru_push(i);
+  803610:	89 d8                	mov    %ebx,%eax
+  803612:	e8 aa fe ff ff       	call   8034c1 <dc_lru_push>
+	*pf = dc_ents[i].d_file;
+  803617:	69 db 94 00 00 00    	imul   $0x94,%ebx,%ebx
+  80361d:	8b 93 64 de 86 00    	mov    0x86de64(%ebx),%edx
+  803623:	8b 45 10             	mov    0x10(%ebp),%eax
+  803626:	89 10                	mov    %edx,(%eax)
+	return 1;
+  803628:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80362d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803630:	c9                   	leave
+  803631:	c3                   	ret
+		dcstats.ds_misses++;
+  803632:	83 05 44 ce 86 00 01 	addl   $0x1,0x86ce44
+		return 0;
+  803639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80363e:	eb ed                	jmp    80362d <dcache_lookup+0x41>
+
+00803640 <dcache_enter>:
+
+// Remember that looking up 'name' in dir yields f (0 for no such file),
+// replacing anything cached for it before.
+void
+dcache_enter(struct File *dir, const char *name, struct File *f)
+{
+  803640:	55                   	push   %ebp
+  803641:	89 e5                	mov    %esp,%ebp
+  803643:	57                   	push   %edi
+  803644:	56                   	push   %esi
+  803645:	53                   	push   %ebx
+  803646:	83 ec 18             	sub    $0x18,%esp
+  803649:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int i;
+	uint32_t b;
+	struct Dentry *d;
+
+	if (strlen(name) >= MAXNAMELEN)
+  80364c:	53                   	push   %ebx
+  80364d:	e8 4f 23 00 00       	call   8059a1 <strlen>
+  803652:	83 c4 10             	add    $0x10,%esp
+  803655:	83 f8 7f             	cmp    $0x7f,%eax
+  803658:	7e 08                	jle    803662 <dcache_enter+0x22>
+	strcpy(d->d_name, name);
+	b = dc_hash(dir, name);
+	d->d_hnext = dc_buckets[b];
+	dc_buckets[b] = i + 1;
+	dc_lru_push(i);
+}
+  80365a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80365d:	5b                   	pop    %ebx
+  80365e:	5e                   	pop    %esi
+  80365f:	5f                   	pop    %edi
+  803660:	5d                   	pop    %ebp
+  803661:	c3                   	ret
+	if ((i = dc_find(dir, name)) >= 0)
+  803662:	89 da                	mov    %ebx,%edx
+  803664:	8b 45 08             	mov    0x8(%ebp),%eax
+  803667:	e8 1a ff ff ff       	call   803586 <dc_find>
+  80366c:	85 c0                	test   %eax,%eax
+  80366e:	79 7c                	jns    8036ec <dcache_enter+0xac>
+	else if (dc_free < 0 && dc_nused == DCACHE_SIZE) {
+  803670:	8b 35 0c a0 80 00    	mov    0x80a00c,%esi
+  803676:	85 f6                	test   %esi,%esi
+  803678:	0f 88 8d 00 00 00    	js     80370b <dcache_enter+0xcb>
+		dc_free = dc_ents[i].d_next;
+  80367e:	69 c6 94 00 00 00    	imul   $0x94,%esi,%eax
+  803684:	8b 80 f0 de 86 00    	mov    0x86def0(%eax),%eax
+  80368a:	a3 0c a0 80 00       	mov    %eax,0x80a00c
+	d->d_dir = dir;
+  80368f:	69 c6 94 00 00 00    	imul   $0x94,%esi,%eax
+  803695:	8d b8 60 de 86 00    	lea    0x86de60(%eax),%edi
+  80369b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80369e:	89 88 60 de 86 00    	mov    %ecx,0x86de60(%eax)
+	d->d_file = f;
+  8036a4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8036a7:	89 90 64 de 86 00    	mov    %edx,0x86de64(%eax)
+	strcpy(d->d_name, name);
+  8036ad:	83 ec 08             	sub    $0x8,%esp
+  8036b0:	53                   	push   %ebx
+  8036b1:	05 68 de 86 00       	add    $0x86de68,%eax
+  8036b6:	50                   	push   %eax
+  8036b7:	e8 20 23 00 00       	call   8059dc <strcpy>
+	b = dc_hash(dir, name);
+  8036bc:	89 da                	mov    %ebx,%edx
+  8036be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036c1:	e8 41 fd ff ff       	call   803407 <dc_hash>
+	d->d_hnext = dc_buckets[b];
+  8036c6:	8b 14 85 60 ce 86 00 	mov    0x86ce60(,%eax,4),%edx
+  8036cd:	89 97 88 00 00 00    	mov    %edx,0x88(%edi)
+	dc_buckets[b] = i + 1;
+  8036d3:	8d 56 01             	lea    0x1(%esi),%edx
+  8036d6:	89 14 85 60 ce 86 00 	mov    %edx,0x86ce60(,%eax,4)
+	dc_lru_push(i);
+  8036dd:	89 f0                	mov    %esi,%eax
+  8036df:	e8 dd fd ff ff       	call   8034c1 <dc_lru_push>
+  8036e4:	83 c4 10             	add    $0x10,%esp
+  8036e7:	e9 6e ff ff ff       	jmp    80365a <dcache_enter+0x1a>
+		dc_remove(i);
+  8036ec:	e8 12 fe ff ff       	call   803503 <dc_remove>
+	if (dc_free >= 0) {
+  8036f1:	8b 35 0c a0 80 00    	mov    0x80a00c,%esi
+  8036f7:	85 f6                	test   %esi,%esi
+  8036f9:	79 83                	jns    80367e <dcache_enter+0x3e>
+		i = dc_nused++;
+  8036fb:	8b 35 4c ce 86 00    	mov    0x86ce4c,%esi
+  803701:	8d 46 01             	lea    0x1(%esi),%eax
+  803704:	a3 4c ce 86 00       	mov    %eax,0x86ce4c
+  803709:	eb 84                	jmp    80368f <dcache_enter+0x4f>
+	else if (dc_free < 0 && dc_nused == DCACHE_SIZE) {
+  80370b:	81 3d 4c ce 86 00 00 	cmpl   $0x200,0x86ce4c
+  803712:	02 00 00 
+  803715:	75 e4                	jne    8036fb <dcache_enter+0xbb>
+		dc_remove(dc_tail);
+  803717:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  80371c:	e8 e2 fd ff ff       	call   803503 <dc_remove>
+		dcstats.ds_evictions++;
+  803721:	83 05 48 ce 86 00 01 	addl   $0x1,0x86ce48
+  803728:	eb c7                	jmp    8036f1 <dcache_enter+0xb1>
+
+0080372a <dcache_purge>:
+
+// Forget everything cached about the contents of dir, and about dir
+// itself, e.g. because its entries have moved or are going away.
+void
+dcache_purge(struct File *dir)
+{
+  80372a:	55                   	push   %ebp
+  80372b:	89 e5                	mov    %esp,%ebp
+  80372d:	56                   	push   %esi
+  80372e:	53                   	push   %ebx
+  80372f:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, next;
+
+	for (i = dc_head; i >= 0; i = next) {
+  803732:	a1 14 a0 80 00       	mov    0x80a014,%eax
+  803737:	eb 07                	jmp    803740 <dcache_purge+0x16>
+		next = dc_ents[i].d_next;
+		if (dc_ents[i].d_dir == dir || dc_ents[i].d_file == dir)
+			dc_remove(i);
+  803739:	e8 c5 fd ff ff       	call   803503 <dc_remove>
+{
+  80373e:	89 d8                	mov    %ebx,%eax
+	for (i = dc_head; i >= 0; i = next) {
+  803740:	85 c0                	test   %eax,%eax
+  803742:	78 1e                	js     803762 <dcache_purge+0x38>
+		next = dc_ents[i].d_next;
+  803744:	69 d0 94 00 00 00    	imul   $0x94,%eax,%edx
+  80374a:	8b 9a f0 de 86 00    	mov    0x86def0(%edx),%ebx
+		if (dc_ents[i].d_dir == dir || dc_ents[i].d_file == dir)
+  803750:	39 b2 60 de 86 00    	cmp    %esi,0x86de60(%edx)
+  803756:	74 e1                	je     803739 <dcache_purge+0xf>
+  803758:	39 b2 64 de 86 00    	cmp    %esi,0x86de64(%edx)
+  80375e:	75 de                	jne    80373e <dcache_purge+0x14>
+  803760:	eb d7                	jmp    803739 <dcache_purge+0xf>
+	}
+}
+  803762:	5b                   	pop    %ebx
+  803763:	5e                   	pop    %esi
+  803764:	5d                   	pop    %ebp
+  803765:	c3                   	ret
+
+00803766 <worker_req>:
+// Each worker receives requests at the start of its window below the
+// disk map, and the buffer pages of a bulk request right behind them.
+static union Fsipc *
+worker_req(struct Worker *w)
+{
+	return (union Fsipc *) (FSREQ_VA + (w - workers) * FSREQ_WINDOW);
+  803766:	2d c0 06 88 00       	sub    $0x8806c0,%eax
+  80376b:	c1 f8 03             	sar    $0x3,%eax
+  80376e:	69 c0 00 d0 6e 30    	imul   $0x306ed000,%eax,%eax
+  803774:	05 00 80 df 0f       	add    $0xfdf8000,%eax
+}
+  803779:	c3                   	ret
+
+0080377a <fsdata_check>:
+// Check that the buffer pages received with a bulk request cover
+// [off, off+n) past the worker's request page, and are mapped with
+// permissions perm.
+static int
+fsdata_check(struct Worker *w, size_t off, size_t n, int perm)
+{
+  80377a:	55                   	push   %ebp
+  80377b:	89 e5                	mov    %esp,%ebp
+  80377d:	57                   	push   %edi
+  80377e:	56                   	push   %esi
+  80377f:	53                   	push   %ebx
+  803780:	83 ec 1c             	sub    $0x1c,%esp
+  803783:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	size_t i;
+
+	perm |= PTE_P | PTE_U;
+  803786:	8b 75 08             	mov    0x8(%ebp),%esi
+  803789:	83 ce 05             	or     $0x5,%esi
+	if (off >= PGSIZE || n > FSBULK_MAXPAGES * PGSIZE
+  80378c:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  803792:	77 58                	ja     8037ec <fsdata_check+0x72>
+  803794:	81 f9 00 00 04 00    	cmp    $0x40000,%ecx
+  80379a:	77 50                	ja     8037ec <fsdata_check+0x72>
+	    || off + n > (w->w_npages - 1) * PGSIZE)
+  80379c:	8d 3c 0a             	lea    (%edx,%ecx,1),%edi
+  80379f:	8b 40 10             	mov    0x10(%eax),%eax
+  8037a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8037a5:	83 e8 01             	sub    $0x1,%eax
+  8037a8:	c1 e0 0c             	shl    $0xc,%eax
+  8037ab:	39 f8                	cmp    %edi,%eax
+  8037ad:	72 44                	jb     8037f3 <fsdata_check+0x79>
+		return -E_INVAL;
+	for (i = ROUNDDOWN(off, PGSIZE); i < off + n; i += PGSIZE)
+  8037af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037b4:	39 fb                	cmp    %edi,%ebx
+  8037b6:	73 27                	jae    8037df <fsdata_check+0x65>
+	return (char *) worker_req(w) + PGSIZE;
+  8037b8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8037bb:	e8 a6 ff ff ff       	call   803766 <worker_req>
+  8037c0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		if ((uvpt[PGNUM(worker_data(w) + i)] & perm) != perm)
+  8037c6:	01 d8                	add    %ebx,%eax
+  8037c8:	c1 e8 0c             	shr    $0xc,%eax
+  8037cb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8037d2:	21 f0                	and    %esi,%eax
+  8037d4:	39 c6                	cmp    %eax,%esi
+  8037d6:	74 dc                	je     8037b4 <fsdata_check+0x3a>
+			return -E_INVAL;
+  8037d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037dd:	eb 05                	jmp    8037e4 <fsdata_check+0x6a>
+	return 0;
+  8037df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037e4:	83 c4 1c             	add    $0x1c,%esp
+  8037e7:	5b                   	pop    %ebx
+  8037e8:	5e                   	pop    %esi
+  8037e9:	5f                   	pop    %edi
+  8037ea:	5d                   	pop    %ebp
+  8037eb:	c3                   	ret
+		return -E_INVAL;
+  8037ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037f1:	eb f1                	jmp    8037e4 <fsdata_check+0x6a>
+  8037f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037f8:	eb ea                	jmp    8037e4 <fsdata_check+0x6a>
+
+008037fa <serve_bcstats>:
+}
+
+// Return the block cache's statistics in ipc->bcstatsRet.
+int
+serve_bcstats(envid_t envid, union Fsipc *ipc)
+{
+  8037fa:	55                   	push   %ebp
+  8037fb:	89 e5                	mov    %esp,%ebp
+  8037fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	ipc->bcstatsRet = bcstats;
+  803800:	8b 15 00 60 82 00    	mov    0x826000,%edx
+  803806:	89 10                	mov    %edx,(%eax)
+  803808:	8b 15 04 60 82 00    	mov    0x826004,%edx
+  80380e:	89 50 04             	mov    %edx,0x4(%eax)
+  803811:	8b 15 08 60 82 00    	mov    0x826008,%edx
+  803817:	89 50 08             	mov    %edx,0x8(%eax)
+  80381a:	8b 15 0c 60 82 00    	mov    0x82600c,%edx
+  803820:	89 50 0c             	mov    %edx,0xc(%eax)
+  803823:	8b 15 10 60 82 00    	mov    0x826010,%edx
+  803829:	89 50 10             	mov    %edx,0x10(%eax)
+  80382c:	8b 15 14 60 82 00    	mov    0x826014,%edx
+  803832:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+}
+  803835:	b8 00 00 00 00       	mov    $0x0,%eax
+  80383a:	5d                   	pop    %ebp
+  80383b:	c3                   	ret
+
+0080383c <serve_remove>:
+{
+  80383c:	55                   	push   %ebp
+  80383d:	89 e5                	mov    %esp,%ebp
+  80383f:	53                   	push   %ebx
+  803840:	81 ec 08 04 00 00    	sub    $0x408,%esp
+	memmove(path, req->req_path, MAXPATHLEN);
+  803846:	68 00 04 00 00       	push   $0x400
+  80384b:	ff 75 0c             	push   0xc(%ebp)
+  80384e:	8d 9d f8 fb ff ff    	lea    -0x408(%ebp),%ebx
+  803854:	53                   	push   %ebx
+  803855:	e8 08 23 00 00       	call   805b62 <memmove>
+	path[MAXPATHLEN-1] = 0;
+  80385a:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+	return file_remove(path);
+  80385e:	89 1c 24             	mov    %ebx,(%esp)
+  803861:	e8 cc f5 ff ff       	call   802e32 <file_remove>
+}
+  803866:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803869:	c9                   	leave
+  80386a:	c3                   	ret
+
+0080386b <serve_sync>:
+{
+  80386b:	55                   	push   %ebp
+  80386c:	89 e5                	mov    %esp,%ebp
+  80386e:	83 ec 08             	sub    $0x8,%esp
+	fs_sync();
+  803871:	e8 5e f7 ff ff       	call   802fd4 <fs_sync>
+}
+  803876:	b8 00 00 00 00       	mov    $0x0,%eax
+  80387b:	c9                   	leave
+  80387c:	c3                   	ret
+
+0080387d <serve_defrag>:
+{
+  80387d:	55                   	push   %ebp
+  80387e:	89 e5                	mov    %esp,%ebp
+  803880:	56                   	push   %esi
+  803881:	53                   	push   %ebx
+  803882:	81 ec 14 04 00 00    	sub    $0x414,%esp
+  803888:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	memmove(path, ipc->defrag.req_path, MAXPATHLEN);
+  80388b:	68 00 04 00 00       	push   $0x400
+  803890:	53                   	push   %ebx
+  803891:	8d b5 f8 fb ff ff    	lea    -0x408(%ebp),%esi
+  803897:	56                   	push   %esi
+  803898:	e8 c5 22 00 00       	call   805b62 <memmove>
+	path[MAXPATHLEN-1] = 0;
+  80389d:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+	if ((r = file_open(path, &f)) < 0)
+  8038a1:	83 c4 08             	add    $0x8,%esp
+  8038a4:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  8038aa:	50                   	push   %eax
+  8038ab:	56                   	push   %esi
+  8038ac:	e8 54 ee ff ff       	call   802705 <file_open>
+  8038b1:	83 c4 10             	add    $0x10,%esp
+  8038b4:	85 c0                	test   %eax,%eax
+  8038b6:	78 5e                	js     803916 <serve_defrag+0x99>
+	if ((r = file_commit(f)) < 0 || (r = file_extents(f)) < 0)
+  8038b8:	83 ec 0c             	sub    $0xc,%esp
+  8038bb:	ff b5 f4 fb ff ff    	push   -0x40c(%ebp)
+  8038c1:	e8 ce e5 ff ff       	call   801e94 <file_commit>
+  8038c6:	83 c4 10             	add    $0x10,%esp
+  8038c9:	85 c0                	test   %eax,%eax
+  8038cb:	78 49                	js     803916 <serve_defrag+0x99>
+  8038cd:	83 ec 0c             	sub    $0xc,%esp
+  8038d0:	ff b5 f4 fb ff ff    	push   -0x40c(%ebp)
+  8038d6:	e8 a0 f7 ff ff       	call   80307b <file_extents>
+  8038db:	83 c4 10             	add    $0x10,%esp
+  8038de:	85 c0                	test   %eax,%eax
+  8038e0:	78 34                	js     803916 <serve_defrag+0x99>
+	ipc->defragRet.ret_before = r;
+  8038e2:	89 03                	mov    %eax,(%ebx)
+	if ((r = file_repack(f)) < 0 || (r = file_extents(f)) < 0)
+  8038e4:	83 ec 0c             	sub    $0xc,%esp
+  8038e7:	ff b5 f4 fb ff ff    	push   -0x40c(%ebp)
+  8038ed:	e8 2f f8 ff ff       	call   803121 <file_repack>
+  8038f2:	83 c4 10             	add    $0x10,%esp
+  8038f5:	85 c0                	test   %eax,%eax
+  8038f7:	78 1d                	js     803916 <serve_defrag+0x99>
+  8038f9:	83 ec 0c             	sub    $0xc,%esp
+  8038fc:	ff b5 f4 fb ff ff    	push   -0x40c(%ebp)
+  803902:	e8 74 f7 ff ff       	call   80307b <file_extents>
+  803907:	83 c4 10             	add    $0x10,%esp
+  80390a:	85 c0                	test   %eax,%eax
+  80390c:	78 08                	js     803916 <serve_defrag+0x99>
+	ipc->defragRet.ret_after = r;
+  80390e:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  803911:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803916:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803919:	5b                   	pop    %ebx
+  80391a:	5e                   	pop    %esi
+  80391b:	5d                   	pop    %ebp
+  80391c:	c3                   	ret
+
+0080391d <serve_ring_setup>:
+{
+  80391d:	55                   	push   %ebp
+  80391e:	89 e5                	mov    %esp,%ebp
+  803920:	57                   	push   %edi
+  803921:	56                   	push   %esi
+  803922:	53                   	push   %ebx
+  803923:	83 ec 1c             	sub    $0x1c,%esp
+  803926:	8b 7d 08             	mov    0x8(%ebp),%edi
+	return &workers[thread_current() - 1];
+  803929:	e8 8d 13 00 00       	call   804cbb <thread_current>
+  80392e:	83 e8 01             	sub    $0x1,%eax
+  803931:	69 c0 28 01 00 00    	imul   $0x128,%eax,%eax
+  803937:	8d b0 c0 06 88 00    	lea    0x8806c0(%eax),%esi
+  80393d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+	if (w->w_npages != 1 + FSRING_NPAGES
+  803940:	83 b8 d0 06 88 00 12 	cmpl   $0x12,0x8806d0(%eax)
+  803947:	0f 85 ea 00 00 00    	jne    803a37 <serve_ring_setup+0x11a>
+	    || (r = fsdata_check(w, 0, FSRING_NPAGES * PGSIZE, PTE_W)) < 0)
+  80394d:	83 ec 0c             	sub    $0xc,%esp
+  803950:	6a 02                	push   $0x2
+  803952:	b9 00 10 01 00       	mov    $0x11000,%ecx
+  803957:	ba 00 00 00 00       	mov    $0x0,%edx
+  80395c:	89 f0                	mov    %esi,%eax
+  80395e:	e8 17 fe ff ff       	call   80377a <fsdata_check>
+  803963:	83 c4 10             	add    $0x10,%esp
+  803966:	85 c0                	test   %eax,%eax
+  803968:	0f 88 d0 00 00 00    	js     803a3e <serve_ring_setup+0x121>
+	for (i = 0; i < FS_MAXRINGS; i++)
+  80396e:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (ring_owners[i] == envid)
+  803973:	39 3c 95 60 06 88 00 	cmp    %edi,0x880660(,%edx,4)
+  80397a:	74 52                	je     8039ce <serve_ring_setup+0xb1>
+	for (i = 0; i < FS_MAXRINGS; i++)
+  80397c:	83 c2 01             	add    $0x1,%edx
+  80397f:	83 fa 10             	cmp    $0x10,%edx
+  803982:	75 ef                	jne    803973 <serve_ring_setup+0x56>
+  803984:	ba 00 00 00 00       	mov    $0x0,%edx
+  803989:	eb 15                	jmp    8039a0 <serve_ring_setup+0x83>
+	return e->env_id != ring_owners[i] || e->env_status == ENV_FREE;
+  80398b:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803991:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803996:	8b 40 54             	mov    0x54(%eax),%eax
+			if (ring_owners[i] == 0 || ring_abandoned(i))
+  803999:	85 c0                	test   %eax,%eax
+  80399b:	74 31                	je     8039ce <serve_ring_setup+0xb1>
+		for (i = 0; i < FS_MAXRINGS; i++)
+  80399d:	83 c2 01             	add    $0x1,%edx
+  8039a0:	83 fa 10             	cmp    $0x10,%edx
+  8039a3:	0f 84 87 00 00 00    	je     803a30 <serve_ring_setup+0x113>
+			if (ring_owners[i] == 0 || ring_abandoned(i))
+  8039a9:	8b 0c 95 60 06 88 00 	mov    0x880660(,%edx,4),%ecx
+  8039b0:	85 c9                	test   %ecx,%ecx
+  8039b2:	74 1a                	je     8039ce <serve_ring_setup+0xb1>
+	const volatile struct Env *e = &envs[ENVX(ring_owners[i])];
+  8039b4:	89 c8                	mov    %ecx,%eax
+  8039b6:	25 ff 03 00 00       	and    $0x3ff,%eax
+	return e->env_id != ring_owners[i] || e->env_status == ENV_FREE;
+  8039bb:	69 d8 8c 00 00 00    	imul   $0x8c,%eax,%ebx
+  8039c1:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8039c7:	8b 5b 48             	mov    0x48(%ebx),%ebx
+  8039ca:	39 d9                	cmp    %ebx,%ecx
+  8039cc:	74 bd                	je     80398b <serve_ring_setup+0x6e>
+	return (struct Fsring *) (FSRINGS_VA + i * FSRING_NPAGES * PGSIZE);
+  8039ce:	69 f2 00 10 01 00    	imul   $0x11000,%edx,%esi
+  8039d4:	bb 00 10 00 00       	mov    $0x1000,%ebx
+		if ((r = sys_page_map(0, worker_data(w) + p * PGSIZE,
+  8039d9:	81 c6 00 70 bc 0f    	add    $0xfbc7000,%esi
+  8039df:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8039e2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8039e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	return (char *) worker_req(w) + PGSIZE;
+  8039e8:	89 f8                	mov    %edi,%eax
+  8039ea:	e8 77 fd ff ff       	call   803766 <worker_req>
+		if ((r = sys_page_map(0, worker_data(w) + p * PGSIZE,
+  8039ef:	83 ec 0c             	sub    $0xc,%esp
+  8039f2:	6a 07                	push   $0x7
+  8039f4:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+  8039f7:	52                   	push   %edx
+  8039f8:	6a 00                	push   $0x0
+  8039fa:	01 d8                	add    %ebx,%eax
+  8039fc:	50                   	push   %eax
+  8039fd:	6a 00                	push   $0x0
+  8039ff:	e8 2f 24 00 00       	call   805e33 <sys_page_map>
+  803a04:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803a0a:	83 c4 20             	add    $0x20,%esp
+  803a0d:	85 c0                	test   %eax,%eax
+  803a0f:	78 17                	js     803a28 <serve_ring_setup+0x10b>
+	for (p = 0; p < FSRING_NPAGES; p++)
+  803a11:	81 fb 00 20 01 00    	cmp    $0x12000,%ebx
+  803a17:	75 cf                	jne    8039e8 <serve_ring_setup+0xcb>
+	ring_owners[i] = envid;
+  803a19:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803a1c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803a1f:	89 3c 95 60 06 88 00 	mov    %edi,0x880660(,%edx,4)
+	return i;
+  803a26:	89 d0                	mov    %edx,%eax
+}
+  803a28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a2b:	5b                   	pop    %ebx
+  803a2c:	5e                   	pop    %esi
+  803a2d:	5f                   	pop    %edi
+  803a2e:	5d                   	pop    %ebp
+  803a2f:	c3                   	ret
+		return -E_MAX_OPEN;
+  803a30:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  803a35:	eb f1                	jmp    803a28 <serve_ring_setup+0x10b>
+		return -E_INVAL;
+  803a37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a3c:	eb ea                	jmp    803a28 <serve_ring_setup+0x10b>
+  803a3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a43:	eb e3                	jmp    803a28 <serve_ring_setup+0x10b>
+
+00803a45 <serve_slurp>:
+{
+  803a45:	55                   	push   %ebp
+  803a46:	89 e5                	mov    %esp,%ebp
+  803a48:	57                   	push   %edi
+  803a49:	56                   	push   %esi
+  803a4a:	53                   	push   %ebx
+  803a4b:	81 ec 2c 04 00 00    	sub    $0x42c,%esp
+  803a51:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return &workers[thread_current() - 1];
+  803a54:	e8 62 12 00 00       	call   804cbb <thread_current>
+  803a59:	8d 70 ff             	lea    -0x1(%eax),%esi
+	memmove(path, req->req_path, MAXPATHLEN);
+  803a5c:	83 ec 04             	sub    $0x4,%esp
+  803a5f:	68 00 04 00 00       	push   $0x400
+  803a64:	53                   	push   %ebx
+  803a65:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  803a6b:	50                   	push   %eax
+  803a6c:	e8 f1 20 00 00       	call   805b62 <memmove>
+	path[MAXPATHLEN-1] = 0;
+  803a71:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+	n = req->req_n;
+  803a75:	8b bb 00 04 00 00    	mov    0x400(%ebx),%edi
+	off = req->req_off;
+  803a7b:	8b 93 04 04 00 00    	mov    0x404(%ebx),%edx
+	if (w->w_npages > 1) {
+  803a81:	69 c6 28 01 00 00    	imul   $0x128,%esi,%eax
+  803a87:	83 c4 10             	add    $0x10,%esp
+  803a8a:	83 b8 d0 06 88 00 01 	cmpl   $0x1,0x8806d0(%eax)
+  803a91:	7f 57                	jg     803aea <serve_slurp+0xa5>
+		n = MIN(n, sizeof(ret->ret_buf));
+  803a93:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+  803a98:	39 c7                	cmp    %eax,%edi
+  803a9a:	0f 47 f8             	cmova  %eax,%edi
+		buf = ret->ret_buf;
+  803a9d:	8d 73 08             	lea    0x8(%ebx),%esi
+	if ((r = file_open(path, &f)) < 0)
+  803aa0:	83 ec 08             	sub    $0x8,%esp
+  803aa3:	8d 85 e4 fb ff ff    	lea    -0x41c(%ebp),%eax
+  803aa9:	50                   	push   %eax
+  803aaa:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  803ab0:	50                   	push   %eax
+  803ab1:	e8 4f ec ff ff       	call   802705 <file_open>
+  803ab6:	83 c4 10             	add    $0x10,%esp
+  803ab9:	85 c0                	test   %eax,%eax
+  803abb:	78 25                	js     803ae2 <serve_slurp+0x9d>
+	ret->ret_size = f->f_size;
+  803abd:	8b 95 e4 fb ff ff    	mov    -0x41c(%ebp),%edx
+  803ac3:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  803ac9:	89 03                	mov    %eax,(%ebx)
+		return 0;
+  803acb:	b8 00 00 00 00       	mov    $0x0,%eax
+	ret->ret_isdir = (f->f_type == FTYPE_DIR);
+  803ad0:	83 ba 84 00 00 00 01 	cmpl   $0x1,0x84(%edx)
+  803ad7:	0f 94 c1             	sete   %cl
+  803ada:	0f b6 c9             	movzbl %cl,%ecx
+  803add:	89 4b 04             	mov    %ecx,0x4(%ebx)
+	if (ret->ret_isdir)
+  803ae0:	75 44                	jne    803b26 <serve_slurp+0xe1>
+}
+  803ae2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ae5:	5b                   	pop    %ebx
+  803ae6:	5e                   	pop    %esi
+  803ae7:	5f                   	pop    %edi
+  803ae8:	5d                   	pop    %ebp
+  803ae9:	c3                   	ret
+	return &workers[thread_current() - 1];
+  803aea:	89 c6                	mov    %eax,%esi
+  803aec:	81 c6 c0 06 88 00    	add    $0x8806c0,%esi
+		if ((r = fsdata_check(w, off, n, PTE_W)) < 0)
+  803af2:	83 ec 0c             	sub    $0xc,%esp
+  803af5:	6a 02                	push   $0x2
+  803af7:	89 f9                	mov    %edi,%ecx
+  803af9:	89 95 d4 fb ff ff    	mov    %edx,-0x42c(%ebp)
+  803aff:	89 f0                	mov    %esi,%eax
+  803b01:	e8 74 fc ff ff       	call   80377a <fsdata_check>
+  803b06:	83 c4 10             	add    $0x10,%esp
+  803b09:	85 c0                	test   %eax,%eax
+  803b0b:	78 d5                	js     803ae2 <serve_slurp+0x9d>
+	return (char *) worker_req(w) + PGSIZE;
+  803b0d:	89 f0                	mov    %esi,%eax
+  803b0f:	e8 52 fc ff ff       	call   803766 <worker_req>
+		buf = worker_data(w) + off;
+  803b14:	8b 95 d4 fb ff ff    	mov    -0x42c(%ebp),%edx
+  803b1a:	8d b4 02 00 10 00 00 	lea    0x1000(%edx,%eax,1),%esi
+  803b21:	e9 7a ff ff ff       	jmp    803aa0 <serve_slurp+0x5b>
+	return file_read(f, buf, n, 0);
+  803b26:	6a 00                	push   $0x0
+  803b28:	57                   	push   %edi
+  803b29:	56                   	push   %esi
+  803b2a:	52                   	push   %edx
+  803b2b:	e8 ef eb ff ff       	call   80271f <file_read>
+  803b30:	83 c4 10             	add    $0x10,%esp
+  803b33:	eb ad                	jmp    803ae2 <serve_slurp+0x9d>
+
+00803b35 <serve_init>:
+	for (i = 0; i < MAXOPEN; i++) {
+  803b35:	ba 80 a0 80 00       	mov    $0x80a080,%edx
+	uintptr_t va = FILEVA;
+  803b3a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	for (i = 0; i < MAXOPEN; i++) {
+  803b3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		opentab[i].o_fileid = i;
+  803b44:	89 0a                	mov    %ecx,(%edx)
+		opentab[i].o_fd = (struct Fd*) va;
+  803b46:	89 42 0c             	mov    %eax,0xc(%edx)
+		va += PGSIZE;
+  803b49:	05 00 10 00 00       	add    $0x1000,%eax
+	for (i = 0; i < MAXOPEN; i++) {
+  803b4e:	83 c1 01             	add    $0x1,%ecx
+  803b51:	83 c2 6c             	add    $0x6c,%edx
+  803b54:	3d 00 00 40 d0       	cmp    $0xd0400000,%eax
+  803b59:	75 e9                	jne    803b44 <serve_init+0xf>
+}
+  803b5b:	c3                   	ret
+
+00803b5c <openfile_alloc>:
+{
+  803b5c:	55                   	push   %ebp
+  803b5d:	89 e5                	mov    %esp,%ebp
+  803b5f:	57                   	push   %edi
+  803b60:	56                   	push   %esi
+  803b61:	53                   	push   %ebx
+  803b62:	83 ec 0c             	sub    $0xc,%esp
+  803b65:	8b 75 08             	mov    0x8(%ebp),%esi
+	for (i = 0; i < MAXOPEN; i++) {
+  803b68:	bf 90 a0 80 00       	mov    $0x80a090,%edi
+  803b6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b72:	eb 2c                	jmp    803ba0 <openfile_alloc+0x44>
+			if ((r = sys_page_alloc(0, opentab[i].o_fd, PTE_P|PTE_U|PTE_W)) < 0)
+  803b74:	83 ec 04             	sub    $0x4,%esp
+  803b77:	6a 07                	push   $0x7
+  803b79:	6b c3 6c             	imul   $0x6c,%ebx,%eax
+  803b7c:	ff b0 8c a0 80 00    	push   0x80a08c(%eax)
+  803b82:	6a 00                	push   $0x0
+  803b84:	e8 5f 22 00 00       	call   805de8 <sys_page_alloc>
+  803b89:	83 c4 10             	add    $0x10,%esp
+  803b8c:	85 c0                	test   %eax,%eax
+  803b8e:	79 37                	jns    803bc7 <openfile_alloc+0x6b>
+  803b90:	eb 66                	jmp    803bf8 <openfile_alloc+0x9c>
+	for (i = 0; i < MAXOPEN; i++) {
+  803b92:	83 c3 01             	add    $0x1,%ebx
+  803b95:	83 c7 6c             	add    $0x6c,%edi
+  803b98:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  803b9e:	74 60                	je     803c00 <openfile_alloc+0xa4>
+		if (lock_busy(&opentab[i].o_lock))
+  803ba0:	83 ec 0c             	sub    $0xc,%esp
+  803ba3:	57                   	push   %edi
+  803ba4:	e8 a5 11 00 00       	call   804d4e <lock_busy>
+  803ba9:	83 c4 10             	add    $0x10,%esp
+  803bac:	84 c0                	test   %al,%al
+  803bae:	75 e2                	jne    803b92 <openfile_alloc+0x36>
+		switch (pageref(opentab[i].o_fd)) {
+  803bb0:	83 ec 0c             	sub    $0xc,%esp
+  803bb3:	ff 77 fc             	push   -0x4(%edi)
+  803bb6:	e8 3f 3f 00 00       	call   807afa <pageref>
+  803bbb:	83 c4 10             	add    $0x10,%esp
+  803bbe:	85 c0                	test   %eax,%eax
+  803bc0:	74 b2                	je     803b74 <openfile_alloc+0x18>
+  803bc2:	83 f8 01             	cmp    $0x1,%eax
+  803bc5:	75 cb                	jne    803b92 <openfile_alloc+0x36>
+			opentab[i].o_fileid += MAXOPEN;
+  803bc7:	6b db 6c             	imul   $0x6c,%ebx,%ebx
+  803bca:	8d 83 80 a0 80 00    	lea    0x80a080(%ebx),%eax
+  803bd0:	81 83 80 a0 80 00 00 	addl   $0x400,0x80a080(%ebx)
+  803bd7:	04 00 00 
+			*o = &opentab[i];
+  803bda:	89 06                	mov    %eax,(%esi)
+			memset(opentab[i].o_fd, 0, PGSIZE);
+  803bdc:	83 ec 04             	sub    $0x4,%esp
+  803bdf:	68 00 10 00 00       	push   $0x1000
+  803be4:	6a 00                	push   $0x0
+  803be6:	ff b3 8c a0 80 00    	push   0x80a08c(%ebx)
+  803bec:	e8 3c 1f 00 00       	call   805b2d <memset>
+			return (*o)->o_fileid;
+  803bf1:	8b 06                	mov    (%esi),%eax
+  803bf3:	8b 00                	mov    (%eax),%eax
+  803bf5:	83 c4 10             	add    $0x10,%esp
+}
+  803bf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bfb:	5b                   	pop    %ebx
+  803bfc:	5e                   	pop    %esi
+  803bfd:	5f                   	pop    %edi
+  803bfe:	5d                   	pop    %ebp
+  803bff:	c3                   	ret
+	return -E_MAX_OPEN;
+  803c00:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  803c05:	eb f1                	jmp    803bf8 <openfile_alloc+0x9c>
+
+00803c07 <openfile_lookup>:
+{
+  803c07:	55                   	push   %ebp
+  803c08:	89 e5                	mov    %esp,%ebp
+  803c0a:	57                   	push   %edi
+  803c0b:	56                   	push   %esi
+  803c0c:	53                   	push   %ebx
+  803c0d:	83 ec 18             	sub    $0x18,%esp
+  803c10:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	o = &opentab[fileid % MAXOPEN];
+  803c13:	89 fb                	mov    %edi,%ebx
+  803c15:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  803c1b:	6b f3 6c             	imul   $0x6c,%ebx,%esi
+	if (pageref(o->o_fd) <= 1 || o->o_fileid != fileid)
+  803c1e:	ff b6 8c a0 80 00    	push   0x80a08c(%esi)
+	o = &opentab[fileid % MAXOPEN];
+  803c24:	81 c6 80 a0 80 00    	add    $0x80a080,%esi
+	if (pageref(o->o_fd) <= 1 || o->o_fileid != fileid)
+  803c2a:	e8 cb 3e 00 00       	call   807afa <pageref>
+  803c2f:	83 c4 10             	add    $0x10,%esp
+  803c32:	83 f8 01             	cmp    $0x1,%eax
+  803c35:	7e 1d                	jle    803c54 <openfile_lookup+0x4d>
+  803c37:	6b db 6c             	imul   $0x6c,%ebx,%ebx
+  803c3a:	39 bb 80 a0 80 00    	cmp    %edi,0x80a080(%ebx)
+  803c40:	75 19                	jne    803c5b <openfile_lookup+0x54>
+	*po = o;
+  803c42:	8b 45 10             	mov    0x10(%ebp),%eax
+  803c45:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803c47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c4f:	5b                   	pop    %ebx
+  803c50:	5e                   	pop    %esi
+  803c51:	5f                   	pop    %edi
+  803c52:	5d                   	pop    %ebp
+  803c53:	c3                   	ret
+		return -E_INVAL;
+  803c54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c59:	eb f1                	jmp    803c4c <openfile_lookup+0x45>
+  803c5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c60:	eb ea                	jmp    803c4c <openfile_lookup+0x45>
+
+00803c62 <serve_set_size>:
+{
+  803c62:	55                   	push   %ebp
+  803c63:	89 e5                	mov    %esp,%ebp
+  803c65:	53                   	push   %ebx
+  803c66:	83 ec 18             	sub    $0x18,%esp
+  803c69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  803c6c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c6f:	50                   	push   %eax
+  803c70:	ff 33                	push   (%ebx)
+  803c72:	ff 75 08             	push   0x8(%ebp)
+  803c75:	e8 8d ff ff ff       	call   803c07 <openfile_lookup>
+  803c7a:	83 c4 10             	add    $0x10,%esp
+  803c7d:	85 c0                	test   %eax,%eax
+  803c7f:	78 14                	js     803c95 <serve_set_size+0x33>
+	return file_set_size(o->o_file, req->req_size);
+  803c81:	83 ec 08             	sub    $0x8,%esp
+  803c84:	ff 73 04             	push   0x4(%ebx)
+  803c87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c8a:	ff 70 04             	push   0x4(%eax)
+  803c8d:	e8 55 eb ff ff       	call   8027e7 <file_set_size>
+  803c92:	83 c4 10             	add    $0x10,%esp
+}
+  803c95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c98:	c9                   	leave
+  803c99:	c3                   	ret
+
+00803c9a <serve_read>:
+{
+  803c9a:	55                   	push   %ebp
+  803c9b:	89 e5                	mov    %esp,%ebp
+  803c9d:	56                   	push   %esi
+  803c9e:	53                   	push   %ebx
+  803c9f:	83 ec 14             	sub    $0x14,%esp
+  803ca2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  803ca5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ca8:	50                   	push   %eax
+  803ca9:	ff 33                	push   (%ebx)
+  803cab:	ff 75 08             	push   0x8(%ebp)
+  803cae:	e8 54 ff ff ff       	call   803c07 <openfile_lookup>
+  803cb3:	83 c4 10             	add    $0x10,%esp
+  803cb6:	85 c0                	test   %eax,%eax
+  803cb8:	78 2d                	js     803ce7 <serve_read+0x4d>
+		      o->o_fd->fd_offset);
+  803cba:	8b 75 f4             	mov    -0xc(%ebp),%esi
+	r = file_read(o->o_file, ret->ret_buf, MIN(req->req_n, PGSIZE),
+  803cbd:	8b 46 0c             	mov    0xc(%esi),%eax
+  803cc0:	ff 70 04             	push   0x4(%eax)
+  803cc3:	8b 43 04             	mov    0x4(%ebx),%eax
+  803cc6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ccb:	39 d0                	cmp    %edx,%eax
+  803ccd:	0f 47 c2             	cmova  %edx,%eax
+  803cd0:	50                   	push   %eax
+  803cd1:	53                   	push   %ebx
+  803cd2:	ff 76 04             	push   0x4(%esi)
+  803cd5:	e8 45 ea ff ff       	call   80271f <file_read>
+	if (r > 0)
+  803cda:	83 c4 10             	add    $0x10,%esp
+  803cdd:	85 c0                	test   %eax,%eax
+  803cdf:	7e 06                	jle    803ce7 <serve_read+0x4d>
+		o->o_fd->fd_offset += r;
+  803ce1:	8b 56 0c             	mov    0xc(%esi),%edx
+  803ce4:	01 42 04             	add    %eax,0x4(%edx)
+}
+  803ce7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803cea:	5b                   	pop    %ebx
+  803ceb:	5e                   	pop    %esi
+  803cec:	5d                   	pop    %ebp
+  803ced:	c3                   	ret
+
+00803cee <serve_write>:
+{
+  803cee:	55                   	push   %ebp
+  803cef:	89 e5                	mov    %esp,%ebp
+  803cf1:	56                   	push   %esi
+  803cf2:	53                   	push   %ebx
+  803cf3:	83 ec 14             	sub    $0x14,%esp
+  803cf6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  803cf9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803cfc:	50                   	push   %eax
+  803cfd:	ff 33                	push   (%ebx)
+  803cff:	ff 75 08             	push   0x8(%ebp)
+  803d02:	e8 00 ff ff ff       	call   803c07 <openfile_lookup>
+  803d07:	83 c4 10             	add    $0x10,%esp
+  803d0a:	85 c0                	test   %eax,%eax
+  803d0c:	78 25                	js     803d33 <serve_write+0x45>
+	r = file_write(o->o_file, req->req_buf, req->req_n, o->o_fd->fd_offset);
+  803d0e:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  803d11:	8b 46 0c             	mov    0xc(%esi),%eax
+  803d14:	ff 70 04             	push   0x4(%eax)
+  803d17:	ff 73 04             	push   0x4(%ebx)
+  803d1a:	83 c3 08             	add    $0x8,%ebx
+  803d1d:	53                   	push   %ebx
+  803d1e:	ff 76 04             	push   0x4(%esi)
+  803d21:	e8 0c eb ff ff       	call   802832 <file_write>
+	if (r > 0)
+  803d26:	83 c4 10             	add    $0x10,%esp
+  803d29:	85 c0                	test   %eax,%eax
+  803d2b:	7e 06                	jle    803d33 <serve_write+0x45>
+		o->o_fd->fd_offset += r;
+  803d2d:	8b 56 0c             	mov    0xc(%esi),%edx
+  803d30:	01 42 04             	add    %eax,0x4(%edx)
+}
+  803d33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d36:	5b                   	pop    %ebx
+  803d37:	5e                   	pop    %esi
+  803d38:	5d                   	pop    %ebp
+  803d39:	c3                   	ret
+
+00803d3a <serve_read_bulk>:
+{
+  803d3a:	55                   	push   %ebp
+  803d3b:	89 e5                	mov    %esp,%ebp
+  803d3d:	57                   	push   %edi
+  803d3e:	56                   	push   %esi
+  803d3f:	53                   	push   %ebx
+  803d40:	83 ec 2c             	sub    $0x2c,%esp
+  803d43:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return &workers[thread_current() - 1];
+  803d46:	e8 70 0f 00 00       	call   804cbb <thread_current>
+  803d4b:	89 c6                	mov    %eax,%esi
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  803d4d:	83 ec 04             	sub    $0x4,%esp
+  803d50:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803d53:	50                   	push   %eax
+  803d54:	ff 33                	push   (%ebx)
+  803d56:	ff 75 08             	push   0x8(%ebp)
+  803d59:	e8 a9 fe ff ff       	call   803c07 <openfile_lookup>
+  803d5e:	83 c4 10             	add    $0x10,%esp
+  803d61:	85 c0                	test   %eax,%eax
+  803d63:	78 62                	js     803dc7 <serve_read_bulk+0x8d>
+	return &workers[thread_current() - 1];
+  803d65:	83 ee 01             	sub    $0x1,%esi
+  803d68:	69 f6 28 01 00 00    	imul   $0x128,%esi,%esi
+  803d6e:	8d 86 c0 06 88 00    	lea    0x8806c0(%esi),%eax
+	if ((r = fsdata_check(w, req->req_off, req->req_n, PTE_W)) < 0)
+  803d74:	8b 73 04             	mov    0x4(%ebx),%esi
+  803d77:	8b 5b 08             	mov    0x8(%ebx),%ebx
+  803d7a:	83 ec 0c             	sub    $0xc,%esp
+  803d7d:	6a 02                	push   $0x2
+  803d7f:	89 f1                	mov    %esi,%ecx
+  803d81:	89 da                	mov    %ebx,%edx
+  803d83:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803d86:	e8 ef f9 ff ff       	call   80377a <fsdata_check>
+  803d8b:	83 c4 10             	add    $0x10,%esp
+  803d8e:	85 c0                	test   %eax,%eax
+  803d90:	78 35                	js     803dc7 <serve_read_bulk+0x8d>
+		      o->o_fd->fd_offset);
+  803d92:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	r = file_read(o->o_file, worker_data(w) + req->req_off, req->req_n,
+  803d95:	8b 47 0c             	mov    0xc(%edi),%eax
+  803d98:	8b 48 04             	mov    0x4(%eax),%ecx
+  803d9b:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+	return (char *) worker_req(w) + PGSIZE;
+  803d9e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803da1:	e8 c0 f9 ff ff       	call   803766 <worker_req>
+	r = file_read(o->o_file, worker_data(w) + req->req_off, req->req_n,
+  803da6:	ff 75 d0             	push   -0x30(%ebp)
+  803da9:	56                   	push   %esi
+  803daa:	8d 84 03 00 10 00 00 	lea    0x1000(%ebx,%eax,1),%eax
+  803db1:	50                   	push   %eax
+  803db2:	ff 77 04             	push   0x4(%edi)
+  803db5:	e8 65 e9 ff ff       	call   80271f <file_read>
+	if (r > 0)
+  803dba:	83 c4 10             	add    $0x10,%esp
+  803dbd:	85 c0                	test   %eax,%eax
+  803dbf:	7e 06                	jle    803dc7 <serve_read_bulk+0x8d>
+		o->o_fd->fd_offset += r;
+  803dc1:	8b 57 0c             	mov    0xc(%edi),%edx
+  803dc4:	01 42 04             	add    %eax,0x4(%edx)
+}
+  803dc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dca:	5b                   	pop    %ebx
+  803dcb:	5e                   	pop    %esi
+  803dcc:	5f                   	pop    %edi
+  803dcd:	5d                   	pop    %ebp
+  803dce:	c3                   	ret
+
+00803dcf <serve_write_bulk>:
+{
+  803dcf:	55                   	push   %ebp
+  803dd0:	89 e5                	mov    %esp,%ebp
+  803dd2:	57                   	push   %edi
+  803dd3:	56                   	push   %esi
+  803dd4:	53                   	push   %ebx
+  803dd5:	83 ec 2c             	sub    $0x2c,%esp
+  803dd8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return &workers[thread_current() - 1];
+  803ddb:	e8 db 0e 00 00       	call   804cbb <thread_current>
+  803de0:	89 c6                	mov    %eax,%esi
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  803de2:	83 ec 04             	sub    $0x4,%esp
+  803de5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803de8:	50                   	push   %eax
+  803de9:	ff 33                	push   (%ebx)
+  803deb:	ff 75 08             	push   0x8(%ebp)
+  803dee:	e8 14 fe ff ff       	call   803c07 <openfile_lookup>
+  803df3:	83 c4 10             	add    $0x10,%esp
+  803df6:	85 c0                	test   %eax,%eax
+  803df8:	78 62                	js     803e5c <serve_write_bulk+0x8d>
+	return &workers[thread_current() - 1];
+  803dfa:	83 ee 01             	sub    $0x1,%esi
+  803dfd:	69 f6 28 01 00 00    	imul   $0x128,%esi,%esi
+  803e03:	8d 86 c0 06 88 00    	lea    0x8806c0(%esi),%eax
+	if ((r = fsdata_check(w, req->req_off, req->req_n, 0)) < 0)
+  803e09:	8b 73 04             	mov    0x4(%ebx),%esi
+  803e0c:	8b 5b 08             	mov    0x8(%ebx),%ebx
+  803e0f:	83 ec 0c             	sub    $0xc,%esp
+  803e12:	6a 00                	push   $0x0
+  803e14:	89 f1                	mov    %esi,%ecx
+  803e16:	89 da                	mov    %ebx,%edx
+  803e18:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803e1b:	e8 5a f9 ff ff       	call   80377a <fsdata_check>
+  803e20:	83 c4 10             	add    $0x10,%esp
+  803e23:	85 c0                	test   %eax,%eax
+  803e25:	78 35                	js     803e5c <serve_write_bulk+0x8d>
+		       o->o_fd->fd_offset);
+  803e27:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+	r = file_write(o->o_file, worker_data(w) + req->req_off, req->req_n,
+  803e2a:	8b 47 0c             	mov    0xc(%edi),%eax
+  803e2d:	8b 48 04             	mov    0x4(%eax),%ecx
+  803e30:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+	return (char *) worker_req(w) + PGSIZE;
+  803e33:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803e36:	e8 2b f9 ff ff       	call   803766 <worker_req>
+	r = file_write(o->o_file, worker_data(w) + req->req_off, req->req_n,
+  803e3b:	ff 75 d0             	push   -0x30(%ebp)
+  803e3e:	56                   	push   %esi
+  803e3f:	8d 84 03 00 10 00 00 	lea    0x1000(%ebx,%eax,1),%eax
+  803e46:	50                   	push   %eax
+  803e47:	ff 77 04             	push   0x4(%edi)
+  803e4a:	e8 e3 e9 ff ff       	call   802832 <file_write>
+	if (r > 0)
+  803e4f:	83 c4 10             	add    $0x10,%esp
+  803e52:	85 c0                	test   %eax,%eax
+  803e54:	7e 06                	jle    803e5c <serve_write_bulk+0x8d>
+		o->o_fd->fd_offset += r;
+  803e56:	8b 57 0c             	mov    0xc(%edi),%edx
+  803e59:	01 42 04             	add    %eax,0x4(%edx)
+}
+  803e5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e5f:	5b                   	pop    %ebx
+  803e60:	5e                   	pop    %esi
+  803e61:	5f                   	pop    %edi
+  803e62:	5d                   	pop    %ebp
+  803e63:	c3                   	ret
+
+00803e64 <serve_readdir>:
+{
+  803e64:	55                   	push   %ebp
+  803e65:	89 e5                	mov    %esp,%ebp
+  803e67:	57                   	push   %edi
+  803e68:	56                   	push   %esi
+  803e69:	53                   	push   %ebx
+  803e6a:	81 ec 80 04 00 00    	sub    $0x480,%esp
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  803e70:	8d 85 e4 fb ff ff    	lea    -0x41c(%ebp),%eax
+  803e76:	50                   	push   %eax
+  803e77:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803e7a:	ff 30                	push   (%eax)
+  803e7c:	ff 75 08             	push   0x8(%ebp)
+  803e7f:	e8 83 fd ff ff       	call   803c07 <openfile_lookup>
+  803e84:	83 c4 10             	add    $0x10,%esp
+  803e87:	85 c0                	test   %eax,%eax
+  803e89:	0f 88 20 01 00 00    	js     803faf <serve_readdir+0x14b>
+	n = MIN(req->req_n, PGSIZE);
+  803e8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803e92:	8b 50 04             	mov    0x4(%eax),%edx
+  803e95:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803e9a:	39 c2                	cmp    %eax,%edx
+  803e9c:	0f 46 c2             	cmovbe %edx,%eax
+  803e9f:	89 85 8c fb ff ff    	mov    %eax,-0x474(%ebp)
+	flags = req->req_flags;
+  803ea5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803ea8:	8b 40 08             	mov    0x8(%eax),%eax
+	if (o->o_file->f_type != FTYPE_DIR)
+  803eab:	8b bd e4 fb ff ff    	mov    -0x41c(%ebp),%edi
+  803eb1:	8b 57 04             	mov    0x4(%edi),%edx
+  803eb4:	83 ba 84 00 00 00 01 	cmpl   $0x1,0x84(%edx)
+  803ebb:	0f 85 c1 02 00 00    	jne    804182 <serve_readdir+0x31e>
+	if (!(flags & FSREADDIR_RECURSIVE) || o->o_wdepth == 0
+  803ec1:	83 e0 01             	and    $0x1,%eax
+  803ec4:	89 85 88 fb ff ff    	mov    %eax,-0x478(%ebp)
+  803eca:	74 11                	je     803edd <serve_readdir+0x79>
+  803ecc:	83 7f 64 00          	cmpl   $0x0,0x64(%edi)
+  803ed0:	74 0b                	je     803edd <serve_readdir+0x79>
+	    || o->o_woffset != o->o_fd->fd_offset) {
+  803ed2:	8b 47 0c             	mov    0xc(%edi),%eax
+  803ed5:	8b 40 04             	mov    0x4(%eax),%eax
+  803ed8:	39 47 68             	cmp    %eax,0x68(%edi)
+  803edb:	74 13                	je     803ef0 <serve_readdir+0x8c>
+		o->o_wnext[0] = o->o_fd->fd_offset / sizeof(struct File);
+  803edd:	8b 47 0c             	mov    0xc(%edi),%eax
+  803ee0:	8b 40 04             	mov    0x4(%eax),%eax
+  803ee3:	c1 e8 08             	shr    $0x8,%eax
+  803ee6:	89 47 24             	mov    %eax,0x24(%edi)
+		o->o_wdepth = 1;
+  803ee9:	c7 47 64 01 00 00 00 	movl   $0x1,0x64(%edi)
+	dirs[0] = o->o_file;
+  803ef0:	89 95 a0 fb ff ff    	mov    %edx,-0x460(%ebp)
+	for (i = 1; i < o->o_wdepth; i++)
+  803ef6:	8d 9d a4 fb ff ff    	lea    -0x45c(%ebp),%ebx
+  803efc:	be 01 00 00 00       	mov    $0x1,%esi
+  803f01:	39 77 64             	cmp    %esi,0x64(%edi)
+  803f04:	7e 54                	jle    803f5a <serve_readdir+0xf6>
+		if (o->o_wnext[i - 1] == 0
+  803f06:	8b 44 b7 20          	mov    0x20(%edi,%esi,4),%eax
+  803f0a:	85 c0                	test   %eax,%eax
+  803f0c:	74 49                	je     803f57 <serve_readdir+0xf3>
+  803f0e:	89 9d 94 fb ff ff    	mov    %ebx,-0x46c(%ebp)
+		    || o->o_wnext[i - 1] > dirs[i - 1]->f_size / sizeof(struct File)
+  803f14:	8b 53 fc             	mov    -0x4(%ebx),%edx
+  803f17:	8b 8a 80 00 00 00    	mov    0x80(%edx),%ecx
+  803f1d:	c1 e9 08             	shr    $0x8,%ecx
+  803f20:	39 c1                	cmp    %eax,%ecx
+  803f22:	72 33                	jb     803f57 <serve_readdir+0xf3>
+		    || dir_entry(dirs[i - 1], o->o_wnext[i - 1] - 1, &dirs[i]) < 0
+  803f24:	83 ec 04             	sub    $0x4,%esp
+  803f27:	53                   	push   %ebx
+  803f28:	83 e8 01             	sub    $0x1,%eax
+  803f2b:	50                   	push   %eax
+  803f2c:	52                   	push   %edx
+  803f2d:	e8 20 e4 ff ff       	call   802352 <dir_entry>
+  803f32:	83 c4 10             	add    $0x10,%esp
+  803f35:	85 c0                	test   %eax,%eax
+  803f37:	78 1e                	js     803f57 <serve_readdir+0xf3>
+		    || !dirs[i]->f_name[0] || dirs[i]->f_type != FTYPE_DIR) {
+  803f39:	8b 85 94 fb ff ff    	mov    -0x46c(%ebp),%eax
+  803f3f:	8b 00                	mov    (%eax),%eax
+  803f41:	80 38 00             	cmpb   $0x0,(%eax)
+  803f44:	74 11                	je     803f57 <serve_readdir+0xf3>
+  803f46:	83 c3 04             	add    $0x4,%ebx
+  803f49:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  803f50:	75 05                	jne    803f57 <serve_readdir+0xf3>
+	for (i = 1; i < o->o_wdepth; i++)
+  803f52:	83 c6 01             	add    $0x1,%esi
+  803f55:	eb aa                	jmp    803f01 <serve_readdir+0x9d>
+			o->o_wdepth = i;
+  803f57:	89 77 64             	mov    %esi,0x64(%edi)
+	char *buf = ipc->readRet.ret_buf;
+  803f5a:	c7 85 90 fb ff ff 00 	movl   $0x0,-0x470(%ebp)
+  803f61:	00 00 00 
+		top = o->o_wdepth - 1;
+  803f64:	8b 47 64             	mov    0x64(%edi),%eax
+  803f67:	8d 58 ff             	lea    -0x1(%eax),%ebx
+		f = dirs[top];
+  803f6a:	8b 94 9d a0 fb ff ff 	mov    -0x460(%ebp,%ebx,4),%edx
+  803f71:	89 95 e0 fb ff ff    	mov    %edx,-0x420(%ebp)
+		if (o->o_wnext[top] >= f->f_size / sizeof(struct File)) {
+  803f77:	8d 04 87             	lea    (%edi,%eax,4),%eax
+  803f7a:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  803f80:	8b 48 20             	mov    0x20(%eax),%ecx
+  803f83:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  803f89:	c1 e8 08             	shr    $0x8,%eax
+  803f8c:	39 c1                	cmp    %eax,%ecx
+  803f8e:	72 2c                	jb     803fbc <serve_readdir+0x158>
+			if (top == 0)
+  803f90:	85 db                	test   %ebx,%ebx
+  803f92:	75 23                	jne    803fb7 <serve_readdir+0x153>
+	o->o_fd->fd_offset = o->o_wnext[0] * sizeof(struct File);
+  803f94:	8b 57 0c             	mov    0xc(%edi),%edx
+  803f97:	8b 47 24             	mov    0x24(%edi),%eax
+  803f9a:	c1 e0 08             	shl    $0x8,%eax
+  803f9d:	89 42 04             	mov    %eax,0x4(%edx)
+	o->o_woffset = o->o_fd->fd_offset;
+  803fa0:	8b 47 0c             	mov    0xc(%edi),%eax
+  803fa3:	8b 40 04             	mov    0x4(%eax),%eax
+  803fa6:	89 47 68             	mov    %eax,0x68(%edi)
+	return pos;
+  803fa9:	8b 85 90 fb ff ff    	mov    -0x470(%ebp),%eax
+}
+  803faf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fb2:	5b                   	pop    %ebx
+  803fb3:	5e                   	pop    %esi
+  803fb4:	5f                   	pop    %edi
+  803fb5:	5d                   	pop    %ebp
+  803fb6:	c3                   	ret
+			o->o_wdepth--;
+  803fb7:	89 5f 64             	mov    %ebx,0x64(%edi)
+			continue;
+  803fba:	eb a8                	jmp    803f64 <serve_readdir+0x100>
+		if ((r = dir_entry(f, o->o_wnext[top], &f)) < 0)
+  803fbc:	83 ec 04             	sub    $0x4,%esp
+  803fbf:	8d 85 e0 fb ff ff    	lea    -0x420(%ebp),%eax
+  803fc5:	50                   	push   %eax
+  803fc6:	51                   	push   %ecx
+  803fc7:	52                   	push   %edx
+  803fc8:	e8 85 e3 ff ff       	call   802352 <dir_entry>
+  803fcd:	83 c4 10             	add    $0x10,%esp
+  803fd0:	85 c0                	test   %eax,%eax
+  803fd2:	78 db                	js     803faf <serve_readdir+0x14b>
+		if (!f->f_name[0]) {
+  803fd4:	8b 85 e0 fb ff ff    	mov    -0x420(%ebp),%eax
+  803fda:	80 38 00             	cmpb   $0x0,(%eax)
+  803fdd:	75 0f                	jne    803fee <serve_readdir+0x18a>
+			o->o_wnext[top]++;
+  803fdf:	8b 85 94 fb ff ff    	mov    -0x46c(%ebp),%eax
+  803fe5:	83 40 20 01          	addl   $0x1,0x20(%eax)
+			continue;
+  803fe9:	e9 76 ff ff ff       	jmp    803f64 <serve_readdir+0x100>
+		for (i = 1, len = strlen(f->f_name); i <= top; i++)
+  803fee:	83 ec 0c             	sub    $0xc,%esp
+  803ff1:	50                   	push   %eax
+  803ff2:	e8 aa 19 00 00       	call   8059a1 <strlen>
+  803ff7:	83 c4 10             	add    $0x10,%esp
+  803ffa:	be 01 00 00 00       	mov    $0x1,%esi
+  803fff:	89 bd 84 fb ff ff    	mov    %edi,-0x47c(%ebp)
+  804005:	89 c7                	mov    %eax,%edi
+  804007:	eb 19                	jmp    804022 <serve_readdir+0x1be>
+			len += strlen(dirs[i]->f_name) + 1;
+  804009:	83 ec 0c             	sub    $0xc,%esp
+  80400c:	ff b4 b5 a0 fb ff ff 	push   -0x460(%ebp,%esi,4)
+  804013:	e8 89 19 00 00       	call   8059a1 <strlen>
+  804018:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+		for (i = 1, len = strlen(f->f_name); i <= top; i++)
+  80401c:	83 c6 01             	add    $0x1,%esi
+  80401f:	83 c4 10             	add    $0x10,%esp
+  804022:	39 de                	cmp    %ebx,%esi
+  804024:	7e e3                	jle    804009 <serve_readdir+0x1a5>
+		if (len >= sizeof path) {
+  804026:	89 f8                	mov    %edi,%eax
+  804028:	89 bd 80 fb ff ff    	mov    %edi,-0x480(%ebp)
+  80402e:	8b bd 84 fb ff ff    	mov    -0x47c(%ebp),%edi
+  804034:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804039:	76 0f                	jbe    80404a <serve_readdir+0x1e6>
+			o->o_wnext[top]++;
+  80403b:	8b 85 94 fb ff ff    	mov    -0x46c(%ebp),%eax
+  804041:	83 40 20 01          	addl   $0x1,0x20(%eax)
+			continue;
+  804045:	e9 1a ff ff ff       	jmp    803f64 <serve_readdir+0x100>
+		path[0] = 0;
+  80404a:	c6 85 e8 fb ff ff 00 	movb   $0x0,-0x418(%ebp)
+		for (i = 1; i <= top; i++) {
+  804051:	be 01 00 00 00       	mov    $0x1,%esi
+  804056:	eb 30                	jmp    804088 <serve_readdir+0x224>
+			strcat(path, dirs[i]->f_name);
+  804058:	83 ec 08             	sub    $0x8,%esp
+  80405b:	ff b4 b5 a0 fb ff ff 	push   -0x460(%ebp,%esi,4)
+  804062:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  804068:	50                   	push   %eax
+  804069:	e8 92 19 00 00       	call   805a00 <strcat>
+			strcat(path, "/");
+  80406e:	83 c4 08             	add    $0x8,%esp
+  804071:	68 b1 8d 80 00       	push   $0x808db1
+  804076:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  80407c:	50                   	push   %eax
+  80407d:	e8 7e 19 00 00       	call   805a00 <strcat>
+		for (i = 1; i <= top; i++) {
+  804082:	83 c6 01             	add    $0x1,%esi
+  804085:	83 c4 10             	add    $0x10,%esp
+  804088:	39 de                	cmp    %ebx,%esi
+  80408a:	7e cc                	jle    804058 <serve_readdir+0x1f4>
+		strcat(path, f->f_name);
+  80408c:	83 ec 08             	sub    $0x8,%esp
+  80408f:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  804095:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  80409b:	50                   	push   %eax
+  80409c:	e8 5f 19 00 00       	call   805a00 <strcat>
+		reclen = ROUNDUP(offsetof(struct Fsdirent, d_name) + len + 1, 4);
+  8040a1:	8b 85 80 fb ff ff    	mov    -0x480(%ebp),%eax
+  8040a7:	8d 50 0c             	lea    0xc(%eax),%edx
+  8040aa:	83 e2 fc             	and    $0xfffffffc,%edx
+  8040ad:	89 d6                	mov    %edx,%esi
+  8040af:	89 95 84 fb ff ff    	mov    %edx,-0x47c(%ebp)
+		if (pos + reclen > n) {
+  8040b5:	8b 85 90 fb ff ff    	mov    -0x470(%ebp),%eax
+  8040bb:	01 c6                	add    %eax,%esi
+  8040bd:	83 c4 10             	add    $0x10,%esp
+  8040c0:	39 b5 8c fb ff ff    	cmp    %esi,-0x474(%ebp)
+  8040c6:	0f 82 a4 00 00 00    	jb     804170 <serve_readdir+0x30c>
+		d = (struct Fsdirent *) (buf + pos);
+  8040cc:	8b 85 90 fb ff ff    	mov    -0x470(%ebp),%eax
+  8040d2:	03 45 0c             	add    0xc(%ebp),%eax
+		d->d_size = f->f_size;
+  8040d5:	8b 8d e0 fb ff ff    	mov    -0x420(%ebp),%ecx
+  8040db:	8b 91 80 00 00 00    	mov    0x80(%ecx),%edx
+  8040e1:	89 10                	mov    %edx,(%eax)
+		d->d_type = f->f_type;
+  8040e3:	8b 89 84 00 00 00    	mov    0x84(%ecx),%ecx
+  8040e9:	88 48 04             	mov    %cl,0x4(%eax)
+		d->d_depth = top;
+  8040ec:	88 58 05             	mov    %bl,0x5(%eax)
+		d->d_reclen = reclen;
+  8040ef:	0f b7 95 84 fb ff ff 	movzwl -0x47c(%ebp),%edx
+  8040f6:	66 89 50 06          	mov    %dx,0x6(%eax)
+		memmove(d->d_name, path, len + 1);
+  8040fa:	83 ec 04             	sub    $0x4,%esp
+  8040fd:	8b 95 80 fb ff ff    	mov    -0x480(%ebp),%edx
+  804103:	83 c2 01             	add    $0x1,%edx
+  804106:	52                   	push   %edx
+  804107:	8d 95 e8 fb ff ff    	lea    -0x418(%ebp),%edx
+  80410d:	52                   	push   %edx
+  80410e:	83 c0 08             	add    $0x8,%eax
+  804111:	50                   	push   %eax
+  804112:	e8 4b 1a 00 00       	call   805b62 <memmove>
+		o->o_wnext[top]++;
+  804117:	8b 85 94 fb ff ff    	mov    -0x46c(%ebp),%eax
+  80411d:	83 40 20 01          	addl   $0x1,0x20(%eax)
+		if ((flags & FSREADDIR_RECURSIVE) && f->f_type == FTYPE_DIR
+  804121:	83 c4 10             	add    $0x10,%esp
+		pos += reclen;
+  804124:	89 b5 90 fb ff ff    	mov    %esi,-0x470(%ebp)
+		if ((flags & FSREADDIR_RECURSIVE) && f->f_type == FTYPE_DIR
+  80412a:	83 bd 88 fb ff ff 00 	cmpl   $0x0,-0x478(%ebp)
+  804131:	0f 84 2d fe ff ff    	je     803f64 <serve_readdir+0x100>
+  804137:	8b 85 e0 fb ff ff    	mov    -0x420(%ebp),%eax
+  80413d:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  804144:	0f 85 1a fe ff ff    	jne    803f64 <serve_readdir+0x100>
+		    && o->o_wdepth < FS_WALKDEPTH) {
+  80414a:	8b 57 64             	mov    0x64(%edi),%edx
+  80414d:	83 fa 0f             	cmp    $0xf,%edx
+  804150:	0f 8f 0e fe ff ff    	jg     803f64 <serve_readdir+0x100>
+			dirs[o->o_wdepth] = f;
+  804156:	89 84 95 a0 fb ff ff 	mov    %eax,-0x460(%ebp,%edx,4)
+			o->o_wnext[o->o_wdepth] = 0;
+  80415d:	c7 44 97 24 00 00 00 	movl   $0x0,0x24(%edi,%edx,4)
+  804164:	00 
+			o->o_wdepth++;
+  804165:	83 c2 01             	add    $0x1,%edx
+  804168:	89 57 64             	mov    %edx,0x64(%edi)
+  80416b:	e9 f4 fd ff ff       	jmp    803f64 <serve_readdir+0x100>
+			if (pos == 0)
+  804170:	85 c0                	test   %eax,%eax
+  804172:	0f 85 1c fe ff ff    	jne    803f94 <serve_readdir+0x130>
+				return -E_INVAL;
+  804178:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80417d:	e9 2d fe ff ff       	jmp    803faf <serve_readdir+0x14b>
+		return -E_INVAL;
+  804182:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804187:	e9 23 fe ff ff       	jmp    803faf <serve_readdir+0x14b>
+
+0080418c <serve_ring_kick>:
+{
+  80418c:	55                   	push   %ebp
+  80418d:	89 e5                	mov    %esp,%ebp
+  80418f:	57                   	push   %edi
+  804190:	56                   	push   %esi
+  804191:	53                   	push   %ebx
+  804192:	83 ec 2c             	sub    $0x2c,%esp
+	for (i = 0; i < FS_MAXRINGS && ring_owners[i] != envid; i++)
+  804195:	b8 00 00 00 00       	mov    $0x0,%eax
+  80419a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80419d:	39 14 85 60 06 88 00 	cmp    %edx,0x880660(,%eax,4)
+  8041a4:	0f 84 8f 01 00 00    	je     804339 <serve_ring_kick+0x1ad>
+  8041aa:	83 c0 01             	add    $0x1,%eax
+  8041ad:	83 f8 10             	cmp    $0x10,%eax
+  8041b0:	75 eb                	jne    80419d <serve_ring_kick+0x11>
+		return -E_INVAL;
+  8041b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8041b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041ba:	5b                   	pop    %ebx
+  8041bb:	5e                   	pop    %esi
+  8041bc:	5f                   	pop    %edi
+  8041bd:	5d                   	pop    %ebp
+  8041be:	c3                   	ret
+		return file_write(o->o_file, data, n, sqe->sqe_offset);
+  8041bf:	ff 75 d4             	push   -0x2c(%ebp)
+  8041c2:	ff 75 d0             	push   -0x30(%ebp)
+  8041c5:	ff 75 c8             	push   -0x38(%ebp)
+  8041c8:	ff 76 04             	push   0x4(%esi)
+  8041cb:	e8 62 e6 ff ff       	call   802832 <file_write>
+  8041d0:	83 c4 10             	add    $0x10,%esp
+			cqe->cqe_result = ring_do(envid, &sqe, (char *) ring
+  8041d3:	89 84 df 54 01 00 00 	mov    %eax,0x154(%edi,%ebx,8)
+		ring->r_cqtail++;
+  8041da:	8b 47 0c             	mov    0xc(%edi),%eax
+  8041dd:	83 c0 01             	add    $0x1,%eax
+  8041e0:	89 47 0c             	mov    %eax,0xc(%edi)
+	while (ring->r_sqhead != ring->r_sqtail
+  8041e3:	8b 17                	mov    (%edi),%edx
+  8041e5:	8b 47 04             	mov    0x4(%edi),%eax
+	       && ring->r_cqtail - ring->r_cqhead < FSRING_NSLOTS) {
+  8041e8:	39 c2                	cmp    %eax,%edx
+  8041ea:	0f 84 3f 01 00 00    	je     80432f <serve_ring_kick+0x1a3>
+  8041f0:	8b 47 0c             	mov    0xc(%edi),%eax
+  8041f3:	8b 57 08             	mov    0x8(%edi),%edx
+  8041f6:	29 d0                	sub    %edx,%eax
+  8041f8:	83 f8 0f             	cmp    $0xf,%eax
+  8041fb:	0f 87 24 01 00 00    	ja     804325 <serve_ring_kick+0x199>
+		sqe = ring->r_sq[ring->r_sqhead % FSRING_NSLOTS];
+  804201:	8b 07                	mov    (%edi),%eax
+  804203:	83 e0 0f             	and    $0xf,%eax
+  804206:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+  80420d:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+  804210:	8d 1c 97             	lea    (%edi,%edx,4),%ebx
+  804213:	8b 73 10             	mov    0x10(%ebx),%esi
+  804216:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  804219:	8b 53 14             	mov    0x14(%ebx),%edx
+  80421c:	8b 73 18             	mov    0x18(%ebx),%esi
+  80421f:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  804222:	8b 73 1c             	mov    0x1c(%ebx),%esi
+  804225:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  804228:	01 c1                	add    %eax,%ecx
+  80422a:	8b 74 8f 20          	mov    0x20(%edi,%ecx,4),%esi
+		xchg(&ring->r_sqhead, ring->r_sqhead + 1);
+  80422e:	8b 07                	mov    (%edi),%eax
+  804230:	83 c0 01             	add    $0x1,%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  804233:	f0 87 07             	lock xchg %eax,(%edi)
+		cqe = &ring->r_cq[ring->r_cqtail % FSRING_NSLOTS];
+  804236:	8b 5f 0c             	mov    0xc(%edi),%ebx
+  804239:	83 e3 0f             	and    $0xf,%ebx
+		cqe->cqe_slot = sqe.sqe_slot;
+  80423c:	89 b4 df 50 01 00 00 	mov    %esi,0x150(%edi,%ebx,8)
+		if (sqe.sqe_slot < FSRING_NSLOTS)
+  804243:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804248:	83 fe 0f             	cmp    $0xf,%esi
+  80424b:	77 86                	ja     8041d3 <serve_ring_kick+0x47>
+	if ((r = openfile_lookup(envid, sqe->sqe_fileid, &o)) < 0)
+  80424d:	83 ec 04             	sub    $0x4,%esp
+  804250:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  804253:	50                   	push   %eax
+  804254:	52                   	push   %edx
+  804255:	ff 75 08             	push   0x8(%ebp)
+  804258:	e8 aa f9 ff ff       	call   803c07 <openfile_lookup>
+  80425d:	83 c4 10             	add    $0x10,%esp
+  804260:	85 c0                	test   %eax,%eax
+  804262:	0f 88 6b ff ff ff    	js     8041d3 <serve_ring_kick+0x47>
+	if (sqe->sqe_offset < 0)
+  804268:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80426c:	0f 88 a9 00 00 00    	js     80431b <serve_ring_kick+0x18f>
+						  + (1 + sqe.sqe_slot) * PGSIZE);
+  804272:	83 c6 01             	add    $0x1,%esi
+  804275:	c1 e6 0c             	shl    $0xc,%esi
+			cqe->cqe_result = ring_do(envid, &sqe, (char *) ring
+  804278:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  80427b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	size_t n = MIN(sqe->sqe_n, PGSIZE);
+  80427e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804283:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  804286:	39 f0                	cmp    %esi,%eax
+  804288:	0f 46 f0             	cmovbe %eax,%esi
+  80428b:	89 75 d0             	mov    %esi,-0x30(%ebp)
+	bc_set_readahead(&o->o_ra);
+  80428e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  804291:	83 ec 0c             	sub    $0xc,%esp
+  804294:	8d 46 1c             	lea    0x1c(%esi),%eax
+  804297:	50                   	push   %eax
+  804298:	e8 14 c4 ff ff       	call   8006b1 <bc_set_readahead>
+	switch (sqe->sqe_type) {
+  80429d:	83 c4 10             	add    $0x10,%esp
+  8042a0:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8042a3:	83 f9 04             	cmp    $0x4,%ecx
+  8042a6:	0f 84 13 ff ff ff    	je     8041bf <serve_ring_kick+0x33>
+  8042ac:	83 f9 05             	cmp    $0x5,%ecx
+  8042af:	74 27                	je     8042d8 <serve_ring_kick+0x14c>
+  8042b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8042b6:	83 f9 03             	cmp    $0x3,%ecx
+  8042b9:	0f 85 14 ff ff ff    	jne    8041d3 <serve_ring_kick+0x47>
+		return file_read(o->o_file, data, n, sqe->sqe_offset);
+  8042bf:	ff 75 d4             	push   -0x2c(%ebp)
+  8042c2:	ff 75 d0             	push   -0x30(%ebp)
+  8042c5:	ff 75 c8             	push   -0x38(%ebp)
+  8042c8:	ff 76 04             	push   0x4(%esi)
+  8042cb:	e8 4f e4 ff ff       	call   80271f <file_read>
+  8042d0:	83 c4 10             	add    $0x10,%esp
+  8042d3:	e9 fb fe ff ff       	jmp    8041d3 <serve_ring_kick+0x47>
+		strcpy(st->ret_name, o->o_file->f_name);
+  8042d8:	83 ec 08             	sub    $0x8,%esp
+  8042db:	ff 76 04             	push   0x4(%esi)
+  8042de:	ff 75 c8             	push   -0x38(%ebp)
+  8042e1:	e8 f6 16 00 00       	call   8059dc <strcpy>
+		st->ret_size = o->o_file->f_size;
+  8042e6:	8b 46 04             	mov    0x4(%esi),%eax
+  8042e9:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8042ef:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8042f2:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+		st->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  8042f8:	8b 46 04             	mov    0x4(%esi),%eax
+  8042fb:	83 c4 10             	add    $0x10,%esp
+  8042fe:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  804305:	0f 94 c0             	sete   %al
+  804308:	0f b6 c0             	movzbl %al,%eax
+  80430b:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+		return 0;
+  804311:	b8 00 00 00 00       	mov    $0x0,%eax
+  804316:	e9 b8 fe ff ff       	jmp    8041d3 <serve_ring_kick+0x47>
+		return -E_INVAL;
+  80431b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804320:	e9 ae fe ff ff       	jmp    8041d3 <serve_ring_kick+0x47>
+	return 0;
+  804325:	b8 00 00 00 00       	mov    $0x0,%eax
+  80432a:	e9 88 fe ff ff       	jmp    8041b7 <serve_ring_kick+0x2b>
+  80432f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804334:	e9 7e fe ff ff       	jmp    8041b7 <serve_ring_kick+0x2b>
+	return (struct Fsring *) (FSRINGS_VA + i * FSRING_NPAGES * PGSIZE);
+  804339:	69 c0 00 10 01 00    	imul   $0x11000,%eax,%eax
+  80433f:	8d b8 00 80 bc 0f    	lea    0xfbc8000(%eax),%edi
+	while (ring->r_sqhead != ring->r_sqtail
+  804345:	e9 99 fe ff ff       	jmp    8041e3 <serve_ring_kick+0x57>
+
+0080434a <serve_stat>:
+{
+  80434a:	55                   	push   %ebp
+  80434b:	89 e5                	mov    %esp,%ebp
+  80434d:	56                   	push   %esi
+  80434e:	53                   	push   %ebx
+  80434f:	83 ec 14             	sub    $0x14,%esp
+  804352:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  804355:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804358:	50                   	push   %eax
+  804359:	ff 33                	push   (%ebx)
+  80435b:	ff 75 08             	push   0x8(%ebp)
+  80435e:	e8 a4 f8 ff ff       	call   803c07 <openfile_lookup>
+  804363:	83 c4 10             	add    $0x10,%esp
+  804366:	85 c0                	test   %eax,%eax
+  804368:	78 3c                	js     8043a6 <serve_stat+0x5c>
+	strcpy(ret->ret_name, o->o_file->f_name);
+  80436a:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80436d:	83 ec 08             	sub    $0x8,%esp
+  804370:	ff 76 04             	push   0x4(%esi)
+  804373:	53                   	push   %ebx
+  804374:	e8 63 16 00 00       	call   8059dc <strcpy>
+	ret->ret_size = o->o_file->f_size;
+  804379:	8b 46 04             	mov    0x4(%esi),%eax
+  80437c:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  804382:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  804388:	8b 46 04             	mov    0x4(%esi),%eax
+  80438b:	83 c4 10             	add    $0x10,%esp
+  80438e:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  804395:	0f 94 c0             	sete   %al
+  804398:	0f b6 c0             	movzbl %al,%eax
+  80439b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8043a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8043a9:	5b                   	pop    %ebx
+  8043aa:	5e                   	pop    %esi
+  8043ab:	5d                   	pop    %ebp
+  8043ac:	c3                   	ret
+
+008043ad <serve_flush>:
+{
+  8043ad:	55                   	push   %ebp
+  8043ae:	89 e5                	mov    %esp,%ebp
+  8043b0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  8043b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8043b6:	50                   	push   %eax
+  8043b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8043ba:	ff 30                	push   (%eax)
+  8043bc:	ff 75 08             	push   0x8(%ebp)
+  8043bf:	e8 43 f8 ff ff       	call   803c07 <openfile_lookup>
+  8043c4:	83 c4 10             	add    $0x10,%esp
+  8043c7:	85 c0                	test   %eax,%eax
+  8043c9:	78 16                	js     8043e1 <serve_flush+0x34>
+	file_flush(o->o_file);
+  8043cb:	83 ec 0c             	sub    $0xc,%esp
+  8043ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8043d1:	ff 70 04             	push   0x4(%eax)
+  8043d4:	e8 07 e5 ff ff       	call   8028e0 <file_flush>
+	return 0;
+  8043d9:	83 c4 10             	add    $0x10,%esp
+  8043dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043e1:	c9                   	leave
+  8043e2:	c3                   	ret
+
+008043e3 <serve_open>:
+{
+  8043e3:	55                   	push   %ebp
+  8043e4:	89 e5                	mov    %esp,%ebp
+  8043e6:	53                   	push   %ebx
+  8043e7:	81 ec 18 04 00 00    	sub    $0x418,%esp
+  8043ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	memmove(path, req->req_path, MAXPATHLEN);
+  8043f0:	68 00 04 00 00       	push   $0x400
+  8043f5:	53                   	push   %ebx
+  8043f6:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  8043fc:	50                   	push   %eax
+  8043fd:	e8 60 17 00 00       	call   805b62 <memmove>
+	path[MAXPATHLEN-1] = 0;
+  804402:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+	if (req->req_omode & O_CREAT) {
+  804406:	8b 83 00 04 00 00    	mov    0x400(%ebx),%eax
+  80440c:	83 c4 10             	add    $0x10,%esp
+  80440f:	f6 c4 01             	test   $0x1,%ah
+  804412:	74 3a                	je     80444e <serve_open+0x6b>
+		if ((r = file_create(path, type, &f)) < 0) {
+  804414:	83 ec 04             	sub    $0x4,%esp
+  804417:	8d 95 f4 fb ff ff    	lea    -0x40c(%ebp),%edx
+  80441d:	52                   	push   %edx
+		type = (req->req_omode & O_MKDIR) ? FTYPE_DIR : FTYPE_REG;
+  80441e:	c1 f8 0b             	sar    $0xb,%eax
+  804421:	83 e0 01             	and    $0x1,%eax
+		if ((r = file_create(path, type, &f)) < 0) {
+  804424:	50                   	push   %eax
+  804425:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  80442b:	50                   	push   %eax
+  80442c:	e8 b2 e5 ff ff       	call   8029e3 <file_create>
+  804431:	83 c4 10             	add    $0x10,%esp
+  804434:	85 c0                	test   %eax,%eax
+  804436:	79 37                	jns    80446f <serve_open+0x8c>
+			if (!(req->req_omode & O_EXCL) && r == -E_FILE_EXISTS)
+  804438:	f6 83 01 04 00 00 04 	testb  $0x4,0x401(%ebx)
+  80443f:	0f 85 c5 00 00 00    	jne    80450a <serve_open+0x127>
+  804445:	83 f8 f3             	cmp    $0xfffffff3,%eax
+  804448:	0f 85 bc 00 00 00    	jne    80450a <serve_open+0x127>
+		if ((r = file_open(path, &f)) < 0) {
+  80444e:	83 ec 08             	sub    $0x8,%esp
+  804451:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  804457:	50                   	push   %eax
+  804458:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  80445e:	50                   	push   %eax
+  80445f:	e8 a1 e2 ff ff       	call   802705 <file_open>
+  804464:	83 c4 10             	add    $0x10,%esp
+  804467:	85 c0                	test   %eax,%eax
+  804469:	0f 88 9b 00 00 00    	js     80450a <serve_open+0x127>
+	if (req->req_omode & O_TRUNC) {
+  80446f:	f6 83 01 04 00 00 02 	testb  $0x2,0x401(%ebx)
+  804476:	74 17                	je     80448f <serve_open+0xac>
+		if ((r = file_set_size(f, 0)) < 0) {
+  804478:	83 ec 08             	sub    $0x8,%esp
+  80447b:	6a 00                	push   $0x0
+  80447d:	ff b5 f4 fb ff ff    	push   -0x40c(%ebp)
+  804483:	e8 5f e3 ff ff       	call   8027e7 <file_set_size>
+  804488:	83 c4 10             	add    $0x10,%esp
+  80448b:	85 c0                	test   %eax,%eax
+  80448d:	78 7b                	js     80450a <serve_open+0x127>
+	if ((r = openfile_alloc(&o)) < 0) {
+  80448f:	83 ec 0c             	sub    $0xc,%esp
+  804492:	8d 85 f0 fb ff ff    	lea    -0x410(%ebp),%eax
+  804498:	50                   	push   %eax
+  804499:	e8 be f6 ff ff       	call   803b5c <openfile_alloc>
+  80449e:	83 c4 10             	add    $0x10,%esp
+  8044a1:	85 c0                	test   %eax,%eax
+  8044a3:	78 65                	js     80450a <serve_open+0x127>
+	o->o_file = f;
+  8044a5:	8b 85 f0 fb ff ff    	mov    -0x410(%ebp),%eax
+  8044ab:	8b 95 f4 fb ff ff    	mov    -0x40c(%ebp),%edx
+  8044b1:	89 50 04             	mov    %edx,0x4(%eax)
+	o->o_wdepth = 0;
+  8044b4:	c7 40 64 00 00 00 00 	movl   $0x0,0x64(%eax)
+	o->o_ra.ra_next = o->o_ra.ra_size = 0;
+  8044bb:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%eax)
+  8044c2:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	o->o_fd->fd_file.id = o->o_fileid;
+  8044c9:	8b 50 0c             	mov    0xc(%eax),%edx
+  8044cc:	8b 08                	mov    (%eax),%ecx
+  8044ce:	89 4a 0c             	mov    %ecx,0xc(%edx)
+	o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  8044d1:	8b 48 0c             	mov    0xc(%eax),%ecx
+  8044d4:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  8044da:	83 e2 03             	and    $0x3,%edx
+  8044dd:	89 51 08             	mov    %edx,0x8(%ecx)
+	o->o_fd->fd_dev_id = devfile.dev_id;
+  8044e0:	8b 50 0c             	mov    0xc(%eax),%edx
+  8044e3:	8b 0d a0 50 82 00    	mov    0x8250a0,%ecx
+  8044e9:	89 0a                	mov    %ecx,(%edx)
+	o->o_mode = req->req_omode;
+  8044eb:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  8044f1:	89 50 08             	mov    %edx,0x8(%eax)
+	*pg_store = o->o_fd;
+  8044f4:	8b 50 0c             	mov    0xc(%eax),%edx
+  8044f7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8044fa:	89 10                	mov    %edx,(%eax)
+	*perm_store = PTE_P|PTE_U|PTE_W|PTE_SHARE;
+  8044fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8044ff:	c7 00 07 04 00 00    	movl   $0x407,(%eax)
+	return 0;
+  804505:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80450a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80450d:	c9                   	leave
+  80450e:	c3                   	ret
+
+0080450f <serve_map>:
+{
+  80450f:	55                   	push   %ebp
+  804510:	89 e5                	mov    %esp,%ebp
+  804512:	57                   	push   %edi
+  804513:	56                   	push   %esi
+  804514:	53                   	push   %ebx
+  804515:	83 ec 2c             	sub    $0x2c,%esp
+  804518:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	return &workers[thread_current() - 1];
+  80451b:	e8 9b 07 00 00       	call   804cbb <thread_current>
+  804520:	89 c3                	mov    %eax,%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  804522:	83 ec 04             	sub    $0x4,%esp
+  804525:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  804528:	50                   	push   %eax
+  804529:	ff 37                	push   (%edi)
+  80452b:	ff 75 08             	push   0x8(%ebp)
+  80452e:	e8 d4 f6 ff ff       	call   803c07 <openfile_lookup>
+  804533:	89 c6                	mov    %eax,%esi
+  804535:	83 c4 10             	add    $0x10,%esp
+  804538:	85 c0                	test   %eax,%eax
+  80453a:	0f 88 68 01 00 00    	js     8046a8 <serve_map+0x199>
+	if (PGOFF(req->req_offset) || req->req_offset < 0)
+  804540:	8b 47 04             	mov    0x4(%edi),%eax
+  804543:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  804548:	0f 85 64 01 00 00    	jne    8046b2 <serve_map+0x1a3>
+  80454e:	85 c0                	test   %eax,%eax
+  804550:	0f 88 5c 01 00 00    	js     8046b2 <serve_map+0x1a3>
+	if (o->o_file->f_type == FTYPE_REG && (r = file_commit(o->o_file)) < 0)
+  804556:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804559:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80455c:	8b 40 04             	mov    0x4(%eax),%eax
+  80455f:	83 b8 84 00 00 00 00 	cmpl   $0x0,0x84(%eax)
+  804566:	74 1e                	je     804586 <serve_map+0x77>
+	return &workers[thread_current() - 1];
+  804568:	83 eb 01             	sub    $0x1,%ebx
+  80456b:	be 00 00 00 00       	mov    $0x0,%esi
+			w->w_pins[w->w_npins++] = blockno;
+  804570:	69 c3 28 01 00 00    	imul   $0x128,%ebx,%eax
+  804576:	05 c0 06 88 00       	add    $0x8806c0,%eax
+  80457b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80457e:	6b c3 4a             	imul   $0x4a,%ebx,%eax
+  804581:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  804584:	eb 3b                	jmp    8045c1 <serve_map+0xb2>
+	if (o->o_file->f_type == FTYPE_REG && (r = file_commit(o->o_file)) < 0)
+  804586:	83 ec 0c             	sub    $0xc,%esp
+  804589:	50                   	push   %eax
+  80458a:	e8 05 d9 ff ff       	call   801e94 <file_commit>
+  80458f:	89 c6                	mov    %eax,%esi
+  804591:	83 c4 10             	add    $0x10,%esp
+  804594:	85 c0                	test   %eax,%eax
+  804596:	79 d0                	jns    804568 <serve_map+0x59>
+  804598:	e9 0b 01 00 00       	jmp    8046a8 <serve_map+0x199>
+			if (n == 0)
+  80459d:	85 f6                	test   %esi,%esi
+  80459f:	0f 84 14 01 00 00    	je     8046b9 <serve_map+0x1aa>
+			i = -1;
+  8045a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8045aa:	e9 c2 00 00 00       	jmp    804671 <serve_map+0x162>
+		pages[n] = (uintptr_t) blk | PTE_P | PTE_U;
+  8045af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8045b2:	83 c8 05             	or     $0x5,%eax
+  8045b5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8045b8:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  8045bb:	89 04 91             	mov    %eax,(%ecx,%edx,4)
+	for (n = 0; n < MIN(req->req_npages, FSBULK_MAXPAGES); n++) {
+  8045be:	83 c6 01             	add    $0x1,%esi
+  8045c1:	8b 47 08             	mov    0x8(%edi),%eax
+  8045c4:	ba 40 00 00 00       	mov    $0x40,%edx
+  8045c9:	39 d0                	cmp    %edx,%eax
+  8045cb:	0f 4f c2             	cmovg  %edx,%eax
+  8045ce:	39 c6                	cmp    %eax,%esi
+  8045d0:	7d d3                	jge    8045a5 <serve_map+0x96>
+		off = req->req_offset + n * PGSIZE;
+  8045d2:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  8045d5:	89 f0                	mov    %esi,%eax
+  8045d7:	c1 e0 0c             	shl    $0xc,%eax
+  8045da:	03 47 04             	add    0x4(%edi),%eax
+		if (off >= o->o_file->f_size)
+  8045dd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8045e0:	8b 51 04             	mov    0x4(%ecx),%edx
+  8045e3:	39 82 80 00 00 00    	cmp    %eax,0x80(%edx)
+  8045e9:	7e ba                	jle    8045a5 <serve_map+0x96>
+		if ((r = file_find_block(o->o_file, off / BLKSIZE, &blk)) < 0) {
+  8045eb:	83 ec 04             	sub    $0x4,%esp
+  8045ee:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8045f1:	51                   	push   %ecx
+  8045f2:	8d 88 ff 0f 00 00    	lea    0xfff(%eax),%ecx
+  8045f8:	85 c0                	test   %eax,%eax
+  8045fa:	0f 48 c1             	cmovs  %ecx,%eax
+  8045fd:	c1 f8 0c             	sar    $0xc,%eax
+  804600:	50                   	push   %eax
+  804601:	52                   	push   %edx
+  804602:	e8 b9 dc ff ff       	call   8022c0 <file_find_block>
+  804607:	83 c4 10             	add    $0x10,%esp
+  80460a:	85 c0                	test   %eax,%eax
+  80460c:	78 8f                	js     80459d <serve_map+0x8e>
+		*(volatile char *) blk;
+  80460e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804611:	0f b6 03             	movzbl (%ebx),%eax
+		blockno = ((uintptr_t) blk - DISKMAP) / BLKSIZE;
+  804614:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+  80461a:	c1 eb 0c             	shr    $0xc,%ebx
+		if (!bc_is_pinned(blockno)) {
+  80461d:	83 ec 0c             	sub    $0xc,%esp
+  804620:	53                   	push   %ebx
+  804621:	e8 16 c0 ff ff       	call   80063c <bc_is_pinned>
+  804626:	83 c4 10             	add    $0x10,%esp
+  804629:	84 c0                	test   %al,%al
+  80462b:	75 82                	jne    8045af <serve_map+0xa0>
+			bc_pin(blockno);
+  80462d:	83 ec 0c             	sub    $0xc,%esp
+  804630:	53                   	push   %ebx
+  804631:	e8 24 c0 ff ff       	call   80065a <bc_pin>
+			if (!bc_is_pinned(blockno))
+  804636:	89 1c 24             	mov    %ebx,(%esp)
+  804639:	e8 fe bf ff ff       	call   80063c <bc_is_pinned>
+  80463e:	83 c4 10             	add    $0x10,%esp
+  804641:	84 c0                	test   %al,%al
+  804643:	0f 84 5c ff ff ff    	je     8045a5 <serve_map+0x96>
+			w->w_pins[w->w_npins++] = blockno;
+  804649:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80464c:	8b 81 24 01 00 00    	mov    0x124(%ecx),%eax
+  804652:	8d 50 01             	lea    0x1(%eax),%edx
+  804655:	89 91 24 01 00 00    	mov    %edx,0x124(%ecx)
+  80465b:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80465e:	8d 44 10 08          	lea    0x8(%eax,%edx,1),%eax
+  804662:	89 1c 85 c4 06 88 00 	mov    %ebx,0x8806c4(,%eax,4)
+  804669:	e9 41 ff ff ff       	jmp    8045af <serve_map+0xa0>
+	for (i = 0; i < n; i++)
+  80466e:	83 c3 01             	add    $0x1,%ebx
+  804671:	39 f3                	cmp    %esi,%ebx
+  804673:	7d 2e                	jge    8046a3 <serve_map+0x194>
+		if (!va_is_mapped((void *) ROUNDDOWN(pages[i], PGSIZE))) {
+  804675:	8b 45 10             	mov    0x10(%ebp),%eax
+  804678:	8d 3c 98             	lea    (%eax,%ebx,4),%edi
+  80467b:	83 ec 0c             	sub    $0xc,%esp
+  80467e:	8b 07                	mov    (%edi),%eax
+  804680:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  804685:	50                   	push   %eax
+  804686:	e8 15 bd ff ff       	call   8003a0 <va_is_mapped>
+  80468b:	83 c4 10             	add    $0x10,%esp
+  80468e:	84 c0                	test   %al,%al
+  804690:	75 dc                	jne    80466e <serve_map+0x15f>
+			*(volatile char *) ROUNDDOWN(pages[i], PGSIZE);
+  804692:	8b 07                	mov    (%edi),%eax
+  804694:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  804699:	0f b6 00             	movzbl (%eax),%eax
+			i = -1;
+  80469c:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  8046a1:	eb cb                	jmp    80466e <serve_map+0x15f>
+	*npages = n;
+  8046a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8046a6:	89 30                	mov    %esi,(%eax)
+}
+  8046a8:	89 f0                	mov    %esi,%eax
+  8046aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046ad:	5b                   	pop    %ebx
+  8046ae:	5e                   	pop    %esi
+  8046af:	5f                   	pop    %edi
+  8046b0:	5d                   	pop    %ebp
+  8046b1:	c3                   	ret
+		return -E_INVAL;
+  8046b2:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+  8046b7:	eb ef                	jmp    8046a8 <serve_map+0x199>
+		if ((r = file_find_block(o->o_file, off / BLKSIZE, &blk)) < 0) {
+  8046b9:	89 c6                	mov    %eax,%esi
+  8046bb:	eb eb                	jmp    8046a8 <serve_map+0x199>
+
+008046bd <worker>:
+
+// Worker thread i: serve the requests the main thread hands to
+// workers[i], one at a time.
+static void
+worker(int i)
+{
+  8046bd:	55                   	push   %ebp
+  8046be:	89 e5                	mov    %esp,%ebp
+  8046c0:	57                   	push   %edi
+  8046c1:	56                   	push   %esi
+  8046c2:	53                   	push   %ebx
+  8046c3:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  8046c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct Worker *w = &workers[i];
+  8046cc:	69 c3 28 01 00 00    	imul   $0x128,%ebx,%eax
+  8046d2:	05 c0 06 88 00       	add    $0x8806c0,%eax
+	union Fsipc *ipc = worker_req(w);
+  8046d7:	e8 8a f0 ff ff       	call   803766 <worker_req>
+  8046dc:	89 85 d0 fe ff ff    	mov    %eax,-0x130(%ebp)
+	uintptr_t reply[FSBULK_MAXPAGES];
+	int perm, r, nreply;
+	void *pg;
+
+	while (1) {
+		while (!w->w_busy)
+  8046e2:	69 fb 28 01 00 00    	imul   $0x128,%ebx,%edi
+		fs_tick(!w->w_shared);
+		lock_release(&fs_lock, w->w_shared);
+		if (w->w_o)
+			lock_release(&w->w_o->o_lock, 0);
+		while (w->w_npins > 0)
+			bc_unpin(w->w_pins[--w->w_npins]);
+  8046e8:	6b c3 4a             	imul   $0x4a,%ebx,%eax
+  8046eb:	89 85 cc fe ff ff    	mov    %eax,-0x134(%ebp)
+  8046f1:	eb 05                	jmp    8046f8 <worker+0x3b>
+			thread_yield();
+  8046f3:	e8 7c 05 00 00       	call   804c74 <thread_yield>
+		while (!w->w_busy)
+  8046f8:	80 bf c0 06 88 00 00 	cmpb   $0x0,0x8806c0(%edi)
+  8046ff:	74 f2                	je     8046f3 <worker+0x36>
+		if (w->w_o)
+  804701:	8b 87 dc 06 88 00    	mov    0x8806dc(%edi),%eax
+  804707:	85 c0                	test   %eax,%eax
+  804709:	74 17                	je     804722 <worker+0x65>
+			lock_wait(&w->w_o->o_lock, w->w_oticket, 0);
+  80470b:	83 ec 04             	sub    $0x4,%esp
+  80470e:	6a 00                	push   $0x0
+  804710:	ff b7 e0 06 88 00    	push   0x8806e0(%edi)
+  804716:	83 c0 10             	add    $0x10,%eax
+  804719:	50                   	push   %eax
+  80471a:	e8 b1 05 00 00       	call   804cd0 <lock_wait>
+  80471f:	83 c4 10             	add    $0x10,%esp
+		lock_wait(&fs_lock, w->w_ticket, w->w_shared);
+  804722:	83 ec 04             	sub    $0x4,%esp
+  804725:	0f b6 87 d4 06 88 00 	movzbl 0x8806d4(%edi),%eax
+  80472c:	50                   	push   %eax
+  80472d:	ff b7 d8 06 88 00    	push   0x8806d8(%edi)
+  804733:	68 a0 06 88 00       	push   $0x8806a0
+  804738:	e8 93 05 00 00       	call   804cd0 <lock_wait>
+		bc_set_readahead(w->w_o ? &w->w_o->o_ra : NULL);
+  80473d:	8b 87 dc 06 88 00    	mov    0x8806dc(%edi),%eax
+  804743:	8d 50 1c             	lea    0x1c(%eax),%edx
+  804746:	85 c0                	test   %eax,%eax
+  804748:	0f 45 c2             	cmovne %edx,%eax
+  80474b:	89 04 24             	mov    %eax,(%esp)
+  80474e:	e8 5e bf ff ff       	call   8006b1 <bc_set_readahead>
+		pg = NULL;
+  804753:	c7 85 dc fe ff ff 00 	movl   $0x0,-0x124(%ebp)
+  80475a:	00 00 00 
+		nreply = 0;
+  80475d:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%ebp)
+  804764:	00 00 00 
+		if (w->w_req == FSREQ_OPEN) {
+  804767:	8b 87 c8 06 88 00    	mov    0x8806c8(%edi),%eax
+  80476d:	83 c4 10             	add    $0x10,%esp
+  804770:	83 f8 01             	cmp    $0x1,%eax
+  804773:	74 36                	je     8047ab <worker+0xee>
+		} else if (w->w_req == FSREQ_MAP) {
+  804775:	83 f8 0b             	cmp    $0xb,%eax
+  804778:	74 75                	je     8047ef <worker+0x132>
+		} else if (w->w_req < ARRAY_SIZE(handlers) && handlers[w->w_req]) {
+  80477a:	83 f8 11             	cmp    $0x11,%eax
+  80477d:	0f 87 90 00 00 00    	ja     804813 <worker+0x156>
+  804783:	8b 14 85 20 a0 80 00 	mov    0x80a020(,%eax,4),%edx
+  80478a:	85 d2                	test   %edx,%edx
+  80478c:	0f 84 81 00 00 00    	je     804813 <worker+0x156>
+			r = handlers[w->w_req](w->w_whom, ipc);
+  804792:	83 ec 08             	sub    $0x8,%esp
+  804795:	ff b5 d0 fe ff ff    	push   -0x130(%ebp)
+  80479b:	ff b7 c4 06 88 00    	push   0x8806c4(%edi)
+  8047a1:	ff d2                	call   *%edx
+  8047a3:	83 c4 10             	add    $0x10,%esp
+  8047a6:	e9 84 00 00 00       	jmp    80482f <worker+0x172>
+			r = serve_open(w->w_whom, &ipc->open, &pg, &perm);
+  8047ab:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  8047b1:	50                   	push   %eax
+  8047b2:	8d 85 dc fe ff ff    	lea    -0x124(%ebp),%eax
+  8047b8:	50                   	push   %eax
+  8047b9:	ff b5 d0 fe ff ff    	push   -0x130(%ebp)
+  8047bf:	ff b7 c4 06 88 00    	push   0x8806c4(%edi)
+  8047c5:	e8 19 fc ff ff       	call   8043e3 <serve_open>
+			if (pg)
+  8047ca:	8b 95 dc fe ff ff    	mov    -0x124(%ebp),%edx
+  8047d0:	83 c4 10             	add    $0x10,%esp
+  8047d3:	85 d2                	test   %edx,%edx
+  8047d5:	74 58                	je     80482f <worker+0x172>
+				reply[nreply++] = (uintptr_t) pg | perm;
+  8047d7:	c7 85 e0 fe ff ff 01 	movl   $0x1,-0x120(%ebp)
+  8047de:	00 00 00 
+  8047e1:	0b 95 e4 fe ff ff    	or     -0x11c(%ebp),%edx
+  8047e7:	89 95 e8 fe ff ff    	mov    %edx,-0x118(%ebp)
+  8047ed:	eb 40                	jmp    80482f <worker+0x172>
+			r = serve_map(w->w_whom, &ipc->map, reply, &nreply);
+  8047ef:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+  8047f5:	50                   	push   %eax
+  8047f6:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8047fc:	50                   	push   %eax
+  8047fd:	ff b5 d0 fe ff ff    	push   -0x130(%ebp)
+  804803:	ff b7 c4 06 88 00    	push   0x8806c4(%edi)
+  804809:	e8 01 fd ff ff       	call   80450f <serve_map>
+  80480e:	83 c4 10             	add    $0x10,%esp
+  804811:	eb 1c                	jmp    80482f <worker+0x172>
+			cprintf("Invalid request code %d from %08x\n",
+  804813:	83 ec 04             	sub    $0x4,%esp
+  804816:	ff b7 c4 06 88 00    	push   0x8806c4(%edi)
+  80481c:	50                   	push   %eax
+  80481d:	68 d4 8d 80 00       	push   $0x808dd4
+  804822:	e8 c7 0b 00 00       	call   8053ee <cprintf>
+  804827:	83 c4 10             	add    $0x10,%esp
+			r = -E_INVAL;
+  80482a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+		if (w->w_req != FSREQ_RING_KICK)
+  80482f:	83 bf c8 06 88 00 0d 	cmpl   $0xd,0x8806c8(%edi)
+  804836:	75 60                	jne    804898 <worker+0x1db>
+		bc_set_readahead(NULL);
+  804838:	83 ec 0c             	sub    $0xc,%esp
+  80483b:	6a 00                	push   $0x0
+  80483d:	e8 6f be ff ff       	call   8006b1 <bc_set_readahead>
+		fs_tick(!w->w_shared);
+  804842:	0f b6 87 d4 06 88 00 	movzbl 0x8806d4(%edi),%eax
+  804849:	83 f0 01             	xor    $0x1,%eax
+  80484c:	0f b6 c0             	movzbl %al,%eax
+  80484f:	89 04 24             	mov    %eax,(%esp)
+  804852:	e8 ab e7 ff ff       	call   803002 <fs_tick>
+		lock_release(&fs_lock, w->w_shared);
+  804857:	83 c4 08             	add    $0x8,%esp
+  80485a:	0f b6 87 d4 06 88 00 	movzbl 0x8806d4(%edi),%eax
+  804861:	50                   	push   %eax
+  804862:	68 a0 06 88 00       	push   $0x8806a0
+  804867:	e8 ca 04 00 00       	call   804d36 <lock_release>
+		if (w->w_o)
+  80486c:	8b 87 dc 06 88 00    	mov    0x8806dc(%edi),%eax
+  804872:	83 c4 10             	add    $0x10,%esp
+  804875:	85 c0                	test   %eax,%eax
+  804877:	74 11                	je     80488a <worker+0x1cd>
+			lock_release(&w->w_o->o_lock, 0);
+  804879:	83 ec 08             	sub    $0x8,%esp
+  80487c:	6a 00                	push   $0x0
+  80487e:	83 c0 10             	add    $0x10,%eax
+  804881:	50                   	push   %eax
+  804882:	e8 af 04 00 00       	call   804d36 <lock_release>
+  804887:	83 c4 10             	add    $0x10,%esp
+		while (w->w_npins > 0)
+  80488a:	8d 9f c0 06 88 00    	lea    0x8806c0(%edi),%ebx
+  804890:	8b b5 cc fe ff ff    	mov    -0x134(%ebp),%esi
+  804896:	eb 3d                	jmp    8048d5 <worker+0x218>
+			ipc_sendv(w->w_whom, r, reply, nreply);
+  804898:	ff b5 e0 fe ff ff    	push   -0x120(%ebp)
+  80489e:	8d 95 e8 fe ff ff    	lea    -0x118(%ebp),%edx
+  8048a4:	52                   	push   %edx
+  8048a5:	50                   	push   %eax
+  8048a6:	ff b7 c4 06 88 00    	push   0x8806c4(%edi)
+  8048ac:	e8 27 1b 00 00       	call   8063d8 <ipc_sendv>
+  8048b1:	83 c4 10             	add    $0x10,%esp
+  8048b4:	eb 82                	jmp    804838 <worker+0x17b>
+			bc_unpin(w->w_pins[--w->w_npins]);
+  8048b6:	83 e8 01             	sub    $0x1,%eax
+  8048b9:	89 83 24 01 00 00    	mov    %eax,0x124(%ebx)
+  8048bf:	83 ec 0c             	sub    $0xc,%esp
+  8048c2:	8d 44 30 08          	lea    0x8(%eax,%esi,1),%eax
+  8048c6:	ff 34 85 c4 06 88 00 	push   0x8806c4(,%eax,4)
+  8048cd:	e8 8e c0 ff ff       	call   800960 <bc_unpin>
+  8048d2:	83 c4 10             	add    $0x10,%esp
+		while (w->w_npins > 0)
+  8048d5:	8b 83 24 01 00 00    	mov    0x124(%ebx),%eax
+  8048db:	85 c0                	test   %eax,%eax
+  8048dd:	7f d7                	jg     8048b6 <worker+0x1f9>
+  8048df:	8b b5 d0 fe ff ff    	mov    -0x130(%ebp),%esi
+		for (i = 0; i < w->w_npages; i++)
+  8048e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8048ea:	8d 87 c0 06 88 00    	lea    0x8806c0(%edi),%eax
+  8048f0:	89 bd d4 fe ff ff    	mov    %edi,-0x12c(%ebp)
+  8048f6:	89 c7                	mov    %eax,%edi
+  8048f8:	eb 17                	jmp    804911 <worker+0x254>
+			sys_page_unmap(0, (char *) ipc + i * PGSIZE);
+  8048fa:	83 ec 08             	sub    $0x8,%esp
+  8048fd:	56                   	push   %esi
+  8048fe:	6a 00                	push   $0x0
+  804900:	e8 70 15 00 00       	call   805e75 <sys_page_unmap>
+		for (i = 0; i < w->w_npages; i++)
+  804905:	83 c3 01             	add    $0x1,%ebx
+  804908:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80490e:	83 c4 10             	add    $0x10,%esp
+  804911:	39 5f 10             	cmp    %ebx,0x10(%edi)
+  804914:	7f e4                	jg     8048fa <worker+0x23d>
+		w->w_busy = false;
+  804916:	8b bd d4 fe ff ff    	mov    -0x12c(%ebp),%edi
+  80491c:	c6 87 c0 06 88 00 00 	movb   $0x0,0x8806c0(%edi)
+		while (!w->w_busy)
+  804923:	e9 d0 fd ff ff       	jmp    8046f8 <worker+0x3b>
+
+00804928 <serve>:
+// next request in the kernel, but no longer than until the periodic
+// write-back is due, so that dirty data does not sit in memory while
+// the server is idle.
+void
+serve(void)
+{
+  804928:	55                   	push   %ebp
+  804929:	89 e5                	mov    %esp,%ebp
+  80492b:	57                   	push   %edi
+  80492c:	56                   	push   %esi
+  80492d:	53                   	push   %ebx
+  80492e:	83 ec 1c             	sub    $0x1c,%esp
+	struct Worker *w;
+	int i, nbusy;
+
+	for (i = 0; i < FS_NTHREADS; i++)
+  804931:	bb 00 00 00 00       	mov    $0x0,%ebx
+		thread_create(worker, i);
+  804936:	83 ec 08             	sub    $0x8,%esp
+  804939:	53                   	push   %ebx
+  80493a:	68 bd 46 80 00       	push   $0x8046bd
+  80493f:	e8 a8 02 00 00       	call   804bec <thread_create>
+	for (i = 0; i < FS_NTHREADS; i++)
+  804944:	83 c3 01             	add    $0x1,%ebx
+  804947:	83 c4 10             	add    $0x10,%esp
+  80494a:	83 fb 08             	cmp    $0x8,%ebx
+  80494d:	75 e7                	jne    804936 <serve+0xe>
+
+	w = NULL;
+  80494f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804956:	bf 00 10 88 00       	mov    $0x881000,%edi
+  80495b:	eb 55                	jmp    8049b2 <serve+0x8a>
+	while (1) {
+		for (i = nbusy = 0; i < FS_NTHREADS; i++)
+			if (workers[i].w_busy)
+				nbusy++;
+			else if (!w) {
+  80495d:	85 c0                	test   %eax,%eax
+  80495f:	74 17                	je     804978 <serve+0x50>
+		for (i = nbusy = 0; i < FS_NTHREADS; i++)
+  804961:	81 c3 28 01 00 00    	add    $0x128,%ebx
+  804967:	39 fb                	cmp    %edi,%ebx
+  804969:	74 2a                	je     804995 <serve+0x6d>
+			if (workers[i].w_busy)
+  80496b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80496e:	80 3b 00             	cmpb   $0x0,(%ebx)
+  804971:	74 ea                	je     80495d <serve+0x35>
+				nbusy++;
+  804973:	83 c6 01             	add    $0x1,%esi
+  804976:	eb e9                	jmp    804961 <serve+0x39>
+				w = &workers[i];
+				sys_ipc_recvv(worker_req(w), 1 + FSBULK_MAXPAGES,
+  804978:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80497b:	e8 e6 ed ff ff       	call   803766 <worker_req>
+  804980:	83 ec 04             	sub    $0x4,%esp
+  804983:	6a 01                	push   $0x1
+  804985:	6a 41                	push   $0x41
+  804987:	50                   	push   %eax
+  804988:	e8 60 16 00 00       	call   805fed <sys_ipc_recvv>
+  80498d:	83 c4 10             	add    $0x10,%esp
+				w = &workers[i];
+  804990:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804993:	eb cc                	jmp    804961 <serve+0x39>
+					      IPC_NOWAIT);
+			}
+
+		if (!w || thisenv->env_ipc_recving) {
+  804995:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804998:	85 c0                	test   %eax,%eax
+  80499a:	74 0d                	je     8049a9 <serve+0x81>
+  80499c:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  8049a1:	0f b6 58 68          	movzbl 0x68(%eax),%ebx
+  8049a5:	84 db                	test   %bl,%bl
+  8049a7:	74 79                	je     804a22 <serve+0xfa>
+			if (nbusy > 0)
+  8049a9:	85 f6                	test   %esi,%esi
+  8049ab:	7e 14                	jle    8049c1 <serve+0x99>
+				thread_yield();
+  8049ad:	e8 c2 02 00 00       	call   804c74 <thread_yield>
+		for (i = nbusy = 0; i < FS_NTHREADS; i++)
+  8049b2:	bb c0 06 88 00       	mov    $0x8806c0,%ebx
+  8049b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8049bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8049bf:	eb a6                	jmp    804967 <serve+0x3f>
+			else if (sys_ipc_recv_until(worker_req(w), 1 + FSBULK_MAXPAGES,
+  8049c1:	e8 8e e6 ff ff       	call   803054 <fs_tick_due>
+  8049c6:	89 c6                	mov    %eax,%esi
+  8049c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8049cb:	e8 96 ed ff ff       	call   803766 <worker_req>
+  8049d0:	89 c3                	mov    %eax,%ebx
+  8049d2:	83 ec 04             	sub    $0x4,%esp
+  8049d5:	56                   	push   %esi
+  8049d6:	6a 41                	push   $0x41
+  8049d8:	50                   	push   %eax
+  8049d9:	e8 66 16 00 00       	call   806044 <sys_ipc_recv_until>
+  8049de:	83 c4 10             	add    $0x10,%esp
+  8049e1:	83 f8 ef             	cmp    $0xffffffef,%eax
+  8049e4:	75 cc                	jne    8049b2 <serve+0x8a>
+						    fs_tick_due()) == -E_TIMEOUT) {
+				// Idle past the write-back deadline: do it
+				// now, then go back to receiving.
+				lock_acquire(&fs_lock, false);
+  8049e6:	83 ec 08             	sub    $0x8,%esp
+  8049e9:	6a 00                	push   $0x0
+  8049eb:	68 a0 06 88 00       	push   $0x8806a0
+  8049f0:	e8 20 03 00 00       	call   804d15 <lock_acquire>
+				fs_tick(true);
+  8049f5:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8049fc:	e8 01 e6 ff ff       	call   803002 <fs_tick>
+				lock_release(&fs_lock, false);
+  804a01:	83 c4 08             	add    $0x8,%esp
+  804a04:	6a 00                	push   $0x0
+  804a06:	68 a0 06 88 00       	push   $0x8806a0
+  804a0b:	e8 26 03 00 00       	call   804d36 <lock_release>
+				sys_ipc_recvv(worker_req(w), 1 + FSBULK_MAXPAGES,
+  804a10:	83 c4 0c             	add    $0xc,%esp
+  804a13:	6a 01                	push   $0x1
+  804a15:	6a 41                	push   $0x41
+  804a17:	53                   	push   %ebx
+  804a18:	e8 d0 15 00 00       	call   805fed <sys_ipc_recvv>
+  804a1d:	83 c4 10             	add    $0x10,%esp
+  804a20:	eb 90                	jmp    8049b2 <serve+0x8a>
+					      IPC_NOWAIT);
+			}
+			continue;
+		}
+
+		w->w_whom = thisenv->env_ipc_from;
+  804a22:	8b 48 74             	mov    0x74(%eax),%ecx
+  804a25:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  804a28:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  804a2b:	89 4a 04             	mov    %ecx,0x4(%edx)
+		w->w_req = thisenv->env_ipc_value;
+  804a2e:	8b 70 70             	mov    0x70(%eax),%esi
+  804a31:	89 d1                	mov    %edx,%ecx
+  804a33:	89 72 08             	mov    %esi,0x8(%edx)
+		w->w_perm = thisenv->env_ipc_perm;
+  804a36:	8b 50 78             	mov    0x78(%eax),%edx
+  804a39:	89 51 0c             	mov    %edx,0xc(%ecx)
+		w->w_npages = thisenv->env_ipc_npages;
+  804a3c:	8b 40 7c             	mov    0x7c(%eax),%eax
+  804a3f:	89 41 10             	mov    %eax,0x10(%ecx)
+			cprintf("fs req %d from %08x [page %08x: %s]\n",
+				w->w_req, w->w_whom, uvpt[PGNUM(worker_req(w))],
+				worker_req(w));
+
+		// All requests must contain an argument page
+		if (!(w->w_perm & PTE_P)) {
+  804a42:	f6 c2 01             	test   $0x1,%dl
+  804a45:	74 1b                	je     804a62 <serve+0x13a>
+			sys_ipc_recvv(worker_req(w), 1 + FSBULK_MAXPAGES,
+				      IPC_NOWAIT);
+			continue; // just leave it hanging...
+		}
+
+		w->w_o = req_openfile(w->w_req, worker_req(w));
+  804a47:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804a4a:	e8 17 ed ff ff       	call   803766 <worker_req>
+  804a4f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	switch (req) {
+  804a52:	83 fe 0e             	cmp    $0xe,%esi
+  804a55:	0f 87 eb 00 00 00    	ja     804b46 <serve+0x21e>
+  804a5b:	ff 24 b5 28 8e 80 00 	jmp    *0x808e28(,%esi,4)
+			cprintf("Invalid request from %08x: no argument page\n",
+  804a62:	83 ec 08             	sub    $0x8,%esp
+  804a65:	ff 75 e0             	push   -0x20(%ebp)
+  804a68:	68 f8 8d 80 00       	push   $0x808df8
+  804a6d:	e8 7c 09 00 00       	call   8053ee <cprintf>
+			sys_ipc_recvv(worker_req(w), 1 + FSBULK_MAXPAGES,
+  804a72:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804a75:	e8 ec ec ff ff       	call   803766 <worker_req>
+  804a7a:	83 c4 0c             	add    $0xc,%esp
+  804a7d:	6a 01                	push   $0x1
+  804a7f:	6a 41                	push   $0x41
+  804a81:	50                   	push   %eax
+  804a82:	e8 66 15 00 00       	call   805fed <sys_ipc_recvv>
+			continue; // just leave it hanging...
+  804a87:	83 c4 10             	add    $0x10,%esp
+  804a8a:	e9 23 ff ff ff       	jmp    8049b2 <serve+0x8a>
+	case FSREQ_READ:	fileid = ipc->read.req_fileid; break;
+  804a8f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804a92:	8b 00                	mov    (%eax),%eax
+	return &opentab[fileid % MAXOPEN];
+  804a94:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804a99:	6b c0 6c             	imul   $0x6c,%eax,%eax
+  804a9c:	8d 90 80 a0 80 00    	lea    0x80a080(%eax),%edx
+  804aa2:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  804aa5:	89 56 1c             	mov    %edx,0x1c(%esi)
+		if (w->w_o)
+			w->w_oticket = lock_ticket(&w->w_o->o_lock);
+  804aa8:	83 ec 0c             	sub    $0xc,%esp
+  804aab:	05 90 a0 80 00       	add    $0x80a090,%eax
+  804ab0:	50                   	push   %eax
+  804ab1:	e8 0b 02 00 00       	call   804cc1 <lock_ticket>
+  804ab6:	89 46 20             	mov    %eax,0x20(%esi)
+  804ab9:	83 c4 10             	add    $0x10,%esp
+		w->w_shared = req_is_shared(w->w_req, worker_req(w));
+  804abc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804abf:	8b 48 08             	mov    0x8(%eax),%ecx
+	switch (req) {
+  804ac2:	83 f9 11             	cmp    $0x11,%ecx
+  804ac5:	77 17                	ja     804ade <serve+0x1b6>
+  804ac7:	b8 01 00 00 00       	mov    $0x1,%eax
+  804acc:	d3 e0                	shl    %cl,%eax
+  804ace:	a9 28 c2 02 00       	test   $0x2c228,%eax
+  804ad3:	0f 85 91 00 00 00    	jne    804b6a <serve+0x242>
+  804ad9:	83 f9 01             	cmp    $0x1,%ecx
+  804adc:	74 77                	je     804b55 <serve+0x22d>
+		w->w_shared = req_is_shared(w->w_req, worker_req(w));
+  804ade:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  804ae1:	88 5e 14             	mov    %bl,0x14(%esi)
+		w->w_ticket = lock_ticket(&fs_lock);
+  804ae4:	83 ec 0c             	sub    $0xc,%esp
+  804ae7:	68 a0 06 88 00       	push   $0x8806a0
+  804aec:	e8 d0 01 00 00       	call   804cc1 <lock_ticket>
+  804af1:	89 46 18             	mov    %eax,0x18(%esi)
+		w->w_busy = true;
+  804af4:	c6 06 01             	movb   $0x1,(%esi)
+  804af7:	83 c4 10             	add    $0x10,%esp
+		w = NULL;
+  804afa:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804b01:	e9 ac fe ff ff       	jmp    8049b2 <serve+0x8a>
+	case FSREQ_WRITE:	fileid = ipc->write.req_fileid; break;
+  804b06:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804b09:	8b 00                	mov    (%eax),%eax
+  804b0b:	eb 87                	jmp    804a94 <serve+0x16c>
+	case FSREQ_STAT:	fileid = ipc->stat.req_fileid; break;
+  804b0d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804b10:	8b 00                	mov    (%eax),%eax
+  804b12:	eb 80                	jmp    804a94 <serve+0x16c>
+	case FSREQ_FLUSH:	fileid = ipc->flush.req_fileid; break;
+  804b14:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804b17:	8b 00                	mov    (%eax),%eax
+  804b19:	e9 76 ff ff ff       	jmp    804a94 <serve+0x16c>
+	case FSREQ_SET_SIZE:	fileid = ipc->set_size.req_fileid; break;
+  804b1e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804b21:	8b 00                	mov    (%eax),%eax
+  804b23:	e9 6c ff ff ff       	jmp    804a94 <serve+0x16c>
+	case FSREQ_WRITE_BULK:	fileid = ipc->bulk.req_fileid; break;
+  804b28:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804b2b:	8b 00                	mov    (%eax),%eax
+  804b2d:	e9 62 ff ff ff       	jmp    804a94 <serve+0x16c>
+	case FSREQ_MAP:		fileid = ipc->map.req_fileid; break;
+  804b32:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804b35:	8b 00                	mov    (%eax),%eax
+  804b37:	e9 58 ff ff ff       	jmp    804a94 <serve+0x16c>
+	case FSREQ_READDIR:	fileid = ipc->readdir.req_fileid; break;
+  804b3c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804b3f:	8b 00                	mov    (%eax),%eax
+  804b41:	e9 4e ff ff ff       	jmp    804a94 <serve+0x16c>
+		w->w_o = req_openfile(w->w_req, worker_req(w));
+  804b46:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804b49:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+		if (w->w_o)
+  804b50:	e9 67 ff ff ff       	jmp    804abc <serve+0x194>
+		return !(ipc->open.req_omode & (O_CREAT | O_TRUNC | O_MKDIR));
+  804b55:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804b58:	f7 80 00 04 00 00 00 	testl  $0xb00,0x400(%eax)
+  804b5f:	0b 00 00 
+  804b62:	0f 94 c3             	sete   %bl
+  804b65:	e9 74 ff ff ff       	jmp    804ade <serve+0x1b6>
+		return true;
+  804b6a:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804b6f:	e9 6a ff ff ff       	jmp    804ade <serve+0x1b6>
+
+00804b74 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  804b74:	55                   	push   %ebp
+  804b75:	89 e5                	mov    %esp,%ebp
+  804b77:	83 ec 14             	sub    $0x14,%esp
+	static_assert(sizeof(struct File) == 256);
+	binaryname = "fs";
+  804b7a:	c7 05 84 50 82 00 b3 	movl   $0x808db3,0x825084
+  804b81:	8d 80 00 
+	cprintf("FS is running\n");
+  804b84:	68 b6 8d 80 00       	push   $0x808db6
+  804b89:	e8 60 08 00 00       	call   8053ee <cprintf>
+	asm volatile("outw %0,%w1" : : "a" (data), "d" (port));
+  804b8e:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  804b93:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  804b98:	66 ef                	out    %ax,(%dx)
+
+	// Check that we are able to do I/O
+	outw(0x8A00, 0x8A00);
+	cprintf("FS can do I/O\n");
+  804b9a:	c7 04 24 c5 8d 80 00 	movl   $0x808dc5,(%esp)
+  804ba1:	e8 48 08 00 00       	call   8053ee <cprintf>
+
+	serve_init();
+  804ba6:	e8 8a ef ff ff       	call   803b35 <serve_init>
+	fs_init();
+  804bab:	e8 d2 d1 ff ff       	call   801d82 <fs_init>
+	serve();
+  804bb0:	e8 73 fd ff ff       	call   804928 <serve>
+
+00804bb5 <thread_start>:
+
+void thread_switch(uint32_t *save_esp, uint32_t esp);
+
+static void
+thread_start(void)
+{
+  804bb5:	55                   	push   %ebp
+  804bb6:	89 e5                	mov    %esp,%ebp
+  804bb8:	83 ec 14             	sub    $0x14,%esp
+	struct Thread *t = &threads[curthread];
+  804bbb:	8b 15 00 10 8a 00    	mov    0x8a1000,%edx
+
+	t->t_fn(t->t_arg);
+  804bc1:	8d 04 12             	lea    (%edx,%edx,1),%eax
+  804bc4:	8d 0c 10             	lea    (%eax,%edx,1),%ecx
+  804bc7:	ff 34 8d 28 10 8a 00 	push   0x8a1028(,%ecx,4)
+  804bce:	ff 14 8d 24 10 8a 00 	call   *0x8a1024(,%ecx,4)
+	panic("thread %d returned", curthread);
+  804bd5:	ff 35 00 10 8a 00    	push   0x8a1000
+  804bdb:	68 64 8e 80 00       	push   $0x808e64
+  804be0:	6a 20                	push   $0x20
+  804be2:	68 77 8e 80 00       	push   $0x808e77
+  804be7:	e8 27 07 00 00       	call   805313 <_panic>
+
+00804bec <thread_create>:
+
+// Start a thread running fn(arg).  It first runs when another thread
+// yields.
+void
+thread_create(void (*fn)(int), int arg)
+{
+  804bec:	55                   	push   %ebp
+  804bed:	89 e5                	mov    %esp,%ebp
+  804bef:	57                   	push   %edi
+  804bf0:	56                   	push   %esi
+  804bf1:	53                   	push   %ebx
+  804bf2:	83 ec 0c             	sub    $0xc,%esp
+	struct Thread *t;
+	uint32_t *sp;
+
+	if (nthreads == ARRAY_SIZE(threads))
+  804bf5:	8b 35 80 50 82 00    	mov    0x825080,%esi
+  804bfb:	83 fe 09             	cmp    $0x9,%esi
+  804bfe:	74 60                	je     804c60 <thread_create+0x74>
+		panic("thread_create: too many threads");
+	t = &threads[nthreads];
+	t->t_fn = fn;
+  804c00:	8d 3c 36             	lea    (%esi,%esi,1),%edi
+  804c03:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  804c06:	8d 04 85 20 10 8a 00 	lea    0x8a1020(,%eax,4),%eax
+  804c0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  804c10:	89 50 04             	mov    %edx,0x4(%eax)
+	t->t_arg = arg;
+  804c13:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804c16:	89 50 08             	mov    %edx,0x8(%eax)
+
+	// Lay out the frame thread_switch expects to pop: four callee-saved
+	// registers, then the address to return to.
+	sp = (uint32_t *) (thread_stacks[nthreads - 1] + FS_STACKSIZE);
+  804c19:	89 f0                	mov    %esi,%eax
+  804c1b:	c1 e0 0e             	shl    $0xe,%eax
+	*--sp = 0;			// return address for thread_start
+  804c1e:	c7 80 fc 0f 88 00 00 	movl   $0x0,0x880ffc(%eax)
+  804c25:	00 00 00 
+	*--sp = (uint32_t) thread_start;
+  804c28:	c7 80 f8 0f 88 00 b5 	movl   $0x804bb5,0x880ff8(%eax)
+  804c2f:	4b 80 00 
+	sp -= 4;
+  804c32:	8d 98 e8 0f 88 00    	lea    0x880fe8(%eax),%ebx
+	memset(sp, 0, 4 * sizeof(uint32_t));
+  804c38:	83 ec 04             	sub    $0x4,%esp
+  804c3b:	6a 10                	push   $0x10
+  804c3d:	6a 00                	push   $0x0
+  804c3f:	53                   	push   %ebx
+  804c40:	e8 e8 0e 00 00       	call   805b2d <memset>
+	t->t_esp = (uint32_t) sp;
+  804c45:	01 f7                	add    %esi,%edi
+  804c47:	89 1c bd 20 10 8a 00 	mov    %ebx,0x8a1020(,%edi,4)
+	nthreads++;
+  804c4e:	83 05 80 50 82 00 01 	addl   $0x1,0x825080
+}
+  804c55:	83 c4 10             	add    $0x10,%esp
+  804c58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804c5b:	5b                   	pop    %ebx
+  804c5c:	5e                   	pop    %esi
+  804c5d:	5f                   	pop    %edi
+  804c5e:	5d                   	pop    %ebp
+  804c5f:	c3                   	ret
+		panic("thread_create: too many threads");
+  804c60:	83 ec 04             	sub    $0x4,%esp
+  804c63:	68 84 8e 80 00       	push   $0x808e84
+  804c68:	6a 2c                	push   $0x2c
+  804c6a:	68 77 8e 80 00       	push   $0x808e77
+  804c6f:	e8 9f 06 00 00       	call   805313 <_panic>
+
+00804c74 <thread_yield>:
+void
+thread_yield(void)
+{
+	int prev = curthread;
+
+	if (nthreads == 1)
+  804c74:	8b 0d 80 50 82 00    	mov    0x825080,%ecx
+  804c7a:	83 f9 01             	cmp    $0x1,%ecx
+  804c7d:	74 3b                	je     804cba <thread_yield+0x46>
+{
+  804c7f:	55                   	push   %ebp
+  804c80:	89 e5                	mov    %esp,%ebp
+  804c82:	53                   	push   %ebx
+  804c83:	83 ec 0c             	sub    $0xc,%esp
+	int prev = curthread;
+  804c86:	8b 1d 00 10 8a 00    	mov    0x8a1000,%ebx
+		return;
+	curthread = (curthread + 1) % nthreads;
+  804c8c:	8d 43 01             	lea    0x1(%ebx),%eax
+  804c8f:	99                   	cltd
+  804c90:	f7 f9                	idiv   %ecx
+  804c92:	89 15 00 10 8a 00    	mov    %edx,0x8a1000
+	thread_switch(&threads[prev].t_esp, threads[curthread].t_esp);
+  804c98:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  804c9b:	ff 34 85 20 10 8a 00 	push   0x8a1020(,%eax,4)
+  804ca2:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  804ca5:	8d 04 85 20 10 8a 00 	lea    0x8a1020(,%eax,4),%eax
+  804cac:	50                   	push   %eax
+  804cad:	e8 bf 00 00 00       	call   804d71 <thread_switch>
+  804cb2:	83 c4 10             	add    $0x10,%esp
+}
+  804cb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804cb8:	c9                   	leave
+  804cb9:	c3                   	ret
+  804cba:	c3                   	ret
+
+00804cbb <thread_current>:
+// Return the number of the running thread, 0 through FS_NTHREADS.
+int
+thread_current(void)
+{
+	return curthread;
+}
+  804cbb:	a1 00 10 8a 00       	mov    0x8a1000,%eax
+  804cc0:	c3                   	ret
+
+00804cc1 <lock_ticket>:
+// Taking a ticket and waiting for it are separate steps, so that one
+// thread can queue up work in order for others to do.
+
+uint32_t
+lock_ticket(struct Lock *l)
+{
+  804cc1:	55                   	push   %ebp
+  804cc2:	89 e5                	mov    %esp,%ebp
+  804cc4:	8b 55 08             	mov    0x8(%ebp),%edx
+	return l->l_next++;
+  804cc7:	8b 02                	mov    (%edx),%eax
+  804cc9:	8d 48 01             	lea    0x1(%eax),%ecx
+  804ccc:	89 0a                	mov    %ecx,(%edx)
+}
+  804cce:	5d                   	pop    %ebp
+  804ccf:	c3                   	ret
+
+00804cd0 <lock_wait>:
+
+// Wait until 'ticket' is let in, then hold l.
+void
+lock_wait(struct Lock *l, uint32_t ticket, bool shared)
+{
+  804cd0:	55                   	push   %ebp
+  804cd1:	89 e5                	mov    %esp,%ebp
+  804cd3:	57                   	push   %edi
+  804cd4:	56                   	push   %esi
+  804cd5:	53                   	push   %ebx
+  804cd6:	83 ec 0c             	sub    $0xc,%esp
+  804cd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804cdc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  804cdf:	8b 7d 10             	mov    0x10(%ebp),%edi
+	while (l->l_serving != ticket)
+  804ce2:	eb 05                	jmp    804ce9 <lock_wait+0x19>
+		thread_yield();
+  804ce4:	e8 8b ff ff ff       	call   804c74 <thread_yield>
+	while (l->l_serving != ticket)
+  804ce9:	8b 43 04             	mov    0x4(%ebx),%eax
+  804cec:	39 f0                	cmp    %esi,%eax
+  804cee:	75 f4                	jne    804ce4 <lock_wait+0x14>
+	if (shared) {
+  804cf0:	89 fa                	mov    %edi,%edx
+  804cf2:	84 d2                	test   %dl,%dl
+  804cf4:	74 12                	je     804d08 <lock_wait+0x38>
+		l->l_readers++;
+  804cf6:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+		l->l_serving++;
+  804cfa:	83 c0 01             	add    $0x1,%eax
+  804cfd:	89 43 04             	mov    %eax,0x4(%ebx)
+	} else
+		while (l->l_readers > 0)
+			thread_yield();
+}
+  804d00:	83 c4 0c             	add    $0xc,%esp
+  804d03:	5b                   	pop    %ebx
+  804d04:	5e                   	pop    %esi
+  804d05:	5f                   	pop    %edi
+  804d06:	5d                   	pop    %ebp
+  804d07:	c3                   	ret
+		while (l->l_readers > 0)
+  804d08:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+  804d0c:	7e f2                	jle    804d00 <lock_wait+0x30>
+			thread_yield();
+  804d0e:	e8 61 ff ff ff       	call   804c74 <thread_yield>
+  804d13:	eb f3                	jmp    804d08 <lock_wait+0x38>
+
+00804d15 <lock_acquire>:
+
+void
+lock_acquire(struct Lock *l, bool shared)
+{
+  804d15:	55                   	push   %ebp
+  804d16:	89 e5                	mov    %esp,%ebp
+  804d18:	83 ec 0c             	sub    $0xc,%esp
+  804d1b:	8b 45 08             	mov    0x8(%ebp),%eax
+	return l->l_next++;
+  804d1e:	8b 10                	mov    (%eax),%edx
+  804d20:	8d 4a 01             	lea    0x1(%edx),%ecx
+  804d23:	89 08                	mov    %ecx,(%eax)
+	lock_wait(l, lock_ticket(l), shared);
+  804d25:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  804d29:	51                   	push   %ecx
+  804d2a:	52                   	push   %edx
+  804d2b:	50                   	push   %eax
+  804d2c:	e8 9f ff ff ff       	call   804cd0 <lock_wait>
+}
+  804d31:	83 c4 10             	add    $0x10,%esp
+  804d34:	c9                   	leave
+  804d35:	c3                   	ret
+
+00804d36 <lock_release>:
+
+void
+lock_release(struct Lock *l, bool shared)
+{
+  804d36:	55                   	push   %ebp
+  804d37:	89 e5                	mov    %esp,%ebp
+  804d39:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (shared)
+  804d3c:	80 7d 0c 00          	cmpb   $0x0,0xc(%ebp)
+  804d40:	74 06                	je     804d48 <lock_release+0x12>
+		l->l_readers--;
+  804d42:	83 68 08 01          	subl   $0x1,0x8(%eax)
+	else
+		l->l_serving++;
+}
+  804d46:	5d                   	pop    %ebp
+  804d47:	c3                   	ret
+		l->l_serving++;
+  804d48:	83 40 04 01          	addl   $0x1,0x4(%eax)
+}
+  804d4c:	eb f8                	jmp    804d46 <lock_release+0x10>
+
+00804d4e <lock_busy>:
+
+// Is anyone holding or waiting for l?
+bool
+lock_busy(struct Lock *l)
+{
+  804d4e:	55                   	push   %ebp
+  804d4f:	89 e5                	mov    %esp,%ebp
+  804d51:	8b 55 08             	mov    0x8(%ebp),%edx
+	return l->l_next != l->l_serving || l->l_readers > 0;
+  804d54:	b8 01 00 00 00       	mov    $0x1,%eax
+  804d59:	8b 4a 04             	mov    0x4(%edx),%ecx
+  804d5c:	39 0a                	cmp    %ecx,(%edx)
+  804d5e:	74 05                	je     804d65 <lock_busy+0x17>
+  804d60:	83 e0 01             	and    $0x1,%eax
+}
+  804d63:	5d                   	pop    %ebp
+  804d64:	c3                   	ret
+	return l->l_next != l->l_serving || l->l_readers > 0;
+  804d65:	83 7a 08 00          	cmpl   $0x0,0x8(%edx)
+  804d69:	0f 9f c0             	setg   %al
+  804d6c:	0f b6 c0             	movzbl %al,%eax
+  804d6f:	eb ef                	jmp    804d60 <lock_busy+0x12>
+
+00804d71 <thread_switch>:
+// pointer in *save_esp, then switch to the stack at esp and return into
+// whatever thread saved it.
+.text
+.globl thread_switch
+thread_switch:
+	movl	4(%esp), %eax
+  804d71:	8b 44 24 04          	mov    0x4(%esp),%eax
+	movl	8(%esp), %edx
+  804d75:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+	pushl	%ebp
+  804d79:	55                   	push   %ebp
+	pushl	%ebx
+  804d7a:	53                   	push   %ebx
+	pushl	%esi
+  804d7b:	56                   	push   %esi
+	pushl	%edi
+  804d7c:	57                   	push   %edi
+	movl	%esp, (%eax)
+  804d7d:	89 20                	mov    %esp,(%eax)
+
+	movl	%edx, %esp
+  804d7f:	89 d4                	mov    %edx,%esp
+	popl	%edi
+  804d81:	5f                   	pop    %edi
+	popl	%esi
+  804d82:	5e                   	pop    %esi
+	popl	%ebx
+  804d83:	5b                   	pop    %ebx
+	popl	%ebp
+  804d84:	5d                   	pop    %ebp
+	ret
+  804d85:	c3                   	ret
+
+00804d86 <bc_resume>:
+// the address of the faulting instruction.  Call bc_fill as if that
+// instruction had, preserving every register and the flags, then go
+// back and retry it.
+.globl bc_resume
+bc_resume:
+	pushal
+  804d86:	60                   	pusha
+	pushfl
+  804d87:	9c                   	pushf
+	cld
+  804d88:	fc                   	cld
+	pushl	36(%esp)		// faulting address
+  804d89:	ff 74 24 24          	push   0x24(%esp)
+	call	bc_fill
+  804d8d:	e8 ac bc ff ff       	call   800a3e <bc_fill>
+	addl	$4, %esp
+  804d92:	83 c4 04             	add    $0x4,%esp
+	popfl
+  804d95:	9d                   	popf
+	popal
+  804d96:	61                   	popa
+	leal	4(%esp), %esp		// drop the address without touching flags
+  804d97:	8d 64 24 04          	lea    0x4(%esp),%esp
+	ret
+  804d9b:	c3                   	ret
+
+00804d9c <fs_test>:
+
+static char *msg = "This is the NEW message of the day!\n\n";
+
+void
+fs_test(void)
+{
+  804d9c:	55                   	push   %ebp
+  804d9d:	89 e5                	mov    %esp,%ebp
+  804d9f:	53                   	push   %ebx
+  804da0:	83 ec 58             	sub    $0x58,%esp
+	char *blk, buf[64];
+	uint32_t *bits;
+	uint32_t bno;
+
+	// back up bitmap
+	if ((r = sys_page_alloc(0, (void*) PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  804da3:	6a 07                	push   $0x7
+  804da5:	68 00 10 00 00       	push   $0x1000
+  804daa:	6a 00                	push   $0x0
+  804dac:	e8 37 10 00 00       	call   805de8 <sys_page_alloc>
+  804db1:	83 c4 10             	add    $0x10,%esp
+  804db4:	85 c0                	test   %eax,%eax
+  804db6:	0f 88 f1 02 00 00    	js     8050ad <fs_test+0x311>
+		panic("sys_page_alloc: %e", r);
+	bits = (uint32_t*) PGSIZE;
+	memmove(bits, bitmap, PGSIZE);
+  804dbc:	83 ec 04             	sub    $0x4,%esp
+  804dbf:	68 00 10 00 00       	push   $0x1000
+  804dc4:	ff 35 20 01 86 00    	push   0x860120
+  804dca:	68 00 10 00 00       	push   $0x1000
+  804dcf:	e8 8e 0d 00 00       	call   805b62 <memmove>
+	// allocate block
+	if ((r = alloc_block(&bno)) < 0)
+  804dd4:	8d 45 ac             	lea    -0x54(%ebp),%eax
+  804dd7:	89 04 24             	mov    %eax,(%esp)
+  804dda:	e8 d6 ce ff ff       	call   801cb5 <alloc_block>
+  804ddf:	83 c4 10             	add    $0x10,%esp
+  804de2:	85 c0                	test   %eax,%eax
+  804de4:	0f 88 d5 02 00 00    	js     8050bf <fs_test+0x323>
+		panic("alloc_block: %e", r);
+	// check that block was free
+	assert(bits[bno/32] & (1 << (bno%32)));
+  804dea:	8b 4d ac             	mov    -0x54(%ebp),%ecx
+  804ded:	89 ca                	mov    %ecx,%edx
+  804def:	c1 ea 05             	shr    $0x5,%edx
+  804df2:	b8 01 00 00 00       	mov    $0x1,%eax
+  804df7:	d3 e0                	shl    %cl,%eax
+  804df9:	89 c1                	mov    %eax,%ecx
+  804dfb:	23 0c 95 00 10 00 00 	and    0x1000(,%edx,4),%ecx
+  804e02:	0f 84 c9 02 00 00    	je     8050d1 <fs_test+0x335>
+	// and is not free any more
+	assert(!(bitmap[bno/32] & (1 << (bno%32))));
+  804e08:	8b 0d 20 01 86 00    	mov    0x860120,%ecx
+  804e0e:	23 04 91             	and    (%ecx,%edx,4),%eax
+  804e11:	0f 85 d0 02 00 00    	jne    8050e7 <fs_test+0x34b>
+	cprintf("alloc_block is good\n");
+  804e17:	83 ec 0c             	sub    $0xc,%esp
+  804e1a:	68 be 8e 80 00       	push   $0x808ebe
+  804e1f:	e8 ca 05 00 00       	call   8053ee <cprintf>
+
+	if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  804e24:	83 c4 08             	add    $0x8,%esp
+  804e27:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804e2a:	50                   	push   %eax
+  804e2b:	68 d3 8e 80 00       	push   $0x808ed3
+  804e30:	e8 d0 d8 ff ff       	call   802705 <file_open>
+  804e35:	83 c4 10             	add    $0x10,%esp
+  804e38:	85 c0                	test   %eax,%eax
+  804e3a:	0f 88 bd 02 00 00    	js     8050fd <fs_test+0x361>
+		panic("file_open /not-found: %e", r);
+	else if (r == 0)
+  804e40:	0f 84 d2 02 00 00    	je     805118 <fs_test+0x37c>
+		panic("file_open /not-found succeeded!");
+	if ((r = file_open("/newmotd", &f)) < 0)
+  804e46:	83 ec 08             	sub    $0x8,%esp
+  804e49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804e4c:	50                   	push   %eax
+  804e4d:	68 f7 8e 80 00       	push   $0x808ef7
+  804e52:	e8 ae d8 ff ff       	call   802705 <file_open>
+  804e57:	83 c4 10             	add    $0x10,%esp
+  804e5a:	85 c0                	test   %eax,%eax
+  804e5c:	0f 88 ca 02 00 00    	js     80512c <fs_test+0x390>
+		panic("file_open /newmotd: %e", r);
+	cprintf("file_open is good\n");
+  804e62:	83 ec 0c             	sub    $0xc,%esp
+  804e65:	68 17 8f 80 00       	push   $0x808f17
+  804e6a:	e8 7f 05 00 00       	call   8053ee <cprintf>
+
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  804e6f:	83 c4 0c             	add    $0xc,%esp
+  804e72:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  804e75:	50                   	push   %eax
+  804e76:	6a 00                	push   $0x0
+  804e78:	ff 75 f4             	push   -0xc(%ebp)
+  804e7b:	e8 a5 d2 ff ff       	call   802125 <file_get_block>
+  804e80:	83 c4 10             	add    $0x10,%esp
+  804e83:	85 c0                	test   %eax,%eax
+  804e85:	0f 88 b3 02 00 00    	js     80513e <fs_test+0x3a2>
+		panic("file_get_block: %e", r);
+	if (strcmp(blk, msg) != 0)
+  804e8b:	83 ec 08             	sub    $0x8,%esp
+  804e8e:	68 94 90 80 00       	push   $0x809094
+  804e93:	ff 75 f0             	push   -0x10(%ebp)
+  804e96:	e8 f2 0b 00 00       	call   805a8d <strcmp>
+  804e9b:	83 c4 10             	add    $0x10,%esp
+  804e9e:	85 c0                	test   %eax,%eax
+  804ea0:	0f 85 aa 02 00 00    	jne    805150 <fs_test+0x3b4>
+		panic("file_get_block returned wrong data");
+	cprintf("file_get_block is good\n");
+  804ea6:	83 ec 0c             	sub    $0xc,%esp
+  804ea9:	68 3d 8f 80 00       	push   $0x808f3d
+  804eae:	e8 3b 05 00 00       	call   8053ee <cprintf>
+
+	*(volatile char*)blk = *(volatile char*)blk;
+  804eb3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804eb6:	0f b6 10             	movzbl (%eax),%edx
+  804eb9:	88 10                	mov    %dl,(%eax)
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  804ebb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804ebe:	c1 e8 0c             	shr    $0xc,%eax
+  804ec1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804ec8:	83 c4 10             	add    $0x10,%esp
+  804ecb:	a8 40                	test   $0x40,%al
+  804ecd:	0f 84 91 02 00 00    	je     805164 <fs_test+0x3c8>
+	file_flush(f);
+  804ed3:	83 ec 0c             	sub    $0xc,%esp
+  804ed6:	ff 75 f4             	push   -0xc(%ebp)
+  804ed9:	e8 02 da ff ff       	call   8028e0 <file_flush>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  804ede:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804ee1:	c1 e8 0c             	shr    $0xc,%eax
+  804ee4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804eeb:	83 c4 10             	add    $0x10,%esp
+  804eee:	a8 40                	test   $0x40,%al
+  804ef0:	0f 85 84 02 00 00    	jne    80517a <fs_test+0x3de>
+	cprintf("file_flush is good\n");
+  804ef6:	83 ec 0c             	sub    $0xc,%esp
+  804ef9:	68 71 8f 80 00       	push   $0x808f71
+  804efe:	e8 eb 04 00 00       	call   8053ee <cprintf>
+
+	if ((r = file_set_size(f, 0)) < 0)
+  804f03:	83 c4 08             	add    $0x8,%esp
+  804f06:	6a 00                	push   $0x0
+  804f08:	ff 75 f4             	push   -0xc(%ebp)
+  804f0b:	e8 d7 d8 ff ff       	call   8027e7 <file_set_size>
+  804f10:	83 c4 10             	add    $0x10,%esp
+  804f13:	85 c0                	test   %eax,%eax
+  804f15:	0f 88 75 02 00 00    	js     805190 <fs_test+0x3f4>
+		panic("file_set_size: %e", r);
+	assert(f->f_direct[0] == 0);
+  804f1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804f1e:	83 b8 88 00 00 00 00 	cmpl   $0x0,0x88(%eax)
+  804f25:	0f 85 77 02 00 00    	jne    8051a2 <fs_test+0x406>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  804f2b:	c1 e8 0c             	shr    $0xc,%eax
+  804f2e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804f35:	a8 40                	test   $0x40,%al
+  804f37:	0f 85 7b 02 00 00    	jne    8051b8 <fs_test+0x41c>
+	cprintf("file_truncate is good\n");
+  804f3d:	83 ec 0c             	sub    $0xc,%esp
+  804f40:	68 c5 8f 80 00       	push   $0x808fc5
+  804f45:	e8 a4 04 00 00       	call   8053ee <cprintf>
+
+	if ((r = file_set_size(f, strlen(msg))) < 0)
+  804f4a:	c7 04 24 94 90 80 00 	movl   $0x809094,(%esp)
+  804f51:	e8 4b 0a 00 00       	call   8059a1 <strlen>
+  804f56:	83 c4 08             	add    $0x8,%esp
+  804f59:	50                   	push   %eax
+  804f5a:	ff 75 f4             	push   -0xc(%ebp)
+  804f5d:	e8 85 d8 ff ff       	call   8027e7 <file_set_size>
+  804f62:	83 c4 10             	add    $0x10,%esp
+  804f65:	85 c0                	test   %eax,%eax
+  804f67:	0f 88 61 02 00 00    	js     8051ce <fs_test+0x432>
+		panic("file_set_size 2: %e", r);
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  804f6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804f70:	89 c2                	mov    %eax,%edx
+  804f72:	c1 ea 0c             	shr    $0xc,%edx
+  804f75:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  804f7c:	f6 c2 40             	test   $0x40,%dl
+  804f7f:	0f 85 5b 02 00 00    	jne    8051e0 <fs_test+0x444>
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  804f85:	83 ec 04             	sub    $0x4,%esp
+  804f88:	8d 55 f0             	lea    -0x10(%ebp),%edx
+  804f8b:	52                   	push   %edx
+  804f8c:	6a 00                	push   $0x0
+  804f8e:	50                   	push   %eax
+  804f8f:	e8 91 d1 ff ff       	call   802125 <file_get_block>
+  804f94:	83 c4 10             	add    $0x10,%esp
+  804f97:	85 c0                	test   %eax,%eax
+  804f99:	0f 88 57 02 00 00    	js     8051f6 <fs_test+0x45a>
+		panic("file_get_block 2: %e", r);
+	strcpy(blk, msg);
+  804f9f:	83 ec 08             	sub    $0x8,%esp
+  804fa2:	68 94 90 80 00       	push   $0x809094
+  804fa7:	ff 75 f0             	push   -0x10(%ebp)
+  804faa:	e8 2d 0a 00 00       	call   8059dc <strcpy>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  804faf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804fb2:	c1 e8 0c             	shr    $0xc,%eax
+  804fb5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804fbc:	83 c4 10             	add    $0x10,%esp
+  804fbf:	a8 40                	test   $0x40,%al
+  804fc1:	0f 84 41 02 00 00    	je     805208 <fs_test+0x46c>
+	// The block is delayed: no disk block yet, but readable
+	assert(f->f_direct[0] == 0);
+  804fc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804fca:	83 b8 88 00 00 00 00 	cmpl   $0x0,0x88(%eax)
+  804fd1:	0f 85 47 02 00 00    	jne    80521e <fs_test+0x482>
+	memset(buf, 0, sizeof(buf));
+  804fd7:	83 ec 04             	sub    $0x4,%esp
+  804fda:	6a 40                	push   $0x40
+  804fdc:	6a 00                	push   $0x0
+  804fde:	8d 5d b0             	lea    -0x50(%ebp),%ebx
+  804fe1:	53                   	push   %ebx
+  804fe2:	e8 46 0b 00 00       	call   805b2d <memset>
+	if ((r = file_read(f, buf, sizeof(buf), 0)) != strlen(msg))
+  804fe7:	6a 00                	push   $0x0
+  804fe9:	6a 40                	push   $0x40
+  804feb:	53                   	push   %ebx
+  804fec:	ff 75 f4             	push   -0xc(%ebp)
+  804fef:	e8 2b d7 ff ff       	call   80271f <file_read>
+  804ff4:	89 c3                	mov    %eax,%ebx
+  804ff6:	83 c4 14             	add    $0x14,%esp
+  804ff9:	68 94 90 80 00       	push   $0x809094
+  804ffe:	e8 9e 09 00 00       	call   8059a1 <strlen>
+  805003:	83 c4 10             	add    $0x10,%esp
+  805006:	39 d8                	cmp    %ebx,%eax
+  805008:	0f 85 26 02 00 00    	jne    805234 <fs_test+0x498>
+		panic("file_read of delayed block: %e", r);
+	if (strcmp(buf, msg) != 0)
+  80500e:	83 ec 08             	sub    $0x8,%esp
+  805011:	68 94 90 80 00       	push   $0x809094
+  805016:	8d 45 b0             	lea    -0x50(%ebp),%eax
+  805019:	50                   	push   %eax
+  80501a:	e8 6e 0a 00 00       	call   805a8d <strcmp>
+  80501f:	83 c4 10             	add    $0x10,%esp
+  805022:	85 c0                	test   %eax,%eax
+  805024:	0f 85 1c 02 00 00    	jne    805246 <fs_test+0x4aa>
+		panic("file_read of delayed block returned wrong data");
+	file_flush(f);
+  80502a:	83 ec 0c             	sub    $0xc,%esp
+  80502d:	ff 75 f4             	push   -0xc(%ebp)
+  805030:	e8 ab d8 ff ff       	call   8028e0 <file_flush>
+	assert(f->f_direct[0] != 0);
+  805035:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805038:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80503e:	83 c4 10             	add    $0x10,%esp
+  805041:	85 c0                	test   %eax,%eax
+  805043:	0f 84 11 02 00 00    	je     80525a <fs_test+0x4be>
+	blk = diskaddr(f->f_direct[0]);
+  805049:	83 ec 0c             	sub    $0xc,%esp
+  80504c:	50                   	push   %eax
+  80504d:	e8 16 b3 ff ff       	call   800368 <diskaddr>
+  805052:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	if (strcmp(blk, msg) != 0)
+  805055:	83 c4 08             	add    $0x8,%esp
+  805058:	68 94 90 80 00       	push   $0x809094
+  80505d:	50                   	push   %eax
+  80505e:	e8 2a 0a 00 00       	call   805a8d <strcmp>
+  805063:	83 c4 10             	add    $0x10,%esp
+  805066:	85 c0                	test   %eax,%eax
+  805068:	0f 85 02 02 00 00    	jne    805270 <fs_test+0x4d4>
+		panic("file_flush committed wrong data");
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  80506e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  805071:	c1 e8 0c             	shr    $0xc,%eax
+  805074:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80507b:	a8 40                	test   $0x40,%al
+  80507d:	0f 85 01 02 00 00    	jne    805284 <fs_test+0x4e8>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  805083:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805086:	c1 e8 0c             	shr    $0xc,%eax
+  805089:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  805090:	a8 40                	test   $0x40,%al
+  805092:	0f 85 02 02 00 00    	jne    80529a <fs_test+0x4fe>
+	cprintf("file rewrite is good\n");
+  805098:	83 ec 0c             	sub    $0xc,%esp
+  80509b:	68 19 90 80 00       	push   $0x809019
+  8050a0:	e8 49 03 00 00       	call   8053ee <cprintf>
+}
+  8050a5:	83 c4 10             	add    $0x10,%esp
+  8050a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8050ab:	c9                   	leave
+  8050ac:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  8050ad:	50                   	push   %eax
+  8050ae:	68 91 8b 80 00       	push   $0x808b91
+  8050b3:	6a 13                	push   $0x13
+  8050b5:	68 a4 8e 80 00       	push   $0x808ea4
+  8050ba:	e8 54 02 00 00       	call   805313 <_panic>
+		panic("alloc_block: %e", r);
+  8050bf:	50                   	push   %eax
+  8050c0:	68 ae 8e 80 00       	push   $0x808eae
+  8050c5:	6a 18                	push   $0x18
+  8050c7:	68 a4 8e 80 00       	push   $0x808ea4
+  8050cc:	e8 42 02 00 00       	call   805313 <_panic>
+	assert(bits[bno/32] & (1 << (bno%32)));
+  8050d1:	68 30 90 80 00       	push   $0x809030
+  8050d6:	68 fd 89 80 00       	push   $0x8089fd
+  8050db:	6a 1a                	push   $0x1a
+  8050dd:	68 a4 8e 80 00       	push   $0x808ea4
+  8050e2:	e8 2c 02 00 00       	call   805313 <_panic>
+	assert(!(bitmap[bno/32] & (1 << (bno%32))));
+  8050e7:	68 50 90 80 00       	push   $0x809050
+  8050ec:	68 fd 89 80 00       	push   $0x8089fd
+  8050f1:	6a 1c                	push   $0x1c
+  8050f3:	68 a4 8e 80 00       	push   $0x808ea4
+  8050f8:	e8 16 02 00 00       	call   805313 <_panic>
+	if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  8050fd:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  805100:	0f 84 40 fd ff ff    	je     804e46 <fs_test+0xaa>
+		panic("file_open /not-found: %e", r);
+  805106:	50                   	push   %eax
+  805107:	68 de 8e 80 00       	push   $0x808ede
+  80510c:	6a 20                	push   $0x20
+  80510e:	68 a4 8e 80 00       	push   $0x808ea4
+  805113:	e8 fb 01 00 00       	call   805313 <_panic>
+		panic("file_open /not-found succeeded!");
+  805118:	83 ec 04             	sub    $0x4,%esp
+  80511b:	68 74 90 80 00       	push   $0x809074
+  805120:	6a 22                	push   $0x22
+  805122:	68 a4 8e 80 00       	push   $0x808ea4
+  805127:	e8 e7 01 00 00       	call   805313 <_panic>
+		panic("file_open /newmotd: %e", r);
+  80512c:	50                   	push   %eax
+  80512d:	68 00 8f 80 00       	push   $0x808f00
+  805132:	6a 24                	push   $0x24
+  805134:	68 a4 8e 80 00       	push   $0x808ea4
+  805139:	e8 d5 01 00 00       	call   805313 <_panic>
+		panic("file_get_block: %e", r);
+  80513e:	50                   	push   %eax
+  80513f:	68 2a 8f 80 00       	push   $0x808f2a
+  805144:	6a 28                	push   $0x28
+  805146:	68 a4 8e 80 00       	push   $0x808ea4
+  80514b:	e8 c3 01 00 00       	call   805313 <_panic>
+		panic("file_get_block returned wrong data");
+  805150:	83 ec 04             	sub    $0x4,%esp
+  805153:	68 bc 90 80 00       	push   $0x8090bc
+  805158:	6a 2a                	push   $0x2a
+  80515a:	68 a4 8e 80 00       	push   $0x808ea4
+  80515f:	e8 af 01 00 00       	call   805313 <_panic>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  805164:	68 56 8f 80 00       	push   $0x808f56
+  805169:	68 fd 89 80 00       	push   $0x8089fd
+  80516e:	6a 2e                	push   $0x2e
+  805170:	68 a4 8e 80 00       	push   $0x808ea4
+  805175:	e8 99 01 00 00       	call   805313 <_panic>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  80517a:	68 55 8f 80 00       	push   $0x808f55
+  80517f:	68 fd 89 80 00       	push   $0x8089fd
+  805184:	6a 30                	push   $0x30
+  805186:	68 a4 8e 80 00       	push   $0x808ea4
+  80518b:	e8 83 01 00 00       	call   805313 <_panic>
+		panic("file_set_size: %e", r);
+  805190:	50                   	push   %eax
+  805191:	68 85 8f 80 00       	push   $0x808f85
+  805196:	6a 34                	push   $0x34
+  805198:	68 a4 8e 80 00       	push   $0x808ea4
+  80519d:	e8 71 01 00 00       	call   805313 <_panic>
+	assert(f->f_direct[0] == 0);
+  8051a2:	68 97 8f 80 00       	push   $0x808f97
+  8051a7:	68 fd 89 80 00       	push   $0x8089fd
+  8051ac:	6a 35                	push   $0x35
+  8051ae:	68 a4 8e 80 00       	push   $0x808ea4
+  8051b3:	e8 5b 01 00 00       	call   805313 <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  8051b8:	68 ab 8f 80 00       	push   $0x808fab
+  8051bd:	68 fd 89 80 00       	push   $0x8089fd
+  8051c2:	6a 36                	push   $0x36
+  8051c4:	68 a4 8e 80 00       	push   $0x808ea4
+  8051c9:	e8 45 01 00 00       	call   805313 <_panic>
+		panic("file_set_size 2: %e", r);
+  8051ce:	50                   	push   %eax
+  8051cf:	68 dc 8f 80 00       	push   $0x808fdc
+  8051d4:	6a 3a                	push   $0x3a
+  8051d6:	68 a4 8e 80 00       	push   $0x808ea4
+  8051db:	e8 33 01 00 00       	call   805313 <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  8051e0:	68 ab 8f 80 00       	push   $0x808fab
+  8051e5:	68 fd 89 80 00       	push   $0x8089fd
+  8051ea:	6a 3b                	push   $0x3b
+  8051ec:	68 a4 8e 80 00       	push   $0x808ea4
+  8051f1:	e8 1d 01 00 00       	call   805313 <_panic>
+		panic("file_get_block 2: %e", r);
+  8051f6:	50                   	push   %eax
+  8051f7:	68 f0 8f 80 00       	push   $0x808ff0
+  8051fc:	6a 3d                	push   $0x3d
+  8051fe:	68 a4 8e 80 00       	push   $0x808ea4
+  805203:	e8 0b 01 00 00       	call   805313 <_panic>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  805208:	68 56 8f 80 00       	push   $0x808f56
+  80520d:	68 fd 89 80 00       	push   $0x8089fd
+  805212:	6a 3f                	push   $0x3f
+  805214:	68 a4 8e 80 00       	push   $0x808ea4
+  805219:	e8 f5 00 00 00       	call   805313 <_panic>
+	assert(f->f_direct[0] == 0);
+  80521e:	68 97 8f 80 00       	push   $0x808f97
+  805223:	68 fd 89 80 00       	push   $0x8089fd
+  805228:	6a 41                	push   $0x41
+  80522a:	68 a4 8e 80 00       	push   $0x808ea4
+  80522f:	e8 df 00 00 00       	call   805313 <_panic>
+		panic("file_read of delayed block: %e", r);
+  805234:	53                   	push   %ebx
+  805235:	68 e0 90 80 00       	push   $0x8090e0
+  80523a:	6a 44                	push   $0x44
+  80523c:	68 a4 8e 80 00       	push   $0x808ea4
+  805241:	e8 cd 00 00 00       	call   805313 <_panic>
+		panic("file_read of delayed block returned wrong data");
+  805246:	83 ec 04             	sub    $0x4,%esp
+  805249:	68 00 91 80 00       	push   $0x809100
+  80524e:	6a 46                	push   $0x46
+  805250:	68 a4 8e 80 00       	push   $0x808ea4
+  805255:	e8 b9 00 00 00       	call   805313 <_panic>
+	assert(f->f_direct[0] != 0);
+  80525a:	68 05 90 80 00       	push   $0x809005
+  80525f:	68 fd 89 80 00       	push   $0x8089fd
+  805264:	6a 48                	push   $0x48
+  805266:	68 a4 8e 80 00       	push   $0x808ea4
+  80526b:	e8 a3 00 00 00       	call   805313 <_panic>
+		panic("file_flush committed wrong data");
+  805270:	83 ec 04             	sub    $0x4,%esp
+  805273:	68 30 91 80 00       	push   $0x809130
+  805278:	6a 4b                	push   $0x4b
+  80527a:	68 a4 8e 80 00       	push   $0x808ea4
+  80527f:	e8 8f 00 00 00       	call   805313 <_panic>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  805284:	68 55 8f 80 00       	push   $0x808f55
+  805289:	68 fd 89 80 00       	push   $0x8089fd
+  80528e:	6a 4c                	push   $0x4c
+  805290:	68 a4 8e 80 00       	push   $0x808ea4
+  805295:	e8 79 00 00 00       	call   805313 <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  80529a:	68 ab 8f 80 00       	push   $0x808fab
+  80529f:	68 fd 89 80 00       	push   $0x8089fd
+  8052a4:	6a 4d                	push   $0x4d
+  8052a6:	68 a4 8e 80 00       	push   $0x808ea4
+  8052ab:	e8 63 00 00 00       	call   805313 <_panic>
+
+008052b0 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8052b0:	55                   	push   %ebp
+  8052b1:	89 e5                	mov    %esp,%ebp
+  8052b3:	56                   	push   %esi
+  8052b4:	53                   	push   %ebx
+  8052b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8052b8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8052bb:	e8 e2 0a 00 00       	call   805da2 <sys_getenvid>
+  8052c0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8052c5:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8052cb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8052d0:	a3 8c 10 8a 00       	mov    %eax,0x8a108c
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8052d5:	85 db                	test   %ebx,%ebx
+  8052d7:	7e 07                	jle    8052e0 <libmain+0x30>
+		binaryname = argv[0];
+  8052d9:	8b 06                	mov    (%esi),%eax
+  8052db:	a3 84 50 82 00       	mov    %eax,0x825084
+
+	// call user main routine
+	umain(argc, argv);
+  8052e0:	83 ec 08             	sub    $0x8,%esp
+  8052e3:	56                   	push   %esi
+  8052e4:	53                   	push   %ebx
+  8052e5:	e8 8a f8 ff ff       	call   804b74 <umain>
+
+	// exit gracefully
+	exit();
+  8052ea:	e8 0a 00 00 00       	call   8052f9 <exit>
+}
+  8052ef:	83 c4 10             	add    $0x10,%esp
+  8052f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8052f5:	5b                   	pop    %ebx
+  8052f6:	5e                   	pop    %esi
+  8052f7:	5d                   	pop    %ebp
+  8052f8:	c3                   	ret
+
+008052f9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8052f9:	55                   	push   %ebp
+  8052fa:	89 e5                	mov    %esp,%ebp
+  8052fc:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8052ff:	e8 35 13 00 00       	call   806639 <close_all>
+	sys_env_destroy(0);
+  805304:	83 ec 0c             	sub    $0xc,%esp
+  805307:	6a 00                	push   $0x0
+  805309:	e8 4b 0a 00 00       	call   805d59 <sys_env_destroy>
+}
+  80530e:	83 c4 10             	add    $0x10,%esp
+  805311:	c9                   	leave
+  805312:	c3                   	ret
+
+00805313 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  805313:	55                   	push   %ebp
+  805314:	89 e5                	mov    %esp,%ebp
+  805316:	56                   	push   %esi
+  805317:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  805318:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80531b:	8b 35 84 50 82 00    	mov    0x825084,%esi
+  805321:	e8 7c 0a 00 00       	call   805da2 <sys_getenvid>
+  805326:	83 ec 0c             	sub    $0xc,%esp
+  805329:	ff 75 0c             	push   0xc(%ebp)
+  80532c:	ff 75 08             	push   0x8(%ebp)
+  80532f:	56                   	push   %esi
+  805330:	50                   	push   %eax
+  805331:	68 5c 91 80 00       	push   $0x80915c
+  805336:	e8 b3 00 00 00       	call   8053ee <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80533b:	83 c4 18             	add    $0x18,%esp
+  80533e:	53                   	push   %ebx
+  80533f:	ff 75 10             	push   0x10(%ebp)
+  805342:	e8 56 00 00 00       	call   80539d <vcprintf>
+	cprintf("\n");
+  805347:	c7 04 24 0e 8c 80 00 	movl   $0x808c0e,(%esp)
+  80534e:	e8 9b 00 00 00       	call   8053ee <cprintf>
+  805353:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  805356:	cc                   	int3
+	while (1)
+  805357:	eb fd                	jmp    805356 <_panic+0x43>
+
+00805359 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  805359:	55                   	push   %ebp
+  80535a:	89 e5                	mov    %esp,%ebp
+  80535c:	53                   	push   %ebx
+  80535d:	83 ec 04             	sub    $0x4,%esp
+  805360:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  805363:	8b 13                	mov    (%ebx),%edx
+  805365:	8d 42 01             	lea    0x1(%edx),%eax
+  805368:	89 03                	mov    %eax,(%ebx)
+  80536a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80536d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  805371:	3d ff 00 00 00       	cmp    $0xff,%eax
+  805376:	74 09                	je     805381 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  805378:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80537c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80537f:	c9                   	leave
+  805380:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  805381:	83 ec 08             	sub    $0x8,%esp
+  805384:	68 ff 00 00 00       	push   $0xff
+  805389:	8d 43 08             	lea    0x8(%ebx),%eax
+  80538c:	50                   	push   %eax
+  80538d:	e8 7a 09 00 00       	call   805d0c <sys_cputs>
+		b->idx = 0;
+  805392:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805398:	83 c4 10             	add    $0x10,%esp
+  80539b:	eb db                	jmp    805378 <putch+0x1f>
+
+0080539d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80539d:	55                   	push   %ebp
+  80539e:	89 e5                	mov    %esp,%ebp
+  8053a0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8053a6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8053ad:	00 00 00 
+	b.cnt = 0;
+  8053b0:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8053b7:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8053ba:	ff 75 0c             	push   0xc(%ebp)
+  8053bd:	ff 75 08             	push   0x8(%ebp)
+  8053c0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8053c6:	50                   	push   %eax
+  8053c7:	68 59 53 80 00       	push   $0x805359
+  8053cc:	e8 14 01 00 00       	call   8054e5 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8053d1:	83 c4 08             	add    $0x8,%esp
+  8053d4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8053da:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8053e0:	50                   	push   %eax
+  8053e1:	e8 26 09 00 00       	call   805d0c <sys_cputs>
+
+	return b.cnt;
+}
+  8053e6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8053ec:	c9                   	leave
+  8053ed:	c3                   	ret
+
+008053ee <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8053ee:	55                   	push   %ebp
+  8053ef:	89 e5                	mov    %esp,%ebp
+  8053f1:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8053f4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8053f7:	50                   	push   %eax
+  8053f8:	ff 75 08             	push   0x8(%ebp)
+  8053fb:	e8 9d ff ff ff       	call   80539d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  805400:	c9                   	leave
+  805401:	c3                   	ret
+
+00805402 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  805402:	55                   	push   %ebp
+  805403:	89 e5                	mov    %esp,%ebp
+  805405:	57                   	push   %edi
+  805406:	56                   	push   %esi
+  805407:	53                   	push   %ebx
+  805408:	83 ec 1c             	sub    $0x1c,%esp
+  80540b:	89 c7                	mov    %eax,%edi
+  80540d:	89 d6                	mov    %edx,%esi
+  80540f:	8b 45 08             	mov    0x8(%ebp),%eax
+  805412:	8b 55 0c             	mov    0xc(%ebp),%edx
+  805415:	89 d1                	mov    %edx,%ecx
+  805417:	89 c2                	mov    %eax,%edx
+  805419:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80541c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80541f:	8b 45 10             	mov    0x10(%ebp),%eax
+  805422:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  805425:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  805428:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80542f:	39 c2                	cmp    %eax,%edx
+  805431:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  805434:	72 3e                	jb     805474 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  805436:	83 ec 0c             	sub    $0xc,%esp
+  805439:	ff 75 18             	push   0x18(%ebp)
+  80543c:	83 eb 01             	sub    $0x1,%ebx
+  80543f:	53                   	push   %ebx
+  805440:	50                   	push   %eax
+  805441:	83 ec 08             	sub    $0x8,%esp
+  805444:	ff 75 e4             	push   -0x1c(%ebp)
+  805447:	ff 75 e0             	push   -0x20(%ebp)
+  80544a:	ff 75 dc             	push   -0x24(%ebp)
+  80544d:	ff 75 d8             	push   -0x28(%ebp)
+  805450:	e8 f1 33 00 00       	call   808846 <__udivdi3>
+  805455:	83 c4 18             	add    $0x18,%esp
+  805458:	52                   	push   %edx
+  805459:	50                   	push   %eax
+  80545a:	89 f2                	mov    %esi,%edx
+  80545c:	89 f8                	mov    %edi,%eax
+  80545e:	e8 9f ff ff ff       	call   805402 <printnum>
+  805463:	83 c4 20             	add    $0x20,%esp
+  805466:	eb 13                	jmp    80547b <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  805468:	83 ec 08             	sub    $0x8,%esp
+  80546b:	56                   	push   %esi
+  80546c:	ff 75 18             	push   0x18(%ebp)
+  80546f:	ff d7                	call   *%edi
+  805471:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  805474:	83 eb 01             	sub    $0x1,%ebx
+  805477:	85 db                	test   %ebx,%ebx
+  805479:	7f ed                	jg     805468 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80547b:	83 ec 08             	sub    $0x8,%esp
+  80547e:	56                   	push   %esi
+  80547f:	83 ec 04             	sub    $0x4,%esp
+  805482:	ff 75 e4             	push   -0x1c(%ebp)
+  805485:	ff 75 e0             	push   -0x20(%ebp)
+  805488:	ff 75 dc             	push   -0x24(%ebp)
+  80548b:	ff 75 d8             	push   -0x28(%ebp)
+  80548e:	e8 d1 33 00 00       	call   808864 <__umoddi3>
+  805493:	83 c4 14             	add    $0x14,%esp
+  805496:	0f be 80 7f 91 80 00 	movsbl 0x80917f(%eax),%eax
+  80549d:	50                   	push   %eax
+  80549e:	ff d7                	call   *%edi
+}
+  8054a0:	83 c4 10             	add    $0x10,%esp
+  8054a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8054a6:	5b                   	pop    %ebx
+  8054a7:	5e                   	pop    %esi
+  8054a8:	5f                   	pop    %edi
+  8054a9:	5d                   	pop    %ebp
+  8054aa:	c3                   	ret
+
+008054ab <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8054ab:	55                   	push   %ebp
+  8054ac:	89 e5                	mov    %esp,%ebp
+  8054ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8054b1:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8054b5:	8b 10                	mov    (%eax),%edx
+  8054b7:	3b 50 04             	cmp    0x4(%eax),%edx
+  8054ba:	73 0a                	jae    8054c6 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8054bc:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8054bf:	89 08                	mov    %ecx,(%eax)
+  8054c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8054c4:	88 02                	mov    %al,(%edx)
+}
+  8054c6:	5d                   	pop    %ebp
+  8054c7:	c3                   	ret
+
+008054c8 <printfmt>:
+{
+  8054c8:	55                   	push   %ebp
+  8054c9:	89 e5                	mov    %esp,%ebp
+  8054cb:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8054ce:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8054d1:	50                   	push   %eax
+  8054d2:	ff 75 10             	push   0x10(%ebp)
+  8054d5:	ff 75 0c             	push   0xc(%ebp)
+  8054d8:	ff 75 08             	push   0x8(%ebp)
+  8054db:	e8 05 00 00 00       	call   8054e5 <vprintfmt>
+}
+  8054e0:	83 c4 10             	add    $0x10,%esp
+  8054e3:	c9                   	leave
+  8054e4:	c3                   	ret
+
+008054e5 <vprintfmt>:
+{
+  8054e5:	55                   	push   %ebp
+  8054e6:	89 e5                	mov    %esp,%ebp
+  8054e8:	57                   	push   %edi
+  8054e9:	56                   	push   %esi
+  8054ea:	53                   	push   %ebx
+  8054eb:	83 ec 2c             	sub    $0x2c,%esp
+  8054ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  8054f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8054f4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8054f7:	eb 0a                	jmp    805503 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8054f9:	83 ec 08             	sub    $0x8,%esp
+  8054fc:	53                   	push   %ebx
+  8054fd:	50                   	push   %eax
+  8054fe:	ff d6                	call   *%esi
+  805500:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  805503:	83 c7 01             	add    $0x1,%edi
+  805506:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80550a:	83 f8 25             	cmp    $0x25,%eax
+  80550d:	74 0c                	je     80551b <vprintfmt+0x36>
+			if (ch == '\0')
+  80550f:	85 c0                	test   %eax,%eax
+  805511:	75 e6                	jne    8054f9 <vprintfmt+0x14>
+}
+  805513:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805516:	5b                   	pop    %ebx
+  805517:	5e                   	pop    %esi
+  805518:	5f                   	pop    %edi
+  805519:	5d                   	pop    %ebp
+  80551a:	c3                   	ret
+		padc = ' ';
+  80551b:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80551f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  805526:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80552d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  805534:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  805539:	8d 47 01             	lea    0x1(%edi),%eax
+  80553c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80553f:	0f b6 17             	movzbl (%edi),%edx
+  805542:	8d 42 dd             	lea    -0x23(%edx),%eax
+  805545:	3c 55                	cmp    $0x55,%al
+  805547:	0f 87 cf 03 00 00    	ja     80591c <vprintfmt+0x437>
+  80554d:	0f b6 c0             	movzbl %al,%eax
+  805550:	ff 24 85 e0 92 80 00 	jmp    *0x8092e0(,%eax,4)
+  805557:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80555a:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80555e:	eb d9                	jmp    805539 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  805560:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  805563:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  805567:	eb d0                	jmp    805539 <vprintfmt+0x54>
+  805569:	0f b6 d2             	movzbl %dl,%edx
+  80556c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80556f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805574:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  805577:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80557a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80557e:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  805581:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  805584:	83 f9 09             	cmp    $0x9,%ecx
+  805587:	77 55                	ja     8055de <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  805589:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80558c:	eb e9                	jmp    805577 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80558e:	8b 45 14             	mov    0x14(%ebp),%eax
+  805591:	8b 00                	mov    (%eax),%eax
+  805593:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  805596:	8b 45 14             	mov    0x14(%ebp),%eax
+  805599:	8d 40 04             	lea    0x4(%eax),%eax
+  80559c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80559f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8055a2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8055a6:	79 91                	jns    805539 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8055a8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8055ab:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8055ae:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8055b5:	eb 82                	jmp    805539 <vprintfmt+0x54>
+			if (width < 0)
+  8055b7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8055ba:	85 d2                	test   %edx,%edx
+  8055bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055c1:	0f 49 c2             	cmovns %edx,%eax
+  8055c4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8055c7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8055ca:	e9 6a ff ff ff       	jmp    805539 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8055cf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8055d2:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8055d9:	e9 5b ff ff ff       	jmp    805539 <vprintfmt+0x54>
+  8055de:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8055e1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8055e4:	eb bc                	jmp    8055a2 <vprintfmt+0xbd>
+			lflag++;
+  8055e6:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8055e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8055ec:	e9 48 ff ff ff       	jmp    805539 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8055f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8055f4:	8d 78 04             	lea    0x4(%eax),%edi
+  8055f7:	83 ec 08             	sub    $0x8,%esp
+  8055fa:	53                   	push   %ebx
+  8055fb:	ff 30                	push   (%eax)
+  8055fd:	ff d6                	call   *%esi
+			break;
+  8055ff:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  805602:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  805605:	e9 b1 02 00 00       	jmp    8058bb <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80560a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80560d:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  805610:	8b 10                	mov    (%eax),%edx
+  805612:	89 d0                	mov    %edx,%eax
+  805614:	f7 d8                	neg    %eax
+  805616:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  805619:	83 f8 11             	cmp    $0x11,%eax
+  80561c:	7f 23                	jg     805641 <vprintfmt+0x15c>
+  80561e:	8b 14 85 40 94 80 00 	mov    0x809440(,%eax,4),%edx
+  805625:	85 d2                	test   %edx,%edx
+  805627:	74 18                	je     805641 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  805629:	52                   	push   %edx
+  80562a:	68 0f 8a 80 00       	push   $0x808a0f
+  80562f:	53                   	push   %ebx
+  805630:	56                   	push   %esi
+  805631:	e8 92 fe ff ff       	call   8054c8 <printfmt>
+  805636:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  805639:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80563c:	e9 7a 02 00 00       	jmp    8058bb <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  805641:	50                   	push   %eax
+  805642:	68 97 91 80 00       	push   $0x809197
+  805647:	53                   	push   %ebx
+  805648:	56                   	push   %esi
+  805649:	e8 7a fe ff ff       	call   8054c8 <printfmt>
+  80564e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  805651:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  805654:	e9 62 02 00 00       	jmp    8058bb <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  805659:	8b 45 14             	mov    0x14(%ebp),%eax
+  80565c:	83 c0 04             	add    $0x4,%eax
+  80565f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  805662:	8b 45 14             	mov    0x14(%ebp),%eax
+  805665:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  805667:	85 c9                	test   %ecx,%ecx
+  805669:	b8 90 91 80 00       	mov    $0x809190,%eax
+  80566e:	0f 45 c1             	cmovne %ecx,%eax
+  805671:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  805674:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  805678:	7e 06                	jle    805680 <vprintfmt+0x19b>
+  80567a:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80567e:	75 0b                	jne    80568b <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  805680:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  805683:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  805686:	89 75 08             	mov    %esi,0x8(%ebp)
+  805689:	eb 5c                	jmp    8056e7 <vprintfmt+0x202>
+  80568b:	83 ec 08             	sub    $0x8,%esp
+  80568e:	ff 75 d0             	push   -0x30(%ebp)
+  805691:	ff 75 cc             	push   -0x34(%ebp)
+  805694:	e8 20 03 00 00       	call   8059b9 <strnlen>
+  805699:	89 c2                	mov    %eax,%edx
+  80569b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80569e:	29 d0                	sub    %edx,%eax
+  8056a0:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8056a3:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8056a7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8056aa:	89 75 08             	mov    %esi,0x8(%ebp)
+  8056ad:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8056af:	eb 0e                	jmp    8056bf <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8056b1:	83 ec 08             	sub    $0x8,%esp
+  8056b4:	53                   	push   %ebx
+  8056b5:	57                   	push   %edi
+  8056b6:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8056b9:	83 ee 01             	sub    $0x1,%esi
+  8056bc:	83 c4 10             	add    $0x10,%esp
+  8056bf:	85 f6                	test   %esi,%esi
+  8056c1:	7f ee                	jg     8056b1 <vprintfmt+0x1cc>
+  8056c3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8056c6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8056c9:	85 c0                	test   %eax,%eax
+  8056cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8056d0:	0f 49 d0             	cmovns %eax,%edx
+  8056d3:	29 d0                	sub    %edx,%eax
+  8056d5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8056d8:	eb a6                	jmp    805680 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8056da:	83 ec 08             	sub    $0x8,%esp
+  8056dd:	53                   	push   %ebx
+  8056de:	52                   	push   %edx
+  8056df:	ff 55 08             	call   *0x8(%ebp)
+  8056e2:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8056e5:	89 f1                	mov    %esi,%ecx
+  8056e7:	8d 71 01             	lea    0x1(%ecx),%esi
+  8056ea:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8056ee:	0f be d0             	movsbl %al,%edx
+  8056f1:	85 d2                	test   %edx,%edx
+  8056f3:	74 28                	je     80571d <vprintfmt+0x238>
+  8056f5:	85 ff                	test   %edi,%edi
+  8056f7:	78 05                	js     8056fe <vprintfmt+0x219>
+  8056f9:	83 ef 01             	sub    $0x1,%edi
+  8056fc:	78 30                	js     80572e <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8056fe:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  805702:	74 d6                	je     8056da <vprintfmt+0x1f5>
+  805704:	0f be c0             	movsbl %al,%eax
+  805707:	83 e8 20             	sub    $0x20,%eax
+  80570a:	83 f8 5e             	cmp    $0x5e,%eax
+  80570d:	76 cb                	jbe    8056da <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80570f:	83 ec 08             	sub    $0x8,%esp
+  805712:	53                   	push   %ebx
+  805713:	6a 3f                	push   $0x3f
+  805715:	ff 55 08             	call   *0x8(%ebp)
+  805718:	83 c4 10             	add    $0x10,%esp
+  80571b:	eb c8                	jmp    8056e5 <vprintfmt+0x200>
+  80571d:	8b 75 08             	mov    0x8(%ebp),%esi
+  805720:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  805723:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  805726:	01 d0                	add    %edx,%eax
+  805728:	29 c8                	sub    %ecx,%eax
+  80572a:	89 c7                	mov    %eax,%edi
+  80572c:	eb 13                	jmp    805741 <vprintfmt+0x25c>
+  80572e:	8b 75 08             	mov    0x8(%ebp),%esi
+  805731:	eb ed                	jmp    805720 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  805733:	83 ec 08             	sub    $0x8,%esp
+  805736:	53                   	push   %ebx
+  805737:	6a 20                	push   $0x20
+  805739:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80573b:	83 ef 01             	sub    $0x1,%edi
+  80573e:	83 c4 10             	add    $0x10,%esp
+  805741:	85 ff                	test   %edi,%edi
+  805743:	7f ee                	jg     805733 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  805745:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  805748:	89 45 14             	mov    %eax,0x14(%ebp)
+  80574b:	e9 6b 01 00 00       	jmp    8058bb <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  805750:	83 f9 01             	cmp    $0x1,%ecx
+  805753:	7f 1f                	jg     805774 <vprintfmt+0x28f>
+	else if (lflag)
+  805755:	85 c9                	test   %ecx,%ecx
+  805757:	74 67                	je     8057c0 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  805759:	8b 45 14             	mov    0x14(%ebp),%eax
+  80575c:	8b 00                	mov    (%eax),%eax
+  80575e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  805761:	89 c1                	mov    %eax,%ecx
+  805763:	c1 f9 1f             	sar    $0x1f,%ecx
+  805766:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  805769:	8b 45 14             	mov    0x14(%ebp),%eax
+  80576c:	8d 40 04             	lea    0x4(%eax),%eax
+  80576f:	89 45 14             	mov    %eax,0x14(%ebp)
+  805772:	eb 17                	jmp    80578b <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  805774:	8b 45 14             	mov    0x14(%ebp),%eax
+  805777:	8b 50 04             	mov    0x4(%eax),%edx
+  80577a:	8b 00                	mov    (%eax),%eax
+  80577c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80577f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  805782:	8b 45 14             	mov    0x14(%ebp),%eax
+  805785:	8d 40 08             	lea    0x8(%eax),%eax
+  805788:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80578b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80578e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  805791:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  805796:	85 c9                	test   %ecx,%ecx
+  805798:	0f 89 03 01 00 00    	jns    8058a1 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80579e:	83 ec 08             	sub    $0x8,%esp
+  8057a1:	53                   	push   %ebx
+  8057a2:	6a 2d                	push   $0x2d
+  8057a4:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8057a6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8057a9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8057ac:	f7 da                	neg    %edx
+  8057ae:	83 d1 00             	adc    $0x0,%ecx
+  8057b1:	f7 d9                	neg    %ecx
+  8057b3:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8057b6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8057bb:	e9 e1 00 00 00       	jmp    8058a1 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8057c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8057c3:	8b 00                	mov    (%eax),%eax
+  8057c5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8057c8:	89 c1                	mov    %eax,%ecx
+  8057ca:	c1 f9 1f             	sar    $0x1f,%ecx
+  8057cd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8057d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8057d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8057d6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8057d9:	eb b0                	jmp    80578b <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8057db:	83 f9 01             	cmp    $0x1,%ecx
+  8057de:	7f 1e                	jg     8057fe <vprintfmt+0x319>
+	else if (lflag)
+  8057e0:	85 c9                	test   %ecx,%ecx
+  8057e2:	74 32                	je     805816 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8057e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8057e7:	8b 10                	mov    (%eax),%edx
+  8057e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8057ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8057f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8057f4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8057f9:	e9 a3 00 00 00       	jmp    8058a1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8057fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  805801:	8b 10                	mov    (%eax),%edx
+  805803:	8b 48 04             	mov    0x4(%eax),%ecx
+  805806:	8d 40 08             	lea    0x8(%eax),%eax
+  805809:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80580c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  805811:	e9 8b 00 00 00       	jmp    8058a1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  805816:	8b 45 14             	mov    0x14(%ebp),%eax
+  805819:	8b 10                	mov    (%eax),%edx
+  80581b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805820:	8d 40 04             	lea    0x4(%eax),%eax
+  805823:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  805826:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80582b:	eb 74                	jmp    8058a1 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80582d:	83 f9 01             	cmp    $0x1,%ecx
+  805830:	7f 1b                	jg     80584d <vprintfmt+0x368>
+	else if (lflag)
+  805832:	85 c9                	test   %ecx,%ecx
+  805834:	74 2c                	je     805862 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  805836:	8b 45 14             	mov    0x14(%ebp),%eax
+  805839:	8b 10                	mov    (%eax),%edx
+  80583b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805840:	8d 40 04             	lea    0x4(%eax),%eax
+  805843:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  805846:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80584b:	eb 54                	jmp    8058a1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80584d:	8b 45 14             	mov    0x14(%ebp),%eax
+  805850:	8b 10                	mov    (%eax),%edx
+  805852:	8b 48 04             	mov    0x4(%eax),%ecx
+  805855:	8d 40 08             	lea    0x8(%eax),%eax
+  805858:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80585b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  805860:	eb 3f                	jmp    8058a1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  805862:	8b 45 14             	mov    0x14(%ebp),%eax
+  805865:	8b 10                	mov    (%eax),%edx
+  805867:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80586c:	8d 40 04             	lea    0x4(%eax),%eax
+  80586f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  805872:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  805877:	eb 28                	jmp    8058a1 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  805879:	83 ec 08             	sub    $0x8,%esp
+  80587c:	53                   	push   %ebx
+  80587d:	6a 30                	push   $0x30
+  80587f:	ff d6                	call   *%esi
+			putch('x', putdat);
+  805881:	83 c4 08             	add    $0x8,%esp
+  805884:	53                   	push   %ebx
+  805885:	6a 78                	push   $0x78
+  805887:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  805889:	8b 45 14             	mov    0x14(%ebp),%eax
+  80588c:	8b 10                	mov    (%eax),%edx
+  80588e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  805893:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  805896:	8d 40 04             	lea    0x4(%eax),%eax
+  805899:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80589c:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8058a1:	83 ec 0c             	sub    $0xc,%esp
+  8058a4:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8058a8:	50                   	push   %eax
+  8058a9:	ff 75 e0             	push   -0x20(%ebp)
+  8058ac:	57                   	push   %edi
+  8058ad:	51                   	push   %ecx
+  8058ae:	52                   	push   %edx
+  8058af:	89 da                	mov    %ebx,%edx
+  8058b1:	89 f0                	mov    %esi,%eax
+  8058b3:	e8 4a fb ff ff       	call   805402 <printnum>
+			break;
+  8058b8:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8058bb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8058be:	e9 40 fc ff ff       	jmp    805503 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8058c3:	83 f9 01             	cmp    $0x1,%ecx
+  8058c6:	7f 1b                	jg     8058e3 <vprintfmt+0x3fe>
+	else if (lflag)
+  8058c8:	85 c9                	test   %ecx,%ecx
+  8058ca:	74 2c                	je     8058f8 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8058cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8058cf:	8b 10                	mov    (%eax),%edx
+  8058d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8058d6:	8d 40 04             	lea    0x4(%eax),%eax
+  8058d9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8058dc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8058e1:	eb be                	jmp    8058a1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8058e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8058e6:	8b 10                	mov    (%eax),%edx
+  8058e8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8058eb:	8d 40 08             	lea    0x8(%eax),%eax
+  8058ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8058f1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8058f6:	eb a9                	jmp    8058a1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8058f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8058fb:	8b 10                	mov    (%eax),%edx
+  8058fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805902:	8d 40 04             	lea    0x4(%eax),%eax
+  805905:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  805908:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80590d:	eb 92                	jmp    8058a1 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80590f:	83 ec 08             	sub    $0x8,%esp
+  805912:	53                   	push   %ebx
+  805913:	6a 25                	push   $0x25
+  805915:	ff d6                	call   *%esi
+			break;
+  805917:	83 c4 10             	add    $0x10,%esp
+  80591a:	eb 9f                	jmp    8058bb <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80591c:	83 ec 08             	sub    $0x8,%esp
+  80591f:	53                   	push   %ebx
+  805920:	6a 25                	push   $0x25
+  805922:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  805924:	83 c4 10             	add    $0x10,%esp
+  805927:	89 f8                	mov    %edi,%eax
+  805929:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80592d:	74 05                	je     805934 <vprintfmt+0x44f>
+  80592f:	83 e8 01             	sub    $0x1,%eax
+  805932:	eb f5                	jmp    805929 <vprintfmt+0x444>
+  805934:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  805937:	eb 82                	jmp    8058bb <vprintfmt+0x3d6>
+
+00805939 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  805939:	55                   	push   %ebp
+  80593a:	89 e5                	mov    %esp,%ebp
+  80593c:	83 ec 18             	sub    $0x18,%esp
+  80593f:	8b 45 08             	mov    0x8(%ebp),%eax
+  805942:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  805945:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  805948:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80594c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80594f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  805956:	85 c0                	test   %eax,%eax
+  805958:	74 26                	je     805980 <vsnprintf+0x47>
+  80595a:	85 d2                	test   %edx,%edx
+  80595c:	7e 22                	jle    805980 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80595e:	ff 75 14             	push   0x14(%ebp)
+  805961:	ff 75 10             	push   0x10(%ebp)
+  805964:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  805967:	50                   	push   %eax
+  805968:	68 ab 54 80 00       	push   $0x8054ab
+  80596d:	e8 73 fb ff ff       	call   8054e5 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  805972:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  805975:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  805978:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80597b:	83 c4 10             	add    $0x10,%esp
+}
+  80597e:	c9                   	leave
+  80597f:	c3                   	ret
+		return -E_INVAL;
+  805980:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805985:	eb f7                	jmp    80597e <vsnprintf+0x45>
+
+00805987 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  805987:	55                   	push   %ebp
+  805988:	89 e5                	mov    %esp,%ebp
+  80598a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80598d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  805990:	50                   	push   %eax
+  805991:	ff 75 10             	push   0x10(%ebp)
+  805994:	ff 75 0c             	push   0xc(%ebp)
+  805997:	ff 75 08             	push   0x8(%ebp)
+  80599a:	e8 9a ff ff ff       	call   805939 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80599f:	c9                   	leave
+  8059a0:	c3                   	ret
+
+008059a1 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8059a1:	55                   	push   %ebp
+  8059a2:	89 e5                	mov    %esp,%ebp
+  8059a4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8059a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059ac:	eb 03                	jmp    8059b1 <strlen+0x10>
+		n++;
+  8059ae:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8059b1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8059b5:	75 f7                	jne    8059ae <strlen+0xd>
+	return n;
+}
+  8059b7:	5d                   	pop    %ebp
+  8059b8:	c3                   	ret
+
+008059b9 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8059b9:	55                   	push   %ebp
+  8059ba:	89 e5                	mov    %esp,%ebp
+  8059bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8059bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8059c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059c7:	eb 03                	jmp    8059cc <strnlen+0x13>
+		n++;
+  8059c9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8059cc:	39 d0                	cmp    %edx,%eax
+  8059ce:	74 08                	je     8059d8 <strnlen+0x1f>
+  8059d0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8059d4:	75 f3                	jne    8059c9 <strnlen+0x10>
+  8059d6:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8059d8:	89 d0                	mov    %edx,%eax
+  8059da:	5d                   	pop    %ebp
+  8059db:	c3                   	ret
+
+008059dc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8059dc:	55                   	push   %ebp
+  8059dd:	89 e5                	mov    %esp,%ebp
+  8059df:	53                   	push   %ebx
+  8059e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8059e3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8059e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059eb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8059ef:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8059f2:	83 c0 01             	add    $0x1,%eax
+  8059f5:	84 d2                	test   %dl,%dl
+  8059f7:	75 f2                	jne    8059eb <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8059f9:	89 c8                	mov    %ecx,%eax
+  8059fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8059fe:	c9                   	leave
+  8059ff:	c3                   	ret
+
+00805a00 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  805a00:	55                   	push   %ebp
+  805a01:	89 e5                	mov    %esp,%ebp
+  805a03:	53                   	push   %ebx
+  805a04:	83 ec 10             	sub    $0x10,%esp
+  805a07:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  805a0a:	53                   	push   %ebx
+  805a0b:	e8 91 ff ff ff       	call   8059a1 <strlen>
+  805a10:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  805a13:	ff 75 0c             	push   0xc(%ebp)
+  805a16:	01 d8                	add    %ebx,%eax
+  805a18:	50                   	push   %eax
+  805a19:	e8 be ff ff ff       	call   8059dc <strcpy>
+	return dst;
+}
+  805a1e:	89 d8                	mov    %ebx,%eax
+  805a20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805a23:	c9                   	leave
+  805a24:	c3                   	ret
+
+00805a25 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  805a25:	55                   	push   %ebp
+  805a26:	89 e5                	mov    %esp,%ebp
+  805a28:	56                   	push   %esi
+  805a29:	53                   	push   %ebx
+  805a2a:	8b 75 08             	mov    0x8(%ebp),%esi
+  805a2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  805a30:	89 f3                	mov    %esi,%ebx
+  805a32:	03 5d 10             	add    0x10(%ebp),%ebx
+  805a35:	89 f0                	mov    %esi,%eax
+  805a37:	eb 0f                	jmp    805a48 <strncpy+0x23>
+		*dst++ = *src;
+  805a39:	83 c0 01             	add    $0x1,%eax
+  805a3c:	0f b6 0a             	movzbl (%edx),%ecx
+  805a3f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  805a42:	80 f9 01             	cmp    $0x1,%cl
+  805a45:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  805a48:	39 d8                	cmp    %ebx,%eax
+  805a4a:	75 ed                	jne    805a39 <strncpy+0x14>
+	}
+	return ret;
+}
+  805a4c:	89 f0                	mov    %esi,%eax
+  805a4e:	5b                   	pop    %ebx
+  805a4f:	5e                   	pop    %esi
+  805a50:	5d                   	pop    %ebp
+  805a51:	c3                   	ret
+
+00805a52 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  805a52:	55                   	push   %ebp
+  805a53:	89 e5                	mov    %esp,%ebp
+  805a55:	56                   	push   %esi
+  805a56:	53                   	push   %ebx
+  805a57:	8b 75 08             	mov    0x8(%ebp),%esi
+  805a5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  805a5d:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  805a60:	89 f0                	mov    %esi,%eax
+  805a62:	85 d2                	test   %edx,%edx
+  805a64:	74 21                	je     805a87 <strlcpy+0x35>
+  805a66:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  805a6a:	89 f2                	mov    %esi,%edx
+  805a6c:	eb 09                	jmp    805a77 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  805a6e:	83 c1 01             	add    $0x1,%ecx
+  805a71:	83 c2 01             	add    $0x1,%edx
+  805a74:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  805a77:	39 c2                	cmp    %eax,%edx
+  805a79:	74 09                	je     805a84 <strlcpy+0x32>
+  805a7b:	0f b6 19             	movzbl (%ecx),%ebx
+  805a7e:	84 db                	test   %bl,%bl
+  805a80:	75 ec                	jne    805a6e <strlcpy+0x1c>
+  805a82:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  805a84:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  805a87:	29 f0                	sub    %esi,%eax
+}
+  805a89:	5b                   	pop    %ebx
+  805a8a:	5e                   	pop    %esi
+  805a8b:	5d                   	pop    %ebp
+  805a8c:	c3                   	ret
+
+00805a8d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  805a8d:	55                   	push   %ebp
+  805a8e:	89 e5                	mov    %esp,%ebp
+  805a90:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  805a93:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  805a96:	eb 06                	jmp    805a9e <strcmp+0x11>
+		p++, q++;
+  805a98:	83 c1 01             	add    $0x1,%ecx
+  805a9b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  805a9e:	0f b6 01             	movzbl (%ecx),%eax
+  805aa1:	84 c0                	test   %al,%al
+  805aa3:	74 04                	je     805aa9 <strcmp+0x1c>
+  805aa5:	3a 02                	cmp    (%edx),%al
+  805aa7:	74 ef                	je     805a98 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  805aa9:	0f b6 c0             	movzbl %al,%eax
+  805aac:	0f b6 12             	movzbl (%edx),%edx
+  805aaf:	29 d0                	sub    %edx,%eax
+}
+  805ab1:	5d                   	pop    %ebp
+  805ab2:	c3                   	ret
+
+00805ab3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  805ab3:	55                   	push   %ebp
+  805ab4:	89 e5                	mov    %esp,%ebp
+  805ab6:	53                   	push   %ebx
+  805ab7:	8b 45 08             	mov    0x8(%ebp),%eax
+  805aba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  805abd:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  805ac0:	eb 09                	jmp    805acb <strncmp+0x18>
+		n--, p++, q++;
+  805ac2:	83 ea 01             	sub    $0x1,%edx
+  805ac5:	83 c0 01             	add    $0x1,%eax
+  805ac8:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  805acb:	85 d2                	test   %edx,%edx
+  805acd:	74 18                	je     805ae7 <strncmp+0x34>
+  805acf:	0f b6 18             	movzbl (%eax),%ebx
+  805ad2:	84 db                	test   %bl,%bl
+  805ad4:	74 04                	je     805ada <strncmp+0x27>
+  805ad6:	3a 19                	cmp    (%ecx),%bl
+  805ad8:	74 e8                	je     805ac2 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  805ada:	0f b6 00             	movzbl (%eax),%eax
+  805add:	0f b6 11             	movzbl (%ecx),%edx
+  805ae0:	29 d0                	sub    %edx,%eax
+}
+  805ae2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805ae5:	c9                   	leave
+  805ae6:	c3                   	ret
+		return 0;
+  805ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  805aec:	eb f4                	jmp    805ae2 <strncmp+0x2f>
+
+00805aee <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  805aee:	55                   	push   %ebp
+  805aef:	89 e5                	mov    %esp,%ebp
+  805af1:	8b 45 08             	mov    0x8(%ebp),%eax
+  805af4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  805af8:	eb 03                	jmp    805afd <strchr+0xf>
+  805afa:	83 c0 01             	add    $0x1,%eax
+  805afd:	0f b6 10             	movzbl (%eax),%edx
+  805b00:	84 d2                	test   %dl,%dl
+  805b02:	74 06                	je     805b0a <strchr+0x1c>
+		if (*s == c)
+  805b04:	38 ca                	cmp    %cl,%dl
+  805b06:	75 f2                	jne    805afa <strchr+0xc>
+  805b08:	eb 05                	jmp    805b0f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  805b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b0f:	5d                   	pop    %ebp
+  805b10:	c3                   	ret
+
+00805b11 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  805b11:	55                   	push   %ebp
+  805b12:	89 e5                	mov    %esp,%ebp
+  805b14:	8b 45 08             	mov    0x8(%ebp),%eax
+  805b17:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  805b1b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  805b1e:	38 ca                	cmp    %cl,%dl
+  805b20:	74 09                	je     805b2b <strfind+0x1a>
+  805b22:	84 d2                	test   %dl,%dl
+  805b24:	74 05                	je     805b2b <strfind+0x1a>
+	for (; *s; s++)
+  805b26:	83 c0 01             	add    $0x1,%eax
+  805b29:	eb f0                	jmp    805b1b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  805b2b:	5d                   	pop    %ebp
+  805b2c:	c3                   	ret
+
+00805b2d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  805b2d:	55                   	push   %ebp
+  805b2e:	89 e5                	mov    %esp,%ebp
+  805b30:	57                   	push   %edi
+  805b31:	8b 7d 08             	mov    0x8(%ebp),%edi
+  805b34:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  805b37:	85 c9                	test   %ecx,%ecx
+  805b39:	74 20                	je     805b5b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  805b3b:	89 f8                	mov    %edi,%eax
+  805b3d:	09 c8                	or     %ecx,%eax
+  805b3f:	a8 03                	test   $0x3,%al
+  805b41:	75 12                	jne    805b55 <memset+0x28>
+		c &= 0xFF;
+  805b43:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  805b47:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  805b4d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  805b50:	fc                   	cld
+  805b51:	f3 ab                	rep stos %eax,%es:(%edi)
+  805b53:	eb 06                	jmp    805b5b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  805b55:	8b 45 0c             	mov    0xc(%ebp),%eax
+  805b58:	fc                   	cld
+  805b59:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  805b5b:	89 f8                	mov    %edi,%eax
+  805b5d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  805b60:	c9                   	leave
+  805b61:	c3                   	ret
+
+00805b62 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  805b62:	55                   	push   %ebp
+  805b63:	89 e5                	mov    %esp,%ebp
+  805b65:	57                   	push   %edi
+  805b66:	56                   	push   %esi
+  805b67:	8b 45 08             	mov    0x8(%ebp),%eax
+  805b6a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  805b6d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  805b70:	39 c6                	cmp    %eax,%esi
+  805b72:	73 32                	jae    805ba6 <memmove+0x44>
+  805b74:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  805b77:	39 d0                	cmp    %edx,%eax
+  805b79:	73 2b                	jae    805ba6 <memmove+0x44>
+		s += n;
+		d += n;
+  805b7b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  805b7e:	89 d6                	mov    %edx,%esi
+  805b80:	09 fe                	or     %edi,%esi
+  805b82:	09 ce                	or     %ecx,%esi
+  805b84:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  805b8a:	75 0e                	jne    805b9a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  805b8c:	83 ef 04             	sub    $0x4,%edi
+  805b8f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  805b92:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  805b95:	fd                   	std
+  805b96:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  805b98:	eb 09                	jmp    805ba3 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  805b9a:	83 ef 01             	sub    $0x1,%edi
+  805b9d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  805ba0:	fd                   	std
+  805ba1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  805ba3:	fc                   	cld
+  805ba4:	eb 1a                	jmp    805bc0 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  805ba6:	89 f2                	mov    %esi,%edx
+  805ba8:	09 c2                	or     %eax,%edx
+  805baa:	09 ca                	or     %ecx,%edx
+  805bac:	f6 c2 03             	test   $0x3,%dl
+  805baf:	75 0a                	jne    805bbb <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  805bb1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  805bb4:	89 c7                	mov    %eax,%edi
+  805bb6:	fc                   	cld
+  805bb7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  805bb9:	eb 05                	jmp    805bc0 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  805bbb:	89 c7                	mov    %eax,%edi
+  805bbd:	fc                   	cld
+  805bbe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  805bc0:	5e                   	pop    %esi
+  805bc1:	5f                   	pop    %edi
+  805bc2:	5d                   	pop    %ebp
+  805bc3:	c3                   	ret
+
+00805bc4 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  805bc4:	55                   	push   %ebp
+  805bc5:	89 e5                	mov    %esp,%ebp
+  805bc7:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  805bca:	ff 75 10             	push   0x10(%ebp)
+  805bcd:	ff 75 0c             	push   0xc(%ebp)
+  805bd0:	ff 75 08             	push   0x8(%ebp)
+  805bd3:	e8 8a ff ff ff       	call   805b62 <memmove>
+}
+  805bd8:	c9                   	leave
+  805bd9:	c3                   	ret
+
+00805bda <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  805bda:	55                   	push   %ebp
+  805bdb:	89 e5                	mov    %esp,%ebp
+  805bdd:	56                   	push   %esi
+  805bde:	53                   	push   %ebx
+  805bdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  805be2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  805be5:	89 c6                	mov    %eax,%esi
+  805be7:	03 75 10             	add    0x10(%ebp),%esi
+  805bea:	eb 06                	jmp    805bf2 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  805bec:	83 c0 01             	add    $0x1,%eax
+  805bef:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  805bf2:	39 f0                	cmp    %esi,%eax
+  805bf4:	74 14                	je     805c0a <memcmp+0x30>
+		if (*s1 != *s2)
+  805bf6:	0f b6 08             	movzbl (%eax),%ecx
+  805bf9:	0f b6 1a             	movzbl (%edx),%ebx
+  805bfc:	38 d9                	cmp    %bl,%cl
+  805bfe:	74 ec                	je     805bec <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  805c00:	0f b6 c1             	movzbl %cl,%eax
+  805c03:	0f b6 db             	movzbl %bl,%ebx
+  805c06:	29 d8                	sub    %ebx,%eax
+  805c08:	eb 05                	jmp    805c0f <memcmp+0x35>
+	}
+
+	return 0;
+  805c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c0f:	5b                   	pop    %ebx
+  805c10:	5e                   	pop    %esi
+  805c11:	5d                   	pop    %ebp
+  805c12:	c3                   	ret
+
+00805c13 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  805c13:	55                   	push   %ebp
+  805c14:	89 e5                	mov    %esp,%ebp
+  805c16:	8b 45 08             	mov    0x8(%ebp),%eax
+  805c19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  805c1c:	89 c2                	mov    %eax,%edx
+  805c1e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  805c21:	eb 03                	jmp    805c26 <memfind+0x13>
+  805c23:	83 c0 01             	add    $0x1,%eax
+  805c26:	39 d0                	cmp    %edx,%eax
+  805c28:	73 04                	jae    805c2e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  805c2a:	38 08                	cmp    %cl,(%eax)
+  805c2c:	75 f5                	jne    805c23 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  805c2e:	5d                   	pop    %ebp
+  805c2f:	c3                   	ret
+
+00805c30 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  805c30:	55                   	push   %ebp
+  805c31:	89 e5                	mov    %esp,%ebp
+  805c33:	57                   	push   %edi
+  805c34:	56                   	push   %esi
+  805c35:	53                   	push   %ebx
+  805c36:	8b 55 08             	mov    0x8(%ebp),%edx
+  805c39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  805c3c:	eb 03                	jmp    805c41 <strtol+0x11>
+		s++;
+  805c3e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  805c41:	0f b6 02             	movzbl (%edx),%eax
+  805c44:	3c 20                	cmp    $0x20,%al
+  805c46:	74 f6                	je     805c3e <strtol+0xe>
+  805c48:	3c 09                	cmp    $0x9,%al
+  805c4a:	74 f2                	je     805c3e <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  805c4c:	3c 2b                	cmp    $0x2b,%al
+  805c4e:	74 2a                	je     805c7a <strtol+0x4a>
+	int neg = 0;
+  805c50:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  805c55:	3c 2d                	cmp    $0x2d,%al
+  805c57:	74 2b                	je     805c84 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  805c59:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  805c5f:	75 0f                	jne    805c70 <strtol+0x40>
+  805c61:	80 3a 30             	cmpb   $0x30,(%edx)
+  805c64:	74 28                	je     805c8e <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  805c66:	85 db                	test   %ebx,%ebx
+  805c68:	b8 0a 00 00 00       	mov    $0xa,%eax
+  805c6d:	0f 44 d8             	cmove  %eax,%ebx
+  805c70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805c75:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  805c78:	eb 46                	jmp    805cc0 <strtol+0x90>
+		s++;
+  805c7a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  805c7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c82:	eb d5                	jmp    805c59 <strtol+0x29>
+		s++, neg = 1;
+  805c84:	83 c2 01             	add    $0x1,%edx
+  805c87:	bf 01 00 00 00       	mov    $0x1,%edi
+  805c8c:	eb cb                	jmp    805c59 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  805c8e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  805c92:	74 0e                	je     805ca2 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  805c94:	85 db                	test   %ebx,%ebx
+  805c96:	75 d8                	jne    805c70 <strtol+0x40>
+		s++, base = 8;
+  805c98:	83 c2 01             	add    $0x1,%edx
+  805c9b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  805ca0:	eb ce                	jmp    805c70 <strtol+0x40>
+		s += 2, base = 16;
+  805ca2:	83 c2 02             	add    $0x2,%edx
+  805ca5:	bb 10 00 00 00       	mov    $0x10,%ebx
+  805caa:	eb c4                	jmp    805c70 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  805cac:	0f be c0             	movsbl %al,%eax
+  805caf:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  805cb2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  805cb5:	7d 3a                	jge    805cf1 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  805cb7:	83 c2 01             	add    $0x1,%edx
+  805cba:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  805cbe:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  805cc0:	0f b6 02             	movzbl (%edx),%eax
+  805cc3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  805cc6:	89 f3                	mov    %esi,%ebx
+  805cc8:	80 fb 09             	cmp    $0x9,%bl
+  805ccb:	76 df                	jbe    805cac <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  805ccd:	8d 70 9f             	lea    -0x61(%eax),%esi
+  805cd0:	89 f3                	mov    %esi,%ebx
+  805cd2:	80 fb 19             	cmp    $0x19,%bl
+  805cd5:	77 08                	ja     805cdf <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  805cd7:	0f be c0             	movsbl %al,%eax
+  805cda:	83 e8 57             	sub    $0x57,%eax
+  805cdd:	eb d3                	jmp    805cb2 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  805cdf:	8d 70 bf             	lea    -0x41(%eax),%esi
+  805ce2:	89 f3                	mov    %esi,%ebx
+  805ce4:	80 fb 19             	cmp    $0x19,%bl
+  805ce7:	77 08                	ja     805cf1 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  805ce9:	0f be c0             	movsbl %al,%eax
+  805cec:	83 e8 37             	sub    $0x37,%eax
+  805cef:	eb c1                	jmp    805cb2 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  805cf1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  805cf5:	74 05                	je     805cfc <strtol+0xcc>
+		*endptr = (char *) s;
+  805cf7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  805cfa:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  805cfc:	89 c8                	mov    %ecx,%eax
+  805cfe:	f7 d8                	neg    %eax
+  805d00:	85 ff                	test   %edi,%edi
+  805d02:	0f 45 c8             	cmovne %eax,%ecx
+}
+  805d05:	89 c8                	mov    %ecx,%eax
+  805d07:	5b                   	pop    %ebx
+  805d08:	5e                   	pop    %esi
+  805d09:	5f                   	pop    %edi
+  805d0a:	5d                   	pop    %ebp
+  805d0b:	c3                   	ret
+
+00805d0c <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  805d0c:	55                   	push   %ebp
+  805d0d:	89 e5                	mov    %esp,%ebp
+  805d0f:	57                   	push   %edi
+  805d10:	56                   	push   %esi
+  805d11:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  805d12:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d17:	8b 55 08             	mov    0x8(%ebp),%edx
+  805d1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  805d1d:	89 c3                	mov    %eax,%ebx
+  805d1f:	89 c7                	mov    %eax,%edi
+  805d21:	55                   	push   %ebp
+  805d22:	89 e5                	mov    %esp,%ebp
+  805d24:	8d 35 2c 5d 80 00    	lea    0x805d2c,%esi
+  805d2a:	0f 34                	sysenter
+  805d2c:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  805d2d:	5b                   	pop    %ebx
+  805d2e:	5e                   	pop    %esi
+  805d2f:	5f                   	pop    %edi
+  805d30:	5d                   	pop    %ebp
+  805d31:	c3                   	ret
+
+00805d32 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  805d32:	55                   	push   %ebp
+  805d33:	89 e5                	mov    %esp,%ebp
+  805d35:	57                   	push   %edi
+  805d36:	56                   	push   %esi
+  805d37:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  805d38:	ba 00 00 00 00       	mov    $0x0,%edx
+  805d3d:	b8 01 00 00 00       	mov    $0x1,%eax
+  805d42:	89 d1                	mov    %edx,%ecx
+  805d44:	89 d3                	mov    %edx,%ebx
+  805d46:	89 d7                	mov    %edx,%edi
+  805d48:	55                   	push   %ebp
+  805d49:	89 e5                	mov    %esp,%ebp
+  805d4b:	8d 35 53 5d 80 00    	lea    0x805d53,%esi
+  805d51:	0f 34                	sysenter
+  805d53:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  805d54:	5b                   	pop    %ebx
+  805d55:	5e                   	pop    %esi
+  805d56:	5f                   	pop    %edi
+  805d57:	5d                   	pop    %ebp
+  805d58:	c3                   	ret
+
+00805d59 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  805d59:	55                   	push   %ebp
+  805d5a:	89 e5                	mov    %esp,%ebp
+  805d5c:	57                   	push   %edi
+  805d5d:	56                   	push   %esi
+  805d5e:	53                   	push   %ebx
+  805d5f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  805d62:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805d67:	8b 55 08             	mov    0x8(%ebp),%edx
+  805d6a:	b8 03 00 00 00       	mov    $0x3,%eax
+  805d6f:	89 cb                	mov    %ecx,%ebx
+  805d71:	89 cf                	mov    %ecx,%edi
+  805d73:	55                   	push   %ebp
+  805d74:	89 e5                	mov    %esp,%ebp
+  805d76:	8d 35 7e 5d 80 00    	lea    0x805d7e,%esi
+  805d7c:	0f 34                	sysenter
+  805d7e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  805d7f:	85 c0                	test   %eax,%eax
+  805d81:	7f 08                	jg     805d8b <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  805d83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805d86:	5b                   	pop    %ebx
+  805d87:	5e                   	pop    %esi
+  805d88:	5f                   	pop    %edi
+  805d89:	5d                   	pop    %ebp
+  805d8a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  805d8b:	83 ec 0c             	sub    $0xc,%esp
+  805d8e:	50                   	push   %eax
+  805d8f:	6a 03                	push   $0x3
+  805d91:	68 a7 94 80 00       	push   $0x8094a7
+  805d96:	6a 3d                	push   $0x3d
+  805d98:	68 c4 94 80 00       	push   $0x8094c4
+  805d9d:	e8 71 f5 ff ff       	call   805313 <_panic>
+
+00805da2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  805da2:	55                   	push   %ebp
+  805da3:	89 e5                	mov    %esp,%ebp
+  805da5:	57                   	push   %edi
+  805da6:	56                   	push   %esi
+  805da7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  805da8:	ba 00 00 00 00       	mov    $0x0,%edx
+  805dad:	b8 02 00 00 00       	mov    $0x2,%eax
+  805db2:	89 d1                	mov    %edx,%ecx
+  805db4:	89 d3                	mov    %edx,%ebx
+  805db6:	89 d7                	mov    %edx,%edi
+  805db8:	55                   	push   %ebp
+  805db9:	89 e5                	mov    %esp,%ebp
+  805dbb:	8d 35 c3 5d 80 00    	lea    0x805dc3,%esi
+  805dc1:	0f 34                	sysenter
+  805dc3:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  805dc4:	5b                   	pop    %ebx
+  805dc5:	5e                   	pop    %esi
+  805dc6:	5f                   	pop    %edi
+  805dc7:	5d                   	pop    %ebp
+  805dc8:	c3                   	ret
+
+00805dc9 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  805dc9:	55                   	push   %ebp
+  805dca:	89 e5                	mov    %esp,%ebp
+  805dcc:	57                   	push   %edi
+  805dcd:	56                   	push   %esi
+  805dce:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  805dcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  805dd4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  805dd9:	89 d1                	mov    %edx,%ecx
+  805ddb:	89 d3                	mov    %edx,%ebx
+  805ddd:	89 d7                	mov    %edx,%edi
+  805ddf:	89 d6                	mov    %edx,%esi
+  805de1:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  805de3:	5b                   	pop    %ebx
+  805de4:	5e                   	pop    %esi
+  805de5:	5f                   	pop    %edi
+  805de6:	5d                   	pop    %ebp
+  805de7:	c3                   	ret
+
+00805de8 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  805de8:	55                   	push   %ebp
+  805de9:	89 e5                	mov    %esp,%ebp
+  805deb:	57                   	push   %edi
+  805dec:	56                   	push   %esi
+  805ded:	53                   	push   %ebx
+  805dee:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  805df1:	8b 55 08             	mov    0x8(%ebp),%edx
+  805df4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  805df7:	b8 04 00 00 00       	mov    $0x4,%eax
+  805dfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  805e04:	55                   	push   %ebp
+  805e05:	89 e5                	mov    %esp,%ebp
+  805e07:	8d 35 0f 5e 80 00    	lea    0x805e0f,%esi
+  805e0d:	0f 34                	sysenter
+  805e0f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  805e10:	85 c0                	test   %eax,%eax
+  805e12:	7f 08                	jg     805e1c <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  805e14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805e17:	5b                   	pop    %ebx
+  805e18:	5e                   	pop    %esi
+  805e19:	5f                   	pop    %edi
+  805e1a:	5d                   	pop    %ebp
+  805e1b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  805e1c:	83 ec 0c             	sub    $0xc,%esp
+  805e1f:	50                   	push   %eax
+  805e20:	6a 04                	push   $0x4
+  805e22:	68 a7 94 80 00       	push   $0x8094a7
+  805e27:	6a 3d                	push   $0x3d
+  805e29:	68 c4 94 80 00       	push   $0x8094c4
+  805e2e:	e8 e0 f4 ff ff       	call   805313 <_panic>
+
+00805e33 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  805e33:	55                   	push   %ebp
+  805e34:	89 e5                	mov    %esp,%ebp
+  805e36:	57                   	push   %edi
+  805e37:	56                   	push   %esi
+  805e38:	53                   	push   %ebx
+  805e39:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  805e3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  805e3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  805e42:	b8 05 00 00 00       	mov    $0x5,%eax
+  805e47:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  805e4a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  805e4d:	8b 75 18             	mov    0x18(%ebp),%esi
+  805e50:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  805e52:	85 c0                	test   %eax,%eax
+  805e54:	7f 08                	jg     805e5e <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  805e56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805e59:	5b                   	pop    %ebx
+  805e5a:	5e                   	pop    %esi
+  805e5b:	5f                   	pop    %edi
+  805e5c:	5d                   	pop    %ebp
+  805e5d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  805e5e:	83 ec 0c             	sub    $0xc,%esp
+  805e61:	50                   	push   %eax
+  805e62:	6a 05                	push   $0x5
+  805e64:	68 a7 94 80 00       	push   $0x8094a7
+  805e69:	6a 23                	push   $0x23
+  805e6b:	68 c4 94 80 00       	push   $0x8094c4
+  805e70:	e8 9e f4 ff ff       	call   805313 <_panic>
+
+00805e75 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  805e75:	55                   	push   %ebp
+  805e76:	89 e5                	mov    %esp,%ebp
+  805e78:	57                   	push   %edi
+  805e79:	56                   	push   %esi
+  805e7a:	53                   	push   %ebx
+  805e7b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  805e7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805e83:	8b 55 08             	mov    0x8(%ebp),%edx
+  805e86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  805e89:	b8 06 00 00 00       	mov    $0x6,%eax
+  805e8e:	89 df                	mov    %ebx,%edi
+  805e90:	55                   	push   %ebp
+  805e91:	89 e5                	mov    %esp,%ebp
+  805e93:	8d 35 9b 5e 80 00    	lea    0x805e9b,%esi
+  805e99:	0f 34                	sysenter
+  805e9b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  805e9c:	85 c0                	test   %eax,%eax
+  805e9e:	7f 08                	jg     805ea8 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  805ea0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805ea3:	5b                   	pop    %ebx
+  805ea4:	5e                   	pop    %esi
+  805ea5:	5f                   	pop    %edi
+  805ea6:	5d                   	pop    %ebp
+  805ea7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  805ea8:	83 ec 0c             	sub    $0xc,%esp
+  805eab:	50                   	push   %eax
+  805eac:	6a 06                	push   $0x6
+  805eae:	68 a7 94 80 00       	push   $0x8094a7
+  805eb3:	6a 3d                	push   $0x3d
+  805eb5:	68 c4 94 80 00       	push   $0x8094c4
+  805eba:	e8 54 f4 ff ff       	call   805313 <_panic>
+
+00805ebf <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  805ebf:	55                   	push   %ebp
+  805ec0:	89 e5                	mov    %esp,%ebp
+  805ec2:	57                   	push   %edi
+  805ec3:	56                   	push   %esi
+  805ec4:	53                   	push   %ebx
+  805ec5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  805ec8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805ecd:	8b 55 08             	mov    0x8(%ebp),%edx
+  805ed0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  805ed3:	b8 08 00 00 00       	mov    $0x8,%eax
+  805ed8:	89 df                	mov    %ebx,%edi
+  805eda:	55                   	push   %ebp
+  805edb:	89 e5                	mov    %esp,%ebp
+  805edd:	8d 35 e5 5e 80 00    	lea    0x805ee5,%esi
+  805ee3:	0f 34                	sysenter
+  805ee5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  805ee6:	85 c0                	test   %eax,%eax
+  805ee8:	7f 08                	jg     805ef2 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  805eea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805eed:	5b                   	pop    %ebx
+  805eee:	5e                   	pop    %esi
+  805eef:	5f                   	pop    %edi
+  805ef0:	5d                   	pop    %ebp
+  805ef1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  805ef2:	83 ec 0c             	sub    $0xc,%esp
+  805ef5:	50                   	push   %eax
+  805ef6:	6a 08                	push   $0x8
+  805ef8:	68 a7 94 80 00       	push   $0x8094a7
+  805efd:	6a 3d                	push   $0x3d
+  805eff:	68 c4 94 80 00       	push   $0x8094c4
+  805f04:	e8 0a f4 ff ff       	call   805313 <_panic>
+
+00805f09 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  805f09:	55                   	push   %ebp
+  805f0a:	89 e5                	mov    %esp,%ebp
+  805f0c:	57                   	push   %edi
+  805f0d:	56                   	push   %esi
+  805f0e:	53                   	push   %ebx
+  805f0f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  805f12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805f17:	8b 55 08             	mov    0x8(%ebp),%edx
+  805f1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  805f1d:	b8 09 00 00 00       	mov    $0x9,%eax
+  805f22:	89 df                	mov    %ebx,%edi
+  805f24:	55                   	push   %ebp
+  805f25:	89 e5                	mov    %esp,%ebp
+  805f27:	8d 35 2f 5f 80 00    	lea    0x805f2f,%esi
+  805f2d:	0f 34                	sysenter
+  805f2f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  805f30:	85 c0                	test   %eax,%eax
+  805f32:	7f 08                	jg     805f3c <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  805f34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805f37:	5b                   	pop    %ebx
+  805f38:	5e                   	pop    %esi
+  805f39:	5f                   	pop    %edi
+  805f3a:	5d                   	pop    %ebp
+  805f3b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  805f3c:	83 ec 0c             	sub    $0xc,%esp
+  805f3f:	50                   	push   %eax
+  805f40:	6a 09                	push   $0x9
+  805f42:	68 a7 94 80 00       	push   $0x8094a7
+  805f47:	6a 3d                	push   $0x3d
+  805f49:	68 c4 94 80 00       	push   $0x8094c4
+  805f4e:	e8 c0 f3 ff ff       	call   805313 <_panic>
+
+00805f53 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  805f53:	55                   	push   %ebp
+  805f54:	89 e5                	mov    %esp,%ebp
+  805f56:	57                   	push   %edi
+  805f57:	56                   	push   %esi
+  805f58:	53                   	push   %ebx
+  805f59:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  805f5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805f61:	8b 55 08             	mov    0x8(%ebp),%edx
+  805f64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  805f67:	b8 0a 00 00 00       	mov    $0xa,%eax
+  805f6c:	89 df                	mov    %ebx,%edi
+  805f6e:	55                   	push   %ebp
+  805f6f:	89 e5                	mov    %esp,%ebp
+  805f71:	8d 35 79 5f 80 00    	lea    0x805f79,%esi
+  805f77:	0f 34                	sysenter
+  805f79:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  805f7a:	85 c0                	test   %eax,%eax
+  805f7c:	7f 08                	jg     805f86 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  805f7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805f81:	5b                   	pop    %ebx
+  805f82:	5e                   	pop    %esi
+  805f83:	5f                   	pop    %edi
+  805f84:	5d                   	pop    %ebp
+  805f85:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  805f86:	83 ec 0c             	sub    $0xc,%esp
+  805f89:	50                   	push   %eax
+  805f8a:	6a 0a                	push   $0xa
+  805f8c:	68 a7 94 80 00       	push   $0x8094a7
+  805f91:	6a 3d                	push   $0x3d
+  805f93:	68 c4 94 80 00       	push   $0x8094c4
+  805f98:	e8 76 f3 ff ff       	call   805313 <_panic>
+
+00805f9d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  805f9d:	55                   	push   %ebp
+  805f9e:	89 e5                	mov    %esp,%ebp
+  805fa0:	57                   	push   %edi
+  805fa1:	56                   	push   %esi
+  805fa2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  805fa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  805fa6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  805fa9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  805fae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  805fb1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  805fb4:	55                   	push   %ebp
+  805fb5:	89 e5                	mov    %esp,%ebp
+  805fb7:	8d 35 bf 5f 80 00    	lea    0x805fbf,%esi
+  805fbd:	0f 34                	sysenter
+  805fbf:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  805fc0:	5b                   	pop    %ebx
+  805fc1:	5e                   	pop    %esi
+  805fc2:	5f                   	pop    %edi
+  805fc3:	5d                   	pop    %ebp
+  805fc4:	c3                   	ret
+
+00805fc5 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  805fc5:	55                   	push   %ebp
+  805fc6:	89 e5                	mov    %esp,%ebp
+  805fc8:	57                   	push   %edi
+  805fc9:	56                   	push   %esi
+  805fca:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  805fcb:	8b 55 08             	mov    0x8(%ebp),%edx
+  805fce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  805fd1:	b8 17 00 00 00       	mov    $0x17,%eax
+  805fd6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  805fd9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  805fdc:	55                   	push   %ebp
+  805fdd:	89 e5                	mov    %esp,%ebp
+  805fdf:	8d 35 e7 5f 80 00    	lea    0x805fe7,%esi
+  805fe5:	0f 34                	sysenter
+  805fe7:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  805fe8:	5b                   	pop    %ebx
+  805fe9:	5e                   	pop    %esi
+  805fea:	5f                   	pop    %edi
+  805feb:	5d                   	pop    %ebp
+  805fec:	c3                   	ret
+
+00805fed <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  805fed:	55                   	push   %ebp
+  805fee:	89 e5                	mov    %esp,%ebp
+  805ff0:	57                   	push   %edi
+  805ff1:	56                   	push   %esi
+  805ff2:	53                   	push   %ebx
+  805ff3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  805ff6:	be 00 00 00 00       	mov    $0x0,%esi
+  805ffb:	8b 55 08             	mov    0x8(%ebp),%edx
+  805ffe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  806001:	b8 0d 00 00 00       	mov    $0xd,%eax
+  806006:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  806009:	89 f7                	mov    %esi,%edi
+  80600b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80600d:	85 c0                	test   %eax,%eax
+  80600f:	7f 08                	jg     806019 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  806011:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806014:	5b                   	pop    %ebx
+  806015:	5e                   	pop    %esi
+  806016:	5f                   	pop    %edi
+  806017:	5d                   	pop    %ebp
+  806018:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  806019:	83 ec 0c             	sub    $0xc,%esp
+  80601c:	50                   	push   %eax
+  80601d:	6a 0d                	push   $0xd
+  80601f:	68 a7 94 80 00       	push   $0x8094a7
+  806024:	6a 23                	push   $0x23
+  806026:	68 c4 94 80 00       	push   $0x8094c4
+  80602b:	e8 e3 f2 ff ff       	call   805313 <_panic>
+
+00806030 <sys_ipc_recv>:
+{
+  806030:	55                   	push   %ebp
+  806031:	89 e5                	mov    %esp,%ebp
+  806033:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  806036:	6a 00                	push   $0x0
+  806038:	6a 01                	push   $0x1
+  80603a:	ff 75 08             	push   0x8(%ebp)
+  80603d:	e8 ab ff ff ff       	call   805fed <sys_ipc_recvv>
+}
+  806042:	c9                   	leave
+  806043:	c3                   	ret
+
+00806044 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  806044:	55                   	push   %ebp
+  806045:	89 e5                	mov    %esp,%ebp
+  806047:	57                   	push   %edi
+  806048:	56                   	push   %esi
+  806049:	53                   	push   %ebx
+  80604a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80604d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806052:	8b 55 08             	mov    0x8(%ebp),%edx
+  806055:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  806058:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80605d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  806060:	89 de                	mov    %ebx,%esi
+  806062:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  806064:	85 c0                	test   %eax,%eax
+  806066:	7f 08                	jg     806070 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  806068:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80606b:	5b                   	pop    %ebx
+  80606c:	5e                   	pop    %esi
+  80606d:	5f                   	pop    %edi
+  80606e:	5d                   	pop    %ebp
+  80606f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  806070:	83 ec 0c             	sub    $0xc,%esp
+  806073:	50                   	push   %eax
+  806074:	6a 0d                	push   $0xd
+  806076:	68 a7 94 80 00       	push   $0x8094a7
+  80607b:	6a 23                	push   $0x23
+  80607d:	68 c4 94 80 00       	push   $0x8094c4
+  806082:	e8 8c f2 ff ff       	call   805313 <_panic>
+
+00806087 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  806087:	55                   	push   %ebp
+  806088:	89 e5                	mov    %esp,%ebp
+  80608a:	57                   	push   %edi
+  80608b:	56                   	push   %esi
+  80608c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80608d:	ba 00 00 00 00       	mov    $0x0,%edx
+  806092:	b8 0e 00 00 00       	mov    $0xe,%eax
+  806097:	89 d1                	mov    %edx,%ecx
+  806099:	89 d3                	mov    %edx,%ebx
+  80609b:	89 d7                	mov    %edx,%edi
+  80609d:	55                   	push   %ebp
+  80609e:	89 e5                	mov    %esp,%ebp
+  8060a0:	8d 35 a8 60 80 00    	lea    0x8060a8,%esi
+  8060a6:	0f 34                	sysenter
+  8060a8:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  8060a9:	5b                   	pop    %ebx
+  8060aa:	5e                   	pop    %esi
+  8060ab:	5f                   	pop    %edi
+  8060ac:	5d                   	pop    %ebp
+  8060ad:	c3                   	ret
+
+008060ae <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  8060ae:	55                   	push   %ebp
+  8060af:	89 e5                	mov    %esp,%ebp
+  8060b1:	57                   	push   %edi
+  8060b2:	56                   	push   %esi
+  8060b3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8060b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8060b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8060bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8060bf:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8060c4:	89 df                	mov    %ebx,%edi
+  8060c6:	55                   	push   %ebp
+  8060c7:	89 e5                	mov    %esp,%ebp
+  8060c9:	8d 35 d1 60 80 00    	lea    0x8060d1,%esi
+  8060cf:	0f 34                	sysenter
+  8060d1:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  8060d2:	5b                   	pop    %ebx
+  8060d3:	5e                   	pop    %esi
+  8060d4:	5f                   	pop    %edi
+  8060d5:	5d                   	pop    %ebp
+  8060d6:	c3                   	ret
+
+008060d7 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  8060d7:	55                   	push   %ebp
+  8060d8:	89 e5                	mov    %esp,%ebp
+  8060da:	57                   	push   %edi
+  8060db:	56                   	push   %esi
+  8060dc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8060dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8060e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8060e5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8060ea:	89 cb                	mov    %ecx,%ebx
+  8060ec:	89 cf                	mov    %ecx,%edi
+  8060ee:	55                   	push   %ebp
+  8060ef:	89 e5                	mov    %esp,%ebp
+  8060f1:	8d 35 f9 60 80 00    	lea    0x8060f9,%esi
+  8060f7:	0f 34                	sysenter
+  8060f9:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  8060fa:	5b                   	pop    %ebx
+  8060fb:	5e                   	pop    %esi
+  8060fc:	5f                   	pop    %edi
+  8060fd:	5d                   	pop    %ebp
+  8060fe:	c3                   	ret
+
+008060ff <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  8060ff:	55                   	push   %ebp
+  806100:	89 e5                	mov    %esp,%ebp
+  806102:	57                   	push   %edi
+  806103:	56                   	push   %esi
+  806104:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  806105:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80610a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80610d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  806110:	b8 12 00 00 00       	mov    $0x12,%eax
+  806115:	89 df                	mov    %ebx,%edi
+  806117:	55                   	push   %ebp
+  806118:	89 e5                	mov    %esp,%ebp
+  80611a:	8d 35 22 61 80 00    	lea    0x806122,%esi
+  806120:	0f 34                	sysenter
+  806122:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  806123:	5b                   	pop    %ebx
+  806124:	5e                   	pop    %esi
+  806125:	5f                   	pop    %edi
+  806126:	5d                   	pop    %ebp
+  806127:	c3                   	ret
+
+00806128 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  806128:	55                   	push   %ebp
+  806129:	89 e5                	mov    %esp,%ebp
+  80612b:	57                   	push   %edi
+  80612c:	56                   	push   %esi
+  80612d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80612e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806133:	8b 55 08             	mov    0x8(%ebp),%edx
+  806136:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  806139:	b8 14 00 00 00       	mov    $0x14,%eax
+  80613e:	89 df                	mov    %ebx,%edi
+  806140:	55                   	push   %ebp
+  806141:	89 e5                	mov    %esp,%ebp
+  806143:	8d 35 4b 61 80 00    	lea    0x80614b,%esi
+  806149:	0f 34                	sysenter
+  80614b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  80614c:	5b                   	pop    %ebx
+  80614d:	5e                   	pop    %esi
+  80614e:	5f                   	pop    %edi
+  80614f:	5d                   	pop    %ebp
+  806150:	c3                   	ret
+
+00806151 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  806151:	55                   	push   %ebp
+  806152:	89 e5                	mov    %esp,%ebp
+  806154:	57                   	push   %edi
+  806155:	56                   	push   %esi
+  806156:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  806157:	8b 55 08             	mov    0x8(%ebp),%edx
+  80615a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80615d:	b8 13 00 00 00       	mov    $0x13,%eax
+  806162:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  806165:	8b 7d 14             	mov    0x14(%ebp),%edi
+  806168:	55                   	push   %ebp
+  806169:	89 e5                	mov    %esp,%ebp
+  80616b:	8d 35 73 61 80 00    	lea    0x806173,%esi
+  806171:	0f 34                	sysenter
+  806173:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  806174:	5b                   	pop    %ebx
+  806175:	5e                   	pop    %esi
+  806176:	5f                   	pop    %edi
+  806177:	5d                   	pop    %ebp
+  806178:	c3                   	ret
+
+00806179 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  806179:	55                   	push   %ebp
+  80617a:	89 e5                	mov    %esp,%ebp
+  80617c:	57                   	push   %edi
+  80617d:	56                   	push   %esi
+  80617e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80617f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806184:	8b 55 08             	mov    0x8(%ebp),%edx
+  806187:	b8 11 00 00 00       	mov    $0x11,%eax
+  80618c:	89 cb                	mov    %ecx,%ebx
+  80618e:	89 cf                	mov    %ecx,%edi
+  806190:	89 ce                	mov    %ecx,%esi
+  806192:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  806194:	5b                   	pop    %ebx
+  806195:	5e                   	pop    %esi
+  806196:	5f                   	pop    %edi
+  806197:	5d                   	pop    %ebp
+  806198:	c3                   	ret
+
+00806199 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  806199:	55                   	push   %ebp
+  80619a:	89 e5                	mov    %esp,%ebp
+  80619c:	57                   	push   %edi
+  80619d:	56                   	push   %esi
+  80619e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80619f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8061a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8061a7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8061ac:	89 cb                	mov    %ecx,%ebx
+  8061ae:	89 cf                	mov    %ecx,%edi
+  8061b0:	55                   	push   %ebp
+  8061b1:	89 e5                	mov    %esp,%ebp
+  8061b3:	8d 35 bb 61 80 00    	lea    0x8061bb,%esi
+  8061b9:	0f 34                	sysenter
+  8061bb:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8061bc:	5b                   	pop    %ebx
+  8061bd:	5e                   	pop    %esi
+  8061be:	5f                   	pop    %edi
+  8061bf:	5d                   	pop    %ebp
+  8061c0:	c3                   	ret
+
+008061c1 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8061c1:	55                   	push   %ebp
+  8061c2:	89 e5                	mov    %esp,%ebp
+  8061c4:	57                   	push   %edi
+  8061c5:	56                   	push   %esi
+  8061c6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8061c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8061cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8061cf:	b8 16 00 00 00       	mov    $0x16,%eax
+  8061d4:	89 cb                	mov    %ecx,%ebx
+  8061d6:	89 cf                	mov    %ecx,%edi
+  8061d8:	55                   	push   %ebp
+  8061d9:	89 e5                	mov    %esp,%ebp
+  8061db:	8d 35 e3 61 80 00    	lea    0x8061e3,%esi
+  8061e1:	0f 34                	sysenter
+  8061e3:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8061e4:	5b                   	pop    %ebx
+  8061e5:	5e                   	pop    %esi
+  8061e6:	5f                   	pop    %edi
+  8061e7:	5d                   	pop    %ebp
+  8061e8:	c3                   	ret
+
+008061e9 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8061e9:	55                   	push   %ebp
+  8061ea:	89 e5                	mov    %esp,%ebp
+  8061ec:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8061ef:	83 3d 90 10 8a 00 00 	cmpl   $0x0,0x8a1090
+  8061f6:	74 0a                	je     806202 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8061f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8061fb:	a3 90 10 8a 00       	mov    %eax,0x8a1090
+}
+  806200:	c9                   	leave
+  806201:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  806202:	83 ec 04             	sub    $0x4,%esp
+  806205:	6a 07                	push   $0x7
+  806207:	68 00 f0 bf ee       	push   $0xeebff000
+  80620c:	6a 00                	push   $0x0
+  80620e:	e8 d5 fb ff ff       	call   805de8 <sys_page_alloc>
+  806213:	83 c4 10             	add    $0x10,%esp
+  806216:	85 c0                	test   %eax,%eax
+  806218:	75 2c                	jne    806246 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80621a:	83 ec 08             	sub    $0x8,%esp
+  80621d:	68 5c 62 80 00       	push   $0x80625c
+  806222:	6a 00                	push   $0x0
+  806224:	e8 2a fd ff ff       	call   805f53 <sys_env_set_pgfault_upcall>
+  806229:	83 c4 10             	add    $0x10,%esp
+  80622c:	85 c0                	test   %eax,%eax
+  80622e:	74 c8                	je     8061f8 <set_pgfault_handler+0xf>
+  806230:	68 1c 95 80 00       	push   $0x80951c
+  806235:	68 fd 89 80 00       	push   $0x8089fd
+  80623a:	6a 20                	push   $0x20
+  80623c:	68 4c 95 80 00       	push   $0x80954c
+  806241:	e8 cd f0 ff ff       	call   805313 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  806246:	68 d4 94 80 00       	push   $0x8094d4
+  80624b:	68 fd 89 80 00       	push   $0x8089fd
+  806250:	6a 1e                	push   $0x1e
+  806252:	68 4c 95 80 00       	push   $0x80954c
+  806257:	e8 b7 f0 ff ff       	call   805313 <_panic>
+
+0080625c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80625c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80625d:	a1 90 10 8a 00       	mov    0x8a1090,%eax
+	call *%eax
+  806262:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  806264:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  806267:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  80626c:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  806271:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  806275:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  806278:	83 c4 08             	add    $0x8,%esp
+	popal
+  80627b:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  80627c:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80627f:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  806280:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  806281:	c3                   	ret
+
+00806282 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  806282:	55                   	push   %ebp
+  806283:	89 e5                	mov    %esp,%ebp
+  806285:	56                   	push   %esi
+  806286:	53                   	push   %ebx
+  806287:	8b 75 08             	mov    0x8(%ebp),%esi
+  80628a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80628d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  806290:	85 c0                	test   %eax,%eax
+  806292:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  806297:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80629a:	83 ec 0c             	sub    $0xc,%esp
+  80629d:	50                   	push   %eax
+  80629e:	e8 8d fd ff ff       	call   806030 <sys_ipc_recv>
+	if (from_env_store)
+  8062a3:	83 c4 10             	add    $0x10,%esp
+  8062a6:	85 f6                	test   %esi,%esi
+  8062a8:	74 14                	je     8062be <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8062aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8062af:	85 c0                	test   %eax,%eax
+  8062b1:	75 09                	jne    8062bc <ipc_recv+0x3a>
+  8062b3:	8b 15 8c 10 8a 00    	mov    0x8a108c,%edx
+  8062b9:	8b 52 74             	mov    0x74(%edx),%edx
+  8062bc:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8062be:	85 db                	test   %ebx,%ebx
+  8062c0:	74 25                	je     8062e7 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8062c2:	85 c0                	test   %eax,%eax
+  8062c4:	74 0d                	je     8062d3 <ipc_recv+0x51>
+  8062c6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8062cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8062cf:	5b                   	pop    %ebx
+  8062d0:	5e                   	pop    %esi
+  8062d1:	5d                   	pop    %ebp
+  8062d2:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8062d3:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  8062d8:	8b 40 78             	mov    0x78(%eax),%eax
+  8062db:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8062dd:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  8062e2:	8b 40 70             	mov    0x70(%eax),%eax
+  8062e5:	eb e5                	jmp    8062cc <ipc_recv+0x4a>
+  8062e7:	85 c0                	test   %eax,%eax
+  8062e9:	75 e1                	jne    8062cc <ipc_recv+0x4a>
+  8062eb:	eb f0                	jmp    8062dd <ipc_recv+0x5b>
+
+008062ed <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8062ed:	55                   	push   %ebp
+  8062ee:	89 e5                	mov    %esp,%ebp
+  8062f0:	57                   	push   %edi
+  8062f1:	56                   	push   %esi
+  8062f2:	53                   	push   %ebx
+  8062f3:	83 ec 0c             	sub    $0xc,%esp
+  8062f6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8062f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8062fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8062ff:	85 db                	test   %ebx,%ebx
+  806301:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  806306:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  806309:	ff 75 14             	push   0x14(%ebp)
+  80630c:	53                   	push   %ebx
+  80630d:	56                   	push   %esi
+  80630e:	57                   	push   %edi
+  80630f:	e8 89 fc ff ff       	call   805f9d <sys_ipc_try_send>
+  806314:	83 c4 10             	add    $0x10,%esp
+  806317:	85 c0                	test   %eax,%eax
+  806319:	74 22                	je     80633d <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  80631b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80631e:	75 07                	jne    806327 <ipc_send+0x3a>
+		sys_yield();
+  806320:	e8 a4 fa ff ff       	call   805dc9 <sys_yield>
+  806325:	eb e2                	jmp    806309 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  806327:	68 5a 95 80 00       	push   $0x80955a
+  80632c:	68 fd 89 80 00       	push   $0x8089fd
+  806331:	6a 39                	push   $0x39
+  806333:	68 6f 95 80 00       	push   $0x80956f
+  806338:	e8 d6 ef ff ff       	call   805313 <_panic>
+	}
+}
+  80633d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806340:	5b                   	pop    %ebx
+  806341:	5e                   	pop    %esi
+  806342:	5f                   	pop    %edi
+  806343:	5d                   	pop    %ebp
+  806344:	c3                   	ret
+
+00806345 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  806345:	55                   	push   %ebp
+  806346:	89 e5                	mov    %esp,%ebp
+  806348:	57                   	push   %edi
+  806349:	56                   	push   %esi
+  80634a:	53                   	push   %ebx
+  80634b:	83 ec 10             	sub    $0x10,%esp
+  80634e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  806351:	8b 45 0c             	mov    0xc(%ebp),%eax
+  806354:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  806357:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80635a:	85 c0                	test   %eax,%eax
+  80635c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  806361:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  806364:	6a 00                	push   $0x0
+  806366:	ff 33                	push   (%ebx)
+  806368:	50                   	push   %eax
+  806369:	e8 7f fc ff ff       	call   805fed <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80636e:	83 c4 10             	add    $0x10,%esp
+  806371:	85 c0                	test   %eax,%eax
+  806373:	75 3c                	jne    8063b1 <ipc_recvv+0x6c>
+  806375:	8b 15 8c 10 8a 00    	mov    0x8a108c,%edx
+  80637b:	8b 52 7c             	mov    0x7c(%edx),%edx
+  80637e:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  806380:	85 ff                	test   %edi,%edi
+  806382:	74 4e                	je     8063d2 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806384:	8b 15 8c 10 8a 00    	mov    0x8a108c,%edx
+  80638a:	8b 52 74             	mov    0x74(%edx),%edx
+  80638d:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  80638f:	85 f6                	test   %esi,%esi
+  806391:	74 18                	je     8063ab <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806393:	85 c0                	test   %eax,%eax
+  806395:	75 2d                	jne    8063c4 <ipc_recvv+0x7f>
+  806397:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  80639c:	8b 40 78             	mov    0x78(%eax),%eax
+  80639f:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8063a1:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  8063a6:	8b 40 70             	mov    0x70(%eax),%eax
+  8063a9:	eb 1f                	jmp    8063ca <ipc_recvv+0x85>
+  8063ab:	85 c0                	test   %eax,%eax
+  8063ad:	75 1b                	jne    8063ca <ipc_recvv+0x85>
+  8063af:	eb f0                	jmp    8063a1 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8063b1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8063b7:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8063bc:	85 ff                	test   %edi,%edi
+  8063be:	75 cd                	jne    80638d <ipc_recvv+0x48>
+	if (perm_store)
+  8063c0:	85 f6                	test   %esi,%esi
+  8063c2:	74 e7                	je     8063ab <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8063c4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8063ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8063cd:	5b                   	pop    %ebx
+  8063ce:	5e                   	pop    %esi
+  8063cf:	5f                   	pop    %edi
+  8063d0:	5d                   	pop    %ebp
+  8063d1:	c3                   	ret
+	if (perm_store)
+  8063d2:	85 f6                	test   %esi,%esi
+  8063d4:	75 bd                	jne    806393 <ipc_recvv+0x4e>
+  8063d6:	eb c9                	jmp    8063a1 <ipc_recvv+0x5c>
+
+008063d8 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8063d8:	55                   	push   %ebp
+  8063d9:	89 e5                	mov    %esp,%ebp
+  8063db:	57                   	push   %edi
+  8063dc:	56                   	push   %esi
+  8063dd:	53                   	push   %ebx
+  8063de:	83 ec 0c             	sub    $0xc,%esp
+  8063e1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8063e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8063e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8063ea:	ff 75 14             	push   0x14(%ebp)
+  8063ed:	53                   	push   %ebx
+  8063ee:	56                   	push   %esi
+  8063ef:	57                   	push   %edi
+  8063f0:	e8 d0 fb ff ff       	call   805fc5 <sys_ipc_try_sendv>
+  8063f5:	83 c4 10             	add    $0x10,%esp
+  8063f8:	85 c0                	test   %eax,%eax
+  8063fa:	74 22                	je     80641e <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8063fc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8063ff:	75 07                	jne    806408 <ipc_sendv+0x30>
+		sys_yield();
+  806401:	e8 c3 f9 ff ff       	call   805dc9 <sys_yield>
+  806406:	eb e2                	jmp    8063ea <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  806408:	68 5a 95 80 00       	push   $0x80955a
+  80640d:	68 fd 89 80 00       	push   $0x8089fd
+  806412:	6a 5c                	push   $0x5c
+  806414:	68 6f 95 80 00       	push   $0x80956f
+  806419:	e8 f5 ee ff ff       	call   805313 <_panic>
+	}
+}
+  80641e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806421:	5b                   	pop    %ebx
+  806422:	5e                   	pop    %esi
+  806423:	5f                   	pop    %edi
+  806424:	5d                   	pop    %ebp
+  806425:	c3                   	ret
+
+00806426 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806426:	55                   	push   %ebp
+  806427:	89 e5                	mov    %esp,%ebp
+  806429:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80642c:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  806431:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  806437:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80643d:	8b 52 50             	mov    0x50(%edx),%edx
+  806440:	39 ca                	cmp    %ecx,%edx
+  806442:	74 11                	je     806455 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  806444:	83 c0 01             	add    $0x1,%eax
+  806447:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80644c:	75 e3                	jne    806431 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80644e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806453:	eb 0e                	jmp    806463 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  806455:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80645b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  806460:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  806463:	5d                   	pop    %ebp
+  806464:	c3                   	ret
+
+00806465 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  806465:	55                   	push   %ebp
+  806466:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  806468:	8b 45 08             	mov    0x8(%ebp),%eax
+  80646b:	05 00 00 00 30       	add    $0x30000000,%eax
+  806470:	c1 e8 0c             	shr    $0xc,%eax
+}
+  806473:	5d                   	pop    %ebp
+  806474:	c3                   	ret
+
+00806475 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  806475:	55                   	push   %ebp
+  806476:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  806478:	8b 45 08             	mov    0x8(%ebp),%eax
+  80647b:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  806480:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  806485:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80648a:	5d                   	pop    %ebp
+  80648b:	c3                   	ret
+
+0080648c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80648c:	55                   	push   %ebp
+  80648d:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80648f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  806494:	eb 02                	jmp    806498 <fd_alloc+0xc>
+  806496:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  806498:	89 c2                	mov    %eax,%edx
+  80649a:	c1 ea 16             	shr    $0x16,%edx
+  80649d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8064a4:	f6 c2 01             	test   $0x1,%dl
+  8064a7:	74 2b                	je     8064d4 <fd_alloc+0x48>
+  8064a9:	89 c2                	mov    %eax,%edx
+  8064ab:	c1 ea 0c             	shr    $0xc,%edx
+  8064ae:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8064b5:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8064bb:	f6 c1 01             	test   $0x1,%cl
+  8064be:	74 14                	je     8064d4 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8064c0:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8064c6:	75 ce                	jne    806496 <fd_alloc+0xa>
+  8064c8:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8064cd:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8064d2:	eb 05                	jmp    8064d9 <fd_alloc+0x4d>
+			return 0;
+  8064d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8064d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8064dc:	89 02                	mov    %eax,(%edx)
+}
+  8064de:	89 c8                	mov    %ecx,%eax
+  8064e0:	5d                   	pop    %ebp
+  8064e1:	c3                   	ret
+
+008064e2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8064e2:	55                   	push   %ebp
+  8064e3:	89 e5                	mov    %esp,%ebp
+  8064e5:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8064e8:	83 f8 1f             	cmp    $0x1f,%eax
+  8064eb:	77 30                	ja     80651d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8064ed:	c1 e0 0c             	shl    $0xc,%eax
+  8064f0:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8064f5:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8064fb:	f6 c2 01             	test   $0x1,%dl
+  8064fe:	74 24                	je     806524 <fd_lookup+0x42>
+  806500:	89 c2                	mov    %eax,%edx
+  806502:	c1 ea 0c             	shr    $0xc,%edx
+  806505:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80650c:	f6 c2 01             	test   $0x1,%dl
+  80650f:	74 1a                	je     80652b <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  806511:	8b 55 0c             	mov    0xc(%ebp),%edx
+  806514:	89 02                	mov    %eax,(%edx)
+	return 0;
+  806516:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80651b:	5d                   	pop    %ebp
+  80651c:	c3                   	ret
+		return -E_INVAL;
+  80651d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806522:	eb f7                	jmp    80651b <fd_lookup+0x39>
+		return -E_INVAL;
+  806524:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806529:	eb f0                	jmp    80651b <fd_lookup+0x39>
+  80652b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806530:	eb e9                	jmp    80651b <fd_lookup+0x39>
+
+00806532 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  806532:	55                   	push   %ebp
+  806533:	89 e5                	mov    %esp,%ebp
+  806535:	53                   	push   %ebx
+  806536:	83 ec 04             	sub    $0x4,%esp
+  806539:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80653c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806541:	eb 03                	jmp    806546 <dev_lookup+0x14>
+  806543:	83 c0 01             	add    $0x1,%eax
+  806546:	8b 1c 85 f8 95 80 00 	mov    0x8095f8(,%eax,4),%ebx
+  80654d:	85 db                	test   %ebx,%ebx
+  80654f:	74 0b                	je     80655c <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  806551:	39 13                	cmp    %edx,(%ebx)
+  806553:	75 ee                	jne    806543 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  806555:	b8 00 00 00 00       	mov    $0x0,%eax
+  80655a:	eb 1f                	jmp    80657b <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80655c:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  806561:	8b 40 48             	mov    0x48(%eax),%eax
+  806564:	83 ec 04             	sub    $0x4,%esp
+  806567:	52                   	push   %edx
+  806568:	50                   	push   %eax
+  806569:	68 7c 95 80 00       	push   $0x80957c
+  80656e:	e8 7b ee ff ff       	call   8053ee <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  806573:	83 c4 10             	add    $0x10,%esp
+  806576:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80657b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80657e:	89 1a                	mov    %ebx,(%edx)
+}
+  806580:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  806583:	c9                   	leave
+  806584:	c3                   	ret
+
+00806585 <fd_close>:
+{
+  806585:	55                   	push   %ebp
+  806586:	89 e5                	mov    %esp,%ebp
+  806588:	57                   	push   %edi
+  806589:	56                   	push   %esi
+  80658a:	53                   	push   %ebx
+  80658b:	83 ec 24             	sub    $0x24,%esp
+  80658e:	8b 75 08             	mov    0x8(%ebp),%esi
+  806591:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  806594:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  806597:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  806598:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80659e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8065a1:	50                   	push   %eax
+  8065a2:	e8 3b ff ff ff       	call   8064e2 <fd_lookup>
+  8065a7:	89 c3                	mov    %eax,%ebx
+  8065a9:	83 c4 10             	add    $0x10,%esp
+  8065ac:	85 c0                	test   %eax,%eax
+  8065ae:	78 05                	js     8065b5 <fd_close+0x30>
+	    || fd != fd2)
+  8065b0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8065b3:	74 16                	je     8065cb <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8065b5:	89 f8                	mov    %edi,%eax
+  8065b7:	84 c0                	test   %al,%al
+  8065b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8065be:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8065c1:	89 d8                	mov    %ebx,%eax
+  8065c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8065c6:	5b                   	pop    %ebx
+  8065c7:	5e                   	pop    %esi
+  8065c8:	5f                   	pop    %edi
+  8065c9:	5d                   	pop    %ebp
+  8065ca:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8065cb:	83 ec 08             	sub    $0x8,%esp
+  8065ce:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8065d1:	50                   	push   %eax
+  8065d2:	ff 36                	push   (%esi)
+  8065d4:	e8 59 ff ff ff       	call   806532 <dev_lookup>
+  8065d9:	89 c3                	mov    %eax,%ebx
+  8065db:	83 c4 10             	add    $0x10,%esp
+  8065de:	85 c0                	test   %eax,%eax
+  8065e0:	78 1a                	js     8065fc <fd_close+0x77>
+		if (dev->dev_close)
+  8065e2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8065e5:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8065e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8065ed:	85 c0                	test   %eax,%eax
+  8065ef:	74 0b                	je     8065fc <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8065f1:	83 ec 0c             	sub    $0xc,%esp
+  8065f4:	56                   	push   %esi
+  8065f5:	ff d0                	call   *%eax
+  8065f7:	89 c3                	mov    %eax,%ebx
+  8065f9:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8065fc:	83 ec 08             	sub    $0x8,%esp
+  8065ff:	56                   	push   %esi
+  806600:	6a 00                	push   $0x0
+  806602:	e8 6e f8 ff ff       	call   805e75 <sys_page_unmap>
+	return r;
+  806607:	83 c4 10             	add    $0x10,%esp
+  80660a:	eb b5                	jmp    8065c1 <fd_close+0x3c>
+
+0080660c <close>:
+
+int
+close(int fdnum)
+{
+  80660c:	55                   	push   %ebp
+  80660d:	89 e5                	mov    %esp,%ebp
+  80660f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806612:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  806615:	50                   	push   %eax
+  806616:	ff 75 08             	push   0x8(%ebp)
+  806619:	e8 c4 fe ff ff       	call   8064e2 <fd_lookup>
+  80661e:	83 c4 10             	add    $0x10,%esp
+  806621:	85 c0                	test   %eax,%eax
+  806623:	79 02                	jns    806627 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  806625:	c9                   	leave
+  806626:	c3                   	ret
+		return fd_close(fd, 1);
+  806627:	83 ec 08             	sub    $0x8,%esp
+  80662a:	6a 01                	push   $0x1
+  80662c:	ff 75 f4             	push   -0xc(%ebp)
+  80662f:	e8 51 ff ff ff       	call   806585 <fd_close>
+  806634:	83 c4 10             	add    $0x10,%esp
+  806637:	eb ec                	jmp    806625 <close+0x19>
+
+00806639 <close_all>:
+
+void
+close_all(void)
+{
+  806639:	55                   	push   %ebp
+  80663a:	89 e5                	mov    %esp,%ebp
+  80663c:	53                   	push   %ebx
+  80663d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  806640:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  806645:	83 ec 0c             	sub    $0xc,%esp
+  806648:	53                   	push   %ebx
+  806649:	e8 be ff ff ff       	call   80660c <close>
+	for (i = 0; i < MAXFD; i++)
+  80664e:	83 c3 01             	add    $0x1,%ebx
+  806651:	83 c4 10             	add    $0x10,%esp
+  806654:	83 fb 20             	cmp    $0x20,%ebx
+  806657:	75 ec                	jne    806645 <close_all+0xc>
+}
+  806659:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80665c:	c9                   	leave
+  80665d:	c3                   	ret
+
+0080665e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80665e:	55                   	push   %ebp
+  80665f:	89 e5                	mov    %esp,%ebp
+  806661:	57                   	push   %edi
+  806662:	56                   	push   %esi
+  806663:	53                   	push   %ebx
+  806664:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  806667:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80666a:	50                   	push   %eax
+  80666b:	ff 75 08             	push   0x8(%ebp)
+  80666e:	e8 6f fe ff ff       	call   8064e2 <fd_lookup>
+  806673:	89 c3                	mov    %eax,%ebx
+  806675:	83 c4 10             	add    $0x10,%esp
+  806678:	85 c0                	test   %eax,%eax
+  80667a:	78 7f                	js     8066fb <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80667c:	83 ec 0c             	sub    $0xc,%esp
+  80667f:	ff 75 0c             	push   0xc(%ebp)
+  806682:	e8 85 ff ff ff       	call   80660c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  806687:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80668a:	c1 e6 0c             	shl    $0xc,%esi
+  80668d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  806693:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  806696:	89 3c 24             	mov    %edi,(%esp)
+  806699:	e8 d7 fd ff ff       	call   806475 <fd2data>
+  80669e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8066a0:	89 34 24             	mov    %esi,(%esp)
+  8066a3:	e8 cd fd ff ff       	call   806475 <fd2data>
+  8066a8:	83 c4 10             	add    $0x10,%esp
+  8066ab:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8066ae:	89 d8                	mov    %ebx,%eax
+  8066b0:	c1 e8 16             	shr    $0x16,%eax
+  8066b3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8066ba:	a8 01                	test   $0x1,%al
+  8066bc:	74 11                	je     8066cf <dup+0x71>
+  8066be:	89 d8                	mov    %ebx,%eax
+  8066c0:	c1 e8 0c             	shr    $0xc,%eax
+  8066c3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8066ca:	f6 c2 01             	test   $0x1,%dl
+  8066cd:	75 36                	jne    806705 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8066cf:	89 f8                	mov    %edi,%eax
+  8066d1:	c1 e8 0c             	shr    $0xc,%eax
+  8066d4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8066db:	83 ec 0c             	sub    $0xc,%esp
+  8066de:	25 07 0e 00 00       	and    $0xe07,%eax
+  8066e3:	50                   	push   %eax
+  8066e4:	56                   	push   %esi
+  8066e5:	6a 00                	push   $0x0
+  8066e7:	57                   	push   %edi
+  8066e8:	6a 00                	push   $0x0
+  8066ea:	e8 44 f7 ff ff       	call   805e33 <sys_page_map>
+  8066ef:	89 c3                	mov    %eax,%ebx
+  8066f1:	83 c4 20             	add    $0x20,%esp
+  8066f4:	85 c0                	test   %eax,%eax
+  8066f6:	78 33                	js     80672b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8066f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8066fb:	89 d8                	mov    %ebx,%eax
+  8066fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806700:	5b                   	pop    %ebx
+  806701:	5e                   	pop    %esi
+  806702:	5f                   	pop    %edi
+  806703:	5d                   	pop    %ebp
+  806704:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  806705:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80670c:	83 ec 0c             	sub    $0xc,%esp
+  80670f:	25 07 0e 00 00       	and    $0xe07,%eax
+  806714:	50                   	push   %eax
+  806715:	ff 75 d4             	push   -0x2c(%ebp)
+  806718:	6a 00                	push   $0x0
+  80671a:	53                   	push   %ebx
+  80671b:	6a 00                	push   $0x0
+  80671d:	e8 11 f7 ff ff       	call   805e33 <sys_page_map>
+  806722:	89 c3                	mov    %eax,%ebx
+  806724:	83 c4 20             	add    $0x20,%esp
+  806727:	85 c0                	test   %eax,%eax
+  806729:	79 a4                	jns    8066cf <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80672b:	83 ec 08             	sub    $0x8,%esp
+  80672e:	56                   	push   %esi
+  80672f:	6a 00                	push   $0x0
+  806731:	e8 3f f7 ff ff       	call   805e75 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  806736:	83 c4 08             	add    $0x8,%esp
+  806739:	ff 75 d4             	push   -0x2c(%ebp)
+  80673c:	6a 00                	push   $0x0
+  80673e:	e8 32 f7 ff ff       	call   805e75 <sys_page_unmap>
+	return r;
+  806743:	83 c4 10             	add    $0x10,%esp
+  806746:	eb b3                	jmp    8066fb <dup+0x9d>
+
+00806748 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  806748:	55                   	push   %ebp
+  806749:	89 e5                	mov    %esp,%ebp
+  80674b:	56                   	push   %esi
+  80674c:	53                   	push   %ebx
+  80674d:	83 ec 18             	sub    $0x18,%esp
+  806750:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  806753:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  806756:	50                   	push   %eax
+  806757:	56                   	push   %esi
+  806758:	e8 85 fd ff ff       	call   8064e2 <fd_lookup>
+  80675d:	83 c4 10             	add    $0x10,%esp
+  806760:	85 c0                	test   %eax,%eax
+  806762:	78 3c                	js     8067a0 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  806764:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  806767:	83 ec 08             	sub    $0x8,%esp
+  80676a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80676d:	50                   	push   %eax
+  80676e:	ff 33                	push   (%ebx)
+  806770:	e8 bd fd ff ff       	call   806532 <dev_lookup>
+  806775:	83 c4 10             	add    $0x10,%esp
+  806778:	85 c0                	test   %eax,%eax
+  80677a:	78 24                	js     8067a0 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80677c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80677f:	83 e0 03             	and    $0x3,%eax
+  806782:	83 f8 01             	cmp    $0x1,%eax
+  806785:	74 20                	je     8067a7 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  806787:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80678a:	8b 40 08             	mov    0x8(%eax),%eax
+  80678d:	85 c0                	test   %eax,%eax
+  80678f:	74 37                	je     8067c8 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  806791:	83 ec 04             	sub    $0x4,%esp
+  806794:	ff 75 10             	push   0x10(%ebp)
+  806797:	ff 75 0c             	push   0xc(%ebp)
+  80679a:	53                   	push   %ebx
+  80679b:	ff d0                	call   *%eax
+  80679d:	83 c4 10             	add    $0x10,%esp
+}
+  8067a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8067a3:	5b                   	pop    %ebx
+  8067a4:	5e                   	pop    %esi
+  8067a5:	5d                   	pop    %ebp
+  8067a6:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8067a7:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  8067ac:	8b 40 48             	mov    0x48(%eax),%eax
+  8067af:	83 ec 04             	sub    $0x4,%esp
+  8067b2:	56                   	push   %esi
+  8067b3:	50                   	push   %eax
+  8067b4:	68 bd 95 80 00       	push   $0x8095bd
+  8067b9:	e8 30 ec ff ff       	call   8053ee <cprintf>
+		return -E_INVAL;
+  8067be:	83 c4 10             	add    $0x10,%esp
+  8067c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8067c6:	eb d8                	jmp    8067a0 <read+0x58>
+		return -E_NOT_SUPP;
+  8067c8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8067cd:	eb d1                	jmp    8067a0 <read+0x58>
+
+008067cf <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8067cf:	55                   	push   %ebp
+  8067d0:	89 e5                	mov    %esp,%ebp
+  8067d2:	57                   	push   %edi
+  8067d3:	56                   	push   %esi
+  8067d4:	53                   	push   %ebx
+  8067d5:	83 ec 0c             	sub    $0xc,%esp
+  8067d8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8067db:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8067de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8067e3:	eb 02                	jmp    8067e7 <readn+0x18>
+  8067e5:	01 c3                	add    %eax,%ebx
+  8067e7:	39 f3                	cmp    %esi,%ebx
+  8067e9:	73 21                	jae    80680c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8067eb:	83 ec 04             	sub    $0x4,%esp
+  8067ee:	89 f0                	mov    %esi,%eax
+  8067f0:	29 d8                	sub    %ebx,%eax
+  8067f2:	50                   	push   %eax
+  8067f3:	89 d8                	mov    %ebx,%eax
+  8067f5:	03 45 0c             	add    0xc(%ebp),%eax
+  8067f8:	50                   	push   %eax
+  8067f9:	57                   	push   %edi
+  8067fa:	e8 49 ff ff ff       	call   806748 <read>
+		if (m < 0)
+  8067ff:	83 c4 10             	add    $0x10,%esp
+  806802:	85 c0                	test   %eax,%eax
+  806804:	78 04                	js     80680a <readn+0x3b>
+			return m;
+		if (m == 0)
+  806806:	75 dd                	jne    8067e5 <readn+0x16>
+  806808:	eb 02                	jmp    80680c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80680a:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80680c:	89 d8                	mov    %ebx,%eax
+  80680e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806811:	5b                   	pop    %ebx
+  806812:	5e                   	pop    %esi
+  806813:	5f                   	pop    %edi
+  806814:	5d                   	pop    %ebp
+  806815:	c3                   	ret
+
+00806816 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  806816:	55                   	push   %ebp
+  806817:	89 e5                	mov    %esp,%ebp
+  806819:	56                   	push   %esi
+  80681a:	53                   	push   %ebx
+  80681b:	83 ec 18             	sub    $0x18,%esp
+  80681e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  806821:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  806824:	50                   	push   %eax
+  806825:	53                   	push   %ebx
+  806826:	e8 b7 fc ff ff       	call   8064e2 <fd_lookup>
+  80682b:	83 c4 10             	add    $0x10,%esp
+  80682e:	85 c0                	test   %eax,%eax
+  806830:	78 37                	js     806869 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  806832:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  806835:	83 ec 08             	sub    $0x8,%esp
+  806838:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80683b:	50                   	push   %eax
+  80683c:	ff 36                	push   (%esi)
+  80683e:	e8 ef fc ff ff       	call   806532 <dev_lookup>
+  806843:	83 c4 10             	add    $0x10,%esp
+  806846:	85 c0                	test   %eax,%eax
+  806848:	78 1f                	js     806869 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80684a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80684e:	74 20                	je     806870 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  806850:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  806853:	8b 40 0c             	mov    0xc(%eax),%eax
+  806856:	85 c0                	test   %eax,%eax
+  806858:	74 37                	je     806891 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80685a:	83 ec 04             	sub    $0x4,%esp
+  80685d:	ff 75 10             	push   0x10(%ebp)
+  806860:	ff 75 0c             	push   0xc(%ebp)
+  806863:	56                   	push   %esi
+  806864:	ff d0                	call   *%eax
+  806866:	83 c4 10             	add    $0x10,%esp
+}
+  806869:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80686c:	5b                   	pop    %ebx
+  80686d:	5e                   	pop    %esi
+  80686e:	5d                   	pop    %ebp
+  80686f:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  806870:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  806875:	8b 40 48             	mov    0x48(%eax),%eax
+  806878:	83 ec 04             	sub    $0x4,%esp
+  80687b:	53                   	push   %ebx
+  80687c:	50                   	push   %eax
+  80687d:	68 d9 95 80 00       	push   $0x8095d9
+  806882:	e8 67 eb ff ff       	call   8053ee <cprintf>
+		return -E_INVAL;
+  806887:	83 c4 10             	add    $0x10,%esp
+  80688a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80688f:	eb d8                	jmp    806869 <write+0x53>
+		return -E_NOT_SUPP;
+  806891:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  806896:	eb d1                	jmp    806869 <write+0x53>
+
+00806898 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  806898:	55                   	push   %ebp
+  806899:	89 e5                	mov    %esp,%ebp
+  80689b:	53                   	push   %ebx
+  80689c:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80689f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8068a2:	50                   	push   %eax
+  8068a3:	ff 75 08             	push   0x8(%ebp)
+  8068a6:	e8 37 fc ff ff       	call   8064e2 <fd_lookup>
+  8068ab:	83 c4 10             	add    $0x10,%esp
+  8068ae:	85 c0                	test   %eax,%eax
+  8068b0:	78 3a                	js     8068ec <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8068b2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8068b5:	83 ec 08             	sub    $0x8,%esp
+  8068b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8068bb:	50                   	push   %eax
+  8068bc:	ff 33                	push   (%ebx)
+  8068be:	e8 6f fc ff ff       	call   806532 <dev_lookup>
+  8068c3:	83 c4 10             	add    $0x10,%esp
+  8068c6:	85 c0                	test   %eax,%eax
+  8068c8:	78 22                	js     8068ec <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8068ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8068cd:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8068d0:	85 c0                	test   %eax,%eax
+  8068d2:	74 0d                	je     8068e1 <seek+0x49>
+  8068d4:	83 ec 0c             	sub    $0xc,%esp
+  8068d7:	53                   	push   %ebx
+  8068d8:	ff d0                	call   *%eax
+  8068da:	83 c4 10             	add    $0x10,%esp
+  8068dd:	85 c0                	test   %eax,%eax
+  8068df:	78 0b                	js     8068ec <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8068e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8068e4:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8068e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8068ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8068ef:	c9                   	leave
+  8068f0:	c3                   	ret
+
+008068f1 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8068f1:	55                   	push   %ebp
+  8068f2:	89 e5                	mov    %esp,%ebp
+  8068f4:	53                   	push   %ebx
+  8068f5:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8068f8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8068fb:	50                   	push   %eax
+  8068fc:	ff 75 08             	push   0x8(%ebp)
+  8068ff:	e8 de fb ff ff       	call   8064e2 <fd_lookup>
+  806904:	83 c4 10             	add    $0x10,%esp
+  806907:	85 c0                	test   %eax,%eax
+  806909:	78 2b                	js     806936 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80690b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80690e:	83 ec 08             	sub    $0x8,%esp
+  806911:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  806914:	50                   	push   %eax
+  806915:	ff 33                	push   (%ebx)
+  806917:	e8 16 fc ff ff       	call   806532 <dev_lookup>
+  80691c:	83 c4 10             	add    $0x10,%esp
+  80691f:	85 c0                	test   %eax,%eax
+  806921:	78 13                	js     806936 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  806923:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  806926:	8b 40 1c             	mov    0x1c(%eax),%eax
+  806929:	85 c0                	test   %eax,%eax
+  80692b:	74 0e                	je     80693b <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  80692d:	83 ec 0c             	sub    $0xc,%esp
+  806930:	53                   	push   %ebx
+  806931:	ff d0                	call   *%eax
+  806933:	83 c4 10             	add    $0x10,%esp
+}
+  806936:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  806939:	c9                   	leave
+  80693a:	c3                   	ret
+		return 0;
+  80693b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806940:	eb f4                	jmp    806936 <fsync+0x45>
+
+00806942 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  806942:	55                   	push   %ebp
+  806943:	89 e5                	mov    %esp,%ebp
+  806945:	56                   	push   %esi
+  806946:	53                   	push   %ebx
+  806947:	83 ec 18             	sub    $0x18,%esp
+  80694a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80694d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  806950:	50                   	push   %eax
+  806951:	53                   	push   %ebx
+  806952:	e8 8b fb ff ff       	call   8064e2 <fd_lookup>
+  806957:	83 c4 10             	add    $0x10,%esp
+  80695a:	85 c0                	test   %eax,%eax
+  80695c:	78 34                	js     806992 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80695e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  806961:	83 ec 08             	sub    $0x8,%esp
+  806964:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  806967:	50                   	push   %eax
+  806968:	ff 36                	push   (%esi)
+  80696a:	e8 c3 fb ff ff       	call   806532 <dev_lookup>
+  80696f:	83 c4 10             	add    $0x10,%esp
+  806972:	85 c0                	test   %eax,%eax
+  806974:	78 1c                	js     806992 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  806976:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80697a:	74 1d                	je     806999 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80697c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80697f:	8b 40 18             	mov    0x18(%eax),%eax
+  806982:	85 c0                	test   %eax,%eax
+  806984:	74 34                	je     8069ba <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  806986:	83 ec 08             	sub    $0x8,%esp
+  806989:	ff 75 0c             	push   0xc(%ebp)
+  80698c:	56                   	push   %esi
+  80698d:	ff d0                	call   *%eax
+  80698f:	83 c4 10             	add    $0x10,%esp
+}
+  806992:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  806995:	5b                   	pop    %ebx
+  806996:	5e                   	pop    %esi
+  806997:	5d                   	pop    %ebp
+  806998:	c3                   	ret
+			thisenv->env_id, fdnum);
+  806999:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  80699e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8069a1:	83 ec 04             	sub    $0x4,%esp
+  8069a4:	53                   	push   %ebx
+  8069a5:	50                   	push   %eax
+  8069a6:	68 9c 95 80 00       	push   $0x80959c
+  8069ab:	e8 3e ea ff ff       	call   8053ee <cprintf>
+		return -E_INVAL;
+  8069b0:	83 c4 10             	add    $0x10,%esp
+  8069b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8069b8:	eb d8                	jmp    806992 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8069ba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8069bf:	eb d1                	jmp    806992 <ftruncate+0x50>
+
+008069c1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8069c1:	55                   	push   %ebp
+  8069c2:	89 e5                	mov    %esp,%ebp
+  8069c4:	56                   	push   %esi
+  8069c5:	53                   	push   %ebx
+  8069c6:	83 ec 18             	sub    $0x18,%esp
+  8069c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8069cc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8069cf:	50                   	push   %eax
+  8069d0:	ff 75 08             	push   0x8(%ebp)
+  8069d3:	e8 0a fb ff ff       	call   8064e2 <fd_lookup>
+  8069d8:	83 c4 10             	add    $0x10,%esp
+  8069db:	85 c0                	test   %eax,%eax
+  8069dd:	78 49                	js     806a28 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8069df:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8069e2:	83 ec 08             	sub    $0x8,%esp
+  8069e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8069e8:	50                   	push   %eax
+  8069e9:	ff 36                	push   (%esi)
+  8069eb:	e8 42 fb ff ff       	call   806532 <dev_lookup>
+  8069f0:	83 c4 10             	add    $0x10,%esp
+  8069f3:	85 c0                	test   %eax,%eax
+  8069f5:	78 31                	js     806a28 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8069f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8069fa:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8069fe:	74 2f                	je     806a2f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  806a00:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  806a03:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  806a0a:	00 00 00 
+	stat->st_isdir = 0;
+  806a0d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  806a14:	00 00 00 
+	stat->st_dev = dev;
+  806a17:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  806a1d:	83 ec 08             	sub    $0x8,%esp
+  806a20:	53                   	push   %ebx
+  806a21:	56                   	push   %esi
+  806a22:	ff 50 14             	call   *0x14(%eax)
+  806a25:	83 c4 10             	add    $0x10,%esp
+}
+  806a28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  806a2b:	5b                   	pop    %ebx
+  806a2c:	5e                   	pop    %esi
+  806a2d:	5d                   	pop    %ebp
+  806a2e:	c3                   	ret
+		return -E_NOT_SUPP;
+  806a2f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  806a34:	eb f2                	jmp    806a28 <fstat+0x67>
+
+00806a36 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  806a36:	55                   	push   %ebp
+  806a37:	89 e5                	mov    %esp,%ebp
+  806a39:	56                   	push   %esi
+  806a3a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  806a3b:	83 ec 08             	sub    $0x8,%esp
+  806a3e:	68 00 10 00 00       	push   $0x1000
+  806a43:	ff 75 08             	push   0x8(%ebp)
+  806a46:	e8 b3 07 00 00       	call   8071fe <open>
+  806a4b:	89 c3                	mov    %eax,%ebx
+  806a4d:	83 c4 10             	add    $0x10,%esp
+  806a50:	85 c0                	test   %eax,%eax
+  806a52:	78 1b                	js     806a6f <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  806a54:	83 ec 08             	sub    $0x8,%esp
+  806a57:	ff 75 0c             	push   0xc(%ebp)
+  806a5a:	50                   	push   %eax
+  806a5b:	e8 61 ff ff ff       	call   8069c1 <fstat>
+  806a60:	89 c6                	mov    %eax,%esi
+	close(fd);
+  806a62:	89 1c 24             	mov    %ebx,(%esp)
+  806a65:	e8 a2 fb ff ff       	call   80660c <close>
+	return r;
+  806a6a:	83 c4 10             	add    $0x10,%esp
+  806a6d:	89 f3                	mov    %esi,%ebx
+}
+  806a6f:	89 d8                	mov    %ebx,%eax
+  806a71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  806a74:	5b                   	pop    %ebx
+  806a75:	5e                   	pop    %esi
+  806a76:	5d                   	pop    %ebp
+  806a77:	c3                   	ret
+
+00806a78 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  806a78:	55                   	push   %ebp
+  806a79:	89 e5                	mov    %esp,%ebp
+  806a7b:	57                   	push   %edi
+  806a7c:	56                   	push   %esi
+  806a7d:	53                   	push   %ebx
+  806a7e:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  806a84:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  806a8a:	89 d6                	mov    %edx,%esi
+  806a8c:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  806a92:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  806a95:	89 d3                	mov    %edx,%ebx
+  806a97:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  806a9d:	83 3d c8 30 8a 00 00 	cmpl   $0x0,0x8a30c8
+  806aa4:	74 1d                	je     806ac3 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  806aa6:	b8 00 20 8a 00       	mov    $0x8a2000,%eax
+  806aab:	83 c8 07             	or     $0x7,%eax
+  806aae:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  806ab4:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  806ab9:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  806abf:	01 ce                	add    %ecx,%esi
+  806ac1:	eb 28                	jmp    806aeb <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  806ac3:	83 ec 0c             	sub    $0xc,%esp
+  806ac6:	6a 01                	push   $0x1
+  806ac8:	e8 59 f9 ff ff       	call   806426 <ipc_find_env>
+  806acd:	a3 c8 30 8a 00       	mov    %eax,0x8a30c8
+  806ad2:	83 c4 10             	add    $0x10,%esp
+  806ad5:	eb cf                	jmp    806aa6 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  806ad7:	83 c0 01             	add    $0x1,%eax
+  806ada:	89 fa                	mov    %edi,%edx
+  806adc:	09 da                	or     %ebx,%edx
+  806ade:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  806ae5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  806aeb:	39 f3                	cmp    %esi,%ebx
+  806aed:	72 e8                	jb     806ad7 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  806aef:	83 f8 41             	cmp    $0x41,%eax
+  806af2:	77 2f                	ja     806b23 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  806af4:	50                   	push   %eax
+  806af5:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  806afb:	50                   	push   %eax
+  806afc:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  806b02:	ff 35 c8 30 8a 00    	push   0x8a30c8
+  806b08:	e8 cb f8 ff ff       	call   8063d8 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  806b0d:	83 c4 0c             	add    $0xc,%esp
+  806b10:	6a 00                	push   $0x0
+  806b12:	6a 00                	push   $0x0
+  806b14:	6a 00                	push   $0x0
+  806b16:	e8 67 f7 ff ff       	call   806282 <ipc_recv>
+}
+  806b1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806b1e:	5b                   	pop    %ebx
+  806b1f:	5e                   	pop    %esi
+  806b20:	5f                   	pop    %edi
+  806b21:	5d                   	pop    %ebp
+  806b22:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  806b23:	68 0c 96 80 00       	push   $0x80960c
+  806b28:	68 fd 89 80 00       	push   $0x8089fd
+  806b2d:	6a 40                	push   $0x40
+  806b2f:	68 28 96 80 00       	push   $0x809628
+  806b34:	e8 da e7 ff ff       	call   805313 <_panic>
+
+00806b39 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  806b39:	55                   	push   %ebp
+  806b3a:	89 e5                	mov    %esp,%ebp
+  806b3c:	57                   	push   %edi
+  806b3d:	56                   	push   %esi
+  806b3e:	53                   	push   %ebx
+  806b3f:	83 ec 1c             	sub    $0x1c,%esp
+  806b42:	89 c3                	mov    %eax,%ebx
+  806b44:	89 d6                	mov    %edx,%esi
+  806b46:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  806b49:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  806b4f:	89 ca                	mov    %ecx,%edx
+  806b51:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  806b54:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  806b5b:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  806b5e:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  806b65:	8b 76 0c             	mov    0xc(%esi),%esi
+  806b68:	89 fb                	mov    %edi,%ebx
+  806b6a:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  806b71:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  806b74:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  806b7b:	8b 75 08             	mov    0x8(%ebp),%esi
+  806b7e:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  806b85:	8b 55 0c             	mov    0xc(%ebp),%edx
+  806b88:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  806b8f:	8d 41 01             	lea    0x1(%ecx),%eax
+	asm volatile("lock; xchgl %0, %1"
+  806b92:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  806b99:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  806b9e:	39 c8                	cmp    %ecx,%eax
+  806ba0:	74 0d                	je     806baf <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  806ba2:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ba7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806baa:	5b                   	pop    %ebx
+  806bab:	5e                   	pop    %esi
+  806bac:	5f                   	pop    %edi
+  806bad:	5d                   	pop    %ebp
+  806bae:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  806baf:	6a 07                	push   $0x7
+  806bb1:	68 00 20 8a 00       	push   $0x8a2000
+  806bb6:	6a 0d                	push   $0xd
+  806bb8:	ff 35 c8 30 8a 00    	push   0x8a30c8
+  806bbe:	e8 2a f7 ff ff       	call   8062ed <ipc_send>
+  806bc3:	83 c4 10             	add    $0x10,%esp
+  806bc6:	eb da                	jmp    806ba2 <fsring_post+0x69>
+
+00806bc8 <fsipcv>:
+{
+  806bc8:	55                   	push   %ebp
+  806bc9:	89 e5                	mov    %esp,%ebp
+  806bcb:	57                   	push   %edi
+  806bcc:	56                   	push   %esi
+  806bcd:	53                   	push   %ebx
+  806bce:	83 ec 0c             	sub    $0xc,%esp
+  806bd1:	89 c7                	mov    %eax,%edi
+  806bd3:	89 d3                	mov    %edx,%ebx
+  806bd5:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  806bd7:	83 3d c8 30 8a 00 00 	cmpl   $0x0,0x8a30c8
+  806bde:	74 26                	je     806c06 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  806be0:	6a 07                	push   $0x7
+  806be2:	68 00 20 8a 00       	push   $0x8a2000
+  806be7:	57                   	push   %edi
+  806be8:	ff 35 c8 30 8a 00    	push   0x8a30c8
+  806bee:	e8 fa f6 ff ff       	call   8062ed <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  806bf3:	6a 00                	push   $0x0
+  806bf5:	56                   	push   %esi
+  806bf6:	53                   	push   %ebx
+  806bf7:	6a 00                	push   $0x0
+  806bf9:	e8 47 f7 ff ff       	call   806345 <ipc_recvv>
+}
+  806bfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806c01:	5b                   	pop    %ebx
+  806c02:	5e                   	pop    %esi
+  806c03:	5f                   	pop    %edi
+  806c04:	5d                   	pop    %ebp
+  806c05:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  806c06:	83 ec 0c             	sub    $0xc,%esp
+  806c09:	6a 01                	push   $0x1
+  806c0b:	e8 16 f8 ff ff       	call   806426 <ipc_find_env>
+  806c10:	a3 c8 30 8a 00       	mov    %eax,0x8a30c8
+  806c15:	83 c4 10             	add    $0x10,%esp
+  806c18:	eb c6                	jmp    806be0 <fsipcv+0x18>
+
+00806c1a <fsipc>:
+{
+  806c1a:	55                   	push   %ebp
+  806c1b:	89 e5                	mov    %esp,%ebp
+  806c1d:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  806c20:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  806c27:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  806c2a:	e8 99 ff ff ff       	call   806bc8 <fsipcv>
+}
+  806c2f:	c9                   	leave
+  806c30:	c3                   	ret
+
+00806c31 <file_write_direct>:
+{
+  806c31:	55                   	push   %ebp
+  806c32:	89 e5                	mov    %esp,%ebp
+  806c34:	56                   	push   %esi
+  806c35:	53                   	push   %ebx
+  806c36:	89 c3                	mov    %eax,%ebx
+  806c38:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  806c3a:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  806c40:	77 40                	ja     806c82 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  806c42:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  806c47:	39 c8                	cmp    %ecx,%eax
+  806c49:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  806c4c:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  806c4f:	89 0d 00 20 8a 00    	mov    %ecx,0x8a2000
+	fsipcbuf.write.req_n = n;
+  806c55:	a3 04 20 8a 00       	mov    %eax,0x8a2004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  806c5a:	83 ec 04             	sub    $0x4,%esp
+  806c5d:	50                   	push   %eax
+  806c5e:	52                   	push   %edx
+  806c5f:	68 08 20 8a 00       	push   $0x8a2008
+  806c64:	e8 f9 ee ff ff       	call   805b62 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  806c69:	ba 00 00 00 00       	mov    $0x0,%edx
+  806c6e:	b8 04 00 00 00       	mov    $0x4,%eax
+  806c73:	e8 a2 ff ff ff       	call   806c1a <fsipc>
+  806c78:	83 c4 10             	add    $0x10,%esp
+}
+  806c7b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  806c7e:	5b                   	pop    %ebx
+  806c7f:	5e                   	pop    %esi
+  806c80:	5d                   	pop    %ebp
+  806c81:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  806c82:	89 d6                	mov    %edx,%esi
+  806c84:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  806c8a:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  806c8f:	29 f1                	sub    %esi,%ecx
+  806c91:	39 c1                	cmp    %eax,%ecx
+  806c93:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  806c96:	8b 43 0c             	mov    0xc(%ebx),%eax
+  806c99:	a3 00 20 8a 00       	mov    %eax,0x8a2000
+	fsipcbuf.bulk.req_n = n;
+  806c9e:	89 0d 04 20 8a 00    	mov    %ecx,0x8a2004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  806ca4:	89 35 08 20 8a 00    	mov    %esi,0x8a2008
+	return fsipc_pages(type, buf, n, perm);
+  806caa:	83 ec 0c             	sub    $0xc,%esp
+  806cad:	6a 05                	push   $0x5
+  806caf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  806cb4:	e8 bf fd ff ff       	call   806a78 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  806cb9:	83 c4 10             	add    $0x10,%esp
+  806cbc:	eb bd                	jmp    806c7b <file_write_direct+0x4a>
+
+00806cbe <devfile_sync>:
+{
+  806cbe:	55                   	push   %ebp
+  806cbf:	89 e5                	mov    %esp,%ebp
+  806cc1:	57                   	push   %edi
+  806cc2:	56                   	push   %esi
+  806cc3:	53                   	push   %ebx
+  806cc4:	83 ec 28             	sub    $0x28,%esp
+  806cc7:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  806cca:	56                   	push   %esi
+  806ccb:	e8 a5 f7 ff ff       	call   806475 <fd2data>
+  806cd0:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  806cd2:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  806cd5:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  806cdc:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  806cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  806ce4:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  806ce8:	74 45                	je     806d2f <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  806cea:	8b 46 14             	mov    0x14(%esi),%eax
+  806ced:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  806cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  806cf5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  806cfa:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  806cfd:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  806d00:	39 cb                	cmp    %ecx,%ebx
+  806d02:	73 14                	jae    806d18 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  806d04:	29 d9                	sub    %ebx,%ecx
+  806d06:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  806d09:	89 f0                	mov    %esi,%eax
+  806d0b:	e8 21 ff ff ff       	call   806c31 <file_write_direct>
+  806d10:	85 c0                	test   %eax,%eax
+  806d12:	7e 04                	jle    806d18 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  806d14:	01 c3                	add    %eax,%ebx
+  806d16:	eb e5                	jmp    806cfd <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  806d18:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  806d1b:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  806d22:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  806d25:	85 c0                	test   %eax,%eax
+  806d27:	ba 00 00 00 00       	mov    $0x0,%edx
+  806d2c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  806d2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806d32:	5b                   	pop    %ebx
+  806d33:	5e                   	pop    %esi
+  806d34:	5f                   	pop    %edi
+  806d35:	5d                   	pop    %ebp
+  806d36:	c3                   	ret
+
+00806d37 <devfile_write>:
+{
+  806d37:	55                   	push   %ebp
+  806d38:	89 e5                	mov    %esp,%ebp
+  806d3a:	57                   	push   %edi
+  806d3b:	56                   	push   %esi
+  806d3c:	53                   	push   %ebx
+  806d3d:	83 ec 28             	sub    $0x28,%esp
+  806d40:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  806d43:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  806d46:	53                   	push   %ebx
+  806d47:	e8 29 f7 ff ff       	call   806475 <fd2data>
+  806d4c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  806d4f:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  806d52:	83 c4 10             	add    $0x10,%esp
+  806d55:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  806d59:	74 43                	je     806d9e <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  806d5b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  806d62:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  806d65:	85 c0                	test   %eax,%eax
+  806d67:	74 43                	je     806dac <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  806d69:	89 c2                	mov    %eax,%edx
+  806d6b:	03 53 14             	add    0x14(%ebx),%edx
+  806d6e:	39 fa                	cmp    %edi,%edx
+  806d70:	75 0b                	jne    806d7d <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  806d72:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  806d75:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  806d7b:	76 66                	jbe    806de3 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  806d7d:	83 ec 0c             	sub    $0xc,%esp
+  806d80:	53                   	push   %ebx
+  806d81:	e8 38 ff ff ff       	call   806cbe <devfile_sync>
+  806d86:	83 c4 10             	add    $0x10,%esp
+  806d89:	85 c0                	test   %eax,%eax
+  806d8b:	78 4e                	js     806ddb <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  806d8d:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  806d93:	77 56                	ja     806deb <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  806d95:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  806d98:	85 c0                	test   %eax,%eax
+  806d9a:	75 20                	jne    806dbc <devfile_write+0x85>
+  806d9c:	eb 16                	jmp    806db4 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  806d9e:	89 f1                	mov    %esi,%ecx
+  806da0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  806da3:	89 d8                	mov    %ebx,%eax
+  806da5:	e8 87 fe ff ff       	call   806c31 <file_write_direct>
+  806daa:	eb 2f                	jmp    806ddb <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  806dac:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  806db2:	77 37                	ja     806deb <devfile_write+0xb4>
+		ff->buf_base = pos;
+  806db4:	89 7b 14             	mov    %edi,0x14(%ebx)
+  806db7:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  806dbc:	83 ec 04             	sub    $0x4,%esp
+  806dbf:	56                   	push   %esi
+  806dc0:	ff 75 0c             	push   0xc(%ebp)
+  806dc3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  806dc6:	01 c1                	add    %eax,%ecx
+  806dc8:	51                   	push   %ecx
+  806dc9:	e8 94 ed ff ff       	call   805b62 <memmove>
+	ff->buf_wlen += n;
+  806dce:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  806dd1:	01 f7                	add    %esi,%edi
+  806dd3:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  806dd6:	89 f0                	mov    %esi,%eax
+  806dd8:	83 c4 10             	add    $0x10,%esp
+}
+  806ddb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806dde:	5b                   	pop    %ebx
+  806ddf:	5e                   	pop    %esi
+  806de0:	5f                   	pop    %edi
+  806de1:	5d                   	pop    %ebp
+  806de2:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  806de3:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  806de9:	76 d1                	jbe    806dbc <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  806deb:	89 f1                	mov    %esi,%ecx
+  806ded:	8b 55 0c             	mov    0xc(%ebp),%edx
+  806df0:	89 d8                	mov    %ebx,%eax
+  806df2:	e8 3a fe ff ff       	call   806c31 <file_write_direct>
+  806df7:	eb e2                	jmp    806ddb <devfile_write+0xa4>
+
+00806df9 <devfile_trunc>:
+{
+  806df9:	55                   	push   %ebp
+  806dfa:	89 e5                	mov    %esp,%ebp
+  806dfc:	53                   	push   %ebx
+  806dfd:	83 ec 10             	sub    $0x10,%esp
+  806e00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  806e03:	53                   	push   %ebx
+  806e04:	e8 b5 fe ff ff       	call   806cbe <devfile_sync>
+  806e09:	83 c4 10             	add    $0x10,%esp
+  806e0c:	85 c0                	test   %eax,%eax
+  806e0e:	78 1f                	js     806e2f <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  806e10:	8b 43 0c             	mov    0xc(%ebx),%eax
+  806e13:	a3 00 20 8a 00       	mov    %eax,0x8a2000
+	fsipcbuf.set_size.req_size = newsize;
+  806e18:	8b 45 0c             	mov    0xc(%ebp),%eax
+  806e1b:	a3 04 20 8a 00       	mov    %eax,0x8a2004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  806e20:	ba 00 00 00 00       	mov    $0x0,%edx
+  806e25:	b8 02 00 00 00       	mov    $0x2,%eax
+  806e2a:	e8 eb fd ff ff       	call   806c1a <fsipc>
+}
+  806e2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  806e32:	c9                   	leave
+  806e33:	c3                   	ret
+
+00806e34 <devfile_stat>:
+{
+  806e34:	55                   	push   %ebp
+  806e35:	89 e5                	mov    %esp,%ebp
+  806e37:	56                   	push   %esi
+  806e38:	53                   	push   %ebx
+  806e39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  806e3c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  806e3f:	83 ec 0c             	sub    $0xc,%esp
+  806e42:	53                   	push   %ebx
+  806e43:	e8 76 fe ff ff       	call   806cbe <devfile_sync>
+  806e48:	83 c4 10             	add    $0x10,%esp
+  806e4b:	85 c0                	test   %eax,%eax
+  806e4d:	78 47                	js     806e96 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  806e4f:	8b 43 0c             	mov    0xc(%ebx),%eax
+  806e52:	a3 00 20 8a 00       	mov    %eax,0x8a2000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  806e57:	ba 00 00 00 00       	mov    $0x0,%edx
+  806e5c:	b8 05 00 00 00       	mov    $0x5,%eax
+  806e61:	e8 b4 fd ff ff       	call   806c1a <fsipc>
+  806e66:	85 c0                	test   %eax,%eax
+  806e68:	78 2c                	js     806e96 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  806e6a:	83 ec 08             	sub    $0x8,%esp
+  806e6d:	68 00 20 8a 00       	push   $0x8a2000
+  806e72:	56                   	push   %esi
+  806e73:	e8 64 eb ff ff       	call   8059dc <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  806e78:	a1 80 20 8a 00       	mov    0x8a2080,%eax
+  806e7d:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  806e83:	a1 84 20 8a 00       	mov    0x8a2084,%eax
+  806e88:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  806e8e:	83 c4 10             	add    $0x10,%esp
+  806e91:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806e96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  806e99:	5b                   	pop    %ebx
+  806e9a:	5e                   	pop    %esi
+  806e9b:	5d                   	pop    %ebp
+  806e9c:	c3                   	ret
+
+00806e9d <devfile_flush>:
+{
+  806e9d:	55                   	push   %ebp
+  806e9e:	89 e5                	mov    %esp,%ebp
+  806ea0:	56                   	push   %esi
+  806ea1:	53                   	push   %ebx
+  806ea2:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  806ea5:	83 ec 0c             	sub    $0xc,%esp
+  806ea8:	56                   	push   %esi
+  806ea9:	e8 10 fe ff ff       	call   806cbe <devfile_sync>
+  806eae:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  806eb0:	83 c4 10             	add    $0x10,%esp
+  806eb3:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  806eb7:	75 25                	jne    806ede <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  806eb9:	8b 46 0c             	mov    0xc(%esi),%eax
+  806ebc:	a3 00 20 8a 00       	mov    %eax,0x8a2000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  806ec1:	ba 00 00 00 00       	mov    $0x0,%edx
+  806ec6:	b8 06 00 00 00       	mov    $0x6,%eax
+  806ecb:	e8 4a fd ff ff       	call   806c1a <fsipc>
+  806ed0:	85 c0                	test   %eax,%eax
+  806ed2:	0f 45 d8             	cmovne %eax,%ebx
+}
+  806ed5:	89 d8                	mov    %ebx,%eax
+  806ed7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  806eda:	5b                   	pop    %ebx
+  806edb:	5e                   	pop    %esi
+  806edc:	5d                   	pop    %ebp
+  806edd:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  806ede:	83 ec 0c             	sub    $0xc,%esp
+  806ee1:	56                   	push   %esi
+  806ee2:	e8 8e f5 ff ff       	call   806475 <fd2data>
+  806ee7:	83 c4 08             	add    $0x8,%esp
+  806eea:	50                   	push   %eax
+  806eeb:	6a 00                	push   $0x0
+  806eed:	e8 83 ef ff ff       	call   805e75 <sys_page_unmap>
+  806ef2:	83 c4 10             	add    $0x10,%esp
+  806ef5:	eb c2                	jmp    806eb9 <devfile_flush+0x1c>
+
+00806ef7 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  806ef7:	55                   	push   %ebp
+  806ef8:	89 e5                	mov    %esp,%ebp
+  806efa:	57                   	push   %edi
+  806efb:	56                   	push   %esi
+  806efc:	53                   	push   %ebx
+  806efd:	83 ec 64             	sub    $0x64,%esp
+  806f00:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  806f02:	52                   	push   %edx
+  806f03:	50                   	push   %eax
+  806f04:	e8 d9 f5 ff ff       	call   8064e2 <fd_lookup>
+  806f09:	89 c1                	mov    %eax,%ecx
+  806f0b:	83 c4 10             	add    $0x10,%esp
+  806f0e:	85 c0                	test   %eax,%eax
+  806f10:	0f 88 f2 00 00 00    	js     807008 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  806f16:	8b 07                	mov    (%edi),%eax
+  806f18:	8b 15 a0 50 82 00    	mov    0x8250a0,%edx
+  806f1e:	39 10                	cmp    %edx,(%eax)
+  806f20:	0f 85 03 01 00 00    	jne    807029 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  806f26:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  806f2b:	8b 40 48             	mov    0x48(%eax),%eax
+  806f2e:	3b 05 c4 30 8a 00    	cmp    0x8a30c4,%eax
+  806f34:	0f 84 96 00 00 00    	je     806fd0 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  806f3a:	83 3d c8 30 8a 00 00 	cmpl   $0x0,0x8a30c8
+  806f41:	0f 84 cb 00 00 00    	je     807012 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  806f47:	b8 00 20 8a 00       	mov    $0x8a2000,%eax
+  806f4c:	83 c8 07             	or     $0x7,%eax
+  806f4f:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  806f52:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  806f55:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  806f5a:	83 ec 04             	sub    $0x4,%esp
+  806f5d:	68 07 04 00 00       	push   $0x407
+  806f62:	53                   	push   %ebx
+  806f63:	6a 00                	push   $0x0
+  806f65:	e8 7e ee ff ff       	call   805de8 <sys_page_alloc>
+  806f6a:	89 c1                	mov    %eax,%ecx
+  806f6c:	83 c4 10             	add    $0x10,%esp
+  806f6f:	85 c0                	test   %eax,%eax
+  806f71:	0f 88 91 00 00 00    	js     807008 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  806f77:	89 d8                	mov    %ebx,%eax
+  806f79:	83 c8 07             	or     $0x7,%eax
+  806f7c:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  806f7e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  806f84:	83 c6 04             	add    $0x4,%esi
+  806f87:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  806f8d:	75 cb                	jne    806f5a <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  806f8f:	6a 12                	push   $0x12
+  806f91:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  806f94:	50                   	push   %eax
+  806f95:	6a 0c                	push   $0xc
+  806f97:	ff 35 c8 30 8a 00    	push   0x8a30c8
+  806f9d:	e8 36 f4 ff ff       	call   8063d8 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  806fa2:	83 c4 0c             	add    $0xc,%esp
+  806fa5:	6a 00                	push   $0x0
+  806fa7:	6a 00                	push   $0x0
+  806fa9:	6a 00                	push   $0x0
+  806fab:	e8 d2 f2 ff ff       	call   806282 <ipc_recv>
+  806fb0:	89 c1                	mov    %eax,%ecx
+  806fb2:	83 c4 10             	add    $0x10,%esp
+  806fb5:	85 c0                	test   %eax,%eax
+  806fb7:	78 4f                	js     807008 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  806fb9:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  806fbe:	8b 40 48             	mov    0x48(%eax),%eax
+  806fc1:	a3 c4 30 8a 00       	mov    %eax,0x8a30c4
+	fsring_busy = 0;
+  806fc6:	c7 05 c0 30 8a 00 00 	movl   $0x0,0x8a30c0
+  806fcd:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  806fd0:	83 ec 0c             	sub    $0xc,%esp
+  806fd3:	ff 37                	push   (%edi)
+  806fd5:	e8 e4 fc ff ff       	call   806cbe <devfile_sync>
+  806fda:	89 c1                	mov    %eax,%ecx
+  806fdc:	83 c4 10             	add    $0x10,%esp
+  806fdf:	85 c0                	test   %eax,%eax
+  806fe1:	78 25                	js     807008 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  806fe3:	8b 1d c0 30 8a 00    	mov    0x8a30c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  806fe9:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  806fee:	ba 01 00 00 00       	mov    $0x1,%edx
+  806ff3:	89 d0                	mov    %edx,%eax
+  806ff5:	d3 e0                	shl    %cl,%eax
+  806ff7:	85 d8                	test   %ebx,%eax
+  806ff9:	74 0d                	je     807008 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  806ffb:	83 c1 01             	add    $0x1,%ecx
+  806ffe:	83 f9 10             	cmp    $0x10,%ecx
+  807001:	75 f0                	jne    806ff3 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  807003:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  807008:	89 c8                	mov    %ecx,%eax
+  80700a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80700d:	5b                   	pop    %ebx
+  80700e:	5e                   	pop    %esi
+  80700f:	5f                   	pop    %edi
+  807010:	5d                   	pop    %ebp
+  807011:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  807012:	83 ec 0c             	sub    $0xc,%esp
+  807015:	6a 01                	push   $0x1
+  807017:	e8 0a f4 ff ff       	call   806426 <ipc_find_env>
+  80701c:	a3 c8 30 8a 00       	mov    %eax,0x8a30c8
+  807021:	83 c4 10             	add    $0x10,%esp
+  807024:	e9 1e ff ff ff       	jmp    806f47 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  807029:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  80702e:	eb d8                	jmp    807008 <fsring_slot+0x111>
+
+00807030 <file_read_direct>:
+{
+  807030:	55                   	push   %ebp
+  807031:	89 e5                	mov    %esp,%ebp
+  807033:	57                   	push   %edi
+  807034:	56                   	push   %esi
+  807035:	53                   	push   %ebx
+  807036:	83 ec 1c             	sub    $0x1c,%esp
+  807039:	89 c7                	mov    %eax,%edi
+  80703b:	89 d6                	mov    %edx,%esi
+  80703d:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  80703f:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  807045:	77 52                	ja     807099 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  807047:	8b 40 0c             	mov    0xc(%eax),%eax
+  80704a:	a3 00 20 8a 00       	mov    %eax,0x8a2000
+	fsipcbuf.read.req_n = n;
+  80704f:	89 0d 04 20 8a 00    	mov    %ecx,0x8a2004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  807055:	ba 00 00 00 00       	mov    $0x0,%edx
+  80705a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80705f:	e8 b6 fb ff ff       	call   806c1a <fsipc>
+  807064:	89 c7                	mov    %eax,%edi
+  807066:	85 c0                	test   %eax,%eax
+  807068:	78 25                	js     80708f <file_read_direct+0x5f>
+	assert(r <= n);
+  80706a:	39 c3                	cmp    %eax,%ebx
+  80706c:	0f 82 87 00 00 00    	jb     8070f9 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  807072:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  807077:	0f 8f 95 00 00 00    	jg     807112 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80707d:	83 ec 04             	sub    $0x4,%esp
+  807080:	50                   	push   %eax
+  807081:	68 00 20 8a 00       	push   $0x8a2000
+  807086:	56                   	push   %esi
+  807087:	e8 d6 ea ff ff       	call   805b62 <memmove>
+	return r;
+  80708c:	83 c4 10             	add    $0x10,%esp
+}
+  80708f:	89 f8                	mov    %edi,%eax
+  807091:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807094:	5b                   	pop    %ebx
+  807095:	5e                   	pop    %esi
+  807096:	5f                   	pop    %edi
+  807097:	5d                   	pop    %ebp
+  807098:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  807099:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80709f:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8070a4:	29 d1                	sub    %edx,%ecx
+  8070a6:	39 d9                	cmp    %ebx,%ecx
+  8070a8:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8070ab:	89 f0                	mov    %esi,%eax
+  8070ad:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8070b0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8070b3:	eb 0f                	jmp    8070c4 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8070b5:	0f b6 10             	movzbl (%eax),%edx
+  8070b8:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8070ba:	05 00 10 00 00       	add    $0x1000,%eax
+  8070bf:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8070c4:	39 c8                	cmp    %ecx,%eax
+  8070c6:	72 ed                	jb     8070b5 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  8070c8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8070cb:	8b 47 0c             	mov    0xc(%edi),%eax
+  8070ce:	a3 00 20 8a 00       	mov    %eax,0x8a2000
+	fsipcbuf.bulk.req_n = n;
+  8070d3:	89 1d 04 20 8a 00    	mov    %ebx,0x8a2004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8070d9:	89 15 08 20 8a 00    	mov    %edx,0x8a2008
+	return fsipc_pages(type, buf, n, perm);
+  8070df:	83 ec 0c             	sub    $0xc,%esp
+  8070e2:	6a 07                	push   $0x7
+  8070e4:	89 d9                	mov    %ebx,%ecx
+  8070e6:	89 f2                	mov    %esi,%edx
+  8070e8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8070ed:	e8 86 f9 ff ff       	call   806a78 <fsipc_pages>
+  8070f2:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  8070f4:	83 c4 10             	add    $0x10,%esp
+  8070f7:	eb 96                	jmp    80708f <file_read_direct+0x5f>
+	assert(r <= n);
+  8070f9:	68 33 96 80 00       	push   $0x809633
+  8070fe:	68 fd 89 80 00       	push   $0x8089fd
+  807103:	68 dc 00 00 00       	push   $0xdc
+  807108:	68 28 96 80 00       	push   $0x809628
+  80710d:	e8 01 e2 ff ff       	call   805313 <_panic>
+	assert(r <= PGSIZE);
+  807112:	68 44 96 80 00       	push   $0x809644
+  807117:	68 fd 89 80 00       	push   $0x8089fd
+  80711c:	68 dd 00 00 00       	push   $0xdd
+  807121:	68 28 96 80 00       	push   $0x809628
+  807126:	e8 e8 e1 ff ff       	call   805313 <_panic>
+
+0080712b <devfile_read>:
+{
+  80712b:	55                   	push   %ebp
+  80712c:	89 e5                	mov    %esp,%ebp
+  80712e:	57                   	push   %edi
+  80712f:	56                   	push   %esi
+  807130:	53                   	push   %ebx
+  807131:	83 ec 28             	sub    $0x28,%esp
+  807134:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  807137:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80713a:	53                   	push   %ebx
+  80713b:	e8 35 f3 ff ff       	call   806475 <fd2data>
+  807140:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  807143:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  807146:	83 c4 10             	add    $0x10,%esp
+  807149:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  80714d:	74 7d                	je     8071cc <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80714f:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  807153:	0f 85 81 00 00 00    	jne    8071da <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  807159:	8b 43 18             	mov    0x18(%ebx),%eax
+  80715c:	85 c0                	test   %eax,%eax
+  80715e:	74 0d                	je     80716d <devfile_read+0x42>
+  807160:	8b 53 14             	mov    0x14(%ebx),%edx
+  807163:	39 fa                	cmp    %edi,%edx
+  807165:	7f 06                	jg     80716d <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  807167:	01 c2                	add    %eax,%edx
+  807169:	39 d7                	cmp    %edx,%edi
+  80716b:	72 28                	jb     807195 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  80716d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  807174:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80717a:	77 74                	ja     8071f0 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  80717c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  807181:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  807184:	89 d8                	mov    %ebx,%eax
+  807186:	e8 a5 fe ff ff       	call   807030 <file_read_direct>
+  80718b:	85 c0                	test   %eax,%eax
+  80718d:	7e 35                	jle    8071c4 <devfile_read+0x99>
+		ff->buf_base = pos;
+  80718f:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  807192:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  807195:	8b 53 14             	mov    0x14(%ebx),%edx
+  807198:	89 d0                	mov    %edx,%eax
+  80719a:	03 43 18             	add    0x18(%ebx),%eax
+  80719d:	29 f8                	sub    %edi,%eax
+  80719f:	39 f0                	cmp    %esi,%eax
+  8071a1:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8071a4:	83 ec 04             	sub    $0x4,%esp
+  8071a7:	56                   	push   %esi
+  8071a8:	89 f8                	mov    %edi,%eax
+  8071aa:	29 d0                	sub    %edx,%eax
+  8071ac:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8071af:	01 c1                	add    %eax,%ecx
+  8071b1:	51                   	push   %ecx
+  8071b2:	ff 75 0c             	push   0xc(%ebp)
+  8071b5:	e8 a8 e9 ff ff       	call   805b62 <memmove>
+	fd->fd_offset = pos + n;
+  8071ba:	01 f7                	add    %esi,%edi
+  8071bc:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8071bf:	89 f0                	mov    %esi,%eax
+  8071c1:	83 c4 10             	add    $0x10,%esp
+}
+  8071c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8071c7:	5b                   	pop    %ebx
+  8071c8:	5e                   	pop    %esi
+  8071c9:	5f                   	pop    %edi
+  8071ca:	5d                   	pop    %ebp
+  8071cb:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  8071cc:	89 f1                	mov    %esi,%ecx
+  8071ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8071d1:	89 d8                	mov    %ebx,%eax
+  8071d3:	e8 58 fe ff ff       	call   807030 <file_read_direct>
+  8071d8:	eb ea                	jmp    8071c4 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8071da:	83 ec 0c             	sub    $0xc,%esp
+  8071dd:	53                   	push   %ebx
+  8071de:	e8 db fa ff ff       	call   806cbe <devfile_sync>
+  8071e3:	83 c4 10             	add    $0x10,%esp
+  8071e6:	85 c0                	test   %eax,%eax
+  8071e8:	0f 89 6b ff ff ff    	jns    807159 <devfile_read+0x2e>
+  8071ee:	eb d4                	jmp    8071c4 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  8071f0:	89 f1                	mov    %esi,%ecx
+  8071f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8071f5:	89 d8                	mov    %ebx,%eax
+  8071f7:	e8 34 fe ff ff       	call   807030 <file_read_direct>
+  8071fc:	eb c6                	jmp    8071c4 <devfile_read+0x99>
+
+008071fe <open>:
+{
+  8071fe:	55                   	push   %ebp
+  8071ff:	89 e5                	mov    %esp,%ebp
+  807201:	56                   	push   %esi
+  807202:	53                   	push   %ebx
+  807203:	83 ec 1c             	sub    $0x1c,%esp
+  807206:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  807209:	56                   	push   %esi
+  80720a:	e8 92 e7 ff ff       	call   8059a1 <strlen>
+  80720f:	83 c4 10             	add    $0x10,%esp
+  807212:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  807217:	0f 8f a0 00 00 00    	jg     8072bd <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  80721d:	83 ec 0c             	sub    $0xc,%esp
+  807220:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  807223:	50                   	push   %eax
+  807224:	e8 63 f2 ff ff       	call   80648c <fd_alloc>
+  807229:	89 c3                	mov    %eax,%ebx
+  80722b:	83 c4 10             	add    $0x10,%esp
+  80722e:	85 c0                	test   %eax,%eax
+  807230:	78 45                	js     807277 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  807232:	83 ec 08             	sub    $0x8,%esp
+  807235:	56                   	push   %esi
+  807236:	68 00 20 8a 00       	push   $0x8a2000
+  80723b:	e8 9c e7 ff ff       	call   8059dc <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  807240:	8b 45 0c             	mov    0xc(%ebp),%eax
+  807243:	a3 00 24 8a 00       	mov    %eax,0x8a2400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  807248:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80724b:	b8 01 00 00 00       	mov    $0x1,%eax
+  807250:	e8 c5 f9 ff ff       	call   806c1a <fsipc>
+  807255:	89 c3                	mov    %eax,%ebx
+  807257:	83 c4 10             	add    $0x10,%esp
+  80725a:	85 c0                	test   %eax,%eax
+  80725c:	78 22                	js     807280 <open+0x82>
+	if (!(mode & O_NOBUF)
+  80725e:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  807265:	74 2b                	je     807292 <open+0x94>
+	return fd2num(fd);
+  807267:	83 ec 0c             	sub    $0xc,%esp
+  80726a:	ff 75 f4             	push   -0xc(%ebp)
+  80726d:	e8 f3 f1 ff ff       	call   806465 <fd2num>
+  807272:	89 c3                	mov    %eax,%ebx
+  807274:	83 c4 10             	add    $0x10,%esp
+}
+  807277:	89 d8                	mov    %ebx,%eax
+  807279:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80727c:	5b                   	pop    %ebx
+  80727d:	5e                   	pop    %esi
+  80727e:	5d                   	pop    %ebp
+  80727f:	c3                   	ret
+		fd_close(fd, 0);
+  807280:	83 ec 08             	sub    $0x8,%esp
+  807283:	6a 00                	push   $0x0
+  807285:	ff 75 f4             	push   -0xc(%ebp)
+  807288:	e8 f8 f2 ff ff       	call   806585 <fd_close>
+		return r;
+  80728d:	83 c4 10             	add    $0x10,%esp
+  807290:	eb e5                	jmp    807277 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  807292:	83 ec 0c             	sub    $0xc,%esp
+  807295:	ff 75 f4             	push   -0xc(%ebp)
+  807298:	e8 d8 f1 ff ff       	call   806475 <fd2data>
+  80729d:	83 c4 0c             	add    $0xc,%esp
+  8072a0:	68 07 04 00 00       	push   $0x407
+  8072a5:	50                   	push   %eax
+  8072a6:	6a 00                	push   $0x0
+  8072a8:	e8 3b eb ff ff       	call   805de8 <sys_page_alloc>
+  8072ad:	83 c4 10             	add    $0x10,%esp
+  8072b0:	85 c0                	test   %eax,%eax
+  8072b2:	75 b3                	jne    807267 <open+0x69>
+		fd->fd_file.buffered = 1;
+  8072b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8072b7:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8072bb:	eb aa                	jmp    807267 <open+0x69>
+		return -E_BAD_PATH;
+  8072bd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8072c2:	eb b3                	jmp    807277 <open+0x79>
+
+008072c4 <readdir>:
+{
+  8072c4:	55                   	push   %ebp
+  8072c5:	89 e5                	mov    %esp,%ebp
+  8072c7:	53                   	push   %ebx
+  8072c8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8072cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8072ce:	50                   	push   %eax
+  8072cf:	ff 75 08             	push   0x8(%ebp)
+  8072d2:	e8 0b f2 ff ff       	call   8064e2 <fd_lookup>
+  8072d7:	89 c3                	mov    %eax,%ebx
+  8072d9:	83 c4 10             	add    $0x10,%esp
+  8072dc:	85 c0                	test   %eax,%eax
+  8072de:	78 73                	js     807353 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8072e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8072e3:	8b 0d a0 50 82 00    	mov    0x8250a0,%ecx
+  8072e9:	39 08                	cmp    %ecx,(%eax)
+  8072eb:	0f 85 82 00 00 00    	jne    807373 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  8072f1:	83 ec 0c             	sub    $0xc,%esp
+  8072f4:	50                   	push   %eax
+  8072f5:	e8 c4 f9 ff ff       	call   806cbe <devfile_sync>
+  8072fa:	89 c3                	mov    %eax,%ebx
+  8072fc:	83 c4 10             	add    $0x10,%esp
+  8072ff:	85 c0                	test   %eax,%eax
+  807301:	78 50                	js     807353 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  807303:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  807306:	8b 40 0c             	mov    0xc(%eax),%eax
+  807309:	a3 00 20 8a 00       	mov    %eax,0x8a2000
+	fsipcbuf.readdir.req_n = n;
+  80730e:	8b 45 10             	mov    0x10(%ebp),%eax
+  807311:	a3 04 20 8a 00       	mov    %eax,0x8a2004
+	fsipcbuf.readdir.req_flags = flags;
+  807316:	8b 45 14             	mov    0x14(%ebp),%eax
+  807319:	a3 08 20 8a 00       	mov    %eax,0x8a2008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  80731e:	ba 00 00 00 00       	mov    $0x0,%edx
+  807323:	b8 0e 00 00 00       	mov    $0xe,%eax
+  807328:	e8 ed f8 ff ff       	call   806c1a <fsipc>
+  80732d:	89 c3                	mov    %eax,%ebx
+  80732f:	85 c0                	test   %eax,%eax
+  807331:	7e 20                	jle    807353 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  807333:	39 45 10             	cmp    %eax,0x10(%ebp)
+  807336:	72 22                	jb     80735a <readdir+0x96>
+  807338:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80733d:	7f 1b                	jg     80735a <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80733f:	83 ec 04             	sub    $0x4,%esp
+  807342:	50                   	push   %eax
+  807343:	68 00 20 8a 00       	push   $0x8a2000
+  807348:	ff 75 0c             	push   0xc(%ebp)
+  80734b:	e8 12 e8 ff ff       	call   805b62 <memmove>
+	return r;
+  807350:	83 c4 10             	add    $0x10,%esp
+}
+  807353:	89 d8                	mov    %ebx,%eax
+  807355:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807358:	c9                   	leave
+  807359:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  80735a:	68 3a 96 80 00       	push   $0x80963a
+  80735f:	68 fd 89 80 00       	push   $0x8089fd
+  807364:	68 86 01 00 00       	push   $0x186
+  807369:	68 28 96 80 00       	push   $0x809628
+  80736e:	e8 a0 df ff ff       	call   805313 <_panic>
+		return -E_NOT_SUPP;
+  807373:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  807378:	eb d9                	jmp    807353 <readdir+0x8f>
+
+0080737a <munmap>:
+{
+  80737a:	55                   	push   %ebp
+  80737b:	89 e5                	mov    %esp,%ebp
+  80737d:	56                   	push   %esi
+  80737e:	53                   	push   %ebx
+  80737f:	8b 75 08             	mov    0x8(%ebp),%esi
+  807382:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  807385:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  80738b:	75 41                	jne    8073ce <munmap+0x54>
+  80738d:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  807393:	77 39                	ja     8073ce <munmap+0x54>
+  807395:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80739a:	29 f0                	sub    %esi,%eax
+  80739c:	39 d0                	cmp    %edx,%eax
+  80739e:	72 35                	jb     8073d5 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8073a0:	89 f3                	mov    %esi,%ebx
+  8073a2:	01 d6                	add    %edx,%esi
+  8073a4:	39 f3                	cmp    %esi,%ebx
+  8073a6:	73 1a                	jae    8073c2 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8073a8:	83 ec 08             	sub    $0x8,%esp
+  8073ab:	53                   	push   %ebx
+  8073ac:	6a 00                	push   $0x0
+  8073ae:	e8 c2 ea ff ff       	call   805e75 <sys_page_unmap>
+  8073b3:	83 c4 10             	add    $0x10,%esp
+  8073b6:	85 c0                	test   %eax,%eax
+  8073b8:	78 0d                	js     8073c7 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8073ba:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8073c0:	eb e2                	jmp    8073a4 <munmap+0x2a>
+	return 0;
+  8073c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8073c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8073ca:	5b                   	pop    %ebx
+  8073cb:	5e                   	pop    %esi
+  8073cc:	5d                   	pop    %ebp
+  8073cd:	c3                   	ret
+		return -E_INVAL;
+  8073ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8073d3:	eb f2                	jmp    8073c7 <munmap+0x4d>
+  8073d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8073da:	eb eb                	jmp    8073c7 <munmap+0x4d>
+
+008073dc <mmap>:
+{
+  8073dc:	55                   	push   %ebp
+  8073dd:	89 e5                	mov    %esp,%ebp
+  8073df:	57                   	push   %edi
+  8073e0:	56                   	push   %esi
+  8073e1:	53                   	push   %ebx
+  8073e2:	83 ec 34             	sub    $0x34,%esp
+  8073e5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8073e8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8073eb:	50                   	push   %eax
+  8073ec:	ff 75 18             	push   0x18(%ebp)
+  8073ef:	e8 ee f0 ff ff       	call   8064e2 <fd_lookup>
+  8073f4:	89 c3                	mov    %eax,%ebx
+  8073f6:	83 c4 10             	add    $0x10,%esp
+  8073f9:	85 c0                	test   %eax,%eax
+  8073fb:	0f 88 0e 01 00 00    	js     80750f <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  807401:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  807404:	a1 a0 50 82 00       	mov    0x8250a0,%eax
+  807409:	39 02                	cmp    %eax,(%edx)
+  80740b:	0f 85 50 01 00 00    	jne    807561 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  807411:	8b 45 10             	mov    0x10(%ebp),%eax
+  807414:	83 e0 02             	and    $0x2,%eax
+  807417:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80741a:	74 0a                	je     807426 <mmap+0x4a>
+  80741c:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  807420:	0f 84 42 01 00 00    	je     807568 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  807426:	8b 42 08             	mov    0x8(%edx),%eax
+  807429:	83 e0 03             	and    $0x3,%eax
+  80742c:	83 f8 01             	cmp    $0x1,%eax
+  80742f:	0f 84 3a 01 00 00    	je     80756f <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  807435:	8b 45 08             	mov    0x8(%ebp),%eax
+  807438:	0b 45 1c             	or     0x1c(%ebp),%eax
+  80743b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  807440:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  807443:	0f 85 2d 01 00 00    	jne    807576 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  807449:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80744d:	0f 88 2a 01 00 00    	js     80757d <mmap+0x1a1>
+  807453:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80745a:	0f 87 1d 01 00 00    	ja     80757d <mmap+0x1a1>
+  807460:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  807465:	2b 45 08             	sub    0x8(%ebp),%eax
+  807468:	39 f8                	cmp    %edi,%eax
+  80746a:	0f 82 14 01 00 00    	jb     807584 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  807470:	83 ec 0c             	sub    $0xc,%esp
+  807473:	52                   	push   %edx
+  807474:	e8 45 f8 ff ff       	call   806cbe <devfile_sync>
+  807479:	89 c3                	mov    %eax,%ebx
+  80747b:	83 c4 10             	add    $0x10,%esp
+  80747e:	85 c0                	test   %eax,%eax
+  807480:	0f 88 89 00 00 00    	js     80750f <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  807486:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  80748c:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  807492:	be 00 00 00 00       	mov    $0x0,%esi
+  807497:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  80749a:	39 fe                	cmp    %edi,%esi
+  80749c:	73 7b                	jae    807519 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  80749e:	89 f8                	mov    %edi,%eax
+  8074a0:	29 f0                	sub    %esi,%eax
+  8074a2:	c1 e8 0c             	shr    $0xc,%eax
+  8074a5:	ba 40 00 00 00       	mov    $0x40,%edx
+  8074aa:	39 d0                	cmp    %edx,%eax
+  8074ac:	0f 47 c2             	cmova  %edx,%eax
+  8074af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8074b2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8074b5:	8b 52 0c             	mov    0xc(%edx),%edx
+  8074b8:	89 15 00 20 8a 00    	mov    %edx,0x8a2000
+		fsipcbuf.map.req_offset = offset + done;
+  8074be:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8074c1:	89 15 04 20 8a 00    	mov    %edx,0x8a2004
+		fsipcbuf.map.req_npages = n;
+  8074c7:	a3 08 20 8a 00       	mov    %eax,0x8a2008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8074cc:	89 f2                	mov    %esi,%edx
+  8074ce:	03 55 08             	add    0x8(%ebp),%edx
+  8074d1:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8074d4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8074d9:	e8 ea f6 ff ff       	call   806bc8 <fsipcv>
+  8074de:	85 c0                	test   %eax,%eax
+  8074e0:	7e 12                	jle    8074f4 <mmap+0x118>
+  8074e2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8074e5:	85 c0                	test   %eax,%eax
+  8074e7:	0f 84 9e 00 00 00    	je     80758b <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8074ed:	c1 e0 0c             	shl    $0xc,%eax
+  8074f0:	01 c6                	add    %eax,%esi
+  8074f2:	eb a6                	jmp    80749a <mmap+0xbe>
+			munmap(addr, done);
+  8074f4:	89 c3                	mov    %eax,%ebx
+  8074f6:	83 ec 08             	sub    $0x8,%esp
+  8074f9:	56                   	push   %esi
+  8074fa:	ff 75 08             	push   0x8(%ebp)
+  8074fd:	e8 78 fe ff ff       	call   80737a <munmap>
+			return r < 0 ? r : -E_INVAL;
+  807502:	83 c4 10             	add    $0x10,%esp
+  807505:	85 db                	test   %ebx,%ebx
+  807507:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80750c:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80750f:	89 d8                	mov    %ebx,%eax
+  807511:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807514:	5b                   	pop    %ebx
+  807515:	5e                   	pop    %esi
+  807516:	5f                   	pop    %edi
+  807517:	5d                   	pop    %ebp
+  807518:	c3                   	ret
+	if (prot & PROT_WRITE)
+  807519:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80751c:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80751e:	85 c0                	test   %eax,%eax
+  807520:	74 ed                	je     80750f <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  807522:	be 00 00 00 00       	mov    $0x0,%esi
+  807527:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80752a:	39 fe                	cmp    %edi,%esi
+  80752c:	73 2e                	jae    80755c <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80752e:	83 ec 0c             	sub    $0xc,%esp
+  807531:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  807534:	50                   	push   %eax
+  807535:	e8 3f 10 00 00       	call   808579 <cowpage>
+  80753a:	83 c4 10             	add    $0x10,%esp
+  80753d:	85 c0                	test   %eax,%eax
+  80753f:	78 08                	js     807549 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  807541:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  807547:	eb e1                	jmp    80752a <mmap+0x14e>
+				munmap(addr, len);
+  807549:	89 c3                	mov    %eax,%ebx
+  80754b:	83 ec 08             	sub    $0x8,%esp
+  80754e:	57                   	push   %edi
+  80754f:	ff 75 08             	push   0x8(%ebp)
+  807552:	e8 23 fe ff ff       	call   80737a <munmap>
+				return r;
+  807557:	83 c4 10             	add    $0x10,%esp
+  80755a:	eb b3                	jmp    80750f <mmap+0x133>
+	return 0;
+  80755c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80755f:	eb ae                	jmp    80750f <mmap+0x133>
+		return -E_NOT_SUPP;
+  807561:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  807566:	eb a7                	jmp    80750f <mmap+0x133>
+		return -E_NOT_SUPP;
+  807568:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80756d:	eb a0                	jmp    80750f <mmap+0x133>
+		return -E_INVAL;
+  80756f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  807574:	eb 99                	jmp    80750f <mmap+0x133>
+  807576:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80757b:	eb 92                	jmp    80750f <mmap+0x133>
+  80757d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  807582:	eb 8b                	jmp    80750f <mmap+0x133>
+  807584:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  807589:	eb 84                	jmp    80750f <mmap+0x133>
+			munmap(addr, done);
+  80758b:	83 ec 08             	sub    $0x8,%esp
+  80758e:	56                   	push   %esi
+  80758f:	ff 75 08             	push   0x8(%ebp)
+  807592:	e8 e3 fd ff ff       	call   80737a <munmap>
+  807597:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  80759a:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80759f:	e9 6b ff ff ff       	jmp    80750f <mmap+0x133>
+
+008075a4 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8075a4:	55                   	push   %ebp
+  8075a5:	89 e5                	mov    %esp,%ebp
+  8075a7:	56                   	push   %esi
+  8075a8:	53                   	push   %ebx
+  8075a9:	83 ec 10             	sub    $0x10,%esp
+  8075ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8075af:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8075b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8075b5:	e8 3d f9 ff ff       	call   806ef7 <fsring_slot>
+  8075ba:	85 c0                	test   %eax,%eax
+  8075bc:	78 60                	js     80761e <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8075be:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8075c1:	8b 56 08             	mov    0x8(%esi),%edx
+  8075c4:	83 e2 03             	and    $0x3,%edx
+  8075c7:	83 fa 01             	cmp    $0x1,%edx
+  8075ca:	74 59                	je     807625 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8075cc:	ba 01 00 00 00       	mov    $0x1,%edx
+  8075d1:	89 c1                	mov    %eax,%ecx
+  8075d3:	d3 e2                	shl    %cl,%edx
+  8075d5:	09 15 c0 30 8a 00    	or     %edx,0x8a30c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8075db:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8075de:	c1 e2 02             	shl    $0x2,%edx
+  8075e1:	8d 8a 00 30 8a 00    	lea    0x8a3000(%edx),%ecx
+  8075e7:	c7 82 00 30 8a 00 03 	movl   $0x3,0x8a3000(%edx)
+  8075ee:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8075f1:	8b 55 18             	mov    0x18(%ebp),%edx
+  8075f4:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8075f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8075fa:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8075fd:	83 ec 08             	sub    $0x8,%esp
+  807600:	50                   	push   %eax
+  807601:	b8 00 10 00 00       	mov    $0x1000,%eax
+  807606:	39 c3                	cmp    %eax,%ebx
+  807608:	0f 47 d8             	cmova  %eax,%ebx
+  80760b:	53                   	push   %ebx
+  80760c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80760f:	89 f2                	mov    %esi,%edx
+  807611:	b8 03 00 00 00       	mov    $0x3,%eax
+  807616:	e8 1e f5 ff ff       	call   806b39 <fsring_post>
+  80761b:	83 c4 10             	add    $0x10,%esp
+}
+  80761e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807621:	5b                   	pop    %ebx
+  807622:	5e                   	pop    %esi
+  807623:	5d                   	pop    %ebp
+  807624:	c3                   	ret
+		return -E_INVAL;
+  807625:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80762a:	eb f2                	jmp    80761e <fsring_read+0x7a>
+
+0080762c <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80762c:	55                   	push   %ebp
+  80762d:	89 e5                	mov    %esp,%ebp
+  80762f:	56                   	push   %esi
+  807630:	53                   	push   %ebx
+  807631:	83 ec 10             	sub    $0x10,%esp
+  807634:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  807637:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80763a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80763d:	e8 b5 f8 ff ff       	call   806ef7 <fsring_slot>
+  807642:	89 c3                	mov    %eax,%ebx
+  807644:	85 c0                	test   %eax,%eax
+  807646:	78 77                	js     8076bf <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  807648:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80764b:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80764f:	74 77                	je     8076c8 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  807651:	b8 00 10 00 00       	mov    $0x1000,%eax
+  807656:	39 c6                	cmp    %eax,%esi
+  807658:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80765b:	83 ec 04             	sub    $0x4,%esp
+  80765e:	56                   	push   %esi
+  80765f:	ff 75 0c             	push   0xc(%ebp)
+  807662:	89 d8                	mov    %ebx,%eax
+  807664:	c1 e0 0c             	shl    $0xc,%eax
+  807667:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80766d:	50                   	push   %eax
+  80766e:	e8 ef e4 ff ff       	call   805b62 <memmove>
+	fsring_busy |= 1 << slot;
+  807673:	b8 01 00 00 00       	mov    $0x1,%eax
+  807678:	89 d9                	mov    %ebx,%ecx
+  80767a:	d3 e0                	shl    %cl,%eax
+  80767c:	09 05 c0 30 8a 00    	or     %eax,0x8a30c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  807682:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  807685:	c1 e0 02             	shl    $0x2,%eax
+  807688:	8d 90 00 30 8a 00    	lea    0x8a3000(%eax),%edx
+  80768e:	c7 80 00 30 8a 00 04 	movl   $0x4,0x8a3000(%eax)
+  807695:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  807698:	8b 45 18             	mov    0x18(%ebp),%eax
+  80769b:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80769e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8076a5:	83 c4 08             	add    $0x8,%esp
+  8076a8:	53                   	push   %ebx
+  8076a9:	56                   	push   %esi
+  8076aa:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8076ad:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8076b0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8076b5:	e8 7f f4 ff ff       	call   806b39 <fsring_post>
+  8076ba:	89 c3                	mov    %eax,%ebx
+  8076bc:	83 c4 10             	add    $0x10,%esp
+}
+  8076bf:	89 d8                	mov    %ebx,%eax
+  8076c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8076c4:	5b                   	pop    %ebx
+  8076c5:	5e                   	pop    %esi
+  8076c6:	5d                   	pop    %ebp
+  8076c7:	c3                   	ret
+		return -E_INVAL;
+  8076c8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8076cd:	eb f0                	jmp    8076bf <fsring_write+0x93>
+
+008076cf <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8076cf:	55                   	push   %ebp
+  8076d0:	89 e5                	mov    %esp,%ebp
+  8076d2:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8076d5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8076d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8076db:	e8 17 f8 ff ff       	call   806ef7 <fsring_slot>
+  8076e0:	85 c0                	test   %eax,%eax
+  8076e2:	78 4c                	js     807730 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8076e4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8076e9:	89 c1                	mov    %eax,%ecx
+  8076eb:	d3 e2                	shl    %cl,%edx
+  8076ed:	09 15 c0 30 8a 00    	or     %edx,0x8a30c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8076f3:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8076f6:	c1 e2 02             	shl    $0x2,%edx
+  8076f9:	8d 8a 00 30 8a 00    	lea    0x8a3000(%edx),%ecx
+  8076ff:	c7 82 00 30 8a 00 05 	movl   $0x5,0x8a3000(%edx)
+  807706:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  807709:	8b 55 10             	mov    0x10(%ebp),%edx
+  80770c:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80770f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  807712:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  807715:	83 ec 08             	sub    $0x8,%esp
+  807718:	50                   	push   %eax
+  807719:	6a 00                	push   $0x0
+  80771b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807720:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  807723:	b8 05 00 00 00       	mov    $0x5,%eax
+  807728:	e8 0c f4 ff ff       	call   806b39 <fsring_post>
+  80772d:	83 c4 10             	add    $0x10,%esp
+}
+  807730:	c9                   	leave
+  807731:	c3                   	ret
+
+00807732 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  807732:	55                   	push   %ebp
+  807733:	89 e5                	mov    %esp,%ebp
+  807735:	57                   	push   %edi
+  807736:	56                   	push   %esi
+  807737:	53                   	push   %ebx
+  807738:	83 ec 1c             	sub    $0x1c,%esp
+  80773b:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80773f:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  807744:	8b 40 48             	mov    0x48(%eax),%eax
+  807747:	3b 05 c4 30 8a 00    	cmp    0x8a30c4,%eax
+  80774d:	74 12                	je     807761 <fsring_reap+0x2f>
+		return 0;
+  80774f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  807754:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807757:	5b                   	pop    %ebx
+  807758:	5e                   	pop    %esi
+  807759:	5f                   	pop    %edi
+  80775a:	5d                   	pop    %ebp
+  80775b:	c3                   	ret
+		sys_yield();
+  80775c:	e8 68 e6 ff ff       	call   805dc9 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  807761:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  807767:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80776c:	39 c2                	cmp    %eax,%edx
+  80776e:	75 18                	jne    807788 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  807770:	84 db                	test   %bl,%bl
+  807772:	0f 84 21 01 00 00    	je     807899 <fsring_reap+0x167>
+  807778:	83 3d c0 30 8a 00 00 	cmpl   $0x0,0x8a30c0
+  80777f:	75 db                	jne    80775c <fsring_reap+0x2a>
+			return 0;
+  807781:	b8 00 00 00 00       	mov    $0x0,%eax
+  807786:	eb cc                	jmp    807754 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  807788:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80778d:	83 e0 0f             	and    $0xf,%eax
+  807790:	83 c0 2a             	add    $0x2a,%eax
+  807793:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  80779a:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8077a1:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8077a6:	83 c0 01             	add    $0x1,%eax
+  8077a9:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8077ae:	83 fb 0f             	cmp    $0xf,%ebx
+  8077b1:	77 5b                	ja     80780e <fsring_reap+0xdc>
+  8077b3:	be 01 00 00 00       	mov    $0x1,%esi
+  8077b8:	89 d9                	mov    %ebx,%ecx
+  8077ba:	d3 e6                	shl    %cl,%esi
+  8077bc:	89 f0                	mov    %esi,%eax
+  8077be:	23 05 c0 30 8a 00    	and    0x8a30c0,%eax
+  8077c4:	74 48                	je     80780e <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8077c6:	89 d8                	mov    %ebx,%eax
+  8077c8:	c1 e0 0c             	shl    $0xc,%eax
+  8077cb:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8077d1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8077d4:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8077d7:	8b 04 85 00 30 8a 00 	mov    0x8a3000(,%eax,4),%eax
+  8077de:	83 f8 03             	cmp    $0x3,%eax
+  8077e1:	74 40                	je     807823 <fsring_reap+0xf1>
+  8077e3:	83 f8 05             	cmp    $0x5,%eax
+  8077e6:	74 64                	je     80784c <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8077e8:	f7 d6                	not    %esi
+  8077ea:	21 35 c0 30 8a 00    	and    %esi,0x8a30c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8077f0:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8077f3:	8b 14 85 04 30 8a 00 	mov    0x8a3004(,%eax,4),%edx
+  8077fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8077fd:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8077ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  807802:	89 38                	mov    %edi,(%eax)
+	return 1;
+  807804:	b8 01 00 00 00       	mov    $0x1,%eax
+  807809:	e9 46 ff ff ff       	jmp    807754 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80780e:	53                   	push   %ebx
+  80780f:	68 50 96 80 00       	push   $0x809650
+  807814:	68 8f 02 00 00       	push   $0x28f
+  807819:	68 28 96 80 00       	push   $0x809628
+  80781e:	e8 f0 da ff ff       	call   805313 <_panic>
+		if (cqe.cqe_result > 0)
+  807823:	85 ff                	test   %edi,%edi
+  807825:	7e c1                	jle    8077e8 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  807827:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80782a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80782f:	39 c7                	cmp    %eax,%edi
+  807831:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  807834:	50                   	push   %eax
+  807835:	ff 75 e4             	push   -0x1c(%ebp)
+  807838:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80783b:	ff 34 85 08 30 8a 00 	push   0x8a3008(,%eax,4)
+  807842:	e8 1b e3 ff ff       	call   805b62 <memmove>
+  807847:	83 c4 10             	add    $0x10,%esp
+  80784a:	eb 9c                	jmp    8077e8 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80784c:	85 ff                	test   %edi,%edi
+  80784e:	75 98                	jne    8077e8 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  807850:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  807853:	8b 0c 85 08 30 8a 00 	mov    0x8a3008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80785a:	83 ec 08             	sub    $0x8,%esp
+  80785d:	ff 75 e4             	push   -0x1c(%ebp)
+  807860:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  807863:	51                   	push   %ecx
+  807864:	e8 73 e1 ff ff       	call   8059dc <strcpy>
+			st->st_size = ret->ret_size;
+  807869:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80786c:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  807872:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  807875:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80787b:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  807881:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  807887:	c7 81 88 00 00 00 a0 	movl   $0x8250a0,0x88(%ecx)
+  80788e:	50 82 00 
+  807891:	83 c4 10             	add    $0x10,%esp
+  807894:	e9 4f ff ff ff       	jmp    8077e8 <fsring_reap+0xb6>
+			return 0;
+  807899:	b8 00 00 00 00       	mov    $0x0,%eax
+  80789e:	e9 b1 fe ff ff       	jmp    807754 <fsring_reap+0x22>
+
+008078a3 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8078a3:	55                   	push   %ebp
+  8078a4:	89 e5                	mov    %esp,%ebp
+  8078a6:	57                   	push   %edi
+  8078a7:	56                   	push   %esi
+  8078a8:	53                   	push   %ebx
+  8078a9:	83 ec 28             	sub    $0x28,%esp
+  8078ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8078af:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8078b2:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8078b5:	53                   	push   %ebx
+  8078b6:	e8 e6 e0 ff ff       	call   8059a1 <strlen>
+  8078bb:	83 c4 10             	add    $0x10,%esp
+  8078be:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8078c3:	0f 8f 02 01 00 00    	jg     8079cb <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8078c9:	83 ec 08             	sub    $0x8,%esp
+  8078cc:	53                   	push   %ebx
+  8078cd:	68 00 20 8a 00       	push   $0x8a2000
+  8078d2:	e8 05 e1 ff ff       	call   8059dc <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8078d7:	83 c4 10             	add    $0x10,%esp
+  8078da:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8078e0:	76 69                	jbe    80794b <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8078e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8078e5:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8078eb:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8078f0:	29 d1                	sub    %edx,%ecx
+  8078f2:	39 f9                	cmp    %edi,%ecx
+  8078f4:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8078f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8078fa:	89 f9                	mov    %edi,%ecx
+  8078fc:	01 c1                	add    %eax,%ecx
+  8078fe:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  807901:	eb 0f                	jmp    807912 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  807903:	0f b6 10             	movzbl (%eax),%edx
+  807906:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  807908:	05 00 10 00 00       	add    $0x1000,%eax
+  80790d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  807912:	39 c8                	cmp    %ecx,%eax
+  807914:	72 ed                	jb     807903 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  807916:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  807919:	89 3d 00 24 8a 00    	mov    %edi,0x8a2400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  80791f:	89 15 04 24 8a 00    	mov    %edx,0x8a2404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  807925:	83 ec 0c             	sub    $0xc,%esp
+  807928:	6a 07                	push   $0x7
+  80792a:	89 f9                	mov    %edi,%ecx
+  80792c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80792f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  807934:	e8 3f f1 ff ff       	call   806a78 <fsipc_pages>
+  807939:	89 c7                	mov    %eax,%edi
+  80793b:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  80793e:	85 f6                	test   %esi,%esi
+  807940:	74 7f                	je     8079c1 <file_slurp+0x11e>
+  807942:	8d 43 01             	lea    0x1(%ebx),%eax
+  807945:	85 ff                	test   %edi,%edi
+  807947:	79 3c                	jns    807985 <file_slurp+0xe2>
+  807949:	eb 76                	jmp    8079c1 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  80794b:	89 3d 00 24 8a 00    	mov    %edi,0x8a2400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  807951:	ba 00 00 00 00       	mov    $0x0,%edx
+  807956:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80795b:	e8 ba f2 ff ff       	call   806c1a <fsipc>
+  807960:	89 c7                	mov    %eax,%edi
+  807962:	85 c0                	test   %eax,%eax
+  807964:	7e d8                	jle    80793e <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  807966:	83 ec 04             	sub    $0x4,%esp
+  807969:	50                   	push   %eax
+  80796a:	68 08 20 8a 00       	push   $0x8a2008
+  80796f:	ff 75 0c             	push   0xc(%ebp)
+  807972:	e8 eb e1 ff ff       	call   805b62 <memmove>
+  807977:	83 c4 10             	add    $0x10,%esp
+  80797a:	eb c2                	jmp    80793e <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  80797c:	80 fa 2f             	cmp    $0x2f,%dl
+  80797f:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  807982:	83 c0 01             	add    $0x1,%eax
+  807985:	89 c1                	mov    %eax,%ecx
+  807987:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  80798b:	84 d2                	test   %dl,%dl
+  80798d:	75 ed                	jne    80797c <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  80798f:	83 ec 04             	sub    $0x4,%esp
+  807992:	68 80 00 00 00       	push   $0x80
+  807997:	53                   	push   %ebx
+  807998:	56                   	push   %esi
+  807999:	e8 b4 e0 ff ff       	call   805a52 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  80799e:	a1 00 20 8a 00       	mov    0x8a2000,%eax
+  8079a3:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8079a9:	a1 04 20 8a 00       	mov    0x8a2004,%eax
+  8079ae:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8079b4:	c7 86 88 00 00 00 a0 	movl   $0x8250a0,0x88(%esi)
+  8079bb:	50 82 00 
+  8079be:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8079c1:	89 f8                	mov    %edi,%eax
+  8079c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8079c6:	5b                   	pop    %ebx
+  8079c7:	5e                   	pop    %esi
+  8079c8:	5f                   	pop    %edi
+  8079c9:	5d                   	pop    %ebp
+  8079ca:	c3                   	ret
+		return -E_BAD_PATH;
+  8079cb:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8079d0:	eb ef                	jmp    8079c1 <file_slurp+0x11e>
+
+008079d2 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8079d2:	55                   	push   %ebp
+  8079d3:	89 e5                	mov    %esp,%ebp
+  8079d5:	53                   	push   %ebx
+  8079d6:	83 ec 10             	sub    $0x10,%esp
+  8079d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8079dc:	53                   	push   %ebx
+  8079dd:	e8 bf df ff ff       	call   8059a1 <strlen>
+  8079e2:	83 c4 10             	add    $0x10,%esp
+  8079e5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8079ea:	7f 25                	jg     807a11 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8079ec:	83 ec 08             	sub    $0x8,%esp
+  8079ef:	53                   	push   %ebx
+  8079f0:	68 00 20 8a 00       	push   $0x8a2000
+  8079f5:	e8 e2 df ff ff       	call   8059dc <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8079fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8079ff:	b8 07 00 00 00       	mov    $0x7,%eax
+  807a04:	e8 11 f2 ff ff       	call   806c1a <fsipc>
+  807a09:	83 c4 10             	add    $0x10,%esp
+}
+  807a0c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807a0f:	c9                   	leave
+  807a10:	c3                   	ret
+		return -E_BAD_PATH;
+  807a11:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  807a16:	eb f4                	jmp    807a0c <remove+0x3a>
+
+00807a18 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  807a18:	55                   	push   %ebp
+  807a19:	89 e5                	mov    %esp,%ebp
+  807a1b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  807a1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  807a23:	b8 08 00 00 00       	mov    $0x8,%eax
+  807a28:	e8 ed f1 ff ff       	call   806c1a <fsipc>
+}
+  807a2d:	c9                   	leave
+  807a2e:	c3                   	ret
+
+00807a2f <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  807a2f:	55                   	push   %ebp
+  807a30:	89 e5                	mov    %esp,%ebp
+  807a32:	57                   	push   %edi
+  807a33:	56                   	push   %esi
+  807a34:	53                   	push   %ebx
+  807a35:	83 ec 18             	sub    $0x18,%esp
+  807a38:	8b 7d 08             	mov    0x8(%ebp),%edi
+  807a3b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  807a3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  807a41:	57                   	push   %edi
+  807a42:	e8 5a df ff ff       	call   8059a1 <strlen>
+  807a47:	83 c4 10             	add    $0x10,%esp
+  807a4a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  807a4f:	7f 4c                	jg     807a9d <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  807a51:	83 ec 08             	sub    $0x8,%esp
+  807a54:	57                   	push   %edi
+  807a55:	68 00 20 8a 00       	push   $0x8a2000
+  807a5a:	e8 7d df ff ff       	call   8059dc <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  807a5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  807a64:	b8 10 00 00 00       	mov    $0x10,%eax
+  807a69:	e8 ac f1 ff ff       	call   806c1a <fsipc>
+  807a6e:	83 c4 10             	add    $0x10,%esp
+  807a71:	85 c0                	test   %eax,%eax
+  807a73:	78 20                	js     807a95 <defrag+0x66>
+		return r;
+	if (before)
+  807a75:	85 f6                	test   %esi,%esi
+  807a77:	74 07                	je     807a80 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  807a79:	a1 00 20 8a 00       	mov    0x8a2000,%eax
+  807a7e:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  807a80:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  807a85:	85 db                	test   %ebx,%ebx
+  807a87:	74 0c                	je     807a95 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  807a89:	a1 04 20 8a 00       	mov    0x8a2004,%eax
+  807a8e:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  807a90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807a95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807a98:	5b                   	pop    %ebx
+  807a99:	5e                   	pop    %esi
+  807a9a:	5f                   	pop    %edi
+  807a9b:	5d                   	pop    %ebp
+  807a9c:	c3                   	ret
+		return -E_BAD_PATH;
+  807a9d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  807aa2:	eb f1                	jmp    807a95 <defrag+0x66>
+
+00807aa4 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  807aa4:	55                   	push   %ebp
+  807aa5:	89 e5                	mov    %esp,%ebp
+  807aa7:	53                   	push   %ebx
+  807aa8:	83 ec 04             	sub    $0x4,%esp
+  807aab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  807aae:	ba 00 00 00 00       	mov    $0x0,%edx
+  807ab3:	b8 11 00 00 00       	mov    $0x11,%eax
+  807ab8:	e8 5d f1 ff ff       	call   806c1a <fsipc>
+  807abd:	85 c0                	test   %eax,%eax
+  807abf:	78 34                	js     807af5 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  807ac1:	a1 00 20 8a 00       	mov    0x8a2000,%eax
+  807ac6:	89 03                	mov    %eax,(%ebx)
+  807ac8:	a1 04 20 8a 00       	mov    0x8a2004,%eax
+  807acd:	89 43 04             	mov    %eax,0x4(%ebx)
+  807ad0:	a1 08 20 8a 00       	mov    0x8a2008,%eax
+  807ad5:	89 43 08             	mov    %eax,0x8(%ebx)
+  807ad8:	a1 0c 20 8a 00       	mov    0x8a200c,%eax
+  807add:	89 43 0c             	mov    %eax,0xc(%ebx)
+  807ae0:	a1 10 20 8a 00       	mov    0x8a2010,%eax
+  807ae5:	89 43 10             	mov    %eax,0x10(%ebx)
+  807ae8:	a1 14 20 8a 00       	mov    0x8a2014,%eax
+  807aed:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  807af0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807af5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807af8:	c9                   	leave
+  807af9:	c3                   	ret
+
+00807afa <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  807afa:	55                   	push   %ebp
+  807afb:	89 e5                	mov    %esp,%ebp
+  807afd:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  807b00:	89 c2                	mov    %eax,%edx
+  807b02:	c1 ea 16             	shr    $0x16,%edx
+  807b05:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  807b0c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  807b11:	f6 c1 01             	test   $0x1,%cl
+  807b14:	74 22                	je     807b38 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  807b16:	c1 e8 0c             	shr    $0xc,%eax
+  807b19:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  807b20:	a8 01                	test   $0x1,%al
+  807b22:	74 14                	je     807b38 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  807b24:	c1 e8 0c             	shr    $0xc,%eax
+  807b27:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  807b2a:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  807b31:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  807b35:	0f b7 d2             	movzwl %dx,%edx
+}
+  807b38:	89 d0                	mov    %edx,%eax
+  807b3a:	5d                   	pop    %ebp
+  807b3b:	c3                   	ret
+
+00807b3c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  807b3c:	55                   	push   %ebp
+  807b3d:	89 e5                	mov    %esp,%ebp
+  807b3f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  807b42:	68 69 96 80 00       	push   $0x809669
+  807b47:	ff 75 0c             	push   0xc(%ebp)
+  807b4a:	e8 8d de ff ff       	call   8059dc <strcpy>
+	return 0;
+}
+  807b4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  807b54:	c9                   	leave
+  807b55:	c3                   	ret
+
+00807b56 <devsock_close>:
+{
+  807b56:	55                   	push   %ebp
+  807b57:	89 e5                	mov    %esp,%ebp
+  807b59:	53                   	push   %ebx
+  807b5a:	83 ec 10             	sub    $0x10,%esp
+  807b5d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  807b60:	53                   	push   %ebx
+  807b61:	e8 94 ff ff ff       	call   807afa <pageref>
+  807b66:	89 c2                	mov    %eax,%edx
+  807b68:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  807b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  807b70:	83 fa 01             	cmp    $0x1,%edx
+  807b73:	74 05                	je     807b7a <devsock_close+0x24>
+}
+  807b75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807b78:	c9                   	leave
+  807b79:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  807b7a:	83 ec 0c             	sub    $0xc,%esp
+  807b7d:	ff 73 0c             	push   0xc(%ebx)
+  807b80:	e8 b7 02 00 00       	call   807e3c <nsipc_close>
+  807b85:	83 c4 10             	add    $0x10,%esp
+  807b88:	eb eb                	jmp    807b75 <devsock_close+0x1f>
+
+00807b8a <devsock_write>:
+{
+  807b8a:	55                   	push   %ebp
+  807b8b:	89 e5                	mov    %esp,%ebp
+  807b8d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  807b90:	6a 00                	push   $0x0
+  807b92:	ff 75 10             	push   0x10(%ebp)
+  807b95:	ff 75 0c             	push   0xc(%ebp)
+  807b98:	8b 45 08             	mov    0x8(%ebp),%eax
+  807b9b:	ff 70 0c             	push   0xc(%eax)
+  807b9e:	e8 79 03 00 00       	call   807f1c <nsipc_send>
+}
+  807ba3:	c9                   	leave
+  807ba4:	c3                   	ret
+
+00807ba5 <devsock_read>:
+{
+  807ba5:	55                   	push   %ebp
+  807ba6:	89 e5                	mov    %esp,%ebp
+  807ba8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  807bab:	6a 00                	push   $0x0
+  807bad:	ff 75 10             	push   0x10(%ebp)
+  807bb0:	ff 75 0c             	push   0xc(%ebp)
+  807bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  807bb6:	ff 70 0c             	push   0xc(%eax)
+  807bb9:	e8 ef 02 00 00       	call   807ead <nsipc_recv>
+}
+  807bbe:	c9                   	leave
+  807bbf:	c3                   	ret
+
+00807bc0 <fd2sockid>:
+{
+  807bc0:	55                   	push   %ebp
+  807bc1:	89 e5                	mov    %esp,%ebp
+  807bc3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  807bc6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  807bc9:	52                   	push   %edx
+  807bca:	50                   	push   %eax
+  807bcb:	e8 12 e9 ff ff       	call   8064e2 <fd_lookup>
+  807bd0:	83 c4 10             	add    $0x10,%esp
+  807bd3:	85 c0                	test   %eax,%eax
+  807bd5:	78 10                	js     807be7 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  807bd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  807bda:	8b 0d c0 50 82 00    	mov    0x8250c0,%ecx
+  807be0:	39 08                	cmp    %ecx,(%eax)
+  807be2:	75 05                	jne    807be9 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  807be4:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  807be7:	c9                   	leave
+  807be8:	c3                   	ret
+		return -E_NOT_SUPP;
+  807be9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  807bee:	eb f7                	jmp    807be7 <fd2sockid+0x27>
+
+00807bf0 <alloc_sockfd>:
+{
+  807bf0:	55                   	push   %ebp
+  807bf1:	89 e5                	mov    %esp,%ebp
+  807bf3:	56                   	push   %esi
+  807bf4:	53                   	push   %ebx
+  807bf5:	83 ec 1c             	sub    $0x1c,%esp
+  807bf8:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  807bfa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  807bfd:	50                   	push   %eax
+  807bfe:	e8 89 e8 ff ff       	call   80648c <fd_alloc>
+  807c03:	89 c3                	mov    %eax,%ebx
+  807c05:	83 c4 10             	add    $0x10,%esp
+  807c08:	85 c0                	test   %eax,%eax
+  807c0a:	78 43                	js     807c4f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  807c0c:	83 ec 04             	sub    $0x4,%esp
+  807c0f:	68 07 04 00 00       	push   $0x407
+  807c14:	ff 75 f4             	push   -0xc(%ebp)
+  807c17:	6a 00                	push   $0x0
+  807c19:	e8 ca e1 ff ff       	call   805de8 <sys_page_alloc>
+  807c1e:	89 c3                	mov    %eax,%ebx
+  807c20:	83 c4 10             	add    $0x10,%esp
+  807c23:	85 c0                	test   %eax,%eax
+  807c25:	78 28                	js     807c4f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  807c27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  807c2a:	8b 15 c0 50 82 00    	mov    0x8250c0,%edx
+  807c30:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  807c32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  807c35:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  807c3c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  807c3f:	83 ec 0c             	sub    $0xc,%esp
+  807c42:	50                   	push   %eax
+  807c43:	e8 1d e8 ff ff       	call   806465 <fd2num>
+  807c48:	89 c3                	mov    %eax,%ebx
+  807c4a:	83 c4 10             	add    $0x10,%esp
+  807c4d:	eb 0c                	jmp    807c5b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  807c4f:	83 ec 0c             	sub    $0xc,%esp
+  807c52:	56                   	push   %esi
+  807c53:	e8 e4 01 00 00       	call   807e3c <nsipc_close>
+		return r;
+  807c58:	83 c4 10             	add    $0x10,%esp
+}
+  807c5b:	89 d8                	mov    %ebx,%eax
+  807c5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807c60:	5b                   	pop    %ebx
+  807c61:	5e                   	pop    %esi
+  807c62:	5d                   	pop    %ebp
+  807c63:	c3                   	ret
+
+00807c64 <accept>:
+{
+  807c64:	55                   	push   %ebp
+  807c65:	89 e5                	mov    %esp,%ebp
+  807c67:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  807c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  807c6d:	e8 4e ff ff ff       	call   807bc0 <fd2sockid>
+  807c72:	85 c0                	test   %eax,%eax
+  807c74:	78 1b                	js     807c91 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  807c76:	83 ec 04             	sub    $0x4,%esp
+  807c79:	ff 75 10             	push   0x10(%ebp)
+  807c7c:	ff 75 0c             	push   0xc(%ebp)
+  807c7f:	50                   	push   %eax
+  807c80:	e8 0e 01 00 00       	call   807d93 <nsipc_accept>
+  807c85:	83 c4 10             	add    $0x10,%esp
+  807c88:	85 c0                	test   %eax,%eax
+  807c8a:	78 05                	js     807c91 <accept+0x2d>
+	return alloc_sockfd(r);
+  807c8c:	e8 5f ff ff ff       	call   807bf0 <alloc_sockfd>
+}
+  807c91:	c9                   	leave
+  807c92:	c3                   	ret
+
+00807c93 <bind>:
+{
+  807c93:	55                   	push   %ebp
+  807c94:	89 e5                	mov    %esp,%ebp
+  807c96:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  807c99:	8b 45 08             	mov    0x8(%ebp),%eax
+  807c9c:	e8 1f ff ff ff       	call   807bc0 <fd2sockid>
+  807ca1:	85 c0                	test   %eax,%eax
+  807ca3:	78 12                	js     807cb7 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  807ca5:	83 ec 04             	sub    $0x4,%esp
+  807ca8:	ff 75 10             	push   0x10(%ebp)
+  807cab:	ff 75 0c             	push   0xc(%ebp)
+  807cae:	50                   	push   %eax
+  807caf:	e8 31 01 00 00       	call   807de5 <nsipc_bind>
+  807cb4:	83 c4 10             	add    $0x10,%esp
+}
+  807cb7:	c9                   	leave
+  807cb8:	c3                   	ret
+
+00807cb9 <shutdown>:
+{
+  807cb9:	55                   	push   %ebp
+  807cba:	89 e5                	mov    %esp,%ebp
+  807cbc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  807cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  807cc2:	e8 f9 fe ff ff       	call   807bc0 <fd2sockid>
+  807cc7:	85 c0                	test   %eax,%eax
+  807cc9:	78 0f                	js     807cda <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  807ccb:	83 ec 08             	sub    $0x8,%esp
+  807cce:	ff 75 0c             	push   0xc(%ebp)
+  807cd1:	50                   	push   %eax
+  807cd2:	e8 43 01 00 00       	call   807e1a <nsipc_shutdown>
+  807cd7:	83 c4 10             	add    $0x10,%esp
+}
+  807cda:	c9                   	leave
+  807cdb:	c3                   	ret
+
+00807cdc <connect>:
+{
+  807cdc:	55                   	push   %ebp
+  807cdd:	89 e5                	mov    %esp,%ebp
+  807cdf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  807ce2:	8b 45 08             	mov    0x8(%ebp),%eax
+  807ce5:	e8 d6 fe ff ff       	call   807bc0 <fd2sockid>
+  807cea:	85 c0                	test   %eax,%eax
+  807cec:	78 12                	js     807d00 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  807cee:	83 ec 04             	sub    $0x4,%esp
+  807cf1:	ff 75 10             	push   0x10(%ebp)
+  807cf4:	ff 75 0c             	push   0xc(%ebp)
+  807cf7:	50                   	push   %eax
+  807cf8:	e8 59 01 00 00       	call   807e56 <nsipc_connect>
+  807cfd:	83 c4 10             	add    $0x10,%esp
+}
+  807d00:	c9                   	leave
+  807d01:	c3                   	ret
+
+00807d02 <listen>:
+{
+  807d02:	55                   	push   %ebp
+  807d03:	89 e5                	mov    %esp,%ebp
+  807d05:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  807d08:	8b 45 08             	mov    0x8(%ebp),%eax
+  807d0b:	e8 b0 fe ff ff       	call   807bc0 <fd2sockid>
+  807d10:	85 c0                	test   %eax,%eax
+  807d12:	78 0f                	js     807d23 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  807d14:	83 ec 08             	sub    $0x8,%esp
+  807d17:	ff 75 0c             	push   0xc(%ebp)
+  807d1a:	50                   	push   %eax
+  807d1b:	e8 6b 01 00 00       	call   807e8b <nsipc_listen>
+  807d20:	83 c4 10             	add    $0x10,%esp
+}
+  807d23:	c9                   	leave
+  807d24:	c3                   	ret
+
+00807d25 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  807d25:	55                   	push   %ebp
+  807d26:	89 e5                	mov    %esp,%ebp
+  807d28:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  807d2b:	ff 75 10             	push   0x10(%ebp)
+  807d2e:	ff 75 0c             	push   0xc(%ebp)
+  807d31:	ff 75 08             	push   0x8(%ebp)
+  807d34:	e8 41 02 00 00       	call   807f7a <nsipc_socket>
+  807d39:	83 c4 10             	add    $0x10,%esp
+  807d3c:	85 c0                	test   %eax,%eax
+  807d3e:	78 05                	js     807d45 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  807d40:	e8 ab fe ff ff       	call   807bf0 <alloc_sockfd>
+}
+  807d45:	c9                   	leave
+  807d46:	c3                   	ret
+
+00807d47 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  807d47:	55                   	push   %ebp
+  807d48:	89 e5                	mov    %esp,%ebp
+  807d4a:	53                   	push   %ebx
+  807d4b:	83 ec 04             	sub    $0x4,%esp
+  807d4e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  807d50:	83 3d 00 50 8a 00 00 	cmpl   $0x0,0x8a5000
+  807d57:	74 26                	je     807d7f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  807d59:	6a 07                	push   $0x7
+  807d5b:	68 00 40 8a 00       	push   $0x8a4000
+  807d60:	53                   	push   %ebx
+  807d61:	ff 35 00 50 8a 00    	push   0x8a5000
+  807d67:	e8 81 e5 ff ff       	call   8062ed <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  807d6c:	83 c4 0c             	add    $0xc,%esp
+  807d6f:	6a 00                	push   $0x0
+  807d71:	6a 00                	push   $0x0
+  807d73:	6a 00                	push   $0x0
+  807d75:	e8 08 e5 ff ff       	call   806282 <ipc_recv>
+}
+  807d7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807d7d:	c9                   	leave
+  807d7e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  807d7f:	83 ec 0c             	sub    $0xc,%esp
+  807d82:	6a 02                	push   $0x2
+  807d84:	e8 9d e6 ff ff       	call   806426 <ipc_find_env>
+  807d89:	a3 00 50 8a 00       	mov    %eax,0x8a5000
+  807d8e:	83 c4 10             	add    $0x10,%esp
+  807d91:	eb c6                	jmp    807d59 <nsipc+0x12>
+
+00807d93 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  807d93:	55                   	push   %ebp
+  807d94:	89 e5                	mov    %esp,%ebp
+  807d96:	56                   	push   %esi
+  807d97:	53                   	push   %ebx
+  807d98:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  807d9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  807d9e:	a3 00 40 8a 00       	mov    %eax,0x8a4000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  807da3:	8b 06                	mov    (%esi),%eax
+  807da5:	a3 04 40 8a 00       	mov    %eax,0x8a4004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  807daa:	b8 01 00 00 00       	mov    $0x1,%eax
+  807daf:	e8 93 ff ff ff       	call   807d47 <nsipc>
+  807db4:	89 c3                	mov    %eax,%ebx
+  807db6:	85 c0                	test   %eax,%eax
+  807db8:	79 09                	jns    807dc3 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  807dba:	89 d8                	mov    %ebx,%eax
+  807dbc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807dbf:	5b                   	pop    %ebx
+  807dc0:	5e                   	pop    %esi
+  807dc1:	5d                   	pop    %ebp
+  807dc2:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  807dc3:	83 ec 04             	sub    $0x4,%esp
+  807dc6:	ff 35 10 40 8a 00    	push   0x8a4010
+  807dcc:	68 00 40 8a 00       	push   $0x8a4000
+  807dd1:	ff 75 0c             	push   0xc(%ebp)
+  807dd4:	e8 89 dd ff ff       	call   805b62 <memmove>
+		*addrlen = ret->ret_addrlen;
+  807dd9:	a1 10 40 8a 00       	mov    0x8a4010,%eax
+  807dde:	89 06                	mov    %eax,(%esi)
+  807de0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  807de3:	eb d5                	jmp    807dba <nsipc_accept+0x27>
+
+00807de5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  807de5:	55                   	push   %ebp
+  807de6:	89 e5                	mov    %esp,%ebp
+  807de8:	53                   	push   %ebx
+  807de9:	83 ec 08             	sub    $0x8,%esp
+  807dec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  807def:	8b 45 08             	mov    0x8(%ebp),%eax
+  807df2:	a3 00 40 8a 00       	mov    %eax,0x8a4000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  807df7:	53                   	push   %ebx
+  807df8:	ff 75 0c             	push   0xc(%ebp)
+  807dfb:	68 04 40 8a 00       	push   $0x8a4004
+  807e00:	e8 5d dd ff ff       	call   805b62 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  807e05:	89 1d 14 40 8a 00    	mov    %ebx,0x8a4014
+	return nsipc(NSREQ_BIND);
+  807e0b:	b8 02 00 00 00       	mov    $0x2,%eax
+  807e10:	e8 32 ff ff ff       	call   807d47 <nsipc>
+}
+  807e15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807e18:	c9                   	leave
+  807e19:	c3                   	ret
+
+00807e1a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  807e1a:	55                   	push   %ebp
+  807e1b:	89 e5                	mov    %esp,%ebp
+  807e1d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  807e20:	8b 45 08             	mov    0x8(%ebp),%eax
+  807e23:	a3 00 40 8a 00       	mov    %eax,0x8a4000
+	nsipcbuf.shutdown.req_how = how;
+  807e28:	8b 45 0c             	mov    0xc(%ebp),%eax
+  807e2b:	a3 04 40 8a 00       	mov    %eax,0x8a4004
+	return nsipc(NSREQ_SHUTDOWN);
+  807e30:	b8 03 00 00 00       	mov    $0x3,%eax
+  807e35:	e8 0d ff ff ff       	call   807d47 <nsipc>
+}
+  807e3a:	c9                   	leave
+  807e3b:	c3                   	ret
+
+00807e3c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  807e3c:	55                   	push   %ebp
+  807e3d:	89 e5                	mov    %esp,%ebp
+  807e3f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  807e42:	8b 45 08             	mov    0x8(%ebp),%eax
+  807e45:	a3 00 40 8a 00       	mov    %eax,0x8a4000
+	return nsipc(NSREQ_CLOSE);
+  807e4a:	b8 04 00 00 00       	mov    $0x4,%eax
+  807e4f:	e8 f3 fe ff ff       	call   807d47 <nsipc>
+}
+  807e54:	c9                   	leave
+  807e55:	c3                   	ret
+
+00807e56 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  807e56:	55                   	push   %ebp
+  807e57:	89 e5                	mov    %esp,%ebp
+  807e59:	53                   	push   %ebx
+  807e5a:	83 ec 08             	sub    $0x8,%esp
+  807e5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  807e60:	8b 45 08             	mov    0x8(%ebp),%eax
+  807e63:	a3 00 40 8a 00       	mov    %eax,0x8a4000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  807e68:	53                   	push   %ebx
+  807e69:	ff 75 0c             	push   0xc(%ebp)
+  807e6c:	68 04 40 8a 00       	push   $0x8a4004
+  807e71:	e8 ec dc ff ff       	call   805b62 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  807e76:	89 1d 14 40 8a 00    	mov    %ebx,0x8a4014
+	return nsipc(NSREQ_CONNECT);
+  807e7c:	b8 05 00 00 00       	mov    $0x5,%eax
+  807e81:	e8 c1 fe ff ff       	call   807d47 <nsipc>
+}
+  807e86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807e89:	c9                   	leave
+  807e8a:	c3                   	ret
+
+00807e8b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  807e8b:	55                   	push   %ebp
+  807e8c:	89 e5                	mov    %esp,%ebp
+  807e8e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  807e91:	8b 45 08             	mov    0x8(%ebp),%eax
+  807e94:	a3 00 40 8a 00       	mov    %eax,0x8a4000
+	nsipcbuf.listen.req_backlog = backlog;
+  807e99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  807e9c:	a3 04 40 8a 00       	mov    %eax,0x8a4004
+	return nsipc(NSREQ_LISTEN);
+  807ea1:	b8 06 00 00 00       	mov    $0x6,%eax
+  807ea6:	e8 9c fe ff ff       	call   807d47 <nsipc>
+}
+  807eab:	c9                   	leave
+  807eac:	c3                   	ret
+
+00807ead <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  807ead:	55                   	push   %ebp
+  807eae:	89 e5                	mov    %esp,%ebp
+  807eb0:	56                   	push   %esi
+  807eb1:	53                   	push   %ebx
+  807eb2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  807eb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  807eb8:	a3 00 40 8a 00       	mov    %eax,0x8a4000
+	nsipcbuf.recv.req_len = len;
+  807ebd:	89 35 04 40 8a 00    	mov    %esi,0x8a4004
+	nsipcbuf.recv.req_flags = flags;
+  807ec3:	8b 45 14             	mov    0x14(%ebp),%eax
+  807ec6:	a3 08 40 8a 00       	mov    %eax,0x8a4008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  807ecb:	b8 07 00 00 00       	mov    $0x7,%eax
+  807ed0:	e8 72 fe ff ff       	call   807d47 <nsipc>
+  807ed5:	89 c3                	mov    %eax,%ebx
+  807ed7:	85 c0                	test   %eax,%eax
+  807ed9:	78 22                	js     807efd <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  807edb:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  807ee0:	39 c6                	cmp    %eax,%esi
+  807ee2:	0f 4e c6             	cmovle %esi,%eax
+  807ee5:	39 c3                	cmp    %eax,%ebx
+  807ee7:	7f 1d                	jg     807f06 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  807ee9:	83 ec 04             	sub    $0x4,%esp
+  807eec:	53                   	push   %ebx
+  807eed:	68 00 40 8a 00       	push   $0x8a4000
+  807ef2:	ff 75 0c             	push   0xc(%ebp)
+  807ef5:	e8 68 dc ff ff       	call   805b62 <memmove>
+  807efa:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  807efd:	89 d8                	mov    %ebx,%eax
+  807eff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807f02:	5b                   	pop    %ebx
+  807f03:	5e                   	pop    %esi
+  807f04:	5d                   	pop    %ebp
+  807f05:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  807f06:	68 75 96 80 00       	push   $0x809675
+  807f0b:	68 fd 89 80 00       	push   $0x8089fd
+  807f10:	6a 62                	push   $0x62
+  807f12:	68 8a 96 80 00       	push   $0x80968a
+  807f17:	e8 f7 d3 ff ff       	call   805313 <_panic>
+
+00807f1c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  807f1c:	55                   	push   %ebp
+  807f1d:	89 e5                	mov    %esp,%ebp
+  807f1f:	53                   	push   %ebx
+  807f20:	83 ec 04             	sub    $0x4,%esp
+  807f23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  807f26:	8b 45 08             	mov    0x8(%ebp),%eax
+  807f29:	a3 00 40 8a 00       	mov    %eax,0x8a4000
+	assert(size < 1600);
+  807f2e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  807f34:	7f 2e                	jg     807f64 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  807f36:	83 ec 04             	sub    $0x4,%esp
+  807f39:	53                   	push   %ebx
+  807f3a:	ff 75 0c             	push   0xc(%ebp)
+  807f3d:	68 0c 40 8a 00       	push   $0x8a400c
+  807f42:	e8 1b dc ff ff       	call   805b62 <memmove>
+	nsipcbuf.send.req_size = size;
+  807f47:	89 1d 04 40 8a 00    	mov    %ebx,0x8a4004
+	nsipcbuf.send.req_flags = flags;
+  807f4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  807f50:	a3 08 40 8a 00       	mov    %eax,0x8a4008
+	return nsipc(NSREQ_SEND);
+  807f55:	b8 08 00 00 00       	mov    $0x8,%eax
+  807f5a:	e8 e8 fd ff ff       	call   807d47 <nsipc>
+}
+  807f5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807f62:	c9                   	leave
+  807f63:	c3                   	ret
+	assert(size < 1600);
+  807f64:	68 96 96 80 00       	push   $0x809696
+  807f69:	68 fd 89 80 00       	push   $0x8089fd
+  807f6e:	6a 6d                	push   $0x6d
+  807f70:	68 8a 96 80 00       	push   $0x80968a
+  807f75:	e8 99 d3 ff ff       	call   805313 <_panic>
+
+00807f7a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  807f7a:	55                   	push   %ebp
+  807f7b:	89 e5                	mov    %esp,%ebp
+  807f7d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  807f80:	8b 45 08             	mov    0x8(%ebp),%eax
+  807f83:	a3 00 40 8a 00       	mov    %eax,0x8a4000
+	nsipcbuf.socket.req_type = type;
+  807f88:	8b 45 0c             	mov    0xc(%ebp),%eax
+  807f8b:	a3 04 40 8a 00       	mov    %eax,0x8a4004
+	nsipcbuf.socket.req_protocol = protocol;
+  807f90:	8b 45 10             	mov    0x10(%ebp),%eax
+  807f93:	a3 08 40 8a 00       	mov    %eax,0x8a4008
+	return nsipc(NSREQ_SOCKET);
+  807f98:	b8 09 00 00 00       	mov    $0x9,%eax
+  807f9d:	e8 a5 fd ff ff       	call   807d47 <nsipc>
+}
+  807fa2:	c9                   	leave
+  807fa3:	c3                   	ret
+
+00807fa4 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  807fa4:	55                   	push   %ebp
+  807fa5:	89 e5                	mov    %esp,%ebp
+  807fa7:	56                   	push   %esi
+  807fa8:	53                   	push   %ebx
+  807fa9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  807fac:	83 ec 0c             	sub    $0xc,%esp
+  807faf:	ff 75 08             	push   0x8(%ebp)
+  807fb2:	e8 be e4 ff ff       	call   806475 <fd2data>
+  807fb7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  807fb9:	83 c4 08             	add    $0x8,%esp
+  807fbc:	68 a2 96 80 00       	push   $0x8096a2
+  807fc1:	53                   	push   %ebx
+  807fc2:	e8 15 da ff ff       	call   8059dc <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  807fc7:	8b 46 04             	mov    0x4(%esi),%eax
+  807fca:	2b 06                	sub    (%esi),%eax
+  807fcc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  807fd2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  807fd9:	00 00 00 
+	stat->st_dev = &devpipe;
+  807fdc:	c7 83 88 00 00 00 e0 	movl   $0x8250e0,0x88(%ebx)
+  807fe3:	50 82 00 
+	return 0;
+}
+  807fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  807feb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807fee:	5b                   	pop    %ebx
+  807fef:	5e                   	pop    %esi
+  807ff0:	5d                   	pop    %ebp
+  807ff1:	c3                   	ret
+
+00807ff2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  807ff2:	55                   	push   %ebp
+  807ff3:	89 e5                	mov    %esp,%ebp
+  807ff5:	53                   	push   %ebx
+  807ff6:	83 ec 0c             	sub    $0xc,%esp
+  807ff9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  807ffc:	53                   	push   %ebx
+  807ffd:	6a 00                	push   $0x0
+  807fff:	e8 71 de ff ff       	call   805e75 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  808004:	89 1c 24             	mov    %ebx,(%esp)
+  808007:	e8 69 e4 ff ff       	call   806475 <fd2data>
+  80800c:	83 c4 08             	add    $0x8,%esp
+  80800f:	50                   	push   %eax
+  808010:	6a 00                	push   $0x0
+  808012:	e8 5e de ff ff       	call   805e75 <sys_page_unmap>
+}
+  808017:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80801a:	c9                   	leave
+  80801b:	c3                   	ret
+
+0080801c <_pipeisclosed>:
+{
+  80801c:	55                   	push   %ebp
+  80801d:	89 e5                	mov    %esp,%ebp
+  80801f:	57                   	push   %edi
+  808020:	56                   	push   %esi
+  808021:	53                   	push   %ebx
+  808022:	83 ec 1c             	sub    $0x1c,%esp
+  808025:	89 c7                	mov    %eax,%edi
+  808027:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  808029:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  80802e:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  808031:	83 ec 0c             	sub    $0xc,%esp
+  808034:	57                   	push   %edi
+  808035:	e8 c0 fa ff ff       	call   807afa <pageref>
+  80803a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80803d:	89 34 24             	mov    %esi,(%esp)
+  808040:	e8 b5 fa ff ff       	call   807afa <pageref>
+		nn = thisenv->env_runs;
+  808045:	8b 15 8c 10 8a 00    	mov    0x8a108c,%edx
+  80804b:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80804e:	83 c4 10             	add    $0x10,%esp
+  808051:	39 cb                	cmp    %ecx,%ebx
+  808053:	74 1b                	je     808070 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  808055:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  808058:	75 cf                	jne    808029 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80805a:	8b 42 58             	mov    0x58(%edx),%eax
+  80805d:	6a 01                	push   $0x1
+  80805f:	50                   	push   %eax
+  808060:	53                   	push   %ebx
+  808061:	68 a9 96 80 00       	push   $0x8096a9
+  808066:	e8 83 d3 ff ff       	call   8053ee <cprintf>
+  80806b:	83 c4 10             	add    $0x10,%esp
+  80806e:	eb b9                	jmp    808029 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  808070:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  808073:	0f 94 c0             	sete   %al
+  808076:	0f b6 c0             	movzbl %al,%eax
+}
+  808079:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80807c:	5b                   	pop    %ebx
+  80807d:	5e                   	pop    %esi
+  80807e:	5f                   	pop    %edi
+  80807f:	5d                   	pop    %ebp
+  808080:	c3                   	ret
+
+00808081 <devpipe_write>:
+{
+  808081:	55                   	push   %ebp
+  808082:	89 e5                	mov    %esp,%ebp
+  808084:	57                   	push   %edi
+  808085:	56                   	push   %esi
+  808086:	53                   	push   %ebx
+  808087:	83 ec 28             	sub    $0x28,%esp
+  80808a:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80808d:	56                   	push   %esi
+  80808e:	e8 e2 e3 ff ff       	call   806475 <fd2data>
+  808093:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  808095:	83 c4 10             	add    $0x10,%esp
+  808098:	bf 00 00 00 00       	mov    $0x0,%edi
+  80809d:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8080a0:	75 09                	jne    8080ab <devpipe_write+0x2a>
+	return i;
+  8080a2:	89 f8                	mov    %edi,%eax
+  8080a4:	eb 23                	jmp    8080c9 <devpipe_write+0x48>
+			sys_yield();
+  8080a6:	e8 1e dd ff ff       	call   805dc9 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8080ab:	8b 43 04             	mov    0x4(%ebx),%eax
+  8080ae:	8b 0b                	mov    (%ebx),%ecx
+  8080b0:	8d 51 20             	lea    0x20(%ecx),%edx
+  8080b3:	39 d0                	cmp    %edx,%eax
+  8080b5:	72 1a                	jb     8080d1 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8080b7:	89 da                	mov    %ebx,%edx
+  8080b9:	89 f0                	mov    %esi,%eax
+  8080bb:	e8 5c ff ff ff       	call   80801c <_pipeisclosed>
+  8080c0:	85 c0                	test   %eax,%eax
+  8080c2:	74 e2                	je     8080a6 <devpipe_write+0x25>
+				return 0;
+  8080c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8080c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8080cc:	5b                   	pop    %ebx
+  8080cd:	5e                   	pop    %esi
+  8080ce:	5f                   	pop    %edi
+  8080cf:	5d                   	pop    %ebp
+  8080d0:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8080d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8080d4:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8080d8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8080db:	89 c2                	mov    %eax,%edx
+  8080dd:	c1 fa 1f             	sar    $0x1f,%edx
+  8080e0:	89 d1                	mov    %edx,%ecx
+  8080e2:	c1 e9 1b             	shr    $0x1b,%ecx
+  8080e5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8080e8:	83 e2 1f             	and    $0x1f,%edx
+  8080eb:	29 ca                	sub    %ecx,%edx
+  8080ed:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8080f1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8080f5:	83 c0 01             	add    $0x1,%eax
+  8080f8:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8080fb:	83 c7 01             	add    $0x1,%edi
+  8080fe:	eb 9d                	jmp    80809d <devpipe_write+0x1c>
+
+00808100 <devpipe_read>:
+{
+  808100:	55                   	push   %ebp
+  808101:	89 e5                	mov    %esp,%ebp
+  808103:	57                   	push   %edi
+  808104:	56                   	push   %esi
+  808105:	53                   	push   %ebx
+  808106:	83 ec 18             	sub    $0x18,%esp
+  808109:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80810c:	57                   	push   %edi
+  80810d:	e8 63 e3 ff ff       	call   806475 <fd2data>
+  808112:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  808114:	83 c4 10             	add    $0x10,%esp
+  808117:	be 00 00 00 00       	mov    $0x0,%esi
+  80811c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80811f:	75 13                	jne    808134 <devpipe_read+0x34>
+	return i;
+  808121:	89 f0                	mov    %esi,%eax
+  808123:	eb 02                	jmp    808127 <devpipe_read+0x27>
+				return i;
+  808125:	89 f0                	mov    %esi,%eax
+}
+  808127:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80812a:	5b                   	pop    %ebx
+  80812b:	5e                   	pop    %esi
+  80812c:	5f                   	pop    %edi
+  80812d:	5d                   	pop    %ebp
+  80812e:	c3                   	ret
+			sys_yield();
+  80812f:	e8 95 dc ff ff       	call   805dc9 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  808134:	8b 03                	mov    (%ebx),%eax
+  808136:	3b 43 04             	cmp    0x4(%ebx),%eax
+  808139:	75 18                	jne    808153 <devpipe_read+0x53>
+			if (i > 0)
+  80813b:	85 f6                	test   %esi,%esi
+  80813d:	75 e6                	jne    808125 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80813f:	89 da                	mov    %ebx,%edx
+  808141:	89 f8                	mov    %edi,%eax
+  808143:	e8 d4 fe ff ff       	call   80801c <_pipeisclosed>
+  808148:	85 c0                	test   %eax,%eax
+  80814a:	74 e3                	je     80812f <devpipe_read+0x2f>
+				return 0;
+  80814c:	b8 00 00 00 00       	mov    $0x0,%eax
+  808151:	eb d4                	jmp    808127 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  808153:	99                   	cltd
+  808154:	c1 ea 1b             	shr    $0x1b,%edx
+  808157:	01 d0                	add    %edx,%eax
+  808159:	83 e0 1f             	and    $0x1f,%eax
+  80815c:	29 d0                	sub    %edx,%eax
+  80815e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  808163:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  808166:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  808169:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80816c:	83 c6 01             	add    $0x1,%esi
+  80816f:	eb ab                	jmp    80811c <devpipe_read+0x1c>
+
+00808171 <pipe>:
+{
+  808171:	55                   	push   %ebp
+  808172:	89 e5                	mov    %esp,%ebp
+  808174:	56                   	push   %esi
+  808175:	53                   	push   %ebx
+  808176:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  808179:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80817c:	50                   	push   %eax
+  80817d:	e8 0a e3 ff ff       	call   80648c <fd_alloc>
+  808182:	89 c3                	mov    %eax,%ebx
+  808184:	83 c4 10             	add    $0x10,%esp
+  808187:	85 c0                	test   %eax,%eax
+  808189:	0f 88 23 01 00 00    	js     8082b2 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80818f:	83 ec 04             	sub    $0x4,%esp
+  808192:	68 07 04 00 00       	push   $0x407
+  808197:	ff 75 f4             	push   -0xc(%ebp)
+  80819a:	6a 00                	push   $0x0
+  80819c:	e8 47 dc ff ff       	call   805de8 <sys_page_alloc>
+  8081a1:	89 c3                	mov    %eax,%ebx
+  8081a3:	83 c4 10             	add    $0x10,%esp
+  8081a6:	85 c0                	test   %eax,%eax
+  8081a8:	0f 88 04 01 00 00    	js     8082b2 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8081ae:	83 ec 0c             	sub    $0xc,%esp
+  8081b1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8081b4:	50                   	push   %eax
+  8081b5:	e8 d2 e2 ff ff       	call   80648c <fd_alloc>
+  8081ba:	89 c3                	mov    %eax,%ebx
+  8081bc:	83 c4 10             	add    $0x10,%esp
+  8081bf:	85 c0                	test   %eax,%eax
+  8081c1:	0f 88 db 00 00 00    	js     8082a2 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8081c7:	83 ec 04             	sub    $0x4,%esp
+  8081ca:	68 07 04 00 00       	push   $0x407
+  8081cf:	ff 75 f0             	push   -0x10(%ebp)
+  8081d2:	6a 00                	push   $0x0
+  8081d4:	e8 0f dc ff ff       	call   805de8 <sys_page_alloc>
+  8081d9:	89 c3                	mov    %eax,%ebx
+  8081db:	83 c4 10             	add    $0x10,%esp
+  8081de:	85 c0                	test   %eax,%eax
+  8081e0:	0f 88 bc 00 00 00    	js     8082a2 <pipe+0x131>
+	va = fd2data(fd0);
+  8081e6:	83 ec 0c             	sub    $0xc,%esp
+  8081e9:	ff 75 f4             	push   -0xc(%ebp)
+  8081ec:	e8 84 e2 ff ff       	call   806475 <fd2data>
+  8081f1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8081f3:	83 c4 0c             	add    $0xc,%esp
+  8081f6:	68 07 04 00 00       	push   $0x407
+  8081fb:	50                   	push   %eax
+  8081fc:	6a 00                	push   $0x0
+  8081fe:	e8 e5 db ff ff       	call   805de8 <sys_page_alloc>
+  808203:	89 c3                	mov    %eax,%ebx
+  808205:	83 c4 10             	add    $0x10,%esp
+  808208:	85 c0                	test   %eax,%eax
+  80820a:	0f 88 82 00 00 00    	js     808292 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  808210:	83 ec 0c             	sub    $0xc,%esp
+  808213:	ff 75 f0             	push   -0x10(%ebp)
+  808216:	e8 5a e2 ff ff       	call   806475 <fd2data>
+  80821b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  808222:	50                   	push   %eax
+  808223:	6a 00                	push   $0x0
+  808225:	56                   	push   %esi
+  808226:	6a 00                	push   $0x0
+  808228:	e8 06 dc ff ff       	call   805e33 <sys_page_map>
+  80822d:	89 c3                	mov    %eax,%ebx
+  80822f:	83 c4 20             	add    $0x20,%esp
+  808232:	85 c0                	test   %eax,%eax
+  808234:	78 4e                	js     808284 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  808236:	a1 e0 50 82 00       	mov    0x8250e0,%eax
+  80823b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80823e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  808240:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  808243:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80824a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80824d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80824f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  808252:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  808259:	83 ec 0c             	sub    $0xc,%esp
+  80825c:	ff 75 f4             	push   -0xc(%ebp)
+  80825f:	e8 01 e2 ff ff       	call   806465 <fd2num>
+  808264:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  808267:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  808269:	83 c4 04             	add    $0x4,%esp
+  80826c:	ff 75 f0             	push   -0x10(%ebp)
+  80826f:	e8 f1 e1 ff ff       	call   806465 <fd2num>
+  808274:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  808277:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80827a:	83 c4 10             	add    $0x10,%esp
+  80827d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  808282:	eb 2e                	jmp    8082b2 <pipe+0x141>
+	sys_page_unmap(0, va);
+  808284:	83 ec 08             	sub    $0x8,%esp
+  808287:	56                   	push   %esi
+  808288:	6a 00                	push   $0x0
+  80828a:	e8 e6 db ff ff       	call   805e75 <sys_page_unmap>
+  80828f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  808292:	83 ec 08             	sub    $0x8,%esp
+  808295:	ff 75 f0             	push   -0x10(%ebp)
+  808298:	6a 00                	push   $0x0
+  80829a:	e8 d6 db ff ff       	call   805e75 <sys_page_unmap>
+  80829f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8082a2:	83 ec 08             	sub    $0x8,%esp
+  8082a5:	ff 75 f4             	push   -0xc(%ebp)
+  8082a8:	6a 00                	push   $0x0
+  8082aa:	e8 c6 db ff ff       	call   805e75 <sys_page_unmap>
+  8082af:	83 c4 10             	add    $0x10,%esp
+}
+  8082b2:	89 d8                	mov    %ebx,%eax
+  8082b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8082b7:	5b                   	pop    %ebx
+  8082b8:	5e                   	pop    %esi
+  8082b9:	5d                   	pop    %ebp
+  8082ba:	c3                   	ret
+
+008082bb <pipeisclosed>:
+{
+  8082bb:	55                   	push   %ebp
+  8082bc:	89 e5                	mov    %esp,%ebp
+  8082be:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8082c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8082c4:	50                   	push   %eax
+  8082c5:	ff 75 08             	push   0x8(%ebp)
+  8082c8:	e8 15 e2 ff ff       	call   8064e2 <fd_lookup>
+  8082cd:	83 c4 10             	add    $0x10,%esp
+  8082d0:	85 c0                	test   %eax,%eax
+  8082d2:	78 18                	js     8082ec <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8082d4:	83 ec 0c             	sub    $0xc,%esp
+  8082d7:	ff 75 f4             	push   -0xc(%ebp)
+  8082da:	e8 96 e1 ff ff       	call   806475 <fd2data>
+  8082df:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8082e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8082e4:	e8 33 fd ff ff       	call   80801c <_pipeisclosed>
+  8082e9:	83 c4 10             	add    $0x10,%esp
+}
+  8082ec:	c9                   	leave
+  8082ed:	c3                   	ret
+
+008082ee <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8082ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8082f3:	c3                   	ret
+
+008082f4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8082f4:	55                   	push   %ebp
+  8082f5:	89 e5                	mov    %esp,%ebp
+  8082f7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8082fa:	68 c1 96 80 00       	push   $0x8096c1
+  8082ff:	ff 75 0c             	push   0xc(%ebp)
+  808302:	e8 d5 d6 ff ff       	call   8059dc <strcpy>
+	return 0;
+}
+  808307:	b8 00 00 00 00       	mov    $0x0,%eax
+  80830c:	c9                   	leave
+  80830d:	c3                   	ret
+
+0080830e <devcons_write>:
+{
+  80830e:	55                   	push   %ebp
+  80830f:	89 e5                	mov    %esp,%ebp
+  808311:	57                   	push   %edi
+  808312:	56                   	push   %esi
+  808313:	53                   	push   %ebx
+  808314:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80831a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80831f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  808325:	eb 2e                	jmp    808355 <devcons_write+0x47>
+		m = n - tot;
+  808327:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80832a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80832c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  808331:	39 c3                	cmp    %eax,%ebx
+  808333:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  808336:	83 ec 04             	sub    $0x4,%esp
+  808339:	53                   	push   %ebx
+  80833a:	89 f0                	mov    %esi,%eax
+  80833c:	03 45 0c             	add    0xc(%ebp),%eax
+  80833f:	50                   	push   %eax
+  808340:	57                   	push   %edi
+  808341:	e8 1c d8 ff ff       	call   805b62 <memmove>
+		sys_cputs(buf, m);
+  808346:	83 c4 08             	add    $0x8,%esp
+  808349:	53                   	push   %ebx
+  80834a:	57                   	push   %edi
+  80834b:	e8 bc d9 ff ff       	call   805d0c <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  808350:	01 de                	add    %ebx,%esi
+  808352:	83 c4 10             	add    $0x10,%esp
+  808355:	3b 75 10             	cmp    0x10(%ebp),%esi
+  808358:	72 cd                	jb     808327 <devcons_write+0x19>
+}
+  80835a:	89 f0                	mov    %esi,%eax
+  80835c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80835f:	5b                   	pop    %ebx
+  808360:	5e                   	pop    %esi
+  808361:	5f                   	pop    %edi
+  808362:	5d                   	pop    %ebp
+  808363:	c3                   	ret
+
+00808364 <devcons_read>:
+{
+  808364:	55                   	push   %ebp
+  808365:	89 e5                	mov    %esp,%ebp
+  808367:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80836a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80836f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  808373:	75 07                	jne    80837c <devcons_read+0x18>
+  808375:	eb 1f                	jmp    808396 <devcons_read+0x32>
+		sys_yield();
+  808377:	e8 4d da ff ff       	call   805dc9 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80837c:	e8 b1 d9 ff ff       	call   805d32 <sys_cgetc>
+  808381:	85 c0                	test   %eax,%eax
+  808383:	74 f2                	je     808377 <devcons_read+0x13>
+	if (c < 0)
+  808385:	78 0f                	js     808396 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  808387:	83 f8 04             	cmp    $0x4,%eax
+  80838a:	74 0c                	je     808398 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80838c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80838f:	88 02                	mov    %al,(%edx)
+	return 1;
+  808391:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  808396:	c9                   	leave
+  808397:	c3                   	ret
+		return 0;
+  808398:	b8 00 00 00 00       	mov    $0x0,%eax
+  80839d:	eb f7                	jmp    808396 <devcons_read+0x32>
+
+0080839f <cputchar>:
+{
+  80839f:	55                   	push   %ebp
+  8083a0:	89 e5                	mov    %esp,%ebp
+  8083a2:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8083a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8083a8:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8083ab:	6a 01                	push   $0x1
+  8083ad:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8083b0:	50                   	push   %eax
+  8083b1:	e8 56 d9 ff ff       	call   805d0c <sys_cputs>
+}
+  8083b6:	83 c4 10             	add    $0x10,%esp
+  8083b9:	c9                   	leave
+  8083ba:	c3                   	ret
+
+008083bb <getchar>:
+{
+  8083bb:	55                   	push   %ebp
+  8083bc:	89 e5                	mov    %esp,%ebp
+  8083be:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8083c1:	6a 01                	push   $0x1
+  8083c3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8083c6:	50                   	push   %eax
+  8083c7:	6a 00                	push   $0x0
+  8083c9:	e8 7a e3 ff ff       	call   806748 <read>
+	if (r < 0)
+  8083ce:	83 c4 10             	add    $0x10,%esp
+  8083d1:	85 c0                	test   %eax,%eax
+  8083d3:	78 06                	js     8083db <getchar+0x20>
+	if (r < 1)
+  8083d5:	74 06                	je     8083dd <getchar+0x22>
+	return c;
+  8083d7:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8083db:	c9                   	leave
+  8083dc:	c3                   	ret
+		return -E_EOF;
+  8083dd:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8083e2:	eb f7                	jmp    8083db <getchar+0x20>
+
+008083e4 <iscons>:
+{
+  8083e4:	55                   	push   %ebp
+  8083e5:	89 e5                	mov    %esp,%ebp
+  8083e7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8083ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8083ed:	50                   	push   %eax
+  8083ee:	ff 75 08             	push   0x8(%ebp)
+  8083f1:	e8 ec e0 ff ff       	call   8064e2 <fd_lookup>
+  8083f6:	83 c4 10             	add    $0x10,%esp
+  8083f9:	85 c0                	test   %eax,%eax
+  8083fb:	78 11                	js     80840e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8083fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  808400:	8b 15 00 51 82 00    	mov    0x825100,%edx
+  808406:	39 10                	cmp    %edx,(%eax)
+  808408:	0f 94 c0             	sete   %al
+  80840b:	0f b6 c0             	movzbl %al,%eax
+}
+  80840e:	c9                   	leave
+  80840f:	c3                   	ret
+
+00808410 <opencons>:
+{
+  808410:	55                   	push   %ebp
+  808411:	89 e5                	mov    %esp,%ebp
+  808413:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  808416:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  808419:	50                   	push   %eax
+  80841a:	e8 6d e0 ff ff       	call   80648c <fd_alloc>
+  80841f:	83 c4 10             	add    $0x10,%esp
+  808422:	85 c0                	test   %eax,%eax
+  808424:	78 3a                	js     808460 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  808426:	83 ec 04             	sub    $0x4,%esp
+  808429:	68 07 04 00 00       	push   $0x407
+  80842e:	ff 75 f4             	push   -0xc(%ebp)
+  808431:	6a 00                	push   $0x0
+  808433:	e8 b0 d9 ff ff       	call   805de8 <sys_page_alloc>
+  808438:	83 c4 10             	add    $0x10,%esp
+  80843b:	85 c0                	test   %eax,%eax
+  80843d:	78 21                	js     808460 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80843f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  808442:	8b 15 00 51 82 00    	mov    0x825100,%edx
+  808448:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80844a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80844d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  808454:	83 ec 0c             	sub    $0xc,%esp
+  808457:	50                   	push   %eax
+  808458:	e8 08 e0 ff ff       	call   806465 <fd2num>
+  80845d:	83 c4 10             	add    $0x10,%esp
+}
+  808460:	c9                   	leave
+  808461:	c3                   	ret
+
+00808462 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  808462:	55                   	push   %ebp
+  808463:	89 e5                	mov    %esp,%ebp
+  808465:	57                   	push   %edi
+  808466:	56                   	push   %esi
+  808467:	53                   	push   %ebx
+  808468:	83 ec 20             	sub    $0x20,%esp
+  80846b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80846e:	89 d7                	mov    %edx,%edi
+  808470:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  808472:	51                   	push   %ecx
+  808473:	68 00 f0 7f 00       	push   $0x7ff000
+  808478:	6a 00                	push   $0x0
+  80847a:	e8 69 d9 ff ff       	call   805de8 <sys_page_alloc>
+  80847f:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  808481:	83 c4 10             	add    $0x10,%esp
+  808484:	85 c0                	test   %eax,%eax
+  808486:	78 45                	js     8084cd <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  808488:	83 ec 04             	sub    $0x4,%esp
+  80848b:	68 00 10 00 00       	push   $0x1000
+  808490:	57                   	push   %edi
+  808491:	68 00 f0 7f 00       	push   $0x7ff000
+  808496:	e8 c7 d6 ff ff       	call   805b62 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  80849b:	89 34 24             	mov    %esi,(%esp)
+  80849e:	57                   	push   %edi
+  80849f:	ff 75 e4             	push   -0x1c(%ebp)
+  8084a2:	68 00 f0 7f 00       	push   $0x7ff000
+  8084a7:	6a 00                	push   $0x0
+  8084a9:	e8 85 d9 ff ff       	call   805e33 <sys_page_map>
+  8084ae:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8084b0:	83 c4 20             	add    $0x20,%esp
+  8084b3:	85 c0                	test   %eax,%eax
+  8084b5:	78 16                	js     8084cd <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8084b7:	83 ec 08             	sub    $0x8,%esp
+  8084ba:	68 00 f0 7f 00       	push   $0x7ff000
+  8084bf:	6a 00                	push   $0x0
+  8084c1:	e8 af d9 ff ff       	call   805e75 <sys_page_unmap>
+  8084c6:	83 c4 10             	add    $0x10,%esp
+  8084c9:	85 c0                	test   %eax,%eax
+  8084cb:	75 0a                	jne    8084d7 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8084cd:	89 d8                	mov    %ebx,%eax
+  8084cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8084d2:	5b                   	pop    %ebx
+  8084d3:	5e                   	pop    %esi
+  8084d4:	5f                   	pop    %edi
+  8084d5:	5d                   	pop    %ebp
+  8084d6:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8084d7:	68 d0 96 80 00       	push   $0x8096d0
+  8084dc:	68 fd 89 80 00       	push   $0x8089fd
+  8084e1:	6a 1b                	push   $0x1b
+  8084e3:	68 48 97 80 00       	push   $0x809748
+  8084e8:	e8 26 ce ff ff       	call   805313 <_panic>
+
+008084ed <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8084ed:	55                   	push   %ebp
+  8084ee:	89 e5                	mov    %esp,%ebp
+  8084f0:	53                   	push   %ebx
+  8084f1:	83 ec 04             	sub    $0x4,%esp
+  8084f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8084f7:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8084f9:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  8084fd:	74 21                	je     808520 <pgfault+0x33>
+  8084ff:	89 d0                	mov    %edx,%eax
+  808501:	c1 e8 16             	shr    $0x16,%eax
+  808504:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80850b:	a8 01                	test   $0x1,%al
+  80850d:	74 11                	je     808520 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  80850f:	89 d0                	mov    %edx,%eax
+  808511:	c1 e8 0c             	shr    $0xc,%eax
+  808514:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80851b:	f6 c4 08             	test   $0x8,%ah
+  80851e:	75 17                	jne    808537 <pgfault+0x4a>
+		if (pgfault_next) {
+  808520:	a1 04 50 8a 00       	mov    0x8a5004,%eax
+  808525:	85 c0                	test   %eax,%eax
+  808527:	74 27                	je     808550 <pgfault+0x63>
+			pgfault_next(utf);
+  808529:	83 ec 0c             	sub    $0xc,%esp
+  80852c:	53                   	push   %ebx
+  80852d:	ff d0                	call   *%eax
+			return;
+  80852f:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  808532:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  808535:	c9                   	leave
+  808536:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  808537:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80853d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  808542:	b8 00 00 00 00       	mov    $0x0,%eax
+  808547:	e8 16 ff ff ff       	call   808462 <copy_page_to>
+  80854c:	85 c0                	test   %eax,%eax
+  80854e:	79 e2                	jns    808532 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  808550:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  808555:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  808558:	ff 73 28             	push   0x28(%ebx)
+  80855b:	ff 33                	push   (%ebx)
+  80855d:	50                   	push   %eax
+  80855e:	68 f4 96 80 00       	push   $0x8096f4
+  808563:	e8 86 ce ff ff       	call   8053ee <cprintf>
+	sys_env_destroy(0);
+  808568:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80856f:	e8 e5 d7 ff ff       	call   805d59 <sys_env_destroy>
+  808574:	83 c4 10             	add    $0x10,%esp
+  808577:	eb b9                	jmp    808532 <pgfault+0x45>
+
+00808579 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  808579:	55                   	push   %ebp
+  80857a:	89 e5                	mov    %esp,%ebp
+  80857c:	53                   	push   %ebx
+  80857d:	83 ec 04             	sub    $0x4,%esp
+  808580:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  808583:	a1 90 10 8a 00       	mov    0x8a1090,%eax
+  808588:	3d ed 84 80 00       	cmp    $0x8084ed,%eax
+  80858d:	74 15                	je     8085a4 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80858f:	a3 04 50 8a 00       	mov    %eax,0x8a5004
+		set_pgfault_handler(pgfault);
+  808594:	83 ec 0c             	sub    $0xc,%esp
+  808597:	68 ed 84 80 00       	push   $0x8084ed
+  80859c:	e8 48 dc ff ff       	call   8061e9 <set_pgfault_handler>
+  8085a1:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8085a4:	83 ec 0c             	sub    $0xc,%esp
+  8085a7:	68 05 08 00 00       	push   $0x805
+  8085ac:	53                   	push   %ebx
+  8085ad:	6a 00                	push   $0x0
+  8085af:	53                   	push   %ebx
+  8085b0:	6a 00                	push   $0x0
+  8085b2:	e8 7c d8 ff ff       	call   805e33 <sys_page_map>
+}
+  8085b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8085ba:	c9                   	leave
+  8085bb:	c3                   	ret
+
+008085bc <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8085bc:	55                   	push   %ebp
+  8085bd:	89 e5                	mov    %esp,%ebp
+  8085bf:	57                   	push   %edi
+  8085c0:	56                   	push   %esi
+  8085c1:	53                   	push   %ebx
+  8085c2:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8085c5:	68 ed 84 80 00       	push   $0x8084ed
+  8085ca:	e8 1a dc ff ff       	call   8061e9 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8085cf:	b8 07 00 00 00       	mov    $0x7,%eax
+  8085d4:	cd 30                	int    $0x30
+  8085d6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8085d9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8085dc:	83 c4 10             	add    $0x10,%esp
+  8085df:	85 c0                	test   %eax,%eax
+  8085e1:	0f 88 6b 01 00 00    	js     808752 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8085e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8085ec:	75 37                	jne    808625 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8085ee:	e8 af d7 ff ff       	call   805da2 <sys_getenvid>
+  8085f3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8085f8:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8085fe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  808603:	a3 8c 10 8a 00       	mov    %eax,0x8a108c
+		return 0;
+  808608:	e9 45 01 00 00       	jmp    808752 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  80860d:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  808613:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  808619:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80861f:	0f 87 ba 00 00 00    	ja     8086df <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  808625:	89 d8                	mov    %ebx,%eax
+  808627:	c1 e8 16             	shr    $0x16,%eax
+  80862a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  808631:	a8 01                	test   $0x1,%al
+  808633:	74 d8                	je     80860d <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  808635:	89 d8                	mov    %ebx,%eax
+  808637:	c1 e8 0c             	shr    $0xc,%eax
+  80863a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  808641:	f6 c2 01             	test   $0x1,%dl
+  808644:	74 cd                	je     808613 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  808646:	89 da                	mov    %ebx,%edx
+  808648:	80 e6 df             	and    $0xdf,%dh
+  80864b:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  808651:	74 c0                	je     808613 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  808653:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  808655:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80865c:	f6 c6 04             	test   $0x4,%dh
+  80865f:	75 53                	jne    8086b4 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  808661:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  808668:	f6 c6 08             	test   $0x8,%dh
+  80866b:	75 0c                	jne    808679 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80866d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  808674:	f6 c2 02             	test   $0x2,%dl
+  808677:	74 3b                	je     8086b4 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  808679:	83 ec 0c             	sub    $0xc,%esp
+  80867c:	68 05 08 00 00       	push   $0x805
+  808681:	57                   	push   %edi
+  808682:	ff 75 e4             	push   -0x1c(%ebp)
+  808685:	57                   	push   %edi
+  808686:	6a 00                	push   $0x0
+  808688:	e8 a6 d7 ff ff       	call   805e33 <sys_page_map>
+  80868d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80868f:	83 c4 20             	add    $0x20,%esp
+  808692:	85 c0                	test   %eax,%eax
+  808694:	0f 88 a7 00 00 00    	js     808741 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80869a:	83 ec 0c             	sub    $0xc,%esp
+  80869d:	68 05 08 00 00       	push   $0x805
+  8086a2:	57                   	push   %edi
+  8086a3:	6a 00                	push   $0x0
+  8086a5:	57                   	push   %edi
+  8086a6:	6a 00                	push   $0x0
+  8086a8:	e8 86 d7 ff ff       	call   805e33 <sys_page_map>
+  8086ad:	89 c6                	mov    %eax,%esi
+	return r;
+  8086af:	83 c4 20             	add    $0x20,%esp
+  8086b2:	eb 21                	jmp    8086d5 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8086b4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8086bb:	83 ec 0c             	sub    $0xc,%esp
+  8086be:	25 07 0e 00 00       	and    $0xe07,%eax
+  8086c3:	50                   	push   %eax
+  8086c4:	57                   	push   %edi
+  8086c5:	ff 75 e4             	push   -0x1c(%ebp)
+  8086c8:	57                   	push   %edi
+  8086c9:	6a 00                	push   $0x0
+  8086cb:	e8 63 d7 ff ff       	call   805e33 <sys_page_map>
+  8086d0:	89 c6                	mov    %eax,%esi
+  8086d2:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8086d5:	85 f6                	test   %esi,%esi
+  8086d7:	0f 89 36 ff ff ff    	jns    808613 <fork+0x57>
+  8086dd:	eb 62                	jmp    808741 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8086df:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8086e4:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8086e9:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8086ec:	89 f8                	mov    %edi,%eax
+  8086ee:	e8 6f fd ff ff       	call   808462 <copy_page_to>
+  8086f3:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8086f5:	85 c0                	test   %eax,%eax
+  8086f7:	78 48                	js     808741 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8086f9:	83 ec 04             	sub    $0x4,%esp
+  8086fc:	6a 07                	push   $0x7
+  8086fe:	68 00 f0 bf ee       	push   $0xeebff000
+  808703:	57                   	push   %edi
+  808704:	e8 df d6 ff ff       	call   805de8 <sys_page_alloc>
+  808709:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80870b:	83 c4 10             	add    $0x10,%esp
+  80870e:	85 c0                	test   %eax,%eax
+  808710:	78 2f                	js     808741 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  808712:	a1 8c 10 8a 00       	mov    0x8a108c,%eax
+  808717:	8b 40 64             	mov    0x64(%eax),%eax
+  80871a:	83 ec 08             	sub    $0x8,%esp
+  80871d:	50                   	push   %eax
+  80871e:	57                   	push   %edi
+  80871f:	e8 2f d8 ff ff       	call   805f53 <sys_env_set_pgfault_upcall>
+  808724:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  808726:	83 c4 10             	add    $0x10,%esp
+  808729:	85 c0                	test   %eax,%eax
+  80872b:	78 14                	js     808741 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80872d:	83 ec 08             	sub    $0x8,%esp
+  808730:	6a 02                	push   $0x2
+  808732:	57                   	push   %edi
+  808733:	e8 87 d7 ff ff       	call   805ebf <sys_env_set_status>
+  808738:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80873a:	83 c4 10             	add    $0x10,%esp
+  80873d:	85 c0                	test   %eax,%eax
+  80873f:	79 11                	jns    808752 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  808741:	83 ec 0c             	sub    $0xc,%esp
+  808744:	ff 75 e0             	push   -0x20(%ebp)
+  808747:	e8 0d d6 ff ff       	call   805d59 <sys_env_destroy>
+	return r;
+  80874c:	83 c4 10             	add    $0x10,%esp
+  80874f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  808752:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  808755:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808758:	5b                   	pop    %ebx
+  808759:	5e                   	pop    %esi
+  80875a:	5f                   	pop    %edi
+  80875b:	5d                   	pop    %ebp
+  80875c:	c3                   	ret
+
+0080875d <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80875d:	55                   	push   %ebp
+  80875e:	89 e5                	mov    %esp,%ebp
+  808760:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  808763:	68 53 97 80 00       	push   $0x809753
+  808768:	68 bf 00 00 00       	push   $0xbf
+  80876d:	68 48 97 80 00       	push   $0x809748
+  808772:	e8 9c cb ff ff       	call   805313 <_panic>
+
+00808777 <dm>:
+  808777:	55                   	push   %ebp
+  808778:	57                   	push   %edi
+  808779:	56                   	push   %esi
+  80877a:	53                   	push   %ebx
+  80877b:	83 ec 24             	sub    $0x24,%esp
+  80877e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  808782:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  808786:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80878a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80878e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  808792:	89 54 24 14          	mov    %edx,0x14(%esp)
+  808796:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80879a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80879f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8087a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8087a9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8087b0:	00 
+  8087b1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8087b8:	00 
+  8087b9:	89 fb                	mov    %edi,%ebx
+  8087bb:	eb 08                	jmp    8087c5 <dm+0x4e>
+  8087bd:	83 e9 01             	sub    $0x1,%ecx
+  8087c0:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8087c3:	74 68                	je     80882d <dm+0xb6>
+  8087c5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8087c9:	01 c0                	add    %eax,%eax
+  8087cb:	89 c6                	mov    %eax,%esi
+  8087cd:	89 d7                	mov    %edx,%edi
+  8087cf:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8087d3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8087d7:	0f ad d0             	shrd   %cl,%edx,%eax
+  8087da:	d3 ea                	shr    %cl,%edx
+  8087dc:	f6 c1 20             	test   $0x20,%cl
+  8087df:	74 04                	je     8087e5 <dm+0x6e>
+  8087e1:	89 d0                	mov    %edx,%eax
+  8087e3:	31 d2                	xor    %edx,%edx
+  8087e5:	83 e0 01             	and    $0x1,%eax
+  8087e8:	89 04 24             	mov    %eax,(%esp)
+  8087eb:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8087f2:	00 
+  8087f3:	8b 04 24             	mov    (%esp),%eax
+  8087f6:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8087fa:	09 f0                	or     %esi,%eax
+  8087fc:	09 fa                	or     %edi,%edx
+  8087fe:	8b 74 24 10          	mov    0x10(%esp),%esi
+  808802:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  808806:	39 f0                	cmp    %esi,%eax
+  808808:	89 d5                	mov    %edx,%ebp
+  80880a:	19 fd                	sbb    %edi,%ebp
+  80880c:	72 af                	jb     8087bd <dm+0x46>
+  80880e:	29 f0                	sub    %esi,%eax
+  808810:	19 fa                	sbb    %edi,%edx
+  808812:	89 cf                	mov    %ecx,%edi
+  808814:	c1 ef 05             	shr    $0x5,%edi
+  808817:	83 e7 01             	and    $0x1,%edi
+  80881a:	89 fe                	mov    %edi,%esi
+  80881c:	83 f6 01             	xor    $0x1,%esi
+  80881f:	d3 e6                	shl    %cl,%esi
+  808821:	d3 e7                	shl    %cl,%edi
+  808823:	09 74 24 18          	or     %esi,0x18(%esp)
+  808827:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80882b:	eb 90                	jmp    8087bd <dm+0x46>
+  80882d:	85 db                	test   %ebx,%ebx
+  80882f:	74 05                	je     808836 <dm+0xbf>
+  808831:	89 03                	mov    %eax,(%ebx)
+  808833:	89 53 04             	mov    %edx,0x4(%ebx)
+  808836:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80883a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80883e:	83 c4 24             	add    $0x24,%esp
+  808841:	5b                   	pop    %ebx
+  808842:	5e                   	pop    %esi
+  808843:	5f                   	pop    %edi
+  808844:	5d                   	pop    %ebp
+  808845:	c3                   	ret
+
+00808846 <__udivdi3>:
+  808846:	83 ec 08             	sub    $0x8,%esp
+  808849:	6a 00                	push   $0x0
+  80884b:	ff 74 24 1c          	push   0x1c(%esp)
+  80884f:	ff 74 24 1c          	push   0x1c(%esp)
+  808853:	8b 44 24 18          	mov    0x18(%esp),%eax
+  808857:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80885b:	e8 17 ff ff ff       	call   808777 <dm>
+  808860:	83 c4 14             	add    $0x14,%esp
+  808863:	c3                   	ret
+
+00808864 <__umoddi3>:
+  808864:	83 ec 18             	sub    $0x18,%esp
+  808867:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80886b:	50                   	push   %eax
+  80886c:	ff 74 24 2c          	push   0x2c(%esp)
+  808870:	ff 74 24 2c          	push   0x2c(%esp)
+  808874:	8b 44 24 28          	mov    0x28(%esp),%eax
+  808878:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80887c:	e8 f6 fe ff ff       	call   808777 <dm>
+  808881:	8b 44 24 18          	mov    0x18(%esp),%eax
+  808885:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  808889:	83 c4 24             	add    $0x24,%esp
+  80888c:	c3                   	ret
+
+0080888d <__divdi3>:
+  80888d:	53                   	push   %ebx
+  80888e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  808892:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  808896:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80889a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80889e:	85 d2                	test   %edx,%edx
+  8088a0:	78 15                	js     8088b7 <__divdi3+0x2a>
+  8088a2:	85 db                	test   %ebx,%ebx
+  8088a4:	78 34                	js     8088da <__divdi3+0x4d>
+  8088a6:	83 ec 04             	sub    $0x4,%esp
+  8088a9:	6a 00                	push   $0x0
+  8088ab:	53                   	push   %ebx
+  8088ac:	51                   	push   %ecx
+  8088ad:	e8 c5 fe ff ff       	call   808777 <dm>
+  8088b2:	83 c4 10             	add    $0x10,%esp
+  8088b5:	eb 21                	jmp    8088d8 <__divdi3+0x4b>
+  8088b7:	f7 d8                	neg    %eax
+  8088b9:	83 d2 00             	adc    $0x0,%edx
+  8088bc:	f7 da                	neg    %edx
+  8088be:	85 db                	test   %ebx,%ebx
+  8088c0:	78 30                	js     8088f2 <__divdi3+0x65>
+  8088c2:	83 ec 04             	sub    $0x4,%esp
+  8088c5:	6a 00                	push   $0x0
+  8088c7:	53                   	push   %ebx
+  8088c8:	51                   	push   %ecx
+  8088c9:	e8 a9 fe ff ff       	call   808777 <dm>
+  8088ce:	83 c4 10             	add    $0x10,%esp
+  8088d1:	f7 d8                	neg    %eax
+  8088d3:	83 d2 00             	adc    $0x0,%edx
+  8088d6:	f7 da                	neg    %edx
+  8088d8:	5b                   	pop    %ebx
+  8088d9:	c3                   	ret
+  8088da:	83 ec 04             	sub    $0x4,%esp
+  8088dd:	6a 00                	push   $0x0
+  8088df:	f7 d9                	neg    %ecx
+  8088e1:	83 d3 00             	adc    $0x0,%ebx
+  8088e4:	f7 db                	neg    %ebx
+  8088e6:	53                   	push   %ebx
+  8088e7:	51                   	push   %ecx
+  8088e8:	e8 8a fe ff ff       	call   808777 <dm>
+  8088ed:	83 c4 10             	add    $0x10,%esp
+  8088f0:	eb df                	jmp    8088d1 <__divdi3+0x44>
+  8088f2:	83 ec 04             	sub    $0x4,%esp
+  8088f5:	6a 00                	push   $0x0
+  8088f7:	f7 d9                	neg    %ecx
+  8088f9:	83 d3 00             	adc    $0x0,%ebx
+  8088fc:	f7 db                	neg    %ebx
+  8088fe:	53                   	push   %ebx
+  8088ff:	51                   	push   %ecx
+  808900:	e8 72 fe ff ff       	call   808777 <dm>
+  808905:	83 c4 10             	add    $0x10,%esp
+  808908:	eb ce                	jmp    8088d8 <__divdi3+0x4b>
+
+0080890a <__moddi3>:
+  80890a:	55                   	push   %ebp
+  80890b:	57                   	push   %edi
+  80890c:	56                   	push   %esi
+  80890d:	53                   	push   %ebx
+  80890e:	83 ec 24             	sub    $0x24,%esp
+  808911:	8b 44 24 38          	mov    0x38(%esp),%eax
+  808915:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  808919:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80891d:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  808921:	85 d2                	test   %edx,%edx
+  808923:	78 3b                	js     808960 <__moddi3+0x56>
+  808925:	83 ec 04             	sub    $0x4,%esp
+  808928:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80892c:	56                   	push   %esi
+  80892d:	89 ce                	mov    %ecx,%esi
+  80892f:	f7 de                	neg    %esi
+  808931:	89 74 24 08          	mov    %esi,0x8(%esp)
+  808935:	89 de                	mov    %ebx,%esi
+  808937:	83 d6 00             	adc    $0x0,%esi
+  80893a:	f7 de                	neg    %esi
+  80893c:	89 74 24 14          	mov    %esi,0x14(%esp)
+  808940:	8b 74 24 08          	mov    0x8(%esp),%esi
+  808944:	0f 48 f1             	cmovs  %ecx,%esi
+  808947:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80894c:	53                   	push   %ebx
+  80894d:	56                   	push   %esi
+  80894e:	e8 24 fe ff ff       	call   808777 <dm>
+  808953:	8b 44 24 28          	mov    0x28(%esp),%eax
+  808957:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80895b:	83 c4 10             	add    $0x10,%esp
+  80895e:	eb 47                	jmp    8089a7 <__moddi3+0x9d>
+  808960:	f7 d8                	neg    %eax
+  808962:	83 d2 00             	adc    $0x0,%edx
+  808965:	f7 da                	neg    %edx
+  808967:	83 ec 04             	sub    $0x4,%esp
+  80896a:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80896e:	56                   	push   %esi
+  80896f:	89 cf                	mov    %ecx,%edi
+  808971:	f7 df                	neg    %edi
+  808973:	89 de                	mov    %ebx,%esi
+  808975:	83 d6 00             	adc    $0x0,%esi
+  808978:	f7 de                	neg    %esi
+  80897a:	0f 49 cf             	cmovns %edi,%ecx
+  80897d:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  808981:	0f 49 de             	cmovns %esi,%ebx
+  808984:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  808988:	ff 74 24 0c          	push   0xc(%esp)
+  80898c:	ff 74 24 0c          	push   0xc(%esp)
+  808990:	e8 e2 fd ff ff       	call   808777 <dm>
+  808995:	8b 44 24 28          	mov    0x28(%esp),%eax
+  808999:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80899d:	f7 d8                	neg    %eax
+  80899f:	83 d2 00             	adc    $0x0,%edx
+  8089a2:	f7 da                	neg    %edx
+  8089a4:	83 c4 10             	add    $0x10,%esp
+  8089a7:	83 c4 24             	add    $0x24,%esp
+  8089aa:	5b                   	pop    %ebx
+  8089ab:	5e                   	pop    %esi
+  8089ac:	5f                   	pop    %edi
+  8089ad:	5d                   	pop    %ebp
+  8089ae:	c3                   	ret
@@ -0,0 +1,17975 @@
+
+obj/kern/kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+f0100000 <_start+0xeffffff4>:
+f0100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+f0100006:	00 00                	add    %al,(%eax)
+f0100008:	fe 4f 52             	decb   0x52(%edi)
+f010000b:	e4                   	.byte 0xe4
+
+f010000c <entry>:
+.globl		_start
+_start = RELOC(entry)
+
+.globl entry
+entry:
+	movw	$0x1234,0x472			# warm boot
+f010000c:	66 c7 05 72 04 00 00 	movw   $0x1234,0x472
+f0100013:	34 12 
+	# sufficient until we set up our real page table in mem_init
+	# in lab 2.
+
+	# Load the physical address of entry_pgdir into cr3.  entry_pgdir
+	# is defined in entrypgdir.c.
+	movl	$(RELOC(entry_pgdir)), %eax
+f0100015:	b8 00 50 11 00       	mov    $0x115000,%eax
+	movl	%eax, %cr3
+f010001a:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging, with page-size-extension enabled.
+	movl	%cr4, %eax
+f010001d:	0f 20 e0             	mov    %cr4,%eax
+	orl	$(CR4_PSE), %eax
+f0100020:	83 c8 10             	or     $0x10,%eax
+	movl	%eax, %cr4
+f0100023:	0f 22 e0             	mov    %eax,%cr4
+	movl	%cr0, %eax
+f0100026:	0f 20 c0             	mov    %cr0,%eax
+	orl	$(CR0_PE|CR0_PG|CR0_WP), %eax
+f0100029:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl	%eax, %cr0
+f010002e:	0f 22 c0             	mov    %eax,%cr0
+
+	# Now paging is enabled, but we're still running at a low EIP
+	# (why is this okay?).  Jump up above KERNBASE before entering
+	# C code.
+	mov	$relocated, %eax
+f0100031:	b8 38 00 10 f0       	mov    $0xf0100038,%eax
+	jmp	*%eax
+f0100036:	ff e0                	jmp    *%eax
+
+f0100038 <relocated>:
+relocated:
+
+	# Clear the frame pointer register (EBP)
+	# so that once we get into debugging C code,
+	# stack backtraces will be terminated properly.
+	movl	$0x0,%ebp			# nuke frame pointer
+f0100038:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Set the stack pointer
+	movl	$(bootstacktop),%esp
+f010003d:	bc 00 50 11 f0       	mov    $0xf0115000,%esp
+
+	# now to C code
+	call	i386_init
+f0100042:	e8 61 00 00 00       	call   f01000a8 <i386_init>
+
+f0100047 <spin>:
+
+	# Should never get here, but in case we do, just spin.
+spin:	jmp	spin
+f0100047:	eb fe                	jmp    f0100047 <spin>
+
+f0100049 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: mesg", and then enters the kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt,...)
+{
+f0100049:	55                   	push   %ebp
+f010004a:	89 e5                	mov    %esp,%ebp
+f010004c:	53                   	push   %ebx
+f010004d:	83 ec 04             	sub    $0x4,%esp
+	va_list ap;
+
+	if (panicstr)
+f0100050:	83 3d 00 c0 7f f0 00 	cmpl   $0x0,0xf07fc000
+f0100057:	74 0f                	je     f0100068 <_panic+0x1f>
+	va_end(ap);
+
+dead:
+	/* break into the kernel monitor */
+	while (1)
+		monitor(NULL);
+f0100059:	83 ec 0c             	sub    $0xc,%esp
+f010005c:	6a 00                	push   $0x0
+f010005e:	e8 c6 0a 00 00       	call   f0100b29 <monitor>
+f0100063:	83 c4 10             	add    $0x10,%esp
+f0100066:	eb f1                	jmp    f0100059 <_panic+0x10>
+	panicstr = fmt;
+f0100068:	8b 45 10             	mov    0x10(%ebp),%eax
+f010006b:	a3 00 c0 7f f0       	mov    %eax,0xf07fc000
+	asm volatile("cli; cld");
+f0100070:	fa                   	cli
+f0100071:	fc                   	cld
+	va_start(ap, fmt);
+f0100072:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel panic on CPU %d at %s:%d: ", cpunum(), file, line);
+f0100075:	e8 79 73 00 00       	call   f01073f3 <cpunum>
+f010007a:	ff 75 0c             	push   0xc(%ebp)
+f010007d:	ff 75 08             	push   0x8(%ebp)
+f0100080:	50                   	push   %eax
+f0100081:	68 80 a9 10 f0       	push   $0xf010a980
+f0100086:	e8 56 43 00 00       	call   f01043e1 <cprintf>
+	vcprintf(fmt, ap);
+f010008b:	83 c4 08             	add    $0x8,%esp
+f010008e:	53                   	push   %ebx
+f010008f:	ff 75 10             	push   0x10(%ebp)
+f0100092:	e8 24 43 00 00       	call   f01043bb <vcprintf>
+	cprintf("\n");
+f0100097:	c7 04 24 6b bd 10 f0 	movl   $0xf010bd6b,(%esp)
+f010009e:	e8 3e 43 00 00       	call   f01043e1 <cprintf>
+f01000a3:	83 c4 10             	add    $0x10,%esp
+f01000a6:	eb b1                	jmp    f0100059 <_panic+0x10>
+
+f01000a8 <i386_init>:
+{
+f01000a8:	55                   	push   %ebp
+f01000a9:	89 e5                	mov    %esp,%ebp
+f01000ab:	53                   	push   %ebx
+f01000ac:	83 ec 04             	sub    $0x4,%esp
+	cons_init();
+f01000af:	e8 ca 05 00 00       	call   f010067e <cons_init>
+	cprintf("\n6828 decimal is %o octal!\n", 6828);
+f01000b4:	83 ec 08             	sub    $0x8,%esp
+f01000b7:	68 ac 1a 00 00       	push   $0x1aac
+f01000bc:	68 ec a9 10 f0       	push   $0xf010a9ec
+f01000c1:	e8 1b 43 00 00       	call   f01043e1 <cprintf>
+	mem_init();
+f01000c6:	e8 e6 1b 00 00       	call   f0101cb1 <mem_init>
+	env_init();
+f01000cb:	e8 1b 3b 00 00       	call   f0103beb <env_init>
+	trap_init();
+f01000d0:	e8 e7 43 00 00       	call   f01044bc <trap_init>
+	mp_init();
+f01000d5:	e8 33 70 00 00       	call   f010710d <mp_init>
+	lapic_init();
+f01000da:	e8 2a 73 00 00       	call   f0107409 <lapic_init>
+	pic_init();
+f01000df:	e8 0c 42 00 00       	call   f01042f0 <pic_init>
+	time_init();
+f01000e4:	e8 18 a6 00 00       	call   f010a701 <time_init>
+	pci_init();
+f01000e9:	e8 f3 a5 00 00       	call   f010a6e1 <pci_init>
+extern struct spinlock kernel_lock;
+
+static inline void
+lock_kernel(void)
+{
+	spin_lock(&kernel_lock);
+f01000ee:	c7 04 24 80 64 11 f0 	movl   $0xf0116480,(%esp)
+f01000f5:	e8 69 75 00 00       	call   f0107663 <spin_lock>
+#define KADDR(pa) _kaddr(__FILE__, __LINE__, pa)
+
+static inline void*
+_kaddr(const char *file, int line, physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f01000fa:	83 c4 10             	add    $0x10,%esp
+f01000fd:	83 3d ac c2 7f f0 07 	cmpl   $0x7,0xf07fc2ac
+f0100104:	76 27                	jbe    f010012d <i386_init+0x85>
+	memmove(code, mpentry_start, mpentry_end - mpentry_start);
+f0100106:	83 ec 04             	sub    $0x4,%esp
+f0100109:	b8 6a 70 10 f0       	mov    $0xf010706a,%eax
+f010010e:	2d e8 6f 10 f0       	sub    $0xf0106fe8,%eax
+f0100113:	50                   	push   %eax
+f0100114:	68 e8 6f 10 f0       	push   $0xf0106fe8
+f0100119:	68 00 70 00 f0       	push   $0xf0007000
+f010011e:	e8 18 6d 00 00       	call   f0106e3b <memmove>
+	for (c = cpus; c < cpus + ncpu; c++) {
+f0100123:	83 c4 10             	add    $0x10,%esp
+f0100126:	bb 20 d0 83 f0       	mov    $0xf083d020,%ebx
+f010012b:	eb 19                	jmp    f0100146 <i386_init+0x9e>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010012d:	68 00 70 00 00       	push   $0x7000
+f0100132:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0100137:	6a 5e                	push   $0x5e
+f0100139:	68 08 aa 10 f0       	push   $0xf010aa08
+f010013e:	e8 06 ff ff ff       	call   f0100049 <_panic>
+f0100143:	83 c3 74             	add    $0x74,%ebx
+f0100146:	6b 05 00 d0 83 f0 74 	imul   $0x74,0xf083d000,%eax
+f010014d:	05 20 d0 83 f0       	add    $0xf083d020,%eax
+f0100152:	39 c3                	cmp    %eax,%ebx
+f0100154:	73 4d                	jae    f01001a3 <i386_init+0xfb>
+		if (c == cpus + cpunum())  // We've started already.
+f0100156:	e8 98 72 00 00       	call   f01073f3 <cpunum>
+f010015b:	6b c0 74             	imul   $0x74,%eax,%eax
+f010015e:	05 20 d0 83 f0       	add    $0xf083d020,%eax
+f0100163:	39 c3                	cmp    %eax,%ebx
+f0100165:	74 dc                	je     f0100143 <i386_init+0x9b>
+		mpentry_kstack = percpu_kstacks[c - cpus] + KSTKSIZE;
+f0100167:	89 d8                	mov    %ebx,%eax
+f0100169:	2d 20 d0 83 f0       	sub    $0xf083d020,%eax
+f010016e:	c1 f8 02             	sar    $0x2,%eax
+f0100171:	69 c0 35 c2 72 4f    	imul   $0x4f72c235,%eax,%eax
+f0100177:	c1 e0 0f             	shl    $0xf,%eax
+f010017a:	8d 80 00 50 80 f0    	lea    -0xf7fb000(%eax),%eax
+f0100180:	a3 04 c0 7f f0       	mov    %eax,0xf07fc004
+		lapic_startap(c->cpu_id, PADDR(code));
+f0100185:	83 ec 08             	sub    $0x8,%esp
+f0100188:	68 00 70 00 00       	push   $0x7000
+f010018d:	0f b6 03             	movzbl (%ebx),%eax
+f0100190:	50                   	push   %eax
+f0100191:	e8 c5 73 00 00       	call   f010755b <lapic_startap>
+		while(c->cpu_status != CPU_STARTED)
+f0100196:	83 c4 10             	add    $0x10,%esp
+f0100199:	8b 43 04             	mov    0x4(%ebx),%eax
+f010019c:	83 f8 01             	cmp    $0x1,%eax
+f010019f:	75 f8                	jne    f0100199 <i386_init+0xf1>
+f01001a1:	eb a0                	jmp    f0100143 <i386_init+0x9b>
+	ENV_CREATE(fs_fs, ENV_TYPE_FS);
+f01001a3:	83 ec 08             	sub    $0x8,%esp
+f01001a6:	6a 01                	push   $0x1
+f01001a8:	68 74 d6 5a f0       	push   $0xf05ad674
+f01001ad:	e8 13 3c 00 00       	call   f0103dc5 <env_create>
+	ENV_CREATE(net_ns, ENV_TYPE_NS);
+f01001b2:	83 c4 08             	add    $0x8,%esp
+f01001b5:	6a 02                	push   $0x2
+f01001b7:	68 d0 bb 6a f0       	push   $0xf06abbd0
+f01001bc:	e8 04 3c 00 00       	call   f0103dc5 <env_create>
+	ENV_CREATE(user_icode, ENV_TYPE_USER);
+f01001c1:	83 c4 08             	add    $0x8,%esp
+f01001c4:	6a 00                	push   $0x0
+f01001c6:	68 44 5a 4c f0       	push   $0xf04c5a44
+f01001cb:	e8 f5 3b 00 00       	call   f0103dc5 <env_create>
+	kbd_intr();
+f01001d0:	e8 55 04 00 00       	call   f010062a <kbd_intr>
+	sched_yield();
+f01001d5:	e8 4a 4b 00 00       	call   f0104d24 <sched_yield>
+
+f01001da <mp_main>:
+{
+f01001da:	55                   	push   %ebp
+f01001db:	89 e5                	mov    %esp,%ebp
+f01001dd:	83 ec 08             	sub    $0x8,%esp
+
+static inline uint32_t
+rcr4(void)
+{
+	uint32_t cr4;
+	asm volatile("movl %%cr4,%0" : "=r" (cr4));
+f01001e0:	0f 20 e0             	mov    %cr4,%eax
+	assert(rcr4() & CR4_PSE);
+f01001e3:	a8 10                	test   $0x10,%al
+f01001e5:	74 5e                	je     f0100245 <mp_main+0x6b>
+	lcr3(PADDR(kern_pgdir));
+f01001e7:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01001ec:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01001f1:	76 68                	jbe    f010025b <mp_main+0x81>
+	return (physaddr_t)kva - KERNBASE;
+f01001f3:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f01001f8:	0f 22 d8             	mov    %eax,%cr3
+	cprintf("SMP: CPU %d starting\n", cpunum());
+f01001fb:	e8 f3 71 00 00       	call   f01073f3 <cpunum>
+f0100200:	83 ec 08             	sub    $0x8,%esp
+f0100203:	50                   	push   %eax
+f0100204:	68 3a aa 10 f0       	push   $0xf010aa3a
+f0100209:	e8 d3 41 00 00       	call   f01043e1 <cprintf>
+	lapic_init();
+f010020e:	e8 f6 71 00 00       	call   f0107409 <lapic_init>
+	env_init_percpu();
+f0100213:	e8 a7 39 00 00       	call   f0103bbf <env_init_percpu>
+	trap_init_percpu();
+f0100218:	e8 d8 41 00 00       	call   f01043f5 <trap_init_percpu>
+	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
+f010021d:	e8 d1 71 00 00       	call   f01073f3 <cpunum>
+f0100222:	6b d0 74             	imul   $0x74,%eax,%edx
+f0100225:	83 c2 04             	add    $0x4,%edx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+f0100228:	b8 01 00 00 00       	mov    $0x1,%eax
+f010022d:	f0 87 82 20 d0 83 f0 	lock xchg %eax,-0xf7c2fe0(%edx)
+f0100234:	c7 04 24 80 64 11 f0 	movl   $0xf0116480,(%esp)
+f010023b:	e8 23 74 00 00       	call   f0107663 <spin_lock>
+	sched_yield();
+f0100240:	e8 df 4a 00 00       	call   f0104d24 <sched_yield>
+	assert(rcr4() & CR4_PSE);
+f0100245:	68 14 aa 10 f0       	push   $0xf010aa14
+f010024a:	68 25 aa 10 f0       	push   $0xf010aa25
+f010024f:	6a 75                	push   $0x75
+f0100251:	68 08 aa 10 f0       	push   $0xf010aa08
+f0100256:	e8 ee fd ff ff       	call   f0100049 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010025b:	50                   	push   %eax
+f010025c:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0100261:	6a 78                	push   $0x78
+f0100263:	68 08 aa 10 f0       	push   $0xf010aa08
+f0100268:	e8 dc fd ff ff       	call   f0100049 <_panic>
+
+f010026d <_warn>:
+}
+
+/* like panic, but don't */
+void
+_warn(const char *file, int line, const char *fmt,...)
+{
+f010026d:	55                   	push   %ebp
+f010026e:	89 e5                	mov    %esp,%ebp
+f0100270:	53                   	push   %ebx
+f0100271:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+
+	va_start(ap, fmt);
+f0100274:	8d 5d 14             	lea    0x14(%ebp),%ebx
+	cprintf("kernel warning at %s:%d: ", file, line);
+f0100277:	ff 75 0c             	push   0xc(%ebp)
+f010027a:	ff 75 08             	push   0x8(%ebp)
+f010027d:	68 50 aa 10 f0       	push   $0xf010aa50
+f0100282:	e8 5a 41 00 00       	call   f01043e1 <cprintf>
+	vcprintf(fmt, ap);
+f0100287:	83 c4 08             	add    $0x8,%esp
+f010028a:	53                   	push   %ebx
+f010028b:	ff 75 10             	push   0x10(%ebp)
+f010028e:	e8 28 41 00 00       	call   f01043bb <vcprintf>
+	cprintf("\n");
+f0100293:	c7 04 24 6b bd 10 f0 	movl   $0xf010bd6b,(%esp)
+f010029a:	e8 42 41 00 00       	call   f01043e1 <cprintf>
+	va_end(ap);
+}
+f010029f:	83 c4 10             	add    $0x10,%esp
+f01002a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01002a5:	c9                   	leave
+f01002a6:	c3                   	ret
+
+f01002a7 <serial_proc_data>:
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01002a7:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f01002ac:	ec                   	in     (%dx),%al
+static bool serial_exists;
+
+static int
+serial_proc_data(void)
+{
+	if (!(inb(COM1+COM_LSR) & COM_LSR_DATA))
+f01002ad:	a8 01                	test   $0x1,%al
+f01002af:	74 0a                	je     f01002bb <serial_proc_data+0x14>
+f01002b1:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01002b6:	ec                   	in     (%dx),%al
+		return -1;
+	return inb(COM1+COM_RX);
+f01002b7:	0f b6 c0             	movzbl %al,%eax
+f01002ba:	c3                   	ret
+		return -1;
+f01002bb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f01002c0:	c3                   	ret
+
+f01002c1 <cons_intr>:
+
+// called by device interrupt routines to feed input characters
+// into the circular console input buffer.
+static void
+cons_intr(int (*proc)(void))
+{
+f01002c1:	55                   	push   %ebp
+f01002c2:	89 e5                	mov    %esp,%ebp
+f01002c4:	53                   	push   %ebx
+f01002c5:	83 ec 04             	sub    $0x4,%esp
+f01002c8:	89 c3                	mov    %eax,%ebx
+	int c;
+
+	while ((c = (*proc)()) != -1) {
+f01002ca:	eb 23                	jmp    f01002ef <cons_intr+0x2e>
+		if (c == 0)
+			continue;
+		cons.buf[cons.wpos++] = c;
+f01002cc:	8b 0d 44 c2 7f f0    	mov    0xf07fc244,%ecx
+f01002d2:	8d 51 01             	lea    0x1(%ecx),%edx
+f01002d5:	88 81 40 c0 7f f0    	mov    %al,-0xf803fc0(%ecx)
+		if (cons.wpos == CONSBUFSIZE)
+f01002db:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+			cons.wpos = 0;
+f01002e1:	b8 00 00 00 00       	mov    $0x0,%eax
+f01002e6:	0f 44 d0             	cmove  %eax,%edx
+f01002e9:	89 15 44 c2 7f f0    	mov    %edx,0xf07fc244
+	while ((c = (*proc)()) != -1) {
+f01002ef:	ff d3                	call   *%ebx
+f01002f1:	83 f8 ff             	cmp    $0xffffffff,%eax
+f01002f4:	74 06                	je     f01002fc <cons_intr+0x3b>
+		if (c == 0)
+f01002f6:	85 c0                	test   %eax,%eax
+f01002f8:	75 d2                	jne    f01002cc <cons_intr+0xb>
+f01002fa:	eb f3                	jmp    f01002ef <cons_intr+0x2e>
+	}
+}
+f01002fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01002ff:	c9                   	leave
+f0100300:	c3                   	ret
+
+f0100301 <kbd_proc_data>:
+{
+f0100301:	55                   	push   %ebp
+f0100302:	89 e5                	mov    %esp,%ebp
+f0100304:	53                   	push   %ebx
+f0100305:	83 ec 04             	sub    $0x4,%esp
+f0100308:	ba 64 00 00 00       	mov    $0x64,%edx
+f010030d:	ec                   	in     (%dx),%al
+	if ((stat & KBS_DIB) == 0)
+f010030e:	a8 01                	test   $0x1,%al
+f0100310:	0f 84 ee 00 00 00    	je     f0100404 <kbd_proc_data+0x103>
+	if (stat & KBS_TERR)
+f0100316:	a8 20                	test   $0x20,%al
+f0100318:	0f 85 ed 00 00 00    	jne    f010040b <kbd_proc_data+0x10a>
+f010031e:	ba 60 00 00 00       	mov    $0x60,%edx
+f0100323:	ec                   	in     (%dx),%al
+f0100324:	89 c2                	mov    %eax,%edx
+	if (data == 0xE0) {
+f0100326:	3c e0                	cmp    $0xe0,%al
+f0100328:	74 61                	je     f010038b <kbd_proc_data+0x8a>
+	} else if (data & 0x80) {
+f010032a:	84 c0                	test   %al,%al
+f010032c:	78 70                	js     f010039e <kbd_proc_data+0x9d>
+	} else if (shift & E0ESC) {
+f010032e:	8b 0d 20 c0 7f f0    	mov    0xf07fc020,%ecx
+f0100334:	f6 c1 40             	test   $0x40,%cl
+f0100337:	74 0e                	je     f0100347 <kbd_proc_data+0x46>
+		data |= 0x80;
+f0100339:	83 c8 80             	or     $0xffffff80,%eax
+f010033c:	89 c2                	mov    %eax,%edx
+		shift &= ~E0ESC;
+f010033e:	83 e1 bf             	and    $0xffffffbf,%ecx
+f0100341:	89 0d 20 c0 7f f0    	mov    %ecx,0xf07fc020
+	shift |= shiftcode[data];
+f0100347:	0f b6 d2             	movzbl %dl,%edx
+f010034a:	0f b6 82 c0 ab 10 f0 	movzbl -0xfef5440(%edx),%eax
+f0100351:	0b 05 20 c0 7f f0    	or     0xf07fc020,%eax
+	shift ^= togglecode[data];
+f0100357:	0f b6 8a c0 aa 10 f0 	movzbl -0xfef5540(%edx),%ecx
+f010035e:	31 c8                	xor    %ecx,%eax
+f0100360:	a3 20 c0 7f f0       	mov    %eax,0xf07fc020
+	c = charcode[shift & (CTL | SHIFT)][data];
+f0100365:	89 c1                	mov    %eax,%ecx
+f0100367:	83 e1 03             	and    $0x3,%ecx
+f010036a:	8b 0c 8d a0 aa 10 f0 	mov    -0xfef5560(,%ecx,4),%ecx
+f0100371:	0f b6 14 11          	movzbl (%ecx,%edx,1),%edx
+f0100375:	0f b6 da             	movzbl %dl,%ebx
+	if (shift & CAPSLOCK) {
+f0100378:	a8 08                	test   $0x8,%al
+f010037a:	74 5d                	je     f01003d9 <kbd_proc_data+0xd8>
+		if ('a' <= c && c <= 'z')
+f010037c:	89 da                	mov    %ebx,%edx
+f010037e:	8d 4b 9f             	lea    -0x61(%ebx),%ecx
+f0100381:	83 f9 19             	cmp    $0x19,%ecx
+f0100384:	77 47                	ja     f01003cd <kbd_proc_data+0xcc>
+			c += 'A' - 'a';
+f0100386:	83 eb 20             	sub    $0x20,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f0100389:	eb 0c                	jmp    f0100397 <kbd_proc_data+0x96>
+		shift |= E0ESC;
+f010038b:	83 0d 20 c0 7f f0 40 	orl    $0x40,0xf07fc020
+		return 0;
+f0100392:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f0100397:	89 d8                	mov    %ebx,%eax
+f0100399:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010039c:	c9                   	leave
+f010039d:	c3                   	ret
+		data = (shift & E0ESC ? data : data & 0x7F);
+f010039e:	8b 0d 20 c0 7f f0    	mov    0xf07fc020,%ecx
+f01003a4:	83 e0 7f             	and    $0x7f,%eax
+f01003a7:	f6 c1 40             	test   $0x40,%cl
+f01003aa:	0f 44 d0             	cmove  %eax,%edx
+		shift &= ~(shiftcode[data] | E0ESC);
+f01003ad:	0f b6 d2             	movzbl %dl,%edx
+f01003b0:	0f b6 82 c0 ab 10 f0 	movzbl -0xfef5440(%edx),%eax
+f01003b7:	83 c8 40             	or     $0x40,%eax
+f01003ba:	0f b6 c0             	movzbl %al,%eax
+f01003bd:	f7 d0                	not    %eax
+f01003bf:	21 c8                	and    %ecx,%eax
+f01003c1:	a3 20 c0 7f f0       	mov    %eax,0xf07fc020
+		return 0;
+f01003c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01003cb:	eb ca                	jmp    f0100397 <kbd_proc_data+0x96>
+		else if ('A' <= c && c <= 'Z')
+f01003cd:	83 ea 41             	sub    $0x41,%edx
+			c += 'a' - 'A';
+f01003d0:	8d 4b 20             	lea    0x20(%ebx),%ecx
+f01003d3:	83 fa 1a             	cmp    $0x1a,%edx
+f01003d6:	0f 42 d9             	cmovb  %ecx,%ebx
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f01003d9:	f7 d0                	not    %eax
+f01003db:	a8 06                	test   $0x6,%al
+f01003dd:	75 b8                	jne    f0100397 <kbd_proc_data+0x96>
+f01003df:	81 fb e9 00 00 00    	cmp    $0xe9,%ebx
+f01003e5:	75 b0                	jne    f0100397 <kbd_proc_data+0x96>
+		cprintf("Rebooting!\n");
+f01003e7:	83 ec 0c             	sub    $0xc,%esp
+f01003ea:	68 6a aa 10 f0       	push   $0xf010aa6a
+f01003ef:	e8 ed 3f 00 00       	call   f01043e1 <cprintf>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01003f4:	b8 03 00 00 00       	mov    $0x3,%eax
+f01003f9:	ba 92 00 00 00       	mov    $0x92,%edx
+f01003fe:	ee                   	out    %al,(%dx)
+}
+f01003ff:	83 c4 10             	add    $0x10,%esp
+f0100402:	eb 93                	jmp    f0100397 <kbd_proc_data+0x96>
+		return -1;
+f0100404:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f0100409:	eb 8c                	jmp    f0100397 <kbd_proc_data+0x96>
+		return -1;
+f010040b:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f0100410:	eb 85                	jmp    f0100397 <kbd_proc_data+0x96>
+
+f0100412 <cons_putc>:
+}
+
+// output a character to the console
+static void
+cons_putc(int c)
+{
+f0100412:	55                   	push   %ebp
+f0100413:	89 e5                	mov    %esp,%ebp
+f0100415:	57                   	push   %edi
+f0100416:	56                   	push   %esi
+f0100417:	53                   	push   %ebx
+f0100418:	83 ec 1c             	sub    $0x1c,%esp
+f010041b:	89 c7                	mov    %eax,%edi
+	for (i = 0;
+f010041d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100422:	be fd 03 00 00       	mov    $0x3fd,%esi
+f0100427:	b9 84 00 00 00       	mov    $0x84,%ecx
+f010042c:	89 f2                	mov    %esi,%edx
+f010042e:	ec                   	in     (%dx),%al
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+f010042f:	a8 20                	test   $0x20,%al
+f0100431:	75 13                	jne    f0100446 <cons_putc+0x34>
+f0100433:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f0100439:	7f 0b                	jg     f0100446 <cons_putc+0x34>
+f010043b:	89 ca                	mov    %ecx,%edx
+f010043d:	ec                   	in     (%dx),%al
+f010043e:	ec                   	in     (%dx),%al
+f010043f:	ec                   	in     (%dx),%al
+f0100440:	ec                   	in     (%dx),%al
+	     i++)
+f0100441:	83 c3 01             	add    $0x1,%ebx
+f0100444:	eb e6                	jmp    f010042c <cons_putc+0x1a>
+	outb(COM1 + COM_TX, c);
+f0100446:	89 f8                	mov    %edi,%eax
+f0100448:	88 45 e7             	mov    %al,-0x19(%ebp)
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010044b:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100450:	ee                   	out    %al,(%dx)
+	for (i = 0; !(inb(0x378+1) & 0x80) && i < 12800; i++)
+f0100451:	bb 00 00 00 00       	mov    $0x0,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100456:	be 79 03 00 00       	mov    $0x379,%esi
+f010045b:	b9 84 00 00 00       	mov    $0x84,%ecx
+f0100460:	89 f2                	mov    %esi,%edx
+f0100462:	ec                   	in     (%dx),%al
+f0100463:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f0100469:	7f 0f                	jg     f010047a <cons_putc+0x68>
+f010046b:	84 c0                	test   %al,%al
+f010046d:	78 0b                	js     f010047a <cons_putc+0x68>
+f010046f:	89 ca                	mov    %ecx,%edx
+f0100471:	ec                   	in     (%dx),%al
+f0100472:	ec                   	in     (%dx),%al
+f0100473:	ec                   	in     (%dx),%al
+f0100474:	ec                   	in     (%dx),%al
+f0100475:	83 c3 01             	add    $0x1,%ebx
+f0100478:	eb e6                	jmp    f0100460 <cons_putc+0x4e>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010047a:	ba 78 03 00 00       	mov    $0x378,%edx
+f010047f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+f0100483:	ee                   	out    %al,(%dx)
+f0100484:	ba 7a 03 00 00       	mov    $0x37a,%edx
+f0100489:	b8 0d 00 00 00       	mov    $0xd,%eax
+f010048e:	ee                   	out    %al,(%dx)
+f010048f:	b8 08 00 00 00       	mov    $0x8,%eax
+f0100494:	ee                   	out    %al,(%dx)
+		c |= 0x0700;
+f0100495:	89 f8                	mov    %edi,%eax
+f0100497:	80 cc 07             	or     $0x7,%ah
+f010049a:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+f01004a0:	0f 42 f8             	cmovb  %eax,%edi
+	switch (c & 0xff) {
+f01004a3:	89 f8                	mov    %edi,%eax
+f01004a5:	0f b6 c0             	movzbl %al,%eax
+f01004a8:	89 fb                	mov    %edi,%ebx
+f01004aa:	80 fb 0a             	cmp    $0xa,%bl
+f01004ad:	0f 84 e1 00 00 00    	je     f0100594 <cons_putc+0x182>
+f01004b3:	83 f8 0a             	cmp    $0xa,%eax
+f01004b6:	7f 46                	jg     f01004fe <cons_putc+0xec>
+f01004b8:	83 f8 08             	cmp    $0x8,%eax
+f01004bb:	0f 84 a7 00 00 00    	je     f0100568 <cons_putc+0x156>
+f01004c1:	83 f8 09             	cmp    $0x9,%eax
+f01004c4:	0f 85 d7 00 00 00    	jne    f01005a1 <cons_putc+0x18f>
+		cons_putc(' ');
+f01004ca:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004cf:	e8 3e ff ff ff       	call   f0100412 <cons_putc>
+		cons_putc(' ');
+f01004d4:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004d9:	e8 34 ff ff ff       	call   f0100412 <cons_putc>
+		cons_putc(' ');
+f01004de:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004e3:	e8 2a ff ff ff       	call   f0100412 <cons_putc>
+		cons_putc(' ');
+f01004e8:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004ed:	e8 20 ff ff ff       	call   f0100412 <cons_putc>
+		cons_putc(' ');
+f01004f2:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004f7:	e8 16 ff ff ff       	call   f0100412 <cons_putc>
+		break;
+f01004fc:	eb 25                	jmp    f0100523 <cons_putc+0x111>
+	switch (c & 0xff) {
+f01004fe:	83 f8 0d             	cmp    $0xd,%eax
+f0100501:	0f 85 9a 00 00 00    	jne    f01005a1 <cons_putc+0x18f>
+		crt_pos -= (crt_pos % CRT_COLS);
+f0100507:	0f b7 05 48 c2 7f f0 	movzwl 0xf07fc248,%eax
+f010050e:	69 c0 cd cc 00 00    	imul   $0xcccd,%eax,%eax
+f0100514:	c1 e8 16             	shr    $0x16,%eax
+f0100517:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f010051a:	c1 e0 04             	shl    $0x4,%eax
+f010051d:	66 a3 48 c2 7f f0    	mov    %ax,0xf07fc248
+	if (crt_pos >= CRT_SIZE) {
+f0100523:	66 81 3d 48 c2 7f f0 	cmpw   $0x7cf,0xf07fc248
+f010052a:	cf 07 
+f010052c:	0f 87 92 00 00 00    	ja     f01005c4 <cons_putc+0x1b2>
+	outb(addr_6845, 14);
+f0100532:	8b 0d 50 c2 7f f0    	mov    0xf07fc250,%ecx
+f0100538:	b8 0e 00 00 00       	mov    $0xe,%eax
+f010053d:	89 ca                	mov    %ecx,%edx
+f010053f:	ee                   	out    %al,(%dx)
+	outb(addr_6845 + 1, crt_pos >> 8);
+f0100540:	0f b7 1d 48 c2 7f f0 	movzwl 0xf07fc248,%ebx
+f0100547:	8d 71 01             	lea    0x1(%ecx),%esi
+f010054a:	89 d8                	mov    %ebx,%eax
+f010054c:	66 c1 e8 08          	shr    $0x8,%ax
+f0100550:	89 f2                	mov    %esi,%edx
+f0100552:	ee                   	out    %al,(%dx)
+f0100553:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0100558:	89 ca                	mov    %ecx,%edx
+f010055a:	ee                   	out    %al,(%dx)
+f010055b:	89 d8                	mov    %ebx,%eax
+f010055d:	89 f2                	mov    %esi,%edx
+f010055f:	ee                   	out    %al,(%dx)
+	serial_putc(c);
+	lpt_putc(c);
+	cga_putc(c);
+}
+f0100560:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100563:	5b                   	pop    %ebx
+f0100564:	5e                   	pop    %esi
+f0100565:	5f                   	pop    %edi
+f0100566:	5d                   	pop    %ebp
+f0100567:	c3                   	ret
+		if (crt_pos > 0) {
+f0100568:	0f b7 05 48 c2 7f f0 	movzwl 0xf07fc248,%eax
+f010056f:	66 85 c0             	test   %ax,%ax
+f0100572:	74 be                	je     f0100532 <cons_putc+0x120>
+			crt_pos--;
+f0100574:	83 e8 01             	sub    $0x1,%eax
+f0100577:	66 a3 48 c2 7f f0    	mov    %ax,0xf07fc248
+			crt_buf[crt_pos] = (c & ~0xff) | ' ';
+f010057d:	0f b7 c0             	movzwl %ax,%eax
+f0100580:	66 81 e7 00 ff       	and    $0xff00,%di
+f0100585:	83 cf 20             	or     $0x20,%edi
+f0100588:	8b 15 4c c2 7f f0    	mov    0xf07fc24c,%edx
+f010058e:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+f0100592:	eb 8f                	jmp    f0100523 <cons_putc+0x111>
+		crt_pos += CRT_COLS;
+f0100594:	66 83 05 48 c2 7f f0 	addw   $0x50,0xf07fc248
+f010059b:	50 
+f010059c:	e9 66 ff ff ff       	jmp    f0100507 <cons_putc+0xf5>
+		crt_buf[crt_pos++] = c;		/* write the character */
+f01005a1:	0f b7 05 48 c2 7f f0 	movzwl 0xf07fc248,%eax
+f01005a8:	8d 50 01             	lea    0x1(%eax),%edx
+f01005ab:	66 89 15 48 c2 7f f0 	mov    %dx,0xf07fc248
+f01005b2:	0f b7 c0             	movzwl %ax,%eax
+f01005b5:	8b 15 4c c2 7f f0    	mov    0xf07fc24c,%edx
+f01005bb:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+		break;
+f01005bf:	e9 5f ff ff ff       	jmp    f0100523 <cons_putc+0x111>
+		memmove(crt_buf, crt_buf + CRT_COLS, (CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+f01005c4:	a1 4c c2 7f f0       	mov    0xf07fc24c,%eax
+f01005c9:	83 ec 04             	sub    $0x4,%esp
+f01005cc:	68 00 0f 00 00       	push   $0xf00
+f01005d1:	8d 90 a0 00 00 00    	lea    0xa0(%eax),%edx
+f01005d7:	52                   	push   %edx
+f01005d8:	50                   	push   %eax
+f01005d9:	e8 5d 68 00 00       	call   f0106e3b <memmove>
+			crt_buf[i] = 0x0700 | ' ';
+f01005de:	8b 15 4c c2 7f f0    	mov    0xf07fc24c,%edx
+f01005e4:	8d 82 00 0f 00 00    	lea    0xf00(%edx),%eax
+f01005ea:	81 c2 a0 0f 00 00    	add    $0xfa0,%edx
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f01005f0:	83 c4 10             	add    $0x10,%esp
+f01005f3:	eb 08                	jmp    f01005fd <cons_putc+0x1eb>
+			crt_buf[i] = 0x0700 | ' ';
+f01005f5:	66 c7 00 20 07       	movw   $0x720,(%eax)
+		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f01005fa:	83 c0 02             	add    $0x2,%eax
+f01005fd:	39 d0                	cmp    %edx,%eax
+f01005ff:	75 f4                	jne    f01005f5 <cons_putc+0x1e3>
+		crt_pos -= CRT_COLS;
+f0100601:	66 83 2d 48 c2 7f f0 	subw   $0x50,0xf07fc248
+f0100608:	50 
+f0100609:	e9 24 ff ff ff       	jmp    f0100532 <cons_putc+0x120>
+
+f010060e <serial_intr>:
+	if (serial_exists)
+f010060e:	80 3d 54 c2 7f f0 00 	cmpb   $0x0,0xf07fc254
+f0100615:	75 01                	jne    f0100618 <serial_intr+0xa>
+f0100617:	c3                   	ret
+{
+f0100618:	55                   	push   %ebp
+f0100619:	89 e5                	mov    %esp,%ebp
+f010061b:	83 ec 08             	sub    $0x8,%esp
+		cons_intr(serial_proc_data);
+f010061e:	b8 a7 02 10 f0       	mov    $0xf01002a7,%eax
+f0100623:	e8 99 fc ff ff       	call   f01002c1 <cons_intr>
+}
+f0100628:	c9                   	leave
+f0100629:	c3                   	ret
+
+f010062a <kbd_intr>:
+{
+f010062a:	55                   	push   %ebp
+f010062b:	89 e5                	mov    %esp,%ebp
+f010062d:	83 ec 08             	sub    $0x8,%esp
+	cons_intr(kbd_proc_data);
+f0100630:	b8 01 03 10 f0       	mov    $0xf0100301,%eax
+f0100635:	e8 87 fc ff ff       	call   f01002c1 <cons_intr>
+}
+f010063a:	c9                   	leave
+f010063b:	c3                   	ret
+
+f010063c <cons_getc>:
+{
+f010063c:	55                   	push   %ebp
+f010063d:	89 e5                	mov    %esp,%ebp
+f010063f:	83 ec 08             	sub    $0x8,%esp
+	serial_intr();
+f0100642:	e8 c7 ff ff ff       	call   f010060e <serial_intr>
+	kbd_intr();
+f0100647:	e8 de ff ff ff       	call   f010062a <kbd_intr>
+	if (cons.rpos != cons.wpos) {
+f010064c:	a1 40 c2 7f f0       	mov    0xf07fc240,%eax
+	return 0;
+f0100651:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (cons.rpos != cons.wpos) {
+f0100656:	3b 05 44 c2 7f f0    	cmp    0xf07fc244,%eax
+f010065c:	74 1c                	je     f010067a <cons_getc+0x3e>
+		c = cons.buf[cons.rpos++];
+f010065e:	8d 48 01             	lea    0x1(%eax),%ecx
+f0100661:	0f b6 90 40 c0 7f f0 	movzbl -0xf803fc0(%eax),%edx
+			cons.rpos = 0;
+f0100668:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+f010066d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100672:	0f 45 c1             	cmovne %ecx,%eax
+f0100675:	a3 40 c2 7f f0       	mov    %eax,0xf07fc240
+}
+f010067a:	89 d0                	mov    %edx,%eax
+f010067c:	c9                   	leave
+f010067d:	c3                   	ret
+
+f010067e <cons_init>:
+
+// initialize the console devices
+void
+cons_init(void)
+{
+f010067e:	55                   	push   %ebp
+f010067f:	89 e5                	mov    %esp,%ebp
+f0100681:	57                   	push   %edi
+f0100682:	56                   	push   %esi
+f0100683:	53                   	push   %ebx
+f0100684:	83 ec 0c             	sub    $0xc,%esp
+	was = *cp;
+f0100687:	0f b7 15 00 80 0b f0 	movzwl 0xf00b8000,%edx
+	*cp = (uint16_t) 0xA55A;
+f010068e:	66 c7 05 00 80 0b f0 	movw   $0xa55a,0xf00b8000
+f0100695:	5a a5 
+	if (*cp != 0xA55A) {
+f0100697:	0f b7 05 00 80 0b f0 	movzwl 0xf00b8000,%eax
+f010069e:	bb b4 03 00 00       	mov    $0x3b4,%ebx
+		cp = (uint16_t*) (KERNBASE + MONO_BUF);
+f01006a3:	be 00 00 0b f0       	mov    $0xf00b0000,%esi
+	if (*cp != 0xA55A) {
+f01006a8:	66 3d 5a a5          	cmp    $0xa55a,%ax
+f01006ac:	0f 84 cd 00 00 00    	je     f010077f <cons_init+0x101>
+		addr_6845 = MONO_BASE;
+f01006b2:	89 1d 50 c2 7f f0    	mov    %ebx,0xf07fc250
+f01006b8:	b8 0e 00 00 00       	mov    $0xe,%eax
+f01006bd:	89 da                	mov    %ebx,%edx
+f01006bf:	ee                   	out    %al,(%dx)
+	pos = inb(addr_6845 + 1) << 8;
+f01006c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01006c3:	89 fa                	mov    %edi,%edx
+f01006c5:	ec                   	in     (%dx),%al
+f01006c6:	0f b6 c8             	movzbl %al,%ecx
+f01006c9:	c1 e1 08             	shl    $0x8,%ecx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01006cc:	b8 0f 00 00 00       	mov    $0xf,%eax
+f01006d1:	89 da                	mov    %ebx,%edx
+f01006d3:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01006d4:	89 fa                	mov    %edi,%edx
+f01006d6:	ec                   	in     (%dx),%al
+	crt_buf = (uint16_t*) cp;
+f01006d7:	89 35 4c c2 7f f0    	mov    %esi,0xf07fc24c
+	pos |= inb(addr_6845 + 1);
+f01006dd:	0f b6 c0             	movzbl %al,%eax
+f01006e0:	09 c8                	or     %ecx,%eax
+	crt_pos = pos;
+f01006e2:	66 a3 48 c2 7f f0    	mov    %ax,0xf07fc248
+	kbd_intr();
+f01006e8:	e8 3d ff ff ff       	call   f010062a <kbd_intr>
+	irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_KBD));
+f01006ed:	83 ec 0c             	sub    $0xc,%esp
+f01006f0:	0f b7 05 a8 63 11 f0 	movzwl 0xf01163a8,%eax
+f01006f7:	25 fd ff 00 00       	and    $0xfffd,%eax
+f01006fc:	50                   	push   %eax
+f01006fd:	e8 6b 3b 00 00       	call   f010426d <irq_setmask_8259A>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100702:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0100707:	bb fa 03 00 00       	mov    $0x3fa,%ebx
+f010070c:	89 c8                	mov    %ecx,%eax
+f010070e:	89 da                	mov    %ebx,%edx
+f0100710:	ee                   	out    %al,(%dx)
+f0100711:	bf fb 03 00 00       	mov    $0x3fb,%edi
+f0100716:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+f010071b:	89 fa                	mov    %edi,%edx
+f010071d:	ee                   	out    %al,(%dx)
+f010071e:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0100723:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100728:	ee                   	out    %al,(%dx)
+f0100729:	be f9 03 00 00       	mov    $0x3f9,%esi
+f010072e:	89 c8                	mov    %ecx,%eax
+f0100730:	89 f2                	mov    %esi,%edx
+f0100732:	ee                   	out    %al,(%dx)
+f0100733:	b8 03 00 00 00       	mov    $0x3,%eax
+f0100738:	89 fa                	mov    %edi,%edx
+f010073a:	ee                   	out    %al,(%dx)
+f010073b:	ba fc 03 00 00       	mov    $0x3fc,%edx
+f0100740:	89 c8                	mov    %ecx,%eax
+f0100742:	ee                   	out    %al,(%dx)
+f0100743:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100748:	89 f2                	mov    %esi,%edx
+f010074a:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010074b:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100750:	ec                   	in     (%dx),%al
+f0100751:	89 c1                	mov    %eax,%ecx
+	serial_exists = (inb(COM1+COM_LSR) != 0xFF);
+f0100753:	83 c4 10             	add    $0x10,%esp
+f0100756:	3c ff                	cmp    $0xff,%al
+f0100758:	0f 95 05 54 c2 7f f0 	setne  0xf07fc254
+f010075f:	89 da                	mov    %ebx,%edx
+f0100761:	ec                   	in     (%dx),%al
+f0100762:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100767:	ec                   	in     (%dx),%al
+	if (serial_exists)
+f0100768:	80 f9 ff             	cmp    $0xff,%cl
+f010076b:	75 28                	jne    f0100795 <cons_init+0x117>
+	cga_init();
+	kbd_init();
+	serial_init();
+
+	if (!serial_exists)
+		cprintf("Serial port does not exist!\n");
+f010076d:	83 ec 0c             	sub    $0xc,%esp
+f0100770:	68 76 aa 10 f0       	push   $0xf010aa76
+f0100775:	e8 67 3c 00 00       	call   f01043e1 <cprintf>
+f010077a:	83 c4 10             	add    $0x10,%esp
+}
+f010077d:	eb 37                	jmp    f01007b6 <cons_init+0x138>
+		*cp = was;
+f010077f:	66 89 15 00 80 0b f0 	mov    %dx,0xf00b8000
+f0100786:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+	cp = (uint16_t*) (KERNBASE + CGA_BUF);
+f010078b:	be 00 80 0b f0       	mov    $0xf00b8000,%esi
+f0100790:	e9 1d ff ff ff       	jmp    f01006b2 <cons_init+0x34>
+		irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_SERIAL));
+f0100795:	83 ec 0c             	sub    $0xc,%esp
+f0100798:	0f b7 05 a8 63 11 f0 	movzwl 0xf01163a8,%eax
+f010079f:	25 ef ff 00 00       	and    $0xffef,%eax
+f01007a4:	50                   	push   %eax
+f01007a5:	e8 c3 3a 00 00       	call   f010426d <irq_setmask_8259A>
+	if (!serial_exists)
+f01007aa:	83 c4 10             	add    $0x10,%esp
+f01007ad:	80 3d 54 c2 7f f0 00 	cmpb   $0x0,0xf07fc254
+f01007b4:	74 b7                	je     f010076d <cons_init+0xef>
+}
+f01007b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01007b9:	5b                   	pop    %ebx
+f01007ba:	5e                   	pop    %esi
+f01007bb:	5f                   	pop    %edi
+f01007bc:	5d                   	pop    %ebp
+f01007bd:	c3                   	ret
+
+f01007be <cputchar>:
+
+// `High'-level console I/O.  Used by readline and cprintf.
+
+void
+cputchar(int c)
+{
+f01007be:	55                   	push   %ebp
+f01007bf:	89 e5                	mov    %esp,%ebp
+f01007c1:	83 ec 08             	sub    $0x8,%esp
+	cons_putc(c);
+f01007c4:	8b 45 08             	mov    0x8(%ebp),%eax
+f01007c7:	e8 46 fc ff ff       	call   f0100412 <cons_putc>
+}
+f01007cc:	c9                   	leave
+f01007cd:	c3                   	ret
+
+f01007ce <getchar>:
+
+int
+getchar(void)
+{
+f01007ce:	55                   	push   %ebp
+f01007cf:	89 e5                	mov    %esp,%ebp
+f01007d1:	83 ec 08             	sub    $0x8,%esp
+	int c;
+
+	while ((c = cons_getc()) == 0)
+f01007d4:	e8 63 fe ff ff       	call   f010063c <cons_getc>
+f01007d9:	85 c0                	test   %eax,%eax
+f01007db:	74 f7                	je     f01007d4 <getchar+0x6>
+		/* do nothing */;
+	return c;
+}
+f01007dd:	c9                   	leave
+f01007de:	c3                   	ret
+
+f01007df <iscons>:
+int
+iscons(int fdnum)
+{
+	// used by readline
+	return 1;
+}
+f01007df:	b8 01 00 00 00       	mov    $0x1,%eax
+f01007e4:	c3                   	ret
+
+f01007e5 <mon_help>:
+
+/***** Implementations of basic kernel monitor commands *****/
+
+int
+mon_help(int argc, char **argv, struct Trapframe *tf)
+{
+f01007e5:	55                   	push   %ebp
+f01007e6:	89 e5                	mov    %esp,%ebp
+f01007e8:	83 ec 0c             	sub    $0xc,%esp
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(commands); i++)
+		cprintf("%s - %s\n", commands[i].name, commands[i].desc);
+f01007eb:	68 c0 ac 10 f0       	push   $0xf010acc0
+f01007f0:	68 de ac 10 f0       	push   $0xf010acde
+f01007f5:	68 e3 ac 10 f0       	push   $0xf010ace3
+f01007fa:	e8 e2 3b 00 00       	call   f01043e1 <cprintf>
+f01007ff:	83 c4 0c             	add    $0xc,%esp
+f0100802:	68 e8 ad 10 f0       	push   $0xf010ade8
+f0100807:	68 ec ac 10 f0       	push   $0xf010acec
+f010080c:	68 e3 ac 10 f0       	push   $0xf010ace3
+f0100811:	e8 cb 3b 00 00       	call   f01043e1 <cprintf>
+f0100816:	83 c4 0c             	add    $0xc,%esp
+f0100819:	68 10 ae 10 f0       	push   $0xf010ae10
+f010081e:	68 f5 ac 10 f0       	push   $0xf010acf5
+f0100823:	68 e3 ac 10 f0       	push   $0xf010ace3
+f0100828:	e8 b4 3b 00 00       	call   f01043e1 <cprintf>
+f010082d:	83 c4 0c             	add    $0xc,%esp
+f0100830:	68 30 ae 10 f0       	push   $0xf010ae30
+f0100835:	68 ff ac 10 f0       	push   $0xf010acff
+f010083a:	68 e3 ac 10 f0       	push   $0xf010ace3
+f010083f:	e8 9d 3b 00 00       	call   f01043e1 <cprintf>
+	return 0;
+}
+f0100844:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100849:	c9                   	leave
+f010084a:	c3                   	ret
+
+f010084b <mon_kerninfo>:
+
+int
+mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
+{
+f010084b:	55                   	push   %ebp
+f010084c:	89 e5                	mov    %esp,%ebp
+f010084e:	83 ec 14             	sub    $0x14,%esp
+	extern char _start[], entry[], etext[], edata[], end[];
+
+	cprintf("Special kernel symbols:\n");
+f0100851:	68 05 ad 10 f0       	push   $0xf010ad05
+f0100856:	e8 86 3b 00 00       	call   f01043e1 <cprintf>
+	cprintf("  _start                  %08x (phys)\n", _start);
+f010085b:	83 c4 08             	add    $0x8,%esp
+f010085e:	68 0c 00 10 00       	push   $0x10000c
+f0100863:	68 5c ae 10 f0       	push   $0xf010ae5c
+f0100868:	e8 74 3b 00 00       	call   f01043e1 <cprintf>
+	cprintf("  entry  %08x (virt)  %08x (phys)\n", entry, entry - KERNBASE);
+f010086d:	83 c4 0c             	add    $0xc,%esp
+f0100870:	68 0c 00 10 00       	push   $0x10000c
+f0100875:	68 0c 00 10 f0       	push   $0xf010000c
+f010087a:	68 84 ae 10 f0       	push   $0xf010ae84
+f010087f:	e8 5d 3b 00 00       	call   f01043e1 <cprintf>
+	cprintf("  etext  %08x (virt)  %08x (phys)\n", etext, etext - KERNBASE);
+f0100884:	83 c4 0c             	add    $0xc,%esp
+f0100887:	68 7d a9 10 00       	push   $0x10a97d
+f010088c:	68 7d a9 10 f0       	push   $0xf010a97d
+f0100891:	68 a8 ae 10 f0       	push   $0xf010aea8
+f0100896:	e8 46 3b 00 00       	call   f01043e1 <cprintf>
+	cprintf("  edata  %08x (virt)  %08x (phys)\n", edata, edata - KERNBASE);
+f010089b:	83 c4 0c             	add    $0xc,%esp
+f010089e:	68 00 b0 7f 00       	push   $0x7fb000
+f01008a3:	68 00 b0 7f f0       	push   $0xf07fb000
+f01008a8:	68 cc ae 10 f0       	push   $0xf010aecc
+f01008ad:	e8 2f 3b 00 00       	call   f01043e1 <cprintf>
+	cprintf("  end    %08x (virt)  %08x (phys)\n", end, end - KERNBASE);
+f01008b2:	83 c4 0c             	add    $0xc,%esp
+f01008b5:	68 1c 80 84 00       	push   $0x84801c
+f01008ba:	68 1c 80 84 f0       	push   $0xf084801c
+f01008bf:	68 f0 ae 10 f0       	push   $0xf010aef0
+f01008c4:	e8 18 3b 00 00       	call   f01043e1 <cprintf>
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f01008c9:	83 c4 08             	add    $0x8,%esp
+		ROUNDUP(end - entry, 1024) / 1024);
+f01008cc:	b8 1c 80 84 f0       	mov    $0xf084801c,%eax
+f01008d1:	2d 0d fc 0f f0       	sub    $0xf00ffc0d,%eax
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f01008d6:	c1 f8 0a             	sar    $0xa,%eax
+f01008d9:	50                   	push   %eax
+f01008da:	68 14 af 10 f0       	push   $0xf010af14
+f01008df:	e8 fd 3a 00 00       	call   f01043e1 <cprintf>
+	return 0;
+}
+f01008e4:	b8 00 00 00 00       	mov    $0x0,%eax
+f01008e9:	c9                   	leave
+f01008ea:	c3                   	ret
+
+f01008eb <mon_backtrace>:
+
+int
+mon_backtrace(int argc, char **argv, struct Trapframe *tf)
+{
+f01008eb:	55                   	push   %ebp
+f01008ec:	89 e5                	mov    %esp,%ebp
+f01008ee:	57                   	push   %edi
+f01008ef:	56                   	push   %esi
+f01008f0:	53                   	push   %ebx
+f01008f1:	83 ec 48             	sub    $0x48,%esp
+	asm volatile("movl %%ebp,%0" : "=r" (ebp));
+f01008f4:	89 eb                	mov    %ebp,%ebx
+	// Your code here.
+	uint32_t ebp = read_ebp();
+	struct Eipdebuginfo info;
+	int narg = 3;
+
+	cprintf("Stack backtrace:\n");
+f01008f6:	68 1e ad 10 f0       	push   $0xf010ad1e
+f01008fb:	e8 e1 3a 00 00       	call   f01043e1 <cprintf>
+	while (ebp != 0) {
+f0100900:	83 c4 10             	add    $0x10,%esp
+	int narg = 3;
+f0100903:	bf 03 00 00 00       	mov    $0x3,%edi
+	while (ebp != 0) {
+f0100908:	eb 5d                	jmp    f0100967 <mon_backtrace+0x7c>
+		cprintf("  ebp %08x  eip %08x  args", ebp, retaddr);
+		if (narg == 0)
+			cprintf(" (void)");
+		else
+			for (int i = 0; i < narg; i++)
+				cprintf(" %08x", fp[i + 2]);
+f010090a:	83 ec 08             	sub    $0x8,%esp
+f010090d:	ff 33                	push   (%ebx)
+f010090f:	68 53 ad 10 f0       	push   $0xf010ad53
+f0100914:	e8 c8 3a 00 00       	call   f01043e1 <cprintf>
+			for (int i = 0; i < narg; i++)
+f0100919:	83 c6 01             	add    $0x1,%esi
+f010091c:	83 c3 04             	add    $0x4,%ebx
+f010091f:	83 c4 10             	add    $0x10,%esp
+f0100922:	39 f7                	cmp    %esi,%edi
+f0100924:	7f e4                	jg     f010090a <mon_backtrace+0x1f>
+		assert(!debuginfo_eip(retaddr, &info));
+f0100926:	83 ec 08             	sub    $0x8,%esp
+f0100929:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f010092c:	50                   	push   %eax
+f010092d:	ff 75 c4             	push   -0x3c(%ebp)
+f0100930:	e8 2e 5a 00 00       	call   f0106363 <debuginfo_eip>
+f0100935:	83 c4 10             	add    $0x10,%esp
+f0100938:	85 c0                	test   %eax,%eax
+f010093a:	75 68                	jne    f01009a4 <mon_backtrace+0xb9>
+		cprintf("\n    %s:%d: %.*s+%d\n", info.eip_file, info.eip_line,
+f010093c:	83 ec 08             	sub    $0x8,%esp
+f010093f:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0100942:	2b 45 e0             	sub    -0x20(%ebp),%eax
+f0100945:	50                   	push   %eax
+f0100946:	ff 75 d8             	push   -0x28(%ebp)
+f0100949:	ff 75 dc             	push   -0x24(%ebp)
+f010094c:	ff 75 d4             	push   -0x2c(%ebp)
+f010094f:	ff 75 d0             	push   -0x30(%ebp)
+f0100952:	68 68 ad 10 f0       	push   $0xf010ad68
+f0100957:	e8 85 3a 00 00       	call   f01043e1 <cprintf>
+			info.eip_fn_namelen, info.eip_fn_name,
+			retaddr - info.eip_fn_addr);
+		narg = info.eip_fn_narg;
+f010095c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		ebp = fp[0];
+f010095f:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0100962:	8b 18                	mov    (%eax),%ebx
+f0100964:	83 c4 20             	add    $0x20,%esp
+	while (ebp != 0) {
+f0100967:	85 db                	test   %ebx,%ebx
+f0100969:	74 4f                	je     f01009ba <mon_backtrace+0xcf>
+		uint32_t *fp = (uint32_t *) ebp;
+f010096b:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+		uint32_t retaddr = fp[1];
+f010096e:	8b 43 04             	mov    0x4(%ebx),%eax
+f0100971:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+		cprintf("  ebp %08x  eip %08x  args", ebp, retaddr);
+f0100974:	83 ec 04             	sub    $0x4,%esp
+f0100977:	50                   	push   %eax
+f0100978:	53                   	push   %ebx
+f0100979:	68 30 ad 10 f0       	push   $0xf010ad30
+f010097e:	e8 5e 3a 00 00       	call   f01043e1 <cprintf>
+		if (narg == 0)
+f0100983:	83 c4 10             	add    $0x10,%esp
+f0100986:	83 c3 08             	add    $0x8,%ebx
+			for (int i = 0; i < narg; i++)
+f0100989:	be 00 00 00 00       	mov    $0x0,%esi
+		if (narg == 0)
+f010098e:	85 ff                	test   %edi,%edi
+f0100990:	75 90                	jne    f0100922 <mon_backtrace+0x37>
+			cprintf(" (void)");
+f0100992:	83 ec 0c             	sub    $0xc,%esp
+f0100995:	68 4b ad 10 f0       	push   $0xf010ad4b
+f010099a:	e8 42 3a 00 00       	call   f01043e1 <cprintf>
+f010099f:	83 c4 10             	add    $0x10,%esp
+f01009a2:	eb 82                	jmp    f0100926 <mon_backtrace+0x3b>
+		assert(!debuginfo_eip(retaddr, &info));
+f01009a4:	68 40 af 10 f0       	push   $0xf010af40
+f01009a9:	68 25 aa 10 f0       	push   $0xf010aa25
+f01009ae:	6a 50                	push   $0x50
+f01009b0:	68 59 ad 10 f0       	push   $0xf010ad59
+f01009b5:	e8 8f f6 ff ff       	call   f0100049 <_panic>
+	}
+	return 0;
+}
+f01009ba:	b8 00 00 00 00       	mov    $0x0,%eax
+f01009bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01009c2:	5b                   	pop    %ebx
+f01009c3:	5e                   	pop    %esi
+f01009c4:	5f                   	pop    %edi
+f01009c5:	5d                   	pop    %ebp
+f01009c6:	c3                   	ret
+
+f01009c7 <mon_e1000>:
+
+int
+mon_e1000(int argc, char **argv, struct Trapframe *tf)
+{
+f01009c7:	55                   	push   %ebp
+f01009c8:	89 e5                	mov    %esp,%ebp
+f01009ca:	53                   	push   %ebx
+f01009cb:	83 ec 14             	sub    $0x14,%esp
+f01009ce:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct e1000_tunables *t = &e1000_tunables;
+	struct e1000_stats *s = &e1000_stats;
+	char *end;
+	long v;
+
+	if (argc == 3) {
+f01009d1:	83 f8 03             	cmp    $0x3,%eax
+f01009d4:	74 79                	je     f0100a4f <mon_e1000+0x88>
+		else if (strcmp(argv[1], "poll") == 0)
+			t->poll = v != 0;
+		else
+			goto usage;
+		e1000_tune();
+	} else if (argc != 1)
+f01009d6:	83 f8 01             	cmp    $0x1,%eax
+f01009d9:	0f 85 99 00 00 00    	jne    f0100a78 <mon_e1000+0xb1>
+		goto usage;
+
+	cprintf("poll %d  itr %u  rdtr %u  radv %u\n",
+f01009df:	83 ec 0c             	sub    $0xc,%esp
+f01009e2:	ff 35 c0 64 11 f0    	push   0xf01164c0
+f01009e8:	ff 35 bc 64 11 f0    	push   0xf01164bc
+f01009ee:	ff 35 b8 64 11 f0    	push   0xf01164b8
+f01009f4:	0f b6 05 b4 64 11 f0 	movzbl 0xf01164b4,%eax
+f01009fb:	50                   	push   %eax
+f01009fc:	68 60 af 10 f0       	push   $0xf010af60
+f0100a01:	e8 db 39 00 00       	call   f01043e1 <cprintf>
+		t->poll, t->itr, t->rdtr, t->radv);
+	cprintf("interrupts %u (rx %u, tx %u)  rearmed rx %u, tx %u\n",
+f0100a06:	83 c4 18             	add    $0x18,%esp
+f0100a09:	ff 35 f8 d3 83 f0    	push   0xf083d3f8
+f0100a0f:	ff 35 f4 d3 83 f0    	push   0xf083d3f4
+f0100a15:	ff 35 e8 d3 83 f0    	push   0xf083d3e8
+f0100a1b:	ff 35 e4 d3 83 f0    	push   0xf083d3e4
+f0100a21:	ff 35 e0 d3 83 f0    	push   0xf083d3e0
+f0100a27:	68 84 af 10 f0       	push   $0xf010af84
+f0100a2c:	e8 b0 39 00 00       	call   f01043e1 <cprintf>
+		s->intrs, s->rx_intrs, s->tx_intrs, s->rx_rearms, s->tx_rearms);
+	cprintf("rx polls %u, %u packets\n", s->rx_polls, s->rx_packets);
+f0100a31:	83 c4 1c             	add    $0x1c,%esp
+f0100a34:	ff 35 f0 d3 83 f0    	push   0xf083d3f0
+f0100a3a:	ff 35 ec d3 83 f0    	push   0xf083d3ec
+f0100a40:	68 90 ad 10 f0       	push   $0xf010ad90
+f0100a45:	e8 97 39 00 00       	call   f01043e1 <cprintf>
+	return 0;
+f0100a4a:	83 c4 10             	add    $0x10,%esp
+f0100a4d:	eb 39                	jmp    f0100a88 <mon_e1000+0xc1>
+		v = strtol(argv[2], &end, 0);
+f0100a4f:	83 ec 04             	sub    $0x4,%esp
+f0100a52:	6a 00                	push   $0x0
+f0100a54:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0100a57:	50                   	push   %eax
+f0100a58:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100a5b:	ff 70 08             	push   0x8(%eax)
+f0100a5e:	e8 a6 64 00 00       	call   f0106f09 <strtol>
+f0100a63:	89 c3                	mov    %eax,%ebx
+		if (*end || v < 0 || v > 0xFFFF)
+f0100a65:	83 c4 10             	add    $0x10,%esp
+f0100a68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0100a6b:	80 38 00             	cmpb   $0x0,(%eax)
+f0100a6e:	75 08                	jne    f0100a78 <mon_e1000+0xb1>
+f0100a70:	81 fb ff ff 00 00    	cmp    $0xffff,%ebx
+f0100a76:	76 1a                	jbe    f0100a92 <mon_e1000+0xcb>
+
+usage:
+	cprintf("usage: e1000 [itr|rdtr|radv|poll value]\n");
+f0100a78:	83 ec 0c             	sub    $0xc,%esp
+f0100a7b:	68 b8 af 10 f0       	push   $0xf010afb8
+f0100a80:	e8 5c 39 00 00       	call   f01043e1 <cprintf>
+	return 0;
+f0100a85:	83 c4 10             	add    $0x10,%esp
+}
+f0100a88:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100a8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100a90:	c9                   	leave
+f0100a91:	c3                   	ret
+		if (strcmp(argv[1], "itr") == 0)
+f0100a92:	83 ec 08             	sub    $0x8,%esp
+f0100a95:	68 7d ad 10 f0       	push   $0xf010ad7d
+f0100a9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100a9d:	ff 70 04             	push   0x4(%eax)
+f0100aa0:	e8 c1 62 00 00       	call   f0106d66 <strcmp>
+f0100aa5:	83 c4 10             	add    $0x10,%esp
+f0100aa8:	85 c0                	test   %eax,%eax
+f0100aaa:	75 10                	jne    f0100abc <mon_e1000+0xf5>
+			t->itr = v;
+f0100aac:	89 1d b8 64 11 f0    	mov    %ebx,0xf01164b8
+		e1000_tune();
+f0100ab2:	e8 25 7e 00 00       	call   f01088dc <e1000_tune>
+f0100ab7:	e9 23 ff ff ff       	jmp    f01009df <mon_e1000+0x18>
+		else if (strcmp(argv[1], "rdtr") == 0)
+f0100abc:	83 ec 08             	sub    $0x8,%esp
+f0100abf:	68 81 ad 10 f0       	push   $0xf010ad81
+f0100ac4:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100ac7:	ff 70 04             	push   0x4(%eax)
+f0100aca:	e8 97 62 00 00       	call   f0106d66 <strcmp>
+f0100acf:	83 c4 10             	add    $0x10,%esp
+f0100ad2:	85 c0                	test   %eax,%eax
+f0100ad4:	75 08                	jne    f0100ade <mon_e1000+0x117>
+			t->rdtr = v;
+f0100ad6:	89 1d bc 64 11 f0    	mov    %ebx,0xf01164bc
+f0100adc:	eb d4                	jmp    f0100ab2 <mon_e1000+0xeb>
+		else if (strcmp(argv[1], "radv") == 0)
+f0100ade:	83 ec 08             	sub    $0x8,%esp
+f0100ae1:	68 86 ad 10 f0       	push   $0xf010ad86
+f0100ae6:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100ae9:	ff 70 04             	push   0x4(%eax)
+f0100aec:	e8 75 62 00 00       	call   f0106d66 <strcmp>
+f0100af1:	83 c4 10             	add    $0x10,%esp
+f0100af4:	85 c0                	test   %eax,%eax
+f0100af6:	75 08                	jne    f0100b00 <mon_e1000+0x139>
+			t->radv = v;
+f0100af8:	89 1d c0 64 11 f0    	mov    %ebx,0xf01164c0
+f0100afe:	eb b2                	jmp    f0100ab2 <mon_e1000+0xeb>
+		else if (strcmp(argv[1], "poll") == 0)
+f0100b00:	83 ec 08             	sub    $0x8,%esp
+f0100b03:	68 8b ad 10 f0       	push   $0xf010ad8b
+f0100b08:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0100b0b:	ff 70 04             	push   0x4(%eax)
+f0100b0e:	e8 53 62 00 00       	call   f0106d66 <strcmp>
+f0100b13:	83 c4 10             	add    $0x10,%esp
+f0100b16:	85 c0                	test   %eax,%eax
+f0100b18:	0f 85 5a ff ff ff    	jne    f0100a78 <mon_e1000+0xb1>
+			t->poll = v != 0;
+f0100b1e:	85 db                	test   %ebx,%ebx
+f0100b20:	0f 95 05 b4 64 11 f0 	setne  0xf01164b4
+f0100b27:	eb 89                	jmp    f0100ab2 <mon_e1000+0xeb>
+
+f0100b29 <monitor>:
+	return 0;
+}
+
+void
+monitor(struct Trapframe *tf)
+{
+f0100b29:	55                   	push   %ebp
+f0100b2a:	89 e5                	mov    %esp,%ebp
+f0100b2c:	57                   	push   %edi
+f0100b2d:	56                   	push   %esi
+f0100b2e:	53                   	push   %ebx
+f0100b2f:	83 ec 58             	sub    $0x58,%esp
+	char *buf;
+
+	cprintf("Welcome to the JOS kernel monitor!\n");
+f0100b32:	68 e4 af 10 f0       	push   $0xf010afe4
+f0100b37:	e8 a5 38 00 00       	call   f01043e1 <cprintf>
+	cprintf("Type 'help' for a list of commands.\n");
+f0100b3c:	c7 04 24 08 b0 10 f0 	movl   $0xf010b008,(%esp)
+f0100b43:	e8 99 38 00 00       	call   f01043e1 <cprintf>
+
+	if (tf != NULL)
+f0100b48:	83 c4 10             	add    $0x10,%esp
+f0100b4b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0100b4f:	74 57                	je     f0100ba8 <monitor+0x7f>
+		print_trapframe(tf);
+f0100b51:	83 ec 0c             	sub    $0xc,%esp
+f0100b54:	ff 75 08             	push   0x8(%ebp)
+f0100b57:	e8 4a 3a 00 00       	call   f01045a6 <print_trapframe>
+f0100b5c:	83 c4 10             	add    $0x10,%esp
+f0100b5f:	eb 47                	jmp    f0100ba8 <monitor+0x7f>
+		while (*buf && strchr(WHITESPACE, *buf))
+f0100b61:	83 ec 08             	sub    $0x8,%esp
+f0100b64:	0f be c0             	movsbl %al,%eax
+f0100b67:	50                   	push   %eax
+f0100b68:	68 ad ad 10 f0       	push   $0xf010adad
+f0100b6d:	e8 55 62 00 00       	call   f0106dc7 <strchr>
+f0100b72:	83 c4 10             	add    $0x10,%esp
+f0100b75:	85 c0                	test   %eax,%eax
+f0100b77:	74 0a                	je     f0100b83 <monitor+0x5a>
+			*buf++ = 0;
+f0100b79:	c6 03 00             	movb   $0x0,(%ebx)
+f0100b7c:	89 f7                	mov    %esi,%edi
+f0100b7e:	8d 5b 01             	lea    0x1(%ebx),%ebx
+f0100b81:	eb 6b                	jmp    f0100bee <monitor+0xc5>
+		if (*buf == 0)
+f0100b83:	80 3b 00             	cmpb   $0x0,(%ebx)
+f0100b86:	74 73                	je     f0100bfb <monitor+0xd2>
+		if (argc == MAXARGS-1) {
+f0100b88:	83 fe 0f             	cmp    $0xf,%esi
+f0100b8b:	74 09                	je     f0100b96 <monitor+0x6d>
+		argv[argc++] = buf;
+f0100b8d:	8d 7e 01             	lea    0x1(%esi),%edi
+f0100b90:	89 5c b5 a8          	mov    %ebx,-0x58(%ebp,%esi,4)
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0100b94:	eb 39                	jmp    f0100bcf <monitor+0xa6>
+			cprintf("Too many arguments (max %d)\n", MAXARGS);
+f0100b96:	83 ec 08             	sub    $0x8,%esp
+f0100b99:	6a 10                	push   $0x10
+f0100b9b:	68 b2 ad 10 f0       	push   $0xf010adb2
+f0100ba0:	e8 3c 38 00 00       	call   f01043e1 <cprintf>
+			return 0;
+f0100ba5:	83 c4 10             	add    $0x10,%esp
+
+	while (1) {
+		buf = readline("K> ");
+f0100ba8:	83 ec 0c             	sub    $0xc,%esp
+f0100bab:	68 a9 ad 10 f0       	push   $0xf010ada9
+f0100bb0:	e8 d7 5f 00 00       	call   f0106b8c <readline>
+f0100bb5:	89 c3                	mov    %eax,%ebx
+		if (buf != NULL)
+f0100bb7:	83 c4 10             	add    $0x10,%esp
+f0100bba:	85 c0                	test   %eax,%eax
+f0100bbc:	74 ea                	je     f0100ba8 <monitor+0x7f>
+	argv[argc] = 0;
+f0100bbe:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+	argc = 0;
+f0100bc5:	be 00 00 00 00       	mov    $0x0,%esi
+f0100bca:	eb 24                	jmp    f0100bf0 <monitor+0xc7>
+			buf++;
+f0100bcc:	83 c3 01             	add    $0x1,%ebx
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0100bcf:	0f b6 03             	movzbl (%ebx),%eax
+f0100bd2:	84 c0                	test   %al,%al
+f0100bd4:	74 18                	je     f0100bee <monitor+0xc5>
+f0100bd6:	83 ec 08             	sub    $0x8,%esp
+f0100bd9:	0f be c0             	movsbl %al,%eax
+f0100bdc:	50                   	push   %eax
+f0100bdd:	68 ad ad 10 f0       	push   $0xf010adad
+f0100be2:	e8 e0 61 00 00       	call   f0106dc7 <strchr>
+f0100be7:	83 c4 10             	add    $0x10,%esp
+f0100bea:	85 c0                	test   %eax,%eax
+f0100bec:	74 de                	je     f0100bcc <monitor+0xa3>
+			*buf++ = 0;
+f0100bee:	89 fe                	mov    %edi,%esi
+		while (*buf && strchr(WHITESPACE, *buf))
+f0100bf0:	0f b6 03             	movzbl (%ebx),%eax
+f0100bf3:	84 c0                	test   %al,%al
+f0100bf5:	0f 85 66 ff ff ff    	jne    f0100b61 <monitor+0x38>
+	argv[argc] = 0;
+f0100bfb:	c7 44 b5 a8 00 00 00 	movl   $0x0,-0x58(%ebp,%esi,4)
+f0100c02:	00 
+	if (argc == 0)
+f0100c03:	85 f6                	test   %esi,%esi
+f0100c05:	74 a1                	je     f0100ba8 <monitor+0x7f>
+	for (i = 0; i < ARRAY_SIZE(commands); i++) {
+f0100c07:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (strcmp(argv[0], commands[i].name) == 0)
+f0100c0c:	83 ec 08             	sub    $0x8,%esp
+f0100c0f:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0100c12:	ff 34 85 40 b0 10 f0 	push   -0xfef4fc0(,%eax,4)
+f0100c19:	ff 75 a8             	push   -0x58(%ebp)
+f0100c1c:	e8 45 61 00 00       	call   f0106d66 <strcmp>
+f0100c21:	83 c4 10             	add    $0x10,%esp
+f0100c24:	85 c0                	test   %eax,%eax
+f0100c26:	74 20                	je     f0100c48 <monitor+0x11f>
+	for (i = 0; i < ARRAY_SIZE(commands); i++) {
+f0100c28:	83 c3 01             	add    $0x1,%ebx
+f0100c2b:	83 fb 04             	cmp    $0x4,%ebx
+f0100c2e:	75 dc                	jne    f0100c0c <monitor+0xe3>
+	cprintf("Unknown command '%s'\n", argv[0]);
+f0100c30:	83 ec 08             	sub    $0x8,%esp
+f0100c33:	ff 75 a8             	push   -0x58(%ebp)
+f0100c36:	68 cf ad 10 f0       	push   $0xf010adcf
+f0100c3b:	e8 a1 37 00 00       	call   f01043e1 <cprintf>
+	return 0;
+f0100c40:	83 c4 10             	add    $0x10,%esp
+f0100c43:	e9 60 ff ff ff       	jmp    f0100ba8 <monitor+0x7f>
+			return commands[i].func(argc, argv, tf);
+f0100c48:	83 ec 04             	sub    $0x4,%esp
+f0100c4b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0100c4e:	ff 75 08             	push   0x8(%ebp)
+f0100c51:	8d 55 a8             	lea    -0x58(%ebp),%edx
+f0100c54:	52                   	push   %edx
+f0100c55:	56                   	push   %esi
+f0100c56:	ff 14 85 48 b0 10 f0 	call   *-0xfef4fb8(,%eax,4)
+			if (runcmd(buf, tf) < 0)
+f0100c5d:	83 c4 10             	add    $0x10,%esp
+f0100c60:	85 c0                	test   %eax,%eax
+f0100c62:	0f 89 40 ff ff ff    	jns    f0100ba8 <monitor+0x7f>
+				break;
+	}
+}
+f0100c68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100c6b:	5b                   	pop    %ebx
+f0100c6c:	5e                   	pop    %esi
+f0100c6d:	5f                   	pop    %edi
+f0100c6e:	5d                   	pop    %ebp
+f0100c6f:	c3                   	ret
+
+f0100c70 <buddy_free_memory_size>:
+//
+// Check that the buddy system works well
+//
+
+static size_t buddy_free_memory_size(void)
+{
+f0100c70:	55                   	push   %ebp
+f0100c71:	89 e5                	mov    %esp,%ebp
+f0100c73:	56                   	push   %esi
+f0100c74:	53                   	push   %ebx
+f0100c75:	b9 00 00 00 00       	mov    $0x0,%ecx
+	size_t free_memory = 0;
+f0100c7a:	ba 00 00 00 00       	mov    $0x0,%edx
+	struct PageInfo *pp;
+
+	for (uint8_t o = 0; o <= BUDDY_MAX_ORDER; o++)
+		for (pp = pool.free_lists[o]; pp; pp = pp->pp_next)
+			free_memory += PGSIZE << o;
+f0100c7f:	be 00 10 00 00       	mov    $0x1000,%esi
+f0100c84:	eb 11                	jmp    f0100c97 <buddy_free_memory_size+0x27>
+f0100c86:	01 da                	add    %ebx,%edx
+		for (pp = pool.free_lists[o]; pp; pp = pp->pp_next)
+f0100c88:	8b 40 04             	mov    0x4(%eax),%eax
+f0100c8b:	85 c0                	test   %eax,%eax
+f0100c8d:	75 f7                	jne    f0100c86 <buddy_free_memory_size+0x16>
+	for (uint8_t o = 0; o <= BUDDY_MAX_ORDER; o++)
+f0100c8f:	83 c1 01             	add    $0x1,%ecx
+f0100c92:	83 f9 0f             	cmp    $0xf,%ecx
+f0100c95:	74 0d                	je     f0100ca4 <buddy_free_memory_size+0x34>
+		for (pp = pool.free_lists[o]; pp; pp = pp->pp_next)
+f0100c97:	8b 04 8d 6c c2 7f f0 	mov    -0xf803d94(,%ecx,4),%eax
+			free_memory += PGSIZE << o;
+f0100c9e:	89 f3                	mov    %esi,%ebx
+f0100ca0:	d3 e3                	shl    %cl,%ebx
+		for (pp = pool.free_lists[o]; pp; pp = pp->pp_next)
+f0100ca2:	eb e7                	jmp    f0100c8b <buddy_free_memory_size+0x1b>
+	return free_memory;
+}
+f0100ca4:	89 d0                	mov    %edx,%eax
+f0100ca6:	5b                   	pop    %ebx
+f0100ca7:	5e                   	pop    %esi
+f0100ca8:	5d                   	pop    %ebp
+f0100ca9:	c3                   	ret
+
+f0100caa <boot_alloc>:
+{
+f0100caa:	55                   	push   %ebp
+f0100cab:	89 e5                	mov    %esp,%ebp
+f0100cad:	83 ec 08             	sub    $0x8,%esp
+	if (!nextfree) {
+f0100cb0:	83 3d b0 c2 7f f0 00 	cmpl   $0x0,0xf07fc2b0
+f0100cb7:	74 2e                	je     f0100ce7 <boot_alloc+0x3d>
+	assert(n <= 2 * PTSIZE - PADDR(nextfree));
+f0100cb9:	8b 15 b0 c2 7f f0    	mov    0xf07fc2b0,%edx
+	if ((uint32_t)kva < KERNBASE)
+f0100cbf:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0100cc5:	76 33                	jbe    f0100cfa <boot_alloc+0x50>
+f0100cc7:	b9 00 00 80 f0       	mov    $0xf0800000,%ecx
+f0100ccc:	29 d1                	sub    %edx,%ecx
+f0100cce:	39 c1                	cmp    %eax,%ecx
+f0100cd0:	72 3a                	jb     f0100d0c <boot_alloc+0x62>
+	nextfree += ROUNDUP(n, PGSIZE);
+f0100cd2:	05 ff 0f 00 00       	add    $0xfff,%eax
+f0100cd7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100cdc:	01 d0                	add    %edx,%eax
+f0100cde:	a3 b0 c2 7f f0       	mov    %eax,0xf07fc2b0
+}
+f0100ce3:	89 d0                	mov    %edx,%eax
+f0100ce5:	c9                   	leave
+f0100ce6:	c3                   	ret
+		nextfree = ROUNDUP((char *) end, PGSIZE);
+f0100ce7:	ba 1b 90 84 f0       	mov    $0xf084901b,%edx
+f0100cec:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0100cf2:	89 15 b0 c2 7f f0    	mov    %edx,0xf07fc2b0
+f0100cf8:	eb bf                	jmp    f0100cb9 <boot_alloc+0xf>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0100cfa:	52                   	push   %edx
+f0100cfb:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0100d00:	6a 6d                	push   $0x6d
+f0100d02:	68 25 ba 10 f0       	push   $0xf010ba25
+f0100d07:	e8 3d f3 ff ff       	call   f0100049 <_panic>
+	assert(n <= 2 * PTSIZE - PADDR(nextfree));
+f0100d0c:	68 70 b0 10 f0       	push   $0xf010b070
+f0100d11:	68 25 aa 10 f0       	push   $0xf010aa25
+f0100d16:	6a 6d                	push   $0x6d
+f0100d18:	68 25 ba 10 f0       	push   $0xf010ba25
+f0100d1d:	e8 27 f3 ff ff       	call   f0100049 <_panic>
+
+f0100d22 <nvram_read>:
+{
+f0100d22:	55                   	push   %ebp
+f0100d23:	89 e5                	mov    %esp,%ebp
+f0100d25:	56                   	push   %esi
+f0100d26:	53                   	push   %ebx
+f0100d27:	89 c3                	mov    %eax,%ebx
+	return mc146818_read(r) | (mc146818_read(r + 1) << 8);
+f0100d29:	83 ec 0c             	sub    $0xc,%esp
+f0100d2c:	50                   	push   %eax
+f0100d2d:	e8 0d 35 00 00       	call   f010423f <mc146818_read>
+f0100d32:	89 c6                	mov    %eax,%esi
+f0100d34:	83 c3 01             	add    $0x1,%ebx
+f0100d37:	89 1c 24             	mov    %ebx,(%esp)
+f0100d3a:	e8 00 35 00 00       	call   f010423f <mc146818_read>
+f0100d3f:	c1 e0 08             	shl    $0x8,%eax
+f0100d42:	09 f0                	or     %esi,%eax
+}
+f0100d44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0100d47:	5b                   	pop    %ebx
+f0100d48:	5e                   	pop    %esi
+f0100d49:	5d                   	pop    %ebp
+f0100d4a:	c3                   	ret
+
+f0100d4b <steal_buddy_memory>:
+
+static struct PageInfo *_free_lists[BUDDY_MAX_ORDER + 1];
+_Static_assert(sizeof(_free_lists) == sizeof(pool.free_lists));
+
+static void steal_buddy_memory(void)
+{
+f0100d4b:	55                   	push   %ebp
+f0100d4c:	89 e5                	mov    %esp,%ebp
+f0100d4e:	83 ec 0c             	sub    $0xc,%esp
+	memcpy(_free_lists, pool.free_lists, sizeof(_free_lists));
+f0100d51:	6a 3c                	push   $0x3c
+f0100d53:	68 6c c2 7f f0       	push   $0xf07fc26c
+f0100d58:	68 c0 c2 7f f0       	push   $0xf07fc2c0
+f0100d5d:	e8 3b 61 00 00       	call   f0106e9d <memcpy>
+	memset(pool.free_lists, 0, sizeof(_free_lists));
+f0100d62:	83 c4 0c             	add    $0xc,%esp
+f0100d65:	6a 3c                	push   $0x3c
+f0100d67:	6a 00                	push   $0x0
+f0100d69:	68 6c c2 7f f0       	push   $0xf07fc26c
+f0100d6e:	e8 93 60 00 00       	call   f0106e06 <memset>
+	for (uint8_t o = 0; o <= BUDDY_MAX_ORDER; o++) {
+f0100d73:	ba c0 c2 7f f0       	mov    $0xf07fc2c0,%edx
+f0100d78:	b9 fc c2 7f f0       	mov    $0xf07fc2fc,%ecx
+f0100d7d:	83 c4 10             	add    $0x10,%esp
+f0100d80:	eb 10                	jmp    f0100d92 <steal_buddy_memory+0x47>
+		struct PageInfo *pp;
+
+		for (pp = _free_lists[o]; pp; pp = pp->pp_next)
+			pp->pp_prev = NULL;
+f0100d82:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		for (pp = _free_lists[o]; pp; pp = pp->pp_next)
+f0100d88:	8b 40 04             	mov    0x4(%eax),%eax
+f0100d8b:	85 c0                	test   %eax,%eax
+f0100d8d:	75 f3                	jne    f0100d82 <steal_buddy_memory+0x37>
+	for (uint8_t o = 0; o <= BUDDY_MAX_ORDER; o++) {
+f0100d8f:	83 c2 04             	add    $0x4,%edx
+f0100d92:	39 ca                	cmp    %ecx,%edx
+f0100d94:	74 04                	je     f0100d9a <steal_buddy_memory+0x4f>
+		for (pp = _free_lists[o]; pp; pp = pp->pp_next)
+f0100d96:	8b 02                	mov    (%edx),%eax
+f0100d98:	eb f1                	jmp    f0100d8b <steal_buddy_memory+0x40>
+	}
+}
+f0100d9a:	c9                   	leave
+f0100d9b:	c3                   	ret
+
+f0100d9c <restore_buddy_memory>:
+
+static void restore_buddy_memory(void)
+{
+f0100d9c:	55                   	push   %ebp
+f0100d9d:	89 e5                	mov    %esp,%ebp
+f0100d9f:	53                   	push   %ebx
+f0100da0:	83 ec 08             	sub    $0x8,%esp
+	memcpy(pool.free_lists, _free_lists, sizeof(_free_lists));
+f0100da3:	6a 3c                	push   $0x3c
+f0100da5:	68 c0 c2 7f f0       	push   $0xf07fc2c0
+f0100daa:	68 6c c2 7f f0       	push   $0xf07fc26c
+f0100daf:	e8 e9 60 00 00       	call   f0106e9d <memcpy>
+	for (uint8_t o = 0; o <= BUDDY_MAX_ORDER; o++) {
+f0100db4:	b9 6c c2 7f f0       	mov    $0xf07fc26c,%ecx
+f0100db9:	bb a8 c2 7f f0       	mov    $0xf07fc2a8,%ebx
+f0100dbe:	83 c4 10             	add    $0x10,%esp
+f0100dc1:	eb 0f                	jmp    f0100dd2 <restore_buddy_memory+0x36>
+		struct PageInfo **pp_prev = &pool.free_lists[o];
+		struct PageInfo *pp;
+
+		for (pp = pool.free_lists[o]; pp; pp = pp->pp_next) {
+			pp->pp_prev = pp_prev;
+f0100dc3:	89 10                	mov    %edx,(%eax)
+			pp_prev = &pp->pp_next;
+f0100dc5:	8d 50 04             	lea    0x4(%eax),%edx
+		for (pp = pool.free_lists[o]; pp; pp = pp->pp_next) {
+f0100dc8:	8b 40 04             	mov    0x4(%eax),%eax
+f0100dcb:	85 c0                	test   %eax,%eax
+f0100dcd:	75 f4                	jne    f0100dc3 <restore_buddy_memory+0x27>
+	for (uint8_t o = 0; o <= BUDDY_MAX_ORDER; o++) {
+f0100dcf:	83 c1 04             	add    $0x4,%ecx
+f0100dd2:	39 d9                	cmp    %ebx,%ecx
+f0100dd4:	74 06                	je     f0100ddc <restore_buddy_memory+0x40>
+		struct PageInfo **pp_prev = &pool.free_lists[o];
+f0100dd6:	89 ca                	mov    %ecx,%edx
+		for (pp = pool.free_lists[o]; pp; pp = pp->pp_next) {
+f0100dd8:	8b 01                	mov    (%ecx),%eax
+f0100dda:	eb ef                	jmp    f0100dcb <restore_buddy_memory+0x2f>
+		}
+	}
+}
+f0100ddc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100ddf:	c9                   	leave
+f0100de0:	c3                   	ret
+
+f0100de1 <check_va2pa>:
+static physaddr_t
+check_va2pa(pde_t *pgdir, uintptr_t va)
+{
+	pte_t *p;
+
+	pgdir = &pgdir[PDX(va)];
+f0100de1:	89 d1                	mov    %edx,%ecx
+f0100de3:	c1 e9 16             	shr    $0x16,%ecx
+	if (!(*pgdir & PTE_P))
+f0100de6:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+f0100de9:	a8 01                	test   $0x1,%al
+f0100deb:	74 63                	je     f0100e50 <check_va2pa+0x6f>
+		return ~0;
+	if (*pgdir & PTE_PS)
+f0100ded:	a8 80                	test   $0x80,%al
+f0100def:	74 0e                	je     f0100dff <check_va2pa+0x1e>
+		return PTE_ADDR(*pgdir) | (PTX(va) << PGSHIFT);
+f0100df1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100df6:	81 e2 00 f0 3f 00    	and    $0x3ff000,%edx
+f0100dfc:	09 d0                	or     %edx,%eax
+f0100dfe:	c3                   	ret
+	p = (pte_t*) KADDR(PTE_ADDR(*pgdir));
+f0100dff:	89 c1                	mov    %eax,%ecx
+f0100e01:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	if (PGNUM(pa) >= npages)
+f0100e07:	c1 e8 0c             	shr    $0xc,%eax
+f0100e0a:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f0100e10:	73 23                	jae    f0100e35 <check_va2pa+0x54>
+	if (!(p[PTX(va)] & PTE_P))
+f0100e12:	c1 ea 0c             	shr    $0xc,%edx
+f0100e15:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+f0100e1b:	8b 94 91 00 00 00 f0 	mov    -0x10000000(%ecx,%edx,4),%edx
+		return ~0;
+	return PTE_ADDR(p[PTX(va)]);
+f0100e22:	89 d0                	mov    %edx,%eax
+f0100e24:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100e29:	f6 c2 01             	test   $0x1,%dl
+f0100e2c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+f0100e31:	0f 44 c2             	cmove  %edx,%eax
+f0100e34:	c3                   	ret
+{
+f0100e35:	55                   	push   %ebp
+f0100e36:	89 e5                	mov    %esp,%ebp
+f0100e38:	83 ec 08             	sub    $0x8,%esp
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100e3b:	51                   	push   %ecx
+f0100e3c:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0100e41:	68 67 04 00 00       	push   $0x467
+f0100e46:	68 25 ba 10 f0       	push   $0xf010ba25
+f0100e4b:	e8 f9 f1 ff ff       	call   f0100049 <_panic>
+		return ~0;
+f0100e50:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f0100e55:	c3                   	ret
+
+f0100e56 <get_buddy_chunk>:
+	if (pp->pp_order == BUDDY_MAX_ORDER)
+f0100e56:	0f b6 50 0a          	movzbl 0xa(%eax),%edx
+f0100e5a:	80 fa 0e             	cmp    $0xe,%dl
+f0100e5d:	0f 84 a5 00 00 00    	je     f0100f08 <get_buddy_chunk+0xb2>
+{
+f0100e63:	55                   	push   %ebp
+f0100e64:	89 e5                	mov    %esp,%ebp
+f0100e66:	56                   	push   %esi
+f0100e67:	53                   	push   %ebx
+void	user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
+
+static inline physaddr_t
+page2pa(struct PageInfo *pp)
+{
+	return (pp - pool.pages) << PGSHIFT;
+f0100e68:	8b 0d 68 c2 7f f0    	mov    0xf07fc268,%ecx
+f0100e6e:	29 c8                	sub    %ecx,%eax
+f0100e70:	c1 f8 02             	sar    $0x2,%eax
+f0100e73:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0100e79:	89 c6                	mov    %eax,%esi
+f0100e7b:	c1 e6 0c             	shl    $0xc,%esi
+	if (PGNUM(pa) >= npages)
+f0100e7e:	8b 1d ac c2 7f f0    	mov    0xf07fc2ac,%ebx
+f0100e84:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0100e89:	39 d8                	cmp    %ebx,%eax
+f0100e8b:	73 40                	jae    f0100ecd <get_buddy_chunk+0x77>
+	buddy_addr = chunk_addr ^ ((uintptr_t) 1 << (pp->pp_order + PGSHIFT));
+f0100e8d:	83 c2 0c             	add    $0xc,%edx
+	return (void *)(pa + KERNBASE);
+f0100e90:	8d 86 00 00 00 f0    	lea    -0x10000000(%esi),%eax
+f0100e96:	0f bb d0             	btc    %edx,%eax
+	if (buddy_addr < pool.start || buddy_addr >= pool.start + pool.size)
+f0100e99:	8b 15 60 c2 7f f0    	mov    0xf07fc260,%edx
+f0100e9f:	39 d0                	cmp    %edx,%eax
+f0100ea1:	72 6b                	jb     f0100f0e <get_buddy_chunk+0xb8>
+f0100ea3:	03 15 64 c2 7f f0    	add    0xf07fc264,%edx
+f0100ea9:	39 d0                	cmp    %edx,%eax
+f0100eab:	73 68                	jae    f0100f15 <get_buddy_chunk+0xbf>
+	if ((uint32_t)kva < KERNBASE)
+f0100ead:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0100eb2:	76 2b                	jbe    f0100edf <get_buddy_chunk+0x89>
+	return (physaddr_t)kva - KERNBASE;
+f0100eb4:	05 00 00 00 10       	add    $0x10000000,%eax
+}
+
+static inline struct PageInfo*
+pa2page(physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f0100eb9:	c1 e8 0c             	shr    $0xc,%eax
+f0100ebc:	39 d8                	cmp    %ebx,%eax
+f0100ebe:	73 34                	jae    f0100ef4 <get_buddy_chunk+0x9e>
+		panic("pa2page called with invalid pa");
+	return &pool.pages[PGNUM(pa)];
+f0100ec0:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0100ec3:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+}
+f0100ec6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0100ec9:	5b                   	pop    %ebx
+f0100eca:	5e                   	pop    %esi
+f0100ecb:	5d                   	pop    %ebp
+f0100ecc:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100ecd:	56                   	push   %esi
+f0100ece:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0100ed3:	6a 5f                	push   $0x5f
+f0100ed5:	68 31 ba 10 f0       	push   $0xf010ba31
+f0100eda:	e8 6a f1 ff ff       	call   f0100049 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0100edf:	50                   	push   %eax
+f0100ee0:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0100ee5:	68 31 01 00 00       	push   $0x131
+f0100eea:	68 25 ba 10 f0       	push   $0xf010ba25
+f0100eef:	e8 55 f1 ff ff       	call   f0100049 <_panic>
+		panic("pa2page called with invalid pa");
+f0100ef4:	83 ec 04             	sub    $0x4,%esp
+f0100ef7:	68 94 b0 10 f0       	push   $0xf010b094
+f0100efc:	6a 58                	push   $0x58
+f0100efe:	68 31 ba 10 f0       	push   $0xf010ba31
+f0100f03:	e8 41 f1 ff ff       	call   f0100049 <_panic>
+		return NULL;
+f0100f08:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0100f0d:	c3                   	ret
+		return NULL;
+f0100f0e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100f13:	eb b1                	jmp    f0100ec6 <get_buddy_chunk+0x70>
+f0100f15:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100f1a:	eb aa                	jmp    f0100ec6 <get_buddy_chunk+0x70>
+
+f0100f1c <check_page_free_list>:
+{
+f0100f1c:	55                   	push   %ebp
+f0100f1d:	89 e5                	mov    %esp,%ebp
+f0100f1f:	57                   	push   %edi
+f0100f20:	56                   	push   %esi
+f0100f21:	53                   	push   %ebx
+f0100f22:	83 ec 4c             	sub    $0x4c,%esp
+	unsigned pdx_limit = only_low_memory ? 2 : NPDENTRIES;
+f0100f25:	3c 01                	cmp    $0x1,%al
+f0100f27:	19 f6                	sbb    %esi,%esi
+f0100f29:	81 e6 fe 03 00 00    	and    $0x3fe,%esi
+f0100f2f:	83 c6 02             	add    $0x2,%esi
+	void *first_free_page = boot_alloc(0);
+f0100f32:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100f37:	e8 6e fd ff ff       	call   f0100caa <boot_alloc>
+f0100f3c:	89 45 b0             	mov    %eax,-0x50(%ebp)
+	const physaddr_t reserved[] = {
+f0100f3f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+f0100f46:	c7 45 d8 00 00 0a 00 	movl   $0xa0000,-0x28(%ebp)
+f0100f4d:	c7 45 dc 00 f0 0f 00 	movl   $0xff000,-0x24(%ebp)
+f0100f54:	c7 45 e0 00 00 10 00 	movl   $0x100000,-0x20(%ebp)
+f0100f5b:	c7 45 e4 00 70 00 00 	movl   $0x7000,-0x1c(%ebp)
+	for (pp = pool.pages; pp < &pool.pages[npages]; pp++)
+f0100f62:	8b 1d 68 c2 7f f0    	mov    0xf07fc268,%ebx
+			memset(page2kva(pp), 0x97, PGSIZE << pp->pp_order);
+f0100f68:	bf 00 10 00 00       	mov    $0x1000,%edi
+f0100f6d:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	for (pp = pool.pages; pp < &pool.pages[npages]; pp++)
+f0100f70:	eb 15                	jmp    f0100f87 <check_page_free_list+0x6b>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100f72:	50                   	push   %eax
+f0100f73:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0100f78:	6a 5f                	push   $0x5f
+f0100f7a:	68 31 ba 10 f0       	push   $0xf010ba31
+f0100f7f:	e8 c5 f0 ff ff       	call   f0100049 <_panic>
+f0100f84:	83 c3 0c             	add    $0xc,%ebx
+f0100f87:	8b 0d 68 c2 7f f0    	mov    0xf07fc268,%ecx
+f0100f8d:	8b 15 ac c2 7f f0    	mov    0xf07fc2ac,%edx
+f0100f93:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f0100f96:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+f0100f99:	39 c3                	cmp    %eax,%ebx
+f0100f9b:	73 4d                	jae    f0100fea <check_page_free_list+0xce>
+		if (pp->pp_prev != NULL && PDX(page2pa(pp)) < pdx_limit)
+f0100f9d:	83 3b 00             	cmpl   $0x0,(%ebx)
+f0100fa0:	74 e2                	je     f0100f84 <check_page_free_list+0x68>
+	return (pp - pool.pages) << PGSHIFT;
+f0100fa2:	89 d8                	mov    %ebx,%eax
+f0100fa4:	29 c8                	sub    %ecx,%eax
+f0100fa6:	c1 f8 02             	sar    $0x2,%eax
+f0100fa9:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0100faf:	c1 e0 0c             	shl    $0xc,%eax
+f0100fb2:	89 c1                	mov    %eax,%ecx
+f0100fb4:	c1 e9 16             	shr    $0x16,%ecx
+f0100fb7:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+f0100fba:	39 f1                	cmp    %esi,%ecx
+f0100fbc:	73 c6                	jae    f0100f84 <check_page_free_list+0x68>
+			memset(page2kva(pp), 0x97, PGSIZE << pp->pp_order);
+f0100fbe:	0f b6 4b 0a          	movzbl 0xa(%ebx),%ecx
+f0100fc2:	89 fe                	mov    %edi,%esi
+f0100fc4:	d3 e6                	shl    %cl,%esi
+f0100fc6:	89 f1                	mov    %esi,%ecx
+	if (PGNUM(pa) >= npages)
+f0100fc8:	89 c6                	mov    %eax,%esi
+f0100fca:	c1 ee 0c             	shr    $0xc,%esi
+f0100fcd:	39 d6                	cmp    %edx,%esi
+f0100fcf:	73 a1                	jae    f0100f72 <check_page_free_list+0x56>
+f0100fd1:	83 ec 04             	sub    $0x4,%esp
+f0100fd4:	51                   	push   %ecx
+f0100fd5:	68 97 00 00 00       	push   $0x97
+	return (void *)(pa + KERNBASE);
+f0100fda:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0100fdf:	50                   	push   %eax
+f0100fe0:	e8 21 5e 00 00       	call   f0106e06 <memset>
+f0100fe5:	83 c4 10             	add    $0x10,%esp
+f0100fe8:	eb 9a                	jmp    f0100f84 <check_page_free_list+0x68>
+	for (pp = pool.pages; pp < &pool.pages[npages]; pp++)
+f0100fea:	89 ce                	mov    %ecx,%esi
+f0100fec:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+f0100fef:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+f0100ff2:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+	int nfree_basemem = 0, nfree_extmem = 0;
+f0100ff5:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%ebp)
+f0100ffc:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%ebp)
+f0101003:	8d 7d e8             	lea    -0x18(%ebp),%edi
+f0101006:	eb 0f                	jmp    f0101017 <check_page_free_list+0xfb>
+		assert(end < EXTPHYSMEM || KADDR(start) >= first_free_page);
+f0101008:	81 f9 ff ff 0f 00    	cmp    $0xfffff,%ecx
+f010100e:	77 66                	ja     f0101076 <check_page_free_list+0x15a>
+			++nfree_basemem;
+f0101010:	83 45 bc 01          	addl   $0x1,-0x44(%ebp)
+	for (pp = pool.pages; pp < &pool.pages[npages]; pp++) {
+f0101014:	83 c6 0c             	add    $0xc,%esi
+f0101017:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f010101a:	39 c6                	cmp    %eax,%esi
+f010101c:	0f 83 a4 00 00 00    	jae    f01010c6 <check_page_free_list+0x1aa>
+		if (pp->pp_prev == NULL)
+f0101022:	83 3e 00             	cmpl   $0x0,(%esi)
+f0101025:	74 ed                	je     f0101014 <check_page_free_list+0xf8>
+	return (pp - pool.pages) << PGSHIFT;
+f0101027:	89 f3                	mov    %esi,%ebx
+f0101029:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f010102c:	29 c3                	sub    %eax,%ebx
+f010102e:	c1 fb 02             	sar    $0x2,%ebx
+f0101031:	69 db ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%ebx
+f0101037:	c1 e3 0c             	shl    $0xc,%ebx
+		physaddr_t end = start + (PGSIZE << pp->pp_order);
+f010103a:	0f b6 4e 0a          	movzbl 0xa(%esi),%ecx
+f010103e:	b8 00 10 00 00       	mov    $0x1000,%eax
+f0101043:	d3 e0                	shl    %cl,%eax
+f0101045:	89 c1                	mov    %eax,%ecx
+f0101047:	01 d9                	add    %ebx,%ecx
+		for (size_t i = 0; i < ARRAY_SIZE(reserved); i++) {
+f0101049:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+f010104c:	39 f8                	cmp    %edi,%eax
+f010104e:	74 b8                	je     f0101008 <check_page_free_list+0xec>
+			assert(!(reserved[i] >= start && reserved[i] < end));
+f0101050:	8b 10                	mov    (%eax),%edx
+f0101052:	83 c0 04             	add    $0x4,%eax
+f0101055:	39 ca                	cmp    %ecx,%edx
+f0101057:	73 f3                	jae    f010104c <check_page_free_list+0x130>
+f0101059:	39 da                	cmp    %ebx,%edx
+f010105b:	72 ef                	jb     f010104c <check_page_free_list+0x130>
+f010105d:	68 b4 b0 10 f0       	push   $0xf010b0b4
+f0101062:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101067:	68 9f 03 00 00       	push   $0x39f
+f010106c:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101071:	e8 d3 ef ff ff       	call   f0100049 <_panic>
+	if (PGNUM(pa) >= npages)
+f0101076:	89 d8                	mov    %ebx,%eax
+f0101078:	c1 e8 0c             	shr    $0xc,%eax
+f010107b:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+f010107e:	39 d0                	cmp    %edx,%eax
+f0101080:	73 16                	jae    f0101098 <check_page_free_list+0x17c>
+	return (void *)(pa + KERNBASE);
+f0101082:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+		assert(end < EXTPHYSMEM || KADDR(start) >= first_free_page);
+f0101088:	8b 45 b0             	mov    -0x50(%ebp),%eax
+f010108b:	39 c3                	cmp    %eax,%ebx
+f010108d:	72 1e                	jb     f01010ad <check_page_free_list+0x191>
+			++nfree_extmem;
+f010108f:	83 45 b8 01          	addl   $0x1,-0x48(%ebp)
+f0101093:	e9 7c ff ff ff       	jmp    f0101014 <check_page_free_list+0xf8>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101098:	53                   	push   %ebx
+f0101099:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f010109e:	68 a1 03 00 00       	push   $0x3a1
+f01010a3:	68 25 ba 10 f0       	push   $0xf010ba25
+f01010a8:	e8 9c ef ff ff       	call   f0100049 <_panic>
+		assert(end < EXTPHYSMEM || KADDR(start) >= first_free_page);
+f01010ad:	68 e4 b0 10 f0       	push   $0xf010b0e4
+f01010b2:	68 25 aa 10 f0       	push   $0xf010aa25
+f01010b7:	68 a1 03 00 00       	push   $0x3a1
+f01010bc:	68 25 ba 10 f0       	push   $0xf010ba25
+f01010c1:	e8 83 ef ff ff       	call   f0100049 <_panic>
+	assert(nfree_basemem > 0);
+f01010c6:	83 7d bc 00          	cmpl   $0x0,-0x44(%ebp)
+f01010ca:	7e 1e                	jle    f01010ea <check_page_free_list+0x1ce>
+	assert(nfree_extmem > 0);
+f01010cc:	83 7d b8 00          	cmpl   $0x0,-0x48(%ebp)
+f01010d0:	7e 31                	jle    f0101103 <check_page_free_list+0x1e7>
+	cprintf("check_page_free_list() succeeded!\n");
+f01010d2:	83 ec 0c             	sub    $0xc,%esp
+f01010d5:	68 18 b1 10 f0       	push   $0xf010b118
+f01010da:	e8 02 33 00 00       	call   f01043e1 <cprintf>
+}
+f01010df:	83 c4 10             	add    $0x10,%esp
+f01010e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01010e5:	5b                   	pop    %ebx
+f01010e6:	5e                   	pop    %esi
+f01010e7:	5f                   	pop    %edi
+f01010e8:	5d                   	pop    %ebp
+f01010e9:	c3                   	ret
+	assert(nfree_basemem > 0);
+f01010ea:	68 3f ba 10 f0       	push   $0xf010ba3f
+f01010ef:	68 25 aa 10 f0       	push   $0xf010aa25
+f01010f4:	68 a9 03 00 00       	push   $0x3a9
+f01010f9:	68 25 ba 10 f0       	push   $0xf010ba25
+f01010fe:	e8 46 ef ff ff       	call   f0100049 <_panic>
+	assert(nfree_extmem > 0);
+f0101103:	68 51 ba 10 f0       	push   $0xf010ba51
+f0101108:	68 25 aa 10 f0       	push   $0xf010aa25
+f010110d:	68 aa 03 00 00       	push   $0x3aa
+f0101112:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101117:	e8 2d ef ff ff       	call   f0100049 <_panic>
+
+f010111c <buddy_get_pages>:
+{
+f010111c:	55                   	push   %ebp
+f010111d:	89 e5                	mov    %esp,%ebp
+f010111f:	57                   	push   %edi
+f0101120:	56                   	push   %esi
+f0101121:	53                   	push   %ebx
+f0101122:	83 ec 0c             	sub    $0xc,%esp
+f0101125:	8b 55 08             	mov    0x8(%ebp),%edx
+f0101128:	89 d7                	mov    %edx,%edi
+	for (uint8_t o = order; o <= BUDDY_MAX_ORDER; o++) {
+f010112a:	0f b6 c2             	movzbl %dl,%eax
+f010112d:	8d 04 85 6c c2 7f f0 	lea    -0xf803d94(,%eax,4),%eax
+f0101134:	89 d1                	mov    %edx,%ecx
+f0101136:	80 f9 0e             	cmp    $0xe,%cl
+f0101139:	0f 87 ed 00 00 00    	ja     f010122c <buddy_get_pages+0x110>
+		if (!pool.free_lists[o])
+f010113f:	83 c0 04             	add    $0x4,%eax
+f0101142:	8b 70 fc             	mov    -0x4(%eax),%esi
+f0101145:	85 f6                	test   %esi,%esi
+f0101147:	74 3b                	je     f0101184 <buddy_get_pages+0x68>
+	struct PageInfo *next_pp = pp->pp_next;
+f0101149:	8b 46 04             	mov    0x4(%esi),%eax
+	assert(pp->pp_prev != NULL);
+f010114c:	8b 0e                	mov    (%esi),%ecx
+f010114e:	85 c9                	test   %ecx,%ecx
+f0101150:	74 37                	je     f0101189 <buddy_get_pages+0x6d>
+	*pp->pp_prev = next_pp;
+f0101152:	89 01                	mov    %eax,(%ecx)
+	if (next_pp)
+f0101154:	85 c0                	test   %eax,%eax
+f0101156:	74 04                	je     f010115c <buddy_get_pages+0x40>
+		next_pp->pp_prev = pp->pp_prev;
+f0101158:	8b 0e                	mov    (%esi),%ecx
+f010115a:	89 08                	mov    %ecx,(%eax)
+	pp->pp_prev = NULL;
+f010115c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+	assert(pp->pp_order >= order);
+f0101162:	38 56 0a             	cmp    %dl,0xa(%esi)
+f0101165:	0f 83 81 00 00 00    	jae    f01011ec <buddy_get_pages+0xd0>
+f010116b:	68 76 ba 10 f0       	push   $0xf010ba76
+f0101170:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101175:	68 4e 01 00 00       	push   $0x14e
+f010117a:	68 25 ba 10 f0       	push   $0xf010ba25
+f010117f:	e8 c5 ee ff ff       	call   f0100049 <_panic>
+	for (uint8_t o = order; o <= BUDDY_MAX_ORDER; o++) {
+f0101184:	83 c1 01             	add    $0x1,%ecx
+f0101187:	eb ad                	jmp    f0101136 <buddy_get_pages+0x1a>
+	assert(pp->pp_prev != NULL);
+f0101189:	68 62 ba 10 f0       	push   $0xf010ba62
+f010118e:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101193:	68 44 01 00 00       	push   $0x144
+f0101198:	68 25 ba 10 f0       	push   $0xf010ba25
+f010119d:	e8 a7 ee ff ff       	call   f0100049 <_panic>
+		assert(buddy && buddy->pp_order == pp->pp_order);
+f01011a2:	68 3c b1 10 f0       	push   $0xf010b13c
+f01011a7:	68 25 aa 10 f0       	push   $0xf010aa25
+f01011ac:	68 54 01 00 00       	push   $0x154
+f01011b1:	68 25 ba 10 f0       	push   $0xf010ba25
+f01011b6:	e8 8e ee ff ff       	call   f0100049 <_panic>
+	assert(pp->pp_prev == NULL);
+f01011bb:	68 8c ba 10 f0       	push   $0xf010ba8c
+f01011c0:	68 25 aa 10 f0       	push   $0xf010aa25
+f01011c5:	68 38 01 00 00       	push   $0x138
+f01011ca:	68 25 ba 10 f0       	push   $0xf010ba25
+f01011cf:	e8 75 ee ff ff       	call   f0100049 <_panic>
+	pool.free_lists[pp->pp_order] = pp;
+f01011d4:	0f b6 50 0a          	movzbl 0xa(%eax),%edx
+f01011d8:	89 04 95 6c c2 7f f0 	mov    %eax,-0xf803d94(,%edx,4)
+	pp->pp_prev = &pool.free_lists[pp->pp_order];
+f01011df:	0f b6 50 0a          	movzbl 0xa(%eax),%edx
+f01011e3:	8d 14 95 6c c2 7f f0 	lea    -0xf803d94(,%edx,4),%edx
+f01011ea:	89 10                	mov    %edx,(%eax)
+	while (pp->pp_order > order) {
+f01011ec:	0f b6 5e 0a          	movzbl 0xa(%esi),%ebx
+f01011f0:	89 f8                	mov    %edi,%eax
+f01011f2:	38 d8                	cmp    %bl,%al
+f01011f4:	73 3b                	jae    f0101231 <buddy_get_pages+0x115>
+		pp->pp_order--;
+f01011f6:	83 eb 01             	sub    $0x1,%ebx
+f01011f9:	88 5e 0a             	mov    %bl,0xa(%esi)
+		buddy = get_buddy_chunk(pp);
+f01011fc:	89 f0                	mov    %esi,%eax
+f01011fe:	e8 53 fc ff ff       	call   f0100e56 <get_buddy_chunk>
+		assert(buddy && buddy->pp_order == pp->pp_order);
+f0101203:	85 c0                	test   %eax,%eax
+f0101205:	74 9b                	je     f01011a2 <buddy_get_pages+0x86>
+f0101207:	0f b6 50 0a          	movzbl 0xa(%eax),%edx
+f010120b:	38 d3                	cmp    %dl,%bl
+f010120d:	75 93                	jne    f01011a2 <buddy_get_pages+0x86>
+	struct PageInfo *next_pp = pool.free_lists[pp->pp_order];
+f010120f:	0f b6 d2             	movzbl %dl,%edx
+f0101212:	8b 14 95 6c c2 7f f0 	mov    -0xf803d94(,%edx,4),%edx
+	assert(pp->pp_prev == NULL);
+f0101219:	83 38 00             	cmpl   $0x0,(%eax)
+f010121c:	75 9d                	jne    f01011bb <buddy_get_pages+0x9f>
+	pp->pp_next = next_pp;
+f010121e:	89 50 04             	mov    %edx,0x4(%eax)
+	if (next_pp)
+f0101221:	85 d2                	test   %edx,%edx
+f0101223:	74 af                	je     f01011d4 <buddy_get_pages+0xb8>
+		next_pp->pp_prev = &pp->pp_next;
+f0101225:	8d 48 04             	lea    0x4(%eax),%ecx
+f0101228:	89 0a                	mov    %ecx,(%edx)
+f010122a:	eb a8                	jmp    f01011d4 <buddy_get_pages+0xb8>
+	return NULL;
+f010122c:	be 00 00 00 00       	mov    $0x0,%esi
+}
+f0101231:	89 f0                	mov    %esi,%eax
+f0101233:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101236:	5b                   	pop    %ebx
+f0101237:	5e                   	pop    %esi
+f0101238:	5f                   	pop    %edi
+f0101239:	5d                   	pop    %ebp
+f010123a:	c3                   	ret
+
+f010123b <buddy_free_pages>:
+{
+f010123b:	55                   	push   %ebp
+f010123c:	89 e5                	mov    %esp,%ebp
+f010123e:	57                   	push   %edi
+f010123f:	56                   	push   %esi
+f0101240:	53                   	push   %ebx
+f0101241:	83 ec 0c             	sub    $0xc,%esp
+f0101244:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	while ((buddy = get_buddy_chunk(pp))) {
+f0101247:	eb 28                	jmp    f0101271 <buddy_free_pages+0x36>
+		assert(buddy->pp_order == pp->pp_order);
+f0101249:	68 68 b1 10 f0       	push   $0xf010b168
+f010124e:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101253:	68 6e 01 00 00       	push   $0x16e
+f0101258:	68 25 ba 10 f0       	push   $0xf010ba25
+f010125d:	e8 e7 ed ff ff       	call   f0100049 <_panic>
+	pp->pp_prev = NULL;
+f0101262:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		pp = MIN(pp, buddy);
+f0101268:	39 c3                	cmp    %eax,%ebx
+f010126a:	0f 47 d8             	cmova  %eax,%ebx
+		pp->pp_order++;
+f010126d:	80 43 0a 01          	addb   $0x1,0xa(%ebx)
+	while ((buddy = get_buddy_chunk(pp))) {
+f0101271:	89 d8                	mov    %ebx,%eax
+f0101273:	e8 de fb ff ff       	call   f0100e56 <get_buddy_chunk>
+f0101278:	85 c0                	test   %eax,%eax
+f010127a:	74 25                	je     f01012a1 <buddy_free_pages+0x66>
+		if (buddy->pp_prev == NULL || buddy->pp_order < pp->pp_order)
+f010127c:	8b 38                	mov    (%eax),%edi
+f010127e:	85 ff                	test   %edi,%edi
+f0101280:	74 1f                	je     f01012a1 <buddy_free_pages+0x66>
+f0101282:	0f b6 70 0a          	movzbl 0xa(%eax),%esi
+f0101286:	0f b6 53 0a          	movzbl 0xa(%ebx),%edx
+f010128a:	89 f1                	mov    %esi,%ecx
+f010128c:	38 d1                	cmp    %dl,%cl
+f010128e:	72 11                	jb     f01012a1 <buddy_free_pages+0x66>
+		assert(buddy->pp_order == pp->pp_order);
+f0101290:	75 b7                	jne    f0101249 <buddy_free_pages+0xe>
+	struct PageInfo *next_pp = pp->pp_next;
+f0101292:	8b 50 04             	mov    0x4(%eax),%edx
+	*pp->pp_prev = next_pp;
+f0101295:	89 17                	mov    %edx,(%edi)
+	if (next_pp)
+f0101297:	85 d2                	test   %edx,%edx
+f0101299:	74 c7                	je     f0101262 <buddy_free_pages+0x27>
+		next_pp->pp_prev = pp->pp_prev;
+f010129b:	8b 08                	mov    (%eax),%ecx
+f010129d:	89 0a                	mov    %ecx,(%edx)
+f010129f:	eb c1                	jmp    f0101262 <buddy_free_pages+0x27>
+	struct PageInfo *next_pp = pool.free_lists[pp->pp_order];
+f01012a1:	0f b6 43 0a          	movzbl 0xa(%ebx),%eax
+f01012a5:	8b 04 85 6c c2 7f f0 	mov    -0xf803d94(,%eax,4),%eax
+	assert(pp->pp_prev == NULL);
+f01012ac:	83 3b 00             	cmpl   $0x0,(%ebx)
+f01012af:	75 2c                	jne    f01012dd <buddy_free_pages+0xa2>
+	pp->pp_next = next_pp;
+f01012b1:	89 43 04             	mov    %eax,0x4(%ebx)
+	if (next_pp)
+f01012b4:	85 c0                	test   %eax,%eax
+f01012b6:	74 05                	je     f01012bd <buddy_free_pages+0x82>
+		next_pp->pp_prev = &pp->pp_next;
+f01012b8:	8d 53 04             	lea    0x4(%ebx),%edx
+f01012bb:	89 10                	mov    %edx,(%eax)
+	pool.free_lists[pp->pp_order] = pp;
+f01012bd:	0f b6 43 0a          	movzbl 0xa(%ebx),%eax
+f01012c1:	89 1c 85 6c c2 7f f0 	mov    %ebx,-0xf803d94(,%eax,4)
+	pp->pp_prev = &pool.free_lists[pp->pp_order];
+f01012c8:	0f b6 43 0a          	movzbl 0xa(%ebx),%eax
+f01012cc:	8d 04 85 6c c2 7f f0 	lea    -0xf803d94(,%eax,4),%eax
+f01012d3:	89 03                	mov    %eax,(%ebx)
+}
+f01012d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01012d8:	5b                   	pop    %ebx
+f01012d9:	5e                   	pop    %esi
+f01012da:	5f                   	pop    %edi
+f01012db:	5d                   	pop    %ebp
+f01012dc:	c3                   	ret
+	assert(pp->pp_prev == NULL);
+f01012dd:	68 8c ba 10 f0       	push   $0xf010ba8c
+f01012e2:	68 25 aa 10 f0       	push   $0xf010aa25
+f01012e7:	68 38 01 00 00       	push   $0x138
+f01012ec:	68 25 ba 10 f0       	push   $0xf010ba25
+f01012f1:	e8 53 ed ff ff       	call   f0100049 <_panic>
+
+f01012f6 <free_pages_of_order>:
+{
+f01012f6:	55                   	push   %ebp
+f01012f7:	89 e5                	mov    %esp,%ebp
+f01012f9:	57                   	push   %edi
+f01012fa:	56                   	push   %esi
+f01012fb:	53                   	push   %ebx
+f01012fc:	83 ec 1c             	sub    $0x1c,%esp
+f01012ff:	88 45 e7             	mov    %al,-0x19(%ebp)
+	struct PageInfo *pages = pool.pages;
+f0101302:	8b 3d 68 c2 7f f0    	mov    0xf07fc268,%edi
+	for (pp = &pages[1]; pp < &pages[npages]; pp += 1 << pp->pp_order) {
+f0101308:	8d 77 0c             	lea    0xc(%edi),%esi
+f010130b:	eb 2a                	jmp    f0101337 <free_pages_of_order+0x41>
+	       (off >= npages_basemem && off < PGNUM(PADDR(boot_alloc(0))));
+f010130d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101312:	e8 93 f9 ff ff       	call   f0100caa <boot_alloc>
+	if ((uint32_t)kva < KERNBASE)
+f0101317:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010131c:	76 68                	jbe    f0101386 <free_pages_of_order+0x90>
+	return (physaddr_t)kva - KERNBASE;
+f010131e:	05 00 00 00 10       	add    $0x10000000,%eax
+f0101323:	c1 e8 0c             	shr    $0xc,%eax
+		if (page_is_reserved(pp))
+f0101326:	39 c3                	cmp    %eax,%ebx
+f0101328:	73 40                	jae    f010136a <free_pages_of_order+0x74>
+	for (pp = &pages[1]; pp < &pages[npages]; pp += 1 << pp->pp_order) {
+f010132a:	0f b6 4e 0a          	movzbl 0xa(%esi),%ecx
+f010132e:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0101333:	d3 e0                	shl    %cl,%eax
+f0101335:	01 c6                	add    %eax,%esi
+f0101337:	a1 ac c2 7f f0       	mov    0xf07fc2ac,%eax
+f010133c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f010133f:	8d 04 87             	lea    (%edi,%eax,4),%eax
+f0101342:	39 c6                	cmp    %eax,%esi
+f0101344:	73 55                	jae    f010139b <free_pages_of_order+0xa5>
+	size_t off = pp - pool.pages;
+f0101346:	b8 60 c2 7f f0       	mov    $0xf07fc260,%eax
+f010134b:	89 f3                	mov    %esi,%ebx
+f010134d:	2b 58 08             	sub    0x8(%eax),%ebx
+f0101350:	c1 fb 02             	sar    $0x2,%ebx
+f0101353:	69 db ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%ebx
+	return off == 0 || off == PGNUM(MPENTRY_PADDR) ||
+f0101359:	85 db                	test   %ebx,%ebx
+f010135b:	74 cd                	je     f010132a <free_pages_of_order+0x34>
+f010135d:	83 fb 07             	cmp    $0x7,%ebx
+f0101360:	74 c8                	je     f010132a <free_pages_of_order+0x34>
+f0101362:	3b 1d 00 c3 7f f0    	cmp    0xf07fc300,%ebx
+f0101368:	73 a3                	jae    f010130d <free_pages_of_order+0x17>
+		if (pp->pp_order != order || pp->pp_prev != NULL)
+f010136a:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+f010136e:	38 46 0a             	cmp    %al,0xa(%esi)
+f0101371:	75 b7                	jne    f010132a <free_pages_of_order+0x34>
+f0101373:	83 3e 00             	cmpl   $0x0,(%esi)
+f0101376:	75 b2                	jne    f010132a <free_pages_of_order+0x34>
+		buddy_free_pages(pp);
+f0101378:	83 ec 0c             	sub    $0xc,%esp
+f010137b:	56                   	push   %esi
+f010137c:	e8 ba fe ff ff       	call   f010123b <buddy_free_pages>
+f0101381:	83 c4 10             	add    $0x10,%esp
+f0101384:	eb a4                	jmp    f010132a <free_pages_of_order+0x34>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101386:	50                   	push   %eax
+f0101387:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f010138c:	68 80 01 00 00       	push   $0x180
+f0101391:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101396:	e8 ae ec ff ff       	call   f0100049 <_panic>
+}
+f010139b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010139e:	5b                   	pop    %ebx
+f010139f:	5e                   	pop    %esi
+f01013a0:	5f                   	pop    %edi
+f01013a1:	5d                   	pop    %ebp
+f01013a2:	c3                   	ret
+
+f01013a3 <check_buddy>:
+{
+f01013a3:	55                   	push   %ebp
+f01013a4:	89 e5                	mov    %esp,%ebp
+f01013a6:	57                   	push   %edi
+f01013a7:	56                   	push   %esi
+f01013a8:	53                   	push   %ebx
+f01013a9:	83 ec 1c             	sub    $0x1c,%esp
+	size_t upper_page_idx = PGNUM(PADDR(boot_alloc(0)));
+f01013ac:	b8 00 00 00 00       	mov    $0x0,%eax
+f01013b1:	e8 f4 f8 ff ff       	call   f0100caa <boot_alloc>
+	if ((uint32_t)kva < KERNBASE)
+f01013b6:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01013bb:	0f 86 3b 01 00 00    	jbe    f01014fc <check_buddy+0x159>
+	total = buddy_free_memory_size();
+f01013c1:	e8 aa f8 ff ff       	call   f0100c70 <buddy_free_memory_size>
+f01013c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	while (buddy_get_pages(order));
+f01013c9:	83 ec 0c             	sub    $0xc,%esp
+f01013cc:	6a 00                	push   $0x0
+f01013ce:	e8 49 fd ff ff       	call   f010111c <buddy_get_pages>
+f01013d3:	83 c4 10             	add    $0x10,%esp
+f01013d6:	85 c0                	test   %eax,%eax
+f01013d8:	75 ef                	jne    f01013c9 <check_buddy+0x26>
+	assert(buddy_free_memory_size() == 0);
+f01013da:	e8 91 f8 ff ff       	call   f0100c70 <buddy_free_memory_size>
+f01013df:	85 c0                	test   %eax,%eax
+f01013e1:	0f 85 2a 01 00 00    	jne    f0101511 <check_buddy+0x16e>
+	free_pages_of_order(0);
+f01013e7:	b8 00 00 00 00       	mov    $0x0,%eax
+f01013ec:	e8 05 ff ff ff       	call   f01012f6 <free_pages_of_order>
+	assert(buddy_free_memory_size() == total);
+f01013f1:	e8 7a f8 ff ff       	call   f0100c70 <buddy_free_memory_size>
+f01013f6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01013f9:	39 c8                	cmp    %ecx,%eax
+f01013fb:	0f 85 29 01 00 00    	jne    f010152a <check_buddy+0x187>
+	while (buddy_get_pages(2));
+f0101401:	83 ec 0c             	sub    $0xc,%esp
+f0101404:	6a 02                	push   $0x2
+f0101406:	e8 11 fd ff ff       	call   f010111c <buddy_get_pages>
+f010140b:	83 c4 10             	add    $0x10,%esp
+f010140e:	85 c0                	test   %eax,%eax
+f0101410:	75 ef                	jne    f0101401 <check_buddy+0x5e>
+	assert(!buddy_get_pages(3));
+f0101412:	83 ec 0c             	sub    $0xc,%esp
+f0101415:	6a 03                	push   $0x3
+f0101417:	e8 00 fd ff ff       	call   f010111c <buddy_get_pages>
+f010141c:	83 c4 10             	add    $0x10,%esp
+f010141f:	85 c0                	test   %eax,%eax
+f0101421:	0f 85 1c 01 00 00    	jne    f0101543 <check_buddy+0x1a0>
+	free_pages_of_order(2);
+f0101427:	b8 02 00 00 00       	mov    $0x2,%eax
+f010142c:	e8 c5 fe ff ff       	call   f01012f6 <free_pages_of_order>
+	assert(buddy_free_memory_size() == total);
+f0101431:	e8 3a f8 ff ff       	call   f0100c70 <buddy_free_memory_size>
+f0101436:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0101439:	39 d0                	cmp    %edx,%eax
+f010143b:	0f 85 1b 01 00 00    	jne    f010155c <check_buddy+0x1b9>
+	while (buddy_get_pages(8));
+f0101441:	83 ec 0c             	sub    $0xc,%esp
+f0101444:	6a 08                	push   $0x8
+f0101446:	e8 d1 fc ff ff       	call   f010111c <buddy_get_pages>
+f010144b:	83 c4 10             	add    $0x10,%esp
+f010144e:	85 c0                	test   %eax,%eax
+f0101450:	75 ef                	jne    f0101441 <check_buddy+0x9e>
+	remaining = buddy_free_memory_size();
+f0101452:	e8 19 f8 ff ff       	call   f0100c70 <buddy_free_memory_size>
+f0101457:	89 c3                	mov    %eax,%ebx
+	while (buddy_get_pages(3));
+f0101459:	83 ec 0c             	sub    $0xc,%esp
+f010145c:	6a 03                	push   $0x3
+f010145e:	e8 b9 fc ff ff       	call   f010111c <buddy_get_pages>
+f0101463:	83 c4 10             	add    $0x10,%esp
+f0101466:	85 c0                	test   %eax,%eax
+f0101468:	75 ef                	jne    f0101459 <check_buddy+0xb6>
+	remaining2 = buddy_free_memory_size();
+f010146a:	e8 01 f8 ff ff       	call   f0100c70 <buddy_free_memory_size>
+f010146f:	89 c6                	mov    %eax,%esi
+	while (buddy_get_pages(0));
+f0101471:	83 ec 0c             	sub    $0xc,%esp
+f0101474:	6a 00                	push   $0x0
+f0101476:	e8 a1 fc ff ff       	call   f010111c <buddy_get_pages>
+f010147b:	83 c4 10             	add    $0x10,%esp
+f010147e:	85 c0                	test   %eax,%eax
+f0101480:	75 ef                	jne    f0101471 <check_buddy+0xce>
+	assert(buddy_free_memory_size() == 0);
+f0101482:	e8 e9 f7 ff ff       	call   f0100c70 <buddy_free_memory_size>
+f0101487:	85 c0                	test   %eax,%eax
+f0101489:	0f 85 e6 00 00 00    	jne    f0101575 <check_buddy+0x1d2>
+	free_pages_of_order(3);
+f010148f:	b8 03 00 00 00       	mov    $0x3,%eax
+f0101494:	e8 5d fe ff ff       	call   f01012f6 <free_pages_of_order>
+	assert(buddy_free_memory_size() == remaining - remaining2);
+f0101499:	e8 d2 f7 ff ff       	call   f0100c70 <buddy_free_memory_size>
+f010149e:	89 c2                	mov    %eax,%edx
+f01014a0:	89 d8                	mov    %ebx,%eax
+f01014a2:	29 f0                	sub    %esi,%eax
+f01014a4:	39 c2                	cmp    %eax,%edx
+f01014a6:	0f 85 e2 00 00 00    	jne    f010158e <check_buddy+0x1eb>
+	free_pages_of_order(0);
+f01014ac:	b8 00 00 00 00       	mov    $0x0,%eax
+f01014b1:	e8 40 fe ff ff       	call   f01012f6 <free_pages_of_order>
+	assert(buddy_free_memory_size() == remaining);
+f01014b6:	e8 b5 f7 ff ff       	call   f0100c70 <buddy_free_memory_size>
+f01014bb:	39 d8                	cmp    %ebx,%eax
+f01014bd:	0f 85 e4 00 00 00    	jne    f01015a7 <check_buddy+0x204>
+	free_pages_of_order(8);
+f01014c3:	b8 08 00 00 00       	mov    $0x8,%eax
+f01014c8:	e8 29 fe ff ff       	call   f01012f6 <free_pages_of_order>
+	assert(buddy_free_memory_size() == total);
+f01014cd:	e8 9e f7 ff ff       	call   f0100c70 <buddy_free_memory_size>
+f01014d2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01014d5:	39 c8                	cmp    %ecx,%eax
+f01014d7:	0f 85 e3 00 00 00    	jne    f01015c0 <check_buddy+0x21d>
+	struct PageInfo *pages = pool.pages;
+f01014dd:	8b 3d 68 c2 7f f0    	mov    0xf07fc268,%edi
+	while (buddy_get_pages(0));
+f01014e3:	83 ec 0c             	sub    $0xc,%esp
+f01014e6:	6a 00                	push   $0x0
+f01014e8:	e8 2f fc ff ff       	call   f010111c <buddy_get_pages>
+f01014ed:	83 c4 10             	add    $0x10,%esp
+f01014f0:	85 c0                	test   %eax,%eax
+f01014f2:	75 ef                	jne    f01014e3 <check_buddy+0x140>
+	for (pp = &pages[1]; pp < &pages[npages]; pp += 2) {
+f01014f4:	8d 77 0c             	lea    0xc(%edi),%esi
+f01014f7:	e9 fd 00 00 00       	jmp    f01015f9 <check_buddy+0x256>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01014fc:	50                   	push   %eax
+f01014fd:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0101502:	68 48 03 00 00       	push   $0x348
+f0101507:	68 25 ba 10 f0       	push   $0xf010ba25
+f010150c:	e8 38 eb ff ff       	call   f0100049 <_panic>
+	assert(buddy_free_memory_size() == 0);
+f0101511:	68 a0 ba 10 f0       	push   $0xf010baa0
+f0101516:	68 25 aa 10 f0       	push   $0xf010aa25
+f010151b:	68 4f 03 00 00       	push   $0x34f
+f0101520:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101525:	e8 1f eb ff ff       	call   f0100049 <_panic>
+	assert(buddy_free_memory_size() == total);
+f010152a:	68 88 b1 10 f0       	push   $0xf010b188
+f010152f:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101534:	68 52 03 00 00       	push   $0x352
+f0101539:	68 25 ba 10 f0       	push   $0xf010ba25
+f010153e:	e8 06 eb ff ff       	call   f0100049 <_panic>
+	assert(!buddy_get_pages(3));
+f0101543:	68 be ba 10 f0       	push   $0xf010babe
+f0101548:	68 25 aa 10 f0       	push   $0xf010aa25
+f010154d:	68 57 03 00 00       	push   $0x357
+f0101552:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101557:	e8 ed ea ff ff       	call   f0100049 <_panic>
+	assert(buddy_free_memory_size() == total);
+f010155c:	68 88 b1 10 f0       	push   $0xf010b188
+f0101561:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101566:	68 59 03 00 00       	push   $0x359
+f010156b:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101570:	e8 d4 ea ff ff       	call   f0100049 <_panic>
+	assert(buddy_free_memory_size() == 0);
+f0101575:	68 a0 ba 10 f0       	push   $0xf010baa0
+f010157a:	68 25 aa 10 f0       	push   $0xf010aa25
+f010157f:	68 61 03 00 00       	push   $0x361
+f0101584:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101589:	e8 bb ea ff ff       	call   f0100049 <_panic>
+	assert(buddy_free_memory_size() == remaining - remaining2);
+f010158e:	68 ac b1 10 f0       	push   $0xf010b1ac
+f0101593:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101598:	68 64 03 00 00       	push   $0x364
+f010159d:	68 25 ba 10 f0       	push   $0xf010ba25
+f01015a2:	e8 a2 ea ff ff       	call   f0100049 <_panic>
+	assert(buddy_free_memory_size() == remaining);
+f01015a7:	68 e0 b1 10 f0       	push   $0xf010b1e0
+f01015ac:	68 25 aa 10 f0       	push   $0xf010aa25
+f01015b1:	68 66 03 00 00       	push   $0x366
+f01015b6:	68 25 ba 10 f0       	push   $0xf010ba25
+f01015bb:	e8 89 ea ff ff       	call   f0100049 <_panic>
+	assert(buddy_free_memory_size() == total);
+f01015c0:	68 88 b1 10 f0       	push   $0xf010b188
+f01015c5:	68 25 aa 10 f0       	push   $0xf010aa25
+f01015ca:	68 68 03 00 00       	push   $0x368
+f01015cf:	68 25 ba 10 f0       	push   $0xf010ba25
+f01015d4:	e8 70 ea ff ff       	call   f0100049 <_panic>
+	return (physaddr_t)kva - KERNBASE;
+f01015d9:	05 00 00 00 10       	add    $0x10000000,%eax
+	       (off >= npages_basemem && off < PGNUM(PADDR(boot_alloc(0))));
+f01015de:	c1 e8 0c             	shr    $0xc,%eax
+		if (page_is_reserved(pp))
+f01015e1:	39 c3                	cmp    %eax,%ebx
+f01015e3:	72 11                	jb     f01015f6 <check_buddy+0x253>
+		assert(pp->pp_prev == NULL);
+f01015e5:	83 3e 00             	cmpl   $0x0,(%esi)
+f01015e8:	75 68                	jne    f0101652 <check_buddy+0x2af>
+		buddy_free_pages(pp);
+f01015ea:	83 ec 0c             	sub    $0xc,%esp
+f01015ed:	56                   	push   %esi
+f01015ee:	e8 48 fc ff ff       	call   f010123b <buddy_free_pages>
+f01015f3:	83 c4 10             	add    $0x10,%esp
+	for (pp = &pages[1]; pp < &pages[npages]; pp += 2) {
+f01015f6:	83 c6 18             	add    $0x18,%esi
+f01015f9:	a1 ac c2 7f f0       	mov    0xf07fc2ac,%eax
+f01015fe:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0101601:	8d 04 87             	lea    (%edi,%eax,4),%eax
+f0101604:	39 c6                	cmp    %eax,%esi
+f0101606:	73 63                	jae    f010166b <check_buddy+0x2c8>
+	size_t off = pp - pool.pages;
+f0101608:	b8 60 c2 7f f0       	mov    $0xf07fc260,%eax
+f010160d:	89 f3                	mov    %esi,%ebx
+f010160f:	2b 58 08             	sub    0x8(%eax),%ebx
+f0101612:	c1 fb 02             	sar    $0x2,%ebx
+f0101615:	69 db ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%ebx
+	return off == 0 || off == PGNUM(MPENTRY_PADDR) ||
+f010161b:	85 db                	test   %ebx,%ebx
+f010161d:	74 d7                	je     f01015f6 <check_buddy+0x253>
+f010161f:	83 fb 07             	cmp    $0x7,%ebx
+f0101622:	74 d2                	je     f01015f6 <check_buddy+0x253>
+f0101624:	3b 1d 00 c3 7f f0    	cmp    0xf07fc300,%ebx
+f010162a:	72 b9                	jb     f01015e5 <check_buddy+0x242>
+	       (off >= npages_basemem && off < PGNUM(PADDR(boot_alloc(0))));
+f010162c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101631:	e8 74 f6 ff ff       	call   f0100caa <boot_alloc>
+	if ((uint32_t)kva < KERNBASE)
+f0101636:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010163b:	77 9c                	ja     f01015d9 <check_buddy+0x236>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010163d:	50                   	push   %eax
+f010163e:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0101643:	68 80 01 00 00       	push   $0x180
+f0101648:	68 25 ba 10 f0       	push   $0xf010ba25
+f010164d:	e8 f7 e9 ff ff       	call   f0100049 <_panic>
+		assert(pp->pp_prev == NULL);
+f0101652:	68 8c ba 10 f0       	push   $0xf010ba8c
+f0101657:	68 25 aa 10 f0       	push   $0xf010aa25
+f010165c:	68 72 03 00 00       	push   $0x372
+f0101661:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101666:	e8 de e9 ff ff       	call   f0100049 <_panic>
+f010166b:	bb 01 00 00 00       	mov    $0x1,%ebx
+		assert(!buddy_get_pages(o));
+f0101670:	83 ec 0c             	sub    $0xc,%esp
+f0101673:	53                   	push   %ebx
+f0101674:	e8 a3 fa ff ff       	call   f010111c <buddy_get_pages>
+f0101679:	83 c3 01             	add    $0x1,%ebx
+f010167c:	83 c4 10             	add    $0x10,%esp
+f010167f:	85 c0                	test   %eax,%eax
+f0101681:	75 0a                	jne    f010168d <check_buddy+0x2ea>
+	for (uint8_t o = 1; o <= BUDDY_MAX_ORDER; o++)
+f0101683:	83 fb 0f             	cmp    $0xf,%ebx
+f0101686:	75 e8                	jne    f0101670 <check_buddy+0x2cd>
+	for (pp = &pages[2]; pp < &pages[npages]; pp += 2) {
+f0101688:	8d 77 18             	lea    0x18(%edi),%esi
+f010168b:	eb 39                	jmp    f01016c6 <check_buddy+0x323>
+		assert(!buddy_get_pages(o));
+f010168d:	68 d2 ba 10 f0       	push   $0xf010bad2
+f0101692:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101697:	68 76 03 00 00       	push   $0x376
+f010169c:	68 25 ba 10 f0       	push   $0xf010ba25
+f01016a1:	e8 a3 e9 ff ff       	call   f0100049 <_panic>
+	return (physaddr_t)kva - KERNBASE;
+f01016a6:	05 00 00 00 10       	add    $0x10000000,%eax
+	       (off >= npages_basemem && off < PGNUM(PADDR(boot_alloc(0))));
+f01016ab:	c1 e8 0c             	shr    $0xc,%eax
+		if (page_is_reserved(pp))
+f01016ae:	39 c3                	cmp    %eax,%ebx
+f01016b0:	72 11                	jb     f01016c3 <check_buddy+0x320>
+		assert(pp->pp_prev == NULL);
+f01016b2:	83 3e 00             	cmpl   $0x0,(%esi)
+f01016b5:	75 68                	jne    f010171f <check_buddy+0x37c>
+		buddy_free_pages(pp);
+f01016b7:	83 ec 0c             	sub    $0xc,%esp
+f01016ba:	56                   	push   %esi
+f01016bb:	e8 7b fb ff ff       	call   f010123b <buddy_free_pages>
+f01016c0:	83 c4 10             	add    $0x10,%esp
+	for (pp = &pages[2]; pp < &pages[npages]; pp += 2) {
+f01016c3:	83 c6 18             	add    $0x18,%esi
+f01016c6:	a1 ac c2 7f f0       	mov    0xf07fc2ac,%eax
+f01016cb:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f01016ce:	8d 04 87             	lea    (%edi,%eax,4),%eax
+f01016d1:	39 c6                	cmp    %eax,%esi
+f01016d3:	73 63                	jae    f0101738 <check_buddy+0x395>
+	size_t off = pp - pool.pages;
+f01016d5:	b8 60 c2 7f f0       	mov    $0xf07fc260,%eax
+f01016da:	89 f3                	mov    %esi,%ebx
+f01016dc:	2b 58 08             	sub    0x8(%eax),%ebx
+f01016df:	c1 fb 02             	sar    $0x2,%ebx
+f01016e2:	69 db ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%ebx
+	return off == 0 || off == PGNUM(MPENTRY_PADDR) ||
+f01016e8:	85 db                	test   %ebx,%ebx
+f01016ea:	74 d7                	je     f01016c3 <check_buddy+0x320>
+f01016ec:	83 fb 07             	cmp    $0x7,%ebx
+f01016ef:	74 d2                	je     f01016c3 <check_buddy+0x320>
+f01016f1:	3b 1d 00 c3 7f f0    	cmp    0xf07fc300,%ebx
+f01016f7:	72 b9                	jb     f01016b2 <check_buddy+0x30f>
+	       (off >= npages_basemem && off < PGNUM(PADDR(boot_alloc(0))));
+f01016f9:	b8 00 00 00 00       	mov    $0x0,%eax
+f01016fe:	e8 a7 f5 ff ff       	call   f0100caa <boot_alloc>
+	if ((uint32_t)kva < KERNBASE)
+f0101703:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0101708:	77 9c                	ja     f01016a6 <check_buddy+0x303>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010170a:	50                   	push   %eax
+f010170b:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0101710:	68 80 01 00 00       	push   $0x180
+f0101715:	68 25 ba 10 f0       	push   $0xf010ba25
+f010171a:	e8 2a e9 ff ff       	call   f0100049 <_panic>
+		assert(pp->pp_prev == NULL);
+f010171f:	68 8c ba 10 f0       	push   $0xf010ba8c
+f0101724:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101729:	68 7a 03 00 00       	push   $0x37a
+f010172e:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101733:	e8 11 e9 ff ff       	call   f0100049 <_panic>
+	assert(buddy_free_memory_size() == total);
+f0101738:	e8 33 f5 ff ff       	call   f0100c70 <buddy_free_memory_size>
+f010173d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0101740:	39 d0                	cmp    %edx,%eax
+f0101742:	75 18                	jne    f010175c <check_buddy+0x3b9>
+	cprintf("check_buddy() succeeded!\n");
+f0101744:	83 ec 0c             	sub    $0xc,%esp
+f0101747:	68 e6 ba 10 f0       	push   $0xf010bae6
+f010174c:	e8 90 2c 00 00       	call   f01043e1 <cprintf>
+}
+f0101751:	83 c4 10             	add    $0x10,%esp
+f0101754:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101757:	5b                   	pop    %ebx
+f0101758:	5e                   	pop    %esi
+f0101759:	5f                   	pop    %edi
+f010175a:	5d                   	pop    %ebp
+f010175b:	c3                   	ret
+	assert(buddy_free_memory_size() == total);
+f010175c:	68 88 b1 10 f0       	push   $0xf010b188
+f0101761:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101766:	68 7d 03 00 00       	push   $0x37d
+f010176b:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101770:	e8 d4 e8 ff ff       	call   f0100049 <_panic>
+
+f0101775 <page_init>:
+{
+f0101775:	55                   	push   %ebp
+f0101776:	89 e5                	mov    %esp,%ebp
+f0101778:	57                   	push   %edi
+f0101779:	56                   	push   %esi
+f010177a:	53                   	push   %ebx
+f010177b:	83 ec 0c             	sub    $0xc,%esp
+	if (PGNUM(pa) >= npages)
+f010177e:	a1 ac c2 7f f0       	mov    0xf07fc2ac,%eax
+f0101783:	85 c0                	test   %eax,%eax
+f0101785:	74 5d                	je     f01017e4 <page_init+0x6f>
+	pool.start = (uintptr_t) KADDR(0);
+f0101787:	c7 05 60 c2 7f f0 00 	movl   $0xf0000000,0xf07fc260
+f010178e:	00 00 f0 
+	pool.size = npages * PGSIZE;
+f0101791:	89 c2                	mov    %eax,%edx
+f0101793:	c1 e2 0c             	shl    $0xc,%edx
+f0101796:	89 15 64 c2 7f f0    	mov    %edx,0xf07fc264
+	pool.pages = boot_alloc(sizeof(struct PageInfo) * npages);
+f010179c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f010179f:	c1 e0 02             	shl    $0x2,%eax
+f01017a2:	e8 03 f5 ff ff       	call   f0100caa <boot_alloc>
+f01017a7:	a3 68 c2 7f f0       	mov    %eax,0xf07fc268
+	memset(pool.pages, 0, sizeof(struct PageInfo) * npages);
+f01017ac:	83 ec 04             	sub    $0x4,%esp
+f01017af:	8b 15 ac c2 7f f0    	mov    0xf07fc2ac,%edx
+f01017b5:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f01017b8:	c1 e2 02             	shl    $0x2,%edx
+f01017bb:	52                   	push   %edx
+f01017bc:	6a 00                	push   $0x0
+f01017be:	50                   	push   %eax
+f01017bf:	e8 42 56 00 00       	call   f0106e06 <memset>
+	memset(pool.free_lists, 0, sizeof(pool.free_lists));
+f01017c4:	83 c4 0c             	add    $0xc,%esp
+f01017c7:	6a 3c                	push   $0x3c
+f01017c9:	6a 00                	push   $0x0
+f01017cb:	68 6c c2 7f f0       	push   $0xf07fc26c
+f01017d0:	e8 31 56 00 00       	call   f0106e06 <memset>
+	for (size_t i = 0; i < npages; i++) {
+f01017d5:	83 c4 10             	add    $0x10,%esp
+f01017d8:	be 00 00 00 00       	mov    $0x0,%esi
+f01017dd:	bf 00 00 00 00       	mov    $0x0,%edi
+f01017e2:	eb 3c                	jmp    f0101820 <page_init+0xab>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01017e4:	6a 00                	push   $0x0
+f01017e6:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f01017eb:	68 8c 01 00 00       	push   $0x18c
+f01017f0:	68 25 ba 10 f0       	push   $0xf010ba25
+f01017f5:	e8 4f e8 ff ff       	call   f0100049 <_panic>
+	return (physaddr_t)kva - KERNBASE;
+f01017fa:	05 00 00 00 10       	add    $0x10000000,%eax
+	       (off >= npages_basemem && off < PGNUM(PADDR(boot_alloc(0))));
+f01017ff:	c1 e8 0c             	shr    $0xc,%eax
+		if (page_is_reserved(&pool.pages[i]))
+f0101802:	39 c3                	cmp    %eax,%ebx
+f0101804:	72 14                	jb     f010181a <page_init+0xa5>
+		buddy_free_pages(&pool.pages[i]);
+f0101806:	83 ec 0c             	sub    $0xc,%esp
+f0101809:	89 f0                	mov    %esi,%eax
+f010180b:	03 05 68 c2 7f f0    	add    0xf07fc268,%eax
+f0101811:	50                   	push   %eax
+f0101812:	e8 24 fa ff ff       	call   f010123b <buddy_free_pages>
+f0101817:	83 c4 10             	add    $0x10,%esp
+	for (size_t i = 0; i < npages; i++) {
+f010181a:	83 c7 01             	add    $0x1,%edi
+f010181d:	83 c6 0c             	add    $0xc,%esi
+f0101820:	3b 3d ac c2 7f f0    	cmp    0xf07fc2ac,%edi
+f0101826:	73 42                	jae    f010186a <page_init+0xf5>
+	size_t off = pp - pool.pages;
+f0101828:	89 f3                	mov    %esi,%ebx
+f010182a:	c1 fb 02             	sar    $0x2,%ebx
+f010182d:	69 db ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%ebx
+	return off == 0 || off == PGNUM(MPENTRY_PADDR) ||
+f0101833:	85 db                	test   %ebx,%ebx
+f0101835:	74 e3                	je     f010181a <page_init+0xa5>
+f0101837:	83 fb 07             	cmp    $0x7,%ebx
+f010183a:	74 de                	je     f010181a <page_init+0xa5>
+f010183c:	3b 1d 00 c3 7f f0    	cmp    0xf07fc300,%ebx
+f0101842:	72 c2                	jb     f0101806 <page_init+0x91>
+	       (off >= npages_basemem && off < PGNUM(PADDR(boot_alloc(0))));
+f0101844:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101849:	e8 5c f4 ff ff       	call   f0100caa <boot_alloc>
+	if ((uint32_t)kva < KERNBASE)
+f010184e:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0101853:	77 a5                	ja     f01017fa <page_init+0x85>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101855:	50                   	push   %eax
+f0101856:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f010185b:	68 80 01 00 00       	push   $0x180
+f0101860:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101865:	e8 df e7 ff ff       	call   f0100049 <_panic>
+}
+f010186a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010186d:	5b                   	pop    %ebx
+f010186e:	5e                   	pop    %esi
+f010186f:	5f                   	pop    %edi
+f0101870:	5d                   	pop    %ebp
+f0101871:	c3                   	ret
+
+f0101872 <page_alloc>:
+{
+f0101872:	55                   	push   %ebp
+f0101873:	89 e5                	mov    %esp,%ebp
+f0101875:	53                   	push   %ebx
+f0101876:	83 ec 10             	sub    $0x10,%esp
+	if (!(pp = buddy_get_pages(0)))
+f0101879:	6a 00                	push   $0x0
+f010187b:	e8 9c f8 ff ff       	call   f010111c <buddy_get_pages>
+f0101880:	89 c3                	mov    %eax,%ebx
+f0101882:	83 c4 10             	add    $0x10,%esp
+f0101885:	85 c0                	test   %eax,%eax
+f0101887:	74 06                	je     f010188f <page_alloc+0x1d>
+	if (alloc_flags & ALLOC_ZERO)
+f0101889:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+f010188d:	75 07                	jne    f0101896 <page_alloc+0x24>
+}
+f010188f:	89 d8                	mov    %ebx,%eax
+f0101891:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101894:	c9                   	leave
+f0101895:	c3                   	ret
+	return (pp - pool.pages) << PGSHIFT;
+f0101896:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f010189c:	c1 f8 02             	sar    $0x2,%eax
+f010189f:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01018a5:	89 c2                	mov    %eax,%edx
+f01018a7:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01018aa:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01018af:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f01018b5:	73 1b                	jae    f01018d2 <page_alloc+0x60>
+		memset(page2kva(pp), 0, PGSIZE);
+f01018b7:	83 ec 04             	sub    $0x4,%esp
+f01018ba:	68 00 10 00 00       	push   $0x1000
+f01018bf:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f01018c1:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01018c7:	52                   	push   %edx
+f01018c8:	e8 39 55 00 00       	call   f0106e06 <memset>
+f01018cd:	83 c4 10             	add    $0x10,%esp
+f01018d0:	eb bd                	jmp    f010188f <page_alloc+0x1d>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01018d2:	52                   	push   %edx
+f01018d3:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f01018d8:	6a 5f                	push   $0x5f
+f01018da:	68 31 ba 10 f0       	push   $0xf010ba31
+f01018df:	e8 65 e7 ff ff       	call   f0100049 <_panic>
+
+f01018e4 <page_free>:
+{
+f01018e4:	55                   	push   %ebp
+f01018e5:	89 e5                	mov    %esp,%ebp
+f01018e7:	83 ec 08             	sub    $0x8,%esp
+f01018ea:	8b 45 08             	mov    0x8(%ebp),%eax
+	assert(pp->pp_ref == 0);
+f01018ed:	66 83 78 08 00       	cmpw   $0x0,0x8(%eax)
+f01018f2:	75 0e                	jne    f0101902 <page_free+0x1e>
+	buddy_free_pages(pp);
+f01018f4:	83 ec 0c             	sub    $0xc,%esp
+f01018f7:	50                   	push   %eax
+f01018f8:	e8 3e f9 ff ff       	call   f010123b <buddy_free_pages>
+}
+f01018fd:	83 c4 10             	add    $0x10,%esp
+f0101900:	c9                   	leave
+f0101901:	c3                   	ret
+	assert(pp->pp_ref == 0);
+f0101902:	68 00 bb 10 f0       	push   $0xf010bb00
+f0101907:	68 25 aa 10 f0       	push   $0xf010aa25
+f010190c:	68 d2 01 00 00       	push   $0x1d2
+f0101911:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101916:	e8 2e e7 ff ff       	call   f0100049 <_panic>
+
+f010191b <page_decref>:
+{
+f010191b:	55                   	push   %ebp
+f010191c:	89 e5                	mov    %esp,%ebp
+f010191e:	83 ec 08             	sub    $0x8,%esp
+f0101921:	8b 55 08             	mov    0x8(%ebp),%edx
+	assert(pp->pp_ref != 0);
+f0101924:	0f b7 42 08          	movzwl 0x8(%edx),%eax
+f0101928:	66 85 c0             	test   %ax,%ax
+f010192b:	74 0e                	je     f010193b <page_decref+0x20>
+	if (--pp->pp_ref == 0)
+f010192d:	83 e8 01             	sub    $0x1,%eax
+f0101930:	66 89 42 08          	mov    %ax,0x8(%edx)
+f0101934:	66 85 c0             	test   %ax,%ax
+f0101937:	74 1b                	je     f0101954 <page_decref+0x39>
+}
+f0101939:	c9                   	leave
+f010193a:	c3                   	ret
+	assert(pp->pp_ref != 0);
+f010193b:	68 10 bb 10 f0       	push   $0xf010bb10
+f0101940:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101945:	68 de 01 00 00       	push   $0x1de
+f010194a:	68 25 ba 10 f0       	push   $0xf010ba25
+f010194f:	e8 f5 e6 ff ff       	call   f0100049 <_panic>
+		page_free(pp);
+f0101954:	83 ec 0c             	sub    $0xc,%esp
+f0101957:	52                   	push   %edx
+f0101958:	e8 87 ff ff ff       	call   f01018e4 <page_free>
+f010195d:	83 c4 10             	add    $0x10,%esp
+}
+f0101960:	eb d7                	jmp    f0101939 <page_decref+0x1e>
+
+f0101962 <pgdir_walk>:
+{
+f0101962:	55                   	push   %ebp
+f0101963:	89 e5                	mov    %esp,%ebp
+f0101965:	56                   	push   %esi
+f0101966:	53                   	push   %ebx
+f0101967:	8b 75 0c             	mov    0xc(%ebp),%esi
+f010196a:	8b 55 10             	mov    0x10(%ebp),%edx
+	pde_t *pde = &pgdir[PDX(va)];
+f010196d:	89 f3                	mov    %esi,%ebx
+f010196f:	c1 eb 16             	shr    $0x16,%ebx
+f0101972:	c1 e3 02             	shl    $0x2,%ebx
+f0101975:	03 5d 08             	add    0x8(%ebp),%ebx
+	assert((*pde & PTE_PS) == 0);
+f0101978:	8b 03                	mov    (%ebx),%eax
+f010197a:	a8 80                	test   $0x80,%al
+f010197c:	75 65                	jne    f01019e3 <pgdir_walk+0x81>
+	if (!(*pde & PTE_P)) {
+f010197e:	a8 01                	test   $0x1,%al
+f0101980:	75 35                	jne    f01019b7 <pgdir_walk+0x55>
+		if (!create || !(pp = page_alloc(ALLOC_ZERO)))
+f0101982:	84 d2                	test   %dl,%dl
+f0101984:	0f 84 87 00 00 00    	je     f0101a11 <pgdir_walk+0xaf>
+f010198a:	83 ec 0c             	sub    $0xc,%esp
+f010198d:	6a 01                	push   $0x1
+f010198f:	e8 de fe ff ff       	call   f0101872 <page_alloc>
+f0101994:	83 c4 10             	add    $0x10,%esp
+f0101997:	85 c0                	test   %eax,%eax
+f0101999:	74 41                	je     f01019dc <pgdir_walk+0x7a>
+		pp->pp_ref++;
+f010199b:	66 83 40 08 01       	addw   $0x1,0x8(%eax)
+	return (pp - pool.pages) << PGSHIFT;
+f01019a0:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f01019a6:	c1 f8 02             	sar    $0x2,%eax
+f01019a9:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01019af:	c1 e0 0c             	shl    $0xc,%eax
+		*pde = page2pa(pp) | PTE_U | PTE_W | PTE_P;
+f01019b2:	83 c8 07             	or     $0x7,%eax
+f01019b5:	89 03                	mov    %eax,(%ebx)
+	pgtbl = KADDR(PTE_ADDR(*pde));
+f01019b7:	8b 03                	mov    (%ebx),%eax
+f01019b9:	89 c2                	mov    %eax,%edx
+f01019bb:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	if (PGNUM(pa) >= npages)
+f01019c1:	c1 e8 0c             	shr    $0xc,%eax
+f01019c4:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f01019ca:	73 30                	jae    f01019fc <pgdir_walk+0x9a>
+	return &pgtbl[PTX(va)];
+f01019cc:	c1 ee 0a             	shr    $0xa,%esi
+f01019cf:	81 e6 fc 0f 00 00    	and    $0xffc,%esi
+f01019d5:	8d 84 32 00 00 00 f0 	lea    -0x10000000(%edx,%esi,1),%eax
+}
+f01019dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01019df:	5b                   	pop    %ebx
+f01019e0:	5e                   	pop    %esi
+f01019e1:	5d                   	pop    %ebp
+f01019e2:	c3                   	ret
+	assert((*pde & PTE_PS) == 0);
+f01019e3:	68 20 bb 10 f0       	push   $0xf010bb20
+f01019e8:	68 25 aa 10 f0       	push   $0xf010aa25
+f01019ed:	68 02 02 00 00       	push   $0x202
+f01019f2:	68 25 ba 10 f0       	push   $0xf010ba25
+f01019f7:	e8 4d e6 ff ff       	call   f0100049 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01019fc:	52                   	push   %edx
+f01019fd:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0101a02:	68 0c 02 00 00       	push   $0x20c
+f0101a07:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101a0c:	e8 38 e6 ff ff       	call   f0100049 <_panic>
+			return NULL;
+f0101a11:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101a16:	eb c4                	jmp    f01019dc <pgdir_walk+0x7a>
+
+f0101a18 <boot_map_region>:
+{
+f0101a18:	55                   	push   %ebp
+f0101a19:	89 e5                	mov    %esp,%ebp
+f0101a1b:	57                   	push   %edi
+f0101a1c:	56                   	push   %esi
+f0101a1d:	53                   	push   %ebx
+f0101a1e:	83 ec 1c             	sub    $0x1c,%esp
+	assert(va >= UTOP);
+f0101a21:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f0101a27:	76 4d                	jbe    f0101a76 <boot_map_region+0x5e>
+	if (perm & PTE_PS) {
+f0101a29:	f6 45 0c 80          	testb  $0x80,0xc(%ebp)
+f0101a2d:	0f 85 82 00 00 00    	jne    f0101ab5 <boot_map_region+0x9d>
+f0101a33:	89 ce                	mov    %ecx,%esi
+f0101a35:	89 cf                	mov    %ecx,%edi
+f0101a37:	03 7d 08             	add    0x8(%ebp),%edi
+		pte_t *pte = pgdir_walk(pgdir, (void *) va, true);
+f0101a3a:	8d 0c 0a             	lea    (%edx,%ecx,1),%ecx
+f0101a3d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+f0101a40:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0101a43:	89 c7                	mov    %eax,%edi
+f0101a45:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0101a48:	29 f3                	sub    %esi,%ebx
+	for ( ; size > 0; size -= PGSIZE) {
+f0101a4a:	85 f6                	test   %esi,%esi
+f0101a4c:	74 5f                	je     f0101aad <boot_map_region+0x95>
+		pte_t *pte = pgdir_walk(pgdir, (void *) va, true);
+f0101a4e:	83 ec 04             	sub    $0x4,%esp
+f0101a51:	6a 01                	push   $0x1
+f0101a53:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101a56:	29 f0                	sub    %esi,%eax
+f0101a58:	50                   	push   %eax
+f0101a59:	57                   	push   %edi
+f0101a5a:	e8 03 ff ff ff       	call   f0101962 <pgdir_walk>
+		assert(pte != NULL);
+f0101a5f:	83 c4 10             	add    $0x10,%esp
+f0101a62:	85 c0                	test   %eax,%eax
+f0101a64:	74 59                	je     f0101abf <boot_map_region+0xa7>
+		*pte = pa | perm | PTE_P;
+f0101a66:	0b 5d 0c             	or     0xc(%ebp),%ebx
+f0101a69:	83 cb 01             	or     $0x1,%ebx
+f0101a6c:	89 18                	mov    %ebx,(%eax)
+	for ( ; size > 0; size -= PGSIZE) {
+f0101a6e:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+f0101a74:	eb cf                	jmp    f0101a45 <boot_map_region+0x2d>
+	assert(va >= UTOP);
+f0101a76:	68 35 bb 10 f0       	push   $0xf010bb35
+f0101a7b:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101a80:	68 1f 02 00 00       	push   $0x21f
+f0101a85:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101a8a:	e8 ba e5 ff ff       	call   f0100049 <_panic>
+			pgdir[PDX(va)] = pa | perm | PTE_P;
+f0101a8f:	c1 eb 16             	shr    $0x16,%ebx
+f0101a92:	0b 55 0c             	or     0xc(%ebp),%edx
+f0101a95:	83 ca 01             	or     $0x1,%edx
+f0101a98:	89 14 98             	mov    %edx,(%eax,%ebx,4)
+		for ( ; size > 0; size -= PTSIZE) {
+f0101a9b:	81 ee 00 00 40 00    	sub    $0x400000,%esi
+f0101aa1:	89 fb                	mov    %edi,%ebx
+f0101aa3:	29 f3                	sub    %esi,%ebx
+f0101aa5:	89 ca                	mov    %ecx,%edx
+f0101aa7:	29 f2                	sub    %esi,%edx
+f0101aa9:	85 f6                	test   %esi,%esi
+f0101aab:	75 e2                	jne    f0101a8f <boot_map_region+0x77>
+}
+f0101aad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101ab0:	5b                   	pop    %ebx
+f0101ab1:	5e                   	pop    %esi
+f0101ab2:	5f                   	pop    %edi
+f0101ab3:	5d                   	pop    %ebp
+f0101ab4:	c3                   	ret
+f0101ab5:	89 ce                	mov    %ecx,%esi
+f0101ab7:	8d 3c 0a             	lea    (%edx,%ecx,1),%edi
+f0101aba:	03 4d 08             	add    0x8(%ebp),%ecx
+f0101abd:	eb e2                	jmp    f0101aa1 <boot_map_region+0x89>
+		assert(pte != NULL);
+f0101abf:	68 40 bb 10 f0       	push   $0xf010bb40
+f0101ac4:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101ac9:	68 2d 02 00 00       	push   $0x22d
+f0101ace:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101ad3:	e8 71 e5 ff ff       	call   f0100049 <_panic>
+
+f0101ad8 <page_lookup>:
+{
+f0101ad8:	55                   	push   %ebp
+f0101ad9:	89 e5                	mov    %esp,%ebp
+f0101adb:	53                   	push   %ebx
+f0101adc:	83 ec 08             	sub    $0x8,%esp
+f0101adf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	pte_t *pte = pgdir_walk(pgdir, va, false);
+f0101ae2:	6a 00                	push   $0x0
+f0101ae4:	ff 75 0c             	push   0xc(%ebp)
+f0101ae7:	ff 75 08             	push   0x8(%ebp)
+f0101aea:	e8 73 fe ff ff       	call   f0101962 <pgdir_walk>
+	if (!pte || !(*pte & PTE_P))
+f0101aef:	83 c4 10             	add    $0x10,%esp
+f0101af2:	85 c0                	test   %eax,%eax
+f0101af4:	74 5e                	je     f0101b54 <page_lookup+0x7c>
+f0101af6:	8b 10                	mov    (%eax),%edx
+f0101af8:	f6 c2 01             	test   $0x1,%dl
+f0101afb:	74 5b                	je     f0101b58 <page_lookup+0x80>
+	if (PGNUM(pa) >= npages)
+f0101afd:	c1 ea 0c             	shr    $0xc,%edx
+f0101b00:	3b 15 ac c2 7f f0    	cmp    0xf07fc2ac,%edx
+f0101b06:	73 1f                	jae    f0101b27 <page_lookup+0x4f>
+	return &pool.pages[PGNUM(pa)];
+f0101b08:	8d 0c 52             	lea    (%edx,%edx,2),%ecx
+f0101b0b:	8b 15 68 c2 7f f0    	mov    0xf07fc268,%edx
+f0101b11:	8d 14 8a             	lea    (%edx,%ecx,4),%edx
+	assert(pp->pp_order == 0);
+f0101b14:	80 7a 0a 00          	cmpb   $0x0,0xa(%edx)
+f0101b18:	75 21                	jne    f0101b3b <page_lookup+0x63>
+	if (pte_store)
+f0101b1a:	85 db                	test   %ebx,%ebx
+f0101b1c:	74 02                	je     f0101b20 <page_lookup+0x48>
+		*pte_store = pte;
+f0101b1e:	89 03                	mov    %eax,(%ebx)
+}
+f0101b20:	89 d0                	mov    %edx,%eax
+f0101b22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101b25:	c9                   	leave
+f0101b26:	c3                   	ret
+		panic("pa2page called with invalid pa");
+f0101b27:	83 ec 04             	sub    $0x4,%esp
+f0101b2a:	68 94 b0 10 f0       	push   $0xf010b094
+f0101b2f:	6a 58                	push   $0x58
+f0101b31:	68 31 ba 10 f0       	push   $0xf010ba31
+f0101b36:	e8 0e e5 ff ff       	call   f0100049 <_panic>
+	assert(pp->pp_order == 0);
+f0101b3b:	68 4c bb 10 f0       	push   $0xf010bb4c
+f0101b40:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101b45:	68 72 02 00 00       	push   $0x272
+f0101b4a:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101b4f:	e8 f5 e4 ff ff       	call   f0100049 <_panic>
+		return NULL;
+f0101b54:	89 c2                	mov    %eax,%edx
+f0101b56:	eb c8                	jmp    f0101b20 <page_lookup+0x48>
+f0101b58:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101b5d:	eb c1                	jmp    f0101b20 <page_lookup+0x48>
+
+f0101b5f <tlb_invalidate>:
+{
+f0101b5f:	55                   	push   %ebp
+f0101b60:	89 e5                	mov    %esp,%ebp
+f0101b62:	83 ec 08             	sub    $0x8,%esp
+	if (!curenv || curenv->env_pgdir == pgdir)
+f0101b65:	e8 89 58 00 00       	call   f01073f3 <cpunum>
+f0101b6a:	6b c0 74             	imul   $0x74,%eax,%eax
+f0101b6d:	83 b8 28 d0 83 f0 00 	cmpl   $0x0,-0xf7c2fd8(%eax)
+f0101b74:	74 16                	je     f0101b8c <tlb_invalidate+0x2d>
+f0101b76:	e8 78 58 00 00       	call   f01073f3 <cpunum>
+f0101b7b:	6b c0 74             	imul   $0x74,%eax,%eax
+f0101b7e:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0101b84:	8b 55 08             	mov    0x8(%ebp),%edx
+f0101b87:	39 50 60             	cmp    %edx,0x60(%eax)
+f0101b8a:	75 06                	jne    f0101b92 <tlb_invalidate+0x33>
+	asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+f0101b8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101b8f:	0f 01 38             	invlpg (%eax)
+}
+f0101b92:	c9                   	leave
+f0101b93:	c3                   	ret
+
+f0101b94 <page_remove>:
+{
+f0101b94:	55                   	push   %ebp
+f0101b95:	89 e5                	mov    %esp,%ebp
+f0101b97:	56                   	push   %esi
+f0101b98:	53                   	push   %ebx
+f0101b99:	83 ec 14             	sub    $0x14,%esp
+f0101b9c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0101b9f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (!(pp = page_lookup(pgdir, va, &pte)))
+f0101ba2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f0101ba5:	50                   	push   %eax
+f0101ba6:	56                   	push   %esi
+f0101ba7:	53                   	push   %ebx
+f0101ba8:	e8 2b ff ff ff       	call   f0101ad8 <page_lookup>
+f0101bad:	83 c4 10             	add    $0x10,%esp
+f0101bb0:	85 c0                	test   %eax,%eax
+f0101bb2:	74 1f                	je     f0101bd3 <page_remove+0x3f>
+	page_decref(pp);
+f0101bb4:	83 ec 0c             	sub    $0xc,%esp
+f0101bb7:	50                   	push   %eax
+f0101bb8:	e8 5e fd ff ff       	call   f010191b <page_decref>
+	*pte = 0;
+f0101bbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0101bc0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	tlb_invalidate(pgdir, va);
+f0101bc6:	83 c4 08             	add    $0x8,%esp
+f0101bc9:	56                   	push   %esi
+f0101bca:	53                   	push   %ebx
+f0101bcb:	e8 8f ff ff ff       	call   f0101b5f <tlb_invalidate>
+f0101bd0:	83 c4 10             	add    $0x10,%esp
+}
+f0101bd3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101bd6:	5b                   	pop    %ebx
+f0101bd7:	5e                   	pop    %esi
+f0101bd8:	5d                   	pop    %ebp
+f0101bd9:	c3                   	ret
+
+f0101bda <page_insert>:
+{
+f0101bda:	55                   	push   %ebp
+f0101bdb:	89 e5                	mov    %esp,%ebp
+f0101bdd:	57                   	push   %edi
+f0101bde:	56                   	push   %esi
+f0101bdf:	53                   	push   %ebx
+f0101be0:	83 ec 10             	sub    $0x10,%esp
+f0101be3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0101be6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	pte_t *pte = pgdir_walk(pgdir, va, true);
+f0101be9:	6a 01                	push   $0x1
+f0101beb:	57                   	push   %edi
+f0101bec:	ff 75 08             	push   0x8(%ebp)
+f0101bef:	e8 6e fd ff ff       	call   f0101962 <pgdir_walk>
+	assert(pp->pp_order == 0);
+f0101bf4:	83 c4 10             	add    $0x10,%esp
+f0101bf7:	80 7b 0a 00          	cmpb   $0x0,0xa(%ebx)
+f0101bfb:	75 37                	jne    f0101c34 <page_insert+0x5a>
+f0101bfd:	89 c6                	mov    %eax,%esi
+	if (!pte)
+f0101bff:	85 c0                	test   %eax,%eax
+f0101c01:	74 5b                	je     f0101c5e <page_insert+0x84>
+	pp->pp_ref++;
+f0101c03:	66 83 43 08 01       	addw   $0x1,0x8(%ebx)
+	if (*pte & PTE_P)
+f0101c08:	f6 00 01             	testb  $0x1,(%eax)
+f0101c0b:	75 40                	jne    f0101c4d <page_insert+0x73>
+	return (pp - pool.pages) << PGSHIFT;
+f0101c0d:	2b 1d 68 c2 7f f0    	sub    0xf07fc268,%ebx
+f0101c13:	c1 fb 02             	sar    $0x2,%ebx
+f0101c16:	69 db ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%ebx
+f0101c1c:	c1 e3 0c             	shl    $0xc,%ebx
+	*pte = page2pa(pp) | perm | PTE_P;
+f0101c1f:	0b 5d 14             	or     0x14(%ebp),%ebx
+f0101c22:	83 cb 01             	or     $0x1,%ebx
+f0101c25:	89 1e                	mov    %ebx,(%esi)
+	return 0;
+f0101c27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0101c2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101c2f:	5b                   	pop    %ebx
+f0101c30:	5e                   	pop    %esi
+f0101c31:	5f                   	pop    %edi
+f0101c32:	5d                   	pop    %ebp
+f0101c33:	c3                   	ret
+	assert(pp->pp_order == 0);
+f0101c34:	68 4c bb 10 f0       	push   $0xf010bb4c
+f0101c39:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101c3e:	68 53 02 00 00       	push   $0x253
+f0101c43:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101c48:	e8 fc e3 ff ff       	call   f0100049 <_panic>
+		page_remove(pgdir, va);
+f0101c4d:	83 ec 08             	sub    $0x8,%esp
+f0101c50:	57                   	push   %edi
+f0101c51:	ff 75 08             	push   0x8(%ebp)
+f0101c54:	e8 3b ff ff ff       	call   f0101b94 <page_remove>
+f0101c59:	83 c4 10             	add    $0x10,%esp
+f0101c5c:	eb af                	jmp    f0101c0d <page_insert+0x33>
+		return -E_NO_MEM;
+f0101c5e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101c63:	eb c7                	jmp    f0101c2c <page_insert+0x52>
+
+f0101c65 <mmio_map_region>:
+{
+f0101c65:	55                   	push   %ebp
+f0101c66:	89 e5                	mov    %esp,%ebp
+f0101c68:	53                   	push   %ebx
+f0101c69:	83 ec 0c             	sub    $0xc,%esp
+f0101c6c:	8b 45 08             	mov    0x8(%ebp),%eax
+	uintptr_t result = base;
+f0101c6f:	8b 1d 00 63 11 f0    	mov    0xf0116300,%ebx
+	base += ROUNDUP(size + PGOFF(pa), PGSIZE);
+f0101c75:	89 c2                	mov    %eax,%edx
+f0101c77:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+f0101c7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0101c80:	8d 8c 11 ff 0f 00 00 	lea    0xfff(%ecx,%edx,1),%ecx
+f0101c87:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+f0101c8d:	8d 14 0b             	lea    (%ebx,%ecx,1),%edx
+f0101c90:	89 15 00 63 11 f0    	mov    %edx,0xf0116300
+	boot_map_region(kern_pgdir, result, base - result, pa,
+f0101c96:	6a 1a                	push   $0x1a
+	pa = ROUNDDOWN(pa, PGSIZE);
+f0101c98:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	boot_map_region(kern_pgdir, result, base - result, pa,
+f0101c9d:	50                   	push   %eax
+f0101c9e:	89 da                	mov    %ebx,%edx
+f0101ca0:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+f0101ca5:	e8 6e fd ff ff       	call   f0101a18 <boot_map_region>
+}
+f0101caa:	89 d8                	mov    %ebx,%eax
+f0101cac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101caf:	c9                   	leave
+f0101cb0:	c3                   	ret
+
+f0101cb1 <mem_init>:
+{
+f0101cb1:	55                   	push   %ebp
+f0101cb2:	89 e5                	mov    %esp,%ebp
+f0101cb4:	57                   	push   %edi
+f0101cb5:	56                   	push   %esi
+f0101cb6:	53                   	push   %ebx
+f0101cb7:	83 ec 3c             	sub    $0x3c,%esp
+	basemem = nvram_read(NVRAM_BASELO);
+f0101cba:	b8 15 00 00 00       	mov    $0x15,%eax
+f0101cbf:	e8 5e f0 ff ff       	call   f0100d22 <nvram_read>
+f0101cc4:	89 c3                	mov    %eax,%ebx
+	extmem = nvram_read(NVRAM_EXTLO);
+f0101cc6:	b8 17 00 00 00       	mov    $0x17,%eax
+f0101ccb:	e8 52 f0 ff ff       	call   f0100d22 <nvram_read>
+f0101cd0:	89 c6                	mov    %eax,%esi
+	ext16mem = nvram_read(NVRAM_EXT16LO) * 64;
+f0101cd2:	b8 34 00 00 00       	mov    $0x34,%eax
+f0101cd7:	e8 46 f0 ff ff       	call   f0100d22 <nvram_read>
+	if (ext16mem)
+f0101cdc:	c1 e0 06             	shl    $0x6,%eax
+f0101cdf:	0f 84 b5 00 00 00    	je     f0101d9a <mem_init+0xe9>
+		totalmem = 16 * 1024 + ext16mem;
+f0101ce5:	05 00 40 00 00       	add    $0x4000,%eax
+	npages = totalmem / (PGSIZE / 1024);
+f0101cea:	89 c2                	mov    %eax,%edx
+f0101cec:	c1 ea 02             	shr    $0x2,%edx
+f0101cef:	89 15 ac c2 7f f0    	mov    %edx,0xf07fc2ac
+	npages_basemem = basemem / (PGSIZE / 1024);
+f0101cf5:	89 da                	mov    %ebx,%edx
+f0101cf7:	c1 ea 02             	shr    $0x2,%edx
+f0101cfa:	89 15 00 c3 7f f0    	mov    %edx,0xf07fc300
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+f0101d00:	89 c2                	mov    %eax,%edx
+f0101d02:	29 da                	sub    %ebx,%edx
+f0101d04:	52                   	push   %edx
+f0101d05:	53                   	push   %ebx
+f0101d06:	50                   	push   %eax
+f0101d07:	68 08 b2 10 f0       	push   $0xf010b208
+f0101d0c:	e8 d0 26 00 00       	call   f01043e1 <cprintf>
+	kern_pgdir = (pde_t *) boot_alloc(PGSIZE);
+f0101d11:	b8 00 10 00 00       	mov    $0x1000,%eax
+f0101d16:	e8 8f ef ff ff       	call   f0100caa <boot_alloc>
+f0101d1b:	a3 a8 c2 7f f0       	mov    %eax,0xf07fc2a8
+	memset(kern_pgdir, 0, PGSIZE);
+f0101d20:	83 c4 0c             	add    $0xc,%esp
+f0101d23:	68 00 10 00 00       	push   $0x1000
+f0101d28:	6a 00                	push   $0x0
+f0101d2a:	50                   	push   %eax
+f0101d2b:	e8 d6 50 00 00       	call   f0106e06 <memset>
+	kern_pgdir[PDX(UVPT)] = PADDR(kern_pgdir) | PTE_U | PTE_P;
+f0101d30:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0101d35:	83 c4 10             	add    $0x10,%esp
+f0101d38:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0101d3d:	76 6b                	jbe    f0101daa <mem_init+0xf9>
+	return (physaddr_t)kva - KERNBASE;
+f0101d3f:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f0101d45:	83 ca 05             	or     $0x5,%edx
+f0101d48:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+	envs = boot_alloc(sizeof(struct Env) * NENV);
+f0101d4e:	b8 00 30 02 00       	mov    $0x23000,%eax
+f0101d53:	e8 52 ef ff ff       	call   f0100caa <boot_alloc>
+f0101d58:	a3 04 c3 7f f0       	mov    %eax,0xf07fc304
+	page_init();
+f0101d5d:	e8 13 fa ff ff       	call   f0101775 <page_init>
+	check_buddy();
+f0101d62:	e8 3c f6 ff ff       	call   f01013a3 <check_buddy>
+	check_page_free_list(1);
+f0101d67:	b8 01 00 00 00       	mov    $0x1,%eax
+f0101d6c:	e8 ab f1 ff ff       	call   f0100f1c <check_page_free_list>
+	if (!pool.pages)
+f0101d71:	a1 68 c2 7f f0       	mov    0xf07fc268,%eax
+f0101d76:	85 c0                	test   %eax,%eax
+f0101d78:	74 45                	je     f0101dbf <mem_init+0x10e>
+	for (pp = pool.pages, nfree = 0; pp < &pool.pages[npages]; pp++)
+f0101d7a:	8b 15 ac c2 7f f0    	mov    0xf07fc2ac,%edx
+f0101d80:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f0101d83:	8d 14 90             	lea    (%eax,%edx,4),%edx
+f0101d86:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101d8b:	39 d0                	cmp    %edx,%eax
+f0101d8d:	73 47                	jae    f0101dd6 <mem_init+0x125>
+			++nfree;
+f0101d8f:	83 38 01             	cmpl   $0x1,(%eax)
+f0101d92:	83 db ff             	sbb    $0xffffffff,%ebx
+	for (pp = pool.pages, nfree = 0; pp < &pool.pages[npages]; pp++)
+f0101d95:	83 c0 0c             	add    $0xc,%eax
+f0101d98:	eb f1                	jmp    f0101d8b <mem_init+0xda>
+		totalmem = 1 * 1024 + extmem;
+f0101d9a:	8d 86 00 04 00 00    	lea    0x400(%esi),%eax
+f0101da0:	85 f6                	test   %esi,%esi
+f0101da2:	0f 44 c3             	cmove  %ebx,%eax
+f0101da5:	e9 40 ff ff ff       	jmp    f0101cea <mem_init+0x39>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101daa:	50                   	push   %eax
+f0101dab:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0101db0:	68 91 00 00 00       	push   $0x91
+f0101db5:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101dba:	e8 8a e2 ff ff       	call   f0100049 <_panic>
+		panic("'pages' is a null pointer!");
+f0101dbf:	83 ec 04             	sub    $0x4,%esp
+f0101dc2:	68 5e bb 10 f0       	push   $0xf010bb5e
+f0101dc7:	68 d9 03 00 00       	push   $0x3d9
+f0101dcc:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101dd1:	e8 73 e2 ff ff       	call   f0100049 <_panic>
+	assert((pp0 = page_alloc(0)));
+f0101dd6:	83 ec 0c             	sub    $0xc,%esp
+f0101dd9:	6a 00                	push   $0x0
+f0101ddb:	e8 92 fa ff ff       	call   f0101872 <page_alloc>
+f0101de0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0101de3:	83 c4 10             	add    $0x10,%esp
+f0101de6:	85 c0                	test   %eax,%eax
+f0101de8:	0f 84 0e 02 00 00    	je     f0101ffc <mem_init+0x34b>
+	assert((pp1 = page_alloc(0)));
+f0101dee:	83 ec 0c             	sub    $0xc,%esp
+f0101df1:	6a 00                	push   $0x0
+f0101df3:	e8 7a fa ff ff       	call   f0101872 <page_alloc>
+f0101df8:	89 c7                	mov    %eax,%edi
+f0101dfa:	83 c4 10             	add    $0x10,%esp
+f0101dfd:	85 c0                	test   %eax,%eax
+f0101dff:	0f 84 10 02 00 00    	je     f0102015 <mem_init+0x364>
+	assert((pp2 = page_alloc(0)));
+f0101e05:	83 ec 0c             	sub    $0xc,%esp
+f0101e08:	6a 00                	push   $0x0
+f0101e0a:	e8 63 fa ff ff       	call   f0101872 <page_alloc>
+f0101e0f:	89 c6                	mov    %eax,%esi
+f0101e11:	83 c4 10             	add    $0x10,%esp
+f0101e14:	85 c0                	test   %eax,%eax
+f0101e16:	0f 84 12 02 00 00    	je     f010202e <mem_init+0x37d>
+	assert(pp1 && pp1 != pp0);
+f0101e1c:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0101e1f:	0f 84 22 02 00 00    	je     f0102047 <mem_init+0x396>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0101e25:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f0101e28:	0f 84 32 02 00 00    	je     f0102060 <mem_init+0x3af>
+f0101e2e:	39 c7                	cmp    %eax,%edi
+f0101e30:	0f 84 2a 02 00 00    	je     f0102060 <mem_init+0x3af>
+	return (pp - pool.pages) << PGSHIFT;
+f0101e36:	8b 0d 68 c2 7f f0    	mov    0xf07fc268,%ecx
+	assert(page2pa(pp0) < npages*PGSIZE);
+f0101e3c:	8b 15 ac c2 7f f0    	mov    0xf07fc2ac,%edx
+f0101e42:	c1 e2 0c             	shl    $0xc,%edx
+f0101e45:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101e48:	29 c8                	sub    %ecx,%eax
+f0101e4a:	c1 f8 02             	sar    $0x2,%eax
+f0101e4d:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0101e53:	c1 e0 0c             	shl    $0xc,%eax
+f0101e56:	39 d0                	cmp    %edx,%eax
+f0101e58:	0f 83 1b 02 00 00    	jae    f0102079 <mem_init+0x3c8>
+f0101e5e:	89 f8                	mov    %edi,%eax
+f0101e60:	29 c8                	sub    %ecx,%eax
+f0101e62:	c1 f8 02             	sar    $0x2,%eax
+f0101e65:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0101e6b:	c1 e0 0c             	shl    $0xc,%eax
+	assert(page2pa(pp1) < npages*PGSIZE);
+f0101e6e:	39 d0                	cmp    %edx,%eax
+f0101e70:	0f 83 1c 02 00 00    	jae    f0102092 <mem_init+0x3e1>
+f0101e76:	89 f0                	mov    %esi,%eax
+f0101e78:	29 c8                	sub    %ecx,%eax
+f0101e7a:	c1 f8 02             	sar    $0x2,%eax
+f0101e7d:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0101e83:	c1 e0 0c             	shl    $0xc,%eax
+	assert(page2pa(pp2) < npages*PGSIZE);
+f0101e86:	39 d0                	cmp    %edx,%eax
+f0101e88:	0f 83 1d 02 00 00    	jae    f01020ab <mem_init+0x3fa>
+	steal_buddy_memory();
+f0101e8e:	e8 b8 ee ff ff       	call   f0100d4b <steal_buddy_memory>
+	assert(!page_alloc(0));
+f0101e93:	83 ec 0c             	sub    $0xc,%esp
+f0101e96:	6a 00                	push   $0x0
+f0101e98:	e8 d5 f9 ff ff       	call   f0101872 <page_alloc>
+f0101e9d:	83 c4 10             	add    $0x10,%esp
+f0101ea0:	85 c0                	test   %eax,%eax
+f0101ea2:	0f 85 1c 02 00 00    	jne    f01020c4 <mem_init+0x413>
+	page_free(pp0);
+f0101ea8:	83 ec 0c             	sub    $0xc,%esp
+f0101eab:	ff 75 d4             	push   -0x2c(%ebp)
+f0101eae:	e8 31 fa ff ff       	call   f01018e4 <page_free>
+	page_free(pp1);
+f0101eb3:	89 3c 24             	mov    %edi,(%esp)
+f0101eb6:	e8 29 fa ff ff       	call   f01018e4 <page_free>
+	page_free(pp2);
+f0101ebb:	89 34 24             	mov    %esi,(%esp)
+f0101ebe:	e8 21 fa ff ff       	call   f01018e4 <page_free>
+	assert((pp0 = page_alloc(0)));
+f0101ec3:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f0101eca:	e8 a3 f9 ff ff       	call   f0101872 <page_alloc>
+f0101ecf:	89 c6                	mov    %eax,%esi
+f0101ed1:	83 c4 10             	add    $0x10,%esp
+f0101ed4:	85 c0                	test   %eax,%eax
+f0101ed6:	0f 84 01 02 00 00    	je     f01020dd <mem_init+0x42c>
+	assert((pp1 = page_alloc(0)));
+f0101edc:	83 ec 0c             	sub    $0xc,%esp
+f0101edf:	6a 00                	push   $0x0
+f0101ee1:	e8 8c f9 ff ff       	call   f0101872 <page_alloc>
+f0101ee6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0101ee9:	83 c4 10             	add    $0x10,%esp
+f0101eec:	85 c0                	test   %eax,%eax
+f0101eee:	0f 84 02 02 00 00    	je     f01020f6 <mem_init+0x445>
+	assert((pp2 = page_alloc(0)));
+f0101ef4:	83 ec 0c             	sub    $0xc,%esp
+f0101ef7:	6a 00                	push   $0x0
+f0101ef9:	e8 74 f9 ff ff       	call   f0101872 <page_alloc>
+f0101efe:	89 c7                	mov    %eax,%edi
+f0101f00:	83 c4 10             	add    $0x10,%esp
+f0101f03:	85 c0                	test   %eax,%eax
+f0101f05:	0f 84 04 02 00 00    	je     f010210f <mem_init+0x45e>
+	assert(pp1 && pp1 != pp0);
+f0101f0b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101f0e:	39 c6                	cmp    %eax,%esi
+f0101f10:	0f 84 12 02 00 00    	je     f0102128 <mem_init+0x477>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0101f16:	39 fe                	cmp    %edi,%esi
+f0101f18:	0f 84 23 02 00 00    	je     f0102141 <mem_init+0x490>
+f0101f1e:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0101f21:	0f 84 1a 02 00 00    	je     f0102141 <mem_init+0x490>
+	assert(!page_alloc(0));
+f0101f27:	83 ec 0c             	sub    $0xc,%esp
+f0101f2a:	6a 00                	push   $0x0
+f0101f2c:	e8 41 f9 ff ff       	call   f0101872 <page_alloc>
+f0101f31:	83 c4 10             	add    $0x10,%esp
+f0101f34:	85 c0                	test   %eax,%eax
+f0101f36:	0f 85 1e 02 00 00    	jne    f010215a <mem_init+0x4a9>
+f0101f3c:	89 f0                	mov    %esi,%eax
+f0101f3e:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f0101f44:	c1 f8 02             	sar    $0x2,%eax
+f0101f47:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0101f4d:	89 c2                	mov    %eax,%edx
+f0101f4f:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0101f52:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101f57:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f0101f5d:	0f 83 10 02 00 00    	jae    f0102173 <mem_init+0x4c2>
+	memset(page2kva(pp0), 1, PGSIZE);
+f0101f63:	83 ec 04             	sub    $0x4,%esp
+f0101f66:	68 00 10 00 00       	push   $0x1000
+f0101f6b:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f0101f6d:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0101f73:	52                   	push   %edx
+f0101f74:	e8 8d 4e 00 00       	call   f0106e06 <memset>
+	page_free(pp0);
+f0101f79:	89 34 24             	mov    %esi,(%esp)
+f0101f7c:	e8 63 f9 ff ff       	call   f01018e4 <page_free>
+	assert((pp = page_alloc(ALLOC_ZERO)));
+f0101f81:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f0101f88:	e8 e5 f8 ff ff       	call   f0101872 <page_alloc>
+f0101f8d:	83 c4 10             	add    $0x10,%esp
+f0101f90:	85 c0                	test   %eax,%eax
+f0101f92:	0f 84 ed 01 00 00    	je     f0102185 <mem_init+0x4d4>
+	assert(pp && pp0 == pp);
+f0101f98:	39 c6                	cmp    %eax,%esi
+f0101f9a:	0f 85 fe 01 00 00    	jne    f010219e <mem_init+0x4ed>
+	return (pp - pool.pages) << PGSHIFT;
+f0101fa0:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f0101fa6:	c1 f8 02             	sar    $0x2,%eax
+f0101fa9:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0101faf:	89 c1                	mov    %eax,%ecx
+f0101fb1:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0101fb4:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101fb9:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f0101fbf:	0f 83 f2 01 00 00    	jae    f01021b7 <mem_init+0x506>
+	return (void *)(pa + KERNBASE);
+f0101fc5:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+	for (i = 0; i < PGSIZE; i++)
+f0101fcb:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f0101fd1:	39 c8                	cmp    %ecx,%eax
+f0101fd3:	0f 84 f0 01 00 00    	je     f01021c9 <mem_init+0x518>
+		assert(c[i] == 0);
+f0101fd9:	0f b6 10             	movzbl (%eax),%edx
+f0101fdc:	83 c0 01             	add    $0x1,%eax
+f0101fdf:	84 d2                	test   %dl,%dl
+f0101fe1:	74 ee                	je     f0101fd1 <mem_init+0x320>
+f0101fe3:	68 61 bc 10 f0       	push   $0xf010bc61
+f0101fe8:	68 25 aa 10 f0       	push   $0xf010aa25
+f0101fed:	68 07 04 00 00       	push   $0x407
+f0101ff2:	68 25 ba 10 f0       	push   $0xf010ba25
+f0101ff7:	e8 4d e0 ff ff       	call   f0100049 <_panic>
+	assert((pp0 = page_alloc(0)));
+f0101ffc:	68 79 bb 10 f0       	push   $0xf010bb79
+f0102001:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102006:	68 e2 03 00 00       	push   $0x3e2
+f010200b:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102010:	e8 34 e0 ff ff       	call   f0100049 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0102015:	68 8f bb 10 f0       	push   $0xf010bb8f
+f010201a:	68 25 aa 10 f0       	push   $0xf010aa25
+f010201f:	68 e3 03 00 00       	push   $0x3e3
+f0102024:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102029:	e8 1b e0 ff ff       	call   f0100049 <_panic>
+	assert((pp2 = page_alloc(0)));
+f010202e:	68 a5 bb 10 f0       	push   $0xf010bba5
+f0102033:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102038:	68 e4 03 00 00       	push   $0x3e4
+f010203d:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102042:	e8 02 e0 ff ff       	call   f0100049 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0102047:	68 bb bb 10 f0       	push   $0xf010bbbb
+f010204c:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102051:	68 e7 03 00 00       	push   $0x3e7
+f0102056:	68 25 ba 10 f0       	push   $0xf010ba25
+f010205b:	e8 e9 df ff ff       	call   f0100049 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102060:	68 44 b2 10 f0       	push   $0xf010b244
+f0102065:	68 25 aa 10 f0       	push   $0xf010aa25
+f010206a:	68 e8 03 00 00       	push   $0x3e8
+f010206f:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102074:	e8 d0 df ff ff       	call   f0100049 <_panic>
+	assert(page2pa(pp0) < npages*PGSIZE);
+f0102079:	68 cd bb 10 f0       	push   $0xf010bbcd
+f010207e:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102083:	68 e9 03 00 00       	push   $0x3e9
+f0102088:	68 25 ba 10 f0       	push   $0xf010ba25
+f010208d:	e8 b7 df ff ff       	call   f0100049 <_panic>
+	assert(page2pa(pp1) < npages*PGSIZE);
+f0102092:	68 ea bb 10 f0       	push   $0xf010bbea
+f0102097:	68 25 aa 10 f0       	push   $0xf010aa25
+f010209c:	68 ea 03 00 00       	push   $0x3ea
+f01020a1:	68 25 ba 10 f0       	push   $0xf010ba25
+f01020a6:	e8 9e df ff ff       	call   f0100049 <_panic>
+	assert(page2pa(pp2) < npages*PGSIZE);
+f01020ab:	68 07 bc 10 f0       	push   $0xf010bc07
+f01020b0:	68 25 aa 10 f0       	push   $0xf010aa25
+f01020b5:	68 eb 03 00 00       	push   $0x3eb
+f01020ba:	68 25 ba 10 f0       	push   $0xf010ba25
+f01020bf:	e8 85 df ff ff       	call   f0100049 <_panic>
+	assert(!page_alloc(0));
+f01020c4:	68 24 bc 10 f0       	push   $0xf010bc24
+f01020c9:	68 25 aa 10 f0       	push   $0xf010aa25
+f01020ce:	68 f1 03 00 00       	push   $0x3f1
+f01020d3:	68 25 ba 10 f0       	push   $0xf010ba25
+f01020d8:	e8 6c df ff ff       	call   f0100049 <_panic>
+	assert((pp0 = page_alloc(0)));
+f01020dd:	68 79 bb 10 f0       	push   $0xf010bb79
+f01020e2:	68 25 aa 10 f0       	push   $0xf010aa25
+f01020e7:	68 f8 03 00 00       	push   $0x3f8
+f01020ec:	68 25 ba 10 f0       	push   $0xf010ba25
+f01020f1:	e8 53 df ff ff       	call   f0100049 <_panic>
+	assert((pp1 = page_alloc(0)));
+f01020f6:	68 8f bb 10 f0       	push   $0xf010bb8f
+f01020fb:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102100:	68 f9 03 00 00       	push   $0x3f9
+f0102105:	68 25 ba 10 f0       	push   $0xf010ba25
+f010210a:	e8 3a df ff ff       	call   f0100049 <_panic>
+	assert((pp2 = page_alloc(0)));
+f010210f:	68 a5 bb 10 f0       	push   $0xf010bba5
+f0102114:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102119:	68 fa 03 00 00       	push   $0x3fa
+f010211e:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102123:	e8 21 df ff ff       	call   f0100049 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0102128:	68 bb bb 10 f0       	push   $0xf010bbbb
+f010212d:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102132:	68 fc 03 00 00       	push   $0x3fc
+f0102137:	68 25 ba 10 f0       	push   $0xf010ba25
+f010213c:	e8 08 df ff ff       	call   f0100049 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102141:	68 44 b2 10 f0       	push   $0xf010b244
+f0102146:	68 25 aa 10 f0       	push   $0xf010aa25
+f010214b:	68 fd 03 00 00       	push   $0x3fd
+f0102150:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102155:	e8 ef de ff ff       	call   f0100049 <_panic>
+	assert(!page_alloc(0));
+f010215a:	68 24 bc 10 f0       	push   $0xf010bc24
+f010215f:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102164:	68 fe 03 00 00       	push   $0x3fe
+f0102169:	68 25 ba 10 f0       	push   $0xf010ba25
+f010216e:	e8 d6 de ff ff       	call   f0100049 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102173:	52                   	push   %edx
+f0102174:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0102179:	6a 5f                	push   $0x5f
+f010217b:	68 31 ba 10 f0       	push   $0xf010ba31
+f0102180:	e8 c4 de ff ff       	call   f0100049 <_panic>
+	assert((pp = page_alloc(ALLOC_ZERO)));
+f0102185:	68 33 bc 10 f0       	push   $0xf010bc33
+f010218a:	68 25 aa 10 f0       	push   $0xf010aa25
+f010218f:	68 03 04 00 00       	push   $0x403
+f0102194:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102199:	e8 ab de ff ff       	call   f0100049 <_panic>
+	assert(pp && pp0 == pp);
+f010219e:	68 51 bc 10 f0       	push   $0xf010bc51
+f01021a3:	68 25 aa 10 f0       	push   $0xf010aa25
+f01021a8:	68 04 04 00 00       	push   $0x404
+f01021ad:	68 25 ba 10 f0       	push   $0xf010ba25
+f01021b2:	e8 92 de ff ff       	call   f0100049 <_panic>
+f01021b7:	51                   	push   %ecx
+f01021b8:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f01021bd:	6a 5f                	push   $0x5f
+f01021bf:	68 31 ba 10 f0       	push   $0xf010ba31
+f01021c4:	e8 80 de ff ff       	call   f0100049 <_panic>
+	restore_buddy_memory();
+f01021c9:	e8 ce eb ff ff       	call   f0100d9c <restore_buddy_memory>
+	page_free(pp0);
+f01021ce:	83 ec 0c             	sub    $0xc,%esp
+f01021d1:	56                   	push   %esi
+f01021d2:	e8 0d f7 ff ff       	call   f01018e4 <page_free>
+	page_free(pp1);
+f01021d7:	83 c4 04             	add    $0x4,%esp
+f01021da:	ff 75 d4             	push   -0x2c(%ebp)
+f01021dd:	e8 02 f7 ff ff       	call   f01018e4 <page_free>
+	page_free(pp2);
+f01021e2:	89 3c 24             	mov    %edi,(%esp)
+f01021e5:	e8 fa f6 ff ff       	call   f01018e4 <page_free>
+	for (pp = pool.pages; pp < &pool.pages[npages]; pp++)
+f01021ea:	a1 68 c2 7f f0       	mov    0xf07fc268,%eax
+f01021ef:	8b 15 ac c2 7f f0    	mov    0xf07fc2ac,%edx
+f01021f5:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f01021f8:	8d 14 90             	lea    (%eax,%edx,4),%edx
+f01021fb:	83 c4 10             	add    $0x10,%esp
+f01021fe:	eb 09                	jmp    f0102209 <mem_init+0x558>
+			--nfree;
+f0102200:	83 38 01             	cmpl   $0x1,(%eax)
+f0102203:	83 d3 ff             	adc    $0xffffffff,%ebx
+	for (pp = pool.pages; pp < &pool.pages[npages]; pp++)
+f0102206:	83 c0 0c             	add    $0xc,%eax
+f0102209:	39 d0                	cmp    %edx,%eax
+f010220b:	72 f3                	jb     f0102200 <mem_init+0x54f>
+	assert(nfree == 0);
+f010220d:	85 db                	test   %ebx,%ebx
+f010220f:	0f 85 ad 06 00 00    	jne    f01028c2 <mem_init+0xc11>
+	cprintf("check_page_alloc() succeeded!\n");
+f0102215:	83 ec 0c             	sub    $0xc,%esp
+f0102218:	68 64 b2 10 f0       	push   $0xf010b264
+f010221d:	e8 bf 21 00 00       	call   f01043e1 <cprintf>
+	int i;
+	extern pde_t entry_pgdir[];
+
+	// should be able to allocate three pages
+	pp0 = pp1 = pp2 = 0;
+	assert((pp0 = page_alloc(0)));
+f0102222:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f0102229:	e8 44 f6 ff ff       	call   f0101872 <page_alloc>
+f010222e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102231:	83 c4 10             	add    $0x10,%esp
+f0102234:	85 c0                	test   %eax,%eax
+f0102236:	0f 84 9f 06 00 00    	je     f01028db <mem_init+0xc2a>
+	assert((pp1 = page_alloc(0)));
+f010223c:	83 ec 0c             	sub    $0xc,%esp
+f010223f:	6a 00                	push   $0x0
+f0102241:	e8 2c f6 ff ff       	call   f0101872 <page_alloc>
+f0102246:	89 c7                	mov    %eax,%edi
+f0102248:	83 c4 10             	add    $0x10,%esp
+f010224b:	85 c0                	test   %eax,%eax
+f010224d:	0f 84 a1 06 00 00    	je     f01028f4 <mem_init+0xc43>
+	assert((pp2 = page_alloc(0)));
+f0102253:	83 ec 0c             	sub    $0xc,%esp
+f0102256:	6a 00                	push   $0x0
+f0102258:	e8 15 f6 ff ff       	call   f0101872 <page_alloc>
+f010225d:	89 c3                	mov    %eax,%ebx
+f010225f:	83 c4 10             	add    $0x10,%esp
+f0102262:	85 c0                	test   %eax,%eax
+f0102264:	0f 84 a3 06 00 00    	je     f010290d <mem_init+0xc5c>
+
+	assert(pp0);
+	assert(pp1 && pp1 != pp0);
+f010226a:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f010226d:	0f 84 b3 06 00 00    	je     f0102926 <mem_init+0xc75>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102273:	39 c7                	cmp    %eax,%edi
+f0102275:	0f 84 c4 06 00 00    	je     f010293f <mem_init+0xc8e>
+f010227b:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f010227e:	0f 84 bb 06 00 00    	je     f010293f <mem_init+0xc8e>
+
+	// temporarily steal the rest of the free pages
+	steal_buddy_memory();
+f0102284:	e8 c2 ea ff ff       	call   f0100d4b <steal_buddy_memory>
+
+	// should be no free memory
+	assert(!page_alloc(0));
+f0102289:	83 ec 0c             	sub    $0xc,%esp
+f010228c:	6a 00                	push   $0x0
+f010228e:	e8 df f5 ff ff       	call   f0101872 <page_alloc>
+f0102293:	83 c4 10             	add    $0x10,%esp
+f0102296:	85 c0                	test   %eax,%eax
+f0102298:	0f 85 ba 06 00 00    	jne    f0102958 <mem_init+0xca7>
+
+	// there is no page allocated at address 0
+	assert(page_lookup(kern_pgdir, (void *) 0x0, &ptep) == NULL);
+f010229e:	83 ec 04             	sub    $0x4,%esp
+f01022a1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01022a4:	50                   	push   %eax
+f01022a5:	6a 00                	push   $0x0
+f01022a7:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f01022ad:	e8 26 f8 ff ff       	call   f0101ad8 <page_lookup>
+f01022b2:	83 c4 10             	add    $0x10,%esp
+f01022b5:	85 c0                	test   %eax,%eax
+f01022b7:	0f 85 b4 06 00 00    	jne    f0102971 <mem_init+0xcc0>
+
+	// there is no free memory, so we can't allocate a page table
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) < 0);
+f01022bd:	6a 02                	push   $0x2
+f01022bf:	6a 00                	push   $0x0
+f01022c1:	57                   	push   %edi
+f01022c2:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f01022c8:	e8 0d f9 ff ff       	call   f0101bda <page_insert>
+f01022cd:	83 c4 10             	add    $0x10,%esp
+f01022d0:	85 c0                	test   %eax,%eax
+f01022d2:	0f 89 b2 06 00 00    	jns    f010298a <mem_init+0xcd9>
+
+	// free pp0 and try again: pp0 should be used for page table
+	page_free(pp0);
+f01022d8:	83 ec 0c             	sub    $0xc,%esp
+f01022db:	ff 75 d4             	push   -0x2c(%ebp)
+f01022de:	e8 01 f6 ff ff       	call   f01018e4 <page_free>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) == 0);
+f01022e3:	6a 02                	push   $0x2
+f01022e5:	6a 00                	push   $0x0
+f01022e7:	57                   	push   %edi
+f01022e8:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f01022ee:	e8 e7 f8 ff ff       	call   f0101bda <page_insert>
+f01022f3:	83 c4 20             	add    $0x20,%esp
+f01022f6:	85 c0                	test   %eax,%eax
+f01022f8:	0f 85 a5 06 00 00    	jne    f01029a3 <mem_init+0xcf2>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f01022fe:	8b 35 a8 c2 7f f0    	mov    0xf07fc2a8,%esi
+	return (pp - pool.pages) << PGSHIFT;
+f0102304:	8b 0d 68 c2 7f f0    	mov    0xf07fc268,%ecx
+f010230a:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f010230d:	8b 16                	mov    (%esi),%edx
+f010230f:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0102315:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102318:	29 c8                	sub    %ecx,%eax
+f010231a:	c1 f8 02             	sar    $0x2,%eax
+f010231d:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102323:	c1 e0 0c             	shl    $0xc,%eax
+f0102326:	39 c2                	cmp    %eax,%edx
+f0102328:	0f 85 8e 06 00 00    	jne    f01029bc <mem_init+0xd0b>
+	assert(check_va2pa(kern_pgdir, 0x0) == page2pa(pp1));
+f010232e:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102333:	89 f0                	mov    %esi,%eax
+f0102335:	e8 a7 ea ff ff       	call   f0100de1 <check_va2pa>
+f010233a:	89 c2                	mov    %eax,%edx
+f010233c:	89 f8                	mov    %edi,%eax
+f010233e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f0102341:	29 c8                	sub    %ecx,%eax
+f0102343:	c1 f8 02             	sar    $0x2,%eax
+f0102346:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010234c:	c1 e0 0c             	shl    $0xc,%eax
+f010234f:	39 c2                	cmp    %eax,%edx
+f0102351:	0f 85 7e 06 00 00    	jne    f01029d5 <mem_init+0xd24>
+	assert(pp1->pp_ref == 1);
+f0102357:	66 83 7f 08 01       	cmpw   $0x1,0x8(%edi)
+f010235c:	0f 85 8c 06 00 00    	jne    f01029ee <mem_init+0xd3d>
+	assert(pp0->pp_ref == 1);
+f0102362:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102365:	66 83 78 08 01       	cmpw   $0x1,0x8(%eax)
+f010236a:	0f 85 97 06 00 00    	jne    f0102a07 <mem_init+0xd56>
+
+	// should be able to map pp2 at PGSIZE because pp0 is already allocated for page table
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0102370:	6a 02                	push   $0x2
+f0102372:	68 00 10 00 00       	push   $0x1000
+f0102377:	53                   	push   %ebx
+f0102378:	56                   	push   %esi
+f0102379:	e8 5c f8 ff ff       	call   f0101bda <page_insert>
+f010237e:	83 c4 10             	add    $0x10,%esp
+f0102381:	85 c0                	test   %eax,%eax
+f0102383:	0f 85 97 06 00 00    	jne    f0102a20 <mem_init+0xd6f>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0102389:	ba 00 10 00 00       	mov    $0x1000,%edx
+f010238e:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+f0102393:	e8 49 ea ff ff       	call   f0100de1 <check_va2pa>
+f0102398:	89 c2                	mov    %eax,%edx
+f010239a:	89 d8                	mov    %ebx,%eax
+f010239c:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f01023a2:	c1 f8 02             	sar    $0x2,%eax
+f01023a5:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01023ab:	c1 e0 0c             	shl    $0xc,%eax
+f01023ae:	39 c2                	cmp    %eax,%edx
+f01023b0:	0f 85 83 06 00 00    	jne    f0102a39 <mem_init+0xd88>
+	assert(pp2->pp_ref == 1);
+f01023b6:	66 83 7b 08 01       	cmpw   $0x1,0x8(%ebx)
+f01023bb:	0f 85 91 06 00 00    	jne    f0102a52 <mem_init+0xda1>
+
+	// should be no free memory
+	assert(!page_alloc(0));
+f01023c1:	83 ec 0c             	sub    $0xc,%esp
+f01023c4:	6a 00                	push   $0x0
+f01023c6:	e8 a7 f4 ff ff       	call   f0101872 <page_alloc>
+f01023cb:	83 c4 10             	add    $0x10,%esp
+f01023ce:	85 c0                	test   %eax,%eax
+f01023d0:	0f 85 95 06 00 00    	jne    f0102a6b <mem_init+0xdba>
+
+	// should be able to map pp2 at PGSIZE because it's already there
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f01023d6:	6a 02                	push   $0x2
+f01023d8:	68 00 10 00 00       	push   $0x1000
+f01023dd:	53                   	push   %ebx
+f01023de:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f01023e4:	e8 f1 f7 ff ff       	call   f0101bda <page_insert>
+f01023e9:	83 c4 10             	add    $0x10,%esp
+f01023ec:	85 c0                	test   %eax,%eax
+f01023ee:	0f 85 90 06 00 00    	jne    f0102a84 <mem_init+0xdd3>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f01023f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01023f9:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+f01023fe:	e8 de e9 ff ff       	call   f0100de1 <check_va2pa>
+f0102403:	89 c2                	mov    %eax,%edx
+f0102405:	89 d8                	mov    %ebx,%eax
+f0102407:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f010240d:	c1 f8 02             	sar    $0x2,%eax
+f0102410:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102416:	c1 e0 0c             	shl    $0xc,%eax
+f0102419:	39 c2                	cmp    %eax,%edx
+f010241b:	0f 85 7c 06 00 00    	jne    f0102a9d <mem_init+0xdec>
+	assert(pp2->pp_ref == 1);
+f0102421:	66 83 7b 08 01       	cmpw   $0x1,0x8(%ebx)
+f0102426:	0f 85 8a 06 00 00    	jne    f0102ab6 <mem_init+0xe05>
+
+	// pp2 should NOT be on the free list
+	// could happen in ref counts are handled sloppily in page_insert
+	assert(!page_alloc(0));
+f010242c:	83 ec 0c             	sub    $0xc,%esp
+f010242f:	6a 00                	push   $0x0
+f0102431:	e8 3c f4 ff ff       	call   f0101872 <page_alloc>
+f0102436:	83 c4 10             	add    $0x10,%esp
+f0102439:	85 c0                	test   %eax,%eax
+f010243b:	0f 85 8e 06 00 00    	jne    f0102acf <mem_init+0xe1e>
+
+	// check that pgdir_walk returns a pointer to the pte
+	ptep = (pte_t *) KADDR(PTE_ADDR(kern_pgdir[PDX(PGSIZE)]));
+f0102441:	8b 15 a8 c2 7f f0    	mov    0xf07fc2a8,%edx
+f0102447:	8b 02                	mov    (%edx),%eax
+f0102449:	89 c6                	mov    %eax,%esi
+f010244b:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f0102451:	c1 e8 0c             	shr    $0xc,%eax
+f0102454:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f010245a:	0f 83 88 06 00 00    	jae    f0102ae8 <mem_init+0xe37>
+	assert(pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) == ptep+PTX(PGSIZE));
+f0102460:	83 ec 04             	sub    $0x4,%esp
+f0102463:	6a 00                	push   $0x0
+f0102465:	68 00 10 00 00       	push   $0x1000
+f010246a:	52                   	push   %edx
+f010246b:	e8 f2 f4 ff ff       	call   f0101962 <pgdir_walk>
+f0102470:	81 ee fc ff ff 0f    	sub    $0xffffffc,%esi
+f0102476:	83 c4 10             	add    $0x10,%esp
+f0102479:	39 f0                	cmp    %esi,%eax
+f010247b:	0f 85 7c 06 00 00    	jne    f0102afd <mem_init+0xe4c>
+
+	// should be able to change permissions too.
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W|PTE_U) == 0);
+f0102481:	6a 06                	push   $0x6
+f0102483:	68 00 10 00 00       	push   $0x1000
+f0102488:	53                   	push   %ebx
+f0102489:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f010248f:	e8 46 f7 ff ff       	call   f0101bda <page_insert>
+f0102494:	83 c4 10             	add    $0x10,%esp
+f0102497:	85 c0                	test   %eax,%eax
+f0102499:	0f 85 77 06 00 00    	jne    f0102b16 <mem_init+0xe65>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f010249f:	8b 35 a8 c2 7f f0    	mov    0xf07fc2a8,%esi
+f01024a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01024aa:	89 f0                	mov    %esi,%eax
+f01024ac:	e8 30 e9 ff ff       	call   f0100de1 <check_va2pa>
+f01024b1:	89 c2                	mov    %eax,%edx
+	return (pp - pool.pages) << PGSHIFT;
+f01024b3:	89 d8                	mov    %ebx,%eax
+f01024b5:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f01024bb:	c1 f8 02             	sar    $0x2,%eax
+f01024be:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01024c4:	c1 e0 0c             	shl    $0xc,%eax
+f01024c7:	39 c2                	cmp    %eax,%edx
+f01024c9:	0f 85 60 06 00 00    	jne    f0102b2f <mem_init+0xe7e>
+	assert(pp2->pp_ref == 1);
+f01024cf:	66 83 7b 08 01       	cmpw   $0x1,0x8(%ebx)
+f01024d4:	0f 85 6e 06 00 00    	jne    f0102b48 <mem_init+0xe97>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U);
+f01024da:	83 ec 04             	sub    $0x4,%esp
+f01024dd:	6a 00                	push   $0x0
+f01024df:	68 00 10 00 00       	push   $0x1000
+f01024e4:	56                   	push   %esi
+f01024e5:	e8 78 f4 ff ff       	call   f0101962 <pgdir_walk>
+f01024ea:	83 c4 10             	add    $0x10,%esp
+f01024ed:	f6 00 04             	testb  $0x4,(%eax)
+f01024f0:	0f 84 6b 06 00 00    	je     f0102b61 <mem_init+0xeb0>
+	assert(kern_pgdir[0] & PTE_U);
+f01024f6:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+f01024fb:	f6 00 04             	testb  $0x4,(%eax)
+f01024fe:	0f 84 76 06 00 00    	je     f0102b7a <mem_init+0xec9>
+
+	// should be able to remap with fewer permissions
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0102504:	6a 02                	push   $0x2
+f0102506:	68 00 10 00 00       	push   $0x1000
+f010250b:	53                   	push   %ebx
+f010250c:	50                   	push   %eax
+f010250d:	e8 c8 f6 ff ff       	call   f0101bda <page_insert>
+f0102512:	83 c4 10             	add    $0x10,%esp
+f0102515:	85 c0                	test   %eax,%eax
+f0102517:	0f 85 76 06 00 00    	jne    f0102b93 <mem_init+0xee2>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_W);
+f010251d:	83 ec 04             	sub    $0x4,%esp
+f0102520:	6a 00                	push   $0x0
+f0102522:	68 00 10 00 00       	push   $0x1000
+f0102527:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f010252d:	e8 30 f4 ff ff       	call   f0101962 <pgdir_walk>
+f0102532:	83 c4 10             	add    $0x10,%esp
+f0102535:	f6 00 02             	testb  $0x2,(%eax)
+f0102538:	0f 84 6e 06 00 00    	je     f0102bac <mem_init+0xefb>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f010253e:	83 ec 04             	sub    $0x4,%esp
+f0102541:	6a 00                	push   $0x0
+f0102543:	68 00 10 00 00       	push   $0x1000
+f0102548:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f010254e:	e8 0f f4 ff ff       	call   f0101962 <pgdir_walk>
+f0102553:	83 c4 10             	add    $0x10,%esp
+f0102556:	f6 00 04             	testb  $0x4,(%eax)
+f0102559:	0f 85 66 06 00 00    	jne    f0102bc5 <mem_init+0xf14>
+
+	// should not be able to map at PTSIZE because need free page for page table
+	assert(page_insert(kern_pgdir, pp0, (void*) PTSIZE, PTE_W) < 0);
+f010255f:	6a 02                	push   $0x2
+f0102561:	68 00 00 40 00       	push   $0x400000
+f0102566:	ff 75 d4             	push   -0x2c(%ebp)
+f0102569:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f010256f:	e8 66 f6 ff ff       	call   f0101bda <page_insert>
+f0102574:	83 c4 10             	add    $0x10,%esp
+f0102577:	85 c0                	test   %eax,%eax
+f0102579:	0f 89 5f 06 00 00    	jns    f0102bde <mem_init+0xf2d>
+
+	// insert pp1 at PGSIZE (replacing pp2)
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W) == 0);
+f010257f:	6a 02                	push   $0x2
+f0102581:	68 00 10 00 00       	push   $0x1000
+f0102586:	57                   	push   %edi
+f0102587:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f010258d:	e8 48 f6 ff ff       	call   f0101bda <page_insert>
+f0102592:	83 c4 10             	add    $0x10,%esp
+f0102595:	85 c0                	test   %eax,%eax
+f0102597:	0f 85 5a 06 00 00    	jne    f0102bf7 <mem_init+0xf46>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f010259d:	83 ec 04             	sub    $0x4,%esp
+f01025a0:	6a 00                	push   $0x0
+f01025a2:	68 00 10 00 00       	push   $0x1000
+f01025a7:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f01025ad:	e8 b0 f3 ff ff       	call   f0101962 <pgdir_walk>
+f01025b2:	83 c4 10             	add    $0x10,%esp
+f01025b5:	f6 00 04             	testb  $0x4,(%eax)
+f01025b8:	0f 85 52 06 00 00    	jne    f0102c10 <mem_init+0xf5f>
+
+	// should have pp1 at both 0 and PGSIZE, pp2 nowhere, ...
+	assert(check_va2pa(kern_pgdir, 0) == page2pa(pp1));
+f01025be:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+f01025c3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01025c6:	ba 00 00 00 00       	mov    $0x0,%edx
+f01025cb:	e8 11 e8 ff ff       	call   f0100de1 <check_va2pa>
+f01025d0:	89 fe                	mov    %edi,%esi
+f01025d2:	2b 35 68 c2 7f f0    	sub    0xf07fc268,%esi
+f01025d8:	c1 fe 02             	sar    $0x2,%esi
+f01025db:	69 f6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%esi
+f01025e1:	c1 e6 0c             	shl    $0xc,%esi
+f01025e4:	39 f0                	cmp    %esi,%eax
+f01025e6:	0f 85 3d 06 00 00    	jne    f0102c29 <mem_init+0xf78>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f01025ec:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01025f1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01025f4:	e8 e8 e7 ff ff       	call   f0100de1 <check_va2pa>
+f01025f9:	39 c6                	cmp    %eax,%esi
+f01025fb:	0f 85 41 06 00 00    	jne    f0102c42 <mem_init+0xf91>
+	// ... and ref counts should reflect this
+	assert(pp1->pp_ref == 2);
+f0102601:	66 83 7f 08 02       	cmpw   $0x2,0x8(%edi)
+f0102606:	0f 85 4f 06 00 00    	jne    f0102c5b <mem_init+0xfaa>
+	assert(pp2->pp_ref == 0);
+f010260c:	66 83 7b 08 00       	cmpw   $0x0,0x8(%ebx)
+f0102611:	0f 85 5d 06 00 00    	jne    f0102c74 <mem_init+0xfc3>
+
+	// pp2 should be returned by page_alloc
+	assert((pp = page_alloc(0)) && pp == pp2);
+f0102617:	83 ec 0c             	sub    $0xc,%esp
+f010261a:	6a 00                	push   $0x0
+f010261c:	e8 51 f2 ff ff       	call   f0101872 <page_alloc>
+f0102621:	83 c4 10             	add    $0x10,%esp
+f0102624:	39 c3                	cmp    %eax,%ebx
+f0102626:	0f 85 61 06 00 00    	jne    f0102c8d <mem_init+0xfdc>
+f010262c:	85 c0                	test   %eax,%eax
+f010262e:	0f 84 59 06 00 00    	je     f0102c8d <mem_init+0xfdc>
+
+	// unmapping pp1 at 0 should keep pp1 at PGSIZE
+	page_remove(kern_pgdir, 0x0);
+f0102634:	83 ec 08             	sub    $0x8,%esp
+f0102637:	6a 00                	push   $0x0
+f0102639:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f010263f:	e8 50 f5 ff ff       	call   f0101b94 <page_remove>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0102644:	8b 35 a8 c2 7f f0    	mov    0xf07fc2a8,%esi
+f010264a:	ba 00 00 00 00       	mov    $0x0,%edx
+f010264f:	89 f0                	mov    %esi,%eax
+f0102651:	e8 8b e7 ff ff       	call   f0100de1 <check_va2pa>
+f0102656:	83 c4 10             	add    $0x10,%esp
+f0102659:	83 f8 ff             	cmp    $0xffffffff,%eax
+f010265c:	0f 85 44 06 00 00    	jne    f0102ca6 <mem_init+0xff5>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0102662:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102667:	89 f0                	mov    %esi,%eax
+f0102669:	e8 73 e7 ff ff       	call   f0100de1 <check_va2pa>
+f010266e:	89 c2                	mov    %eax,%edx
+f0102670:	89 f8                	mov    %edi,%eax
+f0102672:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f0102678:	c1 f8 02             	sar    $0x2,%eax
+f010267b:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102681:	c1 e0 0c             	shl    $0xc,%eax
+f0102684:	39 c2                	cmp    %eax,%edx
+f0102686:	0f 85 33 06 00 00    	jne    f0102cbf <mem_init+0x100e>
+	assert(pp1->pp_ref == 1);
+f010268c:	66 83 7f 08 01       	cmpw   $0x1,0x8(%edi)
+f0102691:	0f 85 41 06 00 00    	jne    f0102cd8 <mem_init+0x1027>
+	assert(pp2->pp_ref == 0);
+f0102697:	66 83 7b 08 00       	cmpw   $0x0,0x8(%ebx)
+f010269c:	0f 85 4f 06 00 00    	jne    f0102cf1 <mem_init+0x1040>
+
+	// test re-inserting pp1 at PGSIZE
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, 0) == 0);
+f01026a2:	6a 00                	push   $0x0
+f01026a4:	68 00 10 00 00       	push   $0x1000
+f01026a9:	57                   	push   %edi
+f01026aa:	56                   	push   %esi
+f01026ab:	e8 2a f5 ff ff       	call   f0101bda <page_insert>
+f01026b0:	83 c4 10             	add    $0x10,%esp
+f01026b3:	85 c0                	test   %eax,%eax
+f01026b5:	0f 85 4f 06 00 00    	jne    f0102d0a <mem_init+0x1059>
+	assert(pp1->pp_ref);
+f01026bb:	66 83 7f 08 00       	cmpw   $0x0,0x8(%edi)
+f01026c0:	0f 84 5d 06 00 00    	je     f0102d23 <mem_init+0x1072>
+	assert(pp1->pp_prev == NULL);
+f01026c6:	83 3f 00             	cmpl   $0x0,(%edi)
+f01026c9:	0f 85 6d 06 00 00    	jne    f0102d3c <mem_init+0x108b>
+
+	// unmapping pp1 at PGSIZE should free it
+	page_remove(kern_pgdir, (void*) PGSIZE);
+f01026cf:	83 ec 08             	sub    $0x8,%esp
+f01026d2:	68 00 10 00 00       	push   $0x1000
+f01026d7:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f01026dd:	e8 b2 f4 ff ff       	call   f0101b94 <page_remove>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f01026e2:	8b 35 a8 c2 7f f0    	mov    0xf07fc2a8,%esi
+f01026e8:	ba 00 00 00 00       	mov    $0x0,%edx
+f01026ed:	89 f0                	mov    %esi,%eax
+f01026ef:	e8 ed e6 ff ff       	call   f0100de1 <check_va2pa>
+f01026f4:	83 c4 10             	add    $0x10,%esp
+f01026f7:	83 f8 ff             	cmp    $0xffffffff,%eax
+f01026fa:	0f 85 55 06 00 00    	jne    f0102d55 <mem_init+0x10a4>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == ~0);
+f0102700:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102705:	89 f0                	mov    %esi,%eax
+f0102707:	e8 d5 e6 ff ff       	call   f0100de1 <check_va2pa>
+f010270c:	83 f8 ff             	cmp    $0xffffffff,%eax
+f010270f:	0f 85 59 06 00 00    	jne    f0102d6e <mem_init+0x10bd>
+	assert(pp1->pp_ref == 0);
+f0102715:	66 83 7f 08 00       	cmpw   $0x0,0x8(%edi)
+f010271a:	0f 85 67 06 00 00    	jne    f0102d87 <mem_init+0x10d6>
+	assert(pp2->pp_ref == 0);
+f0102720:	66 83 7b 08 00       	cmpw   $0x0,0x8(%ebx)
+f0102725:	0f 85 75 06 00 00    	jne    f0102da0 <mem_init+0x10ef>
+
+	// so it should be returned by page_alloc
+	assert((pp = page_alloc(0)) && pp == pp1);
+f010272b:	83 ec 0c             	sub    $0xc,%esp
+f010272e:	6a 00                	push   $0x0
+f0102730:	e8 3d f1 ff ff       	call   f0101872 <page_alloc>
+f0102735:	83 c4 10             	add    $0x10,%esp
+f0102738:	85 c0                	test   %eax,%eax
+f010273a:	0f 84 79 06 00 00    	je     f0102db9 <mem_init+0x1108>
+f0102740:	39 c7                	cmp    %eax,%edi
+f0102742:	0f 85 71 06 00 00    	jne    f0102db9 <mem_init+0x1108>
+
+	// should be no free memory
+	assert(!page_alloc(0));
+f0102748:	83 ec 0c             	sub    $0xc,%esp
+f010274b:	6a 00                	push   $0x0
+f010274d:	e8 20 f1 ff ff       	call   f0101872 <page_alloc>
+f0102752:	83 c4 10             	add    $0x10,%esp
+f0102755:	85 c0                	test   %eax,%eax
+f0102757:	0f 85 75 06 00 00    	jne    f0102dd2 <mem_init+0x1121>
+
+	// forcibly take pp0 back
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f010275d:	8b 0d a8 c2 7f f0    	mov    0xf07fc2a8,%ecx
+f0102763:	8b 11                	mov    (%ecx),%edx
+f0102765:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f010276b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010276e:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f0102774:	c1 f8 02             	sar    $0x2,%eax
+f0102777:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010277d:	c1 e0 0c             	shl    $0xc,%eax
+f0102780:	39 c2                	cmp    %eax,%edx
+f0102782:	0f 85 63 06 00 00    	jne    f0102deb <mem_init+0x113a>
+	kern_pgdir[0] = 0;
+f0102788:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	assert(pp0->pp_ref == 1);
+f010278e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102791:	66 83 78 08 01       	cmpw   $0x1,0x8(%eax)
+f0102796:	0f 85 68 06 00 00    	jne    f0102e04 <mem_init+0x1153>
+	pp0->pp_ref = 0;
+f010279c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010279f:	66 c7 40 08 00 00    	movw   $0x0,0x8(%eax)
+
+	// check pointer arithmetic in pgdir_walk
+	page_free(pp0);
+f01027a5:	83 ec 0c             	sub    $0xc,%esp
+f01027a8:	50                   	push   %eax
+f01027a9:	e8 36 f1 ff ff       	call   f01018e4 <page_free>
+	va = (void*)(PGSIZE * NPDENTRIES + PGSIZE);
+	ptep = pgdir_walk(kern_pgdir, va, 1);
+f01027ae:	83 c4 0c             	add    $0xc,%esp
+f01027b1:	6a 01                	push   $0x1
+f01027b3:	68 00 10 40 00       	push   $0x401000
+f01027b8:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f01027be:	e8 9f f1 ff ff       	call   f0101962 <pgdir_walk>
+f01027c3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	ptep1 = (pte_t *) KADDR(PTE_ADDR(kern_pgdir[PDX(va)]));
+f01027c6:	8b 0d a8 c2 7f f0    	mov    0xf07fc2a8,%ecx
+f01027cc:	8b 41 04             	mov    0x4(%ecx),%eax
+f01027cf:	89 c6                	mov    %eax,%esi
+f01027d1:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f01027d7:	8b 15 ac c2 7f f0    	mov    0xf07fc2ac,%edx
+f01027dd:	c1 e8 0c             	shr    $0xc,%eax
+f01027e0:	83 c4 10             	add    $0x10,%esp
+f01027e3:	39 d0                	cmp    %edx,%eax
+f01027e5:	0f 83 32 06 00 00    	jae    f0102e1d <mem_init+0x116c>
+	assert(ptep == ptep1 + PTX(va));
+f01027eb:	81 ee fc ff ff 0f    	sub    $0xffffffc,%esi
+f01027f1:	39 75 d0             	cmp    %esi,-0x30(%ebp)
+f01027f4:	0f 85 38 06 00 00    	jne    f0102e32 <mem_init+0x1181>
+	kern_pgdir[PDX(va)] = 0;
+f01027fa:	c7 41 04 00 00 00 00 	movl   $0x0,0x4(%ecx)
+	pp0->pp_ref = 0;
+f0102801:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102804:	66 c7 40 08 00 00    	movw   $0x0,0x8(%eax)
+	return (pp - pool.pages) << PGSHIFT;
+f010280a:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f0102810:	c1 f8 02             	sar    $0x2,%eax
+f0102813:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102819:	89 c1                	mov    %eax,%ecx
+f010281b:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f010281e:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102823:	39 d0                	cmp    %edx,%eax
+f0102825:	0f 83 20 06 00 00    	jae    f0102e4b <mem_init+0x119a>
+
+	// check that new page tables get cleared
+	memset(page2kva(pp0), 0xFF, PGSIZE);
+f010282b:	83 ec 04             	sub    $0x4,%esp
+f010282e:	68 00 10 00 00       	push   $0x1000
+f0102833:	68 ff 00 00 00       	push   $0xff
+	return (void *)(pa + KERNBASE);
+f0102838:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f010283e:	51                   	push   %ecx
+f010283f:	e8 c2 45 00 00       	call   f0106e06 <memset>
+	page_free(pp0);
+f0102844:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f0102847:	89 34 24             	mov    %esi,(%esp)
+f010284a:	e8 95 f0 ff ff       	call   f01018e4 <page_free>
+	pgdir_walk(kern_pgdir, 0x0, 1);
+f010284f:	83 c4 0c             	add    $0xc,%esp
+f0102852:	6a 01                	push   $0x1
+f0102854:	6a 00                	push   $0x0
+f0102856:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f010285c:	e8 01 f1 ff ff       	call   f0101962 <pgdir_walk>
+	return (pp - pool.pages) << PGSHIFT;
+f0102861:	89 f0                	mov    %esi,%eax
+f0102863:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f0102869:	c1 f8 02             	sar    $0x2,%eax
+f010286c:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102872:	89 c1                	mov    %eax,%ecx
+f0102874:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0102877:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010287c:	83 c4 10             	add    $0x10,%esp
+f010287f:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f0102885:	0f 83 d2 05 00 00    	jae    f0102e5d <mem_init+0x11ac>
+	return (void *)(pa + KERNBASE);
+f010288b:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+	ptep = (pte_t *) page2kva(pp0);
+	for(i=0; i<NPTENTRIES; i++)
+f0102891:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f0102897:	39 c8                	cmp    %ecx,%eax
+f0102899:	0f 84 d0 05 00 00    	je     f0102e6f <mem_init+0x11be>
+		assert((ptep[i] & PTE_P) == 0);
+f010289f:	8b 10                	mov    (%eax),%edx
+f01028a1:	83 c0 04             	add    $0x4,%eax
+f01028a4:	f6 c2 01             	test   $0x1,%dl
+f01028a7:	74 ee                	je     f0102897 <mem_init+0xbe6>
+f01028a9:	68 2b bd 10 f0       	push   $0xf010bd2b
+f01028ae:	68 25 aa 10 f0       	push   $0xf010aa25
+f01028b3:	68 f7 04 00 00       	push   $0x4f7
+f01028b8:	68 25 ba 10 f0       	push   $0xf010ba25
+f01028bd:	e8 87 d7 ff ff       	call   f0100049 <_panic>
+	assert(nfree == 0);
+f01028c2:	68 6b bc 10 f0       	push   $0xf010bc6b
+f01028c7:	68 25 aa 10 f0       	push   $0xf010aa25
+f01028cc:	68 15 04 00 00       	push   $0x415
+f01028d1:	68 25 ba 10 f0       	push   $0xf010ba25
+f01028d6:	e8 6e d7 ff ff       	call   f0100049 <_panic>
+	assert((pp0 = page_alloc(0)));
+f01028db:	68 79 bb 10 f0       	push   $0xf010bb79
+f01028e0:	68 25 aa 10 f0       	push   $0xf010aa25
+f01028e5:	68 7b 04 00 00       	push   $0x47b
+f01028ea:	68 25 ba 10 f0       	push   $0xf010ba25
+f01028ef:	e8 55 d7 ff ff       	call   f0100049 <_panic>
+	assert((pp1 = page_alloc(0)));
+f01028f4:	68 8f bb 10 f0       	push   $0xf010bb8f
+f01028f9:	68 25 aa 10 f0       	push   $0xf010aa25
+f01028fe:	68 7c 04 00 00       	push   $0x47c
+f0102903:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102908:	e8 3c d7 ff ff       	call   f0100049 <_panic>
+	assert((pp2 = page_alloc(0)));
+f010290d:	68 a5 bb 10 f0       	push   $0xf010bba5
+f0102912:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102917:	68 7d 04 00 00       	push   $0x47d
+f010291c:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102921:	e8 23 d7 ff ff       	call   f0100049 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0102926:	68 bb bb 10 f0       	push   $0xf010bbbb
+f010292b:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102930:	68 80 04 00 00       	push   $0x480
+f0102935:	68 25 ba 10 f0       	push   $0xf010ba25
+f010293a:	e8 0a d7 ff ff       	call   f0100049 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f010293f:	68 44 b2 10 f0       	push   $0xf010b244
+f0102944:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102949:	68 81 04 00 00       	push   $0x481
+f010294e:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102953:	e8 f1 d6 ff ff       	call   f0100049 <_panic>
+	assert(!page_alloc(0));
+f0102958:	68 24 bc 10 f0       	push   $0xf010bc24
+f010295d:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102962:	68 87 04 00 00       	push   $0x487
+f0102967:	68 25 ba 10 f0       	push   $0xf010ba25
+f010296c:	e8 d8 d6 ff ff       	call   f0100049 <_panic>
+	assert(page_lookup(kern_pgdir, (void *) 0x0, &ptep) == NULL);
+f0102971:	68 84 b2 10 f0       	push   $0xf010b284
+f0102976:	68 25 aa 10 f0       	push   $0xf010aa25
+f010297b:	68 8a 04 00 00       	push   $0x48a
+f0102980:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102985:	e8 bf d6 ff ff       	call   f0100049 <_panic>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) < 0);
+f010298a:	68 bc b2 10 f0       	push   $0xf010b2bc
+f010298f:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102994:	68 8d 04 00 00       	push   $0x48d
+f0102999:	68 25 ba 10 f0       	push   $0xf010ba25
+f010299e:	e8 a6 d6 ff ff       	call   f0100049 <_panic>
+	assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) == 0);
+f01029a3:	68 ec b2 10 f0       	push   $0xf010b2ec
+f01029a8:	68 25 aa 10 f0       	push   $0xf010aa25
+f01029ad:	68 91 04 00 00       	push   $0x491
+f01029b2:	68 25 ba 10 f0       	push   $0xf010ba25
+f01029b7:	e8 8d d6 ff ff       	call   f0100049 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f01029bc:	68 1c b3 10 f0       	push   $0xf010b31c
+f01029c1:	68 25 aa 10 f0       	push   $0xf010aa25
+f01029c6:	68 92 04 00 00       	push   $0x492
+f01029cb:	68 25 ba 10 f0       	push   $0xf010ba25
+f01029d0:	e8 74 d6 ff ff       	call   f0100049 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == page2pa(pp1));
+f01029d5:	68 44 b3 10 f0       	push   $0xf010b344
+f01029da:	68 25 aa 10 f0       	push   $0xf010aa25
+f01029df:	68 93 04 00 00       	push   $0x493
+f01029e4:	68 25 ba 10 f0       	push   $0xf010ba25
+f01029e9:	e8 5b d6 ff ff       	call   f0100049 <_panic>
+	assert(pp1->pp_ref == 1);
+f01029ee:	68 76 bc 10 f0       	push   $0xf010bc76
+f01029f3:	68 25 aa 10 f0       	push   $0xf010aa25
+f01029f8:	68 94 04 00 00       	push   $0x494
+f01029fd:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102a02:	e8 42 d6 ff ff       	call   f0100049 <_panic>
+	assert(pp0->pp_ref == 1);
+f0102a07:	68 87 bc 10 f0       	push   $0xf010bc87
+f0102a0c:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102a11:	68 95 04 00 00       	push   $0x495
+f0102a16:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102a1b:	e8 29 d6 ff ff       	call   f0100049 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0102a20:	68 74 b3 10 f0       	push   $0xf010b374
+f0102a25:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102a2a:	68 98 04 00 00       	push   $0x498
+f0102a2f:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102a34:	e8 10 d6 ff ff       	call   f0100049 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0102a39:	68 b0 b3 10 f0       	push   $0xf010b3b0
+f0102a3e:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102a43:	68 99 04 00 00       	push   $0x499
+f0102a48:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102a4d:	e8 f7 d5 ff ff       	call   f0100049 <_panic>
+	assert(pp2->pp_ref == 1);
+f0102a52:	68 98 bc 10 f0       	push   $0xf010bc98
+f0102a57:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102a5c:	68 9a 04 00 00       	push   $0x49a
+f0102a61:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102a66:	e8 de d5 ff ff       	call   f0100049 <_panic>
+	assert(!page_alloc(0));
+f0102a6b:	68 24 bc 10 f0       	push   $0xf010bc24
+f0102a70:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102a75:	68 9d 04 00 00       	push   $0x49d
+f0102a7a:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102a7f:	e8 c5 d5 ff ff       	call   f0100049 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0102a84:	68 74 b3 10 f0       	push   $0xf010b374
+f0102a89:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102a8e:	68 a0 04 00 00       	push   $0x4a0
+f0102a93:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102a98:	e8 ac d5 ff ff       	call   f0100049 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0102a9d:	68 b0 b3 10 f0       	push   $0xf010b3b0
+f0102aa2:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102aa7:	68 a1 04 00 00       	push   $0x4a1
+f0102aac:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102ab1:	e8 93 d5 ff ff       	call   f0100049 <_panic>
+	assert(pp2->pp_ref == 1);
+f0102ab6:	68 98 bc 10 f0       	push   $0xf010bc98
+f0102abb:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102ac0:	68 a2 04 00 00       	push   $0x4a2
+f0102ac5:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102aca:	e8 7a d5 ff ff       	call   f0100049 <_panic>
+	assert(!page_alloc(0));
+f0102acf:	68 24 bc 10 f0       	push   $0xf010bc24
+f0102ad4:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102ad9:	68 a6 04 00 00       	push   $0x4a6
+f0102ade:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102ae3:	e8 61 d5 ff ff       	call   f0100049 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102ae8:	56                   	push   %esi
+f0102ae9:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0102aee:	68 a9 04 00 00       	push   $0x4a9
+f0102af3:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102af8:	e8 4c d5 ff ff       	call   f0100049 <_panic>
+	assert(pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) == ptep+PTX(PGSIZE));
+f0102afd:	68 e0 b3 10 f0       	push   $0xf010b3e0
+f0102b02:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102b07:	68 aa 04 00 00       	push   $0x4aa
+f0102b0c:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102b11:	e8 33 d5 ff ff       	call   f0100049 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W|PTE_U) == 0);
+f0102b16:	68 20 b4 10 f0       	push   $0xf010b420
+f0102b1b:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102b20:	68 ad 04 00 00       	push   $0x4ad
+f0102b25:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102b2a:	e8 1a d5 ff ff       	call   f0100049 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0102b2f:	68 b0 b3 10 f0       	push   $0xf010b3b0
+f0102b34:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102b39:	68 ae 04 00 00       	push   $0x4ae
+f0102b3e:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102b43:	e8 01 d5 ff ff       	call   f0100049 <_panic>
+	assert(pp2->pp_ref == 1);
+f0102b48:	68 98 bc 10 f0       	push   $0xf010bc98
+f0102b4d:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102b52:	68 af 04 00 00       	push   $0x4af
+f0102b57:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102b5c:	e8 e8 d4 ff ff       	call   f0100049 <_panic>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U);
+f0102b61:	68 60 b4 10 f0       	push   $0xf010b460
+f0102b66:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102b6b:	68 b0 04 00 00       	push   $0x4b0
+f0102b70:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102b75:	e8 cf d4 ff ff       	call   f0100049 <_panic>
+	assert(kern_pgdir[0] & PTE_U);
+f0102b7a:	68 a9 bc 10 f0       	push   $0xf010bca9
+f0102b7f:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102b84:	68 b1 04 00 00       	push   $0x4b1
+f0102b89:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102b8e:	e8 b6 d4 ff ff       	call   f0100049 <_panic>
+	assert(page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W) == 0);
+f0102b93:	68 74 b3 10 f0       	push   $0xf010b374
+f0102b98:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102b9d:	68 b4 04 00 00       	push   $0x4b4
+f0102ba2:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102ba7:	e8 9d d4 ff ff       	call   f0100049 <_panic>
+	assert(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_W);
+f0102bac:	68 94 b4 10 f0       	push   $0xf010b494
+f0102bb1:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102bb6:	68 b5 04 00 00       	push   $0x4b5
+f0102bbb:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102bc0:	e8 84 d4 ff ff       	call   f0100049 <_panic>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f0102bc5:	68 c8 b4 10 f0       	push   $0xf010b4c8
+f0102bca:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102bcf:	68 b6 04 00 00       	push   $0x4b6
+f0102bd4:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102bd9:	e8 6b d4 ff ff       	call   f0100049 <_panic>
+	assert(page_insert(kern_pgdir, pp0, (void*) PTSIZE, PTE_W) < 0);
+f0102bde:	68 00 b5 10 f0       	push   $0xf010b500
+f0102be3:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102be8:	68 b9 04 00 00       	push   $0x4b9
+f0102bed:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102bf2:	e8 52 d4 ff ff       	call   f0100049 <_panic>
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W) == 0);
+f0102bf7:	68 38 b5 10 f0       	push   $0xf010b538
+f0102bfc:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102c01:	68 bc 04 00 00       	push   $0x4bc
+f0102c06:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102c0b:	e8 39 d4 ff ff       	call   f0100049 <_panic>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) PGSIZE, 0) & PTE_U));
+f0102c10:	68 c8 b4 10 f0       	push   $0xf010b4c8
+f0102c15:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102c1a:	68 bd 04 00 00       	push   $0x4bd
+f0102c1f:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102c24:	e8 20 d4 ff ff       	call   f0100049 <_panic>
+	assert(check_va2pa(kern_pgdir, 0) == page2pa(pp1));
+f0102c29:	68 74 b5 10 f0       	push   $0xf010b574
+f0102c2e:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102c33:	68 c0 04 00 00       	push   $0x4c0
+f0102c38:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102c3d:	e8 07 d4 ff ff       	call   f0100049 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0102c42:	68 a0 b5 10 f0       	push   $0xf010b5a0
+f0102c47:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102c4c:	68 c1 04 00 00       	push   $0x4c1
+f0102c51:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102c56:	e8 ee d3 ff ff       	call   f0100049 <_panic>
+	assert(pp1->pp_ref == 2);
+f0102c5b:	68 bf bc 10 f0       	push   $0xf010bcbf
+f0102c60:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102c65:	68 c3 04 00 00       	push   $0x4c3
+f0102c6a:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102c6f:	e8 d5 d3 ff ff       	call   f0100049 <_panic>
+	assert(pp2->pp_ref == 0);
+f0102c74:	68 d0 bc 10 f0       	push   $0xf010bcd0
+f0102c79:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102c7e:	68 c4 04 00 00       	push   $0x4c4
+f0102c83:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102c88:	e8 bc d3 ff ff       	call   f0100049 <_panic>
+	assert((pp = page_alloc(0)) && pp == pp2);
+f0102c8d:	68 d0 b5 10 f0       	push   $0xf010b5d0
+f0102c92:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102c97:	68 c7 04 00 00       	push   $0x4c7
+f0102c9c:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102ca1:	e8 a3 d3 ff ff       	call   f0100049 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0102ca6:	68 f4 b5 10 f0       	push   $0xf010b5f4
+f0102cab:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102cb0:	68 cb 04 00 00       	push   $0x4cb
+f0102cb5:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102cba:	e8 8a d3 ff ff       	call   f0100049 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0102cbf:	68 a0 b5 10 f0       	push   $0xf010b5a0
+f0102cc4:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102cc9:	68 cc 04 00 00       	push   $0x4cc
+f0102cce:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102cd3:	e8 71 d3 ff ff       	call   f0100049 <_panic>
+	assert(pp1->pp_ref == 1);
+f0102cd8:	68 76 bc 10 f0       	push   $0xf010bc76
+f0102cdd:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102ce2:	68 cd 04 00 00       	push   $0x4cd
+f0102ce7:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102cec:	e8 58 d3 ff ff       	call   f0100049 <_panic>
+	assert(pp2->pp_ref == 0);
+f0102cf1:	68 d0 bc 10 f0       	push   $0xf010bcd0
+f0102cf6:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102cfb:	68 ce 04 00 00       	push   $0x4ce
+f0102d00:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102d05:	e8 3f d3 ff ff       	call   f0100049 <_panic>
+	assert(page_insert(kern_pgdir, pp1, (void*) PGSIZE, 0) == 0);
+f0102d0a:	68 18 b6 10 f0       	push   $0xf010b618
+f0102d0f:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102d14:	68 d1 04 00 00       	push   $0x4d1
+f0102d19:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102d1e:	e8 26 d3 ff ff       	call   f0100049 <_panic>
+	assert(pp1->pp_ref);
+f0102d23:	68 e1 bc 10 f0       	push   $0xf010bce1
+f0102d28:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102d2d:	68 d2 04 00 00       	push   $0x4d2
+f0102d32:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102d37:	e8 0d d3 ff ff       	call   f0100049 <_panic>
+	assert(pp1->pp_prev == NULL);
+f0102d3c:	68 ed bc 10 f0       	push   $0xf010bced
+f0102d41:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102d46:	68 d3 04 00 00       	push   $0x4d3
+f0102d4b:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102d50:	e8 f4 d2 ff ff       	call   f0100049 <_panic>
+	assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0102d55:	68 f4 b5 10 f0       	push   $0xf010b5f4
+f0102d5a:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102d5f:	68 d7 04 00 00       	push   $0x4d7
+f0102d64:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102d69:	e8 db d2 ff ff       	call   f0100049 <_panic>
+	assert(check_va2pa(kern_pgdir, PGSIZE) == ~0);
+f0102d6e:	68 50 b6 10 f0       	push   $0xf010b650
+f0102d73:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102d78:	68 d8 04 00 00       	push   $0x4d8
+f0102d7d:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102d82:	e8 c2 d2 ff ff       	call   f0100049 <_panic>
+	assert(pp1->pp_ref == 0);
+f0102d87:	68 02 bd 10 f0       	push   $0xf010bd02
+f0102d8c:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102d91:	68 d9 04 00 00       	push   $0x4d9
+f0102d96:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102d9b:	e8 a9 d2 ff ff       	call   f0100049 <_panic>
+	assert(pp2->pp_ref == 0);
+f0102da0:	68 d0 bc 10 f0       	push   $0xf010bcd0
+f0102da5:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102daa:	68 da 04 00 00       	push   $0x4da
+f0102daf:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102db4:	e8 90 d2 ff ff       	call   f0100049 <_panic>
+	assert((pp = page_alloc(0)) && pp == pp1);
+f0102db9:	68 78 b6 10 f0       	push   $0xf010b678
+f0102dbe:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102dc3:	68 dd 04 00 00       	push   $0x4dd
+f0102dc8:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102dcd:	e8 77 d2 ff ff       	call   f0100049 <_panic>
+	assert(!page_alloc(0));
+f0102dd2:	68 24 bc 10 f0       	push   $0xf010bc24
+f0102dd7:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102ddc:	68 e0 04 00 00       	push   $0x4e0
+f0102de1:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102de6:	e8 5e d2 ff ff       	call   f0100049 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0102deb:	68 1c b3 10 f0       	push   $0xf010b31c
+f0102df0:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102df5:	68 e3 04 00 00       	push   $0x4e3
+f0102dfa:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102dff:	e8 45 d2 ff ff       	call   f0100049 <_panic>
+	assert(pp0->pp_ref == 1);
+f0102e04:	68 87 bc 10 f0       	push   $0xf010bc87
+f0102e09:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102e0e:	68 e5 04 00 00       	push   $0x4e5
+f0102e13:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102e18:	e8 2c d2 ff ff       	call   f0100049 <_panic>
+f0102e1d:	56                   	push   %esi
+f0102e1e:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0102e23:	68 ec 04 00 00       	push   $0x4ec
+f0102e28:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102e2d:	e8 17 d2 ff ff       	call   f0100049 <_panic>
+	assert(ptep == ptep1 + PTX(va));
+f0102e32:	68 13 bd 10 f0       	push   $0xf010bd13
+f0102e37:	68 25 aa 10 f0       	push   $0xf010aa25
+f0102e3c:	68 ed 04 00 00       	push   $0x4ed
+f0102e41:	68 25 ba 10 f0       	push   $0xf010ba25
+f0102e46:	e8 fe d1 ff ff       	call   f0100049 <_panic>
+f0102e4b:	51                   	push   %ecx
+f0102e4c:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0102e51:	6a 5f                	push   $0x5f
+f0102e53:	68 31 ba 10 f0       	push   $0xf010ba31
+f0102e58:	e8 ec d1 ff ff       	call   f0100049 <_panic>
+f0102e5d:	51                   	push   %ecx
+f0102e5e:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0102e63:	6a 5f                	push   $0x5f
+f0102e65:	68 31 ba 10 f0       	push   $0xf010ba31
+f0102e6a:	e8 da d1 ff ff       	call   f0100049 <_panic>
+	kern_pgdir[0] = 0;
+f0102e6f:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+f0102e74:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	pp0->pp_ref = 0;
+f0102e7a:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f0102e7d:	66 c7 46 08 00 00    	movw   $0x0,0x8(%esi)
+
+	// give free list back
+	restore_buddy_memory();
+f0102e83:	e8 14 df ff ff       	call   f0100d9c <restore_buddy_memory>
+
+	// free the pages we took
+	page_free(pp0);
+f0102e88:	83 ec 0c             	sub    $0xc,%esp
+f0102e8b:	56                   	push   %esi
+f0102e8c:	e8 53 ea ff ff       	call   f01018e4 <page_free>
+	page_free(pp1);
+f0102e91:	89 3c 24             	mov    %edi,(%esp)
+f0102e94:	e8 4b ea ff ff       	call   f01018e4 <page_free>
+	page_free(pp2);
+f0102e99:	89 1c 24             	mov    %ebx,(%esp)
+f0102e9c:	e8 43 ea ff ff       	call   f01018e4 <page_free>
+
+	// test mmio_map_region
+	mm1 = (uintptr_t) mmio_map_region(0, 4097);
+f0102ea1:	83 c4 08             	add    $0x8,%esp
+f0102ea4:	68 01 10 00 00       	push   $0x1001
+f0102ea9:	6a 00                	push   $0x0
+f0102eab:	e8 b5 ed ff ff       	call   f0101c65 <mmio_map_region>
+f0102eb0:	89 c6                	mov    %eax,%esi
+	mm2 = (uintptr_t) mmio_map_region(0, 4096);
+f0102eb2:	83 c4 08             	add    $0x8,%esp
+f0102eb5:	68 00 10 00 00       	push   $0x1000
+f0102eba:	6a 00                	push   $0x0
+f0102ebc:	e8 a4 ed ff ff       	call   f0101c65 <mmio_map_region>
+f0102ec1:	89 c7                	mov    %eax,%edi
+	// check that they're in the right region
+	assert(mm1 >= MMIOBASE && mm1 + 8192 < MMIOLIM);
+f0102ec3:	8d 86 00 20 00 00    	lea    0x2000(%esi),%eax
+f0102ec9:	83 c4 10             	add    $0x10,%esp
+f0102ecc:	81 fe ff ff 7f ef    	cmp    $0xef7fffff,%esi
+f0102ed2:	0f 86 91 02 00 00    	jbe    f0103169 <mem_init+0x14b8>
+f0102ed8:	3d ff ff bf ef       	cmp    $0xefbfffff,%eax
+f0102edd:	0f 87 86 02 00 00    	ja     f0103169 <mem_init+0x14b8>
+	assert(mm2 >= MMIOBASE && mm2 + 8192 < MMIOLIM);
+f0102ee3:	8d 97 00 20 00 00    	lea    0x2000(%edi),%edx
+f0102ee9:	81 fa ff ff bf ef    	cmp    $0xefbfffff,%edx
+f0102eef:	0f 87 8d 02 00 00    	ja     f0103182 <mem_init+0x14d1>
+f0102ef5:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f0102efb:	0f 86 81 02 00 00    	jbe    f0103182 <mem_init+0x14d1>
+	// check that they're page-aligned
+	assert(mm1 % PGSIZE == 0 && mm2 % PGSIZE == 0);
+f0102f01:	89 f2                	mov    %esi,%edx
+f0102f03:	09 fa                	or     %edi,%edx
+f0102f05:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f0102f0b:	0f 85 8a 02 00 00    	jne    f010319b <mem_init+0x14ea>
+	// check that they don't overlap
+	assert(mm1 + 8192 <= mm2);
+f0102f11:	39 c7                	cmp    %eax,%edi
+f0102f13:	0f 82 9b 02 00 00    	jb     f01031b4 <mem_init+0x1503>
+	// check page mappings
+	assert(check_va2pa(kern_pgdir, mm1) == 0);
+f0102f19:	8b 1d a8 c2 7f f0    	mov    0xf07fc2a8,%ebx
+f0102f1f:	89 f2                	mov    %esi,%edx
+f0102f21:	89 d8                	mov    %ebx,%eax
+f0102f23:	e8 b9 de ff ff       	call   f0100de1 <check_va2pa>
+f0102f28:	85 c0                	test   %eax,%eax
+f0102f2a:	0f 85 9d 02 00 00    	jne    f01031cd <mem_init+0x151c>
+	assert(check_va2pa(kern_pgdir, mm1+PGSIZE) == PGSIZE);
+f0102f30:	8d 86 00 10 00 00    	lea    0x1000(%esi),%eax
+f0102f36:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102f39:	89 c2                	mov    %eax,%edx
+f0102f3b:	89 d8                	mov    %ebx,%eax
+f0102f3d:	e8 9f de ff ff       	call   f0100de1 <check_va2pa>
+f0102f42:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f0102f47:	0f 85 99 02 00 00    	jne    f01031e6 <mem_init+0x1535>
+	assert(check_va2pa(kern_pgdir, mm2) == 0);
+f0102f4d:	89 fa                	mov    %edi,%edx
+f0102f4f:	89 d8                	mov    %ebx,%eax
+f0102f51:	e8 8b de ff ff       	call   f0100de1 <check_va2pa>
+f0102f56:	85 c0                	test   %eax,%eax
+f0102f58:	0f 85 a1 02 00 00    	jne    f01031ff <mem_init+0x154e>
+	assert(check_va2pa(kern_pgdir, mm2+PGSIZE) == ~0);
+f0102f5e:	8d 97 00 10 00 00    	lea    0x1000(%edi),%edx
+f0102f64:	89 d8                	mov    %ebx,%eax
+f0102f66:	e8 76 de ff ff       	call   f0100de1 <check_va2pa>
+f0102f6b:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102f6e:	0f 85 a4 02 00 00    	jne    f0103218 <mem_init+0x1567>
+	// check permissions
+	assert(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & (PTE_W|PTE_PWT|PTE_PCD));
+f0102f74:	83 ec 04             	sub    $0x4,%esp
+f0102f77:	6a 00                	push   $0x0
+f0102f79:	56                   	push   %esi
+f0102f7a:	53                   	push   %ebx
+f0102f7b:	e8 e2 e9 ff ff       	call   f0101962 <pgdir_walk>
+f0102f80:	83 c4 10             	add    $0x10,%esp
+f0102f83:	f6 00 1a             	testb  $0x1a,(%eax)
+f0102f86:	0f 84 a5 02 00 00    	je     f0103231 <mem_init+0x1580>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & PTE_U));
+f0102f8c:	83 ec 04             	sub    $0x4,%esp
+f0102f8f:	6a 00                	push   $0x0
+f0102f91:	56                   	push   %esi
+f0102f92:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f0102f98:	e8 c5 e9 ff ff       	call   f0101962 <pgdir_walk>
+f0102f9d:	8b 00                	mov    (%eax),%eax
+f0102f9f:	83 c4 10             	add    $0x10,%esp
+f0102fa2:	83 e0 04             	and    $0x4,%eax
+f0102fa5:	89 c3                	mov    %eax,%ebx
+f0102fa7:	0f 85 9d 02 00 00    	jne    f010324a <mem_init+0x1599>
+	// clear the mappings
+	*pgdir_walk(kern_pgdir, (void*) mm1, 0) = 0;
+f0102fad:	83 ec 04             	sub    $0x4,%esp
+f0102fb0:	6a 00                	push   $0x0
+f0102fb2:	56                   	push   %esi
+f0102fb3:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f0102fb9:	e8 a4 e9 ff ff       	call   f0101962 <pgdir_walk>
+f0102fbe:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	*pgdir_walk(kern_pgdir, (void*) mm1 + PGSIZE, 0) = 0;
+f0102fc4:	83 c4 0c             	add    $0xc,%esp
+f0102fc7:	6a 00                	push   $0x0
+f0102fc9:	ff 75 d4             	push   -0x2c(%ebp)
+f0102fcc:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f0102fd2:	e8 8b e9 ff ff       	call   f0101962 <pgdir_walk>
+f0102fd7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	*pgdir_walk(kern_pgdir, (void*) mm2, 0) = 0;
+f0102fdd:	83 c4 0c             	add    $0xc,%esp
+f0102fe0:	6a 00                	push   $0x0
+f0102fe2:	57                   	push   %edi
+f0102fe3:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f0102fe9:	e8 74 e9 ff ff       	call   f0101962 <pgdir_walk>
+f0102fee:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	page_decref(pa2page(PTE_ADDR(kern_pgdir[PDX(MMIOBASE)])));
+f0102ff4:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+f0102ff9:	8b 80 f8 0e 00 00    	mov    0xef8(%eax),%eax
+f0102fff:	c1 e8 0c             	shr    $0xc,%eax
+	if (PGNUM(pa) >= npages)
+f0103002:	83 c4 10             	add    $0x10,%esp
+f0103005:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f010300b:	0f 83 52 02 00 00    	jae    f0103263 <mem_init+0x15b2>
+f0103011:	83 ec 0c             	sub    $0xc,%esp
+	return &pool.pages[PGNUM(pa)];
+f0103014:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0103017:	a1 68 c2 7f f0       	mov    0xf07fc268,%eax
+f010301c:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f010301f:	50                   	push   %eax
+f0103020:	e8 f6 e8 ff ff       	call   f010191b <page_decref>
+	kern_pgdir[PDX(MMIOBASE)] = 0;
+f0103025:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+f010302a:	c7 80 f8 0e 00 00 00 	movl   $0x0,0xef8(%eax)
+f0103031:	00 00 00 
+
+	cprintf("check_page() succeeded!\n");
+f0103034:	c7 04 24 54 bd 10 f0 	movl   $0xf010bd54,(%esp)
+f010303b:	e8 a1 13 00 00       	call   f01043e1 <cprintf>
+	check_buddy();
+f0103040:	e8 5e e3 ff ff       	call   f01013a3 <check_buddy>
+			PADDR(pool.pages), PTE_U);
+f0103045:	a1 68 c2 7f f0       	mov    0xf07fc268,%eax
+	if ((uint32_t)kva < KERNBASE)
+f010304a:	83 c4 10             	add    $0x10,%esp
+f010304d:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103052:	0f 86 1f 02 00 00    	jbe    f0103277 <mem_init+0x15c6>
+			ROUNDUP(sizeof(struct PageInfo) * npages, PGSIZE),
+f0103058:	8b 15 ac c2 7f f0    	mov    0xf07fc2ac,%edx
+f010305e:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f0103061:	8d 0c 95 ff 0f 00 00 	lea    0xfff(,%edx,4),%ecx
+	boot_map_region(kern_pgdir, UPAGES,
+f0103068:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+f010306e:	83 ec 08             	sub    $0x8,%esp
+f0103071:	6a 04                	push   $0x4
+	return (physaddr_t)kva - KERNBASE;
+f0103073:	05 00 00 00 10       	add    $0x10000000,%eax
+f0103078:	50                   	push   %eax
+f0103079:	ba 00 00 00 ef       	mov    $0xef000000,%edx
+f010307e:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+f0103083:	e8 90 e9 ff ff       	call   f0101a18 <boot_map_region>
+	boot_map_region(kern_pgdir, UENVS,
+f0103088:	a1 04 c3 7f f0       	mov    0xf07fc304,%eax
+	if ((uint32_t)kva < KERNBASE)
+f010308d:	83 c4 10             	add    $0x10,%esp
+f0103090:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103095:	0f 86 f1 01 00 00    	jbe    f010328c <mem_init+0x15db>
+f010309b:	83 ec 08             	sub    $0x8,%esp
+f010309e:	6a 04                	push   $0x4
+	return (physaddr_t)kva - KERNBASE;
+f01030a0:	05 00 00 00 10       	add    $0x10000000,%eax
+f01030a5:	50                   	push   %eax
+f01030a6:	b9 00 30 02 00       	mov    $0x23000,%ecx
+f01030ab:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+f01030b0:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+f01030b5:	e8 5e e9 ff ff       	call   f0101a18 <boot_map_region>
+	if ((uint32_t)kva < KERNBASE)
+f01030ba:	83 c4 10             	add    $0x10,%esp
+f01030bd:	b8 00 d0 10 f0       	mov    $0xf010d000,%eax
+f01030c2:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01030c7:	0f 86 d4 01 00 00    	jbe    f01032a1 <mem_init+0x15f0>
+	boot_map_region(kern_pgdir, KSTACKTOP - KSTKSIZE, KSTKSIZE,
+f01030cd:	83 ec 08             	sub    $0x8,%esp
+f01030d0:	6a 02                	push   $0x2
+f01030d2:	68 00 d0 10 00       	push   $0x10d000
+f01030d7:	b9 00 80 00 00       	mov    $0x8000,%ecx
+f01030dc:	ba 00 80 ff ef       	mov    $0xefff8000,%edx
+f01030e1:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+f01030e6:	e8 2d e9 ff ff       	call   f0101a18 <boot_map_region>
+	boot_map_region(kern_pgdir, KERNBASE, -KERNBASE, 0, PTE_PS | PTE_W);
+f01030eb:	83 c4 08             	add    $0x8,%esp
+f01030ee:	68 82 00 00 00       	push   $0x82
+f01030f3:	6a 00                	push   $0x0
+f01030f5:	b9 00 00 00 10       	mov    $0x10000000,%ecx
+f01030fa:	ba 00 00 00 f0       	mov    $0xf0000000,%edx
+f01030ff:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+f0103104:	e8 0f e9 ff ff       	call   f0101a18 <boot_map_region>
+	for (int i = 0; i < NCPU; i++) {
+f0103109:	c7 45 d4 00 d0 7f f0 	movl   $0xf07fd000,-0x2c(%ebp)
+f0103110:	bf 00 d0 83 f0       	mov    $0xf083d000,%edi
+f0103115:	83 c4 10             	add    $0x10,%esp
+f0103118:	b8 00 d0 7f f0       	mov    $0xf07fd000,%eax
+f010311d:	be 00 80 ff ef       	mov    $0xefff8000,%esi
+f0103122:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+f0103125:	89 c3                	mov    %eax,%ebx
+f0103127:	39 fb                	cmp    %edi,%ebx
+f0103129:	0f 84 9c 01 00 00    	je     f01032cb <mem_init+0x161a>
+f010312f:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0103135:	0f 86 7b 01 00 00    	jbe    f01032b6 <mem_init+0x1605>
+		boot_map_region(kern_pgdir, kstacktop - KSTKSIZE, KSTKSIZE,
+f010313b:	83 ec 08             	sub    $0x8,%esp
+f010313e:	6a 02                	push   $0x2
+	return (physaddr_t)kva - KERNBASE;
+f0103140:	8d 83 00 00 00 10    	lea    0x10000000(%ebx),%eax
+f0103146:	50                   	push   %eax
+f0103147:	b9 00 80 00 00       	mov    $0x8000,%ecx
+f010314c:	89 f2                	mov    %esi,%edx
+f010314e:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+f0103153:	e8 c0 e8 ff ff       	call   f0101a18 <boot_map_region>
+	for (int i = 0; i < NCPU; i++) {
+f0103158:	81 ee 00 00 01 00    	sub    $0x10000,%esi
+f010315e:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+f0103164:	83 c4 10             	add    $0x10,%esp
+f0103167:	eb be                	jmp    f0103127 <mem_init+0x1476>
+	assert(mm1 >= MMIOBASE && mm1 + 8192 < MMIOLIM);
+f0103169:	68 9c b6 10 f0       	push   $0xf010b69c
+f010316e:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103173:	68 07 05 00 00       	push   $0x507
+f0103178:	68 25 ba 10 f0       	push   $0xf010ba25
+f010317d:	e8 c7 ce ff ff       	call   f0100049 <_panic>
+	assert(mm2 >= MMIOBASE && mm2 + 8192 < MMIOLIM);
+f0103182:	68 c4 b6 10 f0       	push   $0xf010b6c4
+f0103187:	68 25 aa 10 f0       	push   $0xf010aa25
+f010318c:	68 08 05 00 00       	push   $0x508
+f0103191:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103196:	e8 ae ce ff ff       	call   f0100049 <_panic>
+	assert(mm1 % PGSIZE == 0 && mm2 % PGSIZE == 0);
+f010319b:	68 ec b6 10 f0       	push   $0xf010b6ec
+f01031a0:	68 25 aa 10 f0       	push   $0xf010aa25
+f01031a5:	68 0a 05 00 00       	push   $0x50a
+f01031aa:	68 25 ba 10 f0       	push   $0xf010ba25
+f01031af:	e8 95 ce ff ff       	call   f0100049 <_panic>
+	assert(mm1 + 8192 <= mm2);
+f01031b4:	68 42 bd 10 f0       	push   $0xf010bd42
+f01031b9:	68 25 aa 10 f0       	push   $0xf010aa25
+f01031be:	68 0c 05 00 00       	push   $0x50c
+f01031c3:	68 25 ba 10 f0       	push   $0xf010ba25
+f01031c8:	e8 7c ce ff ff       	call   f0100049 <_panic>
+	assert(check_va2pa(kern_pgdir, mm1) == 0);
+f01031cd:	68 14 b7 10 f0       	push   $0xf010b714
+f01031d2:	68 25 aa 10 f0       	push   $0xf010aa25
+f01031d7:	68 0e 05 00 00       	push   $0x50e
+f01031dc:	68 25 ba 10 f0       	push   $0xf010ba25
+f01031e1:	e8 63 ce ff ff       	call   f0100049 <_panic>
+	assert(check_va2pa(kern_pgdir, mm1+PGSIZE) == PGSIZE);
+f01031e6:	68 38 b7 10 f0       	push   $0xf010b738
+f01031eb:	68 25 aa 10 f0       	push   $0xf010aa25
+f01031f0:	68 0f 05 00 00       	push   $0x50f
+f01031f5:	68 25 ba 10 f0       	push   $0xf010ba25
+f01031fa:	e8 4a ce ff ff       	call   f0100049 <_panic>
+	assert(check_va2pa(kern_pgdir, mm2) == 0);
+f01031ff:	68 68 b7 10 f0       	push   $0xf010b768
+f0103204:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103209:	68 10 05 00 00       	push   $0x510
+f010320e:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103213:	e8 31 ce ff ff       	call   f0100049 <_panic>
+	assert(check_va2pa(kern_pgdir, mm2+PGSIZE) == ~0);
+f0103218:	68 8c b7 10 f0       	push   $0xf010b78c
+f010321d:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103222:	68 11 05 00 00       	push   $0x511
+f0103227:	68 25 ba 10 f0       	push   $0xf010ba25
+f010322c:	e8 18 ce ff ff       	call   f0100049 <_panic>
+	assert(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & (PTE_W|PTE_PWT|PTE_PCD));
+f0103231:	68 b8 b7 10 f0       	push   $0xf010b7b8
+f0103236:	68 25 aa 10 f0       	push   $0xf010aa25
+f010323b:	68 13 05 00 00       	push   $0x513
+f0103240:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103245:	e8 ff cd ff ff       	call   f0100049 <_panic>
+	assert(!(*pgdir_walk(kern_pgdir, (void*) mm1, 0) & PTE_U));
+f010324a:	68 fc b7 10 f0       	push   $0xf010b7fc
+f010324f:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103254:	68 14 05 00 00       	push   $0x514
+f0103259:	68 25 ba 10 f0       	push   $0xf010ba25
+f010325e:	e8 e6 cd ff ff       	call   f0100049 <_panic>
+		panic("pa2page called with invalid pa");
+f0103263:	83 ec 04             	sub    $0x4,%esp
+f0103266:	68 94 b0 10 f0       	push   $0xf010b094
+f010326b:	6a 58                	push   $0x58
+f010326d:	68 31 ba 10 f0       	push   $0xf010ba31
+f0103272:	e8 d2 cd ff ff       	call   f0100049 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103277:	50                   	push   %eax
+f0103278:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f010327d:	68 bb 00 00 00       	push   $0xbb
+f0103282:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103287:	e8 bd cd ff ff       	call   f0100049 <_panic>
+f010328c:	50                   	push   %eax
+f010328d:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0103292:	68 c6 00 00 00       	push   $0xc6
+f0103297:	68 25 ba 10 f0       	push   $0xf010ba25
+f010329c:	e8 a8 cd ff ff       	call   f0100049 <_panic>
+f01032a1:	50                   	push   %eax
+f01032a2:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f01032a7:	68 d4 00 00 00       	push   $0xd4
+f01032ac:	68 25 ba 10 f0       	push   $0xf010ba25
+f01032b1:	e8 93 cd ff ff       	call   f0100049 <_panic>
+f01032b6:	53                   	push   %ebx
+f01032b7:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f01032bc:	68 19 01 00 00       	push   $0x119
+f01032c1:	68 25 ba 10 f0       	push   $0xf010ba25
+f01032c6:	e8 7e cd ff ff       	call   f0100049 <_panic>
+	pgdir = kern_pgdir;
+f01032cb:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+f01032ce:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+f01032d1:	8b 3d a8 c2 7f f0    	mov    0xf07fc2a8,%edi
+	n = ROUNDUP(npages*sizeof(struct PageInfo), PGSIZE);
+f01032d7:	a1 ac c2 7f f0       	mov    0xf07fc2ac,%eax
+f01032dc:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f01032df:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f01032e2:	8d 14 95 ff 0f 00 00 	lea    0xfff(,%edx,4),%edx
+f01032e9:	89 d0                	mov    %edx,%eax
+f01032eb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+		assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pool.pages) + i);
+f01032f0:	8b 0d 68 c2 7f f0    	mov    0xf07fc268,%ecx
+f01032f6:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+	return (physaddr_t)kva - KERNBASE;
+f01032f9:	81 c1 00 00 00 10    	add    $0x10000000,%ecx
+	for (i = 0; i < n; i += PGSIZE)
+f01032ff:	89 de                	mov    %ebx,%esi
+f0103301:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f0103304:	89 cf                	mov    %ecx,%edi
+f0103306:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+f0103309:	89 c3                	mov    %eax,%ebx
+f010330b:	39 de                	cmp    %ebx,%esi
+f010330d:	73 56                	jae    f0103365 <mem_init+0x16b4>
+		assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pool.pages) + i);
+f010330f:	8d 96 00 00 00 ef    	lea    -0x11000000(%esi),%edx
+f0103315:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0103318:	e8 c4 da ff ff       	call   f0100de1 <check_va2pa>
+	if ((uint32_t)kva < KERNBASE)
+f010331d:	81 7d cc ff ff ff ef 	cmpl   $0xefffffff,-0x34(%ebp)
+f0103324:	76 0f                	jbe    f0103335 <mem_init+0x1684>
+f0103326:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+f0103329:	39 d0                	cmp    %edx,%eax
+f010332b:	75 1f                	jne    f010334c <mem_init+0x169b>
+	for (i = 0; i < n; i += PGSIZE)
+f010332d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0103333:	eb d6                	jmp    f010330b <mem_init+0x165a>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103335:	ff 75 cc             	push   -0x34(%ebp)
+f0103338:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f010333d:	68 2d 04 00 00       	push   $0x42d
+f0103342:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103347:	e8 fd cc ff ff       	call   f0100049 <_panic>
+		assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pool.pages) + i);
+f010334c:	68 30 b8 10 f0       	push   $0xf010b830
+f0103351:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103356:	68 2d 04 00 00       	push   $0x42d
+f010335b:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103360:	e8 e4 cc ff ff       	call   f0100049 <_panic>
+		assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
+f0103365:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0103368:	a1 04 c3 7f f0       	mov    0xf07fc304,%eax
+f010336d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	if ((uint32_t)kva < KERNBASE)
+f0103370:	be 00 00 c0 ee       	mov    $0xeec00000,%esi
+f0103375:	8d 88 00 f0 3f 21    	lea    0x213ff000(%eax),%ecx
+f010337b:	89 c7                	mov    %eax,%edi
+f010337d:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+f0103380:	89 cb                	mov    %ecx,%ebx
+f0103382:	89 f2                	mov    %esi,%edx
+f0103384:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0103387:	e8 55 da ff ff       	call   f0100de1 <check_va2pa>
+f010338c:	81 ff ff ff ff ef    	cmp    $0xefffffff,%edi
+f0103392:	76 45                	jbe    f01033d9 <mem_init+0x1728>
+f0103394:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f010339a:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+f010339d:	39 d0                	cmp    %edx,%eax
+f010339f:	75 4f                	jne    f01033f0 <mem_init+0x173f>
+	for (i = 0; i < n; i += PGSIZE)
+f01033a1:	81 fe 00 30 c2 ee    	cmp    $0xeec23000,%esi
+f01033a7:	75 d9                	jne    f0103382 <mem_init+0x16d1>
+	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f01033a9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f01033ac:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+f01033af:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f01033b2:	c1 e0 0c             	shl    $0xc,%eax
+f01033b5:	89 de                	mov    %ebx,%esi
+f01033b7:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+f01033ba:	89 c3                	mov    %eax,%ebx
+f01033bc:	39 de                	cmp    %ebx,%esi
+f01033be:	73 62                	jae    f0103422 <mem_init+0x1771>
+		assert(check_va2pa(pgdir, KERNBASE + i) == i);
+f01033c0:	8d 96 00 00 00 f0    	lea    -0x10000000(%esi),%edx
+f01033c6:	89 f8                	mov    %edi,%eax
+f01033c8:	e8 14 da ff ff       	call   f0100de1 <check_va2pa>
+f01033cd:	39 c6                	cmp    %eax,%esi
+f01033cf:	75 38                	jne    f0103409 <mem_init+0x1758>
+	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f01033d1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f01033d7:	eb e3                	jmp    f01033bc <mem_init+0x170b>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01033d9:	ff 75 c8             	push   -0x38(%ebp)
+f01033dc:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f01033e1:	68 32 04 00 00       	push   $0x432
+f01033e6:	68 25 ba 10 f0       	push   $0xf010ba25
+f01033eb:	e8 59 cc ff ff       	call   f0100049 <_panic>
+		assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
+f01033f0:	68 68 b8 10 f0       	push   $0xf010b868
+f01033f5:	68 25 aa 10 f0       	push   $0xf010aa25
+f01033fa:	68 32 04 00 00       	push   $0x432
+f01033ff:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103404:	e8 40 cc ff ff       	call   f0100049 <_panic>
+		assert(check_va2pa(pgdir, KERNBASE + i) == i);
+f0103409:	68 9c b8 10 f0       	push   $0xf010b89c
+f010340e:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103413:	68 36 04 00 00       	push   $0x436
+f0103418:	68 25 ba 10 f0       	push   $0xf010ba25
+f010341d:	e8 27 cc ff ff       	call   f0100049 <_panic>
+f0103422:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+f0103425:	c7 45 d0 00 50 80 00 	movl   $0x805000,-0x30(%ebp)
+f010342c:	ba 00 00 ff ef       	mov    $0xefff0000,%edx
+f0103431:	81 ea 00 d0 7f f0    	sub    $0xf07fd000,%edx
+f0103437:	89 55 c8             	mov    %edx,-0x38(%ebp)
+	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f010343a:	c7 45 cc 00 80 ff ef 	movl   $0xefff8000,-0x34(%ebp)
+f0103441:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+f0103444:	e9 a7 00 00 00       	jmp    f01034f0 <mem_init+0x183f>
+f0103449:	ff 75 d4             	push   -0x2c(%ebp)
+f010344c:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0103451:	68 3e 04 00 00       	push   $0x43e
+f0103456:	68 25 ba 10 f0       	push   $0xf010ba25
+f010345b:	e8 e9 cb ff ff       	call   f0100049 <_panic>
+		for (i = 0; i < KSTKSIZE; i += PGSIZE)
+f0103460:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103466:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0103469:	39 c3                	cmp    %eax,%ebx
+f010346b:	74 30                	je     f010349d <mem_init+0x17ec>
+			assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f010346d:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+f0103470:	89 f8                	mov    %edi,%eax
+f0103472:	e8 6a d9 ff ff       	call   f0100de1 <check_va2pa>
+	if ((uint32_t)kva < KERNBASE)
+f0103477:	81 7d d4 ff ff ff ef 	cmpl   $0xefffffff,-0x2c(%ebp)
+f010347e:	76 c9                	jbe    f0103449 <mem_init+0x1798>
+f0103480:	39 c3                	cmp    %eax,%ebx
+f0103482:	74 dc                	je     f0103460 <mem_init+0x17af>
+f0103484:	68 c4 b8 10 f0       	push   $0xf010b8c4
+f0103489:	68 25 aa 10 f0       	push   $0xf010aa25
+f010348e:	68 3d 04 00 00       	push   $0x43d
+f0103493:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103498:	e8 ac cb ff ff       	call   f0100049 <_panic>
+f010349d:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+f01034a0:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+		for (i = 0; i < KSTKGAP; i += PGSIZE)
+f01034a3:	39 de                	cmp    %ebx,%esi
+f01034a5:	74 2d                	je     f01034d4 <mem_init+0x1823>
+			assert(check_va2pa(pgdir, base + i) == ~0);
+f01034a7:	89 f2                	mov    %esi,%edx
+f01034a9:	89 f8                	mov    %edi,%eax
+f01034ab:	e8 31 d9 ff ff       	call   f0100de1 <check_va2pa>
+f01034b0:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f01034b6:	83 f8 ff             	cmp    $0xffffffff,%eax
+f01034b9:	74 e8                	je     f01034a3 <mem_init+0x17f2>
+f01034bb:	68 0c b9 10 f0       	push   $0xf010b90c
+f01034c0:	68 25 aa 10 f0       	push   $0xf010aa25
+f01034c5:	68 40 04 00 00       	push   $0x440
+f01034ca:	68 25 ba 10 f0       	push   $0xf010ba25
+f01034cf:	e8 75 cb ff ff       	call   f0100049 <_panic>
+	for (n = 0; n < NCPU; n++) {
+f01034d4:	81 6d cc 00 00 01 00 	subl   $0x10000,-0x34(%ebp)
+f01034db:	81 45 d4 00 80 00 00 	addl   $0x8000,-0x2c(%ebp)
+f01034e2:	81 45 d0 00 80 00 00 	addl   $0x8000,-0x30(%ebp)
+f01034e9:	81 6d c8 00 80 01 00 	subl   $0x18000,-0x38(%ebp)
+f01034f0:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f01034f3:	39 4d d4             	cmp    %ecx,-0x2c(%ebp)
+f01034f6:	74 24                	je     f010351c <mem_init+0x186b>
+		uint32_t base = KSTACKTOP - (KSTKSIZE + KSTKGAP) * (n + 1);
+f01034f8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f01034fb:	8d b0 00 80 ff ff    	lea    -0x8000(%eax),%esi
+	return (physaddr_t)kva - KERNBASE;
+f0103501:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103504:	8d 98 00 00 00 10    	lea    0x10000000(%eax),%ebx
+			assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f010350a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f010350d:	2d 00 80 ff 0f       	sub    $0xfff8000,%eax
+f0103512:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+f0103515:	89 c6                	mov    %eax,%esi
+		for (i = 0; i < KSTKSIZE; i += PGSIZE)
+f0103517:	e9 4a ff ff ff       	jmp    f0103466 <mem_init+0x17b5>
+f010351c:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+f010351f:	eb 08                	jmp    f0103529 <mem_init+0x1878>
+		switch (i) {
+f0103521:	81 fb ba 03 00 00    	cmp    $0x3ba,%ebx
+f0103527:	77 25                	ja     f010354e <mem_init+0x189d>
+				assert(pgdir[i] == 0);
+f0103529:	83 3c 9f 00          	cmpl   $0x0,(%edi,%ebx,4)
+f010352d:	75 7d                	jne    f01035ac <mem_init+0x18fb>
+	for (i = 0; i < NPDENTRIES; i++) {
+f010352f:	83 c3 01             	add    $0x1,%ebx
+f0103532:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+f0103538:	0f 84 87 00 00 00    	je     f01035c5 <mem_init+0x1914>
+		switch (i) {
+f010353e:	81 fb bd 03 00 00    	cmp    $0x3bd,%ebx
+f0103544:	76 db                	jbe    f0103521 <mem_init+0x1870>
+f0103546:	81 fb bf 03 00 00    	cmp    $0x3bf,%ebx
+f010354c:	75 1f                	jne    f010356d <mem_init+0x18bc>
+			assert(pgdir[i] & PTE_P);
+f010354e:	f6 04 9f 01          	testb  $0x1,(%edi,%ebx,4)
+f0103552:	75 db                	jne    f010352f <mem_init+0x187e>
+f0103554:	68 6d bd 10 f0       	push   $0xf010bd6d
+f0103559:	68 25 aa 10 f0       	push   $0xf010aa25
+f010355e:	68 4a 04 00 00       	push   $0x44a
+f0103563:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103568:	e8 dc ca ff ff       	call   f0100049 <_panic>
+			if (i >= PDX(KERNBASE)) {
+f010356d:	76 ba                	jbe    f0103529 <mem_init+0x1878>
+				assert(pgdir[i] & PTE_P);
+f010356f:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+f0103572:	a8 01                	test   $0x1,%al
+f0103574:	74 1d                	je     f0103593 <mem_init+0x18e2>
+				assert(pgdir[i] & PTE_W);
+f0103576:	a8 02                	test   $0x2,%al
+f0103578:	75 b5                	jne    f010352f <mem_init+0x187e>
+f010357a:	68 7e bd 10 f0       	push   $0xf010bd7e
+f010357f:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103584:	68 4f 04 00 00       	push   $0x44f
+f0103589:	68 25 ba 10 f0       	push   $0xf010ba25
+f010358e:	e8 b6 ca ff ff       	call   f0100049 <_panic>
+				assert(pgdir[i] & PTE_P);
+f0103593:	68 6d bd 10 f0       	push   $0xf010bd6d
+f0103598:	68 25 aa 10 f0       	push   $0xf010aa25
+f010359d:	68 4e 04 00 00       	push   $0x44e
+f01035a2:	68 25 ba 10 f0       	push   $0xf010ba25
+f01035a7:	e8 9d ca ff ff       	call   f0100049 <_panic>
+				assert(pgdir[i] == 0);
+f01035ac:	68 8f bd 10 f0       	push   $0xf010bd8f
+f01035b1:	68 25 aa 10 f0       	push   $0xf010aa25
+f01035b6:	68 51 04 00 00       	push   $0x451
+f01035bb:	68 25 ba 10 f0       	push   $0xf010ba25
+f01035c0:	e8 84 ca ff ff       	call   f0100049 <_panic>
+	cprintf("check_kern_pgdir() succeeded!\n");
+f01035c5:	83 ec 0c             	sub    $0xc,%esp
+f01035c8:	68 30 b9 10 f0       	push   $0xf010b930
+f01035cd:	e8 0f 0e 00 00       	call   f01043e1 <cprintf>
+	asm volatile("movl %%cr4,%0" : "=r" (cr4));
+f01035d2:	0f 20 e0             	mov    %cr4,%eax
+	assert(rcr4() & CR4_PSE);
+f01035d5:	83 c4 10             	add    $0x10,%esp
+f01035d8:	a8 10                	test   $0x10,%al
+f01035da:	0f 84 2b 02 00 00    	je     f010380b <mem_init+0x1b5a>
+	lcr3(PADDR(kern_pgdir));
+f01035e0:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01035e5:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01035ea:	0f 86 34 02 00 00    	jbe    f0103824 <mem_init+0x1b73>
+	return (physaddr_t)kva - KERNBASE;
+f01035f0:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f01035f5:	0f 22 d8             	mov    %eax,%cr3
+	check_page_free_list(0);
+f01035f8:	b8 00 00 00 00       	mov    $0x0,%eax
+f01035fd:	e8 1a d9 ff ff       	call   f0100f1c <check_page_free_list>
+	asm volatile("movl %%cr0,%0" : "=r" (val));
+f0103602:	0f 20 c0             	mov    %cr0,%eax
+	cr0 &= ~(CR0_TS|CR0_EM);
+f0103605:	83 e0 f3             	and    $0xfffffff3,%eax
+f0103608:	0d 23 00 05 80       	or     $0x80050023,%eax
+	asm volatile("movl %0,%%cr0" : : "r" (val));
+f010360d:	0f 22 c0             	mov    %eax,%cr0
+	uintptr_t va;
+	int i;
+
+	// check that we can read and write installed pages
+	pp1 = pp2 = 0;
+	assert((pp0 = page_alloc(0)));
+f0103610:	83 ec 0c             	sub    $0xc,%esp
+f0103613:	6a 00                	push   $0x0
+f0103615:	e8 58 e2 ff ff       	call   f0101872 <page_alloc>
+f010361a:	89 c3                	mov    %eax,%ebx
+f010361c:	83 c4 10             	add    $0x10,%esp
+f010361f:	85 c0                	test   %eax,%eax
+f0103621:	0f 84 12 02 00 00    	je     f0103839 <mem_init+0x1b88>
+	assert((pp1 = page_alloc(0)));
+f0103627:	83 ec 0c             	sub    $0xc,%esp
+f010362a:	6a 00                	push   $0x0
+f010362c:	e8 41 e2 ff ff       	call   f0101872 <page_alloc>
+f0103631:	89 c7                	mov    %eax,%edi
+f0103633:	83 c4 10             	add    $0x10,%esp
+f0103636:	85 c0                	test   %eax,%eax
+f0103638:	0f 84 14 02 00 00    	je     f0103852 <mem_init+0x1ba1>
+	assert((pp2 = page_alloc(0)));
+f010363e:	83 ec 0c             	sub    $0xc,%esp
+f0103641:	6a 00                	push   $0x0
+f0103643:	e8 2a e2 ff ff       	call   f0101872 <page_alloc>
+f0103648:	89 c6                	mov    %eax,%esi
+f010364a:	83 c4 10             	add    $0x10,%esp
+f010364d:	85 c0                	test   %eax,%eax
+f010364f:	0f 84 16 02 00 00    	je     f010386b <mem_init+0x1bba>
+	page_free(pp0);
+f0103655:	83 ec 0c             	sub    $0xc,%esp
+f0103658:	53                   	push   %ebx
+f0103659:	e8 86 e2 ff ff       	call   f01018e4 <page_free>
+	return (pp - pool.pages) << PGSHIFT;
+f010365e:	89 f8                	mov    %edi,%eax
+f0103660:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f0103666:	c1 f8 02             	sar    $0x2,%eax
+f0103669:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010366f:	89 c2                	mov    %eax,%edx
+f0103671:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0103674:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103679:	83 c4 10             	add    $0x10,%esp
+f010367c:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f0103682:	0f 83 fc 01 00 00    	jae    f0103884 <mem_init+0x1bd3>
+	memset(page2kva(pp1), 1, PGSIZE);
+f0103688:	83 ec 04             	sub    $0x4,%esp
+f010368b:	68 00 10 00 00       	push   $0x1000
+f0103690:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f0103692:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0103698:	52                   	push   %edx
+f0103699:	e8 68 37 00 00       	call   f0106e06 <memset>
+	return (pp - pool.pages) << PGSHIFT;
+f010369e:	89 f0                	mov    %esi,%eax
+f01036a0:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f01036a6:	c1 f8 02             	sar    $0x2,%eax
+f01036a9:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01036af:	89 c2                	mov    %eax,%edx
+f01036b1:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01036b4:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01036b9:	83 c4 10             	add    $0x10,%esp
+f01036bc:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f01036c2:	0f 83 ce 01 00 00    	jae    f0103896 <mem_init+0x1be5>
+	memset(page2kva(pp2), 2, PGSIZE);
+f01036c8:	83 ec 04             	sub    $0x4,%esp
+f01036cb:	68 00 10 00 00       	push   $0x1000
+f01036d0:	6a 02                	push   $0x2
+	return (void *)(pa + KERNBASE);
+f01036d2:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01036d8:	52                   	push   %edx
+f01036d9:	e8 28 37 00 00       	call   f0106e06 <memset>
+	page_insert(kern_pgdir, pp1, (void*) PGSIZE, PTE_W);
+f01036de:	6a 02                	push   $0x2
+f01036e0:	68 00 10 00 00       	push   $0x1000
+f01036e5:	57                   	push   %edi
+f01036e6:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f01036ec:	e8 e9 e4 ff ff       	call   f0101bda <page_insert>
+	assert(pp1->pp_ref == 1);
+f01036f1:	83 c4 20             	add    $0x20,%esp
+f01036f4:	66 83 7f 08 01       	cmpw   $0x1,0x8(%edi)
+f01036f9:	0f 85 a9 01 00 00    	jne    f01038a8 <mem_init+0x1bf7>
+	assert(*(uint32_t *)PGSIZE == 0x01010101U);
+f01036ff:	81 3d 00 10 00 00 01 	cmpl   $0x1010101,0x1000
+f0103706:	01 01 01 
+f0103709:	0f 85 b2 01 00 00    	jne    f01038c1 <mem_init+0x1c10>
+	page_insert(kern_pgdir, pp2, (void*) PGSIZE, PTE_W);
+f010370f:	6a 02                	push   $0x2
+f0103711:	68 00 10 00 00       	push   $0x1000
+f0103716:	56                   	push   %esi
+f0103717:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f010371d:	e8 b8 e4 ff ff       	call   f0101bda <page_insert>
+	assert(*(uint32_t *)PGSIZE == 0x02020202U);
+f0103722:	83 c4 10             	add    $0x10,%esp
+f0103725:	81 3d 00 10 00 00 02 	cmpl   $0x2020202,0x1000
+f010372c:	02 02 02 
+f010372f:	0f 85 a5 01 00 00    	jne    f01038da <mem_init+0x1c29>
+	assert(pp2->pp_ref == 1);
+f0103735:	66 83 7e 08 01       	cmpw   $0x1,0x8(%esi)
+f010373a:	0f 85 b3 01 00 00    	jne    f01038f3 <mem_init+0x1c42>
+	assert(pp1->pp_ref == 0);
+f0103740:	66 83 7f 08 00       	cmpw   $0x0,0x8(%edi)
+f0103745:	0f 85 c1 01 00 00    	jne    f010390c <mem_init+0x1c5b>
+	*(uint32_t *)PGSIZE = 0x03030303U;
+f010374b:	c7 05 00 10 00 00 03 	movl   $0x3030303,0x1000
+f0103752:	03 03 03 
+	return (pp - pool.pages) << PGSHIFT;
+f0103755:	89 f0                	mov    %esi,%eax
+f0103757:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f010375d:	c1 f8 02             	sar    $0x2,%eax
+f0103760:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103766:	89 c2                	mov    %eax,%edx
+f0103768:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010376b:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103770:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f0103776:	0f 83 a9 01 00 00    	jae    f0103925 <mem_init+0x1c74>
+	assert(*(uint32_t *)page2kva(pp2) == 0x03030303U);
+f010377c:	81 ba 00 00 00 f0 03 	cmpl   $0x3030303,-0x10000000(%edx)
+f0103783:	03 03 03 
+f0103786:	0f 85 ab 01 00 00    	jne    f0103937 <mem_init+0x1c86>
+	page_remove(kern_pgdir, (void*) PGSIZE);
+f010378c:	83 ec 08             	sub    $0x8,%esp
+f010378f:	68 00 10 00 00       	push   $0x1000
+f0103794:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f010379a:	e8 f5 e3 ff ff       	call   f0101b94 <page_remove>
+	assert(pp2->pp_ref == 0);
+f010379f:	83 c4 10             	add    $0x10,%esp
+f01037a2:	66 83 7e 08 00       	cmpw   $0x0,0x8(%esi)
+f01037a7:	0f 85 a3 01 00 00    	jne    f0103950 <mem_init+0x1c9f>
+
+	// forcibly take pp0 back
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f01037ad:	8b 0d a8 c2 7f f0    	mov    0xf07fc2a8,%ecx
+f01037b3:	8b 11                	mov    (%ecx),%edx
+f01037b5:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	return (pp - pool.pages) << PGSHIFT;
+f01037bb:	89 d8                	mov    %ebx,%eax
+f01037bd:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f01037c3:	c1 f8 02             	sar    $0x2,%eax
+f01037c6:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01037cc:	c1 e0 0c             	shl    $0xc,%eax
+f01037cf:	39 c2                	cmp    %eax,%edx
+f01037d1:	0f 85 92 01 00 00    	jne    f0103969 <mem_init+0x1cb8>
+	kern_pgdir[0] = 0;
+f01037d7:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	assert(pp0->pp_ref == 1);
+f01037dd:	66 83 7b 08 01       	cmpw   $0x1,0x8(%ebx)
+f01037e2:	0f 85 9a 01 00 00    	jne    f0103982 <mem_init+0x1cd1>
+	pp0->pp_ref = 0;
+f01037e8:	66 c7 43 08 00 00    	movw   $0x0,0x8(%ebx)
+
+	// free the pages we took
+	page_free(pp0);
+f01037ee:	83 ec 0c             	sub    $0xc,%esp
+f01037f1:	53                   	push   %ebx
+f01037f2:	e8 ed e0 ff ff       	call   f01018e4 <page_free>
+
+	cprintf("check_page_installed_pgdir() succeeded!\n");
+f01037f7:	c7 04 24 c4 b9 10 f0 	movl   $0xf010b9c4,(%esp)
+f01037fe:	e8 de 0b 00 00       	call   f01043e1 <cprintf>
+}
+f0103803:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103806:	5b                   	pop    %ebx
+f0103807:	5e                   	pop    %esi
+f0103808:	5f                   	pop    %edi
+f0103809:	5d                   	pop    %ebp
+f010380a:	c3                   	ret
+	assert(rcr4() & CR4_PSE);
+f010380b:	68 14 aa 10 f0       	push   $0xf010aa14
+f0103810:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103815:	68 e7 00 00 00       	push   $0xe7
+f010381a:	68 25 ba 10 f0       	push   $0xf010ba25
+f010381f:	e8 25 c8 ff ff       	call   f0100049 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103824:	50                   	push   %eax
+f0103825:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f010382a:	68 f0 00 00 00       	push   $0xf0
+f010382f:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103834:	e8 10 c8 ff ff       	call   f0100049 <_panic>
+	assert((pp0 = page_alloc(0)));
+f0103839:	68 79 bb 10 f0       	push   $0xf010bb79
+f010383e:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103843:	68 2b 05 00 00       	push   $0x52b
+f0103848:	68 25 ba 10 f0       	push   $0xf010ba25
+f010384d:	e8 f7 c7 ff ff       	call   f0100049 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0103852:	68 8f bb 10 f0       	push   $0xf010bb8f
+f0103857:	68 25 aa 10 f0       	push   $0xf010aa25
+f010385c:	68 2c 05 00 00       	push   $0x52c
+f0103861:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103866:	e8 de c7 ff ff       	call   f0100049 <_panic>
+	assert((pp2 = page_alloc(0)));
+f010386b:	68 a5 bb 10 f0       	push   $0xf010bba5
+f0103870:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103875:	68 2d 05 00 00       	push   $0x52d
+f010387a:	68 25 ba 10 f0       	push   $0xf010ba25
+f010387f:	e8 c5 c7 ff ff       	call   f0100049 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103884:	52                   	push   %edx
+f0103885:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f010388a:	6a 5f                	push   $0x5f
+f010388c:	68 31 ba 10 f0       	push   $0xf010ba31
+f0103891:	e8 b3 c7 ff ff       	call   f0100049 <_panic>
+f0103896:	52                   	push   %edx
+f0103897:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f010389c:	6a 5f                	push   $0x5f
+f010389e:	68 31 ba 10 f0       	push   $0xf010ba31
+f01038a3:	e8 a1 c7 ff ff       	call   f0100049 <_panic>
+	assert(pp1->pp_ref == 1);
+f01038a8:	68 76 bc 10 f0       	push   $0xf010bc76
+f01038ad:	68 25 aa 10 f0       	push   $0xf010aa25
+f01038b2:	68 32 05 00 00       	push   $0x532
+f01038b7:	68 25 ba 10 f0       	push   $0xf010ba25
+f01038bc:	e8 88 c7 ff ff       	call   f0100049 <_panic>
+	assert(*(uint32_t *)PGSIZE == 0x01010101U);
+f01038c1:	68 50 b9 10 f0       	push   $0xf010b950
+f01038c6:	68 25 aa 10 f0       	push   $0xf010aa25
+f01038cb:	68 33 05 00 00       	push   $0x533
+f01038d0:	68 25 ba 10 f0       	push   $0xf010ba25
+f01038d5:	e8 6f c7 ff ff       	call   f0100049 <_panic>
+	assert(*(uint32_t *)PGSIZE == 0x02020202U);
+f01038da:	68 74 b9 10 f0       	push   $0xf010b974
+f01038df:	68 25 aa 10 f0       	push   $0xf010aa25
+f01038e4:	68 35 05 00 00       	push   $0x535
+f01038e9:	68 25 ba 10 f0       	push   $0xf010ba25
+f01038ee:	e8 56 c7 ff ff       	call   f0100049 <_panic>
+	assert(pp2->pp_ref == 1);
+f01038f3:	68 98 bc 10 f0       	push   $0xf010bc98
+f01038f8:	68 25 aa 10 f0       	push   $0xf010aa25
+f01038fd:	68 36 05 00 00       	push   $0x536
+f0103902:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103907:	e8 3d c7 ff ff       	call   f0100049 <_panic>
+	assert(pp1->pp_ref == 0);
+f010390c:	68 02 bd 10 f0       	push   $0xf010bd02
+f0103911:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103916:	68 37 05 00 00       	push   $0x537
+f010391b:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103920:	e8 24 c7 ff ff       	call   f0100049 <_panic>
+f0103925:	52                   	push   %edx
+f0103926:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f010392b:	6a 5f                	push   $0x5f
+f010392d:	68 31 ba 10 f0       	push   $0xf010ba31
+f0103932:	e8 12 c7 ff ff       	call   f0100049 <_panic>
+	assert(*(uint32_t *)page2kva(pp2) == 0x03030303U);
+f0103937:	68 98 b9 10 f0       	push   $0xf010b998
+f010393c:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103941:	68 39 05 00 00       	push   $0x539
+f0103946:	68 25 ba 10 f0       	push   $0xf010ba25
+f010394b:	e8 f9 c6 ff ff       	call   f0100049 <_panic>
+	assert(pp2->pp_ref == 0);
+f0103950:	68 d0 bc 10 f0       	push   $0xf010bcd0
+f0103955:	68 25 aa 10 f0       	push   $0xf010aa25
+f010395a:	68 3b 05 00 00       	push   $0x53b
+f010395f:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103964:	e8 e0 c6 ff ff       	call   f0100049 <_panic>
+	assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0103969:	68 1c b3 10 f0       	push   $0xf010b31c
+f010396e:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103973:	68 3e 05 00 00       	push   $0x53e
+f0103978:	68 25 ba 10 f0       	push   $0xf010ba25
+f010397d:	e8 c7 c6 ff ff       	call   f0100049 <_panic>
+	assert(pp0->pp_ref == 1);
+f0103982:	68 87 bc 10 f0       	push   $0xf010bc87
+f0103987:	68 25 aa 10 f0       	push   $0xf010aa25
+f010398c:	68 40 05 00 00       	push   $0x540
+f0103991:	68 25 ba 10 f0       	push   $0xf010ba25
+f0103996:	e8 ae c6 ff ff       	call   f0100049 <_panic>
+
+f010399b <user_mem_check>:
+{
+f010399b:	55                   	push   %ebp
+f010399c:	89 e5                	mov    %esp,%ebp
+f010399e:	57                   	push   %edi
+f010399f:	56                   	push   %esi
+f01039a0:	53                   	push   %ebx
+f01039a1:	83 ec 0c             	sub    $0xc,%esp
+f01039a4:	8b 55 10             	mov    0x10(%ebp),%edx
+	uintptr_t base = ROUNDDOWN((uintptr_t) va, PGSIZE);
+f01039a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01039aa:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (base >= ULIM)
+f01039b0:	81 fb ff ff 7f ef    	cmp    $0xef7fffff,%ebx
+f01039b6:	77 50                	ja     f0103a08 <user_mem_check+0x6d>
+	else if (len <= ULIM - (uintptr_t) va)
+f01039b8:	b8 00 00 80 ef       	mov    $0xef800000,%eax
+f01039bd:	2b 45 0c             	sub    0xc(%ebp),%eax
+		top = (uintptr_t) va + len;
+f01039c0:	89 d7                	mov    %edx,%edi
+f01039c2:	03 7d 0c             	add    0xc(%ebp),%edi
+f01039c5:	39 d0                	cmp    %edx,%eax
+f01039c7:	b8 00 00 80 ef       	mov    $0xef800000,%eax
+f01039cc:	0f 42 f8             	cmovb  %eax,%edi
+	perm |= PTE_P;
+f01039cf:	8b 75 14             	mov    0x14(%ebp),%esi
+f01039d2:	83 ce 01             	or     $0x1,%esi
+	while (base < top) {
+f01039d5:	39 fb                	cmp    %edi,%ebx
+f01039d7:	73 28                	jae    f0103a01 <user_mem_check+0x66>
+		pte = pgdir_walk(env->env_pgdir, (void *) base, false);
+f01039d9:	83 ec 04             	sub    $0x4,%esp
+f01039dc:	6a 00                	push   $0x0
+f01039de:	53                   	push   %ebx
+f01039df:	8b 45 08             	mov    0x8(%ebp),%eax
+f01039e2:	ff 70 60             	push   0x60(%eax)
+f01039e5:	e8 78 df ff ff       	call   f0101962 <pgdir_walk>
+		if (!pte || (*pte & perm) != perm)
+f01039ea:	83 c4 10             	add    $0x10,%esp
+f01039ed:	85 c0                	test   %eax,%eax
+f01039ef:	74 17                	je     f0103a08 <user_mem_check+0x6d>
+f01039f1:	89 f1                	mov    %esi,%ecx
+f01039f3:	23 08                	and    (%eax),%ecx
+f01039f5:	39 ce                	cmp    %ecx,%esi
+f01039f7:	75 0f                	jne    f0103a08 <user_mem_check+0x6d>
+		base += PGSIZE;
+f01039f9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01039ff:	eb d4                	jmp    f01039d5 <user_mem_check+0x3a>
+	return 0;
+f0103a01:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103a06:	eb 13                	jmp    f0103a1b <user_mem_check+0x80>
+	user_mem_check_addr = MAX((uintptr_t) va, base);
+f0103a08:	39 5d 0c             	cmp    %ebx,0xc(%ebp)
+f0103a0b:	89 d8                	mov    %ebx,%eax
+f0103a0d:	0f 43 45 0c          	cmovae 0xc(%ebp),%eax
+f0103a11:	a3 fc c2 7f f0       	mov    %eax,0xf07fc2fc
+	return -E_FAULT;
+f0103a16:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+f0103a1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103a1e:	5b                   	pop    %ebx
+f0103a1f:	5e                   	pop    %esi
+f0103a20:	5f                   	pop    %edi
+f0103a21:	5d                   	pop    %ebp
+f0103a22:	c3                   	ret
+
+f0103a23 <user_mem_assert>:
+{
+f0103a23:	55                   	push   %ebp
+f0103a24:	89 e5                	mov    %esp,%ebp
+f0103a26:	53                   	push   %ebx
+f0103a27:	83 ec 04             	sub    $0x4,%esp
+f0103a2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (user_mem_check(env, va, len, perm | PTE_U) < 0) {
+f0103a2d:	8b 45 14             	mov    0x14(%ebp),%eax
+f0103a30:	83 c8 04             	or     $0x4,%eax
+f0103a33:	50                   	push   %eax
+f0103a34:	ff 75 10             	push   0x10(%ebp)
+f0103a37:	ff 75 0c             	push   0xc(%ebp)
+f0103a3a:	53                   	push   %ebx
+f0103a3b:	e8 5b ff ff ff       	call   f010399b <user_mem_check>
+f0103a40:	83 c4 10             	add    $0x10,%esp
+f0103a43:	85 c0                	test   %eax,%eax
+f0103a45:	78 05                	js     f0103a4c <user_mem_assert+0x29>
+}
+f0103a47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103a4a:	c9                   	leave
+f0103a4b:	c3                   	ret
+		cprintf("[%08x] user_mem_check assertion failure for "
+f0103a4c:	83 ec 04             	sub    $0x4,%esp
+f0103a4f:	ff 35 fc c2 7f f0    	push   0xf07fc2fc
+f0103a55:	ff 73 48             	push   0x48(%ebx)
+f0103a58:	68 f0 b9 10 f0       	push   $0xf010b9f0
+f0103a5d:	e8 7f 09 00 00       	call   f01043e1 <cprintf>
+		env_destroy(env);	// may not return
+f0103a62:	89 1c 24             	mov    %ebx,(%esp)
+f0103a65:	e8 95 06 00 00       	call   f01040ff <env_destroy>
+f0103a6a:	83 c4 10             	add    $0x10,%esp
+}
+f0103a6d:	eb d8                	jmp    f0103a47 <user_mem_assert+0x24>
+
+f0103a6f <region_alloc>:
+// Pages should be writable by user and kernel.
+// Panic if any allocation attempt fails.
+//
+static void
+region_alloc(struct Env *e, void *va, size_t len)
+{
+f0103a6f:	55                   	push   %ebp
+f0103a70:	89 e5                	mov    %esp,%ebp
+f0103a72:	57                   	push   %edi
+f0103a73:	56                   	push   %esi
+f0103a74:	53                   	push   %ebx
+f0103a75:	83 ec 0c             	sub    $0xc,%esp
+f0103a78:	89 c7                	mov    %eax,%edi
+f0103a7a:	89 d0                	mov    %edx,%eax
+	//
+	// Hint: It is easier to use region_alloc if the caller can pass
+	//   'va' and 'len' values that are not page-aligned.
+	//   You should round va down, and round (va + len) up.
+	//   (Watch out for corner-cases!)
+	uintptr_t base = ROUNDDOWN((uintptr_t) va, PGSIZE);
+f0103a7c:	89 d3                	mov    %edx,%ebx
+f0103a7e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+	assert(len <= UTOP - (uintptr_t) va);
+f0103a84:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+f0103a89:	29 c2                	sub    %eax,%edx
+f0103a8b:	39 ca                	cmp    %ecx,%edx
+f0103a8d:	72 41                	jb     f0103ad0 <region_alloc+0x61>
+	len = ROUNDUP(len + (uintptr_t) va - base, PGSIZE);
+f0103a8f:	8d b4 08 ff 0f 00 00 	lea    0xfff(%eax,%ecx,1),%esi
+f0103a96:	29 de                	sub    %ebx,%esi
+f0103a98:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f0103a9e:	01 de                	add    %ebx,%esi
+	for ( ; len > 0; len -= PGSIZE) {
+f0103aa0:	39 f3                	cmp    %esi,%ebx
+f0103aa2:	74 77                	je     f0103b1b <region_alloc+0xac>
+		struct PageInfo *p;
+		int r;
+
+		p = page_alloc(0);
+f0103aa4:	83 ec 0c             	sub    $0xc,%esp
+f0103aa7:	6a 00                	push   $0x0
+f0103aa9:	e8 c4 dd ff ff       	call   f0101872 <page_alloc>
+		assert(p != NULL);
+f0103aae:	83 c4 10             	add    $0x10,%esp
+f0103ab1:	85 c0                	test   %eax,%eax
+f0103ab3:	74 34                	je     f0103ae9 <region_alloc+0x7a>
+		r = page_insert(e->env_pgdir, p, (void *) base, PTE_U | PTE_W);
+f0103ab5:	6a 06                	push   $0x6
+f0103ab7:	53                   	push   %ebx
+f0103ab8:	50                   	push   %eax
+f0103ab9:	ff 77 60             	push   0x60(%edi)
+f0103abc:	e8 19 e1 ff ff       	call   f0101bda <page_insert>
+		assert(r == 0);
+f0103ac1:	83 c4 10             	add    $0x10,%esp
+f0103ac4:	85 c0                	test   %eax,%eax
+f0103ac6:	75 3a                	jne    f0103b02 <region_alloc+0x93>
+		base += PGSIZE;
+f0103ac8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+	for ( ; len > 0; len -= PGSIZE) {
+f0103ace:	eb d0                	jmp    f0103aa0 <region_alloc+0x31>
+	assert(len <= UTOP - (uintptr_t) va);
+f0103ad0:	68 9d bd 10 f0       	push   $0xf010bd9d
+f0103ad5:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103ada:	68 2a 01 00 00       	push   $0x12a
+f0103adf:	68 ba bd 10 f0       	push   $0xf010bdba
+f0103ae4:	e8 60 c5 ff ff       	call   f0100049 <_panic>
+		assert(p != NULL);
+f0103ae9:	68 c5 bd 10 f0       	push   $0xf010bdc5
+f0103aee:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103af3:	68 31 01 00 00       	push   $0x131
+f0103af8:	68 ba bd 10 f0       	push   $0xf010bdba
+f0103afd:	e8 47 c5 ff ff       	call   f0100049 <_panic>
+		assert(r == 0);
+f0103b02:	68 57 bb 10 f0       	push   $0xf010bb57
+f0103b07:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103b0c:	68 33 01 00 00       	push   $0x133
+f0103b11:	68 ba bd 10 f0       	push   $0xf010bdba
+f0103b16:	e8 2e c5 ff ff       	call   f0100049 <_panic>
+	}
+
+}
+f0103b1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103b1e:	5b                   	pop    %ebx
+f0103b1f:	5e                   	pop    %esi
+f0103b20:	5f                   	pop    %edi
+f0103b21:	5d                   	pop    %ebp
+f0103b22:	c3                   	ret
+
+f0103b23 <envid2env>:
+{
+f0103b23:	55                   	push   %ebp
+f0103b24:	89 e5                	mov    %esp,%ebp
+f0103b26:	56                   	push   %esi
+f0103b27:	53                   	push   %ebx
+f0103b28:	8b 75 08             	mov    0x8(%ebp),%esi
+f0103b2b:	8b 45 10             	mov    0x10(%ebp),%eax
+	if (envid == 0) {
+f0103b2e:	85 f6                	test   %esi,%esi
+f0103b30:	74 31                	je     f0103b63 <envid2env+0x40>
+	e = &envs[ENVX(envid)];
+f0103b32:	89 f3                	mov    %esi,%ebx
+f0103b34:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+f0103b3a:	69 db 8c 00 00 00    	imul   $0x8c,%ebx,%ebx
+f0103b40:	03 1d 04 c3 7f f0    	add    0xf07fc304,%ebx
+	if (e->env_status == ENV_FREE || e->env_id != envid) {
+f0103b46:	83 7b 54 00          	cmpl   $0x0,0x54(%ebx)
+f0103b4a:	74 5b                	je     f0103ba7 <envid2env+0x84>
+f0103b4c:	39 73 48             	cmp    %esi,0x48(%ebx)
+f0103b4f:	75 62                	jne    f0103bb3 <envid2env+0x90>
+	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id) {
+f0103b51:	84 c0                	test   %al,%al
+f0103b53:	75 20                	jne    f0103b75 <envid2env+0x52>
+	return 0;
+f0103b55:	b8 00 00 00 00       	mov    $0x0,%eax
+		*env_store = curenv;
+f0103b5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0103b5d:	89 1a                	mov    %ebx,(%edx)
+}
+f0103b5f:	5b                   	pop    %ebx
+f0103b60:	5e                   	pop    %esi
+f0103b61:	5d                   	pop    %ebp
+f0103b62:	c3                   	ret
+		*env_store = curenv;
+f0103b63:	e8 8b 38 00 00       	call   f01073f3 <cpunum>
+f0103b68:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103b6b:	8b 98 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%ebx
+		return 0;
+f0103b71:	89 f0                	mov    %esi,%eax
+f0103b73:	eb e5                	jmp    f0103b5a <envid2env+0x37>
+	if (checkperm && e != curenv && e->env_parent_id != curenv->env_id) {
+f0103b75:	e8 79 38 00 00       	call   f01073f3 <cpunum>
+f0103b7a:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103b7d:	39 98 28 d0 83 f0    	cmp    %ebx,-0xf7c2fd8(%eax)
+f0103b83:	74 d0                	je     f0103b55 <envid2env+0x32>
+f0103b85:	8b 73 4c             	mov    0x4c(%ebx),%esi
+f0103b88:	e8 66 38 00 00       	call   f01073f3 <cpunum>
+f0103b8d:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103b90:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0103b96:	3b 70 48             	cmp    0x48(%eax),%esi
+f0103b99:	74 ba                	je     f0103b55 <envid2env+0x32>
+f0103b9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		return -E_BAD_ENV;
+f0103ba0:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103ba5:	eb b3                	jmp    f0103b5a <envid2env+0x37>
+f0103ba7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		return -E_BAD_ENV;
+f0103bac:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103bb1:	eb a7                	jmp    f0103b5a <envid2env+0x37>
+f0103bb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0103bb8:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103bbd:	eb 9b                	jmp    f0103b5a <envid2env+0x37>
+
+f0103bbf <env_init_percpu>:
+	asm volatile("lgdt (%0)" : : "r" (p));
+f0103bbf:	b8 20 63 11 f0       	mov    $0xf0116320,%eax
+f0103bc4:	0f 01 10             	lgdtl  (%eax)
+	asm volatile("movw %%ax,%%gs" : : "a" (GD_UD|3));
+f0103bc7:	b8 23 00 00 00       	mov    $0x23,%eax
+f0103bcc:	8e e8                	mov    %eax,%gs
+	asm volatile("movw %%ax,%%fs" : : "a" (GD_UD|3));
+f0103bce:	8e e0                	mov    %eax,%fs
+	asm volatile("movw %%ax,%%es" : : "a" (GD_KD));
+f0103bd0:	b8 10 00 00 00       	mov    $0x10,%eax
+f0103bd5:	8e c0                	mov    %eax,%es
+	asm volatile("movw %%ax,%%ds" : : "a" (GD_KD));
+f0103bd7:	8e d8                	mov    %eax,%ds
+	asm volatile("movw %%ax,%%ss" : : "a" (GD_KD));
+f0103bd9:	8e d0                	mov    %eax,%ss
+	asm volatile("ljmp %0,$1f\n 1:\n" : : "i" (GD_KT));
+f0103bdb:	ea e2 3b 10 f0 08 00 	ljmp   $0x8,$0xf0103be2
+	asm volatile("lldt %0" : : "r" (sel));
+f0103be2:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103be7:	0f 00 d0             	lldt   %ax
+}
+f0103bea:	c3                   	ret
+
+f0103beb <env_init>:
+{
+f0103beb:	55                   	push   %ebp
+f0103bec:	89 e5                	mov    %esp,%ebp
+f0103bee:	56                   	push   %esi
+f0103bef:	53                   	push   %ebx
+	for (struct Env *e = &envs[NENV - 1]; e >= envs; e--) {
+f0103bf0:	8b 0d 04 c3 7f f0    	mov    0xf07fc304,%ecx
+f0103bf6:	8d 81 74 2f 02 00    	lea    0x22f74(%ecx),%eax
+f0103bfc:	8b 15 08 c3 7f f0    	mov    0xf07fc308,%edx
+f0103c02:	81 e9 8c 00 00 00    	sub    $0x8c,%ecx
+f0103c08:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0103c0d:	be 01 00 00 00       	mov    $0x1,%esi
+f0103c12:	eb 1b                	jmp    f0103c2f <env_init+0x44>
+		e->env_status = ENV_FREE;
+f0103c14:	c7 40 54 00 00 00 00 	movl   $0x0,0x54(%eax)
+		e->env_id = 0;
+f0103c1b:	c7 40 48 00 00 00 00 	movl   $0x0,0x48(%eax)
+		e->env_link = env_free_list;
+f0103c22:	89 50 44             	mov    %edx,0x44(%eax)
+		env_free_list = e;
+f0103c25:	89 c2                	mov    %eax,%edx
+	for (struct Env *e = &envs[NENV - 1]; e >= envs; e--) {
+f0103c27:	8d 80 74 ff ff ff    	lea    -0x8c(%eax),%eax
+f0103c2d:	89 f3                	mov    %esi,%ebx
+f0103c2f:	39 c8                	cmp    %ecx,%eax
+f0103c31:	75 e1                	jne    f0103c14 <env_init+0x29>
+f0103c33:	84 db                	test   %bl,%bl
+f0103c35:	74 06                	je     f0103c3d <env_init+0x52>
+f0103c37:	89 15 08 c3 7f f0    	mov    %edx,0xf07fc308
+	env_init_percpu();
+f0103c3d:	e8 7d ff ff ff       	call   f0103bbf <env_init_percpu>
+}
+f0103c42:	5b                   	pop    %ebx
+f0103c43:	5e                   	pop    %esi
+f0103c44:	5d                   	pop    %ebp
+f0103c45:	c3                   	ret
+
+f0103c46 <env_alloc>:
+{
+f0103c46:	55                   	push   %ebp
+f0103c47:	89 e5                	mov    %esp,%ebp
+f0103c49:	53                   	push   %ebx
+f0103c4a:	83 ec 04             	sub    $0x4,%esp
+	if (!(e = env_free_list))
+f0103c4d:	8b 1d 08 c3 7f f0    	mov    0xf07fc308,%ebx
+f0103c53:	85 db                	test   %ebx,%ebx
+f0103c55:	0f 84 5c 01 00 00    	je     f0103db7 <env_alloc+0x171>
+	if (!(p = page_alloc(ALLOC_ZERO)))
+f0103c5b:	83 ec 0c             	sub    $0xc,%esp
+f0103c5e:	6a 01                	push   $0x1
+f0103c60:	e8 0d dc ff ff       	call   f0101872 <page_alloc>
+f0103c65:	83 c4 10             	add    $0x10,%esp
+f0103c68:	85 c0                	test   %eax,%eax
+f0103c6a:	0f 84 4e 01 00 00    	je     f0103dbe <env_alloc+0x178>
+	p->pp_ref++;
+f0103c70:	66 83 40 08 01       	addw   $0x1,0x8(%eax)
+	return (pp - pool.pages) << PGSHIFT;
+f0103c75:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f0103c7b:	c1 f8 02             	sar    $0x2,%eax
+f0103c7e:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0103c84:	89 c2                	mov    %eax,%edx
+f0103c86:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0103c89:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103c8e:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f0103c94:	0f 83 f6 00 00 00    	jae    f0103d90 <env_alloc+0x14a>
+	return (void *)(pa + KERNBASE);
+f0103c9a:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+	e->env_pgdir = page2kva(p);
+f0103ca0:	89 43 60             	mov    %eax,0x60(%ebx)
+	memcpy(e->env_pgdir, kern_pgdir, PGSIZE);
+f0103ca3:	83 ec 04             	sub    $0x4,%esp
+f0103ca6:	68 00 10 00 00       	push   $0x1000
+f0103cab:	ff 35 a8 c2 7f f0    	push   0xf07fc2a8
+f0103cb1:	50                   	push   %eax
+f0103cb2:	e8 e6 31 00 00       	call   f0106e9d <memcpy>
+	e->env_pgdir[PDX(UVPT)] = PADDR(e->env_pgdir) | PTE_P | PTE_U;
+f0103cb7:	8b 43 60             	mov    0x60(%ebx),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103cba:	83 c4 10             	add    $0x10,%esp
+f0103cbd:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103cc2:	0f 86 da 00 00 00    	jbe    f0103da2 <env_alloc+0x15c>
+	return (physaddr_t)kva - KERNBASE;
+f0103cc8:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f0103cce:	83 ca 05             	or     $0x5,%edx
+f0103cd1:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+	generation = (e->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
+f0103cd7:	8b 43 48             	mov    0x48(%ebx),%eax
+f0103cda:	05 00 10 00 00       	add    $0x1000,%eax
+		generation = 1 << ENVGENSHIFT;
+f0103cdf:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+f0103ce4:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0103ce9:	0f 4e c2             	cmovle %edx,%eax
+	e->env_id = generation | (e - envs);
+f0103cec:	89 da                	mov    %ebx,%edx
+f0103cee:	2b 15 04 c3 7f f0    	sub    0xf07fc304,%edx
+f0103cf4:	c1 fa 02             	sar    $0x2,%edx
+f0103cf7:	69 d2 8b af f8 8a    	imul   $0x8af8af8b,%edx,%edx
+f0103cfd:	09 d0                	or     %edx,%eax
+f0103cff:	89 43 48             	mov    %eax,0x48(%ebx)
+	e->env_parent_id = parent_id;
+f0103d02:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103d05:	89 43 4c             	mov    %eax,0x4c(%ebx)
+	e->env_type = ENV_TYPE_USER;
+f0103d08:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+	e->env_status = ENV_RUNNABLE;
+f0103d0f:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+	e->env_runs = 0;
+f0103d16:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+	memset(&e->env_tf, 0, sizeof(e->env_tf));
+f0103d1d:	83 ec 04             	sub    $0x4,%esp
+f0103d20:	6a 44                	push   $0x44
+f0103d22:	6a 00                	push   $0x0
+f0103d24:	53                   	push   %ebx
+f0103d25:	e8 dc 30 00 00       	call   f0106e06 <memset>
+	e->env_tf.tf_ds = GD_UD | 3;
+f0103d2a:	66 c7 43 24 23 00    	movw   $0x23,0x24(%ebx)
+	e->env_tf.tf_es = GD_UD | 3;
+f0103d30:	66 c7 43 20 23 00    	movw   $0x23,0x20(%ebx)
+	e->env_tf.tf_ss = GD_UD | 3;
+f0103d36:	66 c7 43 40 23 00    	movw   $0x23,0x40(%ebx)
+	e->env_tf.tf_esp = USTACKTOP;
+f0103d3c:	c7 43 3c 00 e0 bf ee 	movl   $0xeebfe000,0x3c(%ebx)
+	e->env_tf.tf_cs = GD_UT | 3;
+f0103d43:	66 c7 43 34 1b 00    	movw   $0x1b,0x34(%ebx)
+	e->env_tf.tf_eflags = FL_IF;
+f0103d49:	c7 43 38 00 02 00 00 	movl   $0x200,0x38(%ebx)
+	e->env_pgfault_upcall = 0;
+f0103d50:	c7 43 64 00 00 00 00 	movl   $0x0,0x64(%ebx)
+	e->env_ipc_recving = 0;
+f0103d57:	c6 43 68 00          	movb   $0x0,0x68(%ebx)
+	e->env_ipc_nowait = 0;
+f0103d5b:	c6 83 80 00 00 00 00 	movb   $0x0,0x80(%ebx)
+	e->env_ipc_deadline = 0;
+f0103d62:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+f0103d69:	00 00 00 
+	e->env_net_wait = 0;
+f0103d6c:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+f0103d73:	00 00 00 
+	env_free_list = e->env_link;
+f0103d76:	8b 43 44             	mov    0x44(%ebx),%eax
+f0103d79:	a3 08 c3 7f f0       	mov    %eax,0xf07fc308
+	*newenv_store = e;
+f0103d7e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103d81:	89 18                	mov    %ebx,(%eax)
+	return 0;
+f0103d83:	83 c4 10             	add    $0x10,%esp
+f0103d86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0103d8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103d8e:	c9                   	leave
+f0103d8f:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103d90:	52                   	push   %edx
+f0103d91:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0103d96:	6a 5f                	push   $0x5f
+f0103d98:	68 31 ba 10 f0       	push   $0xf010ba31
+f0103d9d:	e8 a7 c2 ff ff       	call   f0100049 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103da2:	50                   	push   %eax
+f0103da3:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0103da8:	68 c6 00 00 00       	push   $0xc6
+f0103dad:	68 ba bd 10 f0       	push   $0xf010bdba
+f0103db2:	e8 92 c2 ff ff       	call   f0100049 <_panic>
+		return -E_NO_FREE_ENV;
+f0103db7:	b8 fb ff ff ff       	mov    $0xfffffffb,%eax
+f0103dbc:	eb cd                	jmp    f0103d8b <env_alloc+0x145>
+		return -E_NO_MEM;
+f0103dbe:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0103dc3:	eb c6                	jmp    f0103d8b <env_alloc+0x145>
+
+f0103dc5 <env_create>:
+// before running the first user-mode environment.
+// The new env's parent ID is set to 0.
+//
+void
+env_create(uint8_t *binary, enum EnvType type)
+{
+f0103dc5:	55                   	push   %ebp
+f0103dc6:	89 e5                	mov    %esp,%ebp
+f0103dc8:	57                   	push   %edi
+f0103dc9:	56                   	push   %esi
+f0103dca:	53                   	push   %ebx
+f0103dcb:	83 ec 34             	sub    $0x34,%esp
+f0103dce:	8b 7d 08             	mov    0x8(%ebp),%edi
+	// LAB 3: Your code here.
+	struct Env *e;
+	int r;
+
+	r = env_alloc(&e, 0);
+f0103dd1:	6a 00                	push   $0x0
+f0103dd3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0103dd6:	50                   	push   %eax
+f0103dd7:	e8 6a fe ff ff       	call   f0103c46 <env_alloc>
+	assert(r == 0);
+f0103ddc:	83 c4 10             	add    $0x10,%esp
+f0103ddf:	85 c0                	test   %eax,%eax
+f0103de1:	75 33                	jne    f0103e16 <env_create+0x51>
+	load_icode(e, binary);
+f0103de3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103de6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	assert(eh->e_magic == ELF_MAGIC);
+f0103de9:	81 3f 7f 45 4c 46    	cmpl   $0x464c457f,(%edi)
+f0103def:	75 3e                	jne    f0103e2f <env_create+0x6a>
+	ph = (struct Proghdr *) (binary + eh->e_phoff);
+f0103df1:	89 fb                	mov    %edi,%ebx
+f0103df3:	03 5f 1c             	add    0x1c(%edi),%ebx
+	eph = ph + eh->e_phnum;
+f0103df6:	0f b7 77 2c          	movzwl 0x2c(%edi),%esi
+f0103dfa:	c1 e6 05             	shl    $0x5,%esi
+f0103dfd:	01 de                	add    %ebx,%esi
+	lcr3(PADDR(e->env_pgdir));
+f0103dff:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103e02:	8b 40 60             	mov    0x60(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103e05:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103e0a:	76 3c                	jbe    f0103e48 <env_create+0x83>
+	return (physaddr_t)kva - KERNBASE;
+f0103e0c:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0103e11:	0f 22 d8             	mov    %eax,%cr3
+}
+f0103e14:	eb 7c                	jmp    f0103e92 <env_create+0xcd>
+	assert(r == 0);
+f0103e16:	68 57 bb 10 f0       	push   $0xf010bb57
+f0103e1b:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103e20:	68 9b 01 00 00       	push   $0x19b
+f0103e25:	68 ba bd 10 f0       	push   $0xf010bdba
+f0103e2a:	e8 1a c2 ff ff       	call   f0100049 <_panic>
+	assert(eh->e_magic == ELF_MAGIC);
+f0103e2f:	68 cf bd 10 f0       	push   $0xf010bdcf
+f0103e34:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103e39:	68 72 01 00 00       	push   $0x172
+f0103e3e:	68 ba bd 10 f0       	push   $0xf010bdba
+f0103e43:	e8 01 c2 ff ff       	call   f0100049 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103e48:	50                   	push   %eax
+f0103e49:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0103e4e:	68 76 01 00 00       	push   $0x176
+f0103e53:	68 ba bd 10 f0       	push   $0xf010bdba
+f0103e58:	e8 ec c1 ff ff       	call   f0100049 <_panic>
+		assert(ph->p_va < UTOP);
+f0103e5d:	68 e8 bd 10 f0       	push   $0xf010bde8
+f0103e62:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103e67:	68 7a 01 00 00       	push   $0x17a
+f0103e6c:	68 ba bd 10 f0       	push   $0xf010bdba
+f0103e71:	e8 d3 c1 ff ff       	call   f0100049 <_panic>
+		assert(ph->p_memsz <= UTOP - ph->p_va);
+f0103e76:	68 04 be 10 f0       	push   $0xf010be04
+f0103e7b:	68 25 aa 10 f0       	push   $0xf010aa25
+f0103e80:	68 7b 01 00 00       	push   $0x17b
+f0103e85:	68 ba bd 10 f0       	push   $0xf010bdba
+f0103e8a:	e8 ba c1 ff ff       	call   f0100049 <_panic>
+	for ( ; ph != eph; ph++) {
+f0103e8f:	83 c3 20             	add    $0x20,%ebx
+f0103e92:	39 de                	cmp    %ebx,%esi
+f0103e94:	74 56                	je     f0103eec <env_create+0x127>
+		if (ph->p_type != ELF_PROG_LOAD)
+f0103e96:	83 3b 01             	cmpl   $0x1,(%ebx)
+f0103e99:	75 f4                	jne    f0103e8f <env_create+0xca>
+		assert(ph->p_va < UTOP);
+f0103e9b:	8b 53 08             	mov    0x8(%ebx),%edx
+f0103e9e:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f0103ea4:	77 b7                	ja     f0103e5d <env_create+0x98>
+		assert(ph->p_memsz <= UTOP - ph->p_va);
+f0103ea6:	8b 4b 14             	mov    0x14(%ebx),%ecx
+f0103ea9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+f0103eae:	29 d0                	sub    %edx,%eax
+f0103eb0:	39 c8                	cmp    %ecx,%eax
+f0103eb2:	72 c2                	jb     f0103e76 <env_create+0xb1>
+		region_alloc(e, (void *) ph->p_va, ph->p_memsz);
+f0103eb4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103eb7:	e8 b3 fb ff ff       	call   f0103a6f <region_alloc>
+		memcpy((void *) ph->p_va, binary + ph->p_offset, ph->p_filesz);
+f0103ebc:	83 ec 04             	sub    $0x4,%esp
+f0103ebf:	ff 73 10             	push   0x10(%ebx)
+f0103ec2:	89 f8                	mov    %edi,%eax
+f0103ec4:	03 43 04             	add    0x4(%ebx),%eax
+f0103ec7:	50                   	push   %eax
+f0103ec8:	ff 73 08             	push   0x8(%ebx)
+f0103ecb:	e8 cd 2f 00 00       	call   f0106e9d <memcpy>
+		       ph->p_memsz - ph->p_filesz);
+f0103ed0:	8b 43 10             	mov    0x10(%ebx),%eax
+		memset((void *) ph->p_va + ph->p_filesz, 0,
+f0103ed3:	83 c4 0c             	add    $0xc,%esp
+f0103ed6:	8b 53 14             	mov    0x14(%ebx),%edx
+f0103ed9:	29 c2                	sub    %eax,%edx
+f0103edb:	52                   	push   %edx
+f0103edc:	6a 00                	push   $0x0
+f0103ede:	03 43 08             	add    0x8(%ebx),%eax
+f0103ee1:	50                   	push   %eax
+f0103ee2:	e8 1f 2f 00 00       	call   f0106e06 <memset>
+f0103ee7:	83 c4 10             	add    $0x10,%esp
+f0103eea:	eb a3                	jmp    f0103e8f <env_create+0xca>
+	lcr3(PADDR(kern_pgdir));
+f0103eec:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103ef1:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103ef6:	76 35                	jbe    f0103f2d <env_create+0x168>
+	return (physaddr_t)kva - KERNBASE;
+f0103ef8:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0103efd:	0f 22 d8             	mov    %eax,%cr3
+	e->env_tf.tf_eip = eh->e_entry;
+f0103f00:	8b 47 18             	mov    0x18(%edi),%eax
+f0103f03:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f0103f06:	89 47 30             	mov    %eax,0x30(%edi)
+	region_alloc(e, (void *) USTACKTOP - PGSIZE, PGSIZE);
+f0103f09:	b9 00 10 00 00       	mov    $0x1000,%ecx
+f0103f0e:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+f0103f13:	89 f8                	mov    %edi,%eax
+f0103f15:	e8 55 fb ff ff       	call   f0103a6f <region_alloc>
+	e->env_type = type;
+f0103f1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103f1d:	89 47 50             	mov    %eax,0x50(%edi)
+	// [Software Developer's Manual - Volume 1]
+	// I/O privilege level field - Indicates the I/O privilege level of the
+	// currently running program or task. The current privilege level (CPL)
+	// of the currently running program or task must be less than or equal
+	// to the I/O privilege level to access the I/O address space.
+	if (type == ENV_TYPE_FS)
+f0103f20:	83 f8 01             	cmp    $0x1,%eax
+f0103f23:	74 1d                	je     f0103f42 <env_create+0x17d>
+		e->env_tf.tf_eflags |= FL_IOPL_3;
+}
+f0103f25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103f28:	5b                   	pop    %ebx
+f0103f29:	5e                   	pop    %esi
+f0103f2a:	5f                   	pop    %edi
+f0103f2b:	5d                   	pop    %ebp
+f0103f2c:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103f2d:	50                   	push   %eax
+f0103f2e:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0103f33:	68 82 01 00 00       	push   $0x182
+f0103f38:	68 ba bd 10 f0       	push   $0xf010bdba
+f0103f3d:	e8 07 c1 ff ff       	call   f0100049 <_panic>
+		e->env_tf.tf_eflags |= FL_IOPL_3;
+f0103f42:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103f45:	81 48 38 00 30 00 00 	orl    $0x3000,0x38(%eax)
+}
+f0103f4c:	eb d7                	jmp    f0103f25 <env_create+0x160>
+
+f0103f4e <env_free>:
+//
+// Frees env e and all memory it uses.
+//
+void
+env_free(struct Env *e)
+{
+f0103f4e:	55                   	push   %ebp
+f0103f4f:	89 e5                	mov    %esp,%ebp
+f0103f51:	57                   	push   %edi
+f0103f52:	56                   	push   %esi
+f0103f53:	53                   	push   %ebx
+f0103f54:	83 ec 1c             	sub    $0x1c,%esp
+f0103f57:	8b 7d 08             	mov    0x8(%ebp),%edi
+	physaddr_t pa;
+
+	// If freeing the current environment, switch to kern_pgdir
+	// before freeing the page directory, just in case the page
+	// gets reused.
+	if (e == curenv)
+f0103f5a:	e8 94 34 00 00       	call   f01073f3 <cpunum>
+f0103f5f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103f62:	39 b8 28 d0 83 f0    	cmp    %edi,-0xf7c2fd8(%eax)
+f0103f68:	74 18                	je     f0103f82 <env_free+0x34>
+		lcr3(PADDR(kern_pgdir));
+
+	// Give back the NIC's rings, if e has them.
+	net_unmap(e);
+f0103f6a:	83 ec 0c             	sub    $0xc,%esp
+f0103f6d:	57                   	push   %edi
+f0103f6e:	e8 01 46 00 00       	call   f0108574 <net_unmap>
+f0103f73:	83 c4 10             	add    $0x10,%esp
+f0103f76:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f0103f7d:	e9 a9 00 00 00       	jmp    f010402b <env_free+0xdd>
+		lcr3(PADDR(kern_pgdir));
+f0103f82:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103f87:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103f8c:	76 0a                	jbe    f0103f98 <env_free+0x4a>
+	return (physaddr_t)kva - KERNBASE;
+f0103f8e:	05 00 00 00 10       	add    $0x10000000,%eax
+f0103f93:	0f 22 d8             	mov    %eax,%cr3
+}
+f0103f96:	eb d2                	jmp    f0103f6a <env_free+0x1c>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103f98:	50                   	push   %eax
+f0103f99:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0103f9e:	68 b8 01 00 00       	push   $0x1b8
+f0103fa3:	68 ba bd 10 f0       	push   $0xf010bdba
+f0103fa8:	e8 9c c0 ff ff       	call   f0100049 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103fad:	56                   	push   %esi
+f0103fae:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0103fb3:	68 ca 01 00 00       	push   $0x1ca
+f0103fb8:	68 ba bd 10 f0       	push   $0xf010bdba
+f0103fbd:	e8 87 c0 ff ff       	call   f0100049 <_panic>
+		// find the pa and va of the page table
+		pa = PTE_ADDR(e->env_pgdir[pdeno]);
+		pt = (pte_t*) KADDR(pa);
+
+		// unmap all PTEs in this page table
+		for (pteno = 0; pteno <= PTX(~0); pteno++) {
+f0103fc2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103fc8:	83 c6 04             	add    $0x4,%esi
+f0103fcb:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+f0103fd1:	74 1b                	je     f0103fee <env_free+0xa0>
+			if (pt[pteno] & PTE_P)
+f0103fd3:	f6 06 01             	testb  $0x1,(%esi)
+f0103fd6:	74 ea                	je     f0103fc2 <env_free+0x74>
+				page_remove(e->env_pgdir, PGADDR(pdeno, pteno, 0));
+f0103fd8:	83 ec 08             	sub    $0x8,%esp
+f0103fdb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103fde:	09 d8                	or     %ebx,%eax
+f0103fe0:	50                   	push   %eax
+f0103fe1:	ff 77 60             	push   0x60(%edi)
+f0103fe4:	e8 ab db ff ff       	call   f0101b94 <page_remove>
+f0103fe9:	83 c4 10             	add    $0x10,%esp
+f0103fec:	eb d4                	jmp    f0103fc2 <env_free+0x74>
+		}
+
+		// free the page table itself
+		e->env_pgdir[pdeno] = 0;
+f0103fee:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0103ff1:	8b 47 60             	mov    0x60(%edi),%eax
+f0103ff4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0103ff7:	c7 04 08 00 00 00 00 	movl   $0x0,(%eax,%ecx,1)
+	if (PGNUM(pa) >= npages)
+f0103ffe:	3b 15 ac c2 7f f0    	cmp    0xf07fc2ac,%edx
+f0104004:	73 67                	jae    f010406d <env_free+0x11f>
+		page_decref(pa2page(pa));
+f0104006:	83 ec 0c             	sub    $0xc,%esp
+	return &pool.pages[PGNUM(pa)];
+f0104009:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f010400c:	a1 68 c2 7f f0       	mov    0xf07fc268,%eax
+f0104011:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0104014:	50                   	push   %eax
+f0104015:	e8 01 d9 ff ff       	call   f010191b <page_decref>
+f010401a:	83 c4 10             	add    $0x10,%esp
+	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+f010401d:	83 45 e0 04          	addl   $0x4,-0x20(%ebp)
+f0104021:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0104024:	3d ec 0e 00 00       	cmp    $0xeec,%eax
+f0104029:	74 56                	je     f0104081 <env_free+0x133>
+		if (!(e->env_pgdir[pdeno] & PTE_P))
+f010402b:	8b 47 60             	mov    0x60(%edi),%eax
+f010402e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0104031:	8b 04 08             	mov    (%eax,%ecx,1),%eax
+f0104034:	a8 01                	test   $0x1,%al
+f0104036:	74 e5                	je     f010401d <env_free+0xcf>
+		pa = PTE_ADDR(e->env_pgdir[pdeno]);
+f0104038:	89 c6                	mov    %eax,%esi
+f010403a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f0104040:	c1 e8 0c             	shr    $0xc,%eax
+f0104043:	89 c2                	mov    %eax,%edx
+f0104045:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f010404b:	0f 83 5c ff ff ff    	jae    f0103fad <env_free+0x5f>
+	return (void *)(pa + KERNBASE);
+f0104051:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+		for (pteno = 0; pteno <= PTX(~0); pteno++) {
+f0104057:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010405a:	c1 e0 14             	shl    $0x14,%eax
+f010405d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0104060:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104065:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f0104068:	e9 66 ff ff ff       	jmp    f0103fd3 <env_free+0x85>
+		panic("pa2page called with invalid pa");
+f010406d:	83 ec 04             	sub    $0x4,%esp
+f0104070:	68 94 b0 10 f0       	push   $0xf010b094
+f0104075:	6a 58                	push   $0x58
+f0104077:	68 31 ba 10 f0       	push   $0xf010ba31
+f010407c:	e8 c8 bf ff ff       	call   f0100049 <_panic>
+	}
+
+	// free the page directory
+	pa = PADDR(e->env_pgdir);
+f0104081:	8b 47 60             	mov    0x60(%edi),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0104084:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0104089:	76 4b                	jbe    f01040d6 <env_free+0x188>
+	e->env_pgdir = 0;
+f010408b:	c7 47 60 00 00 00 00 	movl   $0x0,0x60(%edi)
+	return (physaddr_t)kva - KERNBASE;
+f0104092:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f0104097:	c1 e8 0c             	shr    $0xc,%eax
+f010409a:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f01040a0:	73 49                	jae    f01040eb <env_free+0x19d>
+	page_decref(pa2page(pa));
+f01040a2:	83 ec 0c             	sub    $0xc,%esp
+	return &pool.pages[PGNUM(pa)];
+f01040a5:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f01040a8:	a1 68 c2 7f f0       	mov    0xf07fc268,%eax
+f01040ad:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f01040b0:	50                   	push   %eax
+f01040b1:	e8 65 d8 ff ff       	call   f010191b <page_decref>
+
+	// return the environment to the free list
+	e->env_status = ENV_FREE;
+f01040b6:	c7 47 54 00 00 00 00 	movl   $0x0,0x54(%edi)
+	e->env_link = env_free_list;
+f01040bd:	a1 08 c3 7f f0       	mov    0xf07fc308,%eax
+f01040c2:	89 47 44             	mov    %eax,0x44(%edi)
+	env_free_list = e;
+f01040c5:	89 3d 08 c3 7f f0    	mov    %edi,0xf07fc308
+}
+f01040cb:	83 c4 10             	add    $0x10,%esp
+f01040ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01040d1:	5b                   	pop    %ebx
+f01040d2:	5e                   	pop    %esi
+f01040d3:	5f                   	pop    %edi
+f01040d4:	5d                   	pop    %ebp
+f01040d5:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01040d6:	50                   	push   %eax
+f01040d7:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f01040dc:	68 d8 01 00 00       	push   $0x1d8
+f01040e1:	68 ba bd 10 f0       	push   $0xf010bdba
+f01040e6:	e8 5e bf ff ff       	call   f0100049 <_panic>
+		panic("pa2page called with invalid pa");
+f01040eb:	83 ec 04             	sub    $0x4,%esp
+f01040ee:	68 94 b0 10 f0       	push   $0xf010b094
+f01040f3:	6a 58                	push   $0x58
+f01040f5:	68 31 ba 10 f0       	push   $0xf010ba31
+f01040fa:	e8 4a bf ff ff       	call   f0100049 <_panic>
+
+f01040ff <env_destroy>:
+// If e was the current env, then runs a new environment (and does not return
+// to the caller).
+//
+void
+env_destroy(struct Env *e)
+{
+f01040ff:	55                   	push   %ebp
+f0104100:	89 e5                	mov    %esp,%ebp
+f0104102:	53                   	push   %ebx
+f0104103:	83 ec 04             	sub    $0x4,%esp
+f0104106:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	// If e is currently running on other CPUs, we change its state to
+	// ENV_DYING. A zombie environment will be freed the next time
+	// it traps to the kernel.
+	if (e->env_status == ENV_RUNNING && curenv != e) {
+f0104109:	83 7b 54 03          	cmpl   $0x3,0x54(%ebx)
+f010410d:	74 21                	je     f0104130 <env_destroy+0x31>
+		e->env_status = ENV_DYING;
+		return;
+	}
+
+	env_free(e);
+f010410f:	83 ec 0c             	sub    $0xc,%esp
+f0104112:	53                   	push   %ebx
+f0104113:	e8 36 fe ff ff       	call   f0103f4e <env_free>
+
+	if (curenv == e) {
+f0104118:	e8 d6 32 00 00       	call   f01073f3 <cpunum>
+f010411d:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104120:	83 c4 10             	add    $0x10,%esp
+f0104123:	39 98 28 d0 83 f0    	cmp    %ebx,-0xf7c2fd8(%eax)
+f0104129:	74 1e                	je     f0104149 <env_destroy+0x4a>
+		curenv = NULL;
+		sched_yield();
+	}
+}
+f010412b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010412e:	c9                   	leave
+f010412f:	c3                   	ret
+	if (e->env_status == ENV_RUNNING && curenv != e) {
+f0104130:	e8 be 32 00 00       	call   f01073f3 <cpunum>
+f0104135:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104138:	39 98 28 d0 83 f0    	cmp    %ebx,-0xf7c2fd8(%eax)
+f010413e:	74 cf                	je     f010410f <env_destroy+0x10>
+		e->env_status = ENV_DYING;
+f0104140:	c7 43 54 01 00 00 00 	movl   $0x1,0x54(%ebx)
+		return;
+f0104147:	eb e2                	jmp    f010412b <env_destroy+0x2c>
+		curenv = NULL;
+f0104149:	e8 a5 32 00 00       	call   f01073f3 <cpunum>
+f010414e:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104151:	c7 80 28 d0 83 f0 00 	movl   $0x0,-0xf7c2fd8(%eax)
+f0104158:	00 00 00 
+		sched_yield();
+f010415b:	e8 c4 0b 00 00       	call   f0104d24 <sched_yield>
+
+f0104160 <env_pop_tf>:
+//
+// This function does not return.
+//
+void
+env_pop_tf(struct Trapframe *tf)
+{
+f0104160:	55                   	push   %ebp
+f0104161:	89 e5                	mov    %esp,%ebp
+f0104163:	53                   	push   %ebx
+f0104164:	83 ec 04             	sub    $0x4,%esp
+	// Record the CPU we are running on for user-space debugging
+	curenv->env_cpunum = cpunum();
+f0104167:	e8 87 32 00 00       	call   f01073f3 <cpunum>
+f010416c:	6b c0 74             	imul   $0x74,%eax,%eax
+f010416f:	8b 98 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%ebx
+f0104175:	e8 79 32 00 00       	call   f01073f3 <cpunum>
+f010417a:	89 43 5c             	mov    %eax,0x5c(%ebx)
+
+	asm volatile(
+f010417d:	8b 65 08             	mov    0x8(%ebp),%esp
+f0104180:	61                   	popa
+f0104181:	07                   	pop    %es
+f0104182:	1f                   	pop    %ds
+f0104183:	83 c4 08             	add    $0x8,%esp
+f0104186:	cf                   	iret
+		"\tpopl %%es\n"
+		"\tpopl %%ds\n"
+		"\taddl $0x8,%%esp\n" /* skip tf_trapno and tf_errcode */
+		"\tiret\n"
+		: : "g" (tf) : "memory");
+	panic("iret failed");  /* mostly to placate the compiler */
+f0104187:	83 ec 04             	sub    $0x4,%esp
+f010418a:	68 f8 bd 10 f0       	push   $0xf010bdf8
+f010418f:	68 0f 02 00 00       	push   $0x20f
+f0104194:	68 ba bd 10 f0       	push   $0xf010bdba
+f0104199:	e8 ab be ff ff       	call   f0100049 <_panic>
+
+f010419e <env_run>:
+//
+// This function does not return.
+//
+void
+env_run(struct Env *e)
+{
+f010419e:	55                   	push   %ebp
+f010419f:	89 e5                	mov    %esp,%ebp
+f01041a1:	53                   	push   %ebx
+f01041a2:	83 ec 04             	sub    $0x4,%esp
+f01041a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	//	e->env_tf.  Go back through the code you wrote above
+	//	and make sure you have set the relevant parts of
+	//	e->env_tf to sensible values.
+
+	// LAB 3: Your code here.
+	if (curenv && curenv->env_status == ENV_RUNNING)
+f01041a8:	e8 46 32 00 00       	call   f01073f3 <cpunum>
+f01041ad:	6b c0 74             	imul   $0x74,%eax,%eax
+f01041b0:	83 b8 28 d0 83 f0 00 	cmpl   $0x0,-0xf7c2fd8(%eax)
+f01041b7:	74 14                	je     f01041cd <env_run+0x2f>
+f01041b9:	e8 35 32 00 00       	call   f01073f3 <cpunum>
+f01041be:	6b c0 74             	imul   $0x74,%eax,%eax
+f01041c1:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f01041c7:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f01041cb:	74 46                	je     f0104213 <env_run+0x75>
+		curenv->env_status = ENV_RUNNABLE;
+	e->env_status = ENV_RUNNING;
+f01041cd:	c7 43 54 03 00 00 00 	movl   $0x3,0x54(%ebx)
+}
+
+static inline void
+unlock_kernel(void)
+{
+	spin_unlock(&kernel_lock);
+f01041d4:	83 ec 0c             	sub    $0xc,%esp
+f01041d7:	68 80 64 11 f0       	push   $0xf0116480
+f01041dc:	e8 1c 35 00 00       	call   f01076fd <spin_unlock>
+
+	// Normally we wouldn't need to do this, but QEMU only runs
+	// one CPU at a time and has a long time-slice.  Without the
+	// pause, this CPU is likely to reacquire the lock before
+	// another CPU has even been given a chance to acquire it.
+	asm volatile("pause");
+f01041e1:	f3 90                	pause
+	// Unlocking of the kernel can't be done before updating the status
+	// of the environment, or other CPUs might try schedule it again.
+	unlock_kernel();
+	e->env_runs++;
+f01041e3:	83 43 58 01          	addl   $0x1,0x58(%ebx)
+	lcr3(PADDR(e->env_pgdir));
+f01041e7:	8b 43 60             	mov    0x60(%ebx),%eax
+	if ((uint32_t)kva < KERNBASE)
+f01041ea:	83 c4 10             	add    $0x10,%esp
+f01041ed:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01041f2:	76 36                	jbe    f010422a <env_run+0x8c>
+	return (physaddr_t)kva - KERNBASE;
+f01041f4:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f01041f9:	0f 22 d8             	mov    %eax,%cr3
+	curenv = e;
+f01041fc:	e8 f2 31 00 00       	call   f01073f3 <cpunum>
+f0104201:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104204:	89 98 28 d0 83 f0    	mov    %ebx,-0xf7c2fd8(%eax)
+	env_pop_tf(&e->env_tf);
+f010420a:	83 ec 0c             	sub    $0xc,%esp
+f010420d:	53                   	push   %ebx
+f010420e:	e8 4d ff ff ff       	call   f0104160 <env_pop_tf>
+		curenv->env_status = ENV_RUNNABLE;
+f0104213:	e8 db 31 00 00       	call   f01073f3 <cpunum>
+f0104218:	6b c0 74             	imul   $0x74,%eax,%eax
+f010421b:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0104221:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+f0104228:	eb a3                	jmp    f01041cd <env_run+0x2f>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010422a:	50                   	push   %eax
+f010422b:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0104230:	68 34 02 00 00       	push   $0x234
+f0104235:	68 ba bd 10 f0       	push   $0xf010bdba
+f010423a:	e8 0a be ff ff       	call   f0100049 <_panic>
+
+f010423f <mc146818_read>:
+#include <kern/kclock.h>
+
+
+unsigned
+mc146818_read(unsigned reg)
+{
+f010423f:	55                   	push   %ebp
+f0104240:	89 e5                	mov    %esp,%ebp
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0104242:	8b 45 08             	mov    0x8(%ebp),%eax
+f0104245:	ba 70 00 00 00       	mov    $0x70,%edx
+f010424a:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010424b:	ba 71 00 00 00       	mov    $0x71,%edx
+f0104250:	ec                   	in     (%dx),%al
+	outb(IO_RTC, reg);
+	return inb(IO_RTC+1);
+f0104251:	0f b6 c0             	movzbl %al,%eax
+}
+f0104254:	5d                   	pop    %ebp
+f0104255:	c3                   	ret
+
+f0104256 <mc146818_write>:
+
+void
+mc146818_write(unsigned reg, unsigned datum)
+{
+f0104256:	55                   	push   %ebp
+f0104257:	89 e5                	mov    %esp,%ebp
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0104259:	8b 45 08             	mov    0x8(%ebp),%eax
+f010425c:	ba 70 00 00 00       	mov    $0x70,%edx
+f0104261:	ee                   	out    %al,(%dx)
+f0104262:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0104265:	ba 71 00 00 00       	mov    $0x71,%edx
+f010426a:	ee                   	out    %al,(%dx)
+	outb(IO_RTC, reg);
+	outb(IO_RTC+1, datum);
+}
+f010426b:	5d                   	pop    %ebp
+f010426c:	c3                   	ret
+
+f010426d <irq_setmask_8259A>:
+		irq_setmask_8259A(irq_mask_8259A);
+}
+
+void
+irq_setmask_8259A(uint16_t mask)
+{
+f010426d:	55                   	push   %ebp
+f010426e:	89 e5                	mov    %esp,%ebp
+f0104270:	56                   	push   %esi
+f0104271:	53                   	push   %ebx
+f0104272:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	irq_mask_8259A = mask;
+f0104275:	66 89 0d a8 63 11 f0 	mov    %cx,0xf01163a8
+	if (!didinit)
+f010427c:	80 3d 0c c3 7f f0 00 	cmpb   $0x0,0xf07fc30c
+f0104283:	75 07                	jne    f010428c <irq_setmask_8259A+0x1f>
+	cprintf("enabled interrupts:");
+	for (i = 0; i < 16; i++)
+		if (~mask & (1<<i))
+			cprintf(" %d", i);
+	cprintf("\n");
+}
+f0104285:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0104288:	5b                   	pop    %ebx
+f0104289:	5e                   	pop    %esi
+f010428a:	5d                   	pop    %ebp
+f010428b:	c3                   	ret
+f010428c:	89 ce                	mov    %ecx,%esi
+f010428e:	ba 21 00 00 00       	mov    $0x21,%edx
+f0104293:	89 c8                	mov    %ecx,%eax
+f0104295:	ee                   	out    %al,(%dx)
+	outb(IO_PIC2+1, (char)(mask >> 8));
+f0104296:	89 c8                	mov    %ecx,%eax
+f0104298:	66 c1 e8 08          	shr    $0x8,%ax
+f010429c:	ba a1 00 00 00       	mov    $0xa1,%edx
+f01042a1:	ee                   	out    %al,(%dx)
+	cprintf("enabled interrupts:");
+f01042a2:	83 ec 0c             	sub    $0xc,%esp
+f01042a5:	68 23 be 10 f0       	push   $0xf010be23
+f01042aa:	e8 32 01 00 00       	call   f01043e1 <cprintf>
+f01042af:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 16; i++)
+f01042b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (~mask & (1<<i))
+f01042b7:	0f b7 f6             	movzwl %si,%esi
+f01042ba:	f7 d6                	not    %esi
+f01042bc:	eb 08                	jmp    f01042c6 <irq_setmask_8259A+0x59>
+	for (i = 0; i < 16; i++)
+f01042be:	83 c3 01             	add    $0x1,%ebx
+f01042c1:	83 fb 10             	cmp    $0x10,%ebx
+f01042c4:	74 18                	je     f01042de <irq_setmask_8259A+0x71>
+		if (~mask & (1<<i))
+f01042c6:	0f a3 de             	bt     %ebx,%esi
+f01042c9:	73 f3                	jae    f01042be <irq_setmask_8259A+0x51>
+			cprintf(" %d", i);
+f01042cb:	83 ec 08             	sub    $0x8,%esp
+f01042ce:	53                   	push   %ebx
+f01042cf:	68 27 c3 10 f0       	push   $0xf010c327
+f01042d4:	e8 08 01 00 00       	call   f01043e1 <cprintf>
+f01042d9:	83 c4 10             	add    $0x10,%esp
+f01042dc:	eb e0                	jmp    f01042be <irq_setmask_8259A+0x51>
+	cprintf("\n");
+f01042de:	83 ec 0c             	sub    $0xc,%esp
+f01042e1:	68 6b bd 10 f0       	push   $0xf010bd6b
+f01042e6:	e8 f6 00 00 00       	call   f01043e1 <cprintf>
+f01042eb:	83 c4 10             	add    $0x10,%esp
+f01042ee:	eb 95                	jmp    f0104285 <irq_setmask_8259A+0x18>
+
+f01042f0 <pic_init>:
+{
+f01042f0:	55                   	push   %ebp
+f01042f1:	89 e5                	mov    %esp,%ebp
+f01042f3:	57                   	push   %edi
+f01042f4:	56                   	push   %esi
+f01042f5:	53                   	push   %ebx
+f01042f6:	83 ec 0c             	sub    $0xc,%esp
+	didinit = 1;
+f01042f9:	c6 05 0c c3 7f f0 01 	movb   $0x1,0xf07fc30c
+f0104300:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0104305:	bb 21 00 00 00       	mov    $0x21,%ebx
+f010430a:	89 da                	mov    %ebx,%edx
+f010430c:	ee                   	out    %al,(%dx)
+f010430d:	b9 a1 00 00 00       	mov    $0xa1,%ecx
+f0104312:	89 ca                	mov    %ecx,%edx
+f0104314:	ee                   	out    %al,(%dx)
+f0104315:	bf 11 00 00 00       	mov    $0x11,%edi
+f010431a:	be 20 00 00 00       	mov    $0x20,%esi
+f010431f:	89 f8                	mov    %edi,%eax
+f0104321:	89 f2                	mov    %esi,%edx
+f0104323:	ee                   	out    %al,(%dx)
+f0104324:	b8 20 00 00 00       	mov    $0x20,%eax
+f0104329:	89 da                	mov    %ebx,%edx
+f010432b:	ee                   	out    %al,(%dx)
+f010432c:	b8 04 00 00 00       	mov    $0x4,%eax
+f0104331:	ee                   	out    %al,(%dx)
+f0104332:	b8 03 00 00 00       	mov    $0x3,%eax
+f0104337:	ee                   	out    %al,(%dx)
+f0104338:	bb a0 00 00 00       	mov    $0xa0,%ebx
+f010433d:	89 f8                	mov    %edi,%eax
+f010433f:	89 da                	mov    %ebx,%edx
+f0104341:	ee                   	out    %al,(%dx)
+f0104342:	b8 28 00 00 00       	mov    $0x28,%eax
+f0104347:	89 ca                	mov    %ecx,%edx
+f0104349:	ee                   	out    %al,(%dx)
+f010434a:	b8 02 00 00 00       	mov    $0x2,%eax
+f010434f:	ee                   	out    %al,(%dx)
+f0104350:	b8 01 00 00 00       	mov    $0x1,%eax
+f0104355:	ee                   	out    %al,(%dx)
+f0104356:	bf 68 00 00 00       	mov    $0x68,%edi
+f010435b:	89 f8                	mov    %edi,%eax
+f010435d:	89 f2                	mov    %esi,%edx
+f010435f:	ee                   	out    %al,(%dx)
+f0104360:	b9 0a 00 00 00       	mov    $0xa,%ecx
+f0104365:	89 c8                	mov    %ecx,%eax
+f0104367:	ee                   	out    %al,(%dx)
+f0104368:	89 f8                	mov    %edi,%eax
+f010436a:	89 da                	mov    %ebx,%edx
+f010436c:	ee                   	out    %al,(%dx)
+f010436d:	89 c8                	mov    %ecx,%eax
+f010436f:	ee                   	out    %al,(%dx)
+	if (irq_mask_8259A != 0xFFFF)
+f0104370:	0f b7 05 a8 63 11 f0 	movzwl 0xf01163a8,%eax
+f0104377:	66 83 f8 ff          	cmp    $0xffff,%ax
+f010437b:	75 08                	jne    f0104385 <pic_init+0x95>
+}
+f010437d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104380:	5b                   	pop    %ebx
+f0104381:	5e                   	pop    %esi
+f0104382:	5f                   	pop    %edi
+f0104383:	5d                   	pop    %ebp
+f0104384:	c3                   	ret
+		irq_setmask_8259A(irq_mask_8259A);
+f0104385:	83 ec 0c             	sub    $0xc,%esp
+f0104388:	0f b7 c0             	movzwl %ax,%eax
+f010438b:	50                   	push   %eax
+f010438c:	e8 dc fe ff ff       	call   f010426d <irq_setmask_8259A>
+f0104391:	83 c4 10             	add    $0x10,%esp
+}
+f0104394:	eb e7                	jmp    f010437d <pic_init+0x8d>
+
+f0104396 <irq_eoi>:
+f0104396:	b8 20 00 00 00       	mov    $0x20,%eax
+f010439b:	ba 20 00 00 00       	mov    $0x20,%edx
+f01043a0:	ee                   	out    %al,(%dx)
+f01043a1:	ba a0 00 00 00       	mov    $0xa0,%edx
+f01043a6:	ee                   	out    %al,(%dx)
+	//   s: specific
+	//   e: end-of-interrupt
+	// xxx: specific interrupt line
+	outb(IO_PIC1, 0x20);
+	outb(IO_PIC2, 0x20);
+}
+f01043a7:	c3                   	ret
+
+f01043a8 <putch>:
+#include <inc/stdarg.h>
+
+
+static void
+putch(int ch, int *cnt)
+{
+f01043a8:	55                   	push   %ebp
+f01043a9:	89 e5                	mov    %esp,%ebp
+f01043ab:	83 ec 14             	sub    $0x14,%esp
+	cputchar(ch);
+f01043ae:	ff 75 08             	push   0x8(%ebp)
+f01043b1:	e8 08 c4 ff ff       	call   f01007be <cputchar>
+	*cnt++;
+}
+f01043b6:	83 c4 10             	add    $0x10,%esp
+f01043b9:	c9                   	leave
+f01043ba:	c3                   	ret
+
+f01043bb <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+f01043bb:	55                   	push   %ebp
+f01043bc:	89 e5                	mov    %esp,%ebp
+f01043be:	83 ec 18             	sub    $0x18,%esp
+	int cnt = 0;
+f01043c1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	vprintfmt((void*)putch, &cnt, fmt, ap);
+f01043c8:	ff 75 0c             	push   0xc(%ebp)
+f01043cb:	ff 75 08             	push   0x8(%ebp)
+f01043ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01043d1:	50                   	push   %eax
+f01043d2:	68 a8 43 10 f0       	push   $0xf01043a8
+f01043d7:	e8 f4 22 00 00       	call   f01066d0 <vprintfmt>
+	return cnt;
+}
+f01043dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01043df:	c9                   	leave
+f01043e0:	c3                   	ret
+
+f01043e1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+f01043e1:	55                   	push   %ebp
+f01043e2:	89 e5                	mov    %esp,%ebp
+f01043e4:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+f01043e7:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+f01043ea:	50                   	push   %eax
+f01043eb:	ff 75 08             	push   0x8(%ebp)
+f01043ee:	e8 c8 ff ff ff       	call   f01043bb <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+f01043f3:	c9                   	leave
+f01043f4:	c3                   	ret
+
+f01043f5 <trap_init_percpu>:
+}
+
+// Initialize and load the per-CPU TSS and IDT
+void
+trap_init_percpu(void)
+{
+f01043f5:	55                   	push   %ebp
+f01043f6:	89 e5                	mov    %esp,%ebp
+f01043f8:	57                   	push   %edi
+f01043f9:	56                   	push   %esi
+f01043fa:	53                   	push   %ebx
+f01043fb:	83 ec 0c             	sub    $0xc,%esp
+	// get a triple fault.  If you set up an individual CPU's TSS
+	// wrong, you may not get a fault until you try to return from
+	// user space on that CPU.
+	//
+	// LAB 4: Your code here:
+	struct Taskstate *ts = &thiscpu->cpu_ts;
+f01043fe:	e8 f0 2f 00 00       	call   f01073f3 <cpunum>
+f0104403:	6b f0 74             	imul   $0x74,%eax,%esi
+f0104406:	8d be 2c d0 83 f0    	lea    -0xf7c2fd4(%esi),%edi
+	size_t id = cpunum();
+f010440c:	e8 e2 2f 00 00       	call   f01073f3 <cpunum>
+f0104411:	89 c2                	mov    %eax,%edx
+
+	// Setup a TSS so that we get the right stack
+	// when we trap to the kernel.
+	ts->ts_esp0 = KSTACKTOP - id * (KSTKSIZE + KSTKGAP);
+f0104413:	bb 00 f0 00 00       	mov    $0xf000,%ebx
+f0104418:	29 c3                	sub    %eax,%ebx
+f010441a:	c1 e3 10             	shl    $0x10,%ebx
+f010441d:	89 9e 30 d0 83 f0    	mov    %ebx,-0xf7c2fd0(%esi)
+	ts->ts_ss0 = GD_KD;
+f0104423:	66 c7 86 34 d0 83 f0 	movw   $0x10,-0xf7c2fcc(%esi)
+f010442a:	10 00 
+	ts->ts_iomb = sizeof(struct Taskstate);
+f010442c:	66 c7 86 92 d0 83 f0 	movw   $0x68,-0xf7c2f6e(%esi)
+f0104433:	68 00 
+
+	// Initialize the TSS slot of the gdt.
+	gdt[(GD_TSS0 >> 3) + id] = SEG16(STS_T32A, (uint32_t) ts,
+f0104435:	8d 40 05             	lea    0x5(%eax),%eax
+f0104438:	66 c7 04 c5 40 63 11 	movw   $0x67,-0xfee9cc0(,%eax,8)
+f010443f:	f0 67 00 
+f0104442:	66 89 3c c5 42 63 11 	mov    %di,-0xfee9cbe(,%eax,8)
+f0104449:	f0 
+f010444a:	89 f9                	mov    %edi,%ecx
+f010444c:	c1 e9 10             	shr    $0x10,%ecx
+f010444f:	88 0c c5 44 63 11 f0 	mov    %cl,-0xfee9cbc(,%eax,8)
+f0104456:	c6 04 c5 46 63 11 f0 	movb   $0x40,-0xfee9cba(,%eax,8)
+f010445d:	40 
+f010445e:	c1 ef 18             	shr    $0x18,%edi
+f0104461:	89 f9                	mov    %edi,%ecx
+f0104463:	88 0c c5 47 63 11 f0 	mov    %cl,-0xfee9cb9(,%eax,8)
+					 sizeof(struct Taskstate) - 1, 0);
+	gdt[(GD_TSS0 >> 3) + id].sd_s = 0;
+f010446a:	c6 04 c5 45 63 11 f0 	movb   $0x89,-0xfee9cbb(,%eax,8)
+f0104471:	89 
+
+	// Load the TSS selector (like other segment selectors, the
+	// bottom three bits are special; we leave them 0)
+	ltr(GD_TSS0 + (id << 3));
+f0104472:	8d 14 d5 28 00 00 00 	lea    0x28(,%edx,8),%edx
+	asm volatile("ltr %0" : : "r" (sel));
+f0104479:	0f 00 da             	ltr    %dx
+	asm volatile("lidt (%0)" : : "r" (p));
+f010447c:	b8 ac 63 11 f0       	mov    $0xf01163ac,%eax
+f0104481:	0f 01 18             	lidtl  (%eax)
+}
+
+static inline void
+wrmsr(uint32_t msr, uint64_t value)
+{
+	asm volatile("wrmsr" : : "c" (msr), "A" (value));
+f0104484:	b9 74 01 00 00       	mov    $0x174,%ecx
+f0104489:	b8 08 00 00 00       	mov    $0x8,%eax
+f010448e:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104493:	0f 30                	wrmsr
+
+	// Prepare MSRs for fast system call.
+	extern void sysenter_handler(void);
+
+	wrmsr(IA32_SYSENTER_CS, GD_KT);
+	wrmsr(IA32_SYSENTER_ESP, ts->ts_esp0);
+f0104495:	89 d8                	mov    %ebx,%eax
+f0104497:	ba 00 00 00 00       	mov    $0x0,%edx
+f010449c:	b9 75 01 00 00       	mov    $0x175,%ecx
+f01044a1:	0f 30                	wrmsr
+f01044a3:	b9 76 01 00 00       	mov    $0x176,%ecx
+f01044a8:	b8 49 4c 10 f0       	mov    $0xf0104c49,%eax
+f01044ad:	ba 00 00 00 00       	mov    $0x0,%edx
+f01044b2:	0f 30                	wrmsr
+	wrmsr(IA32_SYSENTER_EIP, (uint32_t) sysenter_handler);
+}
+f01044b4:	83 c4 0c             	add    $0xc,%esp
+f01044b7:	5b                   	pop    %ebx
+f01044b8:	5e                   	pop    %esi
+f01044b9:	5f                   	pop    %edi
+f01044ba:	5d                   	pop    %ebp
+f01044bb:	c3                   	ret
+
+f01044bc <trap_init>:
+{
+f01044bc:	55                   	push   %ebp
+f01044bd:	89 e5                	mov    %esp,%ebp
+f01044bf:	83 ec 08             	sub    $0x8,%esp
+	for (size_t i = 0; i <= T_SYSCALL; i++)
+f01044c2:	b8 00 00 00 00       	mov    $0x0,%eax
+		SETGATE(idt[i], 0, GD_KT, _vectors[i], 0);
+f01044c7:	8b 14 85 b2 63 11 f0 	mov    -0xfee9c4e(,%eax,4),%edx
+f01044ce:	66 89 14 c5 20 c3 7f 	mov    %dx,-0xf803ce0(,%eax,8)
+f01044d5:	f0 
+f01044d6:	66 c7 04 c5 22 c3 7f 	movw   $0x8,-0xf803cde(,%eax,8)
+f01044dd:	f0 08 00 
+f01044e0:	c6 04 c5 24 c3 7f f0 	movb   $0x0,-0xf803cdc(,%eax,8)
+f01044e7:	00 
+f01044e8:	c6 04 c5 25 c3 7f f0 	movb   $0x8e,-0xf803cdb(,%eax,8)
+f01044ef:	8e 
+f01044f0:	c1 ea 10             	shr    $0x10,%edx
+f01044f3:	66 89 14 c5 26 c3 7f 	mov    %dx,-0xf803cda(,%eax,8)
+f01044fa:	f0 
+	for (size_t i = 0; i <= T_SYSCALL; i++)
+f01044fb:	83 c0 01             	add    $0x1,%eax
+f01044fe:	83 f8 31             	cmp    $0x31,%eax
+f0104501:	75 c4                	jne    f01044c7 <trap_init+0xb>
+	idt[T_BRKPT].gd_dpl = 3;
+f0104503:	80 0d 3d c3 7f f0 60 	orb    $0x60,0xf07fc33d
+	idt[T_SYSCALL].gd_dpl = 3;
+f010450a:	80 0d a5 c4 7f f0 60 	orb    $0x60,0xf07fc4a5
+	trap_init_percpu();
+f0104511:	e8 df fe ff ff       	call   f01043f5 <trap_init_percpu>
+}
+f0104516:	c9                   	leave
+f0104517:	c3                   	ret
+
+f0104518 <print_regs>:
+	}
+}
+
+void
+print_regs(struct PushRegs *regs)
+{
+f0104518:	55                   	push   %ebp
+f0104519:	89 e5                	mov    %esp,%ebp
+f010451b:	53                   	push   %ebx
+f010451c:	83 ec 0c             	sub    $0xc,%esp
+f010451f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("  edi  0x%08x\n", regs->reg_edi);
+f0104522:	ff 33                	push   (%ebx)
+f0104524:	68 37 be 10 f0       	push   $0xf010be37
+f0104529:	e8 b3 fe ff ff       	call   f01043e1 <cprintf>
+	cprintf("  esi  0x%08x\n", regs->reg_esi);
+f010452e:	83 c4 08             	add    $0x8,%esp
+f0104531:	ff 73 04             	push   0x4(%ebx)
+f0104534:	68 46 be 10 f0       	push   $0xf010be46
+f0104539:	e8 a3 fe ff ff       	call   f01043e1 <cprintf>
+	cprintf("  ebp  0x%08x\n", regs->reg_ebp);
+f010453e:	83 c4 08             	add    $0x8,%esp
+f0104541:	ff 73 08             	push   0x8(%ebx)
+f0104544:	68 55 be 10 f0       	push   $0xf010be55
+f0104549:	e8 93 fe ff ff       	call   f01043e1 <cprintf>
+	cprintf("  oesp 0x%08x\n", regs->reg_oesp);
+f010454e:	83 c4 08             	add    $0x8,%esp
+f0104551:	ff 73 0c             	push   0xc(%ebx)
+f0104554:	68 64 be 10 f0       	push   $0xf010be64
+f0104559:	e8 83 fe ff ff       	call   f01043e1 <cprintf>
+	cprintf("  ebx  0x%08x\n", regs->reg_ebx);
+f010455e:	83 c4 08             	add    $0x8,%esp
+f0104561:	ff 73 10             	push   0x10(%ebx)
+f0104564:	68 73 be 10 f0       	push   $0xf010be73
+f0104569:	e8 73 fe ff ff       	call   f01043e1 <cprintf>
+	cprintf("  edx  0x%08x\n", regs->reg_edx);
+f010456e:	83 c4 08             	add    $0x8,%esp
+f0104571:	ff 73 14             	push   0x14(%ebx)
+f0104574:	68 82 be 10 f0       	push   $0xf010be82
+f0104579:	e8 63 fe ff ff       	call   f01043e1 <cprintf>
+	cprintf("  ecx  0x%08x\n", regs->reg_ecx);
+f010457e:	83 c4 08             	add    $0x8,%esp
+f0104581:	ff 73 18             	push   0x18(%ebx)
+f0104584:	68 91 be 10 f0       	push   $0xf010be91
+f0104589:	e8 53 fe ff ff       	call   f01043e1 <cprintf>
+	cprintf("  eax  0x%08x\n", regs->reg_eax);
+f010458e:	83 c4 08             	add    $0x8,%esp
+f0104591:	ff 73 1c             	push   0x1c(%ebx)
+f0104594:	68 a0 be 10 f0       	push   $0xf010bea0
+f0104599:	e8 43 fe ff ff       	call   f01043e1 <cprintf>
+}
+f010459e:	83 c4 10             	add    $0x10,%esp
+f01045a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01045a4:	c9                   	leave
+f01045a5:	c3                   	ret
+
+f01045a6 <print_trapframe>:
+{
+f01045a6:	55                   	push   %ebp
+f01045a7:	89 e5                	mov    %esp,%ebp
+f01045a9:	56                   	push   %esi
+f01045aa:	53                   	push   %ebx
+f01045ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("TRAP frame at %p from CPU %d\n", tf, cpunum());
+f01045ae:	e8 40 2e 00 00       	call   f01073f3 <cpunum>
+f01045b3:	83 ec 04             	sub    $0x4,%esp
+f01045b6:	50                   	push   %eax
+f01045b7:	53                   	push   %ebx
+f01045b8:	68 04 bf 10 f0       	push   $0xf010bf04
+f01045bd:	e8 1f fe ff ff       	call   f01043e1 <cprintf>
+	print_regs(&tf->tf_regs);
+f01045c2:	89 1c 24             	mov    %ebx,(%esp)
+f01045c5:	e8 4e ff ff ff       	call   f0104518 <print_regs>
+	cprintf("  es   0x----%04x\n", tf->tf_es);
+f01045ca:	83 c4 08             	add    $0x8,%esp
+f01045cd:	0f b7 43 20          	movzwl 0x20(%ebx),%eax
+f01045d1:	50                   	push   %eax
+f01045d2:	68 22 bf 10 f0       	push   $0xf010bf22
+f01045d7:	e8 05 fe ff ff       	call   f01043e1 <cprintf>
+	cprintf("  ds   0x----%04x\n", tf->tf_ds);
+f01045dc:	83 c4 08             	add    $0x8,%esp
+f01045df:	0f b7 43 24          	movzwl 0x24(%ebx),%eax
+f01045e3:	50                   	push   %eax
+f01045e4:	68 35 bf 10 f0       	push   $0xf010bf35
+f01045e9:	e8 f3 fd ff ff       	call   f01043e1 <cprintf>
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f01045ee:	8b 43 28             	mov    0x28(%ebx),%eax
+	if (trapno < ARRAY_SIZE(excnames))
+f01045f1:	83 c4 10             	add    $0x10,%esp
+f01045f4:	83 f8 13             	cmp    $0x13,%eax
+f01045f7:	0f 86 da 00 00 00    	jbe    f01046d7 <print_trapframe+0x131>
+		return "System call";
+f01045fd:	ba af be 10 f0       	mov    $0xf010beaf,%edx
+	if (trapno == T_SYSCALL)
+f0104602:	83 f8 30             	cmp    $0x30,%eax
+f0104605:	74 13                	je     f010461a <print_trapframe+0x74>
+	if (trapno >= IRQ_OFFSET && trapno < IRQ_OFFSET + 16)
+f0104607:	8d 50 e0             	lea    -0x20(%eax),%edx
+	return "(unknown trap)";
+f010460a:	83 fa 10             	cmp    $0x10,%edx
+f010460d:	ba ca be 10 f0       	mov    $0xf010beca,%edx
+f0104612:	b9 bb be 10 f0       	mov    $0xf010bebb,%ecx
+f0104617:	0f 43 d1             	cmovae %ecx,%edx
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f010461a:	83 ec 04             	sub    $0x4,%esp
+f010461d:	52                   	push   %edx
+f010461e:	50                   	push   %eax
+f010461f:	68 48 bf 10 f0       	push   $0xf010bf48
+f0104624:	e8 b8 fd ff ff       	call   f01043e1 <cprintf>
+	if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f0104629:	83 c4 10             	add    $0x10,%esp
+f010462c:	39 1d 20 cb 7f f0    	cmp    %ebx,0xf07fcb20
+f0104632:	0f 84 ab 00 00 00    	je     f01046e3 <print_trapframe+0x13d>
+	cprintf("  err  0x%08x", tf->tf_err);
+f0104638:	83 ec 08             	sub    $0x8,%esp
+f010463b:	ff 73 2c             	push   0x2c(%ebx)
+f010463e:	68 69 bf 10 f0       	push   $0xf010bf69
+f0104643:	e8 99 fd ff ff       	call   f01043e1 <cprintf>
+	if (tf->tf_trapno == T_PGFLT)
+f0104648:	83 c4 10             	add    $0x10,%esp
+f010464b:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f010464f:	0f 85 b1 00 00 00    	jne    f0104706 <print_trapframe+0x160>
+			tf->tf_err & 1 ? "protection" : "not-present");
+f0104655:	8b 43 2c             	mov    0x2c(%ebx),%eax
+		cprintf(" [%s, %s, %s]\n",
+f0104658:	a8 01                	test   $0x1,%al
+f010465a:	b9 e8 be 10 f0       	mov    $0xf010bee8,%ecx
+f010465f:	ba dd be 10 f0       	mov    $0xf010bedd,%edx
+f0104664:	0f 45 ca             	cmovne %edx,%ecx
+f0104667:	a8 02                	test   $0x2,%al
+f0104669:	ba fa be 10 f0       	mov    $0xf010befa,%edx
+f010466e:	be f4 be 10 f0       	mov    $0xf010bef4,%esi
+f0104673:	0f 45 d6             	cmovne %esi,%edx
+f0104676:	a8 04                	test   $0x4,%al
+f0104678:	b8 55 c0 10 f0       	mov    $0xf010c055,%eax
+f010467d:	be ff be 10 f0       	mov    $0xf010beff,%esi
+f0104682:	0f 45 c6             	cmovne %esi,%eax
+f0104685:	51                   	push   %ecx
+f0104686:	52                   	push   %edx
+f0104687:	50                   	push   %eax
+f0104688:	68 77 bf 10 f0       	push   $0xf010bf77
+f010468d:	e8 4f fd ff ff       	call   f01043e1 <cprintf>
+f0104692:	83 c4 10             	add    $0x10,%esp
+	cprintf("  eip  0x%08x\n", tf->tf_eip);
+f0104695:	83 ec 08             	sub    $0x8,%esp
+f0104698:	ff 73 30             	push   0x30(%ebx)
+f010469b:	68 86 bf 10 f0       	push   $0xf010bf86
+f01046a0:	e8 3c fd ff ff       	call   f01043e1 <cprintf>
+	cprintf("  cs   0x----%04x\n", tf->tf_cs);
+f01046a5:	83 c4 08             	add    $0x8,%esp
+f01046a8:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f01046ac:	50                   	push   %eax
+f01046ad:	68 95 bf 10 f0       	push   $0xf010bf95
+f01046b2:	e8 2a fd ff ff       	call   f01043e1 <cprintf>
+	cprintf("  flag 0x%08x\n", tf->tf_eflags);
+f01046b7:	83 c4 08             	add    $0x8,%esp
+f01046ba:	ff 73 38             	push   0x38(%ebx)
+f01046bd:	68 a8 bf 10 f0       	push   $0xf010bfa8
+f01046c2:	e8 1a fd ff ff       	call   f01043e1 <cprintf>
+	if ((tf->tf_cs & 3) != 0) {
+f01046c7:	83 c4 10             	add    $0x10,%esp
+f01046ca:	f6 43 34 03          	testb  $0x3,0x34(%ebx)
+f01046ce:	75 4b                	jne    f010471b <print_trapframe+0x175>
+}
+f01046d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01046d3:	5b                   	pop    %ebx
+f01046d4:	5e                   	pop    %esi
+f01046d5:	5d                   	pop    %ebp
+f01046d6:	c3                   	ret
+		return excnames[trapno];
+f01046d7:	8b 14 85 e0 c1 10 f0 	mov    -0xfef3e20(,%eax,4),%edx
+f01046de:	e9 37 ff ff ff       	jmp    f010461a <print_trapframe+0x74>
+	if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f01046e3:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f01046e7:	0f 85 4b ff ff ff    	jne    f0104638 <print_trapframe+0x92>
+	asm volatile("movl %%cr2,%0" : "=r" (val));
+f01046ed:	0f 20 d0             	mov    %cr2,%eax
+		cprintf("  cr2  0x%08x\n", rcr2());
+f01046f0:	83 ec 08             	sub    $0x8,%esp
+f01046f3:	50                   	push   %eax
+f01046f4:	68 5a bf 10 f0       	push   $0xf010bf5a
+f01046f9:	e8 e3 fc ff ff       	call   f01043e1 <cprintf>
+f01046fe:	83 c4 10             	add    $0x10,%esp
+f0104701:	e9 32 ff ff ff       	jmp    f0104638 <print_trapframe+0x92>
+		cprintf("\n");
+f0104706:	83 ec 0c             	sub    $0xc,%esp
+f0104709:	68 6b bd 10 f0       	push   $0xf010bd6b
+f010470e:	e8 ce fc ff ff       	call   f01043e1 <cprintf>
+f0104713:	83 c4 10             	add    $0x10,%esp
+f0104716:	e9 7a ff ff ff       	jmp    f0104695 <print_trapframe+0xef>
+		cprintf("  esp  0x%08x\n", tf->tf_esp);
+f010471b:	83 ec 08             	sub    $0x8,%esp
+f010471e:	ff 73 3c             	push   0x3c(%ebx)
+f0104721:	68 b7 bf 10 f0       	push   $0xf010bfb7
+f0104726:	e8 b6 fc ff ff       	call   f01043e1 <cprintf>
+		cprintf("  ss   0x----%04x\n", tf->tf_ss);
+f010472b:	83 c4 08             	add    $0x8,%esp
+f010472e:	0f b7 43 40          	movzwl 0x40(%ebx),%eax
+f0104732:	50                   	push   %eax
+f0104733:	68 c6 bf 10 f0       	push   $0xf010bfc6
+f0104738:	e8 a4 fc ff ff       	call   f01043e1 <cprintf>
+f010473d:	83 c4 10             	add    $0x10,%esp
+}
+f0104740:	eb 8e                	jmp    f01046d0 <print_trapframe+0x12a>
+
+f0104742 <page_fault_handler>:
+}
+
+
+void
+page_fault_handler(struct Trapframe *tf)
+{
+f0104742:	55                   	push   %ebp
+f0104743:	89 e5                	mov    %esp,%ebp
+f0104745:	57                   	push   %edi
+f0104746:	56                   	push   %esi
+f0104747:	53                   	push   %ebx
+f0104748:	83 ec 0c             	sub    $0xc,%esp
+f010474b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f010474e:	0f 20 d6             	mov    %cr2,%esi
+	fault_va = rcr2();
+
+	// Handle kernel-mode page faults.
+
+	// LAB 3: Your code here.
+	assert(tf->tf_cs & 3); /* or */ assert(tf->tf_err & FEC_U);
+f0104751:	f6 43 34 03          	testb  $0x3,0x34(%ebx)
+f0104755:	74 60                	je     f01047b7 <page_fault_handler+0x75>
+f0104757:	f6 43 2c 04          	testb  $0x4,0x2c(%ebx)
+f010475b:	74 73                	je     f01047d0 <page_fault_handler+0x8e>
+	//   user_mem_assert() and env_run() are useful here.
+	//   To change what the user environment runs, modify 'curenv->env_tf'
+	//   (the 'tf' variable points at 'curenv->env_tf').
+
+	// LAB 4: Your code here.
+	if (curenv->env_pgfault_upcall == NULL)
+f010475d:	e8 91 2c 00 00       	call   f01073f3 <cpunum>
+f0104762:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104765:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f010476b:	83 78 64 00          	cmpl   $0x0,0x64(%eax)
+f010476f:	75 78                	jne    f01047e9 <page_fault_handler+0xa7>
+	tf->tf_eip = (uintptr_t) curenv->env_pgfault_upcall;
+	env_run(curenv);
+
+destroy_due_to_page_fault:
+	// Destroy the environment that caused the fault.
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104771:	8b 7b 30             	mov    0x30(%ebx),%edi
+		curenv->env_id, fault_va, tf->tf_eip);
+f0104774:	e8 7a 2c 00 00       	call   f01073f3 <cpunum>
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104779:	57                   	push   %edi
+f010477a:	56                   	push   %esi
+		curenv->env_id, fault_va, tf->tf_eip);
+f010477b:	6b c0 74             	imul   $0x74,%eax,%eax
+	cprintf("[%08x] user fault va %08x ip %08x\n",
+f010477e:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0104784:	ff 70 48             	push   0x48(%eax)
+f0104787:	68 a0 c1 10 f0       	push   $0xf010c1a0
+f010478c:	e8 50 fc ff ff       	call   f01043e1 <cprintf>
+	print_trapframe(tf);
+f0104791:	89 1c 24             	mov    %ebx,(%esp)
+f0104794:	e8 0d fe ff ff       	call   f01045a6 <print_trapframe>
+	env_destroy(curenv);
+f0104799:	e8 55 2c 00 00       	call   f01073f3 <cpunum>
+f010479e:	83 c4 04             	add    $0x4,%esp
+f01047a1:	6b c0 74             	imul   $0x74,%eax,%eax
+f01047a4:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f01047aa:	e8 50 f9 ff ff       	call   f01040ff <env_destroy>
+
+}
+f01047af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01047b2:	5b                   	pop    %ebx
+f01047b3:	5e                   	pop    %esi
+f01047b4:	5f                   	pop    %edi
+f01047b5:	5d                   	pop    %ebp
+f01047b6:	c3                   	ret
+	assert(tf->tf_cs & 3); /* or */ assert(tf->tf_err & FEC_U);
+f01047b7:	68 d9 bf 10 f0       	push   $0xf010bfd9
+f01047bc:	68 25 aa 10 f0       	push   $0xf010aa25
+f01047c1:	68 4d 01 00 00       	push   $0x14d
+f01047c6:	68 e7 bf 10 f0       	push   $0xf010bfe7
+f01047cb:	e8 79 b8 ff ff       	call   f0100049 <_panic>
+f01047d0:	68 f3 bf 10 f0       	push   $0xf010bff3
+f01047d5:	68 25 aa 10 f0       	push   $0xf010aa25
+f01047da:	68 4d 01 00 00       	push   $0x14d
+f01047df:	68 e7 bf 10 f0       	push   $0xf010bfe7
+f01047e4:	e8 60 b8 ff ff       	call   f0100049 <_panic>
+	if (tf->tf_esp >= USTACKTOP - PGSIZE && tf->tf_esp < USTACKTOP) {
+f01047e9:	8b 43 3c             	mov    0x3c(%ebx),%eax
+f01047ec:	8d 90 00 30 40 11    	lea    0x11403000(%eax),%edx
+		utf = (struct UTrapframe *) (UXSTACKTOP - sizeof(*utf));
+f01047f2:	bf cc ff bf ee       	mov    $0xeebfffcc,%edi
+	if (tf->tf_esp >= USTACKTOP - PGSIZE && tf->tf_esp < USTACKTOP) {
+f01047f7:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+f01047fd:	76 05                	jbe    f0104804 <page_fault_handler+0xc2>
+		utf = (struct UTrapframe *) (tf->tf_esp - 4 - sizeof(*utf));
+f01047ff:	83 e8 38             	sub    $0x38,%eax
+f0104802:	89 c7                	mov    %eax,%edi
+	user_mem_assert(curenv, utf, sizeof(*utf), PTE_W);
+f0104804:	e8 ea 2b 00 00       	call   f01073f3 <cpunum>
+f0104809:	6a 02                	push   $0x2
+f010480b:	6a 34                	push   $0x34
+f010480d:	57                   	push   %edi
+f010480e:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104811:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f0104817:	e8 07 f2 ff ff       	call   f0103a23 <user_mem_assert>
+	utf->utf_fault_va = fault_va;
+f010481c:	89 fa                	mov    %edi,%edx
+f010481e:	89 37                	mov    %esi,(%edi)
+	utf->utf_err = tf->tf_err;
+f0104820:	8b 43 2c             	mov    0x2c(%ebx),%eax
+f0104823:	89 47 04             	mov    %eax,0x4(%edi)
+	utf->utf_regs = tf->tf_regs;
+f0104826:	8d 7f 08             	lea    0x8(%edi),%edi
+f0104829:	b9 08 00 00 00       	mov    $0x8,%ecx
+f010482e:	89 de                	mov    %ebx,%esi
+f0104830:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	utf->utf_eip = tf->tf_eip;
+f0104832:	8b 43 30             	mov    0x30(%ebx),%eax
+f0104835:	89 42 28             	mov    %eax,0x28(%edx)
+	utf->utf_eflags = tf->tf_eflags;
+f0104838:	8b 43 38             	mov    0x38(%ebx),%eax
+f010483b:	89 42 2c             	mov    %eax,0x2c(%edx)
+	utf->utf_esp = tf->tf_esp;
+f010483e:	8b 43 3c             	mov    0x3c(%ebx),%eax
+f0104841:	89 42 30             	mov    %eax,0x30(%edx)
+	tf->tf_esp = (uintptr_t) utf;
+f0104844:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	tf->tf_eip = (uintptr_t) curenv->env_pgfault_upcall;
+f0104847:	e8 a7 2b 00 00       	call   f01073f3 <cpunum>
+f010484c:	6b c0 74             	imul   $0x74,%eax,%eax
+f010484f:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0104855:	8b 40 64             	mov    0x64(%eax),%eax
+f0104858:	89 43 30             	mov    %eax,0x30(%ebx)
+	env_run(curenv);
+f010485b:	e8 93 2b 00 00       	call   f01073f3 <cpunum>
+f0104860:	83 c4 04             	add    $0x4,%esp
+f0104863:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104866:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f010486c:	e8 2d f9 ff ff       	call   f010419e <env_run>
+
+f0104871 <trap>:
+{
+f0104871:	55                   	push   %ebp
+f0104872:	89 e5                	mov    %esp,%ebp
+f0104874:	57                   	push   %edi
+f0104875:	56                   	push   %esi
+f0104876:	8b 75 08             	mov    0x8(%ebp),%esi
+	asm volatile("cld" ::: "cc");
+f0104879:	fc                   	cld
+	if (panicstr)
+f010487a:	83 3d 00 c0 7f f0 00 	cmpl   $0x0,0xf07fc000
+f0104881:	74 01                	je     f0104884 <trap+0x13>
+		asm volatile("hlt");
+f0104883:	f4                   	hlt
+	if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED)
+f0104884:	e8 6a 2b 00 00       	call   f01073f3 <cpunum>
+f0104889:	6b d0 74             	imul   $0x74,%eax,%edx
+f010488c:	83 c2 04             	add    $0x4,%edx
+	asm volatile("lock; xchgl %0, %1"
+f010488f:	b8 01 00 00 00       	mov    $0x1,%eax
+f0104894:	f0 87 82 20 d0 83 f0 	lock xchg %eax,-0xf7c2fe0(%edx)
+f010489b:	83 f8 02             	cmp    $0x2,%eax
+f010489e:	0f 84 de 00 00 00    	je     f0104982 <trap+0x111>
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f01048a4:	9c                   	pushf
+f01048a5:	58                   	pop    %eax
+	assert(!(read_eflags() & FL_IF));
+f01048a6:	f6 c4 02             	test   $0x2,%ah
+f01048a9:	0f 85 e8 00 00 00    	jne    f0104997 <trap+0x126>
+	if ((tf->tf_cs & 3) == 3) {
+f01048af:	0f b7 46 34          	movzwl 0x34(%esi),%eax
+f01048b3:	83 e0 03             	and    $0x3,%eax
+f01048b6:	66 83 f8 03          	cmp    $0x3,%ax
+f01048ba:	0f 84 f0 00 00 00    	je     f01049b0 <trap+0x13f>
+	last_tf = tf;
+f01048c0:	89 35 20 cb 7f f0    	mov    %esi,0xf07fcb20
+	switch (tf->tf_trapno) {
+f01048c6:	8b 46 28             	mov    0x28(%esi),%eax
+f01048c9:	83 f8 0e             	cmp    $0xe,%eax
+f01048cc:	0f 84 83 01 00 00    	je     f0104a55 <trap+0x1e4>
+f01048d2:	83 f8 30             	cmp    $0x30,%eax
+f01048d5:	0f 84 9c 01 00 00    	je     f0104a77 <trap+0x206>
+f01048db:	83 f8 03             	cmp    $0x3,%eax
+f01048de:	0f 84 82 01 00 00    	je     f0104a66 <trap+0x1f5>
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_SPURIOUS) {
+f01048e4:	8b 46 28             	mov    0x28(%esi),%eax
+f01048e7:	83 f8 27             	cmp    $0x27,%eax
+f01048ea:	0f 84 ab 01 00 00    	je     f0104a9b <trap+0x22a>
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TIMER) {
+f01048f0:	83 f8 20             	cmp    $0x20,%eax
+f01048f3:	0f 84 bf 01 00 00    	je     f0104ab8 <trap+0x247>
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_KBD) {
+f01048f9:	83 f8 21             	cmp    $0x21,%eax
+f01048fc:	0f 84 df 01 00 00    	je     f0104ae1 <trap+0x270>
+	} else if (tf->tf_trapno == IRQ_OFFSET + IRQ_SERIAL) {
+f0104902:	83 f8 24             	cmp    $0x24,%eax
+f0104905:	0f 84 e0 01 00 00    	je     f0104aeb <trap+0x27a>
+	if (net_irq && tf->tf_trapno == IRQ_OFFSET + net_irq) {
+f010490b:	0f b6 15 08 80 84 f0 	movzbl 0xf0848008,%edx
+f0104912:	84 d2                	test   %dl,%dl
+f0104914:	74 0e                	je     f0104924 <trap+0xb3>
+f0104916:	0f b6 d2             	movzbl %dl,%edx
+f0104919:	83 c2 20             	add    $0x20,%edx
+f010491c:	39 d0                	cmp    %edx,%eax
+f010491e:	0f 84 d1 01 00 00    	je     f0104af5 <trap+0x284>
+	print_trapframe(tf);
+f0104924:	83 ec 0c             	sub    $0xc,%esp
+f0104927:	56                   	push   %esi
+f0104928:	e8 79 fc ff ff       	call   f01045a6 <print_trapframe>
+	if (tf->tf_cs == GD_KT)
+f010492d:	83 c4 10             	add    $0x10,%esp
+f0104930:	66 83 7e 34 08       	cmpw   $0x8,0x34(%esi)
+f0104935:	0f 84 c4 01 00 00    	je     f0104aff <trap+0x28e>
+		env_destroy(curenv);
+f010493b:	e8 b3 2a 00 00       	call   f01073f3 <cpunum>
+f0104940:	83 ec 0c             	sub    $0xc,%esp
+f0104943:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104946:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f010494c:	e8 ae f7 ff ff       	call   f01040ff <env_destroy>
+		return;
+f0104951:	83 c4 10             	add    $0x10,%esp
+	if (curenv && curenv->env_status == ENV_RUNNING)
+f0104954:	e8 9a 2a 00 00       	call   f01073f3 <cpunum>
+f0104959:	6b c0 74             	imul   $0x74,%eax,%eax
+f010495c:	83 b8 28 d0 83 f0 00 	cmpl   $0x0,-0xf7c2fd8(%eax)
+f0104963:	74 18                	je     f010497d <trap+0x10c>
+f0104965:	e8 89 2a 00 00       	call   f01073f3 <cpunum>
+f010496a:	6b c0 74             	imul   $0x74,%eax,%eax
+f010496d:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0104973:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0104977:	0f 84 99 01 00 00    	je     f0104b16 <trap+0x2a5>
+		sched_yield();
+f010497d:	e8 a2 03 00 00       	call   f0104d24 <sched_yield>
+	spin_lock(&kernel_lock);
+f0104982:	83 ec 0c             	sub    $0xc,%esp
+f0104985:	68 80 64 11 f0       	push   $0xf0116480
+f010498a:	e8 d4 2c 00 00       	call   f0107663 <spin_lock>
+}
+f010498f:	83 c4 10             	add    $0x10,%esp
+f0104992:	e9 0d ff ff ff       	jmp    f01048a4 <trap+0x33>
+	assert(!(read_eflags() & FL_IF));
+f0104997:	68 06 c0 10 f0       	push   $0xf010c006
+f010499c:	68 25 aa 10 f0       	push   $0xf010aa25
+f01049a1:	68 18 01 00 00       	push   $0x118
+f01049a6:	68 e7 bf 10 f0       	push   $0xf010bfe7
+f01049ab:	e8 99 b6 ff ff       	call   f0100049 <_panic>
+		assert(curenv);
+f01049b0:	e8 3e 2a 00 00       	call   f01073f3 <cpunum>
+f01049b5:	6b c0 74             	imul   $0x74,%eax,%eax
+f01049b8:	83 b8 28 d0 83 f0 00 	cmpl   $0x0,-0xf7c2fd8(%eax)
+f01049bf:	74 4e                	je     f0104a0f <trap+0x19e>
+	spin_lock(&kernel_lock);
+f01049c1:	83 ec 0c             	sub    $0xc,%esp
+f01049c4:	68 80 64 11 f0       	push   $0xf0116480
+f01049c9:	e8 95 2c 00 00       	call   f0107663 <spin_lock>
+		if (curenv->env_status == ENV_DYING) {
+f01049ce:	e8 20 2a 00 00       	call   f01073f3 <cpunum>
+f01049d3:	6b c0 74             	imul   $0x74,%eax,%eax
+f01049d6:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f01049dc:	83 c4 10             	add    $0x10,%esp
+f01049df:	83 78 54 01          	cmpl   $0x1,0x54(%eax)
+f01049e3:	74 43                	je     f0104a28 <trap+0x1b7>
+		curenv->env_tf = *tf;
+f01049e5:	e8 09 2a 00 00       	call   f01073f3 <cpunum>
+f01049ea:	6b c0 74             	imul   $0x74,%eax,%eax
+f01049ed:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f01049f3:	b9 11 00 00 00       	mov    $0x11,%ecx
+f01049f8:	89 c7                	mov    %eax,%edi
+f01049fa:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		tf = &curenv->env_tf;
+f01049fc:	e8 f2 29 00 00       	call   f01073f3 <cpunum>
+f0104a01:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104a04:	8b b0 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%esi
+f0104a0a:	e9 b1 fe ff ff       	jmp    f01048c0 <trap+0x4f>
+		assert(curenv);
+f0104a0f:	68 1f c0 10 f0       	push   $0xf010c01f
+f0104a14:	68 25 aa 10 f0       	push   $0xf010aa25
+f0104a19:	68 1f 01 00 00       	push   $0x11f
+f0104a1e:	68 e7 bf 10 f0       	push   $0xf010bfe7
+f0104a23:	e8 21 b6 ff ff       	call   f0100049 <_panic>
+			env_free(curenv);
+f0104a28:	e8 c6 29 00 00       	call   f01073f3 <cpunum>
+f0104a2d:	83 ec 0c             	sub    $0xc,%esp
+f0104a30:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104a33:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f0104a39:	e8 10 f5 ff ff       	call   f0103f4e <env_free>
+			curenv = NULL;
+f0104a3e:	e8 b0 29 00 00       	call   f01073f3 <cpunum>
+f0104a43:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104a46:	c7 80 28 d0 83 f0 00 	movl   $0x0,-0xf7c2fd8(%eax)
+f0104a4d:	00 00 00 
+			sched_yield();
+f0104a50:	e8 cf 02 00 00       	call   f0104d24 <sched_yield>
+		page_fault_handler(tf);
+f0104a55:	83 ec 0c             	sub    $0xc,%esp
+f0104a58:	56                   	push   %esi
+f0104a59:	e8 e4 fc ff ff       	call   f0104742 <page_fault_handler>
+		break;
+f0104a5e:	83 c4 10             	add    $0x10,%esp
+f0104a61:	e9 7e fe ff ff       	jmp    f01048e4 <trap+0x73>
+		monitor(tf);
+f0104a66:	83 ec 0c             	sub    $0xc,%esp
+f0104a69:	56                   	push   %esi
+f0104a6a:	e8 ba c0 ff ff       	call   f0100b29 <monitor>
+		break;
+f0104a6f:	83 c4 10             	add    $0x10,%esp
+f0104a72:	e9 6d fe ff ff       	jmp    f01048e4 <trap+0x73>
+		tf->tf_regs.reg_eax = syscall(
+f0104a77:	83 ec 08             	sub    $0x8,%esp
+f0104a7a:	ff 76 04             	push   0x4(%esi)
+f0104a7d:	ff 36                	push   (%esi)
+f0104a7f:	ff 76 10             	push   0x10(%esi)
+f0104a82:	ff 76 18             	push   0x18(%esi)
+f0104a85:	ff 76 14             	push   0x14(%esi)
+f0104a88:	ff 76 1c             	push   0x1c(%esi)
+f0104a8b:	e8 9d 09 00 00       	call   f010542d <syscall>
+f0104a90:	89 46 1c             	mov    %eax,0x1c(%esi)
+		return;
+f0104a93:	83 c4 20             	add    $0x20,%esp
+f0104a96:	e9 b9 fe ff ff       	jmp    f0104954 <trap+0xe3>
+		cprintf("Spurious interrupt on irq 7\n");
+f0104a9b:	83 ec 0c             	sub    $0xc,%esp
+f0104a9e:	68 26 c0 10 f0       	push   $0xf010c026
+f0104aa3:	e8 39 f9 ff ff       	call   f01043e1 <cprintf>
+		print_trapframe(tf);
+f0104aa8:	89 34 24             	mov    %esi,(%esp)
+f0104aab:	e8 f6 fa ff ff       	call   f01045a6 <print_trapframe>
+		return;
+f0104ab0:	83 c4 10             	add    $0x10,%esp
+f0104ab3:	e9 9c fe ff ff       	jmp    f0104954 <trap+0xe3>
+		if (cpunum() == bootcpu->cpu_id) {
+f0104ab8:	e8 36 29 00 00       	call   f01073f3 <cpunum>
+f0104abd:	89 c2                	mov    %eax,%edx
+f0104abf:	a1 08 d0 83 f0       	mov    0xf083d008,%eax
+f0104ac4:	0f b6 00             	movzbl (%eax),%eax
+f0104ac7:	39 c2                	cmp    %eax,%edx
+f0104ac9:	74 0a                	je     f0104ad5 <trap+0x264>
+		lapic_eoi();
+f0104acb:	e8 6a 2a 00 00       	call   f010753a <lapic_eoi>
+		sched_yield();
+f0104ad0:	e8 4f 02 00 00       	call   f0104d24 <sched_yield>
+			time_tick();
+f0104ad5:	e8 32 5c 00 00       	call   f010a70c <time_tick>
+			ipc_expire();
+f0104ada:	e8 ec 08 00 00       	call   f01053cb <ipc_expire>
+f0104adf:	eb ea                	jmp    f0104acb <trap+0x25a>
+		kbd_intr();
+f0104ae1:	e8 44 bb ff ff       	call   f010062a <kbd_intr>
+		return;
+f0104ae6:	e9 69 fe ff ff       	jmp    f0104954 <trap+0xe3>
+		serial_intr();
+f0104aeb:	e8 1e bb ff ff       	call   f010060e <serial_intr>
+		return;
+f0104af0:	e9 5f fe ff ff       	jmp    f0104954 <trap+0xe3>
+		net_intr();
+f0104af5:	e8 b0 56 00 00       	call   f010a1aa <net_intr>
+		return;
+f0104afa:	e9 55 fe ff ff       	jmp    f0104954 <trap+0xe3>
+		panic("unhandled trap in kernel");
+f0104aff:	83 ec 04             	sub    $0x4,%esp
+f0104b02:	68 43 c0 10 f0       	push   $0xf010c043
+f0104b07:	68 fe 00 00 00       	push   $0xfe
+f0104b0c:	68 e7 bf 10 f0       	push   $0xf010bfe7
+f0104b11:	e8 33 b5 ff ff       	call   f0100049 <_panic>
+		env_run(curenv);
+f0104b16:	e8 d8 28 00 00       	call   f01073f3 <cpunum>
+f0104b1b:	83 ec 0c             	sub    $0xc,%esp
+f0104b1e:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104b21:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f0104b27:	e8 72 f6 ff ff       	call   f010419e <env_run>
+
+f0104b2c <_vector_0>:
+.data
+.align 2
+.global _vectors
+_vectors:
+
+TRAPHANDLER_NOEC(_vector_0, T_DIVIDE)
+f0104b2c:	6a 00                	push   $0x0
+f0104b2e:	6a 00                	push   $0x0
+f0104b30:	e9 01 01 00 00       	jmp    f0104c36 <_alltraps>
+f0104b35:	90                   	nop
+
+f0104b36 <_vector_1>:
+TRAPHANDLER_NOEC(_vector_1, T_DEBUG)
+f0104b36:	6a 00                	push   $0x0
+f0104b38:	6a 01                	push   $0x1
+f0104b3a:	e9 f7 00 00 00       	jmp    f0104c36 <_alltraps>
+f0104b3f:	90                   	nop
+
+f0104b40 <_vector_2>:
+TRAPHANDLER_NOEC(_vector_2, T_NMI)
+f0104b40:	6a 00                	push   $0x0
+f0104b42:	6a 02                	push   $0x2
+f0104b44:	e9 ed 00 00 00       	jmp    f0104c36 <_alltraps>
+f0104b49:	90                   	nop
+
+f0104b4a <_vector_3>:
+TRAPHANDLER_NOEC(_vector_3, T_BRKPT)
+f0104b4a:	6a 00                	push   $0x0
+f0104b4c:	6a 03                	push   $0x3
+f0104b4e:	e9 e3 00 00 00       	jmp    f0104c36 <_alltraps>
+f0104b53:	90                   	nop
+
+f0104b54 <_vector_4>:
+TRAPHANDLER_NOEC(_vector_4, T_OFLOW)
+f0104b54:	6a 00                	push   $0x0
+f0104b56:	6a 04                	push   $0x4
+f0104b58:	e9 d9 00 00 00       	jmp    f0104c36 <_alltraps>
+f0104b5d:	90                   	nop
+
+f0104b5e <_vector_5>:
+TRAPHANDLER_NOEC(_vector_5, T_BOUND)
+f0104b5e:	6a 00                	push   $0x0
+f0104b60:	6a 05                	push   $0x5
+f0104b62:	e9 cf 00 00 00       	jmp    f0104c36 <_alltraps>
+f0104b67:	90                   	nop
+
+f0104b68 <_vector_6>:
+TRAPHANDLER_NOEC(_vector_6, T_ILLOP)
+f0104b68:	6a 00                	push   $0x0
+f0104b6a:	6a 06                	push   $0x6
+f0104b6c:	e9 c5 00 00 00       	jmp    f0104c36 <_alltraps>
+f0104b71:	90                   	nop
+
+f0104b72 <_vector_7>:
+TRAPHANDLER_NOEC(_vector_7, T_DEVICE)
+f0104b72:	6a 00                	push   $0x0
+f0104b74:	6a 07                	push   $0x7
+f0104b76:	e9 bb 00 00 00       	jmp    f0104c36 <_alltraps>
+f0104b7b:	90                   	nop
+
+f0104b7c <_vector_8>:
+     TRAPHANDLER(_vector_8, T_DBLFLT)
+f0104b7c:	6a 08                	push   $0x8
+f0104b7e:	e9 b3 00 00 00       	jmp    f0104c36 <_alltraps>
+f0104b83:	90                   	nop
+
+f0104b84 <_vector_9>:
+TRAPHANDLER_NOEC(_vector_9, 9 /* T_COPROC */)
+f0104b84:	6a 00                	push   $0x0
+f0104b86:	6a 09                	push   $0x9
+f0104b88:	e9 a9 00 00 00       	jmp    f0104c36 <_alltraps>
+f0104b8d:	90                   	nop
+
+f0104b8e <_vector_10>:
+     TRAPHANDLER(_vector_10, T_TSS)
+f0104b8e:	6a 0a                	push   $0xa
+f0104b90:	e9 a1 00 00 00       	jmp    f0104c36 <_alltraps>
+f0104b95:	90                   	nop
+
+f0104b96 <_vector_11>:
+     TRAPHANDLER(_vector_11, T_SEGNP)
+f0104b96:	6a 0b                	push   $0xb
+f0104b98:	e9 99 00 00 00       	jmp    f0104c36 <_alltraps>
+f0104b9d:	90                   	nop
+
+f0104b9e <_vector_12>:
+     TRAPHANDLER(_vector_12, T_STACK)
+f0104b9e:	6a 0c                	push   $0xc
+f0104ba0:	e9 91 00 00 00       	jmp    f0104c36 <_alltraps>
+f0104ba5:	90                   	nop
+
+f0104ba6 <_vector_13>:
+     TRAPHANDLER(_vector_13, T_GPFLT)
+f0104ba6:	6a 0d                	push   $0xd
+f0104ba8:	e9 89 00 00 00       	jmp    f0104c36 <_alltraps>
+f0104bad:	90                   	nop
+
+f0104bae <_vector_14>:
+     TRAPHANDLER(_vector_14, T_PGFLT)
+f0104bae:	6a 0e                	push   $0xe
+f0104bb0:	e9 81 00 00 00       	jmp    f0104c36 <_alltraps>
+f0104bb5:	90                   	nop
+
+f0104bb6 <_vector_15>:
+TRAPHANDLER_NOEC(_vector_15, 15 /* T_RES */)
+f0104bb6:	6a 00                	push   $0x0
+f0104bb8:	6a 0f                	push   $0xf
+f0104bba:	eb 7a                	jmp    f0104c36 <_alltraps>
+
+f0104bbc <_vector_16>:
+TRAPHANDLER_NOEC(_vector_16, T_FPERR)
+f0104bbc:	6a 00                	push   $0x0
+f0104bbe:	6a 10                	push   $0x10
+f0104bc0:	eb 74                	jmp    f0104c36 <_alltraps>
+
+f0104bc2 <_vector_17>:
+TRAPHANDLER_NOEC(_vector_17, T_ALIGN)
+f0104bc2:	6a 00                	push   $0x0
+f0104bc4:	6a 11                	push   $0x11
+f0104bc6:	eb 6e                	jmp    f0104c36 <_alltraps>
+
+f0104bc8 <_vector_18>:
+     TRAPHANDLER(_vector_18, T_MCHK)
+f0104bc8:	6a 12                	push   $0x12
+f0104bca:	eb 6a                	jmp    f0104c36 <_alltraps>
+
+f0104bcc <_vector_19>:
+     TRAPHANDLER(_vector_19, T_SIMDERR)
+f0104bcc:	6a 13                	push   $0x13
+f0104bce:	eb 66                	jmp    f0104c36 <_alltraps>
+
+f0104bd0 <_vector_32>:
+
+.space	GAPSIZE
+
+TRAPHANDLER_NOEC(_vector_32, IRQ_OFFSET + IRQ_TIMER)
+f0104bd0:	6a 00                	push   $0x0
+f0104bd2:	6a 20                	push   $0x20
+f0104bd4:	eb 60                	jmp    f0104c36 <_alltraps>
+
+f0104bd6 <_vector_33>:
+TRAPHANDLER_NOEC(_vector_33, IRQ_OFFSET + IRQ_KBD)
+f0104bd6:	6a 00                	push   $0x0
+f0104bd8:	6a 21                	push   $0x21
+f0104bda:	eb 5a                	jmp    f0104c36 <_alltraps>
+
+f0104bdc <_vector_34>:
+TRAPHANDLER_NOEC(_vector_34, IRQ_OFFSET + 2)
+f0104bdc:	6a 00                	push   $0x0
+f0104bde:	6a 22                	push   $0x22
+f0104be0:	eb 54                	jmp    f0104c36 <_alltraps>
+
+f0104be2 <_vector_35>:
+TRAPHANDLER_NOEC(_vector_35, IRQ_OFFSET + 3)
+f0104be2:	6a 00                	push   $0x0
+f0104be4:	6a 23                	push   $0x23
+f0104be6:	eb 4e                	jmp    f0104c36 <_alltraps>
+
+f0104be8 <_vector_36>:
+TRAPHANDLER_NOEC(_vector_36, IRQ_OFFSET + IRQ_SERIAL)
+f0104be8:	6a 00                	push   $0x0
+f0104bea:	6a 24                	push   $0x24
+f0104bec:	eb 48                	jmp    f0104c36 <_alltraps>
+
+f0104bee <_vector_37>:
+TRAPHANDLER_NOEC(_vector_37, IRQ_OFFSET + 5)
+f0104bee:	6a 00                	push   $0x0
+f0104bf0:	6a 25                	push   $0x25
+f0104bf2:	eb 42                	jmp    f0104c36 <_alltraps>
+
+f0104bf4 <_vector_38>:
+TRAPHANDLER_NOEC(_vector_38, IRQ_OFFSET + 6)
+f0104bf4:	6a 00                	push   $0x0
+f0104bf6:	6a 26                	push   $0x26
+f0104bf8:	eb 3c                	jmp    f0104c36 <_alltraps>
+
+f0104bfa <_vector_39>:
+TRAPHANDLER_NOEC(_vector_39, IRQ_OFFSET + IRQ_SPURIOUS)
+f0104bfa:	6a 00                	push   $0x0
+f0104bfc:	6a 27                	push   $0x27
+f0104bfe:	eb 36                	jmp    f0104c36 <_alltraps>
+
+f0104c00 <_vector_40>:
+TRAPHANDLER_NOEC(_vector_40, IRQ_OFFSET + 8)
+f0104c00:	6a 00                	push   $0x0
+f0104c02:	6a 28                	push   $0x28
+f0104c04:	eb 30                	jmp    f0104c36 <_alltraps>
+
+f0104c06 <_vector_41>:
+TRAPHANDLER_NOEC(_vector_41, IRQ_OFFSET + 9)
+f0104c06:	6a 00                	push   $0x0
+f0104c08:	6a 29                	push   $0x29
+f0104c0a:	eb 2a                	jmp    f0104c36 <_alltraps>
+
+f0104c0c <_vector_42>:
+TRAPHANDLER_NOEC(_vector_42, IRQ_OFFSET + 10)
+f0104c0c:	6a 00                	push   $0x0
+f0104c0e:	6a 2a                	push   $0x2a
+f0104c10:	eb 24                	jmp    f0104c36 <_alltraps>
+
+f0104c12 <_vector_43>:
+TRAPHANDLER_NOEC(_vector_43, IRQ_OFFSET + 11)
+f0104c12:	6a 00                	push   $0x0
+f0104c14:	6a 2b                	push   $0x2b
+f0104c16:	eb 1e                	jmp    f0104c36 <_alltraps>
+
+f0104c18 <_vector_44>:
+TRAPHANDLER_NOEC(_vector_44, IRQ_OFFSET + 12)
+f0104c18:	6a 00                	push   $0x0
+f0104c1a:	6a 2c                	push   $0x2c
+f0104c1c:	eb 18                	jmp    f0104c36 <_alltraps>
+
+f0104c1e <_vector_45>:
+TRAPHANDLER_NOEC(_vector_45, IRQ_OFFSET + 13)
+f0104c1e:	6a 00                	push   $0x0
+f0104c20:	6a 2d                	push   $0x2d
+f0104c22:	eb 12                	jmp    f0104c36 <_alltraps>
+
+f0104c24 <_vector_46>:
+TRAPHANDLER_NOEC(_vector_46, IRQ_OFFSET + IRQ_IDE)
+f0104c24:	6a 00                	push   $0x0
+f0104c26:	6a 2e                	push   $0x2e
+f0104c28:	eb 0c                	jmp    f0104c36 <_alltraps>
+
+f0104c2a <_vector_47>:
+TRAPHANDLER_NOEC(_vector_47, IRQ_OFFSET + 15)
+f0104c2a:	6a 00                	push   $0x0
+f0104c2c:	6a 2f                	push   $0x2f
+f0104c2e:	eb 06                	jmp    f0104c36 <_alltraps>
+
+f0104c30 <_vector_48>:
+TRAPHANDLER_NOEC(_vector_48, T_SYSCALL)
+f0104c30:	6a 00                	push   $0x0
+f0104c32:	6a 30                	push   $0x30
+f0104c34:	eb 00                	jmp    f0104c36 <_alltraps>
+
+f0104c36 <_alltraps>:
+
+.text
+_alltraps:
+	# Construct trapframe on kernel stack. Use *pushl* for
+	# both %ds, %es to fit data layout of struct Trapframe.
+	pushl	%ds
+f0104c36:	1e                   	push   %ds
+	pushl	%es
+f0104c37:	06                   	push   %es
+	pushal
+f0104c38:	60                   	pusha
+
+	# Set registers not automatically loaded from IDT.
+	movw	$GD_KD, %ax
+f0104c39:	66 b8 10 00          	mov    $0x10,%ax
+	movw	%ax, %ds
+f0104c3d:	8e d8                	mov    %eax,%ds
+	movw	%ax, %es
+f0104c3f:	8e c0                	mov    %eax,%es
+
+	# Pass parameter and call trap().
+	pushl	%esp
+f0104c41:	54                   	push   %esp
+	call	trap
+f0104c42:	e8 2a fc ff ff       	call   f0104871 <trap>
+
+f0104c47 <spin>:
+
+	# So that return address still belongs to `kern/trapentry.S`.
+spin:	jmp	spin
+f0104c47:	eb fe                	jmp    f0104c47 <spin>
+
+f0104c49 <sysenter_handler>:
+
+.global sysenter_handler
+.type sysenter_handler, @function
+sysenter_handler:
+	pushl	%edi
+f0104c49:	57                   	push   %edi
+	pushl	%ebx
+f0104c4a:	53                   	push   %ebx
+	pushl	%ecx
+f0104c4b:	51                   	push   %ecx
+	pushl	%edx
+f0104c4c:	52                   	push   %edx
+	pushl	%eax
+f0104c4d:	50                   	push   %eax
+	call	syscall__lock_kernel
+f0104c4e:	e8 ca 15 00 00       	call   f010621d <syscall__lock_kernel>
+
+	# Both %esi and %ebp are callee-saved register.
+	# SYSEXIT will load %eip and %esp from %edx and %ecx respectively.
+	movl	%esi, %edx
+f0104c53:	89 f2                	mov    %esi,%edx
+	movl	%ebp, %ecx
+f0104c55:	89 e9                	mov    %ebp,%ecx
+
+        # SYSEXIT does not restore eflags like IRET, do it manually instead.
+        # [Software Developer's Manual - Volume 2]
+        # If IF = 0, maskable hardware interrupts remain inhibited on the
+        # instruction boundary following an execution of STI.
+        sti
+f0104c57:	fb                   	sti
+	sysexit
+f0104c58:	0f 35                	sysexit
+
+f0104c5a <sched_halt>:
+// Halt this CPU when there is nothing to do. Wait until the
+// timer interrupt wakes it up. This function never returns.
+//
+void
+sched_halt(void)
+{
+f0104c5a:	55                   	push   %ebp
+f0104c5b:	89 e5                	mov    %esp,%ebp
+f0104c5d:	83 ec 08             	sub    $0x8,%esp
+	int i;
+
+	// For debugging and testing purposes, if there are no runnable
+	// environments in the system, then drop into the kernel monitor.
+	for (i = 0; i < NENV; i++) {
+f0104c60:	a1 04 c3 7f f0       	mov    0xf07fc304,%eax
+f0104c65:	8d 50 54             	lea    0x54(%eax),%edx
+f0104c68:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if ((envs[i].env_status == ENV_RUNNABLE ||
+		     envs[i].env_status == ENV_RUNNING ||
+f0104c6d:	8b 02                	mov    (%edx),%eax
+f0104c6f:	83 e8 01             	sub    $0x1,%eax
+		if ((envs[i].env_status == ENV_RUNNABLE ||
+f0104c72:	81 c2 8c 00 00 00    	add    $0x8c,%edx
+f0104c78:	83 f8 02             	cmp    $0x2,%eax
+f0104c7b:	76 3c                	jbe    f0104cb9 <sched_halt+0x5f>
+	for (i = 0; i < NENV; i++) {
+f0104c7d:	83 c1 01             	add    $0x1,%ecx
+f0104c80:	81 f9 00 04 00 00    	cmp    $0x400,%ecx
+f0104c86:	75 e5                	jne    f0104c6d <sched_halt+0x13>
+		     envs[i].env_status == ENV_DYING))
+			break;
+	}
+	if (i == NENV) {
+		cprintf("No runnable environments in the system!\n");
+f0104c88:	83 ec 0c             	sub    $0xc,%esp
+f0104c8b:	68 30 c2 10 f0       	push   $0xf010c230
+f0104c90:	e8 4c f7 ff ff       	call   f01043e1 <cprintf>
+f0104c95:	83 c4 10             	add    $0x10,%esp
+		while (1)
+			monitor(NULL);
+f0104c98:	83 ec 0c             	sub    $0xc,%esp
+f0104c9b:	6a 00                	push   $0x0
+f0104c9d:	e8 87 be ff ff       	call   f0100b29 <monitor>
+f0104ca2:	83 c4 10             	add    $0x10,%esp
+f0104ca5:	eb f1                	jmp    f0104c98 <sched_halt+0x3e>
+f0104ca7:	50                   	push   %eax
+f0104ca8:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0104cad:	6a 48                	push   $0x48
+f0104caf:	68 59 c2 10 f0       	push   $0xf010c259
+f0104cb4:	e8 90 b3 ff ff       	call   f0100049 <_panic>
+	}
+
+	// Mark that no environment is running on this CPU
+	curenv = NULL;
+f0104cb9:	e8 35 27 00 00       	call   f01073f3 <cpunum>
+f0104cbe:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104cc1:	c7 80 28 d0 83 f0 00 	movl   $0x0,-0xf7c2fd8(%eax)
+f0104cc8:	00 00 00 
+	lcr3(PADDR(kern_pgdir));
+f0104ccb:	a1 a8 c2 7f f0       	mov    0xf07fc2a8,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0104cd0:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0104cd5:	76 d0                	jbe    f0104ca7 <sched_halt+0x4d>
+	return (physaddr_t)kva - KERNBASE;
+f0104cd7:	05 00 00 00 10       	add    $0x10000000,%eax
+	asm volatile("movl %0,%%cr3" : : "r" (val));
+f0104cdc:	0f 22 d8             	mov    %eax,%cr3
+
+	// Mark that this CPU is in the HALT state, so that when
+	// timer interupts come in, we know we should re-acquire the
+	// big kernel lock
+	xchg(&thiscpu->cpu_status, CPU_HALTED);
+f0104cdf:	e8 0f 27 00 00       	call   f01073f3 <cpunum>
+f0104ce4:	6b d0 74             	imul   $0x74,%eax,%edx
+f0104ce7:	83 c2 04             	add    $0x4,%edx
+	asm volatile("lock; xchgl %0, %1"
+f0104cea:	b8 02 00 00 00       	mov    $0x2,%eax
+f0104cef:	f0 87 82 20 d0 83 f0 	lock xchg %eax,-0xf7c2fe0(%edx)
+	spin_unlock(&kernel_lock);
+f0104cf6:	83 ec 0c             	sub    $0xc,%esp
+f0104cf9:	68 80 64 11 f0       	push   $0xf0116480
+f0104cfe:	e8 fa 29 00 00       	call   f01076fd <spin_unlock>
+	asm volatile("pause");
+f0104d03:	f3 90                	pause
+		"pushl $0\n"
+		"sti\n"
+		"1:\n"
+		"hlt\n"
+		"jmp 1b\n"
+	: : "a" (thiscpu->cpu_ts.ts_esp0));
+f0104d05:	e8 e9 26 00 00       	call   f01073f3 <cpunum>
+f0104d0a:	6b c0 74             	imul   $0x74,%eax,%eax
+	asm volatile (
+f0104d0d:	8b 80 30 d0 83 f0    	mov    -0xf7c2fd0(%eax),%eax
+f0104d13:	bd 00 00 00 00       	mov    $0x0,%ebp
+f0104d18:	89 c4                	mov    %eax,%esp
+f0104d1a:	6a 00                	push   $0x0
+f0104d1c:	6a 00                	push   $0x0
+f0104d1e:	fb                   	sti
+f0104d1f:	f4                   	hlt
+f0104d20:	eb fd                	jmp    f0104d1f <sched_halt+0xc5>
+}
+f0104d22:	c9                   	leave
+f0104d23:	c3                   	ret
+
+f0104d24 <sched_yield>:
+{
+f0104d24:	55                   	push   %ebp
+f0104d25:	89 e5                	mov    %esp,%ebp
+f0104d27:	53                   	push   %ebx
+f0104d28:	83 ec 04             	sub    $0x4,%esp
+	idle = curenv ?: &envs[-1];
+f0104d2b:	e8 c3 26 00 00       	call   f01073f3 <cpunum>
+f0104d30:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104d33:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0104d39:	85 c0                	test   %eax,%eax
+f0104d3b:	74 2f                	je     f0104d6c <sched_yield+0x48>
+		if (++idle == &envs[NENV])
+f0104d3d:	8b 0d 04 c3 7f f0    	mov    0xf07fc304,%ecx
+f0104d43:	8d 99 00 30 02 00    	lea    0x23000(%ecx),%ebx
+f0104d49:	ba 01 04 00 00       	mov    $0x401,%edx
+	for (int i = 0; i < NENV; i++) {
+f0104d4e:	83 ea 01             	sub    $0x1,%edx
+f0104d51:	74 25                	je     f0104d78 <sched_yield+0x54>
+		if (++idle == &envs[NENV])
+f0104d53:	05 8c 00 00 00       	add    $0x8c,%eax
+			idle = &envs[0];
+f0104d58:	39 c3                	cmp    %eax,%ebx
+f0104d5a:	0f 44 c1             	cmove  %ecx,%eax
+		if (idle->env_status == ENV_RUNNABLE)
+f0104d5d:	83 78 54 02          	cmpl   $0x2,0x54(%eax)
+f0104d61:	75 eb                	jne    f0104d4e <sched_yield+0x2a>
+			env_run(idle);
+f0104d63:	83 ec 0c             	sub    $0xc,%esp
+f0104d66:	50                   	push   %eax
+f0104d67:	e8 32 f4 ff ff       	call   f010419e <env_run>
+	idle = curenv ?: &envs[-1];
+f0104d6c:	a1 04 c3 7f f0       	mov    0xf07fc304,%eax
+f0104d71:	2d 8c 00 00 00       	sub    $0x8c,%eax
+f0104d76:	eb c5                	jmp    f0104d3d <sched_yield+0x19>
+	if (curenv && curenv->env_status == ENV_RUNNING)
+f0104d78:	e8 76 26 00 00       	call   f01073f3 <cpunum>
+f0104d7d:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104d80:	83 b8 28 d0 83 f0 00 	cmpl   $0x0,-0xf7c2fd8(%eax)
+f0104d87:	74 14                	je     f0104d9d <sched_yield+0x79>
+f0104d89:	e8 65 26 00 00       	call   f01073f3 <cpunum>
+f0104d8e:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104d91:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0104d97:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0104d9b:	74 0a                	je     f0104da7 <sched_yield+0x83>
+	sched_halt();
+f0104d9d:	e8 b8 fe ff ff       	call   f0104c5a <sched_halt>
+}
+f0104da2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104da5:	c9                   	leave
+f0104da6:	c3                   	ret
+		env_run(curenv);
+f0104da7:	e8 47 26 00 00       	call   f01073f3 <cpunum>
+f0104dac:	83 ec 0c             	sub    $0xc,%esp
+f0104daf:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104db2:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f0104db8:	e8 e1 f3 ff ff       	call   f010419e <env_run>
+
+f0104dbd <ipc_page_lookup>:
+ipc_page_lookup(void *srcva, unsigned perm)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+
+	if ((uintptr_t) srcva >= UTOP || PGOFF(srcva) != 0)
+f0104dbd:	3d ff ff bf ee       	cmp    $0xeebfffff,%eax
+f0104dc2:	77 65                	ja     f0104e29 <ipc_page_lookup+0x6c>
+{
+f0104dc4:	55                   	push   %ebp
+f0104dc5:	89 e5                	mov    %esp,%ebp
+f0104dc7:	56                   	push   %esi
+f0104dc8:	53                   	push   %ebx
+f0104dc9:	83 ec 10             	sub    $0x10,%esp
+f0104dcc:	89 c3                	mov    %eax,%ebx
+f0104dce:	89 d6                	mov    %edx,%esi
+	if ((uintptr_t) srcva >= UTOP || PGOFF(srcva) != 0)
+f0104dd0:	a9 ff 0f 00 00       	test   $0xfff,%eax
+f0104dd5:	75 58                	jne    f0104e2f <ipc_page_lookup+0x72>
+		return NULL;
+	if (!(perm & PTE_U) || !(perm & PTE_P) || !!(perm & ~PTE_SYSCALL))
+f0104dd7:	81 e2 fd f1 ff ff    	and    $0xfffff1fd,%edx
+		return NULL;
+f0104ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(perm & PTE_U) || !(perm & PTE_P) || !!(perm & ~PTE_SYSCALL))
+f0104de2:	83 fa 05             	cmp    $0x5,%edx
+f0104de5:	75 3b                	jne    f0104e22 <ipc_page_lookup+0x65>
+	pp = page_lookup(curenv->env_pgdir, srcva, &pte);
+f0104de7:	e8 07 26 00 00       	call   f01073f3 <cpunum>
+f0104dec:	83 ec 04             	sub    $0x4,%esp
+f0104def:	8d 55 f4             	lea    -0xc(%ebp),%edx
+f0104df2:	52                   	push   %edx
+f0104df3:	53                   	push   %ebx
+f0104df4:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104df7:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0104dfd:	ff 70 60             	push   0x60(%eax)
+f0104e00:	e8 d3 cc ff ff       	call   f0101ad8 <page_lookup>
+	if (!pp || ((perm & PTE_W) && !(*pte & PTE_W)))
+f0104e05:	83 c4 10             	add    $0x10,%esp
+f0104e08:	85 c0                	test   %eax,%eax
+f0104e0a:	74 16                	je     f0104e22 <ipc_page_lookup+0x65>
+f0104e0c:	f7 c6 02 00 00 00    	test   $0x2,%esi
+f0104e12:	74 0e                	je     f0104e22 <ipc_page_lookup+0x65>
+		return NULL;
+f0104e14:	8b 55 f4             	mov    -0xc(%ebp),%edx
+f0104e17:	f6 02 02             	testb  $0x2,(%edx)
+f0104e1a:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104e1f:	0f 44 c2             	cmove  %edx,%eax
+	return pp;
+}
+f0104e22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0104e25:	5b                   	pop    %ebx
+f0104e26:	5e                   	pop    %esi
+f0104e27:	5d                   	pop    %ebp
+f0104e28:	c3                   	ret
+		return NULL;
+f0104e29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0104e2e:	c3                   	ret
+		return NULL;
+f0104e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104e34:	eb ec                	jmp    f0104e22 <ipc_page_lookup+0x65>
+
+f0104e36 <sys_net_send_sg>:
+//		the end of the packet.
+//	-E_NOT_SUPP if the NIC cannot do what *off asks for.
+static int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+f0104e36:	55                   	push   %ebp
+f0104e37:	89 e5                	mov    %esp,%ebp
+f0104e39:	57                   	push   %edi
+f0104e3a:	56                   	push   %esi
+f0104e3b:	53                   	push   %ebx
+f0104e3c:	81 ec 3c 04 00 00    	sub    $0x43c,%esp
+f0104e42:	89 c3                	mov    %eax,%ebx
+f0104e44:	89 95 c0 fb ff ff    	mov    %edx,-0x440(%ebp)
+	pte_t *pte;
+	uintptr_t va;
+	size_t left, n, length, wlimit;
+	int i, nfrags;
+
+	if (nsg < 1 || nsg > NET_SG_MAX)
+f0104e4a:	8d 42 ff             	lea    -0x1(%edx),%eax
+f0104e4d:	83 f8 3f             	cmp    $0x3f,%eax
+f0104e50:	0f 87 28 02 00 00    	ja     f010507e <sys_net_send_sg+0x248>
+f0104e56:	89 d7                	mov    %edx,%edi
+f0104e58:	89 ce                	mov    %ecx,%esi
+		return -E_INVAL;
+	user_mem_assert(curenv, sg, nsg * sizeof(*sg), 0);
+f0104e5a:	e8 94 25 00 00       	call   f01073f3 <cpunum>
+f0104e5f:	6a 00                	push   $0x0
+f0104e61:	8d 14 fd 00 00 00 00 	lea    0x0(,%edi,8),%edx
+f0104e68:	52                   	push   %edx
+f0104e69:	53                   	push   %ebx
+f0104e6a:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104e6d:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f0104e73:	e8 ab eb ff ff       	call   f0103a23 <user_mem_assert>
+	user_mem_assert(curenv, info, sizeof(*info), PTE_W);
+f0104e78:	e8 76 25 00 00       	call   f01073f3 <cpunum>
+f0104e7d:	6a 02                	push   $0x2
+f0104e7f:	6a 08                	push   $0x8
+f0104e81:	ff 75 08             	push   0x8(%ebp)
+f0104e84:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104e87:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f0104e8d:	e8 91 eb ff ff       	call   f0103a23 <user_mem_assert>
+	o.no_flags = 0;
+f0104e92:	c6 85 e0 fb ff ff 00 	movb   $0x0,-0x420(%ebp)
+	if (off) {
+f0104e99:	83 c4 20             	add    $0x20,%esp
+		o = *off;
+	}
+
+	// Split the pieces at page boundaries.  Checksums may get written
+	// into the first wlimit bytes.
+	wlimit = o.no_flags ? o.no_l4csum + 2 : 0;
+f0104e9c:	c7 85 cc fb ff ff 00 	movl   $0x0,-0x434(%ebp)
+f0104ea3:	00 00 00 
+	if (off) {
+f0104ea6:	85 f6                	test   %esi,%esi
+f0104ea8:	74 40                	je     f0104eea <sys_net_send_sg+0xb4>
+		user_mem_assert(curenv, off, sizeof(*off), 0);
+f0104eaa:	e8 44 25 00 00       	call   f01073f3 <cpunum>
+f0104eaf:	6a 00                	push   $0x0
+f0104eb1:	6a 08                	push   $0x8
+f0104eb3:	56                   	push   %esi
+f0104eb4:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104eb7:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f0104ebd:	e8 61 eb ff ff       	call   f0103a23 <user_mem_assert>
+		o = *off;
+f0104ec2:	8b 06                	mov    (%esi),%eax
+f0104ec4:	8b 4e 04             	mov    0x4(%esi),%ecx
+f0104ec7:	89 85 e0 fb ff ff    	mov    %eax,-0x420(%ebp)
+f0104ecd:	89 8d e4 fb ff ff    	mov    %ecx,-0x41c(%ebp)
+	wlimit = o.no_flags ? o.no_l4csum + 2 : 0;
+f0104ed3:	83 c4 10             	add    $0x10,%esp
+f0104ed6:	84 c0                	test   %al,%al
+f0104ed8:	74 3f                	je     f0104f19 <sys_net_send_sg+0xe3>
+f0104eda:	0f b6 85 e3 fb ff ff 	movzbl -0x41d(%ebp),%eax
+f0104ee1:	83 c0 02             	add    $0x2,%eax
+f0104ee4:	89 85 cc fb ff ff    	mov    %eax,-0x434(%ebp)
+	nfrags = 0;
+f0104eea:	bf 00 00 00 00       	mov    $0x0,%edi
+	length = 0;
+	for (i = 0; i < nsg; i++) {
+f0104eef:	b8 00 00 00 00       	mov    $0x0,%eax
+	length = 0;
+f0104ef4:	c7 85 d0 fb ff ff 00 	movl   $0x0,-0x430(%ebp)
+f0104efb:	00 00 00 
+		va = (uintptr_t) sg[i].sg_va;
+f0104efe:	8b 34 c3             	mov    (%ebx,%eax,8),%esi
+		for (left = sg[i].sg_len; left > 0; left -= n, va += n) {
+f0104f01:	8b 54 c3 04          	mov    0x4(%ebx,%eax,8),%edx
+f0104f05:	89 95 d4 fb ff ff    	mov    %edx,-0x42c(%ebp)
+f0104f0b:	89 85 c8 fb ff ff    	mov    %eax,-0x438(%ebp)
+f0104f11:	89 9d c4 fb ff ff    	mov    %ebx,-0x43c(%ebp)
+f0104f17:	eb 3a                	jmp    f0104f53 <sys_net_send_sg+0x11d>
+	wlimit = o.no_flags ? o.no_l4csum + 2 : 0;
+f0104f19:	c7 85 cc fb ff ff 00 	movl   $0x0,-0x434(%ebp)
+f0104f20:	00 00 00 
+f0104f23:	eb c5                	jmp    f0104eea <sys_net_send_sg+0xb4>
+			n = MIN(left, PGSIZE - PGOFF(va));
+			if (va >= UTOP || nfrags == ARRAY_SIZE(frags)
+			    || !(pp = page_lookup(curenv->env_pgdir, (void *) va, &pte))
+			    || (length < wlimit && !(*pte & PTE_W)))
+				return -E_INVAL;
+			frags[nfrags].pp = pp;
+f0104f25:	89 84 fd e8 fb ff ff 	mov    %eax,-0x418(%ebp,%edi,8)
+			frags[nfrags].off = PGOFF(va);
+f0104f2c:	89 f0                	mov    %esi,%eax
+f0104f2e:	66 25 ff 0f          	and    $0xfff,%ax
+f0104f32:	66 89 84 fd ec fb ff 	mov    %ax,-0x414(%ebp,%edi,8)
+f0104f39:	ff 
+			frags[nfrags].len = n;
+f0104f3a:	66 89 9c fd ee fb ff 	mov    %bx,-0x412(%ebp,%edi,8)
+f0104f41:	ff 
+			nfrags++;
+f0104f42:	83 c7 01             	add    $0x1,%edi
+			length += n;
+f0104f45:	01 9d d0 fb ff ff    	add    %ebx,-0x430(%ebp)
+		for (left = sg[i].sg_len; left > 0; left -= n, va += n) {
+f0104f4b:	29 9d d4 fb ff ff    	sub    %ebx,-0x42c(%ebp)
+f0104f51:	01 de                	add    %ebx,%esi
+f0104f53:	83 bd d4 fb ff ff 00 	cmpl   $0x0,-0x42c(%ebp)
+f0104f5a:	0f 84 88 00 00 00    	je     f0104fe8 <sys_net_send_sg+0x1b2>
+			n = MIN(left, PGSIZE - PGOFF(va));
+f0104f60:	89 f0                	mov    %esi,%eax
+f0104f62:	25 ff 0f 00 00       	and    $0xfff,%eax
+f0104f67:	bb 00 10 00 00       	mov    $0x1000,%ebx
+f0104f6c:	29 c3                	sub    %eax,%ebx
+f0104f6e:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+f0104f74:	39 c3                	cmp    %eax,%ebx
+f0104f76:	0f 47 d8             	cmova  %eax,%ebx
+			if (va >= UTOP || nfrags == ARRAY_SIZE(frags)
+f0104f79:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f0104f7f:	0f 87 00 01 00 00    	ja     f0105085 <sys_net_send_sg+0x24f>
+f0104f85:	81 ff 80 00 00 00    	cmp    $0x80,%edi
+f0104f8b:	0f 84 f4 00 00 00    	je     f0105085 <sys_net_send_sg+0x24f>
+			    || !(pp = page_lookup(curenv->env_pgdir, (void *) va, &pte))
+f0104f91:	e8 5d 24 00 00       	call   f01073f3 <cpunum>
+f0104f96:	83 ec 04             	sub    $0x4,%esp
+f0104f99:	8d 8d dc fb ff ff    	lea    -0x424(%ebp),%ecx
+f0104f9f:	51                   	push   %ecx
+f0104fa0:	56                   	push   %esi
+f0104fa1:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104fa4:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0104faa:	ff 70 60             	push   0x60(%eax)
+f0104fad:	e8 26 cb ff ff       	call   f0101ad8 <page_lookup>
+f0104fb2:	83 c4 10             	add    $0x10,%esp
+f0104fb5:	85 c0                	test   %eax,%eax
+f0104fb7:	0f 84 d5 00 00 00    	je     f0105092 <sys_net_send_sg+0x25c>
+			    || (length < wlimit && !(*pte & PTE_W)))
+f0104fbd:	8b 8d cc fb ff ff    	mov    -0x434(%ebp),%ecx
+f0104fc3:	39 8d d0 fb ff ff    	cmp    %ecx,-0x430(%ebp)
+f0104fc9:	0f 83 56 ff ff ff    	jae    f0104f25 <sys_net_send_sg+0xef>
+f0104fcf:	8b 95 dc fb ff ff    	mov    -0x424(%ebp),%edx
+f0104fd5:	f6 02 02             	testb  $0x2,(%edx)
+f0104fd8:	0f 85 47 ff ff ff    	jne    f0104f25 <sys_net_send_sg+0xef>
+				return -E_INVAL;
+f0104fde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0104fe3:	e9 a2 00 00 00       	jmp    f010508a <sys_net_send_sg+0x254>
+	for (i = 0; i < nsg; i++) {
+f0104fe8:	8b 85 c8 fb ff ff    	mov    -0x438(%ebp),%eax
+f0104fee:	8b 9d c4 fb ff ff    	mov    -0x43c(%ebp),%ebx
+f0104ff4:	83 c0 01             	add    $0x1,%eax
+f0104ff7:	39 85 c0 fb ff ff    	cmp    %eax,-0x440(%ebp)
+f0104ffd:	0f 85 fb fe ff ff    	jne    f0104efe <sys_net_send_sg+0xc8>
+		}
+	}
+	if (length == 0
+f0105003:	8b 85 d0 fb ff ff    	mov    -0x430(%ebp),%eax
+f0105009:	85 c0                	test   %eax,%eax
+f010500b:	0f 84 88 00 00 00    	je     f0105099 <sys_net_send_sg+0x263>
+	    || length > (o.no_flags & NET_TSO ? NET_TSO_MAX : NET_FRAME_MAX))
+f0105011:	0f b6 9d e0 fb ff ff 	movzbl -0x420(%ebp),%ebx
+f0105018:	89 da                	mov    %ebx,%edx
+f010501a:	83 e2 04             	and    $0x4,%edx
+f010501d:	0f 85 ca 00 00 00    	jne    f01050ed <sys_net_send_sg+0x2b7>
+f0105023:	3d 3a 23 00 00       	cmp    $0x233a,%eax
+f0105028:	77 76                	ja     f01050a0 <sys_net_send_sg+0x26a>
+		return -E_INVAL;
+	if (o.no_flags
+f010502a:	84 db                	test   %bl,%bl
+f010502c:	0f 85 c7 00 00 00    	jne    f01050f9 <sys_net_send_sg+0x2c3>
+	if ((o.no_flags & NET_TSO)
+	    && (!(o.no_flags & NET_CSUM_IP) || !(o.no_flags & NET_CSUM_L4)
+		|| o.no_hdrlen < o.no_l4csum + 2 || o.no_hdrlen >= length
+		|| o.no_mss == 0 || o.no_hdrlen + o.no_mss > NET_FRAME_MAX))
+		return -E_INVAL;
+	if (o.no_flags & ~net_offloads())
+f0105032:	e8 60 51 00 00       	call   f010a197 <net_offloads>
+		return -E_NOT_SUPP;
+
+	if (net_map_env())
+f0105037:	e8 32 35 00 00       	call   f010856e <net_map_env>
+f010503c:	85 c0                	test   %eax,%eax
+f010503e:	74 13                	je     f0105053 <sys_net_send_sg+0x21d>
+		length = 0;
+	else
+		length = net_packet_tx_frags(frags, nfrags,
+					     o.no_flags ? &o : NULL,
+					     &info->ti_seq);
+	info->ti_done = net_tx_done();
+f0105040:	e8 d1 50 00 00       	call   f010a116 <net_tx_done>
+f0105045:	8b 55 08             	mov    0x8(%ebp),%edx
+f0105048:	89 42 04             	mov    %eax,0x4(%edx)
+	return length;
+f010504b:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+f0105051:	eb 37                	jmp    f010508a <sys_net_send_sg+0x254>
+		length = net_packet_tx_frags(frags, nfrags,
+f0105053:	80 bd e0 fb ff ff 00 	cmpb   $0x0,-0x420(%ebp)
+f010505a:	74 06                	je     f0105062 <sys_net_send_sg+0x22c>
+f010505c:	8d 85 e0 fb ff ff    	lea    -0x420(%ebp),%eax
+f0105062:	ff 75 08             	push   0x8(%ebp)
+f0105065:	50                   	push   %eax
+f0105066:	57                   	push   %edi
+f0105067:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+f010506d:	50                   	push   %eax
+f010506e:	e8 79 50 00 00       	call   f010a0ec <net_packet_tx_frags>
+f0105073:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+f0105079:	83 c4 10             	add    $0x10,%esp
+f010507c:	eb c2                	jmp    f0105040 <sys_net_send_sg+0x20a>
+		return -E_INVAL;
+f010507e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105083:	eb 05                	jmp    f010508a <sys_net_send_sg+0x254>
+				return -E_INVAL;
+f0105085:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+f010508a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010508d:	5b                   	pop    %ebx
+f010508e:	5e                   	pop    %esi
+f010508f:	5f                   	pop    %edi
+f0105090:	5d                   	pop    %ebp
+f0105091:	c3                   	ret
+				return -E_INVAL;
+f0105092:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105097:	eb f1                	jmp    f010508a <sys_net_send_sg+0x254>
+		return -E_INVAL;
+f0105099:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010509e:	eb ea                	jmp    f010508a <sys_net_send_sg+0x254>
+f01050a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01050a5:	eb e3                	jmp    f010508a <sys_net_send_sg+0x254>
+		return -E_INVAL;
+f01050a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01050ac:	eb dc                	jmp    f010508a <sys_net_send_sg+0x254>
+f01050ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01050b3:	eb d5                	jmp    f010508a <sys_net_send_sg+0x254>
+f01050b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01050ba:	eb ce                	jmp    f010508a <sys_net_send_sg+0x254>
+f01050bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01050c1:	eb c7                	jmp    f010508a <sys_net_send_sg+0x254>
+		return -E_INVAL;
+f01050c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01050c8:	eb c0                	jmp    f010508a <sys_net_send_sg+0x254>
+f01050ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01050cf:	eb b9                	jmp    f010508a <sys_net_send_sg+0x254>
+f01050d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01050d6:	eb b2                	jmp    f010508a <sys_net_send_sg+0x254>
+f01050d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01050dd:	eb ab                	jmp    f010508a <sys_net_send_sg+0x254>
+f01050df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01050e4:	eb a4                	jmp    f010508a <sys_net_send_sg+0x254>
+		return -E_INVAL;
+f01050e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01050eb:	eb 9d                	jmp    f010508a <sys_net_send_sg+0x254>
+	    || length > (o.no_flags & NET_TSO ? NET_TSO_MAX : NET_FRAME_MAX))
+f01050ed:	81 bd d0 fb ff ff 00 	cmpl   $0x10000,-0x430(%ebp)
+f01050f4:	00 01 00 
+f01050f7:	77 ed                	ja     f01050e6 <sys_net_send_sg+0x2b0>
+	    && ((o.no_flags & ~(NET_CSUM_IP | NET_CSUM_L4 | NET_TSO))
+f01050f9:	80 fb 07             	cmp    $0x7,%bl
+f01050fc:	77 a9                	ja     f01050a7 <sys_net_send_sg+0x271>
+		|| o.no_l4hdr <= o.no_iphdr || o.no_l4csum < o.no_l4hdr
+f01050fe:	0f b6 8d e2 fb ff ff 	movzbl -0x41e(%ebp),%ecx
+f0105105:	38 8d e1 fb ff ff    	cmp    %cl,-0x41f(%ebp)
+f010510b:	73 a1                	jae    f01050ae <sys_net_send_sg+0x278>
+f010510d:	0f b6 85 e3 fb ff ff 	movzbl -0x41d(%ebp),%eax
+f0105114:	38 c8                	cmp    %cl,%al
+f0105116:	72 9d                	jb     f01050b5 <sys_net_send_sg+0x27f>
+		|| o.no_l4csum + 2 > length))
+f0105118:	0f b6 c0             	movzbl %al,%eax
+f010511b:	8d 48 02             	lea    0x2(%eax),%ecx
+f010511e:	8b b5 d0 fb ff ff    	mov    -0x430(%ebp),%esi
+f0105124:	39 ce                	cmp    %ecx,%esi
+f0105126:	72 94                	jb     f01050bc <sys_net_send_sg+0x286>
+	if ((o.no_flags & NET_TSO)
+f0105128:	84 d2                	test   %dl,%dl
+f010512a:	74 3b                	je     f0105167 <sys_net_send_sg+0x331>
+	    && (!(o.no_flags & NET_CSUM_IP) || !(o.no_flags & NET_CSUM_L4)
+f010512c:	89 da                	mov    %ebx,%edx
+f010512e:	83 e2 03             	and    $0x3,%edx
+f0105131:	80 fa 03             	cmp    $0x3,%dl
+f0105134:	75 8d                	jne    f01050c3 <sys_net_send_sg+0x28d>
+		|| o.no_hdrlen < o.no_l4csum + 2 || o.no_hdrlen >= length
+f0105136:	0f b6 8d e4 fb ff ff 	movzbl -0x41c(%ebp),%ecx
+f010513d:	0f b6 d1             	movzbl %cl,%edx
+f0105140:	83 c0 01             	add    $0x1,%eax
+f0105143:	39 d0                	cmp    %edx,%eax
+f0105145:	7d 83                	jge    f01050ca <sys_net_send_sg+0x294>
+f0105147:	39 f2                	cmp    %esi,%edx
+f0105149:	73 86                	jae    f01050d1 <sys_net_send_sg+0x29b>
+		|| o.no_mss == 0 || o.no_hdrlen + o.no_mss > NET_FRAME_MAX))
+f010514b:	0f b7 85 e6 fb ff ff 	movzwl -0x41a(%ebp),%eax
+f0105152:	66 85 c0             	test   %ax,%ax
+f0105155:	74 81                	je     f01050d8 <sys_net_send_sg+0x2a2>
+f0105157:	0f b7 c0             	movzwl %ax,%eax
+f010515a:	01 d0                	add    %edx,%eax
+f010515c:	3d 3a 23 00 00       	cmp    $0x233a,%eax
+f0105161:	0f 8f 78 ff ff ff    	jg     f01050df <sys_net_send_sg+0x2a9>
+	if (o.no_flags & ~net_offloads())
+f0105167:	e8 2b 50 00 00       	call   f010a197 <net_offloads>
+f010516c:	f7 d0                	not    %eax
+f010516e:	0f b6 d3             	movzbl %bl,%edx
+f0105171:	85 d0                	test   %edx,%eax
+f0105173:	0f 84 be fe ff ff    	je     f0105037 <sys_net_send_sg+0x201>
+		return -E_NOT_SUPP;
+f0105179:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+f010517e:	e9 07 ff ff ff       	jmp    f010508a <sys_net_send_sg+0x254>
+
+f0105183 <sys_ipc_try_sendv>:
+{
+f0105183:	55                   	push   %ebp
+f0105184:	89 e5                	mov    %esp,%ebp
+f0105186:	57                   	push   %edi
+f0105187:	56                   	push   %esi
+f0105188:	53                   	push   %ebx
+f0105189:	81 ec 2c 04 00 00    	sub    $0x42c,%esp
+f010518f:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+f0105195:	89 95 d0 fb ff ff    	mov    %edx,-0x430(%ebp)
+f010519b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (npages < 0 || npages > IPC_MAXPAGES)
+f010519e:	81 fb 80 00 00 00    	cmp    $0x80,%ebx
+f01051a4:	0f 87 be 01 00 00    	ja     f0105368 <sys_ipc_try_sendv+0x1e5>
+f01051aa:	89 ce                	mov    %ecx,%esi
+	user_mem_assert(curenv, upages, npages * sizeof(uintptr_t), PTE_U);
+f01051ac:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+f01051b3:	e8 3b 22 00 00       	call   f01073f3 <cpunum>
+f01051b8:	6a 04                	push   $0x4
+f01051ba:	57                   	push   %edi
+f01051bb:	56                   	push   %esi
+f01051bc:	6b c0 74             	imul   $0x74,%eax,%eax
+f01051bf:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f01051c5:	e8 59 e8 ff ff       	call   f0103a23 <user_mem_assert>
+	memmove(pages, upages, npages * sizeof(uintptr_t));
+f01051ca:	83 c4 0c             	add    $0xc,%esp
+f01051cd:	57                   	push   %edi
+f01051ce:	56                   	push   %esi
+f01051cf:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+f01051d5:	50                   	push   %eax
+f01051d6:	e8 60 1c 00 00       	call   f0106e3b <memmove>
+	if ((r = envid2env(envid, &e, false)) < 0)
+f01051db:	83 c4 0c             	add    $0xc,%esp
+f01051de:	6a 00                	push   $0x0
+f01051e0:	8d 85 e4 fb ff ff    	lea    -0x41c(%ebp),%eax
+f01051e6:	50                   	push   %eax
+f01051e7:	ff b5 d4 fb ff ff    	push   -0x42c(%ebp)
+f01051ed:	e8 31 e9 ff ff       	call   f0103b23 <envid2env>
+f01051f2:	83 c4 10             	add    $0x10,%esp
+f01051f5:	85 c0                	test   %eax,%eax
+f01051f7:	0f 88 7e 01 00 00    	js     f010537b <sys_ipc_try_sendv+0x1f8>
+	if (!e->env_ipc_recving)
+f01051fd:	8b 85 e4 fb ff ff    	mov    -0x41c(%ebp),%eax
+f0105203:	80 78 68 00          	cmpb   $0x0,0x68(%eax)
+f0105207:	0f 84 62 01 00 00    	je     f010536f <sys_ipc_try_sendv+0x1ec>
+	if ((uintptr_t) e->env_ipc_dstva < UTOP)
+f010520d:	8b 78 6c             	mov    0x6c(%eax),%edi
+	n = 0;
+f0105210:	c7 85 d4 fb ff ff 00 	movl   $0x0,-0x42c(%ebp)
+f0105217:	00 00 00 
+	if ((uintptr_t) e->env_ipc_dstva < UTOP)
+f010521a:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+f0105220:	77 0e                	ja     f0105230 <sys_ipc_try_sendv+0xad>
+		n = MIN(npages, e->env_ipc_npages);
+f0105222:	8b 40 7c             	mov    0x7c(%eax),%eax
+f0105225:	39 c3                	cmp    %eax,%ebx
+f0105227:	0f 4e c3             	cmovle %ebx,%eax
+f010522a:	89 85 d4 fb ff ff    	mov    %eax,-0x42c(%ebp)
+	for (i = 0; i < n; i++) {
+f0105230:	89 fe                	mov    %edi,%esi
+f0105232:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0105237:	89 bd cc fb ff ff    	mov    %edi,-0x434(%ebp)
+f010523d:	8b bd d4 fb ff ff    	mov    -0x42c(%ebp),%edi
+f0105243:	eb 03                	jmp    f0105248 <sys_ipc_try_sendv+0xc5>
+f0105245:	83 c3 01             	add    $0x1,%ebx
+f0105248:	39 fb                	cmp    %edi,%ebx
+f010524a:	7d 53                	jge    f010529f <sys_ipc_try_sendv+0x11c>
+					       PGOFF(pages[i]))))
+f010524c:	8b 84 9d e8 fd ff ff 	mov    -0x218(%ebp,%ebx,4),%eax
+		if (!(pps[i] = ipc_page_lookup((void *) ROUNDDOWN(pages[i], PGSIZE),
+f0105253:	89 c2                	mov    %eax,%edx
+f0105255:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+f010525b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0105260:	e8 58 fb ff ff       	call   f0104dbd <ipc_page_lookup>
+f0105265:	89 84 9d e8 fb ff ff 	mov    %eax,-0x418(%ebp,%ebx,4)
+f010526c:	85 c0                	test   %eax,%eax
+f010526e:	0f 84 02 01 00 00    	je     f0105376 <sys_ipc_try_sendv+0x1f3>
+		if (!pgdir_walk(e->env_pgdir, dstva + i * PGSIZE, 1))
+f0105274:	83 ec 04             	sub    $0x4,%esp
+f0105277:	6a 01                	push   $0x1
+f0105279:	56                   	push   %esi
+f010527a:	8b 85 e4 fb ff ff    	mov    -0x41c(%ebp),%eax
+f0105280:	ff 70 60             	push   0x60(%eax)
+f0105283:	e8 da c6 ff ff       	call   f0101962 <pgdir_walk>
+f0105288:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f010528e:	83 c4 10             	add    $0x10,%esp
+f0105291:	85 c0                	test   %eax,%eax
+f0105293:	75 b0                	jne    f0105245 <sys_ipc_try_sendv+0xc2>
+			return -E_NO_MEM;
+f0105295:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f010529a:	e9 dc 00 00 00       	jmp    f010537b <sys_ipc_try_sendv+0x1f8>
+	for (i = 0; i < n; i++)
+f010529f:	8b bd cc fb ff ff    	mov    -0x434(%ebp),%edi
+f01052a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01052aa:	8b b5 d4 fb ff ff    	mov    -0x42c(%ebp),%esi
+f01052b0:	39 f3                	cmp    %esi,%ebx
+f01052b2:	7d 4a                	jge    f01052fe <sys_ipc_try_sendv+0x17b>
+		if ((r = page_insert(e->env_pgdir, pps[i], dstva + i * PGSIZE,
+f01052b4:	8b 84 9d e8 fd ff ff 	mov    -0x218(%ebp,%ebx,4),%eax
+f01052bb:	25 ff 0f 00 00       	and    $0xfff,%eax
+f01052c0:	50                   	push   %eax
+f01052c1:	57                   	push   %edi
+f01052c2:	ff b4 9d e8 fb ff ff 	push   -0x418(%ebp,%ebx,4)
+f01052c9:	8b 85 e4 fb ff ff    	mov    -0x41c(%ebp),%eax
+f01052cf:	ff 70 60             	push   0x60(%eax)
+f01052d2:	e8 03 c9 ff ff       	call   f0101bda <page_insert>
+f01052d7:	81 c7 00 10 00 00    	add    $0x1000,%edi
+f01052dd:	83 c4 10             	add    $0x10,%esp
+f01052e0:	85 c0                	test   %eax,%eax
+f01052e2:	78 05                	js     f01052e9 <sys_ipc_try_sendv+0x166>
+	for (i = 0; i < n; i++)
+f01052e4:	83 c3 01             	add    $0x1,%ebx
+f01052e7:	eb c7                	jmp    f01052b0 <sys_ipc_try_sendv+0x12d>
+			panic("sys_ipc_try_sendv: page_insert: %e", r);
+f01052e9:	50                   	push   %eax
+f01052ea:	68 68 c2 10 f0       	push   $0xf010c268
+f01052ef:	68 ec 01 00 00       	push   $0x1ec
+f01052f4:	68 8b c2 10 f0       	push   $0xf010c28b
+f01052f9:	e8 4b ad ff ff       	call   f0100049 <_panic>
+	e->env_ipc_perm = n > 0 ? PGOFF(pages[0]) : 0;
+f01052fe:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105303:	83 bd d4 fb ff ff 00 	cmpl   $0x0,-0x42c(%ebp)
+f010530a:	7e 0b                	jle    f0105317 <sys_ipc_try_sendv+0x194>
+f010530c:	8b 85 e8 fd ff ff    	mov    -0x218(%ebp),%eax
+f0105312:	25 ff 0f 00 00       	and    $0xfff,%eax
+f0105317:	8b 9d e4 fb ff ff    	mov    -0x41c(%ebp),%ebx
+f010531d:	89 43 78             	mov    %eax,0x78(%ebx)
+	e->env_ipc_npages = n;
+f0105320:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+f0105326:	89 43 7c             	mov    %eax,0x7c(%ebx)
+	e->env_ipc_value = value;
+f0105329:	8b 85 d0 fb ff ff    	mov    -0x430(%ebp),%eax
+f010532f:	89 43 70             	mov    %eax,0x70(%ebx)
+	e->env_ipc_from = curenv->env_id;
+f0105332:	e8 bc 20 00 00       	call   f01073f3 <cpunum>
+f0105337:	6b c0 74             	imul   $0x74,%eax,%eax
+f010533a:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105340:	8b 40 48             	mov    0x48(%eax),%eax
+f0105343:	89 43 74             	mov    %eax,0x74(%ebx)
+	e->env_ipc_recving = false;
+f0105346:	c6 43 68 00          	movb   $0x0,0x68(%ebx)
+	return 0;
+f010534a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!e->env_ipc_nowait) {
+f010534f:	80 bb 80 00 00 00 00 	cmpb   $0x0,0x80(%ebx)
+f0105356:	75 23                	jne    f010537b <sys_ipc_try_sendv+0x1f8>
+		e->env_tf.tf_regs.reg_eax = 0;
+f0105358:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+		e->env_status = ENV_RUNNABLE;
+f010535f:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+f0105366:	eb 13                	jmp    f010537b <sys_ipc_try_sendv+0x1f8>
+		return -E_INVAL;
+f0105368:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010536d:	eb 0c                	jmp    f010537b <sys_ipc_try_sendv+0x1f8>
+		return -E_IPC_NOT_RECV;
+f010536f:	b8 f9 ff ff ff       	mov    $0xfffffff9,%eax
+f0105374:	eb 05                	jmp    f010537b <sys_ipc_try_sendv+0x1f8>
+			return -E_INVAL;
+f0105376:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+f010537b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010537e:	5b                   	pop    %ebx
+f010537f:	5e                   	pop    %esi
+f0105380:	5f                   	pop    %edi
+f0105381:	5d                   	pop    %ebp
+f0105382:	c3                   	ret
+
+f0105383 <net_wake>:
+
+// Make the environments blocked in sys_net_wait for any of 'events'
+// runnable again.  Called from the network interrupt handler.
+void
+net_wake(uint32_t events)
+{
+f0105383:	55                   	push   %ebp
+f0105384:	89 e5                	mov    %esp,%ebp
+f0105386:	53                   	push   %ebx
+f0105387:	8b 55 08             	mov    0x8(%ebp),%edx
+	struct Env *e;
+
+	for (e = envs; e < envs + NENV; e++)
+f010538a:	a1 04 c3 7f f0       	mov    0xf07fc304,%eax
+f010538f:	8d 98 00 30 02 00    	lea    0x23000(%eax),%ebx
+f0105395:	eb 19                	jmp    f01053b0 <net_wake+0x2d>
+		if ((e->env_net_wait & events)
+		    && e->env_status == ENV_NOT_RUNNABLE) {
+			e->env_tf.tf_regs.reg_eax = e->env_net_wait & events;
+f0105397:	89 48 1c             	mov    %ecx,0x1c(%eax)
+			e->env_net_wait = 0;
+f010539a:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+f01053a1:	00 00 00 
+			e->env_status = ENV_RUNNABLE;
+f01053a4:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+	for (e = envs; e < envs + NENV; e++)
+f01053ab:	05 8c 00 00 00       	add    $0x8c,%eax
+f01053b0:	39 d8                	cmp    %ebx,%eax
+f01053b2:	74 12                	je     f01053c6 <net_wake+0x43>
+		if ((e->env_net_wait & events)
+f01053b4:	89 d1                	mov    %edx,%ecx
+f01053b6:	23 88 88 00 00 00    	and    0x88(%eax),%ecx
+f01053bc:	74 ed                	je     f01053ab <net_wake+0x28>
+		    && e->env_status == ENV_NOT_RUNNABLE) {
+f01053be:	83 78 54 04          	cmpl   $0x4,0x54(%eax)
+f01053c2:	75 e7                	jne    f01053ab <net_wake+0x28>
+f01053c4:	eb d1                	jmp    f0105397 <net_wake+0x14>
+		}
+}
+f01053c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01053c9:	c9                   	leave
+f01053ca:	c3                   	ret
+
+f01053cb <ipc_expire>:
+
+// Give up the blocked receives whose deadline has passed.
+// Called from the timer interrupt handler.
+void
+ipc_expire(void)
+{
+f01053cb:	55                   	push   %ebp
+f01053cc:	89 e5                	mov    %esp,%ebp
+f01053ce:	53                   	push   %ebx
+f01053cf:	83 ec 04             	sub    $0x4,%esp
+	struct Env *e;
+	unsigned now = time_msec();
+f01053d2:	e8 63 53 00 00       	call   f010a73a <time_msec>
+f01053d7:	89 c3                	mov    %eax,%ebx
+
+	for (e = envs; e < envs + NENV; e++)
+f01053d9:	8b 15 04 c3 7f f0    	mov    0xf07fc304,%edx
+f01053df:	8d 8a 00 30 02 00    	lea    0x23000(%edx),%ecx
+f01053e5:	eb 06                	jmp    f01053ed <ipc_expire+0x22>
+f01053e7:	81 c2 8c 00 00 00    	add    $0x8c,%edx
+f01053ed:	39 ca                	cmp    %ecx,%edx
+f01053ef:	74 37                	je     f0105428 <ipc_expire+0x5d>
+		if (e->env_ipc_recving && !e->env_ipc_nowait
+f01053f1:	80 7a 68 00          	cmpb   $0x0,0x68(%edx)
+f01053f5:	74 f0                	je     f01053e7 <ipc_expire+0x1c>
+f01053f7:	80 ba 80 00 00 00 00 	cmpb   $0x0,0x80(%edx)
+f01053fe:	75 e7                	jne    f01053e7 <ipc_expire+0x1c>
+		    && e->env_ipc_deadline
+f0105400:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+f0105406:	85 c0                	test   %eax,%eax
+f0105408:	74 dd                	je     f01053e7 <ipc_expire+0x1c>
+		    && e->env_status == ENV_NOT_RUNNABLE
+f010540a:	83 7a 54 04          	cmpl   $0x4,0x54(%edx)
+f010540e:	75 d7                	jne    f01053e7 <ipc_expire+0x1c>
+		    && (int32_t) (now - e->env_ipc_deadline) >= 0) {
+f0105410:	39 c3                	cmp    %eax,%ebx
+f0105412:	78 d3                	js     f01053e7 <ipc_expire+0x1c>
+			e->env_ipc_recving = false;
+f0105414:	c6 42 68 00          	movb   $0x0,0x68(%edx)
+			e->env_tf.tf_regs.reg_eax = -E_TIMEOUT;
+f0105418:	c7 42 1c ef ff ff ff 	movl   $0xffffffef,0x1c(%edx)
+			e->env_status = ENV_RUNNABLE;
+f010541f:	c7 42 54 02 00 00 00 	movl   $0x2,0x54(%edx)
+f0105426:	eb bf                	jmp    f01053e7 <ipc_expire+0x1c>
+		}
+}
+f0105428:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010542b:	c9                   	leave
+f010542c:	c3                   	ret
+
+f010542d <syscall>:
+
+// Dispatches to the correct kernel function, passing the arguments.
+int32_t
+syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+f010542d:	55                   	push   %ebp
+f010542e:	89 e5                	mov    %esp,%ebp
+f0105430:	57                   	push   %edi
+f0105431:	56                   	push   %esi
+f0105432:	53                   	push   %ebx
+f0105433:	81 ec 3c 01 00 00    	sub    $0x13c,%esp
+f0105439:	8b 45 08             	mov    0x8(%ebp),%eax
+	// Call the function corresponding to the 'syscallno' parameter.
+	// Return any appropriate return value.
+	// LAB 3: Your code here.
+	int32_t r = 0;
+
+	switch (syscallno) {
+f010543c:	83 f8 17             	cmp    $0x17,%eax
+f010543f:	0f 87 42 0d 00 00    	ja     f0106187 <syscall+0xd5a>
+f0105445:	ff 24 85 a0 c2 10 f0 	jmp    *-0xfef3d60(,%eax,4)
+	user_mem_assert(curenv, s, len, 0);
+f010544c:	e8 a2 1f 00 00       	call   f01073f3 <cpunum>
+f0105451:	6a 00                	push   $0x0
+f0105453:	ff 75 10             	push   0x10(%ebp)
+f0105456:	ff 75 0c             	push   0xc(%ebp)
+f0105459:	6b c0 74             	imul   $0x74,%eax,%eax
+f010545c:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f0105462:	e8 bc e5 ff ff       	call   f0103a23 <user_mem_assert>
+	cprintf("%.*s", len, s);
+f0105467:	83 c4 0c             	add    $0xc,%esp
+f010546a:	ff 75 0c             	push   0xc(%ebp)
+f010546d:	ff 75 10             	push   0x10(%ebp)
+f0105470:	68 9a c2 10 f0       	push   $0xf010c29a
+f0105475:	e8 67 ef ff ff       	call   f01043e1 <cprintf>
+}
+f010547a:	83 c4 10             	add    $0x10,%esp
+	int32_t r = 0;
+f010547d:	c7 85 d4 fe ff ff 00 	movl   $0x0,-0x12c(%ebp)
+f0105484:	00 00 00 
+		break;
+	default:
+		return -E_INVAL;
+	}
+	return r;
+}
+f0105487:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+f010548d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105490:	5b                   	pop    %ebx
+f0105491:	5e                   	pop    %esi
+f0105492:	5f                   	pop    %edi
+f0105493:	5d                   	pop    %ebp
+f0105494:	c3                   	ret
+	return cons_getc();
+f0105495:	e8 a2 b1 ff ff       	call   f010063c <cons_getc>
+f010549a:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+		break;
+f01054a0:	eb e5                	jmp    f0105487 <syscall+0x5a>
+	return curenv->env_id;
+f01054a2:	e8 4c 1f 00 00       	call   f01073f3 <cpunum>
+f01054a7:	6b c0 74             	imul   $0x74,%eax,%eax
+f01054aa:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f01054b0:	8b 40 48             	mov    0x48(%eax),%eax
+f01054b3:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+		break;
+f01054b9:	eb cc                	jmp    f0105487 <syscall+0x5a>
+	if ((r = envid2env(envid, &e, 1)) < 0)
+f01054bb:	83 ec 04             	sub    $0x4,%esp
+f01054be:	6a 01                	push   $0x1
+f01054c0:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f01054c6:	50                   	push   %eax
+f01054c7:	ff 75 0c             	push   0xc(%ebp)
+f01054ca:	e8 54 e6 ff ff       	call   f0103b23 <envid2env>
+f01054cf:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+f01054d5:	83 c4 10             	add    $0x10,%esp
+f01054d8:	85 c0                	test   %eax,%eax
+f01054da:	78 ab                	js     f0105487 <syscall+0x5a>
+	env_destroy(e);
+f01054dc:	83 ec 0c             	sub    $0xc,%esp
+f01054df:	ff b5 e8 fe ff ff    	push   -0x118(%ebp)
+f01054e5:	e8 15 ec ff ff       	call   f01040ff <env_destroy>
+	return 0;
+f01054ea:	83 c4 10             	add    $0x10,%esp
+f01054ed:	c7 85 d4 fe ff ff 00 	movl   $0x0,-0x12c(%ebp)
+f01054f4:	00 00 00 
+		break;
+f01054f7:	eb 8e                	jmp    f0105487 <syscall+0x5a>
+	r = envid2env(envid, &e, true);
+f01054f9:	83 ec 04             	sub    $0x4,%esp
+f01054fc:	6a 01                	push   $0x1
+f01054fe:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0105504:	50                   	push   %eax
+f0105505:	ff 75 0c             	push   0xc(%ebp)
+f0105508:	e8 16 e6 ff ff       	call   f0103b23 <envid2env>
+f010550d:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+	if (r < 0)
+f0105513:	83 c4 10             	add    $0x10,%esp
+f0105516:	85 c0                	test   %eax,%eax
+f0105518:	0f 88 69 ff ff ff    	js     f0105487 <syscall+0x5a>
+	if ((uintptr_t) va >= UTOP || PGOFF(va) != 0) {
+f010551e:	81 7d 10 ff ff bf ee 	cmpl   $0xeebfffff,0x10(%ebp)
+f0105525:	77 60                	ja     f0105587 <syscall+0x15a>
+f0105527:	f7 45 10 ff 0f 00 00 	testl  $0xfff,0x10(%ebp)
+f010552e:	75 66                	jne    f0105596 <syscall+0x169>
+	if (!(perm & PTE_U) || !(perm & PTE_P) || !!(perm & ~PTE_SYSCALL)) {
+f0105530:	8b 45 14             	mov    0x14(%ebp),%eax
+f0105533:	25 fd f1 ff ff       	and    $0xfffff1fd,%eax
+f0105538:	83 f8 05             	cmp    $0x5,%eax
+f010553b:	75 68                	jne    f01055a5 <syscall+0x178>
+	pp = page_alloc(ALLOC_ZERO);
+f010553d:	83 ec 0c             	sub    $0xc,%esp
+f0105540:	6a 01                	push   $0x1
+f0105542:	e8 2b c3 ff ff       	call   f0101872 <page_alloc>
+f0105547:	89 c3                	mov    %eax,%ebx
+	if (pp == NULL) {
+f0105549:	83 c4 10             	add    $0x10,%esp
+f010554c:	85 c0                	test   %eax,%eax
+f010554e:	74 64                	je     f01055b4 <syscall+0x187>
+	r = page_insert(e->env_pgdir, pp, va, perm);
+f0105550:	ff 75 14             	push   0x14(%ebp)
+f0105553:	ff 75 10             	push   0x10(%ebp)
+f0105556:	50                   	push   %eax
+f0105557:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f010555d:	ff 70 60             	push   0x60(%eax)
+f0105560:	e8 75 c6 ff ff       	call   f0101bda <page_insert>
+f0105565:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+	if (r < 0) {
+f010556b:	83 c4 10             	add    $0x10,%esp
+f010556e:	85 c0                	test   %eax,%eax
+f0105570:	0f 89 11 ff ff ff    	jns    f0105487 <syscall+0x5a>
+		page_free(pp);
+f0105576:	83 ec 0c             	sub    $0xc,%esp
+f0105579:	53                   	push   %ebx
+f010557a:	e8 65 c3 ff ff       	call   f01018e4 <page_free>
+		goto exit;
+f010557f:	83 c4 10             	add    $0x10,%esp
+f0105582:	e9 00 ff ff ff       	jmp    f0105487 <syscall+0x5a>
+		r = -E_INVAL;
+f0105587:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f010558e:	ff ff ff 
+f0105591:	e9 f1 fe ff ff       	jmp    f0105487 <syscall+0x5a>
+f0105596:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f010559d:	ff ff ff 
+f01055a0:	e9 e2 fe ff ff       	jmp    f0105487 <syscall+0x5a>
+		r = -E_INVAL;
+f01055a5:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f01055ac:	ff ff ff 
+f01055af:	e9 d3 fe ff ff       	jmp    f0105487 <syscall+0x5a>
+		r = -E_NO_MEM;
+f01055b4:	c7 85 d4 fe ff ff fc 	movl   $0xfffffffc,-0x12c(%ebp)
+f01055bb:	ff ff ff 
+		break;
+f01055be:	e9 c4 fe ff ff       	jmp    f0105487 <syscall+0x5a>
+	r = envid2env(srcenvid, &src, true);
+f01055c3:	83 ec 04             	sub    $0x4,%esp
+f01055c6:	6a 01                	push   $0x1
+f01055c8:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+f01055ce:	50                   	push   %eax
+f01055cf:	ff 75 0c             	push   0xc(%ebp)
+f01055d2:	e8 4c e5 ff ff       	call   f0103b23 <envid2env>
+f01055d7:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+	if (r < 0)
+f01055dd:	83 c4 10             	add    $0x10,%esp
+f01055e0:	85 c0                	test   %eax,%eax
+f01055e2:	0f 88 9f fe ff ff    	js     f0105487 <syscall+0x5a>
+	r = envid2env(dstenvid, &dst, true);
+f01055e8:	83 ec 04             	sub    $0x4,%esp
+f01055eb:	6a 01                	push   $0x1
+f01055ed:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+f01055f3:	50                   	push   %eax
+f01055f4:	ff 75 14             	push   0x14(%ebp)
+f01055f7:	e8 27 e5 ff ff       	call   f0103b23 <envid2env>
+f01055fc:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+	if (r < 0)
+f0105602:	83 c4 10             	add    $0x10,%esp
+f0105605:	85 c0                	test   %eax,%eax
+f0105607:	0f 88 7a fe ff ff    	js     f0105487 <syscall+0x5a>
+	if ((uintptr_t) srcva >= UTOP || PGOFF(srcva) != 0 ||
+f010560d:	81 7d 10 ff ff bf ee 	cmpl   $0xeebfffff,0x10(%ebp)
+f0105614:	0f 87 82 00 00 00    	ja     f010569c <syscall+0x26f>
+f010561a:	81 7d 18 ff ff bf ee 	cmpl   $0xeebfffff,0x18(%ebp)
+f0105621:	0f 87 84 00 00 00    	ja     f01056ab <syscall+0x27e>
+	    (uintptr_t) dstva >= UTOP || PGOFF(dstva) != 0) {
+f0105627:	8b 45 18             	mov    0x18(%ebp),%eax
+f010562a:	0b 45 10             	or     0x10(%ebp),%eax
+f010562d:	a9 ff 0f 00 00       	test   $0xfff,%eax
+f0105632:	0f 85 82 00 00 00    	jne    f01056ba <syscall+0x28d>
+	pp = page_lookup(src->env_pgdir, srcva, &pte);
+f0105638:	83 ec 04             	sub    $0x4,%esp
+f010563b:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0105641:	50                   	push   %eax
+f0105642:	ff 75 10             	push   0x10(%ebp)
+f0105645:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+f010564b:	ff 70 60             	push   0x60(%eax)
+f010564e:	e8 85 c4 ff ff       	call   f0101ad8 <page_lookup>
+	if (pp == NULL) {
+f0105653:	83 c4 10             	add    $0x10,%esp
+f0105656:	85 c0                	test   %eax,%eax
+f0105658:	74 6f                	je     f01056c9 <syscall+0x29c>
+	if (!(perm & PTE_U) || !(perm & PTE_P) || !!(perm & ~PTE_SYSCALL)) {
+f010565a:	8b 55 1c             	mov    0x1c(%ebp),%edx
+f010565d:	81 e2 fd f1 ff ff    	and    $0xfffff1fd,%edx
+f0105663:	83 fa 05             	cmp    $0x5,%edx
+f0105666:	75 70                	jne    f01056d8 <syscall+0x2ab>
+	if ((perm & PTE_W) && !(*pte & PTE_W)) {
+f0105668:	f6 45 1c 02          	testb  $0x2,0x1c(%ebp)
+f010566c:	74 0b                	je     f0105679 <syscall+0x24c>
+f010566e:	8b 95 e8 fe ff ff    	mov    -0x118(%ebp),%edx
+f0105674:	f6 02 02             	testb  $0x2,(%edx)
+f0105677:	74 6e                	je     f01056e7 <syscall+0x2ba>
+	r = page_insert(dst->env_pgdir, pp, dstva, perm);
+f0105679:	ff 75 1c             	push   0x1c(%ebp)
+f010567c:	ff 75 18             	push   0x18(%ebp)
+f010567f:	50                   	push   %eax
+f0105680:	8b 85 e4 fe ff ff    	mov    -0x11c(%ebp),%eax
+f0105686:	ff 70 60             	push   0x60(%eax)
+f0105689:	e8 4c c5 ff ff       	call   f0101bda <page_insert>
+f010568e:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+exit:
+f0105694:	83 c4 10             	add    $0x10,%esp
+f0105697:	e9 eb fd ff ff       	jmp    f0105487 <syscall+0x5a>
+		r = -E_INVAL;
+f010569c:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f01056a3:	ff ff ff 
+f01056a6:	e9 dc fd ff ff       	jmp    f0105487 <syscall+0x5a>
+f01056ab:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f01056b2:	ff ff ff 
+f01056b5:	e9 cd fd ff ff       	jmp    f0105487 <syscall+0x5a>
+f01056ba:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f01056c1:	ff ff ff 
+f01056c4:	e9 be fd ff ff       	jmp    f0105487 <syscall+0x5a>
+		r = -E_INVAL;
+f01056c9:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f01056d0:	ff ff ff 
+f01056d3:	e9 af fd ff ff       	jmp    f0105487 <syscall+0x5a>
+		r = -E_INVAL;
+f01056d8:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f01056df:	ff ff ff 
+f01056e2:	e9 a0 fd ff ff       	jmp    f0105487 <syscall+0x5a>
+		r = -E_INVAL;
+f01056e7:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f01056ee:	ff ff ff 
+		break;
+f01056f1:	e9 91 fd ff ff       	jmp    f0105487 <syscall+0x5a>
+	r = envid2env(envid, &e, true);
+f01056f6:	83 ec 04             	sub    $0x4,%esp
+f01056f9:	6a 01                	push   $0x1
+f01056fb:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0105701:	50                   	push   %eax
+f0105702:	ff 75 0c             	push   0xc(%ebp)
+f0105705:	e8 19 e4 ff ff       	call   f0103b23 <envid2env>
+f010570a:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+	if (r < 0)
+f0105710:	83 c4 10             	add    $0x10,%esp
+f0105713:	85 c0                	test   %eax,%eax
+f0105715:	0f 88 6c fd ff ff    	js     f0105487 <syscall+0x5a>
+	if ((uintptr_t) va >= UTOP || PGOFF(va) != 0) {
+f010571b:	81 7d 10 ff ff bf ee 	cmpl   $0xeebfffff,0x10(%ebp)
+f0105722:	77 25                	ja     f0105749 <syscall+0x31c>
+f0105724:	f7 45 10 ff 0f 00 00 	testl  $0xfff,0x10(%ebp)
+f010572b:	75 2b                	jne    f0105758 <syscall+0x32b>
+	page_remove(e->env_pgdir, va);
+f010572d:	83 ec 08             	sub    $0x8,%esp
+f0105730:	ff 75 10             	push   0x10(%ebp)
+f0105733:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f0105739:	ff 70 60             	push   0x60(%eax)
+f010573c:	e8 53 c4 ff ff       	call   f0101b94 <page_remove>
+f0105741:	83 c4 10             	add    $0x10,%esp
+f0105744:	e9 3e fd ff ff       	jmp    f0105487 <syscall+0x5a>
+		r = -E_INVAL;
+f0105749:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f0105750:	ff ff ff 
+f0105753:	e9 2f fd ff ff       	jmp    f0105487 <syscall+0x5a>
+f0105758:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f010575f:	ff ff ff 
+		break;
+f0105762:	e9 20 fd ff ff       	jmp    f0105487 <syscall+0x5a>
+	r = env_alloc(&e, curenv->env_id);
+f0105767:	e8 87 1c 00 00       	call   f01073f3 <cpunum>
+f010576c:	83 ec 08             	sub    $0x8,%esp
+f010576f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105772:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105778:	ff 70 48             	push   0x48(%eax)
+f010577b:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0105781:	50                   	push   %eax
+f0105782:	e8 bf e4 ff ff       	call   f0103c46 <env_alloc>
+f0105787:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+	if (r < 0)
+f010578d:	83 c4 10             	add    $0x10,%esp
+f0105790:	85 c0                	test   %eax,%eax
+f0105792:	0f 88 ef fc ff ff    	js     f0105487 <syscall+0x5a>
+	e->env_status = ENV_NOT_RUNNABLE;
+f0105798:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f010579e:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	e->env_tf = curenv->env_tf;
+f01057a5:	e8 49 1c 00 00       	call   f01073f3 <cpunum>
+f01057aa:	6b c0 74             	imul   $0x74,%eax,%eax
+f01057ad:	8b b0 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%esi
+f01057b3:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f01057b9:	b9 11 00 00 00       	mov    $0x11,%ecx
+f01057be:	89 c7                	mov    %eax,%edi
+f01057c0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	e->env_tf.tf_regs.reg_eax = 0;
+f01057c2:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+	r = e->env_id;
+f01057c9:	8b 40 48             	mov    0x48(%eax),%eax
+f01057cc:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+		break;
+f01057d2:	e9 b0 fc ff ff       	jmp    f0105487 <syscall+0x5a>
+	r = envid2env(envid, &e, true);
+f01057d7:	83 ec 04             	sub    $0x4,%esp
+f01057da:	6a 01                	push   $0x1
+f01057dc:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f01057e2:	50                   	push   %eax
+f01057e3:	ff 75 0c             	push   0xc(%ebp)
+f01057e6:	e8 38 e3 ff ff       	call   f0103b23 <envid2env>
+f01057eb:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+	if (r < 0)
+f01057f1:	83 c4 10             	add    $0x10,%esp
+f01057f4:	85 c0                	test   %eax,%eax
+f01057f6:	0f 88 8b fc ff ff    	js     f0105487 <syscall+0x5a>
+	if (status != ENV_RUNNABLE && status != ENV_NOT_RUNNABLE) {
+f01057fc:	8b 45 10             	mov    0x10(%ebp),%eax
+f01057ff:	83 e8 02             	sub    $0x2,%eax
+f0105802:	a9 fd ff ff ff       	test   $0xfffffffd,%eax
+f0105807:	75 11                	jne    f010581a <syscall+0x3ed>
+	e->env_status = status;
+f0105809:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f010580f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0105812:	89 48 54             	mov    %ecx,0x54(%eax)
+f0105815:	e9 6d fc ff ff       	jmp    f0105487 <syscall+0x5a>
+		r = -E_INVAL;
+f010581a:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f0105821:	ff ff ff 
+		break;
+f0105824:	e9 5e fc ff ff       	jmp    f0105487 <syscall+0x5a>
+	r = envid2env(envid, &e, true);
+f0105829:	83 ec 04             	sub    $0x4,%esp
+f010582c:	6a 01                	push   $0x1
+f010582e:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0105834:	50                   	push   %eax
+f0105835:	ff 75 0c             	push   0xc(%ebp)
+f0105838:	e8 e6 e2 ff ff       	call   f0103b23 <envid2env>
+f010583d:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+	if (r < 0)
+f0105843:	83 c4 10             	add    $0x10,%esp
+f0105846:	85 c0                	test   %eax,%eax
+f0105848:	0f 88 39 fc ff ff    	js     f0105487 <syscall+0x5a>
+	user_mem_assert(curenv, tf, sizeof(struct Trapframe), 0);
+f010584e:	e8 a0 1b 00 00       	call   f01073f3 <cpunum>
+f0105853:	6a 00                	push   $0x0
+f0105855:	6a 44                	push   $0x44
+f0105857:	ff 75 10             	push   0x10(%ebp)
+f010585a:	6b c0 74             	imul   $0x74,%eax,%eax
+f010585d:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f0105863:	e8 bb e1 ff ff       	call   f0103a23 <user_mem_assert>
+	e->env_tf = *tf;
+f0105868:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f010586e:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0105873:	89 c7                	mov    %eax,%edi
+f0105875:	8b 75 10             	mov    0x10(%ebp),%esi
+f0105878:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	e->env_tf.tf_cs |= 3;
+f010587a:	66 83 48 34 03       	orw    $0x3,0x34(%eax)
+	e->env_tf.tf_eflags &= ~FL_IOPL_MASK;
+f010587f:	8b 50 38             	mov    0x38(%eax),%edx
+f0105882:	80 e6 cf             	and    $0xcf,%dh
+f0105885:	80 ce 02             	or     $0x2,%dh
+f0105888:	89 50 38             	mov    %edx,0x38(%eax)
+f010588b:	83 c4 10             	add    $0x10,%esp
+		break;
+f010588e:	e9 f4 fb ff ff       	jmp    f0105487 <syscall+0x5a>
+	r = envid2env(envid, &e, true);
+f0105893:	83 ec 04             	sub    $0x4,%esp
+f0105896:	6a 01                	push   $0x1
+f0105898:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f010589e:	50                   	push   %eax
+f010589f:	ff 75 0c             	push   0xc(%ebp)
+f01058a2:	e8 7c e2 ff ff       	call   f0103b23 <envid2env>
+f01058a7:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+	if (r < 0)
+f01058ad:	83 c4 10             	add    $0x10,%esp
+f01058b0:	85 c0                	test   %eax,%eax
+f01058b2:	0f 88 cf fb ff ff    	js     f0105487 <syscall+0x5a>
+	e->env_pgfault_upcall = func;
+f01058b8:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f01058be:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f01058c1:	89 48 64             	mov    %ecx,0x64(%eax)
+		break;
+f01058c4:	e9 be fb ff ff       	jmp    f0105487 <syscall+0x5a>
+	sched_yield();
+f01058c9:	e8 56 f4 ff ff       	call   f0104d24 <sched_yield>
+	r = envid2env(envid, &e, false);
+f01058ce:	83 ec 04             	sub    $0x4,%esp
+f01058d1:	6a 00                	push   $0x0
+f01058d3:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f01058d9:	50                   	push   %eax
+f01058da:	ff 75 0c             	push   0xc(%ebp)
+f01058dd:	e8 41 e2 ff ff       	call   f0103b23 <envid2env>
+f01058e2:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+	if (r < 0)
+f01058e8:	83 c4 10             	add    $0x10,%esp
+f01058eb:	85 c0                	test   %eax,%eax
+f01058ed:	0f 88 94 fb ff ff    	js     f0105487 <syscall+0x5a>
+	if (!e->env_ipc_recving) {
+f01058f3:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f01058f9:	80 78 68 00          	cmpb   $0x0,0x68(%eax)
+f01058fd:	0f 84 b1 00 00 00    	je     f01059b4 <syscall+0x587>
+	if ((uintptr_t) e->env_ipc_dstva < UTOP && (uintptr_t) srcva < UTOP) {
+f0105903:	81 78 6c ff ff bf ee 	cmpl   $0xeebfffff,0x6c(%eax)
+f010590a:	77 09                	ja     f0105915 <syscall+0x4e8>
+f010590c:	81 7d 14 ff ff bf ee 	cmpl   $0xeebfffff,0x14(%ebp)
+f0105913:	76 52                	jbe    f0105967 <syscall+0x53a>
+		e->env_ipc_perm = 0;
+f0105915:	c7 40 78 00 00 00 00 	movl   $0x0,0x78(%eax)
+		e->env_ipc_npages = 0;
+f010591c:	c7 40 7c 00 00 00 00 	movl   $0x0,0x7c(%eax)
+	ipc_wake(e, value);
+f0105923:	8b 9d e8 fe ff ff    	mov    -0x118(%ebp),%ebx
+	e->env_ipc_value = value;
+f0105929:	8b 45 10             	mov    0x10(%ebp),%eax
+f010592c:	89 43 70             	mov    %eax,0x70(%ebx)
+	e->env_ipc_from = curenv->env_id;
+f010592f:	e8 bf 1a 00 00       	call   f01073f3 <cpunum>
+f0105934:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105937:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f010593d:	8b 40 48             	mov    0x48(%eax),%eax
+f0105940:	89 43 74             	mov    %eax,0x74(%ebx)
+	e->env_ipc_recving = false;
+f0105943:	c6 43 68 00          	movb   $0x0,0x68(%ebx)
+	if (!e->env_ipc_nowait) {
+f0105947:	80 bb 80 00 00 00 00 	cmpb   $0x0,0x80(%ebx)
+f010594e:	0f 85 33 fb ff ff    	jne    f0105487 <syscall+0x5a>
+		e->env_tf.tf_regs.reg_eax = 0;
+f0105954:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+		e->env_status = ENV_RUNNABLE;
+f010595b:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+f0105962:	e9 20 fb ff ff       	jmp    f0105487 <syscall+0x5a>
+		if (!(pp = ipc_page_lookup(srcva, perm))) {
+f0105967:	8b 55 18             	mov    0x18(%ebp),%edx
+f010596a:	8b 45 14             	mov    0x14(%ebp),%eax
+f010596d:	e8 4b f4 ff ff       	call   f0104dbd <ipc_page_lookup>
+f0105972:	85 c0                	test   %eax,%eax
+f0105974:	74 4d                	je     f01059c3 <syscall+0x596>
+		r = page_insert(e->env_pgdir, pp, e->env_ipc_dstva, perm);
+f0105976:	8b 95 e8 fe ff ff    	mov    -0x118(%ebp),%edx
+f010597c:	ff 75 18             	push   0x18(%ebp)
+f010597f:	ff 72 6c             	push   0x6c(%edx)
+f0105982:	50                   	push   %eax
+f0105983:	ff 72 60             	push   0x60(%edx)
+f0105986:	e8 4f c2 ff ff       	call   f0101bda <page_insert>
+f010598b:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+		if (r < 0)
+f0105991:	83 c4 10             	add    $0x10,%esp
+f0105994:	85 c0                	test   %eax,%eax
+f0105996:	0f 88 eb fa ff ff    	js     f0105487 <syscall+0x5a>
+		e->env_ipc_perm = perm;
+f010599c:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+f01059a2:	8b 4d 18             	mov    0x18(%ebp),%ecx
+f01059a5:	89 48 78             	mov    %ecx,0x78(%eax)
+		e->env_ipc_npages = 1;
+f01059a8:	c7 40 7c 01 00 00 00 	movl   $0x1,0x7c(%eax)
+	if ((uintptr_t) e->env_ipc_dstva < UTOP && (uintptr_t) srcva < UTOP) {
+f01059af:	e9 6f ff ff ff       	jmp    f0105923 <syscall+0x4f6>
+		r = -E_IPC_NOT_RECV;
+f01059b4:	c7 85 d4 fe ff ff f9 	movl   $0xfffffff9,-0x12c(%ebp)
+f01059bb:	ff ff ff 
+f01059be:	e9 c4 fa ff ff       	jmp    f0105487 <syscall+0x5a>
+			r = -E_INVAL;
+f01059c3:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f01059ca:	ff ff ff 
+		break;
+f01059cd:	e9 b5 fa ff ff       	jmp    f0105487 <syscall+0x5a>
+	if ((uintptr_t) dstva < UTOP
+f01059d2:	81 7d 0c ff ff bf ee 	cmpl   $0xeebfffff,0xc(%ebp)
+f01059d9:	77 30                	ja     f0105a0b <syscall+0x5de>
+	    && (PGOFF(dstva) != 0 || npages < 1 || npages > IPC_MAXPAGES
+f01059db:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+f01059e2:	0f 85 ae 07 00 00    	jne    f0106196 <syscall+0xd69>
+f01059e8:	8b 45 10             	mov    0x10(%ebp),%eax
+f01059eb:	83 e8 01             	sub    $0x1,%eax
+f01059ee:	83 f8 7f             	cmp    $0x7f,%eax
+f01059f1:	0f 87 ae 07 00 00    	ja     f01061a5 <syscall+0xd78>
+		|| (uintptr_t) dstva + npages * PGSIZE > UTOP))
+f01059f7:	8b 45 10             	mov    0x10(%ebp),%eax
+f01059fa:	c1 e0 0c             	shl    $0xc,%eax
+f01059fd:	03 45 0c             	add    0xc(%ebp),%eax
+f0105a00:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+f0105a05:	0f 87 a9 07 00 00    	ja     f01061b4 <syscall+0xd87>
+	if (curenv->env_ipc_nowait && !curenv->env_ipc_recving
+f0105a0b:	e8 e3 19 00 00       	call   f01073f3 <cpunum>
+f0105a10:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105a13:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105a19:	80 b8 80 00 00 00 00 	cmpb   $0x0,0x80(%eax)
+f0105a20:	74 1e                	je     f0105a40 <syscall+0x613>
+f0105a22:	e8 cc 19 00 00       	call   f01073f3 <cpunum>
+f0105a27:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105a2a:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105a30:	80 78 68 00          	cmpb   $0x0,0x68(%eax)
+f0105a34:	75 0a                	jne    f0105a40 <syscall+0x613>
+	    && !(flags & IPC_NOWAIT)) {
+f0105a36:	f6 45 14 01          	testb  $0x1,0x14(%ebp)
+f0105a3a:	0f 84 c5 00 00 00    	je     f0105b05 <syscall+0x6d8>
+	curenv->env_ipc_recving = true;
+f0105a40:	e8 ae 19 00 00       	call   f01073f3 <cpunum>
+f0105a45:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105a48:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105a4e:	c6 40 68 01          	movb   $0x1,0x68(%eax)
+	curenv->env_ipc_dstva = dstva;
+f0105a52:	e8 9c 19 00 00       	call   f01073f3 <cpunum>
+f0105a57:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105a5a:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105a60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0105a63:	89 48 6c             	mov    %ecx,0x6c(%eax)
+	curenv->env_ipc_npages = npages;
+f0105a66:	e8 88 19 00 00       	call   f01073f3 <cpunum>
+f0105a6b:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105a6e:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105a74:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0105a77:	89 48 7c             	mov    %ecx,0x7c(%eax)
+	curenv->env_ipc_nowait = !!(flags & IPC_NOWAIT);
+f0105a7a:	e8 74 19 00 00       	call   f01073f3 <cpunum>
+f0105a7f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105a82:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105a88:	0f b6 55 14          	movzbl 0x14(%ebp),%edx
+f0105a8c:	83 e2 01             	and    $0x1,%edx
+f0105a8f:	88 90 80 00 00 00    	mov    %dl,0x80(%eax)
+	if (curenv->env_ipc_nowait)
+f0105a95:	e8 59 19 00 00       	call   f01073f3 <cpunum>
+f0105a9a:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105a9d:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+		return 0;
+f0105aa3:	c7 85 d4 fe ff ff 00 	movl   $0x0,-0x12c(%ebp)
+f0105aaa:	00 00 00 
+	if (curenv->env_ipc_nowait)
+f0105aad:	80 b8 80 00 00 00 00 	cmpb   $0x0,0x80(%eax)
+f0105ab4:	0f 85 cd f9 ff ff    	jne    f0105487 <syscall+0x5a>
+	if (deadline && (int32_t) (time_msec() - deadline) >= 0) {
+f0105aba:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+f0105abe:	74 0a                	je     f0105aca <syscall+0x69d>
+f0105ac0:	e8 75 4c 00 00       	call   f010a73a <time_msec>
+f0105ac5:	3b 45 18             	cmp    0x18(%ebp),%eax
+f0105ac8:	79 5f                	jns    f0105b29 <syscall+0x6fc>
+	curenv->env_ipc_deadline = deadline;
+f0105aca:	e8 24 19 00 00       	call   f01073f3 <cpunum>
+f0105acf:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105ad2:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105ad8:	8b 4d 18             	mov    0x18(%ebp),%ecx
+f0105adb:	89 88 84 00 00 00    	mov    %ecx,0x84(%eax)
+	curenv->env_status = ENV_NOT_RUNNABLE;
+f0105ae1:	e8 0d 19 00 00       	call   f01073f3 <cpunum>
+f0105ae6:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105ae9:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105aef:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	return -E_UNSPECIFIED;
+f0105af6:	c7 85 d4 fe ff ff ff 	movl   $0xffffffff,-0x12c(%ebp)
+f0105afd:	ff ff ff 
+f0105b00:	e9 82 f9 ff ff       	jmp    f0105487 <syscall+0x5a>
+		curenv->env_ipc_nowait = false;
+f0105b05:	e8 e9 18 00 00       	call   f01073f3 <cpunum>
+f0105b0a:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105b0d:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105b13:	c6 80 80 00 00 00 00 	movb   $0x0,0x80(%eax)
+		return 0;
+f0105b1a:	c7 85 d4 fe ff ff 00 	movl   $0x0,-0x12c(%ebp)
+f0105b21:	00 00 00 
+f0105b24:	e9 5e f9 ff ff       	jmp    f0105487 <syscall+0x5a>
+		curenv->env_ipc_recving = false;
+f0105b29:	e8 c5 18 00 00       	call   f01073f3 <cpunum>
+f0105b2e:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105b31:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105b37:	c6 40 68 00          	movb   $0x0,0x68(%eax)
+		return -E_TIMEOUT;
+f0105b3b:	c7 85 d4 fe ff ff ef 	movl   $0xffffffef,-0x12c(%ebp)
+f0105b42:	ff ff ff 
+f0105b45:	e9 3d f9 ff ff       	jmp    f0105487 <syscall+0x5a>
+	return time_msec();
+f0105b4a:	e8 eb 4b 00 00       	call   f010a73a <time_msec>
+f0105b4f:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+		break;
+f0105b55:	e9 2d f9 ff ff       	jmp    f0105487 <syscall+0x5a>
+	user_mem_assert(curenv, packet, length, 0);
+f0105b5a:	e8 94 18 00 00       	call   f01073f3 <cpunum>
+f0105b5f:	6a 00                	push   $0x0
+f0105b61:	ff 75 10             	push   0x10(%ebp)
+f0105b64:	ff 75 0c             	push   0xc(%ebp)
+f0105b67:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105b6a:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f0105b70:	e8 ae de ff ff       	call   f0103a23 <user_mem_assert>
+	if (net_map_env())
+f0105b75:	e8 f4 29 00 00       	call   f010856e <net_map_env>
+f0105b7a:	89 c2                	mov    %eax,%edx
+f0105b7c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+f0105b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (net_map_env())
+f0105b84:	85 d2                	test   %edx,%edx
+f0105b86:	74 0b                	je     f0105b93 <syscall+0x766>
+		r = sys_net_try_send((const void *) a1, a2);
+f0105b88:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+		break;
+f0105b8e:	e9 f4 f8 ff ff       	jmp    f0105487 <syscall+0x5a>
+	return net_packet_tx(packet, length);
+f0105b93:	83 ec 08             	sub    $0x8,%esp
+f0105b96:	ff 75 10             	push   0x10(%ebp)
+f0105b99:	ff 75 0c             	push   0xc(%ebp)
+f0105b9c:	e8 03 45 00 00       	call   f010a0a4 <net_packet_tx>
+f0105ba1:	83 c4 10             	add    $0x10,%esp
+f0105ba4:	eb e2                	jmp    f0105b88 <syscall+0x75b>
+	user_mem_assert(curenv, buffer, RX_BUFFER_SIZE, PTE_W);
+f0105ba6:	e8 48 18 00 00       	call   f01073f3 <cpunum>
+f0105bab:	6a 02                	push   $0x2
+f0105bad:	68 00 08 00 00       	push   $0x800
+f0105bb2:	ff 75 0c             	push   0xc(%ebp)
+f0105bb5:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105bb8:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f0105bbe:	e8 60 de ff ff       	call   f0103a23 <user_mem_assert>
+	if (net_map_env())
+f0105bc3:	e8 a6 29 00 00       	call   f010856e <net_map_env>
+f0105bc8:	89 c2                	mov    %eax,%edx
+f0105bca:	83 c4 10             	add    $0x10,%esp
+		return 0;
+f0105bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (net_map_env())
+f0105bd2:	85 d2                	test   %edx,%edx
+f0105bd4:	74 0b                	je     f0105be1 <syscall+0x7b4>
+		r = sys_net_try_recv((uint8_t *) a1);
+f0105bd6:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+		break;
+f0105bdc:	e9 a6 f8 ff ff       	jmp    f0105487 <syscall+0x5a>
+	return net_packet_rx(buffer);
+f0105be1:	83 ec 0c             	sub    $0xc,%esp
+f0105be4:	ff 75 0c             	push   0xc(%ebp)
+f0105be7:	e8 45 45 00 00       	call   f010a131 <net_packet_rx>
+f0105bec:	83 c4 10             	add    $0x10,%esp
+f0105bef:	eb e5                	jmp    f0105bd6 <syscall+0x7a9>
+	if (!events || (events & ~(NET_WAIT_RX | NET_WAIT_TX)))
+f0105bf1:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0105bf4:	83 e8 01             	sub    $0x1,%eax
+f0105bf7:	83 f8 02             	cmp    $0x2,%eax
+f0105bfa:	0f 87 c3 05 00 00    	ja     f01061c3 <syscall+0xd96>
+	if ((!net_map_env() || net_map_env() == curenv)
+f0105c00:	e8 69 29 00 00       	call   f010856e <net_map_env>
+f0105c05:	85 c0                	test   %eax,%eax
+f0105c07:	74 17                	je     f0105c20 <syscall+0x7f3>
+f0105c09:	e8 60 29 00 00       	call   f010856e <net_map_env>
+f0105c0e:	89 c3                	mov    %eax,%ebx
+f0105c10:	e8 de 17 00 00       	call   f01073f3 <cpunum>
+f0105c15:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105c18:	3b 98 28 d0 83 f0    	cmp    -0xf7c2fd8(%eax),%ebx
+f0105c1e:	75 1d                	jne    f0105c3d <syscall+0x810>
+	    && (ready = net_ready(events)))
+f0105c20:	83 ec 0c             	sub    $0xc,%esp
+f0105c23:	ff 75 0c             	push   0xc(%ebp)
+f0105c26:	e8 4b 45 00 00       	call   f010a176 <net_ready>
+f0105c2b:	83 c4 10             	add    $0x10,%esp
+f0105c2e:	85 c0                	test   %eax,%eax
+f0105c30:	74 0b                	je     f0105c3d <syscall+0x810>
+		return ready;
+f0105c32:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+f0105c38:	e9 4a f8 ff ff       	jmp    f0105487 <syscall+0x5a>
+	curenv->env_net_wait = events;
+f0105c3d:	e8 b1 17 00 00       	call   f01073f3 <cpunum>
+f0105c42:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105c45:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105c4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0105c4e:	89 88 88 00 00 00    	mov    %ecx,0x88(%eax)
+	curenv->env_status = ENV_NOT_RUNNABLE;
+f0105c54:	e8 9a 17 00 00       	call   f01073f3 <cpunum>
+f0105c59:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105c5c:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105c62:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+	return -E_UNSPECIFIED;
+f0105c69:	c7 85 d4 fe ff ff ff 	movl   $0xffffffff,-0x12c(%ebp)
+f0105c70:	ff ff ff 
+f0105c73:	e9 0f f8 ff ff       	jmp    f0105487 <syscall+0x5a>
+	if (PGOFF(dstva) || npages < 1 || npages > NET_BATCH_MAX
+f0105c78:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+f0105c7f:	0f 85 49 02 00 00    	jne    f0105ece <syscall+0xaa1>
+f0105c85:	8b 45 10             	mov    0x10(%ebp),%eax
+f0105c88:	83 e8 01             	sub    $0x1,%eax
+	    || (uintptr_t) dstva >= UTOP
+f0105c8b:	83 f8 1f             	cmp    $0x1f,%eax
+f0105c8e:	0f 87 49 02 00 00    	ja     f0105edd <syscall+0xab0>
+f0105c94:	81 7d 0c ff ff bf ee 	cmpl   $0xeebfffff,0xc(%ebp)
+f0105c9b:	0f 87 3c 02 00 00    	ja     f0105edd <syscall+0xab0>
+	    || (uintptr_t) dstva + npages * PGSIZE > UTOP)
+f0105ca1:	8b 45 10             	mov    0x10(%ebp),%eax
+f0105ca4:	c1 e0 0c             	shl    $0xc,%eax
+f0105ca7:	03 45 0c             	add    0xc(%ebp),%eax
+f0105caa:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+f0105caf:	0f 87 37 02 00 00    	ja     f0105eec <syscall+0xabf>
+	if (net_map_env())
+f0105cb5:	e8 b4 28 00 00       	call   f010856e <net_map_env>
+		return 0;
+f0105cba:	c7 85 d4 fe ff ff 00 	movl   $0x0,-0x12c(%ebp)
+f0105cc1:	00 00 00 
+	if (net_map_env())
+f0105cc4:	85 c0                	test   %eax,%eax
+f0105cc6:	0f 85 bb f7 ff ff    	jne    f0105487 <syscall+0x5a>
+	if ((n = net_packet_rx_pages(pps, npages)) <= 0)
+f0105ccc:	83 ec 08             	sub    $0x8,%esp
+f0105ccf:	ff 75 10             	push   0x10(%ebp)
+f0105cd2:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0105cd8:	50                   	push   %eax
+f0105cd9:	e8 74 44 00 00       	call   f010a152 <net_packet_rx_pages>
+f0105cde:	89 85 bc fe ff ff    	mov    %eax,-0x144(%ebp)
+f0105ce4:	83 c4 10             	add    $0x10,%esp
+f0105ce7:	85 c0                	test   %eax,%eax
+f0105ce9:	0f 8e 0c 02 00 00    	jle    f0105efb <syscall+0xace>
+	for (i = m = 0; i < n; i += k) {
+f0105cef:	c7 85 d4 fe ff ff 00 	movl   $0x0,-0x12c(%ebp)
+f0105cf6:	00 00 00 
+f0105cf9:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0105cfe:	e9 e8 00 00 00       	jmp    f0105deb <syscall+0x9be>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0105d03:	52                   	push   %edx
+f0105d04:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0105d09:	6a 5f                	push   $0x5f
+f0105d0b:	68 31 ba 10 f0       	push   $0xf010ba31
+f0105d10:	e8 34 a3 ff ff       	call   f0100049 <_panic>
+f0105d15:	8b 8d cc fe ff ff    	mov    -0x134(%ebp),%ecx
+f0105d1b:	8d 7b ff             	lea    -0x1(%ebx),%edi
+f0105d1e:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+f0105d21:	c1 e6 0c             	shl    $0xc,%esi
+f0105d24:	03 75 0c             	add    0xc(%ebp),%esi
+f0105d27:	89 bd cc fe ff ff    	mov    %edi,-0x134(%ebp)
+f0105d2d:	8b bd c0 fe ff ff    	mov    -0x140(%ebp),%edi
+f0105d33:	89 8d c0 fe ff ff    	mov    %ecx,-0x140(%ebp)
+f0105d39:	eb 26                	jmp    f0105d61 <syscall+0x934>
+					page_remove(curenv->env_pgdir,
+f0105d3b:	e8 b3 16 00 00       	call   f01073f3 <cpunum>
+f0105d40:	83 ec 08             	sub    $0x8,%esp
+f0105d43:	56                   	push   %esi
+f0105d44:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105d47:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105d4d:	ff 70 60             	push   0x60(%eax)
+f0105d50:	e8 3f be ff ff       	call   f0101b94 <page_remove>
+f0105d55:	83 ef 01             	sub    $0x1,%edi
+f0105d58:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+f0105d5e:	83 c4 10             	add    $0x10,%esp
+				while (j-- > 0)
+f0105d61:	85 ff                	test   %edi,%edi
+f0105d63:	7f d6                	jg     f0105d3b <syscall+0x90e>
+f0105d65:	8b bd cc fe ff ff    	mov    -0x134(%ebp),%edi
+f0105d6b:	8b 8d c0 fe ff ff    	mov    -0x140(%ebp),%ecx
+f0105d71:	85 db                	test   %ebx,%ebx
+f0105d73:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105d78:	0f 49 c3             	cmovns %ebx,%eax
+f0105d7b:	29 c7                	sub    %eax,%edi
+f0105d7d:	89 fb                	mov    %edi,%ebx
+		for (j = 0; m == i && j < k; j++)
+f0105d7f:	0f b6 85 c7 fe ff ff 	movzbl -0x139(%ebp),%eax
+		if (m == i && j == k)
+f0105d86:	8b 95 d0 fe ff ff    	mov    -0x130(%ebp),%edx
+f0105d8c:	39 da                	cmp    %ebx,%edx
+f0105d8e:	75 13                	jne    f0105da3 <syscall+0x976>
+			m += k;
+f0105d90:	8b bd d4 fe ff ff    	mov    -0x12c(%ebp),%edi
+f0105d96:	01 fa                	add    %edi,%edx
+f0105d98:	84 c0                	test   %al,%al
+f0105d9a:	0f 44 d7             	cmove  %edi,%edx
+f0105d9d:	89 95 d4 fe ff ff    	mov    %edx,-0x12c(%ebp)
+		for (j = 0; j < k; j++)
+f0105da3:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0105da8:	8b b5 d0 fe ff ff    	mov    -0x130(%ebp),%esi
+f0105dae:	89 8d cc fe ff ff    	mov    %ecx,-0x134(%ebp)
+f0105db4:	8b bd c8 fe ff ff    	mov    -0x138(%ebp),%edi
+f0105dba:	eb 11                	jmp    f0105dcd <syscall+0x9a0>
+			page_decref(pps[i + j]);
+f0105dbc:	83 ec 0c             	sub    $0xc,%esp
+f0105dbf:	ff 34 9f             	push   (%edi,%ebx,4)
+f0105dc2:	e8 54 bb ff ff       	call   f010191b <page_decref>
+		for (j = 0; j < k; j++)
+f0105dc7:	83 c3 01             	add    $0x1,%ebx
+f0105dca:	83 c4 10             	add    $0x10,%esp
+f0105dcd:	39 de                	cmp    %ebx,%esi
+f0105dcf:	7f eb                	jg     f0105dbc <syscall+0x98f>
+	for (i = m = 0; i < n; i += k) {
+f0105dd1:	8b 8d cc fe ff ff    	mov    -0x134(%ebp),%ecx
+f0105dd7:	8b 85 d0 fe ff ff    	mov    -0x130(%ebp),%eax
+f0105ddd:	01 c1                	add    %eax,%ecx
+f0105ddf:	39 8d bc fe ff ff    	cmp    %ecx,-0x144(%ebp)
+f0105de5:	0f 8e c7 00 00 00    	jle    f0105eb2 <syscall+0xa85>
+	return (pp - pool.pages) << PGSHIFT;
+f0105deb:	8b 84 8d e8 fe ff ff 	mov    -0x118(%ebp,%ecx,4),%eax
+f0105df2:	bf 60 c2 7f f0       	mov    $0xf07fc260,%edi
+f0105df7:	2b 47 08             	sub    0x8(%edi),%eax
+f0105dfa:	c1 f8 02             	sar    $0x2,%eax
+f0105dfd:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0105e03:	89 c2                	mov    %eax,%edx
+f0105e05:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0105e08:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0105e0d:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f0105e13:	0f 83 ea fe ff ff    	jae    f0105d03 <syscall+0x8d6>
+		k = RX_PKT_PAGES(*(int *) page2kva(pps[i]));
+f0105e19:	8b 82 00 00 00 f0    	mov    -0x10000000(%edx),%eax
+f0105e1f:	05 07 10 00 00       	add    $0x1007,%eax
+f0105e24:	c1 e8 0c             	shr    $0xc,%eax
+f0105e27:	89 85 d0 fe ff ff    	mov    %eax,-0x130(%ebp)
+		for (j = 0; m == i && j < k; j++)
+f0105e2d:	89 ce                	mov    %ecx,%esi
+f0105e2f:	c1 e6 0c             	shl    $0xc,%esi
+f0105e32:	03 75 0c             	add    0xc(%ebp),%esi
+f0105e35:	8d 84 8d e8 fe ff ff 	lea    -0x118(%ebp,%ecx,4),%eax
+f0105e3c:	89 85 c8 fe ff ff    	mov    %eax,-0x138(%ebp)
+f0105e42:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0105e47:	89 8d cc fe ff ff    	mov    %ecx,-0x134(%ebp)
+f0105e4d:	8b 8d cc fe ff ff    	mov    -0x134(%ebp),%ecx
+f0105e53:	39 8d d4 fe ff ff    	cmp    %ecx,-0x12c(%ebp)
+f0105e59:	0f 94 c0             	sete   %al
+f0105e5c:	39 9d d0 fe ff ff    	cmp    %ebx,-0x130(%ebp)
+f0105e62:	0f 9f c2             	setg   %dl
+f0105e65:	20 c2                	and    %al,%dl
+f0105e67:	88 95 c7 fe ff ff    	mov    %dl,-0x139(%ebp)
+f0105e6d:	0f 84 13 ff ff ff    	je     f0105d86 <syscall+0x959>
+			if (page_insert(curenv->env_pgdir, pps[i + j],
+f0105e73:	89 9d c0 fe ff ff    	mov    %ebx,-0x140(%ebp)
+f0105e79:	8b 85 c8 fe ff ff    	mov    -0x138(%ebp),%eax
+f0105e7f:	8b 3c 98             	mov    (%eax,%ebx,4),%edi
+f0105e82:	e8 6c 15 00 00       	call   f01073f3 <cpunum>
+f0105e87:	6a 07                	push   $0x7
+f0105e89:	56                   	push   %esi
+f0105e8a:	57                   	push   %edi
+f0105e8b:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105e8e:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f0105e94:	ff 70 60             	push   0x60(%eax)
+f0105e97:	e8 3e bd ff ff       	call   f0101bda <page_insert>
+f0105e9c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0105ea2:	83 c4 10             	add    $0x10,%esp
+f0105ea5:	85 c0                	test   %eax,%eax
+f0105ea7:	0f 88 68 fe ff ff    	js     f0105d15 <syscall+0x8e8>
+		for (j = 0; m == i && j < k; j++)
+f0105ead:	83 c3 01             	add    $0x1,%ebx
+f0105eb0:	eb 9b                	jmp    f0105e4d <syscall+0xa20>
+	return m > 0 ? m : -E_NO_MEM;
+f0105eb2:	83 bd d4 fe ff ff 00 	cmpl   $0x0,-0x12c(%ebp)
+f0105eb9:	0f 8f c8 f5 ff ff    	jg     f0105487 <syscall+0x5a>
+f0105ebf:	c7 85 d4 fe ff ff fc 	movl   $0xfffffffc,-0x12c(%ebp)
+f0105ec6:	ff ff ff 
+f0105ec9:	e9 b9 f5 ff ff       	jmp    f0105487 <syscall+0x5a>
+		return -E_INVAL;
+f0105ece:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f0105ed5:	ff ff ff 
+f0105ed8:	e9 aa f5 ff ff       	jmp    f0105487 <syscall+0x5a>
+f0105edd:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f0105ee4:	ff ff ff 
+f0105ee7:	e9 9b f5 ff ff       	jmp    f0105487 <syscall+0x5a>
+f0105eec:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f0105ef3:	ff ff ff 
+f0105ef6:	e9 8c f5 ff ff       	jmp    f0105487 <syscall+0x5a>
+		return n;
+f0105efb:	8b 85 bc fe ff ff    	mov    -0x144(%ebp),%eax
+f0105f01:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+		break;
+f0105f07:	e9 7b f5 ff ff       	jmp    f0105487 <syscall+0x5a>
+	if (n < 1 || n > NET_BATCH_MAX)
+f0105f0c:	8b 45 10             	mov    0x10(%ebp),%eax
+f0105f0f:	83 e8 01             	sub    $0x1,%eax
+f0105f12:	83 f8 1f             	cmp    $0x1f,%eax
+f0105f15:	0f 87 b3 00 00 00    	ja     f0105fce <syscall+0xba1>
+	user_mem_assert(curenv, upkts, n * sizeof(*upkts), 0);
+f0105f1b:	8b 45 10             	mov    0x10(%ebp),%eax
+f0105f1e:	8d 1c c5 00 00 00 00 	lea    0x0(,%eax,8),%ebx
+f0105f25:	e8 c9 14 00 00       	call   f01073f3 <cpunum>
+f0105f2a:	6a 00                	push   $0x0
+f0105f2c:	53                   	push   %ebx
+f0105f2d:	ff 75 0c             	push   0xc(%ebp)
+f0105f30:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105f33:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f0105f39:	e8 e5 da ff ff       	call   f0103a23 <user_mem_assert>
+	memmove(pkts, upkts, n * sizeof(*upkts));
+f0105f3e:	83 c4 0c             	add    $0xc,%esp
+f0105f41:	53                   	push   %ebx
+f0105f42:	ff 75 0c             	push   0xc(%ebp)
+f0105f45:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0105f4b:	50                   	push   %eax
+f0105f4c:	e8 ea 0e 00 00       	call   f0106e3b <memmove>
+	for (i = 0; i < n; i++) {
+f0105f51:	83 c4 10             	add    $0x10,%esp
+f0105f54:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0105f59:	39 5d 10             	cmp    %ebx,0x10(%ebp)
+f0105f5c:	74 37                	je     f0105f95 <syscall+0xb68>
+		if (pkts[i].sg_len == 0 || pkts[i].sg_len > NET_FRAME_MAX)
+f0105f5e:	8b b4 dd ec fe ff ff 	mov    -0x114(%ebp,%ebx,8),%esi
+f0105f65:	8d 46 ff             	lea    -0x1(%esi),%eax
+f0105f68:	3d 39 23 00 00       	cmp    $0x2339,%eax
+f0105f6d:	77 26                	ja     f0105f95 <syscall+0xb68>
+		user_mem_assert(curenv, pkts[i].sg_va, pkts[i].sg_len, 0);
+f0105f6f:	8b bc dd e8 fe ff ff 	mov    -0x118(%ebp,%ebx,8),%edi
+f0105f76:	e8 78 14 00 00       	call   f01073f3 <cpunum>
+f0105f7b:	6a 00                	push   $0x0
+f0105f7d:	56                   	push   %esi
+f0105f7e:	57                   	push   %edi
+f0105f7f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105f82:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f0105f88:	e8 96 da ff ff       	call   f0103a23 <user_mem_assert>
+	for (i = 0; i < n; i++) {
+f0105f8d:	83 c3 01             	add    $0x1,%ebx
+f0105f90:	83 c4 10             	add    $0x10,%esp
+f0105f93:	eb c4                	jmp    f0105f59 <syscall+0xb2c>
+	if (i == 0)
+f0105f95:	85 db                	test   %ebx,%ebx
+f0105f97:	74 44                	je     f0105fdd <syscall+0xbb0>
+	if (net_map_env())
+f0105f99:	e8 d0 25 00 00       	call   f010856e <net_map_env>
+		return 0;
+f0105f9e:	c7 85 d4 fe ff ff 00 	movl   $0x0,-0x12c(%ebp)
+f0105fa5:	00 00 00 
+	if (net_map_env())
+f0105fa8:	85 c0                	test   %eax,%eax
+f0105faa:	0f 85 d7 f4 ff ff    	jne    f0105487 <syscall+0x5a>
+	return net_packet_tx_batch(pkts, i);
+f0105fb0:	83 ec 08             	sub    $0x8,%esp
+f0105fb3:	53                   	push   %ebx
+f0105fb4:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+f0105fba:	50                   	push   %eax
+f0105fbb:	e8 08 41 00 00       	call   f010a0c8 <net_packet_tx_batch>
+f0105fc0:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+f0105fc6:	83 c4 10             	add    $0x10,%esp
+f0105fc9:	e9 b9 f4 ff ff       	jmp    f0105487 <syscall+0x5a>
+		return -E_INVAL;
+f0105fce:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f0105fd5:	ff ff ff 
+f0105fd8:	e9 aa f4 ff ff       	jmp    f0105487 <syscall+0x5a>
+		return -E_INVAL;
+f0105fdd:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f0105fe4:	ff ff ff 
+f0105fe7:	e9 9b f4 ff ff       	jmp    f0105487 <syscall+0x5a>
+		r = sys_net_send_sg((const struct net_sg *) a1, a2,
+f0105fec:	83 ec 0c             	sub    $0xc,%esp
+f0105fef:	ff 75 18             	push   0x18(%ebp)
+f0105ff2:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0105ff5:	8b 55 10             	mov    0x10(%ebp),%edx
+f0105ff8:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0105ffb:	e8 36 ee ff ff       	call   f0104e36 <sys_net_send_sg>
+f0106000:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+		break;
+f0106006:	83 c4 10             	add    $0x10,%esp
+f0106009:	e9 79 f4 ff ff       	jmp    f0105487 <syscall+0x5a>
+	if (curenv->env_type != ENV_TYPE_NS)
+f010600e:	e8 e0 13 00 00       	call   f01073f3 <cpunum>
+f0106013:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106016:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f010601c:	83 78 50 02          	cmpl   $0x2,0x50(%eax)
+f0106020:	0f 85 ac 01 00 00    	jne    f01061d2 <syscall+0xda5>
+	if (PGOFF(va) || (uintptr_t) va >= UTOP
+f0106026:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+f010602d:	0f 85 ae 01 00 00    	jne    f01061e1 <syscall+0xdb4>
+f0106033:	81 7d 0c 00 f0 af ee 	cmpl   $0xeeaff000,0xc(%ebp)
+f010603a:	0f 87 a1 01 00 00    	ja     f01061e1 <syscall+0xdb4>
+	if ((r = net_map(curenv)) < 0)
+f0106040:	e8 ae 13 00 00       	call   f01073f3 <cpunum>
+f0106045:	83 ec 0c             	sub    $0xc,%esp
+f0106048:	6b c0 74             	imul   $0x74,%eax,%eax
+f010604b:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f0106051:	e8 c5 23 00 00       	call   f010841b <net_map>
+f0106056:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+f010605c:	83 c4 10             	add    $0x10,%esp
+f010605f:	85 c0                	test   %eax,%eax
+f0106061:	0f 88 20 f4 ff ff    	js     f0105487 <syscall+0x5a>
+f0106067:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (i = 0; i < NETMAP_NPAGES; i++)
+f010606a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (page_insert(curenv->env_pgdir, net_map_page(i),
+f010606f:	83 ec 0c             	sub    $0xc,%esp
+f0106072:	53                   	push   %ebx
+f0106073:	e8 e7 24 00 00       	call   f010855f <net_map_page>
+f0106078:	89 c6                	mov    %eax,%esi
+f010607a:	e8 74 13 00 00       	call   f01073f3 <cpunum>
+f010607f:	6a 07                	push   $0x7
+f0106081:	57                   	push   %edi
+f0106082:	56                   	push   %esi
+f0106083:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106086:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f010608c:	ff 70 60             	push   0x60(%eax)
+f010608f:	e8 46 bb ff ff       	call   f0101bda <page_insert>
+f0106094:	81 c7 00 10 00 00    	add    $0x1000,%edi
+f010609a:	83 c4 20             	add    $0x20,%esp
+f010609d:	85 c0                	test   %eax,%eax
+f010609f:	78 1a                	js     f01060bb <syscall+0xc8e>
+	for (i = 0; i < NETMAP_NPAGES; i++)
+f01060a1:	83 c3 01             	add    $0x1,%ebx
+f01060a4:	81 fb 01 01 00 00    	cmp    $0x101,%ebx
+f01060aa:	75 c3                	jne    f010606f <syscall+0xc42>
+	return 0;
+f01060ac:	c7 85 d4 fe ff ff 00 	movl   $0x0,-0x12c(%ebp)
+f01060b3:	00 00 00 
+f01060b6:	e9 cc f3 ff ff       	jmp    f0105487 <syscall+0x5a>
+f01060bb:	89 de                	mov    %ebx,%esi
+f01060bd:	c1 e6 0c             	shl    $0xc,%esi
+f01060c0:	03 75 0c             	add    0xc(%ebp),%esi
+f01060c3:	eb 1d                	jmp    f01060e2 <syscall+0xcb5>
+				page_remove(curenv->env_pgdir,
+f01060c5:	e8 29 13 00 00       	call   f01073f3 <cpunum>
+f01060ca:	83 ec 08             	sub    $0x8,%esp
+f01060cd:	56                   	push   %esi
+f01060ce:	6b c0 74             	imul   $0x74,%eax,%eax
+f01060d1:	8b 80 28 d0 83 f0    	mov    -0xf7c2fd8(%eax),%eax
+f01060d7:	ff 70 60             	push   0x60(%eax)
+f01060da:	e8 b5 ba ff ff       	call   f0101b94 <page_remove>
+f01060df:	83 c4 10             	add    $0x10,%esp
+			while (--i >= 0)
+f01060e2:	81 ee 00 10 00 00    	sub    $0x1000,%esi
+f01060e8:	83 eb 01             	sub    $0x1,%ebx
+f01060eb:	79 d8                	jns    f01060c5 <syscall+0xc98>
+			net_unmap(curenv);
+f01060ed:	e8 01 13 00 00       	call   f01073f3 <cpunum>
+f01060f2:	83 ec 0c             	sub    $0xc,%esp
+f01060f5:	6b c0 74             	imul   $0x74,%eax,%eax
+f01060f8:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f01060fe:	e8 71 24 00 00       	call   f0108574 <net_unmap>
+			return -E_NO_MEM;
+f0106103:	83 c4 10             	add    $0x10,%esp
+f0106106:	c7 85 d4 fe ff ff fc 	movl   $0xfffffffc,-0x12c(%ebp)
+f010610d:	ff ff ff 
+f0106110:	e9 72 f3 ff ff       	jmp    f0105487 <syscall+0x5a>
+	if (!net_map_env() || net_map_env() != curenv)
+f0106115:	e8 54 24 00 00       	call   f010856e <net_map_env>
+f010611a:	85 c0                	test   %eax,%eax
+f010611c:	0f 84 ce 00 00 00    	je     f01061f0 <syscall+0xdc3>
+f0106122:	e8 47 24 00 00       	call   f010856e <net_map_env>
+f0106127:	89 c3                	mov    %eax,%ebx
+f0106129:	e8 c5 12 00 00       	call   f01073f3 <cpunum>
+f010612e:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106131:	3b 98 28 d0 83 f0    	cmp    -0xf7c2fd8(%eax),%ebx
+f0106137:	0f 85 c2 00 00 00    	jne    f01061ff <syscall+0xdd2>
+	if (!rings || (rings & ~(NET_WAIT_RX | NET_WAIT_TX)))
+f010613d:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106140:	83 e8 01             	sub    $0x1,%eax
+f0106143:	83 f8 02             	cmp    $0x2,%eax
+f0106146:	0f 87 c2 00 00 00    	ja     f010620e <syscall+0xde1>
+	return net_sync(rings);
+f010614c:	83 ec 0c             	sub    $0xc,%esp
+f010614f:	ff 75 0c             	push   0xc(%ebp)
+f0106152:	e8 be 24 00 00       	call   f0108615 <net_sync>
+f0106157:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+f010615d:	83 c4 10             	add    $0x10,%esp
+f0106160:	e9 22 f3 ff ff       	jmp    f0105487 <syscall+0x5a>
+		r = sys_ipc_try_sendv(a1, a2, (const uintptr_t *) a3, a4);
+f0106165:	83 ec 0c             	sub    $0xc,%esp
+f0106168:	ff 75 18             	push   0x18(%ebp)
+f010616b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f010616e:	8b 55 10             	mov    0x10(%ebp),%edx
+f0106171:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106174:	e8 0a f0 ff ff       	call   f0105183 <sys_ipc_try_sendv>
+f0106179:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+		break;
+f010617f:	83 c4 10             	add    $0x10,%esp
+f0106182:	e9 00 f3 ff ff       	jmp    f0105487 <syscall+0x5a>
+	switch (syscallno) {
+f0106187:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f010618e:	ff ff ff 
+f0106191:	e9 f1 f2 ff ff       	jmp    f0105487 <syscall+0x5a>
+		return -E_INVAL;
+f0106196:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f010619d:	ff ff ff 
+f01061a0:	e9 e2 f2 ff ff       	jmp    f0105487 <syscall+0x5a>
+f01061a5:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f01061ac:	ff ff ff 
+f01061af:	e9 d3 f2 ff ff       	jmp    f0105487 <syscall+0x5a>
+f01061b4:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f01061bb:	ff ff ff 
+f01061be:	e9 c4 f2 ff ff       	jmp    f0105487 <syscall+0x5a>
+		return -E_INVAL;
+f01061c3:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f01061ca:	ff ff ff 
+f01061cd:	e9 b5 f2 ff ff       	jmp    f0105487 <syscall+0x5a>
+		return -E_BAD_ENV;
+f01061d2:	c7 85 d4 fe ff ff fe 	movl   $0xfffffffe,-0x12c(%ebp)
+f01061d9:	ff ff ff 
+f01061dc:	e9 a6 f2 ff ff       	jmp    f0105487 <syscall+0x5a>
+		return -E_INVAL;
+f01061e1:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f01061e8:	ff ff ff 
+f01061eb:	e9 97 f2 ff ff       	jmp    f0105487 <syscall+0x5a>
+		return -E_BAD_ENV;
+f01061f0:	c7 85 d4 fe ff ff fe 	movl   $0xfffffffe,-0x12c(%ebp)
+f01061f7:	ff ff ff 
+f01061fa:	e9 88 f2 ff ff       	jmp    f0105487 <syscall+0x5a>
+f01061ff:	c7 85 d4 fe ff ff fe 	movl   $0xfffffffe,-0x12c(%ebp)
+f0106206:	ff ff ff 
+f0106209:	e9 79 f2 ff ff       	jmp    f0105487 <syscall+0x5a>
+		return -E_INVAL;
+f010620e:	c7 85 d4 fe ff ff fd 	movl   $0xfffffffd,-0x12c(%ebp)
+f0106215:	ff ff ff 
+f0106218:	e9 6a f2 ff ff       	jmp    f0105487 <syscall+0x5a>
+
+f010621d <syscall__lock_kernel>:
+{
+f010621d:	55                   	push   %ebp
+f010621e:	89 e5                	mov    %esp,%ebp
+f0106220:	53                   	push   %ebx
+f0106221:	83 ec 10             	sub    $0x10,%esp
+	spin_lock(&kernel_lock);
+f0106224:	68 80 64 11 f0       	push   $0xf0116480
+f0106229:	e8 35 14 00 00       	call   f0107663 <spin_lock>
+	r = syscall(syscallno, a1, a2, a3, a4, 0);
+f010622e:	83 c4 08             	add    $0x8,%esp
+f0106231:	6a 00                	push   $0x0
+f0106233:	ff 75 18             	push   0x18(%ebp)
+f0106236:	ff 75 14             	push   0x14(%ebp)
+f0106239:	ff 75 10             	push   0x10(%ebp)
+f010623c:	ff 75 0c             	push   0xc(%ebp)
+f010623f:	ff 75 08             	push   0x8(%ebp)
+f0106242:	e8 e6 f1 ff ff       	call   f010542d <syscall>
+f0106247:	89 c3                	mov    %eax,%ebx
+	spin_unlock(&kernel_lock);
+f0106249:	83 c4 14             	add    $0x14,%esp
+f010624c:	68 80 64 11 f0       	push   $0xf0116480
+f0106251:	e8 a7 14 00 00       	call   f01076fd <spin_unlock>
+	asm volatile("pause");
+f0106256:	f3 90                	pause
+}
+f0106258:	89 d8                	mov    %ebx,%eax
+f010625a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010625d:	c9                   	leave
+f010625e:	c3                   	ret
+
+f010625f <stab_binsearch>:
+//	will exit setting left = 118, right = 554.
+//
+static void
+stab_binsearch(const struct Stab *stabs, int *region_left, int *region_right,
+	       int type, uintptr_t addr)
+{
+f010625f:	55                   	push   %ebp
+f0106260:	89 e5                	mov    %esp,%ebp
+f0106262:	57                   	push   %edi
+f0106263:	56                   	push   %esi
+f0106264:	53                   	push   %ebx
+f0106265:	83 ec 14             	sub    $0x14,%esp
+f0106268:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f010626b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f010626e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	int l = *region_left, r = *region_right, any_matches = 0;
+f0106271:	8b 1a                	mov    (%edx),%ebx
+f0106273:	8b 09                	mov    (%ecx),%ecx
+f0106275:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+
+	while (l <= r) {
+f010627c:	eb 4f                	jmp    f01062cd <stab_binsearch+0x6e>
+		int true_m = (l + r) / 2, m = true_m;
+
+		// search for earliest stab with right type
+		while (m >= l && stabs[m].n_type != type)
+			m--;
+f010627e:	83 e8 01             	sub    $0x1,%eax
+		while (m >= l && stabs[m].n_type != type)
+f0106281:	39 c3                	cmp    %eax,%ebx
+f0106283:	0f 8f cc 00 00 00    	jg     f0106355 <stab_binsearch+0xf6>
+f0106289:	0f b6 0a             	movzbl (%edx),%ecx
+f010628c:	83 ea 0c             	sub    $0xc,%edx
+f010628f:	39 f1                	cmp    %esi,%ecx
+f0106291:	75 eb                	jne    f010627e <stab_binsearch+0x1f>
+f0106293:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0106296:	89 75 08             	mov    %esi,0x8(%ebp)
+			continue;
+		}
+
+		// actual binary search
+		any_matches = 1;
+		if (stabs[m].n_value < addr) {
+f0106299:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f010629c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+f010629f:	8b 54 96 08          	mov    0x8(%esi,%edx,4),%edx
+f01062a3:	3b 55 0c             	cmp    0xc(%ebp),%edx
+f01062a6:	72 16                	jb     f01062be <stab_binsearch+0x5f>
+			*region_left = m;
+			l = true_m + 1;
+		} else if (stabs[m].n_value > addr) {
+f01062a8:	39 55 0c             	cmp    %edx,0xc(%ebp)
+f01062ab:	73 48                	jae    f01062f5 <stab_binsearch+0x96>
+			*region_right = m - 1;
+f01062ad:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f01062b0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01062b3:	89 08                	mov    %ecx,(%eax)
+		any_matches = 1;
+f01062b5:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f01062bc:	eb 0f                	jmp    f01062cd <stab_binsearch+0x6e>
+			*region_left = m;
+f01062be:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f01062c1:	89 06                	mov    %eax,(%esi)
+			l = true_m + 1;
+f01062c3:	8d 5f 01             	lea    0x1(%edi),%ebx
+		any_matches = 1;
+f01062c6:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+	while (l <= r) {
+f01062cd:	39 cb                	cmp    %ecx,%ebx
+f01062cf:	7f 38                	jg     f0106309 <stab_binsearch+0xaa>
+		int true_m = (l + r) / 2, m = true_m;
+f01062d1:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+f01062d4:	89 c2                	mov    %eax,%edx
+f01062d6:	c1 ea 1f             	shr    $0x1f,%edx
+f01062d9:	01 d0                	add    %edx,%eax
+f01062db:	89 c7                	mov    %eax,%edi
+f01062dd:	d1 ff                	sar    %edi
+		while (m >= l && stabs[m].n_type != type)
+f01062df:	83 e0 fe             	and    $0xfffffffe,%eax
+f01062e2:	01 f8                	add    %edi,%eax
+f01062e4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+f01062e7:	8d 54 82 04          	lea    0x4(%edx,%eax,4),%edx
+		int true_m = (l + r) / 2, m = true_m;
+f01062eb:	89 f8                	mov    %edi,%eax
+f01062ed:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+f01062f0:	8b 75 08             	mov    0x8(%ebp),%esi
+		while (m >= l && stabs[m].n_type != type)
+f01062f3:	eb 8c                	jmp    f0106281 <stab_binsearch+0x22>
+			r = m - 1;
+		} else {
+			// exact match for 'addr', but continue loop to find
+			// *region_right
+			*region_left = m;
+f01062f5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01062f8:	89 07                	mov    %eax,(%edi)
+			l = m;
+			addr++;
+f01062fa:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+f01062fe:	89 c3                	mov    %eax,%ebx
+		any_matches = 1;
+f0106300:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0106307:	eb c4                	jmp    f01062cd <stab_binsearch+0x6e>
+		}
+	}
+
+	if (!any_matches)
+f0106309:	8b 75 08             	mov    0x8(%ebp),%esi
+f010630c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+f0106310:	75 15                	jne    f0106327 <stab_binsearch+0xc8>
+		*region_right = *region_left - 1;
+f0106312:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106315:	8b 00                	mov    (%eax),%eax
+f0106317:	83 e8 01             	sub    $0x1,%eax
+f010631a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f010631d:	89 07                	mov    %eax,(%edi)
+		     l > *region_left && stabs[l].n_type != type;
+		     l--)
+			/* do nothing */;
+		*region_left = l;
+	}
+}
+f010631f:	83 c4 14             	add    $0x14,%esp
+f0106322:	5b                   	pop    %ebx
+f0106323:	5e                   	pop    %esi
+f0106324:	5f                   	pop    %edi
+f0106325:	5d                   	pop    %ebp
+f0106326:	c3                   	ret
+		for (l = *region_right;
+f0106327:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010632a:	8b 00                	mov    (%eax),%eax
+		     l > *region_left && stabs[l].n_type != type;
+f010632c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f010632f:	8b 0f                	mov    (%edi),%ecx
+f0106331:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0106334:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f0106337:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f010633b:	39 c1                	cmp    %eax,%ecx
+f010633d:	7d 0f                	jge    f010634e <stab_binsearch+0xef>
+f010633f:	0f b6 1a             	movzbl (%edx),%ebx
+f0106342:	83 ea 0c             	sub    $0xc,%edx
+f0106345:	39 f3                	cmp    %esi,%ebx
+f0106347:	74 05                	je     f010634e <stab_binsearch+0xef>
+		     l--)
+f0106349:	83 e8 01             	sub    $0x1,%eax
+f010634c:	eb ed                	jmp    f010633b <stab_binsearch+0xdc>
+		*region_left = l;
+f010634e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0106351:	89 07                	mov    %eax,(%edi)
+}
+f0106353:	eb ca                	jmp    f010631f <stab_binsearch+0xc0>
+			l = true_m + 1;
+f0106355:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0106358:	89 75 08             	mov    %esi,0x8(%ebp)
+f010635b:	8d 5f 01             	lea    0x1(%edi),%ebx
+			continue;
+f010635e:	e9 6a ff ff ff       	jmp    f01062cd <stab_binsearch+0x6e>
+
+f0106363 <debuginfo_eip>:
+//	negative if not.  But even if it returns negative it has stored some
+//	information into '*info'.
+//
+int
+debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
+{
+f0106363:	55                   	push   %ebp
+f0106364:	89 e5                	mov    %esp,%ebp
+f0106366:	57                   	push   %edi
+f0106367:	56                   	push   %esi
+f0106368:	53                   	push   %ebx
+f0106369:	83 ec 3c             	sub    $0x3c,%esp
+	const struct Stab *stabs, *stab_end;
+	const char *stabstr, *stabstr_end;
+	int lfile, rfile, lfun, rfun, lline, rline;
+
+	// Initialize *info
+	info->eip_file = "<unknown>";
+f010636c:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010636f:	c7 00 00 c3 10 f0    	movl   $0xf010c300,(%eax)
+	info->eip_line = 0;
+f0106375:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	info->eip_fn_name = "<unknown>";
+f010637c:	c7 40 08 00 c3 10 f0 	movl   $0xf010c300,0x8(%eax)
+	info->eip_fn_namelen = 9;
+f0106383:	c7 40 0c 09 00 00 00 	movl   $0x9,0xc(%eax)
+	info->eip_fn_addr = addr;
+f010638a:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010638d:	89 78 10             	mov    %edi,0x10(%eax)
+	info->eip_fn_narg = 0;
+f0106390:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+
+	// Find the relevant set of stabs
+	if (addr >= ULIM) {
+f0106397:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f010639d:	0f 86 29 01 00 00    	jbe    f01064cc <debuginfo_eip+0x169>
+		stabs = __STAB_BEGIN__;
+		stab_end = __STAB_END__;
+		stabstr = __STABSTR_BEGIN__;
+		stabstr_end = __STABSTR_END__;
+f01063a3:	c7 45 c4 34 cc 10 f0 	movl   $0xf010cc34,-0x3c(%ebp)
+		stabstr = __STABSTR_BEGIN__;
+f01063aa:	c7 45 c0 34 cc 10 f0 	movl   $0xf010cc34,-0x40(%ebp)
+		stab_end = __STAB_END__;
+f01063b1:	be 33 cc 10 f0       	mov    $0xf010cc33,%esi
+		stabs = __STAB_BEGIN__;
+f01063b6:	bf 33 cc 10 f0       	mov    $0xf010cc33,%edi
+				sizeof(struct Stab) * (stab_end - stabs), 0);
+		user_mem_assert(curenv, stabstr, stabstr_end - stabstr, 0);
+	}
+
+	// String table validity checks
+	if (stabstr_end <= stabstr || stabstr_end[-1] != 0)
+f01063bb:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f01063be:	39 4d c0             	cmp    %ecx,-0x40(%ebp)
+f01063c1:	0f 83 0a 02 00 00    	jae    f01065d1 <debuginfo_eip+0x26e>
+f01063c7:	80 79 ff 00          	cmpb   $0x0,-0x1(%ecx)
+f01063cb:	0f 85 07 02 00 00    	jne    f01065d8 <debuginfo_eip+0x275>
+	// 'eip'.  First, we find the basic source file containing 'eip'.
+	// Then, we look in that source file for the function.  Then we look
+	// for the line number.
+
+	// Search the entire set of stabs for the source file (type N_SO).
+	lfile = 0;
+f01063d1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	rfile = (stab_end - stabs) - 1;
+f01063d8:	29 fe                	sub    %edi,%esi
+f01063da:	c1 fe 02             	sar    $0x2,%esi
+f01063dd:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+f01063e3:	83 e8 01             	sub    $0x1,%eax
+f01063e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	stab_binsearch(stabs, &lfile, &rfile, N_SO, addr);
+f01063e9:	83 ec 08             	sub    $0x8,%esp
+f01063ec:	ff 75 08             	push   0x8(%ebp)
+f01063ef:	6a 64                	push   $0x64
+f01063f1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f01063f4:	89 c1                	mov    %eax,%ecx
+f01063f6:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f01063f9:	89 f8                	mov    %edi,%eax
+f01063fb:	e8 5f fe ff ff       	call   f010625f <stab_binsearch>
+	if (lfile == 0)
+f0106400:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0106403:	83 c4 10             	add    $0x10,%esp
+f0106406:	85 f6                	test   %esi,%esi
+f0106408:	0f 84 d1 01 00 00    	je     f01065df <debuginfo_eip+0x27c>
+		return -1;
+
+	// Search within that file's stabs for the function definition
+	// (N_FUN).
+	lfun = lfile;
+f010640e:	89 75 dc             	mov    %esi,-0x24(%ebp)
+	rfun = rfile;
+f0106411:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0106414:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+	stab_binsearch(stabs, &lfun, &rfun, N_FUN, addr);
+f0106417:	83 ec 08             	sub    $0x8,%esp
+f010641a:	ff 75 08             	push   0x8(%ebp)
+f010641d:	6a 24                	push   $0x24
+f010641f:	8d 45 d8             	lea    -0x28(%ebp),%eax
+f0106422:	89 c1                	mov    %eax,%ecx
+f0106424:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f0106427:	89 f8                	mov    %edi,%eax
+f0106429:	e8 31 fe ff ff       	call   f010625f <stab_binsearch>
+
+	if (lfun <= rfun) {
+f010642e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0106431:	89 45 bc             	mov    %eax,-0x44(%ebp)
+f0106434:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0106437:	89 55 b8             	mov    %edx,-0x48(%ebp)
+f010643a:	83 c4 10             	add    $0x10,%esp
+f010643d:	39 d0                	cmp    %edx,%eax
+f010643f:	0f 8f 03 01 00 00    	jg     f0106548 <debuginfo_eip+0x1e5>
+		// stabs[lfun] points to the function name
+		// in the string table, but check bounds just in case.
+		if (stabs[lfun].n_strx < stabstr_end - stabstr)
+f0106445:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0106448:	8d 14 87             	lea    (%edi,%eax,4),%edx
+f010644b:	8b 02                	mov    (%edx),%eax
+f010644d:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f0106450:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+f0106453:	29 d9                	sub    %ebx,%ecx
+f0106455:	39 c8                	cmp    %ecx,%eax
+f0106457:	73 08                	jae    f0106461 <debuginfo_eip+0xfe>
+			info->eip_fn_name = stabstr + stabs[lfun].n_strx;
+f0106459:	01 d8                	add    %ebx,%eax
+f010645b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010645e:	89 43 08             	mov    %eax,0x8(%ebx)
+		info->eip_fn_addr = stabs[lfun].n_value;
+f0106461:	8b 42 08             	mov    0x8(%edx),%eax
+		addr -= info->eip_fn_addr;
+f0106464:	29 45 08             	sub    %eax,0x8(%ebp)
+		// Search within the function definition for the line number.
+		lline = lfun;
+		rline = rfun;
+f0106467:	8b 55 bc             	mov    -0x44(%ebp),%edx
+f010646a:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+		info->eip_fn_addr = stabs[lfun].n_value;
+f010646d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0106470:	89 41 10             	mov    %eax,0x10(%ecx)
+		lline = lfun;
+f0106473:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+		rline = rfun;
+f0106476:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+		info->eip_fn_addr = addr;
+		lline = lfile;
+		rline = rfile;
+	}
+	// Ignore stuff after the colon.
+	info->eip_fn_namelen = strfind(info->eip_fn_name, ':') - info->eip_fn_name;
+f0106479:	83 ec 08             	sub    $0x8,%esp
+f010647c:	6a 3a                	push   $0x3a
+f010647e:	ff 71 08             	push   0x8(%ecx)
+f0106481:	e8 64 09 00 00       	call   f0106dea <strfind>
+f0106486:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0106489:	2b 43 08             	sub    0x8(%ebx),%eax
+f010648c:	89 43 0c             	mov    %eax,0xc(%ebx)
+	// Hint:
+	//	There's a particular stabs type used for line numbers.
+	//	Look at the STABS documentation and <inc/stab.h> to find
+	//	which one.
+	// Your code here.
+	stab_binsearch(stabs, &lline, &rline, N_SLINE, addr);
+f010648f:	83 c4 08             	add    $0x8,%esp
+f0106492:	ff 75 08             	push   0x8(%ebp)
+f0106495:	6a 44                	push   $0x44
+f0106497:	8d 4d d0             	lea    -0x30(%ebp),%ecx
+f010649a:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+f010649d:	89 f8                	mov    %edi,%eax
+f010649f:	e8 bb fd ff ff       	call   f010625f <stab_binsearch>
+	if (lline > rline)
+f01064a4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01064a7:	83 c4 10             	add    $0x10,%esp
+f01064aa:	3b 45 d0             	cmp    -0x30(%ebp),%eax
+f01064ad:	0f 8f 33 01 00 00    	jg     f01065e6 <debuginfo_eip+0x283>
+		return -1;
+	info->eip_line = stabs[lline].n_desc;
+f01064b3:	89 c2                	mov    %eax,%edx
+f01064b5:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f01064b8:	0f b7 4c 87 06       	movzwl 0x6(%edi,%eax,4),%ecx
+f01064bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01064c0:	89 4b 04             	mov    %ecx,0x4(%ebx)
+	// Search backwards from the line number for the relevant filename
+	// stab.
+	// We can't just use the "lfile" stab because inlined functions
+	// can interpolate code from a different file!
+	// Such included source files use the N_SOL stab type.
+	while (lline >= lfile
+f01064c3:	8d 44 87 04          	lea    0x4(%edi,%eax,4),%eax
+f01064c7:	e9 8c 00 00 00       	jmp    f0106558 <debuginfo_eip+0x1f5>
+		user_mem_assert(curenv, usd, sizeof(struct UserStabData), 0);
+f01064cc:	e8 22 0f 00 00       	call   f01073f3 <cpunum>
+f01064d1:	6a 00                	push   $0x0
+f01064d3:	6a 10                	push   $0x10
+f01064d5:	68 00 00 20 00       	push   $0x200000
+f01064da:	6b c0 74             	imul   $0x74,%eax,%eax
+f01064dd:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f01064e3:	e8 3b d5 ff ff       	call   f0103a23 <user_mem_assert>
+		stabs = usd->stabs;
+f01064e8:	8b 3d 00 00 20 00    	mov    0x200000,%edi
+		stab_end = usd->stab_end;
+f01064ee:	8b 35 04 00 20 00    	mov    0x200004,%esi
+		stabstr = usd->stabstr;
+f01064f4:	8b 1d 08 00 20 00    	mov    0x200008,%ebx
+f01064fa:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+		stabstr_end = usd->stabstr_end;
+f01064fd:	8b 15 0c 00 20 00    	mov    0x20000c,%edx
+f0106503:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+		user_mem_assert(curenv, stabs,
+f0106506:	e8 e8 0e 00 00       	call   f01073f3 <cpunum>
+f010650b:	6a 00                	push   $0x0
+				sizeof(struct Stab) * (stab_end - stabs), 0);
+f010650d:	89 f1                	mov    %esi,%ecx
+f010650f:	29 f9                	sub    %edi,%ecx
+		user_mem_assert(curenv, stabs,
+f0106511:	51                   	push   %ecx
+f0106512:	57                   	push   %edi
+f0106513:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106516:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f010651c:	e8 02 d5 ff ff       	call   f0103a23 <user_mem_assert>
+		user_mem_assert(curenv, stabstr, stabstr_end - stabstr, 0);
+f0106521:	83 c4 20             	add    $0x20,%esp
+f0106524:	e8 ca 0e 00 00       	call   f01073f3 <cpunum>
+f0106529:	6a 00                	push   $0x0
+f010652b:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f010652e:	29 da                	sub    %ebx,%edx
+f0106530:	52                   	push   %edx
+f0106531:	53                   	push   %ebx
+f0106532:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106535:	ff b0 28 d0 83 f0    	push   -0xf7c2fd8(%eax)
+f010653b:	e8 e3 d4 ff ff       	call   f0103a23 <user_mem_assert>
+f0106540:	83 c4 10             	add    $0x10,%esp
+f0106543:	e9 73 fe ff ff       	jmp    f01063bb <debuginfo_eip+0x58>
+f0106548:	8b 45 08             	mov    0x8(%ebp),%eax
+f010654b:	89 f2                	mov    %esi,%edx
+f010654d:	e9 1b ff ff ff       	jmp    f010646d <debuginfo_eip+0x10a>
+	       && stabs[lline].n_type != N_SOL
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+		lline--;
+f0106552:	83 ea 01             	sub    $0x1,%edx
+f0106555:	83 e8 0c             	sub    $0xc,%eax
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f0106558:	39 d6                	cmp    %edx,%esi
+f010655a:	7f 25                	jg     f0106581 <debuginfo_eip+0x21e>
+	       && stabs[lline].n_type != N_SOL
+f010655c:	0f b6 08             	movzbl (%eax),%ecx
+f010655f:	80 f9 84             	cmp    $0x84,%cl
+f0106562:	74 0b                	je     f010656f <debuginfo_eip+0x20c>
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f0106564:	80 f9 64             	cmp    $0x64,%cl
+f0106567:	75 e9                	jne    f0106552 <debuginfo_eip+0x1ef>
+f0106569:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f010656d:	74 e3                	je     f0106552 <debuginfo_eip+0x1ef>
+	if (lline >= lfile && stabs[lline].n_strx < stabstr_end - stabstr)
+f010656f:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f0106572:	8b 14 87             	mov    (%edi,%eax,4),%edx
+f0106575:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0106578:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f010657b:	29 f0                	sub    %esi,%eax
+f010657d:	39 c2                	cmp    %eax,%edx
+f010657f:	72 20                	jb     f01065a1 <debuginfo_eip+0x23e>
+	if (lfun < rfun)
+		for (lline = lfun + 1; lline < rfun; lline++)
+			if (stabs[lline].n_type == N_PSYM)
+				info->eip_fn_narg++;
+
+	return 0;
+f0106581:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lfun < rfun)
+f0106586:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+f0106589:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+f010658c:	39 cb                	cmp    %ecx,%ebx
+f010658e:	7d 39                	jge    f01065c9 <debuginfo_eip+0x266>
+		for (lline = lfun + 1; lline < rfun; lline++)
+f0106590:	89 d8                	mov    %ebx,%eax
+f0106592:	83 c0 01             	add    $0x1,%eax
+f0106595:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0106598:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f010659c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010659f:	eb 14                	jmp    f01065b5 <debuginfo_eip+0x252>
+		info->eip_file = stabstr + stabs[lline].n_strx;
+f01065a1:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f01065a4:	01 d0                	add    %edx,%eax
+f01065a6:	89 c2                	mov    %eax,%edx
+f01065a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01065ab:	89 10                	mov    %edx,(%eax)
+f01065ad:	eb d2                	jmp    f0106581 <debuginfo_eip+0x21e>
+		for (lline = lfun + 1; lline < rfun; lline++)
+f01065af:	83 c0 01             	add    $0x1,%eax
+f01065b2:	83 c2 0c             	add    $0xc,%edx
+f01065b5:	39 c1                	cmp    %eax,%ecx
+f01065b7:	7e 0b                	jle    f01065c4 <debuginfo_eip+0x261>
+			if (stabs[lline].n_type == N_PSYM)
+f01065b9:	80 3a a0             	cmpb   $0xa0,(%edx)
+f01065bc:	75 f1                	jne    f01065af <debuginfo_eip+0x24c>
+				info->eip_fn_narg++;
+f01065be:	83 43 14 01          	addl   $0x1,0x14(%ebx)
+f01065c2:	eb eb                	jmp    f01065af <debuginfo_eip+0x24c>
+	return 0;
+f01065c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01065c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01065cc:	5b                   	pop    %ebx
+f01065cd:	5e                   	pop    %esi
+f01065ce:	5f                   	pop    %edi
+f01065cf:	5d                   	pop    %ebp
+f01065d0:	c3                   	ret
+		return -1;
+f01065d1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01065d6:	eb f1                	jmp    f01065c9 <debuginfo_eip+0x266>
+f01065d8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01065dd:	eb ea                	jmp    f01065c9 <debuginfo_eip+0x266>
+		return -1;
+f01065df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01065e4:	eb e3                	jmp    f01065c9 <debuginfo_eip+0x266>
+		return -1;
+f01065e6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01065eb:	eb dc                	jmp    f01065c9 <debuginfo_eip+0x266>
+
+f01065ed <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+f01065ed:	55                   	push   %ebp
+f01065ee:	89 e5                	mov    %esp,%ebp
+f01065f0:	57                   	push   %edi
+f01065f1:	56                   	push   %esi
+f01065f2:	53                   	push   %ebx
+f01065f3:	83 ec 1c             	sub    $0x1c,%esp
+f01065f6:	89 c7                	mov    %eax,%edi
+f01065f8:	89 d6                	mov    %edx,%esi
+f01065fa:	8b 45 08             	mov    0x8(%ebp),%eax
+f01065fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0106600:	89 d1                	mov    %edx,%ecx
+f0106602:	89 c2                	mov    %eax,%edx
+f0106604:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0106607:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f010660a:	8b 45 10             	mov    0x10(%ebp),%eax
+f010660d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+f0106610:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0106613:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f010661a:	39 c2                	cmp    %eax,%edx
+f010661c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+f010661f:	72 3e                	jb     f010665f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+f0106621:	83 ec 0c             	sub    $0xc,%esp
+f0106624:	ff 75 18             	push   0x18(%ebp)
+f0106627:	83 eb 01             	sub    $0x1,%ebx
+f010662a:	53                   	push   %ebx
+f010662b:	50                   	push   %eax
+f010662c:	83 ec 08             	sub    $0x8,%esp
+f010662f:	ff 75 e4             	push   -0x1c(%ebp)
+f0106632:	ff 75 e0             	push   -0x20(%ebp)
+f0106635:	ff 75 dc             	push   -0x24(%ebp)
+f0106638:	ff 75 d8             	push   -0x28(%ebp)
+f010663b:	e8 d4 41 00 00       	call   f010a814 <__udivdi3>
+f0106640:	83 c4 18             	add    $0x18,%esp
+f0106643:	52                   	push   %edx
+f0106644:	50                   	push   %eax
+f0106645:	89 f2                	mov    %esi,%edx
+f0106647:	89 f8                	mov    %edi,%eax
+f0106649:	e8 9f ff ff ff       	call   f01065ed <printnum>
+f010664e:	83 c4 20             	add    $0x20,%esp
+f0106651:	eb 13                	jmp    f0106666 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+f0106653:	83 ec 08             	sub    $0x8,%esp
+f0106656:	56                   	push   %esi
+f0106657:	ff 75 18             	push   0x18(%ebp)
+f010665a:	ff d7                	call   *%edi
+f010665c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+f010665f:	83 eb 01             	sub    $0x1,%ebx
+f0106662:	85 db                	test   %ebx,%ebx
+f0106664:	7f ed                	jg     f0106653 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+f0106666:	83 ec 08             	sub    $0x8,%esp
+f0106669:	56                   	push   %esi
+f010666a:	83 ec 04             	sub    $0x4,%esp
+f010666d:	ff 75 e4             	push   -0x1c(%ebp)
+f0106670:	ff 75 e0             	push   -0x20(%ebp)
+f0106673:	ff 75 dc             	push   -0x24(%ebp)
+f0106676:	ff 75 d8             	push   -0x28(%ebp)
+f0106679:	e8 b4 41 00 00       	call   f010a832 <__umoddi3>
+f010667e:	83 c4 14             	add    $0x14,%esp
+f0106681:	0f be 80 0a c3 10 f0 	movsbl -0xfef3cf6(%eax),%eax
+f0106688:	50                   	push   %eax
+f0106689:	ff d7                	call   *%edi
+}
+f010668b:	83 c4 10             	add    $0x10,%esp
+f010668e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106691:	5b                   	pop    %ebx
+f0106692:	5e                   	pop    %esi
+f0106693:	5f                   	pop    %edi
+f0106694:	5d                   	pop    %ebp
+f0106695:	c3                   	ret
+
+f0106696 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+f0106696:	55                   	push   %ebp
+f0106697:	89 e5                	mov    %esp,%ebp
+f0106699:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+f010669c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+f01066a0:	8b 10                	mov    (%eax),%edx
+f01066a2:	3b 50 04             	cmp    0x4(%eax),%edx
+f01066a5:	73 0a                	jae    f01066b1 <sprintputch+0x1b>
+		*b->buf++ = ch;
+f01066a7:	8d 4a 01             	lea    0x1(%edx),%ecx
+f01066aa:	89 08                	mov    %ecx,(%eax)
+f01066ac:	8b 45 08             	mov    0x8(%ebp),%eax
+f01066af:	88 02                	mov    %al,(%edx)
+}
+f01066b1:	5d                   	pop    %ebp
+f01066b2:	c3                   	ret
+
+f01066b3 <printfmt>:
+{
+f01066b3:	55                   	push   %ebp
+f01066b4:	89 e5                	mov    %esp,%ebp
+f01066b6:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+f01066b9:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+f01066bc:	50                   	push   %eax
+f01066bd:	ff 75 10             	push   0x10(%ebp)
+f01066c0:	ff 75 0c             	push   0xc(%ebp)
+f01066c3:	ff 75 08             	push   0x8(%ebp)
+f01066c6:	e8 05 00 00 00       	call   f01066d0 <vprintfmt>
+}
+f01066cb:	83 c4 10             	add    $0x10,%esp
+f01066ce:	c9                   	leave
+f01066cf:	c3                   	ret
+
+f01066d0 <vprintfmt>:
+{
+f01066d0:	55                   	push   %ebp
+f01066d1:	89 e5                	mov    %esp,%ebp
+f01066d3:	57                   	push   %edi
+f01066d4:	56                   	push   %esi
+f01066d5:	53                   	push   %ebx
+f01066d6:	83 ec 2c             	sub    $0x2c,%esp
+f01066d9:	8b 75 08             	mov    0x8(%ebp),%esi
+f01066dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01066df:	8b 7d 10             	mov    0x10(%ebp),%edi
+f01066e2:	eb 0a                	jmp    f01066ee <vprintfmt+0x1e>
+			putch(ch, putdat);
+f01066e4:	83 ec 08             	sub    $0x8,%esp
+f01066e7:	53                   	push   %ebx
+f01066e8:	50                   	push   %eax
+f01066e9:	ff d6                	call   *%esi
+f01066eb:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f01066ee:	83 c7 01             	add    $0x1,%edi
+f01066f1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+f01066f5:	83 f8 25             	cmp    $0x25,%eax
+f01066f8:	74 0c                	je     f0106706 <vprintfmt+0x36>
+			if (ch == '\0')
+f01066fa:	85 c0                	test   %eax,%eax
+f01066fc:	75 e6                	jne    f01066e4 <vprintfmt+0x14>
+}
+f01066fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106701:	5b                   	pop    %ebx
+f0106702:	5e                   	pop    %esi
+f0106703:	5f                   	pop    %edi
+f0106704:	5d                   	pop    %ebp
+f0106705:	c3                   	ret
+		padc = ' ';
+f0106706:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+f010670a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+f0106711:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+f0106718:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+f010671f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+f0106724:	8d 47 01             	lea    0x1(%edi),%eax
+f0106727:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010672a:	0f b6 17             	movzbl (%edi),%edx
+f010672d:	8d 42 dd             	lea    -0x23(%edx),%eax
+f0106730:	3c 55                	cmp    $0x55,%al
+f0106732:	0f 87 cf 03 00 00    	ja     f0106b07 <vprintfmt+0x437>
+f0106738:	0f b6 c0             	movzbl %al,%eax
+f010673b:	ff 24 85 60 c4 10 f0 	jmp    *-0xfef3ba0(,%eax,4)
+f0106742:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+f0106745:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+f0106749:	eb d9                	jmp    f0106724 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+f010674b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f010674e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+f0106752:	eb d0                	jmp    f0106724 <vprintfmt+0x54>
+f0106754:	0f b6 d2             	movzbl %dl,%edx
+f0106757:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+f010675a:	b8 00 00 00 00       	mov    $0x0,%eax
+f010675f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+f0106762:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0106765:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+f0106769:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+f010676c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+f010676f:	83 f9 09             	cmp    $0x9,%ecx
+f0106772:	77 55                	ja     f01067c9 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+f0106774:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+f0106777:	eb e9                	jmp    f0106762 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+f0106779:	8b 45 14             	mov    0x14(%ebp),%eax
+f010677c:	8b 00                	mov    (%eax),%eax
+f010677e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0106781:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106784:	8d 40 04             	lea    0x4(%eax),%eax
+f0106787:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f010678a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+f010678d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f0106791:	79 91                	jns    f0106724 <vprintfmt+0x54>
+				width = precision, precision = -1;
+f0106793:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0106796:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0106799:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+f01067a0:	eb 82                	jmp    f0106724 <vprintfmt+0x54>
+			if (width < 0)
+f01067a2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f01067a5:	85 d2                	test   %edx,%edx
+f01067a7:	b8 00 00 00 00       	mov    $0x0,%eax
+f01067ac:	0f 49 c2             	cmovns %edx,%eax
+f01067af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+f01067b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+f01067b5:	e9 6a ff ff ff       	jmp    f0106724 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+f01067ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+f01067bd:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+f01067c4:	e9 5b ff ff ff       	jmp    f0106724 <vprintfmt+0x54>
+f01067c9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01067cc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01067cf:	eb bc                	jmp    f010678d <vprintfmt+0xbd>
+			lflag++;
+f01067d1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+f01067d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+f01067d7:	e9 48 ff ff ff       	jmp    f0106724 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+f01067dc:	8b 45 14             	mov    0x14(%ebp),%eax
+f01067df:	8d 78 04             	lea    0x4(%eax),%edi
+f01067e2:	83 ec 08             	sub    $0x8,%esp
+f01067e5:	53                   	push   %ebx
+f01067e6:	ff 30                	push   (%eax)
+f01067e8:	ff d6                	call   *%esi
+			break;
+f01067ea:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+f01067ed:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+f01067f0:	e9 b1 02 00 00       	jmp    f0106aa6 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+f01067f5:	8b 45 14             	mov    0x14(%ebp),%eax
+f01067f8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+f01067fb:	8b 10                	mov    (%eax),%edx
+f01067fd:	89 d0                	mov    %edx,%eax
+f01067ff:	f7 d8                	neg    %eax
+f0106801:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+f0106804:	83 f8 11             	cmp    $0x11,%eax
+f0106807:	7f 23                	jg     f010682c <vprintfmt+0x15c>
+f0106809:	8b 14 85 c0 c5 10 f0 	mov    -0xfef3a40(,%eax,4),%edx
+f0106810:	85 d2                	test   %edx,%edx
+f0106812:	74 18                	je     f010682c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+f0106814:	52                   	push   %edx
+f0106815:	68 37 aa 10 f0       	push   $0xf010aa37
+f010681a:	53                   	push   %ebx
+f010681b:	56                   	push   %esi
+f010681c:	e8 92 fe ff ff       	call   f01066b3 <printfmt>
+f0106821:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f0106824:	89 7d 14             	mov    %edi,0x14(%ebp)
+f0106827:	e9 7a 02 00 00       	jmp    f0106aa6 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+f010682c:	50                   	push   %eax
+f010682d:	68 22 c3 10 f0       	push   $0xf010c322
+f0106832:	53                   	push   %ebx
+f0106833:	56                   	push   %esi
+f0106834:	e8 7a fe ff ff       	call   f01066b3 <printfmt>
+f0106839:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+f010683c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+f010683f:	e9 62 02 00 00       	jmp    f0106aa6 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+f0106844:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106847:	83 c0 04             	add    $0x4,%eax
+f010684a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f010684d:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106850:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+f0106852:	85 c9                	test   %ecx,%ecx
+f0106854:	b8 1b c3 10 f0       	mov    $0xf010c31b,%eax
+f0106859:	0f 45 c1             	cmovne %ecx,%eax
+f010685c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+f010685f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f0106863:	7e 06                	jle    f010686b <vprintfmt+0x19b>
+f0106865:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+f0106869:	75 0b                	jne    f0106876 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+f010686b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f010686e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0106871:	89 75 08             	mov    %esi,0x8(%ebp)
+f0106874:	eb 5c                	jmp    f01068d2 <vprintfmt+0x202>
+f0106876:	83 ec 08             	sub    $0x8,%esp
+f0106879:	ff 75 d0             	push   -0x30(%ebp)
+f010687c:	ff 75 cc             	push   -0x34(%ebp)
+f010687f:	e8 0e 04 00 00       	call   f0106c92 <strnlen>
+f0106884:	89 c2                	mov    %eax,%edx
+f0106886:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106889:	29 d0                	sub    %edx,%eax
+f010688b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+f010688e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+f0106892:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0106895:	89 75 08             	mov    %esi,0x8(%ebp)
+f0106898:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+f010689a:	eb 0e                	jmp    f01068aa <vprintfmt+0x1da>
+					putch(padc, putdat);
+f010689c:	83 ec 08             	sub    $0x8,%esp
+f010689f:	53                   	push   %ebx
+f01068a0:	57                   	push   %edi
+f01068a1:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+f01068a4:	83 ee 01             	sub    $0x1,%esi
+f01068a7:	83 c4 10             	add    $0x10,%esp
+f01068aa:	85 f6                	test   %esi,%esi
+f01068ac:	7f ee                	jg     f010689c <vprintfmt+0x1cc>
+f01068ae:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01068b1:	8b 75 08             	mov    0x8(%ebp),%esi
+f01068b4:	85 c0                	test   %eax,%eax
+f01068b6:	ba 00 00 00 00       	mov    $0x0,%edx
+f01068bb:	0f 49 d0             	cmovns %eax,%edx
+f01068be:	29 d0                	sub    %edx,%eax
+f01068c0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01068c3:	eb a6                	jmp    f010686b <vprintfmt+0x19b>
+					putch(ch, putdat);
+f01068c5:	83 ec 08             	sub    $0x8,%esp
+f01068c8:	53                   	push   %ebx
+f01068c9:	52                   	push   %edx
+f01068ca:	ff 55 08             	call   *0x8(%ebp)
+f01068cd:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+f01068d0:	89 f1                	mov    %esi,%ecx
+f01068d2:	8d 71 01             	lea    0x1(%ecx),%esi
+f01068d5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+f01068d9:	0f be d0             	movsbl %al,%edx
+f01068dc:	85 d2                	test   %edx,%edx
+f01068de:	74 28                	je     f0106908 <vprintfmt+0x238>
+f01068e0:	85 ff                	test   %edi,%edi
+f01068e2:	78 05                	js     f01068e9 <vprintfmt+0x219>
+f01068e4:	83 ef 01             	sub    $0x1,%edi
+f01068e7:	78 30                	js     f0106919 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+f01068e9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+f01068ed:	74 d6                	je     f01068c5 <vprintfmt+0x1f5>
+f01068ef:	0f be c0             	movsbl %al,%eax
+f01068f2:	83 e8 20             	sub    $0x20,%eax
+f01068f5:	83 f8 5e             	cmp    $0x5e,%eax
+f01068f8:	76 cb                	jbe    f01068c5 <vprintfmt+0x1f5>
+					putch('?', putdat);
+f01068fa:	83 ec 08             	sub    $0x8,%esp
+f01068fd:	53                   	push   %ebx
+f01068fe:	6a 3f                	push   $0x3f
+f0106900:	ff 55 08             	call   *0x8(%ebp)
+f0106903:	83 c4 10             	add    $0x10,%esp
+f0106906:	eb c8                	jmp    f01068d0 <vprintfmt+0x200>
+f0106908:	8b 75 08             	mov    0x8(%ebp),%esi
+f010690b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010690e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0106911:	01 d0                	add    %edx,%eax
+f0106913:	29 c8                	sub    %ecx,%eax
+f0106915:	89 c7                	mov    %eax,%edi
+f0106917:	eb 13                	jmp    f010692c <vprintfmt+0x25c>
+f0106919:	8b 75 08             	mov    0x8(%ebp),%esi
+f010691c:	eb ed                	jmp    f010690b <vprintfmt+0x23b>
+				putch(' ', putdat);
+f010691e:	83 ec 08             	sub    $0x8,%esp
+f0106921:	53                   	push   %ebx
+f0106922:	6a 20                	push   $0x20
+f0106924:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+f0106926:	83 ef 01             	sub    $0x1,%edi
+f0106929:	83 c4 10             	add    $0x10,%esp
+f010692c:	85 ff                	test   %edi,%edi
+f010692e:	7f ee                	jg     f010691e <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+f0106930:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f0106933:	89 45 14             	mov    %eax,0x14(%ebp)
+f0106936:	e9 6b 01 00 00       	jmp    f0106aa6 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+f010693b:	83 f9 01             	cmp    $0x1,%ecx
+f010693e:	7f 1f                	jg     f010695f <vprintfmt+0x28f>
+	else if (lflag)
+f0106940:	85 c9                	test   %ecx,%ecx
+f0106942:	74 67                	je     f01069ab <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+f0106944:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106947:	8b 00                	mov    (%eax),%eax
+f0106949:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f010694c:	89 c1                	mov    %eax,%ecx
+f010694e:	c1 f9 1f             	sar    $0x1f,%ecx
+f0106951:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0106954:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106957:	8d 40 04             	lea    0x4(%eax),%eax
+f010695a:	89 45 14             	mov    %eax,0x14(%ebp)
+f010695d:	eb 17                	jmp    f0106976 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+f010695f:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106962:	8b 50 04             	mov    0x4(%eax),%edx
+f0106965:	8b 00                	mov    (%eax),%eax
+f0106967:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f010696a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f010696d:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106970:	8d 40 08             	lea    0x8(%eax),%eax
+f0106973:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+f0106976:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0106979:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+f010697c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+f0106981:	85 c9                	test   %ecx,%ecx
+f0106983:	0f 89 03 01 00 00    	jns    f0106a8c <vprintfmt+0x3bc>
+				putch('-', putdat);
+f0106989:	83 ec 08             	sub    $0x8,%esp
+f010698c:	53                   	push   %ebx
+f010698d:	6a 2d                	push   $0x2d
+f010698f:	ff d6                	call   *%esi
+				num = -(long long) num;
+f0106991:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0106994:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0106997:	f7 da                	neg    %edx
+f0106999:	83 d1 00             	adc    $0x0,%ecx
+f010699c:	f7 d9                	neg    %ecx
+f010699e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+f01069a1:	bf 0a 00 00 00       	mov    $0xa,%edi
+f01069a6:	e9 e1 00 00 00       	jmp    f0106a8c <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+f01069ab:	8b 45 14             	mov    0x14(%ebp),%eax
+f01069ae:	8b 00                	mov    (%eax),%eax
+f01069b0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f01069b3:	89 c1                	mov    %eax,%ecx
+f01069b5:	c1 f9 1f             	sar    $0x1f,%ecx
+f01069b8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f01069bb:	8b 45 14             	mov    0x14(%ebp),%eax
+f01069be:	8d 40 04             	lea    0x4(%eax),%eax
+f01069c1:	89 45 14             	mov    %eax,0x14(%ebp)
+f01069c4:	eb b0                	jmp    f0106976 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+f01069c6:	83 f9 01             	cmp    $0x1,%ecx
+f01069c9:	7f 1e                	jg     f01069e9 <vprintfmt+0x319>
+	else if (lflag)
+f01069cb:	85 c9                	test   %ecx,%ecx
+f01069cd:	74 32                	je     f0106a01 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+f01069cf:	8b 45 14             	mov    0x14(%ebp),%eax
+f01069d2:	8b 10                	mov    (%eax),%edx
+f01069d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01069d9:	8d 40 04             	lea    0x4(%eax),%eax
+f01069dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f01069df:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+f01069e4:	e9 a3 00 00 00       	jmp    f0106a8c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+f01069e9:	8b 45 14             	mov    0x14(%ebp),%eax
+f01069ec:	8b 10                	mov    (%eax),%edx
+f01069ee:	8b 48 04             	mov    0x4(%eax),%ecx
+f01069f1:	8d 40 08             	lea    0x8(%eax),%eax
+f01069f4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f01069f7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+f01069fc:	e9 8b 00 00 00       	jmp    f0106a8c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+f0106a01:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106a04:	8b 10                	mov    (%eax),%edx
+f0106a06:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0106a0b:	8d 40 04             	lea    0x4(%eax),%eax
+f0106a0e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+f0106a11:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+f0106a16:	eb 74                	jmp    f0106a8c <vprintfmt+0x3bc>
+	if (lflag >= 2)
+f0106a18:	83 f9 01             	cmp    $0x1,%ecx
+f0106a1b:	7f 1b                	jg     f0106a38 <vprintfmt+0x368>
+	else if (lflag)
+f0106a1d:	85 c9                	test   %ecx,%ecx
+f0106a1f:	74 2c                	je     f0106a4d <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+f0106a21:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106a24:	8b 10                	mov    (%eax),%edx
+f0106a26:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0106a2b:	8d 40 04             	lea    0x4(%eax),%eax
+f0106a2e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f0106a31:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+f0106a36:	eb 54                	jmp    f0106a8c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+f0106a38:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106a3b:	8b 10                	mov    (%eax),%edx
+f0106a3d:	8b 48 04             	mov    0x4(%eax),%ecx
+f0106a40:	8d 40 08             	lea    0x8(%eax),%eax
+f0106a43:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f0106a46:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+f0106a4b:	eb 3f                	jmp    f0106a8c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+f0106a4d:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106a50:	8b 10                	mov    (%eax),%edx
+f0106a52:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0106a57:	8d 40 04             	lea    0x4(%eax),%eax
+f0106a5a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+f0106a5d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+f0106a62:	eb 28                	jmp    f0106a8c <vprintfmt+0x3bc>
+			putch('0', putdat);
+f0106a64:	83 ec 08             	sub    $0x8,%esp
+f0106a67:	53                   	push   %ebx
+f0106a68:	6a 30                	push   $0x30
+f0106a6a:	ff d6                	call   *%esi
+			putch('x', putdat);
+f0106a6c:	83 c4 08             	add    $0x8,%esp
+f0106a6f:	53                   	push   %ebx
+f0106a70:	6a 78                	push   $0x78
+f0106a72:	ff d6                	call   *%esi
+			num = (unsigned long long)
+f0106a74:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106a77:	8b 10                	mov    (%eax),%edx
+f0106a79:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+f0106a7e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+f0106a81:	8d 40 04             	lea    0x4(%eax),%eax
+f0106a84:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0106a87:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+f0106a8c:	83 ec 0c             	sub    $0xc,%esp
+f0106a8f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+f0106a93:	50                   	push   %eax
+f0106a94:	ff 75 e0             	push   -0x20(%ebp)
+f0106a97:	57                   	push   %edi
+f0106a98:	51                   	push   %ecx
+f0106a99:	52                   	push   %edx
+f0106a9a:	89 da                	mov    %ebx,%edx
+f0106a9c:	89 f0                	mov    %esi,%eax
+f0106a9e:	e8 4a fb ff ff       	call   f01065ed <printnum>
+			break;
+f0106aa3:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+f0106aa6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f0106aa9:	e9 40 fc ff ff       	jmp    f01066ee <vprintfmt+0x1e>
+	if (lflag >= 2)
+f0106aae:	83 f9 01             	cmp    $0x1,%ecx
+f0106ab1:	7f 1b                	jg     f0106ace <vprintfmt+0x3fe>
+	else if (lflag)
+f0106ab3:	85 c9                	test   %ecx,%ecx
+f0106ab5:	74 2c                	je     f0106ae3 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+f0106ab7:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106aba:	8b 10                	mov    (%eax),%edx
+f0106abc:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0106ac1:	8d 40 04             	lea    0x4(%eax),%eax
+f0106ac4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0106ac7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+f0106acc:	eb be                	jmp    f0106a8c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+f0106ace:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106ad1:	8b 10                	mov    (%eax),%edx
+f0106ad3:	8b 48 04             	mov    0x4(%eax),%ecx
+f0106ad6:	8d 40 08             	lea    0x8(%eax),%eax
+f0106ad9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0106adc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+f0106ae1:	eb a9                	jmp    f0106a8c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+f0106ae3:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106ae6:	8b 10                	mov    (%eax),%edx
+f0106ae8:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0106aed:	8d 40 04             	lea    0x4(%eax),%eax
+f0106af0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+f0106af3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+f0106af8:	eb 92                	jmp    f0106a8c <vprintfmt+0x3bc>
+			putch(ch, putdat);
+f0106afa:	83 ec 08             	sub    $0x8,%esp
+f0106afd:	53                   	push   %ebx
+f0106afe:	6a 25                	push   $0x25
+f0106b00:	ff d6                	call   *%esi
+			break;
+f0106b02:	83 c4 10             	add    $0x10,%esp
+f0106b05:	eb 9f                	jmp    f0106aa6 <vprintfmt+0x3d6>
+			putch('%', putdat);
+f0106b07:	83 ec 08             	sub    $0x8,%esp
+f0106b0a:	53                   	push   %ebx
+f0106b0b:	6a 25                	push   $0x25
+f0106b0d:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+f0106b0f:	83 c4 10             	add    $0x10,%esp
+f0106b12:	89 f8                	mov    %edi,%eax
+f0106b14:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+f0106b18:	74 05                	je     f0106b1f <vprintfmt+0x44f>
+f0106b1a:	83 e8 01             	sub    $0x1,%eax
+f0106b1d:	eb f5                	jmp    f0106b14 <vprintfmt+0x444>
+f0106b1f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0106b22:	eb 82                	jmp    f0106aa6 <vprintfmt+0x3d6>
+
+f0106b24 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+f0106b24:	55                   	push   %ebp
+f0106b25:	89 e5                	mov    %esp,%ebp
+f0106b27:	83 ec 18             	sub    $0x18,%esp
+f0106b2a:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106b2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+f0106b30:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f0106b33:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+f0106b37:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f0106b3a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+f0106b41:	85 c0                	test   %eax,%eax
+f0106b43:	74 26                	je     f0106b6b <vsnprintf+0x47>
+f0106b45:	85 d2                	test   %edx,%edx
+f0106b47:	7e 22                	jle    f0106b6b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+f0106b49:	ff 75 14             	push   0x14(%ebp)
+f0106b4c:	ff 75 10             	push   0x10(%ebp)
+f0106b4f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+f0106b52:	50                   	push   %eax
+f0106b53:	68 96 66 10 f0       	push   $0xf0106696
+f0106b58:	e8 73 fb ff ff       	call   f01066d0 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+f0106b5d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f0106b60:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+f0106b63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0106b66:	83 c4 10             	add    $0x10,%esp
+}
+f0106b69:	c9                   	leave
+f0106b6a:	c3                   	ret
+		return -E_INVAL;
+f0106b6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106b70:	eb f7                	jmp    f0106b69 <vsnprintf+0x45>
+
+f0106b72 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+f0106b72:	55                   	push   %ebp
+f0106b73:	89 e5                	mov    %esp,%ebp
+f0106b75:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+f0106b78:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+f0106b7b:	50                   	push   %eax
+f0106b7c:	ff 75 10             	push   0x10(%ebp)
+f0106b7f:	ff 75 0c             	push   0xc(%ebp)
+f0106b82:	ff 75 08             	push   0x8(%ebp)
+f0106b85:	e8 9a ff ff ff       	call   f0106b24 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+f0106b8a:	c9                   	leave
+f0106b8b:	c3                   	ret
+
+f0106b8c <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+f0106b8c:	55                   	push   %ebp
+f0106b8d:	89 e5                	mov    %esp,%ebp
+f0106b8f:	57                   	push   %edi
+f0106b90:	56                   	push   %esi
+f0106b91:	53                   	push   %ebx
+f0106b92:	83 ec 0c             	sub    $0xc,%esp
+f0106b95:	8b 45 08             	mov    0x8(%ebp),%eax
+	int i, c, echoing;
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+f0106b98:	85 c0                	test   %eax,%eax
+f0106b9a:	74 11                	je     f0106bad <readline+0x21>
+		cprintf("%s", prompt);
+f0106b9c:	83 ec 08             	sub    $0x8,%esp
+f0106b9f:	50                   	push   %eax
+f0106ba0:	68 37 aa 10 f0       	push   $0xf010aa37
+f0106ba5:	e8 37 d8 ff ff       	call   f01043e1 <cprintf>
+f0106baa:	83 c4 10             	add    $0x10,%esp
+	if (prompt != NULL)
+		fprintf(1, "%s", prompt);
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+f0106bad:	83 ec 0c             	sub    $0xc,%esp
+f0106bb0:	6a 00                	push   $0x0
+f0106bb2:	e8 28 9c ff ff       	call   f01007df <iscons>
+f0106bb7:	89 c7                	mov    %eax,%edi
+f0106bb9:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+f0106bbc:	be 00 00 00 00       	mov    $0x0,%esi
+f0106bc1:	eb 4b                	jmp    f0106c0e <readline+0x82>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+f0106bc3:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+f0106bc8:	83 fb f8             	cmp    $0xfffffff8,%ebx
+f0106bcb:	75 08                	jne    f0106bd5 <readline+0x49>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+f0106bcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106bd0:	5b                   	pop    %ebx
+f0106bd1:	5e                   	pop    %esi
+f0106bd2:	5f                   	pop    %edi
+f0106bd3:	5d                   	pop    %ebp
+f0106bd4:	c3                   	ret
+				cprintf("read error: %e\n", c);
+f0106bd5:	83 ec 08             	sub    $0x8,%esp
+f0106bd8:	53                   	push   %ebx
+f0106bd9:	68 27 c6 10 f0       	push   $0xf010c627
+f0106bde:	e8 fe d7 ff ff       	call   f01043e1 <cprintf>
+f0106be3:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+f0106be6:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106beb:	eb e0                	jmp    f0106bcd <readline+0x41>
+			if (echoing)
+f0106bed:	85 ff                	test   %edi,%edi
+f0106bef:	75 05                	jne    f0106bf6 <readline+0x6a>
+			i--;
+f0106bf1:	83 ee 01             	sub    $0x1,%esi
+f0106bf4:	eb 18                	jmp    f0106c0e <readline+0x82>
+				cputchar('\b');
+f0106bf6:	83 ec 0c             	sub    $0xc,%esp
+f0106bf9:	6a 08                	push   $0x8
+f0106bfb:	e8 be 9b ff ff       	call   f01007be <cputchar>
+f0106c00:	83 c4 10             	add    $0x10,%esp
+f0106c03:	eb ec                	jmp    f0106bf1 <readline+0x65>
+			buf[i++] = c;
+f0106c05:	88 9e 40 cb 7f f0    	mov    %bl,-0xf8034c0(%esi)
+f0106c0b:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+f0106c0e:	e8 bb 9b ff ff       	call   f01007ce <getchar>
+f0106c13:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+f0106c15:	85 c0                	test   %eax,%eax
+f0106c17:	78 aa                	js     f0106bc3 <readline+0x37>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+f0106c19:	83 f8 08             	cmp    $0x8,%eax
+f0106c1c:	0f 94 c0             	sete   %al
+f0106c1f:	83 fb 7f             	cmp    $0x7f,%ebx
+f0106c22:	0f 94 c2             	sete   %dl
+f0106c25:	08 d0                	or     %dl,%al
+f0106c27:	74 04                	je     f0106c2d <readline+0xa1>
+f0106c29:	85 f6                	test   %esi,%esi
+f0106c2b:	7f c0                	jg     f0106bed <readline+0x61>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+f0106c2d:	83 fb 1f             	cmp    $0x1f,%ebx
+f0106c30:	7e 1a                	jle    f0106c4c <readline+0xc0>
+f0106c32:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+f0106c38:	7f 12                	jg     f0106c4c <readline+0xc0>
+			if (echoing)
+f0106c3a:	85 ff                	test   %edi,%edi
+f0106c3c:	74 c7                	je     f0106c05 <readline+0x79>
+				cputchar(c);
+f0106c3e:	83 ec 0c             	sub    $0xc,%esp
+f0106c41:	53                   	push   %ebx
+f0106c42:	e8 77 9b ff ff       	call   f01007be <cputchar>
+f0106c47:	83 c4 10             	add    $0x10,%esp
+f0106c4a:	eb b9                	jmp    f0106c05 <readline+0x79>
+		} else if (c == '\n' || c == '\r') {
+f0106c4c:	83 fb 0a             	cmp    $0xa,%ebx
+f0106c4f:	74 05                	je     f0106c56 <readline+0xca>
+f0106c51:	83 fb 0d             	cmp    $0xd,%ebx
+f0106c54:	75 b8                	jne    f0106c0e <readline+0x82>
+			if (echoing)
+f0106c56:	85 ff                	test   %edi,%edi
+f0106c58:	75 11                	jne    f0106c6b <readline+0xdf>
+			buf[i] = 0;
+f0106c5a:	c6 86 40 cb 7f f0 00 	movb   $0x0,-0xf8034c0(%esi)
+			return buf;
+f0106c61:	b8 40 cb 7f f0       	mov    $0xf07fcb40,%eax
+f0106c66:	e9 62 ff ff ff       	jmp    f0106bcd <readline+0x41>
+				cputchar('\n');
+f0106c6b:	83 ec 0c             	sub    $0xc,%esp
+f0106c6e:	6a 0a                	push   $0xa
+f0106c70:	e8 49 9b ff ff       	call   f01007be <cputchar>
+f0106c75:	83 c4 10             	add    $0x10,%esp
+f0106c78:	eb e0                	jmp    f0106c5a <readline+0xce>
+
+f0106c7a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+f0106c7a:	55                   	push   %ebp
+f0106c7b:	89 e5                	mov    %esp,%ebp
+f0106c7d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+f0106c80:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106c85:	eb 03                	jmp    f0106c8a <strlen+0x10>
+		n++;
+f0106c87:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+f0106c8a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+f0106c8e:	75 f7                	jne    f0106c87 <strlen+0xd>
+	return n;
+}
+f0106c90:	5d                   	pop    %ebp
+f0106c91:	c3                   	ret
+
+f0106c92 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+f0106c92:	55                   	push   %ebp
+f0106c93:	89 e5                	mov    %esp,%ebp
+f0106c95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f0106c98:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0106c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106ca0:	eb 03                	jmp    f0106ca5 <strnlen+0x13>
+		n++;
+f0106ca2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f0106ca5:	39 d0                	cmp    %edx,%eax
+f0106ca7:	74 08                	je     f0106cb1 <strnlen+0x1f>
+f0106ca9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+f0106cad:	75 f3                	jne    f0106ca2 <strnlen+0x10>
+f0106caf:	89 c2                	mov    %eax,%edx
+	return n;
+}
+f0106cb1:	89 d0                	mov    %edx,%eax
+f0106cb3:	5d                   	pop    %ebp
+f0106cb4:	c3                   	ret
+
+f0106cb5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+f0106cb5:	55                   	push   %ebp
+f0106cb6:	89 e5                	mov    %esp,%ebp
+f0106cb8:	53                   	push   %ebx
+f0106cb9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0106cbc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+f0106cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106cc4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+f0106cc8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+f0106ccb:	83 c0 01             	add    $0x1,%eax
+f0106cce:	84 d2                	test   %dl,%dl
+f0106cd0:	75 f2                	jne    f0106cc4 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+f0106cd2:	89 c8                	mov    %ecx,%eax
+f0106cd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0106cd7:	c9                   	leave
+f0106cd8:	c3                   	ret
+
+f0106cd9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+f0106cd9:	55                   	push   %ebp
+f0106cda:	89 e5                	mov    %esp,%ebp
+f0106cdc:	53                   	push   %ebx
+f0106cdd:	83 ec 10             	sub    $0x10,%esp
+f0106ce0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+f0106ce3:	53                   	push   %ebx
+f0106ce4:	e8 91 ff ff ff       	call   f0106c7a <strlen>
+f0106ce9:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+f0106cec:	ff 75 0c             	push   0xc(%ebp)
+f0106cef:	01 d8                	add    %ebx,%eax
+f0106cf1:	50                   	push   %eax
+f0106cf2:	e8 be ff ff ff       	call   f0106cb5 <strcpy>
+	return dst;
+}
+f0106cf7:	89 d8                	mov    %ebx,%eax
+f0106cf9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0106cfc:	c9                   	leave
+f0106cfd:	c3                   	ret
+
+f0106cfe <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+f0106cfe:	55                   	push   %ebp
+f0106cff:	89 e5                	mov    %esp,%ebp
+f0106d01:	56                   	push   %esi
+f0106d02:	53                   	push   %ebx
+f0106d03:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106d06:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+f0106d09:	89 f3                	mov    %esi,%ebx
+f0106d0b:	03 5d 10             	add    0x10(%ebp),%ebx
+f0106d0e:	89 f0                	mov    %esi,%eax
+f0106d10:	eb 0f                	jmp    f0106d21 <strncpy+0x23>
+		*dst++ = *src;
+f0106d12:	83 c0 01             	add    $0x1,%eax
+f0106d15:	0f b6 0a             	movzbl (%edx),%ecx
+f0106d18:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+f0106d1b:	80 f9 01             	cmp    $0x1,%cl
+f0106d1e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+f0106d21:	39 d8                	cmp    %ebx,%eax
+f0106d23:	75 ed                	jne    f0106d12 <strncpy+0x14>
+	}
+	return ret;
+}
+f0106d25:	89 f0                	mov    %esi,%eax
+f0106d27:	5b                   	pop    %ebx
+f0106d28:	5e                   	pop    %esi
+f0106d29:	5d                   	pop    %ebp
+f0106d2a:	c3                   	ret
+
+f0106d2b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+f0106d2b:	55                   	push   %ebp
+f0106d2c:	89 e5                	mov    %esp,%ebp
+f0106d2e:	56                   	push   %esi
+f0106d2f:	53                   	push   %ebx
+f0106d30:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106d33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0106d36:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+f0106d39:	89 f0                	mov    %esi,%eax
+f0106d3b:	85 d2                	test   %edx,%edx
+f0106d3d:	74 21                	je     f0106d60 <strlcpy+0x35>
+f0106d3f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+f0106d43:	89 f2                	mov    %esi,%edx
+f0106d45:	eb 09                	jmp    f0106d50 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+f0106d47:	83 c1 01             	add    $0x1,%ecx
+f0106d4a:	83 c2 01             	add    $0x1,%edx
+f0106d4d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+f0106d50:	39 c2                	cmp    %eax,%edx
+f0106d52:	74 09                	je     f0106d5d <strlcpy+0x32>
+f0106d54:	0f b6 19             	movzbl (%ecx),%ebx
+f0106d57:	84 db                	test   %bl,%bl
+f0106d59:	75 ec                	jne    f0106d47 <strlcpy+0x1c>
+f0106d5b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+f0106d5d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+f0106d60:	29 f0                	sub    %esi,%eax
+}
+f0106d62:	5b                   	pop    %ebx
+f0106d63:	5e                   	pop    %esi
+f0106d64:	5d                   	pop    %ebp
+f0106d65:	c3                   	ret
+
+f0106d66 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+f0106d66:	55                   	push   %ebp
+f0106d67:	89 e5                	mov    %esp,%ebp
+f0106d69:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0106d6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+f0106d6f:	eb 06                	jmp    f0106d77 <strcmp+0x11>
+		p++, q++;
+f0106d71:	83 c1 01             	add    $0x1,%ecx
+f0106d74:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+f0106d77:	0f b6 01             	movzbl (%ecx),%eax
+f0106d7a:	84 c0                	test   %al,%al
+f0106d7c:	74 04                	je     f0106d82 <strcmp+0x1c>
+f0106d7e:	3a 02                	cmp    (%edx),%al
+f0106d80:	74 ef                	je     f0106d71 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+f0106d82:	0f b6 c0             	movzbl %al,%eax
+f0106d85:	0f b6 12             	movzbl (%edx),%edx
+f0106d88:	29 d0                	sub    %edx,%eax
+}
+f0106d8a:	5d                   	pop    %ebp
+f0106d8b:	c3                   	ret
+
+f0106d8c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+f0106d8c:	55                   	push   %ebp
+f0106d8d:	89 e5                	mov    %esp,%ebp
+f0106d8f:	53                   	push   %ebx
+f0106d90:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106d93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0106d96:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+f0106d99:	eb 09                	jmp    f0106da4 <strncmp+0x18>
+		n--, p++, q++;
+f0106d9b:	83 ea 01             	sub    $0x1,%edx
+f0106d9e:	83 c0 01             	add    $0x1,%eax
+f0106da1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+f0106da4:	85 d2                	test   %edx,%edx
+f0106da6:	74 18                	je     f0106dc0 <strncmp+0x34>
+f0106da8:	0f b6 18             	movzbl (%eax),%ebx
+f0106dab:	84 db                	test   %bl,%bl
+f0106dad:	74 04                	je     f0106db3 <strncmp+0x27>
+f0106daf:	3a 19                	cmp    (%ecx),%bl
+f0106db1:	74 e8                	je     f0106d9b <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+f0106db3:	0f b6 00             	movzbl (%eax),%eax
+f0106db6:	0f b6 11             	movzbl (%ecx),%edx
+f0106db9:	29 d0                	sub    %edx,%eax
+}
+f0106dbb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0106dbe:	c9                   	leave
+f0106dbf:	c3                   	ret
+		return 0;
+f0106dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106dc5:	eb f4                	jmp    f0106dbb <strncmp+0x2f>
+
+f0106dc7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+f0106dc7:	55                   	push   %ebp
+f0106dc8:	89 e5                	mov    %esp,%ebp
+f0106dca:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106dcd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f0106dd1:	eb 03                	jmp    f0106dd6 <strchr+0xf>
+f0106dd3:	83 c0 01             	add    $0x1,%eax
+f0106dd6:	0f b6 10             	movzbl (%eax),%edx
+f0106dd9:	84 d2                	test   %dl,%dl
+f0106ddb:	74 06                	je     f0106de3 <strchr+0x1c>
+		if (*s == c)
+f0106ddd:	38 ca                	cmp    %cl,%dl
+f0106ddf:	75 f2                	jne    f0106dd3 <strchr+0xc>
+f0106de1:	eb 05                	jmp    f0106de8 <strchr+0x21>
+			return (char *) s;
+	return 0;
+f0106de3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0106de8:	5d                   	pop    %ebp
+f0106de9:	c3                   	ret
+
+f0106dea <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+f0106dea:	55                   	push   %ebp
+f0106deb:	89 e5                	mov    %esp,%ebp
+f0106ded:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106df0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f0106df4:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+f0106df7:	38 ca                	cmp    %cl,%dl
+f0106df9:	74 09                	je     f0106e04 <strfind+0x1a>
+f0106dfb:	84 d2                	test   %dl,%dl
+f0106dfd:	74 05                	je     f0106e04 <strfind+0x1a>
+	for (; *s; s++)
+f0106dff:	83 c0 01             	add    $0x1,%eax
+f0106e02:	eb f0                	jmp    f0106df4 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+f0106e04:	5d                   	pop    %ebp
+f0106e05:	c3                   	ret
+
+f0106e06 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+f0106e06:	55                   	push   %ebp
+f0106e07:	89 e5                	mov    %esp,%ebp
+f0106e09:	57                   	push   %edi
+f0106e0a:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0106e0d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+f0106e10:	85 c9                	test   %ecx,%ecx
+f0106e12:	74 20                	je     f0106e34 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+f0106e14:	89 f8                	mov    %edi,%eax
+f0106e16:	09 c8                	or     %ecx,%eax
+f0106e18:	a8 03                	test   $0x3,%al
+f0106e1a:	75 12                	jne    f0106e2e <memset+0x28>
+		c &= 0xFF;
+f0106e1c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+f0106e20:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+f0106e26:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+f0106e29:	fc                   	cld
+f0106e2a:	f3 ab                	rep stos %eax,%es:(%edi)
+f0106e2c:	eb 06                	jmp    f0106e34 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+f0106e2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106e31:	fc                   	cld
+f0106e32:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+f0106e34:	89 f8                	mov    %edi,%eax
+f0106e36:	8b 7d fc             	mov    -0x4(%ebp),%edi
+f0106e39:	c9                   	leave
+f0106e3a:	c3                   	ret
+
+f0106e3b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+f0106e3b:	55                   	push   %ebp
+f0106e3c:	89 e5                	mov    %esp,%ebp
+f0106e3e:	57                   	push   %edi
+f0106e3f:	56                   	push   %esi
+f0106e40:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106e43:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0106e46:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+f0106e49:	39 c6                	cmp    %eax,%esi
+f0106e4b:	73 32                	jae    f0106e7f <memmove+0x44>
+f0106e4d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+f0106e50:	39 d0                	cmp    %edx,%eax
+f0106e52:	73 2b                	jae    f0106e7f <memmove+0x44>
+		s += n;
+		d += n;
+f0106e54:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f0106e57:	89 d6                	mov    %edx,%esi
+f0106e59:	09 fe                	or     %edi,%esi
+f0106e5b:	09 ce                	or     %ecx,%esi
+f0106e5d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f0106e63:	75 0e                	jne    f0106e73 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+f0106e65:	83 ef 04             	sub    $0x4,%edi
+f0106e68:	8d 72 fc             	lea    -0x4(%edx),%esi
+f0106e6b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+f0106e6e:	fd                   	std
+f0106e6f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0106e71:	eb 09                	jmp    f0106e7c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+f0106e73:	83 ef 01             	sub    $0x1,%edi
+f0106e76:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+f0106e79:	fd                   	std
+f0106e7a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+f0106e7c:	fc                   	cld
+f0106e7d:	eb 1a                	jmp    f0106e99 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f0106e7f:	89 f2                	mov    %esi,%edx
+f0106e81:	09 c2                	or     %eax,%edx
+f0106e83:	09 ca                	or     %ecx,%edx
+f0106e85:	f6 c2 03             	test   $0x3,%dl
+f0106e88:	75 0a                	jne    f0106e94 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+f0106e8a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+f0106e8d:	89 c7                	mov    %eax,%edi
+f0106e8f:	fc                   	cld
+f0106e90:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0106e92:	eb 05                	jmp    f0106e99 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+f0106e94:	89 c7                	mov    %eax,%edi
+f0106e96:	fc                   	cld
+f0106e97:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+f0106e99:	5e                   	pop    %esi
+f0106e9a:	5f                   	pop    %edi
+f0106e9b:	5d                   	pop    %ebp
+f0106e9c:	c3                   	ret
+
+f0106e9d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+f0106e9d:	55                   	push   %ebp
+f0106e9e:	89 e5                	mov    %esp,%ebp
+f0106ea0:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+f0106ea3:	ff 75 10             	push   0x10(%ebp)
+f0106ea6:	ff 75 0c             	push   0xc(%ebp)
+f0106ea9:	ff 75 08             	push   0x8(%ebp)
+f0106eac:	e8 8a ff ff ff       	call   f0106e3b <memmove>
+}
+f0106eb1:	c9                   	leave
+f0106eb2:	c3                   	ret
+
+f0106eb3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+f0106eb3:	55                   	push   %ebp
+f0106eb4:	89 e5                	mov    %esp,%ebp
+f0106eb6:	56                   	push   %esi
+f0106eb7:	53                   	push   %ebx
+f0106eb8:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106ebb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+f0106ebe:	89 c6                	mov    %eax,%esi
+f0106ec0:	03 75 10             	add    0x10(%ebp),%esi
+f0106ec3:	eb 06                	jmp    f0106ecb <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+f0106ec5:	83 c0 01             	add    $0x1,%eax
+f0106ec8:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+f0106ecb:	39 f0                	cmp    %esi,%eax
+f0106ecd:	74 14                	je     f0106ee3 <memcmp+0x30>
+		if (*s1 != *s2)
+f0106ecf:	0f b6 08             	movzbl (%eax),%ecx
+f0106ed2:	0f b6 1a             	movzbl (%edx),%ebx
+f0106ed5:	38 d9                	cmp    %bl,%cl
+f0106ed7:	74 ec                	je     f0106ec5 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+f0106ed9:	0f b6 c1             	movzbl %cl,%eax
+f0106edc:	0f b6 db             	movzbl %bl,%ebx
+f0106edf:	29 d8                	sub    %ebx,%eax
+f0106ee1:	eb 05                	jmp    f0106ee8 <memcmp+0x35>
+	}
+
+	return 0;
+f0106ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0106ee8:	5b                   	pop    %ebx
+f0106ee9:	5e                   	pop    %esi
+f0106eea:	5d                   	pop    %ebp
+f0106eeb:	c3                   	ret
+
+f0106eec <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+f0106eec:	55                   	push   %ebp
+f0106eed:	89 e5                	mov    %esp,%ebp
+f0106eef:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106ef2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+f0106ef5:	89 c2                	mov    %eax,%edx
+f0106ef7:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+f0106efa:	eb 03                	jmp    f0106eff <memfind+0x13>
+f0106efc:	83 c0 01             	add    $0x1,%eax
+f0106eff:	39 d0                	cmp    %edx,%eax
+f0106f01:	73 04                	jae    f0106f07 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+f0106f03:	38 08                	cmp    %cl,(%eax)
+f0106f05:	75 f5                	jne    f0106efc <memfind+0x10>
+			break;
+	return (void *) s;
+}
+f0106f07:	5d                   	pop    %ebp
+f0106f08:	c3                   	ret
+
+f0106f09 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+f0106f09:	55                   	push   %ebp
+f0106f0a:	89 e5                	mov    %esp,%ebp
+f0106f0c:	57                   	push   %edi
+f0106f0d:	56                   	push   %esi
+f0106f0e:	53                   	push   %ebx
+f0106f0f:	8b 55 08             	mov    0x8(%ebp),%edx
+f0106f12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+f0106f15:	eb 03                	jmp    f0106f1a <strtol+0x11>
+		s++;
+f0106f17:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+f0106f1a:	0f b6 02             	movzbl (%edx),%eax
+f0106f1d:	3c 20                	cmp    $0x20,%al
+f0106f1f:	74 f6                	je     f0106f17 <strtol+0xe>
+f0106f21:	3c 09                	cmp    $0x9,%al
+f0106f23:	74 f2                	je     f0106f17 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+f0106f25:	3c 2b                	cmp    $0x2b,%al
+f0106f27:	74 2a                	je     f0106f53 <strtol+0x4a>
+	int neg = 0;
+f0106f29:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+f0106f2e:	3c 2d                	cmp    $0x2d,%al
+f0106f30:	74 2b                	je     f0106f5d <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f0106f32:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+f0106f38:	75 0f                	jne    f0106f49 <strtol+0x40>
+f0106f3a:	80 3a 30             	cmpb   $0x30,(%edx)
+f0106f3d:	74 28                	je     f0106f67 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+f0106f3f:	85 db                	test   %ebx,%ebx
+f0106f41:	b8 0a 00 00 00       	mov    $0xa,%eax
+f0106f46:	0f 44 d8             	cmove  %eax,%ebx
+f0106f49:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0106f4e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+f0106f51:	eb 46                	jmp    f0106f99 <strtol+0x90>
+		s++;
+f0106f53:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+f0106f56:	bf 00 00 00 00       	mov    $0x0,%edi
+f0106f5b:	eb d5                	jmp    f0106f32 <strtol+0x29>
+		s++, neg = 1;
+f0106f5d:	83 c2 01             	add    $0x1,%edx
+f0106f60:	bf 01 00 00 00       	mov    $0x1,%edi
+f0106f65:	eb cb                	jmp    f0106f32 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f0106f67:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+f0106f6b:	74 0e                	je     f0106f7b <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+f0106f6d:	85 db                	test   %ebx,%ebx
+f0106f6f:	75 d8                	jne    f0106f49 <strtol+0x40>
+		s++, base = 8;
+f0106f71:	83 c2 01             	add    $0x1,%edx
+f0106f74:	bb 08 00 00 00       	mov    $0x8,%ebx
+f0106f79:	eb ce                	jmp    f0106f49 <strtol+0x40>
+		s += 2, base = 16;
+f0106f7b:	83 c2 02             	add    $0x2,%edx
+f0106f7e:	bb 10 00 00 00       	mov    $0x10,%ebx
+f0106f83:	eb c4                	jmp    f0106f49 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+f0106f85:	0f be c0             	movsbl %al,%eax
+f0106f88:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+f0106f8b:	3b 45 10             	cmp    0x10(%ebp),%eax
+f0106f8e:	7d 3a                	jge    f0106fca <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+f0106f90:	83 c2 01             	add    $0x1,%edx
+f0106f93:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+f0106f97:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+f0106f99:	0f b6 02             	movzbl (%edx),%eax
+f0106f9c:	8d 70 d0             	lea    -0x30(%eax),%esi
+f0106f9f:	89 f3                	mov    %esi,%ebx
+f0106fa1:	80 fb 09             	cmp    $0x9,%bl
+f0106fa4:	76 df                	jbe    f0106f85 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+f0106fa6:	8d 70 9f             	lea    -0x61(%eax),%esi
+f0106fa9:	89 f3                	mov    %esi,%ebx
+f0106fab:	80 fb 19             	cmp    $0x19,%bl
+f0106fae:	77 08                	ja     f0106fb8 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+f0106fb0:	0f be c0             	movsbl %al,%eax
+f0106fb3:	83 e8 57             	sub    $0x57,%eax
+f0106fb6:	eb d3                	jmp    f0106f8b <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+f0106fb8:	8d 70 bf             	lea    -0x41(%eax),%esi
+f0106fbb:	89 f3                	mov    %esi,%ebx
+f0106fbd:	80 fb 19             	cmp    $0x19,%bl
+f0106fc0:	77 08                	ja     f0106fca <strtol+0xc1>
+			dig = *s - 'A' + 10;
+f0106fc2:	0f be c0             	movsbl %al,%eax
+f0106fc5:	83 e8 37             	sub    $0x37,%eax
+f0106fc8:	eb c1                	jmp    f0106f8b <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+f0106fca:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f0106fce:	74 05                	je     f0106fd5 <strtol+0xcc>
+		*endptr = (char *) s;
+f0106fd0:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106fd3:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+f0106fd5:	89 c8                	mov    %ecx,%eax
+f0106fd7:	f7 d8                	neg    %eax
+f0106fd9:	85 ff                	test   %edi,%edi
+f0106fdb:	0f 45 c8             	cmovne %eax,%ecx
+}
+f0106fde:	89 c8                	mov    %ecx,%eax
+f0106fe0:	5b                   	pop    %ebx
+f0106fe1:	5e                   	pop    %esi
+f0106fe2:	5f                   	pop    %edi
+f0106fe3:	5d                   	pop    %ebp
+f0106fe4:	c3                   	ret
+f0106fe5:	66 90                	xchg   %ax,%ax
+f0106fe7:	90                   	nop
+
+f0106fe8 <mpentry_start>:
+.set PROT_MODE_DSEG, 0x10	# kernel data segment selector
+
+.code16
+.globl mpentry_start
+mpentry_start:
+	cli
+f0106fe8:	fa                   	cli
+
+	xorw    %ax, %ax
+f0106fe9:	31 c0                	xor    %eax,%eax
+	movw    %ax, %ds
+f0106feb:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f0106fed:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f0106fef:	8e d0                	mov    %eax,%ss
+
+	lgdt    MPBOOTPHYS(gdtdesc)
+f0106ff1:	0f 01 16             	lgdtl  (%esi)
+f0106ff4:	7c 70                	jl     f0107066 <gdtdesc+0x2>
+	movl    %cr0, %eax
+f0106ff6:	0f 20 c0             	mov    %cr0,%eax
+	orl     $CR0_PE, %eax
+f0106ff9:	66 83 c8 01          	or     $0x1,%ax
+	movl    %eax, %cr0
+f0106ffd:	0f 22 c0             	mov    %eax,%cr0
+
+	ljmpl   $(PROT_MODE_CSEG), $(MPBOOTPHYS(start32))
+f0107000:	66 ea 20 70 00 00    	ljmpw  $0x0,$0x7020
+f0107006:	08 00                	or     %al,(%eax)
+
+f0107008 <start32>:
+
+.code32
+start32:
+	movw    $(PROT_MODE_DSEG), %ax
+f0107008:	66 b8 10 00          	mov    $0x10,%ax
+	movw    %ax, %ds
+f010700c:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f010700e:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f0107010:	8e d0                	mov    %eax,%ss
+	movw    $0, %ax
+f0107012:	66 b8 00 00          	mov    $0x0,%ax
+	movw    %ax, %fs
+f0107016:	8e e0                	mov    %eax,%fs
+	movw    %ax, %gs
+f0107018:	8e e8                	mov    %eax,%gs
+
+	# Set up initial page table. We cannot use kern_pgdir yet because
+	# we are still running at a low EIP.
+	movl    $(RELOC(entry_pgdir)), %eax
+f010701a:	b8 00 50 11 00       	mov    $0x115000,%eax
+	movl    %eax, %cr3
+f010701f:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging, with page-size-extension enabled.
+	movl	%cr4, %eax
+f0107022:	0f 20 e0             	mov    %cr4,%eax
+	orl	$(CR4_PSE), %eax
+f0107025:	83 c8 10             	or     $0x10,%eax
+	movl	%eax, %cr4
+f0107028:	0f 22 e0             	mov    %eax,%cr4
+	movl    %cr0, %eax
+f010702b:	0f 20 c0             	mov    %cr0,%eax
+	orl     $(CR0_PE|CR0_PG|CR0_WP), %eax
+f010702e:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl    %eax, %cr0
+f0107033:	0f 22 c0             	mov    %eax,%cr0
+
+	# Switch to the per-cpu stack allocated in boot_aps()
+	movl    mpentry_kstack, %esp
+f0107036:	8b 25 04 c0 7f f0    	mov    0xf07fc004,%esp
+	movl    $0x0, %ebp       # nuke frame pointer
+f010703c:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Call mp_main().  (Exercise for the reader: why the indirect call?)
+	movl    $mp_main, %eax
+f0107041:	b8 da 01 10 f0       	mov    $0xf01001da,%eax
+	call    *%eax
+f0107046:	ff d0                	call   *%eax
+
+f0107048 <spin>:
+
+	# If mp_main returns (it shouldn't), loop.
+spin:
+	jmp     spin
+f0107048:	eb fe                	jmp    f0107048 <spin>
+f010704a:	66 90                	xchg   %ax,%ax
+
+f010704c <gdt>:
+	...
+f0107054:	ff                   	(bad)
+f0107055:	ff 00                	incl   (%eax)
+f0107057:	00 00                	add    %al,(%eax)
+f0107059:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+f0107060:	00                   	.byte 0x0
+f0107061:	92                   	xchg   %eax,%edx
+f0107062:	cf                   	iret
+	...
+
+f0107064 <gdtdesc>:
+f0107064:	17                   	pop    %ss
+f0107065:	00 64 70 00          	add    %ah,0x0(%eax,%esi,2)
+	...
+
+f010706a <mpentry_end>:
+	.word   0x17				# sizeof(gdt) - 1
+	.long   MPBOOTPHYS(gdt)			# address gdt
+
+.globl mpentry_end
+mpentry_end:
+	nop
+f010706a:	90                   	nop
+
+f010706b <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at physical address addr.
+static struct mp *
+mpsearch1(physaddr_t a, int len)
+{
+f010706b:	55                   	push   %ebp
+f010706c:	89 e5                	mov    %esp,%ebp
+f010706e:	57                   	push   %edi
+f010706f:	56                   	push   %esi
+f0107070:	53                   	push   %ebx
+f0107071:	83 ec 0c             	sub    $0xc,%esp
+f0107074:	89 c3                	mov    %eax,%ebx
+f0107076:	89 d7                	mov    %edx,%edi
+f0107078:	a1 ac c2 7f f0       	mov    0xf07fc2ac,%eax
+f010707d:	89 da                	mov    %ebx,%edx
+f010707f:	c1 ea 0c             	shr    $0xc,%edx
+f0107082:	39 c2                	cmp    %eax,%edx
+f0107084:	73 1f                	jae    f01070a5 <mpsearch1+0x3a>
+	return (void *)(pa + KERNBASE);
+f0107086:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+	struct mp *mp = KADDR(a), *end = KADDR(a + len);
+f010708c:	01 df                	add    %ebx,%edi
+	if (PGNUM(pa) >= npages)
+f010708e:	89 fa                	mov    %edi,%edx
+f0107090:	c1 ea 0c             	shr    $0xc,%edx
+f0107093:	39 c2                	cmp    %eax,%edx
+f0107095:	73 20                	jae    f01070b7 <mpsearch1+0x4c>
+	return (void *)(pa + KERNBASE);
+f0107097:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+
+	for (; mp < end; mp++)
+f010709d:	81 eb f0 ff ff 0f    	sub    $0xffffff0,%ebx
+f01070a3:	eb 3a                	jmp    f01070df <mpsearch1+0x74>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01070a5:	53                   	push   %ebx
+f01070a6:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f01070ab:	6a 57                	push   $0x57
+f01070ad:	68 c5 c7 10 f0       	push   $0xf010c7c5
+f01070b2:	e8 92 8f ff ff       	call   f0100049 <_panic>
+f01070b7:	57                   	push   %edi
+f01070b8:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f01070bd:	6a 57                	push   $0x57
+f01070bf:	68 c5 c7 10 f0       	push   $0xf010c7c5
+f01070c4:	e8 80 8f ff ff       	call   f0100049 <_panic>
+		sum += ((uint8_t *)addr)[i];
+f01070c9:	0f b6 0a             	movzbl (%edx),%ecx
+f01070cc:	01 c8                	add    %ecx,%eax
+	for (i = 0; i < len; i++)
+f01070ce:	83 c2 01             	add    $0x1,%edx
+f01070d1:	39 da                	cmp    %ebx,%edx
+f01070d3:	75 f4                	jne    f01070c9 <mpsearch1+0x5e>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f01070d5:	84 c0                	test   %al,%al
+f01070d7:	74 2a                	je     f0107103 <mpsearch1+0x98>
+	for (; mp < end; mp++)
+f01070d9:	83 c6 10             	add    $0x10,%esi
+f01070dc:	83 c3 10             	add    $0x10,%ebx
+f01070df:	39 fe                	cmp    %edi,%esi
+f01070e1:	73 1b                	jae    f01070fe <mpsearch1+0x93>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f01070e3:	83 ec 04             	sub    $0x4,%esp
+f01070e6:	6a 04                	push   $0x4
+f01070e8:	68 d5 c7 10 f0       	push   $0xf010c7d5
+f01070ed:	56                   	push   %esi
+f01070ee:	e8 c0 fd ff ff       	call   f0106eb3 <memcmp>
+f01070f3:	83 c4 10             	add    $0x10,%esp
+f01070f6:	89 f2                	mov    %esi,%edx
+f01070f8:	85 c0                	test   %eax,%eax
+f01070fa:	74 d5                	je     f01070d1 <mpsearch1+0x66>
+f01070fc:	eb db                	jmp    f01070d9 <mpsearch1+0x6e>
+		    sum(mp, sizeof(*mp)) == 0)
+			return mp;
+	return NULL;
+f01070fe:	be 00 00 00 00       	mov    $0x0,%esi
+}
+f0107103:	89 f0                	mov    %esi,%eax
+f0107105:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107108:	5b                   	pop    %ebx
+f0107109:	5e                   	pop    %esi
+f010710a:	5f                   	pop    %edi
+f010710b:	5d                   	pop    %ebp
+f010710c:	c3                   	ret
+
+f010710d <mp_init>:
+	return conf;
+}
+
+void
+mp_init(void)
+{
+f010710d:	55                   	push   %ebp
+f010710e:	89 e5                	mov    %esp,%ebp
+f0107110:	57                   	push   %edi
+f0107111:	56                   	push   %esi
+f0107112:	53                   	push   %ebx
+f0107113:	83 ec 1c             	sub    $0x1c,%esp
+	struct mpconf *conf;
+	struct mpproc *proc;
+	uint8_t *p;
+	unsigned int i;
+
+	bootcpu = &cpus[0];
+f0107116:	c7 05 08 d0 83 f0 20 	movl   $0xf083d020,0xf083d008
+f010711d:	d0 83 f0 
+	if (PGNUM(pa) >= npages)
+f0107120:	83 3d ac c2 7f f0 00 	cmpl   $0x0,0xf07fc2ac
+f0107127:	0f 84 86 00 00 00    	je     f01071b3 <mp_init+0xa6>
+	if ((p = *(uint16_t *) (bda + 0x0E))) {
+f010712d:	0f b7 05 0e 04 00 f0 	movzwl 0xf000040e,%eax
+f0107134:	85 c0                	test   %eax,%eax
+f0107136:	0f 84 8d 00 00 00    	je     f01071c9 <mp_init+0xbc>
+		p <<= 4;	// Translate from segment to PA
+f010713c:	c1 e0 04             	shl    $0x4,%eax
+		if ((mp = mpsearch1(p, 1024)))
+f010713f:	ba 00 04 00 00       	mov    $0x400,%edx
+f0107144:	e8 22 ff ff ff       	call   f010706b <mpsearch1>
+f0107149:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010714c:	85 c0                	test   %eax,%eax
+f010714e:	75 1a                	jne    f010716a <mp_init+0x5d>
+	return mpsearch1(0xF0000, 0x10000);
+f0107150:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0107155:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+f010715a:	e8 0c ff ff ff       	call   f010706b <mpsearch1>
+f010715f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((mp = mpsearch()) == 0)
+f0107162:	85 c0                	test   %eax,%eax
+f0107164:	0f 84 20 02 00 00    	je     f010738a <mp_init+0x27d>
+	if (mp->physaddr == 0 || mp->type != 0) {
+f010716a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010716d:	8b 58 04             	mov    0x4(%eax),%ebx
+f0107170:	85 db                	test   %ebx,%ebx
+f0107172:	74 7a                	je     f01071ee <mp_init+0xe1>
+f0107174:	80 78 0b 00          	cmpb   $0x0,0xb(%eax)
+f0107178:	75 74                	jne    f01071ee <mp_init+0xe1>
+f010717a:	89 d8                	mov    %ebx,%eax
+f010717c:	c1 e8 0c             	shr    $0xc,%eax
+f010717f:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f0107185:	73 7c                	jae    f0107203 <mp_init+0xf6>
+	return (void *)(pa + KERNBASE);
+f0107187:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+f010718d:	89 de                	mov    %ebx,%esi
+	if (memcmp(conf, "PCMP", 4) != 0) {
+f010718f:	83 ec 04             	sub    $0x4,%esp
+f0107192:	6a 04                	push   $0x4
+f0107194:	68 da c7 10 f0       	push   $0xf010c7da
+f0107199:	53                   	push   %ebx
+f010719a:	e8 14 fd ff ff       	call   f0106eb3 <memcmp>
+f010719f:	83 c4 10             	add    $0x10,%esp
+f01071a2:	85 c0                	test   %eax,%eax
+f01071a4:	75 72                	jne    f0107218 <mp_init+0x10b>
+	for (i = 0; i < len; i++)
+f01071a6:	0f b7 7b 04          	movzwl 0x4(%ebx),%edi
+f01071aa:	01 df                	add    %ebx,%edi
+	sum = 0;
+f01071ac:	89 c2                	mov    %eax,%edx
+	for (i = 0; i < len; i++)
+f01071ae:	e9 82 00 00 00       	jmp    f0107235 <mp_init+0x128>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01071b3:	68 00 04 00 00       	push   $0x400
+f01071b8:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f01071bd:	6a 6f                	push   $0x6f
+f01071bf:	68 c5 c7 10 f0       	push   $0xf010c7c5
+f01071c4:	e8 80 8e ff ff       	call   f0100049 <_panic>
+		p = *(uint16_t *) (bda + 0x13) * 1024;
+f01071c9:	0f b7 05 13 04 00 f0 	movzwl 0xf0000413,%eax
+f01071d0:	c1 e0 0a             	shl    $0xa,%eax
+		if ((mp = mpsearch1(p - 1024, 1024)))
+f01071d3:	2d 00 04 00 00       	sub    $0x400,%eax
+f01071d8:	ba 00 04 00 00       	mov    $0x400,%edx
+f01071dd:	e8 89 fe ff ff       	call   f010706b <mpsearch1>
+f01071e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01071e5:	85 c0                	test   %eax,%eax
+f01071e7:	75 81                	jne    f010716a <mp_init+0x5d>
+f01071e9:	e9 62 ff ff ff       	jmp    f0107150 <mp_init+0x43>
+		cprintf("SMP: Default configurations not implemented\n");
+f01071ee:	83 ec 0c             	sub    $0xc,%esp
+f01071f1:	68 38 c6 10 f0       	push   $0xf010c638
+f01071f6:	e8 e6 d1 ff ff       	call   f01043e1 <cprintf>
+		return NULL;
+f01071fb:	83 c4 10             	add    $0x10,%esp
+f01071fe:	e9 87 01 00 00       	jmp    f010738a <mp_init+0x27d>
+f0107203:	53                   	push   %ebx
+f0107204:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0107209:	68 90 00 00 00       	push   $0x90
+f010720e:	68 c5 c7 10 f0       	push   $0xf010c7c5
+f0107213:	e8 31 8e ff ff       	call   f0100049 <_panic>
+		cprintf("SMP: Incorrect MP configuration table signature\n");
+f0107218:	83 ec 0c             	sub    $0xc,%esp
+f010721b:	68 68 c6 10 f0       	push   $0xf010c668
+f0107220:	e8 bc d1 ff ff       	call   f01043e1 <cprintf>
+		return NULL;
+f0107225:	83 c4 10             	add    $0x10,%esp
+f0107228:	e9 5d 01 00 00       	jmp    f010738a <mp_init+0x27d>
+		sum += ((uint8_t *)addr)[i];
+f010722d:	0f b6 0b             	movzbl (%ebx),%ecx
+f0107230:	01 ca                	add    %ecx,%edx
+	for (i = 0; i < len; i++)
+f0107232:	83 c3 01             	add    $0x1,%ebx
+f0107235:	39 fb                	cmp    %edi,%ebx
+f0107237:	75 f4                	jne    f010722d <mp_init+0x120>
+	if (sum(conf, conf->length) != 0) {
+f0107239:	84 d2                	test   %dl,%dl
+f010723b:	75 16                	jne    f0107253 <mp_init+0x146>
+	if (conf->version != 1 && conf->version != 4) {
+f010723d:	0f b6 56 06          	movzbl 0x6(%esi),%edx
+f0107241:	80 fa 01             	cmp    $0x1,%dl
+f0107244:	74 05                	je     f010724b <mp_init+0x13e>
+f0107246:	80 fa 04             	cmp    $0x4,%dl
+f0107249:	75 1d                	jne    f0107268 <mp_init+0x15b>
+	for (i = 0; i < len; i++)
+f010724b:	0f b7 4e 28          	movzwl 0x28(%esi),%ecx
+f010724f:	01 d9                	add    %ebx,%ecx
+f0107251:	eb 36                	jmp    f0107289 <mp_init+0x17c>
+		cprintf("SMP: Bad MP configuration checksum\n");
+f0107253:	83 ec 0c             	sub    $0xc,%esp
+f0107256:	68 9c c6 10 f0       	push   $0xf010c69c
+f010725b:	e8 81 d1 ff ff       	call   f01043e1 <cprintf>
+		return NULL;
+f0107260:	83 c4 10             	add    $0x10,%esp
+f0107263:	e9 22 01 00 00       	jmp    f010738a <mp_init+0x27d>
+		cprintf("SMP: Unsupported MP version %d\n", conf->version);
+f0107268:	83 ec 08             	sub    $0x8,%esp
+f010726b:	0f b6 d2             	movzbl %dl,%edx
+f010726e:	52                   	push   %edx
+f010726f:	68 c0 c6 10 f0       	push   $0xf010c6c0
+f0107274:	e8 68 d1 ff ff       	call   f01043e1 <cprintf>
+		return NULL;
+f0107279:	83 c4 10             	add    $0x10,%esp
+f010727c:	e9 09 01 00 00       	jmp    f010738a <mp_init+0x27d>
+		sum += ((uint8_t *)addr)[i];
+f0107281:	0f b6 13             	movzbl (%ebx),%edx
+f0107284:	01 d0                	add    %edx,%eax
+	for (i = 0; i < len; i++)
+f0107286:	83 c3 01             	add    $0x1,%ebx
+f0107289:	39 d9                	cmp    %ebx,%ecx
+f010728b:	75 f4                	jne    f0107281 <mp_init+0x174>
+	if ((sum((uint8_t *)conf + conf->length, conf->xlength) + conf->xchecksum) & 0xff) {
+f010728d:	02 46 2a             	add    0x2a(%esi),%al
+f0107290:	75 1c                	jne    f01072ae <mp_init+0x1a1>
+	if ((conf = mpconfig(&mp)) == 0)
+		return;
+	ismp = 1;
+f0107292:	c7 05 04 d0 83 f0 01 	movl   $0x1,0xf083d004
+f0107299:	00 00 00 
+	lapicaddr = conf->lapicaddr;
+f010729c:	8b 46 24             	mov    0x24(%esi),%eax
+f010729f:	a3 c4 d3 83 f0       	mov    %eax,0xf083d3c4
+
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f01072a4:	8d 7e 2c             	lea    0x2c(%esi),%edi
+f01072a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01072ac:	eb 4d                	jmp    f01072fb <mp_init+0x1ee>
+		cprintf("SMP: Bad MP configuration extended checksum\n");
+f01072ae:	83 ec 0c             	sub    $0xc,%esp
+f01072b1:	68 e0 c6 10 f0       	push   $0xf010c6e0
+f01072b6:	e8 26 d1 ff ff       	call   f01043e1 <cprintf>
+		return NULL;
+f01072bb:	83 c4 10             	add    $0x10,%esp
+f01072be:	e9 c7 00 00 00       	jmp    f010738a <mp_init+0x27d>
+		switch (*p) {
+		case MPPROC:
+			proc = (struct mpproc *)p;
+			if (proc->flags & MPPROC_BOOT)
+f01072c3:	f6 47 03 02          	testb  $0x2,0x3(%edi)
+f01072c7:	74 11                	je     f01072da <mp_init+0x1cd>
+				bootcpu = &cpus[ncpu];
+f01072c9:	6b 05 00 d0 83 f0 74 	imul   $0x74,0xf083d000,%eax
+f01072d0:	05 20 d0 83 f0       	add    $0xf083d020,%eax
+f01072d5:	a3 08 d0 83 f0       	mov    %eax,0xf083d008
+			if (ncpu < NCPU) {
+f01072da:	a1 00 d0 83 f0       	mov    0xf083d000,%eax
+f01072df:	83 f8 07             	cmp    $0x7,%eax
+f01072e2:	7f 33                	jg     f0107317 <mp_init+0x20a>
+				cpus[ncpu].cpu_id = ncpu;
+f01072e4:	6b d0 74             	imul   $0x74,%eax,%edx
+f01072e7:	88 82 20 d0 83 f0    	mov    %al,-0xf7c2fe0(%edx)
+				ncpu++;
+f01072ed:	83 c0 01             	add    $0x1,%eax
+f01072f0:	a3 00 d0 83 f0       	mov    %eax,0xf083d000
+			} else {
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+					proc->apicid);
+			}
+			p += sizeof(struct mpproc);
+f01072f5:	83 c7 14             	add    $0x14,%edi
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f01072f8:	83 c3 01             	add    $0x1,%ebx
+f01072fb:	0f b7 46 22          	movzwl 0x22(%esi),%eax
+f01072ff:	39 c3                	cmp    %eax,%ebx
+f0107301:	73 4f                	jae    f0107352 <mp_init+0x245>
+		switch (*p) {
+f0107303:	0f b6 07             	movzbl (%edi),%eax
+f0107306:	84 c0                	test   %al,%al
+f0107308:	74 b9                	je     f01072c3 <mp_init+0x1b6>
+f010730a:	8d 50 ff             	lea    -0x1(%eax),%edx
+f010730d:	80 fa 03             	cmp    $0x3,%dl
+f0107310:	77 1c                	ja     f010732e <mp_init+0x221>
+			continue;
+		case MPBUS:
+		case MPIOAPIC:
+		case MPIOINTR:
+		case MPLINTR:
+			p += 8;
+f0107312:	83 c7 08             	add    $0x8,%edi
+			continue;
+f0107315:	eb e1                	jmp    f01072f8 <mp_init+0x1eb>
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+f0107317:	83 ec 08             	sub    $0x8,%esp
+f010731a:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+f010731e:	50                   	push   %eax
+f010731f:	68 10 c7 10 f0       	push   $0xf010c710
+f0107324:	e8 b8 d0 ff ff       	call   f01043e1 <cprintf>
+f0107329:	83 c4 10             	add    $0x10,%esp
+f010732c:	eb c7                	jmp    f01072f5 <mp_init+0x1e8>
+		default:
+			cprintf("mpinit: unknown config type %x\n", *p);
+f010732e:	83 ec 08             	sub    $0x8,%esp
+		switch (*p) {
+f0107331:	0f b6 c0             	movzbl %al,%eax
+			cprintf("mpinit: unknown config type %x\n", *p);
+f0107334:	50                   	push   %eax
+f0107335:	68 38 c7 10 f0       	push   $0xf010c738
+f010733a:	e8 a2 d0 ff ff       	call   f01043e1 <cprintf>
+			ismp = 0;
+f010733f:	c7 05 04 d0 83 f0 00 	movl   $0x0,0xf083d004
+f0107346:	00 00 00 
+			i = conf->entry;
+f0107349:	0f b7 5e 22          	movzwl 0x22(%esi),%ebx
+f010734d:	83 c4 10             	add    $0x10,%esp
+f0107350:	eb a6                	jmp    f01072f8 <mp_init+0x1eb>
+		}
+	}
+
+	bootcpu->cpu_status = CPU_STARTED;
+f0107352:	a1 08 d0 83 f0       	mov    0xf083d008,%eax
+f0107357:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	if (!ismp) {
+f010735e:	83 3d 04 d0 83 f0 00 	cmpl   $0x0,0xf083d004
+f0107365:	74 2b                	je     f0107392 <mp_init+0x285>
+		ncpu = 1;
+		lapicaddr = 0;
+		cprintf("SMP: configuration not found, SMP disabled\n");
+		return;
+	}
+	cprintf("SMP: CPU %d found %d CPU(s)\n", bootcpu->cpu_id,  ncpu);
+f0107367:	83 ec 04             	sub    $0x4,%esp
+f010736a:	ff 35 00 d0 83 f0    	push   0xf083d000
+f0107370:	0f b6 00             	movzbl (%eax),%eax
+f0107373:	50                   	push   %eax
+f0107374:	68 df c7 10 f0       	push   $0xf010c7df
+f0107379:	e8 63 d0 ff ff       	call   f01043e1 <cprintf>
+
+	if (mp->imcrp) {
+f010737e:	83 c4 10             	add    $0x10,%esp
+f0107381:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107384:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+f0107388:	75 2e                	jne    f01073b8 <mp_init+0x2ab>
+		// switch to getting interrupts from the LAPIC.
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+		outb(0x22, 0x70);   // Select IMCR
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+	}
+}
+f010738a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010738d:	5b                   	pop    %ebx
+f010738e:	5e                   	pop    %esi
+f010738f:	5f                   	pop    %edi
+f0107390:	5d                   	pop    %ebp
+f0107391:	c3                   	ret
+		ncpu = 1;
+f0107392:	c7 05 00 d0 83 f0 01 	movl   $0x1,0xf083d000
+f0107399:	00 00 00 
+		lapicaddr = 0;
+f010739c:	c7 05 c4 d3 83 f0 00 	movl   $0x0,0xf083d3c4
+f01073a3:	00 00 00 
+		cprintf("SMP: configuration not found, SMP disabled\n");
+f01073a6:	83 ec 0c             	sub    $0xc,%esp
+f01073a9:	68 58 c7 10 f0       	push   $0xf010c758
+f01073ae:	e8 2e d0 ff ff       	call   f01043e1 <cprintf>
+		return;
+f01073b3:	83 c4 10             	add    $0x10,%esp
+f01073b6:	eb d2                	jmp    f010738a <mp_init+0x27d>
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+f01073b8:	83 ec 0c             	sub    $0xc,%esp
+f01073bb:	68 84 c7 10 f0       	push   $0xf010c784
+f01073c0:	e8 1c d0 ff ff       	call   f01043e1 <cprintf>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01073c5:	b8 70 00 00 00       	mov    $0x70,%eax
+f01073ca:	ba 22 00 00 00       	mov    $0x22,%edx
+f01073cf:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01073d0:	ba 23 00 00 00       	mov    $0x23,%edx
+f01073d5:	ec                   	in     (%dx),%al
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+f01073d6:	83 c8 01             	or     $0x1,%eax
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01073d9:	ee                   	out    %al,(%dx)
+}
+f01073da:	83 c4 10             	add    $0x10,%esp
+f01073dd:	eb ab                	jmp    f010738a <mp_init+0x27d>
+
+f01073df <lapicw>:
+volatile uint32_t *lapic;
+
+static void
+lapicw(int index, int value)
+{
+	lapic[index] = value;
+f01073df:	8b 0d c0 d3 83 f0    	mov    0xf083d3c0,%ecx
+f01073e5:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+f01073e8:	89 10                	mov    %edx,(%eax)
+	lapic[ID];  // wait for write to finish, by reading
+f01073ea:	a1 c0 d3 83 f0       	mov    0xf083d3c0,%eax
+f01073ef:	8b 40 20             	mov    0x20(%eax),%eax
+}
+f01073f2:	c3                   	ret
+
+f01073f3 <cpunum>:
+}
+
+int
+cpunum(void)
+{
+	if (lapic)
+f01073f3:	8b 15 c0 d3 83 f0    	mov    0xf083d3c0,%edx
+		return lapic[ID] >> 24;
+	return 0;
+f01073f9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lapic)
+f01073fe:	85 d2                	test   %edx,%edx
+f0107400:	74 06                	je     f0107408 <cpunum+0x15>
+		return lapic[ID] >> 24;
+f0107402:	8b 42 20             	mov    0x20(%edx),%eax
+f0107405:	c1 e8 18             	shr    $0x18,%eax
+}
+f0107408:	c3                   	ret
+
+f0107409 <lapic_init>:
+	if (!lapicaddr)
+f0107409:	a1 c4 d3 83 f0       	mov    0xf083d3c4,%eax
+f010740e:	85 c0                	test   %eax,%eax
+f0107410:	75 01                	jne    f0107413 <lapic_init+0xa>
+f0107412:	c3                   	ret
+{
+f0107413:	55                   	push   %ebp
+f0107414:	89 e5                	mov    %esp,%ebp
+f0107416:	83 ec 10             	sub    $0x10,%esp
+	lapic = mmio_map_region(lapicaddr, 4096);
+f0107419:	68 00 10 00 00       	push   $0x1000
+f010741e:	50                   	push   %eax
+f010741f:	e8 41 a8 ff ff       	call   f0101c65 <mmio_map_region>
+f0107424:	a3 c0 d3 83 f0       	mov    %eax,0xf083d3c0
+	lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
+f0107429:	ba 27 01 00 00       	mov    $0x127,%edx
+f010742e:	b8 3c 00 00 00       	mov    $0x3c,%eax
+f0107433:	e8 a7 ff ff ff       	call   f01073df <lapicw>
+	lapicw(TDCR, X1);
+f0107438:	ba 0b 00 00 00       	mov    $0xb,%edx
+f010743d:	b8 f8 00 00 00       	mov    $0xf8,%eax
+f0107442:	e8 98 ff ff ff       	call   f01073df <lapicw>
+	lapicw(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_TIMER));
+f0107447:	ba 20 00 02 00       	mov    $0x20020,%edx
+f010744c:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f0107451:	e8 89 ff ff ff       	call   f01073df <lapicw>
+	lapicw(TICR, 10000000);
+f0107456:	ba 80 96 98 00       	mov    $0x989680,%edx
+f010745b:	b8 e0 00 00 00       	mov    $0xe0,%eax
+f0107460:	e8 7a ff ff ff       	call   f01073df <lapicw>
+	if (thiscpu != bootcpu)
+f0107465:	e8 89 ff ff ff       	call   f01073f3 <cpunum>
+f010746a:	6b c0 74             	imul   $0x74,%eax,%eax
+f010746d:	05 20 d0 83 f0       	add    $0xf083d020,%eax
+f0107472:	83 c4 10             	add    $0x10,%esp
+f0107475:	39 05 08 d0 83 f0    	cmp    %eax,0xf083d008
+f010747b:	74 0f                	je     f010748c <lapic_init+0x83>
+		lapicw(LINT0, MASKED);
+f010747d:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0107482:	b8 d4 00 00 00       	mov    $0xd4,%eax
+f0107487:	e8 53 ff ff ff       	call   f01073df <lapicw>
+	lapicw(LINT1, MASKED);
+f010748c:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0107491:	b8 d8 00 00 00       	mov    $0xd8,%eax
+f0107496:	e8 44 ff ff ff       	call   f01073df <lapicw>
+	if (((lapic[VER]>>16) & 0xFF) >= 4)
+f010749b:	a1 c0 d3 83 f0       	mov    0xf083d3c0,%eax
+f01074a0:	8b 40 30             	mov    0x30(%eax),%eax
+f01074a3:	c1 e8 10             	shr    $0x10,%eax
+f01074a6:	a8 fc                	test   $0xfc,%al
+f01074a8:	75 7c                	jne    f0107526 <lapic_init+0x11d>
+	lapicw(ERROR, IRQ_OFFSET + IRQ_ERROR);
+f01074aa:	ba 33 00 00 00       	mov    $0x33,%edx
+f01074af:	b8 dc 00 00 00       	mov    $0xdc,%eax
+f01074b4:	e8 26 ff ff ff       	call   f01073df <lapicw>
+	lapicw(ESR, 0);
+f01074b9:	ba 00 00 00 00       	mov    $0x0,%edx
+f01074be:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f01074c3:	e8 17 ff ff ff       	call   f01073df <lapicw>
+	lapicw(ESR, 0);
+f01074c8:	ba 00 00 00 00       	mov    $0x0,%edx
+f01074cd:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f01074d2:	e8 08 ff ff ff       	call   f01073df <lapicw>
+	lapicw(EOI, 0);
+f01074d7:	ba 00 00 00 00       	mov    $0x0,%edx
+f01074dc:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f01074e1:	e8 f9 fe ff ff       	call   f01073df <lapicw>
+	lapicw(ICRHI, 0);
+f01074e6:	ba 00 00 00 00       	mov    $0x0,%edx
+f01074eb:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f01074f0:	e8 ea fe ff ff       	call   f01073df <lapicw>
+	lapicw(ICRLO, BCAST | INIT | LEVEL);
+f01074f5:	ba 00 85 08 00       	mov    $0x88500,%edx
+f01074fa:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01074ff:	e8 db fe ff ff       	call   f01073df <lapicw>
+	while(lapic[ICRLO] & DELIVS)
+f0107504:	8b 15 c0 d3 83 f0    	mov    0xf083d3c0,%edx
+f010750a:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0107510:	f6 c4 10             	test   $0x10,%ah
+f0107513:	75 f5                	jne    f010750a <lapic_init+0x101>
+	lapicw(TPR, 0);
+f0107515:	ba 00 00 00 00       	mov    $0x0,%edx
+f010751a:	b8 20 00 00 00       	mov    $0x20,%eax
+f010751f:	e8 bb fe ff ff       	call   f01073df <lapicw>
+}
+f0107524:	c9                   	leave
+f0107525:	c3                   	ret
+		lapicw(PCINT, MASKED);
+f0107526:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010752b:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f0107530:	e8 aa fe ff ff       	call   f01073df <lapicw>
+f0107535:	e9 70 ff ff ff       	jmp    f01074aa <lapic_init+0xa1>
+
+f010753a <lapic_eoi>:
+
+// Acknowledge interrupt.
+void
+lapic_eoi(void)
+{
+	if (lapic)
+f010753a:	83 3d c0 d3 83 f0 00 	cmpl   $0x0,0xf083d3c0
+f0107541:	74 17                	je     f010755a <lapic_eoi+0x20>
+{
+f0107543:	55                   	push   %ebp
+f0107544:	89 e5                	mov    %esp,%ebp
+f0107546:	83 ec 08             	sub    $0x8,%esp
+		lapicw(EOI, 0);
+f0107549:	ba 00 00 00 00       	mov    $0x0,%edx
+f010754e:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f0107553:	e8 87 fe ff ff       	call   f01073df <lapicw>
+}
+f0107558:	c9                   	leave
+f0107559:	c3                   	ret
+f010755a:	c3                   	ret
+
+f010755b <lapic_startap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapic_startap(uint8_t apicid, uint32_t addr)
+{
+f010755b:	55                   	push   %ebp
+f010755c:	89 e5                	mov    %esp,%ebp
+f010755e:	56                   	push   %esi
+f010755f:	53                   	push   %ebx
+f0107560:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107563:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0107566:	b8 0f 00 00 00       	mov    $0xf,%eax
+f010756b:	ba 70 00 00 00       	mov    $0x70,%edx
+f0107570:	ee                   	out    %al,(%dx)
+f0107571:	b8 0a 00 00 00       	mov    $0xa,%eax
+f0107576:	ba 71 00 00 00       	mov    $0x71,%edx
+f010757b:	ee                   	out    %al,(%dx)
+	if (PGNUM(pa) >= npages)
+f010757c:	83 3d ac c2 7f f0 00 	cmpl   $0x0,0xf07fc2ac
+f0107583:	74 7e                	je     f0107603 <lapic_startap+0xa8>
+	// and the warm reset vector (DWORD based at 40:67) to point at
+	// the AP startup code prior to the [universal startup algorithm]."
+	outb(IO_RTC, 0xF);  // offset 0xF is shutdown code
+	outb(IO_RTC+1, 0x0A);
+	wrv = (uint16_t *)KADDR((0x40 << 4 | 0x67));  // Warm reset vector
+	wrv[0] = 0;
+f0107585:	66 c7 05 67 04 00 f0 	movw   $0x0,0xf0000467
+f010758c:	00 00 
+	wrv[1] = addr >> 4;
+f010758e:	89 d8                	mov    %ebx,%eax
+f0107590:	c1 e8 04             	shr    $0x4,%eax
+f0107593:	66 a3 69 04 00 f0    	mov    %ax,0xf0000469
+
+	// "Universal startup algorithm."
+	// Send INIT (level-triggered) interrupt to reset other CPU.
+	lapicw(ICRHI, apicid << 24);
+f0107599:	c1 e6 18             	shl    $0x18,%esi
+f010759c:	89 f2                	mov    %esi,%edx
+f010759e:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f01075a3:	e8 37 fe ff ff       	call   f01073df <lapicw>
+	lapicw(ICRLO, INIT | LEVEL | ASSERT);
+f01075a8:	ba 00 c5 00 00       	mov    $0xc500,%edx
+f01075ad:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01075b2:	e8 28 fe ff ff       	call   f01073df <lapicw>
+	microdelay(200);
+	lapicw(ICRLO, INIT | LEVEL);
+f01075b7:	ba 00 85 00 00       	mov    $0x8500,%edx
+f01075bc:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01075c1:	e8 19 fe ff ff       	call   f01073df <lapicw>
+	// when it is in the halted state due to an INIT.  So the second
+	// should be ignored, but it is part of the official Intel algorithm.
+	// Bochs complains about the second one.  Too bad for Bochs.
+	for (i = 0; i < 2; i++) {
+		lapicw(ICRHI, apicid << 24);
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f01075c6:	c1 eb 0c             	shr    $0xc,%ebx
+f01075c9:	80 cf 06             	or     $0x6,%bh
+		lapicw(ICRHI, apicid << 24);
+f01075cc:	89 f2                	mov    %esi,%edx
+f01075ce:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f01075d3:	e8 07 fe ff ff       	call   f01073df <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f01075d8:	89 da                	mov    %ebx,%edx
+f01075da:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01075df:	e8 fb fd ff ff       	call   f01073df <lapicw>
+		lapicw(ICRHI, apicid << 24);
+f01075e4:	89 f2                	mov    %esi,%edx
+f01075e6:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f01075eb:	e8 ef fd ff ff       	call   f01073df <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f01075f0:	89 da                	mov    %ebx,%edx
+f01075f2:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01075f7:	e8 e3 fd ff ff       	call   f01073df <lapicw>
+		microdelay(200);
+	}
+}
+f01075fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01075ff:	5b                   	pop    %ebx
+f0107600:	5e                   	pop    %esi
+f0107601:	5d                   	pop    %ebp
+f0107602:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0107603:	68 67 04 00 00       	push   $0x467
+f0107608:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f010760d:	68 98 00 00 00       	push   $0x98
+f0107612:	68 fc c7 10 f0       	push   $0xf010c7fc
+f0107617:	e8 2d 8a ff ff       	call   f0100049 <_panic>
+
+f010761c <lapic_ipi>:
+
+void
+lapic_ipi(int vector)
+{
+f010761c:	55                   	push   %ebp
+f010761d:	89 e5                	mov    %esp,%ebp
+f010761f:	83 ec 08             	sub    $0x8,%esp
+	lapicw(ICRLO, OTHERS | FIXED | vector);
+f0107622:	8b 55 08             	mov    0x8(%ebp),%edx
+f0107625:	81 ca 00 00 0c 00    	or     $0xc0000,%edx
+f010762b:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0107630:	e8 aa fd ff ff       	call   f01073df <lapicw>
+	while (lapic[ICRLO] & DELIVS)
+f0107635:	8b 15 c0 d3 83 f0    	mov    0xf083d3c0,%edx
+f010763b:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0107641:	f6 c4 10             	test   $0x10,%ah
+f0107644:	75 f5                	jne    f010763b <lapic_ipi+0x1f>
+		;
+}
+f0107646:	c9                   	leave
+f0107647:	c3                   	ret
+
+f0107648 <__spin_initlock>:
+}
+#endif
+
+void
+__spin_initlock(struct spinlock *lk, char *name)
+{
+f0107648:	55                   	push   %ebp
+f0107649:	89 e5                	mov    %esp,%ebp
+f010764b:	8b 45 08             	mov    0x8(%ebp),%eax
+	lk->locked = 0;
+f010764e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+#ifdef DEBUG_SPINLOCK
+	lk->name = name;
+f0107654:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0107657:	89 50 04             	mov    %edx,0x4(%eax)
+	lk->cpu = 0;
+f010765a:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+#endif
+}
+f0107661:	5d                   	pop    %ebp
+f0107662:	c3                   	ret
+
+f0107663 <spin_lock>:
+// Loops (spins) until the lock is acquired.
+// Holding a lock for a long time may cause
+// other CPUs to waste time spinning to acquire it.
+void
+spin_lock(struct spinlock *lk)
+{
+f0107663:	55                   	push   %ebp
+f0107664:	89 e5                	mov    %esp,%ebp
+f0107666:	56                   	push   %esi
+f0107667:	53                   	push   %ebx
+f0107668:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	return lock->locked && lock->cpu == thiscpu;
+f010766b:	83 3b 00             	cmpl   $0x0,(%ebx)
+f010766e:	75 07                	jne    f0107677 <spin_lock+0x14>
+	asm volatile("lock; xchgl %0, %1"
+f0107670:	ba 01 00 00 00       	mov    $0x1,%edx
+f0107675:	eb 34                	jmp    f01076ab <spin_lock+0x48>
+f0107677:	8b 73 08             	mov    0x8(%ebx),%esi
+f010767a:	e8 74 fd ff ff       	call   f01073f3 <cpunum>
+f010767f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0107682:	05 20 d0 83 f0       	add    $0xf083d020,%eax
+#ifdef DEBUG_SPINLOCK
+	if (holding(lk))
+f0107687:	39 c6                	cmp    %eax,%esi
+f0107689:	75 e5                	jne    f0107670 <spin_lock+0xd>
+		panic("CPU %d cannot acquire %s: already holding", cpunum(), lk->name);
+f010768b:	8b 5b 04             	mov    0x4(%ebx),%ebx
+f010768e:	e8 60 fd ff ff       	call   f01073f3 <cpunum>
+f0107693:	83 ec 0c             	sub    $0xc,%esp
+f0107696:	53                   	push   %ebx
+f0107697:	50                   	push   %eax
+f0107698:	68 0c c8 10 f0       	push   $0xf010c80c
+f010769d:	6a 41                	push   $0x41
+f010769f:	68 6e c8 10 f0       	push   $0xf010c86e
+f01076a4:	e8 a0 89 ff ff       	call   f0100049 <_panic>
+
+	// The xchg is atomic.
+	// It also serializes, so that reads after acquire are not
+	// reordered before it.
+	while (xchg(&lk->locked, 1) != 0)
+		asm volatile ("pause");
+f01076a9:	f3 90                	pause
+f01076ab:	89 d0                	mov    %edx,%eax
+f01076ad:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&lk->locked, 1) != 0)
+f01076b0:	85 c0                	test   %eax,%eax
+f01076b2:	75 f5                	jne    f01076a9 <spin_lock+0x46>
+
+	// Record info about lock acquisition for debugging.
+#ifdef DEBUG_SPINLOCK
+	lk->cpu = thiscpu;
+f01076b4:	e8 3a fd ff ff       	call   f01073f3 <cpunum>
+f01076b9:	6b c0 74             	imul   $0x74,%eax,%eax
+f01076bc:	05 20 d0 83 f0       	add    $0xf083d020,%eax
+f01076c1:	89 43 08             	mov    %eax,0x8(%ebx)
+	asm volatile("movl %%ebp,%0" : "=r" (ebp));
+f01076c4:	89 ea                	mov    %ebp,%edx
+	for (i = 0; i < 10; i++){
+f01076c6:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (ebp == 0 || ebp < (uint32_t *)ULIM)
+f01076cb:	83 f8 09             	cmp    $0x9,%eax
+f01076ce:	7f 21                	jg     f01076f1 <spin_lock+0x8e>
+f01076d0:	81 fa ff ff 7f ef    	cmp    $0xef7fffff,%edx
+f01076d6:	76 19                	jbe    f01076f1 <spin_lock+0x8e>
+		pcs[i] = ebp[1];          // saved %eip
+f01076d8:	8b 4a 04             	mov    0x4(%edx),%ecx
+f01076db:	89 4c 83 0c          	mov    %ecx,0xc(%ebx,%eax,4)
+		ebp = (uint32_t *)ebp[0]; // saved %ebp
+f01076df:	8b 12                	mov    (%edx),%edx
+	for (i = 0; i < 10; i++){
+f01076e1:	83 c0 01             	add    $0x1,%eax
+f01076e4:	eb e5                	jmp    f01076cb <spin_lock+0x68>
+		pcs[i] = 0;
+f01076e6:	c7 44 83 0c 00 00 00 	movl   $0x0,0xc(%ebx,%eax,4)
+f01076ed:	00 
+	for (; i < 10; i++)
+f01076ee:	83 c0 01             	add    $0x1,%eax
+f01076f1:	83 f8 09             	cmp    $0x9,%eax
+f01076f4:	7e f0                	jle    f01076e6 <spin_lock+0x83>
+	get_caller_pcs(lk->pcs);
+#endif
+}
+f01076f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01076f9:	5b                   	pop    %ebx
+f01076fa:	5e                   	pop    %esi
+f01076fb:	5d                   	pop    %ebp
+f01076fc:	c3                   	ret
+
+f01076fd <spin_unlock>:
+
+// Release the lock.
+void
+spin_unlock(struct spinlock *lk)
+{
+f01076fd:	55                   	push   %ebp
+f01076fe:	89 e5                	mov    %esp,%ebp
+f0107700:	57                   	push   %edi
+f0107701:	56                   	push   %esi
+f0107702:	53                   	push   %ebx
+f0107703:	83 ec 5c             	sub    $0x5c,%esp
+f0107706:	8b 75 08             	mov    0x8(%ebp),%esi
+	return lock->locked && lock->cpu == thiscpu;
+f0107709:	83 3e 00             	cmpl   $0x0,(%esi)
+f010770c:	75 38                	jne    f0107746 <spin_unlock+0x49>
+#ifdef DEBUG_SPINLOCK
+	if (!holding(lk)) {
+		int i;
+		uint32_t pcs[10];
+		// Nab the acquiring EIP chain before it gets released
+		memmove(pcs, lk->pcs, sizeof pcs);
+f010770e:	83 ec 04             	sub    $0x4,%esp
+f0107711:	6a 28                	push   $0x28
+f0107713:	8d 46 0c             	lea    0xc(%esi),%eax
+f0107716:	50                   	push   %eax
+f0107717:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+f010771a:	53                   	push   %ebx
+f010771b:	e8 1b f7 ff ff       	call   f0106e3b <memmove>
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:",
+			cpunum(), lk->name, lk->cpu->cpu_id);
+f0107720:	8b 46 08             	mov    0x8(%esi),%eax
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:",
+f0107723:	0f b6 38             	movzbl (%eax),%edi
+f0107726:	8b 76 04             	mov    0x4(%esi),%esi
+f0107729:	e8 c5 fc ff ff       	call   f01073f3 <cpunum>
+f010772e:	57                   	push   %edi
+f010772f:	56                   	push   %esi
+f0107730:	50                   	push   %eax
+f0107731:	68 38 c8 10 f0       	push   $0xf010c838
+f0107736:	e8 a6 cc ff ff       	call   f01043e1 <cprintf>
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f010773b:	8d 7d e8             	lea    -0x18(%ebp),%edi
+f010773e:	83 c4 20             	add    $0x20,%esp
+			struct Eipdebuginfo info;
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f0107741:	8d 75 a8             	lea    -0x58(%ebp),%esi
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f0107744:	eb 4a                	jmp    f0107790 <spin_unlock+0x93>
+	return lock->locked && lock->cpu == thiscpu;
+f0107746:	8b 5e 08             	mov    0x8(%esi),%ebx
+f0107749:	e8 a5 fc ff ff       	call   f01073f3 <cpunum>
+f010774e:	6b c0 74             	imul   $0x74,%eax,%eax
+f0107751:	05 20 d0 83 f0       	add    $0xf083d020,%eax
+	if (!holding(lk)) {
+f0107756:	39 c3                	cmp    %eax,%ebx
+f0107758:	75 b4                	jne    f010770e <spin_unlock+0x11>
+				cprintf("  %08x\n", pcs[i]);
+		}
+		panic("spin_unlock");
+	}
+
+	lk->pcs[0] = 0;
+f010775a:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+	lk->cpu = 0;
+f0107761:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+	asm volatile("lock; xchgl %0, %1"
+f0107768:	b8 00 00 00 00       	mov    $0x0,%eax
+f010776d:	f0 87 06             	lock xchg %eax,(%esi)
+	// respect to any other instruction which references the same memory.
+	// x86 CPUs will not reorder loads/stores across locked instructions
+	// (vol 3, 8.2.2). Because xchg() is implemented using asm volatile,
+	// gcc will not reorder C statements across the xchg.
+	xchg(&lk->locked, 0);
+}
+f0107770:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107773:	5b                   	pop    %ebx
+f0107774:	5e                   	pop    %esi
+f0107775:	5f                   	pop    %edi
+f0107776:	5d                   	pop    %ebp
+f0107777:	c3                   	ret
+				cprintf("  %08x\n", pcs[i]);
+f0107778:	83 ec 08             	sub    $0x8,%esp
+f010777b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010777e:	ff 30                	push   (%eax)
+f0107780:	68 95 c8 10 f0       	push   $0xf010c895
+f0107785:	e8 57 cc ff ff       	call   f01043e1 <cprintf>
+f010778a:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f010778d:	83 c3 04             	add    $0x4,%ebx
+f0107790:	39 fb                	cmp    %edi,%ebx
+f0107792:	74 44                	je     f01077d8 <spin_unlock+0xdb>
+f0107794:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+f0107797:	8b 03                	mov    (%ebx),%eax
+f0107799:	85 c0                	test   %eax,%eax
+f010779b:	74 3b                	je     f01077d8 <spin_unlock+0xdb>
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f010779d:	83 ec 08             	sub    $0x8,%esp
+f01077a0:	56                   	push   %esi
+f01077a1:	50                   	push   %eax
+f01077a2:	e8 bc eb ff ff       	call   f0106363 <debuginfo_eip>
+f01077a7:	83 c4 10             	add    $0x10,%esp
+f01077aa:	85 c0                	test   %eax,%eax
+f01077ac:	78 ca                	js     f0107778 <spin_unlock+0x7b>
+					pcs[i] - info.eip_fn_addr);
+f01077ae:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f01077b1:	8b 00                	mov    (%eax),%eax
+				cprintf("  %08x %s:%d: %.*s+%x\n", pcs[i],
+f01077b3:	83 ec 04             	sub    $0x4,%esp
+f01077b6:	89 c2                	mov    %eax,%edx
+f01077b8:	2b 55 b8             	sub    -0x48(%ebp),%edx
+f01077bb:	52                   	push   %edx
+f01077bc:	ff 75 b0             	push   -0x50(%ebp)
+f01077bf:	ff 75 b4             	push   -0x4c(%ebp)
+f01077c2:	ff 75 ac             	push   -0x54(%ebp)
+f01077c5:	ff 75 a8             	push   -0x58(%ebp)
+f01077c8:	50                   	push   %eax
+f01077c9:	68 7e c8 10 f0       	push   $0xf010c87e
+f01077ce:	e8 0e cc ff ff       	call   f01043e1 <cprintf>
+f01077d3:	83 c4 20             	add    $0x20,%esp
+f01077d6:	eb b5                	jmp    f010778d <spin_unlock+0x90>
+		panic("spin_unlock");
+f01077d8:	83 ec 04             	sub    $0x4,%esp
+f01077db:	68 9d c8 10 f0       	push   $0xf010c89d
+f01077e0:	6a 67                	push   $0x67
+f01077e2:	68 6e c8 10 f0       	push   $0xf010c86e
+f01077e7:	e8 5d 88 ff ff       	call   f0100049 <_panic>
+
+f01077ec <net_tx_free>:
+static uint32_t intr_armed;
+
+static inline uint32_t
+e1000r(uint32_t index)
+{
+	return e1000[index >> 2];
+f01077ec:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f01077f1:	8b 80 18 38 00 00    	mov    0x3818(%eax),%eax
+ * unused, since TDT == TDH means the ring is empty.  */
+static uint32_t net_tx_free(void)
+{
+	uint32_t tdt = e1000r(E1000_TDT);
+
+	return TX_QUEUE_SIZE - 1 - (tdt + TX_QUEUE_SIZE - tx_clean) % TX_QUEUE_SIZE;
+f01077f7:	f7 d0                	not    %eax
+f01077f9:	03 05 38 da 83 f0    	add    0xf083da38,%eax
+f01077ff:	0f b6 c0             	movzbl %al,%eax
+}
+f0107802:	c3                   	ret
+
+f0107803 <net_rx_frame>:
+
+/* Has a whole frame come in at the descriptors from 'first' on?  If so,
+ * set *ndesc to how many descriptors it takes and *length to its
+ * length.  The one at RDT is never done, which ends the walk.  */
+static bool net_rx_frame(uint32_t first, int *ndesc, size_t *length)
+{
+f0107803:	55                   	push   %ebp
+f0107804:	89 e5                	mov    %esp,%ebp
+f0107806:	56                   	push   %esi
+f0107807:	53                   	push   %ebx
+f0107808:	89 d3                	mov    %edx,%ebx
+	struct rx_desc *rdesc;
+	uint32_t i = first;
+
+	*ndesc = 0;
+f010780a:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	*length = 0;
+f0107810:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	do {
+		rdesc = &rx_queue[i];
+		if (!(rdesc->status & E1000_RXD_STAT_DD))
+f0107816:	89 c2                	mov    %eax,%edx
+f0107818:	c1 e2 04             	shl    $0x4,%edx
+f010781b:	f6 82 4c de 83 f0 01 	testb  $0x1,-0xf7c21b4(%edx)
+f0107822:	74 27                	je     f010784b <net_rx_frame+0x48>
+			return false;
+		*length += rdesc->length;
+f0107824:	89 c2                	mov    %eax,%edx
+f0107826:	c1 e2 04             	shl    $0x4,%edx
+f0107829:	0f b7 b2 48 de 83 f0 	movzwl -0xf7c21b8(%edx),%esi
+f0107830:	01 31                	add    %esi,(%ecx)
+		++*ndesc;
+f0107832:	83 03 01             	addl   $0x1,(%ebx)
+		i = (i + 1) % RX_QUEUE_SIZE;
+f0107835:	83 c0 01             	add    $0x1,%eax
+f0107838:	83 e0 7f             	and    $0x7f,%eax
+	} while (!(rdesc->status & E1000_RXD_STAT_EOP));
+f010783b:	f6 82 4c de 83 f0 02 	testb  $0x2,-0xf7c21b4(%edx)
+f0107842:	74 d2                	je     f0107816 <net_rx_frame+0x13>
+	return true;
+f0107844:	b8 01 00 00 00       	mov    $0x1,%eax
+f0107849:	eb 05                	jmp    f0107850 <net_rx_frame+0x4d>
+			return false;
+f010784b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0107850:	5b                   	pop    %ebx
+f0107851:	5e                   	pop    %esi
+f0107852:	5d                   	pop    %ebp
+f0107853:	c3                   	ret
+
+f0107854 <net_rx_csum>:
+}
+
+// Which checksums of the received packet in rdesc the NIC found good,
+// as NET_CSUM_* bits.
+static int net_rx_csum(const struct rx_desc *rdesc)
+{
+f0107854:	89 c2                	mov    %eax,%edx
+	int csum = 0;
+
+	if (rdesc->status & E1000_RXD_STAT_IXSM)
+f0107856:	0f b6 48 0c          	movzbl 0xc(%eax),%ecx
+f010785a:	f6 c1 04             	test   $0x4,%cl
+f010785d:	75 29                	jne    f0107888 <net_rx_csum+0x34>
+	int csum = 0;
+f010785f:	b8 00 00 00 00       	mov    $0x0,%eax
+		return 0;
+	if ((rdesc->status & E1000_RXD_STAT_IPCS)
+f0107864:	f6 c1 40             	test   $0x40,%cl
+f0107867:	74 0d                	je     f0107876 <net_rx_csum+0x22>
+	    && !(rdesc->error & E1000_RXD_ERR_IPE))
+f0107869:	0f b6 42 0d          	movzbl 0xd(%edx),%eax
+f010786d:	c0 e8 06             	shr    $0x6,%al
+f0107870:	83 f0 01             	xor    $0x1,%eax
+f0107873:	83 e0 01             	and    $0x1,%eax
+		csum |= NET_CSUM_IP;
+	if ((rdesc->status & (E1000_RXD_STAT_TCPCS | E1000_RXD_STAT_UDPCS))
+f0107876:	f6 c1 30             	test   $0x30,%cl
+f0107879:	74 12                	je     f010788d <net_rx_csum+0x39>
+	    && !(rdesc->error & E1000_RXD_ERR_TCPE))
+		csum |= NET_CSUM_L4;
+f010787b:	89 c1                	mov    %eax,%ecx
+f010787d:	83 c9 02             	or     $0x2,%ecx
+f0107880:	f6 42 0d 20          	testb  $0x20,0xd(%edx)
+f0107884:	0f 44 c1             	cmove  %ecx,%eax
+f0107887:	c3                   	ret
+		return 0;
+f0107888:	b8 00 00 00 00       	mov    $0x0,%eax
+	return csum;
+}
+f010788d:	c3                   	ret
+
+f010788e <net_rings_start>:
+	e1000[index >> 2] = value;
+f010788e:	8b 15 44 fa 83 f0    	mov    0xf083fa44,%edx
+f0107894:	c7 82 00 04 00 00 0a 	movl   $0x4010a,0x400(%edx)
+f010789b:	01 04 00 
+}
+
+static void net_rings_start(void)
+{
+	e1000w(E1000_TCTL, TCTL_ON);
+	e1000w(E1000_RCTL, nm_env ? RCTL_ON : RCTL_ON_LPE);
+f010789e:	83 3d 04 d6 83 f0 01 	cmpl   $0x1,0xf083d604
+f01078a5:	19 c0                	sbb    %eax,%eax
+f01078a7:	83 e0 20             	and    $0x20,%eax
+f01078aa:	05 02 80 00 04       	add    $0x4008002,%eax
+	e1000[index >> 2] = value;
+f01078af:	89 82 00 01 00 00    	mov    %eax,0x100(%edx)
+}
+f01078b5:	c3                   	ret
+
+f01078b6 <netmap_buf>:
+
+static physaddr_t netmap_buf(uint16_t buf)
+{
+f01078b6:	89 c2                	mov    %eax,%edx
+	return page2pa(nm_pages[1 + buf / NETMAP_BUFS_PER_PAGE])
+f01078b8:	66 d1 e8             	shr    %ax
+f01078bb:	83 c0 01             	add    $0x1,%eax
+f01078be:	0f b7 c0             	movzwl %ax,%eax
+	return (pp - pool.pages) << PGSHIFT;
+f01078c1:	8b 04 85 20 d6 83 f0 	mov    -0xf7c29e0(,%eax,4),%eax
+f01078c8:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f01078ce:	c1 f8 02             	sar    $0x2,%eax
+f01078d1:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01078d7:	c1 e0 0c             	shl    $0xc,%eax
+		+ buf % NETMAP_BUFS_PER_PAGE * NETMAP_BUFSIZE;
+f01078da:	83 e2 01             	and    $0x1,%edx
+f01078dd:	c1 e2 0b             	shl    $0xb,%edx
+f01078e0:	01 d0                	add    %edx,%eax
+}
+f01078e2:	c3                   	ret
+
+f01078e3 <net_intr_arm>:
+}
+
+// Unmask the interrupt causes in 'causes' that are masked.
+static void net_intr_arm(uint32_t causes)
+{
+	causes &= ~intr_armed;
+f01078e3:	8b 0d 40 fa 83 f0    	mov    0xf083fa40,%ecx
+f01078e9:	89 ca                	mov    %ecx,%edx
+f01078eb:	f7 d2                	not    %edx
+	if (causes) {
+f01078ed:	21 c2                	and    %eax,%edx
+f01078ef:	74 13                	je     f0107904 <net_intr_arm+0x21>
+		intr_armed |= causes;
+f01078f1:	09 c1                	or     %eax,%ecx
+f01078f3:	89 0d 40 fa 83 f0    	mov    %ecx,0xf083fa40
+	e1000[index >> 2] = value;
+f01078f9:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f01078fe:	89 90 d0 00 00 00    	mov    %edx,0xd0(%eax)
+		e1000w(E1000_IMS, causes);
+	}
+}
+f0107904:	c3                   	ret
+
+f0107905 <net_intr_disarm>:
+}
+
+// Mask the interrupt causes in 'causes', if polling.
+static void net_intr_disarm(uint32_t causes)
+{
+	if (!e1000_tunables.poll)
+f0107905:	80 3d b4 64 11 f0 00 	cmpb   $0x0,0xf01164b4
+f010790c:	74 22                	je     f0107930 <net_intr_disarm+0x2b>
+		return;
+	causes &= intr_armed;
+f010790e:	8b 15 40 fa 83 f0    	mov    0xf083fa40,%edx
+	if (causes) {
+f0107914:	21 d0                	and    %edx,%eax
+f0107916:	74 18                	je     f0107930 <net_intr_disarm+0x2b>
+		intr_armed &= ~causes;
+f0107918:	89 c1                	mov    %eax,%ecx
+f010791a:	f7 d1                	not    %ecx
+f010791c:	21 ca                	and    %ecx,%edx
+f010791e:	89 15 40 fa 83 f0    	mov    %edx,0xf083fa40
+	e1000[index >> 2] = value;
+f0107924:	8b 15 44 fa 83 f0    	mov    0xf083fa44,%edx
+f010792a:	89 82 d8 00 00 00    	mov    %eax,0xd8(%edx)
+		e1000w(E1000_IMC, causes);
+	}
+}
+f0107930:	c3                   	ret
+
+f0107931 <net_rx_ready>:
+	return e1000[index >> 2];
+f0107931:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f0107936:	8b 90 18 28 00 00    	mov    0x2818(%eax),%edx
+{
+	uint32_t rdt = e1000r(E1000_RDT);
+	size_t length;
+	int ndesc;
+
+	if (nm_env)
+f010793c:	83 3d 04 d6 83 f0 00 	cmpl   $0x0,0xf083d604
+f0107943:	74 20                	je     f0107965 <net_rx_ready+0x34>
+		return nm_rx_tail != rdt
+f0107945:	8b 0d 00 d6 83 f0    	mov    0xf083d600,%ecx
+			&& (rx_queue[nm_rx_tail].status & E1000_RXD_STAT_DD);
+f010794b:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107950:	39 d1                	cmp    %edx,%ecx
+f0107952:	74 0d                	je     f0107961 <net_rx_ready+0x30>
+f0107954:	c1 e1 04             	shl    $0x4,%ecx
+f0107957:	0f b6 81 4c de 83 f0 	movzbl -0xf7c21b4(%ecx),%eax
+f010795e:	83 e0 01             	and    $0x1,%eax
+f0107961:	83 e0 01             	and    $0x1,%eax
+	return net_rx_frame((rdt + 1) % RX_QUEUE_SIZE, &ndesc, &length);
+}
+f0107964:	c3                   	ret
+{
+f0107965:	55                   	push   %ebp
+f0107966:	89 e5                	mov    %esp,%ebp
+f0107968:	83 ec 18             	sub    $0x18,%esp
+	return net_rx_frame((rdt + 1) % RX_QUEUE_SIZE, &ndesc, &length);
+f010796b:	8d 42 01             	lea    0x1(%edx),%eax
+f010796e:	83 e0 7f             	and    $0x7f,%eax
+f0107971:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+f0107974:	8d 55 f0             	lea    -0x10(%ebp),%edx
+f0107977:	e8 87 fe ff ff       	call   f0107803 <net_rx_frame>
+}
+f010797c:	c9                   	leave
+f010797d:	c3                   	ret
+
+f010797e <net_rings_stop>:
+{
+f010797e:	55                   	push   %ebp
+f010797f:	89 e5                	mov    %esp,%ebp
+f0107981:	53                   	push   %ebx
+f0107982:	83 ec 04             	sub    $0x4,%esp
+	e1000[index >> 2] = value;
+f0107985:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f010798a:	c7 80 00 04 00 00 00 	movl   $0x0,0x400(%eax)
+f0107991:	00 00 00 
+f0107994:	c7 80 00 01 00 00 00 	movl   $0x0,0x100(%eax)
+f010799b:	00 00 00 
+	for (size_t i = 0; i < TX_QUEUE_SIZE; i++) {
+f010799e:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01079a3:	eb 17                	jmp    f01079bc <net_rings_stop+0x3e>
+		tx_queue[i].status = E1000_TXD_STAT_DD;
+f01079a5:	89 d8                	mov    %ebx,%eax
+f01079a7:	c1 e0 04             	shl    $0x4,%eax
+f01079aa:	c6 80 4c ea 83 f0 01 	movb   $0x1,-0xf7c15b4(%eax)
+	for (size_t i = 0; i < TX_QUEUE_SIZE; i++) {
+f01079b1:	83 c3 01             	add    $0x1,%ebx
+f01079b4:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+f01079ba:	74 24                	je     f01079e0 <net_rings_stop+0x62>
+		if (tx_pages[i]) {
+f01079bc:	8b 04 9d 40 da 83 f0 	mov    -0xf7c25c0(,%ebx,4),%eax
+f01079c3:	85 c0                	test   %eax,%eax
+f01079c5:	74 de                	je     f01079a5 <net_rings_stop+0x27>
+			page_decref(tx_pages[i]);
+f01079c7:	83 ec 0c             	sub    $0xc,%esp
+f01079ca:	50                   	push   %eax
+f01079cb:	e8 4b 9f ff ff       	call   f010191b <page_decref>
+			tx_pages[i] = NULL;
+f01079d0:	c7 04 9d 40 da 83 f0 	movl   $0x0,-0xf7c25c0(,%ebx,4)
+f01079d7:	00 00 00 00 
+f01079db:	83 c4 10             	add    $0x10,%esp
+f01079de:	eb c5                	jmp    f01079a5 <net_rings_stop+0x27>
+	tx_clean = 0;
+f01079e0:	c7 05 38 da 83 f0 00 	movl   $0x0,0xf083da38
+f01079e7:	00 00 00 
+	tx_done = tx_seq;
+f01079ea:	a1 34 da 83 f0       	mov    0xf083da34,%eax
+f01079ef:	a3 30 da 83 f0       	mov    %eax,0xf083da30
+	tx_ctx_valid = false;
+f01079f4:	c6 05 24 da 83 f0 00 	movb   $0x0,0xf083da24
+	e1000[index >> 2] = value;
+f01079fb:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f0107a00:	c7 80 10 38 00 00 00 	movl   $0x0,0x3810(%eax)
+f0107a07:	00 00 00 
+f0107a0a:	c7 80 18 38 00 00 00 	movl   $0x0,0x3818(%eax)
+f0107a11:	00 00 00 
+f0107a14:	c7 80 10 28 00 00 00 	movl   $0x0,0x2810(%eax)
+f0107a1b:	00 00 00 
+f0107a1e:	c7 80 18 28 00 00 7f 	movl   $0x7f,0x2818(%eax)
+f0107a25:	00 00 00 
+}
+f0107a28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107a2b:	c9                   	leave
+f0107a2c:	c3                   	ret
+
+f0107a2d <net_tx_reclaim>:
+{
+f0107a2d:	55                   	push   %ebp
+f0107a2e:	89 e5                	mov    %esp,%ebp
+f0107a30:	56                   	push   %esi
+f0107a31:	53                   	push   %ebx
+	return e1000[index >> 2];
+f0107a32:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f0107a37:	8b 98 18 38 00 00    	mov    0x3818(%eax),%ebx
+	while (tx_clean != tdt) {
+f0107a3d:	eb 1d                	jmp    f0107a5c <net_tx_reclaim+0x2f>
+		if (tx_desc_eop(tdesc))
+f0107a3f:	a8 01                	test   $0x1,%al
+f0107a41:	74 07                	je     f0107a4a <net_tx_reclaim+0x1d>
+			tx_done++;
+f0107a43:	83 05 30 da 83 f0 01 	addl   $0x1,0xf083da30
+		tx_clean = (tx_clean + 1) % TX_QUEUE_SIZE;
+f0107a4a:	a1 38 da 83 f0       	mov    0xf083da38,%eax
+f0107a4f:	83 c0 01             	add    $0x1,%eax
+f0107a52:	25 ff 00 00 00       	and    $0xff,%eax
+f0107a57:	a3 38 da 83 f0       	mov    %eax,0xf083da38
+	while (tx_clean != tdt) {
+f0107a5c:	a1 38 da 83 f0       	mov    0xf083da38,%eax
+f0107a61:	39 d8                	cmp    %ebx,%eax
+f0107a63:	74 4b                	je     f0107ab0 <net_tx_reclaim+0x83>
+		tdesc = &tx_queue[tx_clean];
+f0107a65:	89 c2                	mov    %eax,%edx
+f0107a67:	c1 e2 04             	shl    $0x4,%edx
+f0107a6a:	8d b2 40 ea 83 f0    	lea    -0xf7c15c0(%edx),%esi
+		if (!(tdesc->status & E1000_TXD_STAT_DD))
+f0107a70:	f6 82 4c ea 83 f0 01 	testb  $0x1,-0xf7c15b4(%edx)
+f0107a77:	74 37                	je     f0107ab0 <net_tx_reclaim+0x83>
+		if (tx_pages[tx_clean]) {
+f0107a79:	8b 04 85 40 da 83 f0 	mov    -0xf7c25c0(,%eax,4),%eax
+f0107a80:	85 c0                	test   %eax,%eax
+f0107a82:	74 1c                	je     f0107aa0 <net_tx_reclaim+0x73>
+			page_decref(tx_pages[tx_clean]);
+f0107a84:	83 ec 0c             	sub    $0xc,%esp
+f0107a87:	50                   	push   %eax
+f0107a88:	e8 8e 9e ff ff       	call   f010191b <page_decref>
+			tx_pages[tx_clean] = NULL;
+f0107a8d:	a1 38 da 83 f0       	mov    0xf083da38,%eax
+f0107a92:	c7 04 85 40 da 83 f0 	movl   $0x0,-0xf7c25c0(,%eax,4)
+f0107a99:	00 00 00 00 
+f0107a9d:	83 c4 10             	add    $0x10,%esp
+	if ((ddesc->cmd & E1000_TXD_CMD_DEXT)
+f0107aa0:	0f b6 46 0b          	movzbl 0xb(%esi),%eax
+f0107aa4:	a8 20                	test   $0x20,%al
+f0107aa6:	74 97                	je     f0107a3f <net_tx_reclaim+0x12>
+	    && (ddesc->dtyp & 0xF0) == (E1000_TXD_DTYP_C >> 16))
+f0107aa8:	80 7e 0a 0f          	cmpb   $0xf,0xa(%esi)
+f0107aac:	77 91                	ja     f0107a3f <net_tx_reclaim+0x12>
+f0107aae:	eb 9a                	jmp    f0107a4a <net_tx_reclaim+0x1d>
+}
+f0107ab0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0107ab3:	5b                   	pop    %ebx
+f0107ab4:	5e                   	pop    %esi
+f0107ab5:	5d                   	pop    %ebp
+f0107ab6:	c3                   	ret
+
+f0107ab7 <e1000_tx_done>:
+{
+f0107ab7:	55                   	push   %ebp
+f0107ab8:	89 e5                	mov    %esp,%ebp
+f0107aba:	83 ec 08             	sub    $0x8,%esp
+	net_tx_reclaim();
+f0107abd:	e8 6b ff ff ff       	call   f0107a2d <net_tx_reclaim>
+}
+f0107ac2:	a1 30 da 83 f0       	mov    0xf083da30,%eax
+f0107ac7:	c9                   	leave
+f0107ac8:	c3                   	ret
+
+f0107ac9 <e1000_intr>:
+// the IRQ line drop; then wake up whoever waits for what happened.
+// Whatever happened stays masked until e1000_ready finds the ring
+// drained again, so that a busy ring is polled rather than interrupting
+// for every packet.
+static void e1000_intr(void)
+{
+f0107ac9:	55                   	push   %ebp
+f0107aca:	89 e5                	mov    %esp,%ebp
+f0107acc:	56                   	push   %esi
+f0107acd:	53                   	push   %ebx
+	return e1000[index >> 2];
+f0107ace:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f0107ad3:	8b 98 c0 00 00 00    	mov    0xc0(%eax),%ebx
+	uint32_t icr = e1000r(E1000_ICR), events = 0;
+
+	e1000_stats.intrs++;
+f0107ad9:	83 05 e0 d3 83 f0 01 	addl   $0x1,0xf083d3e0
+	if (icr & E1000_ICR_RX) {
+f0107ae0:	89 de                	mov    %ebx,%esi
+f0107ae2:	81 e6 d0 00 00 00    	and    $0xd0,%esi
+f0107ae8:	75 31                	jne    f0107b1b <e1000_intr+0x52>
+		e1000_stats.rx_intrs++;
+		net_intr_disarm(E1000_ICR_RX);
+		events |= NET_WAIT_RX;
+	}
+	if (icr & E1000_ICR_TXDW) {
+f0107aea:	f6 c3 01             	test   $0x1,%bl
+f0107aed:	74 25                	je     f0107b14 <e1000_intr+0x4b>
+		e1000_stats.tx_intrs++;
+f0107aef:	83 05 e8 d3 83 f0 01 	addl   $0x1,0xf083d3e8
+		net_intr_disarm(E1000_ICR_TXDW);
+f0107af6:	b8 01 00 00 00       	mov    $0x1,%eax
+f0107afb:	e8 05 fe ff ff       	call   f0107905 <net_intr_disarm>
+		net_tx_reclaim();
+f0107b00:	e8 28 ff ff ff       	call   f0107a2d <net_tx_reclaim>
+		events |= NET_WAIT_TX;
+f0107b05:	83 ce 02             	or     $0x2,%esi
+	}
+	if (events)
+		net_wake(events);
+f0107b08:	83 ec 0c             	sub    $0xc,%esp
+f0107b0b:	56                   	push   %esi
+f0107b0c:	e8 72 d8 ff ff       	call   f0105383 <net_wake>
+f0107b11:	83 c4 10             	add    $0x10,%esp
+}
+f0107b14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0107b17:	5b                   	pop    %ebx
+f0107b18:	5e                   	pop    %esi
+f0107b19:	5d                   	pop    %ebp
+f0107b1a:	c3                   	ret
+		e1000_stats.rx_intrs++;
+f0107b1b:	83 05 e4 d3 83 f0 01 	addl   $0x1,0xf083d3e4
+		net_intr_disarm(E1000_ICR_RX);
+f0107b22:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f0107b27:	e8 d9 fd ff ff       	call   f0107905 <net_intr_disarm>
+	if (icr & E1000_ICR_TXDW) {
+f0107b2c:	83 e3 01             	and    $0x1,%ebx
+f0107b2f:	89 de                	mov    %ebx,%esi
+f0107b31:	75 bc                	jne    f0107aef <e1000_intr+0x26>
+f0107b33:	be 01 00 00 00       	mov    $0x1,%esi
+f0107b38:	eb ce                	jmp    f0107b08 <e1000_intr+0x3f>
+
+f0107b3a <net_tx_copy>:
+{
+f0107b3a:	55                   	push   %ebp
+f0107b3b:	89 e5                	mov    %esp,%ebp
+f0107b3d:	57                   	push   %edi
+f0107b3e:	56                   	push   %esi
+f0107b3f:	53                   	push   %ebx
+f0107b40:	83 ec 1c             	sub    $0x1c,%esp
+f0107b43:	89 c6                	mov    %eax,%esi
+f0107b45:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0107b48:	89 cf                	mov    %ecx,%edi
+f0107b4a:	eb 35                	jmp    f0107b81 <net_tx_copy+0x47>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0107b4c:	50                   	push   %eax
+f0107b4d:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0107b52:	68 a9 00 00 00       	push   $0xa9
+f0107b57:	68 d9 c8 10 f0       	push   $0xf010c8d9
+f0107b5c:	e8 e8 84 ff ff       	call   f0100049 <_panic>
+f0107b61:	89 f0                	mov    %esi,%eax
+f0107b63:	c1 e0 04             	shl    $0x4,%eax
+f0107b66:	c6 80 4b ea 83 f0 09 	movb   $0x9,-0xf7c15b5(%eax)
+		tdesc->status = 0;
+f0107b6d:	c6 80 4c ea 83 f0 00 	movb   $0x0,-0xf7c15b4(%eax)
+		packet += n;
+f0107b74:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+		tdt = (tdt + 1) % TX_QUEUE_SIZE;
+f0107b77:	8d 46 01             	lea    0x1(%esi),%eax
+f0107b7a:	0f b6 f0             	movzbl %al,%esi
+	} while (length > 0);
+f0107b7d:	29 df                	sub    %ebx,%edi
+f0107b7f:	74 7e                	je     f0107bff <net_tx_copy+0xc5>
+		n = MIN(length, TX_BUFFER_SIZE);
+f0107b81:	b8 ee 05 00 00       	mov    $0x5ee,%eax
+f0107b86:	39 c7                	cmp    %eax,%edi
+f0107b88:	0f 46 c7             	cmovbe %edi,%eax
+f0107b8b:	89 c3                	mov    %eax,%ebx
+		tdesc->buffer_addr = PADDR(tx_buffer[tdt]);
+f0107b8d:	8b 04 b5 40 e6 83 f0 	mov    -0xf7c19c0(,%esi,4),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0107b94:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0107b99:	76 b1                	jbe    f0107b4c <net_tx_copy+0x12>
+f0107b9b:	89 f2                	mov    %esi,%edx
+f0107b9d:	c1 e2 04             	shl    $0x4,%edx
+f0107ba0:	8d 8a 40 ea 83 f0    	lea    -0xf7c15c0(%edx),%ecx
+f0107ba6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	return (physaddr_t)kva - KERNBASE;
+f0107ba9:	8d 88 00 00 00 10    	lea    0x10000000(%eax),%ecx
+f0107baf:	89 8a 40 ea 83 f0    	mov    %ecx,-0xf7c15c0(%edx)
+f0107bb5:	c7 82 44 ea 83 f0 00 	movl   $0x0,-0xf7c15bc(%edx)
+f0107bbc:	00 00 00 
+		memcpy(tx_buffer[tdt], packet, n);
+f0107bbf:	83 ec 04             	sub    $0x4,%esp
+f0107bc2:	53                   	push   %ebx
+f0107bc3:	ff 75 e4             	push   -0x1c(%ebp)
+f0107bc6:	50                   	push   %eax
+f0107bc7:	e8 d1 f2 ff ff       	call   f0106e9d <memcpy>
+		tdesc->length = n;
+f0107bcc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0107bcf:	66 89 59 08          	mov    %bx,0x8(%ecx)
+		tdesc->cmd = E1000_TXD_CMD_RS;
+f0107bd3:	c6 41 0b 08          	movb   $0x8,0xb(%ecx)
+		if (n == length)
+f0107bd7:	83 c4 10             	add    $0x10,%esp
+f0107bda:	81 ff ee 05 00 00    	cmp    $0x5ee,%edi
+f0107be0:	0f 86 7b ff ff ff    	jbe    f0107b61 <net_tx_copy+0x27>
+			tdesc->cmd |= E1000_TXD_CMD_EOP;
+f0107be6:	89 f0                	mov    %esi,%eax
+f0107be8:	c1 e0 04             	shl    $0x4,%eax
+		tdesc->status = 0;
+f0107beb:	c6 80 4c ea 83 f0 00 	movb   $0x0,-0xf7c15b4(%eax)
+		packet += n;
+f0107bf2:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+		length -= n;
+f0107bf5:	29 df                	sub    %ebx,%edi
+		tdt = (tdt + 1) % TX_QUEUE_SIZE;
+f0107bf7:	8d 46 01             	lea    0x1(%esi),%eax
+f0107bfa:	0f b6 f0             	movzbl %al,%esi
+	} while (length > 0);
+f0107bfd:	eb 82                	jmp    f0107b81 <net_tx_copy+0x47>
+	tx_seq++;
+f0107bff:	83 05 34 da 83 f0 01 	addl   $0x1,0xf083da34
+}
+f0107c06:	89 f0                	mov    %esi,%eax
+f0107c08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107c0b:	5b                   	pop    %ebx
+f0107c0c:	5e                   	pop    %esi
+f0107c0d:	5f                   	pop    %edi
+f0107c0e:	5d                   	pop    %ebp
+f0107c0f:	c3                   	ret
+
+f0107c10 <e1000_tx_batch>:
+{
+f0107c10:	55                   	push   %ebp
+f0107c11:	89 e5                	mov    %esp,%ebp
+f0107c13:	57                   	push   %edi
+f0107c14:	56                   	push   %esi
+f0107c15:	53                   	push   %ebx
+f0107c16:	83 ec 1c             	sub    $0x1c,%esp
+f0107c19:	8b 7d 08             	mov    0x8(%ebp),%edi
+	return e1000[index >> 2];
+f0107c1c:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f0107c21:	8b 80 18 38 00 00    	mov    0x3818(%eax),%eax
+f0107c27:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	net_tx_reclaim();
+f0107c2a:	e8 fe fd ff ff       	call   f0107a2d <net_tx_reclaim>
+	free = net_tx_free();
+f0107c2f:	e8 b8 fb ff ff       	call   f01077ec <net_tx_free>
+f0107c34:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n && TX_BUFFERS(pkts[i].sg_len) <= free; i++) {
+f0107c36:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0107c3b:	eb 13                	jmp    f0107c50 <e1000_tx_batch+0x40>
+		free -= TX_BUFFERS(pkts[i].sg_len);
+f0107c3d:	29 d6                	sub    %edx,%esi
+		tdt = net_tx_copy(tdt, pkts[i].sg_va, pkts[i].sg_len);
+f0107c3f:	8b 14 df             	mov    (%edi,%ebx,8),%edx
+f0107c42:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107c45:	e8 f0 fe ff ff       	call   f0107b3a <net_tx_copy>
+f0107c4a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (i = 0; i < n && TX_BUFFERS(pkts[i].sg_len) <= free; i++) {
+f0107c4d:	83 c3 01             	add    $0x1,%ebx
+f0107c50:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+f0107c53:	7d 1a                	jge    f0107c6f <e1000_tx_batch+0x5f>
+f0107c55:	8b 4c df 04          	mov    0x4(%edi,%ebx,8),%ecx
+f0107c59:	8d 91 ed 05 00 00    	lea    0x5ed(%ecx),%edx
+f0107c5f:	d1 ea                	shr    %edx
+f0107c61:	b8 71 5e 58 56       	mov    $0x56585e71,%eax
+f0107c66:	f7 e2                	mul    %edx
+f0107c68:	c1 ea 08             	shr    $0x8,%edx
+f0107c6b:	39 d6                	cmp    %edx,%esi
+f0107c6d:	73 ce                	jae    f0107c3d <e1000_tx_batch+0x2d>
+	if (i > 0)
+f0107c6f:	85 db                	test   %ebx,%ebx
+f0107c71:	7e 0e                	jle    f0107c81 <e1000_tx_batch+0x71>
+	e1000[index >> 2] = value;
+f0107c73:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f0107c78:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0107c7b:	89 b0 18 38 00 00    	mov    %esi,0x3818(%eax)
+}
+f0107c81:	89 d8                	mov    %ebx,%eax
+f0107c83:	83 c4 1c             	add    $0x1c,%esp
+f0107c86:	5b                   	pop    %ebx
+f0107c87:	5e                   	pop    %esi
+f0107c88:	5f                   	pop    %edi
+f0107c89:	5d                   	pop    %ebp
+f0107c8a:	c3                   	ret
+
+f0107c8b <e1000_tx>:
+{
+f0107c8b:	55                   	push   %ebp
+f0107c8c:	89 e5                	mov    %esp,%ebp
+f0107c8e:	56                   	push   %esi
+f0107c8f:	53                   	push   %ebx
+f0107c90:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	length = MIN(length, NET_FRAME_MAX);
+f0107c93:	b8 3a 23 00 00       	mov    $0x233a,%eax
+f0107c98:	39 c3                	cmp    %eax,%ebx
+f0107c9a:	0f 47 d8             	cmova  %eax,%ebx
+	net_tx_reclaim();
+f0107c9d:	e8 8b fd ff ff       	call   f0107a2d <net_tx_reclaim>
+	if (net_tx_free() < TX_BUFFERS(length))
+f0107ca2:	e8 45 fb ff ff       	call   f01077ec <net_tx_free>
+f0107ca7:	89 c1                	mov    %eax,%ecx
+f0107ca9:	8d 93 ed 05 00 00    	lea    0x5ed(%ebx),%edx
+f0107caf:	d1 ea                	shr    %edx
+f0107cb1:	be 71 5e 58 56       	mov    $0x56585e71,%esi
+f0107cb6:	89 d0                	mov    %edx,%eax
+f0107cb8:	f7 e6                	mul    %esi
+f0107cba:	c1 ea 08             	shr    $0x8,%edx
+f0107cbd:	39 d1                	cmp    %edx,%ecx
+f0107cbf:	73 0b                	jae    f0107ccc <e1000_tx+0x41>
+		return 0;
+f0107cc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f0107cc6:	89 d8                	mov    %ebx,%eax
+f0107cc8:	5b                   	pop    %ebx
+f0107cc9:	5e                   	pop    %esi
+f0107cca:	5d                   	pop    %ebp
+f0107ccb:	c3                   	ret
+	return e1000[index >> 2];
+f0107ccc:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f0107cd1:	8b 80 18 38 00 00    	mov    0x3818(%eax),%eax
+	e1000w(E1000_TDT, net_tx_copy(e1000r(E1000_TDT), packet, length));
+f0107cd7:	89 d9                	mov    %ebx,%ecx
+f0107cd9:	8b 55 08             	mov    0x8(%ebp),%edx
+f0107cdc:	e8 59 fe ff ff       	call   f0107b3a <net_tx_copy>
+	e1000[index >> 2] = value;
+f0107ce1:	8b 15 44 fa 83 f0    	mov    0xf083fa44,%edx
+f0107ce7:	89 82 18 38 00 00    	mov    %eax,0x3818(%edx)
+	return length;
+f0107ced:	eb d7                	jmp    f0107cc6 <e1000_tx+0x3b>
+
+f0107cef <e1000_tx_frags>:
+{
+f0107cef:	55                   	push   %ebp
+f0107cf0:	89 e5                	mov    %esp,%ebp
+f0107cf2:	57                   	push   %edi
+f0107cf3:	56                   	push   %esi
+f0107cf4:	53                   	push   %ebx
+f0107cf5:	83 ec 2c             	sub    $0x2c,%esp
+f0107cf8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	return e1000[index >> 2];
+f0107cfb:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f0107d00:	8b b8 18 38 00 00    	mov    0x3818(%eax),%edi
+	uint8_t popts = 0, dcmd = 0;
+f0107d06:	c6 45 db 00          	movb   $0x0,-0x25(%ebp)
+	if (off && (off->no_flags & NET_CSUM_IP))
+f0107d0a:	85 db                	test   %ebx,%ebx
+f0107d0c:	74 15                	je     f0107d23 <e1000_tx_frags+0x34>
+f0107d0e:	0f b6 03             	movzbl (%ebx),%eax
+f0107d11:	89 c1                	mov    %eax,%ecx
+f0107d13:	83 e1 01             	and    $0x1,%ecx
+		popts |= E1000_TXD_POPTS_TXSM;
+f0107d16:	89 ca                	mov    %ecx,%edx
+f0107d18:	83 ca 02             	or     $0x2,%edx
+f0107d1b:	a8 02                	test   $0x2,%al
+f0107d1d:	0f 45 ca             	cmovne %edx,%ecx
+f0107d20:	88 4d db             	mov    %cl,-0x25(%ebp)
+	net_tx_reclaim();
+f0107d23:	e8 05 fd ff ff       	call   f0107a2d <net_tx_reclaim>
+		return 0;
+f0107d28:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+	if (n <= 0 || net_tx_free() < n + (popts != 0))
+f0107d2f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f0107d33:	0f 8e 28 02 00 00    	jle    f0107f61 <e1000_tx_frags+0x272>
+f0107d39:	e8 ae fa ff ff       	call   f01077ec <net_tx_free>
+f0107d3e:	89 c2                	mov    %eax,%edx
+f0107d40:	80 7d db 01          	cmpb   $0x1,-0x25(%ebp)
+f0107d44:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0107d47:	83 d8 ff             	sbb    $0xffffffff,%eax
+		return 0;
+f0107d4a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+	if (n <= 0 || net_tx_free() < n + (popts != 0))
+f0107d51:	39 c2                	cmp    %eax,%edx
+f0107d53:	0f 82 08 02 00 00    	jb     f0107f61 <e1000_tx_frags+0x272>
+	uint8_t popts = 0, dcmd = 0;
+f0107d59:	c6 45 da 00          	movb   $0x0,-0x26(%ebp)
+	if (off && (off->no_flags & NET_TSO))
+f0107d5d:	85 db                	test   %ebx,%ebx
+f0107d5f:	74 09                	je     f0107d6a <e1000_tx_frags+0x7b>
+f0107d61:	0f b6 03             	movzbl (%ebx),%eax
+f0107d64:	83 e0 04             	and    $0x4,%eax
+f0107d67:	88 45 da             	mov    %al,-0x26(%ebp)
+	if (popts) {
+f0107d6a:	80 7d db 00          	cmpb   $0x0,-0x25(%ebp)
+f0107d6e:	0f 84 f6 00 00 00    	je     f0107e6a <e1000_tx_frags+0x17b>
+		for (int i = 0; i < n; i++)
+f0107d74:	b8 00 00 00 00       	mov    $0x0,%eax
+	size_t length = 0;
+f0107d79:	be 00 00 00 00       	mov    $0x0,%esi
+f0107d7e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0107d81:	89 5d 10             	mov    %ebx,0x10(%ebp)
+f0107d84:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			length += frags[i].len;
+f0107d87:	0f b7 54 c1 06       	movzwl 0x6(%ecx,%eax,8),%edx
+f0107d8c:	01 d6                	add    %edx,%esi
+		for (int i = 0; i < n; i++)
+f0107d8e:	83 c0 01             	add    $0x1,%eax
+f0107d91:	39 c3                	cmp    %eax,%ebx
+f0107d93:	75 f2                	jne    f0107d87 <e1000_tx_frags+0x98>
+	struct tx_ctx_desc *cdesc = (struct tx_ctx_desc *) &tx_queue[tdt];
+f0107d95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+f0107d98:	89 f8                	mov    %edi,%eax
+f0107d9a:	c1 e0 04             	shl    $0x4,%eax
+f0107d9d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0107da0:	05 40 ea 83 f0       	add    $0xf083ea40,%eax
+f0107da5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!tso && tx_ctx_valid && tx_ctx.no_iphdr == off->no_iphdr
+f0107da8:	0f b6 03             	movzbl (%ebx),%eax
+f0107dab:	83 e0 04             	and    $0x4,%eax
+f0107dae:	88 45 e0             	mov    %al,-0x20(%ebp)
+f0107db1:	75 19                	jne    f0107dcc <e1000_tx_frags+0xdd>
+f0107db3:	80 3d 24 da 83 f0 00 	cmpb   $0x0,0xf083da24
+f0107dba:	74 10                	je     f0107dcc <e1000_tx_frags+0xdd>
+f0107dbc:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+f0107dc0:	38 05 29 da 83 f0    	cmp    %al,0xf083da29
+f0107dc6:	0f 84 b8 00 00 00    	je     f0107e84 <e1000_tx_frags+0x195>
+	memset(cdesc, 0, sizeof(*cdesc));
+f0107dcc:	83 ec 04             	sub    $0x4,%esp
+f0107dcf:	6a 10                	push   $0x10
+f0107dd1:	6a 00                	push   $0x0
+f0107dd3:	ff 75 e4             	push   -0x1c(%ebp)
+f0107dd6:	e8 2b f0 ff ff       	call   f0106e06 <memset>
+	cdesc->ipcss = off->no_iphdr;
+f0107ddb:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+f0107ddf:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0107de2:	88 82 40 ea 83 f0    	mov    %al,-0xf7c15c0(%edx)
+	cdesc->ipcso = off->no_iphdr + 10;	/* IP header checksum */
+f0107de8:	83 c0 0a             	add    $0xa,%eax
+f0107deb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0107dee:	88 41 01             	mov    %al,0x1(%ecx)
+	cdesc->ipcse = off->no_l4hdr - 1;
+f0107df1:	0f b6 43 02          	movzbl 0x2(%ebx),%eax
+f0107df5:	83 e8 01             	sub    $0x1,%eax
+f0107df8:	66 89 41 02          	mov    %ax,0x2(%ecx)
+	cdesc->tucss = off->no_l4hdr;
+f0107dfc:	0f b6 43 02          	movzbl 0x2(%ebx),%eax
+f0107e00:	88 41 04             	mov    %al,0x4(%ecx)
+	cdesc->tucso = off->no_l4csum;
+f0107e03:	0f b6 43 03          	movzbl 0x3(%ebx),%eax
+f0107e07:	88 41 05             	mov    %al,0x5(%ecx)
+	cdesc->tucse = 0;
+f0107e0a:	66 c7 41 06 00 00    	movw   $0x0,0x6(%ecx)
+	cdesc->dtyp = E1000_TXD_DTYP_C >> 16;
+f0107e10:	c6 41 0a 00          	movb   $0x0,0xa(%ecx)
+	cdesc->cmd = E1000_TXD_CMD_DEXT | E1000_TXD_CMD_RS;
+f0107e14:	c6 41 0b 28          	movb   $0x28,0xb(%ecx)
+	if (tso) {
+f0107e18:	83 c4 10             	add    $0x10,%esp
+f0107e1b:	80 7d e0 00          	cmpb   $0x0,-0x20(%ebp)
+f0107e1f:	74 28                	je     f0107e49 <e1000_tx_frags+0x15a>
+		paylen = length - off->no_hdrlen;
+f0107e21:	0f b6 43 04          	movzbl 0x4(%ebx),%eax
+f0107e25:	29 c6                	sub    %eax,%esi
+		cdesc->paylen = paylen & 0xFFFF;
+f0107e27:	66 89 71 08          	mov    %si,0x8(%ecx)
+		cdesc->dtyp |= (paylen >> 16) & 0xF;
+f0107e2b:	c1 ee 10             	shr    $0x10,%esi
+f0107e2e:	89 f0                	mov    %esi,%eax
+f0107e30:	83 e0 0f             	and    $0xf,%eax
+f0107e33:	88 41 0a             	mov    %al,0xa(%ecx)
+		cdesc->hdr_len = off->no_hdrlen;
+f0107e36:	0f b6 43 04          	movzbl 0x4(%ebx),%eax
+f0107e3a:	88 41 0d             	mov    %al,0xd(%ecx)
+		cdesc->mss = off->no_mss;
+f0107e3d:	0f b7 43 06          	movzwl 0x6(%ebx),%eax
+f0107e41:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+		cdesc->cmd |= (E1000_TXD_CMD_TSE | E1000_TXD_CMD_IP
+f0107e45:	c6 41 0b 2f          	movb   $0x2f,0xb(%ecx)
+	tx_ctx = *off;
+f0107e49:	8b 03                	mov    (%ebx),%eax
+f0107e4b:	8b 53 04             	mov    0x4(%ebx),%edx
+f0107e4e:	a3 28 da 83 f0       	mov    %eax,0xf083da28
+f0107e53:	89 15 2c da 83 f0    	mov    %edx,0xf083da2c
+	tx_ctx_valid = !tso;
+f0107e59:	80 7d e0 00          	cmpb   $0x0,-0x20(%ebp)
+f0107e5d:	0f 94 05 24 da 83 f0 	sete   0xf083da24
+	return (tdt + 1) % TX_QUEUE_SIZE;
+f0107e64:	8d 47 01             	lea    0x1(%edi),%eax
+f0107e67:	0f b6 f8             	movzbl %al,%edi
+f0107e6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	size_t length = 0;
+f0107e6d:	be 00 00 00 00       	mov    $0x0,%esi
+f0107e72:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+		if (i == n - 1)
+f0107e79:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0107e7c:	83 e8 01             	sub    $0x1,%eax
+f0107e7f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0107e82:	eb 42                	jmp    f0107ec6 <e1000_tx_frags+0x1d7>
+	    && tx_ctx.no_l4csum == off->no_l4csum)
+f0107e84:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+f0107e88:	66 39 05 2a da 83 f0 	cmp    %ax,0xf083da2a
+f0107e8f:	0f 85 37 ff ff ff    	jne    f0107dcc <e1000_tx_frags+0xdd>
+f0107e95:	eb d3                	jmp    f0107e6a <e1000_tx_frags+0x17b>
+		ddesc->status = 0;
+f0107e97:	c6 42 0c 00          	movb   $0x0,0xc(%edx)
+		frags[i].pp->pp_ref++;
+f0107e9b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0107e9e:	8b 02                	mov    (%edx),%eax
+f0107ea0:	66 83 40 08 01       	addw   $0x1,0x8(%eax)
+		tx_pages[tdt] = frags[i].pp;
+f0107ea5:	8b 02                	mov    (%edx),%eax
+f0107ea7:	89 04 bd 40 da 83 f0 	mov    %eax,-0xf7c25c0(,%edi,4)
+		length += frags[i].len;
+f0107eae:	0f b7 42 06          	movzwl 0x6(%edx),%eax
+f0107eb2:	01 45 dc             	add    %eax,-0x24(%ebp)
+		tdt = (tdt + 1) % TX_QUEUE_SIZE;
+f0107eb5:	8d 47 01             	lea    0x1(%edi),%eax
+f0107eb8:	0f b6 f8             	movzbl %al,%edi
+	for (int i = 0; i < n; i++) {
+f0107ebb:	83 c6 01             	add    $0x1,%esi
+f0107ebe:	83 c1 08             	add    $0x8,%ecx
+f0107ec1:	39 75 0c             	cmp    %esi,0xc(%ebp)
+f0107ec4:	74 7d                	je     f0107f43 <e1000_tx_frags+0x254>
+		ddesc = (struct tx_data_desc *) &tx_queue[tdt];
+f0107ec6:	89 f8                	mov    %edi,%eax
+f0107ec8:	c1 e0 04             	shl    $0x4,%eax
+f0107ecb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0107ece:	8d 90 40 ea 83 f0    	lea    -0xf7c15c0(%eax),%edx
+		ddesc->buffer_addr = page2pa(frags[i].pp) + frags[i].off;
+f0107ed4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	return (pp - pool.pages) << PGSHIFT;
+f0107ed7:	8b 01                	mov    (%ecx),%eax
+f0107ed9:	bb 60 c2 7f f0       	mov    $0xf07fc260,%ebx
+f0107ede:	2b 43 08             	sub    0x8(%ebx),%eax
+f0107ee1:	c1 f8 02             	sar    $0x2,%eax
+f0107ee4:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0107eea:	c1 e0 0c             	shl    $0xc,%eax
+f0107eed:	0f b7 59 04          	movzwl 0x4(%ecx),%ebx
+f0107ef1:	01 d8                	add    %ebx,%eax
+f0107ef3:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0107ef6:	89 83 40 ea 83 f0    	mov    %eax,-0xf7c15c0(%ebx)
+f0107efc:	c7 83 44 ea 83 f0 00 	movl   $0x0,-0xf7c15bc(%ebx)
+f0107f03:	00 00 00 
+		ddesc->length = frags[i].len;
+f0107f06:	0f b7 41 06          	movzwl 0x6(%ecx),%eax
+f0107f0a:	66 89 42 08          	mov    %ax,0x8(%edx)
+			ddesc->cmd |= E1000_TXD_CMD_EOP;
+f0107f0e:	39 75 d4             	cmp    %esi,-0x2c(%ebp)
+f0107f11:	0f 94 c0             	sete   %al
+f0107f14:	83 c0 08             	add    $0x8,%eax
+f0107f17:	88 42 0b             	mov    %al,0xb(%edx)
+		ddesc->dtyp = 0;
+f0107f1a:	c6 42 0a 00          	movb   $0x0,0xa(%edx)
+		ddesc->popts = 0;
+f0107f1e:	c6 42 0d 00          	movb   $0x0,0xd(%edx)
+		if (popts) {
+f0107f22:	0f b6 5d db          	movzbl -0x25(%ebp),%ebx
+f0107f26:	84 db                	test   %bl,%bl
+f0107f28:	0f 84 69 ff ff ff    	je     f0107e97 <e1000_tx_frags+0x1a8>
+			ddesc->dtyp = E1000_TXD_DTYP_D >> 16;
+f0107f2e:	c6 42 0a 10          	movb   $0x10,0xa(%edx)
+			ddesc->cmd |= E1000_TXD_CMD_DEXT | dcmd;
+f0107f32:	0a 45 da             	or     -0x26(%ebp),%al
+f0107f35:	83 c8 20             	or     $0x20,%eax
+f0107f38:	88 42 0b             	mov    %al,0xb(%edx)
+			ddesc->popts = popts;
+f0107f3b:	88 5a 0d             	mov    %bl,0xd(%edx)
+f0107f3e:	e9 54 ff ff ff       	jmp    f0107e97 <e1000_tx_frags+0x1a8>
+	*seq = tx_seq++;
+f0107f43:	a1 34 da 83 f0       	mov    0xf083da34,%eax
+f0107f48:	8d 50 01             	lea    0x1(%eax),%edx
+f0107f4b:	89 15 34 da 83 f0    	mov    %edx,0xf083da34
+f0107f51:	8b 55 14             	mov    0x14(%ebp),%edx
+f0107f54:	89 02                	mov    %eax,(%edx)
+	e1000[index >> 2] = value;
+f0107f56:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f0107f5b:	89 b8 18 38 00 00    	mov    %edi,0x3818(%eax)
+}
+f0107f61:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0107f64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107f67:	5b                   	pop    %ebx
+f0107f68:	5e                   	pop    %esi
+f0107f69:	5f                   	pop    %edi
+f0107f6a:	5d                   	pop    %ebp
+f0107f6b:	c3                   	ret
+
+f0107f6c <net_rx_copy>:
+{
+f0107f6c:	55                   	push   %ebp
+f0107f6d:	89 e5                	mov    %esp,%ebp
+f0107f6f:	57                   	push   %edi
+f0107f70:	56                   	push   %esi
+f0107f71:	53                   	push   %ebx
+f0107f72:	83 ec 2c             	sub    $0x2c,%esp
+f0107f75:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0107f78:	89 55 cc             	mov    %edx,-0x34(%ebp)
+f0107f7b:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+	size_t off = 0, n, done, at, chunk;
+f0107f7e:	be 00 00 00 00       	mov    $0x0,%esi
+				chunk = MIN(n - done, PGSIZE - at % PGSIZE);
+f0107f83:	89 f3                	mov    %esi,%ebx
+f0107f85:	e9 a3 00 00 00       	jmp    f010802d <net_rx_copy+0xc1>
+			memcpy(buffer + off, KADDR(rdesc->buffer_addr), n);
+f0107f8a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0107f8d:	c1 e0 04             	shl    $0x4,%eax
+f0107f90:	8b 80 40 de 83 f0    	mov    -0xf7c21c0(%eax),%eax
+	if (PGNUM(pa) >= npages)
+f0107f96:	89 c2                	mov    %eax,%edx
+f0107f98:	c1 ea 0c             	shr    $0xc,%edx
+f0107f9b:	3b 15 ac c2 7f f0    	cmp    0xf07fc2ac,%edx
+f0107fa1:	73 1c                	jae    f0107fbf <net_rx_copy+0x53>
+f0107fa3:	83 ec 04             	sub    $0x4,%esp
+f0107fa6:	ff 75 e4             	push   -0x1c(%ebp)
+	return (void *)(pa + KERNBASE);
+f0107fa9:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0107fae:	50                   	push   %eax
+f0107faf:	89 d8                	mov    %ebx,%eax
+f0107fb1:	03 45 08             	add    0x8(%ebp),%eax
+f0107fb4:	50                   	push   %eax
+f0107fb5:	e8 e3 ee ff ff       	call   f0106e9d <memcpy>
+f0107fba:	83 c4 10             	add    $0x10,%esp
+f0107fbd:	eb 3f                	jmp    f0107ffe <net_rx_copy+0x92>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0107fbf:	50                   	push   %eax
+f0107fc0:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0107fc5:	68 85 01 00 00       	push   $0x185
+f0107fca:	68 d9 c8 10 f0       	push   $0xf010c8d9
+f0107fcf:	e8 75 80 ff ff       	call   f0100049 <_panic>
+f0107fd4:	57                   	push   %edi
+f0107fd5:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0107fda:	68 8c 01 00 00       	push   $0x18c
+f0107fdf:	68 d9 c8 10 f0       	push   $0xf010c8d9
+f0107fe4:	e8 60 80 ff ff       	call   f0100049 <_panic>
+f0107fe9:	51                   	push   %ecx
+f0107fea:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0107fef:	6a 5f                	push   $0x5f
+f0107ff1:	68 31 ba 10 f0       	push   $0xf010ba31
+f0107ff6:	e8 4e 80 ff ff       	call   f0100049 <_panic>
+f0107ffb:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+		off += n;
+f0107ffe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108001:	01 c3                	add    %eax,%ebx
+		eop = rdesc->status & E1000_RXD_STAT_EOP;
+f0108003:	8b 7d dc             	mov    -0x24(%ebp),%edi
+f0108006:	89 f8                	mov    %edi,%eax
+f0108008:	c1 e0 04             	shl    $0x4,%eax
+f010800b:	0f b6 90 4c de 83 f0 	movzbl -0xf7c21b4(%eax),%edx
+		rdesc->status = 0;
+f0108012:	c6 80 4c de 83 f0 00 	movb   $0x0,-0xf7c21b4(%eax)
+		if (eop)
+f0108019:	f6 c2 02             	test   $0x2,%dl
+f010801c:	0f 85 d4 00 00 00    	jne    f01080f6 <net_rx_copy+0x18a>
+	for (i = first;; i = (i + 1) % RX_QUEUE_SIZE) {
+f0108022:	89 f8                	mov    %edi,%eax
+f0108024:	83 c0 01             	add    $0x1,%eax
+f0108027:	83 e0 7f             	and    $0x7f,%eax
+f010802a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+		n = MIN(rdesc->length, length - off);
+f010802d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0108030:	c1 e0 04             	shl    $0x4,%eax
+f0108033:	0f b7 90 48 de 83 f0 	movzwl -0xf7c21b8(%eax),%edx
+f010803a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010803d:	29 d8                	sub    %ebx,%eax
+f010803f:	39 c2                	cmp    %eax,%edx
+f0108041:	0f 46 c2             	cmovbe %edx,%eax
+f0108044:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			for (done = 0; done < n; done += chunk) {
+f0108047:	be 00 00 00 00       	mov    $0x0,%esi
+				at = RX_PKT_OFFSET + off + done;
+f010804c:	8d 43 08             	lea    0x8(%ebx),%eax
+f010804f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+		if (!pps)
+f0108052:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+f0108056:	0f 84 2e ff ff ff    	je     f0107f8a <net_rx_copy+0x1e>
+f010805c:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+			for (done = 0; done < n; done += chunk) {
+f010805f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108062:	39 c6                	cmp    %eax,%esi
+f0108064:	73 95                	jae    f0107ffb <net_rx_copy+0x8f>
+				at = RX_PKT_OFFSET + off + done;
+f0108066:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0108069:	01 f0                	add    %esi,%eax
+				chunk = MIN(n - done, PGSIZE - at % PGSIZE);
+f010806b:	89 c1                	mov    %eax,%ecx
+f010806d:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+f0108073:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+f0108076:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0108079:	29 f3                	sub    %esi,%ebx
+f010807b:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0108080:	29 ca                	sub    %ecx,%edx
+f0108082:	39 d3                	cmp    %edx,%ebx
+f0108084:	0f 47 da             	cmova  %edx,%ebx
+				       (uint8_t *) KADDR(rdesc->buffer_addr) + done,
+f0108087:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f010808a:	c1 e2 04             	shl    $0x4,%edx
+f010808d:	8b ba 40 de 83 f0    	mov    -0xf7c21c0(%edx),%edi
+	if (PGNUM(pa) >= npages)
+f0108093:	8b 15 ac c2 7f f0    	mov    0xf07fc2ac,%edx
+f0108099:	89 f9                	mov    %edi,%ecx
+f010809b:	c1 e9 0c             	shr    $0xc,%ecx
+f010809e:	39 d1                	cmp    %edx,%ecx
+f01080a0:	0f 83 2e ff ff ff    	jae    f0107fd4 <net_rx_copy+0x68>
+				memcpy((uint8_t *) page2kva(pps[at / PGSIZE])
+f01080a6:	8d bc 37 00 00 00 f0 	lea    -0x10000000(%edi,%esi,1),%edi
+f01080ad:	c1 e8 0c             	shr    $0xc,%eax
+	return (pp - pool.pages) << PGSHIFT;
+f01080b0:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f01080b3:	8b 04 81             	mov    (%ecx,%eax,4),%eax
+f01080b6:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f01080bc:	c1 f8 02             	sar    $0x2,%eax
+f01080bf:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01080c5:	89 c1                	mov    %eax,%ecx
+f01080c7:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f01080ca:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01080cf:	39 d0                	cmp    %edx,%eax
+f01080d1:	0f 83 12 ff ff ff    	jae    f0107fe9 <net_rx_copy+0x7d>
+f01080d7:	83 ec 04             	sub    $0x4,%esp
+f01080da:	53                   	push   %ebx
+f01080db:	57                   	push   %edi
+f01080dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01080df:	8d 84 08 00 00 00 f0 	lea    -0x10000000(%eax,%ecx,1),%eax
+f01080e6:	50                   	push   %eax
+f01080e7:	e8 b1 ed ff ff       	call   f0106e9d <memcpy>
+			for (done = 0; done < n; done += chunk) {
+f01080ec:	01 de                	add    %ebx,%esi
+f01080ee:	83 c4 10             	add    $0x10,%esp
+f01080f1:	e9 69 ff ff ff       	jmp    f010805f <net_rx_copy+0xf3>
+}
+f01080f6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01080f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01080fc:	5b                   	pop    %ebx
+f01080fd:	5e                   	pop    %esi
+f01080fe:	5f                   	pop    %edi
+f01080ff:	5d                   	pop    %ebp
+f0108100:	c3                   	ret
+
+f0108101 <e1000_rx_pages>:
+{
+f0108101:	55                   	push   %ebp
+f0108102:	89 e5                	mov    %esp,%ebp
+f0108104:	57                   	push   %edi
+f0108105:	56                   	push   %esi
+f0108106:	53                   	push   %ebx
+f0108107:	83 ec 3c             	sub    $0x3c,%esp
+	return e1000[index >> 2];
+f010810a:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f010810f:	8b 80 18 28 00 00    	mov    0x2818(%eax),%eax
+f0108115:	89 45 b8             	mov    %eax,-0x48(%ebp)
+	uint32_t rdt0 = e1000r(E1000_RDT), rdt = rdt0, first;
+f0108118:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	int n, i, ndesc, npages, npkts = 0, csum;
+f010811b:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%ebp)
+	for (n = 0; n < max; n += npages) {
+f0108122:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+f0108129:	e9 4b 01 00 00       	jmp    f0108279 <e1000_rx_pages+0x178>
+			rdt = net_rx_copy(first, 0, NULL, NULL);
+f010812e:	83 ec 0c             	sub    $0xc,%esp
+f0108131:	6a 00                	push   $0x0
+f0108133:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108138:	ba 00 00 00 00       	mov    $0x0,%edx
+f010813d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0108140:	e8 27 fe ff ff       	call   f0107f6c <net_rx_copy>
+f0108145:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			continue;
+f0108148:	83 c4 10             	add    $0x10,%esp
+			npages = 0;
+f010814b:	bb 00 00 00 00       	mov    $0x0,%ebx
+			continue;
+f0108150:	e9 21 01 00 00       	jmp    f0108276 <e1000_rx_pages+0x175>
+			if (n == 0 && rdt == rdt0)
+f0108155:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+f0108159:	75 0c                	jne    f0108167 <e1000_rx_pages+0x66>
+f010815b:	8b 7d b8             	mov    -0x48(%ebp),%edi
+f010815e:	39 7d cc             	cmp    %edi,-0x34(%ebp)
+f0108161:	0f 84 aa 00 00 00    	je     f0108211 <e1000_rx_pages+0x110>
+	if (rdt != rdt0)
+f0108167:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f010816a:	8b 45 b8             	mov    -0x48(%ebp),%eax
+f010816d:	39 c7                	cmp    %eax,%edi
+f010816f:	74 0b                	je     f010817c <e1000_rx_pages+0x7b>
+	e1000[index >> 2] = value;
+f0108171:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f0108176:	89 b8 18 28 00 00    	mov    %edi,0x2818(%eax)
+	if (npkts > 0) {
+f010817c:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f010817f:	85 c0                	test   %eax,%eax
+f0108181:	7e 0d                	jle    f0108190 <e1000_rx_pages+0x8f>
+		e1000_stats.rx_polls++;
+f0108183:	83 05 ec d3 83 f0 01 	addl   $0x1,0xf083d3ec
+		e1000_stats.rx_packets += npkts;
+f010818a:	01 05 f0 d3 83 f0    	add    %eax,0xf083d3f0
+}
+f0108190:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0108193:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108196:	5b                   	pop    %ebx
+f0108197:	5e                   	pop    %esi
+f0108198:	5f                   	pop    %edi
+f0108199:	5d                   	pop    %ebp
+f010819a:	c3                   	ret
+			pps[n] = pa2page(rdesc->buffer_addr);
+f010819b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010819e:	c1 e0 04             	shl    $0x4,%eax
+	if (PGNUM(pa) >= npages)
+f01081a1:	8b 80 40 de 83 f0    	mov    -0xf7c21c0(%eax),%eax
+f01081a7:	c1 e8 0c             	shr    $0xc,%eax
+f01081aa:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f01081b0:	73 4b                	jae    f01081fd <e1000_rx_pages+0xfc>
+	return &pool.pages[PGNUM(pa)];
+f01081b2:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f01081b5:	a1 68 c2 7f f0       	mov    0xf07fc268,%eax
+f01081ba:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f01081bd:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f01081c0:	89 02                	mov    %eax,(%edx)
+			rdesc->buffer_addr = page2pa(fresh) + RX_PKT_OFFSET;
+f01081c2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f01081c5:	89 ca                	mov    %ecx,%edx
+f01081c7:	c1 e2 04             	shl    $0x4,%edx
+	return (pp - pool.pages) << PGSHIFT;
+f01081ca:	89 f8                	mov    %edi,%eax
+f01081cc:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f01081d2:	c1 f8 02             	sar    $0x2,%eax
+f01081d5:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01081db:	c1 e0 0c             	shl    $0xc,%eax
+f01081de:	83 c0 08             	add    $0x8,%eax
+f01081e1:	89 82 40 de 83 f0    	mov    %eax,-0xf7c21c0(%edx)
+f01081e7:	c7 82 44 de 83 f0 00 	movl   $0x0,-0xf7c21bc(%edx)
+f01081ee:	00 00 00 
+			rdesc->status = 0;
+f01081f1:	c6 82 4c de 83 f0 00 	movb   $0x0,-0xf7c21b4(%edx)
+			rdt = first;
+f01081f8:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+f01081fb:	eb 61                	jmp    f010825e <e1000_rx_pages+0x15d>
+		panic("pa2page called with invalid pa");
+f01081fd:	83 ec 04             	sub    $0x4,%esp
+f0108200:	68 94 b0 10 f0       	push   $0xf010b094
+f0108205:	6a 58                	push   $0x58
+f0108207:	68 31 ba 10 f0       	push   $0xf010ba31
+f010820c:	e8 38 7e ff ff       	call   f0100049 <_panic>
+				return -E_NO_MEM;
+f0108211:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+f0108218:	e9 73 ff ff ff       	jmp    f0108190 <e1000_rx_pages+0x8f>
+f010821d:	89 c7                	mov    %eax,%edi
+		csum = net_rx_csum(&rx_queue[(first + ndesc - 1) % RX_QUEUE_SIZE]);
+f010821f:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0108222:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0108225:	8d 44 06 ff          	lea    -0x1(%esi,%eax,1),%eax
+f0108229:	83 e0 7f             	and    $0x7f,%eax
+f010822c:	c1 e0 04             	shl    $0x4,%eax
+f010822f:	05 40 de 83 f0       	add    $0xf083de40,%eax
+f0108234:	e8 1b f6 ff ff       	call   f0107854 <net_rx_csum>
+f0108239:	89 45 c0             	mov    %eax,-0x40(%ebp)
+		if (ndesc == 1) {
+f010823c:	83 fe 01             	cmp    $0x1,%esi
+f010823f:	0f 84 56 ff ff ff    	je     f010819b <e1000_rx_pages+0x9a>
+			rdt = net_rx_copy(first, length, pps + n, NULL);
+f0108245:	83 ec 0c             	sub    $0xc,%esp
+f0108248:	6a 00                	push   $0x0
+f010824a:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f010824d:	8b 55 c8             	mov    -0x38(%ebp),%edx
+f0108250:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0108253:	e8 14 fd ff ff       	call   f0107f6c <net_rx_copy>
+f0108258:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f010825b:	83 c4 10             	add    $0x10,%esp
+		net_rx_pkt_init(pps + n, length, csum);
+f010825e:	83 ec 04             	sub    $0x4,%esp
+f0108261:	ff 75 c0             	push   -0x40(%ebp)
+f0108264:	ff 75 c8             	push   -0x38(%ebp)
+f0108267:	ff 75 c4             	push   -0x3c(%ebp)
+f010826a:	e8 6c 1d 00 00       	call   f0109fdb <net_rx_pkt_init>
+		npkts++;
+f010826f:	83 45 bc 01          	addl   $0x1,-0x44(%ebp)
+f0108273:	83 c4 10             	add    $0x10,%esp
+	for (n = 0; n < max; n += npages) {
+f0108276:	01 5d d4             	add    %ebx,-0x2c(%ebp)
+f0108279:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010827c:	3b 45 0c             	cmp    0xc(%ebp),%eax
+f010827f:	0f 8d e2 fe ff ff    	jge    f0108167 <e1000_rx_pages+0x66>
+		first = (rdt + 1) % RX_QUEUE_SIZE;
+f0108285:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0108288:	83 c0 01             	add    $0x1,%eax
+f010828b:	83 e0 7f             	and    $0x7f,%eax
+f010828e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		if (!net_rx_frame(first, &ndesc, &length))
+f0108291:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+f0108294:	8d 55 e0             	lea    -0x20(%ebp),%edx
+f0108297:	e8 67 f5 ff ff       	call   f0107803 <net_rx_frame>
+f010829c:	84 c0                	test   %al,%al
+f010829e:	0f 84 c3 fe ff ff    	je     f0108167 <e1000_rx_pages+0x66>
+		npages = RX_PKT_PAGES(length);
+f01082a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01082a7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f01082aa:	8d 98 07 10 00 00    	lea    0x1007(%eax),%ebx
+f01082b0:	c1 eb 0c             	shr    $0xc,%ebx
+		if (npages > max) {
+f01082b3:	39 5d 0c             	cmp    %ebx,0xc(%ebp)
+f01082b6:	0f 8c 72 fe ff ff    	jl     f010812e <e1000_rx_pages+0x2d>
+		if (n + npages > max)
+f01082bc:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f01082bf:	8d 04 19             	lea    (%ecx,%ebx,1),%eax
+f01082c2:	3b 45 0c             	cmp    0xc(%ebp),%eax
+f01082c5:	0f 8f 9c fe ff ff    	jg     f0108167 <e1000_rx_pages+0x66>
+f01082cb:	8b 45 08             	mov    0x8(%ebp),%eax
+f01082ce:	8d 14 88             	lea    (%eax,%ecx,4),%edx
+f01082d1:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+		for (i = 0; i < npages; i++) {
+f01082d4:	be 00 00 00 00       	mov    $0x0,%esi
+f01082d9:	89 f8                	mov    %edi,%eax
+f01082db:	89 d7                	mov    %edx,%edi
+f01082dd:	39 de                	cmp    %ebx,%esi
+f01082df:	0f 8d 38 ff ff ff    	jge    f010821d <e1000_rx_pages+0x11c>
+			if (!(fresh = page_alloc(0)))
+f01082e5:	83 ec 0c             	sub    $0xc,%esp
+f01082e8:	6a 00                	push   $0x0
+f01082ea:	e8 83 95 ff ff       	call   f0101872 <page_alloc>
+f01082ef:	83 c4 10             	add    $0x10,%esp
+f01082f2:	85 c0                	test   %eax,%eax
+f01082f4:	74 0d                	je     f0108303 <e1000_rx_pages+0x202>
+			fresh->pp_ref++;
+f01082f6:	66 83 40 08 01       	addw   $0x1,0x8(%eax)
+			pps[n + i] = fresh;
+f01082fb:	89 04 b7             	mov    %eax,(%edi,%esi,4)
+		for (i = 0; i < npages; i++) {
+f01082fe:	83 c6 01             	add    $0x1,%esi
+f0108301:	eb da                	jmp    f01082dd <e1000_rx_pages+0x1dc>
+		if (i < npages) {
+f0108303:	89 f3                	mov    %esi,%ebx
+f0108305:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+			while (i-- > 0)
+f0108308:	85 db                	test   %ebx,%ebx
+f010830a:	0f 8e 45 fe ff ff    	jle    f0108155 <e1000_rx_pages+0x54>
+				page_decref(pps[n + i]);
+f0108310:	83 ec 0c             	sub    $0xc,%esp
+f0108313:	ff 74 9e fc          	push   -0x4(%esi,%ebx,4)
+f0108317:	e8 ff 95 ff ff       	call   f010191b <page_decref>
+f010831c:	83 eb 01             	sub    $0x1,%ebx
+f010831f:	83 c4 10             	add    $0x10,%esp
+f0108322:	eb e4                	jmp    f0108308 <e1000_rx_pages+0x207>
+
+f0108324 <e1000_rx>:
+{
+f0108324:	55                   	push   %ebp
+f0108325:	89 e5                	mov    %esp,%ebp
+f0108327:	56                   	push   %esi
+f0108328:	53                   	push   %ebx
+f0108329:	83 ec 10             	sub    $0x10,%esp
+	return e1000[index >> 2];
+f010832c:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f0108331:	8b 98 18 28 00 00    	mov    0x2818(%eax),%ebx
+	uint32_t first = (e1000r(E1000_RDT) + 1) % RX_QUEUE_SIZE;
+f0108337:	83 c3 01             	add    $0x1,%ebx
+f010833a:	83 e3 7f             	and    $0x7f,%ebx
+	if (!net_rx_frame(first, &ndesc, &length))
+f010833d:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+f0108340:	8d 55 f0             	lea    -0x10(%ebp),%edx
+f0108343:	89 d8                	mov    %ebx,%eax
+f0108345:	e8 b9 f4 ff ff       	call   f0107803 <net_rx_frame>
+		return 0;
+f010834a:	be 00 00 00 00       	mov    $0x0,%esi
+	if (!net_rx_frame(first, &ndesc, &length))
+f010834f:	84 c0                	test   %al,%al
+f0108351:	75 09                	jne    f010835c <e1000_rx+0x38>
+}
+f0108353:	89 f0                	mov    %esi,%eax
+f0108355:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0108358:	5b                   	pop    %ebx
+f0108359:	5e                   	pop    %esi
+f010835a:	5d                   	pop    %ebp
+f010835b:	c3                   	ret
+	length = MIN(length, RX_BUFFER_SIZE);
+f010835c:	8b 75 f4             	mov    -0xc(%ebp),%esi
+f010835f:	b8 00 08 00 00       	mov    $0x800,%eax
+f0108364:	39 c6                	cmp    %eax,%esi
+f0108366:	0f 47 f0             	cmova  %eax,%esi
+	e1000w(E1000_RDT, net_rx_copy(first, length, NULL, buffer));
+f0108369:	83 ec 0c             	sub    $0xc,%esp
+f010836c:	ff 75 08             	push   0x8(%ebp)
+f010836f:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108374:	89 f2                	mov    %esi,%edx
+f0108376:	89 d8                	mov    %ebx,%eax
+f0108378:	e8 ef fb ff ff       	call   f0107f6c <net_rx_copy>
+	e1000[index >> 2] = value;
+f010837d:	8b 15 44 fa 83 f0    	mov    0xf083fa44,%edx
+f0108383:	89 82 18 28 00 00    	mov    %eax,0x2818(%edx)
+	return length;
+f0108389:	83 c4 10             	add    $0x10,%esp
+f010838c:	eb c5                	jmp    f0108353 <e1000_rx+0x2f>
+
+f010838e <e1000_ready>:
+{
+f010838e:	55                   	push   %ebp
+f010838f:	89 e5                	mov    %esp,%ebp
+f0108391:	56                   	push   %esi
+f0108392:	53                   	push   %ebx
+f0108393:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (events & NET_WAIT_RX) {
+f0108396:	89 de                	mov    %ebx,%esi
+f0108398:	83 e6 01             	and    $0x1,%esi
+f010839b:	75 0b                	jne    f01083a8 <e1000_ready+0x1a>
+	if (events & NET_WAIT_TX) {
+f010839d:	f6 c3 02             	test   $0x2,%bl
+f01083a0:	75 35                	jne    f01083d7 <e1000_ready+0x49>
+}
+f01083a2:	89 f0                	mov    %esi,%eax
+f01083a4:	5b                   	pop    %ebx
+f01083a5:	5e                   	pop    %esi
+f01083a6:	5d                   	pop    %ebp
+f01083a7:	c3                   	ret
+		if (!net_rx_ready() && !(intr_armed & E1000_ICR_RXT0)) {
+f01083a8:	e8 84 f5 ff ff       	call   f0107931 <net_rx_ready>
+f01083ad:	84 c0                	test   %al,%al
+f01083af:	75 09                	jne    f01083ba <e1000_ready+0x2c>
+f01083b1:	f6 05 40 fa 83 f0 80 	testb  $0x80,0xf083fa40
+f01083b8:	74 0a                	je     f01083c4 <e1000_ready+0x36>
+		if (net_rx_ready())
+f01083ba:	e8 72 f5 ff ff       	call   f0107931 <net_rx_ready>
+f01083bf:	0f b6 f0             	movzbl %al,%esi
+f01083c2:	eb d9                	jmp    f010839d <e1000_ready+0xf>
+			net_intr_arm(E1000_ICR_RX);
+f01083c4:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f01083c9:	e8 15 f5 ff ff       	call   f01078e3 <net_intr_arm>
+			e1000_stats.rx_rearms++;
+f01083ce:	83 05 f4 d3 83 f0 01 	addl   $0x1,0xf083d3f4
+f01083d5:	eb e3                	jmp    f01083ba <e1000_ready+0x2c>
+	net_tx_reclaim();
+f01083d7:	e8 51 f6 ff ff       	call   f0107a2d <net_tx_reclaim>
+	return net_tx_free() >= TX_BUFFERS(NET_FRAME_MAX);
+f01083dc:	e8 0b f4 ff ff       	call   f01077ec <net_tx_free>
+		if (!net_tx_ready() && !(intr_armed & E1000_ICR_TXDW)) {
+f01083e1:	83 f8 05             	cmp    $0x5,%eax
+f01083e4:	77 09                	ja     f01083ef <e1000_ready+0x61>
+f01083e6:	f6 05 40 fa 83 f0 01 	testb  $0x1,0xf083fa40
+f01083ed:	74 19                	je     f0108408 <e1000_ready+0x7a>
+	net_tx_reclaim();
+f01083ef:	e8 39 f6 ff ff       	call   f0107a2d <net_tx_reclaim>
+	return net_tx_free() >= TX_BUFFERS(NET_FRAME_MAX);
+f01083f4:	e8 f3 f3 ff ff       	call   f01077ec <net_tx_free>
+f01083f9:	89 c2                	mov    %eax,%edx
+			ready |= NET_WAIT_TX;
+f01083fb:	89 f0                	mov    %esi,%eax
+f01083fd:	83 c8 02             	or     $0x2,%eax
+f0108400:	83 fa 05             	cmp    $0x5,%edx
+f0108403:	0f 47 f0             	cmova  %eax,%esi
+f0108406:	eb 9a                	jmp    f01083a2 <e1000_ready+0x14>
+			net_intr_arm(E1000_ICR_TXDW);
+f0108408:	b8 01 00 00 00       	mov    $0x1,%eax
+f010840d:	e8 d1 f4 ff ff       	call   f01078e3 <net_intr_arm>
+			e1000_stats.tx_rearms++;
+f0108412:	83 05 f8 d3 83 f0 01 	addl   $0x1,0xf083d3f8
+f0108419:	eb d4                	jmp    f01083ef <e1000_ready+0x61>
+
+f010841b <net_map>:
+	if (!e1000)
+f010841b:	83 3d 44 fa 83 f0 00 	cmpl   $0x0,0xf083fa44
+f0108422:	0f 84 2b 01 00 00    	je     f0108553 <net_map+0x138>
+	if (nm_env)
+f0108428:	83 3d 04 d6 83 f0 00 	cmpl   $0x0,0xf083d604
+f010842f:	0f 85 24 01 00 00    	jne    f0108559 <net_map+0x13e>
+{
+f0108435:	55                   	push   %ebp
+f0108436:	89 e5                	mov    %esp,%ebp
+f0108438:	57                   	push   %edi
+f0108439:	56                   	push   %esi
+f010843a:	53                   	push   %ebx
+f010843b:	83 ec 0c             	sub    $0xc,%esp
+	for (i = 0; i < NETMAP_NPAGES; i++) {
+f010843e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!(nm_pages[i] = page_alloc(ALLOC_ZERO))) {
+f0108443:	83 ec 0c             	sub    $0xc,%esp
+f0108446:	6a 01                	push   $0x1
+f0108448:	e8 25 94 ff ff       	call   f0101872 <page_alloc>
+f010844d:	89 04 9d 20 d6 83 f0 	mov    %eax,-0xf7c29e0(,%ebx,4)
+f0108454:	83 c4 10             	add    $0x10,%esp
+f0108457:	85 c0                	test   %eax,%eax
+f0108459:	0f 84 d0 00 00 00    	je     f010852f <net_map+0x114>
+		nm_pages[i]->pp_ref++;
+f010845f:	66 83 40 08 01       	addw   $0x1,0x8(%eax)
+	for (i = 0; i < NETMAP_NPAGES; i++) {
+f0108464:	83 c3 01             	add    $0x1,%ebx
+f0108467:	81 fb 01 01 00 00    	cmp    $0x101,%ebx
+f010846d:	75 d4                	jne    f0108443 <net_map+0x28>
+	net_rings_stop();
+f010846f:	e8 0a f5 ff ff       	call   f010797e <net_rings_stop>
+	nm_env = e;
+f0108474:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108477:	a3 04 d6 83 f0       	mov    %eax,0xf083d604
+	return (pp - pool.pages) << PGSHIFT;
+f010847c:	a1 20 d6 83 f0       	mov    0xf083d620,%eax
+f0108481:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f0108487:	c1 f8 02             	sar    $0x2,%eax
+f010848a:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0108490:	89 c7                	mov    %eax,%edi
+f0108492:	c1 e7 0c             	shl    $0xc,%edi
+	if (PGNUM(pa) >= npages)
+f0108495:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010849a:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f01084a0:	0f 83 9b 00 00 00    	jae    f0108541 <net_map+0x126>
+	return (void *)(pa + KERNBASE);
+f01084a6:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+	nm_rings = page2kva(nm_pages[0]);
+f01084ac:	89 3d 08 d6 83 f0    	mov    %edi,0xf083d608
+	nm_rings->nm_tx.nr_tail = NETMAP_TX_SLOTS - 1;
+f01084b2:	c7 47 04 ff 00 00 00 	movl   $0xff,0x4(%edi)
+	for (i = 0; i < NETMAP_TX_SLOTS; i++)
+f01084b9:	b8 00 00 00 00       	mov    $0x0,%eax
+		nm_rings->nm_txslot[i].ns_buf = i;
+f01084be:	66 89 44 c7 10       	mov    %ax,0x10(%edi,%eax,8)
+	for (i = 0; i < NETMAP_TX_SLOTS; i++)
+f01084c3:	83 c0 01             	add    $0x1,%eax
+f01084c6:	3d 00 01 00 00       	cmp    $0x100,%eax
+f01084cb:	75 f1                	jne    f01084be <net_map+0xa3>
+f01084cd:	be 40 de 83 f0       	mov    $0xf083de40,%esi
+f01084d2:	bb 00 01 00 00       	mov    $0x100,%ebx
+		slot->ns_buf = NETMAP_TX_SLOTS + i;
+f01084d7:	66 89 5c df 10       	mov    %bx,0x10(%edi,%ebx,8)
+		nm_rx_saved[i] = rx_queue[i].buffer_addr;
+f01084dc:	8b 06                	mov    (%esi),%eax
+f01084de:	89 04 9d 00 d0 83 f0 	mov    %eax,-0xf7c3000(,%ebx,4)
+		rx_queue[i].buffer_addr = netmap_buf(slot->ns_buf);
+f01084e5:	89 d8                	mov    %ebx,%eax
+f01084e7:	e8 ca f3 ff ff       	call   f01078b6 <netmap_buf>
+f01084ec:	89 06                	mov    %eax,(%esi)
+f01084ee:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+		rx_queue[i].status = 0;
+f01084f5:	c6 46 0c 00          	movb   $0x0,0xc(%esi)
+	for (i = 0; i < NETMAP_RX_SLOTS; i++) {
+f01084f9:	83 c6 10             	add    $0x10,%esi
+f01084fc:	83 c3 01             	add    $0x1,%ebx
+f01084ff:	81 fb 80 01 00 00    	cmp    $0x180,%ebx
+f0108505:	75 d0                	jne    f01084d7 <net_map+0xbc>
+	nm_rx_tail = 0;
+f0108507:	c7 05 00 d6 83 f0 00 	movl   $0x0,0xf083d600
+f010850e:	00 00 00 
+	net_rings_start();
+f0108511:	e8 78 f3 ff ff       	call   f010788e <net_rings_start>
+	return 0;
+f0108516:	b8 00 00 00 00       	mov    $0x0,%eax
+f010851b:	eb 1c                	jmp    f0108539 <net_map+0x11e>
+				page_decref(nm_pages[i]);
+f010851d:	83 ec 0c             	sub    $0xc,%esp
+f0108520:	ff 34 9d 20 d6 83 f0 	push   -0xf7c29e0(,%ebx,4)
+f0108527:	e8 ef 93 ff ff       	call   f010191b <page_decref>
+f010852c:	83 c4 10             	add    $0x10,%esp
+			while (--i >= 0)
+f010852f:	83 eb 01             	sub    $0x1,%ebx
+f0108532:	79 e9                	jns    f010851d <net_map+0x102>
+			return -E_NO_MEM;
+f0108534:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+}
+f0108539:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010853c:	5b                   	pop    %ebx
+f010853d:	5e                   	pop    %esi
+f010853e:	5f                   	pop    %edi
+f010853f:	5d                   	pop    %ebp
+f0108540:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0108541:	57                   	push   %edi
+f0108542:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0108547:	6a 5f                	push   $0x5f
+f0108549:	68 31 ba 10 f0       	push   $0xf010ba31
+f010854e:	e8 f6 7a ff ff       	call   f0100049 <_panic>
+		return -E_NOT_SUPP;
+f0108553:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+f0108558:	c3                   	ret
+		return -E_INVAL;
+f0108559:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+f010855e:	c3                   	ret
+
+f010855f <net_map_page>:
+{
+f010855f:	55                   	push   %ebp
+f0108560:	89 e5                	mov    %esp,%ebp
+	return nm_pages[i];
+f0108562:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108565:	8b 04 85 20 d6 83 f0 	mov    -0xf7c29e0(,%eax,4),%eax
+}
+f010856c:	5d                   	pop    %ebp
+f010856d:	c3                   	ret
+
+f010856e <net_map_env>:
+}
+f010856e:	a1 04 d6 83 f0       	mov    0xf083d604,%eax
+f0108573:	c3                   	ret
+
+f0108574 <net_unmap>:
+{
+f0108574:	55                   	push   %ebp
+f0108575:	89 e5                	mov    %esp,%ebp
+f0108577:	53                   	push   %ebx
+f0108578:	83 ec 04             	sub    $0x4,%esp
+	if (!nm_env || nm_env != e)
+f010857b:	a1 04 d6 83 f0       	mov    0xf083d604,%eax
+f0108580:	3b 45 08             	cmp    0x8(%ebp),%eax
+f0108583:	75 04                	jne    f0108589 <net_unmap+0x15>
+f0108585:	85 c0                	test   %eax,%eax
+f0108587:	75 05                	jne    f010858e <net_unmap+0x1a>
+}
+f0108589:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010858c:	c9                   	leave
+f010858d:	c3                   	ret
+	net_rings_stop();
+f010858e:	e8 eb f3 ff ff       	call   f010797e <net_rings_stop>
+	for (int i = 0; i < RX_QUEUE_SIZE; i++) {
+f0108593:	ba 40 de 83 f0       	mov    $0xf083de40,%edx
+f0108598:	b8 00 00 00 00       	mov    $0x0,%eax
+		rx_queue[i].buffer_addr = nm_rx_saved[i];
+f010859d:	8b 0c 85 00 d4 83 f0 	mov    -0xf7c2c00(,%eax,4),%ecx
+f01085a4:	89 0a                	mov    %ecx,(%edx)
+f01085a6:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+		rx_queue[i].status = 0;
+f01085ad:	c6 42 0c 00          	movb   $0x0,0xc(%edx)
+	for (int i = 0; i < RX_QUEUE_SIZE; i++) {
+f01085b1:	83 c0 01             	add    $0x1,%eax
+f01085b4:	83 c2 10             	add    $0x10,%edx
+f01085b7:	3d 80 00 00 00       	cmp    $0x80,%eax
+f01085bc:	75 df                	jne    f010859d <net_unmap+0x29>
+	for (int i = 0; i < NETMAP_NPAGES; i++)
+f01085be:	bb 00 00 00 00       	mov    $0x0,%ebx
+		page_decref(nm_pages[i]);
+f01085c3:	83 ec 0c             	sub    $0xc,%esp
+f01085c6:	ff 34 9d 20 d6 83 f0 	push   -0xf7c29e0(,%ebx,4)
+f01085cd:	e8 49 93 ff ff       	call   f010191b <page_decref>
+	for (int i = 0; i < NETMAP_NPAGES; i++)
+f01085d2:	83 c3 01             	add    $0x1,%ebx
+f01085d5:	83 c4 10             	add    $0x10,%esp
+f01085d8:	81 fb 01 01 00 00    	cmp    $0x101,%ebx
+f01085de:	75 e3                	jne    f01085c3 <net_unmap+0x4f>
+	nm_env = NULL;
+f01085e0:	c7 05 04 d6 83 f0 00 	movl   $0x0,0xf083d604
+f01085e7:	00 00 00 
+	nm_rings = NULL;
+f01085ea:	c7 05 08 d6 83 f0 00 	movl   $0x0,0xf083d608
+f01085f1:	00 00 00 
+	net_rings_start();
+f01085f4:	e8 95 f2 ff ff       	call   f010788e <net_rings_start>
+	net_intr_arm(E1000_ICR_RX | E1000_ICR_TXDW);
+f01085f9:	b8 d1 00 00 00       	mov    $0xd1,%eax
+f01085fe:	e8 e0 f2 ff ff       	call   f01078e3 <net_intr_arm>
+	net_wake(NET_WAIT_RX | NET_WAIT_TX);
+f0108603:	83 ec 0c             	sub    $0xc,%esp
+f0108606:	6a 03                	push   $0x3
+f0108608:	e8 76 cd ff ff       	call   f0105383 <net_wake>
+f010860d:	83 c4 10             	add    $0x10,%esp
+f0108610:	e9 74 ff ff ff       	jmp    f0108589 <net_unmap+0x15>
+
+f0108615 <net_sync>:
+{
+f0108615:	55                   	push   %ebp
+f0108616:	89 e5                	mov    %esp,%ebp
+f0108618:	57                   	push   %edi
+f0108619:	56                   	push   %esi
+f010861a:	53                   	push   %ebx
+f010861b:	83 ec 1c             	sub    $0x1c,%esp
+	if (rings & NET_WAIT_TX)
+f010861e:	f6 45 08 02          	testb  $0x2,0x8(%ebp)
+f0108622:	0f 85 a5 00 00 00    	jne    f01086cd <net_sync+0xb8>
+	int r = 0, r2 = 0;
+f0108628:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+	if (rings & NET_WAIT_RX)
+f010862f:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+f0108633:	0f 84 3f 02 00 00    	je     f0108878 <net_sync+0x263>
+	struct netmap_ring *ring = &nm_rings->nm_rx;
+f0108639:	8b 35 08 d6 83 f0    	mov    0xf083d608,%esi
+	return e1000[index >> 2];
+f010863f:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f0108644:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0108647:	8b 80 18 28 00 00    	mov    0x2818(%eax),%eax
+f010864d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t rdt = e1000r(E1000_RDT), head = ring->nr_head, i;
+f0108650:	8b 7e 08             	mov    0x8(%esi),%edi
+	i = (rdt + 1) % RX_QUEUE_SIZE;
+f0108653:	8d 58 01             	lea    0x1(%eax),%ebx
+f0108656:	83 e3 7f             	and    $0x7f,%ebx
+	if (head >= RX_QUEUE_SIZE
+f0108659:	83 ff 7f             	cmp    $0x7f,%edi
+f010865c:	0f 87 28 02 00 00    	ja     f010888a <net_sync+0x275>
+	       > ring_dist(i, nm_rx_tail, RX_QUEUE_SIZE))
+f0108662:	a1 00 d6 83 f0       	mov    0xf083d600,%eax
+f0108667:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	return (to + n - from) % n;
+f010866a:	89 c1                	mov    %eax,%ecx
+f010866c:	29 d9                	sub    %ebx,%ecx
+f010866e:	83 e1 7f             	and    $0x7f,%ecx
+f0108671:	89 fa                	mov    %edi,%edx
+f0108673:	29 da                	sub    %ebx,%edx
+f0108675:	83 e2 7f             	and    $0x7f,%edx
+	    || ring_dist(i, head, RX_QUEUE_SIZE)
+f0108678:	39 d1                	cmp    %edx,%ecx
+f010867a:	0f 82 03 02 00 00    	jb     f0108883 <net_sync+0x26e>
+	for (; i != head; i = (i + 1) % RX_QUEUE_SIZE) {
+f0108680:	39 fb                	cmp    %edi,%ebx
+f0108682:	0f 84 65 01 00 00    	je     f01087ed <net_sync+0x1d8>
+		if ((buf = nm_rings->nm_rxslot[i].ns_buf) >= NETMAP_NBUFS) {
+f0108688:	0f b7 84 de 10 08 00 	movzwl 0x810(%esi,%ebx,8),%eax
+f010868f:	00 
+f0108690:	66 3d ff 01          	cmp    $0x1ff,%ax
+f0108694:	0f 87 6c 01 00 00    	ja     f0108806 <net_sync+0x1f1>
+		rx_queue[i].buffer_addr = netmap_buf(buf);
+f010869a:	0f b7 c0             	movzwl %ax,%eax
+f010869d:	e8 14 f2 ff ff       	call   f01078b6 <netmap_buf>
+f01086a2:	89 c2                	mov    %eax,%edx
+f01086a4:	89 d8                	mov    %ebx,%eax
+f01086a6:	c1 e0 04             	shl    $0x4,%eax
+f01086a9:	89 90 40 de 83 f0    	mov    %edx,-0xf7c21c0(%eax)
+f01086af:	c7 80 44 de 83 f0 00 	movl   $0x0,-0xf7c21bc(%eax)
+f01086b6:	00 00 00 
+		rx_queue[i].status = 0;
+f01086b9:	c6 80 4c de 83 f0 00 	movb   $0x0,-0xf7c21b4(%eax)
+	for (; i != head; i = (i + 1) % RX_QUEUE_SIZE) {
+f01086c0:	8d 43 01             	lea    0x1(%ebx),%eax
+		rdt = i;
+f01086c3:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+	for (; i != head; i = (i + 1) % RX_QUEUE_SIZE) {
+f01086c6:	83 e0 7f             	and    $0x7f,%eax
+f01086c9:	89 c3                	mov    %eax,%ebx
+f01086cb:	eb b3                	jmp    f0108680 <net_sync+0x6b>
+	struct netmap_ring *ring = &nm_rings->nm_tx;
+f01086cd:	8b 35 08 d6 83 f0    	mov    0xf083d608,%esi
+	return e1000[index >> 2];
+f01086d3:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f01086d8:	8b 98 18 38 00 00    	mov    0x3818(%eax),%ebx
+	uint32_t tdt = e1000r(E1000_TDT), head = ring->nr_head, tail;
+f01086de:	8b 3e                	mov    (%esi),%edi
+f01086e0:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+	net_tx_reclaim();
+f01086e3:	e8 45 f3 ff ff       	call   f0107a2d <net_tx_reclaim>
+	tail = (tx_clean + TX_QUEUE_SIZE - 1) % TX_QUEUE_SIZE;
+f01086e8:	a1 38 da 83 f0       	mov    0xf083da38,%eax
+f01086ed:	05 ff 00 00 00       	add    $0xff,%eax
+f01086f2:	0f b6 c0             	movzbl %al,%eax
+	if (head >= TX_QUEUE_SIZE
+f01086f5:	81 ff ff 00 00 00    	cmp    $0xff,%edi
+f01086fb:	0f 87 9b 01 00 00    	ja     f010889c <net_sync+0x287>
+	return (to + n - from) % n;
+f0108701:	89 fa                	mov    %edi,%edx
+f0108703:	29 da                	sub    %ebx,%edx
+f0108705:	0f b6 d2             	movzbl %dl,%edx
+	    || ring_dist(tdt, head, TX_QUEUE_SIZE)
+f0108708:	89 c1                	mov    %eax,%ecx
+f010870a:	29 d9                	sub    %ebx,%ecx
+f010870c:	0f b6 c9             	movzbl %cl,%ecx
+f010870f:	39 d1                	cmp    %edx,%ecx
+f0108711:	0f 82 85 01 00 00    	jb     f010889c <net_sync+0x287>
+		slot = nm_rings->nm_txslot[tdt];
+f0108717:	8b 3d 08 d6 83 f0    	mov    0xf083d608,%edi
+f010871d:	89 75 e0             	mov    %esi,-0x20(%ebp)
+f0108720:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0108723:	eb 3f                	jmp    f0108764 <net_sync+0x14f>
+		tdesc->buffer_addr = netmap_buf(slot.ns_buf);
+f0108725:	0f b7 c0             	movzwl %ax,%eax
+f0108728:	e8 89 f1 ff ff       	call   f01078b6 <netmap_buf>
+f010872d:	89 da                	mov    %ebx,%edx
+f010872f:	c1 e2 04             	shl    $0x4,%edx
+f0108732:	89 82 40 ea 83 f0    	mov    %eax,-0xf7c15c0(%edx)
+f0108738:	c7 82 44 ea 83 f0 00 	movl   $0x0,-0xf7c15bc(%edx)
+f010873f:	00 00 00 
+		tdesc->length = slot.ns_len;
+f0108742:	66 89 b2 48 ea 83 f0 	mov    %si,-0xf7c15b8(%edx)
+		tdesc->cmd = E1000_TXD_CMD_RS | E1000_TXD_CMD_EOP;
+f0108749:	c6 82 4b ea 83 f0 09 	movb   $0x9,-0xf7c15b5(%edx)
+		tdesc->status = 0;
+f0108750:	c6 82 4c ea 83 f0 00 	movb   $0x0,-0xf7c15b4(%edx)
+		tx_seq++;
+f0108757:	83 05 34 da 83 f0 01 	addl   $0x1,0xf083da34
+	for (; tdt != head; tdt = (tdt + 1) % TX_QUEUE_SIZE) {
+f010875e:	83 c3 01             	add    $0x1,%ebx
+f0108761:	0f b6 db             	movzbl %bl,%ebx
+f0108764:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+f0108767:	74 75                	je     f01087de <net_sync+0x1c9>
+		slot = nm_rings->nm_txslot[tdt];
+f0108769:	8d 53 02             	lea    0x2(%ebx),%edx
+f010876c:	0f b7 04 d7          	movzwl (%edi,%edx,8),%eax
+f0108770:	0f b7 74 d7 02       	movzwl 0x2(%edi,%edx,8),%esi
+		if (slot.ns_buf >= NETMAP_NBUFS || slot.ns_len == 0
+f0108775:	8d 56 ff             	lea    -0x1(%esi),%edx
+		    || slot.ns_len > MIN(NETMAP_BUFSIZE, TX_BUFFER_SIZE)) {
+f0108778:	66 81 fa ed 05       	cmp    $0x5ed,%dx
+f010877d:	77 06                	ja     f0108785 <net_sync+0x170>
+f010877f:	66 3d ff 01          	cmp    $0x1ff,%ax
+f0108783:	76 a0                	jbe    f0108725 <net_sync+0x110>
+			r = -E_INVAL;
+f0108785:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0108788:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f010878b:	c7 45 e0 fd ff ff ff 	movl   $0xfffffffd,-0x20(%ebp)
+	e1000[index >> 2] = value;
+f0108792:	8b 15 44 fa 83 f0    	mov    0xf083fa44,%edx
+f0108798:	89 9a 18 38 00 00    	mov    %ebx,0x3818(%edx)
+	ring->nr_tail = tail;
+f010879e:	89 46 04             	mov    %eax,0x4(%esi)
+	int r = 0, r2 = 0;
+f01087a1:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (rings & NET_WAIT_RX)
+f01087a6:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+f01087aa:	0f 84 bd 00 00 00    	je     f010886d <net_sync+0x258>
+	struct netmap_ring *ring = &nm_rings->nm_rx;
+f01087b0:	8b 35 08 d6 83 f0    	mov    0xf083d608,%esi
+	return e1000[index >> 2];
+f01087b6:	89 55 d8             	mov    %edx,-0x28(%ebp)
+f01087b9:	8b 82 18 28 00 00    	mov    0x2818(%edx),%eax
+f01087bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t rdt = e1000r(E1000_RDT), head = ring->nr_head, i;
+f01087c2:	8b 7e 08             	mov    0x8(%esi),%edi
+	i = (rdt + 1) % RX_QUEUE_SIZE;
+f01087c5:	8d 58 01             	lea    0x1(%eax),%ebx
+f01087c8:	83 e3 7f             	and    $0x7f,%ebx
+	if (head >= RX_QUEUE_SIZE
+f01087cb:	83 ff 7f             	cmp    $0x7f,%edi
+f01087ce:	0f 86 8e fe ff ff    	jbe    f0108662 <net_sync+0x4d>
+		return -E_INVAL;
+f01087d4:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f01087d9:	e9 8f 00 00 00       	jmp    f010886d <net_sync+0x258>
+	int r = 0;
+f01087de:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f01087e1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01087e4:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f01087eb:	eb a5                	jmp    f0108792 <net_sync+0x17d>
+	int r = 0;
+f01087ed:	bf 00 00 00 00       	mov    $0x0,%edi
+	e1000[index >> 2] = value;
+f01087f2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f01087f5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01087f8:	89 88 18 28 00 00    	mov    %ecx,0x2818(%eax)
+	for (i = nm_rx_tail; i != rdt; i = (i + 1) % RX_QUEUE_SIZE) {
+f01087fe:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0108801:	89 7d d8             	mov    %edi,-0x28(%ebp)
+f0108804:	eb 36                	jmp    f010883c <net_sync+0x227>
+			r = -E_INVAL;
+f0108806:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f010880b:	eb e5                	jmp    f01087f2 <net_sync+0x1dd>
+		slot->ns_len = rdesc->length;
+f010880d:	8d bb 02 01 00 00    	lea    0x102(%ebx),%edi
+f0108813:	89 d8                	mov    %ebx,%eax
+f0108815:	c1 e0 04             	shl    $0x4,%eax
+f0108818:	0f b7 80 48 de 83 f0 	movzwl -0xf7c21b8(%eax),%eax
+f010881f:	66 89 44 fe 02       	mov    %ax,0x2(%esi,%edi,8)
+		slot->ns_flags = net_rx_csum(rdesc);
+f0108824:	89 d0                	mov    %edx,%eax
+f0108826:	e8 29 f0 ff ff       	call   f0107854 <net_rx_csum>
+f010882b:	89 44 fe 04          	mov    %eax,0x4(%esi,%edi,8)
+		e1000_stats.rx_packets++;
+f010882f:	83 05 f0 d3 83 f0 01 	addl   $0x1,0xf083d3f0
+	for (i = nm_rx_tail; i != rdt; i = (i + 1) % RX_QUEUE_SIZE) {
+f0108836:	83 c3 01             	add    $0x1,%ebx
+f0108839:	83 e3 7f             	and    $0x7f,%ebx
+f010883c:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+f010883f:	74 14                	je     f0108855 <net_sync+0x240>
+		rdesc = &rx_queue[i];
+f0108841:	89 d8                	mov    %ebx,%eax
+f0108843:	c1 e0 04             	shl    $0x4,%eax
+f0108846:	8d 90 40 de 83 f0    	lea    -0xf7c21c0(%eax),%edx
+		if (!(rdesc->status & E1000_RXD_STAT_DD))
+f010884c:	f6 80 4c de 83 f0 01 	testb  $0x1,-0xf7c21b4(%eax)
+f0108853:	75 b8                	jne    f010880d <net_sync+0x1f8>
+	if (i != nm_rx_tail)
+f0108855:	8b 7d d8             	mov    -0x28(%ebp),%edi
+f0108858:	39 5d dc             	cmp    %ebx,-0x24(%ebp)
+f010885b:	74 07                	je     f0108864 <net_sync+0x24f>
+		e1000_stats.rx_polls++;
+f010885d:	83 05 ec d3 83 f0 01 	addl   $0x1,0xf083d3ec
+	nm_rx_tail = ring->nr_tail = i;
+f0108864:	89 5e 0c             	mov    %ebx,0xc(%esi)
+f0108867:	89 1d 00 d6 83 f0    	mov    %ebx,0xf083d600
+	return r < 0 ? r : r2;
+f010886d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0108870:	85 c0                	test   %eax,%eax
+f0108872:	0f 48 f8             	cmovs  %eax,%edi
+f0108875:	89 7d e0             	mov    %edi,-0x20(%ebp)
+}
+f0108878:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010887b:	83 c4 1c             	add    $0x1c,%esp
+f010887e:	5b                   	pop    %ebx
+f010887f:	5e                   	pop    %esi
+f0108880:	5f                   	pop    %edi
+f0108881:	5d                   	pop    %ebp
+f0108882:	c3                   	ret
+		return -E_INVAL;
+f0108883:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0108888:	eb e3                	jmp    f010886d <net_sync+0x258>
+f010888a:	c7 45 e0 fd ff ff ff 	movl   $0xfffffffd,-0x20(%ebp)
+f0108891:	eb e5                	jmp    f0108878 <net_sync+0x263>
+	if (head >= RX_QUEUE_SIZE
+f0108893:	c7 45 e0 fd ff ff ff 	movl   $0xfffffffd,-0x20(%ebp)
+	return r < 0 ? r : r2;
+f010889a:	eb dc                	jmp    f0108878 <net_sync+0x263>
+	if (rings & NET_WAIT_RX)
+f010889c:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+f01088a0:	75 09                	jne    f01088ab <net_sync+0x296>
+f01088a2:	c7 45 e0 fd ff ff ff 	movl   $0xfffffffd,-0x20(%ebp)
+f01088a9:	eb cd                	jmp    f0108878 <net_sync+0x263>
+	struct netmap_ring *ring = &nm_rings->nm_rx;
+f01088ab:	8b 35 08 d6 83 f0    	mov    0xf083d608,%esi
+	return e1000[index >> 2];
+f01088b1:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f01088b6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f01088b9:	8b 80 18 28 00 00    	mov    0x2818(%eax),%eax
+f01088bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t rdt = e1000r(E1000_RDT), head = ring->nr_head, i;
+f01088c2:	8b 7e 08             	mov    0x8(%esi),%edi
+	i = (rdt + 1) % RX_QUEUE_SIZE;
+f01088c5:	8d 58 01             	lea    0x1(%eax),%ebx
+f01088c8:	83 e3 7f             	and    $0x7f,%ebx
+	if (head >= RX_QUEUE_SIZE
+f01088cb:	83 ff 7f             	cmp    $0x7f,%edi
+f01088ce:	77 c3                	ja     f0108893 <net_sync+0x27e>
+f01088d0:	c7 45 e0 fd ff ff ff 	movl   $0xfffffffd,-0x20(%ebp)
+f01088d7:	e9 86 fd ff ff       	jmp    f0108662 <net_sync+0x4d>
+
+f01088dc <e1000_tune>:
+
+// Program the delay timers from e1000_tunables, and with polling off,
+// unmask every interrupt for good.
+void e1000_tune(void)
+{
+	if (!e1000)
+f01088dc:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f01088e1:	85 c0                	test   %eax,%eax
+f01088e3:	74 2d                	je     f0108912 <e1000_tune+0x36>
+		return;
+	e1000w(E1000_ITR, e1000_tunables.itr);
+f01088e5:	8b 15 b8 64 11 f0    	mov    0xf01164b8,%edx
+	e1000[index >> 2] = value;
+f01088eb:	89 90 c4 00 00 00    	mov    %edx,0xc4(%eax)
+	e1000w(E1000_RDTR, e1000_tunables.rdtr);
+f01088f1:	8b 15 bc 64 11 f0    	mov    0xf01164bc,%edx
+	e1000[index >> 2] = value;
+f01088f7:	89 90 20 28 00 00    	mov    %edx,0x2820(%eax)
+	e1000w(E1000_RADV, e1000_tunables.radv);
+f01088fd:	8b 15 c0 64 11 f0    	mov    0xf01164c0,%edx
+	e1000[index >> 2] = value;
+f0108903:	89 90 2c 28 00 00    	mov    %edx,0x282c(%eax)
+	if (!e1000_tunables.poll)
+f0108909:	80 3d b4 64 11 f0 00 	cmpb   $0x0,0xf01164b4
+f0108910:	74 01                	je     f0108913 <e1000_tune+0x37>
+f0108912:	c3                   	ret
+{
+f0108913:	55                   	push   %ebp
+f0108914:	89 e5                	mov    %esp,%ebp
+f0108916:	83 ec 08             	sub    $0x8,%esp
+		net_intr_arm(E1000_ICR_RX | E1000_ICR_TXDW);
+f0108919:	b8 d1 00 00 00       	mov    $0xd1,%eax
+f010891e:	e8 c0 ef ff ff       	call   f01078e3 <net_intr_arm>
+}
+f0108923:	c9                   	leave
+f0108924:	c3                   	ret
+
+f0108925 <pci_e1000_attach>:
+};
+
+// LAB 6: Your driver code here
+int
+pci_e1000_attach(struct pci_func *f)
+{
+f0108925:	55                   	push   %ebp
+f0108926:	89 e5                	mov    %esp,%ebp
+f0108928:	57                   	push   %edi
+f0108929:	56                   	push   %esi
+f010892a:	53                   	push   %ebx
+f010892b:	83 ec 14             	sub    $0x14,%esp
+f010892e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!net_attach(&e1000_driver, f->irq_line))
+f0108931:	0f b6 43 44          	movzbl 0x44(%ebx),%eax
+f0108935:	50                   	push   %eax
+f0108936:	68 20 c9 10 f0       	push   $0xf010c920
+f010893b:	e8 3d 16 00 00       	call   f0109f7d <net_attach>
+f0108940:	89 c2                	mov    %eax,%edx
+f0108942:	83 c4 10             	add    $0x10,%esp
+		return 0;
+f0108945:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!net_attach(&e1000_driver, f->irq_line))
+f010894a:	84 d2                	test   %dl,%dl
+f010894c:	75 08                	jne    f0108956 <pci_e1000_attach+0x31>
+	e1000w(E1000_IMC, 0xFFFFFFFF);
+	e1000r(E1000_ICR);
+	net_intr_arm(E1000_ICR_RX | E1000_ICR_TXDW);
+	e1000_tune();
+	return 1;
+}
+f010894e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108951:	5b                   	pop    %ebx
+f0108952:	5e                   	pop    %esi
+f0108953:	5f                   	pop    %edi
+f0108954:	5d                   	pop    %ebp
+f0108955:	c3                   	ret
+	pci_func_enable(f);
+f0108956:	83 ec 0c             	sub    $0xc,%esp
+f0108959:	53                   	push   %ebx
+f010895a:	e8 3e 1c 00 00       	call   f010a59d <pci_func_enable>
+	e1000 = mmio_map_region(f->reg_base[0], f->reg_size[0]);
+f010895f:	83 c4 08             	add    $0x8,%esp
+f0108962:	ff 73 2c             	push   0x2c(%ebx)
+f0108965:	ff 73 14             	push   0x14(%ebx)
+f0108968:	e8 f8 92 ff ff       	call   f0101c65 <mmio_map_region>
+f010896d:	a3 44 fa 83 f0       	mov    %eax,0xf083fa44
+	return e1000[index >> 2];
+f0108972:	8b 40 08             	mov    0x8(%eax),%eax
+	cprintf("E1000_STATUS: %x\n", e1000r(E1000_STATUS));
+f0108975:	83 c4 08             	add    $0x8,%esp
+f0108978:	50                   	push   %eax
+f0108979:	68 e6 c8 10 f0       	push   $0xf010c8e6
+f010897e:	e8 5e ba ff ff       	call   f01043e1 <cprintf>
+	if ((uint32_t)kva < KERNBASE)
+f0108983:	83 c4 10             	add    $0x10,%esp
+f0108986:	b8 40 ea 83 f0       	mov    $0xf083ea40,%eax
+f010898b:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0108990:	76 50                	jbe    f01089e2 <pci_e1000_attach+0xbd>
+	e1000[index >> 2] = value;
+f0108992:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f0108997:	c7 80 00 38 00 00 40 	movl   $0x83ea40,0x3800(%eax)
+f010899e:	ea 83 00 
+f01089a1:	c7 80 04 38 00 00 00 	movl   $0x0,0x3804(%eax)
+f01089a8:	00 00 00 
+f01089ab:	c7 80 08 38 00 00 00 	movl   $0x1000,0x3808(%eax)
+f01089b2:	10 00 00 
+f01089b5:	c7 80 10 38 00 00 00 	movl   $0x0,0x3810(%eax)
+f01089bc:	00 00 00 
+f01089bf:	c7 80 18 38 00 00 00 	movl   $0x0,0x3818(%eax)
+f01089c6:	00 00 00 
+f01089c9:	c7 80 10 04 00 00 0a 	movl   $0xc0200a,0x410(%eax)
+f01089d0:	20 c0 00 
+	for (size_t i = 0; i < TX_QUEUE_SIZE; i++) {
+f01089d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+	return (pp - pool.pages) << PGSHIFT;
+f01089d8:	be 60 c2 7f f0       	mov    $0xf07fc260,%esi
+f01089dd:	e9 86 00 00 00       	jmp    f0108a68 <pci_e1000_attach+0x143>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01089e2:	50                   	push   %eax
+f01089e3:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f01089e8:	6a 5b                	push   $0x5b
+f01089ea:	68 d9 c8 10 f0       	push   $0xf010c8d9
+f01089ef:	e8 55 76 ff ff       	call   f0100049 <_panic>
+			struct PageInfo *pp = page_alloc(0);
+f01089f4:	83 ec 0c             	sub    $0xc,%esp
+f01089f7:	6a 00                	push   $0x0
+f01089f9:	e8 74 8e ff ff       	call   f0101872 <page_alloc>
+			if (!pp)
+f01089fe:	83 c4 10             	add    $0x10,%esp
+f0108a01:	85 c0                	test   %eax,%eax
+f0108a03:	74 76                	je     f0108a7b <pci_e1000_attach+0x156>
+			pp->pp_ref++;
+f0108a05:	66 83 40 08 01       	addw   $0x1,0x8(%eax)
+	return (pp - pool.pages) << PGSHIFT;
+f0108a0a:	2b 46 08             	sub    0x8(%esi),%eax
+f0108a0d:	c1 f8 02             	sar    $0x2,%eax
+f0108a10:	69 d0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%edx
+f0108a16:	89 d0                	mov    %edx,%eax
+f0108a18:	c1 e0 0c             	shl    $0xc,%eax
+	if (PGNUM(pa) >= npages)
+f0108a1b:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f0108a21:	3b 15 ac c2 7f f0    	cmp    0xf07fc2ac,%edx
+f0108a27:	73 66                	jae    f0108a8f <pci_e1000_attach+0x16a>
+	return (void *)(pa + KERNBASE);
+f0108a29:	2d 00 00 00 10       	sub    $0x10000000,%eax
+			tx_buffer[i] = page2kva(pp);
+f0108a2e:	89 04 9d 40 e6 83 f0 	mov    %eax,-0xf7c19c0(,%ebx,4)
+	if ((uint32_t)kva < KERNBASE)
+f0108a35:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0108a3a:	76 65                	jbe    f0108aa1 <pci_e1000_attach+0x17c>
+	return (physaddr_t)kva - KERNBASE;
+f0108a3c:	89 da                	mov    %ebx,%edx
+f0108a3e:	c1 e2 04             	shl    $0x4,%edx
+f0108a41:	05 00 00 00 10       	add    $0x10000000,%eax
+		tx_queue[i].buffer_addr = PADDR(tx_buffer[i]);
+f0108a46:	89 82 40 ea 83 f0    	mov    %eax,-0xf7c15c0(%edx)
+f0108a4c:	c7 82 44 ea 83 f0 00 	movl   $0x0,-0xf7c15bc(%edx)
+f0108a53:	00 00 00 
+		tx_queue[i].status = E1000_TXD_STAT_DD;
+f0108a56:	c6 82 4c ea 83 f0 01 	movb   $0x1,-0xf7c15b4(%edx)
+	for (size_t i = 0; i < TX_QUEUE_SIZE; i++) {
+f0108a5d:	83 c3 01             	add    $0x1,%ebx
+f0108a60:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+f0108a66:	74 4b                	je     f0108ab3 <pci_e1000_attach+0x18e>
+		if (i % TX_BUFFERS_PER_PAGE == 0) {
+f0108a68:	f6 c3 01             	test   $0x1,%bl
+f0108a6b:	74 87                	je     f01089f4 <pci_e1000_attach+0xcf>
+			tx_buffer[i] = tx_buffer[i - 1] + TX_BUFFER_SIZE;
+f0108a6d:	8b 04 9d 3c e6 83 f0 	mov    -0xf7c19c4(,%ebx,4),%eax
+f0108a74:	05 ee 05 00 00       	add    $0x5ee,%eax
+f0108a79:	eb b3                	jmp    f0108a2e <pci_e1000_attach+0x109>
+				panic("net_tx_initialize: out of memory");
+f0108a7b:	83 ec 04             	sub    $0x4,%esp
+f0108a7e:	68 b8 c8 10 f0       	push   $0xf010c8b8
+f0108a83:	6a 68                	push   $0x68
+f0108a85:	68 d9 c8 10 f0       	push   $0xf010c8d9
+f0108a8a:	e8 ba 75 ff ff       	call   f0100049 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0108a8f:	50                   	push   %eax
+f0108a90:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0108a95:	6a 5f                	push   $0x5f
+f0108a97:	68 31 ba 10 f0       	push   $0xf010ba31
+f0108a9c:	e8 a8 75 ff ff       	call   f0100049 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0108aa1:	50                   	push   %eax
+f0108aa2:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0108aa7:	6a 6d                	push   $0x6d
+f0108aa9:	68 d9 c8 10 f0       	push   $0xf010c8d9
+f0108aae:	e8 96 75 ff ff       	call   f0100049 <_panic>
+	e1000[index >> 2] = value;
+f0108ab3:	8b 0d 44 fa 83 f0    	mov    0xf083fa44,%ecx
+f0108ab9:	c7 81 00 04 00 00 0a 	movl   $0x4010a,0x400(%ecx)
+f0108ac0:	01 04 00 
+	if ((uint32_t)kva < KERNBASE)
+f0108ac3:	bb 40 de 83 f0       	mov    $0xf083de40,%ebx
+f0108ac8:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0108ace:	76 6e                	jbe    f0108b3e <pci_e1000_attach+0x219>
+f0108ad0:	c7 81 00 28 00 00 40 	movl   $0x83de40,0x2800(%ecx)
+f0108ad7:	de 83 00 
+f0108ada:	c7 81 04 28 00 00 00 	movl   $0x0,0x2804(%ecx)
+f0108ae1:	00 00 00 
+f0108ae4:	c7 81 08 28 00 00 00 	movl   $0x800,0x2808(%ecx)
+f0108aeb:	08 00 00 
+f0108aee:	c7 81 10 28 00 00 00 	movl   $0x0,0x2810(%ecx)
+f0108af5:	00 00 00 
+f0108af8:	c7 81 18 28 00 00 7f 	movl   $0x7f,0x2818(%ecx)
+f0108aff:	00 00 00 
+f0108b02:	c7 81 00 54 00 00 52 	movl   $0x12005452,0x5400(%ecx)
+f0108b09:	54 00 12 
+f0108b0c:	c7 81 04 54 00 00 34 	movl   $0x80005634,0x5404(%ecx)
+f0108b13:	56 00 80 
+f0108b16:	b8 00 52 00 00       	mov    $0x5200,%eax
+f0108b1b:	89 c2                	mov    %eax,%edx
+f0108b1d:	83 e2 fc             	and    $0xfffffffc,%edx
+f0108b20:	01 ca                	add    %ecx,%edx
+f0108b22:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (size_t i = 0; i < 128; i++)
+f0108b28:	83 c0 04             	add    $0x4,%eax
+f0108b2b:	3d 00 54 00 00       	cmp    $0x5400,%eax
+f0108b30:	75 e9                	jne    f0108b1b <pci_e1000_attach+0x1f6>
+f0108b32:	be 40 e6 83 f0       	mov    $0xf083e640,%esi
+	return (pp - pool.pages) << PGSHIFT;
+f0108b37:	bf 60 c2 7f f0       	mov    $0xf07fc260,%edi
+f0108b3c:	eb 3c                	jmp    f0108b7a <pci_e1000_attach+0x255>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0108b3e:	53                   	push   %ebx
+f0108b3f:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0108b44:	68 52 01 00 00       	push   $0x152
+f0108b49:	68 d9 c8 10 f0       	push   $0xf010c8d9
+f0108b4e:	e8 f6 74 ff ff       	call   f0100049 <_panic>
+		pp->pp_ref++;
+f0108b53:	66 83 40 08 01       	addw   $0x1,0x8(%eax)
+	return (pp - pool.pages) << PGSHIFT;
+f0108b58:	2b 47 08             	sub    0x8(%edi),%eax
+f0108b5b:	c1 f8 02             	sar    $0x2,%eax
+f0108b5e:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0108b64:	c1 e0 0c             	shl    $0xc,%eax
+		rx_queue[i].buffer_addr = page2pa(pp) + RX_PKT_OFFSET;
+f0108b67:	83 c0 08             	add    $0x8,%eax
+f0108b6a:	89 03                	mov    %eax,(%ebx)
+f0108b6c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+		rx_queue[i].status = 0;
+f0108b73:	c6 43 0c 00          	movb   $0x0,0xc(%ebx)
+	for (size_t i = 0; i < RX_QUEUE_SIZE; i++) {
+f0108b77:	83 c3 10             	add    $0x10,%ebx
+f0108b7a:	39 f3                	cmp    %esi,%ebx
+f0108b7c:	74 28                	je     f0108ba6 <pci_e1000_attach+0x281>
+		struct PageInfo *pp = page_alloc(0);
+f0108b7e:	83 ec 0c             	sub    $0xc,%esp
+f0108b81:	6a 00                	push   $0x0
+f0108b83:	e8 ea 8c ff ff       	call   f0101872 <page_alloc>
+		if (!pp)
+f0108b88:	83 c4 10             	add    $0x10,%esp
+f0108b8b:	85 c0                	test   %eax,%eax
+f0108b8d:	75 c4                	jne    f0108b53 <pci_e1000_attach+0x22e>
+			panic("net_rx_fill: out of memory");
+f0108b8f:	83 ec 04             	sub    $0x4,%esp
+f0108b92:	68 f8 c8 10 f0       	push   $0xf010c8f8
+f0108b97:	68 49 01 00 00       	push   $0x149
+f0108b9c:	68 d9 c8 10 f0       	push   $0xf010c8d9
+f0108ba1:	e8 a3 74 ff ff       	call   f0100049 <_panic>
+	e1000[index >> 2] = value;
+f0108ba6:	a1 44 fa 83 f0       	mov    0xf083fa44,%eax
+f0108bab:	c7 80 00 50 00 00 00 	movl   $0x300,0x5000(%eax)
+f0108bb2:	03 00 00 
+f0108bb5:	c7 80 00 01 00 00 22 	movl   $0x4008022,0x100(%eax)
+f0108bbc:	80 00 04 
+f0108bbf:	c7 80 d8 00 00 00 ff 	movl   $0xffffffff,0xd8(%eax)
+f0108bc6:	ff ff ff 
+	return e1000[index >> 2];
+f0108bc9:	8b 80 c0 00 00 00    	mov    0xc0(%eax),%eax
+	net_intr_arm(E1000_ICR_RX | E1000_ICR_TXDW);
+f0108bcf:	b8 d1 00 00 00       	mov    $0xd1,%eax
+f0108bd4:	e8 0a ed ff ff       	call   f01078e3 <net_intr_arm>
+	e1000_tune();
+f0108bd9:	e8 fe fc ff ff       	call   f01088dc <e1000_tune>
+	return 1;
+f0108bde:	b8 01 00 00 00       	mov    $0x1,%eax
+f0108be3:	e9 66 fd ff ff       	jmp    f010894e <pci_e1000_attach+0x29>
+
+f0108be8 <vq_num>:
+// The size of queue q, or 0 if the device has none we can take.
+static uint16_t vq_num(int q)
+{
+	uint16_t num;
+
+	outw(vnet_io + VIRTIO_PCI_QUEUE_SEL, q);
+f0108be8:	8b 0d 04 80 84 f0    	mov    0xf0848004,%ecx
+f0108bee:	8d 51 0e             	lea    0xe(%ecx),%edx
+	asm volatile("outw %0,%w1" : : "a" (data), "d" (port));
+f0108bf1:	66 ef                	out    %ax,(%dx)
+	num = inw(vnet_io + VIRTIO_PCI_QUEUE_NUM);
+f0108bf3:	8d 51 0c             	lea    0xc(%ecx),%edx
+	asm volatile("inw %w1,%0" : "=a" (data) : "d" (port));
+f0108bf6:	66 ed                	in     (%dx),%ax
+f0108bf8:	89 c2                	mov    %eax,%edx
+	return num > VQ_MAX || num % VNET_RX_DESCS ? 0 : num;
+f0108bfa:	66 3d 00 01          	cmp    $0x100,%ax
+f0108bfe:	77 0d                	ja     f0108c0d <vq_num+0x25>
+f0108c00:	a8 03                	test   $0x3,%al
+f0108c02:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108c07:	0f 45 d0             	cmovne %eax,%edx
+}
+f0108c0a:	89 d0                	mov    %edx,%eax
+f0108c0c:	c3                   	ret
+	return num > VQ_MAX || num % VNET_RX_DESCS ? 0 : num;
+f0108c0d:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108c12:	eb f6                	jmp    f0108c0a <vq_num+0x22>
+
+f0108c14 <vq_publish>:
+}
+
+// Make the chains put in queue q's available ring up to 'idx' visible
+// to the device, and tell it about them unless it does not want to be.
+static void vq_publish(int q, uint16_t idx)
+{
+f0108c14:	55                   	push   %ebp
+f0108c15:	89 e5                	mov    %esp,%ebp
+f0108c17:	53                   	push   %ebx
+	barrier();
+	vqs[q].avail->idx = idx;
+f0108c18:	8d 0c 40             	lea    (%eax,%eax,2),%ecx
+f0108c1b:	8d 0c cd a0 17 84 f0 	lea    -0xf7be860(,%ecx,8),%ecx
+f0108c22:	8b 59 08             	mov    0x8(%ecx),%ebx
+f0108c25:	66 89 53 02          	mov    %dx,0x2(%ebx)
+	asm volatile("lock; addl $0, 0(%%esp)" : : : "memory");
+f0108c29:	f0 83 04 24 00       	lock addl $0x0,(%esp)
+	mb();
+	if (!(*(volatile uint16_t *) &vqs[q].used->flags
+f0108c2e:	8b 51 0c             	mov    0xc(%ecx),%edx
+f0108c31:	0f b7 12             	movzwl (%edx),%edx
+f0108c34:	f6 c2 01             	test   $0x1,%dl
+f0108c37:	75 0b                	jne    f0108c44 <vq_publish+0x30>
+	      & VRING_USED_F_NO_NOTIFY))
+		outw(vnet_io + VIRTIO_PCI_QUEUE_NOTIFY, q);
+f0108c39:	8b 1d 04 80 84 f0    	mov    0xf0848004,%ebx
+f0108c3f:	8d 53 10             	lea    0x10(%ebx),%edx
+	asm volatile("outw %0,%w1" : : "a" (data), "d" (port));
+f0108c42:	66 ef                	out    %ax,(%dx)
+}
+f0108c44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0108c47:	c9                   	leave
+f0108c48:	c3                   	ret
+
+f0108c49 <vq_intr>:
+
+// Ask queue q for interrupts, or not.  Whether one is asked for takes
+// effect before anything the device does next is looked at.
+static void vq_intr(int q, bool on)
+{
+	if (on)
+f0108c49:	84 d2                	test   %dl,%dl
+f0108c4b:	74 14                	je     f0108c61 <vq_intr+0x18>
+		vqs[q].avail->flags &= ~VRING_AVAIL_F_NO_INTERRUPT;
+f0108c4d:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0108c50:	8b 04 c5 a8 17 84 f0 	mov    -0xf7be858(,%eax,8),%eax
+f0108c57:	66 83 20 fe          	andw   $0xfffe,(%eax)
+	asm volatile("lock; addl $0, 0(%%esp)" : : : "memory");
+f0108c5b:	f0 83 04 24 00       	lock addl $0x0,(%esp)
+	else
+		vqs[q].avail->flags |= VRING_AVAIL_F_NO_INTERRUPT;
+	mb();
+}
+f0108c60:	c3                   	ret
+		vqs[q].avail->flags |= VRING_AVAIL_F_NO_INTERRUPT;
+f0108c61:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0108c64:	8b 04 c5 a8 17 84 f0 	mov    -0xf7be858(,%eax,8),%eax
+f0108c6b:	66 83 08 01          	orw    $0x1,(%eax)
+f0108c6f:	eb ea                	jmp    f0108c5b <vq_intr+0x12>
+
+f0108c71 <vnet_rx_peek>:
+
+/* Look at the next received packet on the queue, leaving it there.
+ * Returns its buffer, and its length in *length, or -1 if there is
+ * none.  */
+static int vnet_rx_peek(size_t *length)
+{
+f0108c71:	55                   	push   %ebp
+f0108c72:	89 e5                	mov    %esp,%ebp
+f0108c74:	56                   	push   %esi
+f0108c75:	53                   	push   %ebx
+f0108c76:	89 c1                	mov    %eax,%ecx
+	struct virtq *vq = &vqs[VQ_RX];
+	struct vring_used_elem *e;
+
+	if (vq->last_used == vq_used_idx(vq))
+f0108c78:	0f b7 05 b0 17 84 f0 	movzwl 0xf08417b0,%eax
+	return *(volatile uint16_t *) &vq->used->idx;
+f0108c7f:	8b 1d ac 17 84 f0    	mov    0xf08417ac,%ebx
+f0108c85:	0f b7 53 02          	movzwl 0x2(%ebx),%edx
+	if (vq->last_used == vq_used_idx(vq))
+f0108c89:	66 39 d0             	cmp    %dx,%ax
+f0108c8c:	74 36                	je     f0108cc4 <vnet_rx_peek+0x53>
+		return -1;
+	e = &vq->used->ring[vq->last_used % vq->num];
+f0108c8e:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108c93:	66 f7 35 a0 17 84 f0 	divw   0xf08417a0
+f0108c9a:	0f b7 d2             	movzwl %dx,%edx
+	*length = MIN(e->len - MIN(e->len, sizeof(struct virtio_net_hdr)),
+f0108c9d:	8b 44 d3 08          	mov    0x8(%ebx,%edx,8),%eax
+f0108ca1:	be 0a 00 00 00       	mov    $0xa,%esi
+f0108ca6:	39 f0                	cmp    %esi,%eax
+f0108ca8:	0f 46 f0             	cmovbe %eax,%esi
+f0108cab:	29 f0                	sub    %esi,%eax
+f0108cad:	be 3a 23 00 00       	mov    $0x233a,%esi
+f0108cb2:	39 f0                	cmp    %esi,%eax
+f0108cb4:	0f 47 c6             	cmova  %esi,%eax
+f0108cb7:	89 01                	mov    %eax,(%ecx)
+		      NET_FRAME_MAX);
+	return e->id / VNET_RX_DESCS;
+f0108cb9:	8b 44 d3 04          	mov    0x4(%ebx,%edx,8),%eax
+f0108cbd:	c1 e8 02             	shr    $0x2,%eax
+}
+f0108cc0:	5b                   	pop    %ebx
+f0108cc1:	5e                   	pop    %esi
+f0108cc2:	5d                   	pop    %ebp
+f0108cc3:	c3                   	ret
+		return -1;
+f0108cc4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0108cc9:	eb f5                	jmp    f0108cc0 <vnet_rx_peek+0x4f>
+
+f0108ccb <vq_init>:
+{
+f0108ccb:	55                   	push   %ebp
+f0108ccc:	89 e5                	mov    %esp,%ebp
+f0108cce:	57                   	push   %edi
+f0108ccf:	56                   	push   %esi
+f0108cd0:	53                   	push   %ebx
+f0108cd1:	83 ec 1c             	sub    $0x1c,%esp
+f0108cd4:	89 c3                	mov    %eax,%ebx
+	uint16_t num = vq_num(q);
+f0108cd6:	e8 0d ff ff ff       	call   f0108be8 <vq_num>
+	memset(vq_mem[q], 0, VRING_SIZE(num));
+f0108cdb:	66 89 45 e2          	mov    %ax,-0x1e(%ebp)
+f0108cdf:	0f b7 f8             	movzwl %ax,%edi
+f0108ce2:	8d 04 fd 00 00 00 00 	lea    0x0(,%edi,8),%eax
+f0108ce9:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0108cec:	8d 14 38             	lea    (%eax,%edi,1),%edx
+f0108cef:	8d 94 12 05 10 00 00 	lea    0x1005(%edx,%edx,1),%edx
+f0108cf6:	89 d1                	mov    %edx,%ecx
+f0108cf8:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+f0108cfe:	8d 3c 1b             	lea    (%ebx,%ebx,1),%edi
+f0108d01:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+f0108d04:	c1 e2 0c             	shl    $0xc,%edx
+f0108d07:	8d b2 00 20 84 f0    	lea    -0xf7be000(%edx),%esi
+f0108d0d:	83 ec 04             	sub    $0x4,%esp
+f0108d10:	05 05 10 00 00       	add    $0x1005,%eax
+f0108d15:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0108d1a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0108d1d:	01 c8                	add    %ecx,%eax
+f0108d1f:	50                   	push   %eax
+f0108d20:	6a 00                	push   $0x0
+f0108d22:	56                   	push   %esi
+f0108d23:	e8 de e0 ff ff       	call   f0106e06 <memset>
+	vq->num = num;
+f0108d28:	01 df                	add    %ebx,%edi
+f0108d2a:	c1 e7 03             	shl    $0x3,%edi
+f0108d2d:	8d 87 a0 17 84 f0    	lea    -0xf7be860(%edi),%eax
+f0108d33:	0f b7 55 e2          	movzwl -0x1e(%ebp),%edx
+f0108d37:	66 89 97 a0 17 84 f0 	mov    %dx,-0xf7be860(%edi)
+	vq->desc = (struct vring_desc *) vq_mem[q];
+f0108d3e:	89 b7 a4 17 84 f0    	mov    %esi,-0xf7be85c(%edi)
+	vq->avail = (struct vring_avail *) &vq->desc[num];
+f0108d44:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0108d47:	c1 e7 04             	shl    $0x4,%edi
+f0108d4a:	89 fa                	mov    %edi,%edx
+f0108d4c:	01 f2                	add    %esi,%edx
+f0108d4e:	89 50 08             	mov    %edx,0x8(%eax)
+	vq->used = (struct vring_used *) (vq_mem[q] + VRING_USED_OFF(num));
+f0108d51:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0108d54:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+f0108d57:	89 50 0c             	mov    %edx,0xc(%eax)
+	vq->last_used = 0;
+f0108d5a:	66 c7 40 10 00 00    	movw   $0x0,0x10(%eax)
+	for (uint16_t i = 0; i < num; i++)
+f0108d60:	83 c4 10             	add    $0x10,%esp
+f0108d63:	b9 00 00 00 00       	mov    $0x0,%ecx
+		vq->desc[i].next = (i + 1) % num;
+f0108d68:	8d 3c 5b             	lea    (%ebx,%ebx,2),%edi
+f0108d6b:	89 75 dc             	mov    %esi,-0x24(%ebp)
+f0108d6e:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+	for (uint16_t i = 0; i < num; i++)
+f0108d71:	eb 1c                	jmp    f0108d8f <vq_init+0xc4>
+		vq->desc[i].next = (i + 1) % num;
+f0108d73:	8d 59 01             	lea    0x1(%ecx),%ebx
+f0108d76:	c1 e1 04             	shl    $0x4,%ecx
+f0108d79:	03 0c fd a4 17 84 f0 	add    -0xf7be85c(,%edi,8),%ecx
+f0108d80:	0f b7 75 e2          	movzwl -0x1e(%ebp),%esi
+f0108d84:	89 d8                	mov    %ebx,%eax
+f0108d86:	99                   	cltd
+f0108d87:	f7 fe                	idiv   %esi
+f0108d89:	66 89 51 0e          	mov    %dx,0xe(%ecx)
+f0108d8d:	89 d9                	mov    %ebx,%ecx
+	for (uint16_t i = 0; i < num; i++)
+f0108d8f:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+f0108d92:	75 df                	jne    f0108d73 <vq_init+0xa8>
+	vq->free_head = 0;
+f0108d94:	8b 75 dc             	mov    -0x24(%ebp),%esi
+f0108d97:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+f0108d9a:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+f0108d9d:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+f0108da0:	66 c7 04 d5 b2 17 84 	movw   $0x0,-0xf7be84e(,%edx,8)
+f0108da7:	f0 00 00 
+	vq->nfree = num;
+f0108daa:	0f b7 7d e2          	movzwl -0x1e(%ebp),%edi
+f0108dae:	66 89 3c d5 b4 17 84 	mov    %di,-0xf7be84c(,%edx,8)
+f0108db5:	f0 
+	if ((uint32_t)kva < KERNBASE)
+f0108db6:	81 fe ff ff ff ef    	cmp    $0xefffffff,%esi
+f0108dbc:	76 1b                	jbe    f0108dd9 <vq_init+0x10e>
+	return (physaddr_t)kva - KERNBASE;
+f0108dbe:	8d 86 00 00 00 10    	lea    0x10000000(%esi),%eax
+	outl(vnet_io + VIRTIO_PCI_QUEUE_PFN,
+f0108dc4:	c1 e8 0c             	shr    $0xc,%eax
+f0108dc7:	8b 35 04 80 84 f0    	mov    0xf0848004,%esi
+f0108dcd:	8d 56 08             	lea    0x8(%esi),%edx
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f0108dd0:	ef                   	out    %eax,(%dx)
+}
+f0108dd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108dd4:	5b                   	pop    %ebx
+f0108dd5:	5e                   	pop    %esi
+f0108dd6:	5f                   	pop    %edi
+f0108dd7:	5d                   	pop    %ebp
+f0108dd8:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0108dd9:	56                   	push   %esi
+f0108dda:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0108ddf:	6a 69                	push   $0x69
+f0108de1:	68 6d c9 10 f0       	push   $0xf010c96d
+f0108de6:	e8 5e 72 ff ff       	call   f0100049 <_panic>
+
+f0108deb <frags_csum>:
+{
+f0108deb:	55                   	push   %ebp
+f0108dec:	89 e5                	mov    %esp,%ebp
+f0108dee:	57                   	push   %edi
+f0108def:	56                   	push   %esi
+f0108df0:	53                   	push   %ebx
+f0108df1:	83 ec 2c             	sub    $0x2c,%esp
+f0108df4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0108df7:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	return (pp - pool.pages) << PGSHIFT;
+f0108dfa:	a1 68 c2 7f f0       	mov    0xf07fc268,%eax
+f0108dff:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	if (PGNUM(pa) >= npages)
+f0108e02:	a1 ac c2 7f f0       	mov    0xf07fc2ac,%eax
+f0108e07:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	for (int i = 0; i < n && pos < end; pos += frags[i].len, i++) {
+f0108e0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	size_t pos = 0, j;
+f0108e0f:	be 00 00 00 00       	mov    $0x0,%esi
+	uint32_t sum = 0;
+f0108e14:	bf 00 00 00 00       	mov    $0x0,%edi
+f0108e19:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f0108e1c:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+f0108e1f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	for (int i = 0; i < n && pos < end; pos += frags[i].len, i++) {
+f0108e22:	eb 4b                	jmp    f0108e6f <frags_csum+0x84>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0108e24:	52                   	push   %edx
+f0108e25:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0108e2a:	6a 5f                	push   $0x5f
+f0108e2c:	68 31 ba 10 f0       	push   $0xf010ba31
+f0108e31:	e8 13 72 ff ff       	call   f0100049 <_panic>
+				sum += (pos + j - start) % 2 ? p[j] : p[j] << 8;
+f0108e36:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0108e39:	0f b6 34 06          	movzbl (%esi,%eax,1),%esi
+f0108e3d:	c1 e6 08             	shl    $0x8,%esi
+f0108e40:	01 75 e0             	add    %esi,-0x20(%ebp)
+		for (j = 0; j < frags[i].len; j++)
+f0108e43:	83 c0 01             	add    $0x1,%eax
+f0108e46:	39 d0                	cmp    %edx,%eax
+f0108e48:	74 1d                	je     f0108e67 <frags_csum+0x7c>
+			if (pos + j >= start && pos + j < end)
+f0108e4a:	39 c8                	cmp    %ecx,%eax
+f0108e4c:	72 f5                	jb     f0108e43 <frags_csum+0x58>
+f0108e4e:	39 f8                	cmp    %edi,%eax
+f0108e50:	73 f1                	jae    f0108e43 <frags_csum+0x58>
+				sum += (pos + j - start) % 2 ? p[j] : p[j] << 8;
+f0108e52:	89 c6                	mov    %eax,%esi
+f0108e54:	29 ce                	sub    %ecx,%esi
+f0108e56:	f7 c6 01 00 00 00    	test   $0x1,%esi
+f0108e5c:	74 d8                	je     f0108e36 <frags_csum+0x4b>
+f0108e5e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0108e61:	0f b6 34 06          	movzbl (%esi,%eax,1),%esi
+f0108e65:	eb d9                	jmp    f0108e40 <frags_csum+0x55>
+	for (int i = 0; i < n && pos < end; pos += frags[i].len, i++) {
+f0108e67:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+f0108e6a:	83 c3 01             	add    $0x1,%ebx
+f0108e6d:	89 c6                	mov    %eax,%esi
+f0108e6f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0108e72:	39 c3                	cmp    %eax,%ebx
+f0108e74:	7d 74                	jge    f0108eea <frags_csum+0xff>
+f0108e76:	39 fe                	cmp    %edi,%esi
+f0108e78:	73 53                	jae    f0108ecd <frags_csum+0xe2>
+	return (pp - pool.pages) << PGSHIFT;
+f0108e7a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0108e7d:	8b 04 d8             	mov    (%eax,%ebx,8),%eax
+f0108e80:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0108e83:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f0108e86:	29 c8                	sub    %ecx,%eax
+f0108e88:	c1 f8 02             	sar    $0x2,%eax
+f0108e8b:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0108e91:	89 c2                	mov    %eax,%edx
+f0108e93:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0108e96:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0108e9b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0108e9e:	39 c8                	cmp    %ecx,%eax
+f0108ea0:	73 82                	jae    f0108e24 <frags_csum+0x39>
+		p = (uint8_t *) page2kva(frags[i].pp) + frags[i].off;
+f0108ea2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0108ea5:	0f b7 44 d9 04       	movzwl 0x4(%ecx,%ebx,8),%eax
+f0108eaa:	8d 94 02 00 00 00 f0 	lea    -0x10000000(%edx,%eax,1),%edx
+f0108eb1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		for (j = 0; j < frags[i].len; j++)
+f0108eb4:	0f b7 54 d9 06       	movzwl 0x6(%ecx,%ebx,8),%edx
+f0108eb9:	01 f2                	add    %esi,%edx
+f0108ebb:	89 f0                	mov    %esi,%eax
+				sum += (pos + j - start) % 2 ? p[j] : p[j] << 8;
+f0108ebd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0108ec0:	29 f1                	sub    %esi,%ecx
+f0108ec2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f0108ec5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+		for (j = 0; j < frags[i].len; j++)
+f0108ec8:	e9 79 ff ff ff       	jmp    f0108e46 <frags_csum+0x5b>
+f0108ecd:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0108ed0:	eb 05                	jmp    f0108ed7 <frags_csum+0xec>
+		sum = (sum & 0xFFFF) + (sum >> 16);
+f0108ed2:	0f b7 ff             	movzwl %di,%edi
+f0108ed5:	01 c7                	add    %eax,%edi
+	while (sum >> 16)
+f0108ed7:	89 f8                	mov    %edi,%eax
+f0108ed9:	c1 e8 10             	shr    $0x10,%eax
+f0108edc:	75 f4                	jne    f0108ed2 <frags_csum+0xe7>
+	return ~sum;
+f0108ede:	89 f8                	mov    %edi,%eax
+f0108ee0:	f7 d0                	not    %eax
+}
+f0108ee2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108ee5:	5b                   	pop    %ebx
+f0108ee6:	5e                   	pop    %esi
+f0108ee7:	5f                   	pop    %edi
+f0108ee8:	5d                   	pop    %ebp
+f0108ee9:	c3                   	ret
+f0108eea:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0108eed:	eb e8                	jmp    f0108ed7 <frags_csum+0xec>
+
+f0108eef <frags_byte>:
+{
+f0108eef:	55                   	push   %ebp
+f0108ef0:	89 e5                	mov    %esp,%ebp
+f0108ef2:	57                   	push   %edi
+f0108ef3:	56                   	push   %esi
+f0108ef4:	53                   	push   %ebx
+f0108ef5:	83 ec 0c             	sub    $0xc,%esp
+f0108ef8:	89 d3                	mov    %edx,%ebx
+f0108efa:	89 ca                	mov    %ecx,%edx
+	for (int i = 0; i < n; pos -= frags[i].len, i++)
+f0108efc:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108f01:	39 d9                	cmp    %ebx,%ecx
+f0108f03:	7d 5e                	jge    f0108f63 <frags_byte+0x74>
+		if (pos < frags[i].len)
+f0108f05:	89 c7                	mov    %eax,%edi
+f0108f07:	0f b7 70 06          	movzwl 0x6(%eax),%esi
+f0108f0b:	83 c0 08             	add    $0x8,%eax
+f0108f0e:	39 f2                	cmp    %esi,%edx
+f0108f10:	72 07                	jb     f0108f19 <frags_byte+0x2a>
+	for (int i = 0; i < n; pos -= frags[i].len, i++)
+f0108f12:	29 f2                	sub    %esi,%edx
+f0108f14:	83 c1 01             	add    $0x1,%ecx
+f0108f17:	eb e8                	jmp    f0108f01 <frags_byte+0x12>
+	return (pp - pool.pages) << PGSHIFT;
+f0108f19:	8b 07                	mov    (%edi),%eax
+f0108f1b:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f0108f21:	c1 f8 02             	sar    $0x2,%eax
+f0108f24:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0108f2a:	89 c1                	mov    %eax,%ecx
+f0108f2c:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0108f2f:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0108f34:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f0108f3a:	73 15                	jae    f0108f51 <frags_byte+0x62>
+			return (uint8_t *) page2kva(frags[i].pp) + frags[i].off
+f0108f3c:	0f b7 47 04          	movzwl 0x4(%edi),%eax
+				+ pos;
+f0108f40:	01 d0                	add    %edx,%eax
+f0108f42:	8d 84 01 00 00 00 f0 	lea    -0x10000000(%ecx,%eax,1),%eax
+}
+f0108f49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108f4c:	5b                   	pop    %ebx
+f0108f4d:	5e                   	pop    %esi
+f0108f4e:	5f                   	pop    %edi
+f0108f4f:	5d                   	pop    %ebp
+f0108f50:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0108f51:	51                   	push   %ecx
+f0108f52:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0108f57:	6a 5f                	push   $0x5f
+f0108f59:	68 31 ba 10 f0       	push   $0xf010ba31
+f0108f5e:	e8 e6 70 ff ff       	call   f0100049 <_panic>
+	panic("frags_byte: %u past the end", pos);
+f0108f63:	52                   	push   %edx
+f0108f64:	68 7f c9 10 f0       	push   $0xf010c97f
+f0108f69:	68 f2 00 00 00       	push   $0xf2
+f0108f6e:	68 6d c9 10 f0       	push   $0xf010c96d
+f0108f73:	e8 d1 70 ff ff       	call   f0100049 <_panic>
+
+f0108f78 <frags_put16>:
+{
+f0108f78:	55                   	push   %ebp
+f0108f79:	89 e5                	mov    %esp,%ebp
+f0108f7b:	57                   	push   %edi
+f0108f7c:	56                   	push   %esi
+f0108f7d:	53                   	push   %ebx
+f0108f7e:	83 ec 1c             	sub    $0x1c,%esp
+f0108f81:	89 d6                	mov    %edx,%esi
+f0108f83:	89 cb                	mov    %ecx,%ebx
+f0108f85:	8b 7d 08             	mov    0x8(%ebp),%edi
+	*frags_byte(frags, n, pos) = v >> 8;
+f0108f88:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0108f8b:	e8 5f ff ff ff       	call   f0108eef <frags_byte>
+f0108f90:	89 fa                	mov    %edi,%edx
+f0108f92:	88 30                	mov    %dh,(%eax)
+	*frags_byte(frags, n, pos + 1) = v;
+f0108f94:	8d 4b 01             	lea    0x1(%ebx),%ecx
+f0108f97:	89 f2                	mov    %esi,%edx
+f0108f99:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108f9c:	e8 4e ff ff ff       	call   f0108eef <frags_byte>
+f0108fa1:	89 fb                	mov    %edi,%ebx
+f0108fa3:	88 18                	mov    %bl,(%eax)
+}
+f0108fa5:	83 c4 1c             	add    $0x1c,%esp
+f0108fa8:	5b                   	pop    %ebx
+f0108fa9:	5e                   	pop    %esi
+f0108faa:	5f                   	pop    %edi
+f0108fab:	5d                   	pop    %ebp
+f0108fac:	c3                   	ret
+
+f0108fad <vnet_rx_csum>:
+
+/* Which checksums of the 'length'-byte packet in receive buffer i the
+ * device found good, as NET_CSUM_* bits.  One it left for us to fill
+ * in, as it may for packets from this host, is filled in here.  */
+static int vnet_rx_csum(int i, size_t length)
+{
+f0108fad:	55                   	push   %ebp
+f0108fae:	89 e5                	mov    %esp,%ebp
+f0108fb0:	57                   	push   %edi
+f0108fb1:	56                   	push   %esi
+f0108fb2:	53                   	push   %ebx
+f0108fb3:	83 ec 3c             	sub    $0x3c,%esp
+f0108fb6:	89 c6                	mov    %eax,%esi
+f0108fb8:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+	for (n = 0; length > 0; n++, off = 0) {
+f0108fbb:	8d 3c 40             	lea    (%eax,%eax,2),%edi
+f0108fbe:	c1 e7 02             	shl    $0x2,%edi
+f0108fc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	size_t off = RX_PKT_OFFSET;
+f0108fc6:	b9 08 00 00 00       	mov    $0x8,%ecx
+	for (n = 0; length > 0; n++, off = 0) {
+f0108fcb:	eb 2e                	jmp    f0108ffb <vnet_rx_csum+0x4e>
+		frags[n].pp = vnet_rx_page[i][n];
+f0108fcd:	8b 84 9f a0 14 84 f0 	mov    -0xf7beb60(%edi,%ebx,4),%eax
+f0108fd4:	89 44 dd d0          	mov    %eax,-0x30(%ebp,%ebx,8)
+		frags[n].off = off;
+f0108fd8:	66 89 4c dd d4       	mov    %cx,-0x2c(%ebp,%ebx,8)
+		frags[n].len = MIN(length, PGSIZE - off);
+f0108fdd:	b8 00 10 00 00       	mov    $0x1000,%eax
+f0108fe2:	29 c8                	sub    %ecx,%eax
+f0108fe4:	39 d0                	cmp    %edx,%eax
+f0108fe6:	0f 47 c2             	cmova  %edx,%eax
+f0108fe9:	66 89 44 dd d6       	mov    %ax,-0x2a(%ebp,%ebx,8)
+		length -= frags[n].len;
+f0108fee:	0f b7 c0             	movzwl %ax,%eax
+f0108ff1:	29 c2                	sub    %eax,%edx
+	for (n = 0; length > 0; n++, off = 0) {
+f0108ff3:	83 c3 01             	add    $0x1,%ebx
+f0108ff6:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0108ffb:	85 d2                	test   %edx,%edx
+f0108ffd:	75 ce                	jne    f0108fcd <vnet_rx_csum+0x20>
+	struct virtio_net_hdr *hdr = &vnet_rx_hdr[i];
+	struct tx_frag pkt[VNET_RX_PAGES];
+	int n = vnet_rx_frags(i, length, pkt);
+
+	if ((hdr->flags & VIRTIO_NET_HDR_F_NEEDS_CSUM)
+f0108fff:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+f0109002:	0f b6 84 00 20 12 84 	movzbl -0xf7bede0(%eax,%eax,1),%eax
+f0109009:	f0 
+f010900a:	a8 01                	test   $0x1,%al
+f010900c:	74 29                	je     f0109037 <vnet_rx_csum+0x8a>
+	    && hdr->csum_start + hdr->csum_offset + 2 <= length) {
+f010900e:	8d 0c b5 00 00 00 00 	lea    0x0(,%esi,4),%ecx
+f0109015:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+f0109018:	0f b7 94 12 26 12 84 	movzwl -0xf7bedda(%edx,%edx,1),%edx
+f010901f:	f0 
+f0109020:	01 f1                	add    %esi,%ecx
+f0109022:	0f b7 b4 09 28 12 84 	movzwl -0xf7bedd8(%ecx,%ecx,1),%esi
+f0109029:	f0 
+f010902a:	0f b7 ca             	movzwl %dx,%ecx
+f010902d:	01 ce                	add    %ecx,%esi
+f010902f:	8d 4e 02             	lea    0x2(%esi),%ecx
+f0109032:	39 4d c4             	cmp    %ecx,-0x3c(%ebp)
+f0109035:	73 0b                	jae    f0109042 <vnet_rx_csum+0x95>
+		frags_put16(pkt, n, hdr->csum_start + hdr->csum_offset,
+			    frags_csum(pkt, n, hdr->csum_start, length));
+		return NET_CSUM_L4;
+	}
+	return hdr->flags & VIRTIO_NET_HDR_F_DATA_VALID ? NET_CSUM_L4 : 0;
+f0109037:	83 e0 02             	and    $0x2,%eax
+}
+f010903a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010903d:	5b                   	pop    %ebx
+f010903e:	5e                   	pop    %esi
+f010903f:	5f                   	pop    %edi
+f0109040:	5d                   	pop    %ebp
+f0109041:	c3                   	ret
+			    frags_csum(pkt, n, hdr->csum_start, length));
+f0109042:	0f b7 ca             	movzwl %dx,%ecx
+f0109045:	83 ec 0c             	sub    $0xc,%esp
+f0109048:	ff 75 c4             	push   -0x3c(%ebp)
+f010904b:	89 da                	mov    %ebx,%edx
+f010904d:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f0109050:	e8 96 fd ff ff       	call   f0108deb <frags_csum>
+		frags_put16(pkt, n, hdr->csum_start + hdr->csum_offset,
+f0109055:	0f b7 c0             	movzwl %ax,%eax
+f0109058:	89 04 24             	mov    %eax,(%esp)
+f010905b:	89 f1                	mov    %esi,%ecx
+f010905d:	89 da                	mov    %ebx,%edx
+f010905f:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f0109062:	e8 11 ff ff ff       	call   f0108f78 <frags_put16>
+		return NET_CSUM_L4;
+f0109067:	83 c4 10             	add    $0x10,%esp
+f010906a:	b8 02 00 00 00       	mov    $0x2,%eax
+f010906f:	eb c9                	jmp    f010903a <vnet_rx_csum+0x8d>
+
+f0109071 <vnet_rx_pages>:
+// Take received packets off the queue without copying them, up to
+// 'max' pages of them, like e1000_rx_pages, and give the device fresh
+// pages in their place in one go.  Only the pages a packet fills are
+// handed out and replaced.
+static int vnet_rx_pages(struct PageInfo **pps, int max)
+{
+f0109071:	55                   	push   %ebp
+f0109072:	89 e5                	mov    %esp,%ebp
+f0109074:	57                   	push   %edi
+f0109075:	56                   	push   %esi
+f0109076:	53                   	push   %ebx
+f0109077:	83 ec 3c             	sub    $0x3c,%esp
+	struct virtq *vq = &vqs[VQ_RX];
+	uint16_t idx = vq->avail->idx;
+f010907a:	a1 a8 17 84 f0       	mov    0xf08417a8,%eax
+f010907f:	0f b7 40 02          	movzwl 0x2(%eax),%eax
+f0109083:	83 c0 01             	add    $0x1,%eax
+f0109086:	66 89 45 cc          	mov    %ax,-0x34(%ebp)
+	struct PageInfo *fresh[VNET_RX_PAGES];
+	size_t length;
+	int n, i, j, npages, csum;
+
+	for (n = 0; n < max; n += npages) {
+f010908a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+f0109091:	e9 1c 01 00 00       	jmp    f01091b2 <vnet_rx_pages+0x141>
+			vq->last_used++;
+			vq->avail->ring[idx++ % vq->num] = VNET_RX_DESCS * i;
+			npages = 0;
+			continue;
+		}
+		if (n + npages > max)
+f0109096:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0109099:	01 d8                	add    %ebx,%eax
+f010909b:	3b 45 0c             	cmp    0xc(%ebp),%eax
+f010909e:	0f 8f 7a 01 00 00    	jg     f010921e <vnet_rx_pages+0x1ad>
+			break;
+		for (j = 0; j < npages; j++) {
+f01090a4:	be 00 00 00 00       	mov    $0x0,%esi
+f01090a9:	39 de                	cmp    %ebx,%esi
+f01090ab:	0f 8d 94 01 00 00    	jge    f0109245 <vnet_rx_pages+0x1d4>
+			if (!(fresh[j] = page_alloc(0)))
+f01090b1:	83 ec 0c             	sub    $0xc,%esp
+f01090b4:	6a 00                	push   $0x0
+f01090b6:	e8 b7 87 ff ff       	call   f0101872 <page_alloc>
+f01090bb:	89 44 b5 dc          	mov    %eax,-0x24(%ebp,%esi,4)
+f01090bf:	83 c4 10             	add    $0x10,%esp
+f01090c2:	85 c0                	test   %eax,%eax
+f01090c4:	74 1c                	je     f01090e2 <vnet_rx_pages+0x71>
+				break;
+			fresh[j]->pp_ref++;
+f01090c6:	66 83 40 08 01       	addw   $0x1,0x8(%eax)
+		for (j = 0; j < npages; j++) {
+f01090cb:	83 c6 01             	add    $0x1,%esi
+f01090ce:	eb d9                	jmp    f01090a9 <vnet_rx_pages+0x38>
+		}
+		if (j < npages) {
+			while (j-- > 0)
+				page_decref(fresh[j]);
+f01090d0:	83 ec 0c             	sub    $0xc,%esp
+f01090d3:	ff 74 b5 d8          	push   -0x28(%ebp,%esi,4)
+f01090d7:	e8 3f 88 ff ff       	call   f010191b <page_decref>
+f01090dc:	83 ee 01             	sub    $0x1,%esi
+f01090df:	83 c4 10             	add    $0x10,%esp
+			while (j-- > 0)
+f01090e2:	85 f6                	test   %esi,%esi
+f01090e4:	7f ea                	jg     f01090d0 <vnet_rx_pages+0x5f>
+			if (n == 0 && idx == vq->avail->idx)
+f01090e6:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+f01090ea:	0f 85 2e 01 00 00    	jne    f010921e <vnet_rx_pages+0x1ad>
+f01090f0:	a1 a8 17 84 f0       	mov    0xf08417a8,%eax
+f01090f5:	0f b7 4d ce          	movzwl -0x32(%ebp),%ecx
+f01090f9:	66 39 48 02          	cmp    %cx,0x2(%eax)
+f01090fd:	0f 84 39 01 00 00    	je     f010923c <vnet_rx_pages+0x1cb>
+		}
+		net_rx_pkt_init(pps + n, length, csum);
+		vq->avail->ring[idx++ % vq->num] = VNET_RX_DESCS * i;
+	}
+	if (idx != vq->avail->idx)
+		vq_publish(VQ_RX, idx);
+f0109103:	0f b7 55 ce          	movzwl -0x32(%ebp),%edx
+f0109107:	b8 00 00 00 00       	mov    $0x0,%eax
+f010910c:	e8 03 fb ff ff       	call   f0108c14 <vq_publish>
+f0109111:	e9 1b 01 00 00       	jmp    f0109231 <vnet_rx_pages+0x1c0>
+		for (j = 0; j < npages; j++) {
+f0109116:	83 c1 10             	add    $0x10,%ecx
+			pps[n + j] = vnet_rx_page[i][j];
+f0109119:	8b 84 96 a0 14 84 f0 	mov    -0xf7beb60(%esi,%edx,4),%eax
+f0109120:	8b 7d c8             	mov    -0x38(%ebp),%edi
+f0109123:	89 04 97             	mov    %eax,(%edi,%edx,4)
+			vnet_rx_page[i][j] = fresh[j];
+f0109126:	8b 44 95 dc          	mov    -0x24(%ebp,%edx,4),%eax
+f010912a:	89 84 96 a0 14 84 f0 	mov    %eax,-0xf7beb60(%esi,%edx,4)
+	return (pp - pool.pages) << PGSHIFT;
+f0109131:	bf 60 c2 7f f0       	mov    $0xf07fc260,%edi
+f0109136:	2b 47 08             	sub    0x8(%edi),%eax
+f0109139:	c1 f8 02             	sar    $0x2,%eax
+f010913c:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0109142:	c1 e0 0c             	shl    $0xc,%eax
+f0109145:	89 45 d0             	mov    %eax,-0x30(%ebp)
+				page2pa(fresh[j]) + (j ? 0 : RX_PKT_OFFSET);
+f0109148:	85 d2                	test   %edx,%edx
+f010914a:	0f 94 c0             	sete   %al
+f010914d:	0f b6 c0             	movzbl %al,%eax
+f0109150:	89 c7                	mov    %eax,%edi
+f0109152:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0109155:	8d 3c f8             	lea    (%eax,%edi,8),%edi
+f0109158:	a1 a4 17 84 f0       	mov    0xf08417a4,%eax
+f010915d:	89 3c 08             	mov    %edi,(%eax,%ecx,1)
+f0109160:	c7 44 08 04 00 00 00 	movl   $0x0,0x4(%eax,%ecx,1)
+f0109167:	00 
+		for (j = 0; j < npages; j++) {
+f0109168:	83 c2 01             	add    $0x1,%edx
+f010916b:	39 da                	cmp    %ebx,%edx
+f010916d:	7c a7                	jl     f0109116 <vnet_rx_pages+0xa5>
+		net_rx_pkt_init(pps + n, length, csum);
+f010916f:	8b 7d bc             	mov    -0x44(%ebp),%edi
+f0109172:	83 ec 04             	sub    $0x4,%esp
+f0109175:	ff 75 c0             	push   -0x40(%ebp)
+f0109178:	ff 75 c4             	push   -0x3c(%ebp)
+f010917b:	ff 75 c8             	push   -0x38(%ebp)
+f010917e:	e8 58 0e 00 00       	call   f0109fdb <net_rx_pkt_init>
+		vq->avail->ring[idx++ % vq->num] = VNET_RX_DESCS * i;
+f0109183:	0f b7 45 ce          	movzwl -0x32(%ebp),%eax
+f0109187:	ba 00 00 00 00       	mov    $0x0,%edx
+f010918c:	66 f7 35 a0 17 84 f0 	divw   0xf08417a0
+f0109193:	0f b7 d2             	movzwl %dx,%edx
+f0109196:	8d 0c bd 00 00 00 00 	lea    0x0(,%edi,4),%ecx
+f010919d:	a1 a8 17 84 f0       	mov    0xf08417a8,%eax
+f01091a2:	66 89 4c 50 04       	mov    %cx,0x4(%eax,%edx,2)
+f01091a7:	83 c4 10             	add    $0x10,%esp
+	for (n = 0; n < max; n += npages) {
+f01091aa:	01 5d d4             	add    %ebx,-0x2c(%ebp)
+f01091ad:	66 83 45 cc 01       	addw   $0x1,-0x34(%ebp)
+f01091b2:	0f b7 45 cc          	movzwl -0x34(%ebp),%eax
+f01091b6:	83 e8 01             	sub    $0x1,%eax
+f01091b9:	66 89 45 ce          	mov    %ax,-0x32(%ebp)
+f01091bd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01091c0:	3b 45 0c             	cmp    0xc(%ebp),%eax
+f01091c3:	7d 59                	jge    f010921e <vnet_rx_pages+0x1ad>
+		if ((i = vnet_rx_peek(&length)) < 0)
+f01091c5:	8d 45 d8             	lea    -0x28(%ebp),%eax
+f01091c8:	e8 a4 fa ff ff       	call   f0108c71 <vnet_rx_peek>
+f01091cd:	89 c7                	mov    %eax,%edi
+f01091cf:	85 c0                	test   %eax,%eax
+f01091d1:	78 4b                	js     f010921e <vnet_rx_pages+0x1ad>
+		npages = RX_PKT_PAGES(length);
+f01091d3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f01091d6:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f01091d9:	8d 98 07 10 00 00    	lea    0x1007(%eax),%ebx
+f01091df:	c1 eb 0c             	shr    $0xc,%ebx
+		if (npages > max) {
+f01091e2:	39 5d 0c             	cmp    %ebx,0xc(%ebp)
+f01091e5:	0f 8d ab fe ff ff    	jge    f0109096 <vnet_rx_pages+0x25>
+			vq->last_used++;
+f01091eb:	66 83 05 b0 17 84 f0 	addw   $0x1,0xf08417b0
+f01091f2:	01 
+			vq->avail->ring[idx++ % vq->num] = VNET_RX_DESCS * i;
+f01091f3:	0f b7 45 ce          	movzwl -0x32(%ebp),%eax
+f01091f7:	ba 00 00 00 00       	mov    $0x0,%edx
+f01091fc:	66 f7 35 a0 17 84 f0 	divw   0xf08417a0
+f0109203:	0f b7 d2             	movzwl %dx,%edx
+f0109206:	8d 0c bd 00 00 00 00 	lea    0x0(,%edi,4),%ecx
+f010920d:	a1 a8 17 84 f0       	mov    0xf08417a8,%eax
+f0109212:	66 89 4c 50 04       	mov    %cx,0x4(%eax,%edx,2)
+			npages = 0;
+f0109217:	bb 00 00 00 00       	mov    $0x0,%ebx
+			continue;
+f010921c:	eb 8c                	jmp    f01091aa <vnet_rx_pages+0x139>
+	if (idx != vq->avail->idx)
+f010921e:	a1 a8 17 84 f0       	mov    0xf08417a8,%eax
+f0109223:	0f b7 4d ce          	movzwl -0x32(%ebp),%ecx
+f0109227:	66 39 48 02          	cmp    %cx,0x2(%eax)
+f010922b:	0f 85 d2 fe ff ff    	jne    f0109103 <vnet_rx_pages+0x92>
+	return n;
+}
+f0109231:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0109234:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109237:	5b                   	pop    %ebx
+f0109238:	5e                   	pop    %esi
+f0109239:	5f                   	pop    %edi
+f010923a:	5d                   	pop    %ebp
+f010923b:	c3                   	ret
+				return -E_NO_MEM;
+f010923c:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+f0109243:	eb ec                	jmp    f0109231 <vnet_rx_pages+0x1c0>
+		vq->last_used++;
+f0109245:	66 83 05 b0 17 84 f0 	addw   $0x1,0xf08417b0
+f010924c:	01 
+		csum = vnet_rx_csum(i, length);
+f010924d:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0109250:	89 f8                	mov    %edi,%eax
+f0109252:	e8 56 fd ff ff       	call   f0108fad <vnet_rx_csum>
+f0109257:	89 45 c0             	mov    %eax,-0x40(%ebp)
+		for (j = 0; j < npages; j++) {
+f010925a:	89 f9                	mov    %edi,%ecx
+f010925c:	c1 e1 06             	shl    $0x6,%ecx
+f010925f:	8d 34 7f             	lea    (%edi,%edi,2),%esi
+f0109262:	c1 e6 02             	shl    $0x2,%esi
+f0109265:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109268:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f010926b:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f010926e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0109271:	ba 00 00 00 00       	mov    $0x0,%edx
+f0109276:	89 7d bc             	mov    %edi,-0x44(%ebp)
+f0109279:	e9 ed fe ff ff       	jmp    f010916b <vnet_rx_pages+0xfa>
+
+f010927e <vnet_rx>:
+{
+f010927e:	55                   	push   %ebp
+f010927f:	89 e5                	mov    %esp,%ebp
+f0109281:	57                   	push   %edi
+f0109282:	56                   	push   %esi
+f0109283:	53                   	push   %ebx
+f0109284:	83 ec 1c             	sub    $0x1c,%esp
+	uint16_t idx = vq->avail->idx;
+f0109287:	a1 a8 17 84 f0       	mov    0xf08417a8,%eax
+f010928c:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+	if ((i = vnet_rx_peek(&length)) < 0)
+f0109290:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0109293:	e8 d9 f9 ff ff       	call   f0108c71 <vnet_rx_peek>
+f0109298:	85 c0                	test   %eax,%eax
+f010929a:	0f 88 a9 00 00 00    	js     f0109349 <vnet_rx+0xcb>
+f01092a0:	89 c3                	mov    %eax,%ebx
+	vq->last_used++;
+f01092a2:	66 83 05 b0 17 84 f0 	addw   $0x1,0xf08417b0
+f01092a9:	01 
+	vnet_rx_csum(i, length);
+f01092aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01092ad:	89 fa                	mov    %edi,%edx
+f01092af:	e8 f9 fc ff ff       	call   f0108fad <vnet_rx_csum>
+	length = MIN(length, RX_BUFFER_SIZE);
+f01092b4:	b8 00 08 00 00       	mov    $0x800,%eax
+f01092b9:	39 c7                	cmp    %eax,%edi
+f01092bb:	0f 47 f8             	cmova  %eax,%edi
+	memcpy(buffer, (char *) page2kva(vnet_rx_page[i][0]) + RX_PKT_OFFSET,
+f01092be:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f01092c1:	8b 04 85 a0 14 84 f0 	mov    -0xf7beb60(,%eax,4),%eax
+f01092c8:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f01092ce:	c1 f8 02             	sar    $0x2,%eax
+f01092d1:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01092d7:	89 c2                	mov    %eax,%edx
+f01092d9:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01092dc:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01092e1:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f01092e7:	73 4e                	jae    f0109337 <vnet_rx+0xb9>
+f01092e9:	83 ec 04             	sub    $0x4,%esp
+f01092ec:	57                   	push   %edi
+f01092ed:	81 ea f8 ff ff 0f    	sub    $0xffffff8,%edx
+f01092f3:	52                   	push   %edx
+f01092f4:	ff 75 08             	push   0x8(%ebp)
+f01092f7:	e8 a1 db ff ff       	call   f0106e9d <memcpy>
+	vq->avail->ring[idx++ % vq->num] = VNET_RX_DESCS * i;
+f01092fc:	89 f0                	mov    %esi,%eax
+f01092fe:	ba 00 00 00 00       	mov    $0x0,%edx
+f0109303:	66 f7 35 a0 17 84 f0 	divw   0xf08417a0
+f010930a:	0f b7 d2             	movzwl %dx,%edx
+f010930d:	c1 e3 02             	shl    $0x2,%ebx
+f0109310:	a1 a8 17 84 f0       	mov    0xf08417a8,%eax
+f0109315:	66 89 5c 50 04       	mov    %bx,0x4(%eax,%edx,2)
+f010931a:	8d 56 01             	lea    0x1(%esi),%edx
+	vq_publish(VQ_RX, idx);
+f010931d:	0f b7 d2             	movzwl %dx,%edx
+f0109320:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109325:	e8 ea f8 ff ff       	call   f0108c14 <vq_publish>
+	return length;
+f010932a:	83 c4 10             	add    $0x10,%esp
+}
+f010932d:	89 f8                	mov    %edi,%eax
+f010932f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109332:	5b                   	pop    %ebx
+f0109333:	5e                   	pop    %esi
+f0109334:	5f                   	pop    %edi
+f0109335:	5d                   	pop    %ebp
+f0109336:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0109337:	52                   	push   %edx
+f0109338:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f010933d:	6a 5f                	push   $0x5f
+f010933f:	68 31 ba 10 f0       	push   $0xf010ba31
+f0109344:	e8 00 6d ff ff       	call   f0100049 <_panic>
+		return 0;
+f0109349:	bf 00 00 00 00       	mov    $0x0,%edi
+f010934e:	eb dd                	jmp    f010932d <vnet_rx+0xaf>
+
+f0109350 <vnet_tx_copy>:
+{
+f0109350:	55                   	push   %ebp
+f0109351:	89 e5                	mov    %esp,%ebp
+f0109353:	57                   	push   %edi
+f0109354:	56                   	push   %esi
+f0109355:	53                   	push   %ebx
+f0109356:	83 ec 1c             	sub    $0x1c,%esp
+f0109359:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010935c:	89 d7                	mov    %edx,%edi
+	uint16_t head = vq_chain(vq, VNET_TX_COPY_DESCS(length)), d = head;
+f010935e:	8d 92 ed 05 00 00    	lea    0x5ed(%edx),%edx
+f0109364:	d1 ea                	shr    %edx
+f0109366:	b9 71 5e 58 56       	mov    $0x56585e71,%ecx
+f010936b:	89 d0                	mov    %edx,%eax
+f010936d:	f7 e1                	mul    %ecx
+f010936f:	c1 ea 08             	shr    $0x8,%edx
+f0109372:	8d 4a 01             	lea    0x1(%edx),%ecx
+	uint16_t head = vq->free_head, d = head;
+f0109375:	0f b7 35 ca 17 84 f0 	movzwl 0xf08417ca,%esi
+		d = vq->desc[d].next;
+f010937c:	8b 1d bc 17 84 f0    	mov    0xf08417bc,%ebx
+	uint16_t head = vq->free_head, d = head;
+f0109382:	89 f0                	mov    %esi,%eax
+	for (int i = 1; i < n; i++)
+f0109384:	ba 01 00 00 00       	mov    $0x1,%edx
+f0109389:	39 d1                	cmp    %edx,%ecx
+f010938b:	7e 10                	jle    f010939d <vnet_tx_copy+0x4d>
+		d = vq->desc[d].next;
+f010938d:	0f b7 c0             	movzwl %ax,%eax
+f0109390:	c1 e0 04             	shl    $0x4,%eax
+f0109393:	0f b7 44 03 0e       	movzwl 0xe(%ebx,%eax,1),%eax
+	for (int i = 1; i < n; i++)
+f0109398:	83 c2 01             	add    $0x1,%edx
+f010939b:	eb ec                	jmp    f0109389 <vnet_tx_copy+0x39>
+	vq->free_head = vq->desc[d].next;
+f010939d:	0f b7 c0             	movzwl %ax,%eax
+f01093a0:	c1 e0 04             	shl    $0x4,%eax
+f01093a3:	0f b7 44 03 0e       	movzwl 0xe(%ebx,%eax,1),%eax
+f01093a8:	66 a3 ca 17 84 f0    	mov    %ax,0xf08417ca
+	vq->nfree -= n;
+f01093ae:	66 29 0d cc 17 84 f0 	sub    %cx,0xf08417cc
+	memset(&vnet_tx_hdr[head], 0, sizeof(vnet_tx_hdr[head]));
+f01093b5:	0f b7 c6             	movzwl %si,%eax
+f01093b8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f01093bb:	8d 9c 00 20 08 84 f0 	lea    -0xf7bf7e0(%eax,%eax,1),%ebx
+f01093c2:	83 ec 04             	sub    $0x4,%esp
+f01093c5:	6a 0a                	push   $0xa
+f01093c7:	6a 00                	push   $0x0
+f01093c9:	53                   	push   %ebx
+f01093ca:	e8 37 da ff ff       	call   f0106e06 <memset>
+	if ((uint32_t)kva < KERNBASE)
+f01093cf:	83 c4 10             	add    $0x10,%esp
+f01093d2:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f01093d8:	0f 86 d7 00 00 00    	jbe    f01094b5 <vnet_tx_copy+0x165>
+	vq->desc[head].addr = PADDR(&vnet_tx_hdr[head]);
+f01093de:	0f b7 c6             	movzwl %si,%eax
+f01093e1:	c1 e0 04             	shl    $0x4,%eax
+	return (physaddr_t)kva - KERNBASE;
+f01093e4:	81 c3 00 00 00 10    	add    $0x10000000,%ebx
+f01093ea:	8b 15 bc 17 84 f0    	mov    0xf08417bc,%edx
+f01093f0:	89 1c 02             	mov    %ebx,(%edx,%eax,1)
+f01093f3:	c7 44 02 04 00 00 00 	movl   $0x0,0x4(%edx,%eax,1)
+f01093fa:	00 
+	vq->desc[head].len = sizeof(vnet_tx_hdr[head]);
+f01093fb:	8b 15 bc 17 84 f0    	mov    0xf08417bc,%edx
+f0109401:	c7 44 02 08 0a 00 00 	movl   $0xa,0x8(%edx,%eax,1)
+f0109408:	00 
+	vq->desc[head].flags = VRING_DESC_F_NEXT;
+f0109409:	8b 15 bc 17 84 f0    	mov    0xf08417bc,%edx
+f010940f:	66 c7 44 02 0c 01 00 	movw   $0x1,0xc(%edx,%eax,1)
+	uint16_t head = vq_chain(vq, VNET_TX_COPY_DESCS(length)), d = head;
+f0109416:	89 f3                	mov    %esi,%ebx
+f0109418:	66 89 75 de          	mov    %si,-0x22(%ebp)
+		d = vq->desc[d].next;
+f010941c:	0f b7 db             	movzwl %bx,%ebx
+f010941f:	c1 e3 04             	shl    $0x4,%ebx
+f0109422:	03 1d bc 17 84 f0    	add    0xf08417bc,%ebx
+f0109428:	0f b7 5b 0e          	movzwl 0xe(%ebx),%ebx
+		n = MIN(length, TX_BUFFER_SIZE);
+f010942c:	be ee 05 00 00       	mov    $0x5ee,%esi
+f0109431:	39 f7                	cmp    %esi,%edi
+f0109433:	0f 46 f7             	cmovbe %edi,%esi
+		memcpy(vnet_tx_buffer[d], packet, n);
+f0109436:	0f b7 c3             	movzwl %bx,%eax
+f0109439:	83 ec 04             	sub    $0x4,%esp
+f010943c:	56                   	push   %esi
+f010943d:	ff 75 e4             	push   -0x1c(%ebp)
+f0109440:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0109443:	ff 34 85 20 00 84 f0 	push   -0xf7bffe0(,%eax,4)
+f010944a:	e8 4e da ff ff       	call   f0106e9d <memcpy>
+		vq->desc[d].addr = PADDR(vnet_tx_buffer[d]);
+f010944f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0109452:	8b 14 85 20 00 84 f0 	mov    -0xf7bffe0(,%eax,4),%edx
+	if ((uint32_t)kva < KERNBASE)
+f0109459:	83 c4 10             	add    $0x10,%esp
+f010945c:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0109462:	76 66                	jbe    f01094ca <vnet_tx_copy+0x17a>
+f0109464:	0f b7 c3             	movzwl %bx,%eax
+f0109467:	c1 e0 04             	shl    $0x4,%eax
+	return (physaddr_t)kva - KERNBASE;
+f010946a:	81 c2 00 00 00 10    	add    $0x10000000,%edx
+f0109470:	8b 0d bc 17 84 f0    	mov    0xf08417bc,%ecx
+f0109476:	89 14 01             	mov    %edx,(%ecx,%eax,1)
+f0109479:	c7 44 01 04 00 00 00 	movl   $0x0,0x4(%ecx,%eax,1)
+f0109480:	00 
+		vq->desc[d].len = n;
+f0109481:	8b 15 bc 17 84 f0    	mov    0xf08417bc,%edx
+f0109487:	89 74 02 08          	mov    %esi,0x8(%edx,%eax,1)
+		packet += n;
+f010948b:	01 75 e4             	add    %esi,-0x1c(%ebp)
+		vq->desc[d].flags = length > 0 ? VRING_DESC_F_NEXT : 0;
+f010948e:	29 f7                	sub    %esi,%edi
+f0109490:	0f 95 c1             	setne  %cl
+f0109493:	0f b6 c9             	movzbl %cl,%ecx
+f0109496:	8b 15 bc 17 84 f0    	mov    0xf08417bc,%edx
+f010949c:	66 89 4c 02 0c       	mov    %cx,0xc(%edx,%eax,1)
+	} while (length > 0);
+f01094a1:	0f 85 75 ff ff ff    	jne    f010941c <vnet_tx_copy+0xcc>
+}
+f01094a7:	0f b7 75 de          	movzwl -0x22(%ebp),%esi
+f01094ab:	89 f0                	mov    %esi,%eax
+f01094ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01094b0:	5b                   	pop    %ebx
+f01094b1:	5e                   	pop    %esi
+f01094b2:	5f                   	pop    %edi
+f01094b3:	5d                   	pop    %ebp
+f01094b4:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01094b5:	53                   	push   %ebx
+f01094b6:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f01094bb:	68 b6 00 00 00       	push   $0xb6
+f01094c0:	68 6d c9 10 f0       	push   $0xf010c96d
+f01094c5:	e8 7f 6b ff ff       	call   f0100049 <_panic>
+f01094ca:	52                   	push   %edx
+f01094cb:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f01094d0:	68 bd 00 00 00       	push   $0xbd
+f01094d5:	68 6d c9 10 f0       	push   $0xf010c96d
+f01094da:	e8 6a 6b ff ff       	call   f0100049 <_panic>
+
+f01094df <vnet_tx_reclaim>:
+{
+f01094df:	55                   	push   %ebp
+f01094e0:	89 e5                	mov    %esp,%ebp
+f01094e2:	57                   	push   %edi
+f01094e3:	56                   	push   %esi
+f01094e4:	53                   	push   %ebx
+f01094e5:	83 ec 0c             	sub    $0xc,%esp
+	while (vq->last_used != vq_used_idx(vq)) {
+f01094e8:	eb 66                	jmp    f0109550 <vnet_tx_reclaim+0x71>
+				page_decref(vnet_tx_pages[d]);
+f01094ea:	83 ec 0c             	sub    $0xc,%esp
+f01094ed:	50                   	push   %eax
+f01094ee:	e8 28 84 ff ff       	call   f010191b <page_decref>
+				vnet_tx_pages[d] = NULL;
+f01094f3:	c7 04 bd 20 04 84 f0 	movl   $0x0,-0xf7bfbe0(,%edi,4)
+f01094fa:	00 00 00 00 
+f01094fe:	83 c4 10             	add    $0x10,%esp
+			vq->nfree++;
+f0109501:	66 83 05 cc 17 84 f0 	addw   $0x1,0xf08417cc
+f0109508:	01 
+			if (!(vq->desc[d].flags & VRING_DESC_F_NEXT))
+f0109509:	0f b7 db             	movzwl %bx,%ebx
+f010950c:	c1 e3 04             	shl    $0x4,%ebx
+f010950f:	03 1d bc 17 84 f0    	add    0xf08417bc,%ebx
+f0109515:	f6 43 0c 01          	testb  $0x1,0xc(%ebx)
+f0109519:	74 14                	je     f010952f <vnet_tx_reclaim+0x50>
+		for (d = head; ; d = vq->desc[d].next) {
+f010951b:	0f b7 5b 0e          	movzwl 0xe(%ebx),%ebx
+			if (vnet_tx_pages[d]) {
+f010951f:	0f b7 fb             	movzwl %bx,%edi
+f0109522:	8b 04 bd 20 04 84 f0 	mov    -0xf7bfbe0(,%edi,4),%eax
+f0109529:	85 c0                	test   %eax,%eax
+f010952b:	75 bd                	jne    f01094ea <vnet_tx_reclaim+0xb>
+f010952d:	eb d2                	jmp    f0109501 <vnet_tx_reclaim+0x22>
+		vq->desc[d].next = vq->free_head;
+f010952f:	0f b7 05 ca 17 84 f0 	movzwl 0xf08417ca,%eax
+f0109536:	66 89 43 0e          	mov    %ax,0xe(%ebx)
+		vq->free_head = head;
+f010953a:	66 89 35 ca 17 84 f0 	mov    %si,0xf08417ca
+		vq->last_used++;
+f0109541:	66 83 05 c8 17 84 f0 	addw   $0x1,0xf08417c8
+f0109548:	01 
+		vnet_tx_done++;
+f0109549:	83 05 00 00 84 f0 01 	addl   $0x1,0xf0840000
+	while (vq->last_used != vq_used_idx(vq)) {
+f0109550:	0f b7 05 c8 17 84 f0 	movzwl 0xf08417c8,%eax
+	return *(volatile uint16_t *) &vq->used->idx;
+f0109557:	8b 0d c4 17 84 f0    	mov    0xf08417c4,%ecx
+f010955d:	0f b7 51 02          	movzwl 0x2(%ecx),%edx
+	while (vq->last_used != vq_used_idx(vq)) {
+f0109561:	66 39 d0             	cmp    %dx,%ax
+f0109564:	74 17                	je     f010957d <vnet_tx_reclaim+0x9e>
+		head = vq->used->ring[vq->last_used % vq->num].id;
+f0109566:	ba 00 00 00 00       	mov    $0x0,%edx
+f010956b:	66 f7 35 b8 17 84 f0 	divw   0xf08417b8
+f0109572:	0f b7 d2             	movzwl %dx,%edx
+f0109575:	8b 74 d1 04          	mov    0x4(%ecx,%edx,8),%esi
+		for (d = head; ; d = vq->desc[d].next) {
+f0109579:	89 f3                	mov    %esi,%ebx
+f010957b:	eb a2                	jmp    f010951f <vnet_tx_reclaim+0x40>
+}
+f010957d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109580:	5b                   	pop    %ebx
+f0109581:	5e                   	pop    %esi
+f0109582:	5f                   	pop    %edi
+f0109583:	5d                   	pop    %ebp
+f0109584:	c3                   	ret
+
+f0109585 <vnet_tx_done_count>:
+{
+f0109585:	55                   	push   %ebp
+f0109586:	89 e5                	mov    %esp,%ebp
+f0109588:	83 ec 08             	sub    $0x8,%esp
+	vnet_tx_reclaim();
+f010958b:	e8 4f ff ff ff       	call   f01094df <vnet_tx_reclaim>
+}
+f0109590:	a1 00 00 84 f0       	mov    0xf0840000,%eax
+f0109595:	c9                   	leave
+f0109596:	c3                   	ret
+
+f0109597 <vnet_tx_frags>:
+{
+f0109597:	55                   	push   %ebp
+f0109598:	89 e5                	mov    %esp,%ebp
+f010959a:	57                   	push   %edi
+f010959b:	56                   	push   %esi
+f010959c:	53                   	push   %ebx
+f010959d:	83 ec 1c             	sub    $0x1c,%esp
+f01095a0:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uint16_t idx = vq->avail->idx, head, d;
+f01095a3:	a1 c0 17 84 f0       	mov    0xf08417c0,%eax
+f01095a8:	0f b7 40 02          	movzwl 0x2(%eax),%eax
+f01095ac:	66 89 45 dc          	mov    %ax,-0x24(%ebp)
+	vnet_tx_reclaim();
+f01095b0:	e8 2a ff ff ff       	call   f01094df <vnet_tx_reclaim>
+	if (n <= 0 || vq->nfree < n + 1)
+f01095b5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f01095b9:	0f 8e a6 03 00 00    	jle    f0109965 <vnet_tx_frags+0x3ce>
+f01095bf:	0f b7 35 cc 17 84 f0 	movzwl 0xf08417cc,%esi
+f01095c6:	0f b7 c6             	movzwl %si,%eax
+f01095c9:	3b 45 0c             	cmp    0xc(%ebp),%eax
+f01095cc:	0f 8e 9f 03 00 00    	jle    f0109971 <vnet_tx_frags+0x3da>
+f01095d2:	8d 47 06             	lea    0x6(%edi),%eax
+f01095d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01095d8:	8d 0c d8             	lea    (%eax,%ebx,8),%ecx
+	size_t length = 0;
+f01095db:	ba 00 00 00 00       	mov    $0x0,%edx
+f01095e0:	eb 08                	jmp    f01095ea <vnet_tx_frags+0x53>
+		length += frags[i].len;
+f01095e2:	0f b7 18             	movzwl (%eax),%ebx
+f01095e5:	01 da                	add    %ebx,%edx
+	for (int i = 0; i < n; i++)
+f01095e7:	83 c0 08             	add    $0x8,%eax
+f01095ea:	39 c8                	cmp    %ecx,%eax
+f01095ec:	75 f4                	jne    f01095e2 <vnet_tx_frags+0x4b>
+	head = vq_chain(vq, n + 1);
+f01095ee:	89 55 d8             	mov    %edx,-0x28(%ebp)
+f01095f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01095f4:	83 c0 01             	add    $0x1,%eax
+f01095f7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint16_t head = vq->free_head, d = head;
+f01095fa:	0f b7 05 ca 17 84 f0 	movzwl 0xf08417ca,%eax
+f0109601:	66 89 45 de          	mov    %ax,-0x22(%ebp)
+		d = vq->desc[d].next;
+f0109605:	8b 0d bc 17 84 f0    	mov    0xf08417bc,%ecx
+f010960b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010960e:	83 c3 01             	add    $0x1,%ebx
+	for (int i = 1; i < n; i++)
+f0109611:	ba 01 00 00 00       	mov    $0x1,%edx
+		d = vq->desc[d].next;
+f0109616:	0f b7 c0             	movzwl %ax,%eax
+f0109619:	c1 e0 04             	shl    $0x4,%eax
+f010961c:	0f b7 44 01 0e       	movzwl 0xe(%ecx,%eax,1),%eax
+	for (int i = 1; i < n; i++)
+f0109621:	83 c2 01             	add    $0x1,%edx
+f0109624:	39 da                	cmp    %ebx,%edx
+f0109626:	75 ee                	jne    f0109616 <vnet_tx_frags+0x7f>
+	vq->free_head = vq->desc[d].next;
+f0109628:	0f b7 c0             	movzwl %ax,%eax
+f010962b:	c1 e0 04             	shl    $0x4,%eax
+f010962e:	0f b7 44 01 0e       	movzwl 0xe(%ecx,%eax,1),%eax
+f0109633:	66 a3 ca 17 84 f0    	mov    %ax,0xf08417ca
+	vq->nfree -= n;
+f0109639:	66 2b 75 e4          	sub    -0x1c(%ebp),%si
+f010963d:	66 89 35 cc 17 84 f0 	mov    %si,0xf08417cc
+	memset(&vnet_tx_hdr[head], 0, sizeof(vnet_tx_hdr[head]));
+f0109644:	0f b7 45 de          	movzwl -0x22(%ebp),%eax
+f0109648:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f010964b:	8d b4 00 20 08 84 f0 	lea    -0xf7bf7e0(%eax,%eax,1),%esi
+f0109652:	83 ec 04             	sub    $0x4,%esp
+f0109655:	6a 0a                	push   $0xa
+f0109657:	6a 00                	push   $0x0
+f0109659:	56                   	push   %esi
+f010965a:	e8 a7 d7 ff ff       	call   f0106e06 <memset>
+	if (off)
+f010965f:	83 c4 10             	add    $0x10,%esp
+f0109662:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0109666:	74 62                	je     f01096ca <vnet_tx_frags+0x133>
+	if (off->no_flags & NET_CSUM_IP) {
+f0109668:	8b 45 10             	mov    0x10(%ebp),%eax
+f010966b:	f6 00 01             	testb  $0x1,(%eax)
+f010966e:	0f 85 92 01 00 00    	jne    f0109806 <vnet_tx_frags+0x26f>
+	if (!(off->no_flags & NET_CSUM_L4))
+f0109674:	8b 45 10             	mov    0x10(%ebp),%eax
+f0109677:	f6 00 02             	testb  $0x2,(%eax)
+f010967a:	74 4e                	je     f01096ca <vnet_tx_frags+0x133>
+	memset(&vnet_tx_hdr[head], 0, sizeof(vnet_tx_hdr[head]));
+f010967c:	0f b7 5d de          	movzwl -0x22(%ebp),%ebx
+	if (vnet_features & VIRTIO_NET_F_CSUM) {
+f0109680:	f6 05 00 80 84 f0 01 	testb  $0x1,0xf0848000
+f0109687:	0f 84 c4 01 00 00    	je     f0109851 <vnet_tx_frags+0x2ba>
+		hdr->flags = VIRTIO_NET_HDR_F_NEEDS_CSUM;
+f010968d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+f0109690:	01 c0                	add    %eax,%eax
+f0109692:	8d 90 20 08 84 f0    	lea    -0xf7bf7e0(%eax),%edx
+f0109698:	c6 80 20 08 84 f0 01 	movb   $0x1,-0xf7bf7e0(%eax)
+		hdr->csum_start = off->no_l4hdr;
+f010969f:	8b 45 10             	mov    0x10(%ebp),%eax
+f01096a2:	0f b6 40 02          	movzbl 0x2(%eax),%eax
+f01096a6:	66 89 42 06          	mov    %ax,0x6(%edx)
+		hdr->csum_offset = off->no_l4csum - off->no_l4hdr;
+f01096aa:	8b 45 10             	mov    0x10(%ebp),%eax
+f01096ad:	0f b6 40 03          	movzbl 0x3(%eax),%eax
+f01096b1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f01096b4:	0f b6 49 02          	movzbl 0x2(%ecx),%ecx
+f01096b8:	29 c8                	sub    %ecx,%eax
+f01096ba:	66 89 42 08          	mov    %ax,0x8(%edx)
+	if (off->no_flags & NET_TSO) {
+f01096be:	8b 45 10             	mov    0x10(%ebp),%eax
+f01096c1:	f6 00 04             	testb  $0x4,(%eax)
+f01096c4:	0f 85 e7 01 00 00    	jne    f01098b1 <vnet_tx_frags+0x31a>
+	if ((uint32_t)kva < KERNBASE)
+f01096ca:	81 fe ff ff ff ef    	cmp    $0xefffffff,%esi
+f01096d0:	0f 86 7a 02 00 00    	jbe    f0109950 <vnet_tx_frags+0x3b9>
+	vq->desc[head].addr = PADDR(&vnet_tx_hdr[head]);
+f01096d6:	0f b7 5d de          	movzwl -0x22(%ebp),%ebx
+f01096da:	0f b7 c3             	movzwl %bx,%eax
+f01096dd:	c1 e0 04             	shl    $0x4,%eax
+	return (physaddr_t)kva - KERNBASE;
+f01096e0:	81 c6 00 00 00 10    	add    $0x10000000,%esi
+f01096e6:	8b 15 bc 17 84 f0    	mov    0xf08417bc,%edx
+f01096ec:	89 34 02             	mov    %esi,(%edx,%eax,1)
+f01096ef:	c7 44 02 04 00 00 00 	movl   $0x0,0x4(%edx,%eax,1)
+f01096f6:	00 
+	vq->desc[head].len = sizeof(vnet_tx_hdr[head]);
+f01096f7:	8b 15 bc 17 84 f0    	mov    0xf08417bc,%edx
+f01096fd:	c7 44 02 08 0a 00 00 	movl   $0xa,0x8(%edx,%eax,1)
+f0109704:	00 
+	vq->desc[head].flags = VRING_DESC_F_NEXT;
+f0109705:	8b 15 bc 17 84 f0    	mov    0xf08417bc,%edx
+f010970b:	66 c7 44 02 0c 01 00 	movw   $0x1,0xc(%edx,%eax,1)
+	d = head;
+f0109712:	66 89 5d e4          	mov    %bx,-0x1c(%ebp)
+	for (int i = 0; i < n; i++) {
+f0109716:	ba 00 00 00 00       	mov    $0x0,%edx
+		vq->desc[d].flags = i < n - 1 ? VRING_DESC_F_NEXT : 0;
+f010971b:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010971e:	83 e8 01             	sub    $0x1,%eax
+f0109721:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		d = vq->desc[d].next;
+f0109724:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+f0109728:	c1 e0 04             	shl    $0x4,%eax
+f010972b:	8b 1d bc 17 84 f0    	mov    0xf08417bc,%ebx
+f0109731:	0f b7 44 03 0e       	movzwl 0xe(%ebx,%eax,1),%eax
+f0109736:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+		vq->desc[d].addr = page2pa(frags[i].pp) + frags[i].off;
+f010973a:	0f b7 d8             	movzwl %ax,%ebx
+f010973d:	89 d9                	mov    %ebx,%ecx
+f010973f:	c1 e1 04             	shl    $0x4,%ecx
+	return (pp - pool.pages) << PGSHIFT;
+f0109742:	8b 04 d7             	mov    (%edi,%edx,8),%eax
+f0109745:	be 60 c2 7f f0       	mov    $0xf07fc260,%esi
+f010974a:	2b 46 08             	sub    0x8(%esi),%eax
+f010974d:	c1 f8 02             	sar    $0x2,%eax
+f0109750:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0109756:	c1 e0 0c             	shl    $0xc,%eax
+f0109759:	0f b7 74 d7 04       	movzwl 0x4(%edi,%edx,8),%esi
+f010975e:	01 f0                	add    %esi,%eax
+f0109760:	8b 35 bc 17 84 f0    	mov    0xf08417bc,%esi
+f0109766:	89 04 0e             	mov    %eax,(%esi,%ecx,1)
+f0109769:	c7 44 0e 04 00 00 00 	movl   $0x0,0x4(%esi,%ecx,1)
+f0109770:	00 
+		vq->desc[d].len = frags[i].len;
+f0109771:	0f b7 74 d7 06       	movzwl 0x6(%edi,%edx,8),%esi
+f0109776:	a1 bc 17 84 f0       	mov    0xf08417bc,%eax
+f010977b:	89 74 08 08          	mov    %esi,0x8(%eax,%ecx,1)
+		vq->desc[d].flags = i < n - 1 ? VRING_DESC_F_NEXT : 0;
+f010977f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0109782:	39 c2                	cmp    %eax,%edx
+f0109784:	0f 9c c0             	setl   %al
+f0109787:	0f b6 c0             	movzbl %al,%eax
+f010978a:	8b 35 bc 17 84 f0    	mov    0xf08417bc,%esi
+f0109790:	66 89 44 0e 0c       	mov    %ax,0xc(%esi,%ecx,1)
+		frags[i].pp->pp_ref++;
+f0109795:	8b 04 d7             	mov    (%edi,%edx,8),%eax
+f0109798:	66 83 40 08 01       	addw   $0x1,0x8(%eax)
+		vnet_tx_pages[d] = frags[i].pp;
+f010979d:	8b 04 d7             	mov    (%edi,%edx,8),%eax
+f01097a0:	89 04 9d 20 04 84 f0 	mov    %eax,-0xf7bfbe0(,%ebx,4)
+	for (int i = 0; i < n; i++) {
+f01097a7:	83 c2 01             	add    $0x1,%edx
+f01097aa:	39 55 0c             	cmp    %edx,0xc(%ebp)
+f01097ad:	0f 85 71 ff ff ff    	jne    f0109724 <vnet_tx_frags+0x18d>
+	vq->avail->ring[idx++ % vq->num] = head;
+f01097b3:	0f b7 45 dc          	movzwl -0x24(%ebp),%eax
+f01097b7:	ba 00 00 00 00       	mov    $0x0,%edx
+f01097bc:	66 f7 35 b8 17 84 f0 	divw   0xf08417b8
+f01097c3:	0f b7 d2             	movzwl %dx,%edx
+f01097c6:	a1 c0 17 84 f0       	mov    0xf08417c0,%eax
+f01097cb:	0f b7 7d de          	movzwl -0x22(%ebp),%edi
+f01097cf:	66 89 7c 50 04       	mov    %di,0x4(%eax,%edx,2)
+	*seq = vnet_tx_seq++;
+f01097d4:	a1 04 00 84 f0       	mov    0xf0840004,%eax
+f01097d9:	8d 50 01             	lea    0x1(%eax),%edx
+f01097dc:	89 15 04 00 84 f0    	mov    %edx,0xf0840004
+f01097e2:	8b 55 14             	mov    0x14(%ebp),%edx
+f01097e5:	89 02                	mov    %eax,(%edx)
+	vq->avail->ring[idx++ % vq->num] = head;
+f01097e7:	0f b7 55 dc          	movzwl -0x24(%ebp),%edx
+f01097eb:	83 c2 01             	add    $0x1,%edx
+	vq_publish(VQ_TX, idx);
+f01097ee:	0f b7 d2             	movzwl %dx,%edx
+f01097f1:	b8 01 00 00 00       	mov    $0x1,%eax
+f01097f6:	e8 19 f4 ff ff       	call   f0108c14 <vq_publish>
+}
+f01097fb:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f01097fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109801:	5b                   	pop    %ebx
+f0109802:	5e                   	pop    %esi
+f0109803:	5f                   	pop    %edi
+f0109804:	5d                   	pop    %ebp
+f0109805:	c3                   	ret
+		frags_put16(frags, n, off->no_iphdr + 10, 0);
+f0109806:	0f b6 48 01          	movzbl 0x1(%eax),%ecx
+f010980a:	83 c1 0a             	add    $0xa,%ecx
+f010980d:	83 ec 0c             	sub    $0xc,%esp
+f0109810:	6a 00                	push   $0x0
+f0109812:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0109815:	89 f8                	mov    %edi,%eax
+f0109817:	e8 5c f7 ff ff       	call   f0108f78 <frags_put16>
+			    frags_csum(frags, n, off->no_iphdr, off->no_l4hdr));
+f010981c:	8b 45 10             	mov    0x10(%ebp),%eax
+f010981f:	0f b6 58 01          	movzbl 0x1(%eax),%ebx
+f0109823:	0f b6 40 02          	movzbl 0x2(%eax),%eax
+f0109827:	89 04 24             	mov    %eax,(%esp)
+f010982a:	89 d9                	mov    %ebx,%ecx
+f010982c:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010982f:	89 f8                	mov    %edi,%eax
+f0109831:	e8 b5 f5 ff ff       	call   f0108deb <frags_csum>
+		frags_put16(frags, n, off->no_iphdr + 10,
+f0109836:	8d 4b 0a             	lea    0xa(%ebx),%ecx
+f0109839:	0f b7 c0             	movzwl %ax,%eax
+f010983c:	89 04 24             	mov    %eax,(%esp)
+f010983f:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0109842:	89 f8                	mov    %edi,%eax
+f0109844:	e8 2f f7 ff ff       	call   f0108f78 <frags_put16>
+f0109849:	83 c4 10             	add    $0x10,%esp
+f010984c:	e9 23 fe ff ff       	jmp    f0109674 <vnet_tx_frags+0xdd>
+		csum = frags_csum(frags, n, off->no_l4hdr, length);
+f0109851:	8b 45 10             	mov    0x10(%ebp),%eax
+f0109854:	0f b6 48 02          	movzbl 0x2(%eax),%ecx
+f0109858:	83 ec 0c             	sub    $0xc,%esp
+f010985b:	ff 75 d8             	push   -0x28(%ebp)
+f010985e:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0109861:	89 f8                	mov    %edi,%eax
+f0109863:	e8 83 f5 ff ff       	call   f0108deb <frags_csum>
+f0109868:	83 c4 10             	add    $0x10,%esp
+		if (csum == 0 && *frags_byte(frags, n, off->no_iphdr + 9) == 17)
+f010986b:	66 85 c0             	test   %ax,%ax
+f010986e:	74 20                	je     f0109890 <vnet_tx_frags+0x2f9>
+		frags_put16(frags, n, off->no_l4csum, csum);
+f0109870:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0109873:	0f b6 49 03          	movzbl 0x3(%ecx),%ecx
+f0109877:	83 ec 0c             	sub    $0xc,%esp
+f010987a:	0f b7 c0             	movzwl %ax,%eax
+f010987d:	50                   	push   %eax
+f010987e:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0109881:	89 f8                	mov    %edi,%eax
+f0109883:	e8 f0 f6 ff ff       	call   f0108f78 <frags_put16>
+f0109888:	83 c4 10             	add    $0x10,%esp
+f010988b:	e9 2e fe ff ff       	jmp    f01096be <vnet_tx_frags+0x127>
+		if (csum == 0 && *frags_byte(frags, n, off->no_iphdr + 9) == 17)
+f0109890:	8b 45 10             	mov    0x10(%ebp),%eax
+f0109893:	0f b6 48 01          	movzbl 0x1(%eax),%ecx
+f0109897:	83 c1 09             	add    $0x9,%ecx
+f010989a:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010989d:	89 f8                	mov    %edi,%eax
+f010989f:	e8 4b f6 ff ff       	call   f0108eef <frags_byte>
+f01098a4:	80 38 11             	cmpb   $0x11,(%eax)
+f01098a7:	0f 94 c0             	sete   %al
+f01098aa:	0f b6 c0             	movzbl %al,%eax
+f01098ad:	f7 d8                	neg    %eax
+f01098af:	eb bf                	jmp    f0109870 <vnet_tx_frags+0x2d9>
+		sum = *frags_byte(frags, n, off->no_l4csum) << 8
+f01098b1:	0f b6 40 03          	movzbl 0x3(%eax),%eax
+f01098b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01098b8:	89 c1                	mov    %eax,%ecx
+f01098ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01098bd:	89 f8                	mov    %edi,%eax
+f01098bf:	e8 2b f6 ff ff       	call   f0108eef <frags_byte>
+f01098c4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+			| *frags_byte(frags, n, off->no_l4csum + 1);
+f01098c7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01098ca:	83 c1 01             	add    $0x1,%ecx
+f01098cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01098d0:	89 f8                	mov    %edi,%eax
+f01098d2:	e8 18 f6 ff ff       	call   f0108eef <frags_byte>
+f01098d7:	89 c2                	mov    %eax,%edx
+		sum = *frags_byte(frags, n, off->no_l4csum) << 8
+f01098d9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01098dc:	0f b6 00             	movzbl (%eax),%eax
+f01098df:	c1 e0 08             	shl    $0x8,%eax
+			| *frags_byte(frags, n, off->no_l4csum + 1);
+f01098e2:	0f b6 12             	movzbl (%edx),%edx
+f01098e5:	09 c2                	or     %eax,%edx
+		sum += length - off->no_l4hdr;
+f01098e7:	8b 45 10             	mov    0x10(%ebp),%eax
+f01098ea:	0f b6 48 02          	movzbl 0x2(%eax),%ecx
+f01098ee:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f01098f1:	29 c8                	sub    %ecx,%eax
+f01098f3:	01 d0                	add    %edx,%eax
+		while (sum >> 16)
+f01098f5:	89 c2                	mov    %eax,%edx
+f01098f7:	c1 ea 10             	shr    $0x10,%edx
+f01098fa:	74 07                	je     f0109903 <vnet_tx_frags+0x36c>
+			sum = (sum & 0xFFFF) + (sum >> 16);
+f01098fc:	0f b7 c0             	movzwl %ax,%eax
+f01098ff:	01 d0                	add    %edx,%eax
+f0109901:	eb f2                	jmp    f01098f5 <vnet_tx_frags+0x35e>
+		frags_put16(frags, n, off->no_l4csum, sum);
+f0109903:	83 ec 0c             	sub    $0xc,%esp
+f0109906:	0f b7 c0             	movzwl %ax,%eax
+f0109909:	50                   	push   %eax
+f010990a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f010990d:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0109910:	89 f8                	mov    %edi,%eax
+f0109912:	e8 61 f6 ff ff       	call   f0108f78 <frags_put16>
+		hdr->gso_type = VIRTIO_NET_HDR_GSO_TCPV4;
+f0109917:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+f010991e:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+f0109921:	8d 94 12 20 08 84 f0 	lea    -0xf7bf7e0(%edx,%edx,1),%edx
+f0109928:	c6 42 01 01          	movb   $0x1,0x1(%edx)
+		hdr->hdr_len = off->no_hdrlen;
+f010992c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f010992f:	0f b6 49 04          	movzbl 0x4(%ecx),%ecx
+f0109933:	66 89 4a 02          	mov    %cx,0x2(%edx)
+		hdr->gso_size = off->no_mss;
+f0109937:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f010993a:	0f b7 51 06          	movzwl 0x6(%ecx),%edx
+f010993e:	01 d8                	add    %ebx,%eax
+f0109940:	66 89 94 00 24 08 84 	mov    %dx,-0xf7bf7dc(%eax,%eax,1)
+f0109947:	f0 
+f0109948:	83 c4 10             	add    $0x10,%esp
+f010994b:	e9 7a fd ff ff       	jmp    f01096ca <vnet_tx_frags+0x133>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0109950:	56                   	push   %esi
+f0109951:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0109956:	68 50 01 00 00       	push   $0x150
+f010995b:	68 6d c9 10 f0       	push   $0xf010c96d
+f0109960:	e8 e4 66 ff ff       	call   f0100049 <_panic>
+		return 0;
+f0109965:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+f010996c:	e9 8a fe ff ff       	jmp    f01097fb <vnet_tx_frags+0x264>
+f0109971:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+f0109978:	e9 7e fe ff ff       	jmp    f01097fb <vnet_tx_frags+0x264>
+
+f010997d <vnet_tx_batch>:
+{
+f010997d:	55                   	push   %ebp
+f010997e:	89 e5                	mov    %esp,%ebp
+f0109980:	57                   	push   %edi
+f0109981:	56                   	push   %esi
+f0109982:	53                   	push   %ebx
+f0109983:	83 ec 1c             	sub    $0x1c,%esp
+f0109986:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uint16_t idx = vq->avail->idx, head;
+f0109989:	a1 c0 17 84 f0       	mov    0xf08417c0,%eax
+f010998e:	0f b7 40 02          	movzwl 0x2(%eax),%eax
+f0109992:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+	vnet_tx_reclaim();
+f0109996:	e8 44 fb ff ff       	call   f01094df <vnet_tx_reclaim>
+	for (i = 0; i < n
+f010999b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		    && vq->nfree >= VNET_TX_COPY_DESCS(pkts[i].sg_len); i++) {
+f01099a0:	be a0 17 84 f0       	mov    $0xf08417a0,%esi
+	for (i = 0; i < n
+f01099a5:	eb 2e                	jmp    f01099d5 <vnet_tx_batch+0x58>
+		head = vnet_tx_copy(pkts[i].sg_va, pkts[i].sg_len);
+f01099a7:	8b 04 df             	mov    (%edi,%ebx,8),%eax
+f01099aa:	89 ca                	mov    %ecx,%edx
+f01099ac:	e8 9f f9 ff ff       	call   f0109350 <vnet_tx_copy>
+f01099b1:	89 c1                	mov    %eax,%ecx
+		vq->avail->ring[idx++ % vq->num] = head;
+f01099b3:	0f b7 45 e6          	movzwl -0x1a(%ebp),%eax
+f01099b7:	ba 00 00 00 00       	mov    $0x0,%edx
+f01099bc:	66 f7 76 18          	divw   0x18(%esi)
+f01099c0:	0f b7 d2             	movzwl %dx,%edx
+f01099c3:	8b 46 20             	mov    0x20(%esi),%eax
+f01099c6:	66 89 4c 50 04       	mov    %cx,0x4(%eax,%edx,2)
+		vnet_tx_seq++;
+f01099cb:	83 05 04 00 84 f0 01 	addl   $0x1,0xf0840004
+		    && vq->nfree >= VNET_TX_COPY_DESCS(pkts[i].sg_len); i++) {
+f01099d2:	83 c3 01             	add    $0x1,%ebx
+f01099d5:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+f01099d9:	01 d8                	add    %ebx,%eax
+f01099db:	66 89 45 e6          	mov    %ax,-0x1a(%ebp)
+f01099df:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+f01099e2:	7d 25                	jge    f0109a09 <vnet_tx_batch+0x8c>
+f01099e4:	8b 4c df 04          	mov    0x4(%edi,%ebx,8),%ecx
+f01099e8:	0f b7 46 2c          	movzwl 0x2c(%esi),%eax
+f01099ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01099ef:	8d 91 ed 05 00 00    	lea    0x5ed(%ecx),%edx
+f01099f5:	d1 ea                	shr    %edx
+f01099f7:	b8 71 5e 58 56       	mov    $0x56585e71,%eax
+f01099fc:	f7 e2                	mul    %edx
+f01099fe:	c1 ea 08             	shr    $0x8,%edx
+f0109a01:	83 c2 01             	add    $0x1,%edx
+f0109a04:	39 55 e0             	cmp    %edx,-0x20(%ebp)
+f0109a07:	73 9e                	jae    f01099a7 <vnet_tx_batch+0x2a>
+	if (i > 0)
+f0109a09:	85 db                	test   %ebx,%ebx
+f0109a0b:	7f 0a                	jg     f0109a17 <vnet_tx_batch+0x9a>
+}
+f0109a0d:	89 d8                	mov    %ebx,%eax
+f0109a0f:	83 c4 1c             	add    $0x1c,%esp
+f0109a12:	5b                   	pop    %ebx
+f0109a13:	5e                   	pop    %esi
+f0109a14:	5f                   	pop    %edi
+f0109a15:	5d                   	pop    %ebp
+f0109a16:	c3                   	ret
+		vq_publish(VQ_TX, idx);
+f0109a17:	0f b7 55 e6          	movzwl -0x1a(%ebp),%edx
+f0109a1b:	b8 01 00 00 00       	mov    $0x1,%eax
+f0109a20:	e8 ef f1 ff ff       	call   f0108c14 <vq_publish>
+	return i;
+f0109a25:	eb e6                	jmp    f0109a0d <vnet_tx_batch+0x90>
+
+f0109a27 <vnet_tx>:
+{
+f0109a27:	55                   	push   %ebp
+f0109a28:	89 e5                	mov    %esp,%ebp
+f0109a2a:	57                   	push   %edi
+f0109a2b:	56                   	push   %esi
+f0109a2c:	53                   	push   %ebx
+f0109a2d:	83 ec 0c             	sub    $0xc,%esp
+f0109a30:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	uint16_t idx = vq->avail->idx, head;
+f0109a33:	a1 c0 17 84 f0       	mov    0xf08417c0,%eax
+f0109a38:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+	length = MIN(length, NET_FRAME_MAX);
+f0109a3c:	b8 3a 23 00 00       	mov    $0x233a,%eax
+f0109a41:	39 c3                	cmp    %eax,%ebx
+f0109a43:	0f 47 d8             	cmova  %eax,%ebx
+	vnet_tx_reclaim();
+f0109a46:	e8 94 fa ff ff       	call   f01094df <vnet_tx_reclaim>
+	if (vq->nfree < VNET_TX_COPY_DESCS(length))
+f0109a4b:	0f b7 0d cc 17 84 f0 	movzwl 0xf08417cc,%ecx
+f0109a52:	8d 93 ed 05 00 00    	lea    0x5ed(%ebx),%edx
+f0109a58:	d1 ea                	shr    %edx
+f0109a5a:	bf 71 5e 58 56       	mov    $0x56585e71,%edi
+f0109a5f:	89 d0                	mov    %edx,%eax
+f0109a61:	f7 e7                	mul    %edi
+f0109a63:	c1 ea 08             	shr    $0x8,%edx
+f0109a66:	83 c2 01             	add    $0x1,%edx
+f0109a69:	39 d1                	cmp    %edx,%ecx
+f0109a6b:	73 0f                	jae    f0109a7c <vnet_tx+0x55>
+		return 0;
+f0109a6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f0109a72:	89 d8                	mov    %ebx,%eax
+f0109a74:	83 c4 0c             	add    $0xc,%esp
+f0109a77:	5b                   	pop    %ebx
+f0109a78:	5e                   	pop    %esi
+f0109a79:	5f                   	pop    %edi
+f0109a7a:	5d                   	pop    %ebp
+f0109a7b:	c3                   	ret
+	head = vnet_tx_copy(packet, length);
+f0109a7c:	89 da                	mov    %ebx,%edx
+f0109a7e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109a81:	e8 ca f8 ff ff       	call   f0109350 <vnet_tx_copy>
+f0109a86:	89 c1                	mov    %eax,%ecx
+	vq->avail->ring[idx++ % vq->num] = head;
+f0109a88:	89 f0                	mov    %esi,%eax
+f0109a8a:	ba 00 00 00 00       	mov    $0x0,%edx
+f0109a8f:	66 f7 35 b8 17 84 f0 	divw   0xf08417b8
+f0109a96:	0f b7 d2             	movzwl %dx,%edx
+f0109a99:	a1 c0 17 84 f0       	mov    0xf08417c0,%eax
+f0109a9e:	66 89 4c 50 04       	mov    %cx,0x4(%eax,%edx,2)
+	vnet_tx_seq++;
+f0109aa3:	83 05 04 00 84 f0 01 	addl   $0x1,0xf0840004
+	vq->avail->ring[idx++ % vq->num] = head;
+f0109aaa:	8d 56 01             	lea    0x1(%esi),%edx
+	vq_publish(VQ_TX, idx);
+f0109aad:	0f b7 d2             	movzwl %dx,%edx
+f0109ab0:	b8 01 00 00 00       	mov    $0x1,%eax
+f0109ab5:	e8 5a f1 ff ff       	call   f0108c14 <vq_publish>
+	return length;
+f0109aba:	eb b6                	jmp    f0109a72 <vnet_tx+0x4b>
+
+f0109abc <vnet_intr>:
+// finds it drained.
+static void vnet_intr(void)
+{
+	uint32_t events = 0;
+
+	if (!(inb(vnet_io + VIRTIO_PCI_ISR) & VIRTIO_PCI_ISR_QUEUE))
+f0109abc:	a1 04 80 84 f0       	mov    0xf0848004,%eax
+f0109ac1:	8d 50 13             	lea    0x13(%eax),%edx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0109ac4:	ec                   	in     (%dx),%al
+f0109ac5:	a8 01                	test   $0x1,%al
+f0109ac7:	75 01                	jne    f0109aca <vnet_intr+0xe>
+f0109ac9:	c3                   	ret
+{
+f0109aca:	55                   	push   %ebp
+f0109acb:	89 e5                	mov    %esp,%ebp
+f0109acd:	53                   	push   %ebx
+f0109ace:	83 ec 04             	sub    $0x4,%esp
+	return *(volatile uint16_t *) &vq->used->idx;
+f0109ad1:	a1 ac 17 84 f0       	mov    0xf08417ac,%eax
+f0109ad6:	0f b7 40 02          	movzwl 0x2(%eax),%eax
+		return;
+	if (vnet_rx_ready()) {
+f0109ada:	66 39 05 b0 17 84 f0 	cmp    %ax,0xf08417b0
+f0109ae1:	75 39                	jne    f0109b1c <vnet_intr+0x60>
+	vnet_tx_reclaim();
+f0109ae3:	e8 f7 f9 ff ff       	call   f01094df <vnet_tx_reclaim>
+		vq_intr(VQ_RX, false);
+		events |= NET_WAIT_RX;
+	}
+	if (vnet_tx_ready()) {
+f0109ae8:	66 83 3d cc 17 84 f0 	cmpw   $0x6,0xf08417cc
+f0109aef:	06 
+f0109af0:	76 25                	jbe    f0109b17 <vnet_intr+0x5b>
+	uint32_t events = 0;
+f0109af2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		vq_intr(VQ_TX, false);
+f0109af7:	ba 00 00 00 00       	mov    $0x0,%edx
+f0109afc:	b8 01 00 00 00       	mov    $0x1,%eax
+f0109b01:	e8 43 f1 ff ff       	call   f0108c49 <vq_intr>
+		events |= NET_WAIT_TX;
+f0109b06:	89 d8                	mov    %ebx,%eax
+f0109b08:	83 c8 02             	or     $0x2,%eax
+	}
+	if (events)
+		net_wake(events);
+f0109b0b:	83 ec 0c             	sub    $0xc,%esp
+f0109b0e:	50                   	push   %eax
+f0109b0f:	e8 6f b8 ff ff       	call   f0105383 <net_wake>
+f0109b14:	83 c4 10             	add    $0x10,%esp
+}
+f0109b17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0109b1a:	c9                   	leave
+f0109b1b:	c3                   	ret
+		vq_intr(VQ_RX, false);
+f0109b1c:	ba 00 00 00 00       	mov    $0x0,%edx
+f0109b21:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109b26:	e8 1e f1 ff ff       	call   f0108c49 <vq_intr>
+	vnet_tx_reclaim();
+f0109b2b:	e8 af f9 ff ff       	call   f01094df <vnet_tx_reclaim>
+	if (vnet_tx_ready()) {
+f0109b30:	66 83 3d cc 17 84 f0 	cmpw   $0x6,0xf08417cc
+f0109b37:	06 
+f0109b38:	77 07                	ja     f0109b41 <vnet_intr+0x85>
+f0109b3a:	b8 01 00 00 00       	mov    $0x1,%eax
+f0109b3f:	eb ca                	jmp    f0109b0b <vnet_intr+0x4f>
+		events |= NET_WAIT_RX;
+f0109b41:	bb 01 00 00 00       	mov    $0x1,%ebx
+f0109b46:	eb af                	jmp    f0109af7 <vnet_intr+0x3b>
+
+f0109b48 <vnet_ready>:
+{
+f0109b48:	55                   	push   %ebp
+f0109b49:	89 e5                	mov    %esp,%ebp
+f0109b4b:	56                   	push   %esi
+f0109b4c:	53                   	push   %ebx
+f0109b4d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (events & NET_WAIT_RX) {
+f0109b50:	89 de                	mov    %ebx,%esi
+f0109b52:	83 e6 01             	and    $0x1,%esi
+f0109b55:	75 0b                	jne    f0109b62 <vnet_ready+0x1a>
+	if (events & NET_WAIT_TX) {
+f0109b57:	f6 c3 02             	test   $0x2,%bl
+f0109b5a:	75 43                	jne    f0109b9f <vnet_ready+0x57>
+}
+f0109b5c:	89 f0                	mov    %esi,%eax
+f0109b5e:	5b                   	pop    %ebx
+f0109b5f:	5e                   	pop    %esi
+f0109b60:	5d                   	pop    %ebp
+f0109b61:	c3                   	ret
+	return *(volatile uint16_t *) &vq->used->idx;
+f0109b62:	a1 ac 17 84 f0       	mov    0xf08417ac,%eax
+f0109b67:	0f b7 40 02          	movzwl 0x2(%eax),%eax
+		if (!vnet_rx_ready())
+f0109b6b:	66 39 05 b0 17 84 f0 	cmp    %ax,0xf08417b0
+f0109b72:	74 1a                	je     f0109b8e <vnet_ready+0x46>
+	return *(volatile uint16_t *) &vq->used->idx;
+f0109b74:	a1 ac 17 84 f0       	mov    0xf08417ac,%eax
+f0109b79:	0f b7 40 02          	movzwl 0x2(%eax),%eax
+		if (vnet_rx_ready())
+f0109b7d:	66 39 05 b0 17 84 f0 	cmp    %ax,0xf08417b0
+f0109b84:	0f 95 c0             	setne  %al
+f0109b87:	0f b6 c0             	movzbl %al,%eax
+f0109b8a:	89 c6                	mov    %eax,%esi
+f0109b8c:	eb c9                	jmp    f0109b57 <vnet_ready+0xf>
+			vq_intr(VQ_RX, true);
+f0109b8e:	ba 01 00 00 00       	mov    $0x1,%edx
+f0109b93:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109b98:	e8 ac f0 ff ff       	call   f0108c49 <vq_intr>
+f0109b9d:	eb d5                	jmp    f0109b74 <vnet_ready+0x2c>
+	vnet_tx_reclaim();
+f0109b9f:	e8 3b f9 ff ff       	call   f01094df <vnet_tx_reclaim>
+		if (!vnet_tx_ready())
+f0109ba4:	66 83 3d cc 17 84 f0 	cmpw   $0x6,0xf08417cc
+f0109bab:	06 
+f0109bac:	76 14                	jbe    f0109bc2 <vnet_ready+0x7a>
+	vnet_tx_reclaim();
+f0109bae:	e8 2c f9 ff ff       	call   f01094df <vnet_tx_reclaim>
+		if (vnet_tx_ready())
+f0109bb3:	66 83 3d cc 17 84 f0 	cmpw   $0x6,0xf08417cc
+f0109bba:	06 
+f0109bbb:	76 9f                	jbe    f0109b5c <vnet_ready+0x14>
+			ready |= NET_WAIT_TX;
+f0109bbd:	83 ce 02             	or     $0x2,%esi
+	return ready;
+f0109bc0:	eb 9a                	jmp    f0109b5c <vnet_ready+0x14>
+			vq_intr(VQ_TX, true);
+f0109bc2:	ba 01 00 00 00       	mov    $0x1,%edx
+f0109bc7:	b8 01 00 00 00       	mov    $0x1,%eax
+f0109bcc:	e8 78 f0 ff ff       	call   f0108c49 <vq_intr>
+f0109bd1:	eb db                	jmp    f0109bae <vnet_ready+0x66>
+
+f0109bd3 <pci_virtio_net_attach>:
+	.nd_intr = vnet_intr,
+};
+
+int
+pci_virtio_net_attach(struct pci_func *f)
+{
+f0109bd3:	55                   	push   %ebp
+f0109bd4:	89 e5                	mov    %esp,%ebp
+f0109bd6:	57                   	push   %edi
+f0109bd7:	56                   	push   %esi
+f0109bd8:	53                   	push   %ebx
+f0109bd9:	83 ec 38             	sub    $0x38,%esp
+f0109bdc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct virtq *vq;
+	uint32_t host;
+	int i, j, d;
+
+	pci_func_enable(f);
+f0109bdf:	53                   	push   %ebx
+f0109be0:	e8 b8 09 00 00       	call   f010a59d <pci_func_enable>
+	vnet_io = f->reg_base[0];
+f0109be5:	8b 43 14             	mov    0x14(%ebx),%eax
+f0109be8:	a3 04 80 84 f0       	mov    %eax,0xf0848004
+	outb(vnet_io + VIRTIO_PCI_STATUS, 0);
+f0109bed:	8d 50 12             	lea    0x12(%eax),%edx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0109bf0:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109bf5:	ee                   	out    %al,(%dx)
+	if (!vq_num(VQ_RX) || !vq_num(VQ_TX))
+f0109bf6:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109bfb:	e8 e8 ef ff ff       	call   f0108be8 <vq_num>
+f0109c00:	83 c4 10             	add    $0x10,%esp
+f0109c03:	66 85 c0             	test   %ax,%ax
+f0109c06:	0f 84 ae 02 00 00    	je     f0109eba <pci_virtio_net_attach+0x2e7>
+f0109c0c:	b8 01 00 00 00       	mov    $0x1,%eax
+f0109c11:	e8 d2 ef ff ff       	call   f0108be8 <vq_num>
+f0109c16:	66 85 c0             	test   %ax,%ax
+f0109c19:	0f 84 a2 02 00 00    	je     f0109ec1 <pci_virtio_net_attach+0x2ee>
+		return -E_NOT_SUPP;
+	if (!net_attach(&vnet_driver, f->irq_line))
+f0109c1f:	83 ec 08             	sub    $0x8,%esp
+f0109c22:	0f b6 43 44          	movzbl 0x44(%ebx),%eax
+f0109c26:	50                   	push   %eax
+f0109c27:	68 e0 64 11 f0       	push   $0xf01164e0
+f0109c2c:	e8 4c 03 00 00       	call   f0109f7d <net_attach>
+f0109c31:	83 c4 10             	add    $0x10,%esp
+f0109c34:	84 c0                	test   %al,%al
+f0109c36:	0f 84 8c 02 00 00    	je     f0109ec8 <pci_virtio_net_attach+0x2f5>
+		return 0;
+	outb(vnet_io + VIRTIO_PCI_STATUS, VIRTIO_CONFIG_S_ACKNOWLEDGE);
+f0109c3c:	8b 0d 04 80 84 f0    	mov    0xf0848004,%ecx
+f0109c42:	8d 51 12             	lea    0x12(%ecx),%edx
+f0109c45:	b8 01 00 00 00       	mov    $0x1,%eax
+f0109c4a:	ee                   	out    %al,(%dx)
+f0109c4b:	b8 03 00 00 00       	mov    $0x3,%eax
+f0109c50:	ee                   	out    %al,(%dx)
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+f0109c51:	89 ca                	mov    %ecx,%edx
+f0109c53:	ed                   	in     (%dx),%eax
+	outb(vnet_io + VIRTIO_PCI_STATUS,
+	     VIRTIO_CONFIG_S_ACKNOWLEDGE | VIRTIO_CONFIG_S_DRIVER);
+
+	// Segmentation needs the device to do checksums too.
+	host = inl(vnet_io + VIRTIO_PCI_HOST_FEATURES);
+	vnet_features = host & (VIRTIO_NET_F_CSUM | VIRTIO_NET_F_GUEST_CSUM
+f0109c54:	89 c3                	mov    %eax,%ebx
+f0109c56:	81 e3 23 08 00 00    	and    $0x823,%ebx
+f0109c5c:	89 c2                	mov    %eax,%edx
+f0109c5e:	83 e2 23             	and    $0x23,%edx
+f0109c61:	a8 01                	test   $0x1,%al
+f0109c63:	89 d8                	mov    %ebx,%eax
+f0109c65:	0f 44 c2             	cmove  %edx,%eax
+f0109c68:	a3 00 80 84 f0       	mov    %eax,0xf0848000
+				| VIRTIO_NET_F_MAC | VIRTIO_NET_F_HOST_TSO4);
+	if (!(vnet_features & VIRTIO_NET_F_CSUM))
+		vnet_features &= ~VIRTIO_NET_F_HOST_TSO4;
+	outl(vnet_io + VIRTIO_PCI_GUEST_FEATURES, vnet_features);
+f0109c6d:	8d 51 04             	lea    0x4(%ecx),%edx
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f0109c70:	ef                   	out    %eax,(%dx)
+	vnet_driver.nd_offloads = NET_CSUM_IP | NET_CSUM_L4;
+	if (vnet_features & VIRTIO_NET_F_HOST_TSO4)
+f0109c71:	25 00 08 00 00       	and    $0x800,%eax
+		vnet_driver.nd_offloads |= NET_TSO;
+f0109c76:	83 f8 01             	cmp    $0x1,%eax
+f0109c79:	19 c0                	sbb    %eax,%eax
+f0109c7b:	83 e0 fc             	and    $0xfffffffc,%eax
+f0109c7e:	83 c0 07             	add    $0x7,%eax
+f0109c81:	a3 e4 64 11 f0       	mov    %eax,0xf01164e4
+
+	vq_init(VQ_RX);
+f0109c86:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109c8b:	e8 3b f0 ff ff       	call   f0108ccb <vq_init>
+	vq_init(VQ_TX);
+f0109c90:	b8 01 00 00 00       	mov    $0x1,%eax
+f0109c95:	e8 31 f0 ff ff       	call   f0108ccb <vq_init>
+
+	vq = &vqs[VQ_RX];
+	for (i = 0; i < vq->num / VNET_RX_DESCS; i++) {
+f0109c9a:	bf 20 12 84 f0       	mov    $0xf0841220,%edi
+f0109c9f:	b8 20 12 84 00       	mov    $0x841220,%eax
+f0109ca4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0109ca7:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+f0109cae:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0109cb3:	ba 00 00 00 00       	mov    $0x0,%edx
+f0109cb8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+f0109cbb:	89 f8                	mov    %edi,%eax
+f0109cbd:	eb 53                	jmp    f0109d12 <pci_virtio_net_attach+0x13f>
+f0109cbf:	50                   	push   %eax
+f0109cc0:	68 c8 a9 10 f0       	push   $0xf010a9c8
+f0109cc5:	68 4a 02 00 00       	push   $0x24a
+f0109cca:	68 6d c9 10 f0       	push   $0xf010c96d
+f0109ccf:	e8 75 63 ff ff       	call   f0100049 <_panic>
+		vq->desc[d].len = sizeof(vnet_rx_hdr[i]);
+		vq->desc[d].flags = VRING_DESC_F_WRITE | VRING_DESC_F_NEXT;
+		vq->desc[d].next = d + 1;
+		for (j = 0; j < VNET_RX_PAGES; j++) {
+			if (!(vnet_rx_page[i][j] = page_alloc(0)))
+				panic("pci_virtio_net_attach: out of memory");
+f0109cd4:	83 ec 04             	sub    $0x4,%esp
+f0109cd7:	68 48 c9 10 f0       	push   $0xf010c948
+f0109cdc:	68 50 02 00 00       	push   $0x250
+f0109ce1:	68 6d c9 10 f0       	push   $0xf010c96d
+f0109ce6:	e8 5e 63 ff ff       	call   f0100049 <_panic>
+			if (j < VNET_RX_PAGES - 1) {
+				vq->desc[d].flags |= VRING_DESC_F_NEXT;
+				vq->desc[d].next = d + 1;
+			}
+		}
+		vq->avail->ring[i] = VNET_RX_DESCS * i;
+f0109ceb:	8b 55 d0             	mov    -0x30(%ebp),%edx
+f0109cee:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0109cf1:	8b 0d a8 17 84 f0    	mov    0xf08417a8,%ecx
+f0109cf7:	0f b7 7d d6          	movzwl -0x2a(%ebp),%edi
+f0109cfb:	66 89 7c 51 04       	mov    %di,0x4(%ecx,%edx,2)
+	for (i = 0; i < vq->num / VNET_RX_DESCS; i++) {
+f0109d00:	83 c2 01             	add    $0x1,%edx
+f0109d03:	83 45 e0 04          	addl   $0x4,-0x20(%ebp)
+f0109d07:	83 45 d8 0a          	addl   $0xa,-0x28(%ebp)
+f0109d0b:	83 55 dc 00          	adcl   $0x0,-0x24(%ebp)
+f0109d0f:	83 c0 0a             	add    $0xa,%eax
+f0109d12:	89 d1                	mov    %edx,%ecx
+f0109d14:	0f b7 1d a0 17 84 f0 	movzwl 0xf08417a0,%ebx
+f0109d1b:	66 c1 eb 02          	shr    $0x2,%bx
+f0109d1f:	0f b7 db             	movzwl %bx,%ebx
+f0109d22:	39 da                	cmp    %ebx,%edx
+f0109d24:	73 59                	jae    f0109d7f <pci_virtio_net_attach+0x1ac>
+	if ((uint32_t)kva < KERNBASE)
+f0109d26:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0109d2b:	76 92                	jbe    f0109cbf <pci_virtio_net_attach+0xec>
+	return (physaddr_t)kva - KERNBASE;
+f0109d2d:	c1 e1 06             	shl    $0x6,%ecx
+		vq->desc[d].addr = PADDR(&vnet_rx_hdr[i]);
+f0109d30:	8b 1d a4 17 84 f0    	mov    0xf08417a4,%ebx
+f0109d36:	8b 75 d8             	mov    -0x28(%ebp),%esi
+f0109d39:	8b 7d dc             	mov    -0x24(%ebp),%edi
+f0109d3c:	89 34 0b             	mov    %esi,(%ebx,%ecx,1)
+f0109d3f:	89 7c 0b 04          	mov    %edi,0x4(%ebx,%ecx,1)
+		vq->desc[d].len = sizeof(vnet_rx_hdr[i]);
+f0109d43:	03 0d a4 17 84 f0    	add    0xf08417a4,%ecx
+f0109d49:	c7 41 08 0a 00 00 00 	movl   $0xa,0x8(%ecx)
+		vq->desc[d].flags = VRING_DESC_F_WRITE | VRING_DESC_F_NEXT;
+f0109d50:	66 c7 41 0c 03 00    	movw   $0x3,0xc(%ecx)
+		vq->desc[d].next = d + 1;
+f0109d56:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0109d59:	89 fe                	mov    %edi,%esi
+f0109d5b:	66 89 7d d6          	mov    %di,-0x2a(%ebp)
+f0109d5f:	8d 5e 01             	lea    0x1(%esi),%ebx
+f0109d62:	66 89 59 0e          	mov    %bx,0xe(%ecx)
+		for (j = 0; j < VNET_RX_PAGES; j++) {
+f0109d66:	8d 77 01             	lea    0x1(%edi),%esi
+f0109d69:	8d 3c 7f             	lea    (%edi,%edi,2),%edi
+f0109d6c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0109d6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0109d74:	89 55 d0             	mov    %edx,-0x30(%ebp)
+f0109d77:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f0109d7a:	e9 7f 01 00 00       	jmp    f0109efe <pci_virtio_net_attach+0x32b>
+	}
+	vq->nfree = 0;
+f0109d7f:	66 c7 05 b4 17 84 f0 	movw   $0x0,0xf08417b4
+f0109d86:	00 00 
+
+	vq = &vqs[VQ_TX];
+	for (i = 0; i < vq->num; i++) {
+f0109d88:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0109d8d:	be a0 17 84 f0       	mov    $0xf08417a0,%esi
+	return (pp - pool.pages) << PGSHIFT;
+f0109d92:	bf 60 c2 7f f0       	mov    $0xf07fc260,%edi
+f0109d97:	eb 44                	jmp    f0109ddd <pci_virtio_net_attach+0x20a>
+		if (i % TX_BUFFERS_PER_PAGE == 0) {
+			struct PageInfo *pp = page_alloc(0);
+f0109d99:	83 ec 0c             	sub    $0xc,%esp
+f0109d9c:	6a 00                	push   $0x0
+f0109d9e:	e8 cf 7a ff ff       	call   f0101872 <page_alloc>
+
+			if (!pp)
+f0109da3:	83 c4 10             	add    $0x10,%esp
+f0109da6:	85 c0                	test   %eax,%eax
+f0109da8:	74 4e                	je     f0109df8 <pci_virtio_net_attach+0x225>
+				panic("pci_virtio_net_attach: out of memory");
+			pp->pp_ref++;
+f0109daa:	66 83 40 08 01       	addw   $0x1,0x8(%eax)
+f0109daf:	2b 47 08             	sub    0x8(%edi),%eax
+f0109db2:	c1 f8 02             	sar    $0x2,%eax
+f0109db5:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0109dbb:	89 c2                	mov    %eax,%edx
+f0109dbd:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0109dc0:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0109dc5:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f0109dcb:	73 42                	jae    f0109e0f <pci_virtio_net_attach+0x23c>
+	return (void *)(pa + KERNBASE);
+f0109dcd:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+			vnet_tx_buffer[i] = page2kva(pp);
+f0109dd3:	89 04 9d 20 00 84 f0 	mov    %eax,-0xf7bffe0(,%ebx,4)
+	for (i = 0; i < vq->num; i++) {
+f0109dda:	83 c3 01             	add    $0x1,%ebx
+f0109ddd:	0f b7 46 18          	movzwl 0x18(%esi),%eax
+f0109de1:	39 d8                	cmp    %ebx,%eax
+f0109de3:	7e 3c                	jle    f0109e21 <pci_virtio_net_attach+0x24e>
+		if (i % TX_BUFFERS_PER_PAGE == 0) {
+f0109de5:	f6 c3 01             	test   $0x1,%bl
+f0109de8:	74 af                	je     f0109d99 <pci_virtio_net_attach+0x1c6>
+		} else
+			vnet_tx_buffer[i] = vnet_tx_buffer[i - 1]
+				+ TX_BUFFER_SIZE;
+f0109dea:	8b 04 9d 1c 00 84 f0 	mov    -0xf7bffe4(,%ebx,4),%eax
+f0109df1:	05 ee 05 00 00       	add    $0x5ee,%eax
+f0109df6:	eb db                	jmp    f0109dd3 <pci_virtio_net_attach+0x200>
+				panic("pci_virtio_net_attach: out of memory");
+f0109df8:	83 ec 04             	sub    $0x4,%esp
+f0109dfb:	68 48 c9 10 f0       	push   $0xf010c948
+f0109e00:	68 66 02 00 00       	push   $0x266
+f0109e05:	68 6d c9 10 f0       	push   $0xf010c96d
+f0109e0a:	e8 3a 62 ff ff       	call   f0100049 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0109e0f:	52                   	push   %edx
+f0109e10:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f0109e15:	6a 5f                	push   $0x5f
+f0109e17:	68 31 ba 10 f0       	push   $0xf010ba31
+f0109e1c:	e8 28 62 ff ff       	call   f0100049 <_panic>
+	}
+
+	outb(vnet_io + VIRTIO_PCI_STATUS, VIRTIO_CONFIG_S_ACKNOWLEDGE
+f0109e21:	a1 04 80 84 f0       	mov    0xf0848004,%eax
+f0109e26:	8d 50 12             	lea    0x12(%eax),%edx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0109e29:	b8 07 00 00 00       	mov    $0x7,%eax
+f0109e2e:	ee                   	out    %al,(%dx)
+	     | VIRTIO_CONFIG_S_DRIVER | VIRTIO_CONFIG_S_DRIVER_OK);
+	vq_publish(VQ_RX, vqs[VQ_RX].num / VNET_RX_DESCS);
+f0109e2f:	0f b7 15 a0 17 84 f0 	movzwl 0xf08417a0,%edx
+f0109e36:	66 c1 ea 02          	shr    $0x2,%dx
+f0109e3a:	0f b7 d2             	movzwl %dx,%edx
+f0109e3d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109e42:	e8 cd ed ff ff       	call   f0108c14 <vq_publish>
+
+	cprintf("virtio-net: features %x", vnet_features);
+f0109e47:	83 ec 08             	sub    $0x8,%esp
+f0109e4a:	ff 35 00 80 84 f0    	push   0xf0848000
+f0109e50:	68 9b c9 10 f0       	push   $0xf010c99b
+f0109e55:	e8 87 a5 ff ff       	call   f01043e1 <cprintf>
+	if (vnet_features & VIRTIO_NET_F_MAC)
+f0109e5a:	83 c4 10             	add    $0x10,%esp
+f0109e5d:	f6 05 00 80 84 f0 20 	testb  $0x20,0xf0848000
+f0109e64:	74 37                	je     f0109e9d <pci_virtio_net_attach+0x2ca>
+		for (i = 0; i < 6; i++)
+f0109e66:	bb 00 00 00 00       	mov    $0x0,%ebx
+			cprintf("%c%02x", i ? ':' : ' ', inb(vnet_io
+				+ VIRTIO_PCI_CONFIG + VIRTIO_NET_CONFIG_MAC + i));
+f0109e6b:	a1 04 80 84 f0       	mov    0xf0848004,%eax
+f0109e70:	8d 54 03 14          	lea    0x14(%ebx,%eax,1),%edx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0109e74:	ec                   	in     (%dx),%al
+			cprintf("%c%02x", i ? ':' : ' ', inb(vnet_io
+f0109e75:	0f b6 c0             	movzbl %al,%eax
+f0109e78:	83 fb 01             	cmp    $0x1,%ebx
+f0109e7b:	19 d2                	sbb    %edx,%edx
+f0109e7d:	83 e2 e6             	and    $0xffffffe6,%edx
+f0109e80:	83 c2 3a             	add    $0x3a,%edx
+f0109e83:	83 ec 04             	sub    $0x4,%esp
+f0109e86:	50                   	push   %eax
+f0109e87:	52                   	push   %edx
+f0109e88:	68 b3 c9 10 f0       	push   $0xf010c9b3
+f0109e8d:	e8 4f a5 ff ff       	call   f01043e1 <cprintf>
+		for (i = 0; i < 6; i++)
+f0109e92:	83 c3 01             	add    $0x1,%ebx
+f0109e95:	83 c4 10             	add    $0x10,%esp
+f0109e98:	83 fb 06             	cmp    $0x6,%ebx
+f0109e9b:	75 ce                	jne    f0109e6b <pci_virtio_net_attach+0x298>
+	cprintf("\n");
+f0109e9d:	83 ec 0c             	sub    $0xc,%esp
+f0109ea0:	68 6b bd 10 f0       	push   $0xf010bd6b
+f0109ea5:	e8 37 a5 ff ff       	call   f01043e1 <cprintf>
+	return 1;
+f0109eaa:	83 c4 10             	add    $0x10,%esp
+f0109ead:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+f0109eb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109eb5:	5b                   	pop    %ebx
+f0109eb6:	5e                   	pop    %esi
+f0109eb7:	5f                   	pop    %edi
+f0109eb8:	5d                   	pop    %ebp
+f0109eb9:	c3                   	ret
+		return -E_NOT_SUPP;
+f0109eba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+f0109ebf:	eb f1                	jmp    f0109eb2 <pci_virtio_net_attach+0x2df>
+f0109ec1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+f0109ec6:	eb ea                	jmp    f0109eb2 <pci_virtio_net_attach+0x2df>
+		return 0;
+f0109ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109ecd:	eb e3                	jmp    f0109eb2 <pci_virtio_net_attach+0x2df>
+			vq->desc[d].len = PGSIZE - (j ? 0 : RX_PKT_OFFSET);
+f0109ecf:	03 15 a4 17 84 f0    	add    0xf08417a4,%edx
+f0109ed5:	c7 42 08 f8 0f 00 00 	movl   $0xff8,0x8(%edx)
+			vq->desc[d].flags = VRING_DESC_F_WRITE;
+f0109edc:	66 c7 42 0c 02 00    	movw   $0x2,0xc(%edx)
+				vq->desc[d].flags |= VRING_DESC_F_NEXT;
+f0109ee2:	66 c7 42 0c 03 00    	movw   $0x3,0xc(%edx)
+				vq->desc[d].next = d + 1;
+f0109ee8:	8d 46 01             	lea    0x1(%esi),%eax
+f0109eeb:	66 89 42 0e          	mov    %ax,0xe(%edx)
+		for (j = 0; j < VNET_RX_PAGES; j++) {
+f0109eef:	83 c3 01             	add    $0x1,%ebx
+f0109ef2:	83 c6 01             	add    $0x1,%esi
+f0109ef5:	83 fb 03             	cmp    $0x3,%ebx
+f0109ef8:	0f 84 ed fd ff ff    	je     f0109ceb <pci_virtio_net_attach+0x118>
+			if (!(vnet_rx_page[i][j] = page_alloc(0)))
+f0109efe:	83 ec 0c             	sub    $0xc,%esp
+f0109f01:	6a 00                	push   $0x0
+f0109f03:	e8 6a 79 ff ff       	call   f0101872 <page_alloc>
+f0109f08:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0109f0b:	89 84 99 a0 14 84 f0 	mov    %eax,-0xf7beb60(%ecx,%ebx,4)
+f0109f12:	83 c4 10             	add    $0x10,%esp
+f0109f15:	85 c0                	test   %eax,%eax
+f0109f17:	0f 84 b7 fd ff ff    	je     f0109cd4 <pci_virtio_net_attach+0x101>
+			vnet_rx_page[i][j]->pp_ref++;
+f0109f1d:	66 83 40 08 01       	addw   $0x1,0x8(%eax)
+	return (pp - pool.pages) << PGSHIFT;
+f0109f22:	89 f2                	mov    %esi,%edx
+f0109f24:	c1 e2 04             	shl    $0x4,%edx
+f0109f27:	b9 60 c2 7f f0       	mov    $0xf07fc260,%ecx
+f0109f2c:	2b 41 08             	sub    0x8(%ecx),%eax
+f0109f2f:	c1 f8 02             	sar    $0x2,%eax
+f0109f32:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0109f38:	c1 e0 0c             	shl    $0xc,%eax
+				+ (j ? 0 : RX_PKT_OFFSET);
+f0109f3b:	85 db                	test   %ebx,%ebx
+f0109f3d:	0f 94 c1             	sete   %cl
+f0109f40:	0f b6 c9             	movzbl %cl,%ecx
+f0109f43:	8d 0c c8             	lea    (%eax,%ecx,8),%ecx
+f0109f46:	a1 a4 17 84 f0       	mov    0xf08417a4,%eax
+f0109f4b:	89 0c 10             	mov    %ecx,(%eax,%edx,1)
+f0109f4e:	c7 44 10 04 00 00 00 	movl   $0x0,0x4(%eax,%edx,1)
+f0109f55:	00 
+			vq->desc[d].len = PGSIZE - (j ? 0 : RX_PKT_OFFSET);
+f0109f56:	0f 84 73 ff ff ff    	je     f0109ecf <pci_virtio_net_attach+0x2fc>
+f0109f5c:	03 15 a4 17 84 f0    	add    0xf08417a4,%edx
+f0109f62:	c7 42 08 00 10 00 00 	movl   $0x1000,0x8(%edx)
+			vq->desc[d].flags = VRING_DESC_F_WRITE;
+f0109f69:	66 c7 42 0c 02 00    	movw   $0x2,0xc(%edx)
+			if (j < VNET_RX_PAGES - 1) {
+f0109f6f:	83 fb 01             	cmp    $0x1,%ebx
+f0109f72:	0f 87 77 ff ff ff    	ja     f0109eef <pci_virtio_net_attach+0x31c>
+f0109f78:	e9 65 ff ff ff       	jmp    f0109ee2 <pci_virtio_net_attach+0x30f>
+
+f0109f7d <net_attach>:
+uint8_t net_irq;
+
+// Make drv the NIC driver the packet calls go to, and unmask its IRQ,
+// unless another one got there first.  Returns whether it did.
+bool net_attach(const struct net_driver *drv, uint8_t irq)
+{
+f0109f7d:	55                   	push   %ebp
+f0109f7e:	89 e5                	mov    %esp,%ebp
+f0109f80:	83 ec 08             	sub    $0x8,%esp
+f0109f83:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (net_driver) {
+f0109f86:	a1 0c 80 84 f0       	mov    0xf084800c,%eax
+f0109f8b:	85 c0                	test   %eax,%eax
+f0109f8d:	74 1e                	je     f0109fad <net_attach+0x30>
+		cprintf("%s: not used, %s is\n", drv->nd_name,
+f0109f8f:	83 ec 04             	sub    $0x4,%esp
+f0109f92:	ff 30                	push   (%eax)
+f0109f94:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109f97:	ff 30                	push   (%eax)
+f0109f99:	68 c5 c9 10 f0       	push   $0xf010c9c5
+f0109f9e:	e8 3e a4 ff ff       	call   f01043e1 <cprintf>
+			net_driver->nd_name);
+		return false;
+f0109fa3:	83 c4 10             	add    $0x10,%esp
+f0109fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	net_driver = drv;
+	net_irq = irq;
+	irq_setmask_8259A(irq_mask_8259A & ~(1 << irq));
+	return true;
+}
+f0109fab:	c9                   	leave
+f0109fac:	c3                   	ret
+	net_driver = drv;
+f0109fad:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109fb0:	a3 0c 80 84 f0       	mov    %eax,0xf084800c
+	net_irq = irq;
+f0109fb5:	88 15 08 80 84 f0    	mov    %dl,0xf0848008
+	irq_setmask_8259A(irq_mask_8259A & ~(1 << irq));
+f0109fbb:	83 ec 0c             	sub    $0xc,%esp
+f0109fbe:	0f b7 05 a8 63 11 f0 	movzwl 0xf01163a8,%eax
+f0109fc5:	0f b3 d0             	btr    %edx,%eax
+f0109fc8:	0f b7 c0             	movzwl %ax,%eax
+f0109fcb:	50                   	push   %eax
+f0109fcc:	e8 9c a2 ff ff       	call   f010426d <irq_setmask_8259A>
+	return true;
+f0109fd1:	83 c4 10             	add    $0x10,%esp
+f0109fd4:	b8 01 00 00 00       	mov    $0x1,%eax
+f0109fd9:	eb d0                	jmp    f0109fab <net_attach+0x2e>
+
+f0109fdb <net_rx_pkt_init>:
+// Fill in the struct jif_pkt header of the 'length'-byte received
+// packet in the run of pages pps[].  The pages may have held anything
+// before; the rest of the last one is zeroed, so that only the packet
+// is handed out.
+void net_rx_pkt_init(struct PageInfo **pps, size_t length, int csum)
+{
+f0109fdb:	55                   	push   %ebp
+f0109fdc:	89 e5                	mov    %esp,%ebp
+f0109fde:	57                   	push   %edi
+f0109fdf:	56                   	push   %esi
+f0109fe0:	53                   	push   %ebx
+f0109fe1:	83 ec 0c             	sub    $0xc,%esp
+f0109fe4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0109fe7:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109fea:	8b 00                	mov    (%eax),%eax
+f0109fec:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f0109ff2:	c1 f8 02             	sar    $0x2,%eax
+f0109ff5:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0109ffb:	89 c6                	mov    %eax,%esi
+f0109ffd:	c1 e6 0c             	shl    $0xc,%esi
+	if (PGNUM(pa) >= npages)
+f010a000:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010a005:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f010a00b:	73 73                	jae    f010a080 <net_rx_pkt_init+0xa5>
+	int *pkt = page2kva(pps[0]);
+	size_t end = RX_PKT_OFFSET + length
+		- (RX_PKT_PAGES(length) - 1) * PGSIZE;
+f010a00d:	8d 91 07 10 00 00    	lea    0x1007(%ecx),%edx
+f010a013:	c1 ea 0c             	shr    $0xc,%edx
+f010a016:	8d 42 ff             	lea    -0x1(%edx),%eax
+f010a019:	c1 e0 0c             	shl    $0xc,%eax
+f010a01c:	8d 79 08             	lea    0x8(%ecx),%edi
+	size_t end = RX_PKT_OFFSET + length
+f010a01f:	89 fb                	mov    %edi,%ebx
+f010a021:	29 c3                	sub    %eax,%ebx
+
+	pkt[0] = length;
+f010a023:	89 8e 00 00 00 f0    	mov    %ecx,-0x10000000(%esi)
+	pkt[1] = csum;
+f010a029:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f010a02c:	89 8e 04 00 00 f0    	mov    %ecx,-0xffffffc(%esi)
+	memset((char *) page2kva(pps[RX_PKT_PAGES(length) - 1]) + end, 0,
+f010a032:	29 f8                	sub    %edi,%eax
+f010a034:	8d 88 00 10 00 00    	lea    0x1000(%eax),%ecx
+	return (pp - pool.pages) << PGSHIFT;
+f010a03a:	8b 45 08             	mov    0x8(%ebp),%eax
+f010a03d:	8b 44 90 fc          	mov    -0x4(%eax,%edx,4),%eax
+f010a041:	2b 05 68 c2 7f f0    	sub    0xf07fc268,%eax
+f010a047:	c1 f8 02             	sar    $0x2,%eax
+f010a04a:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010a050:	89 c2                	mov    %eax,%edx
+f010a052:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010a055:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010a05a:	3b 05 ac c2 7f f0    	cmp    0xf07fc2ac,%eax
+f010a060:	73 30                	jae    f010a092 <net_rx_pkt_init+0xb7>
+f010a062:	83 ec 04             	sub    $0x4,%esp
+f010a065:	51                   	push   %ecx
+f010a066:	6a 00                	push   $0x0
+f010a068:	8d 84 13 00 00 00 f0 	lea    -0x10000000(%ebx,%edx,1),%eax
+f010a06f:	50                   	push   %eax
+f010a070:	e8 91 cd ff ff       	call   f0106e06 <memset>
+	       PGSIZE - end);
+}
+f010a075:	83 c4 10             	add    $0x10,%esp
+f010a078:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a07b:	5b                   	pop    %ebx
+f010a07c:	5e                   	pop    %esi
+f010a07d:	5f                   	pop    %edi
+f010a07e:	5d                   	pop    %ebp
+f010a07f:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010a080:	56                   	push   %esi
+f010a081:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f010a086:	6a 5f                	push   $0x5f
+f010a088:	68 31 ba 10 f0       	push   $0xf010ba31
+f010a08d:	e8 b7 5f ff ff       	call   f0100049 <_panic>
+f010a092:	52                   	push   %edx
+f010a093:	68 a4 a9 10 f0       	push   $0xf010a9a4
+f010a098:	6a 5f                	push   $0x5f
+f010a09a:	68 31 ba 10 f0       	push   $0xf010ba31
+f010a09f:	e8 a5 5f ff ff       	call   f0100049 <_panic>
+
+f010a0a4 <net_packet_tx>:
+
+size_t net_packet_tx(const void *packet, size_t length)
+{
+	return net_driver ? net_driver->nd_tx(packet, length) : 0;
+f010a0a4:	8b 15 0c 80 84 f0    	mov    0xf084800c,%edx
+f010a0aa:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a0af:	85 d2                	test   %edx,%edx
+f010a0b1:	74 14                	je     f010a0c7 <net_packet_tx+0x23>
+{
+f010a0b3:	55                   	push   %ebp
+f010a0b4:	89 e5                	mov    %esp,%ebp
+f010a0b6:	83 ec 10             	sub    $0x10,%esp
+	return net_driver ? net_driver->nd_tx(packet, length) : 0;
+f010a0b9:	ff 75 0c             	push   0xc(%ebp)
+f010a0bc:	ff 75 08             	push   0x8(%ebp)
+f010a0bf:	ff 52 08             	call   *0x8(%edx)
+f010a0c2:	83 c4 10             	add    $0x10,%esp
+}
+f010a0c5:	c9                   	leave
+f010a0c6:	c3                   	ret
+f010a0c7:	c3                   	ret
+
+f010a0c8 <net_packet_tx_batch>:
+
+int net_packet_tx_batch(const struct net_sg *pkts, int n)
+{
+	return net_driver ? net_driver->nd_tx_batch(pkts, n) : 0;
+f010a0c8:	8b 15 0c 80 84 f0    	mov    0xf084800c,%edx
+f010a0ce:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a0d3:	85 d2                	test   %edx,%edx
+f010a0d5:	74 14                	je     f010a0eb <net_packet_tx_batch+0x23>
+{
+f010a0d7:	55                   	push   %ebp
+f010a0d8:	89 e5                	mov    %esp,%ebp
+f010a0da:	83 ec 10             	sub    $0x10,%esp
+	return net_driver ? net_driver->nd_tx_batch(pkts, n) : 0;
+f010a0dd:	ff 75 0c             	push   0xc(%ebp)
+f010a0e0:	ff 75 08             	push   0x8(%ebp)
+f010a0e3:	ff 52 0c             	call   *0xc(%edx)
+f010a0e6:	83 c4 10             	add    $0x10,%esp
+}
+f010a0e9:	c9                   	leave
+f010a0ea:	c3                   	ret
+f010a0eb:	c3                   	ret
+
+f010a0ec <net_packet_tx_frags>:
+
+size_t net_packet_tx_frags(const struct tx_frag *frags, int n,
+			   const struct net_offload *off, uint32_t *seq)
+{
+	return net_driver ? net_driver->nd_tx_frags(frags, n, off, seq) : 0;
+f010a0ec:	8b 15 0c 80 84 f0    	mov    0xf084800c,%edx
+f010a0f2:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a0f7:	85 d2                	test   %edx,%edx
+f010a0f9:	74 1a                	je     f010a115 <net_packet_tx_frags+0x29>
+{
+f010a0fb:	55                   	push   %ebp
+f010a0fc:	89 e5                	mov    %esp,%ebp
+f010a0fe:	83 ec 08             	sub    $0x8,%esp
+	return net_driver ? net_driver->nd_tx_frags(frags, n, off, seq) : 0;
+f010a101:	ff 75 14             	push   0x14(%ebp)
+f010a104:	ff 75 10             	push   0x10(%ebp)
+f010a107:	ff 75 0c             	push   0xc(%ebp)
+f010a10a:	ff 75 08             	push   0x8(%ebp)
+f010a10d:	ff 52 10             	call   *0x10(%edx)
+f010a110:	83 c4 10             	add    $0x10,%esp
+}
+f010a113:	c9                   	leave
+f010a114:	c3                   	ret
+f010a115:	c3                   	ret
+
+f010a116 <net_tx_done>:
+
+uint32_t net_tx_done(void)
+{
+	return net_driver ? net_driver->nd_tx_done() : 0;
+f010a116:	8b 15 0c 80 84 f0    	mov    0xf084800c,%edx
+f010a11c:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a121:	85 d2                	test   %edx,%edx
+f010a123:	74 0b                	je     f010a130 <net_tx_done+0x1a>
+{
+f010a125:	55                   	push   %ebp
+f010a126:	89 e5                	mov    %esp,%ebp
+f010a128:	83 ec 08             	sub    $0x8,%esp
+	return net_driver ? net_driver->nd_tx_done() : 0;
+f010a12b:	ff 52 14             	call   *0x14(%edx)
+}
+f010a12e:	c9                   	leave
+f010a12f:	c3                   	ret
+f010a130:	c3                   	ret
+
+f010a131 <net_packet_rx>:
+
+size_t net_packet_rx(uint8_t *buffer)
+{
+	return net_driver ? net_driver->nd_rx(buffer) : 0;
+f010a131:	8b 15 0c 80 84 f0    	mov    0xf084800c,%edx
+f010a137:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a13c:	85 d2                	test   %edx,%edx
+f010a13e:	74 11                	je     f010a151 <net_packet_rx+0x20>
+{
+f010a140:	55                   	push   %ebp
+f010a141:	89 e5                	mov    %esp,%ebp
+f010a143:	83 ec 14             	sub    $0x14,%esp
+	return net_driver ? net_driver->nd_rx(buffer) : 0;
+f010a146:	ff 75 08             	push   0x8(%ebp)
+f010a149:	ff 52 18             	call   *0x18(%edx)
+f010a14c:	83 c4 10             	add    $0x10,%esp
+}
+f010a14f:	c9                   	leave
+f010a150:	c3                   	ret
+f010a151:	c3                   	ret
+
+f010a152 <net_packet_rx_pages>:
+
+int net_packet_rx_pages(struct PageInfo **pps, int max)
+{
+	return net_driver ? net_driver->nd_rx_pages(pps, max) : 0;
+f010a152:	8b 15 0c 80 84 f0    	mov    0xf084800c,%edx
+f010a158:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a15d:	85 d2                	test   %edx,%edx
+f010a15f:	74 14                	je     f010a175 <net_packet_rx_pages+0x23>
+{
+f010a161:	55                   	push   %ebp
+f010a162:	89 e5                	mov    %esp,%ebp
+f010a164:	83 ec 10             	sub    $0x10,%esp
+	return net_driver ? net_driver->nd_rx_pages(pps, max) : 0;
+f010a167:	ff 75 0c             	push   0xc(%ebp)
+f010a16a:	ff 75 08             	push   0x8(%ebp)
+f010a16d:	ff 52 1c             	call   *0x1c(%edx)
+f010a170:	83 c4 10             	add    $0x10,%esp
+}
+f010a173:	c9                   	leave
+f010a174:	c3                   	ret
+f010a175:	c3                   	ret
+
+f010a176 <net_ready>:
+
+uint32_t net_ready(uint32_t events)
+{
+	return net_driver ? net_driver->nd_ready(events) : 0;
+f010a176:	8b 15 0c 80 84 f0    	mov    0xf084800c,%edx
+f010a17c:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a181:	85 d2                	test   %edx,%edx
+f010a183:	74 11                	je     f010a196 <net_ready+0x20>
+{
+f010a185:	55                   	push   %ebp
+f010a186:	89 e5                	mov    %esp,%ebp
+f010a188:	83 ec 14             	sub    $0x14,%esp
+	return net_driver ? net_driver->nd_ready(events) : 0;
+f010a18b:	ff 75 08             	push   0x8(%ebp)
+f010a18e:	ff 52 20             	call   *0x20(%edx)
+f010a191:	83 c4 10             	add    $0x10,%esp
+}
+f010a194:	c9                   	leave
+f010a195:	c3                   	ret
+f010a196:	c3                   	ret
+
+f010a197 <net_offloads>:
+
+uint32_t net_offloads(void)
+{
+	return net_driver ? net_driver->nd_offloads : 0;
+f010a197:	8b 15 0c 80 84 f0    	mov    0xf084800c,%edx
+f010a19d:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a1a2:	85 d2                	test   %edx,%edx
+f010a1a4:	74 03                	je     f010a1a9 <net_offloads+0x12>
+f010a1a6:	8b 42 04             	mov    0x4(%edx),%eax
+}
+f010a1a9:	c3                   	ret
+
+f010a1aa <net_intr>:
+
+void net_intr(void)
+{
+	if (net_driver)
+f010a1aa:	a1 0c 80 84 f0       	mov    0xf084800c,%eax
+f010a1af:	85 c0                	test   %eax,%eax
+f010a1b1:	74 0b                	je     f010a1be <net_intr+0x14>
+{
+f010a1b3:	55                   	push   %ebp
+f010a1b4:	89 e5                	mov    %esp,%ebp
+f010a1b6:	83 ec 08             	sub    $0x8,%esp
+		net_driver->nd_intr();
+f010a1b9:	ff 50 24             	call   *0x24(%eax)
+}
+f010a1bc:	c9                   	leave
+f010a1bd:	c3                   	ret
+f010a1be:	c3                   	ret
+
+f010a1bf <pci_attach_match>:
+}
+
+static int __attribute__((warn_unused_result))
+pci_attach_match(uint32_t key1, uint32_t key2,
+		 struct pci_driver *list, struct pci_func *pcif)
+{
+f010a1bf:	55                   	push   %ebp
+f010a1c0:	89 e5                	mov    %esp,%ebp
+f010a1c2:	57                   	push   %edi
+f010a1c3:	56                   	push   %esi
+f010a1c4:	53                   	push   %ebx
+f010a1c5:	83 ec 1c             	sub    $0x1c,%esp
+f010a1c8:	89 c7                	mov    %eax,%edi
+f010a1ca:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	uint32_t i;
+
+	for (i = 0; list[i].attachfn; i++) {
+f010a1cd:	89 cb                	mov    %ecx,%ebx
+f010a1cf:	eb 03                	jmp    f010a1d4 <pci_attach_match+0x15>
+f010a1d1:	83 c3 0c             	add    $0xc,%ebx
+f010a1d4:	89 de                	mov    %ebx,%esi
+f010a1d6:	8b 43 08             	mov    0x8(%ebx),%eax
+f010a1d9:	85 c0                	test   %eax,%eax
+f010a1db:	74 37                	je     f010a214 <pci_attach_match+0x55>
+		if (list[i].key1 == key1 && list[i].key2 == key2) {
+f010a1dd:	39 3b                	cmp    %edi,(%ebx)
+f010a1df:	75 f0                	jne    f010a1d1 <pci_attach_match+0x12>
+f010a1e1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f010a1e4:	39 56 04             	cmp    %edx,0x4(%esi)
+f010a1e7:	75 e8                	jne    f010a1d1 <pci_attach_match+0x12>
+			int r = list[i].attachfn(pcif);
+f010a1e9:	83 ec 0c             	sub    $0xc,%esp
+f010a1ec:	ff 75 08             	push   0x8(%ebp)
+f010a1ef:	ff d0                	call   *%eax
+			if (r > 0)
+f010a1f1:	83 c4 10             	add    $0x10,%esp
+f010a1f4:	85 c0                	test   %eax,%eax
+f010a1f6:	7f 1c                	jg     f010a214 <pci_attach_match+0x55>
+				return r;
+			if (r < 0)
+f010a1f8:	79 d7                	jns    f010a1d1 <pci_attach_match+0x12>
+				cprintf("pci_attach_match: attaching "
+f010a1fa:	83 ec 0c             	sub    $0xc,%esp
+f010a1fd:	50                   	push   %eax
+f010a1fe:	ff 76 08             	push   0x8(%esi)
+f010a201:	ff 75 e4             	push   -0x1c(%ebp)
+f010a204:	57                   	push   %edi
+f010a205:	68 dc c9 10 f0       	push   $0xf010c9dc
+f010a20a:	e8 d2 a1 ff ff       	call   f01043e1 <cprintf>
+f010a20f:	83 c4 20             	add    $0x20,%esp
+f010a212:	eb bd                	jmp    f010a1d1 <pci_attach_match+0x12>
+					"%x.%x (%p): e\n",
+					key1, key2, list[i].attachfn, r);
+		}
+	}
+	return 0;
+}
+f010a214:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a217:	5b                   	pop    %ebx
+f010a218:	5e                   	pop    %esi
+f010a219:	5f                   	pop    %edi
+f010a21a:	5d                   	pop    %ebp
+f010a21b:	c3                   	ret
+
+f010a21c <pci_conf1_set_addr>:
+{
+f010a21c:	55                   	push   %ebp
+f010a21d:	89 e5                	mov    %esp,%ebp
+f010a21f:	56                   	push   %esi
+f010a220:	53                   	push   %ebx
+f010a221:	8b 75 08             	mov    0x8(%ebp),%esi
+	assert(bus < 256);
+f010a224:	3d ff 00 00 00       	cmp    $0xff,%eax
+f010a229:	77 3b                	ja     f010a266 <pci_conf1_set_addr+0x4a>
+	assert(dev < 32);
+f010a22b:	83 fa 1f             	cmp    $0x1f,%edx
+f010a22e:	77 4c                	ja     f010a27c <pci_conf1_set_addr+0x60>
+	assert(func < 8);
+f010a230:	83 f9 07             	cmp    $0x7,%ecx
+f010a233:	77 5d                	ja     f010a292 <pci_conf1_set_addr+0x76>
+	assert(offset < 256);
+f010a235:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+f010a23b:	77 6b                	ja     f010a2a8 <pci_conf1_set_addr+0x8c>
+	assert((offset & 0x3) == 0);
+f010a23d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f010a243:	75 79                	jne    f010a2be <pci_conf1_set_addr+0xa2>
+		(bus << 16) | (dev << 11) | (func << 8) | (offset);
+f010a245:	c1 e0 10             	shl    $0x10,%eax
+f010a248:	09 f0                	or     %esi,%eax
+f010a24a:	c1 e1 08             	shl    $0x8,%ecx
+f010a24d:	09 c8                	or     %ecx,%eax
+f010a24f:	c1 e2 0b             	shl    $0xb,%edx
+f010a252:	09 d0                	or     %edx,%eax
+	uint32_t v = (1 << 31) |		// config-space
+f010a254:	0d 00 00 00 80       	or     $0x80000000,%eax
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f010a259:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+f010a25e:	ef                   	out    %eax,(%dx)
+}
+f010a25f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010a262:	5b                   	pop    %ebx
+f010a263:	5e                   	pop    %esi
+f010a264:	5d                   	pop    %ebp
+f010a265:	c3                   	ret
+	assert(bus < 256);
+f010a266:	68 33 cb 10 f0       	push   $0xf010cb33
+f010a26b:	68 25 aa 10 f0       	push   $0xf010aa25
+f010a270:	6a 2e                	push   $0x2e
+f010a272:	68 3d cb 10 f0       	push   $0xf010cb3d
+f010a277:	e8 cd 5d ff ff       	call   f0100049 <_panic>
+	assert(dev < 32);
+f010a27c:	68 48 cb 10 f0       	push   $0xf010cb48
+f010a281:	68 25 aa 10 f0       	push   $0xf010aa25
+f010a286:	6a 2f                	push   $0x2f
+f010a288:	68 3d cb 10 f0       	push   $0xf010cb3d
+f010a28d:	e8 b7 5d ff ff       	call   f0100049 <_panic>
+	assert(func < 8);
+f010a292:	68 51 cb 10 f0       	push   $0xf010cb51
+f010a297:	68 25 aa 10 f0       	push   $0xf010aa25
+f010a29c:	6a 30                	push   $0x30
+f010a29e:	68 3d cb 10 f0       	push   $0xf010cb3d
+f010a2a3:	e8 a1 5d ff ff       	call   f0100049 <_panic>
+	assert(offset < 256);
+f010a2a8:	68 5a cb 10 f0       	push   $0xf010cb5a
+f010a2ad:	68 25 aa 10 f0       	push   $0xf010aa25
+f010a2b2:	6a 31                	push   $0x31
+f010a2b4:	68 3d cb 10 f0       	push   $0xf010cb3d
+f010a2b9:	e8 8b 5d ff ff       	call   f0100049 <_panic>
+	assert((offset & 0x3) == 0);
+f010a2be:	68 67 cb 10 f0       	push   $0xf010cb67
+f010a2c3:	68 25 aa 10 f0       	push   $0xf010aa25
+f010a2c8:	6a 32                	push   $0x32
+f010a2ca:	68 3d cb 10 f0       	push   $0xf010cb3d
+f010a2cf:	e8 75 5d ff ff       	call   f0100049 <_panic>
+
+f010a2d4 <pci_conf_read>:
+{
+f010a2d4:	55                   	push   %ebp
+f010a2d5:	89 e5                	mov    %esp,%ebp
+f010a2d7:	53                   	push   %ebx
+f010a2d8:	83 ec 10             	sub    $0x10,%esp
+f010a2db:	89 d3                	mov    %edx,%ebx
+	pci_conf1_set_addr(f->bus->busno, f->dev, f->func, off);
+f010a2dd:	8b 48 08             	mov    0x8(%eax),%ecx
+f010a2e0:	8b 50 04             	mov    0x4(%eax),%edx
+f010a2e3:	8b 00                	mov    (%eax),%eax
+f010a2e5:	8b 40 04             	mov    0x4(%eax),%eax
+f010a2e8:	53                   	push   %ebx
+f010a2e9:	e8 2e ff ff ff       	call   f010a21c <pci_conf1_set_addr>
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+f010a2ee:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+f010a2f3:	ed                   	in     (%dx),%eax
+}
+f010a2f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010a2f7:	c9                   	leave
+f010a2f8:	c3                   	ret
+
+f010a2f9 <pci_scan_bus>:
+		f->irq_line);
+}
+
+static int
+pci_scan_bus(struct pci_bus *bus)
+{
+f010a2f9:	55                   	push   %ebp
+f010a2fa:	89 e5                	mov    %esp,%ebp
+f010a2fc:	57                   	push   %edi
+f010a2fd:	56                   	push   %esi
+f010a2fe:	53                   	push   %ebx
+f010a2ff:	81 ec 00 01 00 00    	sub    $0x100,%esp
+f010a305:	89 c3                	mov    %eax,%ebx
+	int totaldev = 0;
+	struct pci_func df;
+	memset(&df, 0, sizeof(df));
+f010a307:	6a 48                	push   $0x48
+f010a309:	6a 00                	push   $0x0
+f010a30b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+f010a30e:	50                   	push   %eax
+f010a30f:	e8 f2 ca ff ff       	call   f0106e06 <memset>
+	df.bus = bus;
+f010a314:	89 5d a0             	mov    %ebx,-0x60(%ebp)
+
+	for (df.dev = 0; df.dev < 32; df.dev++) {
+f010a317:	83 c4 10             	add    $0x10,%esp
+f010a31a:	b8 00 00 00 00       	mov    $0x0,%eax
+	int totaldev = 0;
+f010a31f:	c7 85 f8 fe ff ff 00 	movl   $0x0,-0x108(%ebp)
+f010a326:	00 00 00 
+	for (df.dev = 0; df.dev < 32; df.dev++) {
+f010a329:	e9 3e 01 00 00       	jmp    f010a46c <pci_scan_bus+0x173>
+	cprintf("PCI: %02x:%02x.%d: %04x:%04x: class: %x.%x (%s) irq: %d\n",
+f010a32e:	83 ec 08             	sub    $0x8,%esp
+f010a331:	89 fa                	mov    %edi,%edx
+f010a333:	0f b6 fa             	movzbl %dl,%edi
+f010a336:	57                   	push   %edi
+f010a337:	51                   	push   %ecx
+		PCI_CLASS(f->dev_class), PCI_SUBCLASS(f->dev_class), class,
+f010a338:	c1 e8 10             	shr    $0x10,%eax
+	cprintf("PCI: %02x:%02x.%d: %04x:%04x: class: %x.%x (%s) irq: %d\n",
+f010a33b:	0f b6 c0             	movzbl %al,%eax
+f010a33e:	50                   	push   %eax
+f010a33f:	ff b5 00 ff ff ff    	push   -0x100(%ebp)
+f010a345:	c1 ee 10             	shr    $0x10,%esi
+f010a348:	56                   	push   %esi
+f010a349:	ff b5 04 ff ff ff    	push   -0xfc(%ebp)
+f010a34f:	53                   	push   %ebx
+f010a350:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+f010a356:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+f010a35c:	ff 70 04             	push   0x4(%eax)
+f010a35f:	68 08 ca 10 f0       	push   $0xf010ca08
+f010a364:	e8 78 a0 ff ff       	call   f01043e1 <cprintf>
+				 PCI_SUBCLASS(f->dev_class),
+f010a369:	8b 85 68 ff ff ff    	mov    -0x98(%ebp),%eax
+		pci_attach_match(PCI_CLASS(f->dev_class),
+f010a36f:	83 c4 24             	add    $0x24,%esp
+				 PCI_SUBCLASS(f->dev_class),
+f010a372:	89 c2                	mov    %eax,%edx
+f010a374:	c1 ea 10             	shr    $0x10,%edx
+		pci_attach_match(PCI_CLASS(f->dev_class),
+f010a377:	0f b6 d2             	movzbl %dl,%edx
+f010a37a:	c1 e8 18             	shr    $0x18,%eax
+f010a37d:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+f010a383:	51                   	push   %ecx
+f010a384:	b9 44 65 11 f0       	mov    $0xf0116544,%ecx
+f010a389:	e8 31 fe ff ff       	call   f010a1bf <pci_attach_match>
+				 &pci_attach_class[0], f) ||
+f010a38e:	83 c4 10             	add    $0x10,%esp
+f010a391:	85 c0                	test   %eax,%eax
+f010a393:	0f 84 a3 00 00 00    	je     f010a43c <pci_scan_bus+0x143>
+
+		totaldev++;
+
+		struct pci_func f = df;
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+		     f.func++) {
+f010a399:	83 c3 01             	add    $0x1,%ebx
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+f010a39c:	89 9d 18 ff ff ff    	mov    %ebx,-0xe8(%ebp)
+f010a3a2:	8b 85 fc fe ff ff    	mov    -0x104(%ebp),%eax
+f010a3a8:	39 c3                	cmp    %eax,%ebx
+f010a3aa:	0f 83 b6 00 00 00    	jae    f010a466 <pci_scan_bus+0x16d>
+			struct pci_func af = f;
+f010a3b0:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+f010a3b6:	8d b5 10 ff ff ff    	lea    -0xf0(%ebp),%esi
+f010a3bc:	b9 12 00 00 00       	mov    $0x12,%ecx
+f010a3c1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+
+			af.dev_id = pci_conf_read(&f, PCI_ID_REG);
+f010a3c3:	ba 00 00 00 00       	mov    $0x0,%edx
+f010a3c8:	8d 85 10 ff ff ff    	lea    -0xf0(%ebp),%eax
+f010a3ce:	e8 01 ff ff ff       	call   f010a2d4 <pci_conf_read>
+f010a3d3:	89 c6                	mov    %eax,%esi
+f010a3d5:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+			if (PCI_VENDOR(af.dev_id) == 0xffff)
+f010a3db:	0f b7 c0             	movzwl %ax,%eax
+f010a3de:	89 85 04 ff ff ff    	mov    %eax,-0xfc(%ebp)
+f010a3e4:	66 83 fe ff          	cmp    $0xffff,%si
+f010a3e8:	74 af                	je     f010a399 <pci_scan_bus+0xa0>
+				continue;
+
+			uint32_t intr = pci_conf_read(&af, PCI_INTERRUPT_REG);
+f010a3ea:	ba 3c 00 00 00       	mov    $0x3c,%edx
+f010a3ef:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+f010a3f5:	e8 da fe ff ff       	call   f010a2d4 <pci_conf_read>
+f010a3fa:	89 c7                	mov    %eax,%edi
+			af.irq_line = PCI_INTERRUPT_LINE(intr);
+f010a3fc:	88 45 9c             	mov    %al,-0x64(%ebp)
+
+			af.dev_class = pci_conf_read(&af, PCI_CLASS_REG);
+f010a3ff:	ba 08 00 00 00       	mov    $0x8,%edx
+f010a404:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+f010a40a:	e8 c5 fe ff ff       	call   f010a2d4 <pci_conf_read>
+f010a40f:	89 85 68 ff ff ff    	mov    %eax,-0x98(%ebp)
+	if (PCI_CLASS(f->dev_class) < ARRAY_SIZE(pci_class))
+f010a415:	89 c2                	mov    %eax,%edx
+f010a417:	c1 ea 18             	shr    $0x18,%edx
+f010a41a:	89 95 00 ff ff ff    	mov    %edx,-0x100(%ebp)
+	const char *class = pci_class[0];
+f010a420:	b9 7b cb 10 f0       	mov    $0xf010cb7b,%ecx
+	if (PCI_CLASS(f->dev_class) < ARRAY_SIZE(pci_class))
+f010a425:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+f010a42a:	0f 87 fe fe ff ff    	ja     f010a32e <pci_scan_bus+0x35>
+		class = pci_class[PCI_CLASS(f->dev_class)];
+f010a430:	8b 0c 95 f0 cb 10 f0 	mov    -0xfef3410(,%edx,4),%ecx
+f010a437:	e9 f2 fe ff ff       	jmp    f010a32e <pci_scan_bus+0x35>
+				 PCI_PRODUCT(f->dev_id),
+f010a43c:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+		pci_attach_match(PCI_VENDOR(f->dev_id),
+f010a442:	89 c2                	mov    %eax,%edx
+f010a444:	c1 ea 10             	shr    $0x10,%edx
+f010a447:	0f b7 c0             	movzwl %ax,%eax
+f010a44a:	83 ec 0c             	sub    $0xc,%esp
+f010a44d:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+f010a453:	57                   	push   %edi
+f010a454:	b9 20 65 11 f0       	mov    $0xf0116520,%ecx
+f010a459:	e8 61 fd ff ff       	call   f010a1bf <pci_attach_match>
+f010a45e:	83 c4 10             	add    $0x10,%esp
+f010a461:	e9 33 ff ff ff       	jmp    f010a399 <pci_scan_bus+0xa0>
+	for (df.dev = 0; df.dev < 32; df.dev++) {
+f010a466:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010a469:	83 c0 01             	add    $0x1,%eax
+f010a46c:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+f010a46f:	83 f8 1f             	cmp    $0x1f,%eax
+f010a472:	77 4b                	ja     f010a4bf <pci_scan_bus+0x1c6>
+		uint32_t bhlc = pci_conf_read(&df, PCI_BHLC_REG);
+f010a474:	ba 0c 00 00 00       	mov    $0xc,%edx
+f010a479:	8d 45 a0             	lea    -0x60(%ebp),%eax
+f010a47c:	e8 53 fe ff ff       	call   f010a2d4 <pci_conf_read>
+		if (PCI_HDRTYPE_TYPE(bhlc) > 1)	    // Unsupported or no device
+f010a481:	89 c2                	mov    %eax,%edx
+f010a483:	c1 ea 10             	shr    $0x10,%edx
+f010a486:	89 d3                	mov    %edx,%ebx
+f010a488:	83 e3 7e             	and    $0x7e,%ebx
+f010a48b:	75 d9                	jne    f010a466 <pci_scan_bus+0x16d>
+		totaldev++;
+f010a48d:	83 85 f8 fe ff ff 01 	addl   $0x1,-0x108(%ebp)
+		struct pci_func f = df;
+f010a494:	8d bd 10 ff ff ff    	lea    -0xf0(%ebp),%edi
+f010a49a:	8d 75 a0             	lea    -0x60(%ebp),%esi
+f010a49d:	b9 12 00 00 00       	mov    $0x12,%ecx
+f010a4a2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+		for (f.func = 0; f.func < (PCI_HDRTYPE_MULTIFN(bhlc) ? 8 : 1);
+f010a4a4:	25 00 00 80 00       	and    $0x800000,%eax
+f010a4a9:	83 f8 01             	cmp    $0x1,%eax
+f010a4ac:	19 c0                	sbb    %eax,%eax
+f010a4ae:	83 e0 f9             	and    $0xfffffff9,%eax
+f010a4b1:	83 c0 08             	add    $0x8,%eax
+f010a4b4:	89 85 fc fe ff ff    	mov    %eax,-0x104(%ebp)
+f010a4ba:	e9 dd fe ff ff       	jmp    f010a39c <pci_scan_bus+0xa3>
+			pci_attach(&af);
+		}
+	}
+
+	return totaldev;
+}
+f010a4bf:	8b 85 f8 fe ff ff    	mov    -0x108(%ebp),%eax
+f010a4c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a4c8:	5b                   	pop    %ebx
+f010a4c9:	5e                   	pop    %esi
+f010a4ca:	5f                   	pop    %edi
+f010a4cb:	5d                   	pop    %ebp
+f010a4cc:	c3                   	ret
+
+f010a4cd <pci_bridge_attach>:
+
+static int
+pci_bridge_attach(struct pci_func *pcif)
+{
+f010a4cd:	55                   	push   %ebp
+f010a4ce:	89 e5                	mov    %esp,%ebp
+f010a4d0:	57                   	push   %edi
+f010a4d1:	56                   	push   %esi
+f010a4d2:	53                   	push   %ebx
+f010a4d3:	83 ec 1c             	sub    $0x1c,%esp
+f010a4d6:	8b 75 08             	mov    0x8(%ebp),%esi
+	uint32_t ioreg  = pci_conf_read(pcif, PCI_BRIDGE_STATIO_REG);
+f010a4d9:	ba 1c 00 00 00       	mov    $0x1c,%edx
+f010a4de:	89 f0                	mov    %esi,%eax
+f010a4e0:	e8 ef fd ff ff       	call   f010a2d4 <pci_conf_read>
+f010a4e5:	89 c7                	mov    %eax,%edi
+	uint32_t busreg = pci_conf_read(pcif, PCI_BRIDGE_BUS_REG);
+f010a4e7:	ba 18 00 00 00       	mov    $0x18,%edx
+f010a4ec:	89 f0                	mov    %esi,%eax
+f010a4ee:	e8 e1 fd ff ff       	call   f010a2d4 <pci_conf_read>
+
+	if (PCI_BRIDGE_IO_32BITS(ioreg)) {
+f010a4f3:	83 e7 0f             	and    $0xf,%edi
+f010a4f6:	83 ff 01             	cmp    $0x1,%edi
+f010a4f9:	74 52                	je     f010a54d <pci_bridge_attach+0x80>
+f010a4fb:	89 c3                	mov    %eax,%ebx
+			pcif->bus->busno, pcif->dev, pcif->func);
+		return 0;
+	}
+
+	struct pci_bus nbus;
+	memset(&nbus, 0, sizeof(nbus));
+f010a4fd:	83 ec 04             	sub    $0x4,%esp
+f010a500:	6a 08                	push   $0x8
+f010a502:	6a 00                	push   $0x0
+f010a504:	8d 7d e0             	lea    -0x20(%ebp),%edi
+f010a507:	57                   	push   %edi
+f010a508:	e8 f9 c8 ff ff       	call   f0106e06 <memset>
+	nbus.parent_bridge = pcif;
+f010a50d:	89 75 e0             	mov    %esi,-0x20(%ebp)
+	nbus.busno = (busreg >> PCI_BRIDGE_BUS_SECONDARY_SHIFT) & 0xff;
+f010a510:	0f b6 c7             	movzbl %bh,%eax
+f010a513:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+	if (pci_show_devs)
+		cprintf("PCI: %02x:%02x.%d: bridge to PCI bus %d--%d\n",
+f010a516:	83 c4 08             	add    $0x8,%esp
+			pcif->bus->busno, pcif->dev, pcif->func,
+			nbus.busno,
+			(busreg >> PCI_BRIDGE_BUS_SUBORDINATE_SHIFT) & 0xff);
+f010a519:	c1 eb 10             	shr    $0x10,%ebx
+		cprintf("PCI: %02x:%02x.%d: bridge to PCI bus %d--%d\n",
+f010a51c:	0f b6 db             	movzbl %bl,%ebx
+f010a51f:	53                   	push   %ebx
+f010a520:	50                   	push   %eax
+f010a521:	ff 76 08             	push   0x8(%esi)
+f010a524:	ff 76 04             	push   0x4(%esi)
+f010a527:	8b 06                	mov    (%esi),%eax
+f010a529:	ff 70 04             	push   0x4(%eax)
+f010a52c:	68 78 ca 10 f0       	push   $0xf010ca78
+f010a531:	e8 ab 9e ff ff       	call   f01043e1 <cprintf>
+
+	pci_scan_bus(&nbus);
+f010a536:	83 c4 20             	add    $0x20,%esp
+f010a539:	89 f8                	mov    %edi,%eax
+f010a53b:	e8 b9 fd ff ff       	call   f010a2f9 <pci_scan_bus>
+	return 1;
+f010a540:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+f010a545:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a548:	5b                   	pop    %ebx
+f010a549:	5e                   	pop    %esi
+f010a54a:	5f                   	pop    %edi
+f010a54b:	5d                   	pop    %ebp
+f010a54c:	c3                   	ret
+		cprintf("PCI: %02x:%02x.%d: 32-bit bridge IO not supported.\n",
+f010a54d:	ff 76 08             	push   0x8(%esi)
+f010a550:	ff 76 04             	push   0x4(%esi)
+f010a553:	8b 06                	mov    (%esi),%eax
+f010a555:	ff 70 04             	push   0x4(%eax)
+f010a558:	68 44 ca 10 f0       	push   $0xf010ca44
+f010a55d:	e8 7f 9e ff ff       	call   f01043e1 <cprintf>
+		return 0;
+f010a562:	83 c4 10             	add    $0x10,%esp
+f010a565:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a56a:	eb d9                	jmp    f010a545 <pci_bridge_attach+0x78>
+
+f010a56c <pci_conf_write>:
+{
+f010a56c:	55                   	push   %ebp
+f010a56d:	89 e5                	mov    %esp,%ebp
+f010a56f:	57                   	push   %edi
+f010a570:	56                   	push   %esi
+f010a571:	53                   	push   %ebx
+f010a572:	83 ec 18             	sub    $0x18,%esp
+f010a575:	89 d7                	mov    %edx,%edi
+f010a577:	89 ce                	mov    %ecx,%esi
+	pci_conf1_set_addr(f->bus->busno, f->dev, f->func, off);
+f010a579:	8b 48 08             	mov    0x8(%eax),%ecx
+f010a57c:	8b 50 04             	mov    0x4(%eax),%edx
+f010a57f:	8b 00                	mov    (%eax),%eax
+f010a581:	8b 40 04             	mov    0x4(%eax),%eax
+f010a584:	57                   	push   %edi
+f010a585:	e8 92 fc ff ff       	call   f010a21c <pci_conf1_set_addr>
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f010a58a:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+f010a58f:	89 f0                	mov    %esi,%eax
+f010a591:	ef                   	out    %eax,(%dx)
+}
+f010a592:	83 c4 10             	add    $0x10,%esp
+f010a595:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a598:	5b                   	pop    %ebx
+f010a599:	5e                   	pop    %esi
+f010a59a:	5f                   	pop    %edi
+f010a59b:	5d                   	pop    %ebp
+f010a59c:	c3                   	ret
+
+f010a59d <pci_func_enable>:
+
+// External PCI subsystem interface
+
+void
+pci_func_enable(struct pci_func *f)
+{
+f010a59d:	55                   	push   %ebp
+f010a59e:	89 e5                	mov    %esp,%ebp
+f010a5a0:	57                   	push   %edi
+f010a5a1:	56                   	push   %esi
+f010a5a2:	53                   	push   %ebx
+f010a5a3:	83 ec 1c             	sub    $0x1c,%esp
+f010a5a6:	8b 7d 08             	mov    0x8(%ebp),%edi
+	pci_conf_write(f, PCI_COMMAND_STATUS_REG,
+f010a5a9:	b9 07 00 00 00       	mov    $0x7,%ecx
+f010a5ae:	ba 04 00 00 00       	mov    $0x4,%edx
+f010a5b3:	89 f8                	mov    %edi,%eax
+f010a5b5:	e8 b2 ff ff ff       	call   f010a56c <pci_conf_write>
+		       PCI_COMMAND_MEM_ENABLE |
+		       PCI_COMMAND_MASTER_ENABLE);
+
+	uint32_t bar_width;
+	uint32_t bar;
+	for (bar = PCI_MAPREG_START; bar < PCI_MAPREG_END;
+f010a5ba:	be 10 00 00 00       	mov    $0x10,%esi
+f010a5bf:	eb 29                	jmp    f010a5ea <pci_func_enable+0x4d>
+			base = PCI_MAPREG_MEM_ADDR(oldv);
+			if (pci_show_addrs)
+				cprintf("  mem region %d: %d bytes at 0x%x\n",
+					regnum, size, base);
+		} else {
+			size = PCI_MAPREG_IO_SIZE(rv);
+f010a5c1:	89 d8                	mov    %ebx,%eax
+f010a5c3:	83 e0 fc             	and    $0xfffffffc,%eax
+f010a5c6:	f7 d8                	neg    %eax
+f010a5c8:	21 c3                	and    %eax,%ebx
+			base = PCI_MAPREG_IO_ADDR(oldv);
+f010a5ca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010a5cd:	83 e0 fc             	and    $0xfffffffc,%eax
+f010a5d0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+		bar_width = 4;
+f010a5d3:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+f010a5da:	eb 7a                	jmp    f010a656 <pci_func_enable+0xb9>
+	     bar += bar_width)
+f010a5dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010a5df:	01 c6                	add    %eax,%esi
+	for (bar = PCI_MAPREG_START; bar < PCI_MAPREG_END;
+f010a5e1:	83 fe 27             	cmp    $0x27,%esi
+f010a5e4:	0f 87 c7 00 00 00    	ja     f010a6b1 <pci_func_enable+0x114>
+		uint32_t oldv = pci_conf_read(f, bar);
+f010a5ea:	89 f2                	mov    %esi,%edx
+f010a5ec:	89 f8                	mov    %edi,%eax
+f010a5ee:	e8 e1 fc ff ff       	call   f010a2d4 <pci_conf_read>
+f010a5f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		pci_conf_write(f, bar, 0xffffffff);
+f010a5f6:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+f010a5fb:	89 f2                	mov    %esi,%edx
+f010a5fd:	89 f8                	mov    %edi,%eax
+f010a5ff:	e8 68 ff ff ff       	call   f010a56c <pci_conf_write>
+		uint32_t rv = pci_conf_read(f, bar);
+f010a604:	89 f2                	mov    %esi,%edx
+f010a606:	89 f8                	mov    %edi,%eax
+f010a608:	e8 c7 fc ff ff       	call   f010a2d4 <pci_conf_read>
+f010a60d:	89 c3                	mov    %eax,%ebx
+		bar_width = 4;
+f010a60f:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+		if (rv == 0)
+f010a616:	85 c0                	test   %eax,%eax
+f010a618:	74 c2                	je     f010a5dc <pci_func_enable+0x3f>
+		int regnum = PCI_MAPREG_NUM(bar);
+f010a61a:	8d 46 f0             	lea    -0x10(%esi),%eax
+f010a61d:	89 c2                	mov    %eax,%edx
+f010a61f:	c1 ea 02             	shr    $0x2,%edx
+f010a622:	89 55 d8             	mov    %edx,-0x28(%ebp)
+		if (PCI_MAPREG_TYPE(rv) == PCI_MAPREG_TYPE_MEM) {
+f010a625:	f6 c3 01             	test   $0x1,%bl
+f010a628:	75 97                	jne    f010a5c1 <pci_func_enable+0x24>
+			if (PCI_MAPREG_MEM_TYPE(rv) == PCI_MAPREG_MEM_TYPE_64BIT)
+f010a62a:	89 da                	mov    %ebx,%edx
+f010a62c:	83 e2 06             	and    $0x6,%edx
+		bar_width = 4;
+f010a62f:	83 fa 04             	cmp    $0x4,%edx
+f010a632:	0f 94 c1             	sete   %cl
+f010a635:	0f b6 c9             	movzbl %cl,%ecx
+f010a638:	8d 14 8d 04 00 00 00 	lea    0x4(,%ecx,4),%edx
+f010a63f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+			size = PCI_MAPREG_MEM_SIZE(rv);
+f010a642:	89 da                	mov    %ebx,%edx
+f010a644:	83 e2 f0             	and    $0xfffffff0,%edx
+f010a647:	89 d0                	mov    %edx,%eax
+f010a649:	f7 d8                	neg    %eax
+f010a64b:	21 c3                	and    %eax,%ebx
+			base = PCI_MAPREG_MEM_ADDR(oldv);
+f010a64d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010a650:	83 e0 f0             	and    $0xfffffff0,%eax
+f010a653:	89 45 dc             	mov    %eax,-0x24(%ebp)
+			if (pci_show_addrs)
+				cprintf("  io region %d: %d bytes at 0x%x\n",
+					regnum, size, base);
+		}
+
+		pci_conf_write(f, bar, oldv);
+f010a656:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f010a659:	89 f2                	mov    %esi,%edx
+f010a65b:	89 f8                	mov    %edi,%eax
+f010a65d:	e8 0a ff ff ff       	call   f010a56c <pci_conf_write>
+		f->reg_base[regnum] = base;
+f010a662:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f010a665:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f010a668:	89 44 8f 14          	mov    %eax,0x14(%edi,%ecx,4)
+		f->reg_size[regnum] = size;
+f010a66c:	89 5c 8f 2c          	mov    %ebx,0x2c(%edi,%ecx,4)
+
+		if (size && !base)
+f010a670:	85 db                	test   %ebx,%ebx
+f010a672:	0f 84 64 ff ff ff    	je     f010a5dc <pci_func_enable+0x3f>
+f010a678:	85 c0                	test   %eax,%eax
+f010a67a:	0f 85 5c ff ff ff    	jne    f010a5dc <pci_func_enable+0x3f>
+			cprintf("PCI device %02x:%02x.%d (%04x:%04x) "
+				"may be misconfigured: "
+				"region %d: base 0x%x, size %d\n",
+				f->bus->busno, f->dev, f->func,
+				PCI_VENDOR(f->dev_id), PCI_PRODUCT(f->dev_id),
+f010a680:	8b 47 0c             	mov    0xc(%edi),%eax
+			cprintf("PCI device %02x:%02x.%d (%04x:%04x) "
+f010a683:	83 ec 0c             	sub    $0xc,%esp
+f010a686:	53                   	push   %ebx
+f010a687:	6a 00                	push   $0x0
+f010a689:	51                   	push   %ecx
+f010a68a:	89 c2                	mov    %eax,%edx
+f010a68c:	c1 ea 10             	shr    $0x10,%edx
+f010a68f:	52                   	push   %edx
+f010a690:	0f b7 c0             	movzwl %ax,%eax
+f010a693:	50                   	push   %eax
+f010a694:	ff 77 08             	push   0x8(%edi)
+f010a697:	ff 77 04             	push   0x4(%edi)
+f010a69a:	8b 07                	mov    (%edi),%eax
+f010a69c:	ff 70 04             	push   0x4(%eax)
+f010a69f:	68 a8 ca 10 f0       	push   $0xf010caa8
+f010a6a4:	e8 38 9d ff ff       	call   f01043e1 <cprintf>
+f010a6a9:	83 c4 30             	add    $0x30,%esp
+f010a6ac:	e9 2b ff ff ff       	jmp    f010a5dc <pci_func_enable+0x3f>
+				regnum, base, size);
+	}
+
+	cprintf("PCI function %02x:%02x.%d (%04x:%04x) enabled\n",
+		f->bus->busno, f->dev, f->func,
+		PCI_VENDOR(f->dev_id), PCI_PRODUCT(f->dev_id));
+f010a6b1:	8b 47 0c             	mov    0xc(%edi),%eax
+	cprintf("PCI function %02x:%02x.%d (%04x:%04x) enabled\n",
+f010a6b4:	83 ec 08             	sub    $0x8,%esp
+f010a6b7:	89 c2                	mov    %eax,%edx
+f010a6b9:	c1 ea 10             	shr    $0x10,%edx
+f010a6bc:	52                   	push   %edx
+f010a6bd:	0f b7 c0             	movzwl %ax,%eax
+f010a6c0:	50                   	push   %eax
+f010a6c1:	ff 77 08             	push   0x8(%edi)
+f010a6c4:	ff 77 04             	push   0x4(%edi)
+f010a6c7:	8b 07                	mov    (%edi),%eax
+f010a6c9:	ff 70 04             	push   0x4(%eax)
+f010a6cc:	68 04 cb 10 f0       	push   $0xf010cb04
+f010a6d1:	e8 0b 9d ff ff       	call   f01043e1 <cprintf>
+}
+f010a6d6:	83 c4 20             	add    $0x20,%esp
+f010a6d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010a6dc:	5b                   	pop    %ebx
+f010a6dd:	5e                   	pop    %esi
+f010a6de:	5f                   	pop    %edi
+f010a6df:	5d                   	pop    %ebp
+f010a6e0:	c3                   	ret
+
+f010a6e1 <pci_init>:
+
+int
+pci_init(void)
+{
+f010a6e1:	55                   	push   %ebp
+f010a6e2:	89 e5                	mov    %esp,%ebp
+f010a6e4:	83 ec 0c             	sub    $0xc,%esp
+	static struct pci_bus root_bus;
+	memset(&root_bus, 0, sizeof(root_bus));
+f010a6e7:	6a 08                	push   $0x8
+f010a6e9:	6a 00                	push   $0x0
+f010a6eb:	68 10 80 84 f0       	push   $0xf0848010
+f010a6f0:	e8 11 c7 ff ff       	call   f0106e06 <memset>
+
+	return pci_scan_bus(&root_bus);
+f010a6f5:	b8 10 80 84 f0       	mov    $0xf0848010,%eax
+f010a6fa:	e8 fa fb ff ff       	call   f010a2f9 <pci_scan_bus>
+}
+f010a6ff:	c9                   	leave
+f010a700:	c3                   	ret
+
+f010a701 <time_init>:
+static unsigned int ticks;
+
+void
+time_init(void)
+{
+	ticks = 0;
+f010a701:	c7 05 18 80 84 f0 00 	movl   $0x0,0xf0848018
+f010a708:	00 00 00 
+}
+f010a70b:	c3                   	ret
+
+f010a70c <time_tick>:
+// This should be called once per timer interrupt.  A timer interrupt
+// fires every 10 ms.
+void
+time_tick(void)
+{
+	ticks++;
+f010a70c:	a1 18 80 84 f0       	mov    0xf0848018,%eax
+f010a711:	83 c0 01             	add    $0x1,%eax
+f010a714:	a3 18 80 84 f0       	mov    %eax,0xf0848018
+	if (ticks * 10 < ticks)
+f010a719:	8d 14 80             	lea    (%eax,%eax,4),%edx
+f010a71c:	01 d2                	add    %edx,%edx
+f010a71e:	39 c2                	cmp    %eax,%edx
+f010a720:	72 01                	jb     f010a723 <time_tick+0x17>
+f010a722:	c3                   	ret
+{
+f010a723:	55                   	push   %ebp
+f010a724:	89 e5                	mov    %esp,%ebp
+f010a726:	83 ec 0c             	sub    $0xc,%esp
+		panic("time_tick: time overflowed");
+f010a729:	68 0c cc 10 f0       	push   $0xf010cc0c
+f010a72e:	6a 13                	push   $0x13
+f010a730:	68 27 cc 10 f0       	push   $0xf010cc27
+f010a735:	e8 0f 59 ff ff       	call   f0100049 <_panic>
+
+f010a73a <time_msec>:
+}
+
+unsigned int
+time_msec(void)
+{
+	return ticks * 10;
+f010a73a:	a1 18 80 84 f0       	mov    0xf0848018,%eax
+f010a73f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f010a742:	01 c0                	add    %eax,%eax
+}
+f010a744:	c3                   	ret
+
+f010a745 <dm>:
+f010a745:	55                   	push   %ebp
+f010a746:	57                   	push   %edi
+f010a747:	56                   	push   %esi
+f010a748:	53                   	push   %ebx
+f010a749:	83 ec 24             	sub    $0x24,%esp
+f010a74c:	89 44 24 08          	mov    %eax,0x8(%esp)
+f010a750:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f010a754:	8b 44 24 38          	mov    0x38(%esp),%eax
+f010a758:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f010a75c:	89 44 24 10          	mov    %eax,0x10(%esp)
+f010a760:	89 54 24 14          	mov    %edx,0x14(%esp)
+f010a764:	8b 7c 24 40          	mov    0x40(%esp),%edi
+f010a768:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f010a76d:	b8 00 00 00 00       	mov    $0x0,%eax
+f010a772:	ba 00 00 00 00       	mov    $0x0,%edx
+f010a777:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+f010a77e:	00 
+f010a77f:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+f010a786:	00 
+f010a787:	89 fb                	mov    %edi,%ebx
+f010a789:	eb 08                	jmp    f010a793 <dm+0x4e>
+f010a78b:	83 e9 01             	sub    $0x1,%ecx
+f010a78e:	83 f9 ff             	cmp    $0xffffffff,%ecx
+f010a791:	74 68                	je     f010a7fb <dm+0xb6>
+f010a793:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f010a797:	01 c0                	add    %eax,%eax
+f010a799:	89 c6                	mov    %eax,%esi
+f010a79b:	89 d7                	mov    %edx,%edi
+f010a79d:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010a7a1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f010a7a5:	0f ad d0             	shrd   %cl,%edx,%eax
+f010a7a8:	d3 ea                	shr    %cl,%edx
+f010a7aa:	f6 c1 20             	test   $0x20,%cl
+f010a7ad:	74 04                	je     f010a7b3 <dm+0x6e>
+f010a7af:	89 d0                	mov    %edx,%eax
+f010a7b1:	31 d2                	xor    %edx,%edx
+f010a7b3:	83 e0 01             	and    $0x1,%eax
+f010a7b6:	89 04 24             	mov    %eax,(%esp)
+f010a7b9:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+f010a7c0:	00 
+f010a7c1:	8b 04 24             	mov    (%esp),%eax
+f010a7c4:	8b 54 24 04          	mov    0x4(%esp),%edx
+f010a7c8:	09 f0                	or     %esi,%eax
+f010a7ca:	09 fa                	or     %edi,%edx
+f010a7cc:	8b 74 24 10          	mov    0x10(%esp),%esi
+f010a7d0:	8b 7c 24 14          	mov    0x14(%esp),%edi
+f010a7d4:	39 f0                	cmp    %esi,%eax
+f010a7d6:	89 d5                	mov    %edx,%ebp
+f010a7d8:	19 fd                	sbb    %edi,%ebp
+f010a7da:	72 af                	jb     f010a78b <dm+0x46>
+f010a7dc:	29 f0                	sub    %esi,%eax
+f010a7de:	19 fa                	sbb    %edi,%edx
+f010a7e0:	89 cf                	mov    %ecx,%edi
+f010a7e2:	c1 ef 05             	shr    $0x5,%edi
+f010a7e5:	83 e7 01             	and    $0x1,%edi
+f010a7e8:	89 fe                	mov    %edi,%esi
+f010a7ea:	83 f6 01             	xor    $0x1,%esi
+f010a7ed:	d3 e6                	shl    %cl,%esi
+f010a7ef:	d3 e7                	shl    %cl,%edi
+f010a7f1:	09 74 24 18          	or     %esi,0x18(%esp)
+f010a7f5:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+f010a7f9:	eb 90                	jmp    f010a78b <dm+0x46>
+f010a7fb:	85 db                	test   %ebx,%ebx
+f010a7fd:	74 05                	je     f010a804 <dm+0xbf>
+f010a7ff:	89 03                	mov    %eax,(%ebx)
+f010a801:	89 53 04             	mov    %edx,0x4(%ebx)
+f010a804:	8b 44 24 18          	mov    0x18(%esp),%eax
+f010a808:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f010a80c:	83 c4 24             	add    $0x24,%esp
+f010a80f:	5b                   	pop    %ebx
+f010a810:	5e                   	pop    %esi
+f010a811:	5f                   	pop    %edi
+f010a812:	5d                   	pop    %ebp
+f010a813:	c3                   	ret
+
+f010a814 <__udivdi3>:
+f010a814:	83 ec 08             	sub    $0x8,%esp
+f010a817:	6a 00                	push   $0x0
+f010a819:	ff 74 24 1c          	push   0x1c(%esp)
+f010a81d:	ff 74 24 1c          	push   0x1c(%esp)
+f010a821:	8b 44 24 18          	mov    0x18(%esp),%eax
+f010a825:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f010a829:	e8 17 ff ff ff       	call   f010a745 <dm>
+f010a82e:	83 c4 14             	add    $0x14,%esp
+f010a831:	c3                   	ret
+
+f010a832 <__umoddi3>:
+f010a832:	83 ec 18             	sub    $0x18,%esp
+f010a835:	8d 44 24 0c          	lea    0xc(%esp),%eax
+f010a839:	50                   	push   %eax
+f010a83a:	ff 74 24 2c          	push   0x2c(%esp)
+f010a83e:	ff 74 24 2c          	push   0x2c(%esp)
+f010a842:	8b 44 24 28          	mov    0x28(%esp),%eax
+f010a846:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f010a84a:	e8 f6 fe ff ff       	call   f010a745 <dm>
+f010a84f:	8b 44 24 18          	mov    0x18(%esp),%eax
+f010a853:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f010a857:	83 c4 24             	add    $0x24,%esp
+f010a85a:	c3                   	ret
+
+f010a85b <__divdi3>:
+f010a85b:	53                   	push   %ebx
+f010a85c:	8b 44 24 08          	mov    0x8(%esp),%eax
+f010a860:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f010a864:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+f010a868:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+f010a86c:	85 d2                	test   %edx,%edx
+f010a86e:	78 15                	js     f010a885 <__divdi3+0x2a>
+f010a870:	85 db                	test   %ebx,%ebx
+f010a872:	78 34                	js     f010a8a8 <__divdi3+0x4d>
+f010a874:	83 ec 04             	sub    $0x4,%esp
+f010a877:	6a 00                	push   $0x0
+f010a879:	53                   	push   %ebx
+f010a87a:	51                   	push   %ecx
+f010a87b:	e8 c5 fe ff ff       	call   f010a745 <dm>
+f010a880:	83 c4 10             	add    $0x10,%esp
+f010a883:	eb 21                	jmp    f010a8a6 <__divdi3+0x4b>
+f010a885:	f7 d8                	neg    %eax
+f010a887:	83 d2 00             	adc    $0x0,%edx
+f010a88a:	f7 da                	neg    %edx
+f010a88c:	85 db                	test   %ebx,%ebx
+f010a88e:	78 30                	js     f010a8c0 <__divdi3+0x65>
+f010a890:	83 ec 04             	sub    $0x4,%esp
+f010a893:	6a 00                	push   $0x0
+f010a895:	53                   	push   %ebx
+f010a896:	51                   	push   %ecx
+f010a897:	e8 a9 fe ff ff       	call   f010a745 <dm>
+f010a89c:	83 c4 10             	add    $0x10,%esp
+f010a89f:	f7 d8                	neg    %eax
+f010a8a1:	83 d2 00             	adc    $0x0,%edx
+f010a8a4:	f7 da                	neg    %edx
+f010a8a6:	5b                   	pop    %ebx
+f010a8a7:	c3                   	ret
+f010a8a8:	83 ec 04             	sub    $0x4,%esp
+f010a8ab:	6a 00                	push   $0x0
+f010a8ad:	f7 d9                	neg    %ecx
+f010a8af:	83 d3 00             	adc    $0x0,%ebx
+f010a8b2:	f7 db                	neg    %ebx
+f010a8b4:	53                   	push   %ebx
+f010a8b5:	51                   	push   %ecx
+f010a8b6:	e8 8a fe ff ff       	call   f010a745 <dm>
+f010a8bb:	83 c4 10             	add    $0x10,%esp
+f010a8be:	eb df                	jmp    f010a89f <__divdi3+0x44>
+f010a8c0:	83 ec 04             	sub    $0x4,%esp
+f010a8c3:	6a 00                	push   $0x0
+f010a8c5:	f7 d9                	neg    %ecx
+f010a8c7:	83 d3 00             	adc    $0x0,%ebx
+f010a8ca:	f7 db                	neg    %ebx
+f010a8cc:	53                   	push   %ebx
+f010a8cd:	51                   	push   %ecx
+f010a8ce:	e8 72 fe ff ff       	call   f010a745 <dm>
+f010a8d3:	83 c4 10             	add    $0x10,%esp
+f010a8d6:	eb ce                	jmp    f010a8a6 <__divdi3+0x4b>
+
+f010a8d8 <__moddi3>:
+f010a8d8:	55                   	push   %ebp
+f010a8d9:	57                   	push   %edi
+f010a8da:	56                   	push   %esi
+f010a8db:	53                   	push   %ebx
+f010a8dc:	83 ec 24             	sub    $0x24,%esp
+f010a8df:	8b 44 24 38          	mov    0x38(%esp),%eax
+f010a8e3:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f010a8e7:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+f010a8eb:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+f010a8ef:	85 d2                	test   %edx,%edx
+f010a8f1:	78 3b                	js     f010a92e <__moddi3+0x56>
+f010a8f3:	83 ec 04             	sub    $0x4,%esp
+f010a8f6:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+f010a8fa:	56                   	push   %esi
+f010a8fb:	89 ce                	mov    %ecx,%esi
+f010a8fd:	f7 de                	neg    %esi
+f010a8ff:	89 74 24 08          	mov    %esi,0x8(%esp)
+f010a903:	89 de                	mov    %ebx,%esi
+f010a905:	83 d6 00             	adc    $0x0,%esi
+f010a908:	f7 de                	neg    %esi
+f010a90a:	89 74 24 14          	mov    %esi,0x14(%esp)
+f010a90e:	8b 74 24 08          	mov    0x8(%esp),%esi
+f010a912:	0f 48 f1             	cmovs  %ecx,%esi
+f010a915:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+f010a91a:	53                   	push   %ebx
+f010a91b:	56                   	push   %esi
+f010a91c:	e8 24 fe ff ff       	call   f010a745 <dm>
+f010a921:	8b 44 24 28          	mov    0x28(%esp),%eax
+f010a925:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f010a929:	83 c4 10             	add    $0x10,%esp
+f010a92c:	eb 47                	jmp    f010a975 <__moddi3+0x9d>
+f010a92e:	f7 d8                	neg    %eax
+f010a930:	83 d2 00             	adc    $0x0,%edx
+f010a933:	f7 da                	neg    %edx
+f010a935:	83 ec 04             	sub    $0x4,%esp
+f010a938:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+f010a93c:	56                   	push   %esi
+f010a93d:	89 cf                	mov    %ecx,%edi
+f010a93f:	f7 df                	neg    %edi
+f010a941:	89 de                	mov    %ebx,%esi
+f010a943:	83 d6 00             	adc    $0x0,%esi
+f010a946:	f7 de                	neg    %esi
+f010a948:	0f 49 cf             	cmovns %edi,%ecx
+f010a94b:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+f010a94f:	0f 49 de             	cmovns %esi,%ebx
+f010a952:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+f010a956:	ff 74 24 0c          	push   0xc(%esp)
+f010a95a:	ff 74 24 0c          	push   0xc(%esp)
+f010a95e:	e8 e2 fd ff ff       	call   f010a745 <dm>
+f010a963:	8b 44 24 28          	mov    0x28(%esp),%eax
+f010a967:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f010a96b:	f7 d8                	neg    %eax
+f010a96d:	83 d2 00             	adc    $0x0,%edx
+f010a970:	f7 da                	neg    %edx
+f010a972:	83 c4 10             	add    $0x10,%esp
+f010a975:	83 c4 24             	add    $0x24,%esp
+f010a978:	5b                   	pop    %ebx
+f010a979:	5e                   	pop    %esi
+f010a97a:	5f                   	pop    %edi
+f010a97b:	5d                   	pop    %ebp
+f010a97c:	c3                   	ret
@@ -0,0 +1,8713 @@
+
+obj/net/testinput:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8b 09 00 00       	call   8009bc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	envid_t ns_envid = sys_getenvid();
+  80003f:	e8 6a 14 00 00       	call   8014ae <sys_getenvid>
+  800044:	89 c3                	mov    %eax,%ebx
+	int i, r, first = 1;
+
+	binaryname = "testinput";
+  800046:	c7 05 00 50 80 00 c0 	movl   $0x8040c0,0x805000
+  80004d:	40 80 00 
+
+	output_envid = fork();
+  800050:	e8 fa 19 00 00       	call   801a4f <fork>
+  800055:	a3 04 60 80 00       	mov    %eax,0x806004
+	if (output_envid < 0)
+  80005a:	85 c0                	test   %eax,%eax
+  80005c:	0f 88 74 01 00 00    	js     8001d6 <umain+0x1a3>
+		panic("error forking");
+	else if (output_envid == 0) {
+  800062:	0f 84 82 01 00 00    	je     8001ea <umain+0x1b7>
+		output(ns_envid);
+		return;
+	}
+
+	input_envid = fork();
+  800068:	e8 e2 19 00 00       	call   801a4f <fork>
+  80006d:	a3 00 60 80 00       	mov    %eax,0x806000
+	if (input_envid < 0)
+  800072:	85 c0                	test   %eax,%eax
+  800074:	0f 88 84 01 00 00    	js     8001fe <umain+0x1cb>
+		panic("error forking");
+	else if (input_envid == 0) {
+  80007a:	0f 84 92 01 00 00    	je     800212 <umain+0x1df>
+		input(ns_envid);
+		return;
+	}
+
+	cprintf("Sending ARP announcement...\n");
+  800080:	83 ec 0c             	sub    $0xc,%esp
+  800083:	68 e8 40 80 00       	push   $0x8040e8
+  800088:	e8 6d 0a 00 00       	call   800afa <cprintf>
+	uint8_t mac[6] = {0x52, 0x54, 0x00, 0x12, 0x34, 0x56};
+  80008d:	c7 45 98 52 54 00 12 	movl   $0x12005452,-0x68(%ebp)
+  800094:	66 c7 45 9c 34 56    	movw   $0x5634,-0x64(%ebp)
+	uint32_t myip = inet_addr(IP);
+  80009a:	c7 04 24 05 41 80 00 	movl   $0x804105,(%esp)
+  8000a1:	e8 dc 08 00 00       	call   800982 <inet_addr>
+  8000a6:	89 45 90             	mov    %eax,-0x70(%ebp)
+	uint32_t gwip = inet_addr(DEFAULT);
+  8000a9:	c7 04 24 0f 41 80 00 	movl   $0x80410f,(%esp)
+  8000b0:	e8 cd 08 00 00       	call   800982 <inet_addr>
+  8000b5:	89 45 94             	mov    %eax,-0x6c(%ebp)
+	if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
+  8000b8:	83 c4 0c             	add    $0xc,%esp
+  8000bb:	6a 07                	push   $0x7
+  8000bd:	68 00 f0 eb 0f       	push   $0xfebf000
+  8000c2:	6a 00                	push   $0x0
+  8000c4:	e8 2b 14 00 00       	call   8014f4 <sys_page_alloc>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+  8000cc:	85 c0                	test   %eax,%eax
+  8000ce:	0f 88 4c 01 00 00    	js     800220 <umain+0x1ed>
+	pkt->jp_len = sizeof(*arp);
+  8000d4:	c7 05 00 f0 eb 0f 2a 	movl   $0x2a,0xfebf000
+  8000db:	00 00 00 
+	memset(arp->ethhdr.dest.addr, 0xff, ETHARP_HWADDR_LEN);
+  8000de:	83 ec 04             	sub    $0x4,%esp
+  8000e1:	6a 06                	push   $0x6
+  8000e3:	68 ff 00 00 00       	push   $0xff
+  8000e8:	68 08 f0 eb 0f       	push   $0xfebf008
+  8000ed:	e8 47 11 00 00       	call   801239 <memset>
+	memcpy(arp->ethhdr.src.addr,  mac,  ETHARP_HWADDR_LEN);
+  8000f2:	83 c4 0c             	add    $0xc,%esp
+  8000f5:	6a 06                	push   $0x6
+  8000f7:	8d 5d 98             	lea    -0x68(%ebp),%ebx
+  8000fa:	53                   	push   %ebx
+  8000fb:	68 0e f0 eb 0f       	push   $0xfebf00e
+  800100:	e8 cb 11 00 00       	call   8012d0 <memcpy>
+	arp->ethhdr.type = htons(ETHTYPE_ARP);
+  800105:	c7 04 24 06 08 00 00 	movl   $0x806,(%esp)
+  80010c:	e8 53 06 00 00       	call   800764 <htons>
+  800111:	66 a3 14 f0 eb 0f    	mov    %ax,0xfebf014
+	arp->hwtype = htons(1); // Ethernet
+  800117:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80011e:	e8 41 06 00 00       	call   800764 <htons>
+  800123:	66 a3 16 f0 eb 0f    	mov    %ax,0xfebf016
+	arp->proto = htons(ETHTYPE_IP);
+  800129:	c7 04 24 00 08 00 00 	movl   $0x800,(%esp)
+  800130:	e8 2f 06 00 00       	call   800764 <htons>
+  800135:	66 a3 18 f0 eb 0f    	mov    %ax,0xfebf018
+	arp->_hwlen_protolen = htons((ETHARP_HWADDR_LEN << 8) | 4);
+  80013b:	c7 04 24 04 06 00 00 	movl   $0x604,(%esp)
+  800142:	e8 1d 06 00 00       	call   800764 <htons>
+  800147:	66 a3 1a f0 eb 0f    	mov    %ax,0xfebf01a
+	arp->opcode = htons(ARP_REQUEST);
+  80014d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800154:	e8 0b 06 00 00       	call   800764 <htons>
+  800159:	66 a3 1c f0 eb 0f    	mov    %ax,0xfebf01c
+	memcpy(arp->shwaddr.addr,  mac,   ETHARP_HWADDR_LEN);
+  80015f:	83 c4 0c             	add    $0xc,%esp
+  800162:	6a 06                	push   $0x6
+  800164:	53                   	push   %ebx
+  800165:	68 1e f0 eb 0f       	push   $0xfebf01e
+  80016a:	e8 61 11 00 00       	call   8012d0 <memcpy>
+	memcpy(arp->sipaddr.addrw, &myip, 4);
+  80016f:	83 c4 0c             	add    $0xc,%esp
+  800172:	6a 04                	push   $0x4
+  800174:	8d 45 90             	lea    -0x70(%ebp),%eax
+  800177:	50                   	push   %eax
+  800178:	68 24 f0 eb 0f       	push   $0xfebf024
+  80017d:	e8 4e 11 00 00       	call   8012d0 <memcpy>
+	memset(arp->dhwaddr.addr,  0x00,  ETHARP_HWADDR_LEN);
+  800182:	83 c4 0c             	add    $0xc,%esp
+  800185:	6a 06                	push   $0x6
+  800187:	6a 00                	push   $0x0
+  800189:	68 28 f0 eb 0f       	push   $0xfebf028
+  80018e:	e8 a6 10 00 00       	call   801239 <memset>
+	memcpy(arp->dipaddr.addrw, &gwip, 4);
+  800193:	83 c4 0c             	add    $0xc,%esp
+  800196:	6a 04                	push   $0x4
+  800198:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  80019b:	50                   	push   %eax
+  80019c:	68 2e f0 eb 0f       	push   $0xfebf02e
+  8001a1:	e8 2a 11 00 00       	call   8012d0 <memcpy>
+	ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
+  8001a6:	6a 07                	push   $0x7
+  8001a8:	68 00 f0 eb 0f       	push   $0xfebf000
+  8001ad:	6a 0b                	push   $0xb
+  8001af:	ff 35 04 60 80 00    	push   0x806004
+  8001b5:	e8 bb 1a 00 00       	call   801c75 <ipc_send>
+	sys_page_unmap(0, pkt);
+  8001ba:	83 c4 18             	add    $0x18,%esp
+  8001bd:	68 00 f0 eb 0f       	push   $0xfebf000
+  8001c2:	6a 00                	push   $0x0
+  8001c4:	e8 b8 13 00 00       	call   801581 <sys_page_unmap>
+}
+  8001c9:	83 c4 10             	add    $0x10,%esp
+	int i, r, first = 1;
+  8001cc:	be 01 00 00 00       	mov    $0x1,%esi
+}
+  8001d1:	e9 e8 01 00 00       	jmp    8003be <umain+0x38b>
+		panic("error forking");
+  8001d6:	83 ec 04             	sub    $0x4,%esp
+  8001d9:	68 ca 40 80 00       	push   $0x8040ca
+  8001de:	6a 4d                	push   $0x4d
+  8001e0:	68 d8 40 80 00       	push   $0x8040d8
+  8001e5:	e8 35 08 00 00       	call   800a1f <_panic>
+		output(ns_envid);
+  8001ea:	83 ec 0c             	sub    $0xc,%esp
+  8001ed:	53                   	push   %ebx
+  8001ee:	e8 3b 03 00 00       	call   80052e <output>
+		return;
+  8001f3:	83 c4 10             	add    $0x10,%esp
+		// we've received the ARP reply
+		if (first)
+			cprintf("Waiting for packets...\n");
+		first = 0;
+	}
+}
+  8001f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001f9:	5b                   	pop    %ebx
+  8001fa:	5e                   	pop    %esi
+  8001fb:	5f                   	pop    %edi
+  8001fc:	5d                   	pop    %ebp
+  8001fd:	c3                   	ret
+		panic("error forking");
+  8001fe:	83 ec 04             	sub    $0x4,%esp
+  800201:	68 ca 40 80 00       	push   $0x8040ca
+  800206:	6a 55                	push   $0x55
+  800208:	68 d8 40 80 00       	push   $0x8040d8
+  80020d:	e8 0d 08 00 00       	call   800a1f <_panic>
+		input(ns_envid);
+  800212:	83 ec 0c             	sub    $0xc,%esp
+  800215:	53                   	push   %ebx
+  800216:	e8 96 02 00 00       	call   8004b1 <input>
+		return;
+  80021b:	83 c4 10             	add    $0x10,%esp
+  80021e:	eb d6                	jmp    8001f6 <umain+0x1c3>
+		panic("sys_page_map: %e", r);
+  800220:	50                   	push   %eax
+  800221:	68 18 41 80 00       	push   $0x804118
+  800226:	6a 19                	push   $0x19
+  800228:	68 d8 40 80 00       	push   $0x8040d8
+  80022d:	e8 ed 07 00 00       	call   800a1f <_panic>
+			panic("ipc_recv: %e", req);
+  800232:	50                   	push   %eax
+  800233:	68 29 41 80 00       	push   $0x804129
+  800238:	6a 64                	push   $0x64
+  80023a:	68 d8 40 80 00       	push   $0x8040d8
+  80023f:	e8 db 07 00 00       	call   800a1f <_panic>
+			panic("IPC from unexpected environment %08x", whom);
+  800244:	52                   	push   %edx
+  800245:	68 80 41 80 00       	push   $0x804180
+  80024a:	6a 66                	push   $0x66
+  80024c:	68 d8 40 80 00       	push   $0x8040d8
+  800251:	e8 c9 07 00 00       	call   800a1f <_panic>
+			panic("Unexpected IPC %d", req);
+  800256:	50                   	push   %eax
+  800257:	68 36 41 80 00       	push   $0x804136
+  80025c:	6a 68                	push   $0x68
+  80025e:	68 d8 40 80 00       	push   $0x8040d8
+  800263:	e8 b7 07 00 00       	call   800a1f <_panic>
+			out = buf + snprintf(buf, end - buf,
+  800268:	83 ec 0c             	sub    $0xc,%esp
+  80026b:	53                   	push   %ebx
+  80026c:	68 48 41 80 00       	push   $0x804148
+  800271:	68 50 41 80 00       	push   $0x804150
+  800276:	6a 50                	push   $0x50
+  800278:	8d 45 98             	lea    -0x68(%ebp),%eax
+  80027b:	50                   	push   %eax
+  80027c:	e8 12 0e 00 00       	call   801093 <snprintf>
+  800281:	8d 4d 98             	lea    -0x68(%ebp),%ecx
+  800284:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+  800287:	83 c4 20             	add    $0x20,%esp
+  80028a:	eb 40                	jmp    8002cc <umain+0x299>
+			cprintf("%.*s\n", out - buf, buf);
+  80028c:	83 ec 04             	sub    $0x4,%esp
+  80028f:	8d 45 98             	lea    -0x68(%ebp),%eax
+  800292:	50                   	push   %eax
+  800293:	89 f0                	mov    %esi,%eax
+  800295:	8d 4d 98             	lea    -0x68(%ebp),%ecx
+  800298:	29 c8                	sub    %ecx,%eax
+  80029a:	50                   	push   %eax
+  80029b:	68 5f 41 80 00       	push   $0x80415f
+  8002a0:	e8 55 08 00 00       	call   800afa <cprintf>
+  8002a5:	83 c4 10             	add    $0x10,%esp
+		if (i % 2 == 1)
+  8002a8:	89 da                	mov    %ebx,%edx
+  8002aa:	c1 ea 1f             	shr    $0x1f,%edx
+  8002ad:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  8002b0:	83 e0 01             	and    $0x1,%eax
+  8002b3:	29 d0                	sub    %edx,%eax
+  8002b5:	83 f8 01             	cmp    $0x1,%eax
+  8002b8:	74 52                	je     80030c <umain+0x2d9>
+		if (i % 16 == 7)
+  8002ba:	83 ff 07             	cmp    $0x7,%edi
+  8002bd:	74 55                	je     800314 <umain+0x2e1>
+	for (i = 0; i < len; i++) {
+  8002bf:	83 c3 01             	add    $0x1,%ebx
+  8002c2:	39 5d 84             	cmp    %ebx,-0x7c(%ebp)
+  8002c5:	7e 55                	jle    80031c <umain+0x2e9>
+		if (i % 16 == 0)
+  8002c7:	f6 c3 0f             	test   $0xf,%bl
+  8002ca:	74 9c                	je     800268 <umain+0x235>
+		out += snprintf(out, end - out, "%02x", ((uint8_t*)data)[i]);
+  8002cc:	8b 45 80             	mov    -0x80(%ebp),%eax
+  8002cf:	0f b6 44 18 08       	movzbl 0x8(%eax,%ebx,1),%eax
+  8002d4:	50                   	push   %eax
+  8002d5:	68 5a 41 80 00       	push   $0x80415a
+  8002da:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  8002dd:	29 f0                	sub    %esi,%eax
+  8002df:	50                   	push   %eax
+  8002e0:	56                   	push   %esi
+  8002e1:	e8 ad 0d 00 00       	call   801093 <snprintf>
+  8002e6:	01 c6                	add    %eax,%esi
+		if (i % 16 == 15 || i == len - 1)
+  8002e8:	89 d8                	mov    %ebx,%eax
+  8002ea:	c1 f8 1f             	sar    $0x1f,%eax
+  8002ed:	c1 e8 1c             	shr    $0x1c,%eax
+  8002f0:	8d 3c 03             	lea    (%ebx,%eax,1),%edi
+  8002f3:	83 e7 0f             	and    $0xf,%edi
+  8002f6:	29 c7                	sub    %eax,%edi
+  8002f8:	83 c4 10             	add    $0x10,%esp
+  8002fb:	83 ff 0f             	cmp    $0xf,%edi
+  8002fe:	74 8c                	je     80028c <umain+0x259>
+  800300:	8b 85 7c ff ff ff    	mov    -0x84(%ebp),%eax
+  800306:	39 c3                	cmp    %eax,%ebx
+  800308:	75 9e                	jne    8002a8 <umain+0x275>
+  80030a:	eb 80                	jmp    80028c <umain+0x259>
+			*(out++) = ' ';
+  80030c:	c6 06 20             	movb   $0x20,(%esi)
+  80030f:	8d 76 01             	lea    0x1(%esi),%esi
+  800312:	eb a6                	jmp    8002ba <umain+0x287>
+			*(out++) = ' ';
+  800314:	c6 06 20             	movb   $0x20,(%esi)
+  800317:	8d 76 01             	lea    0x1(%esi),%esi
+  80031a:	eb a3                	jmp    8002bf <umain+0x28c>
+			cprintf("\n");
+  80031c:	8b bd 74 ff ff ff    	mov    -0x8c(%ebp),%edi
+  800322:	83 ec 0c             	sub    $0xc,%esp
+  800325:	68 7b 41 80 00       	push   $0x80417b
+  80032a:	e8 cb 07 00 00       	call   800afa <cprintf>
+			i += JIF_PKT_NPAGES(p->jp_len) - 1;
+  80032f:	8b 85 78 ff ff ff    	mov    -0x88(%ebp),%eax
+  800335:	8b 80 00 f0 eb 0f    	mov    0xfebf000(%eax),%eax
+  80033b:	05 07 10 00 00       	add    $0x1007,%eax
+  800340:	c1 e8 0c             	shr    $0xc,%eax
+		for (i = 0; i < n; i++) {
+  800343:	01 c7                	add    %eax,%edi
+  800345:	83 c4 10             	add    $0x10,%esp
+  800348:	39 7d 94             	cmp    %edi,-0x6c(%ebp)
+  80034b:	7e 3b                	jle    800388 <umain+0x355>
+			struct jif_pkt *p = (struct jif_pkt *) ((char *) pkt + i * PGSIZE);
+  80034d:	89 f8                	mov    %edi,%eax
+  80034f:	c1 e0 0c             	shl    $0xc,%eax
+  800352:	89 85 78 ff ff ff    	mov    %eax,-0x88(%ebp)
+  800358:	8d 88 00 f0 eb 0f    	lea    0xfebf000(%eax),%ecx
+  80035e:	89 4d 80             	mov    %ecx,-0x80(%ebp)
+			hexdump("input: ", p->jp_data, p->jp_len);
+  800361:	8b 88 00 f0 eb 0f    	mov    0xfebf000(%eax),%ecx
+	char *out = NULL;
+  800367:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < len; i++) {
+  80036c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (i % 16 == 15 || i == len - 1)
+  800371:	8d 41 ff             	lea    -0x1(%ecx),%eax
+  800374:	89 85 7c ff ff ff    	mov    %eax,-0x84(%ebp)
+  80037a:	89 4d 84             	mov    %ecx,-0x7c(%ebp)
+  80037d:	89 bd 74 ff ff ff    	mov    %edi,-0x8c(%ebp)
+	for (i = 0; i < len; i++) {
+  800383:	e9 3a ff ff ff       	jmp    8002c2 <umain+0x28f>
+		for (i = 0; i < n; i++)
+  800388:	8b b5 70 ff ff ff    	mov    -0x90(%ebp),%esi
+  80038e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800393:	39 5d 94             	cmp    %ebx,-0x6c(%ebp)
+  800396:	7e 1d                	jle    8003b5 <umain+0x382>
+			sys_page_unmap(0, (char *) pkt + i * PGSIZE);
+  800398:	83 ec 08             	sub    $0x8,%esp
+  80039b:	89 d8                	mov    %ebx,%eax
+  80039d:	c1 e0 0c             	shl    $0xc,%eax
+  8003a0:	05 00 f0 eb 0f       	add    $0xfebf000,%eax
+  8003a5:	50                   	push   %eax
+  8003a6:	6a 00                	push   $0x0
+  8003a8:	e8 d4 11 00 00       	call   801581 <sys_page_unmap>
+		for (i = 0; i < n; i++)
+  8003ad:	83 c3 01             	add    $0x1,%ebx
+  8003b0:	83 c4 10             	add    $0x10,%esp
+  8003b3:	eb de                	jmp    800393 <umain+0x360>
+		if (first)
+  8003b5:	85 f6                	test   %esi,%esi
+  8003b7:	75 55                	jne    80040e <umain+0x3db>
+		first = 0;
+  8003b9:	be 00 00 00 00       	mov    $0x0,%esi
+		int perm, n = NSPKT_MAXPAGES;
+  8003be:	c7 45 94 10 00 00 00 	movl   $0x10,-0x6c(%ebp)
+		int32_t req = ipc_recvv((int32_t *)&whom, pkt, &n, &perm);
+  8003c5:	8d 45 90             	lea    -0x70(%ebp),%eax
+  8003c8:	50                   	push   %eax
+  8003c9:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8003cc:	50                   	push   %eax
+  8003cd:	68 00 f0 eb 0f       	push   $0xfebf000
+  8003d2:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  8003d5:	50                   	push   %eax
+  8003d6:	e8 f2 18 00 00       	call   801ccd <ipc_recvv>
+		if (req < 0)
+  8003db:	83 c4 10             	add    $0x10,%esp
+  8003de:	85 c0                	test   %eax,%eax
+  8003e0:	0f 88 4c fe ff ff    	js     800232 <umain+0x1ff>
+		if (whom != input_envid)
+  8003e6:	8b 55 8c             	mov    -0x74(%ebp),%edx
+  8003e9:	3b 15 00 60 80 00    	cmp    0x806000,%edx
+  8003ef:	0f 85 4f fe ff ff    	jne    800244 <umain+0x211>
+		if (req != NSREQ_INPUT)
+  8003f5:	83 f8 0a             	cmp    $0xa,%eax
+  8003f8:	0f 85 58 fe ff ff    	jne    800256 <umain+0x223>
+		for (i = 0; i < n; i++) {
+  8003fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800403:	89 b5 70 ff ff ff    	mov    %esi,-0x90(%ebp)
+  800409:	e9 3a ff ff ff       	jmp    800348 <umain+0x315>
+			cprintf("Waiting for packets...\n");
+  80040e:	83 ec 0c             	sub    $0xc,%esp
+  800411:	68 65 41 80 00       	push   $0x804165
+  800416:	e8 df 06 00 00       	call   800afa <cprintf>
+  80041b:	83 c4 10             	add    $0x10,%esp
+  80041e:	eb 99                	jmp    8003b9 <umain+0x386>
+
+00800420 <timer>:
+#include "ns.h"
+
+void
+timer(envid_t ns_envid, uint32_t initial_to) {
+  800420:	55                   	push   %ebp
+  800421:	89 e5                	mov    %esp,%ebp
+  800423:	57                   	push   %edi
+  800424:	56                   	push   %esi
+  800425:	53                   	push   %ebx
+  800426:	83 ec 1c             	sub    $0x1c,%esp
+  800429:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	uint32_t stop = sys_time_msec() + initial_to;
+  80042c:	e8 62 13 00 00       	call   801793 <sys_time_msec>
+  800431:	03 45 0c             	add    0xc(%ebp),%eax
+  800434:	89 c3                	mov    %eax,%ebx
+
+	binaryname = "ns_timer";
+  800436:	c7 05 00 50 80 00 a5 	movl   $0x8041a5,0x805000
+  80043d:	41 80 00 
+
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+
+		while (1) {
+			uint32_t to, whom;
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  800440:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  800443:	eb 05                	jmp    80044a <timer+0x2a>
+			sys_yield();
+  800445:	e8 8b 10 00 00       	call   8014d5 <sys_yield>
+		while((r = sys_time_msec()) < stop && r >= 0) {
+  80044a:	e8 44 13 00 00       	call   801793 <sys_time_msec>
+  80044f:	39 d8                	cmp    %ebx,%eax
+  800451:	73 16                	jae    800469 <timer+0x49>
+  800453:	85 c0                	test   %eax,%eax
+  800455:	79 ee                	jns    800445 <timer+0x25>
+			panic("sys_time_msec: %e", r);
+  800457:	50                   	push   %eax
+  800458:	68 ae 41 80 00       	push   $0x8041ae
+  80045d:	6a 0f                	push   $0xf
+  80045f:	68 c0 41 80 00       	push   $0x8041c0
+  800464:	e8 b6 05 00 00       	call   800a1f <_panic>
+		if (r < 0)
+  800469:	85 c0                	test   %eax,%eax
+  80046b:	78 ea                	js     800457 <timer+0x37>
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+  80046d:	6a 00                	push   $0x0
+  80046f:	6a 00                	push   $0x0
+  800471:	6a 0c                	push   $0xc
+  800473:	56                   	push   %esi
+  800474:	e8 fc 17 00 00       	call   801c75 <ipc_send>
+  800479:	83 c4 10             	add    $0x10,%esp
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  80047c:	83 ec 04             	sub    $0x4,%esp
+  80047f:	6a 00                	push   $0x0
+  800481:	6a 00                	push   $0x0
+  800483:	57                   	push   %edi
+  800484:	e8 81 17 00 00       	call   801c0a <ipc_recv>
+  800489:	89 c3                	mov    %eax,%ebx
+
+			if (whom != ns_envid) {
+  80048b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80048e:	83 c4 10             	add    $0x10,%esp
+  800491:	39 f0                	cmp    %esi,%eax
+  800493:	75 09                	jne    80049e <timer+0x7e>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+				continue;
+			}
+
+			stop = sys_time_msec() + to;
+  800495:	e8 f9 12 00 00       	call   801793 <sys_time_msec>
+  80049a:	01 c3                	add    %eax,%ebx
+			break;
+  80049c:	eb ac                	jmp    80044a <timer+0x2a>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+  80049e:	83 ec 08             	sub    $0x8,%esp
+  8004a1:	50                   	push   %eax
+  8004a2:	68 cc 41 80 00       	push   $0x8041cc
+  8004a7:	e8 4e 06 00 00       	call   800afa <cprintf>
+				continue;
+  8004ac:	83 c4 10             	add    $0x10,%esp
+  8004af:	eb cb                	jmp    80047c <timer+0x5c>
+
+008004b1 <input>:
+#include "ns.h"
+
+void
+input(envid_t ns_envid)
+{
+  8004b1:	55                   	push   %ebp
+  8004b2:	89 e5                	mov    %esp,%ebp
+  8004b4:	57                   	push   %edi
+  8004b5:	56                   	push   %esi
+  8004b6:	53                   	push   %ebx
+  8004b7:	83 ec 4c             	sub    $0x4c,%esp
+	uintptr_t pages[NSPKT_MAXPAGES];
+	int i, n;
+
+	binaryname = "ns_input";
+  8004ba:	c7 05 00 50 80 00 07 	movl   $0x804207,0x805000
+  8004c1:	42 80 00 
+				sys_net_wait(NET_WAIT_RX);
+			else
+				sys_yield();
+		for (i = 0; i < n; i++)
+			pages[i] = (PKTVA + i * PGSIZE) | PTE_U | PTE_P;
+		ipc_sendv(ns_envid, NSREQ_INPUT, pages, n);
+  8004c4:	8d 5d a8             	lea    -0x58(%ebp),%ebx
+  8004c7:	eb 3c                	jmp    800505 <input+0x54>
+				sys_yield();
+  8004c9:	e8 07 10 00 00       	call   8014d5 <sys_yield>
+  8004ce:	eb 35                	jmp    800505 <input+0x54>
+  8004d0:	8d 55 a8             	lea    -0x58(%ebp),%edx
+  8004d3:	8d b8 af fe 00 00    	lea    0xfeaf(%eax),%edi
+  8004d9:	c1 e7 0c             	shl    $0xc,%edi
+		while ((n = sys_net_recv_pages((void *) PKTVA, NSPKT_MAXPAGES)) <= 0)
+  8004dc:	b8 00 f0 ea 0f       	mov    $0xfeaf000,%eax
+  8004e1:	eb 0f                	jmp    8004f2 <input+0x41>
+			pages[i] = (PKTVA + i * PGSIZE) | PTE_U | PTE_P;
+  8004e3:	89 c1                	mov    %eax,%ecx
+  8004e5:	83 c9 05             	or     $0x5,%ecx
+  8004e8:	89 0a                	mov    %ecx,(%edx)
+		for (i = 0; i < n; i++)
+  8004ea:	05 00 10 00 00       	add    $0x1000,%eax
+  8004ef:	83 c2 04             	add    $0x4,%edx
+  8004f2:	39 f8                	cmp    %edi,%eax
+  8004f4:	75 ed                	jne    8004e3 <input+0x32>
+		ipc_sendv(ns_envid, NSREQ_INPUT, pages, n);
+  8004f6:	56                   	push   %esi
+  8004f7:	53                   	push   %ebx
+  8004f8:	6a 0a                	push   $0xa
+  8004fa:	ff 75 08             	push   0x8(%ebp)
+  8004fd:	e8 5e 18 00 00       	call   801d60 <ipc_sendv>
+		while ((n = sys_net_recv_pages((void *) PKTVA, NSPKT_MAXPAGES)) <= 0)
+  800502:	83 c4 10             	add    $0x10,%esp
+  800505:	83 ec 08             	sub    $0x8,%esp
+  800508:	6a 10                	push   $0x10
+  80050a:	68 00 f0 ea 0f       	push   $0xfeaf000
+  80050f:	e8 f7 12 00 00       	call   80180b <sys_net_recv_pages>
+  800514:	89 c6                	mov    %eax,%esi
+  800516:	83 c4 10             	add    $0x10,%esp
+  800519:	85 c0                	test   %eax,%eax
+  80051b:	7f b3                	jg     8004d0 <input+0x1f>
+			if (n == 0)
+  80051d:	75 aa                	jne    8004c9 <input+0x18>
+				sys_net_wait(NET_WAIT_RX);
+  80051f:	83 ec 0c             	sub    $0xc,%esp
+  800522:	6a 01                	push   $0x1
+  800524:	e8 5c 13 00 00       	call   801885 <sys_net_wait>
+  800529:	83 c4 10             	add    $0x10,%esp
+  80052c:	eb d7                	jmp    800505 <input+0x54>
+
+0080052e <output>:
+#include "ns.h"
+
+void
+output(envid_t ns_envid)
+{
+  80052e:	55                   	push   %ebp
+  80052f:	89 e5                	mov    %esp,%ebp
+  800531:	57                   	push   %edi
+  800532:	56                   	push   %esi
+  800533:	53                   	push   %ebx
+  800534:	81 ec ac 00 00 00    	sub    $0xac,%esp
+	struct net_sg pkts[NSPKT_MAXPAGES];
+	struct jif_pkt *pkt;
+	int i, n, m, npkts, sent, r;
+
+	binaryname = "ns_output";
+  80053a:	c7 05 00 50 80 00 10 	movl   $0x804210,0x805000
+  800541:	42 80 00 
+	// ring takes.
+	while (true) {
+		envid_t whom;
+		int perm;
+
+		n = NSPKT_MAXPAGES;
+  800544:	c7 85 64 ff ff ff 10 	movl   $0x10,-0x9c(%ebp)
+  80054b:	00 00 00 
+		r = ipc_recvv(&whom, (void *) PKTVA, &n, &perm);
+  80054e:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+  800554:	50                   	push   %eax
+  800555:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+  80055b:	50                   	push   %eax
+  80055c:	68 00 f0 ea 0f       	push   $0xfeaf000
+  800561:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  800567:	50                   	push   %eax
+  800568:	e8 60 17 00 00       	call   801ccd <ipc_recvv>
+		assert(r == NSREQ_OUTPUT);
+  80056d:	83 c4 10             	add    $0x10,%esp
+  800570:	83 f8 0b             	cmp    $0xb,%eax
+  800573:	0f 85 99 00 00 00    	jne    800612 <output+0xe4>
+		assert(whom == ns_envid);
+  800579:	8b 45 08             	mov    0x8(%ebp),%eax
+  80057c:	39 85 5c ff ff ff    	cmp    %eax,-0xa4(%ebp)
+  800582:	0f 85 a0 00 00 00    	jne    800628 <output+0xfa>
+		assert(perm & PTE_P);
+  800588:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+  80058e:	83 e0 01             	and    $0x1,%eax
+  800591:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  800597:	0f 84 a1 00 00 00    	je     80063e <output+0x110>
+
+		for (i = npkts = 0; i < n; i += m) {
+  80059d:	8b bd 64 ff ff ff    	mov    -0x9c(%ebp),%edi
+  8005a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ad:	89 bd 54 ff ff ff    	mov    %edi,-0xac(%ebp)
+  8005b3:	39 95 54 ff ff ff    	cmp    %edx,-0xac(%ebp)
+  8005b9:	0f 8e a6 00 00 00    	jle    800665 <output+0x137>
+			pkt = (struct jif_pkt *) (PKTVA + i * PGSIZE);
+  8005bf:	8d 82 af fe 00 00    	lea    0xfeaf(%edx),%eax
+  8005c5:	c1 e0 0c             	shl    $0xc,%eax
+			if (pkt->jp_len <= 0 || pkt->jp_len > NET_FRAME_MAX
+  8005c8:	8b 30                	mov    (%eax),%esi
+  8005ca:	8d 4e ff             	lea    -0x1(%esi),%ecx
+  8005cd:	81 f9 39 23 00 00    	cmp    $0x2339,%ecx
+  8005d3:	77 7f                	ja     800654 <output+0x126>
+			    || (m = JIF_PKT_NPAGES(pkt->jp_len)) > n - i) {
+  8005d5:	8d 8e 07 10 00 00    	lea    0x1007(%esi),%ecx
+  8005db:	c1 e9 0c             	shr    $0xc,%ecx
+  8005de:	89 cf                	mov    %ecx,%edi
+  8005e0:	89 8d 50 ff ff ff    	mov    %ecx,-0xb0(%ebp)
+  8005e6:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  8005ec:	29 d1                	sub    %edx,%ecx
+  8005ee:	39 f9                	cmp    %edi,%ecx
+  8005f0:	7c 62                	jl     800654 <output+0x126>
+				cprintf("ns_output: bad packet, %d bytes\n",
+					pkt->jp_len);
+				break;
+			}
+			pkts[npkts].sg_va = pkt->jp_data;
+  8005f2:	8d 70 08             	lea    0x8(%eax),%esi
+  8005f5:	89 b4 dd 68 ff ff ff 	mov    %esi,-0x98(%ebp,%ebx,8)
+			pkts[npkts].sg_len = pkt->jp_len;
+  8005fc:	8b 00                	mov    (%eax),%eax
+  8005fe:	89 84 dd 6c ff ff ff 	mov    %eax,-0x94(%ebp,%ebx,8)
+			npkts++;
+  800605:	83 c3 01             	add    $0x1,%ebx
+		for (i = npkts = 0; i < n; i += m) {
+  800608:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  80060e:	01 c2                	add    %eax,%edx
+  800610:	eb a1                	jmp    8005b3 <output+0x85>
+		assert(r == NSREQ_OUTPUT);
+  800612:	68 1a 42 80 00       	push   $0x80421a
+  800617:	68 2c 42 80 00       	push   $0x80422c
+  80061c:	6a 18                	push   $0x18
+  80061e:	68 41 42 80 00       	push   $0x804241
+  800623:	e8 f7 03 00 00       	call   800a1f <_panic>
+		assert(whom == ns_envid);
+  800628:	68 4e 42 80 00       	push   $0x80424e
+  80062d:	68 2c 42 80 00       	push   $0x80422c
+  800632:	6a 19                	push   $0x19
+  800634:	68 41 42 80 00       	push   $0x804241
+  800639:	e8 e1 03 00 00       	call   800a1f <_panic>
+		assert(perm & PTE_P);
+  80063e:	68 5f 42 80 00       	push   $0x80425f
+  800643:	68 2c 42 80 00       	push   $0x80422c
+  800648:	6a 1a                	push   $0x1a
+  80064a:	68 41 42 80 00       	push   $0x804241
+  80064f:	e8 cb 03 00 00       	call   800a1f <_panic>
+				cprintf("ns_output: bad packet, %d bytes\n",
+  800654:	83 ec 08             	sub    $0x8,%esp
+  800657:	56                   	push   %esi
+  800658:	68 6c 42 80 00       	push   $0x80426c
+  80065d:	e8 98 04 00 00       	call   800afa <cprintf>
+				break;
+  800662:	83 c4 10             	add    $0x10,%esp
+		}
+		for (i = 0; i < npkts; i += sent) {
+			sent = sys_net_send_batch(&pkts[i], npkts - i);
+			if (sent < 0) {
+				cprintf("ns_output: dropping packet: %e\n", sent);
+				sent = 1;
+  800665:	bf 00 00 00 00       	mov    $0x0,%edi
+  80066a:	eb 19                	jmp    800685 <output+0x157>
+				cprintf("ns_output: dropping packet: %e\n", sent);
+  80066c:	83 ec 08             	sub    $0x8,%esp
+  80066f:	50                   	push   %eax
+  800670:	68 90 42 80 00       	push   $0x804290
+  800675:	e8 80 04 00 00       	call   800afa <cprintf>
+				sent = 1;
+  80067a:	83 c4 10             	add    $0x10,%esp
+  80067d:	8b b5 4c ff ff ff    	mov    -0xb4(%ebp),%esi
+		for (i = 0; i < npkts; i += sent) {
+  800683:	01 f7                	add    %esi,%edi
+  800685:	39 df                	cmp    %ebx,%edi
+  800687:	0f 8d b7 fe ff ff    	jge    800544 <output+0x16>
+			sent = sys_net_send_batch(&pkts[i], npkts - i);
+  80068d:	83 ec 08             	sub    $0x8,%esp
+  800690:	89 d8                	mov    %ebx,%eax
+  800692:	29 f8                	sub    %edi,%eax
+  800694:	50                   	push   %eax
+  800695:	8d 84 fd 68 ff ff ff 	lea    -0x98(%ebp,%edi,8),%eax
+  80069c:	50                   	push   %eax
+  80069d:	e8 92 11 00 00       	call   801834 <sys_net_send_batch>
+  8006a2:	89 c6                	mov    %eax,%esi
+			if (sent < 0) {
+  8006a4:	83 c4 10             	add    $0x10,%esp
+  8006a7:	85 c0                	test   %eax,%eax
+  8006a9:	78 c1                	js     80066c <output+0x13e>
+			} else if (sent == 0)
+  8006ab:	75 d6                	jne    800683 <output+0x155>
+				sys_net_wait(NET_WAIT_TX);
+  8006ad:	83 ec 0c             	sub    $0xc,%esp
+  8006b0:	6a 02                	push   $0x2
+  8006b2:	e8 ce 11 00 00       	call   801885 <sys_net_wait>
+  8006b7:	83 c4 10             	add    $0x10,%esp
+  8006ba:	eb c7                	jmp    800683 <output+0x155>
+
+008006bc <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8006bc:	55                   	push   %ebp
+  8006bd:	89 e5                	mov    %esp,%ebp
+  8006bf:	57                   	push   %edi
+  8006c0:	56                   	push   %esi
+  8006c1:	53                   	push   %ebx
+  8006c2:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8006c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006c8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8006cb:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  8006ce:	b9 08 60 80 00       	mov    $0x806008,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  8006d3:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  8006d8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006db:	eb 31                	jmp    80070e <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  8006dd:	0f b6 c8             	movzbl %al,%ecx
+  8006e0:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  8006e5:	88 0a                	mov    %cl,(%edx)
+  8006e7:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  8006ea:	83 e8 01             	sub    $0x1,%eax
+  8006ed:	3c ff                	cmp    $0xff,%al
+  8006ef:	75 ec                	jne    8006dd <inet_ntoa+0x21>
+  8006f1:	0f b6 db             	movzbl %bl,%ebx
+  8006f4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8006f7:	01 d8                	add    %ebx,%eax
+  8006f9:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  8006fb:	8d 40 01             	lea    0x1(%eax),%eax
+  8006fe:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800701:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  800704:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  800707:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80070a:	39 c7                	cmp    %eax,%edi
+  80070c:	74 46                	je     800754 <inet_ntoa+0x98>
+  80070e:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  800711:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800716:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  800719:	89 f0                	mov    %esi,%eax
+  80071b:	f6 e2                	mul    %dl
+  80071d:	66 c1 e8 0b          	shr    $0xb,%ax
+  800721:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  800724:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  800727:	01 c9                	add    %ecx,%ecx
+  800729:	89 d0                	mov    %edx,%eax
+  80072b:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  80072d:	89 d7                	mov    %edx,%edi
+  80072f:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800733:	89 d9                	mov    %ebx,%ecx
+  800735:	83 c3 01             	add    $0x1,%ebx
+  800738:	0f b6 c9             	movzbl %cl,%ecx
+  80073b:	83 c0 30             	add    $0x30,%eax
+  80073e:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  800742:	89 f8                	mov    %edi,%eax
+  800744:	3c 09                	cmp    $0x9,%al
+  800746:	77 d1                	ja     800719 <inet_ntoa+0x5d>
+  800748:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80074b:	88 17                	mov    %dl,(%edi)
+  80074d:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800750:	89 d8                	mov    %ebx,%eax
+  800752:	eb 96                	jmp    8006ea <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  800754:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  800757:	b8 08 60 80 00       	mov    $0x806008,%eax
+  80075c:	83 c4 1c             	add    $0x1c,%esp
+  80075f:	5b                   	pop    %ebx
+  800760:	5e                   	pop    %esi
+  800761:	5f                   	pop    %edi
+  800762:	5d                   	pop    %ebp
+  800763:	c3                   	ret
+
+00800764 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  800764:	55                   	push   %ebp
+  800765:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  800767:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  80076b:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  80076f:	5d                   	pop    %ebp
+  800770:	c3                   	ret
+
+00800771 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  800771:	55                   	push   %ebp
+  800772:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  800774:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800778:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  80077c:	5d                   	pop    %ebp
+  80077d:	c3                   	ret
+
+0080077e <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  80077e:	55                   	push   %ebp
+  80077f:	89 e5                	mov    %esp,%ebp
+  800781:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  800784:	89 d0                	mov    %edx,%eax
+  800786:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  800789:	89 d1                	mov    %edx,%ecx
+  80078b:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  80078e:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  800790:	89 d1                	mov    %edx,%ecx
+  800792:	c1 e1 08             	shl    $0x8,%ecx
+  800795:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  80079b:	09 c8                	or     %ecx,%eax
+  80079d:	c1 ea 08             	shr    $0x8,%edx
+  8007a0:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8007a6:	09 d0                	or     %edx,%eax
+}
+  8007a8:	5d                   	pop    %ebp
+  8007a9:	c3                   	ret
+
+008007aa <inet_aton>:
+{
+  8007aa:	55                   	push   %ebp
+  8007ab:	89 e5                	mov    %esp,%ebp
+  8007ad:	57                   	push   %edi
+  8007ae:	56                   	push   %esi
+  8007af:	53                   	push   %ebx
+  8007b0:	83 ec 2c             	sub    $0x2c,%esp
+  8007b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8007b6:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8007b9:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8007bc:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8007bf:	e9 9b 00 00 00       	jmp    80085f <inet_aton+0xb5>
+      c = *++cp;
+  8007c4:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8007c8:	89 c1                	mov    %eax,%ecx
+  8007ca:	83 e1 df             	and    $0xffffffdf,%ecx
+  8007cd:	80 f9 58             	cmp    $0x58,%cl
+  8007d0:	74 10                	je     8007e2 <inet_aton+0x38>
+      c = *++cp;
+  8007d2:	83 c2 01             	add    $0x1,%edx
+  8007d5:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  8007d8:	bf 08 00 00 00       	mov    $0x8,%edi
+  8007dd:	e9 97 00 00 00       	jmp    800879 <inet_aton+0xcf>
+        c = *++cp;
+  8007e2:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  8007e6:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  8007e9:	bf 10 00 00 00       	mov    $0x10,%edi
+  8007ee:	e9 86 00 00 00       	jmp    800879 <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  8007f3:	0f af d7             	imul   %edi,%edx
+  8007f6:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  8007fa:	0f be 01             	movsbl (%ecx),%eax
+  8007fd:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  800800:	88 45 d7             	mov    %al,-0x29(%ebp)
+  800803:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  800806:	80 fb 09             	cmp    $0x9,%bl
+  800809:	76 e8                	jbe    8007f3 <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  80080b:	83 ff 10             	cmp    $0x10,%edi
+  80080e:	75 2e                	jne    80083e <inet_aton+0x94>
+  800810:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  800814:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  800817:	83 e3 df             	and    $0xffffffdf,%ebx
+  80081a:	83 eb 41             	sub    $0x41,%ebx
+  80081d:	80 fb 05             	cmp    $0x5,%bl
+  800820:	77 1c                	ja     80083e <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  800822:	c1 e2 04             	shl    $0x4,%edx
+  800825:	83 c0 0a             	add    $0xa,%eax
+  800828:	89 f3                	mov    %esi,%ebx
+  80082a:	80 fb 1a             	cmp    $0x1a,%bl
+  80082d:	19 db                	sbb    %ebx,%ebx
+  80082f:	83 e3 20             	and    $0x20,%ebx
+  800832:	83 c3 41             	add    $0x41,%ebx
+  800835:	29 d8                	sub    %ebx,%eax
+  800837:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  800839:	0f be 01             	movsbl (%ecx),%eax
+  80083c:	eb bf                	jmp    8007fd <inet_aton+0x53>
+    if (c == '.') {
+  80083e:	83 f8 2e             	cmp    $0x2e,%eax
+  800841:	75 43                	jne    800886 <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  800843:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800846:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800849:	39 f0                	cmp    %esi,%eax
+  80084b:	0f 84 22 01 00 00    	je     800973 <inet_aton+0x1c9>
+      *pp++ = val;
+  800851:	83 c0 04             	add    $0x4,%eax
+  800854:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800857:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  80085a:	89 ca                	mov    %ecx,%edx
+  80085c:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  80085f:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800862:	80 f9 09             	cmp    $0x9,%cl
+  800865:	0f 87 01 01 00 00    	ja     80096c <inet_aton+0x1c2>
+    base = 10;
+  80086b:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  800870:	83 f8 30             	cmp    $0x30,%eax
+  800873:	0f 84 4b ff ff ff    	je     8007c4 <inet_aton+0x1a>
+  800879:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  80087c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800881:	e9 7a ff ff ff       	jmp    800800 <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  800886:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  80088a:	89 d6                	mov    %edx,%esi
+  80088c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80088f:	85 c0                	test   %eax,%eax
+  800891:	74 2e                	je     8008c1 <inet_aton+0x117>
+    return (0);
+  800893:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  800898:	89 fa                	mov    %edi,%edx
+  80089a:	80 fa 1f             	cmp    $0x1f,%dl
+  80089d:	0f 86 d5 00 00 00    	jbe    800978 <inet_aton+0x1ce>
+  8008a3:	84 c0                	test   %al,%al
+  8008a5:	0f 88 cd 00 00 00    	js     800978 <inet_aton+0x1ce>
+  8008ab:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8008ae:	83 f9 04             	cmp    $0x4,%ecx
+  8008b1:	76 0e                	jbe    8008c1 <inet_aton+0x117>
+    return (0);
+  8008b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8008b8:	83 f8 20             	cmp    $0x20,%eax
+  8008bb:	0f 85 b7 00 00 00    	jne    800978 <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8008c1:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8008c4:	89 d8                	mov    %ebx,%eax
+  8008c6:	29 c8                	sub    %ecx,%eax
+  8008c8:	c1 f8 02             	sar    $0x2,%eax
+  8008cb:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  8008ce:	83 f8 02             	cmp    $0x2,%eax
+  8008d1:	74 7a                	je     80094d <inet_aton+0x1a3>
+  8008d3:	83 f9 03             	cmp    $0x3,%ecx
+  8008d6:	7f 49                	jg     800921 <inet_aton+0x177>
+  8008d8:	85 c9                	test   %ecx,%ecx
+  8008da:	0f 84 98 00 00 00    	je     800978 <inet_aton+0x1ce>
+  8008e0:	83 f9 02             	cmp    $0x2,%ecx
+  8008e3:	75 19                	jne    8008fe <inet_aton+0x154>
+      return (0);
+  8008e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  8008ea:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  8008f0:	0f 87 82 00 00 00    	ja     800978 <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  8008f6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8008f9:	c1 e0 18             	shl    $0x18,%eax
+  8008fc:	09 c6                	or     %eax,%esi
+  return (1);
+  8008fe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  800903:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800907:	74 6f                	je     800978 <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  800909:	83 ec 0c             	sub    $0xc,%esp
+  80090c:	56                   	push   %esi
+  80090d:	e8 6c fe ff ff       	call   80077e <htonl>
+  800912:	83 c4 10             	add    $0x10,%esp
+  800915:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800918:	89 06                	mov    %eax,(%esi)
+  return (1);
+  80091a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80091f:	eb 57                	jmp    800978 <inet_aton+0x1ce>
+  switch (n) {
+  800921:	83 f9 04             	cmp    $0x4,%ecx
+  800924:	75 d8                	jne    8008fe <inet_aton+0x154>
+      return (0);
+  800926:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  80092b:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  800931:	77 45                	ja     800978 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  800933:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800936:	c1 e0 18             	shl    $0x18,%eax
+  800939:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80093c:	c1 e1 10             	shl    $0x10,%ecx
+  80093f:	09 c8                	or     %ecx,%eax
+  800941:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800944:	c1 e1 08             	shl    $0x8,%ecx
+  800947:	09 c8                	or     %ecx,%eax
+  800949:	09 c6                	or     %eax,%esi
+    break;
+  80094b:	eb b1                	jmp    8008fe <inet_aton+0x154>
+      return (0);
+  80094d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  800952:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  800958:	77 1e                	ja     800978 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  80095a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80095d:	c1 e0 18             	shl    $0x18,%eax
+  800960:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800963:	c1 e1 10             	shl    $0x10,%ecx
+  800966:	09 c8                	or     %ecx,%eax
+  800968:	09 c6                	or     %eax,%esi
+    break;
+  80096a:	eb 92                	jmp    8008fe <inet_aton+0x154>
+      return (0);
+  80096c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800971:	eb 05                	jmp    800978 <inet_aton+0x1ce>
+        return (0);
+  800973:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  800978:	89 c8                	mov    %ecx,%eax
+  80097a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80097d:	5b                   	pop    %ebx
+  80097e:	5e                   	pop    %esi
+  80097f:	5f                   	pop    %edi
+  800980:	5d                   	pop    %ebp
+  800981:	c3                   	ret
+
+00800982 <inet_addr>:
+{
+  800982:	55                   	push   %ebp
+  800983:	89 e5                	mov    %esp,%ebp
+  800985:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  800988:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80098b:	50                   	push   %eax
+  80098c:	ff 75 08             	push   0x8(%ebp)
+  80098f:	e8 16 fe ff ff       	call   8007aa <inet_aton>
+  800994:	89 c2                	mov    %eax,%edx
+  800996:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  800999:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  80099e:	85 d2                	test   %edx,%edx
+  8009a0:	75 02                	jne    8009a4 <inet_addr+0x22>
+}
+  8009a2:	c9                   	leave
+  8009a3:	c3                   	ret
+    return (val.s_addr);
+  8009a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009a7:	eb f9                	jmp    8009a2 <inet_addr+0x20>
+
+008009a9 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8009af:	ff 75 08             	push   0x8(%ebp)
+  8009b2:	e8 c7 fd ff ff       	call   80077e <htonl>
+  8009b7:	83 c4 10             	add    $0x10,%esp
+}
+  8009ba:	c9                   	leave
+  8009bb:	c3                   	ret
+
+008009bc <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8009bc:	55                   	push   %ebp
+  8009bd:	89 e5                	mov    %esp,%ebp
+  8009bf:	56                   	push   %esi
+  8009c0:	53                   	push   %ebx
+  8009c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009c4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8009c7:	e8 e2 0a 00 00       	call   8014ae <sys_getenvid>
+  8009cc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8009d1:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8009d7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8009dc:	a3 18 60 80 00       	mov    %eax,0x806018
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8009e1:	85 db                	test   %ebx,%ebx
+  8009e3:	7e 07                	jle    8009ec <libmain+0x30>
+		binaryname = argv[0];
+  8009e5:	8b 06                	mov    (%esi),%eax
+  8009e7:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8009ec:	83 ec 08             	sub    $0x8,%esp
+  8009ef:	56                   	push   %esi
+  8009f0:	53                   	push   %ebx
+  8009f1:	e8 3d f6 ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8009f6:	e8 0a 00 00 00       	call   800a05 <exit>
+}
+  8009fb:	83 c4 10             	add    $0x10,%esp
+  8009fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a01:	5b                   	pop    %ebx
+  800a02:	5e                   	pop    %esi
+  800a03:	5d                   	pop    %ebp
+  800a04:	c3                   	ret
+
+00800a05 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800a05:	55                   	push   %ebp
+  800a06:	89 e5                	mov    %esp,%ebp
+  800a08:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800a0b:	e8 b1 15 00 00       	call   801fc1 <close_all>
+	sys_env_destroy(0);
+  800a10:	83 ec 0c             	sub    $0xc,%esp
+  800a13:	6a 00                	push   $0x0
+  800a15:	e8 4b 0a 00 00       	call   801465 <sys_env_destroy>
+}
+  800a1a:	83 c4 10             	add    $0x10,%esp
+  800a1d:	c9                   	leave
+  800a1e:	c3                   	ret
+
+00800a1f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800a1f:	55                   	push   %ebp
+  800a20:	89 e5                	mov    %esp,%ebp
+  800a22:	56                   	push   %esi
+  800a23:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800a24:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800a27:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800a2d:	e8 7c 0a 00 00       	call   8014ae <sys_getenvid>
+  800a32:	83 ec 0c             	sub    $0xc,%esp
+  800a35:	ff 75 0c             	push   0xc(%ebp)
+  800a38:	ff 75 08             	push   0x8(%ebp)
+  800a3b:	56                   	push   %esi
+  800a3c:	50                   	push   %eax
+  800a3d:	68 bc 42 80 00       	push   $0x8042bc
+  800a42:	e8 b3 00 00 00       	call   800afa <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800a47:	83 c4 18             	add    $0x18,%esp
+  800a4a:	53                   	push   %ebx
+  800a4b:	ff 75 10             	push   0x10(%ebp)
+  800a4e:	e8 56 00 00 00       	call   800aa9 <vcprintf>
+	cprintf("\n");
+  800a53:	c7 04 24 7b 41 80 00 	movl   $0x80417b,(%esp)
+  800a5a:	e8 9b 00 00 00       	call   800afa <cprintf>
+  800a5f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800a62:	cc                   	int3
+	while (1)
+  800a63:	eb fd                	jmp    800a62 <_panic+0x43>
+
+00800a65 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800a65:	55                   	push   %ebp
+  800a66:	89 e5                	mov    %esp,%ebp
+  800a68:	53                   	push   %ebx
+  800a69:	83 ec 04             	sub    $0x4,%esp
+  800a6c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800a6f:	8b 13                	mov    (%ebx),%edx
+  800a71:	8d 42 01             	lea    0x1(%edx),%eax
+  800a74:	89 03                	mov    %eax,(%ebx)
+  800a76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a79:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800a7d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800a82:	74 09                	je     800a8d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800a84:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800a88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a8b:	c9                   	leave
+  800a8c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800a8d:	83 ec 08             	sub    $0x8,%esp
+  800a90:	68 ff 00 00 00       	push   $0xff
+  800a95:	8d 43 08             	lea    0x8(%ebx),%eax
+  800a98:	50                   	push   %eax
+  800a99:	e8 7a 09 00 00       	call   801418 <sys_cputs>
+		b->idx = 0;
+  800a9e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800aa4:	83 c4 10             	add    $0x10,%esp
+  800aa7:	eb db                	jmp    800a84 <putch+0x1f>
+
+00800aa9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800aa9:	55                   	push   %ebp
+  800aaa:	89 e5                	mov    %esp,%ebp
+  800aac:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800ab2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800ab9:	00 00 00 
+	b.cnt = 0;
+  800abc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800ac3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800ac6:	ff 75 0c             	push   0xc(%ebp)
+  800ac9:	ff 75 08             	push   0x8(%ebp)
+  800acc:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800ad2:	50                   	push   %eax
+  800ad3:	68 65 0a 80 00       	push   $0x800a65
+  800ad8:	e8 14 01 00 00       	call   800bf1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800add:	83 c4 08             	add    $0x8,%esp
+  800ae0:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800ae6:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800aec:	50                   	push   %eax
+  800aed:	e8 26 09 00 00       	call   801418 <sys_cputs>
+
+	return b.cnt;
+}
+  800af2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800af8:	c9                   	leave
+  800af9:	c3                   	ret
+
+00800afa <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800afa:	55                   	push   %ebp
+  800afb:	89 e5                	mov    %esp,%ebp
+  800afd:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800b00:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800b03:	50                   	push   %eax
+  800b04:	ff 75 08             	push   0x8(%ebp)
+  800b07:	e8 9d ff ff ff       	call   800aa9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800b0c:	c9                   	leave
+  800b0d:	c3                   	ret
+
+00800b0e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800b0e:	55                   	push   %ebp
+  800b0f:	89 e5                	mov    %esp,%ebp
+  800b11:	57                   	push   %edi
+  800b12:	56                   	push   %esi
+  800b13:	53                   	push   %ebx
+  800b14:	83 ec 1c             	sub    $0x1c,%esp
+  800b17:	89 c7                	mov    %eax,%edi
+  800b19:	89 d6                	mov    %edx,%esi
+  800b1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b1e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b21:	89 d1                	mov    %edx,%ecx
+  800b23:	89 c2                	mov    %eax,%edx
+  800b25:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b28:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b2b:	8b 45 10             	mov    0x10(%ebp),%eax
+  800b2e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800b31:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b34:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800b3b:	39 c2                	cmp    %eax,%edx
+  800b3d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800b40:	72 3e                	jb     800b80 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800b42:	83 ec 0c             	sub    $0xc,%esp
+  800b45:	ff 75 18             	push   0x18(%ebp)
+  800b48:	83 eb 01             	sub    $0x1,%ebx
+  800b4b:	53                   	push   %ebx
+  800b4c:	50                   	push   %eax
+  800b4d:	83 ec 08             	sub    $0x8,%esp
+  800b50:	ff 75 e4             	push   -0x1c(%ebp)
+  800b53:	ff 75 e0             	push   -0x20(%ebp)
+  800b56:	ff 75 dc             	push   -0x24(%ebp)
+  800b59:	ff 75 d8             	push   -0x28(%ebp)
+  800b5c:	e8 f1 33 00 00       	call   803f52 <__udivdi3>
+  800b61:	83 c4 18             	add    $0x18,%esp
+  800b64:	52                   	push   %edx
+  800b65:	50                   	push   %eax
+  800b66:	89 f2                	mov    %esi,%edx
+  800b68:	89 f8                	mov    %edi,%eax
+  800b6a:	e8 9f ff ff ff       	call   800b0e <printnum>
+  800b6f:	83 c4 20             	add    $0x20,%esp
+  800b72:	eb 13                	jmp    800b87 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800b74:	83 ec 08             	sub    $0x8,%esp
+  800b77:	56                   	push   %esi
+  800b78:	ff 75 18             	push   0x18(%ebp)
+  800b7b:	ff d7                	call   *%edi
+  800b7d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800b80:	83 eb 01             	sub    $0x1,%ebx
+  800b83:	85 db                	test   %ebx,%ebx
+  800b85:	7f ed                	jg     800b74 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800b87:	83 ec 08             	sub    $0x8,%esp
+  800b8a:	56                   	push   %esi
+  800b8b:	83 ec 04             	sub    $0x4,%esp
+  800b8e:	ff 75 e4             	push   -0x1c(%ebp)
+  800b91:	ff 75 e0             	push   -0x20(%ebp)
+  800b94:	ff 75 dc             	push   -0x24(%ebp)
+  800b97:	ff 75 d8             	push   -0x28(%ebp)
+  800b9a:	e8 d1 33 00 00       	call   803f70 <__umoddi3>
+  800b9f:	83 c4 14             	add    $0x14,%esp
+  800ba2:	0f be 80 df 42 80 00 	movsbl 0x8042df(%eax),%eax
+  800ba9:	50                   	push   %eax
+  800baa:	ff d7                	call   *%edi
+}
+  800bac:	83 c4 10             	add    $0x10,%esp
+  800baf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bb2:	5b                   	pop    %ebx
+  800bb3:	5e                   	pop    %esi
+  800bb4:	5f                   	pop    %edi
+  800bb5:	5d                   	pop    %ebp
+  800bb6:	c3                   	ret
+
+00800bb7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800bb7:	55                   	push   %ebp
+  800bb8:	89 e5                	mov    %esp,%ebp
+  800bba:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800bbd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800bc1:	8b 10                	mov    (%eax),%edx
+  800bc3:	3b 50 04             	cmp    0x4(%eax),%edx
+  800bc6:	73 0a                	jae    800bd2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800bc8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800bcb:	89 08                	mov    %ecx,(%eax)
+  800bcd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd0:	88 02                	mov    %al,(%edx)
+}
+  800bd2:	5d                   	pop    %ebp
+  800bd3:	c3                   	ret
+
+00800bd4 <printfmt>:
+{
+  800bd4:	55                   	push   %ebp
+  800bd5:	89 e5                	mov    %esp,%ebp
+  800bd7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800bda:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800bdd:	50                   	push   %eax
+  800bde:	ff 75 10             	push   0x10(%ebp)
+  800be1:	ff 75 0c             	push   0xc(%ebp)
+  800be4:	ff 75 08             	push   0x8(%ebp)
+  800be7:	e8 05 00 00 00       	call   800bf1 <vprintfmt>
+}
+  800bec:	83 c4 10             	add    $0x10,%esp
+  800bef:	c9                   	leave
+  800bf0:	c3                   	ret
+
+00800bf1 <vprintfmt>:
+{
+  800bf1:	55                   	push   %ebp
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	57                   	push   %edi
+  800bf5:	56                   	push   %esi
+  800bf6:	53                   	push   %ebx
+  800bf7:	83 ec 2c             	sub    $0x2c,%esp
+  800bfa:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bfd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c00:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800c03:	eb 0a                	jmp    800c0f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800c05:	83 ec 08             	sub    $0x8,%esp
+  800c08:	53                   	push   %ebx
+  800c09:	50                   	push   %eax
+  800c0a:	ff d6                	call   *%esi
+  800c0c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c0f:	83 c7 01             	add    $0x1,%edi
+  800c12:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800c16:	83 f8 25             	cmp    $0x25,%eax
+  800c19:	74 0c                	je     800c27 <vprintfmt+0x36>
+			if (ch == '\0')
+  800c1b:	85 c0                	test   %eax,%eax
+  800c1d:	75 e6                	jne    800c05 <vprintfmt+0x14>
+}
+  800c1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c22:	5b                   	pop    %ebx
+  800c23:	5e                   	pop    %esi
+  800c24:	5f                   	pop    %edi
+  800c25:	5d                   	pop    %ebp
+  800c26:	c3                   	ret
+		padc = ' ';
+  800c27:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800c2b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800c32:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800c39:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800c40:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800c45:	8d 47 01             	lea    0x1(%edi),%eax
+  800c48:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800c4b:	0f b6 17             	movzbl (%edi),%edx
+  800c4e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800c51:	3c 55                	cmp    $0x55,%al
+  800c53:	0f 87 cf 03 00 00    	ja     801028 <vprintfmt+0x437>
+  800c59:	0f b6 c0             	movzbl %al,%eax
+  800c5c:	ff 24 85 40 44 80 00 	jmp    *0x804440(,%eax,4)
+  800c63:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800c66:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800c6a:	eb d9                	jmp    800c45 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800c6c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c6f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800c73:	eb d0                	jmp    800c45 <vprintfmt+0x54>
+  800c75:	0f b6 d2             	movzbl %dl,%edx
+  800c78:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c80:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800c83:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800c86:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800c8a:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800c8d:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800c90:	83 f9 09             	cmp    $0x9,%ecx
+  800c93:	77 55                	ja     800cea <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800c95:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800c98:	eb e9                	jmp    800c83 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800c9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c9d:	8b 00                	mov    (%eax),%eax
+  800c9f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800ca2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ca5:	8d 40 04             	lea    0x4(%eax),%eax
+  800ca8:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800cab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800cae:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800cb2:	79 91                	jns    800c45 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800cb4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800cb7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800cba:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800cc1:	eb 82                	jmp    800c45 <vprintfmt+0x54>
+			if (width < 0)
+  800cc3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800cc6:	85 d2                	test   %edx,%edx
+  800cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccd:	0f 49 c2             	cmovns %edx,%eax
+  800cd0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800cd3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800cd6:	e9 6a ff ff ff       	jmp    800c45 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800cdb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800cde:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800ce5:	e9 5b ff ff ff       	jmp    800c45 <vprintfmt+0x54>
+  800cea:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800ced:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800cf0:	eb bc                	jmp    800cae <vprintfmt+0xbd>
+			lflag++;
+  800cf2:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800cf5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800cf8:	e9 48 ff ff ff       	jmp    800c45 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800cfd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d00:	8d 78 04             	lea    0x4(%eax),%edi
+  800d03:	83 ec 08             	sub    $0x8,%esp
+  800d06:	53                   	push   %ebx
+  800d07:	ff 30                	push   (%eax)
+  800d09:	ff d6                	call   *%esi
+			break;
+  800d0b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800d0e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800d11:	e9 b1 02 00 00       	jmp    800fc7 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800d16:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d19:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800d1c:	8b 10                	mov    (%eax),%edx
+  800d1e:	89 d0                	mov    %edx,%eax
+  800d20:	f7 d8                	neg    %eax
+  800d22:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d25:	83 f8 11             	cmp    $0x11,%eax
+  800d28:	7f 23                	jg     800d4d <vprintfmt+0x15c>
+  800d2a:	8b 14 85 a0 45 80 00 	mov    0x8045a0(,%eax,4),%edx
+  800d31:	85 d2                	test   %edx,%edx
+  800d33:	74 18                	je     800d4d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800d35:	52                   	push   %edx
+  800d36:	68 3e 42 80 00       	push   $0x80423e
+  800d3b:	53                   	push   %ebx
+  800d3c:	56                   	push   %esi
+  800d3d:	e8 92 fe ff ff       	call   800bd4 <printfmt>
+  800d42:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800d45:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800d48:	e9 7a 02 00 00       	jmp    800fc7 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800d4d:	50                   	push   %eax
+  800d4e:	68 f7 42 80 00       	push   $0x8042f7
+  800d53:	53                   	push   %ebx
+  800d54:	56                   	push   %esi
+  800d55:	e8 7a fe ff ff       	call   800bd4 <printfmt>
+  800d5a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800d5d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800d60:	e9 62 02 00 00       	jmp    800fc7 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800d65:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d68:	83 c0 04             	add    $0x4,%eax
+  800d6b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800d6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d71:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800d73:	85 c9                	test   %ecx,%ecx
+  800d75:	b8 f0 42 80 00       	mov    $0x8042f0,%eax
+  800d7a:	0f 45 c1             	cmovne %ecx,%eax
+  800d7d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800d80:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800d84:	7e 06                	jle    800d8c <vprintfmt+0x19b>
+  800d86:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800d8a:	75 0b                	jne    800d97 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800d8c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800d8f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800d92:	89 75 08             	mov    %esi,0x8(%ebp)
+  800d95:	eb 5c                	jmp    800df3 <vprintfmt+0x202>
+  800d97:	83 ec 08             	sub    $0x8,%esp
+  800d9a:	ff 75 d0             	push   -0x30(%ebp)
+  800d9d:	ff 75 cc             	push   -0x34(%ebp)
+  800da0:	e8 20 03 00 00       	call   8010c5 <strnlen>
+  800da5:	89 c2                	mov    %eax,%edx
+  800da7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800daa:	29 d0                	sub    %edx,%eax
+  800dac:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800daf:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800db3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800db6:	89 75 08             	mov    %esi,0x8(%ebp)
+  800db9:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800dbb:	eb 0e                	jmp    800dcb <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800dbd:	83 ec 08             	sub    $0x8,%esp
+  800dc0:	53                   	push   %ebx
+  800dc1:	57                   	push   %edi
+  800dc2:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800dc5:	83 ee 01             	sub    $0x1,%esi
+  800dc8:	83 c4 10             	add    $0x10,%esp
+  800dcb:	85 f6                	test   %esi,%esi
+  800dcd:	7f ee                	jg     800dbd <vprintfmt+0x1cc>
+  800dcf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800dd2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dd5:	85 c0                	test   %eax,%eax
+  800dd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ddc:	0f 49 d0             	cmovns %eax,%edx
+  800ddf:	29 d0                	sub    %edx,%eax
+  800de1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800de4:	eb a6                	jmp    800d8c <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800de6:	83 ec 08             	sub    $0x8,%esp
+  800de9:	53                   	push   %ebx
+  800dea:	52                   	push   %edx
+  800deb:	ff 55 08             	call   *0x8(%ebp)
+  800dee:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800df1:	89 f1                	mov    %esi,%ecx
+  800df3:	8d 71 01             	lea    0x1(%ecx),%esi
+  800df6:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800dfa:	0f be d0             	movsbl %al,%edx
+  800dfd:	85 d2                	test   %edx,%edx
+  800dff:	74 28                	je     800e29 <vprintfmt+0x238>
+  800e01:	85 ff                	test   %edi,%edi
+  800e03:	78 05                	js     800e0a <vprintfmt+0x219>
+  800e05:	83 ef 01             	sub    $0x1,%edi
+  800e08:	78 30                	js     800e3a <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800e0a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800e0e:	74 d6                	je     800de6 <vprintfmt+0x1f5>
+  800e10:	0f be c0             	movsbl %al,%eax
+  800e13:	83 e8 20             	sub    $0x20,%eax
+  800e16:	83 f8 5e             	cmp    $0x5e,%eax
+  800e19:	76 cb                	jbe    800de6 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800e1b:	83 ec 08             	sub    $0x8,%esp
+  800e1e:	53                   	push   %ebx
+  800e1f:	6a 3f                	push   $0x3f
+  800e21:	ff 55 08             	call   *0x8(%ebp)
+  800e24:	83 c4 10             	add    $0x10,%esp
+  800e27:	eb c8                	jmp    800df1 <vprintfmt+0x200>
+  800e29:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e2c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800e2f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e32:	01 d0                	add    %edx,%eax
+  800e34:	29 c8                	sub    %ecx,%eax
+  800e36:	89 c7                	mov    %eax,%edi
+  800e38:	eb 13                	jmp    800e4d <vprintfmt+0x25c>
+  800e3a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e3d:	eb ed                	jmp    800e2c <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800e3f:	83 ec 08             	sub    $0x8,%esp
+  800e42:	53                   	push   %ebx
+  800e43:	6a 20                	push   $0x20
+  800e45:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800e47:	83 ef 01             	sub    $0x1,%edi
+  800e4a:	83 c4 10             	add    $0x10,%esp
+  800e4d:	85 ff                	test   %edi,%edi
+  800e4f:	7f ee                	jg     800e3f <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800e51:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800e54:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e57:	e9 6b 01 00 00       	jmp    800fc7 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800e5c:	83 f9 01             	cmp    $0x1,%ecx
+  800e5f:	7f 1f                	jg     800e80 <vprintfmt+0x28f>
+	else if (lflag)
+  800e61:	85 c9                	test   %ecx,%ecx
+  800e63:	74 67                	je     800ecc <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800e65:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e68:	8b 00                	mov    (%eax),%eax
+  800e6a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800e6d:	89 c1                	mov    %eax,%ecx
+  800e6f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800e72:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800e75:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e78:	8d 40 04             	lea    0x4(%eax),%eax
+  800e7b:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e7e:	eb 17                	jmp    800e97 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800e80:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e83:	8b 50 04             	mov    0x4(%eax),%edx
+  800e86:	8b 00                	mov    (%eax),%eax
+  800e88:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800e8b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800e8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e91:	8d 40 08             	lea    0x8(%eax),%eax
+  800e94:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800e97:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800e9a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800e9d:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800ea2:	85 c9                	test   %ecx,%ecx
+  800ea4:	0f 89 03 01 00 00    	jns    800fad <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800eaa:	83 ec 08             	sub    $0x8,%esp
+  800ead:	53                   	push   %ebx
+  800eae:	6a 2d                	push   $0x2d
+  800eb0:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800eb2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800eb5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800eb8:	f7 da                	neg    %edx
+  800eba:	83 d1 00             	adc    $0x0,%ecx
+  800ebd:	f7 d9                	neg    %ecx
+  800ebf:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800ec2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800ec7:	e9 e1 00 00 00       	jmp    800fad <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800ecc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ecf:	8b 00                	mov    (%eax),%eax
+  800ed1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ed4:	89 c1                	mov    %eax,%ecx
+  800ed6:	c1 f9 1f             	sar    $0x1f,%ecx
+  800ed9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800edc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800edf:	8d 40 04             	lea    0x4(%eax),%eax
+  800ee2:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ee5:	eb b0                	jmp    800e97 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800ee7:	83 f9 01             	cmp    $0x1,%ecx
+  800eea:	7f 1e                	jg     800f0a <vprintfmt+0x319>
+	else if (lflag)
+  800eec:	85 c9                	test   %ecx,%ecx
+  800eee:	74 32                	je     800f22 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800ef0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ef3:	8b 10                	mov    (%eax),%edx
+  800ef5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800efa:	8d 40 04             	lea    0x4(%eax),%eax
+  800efd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f00:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800f05:	e9 a3 00 00 00       	jmp    800fad <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800f0a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f0d:	8b 10                	mov    (%eax),%edx
+  800f0f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f12:	8d 40 08             	lea    0x8(%eax),%eax
+  800f15:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f18:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800f1d:	e9 8b 00 00 00       	jmp    800fad <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800f22:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f25:	8b 10                	mov    (%eax),%edx
+  800f27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2c:	8d 40 04             	lea    0x4(%eax),%eax
+  800f2f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f32:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800f37:	eb 74                	jmp    800fad <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800f39:	83 f9 01             	cmp    $0x1,%ecx
+  800f3c:	7f 1b                	jg     800f59 <vprintfmt+0x368>
+	else if (lflag)
+  800f3e:	85 c9                	test   %ecx,%ecx
+  800f40:	74 2c                	je     800f6e <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800f42:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f45:	8b 10                	mov    (%eax),%edx
+  800f47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f4c:	8d 40 04             	lea    0x4(%eax),%eax
+  800f4f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800f52:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800f57:	eb 54                	jmp    800fad <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800f59:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f5c:	8b 10                	mov    (%eax),%edx
+  800f5e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f61:	8d 40 08             	lea    0x8(%eax),%eax
+  800f64:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800f67:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800f6c:	eb 3f                	jmp    800fad <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800f6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f71:	8b 10                	mov    (%eax),%edx
+  800f73:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f78:	8d 40 04             	lea    0x4(%eax),%eax
+  800f7b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800f7e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800f83:	eb 28                	jmp    800fad <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800f85:	83 ec 08             	sub    $0x8,%esp
+  800f88:	53                   	push   %ebx
+  800f89:	6a 30                	push   $0x30
+  800f8b:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800f8d:	83 c4 08             	add    $0x8,%esp
+  800f90:	53                   	push   %ebx
+  800f91:	6a 78                	push   $0x78
+  800f93:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800f95:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f98:	8b 10                	mov    (%eax),%edx
+  800f9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800f9f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800fa2:	8d 40 04             	lea    0x4(%eax),%eax
+  800fa5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800fa8:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800fad:	83 ec 0c             	sub    $0xc,%esp
+  800fb0:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800fb4:	50                   	push   %eax
+  800fb5:	ff 75 e0             	push   -0x20(%ebp)
+  800fb8:	57                   	push   %edi
+  800fb9:	51                   	push   %ecx
+  800fba:	52                   	push   %edx
+  800fbb:	89 da                	mov    %ebx,%edx
+  800fbd:	89 f0                	mov    %esi,%eax
+  800fbf:	e8 4a fb ff ff       	call   800b0e <printnum>
+			break;
+  800fc4:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800fc7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800fca:	e9 40 fc ff ff       	jmp    800c0f <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800fcf:	83 f9 01             	cmp    $0x1,%ecx
+  800fd2:	7f 1b                	jg     800fef <vprintfmt+0x3fe>
+	else if (lflag)
+  800fd4:	85 c9                	test   %ecx,%ecx
+  800fd6:	74 2c                	je     801004 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800fd8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fdb:	8b 10                	mov    (%eax),%edx
+  800fdd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe2:	8d 40 04             	lea    0x4(%eax),%eax
+  800fe5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800fe8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800fed:	eb be                	jmp    800fad <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800fef:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ff2:	8b 10                	mov    (%eax),%edx
+  800ff4:	8b 48 04             	mov    0x4(%eax),%ecx
+  800ff7:	8d 40 08             	lea    0x8(%eax),%eax
+  800ffa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ffd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801002:	eb a9                	jmp    800fad <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801004:	8b 45 14             	mov    0x14(%ebp),%eax
+  801007:	8b 10                	mov    (%eax),%edx
+  801009:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80100e:	8d 40 04             	lea    0x4(%eax),%eax
+  801011:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801014:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801019:	eb 92                	jmp    800fad <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80101b:	83 ec 08             	sub    $0x8,%esp
+  80101e:	53                   	push   %ebx
+  80101f:	6a 25                	push   $0x25
+  801021:	ff d6                	call   *%esi
+			break;
+  801023:	83 c4 10             	add    $0x10,%esp
+  801026:	eb 9f                	jmp    800fc7 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  801028:	83 ec 08             	sub    $0x8,%esp
+  80102b:	53                   	push   %ebx
+  80102c:	6a 25                	push   $0x25
+  80102e:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801030:	83 c4 10             	add    $0x10,%esp
+  801033:	89 f8                	mov    %edi,%eax
+  801035:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801039:	74 05                	je     801040 <vprintfmt+0x44f>
+  80103b:	83 e8 01             	sub    $0x1,%eax
+  80103e:	eb f5                	jmp    801035 <vprintfmt+0x444>
+  801040:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801043:	eb 82                	jmp    800fc7 <vprintfmt+0x3d6>
+
+00801045 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801045:	55                   	push   %ebp
+  801046:	89 e5                	mov    %esp,%ebp
+  801048:	83 ec 18             	sub    $0x18,%esp
+  80104b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80104e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801051:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801054:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801058:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80105b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801062:	85 c0                	test   %eax,%eax
+  801064:	74 26                	je     80108c <vsnprintf+0x47>
+  801066:	85 d2                	test   %edx,%edx
+  801068:	7e 22                	jle    80108c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80106a:	ff 75 14             	push   0x14(%ebp)
+  80106d:	ff 75 10             	push   0x10(%ebp)
+  801070:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801073:	50                   	push   %eax
+  801074:	68 b7 0b 80 00       	push   $0x800bb7
+  801079:	e8 73 fb ff ff       	call   800bf1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80107e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801081:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801084:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801087:	83 c4 10             	add    $0x10,%esp
+}
+  80108a:	c9                   	leave
+  80108b:	c3                   	ret
+		return -E_INVAL;
+  80108c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801091:	eb f7                	jmp    80108a <vsnprintf+0x45>
+
+00801093 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801099:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80109c:	50                   	push   %eax
+  80109d:	ff 75 10             	push   0x10(%ebp)
+  8010a0:	ff 75 0c             	push   0xc(%ebp)
+  8010a3:	ff 75 08             	push   0x8(%ebp)
+  8010a6:	e8 9a ff ff ff       	call   801045 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8010ab:	c9                   	leave
+  8010ac:	c3                   	ret
+
+008010ad <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8010ad:	55                   	push   %ebp
+  8010ae:	89 e5                	mov    %esp,%ebp
+  8010b0:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8010b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b8:	eb 03                	jmp    8010bd <strlen+0x10>
+		n++;
+  8010ba:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8010bd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8010c1:	75 f7                	jne    8010ba <strlen+0xd>
+	return n;
+}
+  8010c3:	5d                   	pop    %ebp
+  8010c4:	c3                   	ret
+
+008010c5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8010c5:	55                   	push   %ebp
+  8010c6:	89 e5                	mov    %esp,%ebp
+  8010c8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8010cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d3:	eb 03                	jmp    8010d8 <strnlen+0x13>
+		n++;
+  8010d5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8010d8:	39 d0                	cmp    %edx,%eax
+  8010da:	74 08                	je     8010e4 <strnlen+0x1f>
+  8010dc:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8010e0:	75 f3                	jne    8010d5 <strnlen+0x10>
+  8010e2:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8010e4:	89 d0                	mov    %edx,%eax
+  8010e6:	5d                   	pop    %ebp
+  8010e7:	c3                   	ret
+
+008010e8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	53                   	push   %ebx
+  8010ec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8010ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8010f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8010fb:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8010fe:	83 c0 01             	add    $0x1,%eax
+  801101:	84 d2                	test   %dl,%dl
+  801103:	75 f2                	jne    8010f7 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801105:	89 c8                	mov    %ecx,%eax
+  801107:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80110a:	c9                   	leave
+  80110b:	c3                   	ret
+
+0080110c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80110c:	55                   	push   %ebp
+  80110d:	89 e5                	mov    %esp,%ebp
+  80110f:	53                   	push   %ebx
+  801110:	83 ec 10             	sub    $0x10,%esp
+  801113:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801116:	53                   	push   %ebx
+  801117:	e8 91 ff ff ff       	call   8010ad <strlen>
+  80111c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80111f:	ff 75 0c             	push   0xc(%ebp)
+  801122:	01 d8                	add    %ebx,%eax
+  801124:	50                   	push   %eax
+  801125:	e8 be ff ff ff       	call   8010e8 <strcpy>
+	return dst;
+}
+  80112a:	89 d8                	mov    %ebx,%eax
+  80112c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80112f:	c9                   	leave
+  801130:	c3                   	ret
+
+00801131 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801131:	55                   	push   %ebp
+  801132:	89 e5                	mov    %esp,%ebp
+  801134:	56                   	push   %esi
+  801135:	53                   	push   %ebx
+  801136:	8b 75 08             	mov    0x8(%ebp),%esi
+  801139:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80113c:	89 f3                	mov    %esi,%ebx
+  80113e:	03 5d 10             	add    0x10(%ebp),%ebx
+  801141:	89 f0                	mov    %esi,%eax
+  801143:	eb 0f                	jmp    801154 <strncpy+0x23>
+		*dst++ = *src;
+  801145:	83 c0 01             	add    $0x1,%eax
+  801148:	0f b6 0a             	movzbl (%edx),%ecx
+  80114b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80114e:	80 f9 01             	cmp    $0x1,%cl
+  801151:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801154:	39 d8                	cmp    %ebx,%eax
+  801156:	75 ed                	jne    801145 <strncpy+0x14>
+	}
+	return ret;
+}
+  801158:	89 f0                	mov    %esi,%eax
+  80115a:	5b                   	pop    %ebx
+  80115b:	5e                   	pop    %esi
+  80115c:	5d                   	pop    %ebp
+  80115d:	c3                   	ret
+
+0080115e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80115e:	55                   	push   %ebp
+  80115f:	89 e5                	mov    %esp,%ebp
+  801161:	56                   	push   %esi
+  801162:	53                   	push   %ebx
+  801163:	8b 75 08             	mov    0x8(%ebp),%esi
+  801166:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801169:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80116c:	89 f0                	mov    %esi,%eax
+  80116e:	85 d2                	test   %edx,%edx
+  801170:	74 21                	je     801193 <strlcpy+0x35>
+  801172:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801176:	89 f2                	mov    %esi,%edx
+  801178:	eb 09                	jmp    801183 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80117a:	83 c1 01             	add    $0x1,%ecx
+  80117d:	83 c2 01             	add    $0x1,%edx
+  801180:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801183:	39 c2                	cmp    %eax,%edx
+  801185:	74 09                	je     801190 <strlcpy+0x32>
+  801187:	0f b6 19             	movzbl (%ecx),%ebx
+  80118a:	84 db                	test   %bl,%bl
+  80118c:	75 ec                	jne    80117a <strlcpy+0x1c>
+  80118e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801190:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801193:	29 f0                	sub    %esi,%eax
+}
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5d                   	pop    %ebp
+  801198:	c3                   	ret
+
+00801199 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801199:	55                   	push   %ebp
+  80119a:	89 e5                	mov    %esp,%ebp
+  80119c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80119f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8011a2:	eb 06                	jmp    8011aa <strcmp+0x11>
+		p++, q++;
+  8011a4:	83 c1 01             	add    $0x1,%ecx
+  8011a7:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8011aa:	0f b6 01             	movzbl (%ecx),%eax
+  8011ad:	84 c0                	test   %al,%al
+  8011af:	74 04                	je     8011b5 <strcmp+0x1c>
+  8011b1:	3a 02                	cmp    (%edx),%al
+  8011b3:	74 ef                	je     8011a4 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8011b5:	0f b6 c0             	movzbl %al,%eax
+  8011b8:	0f b6 12             	movzbl (%edx),%edx
+  8011bb:	29 d0                	sub    %edx,%eax
+}
+  8011bd:	5d                   	pop    %ebp
+  8011be:	c3                   	ret
+
+008011bf <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8011bf:	55                   	push   %ebp
+  8011c0:	89 e5                	mov    %esp,%ebp
+  8011c2:	53                   	push   %ebx
+  8011c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c9:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8011cc:	eb 09                	jmp    8011d7 <strncmp+0x18>
+		n--, p++, q++;
+  8011ce:	83 ea 01             	sub    $0x1,%edx
+  8011d1:	83 c0 01             	add    $0x1,%eax
+  8011d4:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8011d7:	85 d2                	test   %edx,%edx
+  8011d9:	74 18                	je     8011f3 <strncmp+0x34>
+  8011db:	0f b6 18             	movzbl (%eax),%ebx
+  8011de:	84 db                	test   %bl,%bl
+  8011e0:	74 04                	je     8011e6 <strncmp+0x27>
+  8011e2:	3a 19                	cmp    (%ecx),%bl
+  8011e4:	74 e8                	je     8011ce <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8011e6:	0f b6 00             	movzbl (%eax),%eax
+  8011e9:	0f b6 11             	movzbl (%ecx),%edx
+  8011ec:	29 d0                	sub    %edx,%eax
+}
+  8011ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011f1:	c9                   	leave
+  8011f2:	c3                   	ret
+		return 0;
+  8011f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f8:	eb f4                	jmp    8011ee <strncmp+0x2f>
+
+008011fa <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8011fa:	55                   	push   %ebp
+  8011fb:	89 e5                	mov    %esp,%ebp
+  8011fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801200:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801204:	eb 03                	jmp    801209 <strchr+0xf>
+  801206:	83 c0 01             	add    $0x1,%eax
+  801209:	0f b6 10             	movzbl (%eax),%edx
+  80120c:	84 d2                	test   %dl,%dl
+  80120e:	74 06                	je     801216 <strchr+0x1c>
+		if (*s == c)
+  801210:	38 ca                	cmp    %cl,%dl
+  801212:	75 f2                	jne    801206 <strchr+0xc>
+  801214:	eb 05                	jmp    80121b <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801216:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80121b:	5d                   	pop    %ebp
+  80121c:	c3                   	ret
+
+0080121d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80121d:	55                   	push   %ebp
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	8b 45 08             	mov    0x8(%ebp),%eax
+  801223:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801227:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80122a:	38 ca                	cmp    %cl,%dl
+  80122c:	74 09                	je     801237 <strfind+0x1a>
+  80122e:	84 d2                	test   %dl,%dl
+  801230:	74 05                	je     801237 <strfind+0x1a>
+	for (; *s; s++)
+  801232:	83 c0 01             	add    $0x1,%eax
+  801235:	eb f0                	jmp    801227 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801237:	5d                   	pop    %ebp
+  801238:	c3                   	ret
+
+00801239 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801239:	55                   	push   %ebp
+  80123a:	89 e5                	mov    %esp,%ebp
+  80123c:	57                   	push   %edi
+  80123d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801240:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801243:	85 c9                	test   %ecx,%ecx
+  801245:	74 20                	je     801267 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801247:	89 f8                	mov    %edi,%eax
+  801249:	09 c8                	or     %ecx,%eax
+  80124b:	a8 03                	test   $0x3,%al
+  80124d:	75 12                	jne    801261 <memset+0x28>
+		c &= 0xFF;
+  80124f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801253:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801259:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80125c:	fc                   	cld
+  80125d:	f3 ab                	rep stos %eax,%es:(%edi)
+  80125f:	eb 06                	jmp    801267 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801261:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801264:	fc                   	cld
+  801265:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801267:	89 f8                	mov    %edi,%eax
+  801269:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80126c:	c9                   	leave
+  80126d:	c3                   	ret
+
+0080126e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80126e:	55                   	push   %ebp
+  80126f:	89 e5                	mov    %esp,%ebp
+  801271:	57                   	push   %edi
+  801272:	56                   	push   %esi
+  801273:	8b 45 08             	mov    0x8(%ebp),%eax
+  801276:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801279:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80127c:	39 c6                	cmp    %eax,%esi
+  80127e:	73 32                	jae    8012b2 <memmove+0x44>
+  801280:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801283:	39 d0                	cmp    %edx,%eax
+  801285:	73 2b                	jae    8012b2 <memmove+0x44>
+		s += n;
+		d += n;
+  801287:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80128a:	89 d6                	mov    %edx,%esi
+  80128c:	09 fe                	or     %edi,%esi
+  80128e:	09 ce                	or     %ecx,%esi
+  801290:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801296:	75 0e                	jne    8012a6 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801298:	83 ef 04             	sub    $0x4,%edi
+  80129b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80129e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8012a1:	fd                   	std
+  8012a2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8012a4:	eb 09                	jmp    8012af <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8012a6:	83 ef 01             	sub    $0x1,%edi
+  8012a9:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8012ac:	fd                   	std
+  8012ad:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8012af:	fc                   	cld
+  8012b0:	eb 1a                	jmp    8012cc <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8012b2:	89 f2                	mov    %esi,%edx
+  8012b4:	09 c2                	or     %eax,%edx
+  8012b6:	09 ca                	or     %ecx,%edx
+  8012b8:	f6 c2 03             	test   $0x3,%dl
+  8012bb:	75 0a                	jne    8012c7 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8012bd:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8012c0:	89 c7                	mov    %eax,%edi
+  8012c2:	fc                   	cld
+  8012c3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8012c5:	eb 05                	jmp    8012cc <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8012c7:	89 c7                	mov    %eax,%edi
+  8012c9:	fc                   	cld
+  8012ca:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8012cc:	5e                   	pop    %esi
+  8012cd:	5f                   	pop    %edi
+  8012ce:	5d                   	pop    %ebp
+  8012cf:	c3                   	ret
+
+008012d0 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8012d0:	55                   	push   %ebp
+  8012d1:	89 e5                	mov    %esp,%ebp
+  8012d3:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8012d6:	ff 75 10             	push   0x10(%ebp)
+  8012d9:	ff 75 0c             	push   0xc(%ebp)
+  8012dc:	ff 75 08             	push   0x8(%ebp)
+  8012df:	e8 8a ff ff ff       	call   80126e <memmove>
+}
+  8012e4:	c9                   	leave
+  8012e5:	c3                   	ret
+
+008012e6 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8012e6:	55                   	push   %ebp
+  8012e7:	89 e5                	mov    %esp,%ebp
+  8012e9:	56                   	push   %esi
+  8012ea:	53                   	push   %ebx
+  8012eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8012f1:	89 c6                	mov    %eax,%esi
+  8012f3:	03 75 10             	add    0x10(%ebp),%esi
+  8012f6:	eb 06                	jmp    8012fe <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8012f8:	83 c0 01             	add    $0x1,%eax
+  8012fb:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8012fe:	39 f0                	cmp    %esi,%eax
+  801300:	74 14                	je     801316 <memcmp+0x30>
+		if (*s1 != *s2)
+  801302:	0f b6 08             	movzbl (%eax),%ecx
+  801305:	0f b6 1a             	movzbl (%edx),%ebx
+  801308:	38 d9                	cmp    %bl,%cl
+  80130a:	74 ec                	je     8012f8 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80130c:	0f b6 c1             	movzbl %cl,%eax
+  80130f:	0f b6 db             	movzbl %bl,%ebx
+  801312:	29 d8                	sub    %ebx,%eax
+  801314:	eb 05                	jmp    80131b <memcmp+0x35>
+	}
+
+	return 0;
+  801316:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80131b:	5b                   	pop    %ebx
+  80131c:	5e                   	pop    %esi
+  80131d:	5d                   	pop    %ebp
+  80131e:	c3                   	ret
+
+0080131f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80131f:	55                   	push   %ebp
+  801320:	89 e5                	mov    %esp,%ebp
+  801322:	8b 45 08             	mov    0x8(%ebp),%eax
+  801325:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801328:	89 c2                	mov    %eax,%edx
+  80132a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80132d:	eb 03                	jmp    801332 <memfind+0x13>
+  80132f:	83 c0 01             	add    $0x1,%eax
+  801332:	39 d0                	cmp    %edx,%eax
+  801334:	73 04                	jae    80133a <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801336:	38 08                	cmp    %cl,(%eax)
+  801338:	75 f5                	jne    80132f <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80133a:	5d                   	pop    %ebp
+  80133b:	c3                   	ret
+
+0080133c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80133c:	55                   	push   %ebp
+  80133d:	89 e5                	mov    %esp,%ebp
+  80133f:	57                   	push   %edi
+  801340:	56                   	push   %esi
+  801341:	53                   	push   %ebx
+  801342:	8b 55 08             	mov    0x8(%ebp),%edx
+  801345:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801348:	eb 03                	jmp    80134d <strtol+0x11>
+		s++;
+  80134a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80134d:	0f b6 02             	movzbl (%edx),%eax
+  801350:	3c 20                	cmp    $0x20,%al
+  801352:	74 f6                	je     80134a <strtol+0xe>
+  801354:	3c 09                	cmp    $0x9,%al
+  801356:	74 f2                	je     80134a <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801358:	3c 2b                	cmp    $0x2b,%al
+  80135a:	74 2a                	je     801386 <strtol+0x4a>
+	int neg = 0;
+  80135c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801361:	3c 2d                	cmp    $0x2d,%al
+  801363:	74 2b                	je     801390 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801365:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80136b:	75 0f                	jne    80137c <strtol+0x40>
+  80136d:	80 3a 30             	cmpb   $0x30,(%edx)
+  801370:	74 28                	je     80139a <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801372:	85 db                	test   %ebx,%ebx
+  801374:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801379:	0f 44 d8             	cmove  %eax,%ebx
+  80137c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801381:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801384:	eb 46                	jmp    8013cc <strtol+0x90>
+		s++;
+  801386:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801389:	bf 00 00 00 00       	mov    $0x0,%edi
+  80138e:	eb d5                	jmp    801365 <strtol+0x29>
+		s++, neg = 1;
+  801390:	83 c2 01             	add    $0x1,%edx
+  801393:	bf 01 00 00 00       	mov    $0x1,%edi
+  801398:	eb cb                	jmp    801365 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80139a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80139e:	74 0e                	je     8013ae <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8013a0:	85 db                	test   %ebx,%ebx
+  8013a2:	75 d8                	jne    80137c <strtol+0x40>
+		s++, base = 8;
+  8013a4:	83 c2 01             	add    $0x1,%edx
+  8013a7:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8013ac:	eb ce                	jmp    80137c <strtol+0x40>
+		s += 2, base = 16;
+  8013ae:	83 c2 02             	add    $0x2,%edx
+  8013b1:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8013b6:	eb c4                	jmp    80137c <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8013b8:	0f be c0             	movsbl %al,%eax
+  8013bb:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8013be:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8013c1:	7d 3a                	jge    8013fd <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8013c3:	83 c2 01             	add    $0x1,%edx
+  8013c6:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8013ca:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8013cc:	0f b6 02             	movzbl (%edx),%eax
+  8013cf:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8013d2:	89 f3                	mov    %esi,%ebx
+  8013d4:	80 fb 09             	cmp    $0x9,%bl
+  8013d7:	76 df                	jbe    8013b8 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8013d9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8013dc:	89 f3                	mov    %esi,%ebx
+  8013de:	80 fb 19             	cmp    $0x19,%bl
+  8013e1:	77 08                	ja     8013eb <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8013e3:	0f be c0             	movsbl %al,%eax
+  8013e6:	83 e8 57             	sub    $0x57,%eax
+  8013e9:	eb d3                	jmp    8013be <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8013eb:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8013ee:	89 f3                	mov    %esi,%ebx
+  8013f0:	80 fb 19             	cmp    $0x19,%bl
+  8013f3:	77 08                	ja     8013fd <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8013f5:	0f be c0             	movsbl %al,%eax
+  8013f8:	83 e8 37             	sub    $0x37,%eax
+  8013fb:	eb c1                	jmp    8013be <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8013fd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801401:	74 05                	je     801408 <strtol+0xcc>
+		*endptr = (char *) s;
+  801403:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801406:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801408:	89 c8                	mov    %ecx,%eax
+  80140a:	f7 d8                	neg    %eax
+  80140c:	85 ff                	test   %edi,%edi
+  80140e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801411:	89 c8                	mov    %ecx,%eax
+  801413:	5b                   	pop    %ebx
+  801414:	5e                   	pop    %esi
+  801415:	5f                   	pop    %edi
+  801416:	5d                   	pop    %ebp
+  801417:	c3                   	ret
+
+00801418 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801418:	55                   	push   %ebp
+  801419:	89 e5                	mov    %esp,%ebp
+  80141b:	57                   	push   %edi
+  80141c:	56                   	push   %esi
+  80141d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80141e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801423:	8b 55 08             	mov    0x8(%ebp),%edx
+  801426:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801429:	89 c3                	mov    %eax,%ebx
+  80142b:	89 c7                	mov    %eax,%edi
+  80142d:	55                   	push   %ebp
+  80142e:	89 e5                	mov    %esp,%ebp
+  801430:	8d 35 38 14 80 00    	lea    0x801438,%esi
+  801436:	0f 34                	sysenter
+  801438:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  801439:	5b                   	pop    %ebx
+  80143a:	5e                   	pop    %esi
+  80143b:	5f                   	pop    %edi
+  80143c:	5d                   	pop    %ebp
+  80143d:	c3                   	ret
+
+0080143e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80143e:	55                   	push   %ebp
+  80143f:	89 e5                	mov    %esp,%ebp
+  801441:	57                   	push   %edi
+  801442:	56                   	push   %esi
+  801443:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801444:	ba 00 00 00 00       	mov    $0x0,%edx
+  801449:	b8 01 00 00 00       	mov    $0x1,%eax
+  80144e:	89 d1                	mov    %edx,%ecx
+  801450:	89 d3                	mov    %edx,%ebx
+  801452:	89 d7                	mov    %edx,%edi
+  801454:	55                   	push   %ebp
+  801455:	89 e5                	mov    %esp,%ebp
+  801457:	8d 35 5f 14 80 00    	lea    0x80145f,%esi
+  80145d:	0f 34                	sysenter
+  80145f:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  801460:	5b                   	pop    %ebx
+  801461:	5e                   	pop    %esi
+  801462:	5f                   	pop    %edi
+  801463:	5d                   	pop    %ebp
+  801464:	c3                   	ret
+
+00801465 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801465:	55                   	push   %ebp
+  801466:	89 e5                	mov    %esp,%ebp
+  801468:	57                   	push   %edi
+  801469:	56                   	push   %esi
+  80146a:	53                   	push   %ebx
+  80146b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80146e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801473:	8b 55 08             	mov    0x8(%ebp),%edx
+  801476:	b8 03 00 00 00       	mov    $0x3,%eax
+  80147b:	89 cb                	mov    %ecx,%ebx
+  80147d:	89 cf                	mov    %ecx,%edi
+  80147f:	55                   	push   %ebp
+  801480:	89 e5                	mov    %esp,%ebp
+  801482:	8d 35 8a 14 80 00    	lea    0x80148a,%esi
+  801488:	0f 34                	sysenter
+  80148a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80148b:	85 c0                	test   %eax,%eax
+  80148d:	7f 08                	jg     801497 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  80148f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801492:	5b                   	pop    %ebx
+  801493:	5e                   	pop    %esi
+  801494:	5f                   	pop    %edi
+  801495:	5d                   	pop    %ebp
+  801496:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801497:	83 ec 0c             	sub    $0xc,%esp
+  80149a:	50                   	push   %eax
+  80149b:	6a 03                	push   $0x3
+  80149d:	68 07 46 80 00       	push   $0x804607
+  8014a2:	6a 3d                	push   $0x3d
+  8014a4:	68 24 46 80 00       	push   $0x804624
+  8014a9:	e8 71 f5 ff ff       	call   800a1f <_panic>
+
+008014ae <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8014ae:	55                   	push   %ebp
+  8014af:	89 e5                	mov    %esp,%ebp
+  8014b1:	57                   	push   %edi
+  8014b2:	56                   	push   %esi
+  8014b3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8014b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8014be:	89 d1                	mov    %edx,%ecx
+  8014c0:	89 d3                	mov    %edx,%ebx
+  8014c2:	89 d7                	mov    %edx,%edi
+  8014c4:	55                   	push   %ebp
+  8014c5:	89 e5                	mov    %esp,%ebp
+  8014c7:	8d 35 cf 14 80 00    	lea    0x8014cf,%esi
+  8014cd:	0f 34                	sysenter
+  8014cf:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  8014d0:	5b                   	pop    %ebx
+  8014d1:	5e                   	pop    %esi
+  8014d2:	5f                   	pop    %edi
+  8014d3:	5d                   	pop    %ebp
+  8014d4:	c3                   	ret
+
+008014d5 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8014d5:	55                   	push   %ebp
+  8014d6:	89 e5                	mov    %esp,%ebp
+  8014d8:	57                   	push   %edi
+  8014d9:	56                   	push   %esi
+  8014da:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014e5:	89 d1                	mov    %edx,%ecx
+  8014e7:	89 d3                	mov    %edx,%ebx
+  8014e9:	89 d7                	mov    %edx,%edi
+  8014eb:	89 d6                	mov    %edx,%esi
+  8014ed:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8014ef:	5b                   	pop    %ebx
+  8014f0:	5e                   	pop    %esi
+  8014f1:	5f                   	pop    %edi
+  8014f2:	5d                   	pop    %ebp
+  8014f3:	c3                   	ret
+
+008014f4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8014f4:	55                   	push   %ebp
+  8014f5:	89 e5                	mov    %esp,%ebp
+  8014f7:	57                   	push   %edi
+  8014f8:	56                   	push   %esi
+  8014f9:	53                   	push   %ebx
+  8014fa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8014fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801500:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801503:	b8 04 00 00 00       	mov    $0x4,%eax
+  801508:	bf 00 00 00 00       	mov    $0x0,%edi
+  80150d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801510:	55                   	push   %ebp
+  801511:	89 e5                	mov    %esp,%ebp
+  801513:	8d 35 1b 15 80 00    	lea    0x80151b,%esi
+  801519:	0f 34                	sysenter
+  80151b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80151c:	85 c0                	test   %eax,%eax
+  80151e:	7f 08                	jg     801528 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  801520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801523:	5b                   	pop    %ebx
+  801524:	5e                   	pop    %esi
+  801525:	5f                   	pop    %edi
+  801526:	5d                   	pop    %ebp
+  801527:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801528:	83 ec 0c             	sub    $0xc,%esp
+  80152b:	50                   	push   %eax
+  80152c:	6a 04                	push   $0x4
+  80152e:	68 07 46 80 00       	push   $0x804607
+  801533:	6a 3d                	push   $0x3d
+  801535:	68 24 46 80 00       	push   $0x804624
+  80153a:	e8 e0 f4 ff ff       	call   800a1f <_panic>
+
+0080153f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80153f:	55                   	push   %ebp
+  801540:	89 e5                	mov    %esp,%ebp
+  801542:	57                   	push   %edi
+  801543:	56                   	push   %esi
+  801544:	53                   	push   %ebx
+  801545:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801548:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801553:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801556:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801559:	8b 75 18             	mov    0x18(%ebp),%esi
+  80155c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80155e:	85 c0                	test   %eax,%eax
+  801560:	7f 08                	jg     80156a <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801562:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801565:	5b                   	pop    %ebx
+  801566:	5e                   	pop    %esi
+  801567:	5f                   	pop    %edi
+  801568:	5d                   	pop    %ebp
+  801569:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80156a:	83 ec 0c             	sub    $0xc,%esp
+  80156d:	50                   	push   %eax
+  80156e:	6a 05                	push   $0x5
+  801570:	68 07 46 80 00       	push   $0x804607
+  801575:	6a 23                	push   $0x23
+  801577:	68 24 46 80 00       	push   $0x804624
+  80157c:	e8 9e f4 ff ff       	call   800a1f <_panic>
+
+00801581 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801581:	55                   	push   %ebp
+  801582:	89 e5                	mov    %esp,%ebp
+  801584:	57                   	push   %edi
+  801585:	56                   	push   %esi
+  801586:	53                   	push   %ebx
+  801587:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80158a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801592:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801595:	b8 06 00 00 00       	mov    $0x6,%eax
+  80159a:	89 df                	mov    %ebx,%edi
+  80159c:	55                   	push   %ebp
+  80159d:	89 e5                	mov    %esp,%ebp
+  80159f:	8d 35 a7 15 80 00    	lea    0x8015a7,%esi
+  8015a5:	0f 34                	sysenter
+  8015a7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015a8:	85 c0                	test   %eax,%eax
+  8015aa:	7f 08                	jg     8015b4 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  8015ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015af:	5b                   	pop    %ebx
+  8015b0:	5e                   	pop    %esi
+  8015b1:	5f                   	pop    %edi
+  8015b2:	5d                   	pop    %ebp
+  8015b3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015b4:	83 ec 0c             	sub    $0xc,%esp
+  8015b7:	50                   	push   %eax
+  8015b8:	6a 06                	push   $0x6
+  8015ba:	68 07 46 80 00       	push   $0x804607
+  8015bf:	6a 3d                	push   $0x3d
+  8015c1:	68 24 46 80 00       	push   $0x804624
+  8015c6:	e8 54 f4 ff ff       	call   800a1f <_panic>
+
+008015cb <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8015cb:	55                   	push   %ebp
+  8015cc:	89 e5                	mov    %esp,%ebp
+  8015ce:	57                   	push   %edi
+  8015cf:	56                   	push   %esi
+  8015d0:	53                   	push   %ebx
+  8015d1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8015d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015df:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015e4:	89 df                	mov    %ebx,%edi
+  8015e6:	55                   	push   %ebp
+  8015e7:	89 e5                	mov    %esp,%ebp
+  8015e9:	8d 35 f1 15 80 00    	lea    0x8015f1,%esi
+  8015ef:	0f 34                	sysenter
+  8015f1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015f2:	85 c0                	test   %eax,%eax
+  8015f4:	7f 08                	jg     8015fe <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  8015f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f9:	5b                   	pop    %ebx
+  8015fa:	5e                   	pop    %esi
+  8015fb:	5f                   	pop    %edi
+  8015fc:	5d                   	pop    %ebp
+  8015fd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015fe:	83 ec 0c             	sub    $0xc,%esp
+  801601:	50                   	push   %eax
+  801602:	6a 08                	push   $0x8
+  801604:	68 07 46 80 00       	push   $0x804607
+  801609:	6a 3d                	push   $0x3d
+  80160b:	68 24 46 80 00       	push   $0x804624
+  801610:	e8 0a f4 ff ff       	call   800a1f <_panic>
+
+00801615 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801615:	55                   	push   %ebp
+  801616:	89 e5                	mov    %esp,%ebp
+  801618:	57                   	push   %edi
+  801619:	56                   	push   %esi
+  80161a:	53                   	push   %ebx
+  80161b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80161e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801623:	8b 55 08             	mov    0x8(%ebp),%edx
+  801626:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801629:	b8 09 00 00 00       	mov    $0x9,%eax
+  80162e:	89 df                	mov    %ebx,%edi
+  801630:	55                   	push   %ebp
+  801631:	89 e5                	mov    %esp,%ebp
+  801633:	8d 35 3b 16 80 00    	lea    0x80163b,%esi
+  801639:	0f 34                	sysenter
+  80163b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80163c:	85 c0                	test   %eax,%eax
+  80163e:	7f 08                	jg     801648 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  801640:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801643:	5b                   	pop    %ebx
+  801644:	5e                   	pop    %esi
+  801645:	5f                   	pop    %edi
+  801646:	5d                   	pop    %ebp
+  801647:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801648:	83 ec 0c             	sub    $0xc,%esp
+  80164b:	50                   	push   %eax
+  80164c:	6a 09                	push   $0x9
+  80164e:	68 07 46 80 00       	push   $0x804607
+  801653:	6a 3d                	push   $0x3d
+  801655:	68 24 46 80 00       	push   $0x804624
+  80165a:	e8 c0 f3 ff ff       	call   800a1f <_panic>
+
+0080165f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80165f:	55                   	push   %ebp
+  801660:	89 e5                	mov    %esp,%ebp
+  801662:	57                   	push   %edi
+  801663:	56                   	push   %esi
+  801664:	53                   	push   %ebx
+  801665:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801668:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80166d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801670:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801673:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801678:	89 df                	mov    %ebx,%edi
+  80167a:	55                   	push   %ebp
+  80167b:	89 e5                	mov    %esp,%ebp
+  80167d:	8d 35 85 16 80 00    	lea    0x801685,%esi
+  801683:	0f 34                	sysenter
+  801685:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801686:	85 c0                	test   %eax,%eax
+  801688:	7f 08                	jg     801692 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  80168a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80168d:	5b                   	pop    %ebx
+  80168e:	5e                   	pop    %esi
+  80168f:	5f                   	pop    %edi
+  801690:	5d                   	pop    %ebp
+  801691:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801692:	83 ec 0c             	sub    $0xc,%esp
+  801695:	50                   	push   %eax
+  801696:	6a 0a                	push   $0xa
+  801698:	68 07 46 80 00       	push   $0x804607
+  80169d:	6a 3d                	push   $0x3d
+  80169f:	68 24 46 80 00       	push   $0x804624
+  8016a4:	e8 76 f3 ff ff       	call   800a1f <_panic>
+
+008016a9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8016a9:	55                   	push   %ebp
+  8016aa:	89 e5                	mov    %esp,%ebp
+  8016ac:	57                   	push   %edi
+  8016ad:	56                   	push   %esi
+  8016ae:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8016af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8016ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016bd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016c0:	55                   	push   %ebp
+  8016c1:	89 e5                	mov    %esp,%ebp
+  8016c3:	8d 35 cb 16 80 00    	lea    0x8016cb,%esi
+  8016c9:	0f 34                	sysenter
+  8016cb:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  8016cc:	5b                   	pop    %ebx
+  8016cd:	5e                   	pop    %esi
+  8016ce:	5f                   	pop    %edi
+  8016cf:	5d                   	pop    %ebp
+  8016d0:	c3                   	ret
+
+008016d1 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  8016d1:	55                   	push   %ebp
+  8016d2:	89 e5                	mov    %esp,%ebp
+  8016d4:	57                   	push   %edi
+  8016d5:	56                   	push   %esi
+  8016d6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8016d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016dd:	b8 17 00 00 00       	mov    $0x17,%eax
+  8016e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016e5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016e8:	55                   	push   %ebp
+  8016e9:	89 e5                	mov    %esp,%ebp
+  8016eb:	8d 35 f3 16 80 00    	lea    0x8016f3,%esi
+  8016f1:	0f 34                	sysenter
+  8016f3:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  8016f4:	5b                   	pop    %ebx
+  8016f5:	5e                   	pop    %esi
+  8016f6:	5f                   	pop    %edi
+  8016f7:	5d                   	pop    %ebp
+  8016f8:	c3                   	ret
+
+008016f9 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  8016f9:	55                   	push   %ebp
+  8016fa:	89 e5                	mov    %esp,%ebp
+  8016fc:	57                   	push   %edi
+  8016fd:	56                   	push   %esi
+  8016fe:	53                   	push   %ebx
+  8016ff:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801702:	be 00 00 00 00       	mov    $0x0,%esi
+  801707:	8b 55 08             	mov    0x8(%ebp),%edx
+  80170a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80170d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801712:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801715:	89 f7                	mov    %esi,%edi
+  801717:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801719:	85 c0                	test   %eax,%eax
+  80171b:	7f 08                	jg     801725 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  80171d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801720:	5b                   	pop    %ebx
+  801721:	5e                   	pop    %esi
+  801722:	5f                   	pop    %edi
+  801723:	5d                   	pop    %ebp
+  801724:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801725:	83 ec 0c             	sub    $0xc,%esp
+  801728:	50                   	push   %eax
+  801729:	6a 0d                	push   $0xd
+  80172b:	68 07 46 80 00       	push   $0x804607
+  801730:	6a 23                	push   $0x23
+  801732:	68 24 46 80 00       	push   $0x804624
+  801737:	e8 e3 f2 ff ff       	call   800a1f <_panic>
+
+0080173c <sys_ipc_recv>:
+{
+  80173c:	55                   	push   %ebp
+  80173d:	89 e5                	mov    %esp,%ebp
+  80173f:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  801742:	6a 00                	push   $0x0
+  801744:	6a 01                	push   $0x1
+  801746:	ff 75 08             	push   0x8(%ebp)
+  801749:	e8 ab ff ff ff       	call   8016f9 <sys_ipc_recvv>
+}
+  80174e:	c9                   	leave
+  80174f:	c3                   	ret
+
+00801750 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  801750:	55                   	push   %ebp
+  801751:	89 e5                	mov    %esp,%ebp
+  801753:	57                   	push   %edi
+  801754:	56                   	push   %esi
+  801755:	53                   	push   %ebx
+  801756:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801759:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801761:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801764:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801769:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80176c:	89 de                	mov    %ebx,%esi
+  80176e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801770:	85 c0                	test   %eax,%eax
+  801772:	7f 08                	jg     80177c <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  801774:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801777:	5b                   	pop    %ebx
+  801778:	5e                   	pop    %esi
+  801779:	5f                   	pop    %edi
+  80177a:	5d                   	pop    %ebp
+  80177b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80177c:	83 ec 0c             	sub    $0xc,%esp
+  80177f:	50                   	push   %eax
+  801780:	6a 0d                	push   $0xd
+  801782:	68 07 46 80 00       	push   $0x804607
+  801787:	6a 23                	push   $0x23
+  801789:	68 24 46 80 00       	push   $0x804624
+  80178e:	e8 8c f2 ff ff       	call   800a1f <_panic>
+
+00801793 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801793:	55                   	push   %ebp
+  801794:	89 e5                	mov    %esp,%ebp
+  801796:	57                   	push   %edi
+  801797:	56                   	push   %esi
+  801798:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801799:	ba 00 00 00 00       	mov    $0x0,%edx
+  80179e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8017a3:	89 d1                	mov    %edx,%ecx
+  8017a5:	89 d3                	mov    %edx,%ebx
+  8017a7:	89 d7                	mov    %edx,%edi
+  8017a9:	55                   	push   %ebp
+  8017aa:	89 e5                	mov    %esp,%ebp
+  8017ac:	8d 35 b4 17 80 00    	lea    0x8017b4,%esi
+  8017b2:	0f 34                	sysenter
+  8017b4:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  8017b5:	5b                   	pop    %ebx
+  8017b6:	5e                   	pop    %esi
+  8017b7:	5f                   	pop    %edi
+  8017b8:	5d                   	pop    %ebp
+  8017b9:	c3                   	ret
+
+008017ba <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  8017ba:	55                   	push   %ebp
+  8017bb:	89 e5                	mov    %esp,%ebp
+  8017bd:	57                   	push   %edi
+  8017be:	56                   	push   %esi
+  8017bf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8017c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017cb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8017d0:	89 df                	mov    %ebx,%edi
+  8017d2:	55                   	push   %ebp
+  8017d3:	89 e5                	mov    %esp,%ebp
+  8017d5:	8d 35 dd 17 80 00    	lea    0x8017dd,%esi
+  8017db:	0f 34                	sysenter
+  8017dd:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  8017de:	5b                   	pop    %ebx
+  8017df:	5e                   	pop    %esi
+  8017e0:	5f                   	pop    %edi
+  8017e1:	5d                   	pop    %ebp
+  8017e2:	c3                   	ret
+
+008017e3 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  8017e3:	55                   	push   %ebp
+  8017e4:	89 e5                	mov    %esp,%ebp
+  8017e6:	57                   	push   %edi
+  8017e7:	56                   	push   %esi
+  8017e8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8017e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8017f6:	89 cb                	mov    %ecx,%ebx
+  8017f8:	89 cf                	mov    %ecx,%edi
+  8017fa:	55                   	push   %ebp
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	8d 35 05 18 80 00    	lea    0x801805,%esi
+  801803:	0f 34                	sysenter
+  801805:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  801806:	5b                   	pop    %ebx
+  801807:	5e                   	pop    %esi
+  801808:	5f                   	pop    %edi
+  801809:	5d                   	pop    %ebp
+  80180a:	c3                   	ret
+
+0080180b <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  80180b:	55                   	push   %ebp
+  80180c:	89 e5                	mov    %esp,%ebp
+  80180e:	57                   	push   %edi
+  80180f:	56                   	push   %esi
+  801810:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801811:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801816:	8b 55 08             	mov    0x8(%ebp),%edx
+  801819:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80181c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801821:	89 df                	mov    %ebx,%edi
+  801823:	55                   	push   %ebp
+  801824:	89 e5                	mov    %esp,%ebp
+  801826:	8d 35 2e 18 80 00    	lea    0x80182e,%esi
+  80182c:	0f 34                	sysenter
+  80182e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  80182f:	5b                   	pop    %ebx
+  801830:	5e                   	pop    %esi
+  801831:	5f                   	pop    %edi
+  801832:	5d                   	pop    %ebp
+  801833:	c3                   	ret
+
+00801834 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  801834:	55                   	push   %ebp
+  801835:	89 e5                	mov    %esp,%ebp
+  801837:	57                   	push   %edi
+  801838:	56                   	push   %esi
+  801839:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80183a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801842:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801845:	b8 14 00 00 00       	mov    $0x14,%eax
+  80184a:	89 df                	mov    %ebx,%edi
+  80184c:	55                   	push   %ebp
+  80184d:	89 e5                	mov    %esp,%ebp
+  80184f:	8d 35 57 18 80 00    	lea    0x801857,%esi
+  801855:	0f 34                	sysenter
+  801857:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  801858:	5b                   	pop    %ebx
+  801859:	5e                   	pop    %esi
+  80185a:	5f                   	pop    %edi
+  80185b:	5d                   	pop    %ebp
+  80185c:	c3                   	ret
+
+0080185d <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  80185d:	55                   	push   %ebp
+  80185e:	89 e5                	mov    %esp,%ebp
+  801860:	57                   	push   %edi
+  801861:	56                   	push   %esi
+  801862:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801863:	8b 55 08             	mov    0x8(%ebp),%edx
+  801866:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801869:	b8 13 00 00 00       	mov    $0x13,%eax
+  80186e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801871:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801874:	55                   	push   %ebp
+  801875:	89 e5                	mov    %esp,%ebp
+  801877:	8d 35 7f 18 80 00    	lea    0x80187f,%esi
+  80187d:	0f 34                	sysenter
+  80187f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  801880:	5b                   	pop    %ebx
+  801881:	5e                   	pop    %esi
+  801882:	5f                   	pop    %edi
+  801883:	5d                   	pop    %ebp
+  801884:	c3                   	ret
+
+00801885 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801885:	55                   	push   %ebp
+  801886:	89 e5                	mov    %esp,%ebp
+  801888:	57                   	push   %edi
+  801889:	56                   	push   %esi
+  80188a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80188b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801890:	8b 55 08             	mov    0x8(%ebp),%edx
+  801893:	b8 11 00 00 00       	mov    $0x11,%eax
+  801898:	89 cb                	mov    %ecx,%ebx
+  80189a:	89 cf                	mov    %ecx,%edi
+  80189c:	89 ce                	mov    %ecx,%esi
+  80189e:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  8018a0:	5b                   	pop    %ebx
+  8018a1:	5e                   	pop    %esi
+  8018a2:	5f                   	pop    %edi
+  8018a3:	5d                   	pop    %ebp
+  8018a4:	c3                   	ret
+
+008018a5 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  8018a5:	55                   	push   %ebp
+  8018a6:	89 e5                	mov    %esp,%ebp
+  8018a8:	57                   	push   %edi
+  8018a9:	56                   	push   %esi
+  8018aa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8018ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b3:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018b8:	89 cb                	mov    %ecx,%ebx
+  8018ba:	89 cf                	mov    %ecx,%edi
+  8018bc:	55                   	push   %ebp
+  8018bd:	89 e5                	mov    %esp,%ebp
+  8018bf:	8d 35 c7 18 80 00    	lea    0x8018c7,%esi
+  8018c5:	0f 34                	sysenter
+  8018c7:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8018c8:	5b                   	pop    %ebx
+  8018c9:	5e                   	pop    %esi
+  8018ca:	5f                   	pop    %edi
+  8018cb:	5d                   	pop    %ebp
+  8018cc:	c3                   	ret
+
+008018cd <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8018cd:	55                   	push   %ebp
+  8018ce:	89 e5                	mov    %esp,%ebp
+  8018d0:	57                   	push   %edi
+  8018d1:	56                   	push   %esi
+  8018d2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8018d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018db:	b8 16 00 00 00       	mov    $0x16,%eax
+  8018e0:	89 cb                	mov    %ecx,%ebx
+  8018e2:	89 cf                	mov    %ecx,%edi
+  8018e4:	55                   	push   %ebp
+  8018e5:	89 e5                	mov    %esp,%ebp
+  8018e7:	8d 35 ef 18 80 00    	lea    0x8018ef,%esi
+  8018ed:	0f 34                	sysenter
+  8018ef:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8018f0:	5b                   	pop    %ebx
+  8018f1:	5e                   	pop    %esi
+  8018f2:	5f                   	pop    %edi
+  8018f3:	5d                   	pop    %ebp
+  8018f4:	c3                   	ret
+
+008018f5 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  8018f5:	55                   	push   %ebp
+  8018f6:	89 e5                	mov    %esp,%ebp
+  8018f8:	57                   	push   %edi
+  8018f9:	56                   	push   %esi
+  8018fa:	53                   	push   %ebx
+  8018fb:	83 ec 20             	sub    $0x20,%esp
+  8018fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801901:	89 d7                	mov    %edx,%edi
+  801903:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  801905:	51                   	push   %ecx
+  801906:	68 00 f0 7f 00       	push   $0x7ff000
+  80190b:	6a 00                	push   $0x0
+  80190d:	e8 e2 fb ff ff       	call   8014f4 <sys_page_alloc>
+  801912:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801914:	83 c4 10             	add    $0x10,%esp
+  801917:	85 c0                	test   %eax,%eax
+  801919:	78 45                	js     801960 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  80191b:	83 ec 04             	sub    $0x4,%esp
+  80191e:	68 00 10 00 00       	push   $0x1000
+  801923:	57                   	push   %edi
+  801924:	68 00 f0 7f 00       	push   $0x7ff000
+  801929:	e8 40 f9 ff ff       	call   80126e <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  80192e:	89 34 24             	mov    %esi,(%esp)
+  801931:	57                   	push   %edi
+  801932:	ff 75 e4             	push   -0x1c(%ebp)
+  801935:	68 00 f0 7f 00       	push   $0x7ff000
+  80193a:	6a 00                	push   $0x0
+  80193c:	e8 fe fb ff ff       	call   80153f <sys_page_map>
+  801941:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801943:	83 c4 20             	add    $0x20,%esp
+  801946:	85 c0                	test   %eax,%eax
+  801948:	78 16                	js     801960 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80194a:	83 ec 08             	sub    $0x8,%esp
+  80194d:	68 00 f0 7f 00       	push   $0x7ff000
+  801952:	6a 00                	push   $0x0
+  801954:	e8 28 fc ff ff       	call   801581 <sys_page_unmap>
+  801959:	83 c4 10             	add    $0x10,%esp
+  80195c:	85 c0                	test   %eax,%eax
+  80195e:	75 0a                	jne    80196a <copy_page_to+0x75>
+exit:
+	return r;
+}
+  801960:	89 d8                	mov    %ebx,%eax
+  801962:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801965:	5b                   	pop    %ebx
+  801966:	5e                   	pop    %esi
+  801967:	5f                   	pop    %edi
+  801968:	5d                   	pop    %ebp
+  801969:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80196a:	68 34 46 80 00       	push   $0x804634
+  80196f:	68 2c 42 80 00       	push   $0x80422c
+  801974:	6a 1b                	push   $0x1b
+  801976:	68 ac 46 80 00       	push   $0x8046ac
+  80197b:	e8 9f f0 ff ff       	call   800a1f <_panic>
+
+00801980 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801980:	55                   	push   %ebp
+  801981:	89 e5                	mov    %esp,%ebp
+  801983:	53                   	push   %ebx
+  801984:	83 ec 04             	sub    $0x4,%esp
+  801987:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  80198a:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80198c:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  801990:	74 21                	je     8019b3 <pgfault+0x33>
+  801992:	89 d0                	mov    %edx,%eax
+  801994:	c1 e8 16             	shr    $0x16,%eax
+  801997:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80199e:	a8 01                	test   $0x1,%al
+  8019a0:	74 11                	je     8019b3 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  8019a2:	89 d0                	mov    %edx,%eax
+  8019a4:	c1 e8 0c             	shr    $0xc,%eax
+  8019a7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8019ae:	f6 c4 08             	test   $0x8,%ah
+  8019b1:	75 17                	jne    8019ca <pgfault+0x4a>
+		if (pgfault_next) {
+  8019b3:	a1 1c 60 80 00       	mov    0x80601c,%eax
+  8019b8:	85 c0                	test   %eax,%eax
+  8019ba:	74 27                	je     8019e3 <pgfault+0x63>
+			pgfault_next(utf);
+  8019bc:	83 ec 0c             	sub    $0xc,%esp
+  8019bf:	53                   	push   %ebx
+  8019c0:	ff d0                	call   *%eax
+			return;
+  8019c2:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8019c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019c8:	c9                   	leave
+  8019c9:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8019ca:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8019d0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8019d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019da:	e8 16 ff ff ff       	call   8018f5 <copy_page_to>
+  8019df:	85 c0                	test   %eax,%eax
+  8019e1:	79 e2                	jns    8019c5 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8019e3:	a1 18 60 80 00       	mov    0x806018,%eax
+  8019e8:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8019eb:	ff 73 28             	push   0x28(%ebx)
+  8019ee:	ff 33                	push   (%ebx)
+  8019f0:	50                   	push   %eax
+  8019f1:	68 58 46 80 00       	push   $0x804658
+  8019f6:	e8 ff f0 ff ff       	call   800afa <cprintf>
+	sys_env_destroy(0);
+  8019fb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801a02:	e8 5e fa ff ff       	call   801465 <sys_env_destroy>
+  801a07:	83 c4 10             	add    $0x10,%esp
+  801a0a:	eb b9                	jmp    8019c5 <pgfault+0x45>
+
+00801a0c <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  801a0c:	55                   	push   %ebp
+  801a0d:	89 e5                	mov    %esp,%ebp
+  801a0f:	53                   	push   %ebx
+  801a10:	83 ec 04             	sub    $0x4,%esp
+  801a13:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  801a16:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  801a1b:	3d 80 19 80 00       	cmp    $0x801980,%eax
+  801a20:	74 15                	je     801a37 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  801a22:	a3 1c 60 80 00       	mov    %eax,0x80601c
+		set_pgfault_handler(pgfault);
+  801a27:	83 ec 0c             	sub    $0xc,%esp
+  801a2a:	68 80 19 80 00       	push   $0x801980
+  801a2f:	e8 74 23 00 00       	call   803da8 <set_pgfault_handler>
+  801a34:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801a37:	83 ec 0c             	sub    $0xc,%esp
+  801a3a:	68 05 08 00 00       	push   $0x805
+  801a3f:	53                   	push   %ebx
+  801a40:	6a 00                	push   $0x0
+  801a42:	53                   	push   %ebx
+  801a43:	6a 00                	push   $0x0
+  801a45:	e8 f5 fa ff ff       	call   80153f <sys_page_map>
+}
+  801a4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a4d:	c9                   	leave
+  801a4e:	c3                   	ret
+
+00801a4f <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801a4f:	55                   	push   %ebp
+  801a50:	89 e5                	mov    %esp,%ebp
+  801a52:	57                   	push   %edi
+  801a53:	56                   	push   %esi
+  801a54:	53                   	push   %ebx
+  801a55:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801a58:	68 80 19 80 00       	push   $0x801980
+  801a5d:	e8 46 23 00 00       	call   803da8 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801a62:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a67:	cd 30                	int    $0x30
+  801a69:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801a6c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  801a6f:	83 c4 10             	add    $0x10,%esp
+  801a72:	85 c0                	test   %eax,%eax
+  801a74:	0f 88 6b 01 00 00    	js     801be5 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801a7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  801a7f:	75 37                	jne    801ab8 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801a81:	e8 28 fa ff ff       	call   8014ae <sys_getenvid>
+  801a86:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a8b:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  801a91:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a96:	a3 18 60 80 00       	mov    %eax,0x806018
+		return 0;
+  801a9b:	e9 45 01 00 00       	jmp    801be5 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  801aa0:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801aa6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801aac:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801ab2:	0f 87 ba 00 00 00    	ja     801b72 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  801ab8:	89 d8                	mov    %ebx,%eax
+  801aba:	c1 e8 16             	shr    $0x16,%eax
+  801abd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ac4:	a8 01                	test   $0x1,%al
+  801ac6:	74 d8                	je     801aa0 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  801ac8:	89 d8                	mov    %ebx,%eax
+  801aca:	c1 e8 0c             	shr    $0xc,%eax
+  801acd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ad4:	f6 c2 01             	test   $0x1,%dl
+  801ad7:	74 cd                	je     801aa6 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  801ad9:	89 da                	mov    %ebx,%edx
+  801adb:	80 e6 df             	and    $0xdf,%dh
+  801ade:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  801ae4:	74 c0                	je     801aa6 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  801ae6:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801ae8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801aef:	f6 c6 04             	test   $0x4,%dh
+  801af2:	75 53                	jne    801b47 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  801af4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801afb:	f6 c6 08             	test   $0x8,%dh
+  801afe:	75 0c                	jne    801b0c <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  801b00:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b07:	f6 c2 02             	test   $0x2,%dl
+  801b0a:	74 3b                	je     801b47 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  801b0c:	83 ec 0c             	sub    $0xc,%esp
+  801b0f:	68 05 08 00 00       	push   $0x805
+  801b14:	57                   	push   %edi
+  801b15:	ff 75 e4             	push   -0x1c(%ebp)
+  801b18:	57                   	push   %edi
+  801b19:	6a 00                	push   $0x0
+  801b1b:	e8 1f fa ff ff       	call   80153f <sys_page_map>
+  801b20:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801b22:	83 c4 20             	add    $0x20,%esp
+  801b25:	85 c0                	test   %eax,%eax
+  801b27:	0f 88 a7 00 00 00    	js     801bd4 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801b2d:	83 ec 0c             	sub    $0xc,%esp
+  801b30:	68 05 08 00 00       	push   $0x805
+  801b35:	57                   	push   %edi
+  801b36:	6a 00                	push   $0x0
+  801b38:	57                   	push   %edi
+  801b39:	6a 00                	push   $0x0
+  801b3b:	e8 ff f9 ff ff       	call   80153f <sys_page_map>
+  801b40:	89 c6                	mov    %eax,%esi
+	return r;
+  801b42:	83 c4 20             	add    $0x20,%esp
+  801b45:	eb 21                	jmp    801b68 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  801b47:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b4e:	83 ec 0c             	sub    $0xc,%esp
+  801b51:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b56:	50                   	push   %eax
+  801b57:	57                   	push   %edi
+  801b58:	ff 75 e4             	push   -0x1c(%ebp)
+  801b5b:	57                   	push   %edi
+  801b5c:	6a 00                	push   $0x0
+  801b5e:	e8 dc f9 ff ff       	call   80153f <sys_page_map>
+  801b63:	89 c6                	mov    %eax,%esi
+  801b65:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  801b68:	85 f6                	test   %esi,%esi
+  801b6a:	0f 89 36 ff ff ff    	jns    801aa6 <fork+0x57>
+  801b70:	eb 62                	jmp    801bd4 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801b72:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801b77:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  801b7c:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801b7f:	89 f8                	mov    %edi,%eax
+  801b81:	e8 6f fd ff ff       	call   8018f5 <copy_page_to>
+  801b86:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801b88:	85 c0                	test   %eax,%eax
+  801b8a:	78 48                	js     801bd4 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801b8c:	83 ec 04             	sub    $0x4,%esp
+  801b8f:	6a 07                	push   $0x7
+  801b91:	68 00 f0 bf ee       	push   $0xeebff000
+  801b96:	57                   	push   %edi
+  801b97:	e8 58 f9 ff ff       	call   8014f4 <sys_page_alloc>
+  801b9c:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801b9e:	83 c4 10             	add    $0x10,%esp
+  801ba1:	85 c0                	test   %eax,%eax
+  801ba3:	78 2f                	js     801bd4 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801ba5:	a1 18 60 80 00       	mov    0x806018,%eax
+  801baa:	8b 40 64             	mov    0x64(%eax),%eax
+  801bad:	83 ec 08             	sub    $0x8,%esp
+  801bb0:	50                   	push   %eax
+  801bb1:	57                   	push   %edi
+  801bb2:	e8 a8 fa ff ff       	call   80165f <sys_env_set_pgfault_upcall>
+  801bb7:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801bb9:	83 c4 10             	add    $0x10,%esp
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	78 14                	js     801bd4 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  801bc0:	83 ec 08             	sub    $0x8,%esp
+  801bc3:	6a 02                	push   $0x2
+  801bc5:	57                   	push   %edi
+  801bc6:	e8 00 fa ff ff       	call   8015cb <sys_env_set_status>
+  801bcb:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801bcd:	83 c4 10             	add    $0x10,%esp
+  801bd0:	85 c0                	test   %eax,%eax
+  801bd2:	79 11                	jns    801be5 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  801bd4:	83 ec 0c             	sub    $0xc,%esp
+  801bd7:	ff 75 e0             	push   -0x20(%ebp)
+  801bda:	e8 86 f8 ff ff       	call   801465 <sys_env_destroy>
+	return r;
+  801bdf:	83 c4 10             	add    $0x10,%esp
+  801be2:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  801be5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801be8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801beb:	5b                   	pop    %ebx
+  801bec:	5e                   	pop    %esi
+  801bed:	5f                   	pop    %edi
+  801bee:	5d                   	pop    %ebp
+  801bef:	c3                   	ret
+
+00801bf0 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801bf0:	55                   	push   %ebp
+  801bf1:	89 e5                	mov    %esp,%ebp
+  801bf3:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801bf6:	68 b7 46 80 00       	push   $0x8046b7
+  801bfb:	68 bf 00 00 00       	push   $0xbf
+  801c00:	68 ac 46 80 00       	push   $0x8046ac
+  801c05:	e8 15 ee ff ff       	call   800a1f <_panic>
+
+00801c0a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	56                   	push   %esi
+  801c0e:	53                   	push   %ebx
+  801c0f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c15:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801c18:	85 c0                	test   %eax,%eax
+  801c1a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801c1f:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  801c22:	83 ec 0c             	sub    $0xc,%esp
+  801c25:	50                   	push   %eax
+  801c26:	e8 11 fb ff ff       	call   80173c <sys_ipc_recv>
+	if (from_env_store)
+  801c2b:	83 c4 10             	add    $0x10,%esp
+  801c2e:	85 f6                	test   %esi,%esi
+  801c30:	74 14                	je     801c46 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801c32:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c37:	85 c0                	test   %eax,%eax
+  801c39:	75 09                	jne    801c44 <ipc_recv+0x3a>
+  801c3b:	8b 15 18 60 80 00    	mov    0x806018,%edx
+  801c41:	8b 52 74             	mov    0x74(%edx),%edx
+  801c44:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  801c46:	85 db                	test   %ebx,%ebx
+  801c48:	74 25                	je     801c6f <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801c4a:	85 c0                	test   %eax,%eax
+  801c4c:	74 0d                	je     801c5b <ipc_recv+0x51>
+  801c4e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  801c54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c57:	5b                   	pop    %ebx
+  801c58:	5e                   	pop    %esi
+  801c59:	5d                   	pop    %ebp
+  801c5a:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801c5b:	a1 18 60 80 00       	mov    0x806018,%eax
+  801c60:	8b 40 78             	mov    0x78(%eax),%eax
+  801c63:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  801c65:	a1 18 60 80 00       	mov    0x806018,%eax
+  801c6a:	8b 40 70             	mov    0x70(%eax),%eax
+  801c6d:	eb e5                	jmp    801c54 <ipc_recv+0x4a>
+  801c6f:	85 c0                	test   %eax,%eax
+  801c71:	75 e1                	jne    801c54 <ipc_recv+0x4a>
+  801c73:	eb f0                	jmp    801c65 <ipc_recv+0x5b>
+
+00801c75 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801c75:	55                   	push   %ebp
+  801c76:	89 e5                	mov    %esp,%ebp
+  801c78:	57                   	push   %edi
+  801c79:	56                   	push   %esi
+  801c7a:	53                   	push   %ebx
+  801c7b:	83 ec 0c             	sub    $0xc,%esp
+  801c7e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c81:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801c87:	85 db                	test   %ebx,%ebx
+  801c89:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801c8e:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  801c91:	ff 75 14             	push   0x14(%ebp)
+  801c94:	53                   	push   %ebx
+  801c95:	56                   	push   %esi
+  801c96:	57                   	push   %edi
+  801c97:	e8 0d fa ff ff       	call   8016a9 <sys_ipc_try_send>
+  801c9c:	83 c4 10             	add    $0x10,%esp
+  801c9f:	85 c0                	test   %eax,%eax
+  801ca1:	74 22                	je     801cc5 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  801ca3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801ca6:	75 07                	jne    801caf <ipc_send+0x3a>
+		sys_yield();
+  801ca8:	e8 28 f8 ff ff       	call   8014d5 <sys_yield>
+  801cad:	eb e2                	jmp    801c91 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  801caf:	68 cd 46 80 00       	push   $0x8046cd
+  801cb4:	68 2c 42 80 00       	push   $0x80422c
+  801cb9:	6a 39                	push   $0x39
+  801cbb:	68 e2 46 80 00       	push   $0x8046e2
+  801cc0:	e8 5a ed ff ff       	call   800a1f <_panic>
+	}
+}
+  801cc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cc8:	5b                   	pop    %ebx
+  801cc9:	5e                   	pop    %esi
+  801cca:	5f                   	pop    %edi
+  801ccb:	5d                   	pop    %ebp
+  801ccc:	c3                   	ret
+
+00801ccd <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  801ccd:	55                   	push   %ebp
+  801cce:	89 e5                	mov    %esp,%ebp
+  801cd0:	57                   	push   %edi
+  801cd1:	56                   	push   %esi
+  801cd2:	53                   	push   %ebx
+  801cd3:	83 ec 10             	sub    $0x10,%esp
+  801cd6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801cd9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cdc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cdf:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801ce9:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  801cec:	6a 00                	push   $0x0
+  801cee:	ff 33                	push   (%ebx)
+  801cf0:	50                   	push   %eax
+  801cf1:	e8 03 fa ff ff       	call   8016f9 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  801cf6:	83 c4 10             	add    $0x10,%esp
+  801cf9:	85 c0                	test   %eax,%eax
+  801cfb:	75 3c                	jne    801d39 <ipc_recvv+0x6c>
+  801cfd:	8b 15 18 60 80 00    	mov    0x806018,%edx
+  801d03:	8b 52 7c             	mov    0x7c(%edx),%edx
+  801d06:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  801d08:	85 ff                	test   %edi,%edi
+  801d0a:	74 4e                	je     801d5a <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801d0c:	8b 15 18 60 80 00    	mov    0x806018,%edx
+  801d12:	8b 52 74             	mov    0x74(%edx),%edx
+  801d15:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  801d17:	85 f6                	test   %esi,%esi
+  801d19:	74 18                	je     801d33 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801d1b:	85 c0                	test   %eax,%eax
+  801d1d:	75 2d                	jne    801d4c <ipc_recvv+0x7f>
+  801d1f:	a1 18 60 80 00       	mov    0x806018,%eax
+  801d24:	8b 40 78             	mov    0x78(%eax),%eax
+  801d27:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  801d29:	a1 18 60 80 00       	mov    0x806018,%eax
+  801d2e:	8b 40 70             	mov    0x70(%eax),%eax
+  801d31:	eb 1f                	jmp    801d52 <ipc_recvv+0x85>
+  801d33:	85 c0                	test   %eax,%eax
+  801d35:	75 1b                	jne    801d52 <ipc_recvv+0x85>
+  801d37:	eb f0                	jmp    801d29 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  801d39:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801d3f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  801d44:	85 ff                	test   %edi,%edi
+  801d46:	75 cd                	jne    801d15 <ipc_recvv+0x48>
+	if (perm_store)
+  801d48:	85 f6                	test   %esi,%esi
+  801d4a:	74 e7                	je     801d33 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801d4c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  801d52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d55:	5b                   	pop    %ebx
+  801d56:	5e                   	pop    %esi
+  801d57:	5f                   	pop    %edi
+  801d58:	5d                   	pop    %ebp
+  801d59:	c3                   	ret
+	if (perm_store)
+  801d5a:	85 f6                	test   %esi,%esi
+  801d5c:	75 bd                	jne    801d1b <ipc_recvv+0x4e>
+  801d5e:	eb c9                	jmp    801d29 <ipc_recvv+0x5c>
+
+00801d60 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  801d60:	55                   	push   %ebp
+  801d61:	89 e5                	mov    %esp,%ebp
+  801d63:	57                   	push   %edi
+  801d64:	56                   	push   %esi
+  801d65:	53                   	push   %ebx
+  801d66:	83 ec 0c             	sub    $0xc,%esp
+  801d69:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d6c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  801d72:	ff 75 14             	push   0x14(%ebp)
+  801d75:	53                   	push   %ebx
+  801d76:	56                   	push   %esi
+  801d77:	57                   	push   %edi
+  801d78:	e8 54 f9 ff ff       	call   8016d1 <sys_ipc_try_sendv>
+  801d7d:	83 c4 10             	add    $0x10,%esp
+  801d80:	85 c0                	test   %eax,%eax
+  801d82:	74 22                	je     801da6 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  801d84:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801d87:	75 07                	jne    801d90 <ipc_sendv+0x30>
+		sys_yield();
+  801d89:	e8 47 f7 ff ff       	call   8014d5 <sys_yield>
+  801d8e:	eb e2                	jmp    801d72 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  801d90:	68 cd 46 80 00       	push   $0x8046cd
+  801d95:	68 2c 42 80 00       	push   $0x80422c
+  801d9a:	6a 5c                	push   $0x5c
+  801d9c:	68 e2 46 80 00       	push   $0x8046e2
+  801da1:	e8 79 ec ff ff       	call   800a1f <_panic>
+	}
+}
+  801da6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801da9:	5b                   	pop    %ebx
+  801daa:	5e                   	pop    %esi
+  801dab:	5f                   	pop    %edi
+  801dac:	5d                   	pop    %ebp
+  801dad:	c3                   	ret
+
+00801dae <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801dae:	55                   	push   %ebp
+  801daf:	89 e5                	mov    %esp,%ebp
+  801db1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801db4:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801db9:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  801dbf:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801dc5:	8b 52 50             	mov    0x50(%edx),%edx
+  801dc8:	39 ca                	cmp    %ecx,%edx
+  801dca:	74 11                	je     801ddd <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801dcc:	83 c0 01             	add    $0x1,%eax
+  801dcf:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801dd4:	75 e3                	jne    801db9 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801dd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ddb:	eb 0e                	jmp    801deb <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801ddd:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  801de3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801de8:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801deb:	5d                   	pop    %ebp
+  801dec:	c3                   	ret
+
+00801ded <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801ded:	55                   	push   %ebp
+  801dee:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801df0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df3:	05 00 00 00 30       	add    $0x30000000,%eax
+  801df8:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801dfb:	5d                   	pop    %ebp
+  801dfc:	c3                   	ret
+
+00801dfd <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801dfd:	55                   	push   %ebp
+  801dfe:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801e00:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e03:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801e08:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801e0d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801e12:	5d                   	pop    %ebp
+  801e13:	c3                   	ret
+
+00801e14 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801e14:	55                   	push   %ebp
+  801e15:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801e17:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801e1c:	eb 02                	jmp    801e20 <fd_alloc+0xc>
+  801e1e:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801e20:	89 c2                	mov    %eax,%edx
+  801e22:	c1 ea 16             	shr    $0x16,%edx
+  801e25:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801e2c:	f6 c2 01             	test   $0x1,%dl
+  801e2f:	74 2b                	je     801e5c <fd_alloc+0x48>
+  801e31:	89 c2                	mov    %eax,%edx
+  801e33:	c1 ea 0c             	shr    $0xc,%edx
+  801e36:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801e3d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801e43:	f6 c1 01             	test   $0x1,%cl
+  801e46:	74 14                	je     801e5c <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801e48:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801e4e:	75 ce                	jne    801e1e <fd_alloc+0xa>
+  801e50:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801e55:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801e5a:	eb 05                	jmp    801e61 <fd_alloc+0x4d>
+			return 0;
+  801e5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801e61:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e64:	89 02                	mov    %eax,(%edx)
+}
+  801e66:	89 c8                	mov    %ecx,%eax
+  801e68:	5d                   	pop    %ebp
+  801e69:	c3                   	ret
+
+00801e6a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801e6a:	55                   	push   %ebp
+  801e6b:	89 e5                	mov    %esp,%ebp
+  801e6d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801e70:	83 f8 1f             	cmp    $0x1f,%eax
+  801e73:	77 30                	ja     801ea5 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801e75:	c1 e0 0c             	shl    $0xc,%eax
+  801e78:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801e7d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801e83:	f6 c2 01             	test   $0x1,%dl
+  801e86:	74 24                	je     801eac <fd_lookup+0x42>
+  801e88:	89 c2                	mov    %eax,%edx
+  801e8a:	c1 ea 0c             	shr    $0xc,%edx
+  801e8d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e94:	f6 c2 01             	test   $0x1,%dl
+  801e97:	74 1a                	je     801eb3 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801e99:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e9c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ea3:	5d                   	pop    %ebp
+  801ea4:	c3                   	ret
+		return -E_INVAL;
+  801ea5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eaa:	eb f7                	jmp    801ea3 <fd_lookup+0x39>
+		return -E_INVAL;
+  801eac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eb1:	eb f0                	jmp    801ea3 <fd_lookup+0x39>
+  801eb3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eb8:	eb e9                	jmp    801ea3 <fd_lookup+0x39>
+
+00801eba <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801eba:	55                   	push   %ebp
+  801ebb:	89 e5                	mov    %esp,%ebp
+  801ebd:	53                   	push   %ebx
+  801ebe:	83 ec 04             	sub    $0x4,%esp
+  801ec1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801ec4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec9:	eb 03                	jmp    801ece <dev_lookup+0x14>
+  801ecb:	83 c0 01             	add    $0x1,%eax
+  801ece:	8b 1c 85 68 47 80 00 	mov    0x804768(,%eax,4),%ebx
+  801ed5:	85 db                	test   %ebx,%ebx
+  801ed7:	74 0b                	je     801ee4 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801ed9:	39 13                	cmp    %edx,(%ebx)
+  801edb:	75 ee                	jne    801ecb <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee2:	eb 1f                	jmp    801f03 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ee4:	a1 18 60 80 00       	mov    0x806018,%eax
+  801ee9:	8b 40 48             	mov    0x48(%eax),%eax
+  801eec:	83 ec 04             	sub    $0x4,%esp
+  801eef:	52                   	push   %edx
+  801ef0:	50                   	push   %eax
+  801ef1:	68 ec 46 80 00       	push   $0x8046ec
+  801ef6:	e8 ff eb ff ff       	call   800afa <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801efb:	83 c4 10             	add    $0x10,%esp
+  801efe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801f03:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f06:	89 1a                	mov    %ebx,(%edx)
+}
+  801f08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f0b:	c9                   	leave
+  801f0c:	c3                   	ret
+
+00801f0d <fd_close>:
+{
+  801f0d:	55                   	push   %ebp
+  801f0e:	89 e5                	mov    %esp,%ebp
+  801f10:	57                   	push   %edi
+  801f11:	56                   	push   %esi
+  801f12:	53                   	push   %ebx
+  801f13:	83 ec 24             	sub    $0x24,%esp
+  801f16:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f19:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801f1c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f1f:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801f20:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801f26:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801f29:	50                   	push   %eax
+  801f2a:	e8 3b ff ff ff       	call   801e6a <fd_lookup>
+  801f2f:	89 c3                	mov    %eax,%ebx
+  801f31:	83 c4 10             	add    $0x10,%esp
+  801f34:	85 c0                	test   %eax,%eax
+  801f36:	78 05                	js     801f3d <fd_close+0x30>
+	    || fd != fd2)
+  801f38:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801f3b:	74 16                	je     801f53 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801f3d:	89 f8                	mov    %edi,%eax
+  801f3f:	84 c0                	test   %al,%al
+  801f41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f46:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801f49:	89 d8                	mov    %ebx,%eax
+  801f4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f4e:	5b                   	pop    %ebx
+  801f4f:	5e                   	pop    %esi
+  801f50:	5f                   	pop    %edi
+  801f51:	5d                   	pop    %ebp
+  801f52:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801f53:	83 ec 08             	sub    $0x8,%esp
+  801f56:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801f59:	50                   	push   %eax
+  801f5a:	ff 36                	push   (%esi)
+  801f5c:	e8 59 ff ff ff       	call   801eba <dev_lookup>
+  801f61:	89 c3                	mov    %eax,%ebx
+  801f63:	83 c4 10             	add    $0x10,%esp
+  801f66:	85 c0                	test   %eax,%eax
+  801f68:	78 1a                	js     801f84 <fd_close+0x77>
+		if (dev->dev_close)
+  801f6a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f6d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801f70:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801f75:	85 c0                	test   %eax,%eax
+  801f77:	74 0b                	je     801f84 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801f79:	83 ec 0c             	sub    $0xc,%esp
+  801f7c:	56                   	push   %esi
+  801f7d:	ff d0                	call   *%eax
+  801f7f:	89 c3                	mov    %eax,%ebx
+  801f81:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801f84:	83 ec 08             	sub    $0x8,%esp
+  801f87:	56                   	push   %esi
+  801f88:	6a 00                	push   $0x0
+  801f8a:	e8 f2 f5 ff ff       	call   801581 <sys_page_unmap>
+	return r;
+  801f8f:	83 c4 10             	add    $0x10,%esp
+  801f92:	eb b5                	jmp    801f49 <fd_close+0x3c>
+
+00801f94 <close>:
+
+int
+close(int fdnum)
+{
+  801f94:	55                   	push   %ebp
+  801f95:	89 e5                	mov    %esp,%ebp
+  801f97:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f9d:	50                   	push   %eax
+  801f9e:	ff 75 08             	push   0x8(%ebp)
+  801fa1:	e8 c4 fe ff ff       	call   801e6a <fd_lookup>
+  801fa6:	83 c4 10             	add    $0x10,%esp
+  801fa9:	85 c0                	test   %eax,%eax
+  801fab:	79 02                	jns    801faf <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801fad:	c9                   	leave
+  801fae:	c3                   	ret
+		return fd_close(fd, 1);
+  801faf:	83 ec 08             	sub    $0x8,%esp
+  801fb2:	6a 01                	push   $0x1
+  801fb4:	ff 75 f4             	push   -0xc(%ebp)
+  801fb7:	e8 51 ff ff ff       	call   801f0d <fd_close>
+  801fbc:	83 c4 10             	add    $0x10,%esp
+  801fbf:	eb ec                	jmp    801fad <close+0x19>
+
+00801fc1 <close_all>:
+
+void
+close_all(void)
+{
+  801fc1:	55                   	push   %ebp
+  801fc2:	89 e5                	mov    %esp,%ebp
+  801fc4:	53                   	push   %ebx
+  801fc5:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801fc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801fcd:	83 ec 0c             	sub    $0xc,%esp
+  801fd0:	53                   	push   %ebx
+  801fd1:	e8 be ff ff ff       	call   801f94 <close>
+	for (i = 0; i < MAXFD; i++)
+  801fd6:	83 c3 01             	add    $0x1,%ebx
+  801fd9:	83 c4 10             	add    $0x10,%esp
+  801fdc:	83 fb 20             	cmp    $0x20,%ebx
+  801fdf:	75 ec                	jne    801fcd <close_all+0xc>
+}
+  801fe1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fe4:	c9                   	leave
+  801fe5:	c3                   	ret
+
+00801fe6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801fe6:	55                   	push   %ebp
+  801fe7:	89 e5                	mov    %esp,%ebp
+  801fe9:	57                   	push   %edi
+  801fea:	56                   	push   %esi
+  801feb:	53                   	push   %ebx
+  801fec:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801fef:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ff2:	50                   	push   %eax
+  801ff3:	ff 75 08             	push   0x8(%ebp)
+  801ff6:	e8 6f fe ff ff       	call   801e6a <fd_lookup>
+  801ffb:	89 c3                	mov    %eax,%ebx
+  801ffd:	83 c4 10             	add    $0x10,%esp
+  802000:	85 c0                	test   %eax,%eax
+  802002:	78 7f                	js     802083 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802004:	83 ec 0c             	sub    $0xc,%esp
+  802007:	ff 75 0c             	push   0xc(%ebp)
+  80200a:	e8 85 ff ff ff       	call   801f94 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80200f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802012:	c1 e6 0c             	shl    $0xc,%esi
+  802015:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80201b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80201e:	89 3c 24             	mov    %edi,(%esp)
+  802021:	e8 d7 fd ff ff       	call   801dfd <fd2data>
+  802026:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  802028:	89 34 24             	mov    %esi,(%esp)
+  80202b:	e8 cd fd ff ff       	call   801dfd <fd2data>
+  802030:	83 c4 10             	add    $0x10,%esp
+  802033:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802036:	89 d8                	mov    %ebx,%eax
+  802038:	c1 e8 16             	shr    $0x16,%eax
+  80203b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802042:	a8 01                	test   $0x1,%al
+  802044:	74 11                	je     802057 <dup+0x71>
+  802046:	89 d8                	mov    %ebx,%eax
+  802048:	c1 e8 0c             	shr    $0xc,%eax
+  80204b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802052:	f6 c2 01             	test   $0x1,%dl
+  802055:	75 36                	jne    80208d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802057:	89 f8                	mov    %edi,%eax
+  802059:	c1 e8 0c             	shr    $0xc,%eax
+  80205c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802063:	83 ec 0c             	sub    $0xc,%esp
+  802066:	25 07 0e 00 00       	and    $0xe07,%eax
+  80206b:	50                   	push   %eax
+  80206c:	56                   	push   %esi
+  80206d:	6a 00                	push   $0x0
+  80206f:	57                   	push   %edi
+  802070:	6a 00                	push   $0x0
+  802072:	e8 c8 f4 ff ff       	call   80153f <sys_page_map>
+  802077:	89 c3                	mov    %eax,%ebx
+  802079:	83 c4 20             	add    $0x20,%esp
+  80207c:	85 c0                	test   %eax,%eax
+  80207e:	78 33                	js     8020b3 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802080:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802083:	89 d8                	mov    %ebx,%eax
+  802085:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802088:	5b                   	pop    %ebx
+  802089:	5e                   	pop    %esi
+  80208a:	5f                   	pop    %edi
+  80208b:	5d                   	pop    %ebp
+  80208c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80208d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802094:	83 ec 0c             	sub    $0xc,%esp
+  802097:	25 07 0e 00 00       	and    $0xe07,%eax
+  80209c:	50                   	push   %eax
+  80209d:	ff 75 d4             	push   -0x2c(%ebp)
+  8020a0:	6a 00                	push   $0x0
+  8020a2:	53                   	push   %ebx
+  8020a3:	6a 00                	push   $0x0
+  8020a5:	e8 95 f4 ff ff       	call   80153f <sys_page_map>
+  8020aa:	89 c3                	mov    %eax,%ebx
+  8020ac:	83 c4 20             	add    $0x20,%esp
+  8020af:	85 c0                	test   %eax,%eax
+  8020b1:	79 a4                	jns    802057 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8020b3:	83 ec 08             	sub    $0x8,%esp
+  8020b6:	56                   	push   %esi
+  8020b7:	6a 00                	push   $0x0
+  8020b9:	e8 c3 f4 ff ff       	call   801581 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8020be:	83 c4 08             	add    $0x8,%esp
+  8020c1:	ff 75 d4             	push   -0x2c(%ebp)
+  8020c4:	6a 00                	push   $0x0
+  8020c6:	e8 b6 f4 ff ff       	call   801581 <sys_page_unmap>
+	return r;
+  8020cb:	83 c4 10             	add    $0x10,%esp
+  8020ce:	eb b3                	jmp    802083 <dup+0x9d>
+
+008020d0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8020d0:	55                   	push   %ebp
+  8020d1:	89 e5                	mov    %esp,%ebp
+  8020d3:	56                   	push   %esi
+  8020d4:	53                   	push   %ebx
+  8020d5:	83 ec 18             	sub    $0x18,%esp
+  8020d8:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020db:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020de:	50                   	push   %eax
+  8020df:	56                   	push   %esi
+  8020e0:	e8 85 fd ff ff       	call   801e6a <fd_lookup>
+  8020e5:	83 c4 10             	add    $0x10,%esp
+  8020e8:	85 c0                	test   %eax,%eax
+  8020ea:	78 3c                	js     802128 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020ec:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8020ef:	83 ec 08             	sub    $0x8,%esp
+  8020f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020f5:	50                   	push   %eax
+  8020f6:	ff 33                	push   (%ebx)
+  8020f8:	e8 bd fd ff ff       	call   801eba <dev_lookup>
+  8020fd:	83 c4 10             	add    $0x10,%esp
+  802100:	85 c0                	test   %eax,%eax
+  802102:	78 24                	js     802128 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802104:	8b 43 08             	mov    0x8(%ebx),%eax
+  802107:	83 e0 03             	and    $0x3,%eax
+  80210a:	83 f8 01             	cmp    $0x1,%eax
+  80210d:	74 20                	je     80212f <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80210f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802112:	8b 40 08             	mov    0x8(%eax),%eax
+  802115:	85 c0                	test   %eax,%eax
+  802117:	74 37                	je     802150 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  802119:	83 ec 04             	sub    $0x4,%esp
+  80211c:	ff 75 10             	push   0x10(%ebp)
+  80211f:	ff 75 0c             	push   0xc(%ebp)
+  802122:	53                   	push   %ebx
+  802123:	ff d0                	call   *%eax
+  802125:	83 c4 10             	add    $0x10,%esp
+}
+  802128:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80212b:	5b                   	pop    %ebx
+  80212c:	5e                   	pop    %esi
+  80212d:	5d                   	pop    %ebp
+  80212e:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80212f:	a1 18 60 80 00       	mov    0x806018,%eax
+  802134:	8b 40 48             	mov    0x48(%eax),%eax
+  802137:	83 ec 04             	sub    $0x4,%esp
+  80213a:	56                   	push   %esi
+  80213b:	50                   	push   %eax
+  80213c:	68 2d 47 80 00       	push   $0x80472d
+  802141:	e8 b4 e9 ff ff       	call   800afa <cprintf>
+		return -E_INVAL;
+  802146:	83 c4 10             	add    $0x10,%esp
+  802149:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80214e:	eb d8                	jmp    802128 <read+0x58>
+		return -E_NOT_SUPP;
+  802150:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802155:	eb d1                	jmp    802128 <read+0x58>
+
+00802157 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802157:	55                   	push   %ebp
+  802158:	89 e5                	mov    %esp,%ebp
+  80215a:	57                   	push   %edi
+  80215b:	56                   	push   %esi
+  80215c:	53                   	push   %ebx
+  80215d:	83 ec 0c             	sub    $0xc,%esp
+  802160:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802163:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802166:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80216b:	eb 02                	jmp    80216f <readn+0x18>
+  80216d:	01 c3                	add    %eax,%ebx
+  80216f:	39 f3                	cmp    %esi,%ebx
+  802171:	73 21                	jae    802194 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802173:	83 ec 04             	sub    $0x4,%esp
+  802176:	89 f0                	mov    %esi,%eax
+  802178:	29 d8                	sub    %ebx,%eax
+  80217a:	50                   	push   %eax
+  80217b:	89 d8                	mov    %ebx,%eax
+  80217d:	03 45 0c             	add    0xc(%ebp),%eax
+  802180:	50                   	push   %eax
+  802181:	57                   	push   %edi
+  802182:	e8 49 ff ff ff       	call   8020d0 <read>
+		if (m < 0)
+  802187:	83 c4 10             	add    $0x10,%esp
+  80218a:	85 c0                	test   %eax,%eax
+  80218c:	78 04                	js     802192 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80218e:	75 dd                	jne    80216d <readn+0x16>
+  802190:	eb 02                	jmp    802194 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802192:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802194:	89 d8                	mov    %ebx,%eax
+  802196:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802199:	5b                   	pop    %ebx
+  80219a:	5e                   	pop    %esi
+  80219b:	5f                   	pop    %edi
+  80219c:	5d                   	pop    %ebp
+  80219d:	c3                   	ret
+
+0080219e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80219e:	55                   	push   %ebp
+  80219f:	89 e5                	mov    %esp,%ebp
+  8021a1:	56                   	push   %esi
+  8021a2:	53                   	push   %ebx
+  8021a3:	83 ec 18             	sub    $0x18,%esp
+  8021a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8021a9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021ac:	50                   	push   %eax
+  8021ad:	53                   	push   %ebx
+  8021ae:	e8 b7 fc ff ff       	call   801e6a <fd_lookup>
+  8021b3:	83 c4 10             	add    $0x10,%esp
+  8021b6:	85 c0                	test   %eax,%eax
+  8021b8:	78 37                	js     8021f1 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8021ba:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021bd:	83 ec 08             	sub    $0x8,%esp
+  8021c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c3:	50                   	push   %eax
+  8021c4:	ff 36                	push   (%esi)
+  8021c6:	e8 ef fc ff ff       	call   801eba <dev_lookup>
+  8021cb:	83 c4 10             	add    $0x10,%esp
+  8021ce:	85 c0                	test   %eax,%eax
+  8021d0:	78 1f                	js     8021f1 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021d2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8021d6:	74 20                	je     8021f8 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8021d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021db:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021de:	85 c0                	test   %eax,%eax
+  8021e0:	74 37                	je     802219 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8021e2:	83 ec 04             	sub    $0x4,%esp
+  8021e5:	ff 75 10             	push   0x10(%ebp)
+  8021e8:	ff 75 0c             	push   0xc(%ebp)
+  8021eb:	56                   	push   %esi
+  8021ec:	ff d0                	call   *%eax
+  8021ee:	83 c4 10             	add    $0x10,%esp
+}
+  8021f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021f4:	5b                   	pop    %ebx
+  8021f5:	5e                   	pop    %esi
+  8021f6:	5d                   	pop    %ebp
+  8021f7:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021f8:	a1 18 60 80 00       	mov    0x806018,%eax
+  8021fd:	8b 40 48             	mov    0x48(%eax),%eax
+  802200:	83 ec 04             	sub    $0x4,%esp
+  802203:	53                   	push   %ebx
+  802204:	50                   	push   %eax
+  802205:	68 49 47 80 00       	push   $0x804749
+  80220a:	e8 eb e8 ff ff       	call   800afa <cprintf>
+		return -E_INVAL;
+  80220f:	83 c4 10             	add    $0x10,%esp
+  802212:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802217:	eb d8                	jmp    8021f1 <write+0x53>
+		return -E_NOT_SUPP;
+  802219:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80221e:	eb d1                	jmp    8021f1 <write+0x53>
+
+00802220 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802220:	55                   	push   %ebp
+  802221:	89 e5                	mov    %esp,%ebp
+  802223:	53                   	push   %ebx
+  802224:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802227:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80222a:	50                   	push   %eax
+  80222b:	ff 75 08             	push   0x8(%ebp)
+  80222e:	e8 37 fc ff ff       	call   801e6a <fd_lookup>
+  802233:	83 c4 10             	add    $0x10,%esp
+  802236:	85 c0                	test   %eax,%eax
+  802238:	78 3a                	js     802274 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80223a:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80223d:	83 ec 08             	sub    $0x8,%esp
+  802240:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802243:	50                   	push   %eax
+  802244:	ff 33                	push   (%ebx)
+  802246:	e8 6f fc ff ff       	call   801eba <dev_lookup>
+  80224b:	83 c4 10             	add    $0x10,%esp
+  80224e:	85 c0                	test   %eax,%eax
+  802250:	78 22                	js     802274 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  802252:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802255:	8b 40 1c             	mov    0x1c(%eax),%eax
+  802258:	85 c0                	test   %eax,%eax
+  80225a:	74 0d                	je     802269 <seek+0x49>
+  80225c:	83 ec 0c             	sub    $0xc,%esp
+  80225f:	53                   	push   %ebx
+  802260:	ff d0                	call   *%eax
+  802262:	83 c4 10             	add    $0x10,%esp
+  802265:	85 c0                	test   %eax,%eax
+  802267:	78 0b                	js     802274 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  802269:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80226c:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  80226f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802274:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802277:	c9                   	leave
+  802278:	c3                   	ret
+
+00802279 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  802279:	55                   	push   %ebp
+  80227a:	89 e5                	mov    %esp,%ebp
+  80227c:	53                   	push   %ebx
+  80227d:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802280:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802283:	50                   	push   %eax
+  802284:	ff 75 08             	push   0x8(%ebp)
+  802287:	e8 de fb ff ff       	call   801e6a <fd_lookup>
+  80228c:	83 c4 10             	add    $0x10,%esp
+  80228f:	85 c0                	test   %eax,%eax
+  802291:	78 2b                	js     8022be <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802293:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802296:	83 ec 08             	sub    $0x8,%esp
+  802299:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80229c:	50                   	push   %eax
+  80229d:	ff 33                	push   (%ebx)
+  80229f:	e8 16 fc ff ff       	call   801eba <dev_lookup>
+  8022a4:	83 c4 10             	add    $0x10,%esp
+  8022a7:	85 c0                	test   %eax,%eax
+  8022a9:	78 13                	js     8022be <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8022ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022ae:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8022b1:	85 c0                	test   %eax,%eax
+  8022b3:	74 0e                	je     8022c3 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8022b5:	83 ec 0c             	sub    $0xc,%esp
+  8022b8:	53                   	push   %ebx
+  8022b9:	ff d0                	call   *%eax
+  8022bb:	83 c4 10             	add    $0x10,%esp
+}
+  8022be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c1:	c9                   	leave
+  8022c2:	c3                   	ret
+		return 0;
+  8022c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c8:	eb f4                	jmp    8022be <fsync+0x45>
+
+008022ca <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8022ca:	55                   	push   %ebp
+  8022cb:	89 e5                	mov    %esp,%ebp
+  8022cd:	56                   	push   %esi
+  8022ce:	53                   	push   %ebx
+  8022cf:	83 ec 18             	sub    $0x18,%esp
+  8022d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8022d5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022d8:	50                   	push   %eax
+  8022d9:	53                   	push   %ebx
+  8022da:	e8 8b fb ff ff       	call   801e6a <fd_lookup>
+  8022df:	83 c4 10             	add    $0x10,%esp
+  8022e2:	85 c0                	test   %eax,%eax
+  8022e4:	78 34                	js     80231a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8022e6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022e9:	83 ec 08             	sub    $0x8,%esp
+  8022ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022ef:	50                   	push   %eax
+  8022f0:	ff 36                	push   (%esi)
+  8022f2:	e8 c3 fb ff ff       	call   801eba <dev_lookup>
+  8022f7:	83 c4 10             	add    $0x10,%esp
+  8022fa:	85 c0                	test   %eax,%eax
+  8022fc:	78 1c                	js     80231a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022fe:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802302:	74 1d                	je     802321 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802304:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802307:	8b 40 18             	mov    0x18(%eax),%eax
+  80230a:	85 c0                	test   %eax,%eax
+  80230c:	74 34                	je     802342 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80230e:	83 ec 08             	sub    $0x8,%esp
+  802311:	ff 75 0c             	push   0xc(%ebp)
+  802314:	56                   	push   %esi
+  802315:	ff d0                	call   *%eax
+  802317:	83 c4 10             	add    $0x10,%esp
+}
+  80231a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80231d:	5b                   	pop    %ebx
+  80231e:	5e                   	pop    %esi
+  80231f:	5d                   	pop    %ebp
+  802320:	c3                   	ret
+			thisenv->env_id, fdnum);
+  802321:	a1 18 60 80 00       	mov    0x806018,%eax
+  802326:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802329:	83 ec 04             	sub    $0x4,%esp
+  80232c:	53                   	push   %ebx
+  80232d:	50                   	push   %eax
+  80232e:	68 0c 47 80 00       	push   $0x80470c
+  802333:	e8 c2 e7 ff ff       	call   800afa <cprintf>
+		return -E_INVAL;
+  802338:	83 c4 10             	add    $0x10,%esp
+  80233b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802340:	eb d8                	jmp    80231a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802342:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802347:	eb d1                	jmp    80231a <ftruncate+0x50>
+
+00802349 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802349:	55                   	push   %ebp
+  80234a:	89 e5                	mov    %esp,%ebp
+  80234c:	56                   	push   %esi
+  80234d:	53                   	push   %ebx
+  80234e:	83 ec 18             	sub    $0x18,%esp
+  802351:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802354:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802357:	50                   	push   %eax
+  802358:	ff 75 08             	push   0x8(%ebp)
+  80235b:	e8 0a fb ff ff       	call   801e6a <fd_lookup>
+  802360:	83 c4 10             	add    $0x10,%esp
+  802363:	85 c0                	test   %eax,%eax
+  802365:	78 49                	js     8023b0 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802367:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80236a:	83 ec 08             	sub    $0x8,%esp
+  80236d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802370:	50                   	push   %eax
+  802371:	ff 36                	push   (%esi)
+  802373:	e8 42 fb ff ff       	call   801eba <dev_lookup>
+  802378:	83 c4 10             	add    $0x10,%esp
+  80237b:	85 c0                	test   %eax,%eax
+  80237d:	78 31                	js     8023b0 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80237f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802382:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802386:	74 2f                	je     8023b7 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802388:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80238b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802392:	00 00 00 
+	stat->st_isdir = 0;
+  802395:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80239c:	00 00 00 
+	stat->st_dev = dev;
+  80239f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8023a5:	83 ec 08             	sub    $0x8,%esp
+  8023a8:	53                   	push   %ebx
+  8023a9:	56                   	push   %esi
+  8023aa:	ff 50 14             	call   *0x14(%eax)
+  8023ad:	83 c4 10             	add    $0x10,%esp
+}
+  8023b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023b3:	5b                   	pop    %ebx
+  8023b4:	5e                   	pop    %esi
+  8023b5:	5d                   	pop    %ebp
+  8023b6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8023b7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023bc:	eb f2                	jmp    8023b0 <fstat+0x67>
+
+008023be <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8023be:	55                   	push   %ebp
+  8023bf:	89 e5                	mov    %esp,%ebp
+  8023c1:	56                   	push   %esi
+  8023c2:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  8023c3:	83 ec 08             	sub    $0x8,%esp
+  8023c6:	68 00 10 00 00       	push   $0x1000
+  8023cb:	ff 75 08             	push   0x8(%ebp)
+  8023ce:	e8 b3 07 00 00       	call   802b86 <open>
+  8023d3:	89 c3                	mov    %eax,%ebx
+  8023d5:	83 c4 10             	add    $0x10,%esp
+  8023d8:	85 c0                	test   %eax,%eax
+  8023da:	78 1b                	js     8023f7 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  8023dc:	83 ec 08             	sub    $0x8,%esp
+  8023df:	ff 75 0c             	push   0xc(%ebp)
+  8023e2:	50                   	push   %eax
+  8023e3:	e8 61 ff ff ff       	call   802349 <fstat>
+  8023e8:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8023ea:	89 1c 24             	mov    %ebx,(%esp)
+  8023ed:	e8 a2 fb ff ff       	call   801f94 <close>
+	return r;
+  8023f2:	83 c4 10             	add    $0x10,%esp
+  8023f5:	89 f3                	mov    %esi,%ebx
+}
+  8023f7:	89 d8                	mov    %ebx,%eax
+  8023f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023fc:	5b                   	pop    %ebx
+  8023fd:	5e                   	pop    %esi
+  8023fe:	5d                   	pop    %ebp
+  8023ff:	c3                   	ret
+
+00802400 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  802400:	55                   	push   %ebp
+  802401:	89 e5                	mov    %esp,%ebp
+  802403:	57                   	push   %edi
+  802404:	56                   	push   %esi
+  802405:	53                   	push   %ebx
+  802406:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  80240c:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  802412:	89 d6                	mov    %edx,%esi
+  802414:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  80241a:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  80241d:	89 d3                	mov    %edx,%ebx
+  80241f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  802425:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  80242c:	74 1d                	je     80244b <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80242e:	b8 00 70 80 00       	mov    $0x807000,%eax
+  802433:	83 c8 07             	or     $0x7,%eax
+  802436:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  80243c:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  802441:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  802447:	01 ce                	add    %ecx,%esi
+  802449:	eb 28                	jmp    802473 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80244b:	83 ec 0c             	sub    $0xc,%esp
+  80244e:	6a 01                	push   $0x1
+  802450:	e8 59 f9 ff ff       	call   801dae <ipc_find_env>
+  802455:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  80245a:	83 c4 10             	add    $0x10,%esp
+  80245d:	eb cf                	jmp    80242e <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  80245f:	83 c0 01             	add    $0x1,%eax
+  802462:	89 fa                	mov    %edi,%edx
+  802464:	09 da                	or     %ebx,%edx
+  802466:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  80246d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802473:	39 f3                	cmp    %esi,%ebx
+  802475:	72 e8                	jb     80245f <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  802477:	83 f8 41             	cmp    $0x41,%eax
+  80247a:	77 2f                	ja     8024ab <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  80247c:	50                   	push   %eax
+  80247d:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  802483:	50                   	push   %eax
+  802484:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  80248a:	ff 35 c8 80 80 00    	push   0x8080c8
+  802490:	e8 cb f8 ff ff       	call   801d60 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  802495:	83 c4 0c             	add    $0xc,%esp
+  802498:	6a 00                	push   $0x0
+  80249a:	6a 00                	push   $0x0
+  80249c:	6a 00                	push   $0x0
+  80249e:	e8 67 f7 ff ff       	call   801c0a <ipc_recv>
+}
+  8024a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024a6:	5b                   	pop    %ebx
+  8024a7:	5e                   	pop    %esi
+  8024a8:	5f                   	pop    %edi
+  8024a9:	5d                   	pop    %ebp
+  8024aa:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  8024ab:	68 7c 47 80 00       	push   $0x80477c
+  8024b0:	68 2c 42 80 00       	push   $0x80422c
+  8024b5:	6a 40                	push   $0x40
+  8024b7:	68 98 47 80 00       	push   $0x804798
+  8024bc:	e8 5e e5 ff ff       	call   800a1f <_panic>
+
+008024c1 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  8024c1:	55                   	push   %ebp
+  8024c2:	89 e5                	mov    %esp,%ebp
+  8024c4:	57                   	push   %edi
+  8024c5:	56                   	push   %esi
+  8024c6:	53                   	push   %ebx
+  8024c7:	83 ec 1c             	sub    $0x1c,%esp
+  8024ca:	89 c3                	mov    %eax,%ebx
+  8024cc:	89 d6                	mov    %edx,%esi
+  8024ce:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  8024d1:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  8024d7:	89 ca                	mov    %ecx,%edx
+  8024d9:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  8024dc:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  8024e3:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8024e6:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  8024ed:	8b 76 0c             	mov    0xc(%esi),%esi
+  8024f0:	89 fb                	mov    %edi,%ebx
+  8024f2:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  8024f9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8024fc:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  802503:	8b 75 08             	mov    0x8(%ebp),%esi
+  802506:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  80250d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802510:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  802517:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  80251a:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  802521:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  802526:	39 c8                	cmp    %ecx,%eax
+  802528:	74 0d                	je     802537 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  80252a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80252f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802532:	5b                   	pop    %ebx
+  802533:	5e                   	pop    %esi
+  802534:	5f                   	pop    %edi
+  802535:	5d                   	pop    %ebp
+  802536:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802537:	6a 07                	push   $0x7
+  802539:	68 00 70 80 00       	push   $0x807000
+  80253e:	6a 0d                	push   $0xd
+  802540:	ff 35 c8 80 80 00    	push   0x8080c8
+  802546:	e8 2a f7 ff ff       	call   801c75 <ipc_send>
+  80254b:	83 c4 10             	add    $0x10,%esp
+  80254e:	eb da                	jmp    80252a <fsring_post+0x69>
+
+00802550 <fsipcv>:
+{
+  802550:	55                   	push   %ebp
+  802551:	89 e5                	mov    %esp,%ebp
+  802553:	57                   	push   %edi
+  802554:	56                   	push   %esi
+  802555:	53                   	push   %ebx
+  802556:	83 ec 0c             	sub    $0xc,%esp
+  802559:	89 c7                	mov    %eax,%edi
+  80255b:	89 d3                	mov    %edx,%ebx
+  80255d:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  80255f:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  802566:	74 26                	je     80258e <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802568:	6a 07                	push   $0x7
+  80256a:	68 00 70 80 00       	push   $0x807000
+  80256f:	57                   	push   %edi
+  802570:	ff 35 c8 80 80 00    	push   0x8080c8
+  802576:	e8 fa f6 ff ff       	call   801c75 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  80257b:	6a 00                	push   $0x0
+  80257d:	56                   	push   %esi
+  80257e:	53                   	push   %ebx
+  80257f:	6a 00                	push   $0x0
+  802581:	e8 47 f7 ff ff       	call   801ccd <ipc_recvv>
+}
+  802586:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802589:	5b                   	pop    %ebx
+  80258a:	5e                   	pop    %esi
+  80258b:	5f                   	pop    %edi
+  80258c:	5d                   	pop    %ebp
+  80258d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80258e:	83 ec 0c             	sub    $0xc,%esp
+  802591:	6a 01                	push   $0x1
+  802593:	e8 16 f8 ff ff       	call   801dae <ipc_find_env>
+  802598:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  80259d:	83 c4 10             	add    $0x10,%esp
+  8025a0:	eb c6                	jmp    802568 <fsipcv+0x18>
+
+008025a2 <fsipc>:
+{
+  8025a2:	55                   	push   %ebp
+  8025a3:	89 e5                	mov    %esp,%ebp
+  8025a5:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  8025a8:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  8025af:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8025b2:	e8 99 ff ff ff       	call   802550 <fsipcv>
+}
+  8025b7:	c9                   	leave
+  8025b8:	c3                   	ret
+
+008025b9 <file_write_direct>:
+{
+  8025b9:	55                   	push   %ebp
+  8025ba:	89 e5                	mov    %esp,%ebp
+  8025bc:	56                   	push   %esi
+  8025bd:	53                   	push   %ebx
+  8025be:	89 c3                	mov    %eax,%ebx
+  8025c0:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8025c2:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  8025c8:	77 40                	ja     80260a <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8025ca:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  8025cf:	39 c8                	cmp    %ecx,%eax
+  8025d1:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025d4:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  8025d7:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  8025dd:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8025e2:	83 ec 04             	sub    $0x4,%esp
+  8025e5:	50                   	push   %eax
+  8025e6:	52                   	push   %edx
+  8025e7:	68 08 70 80 00       	push   $0x807008
+  8025ec:	e8 7d ec ff ff       	call   80126e <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8025f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8025fb:	e8 a2 ff ff ff       	call   8025a2 <fsipc>
+  802600:	83 c4 10             	add    $0x10,%esp
+}
+  802603:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802606:	5b                   	pop    %ebx
+  802607:	5e                   	pop    %esi
+  802608:	5d                   	pop    %ebp
+  802609:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80260a:	89 d6                	mov    %edx,%esi
+  80260c:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802612:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802617:	29 f1                	sub    %esi,%ecx
+  802619:	39 c1                	cmp    %eax,%ecx
+  80261b:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  80261e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802621:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  802626:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  80262c:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  802632:	83 ec 0c             	sub    $0xc,%esp
+  802635:	6a 05                	push   $0x5
+  802637:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80263c:	e8 bf fd ff ff       	call   802400 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  802641:	83 c4 10             	add    $0x10,%esp
+  802644:	eb bd                	jmp    802603 <file_write_direct+0x4a>
+
+00802646 <devfile_sync>:
+{
+  802646:	55                   	push   %ebp
+  802647:	89 e5                	mov    %esp,%ebp
+  802649:	57                   	push   %edi
+  80264a:	56                   	push   %esi
+  80264b:	53                   	push   %ebx
+  80264c:	83 ec 28             	sub    $0x28,%esp
+  80264f:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  802652:	56                   	push   %esi
+  802653:	e8 a5 f7 ff ff       	call   801dfd <fd2data>
+  802658:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  80265a:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  80265d:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  802664:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802667:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  80266c:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802670:	74 45                	je     8026b7 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  802672:	8b 46 14             	mov    0x14(%esi),%eax
+  802675:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  802678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80267d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802682:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  802685:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  802688:	39 cb                	cmp    %ecx,%ebx
+  80268a:	73 14                	jae    8026a0 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  80268c:	29 d9                	sub    %ebx,%ecx
+  80268e:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802691:	89 f0                	mov    %esi,%eax
+  802693:	e8 21 ff ff ff       	call   8025b9 <file_write_direct>
+  802698:	85 c0                	test   %eax,%eax
+  80269a:	7e 04                	jle    8026a0 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80269c:	01 c3                	add    %eax,%ebx
+  80269e:	eb e5                	jmp    802685 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  8026a0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8026a3:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  8026aa:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  8026ad:	85 c0                	test   %eax,%eax
+  8026af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b4:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8026b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026ba:	5b                   	pop    %ebx
+  8026bb:	5e                   	pop    %esi
+  8026bc:	5f                   	pop    %edi
+  8026bd:	5d                   	pop    %ebp
+  8026be:	c3                   	ret
+
+008026bf <devfile_write>:
+{
+  8026bf:	55                   	push   %ebp
+  8026c0:	89 e5                	mov    %esp,%ebp
+  8026c2:	57                   	push   %edi
+  8026c3:	56                   	push   %esi
+  8026c4:	53                   	push   %ebx
+  8026c5:	83 ec 28             	sub    $0x28,%esp
+  8026c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8026cb:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8026ce:	53                   	push   %ebx
+  8026cf:	e8 29 f7 ff ff       	call   801dfd <fd2data>
+  8026d4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8026d7:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8026da:	83 c4 10             	add    $0x10,%esp
+  8026dd:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8026e1:	74 43                	je     802726 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  8026e3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  8026ea:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8026ed:	85 c0                	test   %eax,%eax
+  8026ef:	74 43                	je     802734 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  8026f1:	89 c2                	mov    %eax,%edx
+  8026f3:	03 53 14             	add    0x14(%ebx),%edx
+  8026f6:	39 fa                	cmp    %edi,%edx
+  8026f8:	75 0b                	jne    802705 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  8026fa:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  8026fd:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  802703:	76 66                	jbe    80276b <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  802705:	83 ec 0c             	sub    $0xc,%esp
+  802708:	53                   	push   %ebx
+  802709:	e8 38 ff ff ff       	call   802646 <devfile_sync>
+  80270e:	83 c4 10             	add    $0x10,%esp
+  802711:	85 c0                	test   %eax,%eax
+  802713:	78 4e                	js     802763 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  802715:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80271b:	77 56                	ja     802773 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  80271d:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802720:	85 c0                	test   %eax,%eax
+  802722:	75 20                	jne    802744 <devfile_write+0x85>
+  802724:	eb 16                	jmp    80273c <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  802726:	89 f1                	mov    %esi,%ecx
+  802728:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80272b:	89 d8                	mov    %ebx,%eax
+  80272d:	e8 87 fe ff ff       	call   8025b9 <file_write_direct>
+  802732:	eb 2f                	jmp    802763 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  802734:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80273a:	77 37                	ja     802773 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  80273c:	89 7b 14             	mov    %edi,0x14(%ebx)
+  80273f:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  802744:	83 ec 04             	sub    $0x4,%esp
+  802747:	56                   	push   %esi
+  802748:	ff 75 0c             	push   0xc(%ebp)
+  80274b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80274e:	01 c1                	add    %eax,%ecx
+  802750:	51                   	push   %ecx
+  802751:	e8 18 eb ff ff       	call   80126e <memmove>
+	ff->buf_wlen += n;
+  802756:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  802759:	01 f7                	add    %esi,%edi
+  80275b:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80275e:	89 f0                	mov    %esi,%eax
+  802760:	83 c4 10             	add    $0x10,%esp
+}
+  802763:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802766:	5b                   	pop    %ebx
+  802767:	5e                   	pop    %esi
+  802768:	5f                   	pop    %edi
+  802769:	5d                   	pop    %ebp
+  80276a:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  80276b:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802771:	76 d1                	jbe    802744 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  802773:	89 f1                	mov    %esi,%ecx
+  802775:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802778:	89 d8                	mov    %ebx,%eax
+  80277a:	e8 3a fe ff ff       	call   8025b9 <file_write_direct>
+  80277f:	eb e2                	jmp    802763 <devfile_write+0xa4>
+
+00802781 <devfile_trunc>:
+{
+  802781:	55                   	push   %ebp
+  802782:	89 e5                	mov    %esp,%ebp
+  802784:	53                   	push   %ebx
+  802785:	83 ec 10             	sub    $0x10,%esp
+  802788:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  80278b:	53                   	push   %ebx
+  80278c:	e8 b5 fe ff ff       	call   802646 <devfile_sync>
+  802791:	83 c4 10             	add    $0x10,%esp
+  802794:	85 c0                	test   %eax,%eax
+  802796:	78 1f                	js     8027b7 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802798:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80279b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8027a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027a3:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8027a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ad:	b8 02 00 00 00       	mov    $0x2,%eax
+  8027b2:	e8 eb fd ff ff       	call   8025a2 <fsipc>
+}
+  8027b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027ba:	c9                   	leave
+  8027bb:	c3                   	ret
+
+008027bc <devfile_stat>:
+{
+  8027bc:	55                   	push   %ebp
+  8027bd:	89 e5                	mov    %esp,%ebp
+  8027bf:	56                   	push   %esi
+  8027c0:	53                   	push   %ebx
+  8027c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8027c4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  8027c7:	83 ec 0c             	sub    $0xc,%esp
+  8027ca:	53                   	push   %ebx
+  8027cb:	e8 76 fe ff ff       	call   802646 <devfile_sync>
+  8027d0:	83 c4 10             	add    $0x10,%esp
+  8027d3:	85 c0                	test   %eax,%eax
+  8027d5:	78 47                	js     80281e <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8027d7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8027da:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8027df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027e4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8027e9:	e8 b4 fd ff ff       	call   8025a2 <fsipc>
+  8027ee:	85 c0                	test   %eax,%eax
+  8027f0:	78 2c                	js     80281e <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8027f2:	83 ec 08             	sub    $0x8,%esp
+  8027f5:	68 00 70 80 00       	push   $0x807000
+  8027fa:	56                   	push   %esi
+  8027fb:	e8 e8 e8 ff ff       	call   8010e8 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802800:	a1 80 70 80 00       	mov    0x807080,%eax
+  802805:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80280b:	a1 84 70 80 00       	mov    0x807084,%eax
+  802810:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  802816:	83 c4 10             	add    $0x10,%esp
+  802819:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80281e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802821:	5b                   	pop    %ebx
+  802822:	5e                   	pop    %esi
+  802823:	5d                   	pop    %ebp
+  802824:	c3                   	ret
+
+00802825 <devfile_flush>:
+{
+  802825:	55                   	push   %ebp
+  802826:	89 e5                	mov    %esp,%ebp
+  802828:	56                   	push   %esi
+  802829:	53                   	push   %ebx
+  80282a:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  80282d:	83 ec 0c             	sub    $0xc,%esp
+  802830:	56                   	push   %esi
+  802831:	e8 10 fe ff ff       	call   802646 <devfile_sync>
+  802836:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  802838:	83 c4 10             	add    $0x10,%esp
+  80283b:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  80283f:	75 25                	jne    802866 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802841:	8b 46 0c             	mov    0xc(%esi),%eax
+  802844:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  802849:	ba 00 00 00 00       	mov    $0x0,%edx
+  80284e:	b8 06 00 00 00       	mov    $0x6,%eax
+  802853:	e8 4a fd ff ff       	call   8025a2 <fsipc>
+  802858:	85 c0                	test   %eax,%eax
+  80285a:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80285d:	89 d8                	mov    %ebx,%eax
+  80285f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802862:	5b                   	pop    %ebx
+  802863:	5e                   	pop    %esi
+  802864:	5d                   	pop    %ebp
+  802865:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  802866:	83 ec 0c             	sub    $0xc,%esp
+  802869:	56                   	push   %esi
+  80286a:	e8 8e f5 ff ff       	call   801dfd <fd2data>
+  80286f:	83 c4 08             	add    $0x8,%esp
+  802872:	50                   	push   %eax
+  802873:	6a 00                	push   $0x0
+  802875:	e8 07 ed ff ff       	call   801581 <sys_page_unmap>
+  80287a:	83 c4 10             	add    $0x10,%esp
+  80287d:	eb c2                	jmp    802841 <devfile_flush+0x1c>
+
+0080287f <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  80287f:	55                   	push   %ebp
+  802880:	89 e5                	mov    %esp,%ebp
+  802882:	57                   	push   %edi
+  802883:	56                   	push   %esi
+  802884:	53                   	push   %ebx
+  802885:	83 ec 64             	sub    $0x64,%esp
+  802888:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  80288a:	52                   	push   %edx
+  80288b:	50                   	push   %eax
+  80288c:	e8 d9 f5 ff ff       	call   801e6a <fd_lookup>
+  802891:	89 c1                	mov    %eax,%ecx
+  802893:	83 c4 10             	add    $0x10,%esp
+  802896:	85 c0                	test   %eax,%eax
+  802898:	0f 88 f2 00 00 00    	js     802990 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  80289e:	8b 07                	mov    (%edi),%eax
+  8028a0:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8028a6:	39 10                	cmp    %edx,(%eax)
+  8028a8:	0f 85 03 01 00 00    	jne    8029b1 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  8028ae:	a1 18 60 80 00       	mov    0x806018,%eax
+  8028b3:	8b 40 48             	mov    0x48(%eax),%eax
+  8028b6:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  8028bc:	0f 84 96 00 00 00    	je     802958 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  8028c2:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  8028c9:	0f 84 cb 00 00 00    	je     80299a <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8028cf:	b8 00 70 80 00       	mov    $0x807000,%eax
+  8028d4:	83 c8 07             	or     $0x7,%eax
+  8028d7:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8028da:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8028dd:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  8028e2:	83 ec 04             	sub    $0x4,%esp
+  8028e5:	68 07 04 00 00       	push   $0x407
+  8028ea:	53                   	push   %ebx
+  8028eb:	6a 00                	push   $0x0
+  8028ed:	e8 02 ec ff ff       	call   8014f4 <sys_page_alloc>
+  8028f2:	89 c1                	mov    %eax,%ecx
+  8028f4:	83 c4 10             	add    $0x10,%esp
+  8028f7:	85 c0                	test   %eax,%eax
+  8028f9:	0f 88 91 00 00 00    	js     802990 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  8028ff:	89 d8                	mov    %ebx,%eax
+  802901:	83 c8 07             	or     $0x7,%eax
+  802904:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  802906:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80290c:	83 c6 04             	add    $0x4,%esi
+  80290f:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  802915:	75 cb                	jne    8028e2 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  802917:	6a 12                	push   $0x12
+  802919:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80291c:	50                   	push   %eax
+  80291d:	6a 0c                	push   $0xc
+  80291f:	ff 35 c8 80 80 00    	push   0x8080c8
+  802925:	e8 36 f4 ff ff       	call   801d60 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80292a:	83 c4 0c             	add    $0xc,%esp
+  80292d:	6a 00                	push   $0x0
+  80292f:	6a 00                	push   $0x0
+  802931:	6a 00                	push   $0x0
+  802933:	e8 d2 f2 ff ff       	call   801c0a <ipc_recv>
+  802938:	89 c1                	mov    %eax,%ecx
+  80293a:	83 c4 10             	add    $0x10,%esp
+  80293d:	85 c0                	test   %eax,%eax
+  80293f:	78 4f                	js     802990 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  802941:	a1 18 60 80 00       	mov    0x806018,%eax
+  802946:	8b 40 48             	mov    0x48(%eax),%eax
+  802949:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  80294e:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  802955:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  802958:	83 ec 0c             	sub    $0xc,%esp
+  80295b:	ff 37                	push   (%edi)
+  80295d:	e8 e4 fc ff ff       	call   802646 <devfile_sync>
+  802962:	89 c1                	mov    %eax,%ecx
+  802964:	83 c4 10             	add    $0x10,%esp
+  802967:	85 c0                	test   %eax,%eax
+  802969:	78 25                	js     802990 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  80296b:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802971:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  802976:	ba 01 00 00 00       	mov    $0x1,%edx
+  80297b:	89 d0                	mov    %edx,%eax
+  80297d:	d3 e0                	shl    %cl,%eax
+  80297f:	85 d8                	test   %ebx,%eax
+  802981:	74 0d                	je     802990 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802983:	83 c1 01             	add    $0x1,%ecx
+  802986:	83 f9 10             	cmp    $0x10,%ecx
+  802989:	75 f0                	jne    80297b <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  80298b:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  802990:	89 c8                	mov    %ecx,%eax
+  802992:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802995:	5b                   	pop    %ebx
+  802996:	5e                   	pop    %esi
+  802997:	5f                   	pop    %edi
+  802998:	5d                   	pop    %ebp
+  802999:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80299a:	83 ec 0c             	sub    $0xc,%esp
+  80299d:	6a 01                	push   $0x1
+  80299f:	e8 0a f4 ff ff       	call   801dae <ipc_find_env>
+  8029a4:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  8029a9:	83 c4 10             	add    $0x10,%esp
+  8029ac:	e9 1e ff ff ff       	jmp    8028cf <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  8029b1:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  8029b6:	eb d8                	jmp    802990 <fsring_slot+0x111>
+
+008029b8 <file_read_direct>:
+{
+  8029b8:	55                   	push   %ebp
+  8029b9:	89 e5                	mov    %esp,%ebp
+  8029bb:	57                   	push   %edi
+  8029bc:	56                   	push   %esi
+  8029bd:	53                   	push   %ebx
+  8029be:	83 ec 1c             	sub    $0x1c,%esp
+  8029c1:	89 c7                	mov    %eax,%edi
+  8029c3:	89 d6                	mov    %edx,%esi
+  8029c5:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  8029c7:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  8029cd:	77 52                	ja     802a21 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8029cf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8029d2:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8029d7:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8029dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029e2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8029e7:	e8 b6 fb ff ff       	call   8025a2 <fsipc>
+  8029ec:	89 c7                	mov    %eax,%edi
+  8029ee:	85 c0                	test   %eax,%eax
+  8029f0:	78 25                	js     802a17 <file_read_direct+0x5f>
+	assert(r <= n);
+  8029f2:	39 c3                	cmp    %eax,%ebx
+  8029f4:	0f 82 87 00 00 00    	jb     802a81 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  8029fa:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8029ff:	0f 8f 95 00 00 00    	jg     802a9a <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802a05:	83 ec 04             	sub    $0x4,%esp
+  802a08:	50                   	push   %eax
+  802a09:	68 00 70 80 00       	push   $0x807000
+  802a0e:	56                   	push   %esi
+  802a0f:	e8 5a e8 ff ff       	call   80126e <memmove>
+	return r;
+  802a14:	83 c4 10             	add    $0x10,%esp
+}
+  802a17:	89 f8                	mov    %edi,%eax
+  802a19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a1c:	5b                   	pop    %ebx
+  802a1d:	5e                   	pop    %esi
+  802a1e:	5f                   	pop    %edi
+  802a1f:	5d                   	pop    %ebp
+  802a20:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802a21:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802a27:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802a2c:	29 d1                	sub    %edx,%ecx
+  802a2e:	39 d9                	cmp    %ebx,%ecx
+  802a30:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802a33:	89 f0                	mov    %esi,%eax
+  802a35:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  802a38:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802a3b:	eb 0f                	jmp    802a4c <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  802a3d:	0f b6 10             	movzbl (%eax),%edx
+  802a40:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802a42:	05 00 10 00 00       	add    $0x1000,%eax
+  802a47:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802a4c:	39 c8                	cmp    %ecx,%eax
+  802a4e:	72 ed                	jb     802a3d <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802a50:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a53:	8b 47 0c             	mov    0xc(%edi),%eax
+  802a56:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  802a5b:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802a61:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  802a67:	83 ec 0c             	sub    $0xc,%esp
+  802a6a:	6a 07                	push   $0x7
+  802a6c:	89 d9                	mov    %ebx,%ecx
+  802a6e:	89 f2                	mov    %esi,%edx
+  802a70:	b8 09 00 00 00       	mov    $0x9,%eax
+  802a75:	e8 86 f9 ff ff       	call   802400 <fsipc_pages>
+  802a7a:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  802a7c:	83 c4 10             	add    $0x10,%esp
+  802a7f:	eb 96                	jmp    802a17 <file_read_direct+0x5f>
+	assert(r <= n);
+  802a81:	68 a3 47 80 00       	push   $0x8047a3
+  802a86:	68 2c 42 80 00       	push   $0x80422c
+  802a8b:	68 dc 00 00 00       	push   $0xdc
+  802a90:	68 98 47 80 00       	push   $0x804798
+  802a95:	e8 85 df ff ff       	call   800a1f <_panic>
+	assert(r <= PGSIZE);
+  802a9a:	68 b4 47 80 00       	push   $0x8047b4
+  802a9f:	68 2c 42 80 00       	push   $0x80422c
+  802aa4:	68 dd 00 00 00       	push   $0xdd
+  802aa9:	68 98 47 80 00       	push   $0x804798
+  802aae:	e8 6c df ff ff       	call   800a1f <_panic>
+
+00802ab3 <devfile_read>:
+{
+  802ab3:	55                   	push   %ebp
+  802ab4:	89 e5                	mov    %esp,%ebp
+  802ab6:	57                   	push   %edi
+  802ab7:	56                   	push   %esi
+  802ab8:	53                   	push   %ebx
+  802ab9:	83 ec 28             	sub    $0x28,%esp
+  802abc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802abf:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  802ac2:	53                   	push   %ebx
+  802ac3:	e8 35 f3 ff ff       	call   801dfd <fd2data>
+  802ac8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  802acb:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  802ace:	83 c4 10             	add    $0x10,%esp
+  802ad1:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  802ad5:	74 7d                	je     802b54 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802ad7:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802adb:	0f 85 81 00 00 00    	jne    802b62 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  802ae1:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ae4:	85 c0                	test   %eax,%eax
+  802ae6:	74 0d                	je     802af5 <devfile_read+0x42>
+  802ae8:	8b 53 14             	mov    0x14(%ebx),%edx
+  802aeb:	39 fa                	cmp    %edi,%edx
+  802aed:	7f 06                	jg     802af5 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  802aef:	01 c2                	add    %eax,%edx
+  802af1:	39 d7                	cmp    %edx,%edi
+  802af3:	72 28                	jb     802b1d <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  802af5:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  802afc:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802b02:	77 74                	ja     802b78 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  802b04:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b09:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802b0c:	89 d8                	mov    %ebx,%eax
+  802b0e:	e8 a5 fe ff ff       	call   8029b8 <file_read_direct>
+  802b13:	85 c0                	test   %eax,%eax
+  802b15:	7e 35                	jle    802b4c <devfile_read+0x99>
+		ff->buf_base = pos;
+  802b17:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  802b1a:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  802b1d:	8b 53 14             	mov    0x14(%ebx),%edx
+  802b20:	89 d0                	mov    %edx,%eax
+  802b22:	03 43 18             	add    0x18(%ebx),%eax
+  802b25:	29 f8                	sub    %edi,%eax
+  802b27:	39 f0                	cmp    %esi,%eax
+  802b29:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  802b2c:	83 ec 04             	sub    $0x4,%esp
+  802b2f:	56                   	push   %esi
+  802b30:	89 f8                	mov    %edi,%eax
+  802b32:	29 d0                	sub    %edx,%eax
+  802b34:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802b37:	01 c1                	add    %eax,%ecx
+  802b39:	51                   	push   %ecx
+  802b3a:	ff 75 0c             	push   0xc(%ebp)
+  802b3d:	e8 2c e7 ff ff       	call   80126e <memmove>
+	fd->fd_offset = pos + n;
+  802b42:	01 f7                	add    %esi,%edi
+  802b44:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802b47:	89 f0                	mov    %esi,%eax
+  802b49:	83 c4 10             	add    $0x10,%esp
+}
+  802b4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b4f:	5b                   	pop    %ebx
+  802b50:	5e                   	pop    %esi
+  802b51:	5f                   	pop    %edi
+  802b52:	5d                   	pop    %ebp
+  802b53:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802b54:	89 f1                	mov    %esi,%ecx
+  802b56:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b59:	89 d8                	mov    %ebx,%eax
+  802b5b:	e8 58 fe ff ff       	call   8029b8 <file_read_direct>
+  802b60:	eb ea                	jmp    802b4c <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802b62:	83 ec 0c             	sub    $0xc,%esp
+  802b65:	53                   	push   %ebx
+  802b66:	e8 db fa ff ff       	call   802646 <devfile_sync>
+  802b6b:	83 c4 10             	add    $0x10,%esp
+  802b6e:	85 c0                	test   %eax,%eax
+  802b70:	0f 89 6b ff ff ff    	jns    802ae1 <devfile_read+0x2e>
+  802b76:	eb d4                	jmp    802b4c <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  802b78:	89 f1                	mov    %esi,%ecx
+  802b7a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b7d:	89 d8                	mov    %ebx,%eax
+  802b7f:	e8 34 fe ff ff       	call   8029b8 <file_read_direct>
+  802b84:	eb c6                	jmp    802b4c <devfile_read+0x99>
+
+00802b86 <open>:
+{
+  802b86:	55                   	push   %ebp
+  802b87:	89 e5                	mov    %esp,%ebp
+  802b89:	56                   	push   %esi
+  802b8a:	53                   	push   %ebx
+  802b8b:	83 ec 1c             	sub    $0x1c,%esp
+  802b8e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802b91:	56                   	push   %esi
+  802b92:	e8 16 e5 ff ff       	call   8010ad <strlen>
+  802b97:	83 c4 10             	add    $0x10,%esp
+  802b9a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802b9f:	0f 8f a0 00 00 00    	jg     802c45 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  802ba5:	83 ec 0c             	sub    $0xc,%esp
+  802ba8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bab:	50                   	push   %eax
+  802bac:	e8 63 f2 ff ff       	call   801e14 <fd_alloc>
+  802bb1:	89 c3                	mov    %eax,%ebx
+  802bb3:	83 c4 10             	add    $0x10,%esp
+  802bb6:	85 c0                	test   %eax,%eax
+  802bb8:	78 45                	js     802bff <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  802bba:	83 ec 08             	sub    $0x8,%esp
+  802bbd:	56                   	push   %esi
+  802bbe:	68 00 70 80 00       	push   $0x807000
+  802bc3:	e8 20 e5 ff ff       	call   8010e8 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802bc8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bcb:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802bd0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802bd3:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bd8:	e8 c5 f9 ff ff       	call   8025a2 <fsipc>
+  802bdd:	89 c3                	mov    %eax,%ebx
+  802bdf:	83 c4 10             	add    $0x10,%esp
+  802be2:	85 c0                	test   %eax,%eax
+  802be4:	78 22                	js     802c08 <open+0x82>
+	if (!(mode & O_NOBUF)
+  802be6:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  802bed:	74 2b                	je     802c1a <open+0x94>
+	return fd2num(fd);
+  802bef:	83 ec 0c             	sub    $0xc,%esp
+  802bf2:	ff 75 f4             	push   -0xc(%ebp)
+  802bf5:	e8 f3 f1 ff ff       	call   801ded <fd2num>
+  802bfa:	89 c3                	mov    %eax,%ebx
+  802bfc:	83 c4 10             	add    $0x10,%esp
+}
+  802bff:	89 d8                	mov    %ebx,%eax
+  802c01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c04:	5b                   	pop    %ebx
+  802c05:	5e                   	pop    %esi
+  802c06:	5d                   	pop    %ebp
+  802c07:	c3                   	ret
+		fd_close(fd, 0);
+  802c08:	83 ec 08             	sub    $0x8,%esp
+  802c0b:	6a 00                	push   $0x0
+  802c0d:	ff 75 f4             	push   -0xc(%ebp)
+  802c10:	e8 f8 f2 ff ff       	call   801f0d <fd_close>
+		return r;
+  802c15:	83 c4 10             	add    $0x10,%esp
+  802c18:	eb e5                	jmp    802bff <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  802c1a:	83 ec 0c             	sub    $0xc,%esp
+  802c1d:	ff 75 f4             	push   -0xc(%ebp)
+  802c20:	e8 d8 f1 ff ff       	call   801dfd <fd2data>
+  802c25:	83 c4 0c             	add    $0xc,%esp
+  802c28:	68 07 04 00 00       	push   $0x407
+  802c2d:	50                   	push   %eax
+  802c2e:	6a 00                	push   $0x0
+  802c30:	e8 bf e8 ff ff       	call   8014f4 <sys_page_alloc>
+  802c35:	83 c4 10             	add    $0x10,%esp
+  802c38:	85 c0                	test   %eax,%eax
+  802c3a:	75 b3                	jne    802bef <open+0x69>
+		fd->fd_file.buffered = 1;
+  802c3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c3f:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802c43:	eb aa                	jmp    802bef <open+0x69>
+		return -E_BAD_PATH;
+  802c45:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802c4a:	eb b3                	jmp    802bff <open+0x79>
+
+00802c4c <readdir>:
+{
+  802c4c:	55                   	push   %ebp
+  802c4d:	89 e5                	mov    %esp,%ebp
+  802c4f:	53                   	push   %ebx
+  802c50:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c53:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c56:	50                   	push   %eax
+  802c57:	ff 75 08             	push   0x8(%ebp)
+  802c5a:	e8 0b f2 ff ff       	call   801e6a <fd_lookup>
+  802c5f:	89 c3                	mov    %eax,%ebx
+  802c61:	83 c4 10             	add    $0x10,%esp
+  802c64:	85 c0                	test   %eax,%eax
+  802c66:	78 73                	js     802cdb <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802c68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c6b:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802c71:	39 08                	cmp    %ecx,(%eax)
+  802c73:	0f 85 82 00 00 00    	jne    802cfb <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802c79:	83 ec 0c             	sub    $0xc,%esp
+  802c7c:	50                   	push   %eax
+  802c7d:	e8 c4 f9 ff ff       	call   802646 <devfile_sync>
+  802c82:	89 c3                	mov    %eax,%ebx
+  802c84:	83 c4 10             	add    $0x10,%esp
+  802c87:	85 c0                	test   %eax,%eax
+  802c89:	78 50                	js     802cdb <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802c8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c8e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802c91:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  802c96:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c99:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  802c9e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ca1:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  802ca6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cab:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802cb0:	e8 ed f8 ff ff       	call   8025a2 <fsipc>
+  802cb5:	89 c3                	mov    %eax,%ebx
+  802cb7:	85 c0                	test   %eax,%eax
+  802cb9:	7e 20                	jle    802cdb <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  802cbb:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802cbe:	72 22                	jb     802ce2 <readdir+0x96>
+  802cc0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802cc5:	7f 1b                	jg     802ce2 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802cc7:	83 ec 04             	sub    $0x4,%esp
+  802cca:	50                   	push   %eax
+  802ccb:	68 00 70 80 00       	push   $0x807000
+  802cd0:	ff 75 0c             	push   0xc(%ebp)
+  802cd3:	e8 96 e5 ff ff       	call   80126e <memmove>
+	return r;
+  802cd8:	83 c4 10             	add    $0x10,%esp
+}
+  802cdb:	89 d8                	mov    %ebx,%eax
+  802cdd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ce0:	c9                   	leave
+  802ce1:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  802ce2:	68 aa 47 80 00       	push   $0x8047aa
+  802ce7:	68 2c 42 80 00       	push   $0x80422c
+  802cec:	68 86 01 00 00       	push   $0x186
+  802cf1:	68 98 47 80 00       	push   $0x804798
+  802cf6:	e8 24 dd ff ff       	call   800a1f <_panic>
+		return -E_NOT_SUPP;
+  802cfb:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802d00:	eb d9                	jmp    802cdb <readdir+0x8f>
+
+00802d02 <munmap>:
+{
+  802d02:	55                   	push   %ebp
+  802d03:	89 e5                	mov    %esp,%ebp
+  802d05:	56                   	push   %esi
+  802d06:	53                   	push   %ebx
+  802d07:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802d0d:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  802d13:	75 41                	jne    802d56 <munmap+0x54>
+  802d15:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  802d1b:	77 39                	ja     802d56 <munmap+0x54>
+  802d1d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802d22:	29 f0                	sub    %esi,%eax
+  802d24:	39 d0                	cmp    %edx,%eax
+  802d26:	72 35                	jb     802d5d <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802d28:	89 f3                	mov    %esi,%ebx
+  802d2a:	01 d6                	add    %edx,%esi
+  802d2c:	39 f3                	cmp    %esi,%ebx
+  802d2e:	73 1a                	jae    802d4a <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802d30:	83 ec 08             	sub    $0x8,%esp
+  802d33:	53                   	push   %ebx
+  802d34:	6a 00                	push   $0x0
+  802d36:	e8 46 e8 ff ff       	call   801581 <sys_page_unmap>
+  802d3b:	83 c4 10             	add    $0x10,%esp
+  802d3e:	85 c0                	test   %eax,%eax
+  802d40:	78 0d                	js     802d4f <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802d42:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802d48:	eb e2                	jmp    802d2c <munmap+0x2a>
+	return 0;
+  802d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d52:	5b                   	pop    %ebx
+  802d53:	5e                   	pop    %esi
+  802d54:	5d                   	pop    %ebp
+  802d55:	c3                   	ret
+		return -E_INVAL;
+  802d56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d5b:	eb f2                	jmp    802d4f <munmap+0x4d>
+  802d5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d62:	eb eb                	jmp    802d4f <munmap+0x4d>
+
+00802d64 <mmap>:
+{
+  802d64:	55                   	push   %ebp
+  802d65:	89 e5                	mov    %esp,%ebp
+  802d67:	57                   	push   %edi
+  802d68:	56                   	push   %esi
+  802d69:	53                   	push   %ebx
+  802d6a:	83 ec 34             	sub    $0x34,%esp
+  802d6d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d70:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802d73:	50                   	push   %eax
+  802d74:	ff 75 18             	push   0x18(%ebp)
+  802d77:	e8 ee f0 ff ff       	call   801e6a <fd_lookup>
+  802d7c:	89 c3                	mov    %eax,%ebx
+  802d7e:	83 c4 10             	add    $0x10,%esp
+  802d81:	85 c0                	test   %eax,%eax
+  802d83:	0f 88 0e 01 00 00    	js     802e97 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802d89:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802d8c:	a1 20 50 80 00       	mov    0x805020,%eax
+  802d91:	39 02                	cmp    %eax,(%edx)
+  802d93:	0f 85 50 01 00 00    	jne    802ee9 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802d99:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d9c:	83 e0 02             	and    $0x2,%eax
+  802d9f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802da2:	74 0a                	je     802dae <mmap+0x4a>
+  802da4:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802da8:	0f 84 42 01 00 00    	je     802ef0 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802dae:	8b 42 08             	mov    0x8(%edx),%eax
+  802db1:	83 e0 03             	and    $0x3,%eax
+  802db4:	83 f8 01             	cmp    $0x1,%eax
+  802db7:	0f 84 3a 01 00 00    	je     802ef7 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802dbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc0:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802dc3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802dc8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802dcb:	0f 85 2d 01 00 00    	jne    802efe <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802dd1:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802dd5:	0f 88 2a 01 00 00    	js     802f05 <mmap+0x1a1>
+  802ddb:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  802de2:	0f 87 1d 01 00 00    	ja     802f05 <mmap+0x1a1>
+  802de8:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802ded:	2b 45 08             	sub    0x8(%ebp),%eax
+  802df0:	39 f8                	cmp    %edi,%eax
+  802df2:	0f 82 14 01 00 00    	jb     802f0c <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802df8:	83 ec 0c             	sub    $0xc,%esp
+  802dfb:	52                   	push   %edx
+  802dfc:	e8 45 f8 ff ff       	call   802646 <devfile_sync>
+  802e01:	89 c3                	mov    %eax,%ebx
+  802e03:	83 c4 10             	add    $0x10,%esp
+  802e06:	85 c0                	test   %eax,%eax
+  802e08:	0f 88 89 00 00 00    	js     802e97 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802e0e:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802e14:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802e1a:	be 00 00 00 00       	mov    $0x0,%esi
+  802e1f:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802e22:	39 fe                	cmp    %edi,%esi
+  802e24:	73 7b                	jae    802ea1 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  802e26:	89 f8                	mov    %edi,%eax
+  802e28:	29 f0                	sub    %esi,%eax
+  802e2a:	c1 e8 0c             	shr    $0xc,%eax
+  802e2d:	ba 40 00 00 00       	mov    $0x40,%edx
+  802e32:	39 d0                	cmp    %edx,%eax
+  802e34:	0f 47 c2             	cmova  %edx,%eax
+  802e37:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802e3a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e3d:	8b 52 0c             	mov    0xc(%edx),%edx
+  802e40:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  802e46:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802e49:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  802e4f:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802e54:	89 f2                	mov    %esi,%edx
+  802e56:	03 55 08             	add    0x8(%ebp),%edx
+  802e59:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802e5c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802e61:	e8 ea f6 ff ff       	call   802550 <fsipcv>
+  802e66:	85 c0                	test   %eax,%eax
+  802e68:	7e 12                	jle    802e7c <mmap+0x118>
+  802e6a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e6d:	85 c0                	test   %eax,%eax
+  802e6f:	0f 84 9e 00 00 00    	je     802f13 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802e75:	c1 e0 0c             	shl    $0xc,%eax
+  802e78:	01 c6                	add    %eax,%esi
+  802e7a:	eb a6                	jmp    802e22 <mmap+0xbe>
+			munmap(addr, done);
+  802e7c:	89 c3                	mov    %eax,%ebx
+  802e7e:	83 ec 08             	sub    $0x8,%esp
+  802e81:	56                   	push   %esi
+  802e82:	ff 75 08             	push   0x8(%ebp)
+  802e85:	e8 78 fe ff ff       	call   802d02 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802e8a:	83 c4 10             	add    $0x10,%esp
+  802e8d:	85 db                	test   %ebx,%ebx
+  802e8f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e94:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802e97:	89 d8                	mov    %ebx,%eax
+  802e99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e9c:	5b                   	pop    %ebx
+  802e9d:	5e                   	pop    %esi
+  802e9e:	5f                   	pop    %edi
+  802e9f:	5d                   	pop    %ebp
+  802ea0:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802ea1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802ea4:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802ea6:	85 c0                	test   %eax,%eax
+  802ea8:	74 ed                	je     802e97 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802eaa:	be 00 00 00 00       	mov    $0x0,%esi
+  802eaf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802eb2:	39 fe                	cmp    %edi,%esi
+  802eb4:	73 2e                	jae    802ee4 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802eb6:	83 ec 0c             	sub    $0xc,%esp
+  802eb9:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802ebc:	50                   	push   %eax
+  802ebd:	e8 4a eb ff ff       	call   801a0c <cowpage>
+  802ec2:	83 c4 10             	add    $0x10,%esp
+  802ec5:	85 c0                	test   %eax,%eax
+  802ec7:	78 08                	js     802ed1 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802ec9:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802ecf:	eb e1                	jmp    802eb2 <mmap+0x14e>
+				munmap(addr, len);
+  802ed1:	89 c3                	mov    %eax,%ebx
+  802ed3:	83 ec 08             	sub    $0x8,%esp
+  802ed6:	57                   	push   %edi
+  802ed7:	ff 75 08             	push   0x8(%ebp)
+  802eda:	e8 23 fe ff ff       	call   802d02 <munmap>
+				return r;
+  802edf:	83 c4 10             	add    $0x10,%esp
+  802ee2:	eb b3                	jmp    802e97 <mmap+0x133>
+	return 0;
+  802ee4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802ee7:	eb ae                	jmp    802e97 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802ee9:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802eee:	eb a7                	jmp    802e97 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802ef0:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802ef5:	eb a0                	jmp    802e97 <mmap+0x133>
+		return -E_INVAL;
+  802ef7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802efc:	eb 99                	jmp    802e97 <mmap+0x133>
+  802efe:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802f03:	eb 92                	jmp    802e97 <mmap+0x133>
+  802f05:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802f0a:	eb 8b                	jmp    802e97 <mmap+0x133>
+  802f0c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802f11:	eb 84                	jmp    802e97 <mmap+0x133>
+			munmap(addr, done);
+  802f13:	83 ec 08             	sub    $0x8,%esp
+  802f16:	56                   	push   %esi
+  802f17:	ff 75 08             	push   0x8(%ebp)
+  802f1a:	e8 e3 fd ff ff       	call   802d02 <munmap>
+  802f1f:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802f22:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802f27:	e9 6b ff ff ff       	jmp    802e97 <mmap+0x133>
+
+00802f2c <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802f2c:	55                   	push   %ebp
+  802f2d:	89 e5                	mov    %esp,%ebp
+  802f2f:	56                   	push   %esi
+  802f30:	53                   	push   %ebx
+  802f31:	83 ec 10             	sub    $0x10,%esp
+  802f34:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802f37:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802f3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f3d:	e8 3d f9 ff ff       	call   80287f <fsring_slot>
+  802f42:	85 c0                	test   %eax,%eax
+  802f44:	78 60                	js     802fa6 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802f46:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802f49:	8b 56 08             	mov    0x8(%esi),%edx
+  802f4c:	83 e2 03             	and    $0x3,%edx
+  802f4f:	83 fa 01             	cmp    $0x1,%edx
+  802f52:	74 59                	je     802fad <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802f54:	ba 01 00 00 00       	mov    $0x1,%edx
+  802f59:	89 c1                	mov    %eax,%ecx
+  802f5b:	d3 e2                	shl    %cl,%edx
+  802f5d:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802f63:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802f66:	c1 e2 02             	shl    $0x2,%edx
+  802f69:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  802f6f:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  802f76:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802f79:	8b 55 18             	mov    0x18(%ebp),%edx
+  802f7c:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802f7f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802f82:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802f85:	83 ec 08             	sub    $0x8,%esp
+  802f88:	50                   	push   %eax
+  802f89:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802f8e:	39 c3                	cmp    %eax,%ebx
+  802f90:	0f 47 d8             	cmova  %eax,%ebx
+  802f93:	53                   	push   %ebx
+  802f94:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802f97:	89 f2                	mov    %esi,%edx
+  802f99:	b8 03 00 00 00       	mov    $0x3,%eax
+  802f9e:	e8 1e f5 ff ff       	call   8024c1 <fsring_post>
+  802fa3:	83 c4 10             	add    $0x10,%esp
+}
+  802fa6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fa9:	5b                   	pop    %ebx
+  802faa:	5e                   	pop    %esi
+  802fab:	5d                   	pop    %ebp
+  802fac:	c3                   	ret
+		return -E_INVAL;
+  802fad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fb2:	eb f2                	jmp    802fa6 <fsring_read+0x7a>
+
+00802fb4 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802fb4:	55                   	push   %ebp
+  802fb5:	89 e5                	mov    %esp,%ebp
+  802fb7:	56                   	push   %esi
+  802fb8:	53                   	push   %ebx
+  802fb9:	83 ec 10             	sub    $0x10,%esp
+  802fbc:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802fbf:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802fc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fc5:	e8 b5 f8 ff ff       	call   80287f <fsring_slot>
+  802fca:	89 c3                	mov    %eax,%ebx
+  802fcc:	85 c0                	test   %eax,%eax
+  802fce:	78 77                	js     803047 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802fd0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fd3:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802fd7:	74 77                	je     803050 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802fd9:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802fde:	39 c6                	cmp    %eax,%esi
+  802fe0:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802fe3:	83 ec 04             	sub    $0x4,%esp
+  802fe6:	56                   	push   %esi
+  802fe7:	ff 75 0c             	push   0xc(%ebp)
+  802fea:	89 d8                	mov    %ebx,%eax
+  802fec:	c1 e0 0c             	shl    $0xc,%eax
+  802fef:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802ff5:	50                   	push   %eax
+  802ff6:	e8 73 e2 ff ff       	call   80126e <memmove>
+	fsring_busy |= 1 << slot;
+  802ffb:	b8 01 00 00 00       	mov    $0x1,%eax
+  803000:	89 d9                	mov    %ebx,%ecx
+  803002:	d3 e0                	shl    %cl,%eax
+  803004:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  80300a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80300d:	c1 e0 02             	shl    $0x2,%eax
+  803010:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  803016:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  80301d:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  803020:	8b 45 18             	mov    0x18(%ebp),%eax
+  803023:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  803026:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  80302d:	83 c4 08             	add    $0x8,%esp
+  803030:	53                   	push   %ebx
+  803031:	56                   	push   %esi
+  803032:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  803035:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803038:	b8 04 00 00 00       	mov    $0x4,%eax
+  80303d:	e8 7f f4 ff ff       	call   8024c1 <fsring_post>
+  803042:	89 c3                	mov    %eax,%ebx
+  803044:	83 c4 10             	add    $0x10,%esp
+}
+  803047:	89 d8                	mov    %ebx,%eax
+  803049:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80304c:	5b                   	pop    %ebx
+  80304d:	5e                   	pop    %esi
+  80304e:	5d                   	pop    %ebp
+  80304f:	c3                   	ret
+		return -E_INVAL;
+  803050:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  803055:	eb f0                	jmp    803047 <fsring_write+0x93>
+
+00803057 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  803057:	55                   	push   %ebp
+  803058:	89 e5                	mov    %esp,%ebp
+  80305a:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80305d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803060:	8b 45 08             	mov    0x8(%ebp),%eax
+  803063:	e8 17 f8 ff ff       	call   80287f <fsring_slot>
+  803068:	85 c0                	test   %eax,%eax
+  80306a:	78 4c                	js     8030b8 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  80306c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803071:	89 c1                	mov    %eax,%ecx
+  803073:	d3 e2                	shl    %cl,%edx
+  803075:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  80307b:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80307e:	c1 e2 02             	shl    $0x2,%edx
+  803081:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  803087:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  80308e:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  803091:	8b 55 10             	mov    0x10(%ebp),%edx
+  803094:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  803097:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80309a:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80309d:	83 ec 08             	sub    $0x8,%esp
+  8030a0:	50                   	push   %eax
+  8030a1:	6a 00                	push   $0x0
+  8030a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030a8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030ab:	b8 05 00 00 00       	mov    $0x5,%eax
+  8030b0:	e8 0c f4 ff ff       	call   8024c1 <fsring_post>
+  8030b5:	83 c4 10             	add    $0x10,%esp
+}
+  8030b8:	c9                   	leave
+  8030b9:	c3                   	ret
+
+008030ba <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8030ba:	55                   	push   %ebp
+  8030bb:	89 e5                	mov    %esp,%ebp
+  8030bd:	57                   	push   %edi
+  8030be:	56                   	push   %esi
+  8030bf:	53                   	push   %ebx
+  8030c0:	83 ec 1c             	sub    $0x1c,%esp
+  8030c3:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8030c7:	a1 18 60 80 00       	mov    0x806018,%eax
+  8030cc:	8b 40 48             	mov    0x48(%eax),%eax
+  8030cf:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  8030d5:	74 12                	je     8030e9 <fsring_reap+0x2f>
+		return 0;
+  8030d7:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8030dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030df:	5b                   	pop    %ebx
+  8030e0:	5e                   	pop    %esi
+  8030e1:	5f                   	pop    %edi
+  8030e2:	5d                   	pop    %ebp
+  8030e3:	c3                   	ret
+		sys_yield();
+  8030e4:	e8 ec e3 ff ff       	call   8014d5 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8030e9:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8030ef:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8030f4:	39 c2                	cmp    %eax,%edx
+  8030f6:	75 18                	jne    803110 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8030f8:	84 db                	test   %bl,%bl
+  8030fa:	0f 84 21 01 00 00    	je     803221 <fsring_reap+0x167>
+  803100:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  803107:	75 db                	jne    8030e4 <fsring_reap+0x2a>
+			return 0;
+  803109:	b8 00 00 00 00       	mov    $0x0,%eax
+  80310e:	eb cc                	jmp    8030dc <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  803110:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  803115:	83 e0 0f             	and    $0xf,%eax
+  803118:	83 c0 2a             	add    $0x2a,%eax
+  80311b:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  803122:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  803129:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80312e:	83 c0 01             	add    $0x1,%eax
+  803131:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  803136:	83 fb 0f             	cmp    $0xf,%ebx
+  803139:	77 5b                	ja     803196 <fsring_reap+0xdc>
+  80313b:	be 01 00 00 00       	mov    $0x1,%esi
+  803140:	89 d9                	mov    %ebx,%ecx
+  803142:	d3 e6                	shl    %cl,%esi
+  803144:	89 f0                	mov    %esi,%eax
+  803146:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  80314c:	74 48                	je     803196 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  80314e:	89 d8                	mov    %ebx,%eax
+  803150:	c1 e0 0c             	shl    $0xc,%eax
+  803153:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  803159:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  80315c:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80315f:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  803166:	83 f8 03             	cmp    $0x3,%eax
+  803169:	74 40                	je     8031ab <fsring_reap+0xf1>
+  80316b:	83 f8 05             	cmp    $0x5,%eax
+  80316e:	74 64                	je     8031d4 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  803170:	f7 d6                	not    %esi
+  803172:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  803178:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80317b:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  803182:	8b 45 08             	mov    0x8(%ebp),%eax
+  803185:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  803187:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80318a:	89 38                	mov    %edi,(%eax)
+	return 1;
+  80318c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803191:	e9 46 ff ff ff       	jmp    8030dc <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  803196:	53                   	push   %ebx
+  803197:	68 c0 47 80 00       	push   $0x8047c0
+  80319c:	68 8f 02 00 00       	push   $0x28f
+  8031a1:	68 98 47 80 00       	push   $0x804798
+  8031a6:	e8 74 d8 ff ff       	call   800a1f <_panic>
+		if (cqe.cqe_result > 0)
+  8031ab:	85 ff                	test   %edi,%edi
+  8031ad:	7e c1                	jle    803170 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8031af:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8031b2:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8031b7:	39 c7                	cmp    %eax,%edi
+  8031b9:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8031bc:	50                   	push   %eax
+  8031bd:	ff 75 e4             	push   -0x1c(%ebp)
+  8031c0:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8031c3:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  8031ca:	e8 9f e0 ff ff       	call   80126e <memmove>
+  8031cf:	83 c4 10             	add    $0x10,%esp
+  8031d2:	eb 9c                	jmp    803170 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8031d4:	85 ff                	test   %edi,%edi
+  8031d6:	75 98                	jne    803170 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  8031d8:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8031db:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8031e2:	83 ec 08             	sub    $0x8,%esp
+  8031e5:	ff 75 e4             	push   -0x1c(%ebp)
+  8031e8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8031eb:	51                   	push   %ecx
+  8031ec:	e8 f7 de ff ff       	call   8010e8 <strcpy>
+			st->st_size = ret->ret_size;
+  8031f1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8031f4:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8031fa:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8031fd:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  803203:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  803209:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  80320f:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  803216:	50 80 00 
+  803219:	83 c4 10             	add    $0x10,%esp
+  80321c:	e9 4f ff ff ff       	jmp    803170 <fsring_reap+0xb6>
+			return 0;
+  803221:	b8 00 00 00 00       	mov    $0x0,%eax
+  803226:	e9 b1 fe ff ff       	jmp    8030dc <fsring_reap+0x22>
+
+0080322b <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  80322b:	55                   	push   %ebp
+  80322c:	89 e5                	mov    %esp,%ebp
+  80322e:	57                   	push   %edi
+  80322f:	56                   	push   %esi
+  803230:	53                   	push   %ebx
+  803231:	83 ec 28             	sub    $0x28,%esp
+  803234:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803237:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80323a:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80323d:	53                   	push   %ebx
+  80323e:	e8 6a de ff ff       	call   8010ad <strlen>
+  803243:	83 c4 10             	add    $0x10,%esp
+  803246:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80324b:	0f 8f 02 01 00 00    	jg     803353 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  803251:	83 ec 08             	sub    $0x8,%esp
+  803254:	53                   	push   %ebx
+  803255:	68 00 70 80 00       	push   $0x807000
+  80325a:	e8 89 de ff ff       	call   8010e8 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  80325f:	83 c4 10             	add    $0x10,%esp
+  803262:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  803268:	76 69                	jbe    8032d3 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80326a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80326d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803273:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  803278:	29 d1                	sub    %edx,%ecx
+  80327a:	39 f9                	cmp    %edi,%ecx
+  80327c:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80327f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803282:	89 f9                	mov    %edi,%ecx
+  803284:	01 c1                	add    %eax,%ecx
+  803286:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  803289:	eb 0f                	jmp    80329a <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  80328b:	0f b6 10             	movzbl (%eax),%edx
+  80328e:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  803290:	05 00 10 00 00       	add    $0x1000,%eax
+  803295:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80329a:	39 c8                	cmp    %ecx,%eax
+  80329c:	72 ed                	jb     80328b <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  80329e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8032a1:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  8032a7:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8032ad:	83 ec 0c             	sub    $0xc,%esp
+  8032b0:	6a 07                	push   $0x7
+  8032b2:	89 f9                	mov    %edi,%ecx
+  8032b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032b7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8032bc:	e8 3f f1 ff ff       	call   802400 <fsipc_pages>
+  8032c1:	89 c7                	mov    %eax,%edi
+  8032c3:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8032c6:	85 f6                	test   %esi,%esi
+  8032c8:	74 7f                	je     803349 <file_slurp+0x11e>
+  8032ca:	8d 43 01             	lea    0x1(%ebx),%eax
+  8032cd:	85 ff                	test   %edi,%edi
+  8032cf:	79 3c                	jns    80330d <file_slurp+0xe2>
+  8032d1:	eb 76                	jmp    803349 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8032d3:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8032d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032de:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8032e3:	e8 ba f2 ff ff       	call   8025a2 <fsipc>
+  8032e8:	89 c7                	mov    %eax,%edi
+  8032ea:	85 c0                	test   %eax,%eax
+  8032ec:	7e d8                	jle    8032c6 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8032ee:	83 ec 04             	sub    $0x4,%esp
+  8032f1:	50                   	push   %eax
+  8032f2:	68 08 70 80 00       	push   $0x807008
+  8032f7:	ff 75 0c             	push   0xc(%ebp)
+  8032fa:	e8 6f df ff ff       	call   80126e <memmove>
+  8032ff:	83 c4 10             	add    $0x10,%esp
+  803302:	eb c2                	jmp    8032c6 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  803304:	80 fa 2f             	cmp    $0x2f,%dl
+  803307:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  80330a:	83 c0 01             	add    $0x1,%eax
+  80330d:	89 c1                	mov    %eax,%ecx
+  80330f:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  803313:	84 d2                	test   %dl,%dl
+  803315:	75 ed                	jne    803304 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  803317:	83 ec 04             	sub    $0x4,%esp
+  80331a:	68 80 00 00 00       	push   $0x80
+  80331f:	53                   	push   %ebx
+  803320:	56                   	push   %esi
+  803321:	e8 38 de ff ff       	call   80115e <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  803326:	a1 00 70 80 00       	mov    0x807000,%eax
+  80332b:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  803331:	a1 04 70 80 00       	mov    0x807004,%eax
+  803336:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  80333c:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  803343:	50 80 00 
+  803346:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803349:	89 f8                	mov    %edi,%eax
+  80334b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80334e:	5b                   	pop    %ebx
+  80334f:	5e                   	pop    %esi
+  803350:	5f                   	pop    %edi
+  803351:	5d                   	pop    %ebp
+  803352:	c3                   	ret
+		return -E_BAD_PATH;
+  803353:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  803358:	eb ef                	jmp    803349 <file_slurp+0x11e>
+
+0080335a <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80335a:	55                   	push   %ebp
+  80335b:	89 e5                	mov    %esp,%ebp
+  80335d:	53                   	push   %ebx
+  80335e:	83 ec 10             	sub    $0x10,%esp
+  803361:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  803364:	53                   	push   %ebx
+  803365:	e8 43 dd ff ff       	call   8010ad <strlen>
+  80336a:	83 c4 10             	add    $0x10,%esp
+  80336d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803372:	7f 25                	jg     803399 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  803374:	83 ec 08             	sub    $0x8,%esp
+  803377:	53                   	push   %ebx
+  803378:	68 00 70 80 00       	push   $0x807000
+  80337d:	e8 66 dd ff ff       	call   8010e8 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  803382:	ba 00 00 00 00       	mov    $0x0,%edx
+  803387:	b8 07 00 00 00       	mov    $0x7,%eax
+  80338c:	e8 11 f2 ff ff       	call   8025a2 <fsipc>
+  803391:	83 c4 10             	add    $0x10,%esp
+}
+  803394:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803397:	c9                   	leave
+  803398:	c3                   	ret
+		return -E_BAD_PATH;
+  803399:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80339e:	eb f4                	jmp    803394 <remove+0x3a>
+
+008033a0 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8033a0:	55                   	push   %ebp
+  8033a1:	89 e5                	mov    %esp,%ebp
+  8033a3:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8033a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033ab:	b8 08 00 00 00       	mov    $0x8,%eax
+  8033b0:	e8 ed f1 ff ff       	call   8025a2 <fsipc>
+}
+  8033b5:	c9                   	leave
+  8033b6:	c3                   	ret
+
+008033b7 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  8033b7:	55                   	push   %ebp
+  8033b8:	89 e5                	mov    %esp,%ebp
+  8033ba:	57                   	push   %edi
+  8033bb:	56                   	push   %esi
+  8033bc:	53                   	push   %ebx
+  8033bd:	83 ec 18             	sub    $0x18,%esp
+  8033c0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033c3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8033c9:	57                   	push   %edi
+  8033ca:	e8 de dc ff ff       	call   8010ad <strlen>
+  8033cf:	83 c4 10             	add    $0x10,%esp
+  8033d2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8033d7:	7f 4c                	jg     803425 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  8033d9:	83 ec 08             	sub    $0x8,%esp
+  8033dc:	57                   	push   %edi
+  8033dd:	68 00 70 80 00       	push   $0x807000
+  8033e2:	e8 01 dd ff ff       	call   8010e8 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  8033e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033ec:	b8 10 00 00 00       	mov    $0x10,%eax
+  8033f1:	e8 ac f1 ff ff       	call   8025a2 <fsipc>
+  8033f6:	83 c4 10             	add    $0x10,%esp
+  8033f9:	85 c0                	test   %eax,%eax
+  8033fb:	78 20                	js     80341d <defrag+0x66>
+		return r;
+	if (before)
+  8033fd:	85 f6                	test   %esi,%esi
+  8033ff:	74 07                	je     803408 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  803401:	a1 00 70 80 00       	mov    0x807000,%eax
+  803406:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  803408:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  80340d:	85 db                	test   %ebx,%ebx
+  80340f:	74 0c                	je     80341d <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  803411:	a1 04 70 80 00       	mov    0x807004,%eax
+  803416:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  803418:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80341d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803420:	5b                   	pop    %ebx
+  803421:	5e                   	pop    %esi
+  803422:	5f                   	pop    %edi
+  803423:	5d                   	pop    %ebp
+  803424:	c3                   	ret
+		return -E_BAD_PATH;
+  803425:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80342a:	eb f1                	jmp    80341d <defrag+0x66>
+
+0080342c <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  80342c:	55                   	push   %ebp
+  80342d:	89 e5                	mov    %esp,%ebp
+  80342f:	53                   	push   %ebx
+  803430:	83 ec 04             	sub    $0x4,%esp
+  803433:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  803436:	ba 00 00 00 00       	mov    $0x0,%edx
+  80343b:	b8 11 00 00 00       	mov    $0x11,%eax
+  803440:	e8 5d f1 ff ff       	call   8025a2 <fsipc>
+  803445:	85 c0                	test   %eax,%eax
+  803447:	78 34                	js     80347d <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  803449:	a1 00 70 80 00       	mov    0x807000,%eax
+  80344e:	89 03                	mov    %eax,(%ebx)
+  803450:	a1 04 70 80 00       	mov    0x807004,%eax
+  803455:	89 43 04             	mov    %eax,0x4(%ebx)
+  803458:	a1 08 70 80 00       	mov    0x807008,%eax
+  80345d:	89 43 08             	mov    %eax,0x8(%ebx)
+  803460:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  803465:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803468:	a1 10 70 80 00       	mov    0x807010,%eax
+  80346d:	89 43 10             	mov    %eax,0x10(%ebx)
+  803470:	a1 14 70 80 00       	mov    0x807014,%eax
+  803475:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  803478:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80347d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803480:	c9                   	leave
+  803481:	c3                   	ret
+
+00803482 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  803482:	55                   	push   %ebp
+  803483:	89 e5                	mov    %esp,%ebp
+  803485:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803488:	68 d9 47 80 00       	push   $0x8047d9
+  80348d:	ff 75 0c             	push   0xc(%ebp)
+  803490:	e8 53 dc ff ff       	call   8010e8 <strcpy>
+	return 0;
+}
+  803495:	b8 00 00 00 00       	mov    $0x0,%eax
+  80349a:	c9                   	leave
+  80349b:	c3                   	ret
+
+0080349c <devsock_close>:
+{
+  80349c:	55                   	push   %ebp
+  80349d:	89 e5                	mov    %esp,%ebp
+  80349f:	53                   	push   %ebx
+  8034a0:	83 ec 10             	sub    $0x10,%esp
+  8034a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8034a6:	53                   	push   %ebx
+  8034a7:	e8 95 09 00 00       	call   803e41 <pageref>
+  8034ac:	89 c2                	mov    %eax,%edx
+  8034ae:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8034b1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8034b6:	83 fa 01             	cmp    $0x1,%edx
+  8034b9:	74 05                	je     8034c0 <devsock_close+0x24>
+}
+  8034bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034be:	c9                   	leave
+  8034bf:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8034c0:	83 ec 0c             	sub    $0xc,%esp
+  8034c3:	ff 73 0c             	push   0xc(%ebx)
+  8034c6:	e8 b7 02 00 00       	call   803782 <nsipc_close>
+  8034cb:	83 c4 10             	add    $0x10,%esp
+  8034ce:	eb eb                	jmp    8034bb <devsock_close+0x1f>
+
+008034d0 <devsock_write>:
+{
+  8034d0:	55                   	push   %ebp
+  8034d1:	89 e5                	mov    %esp,%ebp
+  8034d3:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8034d6:	6a 00                	push   $0x0
+  8034d8:	ff 75 10             	push   0x10(%ebp)
+  8034db:	ff 75 0c             	push   0xc(%ebp)
+  8034de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034e1:	ff 70 0c             	push   0xc(%eax)
+  8034e4:	e8 79 03 00 00       	call   803862 <nsipc_send>
+}
+  8034e9:	c9                   	leave
+  8034ea:	c3                   	ret
+
+008034eb <devsock_read>:
+{
+  8034eb:	55                   	push   %ebp
+  8034ec:	89 e5                	mov    %esp,%ebp
+  8034ee:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8034f1:	6a 00                	push   $0x0
+  8034f3:	ff 75 10             	push   0x10(%ebp)
+  8034f6:	ff 75 0c             	push   0xc(%ebp)
+  8034f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034fc:	ff 70 0c             	push   0xc(%eax)
+  8034ff:	e8 ef 02 00 00       	call   8037f3 <nsipc_recv>
+}
+  803504:	c9                   	leave
+  803505:	c3                   	ret
+
+00803506 <fd2sockid>:
+{
+  803506:	55                   	push   %ebp
+  803507:	89 e5                	mov    %esp,%ebp
+  803509:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80350c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80350f:	52                   	push   %edx
+  803510:	50                   	push   %eax
+  803511:	e8 54 e9 ff ff       	call   801e6a <fd_lookup>
+  803516:	83 c4 10             	add    $0x10,%esp
+  803519:	85 c0                	test   %eax,%eax
+  80351b:	78 10                	js     80352d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80351d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803520:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  803526:	39 08                	cmp    %ecx,(%eax)
+  803528:	75 05                	jne    80352f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80352a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80352d:	c9                   	leave
+  80352e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80352f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803534:	eb f7                	jmp    80352d <fd2sockid+0x27>
+
+00803536 <alloc_sockfd>:
+{
+  803536:	55                   	push   %ebp
+  803537:	89 e5                	mov    %esp,%ebp
+  803539:	56                   	push   %esi
+  80353a:	53                   	push   %ebx
+  80353b:	83 ec 1c             	sub    $0x1c,%esp
+  80353e:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803540:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803543:	50                   	push   %eax
+  803544:	e8 cb e8 ff ff       	call   801e14 <fd_alloc>
+  803549:	89 c3                	mov    %eax,%ebx
+  80354b:	83 c4 10             	add    $0x10,%esp
+  80354e:	85 c0                	test   %eax,%eax
+  803550:	78 43                	js     803595 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803552:	83 ec 04             	sub    $0x4,%esp
+  803555:	68 07 04 00 00       	push   $0x407
+  80355a:	ff 75 f4             	push   -0xc(%ebp)
+  80355d:	6a 00                	push   $0x0
+  80355f:	e8 90 df ff ff       	call   8014f4 <sys_page_alloc>
+  803564:	89 c3                	mov    %eax,%ebx
+  803566:	83 c4 10             	add    $0x10,%esp
+  803569:	85 c0                	test   %eax,%eax
+  80356b:	78 28                	js     803595 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80356d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803570:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  803576:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803578:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80357b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803582:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803585:	83 ec 0c             	sub    $0xc,%esp
+  803588:	50                   	push   %eax
+  803589:	e8 5f e8 ff ff       	call   801ded <fd2num>
+  80358e:	89 c3                	mov    %eax,%ebx
+  803590:	83 c4 10             	add    $0x10,%esp
+  803593:	eb 0c                	jmp    8035a1 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803595:	83 ec 0c             	sub    $0xc,%esp
+  803598:	56                   	push   %esi
+  803599:	e8 e4 01 00 00       	call   803782 <nsipc_close>
+		return r;
+  80359e:	83 c4 10             	add    $0x10,%esp
+}
+  8035a1:	89 d8                	mov    %ebx,%eax
+  8035a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035a6:	5b                   	pop    %ebx
+  8035a7:	5e                   	pop    %esi
+  8035a8:	5d                   	pop    %ebp
+  8035a9:	c3                   	ret
+
+008035aa <accept>:
+{
+  8035aa:	55                   	push   %ebp
+  8035ab:	89 e5                	mov    %esp,%ebp
+  8035ad:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8035b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035b3:	e8 4e ff ff ff       	call   803506 <fd2sockid>
+  8035b8:	85 c0                	test   %eax,%eax
+  8035ba:	78 1b                	js     8035d7 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8035bc:	83 ec 04             	sub    $0x4,%esp
+  8035bf:	ff 75 10             	push   0x10(%ebp)
+  8035c2:	ff 75 0c             	push   0xc(%ebp)
+  8035c5:	50                   	push   %eax
+  8035c6:	e8 0e 01 00 00       	call   8036d9 <nsipc_accept>
+  8035cb:	83 c4 10             	add    $0x10,%esp
+  8035ce:	85 c0                	test   %eax,%eax
+  8035d0:	78 05                	js     8035d7 <accept+0x2d>
+	return alloc_sockfd(r);
+  8035d2:	e8 5f ff ff ff       	call   803536 <alloc_sockfd>
+}
+  8035d7:	c9                   	leave
+  8035d8:	c3                   	ret
+
+008035d9 <bind>:
+{
+  8035d9:	55                   	push   %ebp
+  8035da:	89 e5                	mov    %esp,%ebp
+  8035dc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8035df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035e2:	e8 1f ff ff ff       	call   803506 <fd2sockid>
+  8035e7:	85 c0                	test   %eax,%eax
+  8035e9:	78 12                	js     8035fd <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8035eb:	83 ec 04             	sub    $0x4,%esp
+  8035ee:	ff 75 10             	push   0x10(%ebp)
+  8035f1:	ff 75 0c             	push   0xc(%ebp)
+  8035f4:	50                   	push   %eax
+  8035f5:	e8 31 01 00 00       	call   80372b <nsipc_bind>
+  8035fa:	83 c4 10             	add    $0x10,%esp
+}
+  8035fd:	c9                   	leave
+  8035fe:	c3                   	ret
+
+008035ff <shutdown>:
+{
+  8035ff:	55                   	push   %ebp
+  803600:	89 e5                	mov    %esp,%ebp
+  803602:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803605:	8b 45 08             	mov    0x8(%ebp),%eax
+  803608:	e8 f9 fe ff ff       	call   803506 <fd2sockid>
+  80360d:	85 c0                	test   %eax,%eax
+  80360f:	78 0f                	js     803620 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803611:	83 ec 08             	sub    $0x8,%esp
+  803614:	ff 75 0c             	push   0xc(%ebp)
+  803617:	50                   	push   %eax
+  803618:	e8 43 01 00 00       	call   803760 <nsipc_shutdown>
+  80361d:	83 c4 10             	add    $0x10,%esp
+}
+  803620:	c9                   	leave
+  803621:	c3                   	ret
+
+00803622 <connect>:
+{
+  803622:	55                   	push   %ebp
+  803623:	89 e5                	mov    %esp,%ebp
+  803625:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803628:	8b 45 08             	mov    0x8(%ebp),%eax
+  80362b:	e8 d6 fe ff ff       	call   803506 <fd2sockid>
+  803630:	85 c0                	test   %eax,%eax
+  803632:	78 12                	js     803646 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803634:	83 ec 04             	sub    $0x4,%esp
+  803637:	ff 75 10             	push   0x10(%ebp)
+  80363a:	ff 75 0c             	push   0xc(%ebp)
+  80363d:	50                   	push   %eax
+  80363e:	e8 59 01 00 00       	call   80379c <nsipc_connect>
+  803643:	83 c4 10             	add    $0x10,%esp
+}
+  803646:	c9                   	leave
+  803647:	c3                   	ret
+
+00803648 <listen>:
+{
+  803648:	55                   	push   %ebp
+  803649:	89 e5                	mov    %esp,%ebp
+  80364b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80364e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803651:	e8 b0 fe ff ff       	call   803506 <fd2sockid>
+  803656:	85 c0                	test   %eax,%eax
+  803658:	78 0f                	js     803669 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80365a:	83 ec 08             	sub    $0x8,%esp
+  80365d:	ff 75 0c             	push   0xc(%ebp)
+  803660:	50                   	push   %eax
+  803661:	e8 6b 01 00 00       	call   8037d1 <nsipc_listen>
+  803666:	83 c4 10             	add    $0x10,%esp
+}
+  803669:	c9                   	leave
+  80366a:	c3                   	ret
+
+0080366b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80366b:	55                   	push   %ebp
+  80366c:	89 e5                	mov    %esp,%ebp
+  80366e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803671:	ff 75 10             	push   0x10(%ebp)
+  803674:	ff 75 0c             	push   0xc(%ebp)
+  803677:	ff 75 08             	push   0x8(%ebp)
+  80367a:	e8 41 02 00 00       	call   8038c0 <nsipc_socket>
+  80367f:	83 c4 10             	add    $0x10,%esp
+  803682:	85 c0                	test   %eax,%eax
+  803684:	78 05                	js     80368b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803686:	e8 ab fe ff ff       	call   803536 <alloc_sockfd>
+}
+  80368b:	c9                   	leave
+  80368c:	c3                   	ret
+
+0080368d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80368d:	55                   	push   %ebp
+  80368e:	89 e5                	mov    %esp,%ebp
+  803690:	53                   	push   %ebx
+  803691:	83 ec 04             	sub    $0x4,%esp
+  803694:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803696:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80369d:	74 26                	je     8036c5 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80369f:	6a 07                	push   $0x7
+  8036a1:	68 00 90 80 00       	push   $0x809000
+  8036a6:	53                   	push   %ebx
+  8036a7:	ff 35 00 a0 80 00    	push   0x80a000
+  8036ad:	e8 c3 e5 ff ff       	call   801c75 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8036b2:	83 c4 0c             	add    $0xc,%esp
+  8036b5:	6a 00                	push   $0x0
+  8036b7:	6a 00                	push   $0x0
+  8036b9:	6a 00                	push   $0x0
+  8036bb:	e8 4a e5 ff ff       	call   801c0a <ipc_recv>
+}
+  8036c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036c3:	c9                   	leave
+  8036c4:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8036c5:	83 ec 0c             	sub    $0xc,%esp
+  8036c8:	6a 02                	push   $0x2
+  8036ca:	e8 df e6 ff ff       	call   801dae <ipc_find_env>
+  8036cf:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  8036d4:	83 c4 10             	add    $0x10,%esp
+  8036d7:	eb c6                	jmp    80369f <nsipc+0x12>
+
+008036d9 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8036d9:	55                   	push   %ebp
+  8036da:	89 e5                	mov    %esp,%ebp
+  8036dc:	56                   	push   %esi
+  8036dd:	53                   	push   %ebx
+  8036de:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8036e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036e4:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8036e9:	8b 06                	mov    (%esi),%eax
+  8036eb:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8036f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036f5:	e8 93 ff ff ff       	call   80368d <nsipc>
+  8036fa:	89 c3                	mov    %eax,%ebx
+  8036fc:	85 c0                	test   %eax,%eax
+  8036fe:	79 09                	jns    803709 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803700:	89 d8                	mov    %ebx,%eax
+  803702:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803705:	5b                   	pop    %ebx
+  803706:	5e                   	pop    %esi
+  803707:	5d                   	pop    %ebp
+  803708:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803709:	83 ec 04             	sub    $0x4,%esp
+  80370c:	ff 35 10 90 80 00    	push   0x809010
+  803712:	68 00 90 80 00       	push   $0x809000
+  803717:	ff 75 0c             	push   0xc(%ebp)
+  80371a:	e8 4f db ff ff       	call   80126e <memmove>
+		*addrlen = ret->ret_addrlen;
+  80371f:	a1 10 90 80 00       	mov    0x809010,%eax
+  803724:	89 06                	mov    %eax,(%esi)
+  803726:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803729:	eb d5                	jmp    803700 <nsipc_accept+0x27>
+
+0080372b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80372b:	55                   	push   %ebp
+  80372c:	89 e5                	mov    %esp,%ebp
+  80372e:	53                   	push   %ebx
+  80372f:	83 ec 08             	sub    $0x8,%esp
+  803732:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803735:	8b 45 08             	mov    0x8(%ebp),%eax
+  803738:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80373d:	53                   	push   %ebx
+  80373e:	ff 75 0c             	push   0xc(%ebp)
+  803741:	68 04 90 80 00       	push   $0x809004
+  803746:	e8 23 db ff ff       	call   80126e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80374b:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  803751:	b8 02 00 00 00       	mov    $0x2,%eax
+  803756:	e8 32 ff ff ff       	call   80368d <nsipc>
+}
+  80375b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80375e:	c9                   	leave
+  80375f:	c3                   	ret
+
+00803760 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803760:	55                   	push   %ebp
+  803761:	89 e5                	mov    %esp,%ebp
+  803763:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803766:	8b 45 08             	mov    0x8(%ebp),%eax
+  803769:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  80376e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803771:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  803776:	b8 03 00 00 00       	mov    $0x3,%eax
+  80377b:	e8 0d ff ff ff       	call   80368d <nsipc>
+}
+  803780:	c9                   	leave
+  803781:	c3                   	ret
+
+00803782 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803782:	55                   	push   %ebp
+  803783:	89 e5                	mov    %esp,%ebp
+  803785:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803788:	8b 45 08             	mov    0x8(%ebp),%eax
+  80378b:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  803790:	b8 04 00 00 00       	mov    $0x4,%eax
+  803795:	e8 f3 fe ff ff       	call   80368d <nsipc>
+}
+  80379a:	c9                   	leave
+  80379b:	c3                   	ret
+
+0080379c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80379c:	55                   	push   %ebp
+  80379d:	89 e5                	mov    %esp,%ebp
+  80379f:	53                   	push   %ebx
+  8037a0:	83 ec 08             	sub    $0x8,%esp
+  8037a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8037a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037a9:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8037ae:	53                   	push   %ebx
+  8037af:	ff 75 0c             	push   0xc(%ebp)
+  8037b2:	68 04 90 80 00       	push   $0x809004
+  8037b7:	e8 b2 da ff ff       	call   80126e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8037bc:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  8037c2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8037c7:	e8 c1 fe ff ff       	call   80368d <nsipc>
+}
+  8037cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037cf:	c9                   	leave
+  8037d0:	c3                   	ret
+
+008037d1 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8037d1:	55                   	push   %ebp
+  8037d2:	89 e5                	mov    %esp,%ebp
+  8037d4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8037d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037da:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8037df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037e2:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8037e7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8037ec:	e8 9c fe ff ff       	call   80368d <nsipc>
+}
+  8037f1:	c9                   	leave
+  8037f2:	c3                   	ret
+
+008037f3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8037f3:	55                   	push   %ebp
+  8037f4:	89 e5                	mov    %esp,%ebp
+  8037f6:	56                   	push   %esi
+  8037f7:	53                   	push   %ebx
+  8037f8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8037fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037fe:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  803803:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  803809:	8b 45 14             	mov    0x14(%ebp),%eax
+  80380c:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803811:	b8 07 00 00 00       	mov    $0x7,%eax
+  803816:	e8 72 fe ff ff       	call   80368d <nsipc>
+  80381b:	89 c3                	mov    %eax,%ebx
+  80381d:	85 c0                	test   %eax,%eax
+  80381f:	78 22                	js     803843 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803821:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803826:	39 c6                	cmp    %eax,%esi
+  803828:	0f 4e c6             	cmovle %esi,%eax
+  80382b:	39 c3                	cmp    %eax,%ebx
+  80382d:	7f 1d                	jg     80384c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80382f:	83 ec 04             	sub    $0x4,%esp
+  803832:	53                   	push   %ebx
+  803833:	68 00 90 80 00       	push   $0x809000
+  803838:	ff 75 0c             	push   0xc(%ebp)
+  80383b:	e8 2e da ff ff       	call   80126e <memmove>
+  803840:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803843:	89 d8                	mov    %ebx,%eax
+  803845:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803848:	5b                   	pop    %ebx
+  803849:	5e                   	pop    %esi
+  80384a:	5d                   	pop    %ebp
+  80384b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80384c:	68 e5 47 80 00       	push   $0x8047e5
+  803851:	68 2c 42 80 00       	push   $0x80422c
+  803856:	6a 62                	push   $0x62
+  803858:	68 fa 47 80 00       	push   $0x8047fa
+  80385d:	e8 bd d1 ff ff       	call   800a1f <_panic>
+
+00803862 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803862:	55                   	push   %ebp
+  803863:	89 e5                	mov    %esp,%ebp
+  803865:	53                   	push   %ebx
+  803866:	83 ec 04             	sub    $0x4,%esp
+  803869:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80386c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80386f:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803874:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80387a:	7f 2e                	jg     8038aa <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80387c:	83 ec 04             	sub    $0x4,%esp
+  80387f:	53                   	push   %ebx
+  803880:	ff 75 0c             	push   0xc(%ebp)
+  803883:	68 0c 90 80 00       	push   $0x80900c
+  803888:	e8 e1 d9 ff ff       	call   80126e <memmove>
+	nsipcbuf.send.req_size = size;
+  80388d:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803893:	8b 45 14             	mov    0x14(%ebp),%eax
+  803896:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  80389b:	b8 08 00 00 00       	mov    $0x8,%eax
+  8038a0:	e8 e8 fd ff ff       	call   80368d <nsipc>
+}
+  8038a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038a8:	c9                   	leave
+  8038a9:	c3                   	ret
+	assert(size < 1600);
+  8038aa:	68 06 48 80 00       	push   $0x804806
+  8038af:	68 2c 42 80 00       	push   $0x80422c
+  8038b4:	6a 6d                	push   $0x6d
+  8038b6:	68 fa 47 80 00       	push   $0x8047fa
+  8038bb:	e8 5f d1 ff ff       	call   800a1f <_panic>
+
+008038c0 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8038c0:	55                   	push   %ebp
+  8038c1:	89 e5                	mov    %esp,%ebp
+  8038c3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8038c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038c9:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  8038ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8038d1:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  8038d6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8038d9:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8038de:	b8 09 00 00 00       	mov    $0x9,%eax
+  8038e3:	e8 a5 fd ff ff       	call   80368d <nsipc>
+}
+  8038e8:	c9                   	leave
+  8038e9:	c3                   	ret
+
+008038ea <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8038ea:	55                   	push   %ebp
+  8038eb:	89 e5                	mov    %esp,%ebp
+  8038ed:	56                   	push   %esi
+  8038ee:	53                   	push   %ebx
+  8038ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8038f2:	83 ec 0c             	sub    $0xc,%esp
+  8038f5:	ff 75 08             	push   0x8(%ebp)
+  8038f8:	e8 00 e5 ff ff       	call   801dfd <fd2data>
+  8038fd:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8038ff:	83 c4 08             	add    $0x8,%esp
+  803902:	68 12 48 80 00       	push   $0x804812
+  803907:	53                   	push   %ebx
+  803908:	e8 db d7 ff ff       	call   8010e8 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80390d:	8b 46 04             	mov    0x4(%esi),%eax
+  803910:	2b 06                	sub    (%esi),%eax
+  803912:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803918:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80391f:	00 00 00 
+	stat->st_dev = &devpipe;
+  803922:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  803929:	50 80 00 
+	return 0;
+}
+  80392c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803931:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803934:	5b                   	pop    %ebx
+  803935:	5e                   	pop    %esi
+  803936:	5d                   	pop    %ebp
+  803937:	c3                   	ret
+
+00803938 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803938:	55                   	push   %ebp
+  803939:	89 e5                	mov    %esp,%ebp
+  80393b:	53                   	push   %ebx
+  80393c:	83 ec 0c             	sub    $0xc,%esp
+  80393f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803942:	53                   	push   %ebx
+  803943:	6a 00                	push   $0x0
+  803945:	e8 37 dc ff ff       	call   801581 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80394a:	89 1c 24             	mov    %ebx,(%esp)
+  80394d:	e8 ab e4 ff ff       	call   801dfd <fd2data>
+  803952:	83 c4 08             	add    $0x8,%esp
+  803955:	50                   	push   %eax
+  803956:	6a 00                	push   $0x0
+  803958:	e8 24 dc ff ff       	call   801581 <sys_page_unmap>
+}
+  80395d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803960:	c9                   	leave
+  803961:	c3                   	ret
+
+00803962 <_pipeisclosed>:
+{
+  803962:	55                   	push   %ebp
+  803963:	89 e5                	mov    %esp,%ebp
+  803965:	57                   	push   %edi
+  803966:	56                   	push   %esi
+  803967:	53                   	push   %ebx
+  803968:	83 ec 1c             	sub    $0x1c,%esp
+  80396b:	89 c7                	mov    %eax,%edi
+  80396d:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80396f:	a1 18 60 80 00       	mov    0x806018,%eax
+  803974:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803977:	83 ec 0c             	sub    $0xc,%esp
+  80397a:	57                   	push   %edi
+  80397b:	e8 c1 04 00 00       	call   803e41 <pageref>
+  803980:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803983:	89 34 24             	mov    %esi,(%esp)
+  803986:	e8 b6 04 00 00       	call   803e41 <pageref>
+		nn = thisenv->env_runs;
+  80398b:	8b 15 18 60 80 00    	mov    0x806018,%edx
+  803991:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  803994:	83 c4 10             	add    $0x10,%esp
+  803997:	39 cb                	cmp    %ecx,%ebx
+  803999:	74 1b                	je     8039b6 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80399b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80399e:	75 cf                	jne    80396f <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8039a0:	8b 42 58             	mov    0x58(%edx),%eax
+  8039a3:	6a 01                	push   $0x1
+  8039a5:	50                   	push   %eax
+  8039a6:	53                   	push   %ebx
+  8039a7:	68 19 48 80 00       	push   $0x804819
+  8039ac:	e8 49 d1 ff ff       	call   800afa <cprintf>
+  8039b1:	83 c4 10             	add    $0x10,%esp
+  8039b4:	eb b9                	jmp    80396f <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8039b6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8039b9:	0f 94 c0             	sete   %al
+  8039bc:	0f b6 c0             	movzbl %al,%eax
+}
+  8039bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039c2:	5b                   	pop    %ebx
+  8039c3:	5e                   	pop    %esi
+  8039c4:	5f                   	pop    %edi
+  8039c5:	5d                   	pop    %ebp
+  8039c6:	c3                   	ret
+
+008039c7 <devpipe_write>:
+{
+  8039c7:	55                   	push   %ebp
+  8039c8:	89 e5                	mov    %esp,%ebp
+  8039ca:	57                   	push   %edi
+  8039cb:	56                   	push   %esi
+  8039cc:	53                   	push   %ebx
+  8039cd:	83 ec 28             	sub    $0x28,%esp
+  8039d0:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8039d3:	56                   	push   %esi
+  8039d4:	e8 24 e4 ff ff       	call   801dfd <fd2data>
+  8039d9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8039db:	83 c4 10             	add    $0x10,%esp
+  8039de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039e3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8039e6:	75 09                	jne    8039f1 <devpipe_write+0x2a>
+	return i;
+  8039e8:	89 f8                	mov    %edi,%eax
+  8039ea:	eb 23                	jmp    803a0f <devpipe_write+0x48>
+			sys_yield();
+  8039ec:	e8 e4 da ff ff       	call   8014d5 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8039f1:	8b 43 04             	mov    0x4(%ebx),%eax
+  8039f4:	8b 0b                	mov    (%ebx),%ecx
+  8039f6:	8d 51 20             	lea    0x20(%ecx),%edx
+  8039f9:	39 d0                	cmp    %edx,%eax
+  8039fb:	72 1a                	jb     803a17 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8039fd:	89 da                	mov    %ebx,%edx
+  8039ff:	89 f0                	mov    %esi,%eax
+  803a01:	e8 5c ff ff ff       	call   803962 <_pipeisclosed>
+  803a06:	85 c0                	test   %eax,%eax
+  803a08:	74 e2                	je     8039ec <devpipe_write+0x25>
+				return 0;
+  803a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a12:	5b                   	pop    %ebx
+  803a13:	5e                   	pop    %esi
+  803a14:	5f                   	pop    %edi
+  803a15:	5d                   	pop    %ebp
+  803a16:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803a17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803a1a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803a1e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803a21:	89 c2                	mov    %eax,%edx
+  803a23:	c1 fa 1f             	sar    $0x1f,%edx
+  803a26:	89 d1                	mov    %edx,%ecx
+  803a28:	c1 e9 1b             	shr    $0x1b,%ecx
+  803a2b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803a2e:	83 e2 1f             	and    $0x1f,%edx
+  803a31:	29 ca                	sub    %ecx,%edx
+  803a33:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803a37:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803a3b:	83 c0 01             	add    $0x1,%eax
+  803a3e:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803a41:	83 c7 01             	add    $0x1,%edi
+  803a44:	eb 9d                	jmp    8039e3 <devpipe_write+0x1c>
+
+00803a46 <devpipe_read>:
+{
+  803a46:	55                   	push   %ebp
+  803a47:	89 e5                	mov    %esp,%ebp
+  803a49:	57                   	push   %edi
+  803a4a:	56                   	push   %esi
+  803a4b:	53                   	push   %ebx
+  803a4c:	83 ec 18             	sub    $0x18,%esp
+  803a4f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803a52:	57                   	push   %edi
+  803a53:	e8 a5 e3 ff ff       	call   801dfd <fd2data>
+  803a58:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803a5a:	83 c4 10             	add    $0x10,%esp
+  803a5d:	be 00 00 00 00       	mov    $0x0,%esi
+  803a62:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803a65:	75 13                	jne    803a7a <devpipe_read+0x34>
+	return i;
+  803a67:	89 f0                	mov    %esi,%eax
+  803a69:	eb 02                	jmp    803a6d <devpipe_read+0x27>
+				return i;
+  803a6b:	89 f0                	mov    %esi,%eax
+}
+  803a6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a70:	5b                   	pop    %ebx
+  803a71:	5e                   	pop    %esi
+  803a72:	5f                   	pop    %edi
+  803a73:	5d                   	pop    %ebp
+  803a74:	c3                   	ret
+			sys_yield();
+  803a75:	e8 5b da ff ff       	call   8014d5 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803a7a:	8b 03                	mov    (%ebx),%eax
+  803a7c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803a7f:	75 18                	jne    803a99 <devpipe_read+0x53>
+			if (i > 0)
+  803a81:	85 f6                	test   %esi,%esi
+  803a83:	75 e6                	jne    803a6b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803a85:	89 da                	mov    %ebx,%edx
+  803a87:	89 f8                	mov    %edi,%eax
+  803a89:	e8 d4 fe ff ff       	call   803962 <_pipeisclosed>
+  803a8e:	85 c0                	test   %eax,%eax
+  803a90:	74 e3                	je     803a75 <devpipe_read+0x2f>
+				return 0;
+  803a92:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a97:	eb d4                	jmp    803a6d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803a99:	99                   	cltd
+  803a9a:	c1 ea 1b             	shr    $0x1b,%edx
+  803a9d:	01 d0                	add    %edx,%eax
+  803a9f:	83 e0 1f             	and    $0x1f,%eax
+  803aa2:	29 d0                	sub    %edx,%eax
+  803aa4:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803aa9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803aac:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803aaf:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803ab2:	83 c6 01             	add    $0x1,%esi
+  803ab5:	eb ab                	jmp    803a62 <devpipe_read+0x1c>
+
+00803ab7 <pipe>:
+{
+  803ab7:	55                   	push   %ebp
+  803ab8:	89 e5                	mov    %esp,%ebp
+  803aba:	56                   	push   %esi
+  803abb:	53                   	push   %ebx
+  803abc:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803abf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ac2:	50                   	push   %eax
+  803ac3:	e8 4c e3 ff ff       	call   801e14 <fd_alloc>
+  803ac8:	89 c3                	mov    %eax,%ebx
+  803aca:	83 c4 10             	add    $0x10,%esp
+  803acd:	85 c0                	test   %eax,%eax
+  803acf:	0f 88 23 01 00 00    	js     803bf8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803ad5:	83 ec 04             	sub    $0x4,%esp
+  803ad8:	68 07 04 00 00       	push   $0x407
+  803add:	ff 75 f4             	push   -0xc(%ebp)
+  803ae0:	6a 00                	push   $0x0
+  803ae2:	e8 0d da ff ff       	call   8014f4 <sys_page_alloc>
+  803ae7:	89 c3                	mov    %eax,%ebx
+  803ae9:	83 c4 10             	add    $0x10,%esp
+  803aec:	85 c0                	test   %eax,%eax
+  803aee:	0f 88 04 01 00 00    	js     803bf8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803af4:	83 ec 0c             	sub    $0xc,%esp
+  803af7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803afa:	50                   	push   %eax
+  803afb:	e8 14 e3 ff ff       	call   801e14 <fd_alloc>
+  803b00:	89 c3                	mov    %eax,%ebx
+  803b02:	83 c4 10             	add    $0x10,%esp
+  803b05:	85 c0                	test   %eax,%eax
+  803b07:	0f 88 db 00 00 00    	js     803be8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b0d:	83 ec 04             	sub    $0x4,%esp
+  803b10:	68 07 04 00 00       	push   $0x407
+  803b15:	ff 75 f0             	push   -0x10(%ebp)
+  803b18:	6a 00                	push   $0x0
+  803b1a:	e8 d5 d9 ff ff       	call   8014f4 <sys_page_alloc>
+  803b1f:	89 c3                	mov    %eax,%ebx
+  803b21:	83 c4 10             	add    $0x10,%esp
+  803b24:	85 c0                	test   %eax,%eax
+  803b26:	0f 88 bc 00 00 00    	js     803be8 <pipe+0x131>
+	va = fd2data(fd0);
+  803b2c:	83 ec 0c             	sub    $0xc,%esp
+  803b2f:	ff 75 f4             	push   -0xc(%ebp)
+  803b32:	e8 c6 e2 ff ff       	call   801dfd <fd2data>
+  803b37:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b39:	83 c4 0c             	add    $0xc,%esp
+  803b3c:	68 07 04 00 00       	push   $0x407
+  803b41:	50                   	push   %eax
+  803b42:	6a 00                	push   $0x0
+  803b44:	e8 ab d9 ff ff       	call   8014f4 <sys_page_alloc>
+  803b49:	89 c3                	mov    %eax,%ebx
+  803b4b:	83 c4 10             	add    $0x10,%esp
+  803b4e:	85 c0                	test   %eax,%eax
+  803b50:	0f 88 82 00 00 00    	js     803bd8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b56:	83 ec 0c             	sub    $0xc,%esp
+  803b59:	ff 75 f0             	push   -0x10(%ebp)
+  803b5c:	e8 9c e2 ff ff       	call   801dfd <fd2data>
+  803b61:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803b68:	50                   	push   %eax
+  803b69:	6a 00                	push   $0x0
+  803b6b:	56                   	push   %esi
+  803b6c:	6a 00                	push   $0x0
+  803b6e:	e8 cc d9 ff ff       	call   80153f <sys_page_map>
+  803b73:	89 c3                	mov    %eax,%ebx
+  803b75:	83 c4 20             	add    $0x20,%esp
+  803b78:	85 c0                	test   %eax,%eax
+  803b7a:	78 4e                	js     803bca <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803b7c:	a1 60 50 80 00       	mov    0x805060,%eax
+  803b81:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b84:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803b86:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b89:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803b90:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803b93:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803b95:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803b98:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803b9f:	83 ec 0c             	sub    $0xc,%esp
+  803ba2:	ff 75 f4             	push   -0xc(%ebp)
+  803ba5:	e8 43 e2 ff ff       	call   801ded <fd2num>
+  803baa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803bad:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803baf:	83 c4 04             	add    $0x4,%esp
+  803bb2:	ff 75 f0             	push   -0x10(%ebp)
+  803bb5:	e8 33 e2 ff ff       	call   801ded <fd2num>
+  803bba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803bbd:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803bc0:	83 c4 10             	add    $0x10,%esp
+  803bc3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803bc8:	eb 2e                	jmp    803bf8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803bca:	83 ec 08             	sub    $0x8,%esp
+  803bcd:	56                   	push   %esi
+  803bce:	6a 00                	push   $0x0
+  803bd0:	e8 ac d9 ff ff       	call   801581 <sys_page_unmap>
+  803bd5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803bd8:	83 ec 08             	sub    $0x8,%esp
+  803bdb:	ff 75 f0             	push   -0x10(%ebp)
+  803bde:	6a 00                	push   $0x0
+  803be0:	e8 9c d9 ff ff       	call   801581 <sys_page_unmap>
+  803be5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803be8:	83 ec 08             	sub    $0x8,%esp
+  803beb:	ff 75 f4             	push   -0xc(%ebp)
+  803bee:	6a 00                	push   $0x0
+  803bf0:	e8 8c d9 ff ff       	call   801581 <sys_page_unmap>
+  803bf5:	83 c4 10             	add    $0x10,%esp
+}
+  803bf8:	89 d8                	mov    %ebx,%eax
+  803bfa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bfd:	5b                   	pop    %ebx
+  803bfe:	5e                   	pop    %esi
+  803bff:	5d                   	pop    %ebp
+  803c00:	c3                   	ret
+
+00803c01 <pipeisclosed>:
+{
+  803c01:	55                   	push   %ebp
+  803c02:	89 e5                	mov    %esp,%ebp
+  803c04:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c07:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c0a:	50                   	push   %eax
+  803c0b:	ff 75 08             	push   0x8(%ebp)
+  803c0e:	e8 57 e2 ff ff       	call   801e6a <fd_lookup>
+  803c13:	83 c4 10             	add    $0x10,%esp
+  803c16:	85 c0                	test   %eax,%eax
+  803c18:	78 18                	js     803c32 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803c1a:	83 ec 0c             	sub    $0xc,%esp
+  803c1d:	ff 75 f4             	push   -0xc(%ebp)
+  803c20:	e8 d8 e1 ff ff       	call   801dfd <fd2data>
+  803c25:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803c27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c2a:	e8 33 fd ff ff       	call   803962 <_pipeisclosed>
+  803c2f:	83 c4 10             	add    $0x10,%esp
+}
+  803c32:	c9                   	leave
+  803c33:	c3                   	ret
+
+00803c34 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803c34:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c39:	c3                   	ret
+
+00803c3a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803c3a:	55                   	push   %ebp
+  803c3b:	89 e5                	mov    %esp,%ebp
+  803c3d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803c40:	68 31 48 80 00       	push   $0x804831
+  803c45:	ff 75 0c             	push   0xc(%ebp)
+  803c48:	e8 9b d4 ff ff       	call   8010e8 <strcpy>
+	return 0;
+}
+  803c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c52:	c9                   	leave
+  803c53:	c3                   	ret
+
+00803c54 <devcons_write>:
+{
+  803c54:	55                   	push   %ebp
+  803c55:	89 e5                	mov    %esp,%ebp
+  803c57:	57                   	push   %edi
+  803c58:	56                   	push   %esi
+  803c59:	53                   	push   %ebx
+  803c5a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803c60:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803c65:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803c6b:	eb 2e                	jmp    803c9b <devcons_write+0x47>
+		m = n - tot;
+  803c6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803c70:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803c72:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803c77:	39 c3                	cmp    %eax,%ebx
+  803c79:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803c7c:	83 ec 04             	sub    $0x4,%esp
+  803c7f:	53                   	push   %ebx
+  803c80:	89 f0                	mov    %esi,%eax
+  803c82:	03 45 0c             	add    0xc(%ebp),%eax
+  803c85:	50                   	push   %eax
+  803c86:	57                   	push   %edi
+  803c87:	e8 e2 d5 ff ff       	call   80126e <memmove>
+		sys_cputs(buf, m);
+  803c8c:	83 c4 08             	add    $0x8,%esp
+  803c8f:	53                   	push   %ebx
+  803c90:	57                   	push   %edi
+  803c91:	e8 82 d7 ff ff       	call   801418 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803c96:	01 de                	add    %ebx,%esi
+  803c98:	83 c4 10             	add    $0x10,%esp
+  803c9b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803c9e:	72 cd                	jb     803c6d <devcons_write+0x19>
+}
+  803ca0:	89 f0                	mov    %esi,%eax
+  803ca2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ca5:	5b                   	pop    %ebx
+  803ca6:	5e                   	pop    %esi
+  803ca7:	5f                   	pop    %edi
+  803ca8:	5d                   	pop    %ebp
+  803ca9:	c3                   	ret
+
+00803caa <devcons_read>:
+{
+  803caa:	55                   	push   %ebp
+  803cab:	89 e5                	mov    %esp,%ebp
+  803cad:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803cb9:	75 07                	jne    803cc2 <devcons_read+0x18>
+  803cbb:	eb 1f                	jmp    803cdc <devcons_read+0x32>
+		sys_yield();
+  803cbd:	e8 13 d8 ff ff       	call   8014d5 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803cc2:	e8 77 d7 ff ff       	call   80143e <sys_cgetc>
+  803cc7:	85 c0                	test   %eax,%eax
+  803cc9:	74 f2                	je     803cbd <devcons_read+0x13>
+	if (c < 0)
+  803ccb:	78 0f                	js     803cdc <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803ccd:	83 f8 04             	cmp    $0x4,%eax
+  803cd0:	74 0c                	je     803cde <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803cd2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803cd5:	88 02                	mov    %al,(%edx)
+	return 1;
+  803cd7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803cdc:	c9                   	leave
+  803cdd:	c3                   	ret
+		return 0;
+  803cde:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ce3:	eb f7                	jmp    803cdc <devcons_read+0x32>
+
+00803ce5 <cputchar>:
+{
+  803ce5:	55                   	push   %ebp
+  803ce6:	89 e5                	mov    %esp,%ebp
+  803ce8:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803ceb:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cee:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803cf1:	6a 01                	push   $0x1
+  803cf3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803cf6:	50                   	push   %eax
+  803cf7:	e8 1c d7 ff ff       	call   801418 <sys_cputs>
+}
+  803cfc:	83 c4 10             	add    $0x10,%esp
+  803cff:	c9                   	leave
+  803d00:	c3                   	ret
+
+00803d01 <getchar>:
+{
+  803d01:	55                   	push   %ebp
+  803d02:	89 e5                	mov    %esp,%ebp
+  803d04:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803d07:	6a 01                	push   $0x1
+  803d09:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803d0c:	50                   	push   %eax
+  803d0d:	6a 00                	push   $0x0
+  803d0f:	e8 bc e3 ff ff       	call   8020d0 <read>
+	if (r < 0)
+  803d14:	83 c4 10             	add    $0x10,%esp
+  803d17:	85 c0                	test   %eax,%eax
+  803d19:	78 06                	js     803d21 <getchar+0x20>
+	if (r < 1)
+  803d1b:	74 06                	je     803d23 <getchar+0x22>
+	return c;
+  803d1d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803d21:	c9                   	leave
+  803d22:	c3                   	ret
+		return -E_EOF;
+  803d23:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803d28:	eb f7                	jmp    803d21 <getchar+0x20>
+
+00803d2a <iscons>:
+{
+  803d2a:	55                   	push   %ebp
+  803d2b:	89 e5                	mov    %esp,%ebp
+  803d2d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803d30:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d33:	50                   	push   %eax
+  803d34:	ff 75 08             	push   0x8(%ebp)
+  803d37:	e8 2e e1 ff ff       	call   801e6a <fd_lookup>
+  803d3c:	83 c4 10             	add    $0x10,%esp
+  803d3f:	85 c0                	test   %eax,%eax
+  803d41:	78 11                	js     803d54 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803d43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d46:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803d4c:	39 10                	cmp    %edx,(%eax)
+  803d4e:	0f 94 c0             	sete   %al
+  803d51:	0f b6 c0             	movzbl %al,%eax
+}
+  803d54:	c9                   	leave
+  803d55:	c3                   	ret
+
+00803d56 <opencons>:
+{
+  803d56:	55                   	push   %ebp
+  803d57:	89 e5                	mov    %esp,%ebp
+  803d59:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803d5c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d5f:	50                   	push   %eax
+  803d60:	e8 af e0 ff ff       	call   801e14 <fd_alloc>
+  803d65:	83 c4 10             	add    $0x10,%esp
+  803d68:	85 c0                	test   %eax,%eax
+  803d6a:	78 3a                	js     803da6 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803d6c:	83 ec 04             	sub    $0x4,%esp
+  803d6f:	68 07 04 00 00       	push   $0x407
+  803d74:	ff 75 f4             	push   -0xc(%ebp)
+  803d77:	6a 00                	push   $0x0
+  803d79:	e8 76 d7 ff ff       	call   8014f4 <sys_page_alloc>
+  803d7e:	83 c4 10             	add    $0x10,%esp
+  803d81:	85 c0                	test   %eax,%eax
+  803d83:	78 21                	js     803da6 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803d85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d88:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803d8e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803d90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d93:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803d9a:	83 ec 0c             	sub    $0xc,%esp
+  803d9d:	50                   	push   %eax
+  803d9e:	e8 4a e0 ff ff       	call   801ded <fd2num>
+  803da3:	83 c4 10             	add    $0x10,%esp
+}
+  803da6:	c9                   	leave
+  803da7:	c3                   	ret
+
+00803da8 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803da8:	55                   	push   %ebp
+  803da9:	89 e5                	mov    %esp,%ebp
+  803dab:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803dae:	83 3d 04 a0 80 00 00 	cmpl   $0x0,0x80a004
+  803db5:	74 0a                	je     803dc1 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803db7:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dba:	a3 04 a0 80 00       	mov    %eax,0x80a004
+}
+  803dbf:	c9                   	leave
+  803dc0:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803dc1:	83 ec 04             	sub    $0x4,%esp
+  803dc4:	6a 07                	push   $0x7
+  803dc6:	68 00 f0 bf ee       	push   $0xeebff000
+  803dcb:	6a 00                	push   $0x0
+  803dcd:	e8 22 d7 ff ff       	call   8014f4 <sys_page_alloc>
+  803dd2:	83 c4 10             	add    $0x10,%esp
+  803dd5:	85 c0                	test   %eax,%eax
+  803dd7:	75 2c                	jne    803e05 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803dd9:	83 ec 08             	sub    $0x8,%esp
+  803ddc:	68 1b 3e 80 00       	push   $0x803e1b
+  803de1:	6a 00                	push   $0x0
+  803de3:	e8 77 d8 ff ff       	call   80165f <sys_env_set_pgfault_upcall>
+  803de8:	83 c4 10             	add    $0x10,%esp
+  803deb:	85 c0                	test   %eax,%eax
+  803ded:	74 c8                	je     803db7 <set_pgfault_handler+0xf>
+  803def:	68 88 48 80 00       	push   $0x804888
+  803df4:	68 2c 42 80 00       	push   $0x80422c
+  803df9:	6a 20                	push   $0x20
+  803dfb:	68 b8 48 80 00       	push   $0x8048b8
+  803e00:	e8 1a cc ff ff       	call   800a1f <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803e05:	68 40 48 80 00       	push   $0x804840
+  803e0a:	68 2c 42 80 00       	push   $0x80422c
+  803e0f:	6a 1e                	push   $0x1e
+  803e11:	68 b8 48 80 00       	push   $0x8048b8
+  803e16:	e8 04 cc ff ff       	call   800a1f <_panic>
+
+00803e1b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803e1b:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803e1c:	a1 04 a0 80 00       	mov    0x80a004,%eax
+	call *%eax
+  803e21:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803e23:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803e26:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803e2b:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803e30:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803e34:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803e37:	83 c4 08             	add    $0x8,%esp
+	popal
+  803e3a:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803e3b:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803e3e:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803e3f:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803e40:	c3                   	ret
+
+00803e41 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803e41:	55                   	push   %ebp
+  803e42:	89 e5                	mov    %esp,%ebp
+  803e44:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803e47:	89 c2                	mov    %eax,%edx
+  803e49:	c1 ea 16             	shr    $0x16,%edx
+  803e4c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803e53:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803e58:	f6 c1 01             	test   $0x1,%cl
+  803e5b:	74 22                	je     803e7f <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803e5d:	c1 e8 0c             	shr    $0xc,%eax
+  803e60:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803e67:	a8 01                	test   $0x1,%al
+  803e69:	74 14                	je     803e7f <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803e6b:	c1 e8 0c             	shr    $0xc,%eax
+  803e6e:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803e71:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803e78:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803e7c:	0f b7 d2             	movzwl %dx,%edx
+}
+  803e7f:	89 d0                	mov    %edx,%eax
+  803e81:	5d                   	pop    %ebp
+  803e82:	c3                   	ret
+
+00803e83 <dm>:
+  803e83:	55                   	push   %ebp
+  803e84:	57                   	push   %edi
+  803e85:	56                   	push   %esi
+  803e86:	53                   	push   %ebx
+  803e87:	83 ec 24             	sub    $0x24,%esp
+  803e8a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803e8e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803e92:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803e96:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803e9a:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803e9e:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803ea2:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803ea6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803eab:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  803eb5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803ebc:	00 
+  803ebd:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803ec4:	00 
+  803ec5:	89 fb                	mov    %edi,%ebx
+  803ec7:	eb 08                	jmp    803ed1 <dm+0x4e>
+  803ec9:	83 e9 01             	sub    $0x1,%ecx
+  803ecc:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803ecf:	74 68                	je     803f39 <dm+0xb6>
+  803ed1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803ed5:	01 c0                	add    %eax,%eax
+  803ed7:	89 c6                	mov    %eax,%esi
+  803ed9:	89 d7                	mov    %edx,%edi
+  803edb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803edf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803ee3:	0f ad d0             	shrd   %cl,%edx,%eax
+  803ee6:	d3 ea                	shr    %cl,%edx
+  803ee8:	f6 c1 20             	test   $0x20,%cl
+  803eeb:	74 04                	je     803ef1 <dm+0x6e>
+  803eed:	89 d0                	mov    %edx,%eax
+  803eef:	31 d2                	xor    %edx,%edx
+  803ef1:	83 e0 01             	and    $0x1,%eax
+  803ef4:	89 04 24             	mov    %eax,(%esp)
+  803ef7:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803efe:	00 
+  803eff:	8b 04 24             	mov    (%esp),%eax
+  803f02:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803f06:	09 f0                	or     %esi,%eax
+  803f08:	09 fa                	or     %edi,%edx
+  803f0a:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803f0e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803f12:	39 f0                	cmp    %esi,%eax
+  803f14:	89 d5                	mov    %edx,%ebp
+  803f16:	19 fd                	sbb    %edi,%ebp
+  803f18:	72 af                	jb     803ec9 <dm+0x46>
+  803f1a:	29 f0                	sub    %esi,%eax
+  803f1c:	19 fa                	sbb    %edi,%edx
+  803f1e:	89 cf                	mov    %ecx,%edi
+  803f20:	c1 ef 05             	shr    $0x5,%edi
+  803f23:	83 e7 01             	and    $0x1,%edi
+  803f26:	89 fe                	mov    %edi,%esi
+  803f28:	83 f6 01             	xor    $0x1,%esi
+  803f2b:	d3 e6                	shl    %cl,%esi
+  803f2d:	d3 e7                	shl    %cl,%edi
+  803f2f:	09 74 24 18          	or     %esi,0x18(%esp)
+  803f33:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803f37:	eb 90                	jmp    803ec9 <dm+0x46>
+  803f39:	85 db                	test   %ebx,%ebx
+  803f3b:	74 05                	je     803f42 <dm+0xbf>
+  803f3d:	89 03                	mov    %eax,(%ebx)
+  803f3f:	89 53 04             	mov    %edx,0x4(%ebx)
+  803f42:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f46:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f4a:	83 c4 24             	add    $0x24,%esp
+  803f4d:	5b                   	pop    %ebx
+  803f4e:	5e                   	pop    %esi
+  803f4f:	5f                   	pop    %edi
+  803f50:	5d                   	pop    %ebp
+  803f51:	c3                   	ret
+
+00803f52 <__udivdi3>:
+  803f52:	83 ec 08             	sub    $0x8,%esp
+  803f55:	6a 00                	push   $0x0
+  803f57:	ff 74 24 1c          	push   0x1c(%esp)
+  803f5b:	ff 74 24 1c          	push   0x1c(%esp)
+  803f5f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f63:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f67:	e8 17 ff ff ff       	call   803e83 <dm>
+  803f6c:	83 c4 14             	add    $0x14,%esp
+  803f6f:	c3                   	ret
+
+00803f70 <__umoddi3>:
+  803f70:	83 ec 18             	sub    $0x18,%esp
+  803f73:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803f77:	50                   	push   %eax
+  803f78:	ff 74 24 2c          	push   0x2c(%esp)
+  803f7c:	ff 74 24 2c          	push   0x2c(%esp)
+  803f80:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803f84:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803f88:	e8 f6 fe ff ff       	call   803e83 <dm>
+  803f8d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f91:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f95:	83 c4 24             	add    $0x24,%esp
+  803f98:	c3                   	ret
+
+00803f99 <__divdi3>:
+  803f99:	53                   	push   %ebx
+  803f9a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803f9e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803fa2:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803fa6:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803faa:	85 d2                	test   %edx,%edx
+  803fac:	78 15                	js     803fc3 <__divdi3+0x2a>
+  803fae:	85 db                	test   %ebx,%ebx
+  803fb0:	78 34                	js     803fe6 <__divdi3+0x4d>
+  803fb2:	83 ec 04             	sub    $0x4,%esp
+  803fb5:	6a 00                	push   $0x0
+  803fb7:	53                   	push   %ebx
+  803fb8:	51                   	push   %ecx
+  803fb9:	e8 c5 fe ff ff       	call   803e83 <dm>
+  803fbe:	83 c4 10             	add    $0x10,%esp
+  803fc1:	eb 21                	jmp    803fe4 <__divdi3+0x4b>
+  803fc3:	f7 d8                	neg    %eax
+  803fc5:	83 d2 00             	adc    $0x0,%edx
+  803fc8:	f7 da                	neg    %edx
+  803fca:	85 db                	test   %ebx,%ebx
+  803fcc:	78 30                	js     803ffe <__divdi3+0x65>
+  803fce:	83 ec 04             	sub    $0x4,%esp
+  803fd1:	6a 00                	push   $0x0
+  803fd3:	53                   	push   %ebx
+  803fd4:	51                   	push   %ecx
+  803fd5:	e8 a9 fe ff ff       	call   803e83 <dm>
+  803fda:	83 c4 10             	add    $0x10,%esp
+  803fdd:	f7 d8                	neg    %eax
+  803fdf:	83 d2 00             	adc    $0x0,%edx
+  803fe2:	f7 da                	neg    %edx
+  803fe4:	5b                   	pop    %ebx
+  803fe5:	c3                   	ret
+  803fe6:	83 ec 04             	sub    $0x4,%esp
+  803fe9:	6a 00                	push   $0x0
+  803feb:	f7 d9                	neg    %ecx
+  803fed:	83 d3 00             	adc    $0x0,%ebx
+  803ff0:	f7 db                	neg    %ebx
+  803ff2:	53                   	push   %ebx
+  803ff3:	51                   	push   %ecx
+  803ff4:	e8 8a fe ff ff       	call   803e83 <dm>
+  803ff9:	83 c4 10             	add    $0x10,%esp
+  803ffc:	eb df                	jmp    803fdd <__divdi3+0x44>
+  803ffe:	83 ec 04             	sub    $0x4,%esp
+  804001:	6a 00                	push   $0x0
+  804003:	f7 d9                	neg    %ecx
+  804005:	83 d3 00             	adc    $0x0,%ebx
+  804008:	f7 db                	neg    %ebx
+  80400a:	53                   	push   %ebx
+  80400b:	51                   	push   %ecx
+  80400c:	e8 72 fe ff ff       	call   803e83 <dm>
+  804011:	83 c4 10             	add    $0x10,%esp
+  804014:	eb ce                	jmp    803fe4 <__divdi3+0x4b>
+
+00804016 <__moddi3>:
+  804016:	55                   	push   %ebp
+  804017:	57                   	push   %edi
+  804018:	56                   	push   %esi
+  804019:	53                   	push   %ebx
+  80401a:	83 ec 24             	sub    $0x24,%esp
+  80401d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804021:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804025:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804029:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80402d:	85 d2                	test   %edx,%edx
+  80402f:	78 3b                	js     80406c <__moddi3+0x56>
+  804031:	83 ec 04             	sub    $0x4,%esp
+  804034:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804038:	56                   	push   %esi
+  804039:	89 ce                	mov    %ecx,%esi
+  80403b:	f7 de                	neg    %esi
+  80403d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804041:	89 de                	mov    %ebx,%esi
+  804043:	83 d6 00             	adc    $0x0,%esi
+  804046:	f7 de                	neg    %esi
+  804048:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80404c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804050:	0f 48 f1             	cmovs  %ecx,%esi
+  804053:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804058:	53                   	push   %ebx
+  804059:	56                   	push   %esi
+  80405a:	e8 24 fe ff ff       	call   803e83 <dm>
+  80405f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804063:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804067:	83 c4 10             	add    $0x10,%esp
+  80406a:	eb 47                	jmp    8040b3 <__moddi3+0x9d>
+  80406c:	f7 d8                	neg    %eax
+  80406e:	83 d2 00             	adc    $0x0,%edx
+  804071:	f7 da                	neg    %edx
+  804073:	83 ec 04             	sub    $0x4,%esp
+  804076:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80407a:	56                   	push   %esi
+  80407b:	89 cf                	mov    %ecx,%edi
+  80407d:	f7 df                	neg    %edi
+  80407f:	89 de                	mov    %ebx,%esi
+  804081:	83 d6 00             	adc    $0x0,%esi
+  804084:	f7 de                	neg    %esi
+  804086:	0f 49 cf             	cmovns %edi,%ecx
+  804089:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80408d:	0f 49 de             	cmovns %esi,%ebx
+  804090:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804094:	ff 74 24 0c          	push   0xc(%esp)
+  804098:	ff 74 24 0c          	push   0xc(%esp)
+  80409c:	e8 e2 fd ff ff       	call   803e83 <dm>
+  8040a1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8040a5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8040a9:	f7 d8                	neg    %eax
+  8040ab:	83 d2 00             	adc    $0x0,%edx
+  8040ae:	f7 da                	neg    %edx
+  8040b0:	83 c4 10             	add    $0x10,%esp
+  8040b3:	83 c4 24             	add    $0x24,%esp
+  8040b6:	5b                   	pop    %ebx
+  8040b7:	5e                   	pop    %esi
+  8040b8:	5f                   	pop    %edi
+  8040b9:	5d                   	pop    %ebp
+  8040ba:	c3                   	ret
@@ -0,0 +1,8031 @@
+
+obj/net/testoutput:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8b 03 00 00       	call   8003bc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+static struct jif_pkt *pkt = (struct jif_pkt*)REQVA;
+
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	envid_t ns_envid = sys_getenvid();
+  800038:	e8 71 0e 00 00       	call   800eae <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+	int i, r;
+
+	binaryname = "testoutput";
+  80003f:	c7 05 00 50 80 00 c0 	movl   $0x803ac0,0x805000
+  800046:	3a 80 00 
+
+	output_envid = fork();
+  800049:	e8 01 14 00 00       	call   80144f <fork>
+  80004e:	a3 00 60 80 00       	mov    %eax,0x806000
+	if (output_envid < 0)
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 80 00 00 00    	js     8000db <umain+0xa8>
+	else if (output_envid == 0) {
+		output(ns_envid);
+		return;
+	}
+
+	for (i = 0; i < TESTOUTPUT_COUNT; i++) {
+  80005b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (output_envid == 0) {
+  800060:	0f 84 89 00 00 00    	je     8000ef <umain+0xbc>
+		if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
+  800066:	83 ec 04             	sub    $0x4,%esp
+  800069:	6a 07                	push   $0x7
+  80006b:	68 00 f0 eb 0f       	push   $0xfebf000
+  800070:	6a 00                	push   $0x0
+  800072:	e8 7d 0e 00 00       	call   800ef4 <sys_page_alloc>
+  800077:	83 c4 10             	add    $0x10,%esp
+  80007a:	85 c0                	test   %eax,%eax
+  80007c:	78 7f                	js     8000fd <umain+0xca>
+			panic("sys_page_alloc: %e", r);
+		pkt->jp_len = snprintf(pkt->jp_data,
+  80007e:	53                   	push   %ebx
+  80007f:	68 fd 3a 80 00       	push   $0x803afd
+  800084:	68 f8 0f 00 00       	push   $0xff8
+  800089:	68 08 f0 eb 0f       	push   $0xfebf008
+  80008e:	e8 00 0a 00 00       	call   800a93 <snprintf>
+  800093:	a3 00 f0 eb 0f       	mov    %eax,0xfebf000
+				       PGSIZE - sizeof(struct jif_pkt),
+				       "Packet %02d", i);
+		cprintf("Transmitting packet %d\n", i);
+  800098:	83 c4 08             	add    $0x8,%esp
+  80009b:	53                   	push   %ebx
+  80009c:	68 09 3b 80 00       	push   $0x803b09
+  8000a1:	e8 54 04 00 00       	call   8004fa <cprintf>
+		ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
+  8000a6:	6a 07                	push   $0x7
+  8000a8:	68 00 f0 eb 0f       	push   $0xfebf000
+  8000ad:	6a 0b                	push   $0xb
+  8000af:	ff 35 00 60 80 00    	push   0x806000
+  8000b5:	e8 bb 15 00 00       	call   801675 <ipc_send>
+		sys_page_unmap(0, pkt);
+  8000ba:	83 c4 18             	add    $0x18,%esp
+  8000bd:	68 00 f0 eb 0f       	push   $0xfebf000
+  8000c2:	6a 00                	push   $0x0
+  8000c4:	e8 b8 0e 00 00       	call   800f81 <sys_page_unmap>
+	for (i = 0; i < TESTOUTPUT_COUNT; i++) {
+  8000c9:	83 c3 01             	add    $0x1,%ebx
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	83 fb 0a             	cmp    $0xa,%ebx
+  8000d2:	75 92                	jne    800066 <umain+0x33>
+  8000d4:	bb 15 00 00 00       	mov    $0x15,%ebx
+  8000d9:	eb 39                	jmp    800114 <umain+0xe1>
+		panic("error forking");
+  8000db:	83 ec 04             	sub    $0x4,%esp
+  8000de:	68 cb 3a 80 00       	push   $0x803acb
+  8000e3:	6a 16                	push   $0x16
+  8000e5:	68 d9 3a 80 00       	push   $0x803ad9
+  8000ea:	e8 30 03 00 00       	call   80041f <_panic>
+		output(ns_envid);
+  8000ef:	83 ec 0c             	sub    $0xc,%esp
+  8000f2:	56                   	push   %esi
+  8000f3:	e8 36 01 00 00       	call   80022e <output>
+		return;
+  8000f8:	83 c4 10             	add    $0x10,%esp
+  8000fb:	eb 1c                	jmp    800119 <umain+0xe6>
+			panic("sys_page_alloc: %e", r);
+  8000fd:	50                   	push   %eax
+  8000fe:	68 ea 3a 80 00       	push   $0x803aea
+  800103:	6a 1e                	push   $0x1e
+  800105:	68 d9 3a 80 00       	push   $0x803ad9
+  80010a:	e8 10 03 00 00       	call   80041f <_panic>
+	}
+
+	// Spin for a while, just in case IPC's or packets need to be flushed
+	for (i = 0; i < TESTOUTPUT_COUNT*2; i++)
+		sys_yield();
+  80010f:	e8 c1 0d 00 00       	call   800ed5 <sys_yield>
+	for (i = 0; i < TESTOUTPUT_COUNT*2; i++)
+  800114:	83 eb 01             	sub    $0x1,%ebx
+  800117:	75 f6                	jne    80010f <umain+0xdc>
+}
+  800119:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011c:	5b                   	pop    %ebx
+  80011d:	5e                   	pop    %esi
+  80011e:	5d                   	pop    %ebp
+  80011f:	c3                   	ret
+
+00800120 <timer>:
+#include "ns.h"
+
+void
+timer(envid_t ns_envid, uint32_t initial_to) {
+  800120:	55                   	push   %ebp
+  800121:	89 e5                	mov    %esp,%ebp
+  800123:	57                   	push   %edi
+  800124:	56                   	push   %esi
+  800125:	53                   	push   %ebx
+  800126:	83 ec 1c             	sub    $0x1c,%esp
+  800129:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	uint32_t stop = sys_time_msec() + initial_to;
+  80012c:	e8 62 10 00 00       	call   801193 <sys_time_msec>
+  800131:	03 45 0c             	add    0xc(%ebp),%eax
+  800134:	89 c3                	mov    %eax,%ebx
+
+	binaryname = "ns_timer";
+  800136:	c7 05 00 50 80 00 21 	movl   $0x803b21,0x805000
+  80013d:	3b 80 00 
+
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+
+		while (1) {
+			uint32_t to, whom;
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  800140:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  800143:	eb 05                	jmp    80014a <timer+0x2a>
+			sys_yield();
+  800145:	e8 8b 0d 00 00       	call   800ed5 <sys_yield>
+		while((r = sys_time_msec()) < stop && r >= 0) {
+  80014a:	e8 44 10 00 00       	call   801193 <sys_time_msec>
+  80014f:	39 d8                	cmp    %ebx,%eax
+  800151:	73 16                	jae    800169 <timer+0x49>
+  800153:	85 c0                	test   %eax,%eax
+  800155:	79 ee                	jns    800145 <timer+0x25>
+			panic("sys_time_msec: %e", r);
+  800157:	50                   	push   %eax
+  800158:	68 2a 3b 80 00       	push   $0x803b2a
+  80015d:	6a 0f                	push   $0xf
+  80015f:	68 3c 3b 80 00       	push   $0x803b3c
+  800164:	e8 b6 02 00 00       	call   80041f <_panic>
+		if (r < 0)
+  800169:	85 c0                	test   %eax,%eax
+  80016b:	78 ea                	js     800157 <timer+0x37>
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+  80016d:	6a 00                	push   $0x0
+  80016f:	6a 00                	push   $0x0
+  800171:	6a 0c                	push   $0xc
+  800173:	56                   	push   %esi
+  800174:	e8 fc 14 00 00       	call   801675 <ipc_send>
+  800179:	83 c4 10             	add    $0x10,%esp
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  80017c:	83 ec 04             	sub    $0x4,%esp
+  80017f:	6a 00                	push   $0x0
+  800181:	6a 00                	push   $0x0
+  800183:	57                   	push   %edi
+  800184:	e8 81 14 00 00       	call   80160a <ipc_recv>
+  800189:	89 c3                	mov    %eax,%ebx
+
+			if (whom != ns_envid) {
+  80018b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80018e:	83 c4 10             	add    $0x10,%esp
+  800191:	39 f0                	cmp    %esi,%eax
+  800193:	75 09                	jne    80019e <timer+0x7e>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+				continue;
+			}
+
+			stop = sys_time_msec() + to;
+  800195:	e8 f9 0f 00 00       	call   801193 <sys_time_msec>
+  80019a:	01 c3                	add    %eax,%ebx
+			break;
+  80019c:	eb ac                	jmp    80014a <timer+0x2a>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+  80019e:	83 ec 08             	sub    $0x8,%esp
+  8001a1:	50                   	push   %eax
+  8001a2:	68 48 3b 80 00       	push   $0x803b48
+  8001a7:	e8 4e 03 00 00       	call   8004fa <cprintf>
+				continue;
+  8001ac:	83 c4 10             	add    $0x10,%esp
+  8001af:	eb cb                	jmp    80017c <timer+0x5c>
+
+008001b1 <input>:
+#include "ns.h"
+
+void
+input(envid_t ns_envid)
+{
+  8001b1:	55                   	push   %ebp
+  8001b2:	89 e5                	mov    %esp,%ebp
+  8001b4:	57                   	push   %edi
+  8001b5:	56                   	push   %esi
+  8001b6:	53                   	push   %ebx
+  8001b7:	83 ec 4c             	sub    $0x4c,%esp
+	uintptr_t pages[NSPKT_MAXPAGES];
+	int i, n;
+
+	binaryname = "ns_input";
+  8001ba:	c7 05 00 50 80 00 83 	movl   $0x803b83,0x805000
+  8001c1:	3b 80 00 
+				sys_net_wait(NET_WAIT_RX);
+			else
+				sys_yield();
+		for (i = 0; i < n; i++)
+			pages[i] = (PKTVA + i * PGSIZE) | PTE_U | PTE_P;
+		ipc_sendv(ns_envid, NSREQ_INPUT, pages, n);
+  8001c4:	8d 5d a8             	lea    -0x58(%ebp),%ebx
+  8001c7:	eb 3c                	jmp    800205 <input+0x54>
+				sys_yield();
+  8001c9:	e8 07 0d 00 00       	call   800ed5 <sys_yield>
+  8001ce:	eb 35                	jmp    800205 <input+0x54>
+  8001d0:	8d 55 a8             	lea    -0x58(%ebp),%edx
+  8001d3:	8d b8 af fe 00 00    	lea    0xfeaf(%eax),%edi
+  8001d9:	c1 e7 0c             	shl    $0xc,%edi
+		while ((n = sys_net_recv_pages((void *) PKTVA, NSPKT_MAXPAGES)) <= 0)
+  8001dc:	b8 00 f0 ea 0f       	mov    $0xfeaf000,%eax
+  8001e1:	eb 0f                	jmp    8001f2 <input+0x41>
+			pages[i] = (PKTVA + i * PGSIZE) | PTE_U | PTE_P;
+  8001e3:	89 c1                	mov    %eax,%ecx
+  8001e5:	83 c9 05             	or     $0x5,%ecx
+  8001e8:	89 0a                	mov    %ecx,(%edx)
+		for (i = 0; i < n; i++)
+  8001ea:	05 00 10 00 00       	add    $0x1000,%eax
+  8001ef:	83 c2 04             	add    $0x4,%edx
+  8001f2:	39 f8                	cmp    %edi,%eax
+  8001f4:	75 ed                	jne    8001e3 <input+0x32>
+		ipc_sendv(ns_envid, NSREQ_INPUT, pages, n);
+  8001f6:	56                   	push   %esi
+  8001f7:	53                   	push   %ebx
+  8001f8:	6a 0a                	push   $0xa
+  8001fa:	ff 75 08             	push   0x8(%ebp)
+  8001fd:	e8 5e 15 00 00       	call   801760 <ipc_sendv>
+		while ((n = sys_net_recv_pages((void *) PKTVA, NSPKT_MAXPAGES)) <= 0)
+  800202:	83 c4 10             	add    $0x10,%esp
+  800205:	83 ec 08             	sub    $0x8,%esp
+  800208:	6a 10                	push   $0x10
+  80020a:	68 00 f0 ea 0f       	push   $0xfeaf000
+  80020f:	e8 f7 0f 00 00       	call   80120b <sys_net_recv_pages>
+  800214:	89 c6                	mov    %eax,%esi
+  800216:	83 c4 10             	add    $0x10,%esp
+  800219:	85 c0                	test   %eax,%eax
+  80021b:	7f b3                	jg     8001d0 <input+0x1f>
+			if (n == 0)
+  80021d:	75 aa                	jne    8001c9 <input+0x18>
+				sys_net_wait(NET_WAIT_RX);
+  80021f:	83 ec 0c             	sub    $0xc,%esp
+  800222:	6a 01                	push   $0x1
+  800224:	e8 5c 10 00 00       	call   801285 <sys_net_wait>
+  800229:	83 c4 10             	add    $0x10,%esp
+  80022c:	eb d7                	jmp    800205 <input+0x54>
+
+0080022e <output>:
+#include "ns.h"
+
+void
+output(envid_t ns_envid)
+{
+  80022e:	55                   	push   %ebp
+  80022f:	89 e5                	mov    %esp,%ebp
+  800231:	57                   	push   %edi
+  800232:	56                   	push   %esi
+  800233:	53                   	push   %ebx
+  800234:	81 ec ac 00 00 00    	sub    $0xac,%esp
+	struct net_sg pkts[NSPKT_MAXPAGES];
+	struct jif_pkt *pkt;
+	int i, n, m, npkts, sent, r;
+
+	binaryname = "ns_output";
+  80023a:	c7 05 00 50 80 00 8c 	movl   $0x803b8c,0x805000
+  800241:	3b 80 00 
+	// ring takes.
+	while (true) {
+		envid_t whom;
+		int perm;
+
+		n = NSPKT_MAXPAGES;
+  800244:	c7 85 64 ff ff ff 10 	movl   $0x10,-0x9c(%ebp)
+  80024b:	00 00 00 
+		r = ipc_recvv(&whom, (void *) PKTVA, &n, &perm);
+  80024e:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+  800254:	50                   	push   %eax
+  800255:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+  80025b:	50                   	push   %eax
+  80025c:	68 00 f0 ea 0f       	push   $0xfeaf000
+  800261:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  800267:	50                   	push   %eax
+  800268:	e8 60 14 00 00       	call   8016cd <ipc_recvv>
+		assert(r == NSREQ_OUTPUT);
+  80026d:	83 c4 10             	add    $0x10,%esp
+  800270:	83 f8 0b             	cmp    $0xb,%eax
+  800273:	0f 85 99 00 00 00    	jne    800312 <output+0xe4>
+		assert(whom == ns_envid);
+  800279:	8b 45 08             	mov    0x8(%ebp),%eax
+  80027c:	39 85 5c ff ff ff    	cmp    %eax,-0xa4(%ebp)
+  800282:	0f 85 a0 00 00 00    	jne    800328 <output+0xfa>
+		assert(perm & PTE_P);
+  800288:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+  80028e:	83 e0 01             	and    $0x1,%eax
+  800291:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  800297:	0f 84 a1 00 00 00    	je     80033e <output+0x110>
+
+		for (i = npkts = 0; i < n; i += m) {
+  80029d:	8b bd 64 ff ff ff    	mov    -0x9c(%ebp),%edi
+  8002a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ad:	89 bd 54 ff ff ff    	mov    %edi,-0xac(%ebp)
+  8002b3:	39 95 54 ff ff ff    	cmp    %edx,-0xac(%ebp)
+  8002b9:	0f 8e a6 00 00 00    	jle    800365 <output+0x137>
+			pkt = (struct jif_pkt *) (PKTVA + i * PGSIZE);
+  8002bf:	8d 82 af fe 00 00    	lea    0xfeaf(%edx),%eax
+  8002c5:	c1 e0 0c             	shl    $0xc,%eax
+			if (pkt->jp_len <= 0 || pkt->jp_len > NET_FRAME_MAX
+  8002c8:	8b 30                	mov    (%eax),%esi
+  8002ca:	8d 4e ff             	lea    -0x1(%esi),%ecx
+  8002cd:	81 f9 39 23 00 00    	cmp    $0x2339,%ecx
+  8002d3:	77 7f                	ja     800354 <output+0x126>
+			    || (m = JIF_PKT_NPAGES(pkt->jp_len)) > n - i) {
+  8002d5:	8d 8e 07 10 00 00    	lea    0x1007(%esi),%ecx
+  8002db:	c1 e9 0c             	shr    $0xc,%ecx
+  8002de:	89 cf                	mov    %ecx,%edi
+  8002e0:	89 8d 50 ff ff ff    	mov    %ecx,-0xb0(%ebp)
+  8002e6:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  8002ec:	29 d1                	sub    %edx,%ecx
+  8002ee:	39 f9                	cmp    %edi,%ecx
+  8002f0:	7c 62                	jl     800354 <output+0x126>
+				cprintf("ns_output: bad packet, %d bytes\n",
+					pkt->jp_len);
+				break;
+			}
+			pkts[npkts].sg_va = pkt->jp_data;
+  8002f2:	8d 70 08             	lea    0x8(%eax),%esi
+  8002f5:	89 b4 dd 68 ff ff ff 	mov    %esi,-0x98(%ebp,%ebx,8)
+			pkts[npkts].sg_len = pkt->jp_len;
+  8002fc:	8b 00                	mov    (%eax),%eax
+  8002fe:	89 84 dd 6c ff ff ff 	mov    %eax,-0x94(%ebp,%ebx,8)
+			npkts++;
+  800305:	83 c3 01             	add    $0x1,%ebx
+		for (i = npkts = 0; i < n; i += m) {
+  800308:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  80030e:	01 c2                	add    %eax,%edx
+  800310:	eb a1                	jmp    8002b3 <output+0x85>
+		assert(r == NSREQ_OUTPUT);
+  800312:	68 96 3b 80 00       	push   $0x803b96
+  800317:	68 a8 3b 80 00       	push   $0x803ba8
+  80031c:	6a 18                	push   $0x18
+  80031e:	68 bd 3b 80 00       	push   $0x803bbd
+  800323:	e8 f7 00 00 00       	call   80041f <_panic>
+		assert(whom == ns_envid);
+  800328:	68 ca 3b 80 00       	push   $0x803bca
+  80032d:	68 a8 3b 80 00       	push   $0x803ba8
+  800332:	6a 19                	push   $0x19
+  800334:	68 bd 3b 80 00       	push   $0x803bbd
+  800339:	e8 e1 00 00 00       	call   80041f <_panic>
+		assert(perm & PTE_P);
+  80033e:	68 db 3b 80 00       	push   $0x803bdb
+  800343:	68 a8 3b 80 00       	push   $0x803ba8
+  800348:	6a 1a                	push   $0x1a
+  80034a:	68 bd 3b 80 00       	push   $0x803bbd
+  80034f:	e8 cb 00 00 00       	call   80041f <_panic>
+				cprintf("ns_output: bad packet, %d bytes\n",
+  800354:	83 ec 08             	sub    $0x8,%esp
+  800357:	56                   	push   %esi
+  800358:	68 e8 3b 80 00       	push   $0x803be8
+  80035d:	e8 98 01 00 00       	call   8004fa <cprintf>
+				break;
+  800362:	83 c4 10             	add    $0x10,%esp
+		}
+		for (i = 0; i < npkts; i += sent) {
+			sent = sys_net_send_batch(&pkts[i], npkts - i);
+			if (sent < 0) {
+				cprintf("ns_output: dropping packet: %e\n", sent);
+				sent = 1;
+  800365:	bf 00 00 00 00       	mov    $0x0,%edi
+  80036a:	eb 19                	jmp    800385 <output+0x157>
+				cprintf("ns_output: dropping packet: %e\n", sent);
+  80036c:	83 ec 08             	sub    $0x8,%esp
+  80036f:	50                   	push   %eax
+  800370:	68 0c 3c 80 00       	push   $0x803c0c
+  800375:	e8 80 01 00 00       	call   8004fa <cprintf>
+				sent = 1;
+  80037a:	83 c4 10             	add    $0x10,%esp
+  80037d:	8b b5 4c ff ff ff    	mov    -0xb4(%ebp),%esi
+		for (i = 0; i < npkts; i += sent) {
+  800383:	01 f7                	add    %esi,%edi
+  800385:	39 df                	cmp    %ebx,%edi
+  800387:	0f 8d b7 fe ff ff    	jge    800244 <output+0x16>
+			sent = sys_net_send_batch(&pkts[i], npkts - i);
+  80038d:	83 ec 08             	sub    $0x8,%esp
+  800390:	89 d8                	mov    %ebx,%eax
+  800392:	29 f8                	sub    %edi,%eax
+  800394:	50                   	push   %eax
+  800395:	8d 84 fd 68 ff ff ff 	lea    -0x98(%ebp,%edi,8),%eax
+  80039c:	50                   	push   %eax
+  80039d:	e8 92 0e 00 00       	call   801234 <sys_net_send_batch>
+  8003a2:	89 c6                	mov    %eax,%esi
+			if (sent < 0) {
+  8003a4:	83 c4 10             	add    $0x10,%esp
+  8003a7:	85 c0                	test   %eax,%eax
+  8003a9:	78 c1                	js     80036c <output+0x13e>
+			} else if (sent == 0)
+  8003ab:	75 d6                	jne    800383 <output+0x155>
+				sys_net_wait(NET_WAIT_TX);
+  8003ad:	83 ec 0c             	sub    $0xc,%esp
+  8003b0:	6a 02                	push   $0x2
+  8003b2:	e8 ce 0e 00 00       	call   801285 <sys_net_wait>
+  8003b7:	83 c4 10             	add    $0x10,%esp
+  8003ba:	eb c7                	jmp    800383 <output+0x155>
+
+008003bc <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8003bc:	55                   	push   %ebp
+  8003bd:	89 e5                	mov    %esp,%ebp
+  8003bf:	56                   	push   %esi
+  8003c0:	53                   	push   %ebx
+  8003c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003c4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8003c7:	e8 e2 0a 00 00       	call   800eae <sys_getenvid>
+  8003cc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003d1:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8003d7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003dc:	a3 04 60 80 00       	mov    %eax,0x806004
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003e1:	85 db                	test   %ebx,%ebx
+  8003e3:	7e 07                	jle    8003ec <libmain+0x30>
+		binaryname = argv[0];
+  8003e5:	8b 06                	mov    (%esi),%eax
+  8003e7:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8003ec:	83 ec 08             	sub    $0x8,%esp
+  8003ef:	56                   	push   %esi
+  8003f0:	53                   	push   %ebx
+  8003f1:	e8 3d fc ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8003f6:	e8 0a 00 00 00       	call   800405 <exit>
+}
+  8003fb:	83 c4 10             	add    $0x10,%esp
+  8003fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800401:	5b                   	pop    %ebx
+  800402:	5e                   	pop    %esi
+  800403:	5d                   	pop    %ebp
+  800404:	c3                   	ret
+
+00800405 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800405:	55                   	push   %ebp
+  800406:	89 e5                	mov    %esp,%ebp
+  800408:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80040b:	e8 b1 15 00 00       	call   8019c1 <close_all>
+	sys_env_destroy(0);
+  800410:	83 ec 0c             	sub    $0xc,%esp
+  800413:	6a 00                	push   $0x0
+  800415:	e8 4b 0a 00 00       	call   800e65 <sys_env_destroy>
+}
+  80041a:	83 c4 10             	add    $0x10,%esp
+  80041d:	c9                   	leave
+  80041e:	c3                   	ret
+
+0080041f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80041f:	55                   	push   %ebp
+  800420:	89 e5                	mov    %esp,%ebp
+  800422:	56                   	push   %esi
+  800423:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800424:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800427:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80042d:	e8 7c 0a 00 00       	call   800eae <sys_getenvid>
+  800432:	83 ec 0c             	sub    $0xc,%esp
+  800435:	ff 75 0c             	push   0xc(%ebp)
+  800438:	ff 75 08             	push   0x8(%ebp)
+  80043b:	56                   	push   %esi
+  80043c:	50                   	push   %eax
+  80043d:	68 38 3c 80 00       	push   $0x803c38
+  800442:	e8 b3 00 00 00       	call   8004fa <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800447:	83 c4 18             	add    $0x18,%esp
+  80044a:	53                   	push   %ebx
+  80044b:	ff 75 10             	push   0x10(%ebp)
+  80044e:	e8 56 00 00 00       	call   8004a9 <vcprintf>
+	cprintf("\n");
+  800453:	c7 04 24 1f 3b 80 00 	movl   $0x803b1f,(%esp)
+  80045a:	e8 9b 00 00 00       	call   8004fa <cprintf>
+  80045f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800462:	cc                   	int3
+	while (1)
+  800463:	eb fd                	jmp    800462 <_panic+0x43>
+
+00800465 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800465:	55                   	push   %ebp
+  800466:	89 e5                	mov    %esp,%ebp
+  800468:	53                   	push   %ebx
+  800469:	83 ec 04             	sub    $0x4,%esp
+  80046c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80046f:	8b 13                	mov    (%ebx),%edx
+  800471:	8d 42 01             	lea    0x1(%edx),%eax
+  800474:	89 03                	mov    %eax,(%ebx)
+  800476:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800479:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80047d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800482:	74 09                	je     80048d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800484:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800488:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80048b:	c9                   	leave
+  80048c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80048d:	83 ec 08             	sub    $0x8,%esp
+  800490:	68 ff 00 00 00       	push   $0xff
+  800495:	8d 43 08             	lea    0x8(%ebx),%eax
+  800498:	50                   	push   %eax
+  800499:	e8 7a 09 00 00       	call   800e18 <sys_cputs>
+		b->idx = 0;
+  80049e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004a4:	83 c4 10             	add    $0x10,%esp
+  8004a7:	eb db                	jmp    800484 <putch+0x1f>
+
+008004a9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004a9:	55                   	push   %ebp
+  8004aa:	89 e5                	mov    %esp,%ebp
+  8004ac:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8004b2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004b9:	00 00 00 
+	b.cnt = 0;
+  8004bc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004c3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8004c6:	ff 75 0c             	push   0xc(%ebp)
+  8004c9:	ff 75 08             	push   0x8(%ebp)
+  8004cc:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004d2:	50                   	push   %eax
+  8004d3:	68 65 04 80 00       	push   $0x800465
+  8004d8:	e8 14 01 00 00       	call   8005f1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004dd:	83 c4 08             	add    $0x8,%esp
+  8004e0:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004e6:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004ec:	50                   	push   %eax
+  8004ed:	e8 26 09 00 00       	call   800e18 <sys_cputs>
+
+	return b.cnt;
+}
+  8004f2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004f8:	c9                   	leave
+  8004f9:	c3                   	ret
+
+008004fa <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004fa:	55                   	push   %ebp
+  8004fb:	89 e5                	mov    %esp,%ebp
+  8004fd:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800500:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800503:	50                   	push   %eax
+  800504:	ff 75 08             	push   0x8(%ebp)
+  800507:	e8 9d ff ff ff       	call   8004a9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80050c:	c9                   	leave
+  80050d:	c3                   	ret
+
+0080050e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80050e:	55                   	push   %ebp
+  80050f:	89 e5                	mov    %esp,%ebp
+  800511:	57                   	push   %edi
+  800512:	56                   	push   %esi
+  800513:	53                   	push   %ebx
+  800514:	83 ec 1c             	sub    $0x1c,%esp
+  800517:	89 c7                	mov    %eax,%edi
+  800519:	89 d6                	mov    %edx,%esi
+  80051b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80051e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800521:	89 d1                	mov    %edx,%ecx
+  800523:	89 c2                	mov    %eax,%edx
+  800525:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800528:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80052b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80052e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800531:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800534:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80053b:	39 c2                	cmp    %eax,%edx
+  80053d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800540:	72 3e                	jb     800580 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800542:	83 ec 0c             	sub    $0xc,%esp
+  800545:	ff 75 18             	push   0x18(%ebp)
+  800548:	83 eb 01             	sub    $0x1,%ebx
+  80054b:	53                   	push   %ebx
+  80054c:	50                   	push   %eax
+  80054d:	83 ec 08             	sub    $0x8,%esp
+  800550:	ff 75 e4             	push   -0x1c(%ebp)
+  800553:	ff 75 e0             	push   -0x20(%ebp)
+  800556:	ff 75 dc             	push   -0x24(%ebp)
+  800559:	ff 75 d8             	push   -0x28(%ebp)
+  80055c:	e8 f1 33 00 00       	call   803952 <__udivdi3>
+  800561:	83 c4 18             	add    $0x18,%esp
+  800564:	52                   	push   %edx
+  800565:	50                   	push   %eax
+  800566:	89 f2                	mov    %esi,%edx
+  800568:	89 f8                	mov    %edi,%eax
+  80056a:	e8 9f ff ff ff       	call   80050e <printnum>
+  80056f:	83 c4 20             	add    $0x20,%esp
+  800572:	eb 13                	jmp    800587 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800574:	83 ec 08             	sub    $0x8,%esp
+  800577:	56                   	push   %esi
+  800578:	ff 75 18             	push   0x18(%ebp)
+  80057b:	ff d7                	call   *%edi
+  80057d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800580:	83 eb 01             	sub    $0x1,%ebx
+  800583:	85 db                	test   %ebx,%ebx
+  800585:	7f ed                	jg     800574 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800587:	83 ec 08             	sub    $0x8,%esp
+  80058a:	56                   	push   %esi
+  80058b:	83 ec 04             	sub    $0x4,%esp
+  80058e:	ff 75 e4             	push   -0x1c(%ebp)
+  800591:	ff 75 e0             	push   -0x20(%ebp)
+  800594:	ff 75 dc             	push   -0x24(%ebp)
+  800597:	ff 75 d8             	push   -0x28(%ebp)
+  80059a:	e8 d1 33 00 00       	call   803970 <__umoddi3>
+  80059f:	83 c4 14             	add    $0x14,%esp
+  8005a2:	0f be 80 5b 3c 80 00 	movsbl 0x803c5b(%eax),%eax
+  8005a9:	50                   	push   %eax
+  8005aa:	ff d7                	call   *%edi
+}
+  8005ac:	83 c4 10             	add    $0x10,%esp
+  8005af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005b2:	5b                   	pop    %ebx
+  8005b3:	5e                   	pop    %esi
+  8005b4:	5f                   	pop    %edi
+  8005b5:	5d                   	pop    %ebp
+  8005b6:	c3                   	ret
+
+008005b7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005b7:	55                   	push   %ebp
+  8005b8:	89 e5                	mov    %esp,%ebp
+  8005ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8005bd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8005c1:	8b 10                	mov    (%eax),%edx
+  8005c3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005c6:	73 0a                	jae    8005d2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005c8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005cb:	89 08                	mov    %ecx,(%eax)
+  8005cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005d0:	88 02                	mov    %al,(%edx)
+}
+  8005d2:	5d                   	pop    %ebp
+  8005d3:	c3                   	ret
+
+008005d4 <printfmt>:
+{
+  8005d4:	55                   	push   %ebp
+  8005d5:	89 e5                	mov    %esp,%ebp
+  8005d7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005da:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005dd:	50                   	push   %eax
+  8005de:	ff 75 10             	push   0x10(%ebp)
+  8005e1:	ff 75 0c             	push   0xc(%ebp)
+  8005e4:	ff 75 08             	push   0x8(%ebp)
+  8005e7:	e8 05 00 00 00       	call   8005f1 <vprintfmt>
+}
+  8005ec:	83 c4 10             	add    $0x10,%esp
+  8005ef:	c9                   	leave
+  8005f0:	c3                   	ret
+
+008005f1 <vprintfmt>:
+{
+  8005f1:	55                   	push   %ebp
+  8005f2:	89 e5                	mov    %esp,%ebp
+  8005f4:	57                   	push   %edi
+  8005f5:	56                   	push   %esi
+  8005f6:	53                   	push   %ebx
+  8005f7:	83 ec 2c             	sub    $0x2c,%esp
+  8005fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800600:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800603:	eb 0a                	jmp    80060f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800605:	83 ec 08             	sub    $0x8,%esp
+  800608:	53                   	push   %ebx
+  800609:	50                   	push   %eax
+  80060a:	ff d6                	call   *%esi
+  80060c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80060f:	83 c7 01             	add    $0x1,%edi
+  800612:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800616:	83 f8 25             	cmp    $0x25,%eax
+  800619:	74 0c                	je     800627 <vprintfmt+0x36>
+			if (ch == '\0')
+  80061b:	85 c0                	test   %eax,%eax
+  80061d:	75 e6                	jne    800605 <vprintfmt+0x14>
+}
+  80061f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800622:	5b                   	pop    %ebx
+  800623:	5e                   	pop    %esi
+  800624:	5f                   	pop    %edi
+  800625:	5d                   	pop    %ebp
+  800626:	c3                   	ret
+		padc = ' ';
+  800627:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80062b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800632:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800639:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800640:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800645:	8d 47 01             	lea    0x1(%edi),%eax
+  800648:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80064b:	0f b6 17             	movzbl (%edi),%edx
+  80064e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800651:	3c 55                	cmp    $0x55,%al
+  800653:	0f 87 cf 03 00 00    	ja     800a28 <vprintfmt+0x437>
+  800659:	0f b6 c0             	movzbl %al,%eax
+  80065c:	ff 24 85 c0 3d 80 00 	jmp    *0x803dc0(,%eax,4)
+  800663:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800666:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80066a:	eb d9                	jmp    800645 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80066c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80066f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800673:	eb d0                	jmp    800645 <vprintfmt+0x54>
+  800675:	0f b6 d2             	movzbl %dl,%edx
+  800678:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80067b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800680:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800683:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800686:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80068a:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80068d:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800690:	83 f9 09             	cmp    $0x9,%ecx
+  800693:	77 55                	ja     8006ea <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800695:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800698:	eb e9                	jmp    800683 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80069a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069d:	8b 00                	mov    (%eax),%eax
+  80069f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a8:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006ab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8006ae:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006b2:	79 91                	jns    800645 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8006b4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006b7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006ba:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8006c1:	eb 82                	jmp    800645 <vprintfmt+0x54>
+			if (width < 0)
+  8006c3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006c6:	85 d2                	test   %edx,%edx
+  8006c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006cd:	0f 49 c2             	cmovns %edx,%eax
+  8006d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006d6:	e9 6a ff ff ff       	jmp    800645 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006db:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8006de:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006e5:	e9 5b ff ff ff       	jmp    800645 <vprintfmt+0x54>
+  8006ea:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006ed:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006f0:	eb bc                	jmp    8006ae <vprintfmt+0xbd>
+			lflag++;
+  8006f2:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006f5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006f8:	e9 48 ff ff ff       	jmp    800645 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8006fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800700:	8d 78 04             	lea    0x4(%eax),%edi
+  800703:	83 ec 08             	sub    $0x8,%esp
+  800706:	53                   	push   %ebx
+  800707:	ff 30                	push   (%eax)
+  800709:	ff d6                	call   *%esi
+			break;
+  80070b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80070e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800711:	e9 b1 02 00 00       	jmp    8009c7 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80071c:	8b 10                	mov    (%eax),%edx
+  80071e:	89 d0                	mov    %edx,%eax
+  800720:	f7 d8                	neg    %eax
+  800722:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800725:	83 f8 11             	cmp    $0x11,%eax
+  800728:	7f 23                	jg     80074d <vprintfmt+0x15c>
+  80072a:	8b 14 85 20 3f 80 00 	mov    0x803f20(,%eax,4),%edx
+  800731:	85 d2                	test   %edx,%edx
+  800733:	74 18                	je     80074d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800735:	52                   	push   %edx
+  800736:	68 ba 3b 80 00       	push   $0x803bba
+  80073b:	53                   	push   %ebx
+  80073c:	56                   	push   %esi
+  80073d:	e8 92 fe ff ff       	call   8005d4 <printfmt>
+  800742:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800745:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800748:	e9 7a 02 00 00       	jmp    8009c7 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80074d:	50                   	push   %eax
+  80074e:	68 73 3c 80 00       	push   $0x803c73
+  800753:	53                   	push   %ebx
+  800754:	56                   	push   %esi
+  800755:	e8 7a fe ff ff       	call   8005d4 <printfmt>
+  80075a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80075d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800760:	e9 62 02 00 00       	jmp    8009c7 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800765:	8b 45 14             	mov    0x14(%ebp),%eax
+  800768:	83 c0 04             	add    $0x4,%eax
+  80076b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80076e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800771:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800773:	85 c9                	test   %ecx,%ecx
+  800775:	b8 6c 3c 80 00       	mov    $0x803c6c,%eax
+  80077a:	0f 45 c1             	cmovne %ecx,%eax
+  80077d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800780:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800784:	7e 06                	jle    80078c <vprintfmt+0x19b>
+  800786:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80078a:	75 0b                	jne    800797 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80078c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80078f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800792:	89 75 08             	mov    %esi,0x8(%ebp)
+  800795:	eb 5c                	jmp    8007f3 <vprintfmt+0x202>
+  800797:	83 ec 08             	sub    $0x8,%esp
+  80079a:	ff 75 d0             	push   -0x30(%ebp)
+  80079d:	ff 75 cc             	push   -0x34(%ebp)
+  8007a0:	e8 20 03 00 00       	call   800ac5 <strnlen>
+  8007a5:	89 c2                	mov    %eax,%edx
+  8007a7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007aa:	29 d0                	sub    %edx,%eax
+  8007ac:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8007af:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8007b3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007b6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8007b9:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007bb:	eb 0e                	jmp    8007cb <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8007bd:	83 ec 08             	sub    $0x8,%esp
+  8007c0:	53                   	push   %ebx
+  8007c1:	57                   	push   %edi
+  8007c2:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007c5:	83 ee 01             	sub    $0x1,%esi
+  8007c8:	83 c4 10             	add    $0x10,%esp
+  8007cb:	85 f6                	test   %esi,%esi
+  8007cd:	7f ee                	jg     8007bd <vprintfmt+0x1cc>
+  8007cf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007d5:	85 c0                	test   %eax,%eax
+  8007d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007dc:	0f 49 d0             	cmovns %eax,%edx
+  8007df:	29 d0                	sub    %edx,%eax
+  8007e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007e4:	eb a6                	jmp    80078c <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8007e6:	83 ec 08             	sub    $0x8,%esp
+  8007e9:	53                   	push   %ebx
+  8007ea:	52                   	push   %edx
+  8007eb:	ff 55 08             	call   *0x8(%ebp)
+  8007ee:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007f1:	89 f1                	mov    %esi,%ecx
+  8007f3:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007f6:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007fa:	0f be d0             	movsbl %al,%edx
+  8007fd:	85 d2                	test   %edx,%edx
+  8007ff:	74 28                	je     800829 <vprintfmt+0x238>
+  800801:	85 ff                	test   %edi,%edi
+  800803:	78 05                	js     80080a <vprintfmt+0x219>
+  800805:	83 ef 01             	sub    $0x1,%edi
+  800808:	78 30                	js     80083a <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80080a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80080e:	74 d6                	je     8007e6 <vprintfmt+0x1f5>
+  800810:	0f be c0             	movsbl %al,%eax
+  800813:	83 e8 20             	sub    $0x20,%eax
+  800816:	83 f8 5e             	cmp    $0x5e,%eax
+  800819:	76 cb                	jbe    8007e6 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80081b:	83 ec 08             	sub    $0x8,%esp
+  80081e:	53                   	push   %ebx
+  80081f:	6a 3f                	push   $0x3f
+  800821:	ff 55 08             	call   *0x8(%ebp)
+  800824:	83 c4 10             	add    $0x10,%esp
+  800827:	eb c8                	jmp    8007f1 <vprintfmt+0x200>
+  800829:	8b 75 08             	mov    0x8(%ebp),%esi
+  80082c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80082f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800832:	01 d0                	add    %edx,%eax
+  800834:	29 c8                	sub    %ecx,%eax
+  800836:	89 c7                	mov    %eax,%edi
+  800838:	eb 13                	jmp    80084d <vprintfmt+0x25c>
+  80083a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80083d:	eb ed                	jmp    80082c <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80083f:	83 ec 08             	sub    $0x8,%esp
+  800842:	53                   	push   %ebx
+  800843:	6a 20                	push   $0x20
+  800845:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800847:	83 ef 01             	sub    $0x1,%edi
+  80084a:	83 c4 10             	add    $0x10,%esp
+  80084d:	85 ff                	test   %edi,%edi
+  80084f:	7f ee                	jg     80083f <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800851:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800854:	89 45 14             	mov    %eax,0x14(%ebp)
+  800857:	e9 6b 01 00 00       	jmp    8009c7 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80085c:	83 f9 01             	cmp    $0x1,%ecx
+  80085f:	7f 1f                	jg     800880 <vprintfmt+0x28f>
+	else if (lflag)
+  800861:	85 c9                	test   %ecx,%ecx
+  800863:	74 67                	je     8008cc <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800865:	8b 45 14             	mov    0x14(%ebp),%eax
+  800868:	8b 00                	mov    (%eax),%eax
+  80086a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80086d:	89 c1                	mov    %eax,%ecx
+  80086f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800872:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800875:	8b 45 14             	mov    0x14(%ebp),%eax
+  800878:	8d 40 04             	lea    0x4(%eax),%eax
+  80087b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80087e:	eb 17                	jmp    800897 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800880:	8b 45 14             	mov    0x14(%ebp),%eax
+  800883:	8b 50 04             	mov    0x4(%eax),%edx
+  800886:	8b 00                	mov    (%eax),%eax
+  800888:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80088b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80088e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800891:	8d 40 08             	lea    0x8(%eax),%eax
+  800894:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800897:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80089a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80089d:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8008a2:	85 c9                	test   %ecx,%ecx
+  8008a4:	0f 89 03 01 00 00    	jns    8009ad <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8008aa:	83 ec 08             	sub    $0x8,%esp
+  8008ad:	53                   	push   %ebx
+  8008ae:	6a 2d                	push   $0x2d
+  8008b0:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8008b2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008b5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008b8:	f7 da                	neg    %edx
+  8008ba:	83 d1 00             	adc    $0x0,%ecx
+  8008bd:	f7 d9                	neg    %ecx
+  8008bf:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8008c2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8008c7:	e9 e1 00 00 00       	jmp    8009ad <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8008cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cf:	8b 00                	mov    (%eax),%eax
+  8008d1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008d4:	89 c1                	mov    %eax,%ecx
+  8008d6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008d9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008df:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008e5:	eb b0                	jmp    800897 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8008e7:	83 f9 01             	cmp    $0x1,%ecx
+  8008ea:	7f 1e                	jg     80090a <vprintfmt+0x319>
+	else if (lflag)
+  8008ec:	85 c9                	test   %ecx,%ecx
+  8008ee:	74 32                	je     800922 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8008f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f3:	8b 10                	mov    (%eax),%edx
+  8008f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8008fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800900:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800905:	e9 a3 00 00 00       	jmp    8009ad <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80090a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090d:	8b 10                	mov    (%eax),%edx
+  80090f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800912:	8d 40 08             	lea    0x8(%eax),%eax
+  800915:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800918:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80091d:	e9 8b 00 00 00       	jmp    8009ad <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800922:	8b 45 14             	mov    0x14(%ebp),%eax
+  800925:	8b 10                	mov    (%eax),%edx
+  800927:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80092c:	8d 40 04             	lea    0x4(%eax),%eax
+  80092f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800932:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800937:	eb 74                	jmp    8009ad <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800939:	83 f9 01             	cmp    $0x1,%ecx
+  80093c:	7f 1b                	jg     800959 <vprintfmt+0x368>
+	else if (lflag)
+  80093e:	85 c9                	test   %ecx,%ecx
+  800940:	74 2c                	je     80096e <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800942:	8b 45 14             	mov    0x14(%ebp),%eax
+  800945:	8b 10                	mov    (%eax),%edx
+  800947:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094c:	8d 40 04             	lea    0x4(%eax),%eax
+  80094f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800952:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800957:	eb 54                	jmp    8009ad <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800959:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095c:	8b 10                	mov    (%eax),%edx
+  80095e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800961:	8d 40 08             	lea    0x8(%eax),%eax
+  800964:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800967:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80096c:	eb 3f                	jmp    8009ad <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80096e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800971:	8b 10                	mov    (%eax),%edx
+  800973:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800978:	8d 40 04             	lea    0x4(%eax),%eax
+  80097b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80097e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800983:	eb 28                	jmp    8009ad <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800985:	83 ec 08             	sub    $0x8,%esp
+  800988:	53                   	push   %ebx
+  800989:	6a 30                	push   $0x30
+  80098b:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80098d:	83 c4 08             	add    $0x8,%esp
+  800990:	53                   	push   %ebx
+  800991:	6a 78                	push   $0x78
+  800993:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800995:	8b 45 14             	mov    0x14(%ebp),%eax
+  800998:	8b 10                	mov    (%eax),%edx
+  80099a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80099f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8009a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009a8:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8009ad:	83 ec 0c             	sub    $0xc,%esp
+  8009b0:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8009b4:	50                   	push   %eax
+  8009b5:	ff 75 e0             	push   -0x20(%ebp)
+  8009b8:	57                   	push   %edi
+  8009b9:	51                   	push   %ecx
+  8009ba:	52                   	push   %edx
+  8009bb:	89 da                	mov    %ebx,%edx
+  8009bd:	89 f0                	mov    %esi,%eax
+  8009bf:	e8 4a fb ff ff       	call   80050e <printnum>
+			break;
+  8009c4:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8009c7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8009ca:	e9 40 fc ff ff       	jmp    80060f <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8009cf:	83 f9 01             	cmp    $0x1,%ecx
+  8009d2:	7f 1b                	jg     8009ef <vprintfmt+0x3fe>
+	else if (lflag)
+  8009d4:	85 c9                	test   %ecx,%ecx
+  8009d6:	74 2c                	je     800a04 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8009d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009db:	8b 10                	mov    (%eax),%edx
+  8009dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009e8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8009ed:	eb be                	jmp    8009ad <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f2:	8b 10                	mov    (%eax),%edx
+  8009f4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009f7:	8d 40 08             	lea    0x8(%eax),%eax
+  8009fa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009fd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800a02:	eb a9                	jmp    8009ad <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800a04:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a07:	8b 10                	mov    (%eax),%edx
+  800a09:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a0e:	8d 40 04             	lea    0x4(%eax),%eax
+  800a11:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a14:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800a19:	eb 92                	jmp    8009ad <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800a1b:	83 ec 08             	sub    $0x8,%esp
+  800a1e:	53                   	push   %ebx
+  800a1f:	6a 25                	push   $0x25
+  800a21:	ff d6                	call   *%esi
+			break;
+  800a23:	83 c4 10             	add    $0x10,%esp
+  800a26:	eb 9f                	jmp    8009c7 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800a28:	83 ec 08             	sub    $0x8,%esp
+  800a2b:	53                   	push   %ebx
+  800a2c:	6a 25                	push   $0x25
+  800a2e:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a30:	83 c4 10             	add    $0x10,%esp
+  800a33:	89 f8                	mov    %edi,%eax
+  800a35:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a39:	74 05                	je     800a40 <vprintfmt+0x44f>
+  800a3b:	83 e8 01             	sub    $0x1,%eax
+  800a3e:	eb f5                	jmp    800a35 <vprintfmt+0x444>
+  800a40:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a43:	eb 82                	jmp    8009c7 <vprintfmt+0x3d6>
+
+00800a45 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a45:	55                   	push   %ebp
+  800a46:	89 e5                	mov    %esp,%ebp
+  800a48:	83 ec 18             	sub    $0x18,%esp
+  800a4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a51:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a54:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a58:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a5b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a62:	85 c0                	test   %eax,%eax
+  800a64:	74 26                	je     800a8c <vsnprintf+0x47>
+  800a66:	85 d2                	test   %edx,%edx
+  800a68:	7e 22                	jle    800a8c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a6a:	ff 75 14             	push   0x14(%ebp)
+  800a6d:	ff 75 10             	push   0x10(%ebp)
+  800a70:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a73:	50                   	push   %eax
+  800a74:	68 b7 05 80 00       	push   $0x8005b7
+  800a79:	e8 73 fb ff ff       	call   8005f1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a7e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a81:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a87:	83 c4 10             	add    $0x10,%esp
+}
+  800a8a:	c9                   	leave
+  800a8b:	c3                   	ret
+		return -E_INVAL;
+  800a8c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a91:	eb f7                	jmp    800a8a <vsnprintf+0x45>
+
+00800a93 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a93:	55                   	push   %ebp
+  800a94:	89 e5                	mov    %esp,%ebp
+  800a96:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a99:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a9c:	50                   	push   %eax
+  800a9d:	ff 75 10             	push   0x10(%ebp)
+  800aa0:	ff 75 0c             	push   0xc(%ebp)
+  800aa3:	ff 75 08             	push   0x8(%ebp)
+  800aa6:	e8 9a ff ff ff       	call   800a45 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800aab:	c9                   	leave
+  800aac:	c3                   	ret
+
+00800aad <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800aad:	55                   	push   %ebp
+  800aae:	89 e5                	mov    %esp,%ebp
+  800ab0:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab8:	eb 03                	jmp    800abd <strlen+0x10>
+		n++;
+  800aba:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800abd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800ac1:	75 f7                	jne    800aba <strlen+0xd>
+	return n;
+}
+  800ac3:	5d                   	pop    %ebp
+  800ac4:	c3                   	ret
+
+00800ac5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800ac5:	55                   	push   %ebp
+  800ac6:	89 e5                	mov    %esp,%ebp
+  800ac8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800acb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ace:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad3:	eb 03                	jmp    800ad8 <strnlen+0x13>
+		n++;
+  800ad5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ad8:	39 d0                	cmp    %edx,%eax
+  800ada:	74 08                	je     800ae4 <strnlen+0x1f>
+  800adc:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ae0:	75 f3                	jne    800ad5 <strnlen+0x10>
+  800ae2:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800ae4:	89 d0                	mov    %edx,%eax
+  800ae6:	5d                   	pop    %ebp
+  800ae7:	c3                   	ret
+
+00800ae8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	53                   	push   %ebx
+  800aec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800af2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800afb:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800afe:	83 c0 01             	add    $0x1,%eax
+  800b01:	84 d2                	test   %dl,%dl
+  800b03:	75 f2                	jne    800af7 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b05:	89 c8                	mov    %ecx,%eax
+  800b07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b0a:	c9                   	leave
+  800b0b:	c3                   	ret
+
+00800b0c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b0c:	55                   	push   %ebp
+  800b0d:	89 e5                	mov    %esp,%ebp
+  800b0f:	53                   	push   %ebx
+  800b10:	83 ec 10             	sub    $0x10,%esp
+  800b13:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b16:	53                   	push   %ebx
+  800b17:	e8 91 ff ff ff       	call   800aad <strlen>
+  800b1c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b1f:	ff 75 0c             	push   0xc(%ebp)
+  800b22:	01 d8                	add    %ebx,%eax
+  800b24:	50                   	push   %eax
+  800b25:	e8 be ff ff ff       	call   800ae8 <strcpy>
+	return dst;
+}
+  800b2a:	89 d8                	mov    %ebx,%eax
+  800b2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b2f:	c9                   	leave
+  800b30:	c3                   	ret
+
+00800b31 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b31:	55                   	push   %ebp
+  800b32:	89 e5                	mov    %esp,%ebp
+  800b34:	56                   	push   %esi
+  800b35:	53                   	push   %ebx
+  800b36:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b39:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b3c:	89 f3                	mov    %esi,%ebx
+  800b3e:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b41:	89 f0                	mov    %esi,%eax
+  800b43:	eb 0f                	jmp    800b54 <strncpy+0x23>
+		*dst++ = *src;
+  800b45:	83 c0 01             	add    $0x1,%eax
+  800b48:	0f b6 0a             	movzbl (%edx),%ecx
+  800b4b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b4e:	80 f9 01             	cmp    $0x1,%cl
+  800b51:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b54:	39 d8                	cmp    %ebx,%eax
+  800b56:	75 ed                	jne    800b45 <strncpy+0x14>
+	}
+	return ret;
+}
+  800b58:	89 f0                	mov    %esi,%eax
+  800b5a:	5b                   	pop    %ebx
+  800b5b:	5e                   	pop    %esi
+  800b5c:	5d                   	pop    %ebp
+  800b5d:	c3                   	ret
+
+00800b5e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b5e:	55                   	push   %ebp
+  800b5f:	89 e5                	mov    %esp,%ebp
+  800b61:	56                   	push   %esi
+  800b62:	53                   	push   %ebx
+  800b63:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b69:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b6c:	89 f0                	mov    %esi,%eax
+  800b6e:	85 d2                	test   %edx,%edx
+  800b70:	74 21                	je     800b93 <strlcpy+0x35>
+  800b72:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b76:	89 f2                	mov    %esi,%edx
+  800b78:	eb 09                	jmp    800b83 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b7a:	83 c1 01             	add    $0x1,%ecx
+  800b7d:	83 c2 01             	add    $0x1,%edx
+  800b80:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b83:	39 c2                	cmp    %eax,%edx
+  800b85:	74 09                	je     800b90 <strlcpy+0x32>
+  800b87:	0f b6 19             	movzbl (%ecx),%ebx
+  800b8a:	84 db                	test   %bl,%bl
+  800b8c:	75 ec                	jne    800b7a <strlcpy+0x1c>
+  800b8e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b90:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b93:	29 f0                	sub    %esi,%eax
+}
+  800b95:	5b                   	pop    %ebx
+  800b96:	5e                   	pop    %esi
+  800b97:	5d                   	pop    %ebp
+  800b98:	c3                   	ret
+
+00800b99 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b99:	55                   	push   %ebp
+  800b9a:	89 e5                	mov    %esp,%ebp
+  800b9c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b9f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ba2:	eb 06                	jmp    800baa <strcmp+0x11>
+		p++, q++;
+  800ba4:	83 c1 01             	add    $0x1,%ecx
+  800ba7:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800baa:	0f b6 01             	movzbl (%ecx),%eax
+  800bad:	84 c0                	test   %al,%al
+  800baf:	74 04                	je     800bb5 <strcmp+0x1c>
+  800bb1:	3a 02                	cmp    (%edx),%al
+  800bb3:	74 ef                	je     800ba4 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bb5:	0f b6 c0             	movzbl %al,%eax
+  800bb8:	0f b6 12             	movzbl (%edx),%edx
+  800bbb:	29 d0                	sub    %edx,%eax
+}
+  800bbd:	5d                   	pop    %ebp
+  800bbe:	c3                   	ret
+
+00800bbf <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800bbf:	55                   	push   %ebp
+  800bc0:	89 e5                	mov    %esp,%ebp
+  800bc2:	53                   	push   %ebx
+  800bc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc9:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800bcc:	eb 09                	jmp    800bd7 <strncmp+0x18>
+		n--, p++, q++;
+  800bce:	83 ea 01             	sub    $0x1,%edx
+  800bd1:	83 c0 01             	add    $0x1,%eax
+  800bd4:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800bd7:	85 d2                	test   %edx,%edx
+  800bd9:	74 18                	je     800bf3 <strncmp+0x34>
+  800bdb:	0f b6 18             	movzbl (%eax),%ebx
+  800bde:	84 db                	test   %bl,%bl
+  800be0:	74 04                	je     800be6 <strncmp+0x27>
+  800be2:	3a 19                	cmp    (%ecx),%bl
+  800be4:	74 e8                	je     800bce <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800be6:	0f b6 00             	movzbl (%eax),%eax
+  800be9:	0f b6 11             	movzbl (%ecx),%edx
+  800bec:	29 d0                	sub    %edx,%eax
+}
+  800bee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bf1:	c9                   	leave
+  800bf2:	c3                   	ret
+		return 0;
+  800bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf8:	eb f4                	jmp    800bee <strncmp+0x2f>
+
+00800bfa <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bfa:	55                   	push   %ebp
+  800bfb:	89 e5                	mov    %esp,%ebp
+  800bfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c00:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c04:	eb 03                	jmp    800c09 <strchr+0xf>
+  800c06:	83 c0 01             	add    $0x1,%eax
+  800c09:	0f b6 10             	movzbl (%eax),%edx
+  800c0c:	84 d2                	test   %dl,%dl
+  800c0e:	74 06                	je     800c16 <strchr+0x1c>
+		if (*s == c)
+  800c10:	38 ca                	cmp    %cl,%dl
+  800c12:	75 f2                	jne    800c06 <strchr+0xc>
+  800c14:	eb 05                	jmp    800c1b <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800c16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c1b:	5d                   	pop    %ebp
+  800c1c:	c3                   	ret
+
+00800c1d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c1d:	55                   	push   %ebp
+  800c1e:	89 e5                	mov    %esp,%ebp
+  800c20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c23:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c27:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800c2a:	38 ca                	cmp    %cl,%dl
+  800c2c:	74 09                	je     800c37 <strfind+0x1a>
+  800c2e:	84 d2                	test   %dl,%dl
+  800c30:	74 05                	je     800c37 <strfind+0x1a>
+	for (; *s; s++)
+  800c32:	83 c0 01             	add    $0x1,%eax
+  800c35:	eb f0                	jmp    800c27 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c37:	5d                   	pop    %ebp
+  800c38:	c3                   	ret
+
+00800c39 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c39:	55                   	push   %ebp
+  800c3a:	89 e5                	mov    %esp,%ebp
+  800c3c:	57                   	push   %edi
+  800c3d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c40:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c43:	85 c9                	test   %ecx,%ecx
+  800c45:	74 20                	je     800c67 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c47:	89 f8                	mov    %edi,%eax
+  800c49:	09 c8                	or     %ecx,%eax
+  800c4b:	a8 03                	test   $0x3,%al
+  800c4d:	75 12                	jne    800c61 <memset+0x28>
+		c &= 0xFF;
+  800c4f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c53:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c59:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c5c:	fc                   	cld
+  800c5d:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c5f:	eb 06                	jmp    800c67 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c61:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c64:	fc                   	cld
+  800c65:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c67:	89 f8                	mov    %edi,%eax
+  800c69:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c6c:	c9                   	leave
+  800c6d:	c3                   	ret
+
+00800c6e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c6e:	55                   	push   %ebp
+  800c6f:	89 e5                	mov    %esp,%ebp
+  800c71:	57                   	push   %edi
+  800c72:	56                   	push   %esi
+  800c73:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c76:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c79:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c7c:	39 c6                	cmp    %eax,%esi
+  800c7e:	73 32                	jae    800cb2 <memmove+0x44>
+  800c80:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c83:	39 d0                	cmp    %edx,%eax
+  800c85:	73 2b                	jae    800cb2 <memmove+0x44>
+		s += n;
+		d += n;
+  800c87:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c8a:	89 d6                	mov    %edx,%esi
+  800c8c:	09 fe                	or     %edi,%esi
+  800c8e:	09 ce                	or     %ecx,%esi
+  800c90:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c96:	75 0e                	jne    800ca6 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c98:	83 ef 04             	sub    $0x4,%edi
+  800c9b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c9e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ca1:	fd                   	std
+  800ca2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ca4:	eb 09                	jmp    800caf <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ca6:	83 ef 01             	sub    $0x1,%edi
+  800ca9:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800cac:	fd                   	std
+  800cad:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800caf:	fc                   	cld
+  800cb0:	eb 1a                	jmp    800ccc <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800cb2:	89 f2                	mov    %esi,%edx
+  800cb4:	09 c2                	or     %eax,%edx
+  800cb6:	09 ca                	or     %ecx,%edx
+  800cb8:	f6 c2 03             	test   $0x3,%dl
+  800cbb:	75 0a                	jne    800cc7 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800cbd:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800cc0:	89 c7                	mov    %eax,%edi
+  800cc2:	fc                   	cld
+  800cc3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800cc5:	eb 05                	jmp    800ccc <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800cc7:	89 c7                	mov    %eax,%edi
+  800cc9:	fc                   	cld
+  800cca:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ccc:	5e                   	pop    %esi
+  800ccd:	5f                   	pop    %edi
+  800cce:	5d                   	pop    %ebp
+  800ccf:	c3                   	ret
+
+00800cd0 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800cd0:	55                   	push   %ebp
+  800cd1:	89 e5                	mov    %esp,%ebp
+  800cd3:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800cd6:	ff 75 10             	push   0x10(%ebp)
+  800cd9:	ff 75 0c             	push   0xc(%ebp)
+  800cdc:	ff 75 08             	push   0x8(%ebp)
+  800cdf:	e8 8a ff ff ff       	call   800c6e <memmove>
+}
+  800ce4:	c9                   	leave
+  800ce5:	c3                   	ret
+
+00800ce6 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ce6:	55                   	push   %ebp
+  800ce7:	89 e5                	mov    %esp,%ebp
+  800ce9:	56                   	push   %esi
+  800cea:	53                   	push   %ebx
+  800ceb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cee:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800cf1:	89 c6                	mov    %eax,%esi
+  800cf3:	03 75 10             	add    0x10(%ebp),%esi
+  800cf6:	eb 06                	jmp    800cfe <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cf8:	83 c0 01             	add    $0x1,%eax
+  800cfb:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800cfe:	39 f0                	cmp    %esi,%eax
+  800d00:	74 14                	je     800d16 <memcmp+0x30>
+		if (*s1 != *s2)
+  800d02:	0f b6 08             	movzbl (%eax),%ecx
+  800d05:	0f b6 1a             	movzbl (%edx),%ebx
+  800d08:	38 d9                	cmp    %bl,%cl
+  800d0a:	74 ec                	je     800cf8 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800d0c:	0f b6 c1             	movzbl %cl,%eax
+  800d0f:	0f b6 db             	movzbl %bl,%ebx
+  800d12:	29 d8                	sub    %ebx,%eax
+  800d14:	eb 05                	jmp    800d1b <memcmp+0x35>
+	}
+
+	return 0;
+  800d16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d1b:	5b                   	pop    %ebx
+  800d1c:	5e                   	pop    %esi
+  800d1d:	5d                   	pop    %ebp
+  800d1e:	c3                   	ret
+
+00800d1f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800d1f:	55                   	push   %ebp
+  800d20:	89 e5                	mov    %esp,%ebp
+  800d22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800d28:	89 c2                	mov    %eax,%edx
+  800d2a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800d2d:	eb 03                	jmp    800d32 <memfind+0x13>
+  800d2f:	83 c0 01             	add    $0x1,%eax
+  800d32:	39 d0                	cmp    %edx,%eax
+  800d34:	73 04                	jae    800d3a <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d36:	38 08                	cmp    %cl,(%eax)
+  800d38:	75 f5                	jne    800d2f <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d3a:	5d                   	pop    %ebp
+  800d3b:	c3                   	ret
+
+00800d3c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d3c:	55                   	push   %ebp
+  800d3d:	89 e5                	mov    %esp,%ebp
+  800d3f:	57                   	push   %edi
+  800d40:	56                   	push   %esi
+  800d41:	53                   	push   %ebx
+  800d42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d48:	eb 03                	jmp    800d4d <strtol+0x11>
+		s++;
+  800d4a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d4d:	0f b6 02             	movzbl (%edx),%eax
+  800d50:	3c 20                	cmp    $0x20,%al
+  800d52:	74 f6                	je     800d4a <strtol+0xe>
+  800d54:	3c 09                	cmp    $0x9,%al
+  800d56:	74 f2                	je     800d4a <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d58:	3c 2b                	cmp    $0x2b,%al
+  800d5a:	74 2a                	je     800d86 <strtol+0x4a>
+	int neg = 0;
+  800d5c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d61:	3c 2d                	cmp    $0x2d,%al
+  800d63:	74 2b                	je     800d90 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d65:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d6b:	75 0f                	jne    800d7c <strtol+0x40>
+  800d6d:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d70:	74 28                	je     800d9a <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d72:	85 db                	test   %ebx,%ebx
+  800d74:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d79:	0f 44 d8             	cmove  %eax,%ebx
+  800d7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d81:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d84:	eb 46                	jmp    800dcc <strtol+0x90>
+		s++;
+  800d86:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d89:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d8e:	eb d5                	jmp    800d65 <strtol+0x29>
+		s++, neg = 1;
+  800d90:	83 c2 01             	add    $0x1,%edx
+  800d93:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d98:	eb cb                	jmp    800d65 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d9a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d9e:	74 0e                	je     800dae <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800da0:	85 db                	test   %ebx,%ebx
+  800da2:	75 d8                	jne    800d7c <strtol+0x40>
+		s++, base = 8;
+  800da4:	83 c2 01             	add    $0x1,%edx
+  800da7:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800dac:	eb ce                	jmp    800d7c <strtol+0x40>
+		s += 2, base = 16;
+  800dae:	83 c2 02             	add    $0x2,%edx
+  800db1:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800db6:	eb c4                	jmp    800d7c <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800db8:	0f be c0             	movsbl %al,%eax
+  800dbb:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800dbe:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800dc1:	7d 3a                	jge    800dfd <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800dc3:	83 c2 01             	add    $0x1,%edx
+  800dc6:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800dca:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800dcc:	0f b6 02             	movzbl (%edx),%eax
+  800dcf:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800dd2:	89 f3                	mov    %esi,%ebx
+  800dd4:	80 fb 09             	cmp    $0x9,%bl
+  800dd7:	76 df                	jbe    800db8 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800dd9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ddc:	89 f3                	mov    %esi,%ebx
+  800dde:	80 fb 19             	cmp    $0x19,%bl
+  800de1:	77 08                	ja     800deb <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800de3:	0f be c0             	movsbl %al,%eax
+  800de6:	83 e8 57             	sub    $0x57,%eax
+  800de9:	eb d3                	jmp    800dbe <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800deb:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800dee:	89 f3                	mov    %esi,%ebx
+  800df0:	80 fb 19             	cmp    $0x19,%bl
+  800df3:	77 08                	ja     800dfd <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800df5:	0f be c0             	movsbl %al,%eax
+  800df8:	83 e8 37             	sub    $0x37,%eax
+  800dfb:	eb c1                	jmp    800dbe <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dfd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e01:	74 05                	je     800e08 <strtol+0xcc>
+		*endptr = (char *) s;
+  800e03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e06:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800e08:	89 c8                	mov    %ecx,%eax
+  800e0a:	f7 d8                	neg    %eax
+  800e0c:	85 ff                	test   %edi,%edi
+  800e0e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800e11:	89 c8                	mov    %ecx,%eax
+  800e13:	5b                   	pop    %ebx
+  800e14:	5e                   	pop    %esi
+  800e15:	5f                   	pop    %edi
+  800e16:	5d                   	pop    %ebp
+  800e17:	c3                   	ret
+
+00800e18 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e18:	55                   	push   %ebp
+  800e19:	89 e5                	mov    %esp,%ebp
+  800e1b:	57                   	push   %edi
+  800e1c:	56                   	push   %esi
+  800e1d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e29:	89 c3                	mov    %eax,%ebx
+  800e2b:	89 c7                	mov    %eax,%edi
+  800e2d:	55                   	push   %ebp
+  800e2e:	89 e5                	mov    %esp,%ebp
+  800e30:	8d 35 38 0e 80 00    	lea    0x800e38,%esi
+  800e36:	0f 34                	sysenter
+  800e38:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800e39:	5b                   	pop    %ebx
+  800e3a:	5e                   	pop    %esi
+  800e3b:	5f                   	pop    %edi
+  800e3c:	5d                   	pop    %ebp
+  800e3d:	c3                   	ret
+
+00800e3e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e3e:	55                   	push   %ebp
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	57                   	push   %edi
+  800e42:	56                   	push   %esi
+  800e43:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e49:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e4e:	89 d1                	mov    %edx,%ecx
+  800e50:	89 d3                	mov    %edx,%ebx
+  800e52:	89 d7                	mov    %edx,%edi
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	8d 35 5f 0e 80 00    	lea    0x800e5f,%esi
+  800e5d:	0f 34                	sysenter
+  800e5f:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800e60:	5b                   	pop    %ebx
+  800e61:	5e                   	pop    %esi
+  800e62:	5f                   	pop    %edi
+  800e63:	5d                   	pop    %ebp
+  800e64:	c3                   	ret
+
+00800e65 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e65:	55                   	push   %ebp
+  800e66:	89 e5                	mov    %esp,%ebp
+  800e68:	57                   	push   %edi
+  800e69:	56                   	push   %esi
+  800e6a:	53                   	push   %ebx
+  800e6b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e76:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e7b:	89 cb                	mov    %ecx,%ebx
+  800e7d:	89 cf                	mov    %ecx,%edi
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	8d 35 8a 0e 80 00    	lea    0x800e8a,%esi
+  800e88:	0f 34                	sysenter
+  800e8a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e8b:	85 c0                	test   %eax,%eax
+  800e8d:	7f 08                	jg     800e97 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800e8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e92:	5b                   	pop    %ebx
+  800e93:	5e                   	pop    %esi
+  800e94:	5f                   	pop    %edi
+  800e95:	5d                   	pop    %ebp
+  800e96:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e97:	83 ec 0c             	sub    $0xc,%esp
+  800e9a:	50                   	push   %eax
+  800e9b:	6a 03                	push   $0x3
+  800e9d:	68 87 3f 80 00       	push   $0x803f87
+  800ea2:	6a 3d                	push   $0x3d
+  800ea4:	68 a4 3f 80 00       	push   $0x803fa4
+  800ea9:	e8 71 f5 ff ff       	call   80041f <_panic>
+
+00800eae <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800eae:	55                   	push   %ebp
+  800eaf:	89 e5                	mov    %esp,%ebp
+  800eb1:	57                   	push   %edi
+  800eb2:	56                   	push   %esi
+  800eb3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ebe:	89 d1                	mov    %edx,%ecx
+  800ec0:	89 d3                	mov    %edx,%ebx
+  800ec2:	89 d7                	mov    %edx,%edi
+  800ec4:	55                   	push   %ebp
+  800ec5:	89 e5                	mov    %esp,%ebp
+  800ec7:	8d 35 cf 0e 80 00    	lea    0x800ecf,%esi
+  800ecd:	0f 34                	sysenter
+  800ecf:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800ed0:	5b                   	pop    %ebx
+  800ed1:	5e                   	pop    %esi
+  800ed2:	5f                   	pop    %edi
+  800ed3:	5d                   	pop    %ebp
+  800ed4:	c3                   	ret
+
+00800ed5 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ed5:	55                   	push   %ebp
+  800ed6:	89 e5                	mov    %esp,%ebp
+  800ed8:	57                   	push   %edi
+  800ed9:	56                   	push   %esi
+  800eda:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800edb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ee5:	89 d1                	mov    %edx,%ecx
+  800ee7:	89 d3                	mov    %edx,%ebx
+  800ee9:	89 d7                	mov    %edx,%edi
+  800eeb:	89 d6                	mov    %edx,%esi
+  800eed:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800eef:	5b                   	pop    %ebx
+  800ef0:	5e                   	pop    %esi
+  800ef1:	5f                   	pop    %edi
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	c3                   	ret
+
+00800ef4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ef4:	55                   	push   %ebp
+  800ef5:	89 e5                	mov    %esp,%ebp
+  800ef7:	57                   	push   %edi
+  800ef8:	56                   	push   %esi
+  800ef9:	53                   	push   %ebx
+  800efa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800efd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f03:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f08:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f10:	55                   	push   %ebp
+  800f11:	89 e5                	mov    %esp,%ebp
+  800f13:	8d 35 1b 0f 80 00    	lea    0x800f1b,%esi
+  800f19:	0f 34                	sysenter
+  800f1b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f1c:	85 c0                	test   %eax,%eax
+  800f1e:	7f 08                	jg     800f28 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800f20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f23:	5b                   	pop    %ebx
+  800f24:	5e                   	pop    %esi
+  800f25:	5f                   	pop    %edi
+  800f26:	5d                   	pop    %ebp
+  800f27:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f28:	83 ec 0c             	sub    $0xc,%esp
+  800f2b:	50                   	push   %eax
+  800f2c:	6a 04                	push   $0x4
+  800f2e:	68 87 3f 80 00       	push   $0x803f87
+  800f33:	6a 3d                	push   $0x3d
+  800f35:	68 a4 3f 80 00       	push   $0x803fa4
+  800f3a:	e8 e0 f4 ff ff       	call   80041f <_panic>
+
+00800f3f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f3f:	55                   	push   %ebp
+  800f40:	89 e5                	mov    %esp,%ebp
+  800f42:	57                   	push   %edi
+  800f43:	56                   	push   %esi
+  800f44:	53                   	push   %ebx
+  800f45:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f56:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f59:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f5c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f5e:	85 c0                	test   %eax,%eax
+  800f60:	7f 08                	jg     800f6a <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f65:	5b                   	pop    %ebx
+  800f66:	5e                   	pop    %esi
+  800f67:	5f                   	pop    %edi
+  800f68:	5d                   	pop    %ebp
+  800f69:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6a:	83 ec 0c             	sub    $0xc,%esp
+  800f6d:	50                   	push   %eax
+  800f6e:	6a 05                	push   $0x5
+  800f70:	68 87 3f 80 00       	push   $0x803f87
+  800f75:	6a 23                	push   $0x23
+  800f77:	68 a4 3f 80 00       	push   $0x803fa4
+  800f7c:	e8 9e f4 ff ff       	call   80041f <_panic>
+
+00800f81 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f81:	55                   	push   %ebp
+  800f82:	89 e5                	mov    %esp,%ebp
+  800f84:	57                   	push   %edi
+  800f85:	56                   	push   %esi
+  800f86:	53                   	push   %ebx
+  800f87:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f95:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f9a:	89 df                	mov    %ebx,%edi
+  800f9c:	55                   	push   %ebp
+  800f9d:	89 e5                	mov    %esp,%ebp
+  800f9f:	8d 35 a7 0f 80 00    	lea    0x800fa7,%esi
+  800fa5:	0f 34                	sysenter
+  800fa7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800fa8:	85 c0                	test   %eax,%eax
+  800faa:	7f 08                	jg     800fb4 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800fac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800faf:	5b                   	pop    %ebx
+  800fb0:	5e                   	pop    %esi
+  800fb1:	5f                   	pop    %edi
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb4:	83 ec 0c             	sub    $0xc,%esp
+  800fb7:	50                   	push   %eax
+  800fb8:	6a 06                	push   $0x6
+  800fba:	68 87 3f 80 00       	push   $0x803f87
+  800fbf:	6a 3d                	push   $0x3d
+  800fc1:	68 a4 3f 80 00       	push   $0x803fa4
+  800fc6:	e8 54 f4 ff ff       	call   80041f <_panic>
+
+00800fcb <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800fcb:	55                   	push   %ebp
+  800fcc:	89 e5                	mov    %esp,%ebp
+  800fce:	57                   	push   %edi
+  800fcf:	56                   	push   %esi
+  800fd0:	53                   	push   %ebx
+  800fd1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800fd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fe4:	89 df                	mov    %ebx,%edi
+  800fe6:	55                   	push   %ebp
+  800fe7:	89 e5                	mov    %esp,%ebp
+  800fe9:	8d 35 f1 0f 80 00    	lea    0x800ff1,%esi
+  800fef:	0f 34                	sysenter
+  800ff1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ff2:	85 c0                	test   %eax,%eax
+  800ff4:	7f 08                	jg     800ffe <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800ff6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff9:	5b                   	pop    %ebx
+  800ffa:	5e                   	pop    %esi
+  800ffb:	5f                   	pop    %edi
+  800ffc:	5d                   	pop    %ebp
+  800ffd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ffe:	83 ec 0c             	sub    $0xc,%esp
+  801001:	50                   	push   %eax
+  801002:	6a 08                	push   $0x8
+  801004:	68 87 3f 80 00       	push   $0x803f87
+  801009:	6a 3d                	push   $0x3d
+  80100b:	68 a4 3f 80 00       	push   $0x803fa4
+  801010:	e8 0a f4 ff ff       	call   80041f <_panic>
+
+00801015 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801015:	55                   	push   %ebp
+  801016:	89 e5                	mov    %esp,%ebp
+  801018:	57                   	push   %edi
+  801019:	56                   	push   %esi
+  80101a:	53                   	push   %ebx
+  80101b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80101e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801023:	8b 55 08             	mov    0x8(%ebp),%edx
+  801026:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801029:	b8 09 00 00 00       	mov    $0x9,%eax
+  80102e:	89 df                	mov    %ebx,%edi
+  801030:	55                   	push   %ebp
+  801031:	89 e5                	mov    %esp,%ebp
+  801033:	8d 35 3b 10 80 00    	lea    0x80103b,%esi
+  801039:	0f 34                	sysenter
+  80103b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80103c:	85 c0                	test   %eax,%eax
+  80103e:	7f 08                	jg     801048 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  801040:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801043:	5b                   	pop    %ebx
+  801044:	5e                   	pop    %esi
+  801045:	5f                   	pop    %edi
+  801046:	5d                   	pop    %ebp
+  801047:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801048:	83 ec 0c             	sub    $0xc,%esp
+  80104b:	50                   	push   %eax
+  80104c:	6a 09                	push   $0x9
+  80104e:	68 87 3f 80 00       	push   $0x803f87
+  801053:	6a 3d                	push   $0x3d
+  801055:	68 a4 3f 80 00       	push   $0x803fa4
+  80105a:	e8 c0 f3 ff ff       	call   80041f <_panic>
+
+0080105f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80105f:	55                   	push   %ebp
+  801060:	89 e5                	mov    %esp,%ebp
+  801062:	57                   	push   %edi
+  801063:	56                   	push   %esi
+  801064:	53                   	push   %ebx
+  801065:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801068:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801070:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801073:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801078:	89 df                	mov    %ebx,%edi
+  80107a:	55                   	push   %ebp
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	8d 35 85 10 80 00    	lea    0x801085,%esi
+  801083:	0f 34                	sysenter
+  801085:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801086:	85 c0                	test   %eax,%eax
+  801088:	7f 08                	jg     801092 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  80108a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108d:	5b                   	pop    %ebx
+  80108e:	5e                   	pop    %esi
+  80108f:	5f                   	pop    %edi
+  801090:	5d                   	pop    %ebp
+  801091:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801092:	83 ec 0c             	sub    $0xc,%esp
+  801095:	50                   	push   %eax
+  801096:	6a 0a                	push   $0xa
+  801098:	68 87 3f 80 00       	push   $0x803f87
+  80109d:	6a 3d                	push   $0x3d
+  80109f:	68 a4 3f 80 00       	push   $0x803fa4
+  8010a4:	e8 76 f3 ff ff       	call   80041f <_panic>
+
+008010a9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010a9:	55                   	push   %ebp
+  8010aa:	89 e5                	mov    %esp,%ebp
+  8010ac:	57                   	push   %edi
+  8010ad:	56                   	push   %esi
+  8010ae:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010bd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	8d 35 cb 10 80 00    	lea    0x8010cb,%esi
+  8010c9:	0f 34                	sysenter
+  8010cb:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  8010cc:	5b                   	pop    %ebx
+  8010cd:	5e                   	pop    %esi
+  8010ce:	5f                   	pop    %edi
+  8010cf:	5d                   	pop    %ebp
+  8010d0:	c3                   	ret
+
+008010d1 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  8010d1:	55                   	push   %ebp
+  8010d2:	89 e5                	mov    %esp,%ebp
+  8010d4:	57                   	push   %edi
+  8010d5:	56                   	push   %esi
+  8010d6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010dd:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	8d 35 f3 10 80 00    	lea    0x8010f3,%esi
+  8010f1:	0f 34                	sysenter
+  8010f3:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  8010f4:	5b                   	pop    %ebx
+  8010f5:	5e                   	pop    %esi
+  8010f6:	5f                   	pop    %edi
+  8010f7:	5d                   	pop    %ebp
+  8010f8:	c3                   	ret
+
+008010f9 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  8010f9:	55                   	push   %ebp
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	57                   	push   %edi
+  8010fd:	56                   	push   %esi
+  8010fe:	53                   	push   %ebx
+  8010ff:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801102:	be 00 00 00 00       	mov    $0x0,%esi
+  801107:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801112:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801115:	89 f7                	mov    %esi,%edi
+  801117:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801119:	85 c0                	test   %eax,%eax
+  80111b:	7f 08                	jg     801125 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  80111d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801120:	5b                   	pop    %ebx
+  801121:	5e                   	pop    %esi
+  801122:	5f                   	pop    %edi
+  801123:	5d                   	pop    %ebp
+  801124:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801125:	83 ec 0c             	sub    $0xc,%esp
+  801128:	50                   	push   %eax
+  801129:	6a 0d                	push   $0xd
+  80112b:	68 87 3f 80 00       	push   $0x803f87
+  801130:	6a 23                	push   $0x23
+  801132:	68 a4 3f 80 00       	push   $0x803fa4
+  801137:	e8 e3 f2 ff ff       	call   80041f <_panic>
+
+0080113c <sys_ipc_recv>:
+{
+  80113c:	55                   	push   %ebp
+  80113d:	89 e5                	mov    %esp,%ebp
+  80113f:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  801142:	6a 00                	push   $0x0
+  801144:	6a 01                	push   $0x1
+  801146:	ff 75 08             	push   0x8(%ebp)
+  801149:	e8 ab ff ff ff       	call   8010f9 <sys_ipc_recvv>
+}
+  80114e:	c9                   	leave
+  80114f:	c3                   	ret
+
+00801150 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  801150:	55                   	push   %ebp
+  801151:	89 e5                	mov    %esp,%ebp
+  801153:	57                   	push   %edi
+  801154:	56                   	push   %esi
+  801155:	53                   	push   %ebx
+  801156:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801159:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801161:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801164:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801169:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80116c:	89 de                	mov    %ebx,%esi
+  80116e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801170:	85 c0                	test   %eax,%eax
+  801172:	7f 08                	jg     80117c <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  801174:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801177:	5b                   	pop    %ebx
+  801178:	5e                   	pop    %esi
+  801179:	5f                   	pop    %edi
+  80117a:	5d                   	pop    %ebp
+  80117b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80117c:	83 ec 0c             	sub    $0xc,%esp
+  80117f:	50                   	push   %eax
+  801180:	6a 0d                	push   $0xd
+  801182:	68 87 3f 80 00       	push   $0x803f87
+  801187:	6a 23                	push   $0x23
+  801189:	68 a4 3f 80 00       	push   $0x803fa4
+  80118e:	e8 8c f2 ff ff       	call   80041f <_panic>
+
+00801193 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801193:	55                   	push   %ebp
+  801194:	89 e5                	mov    %esp,%ebp
+  801196:	57                   	push   %edi
+  801197:	56                   	push   %esi
+  801198:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801199:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011a3:	89 d1                	mov    %edx,%ecx
+  8011a5:	89 d3                	mov    %edx,%ebx
+  8011a7:	89 d7                	mov    %edx,%edi
+  8011a9:	55                   	push   %ebp
+  8011aa:	89 e5                	mov    %esp,%ebp
+  8011ac:	8d 35 b4 11 80 00    	lea    0x8011b4,%esi
+  8011b2:	0f 34                	sysenter
+  8011b4:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  8011b5:	5b                   	pop    %ebx
+  8011b6:	5e                   	pop    %esi
+  8011b7:	5f                   	pop    %edi
+  8011b8:	5d                   	pop    %ebp
+  8011b9:	c3                   	ret
+
+008011ba <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  8011ba:	55                   	push   %ebp
+  8011bb:	89 e5                	mov    %esp,%ebp
+  8011bd:	57                   	push   %edi
+  8011be:	56                   	push   %esi
+  8011bf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011cb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011d0:	89 df                	mov    %ebx,%edi
+  8011d2:	55                   	push   %ebp
+  8011d3:	89 e5                	mov    %esp,%ebp
+  8011d5:	8d 35 dd 11 80 00    	lea    0x8011dd,%esi
+  8011db:	0f 34                	sysenter
+  8011dd:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  8011de:	5b                   	pop    %ebx
+  8011df:	5e                   	pop    %esi
+  8011e0:	5f                   	pop    %edi
+  8011e1:	5d                   	pop    %ebp
+  8011e2:	c3                   	ret
+
+008011e3 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  8011e3:	55                   	push   %ebp
+  8011e4:	89 e5                	mov    %esp,%ebp
+  8011e6:	57                   	push   %edi
+  8011e7:	56                   	push   %esi
+  8011e8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011f6:	89 cb                	mov    %ecx,%ebx
+  8011f8:	89 cf                	mov    %ecx,%edi
+  8011fa:	55                   	push   %ebp
+  8011fb:	89 e5                	mov    %esp,%ebp
+  8011fd:	8d 35 05 12 80 00    	lea    0x801205,%esi
+  801203:	0f 34                	sysenter
+  801205:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  801206:	5b                   	pop    %ebx
+  801207:	5e                   	pop    %esi
+  801208:	5f                   	pop    %edi
+  801209:	5d                   	pop    %ebp
+  80120a:	c3                   	ret
+
+0080120b <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  80120b:	55                   	push   %ebp
+  80120c:	89 e5                	mov    %esp,%ebp
+  80120e:	57                   	push   %edi
+  80120f:	56                   	push   %esi
+  801210:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801211:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801216:	8b 55 08             	mov    0x8(%ebp),%edx
+  801219:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801221:	89 df                	mov    %ebx,%edi
+  801223:	55                   	push   %ebp
+  801224:	89 e5                	mov    %esp,%ebp
+  801226:	8d 35 2e 12 80 00    	lea    0x80122e,%esi
+  80122c:	0f 34                	sysenter
+  80122e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  80122f:	5b                   	pop    %ebx
+  801230:	5e                   	pop    %esi
+  801231:	5f                   	pop    %edi
+  801232:	5d                   	pop    %ebp
+  801233:	c3                   	ret
+
+00801234 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  801234:	55                   	push   %ebp
+  801235:	89 e5                	mov    %esp,%ebp
+  801237:	57                   	push   %edi
+  801238:	56                   	push   %esi
+  801239:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80123a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801242:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801245:	b8 14 00 00 00       	mov    $0x14,%eax
+  80124a:	89 df                	mov    %ebx,%edi
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	8d 35 57 12 80 00    	lea    0x801257,%esi
+  801255:	0f 34                	sysenter
+  801257:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  801258:	5b                   	pop    %ebx
+  801259:	5e                   	pop    %esi
+  80125a:	5f                   	pop    %edi
+  80125b:	5d                   	pop    %ebp
+  80125c:	c3                   	ret
+
+0080125d <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  80125d:	55                   	push   %ebp
+  80125e:	89 e5                	mov    %esp,%ebp
+  801260:	57                   	push   %edi
+  801261:	56                   	push   %esi
+  801262:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801263:	8b 55 08             	mov    0x8(%ebp),%edx
+  801266:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801269:	b8 13 00 00 00       	mov    $0x13,%eax
+  80126e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801271:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801274:	55                   	push   %ebp
+  801275:	89 e5                	mov    %esp,%ebp
+  801277:	8d 35 7f 12 80 00    	lea    0x80127f,%esi
+  80127d:	0f 34                	sysenter
+  80127f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  801280:	5b                   	pop    %ebx
+  801281:	5e                   	pop    %esi
+  801282:	5f                   	pop    %edi
+  801283:	5d                   	pop    %ebp
+  801284:	c3                   	ret
+
+00801285 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801285:	55                   	push   %ebp
+  801286:	89 e5                	mov    %esp,%ebp
+  801288:	57                   	push   %edi
+  801289:	56                   	push   %esi
+  80128a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80128b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801290:	8b 55 08             	mov    0x8(%ebp),%edx
+  801293:	b8 11 00 00 00       	mov    $0x11,%eax
+  801298:	89 cb                	mov    %ecx,%ebx
+  80129a:	89 cf                	mov    %ecx,%edi
+  80129c:	89 ce                	mov    %ecx,%esi
+  80129e:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  8012a0:	5b                   	pop    %ebx
+  8012a1:	5e                   	pop    %esi
+  8012a2:	5f                   	pop    %edi
+  8012a3:	5d                   	pop    %ebp
+  8012a4:	c3                   	ret
+
+008012a5 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  8012a5:	55                   	push   %ebp
+  8012a6:	89 e5                	mov    %esp,%ebp
+  8012a8:	57                   	push   %edi
+  8012a9:	56                   	push   %esi
+  8012aa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b3:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012b8:	89 cb                	mov    %ecx,%ebx
+  8012ba:	89 cf                	mov    %ecx,%edi
+  8012bc:	55                   	push   %ebp
+  8012bd:	89 e5                	mov    %esp,%ebp
+  8012bf:	8d 35 c7 12 80 00    	lea    0x8012c7,%esi
+  8012c5:	0f 34                	sysenter
+  8012c7:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8012c8:	5b                   	pop    %ebx
+  8012c9:	5e                   	pop    %esi
+  8012ca:	5f                   	pop    %edi
+  8012cb:	5d                   	pop    %ebp
+  8012cc:	c3                   	ret
+
+008012cd <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8012cd:	55                   	push   %ebp
+  8012ce:	89 e5                	mov    %esp,%ebp
+  8012d0:	57                   	push   %edi
+  8012d1:	56                   	push   %esi
+  8012d2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012db:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012e0:	89 cb                	mov    %ecx,%ebx
+  8012e2:	89 cf                	mov    %ecx,%edi
+  8012e4:	55                   	push   %ebp
+  8012e5:	89 e5                	mov    %esp,%ebp
+  8012e7:	8d 35 ef 12 80 00    	lea    0x8012ef,%esi
+  8012ed:	0f 34                	sysenter
+  8012ef:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8012f0:	5b                   	pop    %ebx
+  8012f1:	5e                   	pop    %esi
+  8012f2:	5f                   	pop    %edi
+  8012f3:	5d                   	pop    %ebp
+  8012f4:	c3                   	ret
+
+008012f5 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  8012f5:	55                   	push   %ebp
+  8012f6:	89 e5                	mov    %esp,%ebp
+  8012f8:	57                   	push   %edi
+  8012f9:	56                   	push   %esi
+  8012fa:	53                   	push   %ebx
+  8012fb:	83 ec 20             	sub    $0x20,%esp
+  8012fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801301:	89 d7                	mov    %edx,%edi
+  801303:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  801305:	51                   	push   %ecx
+  801306:	68 00 f0 7f 00       	push   $0x7ff000
+  80130b:	6a 00                	push   $0x0
+  80130d:	e8 e2 fb ff ff       	call   800ef4 <sys_page_alloc>
+  801312:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801314:	83 c4 10             	add    $0x10,%esp
+  801317:	85 c0                	test   %eax,%eax
+  801319:	78 45                	js     801360 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  80131b:	83 ec 04             	sub    $0x4,%esp
+  80131e:	68 00 10 00 00       	push   $0x1000
+  801323:	57                   	push   %edi
+  801324:	68 00 f0 7f 00       	push   $0x7ff000
+  801329:	e8 40 f9 ff ff       	call   800c6e <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  80132e:	89 34 24             	mov    %esi,(%esp)
+  801331:	57                   	push   %edi
+  801332:	ff 75 e4             	push   -0x1c(%ebp)
+  801335:	68 00 f0 7f 00       	push   $0x7ff000
+  80133a:	6a 00                	push   $0x0
+  80133c:	e8 fe fb ff ff       	call   800f3f <sys_page_map>
+  801341:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801343:	83 c4 20             	add    $0x20,%esp
+  801346:	85 c0                	test   %eax,%eax
+  801348:	78 16                	js     801360 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80134a:	83 ec 08             	sub    $0x8,%esp
+  80134d:	68 00 f0 7f 00       	push   $0x7ff000
+  801352:	6a 00                	push   $0x0
+  801354:	e8 28 fc ff ff       	call   800f81 <sys_page_unmap>
+  801359:	83 c4 10             	add    $0x10,%esp
+  80135c:	85 c0                	test   %eax,%eax
+  80135e:	75 0a                	jne    80136a <copy_page_to+0x75>
+exit:
+	return r;
+}
+  801360:	89 d8                	mov    %ebx,%eax
+  801362:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801365:	5b                   	pop    %ebx
+  801366:	5e                   	pop    %esi
+  801367:	5f                   	pop    %edi
+  801368:	5d                   	pop    %ebp
+  801369:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80136a:	68 b4 3f 80 00       	push   $0x803fb4
+  80136f:	68 a8 3b 80 00       	push   $0x803ba8
+  801374:	6a 1b                	push   $0x1b
+  801376:	68 2c 40 80 00       	push   $0x80402c
+  80137b:	e8 9f f0 ff ff       	call   80041f <_panic>
+
+00801380 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801380:	55                   	push   %ebp
+  801381:	89 e5                	mov    %esp,%ebp
+  801383:	53                   	push   %ebx
+  801384:	83 ec 04             	sub    $0x4,%esp
+  801387:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  80138a:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80138c:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  801390:	74 21                	je     8013b3 <pgfault+0x33>
+  801392:	89 d0                	mov    %edx,%eax
+  801394:	c1 e8 16             	shr    $0x16,%eax
+  801397:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80139e:	a8 01                	test   $0x1,%al
+  8013a0:	74 11                	je     8013b3 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  8013a2:	89 d0                	mov    %edx,%eax
+  8013a4:	c1 e8 0c             	shr    $0xc,%eax
+  8013a7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013ae:	f6 c4 08             	test   $0x8,%ah
+  8013b1:	75 17                	jne    8013ca <pgfault+0x4a>
+		if (pgfault_next) {
+  8013b3:	a1 08 60 80 00       	mov    0x806008,%eax
+  8013b8:	85 c0                	test   %eax,%eax
+  8013ba:	74 27                	je     8013e3 <pgfault+0x63>
+			pgfault_next(utf);
+  8013bc:	83 ec 0c             	sub    $0xc,%esp
+  8013bf:	53                   	push   %ebx
+  8013c0:	ff d0                	call   *%eax
+			return;
+  8013c2:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8013c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013c8:	c9                   	leave
+  8013c9:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8013ca:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8013d0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8013d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013da:	e8 16 ff ff ff       	call   8012f5 <copy_page_to>
+  8013df:	85 c0                	test   %eax,%eax
+  8013e1:	79 e2                	jns    8013c5 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8013e3:	a1 04 60 80 00       	mov    0x806004,%eax
+  8013e8:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8013eb:	ff 73 28             	push   0x28(%ebx)
+  8013ee:	ff 33                	push   (%ebx)
+  8013f0:	50                   	push   %eax
+  8013f1:	68 d8 3f 80 00       	push   $0x803fd8
+  8013f6:	e8 ff f0 ff ff       	call   8004fa <cprintf>
+	sys_env_destroy(0);
+  8013fb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801402:	e8 5e fa ff ff       	call   800e65 <sys_env_destroy>
+  801407:	83 c4 10             	add    $0x10,%esp
+  80140a:	eb b9                	jmp    8013c5 <pgfault+0x45>
+
+0080140c <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  80140c:	55                   	push   %ebp
+  80140d:	89 e5                	mov    %esp,%ebp
+  80140f:	53                   	push   %ebx
+  801410:	83 ec 04             	sub    $0x4,%esp
+  801413:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  801416:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  80141b:	3d 80 13 80 00       	cmp    $0x801380,%eax
+  801420:	74 15                	je     801437 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  801422:	a3 08 60 80 00       	mov    %eax,0x806008
+		set_pgfault_handler(pgfault);
+  801427:	83 ec 0c             	sub    $0xc,%esp
+  80142a:	68 80 13 80 00       	push   $0x801380
+  80142f:	e8 74 23 00 00       	call   8037a8 <set_pgfault_handler>
+  801434:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801437:	83 ec 0c             	sub    $0xc,%esp
+  80143a:	68 05 08 00 00       	push   $0x805
+  80143f:	53                   	push   %ebx
+  801440:	6a 00                	push   $0x0
+  801442:	53                   	push   %ebx
+  801443:	6a 00                	push   $0x0
+  801445:	e8 f5 fa ff ff       	call   800f3f <sys_page_map>
+}
+  80144a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80144d:	c9                   	leave
+  80144e:	c3                   	ret
+
+0080144f <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80144f:	55                   	push   %ebp
+  801450:	89 e5                	mov    %esp,%ebp
+  801452:	57                   	push   %edi
+  801453:	56                   	push   %esi
+  801454:	53                   	push   %ebx
+  801455:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801458:	68 80 13 80 00       	push   $0x801380
+  80145d:	e8 46 23 00 00       	call   8037a8 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801462:	b8 07 00 00 00       	mov    $0x7,%eax
+  801467:	cd 30                	int    $0x30
+  801469:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80146c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  80146f:	83 c4 10             	add    $0x10,%esp
+  801472:	85 c0                	test   %eax,%eax
+  801474:	0f 88 6b 01 00 00    	js     8015e5 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80147a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  80147f:	75 37                	jne    8014b8 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801481:	e8 28 fa ff ff       	call   800eae <sys_getenvid>
+  801486:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80148b:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  801491:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801496:	a3 04 60 80 00       	mov    %eax,0x806004
+		return 0;
+  80149b:	e9 45 01 00 00       	jmp    8015e5 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8014a0:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8014a6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8014ac:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8014b2:	0f 87 ba 00 00 00    	ja     801572 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8014b8:	89 d8                	mov    %ebx,%eax
+  8014ba:	c1 e8 16             	shr    $0x16,%eax
+  8014bd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014c4:	a8 01                	test   $0x1,%al
+  8014c6:	74 d8                	je     8014a0 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8014c8:	89 d8                	mov    %ebx,%eax
+  8014ca:	c1 e8 0c             	shr    $0xc,%eax
+  8014cd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014d4:	f6 c2 01             	test   $0x1,%dl
+  8014d7:	74 cd                	je     8014a6 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8014d9:	89 da                	mov    %ebx,%edx
+  8014db:	80 e6 df             	and    $0xdf,%dh
+  8014de:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8014e4:	74 c0                	je     8014a6 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8014e6:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8014e8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014ef:	f6 c6 04             	test   $0x4,%dh
+  8014f2:	75 53                	jne    801547 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8014f4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8014fb:	f6 c6 08             	test   $0x8,%dh
+  8014fe:	75 0c                	jne    80150c <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  801500:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801507:	f6 c2 02             	test   $0x2,%dl
+  80150a:	74 3b                	je     801547 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80150c:	83 ec 0c             	sub    $0xc,%esp
+  80150f:	68 05 08 00 00       	push   $0x805
+  801514:	57                   	push   %edi
+  801515:	ff 75 e4             	push   -0x1c(%ebp)
+  801518:	57                   	push   %edi
+  801519:	6a 00                	push   $0x0
+  80151b:	e8 1f fa ff ff       	call   800f3f <sys_page_map>
+  801520:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801522:	83 c4 20             	add    $0x20,%esp
+  801525:	85 c0                	test   %eax,%eax
+  801527:	0f 88 a7 00 00 00    	js     8015d4 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80152d:	83 ec 0c             	sub    $0xc,%esp
+  801530:	68 05 08 00 00       	push   $0x805
+  801535:	57                   	push   %edi
+  801536:	6a 00                	push   $0x0
+  801538:	57                   	push   %edi
+  801539:	6a 00                	push   $0x0
+  80153b:	e8 ff f9 ff ff       	call   800f3f <sys_page_map>
+  801540:	89 c6                	mov    %eax,%esi
+	return r;
+  801542:	83 c4 20             	add    $0x20,%esp
+  801545:	eb 21                	jmp    801568 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  801547:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80154e:	83 ec 0c             	sub    $0xc,%esp
+  801551:	25 07 0e 00 00       	and    $0xe07,%eax
+  801556:	50                   	push   %eax
+  801557:	57                   	push   %edi
+  801558:	ff 75 e4             	push   -0x1c(%ebp)
+  80155b:	57                   	push   %edi
+  80155c:	6a 00                	push   $0x0
+  80155e:	e8 dc f9 ff ff       	call   800f3f <sys_page_map>
+  801563:	89 c6                	mov    %eax,%esi
+  801565:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  801568:	85 f6                	test   %esi,%esi
+  80156a:	0f 89 36 ff ff ff    	jns    8014a6 <fork+0x57>
+  801570:	eb 62                	jmp    8015d4 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801572:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801577:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  80157c:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80157f:	89 f8                	mov    %edi,%eax
+  801581:	e8 6f fd ff ff       	call   8012f5 <copy_page_to>
+  801586:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801588:	85 c0                	test   %eax,%eax
+  80158a:	78 48                	js     8015d4 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80158c:	83 ec 04             	sub    $0x4,%esp
+  80158f:	6a 07                	push   $0x7
+  801591:	68 00 f0 bf ee       	push   $0xeebff000
+  801596:	57                   	push   %edi
+  801597:	e8 58 f9 ff ff       	call   800ef4 <sys_page_alloc>
+  80159c:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80159e:	83 c4 10             	add    $0x10,%esp
+  8015a1:	85 c0                	test   %eax,%eax
+  8015a3:	78 2f                	js     8015d4 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8015a5:	a1 04 60 80 00       	mov    0x806004,%eax
+  8015aa:	8b 40 64             	mov    0x64(%eax),%eax
+  8015ad:	83 ec 08             	sub    $0x8,%esp
+  8015b0:	50                   	push   %eax
+  8015b1:	57                   	push   %edi
+  8015b2:	e8 a8 fa ff ff       	call   80105f <sys_env_set_pgfault_upcall>
+  8015b7:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8015b9:	83 c4 10             	add    $0x10,%esp
+  8015bc:	85 c0                	test   %eax,%eax
+  8015be:	78 14                	js     8015d4 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8015c0:	83 ec 08             	sub    $0x8,%esp
+  8015c3:	6a 02                	push   $0x2
+  8015c5:	57                   	push   %edi
+  8015c6:	e8 00 fa ff ff       	call   800fcb <sys_env_set_status>
+  8015cb:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8015cd:	83 c4 10             	add    $0x10,%esp
+  8015d0:	85 c0                	test   %eax,%eax
+  8015d2:	79 11                	jns    8015e5 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8015d4:	83 ec 0c             	sub    $0xc,%esp
+  8015d7:	ff 75 e0             	push   -0x20(%ebp)
+  8015da:	e8 86 f8 ff ff       	call   800e65 <sys_env_destroy>
+	return r;
+  8015df:	83 c4 10             	add    $0x10,%esp
+  8015e2:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8015e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8015e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015eb:	5b                   	pop    %ebx
+  8015ec:	5e                   	pop    %esi
+  8015ed:	5f                   	pop    %edi
+  8015ee:	5d                   	pop    %ebp
+  8015ef:	c3                   	ret
+
+008015f0 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8015f0:	55                   	push   %ebp
+  8015f1:	89 e5                	mov    %esp,%ebp
+  8015f3:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8015f6:	68 37 40 80 00       	push   $0x804037
+  8015fb:	68 bf 00 00 00       	push   $0xbf
+  801600:	68 2c 40 80 00       	push   $0x80402c
+  801605:	e8 15 ee ff ff       	call   80041f <_panic>
+
+0080160a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80160a:	55                   	push   %ebp
+  80160b:	89 e5                	mov    %esp,%ebp
+  80160d:	56                   	push   %esi
+  80160e:	53                   	push   %ebx
+  80160f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801612:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801615:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801618:	85 c0                	test   %eax,%eax
+  80161a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80161f:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  801622:	83 ec 0c             	sub    $0xc,%esp
+  801625:	50                   	push   %eax
+  801626:	e8 11 fb ff ff       	call   80113c <sys_ipc_recv>
+	if (from_env_store)
+  80162b:	83 c4 10             	add    $0x10,%esp
+  80162e:	85 f6                	test   %esi,%esi
+  801630:	74 14                	je     801646 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801632:	ba 00 00 00 00       	mov    $0x0,%edx
+  801637:	85 c0                	test   %eax,%eax
+  801639:	75 09                	jne    801644 <ipc_recv+0x3a>
+  80163b:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  801641:	8b 52 74             	mov    0x74(%edx),%edx
+  801644:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  801646:	85 db                	test   %ebx,%ebx
+  801648:	74 25                	je     80166f <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80164a:	85 c0                	test   %eax,%eax
+  80164c:	74 0d                	je     80165b <ipc_recv+0x51>
+  80164e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  801654:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801657:	5b                   	pop    %ebx
+  801658:	5e                   	pop    %esi
+  801659:	5d                   	pop    %ebp
+  80165a:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80165b:	a1 04 60 80 00       	mov    0x806004,%eax
+  801660:	8b 40 78             	mov    0x78(%eax),%eax
+  801663:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  801665:	a1 04 60 80 00       	mov    0x806004,%eax
+  80166a:	8b 40 70             	mov    0x70(%eax),%eax
+  80166d:	eb e5                	jmp    801654 <ipc_recv+0x4a>
+  80166f:	85 c0                	test   %eax,%eax
+  801671:	75 e1                	jne    801654 <ipc_recv+0x4a>
+  801673:	eb f0                	jmp    801665 <ipc_recv+0x5b>
+
+00801675 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801675:	55                   	push   %ebp
+  801676:	89 e5                	mov    %esp,%ebp
+  801678:	57                   	push   %edi
+  801679:	56                   	push   %esi
+  80167a:	53                   	push   %ebx
+  80167b:	83 ec 0c             	sub    $0xc,%esp
+  80167e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801681:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801684:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801687:	85 db                	test   %ebx,%ebx
+  801689:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80168e:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  801691:	ff 75 14             	push   0x14(%ebp)
+  801694:	53                   	push   %ebx
+  801695:	56                   	push   %esi
+  801696:	57                   	push   %edi
+  801697:	e8 0d fa ff ff       	call   8010a9 <sys_ipc_try_send>
+  80169c:	83 c4 10             	add    $0x10,%esp
+  80169f:	85 c0                	test   %eax,%eax
+  8016a1:	74 22                	je     8016c5 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8016a3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8016a6:	75 07                	jne    8016af <ipc_send+0x3a>
+		sys_yield();
+  8016a8:	e8 28 f8 ff ff       	call   800ed5 <sys_yield>
+  8016ad:	eb e2                	jmp    801691 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8016af:	68 4d 40 80 00       	push   $0x80404d
+  8016b4:	68 a8 3b 80 00       	push   $0x803ba8
+  8016b9:	6a 39                	push   $0x39
+  8016bb:	68 62 40 80 00       	push   $0x804062
+  8016c0:	e8 5a ed ff ff       	call   80041f <_panic>
+	}
+}
+  8016c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016c8:	5b                   	pop    %ebx
+  8016c9:	5e                   	pop    %esi
+  8016ca:	5f                   	pop    %edi
+  8016cb:	5d                   	pop    %ebp
+  8016cc:	c3                   	ret
+
+008016cd <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  8016cd:	55                   	push   %ebp
+  8016ce:	89 e5                	mov    %esp,%ebp
+  8016d0:	57                   	push   %edi
+  8016d1:	56                   	push   %esi
+  8016d2:	53                   	push   %ebx
+  8016d3:	83 ec 10             	sub    $0x10,%esp
+  8016d6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016df:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8016e2:	85 c0                	test   %eax,%eax
+  8016e4:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8016e9:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8016ec:	6a 00                	push   $0x0
+  8016ee:	ff 33                	push   (%ebx)
+  8016f0:	50                   	push   %eax
+  8016f1:	e8 03 fa ff ff       	call   8010f9 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8016f6:	83 c4 10             	add    $0x10,%esp
+  8016f9:	85 c0                	test   %eax,%eax
+  8016fb:	75 3c                	jne    801739 <ipc_recvv+0x6c>
+  8016fd:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  801703:	8b 52 7c             	mov    0x7c(%edx),%edx
+  801706:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  801708:	85 ff                	test   %edi,%edi
+  80170a:	74 4e                	je     80175a <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80170c:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  801712:	8b 52 74             	mov    0x74(%edx),%edx
+  801715:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  801717:	85 f6                	test   %esi,%esi
+  801719:	74 18                	je     801733 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80171b:	85 c0                	test   %eax,%eax
+  80171d:	75 2d                	jne    80174c <ipc_recvv+0x7f>
+  80171f:	a1 04 60 80 00       	mov    0x806004,%eax
+  801724:	8b 40 78             	mov    0x78(%eax),%eax
+  801727:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  801729:	a1 04 60 80 00       	mov    0x806004,%eax
+  80172e:	8b 40 70             	mov    0x70(%eax),%eax
+  801731:	eb 1f                	jmp    801752 <ipc_recvv+0x85>
+  801733:	85 c0                	test   %eax,%eax
+  801735:	75 1b                	jne    801752 <ipc_recvv+0x85>
+  801737:	eb f0                	jmp    801729 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  801739:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80173f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  801744:	85 ff                	test   %edi,%edi
+  801746:	75 cd                	jne    801715 <ipc_recvv+0x48>
+	if (perm_store)
+  801748:	85 f6                	test   %esi,%esi
+  80174a:	74 e7                	je     801733 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80174c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  801752:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801755:	5b                   	pop    %ebx
+  801756:	5e                   	pop    %esi
+  801757:	5f                   	pop    %edi
+  801758:	5d                   	pop    %ebp
+  801759:	c3                   	ret
+	if (perm_store)
+  80175a:	85 f6                	test   %esi,%esi
+  80175c:	75 bd                	jne    80171b <ipc_recvv+0x4e>
+  80175e:	eb c9                	jmp    801729 <ipc_recvv+0x5c>
+
+00801760 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  801760:	55                   	push   %ebp
+  801761:	89 e5                	mov    %esp,%ebp
+  801763:	57                   	push   %edi
+  801764:	56                   	push   %esi
+  801765:	53                   	push   %ebx
+  801766:	83 ec 0c             	sub    $0xc,%esp
+  801769:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80176c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80176f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  801772:	ff 75 14             	push   0x14(%ebp)
+  801775:	53                   	push   %ebx
+  801776:	56                   	push   %esi
+  801777:	57                   	push   %edi
+  801778:	e8 54 f9 ff ff       	call   8010d1 <sys_ipc_try_sendv>
+  80177d:	83 c4 10             	add    $0x10,%esp
+  801780:	85 c0                	test   %eax,%eax
+  801782:	74 22                	je     8017a6 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  801784:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801787:	75 07                	jne    801790 <ipc_sendv+0x30>
+		sys_yield();
+  801789:	e8 47 f7 ff ff       	call   800ed5 <sys_yield>
+  80178e:	eb e2                	jmp    801772 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  801790:	68 4d 40 80 00       	push   $0x80404d
+  801795:	68 a8 3b 80 00       	push   $0x803ba8
+  80179a:	6a 5c                	push   $0x5c
+  80179c:	68 62 40 80 00       	push   $0x804062
+  8017a1:	e8 79 ec ff ff       	call   80041f <_panic>
+	}
+}
+  8017a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017a9:	5b                   	pop    %ebx
+  8017aa:	5e                   	pop    %esi
+  8017ab:	5f                   	pop    %edi
+  8017ac:	5d                   	pop    %ebp
+  8017ad:	c3                   	ret
+
+008017ae <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8017ae:	55                   	push   %ebp
+  8017af:	89 e5                	mov    %esp,%ebp
+  8017b1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8017b4:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8017b9:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8017bf:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8017c5:	8b 52 50             	mov    0x50(%edx),%edx
+  8017c8:	39 ca                	cmp    %ecx,%edx
+  8017ca:	74 11                	je     8017dd <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8017cc:	83 c0 01             	add    $0x1,%eax
+  8017cf:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8017d4:	75 e3                	jne    8017b9 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8017d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017db:	eb 0e                	jmp    8017eb <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8017dd:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8017e3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017e8:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8017eb:	5d                   	pop    %ebp
+  8017ec:	c3                   	ret
+
+008017ed <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8017ed:	55                   	push   %ebp
+  8017ee:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017f3:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017f8:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017fb:	5d                   	pop    %ebp
+  8017fc:	c3                   	ret
+
+008017fd <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017fd:	55                   	push   %ebp
+  8017fe:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801800:	8b 45 08             	mov    0x8(%ebp),%eax
+  801803:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801808:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80180d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801812:	5d                   	pop    %ebp
+  801813:	c3                   	ret
+
+00801814 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801814:	55                   	push   %ebp
+  801815:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801817:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80181c:	eb 02                	jmp    801820 <fd_alloc+0xc>
+  80181e:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801820:	89 c2                	mov    %eax,%edx
+  801822:	c1 ea 16             	shr    $0x16,%edx
+  801825:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80182c:	f6 c2 01             	test   $0x1,%dl
+  80182f:	74 2b                	je     80185c <fd_alloc+0x48>
+  801831:	89 c2                	mov    %eax,%edx
+  801833:	c1 ea 0c             	shr    $0xc,%edx
+  801836:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80183d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801843:	f6 c1 01             	test   $0x1,%cl
+  801846:	74 14                	je     80185c <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801848:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80184e:	75 ce                	jne    80181e <fd_alloc+0xa>
+  801850:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801855:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80185a:	eb 05                	jmp    801861 <fd_alloc+0x4d>
+			return 0;
+  80185c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801861:	8b 55 08             	mov    0x8(%ebp),%edx
+  801864:	89 02                	mov    %eax,(%edx)
+}
+  801866:	89 c8                	mov    %ecx,%eax
+  801868:	5d                   	pop    %ebp
+  801869:	c3                   	ret
+
+0080186a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80186a:	55                   	push   %ebp
+  80186b:	89 e5                	mov    %esp,%ebp
+  80186d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801870:	83 f8 1f             	cmp    $0x1f,%eax
+  801873:	77 30                	ja     8018a5 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801875:	c1 e0 0c             	shl    $0xc,%eax
+  801878:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80187d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801883:	f6 c2 01             	test   $0x1,%dl
+  801886:	74 24                	je     8018ac <fd_lookup+0x42>
+  801888:	89 c2                	mov    %eax,%edx
+  80188a:	c1 ea 0c             	shr    $0xc,%edx
+  80188d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801894:	f6 c2 01             	test   $0x1,%dl
+  801897:	74 1a                	je     8018b3 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801899:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80189c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80189e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018a3:	5d                   	pop    %ebp
+  8018a4:	c3                   	ret
+		return -E_INVAL;
+  8018a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018aa:	eb f7                	jmp    8018a3 <fd_lookup+0x39>
+		return -E_INVAL;
+  8018ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b1:	eb f0                	jmp    8018a3 <fd_lookup+0x39>
+  8018b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b8:	eb e9                	jmp    8018a3 <fd_lookup+0x39>
+
+008018ba <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8018ba:	55                   	push   %ebp
+  8018bb:	89 e5                	mov    %esp,%ebp
+  8018bd:	53                   	push   %ebx
+  8018be:	83 ec 04             	sub    $0x4,%esp
+  8018c1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8018c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c9:	eb 03                	jmp    8018ce <dev_lookup+0x14>
+  8018cb:	83 c0 01             	add    $0x1,%eax
+  8018ce:	8b 1c 85 e8 40 80 00 	mov    0x8040e8(,%eax,4),%ebx
+  8018d5:	85 db                	test   %ebx,%ebx
+  8018d7:	74 0b                	je     8018e4 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8018d9:	39 13                	cmp    %edx,(%ebx)
+  8018db:	75 ee                	jne    8018cb <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8018dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e2:	eb 1f                	jmp    801903 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018e4:	a1 04 60 80 00       	mov    0x806004,%eax
+  8018e9:	8b 40 48             	mov    0x48(%eax),%eax
+  8018ec:	83 ec 04             	sub    $0x4,%esp
+  8018ef:	52                   	push   %edx
+  8018f0:	50                   	push   %eax
+  8018f1:	68 6c 40 80 00       	push   $0x80406c
+  8018f6:	e8 ff eb ff ff       	call   8004fa <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018fb:	83 c4 10             	add    $0x10,%esp
+  8018fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801903:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801906:	89 1a                	mov    %ebx,(%edx)
+}
+  801908:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80190b:	c9                   	leave
+  80190c:	c3                   	ret
+
+0080190d <fd_close>:
+{
+  80190d:	55                   	push   %ebp
+  80190e:	89 e5                	mov    %esp,%ebp
+  801910:	57                   	push   %edi
+  801911:	56                   	push   %esi
+  801912:	53                   	push   %ebx
+  801913:	83 ec 24             	sub    $0x24,%esp
+  801916:	8b 75 08             	mov    0x8(%ebp),%esi
+  801919:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80191c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80191f:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801920:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801926:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801929:	50                   	push   %eax
+  80192a:	e8 3b ff ff ff       	call   80186a <fd_lookup>
+  80192f:	89 c3                	mov    %eax,%ebx
+  801931:	83 c4 10             	add    $0x10,%esp
+  801934:	85 c0                	test   %eax,%eax
+  801936:	78 05                	js     80193d <fd_close+0x30>
+	    || fd != fd2)
+  801938:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80193b:	74 16                	je     801953 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80193d:	89 f8                	mov    %edi,%eax
+  80193f:	84 c0                	test   %al,%al
+  801941:	b8 00 00 00 00       	mov    $0x0,%eax
+  801946:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801949:	89 d8                	mov    %ebx,%eax
+  80194b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80194e:	5b                   	pop    %ebx
+  80194f:	5e                   	pop    %esi
+  801950:	5f                   	pop    %edi
+  801951:	5d                   	pop    %ebp
+  801952:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801953:	83 ec 08             	sub    $0x8,%esp
+  801956:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801959:	50                   	push   %eax
+  80195a:	ff 36                	push   (%esi)
+  80195c:	e8 59 ff ff ff       	call   8018ba <dev_lookup>
+  801961:	89 c3                	mov    %eax,%ebx
+  801963:	83 c4 10             	add    $0x10,%esp
+  801966:	85 c0                	test   %eax,%eax
+  801968:	78 1a                	js     801984 <fd_close+0x77>
+		if (dev->dev_close)
+  80196a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80196d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801970:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801975:	85 c0                	test   %eax,%eax
+  801977:	74 0b                	je     801984 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801979:	83 ec 0c             	sub    $0xc,%esp
+  80197c:	56                   	push   %esi
+  80197d:	ff d0                	call   *%eax
+  80197f:	89 c3                	mov    %eax,%ebx
+  801981:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801984:	83 ec 08             	sub    $0x8,%esp
+  801987:	56                   	push   %esi
+  801988:	6a 00                	push   $0x0
+  80198a:	e8 f2 f5 ff ff       	call   800f81 <sys_page_unmap>
+	return r;
+  80198f:	83 c4 10             	add    $0x10,%esp
+  801992:	eb b5                	jmp    801949 <fd_close+0x3c>
+
+00801994 <close>:
+
+int
+close(int fdnum)
+{
+  801994:	55                   	push   %ebp
+  801995:	89 e5                	mov    %esp,%ebp
+  801997:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80199a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80199d:	50                   	push   %eax
+  80199e:	ff 75 08             	push   0x8(%ebp)
+  8019a1:	e8 c4 fe ff ff       	call   80186a <fd_lookup>
+  8019a6:	83 c4 10             	add    $0x10,%esp
+  8019a9:	85 c0                	test   %eax,%eax
+  8019ab:	79 02                	jns    8019af <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8019ad:	c9                   	leave
+  8019ae:	c3                   	ret
+		return fd_close(fd, 1);
+  8019af:	83 ec 08             	sub    $0x8,%esp
+  8019b2:	6a 01                	push   $0x1
+  8019b4:	ff 75 f4             	push   -0xc(%ebp)
+  8019b7:	e8 51 ff ff ff       	call   80190d <fd_close>
+  8019bc:	83 c4 10             	add    $0x10,%esp
+  8019bf:	eb ec                	jmp    8019ad <close+0x19>
+
+008019c1 <close_all>:
+
+void
+close_all(void)
+{
+  8019c1:	55                   	push   %ebp
+  8019c2:	89 e5                	mov    %esp,%ebp
+  8019c4:	53                   	push   %ebx
+  8019c5:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8019c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8019cd:	83 ec 0c             	sub    $0xc,%esp
+  8019d0:	53                   	push   %ebx
+  8019d1:	e8 be ff ff ff       	call   801994 <close>
+	for (i = 0; i < MAXFD; i++)
+  8019d6:	83 c3 01             	add    $0x1,%ebx
+  8019d9:	83 c4 10             	add    $0x10,%esp
+  8019dc:	83 fb 20             	cmp    $0x20,%ebx
+  8019df:	75 ec                	jne    8019cd <close_all+0xc>
+}
+  8019e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019e4:	c9                   	leave
+  8019e5:	c3                   	ret
+
+008019e6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019e6:	55                   	push   %ebp
+  8019e7:	89 e5                	mov    %esp,%ebp
+  8019e9:	57                   	push   %edi
+  8019ea:	56                   	push   %esi
+  8019eb:	53                   	push   %ebx
+  8019ec:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019ef:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019f2:	50                   	push   %eax
+  8019f3:	ff 75 08             	push   0x8(%ebp)
+  8019f6:	e8 6f fe ff ff       	call   80186a <fd_lookup>
+  8019fb:	89 c3                	mov    %eax,%ebx
+  8019fd:	83 c4 10             	add    $0x10,%esp
+  801a00:	85 c0                	test   %eax,%eax
+  801a02:	78 7f                	js     801a83 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a04:	83 ec 0c             	sub    $0xc,%esp
+  801a07:	ff 75 0c             	push   0xc(%ebp)
+  801a0a:	e8 85 ff ff ff       	call   801994 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a0f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a12:	c1 e6 0c             	shl    $0xc,%esi
+  801a15:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801a1b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a1e:	89 3c 24             	mov    %edi,(%esp)
+  801a21:	e8 d7 fd ff ff       	call   8017fd <fd2data>
+  801a26:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a28:	89 34 24             	mov    %esi,(%esp)
+  801a2b:	e8 cd fd ff ff       	call   8017fd <fd2data>
+  801a30:	83 c4 10             	add    $0x10,%esp
+  801a33:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a36:	89 d8                	mov    %ebx,%eax
+  801a38:	c1 e8 16             	shr    $0x16,%eax
+  801a3b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a42:	a8 01                	test   $0x1,%al
+  801a44:	74 11                	je     801a57 <dup+0x71>
+  801a46:	89 d8                	mov    %ebx,%eax
+  801a48:	c1 e8 0c             	shr    $0xc,%eax
+  801a4b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a52:	f6 c2 01             	test   $0x1,%dl
+  801a55:	75 36                	jne    801a8d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a57:	89 f8                	mov    %edi,%eax
+  801a59:	c1 e8 0c             	shr    $0xc,%eax
+  801a5c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a63:	83 ec 0c             	sub    $0xc,%esp
+  801a66:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a6b:	50                   	push   %eax
+  801a6c:	56                   	push   %esi
+  801a6d:	6a 00                	push   $0x0
+  801a6f:	57                   	push   %edi
+  801a70:	6a 00                	push   $0x0
+  801a72:	e8 c8 f4 ff ff       	call   800f3f <sys_page_map>
+  801a77:	89 c3                	mov    %eax,%ebx
+  801a79:	83 c4 20             	add    $0x20,%esp
+  801a7c:	85 c0                	test   %eax,%eax
+  801a7e:	78 33                	js     801ab3 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a80:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a83:	89 d8                	mov    %ebx,%eax
+  801a85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a88:	5b                   	pop    %ebx
+  801a89:	5e                   	pop    %esi
+  801a8a:	5f                   	pop    %edi
+  801a8b:	5d                   	pop    %ebp
+  801a8c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a8d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a94:	83 ec 0c             	sub    $0xc,%esp
+  801a97:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a9c:	50                   	push   %eax
+  801a9d:	ff 75 d4             	push   -0x2c(%ebp)
+  801aa0:	6a 00                	push   $0x0
+  801aa2:	53                   	push   %ebx
+  801aa3:	6a 00                	push   $0x0
+  801aa5:	e8 95 f4 ff ff       	call   800f3f <sys_page_map>
+  801aaa:	89 c3                	mov    %eax,%ebx
+  801aac:	83 c4 20             	add    $0x20,%esp
+  801aaf:	85 c0                	test   %eax,%eax
+  801ab1:	79 a4                	jns    801a57 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801ab3:	83 ec 08             	sub    $0x8,%esp
+  801ab6:	56                   	push   %esi
+  801ab7:	6a 00                	push   $0x0
+  801ab9:	e8 c3 f4 ff ff       	call   800f81 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801abe:	83 c4 08             	add    $0x8,%esp
+  801ac1:	ff 75 d4             	push   -0x2c(%ebp)
+  801ac4:	6a 00                	push   $0x0
+  801ac6:	e8 b6 f4 ff ff       	call   800f81 <sys_page_unmap>
+	return r;
+  801acb:	83 c4 10             	add    $0x10,%esp
+  801ace:	eb b3                	jmp    801a83 <dup+0x9d>
+
+00801ad0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801ad0:	55                   	push   %ebp
+  801ad1:	89 e5                	mov    %esp,%ebp
+  801ad3:	56                   	push   %esi
+  801ad4:	53                   	push   %ebx
+  801ad5:	83 ec 18             	sub    $0x18,%esp
+  801ad8:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801adb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ade:	50                   	push   %eax
+  801adf:	56                   	push   %esi
+  801ae0:	e8 85 fd ff ff       	call   80186a <fd_lookup>
+  801ae5:	83 c4 10             	add    $0x10,%esp
+  801ae8:	85 c0                	test   %eax,%eax
+  801aea:	78 3c                	js     801b28 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801aec:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801aef:	83 ec 08             	sub    $0x8,%esp
+  801af2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af5:	50                   	push   %eax
+  801af6:	ff 33                	push   (%ebx)
+  801af8:	e8 bd fd ff ff       	call   8018ba <dev_lookup>
+  801afd:	83 c4 10             	add    $0x10,%esp
+  801b00:	85 c0                	test   %eax,%eax
+  801b02:	78 24                	js     801b28 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b04:	8b 43 08             	mov    0x8(%ebx),%eax
+  801b07:	83 e0 03             	and    $0x3,%eax
+  801b0a:	83 f8 01             	cmp    $0x1,%eax
+  801b0d:	74 20                	je     801b2f <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b12:	8b 40 08             	mov    0x8(%eax),%eax
+  801b15:	85 c0                	test   %eax,%eax
+  801b17:	74 37                	je     801b50 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801b19:	83 ec 04             	sub    $0x4,%esp
+  801b1c:	ff 75 10             	push   0x10(%ebp)
+  801b1f:	ff 75 0c             	push   0xc(%ebp)
+  801b22:	53                   	push   %ebx
+  801b23:	ff d0                	call   *%eax
+  801b25:	83 c4 10             	add    $0x10,%esp
+}
+  801b28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b2b:	5b                   	pop    %ebx
+  801b2c:	5e                   	pop    %esi
+  801b2d:	5d                   	pop    %ebp
+  801b2e:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b2f:	a1 04 60 80 00       	mov    0x806004,%eax
+  801b34:	8b 40 48             	mov    0x48(%eax),%eax
+  801b37:	83 ec 04             	sub    $0x4,%esp
+  801b3a:	56                   	push   %esi
+  801b3b:	50                   	push   %eax
+  801b3c:	68 ad 40 80 00       	push   $0x8040ad
+  801b41:	e8 b4 e9 ff ff       	call   8004fa <cprintf>
+		return -E_INVAL;
+  801b46:	83 c4 10             	add    $0x10,%esp
+  801b49:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b4e:	eb d8                	jmp    801b28 <read+0x58>
+		return -E_NOT_SUPP;
+  801b50:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b55:	eb d1                	jmp    801b28 <read+0x58>
+
+00801b57 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b57:	55                   	push   %ebp
+  801b58:	89 e5                	mov    %esp,%ebp
+  801b5a:	57                   	push   %edi
+  801b5b:	56                   	push   %esi
+  801b5c:	53                   	push   %ebx
+  801b5d:	83 ec 0c             	sub    $0xc,%esp
+  801b60:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b63:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b6b:	eb 02                	jmp    801b6f <readn+0x18>
+  801b6d:	01 c3                	add    %eax,%ebx
+  801b6f:	39 f3                	cmp    %esi,%ebx
+  801b71:	73 21                	jae    801b94 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b73:	83 ec 04             	sub    $0x4,%esp
+  801b76:	89 f0                	mov    %esi,%eax
+  801b78:	29 d8                	sub    %ebx,%eax
+  801b7a:	50                   	push   %eax
+  801b7b:	89 d8                	mov    %ebx,%eax
+  801b7d:	03 45 0c             	add    0xc(%ebp),%eax
+  801b80:	50                   	push   %eax
+  801b81:	57                   	push   %edi
+  801b82:	e8 49 ff ff ff       	call   801ad0 <read>
+		if (m < 0)
+  801b87:	83 c4 10             	add    $0x10,%esp
+  801b8a:	85 c0                	test   %eax,%eax
+  801b8c:	78 04                	js     801b92 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b8e:	75 dd                	jne    801b6d <readn+0x16>
+  801b90:	eb 02                	jmp    801b94 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b92:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b94:	89 d8                	mov    %ebx,%eax
+  801b96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b99:	5b                   	pop    %ebx
+  801b9a:	5e                   	pop    %esi
+  801b9b:	5f                   	pop    %edi
+  801b9c:	5d                   	pop    %ebp
+  801b9d:	c3                   	ret
+
+00801b9e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b9e:	55                   	push   %ebp
+  801b9f:	89 e5                	mov    %esp,%ebp
+  801ba1:	56                   	push   %esi
+  801ba2:	53                   	push   %ebx
+  801ba3:	83 ec 18             	sub    $0x18,%esp
+  801ba6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ba9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bac:	50                   	push   %eax
+  801bad:	53                   	push   %ebx
+  801bae:	e8 b7 fc ff ff       	call   80186a <fd_lookup>
+  801bb3:	83 c4 10             	add    $0x10,%esp
+  801bb6:	85 c0                	test   %eax,%eax
+  801bb8:	78 37                	js     801bf1 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bba:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bbd:	83 ec 08             	sub    $0x8,%esp
+  801bc0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bc3:	50                   	push   %eax
+  801bc4:	ff 36                	push   (%esi)
+  801bc6:	e8 ef fc ff ff       	call   8018ba <dev_lookup>
+  801bcb:	83 c4 10             	add    $0x10,%esp
+  801bce:	85 c0                	test   %eax,%eax
+  801bd0:	78 1f                	js     801bf1 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bd2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bd6:	74 20                	je     801bf8 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801bd8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bdb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bde:	85 c0                	test   %eax,%eax
+  801be0:	74 37                	je     801c19 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801be2:	83 ec 04             	sub    $0x4,%esp
+  801be5:	ff 75 10             	push   0x10(%ebp)
+  801be8:	ff 75 0c             	push   0xc(%ebp)
+  801beb:	56                   	push   %esi
+  801bec:	ff d0                	call   *%eax
+  801bee:	83 c4 10             	add    $0x10,%esp
+}
+  801bf1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bf4:	5b                   	pop    %ebx
+  801bf5:	5e                   	pop    %esi
+  801bf6:	5d                   	pop    %ebp
+  801bf7:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bf8:	a1 04 60 80 00       	mov    0x806004,%eax
+  801bfd:	8b 40 48             	mov    0x48(%eax),%eax
+  801c00:	83 ec 04             	sub    $0x4,%esp
+  801c03:	53                   	push   %ebx
+  801c04:	50                   	push   %eax
+  801c05:	68 c9 40 80 00       	push   $0x8040c9
+  801c0a:	e8 eb e8 ff ff       	call   8004fa <cprintf>
+		return -E_INVAL;
+  801c0f:	83 c4 10             	add    $0x10,%esp
+  801c12:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c17:	eb d8                	jmp    801bf1 <write+0x53>
+		return -E_NOT_SUPP;
+  801c19:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c1e:	eb d1                	jmp    801bf1 <write+0x53>
+
+00801c20 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c20:	55                   	push   %ebp
+  801c21:	89 e5                	mov    %esp,%ebp
+  801c23:	53                   	push   %ebx
+  801c24:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c27:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c2a:	50                   	push   %eax
+  801c2b:	ff 75 08             	push   0x8(%ebp)
+  801c2e:	e8 37 fc ff ff       	call   80186a <fd_lookup>
+  801c33:	83 c4 10             	add    $0x10,%esp
+  801c36:	85 c0                	test   %eax,%eax
+  801c38:	78 3a                	js     801c74 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c3a:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801c3d:	83 ec 08             	sub    $0x8,%esp
+  801c40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c43:	50                   	push   %eax
+  801c44:	ff 33                	push   (%ebx)
+  801c46:	e8 6f fc ff ff       	call   8018ba <dev_lookup>
+  801c4b:	83 c4 10             	add    $0x10,%esp
+  801c4e:	85 c0                	test   %eax,%eax
+  801c50:	78 22                	js     801c74 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801c52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c55:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801c58:	85 c0                	test   %eax,%eax
+  801c5a:	74 0d                	je     801c69 <seek+0x49>
+  801c5c:	83 ec 0c             	sub    $0xc,%esp
+  801c5f:	53                   	push   %ebx
+  801c60:	ff d0                	call   *%eax
+  801c62:	83 c4 10             	add    $0x10,%esp
+  801c65:	85 c0                	test   %eax,%eax
+  801c67:	78 0b                	js     801c74 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801c69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c6c:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c77:	c9                   	leave
+  801c78:	c3                   	ret
+
+00801c79 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801c79:	55                   	push   %ebp
+  801c7a:	89 e5                	mov    %esp,%ebp
+  801c7c:	53                   	push   %ebx
+  801c7d:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c80:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c83:	50                   	push   %eax
+  801c84:	ff 75 08             	push   0x8(%ebp)
+  801c87:	e8 de fb ff ff       	call   80186a <fd_lookup>
+  801c8c:	83 c4 10             	add    $0x10,%esp
+  801c8f:	85 c0                	test   %eax,%eax
+  801c91:	78 2b                	js     801cbe <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c93:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801c96:	83 ec 08             	sub    $0x8,%esp
+  801c99:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c9c:	50                   	push   %eax
+  801c9d:	ff 33                	push   (%ebx)
+  801c9f:	e8 16 fc ff ff       	call   8018ba <dev_lookup>
+  801ca4:	83 c4 10             	add    $0x10,%esp
+  801ca7:	85 c0                	test   %eax,%eax
+  801ca9:	78 13                	js     801cbe <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801cab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cae:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801cb1:	85 c0                	test   %eax,%eax
+  801cb3:	74 0e                	je     801cc3 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801cb5:	83 ec 0c             	sub    $0xc,%esp
+  801cb8:	53                   	push   %ebx
+  801cb9:	ff d0                	call   *%eax
+  801cbb:	83 c4 10             	add    $0x10,%esp
+}
+  801cbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc1:	c9                   	leave
+  801cc2:	c3                   	ret
+		return 0;
+  801cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc8:	eb f4                	jmp    801cbe <fsync+0x45>
+
+00801cca <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801cca:	55                   	push   %ebp
+  801ccb:	89 e5                	mov    %esp,%ebp
+  801ccd:	56                   	push   %esi
+  801cce:	53                   	push   %ebx
+  801ccf:	83 ec 18             	sub    $0x18,%esp
+  801cd2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cd5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cd8:	50                   	push   %eax
+  801cd9:	53                   	push   %ebx
+  801cda:	e8 8b fb ff ff       	call   80186a <fd_lookup>
+  801cdf:	83 c4 10             	add    $0x10,%esp
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	78 34                	js     801d1a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ce6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ce9:	83 ec 08             	sub    $0x8,%esp
+  801cec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cef:	50                   	push   %eax
+  801cf0:	ff 36                	push   (%esi)
+  801cf2:	e8 c3 fb ff ff       	call   8018ba <dev_lookup>
+  801cf7:	83 c4 10             	add    $0x10,%esp
+  801cfa:	85 c0                	test   %eax,%eax
+  801cfc:	78 1c                	js     801d1a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cfe:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d02:	74 1d                	je     801d21 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d07:	8b 40 18             	mov    0x18(%eax),%eax
+  801d0a:	85 c0                	test   %eax,%eax
+  801d0c:	74 34                	je     801d42 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d0e:	83 ec 08             	sub    $0x8,%esp
+  801d11:	ff 75 0c             	push   0xc(%ebp)
+  801d14:	56                   	push   %esi
+  801d15:	ff d0                	call   *%eax
+  801d17:	83 c4 10             	add    $0x10,%esp
+}
+  801d1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d1d:	5b                   	pop    %ebx
+  801d1e:	5e                   	pop    %esi
+  801d1f:	5d                   	pop    %ebp
+  801d20:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801d21:	a1 04 60 80 00       	mov    0x806004,%eax
+  801d26:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d29:	83 ec 04             	sub    $0x4,%esp
+  801d2c:	53                   	push   %ebx
+  801d2d:	50                   	push   %eax
+  801d2e:	68 8c 40 80 00       	push   $0x80408c
+  801d33:	e8 c2 e7 ff ff       	call   8004fa <cprintf>
+		return -E_INVAL;
+  801d38:	83 c4 10             	add    $0x10,%esp
+  801d3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d40:	eb d8                	jmp    801d1a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801d42:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d47:	eb d1                	jmp    801d1a <ftruncate+0x50>
+
+00801d49 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d49:	55                   	push   %ebp
+  801d4a:	89 e5                	mov    %esp,%ebp
+  801d4c:	56                   	push   %esi
+  801d4d:	53                   	push   %ebx
+  801d4e:	83 ec 18             	sub    $0x18,%esp
+  801d51:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d54:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d57:	50                   	push   %eax
+  801d58:	ff 75 08             	push   0x8(%ebp)
+  801d5b:	e8 0a fb ff ff       	call   80186a <fd_lookup>
+  801d60:	83 c4 10             	add    $0x10,%esp
+  801d63:	85 c0                	test   %eax,%eax
+  801d65:	78 49                	js     801db0 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d67:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d6a:	83 ec 08             	sub    $0x8,%esp
+  801d6d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d70:	50                   	push   %eax
+  801d71:	ff 36                	push   (%esi)
+  801d73:	e8 42 fb ff ff       	call   8018ba <dev_lookup>
+  801d78:	83 c4 10             	add    $0x10,%esp
+  801d7b:	85 c0                	test   %eax,%eax
+  801d7d:	78 31                	js     801db0 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d82:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d86:	74 2f                	je     801db7 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d88:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d8b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d92:	00 00 00 
+	stat->st_isdir = 0;
+  801d95:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d9c:	00 00 00 
+	stat->st_dev = dev;
+  801d9f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801da5:	83 ec 08             	sub    $0x8,%esp
+  801da8:	53                   	push   %ebx
+  801da9:	56                   	push   %esi
+  801daa:	ff 50 14             	call   *0x14(%eax)
+  801dad:	83 c4 10             	add    $0x10,%esp
+}
+  801db0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801db3:	5b                   	pop    %ebx
+  801db4:	5e                   	pop    %esi
+  801db5:	5d                   	pop    %ebp
+  801db6:	c3                   	ret
+		return -E_NOT_SUPP;
+  801db7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dbc:	eb f2                	jmp    801db0 <fstat+0x67>
+
+00801dbe <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801dbe:	55                   	push   %ebp
+  801dbf:	89 e5                	mov    %esp,%ebp
+  801dc1:	56                   	push   %esi
+  801dc2:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801dc3:	83 ec 08             	sub    $0x8,%esp
+  801dc6:	68 00 10 00 00       	push   $0x1000
+  801dcb:	ff 75 08             	push   0x8(%ebp)
+  801dce:	e8 b3 07 00 00       	call   802586 <open>
+  801dd3:	89 c3                	mov    %eax,%ebx
+  801dd5:	83 c4 10             	add    $0x10,%esp
+  801dd8:	85 c0                	test   %eax,%eax
+  801dda:	78 1b                	js     801df7 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801ddc:	83 ec 08             	sub    $0x8,%esp
+  801ddf:	ff 75 0c             	push   0xc(%ebp)
+  801de2:	50                   	push   %eax
+  801de3:	e8 61 ff ff ff       	call   801d49 <fstat>
+  801de8:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801dea:	89 1c 24             	mov    %ebx,(%esp)
+  801ded:	e8 a2 fb ff ff       	call   801994 <close>
+	return r;
+  801df2:	83 c4 10             	add    $0x10,%esp
+  801df5:	89 f3                	mov    %esi,%ebx
+}
+  801df7:	89 d8                	mov    %ebx,%eax
+  801df9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dfc:	5b                   	pop    %ebx
+  801dfd:	5e                   	pop    %esi
+  801dfe:	5d                   	pop    %ebp
+  801dff:	c3                   	ret
+
+00801e00 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801e00:	55                   	push   %ebp
+  801e01:	89 e5                	mov    %esp,%ebp
+  801e03:	57                   	push   %edi
+  801e04:	56                   	push   %esi
+  801e05:	53                   	push   %ebx
+  801e06:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801e0c:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801e12:	89 d6                	mov    %edx,%esi
+  801e14:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801e1a:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801e1d:	89 d3                	mov    %edx,%ebx
+  801e1f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801e25:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801e2c:	74 1d                	je     801e4b <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801e2e:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801e33:	83 c8 07             	or     $0x7,%eax
+  801e36:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801e3c:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801e41:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801e47:	01 ce                	add    %ecx,%esi
+  801e49:	eb 28                	jmp    801e73 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e4b:	83 ec 0c             	sub    $0xc,%esp
+  801e4e:	6a 01                	push   $0x1
+  801e50:	e8 59 f9 ff ff       	call   8017ae <ipc_find_env>
+  801e55:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801e5a:	83 c4 10             	add    $0x10,%esp
+  801e5d:	eb cf                	jmp    801e2e <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801e5f:	83 c0 01             	add    $0x1,%eax
+  801e62:	89 fa                	mov    %edi,%edx
+  801e64:	09 da                	or     %ebx,%edx
+  801e66:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801e6d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e73:	39 f3                	cmp    %esi,%ebx
+  801e75:	72 e8                	jb     801e5f <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801e77:	83 f8 41             	cmp    $0x41,%eax
+  801e7a:	77 2f                	ja     801eab <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801e7c:	50                   	push   %eax
+  801e7d:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801e83:	50                   	push   %eax
+  801e84:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801e8a:	ff 35 c8 80 80 00    	push   0x8080c8
+  801e90:	e8 cb f8 ff ff       	call   801760 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801e95:	83 c4 0c             	add    $0xc,%esp
+  801e98:	6a 00                	push   $0x0
+  801e9a:	6a 00                	push   $0x0
+  801e9c:	6a 00                	push   $0x0
+  801e9e:	e8 67 f7 ff ff       	call   80160a <ipc_recv>
+}
+  801ea3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ea6:	5b                   	pop    %ebx
+  801ea7:	5e                   	pop    %esi
+  801ea8:	5f                   	pop    %edi
+  801ea9:	5d                   	pop    %ebp
+  801eaa:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801eab:	68 fc 40 80 00       	push   $0x8040fc
+  801eb0:	68 a8 3b 80 00       	push   $0x803ba8
+  801eb5:	6a 40                	push   $0x40
+  801eb7:	68 18 41 80 00       	push   $0x804118
+  801ebc:	e8 5e e5 ff ff       	call   80041f <_panic>
+
+00801ec1 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801ec1:	55                   	push   %ebp
+  801ec2:	89 e5                	mov    %esp,%ebp
+  801ec4:	57                   	push   %edi
+  801ec5:	56                   	push   %esi
+  801ec6:	53                   	push   %ebx
+  801ec7:	83 ec 1c             	sub    $0x1c,%esp
+  801eca:	89 c3                	mov    %eax,%ebx
+  801ecc:	89 d6                	mov    %edx,%esi
+  801ece:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801ed1:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801ed7:	89 ca                	mov    %ecx,%edx
+  801ed9:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801edc:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801ee3:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801ee6:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801eed:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ef0:	89 fb                	mov    %edi,%ebx
+  801ef2:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801ef9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801efc:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801f03:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f06:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801f0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f10:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801f17:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801f1a:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801f21:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801f26:	39 c8                	cmp    %ecx,%eax
+  801f28:	74 0d                	je     801f37 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801f2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f32:	5b                   	pop    %ebx
+  801f33:	5e                   	pop    %esi
+  801f34:	5f                   	pop    %edi
+  801f35:	5d                   	pop    %ebp
+  801f36:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f37:	6a 07                	push   $0x7
+  801f39:	68 00 70 80 00       	push   $0x807000
+  801f3e:	6a 0d                	push   $0xd
+  801f40:	ff 35 c8 80 80 00    	push   0x8080c8
+  801f46:	e8 2a f7 ff ff       	call   801675 <ipc_send>
+  801f4b:	83 c4 10             	add    $0x10,%esp
+  801f4e:	eb da                	jmp    801f2a <fsring_post+0x69>
+
+00801f50 <fsipcv>:
+{
+  801f50:	55                   	push   %ebp
+  801f51:	89 e5                	mov    %esp,%ebp
+  801f53:	57                   	push   %edi
+  801f54:	56                   	push   %esi
+  801f55:	53                   	push   %ebx
+  801f56:	83 ec 0c             	sub    $0xc,%esp
+  801f59:	89 c7                	mov    %eax,%edi
+  801f5b:	89 d3                	mov    %edx,%ebx
+  801f5d:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801f5f:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801f66:	74 26                	je     801f8e <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f68:	6a 07                	push   $0x7
+  801f6a:	68 00 70 80 00       	push   $0x807000
+  801f6f:	57                   	push   %edi
+  801f70:	ff 35 c8 80 80 00    	push   0x8080c8
+  801f76:	e8 fa f6 ff ff       	call   801675 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801f7b:	6a 00                	push   $0x0
+  801f7d:	56                   	push   %esi
+  801f7e:	53                   	push   %ebx
+  801f7f:	6a 00                	push   $0x0
+  801f81:	e8 47 f7 ff ff       	call   8016cd <ipc_recvv>
+}
+  801f86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f89:	5b                   	pop    %ebx
+  801f8a:	5e                   	pop    %esi
+  801f8b:	5f                   	pop    %edi
+  801f8c:	5d                   	pop    %ebp
+  801f8d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f8e:	83 ec 0c             	sub    $0xc,%esp
+  801f91:	6a 01                	push   $0x1
+  801f93:	e8 16 f8 ff ff       	call   8017ae <ipc_find_env>
+  801f98:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801f9d:	83 c4 10             	add    $0x10,%esp
+  801fa0:	eb c6                	jmp    801f68 <fsipcv+0x18>
+
+00801fa2 <fsipc>:
+{
+  801fa2:	55                   	push   %ebp
+  801fa3:	89 e5                	mov    %esp,%ebp
+  801fa5:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801fa8:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801faf:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801fb2:	e8 99 ff ff ff       	call   801f50 <fsipcv>
+}
+  801fb7:	c9                   	leave
+  801fb8:	c3                   	ret
+
+00801fb9 <file_write_direct>:
+{
+  801fb9:	55                   	push   %ebp
+  801fba:	89 e5                	mov    %esp,%ebp
+  801fbc:	56                   	push   %esi
+  801fbd:	53                   	push   %ebx
+  801fbe:	89 c3                	mov    %eax,%ebx
+  801fc0:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801fc2:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801fc8:	77 40                	ja     80200a <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801fca:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801fcf:	39 c8                	cmp    %ecx,%eax
+  801fd1:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fd4:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801fd7:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  801fdd:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801fe2:	83 ec 04             	sub    $0x4,%esp
+  801fe5:	50                   	push   %eax
+  801fe6:	52                   	push   %edx
+  801fe7:	68 08 70 80 00       	push   $0x807008
+  801fec:	e8 7d ec ff ff       	call   800c6e <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801ff1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff6:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ffb:	e8 a2 ff ff ff       	call   801fa2 <fsipc>
+  802000:	83 c4 10             	add    $0x10,%esp
+}
+  802003:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802006:	5b                   	pop    %ebx
+  802007:	5e                   	pop    %esi
+  802008:	5d                   	pop    %ebp
+  802009:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80200a:	89 d6                	mov    %edx,%esi
+  80200c:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802012:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802017:	29 f1                	sub    %esi,%ecx
+  802019:	39 c1                	cmp    %eax,%ecx
+  80201b:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  80201e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802021:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  802026:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  80202c:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  802032:	83 ec 0c             	sub    $0xc,%esp
+  802035:	6a 05                	push   $0x5
+  802037:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80203c:	e8 bf fd ff ff       	call   801e00 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  802041:	83 c4 10             	add    $0x10,%esp
+  802044:	eb bd                	jmp    802003 <file_write_direct+0x4a>
+
+00802046 <devfile_sync>:
+{
+  802046:	55                   	push   %ebp
+  802047:	89 e5                	mov    %esp,%ebp
+  802049:	57                   	push   %edi
+  80204a:	56                   	push   %esi
+  80204b:	53                   	push   %ebx
+  80204c:	83 ec 28             	sub    $0x28,%esp
+  80204f:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  802052:	56                   	push   %esi
+  802053:	e8 a5 f7 ff ff       	call   8017fd <fd2data>
+  802058:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  80205a:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  80205d:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  802064:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802067:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  80206c:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802070:	74 45                	je     8020b7 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  802072:	8b 46 14             	mov    0x14(%esi),%eax
+  802075:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  802078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80207d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802082:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  802085:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  802088:	39 cb                	cmp    %ecx,%ebx
+  80208a:	73 14                	jae    8020a0 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  80208c:	29 d9                	sub    %ebx,%ecx
+  80208e:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802091:	89 f0                	mov    %esi,%eax
+  802093:	e8 21 ff ff ff       	call   801fb9 <file_write_direct>
+  802098:	85 c0                	test   %eax,%eax
+  80209a:	7e 04                	jle    8020a0 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80209c:	01 c3                	add    %eax,%ebx
+  80209e:	eb e5                	jmp    802085 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  8020a0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8020a3:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  8020aa:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  8020ad:	85 c0                	test   %eax,%eax
+  8020af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020b4:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8020b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020ba:	5b                   	pop    %ebx
+  8020bb:	5e                   	pop    %esi
+  8020bc:	5f                   	pop    %edi
+  8020bd:	5d                   	pop    %ebp
+  8020be:	c3                   	ret
+
+008020bf <devfile_write>:
+{
+  8020bf:	55                   	push   %ebp
+  8020c0:	89 e5                	mov    %esp,%ebp
+  8020c2:	57                   	push   %edi
+  8020c3:	56                   	push   %esi
+  8020c4:	53                   	push   %ebx
+  8020c5:	83 ec 28             	sub    $0x28,%esp
+  8020c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020cb:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8020ce:	53                   	push   %ebx
+  8020cf:	e8 29 f7 ff ff       	call   8017fd <fd2data>
+  8020d4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8020d7:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8020da:	83 c4 10             	add    $0x10,%esp
+  8020dd:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8020e1:	74 43                	je     802126 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  8020e3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  8020ea:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8020ed:	85 c0                	test   %eax,%eax
+  8020ef:	74 43                	je     802134 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  8020f1:	89 c2                	mov    %eax,%edx
+  8020f3:	03 53 14             	add    0x14(%ebx),%edx
+  8020f6:	39 fa                	cmp    %edi,%edx
+  8020f8:	75 0b                	jne    802105 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  8020fa:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  8020fd:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  802103:	76 66                	jbe    80216b <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  802105:	83 ec 0c             	sub    $0xc,%esp
+  802108:	53                   	push   %ebx
+  802109:	e8 38 ff ff ff       	call   802046 <devfile_sync>
+  80210e:	83 c4 10             	add    $0x10,%esp
+  802111:	85 c0                	test   %eax,%eax
+  802113:	78 4e                	js     802163 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  802115:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80211b:	77 56                	ja     802173 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  80211d:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802120:	85 c0                	test   %eax,%eax
+  802122:	75 20                	jne    802144 <devfile_write+0x85>
+  802124:	eb 16                	jmp    80213c <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  802126:	89 f1                	mov    %esi,%ecx
+  802128:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80212b:	89 d8                	mov    %ebx,%eax
+  80212d:	e8 87 fe ff ff       	call   801fb9 <file_write_direct>
+  802132:	eb 2f                	jmp    802163 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  802134:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80213a:	77 37                	ja     802173 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  80213c:	89 7b 14             	mov    %edi,0x14(%ebx)
+  80213f:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  802144:	83 ec 04             	sub    $0x4,%esp
+  802147:	56                   	push   %esi
+  802148:	ff 75 0c             	push   0xc(%ebp)
+  80214b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80214e:	01 c1                	add    %eax,%ecx
+  802150:	51                   	push   %ecx
+  802151:	e8 18 eb ff ff       	call   800c6e <memmove>
+	ff->buf_wlen += n;
+  802156:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  802159:	01 f7                	add    %esi,%edi
+  80215b:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80215e:	89 f0                	mov    %esi,%eax
+  802160:	83 c4 10             	add    $0x10,%esp
+}
+  802163:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802166:	5b                   	pop    %ebx
+  802167:	5e                   	pop    %esi
+  802168:	5f                   	pop    %edi
+  802169:	5d                   	pop    %ebp
+  80216a:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  80216b:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802171:	76 d1                	jbe    802144 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  802173:	89 f1                	mov    %esi,%ecx
+  802175:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802178:	89 d8                	mov    %ebx,%eax
+  80217a:	e8 3a fe ff ff       	call   801fb9 <file_write_direct>
+  80217f:	eb e2                	jmp    802163 <devfile_write+0xa4>
+
+00802181 <devfile_trunc>:
+{
+  802181:	55                   	push   %ebp
+  802182:	89 e5                	mov    %esp,%ebp
+  802184:	53                   	push   %ebx
+  802185:	83 ec 10             	sub    $0x10,%esp
+  802188:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  80218b:	53                   	push   %ebx
+  80218c:	e8 b5 fe ff ff       	call   802046 <devfile_sync>
+  802191:	83 c4 10             	add    $0x10,%esp
+  802194:	85 c0                	test   %eax,%eax
+  802196:	78 1f                	js     8021b7 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802198:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80219b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8021a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021a3:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8021a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ad:	b8 02 00 00 00       	mov    $0x2,%eax
+  8021b2:	e8 eb fd ff ff       	call   801fa2 <fsipc>
+}
+  8021b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ba:	c9                   	leave
+  8021bb:	c3                   	ret
+
+008021bc <devfile_stat>:
+{
+  8021bc:	55                   	push   %ebp
+  8021bd:	89 e5                	mov    %esp,%ebp
+  8021bf:	56                   	push   %esi
+  8021c0:	53                   	push   %ebx
+  8021c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8021c4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  8021c7:	83 ec 0c             	sub    $0xc,%esp
+  8021ca:	53                   	push   %ebx
+  8021cb:	e8 76 fe ff ff       	call   802046 <devfile_sync>
+  8021d0:	83 c4 10             	add    $0x10,%esp
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	78 47                	js     80221e <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021d7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8021da:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8021df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8021e9:	e8 b4 fd ff ff       	call   801fa2 <fsipc>
+  8021ee:	85 c0                	test   %eax,%eax
+  8021f0:	78 2c                	js     80221e <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021f2:	83 ec 08             	sub    $0x8,%esp
+  8021f5:	68 00 70 80 00       	push   $0x807000
+  8021fa:	56                   	push   %esi
+  8021fb:	e8 e8 e8 ff ff       	call   800ae8 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802200:	a1 80 70 80 00       	mov    0x807080,%eax
+  802205:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80220b:	a1 84 70 80 00       	mov    0x807084,%eax
+  802210:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  802216:	83 c4 10             	add    $0x10,%esp
+  802219:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80221e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802221:	5b                   	pop    %ebx
+  802222:	5e                   	pop    %esi
+  802223:	5d                   	pop    %ebp
+  802224:	c3                   	ret
+
+00802225 <devfile_flush>:
+{
+  802225:	55                   	push   %ebp
+  802226:	89 e5                	mov    %esp,%ebp
+  802228:	56                   	push   %esi
+  802229:	53                   	push   %ebx
+  80222a:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  80222d:	83 ec 0c             	sub    $0xc,%esp
+  802230:	56                   	push   %esi
+  802231:	e8 10 fe ff ff       	call   802046 <devfile_sync>
+  802236:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  802238:	83 c4 10             	add    $0x10,%esp
+  80223b:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  80223f:	75 25                	jne    802266 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802241:	8b 46 0c             	mov    0xc(%esi),%eax
+  802244:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  802249:	ba 00 00 00 00       	mov    $0x0,%edx
+  80224e:	b8 06 00 00 00       	mov    $0x6,%eax
+  802253:	e8 4a fd ff ff       	call   801fa2 <fsipc>
+  802258:	85 c0                	test   %eax,%eax
+  80225a:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80225d:	89 d8                	mov    %ebx,%eax
+  80225f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802262:	5b                   	pop    %ebx
+  802263:	5e                   	pop    %esi
+  802264:	5d                   	pop    %ebp
+  802265:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  802266:	83 ec 0c             	sub    $0xc,%esp
+  802269:	56                   	push   %esi
+  80226a:	e8 8e f5 ff ff       	call   8017fd <fd2data>
+  80226f:	83 c4 08             	add    $0x8,%esp
+  802272:	50                   	push   %eax
+  802273:	6a 00                	push   $0x0
+  802275:	e8 07 ed ff ff       	call   800f81 <sys_page_unmap>
+  80227a:	83 c4 10             	add    $0x10,%esp
+  80227d:	eb c2                	jmp    802241 <devfile_flush+0x1c>
+
+0080227f <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  80227f:	55                   	push   %ebp
+  802280:	89 e5                	mov    %esp,%ebp
+  802282:	57                   	push   %edi
+  802283:	56                   	push   %esi
+  802284:	53                   	push   %ebx
+  802285:	83 ec 64             	sub    $0x64,%esp
+  802288:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  80228a:	52                   	push   %edx
+  80228b:	50                   	push   %eax
+  80228c:	e8 d9 f5 ff ff       	call   80186a <fd_lookup>
+  802291:	89 c1                	mov    %eax,%ecx
+  802293:	83 c4 10             	add    $0x10,%esp
+  802296:	85 c0                	test   %eax,%eax
+  802298:	0f 88 f2 00 00 00    	js     802390 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  80229e:	8b 07                	mov    (%edi),%eax
+  8022a0:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8022a6:	39 10                	cmp    %edx,(%eax)
+  8022a8:	0f 85 03 01 00 00    	jne    8023b1 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  8022ae:	a1 04 60 80 00       	mov    0x806004,%eax
+  8022b3:	8b 40 48             	mov    0x48(%eax),%eax
+  8022b6:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  8022bc:	0f 84 96 00 00 00    	je     802358 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  8022c2:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  8022c9:	0f 84 cb 00 00 00    	je     80239a <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8022cf:	b8 00 70 80 00       	mov    $0x807000,%eax
+  8022d4:	83 c8 07             	or     $0x7,%eax
+  8022d7:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8022da:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8022dd:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  8022e2:	83 ec 04             	sub    $0x4,%esp
+  8022e5:	68 07 04 00 00       	push   $0x407
+  8022ea:	53                   	push   %ebx
+  8022eb:	6a 00                	push   $0x0
+  8022ed:	e8 02 ec ff ff       	call   800ef4 <sys_page_alloc>
+  8022f2:	89 c1                	mov    %eax,%ecx
+  8022f4:	83 c4 10             	add    $0x10,%esp
+  8022f7:	85 c0                	test   %eax,%eax
+  8022f9:	0f 88 91 00 00 00    	js     802390 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  8022ff:	89 d8                	mov    %ebx,%eax
+  802301:	83 c8 07             	or     $0x7,%eax
+  802304:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  802306:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80230c:	83 c6 04             	add    $0x4,%esi
+  80230f:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  802315:	75 cb                	jne    8022e2 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  802317:	6a 12                	push   $0x12
+  802319:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80231c:	50                   	push   %eax
+  80231d:	6a 0c                	push   $0xc
+  80231f:	ff 35 c8 80 80 00    	push   0x8080c8
+  802325:	e8 36 f4 ff ff       	call   801760 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80232a:	83 c4 0c             	add    $0xc,%esp
+  80232d:	6a 00                	push   $0x0
+  80232f:	6a 00                	push   $0x0
+  802331:	6a 00                	push   $0x0
+  802333:	e8 d2 f2 ff ff       	call   80160a <ipc_recv>
+  802338:	89 c1                	mov    %eax,%ecx
+  80233a:	83 c4 10             	add    $0x10,%esp
+  80233d:	85 c0                	test   %eax,%eax
+  80233f:	78 4f                	js     802390 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  802341:	a1 04 60 80 00       	mov    0x806004,%eax
+  802346:	8b 40 48             	mov    0x48(%eax),%eax
+  802349:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  80234e:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  802355:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  802358:	83 ec 0c             	sub    $0xc,%esp
+  80235b:	ff 37                	push   (%edi)
+  80235d:	e8 e4 fc ff ff       	call   802046 <devfile_sync>
+  802362:	89 c1                	mov    %eax,%ecx
+  802364:	83 c4 10             	add    $0x10,%esp
+  802367:	85 c0                	test   %eax,%eax
+  802369:	78 25                	js     802390 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  80236b:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802371:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  802376:	ba 01 00 00 00       	mov    $0x1,%edx
+  80237b:	89 d0                	mov    %edx,%eax
+  80237d:	d3 e0                	shl    %cl,%eax
+  80237f:	85 d8                	test   %ebx,%eax
+  802381:	74 0d                	je     802390 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802383:	83 c1 01             	add    $0x1,%ecx
+  802386:	83 f9 10             	cmp    $0x10,%ecx
+  802389:	75 f0                	jne    80237b <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  80238b:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  802390:	89 c8                	mov    %ecx,%eax
+  802392:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802395:	5b                   	pop    %ebx
+  802396:	5e                   	pop    %esi
+  802397:	5f                   	pop    %edi
+  802398:	5d                   	pop    %ebp
+  802399:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80239a:	83 ec 0c             	sub    $0xc,%esp
+  80239d:	6a 01                	push   $0x1
+  80239f:	e8 0a f4 ff ff       	call   8017ae <ipc_find_env>
+  8023a4:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  8023a9:	83 c4 10             	add    $0x10,%esp
+  8023ac:	e9 1e ff ff ff       	jmp    8022cf <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  8023b1:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  8023b6:	eb d8                	jmp    802390 <fsring_slot+0x111>
+
+008023b8 <file_read_direct>:
+{
+  8023b8:	55                   	push   %ebp
+  8023b9:	89 e5                	mov    %esp,%ebp
+  8023bb:	57                   	push   %edi
+  8023bc:	56                   	push   %esi
+  8023bd:	53                   	push   %ebx
+  8023be:	83 ec 1c             	sub    $0x1c,%esp
+  8023c1:	89 c7                	mov    %eax,%edi
+  8023c3:	89 d6                	mov    %edx,%esi
+  8023c5:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  8023c7:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  8023cd:	77 52                	ja     802421 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023cf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023d2:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8023d7:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8023dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023e7:	e8 b6 fb ff ff       	call   801fa2 <fsipc>
+  8023ec:	89 c7                	mov    %eax,%edi
+  8023ee:	85 c0                	test   %eax,%eax
+  8023f0:	78 25                	js     802417 <file_read_direct+0x5f>
+	assert(r <= n);
+  8023f2:	39 c3                	cmp    %eax,%ebx
+  8023f4:	0f 82 87 00 00 00    	jb     802481 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  8023fa:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8023ff:	0f 8f 95 00 00 00    	jg     80249a <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802405:	83 ec 04             	sub    $0x4,%esp
+  802408:	50                   	push   %eax
+  802409:	68 00 70 80 00       	push   $0x807000
+  80240e:	56                   	push   %esi
+  80240f:	e8 5a e8 ff ff       	call   800c6e <memmove>
+	return r;
+  802414:	83 c4 10             	add    $0x10,%esp
+}
+  802417:	89 f8                	mov    %edi,%eax
+  802419:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80241c:	5b                   	pop    %ebx
+  80241d:	5e                   	pop    %esi
+  80241e:	5f                   	pop    %edi
+  80241f:	5d                   	pop    %ebp
+  802420:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802421:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802427:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80242c:	29 d1                	sub    %edx,%ecx
+  80242e:	39 d9                	cmp    %ebx,%ecx
+  802430:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802433:	89 f0                	mov    %esi,%eax
+  802435:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  802438:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80243b:	eb 0f                	jmp    80244c <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  80243d:	0f b6 10             	movzbl (%eax),%edx
+  802440:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802442:	05 00 10 00 00       	add    $0x1000,%eax
+  802447:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80244c:	39 c8                	cmp    %ecx,%eax
+  80244e:	72 ed                	jb     80243d <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802450:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802453:	8b 47 0c             	mov    0xc(%edi),%eax
+  802456:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  80245b:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802461:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  802467:	83 ec 0c             	sub    $0xc,%esp
+  80246a:	6a 07                	push   $0x7
+  80246c:	89 d9                	mov    %ebx,%ecx
+  80246e:	89 f2                	mov    %esi,%edx
+  802470:	b8 09 00 00 00       	mov    $0x9,%eax
+  802475:	e8 86 f9 ff ff       	call   801e00 <fsipc_pages>
+  80247a:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  80247c:	83 c4 10             	add    $0x10,%esp
+  80247f:	eb 96                	jmp    802417 <file_read_direct+0x5f>
+	assert(r <= n);
+  802481:	68 23 41 80 00       	push   $0x804123
+  802486:	68 a8 3b 80 00       	push   $0x803ba8
+  80248b:	68 dc 00 00 00       	push   $0xdc
+  802490:	68 18 41 80 00       	push   $0x804118
+  802495:	e8 85 df ff ff       	call   80041f <_panic>
+	assert(r <= PGSIZE);
+  80249a:	68 34 41 80 00       	push   $0x804134
+  80249f:	68 a8 3b 80 00       	push   $0x803ba8
+  8024a4:	68 dd 00 00 00       	push   $0xdd
+  8024a9:	68 18 41 80 00       	push   $0x804118
+  8024ae:	e8 6c df ff ff       	call   80041f <_panic>
+
+008024b3 <devfile_read>:
+{
+  8024b3:	55                   	push   %ebp
+  8024b4:	89 e5                	mov    %esp,%ebp
+  8024b6:	57                   	push   %edi
+  8024b7:	56                   	push   %esi
+  8024b8:	53                   	push   %ebx
+  8024b9:	83 ec 28             	sub    $0x28,%esp
+  8024bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8024bf:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8024c2:	53                   	push   %ebx
+  8024c3:	e8 35 f3 ff ff       	call   8017fd <fd2data>
+  8024c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8024cb:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8024ce:	83 c4 10             	add    $0x10,%esp
+  8024d1:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8024d5:	74 7d                	je     802554 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8024d7:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8024db:	0f 85 81 00 00 00    	jne    802562 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  8024e1:	8b 43 18             	mov    0x18(%ebx),%eax
+  8024e4:	85 c0                	test   %eax,%eax
+  8024e6:	74 0d                	je     8024f5 <devfile_read+0x42>
+  8024e8:	8b 53 14             	mov    0x14(%ebx),%edx
+  8024eb:	39 fa                	cmp    %edi,%edx
+  8024ed:	7f 06                	jg     8024f5 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8024ef:	01 c2                	add    %eax,%edx
+  8024f1:	39 d7                	cmp    %edx,%edi
+  8024f3:	72 28                	jb     80251d <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8024f5:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8024fc:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802502:	77 74                	ja     802578 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  802504:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802509:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80250c:	89 d8                	mov    %ebx,%eax
+  80250e:	e8 a5 fe ff ff       	call   8023b8 <file_read_direct>
+  802513:	85 c0                	test   %eax,%eax
+  802515:	7e 35                	jle    80254c <devfile_read+0x99>
+		ff->buf_base = pos;
+  802517:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  80251a:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  80251d:	8b 53 14             	mov    0x14(%ebx),%edx
+  802520:	89 d0                	mov    %edx,%eax
+  802522:	03 43 18             	add    0x18(%ebx),%eax
+  802525:	29 f8                	sub    %edi,%eax
+  802527:	39 f0                	cmp    %esi,%eax
+  802529:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  80252c:	83 ec 04             	sub    $0x4,%esp
+  80252f:	56                   	push   %esi
+  802530:	89 f8                	mov    %edi,%eax
+  802532:	29 d0                	sub    %edx,%eax
+  802534:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802537:	01 c1                	add    %eax,%ecx
+  802539:	51                   	push   %ecx
+  80253a:	ff 75 0c             	push   0xc(%ebp)
+  80253d:	e8 2c e7 ff ff       	call   800c6e <memmove>
+	fd->fd_offset = pos + n;
+  802542:	01 f7                	add    %esi,%edi
+  802544:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802547:	89 f0                	mov    %esi,%eax
+  802549:	83 c4 10             	add    $0x10,%esp
+}
+  80254c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80254f:	5b                   	pop    %ebx
+  802550:	5e                   	pop    %esi
+  802551:	5f                   	pop    %edi
+  802552:	5d                   	pop    %ebp
+  802553:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802554:	89 f1                	mov    %esi,%ecx
+  802556:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802559:	89 d8                	mov    %ebx,%eax
+  80255b:	e8 58 fe ff ff       	call   8023b8 <file_read_direct>
+  802560:	eb ea                	jmp    80254c <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802562:	83 ec 0c             	sub    $0xc,%esp
+  802565:	53                   	push   %ebx
+  802566:	e8 db fa ff ff       	call   802046 <devfile_sync>
+  80256b:	83 c4 10             	add    $0x10,%esp
+  80256e:	85 c0                	test   %eax,%eax
+  802570:	0f 89 6b ff ff ff    	jns    8024e1 <devfile_read+0x2e>
+  802576:	eb d4                	jmp    80254c <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  802578:	89 f1                	mov    %esi,%ecx
+  80257a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80257d:	89 d8                	mov    %ebx,%eax
+  80257f:	e8 34 fe ff ff       	call   8023b8 <file_read_direct>
+  802584:	eb c6                	jmp    80254c <devfile_read+0x99>
+
+00802586 <open>:
+{
+  802586:	55                   	push   %ebp
+  802587:	89 e5                	mov    %esp,%ebp
+  802589:	56                   	push   %esi
+  80258a:	53                   	push   %ebx
+  80258b:	83 ec 1c             	sub    $0x1c,%esp
+  80258e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802591:	56                   	push   %esi
+  802592:	e8 16 e5 ff ff       	call   800aad <strlen>
+  802597:	83 c4 10             	add    $0x10,%esp
+  80259a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80259f:	0f 8f a0 00 00 00    	jg     802645 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  8025a5:	83 ec 0c             	sub    $0xc,%esp
+  8025a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025ab:	50                   	push   %eax
+  8025ac:	e8 63 f2 ff ff       	call   801814 <fd_alloc>
+  8025b1:	89 c3                	mov    %eax,%ebx
+  8025b3:	83 c4 10             	add    $0x10,%esp
+  8025b6:	85 c0                	test   %eax,%eax
+  8025b8:	78 45                	js     8025ff <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  8025ba:	83 ec 08             	sub    $0x8,%esp
+  8025bd:	56                   	push   %esi
+  8025be:	68 00 70 80 00       	push   $0x807000
+  8025c3:	e8 20 e5 ff ff       	call   800ae8 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8025c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025cb:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8025d0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025d8:	e8 c5 f9 ff ff       	call   801fa2 <fsipc>
+  8025dd:	89 c3                	mov    %eax,%ebx
+  8025df:	83 c4 10             	add    $0x10,%esp
+  8025e2:	85 c0                	test   %eax,%eax
+  8025e4:	78 22                	js     802608 <open+0x82>
+	if (!(mode & O_NOBUF)
+  8025e6:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8025ed:	74 2b                	je     80261a <open+0x94>
+	return fd2num(fd);
+  8025ef:	83 ec 0c             	sub    $0xc,%esp
+  8025f2:	ff 75 f4             	push   -0xc(%ebp)
+  8025f5:	e8 f3 f1 ff ff       	call   8017ed <fd2num>
+  8025fa:	89 c3                	mov    %eax,%ebx
+  8025fc:	83 c4 10             	add    $0x10,%esp
+}
+  8025ff:	89 d8                	mov    %ebx,%eax
+  802601:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802604:	5b                   	pop    %ebx
+  802605:	5e                   	pop    %esi
+  802606:	5d                   	pop    %ebp
+  802607:	c3                   	ret
+		fd_close(fd, 0);
+  802608:	83 ec 08             	sub    $0x8,%esp
+  80260b:	6a 00                	push   $0x0
+  80260d:	ff 75 f4             	push   -0xc(%ebp)
+  802610:	e8 f8 f2 ff ff       	call   80190d <fd_close>
+		return r;
+  802615:	83 c4 10             	add    $0x10,%esp
+  802618:	eb e5                	jmp    8025ff <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  80261a:	83 ec 0c             	sub    $0xc,%esp
+  80261d:	ff 75 f4             	push   -0xc(%ebp)
+  802620:	e8 d8 f1 ff ff       	call   8017fd <fd2data>
+  802625:	83 c4 0c             	add    $0xc,%esp
+  802628:	68 07 04 00 00       	push   $0x407
+  80262d:	50                   	push   %eax
+  80262e:	6a 00                	push   $0x0
+  802630:	e8 bf e8 ff ff       	call   800ef4 <sys_page_alloc>
+  802635:	83 c4 10             	add    $0x10,%esp
+  802638:	85 c0                	test   %eax,%eax
+  80263a:	75 b3                	jne    8025ef <open+0x69>
+		fd->fd_file.buffered = 1;
+  80263c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80263f:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802643:	eb aa                	jmp    8025ef <open+0x69>
+		return -E_BAD_PATH;
+  802645:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80264a:	eb b3                	jmp    8025ff <open+0x79>
+
+0080264c <readdir>:
+{
+  80264c:	55                   	push   %ebp
+  80264d:	89 e5                	mov    %esp,%ebp
+  80264f:	53                   	push   %ebx
+  802650:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802653:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802656:	50                   	push   %eax
+  802657:	ff 75 08             	push   0x8(%ebp)
+  80265a:	e8 0b f2 ff ff       	call   80186a <fd_lookup>
+  80265f:	89 c3                	mov    %eax,%ebx
+  802661:	83 c4 10             	add    $0x10,%esp
+  802664:	85 c0                	test   %eax,%eax
+  802666:	78 73                	js     8026db <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802668:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80266b:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802671:	39 08                	cmp    %ecx,(%eax)
+  802673:	0f 85 82 00 00 00    	jne    8026fb <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802679:	83 ec 0c             	sub    $0xc,%esp
+  80267c:	50                   	push   %eax
+  80267d:	e8 c4 f9 ff ff       	call   802046 <devfile_sync>
+  802682:	89 c3                	mov    %eax,%ebx
+  802684:	83 c4 10             	add    $0x10,%esp
+  802687:	85 c0                	test   %eax,%eax
+  802689:	78 50                	js     8026db <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  80268b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80268e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802691:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  802696:	8b 45 10             	mov    0x10(%ebp),%eax
+  802699:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  80269e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026a1:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  8026a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8026b0:	e8 ed f8 ff ff       	call   801fa2 <fsipc>
+  8026b5:	89 c3                	mov    %eax,%ebx
+  8026b7:	85 c0                	test   %eax,%eax
+  8026b9:	7e 20                	jle    8026db <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  8026bb:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8026be:	72 22                	jb     8026e2 <readdir+0x96>
+  8026c0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8026c5:	7f 1b                	jg     8026e2 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8026c7:	83 ec 04             	sub    $0x4,%esp
+  8026ca:	50                   	push   %eax
+  8026cb:	68 00 70 80 00       	push   $0x807000
+  8026d0:	ff 75 0c             	push   0xc(%ebp)
+  8026d3:	e8 96 e5 ff ff       	call   800c6e <memmove>
+	return r;
+  8026d8:	83 c4 10             	add    $0x10,%esp
+}
+  8026db:	89 d8                	mov    %ebx,%eax
+  8026dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026e0:	c9                   	leave
+  8026e1:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8026e2:	68 2a 41 80 00       	push   $0x80412a
+  8026e7:	68 a8 3b 80 00       	push   $0x803ba8
+  8026ec:	68 86 01 00 00       	push   $0x186
+  8026f1:	68 18 41 80 00       	push   $0x804118
+  8026f6:	e8 24 dd ff ff       	call   80041f <_panic>
+		return -E_NOT_SUPP;
+  8026fb:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802700:	eb d9                	jmp    8026db <readdir+0x8f>
+
+00802702 <munmap>:
+{
+  802702:	55                   	push   %ebp
+  802703:	89 e5                	mov    %esp,%ebp
+  802705:	56                   	push   %esi
+  802706:	53                   	push   %ebx
+  802707:	8b 75 08             	mov    0x8(%ebp),%esi
+  80270a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80270d:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  802713:	75 41                	jne    802756 <munmap+0x54>
+  802715:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  80271b:	77 39                	ja     802756 <munmap+0x54>
+  80271d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802722:	29 f0                	sub    %esi,%eax
+  802724:	39 d0                	cmp    %edx,%eax
+  802726:	72 35                	jb     80275d <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802728:	89 f3                	mov    %esi,%ebx
+  80272a:	01 d6                	add    %edx,%esi
+  80272c:	39 f3                	cmp    %esi,%ebx
+  80272e:	73 1a                	jae    80274a <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802730:	83 ec 08             	sub    $0x8,%esp
+  802733:	53                   	push   %ebx
+  802734:	6a 00                	push   $0x0
+  802736:	e8 46 e8 ff ff       	call   800f81 <sys_page_unmap>
+  80273b:	83 c4 10             	add    $0x10,%esp
+  80273e:	85 c0                	test   %eax,%eax
+  802740:	78 0d                	js     80274f <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802742:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802748:	eb e2                	jmp    80272c <munmap+0x2a>
+	return 0;
+  80274a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80274f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802752:	5b                   	pop    %ebx
+  802753:	5e                   	pop    %esi
+  802754:	5d                   	pop    %ebp
+  802755:	c3                   	ret
+		return -E_INVAL;
+  802756:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80275b:	eb f2                	jmp    80274f <munmap+0x4d>
+  80275d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802762:	eb eb                	jmp    80274f <munmap+0x4d>
+
+00802764 <mmap>:
+{
+  802764:	55                   	push   %ebp
+  802765:	89 e5                	mov    %esp,%ebp
+  802767:	57                   	push   %edi
+  802768:	56                   	push   %esi
+  802769:	53                   	push   %ebx
+  80276a:	83 ec 34             	sub    $0x34,%esp
+  80276d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802770:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802773:	50                   	push   %eax
+  802774:	ff 75 18             	push   0x18(%ebp)
+  802777:	e8 ee f0 ff ff       	call   80186a <fd_lookup>
+  80277c:	89 c3                	mov    %eax,%ebx
+  80277e:	83 c4 10             	add    $0x10,%esp
+  802781:	85 c0                	test   %eax,%eax
+  802783:	0f 88 0e 01 00 00    	js     802897 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802789:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80278c:	a1 20 50 80 00       	mov    0x805020,%eax
+  802791:	39 02                	cmp    %eax,(%edx)
+  802793:	0f 85 50 01 00 00    	jne    8028e9 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802799:	8b 45 10             	mov    0x10(%ebp),%eax
+  80279c:	83 e0 02             	and    $0x2,%eax
+  80279f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8027a2:	74 0a                	je     8027ae <mmap+0x4a>
+  8027a4:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8027a8:	0f 84 42 01 00 00    	je     8028f0 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  8027ae:	8b 42 08             	mov    0x8(%edx),%eax
+  8027b1:	83 e0 03             	and    $0x3,%eax
+  8027b4:	83 f8 01             	cmp    $0x1,%eax
+  8027b7:	0f 84 3a 01 00 00    	je     8028f7 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8027bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027c0:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8027c3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8027c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8027cb:	0f 85 2d 01 00 00    	jne    8028fe <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8027d1:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8027d5:	0f 88 2a 01 00 00    	js     802905 <mmap+0x1a1>
+  8027db:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8027e2:	0f 87 1d 01 00 00    	ja     802905 <mmap+0x1a1>
+  8027e8:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8027ed:	2b 45 08             	sub    0x8(%ebp),%eax
+  8027f0:	39 f8                	cmp    %edi,%eax
+  8027f2:	0f 82 14 01 00 00    	jb     80290c <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8027f8:	83 ec 0c             	sub    $0xc,%esp
+  8027fb:	52                   	push   %edx
+  8027fc:	e8 45 f8 ff ff       	call   802046 <devfile_sync>
+  802801:	89 c3                	mov    %eax,%ebx
+  802803:	83 c4 10             	add    $0x10,%esp
+  802806:	85 c0                	test   %eax,%eax
+  802808:	0f 88 89 00 00 00    	js     802897 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  80280e:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802814:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80281a:	be 00 00 00 00       	mov    $0x0,%esi
+  80281f:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802822:	39 fe                	cmp    %edi,%esi
+  802824:	73 7b                	jae    8028a1 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  802826:	89 f8                	mov    %edi,%eax
+  802828:	29 f0                	sub    %esi,%eax
+  80282a:	c1 e8 0c             	shr    $0xc,%eax
+  80282d:	ba 40 00 00 00       	mov    $0x40,%edx
+  802832:	39 d0                	cmp    %edx,%eax
+  802834:	0f 47 c2             	cmova  %edx,%eax
+  802837:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80283a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80283d:	8b 52 0c             	mov    0xc(%edx),%edx
+  802840:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  802846:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802849:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  80284f:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802854:	89 f2                	mov    %esi,%edx
+  802856:	03 55 08             	add    0x8(%ebp),%edx
+  802859:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80285c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802861:	e8 ea f6 ff ff       	call   801f50 <fsipcv>
+  802866:	85 c0                	test   %eax,%eax
+  802868:	7e 12                	jle    80287c <mmap+0x118>
+  80286a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80286d:	85 c0                	test   %eax,%eax
+  80286f:	0f 84 9e 00 00 00    	je     802913 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802875:	c1 e0 0c             	shl    $0xc,%eax
+  802878:	01 c6                	add    %eax,%esi
+  80287a:	eb a6                	jmp    802822 <mmap+0xbe>
+			munmap(addr, done);
+  80287c:	89 c3                	mov    %eax,%ebx
+  80287e:	83 ec 08             	sub    $0x8,%esp
+  802881:	56                   	push   %esi
+  802882:	ff 75 08             	push   0x8(%ebp)
+  802885:	e8 78 fe ff ff       	call   802702 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80288a:	83 c4 10             	add    $0x10,%esp
+  80288d:	85 db                	test   %ebx,%ebx
+  80288f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802894:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802897:	89 d8                	mov    %ebx,%eax
+  802899:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80289c:	5b                   	pop    %ebx
+  80289d:	5e                   	pop    %esi
+  80289e:	5f                   	pop    %edi
+  80289f:	5d                   	pop    %ebp
+  8028a0:	c3                   	ret
+	if (prot & PROT_WRITE)
+  8028a1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8028a4:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8028a6:	85 c0                	test   %eax,%eax
+  8028a8:	74 ed                	je     802897 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8028aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8028af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8028b2:	39 fe                	cmp    %edi,%esi
+  8028b4:	73 2e                	jae    8028e4 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8028b6:	83 ec 0c             	sub    $0xc,%esp
+  8028b9:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8028bc:	50                   	push   %eax
+  8028bd:	e8 4a eb ff ff       	call   80140c <cowpage>
+  8028c2:	83 c4 10             	add    $0x10,%esp
+  8028c5:	85 c0                	test   %eax,%eax
+  8028c7:	78 08                	js     8028d1 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8028c9:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8028cf:	eb e1                	jmp    8028b2 <mmap+0x14e>
+				munmap(addr, len);
+  8028d1:	89 c3                	mov    %eax,%ebx
+  8028d3:	83 ec 08             	sub    $0x8,%esp
+  8028d6:	57                   	push   %edi
+  8028d7:	ff 75 08             	push   0x8(%ebp)
+  8028da:	e8 23 fe ff ff       	call   802702 <munmap>
+				return r;
+  8028df:	83 c4 10             	add    $0x10,%esp
+  8028e2:	eb b3                	jmp    802897 <mmap+0x133>
+	return 0;
+  8028e4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8028e7:	eb ae                	jmp    802897 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8028e9:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8028ee:	eb a7                	jmp    802897 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8028f0:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8028f5:	eb a0                	jmp    802897 <mmap+0x133>
+		return -E_INVAL;
+  8028f7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8028fc:	eb 99                	jmp    802897 <mmap+0x133>
+  8028fe:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802903:	eb 92                	jmp    802897 <mmap+0x133>
+  802905:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80290a:	eb 8b                	jmp    802897 <mmap+0x133>
+  80290c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802911:	eb 84                	jmp    802897 <mmap+0x133>
+			munmap(addr, done);
+  802913:	83 ec 08             	sub    $0x8,%esp
+  802916:	56                   	push   %esi
+  802917:	ff 75 08             	push   0x8(%ebp)
+  80291a:	e8 e3 fd ff ff       	call   802702 <munmap>
+  80291f:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802922:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802927:	e9 6b ff ff ff       	jmp    802897 <mmap+0x133>
+
+0080292c <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80292c:	55                   	push   %ebp
+  80292d:	89 e5                	mov    %esp,%ebp
+  80292f:	56                   	push   %esi
+  802930:	53                   	push   %ebx
+  802931:	83 ec 10             	sub    $0x10,%esp
+  802934:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802937:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80293a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80293d:	e8 3d f9 ff ff       	call   80227f <fsring_slot>
+  802942:	85 c0                	test   %eax,%eax
+  802944:	78 60                	js     8029a6 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802946:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802949:	8b 56 08             	mov    0x8(%esi),%edx
+  80294c:	83 e2 03             	and    $0x3,%edx
+  80294f:	83 fa 01             	cmp    $0x1,%edx
+  802952:	74 59                	je     8029ad <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802954:	ba 01 00 00 00       	mov    $0x1,%edx
+  802959:	89 c1                	mov    %eax,%ecx
+  80295b:	d3 e2                	shl    %cl,%edx
+  80295d:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802963:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802966:	c1 e2 02             	shl    $0x2,%edx
+  802969:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  80296f:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  802976:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802979:	8b 55 18             	mov    0x18(%ebp),%edx
+  80297c:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80297f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802982:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802985:	83 ec 08             	sub    $0x8,%esp
+  802988:	50                   	push   %eax
+  802989:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80298e:	39 c3                	cmp    %eax,%ebx
+  802990:	0f 47 d8             	cmova  %eax,%ebx
+  802993:	53                   	push   %ebx
+  802994:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802997:	89 f2                	mov    %esi,%edx
+  802999:	b8 03 00 00 00       	mov    $0x3,%eax
+  80299e:	e8 1e f5 ff ff       	call   801ec1 <fsring_post>
+  8029a3:	83 c4 10             	add    $0x10,%esp
+}
+  8029a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029a9:	5b                   	pop    %ebx
+  8029aa:	5e                   	pop    %esi
+  8029ab:	5d                   	pop    %ebp
+  8029ac:	c3                   	ret
+		return -E_INVAL;
+  8029ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029b2:	eb f2                	jmp    8029a6 <fsring_read+0x7a>
+
+008029b4 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8029b4:	55                   	push   %ebp
+  8029b5:	89 e5                	mov    %esp,%ebp
+  8029b7:	56                   	push   %esi
+  8029b8:	53                   	push   %ebx
+  8029b9:	83 ec 10             	sub    $0x10,%esp
+  8029bc:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8029bf:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8029c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c5:	e8 b5 f8 ff ff       	call   80227f <fsring_slot>
+  8029ca:	89 c3                	mov    %eax,%ebx
+  8029cc:	85 c0                	test   %eax,%eax
+  8029ce:	78 77                	js     802a47 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8029d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029d3:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8029d7:	74 77                	je     802a50 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8029d9:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8029de:	39 c6                	cmp    %eax,%esi
+  8029e0:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8029e3:	83 ec 04             	sub    $0x4,%esp
+  8029e6:	56                   	push   %esi
+  8029e7:	ff 75 0c             	push   0xc(%ebp)
+  8029ea:	89 d8                	mov    %ebx,%eax
+  8029ec:	c1 e0 0c             	shl    $0xc,%eax
+  8029ef:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8029f5:	50                   	push   %eax
+  8029f6:	e8 73 e2 ff ff       	call   800c6e <memmove>
+	fsring_busy |= 1 << slot;
+  8029fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a00:	89 d9                	mov    %ebx,%ecx
+  802a02:	d3 e0                	shl    %cl,%eax
+  802a04:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802a0a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802a0d:	c1 e0 02             	shl    $0x2,%eax
+  802a10:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  802a16:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  802a1d:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802a20:	8b 45 18             	mov    0x18(%ebp),%eax
+  802a23:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  802a26:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802a2d:	83 c4 08             	add    $0x8,%esp
+  802a30:	53                   	push   %ebx
+  802a31:	56                   	push   %esi
+  802a32:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802a35:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a38:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a3d:	e8 7f f4 ff ff       	call   801ec1 <fsring_post>
+  802a42:	89 c3                	mov    %eax,%ebx
+  802a44:	83 c4 10             	add    $0x10,%esp
+}
+  802a47:	89 d8                	mov    %ebx,%eax
+  802a49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a4c:	5b                   	pop    %ebx
+  802a4d:	5e                   	pop    %esi
+  802a4e:	5d                   	pop    %ebp
+  802a4f:	c3                   	ret
+		return -E_INVAL;
+  802a50:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802a55:	eb f0                	jmp    802a47 <fsring_write+0x93>
+
+00802a57 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802a57:	55                   	push   %ebp
+  802a58:	89 e5                	mov    %esp,%ebp
+  802a5a:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802a5d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a60:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a63:	e8 17 f8 ff ff       	call   80227f <fsring_slot>
+  802a68:	85 c0                	test   %eax,%eax
+  802a6a:	78 4c                	js     802ab8 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802a6c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a71:	89 c1                	mov    %eax,%ecx
+  802a73:	d3 e2                	shl    %cl,%edx
+  802a75:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802a7b:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802a7e:	c1 e2 02             	shl    $0x2,%edx
+  802a81:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  802a87:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  802a8e:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802a91:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a94:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802a97:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a9a:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802a9d:	83 ec 08             	sub    $0x8,%esp
+  802aa0:	50                   	push   %eax
+  802aa1:	6a 00                	push   $0x0
+  802aa3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802aa8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802aab:	b8 05 00 00 00       	mov    $0x5,%eax
+  802ab0:	e8 0c f4 ff ff       	call   801ec1 <fsring_post>
+  802ab5:	83 c4 10             	add    $0x10,%esp
+}
+  802ab8:	c9                   	leave
+  802ab9:	c3                   	ret
+
+00802aba <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802aba:	55                   	push   %ebp
+  802abb:	89 e5                	mov    %esp,%ebp
+  802abd:	57                   	push   %edi
+  802abe:	56                   	push   %esi
+  802abf:	53                   	push   %ebx
+  802ac0:	83 ec 1c             	sub    $0x1c,%esp
+  802ac3:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802ac7:	a1 04 60 80 00       	mov    0x806004,%eax
+  802acc:	8b 40 48             	mov    0x48(%eax),%eax
+  802acf:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  802ad5:	74 12                	je     802ae9 <fsring_reap+0x2f>
+		return 0;
+  802ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802adc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802adf:	5b                   	pop    %ebx
+  802ae0:	5e                   	pop    %esi
+  802ae1:	5f                   	pop    %edi
+  802ae2:	5d                   	pop    %ebp
+  802ae3:	c3                   	ret
+		sys_yield();
+  802ae4:	e8 ec e3 ff ff       	call   800ed5 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802ae9:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802aef:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802af4:	39 c2                	cmp    %eax,%edx
+  802af6:	75 18                	jne    802b10 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802af8:	84 db                	test   %bl,%bl
+  802afa:	0f 84 21 01 00 00    	je     802c21 <fsring_reap+0x167>
+  802b00:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  802b07:	75 db                	jne    802ae4 <fsring_reap+0x2a>
+			return 0;
+  802b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b0e:	eb cc                	jmp    802adc <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802b10:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802b15:	83 e0 0f             	and    $0xf,%eax
+  802b18:	83 c0 2a             	add    $0x2a,%eax
+  802b1b:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802b22:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802b29:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802b2e:	83 c0 01             	add    $0x1,%eax
+  802b31:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802b36:	83 fb 0f             	cmp    $0xf,%ebx
+  802b39:	77 5b                	ja     802b96 <fsring_reap+0xdc>
+  802b3b:	be 01 00 00 00       	mov    $0x1,%esi
+  802b40:	89 d9                	mov    %ebx,%ecx
+  802b42:	d3 e6                	shl    %cl,%esi
+  802b44:	89 f0                	mov    %esi,%eax
+  802b46:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  802b4c:	74 48                	je     802b96 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802b4e:	89 d8                	mov    %ebx,%eax
+  802b50:	c1 e0 0c             	shl    $0xc,%eax
+  802b53:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802b59:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802b5c:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802b5f:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  802b66:	83 f8 03             	cmp    $0x3,%eax
+  802b69:	74 40                	je     802bab <fsring_reap+0xf1>
+  802b6b:	83 f8 05             	cmp    $0x5,%eax
+  802b6e:	74 64                	je     802bd4 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802b70:	f7 d6                	not    %esi
+  802b72:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802b78:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802b7b:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  802b82:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b85:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802b87:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b8a:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802b8c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b91:	e9 46 ff ff ff       	jmp    802adc <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802b96:	53                   	push   %ebx
+  802b97:	68 40 41 80 00       	push   $0x804140
+  802b9c:	68 8f 02 00 00       	push   $0x28f
+  802ba1:	68 18 41 80 00       	push   $0x804118
+  802ba6:	e8 74 d8 ff ff       	call   80041f <_panic>
+		if (cqe.cqe_result > 0)
+  802bab:	85 ff                	test   %edi,%edi
+  802bad:	7e c1                	jle    802b70 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802baf:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802bb2:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802bb7:	39 c7                	cmp    %eax,%edi
+  802bb9:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802bbc:	50                   	push   %eax
+  802bbd:	ff 75 e4             	push   -0x1c(%ebp)
+  802bc0:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802bc3:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  802bca:	e8 9f e0 ff ff       	call   800c6e <memmove>
+  802bcf:	83 c4 10             	add    $0x10,%esp
+  802bd2:	eb 9c                	jmp    802b70 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802bd4:	85 ff                	test   %edi,%edi
+  802bd6:	75 98                	jne    802b70 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802bd8:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802bdb:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802be2:	83 ec 08             	sub    $0x8,%esp
+  802be5:	ff 75 e4             	push   -0x1c(%ebp)
+  802be8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802beb:	51                   	push   %ecx
+  802bec:	e8 f7 de ff ff       	call   800ae8 <strcpy>
+			st->st_size = ret->ret_size;
+  802bf1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802bf4:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802bfa:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802bfd:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802c03:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802c09:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802c0f:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  802c16:	50 80 00 
+  802c19:	83 c4 10             	add    $0x10,%esp
+  802c1c:	e9 4f ff ff ff       	jmp    802b70 <fsring_reap+0xb6>
+			return 0;
+  802c21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c26:	e9 b1 fe ff ff       	jmp    802adc <fsring_reap+0x22>
+
+00802c2b <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802c2b:	55                   	push   %ebp
+  802c2c:	89 e5                	mov    %esp,%ebp
+  802c2e:	57                   	push   %edi
+  802c2f:	56                   	push   %esi
+  802c30:	53                   	push   %ebx
+  802c31:	83 ec 28             	sub    $0x28,%esp
+  802c34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802c37:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802c3a:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802c3d:	53                   	push   %ebx
+  802c3e:	e8 6a de ff ff       	call   800aad <strlen>
+  802c43:	83 c4 10             	add    $0x10,%esp
+  802c46:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802c4b:	0f 8f 02 01 00 00    	jg     802d53 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802c51:	83 ec 08             	sub    $0x8,%esp
+  802c54:	53                   	push   %ebx
+  802c55:	68 00 70 80 00       	push   $0x807000
+  802c5a:	e8 89 de ff ff       	call   800ae8 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802c5f:	83 c4 10             	add    $0x10,%esp
+  802c62:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802c68:	76 69                	jbe    802cd3 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802c6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c6d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802c73:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802c78:	29 d1                	sub    %edx,%ecx
+  802c7a:	39 f9                	cmp    %edi,%ecx
+  802c7c:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802c7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c82:	89 f9                	mov    %edi,%ecx
+  802c84:	01 c1                	add    %eax,%ecx
+  802c86:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802c89:	eb 0f                	jmp    802c9a <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802c8b:	0f b6 10             	movzbl (%eax),%edx
+  802c8e:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802c90:	05 00 10 00 00       	add    $0x1000,%eax
+  802c95:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802c9a:	39 c8                	cmp    %ecx,%eax
+  802c9c:	72 ed                	jb     802c8b <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802c9e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ca1:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802ca7:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802cad:	83 ec 0c             	sub    $0xc,%esp
+  802cb0:	6a 07                	push   $0x7
+  802cb2:	89 f9                	mov    %edi,%ecx
+  802cb4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802cb7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802cbc:	e8 3f f1 ff ff       	call   801e00 <fsipc_pages>
+  802cc1:	89 c7                	mov    %eax,%edi
+  802cc3:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802cc6:	85 f6                	test   %esi,%esi
+  802cc8:	74 7f                	je     802d49 <file_slurp+0x11e>
+  802cca:	8d 43 01             	lea    0x1(%ebx),%eax
+  802ccd:	85 ff                	test   %edi,%edi
+  802ccf:	79 3c                	jns    802d0d <file_slurp+0xe2>
+  802cd1:	eb 76                	jmp    802d49 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802cd3:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802cd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cde:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802ce3:	e8 ba f2 ff ff       	call   801fa2 <fsipc>
+  802ce8:	89 c7                	mov    %eax,%edi
+  802cea:	85 c0                	test   %eax,%eax
+  802cec:	7e d8                	jle    802cc6 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802cee:	83 ec 04             	sub    $0x4,%esp
+  802cf1:	50                   	push   %eax
+  802cf2:	68 08 70 80 00       	push   $0x807008
+  802cf7:	ff 75 0c             	push   0xc(%ebp)
+  802cfa:	e8 6f df ff ff       	call   800c6e <memmove>
+  802cff:	83 c4 10             	add    $0x10,%esp
+  802d02:	eb c2                	jmp    802cc6 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802d04:	80 fa 2f             	cmp    $0x2f,%dl
+  802d07:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802d0a:	83 c0 01             	add    $0x1,%eax
+  802d0d:	89 c1                	mov    %eax,%ecx
+  802d0f:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802d13:	84 d2                	test   %dl,%dl
+  802d15:	75 ed                	jne    802d04 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802d17:	83 ec 04             	sub    $0x4,%esp
+  802d1a:	68 80 00 00 00       	push   $0x80
+  802d1f:	53                   	push   %ebx
+  802d20:	56                   	push   %esi
+  802d21:	e8 38 de ff ff       	call   800b5e <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802d26:	a1 00 70 80 00       	mov    0x807000,%eax
+  802d2b:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802d31:	a1 04 70 80 00       	mov    0x807004,%eax
+  802d36:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802d3c:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  802d43:	50 80 00 
+  802d46:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802d49:	89 f8                	mov    %edi,%eax
+  802d4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d4e:	5b                   	pop    %ebx
+  802d4f:	5e                   	pop    %esi
+  802d50:	5f                   	pop    %edi
+  802d51:	5d                   	pop    %ebp
+  802d52:	c3                   	ret
+		return -E_BAD_PATH;
+  802d53:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802d58:	eb ef                	jmp    802d49 <file_slurp+0x11e>
+
+00802d5a <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802d5a:	55                   	push   %ebp
+  802d5b:	89 e5                	mov    %esp,%ebp
+  802d5d:	53                   	push   %ebx
+  802d5e:	83 ec 10             	sub    $0x10,%esp
+  802d61:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802d64:	53                   	push   %ebx
+  802d65:	e8 43 dd ff ff       	call   800aad <strlen>
+  802d6a:	83 c4 10             	add    $0x10,%esp
+  802d6d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802d72:	7f 25                	jg     802d99 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802d74:	83 ec 08             	sub    $0x8,%esp
+  802d77:	53                   	push   %ebx
+  802d78:	68 00 70 80 00       	push   $0x807000
+  802d7d:	e8 66 dd ff ff       	call   800ae8 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802d82:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d87:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d8c:	e8 11 f2 ff ff       	call   801fa2 <fsipc>
+  802d91:	83 c4 10             	add    $0x10,%esp
+}
+  802d94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d97:	c9                   	leave
+  802d98:	c3                   	ret
+		return -E_BAD_PATH;
+  802d99:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802d9e:	eb f4                	jmp    802d94 <remove+0x3a>
+
+00802da0 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802da0:	55                   	push   %ebp
+  802da1:	89 e5                	mov    %esp,%ebp
+  802da3:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802da6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dab:	b8 08 00 00 00       	mov    $0x8,%eax
+  802db0:	e8 ed f1 ff ff       	call   801fa2 <fsipc>
+}
+  802db5:	c9                   	leave
+  802db6:	c3                   	ret
+
+00802db7 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802db7:	55                   	push   %ebp
+  802db8:	89 e5                	mov    %esp,%ebp
+  802dba:	57                   	push   %edi
+  802dbb:	56                   	push   %esi
+  802dbc:	53                   	push   %ebx
+  802dbd:	83 ec 18             	sub    $0x18,%esp
+  802dc0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802dc3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802dc6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802dc9:	57                   	push   %edi
+  802dca:	e8 de dc ff ff       	call   800aad <strlen>
+  802dcf:	83 c4 10             	add    $0x10,%esp
+  802dd2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802dd7:	7f 4c                	jg     802e25 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802dd9:	83 ec 08             	sub    $0x8,%esp
+  802ddc:	57                   	push   %edi
+  802ddd:	68 00 70 80 00       	push   $0x807000
+  802de2:	e8 01 dd ff ff       	call   800ae8 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802de7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dec:	b8 10 00 00 00       	mov    $0x10,%eax
+  802df1:	e8 ac f1 ff ff       	call   801fa2 <fsipc>
+  802df6:	83 c4 10             	add    $0x10,%esp
+  802df9:	85 c0                	test   %eax,%eax
+  802dfb:	78 20                	js     802e1d <defrag+0x66>
+		return r;
+	if (before)
+  802dfd:	85 f6                	test   %esi,%esi
+  802dff:	74 07                	je     802e08 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802e01:	a1 00 70 80 00       	mov    0x807000,%eax
+  802e06:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802e08:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802e0d:	85 db                	test   %ebx,%ebx
+  802e0f:	74 0c                	je     802e1d <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802e11:	a1 04 70 80 00       	mov    0x807004,%eax
+  802e16:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802e18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e20:	5b                   	pop    %ebx
+  802e21:	5e                   	pop    %esi
+  802e22:	5f                   	pop    %edi
+  802e23:	5d                   	pop    %ebp
+  802e24:	c3                   	ret
+		return -E_BAD_PATH;
+  802e25:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802e2a:	eb f1                	jmp    802e1d <defrag+0x66>
+
+00802e2c <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802e2c:	55                   	push   %ebp
+  802e2d:	89 e5                	mov    %esp,%ebp
+  802e2f:	53                   	push   %ebx
+  802e30:	83 ec 04             	sub    $0x4,%esp
+  802e33:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802e36:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e3b:	b8 11 00 00 00       	mov    $0x11,%eax
+  802e40:	e8 5d f1 ff ff       	call   801fa2 <fsipc>
+  802e45:	85 c0                	test   %eax,%eax
+  802e47:	78 34                	js     802e7d <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802e49:	a1 00 70 80 00       	mov    0x807000,%eax
+  802e4e:	89 03                	mov    %eax,(%ebx)
+  802e50:	a1 04 70 80 00       	mov    0x807004,%eax
+  802e55:	89 43 04             	mov    %eax,0x4(%ebx)
+  802e58:	a1 08 70 80 00       	mov    0x807008,%eax
+  802e5d:	89 43 08             	mov    %eax,0x8(%ebx)
+  802e60:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  802e65:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802e68:	a1 10 70 80 00       	mov    0x807010,%eax
+  802e6d:	89 43 10             	mov    %eax,0x10(%ebx)
+  802e70:	a1 14 70 80 00       	mov    0x807014,%eax
+  802e75:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802e78:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e80:	c9                   	leave
+  802e81:	c3                   	ret
+
+00802e82 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e82:	55                   	push   %ebp
+  802e83:	89 e5                	mov    %esp,%ebp
+  802e85:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802e88:	68 59 41 80 00       	push   $0x804159
+  802e8d:	ff 75 0c             	push   0xc(%ebp)
+  802e90:	e8 53 dc ff ff       	call   800ae8 <strcpy>
+	return 0;
+}
+  802e95:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e9a:	c9                   	leave
+  802e9b:	c3                   	ret
+
+00802e9c <devsock_close>:
+{
+  802e9c:	55                   	push   %ebp
+  802e9d:	89 e5                	mov    %esp,%ebp
+  802e9f:	53                   	push   %ebx
+  802ea0:	83 ec 10             	sub    $0x10,%esp
+  802ea3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802ea6:	53                   	push   %ebx
+  802ea7:	e8 95 09 00 00       	call   803841 <pageref>
+  802eac:	89 c2                	mov    %eax,%edx
+  802eae:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802eb6:	83 fa 01             	cmp    $0x1,%edx
+  802eb9:	74 05                	je     802ec0 <devsock_close+0x24>
+}
+  802ebb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ebe:	c9                   	leave
+  802ebf:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802ec0:	83 ec 0c             	sub    $0xc,%esp
+  802ec3:	ff 73 0c             	push   0xc(%ebx)
+  802ec6:	e8 b7 02 00 00       	call   803182 <nsipc_close>
+  802ecb:	83 c4 10             	add    $0x10,%esp
+  802ece:	eb eb                	jmp    802ebb <devsock_close+0x1f>
+
+00802ed0 <devsock_write>:
+{
+  802ed0:	55                   	push   %ebp
+  802ed1:	89 e5                	mov    %esp,%ebp
+  802ed3:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802ed6:	6a 00                	push   $0x0
+  802ed8:	ff 75 10             	push   0x10(%ebp)
+  802edb:	ff 75 0c             	push   0xc(%ebp)
+  802ede:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ee1:	ff 70 0c             	push   0xc(%eax)
+  802ee4:	e8 79 03 00 00       	call   803262 <nsipc_send>
+}
+  802ee9:	c9                   	leave
+  802eea:	c3                   	ret
+
+00802eeb <devsock_read>:
+{
+  802eeb:	55                   	push   %ebp
+  802eec:	89 e5                	mov    %esp,%ebp
+  802eee:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802ef1:	6a 00                	push   $0x0
+  802ef3:	ff 75 10             	push   0x10(%ebp)
+  802ef6:	ff 75 0c             	push   0xc(%ebp)
+  802ef9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802efc:	ff 70 0c             	push   0xc(%eax)
+  802eff:	e8 ef 02 00 00       	call   8031f3 <nsipc_recv>
+}
+  802f04:	c9                   	leave
+  802f05:	c3                   	ret
+
+00802f06 <fd2sockid>:
+{
+  802f06:	55                   	push   %ebp
+  802f07:	89 e5                	mov    %esp,%ebp
+  802f09:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802f0c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802f0f:	52                   	push   %edx
+  802f10:	50                   	push   %eax
+  802f11:	e8 54 e9 ff ff       	call   80186a <fd_lookup>
+  802f16:	83 c4 10             	add    $0x10,%esp
+  802f19:	85 c0                	test   %eax,%eax
+  802f1b:	78 10                	js     802f2d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802f1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f20:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802f26:	39 08                	cmp    %ecx,(%eax)
+  802f28:	75 05                	jne    802f2f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802f2a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802f2d:	c9                   	leave
+  802f2e:	c3                   	ret
+		return -E_NOT_SUPP;
+  802f2f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802f34:	eb f7                	jmp    802f2d <fd2sockid+0x27>
+
+00802f36 <alloc_sockfd>:
+{
+  802f36:	55                   	push   %ebp
+  802f37:	89 e5                	mov    %esp,%ebp
+  802f39:	56                   	push   %esi
+  802f3a:	53                   	push   %ebx
+  802f3b:	83 ec 1c             	sub    $0x1c,%esp
+  802f3e:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802f40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f43:	50                   	push   %eax
+  802f44:	e8 cb e8 ff ff       	call   801814 <fd_alloc>
+  802f49:	89 c3                	mov    %eax,%ebx
+  802f4b:	83 c4 10             	add    $0x10,%esp
+  802f4e:	85 c0                	test   %eax,%eax
+  802f50:	78 43                	js     802f95 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802f52:	83 ec 04             	sub    $0x4,%esp
+  802f55:	68 07 04 00 00       	push   $0x407
+  802f5a:	ff 75 f4             	push   -0xc(%ebp)
+  802f5d:	6a 00                	push   $0x0
+  802f5f:	e8 90 df ff ff       	call   800ef4 <sys_page_alloc>
+  802f64:	89 c3                	mov    %eax,%ebx
+  802f66:	83 c4 10             	add    $0x10,%esp
+  802f69:	85 c0                	test   %eax,%eax
+  802f6b:	78 28                	js     802f95 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802f6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f70:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802f76:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802f78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f7b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802f82:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802f85:	83 ec 0c             	sub    $0xc,%esp
+  802f88:	50                   	push   %eax
+  802f89:	e8 5f e8 ff ff       	call   8017ed <fd2num>
+  802f8e:	89 c3                	mov    %eax,%ebx
+  802f90:	83 c4 10             	add    $0x10,%esp
+  802f93:	eb 0c                	jmp    802fa1 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802f95:	83 ec 0c             	sub    $0xc,%esp
+  802f98:	56                   	push   %esi
+  802f99:	e8 e4 01 00 00       	call   803182 <nsipc_close>
+		return r;
+  802f9e:	83 c4 10             	add    $0x10,%esp
+}
+  802fa1:	89 d8                	mov    %ebx,%eax
+  802fa3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fa6:	5b                   	pop    %ebx
+  802fa7:	5e                   	pop    %esi
+  802fa8:	5d                   	pop    %ebp
+  802fa9:	c3                   	ret
+
+00802faa <accept>:
+{
+  802faa:	55                   	push   %ebp
+  802fab:	89 e5                	mov    %esp,%ebp
+  802fad:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fb3:	e8 4e ff ff ff       	call   802f06 <fd2sockid>
+  802fb8:	85 c0                	test   %eax,%eax
+  802fba:	78 1b                	js     802fd7 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802fbc:	83 ec 04             	sub    $0x4,%esp
+  802fbf:	ff 75 10             	push   0x10(%ebp)
+  802fc2:	ff 75 0c             	push   0xc(%ebp)
+  802fc5:	50                   	push   %eax
+  802fc6:	e8 0e 01 00 00       	call   8030d9 <nsipc_accept>
+  802fcb:	83 c4 10             	add    $0x10,%esp
+  802fce:	85 c0                	test   %eax,%eax
+  802fd0:	78 05                	js     802fd7 <accept+0x2d>
+	return alloc_sockfd(r);
+  802fd2:	e8 5f ff ff ff       	call   802f36 <alloc_sockfd>
+}
+  802fd7:	c9                   	leave
+  802fd8:	c3                   	ret
+
+00802fd9 <bind>:
+{
+  802fd9:	55                   	push   %ebp
+  802fda:	89 e5                	mov    %esp,%ebp
+  802fdc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fe2:	e8 1f ff ff ff       	call   802f06 <fd2sockid>
+  802fe7:	85 c0                	test   %eax,%eax
+  802fe9:	78 12                	js     802ffd <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802feb:	83 ec 04             	sub    $0x4,%esp
+  802fee:	ff 75 10             	push   0x10(%ebp)
+  802ff1:	ff 75 0c             	push   0xc(%ebp)
+  802ff4:	50                   	push   %eax
+  802ff5:	e8 31 01 00 00       	call   80312b <nsipc_bind>
+  802ffa:	83 c4 10             	add    $0x10,%esp
+}
+  802ffd:	c9                   	leave
+  802ffe:	c3                   	ret
+
+00802fff <shutdown>:
+{
+  802fff:	55                   	push   %ebp
+  803000:	89 e5                	mov    %esp,%ebp
+  803002:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803005:	8b 45 08             	mov    0x8(%ebp),%eax
+  803008:	e8 f9 fe ff ff       	call   802f06 <fd2sockid>
+  80300d:	85 c0                	test   %eax,%eax
+  80300f:	78 0f                	js     803020 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803011:	83 ec 08             	sub    $0x8,%esp
+  803014:	ff 75 0c             	push   0xc(%ebp)
+  803017:	50                   	push   %eax
+  803018:	e8 43 01 00 00       	call   803160 <nsipc_shutdown>
+  80301d:	83 c4 10             	add    $0x10,%esp
+}
+  803020:	c9                   	leave
+  803021:	c3                   	ret
+
+00803022 <connect>:
+{
+  803022:	55                   	push   %ebp
+  803023:	89 e5                	mov    %esp,%ebp
+  803025:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803028:	8b 45 08             	mov    0x8(%ebp),%eax
+  80302b:	e8 d6 fe ff ff       	call   802f06 <fd2sockid>
+  803030:	85 c0                	test   %eax,%eax
+  803032:	78 12                	js     803046 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803034:	83 ec 04             	sub    $0x4,%esp
+  803037:	ff 75 10             	push   0x10(%ebp)
+  80303a:	ff 75 0c             	push   0xc(%ebp)
+  80303d:	50                   	push   %eax
+  80303e:	e8 59 01 00 00       	call   80319c <nsipc_connect>
+  803043:	83 c4 10             	add    $0x10,%esp
+}
+  803046:	c9                   	leave
+  803047:	c3                   	ret
+
+00803048 <listen>:
+{
+  803048:	55                   	push   %ebp
+  803049:	89 e5                	mov    %esp,%ebp
+  80304b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80304e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803051:	e8 b0 fe ff ff       	call   802f06 <fd2sockid>
+  803056:	85 c0                	test   %eax,%eax
+  803058:	78 0f                	js     803069 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80305a:	83 ec 08             	sub    $0x8,%esp
+  80305d:	ff 75 0c             	push   0xc(%ebp)
+  803060:	50                   	push   %eax
+  803061:	e8 6b 01 00 00       	call   8031d1 <nsipc_listen>
+  803066:	83 c4 10             	add    $0x10,%esp
+}
+  803069:	c9                   	leave
+  80306a:	c3                   	ret
+
+0080306b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80306b:	55                   	push   %ebp
+  80306c:	89 e5                	mov    %esp,%ebp
+  80306e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803071:	ff 75 10             	push   0x10(%ebp)
+  803074:	ff 75 0c             	push   0xc(%ebp)
+  803077:	ff 75 08             	push   0x8(%ebp)
+  80307a:	e8 41 02 00 00       	call   8032c0 <nsipc_socket>
+  80307f:	83 c4 10             	add    $0x10,%esp
+  803082:	85 c0                	test   %eax,%eax
+  803084:	78 05                	js     80308b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803086:	e8 ab fe ff ff       	call   802f36 <alloc_sockfd>
+}
+  80308b:	c9                   	leave
+  80308c:	c3                   	ret
+
+0080308d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80308d:	55                   	push   %ebp
+  80308e:	89 e5                	mov    %esp,%ebp
+  803090:	53                   	push   %ebx
+  803091:	83 ec 04             	sub    $0x4,%esp
+  803094:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803096:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80309d:	74 26                	je     8030c5 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80309f:	6a 07                	push   $0x7
+  8030a1:	68 00 90 80 00       	push   $0x809000
+  8030a6:	53                   	push   %ebx
+  8030a7:	ff 35 00 a0 80 00    	push   0x80a000
+  8030ad:	e8 c3 e5 ff ff       	call   801675 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8030b2:	83 c4 0c             	add    $0xc,%esp
+  8030b5:	6a 00                	push   $0x0
+  8030b7:	6a 00                	push   $0x0
+  8030b9:	6a 00                	push   $0x0
+  8030bb:	e8 4a e5 ff ff       	call   80160a <ipc_recv>
+}
+  8030c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030c3:	c9                   	leave
+  8030c4:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8030c5:	83 ec 0c             	sub    $0xc,%esp
+  8030c8:	6a 02                	push   $0x2
+  8030ca:	e8 df e6 ff ff       	call   8017ae <ipc_find_env>
+  8030cf:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  8030d4:	83 c4 10             	add    $0x10,%esp
+  8030d7:	eb c6                	jmp    80309f <nsipc+0x12>
+
+008030d9 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8030d9:	55                   	push   %ebp
+  8030da:	89 e5                	mov    %esp,%ebp
+  8030dc:	56                   	push   %esi
+  8030dd:	53                   	push   %ebx
+  8030de:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8030e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030e4:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8030e9:	8b 06                	mov    (%esi),%eax
+  8030eb:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8030f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030f5:	e8 93 ff ff ff       	call   80308d <nsipc>
+  8030fa:	89 c3                	mov    %eax,%ebx
+  8030fc:	85 c0                	test   %eax,%eax
+  8030fe:	79 09                	jns    803109 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803100:	89 d8                	mov    %ebx,%eax
+  803102:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803105:	5b                   	pop    %ebx
+  803106:	5e                   	pop    %esi
+  803107:	5d                   	pop    %ebp
+  803108:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803109:	83 ec 04             	sub    $0x4,%esp
+  80310c:	ff 35 10 90 80 00    	push   0x809010
+  803112:	68 00 90 80 00       	push   $0x809000
+  803117:	ff 75 0c             	push   0xc(%ebp)
+  80311a:	e8 4f db ff ff       	call   800c6e <memmove>
+		*addrlen = ret->ret_addrlen;
+  80311f:	a1 10 90 80 00       	mov    0x809010,%eax
+  803124:	89 06                	mov    %eax,(%esi)
+  803126:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803129:	eb d5                	jmp    803100 <nsipc_accept+0x27>
+
+0080312b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80312b:	55                   	push   %ebp
+  80312c:	89 e5                	mov    %esp,%ebp
+  80312e:	53                   	push   %ebx
+  80312f:	83 ec 08             	sub    $0x8,%esp
+  803132:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803135:	8b 45 08             	mov    0x8(%ebp),%eax
+  803138:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80313d:	53                   	push   %ebx
+  80313e:	ff 75 0c             	push   0xc(%ebp)
+  803141:	68 04 90 80 00       	push   $0x809004
+  803146:	e8 23 db ff ff       	call   800c6e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80314b:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  803151:	b8 02 00 00 00       	mov    $0x2,%eax
+  803156:	e8 32 ff ff ff       	call   80308d <nsipc>
+}
+  80315b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80315e:	c9                   	leave
+  80315f:	c3                   	ret
+
+00803160 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803160:	55                   	push   %ebp
+  803161:	89 e5                	mov    %esp,%ebp
+  803163:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803166:	8b 45 08             	mov    0x8(%ebp),%eax
+  803169:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  80316e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803171:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  803176:	b8 03 00 00 00       	mov    $0x3,%eax
+  80317b:	e8 0d ff ff ff       	call   80308d <nsipc>
+}
+  803180:	c9                   	leave
+  803181:	c3                   	ret
+
+00803182 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803182:	55                   	push   %ebp
+  803183:	89 e5                	mov    %esp,%ebp
+  803185:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803188:	8b 45 08             	mov    0x8(%ebp),%eax
+  80318b:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  803190:	b8 04 00 00 00       	mov    $0x4,%eax
+  803195:	e8 f3 fe ff ff       	call   80308d <nsipc>
+}
+  80319a:	c9                   	leave
+  80319b:	c3                   	ret
+
+0080319c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80319c:	55                   	push   %ebp
+  80319d:	89 e5                	mov    %esp,%ebp
+  80319f:	53                   	push   %ebx
+  8031a0:	83 ec 08             	sub    $0x8,%esp
+  8031a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8031a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031a9:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8031ae:	53                   	push   %ebx
+  8031af:	ff 75 0c             	push   0xc(%ebp)
+  8031b2:	68 04 90 80 00       	push   $0x809004
+  8031b7:	e8 b2 da ff ff       	call   800c6e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8031bc:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  8031c2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8031c7:	e8 c1 fe ff ff       	call   80308d <nsipc>
+}
+  8031cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031cf:	c9                   	leave
+  8031d0:	c3                   	ret
+
+008031d1 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8031d1:	55                   	push   %ebp
+  8031d2:	89 e5                	mov    %esp,%ebp
+  8031d4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8031d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031da:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8031df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031e2:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8031e7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8031ec:	e8 9c fe ff ff       	call   80308d <nsipc>
+}
+  8031f1:	c9                   	leave
+  8031f2:	c3                   	ret
+
+008031f3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8031f3:	55                   	push   %ebp
+  8031f4:	89 e5                	mov    %esp,%ebp
+  8031f6:	56                   	push   %esi
+  8031f7:	53                   	push   %ebx
+  8031f8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8031fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031fe:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  803203:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  803209:	8b 45 14             	mov    0x14(%ebp),%eax
+  80320c:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803211:	b8 07 00 00 00       	mov    $0x7,%eax
+  803216:	e8 72 fe ff ff       	call   80308d <nsipc>
+  80321b:	89 c3                	mov    %eax,%ebx
+  80321d:	85 c0                	test   %eax,%eax
+  80321f:	78 22                	js     803243 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803221:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803226:	39 c6                	cmp    %eax,%esi
+  803228:	0f 4e c6             	cmovle %esi,%eax
+  80322b:	39 c3                	cmp    %eax,%ebx
+  80322d:	7f 1d                	jg     80324c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80322f:	83 ec 04             	sub    $0x4,%esp
+  803232:	53                   	push   %ebx
+  803233:	68 00 90 80 00       	push   $0x809000
+  803238:	ff 75 0c             	push   0xc(%ebp)
+  80323b:	e8 2e da ff ff       	call   800c6e <memmove>
+  803240:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803243:	89 d8                	mov    %ebx,%eax
+  803245:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803248:	5b                   	pop    %ebx
+  803249:	5e                   	pop    %esi
+  80324a:	5d                   	pop    %ebp
+  80324b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80324c:	68 65 41 80 00       	push   $0x804165
+  803251:	68 a8 3b 80 00       	push   $0x803ba8
+  803256:	6a 62                	push   $0x62
+  803258:	68 7a 41 80 00       	push   $0x80417a
+  80325d:	e8 bd d1 ff ff       	call   80041f <_panic>
+
+00803262 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803262:	55                   	push   %ebp
+  803263:	89 e5                	mov    %esp,%ebp
+  803265:	53                   	push   %ebx
+  803266:	83 ec 04             	sub    $0x4,%esp
+  803269:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80326c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80326f:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803274:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80327a:	7f 2e                	jg     8032aa <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80327c:	83 ec 04             	sub    $0x4,%esp
+  80327f:	53                   	push   %ebx
+  803280:	ff 75 0c             	push   0xc(%ebp)
+  803283:	68 0c 90 80 00       	push   $0x80900c
+  803288:	e8 e1 d9 ff ff       	call   800c6e <memmove>
+	nsipcbuf.send.req_size = size;
+  80328d:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803293:	8b 45 14             	mov    0x14(%ebp),%eax
+  803296:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  80329b:	b8 08 00 00 00       	mov    $0x8,%eax
+  8032a0:	e8 e8 fd ff ff       	call   80308d <nsipc>
+}
+  8032a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032a8:	c9                   	leave
+  8032a9:	c3                   	ret
+	assert(size < 1600);
+  8032aa:	68 86 41 80 00       	push   $0x804186
+  8032af:	68 a8 3b 80 00       	push   $0x803ba8
+  8032b4:	6a 6d                	push   $0x6d
+  8032b6:	68 7a 41 80 00       	push   $0x80417a
+  8032bb:	e8 5f d1 ff ff       	call   80041f <_panic>
+
+008032c0 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8032c0:	55                   	push   %ebp
+  8032c1:	89 e5                	mov    %esp,%ebp
+  8032c3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8032c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c9:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  8032ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032d1:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  8032d6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032d9:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8032de:	b8 09 00 00 00       	mov    $0x9,%eax
+  8032e3:	e8 a5 fd ff ff       	call   80308d <nsipc>
+}
+  8032e8:	c9                   	leave
+  8032e9:	c3                   	ret
+
+008032ea <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8032ea:	55                   	push   %ebp
+  8032eb:	89 e5                	mov    %esp,%ebp
+  8032ed:	56                   	push   %esi
+  8032ee:	53                   	push   %ebx
+  8032ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8032f2:	83 ec 0c             	sub    $0xc,%esp
+  8032f5:	ff 75 08             	push   0x8(%ebp)
+  8032f8:	e8 00 e5 ff ff       	call   8017fd <fd2data>
+  8032fd:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8032ff:	83 c4 08             	add    $0x8,%esp
+  803302:	68 92 41 80 00       	push   $0x804192
+  803307:	53                   	push   %ebx
+  803308:	e8 db d7 ff ff       	call   800ae8 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80330d:	8b 46 04             	mov    0x4(%esi),%eax
+  803310:	2b 06                	sub    (%esi),%eax
+  803312:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803318:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80331f:	00 00 00 
+	stat->st_dev = &devpipe;
+  803322:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  803329:	50 80 00 
+	return 0;
+}
+  80332c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803331:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803334:	5b                   	pop    %ebx
+  803335:	5e                   	pop    %esi
+  803336:	5d                   	pop    %ebp
+  803337:	c3                   	ret
+
+00803338 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803338:	55                   	push   %ebp
+  803339:	89 e5                	mov    %esp,%ebp
+  80333b:	53                   	push   %ebx
+  80333c:	83 ec 0c             	sub    $0xc,%esp
+  80333f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803342:	53                   	push   %ebx
+  803343:	6a 00                	push   $0x0
+  803345:	e8 37 dc ff ff       	call   800f81 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80334a:	89 1c 24             	mov    %ebx,(%esp)
+  80334d:	e8 ab e4 ff ff       	call   8017fd <fd2data>
+  803352:	83 c4 08             	add    $0x8,%esp
+  803355:	50                   	push   %eax
+  803356:	6a 00                	push   $0x0
+  803358:	e8 24 dc ff ff       	call   800f81 <sys_page_unmap>
+}
+  80335d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803360:	c9                   	leave
+  803361:	c3                   	ret
+
+00803362 <_pipeisclosed>:
+{
+  803362:	55                   	push   %ebp
+  803363:	89 e5                	mov    %esp,%ebp
+  803365:	57                   	push   %edi
+  803366:	56                   	push   %esi
+  803367:	53                   	push   %ebx
+  803368:	83 ec 1c             	sub    $0x1c,%esp
+  80336b:	89 c7                	mov    %eax,%edi
+  80336d:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80336f:	a1 04 60 80 00       	mov    0x806004,%eax
+  803374:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803377:	83 ec 0c             	sub    $0xc,%esp
+  80337a:	57                   	push   %edi
+  80337b:	e8 c1 04 00 00       	call   803841 <pageref>
+  803380:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803383:	89 34 24             	mov    %esi,(%esp)
+  803386:	e8 b6 04 00 00       	call   803841 <pageref>
+		nn = thisenv->env_runs;
+  80338b:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  803391:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  803394:	83 c4 10             	add    $0x10,%esp
+  803397:	39 cb                	cmp    %ecx,%ebx
+  803399:	74 1b                	je     8033b6 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80339b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80339e:	75 cf                	jne    80336f <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8033a0:	8b 42 58             	mov    0x58(%edx),%eax
+  8033a3:	6a 01                	push   $0x1
+  8033a5:	50                   	push   %eax
+  8033a6:	53                   	push   %ebx
+  8033a7:	68 99 41 80 00       	push   $0x804199
+  8033ac:	e8 49 d1 ff ff       	call   8004fa <cprintf>
+  8033b1:	83 c4 10             	add    $0x10,%esp
+  8033b4:	eb b9                	jmp    80336f <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8033b6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8033b9:	0f 94 c0             	sete   %al
+  8033bc:	0f b6 c0             	movzbl %al,%eax
+}
+  8033bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033c2:	5b                   	pop    %ebx
+  8033c3:	5e                   	pop    %esi
+  8033c4:	5f                   	pop    %edi
+  8033c5:	5d                   	pop    %ebp
+  8033c6:	c3                   	ret
+
+008033c7 <devpipe_write>:
+{
+  8033c7:	55                   	push   %ebp
+  8033c8:	89 e5                	mov    %esp,%ebp
+  8033ca:	57                   	push   %edi
+  8033cb:	56                   	push   %esi
+  8033cc:	53                   	push   %ebx
+  8033cd:	83 ec 28             	sub    $0x28,%esp
+  8033d0:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8033d3:	56                   	push   %esi
+  8033d4:	e8 24 e4 ff ff       	call   8017fd <fd2data>
+  8033d9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8033db:	83 c4 10             	add    $0x10,%esp
+  8033de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033e3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8033e6:	75 09                	jne    8033f1 <devpipe_write+0x2a>
+	return i;
+  8033e8:	89 f8                	mov    %edi,%eax
+  8033ea:	eb 23                	jmp    80340f <devpipe_write+0x48>
+			sys_yield();
+  8033ec:	e8 e4 da ff ff       	call   800ed5 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8033f1:	8b 43 04             	mov    0x4(%ebx),%eax
+  8033f4:	8b 0b                	mov    (%ebx),%ecx
+  8033f6:	8d 51 20             	lea    0x20(%ecx),%edx
+  8033f9:	39 d0                	cmp    %edx,%eax
+  8033fb:	72 1a                	jb     803417 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8033fd:	89 da                	mov    %ebx,%edx
+  8033ff:	89 f0                	mov    %esi,%eax
+  803401:	e8 5c ff ff ff       	call   803362 <_pipeisclosed>
+  803406:	85 c0                	test   %eax,%eax
+  803408:	74 e2                	je     8033ec <devpipe_write+0x25>
+				return 0;
+  80340a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80340f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803412:	5b                   	pop    %ebx
+  803413:	5e                   	pop    %esi
+  803414:	5f                   	pop    %edi
+  803415:	5d                   	pop    %ebp
+  803416:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803417:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80341a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80341e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803421:	89 c2                	mov    %eax,%edx
+  803423:	c1 fa 1f             	sar    $0x1f,%edx
+  803426:	89 d1                	mov    %edx,%ecx
+  803428:	c1 e9 1b             	shr    $0x1b,%ecx
+  80342b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80342e:	83 e2 1f             	and    $0x1f,%edx
+  803431:	29 ca                	sub    %ecx,%edx
+  803433:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803437:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80343b:	83 c0 01             	add    $0x1,%eax
+  80343e:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803441:	83 c7 01             	add    $0x1,%edi
+  803444:	eb 9d                	jmp    8033e3 <devpipe_write+0x1c>
+
+00803446 <devpipe_read>:
+{
+  803446:	55                   	push   %ebp
+  803447:	89 e5                	mov    %esp,%ebp
+  803449:	57                   	push   %edi
+  80344a:	56                   	push   %esi
+  80344b:	53                   	push   %ebx
+  80344c:	83 ec 18             	sub    $0x18,%esp
+  80344f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803452:	57                   	push   %edi
+  803453:	e8 a5 e3 ff ff       	call   8017fd <fd2data>
+  803458:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80345a:	83 c4 10             	add    $0x10,%esp
+  80345d:	be 00 00 00 00       	mov    $0x0,%esi
+  803462:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803465:	75 13                	jne    80347a <devpipe_read+0x34>
+	return i;
+  803467:	89 f0                	mov    %esi,%eax
+  803469:	eb 02                	jmp    80346d <devpipe_read+0x27>
+				return i;
+  80346b:	89 f0                	mov    %esi,%eax
+}
+  80346d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803470:	5b                   	pop    %ebx
+  803471:	5e                   	pop    %esi
+  803472:	5f                   	pop    %edi
+  803473:	5d                   	pop    %ebp
+  803474:	c3                   	ret
+			sys_yield();
+  803475:	e8 5b da ff ff       	call   800ed5 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80347a:	8b 03                	mov    (%ebx),%eax
+  80347c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80347f:	75 18                	jne    803499 <devpipe_read+0x53>
+			if (i > 0)
+  803481:	85 f6                	test   %esi,%esi
+  803483:	75 e6                	jne    80346b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803485:	89 da                	mov    %ebx,%edx
+  803487:	89 f8                	mov    %edi,%eax
+  803489:	e8 d4 fe ff ff       	call   803362 <_pipeisclosed>
+  80348e:	85 c0                	test   %eax,%eax
+  803490:	74 e3                	je     803475 <devpipe_read+0x2f>
+				return 0;
+  803492:	b8 00 00 00 00       	mov    $0x0,%eax
+  803497:	eb d4                	jmp    80346d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803499:	99                   	cltd
+  80349a:	c1 ea 1b             	shr    $0x1b,%edx
+  80349d:	01 d0                	add    %edx,%eax
+  80349f:	83 e0 1f             	and    $0x1f,%eax
+  8034a2:	29 d0                	sub    %edx,%eax
+  8034a4:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8034a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8034ac:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8034af:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8034b2:	83 c6 01             	add    $0x1,%esi
+  8034b5:	eb ab                	jmp    803462 <devpipe_read+0x1c>
+
+008034b7 <pipe>:
+{
+  8034b7:	55                   	push   %ebp
+  8034b8:	89 e5                	mov    %esp,%ebp
+  8034ba:	56                   	push   %esi
+  8034bb:	53                   	push   %ebx
+  8034bc:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8034bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034c2:	50                   	push   %eax
+  8034c3:	e8 4c e3 ff ff       	call   801814 <fd_alloc>
+  8034c8:	89 c3                	mov    %eax,%ebx
+  8034ca:	83 c4 10             	add    $0x10,%esp
+  8034cd:	85 c0                	test   %eax,%eax
+  8034cf:	0f 88 23 01 00 00    	js     8035f8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8034d5:	83 ec 04             	sub    $0x4,%esp
+  8034d8:	68 07 04 00 00       	push   $0x407
+  8034dd:	ff 75 f4             	push   -0xc(%ebp)
+  8034e0:	6a 00                	push   $0x0
+  8034e2:	e8 0d da ff ff       	call   800ef4 <sys_page_alloc>
+  8034e7:	89 c3                	mov    %eax,%ebx
+  8034e9:	83 c4 10             	add    $0x10,%esp
+  8034ec:	85 c0                	test   %eax,%eax
+  8034ee:	0f 88 04 01 00 00    	js     8035f8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8034f4:	83 ec 0c             	sub    $0xc,%esp
+  8034f7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8034fa:	50                   	push   %eax
+  8034fb:	e8 14 e3 ff ff       	call   801814 <fd_alloc>
+  803500:	89 c3                	mov    %eax,%ebx
+  803502:	83 c4 10             	add    $0x10,%esp
+  803505:	85 c0                	test   %eax,%eax
+  803507:	0f 88 db 00 00 00    	js     8035e8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80350d:	83 ec 04             	sub    $0x4,%esp
+  803510:	68 07 04 00 00       	push   $0x407
+  803515:	ff 75 f0             	push   -0x10(%ebp)
+  803518:	6a 00                	push   $0x0
+  80351a:	e8 d5 d9 ff ff       	call   800ef4 <sys_page_alloc>
+  80351f:	89 c3                	mov    %eax,%ebx
+  803521:	83 c4 10             	add    $0x10,%esp
+  803524:	85 c0                	test   %eax,%eax
+  803526:	0f 88 bc 00 00 00    	js     8035e8 <pipe+0x131>
+	va = fd2data(fd0);
+  80352c:	83 ec 0c             	sub    $0xc,%esp
+  80352f:	ff 75 f4             	push   -0xc(%ebp)
+  803532:	e8 c6 e2 ff ff       	call   8017fd <fd2data>
+  803537:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803539:	83 c4 0c             	add    $0xc,%esp
+  80353c:	68 07 04 00 00       	push   $0x407
+  803541:	50                   	push   %eax
+  803542:	6a 00                	push   $0x0
+  803544:	e8 ab d9 ff ff       	call   800ef4 <sys_page_alloc>
+  803549:	89 c3                	mov    %eax,%ebx
+  80354b:	83 c4 10             	add    $0x10,%esp
+  80354e:	85 c0                	test   %eax,%eax
+  803550:	0f 88 82 00 00 00    	js     8035d8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803556:	83 ec 0c             	sub    $0xc,%esp
+  803559:	ff 75 f0             	push   -0x10(%ebp)
+  80355c:	e8 9c e2 ff ff       	call   8017fd <fd2data>
+  803561:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803568:	50                   	push   %eax
+  803569:	6a 00                	push   $0x0
+  80356b:	56                   	push   %esi
+  80356c:	6a 00                	push   $0x0
+  80356e:	e8 cc d9 ff ff       	call   800f3f <sys_page_map>
+  803573:	89 c3                	mov    %eax,%ebx
+  803575:	83 c4 20             	add    $0x20,%esp
+  803578:	85 c0                	test   %eax,%eax
+  80357a:	78 4e                	js     8035ca <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80357c:	a1 60 50 80 00       	mov    0x805060,%eax
+  803581:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803584:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803586:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803589:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803590:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803593:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803595:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803598:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80359f:	83 ec 0c             	sub    $0xc,%esp
+  8035a2:	ff 75 f4             	push   -0xc(%ebp)
+  8035a5:	e8 43 e2 ff ff       	call   8017ed <fd2num>
+  8035aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8035ad:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8035af:	83 c4 04             	add    $0x4,%esp
+  8035b2:	ff 75 f0             	push   -0x10(%ebp)
+  8035b5:	e8 33 e2 ff ff       	call   8017ed <fd2num>
+  8035ba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8035bd:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8035c0:	83 c4 10             	add    $0x10,%esp
+  8035c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035c8:	eb 2e                	jmp    8035f8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8035ca:	83 ec 08             	sub    $0x8,%esp
+  8035cd:	56                   	push   %esi
+  8035ce:	6a 00                	push   $0x0
+  8035d0:	e8 ac d9 ff ff       	call   800f81 <sys_page_unmap>
+  8035d5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8035d8:	83 ec 08             	sub    $0x8,%esp
+  8035db:	ff 75 f0             	push   -0x10(%ebp)
+  8035de:	6a 00                	push   $0x0
+  8035e0:	e8 9c d9 ff ff       	call   800f81 <sys_page_unmap>
+  8035e5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8035e8:	83 ec 08             	sub    $0x8,%esp
+  8035eb:	ff 75 f4             	push   -0xc(%ebp)
+  8035ee:	6a 00                	push   $0x0
+  8035f0:	e8 8c d9 ff ff       	call   800f81 <sys_page_unmap>
+  8035f5:	83 c4 10             	add    $0x10,%esp
+}
+  8035f8:	89 d8                	mov    %ebx,%eax
+  8035fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035fd:	5b                   	pop    %ebx
+  8035fe:	5e                   	pop    %esi
+  8035ff:	5d                   	pop    %ebp
+  803600:	c3                   	ret
+
+00803601 <pipeisclosed>:
+{
+  803601:	55                   	push   %ebp
+  803602:	89 e5                	mov    %esp,%ebp
+  803604:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803607:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80360a:	50                   	push   %eax
+  80360b:	ff 75 08             	push   0x8(%ebp)
+  80360e:	e8 57 e2 ff ff       	call   80186a <fd_lookup>
+  803613:	83 c4 10             	add    $0x10,%esp
+  803616:	85 c0                	test   %eax,%eax
+  803618:	78 18                	js     803632 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80361a:	83 ec 0c             	sub    $0xc,%esp
+  80361d:	ff 75 f4             	push   -0xc(%ebp)
+  803620:	e8 d8 e1 ff ff       	call   8017fd <fd2data>
+  803625:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803627:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80362a:	e8 33 fd ff ff       	call   803362 <_pipeisclosed>
+  80362f:	83 c4 10             	add    $0x10,%esp
+}
+  803632:	c9                   	leave
+  803633:	c3                   	ret
+
+00803634 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803634:	b8 00 00 00 00       	mov    $0x0,%eax
+  803639:	c3                   	ret
+
+0080363a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80363a:	55                   	push   %ebp
+  80363b:	89 e5                	mov    %esp,%ebp
+  80363d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803640:	68 b1 41 80 00       	push   $0x8041b1
+  803645:	ff 75 0c             	push   0xc(%ebp)
+  803648:	e8 9b d4 ff ff       	call   800ae8 <strcpy>
+	return 0;
+}
+  80364d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803652:	c9                   	leave
+  803653:	c3                   	ret
+
+00803654 <devcons_write>:
+{
+  803654:	55                   	push   %ebp
+  803655:	89 e5                	mov    %esp,%ebp
+  803657:	57                   	push   %edi
+  803658:	56                   	push   %esi
+  803659:	53                   	push   %ebx
+  80365a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803660:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803665:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80366b:	eb 2e                	jmp    80369b <devcons_write+0x47>
+		m = n - tot;
+  80366d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803670:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803672:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803677:	39 c3                	cmp    %eax,%ebx
+  803679:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80367c:	83 ec 04             	sub    $0x4,%esp
+  80367f:	53                   	push   %ebx
+  803680:	89 f0                	mov    %esi,%eax
+  803682:	03 45 0c             	add    0xc(%ebp),%eax
+  803685:	50                   	push   %eax
+  803686:	57                   	push   %edi
+  803687:	e8 e2 d5 ff ff       	call   800c6e <memmove>
+		sys_cputs(buf, m);
+  80368c:	83 c4 08             	add    $0x8,%esp
+  80368f:	53                   	push   %ebx
+  803690:	57                   	push   %edi
+  803691:	e8 82 d7 ff ff       	call   800e18 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803696:	01 de                	add    %ebx,%esi
+  803698:	83 c4 10             	add    $0x10,%esp
+  80369b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80369e:	72 cd                	jb     80366d <devcons_write+0x19>
+}
+  8036a0:	89 f0                	mov    %esi,%eax
+  8036a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036a5:	5b                   	pop    %ebx
+  8036a6:	5e                   	pop    %esi
+  8036a7:	5f                   	pop    %edi
+  8036a8:	5d                   	pop    %ebp
+  8036a9:	c3                   	ret
+
+008036aa <devcons_read>:
+{
+  8036aa:	55                   	push   %ebp
+  8036ab:	89 e5                	mov    %esp,%ebp
+  8036ad:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8036b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8036b9:	75 07                	jne    8036c2 <devcons_read+0x18>
+  8036bb:	eb 1f                	jmp    8036dc <devcons_read+0x32>
+		sys_yield();
+  8036bd:	e8 13 d8 ff ff       	call   800ed5 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8036c2:	e8 77 d7 ff ff       	call   800e3e <sys_cgetc>
+  8036c7:	85 c0                	test   %eax,%eax
+  8036c9:	74 f2                	je     8036bd <devcons_read+0x13>
+	if (c < 0)
+  8036cb:	78 0f                	js     8036dc <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8036cd:	83 f8 04             	cmp    $0x4,%eax
+  8036d0:	74 0c                	je     8036de <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8036d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8036d5:	88 02                	mov    %al,(%edx)
+	return 1;
+  8036d7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8036dc:	c9                   	leave
+  8036dd:	c3                   	ret
+		return 0;
+  8036de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e3:	eb f7                	jmp    8036dc <devcons_read+0x32>
+
+008036e5 <cputchar>:
+{
+  8036e5:	55                   	push   %ebp
+  8036e6:	89 e5                	mov    %esp,%ebp
+  8036e8:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8036eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036ee:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8036f1:	6a 01                	push   $0x1
+  8036f3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8036f6:	50                   	push   %eax
+  8036f7:	e8 1c d7 ff ff       	call   800e18 <sys_cputs>
+}
+  8036fc:	83 c4 10             	add    $0x10,%esp
+  8036ff:	c9                   	leave
+  803700:	c3                   	ret
+
+00803701 <getchar>:
+{
+  803701:	55                   	push   %ebp
+  803702:	89 e5                	mov    %esp,%ebp
+  803704:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803707:	6a 01                	push   $0x1
+  803709:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80370c:	50                   	push   %eax
+  80370d:	6a 00                	push   $0x0
+  80370f:	e8 bc e3 ff ff       	call   801ad0 <read>
+	if (r < 0)
+  803714:	83 c4 10             	add    $0x10,%esp
+  803717:	85 c0                	test   %eax,%eax
+  803719:	78 06                	js     803721 <getchar+0x20>
+	if (r < 1)
+  80371b:	74 06                	je     803723 <getchar+0x22>
+	return c;
+  80371d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803721:	c9                   	leave
+  803722:	c3                   	ret
+		return -E_EOF;
+  803723:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803728:	eb f7                	jmp    803721 <getchar+0x20>
+
+0080372a <iscons>:
+{
+  80372a:	55                   	push   %ebp
+  80372b:	89 e5                	mov    %esp,%ebp
+  80372d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803730:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803733:	50                   	push   %eax
+  803734:	ff 75 08             	push   0x8(%ebp)
+  803737:	e8 2e e1 ff ff       	call   80186a <fd_lookup>
+  80373c:	83 c4 10             	add    $0x10,%esp
+  80373f:	85 c0                	test   %eax,%eax
+  803741:	78 11                	js     803754 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803743:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803746:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80374c:	39 10                	cmp    %edx,(%eax)
+  80374e:	0f 94 c0             	sete   %al
+  803751:	0f b6 c0             	movzbl %al,%eax
+}
+  803754:	c9                   	leave
+  803755:	c3                   	ret
+
+00803756 <opencons>:
+{
+  803756:	55                   	push   %ebp
+  803757:	89 e5                	mov    %esp,%ebp
+  803759:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80375c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80375f:	50                   	push   %eax
+  803760:	e8 af e0 ff ff       	call   801814 <fd_alloc>
+  803765:	83 c4 10             	add    $0x10,%esp
+  803768:	85 c0                	test   %eax,%eax
+  80376a:	78 3a                	js     8037a6 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80376c:	83 ec 04             	sub    $0x4,%esp
+  80376f:	68 07 04 00 00       	push   $0x407
+  803774:	ff 75 f4             	push   -0xc(%ebp)
+  803777:	6a 00                	push   $0x0
+  803779:	e8 76 d7 ff ff       	call   800ef4 <sys_page_alloc>
+  80377e:	83 c4 10             	add    $0x10,%esp
+  803781:	85 c0                	test   %eax,%eax
+  803783:	78 21                	js     8037a6 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803785:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803788:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80378e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803790:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803793:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80379a:	83 ec 0c             	sub    $0xc,%esp
+  80379d:	50                   	push   %eax
+  80379e:	e8 4a e0 ff ff       	call   8017ed <fd2num>
+  8037a3:	83 c4 10             	add    $0x10,%esp
+}
+  8037a6:	c9                   	leave
+  8037a7:	c3                   	ret
+
+008037a8 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8037a8:	55                   	push   %ebp
+  8037a9:	89 e5                	mov    %esp,%ebp
+  8037ab:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8037ae:	83 3d 04 a0 80 00 00 	cmpl   $0x0,0x80a004
+  8037b5:	74 0a                	je     8037c1 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8037b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037ba:	a3 04 a0 80 00       	mov    %eax,0x80a004
+}
+  8037bf:	c9                   	leave
+  8037c0:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8037c1:	83 ec 04             	sub    $0x4,%esp
+  8037c4:	6a 07                	push   $0x7
+  8037c6:	68 00 f0 bf ee       	push   $0xeebff000
+  8037cb:	6a 00                	push   $0x0
+  8037cd:	e8 22 d7 ff ff       	call   800ef4 <sys_page_alloc>
+  8037d2:	83 c4 10             	add    $0x10,%esp
+  8037d5:	85 c0                	test   %eax,%eax
+  8037d7:	75 2c                	jne    803805 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8037d9:	83 ec 08             	sub    $0x8,%esp
+  8037dc:	68 1b 38 80 00       	push   $0x80381b
+  8037e1:	6a 00                	push   $0x0
+  8037e3:	e8 77 d8 ff ff       	call   80105f <sys_env_set_pgfault_upcall>
+  8037e8:	83 c4 10             	add    $0x10,%esp
+  8037eb:	85 c0                	test   %eax,%eax
+  8037ed:	74 c8                	je     8037b7 <set_pgfault_handler+0xf>
+  8037ef:	68 08 42 80 00       	push   $0x804208
+  8037f4:	68 a8 3b 80 00       	push   $0x803ba8
+  8037f9:	6a 20                	push   $0x20
+  8037fb:	68 38 42 80 00       	push   $0x804238
+  803800:	e8 1a cc ff ff       	call   80041f <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803805:	68 c0 41 80 00       	push   $0x8041c0
+  80380a:	68 a8 3b 80 00       	push   $0x803ba8
+  80380f:	6a 1e                	push   $0x1e
+  803811:	68 38 42 80 00       	push   $0x804238
+  803816:	e8 04 cc ff ff       	call   80041f <_panic>
+
+0080381b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80381b:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80381c:	a1 04 a0 80 00       	mov    0x80a004,%eax
+	call *%eax
+  803821:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803823:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803826:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  80382b:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803830:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803834:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803837:	83 c4 08             	add    $0x8,%esp
+	popal
+  80383a:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  80383b:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80383e:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  80383f:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803840:	c3                   	ret
+
+00803841 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803841:	55                   	push   %ebp
+  803842:	89 e5                	mov    %esp,%ebp
+  803844:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803847:	89 c2                	mov    %eax,%edx
+  803849:	c1 ea 16             	shr    $0x16,%edx
+  80384c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803853:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803858:	f6 c1 01             	test   $0x1,%cl
+  80385b:	74 22                	je     80387f <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80385d:	c1 e8 0c             	shr    $0xc,%eax
+  803860:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803867:	a8 01                	test   $0x1,%al
+  803869:	74 14                	je     80387f <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80386b:	c1 e8 0c             	shr    $0xc,%eax
+  80386e:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803871:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803878:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  80387c:	0f b7 d2             	movzwl %dx,%edx
+}
+  80387f:	89 d0                	mov    %edx,%eax
+  803881:	5d                   	pop    %ebp
+  803882:	c3                   	ret
+
+00803883 <dm>:
+  803883:	55                   	push   %ebp
+  803884:	57                   	push   %edi
+  803885:	56                   	push   %esi
+  803886:	53                   	push   %ebx
+  803887:	83 ec 24             	sub    $0x24,%esp
+  80388a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80388e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803892:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803896:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80389a:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80389e:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8038a2:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8038a6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038b5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8038bc:	00 
+  8038bd:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8038c4:	00 
+  8038c5:	89 fb                	mov    %edi,%ebx
+  8038c7:	eb 08                	jmp    8038d1 <dm+0x4e>
+  8038c9:	83 e9 01             	sub    $0x1,%ecx
+  8038cc:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8038cf:	74 68                	je     803939 <dm+0xb6>
+  8038d1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8038d5:	01 c0                	add    %eax,%eax
+  8038d7:	89 c6                	mov    %eax,%esi
+  8038d9:	89 d7                	mov    %edx,%edi
+  8038db:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8038df:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8038e3:	0f ad d0             	shrd   %cl,%edx,%eax
+  8038e6:	d3 ea                	shr    %cl,%edx
+  8038e8:	f6 c1 20             	test   $0x20,%cl
+  8038eb:	74 04                	je     8038f1 <dm+0x6e>
+  8038ed:	89 d0                	mov    %edx,%eax
+  8038ef:	31 d2                	xor    %edx,%edx
+  8038f1:	83 e0 01             	and    $0x1,%eax
+  8038f4:	89 04 24             	mov    %eax,(%esp)
+  8038f7:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8038fe:	00 
+  8038ff:	8b 04 24             	mov    (%esp),%eax
+  803902:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803906:	09 f0                	or     %esi,%eax
+  803908:	09 fa                	or     %edi,%edx
+  80390a:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80390e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803912:	39 f0                	cmp    %esi,%eax
+  803914:	89 d5                	mov    %edx,%ebp
+  803916:	19 fd                	sbb    %edi,%ebp
+  803918:	72 af                	jb     8038c9 <dm+0x46>
+  80391a:	29 f0                	sub    %esi,%eax
+  80391c:	19 fa                	sbb    %edi,%edx
+  80391e:	89 cf                	mov    %ecx,%edi
+  803920:	c1 ef 05             	shr    $0x5,%edi
+  803923:	83 e7 01             	and    $0x1,%edi
+  803926:	89 fe                	mov    %edi,%esi
+  803928:	83 f6 01             	xor    $0x1,%esi
+  80392b:	d3 e6                	shl    %cl,%esi
+  80392d:	d3 e7                	shl    %cl,%edi
+  80392f:	09 74 24 18          	or     %esi,0x18(%esp)
+  803933:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803937:	eb 90                	jmp    8038c9 <dm+0x46>
+  803939:	85 db                	test   %ebx,%ebx
+  80393b:	74 05                	je     803942 <dm+0xbf>
+  80393d:	89 03                	mov    %eax,(%ebx)
+  80393f:	89 53 04             	mov    %edx,0x4(%ebx)
+  803942:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803946:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80394a:	83 c4 24             	add    $0x24,%esp
+  80394d:	5b                   	pop    %ebx
+  80394e:	5e                   	pop    %esi
+  80394f:	5f                   	pop    %edi
+  803950:	5d                   	pop    %ebp
+  803951:	c3                   	ret
+
+00803952 <__udivdi3>:
+  803952:	83 ec 08             	sub    $0x8,%esp
+  803955:	6a 00                	push   $0x0
+  803957:	ff 74 24 1c          	push   0x1c(%esp)
+  80395b:	ff 74 24 1c          	push   0x1c(%esp)
+  80395f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803963:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803967:	e8 17 ff ff ff       	call   803883 <dm>
+  80396c:	83 c4 14             	add    $0x14,%esp
+  80396f:	c3                   	ret
+
+00803970 <__umoddi3>:
+  803970:	83 ec 18             	sub    $0x18,%esp
+  803973:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803977:	50                   	push   %eax
+  803978:	ff 74 24 2c          	push   0x2c(%esp)
+  80397c:	ff 74 24 2c          	push   0x2c(%esp)
+  803980:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803984:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803988:	e8 f6 fe ff ff       	call   803883 <dm>
+  80398d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803991:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803995:	83 c4 24             	add    $0x24,%esp
+  803998:	c3                   	ret
+
+00803999 <__divdi3>:
+  803999:	53                   	push   %ebx
+  80399a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80399e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039a2:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8039a6:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8039aa:	85 d2                	test   %edx,%edx
+  8039ac:	78 15                	js     8039c3 <__divdi3+0x2a>
+  8039ae:	85 db                	test   %ebx,%ebx
+  8039b0:	78 34                	js     8039e6 <__divdi3+0x4d>
+  8039b2:	83 ec 04             	sub    $0x4,%esp
+  8039b5:	6a 00                	push   $0x0
+  8039b7:	53                   	push   %ebx
+  8039b8:	51                   	push   %ecx
+  8039b9:	e8 c5 fe ff ff       	call   803883 <dm>
+  8039be:	83 c4 10             	add    $0x10,%esp
+  8039c1:	eb 21                	jmp    8039e4 <__divdi3+0x4b>
+  8039c3:	f7 d8                	neg    %eax
+  8039c5:	83 d2 00             	adc    $0x0,%edx
+  8039c8:	f7 da                	neg    %edx
+  8039ca:	85 db                	test   %ebx,%ebx
+  8039cc:	78 30                	js     8039fe <__divdi3+0x65>
+  8039ce:	83 ec 04             	sub    $0x4,%esp
+  8039d1:	6a 00                	push   $0x0
+  8039d3:	53                   	push   %ebx
+  8039d4:	51                   	push   %ecx
+  8039d5:	e8 a9 fe ff ff       	call   803883 <dm>
+  8039da:	83 c4 10             	add    $0x10,%esp
+  8039dd:	f7 d8                	neg    %eax
+  8039df:	83 d2 00             	adc    $0x0,%edx
+  8039e2:	f7 da                	neg    %edx
+  8039e4:	5b                   	pop    %ebx
+  8039e5:	c3                   	ret
+  8039e6:	83 ec 04             	sub    $0x4,%esp
+  8039e9:	6a 00                	push   $0x0
+  8039eb:	f7 d9                	neg    %ecx
+  8039ed:	83 d3 00             	adc    $0x0,%ebx
+  8039f0:	f7 db                	neg    %ebx
+  8039f2:	53                   	push   %ebx
+  8039f3:	51                   	push   %ecx
+  8039f4:	e8 8a fe ff ff       	call   803883 <dm>
+  8039f9:	83 c4 10             	add    $0x10,%esp
+  8039fc:	eb df                	jmp    8039dd <__divdi3+0x44>
+  8039fe:	83 ec 04             	sub    $0x4,%esp
+  803a01:	6a 00                	push   $0x0
+  803a03:	f7 d9                	neg    %ecx
+  803a05:	83 d3 00             	adc    $0x0,%ebx
+  803a08:	f7 db                	neg    %ebx
+  803a0a:	53                   	push   %ebx
+  803a0b:	51                   	push   %ecx
+  803a0c:	e8 72 fe ff ff       	call   803883 <dm>
+  803a11:	83 c4 10             	add    $0x10,%esp
+  803a14:	eb ce                	jmp    8039e4 <__divdi3+0x4b>
+
+00803a16 <__moddi3>:
+  803a16:	55                   	push   %ebp
+  803a17:	57                   	push   %edi
+  803a18:	56                   	push   %esi
+  803a19:	53                   	push   %ebx
+  803a1a:	83 ec 24             	sub    $0x24,%esp
+  803a1d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803a21:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803a25:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803a29:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803a2d:	85 d2                	test   %edx,%edx
+  803a2f:	78 3b                	js     803a6c <__moddi3+0x56>
+  803a31:	83 ec 04             	sub    $0x4,%esp
+  803a34:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803a38:	56                   	push   %esi
+  803a39:	89 ce                	mov    %ecx,%esi
+  803a3b:	f7 de                	neg    %esi
+  803a3d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803a41:	89 de                	mov    %ebx,%esi
+  803a43:	83 d6 00             	adc    $0x0,%esi
+  803a46:	f7 de                	neg    %esi
+  803a48:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803a4c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803a50:	0f 48 f1             	cmovs  %ecx,%esi
+  803a53:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803a58:	53                   	push   %ebx
+  803a59:	56                   	push   %esi
+  803a5a:	e8 24 fe ff ff       	call   803883 <dm>
+  803a5f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a63:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a67:	83 c4 10             	add    $0x10,%esp
+  803a6a:	eb 47                	jmp    803ab3 <__moddi3+0x9d>
+  803a6c:	f7 d8                	neg    %eax
+  803a6e:	83 d2 00             	adc    $0x0,%edx
+  803a71:	f7 da                	neg    %edx
+  803a73:	83 ec 04             	sub    $0x4,%esp
+  803a76:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803a7a:	56                   	push   %esi
+  803a7b:	89 cf                	mov    %ecx,%edi
+  803a7d:	f7 df                	neg    %edi
+  803a7f:	89 de                	mov    %ebx,%esi
+  803a81:	83 d6 00             	adc    $0x0,%esi
+  803a84:	f7 de                	neg    %esi
+  803a86:	0f 49 cf             	cmovns %edi,%ecx
+  803a89:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803a8d:	0f 49 de             	cmovns %esi,%ebx
+  803a90:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803a94:	ff 74 24 0c          	push   0xc(%esp)
+  803a98:	ff 74 24 0c          	push   0xc(%esp)
+  803a9c:	e8 e2 fd ff ff       	call   803883 <dm>
+  803aa1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803aa5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803aa9:	f7 d8                	neg    %eax
+  803aab:	83 d2 00             	adc    $0x0,%edx
+  803aae:	f7 da                	neg    %edx
+  803ab0:	83 c4 10             	add    $0x10,%esp
+  803ab3:	83 c4 24             	add    $0x24,%esp
+  803ab6:	5b                   	pop    %ebx
+  803ab7:	5e                   	pop    %esi
+  803ab8:	5f                   	pop    %edi
+  803ab9:	5d                   	pop    %ebp
+  803aba:	c3                   	ret
@@ -0,0 +1,7621 @@
+
+obj/user/badsegment.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 09 00 00 00       	call   80003a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+	// Try to load the kernel's TSS selector into the DS register.
+	asm volatile("movw $0x28,%ax; movw %ax,%ds");
+  800033:	66 b8 28 00          	mov    $0x28,%ax
+  800037:	8e d8                	mov    %eax,%ds
+}
+  800039:	c3                   	ret
+
+0080003a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003a:	55                   	push   %ebp
+  80003b:	89 e5                	mov    %esp,%ebp
+  80003d:	56                   	push   %esi
+  80003e:	53                   	push   %ebx
+  80003f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800042:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800045:	e8 e9 00 00 00       	call   800133 <sys_getenvid>
+  80004a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004f:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800055:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80005a:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80005f:	85 db                	test   %ebx,%ebx
+  800061:	7e 07                	jle    80006a <libmain+0x30>
+		binaryname = argv[0];
+  800063:	8b 06                	mov    (%esi),%eax
+  800065:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80006a:	83 ec 08             	sub    $0x8,%esp
+  80006d:	56                   	push   %esi
+  80006e:	53                   	push   %ebx
+  80006f:	e8 bf ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800074:	e8 0a 00 00 00       	call   800083 <exit>
+}
+  800079:	83 c4 10             	add    $0x10,%esp
+  80007c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007f:	5b                   	pop    %ebx
+  800080:	5e                   	pop    %esi
+  800081:	5d                   	pop    %ebp
+  800082:	c3                   	ret
+
+00800083 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800083:	55                   	push   %ebp
+  800084:	89 e5                	mov    %esp,%ebp
+  800086:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800089:	e8 c0 06 00 00       	call   80074e <close_all>
+	sys_env_destroy(0);
+  80008e:	83 ec 0c             	sub    $0xc,%esp
+  800091:	6a 00                	push   $0x0
+  800093:	e8 52 00 00 00       	call   8000ea <sys_env_destroy>
+}
+  800098:	83 c4 10             	add    $0x10,%esp
+  80009b:	c9                   	leave
+  80009c:	c3                   	ret
+
+0080009d <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	57                   	push   %edi
+  8000a1:	56                   	push   %esi
+  8000a2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000ae:	89 c3                	mov    %eax,%ebx
+  8000b0:	89 c7                	mov    %eax,%edi
+  8000b2:	55                   	push   %ebp
+  8000b3:	89 e5                	mov    %esp,%ebp
+  8000b5:	8d 35 bd 00 80 00    	lea    0x8000bd,%esi
+  8000bb:	0f 34                	sysenter
+  8000bd:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  8000be:	5b                   	pop    %ebx
+  8000bf:	5e                   	pop    %esi
+  8000c0:	5f                   	pop    %edi
+  8000c1:	5d                   	pop    %ebp
+  8000c2:	c3                   	ret
+
+008000c3 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000c3:	55                   	push   %ebp
+  8000c4:	89 e5                	mov    %esp,%ebp
+  8000c6:	57                   	push   %edi
+  8000c7:	56                   	push   %esi
+  8000c8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d3:	89 d1                	mov    %edx,%ecx
+  8000d5:	89 d3                	mov    %edx,%ebx
+  8000d7:	89 d7                	mov    %edx,%edi
+  8000d9:	55                   	push   %ebp
+  8000da:	89 e5                	mov    %esp,%ebp
+  8000dc:	8d 35 e4 00 80 00    	lea    0x8000e4,%esi
+  8000e2:	0f 34                	sysenter
+  8000e4:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  8000e5:	5b                   	pop    %ebx
+  8000e6:	5e                   	pop    %esi
+  8000e7:	5f                   	pop    %edi
+  8000e8:	5d                   	pop    %ebp
+  8000e9:	c3                   	ret
+
+008000ea <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000ea:	55                   	push   %ebp
+  8000eb:	89 e5                	mov    %esp,%ebp
+  8000ed:	57                   	push   %edi
+  8000ee:	56                   	push   %esi
+  8000ef:	53                   	push   %ebx
+  8000f0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8000f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000fb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800100:	89 cb                	mov    %ecx,%ebx
+  800102:	89 cf                	mov    %ecx,%edi
+  800104:	55                   	push   %ebp
+  800105:	89 e5                	mov    %esp,%ebp
+  800107:	8d 35 0f 01 80 00    	lea    0x80010f,%esi
+  80010d:	0f 34                	sysenter
+  80010f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800110:	85 c0                	test   %eax,%eax
+  800112:	7f 08                	jg     80011c <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800114:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800117:	5b                   	pop    %ebx
+  800118:	5e                   	pop    %esi
+  800119:	5f                   	pop    %edi
+  80011a:	5d                   	pop    %ebp
+  80011b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80011c:	83 ec 0c             	sub    $0xc,%esp
+  80011f:	50                   	push   %eax
+  800120:	6a 03                	push   $0x3
+  800122:	68 4a 37 80 00       	push   $0x80374a
+  800127:	6a 3d                	push   $0x3d
+  800129:	68 67 37 80 00       	push   $0x803767
+  80012e:	e8 02 24 00 00       	call   802535 <_panic>
+
+00800133 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800133:	55                   	push   %ebp
+  800134:	89 e5                	mov    %esp,%ebp
+  800136:	57                   	push   %edi
+  800137:	56                   	push   %esi
+  800138:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800139:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800143:	89 d1                	mov    %edx,%ecx
+  800145:	89 d3                	mov    %edx,%ebx
+  800147:	89 d7                	mov    %edx,%edi
+  800149:	55                   	push   %ebp
+  80014a:	89 e5                	mov    %esp,%ebp
+  80014c:	8d 35 54 01 80 00    	lea    0x800154,%esi
+  800152:	0f 34                	sysenter
+  800154:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800155:	5b                   	pop    %ebx
+  800156:	5e                   	pop    %esi
+  800157:	5f                   	pop    %edi
+  800158:	5d                   	pop    %ebp
+  800159:	c3                   	ret
+
+0080015a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80015a:	55                   	push   %ebp
+  80015b:	89 e5                	mov    %esp,%ebp
+  80015d:	57                   	push   %edi
+  80015e:	56                   	push   %esi
+  80015f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800160:	ba 00 00 00 00       	mov    $0x0,%edx
+  800165:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80016a:	89 d1                	mov    %edx,%ecx
+  80016c:	89 d3                	mov    %edx,%ebx
+  80016e:	89 d7                	mov    %edx,%edi
+  800170:	89 d6                	mov    %edx,%esi
+  800172:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800174:	5b                   	pop    %ebx
+  800175:	5e                   	pop    %esi
+  800176:	5f                   	pop    %edi
+  800177:	5d                   	pop    %ebp
+  800178:	c3                   	ret
+
+00800179 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800179:	55                   	push   %ebp
+  80017a:	89 e5                	mov    %esp,%ebp
+  80017c:	57                   	push   %edi
+  80017d:	56                   	push   %esi
+  80017e:	53                   	push   %ebx
+  80017f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800182:	8b 55 08             	mov    0x8(%ebp),%edx
+  800185:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800188:	b8 04 00 00 00       	mov    $0x4,%eax
+  80018d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800192:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800195:	55                   	push   %ebp
+  800196:	89 e5                	mov    %esp,%ebp
+  800198:	8d 35 a0 01 80 00    	lea    0x8001a0,%esi
+  80019e:	0f 34                	sysenter
+  8001a0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8001a1:	85 c0                	test   %eax,%eax
+  8001a3:	7f 08                	jg     8001ad <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  8001a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a8:	5b                   	pop    %ebx
+  8001a9:	5e                   	pop    %esi
+  8001aa:	5f                   	pop    %edi
+  8001ab:	5d                   	pop    %ebp
+  8001ac:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001ad:	83 ec 0c             	sub    $0xc,%esp
+  8001b0:	50                   	push   %eax
+  8001b1:	6a 04                	push   $0x4
+  8001b3:	68 4a 37 80 00       	push   $0x80374a
+  8001b8:	6a 3d                	push   $0x3d
+  8001ba:	68 67 37 80 00       	push   $0x803767
+  8001bf:	e8 71 23 00 00       	call   802535 <_panic>
+
+008001c4 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001c4:	55                   	push   %ebp
+  8001c5:	89 e5                	mov    %esp,%ebp
+  8001c7:	57                   	push   %edi
+  8001c8:	56                   	push   %esi
+  8001c9:	53                   	push   %ebx
+  8001ca:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001d3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001db:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001de:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001e1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001e3:	85 c0                	test   %eax,%eax
+  8001e5:	7f 08                	jg     8001ef <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001ea:	5b                   	pop    %ebx
+  8001eb:	5e                   	pop    %esi
+  8001ec:	5f                   	pop    %edi
+  8001ed:	5d                   	pop    %ebp
+  8001ee:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001ef:	83 ec 0c             	sub    $0xc,%esp
+  8001f2:	50                   	push   %eax
+  8001f3:	6a 05                	push   $0x5
+  8001f5:	68 4a 37 80 00       	push   $0x80374a
+  8001fa:	6a 23                	push   $0x23
+  8001fc:	68 67 37 80 00       	push   $0x803767
+  800201:	e8 2f 23 00 00       	call   802535 <_panic>
+
+00800206 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800206:	55                   	push   %ebp
+  800207:	89 e5                	mov    %esp,%ebp
+  800209:	57                   	push   %edi
+  80020a:	56                   	push   %esi
+  80020b:	53                   	push   %ebx
+  80020c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80020f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800214:	8b 55 08             	mov    0x8(%ebp),%edx
+  800217:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80021a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80021f:	89 df                	mov    %ebx,%edi
+  800221:	55                   	push   %ebp
+  800222:	89 e5                	mov    %esp,%ebp
+  800224:	8d 35 2c 02 80 00    	lea    0x80022c,%esi
+  80022a:	0f 34                	sysenter
+  80022c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80022d:	85 c0                	test   %eax,%eax
+  80022f:	7f 08                	jg     800239 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800231:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800234:	5b                   	pop    %ebx
+  800235:	5e                   	pop    %esi
+  800236:	5f                   	pop    %edi
+  800237:	5d                   	pop    %ebp
+  800238:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800239:	83 ec 0c             	sub    $0xc,%esp
+  80023c:	50                   	push   %eax
+  80023d:	6a 06                	push   $0x6
+  80023f:	68 4a 37 80 00       	push   $0x80374a
+  800244:	6a 3d                	push   $0x3d
+  800246:	68 67 37 80 00       	push   $0x803767
+  80024b:	e8 e5 22 00 00       	call   802535 <_panic>
+
+00800250 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800250:	55                   	push   %ebp
+  800251:	89 e5                	mov    %esp,%ebp
+  800253:	57                   	push   %edi
+  800254:	56                   	push   %esi
+  800255:	53                   	push   %ebx
+  800256:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800259:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80025e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800261:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800264:	b8 08 00 00 00       	mov    $0x8,%eax
+  800269:	89 df                	mov    %ebx,%edi
+  80026b:	55                   	push   %ebp
+  80026c:	89 e5                	mov    %esp,%ebp
+  80026e:	8d 35 76 02 80 00    	lea    0x800276,%esi
+  800274:	0f 34                	sysenter
+  800276:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800277:	85 c0                	test   %eax,%eax
+  800279:	7f 08                	jg     800283 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  80027b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027e:	5b                   	pop    %ebx
+  80027f:	5e                   	pop    %esi
+  800280:	5f                   	pop    %edi
+  800281:	5d                   	pop    %ebp
+  800282:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800283:	83 ec 0c             	sub    $0xc,%esp
+  800286:	50                   	push   %eax
+  800287:	6a 08                	push   $0x8
+  800289:	68 4a 37 80 00       	push   $0x80374a
+  80028e:	6a 3d                	push   $0x3d
+  800290:	68 67 37 80 00       	push   $0x803767
+  800295:	e8 9b 22 00 00       	call   802535 <_panic>
+
+0080029a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80029a:	55                   	push   %ebp
+  80029b:	89 e5                	mov    %esp,%ebp
+  80029d:	57                   	push   %edi
+  80029e:	56                   	push   %esi
+  80029f:	53                   	push   %ebx
+  8002a0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8002a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002ae:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002b3:	89 df                	mov    %ebx,%edi
+  8002b5:	55                   	push   %ebp
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	8d 35 c0 02 80 00    	lea    0x8002c0,%esi
+  8002be:	0f 34                	sysenter
+  8002c0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8002c1:	85 c0                	test   %eax,%eax
+  8002c3:	7f 08                	jg     8002cd <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  8002c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c8:	5b                   	pop    %ebx
+  8002c9:	5e                   	pop    %esi
+  8002ca:	5f                   	pop    %edi
+  8002cb:	5d                   	pop    %ebp
+  8002cc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002cd:	83 ec 0c             	sub    $0xc,%esp
+  8002d0:	50                   	push   %eax
+  8002d1:	6a 09                	push   $0x9
+  8002d3:	68 4a 37 80 00       	push   $0x80374a
+  8002d8:	6a 3d                	push   $0x3d
+  8002da:	68 67 37 80 00       	push   $0x803767
+  8002df:	e8 51 22 00 00       	call   802535 <_panic>
+
+008002e4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002e4:	55                   	push   %ebp
+  8002e5:	89 e5                	mov    %esp,%ebp
+  8002e7:	57                   	push   %edi
+  8002e8:	56                   	push   %esi
+  8002e9:	53                   	push   %ebx
+  8002ea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8002ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002fd:	89 df                	mov    %ebx,%edi
+  8002ff:	55                   	push   %ebp
+  800300:	89 e5                	mov    %esp,%ebp
+  800302:	8d 35 0a 03 80 00    	lea    0x80030a,%esi
+  800308:	0f 34                	sysenter
+  80030a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80030b:	85 c0                	test   %eax,%eax
+  80030d:	7f 08                	jg     800317 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  80030f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800312:	5b                   	pop    %ebx
+  800313:	5e                   	pop    %esi
+  800314:	5f                   	pop    %edi
+  800315:	5d                   	pop    %ebp
+  800316:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800317:	83 ec 0c             	sub    $0xc,%esp
+  80031a:	50                   	push   %eax
+  80031b:	6a 0a                	push   $0xa
+  80031d:	68 4a 37 80 00       	push   $0x80374a
+  800322:	6a 3d                	push   $0x3d
+  800324:	68 67 37 80 00       	push   $0x803767
+  800329:	e8 07 22 00 00       	call   802535 <_panic>
+
+0080032e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80032e:	55                   	push   %ebp
+  80032f:	89 e5                	mov    %esp,%ebp
+  800331:	57                   	push   %edi
+  800332:	56                   	push   %esi
+  800333:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800334:	8b 55 08             	mov    0x8(%ebp),%edx
+  800337:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80033a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80033f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800342:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800345:	55                   	push   %ebp
+  800346:	89 e5                	mov    %esp,%ebp
+  800348:	8d 35 50 03 80 00    	lea    0x800350,%esi
+  80034e:	0f 34                	sysenter
+  800350:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800351:	5b                   	pop    %ebx
+  800352:	5e                   	pop    %esi
+  800353:	5f                   	pop    %edi
+  800354:	5d                   	pop    %ebp
+  800355:	c3                   	ret
+
+00800356 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800356:	55                   	push   %ebp
+  800357:	89 e5                	mov    %esp,%ebp
+  800359:	57                   	push   %edi
+  80035a:	56                   	push   %esi
+  80035b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80035c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80035f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800362:	b8 17 00 00 00       	mov    $0x17,%eax
+  800367:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80036a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80036d:	55                   	push   %ebp
+  80036e:	89 e5                	mov    %esp,%ebp
+  800370:	8d 35 78 03 80 00    	lea    0x800378,%esi
+  800376:	0f 34                	sysenter
+  800378:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800379:	5b                   	pop    %ebx
+  80037a:	5e                   	pop    %esi
+  80037b:	5f                   	pop    %edi
+  80037c:	5d                   	pop    %ebp
+  80037d:	c3                   	ret
+
+0080037e <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  80037e:	55                   	push   %ebp
+  80037f:	89 e5                	mov    %esp,%ebp
+  800381:	57                   	push   %edi
+  800382:	56                   	push   %esi
+  800383:	53                   	push   %ebx
+  800384:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800387:	be 00 00 00 00       	mov    $0x0,%esi
+  80038c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80038f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800392:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800397:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80039a:	89 f7                	mov    %esi,%edi
+  80039c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80039e:	85 c0                	test   %eax,%eax
+  8003a0:	7f 08                	jg     8003aa <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8003a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a5:	5b                   	pop    %ebx
+  8003a6:	5e                   	pop    %esi
+  8003a7:	5f                   	pop    %edi
+  8003a8:	5d                   	pop    %ebp
+  8003a9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003aa:	83 ec 0c             	sub    $0xc,%esp
+  8003ad:	50                   	push   %eax
+  8003ae:	6a 0d                	push   $0xd
+  8003b0:	68 4a 37 80 00       	push   $0x80374a
+  8003b5:	6a 23                	push   $0x23
+  8003b7:	68 67 37 80 00       	push   $0x803767
+  8003bc:	e8 74 21 00 00       	call   802535 <_panic>
+
+008003c1 <sys_ipc_recv>:
+{
+  8003c1:	55                   	push   %ebp
+  8003c2:	89 e5                	mov    %esp,%ebp
+  8003c4:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  8003c7:	6a 00                	push   $0x0
+  8003c9:	6a 01                	push   $0x1
+  8003cb:	ff 75 08             	push   0x8(%ebp)
+  8003ce:	e8 ab ff ff ff       	call   80037e <sys_ipc_recvv>
+}
+  8003d3:	c9                   	leave
+  8003d4:	c3                   	ret
+
+008003d5 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  8003d5:	55                   	push   %ebp
+  8003d6:	89 e5                	mov    %esp,%ebp
+  8003d8:	57                   	push   %edi
+  8003d9:	56                   	push   %esi
+  8003da:	53                   	push   %ebx
+  8003db:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003e9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003ee:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003f1:	89 de                	mov    %ebx,%esi
+  8003f3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003f5:	85 c0                	test   %eax,%eax
+  8003f7:	7f 08                	jg     800401 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  8003f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003fc:	5b                   	pop    %ebx
+  8003fd:	5e                   	pop    %esi
+  8003fe:	5f                   	pop    %edi
+  8003ff:	5d                   	pop    %ebp
+  800400:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800401:	83 ec 0c             	sub    $0xc,%esp
+  800404:	50                   	push   %eax
+  800405:	6a 0d                	push   $0xd
+  800407:	68 4a 37 80 00       	push   $0x80374a
+  80040c:	6a 23                	push   $0x23
+  80040e:	68 67 37 80 00       	push   $0x803767
+  800413:	e8 1d 21 00 00       	call   802535 <_panic>
+
+00800418 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800418:	55                   	push   %ebp
+  800419:	89 e5                	mov    %esp,%ebp
+  80041b:	57                   	push   %edi
+  80041c:	56                   	push   %esi
+  80041d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80041e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800423:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800428:	89 d1                	mov    %edx,%ecx
+  80042a:	89 d3                	mov    %edx,%ebx
+  80042c:	89 d7                	mov    %edx,%edi
+  80042e:	55                   	push   %ebp
+  80042f:	89 e5                	mov    %esp,%ebp
+  800431:	8d 35 39 04 80 00    	lea    0x800439,%esi
+  800437:	0f 34                	sysenter
+  800439:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  80043a:	5b                   	pop    %ebx
+  80043b:	5e                   	pop    %esi
+  80043c:	5f                   	pop    %edi
+  80043d:	5d                   	pop    %ebp
+  80043e:	c3                   	ret
+
+0080043f <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  80043f:	55                   	push   %ebp
+  800440:	89 e5                	mov    %esp,%ebp
+  800442:	57                   	push   %edi
+  800443:	56                   	push   %esi
+  800444:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800445:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80044a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80044d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800450:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800455:	89 df                	mov    %ebx,%edi
+  800457:	55                   	push   %ebp
+  800458:	89 e5                	mov    %esp,%ebp
+  80045a:	8d 35 62 04 80 00    	lea    0x800462,%esi
+  800460:	0f 34                	sysenter
+  800462:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800463:	5b                   	pop    %ebx
+  800464:	5e                   	pop    %esi
+  800465:	5f                   	pop    %edi
+  800466:	5d                   	pop    %ebp
+  800467:	c3                   	ret
+
+00800468 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800468:	55                   	push   %ebp
+  800469:	89 e5                	mov    %esp,%ebp
+  80046b:	57                   	push   %edi
+  80046c:	56                   	push   %esi
+  80046d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80046e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800473:	8b 55 08             	mov    0x8(%ebp),%edx
+  800476:	b8 10 00 00 00       	mov    $0x10,%eax
+  80047b:	89 cb                	mov    %ecx,%ebx
+  80047d:	89 cf                	mov    %ecx,%edi
+  80047f:	55                   	push   %ebp
+  800480:	89 e5                	mov    %esp,%ebp
+  800482:	8d 35 8a 04 80 00    	lea    0x80048a,%esi
+  800488:	0f 34                	sysenter
+  80048a:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  80048b:	5b                   	pop    %ebx
+  80048c:	5e                   	pop    %esi
+  80048d:	5f                   	pop    %edi
+  80048e:	5d                   	pop    %ebp
+  80048f:	c3                   	ret
+
+00800490 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800490:	55                   	push   %ebp
+  800491:	89 e5                	mov    %esp,%ebp
+  800493:	57                   	push   %edi
+  800494:	56                   	push   %esi
+  800495:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800496:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80049b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004a1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8004a6:	89 df                	mov    %ebx,%edi
+  8004a8:	55                   	push   %ebp
+  8004a9:	89 e5                	mov    %esp,%ebp
+  8004ab:	8d 35 b3 04 80 00    	lea    0x8004b3,%esi
+  8004b1:	0f 34                	sysenter
+  8004b3:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8004b4:	5b                   	pop    %ebx
+  8004b5:	5e                   	pop    %esi
+  8004b6:	5f                   	pop    %edi
+  8004b7:	5d                   	pop    %ebp
+  8004b8:	c3                   	ret
+
+008004b9 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8004b9:	55                   	push   %ebp
+  8004ba:	89 e5                	mov    %esp,%ebp
+  8004bc:	57                   	push   %edi
+  8004bd:	56                   	push   %esi
+  8004be:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ca:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004cf:	89 df                	mov    %ebx,%edi
+  8004d1:	55                   	push   %ebp
+  8004d2:	89 e5                	mov    %esp,%ebp
+  8004d4:	8d 35 dc 04 80 00    	lea    0x8004dc,%esi
+  8004da:	0f 34                	sysenter
+  8004dc:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  8004dd:	5b                   	pop    %ebx
+  8004de:	5e                   	pop    %esi
+  8004df:	5f                   	pop    %edi
+  8004e0:	5d                   	pop    %ebp
+  8004e1:	c3                   	ret
+
+008004e2 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  8004e2:	55                   	push   %ebp
+  8004e3:	89 e5                	mov    %esp,%ebp
+  8004e5:	57                   	push   %edi
+  8004e6:	56                   	push   %esi
+  8004e7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ee:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004f6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004f9:	55                   	push   %ebp
+  8004fa:	89 e5                	mov    %esp,%ebp
+  8004fc:	8d 35 04 05 80 00    	lea    0x800504,%esi
+  800502:	0f 34                	sysenter
+  800504:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800505:	5b                   	pop    %ebx
+  800506:	5e                   	pop    %esi
+  800507:	5f                   	pop    %edi
+  800508:	5d                   	pop    %ebp
+  800509:	c3                   	ret
+
+0080050a <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  80050a:	55                   	push   %ebp
+  80050b:	89 e5                	mov    %esp,%ebp
+  80050d:	57                   	push   %edi
+  80050e:	56                   	push   %esi
+  80050f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800510:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800515:	8b 55 08             	mov    0x8(%ebp),%edx
+  800518:	b8 11 00 00 00       	mov    $0x11,%eax
+  80051d:	89 cb                	mov    %ecx,%ebx
+  80051f:	89 cf                	mov    %ecx,%edi
+  800521:	89 ce                	mov    %ecx,%esi
+  800523:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800525:	5b                   	pop    %ebx
+  800526:	5e                   	pop    %esi
+  800527:	5f                   	pop    %edi
+  800528:	5d                   	pop    %ebp
+  800529:	c3                   	ret
+
+0080052a <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  80052a:	55                   	push   %ebp
+  80052b:	89 e5                	mov    %esp,%ebp
+  80052d:	57                   	push   %edi
+  80052e:	56                   	push   %esi
+  80052f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800530:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800535:	8b 55 08             	mov    0x8(%ebp),%edx
+  800538:	b8 15 00 00 00       	mov    $0x15,%eax
+  80053d:	89 cb                	mov    %ecx,%ebx
+  80053f:	89 cf                	mov    %ecx,%edi
+  800541:	55                   	push   %ebp
+  800542:	89 e5                	mov    %esp,%ebp
+  800544:	8d 35 4c 05 80 00    	lea    0x80054c,%esi
+  80054a:	0f 34                	sysenter
+  80054c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  80054d:	5b                   	pop    %ebx
+  80054e:	5e                   	pop    %esi
+  80054f:	5f                   	pop    %edi
+  800550:	5d                   	pop    %ebp
+  800551:	c3                   	ret
+
+00800552 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800552:	55                   	push   %ebp
+  800553:	89 e5                	mov    %esp,%ebp
+  800555:	57                   	push   %edi
+  800556:	56                   	push   %esi
+  800557:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800558:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80055d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800560:	b8 16 00 00 00       	mov    $0x16,%eax
+  800565:	89 cb                	mov    %ecx,%ebx
+  800567:	89 cf                	mov    %ecx,%edi
+  800569:	55                   	push   %ebp
+  80056a:	89 e5                	mov    %esp,%ebp
+  80056c:	8d 35 74 05 80 00    	lea    0x800574,%esi
+  800572:	0f 34                	sysenter
+  800574:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800575:	5b                   	pop    %ebx
+  800576:	5e                   	pop    %esi
+  800577:	5f                   	pop    %edi
+  800578:	5d                   	pop    %ebp
+  800579:	c3                   	ret
+
+0080057a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80057a:	55                   	push   %ebp
+  80057b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80057d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800580:	05 00 00 00 30       	add    $0x30000000,%eax
+  800585:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800588:	5d                   	pop    %ebp
+  800589:	c3                   	ret
+
+0080058a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80058a:	55                   	push   %ebp
+  80058b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80058d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800590:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800595:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80059a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80059f:	5d                   	pop    %ebp
+  8005a0:	c3                   	ret
+
+008005a1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8005a1:	55                   	push   %ebp
+  8005a2:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8005a4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8005a9:	eb 02                	jmp    8005ad <fd_alloc+0xc>
+  8005ab:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8005ad:	89 c2                	mov    %eax,%edx
+  8005af:	c1 ea 16             	shr    $0x16,%edx
+  8005b2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8005b9:	f6 c2 01             	test   $0x1,%dl
+  8005bc:	74 2b                	je     8005e9 <fd_alloc+0x48>
+  8005be:	89 c2                	mov    %eax,%edx
+  8005c0:	c1 ea 0c             	shr    $0xc,%edx
+  8005c3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8005ca:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8005d0:	f6 c1 01             	test   $0x1,%cl
+  8005d3:	74 14                	je     8005e9 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8005d5:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8005db:	75 ce                	jne    8005ab <fd_alloc+0xa>
+  8005dd:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8005e2:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8005e7:	eb 05                	jmp    8005ee <fd_alloc+0x4d>
+			return 0;
+  8005e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8005ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005f1:	89 02                	mov    %eax,(%edx)
+}
+  8005f3:	89 c8                	mov    %ecx,%eax
+  8005f5:	5d                   	pop    %ebp
+  8005f6:	c3                   	ret
+
+008005f7 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8005f7:	55                   	push   %ebp
+  8005f8:	89 e5                	mov    %esp,%ebp
+  8005fa:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8005fd:	83 f8 1f             	cmp    $0x1f,%eax
+  800600:	77 30                	ja     800632 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800602:	c1 e0 0c             	shl    $0xc,%eax
+  800605:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80060a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800610:	f6 c2 01             	test   $0x1,%dl
+  800613:	74 24                	je     800639 <fd_lookup+0x42>
+  800615:	89 c2                	mov    %eax,%edx
+  800617:	c1 ea 0c             	shr    $0xc,%edx
+  80061a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800621:	f6 c2 01             	test   $0x1,%dl
+  800624:	74 1a                	je     800640 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800626:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800629:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80062b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800630:	5d                   	pop    %ebp
+  800631:	c3                   	ret
+		return -E_INVAL;
+  800632:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800637:	eb f7                	jmp    800630 <fd_lookup+0x39>
+		return -E_INVAL;
+  800639:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80063e:	eb f0                	jmp    800630 <fd_lookup+0x39>
+  800640:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800645:	eb e9                	jmp    800630 <fd_lookup+0x39>
+
+00800647 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800647:	55                   	push   %ebp
+  800648:	89 e5                	mov    %esp,%ebp
+  80064a:	53                   	push   %ebx
+  80064b:	83 ec 04             	sub    $0x4,%esp
+  80064e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800651:	b8 00 00 00 00       	mov    $0x0,%eax
+  800656:	eb 03                	jmp    80065b <dev_lookup+0x14>
+  800658:	83 c0 01             	add    $0x1,%eax
+  80065b:	8b 1c 85 f4 37 80 00 	mov    0x8037f4(,%eax,4),%ebx
+  800662:	85 db                	test   %ebx,%ebx
+  800664:	74 0b                	je     800671 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800666:	39 13                	cmp    %edx,(%ebx)
+  800668:	75 ee                	jne    800658 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80066a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066f:	eb 1f                	jmp    800690 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800671:	a1 00 50 80 00       	mov    0x805000,%eax
+  800676:	8b 40 48             	mov    0x48(%eax),%eax
+  800679:	83 ec 04             	sub    $0x4,%esp
+  80067c:	52                   	push   %edx
+  80067d:	50                   	push   %eax
+  80067e:	68 78 37 80 00       	push   $0x803778
+  800683:	e8 88 1f 00 00       	call   802610 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800688:	83 c4 10             	add    $0x10,%esp
+  80068b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800690:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800693:	89 1a                	mov    %ebx,(%edx)
+}
+  800695:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800698:	c9                   	leave
+  800699:	c3                   	ret
+
+0080069a <fd_close>:
+{
+  80069a:	55                   	push   %ebp
+  80069b:	89 e5                	mov    %esp,%ebp
+  80069d:	57                   	push   %edi
+  80069e:	56                   	push   %esi
+  80069f:	53                   	push   %ebx
+  8006a0:	83 ec 24             	sub    $0x24,%esp
+  8006a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006a6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006a9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8006ac:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8006ad:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8006b3:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006b6:	50                   	push   %eax
+  8006b7:	e8 3b ff ff ff       	call   8005f7 <fd_lookup>
+  8006bc:	89 c3                	mov    %eax,%ebx
+  8006be:	83 c4 10             	add    $0x10,%esp
+  8006c1:	85 c0                	test   %eax,%eax
+  8006c3:	78 05                	js     8006ca <fd_close+0x30>
+	    || fd != fd2)
+  8006c5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8006c8:	74 16                	je     8006e0 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8006ca:	89 f8                	mov    %edi,%eax
+  8006cc:	84 c0                	test   %al,%al
+  8006ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d3:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8006d6:	89 d8                	mov    %ebx,%eax
+  8006d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006db:	5b                   	pop    %ebx
+  8006dc:	5e                   	pop    %esi
+  8006dd:	5f                   	pop    %edi
+  8006de:	5d                   	pop    %ebp
+  8006df:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8006e0:	83 ec 08             	sub    $0x8,%esp
+  8006e3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8006e6:	50                   	push   %eax
+  8006e7:	ff 36                	push   (%esi)
+  8006e9:	e8 59 ff ff ff       	call   800647 <dev_lookup>
+  8006ee:	89 c3                	mov    %eax,%ebx
+  8006f0:	83 c4 10             	add    $0x10,%esp
+  8006f3:	85 c0                	test   %eax,%eax
+  8006f5:	78 1a                	js     800711 <fd_close+0x77>
+		if (dev->dev_close)
+  8006f7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006fa:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8006fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800702:	85 c0                	test   %eax,%eax
+  800704:	74 0b                	je     800711 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800706:	83 ec 0c             	sub    $0xc,%esp
+  800709:	56                   	push   %esi
+  80070a:	ff d0                	call   *%eax
+  80070c:	89 c3                	mov    %eax,%ebx
+  80070e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800711:	83 ec 08             	sub    $0x8,%esp
+  800714:	56                   	push   %esi
+  800715:	6a 00                	push   $0x0
+  800717:	e8 ea fa ff ff       	call   800206 <sys_page_unmap>
+	return r;
+  80071c:	83 c4 10             	add    $0x10,%esp
+  80071f:	eb b5                	jmp    8006d6 <fd_close+0x3c>
+
+00800721 <close>:
+
+int
+close(int fdnum)
+{
+  800721:	55                   	push   %ebp
+  800722:	89 e5                	mov    %esp,%ebp
+  800724:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800727:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80072a:	50                   	push   %eax
+  80072b:	ff 75 08             	push   0x8(%ebp)
+  80072e:	e8 c4 fe ff ff       	call   8005f7 <fd_lookup>
+  800733:	83 c4 10             	add    $0x10,%esp
+  800736:	85 c0                	test   %eax,%eax
+  800738:	79 02                	jns    80073c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80073a:	c9                   	leave
+  80073b:	c3                   	ret
+		return fd_close(fd, 1);
+  80073c:	83 ec 08             	sub    $0x8,%esp
+  80073f:	6a 01                	push   $0x1
+  800741:	ff 75 f4             	push   -0xc(%ebp)
+  800744:	e8 51 ff ff ff       	call   80069a <fd_close>
+  800749:	83 c4 10             	add    $0x10,%esp
+  80074c:	eb ec                	jmp    80073a <close+0x19>
+
+0080074e <close_all>:
+
+void
+close_all(void)
+{
+  80074e:	55                   	push   %ebp
+  80074f:	89 e5                	mov    %esp,%ebp
+  800751:	53                   	push   %ebx
+  800752:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800755:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80075a:	83 ec 0c             	sub    $0xc,%esp
+  80075d:	53                   	push   %ebx
+  80075e:	e8 be ff ff ff       	call   800721 <close>
+	for (i = 0; i < MAXFD; i++)
+  800763:	83 c3 01             	add    $0x1,%ebx
+  800766:	83 c4 10             	add    $0x10,%esp
+  800769:	83 fb 20             	cmp    $0x20,%ebx
+  80076c:	75 ec                	jne    80075a <close_all+0xc>
+}
+  80076e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800771:	c9                   	leave
+  800772:	c3                   	ret
+
+00800773 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800773:	55                   	push   %ebp
+  800774:	89 e5                	mov    %esp,%ebp
+  800776:	57                   	push   %edi
+  800777:	56                   	push   %esi
+  800778:	53                   	push   %ebx
+  800779:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80077c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80077f:	50                   	push   %eax
+  800780:	ff 75 08             	push   0x8(%ebp)
+  800783:	e8 6f fe ff ff       	call   8005f7 <fd_lookup>
+  800788:	89 c3                	mov    %eax,%ebx
+  80078a:	83 c4 10             	add    $0x10,%esp
+  80078d:	85 c0                	test   %eax,%eax
+  80078f:	78 7f                	js     800810 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800791:	83 ec 0c             	sub    $0xc,%esp
+  800794:	ff 75 0c             	push   0xc(%ebp)
+  800797:	e8 85 ff ff ff       	call   800721 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80079c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80079f:	c1 e6 0c             	shl    $0xc,%esi
+  8007a2:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8007a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8007ab:	89 3c 24             	mov    %edi,(%esp)
+  8007ae:	e8 d7 fd ff ff       	call   80058a <fd2data>
+  8007b3:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8007b5:	89 34 24             	mov    %esi,(%esp)
+  8007b8:	e8 cd fd ff ff       	call   80058a <fd2data>
+  8007bd:	83 c4 10             	add    $0x10,%esp
+  8007c0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8007c3:	89 d8                	mov    %ebx,%eax
+  8007c5:	c1 e8 16             	shr    $0x16,%eax
+  8007c8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8007cf:	a8 01                	test   $0x1,%al
+  8007d1:	74 11                	je     8007e4 <dup+0x71>
+  8007d3:	89 d8                	mov    %ebx,%eax
+  8007d5:	c1 e8 0c             	shr    $0xc,%eax
+  8007d8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8007df:	f6 c2 01             	test   $0x1,%dl
+  8007e2:	75 36                	jne    80081a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8007e4:	89 f8                	mov    %edi,%eax
+  8007e6:	c1 e8 0c             	shr    $0xc,%eax
+  8007e9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8007f0:	83 ec 0c             	sub    $0xc,%esp
+  8007f3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8007f8:	50                   	push   %eax
+  8007f9:	56                   	push   %esi
+  8007fa:	6a 00                	push   $0x0
+  8007fc:	57                   	push   %edi
+  8007fd:	6a 00                	push   $0x0
+  8007ff:	e8 c0 f9 ff ff       	call   8001c4 <sys_page_map>
+  800804:	89 c3                	mov    %eax,%ebx
+  800806:	83 c4 20             	add    $0x20,%esp
+  800809:	85 c0                	test   %eax,%eax
+  80080b:	78 33                	js     800840 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80080d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800810:	89 d8                	mov    %ebx,%eax
+  800812:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800815:	5b                   	pop    %ebx
+  800816:	5e                   	pop    %esi
+  800817:	5f                   	pop    %edi
+  800818:	5d                   	pop    %ebp
+  800819:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80081a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800821:	83 ec 0c             	sub    $0xc,%esp
+  800824:	25 07 0e 00 00       	and    $0xe07,%eax
+  800829:	50                   	push   %eax
+  80082a:	ff 75 d4             	push   -0x2c(%ebp)
+  80082d:	6a 00                	push   $0x0
+  80082f:	53                   	push   %ebx
+  800830:	6a 00                	push   $0x0
+  800832:	e8 8d f9 ff ff       	call   8001c4 <sys_page_map>
+  800837:	89 c3                	mov    %eax,%ebx
+  800839:	83 c4 20             	add    $0x20,%esp
+  80083c:	85 c0                	test   %eax,%eax
+  80083e:	79 a4                	jns    8007e4 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800840:	83 ec 08             	sub    $0x8,%esp
+  800843:	56                   	push   %esi
+  800844:	6a 00                	push   $0x0
+  800846:	e8 bb f9 ff ff       	call   800206 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80084b:	83 c4 08             	add    $0x8,%esp
+  80084e:	ff 75 d4             	push   -0x2c(%ebp)
+  800851:	6a 00                	push   $0x0
+  800853:	e8 ae f9 ff ff       	call   800206 <sys_page_unmap>
+	return r;
+  800858:	83 c4 10             	add    $0x10,%esp
+  80085b:	eb b3                	jmp    800810 <dup+0x9d>
+
+0080085d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80085d:	55                   	push   %ebp
+  80085e:	89 e5                	mov    %esp,%ebp
+  800860:	56                   	push   %esi
+  800861:	53                   	push   %ebx
+  800862:	83 ec 18             	sub    $0x18,%esp
+  800865:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800868:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80086b:	50                   	push   %eax
+  80086c:	56                   	push   %esi
+  80086d:	e8 85 fd ff ff       	call   8005f7 <fd_lookup>
+  800872:	83 c4 10             	add    $0x10,%esp
+  800875:	85 c0                	test   %eax,%eax
+  800877:	78 3c                	js     8008b5 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800879:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80087c:	83 ec 08             	sub    $0x8,%esp
+  80087f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800882:	50                   	push   %eax
+  800883:	ff 33                	push   (%ebx)
+  800885:	e8 bd fd ff ff       	call   800647 <dev_lookup>
+  80088a:	83 c4 10             	add    $0x10,%esp
+  80088d:	85 c0                	test   %eax,%eax
+  80088f:	78 24                	js     8008b5 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800891:	8b 43 08             	mov    0x8(%ebx),%eax
+  800894:	83 e0 03             	and    $0x3,%eax
+  800897:	83 f8 01             	cmp    $0x1,%eax
+  80089a:	74 20                	je     8008bc <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80089c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80089f:	8b 40 08             	mov    0x8(%eax),%eax
+  8008a2:	85 c0                	test   %eax,%eax
+  8008a4:	74 37                	je     8008dd <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8008a6:	83 ec 04             	sub    $0x4,%esp
+  8008a9:	ff 75 10             	push   0x10(%ebp)
+  8008ac:	ff 75 0c             	push   0xc(%ebp)
+  8008af:	53                   	push   %ebx
+  8008b0:	ff d0                	call   *%eax
+  8008b2:	83 c4 10             	add    $0x10,%esp
+}
+  8008b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008b8:	5b                   	pop    %ebx
+  8008b9:	5e                   	pop    %esi
+  8008ba:	5d                   	pop    %ebp
+  8008bb:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8008bc:	a1 00 50 80 00       	mov    0x805000,%eax
+  8008c1:	8b 40 48             	mov    0x48(%eax),%eax
+  8008c4:	83 ec 04             	sub    $0x4,%esp
+  8008c7:	56                   	push   %esi
+  8008c8:	50                   	push   %eax
+  8008c9:	68 b9 37 80 00       	push   $0x8037b9
+  8008ce:	e8 3d 1d 00 00       	call   802610 <cprintf>
+		return -E_INVAL;
+  8008d3:	83 c4 10             	add    $0x10,%esp
+  8008d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008db:	eb d8                	jmp    8008b5 <read+0x58>
+		return -E_NOT_SUPP;
+  8008dd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8008e2:	eb d1                	jmp    8008b5 <read+0x58>
+
+008008e4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8008e4:	55                   	push   %ebp
+  8008e5:	89 e5                	mov    %esp,%ebp
+  8008e7:	57                   	push   %edi
+  8008e8:	56                   	push   %esi
+  8008e9:	53                   	push   %ebx
+  8008ea:	83 ec 0c             	sub    $0xc,%esp
+  8008ed:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008f0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8008f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008f8:	eb 02                	jmp    8008fc <readn+0x18>
+  8008fa:	01 c3                	add    %eax,%ebx
+  8008fc:	39 f3                	cmp    %esi,%ebx
+  8008fe:	73 21                	jae    800921 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800900:	83 ec 04             	sub    $0x4,%esp
+  800903:	89 f0                	mov    %esi,%eax
+  800905:	29 d8                	sub    %ebx,%eax
+  800907:	50                   	push   %eax
+  800908:	89 d8                	mov    %ebx,%eax
+  80090a:	03 45 0c             	add    0xc(%ebp),%eax
+  80090d:	50                   	push   %eax
+  80090e:	57                   	push   %edi
+  80090f:	e8 49 ff ff ff       	call   80085d <read>
+		if (m < 0)
+  800914:	83 c4 10             	add    $0x10,%esp
+  800917:	85 c0                	test   %eax,%eax
+  800919:	78 04                	js     80091f <readn+0x3b>
+			return m;
+		if (m == 0)
+  80091b:	75 dd                	jne    8008fa <readn+0x16>
+  80091d:	eb 02                	jmp    800921 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80091f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800921:	89 d8                	mov    %ebx,%eax
+  800923:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800926:	5b                   	pop    %ebx
+  800927:	5e                   	pop    %esi
+  800928:	5f                   	pop    %edi
+  800929:	5d                   	pop    %ebp
+  80092a:	c3                   	ret
+
+0080092b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80092b:	55                   	push   %ebp
+  80092c:	89 e5                	mov    %esp,%ebp
+  80092e:	56                   	push   %esi
+  80092f:	53                   	push   %ebx
+  800930:	83 ec 18             	sub    $0x18,%esp
+  800933:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800936:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800939:	50                   	push   %eax
+  80093a:	53                   	push   %ebx
+  80093b:	e8 b7 fc ff ff       	call   8005f7 <fd_lookup>
+  800940:	83 c4 10             	add    $0x10,%esp
+  800943:	85 c0                	test   %eax,%eax
+  800945:	78 37                	js     80097e <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800947:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80094a:	83 ec 08             	sub    $0x8,%esp
+  80094d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800950:	50                   	push   %eax
+  800951:	ff 36                	push   (%esi)
+  800953:	e8 ef fc ff ff       	call   800647 <dev_lookup>
+  800958:	83 c4 10             	add    $0x10,%esp
+  80095b:	85 c0                	test   %eax,%eax
+  80095d:	78 1f                	js     80097e <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80095f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800963:	74 20                	je     800985 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800965:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800968:	8b 40 0c             	mov    0xc(%eax),%eax
+  80096b:	85 c0                	test   %eax,%eax
+  80096d:	74 37                	je     8009a6 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80096f:	83 ec 04             	sub    $0x4,%esp
+  800972:	ff 75 10             	push   0x10(%ebp)
+  800975:	ff 75 0c             	push   0xc(%ebp)
+  800978:	56                   	push   %esi
+  800979:	ff d0                	call   *%eax
+  80097b:	83 c4 10             	add    $0x10,%esp
+}
+  80097e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800981:	5b                   	pop    %ebx
+  800982:	5e                   	pop    %esi
+  800983:	5d                   	pop    %ebp
+  800984:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800985:	a1 00 50 80 00       	mov    0x805000,%eax
+  80098a:	8b 40 48             	mov    0x48(%eax),%eax
+  80098d:	83 ec 04             	sub    $0x4,%esp
+  800990:	53                   	push   %ebx
+  800991:	50                   	push   %eax
+  800992:	68 d5 37 80 00       	push   $0x8037d5
+  800997:	e8 74 1c 00 00       	call   802610 <cprintf>
+		return -E_INVAL;
+  80099c:	83 c4 10             	add    $0x10,%esp
+  80099f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009a4:	eb d8                	jmp    80097e <write+0x53>
+		return -E_NOT_SUPP;
+  8009a6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009ab:	eb d1                	jmp    80097e <write+0x53>
+
+008009ad <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8009ad:	55                   	push   %ebp
+  8009ae:	89 e5                	mov    %esp,%ebp
+  8009b0:	53                   	push   %ebx
+  8009b1:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009b4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009b7:	50                   	push   %eax
+  8009b8:	ff 75 08             	push   0x8(%ebp)
+  8009bb:	e8 37 fc ff ff       	call   8005f7 <fd_lookup>
+  8009c0:	83 c4 10             	add    $0x10,%esp
+  8009c3:	85 c0                	test   %eax,%eax
+  8009c5:	78 3a                	js     800a01 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009c7:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8009ca:	83 ec 08             	sub    $0x8,%esp
+  8009cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009d0:	50                   	push   %eax
+  8009d1:	ff 33                	push   (%ebx)
+  8009d3:	e8 6f fc ff ff       	call   800647 <dev_lookup>
+  8009d8:	83 c4 10             	add    $0x10,%esp
+  8009db:	85 c0                	test   %eax,%eax
+  8009dd:	78 22                	js     800a01 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8009df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009e2:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8009e5:	85 c0                	test   %eax,%eax
+  8009e7:	74 0d                	je     8009f6 <seek+0x49>
+  8009e9:	83 ec 0c             	sub    $0xc,%esp
+  8009ec:	53                   	push   %ebx
+  8009ed:	ff d0                	call   *%eax
+  8009ef:	83 c4 10             	add    $0x10,%esp
+  8009f2:	85 c0                	test   %eax,%eax
+  8009f4:	78 0b                	js     800a01 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8009f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009f9:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8009fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a04:	c9                   	leave
+  800a05:	c3                   	ret
+
+00800a06 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  800a06:	55                   	push   %ebp
+  800a07:	89 e5                	mov    %esp,%ebp
+  800a09:	53                   	push   %ebx
+  800a0a:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a0d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a10:	50                   	push   %eax
+  800a11:	ff 75 08             	push   0x8(%ebp)
+  800a14:	e8 de fb ff ff       	call   8005f7 <fd_lookup>
+  800a19:	83 c4 10             	add    $0x10,%esp
+  800a1c:	85 c0                	test   %eax,%eax
+  800a1e:	78 2b                	js     800a4b <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a20:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a23:	83 ec 08             	sub    $0x8,%esp
+  800a26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a29:	50                   	push   %eax
+  800a2a:	ff 33                	push   (%ebx)
+  800a2c:	e8 16 fc ff ff       	call   800647 <dev_lookup>
+  800a31:	83 c4 10             	add    $0x10,%esp
+  800a34:	85 c0                	test   %eax,%eax
+  800a36:	78 13                	js     800a4b <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  800a38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a3b:	8b 40 1c             	mov    0x1c(%eax),%eax
+  800a3e:	85 c0                	test   %eax,%eax
+  800a40:	74 0e                	je     800a50 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  800a42:	83 ec 0c             	sub    $0xc,%esp
+  800a45:	53                   	push   %ebx
+  800a46:	ff d0                	call   *%eax
+  800a48:	83 c4 10             	add    $0x10,%esp
+}
+  800a4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a4e:	c9                   	leave
+  800a4f:	c3                   	ret
+		return 0;
+  800a50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a55:	eb f4                	jmp    800a4b <fsync+0x45>
+
+00800a57 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a57:	55                   	push   %ebp
+  800a58:	89 e5                	mov    %esp,%ebp
+  800a5a:	56                   	push   %esi
+  800a5b:	53                   	push   %ebx
+  800a5c:	83 ec 18             	sub    $0x18,%esp
+  800a5f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a62:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a65:	50                   	push   %eax
+  800a66:	53                   	push   %ebx
+  800a67:	e8 8b fb ff ff       	call   8005f7 <fd_lookup>
+  800a6c:	83 c4 10             	add    $0x10,%esp
+  800a6f:	85 c0                	test   %eax,%eax
+  800a71:	78 34                	js     800aa7 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a73:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a76:	83 ec 08             	sub    $0x8,%esp
+  800a79:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a7c:	50                   	push   %eax
+  800a7d:	ff 36                	push   (%esi)
+  800a7f:	e8 c3 fb ff ff       	call   800647 <dev_lookup>
+  800a84:	83 c4 10             	add    $0x10,%esp
+  800a87:	85 c0                	test   %eax,%eax
+  800a89:	78 1c                	js     800aa7 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a8b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a8f:	74 1d                	je     800aae <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800a91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a94:	8b 40 18             	mov    0x18(%eax),%eax
+  800a97:	85 c0                	test   %eax,%eax
+  800a99:	74 34                	je     800acf <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800a9b:	83 ec 08             	sub    $0x8,%esp
+  800a9e:	ff 75 0c             	push   0xc(%ebp)
+  800aa1:	56                   	push   %esi
+  800aa2:	ff d0                	call   *%eax
+  800aa4:	83 c4 10             	add    $0x10,%esp
+}
+  800aa7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aaa:	5b                   	pop    %ebx
+  800aab:	5e                   	pop    %esi
+  800aac:	5d                   	pop    %ebp
+  800aad:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800aae:	a1 00 50 80 00       	mov    0x805000,%eax
+  800ab3:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ab6:	83 ec 04             	sub    $0x4,%esp
+  800ab9:	53                   	push   %ebx
+  800aba:	50                   	push   %eax
+  800abb:	68 98 37 80 00       	push   $0x803798
+  800ac0:	e8 4b 1b 00 00       	call   802610 <cprintf>
+		return -E_INVAL;
+  800ac5:	83 c4 10             	add    $0x10,%esp
+  800ac8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800acd:	eb d8                	jmp    800aa7 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800acf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ad4:	eb d1                	jmp    800aa7 <ftruncate+0x50>
+
+00800ad6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800ad6:	55                   	push   %ebp
+  800ad7:	89 e5                	mov    %esp,%ebp
+  800ad9:	56                   	push   %esi
+  800ada:	53                   	push   %ebx
+  800adb:	83 ec 18             	sub    $0x18,%esp
+  800ade:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ae1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ae4:	50                   	push   %eax
+  800ae5:	ff 75 08             	push   0x8(%ebp)
+  800ae8:	e8 0a fb ff ff       	call   8005f7 <fd_lookup>
+  800aed:	83 c4 10             	add    $0x10,%esp
+  800af0:	85 c0                	test   %eax,%eax
+  800af2:	78 49                	js     800b3d <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800af4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800af7:	83 ec 08             	sub    $0x8,%esp
+  800afa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800afd:	50                   	push   %eax
+  800afe:	ff 36                	push   (%esi)
+  800b00:	e8 42 fb ff ff       	call   800647 <dev_lookup>
+  800b05:	83 c4 10             	add    $0x10,%esp
+  800b08:	85 c0                	test   %eax,%eax
+  800b0a:	78 31                	js     800b3d <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b0f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b13:	74 2f                	je     800b44 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b15:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b18:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b1f:	00 00 00 
+	stat->st_isdir = 0;
+  800b22:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b29:	00 00 00 
+	stat->st_dev = dev;
+  800b2c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b32:	83 ec 08             	sub    $0x8,%esp
+  800b35:	53                   	push   %ebx
+  800b36:	56                   	push   %esi
+  800b37:	ff 50 14             	call   *0x14(%eax)
+  800b3a:	83 c4 10             	add    $0x10,%esp
+}
+  800b3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b40:	5b                   	pop    %ebx
+  800b41:	5e                   	pop    %esi
+  800b42:	5d                   	pop    %ebp
+  800b43:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b44:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b49:	eb f2                	jmp    800b3d <fstat+0x67>
+
+00800b4b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	56                   	push   %esi
+  800b4f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  800b50:	83 ec 08             	sub    $0x8,%esp
+  800b53:	68 00 10 00 00       	push   $0x1000
+  800b58:	ff 75 08             	push   0x8(%ebp)
+  800b5b:	e8 b3 07 00 00       	call   801313 <open>
+  800b60:	89 c3                	mov    %eax,%ebx
+  800b62:	83 c4 10             	add    $0x10,%esp
+  800b65:	85 c0                	test   %eax,%eax
+  800b67:	78 1b                	js     800b84 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  800b69:	83 ec 08             	sub    $0x8,%esp
+  800b6c:	ff 75 0c             	push   0xc(%ebp)
+  800b6f:	50                   	push   %eax
+  800b70:	e8 61 ff ff ff       	call   800ad6 <fstat>
+  800b75:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800b77:	89 1c 24             	mov    %ebx,(%esp)
+  800b7a:	e8 a2 fb ff ff       	call   800721 <close>
+	return r;
+  800b7f:	83 c4 10             	add    $0x10,%esp
+  800b82:	89 f3                	mov    %esi,%ebx
+}
+  800b84:	89 d8                	mov    %ebx,%eax
+  800b86:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b89:	5b                   	pop    %ebx
+  800b8a:	5e                   	pop    %esi
+  800b8b:	5d                   	pop    %ebp
+  800b8c:	c3                   	ret
+
+00800b8d <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  800b8d:	55                   	push   %ebp
+  800b8e:	89 e5                	mov    %esp,%ebp
+  800b90:	57                   	push   %edi
+  800b91:	56                   	push   %esi
+  800b92:	53                   	push   %ebx
+  800b93:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  800b99:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  800b9f:	89 d6                	mov    %edx,%esi
+  800ba1:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  800ba7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  800baa:	89 d3                	mov    %edx,%ebx
+  800bac:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  800bb2:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800bb9:	74 1d                	je     800bd8 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  800bbb:	b8 00 60 80 00       	mov    $0x806000,%eax
+  800bc0:	83 c8 07             	or     $0x7,%eax
+  800bc3:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  800bc9:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800bce:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  800bd4:	01 ce                	add    %ecx,%esi
+  800bd6:	eb 28                	jmp    800c00 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800bd8:	83 ec 0c             	sub    $0xc,%esp
+  800bdb:	6a 01                	push   $0x1
+  800bdd:	e8 05 28 00 00       	call   8033e7 <ipc_find_env>
+  800be2:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800be7:	83 c4 10             	add    $0x10,%esp
+  800bea:	eb cf                	jmp    800bbb <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  800bec:	83 c0 01             	add    $0x1,%eax
+  800bef:	89 fa                	mov    %edi,%edx
+  800bf1:	09 da                	or     %ebx,%edx
+  800bf3:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800bfa:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800c00:	39 f3                	cmp    %esi,%ebx
+  800c02:	72 e8                	jb     800bec <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  800c04:	83 f8 41             	cmp    $0x41,%eax
+  800c07:	77 2f                	ja     800c38 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  800c09:	50                   	push   %eax
+  800c0a:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  800c10:	50                   	push   %eax
+  800c11:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  800c17:	ff 35 c8 70 80 00    	push   0x8070c8
+  800c1d:	e8 77 27 00 00       	call   803399 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  800c22:	83 c4 0c             	add    $0xc,%esp
+  800c25:	6a 00                	push   $0x0
+  800c27:	6a 00                	push   $0x0
+  800c29:	6a 00                	push   $0x0
+  800c2b:	e8 13 26 00 00       	call   803243 <ipc_recv>
+}
+  800c30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c33:	5b                   	pop    %ebx
+  800c34:	5e                   	pop    %esi
+  800c35:	5f                   	pop    %edi
+  800c36:	5d                   	pop    %ebp
+  800c37:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  800c38:	68 08 38 80 00       	push   $0x803808
+  800c3d:	68 24 38 80 00       	push   $0x803824
+  800c42:	6a 40                	push   $0x40
+  800c44:	68 39 38 80 00       	push   $0x803839
+  800c49:	e8 e7 18 00 00       	call   802535 <_panic>
+
+00800c4e <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  800c4e:	55                   	push   %ebp
+  800c4f:	89 e5                	mov    %esp,%ebp
+  800c51:	57                   	push   %edi
+  800c52:	56                   	push   %esi
+  800c53:	53                   	push   %ebx
+  800c54:	83 ec 1c             	sub    $0x1c,%esp
+  800c57:	89 c3                	mov    %eax,%ebx
+  800c59:	89 d6                	mov    %edx,%esi
+  800c5b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  800c5e:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  800c64:	89 ca                	mov    %ecx,%edx
+  800c66:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  800c69:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  800c70:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  800c73:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  800c7a:	8b 76 0c             	mov    0xc(%esi),%esi
+  800c7d:	89 fb                	mov    %edi,%ebx
+  800c7f:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  800c86:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c89:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  800c90:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c93:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  800c9a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c9d:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  800ca4:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  800ca7:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  800cae:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  800cb3:	39 c8                	cmp    %ecx,%eax
+  800cb5:	74 0d                	je     800cc4 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  800cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbf:	5b                   	pop    %ebx
+  800cc0:	5e                   	pop    %esi
+  800cc1:	5f                   	pop    %edi
+  800cc2:	5d                   	pop    %ebp
+  800cc3:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cc4:	6a 07                	push   $0x7
+  800cc6:	68 00 60 80 00       	push   $0x806000
+  800ccb:	6a 0d                	push   $0xd
+  800ccd:	ff 35 c8 70 80 00    	push   0x8070c8
+  800cd3:	e8 d6 25 00 00       	call   8032ae <ipc_send>
+  800cd8:	83 c4 10             	add    $0x10,%esp
+  800cdb:	eb da                	jmp    800cb7 <fsring_post+0x69>
+
+00800cdd <fsipcv>:
+{
+  800cdd:	55                   	push   %ebp
+  800cde:	89 e5                	mov    %esp,%ebp
+  800ce0:	57                   	push   %edi
+  800ce1:	56                   	push   %esi
+  800ce2:	53                   	push   %ebx
+  800ce3:	83 ec 0c             	sub    $0xc,%esp
+  800ce6:	89 c7                	mov    %eax,%edi
+  800ce8:	89 d3                	mov    %edx,%ebx
+  800cea:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  800cec:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800cf3:	74 26                	je     800d1b <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cf5:	6a 07                	push   $0x7
+  800cf7:	68 00 60 80 00       	push   $0x806000
+  800cfc:	57                   	push   %edi
+  800cfd:	ff 35 c8 70 80 00    	push   0x8070c8
+  800d03:	e8 a6 25 00 00       	call   8032ae <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  800d08:	6a 00                	push   $0x0
+  800d0a:	56                   	push   %esi
+  800d0b:	53                   	push   %ebx
+  800d0c:	6a 00                	push   $0x0
+  800d0e:	e8 f3 25 00 00       	call   803306 <ipc_recvv>
+}
+  800d13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d16:	5b                   	pop    %ebx
+  800d17:	5e                   	pop    %esi
+  800d18:	5f                   	pop    %edi
+  800d19:	5d                   	pop    %ebp
+  800d1a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d1b:	83 ec 0c             	sub    $0xc,%esp
+  800d1e:	6a 01                	push   $0x1
+  800d20:	e8 c2 26 00 00       	call   8033e7 <ipc_find_env>
+  800d25:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800d2a:	83 c4 10             	add    $0x10,%esp
+  800d2d:	eb c6                	jmp    800cf5 <fsipcv+0x18>
+
+00800d2f <fsipc>:
+{
+  800d2f:	55                   	push   %ebp
+  800d30:	89 e5                	mov    %esp,%ebp
+  800d32:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  800d35:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  800d3c:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800d3f:	e8 99 ff ff ff       	call   800cdd <fsipcv>
+}
+  800d44:	c9                   	leave
+  800d45:	c3                   	ret
+
+00800d46 <file_write_direct>:
+{
+  800d46:	55                   	push   %ebp
+  800d47:	89 e5                	mov    %esp,%ebp
+  800d49:	56                   	push   %esi
+  800d4a:	53                   	push   %ebx
+  800d4b:	89 c3                	mov    %eax,%ebx
+  800d4d:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800d4f:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  800d55:	77 40                	ja     800d97 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800d57:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  800d5c:	39 c8                	cmp    %ecx,%eax
+  800d5e:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d61:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  800d64:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  800d6a:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800d6f:	83 ec 04             	sub    $0x4,%esp
+  800d72:	50                   	push   %eax
+  800d73:	52                   	push   %edx
+  800d74:	68 08 60 80 00       	push   $0x806008
+  800d79:	e8 06 20 00 00       	call   802d84 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800d7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d83:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d88:	e8 a2 ff ff ff       	call   800d2f <fsipc>
+  800d8d:	83 c4 10             	add    $0x10,%esp
+}
+  800d90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d93:	5b                   	pop    %ebx
+  800d94:	5e                   	pop    %esi
+  800d95:	5d                   	pop    %ebp
+  800d96:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  800d97:	89 d6                	mov    %edx,%esi
+  800d99:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  800d9f:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  800da4:	29 f1                	sub    %esi,%ecx
+  800da6:	39 c1                	cmp    %eax,%ecx
+  800da8:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  800dab:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800dae:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  800db3:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  800db9:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  800dbf:	83 ec 0c             	sub    $0xc,%esp
+  800dc2:	6a 05                	push   $0x5
+  800dc4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dc9:	e8 bf fd ff ff       	call   800b8d <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  800dce:	83 c4 10             	add    $0x10,%esp
+  800dd1:	eb bd                	jmp    800d90 <file_write_direct+0x4a>
+
+00800dd3 <devfile_sync>:
+{
+  800dd3:	55                   	push   %ebp
+  800dd4:	89 e5                	mov    %esp,%ebp
+  800dd6:	57                   	push   %edi
+  800dd7:	56                   	push   %esi
+  800dd8:	53                   	push   %ebx
+  800dd9:	83 ec 28             	sub    $0x28,%esp
+  800ddc:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  800ddf:	56                   	push   %esi
+  800de0:	e8 a5 f7 ff ff       	call   80058a <fd2data>
+  800de5:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  800de7:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  800dea:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  800df1:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800df4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  800df9:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  800dfd:	74 45                	je     800e44 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  800dff:	8b 46 14             	mov    0x14(%esi),%eax
+  800e02:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e05:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e12:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  800e15:	39 cb                	cmp    %ecx,%ebx
+  800e17:	73 14                	jae    800e2d <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  800e19:	29 d9                	sub    %ebx,%ecx
+  800e1b:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800e1e:	89 f0                	mov    %esi,%eax
+  800e20:	e8 21 ff ff ff       	call   800d46 <file_write_direct>
+  800e25:	85 c0                	test   %eax,%eax
+  800e27:	7e 04                	jle    800e2d <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e29:	01 c3                	add    %eax,%ebx
+  800e2b:	eb e5                	jmp    800e12 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  800e2d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e30:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  800e37:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  800e3a:	85 c0                	test   %eax,%eax
+  800e3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e41:	0f 4f c2             	cmovg  %edx,%eax
+}
+  800e44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e47:	5b                   	pop    %ebx
+  800e48:	5e                   	pop    %esi
+  800e49:	5f                   	pop    %edi
+  800e4a:	5d                   	pop    %ebp
+  800e4b:	c3                   	ret
+
+00800e4c <devfile_write>:
+{
+  800e4c:	55                   	push   %ebp
+  800e4d:	89 e5                	mov    %esp,%ebp
+  800e4f:	57                   	push   %edi
+  800e50:	56                   	push   %esi
+  800e51:	53                   	push   %ebx
+  800e52:	83 ec 28             	sub    $0x28,%esp
+  800e55:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e58:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  800e5b:	53                   	push   %ebx
+  800e5c:	e8 29 f7 ff ff       	call   80058a <fd2data>
+  800e61:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  800e64:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  800e67:	83 c4 10             	add    $0x10,%esp
+  800e6a:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  800e6e:	74 43                	je     800eb3 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  800e70:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  800e77:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800e7a:	85 c0                	test   %eax,%eax
+  800e7c:	74 43                	je     800ec1 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  800e7e:	89 c2                	mov    %eax,%edx
+  800e80:	03 53 14             	add    0x14(%ebx),%edx
+  800e83:	39 fa                	cmp    %edi,%edx
+  800e85:	75 0b                	jne    800e92 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  800e87:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  800e8a:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  800e90:	76 66                	jbe    800ef8 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  800e92:	83 ec 0c             	sub    $0xc,%esp
+  800e95:	53                   	push   %ebx
+  800e96:	e8 38 ff ff ff       	call   800dd3 <devfile_sync>
+  800e9b:	83 c4 10             	add    $0x10,%esp
+  800e9e:	85 c0                	test   %eax,%eax
+  800ea0:	78 4e                	js     800ef0 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800ea2:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800ea8:	77 56                	ja     800f00 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  800eaa:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800ead:	85 c0                	test   %eax,%eax
+  800eaf:	75 20                	jne    800ed1 <devfile_write+0x85>
+  800eb1:	eb 16                	jmp    800ec9 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  800eb3:	89 f1                	mov    %esi,%ecx
+  800eb5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800eb8:	89 d8                	mov    %ebx,%eax
+  800eba:	e8 87 fe ff ff       	call   800d46 <file_write_direct>
+  800ebf:	eb 2f                	jmp    800ef0 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800ec1:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800ec7:	77 37                	ja     800f00 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  800ec9:	89 7b 14             	mov    %edi,0x14(%ebx)
+  800ecc:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  800ed1:	83 ec 04             	sub    $0x4,%esp
+  800ed4:	56                   	push   %esi
+  800ed5:	ff 75 0c             	push   0xc(%ebp)
+  800ed8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800edb:	01 c1                	add    %eax,%ecx
+  800edd:	51                   	push   %ecx
+  800ede:	e8 a1 1e 00 00       	call   802d84 <memmove>
+	ff->buf_wlen += n;
+  800ee3:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  800ee6:	01 f7                	add    %esi,%edi
+  800ee8:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  800eeb:	89 f0                	mov    %esi,%eax
+  800eed:	83 c4 10             	add    $0x10,%esp
+}
+  800ef0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef3:	5b                   	pop    %ebx
+  800ef4:	5e                   	pop    %esi
+  800ef5:	5f                   	pop    %edi
+  800ef6:	5d                   	pop    %ebp
+  800ef7:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  800ef8:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800efe:	76 d1                	jbe    800ed1 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  800f00:	89 f1                	mov    %esi,%ecx
+  800f02:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f05:	89 d8                	mov    %ebx,%eax
+  800f07:	e8 3a fe ff ff       	call   800d46 <file_write_direct>
+  800f0c:	eb e2                	jmp    800ef0 <devfile_write+0xa4>
+
+00800f0e <devfile_trunc>:
+{
+  800f0e:	55                   	push   %ebp
+  800f0f:	89 e5                	mov    %esp,%ebp
+  800f11:	53                   	push   %ebx
+  800f12:	83 ec 10             	sub    $0x10,%esp
+  800f15:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  800f18:	53                   	push   %ebx
+  800f19:	e8 b5 fe ff ff       	call   800dd3 <devfile_sync>
+  800f1e:	83 c4 10             	add    $0x10,%esp
+  800f21:	85 c0                	test   %eax,%eax
+  800f23:	78 1f                	js     800f44 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800f25:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f28:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800f2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f30:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800f35:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f3a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f3f:	e8 eb fd ff ff       	call   800d2f <fsipc>
+}
+  800f44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f47:	c9                   	leave
+  800f48:	c3                   	ret
+
+00800f49 <devfile_stat>:
+{
+  800f49:	55                   	push   %ebp
+  800f4a:	89 e5                	mov    %esp,%ebp
+  800f4c:	56                   	push   %esi
+  800f4d:	53                   	push   %ebx
+  800f4e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800f51:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  800f54:	83 ec 0c             	sub    $0xc,%esp
+  800f57:	53                   	push   %ebx
+  800f58:	e8 76 fe ff ff       	call   800dd3 <devfile_sync>
+  800f5d:	83 c4 10             	add    $0x10,%esp
+  800f60:	85 c0                	test   %eax,%eax
+  800f62:	78 47                	js     800fab <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800f64:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f67:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800f6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f71:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f76:	e8 b4 fd ff ff       	call   800d2f <fsipc>
+  800f7b:	85 c0                	test   %eax,%eax
+  800f7d:	78 2c                	js     800fab <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f7f:	83 ec 08             	sub    $0x8,%esp
+  800f82:	68 00 60 80 00       	push   $0x806000
+  800f87:	56                   	push   %esi
+  800f88:	e8 71 1c 00 00       	call   802bfe <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800f8d:	a1 80 60 80 00       	mov    0x806080,%eax
+  800f92:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800f98:	a1 84 60 80 00       	mov    0x806084,%eax
+  800f9d:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  800fa3:	83 c4 10             	add    $0x10,%esp
+  800fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fae:	5b                   	pop    %ebx
+  800faf:	5e                   	pop    %esi
+  800fb0:	5d                   	pop    %ebp
+  800fb1:	c3                   	ret
+
+00800fb2 <devfile_flush>:
+{
+  800fb2:	55                   	push   %ebp
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	56                   	push   %esi
+  800fb6:	53                   	push   %ebx
+  800fb7:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  800fba:	83 ec 0c             	sub    $0xc,%esp
+  800fbd:	56                   	push   %esi
+  800fbe:	e8 10 fe ff ff       	call   800dd3 <devfile_sync>
+  800fc3:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  800fc5:	83 c4 10             	add    $0x10,%esp
+  800fc8:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  800fcc:	75 25                	jne    800ff3 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800fce:	8b 46 0c             	mov    0xc(%esi),%eax
+  800fd1:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  800fd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fdb:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fe0:	e8 4a fd ff ff       	call   800d2f <fsipc>
+  800fe5:	85 c0                	test   %eax,%eax
+  800fe7:	0f 45 d8             	cmovne %eax,%ebx
+}
+  800fea:	89 d8                	mov    %ebx,%eax
+  800fec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fef:	5b                   	pop    %ebx
+  800ff0:	5e                   	pop    %esi
+  800ff1:	5d                   	pop    %ebp
+  800ff2:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  800ff3:	83 ec 0c             	sub    $0xc,%esp
+  800ff6:	56                   	push   %esi
+  800ff7:	e8 8e f5 ff ff       	call   80058a <fd2data>
+  800ffc:	83 c4 08             	add    $0x8,%esp
+  800fff:	50                   	push   %eax
+  801000:	6a 00                	push   $0x0
+  801002:	e8 ff f1 ff ff       	call   800206 <sys_page_unmap>
+  801007:	83 c4 10             	add    $0x10,%esp
+  80100a:	eb c2                	jmp    800fce <devfile_flush+0x1c>
+
+0080100c <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  80100c:	55                   	push   %ebp
+  80100d:	89 e5                	mov    %esp,%ebp
+  80100f:	57                   	push   %edi
+  801010:	56                   	push   %esi
+  801011:	53                   	push   %ebx
+  801012:	83 ec 64             	sub    $0x64,%esp
+  801015:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801017:	52                   	push   %edx
+  801018:	50                   	push   %eax
+  801019:	e8 d9 f5 ff ff       	call   8005f7 <fd_lookup>
+  80101e:	89 c1                	mov    %eax,%ecx
+  801020:	83 c4 10             	add    $0x10,%esp
+  801023:	85 c0                	test   %eax,%eax
+  801025:	0f 88 f2 00 00 00    	js     80111d <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  80102b:	8b 07                	mov    (%edi),%eax
+  80102d:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801033:	39 10                	cmp    %edx,(%eax)
+  801035:	0f 85 03 01 00 00    	jne    80113e <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  80103b:	a1 00 50 80 00       	mov    0x805000,%eax
+  801040:	8b 40 48             	mov    0x48(%eax),%eax
+  801043:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801049:	0f 84 96 00 00 00    	je     8010e5 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  80104f:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801056:	0f 84 cb 00 00 00    	je     801127 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80105c:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801061:	83 c8 07             	or     $0x7,%eax
+  801064:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801067:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80106a:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  80106f:	83 ec 04             	sub    $0x4,%esp
+  801072:	68 07 04 00 00       	push   $0x407
+  801077:	53                   	push   %ebx
+  801078:	6a 00                	push   $0x0
+  80107a:	e8 fa f0 ff ff       	call   800179 <sys_page_alloc>
+  80107f:	89 c1                	mov    %eax,%ecx
+  801081:	83 c4 10             	add    $0x10,%esp
+  801084:	85 c0                	test   %eax,%eax
+  801086:	0f 88 91 00 00 00    	js     80111d <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  80108c:	89 d8                	mov    %ebx,%eax
+  80108e:	83 c8 07             	or     $0x7,%eax
+  801091:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801093:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801099:	83 c6 04             	add    $0x4,%esi
+  80109c:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8010a2:	75 cb                	jne    80106f <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8010a4:	6a 12                	push   $0x12
+  8010a6:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8010a9:	50                   	push   %eax
+  8010aa:	6a 0c                	push   $0xc
+  8010ac:	ff 35 c8 70 80 00    	push   0x8070c8
+  8010b2:	e8 e2 22 00 00       	call   803399 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8010b7:	83 c4 0c             	add    $0xc,%esp
+  8010ba:	6a 00                	push   $0x0
+  8010bc:	6a 00                	push   $0x0
+  8010be:	6a 00                	push   $0x0
+  8010c0:	e8 7e 21 00 00       	call   803243 <ipc_recv>
+  8010c5:	89 c1                	mov    %eax,%ecx
+  8010c7:	83 c4 10             	add    $0x10,%esp
+  8010ca:	85 c0                	test   %eax,%eax
+  8010cc:	78 4f                	js     80111d <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  8010ce:	a1 00 50 80 00       	mov    0x805000,%eax
+  8010d3:	8b 40 48             	mov    0x48(%eax),%eax
+  8010d6:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  8010db:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  8010e2:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  8010e5:	83 ec 0c             	sub    $0xc,%esp
+  8010e8:	ff 37                	push   (%edi)
+  8010ea:	e8 e4 fc ff ff       	call   800dd3 <devfile_sync>
+  8010ef:	89 c1                	mov    %eax,%ecx
+  8010f1:	83 c4 10             	add    $0x10,%esp
+  8010f4:	85 c0                	test   %eax,%eax
+  8010f6:	78 25                	js     80111d <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  8010f8:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  8010fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801103:	ba 01 00 00 00       	mov    $0x1,%edx
+  801108:	89 d0                	mov    %edx,%eax
+  80110a:	d3 e0                	shl    %cl,%eax
+  80110c:	85 d8                	test   %ebx,%eax
+  80110e:	74 0d                	je     80111d <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801110:	83 c1 01             	add    $0x1,%ecx
+  801113:	83 f9 10             	cmp    $0x10,%ecx
+  801116:	75 f0                	jne    801108 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801118:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  80111d:	89 c8                	mov    %ecx,%eax
+  80111f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801122:	5b                   	pop    %ebx
+  801123:	5e                   	pop    %esi
+  801124:	5f                   	pop    %edi
+  801125:	5d                   	pop    %ebp
+  801126:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801127:	83 ec 0c             	sub    $0xc,%esp
+  80112a:	6a 01                	push   $0x1
+  80112c:	e8 b6 22 00 00       	call   8033e7 <ipc_find_env>
+  801131:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801136:	83 c4 10             	add    $0x10,%esp
+  801139:	e9 1e ff ff ff       	jmp    80105c <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  80113e:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801143:	eb d8                	jmp    80111d <fsring_slot+0x111>
+
+00801145 <file_read_direct>:
+{
+  801145:	55                   	push   %ebp
+  801146:	89 e5                	mov    %esp,%ebp
+  801148:	57                   	push   %edi
+  801149:	56                   	push   %esi
+  80114a:	53                   	push   %ebx
+  80114b:	83 ec 1c             	sub    $0x1c,%esp
+  80114e:	89 c7                	mov    %eax,%edi
+  801150:	89 d6                	mov    %edx,%esi
+  801152:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801154:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  80115a:	77 52                	ja     8011ae <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80115c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80115f:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801164:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80116a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801174:	e8 b6 fb ff ff       	call   800d2f <fsipc>
+  801179:	89 c7                	mov    %eax,%edi
+  80117b:	85 c0                	test   %eax,%eax
+  80117d:	78 25                	js     8011a4 <file_read_direct+0x5f>
+	assert(r <= n);
+  80117f:	39 c3                	cmp    %eax,%ebx
+  801181:	0f 82 87 00 00 00    	jb     80120e <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801187:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80118c:	0f 8f 95 00 00 00    	jg     801227 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801192:	83 ec 04             	sub    $0x4,%esp
+  801195:	50                   	push   %eax
+  801196:	68 00 60 80 00       	push   $0x806000
+  80119b:	56                   	push   %esi
+  80119c:	e8 e3 1b 00 00       	call   802d84 <memmove>
+	return r;
+  8011a1:	83 c4 10             	add    $0x10,%esp
+}
+  8011a4:	89 f8                	mov    %edi,%eax
+  8011a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a9:	5b                   	pop    %ebx
+  8011aa:	5e                   	pop    %esi
+  8011ab:	5f                   	pop    %edi
+  8011ac:	5d                   	pop    %ebp
+  8011ad:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8011ae:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8011b4:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8011b9:	29 d1                	sub    %edx,%ecx
+  8011bb:	39 d9                	cmp    %ebx,%ecx
+  8011bd:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011c0:	89 f0                	mov    %esi,%eax
+  8011c2:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8011c5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8011c8:	eb 0f                	jmp    8011d9 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8011ca:	0f b6 10             	movzbl (%eax),%edx
+  8011cd:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011cf:	05 00 10 00 00       	add    $0x1000,%eax
+  8011d4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011d9:	39 c8                	cmp    %ecx,%eax
+  8011db:	72 ed                	jb     8011ca <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  8011dd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8011e0:	8b 47 0c             	mov    0xc(%edi),%eax
+  8011e3:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  8011e8:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8011ee:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  8011f4:	83 ec 0c             	sub    $0xc,%esp
+  8011f7:	6a 07                	push   $0x7
+  8011f9:	89 d9                	mov    %ebx,%ecx
+  8011fb:	89 f2                	mov    %esi,%edx
+  8011fd:	b8 09 00 00 00       	mov    $0x9,%eax
+  801202:	e8 86 f9 ff ff       	call   800b8d <fsipc_pages>
+  801207:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801209:	83 c4 10             	add    $0x10,%esp
+  80120c:	eb 96                	jmp    8011a4 <file_read_direct+0x5f>
+	assert(r <= n);
+  80120e:	68 44 38 80 00       	push   $0x803844
+  801213:	68 24 38 80 00       	push   $0x803824
+  801218:	68 dc 00 00 00       	push   $0xdc
+  80121d:	68 39 38 80 00       	push   $0x803839
+  801222:	e8 0e 13 00 00       	call   802535 <_panic>
+	assert(r <= PGSIZE);
+  801227:	68 55 38 80 00       	push   $0x803855
+  80122c:	68 24 38 80 00       	push   $0x803824
+  801231:	68 dd 00 00 00       	push   $0xdd
+  801236:	68 39 38 80 00       	push   $0x803839
+  80123b:	e8 f5 12 00 00       	call   802535 <_panic>
+
+00801240 <devfile_read>:
+{
+  801240:	55                   	push   %ebp
+  801241:	89 e5                	mov    %esp,%ebp
+  801243:	57                   	push   %edi
+  801244:	56                   	push   %esi
+  801245:	53                   	push   %ebx
+  801246:	83 ec 28             	sub    $0x28,%esp
+  801249:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80124c:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80124f:	53                   	push   %ebx
+  801250:	e8 35 f3 ff ff       	call   80058a <fd2data>
+  801255:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801258:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80125b:	83 c4 10             	add    $0x10,%esp
+  80125e:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801262:	74 7d                	je     8012e1 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801264:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801268:	0f 85 81 00 00 00    	jne    8012ef <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  80126e:	8b 43 18             	mov    0x18(%ebx),%eax
+  801271:	85 c0                	test   %eax,%eax
+  801273:	74 0d                	je     801282 <devfile_read+0x42>
+  801275:	8b 53 14             	mov    0x14(%ebx),%edx
+  801278:	39 fa                	cmp    %edi,%edx
+  80127a:	7f 06                	jg     801282 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  80127c:	01 c2                	add    %eax,%edx
+  80127e:	39 d7                	cmp    %edx,%edi
+  801280:	72 28                	jb     8012aa <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801282:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801289:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80128f:	77 74                	ja     801305 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801291:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801296:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801299:	89 d8                	mov    %ebx,%eax
+  80129b:	e8 a5 fe ff ff       	call   801145 <file_read_direct>
+  8012a0:	85 c0                	test   %eax,%eax
+  8012a2:	7e 35                	jle    8012d9 <devfile_read+0x99>
+		ff->buf_base = pos;
+  8012a4:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8012a7:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8012aa:	8b 53 14             	mov    0x14(%ebx),%edx
+  8012ad:	89 d0                	mov    %edx,%eax
+  8012af:	03 43 18             	add    0x18(%ebx),%eax
+  8012b2:	29 f8                	sub    %edi,%eax
+  8012b4:	39 f0                	cmp    %esi,%eax
+  8012b6:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8012b9:	83 ec 04             	sub    $0x4,%esp
+  8012bc:	56                   	push   %esi
+  8012bd:	89 f8                	mov    %edi,%eax
+  8012bf:	29 d0                	sub    %edx,%eax
+  8012c1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8012c4:	01 c1                	add    %eax,%ecx
+  8012c6:	51                   	push   %ecx
+  8012c7:	ff 75 0c             	push   0xc(%ebp)
+  8012ca:	e8 b5 1a 00 00       	call   802d84 <memmove>
+	fd->fd_offset = pos + n;
+  8012cf:	01 f7                	add    %esi,%edi
+  8012d1:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8012d4:	89 f0                	mov    %esi,%eax
+  8012d6:	83 c4 10             	add    $0x10,%esp
+}
+  8012d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012dc:	5b                   	pop    %ebx
+  8012dd:	5e                   	pop    %esi
+  8012de:	5f                   	pop    %edi
+  8012df:	5d                   	pop    %ebp
+  8012e0:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  8012e1:	89 f1                	mov    %esi,%ecx
+  8012e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012e6:	89 d8                	mov    %ebx,%eax
+  8012e8:	e8 58 fe ff ff       	call   801145 <file_read_direct>
+  8012ed:	eb ea                	jmp    8012d9 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8012ef:	83 ec 0c             	sub    $0xc,%esp
+  8012f2:	53                   	push   %ebx
+  8012f3:	e8 db fa ff ff       	call   800dd3 <devfile_sync>
+  8012f8:	83 c4 10             	add    $0x10,%esp
+  8012fb:	85 c0                	test   %eax,%eax
+  8012fd:	0f 89 6b ff ff ff    	jns    80126e <devfile_read+0x2e>
+  801303:	eb d4                	jmp    8012d9 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801305:	89 f1                	mov    %esi,%ecx
+  801307:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80130a:	89 d8                	mov    %ebx,%eax
+  80130c:	e8 34 fe ff ff       	call   801145 <file_read_direct>
+  801311:	eb c6                	jmp    8012d9 <devfile_read+0x99>
+
+00801313 <open>:
+{
+  801313:	55                   	push   %ebp
+  801314:	89 e5                	mov    %esp,%ebp
+  801316:	56                   	push   %esi
+  801317:	53                   	push   %ebx
+  801318:	83 ec 1c             	sub    $0x1c,%esp
+  80131b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80131e:	56                   	push   %esi
+  80131f:	e8 9f 18 00 00       	call   802bc3 <strlen>
+  801324:	83 c4 10             	add    $0x10,%esp
+  801327:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80132c:	0f 8f a0 00 00 00    	jg     8013d2 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801332:	83 ec 0c             	sub    $0xc,%esp
+  801335:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801338:	50                   	push   %eax
+  801339:	e8 63 f2 ff ff       	call   8005a1 <fd_alloc>
+  80133e:	89 c3                	mov    %eax,%ebx
+  801340:	83 c4 10             	add    $0x10,%esp
+  801343:	85 c0                	test   %eax,%eax
+  801345:	78 45                	js     80138c <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801347:	83 ec 08             	sub    $0x8,%esp
+  80134a:	56                   	push   %esi
+  80134b:	68 00 60 80 00       	push   $0x806000
+  801350:	e8 a9 18 00 00       	call   802bfe <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801355:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801358:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80135d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801360:	b8 01 00 00 00       	mov    $0x1,%eax
+  801365:	e8 c5 f9 ff ff       	call   800d2f <fsipc>
+  80136a:	89 c3                	mov    %eax,%ebx
+  80136c:	83 c4 10             	add    $0x10,%esp
+  80136f:	85 c0                	test   %eax,%eax
+  801371:	78 22                	js     801395 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801373:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  80137a:	74 2b                	je     8013a7 <open+0x94>
+	return fd2num(fd);
+  80137c:	83 ec 0c             	sub    $0xc,%esp
+  80137f:	ff 75 f4             	push   -0xc(%ebp)
+  801382:	e8 f3 f1 ff ff       	call   80057a <fd2num>
+  801387:	89 c3                	mov    %eax,%ebx
+  801389:	83 c4 10             	add    $0x10,%esp
+}
+  80138c:	89 d8                	mov    %ebx,%eax
+  80138e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801391:	5b                   	pop    %ebx
+  801392:	5e                   	pop    %esi
+  801393:	5d                   	pop    %ebp
+  801394:	c3                   	ret
+		fd_close(fd, 0);
+  801395:	83 ec 08             	sub    $0x8,%esp
+  801398:	6a 00                	push   $0x0
+  80139a:	ff 75 f4             	push   -0xc(%ebp)
+  80139d:	e8 f8 f2 ff ff       	call   80069a <fd_close>
+		return r;
+  8013a2:	83 c4 10             	add    $0x10,%esp
+  8013a5:	eb e5                	jmp    80138c <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8013a7:	83 ec 0c             	sub    $0xc,%esp
+  8013aa:	ff 75 f4             	push   -0xc(%ebp)
+  8013ad:	e8 d8 f1 ff ff       	call   80058a <fd2data>
+  8013b2:	83 c4 0c             	add    $0xc,%esp
+  8013b5:	68 07 04 00 00       	push   $0x407
+  8013ba:	50                   	push   %eax
+  8013bb:	6a 00                	push   $0x0
+  8013bd:	e8 b7 ed ff ff       	call   800179 <sys_page_alloc>
+  8013c2:	83 c4 10             	add    $0x10,%esp
+  8013c5:	85 c0                	test   %eax,%eax
+  8013c7:	75 b3                	jne    80137c <open+0x69>
+		fd->fd_file.buffered = 1;
+  8013c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013cc:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8013d0:	eb aa                	jmp    80137c <open+0x69>
+		return -E_BAD_PATH;
+  8013d2:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8013d7:	eb b3                	jmp    80138c <open+0x79>
+
+008013d9 <readdir>:
+{
+  8013d9:	55                   	push   %ebp
+  8013da:	89 e5                	mov    %esp,%ebp
+  8013dc:	53                   	push   %ebx
+  8013dd:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013e3:	50                   	push   %eax
+  8013e4:	ff 75 08             	push   0x8(%ebp)
+  8013e7:	e8 0b f2 ff ff       	call   8005f7 <fd_lookup>
+  8013ec:	89 c3                	mov    %eax,%ebx
+  8013ee:	83 c4 10             	add    $0x10,%esp
+  8013f1:	85 c0                	test   %eax,%eax
+  8013f3:	78 73                	js     801468 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8013f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013f8:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8013fe:	39 08                	cmp    %ecx,(%eax)
+  801400:	0f 85 82 00 00 00    	jne    801488 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801406:	83 ec 0c             	sub    $0xc,%esp
+  801409:	50                   	push   %eax
+  80140a:	e8 c4 f9 ff ff       	call   800dd3 <devfile_sync>
+  80140f:	89 c3                	mov    %eax,%ebx
+  801411:	83 c4 10             	add    $0x10,%esp
+  801414:	85 c0                	test   %eax,%eax
+  801416:	78 50                	js     801468 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801418:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80141b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80141e:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801423:	8b 45 10             	mov    0x10(%ebp),%eax
+  801426:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  80142b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80142e:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801433:	ba 00 00 00 00       	mov    $0x0,%edx
+  801438:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80143d:	e8 ed f8 ff ff       	call   800d2f <fsipc>
+  801442:	89 c3                	mov    %eax,%ebx
+  801444:	85 c0                	test   %eax,%eax
+  801446:	7e 20                	jle    801468 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801448:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80144b:	72 22                	jb     80146f <readdir+0x96>
+  80144d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801452:	7f 1b                	jg     80146f <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801454:	83 ec 04             	sub    $0x4,%esp
+  801457:	50                   	push   %eax
+  801458:	68 00 60 80 00       	push   $0x806000
+  80145d:	ff 75 0c             	push   0xc(%ebp)
+  801460:	e8 1f 19 00 00       	call   802d84 <memmove>
+	return r;
+  801465:	83 c4 10             	add    $0x10,%esp
+}
+  801468:	89 d8                	mov    %ebx,%eax
+  80146a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80146d:	c9                   	leave
+  80146e:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  80146f:	68 4b 38 80 00       	push   $0x80384b
+  801474:	68 24 38 80 00       	push   $0x803824
+  801479:	68 86 01 00 00       	push   $0x186
+  80147e:	68 39 38 80 00       	push   $0x803839
+  801483:	e8 ad 10 00 00       	call   802535 <_panic>
+		return -E_NOT_SUPP;
+  801488:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80148d:	eb d9                	jmp    801468 <readdir+0x8f>
+
+0080148f <munmap>:
+{
+  80148f:	55                   	push   %ebp
+  801490:	89 e5                	mov    %esp,%ebp
+  801492:	56                   	push   %esi
+  801493:	53                   	push   %ebx
+  801494:	8b 75 08             	mov    0x8(%ebp),%esi
+  801497:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80149a:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8014a0:	75 41                	jne    8014e3 <munmap+0x54>
+  8014a2:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8014a8:	77 39                	ja     8014e3 <munmap+0x54>
+  8014aa:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8014af:	29 f0                	sub    %esi,%eax
+  8014b1:	39 d0                	cmp    %edx,%eax
+  8014b3:	72 35                	jb     8014ea <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014b5:	89 f3                	mov    %esi,%ebx
+  8014b7:	01 d6                	add    %edx,%esi
+  8014b9:	39 f3                	cmp    %esi,%ebx
+  8014bb:	73 1a                	jae    8014d7 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8014bd:	83 ec 08             	sub    $0x8,%esp
+  8014c0:	53                   	push   %ebx
+  8014c1:	6a 00                	push   $0x0
+  8014c3:	e8 3e ed ff ff       	call   800206 <sys_page_unmap>
+  8014c8:	83 c4 10             	add    $0x10,%esp
+  8014cb:	85 c0                	test   %eax,%eax
+  8014cd:	78 0d                	js     8014dc <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014cf:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8014d5:	eb e2                	jmp    8014b9 <munmap+0x2a>
+	return 0;
+  8014d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014df:	5b                   	pop    %ebx
+  8014e0:	5e                   	pop    %esi
+  8014e1:	5d                   	pop    %ebp
+  8014e2:	c3                   	ret
+		return -E_INVAL;
+  8014e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014e8:	eb f2                	jmp    8014dc <munmap+0x4d>
+  8014ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014ef:	eb eb                	jmp    8014dc <munmap+0x4d>
+
+008014f1 <mmap>:
+{
+  8014f1:	55                   	push   %ebp
+  8014f2:	89 e5                	mov    %esp,%ebp
+  8014f4:	57                   	push   %edi
+  8014f5:	56                   	push   %esi
+  8014f6:	53                   	push   %ebx
+  8014f7:	83 ec 34             	sub    $0x34,%esp
+  8014fa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014fd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801500:	50                   	push   %eax
+  801501:	ff 75 18             	push   0x18(%ebp)
+  801504:	e8 ee f0 ff ff       	call   8005f7 <fd_lookup>
+  801509:	89 c3                	mov    %eax,%ebx
+  80150b:	83 c4 10             	add    $0x10,%esp
+  80150e:	85 c0                	test   %eax,%eax
+  801510:	0f 88 0e 01 00 00    	js     801624 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801516:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801519:	a1 20 40 80 00       	mov    0x804020,%eax
+  80151e:	39 02                	cmp    %eax,(%edx)
+  801520:	0f 85 50 01 00 00    	jne    801676 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801526:	8b 45 10             	mov    0x10(%ebp),%eax
+  801529:	83 e0 02             	and    $0x2,%eax
+  80152c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80152f:	74 0a                	je     80153b <mmap+0x4a>
+  801531:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801535:	0f 84 42 01 00 00    	je     80167d <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  80153b:	8b 42 08             	mov    0x8(%edx),%eax
+  80153e:	83 e0 03             	and    $0x3,%eax
+  801541:	83 f8 01             	cmp    $0x1,%eax
+  801544:	0f 84 3a 01 00 00    	je     801684 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  80154a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80154d:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801550:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801555:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801558:	0f 85 2d 01 00 00    	jne    80168b <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80155e:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801562:	0f 88 2a 01 00 00    	js     801692 <mmap+0x1a1>
+  801568:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80156f:	0f 87 1d 01 00 00    	ja     801692 <mmap+0x1a1>
+  801575:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80157a:	2b 45 08             	sub    0x8(%ebp),%eax
+  80157d:	39 f8                	cmp    %edi,%eax
+  80157f:	0f 82 14 01 00 00    	jb     801699 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  801585:	83 ec 0c             	sub    $0xc,%esp
+  801588:	52                   	push   %edx
+  801589:	e8 45 f8 ff ff       	call   800dd3 <devfile_sync>
+  80158e:	89 c3                	mov    %eax,%ebx
+  801590:	83 c4 10             	add    $0x10,%esp
+  801593:	85 c0                	test   %eax,%eax
+  801595:	0f 88 89 00 00 00    	js     801624 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  80159b:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8015a1:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8015a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ac:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8015af:	39 fe                	cmp    %edi,%esi
+  8015b1:	73 7b                	jae    80162e <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8015b3:	89 f8                	mov    %edi,%eax
+  8015b5:	29 f0                	sub    %esi,%eax
+  8015b7:	c1 e8 0c             	shr    $0xc,%eax
+  8015ba:	ba 40 00 00 00       	mov    $0x40,%edx
+  8015bf:	39 d0                	cmp    %edx,%eax
+  8015c1:	0f 47 c2             	cmova  %edx,%eax
+  8015c4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8015c7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015ca:	8b 52 0c             	mov    0xc(%edx),%edx
+  8015cd:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  8015d3:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8015d6:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  8015dc:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8015e1:	89 f2                	mov    %esi,%edx
+  8015e3:	03 55 08             	add    0x8(%ebp),%edx
+  8015e6:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8015e9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015ee:	e8 ea f6 ff ff       	call   800cdd <fsipcv>
+  8015f3:	85 c0                	test   %eax,%eax
+  8015f5:	7e 12                	jle    801609 <mmap+0x118>
+  8015f7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015fa:	85 c0                	test   %eax,%eax
+  8015fc:	0f 84 9e 00 00 00    	je     8016a0 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801602:	c1 e0 0c             	shl    $0xc,%eax
+  801605:	01 c6                	add    %eax,%esi
+  801607:	eb a6                	jmp    8015af <mmap+0xbe>
+			munmap(addr, done);
+  801609:	89 c3                	mov    %eax,%ebx
+  80160b:	83 ec 08             	sub    $0x8,%esp
+  80160e:	56                   	push   %esi
+  80160f:	ff 75 08             	push   0x8(%ebp)
+  801612:	e8 78 fe ff ff       	call   80148f <munmap>
+			return r < 0 ? r : -E_INVAL;
+  801617:	83 c4 10             	add    $0x10,%esp
+  80161a:	85 db                	test   %ebx,%ebx
+  80161c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801621:	0f 49 d8             	cmovns %eax,%ebx
+}
+  801624:	89 d8                	mov    %ebx,%eax
+  801626:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801629:	5b                   	pop    %ebx
+  80162a:	5e                   	pop    %esi
+  80162b:	5f                   	pop    %edi
+  80162c:	5d                   	pop    %ebp
+  80162d:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80162e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  801631:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  801633:	85 c0                	test   %eax,%eax
+  801635:	74 ed                	je     801624 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  801637:	be 00 00 00 00       	mov    $0x0,%esi
+  80163c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80163f:	39 fe                	cmp    %edi,%esi
+  801641:	73 2e                	jae    801671 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  801643:	83 ec 0c             	sub    $0xc,%esp
+  801646:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  801649:	50                   	push   %eax
+  80164a:	e8 f6 19 00 00       	call   803045 <cowpage>
+  80164f:	83 c4 10             	add    $0x10,%esp
+  801652:	85 c0                	test   %eax,%eax
+  801654:	78 08                	js     80165e <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  801656:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80165c:	eb e1                	jmp    80163f <mmap+0x14e>
+				munmap(addr, len);
+  80165e:	89 c3                	mov    %eax,%ebx
+  801660:	83 ec 08             	sub    $0x8,%esp
+  801663:	57                   	push   %edi
+  801664:	ff 75 08             	push   0x8(%ebp)
+  801667:	e8 23 fe ff ff       	call   80148f <munmap>
+				return r;
+  80166c:	83 c4 10             	add    $0x10,%esp
+  80166f:	eb b3                	jmp    801624 <mmap+0x133>
+	return 0;
+  801671:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801674:	eb ae                	jmp    801624 <mmap+0x133>
+		return -E_NOT_SUPP;
+  801676:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80167b:	eb a7                	jmp    801624 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80167d:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801682:	eb a0                	jmp    801624 <mmap+0x133>
+		return -E_INVAL;
+  801684:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801689:	eb 99                	jmp    801624 <mmap+0x133>
+  80168b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801690:	eb 92                	jmp    801624 <mmap+0x133>
+  801692:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801697:	eb 8b                	jmp    801624 <mmap+0x133>
+  801699:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80169e:	eb 84                	jmp    801624 <mmap+0x133>
+			munmap(addr, done);
+  8016a0:	83 ec 08             	sub    $0x8,%esp
+  8016a3:	56                   	push   %esi
+  8016a4:	ff 75 08             	push   0x8(%ebp)
+  8016a7:	e8 e3 fd ff ff       	call   80148f <munmap>
+  8016ac:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8016af:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016b4:	e9 6b ff ff ff       	jmp    801624 <mmap+0x133>
+
+008016b9 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8016b9:	55                   	push   %ebp
+  8016ba:	89 e5                	mov    %esp,%ebp
+  8016bc:	56                   	push   %esi
+  8016bd:	53                   	push   %ebx
+  8016be:	83 ec 10             	sub    $0x10,%esp
+  8016c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8016c4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016ca:	e8 3d f9 ff ff       	call   80100c <fsring_slot>
+  8016cf:	85 c0                	test   %eax,%eax
+  8016d1:	78 60                	js     801733 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8016d3:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8016d6:	8b 56 08             	mov    0x8(%esi),%edx
+  8016d9:	83 e2 03             	and    $0x3,%edx
+  8016dc:	83 fa 01             	cmp    $0x1,%edx
+  8016df:	74 59                	je     80173a <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8016e1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8016e6:	89 c1                	mov    %eax,%ecx
+  8016e8:	d3 e2                	shl    %cl,%edx
+  8016ea:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8016f0:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8016f3:	c1 e2 02             	shl    $0x2,%edx
+  8016f6:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8016fc:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  801703:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  801706:	8b 55 18             	mov    0x18(%ebp),%edx
+  801709:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80170c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80170f:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  801712:	83 ec 08             	sub    $0x8,%esp
+  801715:	50                   	push   %eax
+  801716:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80171b:	39 c3                	cmp    %eax,%ebx
+  80171d:	0f 47 d8             	cmova  %eax,%ebx
+  801720:	53                   	push   %ebx
+  801721:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801724:	89 f2                	mov    %esi,%edx
+  801726:	b8 03 00 00 00       	mov    $0x3,%eax
+  80172b:	e8 1e f5 ff ff       	call   800c4e <fsring_post>
+  801730:	83 c4 10             	add    $0x10,%esp
+}
+  801733:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801736:	5b                   	pop    %ebx
+  801737:	5e                   	pop    %esi
+  801738:	5d                   	pop    %ebp
+  801739:	c3                   	ret
+		return -E_INVAL;
+  80173a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80173f:	eb f2                	jmp    801733 <fsring_read+0x7a>
+
+00801741 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  801741:	55                   	push   %ebp
+  801742:	89 e5                	mov    %esp,%ebp
+  801744:	56                   	push   %esi
+  801745:	53                   	push   %ebx
+  801746:	83 ec 10             	sub    $0x10,%esp
+  801749:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80174c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80174f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801752:	e8 b5 f8 ff ff       	call   80100c <fsring_slot>
+  801757:	89 c3                	mov    %eax,%ebx
+  801759:	85 c0                	test   %eax,%eax
+  80175b:	78 77                	js     8017d4 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80175d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801760:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801764:	74 77                	je     8017dd <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  801766:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80176b:	39 c6                	cmp    %eax,%esi
+  80176d:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  801770:	83 ec 04             	sub    $0x4,%esp
+  801773:	56                   	push   %esi
+  801774:	ff 75 0c             	push   0xc(%ebp)
+  801777:	89 d8                	mov    %ebx,%eax
+  801779:	c1 e0 0c             	shl    $0xc,%eax
+  80177c:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  801782:	50                   	push   %eax
+  801783:	e8 fc 15 00 00       	call   802d84 <memmove>
+	fsring_busy |= 1 << slot;
+  801788:	b8 01 00 00 00       	mov    $0x1,%eax
+  80178d:	89 d9                	mov    %ebx,%ecx
+  80178f:	d3 e0                	shl    %cl,%eax
+  801791:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  801797:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80179a:	c1 e0 02             	shl    $0x2,%eax
+  80179d:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8017a3:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8017aa:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8017ad:	8b 45 18             	mov    0x18(%ebp),%eax
+  8017b0:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8017b3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8017ba:	83 c4 08             	add    $0x8,%esp
+  8017bd:	53                   	push   %ebx
+  8017be:	56                   	push   %esi
+  8017bf:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8017c2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8017c5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017ca:	e8 7f f4 ff ff       	call   800c4e <fsring_post>
+  8017cf:	89 c3                	mov    %eax,%ebx
+  8017d1:	83 c4 10             	add    $0x10,%esp
+}
+  8017d4:	89 d8                	mov    %ebx,%eax
+  8017d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017d9:	5b                   	pop    %ebx
+  8017da:	5e                   	pop    %esi
+  8017db:	5d                   	pop    %ebp
+  8017dc:	c3                   	ret
+		return -E_INVAL;
+  8017dd:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8017e2:	eb f0                	jmp    8017d4 <fsring_write+0x93>
+
+008017e4 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8017e4:	55                   	push   %ebp
+  8017e5:	89 e5                	mov    %esp,%ebp
+  8017e7:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8017ea:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8017ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017f0:	e8 17 f8 ff ff       	call   80100c <fsring_slot>
+  8017f5:	85 c0                	test   %eax,%eax
+  8017f7:	78 4c                	js     801845 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8017f9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8017fe:	89 c1                	mov    %eax,%ecx
+  801800:	d3 e2                	shl    %cl,%edx
+  801802:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  801808:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80180b:	c1 e2 02             	shl    $0x2,%edx
+  80180e:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  801814:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  80181b:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80181e:	8b 55 10             	mov    0x10(%ebp),%edx
+  801821:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  801824:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801827:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80182a:	83 ec 08             	sub    $0x8,%esp
+  80182d:	50                   	push   %eax
+  80182e:	6a 00                	push   $0x0
+  801830:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801835:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801838:	b8 05 00 00 00       	mov    $0x5,%eax
+  80183d:	e8 0c f4 ff ff       	call   800c4e <fsring_post>
+  801842:	83 c4 10             	add    $0x10,%esp
+}
+  801845:	c9                   	leave
+  801846:	c3                   	ret
+
+00801847 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  801847:	55                   	push   %ebp
+  801848:	89 e5                	mov    %esp,%ebp
+  80184a:	57                   	push   %edi
+  80184b:	56                   	push   %esi
+  80184c:	53                   	push   %ebx
+  80184d:	83 ec 1c             	sub    $0x1c,%esp
+  801850:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  801854:	a1 00 50 80 00       	mov    0x805000,%eax
+  801859:	8b 40 48             	mov    0x48(%eax),%eax
+  80185c:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801862:	74 12                	je     801876 <fsring_reap+0x2f>
+		return 0;
+  801864:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  801869:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80186c:	5b                   	pop    %ebx
+  80186d:	5e                   	pop    %esi
+  80186e:	5f                   	pop    %edi
+  80186f:	5d                   	pop    %ebp
+  801870:	c3                   	ret
+		sys_yield();
+  801871:	e8 e4 e8 ff ff       	call   80015a <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  801876:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  80187c:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  801881:	39 c2                	cmp    %eax,%edx
+  801883:	75 18                	jne    80189d <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  801885:	84 db                	test   %bl,%bl
+  801887:	0f 84 21 01 00 00    	je     8019ae <fsring_reap+0x167>
+  80188d:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  801894:	75 db                	jne    801871 <fsring_reap+0x2a>
+			return 0;
+  801896:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189b:	eb cc                	jmp    801869 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  80189d:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018a2:	83 e0 0f             	and    $0xf,%eax
+  8018a5:	83 c0 2a             	add    $0x2a,%eax
+  8018a8:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8018af:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8018b6:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018bb:	83 c0 01             	add    $0x1,%eax
+  8018be:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8018c3:	83 fb 0f             	cmp    $0xf,%ebx
+  8018c6:	77 5b                	ja     801923 <fsring_reap+0xdc>
+  8018c8:	be 01 00 00 00       	mov    $0x1,%esi
+  8018cd:	89 d9                	mov    %ebx,%ecx
+  8018cf:	d3 e6                	shl    %cl,%esi
+  8018d1:	89 f0                	mov    %esi,%eax
+  8018d3:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8018d9:	74 48                	je     801923 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8018db:	89 d8                	mov    %ebx,%eax
+  8018dd:	c1 e0 0c             	shl    $0xc,%eax
+  8018e0:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8018e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8018e9:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8018ec:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  8018f3:	83 f8 03             	cmp    $0x3,%eax
+  8018f6:	74 40                	je     801938 <fsring_reap+0xf1>
+  8018f8:	83 f8 05             	cmp    $0x5,%eax
+  8018fb:	74 64                	je     801961 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8018fd:	f7 d6                	not    %esi
+  8018ff:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  801905:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801908:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  80190f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801912:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  801914:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801917:	89 38                	mov    %edi,(%eax)
+	return 1;
+  801919:	b8 01 00 00 00       	mov    $0x1,%eax
+  80191e:	e9 46 ff ff ff       	jmp    801869 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  801923:	53                   	push   %ebx
+  801924:	68 61 38 80 00       	push   $0x803861
+  801929:	68 8f 02 00 00       	push   $0x28f
+  80192e:	68 39 38 80 00       	push   $0x803839
+  801933:	e8 fd 0b 00 00       	call   802535 <_panic>
+		if (cqe.cqe_result > 0)
+  801938:	85 ff                	test   %edi,%edi
+  80193a:	7e c1                	jle    8018fd <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80193c:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80193f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801944:	39 c7                	cmp    %eax,%edi
+  801946:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801949:	50                   	push   %eax
+  80194a:	ff 75 e4             	push   -0x1c(%ebp)
+  80194d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801950:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  801957:	e8 28 14 00 00       	call   802d84 <memmove>
+  80195c:	83 c4 10             	add    $0x10,%esp
+  80195f:	eb 9c                	jmp    8018fd <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  801961:	85 ff                	test   %edi,%edi
+  801963:	75 98                	jne    8018fd <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  801965:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801968:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80196f:	83 ec 08             	sub    $0x8,%esp
+  801972:	ff 75 e4             	push   -0x1c(%ebp)
+  801975:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801978:	51                   	push   %ecx
+  801979:	e8 80 12 00 00       	call   802bfe <strcpy>
+			st->st_size = ret->ret_size;
+  80197e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801981:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  801987:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80198a:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  801990:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  801996:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  80199c:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8019a3:	40 80 00 
+  8019a6:	83 c4 10             	add    $0x10,%esp
+  8019a9:	e9 4f ff ff ff       	jmp    8018fd <fsring_reap+0xb6>
+			return 0;
+  8019ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b3:	e9 b1 fe ff ff       	jmp    801869 <fsring_reap+0x22>
+
+008019b8 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8019b8:	55                   	push   %ebp
+  8019b9:	89 e5                	mov    %esp,%ebp
+  8019bb:	57                   	push   %edi
+  8019bc:	56                   	push   %esi
+  8019bd:	53                   	push   %ebx
+  8019be:	83 ec 28             	sub    $0x28,%esp
+  8019c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019c4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8019c7:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8019ca:	53                   	push   %ebx
+  8019cb:	e8 f3 11 00 00       	call   802bc3 <strlen>
+  8019d0:	83 c4 10             	add    $0x10,%esp
+  8019d3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019d8:	0f 8f 02 01 00 00    	jg     801ae0 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8019de:	83 ec 08             	sub    $0x8,%esp
+  8019e1:	53                   	push   %ebx
+  8019e2:	68 00 60 80 00       	push   $0x806000
+  8019e7:	e8 12 12 00 00       	call   802bfe <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8019ec:	83 c4 10             	add    $0x10,%esp
+  8019ef:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8019f5:	76 69                	jbe    801a60 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8019f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019fa:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801a00:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801a05:	29 d1                	sub    %edx,%ecx
+  801a07:	39 f9                	cmp    %edi,%ecx
+  801a09:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a0f:	89 f9                	mov    %edi,%ecx
+  801a11:	01 c1                	add    %eax,%ecx
+  801a13:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a16:	eb 0f                	jmp    801a27 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  801a18:	0f b6 10             	movzbl (%eax),%edx
+  801a1b:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a1d:	05 00 10 00 00       	add    $0x1000,%eax
+  801a22:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a27:	39 c8                	cmp    %ecx,%eax
+  801a29:	72 ed                	jb     801a18 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  801a2b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a2e:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  801a34:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  801a3a:	83 ec 0c             	sub    $0xc,%esp
+  801a3d:	6a 07                	push   $0x7
+  801a3f:	89 f9                	mov    %edi,%ecx
+  801a41:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a44:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a49:	e8 3f f1 ff ff       	call   800b8d <fsipc_pages>
+  801a4e:	89 c7                	mov    %eax,%edi
+  801a50:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  801a53:	85 f6                	test   %esi,%esi
+  801a55:	74 7f                	je     801ad6 <file_slurp+0x11e>
+  801a57:	8d 43 01             	lea    0x1(%ebx),%eax
+  801a5a:	85 ff                	test   %edi,%edi
+  801a5c:	79 3c                	jns    801a9a <file_slurp+0xe2>
+  801a5e:	eb 76                	jmp    801ad6 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  801a60:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  801a66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a70:	e8 ba f2 ff ff       	call   800d2f <fsipc>
+  801a75:	89 c7                	mov    %eax,%edi
+  801a77:	85 c0                	test   %eax,%eax
+  801a79:	7e d8                	jle    801a53 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  801a7b:	83 ec 04             	sub    $0x4,%esp
+  801a7e:	50                   	push   %eax
+  801a7f:	68 08 60 80 00       	push   $0x806008
+  801a84:	ff 75 0c             	push   0xc(%ebp)
+  801a87:	e8 f8 12 00 00       	call   802d84 <memmove>
+  801a8c:	83 c4 10             	add    $0x10,%esp
+  801a8f:	eb c2                	jmp    801a53 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  801a91:	80 fa 2f             	cmp    $0x2f,%dl
+  801a94:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  801a97:	83 c0 01             	add    $0x1,%eax
+  801a9a:	89 c1                	mov    %eax,%ecx
+  801a9c:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  801aa0:	84 d2                	test   %dl,%dl
+  801aa2:	75 ed                	jne    801a91 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  801aa4:	83 ec 04             	sub    $0x4,%esp
+  801aa7:	68 80 00 00 00       	push   $0x80
+  801aac:	53                   	push   %ebx
+  801aad:	56                   	push   %esi
+  801aae:	e8 c1 11 00 00       	call   802c74 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  801ab3:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ab8:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  801abe:	a1 04 60 80 00       	mov    0x806004,%eax
+  801ac3:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  801ac9:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  801ad0:	40 80 00 
+  801ad3:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801ad6:	89 f8                	mov    %edi,%eax
+  801ad8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801adb:	5b                   	pop    %ebx
+  801adc:	5e                   	pop    %esi
+  801add:	5f                   	pop    %edi
+  801ade:	5d                   	pop    %ebp
+  801adf:	c3                   	ret
+		return -E_BAD_PATH;
+  801ae0:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  801ae5:	eb ef                	jmp    801ad6 <file_slurp+0x11e>
+
+00801ae7 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801ae7:	55                   	push   %ebp
+  801ae8:	89 e5                	mov    %esp,%ebp
+  801aea:	53                   	push   %ebx
+  801aeb:	83 ec 10             	sub    $0x10,%esp
+  801aee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801af1:	53                   	push   %ebx
+  801af2:	e8 cc 10 00 00       	call   802bc3 <strlen>
+  801af7:	83 c4 10             	add    $0x10,%esp
+  801afa:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801aff:	7f 25                	jg     801b26 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b01:	83 ec 08             	sub    $0x8,%esp
+  801b04:	53                   	push   %ebx
+  801b05:	68 00 60 80 00       	push   $0x806000
+  801b0a:	e8 ef 10 00 00       	call   802bfe <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b14:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b19:	e8 11 f2 ff ff       	call   800d2f <fsipc>
+  801b1e:	83 c4 10             	add    $0x10,%esp
+}
+  801b21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b24:	c9                   	leave
+  801b25:	c3                   	ret
+		return -E_BAD_PATH;
+  801b26:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b2b:	eb f4                	jmp    801b21 <remove+0x3a>
+
+00801b2d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b2d:	55                   	push   %ebp
+  801b2e:	89 e5                	mov    %esp,%ebp
+  801b30:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b33:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b38:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b3d:	e8 ed f1 ff ff       	call   800d2f <fsipc>
+}
+  801b42:	c9                   	leave
+  801b43:	c3                   	ret
+
+00801b44 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  801b44:	55                   	push   %ebp
+  801b45:	89 e5                	mov    %esp,%ebp
+  801b47:	57                   	push   %edi
+  801b48:	56                   	push   %esi
+  801b49:	53                   	push   %ebx
+  801b4a:	83 ec 18             	sub    $0x18,%esp
+  801b4d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b50:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801b56:	57                   	push   %edi
+  801b57:	e8 67 10 00 00       	call   802bc3 <strlen>
+  801b5c:	83 c4 10             	add    $0x10,%esp
+  801b5f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b64:	7f 4c                	jg     801bb2 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  801b66:	83 ec 08             	sub    $0x8,%esp
+  801b69:	57                   	push   %edi
+  801b6a:	68 00 60 80 00       	push   $0x806000
+  801b6f:	e8 8a 10 00 00       	call   802bfe <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  801b74:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b79:	b8 10 00 00 00       	mov    $0x10,%eax
+  801b7e:	e8 ac f1 ff ff       	call   800d2f <fsipc>
+  801b83:	83 c4 10             	add    $0x10,%esp
+  801b86:	85 c0                	test   %eax,%eax
+  801b88:	78 20                	js     801baa <defrag+0x66>
+		return r;
+	if (before)
+  801b8a:	85 f6                	test   %esi,%esi
+  801b8c:	74 07                	je     801b95 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  801b8e:	a1 00 60 80 00       	mov    0x806000,%eax
+  801b93:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  801b95:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  801b9a:	85 db                	test   %ebx,%ebx
+  801b9c:	74 0c                	je     801baa <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  801b9e:	a1 04 60 80 00       	mov    0x806004,%eax
+  801ba3:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  801ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801baa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bad:	5b                   	pop    %ebx
+  801bae:	5e                   	pop    %esi
+  801baf:	5f                   	pop    %edi
+  801bb0:	5d                   	pop    %ebp
+  801bb1:	c3                   	ret
+		return -E_BAD_PATH;
+  801bb2:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801bb7:	eb f1                	jmp    801baa <defrag+0x66>
+
+00801bb9 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  801bb9:	55                   	push   %ebp
+  801bba:	89 e5                	mov    %esp,%ebp
+  801bbc:	53                   	push   %ebx
+  801bbd:	83 ec 04             	sub    $0x4,%esp
+  801bc0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  801bc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc8:	b8 11 00 00 00       	mov    $0x11,%eax
+  801bcd:	e8 5d f1 ff ff       	call   800d2f <fsipc>
+  801bd2:	85 c0                	test   %eax,%eax
+  801bd4:	78 34                	js     801c0a <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  801bd6:	a1 00 60 80 00       	mov    0x806000,%eax
+  801bdb:	89 03                	mov    %eax,(%ebx)
+  801bdd:	a1 04 60 80 00       	mov    0x806004,%eax
+  801be2:	89 43 04             	mov    %eax,0x4(%ebx)
+  801be5:	a1 08 60 80 00       	mov    0x806008,%eax
+  801bea:	89 43 08             	mov    %eax,0x8(%ebx)
+  801bed:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  801bf2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801bf5:	a1 10 60 80 00       	mov    0x806010,%eax
+  801bfa:	89 43 10             	mov    %eax,0x10(%ebx)
+  801bfd:	a1 14 60 80 00       	mov    0x806014,%eax
+  801c02:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  801c05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c0d:	c9                   	leave
+  801c0e:	c3                   	ret
+
+00801c0f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c0f:	55                   	push   %ebp
+  801c10:	89 e5                	mov    %esp,%ebp
+  801c12:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c15:	68 7a 38 80 00       	push   $0x80387a
+  801c1a:	ff 75 0c             	push   0xc(%ebp)
+  801c1d:	e8 dc 0f 00 00       	call   802bfe <strcpy>
+	return 0;
+}
+  801c22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c27:	c9                   	leave
+  801c28:	c3                   	ret
+
+00801c29 <devsock_close>:
+{
+  801c29:	55                   	push   %ebp
+  801c2a:	89 e5                	mov    %esp,%ebp
+  801c2c:	53                   	push   %ebx
+  801c2d:	83 ec 10             	sub    $0x10,%esp
+  801c30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c33:	53                   	push   %ebx
+  801c34:	e8 ed 17 00 00       	call   803426 <pageref>
+  801c39:	89 c2                	mov    %eax,%edx
+  801c3b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c43:	83 fa 01             	cmp    $0x1,%edx
+  801c46:	74 05                	je     801c4d <devsock_close+0x24>
+}
+  801c48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c4b:	c9                   	leave
+  801c4c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c4d:	83 ec 0c             	sub    $0xc,%esp
+  801c50:	ff 73 0c             	push   0xc(%ebx)
+  801c53:	e8 b7 02 00 00       	call   801f0f <nsipc_close>
+  801c58:	83 c4 10             	add    $0x10,%esp
+  801c5b:	eb eb                	jmp    801c48 <devsock_close+0x1f>
+
+00801c5d <devsock_write>:
+{
+  801c5d:	55                   	push   %ebp
+  801c5e:	89 e5                	mov    %esp,%ebp
+  801c60:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c63:	6a 00                	push   $0x0
+  801c65:	ff 75 10             	push   0x10(%ebp)
+  801c68:	ff 75 0c             	push   0xc(%ebp)
+  801c6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c6e:	ff 70 0c             	push   0xc(%eax)
+  801c71:	e8 79 03 00 00       	call   801fef <nsipc_send>
+}
+  801c76:	c9                   	leave
+  801c77:	c3                   	ret
+
+00801c78 <devsock_read>:
+{
+  801c78:	55                   	push   %ebp
+  801c79:	89 e5                	mov    %esp,%ebp
+  801c7b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801c7e:	6a 00                	push   $0x0
+  801c80:	ff 75 10             	push   0x10(%ebp)
+  801c83:	ff 75 0c             	push   0xc(%ebp)
+  801c86:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c89:	ff 70 0c             	push   0xc(%eax)
+  801c8c:	e8 ef 02 00 00       	call   801f80 <nsipc_recv>
+}
+  801c91:	c9                   	leave
+  801c92:	c3                   	ret
+
+00801c93 <fd2sockid>:
+{
+  801c93:	55                   	push   %ebp
+  801c94:	89 e5                	mov    %esp,%ebp
+  801c96:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c99:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c9c:	52                   	push   %edx
+  801c9d:	50                   	push   %eax
+  801c9e:	e8 54 e9 ff ff       	call   8005f7 <fd_lookup>
+  801ca3:	83 c4 10             	add    $0x10,%esp
+  801ca6:	85 c0                	test   %eax,%eax
+  801ca8:	78 10                	js     801cba <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801caa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cad:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801cb3:	39 08                	cmp    %ecx,(%eax)
+  801cb5:	75 05                	jne    801cbc <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801cb7:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801cba:	c9                   	leave
+  801cbb:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cbc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cc1:	eb f7                	jmp    801cba <fd2sockid+0x27>
+
+00801cc3 <alloc_sockfd>:
+{
+  801cc3:	55                   	push   %ebp
+  801cc4:	89 e5                	mov    %esp,%ebp
+  801cc6:	56                   	push   %esi
+  801cc7:	53                   	push   %ebx
+  801cc8:	83 ec 1c             	sub    $0x1c,%esp
+  801ccb:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801ccd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cd0:	50                   	push   %eax
+  801cd1:	e8 cb e8 ff ff       	call   8005a1 <fd_alloc>
+  801cd6:	89 c3                	mov    %eax,%ebx
+  801cd8:	83 c4 10             	add    $0x10,%esp
+  801cdb:	85 c0                	test   %eax,%eax
+  801cdd:	78 43                	js     801d22 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801cdf:	83 ec 04             	sub    $0x4,%esp
+  801ce2:	68 07 04 00 00       	push   $0x407
+  801ce7:	ff 75 f4             	push   -0xc(%ebp)
+  801cea:	6a 00                	push   $0x0
+  801cec:	e8 88 e4 ff ff       	call   800179 <sys_page_alloc>
+  801cf1:	89 c3                	mov    %eax,%ebx
+  801cf3:	83 c4 10             	add    $0x10,%esp
+  801cf6:	85 c0                	test   %eax,%eax
+  801cf8:	78 28                	js     801d22 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801cfa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cfd:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801d03:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d08:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d0f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d12:	83 ec 0c             	sub    $0xc,%esp
+  801d15:	50                   	push   %eax
+  801d16:	e8 5f e8 ff ff       	call   80057a <fd2num>
+  801d1b:	89 c3                	mov    %eax,%ebx
+  801d1d:	83 c4 10             	add    $0x10,%esp
+  801d20:	eb 0c                	jmp    801d2e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d22:	83 ec 0c             	sub    $0xc,%esp
+  801d25:	56                   	push   %esi
+  801d26:	e8 e4 01 00 00       	call   801f0f <nsipc_close>
+		return r;
+  801d2b:	83 c4 10             	add    $0x10,%esp
+}
+  801d2e:	89 d8                	mov    %ebx,%eax
+  801d30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d33:	5b                   	pop    %ebx
+  801d34:	5e                   	pop    %esi
+  801d35:	5d                   	pop    %ebp
+  801d36:	c3                   	ret
+
+00801d37 <accept>:
+{
+  801d37:	55                   	push   %ebp
+  801d38:	89 e5                	mov    %esp,%ebp
+  801d3a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d40:	e8 4e ff ff ff       	call   801c93 <fd2sockid>
+  801d45:	85 c0                	test   %eax,%eax
+  801d47:	78 1b                	js     801d64 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d49:	83 ec 04             	sub    $0x4,%esp
+  801d4c:	ff 75 10             	push   0x10(%ebp)
+  801d4f:	ff 75 0c             	push   0xc(%ebp)
+  801d52:	50                   	push   %eax
+  801d53:	e8 0e 01 00 00       	call   801e66 <nsipc_accept>
+  801d58:	83 c4 10             	add    $0x10,%esp
+  801d5b:	85 c0                	test   %eax,%eax
+  801d5d:	78 05                	js     801d64 <accept+0x2d>
+	return alloc_sockfd(r);
+  801d5f:	e8 5f ff ff ff       	call   801cc3 <alloc_sockfd>
+}
+  801d64:	c9                   	leave
+  801d65:	c3                   	ret
+
+00801d66 <bind>:
+{
+  801d66:	55                   	push   %ebp
+  801d67:	89 e5                	mov    %esp,%ebp
+  801d69:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d6f:	e8 1f ff ff ff       	call   801c93 <fd2sockid>
+  801d74:	85 c0                	test   %eax,%eax
+  801d76:	78 12                	js     801d8a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d78:	83 ec 04             	sub    $0x4,%esp
+  801d7b:	ff 75 10             	push   0x10(%ebp)
+  801d7e:	ff 75 0c             	push   0xc(%ebp)
+  801d81:	50                   	push   %eax
+  801d82:	e8 31 01 00 00       	call   801eb8 <nsipc_bind>
+  801d87:	83 c4 10             	add    $0x10,%esp
+}
+  801d8a:	c9                   	leave
+  801d8b:	c3                   	ret
+
+00801d8c <shutdown>:
+{
+  801d8c:	55                   	push   %ebp
+  801d8d:	89 e5                	mov    %esp,%ebp
+  801d8f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d92:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d95:	e8 f9 fe ff ff       	call   801c93 <fd2sockid>
+  801d9a:	85 c0                	test   %eax,%eax
+  801d9c:	78 0f                	js     801dad <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801d9e:	83 ec 08             	sub    $0x8,%esp
+  801da1:	ff 75 0c             	push   0xc(%ebp)
+  801da4:	50                   	push   %eax
+  801da5:	e8 43 01 00 00       	call   801eed <nsipc_shutdown>
+  801daa:	83 c4 10             	add    $0x10,%esp
+}
+  801dad:	c9                   	leave
+  801dae:	c3                   	ret
+
+00801daf <connect>:
+{
+  801daf:	55                   	push   %ebp
+  801db0:	89 e5                	mov    %esp,%ebp
+  801db2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801db5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db8:	e8 d6 fe ff ff       	call   801c93 <fd2sockid>
+  801dbd:	85 c0                	test   %eax,%eax
+  801dbf:	78 12                	js     801dd3 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801dc1:	83 ec 04             	sub    $0x4,%esp
+  801dc4:	ff 75 10             	push   0x10(%ebp)
+  801dc7:	ff 75 0c             	push   0xc(%ebp)
+  801dca:	50                   	push   %eax
+  801dcb:	e8 59 01 00 00       	call   801f29 <nsipc_connect>
+  801dd0:	83 c4 10             	add    $0x10,%esp
+}
+  801dd3:	c9                   	leave
+  801dd4:	c3                   	ret
+
+00801dd5 <listen>:
+{
+  801dd5:	55                   	push   %ebp
+  801dd6:	89 e5                	mov    %esp,%ebp
+  801dd8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ddb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dde:	e8 b0 fe ff ff       	call   801c93 <fd2sockid>
+  801de3:	85 c0                	test   %eax,%eax
+  801de5:	78 0f                	js     801df6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801de7:	83 ec 08             	sub    $0x8,%esp
+  801dea:	ff 75 0c             	push   0xc(%ebp)
+  801ded:	50                   	push   %eax
+  801dee:	e8 6b 01 00 00       	call   801f5e <nsipc_listen>
+  801df3:	83 c4 10             	add    $0x10,%esp
+}
+  801df6:	c9                   	leave
+  801df7:	c3                   	ret
+
+00801df8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801df8:	55                   	push   %ebp
+  801df9:	89 e5                	mov    %esp,%ebp
+  801dfb:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801dfe:	ff 75 10             	push   0x10(%ebp)
+  801e01:	ff 75 0c             	push   0xc(%ebp)
+  801e04:	ff 75 08             	push   0x8(%ebp)
+  801e07:	e8 41 02 00 00       	call   80204d <nsipc_socket>
+  801e0c:	83 c4 10             	add    $0x10,%esp
+  801e0f:	85 c0                	test   %eax,%eax
+  801e11:	78 05                	js     801e18 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e13:	e8 ab fe ff ff       	call   801cc3 <alloc_sockfd>
+}
+  801e18:	c9                   	leave
+  801e19:	c3                   	ret
+
+00801e1a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e1a:	55                   	push   %ebp
+  801e1b:	89 e5                	mov    %esp,%ebp
+  801e1d:	53                   	push   %ebx
+  801e1e:	83 ec 04             	sub    $0x4,%esp
+  801e21:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e23:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  801e2a:	74 26                	je     801e52 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e2c:	6a 07                	push   $0x7
+  801e2e:	68 00 80 80 00       	push   $0x808000
+  801e33:	53                   	push   %ebx
+  801e34:	ff 35 00 90 80 00    	push   0x809000
+  801e3a:	e8 6f 14 00 00       	call   8032ae <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e3f:	83 c4 0c             	add    $0xc,%esp
+  801e42:	6a 00                	push   $0x0
+  801e44:	6a 00                	push   $0x0
+  801e46:	6a 00                	push   $0x0
+  801e48:	e8 f6 13 00 00       	call   803243 <ipc_recv>
+}
+  801e4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e50:	c9                   	leave
+  801e51:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e52:	83 ec 0c             	sub    $0xc,%esp
+  801e55:	6a 02                	push   $0x2
+  801e57:	e8 8b 15 00 00       	call   8033e7 <ipc_find_env>
+  801e5c:	a3 00 90 80 00       	mov    %eax,0x809000
+  801e61:	83 c4 10             	add    $0x10,%esp
+  801e64:	eb c6                	jmp    801e2c <nsipc+0x12>
+
+00801e66 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e66:	55                   	push   %ebp
+  801e67:	89 e5                	mov    %esp,%ebp
+  801e69:	56                   	push   %esi
+  801e6a:	53                   	push   %ebx
+  801e6b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e71:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801e76:	8b 06                	mov    (%esi),%eax
+  801e78:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801e7d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e82:	e8 93 ff ff ff       	call   801e1a <nsipc>
+  801e87:	89 c3                	mov    %eax,%ebx
+  801e89:	85 c0                	test   %eax,%eax
+  801e8b:	79 09                	jns    801e96 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801e8d:	89 d8                	mov    %ebx,%eax
+  801e8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e92:	5b                   	pop    %ebx
+  801e93:	5e                   	pop    %esi
+  801e94:	5d                   	pop    %ebp
+  801e95:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801e96:	83 ec 04             	sub    $0x4,%esp
+  801e99:	ff 35 10 80 80 00    	push   0x808010
+  801e9f:	68 00 80 80 00       	push   $0x808000
+  801ea4:	ff 75 0c             	push   0xc(%ebp)
+  801ea7:	e8 d8 0e 00 00       	call   802d84 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801eac:	a1 10 80 80 00       	mov    0x808010,%eax
+  801eb1:	89 06                	mov    %eax,(%esi)
+  801eb3:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801eb6:	eb d5                	jmp    801e8d <nsipc_accept+0x27>
+
+00801eb8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801eb8:	55                   	push   %ebp
+  801eb9:	89 e5                	mov    %esp,%ebp
+  801ebb:	53                   	push   %ebx
+  801ebc:	83 ec 08             	sub    $0x8,%esp
+  801ebf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ec2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec5:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801eca:	53                   	push   %ebx
+  801ecb:	ff 75 0c             	push   0xc(%ebp)
+  801ece:	68 04 80 80 00       	push   $0x808004
+  801ed3:	e8 ac 0e 00 00       	call   802d84 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801ed8:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801ede:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ee3:	e8 32 ff ff ff       	call   801e1a <nsipc>
+}
+  801ee8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eeb:	c9                   	leave
+  801eec:	c3                   	ret
+
+00801eed <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801eed:	55                   	push   %ebp
+  801eee:	89 e5                	mov    %esp,%ebp
+  801ef0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801ef3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef6:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801efb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801efe:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f03:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f08:	e8 0d ff ff ff       	call   801e1a <nsipc>
+}
+  801f0d:	c9                   	leave
+  801f0e:	c3                   	ret
+
+00801f0f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f0f:	55                   	push   %ebp
+  801f10:	89 e5                	mov    %esp,%ebp
+  801f12:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f18:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f1d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f22:	e8 f3 fe ff ff       	call   801e1a <nsipc>
+}
+  801f27:	c9                   	leave
+  801f28:	c3                   	ret
+
+00801f29 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f29:	55                   	push   %ebp
+  801f2a:	89 e5                	mov    %esp,%ebp
+  801f2c:	53                   	push   %ebx
+  801f2d:	83 ec 08             	sub    $0x8,%esp
+  801f30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f33:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f36:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f3b:	53                   	push   %ebx
+  801f3c:	ff 75 0c             	push   0xc(%ebp)
+  801f3f:	68 04 80 80 00       	push   $0x808004
+  801f44:	e8 3b 0e 00 00       	call   802d84 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f49:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801f4f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f54:	e8 c1 fe ff ff       	call   801e1a <nsipc>
+}
+  801f59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f5c:	c9                   	leave
+  801f5d:	c3                   	ret
+
+00801f5e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f5e:	55                   	push   %ebp
+  801f5f:	89 e5                	mov    %esp,%ebp
+  801f61:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f64:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f67:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f6f:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801f74:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f79:	e8 9c fe ff ff       	call   801e1a <nsipc>
+}
+  801f7e:	c9                   	leave
+  801f7f:	c3                   	ret
+
+00801f80 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801f80:	55                   	push   %ebp
+  801f81:	89 e5                	mov    %esp,%ebp
+  801f83:	56                   	push   %esi
+  801f84:	53                   	push   %ebx
+  801f85:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801f88:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801f90:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801f96:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f99:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801f9e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801fa3:	e8 72 fe ff ff       	call   801e1a <nsipc>
+  801fa8:	89 c3                	mov    %eax,%ebx
+  801faa:	85 c0                	test   %eax,%eax
+  801fac:	78 22                	js     801fd0 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801fae:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801fb3:	39 c6                	cmp    %eax,%esi
+  801fb5:	0f 4e c6             	cmovle %esi,%eax
+  801fb8:	39 c3                	cmp    %eax,%ebx
+  801fba:	7f 1d                	jg     801fd9 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801fbc:	83 ec 04             	sub    $0x4,%esp
+  801fbf:	53                   	push   %ebx
+  801fc0:	68 00 80 80 00       	push   $0x808000
+  801fc5:	ff 75 0c             	push   0xc(%ebp)
+  801fc8:	e8 b7 0d 00 00       	call   802d84 <memmove>
+  801fcd:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801fd0:	89 d8                	mov    %ebx,%eax
+  801fd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd5:	5b                   	pop    %ebx
+  801fd6:	5e                   	pop    %esi
+  801fd7:	5d                   	pop    %ebp
+  801fd8:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801fd9:	68 86 38 80 00       	push   $0x803886
+  801fde:	68 24 38 80 00       	push   $0x803824
+  801fe3:	6a 62                	push   $0x62
+  801fe5:	68 9b 38 80 00       	push   $0x80389b
+  801fea:	e8 46 05 00 00       	call   802535 <_panic>
+
+00801fef <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801fef:	55                   	push   %ebp
+  801ff0:	89 e5                	mov    %esp,%ebp
+  801ff2:	53                   	push   %ebx
+  801ff3:	83 ec 04             	sub    $0x4,%esp
+  801ff6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801ff9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ffc:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802001:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802007:	7f 2e                	jg     802037 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802009:	83 ec 04             	sub    $0x4,%esp
+  80200c:	53                   	push   %ebx
+  80200d:	ff 75 0c             	push   0xc(%ebp)
+  802010:	68 0c 80 80 00       	push   $0x80800c
+  802015:	e8 6a 0d 00 00       	call   802d84 <memmove>
+	nsipcbuf.send.req_size = size;
+  80201a:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802020:	8b 45 14             	mov    0x14(%ebp),%eax
+  802023:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802028:	b8 08 00 00 00       	mov    $0x8,%eax
+  80202d:	e8 e8 fd ff ff       	call   801e1a <nsipc>
+}
+  802032:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802035:	c9                   	leave
+  802036:	c3                   	ret
+	assert(size < 1600);
+  802037:	68 a7 38 80 00       	push   $0x8038a7
+  80203c:	68 24 38 80 00       	push   $0x803824
+  802041:	6a 6d                	push   $0x6d
+  802043:	68 9b 38 80 00       	push   $0x80389b
+  802048:	e8 e8 04 00 00       	call   802535 <_panic>
+
+0080204d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80204d:	55                   	push   %ebp
+  80204e:	89 e5                	mov    %esp,%ebp
+  802050:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802053:	8b 45 08             	mov    0x8(%ebp),%eax
+  802056:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  80205b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80205e:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802063:	8b 45 10             	mov    0x10(%ebp),%eax
+  802066:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  80206b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802070:	e8 a5 fd ff ff       	call   801e1a <nsipc>
+}
+  802075:	c9                   	leave
+  802076:	c3                   	ret
+
+00802077 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802077:	55                   	push   %ebp
+  802078:	89 e5                	mov    %esp,%ebp
+  80207a:	56                   	push   %esi
+  80207b:	53                   	push   %ebx
+  80207c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80207f:	83 ec 0c             	sub    $0xc,%esp
+  802082:	ff 75 08             	push   0x8(%ebp)
+  802085:	e8 00 e5 ff ff       	call   80058a <fd2data>
+  80208a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80208c:	83 c4 08             	add    $0x8,%esp
+  80208f:	68 b3 38 80 00       	push   $0x8038b3
+  802094:	53                   	push   %ebx
+  802095:	e8 64 0b 00 00       	call   802bfe <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80209a:	8b 46 04             	mov    0x4(%esi),%eax
+  80209d:	2b 06                	sub    (%esi),%eax
+  80209f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8020a5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020ac:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020af:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  8020b6:	40 80 00 
+	return 0;
+}
+  8020b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020c1:	5b                   	pop    %ebx
+  8020c2:	5e                   	pop    %esi
+  8020c3:	5d                   	pop    %ebp
+  8020c4:	c3                   	ret
+
+008020c5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020c5:	55                   	push   %ebp
+  8020c6:	89 e5                	mov    %esp,%ebp
+  8020c8:	53                   	push   %ebx
+  8020c9:	83 ec 0c             	sub    $0xc,%esp
+  8020cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020cf:	53                   	push   %ebx
+  8020d0:	6a 00                	push   $0x0
+  8020d2:	e8 2f e1 ff ff       	call   800206 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8020d7:	89 1c 24             	mov    %ebx,(%esp)
+  8020da:	e8 ab e4 ff ff       	call   80058a <fd2data>
+  8020df:	83 c4 08             	add    $0x8,%esp
+  8020e2:	50                   	push   %eax
+  8020e3:	6a 00                	push   $0x0
+  8020e5:	e8 1c e1 ff ff       	call   800206 <sys_page_unmap>
+}
+  8020ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020ed:	c9                   	leave
+  8020ee:	c3                   	ret
+
+008020ef <_pipeisclosed>:
+{
+  8020ef:	55                   	push   %ebp
+  8020f0:	89 e5                	mov    %esp,%ebp
+  8020f2:	57                   	push   %edi
+  8020f3:	56                   	push   %esi
+  8020f4:	53                   	push   %ebx
+  8020f5:	83 ec 1c             	sub    $0x1c,%esp
+  8020f8:	89 c7                	mov    %eax,%edi
+  8020fa:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8020fc:	a1 00 50 80 00       	mov    0x805000,%eax
+  802101:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802104:	83 ec 0c             	sub    $0xc,%esp
+  802107:	57                   	push   %edi
+  802108:	e8 19 13 00 00       	call   803426 <pageref>
+  80210d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802110:	89 34 24             	mov    %esi,(%esp)
+  802113:	e8 0e 13 00 00       	call   803426 <pageref>
+		nn = thisenv->env_runs;
+  802118:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80211e:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802121:	83 c4 10             	add    $0x10,%esp
+  802124:	39 cb                	cmp    %ecx,%ebx
+  802126:	74 1b                	je     802143 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802128:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80212b:	75 cf                	jne    8020fc <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80212d:	8b 42 58             	mov    0x58(%edx),%eax
+  802130:	6a 01                	push   $0x1
+  802132:	50                   	push   %eax
+  802133:	53                   	push   %ebx
+  802134:	68 ba 38 80 00       	push   $0x8038ba
+  802139:	e8 d2 04 00 00       	call   802610 <cprintf>
+  80213e:	83 c4 10             	add    $0x10,%esp
+  802141:	eb b9                	jmp    8020fc <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802143:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802146:	0f 94 c0             	sete   %al
+  802149:	0f b6 c0             	movzbl %al,%eax
+}
+  80214c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80214f:	5b                   	pop    %ebx
+  802150:	5e                   	pop    %esi
+  802151:	5f                   	pop    %edi
+  802152:	5d                   	pop    %ebp
+  802153:	c3                   	ret
+
+00802154 <devpipe_write>:
+{
+  802154:	55                   	push   %ebp
+  802155:	89 e5                	mov    %esp,%ebp
+  802157:	57                   	push   %edi
+  802158:	56                   	push   %esi
+  802159:	53                   	push   %ebx
+  80215a:	83 ec 28             	sub    $0x28,%esp
+  80215d:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802160:	56                   	push   %esi
+  802161:	e8 24 e4 ff ff       	call   80058a <fd2data>
+  802166:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802168:	83 c4 10             	add    $0x10,%esp
+  80216b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802170:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802173:	75 09                	jne    80217e <devpipe_write+0x2a>
+	return i;
+  802175:	89 f8                	mov    %edi,%eax
+  802177:	eb 23                	jmp    80219c <devpipe_write+0x48>
+			sys_yield();
+  802179:	e8 dc df ff ff       	call   80015a <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80217e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802181:	8b 0b                	mov    (%ebx),%ecx
+  802183:	8d 51 20             	lea    0x20(%ecx),%edx
+  802186:	39 d0                	cmp    %edx,%eax
+  802188:	72 1a                	jb     8021a4 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80218a:	89 da                	mov    %ebx,%edx
+  80218c:	89 f0                	mov    %esi,%eax
+  80218e:	e8 5c ff ff ff       	call   8020ef <_pipeisclosed>
+  802193:	85 c0                	test   %eax,%eax
+  802195:	74 e2                	je     802179 <devpipe_write+0x25>
+				return 0;
+  802197:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80219c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80219f:	5b                   	pop    %ebx
+  8021a0:	5e                   	pop    %esi
+  8021a1:	5f                   	pop    %edi
+  8021a2:	5d                   	pop    %ebp
+  8021a3:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021a7:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021ab:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021ae:	89 c2                	mov    %eax,%edx
+  8021b0:	c1 fa 1f             	sar    $0x1f,%edx
+  8021b3:	89 d1                	mov    %edx,%ecx
+  8021b5:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021b8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021bb:	83 e2 1f             	and    $0x1f,%edx
+  8021be:	29 ca                	sub    %ecx,%edx
+  8021c0:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8021c4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021c8:	83 c0 01             	add    $0x1,%eax
+  8021cb:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8021ce:	83 c7 01             	add    $0x1,%edi
+  8021d1:	eb 9d                	jmp    802170 <devpipe_write+0x1c>
+
+008021d3 <devpipe_read>:
+{
+  8021d3:	55                   	push   %ebp
+  8021d4:	89 e5                	mov    %esp,%ebp
+  8021d6:	57                   	push   %edi
+  8021d7:	56                   	push   %esi
+  8021d8:	53                   	push   %ebx
+  8021d9:	83 ec 18             	sub    $0x18,%esp
+  8021dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8021df:	57                   	push   %edi
+  8021e0:	e8 a5 e3 ff ff       	call   80058a <fd2data>
+  8021e5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021e7:	83 c4 10             	add    $0x10,%esp
+  8021ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ef:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021f2:	75 13                	jne    802207 <devpipe_read+0x34>
+	return i;
+  8021f4:	89 f0                	mov    %esi,%eax
+  8021f6:	eb 02                	jmp    8021fa <devpipe_read+0x27>
+				return i;
+  8021f8:	89 f0                	mov    %esi,%eax
+}
+  8021fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021fd:	5b                   	pop    %ebx
+  8021fe:	5e                   	pop    %esi
+  8021ff:	5f                   	pop    %edi
+  802200:	5d                   	pop    %ebp
+  802201:	c3                   	ret
+			sys_yield();
+  802202:	e8 53 df ff ff       	call   80015a <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802207:	8b 03                	mov    (%ebx),%eax
+  802209:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80220c:	75 18                	jne    802226 <devpipe_read+0x53>
+			if (i > 0)
+  80220e:	85 f6                	test   %esi,%esi
+  802210:	75 e6                	jne    8021f8 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802212:	89 da                	mov    %ebx,%edx
+  802214:	89 f8                	mov    %edi,%eax
+  802216:	e8 d4 fe ff ff       	call   8020ef <_pipeisclosed>
+  80221b:	85 c0                	test   %eax,%eax
+  80221d:	74 e3                	je     802202 <devpipe_read+0x2f>
+				return 0;
+  80221f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802224:	eb d4                	jmp    8021fa <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802226:	99                   	cltd
+  802227:	c1 ea 1b             	shr    $0x1b,%edx
+  80222a:	01 d0                	add    %edx,%eax
+  80222c:	83 e0 1f             	and    $0x1f,%eax
+  80222f:	29 d0                	sub    %edx,%eax
+  802231:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802236:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802239:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80223c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80223f:	83 c6 01             	add    $0x1,%esi
+  802242:	eb ab                	jmp    8021ef <devpipe_read+0x1c>
+
+00802244 <pipe>:
+{
+  802244:	55                   	push   %ebp
+  802245:	89 e5                	mov    %esp,%ebp
+  802247:	56                   	push   %esi
+  802248:	53                   	push   %ebx
+  802249:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80224c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80224f:	50                   	push   %eax
+  802250:	e8 4c e3 ff ff       	call   8005a1 <fd_alloc>
+  802255:	89 c3                	mov    %eax,%ebx
+  802257:	83 c4 10             	add    $0x10,%esp
+  80225a:	85 c0                	test   %eax,%eax
+  80225c:	0f 88 23 01 00 00    	js     802385 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802262:	83 ec 04             	sub    $0x4,%esp
+  802265:	68 07 04 00 00       	push   $0x407
+  80226a:	ff 75 f4             	push   -0xc(%ebp)
+  80226d:	6a 00                	push   $0x0
+  80226f:	e8 05 df ff ff       	call   800179 <sys_page_alloc>
+  802274:	89 c3                	mov    %eax,%ebx
+  802276:	83 c4 10             	add    $0x10,%esp
+  802279:	85 c0                	test   %eax,%eax
+  80227b:	0f 88 04 01 00 00    	js     802385 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802281:	83 ec 0c             	sub    $0xc,%esp
+  802284:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802287:	50                   	push   %eax
+  802288:	e8 14 e3 ff ff       	call   8005a1 <fd_alloc>
+  80228d:	89 c3                	mov    %eax,%ebx
+  80228f:	83 c4 10             	add    $0x10,%esp
+  802292:	85 c0                	test   %eax,%eax
+  802294:	0f 88 db 00 00 00    	js     802375 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80229a:	83 ec 04             	sub    $0x4,%esp
+  80229d:	68 07 04 00 00       	push   $0x407
+  8022a2:	ff 75 f0             	push   -0x10(%ebp)
+  8022a5:	6a 00                	push   $0x0
+  8022a7:	e8 cd de ff ff       	call   800179 <sys_page_alloc>
+  8022ac:	89 c3                	mov    %eax,%ebx
+  8022ae:	83 c4 10             	add    $0x10,%esp
+  8022b1:	85 c0                	test   %eax,%eax
+  8022b3:	0f 88 bc 00 00 00    	js     802375 <pipe+0x131>
+	va = fd2data(fd0);
+  8022b9:	83 ec 0c             	sub    $0xc,%esp
+  8022bc:	ff 75 f4             	push   -0xc(%ebp)
+  8022bf:	e8 c6 e2 ff ff       	call   80058a <fd2data>
+  8022c4:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022c6:	83 c4 0c             	add    $0xc,%esp
+  8022c9:	68 07 04 00 00       	push   $0x407
+  8022ce:	50                   	push   %eax
+  8022cf:	6a 00                	push   $0x0
+  8022d1:	e8 a3 de ff ff       	call   800179 <sys_page_alloc>
+  8022d6:	89 c3                	mov    %eax,%ebx
+  8022d8:	83 c4 10             	add    $0x10,%esp
+  8022db:	85 c0                	test   %eax,%eax
+  8022dd:	0f 88 82 00 00 00    	js     802365 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022e3:	83 ec 0c             	sub    $0xc,%esp
+  8022e6:	ff 75 f0             	push   -0x10(%ebp)
+  8022e9:	e8 9c e2 ff ff       	call   80058a <fd2data>
+  8022ee:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8022f5:	50                   	push   %eax
+  8022f6:	6a 00                	push   $0x0
+  8022f8:	56                   	push   %esi
+  8022f9:	6a 00                	push   $0x0
+  8022fb:	e8 c4 de ff ff       	call   8001c4 <sys_page_map>
+  802300:	89 c3                	mov    %eax,%ebx
+  802302:	83 c4 20             	add    $0x20,%esp
+  802305:	85 c0                	test   %eax,%eax
+  802307:	78 4e                	js     802357 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802309:	a1 60 40 80 00       	mov    0x804060,%eax
+  80230e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802311:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802313:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802316:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80231d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802320:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802322:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802325:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80232c:	83 ec 0c             	sub    $0xc,%esp
+  80232f:	ff 75 f4             	push   -0xc(%ebp)
+  802332:	e8 43 e2 ff ff       	call   80057a <fd2num>
+  802337:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80233a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80233c:	83 c4 04             	add    $0x4,%esp
+  80233f:	ff 75 f0             	push   -0x10(%ebp)
+  802342:	e8 33 e2 ff ff       	call   80057a <fd2num>
+  802347:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80234a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80234d:	83 c4 10             	add    $0x10,%esp
+  802350:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802355:	eb 2e                	jmp    802385 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802357:	83 ec 08             	sub    $0x8,%esp
+  80235a:	56                   	push   %esi
+  80235b:	6a 00                	push   $0x0
+  80235d:	e8 a4 de ff ff       	call   800206 <sys_page_unmap>
+  802362:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802365:	83 ec 08             	sub    $0x8,%esp
+  802368:	ff 75 f0             	push   -0x10(%ebp)
+  80236b:	6a 00                	push   $0x0
+  80236d:	e8 94 de ff ff       	call   800206 <sys_page_unmap>
+  802372:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802375:	83 ec 08             	sub    $0x8,%esp
+  802378:	ff 75 f4             	push   -0xc(%ebp)
+  80237b:	6a 00                	push   $0x0
+  80237d:	e8 84 de ff ff       	call   800206 <sys_page_unmap>
+  802382:	83 c4 10             	add    $0x10,%esp
+}
+  802385:	89 d8                	mov    %ebx,%eax
+  802387:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80238a:	5b                   	pop    %ebx
+  80238b:	5e                   	pop    %esi
+  80238c:	5d                   	pop    %ebp
+  80238d:	c3                   	ret
+
+0080238e <pipeisclosed>:
+{
+  80238e:	55                   	push   %ebp
+  80238f:	89 e5                	mov    %esp,%ebp
+  802391:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802394:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802397:	50                   	push   %eax
+  802398:	ff 75 08             	push   0x8(%ebp)
+  80239b:	e8 57 e2 ff ff       	call   8005f7 <fd_lookup>
+  8023a0:	83 c4 10             	add    $0x10,%esp
+  8023a3:	85 c0                	test   %eax,%eax
+  8023a5:	78 18                	js     8023bf <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8023a7:	83 ec 0c             	sub    $0xc,%esp
+  8023aa:	ff 75 f4             	push   -0xc(%ebp)
+  8023ad:	e8 d8 e1 ff ff       	call   80058a <fd2data>
+  8023b2:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8023b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b7:	e8 33 fd ff ff       	call   8020ef <_pipeisclosed>
+  8023bc:	83 c4 10             	add    $0x10,%esp
+}
+  8023bf:	c9                   	leave
+  8023c0:	c3                   	ret
+
+008023c1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8023c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c6:	c3                   	ret
+
+008023c7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023c7:	55                   	push   %ebp
+  8023c8:	89 e5                	mov    %esp,%ebp
+  8023ca:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8023cd:	68 d2 38 80 00       	push   $0x8038d2
+  8023d2:	ff 75 0c             	push   0xc(%ebp)
+  8023d5:	e8 24 08 00 00       	call   802bfe <strcpy>
+	return 0;
+}
+  8023da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023df:	c9                   	leave
+  8023e0:	c3                   	ret
+
+008023e1 <devcons_write>:
+{
+  8023e1:	55                   	push   %ebp
+  8023e2:	89 e5                	mov    %esp,%ebp
+  8023e4:	57                   	push   %edi
+  8023e5:	56                   	push   %esi
+  8023e6:	53                   	push   %ebx
+  8023e7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8023ed:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8023f2:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8023f8:	eb 2e                	jmp    802428 <devcons_write+0x47>
+		m = n - tot;
+  8023fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023fd:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8023ff:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802404:	39 c3                	cmp    %eax,%ebx
+  802406:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802409:	83 ec 04             	sub    $0x4,%esp
+  80240c:	53                   	push   %ebx
+  80240d:	89 f0                	mov    %esi,%eax
+  80240f:	03 45 0c             	add    0xc(%ebp),%eax
+  802412:	50                   	push   %eax
+  802413:	57                   	push   %edi
+  802414:	e8 6b 09 00 00       	call   802d84 <memmove>
+		sys_cputs(buf, m);
+  802419:	83 c4 08             	add    $0x8,%esp
+  80241c:	53                   	push   %ebx
+  80241d:	57                   	push   %edi
+  80241e:	e8 7a dc ff ff       	call   80009d <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802423:	01 de                	add    %ebx,%esi
+  802425:	83 c4 10             	add    $0x10,%esp
+  802428:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80242b:	72 cd                	jb     8023fa <devcons_write+0x19>
+}
+  80242d:	89 f0                	mov    %esi,%eax
+  80242f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802432:	5b                   	pop    %ebx
+  802433:	5e                   	pop    %esi
+  802434:	5f                   	pop    %edi
+  802435:	5d                   	pop    %ebp
+  802436:	c3                   	ret
+
+00802437 <devcons_read>:
+{
+  802437:	55                   	push   %ebp
+  802438:	89 e5                	mov    %esp,%ebp
+  80243a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80243d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802442:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802446:	75 07                	jne    80244f <devcons_read+0x18>
+  802448:	eb 1f                	jmp    802469 <devcons_read+0x32>
+		sys_yield();
+  80244a:	e8 0b dd ff ff       	call   80015a <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80244f:	e8 6f dc ff ff       	call   8000c3 <sys_cgetc>
+  802454:	85 c0                	test   %eax,%eax
+  802456:	74 f2                	je     80244a <devcons_read+0x13>
+	if (c < 0)
+  802458:	78 0f                	js     802469 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80245a:	83 f8 04             	cmp    $0x4,%eax
+  80245d:	74 0c                	je     80246b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80245f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802462:	88 02                	mov    %al,(%edx)
+	return 1;
+  802464:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802469:	c9                   	leave
+  80246a:	c3                   	ret
+		return 0;
+  80246b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802470:	eb f7                	jmp    802469 <devcons_read+0x32>
+
+00802472 <cputchar>:
+{
+  802472:	55                   	push   %ebp
+  802473:	89 e5                	mov    %esp,%ebp
+  802475:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802478:	8b 45 08             	mov    0x8(%ebp),%eax
+  80247b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80247e:	6a 01                	push   $0x1
+  802480:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802483:	50                   	push   %eax
+  802484:	e8 14 dc ff ff       	call   80009d <sys_cputs>
+}
+  802489:	83 c4 10             	add    $0x10,%esp
+  80248c:	c9                   	leave
+  80248d:	c3                   	ret
+
+0080248e <getchar>:
+{
+  80248e:	55                   	push   %ebp
+  80248f:	89 e5                	mov    %esp,%ebp
+  802491:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802494:	6a 01                	push   $0x1
+  802496:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802499:	50                   	push   %eax
+  80249a:	6a 00                	push   $0x0
+  80249c:	e8 bc e3 ff ff       	call   80085d <read>
+	if (r < 0)
+  8024a1:	83 c4 10             	add    $0x10,%esp
+  8024a4:	85 c0                	test   %eax,%eax
+  8024a6:	78 06                	js     8024ae <getchar+0x20>
+	if (r < 1)
+  8024a8:	74 06                	je     8024b0 <getchar+0x22>
+	return c;
+  8024aa:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8024ae:	c9                   	leave
+  8024af:	c3                   	ret
+		return -E_EOF;
+  8024b0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8024b5:	eb f7                	jmp    8024ae <getchar+0x20>
+
+008024b7 <iscons>:
+{
+  8024b7:	55                   	push   %ebp
+  8024b8:	89 e5                	mov    %esp,%ebp
+  8024ba:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024c0:	50                   	push   %eax
+  8024c1:	ff 75 08             	push   0x8(%ebp)
+  8024c4:	e8 2e e1 ff ff       	call   8005f7 <fd_lookup>
+  8024c9:	83 c4 10             	add    $0x10,%esp
+  8024cc:	85 c0                	test   %eax,%eax
+  8024ce:	78 11                	js     8024e1 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8024d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024d3:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8024d9:	39 10                	cmp    %edx,(%eax)
+  8024db:	0f 94 c0             	sete   %al
+  8024de:	0f b6 c0             	movzbl %al,%eax
+}
+  8024e1:	c9                   	leave
+  8024e2:	c3                   	ret
+
+008024e3 <opencons>:
+{
+  8024e3:	55                   	push   %ebp
+  8024e4:	89 e5                	mov    %esp,%ebp
+  8024e6:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8024e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024ec:	50                   	push   %eax
+  8024ed:	e8 af e0 ff ff       	call   8005a1 <fd_alloc>
+  8024f2:	83 c4 10             	add    $0x10,%esp
+  8024f5:	85 c0                	test   %eax,%eax
+  8024f7:	78 3a                	js     802533 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8024f9:	83 ec 04             	sub    $0x4,%esp
+  8024fc:	68 07 04 00 00       	push   $0x407
+  802501:	ff 75 f4             	push   -0xc(%ebp)
+  802504:	6a 00                	push   $0x0
+  802506:	e8 6e dc ff ff       	call   800179 <sys_page_alloc>
+  80250b:	83 c4 10             	add    $0x10,%esp
+  80250e:	85 c0                	test   %eax,%eax
+  802510:	78 21                	js     802533 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802512:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802515:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80251b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80251d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802520:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802527:	83 ec 0c             	sub    $0xc,%esp
+  80252a:	50                   	push   %eax
+  80252b:	e8 4a e0 ff ff       	call   80057a <fd2num>
+  802530:	83 c4 10             	add    $0x10,%esp
+}
+  802533:	c9                   	leave
+  802534:	c3                   	ret
+
+00802535 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802535:	55                   	push   %ebp
+  802536:	89 e5                	mov    %esp,%ebp
+  802538:	56                   	push   %esi
+  802539:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80253a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80253d:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802543:	e8 eb db ff ff       	call   800133 <sys_getenvid>
+  802548:	83 ec 0c             	sub    $0xc,%esp
+  80254b:	ff 75 0c             	push   0xc(%ebp)
+  80254e:	ff 75 08             	push   0x8(%ebp)
+  802551:	56                   	push   %esi
+  802552:	50                   	push   %eax
+  802553:	68 e0 38 80 00       	push   $0x8038e0
+  802558:	e8 b3 00 00 00       	call   802610 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80255d:	83 c4 18             	add    $0x18,%esp
+  802560:	53                   	push   %ebx
+  802561:	ff 75 10             	push   0x10(%ebp)
+  802564:	e8 56 00 00 00       	call   8025bf <vcprintf>
+	cprintf("\n");
+  802569:	c7 04 24 cb 38 80 00 	movl   $0x8038cb,(%esp)
+  802570:	e8 9b 00 00 00       	call   802610 <cprintf>
+  802575:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802578:	cc                   	int3
+	while (1)
+  802579:	eb fd                	jmp    802578 <_panic+0x43>
+
+0080257b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80257b:	55                   	push   %ebp
+  80257c:	89 e5                	mov    %esp,%ebp
+  80257e:	53                   	push   %ebx
+  80257f:	83 ec 04             	sub    $0x4,%esp
+  802582:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802585:	8b 13                	mov    (%ebx),%edx
+  802587:	8d 42 01             	lea    0x1(%edx),%eax
+  80258a:	89 03                	mov    %eax,(%ebx)
+  80258c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80258f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  802593:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802598:	74 09                	je     8025a3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80259a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80259e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025a1:	c9                   	leave
+  8025a2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8025a3:	83 ec 08             	sub    $0x8,%esp
+  8025a6:	68 ff 00 00 00       	push   $0xff
+  8025ab:	8d 43 08             	lea    0x8(%ebx),%eax
+  8025ae:	50                   	push   %eax
+  8025af:	e8 e9 da ff ff       	call   80009d <sys_cputs>
+		b->idx = 0;
+  8025b4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8025ba:	83 c4 10             	add    $0x10,%esp
+  8025bd:	eb db                	jmp    80259a <putch+0x1f>
+
+008025bf <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8025bf:	55                   	push   %ebp
+  8025c0:	89 e5                	mov    %esp,%ebp
+  8025c2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8025c8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8025cf:	00 00 00 
+	b.cnt = 0;
+  8025d2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8025d9:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8025dc:	ff 75 0c             	push   0xc(%ebp)
+  8025df:	ff 75 08             	push   0x8(%ebp)
+  8025e2:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8025e8:	50                   	push   %eax
+  8025e9:	68 7b 25 80 00       	push   $0x80257b
+  8025ee:	e8 14 01 00 00       	call   802707 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8025f3:	83 c4 08             	add    $0x8,%esp
+  8025f6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8025fc:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802602:	50                   	push   %eax
+  802603:	e8 95 da ff ff       	call   80009d <sys_cputs>
+
+	return b.cnt;
+}
+  802608:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80260e:	c9                   	leave
+  80260f:	c3                   	ret
+
+00802610 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802610:	55                   	push   %ebp
+  802611:	89 e5                	mov    %esp,%ebp
+  802613:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802616:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802619:	50                   	push   %eax
+  80261a:	ff 75 08             	push   0x8(%ebp)
+  80261d:	e8 9d ff ff ff       	call   8025bf <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802622:	c9                   	leave
+  802623:	c3                   	ret
+
+00802624 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802624:	55                   	push   %ebp
+  802625:	89 e5                	mov    %esp,%ebp
+  802627:	57                   	push   %edi
+  802628:	56                   	push   %esi
+  802629:	53                   	push   %ebx
+  80262a:	83 ec 1c             	sub    $0x1c,%esp
+  80262d:	89 c7                	mov    %eax,%edi
+  80262f:	89 d6                	mov    %edx,%esi
+  802631:	8b 45 08             	mov    0x8(%ebp),%eax
+  802634:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802637:	89 d1                	mov    %edx,%ecx
+  802639:	89 c2                	mov    %eax,%edx
+  80263b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80263e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802641:	8b 45 10             	mov    0x10(%ebp),%eax
+  802644:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802647:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80264a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802651:	39 c2                	cmp    %eax,%edx
+  802653:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802656:	72 3e                	jb     802696 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802658:	83 ec 0c             	sub    $0xc,%esp
+  80265b:	ff 75 18             	push   0x18(%ebp)
+  80265e:	83 eb 01             	sub    $0x1,%ebx
+  802661:	53                   	push   %ebx
+  802662:	50                   	push   %eax
+  802663:	83 ec 08             	sub    $0x8,%esp
+  802666:	ff 75 e4             	push   -0x1c(%ebp)
+  802669:	ff 75 e0             	push   -0x20(%ebp)
+  80266c:	ff 75 dc             	push   -0x24(%ebp)
+  80266f:	ff 75 d8             	push   -0x28(%ebp)
+  802672:	e8 59 0f 00 00       	call   8035d0 <__udivdi3>
+  802677:	83 c4 18             	add    $0x18,%esp
+  80267a:	52                   	push   %edx
+  80267b:	50                   	push   %eax
+  80267c:	89 f2                	mov    %esi,%edx
+  80267e:	89 f8                	mov    %edi,%eax
+  802680:	e8 9f ff ff ff       	call   802624 <printnum>
+  802685:	83 c4 20             	add    $0x20,%esp
+  802688:	eb 13                	jmp    80269d <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80268a:	83 ec 08             	sub    $0x8,%esp
+  80268d:	56                   	push   %esi
+  80268e:	ff 75 18             	push   0x18(%ebp)
+  802691:	ff d7                	call   *%edi
+  802693:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  802696:	83 eb 01             	sub    $0x1,%ebx
+  802699:	85 db                	test   %ebx,%ebx
+  80269b:	7f ed                	jg     80268a <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80269d:	83 ec 08             	sub    $0x8,%esp
+  8026a0:	56                   	push   %esi
+  8026a1:	83 ec 04             	sub    $0x4,%esp
+  8026a4:	ff 75 e4             	push   -0x1c(%ebp)
+  8026a7:	ff 75 e0             	push   -0x20(%ebp)
+  8026aa:	ff 75 dc             	push   -0x24(%ebp)
+  8026ad:	ff 75 d8             	push   -0x28(%ebp)
+  8026b0:	e8 39 0f 00 00       	call   8035ee <__umoddi3>
+  8026b5:	83 c4 14             	add    $0x14,%esp
+  8026b8:	0f be 80 03 39 80 00 	movsbl 0x803903(%eax),%eax
+  8026bf:	50                   	push   %eax
+  8026c0:	ff d7                	call   *%edi
+}
+  8026c2:	83 c4 10             	add    $0x10,%esp
+  8026c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026c8:	5b                   	pop    %ebx
+  8026c9:	5e                   	pop    %esi
+  8026ca:	5f                   	pop    %edi
+  8026cb:	5d                   	pop    %ebp
+  8026cc:	c3                   	ret
+
+008026cd <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8026cd:	55                   	push   %ebp
+  8026ce:	89 e5                	mov    %esp,%ebp
+  8026d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8026d3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8026d7:	8b 10                	mov    (%eax),%edx
+  8026d9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8026dc:	73 0a                	jae    8026e8 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8026de:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8026e1:	89 08                	mov    %ecx,(%eax)
+  8026e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e6:	88 02                	mov    %al,(%edx)
+}
+  8026e8:	5d                   	pop    %ebp
+  8026e9:	c3                   	ret
+
+008026ea <printfmt>:
+{
+  8026ea:	55                   	push   %ebp
+  8026eb:	89 e5                	mov    %esp,%ebp
+  8026ed:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8026f0:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8026f3:	50                   	push   %eax
+  8026f4:	ff 75 10             	push   0x10(%ebp)
+  8026f7:	ff 75 0c             	push   0xc(%ebp)
+  8026fa:	ff 75 08             	push   0x8(%ebp)
+  8026fd:	e8 05 00 00 00       	call   802707 <vprintfmt>
+}
+  802702:	83 c4 10             	add    $0x10,%esp
+  802705:	c9                   	leave
+  802706:	c3                   	ret
+
+00802707 <vprintfmt>:
+{
+  802707:	55                   	push   %ebp
+  802708:	89 e5                	mov    %esp,%ebp
+  80270a:	57                   	push   %edi
+  80270b:	56                   	push   %esi
+  80270c:	53                   	push   %ebx
+  80270d:	83 ec 2c             	sub    $0x2c,%esp
+  802710:	8b 75 08             	mov    0x8(%ebp),%esi
+  802713:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802716:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802719:	eb 0a                	jmp    802725 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80271b:	83 ec 08             	sub    $0x8,%esp
+  80271e:	53                   	push   %ebx
+  80271f:	50                   	push   %eax
+  802720:	ff d6                	call   *%esi
+  802722:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802725:	83 c7 01             	add    $0x1,%edi
+  802728:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80272c:	83 f8 25             	cmp    $0x25,%eax
+  80272f:	74 0c                	je     80273d <vprintfmt+0x36>
+			if (ch == '\0')
+  802731:	85 c0                	test   %eax,%eax
+  802733:	75 e6                	jne    80271b <vprintfmt+0x14>
+}
+  802735:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802738:	5b                   	pop    %ebx
+  802739:	5e                   	pop    %esi
+  80273a:	5f                   	pop    %edi
+  80273b:	5d                   	pop    %ebp
+  80273c:	c3                   	ret
+		padc = ' ';
+  80273d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  802741:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802748:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80274f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  802756:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80275b:	8d 47 01             	lea    0x1(%edi),%eax
+  80275e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802761:	0f b6 17             	movzbl (%edi),%edx
+  802764:	8d 42 dd             	lea    -0x23(%edx),%eax
+  802767:	3c 55                	cmp    $0x55,%al
+  802769:	0f 87 cf 03 00 00    	ja     802b3e <vprintfmt+0x437>
+  80276f:	0f b6 c0             	movzbl %al,%eax
+  802772:	ff 24 85 60 3a 80 00 	jmp    *0x803a60(,%eax,4)
+  802779:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80277c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  802780:	eb d9                	jmp    80275b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  802782:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802785:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  802789:	eb d0                	jmp    80275b <vprintfmt+0x54>
+  80278b:	0f b6 d2             	movzbl %dl,%edx
+  80278e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  802791:	b8 00 00 00 00       	mov    $0x0,%eax
+  802796:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  802799:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80279c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8027a0:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8027a3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8027a6:	83 f9 09             	cmp    $0x9,%ecx
+  8027a9:	77 55                	ja     802800 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8027ab:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8027ae:	eb e9                	jmp    802799 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8027b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027b3:	8b 00                	mov    (%eax),%eax
+  8027b5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8027b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8027be:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8027c4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8027c8:	79 91                	jns    80275b <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8027ca:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8027cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8027d0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8027d7:	eb 82                	jmp    80275b <vprintfmt+0x54>
+			if (width < 0)
+  8027d9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8027dc:	85 d2                	test   %edx,%edx
+  8027de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e3:	0f 49 c2             	cmovns %edx,%eax
+  8027e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8027ec:	e9 6a ff ff ff       	jmp    80275b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8027f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8027f4:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8027fb:	e9 5b ff ff ff       	jmp    80275b <vprintfmt+0x54>
+  802800:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802803:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802806:	eb bc                	jmp    8027c4 <vprintfmt+0xbd>
+			lflag++;
+  802808:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80280b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80280e:	e9 48 ff ff ff       	jmp    80275b <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  802813:	8b 45 14             	mov    0x14(%ebp),%eax
+  802816:	8d 78 04             	lea    0x4(%eax),%edi
+  802819:	83 ec 08             	sub    $0x8,%esp
+  80281c:	53                   	push   %ebx
+  80281d:	ff 30                	push   (%eax)
+  80281f:	ff d6                	call   *%esi
+			break;
+  802821:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802824:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  802827:	e9 b1 02 00 00       	jmp    802add <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80282c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80282f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  802832:	8b 10                	mov    (%eax),%edx
+  802834:	89 d0                	mov    %edx,%eax
+  802836:	f7 d8                	neg    %eax
+  802838:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80283b:	83 f8 11             	cmp    $0x11,%eax
+  80283e:	7f 23                	jg     802863 <vprintfmt+0x15c>
+  802840:	8b 14 85 c0 3b 80 00 	mov    0x803bc0(,%eax,4),%edx
+  802847:	85 d2                	test   %edx,%edx
+  802849:	74 18                	je     802863 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80284b:	52                   	push   %edx
+  80284c:	68 36 38 80 00       	push   $0x803836
+  802851:	53                   	push   %ebx
+  802852:	56                   	push   %esi
+  802853:	e8 92 fe ff ff       	call   8026ea <printfmt>
+  802858:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80285b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80285e:	e9 7a 02 00 00       	jmp    802add <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  802863:	50                   	push   %eax
+  802864:	68 1b 39 80 00       	push   $0x80391b
+  802869:	53                   	push   %ebx
+  80286a:	56                   	push   %esi
+  80286b:	e8 7a fe ff ff       	call   8026ea <printfmt>
+  802870:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802873:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802876:	e9 62 02 00 00       	jmp    802add <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80287b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80287e:	83 c0 04             	add    $0x4,%eax
+  802881:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  802884:	8b 45 14             	mov    0x14(%ebp),%eax
+  802887:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  802889:	85 c9                	test   %ecx,%ecx
+  80288b:	b8 14 39 80 00       	mov    $0x803914,%eax
+  802890:	0f 45 c1             	cmovne %ecx,%eax
+  802893:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  802896:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80289a:	7e 06                	jle    8028a2 <vprintfmt+0x19b>
+  80289c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8028a0:	75 0b                	jne    8028ad <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028a2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8028a5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8028a8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028ab:	eb 5c                	jmp    802909 <vprintfmt+0x202>
+  8028ad:	83 ec 08             	sub    $0x8,%esp
+  8028b0:	ff 75 d0             	push   -0x30(%ebp)
+  8028b3:	ff 75 cc             	push   -0x34(%ebp)
+  8028b6:	e8 20 03 00 00       	call   802bdb <strnlen>
+  8028bb:	89 c2                	mov    %eax,%edx
+  8028bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028c0:	29 d0                	sub    %edx,%eax
+  8028c2:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8028c5:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8028c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028cc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028cf:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028d1:	eb 0e                	jmp    8028e1 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8028d3:	83 ec 08             	sub    $0x8,%esp
+  8028d6:	53                   	push   %ebx
+  8028d7:	57                   	push   %edi
+  8028d8:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028db:	83 ee 01             	sub    $0x1,%esi
+  8028de:	83 c4 10             	add    $0x10,%esp
+  8028e1:	85 f6                	test   %esi,%esi
+  8028e3:	7f ee                	jg     8028d3 <vprintfmt+0x1cc>
+  8028e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028eb:	85 c0                	test   %eax,%eax
+  8028ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028f2:	0f 49 d0             	cmovns %eax,%edx
+  8028f5:	29 d0                	sub    %edx,%eax
+  8028f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028fa:	eb a6                	jmp    8028a2 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8028fc:	83 ec 08             	sub    $0x8,%esp
+  8028ff:	53                   	push   %ebx
+  802900:	52                   	push   %edx
+  802901:	ff 55 08             	call   *0x8(%ebp)
+  802904:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802907:	89 f1                	mov    %esi,%ecx
+  802909:	8d 71 01             	lea    0x1(%ecx),%esi
+  80290c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802910:	0f be d0             	movsbl %al,%edx
+  802913:	85 d2                	test   %edx,%edx
+  802915:	74 28                	je     80293f <vprintfmt+0x238>
+  802917:	85 ff                	test   %edi,%edi
+  802919:	78 05                	js     802920 <vprintfmt+0x219>
+  80291b:	83 ef 01             	sub    $0x1,%edi
+  80291e:	78 30                	js     802950 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802920:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802924:	74 d6                	je     8028fc <vprintfmt+0x1f5>
+  802926:	0f be c0             	movsbl %al,%eax
+  802929:	83 e8 20             	sub    $0x20,%eax
+  80292c:	83 f8 5e             	cmp    $0x5e,%eax
+  80292f:	76 cb                	jbe    8028fc <vprintfmt+0x1f5>
+					putch('?', putdat);
+  802931:	83 ec 08             	sub    $0x8,%esp
+  802934:	53                   	push   %ebx
+  802935:	6a 3f                	push   $0x3f
+  802937:	ff 55 08             	call   *0x8(%ebp)
+  80293a:	83 c4 10             	add    $0x10,%esp
+  80293d:	eb c8                	jmp    802907 <vprintfmt+0x200>
+  80293f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802942:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802945:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802948:	01 d0                	add    %edx,%eax
+  80294a:	29 c8                	sub    %ecx,%eax
+  80294c:	89 c7                	mov    %eax,%edi
+  80294e:	eb 13                	jmp    802963 <vprintfmt+0x25c>
+  802950:	8b 75 08             	mov    0x8(%ebp),%esi
+  802953:	eb ed                	jmp    802942 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  802955:	83 ec 08             	sub    $0x8,%esp
+  802958:	53                   	push   %ebx
+  802959:	6a 20                	push   $0x20
+  80295b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80295d:	83 ef 01             	sub    $0x1,%edi
+  802960:	83 c4 10             	add    $0x10,%esp
+  802963:	85 ff                	test   %edi,%edi
+  802965:	7f ee                	jg     802955 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802967:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80296a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80296d:	e9 6b 01 00 00       	jmp    802add <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  802972:	83 f9 01             	cmp    $0x1,%ecx
+  802975:	7f 1f                	jg     802996 <vprintfmt+0x28f>
+	else if (lflag)
+  802977:	85 c9                	test   %ecx,%ecx
+  802979:	74 67                	je     8029e2 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80297b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80297e:	8b 00                	mov    (%eax),%eax
+  802980:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802983:	89 c1                	mov    %eax,%ecx
+  802985:	c1 f9 1f             	sar    $0x1f,%ecx
+  802988:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80298b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80298e:	8d 40 04             	lea    0x4(%eax),%eax
+  802991:	89 45 14             	mov    %eax,0x14(%ebp)
+  802994:	eb 17                	jmp    8029ad <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  802996:	8b 45 14             	mov    0x14(%ebp),%eax
+  802999:	8b 50 04             	mov    0x4(%eax),%edx
+  80299c:	8b 00                	mov    (%eax),%eax
+  80299e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029a1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8029a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029a7:	8d 40 08             	lea    0x8(%eax),%eax
+  8029aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8029ad:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029b0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8029b3:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8029b8:	85 c9                	test   %ecx,%ecx
+  8029ba:	0f 89 03 01 00 00    	jns    802ac3 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8029c0:	83 ec 08             	sub    $0x8,%esp
+  8029c3:	53                   	push   %ebx
+  8029c4:	6a 2d                	push   $0x2d
+  8029c6:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8029c8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029cb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8029ce:	f7 da                	neg    %edx
+  8029d0:	83 d1 00             	adc    $0x0,%ecx
+  8029d3:	f7 d9                	neg    %ecx
+  8029d5:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8029d8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029dd:	e9 e1 00 00 00       	jmp    802ac3 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8029e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029e5:	8b 00                	mov    (%eax),%eax
+  8029e7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029ea:	89 c1                	mov    %eax,%ecx
+  8029ec:	c1 f9 1f             	sar    $0x1f,%ecx
+  8029ef:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8029f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8029f8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8029fb:	eb b0                	jmp    8029ad <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8029fd:	83 f9 01             	cmp    $0x1,%ecx
+  802a00:	7f 1e                	jg     802a20 <vprintfmt+0x319>
+	else if (lflag)
+  802a02:	85 c9                	test   %ecx,%ecx
+  802a04:	74 32                	je     802a38 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802a06:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a09:	8b 10                	mov    (%eax),%edx
+  802a0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a10:	8d 40 04             	lea    0x4(%eax),%eax
+  802a13:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a16:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  802a1b:	e9 a3 00 00 00       	jmp    802ac3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a20:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a23:	8b 10                	mov    (%eax),%edx
+  802a25:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a28:	8d 40 08             	lea    0x8(%eax),%eax
+  802a2b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a2e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  802a33:	e9 8b 00 00 00       	jmp    802ac3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a38:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a3b:	8b 10                	mov    (%eax),%edx
+  802a3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a42:	8d 40 04             	lea    0x4(%eax),%eax
+  802a45:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a48:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  802a4d:	eb 74                	jmp    802ac3 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  802a4f:	83 f9 01             	cmp    $0x1,%ecx
+  802a52:	7f 1b                	jg     802a6f <vprintfmt+0x368>
+	else if (lflag)
+  802a54:	85 c9                	test   %ecx,%ecx
+  802a56:	74 2c                	je     802a84 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  802a58:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a5b:	8b 10                	mov    (%eax),%edx
+  802a5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a62:	8d 40 04             	lea    0x4(%eax),%eax
+  802a65:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a68:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  802a6d:	eb 54                	jmp    802ac3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a6f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a72:	8b 10                	mov    (%eax),%edx
+  802a74:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a77:	8d 40 08             	lea    0x8(%eax),%eax
+  802a7a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a7d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  802a82:	eb 3f                	jmp    802ac3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a84:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a87:	8b 10                	mov    (%eax),%edx
+  802a89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a8e:	8d 40 04             	lea    0x4(%eax),%eax
+  802a91:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a94:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802a99:	eb 28                	jmp    802ac3 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  802a9b:	83 ec 08             	sub    $0x8,%esp
+  802a9e:	53                   	push   %ebx
+  802a9f:	6a 30                	push   $0x30
+  802aa1:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802aa3:	83 c4 08             	add    $0x8,%esp
+  802aa6:	53                   	push   %ebx
+  802aa7:	6a 78                	push   $0x78
+  802aa9:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802aab:	8b 45 14             	mov    0x14(%ebp),%eax
+  802aae:	8b 10                	mov    (%eax),%edx
+  802ab0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802ab5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802ab8:	8d 40 04             	lea    0x4(%eax),%eax
+  802abb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802abe:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802ac3:	83 ec 0c             	sub    $0xc,%esp
+  802ac6:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802aca:	50                   	push   %eax
+  802acb:	ff 75 e0             	push   -0x20(%ebp)
+  802ace:	57                   	push   %edi
+  802acf:	51                   	push   %ecx
+  802ad0:	52                   	push   %edx
+  802ad1:	89 da                	mov    %ebx,%edx
+  802ad3:	89 f0                	mov    %esi,%eax
+  802ad5:	e8 4a fb ff ff       	call   802624 <printnum>
+			break;
+  802ada:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802add:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802ae0:	e9 40 fc ff ff       	jmp    802725 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802ae5:	83 f9 01             	cmp    $0x1,%ecx
+  802ae8:	7f 1b                	jg     802b05 <vprintfmt+0x3fe>
+	else if (lflag)
+  802aea:	85 c9                	test   %ecx,%ecx
+  802aec:	74 2c                	je     802b1a <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802aee:	8b 45 14             	mov    0x14(%ebp),%eax
+  802af1:	8b 10                	mov    (%eax),%edx
+  802af3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802af8:	8d 40 04             	lea    0x4(%eax),%eax
+  802afb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802afe:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802b03:	eb be                	jmp    802ac3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802b05:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b08:	8b 10                	mov    (%eax),%edx
+  802b0a:	8b 48 04             	mov    0x4(%eax),%ecx
+  802b0d:	8d 40 08             	lea    0x8(%eax),%eax
+  802b10:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b13:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802b18:	eb a9                	jmp    802ac3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802b1a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b1d:	8b 10                	mov    (%eax),%edx
+  802b1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b24:	8d 40 04             	lea    0x4(%eax),%eax
+  802b27:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b2a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  802b2f:	eb 92                	jmp    802ac3 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  802b31:	83 ec 08             	sub    $0x8,%esp
+  802b34:	53                   	push   %ebx
+  802b35:	6a 25                	push   $0x25
+  802b37:	ff d6                	call   *%esi
+			break;
+  802b39:	83 c4 10             	add    $0x10,%esp
+  802b3c:	eb 9f                	jmp    802add <vprintfmt+0x3d6>
+			putch('%', putdat);
+  802b3e:	83 ec 08             	sub    $0x8,%esp
+  802b41:	53                   	push   %ebx
+  802b42:	6a 25                	push   $0x25
+  802b44:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802b46:	83 c4 10             	add    $0x10,%esp
+  802b49:	89 f8                	mov    %edi,%eax
+  802b4b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802b4f:	74 05                	je     802b56 <vprintfmt+0x44f>
+  802b51:	83 e8 01             	sub    $0x1,%eax
+  802b54:	eb f5                	jmp    802b4b <vprintfmt+0x444>
+  802b56:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b59:	eb 82                	jmp    802add <vprintfmt+0x3d6>
+
+00802b5b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802b5b:	55                   	push   %ebp
+  802b5c:	89 e5                	mov    %esp,%ebp
+  802b5e:	83 ec 18             	sub    $0x18,%esp
+  802b61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b64:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  802b67:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802b6a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802b6e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802b71:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802b78:	85 c0                	test   %eax,%eax
+  802b7a:	74 26                	je     802ba2 <vsnprintf+0x47>
+  802b7c:	85 d2                	test   %edx,%edx
+  802b7e:	7e 22                	jle    802ba2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  802b80:	ff 75 14             	push   0x14(%ebp)
+  802b83:	ff 75 10             	push   0x10(%ebp)
+  802b86:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802b89:	50                   	push   %eax
+  802b8a:	68 cd 26 80 00       	push   $0x8026cd
+  802b8f:	e8 73 fb ff ff       	call   802707 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802b94:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802b97:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802b9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b9d:	83 c4 10             	add    $0x10,%esp
+}
+  802ba0:	c9                   	leave
+  802ba1:	c3                   	ret
+		return -E_INVAL;
+  802ba2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ba7:	eb f7                	jmp    802ba0 <vsnprintf+0x45>
+
+00802ba9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802ba9:	55                   	push   %ebp
+  802baa:	89 e5                	mov    %esp,%ebp
+  802bac:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  802baf:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802bb2:	50                   	push   %eax
+  802bb3:	ff 75 10             	push   0x10(%ebp)
+  802bb6:	ff 75 0c             	push   0xc(%ebp)
+  802bb9:	ff 75 08             	push   0x8(%ebp)
+  802bbc:	e8 9a ff ff ff       	call   802b5b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802bc1:	c9                   	leave
+  802bc2:	c3                   	ret
+
+00802bc3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802bc3:	55                   	push   %ebp
+  802bc4:	89 e5                	mov    %esp,%ebp
+  802bc6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bce:	eb 03                	jmp    802bd3 <strlen+0x10>
+		n++;
+  802bd0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802bd3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802bd7:	75 f7                	jne    802bd0 <strlen+0xd>
+	return n;
+}
+  802bd9:	5d                   	pop    %ebp
+  802bda:	c3                   	ret
+
+00802bdb <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802bdb:	55                   	push   %ebp
+  802bdc:	89 e5                	mov    %esp,%ebp
+  802bde:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802be1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802be4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be9:	eb 03                	jmp    802bee <strnlen+0x13>
+		n++;
+  802beb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802bee:	39 d0                	cmp    %edx,%eax
+  802bf0:	74 08                	je     802bfa <strnlen+0x1f>
+  802bf2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802bf6:	75 f3                	jne    802beb <strnlen+0x10>
+  802bf8:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802bfa:	89 d0                	mov    %edx,%eax
+  802bfc:	5d                   	pop    %ebp
+  802bfd:	c3                   	ret
+
+00802bfe <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802bfe:	55                   	push   %ebp
+  802bff:	89 e5                	mov    %esp,%ebp
+  802c01:	53                   	push   %ebx
+  802c02:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c05:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802c08:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802c11:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802c14:	83 c0 01             	add    $0x1,%eax
+  802c17:	84 d2                	test   %dl,%dl
+  802c19:	75 f2                	jne    802c0d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  802c1b:	89 c8                	mov    %ecx,%eax
+  802c1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c20:	c9                   	leave
+  802c21:	c3                   	ret
+
+00802c22 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802c22:	55                   	push   %ebp
+  802c23:	89 e5                	mov    %esp,%ebp
+  802c25:	53                   	push   %ebx
+  802c26:	83 ec 10             	sub    $0x10,%esp
+  802c29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  802c2c:	53                   	push   %ebx
+  802c2d:	e8 91 ff ff ff       	call   802bc3 <strlen>
+  802c32:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  802c35:	ff 75 0c             	push   0xc(%ebp)
+  802c38:	01 d8                	add    %ebx,%eax
+  802c3a:	50                   	push   %eax
+  802c3b:	e8 be ff ff ff       	call   802bfe <strcpy>
+	return dst;
+}
+  802c40:	89 d8                	mov    %ebx,%eax
+  802c42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c45:	c9                   	leave
+  802c46:	c3                   	ret
+
+00802c47 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802c47:	55                   	push   %ebp
+  802c48:	89 e5                	mov    %esp,%ebp
+  802c4a:	56                   	push   %esi
+  802c4b:	53                   	push   %ebx
+  802c4c:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c4f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  802c52:	89 f3                	mov    %esi,%ebx
+  802c54:	03 5d 10             	add    0x10(%ebp),%ebx
+  802c57:	89 f0                	mov    %esi,%eax
+  802c59:	eb 0f                	jmp    802c6a <strncpy+0x23>
+		*dst++ = *src;
+  802c5b:	83 c0 01             	add    $0x1,%eax
+  802c5e:	0f b6 0a             	movzbl (%edx),%ecx
+  802c61:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  802c64:	80 f9 01             	cmp    $0x1,%cl
+  802c67:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  802c6a:	39 d8                	cmp    %ebx,%eax
+  802c6c:	75 ed                	jne    802c5b <strncpy+0x14>
+	}
+	return ret;
+}
+  802c6e:	89 f0                	mov    %esi,%eax
+  802c70:	5b                   	pop    %ebx
+  802c71:	5e                   	pop    %esi
+  802c72:	5d                   	pop    %ebp
+  802c73:	c3                   	ret
+
+00802c74 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802c74:	55                   	push   %ebp
+  802c75:	89 e5                	mov    %esp,%ebp
+  802c77:	56                   	push   %esi
+  802c78:	53                   	push   %ebx
+  802c79:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c7f:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  802c82:	89 f0                	mov    %esi,%eax
+  802c84:	85 d2                	test   %edx,%edx
+  802c86:	74 21                	je     802ca9 <strlcpy+0x35>
+  802c88:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  802c8c:	89 f2                	mov    %esi,%edx
+  802c8e:	eb 09                	jmp    802c99 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  802c90:	83 c1 01             	add    $0x1,%ecx
+  802c93:	83 c2 01             	add    $0x1,%edx
+  802c96:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  802c99:	39 c2                	cmp    %eax,%edx
+  802c9b:	74 09                	je     802ca6 <strlcpy+0x32>
+  802c9d:	0f b6 19             	movzbl (%ecx),%ebx
+  802ca0:	84 db                	test   %bl,%bl
+  802ca2:	75 ec                	jne    802c90 <strlcpy+0x1c>
+  802ca4:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802ca6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802ca9:	29 f0                	sub    %esi,%eax
+}
+  802cab:	5b                   	pop    %ebx
+  802cac:	5e                   	pop    %esi
+  802cad:	5d                   	pop    %ebp
+  802cae:	c3                   	ret
+
+00802caf <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802caf:	55                   	push   %ebp
+  802cb0:	89 e5                	mov    %esp,%ebp
+  802cb2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802cb5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802cb8:	eb 06                	jmp    802cc0 <strcmp+0x11>
+		p++, q++;
+  802cba:	83 c1 01             	add    $0x1,%ecx
+  802cbd:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802cc0:	0f b6 01             	movzbl (%ecx),%eax
+  802cc3:	84 c0                	test   %al,%al
+  802cc5:	74 04                	je     802ccb <strcmp+0x1c>
+  802cc7:	3a 02                	cmp    (%edx),%al
+  802cc9:	74 ef                	je     802cba <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802ccb:	0f b6 c0             	movzbl %al,%eax
+  802cce:	0f b6 12             	movzbl (%edx),%edx
+  802cd1:	29 d0                	sub    %edx,%eax
+}
+  802cd3:	5d                   	pop    %ebp
+  802cd4:	c3                   	ret
+
+00802cd5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802cd5:	55                   	push   %ebp
+  802cd6:	89 e5                	mov    %esp,%ebp
+  802cd8:	53                   	push   %ebx
+  802cd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cdf:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802ce2:	eb 09                	jmp    802ced <strncmp+0x18>
+		n--, p++, q++;
+  802ce4:	83 ea 01             	sub    $0x1,%edx
+  802ce7:	83 c0 01             	add    $0x1,%eax
+  802cea:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802ced:	85 d2                	test   %edx,%edx
+  802cef:	74 18                	je     802d09 <strncmp+0x34>
+  802cf1:	0f b6 18             	movzbl (%eax),%ebx
+  802cf4:	84 db                	test   %bl,%bl
+  802cf6:	74 04                	je     802cfc <strncmp+0x27>
+  802cf8:	3a 19                	cmp    (%ecx),%bl
+  802cfa:	74 e8                	je     802ce4 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802cfc:	0f b6 00             	movzbl (%eax),%eax
+  802cff:	0f b6 11             	movzbl (%ecx),%edx
+  802d02:	29 d0                	sub    %edx,%eax
+}
+  802d04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d07:	c9                   	leave
+  802d08:	c3                   	ret
+		return 0;
+  802d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0e:	eb f4                	jmp    802d04 <strncmp+0x2f>
+
+00802d10 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802d10:	55                   	push   %ebp
+  802d11:	89 e5                	mov    %esp,%ebp
+  802d13:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d16:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d1a:	eb 03                	jmp    802d1f <strchr+0xf>
+  802d1c:	83 c0 01             	add    $0x1,%eax
+  802d1f:	0f b6 10             	movzbl (%eax),%edx
+  802d22:	84 d2                	test   %dl,%dl
+  802d24:	74 06                	je     802d2c <strchr+0x1c>
+		if (*s == c)
+  802d26:	38 ca                	cmp    %cl,%dl
+  802d28:	75 f2                	jne    802d1c <strchr+0xc>
+  802d2a:	eb 05                	jmp    802d31 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  802d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d31:	5d                   	pop    %ebp
+  802d32:	c3                   	ret
+
+00802d33 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802d33:	55                   	push   %ebp
+  802d34:	89 e5                	mov    %esp,%ebp
+  802d36:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d39:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d3d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  802d40:	38 ca                	cmp    %cl,%dl
+  802d42:	74 09                	je     802d4d <strfind+0x1a>
+  802d44:	84 d2                	test   %dl,%dl
+  802d46:	74 05                	je     802d4d <strfind+0x1a>
+	for (; *s; s++)
+  802d48:	83 c0 01             	add    $0x1,%eax
+  802d4b:	eb f0                	jmp    802d3d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  802d4d:	5d                   	pop    %ebp
+  802d4e:	c3                   	ret
+
+00802d4f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802d4f:	55                   	push   %ebp
+  802d50:	89 e5                	mov    %esp,%ebp
+  802d52:	57                   	push   %edi
+  802d53:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d56:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  802d59:	85 c9                	test   %ecx,%ecx
+  802d5b:	74 20                	je     802d7d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  802d5d:	89 f8                	mov    %edi,%eax
+  802d5f:	09 c8                	or     %ecx,%eax
+  802d61:	a8 03                	test   $0x3,%al
+  802d63:	75 12                	jne    802d77 <memset+0x28>
+		c &= 0xFF;
+  802d65:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802d69:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  802d6f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  802d72:	fc                   	cld
+  802d73:	f3 ab                	rep stos %eax,%es:(%edi)
+  802d75:	eb 06                	jmp    802d7d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  802d77:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d7a:	fc                   	cld
+  802d7b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  802d7d:	89 f8                	mov    %edi,%eax
+  802d7f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802d82:	c9                   	leave
+  802d83:	c3                   	ret
+
+00802d84 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  802d84:	55                   	push   %ebp
+  802d85:	89 e5                	mov    %esp,%ebp
+  802d87:	57                   	push   %edi
+  802d88:	56                   	push   %esi
+  802d89:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d8c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d8f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  802d92:	39 c6                	cmp    %eax,%esi
+  802d94:	73 32                	jae    802dc8 <memmove+0x44>
+  802d96:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802d99:	39 d0                	cmp    %edx,%eax
+  802d9b:	73 2b                	jae    802dc8 <memmove+0x44>
+		s += n;
+		d += n;
+  802d9d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802da0:	89 d6                	mov    %edx,%esi
+  802da2:	09 fe                	or     %edi,%esi
+  802da4:	09 ce                	or     %ecx,%esi
+  802da6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802dac:	75 0e                	jne    802dbc <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802dae:	83 ef 04             	sub    $0x4,%edi
+  802db1:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802db4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802db7:	fd                   	std
+  802db8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802dba:	eb 09                	jmp    802dc5 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802dbc:	83 ef 01             	sub    $0x1,%edi
+  802dbf:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802dc2:	fd                   	std
+  802dc3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802dc5:	fc                   	cld
+  802dc6:	eb 1a                	jmp    802de2 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802dc8:	89 f2                	mov    %esi,%edx
+  802dca:	09 c2                	or     %eax,%edx
+  802dcc:	09 ca                	or     %ecx,%edx
+  802dce:	f6 c2 03             	test   $0x3,%dl
+  802dd1:	75 0a                	jne    802ddd <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802dd3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802dd6:	89 c7                	mov    %eax,%edi
+  802dd8:	fc                   	cld
+  802dd9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802ddb:	eb 05                	jmp    802de2 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802ddd:	89 c7                	mov    %eax,%edi
+  802ddf:	fc                   	cld
+  802de0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802de2:	5e                   	pop    %esi
+  802de3:	5f                   	pop    %edi
+  802de4:	5d                   	pop    %ebp
+  802de5:	c3                   	ret
+
+00802de6 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802de6:	55                   	push   %ebp
+  802de7:	89 e5                	mov    %esp,%ebp
+  802de9:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802dec:	ff 75 10             	push   0x10(%ebp)
+  802def:	ff 75 0c             	push   0xc(%ebp)
+  802df2:	ff 75 08             	push   0x8(%ebp)
+  802df5:	e8 8a ff ff ff       	call   802d84 <memmove>
+}
+  802dfa:	c9                   	leave
+  802dfb:	c3                   	ret
+
+00802dfc <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802dfc:	55                   	push   %ebp
+  802dfd:	89 e5                	mov    %esp,%ebp
+  802dff:	56                   	push   %esi
+  802e00:	53                   	push   %ebx
+  802e01:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e04:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802e07:	89 c6                	mov    %eax,%esi
+  802e09:	03 75 10             	add    0x10(%ebp),%esi
+  802e0c:	eb 06                	jmp    802e14 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802e0e:	83 c0 01             	add    $0x1,%eax
+  802e11:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802e14:	39 f0                	cmp    %esi,%eax
+  802e16:	74 14                	je     802e2c <memcmp+0x30>
+		if (*s1 != *s2)
+  802e18:	0f b6 08             	movzbl (%eax),%ecx
+  802e1b:	0f b6 1a             	movzbl (%edx),%ebx
+  802e1e:	38 d9                	cmp    %bl,%cl
+  802e20:	74 ec                	je     802e0e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802e22:	0f b6 c1             	movzbl %cl,%eax
+  802e25:	0f b6 db             	movzbl %bl,%ebx
+  802e28:	29 d8                	sub    %ebx,%eax
+  802e2a:	eb 05                	jmp    802e31 <memcmp+0x35>
+	}
+
+	return 0;
+  802e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e31:	5b                   	pop    %ebx
+  802e32:	5e                   	pop    %esi
+  802e33:	5d                   	pop    %ebp
+  802e34:	c3                   	ret
+
+00802e35 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802e35:	55                   	push   %ebp
+  802e36:	89 e5                	mov    %esp,%ebp
+  802e38:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802e3e:	89 c2                	mov    %eax,%edx
+  802e40:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802e43:	eb 03                	jmp    802e48 <memfind+0x13>
+  802e45:	83 c0 01             	add    $0x1,%eax
+  802e48:	39 d0                	cmp    %edx,%eax
+  802e4a:	73 04                	jae    802e50 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802e4c:	38 08                	cmp    %cl,(%eax)
+  802e4e:	75 f5                	jne    802e45 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802e50:	5d                   	pop    %ebp
+  802e51:	c3                   	ret
+
+00802e52 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802e52:	55                   	push   %ebp
+  802e53:	89 e5                	mov    %esp,%ebp
+  802e55:	57                   	push   %edi
+  802e56:	56                   	push   %esi
+  802e57:	53                   	push   %ebx
+  802e58:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e5b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802e5e:	eb 03                	jmp    802e63 <strtol+0x11>
+		s++;
+  802e60:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802e63:	0f b6 02             	movzbl (%edx),%eax
+  802e66:	3c 20                	cmp    $0x20,%al
+  802e68:	74 f6                	je     802e60 <strtol+0xe>
+  802e6a:	3c 09                	cmp    $0x9,%al
+  802e6c:	74 f2                	je     802e60 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802e6e:	3c 2b                	cmp    $0x2b,%al
+  802e70:	74 2a                	je     802e9c <strtol+0x4a>
+	int neg = 0;
+  802e72:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802e77:	3c 2d                	cmp    $0x2d,%al
+  802e79:	74 2b                	je     802ea6 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802e7b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802e81:	75 0f                	jne    802e92 <strtol+0x40>
+  802e83:	80 3a 30             	cmpb   $0x30,(%edx)
+  802e86:	74 28                	je     802eb0 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802e88:	85 db                	test   %ebx,%ebx
+  802e8a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802e8f:	0f 44 d8             	cmove  %eax,%ebx
+  802e92:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e97:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802e9a:	eb 46                	jmp    802ee2 <strtol+0x90>
+		s++;
+  802e9c:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802e9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ea4:	eb d5                	jmp    802e7b <strtol+0x29>
+		s++, neg = 1;
+  802ea6:	83 c2 01             	add    $0x1,%edx
+  802ea9:	bf 01 00 00 00       	mov    $0x1,%edi
+  802eae:	eb cb                	jmp    802e7b <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802eb0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802eb4:	74 0e                	je     802ec4 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802eb6:	85 db                	test   %ebx,%ebx
+  802eb8:	75 d8                	jne    802e92 <strtol+0x40>
+		s++, base = 8;
+  802eba:	83 c2 01             	add    $0x1,%edx
+  802ebd:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802ec2:	eb ce                	jmp    802e92 <strtol+0x40>
+		s += 2, base = 16;
+  802ec4:	83 c2 02             	add    $0x2,%edx
+  802ec7:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802ecc:	eb c4                	jmp    802e92 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802ece:	0f be c0             	movsbl %al,%eax
+  802ed1:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802ed4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802ed7:	7d 3a                	jge    802f13 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802ed9:	83 c2 01             	add    $0x1,%edx
+  802edc:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802ee0:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802ee2:	0f b6 02             	movzbl (%edx),%eax
+  802ee5:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802ee8:	89 f3                	mov    %esi,%ebx
+  802eea:	80 fb 09             	cmp    $0x9,%bl
+  802eed:	76 df                	jbe    802ece <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  802eef:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802ef2:	89 f3                	mov    %esi,%ebx
+  802ef4:	80 fb 19             	cmp    $0x19,%bl
+  802ef7:	77 08                	ja     802f01 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802ef9:	0f be c0             	movsbl %al,%eax
+  802efc:	83 e8 57             	sub    $0x57,%eax
+  802eff:	eb d3                	jmp    802ed4 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802f01:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802f04:	89 f3                	mov    %esi,%ebx
+  802f06:	80 fb 19             	cmp    $0x19,%bl
+  802f09:	77 08                	ja     802f13 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802f0b:	0f be c0             	movsbl %al,%eax
+  802f0e:	83 e8 37             	sub    $0x37,%eax
+  802f11:	eb c1                	jmp    802ed4 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802f13:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802f17:	74 05                	je     802f1e <strtol+0xcc>
+		*endptr = (char *) s;
+  802f19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f1c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802f1e:	89 c8                	mov    %ecx,%eax
+  802f20:	f7 d8                	neg    %eax
+  802f22:	85 ff                	test   %edi,%edi
+  802f24:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802f27:	89 c8                	mov    %ecx,%eax
+  802f29:	5b                   	pop    %ebx
+  802f2a:	5e                   	pop    %esi
+  802f2b:	5f                   	pop    %edi
+  802f2c:	5d                   	pop    %ebp
+  802f2d:	c3                   	ret
+
+00802f2e <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802f2e:	55                   	push   %ebp
+  802f2f:	89 e5                	mov    %esp,%ebp
+  802f31:	57                   	push   %edi
+  802f32:	56                   	push   %esi
+  802f33:	53                   	push   %ebx
+  802f34:	83 ec 20             	sub    $0x20,%esp
+  802f37:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f3a:	89 d7                	mov    %edx,%edi
+  802f3c:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802f3e:	51                   	push   %ecx
+  802f3f:	68 00 f0 7f 00       	push   $0x7ff000
+  802f44:	6a 00                	push   $0x0
+  802f46:	e8 2e d2 ff ff       	call   800179 <sys_page_alloc>
+  802f4b:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f4d:	83 c4 10             	add    $0x10,%esp
+  802f50:	85 c0                	test   %eax,%eax
+  802f52:	78 45                	js     802f99 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802f54:	83 ec 04             	sub    $0x4,%esp
+  802f57:	68 00 10 00 00       	push   $0x1000
+  802f5c:	57                   	push   %edi
+  802f5d:	68 00 f0 7f 00       	push   $0x7ff000
+  802f62:	e8 1d fe ff ff       	call   802d84 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  802f67:	89 34 24             	mov    %esi,(%esp)
+  802f6a:	57                   	push   %edi
+  802f6b:	ff 75 e4             	push   -0x1c(%ebp)
+  802f6e:	68 00 f0 7f 00       	push   $0x7ff000
+  802f73:	6a 00                	push   $0x0
+  802f75:	e8 4a d2 ff ff       	call   8001c4 <sys_page_map>
+  802f7a:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f7c:	83 c4 20             	add    $0x20,%esp
+  802f7f:	85 c0                	test   %eax,%eax
+  802f81:	78 16                	js     802f99 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802f83:	83 ec 08             	sub    $0x8,%esp
+  802f86:	68 00 f0 7f 00       	push   $0x7ff000
+  802f8b:	6a 00                	push   $0x0
+  802f8d:	e8 74 d2 ff ff       	call   800206 <sys_page_unmap>
+  802f92:	83 c4 10             	add    $0x10,%esp
+  802f95:	85 c0                	test   %eax,%eax
+  802f97:	75 0a                	jne    802fa3 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  802f99:	89 d8                	mov    %ebx,%eax
+  802f9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f9e:	5b                   	pop    %ebx
+  802f9f:	5e                   	pop    %esi
+  802fa0:	5f                   	pop    %edi
+  802fa1:	5d                   	pop    %ebp
+  802fa2:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802fa3:	68 28 3c 80 00       	push   $0x803c28
+  802fa8:	68 24 38 80 00       	push   $0x803824
+  802fad:	6a 1b                	push   $0x1b
+  802faf:	68 a0 3c 80 00       	push   $0x803ca0
+  802fb4:	e8 7c f5 ff ff       	call   802535 <_panic>
+
+00802fb9 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802fb9:	55                   	push   %ebp
+  802fba:	89 e5                	mov    %esp,%ebp
+  802fbc:	53                   	push   %ebx
+  802fbd:	83 ec 04             	sub    $0x4,%esp
+  802fc0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  802fc3:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802fc5:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  802fc9:	74 21                	je     802fec <pgfault+0x33>
+  802fcb:	89 d0                	mov    %edx,%eax
+  802fcd:	c1 e8 16             	shr    $0x16,%eax
+  802fd0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802fd7:	a8 01                	test   $0x1,%al
+  802fd9:	74 11                	je     802fec <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  802fdb:	89 d0                	mov    %edx,%eax
+  802fdd:	c1 e8 0c             	shr    $0xc,%eax
+  802fe0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802fe7:	f6 c4 08             	test   $0x8,%ah
+  802fea:	75 17                	jne    803003 <pgfault+0x4a>
+		if (pgfault_next) {
+  802fec:	a1 04 90 80 00       	mov    0x809004,%eax
+  802ff1:	85 c0                	test   %eax,%eax
+  802ff3:	74 27                	je     80301c <pgfault+0x63>
+			pgfault_next(utf);
+  802ff5:	83 ec 0c             	sub    $0xc,%esp
+  802ff8:	53                   	push   %ebx
+  802ff9:	ff d0                	call   *%eax
+			return;
+  802ffb:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  802ffe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803001:	c9                   	leave
+  803002:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803003:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803009:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80300e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803013:	e8 16 ff ff ff       	call   802f2e <copy_page_to>
+  803018:	85 c0                	test   %eax,%eax
+  80301a:	79 e2                	jns    802ffe <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  80301c:	a1 00 50 80 00       	mov    0x805000,%eax
+  803021:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803024:	ff 73 28             	push   0x28(%ebx)
+  803027:	ff 33                	push   (%ebx)
+  803029:	50                   	push   %eax
+  80302a:	68 4c 3c 80 00       	push   $0x803c4c
+  80302f:	e8 dc f5 ff ff       	call   802610 <cprintf>
+	sys_env_destroy(0);
+  803034:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80303b:	e8 aa d0 ff ff       	call   8000ea <sys_env_destroy>
+  803040:	83 c4 10             	add    $0x10,%esp
+  803043:	eb b9                	jmp    802ffe <pgfault+0x45>
+
+00803045 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803045:	55                   	push   %ebp
+  803046:	89 e5                	mov    %esp,%ebp
+  803048:	53                   	push   %ebx
+  803049:	83 ec 04             	sub    $0x4,%esp
+  80304c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80304f:	a1 08 90 80 00       	mov    0x809008,%eax
+  803054:	3d b9 2f 80 00       	cmp    $0x802fb9,%eax
+  803059:	74 15                	je     803070 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80305b:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  803060:	83 ec 0c             	sub    $0xc,%esp
+  803063:	68 b9 2f 80 00       	push   $0x802fb9
+  803068:	e8 fb 03 00 00       	call   803468 <set_pgfault_handler>
+  80306d:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803070:	83 ec 0c             	sub    $0xc,%esp
+  803073:	68 05 08 00 00       	push   $0x805
+  803078:	53                   	push   %ebx
+  803079:	6a 00                	push   $0x0
+  80307b:	53                   	push   %ebx
+  80307c:	6a 00                	push   $0x0
+  80307e:	e8 41 d1 ff ff       	call   8001c4 <sys_page_map>
+}
+  803083:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803086:	c9                   	leave
+  803087:	c3                   	ret
+
+00803088 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803088:	55                   	push   %ebp
+  803089:	89 e5                	mov    %esp,%ebp
+  80308b:	57                   	push   %edi
+  80308c:	56                   	push   %esi
+  80308d:	53                   	push   %ebx
+  80308e:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  803091:	68 b9 2f 80 00       	push   $0x802fb9
+  803096:	e8 cd 03 00 00       	call   803468 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80309b:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030a0:	cd 30                	int    $0x30
+  8030a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8030a8:	83 c4 10             	add    $0x10,%esp
+  8030ab:	85 c0                	test   %eax,%eax
+  8030ad:	0f 88 6b 01 00 00    	js     80321e <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8030b8:	75 37                	jne    8030f1 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8030ba:	e8 74 d0 ff ff       	call   800133 <sys_getenvid>
+  8030bf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030c4:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8030ca:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8030cf:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8030d4:	e9 45 01 00 00       	jmp    80321e <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8030d9:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030df:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8030e5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8030eb:	0f 87 ba 00 00 00    	ja     8031ab <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8030f1:	89 d8                	mov    %ebx,%eax
+  8030f3:	c1 e8 16             	shr    $0x16,%eax
+  8030f6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8030fd:	a8 01                	test   $0x1,%al
+  8030ff:	74 d8                	je     8030d9 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803101:	89 d8                	mov    %ebx,%eax
+  803103:	c1 e8 0c             	shr    $0xc,%eax
+  803106:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80310d:	f6 c2 01             	test   $0x1,%dl
+  803110:	74 cd                	je     8030df <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803112:	89 da                	mov    %ebx,%edx
+  803114:	80 e6 df             	and    $0xdf,%dh
+  803117:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  80311d:	74 c0                	je     8030df <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  80311f:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803121:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803128:	f6 c6 04             	test   $0x4,%dh
+  80312b:	75 53                	jne    803180 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80312d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803134:	f6 c6 08             	test   $0x8,%dh
+  803137:	75 0c                	jne    803145 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803139:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803140:	f6 c2 02             	test   $0x2,%dl
+  803143:	74 3b                	je     803180 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803145:	83 ec 0c             	sub    $0xc,%esp
+  803148:	68 05 08 00 00       	push   $0x805
+  80314d:	57                   	push   %edi
+  80314e:	ff 75 e4             	push   -0x1c(%ebp)
+  803151:	57                   	push   %edi
+  803152:	6a 00                	push   $0x0
+  803154:	e8 6b d0 ff ff       	call   8001c4 <sys_page_map>
+  803159:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80315b:	83 c4 20             	add    $0x20,%esp
+  80315e:	85 c0                	test   %eax,%eax
+  803160:	0f 88 a7 00 00 00    	js     80320d <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803166:	83 ec 0c             	sub    $0xc,%esp
+  803169:	68 05 08 00 00       	push   $0x805
+  80316e:	57                   	push   %edi
+  80316f:	6a 00                	push   $0x0
+  803171:	57                   	push   %edi
+  803172:	6a 00                	push   $0x0
+  803174:	e8 4b d0 ff ff       	call   8001c4 <sys_page_map>
+  803179:	89 c6                	mov    %eax,%esi
+	return r;
+  80317b:	83 c4 20             	add    $0x20,%esp
+  80317e:	eb 21                	jmp    8031a1 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803180:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803187:	83 ec 0c             	sub    $0xc,%esp
+  80318a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80318f:	50                   	push   %eax
+  803190:	57                   	push   %edi
+  803191:	ff 75 e4             	push   -0x1c(%ebp)
+  803194:	57                   	push   %edi
+  803195:	6a 00                	push   $0x0
+  803197:	e8 28 d0 ff ff       	call   8001c4 <sys_page_map>
+  80319c:	89 c6                	mov    %eax,%esi
+  80319e:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8031a1:	85 f6                	test   %esi,%esi
+  8031a3:	0f 89 36 ff ff ff    	jns    8030df <fork+0x57>
+  8031a9:	eb 62                	jmp    80320d <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031ab:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031b0:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8031b5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8031b8:	89 f8                	mov    %edi,%eax
+  8031ba:	e8 6f fd ff ff       	call   802f2e <copy_page_to>
+  8031bf:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031c1:	85 c0                	test   %eax,%eax
+  8031c3:	78 48                	js     80320d <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031c5:	83 ec 04             	sub    $0x4,%esp
+  8031c8:	6a 07                	push   $0x7
+  8031ca:	68 00 f0 bf ee       	push   $0xeebff000
+  8031cf:	57                   	push   %edi
+  8031d0:	e8 a4 cf ff ff       	call   800179 <sys_page_alloc>
+  8031d5:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031d7:	83 c4 10             	add    $0x10,%esp
+  8031da:	85 c0                	test   %eax,%eax
+  8031dc:	78 2f                	js     80320d <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8031de:	a1 00 50 80 00       	mov    0x805000,%eax
+  8031e3:	8b 40 64             	mov    0x64(%eax),%eax
+  8031e6:	83 ec 08             	sub    $0x8,%esp
+  8031e9:	50                   	push   %eax
+  8031ea:	57                   	push   %edi
+  8031eb:	e8 f4 d0 ff ff       	call   8002e4 <sys_env_set_pgfault_upcall>
+  8031f0:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031f2:	83 c4 10             	add    $0x10,%esp
+  8031f5:	85 c0                	test   %eax,%eax
+  8031f7:	78 14                	js     80320d <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8031f9:	83 ec 08             	sub    $0x8,%esp
+  8031fc:	6a 02                	push   $0x2
+  8031fe:	57                   	push   %edi
+  8031ff:	e8 4c d0 ff ff       	call   800250 <sys_env_set_status>
+  803204:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803206:	83 c4 10             	add    $0x10,%esp
+  803209:	85 c0                	test   %eax,%eax
+  80320b:	79 11                	jns    80321e <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  80320d:	83 ec 0c             	sub    $0xc,%esp
+  803210:	ff 75 e0             	push   -0x20(%ebp)
+  803213:	e8 d2 ce ff ff       	call   8000ea <sys_env_destroy>
+	return r;
+  803218:	83 c4 10             	add    $0x10,%esp
+  80321b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  80321e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803221:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803224:	5b                   	pop    %ebx
+  803225:	5e                   	pop    %esi
+  803226:	5f                   	pop    %edi
+  803227:	5d                   	pop    %ebp
+  803228:	c3                   	ret
+
+00803229 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803229:	55                   	push   %ebp
+  80322a:	89 e5                	mov    %esp,%ebp
+  80322c:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80322f:	68 ab 3c 80 00       	push   $0x803cab
+  803234:	68 bf 00 00 00       	push   $0xbf
+  803239:	68 a0 3c 80 00       	push   $0x803ca0
+  80323e:	e8 f2 f2 ff ff       	call   802535 <_panic>
+
+00803243 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803243:	55                   	push   %ebp
+  803244:	89 e5                	mov    %esp,%ebp
+  803246:	56                   	push   %esi
+  803247:	53                   	push   %ebx
+  803248:	8b 75 08             	mov    0x8(%ebp),%esi
+  80324b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80324e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803251:	85 c0                	test   %eax,%eax
+  803253:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803258:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80325b:	83 ec 0c             	sub    $0xc,%esp
+  80325e:	50                   	push   %eax
+  80325f:	e8 5d d1 ff ff       	call   8003c1 <sys_ipc_recv>
+	if (from_env_store)
+  803264:	83 c4 10             	add    $0x10,%esp
+  803267:	85 f6                	test   %esi,%esi
+  803269:	74 14                	je     80327f <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80326b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803270:	85 c0                	test   %eax,%eax
+  803272:	75 09                	jne    80327d <ipc_recv+0x3a>
+  803274:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80327a:	8b 52 74             	mov    0x74(%edx),%edx
+  80327d:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  80327f:	85 db                	test   %ebx,%ebx
+  803281:	74 25                	je     8032a8 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803283:	85 c0                	test   %eax,%eax
+  803285:	74 0d                	je     803294 <ipc_recv+0x51>
+  803287:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  80328d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803290:	5b                   	pop    %ebx
+  803291:	5e                   	pop    %esi
+  803292:	5d                   	pop    %ebp
+  803293:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803294:	a1 00 50 80 00       	mov    0x805000,%eax
+  803299:	8b 40 78             	mov    0x78(%eax),%eax
+  80329c:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  80329e:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032a3:	8b 40 70             	mov    0x70(%eax),%eax
+  8032a6:	eb e5                	jmp    80328d <ipc_recv+0x4a>
+  8032a8:	85 c0                	test   %eax,%eax
+  8032aa:	75 e1                	jne    80328d <ipc_recv+0x4a>
+  8032ac:	eb f0                	jmp    80329e <ipc_recv+0x5b>
+
+008032ae <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8032ae:	55                   	push   %ebp
+  8032af:	89 e5                	mov    %esp,%ebp
+  8032b1:	57                   	push   %edi
+  8032b2:	56                   	push   %esi
+  8032b3:	53                   	push   %ebx
+  8032b4:	83 ec 0c             	sub    $0xc,%esp
+  8032b7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032ba:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032c0:	85 db                	test   %ebx,%ebx
+  8032c2:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032c7:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8032ca:	ff 75 14             	push   0x14(%ebp)
+  8032cd:	53                   	push   %ebx
+  8032ce:	56                   	push   %esi
+  8032cf:	57                   	push   %edi
+  8032d0:	e8 59 d0 ff ff       	call   80032e <sys_ipc_try_send>
+  8032d5:	83 c4 10             	add    $0x10,%esp
+  8032d8:	85 c0                	test   %eax,%eax
+  8032da:	74 22                	je     8032fe <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8032dc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032df:	75 07                	jne    8032e8 <ipc_send+0x3a>
+		sys_yield();
+  8032e1:	e8 74 ce ff ff       	call   80015a <sys_yield>
+  8032e6:	eb e2                	jmp    8032ca <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8032e8:	68 c1 3c 80 00       	push   $0x803cc1
+  8032ed:	68 24 38 80 00       	push   $0x803824
+  8032f2:	6a 39                	push   $0x39
+  8032f4:	68 d6 3c 80 00       	push   $0x803cd6
+  8032f9:	e8 37 f2 ff ff       	call   802535 <_panic>
+	}
+}
+  8032fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803301:	5b                   	pop    %ebx
+  803302:	5e                   	pop    %esi
+  803303:	5f                   	pop    %edi
+  803304:	5d                   	pop    %ebp
+  803305:	c3                   	ret
+
+00803306 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803306:	55                   	push   %ebp
+  803307:	89 e5                	mov    %esp,%ebp
+  803309:	57                   	push   %edi
+  80330a:	56                   	push   %esi
+  80330b:	53                   	push   %ebx
+  80330c:	83 ec 10             	sub    $0x10,%esp
+  80330f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803312:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803315:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803318:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80331b:	85 c0                	test   %eax,%eax
+  80331d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803322:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803325:	6a 00                	push   $0x0
+  803327:	ff 33                	push   (%ebx)
+  803329:	50                   	push   %eax
+  80332a:	e8 4f d0 ff ff       	call   80037e <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80332f:	83 c4 10             	add    $0x10,%esp
+  803332:	85 c0                	test   %eax,%eax
+  803334:	75 3c                	jne    803372 <ipc_recvv+0x6c>
+  803336:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80333c:	8b 52 7c             	mov    0x7c(%edx),%edx
+  80333f:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803341:	85 ff                	test   %edi,%edi
+  803343:	74 4e                	je     803393 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803345:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80334b:	8b 52 74             	mov    0x74(%edx),%edx
+  80334e:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803350:	85 f6                	test   %esi,%esi
+  803352:	74 18                	je     80336c <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803354:	85 c0                	test   %eax,%eax
+  803356:	75 2d                	jne    803385 <ipc_recvv+0x7f>
+  803358:	a1 00 50 80 00       	mov    0x805000,%eax
+  80335d:	8b 40 78             	mov    0x78(%eax),%eax
+  803360:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803362:	a1 00 50 80 00       	mov    0x805000,%eax
+  803367:	8b 40 70             	mov    0x70(%eax),%eax
+  80336a:	eb 1f                	jmp    80338b <ipc_recvv+0x85>
+  80336c:	85 c0                	test   %eax,%eax
+  80336e:	75 1b                	jne    80338b <ipc_recvv+0x85>
+  803370:	eb f0                	jmp    803362 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803372:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803378:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  80337d:	85 ff                	test   %edi,%edi
+  80337f:	75 cd                	jne    80334e <ipc_recvv+0x48>
+	if (perm_store)
+  803381:	85 f6                	test   %esi,%esi
+  803383:	74 e7                	je     80336c <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803385:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80338b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80338e:	5b                   	pop    %ebx
+  80338f:	5e                   	pop    %esi
+  803390:	5f                   	pop    %edi
+  803391:	5d                   	pop    %ebp
+  803392:	c3                   	ret
+	if (perm_store)
+  803393:	85 f6                	test   %esi,%esi
+  803395:	75 bd                	jne    803354 <ipc_recvv+0x4e>
+  803397:	eb c9                	jmp    803362 <ipc_recvv+0x5c>
+
+00803399 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803399:	55                   	push   %ebp
+  80339a:	89 e5                	mov    %esp,%ebp
+  80339c:	57                   	push   %edi
+  80339d:	56                   	push   %esi
+  80339e:	53                   	push   %ebx
+  80339f:	83 ec 0c             	sub    $0xc,%esp
+  8033a2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033a5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8033ab:	ff 75 14             	push   0x14(%ebp)
+  8033ae:	53                   	push   %ebx
+  8033af:	56                   	push   %esi
+  8033b0:	57                   	push   %edi
+  8033b1:	e8 a0 cf ff ff       	call   800356 <sys_ipc_try_sendv>
+  8033b6:	83 c4 10             	add    $0x10,%esp
+  8033b9:	85 c0                	test   %eax,%eax
+  8033bb:	74 22                	je     8033df <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8033bd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033c0:	75 07                	jne    8033c9 <ipc_sendv+0x30>
+		sys_yield();
+  8033c2:	e8 93 cd ff ff       	call   80015a <sys_yield>
+  8033c7:	eb e2                	jmp    8033ab <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8033c9:	68 c1 3c 80 00       	push   $0x803cc1
+  8033ce:	68 24 38 80 00       	push   $0x803824
+  8033d3:	6a 5c                	push   $0x5c
+  8033d5:	68 d6 3c 80 00       	push   $0x803cd6
+  8033da:	e8 56 f1 ff ff       	call   802535 <_panic>
+	}
+}
+  8033df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033e2:	5b                   	pop    %ebx
+  8033e3:	5e                   	pop    %esi
+  8033e4:	5f                   	pop    %edi
+  8033e5:	5d                   	pop    %ebp
+  8033e6:	c3                   	ret
+
+008033e7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8033e7:	55                   	push   %ebp
+  8033e8:	89 e5                	mov    %esp,%ebp
+  8033ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8033ed:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8033f2:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8033f8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8033fe:	8b 52 50             	mov    0x50(%edx),%edx
+  803401:	39 ca                	cmp    %ecx,%edx
+  803403:	74 11                	je     803416 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803405:	83 c0 01             	add    $0x1,%eax
+  803408:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80340d:	75 e3                	jne    8033f2 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80340f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803414:	eb 0e                	jmp    803424 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803416:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80341c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803421:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803424:	5d                   	pop    %ebp
+  803425:	c3                   	ret
+
+00803426 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803426:	55                   	push   %ebp
+  803427:	89 e5                	mov    %esp,%ebp
+  803429:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80342c:	89 c2                	mov    %eax,%edx
+  80342e:	c1 ea 16             	shr    $0x16,%edx
+  803431:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803438:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80343d:	f6 c1 01             	test   $0x1,%cl
+  803440:	74 22                	je     803464 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803442:	c1 e8 0c             	shr    $0xc,%eax
+  803445:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80344c:	a8 01                	test   $0x1,%al
+  80344e:	74 14                	je     803464 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803450:	c1 e8 0c             	shr    $0xc,%eax
+  803453:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803456:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80345d:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803461:	0f b7 d2             	movzwl %dx,%edx
+}
+  803464:	89 d0                	mov    %edx,%eax
+  803466:	5d                   	pop    %ebp
+  803467:	c3                   	ret
+
+00803468 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803468:	55                   	push   %ebp
+  803469:	89 e5                	mov    %esp,%ebp
+  80346b:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  80346e:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  803475:	74 0a                	je     803481 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803477:	8b 45 08             	mov    0x8(%ebp),%eax
+  80347a:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  80347f:	c9                   	leave
+  803480:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803481:	83 ec 04             	sub    $0x4,%esp
+  803484:	6a 07                	push   $0x7
+  803486:	68 00 f0 bf ee       	push   $0xeebff000
+  80348b:	6a 00                	push   $0x0
+  80348d:	e8 e7 cc ff ff       	call   800179 <sys_page_alloc>
+  803492:	83 c4 10             	add    $0x10,%esp
+  803495:	85 c0                	test   %eax,%eax
+  803497:	75 2c                	jne    8034c5 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803499:	83 ec 08             	sub    $0x8,%esp
+  80349c:	68 db 34 80 00       	push   $0x8034db
+  8034a1:	6a 00                	push   $0x0
+  8034a3:	e8 3c ce ff ff       	call   8002e4 <sys_env_set_pgfault_upcall>
+  8034a8:	83 c4 10             	add    $0x10,%esp
+  8034ab:	85 c0                	test   %eax,%eax
+  8034ad:	74 c8                	je     803477 <set_pgfault_handler+0xf>
+  8034af:	68 28 3d 80 00       	push   $0x803d28
+  8034b4:	68 24 38 80 00       	push   $0x803824
+  8034b9:	6a 20                	push   $0x20
+  8034bb:	68 58 3d 80 00       	push   $0x803d58
+  8034c0:	e8 70 f0 ff ff       	call   802535 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034c5:	68 e0 3c 80 00       	push   $0x803ce0
+  8034ca:	68 24 38 80 00       	push   $0x803824
+  8034cf:	6a 1e                	push   $0x1e
+  8034d1:	68 58 3d 80 00       	push   $0x803d58
+  8034d6:	e8 5a f0 ff ff       	call   802535 <_panic>
+
+008034db <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8034db:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8034dc:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  8034e1:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8034e3:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8034e6:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8034eb:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8034f0:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8034f4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8034f7:	83 c4 08             	add    $0x8,%esp
+	popal
+  8034fa:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8034fb:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8034fe:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8034ff:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803500:	c3                   	ret
+
+00803501 <dm>:
+  803501:	55                   	push   %ebp
+  803502:	57                   	push   %edi
+  803503:	56                   	push   %esi
+  803504:	53                   	push   %ebx
+  803505:	83 ec 24             	sub    $0x24,%esp
+  803508:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80350c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803510:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803514:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803518:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80351c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803520:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803524:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803529:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803533:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80353a:	00 
+  80353b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803542:	00 
+  803543:	89 fb                	mov    %edi,%ebx
+  803545:	eb 08                	jmp    80354f <dm+0x4e>
+  803547:	83 e9 01             	sub    $0x1,%ecx
+  80354a:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80354d:	74 68                	je     8035b7 <dm+0xb6>
+  80354f:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803553:	01 c0                	add    %eax,%eax
+  803555:	89 c6                	mov    %eax,%esi
+  803557:	89 d7                	mov    %edx,%edi
+  803559:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80355d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803561:	0f ad d0             	shrd   %cl,%edx,%eax
+  803564:	d3 ea                	shr    %cl,%edx
+  803566:	f6 c1 20             	test   $0x20,%cl
+  803569:	74 04                	je     80356f <dm+0x6e>
+  80356b:	89 d0                	mov    %edx,%eax
+  80356d:	31 d2                	xor    %edx,%edx
+  80356f:	83 e0 01             	and    $0x1,%eax
+  803572:	89 04 24             	mov    %eax,(%esp)
+  803575:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80357c:	00 
+  80357d:	8b 04 24             	mov    (%esp),%eax
+  803580:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803584:	09 f0                	or     %esi,%eax
+  803586:	09 fa                	or     %edi,%edx
+  803588:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80358c:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803590:	39 f0                	cmp    %esi,%eax
+  803592:	89 d5                	mov    %edx,%ebp
+  803594:	19 fd                	sbb    %edi,%ebp
+  803596:	72 af                	jb     803547 <dm+0x46>
+  803598:	29 f0                	sub    %esi,%eax
+  80359a:	19 fa                	sbb    %edi,%edx
+  80359c:	89 cf                	mov    %ecx,%edi
+  80359e:	c1 ef 05             	shr    $0x5,%edi
+  8035a1:	83 e7 01             	and    $0x1,%edi
+  8035a4:	89 fe                	mov    %edi,%esi
+  8035a6:	83 f6 01             	xor    $0x1,%esi
+  8035a9:	d3 e6                	shl    %cl,%esi
+  8035ab:	d3 e7                	shl    %cl,%edi
+  8035ad:	09 74 24 18          	or     %esi,0x18(%esp)
+  8035b1:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8035b5:	eb 90                	jmp    803547 <dm+0x46>
+  8035b7:	85 db                	test   %ebx,%ebx
+  8035b9:	74 05                	je     8035c0 <dm+0xbf>
+  8035bb:	89 03                	mov    %eax,(%ebx)
+  8035bd:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035c0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035c4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035c8:	83 c4 24             	add    $0x24,%esp
+  8035cb:	5b                   	pop    %ebx
+  8035cc:	5e                   	pop    %esi
+  8035cd:	5f                   	pop    %edi
+  8035ce:	5d                   	pop    %ebp
+  8035cf:	c3                   	ret
+
+008035d0 <__udivdi3>:
+  8035d0:	83 ec 08             	sub    $0x8,%esp
+  8035d3:	6a 00                	push   $0x0
+  8035d5:	ff 74 24 1c          	push   0x1c(%esp)
+  8035d9:	ff 74 24 1c          	push   0x1c(%esp)
+  8035dd:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035e1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035e5:	e8 17 ff ff ff       	call   803501 <dm>
+  8035ea:	83 c4 14             	add    $0x14,%esp
+  8035ed:	c3                   	ret
+
+008035ee <__umoddi3>:
+  8035ee:	83 ec 18             	sub    $0x18,%esp
+  8035f1:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8035f5:	50                   	push   %eax
+  8035f6:	ff 74 24 2c          	push   0x2c(%esp)
+  8035fa:	ff 74 24 2c          	push   0x2c(%esp)
+  8035fe:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803602:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803606:	e8 f6 fe ff ff       	call   803501 <dm>
+  80360b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80360f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803613:	83 c4 24             	add    $0x24,%esp
+  803616:	c3                   	ret
+
+00803617 <__divdi3>:
+  803617:	53                   	push   %ebx
+  803618:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80361c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803620:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803624:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803628:	85 d2                	test   %edx,%edx
+  80362a:	78 15                	js     803641 <__divdi3+0x2a>
+  80362c:	85 db                	test   %ebx,%ebx
+  80362e:	78 34                	js     803664 <__divdi3+0x4d>
+  803630:	83 ec 04             	sub    $0x4,%esp
+  803633:	6a 00                	push   $0x0
+  803635:	53                   	push   %ebx
+  803636:	51                   	push   %ecx
+  803637:	e8 c5 fe ff ff       	call   803501 <dm>
+  80363c:	83 c4 10             	add    $0x10,%esp
+  80363f:	eb 21                	jmp    803662 <__divdi3+0x4b>
+  803641:	f7 d8                	neg    %eax
+  803643:	83 d2 00             	adc    $0x0,%edx
+  803646:	f7 da                	neg    %edx
+  803648:	85 db                	test   %ebx,%ebx
+  80364a:	78 30                	js     80367c <__divdi3+0x65>
+  80364c:	83 ec 04             	sub    $0x4,%esp
+  80364f:	6a 00                	push   $0x0
+  803651:	53                   	push   %ebx
+  803652:	51                   	push   %ecx
+  803653:	e8 a9 fe ff ff       	call   803501 <dm>
+  803658:	83 c4 10             	add    $0x10,%esp
+  80365b:	f7 d8                	neg    %eax
+  80365d:	83 d2 00             	adc    $0x0,%edx
+  803660:	f7 da                	neg    %edx
+  803662:	5b                   	pop    %ebx
+  803663:	c3                   	ret
+  803664:	83 ec 04             	sub    $0x4,%esp
+  803667:	6a 00                	push   $0x0
+  803669:	f7 d9                	neg    %ecx
+  80366b:	83 d3 00             	adc    $0x0,%ebx
+  80366e:	f7 db                	neg    %ebx
+  803670:	53                   	push   %ebx
+  803671:	51                   	push   %ecx
+  803672:	e8 8a fe ff ff       	call   803501 <dm>
+  803677:	83 c4 10             	add    $0x10,%esp
+  80367a:	eb df                	jmp    80365b <__divdi3+0x44>
+  80367c:	83 ec 04             	sub    $0x4,%esp
+  80367f:	6a 00                	push   $0x0
+  803681:	f7 d9                	neg    %ecx
+  803683:	83 d3 00             	adc    $0x0,%ebx
+  803686:	f7 db                	neg    %ebx
+  803688:	53                   	push   %ebx
+  803689:	51                   	push   %ecx
+  80368a:	e8 72 fe ff ff       	call   803501 <dm>
+  80368f:	83 c4 10             	add    $0x10,%esp
+  803692:	eb ce                	jmp    803662 <__divdi3+0x4b>
+
+00803694 <__moddi3>:
+  803694:	55                   	push   %ebp
+  803695:	57                   	push   %edi
+  803696:	56                   	push   %esi
+  803697:	53                   	push   %ebx
+  803698:	83 ec 24             	sub    $0x24,%esp
+  80369b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80369f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036a3:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036a7:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036ab:	85 d2                	test   %edx,%edx
+  8036ad:	78 3b                	js     8036ea <__moddi3+0x56>
+  8036af:	83 ec 04             	sub    $0x4,%esp
+  8036b2:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036b6:	56                   	push   %esi
+  8036b7:	89 ce                	mov    %ecx,%esi
+  8036b9:	f7 de                	neg    %esi
+  8036bb:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8036bf:	89 de                	mov    %ebx,%esi
+  8036c1:	83 d6 00             	adc    $0x0,%esi
+  8036c4:	f7 de                	neg    %esi
+  8036c6:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8036ca:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8036ce:	0f 48 f1             	cmovs  %ecx,%esi
+  8036d1:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8036d6:	53                   	push   %ebx
+  8036d7:	56                   	push   %esi
+  8036d8:	e8 24 fe ff ff       	call   803501 <dm>
+  8036dd:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036e1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036e5:	83 c4 10             	add    $0x10,%esp
+  8036e8:	eb 47                	jmp    803731 <__moddi3+0x9d>
+  8036ea:	f7 d8                	neg    %eax
+  8036ec:	83 d2 00             	adc    $0x0,%edx
+  8036ef:	f7 da                	neg    %edx
+  8036f1:	83 ec 04             	sub    $0x4,%esp
+  8036f4:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036f8:	56                   	push   %esi
+  8036f9:	89 cf                	mov    %ecx,%edi
+  8036fb:	f7 df                	neg    %edi
+  8036fd:	89 de                	mov    %ebx,%esi
+  8036ff:	83 d6 00             	adc    $0x0,%esi
+  803702:	f7 de                	neg    %esi
+  803704:	0f 49 cf             	cmovns %edi,%ecx
+  803707:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80370b:	0f 49 de             	cmovns %esi,%ebx
+  80370e:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803712:	ff 74 24 0c          	push   0xc(%esp)
+  803716:	ff 74 24 0c          	push   0xc(%esp)
+  80371a:	e8 e2 fd ff ff       	call   803501 <dm>
+  80371f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803723:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803727:	f7 d8                	neg    %eax
+  803729:	83 d2 00             	adc    $0x0,%edx
+  80372c:	f7 da                	neg    %edx
+  80372e:	83 c4 10             	add    $0x10,%esp
+  803731:	83 c4 24             	add    $0x24,%esp
+  803734:	5b                   	pop    %ebx
+  803735:	5e                   	pop    %esi
+  803736:	5f                   	pop    %edi
+  803737:	5d                   	pop    %ebp
+  803738:	c3                   	ret
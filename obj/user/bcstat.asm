@@ -0,0 +1,7834 @@
+
+obj/user/bcstat.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 68 00 00 00       	call   800099 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 34             	sub    $0x34,%esp
+	struct BcStats st;
+	int r;
+
+	if ((r = fs_bcstats(&st)) < 0)
+  800039:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80003c:	50                   	push   %eax
+  80003d:	e8 cf 25 00 00       	call   802611 <fs_bcstats>
+  800042:	83 c4 10             	add    $0x10,%esp
+  800045:	85 c0                	test   %eax,%eax
+  800047:	78 3e                	js     800087 <umain+0x54>
+		panic("fs_bcstats: %e", r);
+	printf("hits %u misses %u\n", st.bs_hits, st.bs_misses);
+  800049:	83 ec 04             	sub    $0x4,%esp
+  80004c:	ff 75 e4             	push   -0x1c(%ebp)
+  80004f:	ff 75 e0             	push   -0x20(%ebp)
+  800052:	68 dd 38 80 00       	push   $0x8038dd
+  800057:	e8 09 27 00 00       	call   802765 <printf>
+	printf("readahead %u evictions %u\n", st.bs_readahead, st.bs_evictions);
+  80005c:	83 c4 0c             	add    $0xc,%esp
+  80005f:	ff 75 e8             	push   -0x18(%ebp)
+  800062:	ff 75 ec             	push   -0x14(%ebp)
+  800065:	68 f0 38 80 00       	push   $0x8038f0
+  80006a:	e8 f6 26 00 00       	call   802765 <printf>
+	printf("writebacks %u in %u writes\n", st.bs_writebacks, st.bs_writes);
+  80006f:	83 c4 0c             	add    $0xc,%esp
+  800072:	ff 75 f4             	push   -0xc(%ebp)
+  800075:	ff 75 f0             	push   -0x10(%ebp)
+  800078:	68 0b 39 80 00       	push   $0x80390b
+  80007d:	e8 e3 26 00 00       	call   802765 <printf>
+}
+  800082:	83 c4 10             	add    $0x10,%esp
+  800085:	c9                   	leave
+  800086:	c3                   	ret
+		panic("fs_bcstats: %e", r);
+  800087:	50                   	push   %eax
+  800088:	68 c0 38 80 00       	push   $0x8038c0
+  80008d:	6a 0c                	push   $0xc
+  80008f:	68 cf 38 80 00       	push   $0x8038cf
+  800094:	e8 63 00 00 00       	call   8000fc <_panic>
+
+00800099 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800099:	55                   	push   %ebp
+  80009a:	89 e5                	mov    %esp,%ebp
+  80009c:	56                   	push   %esi
+  80009d:	53                   	push   %ebx
+  80009e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000a4:	e8 e2 0a 00 00       	call   800b8b <sys_getenvid>
+  8000a9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ae:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8000b4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000b9:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000be:	85 db                	test   %ebx,%ebx
+  8000c0:	7e 07                	jle    8000c9 <libmain+0x30>
+		binaryname = argv[0];
+  8000c2:	8b 06                	mov    (%esi),%eax
+  8000c4:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000c9:	83 ec 08             	sub    $0x8,%esp
+  8000cc:	56                   	push   %esi
+  8000cd:	53                   	push   %ebx
+  8000ce:	e8 60 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000d3:	e8 0a 00 00 00       	call   8000e2 <exit>
+}
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000de:	5b                   	pop    %ebx
+  8000df:	5e                   	pop    %esi
+  8000e0:	5d                   	pop    %ebp
+  8000e1:	c3                   	ret
+
+008000e2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000e2:	55                   	push   %ebp
+  8000e3:	89 e5                	mov    %esp,%ebp
+  8000e5:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000e8:	e8 b9 10 00 00       	call   8011a6 <close_all>
+	sys_env_destroy(0);
+  8000ed:	83 ec 0c             	sub    $0xc,%esp
+  8000f0:	6a 00                	push   $0x0
+  8000f2:	e8 4b 0a 00 00       	call   800b42 <sys_env_destroy>
+}
+  8000f7:	83 c4 10             	add    $0x10,%esp
+  8000fa:	c9                   	leave
+  8000fb:	c3                   	ret
+
+008000fc <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8000fc:	55                   	push   %ebp
+  8000fd:	89 e5                	mov    %esp,%ebp
+  8000ff:	56                   	push   %esi
+  800100:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800101:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800104:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80010a:	e8 7c 0a 00 00       	call   800b8b <sys_getenvid>
+  80010f:	83 ec 0c             	sub    $0xc,%esp
+  800112:	ff 75 0c             	push   0xc(%ebp)
+  800115:	ff 75 08             	push   0x8(%ebp)
+  800118:	56                   	push   %esi
+  800119:	50                   	push   %eax
+  80011a:	68 34 39 80 00       	push   $0x803934
+  80011f:	e8 b3 00 00 00       	call   8001d7 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800124:	83 c4 18             	add    $0x18,%esp
+  800127:	53                   	push   %ebx
+  800128:	ff 75 10             	push   0x10(%ebp)
+  80012b:	e8 56 00 00 00       	call   800186 <vcprintf>
+	cprintf("\n");
+  800130:	c7 04 24 07 3e 80 00 	movl   $0x803e07,(%esp)
+  800137:	e8 9b 00 00 00       	call   8001d7 <cprintf>
+  80013c:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80013f:	cc                   	int3
+	while (1)
+  800140:	eb fd                	jmp    80013f <_panic+0x43>
+
+00800142 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800142:	55                   	push   %ebp
+  800143:	89 e5                	mov    %esp,%ebp
+  800145:	53                   	push   %ebx
+  800146:	83 ec 04             	sub    $0x4,%esp
+  800149:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80014c:	8b 13                	mov    (%ebx),%edx
+  80014e:	8d 42 01             	lea    0x1(%edx),%eax
+  800151:	89 03                	mov    %eax,(%ebx)
+  800153:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800156:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80015a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80015f:	74 09                	je     80016a <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800161:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800165:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800168:	c9                   	leave
+  800169:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80016a:	83 ec 08             	sub    $0x8,%esp
+  80016d:	68 ff 00 00 00       	push   $0xff
+  800172:	8d 43 08             	lea    0x8(%ebx),%eax
+  800175:	50                   	push   %eax
+  800176:	e8 7a 09 00 00       	call   800af5 <sys_cputs>
+		b->idx = 0;
+  80017b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	eb db                	jmp    800161 <putch+0x1f>
+
+00800186 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800186:	55                   	push   %ebp
+  800187:	89 e5                	mov    %esp,%ebp
+  800189:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80018f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800196:	00 00 00 
+	b.cnt = 0;
+  800199:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001a0:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001a3:	ff 75 0c             	push   0xc(%ebp)
+  8001a6:	ff 75 08             	push   0x8(%ebp)
+  8001a9:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001af:	50                   	push   %eax
+  8001b0:	68 42 01 80 00       	push   $0x800142
+  8001b5:	e8 14 01 00 00       	call   8002ce <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001ba:	83 c4 08             	add    $0x8,%esp
+  8001bd:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001c3:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001c9:	50                   	push   %eax
+  8001ca:	e8 26 09 00 00       	call   800af5 <sys_cputs>
+
+	return b.cnt;
+}
+  8001cf:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001d5:	c9                   	leave
+  8001d6:	c3                   	ret
+
+008001d7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001dd:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001e0:	50                   	push   %eax
+  8001e1:	ff 75 08             	push   0x8(%ebp)
+  8001e4:	e8 9d ff ff ff       	call   800186 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001e9:	c9                   	leave
+  8001ea:	c3                   	ret
+
+008001eb <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001eb:	55                   	push   %ebp
+  8001ec:	89 e5                	mov    %esp,%ebp
+  8001ee:	57                   	push   %edi
+  8001ef:	56                   	push   %esi
+  8001f0:	53                   	push   %ebx
+  8001f1:	83 ec 1c             	sub    $0x1c,%esp
+  8001f4:	89 c7                	mov    %eax,%edi
+  8001f6:	89 d6                	mov    %edx,%esi
+  8001f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001fe:	89 d1                	mov    %edx,%ecx
+  800200:	89 c2                	mov    %eax,%edx
+  800202:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800205:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800208:	8b 45 10             	mov    0x10(%ebp),%eax
+  80020b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80020e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800211:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800218:	39 c2                	cmp    %eax,%edx
+  80021a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80021d:	72 3e                	jb     80025d <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80021f:	83 ec 0c             	sub    $0xc,%esp
+  800222:	ff 75 18             	push   0x18(%ebp)
+  800225:	83 eb 01             	sub    $0x1,%ebx
+  800228:	53                   	push   %ebx
+  800229:	50                   	push   %eax
+  80022a:	83 ec 08             	sub    $0x8,%esp
+  80022d:	ff 75 e4             	push   -0x1c(%ebp)
+  800230:	ff 75 e0             	push   -0x20(%ebp)
+  800233:	ff 75 dc             	push   -0x24(%ebp)
+  800236:	ff 75 d8             	push   -0x28(%ebp)
+  800239:	e8 05 35 00 00       	call   803743 <__udivdi3>
+  80023e:	83 c4 18             	add    $0x18,%esp
+  800241:	52                   	push   %edx
+  800242:	50                   	push   %eax
+  800243:	89 f2                	mov    %esi,%edx
+  800245:	89 f8                	mov    %edi,%eax
+  800247:	e8 9f ff ff ff       	call   8001eb <printnum>
+  80024c:	83 c4 20             	add    $0x20,%esp
+  80024f:	eb 13                	jmp    800264 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800251:	83 ec 08             	sub    $0x8,%esp
+  800254:	56                   	push   %esi
+  800255:	ff 75 18             	push   0x18(%ebp)
+  800258:	ff d7                	call   *%edi
+  80025a:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80025d:	83 eb 01             	sub    $0x1,%ebx
+  800260:	85 db                	test   %ebx,%ebx
+  800262:	7f ed                	jg     800251 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800264:	83 ec 08             	sub    $0x8,%esp
+  800267:	56                   	push   %esi
+  800268:	83 ec 04             	sub    $0x4,%esp
+  80026b:	ff 75 e4             	push   -0x1c(%ebp)
+  80026e:	ff 75 e0             	push   -0x20(%ebp)
+  800271:	ff 75 dc             	push   -0x24(%ebp)
+  800274:	ff 75 d8             	push   -0x28(%ebp)
+  800277:	e8 e5 34 00 00       	call   803761 <__umoddi3>
+  80027c:	83 c4 14             	add    $0x14,%esp
+  80027f:	0f be 80 57 39 80 00 	movsbl 0x803957(%eax),%eax
+  800286:	50                   	push   %eax
+  800287:	ff d7                	call   *%edi
+}
+  800289:	83 c4 10             	add    $0x10,%esp
+  80028c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028f:	5b                   	pop    %ebx
+  800290:	5e                   	pop    %esi
+  800291:	5f                   	pop    %edi
+  800292:	5d                   	pop    %ebp
+  800293:	c3                   	ret
+
+00800294 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800294:	55                   	push   %ebp
+  800295:	89 e5                	mov    %esp,%ebp
+  800297:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80029a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80029e:	8b 10                	mov    (%eax),%edx
+  8002a0:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002a3:	73 0a                	jae    8002af <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002a5:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002a8:	89 08                	mov    %ecx,(%eax)
+  8002aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ad:	88 02                	mov    %al,(%edx)
+}
+  8002af:	5d                   	pop    %ebp
+  8002b0:	c3                   	ret
+
+008002b1 <printfmt>:
+{
+  8002b1:	55                   	push   %ebp
+  8002b2:	89 e5                	mov    %esp,%ebp
+  8002b4:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002b7:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002ba:	50                   	push   %eax
+  8002bb:	ff 75 10             	push   0x10(%ebp)
+  8002be:	ff 75 0c             	push   0xc(%ebp)
+  8002c1:	ff 75 08             	push   0x8(%ebp)
+  8002c4:	e8 05 00 00 00       	call   8002ce <vprintfmt>
+}
+  8002c9:	83 c4 10             	add    $0x10,%esp
+  8002cc:	c9                   	leave
+  8002cd:	c3                   	ret
+
+008002ce <vprintfmt>:
+{
+  8002ce:	55                   	push   %ebp
+  8002cf:	89 e5                	mov    %esp,%ebp
+  8002d1:	57                   	push   %edi
+  8002d2:	56                   	push   %esi
+  8002d3:	53                   	push   %ebx
+  8002d4:	83 ec 2c             	sub    $0x2c,%esp
+  8002d7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002dd:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002e0:	eb 0a                	jmp    8002ec <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002e2:	83 ec 08             	sub    $0x8,%esp
+  8002e5:	53                   	push   %ebx
+  8002e6:	50                   	push   %eax
+  8002e7:	ff d6                	call   *%esi
+  8002e9:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002ec:	83 c7 01             	add    $0x1,%edi
+  8002ef:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002f3:	83 f8 25             	cmp    $0x25,%eax
+  8002f6:	74 0c                	je     800304 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002f8:	85 c0                	test   %eax,%eax
+  8002fa:	75 e6                	jne    8002e2 <vprintfmt+0x14>
+}
+  8002fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ff:	5b                   	pop    %ebx
+  800300:	5e                   	pop    %esi
+  800301:	5f                   	pop    %edi
+  800302:	5d                   	pop    %ebp
+  800303:	c3                   	ret
+		padc = ' ';
+  800304:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800308:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80030f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800316:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80031d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800322:	8d 47 01             	lea    0x1(%edi),%eax
+  800325:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800328:	0f b6 17             	movzbl (%edi),%edx
+  80032b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80032e:	3c 55                	cmp    $0x55,%al
+  800330:	0f 87 cf 03 00 00    	ja     800705 <vprintfmt+0x437>
+  800336:	0f b6 c0             	movzbl %al,%eax
+  800339:	ff 24 85 c0 3a 80 00 	jmp    *0x803ac0(,%eax,4)
+  800340:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800343:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800347:	eb d9                	jmp    800322 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800349:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80034c:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800350:	eb d0                	jmp    800322 <vprintfmt+0x54>
+  800352:	0f b6 d2             	movzbl %dl,%edx
+  800355:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800360:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800363:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800367:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80036a:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80036d:	83 f9 09             	cmp    $0x9,%ecx
+  800370:	77 55                	ja     8003c7 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800372:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800375:	eb e9                	jmp    800360 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800377:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037a:	8b 00                	mov    (%eax),%eax
+  80037c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80037f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800382:	8d 40 04             	lea    0x4(%eax),%eax
+  800385:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800388:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80038b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80038f:	79 91                	jns    800322 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800391:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800394:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800397:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80039e:	eb 82                	jmp    800322 <vprintfmt+0x54>
+			if (width < 0)
+  8003a0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003a3:	85 d2                	test   %edx,%edx
+  8003a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003aa:	0f 49 c2             	cmovns %edx,%eax
+  8003ad:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003b3:	e9 6a ff ff ff       	jmp    800322 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003bb:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003c2:	e9 5b ff ff ff       	jmp    800322 <vprintfmt+0x54>
+  8003c7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ca:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003cd:	eb bc                	jmp    80038b <vprintfmt+0xbd>
+			lflag++;
+  8003cf:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003d5:	e9 48 ff ff ff       	jmp    800322 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003dd:	8d 78 04             	lea    0x4(%eax),%edi
+  8003e0:	83 ec 08             	sub    $0x8,%esp
+  8003e3:	53                   	push   %ebx
+  8003e4:	ff 30                	push   (%eax)
+  8003e6:	ff d6                	call   *%esi
+			break;
+  8003e8:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003eb:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003ee:	e9 b1 02 00 00       	jmp    8006a4 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f6:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003f9:	8b 10                	mov    (%eax),%edx
+  8003fb:	89 d0                	mov    %edx,%eax
+  8003fd:	f7 d8                	neg    %eax
+  8003ff:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800402:	83 f8 11             	cmp    $0x11,%eax
+  800405:	7f 23                	jg     80042a <vprintfmt+0x15c>
+  800407:	8b 14 85 20 3c 80 00 	mov    0x803c20(,%eax,4),%edx
+  80040e:	85 d2                	test   %edx,%edx
+  800410:	74 18                	je     80042a <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800412:	52                   	push   %edx
+  800413:	68 72 3d 80 00       	push   $0x803d72
+  800418:	53                   	push   %ebx
+  800419:	56                   	push   %esi
+  80041a:	e8 92 fe ff ff       	call   8002b1 <printfmt>
+  80041f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800422:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800425:	e9 7a 02 00 00       	jmp    8006a4 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80042a:	50                   	push   %eax
+  80042b:	68 6f 39 80 00       	push   $0x80396f
+  800430:	53                   	push   %ebx
+  800431:	56                   	push   %esi
+  800432:	e8 7a fe ff ff       	call   8002b1 <printfmt>
+  800437:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80043a:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80043d:	e9 62 02 00 00       	jmp    8006a4 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800442:	8b 45 14             	mov    0x14(%ebp),%eax
+  800445:	83 c0 04             	add    $0x4,%eax
+  800448:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80044b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044e:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800450:	85 c9                	test   %ecx,%ecx
+  800452:	b8 68 39 80 00       	mov    $0x803968,%eax
+  800457:	0f 45 c1             	cmovne %ecx,%eax
+  80045a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80045d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800461:	7e 06                	jle    800469 <vprintfmt+0x19b>
+  800463:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800467:	75 0b                	jne    800474 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800469:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80046c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80046f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800472:	eb 5c                	jmp    8004d0 <vprintfmt+0x202>
+  800474:	83 ec 08             	sub    $0x8,%esp
+  800477:	ff 75 d0             	push   -0x30(%ebp)
+  80047a:	ff 75 cc             	push   -0x34(%ebp)
+  80047d:	e8 20 03 00 00       	call   8007a2 <strnlen>
+  800482:	89 c2                	mov    %eax,%edx
+  800484:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800487:	29 d0                	sub    %edx,%eax
+  800489:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80048c:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800490:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800493:	89 75 08             	mov    %esi,0x8(%ebp)
+  800496:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800498:	eb 0e                	jmp    8004a8 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80049a:	83 ec 08             	sub    $0x8,%esp
+  80049d:	53                   	push   %ebx
+  80049e:	57                   	push   %edi
+  80049f:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004a2:	83 ee 01             	sub    $0x1,%esi
+  8004a5:	83 c4 10             	add    $0x10,%esp
+  8004a8:	85 f6                	test   %esi,%esi
+  8004aa:	7f ee                	jg     80049a <vprintfmt+0x1cc>
+  8004ac:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004af:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004b2:	85 c0                	test   %eax,%eax
+  8004b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004b9:	0f 49 d0             	cmovns %eax,%edx
+  8004bc:	29 d0                	sub    %edx,%eax
+  8004be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c1:	eb a6                	jmp    800469 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004c3:	83 ec 08             	sub    $0x8,%esp
+  8004c6:	53                   	push   %ebx
+  8004c7:	52                   	push   %edx
+  8004c8:	ff 55 08             	call   *0x8(%ebp)
+  8004cb:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ce:	89 f1                	mov    %esi,%ecx
+  8004d0:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004d3:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004d7:	0f be d0             	movsbl %al,%edx
+  8004da:	85 d2                	test   %edx,%edx
+  8004dc:	74 28                	je     800506 <vprintfmt+0x238>
+  8004de:	85 ff                	test   %edi,%edi
+  8004e0:	78 05                	js     8004e7 <vprintfmt+0x219>
+  8004e2:	83 ef 01             	sub    $0x1,%edi
+  8004e5:	78 30                	js     800517 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004e7:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004eb:	74 d6                	je     8004c3 <vprintfmt+0x1f5>
+  8004ed:	0f be c0             	movsbl %al,%eax
+  8004f0:	83 e8 20             	sub    $0x20,%eax
+  8004f3:	83 f8 5e             	cmp    $0x5e,%eax
+  8004f6:	76 cb                	jbe    8004c3 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004f8:	83 ec 08             	sub    $0x8,%esp
+  8004fb:	53                   	push   %ebx
+  8004fc:	6a 3f                	push   $0x3f
+  8004fe:	ff 55 08             	call   *0x8(%ebp)
+  800501:	83 c4 10             	add    $0x10,%esp
+  800504:	eb c8                	jmp    8004ce <vprintfmt+0x200>
+  800506:	8b 75 08             	mov    0x8(%ebp),%esi
+  800509:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80050c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80050f:	01 d0                	add    %edx,%eax
+  800511:	29 c8                	sub    %ecx,%eax
+  800513:	89 c7                	mov    %eax,%edi
+  800515:	eb 13                	jmp    80052a <vprintfmt+0x25c>
+  800517:	8b 75 08             	mov    0x8(%ebp),%esi
+  80051a:	eb ed                	jmp    800509 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80051c:	83 ec 08             	sub    $0x8,%esp
+  80051f:	53                   	push   %ebx
+  800520:	6a 20                	push   $0x20
+  800522:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800524:	83 ef 01             	sub    $0x1,%edi
+  800527:	83 c4 10             	add    $0x10,%esp
+  80052a:	85 ff                	test   %edi,%edi
+  80052c:	7f ee                	jg     80051c <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80052e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800531:	89 45 14             	mov    %eax,0x14(%ebp)
+  800534:	e9 6b 01 00 00       	jmp    8006a4 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800539:	83 f9 01             	cmp    $0x1,%ecx
+  80053c:	7f 1f                	jg     80055d <vprintfmt+0x28f>
+	else if (lflag)
+  80053e:	85 c9                	test   %ecx,%ecx
+  800540:	74 67                	je     8005a9 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800542:	8b 45 14             	mov    0x14(%ebp),%eax
+  800545:	8b 00                	mov    (%eax),%eax
+  800547:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80054a:	89 c1                	mov    %eax,%ecx
+  80054c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80054f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800552:	8b 45 14             	mov    0x14(%ebp),%eax
+  800555:	8d 40 04             	lea    0x4(%eax),%eax
+  800558:	89 45 14             	mov    %eax,0x14(%ebp)
+  80055b:	eb 17                	jmp    800574 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80055d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800560:	8b 50 04             	mov    0x4(%eax),%edx
+  800563:	8b 00                	mov    (%eax),%eax
+  800565:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800568:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80056b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056e:	8d 40 08             	lea    0x8(%eax),%eax
+  800571:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800574:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800577:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80057a:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80057f:	85 c9                	test   %ecx,%ecx
+  800581:	0f 89 03 01 00 00    	jns    80068a <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800587:	83 ec 08             	sub    $0x8,%esp
+  80058a:	53                   	push   %ebx
+  80058b:	6a 2d                	push   $0x2d
+  80058d:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80058f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800592:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800595:	f7 da                	neg    %edx
+  800597:	83 d1 00             	adc    $0x0,%ecx
+  80059a:	f7 d9                	neg    %ecx
+  80059c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80059f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005a4:	e9 e1 00 00 00       	jmp    80068a <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ac:	8b 00                	mov    (%eax),%eax
+  8005ae:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b1:	89 c1                	mov    %eax,%ecx
+  8005b3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005b6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c2:	eb b0                	jmp    800574 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005c4:	83 f9 01             	cmp    $0x1,%ecx
+  8005c7:	7f 1e                	jg     8005e7 <vprintfmt+0x319>
+	else if (lflag)
+  8005c9:	85 c9                	test   %ecx,%ecx
+  8005cb:	74 32                	je     8005ff <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d0:	8b 10                	mov    (%eax),%edx
+  8005d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005da:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005dd:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005e2:	e9 a3 00 00 00       	jmp    80068a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ea:	8b 10                	mov    (%eax),%edx
+  8005ec:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005ef:	8d 40 08             	lea    0x8(%eax),%eax
+  8005f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005fa:	e9 8b 00 00 00       	jmp    80068a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800602:	8b 10                	mov    (%eax),%edx
+  800604:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800609:	8d 40 04             	lea    0x4(%eax),%eax
+  80060c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80060f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800614:	eb 74                	jmp    80068a <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800616:	83 f9 01             	cmp    $0x1,%ecx
+  800619:	7f 1b                	jg     800636 <vprintfmt+0x368>
+	else if (lflag)
+  80061b:	85 c9                	test   %ecx,%ecx
+  80061d:	74 2c                	je     80064b <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80061f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800622:	8b 10                	mov    (%eax),%edx
+  800624:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800629:	8d 40 04             	lea    0x4(%eax),%eax
+  80062c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80062f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800634:	eb 54                	jmp    80068a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800636:	8b 45 14             	mov    0x14(%ebp),%eax
+  800639:	8b 10                	mov    (%eax),%edx
+  80063b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80063e:	8d 40 08             	lea    0x8(%eax),%eax
+  800641:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800644:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800649:	eb 3f                	jmp    80068a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80064b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064e:	8b 10                	mov    (%eax),%edx
+  800650:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800655:	8d 40 04             	lea    0x4(%eax),%eax
+  800658:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80065b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800660:	eb 28                	jmp    80068a <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800662:	83 ec 08             	sub    $0x8,%esp
+  800665:	53                   	push   %ebx
+  800666:	6a 30                	push   $0x30
+  800668:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80066a:	83 c4 08             	add    $0x8,%esp
+  80066d:	53                   	push   %ebx
+  80066e:	6a 78                	push   $0x78
+  800670:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800672:	8b 45 14             	mov    0x14(%ebp),%eax
+  800675:	8b 10                	mov    (%eax),%edx
+  800677:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80067c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80067f:	8d 40 04             	lea    0x4(%eax),%eax
+  800682:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800685:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80068a:	83 ec 0c             	sub    $0xc,%esp
+  80068d:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800691:	50                   	push   %eax
+  800692:	ff 75 e0             	push   -0x20(%ebp)
+  800695:	57                   	push   %edi
+  800696:	51                   	push   %ecx
+  800697:	52                   	push   %edx
+  800698:	89 da                	mov    %ebx,%edx
+  80069a:	89 f0                	mov    %esi,%eax
+  80069c:	e8 4a fb ff ff       	call   8001eb <printnum>
+			break;
+  8006a1:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006a7:	e9 40 fc ff ff       	jmp    8002ec <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006ac:	83 f9 01             	cmp    $0x1,%ecx
+  8006af:	7f 1b                	jg     8006cc <vprintfmt+0x3fe>
+	else if (lflag)
+  8006b1:	85 c9                	test   %ecx,%ecx
+  8006b3:	74 2c                	je     8006e1 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b8:	8b 10                	mov    (%eax),%edx
+  8006ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006ca:	eb be                	jmp    80068a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cf:	8b 10                	mov    (%eax),%edx
+  8006d1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006da:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006df:	eb a9                	jmp    80068a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e4:	8b 10                	mov    (%eax),%edx
+  8006e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006f6:	eb 92                	jmp    80068a <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006f8:	83 ec 08             	sub    $0x8,%esp
+  8006fb:	53                   	push   %ebx
+  8006fc:	6a 25                	push   $0x25
+  8006fe:	ff d6                	call   *%esi
+			break;
+  800700:	83 c4 10             	add    $0x10,%esp
+  800703:	eb 9f                	jmp    8006a4 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800705:	83 ec 08             	sub    $0x8,%esp
+  800708:	53                   	push   %ebx
+  800709:	6a 25                	push   $0x25
+  80070b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80070d:	83 c4 10             	add    $0x10,%esp
+  800710:	89 f8                	mov    %edi,%eax
+  800712:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800716:	74 05                	je     80071d <vprintfmt+0x44f>
+  800718:	83 e8 01             	sub    $0x1,%eax
+  80071b:	eb f5                	jmp    800712 <vprintfmt+0x444>
+  80071d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800720:	eb 82                	jmp    8006a4 <vprintfmt+0x3d6>
+
+00800722 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800722:	55                   	push   %ebp
+  800723:	89 e5                	mov    %esp,%ebp
+  800725:	83 ec 18             	sub    $0x18,%esp
+  800728:	8b 45 08             	mov    0x8(%ebp),%eax
+  80072b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80072e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800731:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800735:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800738:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80073f:	85 c0                	test   %eax,%eax
+  800741:	74 26                	je     800769 <vsnprintf+0x47>
+  800743:	85 d2                	test   %edx,%edx
+  800745:	7e 22                	jle    800769 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800747:	ff 75 14             	push   0x14(%ebp)
+  80074a:	ff 75 10             	push   0x10(%ebp)
+  80074d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800750:	50                   	push   %eax
+  800751:	68 94 02 80 00       	push   $0x800294
+  800756:	e8 73 fb ff ff       	call   8002ce <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80075b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80075e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800761:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800764:	83 c4 10             	add    $0x10,%esp
+}
+  800767:	c9                   	leave
+  800768:	c3                   	ret
+		return -E_INVAL;
+  800769:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80076e:	eb f7                	jmp    800767 <vsnprintf+0x45>
+
+00800770 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800770:	55                   	push   %ebp
+  800771:	89 e5                	mov    %esp,%ebp
+  800773:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800776:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800779:	50                   	push   %eax
+  80077a:	ff 75 10             	push   0x10(%ebp)
+  80077d:	ff 75 0c             	push   0xc(%ebp)
+  800780:	ff 75 08             	push   0x8(%ebp)
+  800783:	e8 9a ff ff ff       	call   800722 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800788:	c9                   	leave
+  800789:	c3                   	ret
+
+0080078a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80078a:	55                   	push   %ebp
+  80078b:	89 e5                	mov    %esp,%ebp
+  80078d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800790:	b8 00 00 00 00       	mov    $0x0,%eax
+  800795:	eb 03                	jmp    80079a <strlen+0x10>
+		n++;
+  800797:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80079a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80079e:	75 f7                	jne    800797 <strlen+0xd>
+	return n;
+}
+  8007a0:	5d                   	pop    %ebp
+  8007a1:	c3                   	ret
+
+008007a2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007a2:	55                   	push   %ebp
+  8007a3:	89 e5                	mov    %esp,%ebp
+  8007a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b0:	eb 03                	jmp    8007b5 <strnlen+0x13>
+		n++;
+  8007b2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007b5:	39 d0                	cmp    %edx,%eax
+  8007b7:	74 08                	je     8007c1 <strnlen+0x1f>
+  8007b9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007bd:	75 f3                	jne    8007b2 <strnlen+0x10>
+  8007bf:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007c1:	89 d0                	mov    %edx,%eax
+  8007c3:	5d                   	pop    %ebp
+  8007c4:	c3                   	ret
+
+008007c5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007c5:	55                   	push   %ebp
+  8007c6:	89 e5                	mov    %esp,%ebp
+  8007c8:	53                   	push   %ebx
+  8007c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007d8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007db:	83 c0 01             	add    $0x1,%eax
+  8007de:	84 d2                	test   %dl,%dl
+  8007e0:	75 f2                	jne    8007d4 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007e2:	89 c8                	mov    %ecx,%eax
+  8007e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007e7:	c9                   	leave
+  8007e8:	c3                   	ret
+
+008007e9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007e9:	55                   	push   %ebp
+  8007ea:	89 e5                	mov    %esp,%ebp
+  8007ec:	53                   	push   %ebx
+  8007ed:	83 ec 10             	sub    $0x10,%esp
+  8007f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007f3:	53                   	push   %ebx
+  8007f4:	e8 91 ff ff ff       	call   80078a <strlen>
+  8007f9:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007fc:	ff 75 0c             	push   0xc(%ebp)
+  8007ff:	01 d8                	add    %ebx,%eax
+  800801:	50                   	push   %eax
+  800802:	e8 be ff ff ff       	call   8007c5 <strcpy>
+	return dst;
+}
+  800807:	89 d8                	mov    %ebx,%eax
+  800809:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80080c:	c9                   	leave
+  80080d:	c3                   	ret
+
+0080080e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80080e:	55                   	push   %ebp
+  80080f:	89 e5                	mov    %esp,%ebp
+  800811:	56                   	push   %esi
+  800812:	53                   	push   %ebx
+  800813:	8b 75 08             	mov    0x8(%ebp),%esi
+  800816:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800819:	89 f3                	mov    %esi,%ebx
+  80081b:	03 5d 10             	add    0x10(%ebp),%ebx
+  80081e:	89 f0                	mov    %esi,%eax
+  800820:	eb 0f                	jmp    800831 <strncpy+0x23>
+		*dst++ = *src;
+  800822:	83 c0 01             	add    $0x1,%eax
+  800825:	0f b6 0a             	movzbl (%edx),%ecx
+  800828:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80082b:	80 f9 01             	cmp    $0x1,%cl
+  80082e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800831:	39 d8                	cmp    %ebx,%eax
+  800833:	75 ed                	jne    800822 <strncpy+0x14>
+	}
+	return ret;
+}
+  800835:	89 f0                	mov    %esi,%eax
+  800837:	5b                   	pop    %ebx
+  800838:	5e                   	pop    %esi
+  800839:	5d                   	pop    %ebp
+  80083a:	c3                   	ret
+
+0080083b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80083b:	55                   	push   %ebp
+  80083c:	89 e5                	mov    %esp,%ebp
+  80083e:	56                   	push   %esi
+  80083f:	53                   	push   %ebx
+  800840:	8b 75 08             	mov    0x8(%ebp),%esi
+  800843:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800846:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800849:	89 f0                	mov    %esi,%eax
+  80084b:	85 d2                	test   %edx,%edx
+  80084d:	74 21                	je     800870 <strlcpy+0x35>
+  80084f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800853:	89 f2                	mov    %esi,%edx
+  800855:	eb 09                	jmp    800860 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800857:	83 c1 01             	add    $0x1,%ecx
+  80085a:	83 c2 01             	add    $0x1,%edx
+  80085d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800860:	39 c2                	cmp    %eax,%edx
+  800862:	74 09                	je     80086d <strlcpy+0x32>
+  800864:	0f b6 19             	movzbl (%ecx),%ebx
+  800867:	84 db                	test   %bl,%bl
+  800869:	75 ec                	jne    800857 <strlcpy+0x1c>
+  80086b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80086d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800870:	29 f0                	sub    %esi,%eax
+}
+  800872:	5b                   	pop    %ebx
+  800873:	5e                   	pop    %esi
+  800874:	5d                   	pop    %ebp
+  800875:	c3                   	ret
+
+00800876 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800876:	55                   	push   %ebp
+  800877:	89 e5                	mov    %esp,%ebp
+  800879:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80087c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80087f:	eb 06                	jmp    800887 <strcmp+0x11>
+		p++, q++;
+  800881:	83 c1 01             	add    $0x1,%ecx
+  800884:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800887:	0f b6 01             	movzbl (%ecx),%eax
+  80088a:	84 c0                	test   %al,%al
+  80088c:	74 04                	je     800892 <strcmp+0x1c>
+  80088e:	3a 02                	cmp    (%edx),%al
+  800890:	74 ef                	je     800881 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800892:	0f b6 c0             	movzbl %al,%eax
+  800895:	0f b6 12             	movzbl (%edx),%edx
+  800898:	29 d0                	sub    %edx,%eax
+}
+  80089a:	5d                   	pop    %ebp
+  80089b:	c3                   	ret
+
+0080089c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80089c:	55                   	push   %ebp
+  80089d:	89 e5                	mov    %esp,%ebp
+  80089f:	53                   	push   %ebx
+  8008a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a6:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008a9:	eb 09                	jmp    8008b4 <strncmp+0x18>
+		n--, p++, q++;
+  8008ab:	83 ea 01             	sub    $0x1,%edx
+  8008ae:	83 c0 01             	add    $0x1,%eax
+  8008b1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008b4:	85 d2                	test   %edx,%edx
+  8008b6:	74 18                	je     8008d0 <strncmp+0x34>
+  8008b8:	0f b6 18             	movzbl (%eax),%ebx
+  8008bb:	84 db                	test   %bl,%bl
+  8008bd:	74 04                	je     8008c3 <strncmp+0x27>
+  8008bf:	3a 19                	cmp    (%ecx),%bl
+  8008c1:	74 e8                	je     8008ab <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008c3:	0f b6 00             	movzbl (%eax),%eax
+  8008c6:	0f b6 11             	movzbl (%ecx),%edx
+  8008c9:	29 d0                	sub    %edx,%eax
+}
+  8008cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ce:	c9                   	leave
+  8008cf:	c3                   	ret
+		return 0;
+  8008d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d5:	eb f4                	jmp    8008cb <strncmp+0x2f>
+
+008008d7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008d7:	55                   	push   %ebp
+  8008d8:	89 e5                	mov    %esp,%ebp
+  8008da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008dd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008e1:	eb 03                	jmp    8008e6 <strchr+0xf>
+  8008e3:	83 c0 01             	add    $0x1,%eax
+  8008e6:	0f b6 10             	movzbl (%eax),%edx
+  8008e9:	84 d2                	test   %dl,%dl
+  8008eb:	74 06                	je     8008f3 <strchr+0x1c>
+		if (*s == c)
+  8008ed:	38 ca                	cmp    %cl,%dl
+  8008ef:	75 f2                	jne    8008e3 <strchr+0xc>
+  8008f1:	eb 05                	jmp    8008f8 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008f8:	5d                   	pop    %ebp
+  8008f9:	c3                   	ret
+
+008008fa <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008fa:	55                   	push   %ebp
+  8008fb:	89 e5                	mov    %esp,%ebp
+  8008fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800900:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800904:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800907:	38 ca                	cmp    %cl,%dl
+  800909:	74 09                	je     800914 <strfind+0x1a>
+  80090b:	84 d2                	test   %dl,%dl
+  80090d:	74 05                	je     800914 <strfind+0x1a>
+	for (; *s; s++)
+  80090f:	83 c0 01             	add    $0x1,%eax
+  800912:	eb f0                	jmp    800904 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800914:	5d                   	pop    %ebp
+  800915:	c3                   	ret
+
+00800916 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800916:	55                   	push   %ebp
+  800917:	89 e5                	mov    %esp,%ebp
+  800919:	57                   	push   %edi
+  80091a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80091d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800920:	85 c9                	test   %ecx,%ecx
+  800922:	74 20                	je     800944 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800924:	89 f8                	mov    %edi,%eax
+  800926:	09 c8                	or     %ecx,%eax
+  800928:	a8 03                	test   $0x3,%al
+  80092a:	75 12                	jne    80093e <memset+0x28>
+		c &= 0xFF;
+  80092c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800930:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800936:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800939:	fc                   	cld
+  80093a:	f3 ab                	rep stos %eax,%es:(%edi)
+  80093c:	eb 06                	jmp    800944 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80093e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800941:	fc                   	cld
+  800942:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800944:	89 f8                	mov    %edi,%eax
+  800946:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800949:	c9                   	leave
+  80094a:	c3                   	ret
+
+0080094b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80094b:	55                   	push   %ebp
+  80094c:	89 e5                	mov    %esp,%ebp
+  80094e:	57                   	push   %edi
+  80094f:	56                   	push   %esi
+  800950:	8b 45 08             	mov    0x8(%ebp),%eax
+  800953:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800956:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800959:	39 c6                	cmp    %eax,%esi
+  80095b:	73 32                	jae    80098f <memmove+0x44>
+  80095d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800960:	39 d0                	cmp    %edx,%eax
+  800962:	73 2b                	jae    80098f <memmove+0x44>
+		s += n;
+		d += n;
+  800964:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800967:	89 d6                	mov    %edx,%esi
+  800969:	09 fe                	or     %edi,%esi
+  80096b:	09 ce                	or     %ecx,%esi
+  80096d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800973:	75 0e                	jne    800983 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800975:	83 ef 04             	sub    $0x4,%edi
+  800978:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80097b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80097e:	fd                   	std
+  80097f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800981:	eb 09                	jmp    80098c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800983:	83 ef 01             	sub    $0x1,%edi
+  800986:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800989:	fd                   	std
+  80098a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80098c:	fc                   	cld
+  80098d:	eb 1a                	jmp    8009a9 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80098f:	89 f2                	mov    %esi,%edx
+  800991:	09 c2                	or     %eax,%edx
+  800993:	09 ca                	or     %ecx,%edx
+  800995:	f6 c2 03             	test   $0x3,%dl
+  800998:	75 0a                	jne    8009a4 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80099a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80099d:	89 c7                	mov    %eax,%edi
+  80099f:	fc                   	cld
+  8009a0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009a2:	eb 05                	jmp    8009a9 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009a4:	89 c7                	mov    %eax,%edi
+  8009a6:	fc                   	cld
+  8009a7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009a9:	5e                   	pop    %esi
+  8009aa:	5f                   	pop    %edi
+  8009ab:	5d                   	pop    %ebp
+  8009ac:	c3                   	ret
+
+008009ad <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009ad:	55                   	push   %ebp
+  8009ae:	89 e5                	mov    %esp,%ebp
+  8009b0:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009b3:	ff 75 10             	push   0x10(%ebp)
+  8009b6:	ff 75 0c             	push   0xc(%ebp)
+  8009b9:	ff 75 08             	push   0x8(%ebp)
+  8009bc:	e8 8a ff ff ff       	call   80094b <memmove>
+}
+  8009c1:	c9                   	leave
+  8009c2:	c3                   	ret
+
+008009c3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009c3:	55                   	push   %ebp
+  8009c4:	89 e5                	mov    %esp,%ebp
+  8009c6:	56                   	push   %esi
+  8009c7:	53                   	push   %ebx
+  8009c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009ce:	89 c6                	mov    %eax,%esi
+  8009d0:	03 75 10             	add    0x10(%ebp),%esi
+  8009d3:	eb 06                	jmp    8009db <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009d5:	83 c0 01             	add    $0x1,%eax
+  8009d8:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009db:	39 f0                	cmp    %esi,%eax
+  8009dd:	74 14                	je     8009f3 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009df:	0f b6 08             	movzbl (%eax),%ecx
+  8009e2:	0f b6 1a             	movzbl (%edx),%ebx
+  8009e5:	38 d9                	cmp    %bl,%cl
+  8009e7:	74 ec                	je     8009d5 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009e9:	0f b6 c1             	movzbl %cl,%eax
+  8009ec:	0f b6 db             	movzbl %bl,%ebx
+  8009ef:	29 d8                	sub    %ebx,%eax
+  8009f1:	eb 05                	jmp    8009f8 <memcmp+0x35>
+	}
+
+	return 0;
+  8009f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f8:	5b                   	pop    %ebx
+  8009f9:	5e                   	pop    %esi
+  8009fa:	5d                   	pop    %ebp
+  8009fb:	c3                   	ret
+
+008009fc <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009fc:	55                   	push   %ebp
+  8009fd:	89 e5                	mov    %esp,%ebp
+  8009ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a05:	89 c2                	mov    %eax,%edx
+  800a07:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a0a:	eb 03                	jmp    800a0f <memfind+0x13>
+  800a0c:	83 c0 01             	add    $0x1,%eax
+  800a0f:	39 d0                	cmp    %edx,%eax
+  800a11:	73 04                	jae    800a17 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a13:	38 08                	cmp    %cl,(%eax)
+  800a15:	75 f5                	jne    800a0c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a17:	5d                   	pop    %ebp
+  800a18:	c3                   	ret
+
+00800a19 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a19:	55                   	push   %ebp
+  800a1a:	89 e5                	mov    %esp,%ebp
+  800a1c:	57                   	push   %edi
+  800a1d:	56                   	push   %esi
+  800a1e:	53                   	push   %ebx
+  800a1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a22:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a25:	eb 03                	jmp    800a2a <strtol+0x11>
+		s++;
+  800a27:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a2a:	0f b6 02             	movzbl (%edx),%eax
+  800a2d:	3c 20                	cmp    $0x20,%al
+  800a2f:	74 f6                	je     800a27 <strtol+0xe>
+  800a31:	3c 09                	cmp    $0x9,%al
+  800a33:	74 f2                	je     800a27 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a35:	3c 2b                	cmp    $0x2b,%al
+  800a37:	74 2a                	je     800a63 <strtol+0x4a>
+	int neg = 0;
+  800a39:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a3e:	3c 2d                	cmp    $0x2d,%al
+  800a40:	74 2b                	je     800a6d <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a42:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a48:	75 0f                	jne    800a59 <strtol+0x40>
+  800a4a:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a4d:	74 28                	je     800a77 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a4f:	85 db                	test   %ebx,%ebx
+  800a51:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a56:	0f 44 d8             	cmove  %eax,%ebx
+  800a59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a5e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a61:	eb 46                	jmp    800aa9 <strtol+0x90>
+		s++;
+  800a63:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a66:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a6b:	eb d5                	jmp    800a42 <strtol+0x29>
+		s++, neg = 1;
+  800a6d:	83 c2 01             	add    $0x1,%edx
+  800a70:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a75:	eb cb                	jmp    800a42 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a77:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a7b:	74 0e                	je     800a8b <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a7d:	85 db                	test   %ebx,%ebx
+  800a7f:	75 d8                	jne    800a59 <strtol+0x40>
+		s++, base = 8;
+  800a81:	83 c2 01             	add    $0x1,%edx
+  800a84:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a89:	eb ce                	jmp    800a59 <strtol+0x40>
+		s += 2, base = 16;
+  800a8b:	83 c2 02             	add    $0x2,%edx
+  800a8e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a93:	eb c4                	jmp    800a59 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a95:	0f be c0             	movsbl %al,%eax
+  800a98:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a9b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a9e:	7d 3a                	jge    800ada <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800aa0:	83 c2 01             	add    $0x1,%edx
+  800aa3:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800aa7:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800aa9:	0f b6 02             	movzbl (%edx),%eax
+  800aac:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800aaf:	89 f3                	mov    %esi,%ebx
+  800ab1:	80 fb 09             	cmp    $0x9,%bl
+  800ab4:	76 df                	jbe    800a95 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ab6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ab9:	89 f3                	mov    %esi,%ebx
+  800abb:	80 fb 19             	cmp    $0x19,%bl
+  800abe:	77 08                	ja     800ac8 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ac0:	0f be c0             	movsbl %al,%eax
+  800ac3:	83 e8 57             	sub    $0x57,%eax
+  800ac6:	eb d3                	jmp    800a9b <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ac8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800acb:	89 f3                	mov    %esi,%ebx
+  800acd:	80 fb 19             	cmp    $0x19,%bl
+  800ad0:	77 08                	ja     800ada <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ad2:	0f be c0             	movsbl %al,%eax
+  800ad5:	83 e8 37             	sub    $0x37,%eax
+  800ad8:	eb c1                	jmp    800a9b <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ada:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ade:	74 05                	je     800ae5 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ae0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ae3:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ae5:	89 c8                	mov    %ecx,%eax
+  800ae7:	f7 d8                	neg    %eax
+  800ae9:	85 ff                	test   %edi,%edi
+  800aeb:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aee:	89 c8                	mov    %ecx,%eax
+  800af0:	5b                   	pop    %ebx
+  800af1:	5e                   	pop    %esi
+  800af2:	5f                   	pop    %edi
+  800af3:	5d                   	pop    %ebp
+  800af4:	c3                   	ret
+
+00800af5 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800af5:	55                   	push   %ebp
+  800af6:	89 e5                	mov    %esp,%ebp
+  800af8:	57                   	push   %edi
+  800af9:	56                   	push   %esi
+  800afa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800afb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b06:	89 c3                	mov    %eax,%ebx
+  800b08:	89 c7                	mov    %eax,%edi
+  800b0a:	55                   	push   %ebp
+  800b0b:	89 e5                	mov    %esp,%ebp
+  800b0d:	8d 35 15 0b 80 00    	lea    0x800b15,%esi
+  800b13:	0f 34                	sysenter
+  800b15:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800b16:	5b                   	pop    %ebx
+  800b17:	5e                   	pop    %esi
+  800b18:	5f                   	pop    %edi
+  800b19:	5d                   	pop    %ebp
+  800b1a:	c3                   	ret
+
+00800b1b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b1b:	55                   	push   %ebp
+  800b1c:	89 e5                	mov    %esp,%ebp
+  800b1e:	57                   	push   %edi
+  800b1f:	56                   	push   %esi
+  800b20:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b26:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b2b:	89 d1                	mov    %edx,%ecx
+  800b2d:	89 d3                	mov    %edx,%ebx
+  800b2f:	89 d7                	mov    %edx,%edi
+  800b31:	55                   	push   %ebp
+  800b32:	89 e5                	mov    %esp,%ebp
+  800b34:	8d 35 3c 0b 80 00    	lea    0x800b3c,%esi
+  800b3a:	0f 34                	sysenter
+  800b3c:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800b3d:	5b                   	pop    %ebx
+  800b3e:	5e                   	pop    %esi
+  800b3f:	5f                   	pop    %edi
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+
+00800b42 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	57                   	push   %edi
+  800b46:	56                   	push   %esi
+  800b47:	53                   	push   %ebx
+  800b48:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b53:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b58:	89 cb                	mov    %ecx,%ebx
+  800b5a:	89 cf                	mov    %ecx,%edi
+  800b5c:	55                   	push   %ebp
+  800b5d:	89 e5                	mov    %esp,%ebp
+  800b5f:	8d 35 67 0b 80 00    	lea    0x800b67,%esi
+  800b65:	0f 34                	sysenter
+  800b67:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b68:	85 c0                	test   %eax,%eax
+  800b6a:	7f 08                	jg     800b74 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800b6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b6f:	5b                   	pop    %ebx
+  800b70:	5e                   	pop    %esi
+  800b71:	5f                   	pop    %edi
+  800b72:	5d                   	pop    %ebp
+  800b73:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b74:	83 ec 0c             	sub    $0xc,%esp
+  800b77:	50                   	push   %eax
+  800b78:	6a 03                	push   $0x3
+  800b7a:	68 87 3c 80 00       	push   $0x803c87
+  800b7f:	6a 3d                	push   $0x3d
+  800b81:	68 a4 3c 80 00       	push   $0x803ca4
+  800b86:	e8 71 f5 ff ff       	call   8000fc <_panic>
+
+00800b8b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b8b:	55                   	push   %ebp
+  800b8c:	89 e5                	mov    %esp,%ebp
+  800b8e:	57                   	push   %edi
+  800b8f:	56                   	push   %esi
+  800b90:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b91:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b96:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b9b:	89 d1                	mov    %edx,%ecx
+  800b9d:	89 d3                	mov    %edx,%ebx
+  800b9f:	89 d7                	mov    %edx,%edi
+  800ba1:	55                   	push   %ebp
+  800ba2:	89 e5                	mov    %esp,%ebp
+  800ba4:	8d 35 ac 0b 80 00    	lea    0x800bac,%esi
+  800baa:	0f 34                	sysenter
+  800bac:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800bad:	5b                   	pop    %ebx
+  800bae:	5e                   	pop    %esi
+  800baf:	5f                   	pop    %edi
+  800bb0:	5d                   	pop    %ebp
+  800bb1:	c3                   	ret
+
+00800bb2 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bb2:	55                   	push   %ebp
+  800bb3:	89 e5                	mov    %esp,%ebp
+  800bb5:	57                   	push   %edi
+  800bb6:	56                   	push   %esi
+  800bb7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bbd:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bc2:	89 d1                	mov    %edx,%ecx
+  800bc4:	89 d3                	mov    %edx,%ebx
+  800bc6:	89 d7                	mov    %edx,%edi
+  800bc8:	89 d6                	mov    %edx,%esi
+  800bca:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bcc:	5b                   	pop    %ebx
+  800bcd:	5e                   	pop    %esi
+  800bce:	5f                   	pop    %edi
+  800bcf:	5d                   	pop    %ebp
+  800bd0:	c3                   	ret
+
+00800bd1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bd1:	55                   	push   %ebp
+  800bd2:	89 e5                	mov    %esp,%ebp
+  800bd4:	57                   	push   %edi
+  800bd5:	56                   	push   %esi
+  800bd6:	53                   	push   %ebx
+  800bd7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800bda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bdd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800be5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bed:	55                   	push   %ebp
+  800bee:	89 e5                	mov    %esp,%ebp
+  800bf0:	8d 35 f8 0b 80 00    	lea    0x800bf8,%esi
+  800bf6:	0f 34                	sysenter
+  800bf8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bf9:	85 c0                	test   %eax,%eax
+  800bfb:	7f 08                	jg     800c05 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800bfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c00:	5b                   	pop    %ebx
+  800c01:	5e                   	pop    %esi
+  800c02:	5f                   	pop    %edi
+  800c03:	5d                   	pop    %ebp
+  800c04:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c05:	83 ec 0c             	sub    $0xc,%esp
+  800c08:	50                   	push   %eax
+  800c09:	6a 04                	push   $0x4
+  800c0b:	68 87 3c 80 00       	push   $0x803c87
+  800c10:	6a 3d                	push   $0x3d
+  800c12:	68 a4 3c 80 00       	push   $0x803ca4
+  800c17:	e8 e0 f4 ff ff       	call   8000fc <_panic>
+
+00800c1c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c1c:	55                   	push   %ebp
+  800c1d:	89 e5                	mov    %esp,%ebp
+  800c1f:	57                   	push   %edi
+  800c20:	56                   	push   %esi
+  800c21:	53                   	push   %ebx
+  800c22:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c33:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c36:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c39:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c3b:	85 c0                	test   %eax,%eax
+  800c3d:	7f 08                	jg     800c47 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c42:	5b                   	pop    %ebx
+  800c43:	5e                   	pop    %esi
+  800c44:	5f                   	pop    %edi
+  800c45:	5d                   	pop    %ebp
+  800c46:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c47:	83 ec 0c             	sub    $0xc,%esp
+  800c4a:	50                   	push   %eax
+  800c4b:	6a 05                	push   $0x5
+  800c4d:	68 87 3c 80 00       	push   $0x803c87
+  800c52:	6a 23                	push   $0x23
+  800c54:	68 a4 3c 80 00       	push   $0x803ca4
+  800c59:	e8 9e f4 ff ff       	call   8000fc <_panic>
+
+00800c5e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c5e:	55                   	push   %ebp
+  800c5f:	89 e5                	mov    %esp,%ebp
+  800c61:	57                   	push   %edi
+  800c62:	56                   	push   %esi
+  800c63:	53                   	push   %ebx
+  800c64:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c72:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c77:	89 df                	mov    %ebx,%edi
+  800c79:	55                   	push   %ebp
+  800c7a:	89 e5                	mov    %esp,%ebp
+  800c7c:	8d 35 84 0c 80 00    	lea    0x800c84,%esi
+  800c82:	0f 34                	sysenter
+  800c84:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c85:	85 c0                	test   %eax,%eax
+  800c87:	7f 08                	jg     800c91 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800c89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c8c:	5b                   	pop    %ebx
+  800c8d:	5e                   	pop    %esi
+  800c8e:	5f                   	pop    %edi
+  800c8f:	5d                   	pop    %ebp
+  800c90:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c91:	83 ec 0c             	sub    $0xc,%esp
+  800c94:	50                   	push   %eax
+  800c95:	6a 06                	push   $0x6
+  800c97:	68 87 3c 80 00       	push   $0x803c87
+  800c9c:	6a 3d                	push   $0x3d
+  800c9e:	68 a4 3c 80 00       	push   $0x803ca4
+  800ca3:	e8 54 f4 ff ff       	call   8000fc <_panic>
+
+00800ca8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ca8:	55                   	push   %ebp
+  800ca9:	89 e5                	mov    %esp,%ebp
+  800cab:	57                   	push   %edi
+  800cac:	56                   	push   %esi
+  800cad:	53                   	push   %ebx
+  800cae:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbc:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cc1:	89 df                	mov    %ebx,%edi
+  800cc3:	55                   	push   %ebp
+  800cc4:	89 e5                	mov    %esp,%ebp
+  800cc6:	8d 35 ce 0c 80 00    	lea    0x800cce,%esi
+  800ccc:	0f 34                	sysenter
+  800cce:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ccf:	85 c0                	test   %eax,%eax
+  800cd1:	7f 08                	jg     800cdb <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800cd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd6:	5b                   	pop    %ebx
+  800cd7:	5e                   	pop    %esi
+  800cd8:	5f                   	pop    %edi
+  800cd9:	5d                   	pop    %ebp
+  800cda:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cdb:	83 ec 0c             	sub    $0xc,%esp
+  800cde:	50                   	push   %eax
+  800cdf:	6a 08                	push   $0x8
+  800ce1:	68 87 3c 80 00       	push   $0x803c87
+  800ce6:	6a 3d                	push   $0x3d
+  800ce8:	68 a4 3c 80 00       	push   $0x803ca4
+  800ced:	e8 0a f4 ff ff       	call   8000fc <_panic>
+
+00800cf2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800cf2:	55                   	push   %ebp
+  800cf3:	89 e5                	mov    %esp,%ebp
+  800cf5:	57                   	push   %edi
+  800cf6:	56                   	push   %esi
+  800cf7:	53                   	push   %ebx
+  800cf8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d06:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d0b:	89 df                	mov    %ebx,%edi
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	8d 35 18 0d 80 00    	lea    0x800d18,%esi
+  800d16:	0f 34                	sysenter
+  800d18:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d19:	85 c0                	test   %eax,%eax
+  800d1b:	7f 08                	jg     800d25 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800d1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d20:	5b                   	pop    %ebx
+  800d21:	5e                   	pop    %esi
+  800d22:	5f                   	pop    %edi
+  800d23:	5d                   	pop    %ebp
+  800d24:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d25:	83 ec 0c             	sub    $0xc,%esp
+  800d28:	50                   	push   %eax
+  800d29:	6a 09                	push   $0x9
+  800d2b:	68 87 3c 80 00       	push   $0x803c87
+  800d30:	6a 3d                	push   $0x3d
+  800d32:	68 a4 3c 80 00       	push   $0x803ca4
+  800d37:	e8 c0 f3 ff ff       	call   8000fc <_panic>
+
+00800d3c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d3c:	55                   	push   %ebp
+  800d3d:	89 e5                	mov    %esp,%ebp
+  800d3f:	57                   	push   %edi
+  800d40:	56                   	push   %esi
+  800d41:	53                   	push   %ebx
+  800d42:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d50:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d55:	89 df                	mov    %ebx,%edi
+  800d57:	55                   	push   %ebp
+  800d58:	89 e5                	mov    %esp,%ebp
+  800d5a:	8d 35 62 0d 80 00    	lea    0x800d62,%esi
+  800d60:	0f 34                	sysenter
+  800d62:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d63:	85 c0                	test   %eax,%eax
+  800d65:	7f 08                	jg     800d6f <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800d67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6a:	5b                   	pop    %ebx
+  800d6b:	5e                   	pop    %esi
+  800d6c:	5f                   	pop    %edi
+  800d6d:	5d                   	pop    %ebp
+  800d6e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d6f:	83 ec 0c             	sub    $0xc,%esp
+  800d72:	50                   	push   %eax
+  800d73:	6a 0a                	push   $0xa
+  800d75:	68 87 3c 80 00       	push   $0x803c87
+  800d7a:	6a 3d                	push   $0x3d
+  800d7c:	68 a4 3c 80 00       	push   $0x803ca4
+  800d81:	e8 76 f3 ff ff       	call   8000fc <_panic>
+
+00800d86 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	57                   	push   %edi
+  800d8a:	56                   	push   %esi
+  800d8b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d92:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d9a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d9d:	55                   	push   %ebp
+  800d9e:	89 e5                	mov    %esp,%ebp
+  800da0:	8d 35 a8 0d 80 00    	lea    0x800da8,%esi
+  800da6:	0f 34                	sysenter
+  800da8:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800da9:	5b                   	pop    %ebx
+  800daa:	5e                   	pop    %esi
+  800dab:	5f                   	pop    %edi
+  800dac:	5d                   	pop    %ebp
+  800dad:	c3                   	ret
+
+00800dae <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800dae:	55                   	push   %ebp
+  800daf:	89 e5                	mov    %esp,%ebp
+  800db1:	57                   	push   %edi
+  800db2:	56                   	push   %esi
+  800db3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800db4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dba:	b8 17 00 00 00       	mov    $0x17,%eax
+  800dbf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc5:	55                   	push   %ebp
+  800dc6:	89 e5                	mov    %esp,%ebp
+  800dc8:	8d 35 d0 0d 80 00    	lea    0x800dd0,%esi
+  800dce:	0f 34                	sysenter
+  800dd0:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800dd1:	5b                   	pop    %ebx
+  800dd2:	5e                   	pop    %esi
+  800dd3:	5f                   	pop    %edi
+  800dd4:	5d                   	pop    %ebp
+  800dd5:	c3                   	ret
+
+00800dd6 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800dd6:	55                   	push   %ebp
+  800dd7:	89 e5                	mov    %esp,%ebp
+  800dd9:	57                   	push   %edi
+  800dda:	56                   	push   %esi
+  800ddb:	53                   	push   %ebx
+  800ddc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ddf:	be 00 00 00 00       	mov    $0x0,%esi
+  800de4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dea:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800def:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df2:	89 f7                	mov    %esi,%edi
+  800df4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800df6:	85 c0                	test   %eax,%eax
+  800df8:	7f 08                	jg     800e02 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800dfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dfd:	5b                   	pop    %ebx
+  800dfe:	5e                   	pop    %esi
+  800dff:	5f                   	pop    %edi
+  800e00:	5d                   	pop    %ebp
+  800e01:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e02:	83 ec 0c             	sub    $0xc,%esp
+  800e05:	50                   	push   %eax
+  800e06:	6a 0d                	push   $0xd
+  800e08:	68 87 3c 80 00       	push   $0x803c87
+  800e0d:	6a 23                	push   $0x23
+  800e0f:	68 a4 3c 80 00       	push   $0x803ca4
+  800e14:	e8 e3 f2 ff ff       	call   8000fc <_panic>
+
+00800e19 <sys_ipc_recv>:
+{
+  800e19:	55                   	push   %ebp
+  800e1a:	89 e5                	mov    %esp,%ebp
+  800e1c:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800e1f:	6a 00                	push   $0x0
+  800e21:	6a 01                	push   $0x1
+  800e23:	ff 75 08             	push   0x8(%ebp)
+  800e26:	e8 ab ff ff ff       	call   800dd6 <sys_ipc_recvv>
+}
+  800e2b:	c9                   	leave
+  800e2c:	c3                   	ret
+
+00800e2d <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800e2d:	55                   	push   %ebp
+  800e2e:	89 e5                	mov    %esp,%ebp
+  800e30:	57                   	push   %edi
+  800e31:	56                   	push   %esi
+  800e32:	53                   	push   %ebx
+  800e33:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e41:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e46:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e49:	89 de                	mov    %ebx,%esi
+  800e4b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e4d:	85 c0                	test   %eax,%eax
+  800e4f:	7f 08                	jg     800e59 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800e51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e54:	5b                   	pop    %ebx
+  800e55:	5e                   	pop    %esi
+  800e56:	5f                   	pop    %edi
+  800e57:	5d                   	pop    %ebp
+  800e58:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e59:	83 ec 0c             	sub    $0xc,%esp
+  800e5c:	50                   	push   %eax
+  800e5d:	6a 0d                	push   $0xd
+  800e5f:	68 87 3c 80 00       	push   $0x803c87
+  800e64:	6a 23                	push   $0x23
+  800e66:	68 a4 3c 80 00       	push   $0x803ca4
+  800e6b:	e8 8c f2 ff ff       	call   8000fc <_panic>
+
+00800e70 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e70:	55                   	push   %ebp
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	57                   	push   %edi
+  800e74:	56                   	push   %esi
+  800e75:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e80:	89 d1                	mov    %edx,%ecx
+  800e82:	89 d3                	mov    %edx,%ebx
+  800e84:	89 d7                	mov    %edx,%edi
+  800e86:	55                   	push   %ebp
+  800e87:	89 e5                	mov    %esp,%ebp
+  800e89:	8d 35 91 0e 80 00    	lea    0x800e91,%esi
+  800e8f:	0f 34                	sysenter
+  800e91:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800e92:	5b                   	pop    %ebx
+  800e93:	5e                   	pop    %esi
+  800e94:	5f                   	pop    %edi
+  800e95:	5d                   	pop    %ebp
+  800e96:	c3                   	ret
+
+00800e97 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	57                   	push   %edi
+  800e9b:	56                   	push   %esi
+  800e9c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ead:	89 df                	mov    %ebx,%edi
+  800eaf:	55                   	push   %ebp
+  800eb0:	89 e5                	mov    %esp,%ebp
+  800eb2:	8d 35 ba 0e 80 00    	lea    0x800eba,%esi
+  800eb8:	0f 34                	sysenter
+  800eba:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800ebb:	5b                   	pop    %ebx
+  800ebc:	5e                   	pop    %esi
+  800ebd:	5f                   	pop    %edi
+  800ebe:	5d                   	pop    %ebp
+  800ebf:	c3                   	ret
+
+00800ec0 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800ec0:	55                   	push   %ebp
+  800ec1:	89 e5                	mov    %esp,%ebp
+  800ec3:	57                   	push   %edi
+  800ec4:	56                   	push   %esi
+  800ec5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ec6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ecb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ece:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ed3:	89 cb                	mov    %ecx,%ebx
+  800ed5:	89 cf                	mov    %ecx,%edi
+  800ed7:	55                   	push   %ebp
+  800ed8:	89 e5                	mov    %esp,%ebp
+  800eda:	8d 35 e2 0e 80 00    	lea    0x800ee2,%esi
+  800ee0:	0f 34                	sysenter
+  800ee2:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800ee3:	5b                   	pop    %ebx
+  800ee4:	5e                   	pop    %esi
+  800ee5:	5f                   	pop    %edi
+  800ee6:	5d                   	pop    %ebp
+  800ee7:	c3                   	ret
+
+00800ee8 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800ee8:	55                   	push   %ebp
+  800ee9:	89 e5                	mov    %esp,%ebp
+  800eeb:	57                   	push   %edi
+  800eec:	56                   	push   %esi
+  800eed:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef9:	b8 12 00 00 00       	mov    $0x12,%eax
+  800efe:	89 df                	mov    %ebx,%edi
+  800f00:	55                   	push   %ebp
+  800f01:	89 e5                	mov    %esp,%ebp
+  800f03:	8d 35 0b 0f 80 00    	lea    0x800f0b,%esi
+  800f09:	0f 34                	sysenter
+  800f0b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800f0c:	5b                   	pop    %ebx
+  800f0d:	5e                   	pop    %esi
+  800f0e:	5f                   	pop    %edi
+  800f0f:	5d                   	pop    %ebp
+  800f10:	c3                   	ret
+
+00800f11 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800f11:	55                   	push   %ebp
+  800f12:	89 e5                	mov    %esp,%ebp
+  800f14:	57                   	push   %edi
+  800f15:	56                   	push   %esi
+  800f16:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f22:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f27:	89 df                	mov    %ebx,%edi
+  800f29:	55                   	push   %ebp
+  800f2a:	89 e5                	mov    %esp,%ebp
+  800f2c:	8d 35 34 0f 80 00    	lea    0x800f34,%esi
+  800f32:	0f 34                	sysenter
+  800f34:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800f35:	5b                   	pop    %ebx
+  800f36:	5e                   	pop    %esi
+  800f37:	5f                   	pop    %edi
+  800f38:	5d                   	pop    %ebp
+  800f39:	c3                   	ret
+
+00800f3a <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800f3a:	55                   	push   %ebp
+  800f3b:	89 e5                	mov    %esp,%ebp
+  800f3d:	57                   	push   %edi
+  800f3e:	56                   	push   %esi
+  800f3f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f46:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f4e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f51:	55                   	push   %ebp
+  800f52:	89 e5                	mov    %esp,%ebp
+  800f54:	8d 35 5c 0f 80 00    	lea    0x800f5c,%esi
+  800f5a:	0f 34                	sysenter
+  800f5c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800f5d:	5b                   	pop    %ebx
+  800f5e:	5e                   	pop    %esi
+  800f5f:	5f                   	pop    %edi
+  800f60:	5d                   	pop    %ebp
+  800f61:	c3                   	ret
+
+00800f62 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+  800f65:	57                   	push   %edi
+  800f66:	56                   	push   %esi
+  800f67:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f70:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f75:	89 cb                	mov    %ecx,%ebx
+  800f77:	89 cf                	mov    %ecx,%edi
+  800f79:	89 ce                	mov    %ecx,%esi
+  800f7b:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800f7d:	5b                   	pop    %ebx
+  800f7e:	5e                   	pop    %esi
+  800f7f:	5f                   	pop    %edi
+  800f80:	5d                   	pop    %ebp
+  800f81:	c3                   	ret
+
+00800f82 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800f82:	55                   	push   %ebp
+  800f83:	89 e5                	mov    %esp,%ebp
+  800f85:	57                   	push   %edi
+  800f86:	56                   	push   %esi
+  800f87:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f90:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f95:	89 cb                	mov    %ecx,%ebx
+  800f97:	89 cf                	mov    %ecx,%edi
+  800f99:	55                   	push   %ebp
+  800f9a:	89 e5                	mov    %esp,%ebp
+  800f9c:	8d 35 a4 0f 80 00    	lea    0x800fa4,%esi
+  800fa2:	0f 34                	sysenter
+  800fa4:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800fa5:	5b                   	pop    %ebx
+  800fa6:	5e                   	pop    %esi
+  800fa7:	5f                   	pop    %edi
+  800fa8:	5d                   	pop    %ebp
+  800fa9:	c3                   	ret
+
+00800faa <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800faa:	55                   	push   %ebp
+  800fab:	89 e5                	mov    %esp,%ebp
+  800fad:	57                   	push   %edi
+  800fae:	56                   	push   %esi
+  800faf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb8:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fbd:	89 cb                	mov    %ecx,%ebx
+  800fbf:	89 cf                	mov    %ecx,%edi
+  800fc1:	55                   	push   %ebp
+  800fc2:	89 e5                	mov    %esp,%ebp
+  800fc4:	8d 35 cc 0f 80 00    	lea    0x800fcc,%esi
+  800fca:	0f 34                	sysenter
+  800fcc:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800fcd:	5b                   	pop    %ebx
+  800fce:	5e                   	pop    %esi
+  800fcf:	5f                   	pop    %edi
+  800fd0:	5d                   	pop    %ebp
+  800fd1:	c3                   	ret
+
+00800fd2 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800fd2:	55                   	push   %ebp
+  800fd3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fd8:	05 00 00 00 30       	add    $0x30000000,%eax
+  800fdd:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800fe0:	5d                   	pop    %ebp
+  800fe1:	c3                   	ret
+
+00800fe2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800fe2:	55                   	push   %ebp
+  800fe3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fe5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fe8:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800fed:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800ff2:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800ff7:	5d                   	pop    %ebp
+  800ff8:	c3                   	ret
+
+00800ff9 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800ff9:	55                   	push   %ebp
+  800ffa:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800ffc:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801001:	eb 02                	jmp    801005 <fd_alloc+0xc>
+  801003:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801005:	89 c2                	mov    %eax,%edx
+  801007:	c1 ea 16             	shr    $0x16,%edx
+  80100a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801011:	f6 c2 01             	test   $0x1,%dl
+  801014:	74 2b                	je     801041 <fd_alloc+0x48>
+  801016:	89 c2                	mov    %eax,%edx
+  801018:	c1 ea 0c             	shr    $0xc,%edx
+  80101b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801022:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801028:	f6 c1 01             	test   $0x1,%cl
+  80102b:	74 14                	je     801041 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80102d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801033:	75 ce                	jne    801003 <fd_alloc+0xa>
+  801035:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80103a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80103f:	eb 05                	jmp    801046 <fd_alloc+0x4d>
+			return 0;
+  801041:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801046:	8b 55 08             	mov    0x8(%ebp),%edx
+  801049:	89 02                	mov    %eax,(%edx)
+}
+  80104b:	89 c8                	mov    %ecx,%eax
+  80104d:	5d                   	pop    %ebp
+  80104e:	c3                   	ret
+
+0080104f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80104f:	55                   	push   %ebp
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801055:	83 f8 1f             	cmp    $0x1f,%eax
+  801058:	77 30                	ja     80108a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80105a:	c1 e0 0c             	shl    $0xc,%eax
+  80105d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801062:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801068:	f6 c2 01             	test   $0x1,%dl
+  80106b:	74 24                	je     801091 <fd_lookup+0x42>
+  80106d:	89 c2                	mov    %eax,%edx
+  80106f:	c1 ea 0c             	shr    $0xc,%edx
+  801072:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801079:	f6 c2 01             	test   $0x1,%dl
+  80107c:	74 1a                	je     801098 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80107e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801081:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801083:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801088:	5d                   	pop    %ebp
+  801089:	c3                   	ret
+		return -E_INVAL;
+  80108a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80108f:	eb f7                	jmp    801088 <fd_lookup+0x39>
+		return -E_INVAL;
+  801091:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801096:	eb f0                	jmp    801088 <fd_lookup+0x39>
+  801098:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80109d:	eb e9                	jmp    801088 <fd_lookup+0x39>
+
+0080109f <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80109f:	55                   	push   %ebp
+  8010a0:	89 e5                	mov    %esp,%ebp
+  8010a2:	53                   	push   %ebx
+  8010a3:	83 ec 04             	sub    $0x4,%esp
+  8010a6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8010a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ae:	eb 03                	jmp    8010b3 <dev_lookup+0x14>
+  8010b0:	83 c0 01             	add    $0x1,%eax
+  8010b3:	8b 1c 85 30 3d 80 00 	mov    0x803d30(,%eax,4),%ebx
+  8010ba:	85 db                	test   %ebx,%ebx
+  8010bc:	74 0b                	je     8010c9 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8010be:	39 13                	cmp    %edx,(%ebx)
+  8010c0:	75 ee                	jne    8010b0 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8010c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c7:	eb 1f                	jmp    8010e8 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8010c9:	a1 00 50 80 00       	mov    0x805000,%eax
+  8010ce:	8b 40 48             	mov    0x48(%eax),%eax
+  8010d1:	83 ec 04             	sub    $0x4,%esp
+  8010d4:	52                   	push   %edx
+  8010d5:	50                   	push   %eax
+  8010d6:	68 b4 3c 80 00       	push   $0x803cb4
+  8010db:	e8 f7 f0 ff ff       	call   8001d7 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8010e0:	83 c4 10             	add    $0x10,%esp
+  8010e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8010e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010eb:	89 1a                	mov    %ebx,(%edx)
+}
+  8010ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010f0:	c9                   	leave
+  8010f1:	c3                   	ret
+
+008010f2 <fd_close>:
+{
+  8010f2:	55                   	push   %ebp
+  8010f3:	89 e5                	mov    %esp,%ebp
+  8010f5:	57                   	push   %edi
+  8010f6:	56                   	push   %esi
+  8010f7:	53                   	push   %ebx
+  8010f8:	83 ec 24             	sub    $0x24,%esp
+  8010fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010fe:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801101:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801104:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801105:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80110b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80110e:	50                   	push   %eax
+  80110f:	e8 3b ff ff ff       	call   80104f <fd_lookup>
+  801114:	89 c3                	mov    %eax,%ebx
+  801116:	83 c4 10             	add    $0x10,%esp
+  801119:	85 c0                	test   %eax,%eax
+  80111b:	78 05                	js     801122 <fd_close+0x30>
+	    || fd != fd2)
+  80111d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801120:	74 16                	je     801138 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801122:	89 f8                	mov    %edi,%eax
+  801124:	84 c0                	test   %al,%al
+  801126:	b8 00 00 00 00       	mov    $0x0,%eax
+  80112b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80112e:	89 d8                	mov    %ebx,%eax
+  801130:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801133:	5b                   	pop    %ebx
+  801134:	5e                   	pop    %esi
+  801135:	5f                   	pop    %edi
+  801136:	5d                   	pop    %ebp
+  801137:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801138:	83 ec 08             	sub    $0x8,%esp
+  80113b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80113e:	50                   	push   %eax
+  80113f:	ff 36                	push   (%esi)
+  801141:	e8 59 ff ff ff       	call   80109f <dev_lookup>
+  801146:	89 c3                	mov    %eax,%ebx
+  801148:	83 c4 10             	add    $0x10,%esp
+  80114b:	85 c0                	test   %eax,%eax
+  80114d:	78 1a                	js     801169 <fd_close+0x77>
+		if (dev->dev_close)
+  80114f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801152:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801155:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80115a:	85 c0                	test   %eax,%eax
+  80115c:	74 0b                	je     801169 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80115e:	83 ec 0c             	sub    $0xc,%esp
+  801161:	56                   	push   %esi
+  801162:	ff d0                	call   *%eax
+  801164:	89 c3                	mov    %eax,%ebx
+  801166:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801169:	83 ec 08             	sub    $0x8,%esp
+  80116c:	56                   	push   %esi
+  80116d:	6a 00                	push   $0x0
+  80116f:	e8 ea fa ff ff       	call   800c5e <sys_page_unmap>
+	return r;
+  801174:	83 c4 10             	add    $0x10,%esp
+  801177:	eb b5                	jmp    80112e <fd_close+0x3c>
+
+00801179 <close>:
+
+int
+close(int fdnum)
+{
+  801179:	55                   	push   %ebp
+  80117a:	89 e5                	mov    %esp,%ebp
+  80117c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80117f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801182:	50                   	push   %eax
+  801183:	ff 75 08             	push   0x8(%ebp)
+  801186:	e8 c4 fe ff ff       	call   80104f <fd_lookup>
+  80118b:	83 c4 10             	add    $0x10,%esp
+  80118e:	85 c0                	test   %eax,%eax
+  801190:	79 02                	jns    801194 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801192:	c9                   	leave
+  801193:	c3                   	ret
+		return fd_close(fd, 1);
+  801194:	83 ec 08             	sub    $0x8,%esp
+  801197:	6a 01                	push   $0x1
+  801199:	ff 75 f4             	push   -0xc(%ebp)
+  80119c:	e8 51 ff ff ff       	call   8010f2 <fd_close>
+  8011a1:	83 c4 10             	add    $0x10,%esp
+  8011a4:	eb ec                	jmp    801192 <close+0x19>
+
+008011a6 <close_all>:
+
+void
+close_all(void)
+{
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	53                   	push   %ebx
+  8011aa:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8011ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8011b2:	83 ec 0c             	sub    $0xc,%esp
+  8011b5:	53                   	push   %ebx
+  8011b6:	e8 be ff ff ff       	call   801179 <close>
+	for (i = 0; i < MAXFD; i++)
+  8011bb:	83 c3 01             	add    $0x1,%ebx
+  8011be:	83 c4 10             	add    $0x10,%esp
+  8011c1:	83 fb 20             	cmp    $0x20,%ebx
+  8011c4:	75 ec                	jne    8011b2 <close_all+0xc>
+}
+  8011c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011c9:	c9                   	leave
+  8011ca:	c3                   	ret
+
+008011cb <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8011cb:	55                   	push   %ebp
+  8011cc:	89 e5                	mov    %esp,%ebp
+  8011ce:	57                   	push   %edi
+  8011cf:	56                   	push   %esi
+  8011d0:	53                   	push   %ebx
+  8011d1:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8011d4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011d7:	50                   	push   %eax
+  8011d8:	ff 75 08             	push   0x8(%ebp)
+  8011db:	e8 6f fe ff ff       	call   80104f <fd_lookup>
+  8011e0:	89 c3                	mov    %eax,%ebx
+  8011e2:	83 c4 10             	add    $0x10,%esp
+  8011e5:	85 c0                	test   %eax,%eax
+  8011e7:	78 7f                	js     801268 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8011e9:	83 ec 0c             	sub    $0xc,%esp
+  8011ec:	ff 75 0c             	push   0xc(%ebp)
+  8011ef:	e8 85 ff ff ff       	call   801179 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8011f4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8011f7:	c1 e6 0c             	shl    $0xc,%esi
+  8011fa:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801200:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801203:	89 3c 24             	mov    %edi,(%esp)
+  801206:	e8 d7 fd ff ff       	call   800fe2 <fd2data>
+  80120b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80120d:	89 34 24             	mov    %esi,(%esp)
+  801210:	e8 cd fd ff ff       	call   800fe2 <fd2data>
+  801215:	83 c4 10             	add    $0x10,%esp
+  801218:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80121b:	89 d8                	mov    %ebx,%eax
+  80121d:	c1 e8 16             	shr    $0x16,%eax
+  801220:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801227:	a8 01                	test   $0x1,%al
+  801229:	74 11                	je     80123c <dup+0x71>
+  80122b:	89 d8                	mov    %ebx,%eax
+  80122d:	c1 e8 0c             	shr    $0xc,%eax
+  801230:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801237:	f6 c2 01             	test   $0x1,%dl
+  80123a:	75 36                	jne    801272 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80123c:	89 f8                	mov    %edi,%eax
+  80123e:	c1 e8 0c             	shr    $0xc,%eax
+  801241:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801248:	83 ec 0c             	sub    $0xc,%esp
+  80124b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801250:	50                   	push   %eax
+  801251:	56                   	push   %esi
+  801252:	6a 00                	push   $0x0
+  801254:	57                   	push   %edi
+  801255:	6a 00                	push   $0x0
+  801257:	e8 c0 f9 ff ff       	call   800c1c <sys_page_map>
+  80125c:	89 c3                	mov    %eax,%ebx
+  80125e:	83 c4 20             	add    $0x20,%esp
+  801261:	85 c0                	test   %eax,%eax
+  801263:	78 33                	js     801298 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801265:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801268:	89 d8                	mov    %ebx,%eax
+  80126a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80126d:	5b                   	pop    %ebx
+  80126e:	5e                   	pop    %esi
+  80126f:	5f                   	pop    %edi
+  801270:	5d                   	pop    %ebp
+  801271:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801272:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801279:	83 ec 0c             	sub    $0xc,%esp
+  80127c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801281:	50                   	push   %eax
+  801282:	ff 75 d4             	push   -0x2c(%ebp)
+  801285:	6a 00                	push   $0x0
+  801287:	53                   	push   %ebx
+  801288:	6a 00                	push   $0x0
+  80128a:	e8 8d f9 ff ff       	call   800c1c <sys_page_map>
+  80128f:	89 c3                	mov    %eax,%ebx
+  801291:	83 c4 20             	add    $0x20,%esp
+  801294:	85 c0                	test   %eax,%eax
+  801296:	79 a4                	jns    80123c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801298:	83 ec 08             	sub    $0x8,%esp
+  80129b:	56                   	push   %esi
+  80129c:	6a 00                	push   $0x0
+  80129e:	e8 bb f9 ff ff       	call   800c5e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8012a3:	83 c4 08             	add    $0x8,%esp
+  8012a6:	ff 75 d4             	push   -0x2c(%ebp)
+  8012a9:	6a 00                	push   $0x0
+  8012ab:	e8 ae f9 ff ff       	call   800c5e <sys_page_unmap>
+	return r;
+  8012b0:	83 c4 10             	add    $0x10,%esp
+  8012b3:	eb b3                	jmp    801268 <dup+0x9d>
+
+008012b5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8012b5:	55                   	push   %ebp
+  8012b6:	89 e5                	mov    %esp,%ebp
+  8012b8:	56                   	push   %esi
+  8012b9:	53                   	push   %ebx
+  8012ba:	83 ec 18             	sub    $0x18,%esp
+  8012bd:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012c0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012c3:	50                   	push   %eax
+  8012c4:	56                   	push   %esi
+  8012c5:	e8 85 fd ff ff       	call   80104f <fd_lookup>
+  8012ca:	83 c4 10             	add    $0x10,%esp
+  8012cd:	85 c0                	test   %eax,%eax
+  8012cf:	78 3c                	js     80130d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012d1:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8012d4:	83 ec 08             	sub    $0x8,%esp
+  8012d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012da:	50                   	push   %eax
+  8012db:	ff 33                	push   (%ebx)
+  8012dd:	e8 bd fd ff ff       	call   80109f <dev_lookup>
+  8012e2:	83 c4 10             	add    $0x10,%esp
+  8012e5:	85 c0                	test   %eax,%eax
+  8012e7:	78 24                	js     80130d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8012e9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012ec:	83 e0 03             	and    $0x3,%eax
+  8012ef:	83 f8 01             	cmp    $0x1,%eax
+  8012f2:	74 20                	je     801314 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8012f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012f7:	8b 40 08             	mov    0x8(%eax),%eax
+  8012fa:	85 c0                	test   %eax,%eax
+  8012fc:	74 37                	je     801335 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8012fe:	83 ec 04             	sub    $0x4,%esp
+  801301:	ff 75 10             	push   0x10(%ebp)
+  801304:	ff 75 0c             	push   0xc(%ebp)
+  801307:	53                   	push   %ebx
+  801308:	ff d0                	call   *%eax
+  80130a:	83 c4 10             	add    $0x10,%esp
+}
+  80130d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801310:	5b                   	pop    %ebx
+  801311:	5e                   	pop    %esi
+  801312:	5d                   	pop    %ebp
+  801313:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801314:	a1 00 50 80 00       	mov    0x805000,%eax
+  801319:	8b 40 48             	mov    0x48(%eax),%eax
+  80131c:	83 ec 04             	sub    $0x4,%esp
+  80131f:	56                   	push   %esi
+  801320:	50                   	push   %eax
+  801321:	68 f5 3c 80 00       	push   $0x803cf5
+  801326:	e8 ac ee ff ff       	call   8001d7 <cprintf>
+		return -E_INVAL;
+  80132b:	83 c4 10             	add    $0x10,%esp
+  80132e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801333:	eb d8                	jmp    80130d <read+0x58>
+		return -E_NOT_SUPP;
+  801335:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80133a:	eb d1                	jmp    80130d <read+0x58>
+
+0080133c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80133c:	55                   	push   %ebp
+  80133d:	89 e5                	mov    %esp,%ebp
+  80133f:	57                   	push   %edi
+  801340:	56                   	push   %esi
+  801341:	53                   	push   %ebx
+  801342:	83 ec 0c             	sub    $0xc,%esp
+  801345:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801348:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80134b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801350:	eb 02                	jmp    801354 <readn+0x18>
+  801352:	01 c3                	add    %eax,%ebx
+  801354:	39 f3                	cmp    %esi,%ebx
+  801356:	73 21                	jae    801379 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801358:	83 ec 04             	sub    $0x4,%esp
+  80135b:	89 f0                	mov    %esi,%eax
+  80135d:	29 d8                	sub    %ebx,%eax
+  80135f:	50                   	push   %eax
+  801360:	89 d8                	mov    %ebx,%eax
+  801362:	03 45 0c             	add    0xc(%ebp),%eax
+  801365:	50                   	push   %eax
+  801366:	57                   	push   %edi
+  801367:	e8 49 ff ff ff       	call   8012b5 <read>
+		if (m < 0)
+  80136c:	83 c4 10             	add    $0x10,%esp
+  80136f:	85 c0                	test   %eax,%eax
+  801371:	78 04                	js     801377 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801373:	75 dd                	jne    801352 <readn+0x16>
+  801375:	eb 02                	jmp    801379 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801377:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801379:	89 d8                	mov    %ebx,%eax
+  80137b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137e:	5b                   	pop    %ebx
+  80137f:	5e                   	pop    %esi
+  801380:	5f                   	pop    %edi
+  801381:	5d                   	pop    %ebp
+  801382:	c3                   	ret
+
+00801383 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801383:	55                   	push   %ebp
+  801384:	89 e5                	mov    %esp,%ebp
+  801386:	56                   	push   %esi
+  801387:	53                   	push   %ebx
+  801388:	83 ec 18             	sub    $0x18,%esp
+  80138b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80138e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801391:	50                   	push   %eax
+  801392:	53                   	push   %ebx
+  801393:	e8 b7 fc ff ff       	call   80104f <fd_lookup>
+  801398:	83 c4 10             	add    $0x10,%esp
+  80139b:	85 c0                	test   %eax,%eax
+  80139d:	78 37                	js     8013d6 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80139f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013a2:	83 ec 08             	sub    $0x8,%esp
+  8013a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013a8:	50                   	push   %eax
+  8013a9:	ff 36                	push   (%esi)
+  8013ab:	e8 ef fc ff ff       	call   80109f <dev_lookup>
+  8013b0:	83 c4 10             	add    $0x10,%esp
+  8013b3:	85 c0                	test   %eax,%eax
+  8013b5:	78 1f                	js     8013d6 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8013b7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8013bb:	74 20                	je     8013dd <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8013bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013c0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013c3:	85 c0                	test   %eax,%eax
+  8013c5:	74 37                	je     8013fe <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8013c7:	83 ec 04             	sub    $0x4,%esp
+  8013ca:	ff 75 10             	push   0x10(%ebp)
+  8013cd:	ff 75 0c             	push   0xc(%ebp)
+  8013d0:	56                   	push   %esi
+  8013d1:	ff d0                	call   *%eax
+  8013d3:	83 c4 10             	add    $0x10,%esp
+}
+  8013d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013d9:	5b                   	pop    %ebx
+  8013da:	5e                   	pop    %esi
+  8013db:	5d                   	pop    %ebp
+  8013dc:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013dd:	a1 00 50 80 00       	mov    0x805000,%eax
+  8013e2:	8b 40 48             	mov    0x48(%eax),%eax
+  8013e5:	83 ec 04             	sub    $0x4,%esp
+  8013e8:	53                   	push   %ebx
+  8013e9:	50                   	push   %eax
+  8013ea:	68 11 3d 80 00       	push   $0x803d11
+  8013ef:	e8 e3 ed ff ff       	call   8001d7 <cprintf>
+		return -E_INVAL;
+  8013f4:	83 c4 10             	add    $0x10,%esp
+  8013f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013fc:	eb d8                	jmp    8013d6 <write+0x53>
+		return -E_NOT_SUPP;
+  8013fe:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801403:	eb d1                	jmp    8013d6 <write+0x53>
+
+00801405 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801405:	55                   	push   %ebp
+  801406:	89 e5                	mov    %esp,%ebp
+  801408:	53                   	push   %ebx
+  801409:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80140c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80140f:	50                   	push   %eax
+  801410:	ff 75 08             	push   0x8(%ebp)
+  801413:	e8 37 fc ff ff       	call   80104f <fd_lookup>
+  801418:	83 c4 10             	add    $0x10,%esp
+  80141b:	85 c0                	test   %eax,%eax
+  80141d:	78 3a                	js     801459 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80141f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801422:	83 ec 08             	sub    $0x8,%esp
+  801425:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801428:	50                   	push   %eax
+  801429:	ff 33                	push   (%ebx)
+  80142b:	e8 6f fc ff ff       	call   80109f <dev_lookup>
+  801430:	83 c4 10             	add    $0x10,%esp
+  801433:	85 c0                	test   %eax,%eax
+  801435:	78 22                	js     801459 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801437:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80143a:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80143d:	85 c0                	test   %eax,%eax
+  80143f:	74 0d                	je     80144e <seek+0x49>
+  801441:	83 ec 0c             	sub    $0xc,%esp
+  801444:	53                   	push   %ebx
+  801445:	ff d0                	call   *%eax
+  801447:	83 c4 10             	add    $0x10,%esp
+  80144a:	85 c0                	test   %eax,%eax
+  80144c:	78 0b                	js     801459 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  80144e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801451:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801454:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801459:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80145c:	c9                   	leave
+  80145d:	c3                   	ret
+
+0080145e <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  80145e:	55                   	push   %ebp
+  80145f:	89 e5                	mov    %esp,%ebp
+  801461:	53                   	push   %ebx
+  801462:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801465:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801468:	50                   	push   %eax
+  801469:	ff 75 08             	push   0x8(%ebp)
+  80146c:	e8 de fb ff ff       	call   80104f <fd_lookup>
+  801471:	83 c4 10             	add    $0x10,%esp
+  801474:	85 c0                	test   %eax,%eax
+  801476:	78 2b                	js     8014a3 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801478:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80147b:	83 ec 08             	sub    $0x8,%esp
+  80147e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801481:	50                   	push   %eax
+  801482:	ff 33                	push   (%ebx)
+  801484:	e8 16 fc ff ff       	call   80109f <dev_lookup>
+  801489:	83 c4 10             	add    $0x10,%esp
+  80148c:	85 c0                	test   %eax,%eax
+  80148e:	78 13                	js     8014a3 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801490:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801493:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801496:	85 c0                	test   %eax,%eax
+  801498:	74 0e                	je     8014a8 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  80149a:	83 ec 0c             	sub    $0xc,%esp
+  80149d:	53                   	push   %ebx
+  80149e:	ff d0                	call   *%eax
+  8014a0:	83 c4 10             	add    $0x10,%esp
+}
+  8014a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014a6:	c9                   	leave
+  8014a7:	c3                   	ret
+		return 0;
+  8014a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ad:	eb f4                	jmp    8014a3 <fsync+0x45>
+
+008014af <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8014af:	55                   	push   %ebp
+  8014b0:	89 e5                	mov    %esp,%ebp
+  8014b2:	56                   	push   %esi
+  8014b3:	53                   	push   %ebx
+  8014b4:	83 ec 18             	sub    $0x18,%esp
+  8014b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014ba:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014bd:	50                   	push   %eax
+  8014be:	53                   	push   %ebx
+  8014bf:	e8 8b fb ff ff       	call   80104f <fd_lookup>
+  8014c4:	83 c4 10             	add    $0x10,%esp
+  8014c7:	85 c0                	test   %eax,%eax
+  8014c9:	78 34                	js     8014ff <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014cb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014ce:	83 ec 08             	sub    $0x8,%esp
+  8014d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d4:	50                   	push   %eax
+  8014d5:	ff 36                	push   (%esi)
+  8014d7:	e8 c3 fb ff ff       	call   80109f <dev_lookup>
+  8014dc:	83 c4 10             	add    $0x10,%esp
+  8014df:	85 c0                	test   %eax,%eax
+  8014e1:	78 1c                	js     8014ff <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014e3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014e7:	74 1d                	je     801506 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8014e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014ec:	8b 40 18             	mov    0x18(%eax),%eax
+  8014ef:	85 c0                	test   %eax,%eax
+  8014f1:	74 34                	je     801527 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8014f3:	83 ec 08             	sub    $0x8,%esp
+  8014f6:	ff 75 0c             	push   0xc(%ebp)
+  8014f9:	56                   	push   %esi
+  8014fa:	ff d0                	call   *%eax
+  8014fc:	83 c4 10             	add    $0x10,%esp
+}
+  8014ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801502:	5b                   	pop    %ebx
+  801503:	5e                   	pop    %esi
+  801504:	5d                   	pop    %ebp
+  801505:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801506:	a1 00 50 80 00       	mov    0x805000,%eax
+  80150b:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80150e:	83 ec 04             	sub    $0x4,%esp
+  801511:	53                   	push   %ebx
+  801512:	50                   	push   %eax
+  801513:	68 d4 3c 80 00       	push   $0x803cd4
+  801518:	e8 ba ec ff ff       	call   8001d7 <cprintf>
+		return -E_INVAL;
+  80151d:	83 c4 10             	add    $0x10,%esp
+  801520:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801525:	eb d8                	jmp    8014ff <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801527:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80152c:	eb d1                	jmp    8014ff <ftruncate+0x50>
+
+0080152e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80152e:	55                   	push   %ebp
+  80152f:	89 e5                	mov    %esp,%ebp
+  801531:	56                   	push   %esi
+  801532:	53                   	push   %ebx
+  801533:	83 ec 18             	sub    $0x18,%esp
+  801536:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801539:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80153c:	50                   	push   %eax
+  80153d:	ff 75 08             	push   0x8(%ebp)
+  801540:	e8 0a fb ff ff       	call   80104f <fd_lookup>
+  801545:	83 c4 10             	add    $0x10,%esp
+  801548:	85 c0                	test   %eax,%eax
+  80154a:	78 49                	js     801595 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80154c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80154f:	83 ec 08             	sub    $0x8,%esp
+  801552:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801555:	50                   	push   %eax
+  801556:	ff 36                	push   (%esi)
+  801558:	e8 42 fb ff ff       	call   80109f <dev_lookup>
+  80155d:	83 c4 10             	add    $0x10,%esp
+  801560:	85 c0                	test   %eax,%eax
+  801562:	78 31                	js     801595 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801564:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801567:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80156b:	74 2f                	je     80159c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80156d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801570:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801577:	00 00 00 
+	stat->st_isdir = 0;
+  80157a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801581:	00 00 00 
+	stat->st_dev = dev;
+  801584:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80158a:	83 ec 08             	sub    $0x8,%esp
+  80158d:	53                   	push   %ebx
+  80158e:	56                   	push   %esi
+  80158f:	ff 50 14             	call   *0x14(%eax)
+  801592:	83 c4 10             	add    $0x10,%esp
+}
+  801595:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801598:	5b                   	pop    %ebx
+  801599:	5e                   	pop    %esi
+  80159a:	5d                   	pop    %ebp
+  80159b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80159c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015a1:	eb f2                	jmp    801595 <fstat+0x67>
+
+008015a3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8015a3:	55                   	push   %ebp
+  8015a4:	89 e5                	mov    %esp,%ebp
+  8015a6:	56                   	push   %esi
+  8015a7:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  8015a8:	83 ec 08             	sub    $0x8,%esp
+  8015ab:	68 00 10 00 00       	push   $0x1000
+  8015b0:	ff 75 08             	push   0x8(%ebp)
+  8015b3:	e8 b3 07 00 00       	call   801d6b <open>
+  8015b8:	89 c3                	mov    %eax,%ebx
+  8015ba:	83 c4 10             	add    $0x10,%esp
+  8015bd:	85 c0                	test   %eax,%eax
+  8015bf:	78 1b                	js     8015dc <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  8015c1:	83 ec 08             	sub    $0x8,%esp
+  8015c4:	ff 75 0c             	push   0xc(%ebp)
+  8015c7:	50                   	push   %eax
+  8015c8:	e8 61 ff ff ff       	call   80152e <fstat>
+  8015cd:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8015cf:	89 1c 24             	mov    %ebx,(%esp)
+  8015d2:	e8 a2 fb ff ff       	call   801179 <close>
+	return r;
+  8015d7:	83 c4 10             	add    $0x10,%esp
+  8015da:	89 f3                	mov    %esi,%ebx
+}
+  8015dc:	89 d8                	mov    %ebx,%eax
+  8015de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015e1:	5b                   	pop    %ebx
+  8015e2:	5e                   	pop    %esi
+  8015e3:	5d                   	pop    %ebp
+  8015e4:	c3                   	ret
+
+008015e5 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  8015e5:	55                   	push   %ebp
+  8015e6:	89 e5                	mov    %esp,%ebp
+  8015e8:	57                   	push   %edi
+  8015e9:	56                   	push   %esi
+  8015ea:	53                   	push   %ebx
+  8015eb:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  8015f1:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  8015f7:	89 d6                	mov    %edx,%esi
+  8015f9:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  8015ff:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801602:	89 d3                	mov    %edx,%ebx
+  801604:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  80160a:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801611:	74 1d                	je     801630 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801613:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801618:	83 c8 07             	or     $0x7,%eax
+  80161b:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801621:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801626:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  80162c:	01 ce                	add    %ecx,%esi
+  80162e:	eb 28                	jmp    801658 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801630:	83 ec 0c             	sub    $0xc,%esp
+  801633:	6a 01                	push   $0x1
+  801635:	e8 20 1f 00 00       	call   80355a <ipc_find_env>
+  80163a:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  80163f:	83 c4 10             	add    $0x10,%esp
+  801642:	eb cf                	jmp    801613 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801644:	83 c0 01             	add    $0x1,%eax
+  801647:	89 fa                	mov    %edi,%edx
+  801649:	09 da                	or     %ebx,%edx
+  80164b:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801652:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801658:	39 f3                	cmp    %esi,%ebx
+  80165a:	72 e8                	jb     801644 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  80165c:	83 f8 41             	cmp    $0x41,%eax
+  80165f:	77 2f                	ja     801690 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801661:	50                   	push   %eax
+  801662:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801668:	50                   	push   %eax
+  801669:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  80166f:	ff 35 c8 70 80 00    	push   0x8070c8
+  801675:	e8 92 1e 00 00       	call   80350c <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  80167a:	83 c4 0c             	add    $0xc,%esp
+  80167d:	6a 00                	push   $0x0
+  80167f:	6a 00                	push   $0x0
+  801681:	6a 00                	push   $0x0
+  801683:	e8 2e 1d 00 00       	call   8033b6 <ipc_recv>
+}
+  801688:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80168b:	5b                   	pop    %ebx
+  80168c:	5e                   	pop    %esi
+  80168d:	5f                   	pop    %edi
+  80168e:	5d                   	pop    %ebp
+  80168f:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801690:	68 44 3d 80 00       	push   $0x803d44
+  801695:	68 60 3d 80 00       	push   $0x803d60
+  80169a:	6a 40                	push   $0x40
+  80169c:	68 75 3d 80 00       	push   $0x803d75
+  8016a1:	e8 56 ea ff ff       	call   8000fc <_panic>
+
+008016a6 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  8016a6:	55                   	push   %ebp
+  8016a7:	89 e5                	mov    %esp,%ebp
+  8016a9:	57                   	push   %edi
+  8016aa:	56                   	push   %esi
+  8016ab:	53                   	push   %ebx
+  8016ac:	83 ec 1c             	sub    $0x1c,%esp
+  8016af:	89 c3                	mov    %eax,%ebx
+  8016b1:	89 d6                	mov    %edx,%esi
+  8016b3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  8016b6:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  8016bc:	89 ca                	mov    %ecx,%edx
+  8016be:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  8016c1:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  8016c8:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8016cb:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  8016d2:	8b 76 0c             	mov    0xc(%esi),%esi
+  8016d5:	89 fb                	mov    %edi,%ebx
+  8016d7:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  8016de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8016e1:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  8016e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8016eb:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  8016f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016f5:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  8016fc:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  8016ff:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801706:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  80170b:	39 c8                	cmp    %ecx,%eax
+  80170d:	74 0d                	je     80171c <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  80170f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801714:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801717:	5b                   	pop    %ebx
+  801718:	5e                   	pop    %esi
+  801719:	5f                   	pop    %edi
+  80171a:	5d                   	pop    %ebp
+  80171b:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80171c:	6a 07                	push   $0x7
+  80171e:	68 00 60 80 00       	push   $0x806000
+  801723:	6a 0d                	push   $0xd
+  801725:	ff 35 c8 70 80 00    	push   0x8070c8
+  80172b:	e8 f1 1c 00 00       	call   803421 <ipc_send>
+  801730:	83 c4 10             	add    $0x10,%esp
+  801733:	eb da                	jmp    80170f <fsring_post+0x69>
+
+00801735 <fsipcv>:
+{
+  801735:	55                   	push   %ebp
+  801736:	89 e5                	mov    %esp,%ebp
+  801738:	57                   	push   %edi
+  801739:	56                   	push   %esi
+  80173a:	53                   	push   %ebx
+  80173b:	83 ec 0c             	sub    $0xc,%esp
+  80173e:	89 c7                	mov    %eax,%edi
+  801740:	89 d3                	mov    %edx,%ebx
+  801742:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801744:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  80174b:	74 26                	je     801773 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80174d:	6a 07                	push   $0x7
+  80174f:	68 00 60 80 00       	push   $0x806000
+  801754:	57                   	push   %edi
+  801755:	ff 35 c8 70 80 00    	push   0x8070c8
+  80175b:	e8 c1 1c 00 00       	call   803421 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801760:	6a 00                	push   $0x0
+  801762:	56                   	push   %esi
+  801763:	53                   	push   %ebx
+  801764:	6a 00                	push   $0x0
+  801766:	e8 0e 1d 00 00       	call   803479 <ipc_recvv>
+}
+  80176b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80176e:	5b                   	pop    %ebx
+  80176f:	5e                   	pop    %esi
+  801770:	5f                   	pop    %edi
+  801771:	5d                   	pop    %ebp
+  801772:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801773:	83 ec 0c             	sub    $0xc,%esp
+  801776:	6a 01                	push   $0x1
+  801778:	e8 dd 1d 00 00       	call   80355a <ipc_find_env>
+  80177d:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801782:	83 c4 10             	add    $0x10,%esp
+  801785:	eb c6                	jmp    80174d <fsipcv+0x18>
+
+00801787 <fsipc>:
+{
+  801787:	55                   	push   %ebp
+  801788:	89 e5                	mov    %esp,%ebp
+  80178a:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  80178d:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801794:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801797:	e8 99 ff ff ff       	call   801735 <fsipcv>
+}
+  80179c:	c9                   	leave
+  80179d:	c3                   	ret
+
+0080179e <file_write_direct>:
+{
+  80179e:	55                   	push   %ebp
+  80179f:	89 e5                	mov    %esp,%ebp
+  8017a1:	56                   	push   %esi
+  8017a2:	53                   	push   %ebx
+  8017a3:	89 c3                	mov    %eax,%ebx
+  8017a5:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8017a7:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  8017ad:	77 40                	ja     8017ef <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8017af:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  8017b4:	39 c8                	cmp    %ecx,%eax
+  8017b6:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8017b9:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  8017bc:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  8017c2:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8017c7:	83 ec 04             	sub    $0x4,%esp
+  8017ca:	50                   	push   %eax
+  8017cb:	52                   	push   %edx
+  8017cc:	68 08 60 80 00       	push   $0x806008
+  8017d1:	e8 75 f1 ff ff       	call   80094b <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8017d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017db:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017e0:	e8 a2 ff ff ff       	call   801787 <fsipc>
+  8017e5:	83 c4 10             	add    $0x10,%esp
+}
+  8017e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017eb:	5b                   	pop    %ebx
+  8017ec:	5e                   	pop    %esi
+  8017ed:	5d                   	pop    %ebp
+  8017ee:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8017ef:	89 d6                	mov    %edx,%esi
+  8017f1:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8017f7:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8017fc:	29 f1                	sub    %esi,%ecx
+  8017fe:	39 c1                	cmp    %eax,%ecx
+  801800:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801803:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801806:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  80180b:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801811:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801817:	83 ec 0c             	sub    $0xc,%esp
+  80181a:	6a 05                	push   $0x5
+  80181c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801821:	e8 bf fd ff ff       	call   8015e5 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801826:	83 c4 10             	add    $0x10,%esp
+  801829:	eb bd                	jmp    8017e8 <file_write_direct+0x4a>
+
+0080182b <devfile_sync>:
+{
+  80182b:	55                   	push   %ebp
+  80182c:	89 e5                	mov    %esp,%ebp
+  80182e:	57                   	push   %edi
+  80182f:	56                   	push   %esi
+  801830:	53                   	push   %ebx
+  801831:	83 ec 28             	sub    $0x28,%esp
+  801834:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801837:	56                   	push   %esi
+  801838:	e8 a5 f7 ff ff       	call   800fe2 <fd2data>
+  80183d:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  80183f:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801842:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801849:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80184c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801851:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801855:	74 45                	je     80189c <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801857:	8b 46 14             	mov    0x14(%esi),%eax
+  80185a:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80185d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801862:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801867:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  80186a:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  80186d:	39 cb                	cmp    %ecx,%ebx
+  80186f:	73 14                	jae    801885 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801871:	29 d9                	sub    %ebx,%ecx
+  801873:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801876:	89 f0                	mov    %esi,%eax
+  801878:	e8 21 ff ff ff       	call   80179e <file_write_direct>
+  80187d:	85 c0                	test   %eax,%eax
+  80187f:	7e 04                	jle    801885 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801881:	01 c3                	add    %eax,%ebx
+  801883:	eb e5                	jmp    80186a <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801885:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801888:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  80188f:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801892:	85 c0                	test   %eax,%eax
+  801894:	ba 00 00 00 00       	mov    $0x0,%edx
+  801899:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80189c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80189f:	5b                   	pop    %ebx
+  8018a0:	5e                   	pop    %esi
+  8018a1:	5f                   	pop    %edi
+  8018a2:	5d                   	pop    %ebp
+  8018a3:	c3                   	ret
+
+008018a4 <devfile_write>:
+{
+  8018a4:	55                   	push   %ebp
+  8018a5:	89 e5                	mov    %esp,%ebp
+  8018a7:	57                   	push   %edi
+  8018a8:	56                   	push   %esi
+  8018a9:	53                   	push   %ebx
+  8018aa:	83 ec 28             	sub    $0x28,%esp
+  8018ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8018b0:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8018b3:	53                   	push   %ebx
+  8018b4:	e8 29 f7 ff ff       	call   800fe2 <fd2data>
+  8018b9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8018bc:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8018bf:	83 c4 10             	add    $0x10,%esp
+  8018c2:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8018c6:	74 43                	je     80190b <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  8018c8:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  8018cf:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8018d2:	85 c0                	test   %eax,%eax
+  8018d4:	74 43                	je     801919 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  8018d6:	89 c2                	mov    %eax,%edx
+  8018d8:	03 53 14             	add    0x14(%ebx),%edx
+  8018db:	39 fa                	cmp    %edi,%edx
+  8018dd:	75 0b                	jne    8018ea <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  8018df:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  8018e2:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  8018e8:	76 66                	jbe    801950 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  8018ea:	83 ec 0c             	sub    $0xc,%esp
+  8018ed:	53                   	push   %ebx
+  8018ee:	e8 38 ff ff ff       	call   80182b <devfile_sync>
+  8018f3:	83 c4 10             	add    $0x10,%esp
+  8018f6:	85 c0                	test   %eax,%eax
+  8018f8:	78 4e                	js     801948 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8018fa:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801900:	77 56                	ja     801958 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801902:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801905:	85 c0                	test   %eax,%eax
+  801907:	75 20                	jne    801929 <devfile_write+0x85>
+  801909:	eb 16                	jmp    801921 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  80190b:	89 f1                	mov    %esi,%ecx
+  80190d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801910:	89 d8                	mov    %ebx,%eax
+  801912:	e8 87 fe ff ff       	call   80179e <file_write_direct>
+  801917:	eb 2f                	jmp    801948 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801919:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80191f:	77 37                	ja     801958 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801921:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801924:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801929:	83 ec 04             	sub    $0x4,%esp
+  80192c:	56                   	push   %esi
+  80192d:	ff 75 0c             	push   0xc(%ebp)
+  801930:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801933:	01 c1                	add    %eax,%ecx
+  801935:	51                   	push   %ecx
+  801936:	e8 10 f0 ff ff       	call   80094b <memmove>
+	ff->buf_wlen += n;
+  80193b:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  80193e:	01 f7                	add    %esi,%edi
+  801940:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801943:	89 f0                	mov    %esi,%eax
+  801945:	83 c4 10             	add    $0x10,%esp
+}
+  801948:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80194b:	5b                   	pop    %ebx
+  80194c:	5e                   	pop    %esi
+  80194d:	5f                   	pop    %edi
+  80194e:	5d                   	pop    %ebp
+  80194f:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801950:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801956:	76 d1                	jbe    801929 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801958:	89 f1                	mov    %esi,%ecx
+  80195a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80195d:	89 d8                	mov    %ebx,%eax
+  80195f:	e8 3a fe ff ff       	call   80179e <file_write_direct>
+  801964:	eb e2                	jmp    801948 <devfile_write+0xa4>
+
+00801966 <devfile_trunc>:
+{
+  801966:	55                   	push   %ebp
+  801967:	89 e5                	mov    %esp,%ebp
+  801969:	53                   	push   %ebx
+  80196a:	83 ec 10             	sub    $0x10,%esp
+  80196d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801970:	53                   	push   %ebx
+  801971:	e8 b5 fe ff ff       	call   80182b <devfile_sync>
+  801976:	83 c4 10             	add    $0x10,%esp
+  801979:	85 c0                	test   %eax,%eax
+  80197b:	78 1f                	js     80199c <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80197d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801980:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801985:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801988:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80198d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801992:	b8 02 00 00 00       	mov    $0x2,%eax
+  801997:	e8 eb fd ff ff       	call   801787 <fsipc>
+}
+  80199c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80199f:	c9                   	leave
+  8019a0:	c3                   	ret
+
+008019a1 <devfile_stat>:
+{
+  8019a1:	55                   	push   %ebp
+  8019a2:	89 e5                	mov    %esp,%ebp
+  8019a4:	56                   	push   %esi
+  8019a5:	53                   	push   %ebx
+  8019a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  8019ac:	83 ec 0c             	sub    $0xc,%esp
+  8019af:	53                   	push   %ebx
+  8019b0:	e8 76 fe ff ff       	call   80182b <devfile_sync>
+  8019b5:	83 c4 10             	add    $0x10,%esp
+  8019b8:	85 c0                	test   %eax,%eax
+  8019ba:	78 47                	js     801a03 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019bc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8019bf:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019c9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019ce:	e8 b4 fd ff ff       	call   801787 <fsipc>
+  8019d3:	85 c0                	test   %eax,%eax
+  8019d5:	78 2c                	js     801a03 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019d7:	83 ec 08             	sub    $0x8,%esp
+  8019da:	68 00 60 80 00       	push   $0x806000
+  8019df:	56                   	push   %esi
+  8019e0:	e8 e0 ed ff ff       	call   8007c5 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019e5:	a1 80 60 80 00       	mov    0x806080,%eax
+  8019ea:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019f0:	a1 84 60 80 00       	mov    0x806084,%eax
+  8019f5:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  8019fb:	83 c4 10             	add    $0x10,%esp
+  8019fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a06:	5b                   	pop    %ebx
+  801a07:	5e                   	pop    %esi
+  801a08:	5d                   	pop    %ebp
+  801a09:	c3                   	ret
+
+00801a0a <devfile_flush>:
+{
+  801a0a:	55                   	push   %ebp
+  801a0b:	89 e5                	mov    %esp,%ebp
+  801a0d:	56                   	push   %esi
+  801a0e:	53                   	push   %ebx
+  801a0f:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801a12:	83 ec 0c             	sub    $0xc,%esp
+  801a15:	56                   	push   %esi
+  801a16:	e8 10 fe ff ff       	call   80182b <devfile_sync>
+  801a1b:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801a1d:	83 c4 10             	add    $0x10,%esp
+  801a20:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801a24:	75 25                	jne    801a4b <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a26:	8b 46 0c             	mov    0xc(%esi),%eax
+  801a29:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801a2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a33:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a38:	e8 4a fd ff ff       	call   801787 <fsipc>
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801a42:	89 d8                	mov    %ebx,%eax
+  801a44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a47:	5b                   	pop    %ebx
+  801a48:	5e                   	pop    %esi
+  801a49:	5d                   	pop    %ebp
+  801a4a:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801a4b:	83 ec 0c             	sub    $0xc,%esp
+  801a4e:	56                   	push   %esi
+  801a4f:	e8 8e f5 ff ff       	call   800fe2 <fd2data>
+  801a54:	83 c4 08             	add    $0x8,%esp
+  801a57:	50                   	push   %eax
+  801a58:	6a 00                	push   $0x0
+  801a5a:	e8 ff f1 ff ff       	call   800c5e <sys_page_unmap>
+  801a5f:	83 c4 10             	add    $0x10,%esp
+  801a62:	eb c2                	jmp    801a26 <devfile_flush+0x1c>
+
+00801a64 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801a64:	55                   	push   %ebp
+  801a65:	89 e5                	mov    %esp,%ebp
+  801a67:	57                   	push   %edi
+  801a68:	56                   	push   %esi
+  801a69:	53                   	push   %ebx
+  801a6a:	83 ec 64             	sub    $0x64,%esp
+  801a6d:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801a6f:	52                   	push   %edx
+  801a70:	50                   	push   %eax
+  801a71:	e8 d9 f5 ff ff       	call   80104f <fd_lookup>
+  801a76:	89 c1                	mov    %eax,%ecx
+  801a78:	83 c4 10             	add    $0x10,%esp
+  801a7b:	85 c0                	test   %eax,%eax
+  801a7d:	0f 88 f2 00 00 00    	js     801b75 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801a83:	8b 07                	mov    (%edi),%eax
+  801a85:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801a8b:	39 10                	cmp    %edx,(%eax)
+  801a8d:	0f 85 03 01 00 00    	jne    801b96 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801a93:	a1 00 50 80 00       	mov    0x805000,%eax
+  801a98:	8b 40 48             	mov    0x48(%eax),%eax
+  801a9b:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801aa1:	0f 84 96 00 00 00    	je     801b3d <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801aa7:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801aae:	0f 84 cb 00 00 00    	je     801b7f <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801ab4:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801ab9:	83 c8 07             	or     $0x7,%eax
+  801abc:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801abf:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801ac2:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801ac7:	83 ec 04             	sub    $0x4,%esp
+  801aca:	68 07 04 00 00       	push   $0x407
+  801acf:	53                   	push   %ebx
+  801ad0:	6a 00                	push   $0x0
+  801ad2:	e8 fa f0 ff ff       	call   800bd1 <sys_page_alloc>
+  801ad7:	89 c1                	mov    %eax,%ecx
+  801ad9:	83 c4 10             	add    $0x10,%esp
+  801adc:	85 c0                	test   %eax,%eax
+  801ade:	0f 88 91 00 00 00    	js     801b75 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801ae4:	89 d8                	mov    %ebx,%eax
+  801ae6:	83 c8 07             	or     $0x7,%eax
+  801ae9:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801aeb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801af1:	83 c6 04             	add    $0x4,%esi
+  801af4:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801afa:	75 cb                	jne    801ac7 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801afc:	6a 12                	push   $0x12
+  801afe:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801b01:	50                   	push   %eax
+  801b02:	6a 0c                	push   $0xc
+  801b04:	ff 35 c8 70 80 00    	push   0x8070c8
+  801b0a:	e8 fd 19 00 00       	call   80350c <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801b0f:	83 c4 0c             	add    $0xc,%esp
+  801b12:	6a 00                	push   $0x0
+  801b14:	6a 00                	push   $0x0
+  801b16:	6a 00                	push   $0x0
+  801b18:	e8 99 18 00 00       	call   8033b6 <ipc_recv>
+  801b1d:	89 c1                	mov    %eax,%ecx
+  801b1f:	83 c4 10             	add    $0x10,%esp
+  801b22:	85 c0                	test   %eax,%eax
+  801b24:	78 4f                	js     801b75 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801b26:	a1 00 50 80 00       	mov    0x805000,%eax
+  801b2b:	8b 40 48             	mov    0x48(%eax),%eax
+  801b2e:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801b33:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801b3a:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801b3d:	83 ec 0c             	sub    $0xc,%esp
+  801b40:	ff 37                	push   (%edi)
+  801b42:	e8 e4 fc ff ff       	call   80182b <devfile_sync>
+  801b47:	89 c1                	mov    %eax,%ecx
+  801b49:	83 c4 10             	add    $0x10,%esp
+  801b4c:	85 c0                	test   %eax,%eax
+  801b4e:	78 25                	js     801b75 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801b50:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801b56:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801b5b:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b60:	89 d0                	mov    %edx,%eax
+  801b62:	d3 e0                	shl    %cl,%eax
+  801b64:	85 d8                	test   %ebx,%eax
+  801b66:	74 0d                	je     801b75 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801b68:	83 c1 01             	add    $0x1,%ecx
+  801b6b:	83 f9 10             	cmp    $0x10,%ecx
+  801b6e:	75 f0                	jne    801b60 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801b70:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801b75:	89 c8                	mov    %ecx,%eax
+  801b77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b7a:	5b                   	pop    %ebx
+  801b7b:	5e                   	pop    %esi
+  801b7c:	5f                   	pop    %edi
+  801b7d:	5d                   	pop    %ebp
+  801b7e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b7f:	83 ec 0c             	sub    $0xc,%esp
+  801b82:	6a 01                	push   $0x1
+  801b84:	e8 d1 19 00 00       	call   80355a <ipc_find_env>
+  801b89:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801b8e:	83 c4 10             	add    $0x10,%esp
+  801b91:	e9 1e ff ff ff       	jmp    801ab4 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801b96:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801b9b:	eb d8                	jmp    801b75 <fsring_slot+0x111>
+
+00801b9d <file_read_direct>:
+{
+  801b9d:	55                   	push   %ebp
+  801b9e:	89 e5                	mov    %esp,%ebp
+  801ba0:	57                   	push   %edi
+  801ba1:	56                   	push   %esi
+  801ba2:	53                   	push   %ebx
+  801ba3:	83 ec 1c             	sub    $0x1c,%esp
+  801ba6:	89 c7                	mov    %eax,%edi
+  801ba8:	89 d6                	mov    %edx,%esi
+  801baa:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801bac:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801bb2:	77 52                	ja     801c06 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bb4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bb7:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801bbc:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801bc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc7:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bcc:	e8 b6 fb ff ff       	call   801787 <fsipc>
+  801bd1:	89 c7                	mov    %eax,%edi
+  801bd3:	85 c0                	test   %eax,%eax
+  801bd5:	78 25                	js     801bfc <file_read_direct+0x5f>
+	assert(r <= n);
+  801bd7:	39 c3                	cmp    %eax,%ebx
+  801bd9:	0f 82 87 00 00 00    	jb     801c66 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801bdf:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801be4:	0f 8f 95 00 00 00    	jg     801c7f <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801bea:	83 ec 04             	sub    $0x4,%esp
+  801bed:	50                   	push   %eax
+  801bee:	68 00 60 80 00       	push   $0x806000
+  801bf3:	56                   	push   %esi
+  801bf4:	e8 52 ed ff ff       	call   80094b <memmove>
+	return r;
+  801bf9:	83 c4 10             	add    $0x10,%esp
+}
+  801bfc:	89 f8                	mov    %edi,%eax
+  801bfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c01:	5b                   	pop    %ebx
+  801c02:	5e                   	pop    %esi
+  801c03:	5f                   	pop    %edi
+  801c04:	5d                   	pop    %ebp
+  801c05:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801c06:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801c0c:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801c11:	29 d1                	sub    %edx,%ecx
+  801c13:	39 d9                	cmp    %ebx,%ecx
+  801c15:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801c18:	89 f0                	mov    %esi,%eax
+  801c1a:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801c1d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801c20:	eb 0f                	jmp    801c31 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801c22:	0f b6 10             	movzbl (%eax),%edx
+  801c25:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801c27:	05 00 10 00 00       	add    $0x1000,%eax
+  801c2c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c31:	39 c8                	cmp    %ecx,%eax
+  801c33:	72 ed                	jb     801c22 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801c35:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c38:	8b 47 0c             	mov    0xc(%edi),%eax
+  801c3b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801c40:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801c46:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801c4c:	83 ec 0c             	sub    $0xc,%esp
+  801c4f:	6a 07                	push   $0x7
+  801c51:	89 d9                	mov    %ebx,%ecx
+  801c53:	89 f2                	mov    %esi,%edx
+  801c55:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c5a:	e8 86 f9 ff ff       	call   8015e5 <fsipc_pages>
+  801c5f:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801c61:	83 c4 10             	add    $0x10,%esp
+  801c64:	eb 96                	jmp    801bfc <file_read_direct+0x5f>
+	assert(r <= n);
+  801c66:	68 80 3d 80 00       	push   $0x803d80
+  801c6b:	68 60 3d 80 00       	push   $0x803d60
+  801c70:	68 dc 00 00 00       	push   $0xdc
+  801c75:	68 75 3d 80 00       	push   $0x803d75
+  801c7a:	e8 7d e4 ff ff       	call   8000fc <_panic>
+	assert(r <= PGSIZE);
+  801c7f:	68 91 3d 80 00       	push   $0x803d91
+  801c84:	68 60 3d 80 00       	push   $0x803d60
+  801c89:	68 dd 00 00 00       	push   $0xdd
+  801c8e:	68 75 3d 80 00       	push   $0x803d75
+  801c93:	e8 64 e4 ff ff       	call   8000fc <_panic>
+
+00801c98 <devfile_read>:
+{
+  801c98:	55                   	push   %ebp
+  801c99:	89 e5                	mov    %esp,%ebp
+  801c9b:	57                   	push   %edi
+  801c9c:	56                   	push   %esi
+  801c9d:	53                   	push   %ebx
+  801c9e:	83 ec 28             	sub    $0x28,%esp
+  801ca1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ca4:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801ca7:	53                   	push   %ebx
+  801ca8:	e8 35 f3 ff ff       	call   800fe2 <fd2data>
+  801cad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801cb0:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801cb3:	83 c4 10             	add    $0x10,%esp
+  801cb6:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801cba:	74 7d                	je     801d39 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801cbc:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801cc0:	0f 85 81 00 00 00    	jne    801d47 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801cc6:	8b 43 18             	mov    0x18(%ebx),%eax
+  801cc9:	85 c0                	test   %eax,%eax
+  801ccb:	74 0d                	je     801cda <devfile_read+0x42>
+  801ccd:	8b 53 14             	mov    0x14(%ebx),%edx
+  801cd0:	39 fa                	cmp    %edi,%edx
+  801cd2:	7f 06                	jg     801cda <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801cd4:	01 c2                	add    %eax,%edx
+  801cd6:	39 d7                	cmp    %edx,%edi
+  801cd8:	72 28                	jb     801d02 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801cda:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801ce1:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801ce7:	77 74                	ja     801d5d <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801ce9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801cee:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801cf1:	89 d8                	mov    %ebx,%eax
+  801cf3:	e8 a5 fe ff ff       	call   801b9d <file_read_direct>
+  801cf8:	85 c0                	test   %eax,%eax
+  801cfa:	7e 35                	jle    801d31 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801cfc:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801cff:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801d02:	8b 53 14             	mov    0x14(%ebx),%edx
+  801d05:	89 d0                	mov    %edx,%eax
+  801d07:	03 43 18             	add    0x18(%ebx),%eax
+  801d0a:	29 f8                	sub    %edi,%eax
+  801d0c:	39 f0                	cmp    %esi,%eax
+  801d0e:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801d11:	83 ec 04             	sub    $0x4,%esp
+  801d14:	56                   	push   %esi
+  801d15:	89 f8                	mov    %edi,%eax
+  801d17:	29 d0                	sub    %edx,%eax
+  801d19:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d1c:	01 c1                	add    %eax,%ecx
+  801d1e:	51                   	push   %ecx
+  801d1f:	ff 75 0c             	push   0xc(%ebp)
+  801d22:	e8 24 ec ff ff       	call   80094b <memmove>
+	fd->fd_offset = pos + n;
+  801d27:	01 f7                	add    %esi,%edi
+  801d29:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801d2c:	89 f0                	mov    %esi,%eax
+  801d2e:	83 c4 10             	add    $0x10,%esp
+}
+  801d31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d34:	5b                   	pop    %ebx
+  801d35:	5e                   	pop    %esi
+  801d36:	5f                   	pop    %edi
+  801d37:	5d                   	pop    %ebp
+  801d38:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801d39:	89 f1                	mov    %esi,%ecx
+  801d3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d3e:	89 d8                	mov    %ebx,%eax
+  801d40:	e8 58 fe ff ff       	call   801b9d <file_read_direct>
+  801d45:	eb ea                	jmp    801d31 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801d47:	83 ec 0c             	sub    $0xc,%esp
+  801d4a:	53                   	push   %ebx
+  801d4b:	e8 db fa ff ff       	call   80182b <devfile_sync>
+  801d50:	83 c4 10             	add    $0x10,%esp
+  801d53:	85 c0                	test   %eax,%eax
+  801d55:	0f 89 6b ff ff ff    	jns    801cc6 <devfile_read+0x2e>
+  801d5b:	eb d4                	jmp    801d31 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801d5d:	89 f1                	mov    %esi,%ecx
+  801d5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d62:	89 d8                	mov    %ebx,%eax
+  801d64:	e8 34 fe ff ff       	call   801b9d <file_read_direct>
+  801d69:	eb c6                	jmp    801d31 <devfile_read+0x99>
+
+00801d6b <open>:
+{
+  801d6b:	55                   	push   %ebp
+  801d6c:	89 e5                	mov    %esp,%ebp
+  801d6e:	56                   	push   %esi
+  801d6f:	53                   	push   %ebx
+  801d70:	83 ec 1c             	sub    $0x1c,%esp
+  801d73:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801d76:	56                   	push   %esi
+  801d77:	e8 0e ea ff ff       	call   80078a <strlen>
+  801d7c:	83 c4 10             	add    $0x10,%esp
+  801d7f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d84:	0f 8f a0 00 00 00    	jg     801e2a <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801d8a:	83 ec 0c             	sub    $0xc,%esp
+  801d8d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d90:	50                   	push   %eax
+  801d91:	e8 63 f2 ff ff       	call   800ff9 <fd_alloc>
+  801d96:	89 c3                	mov    %eax,%ebx
+  801d98:	83 c4 10             	add    $0x10,%esp
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	78 45                	js     801de4 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801d9f:	83 ec 08             	sub    $0x8,%esp
+  801da2:	56                   	push   %esi
+  801da3:	68 00 60 80 00       	push   $0x806000
+  801da8:	e8 18 ea ff ff       	call   8007c5 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801dad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801db0:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801db5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801db8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801dbd:	e8 c5 f9 ff ff       	call   801787 <fsipc>
+  801dc2:	89 c3                	mov    %eax,%ebx
+  801dc4:	83 c4 10             	add    $0x10,%esp
+  801dc7:	85 c0                	test   %eax,%eax
+  801dc9:	78 22                	js     801ded <open+0x82>
+	if (!(mode & O_NOBUF)
+  801dcb:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801dd2:	74 2b                	je     801dff <open+0x94>
+	return fd2num(fd);
+  801dd4:	83 ec 0c             	sub    $0xc,%esp
+  801dd7:	ff 75 f4             	push   -0xc(%ebp)
+  801dda:	e8 f3 f1 ff ff       	call   800fd2 <fd2num>
+  801ddf:	89 c3                	mov    %eax,%ebx
+  801de1:	83 c4 10             	add    $0x10,%esp
+}
+  801de4:	89 d8                	mov    %ebx,%eax
+  801de6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801de9:	5b                   	pop    %ebx
+  801dea:	5e                   	pop    %esi
+  801deb:	5d                   	pop    %ebp
+  801dec:	c3                   	ret
+		fd_close(fd, 0);
+  801ded:	83 ec 08             	sub    $0x8,%esp
+  801df0:	6a 00                	push   $0x0
+  801df2:	ff 75 f4             	push   -0xc(%ebp)
+  801df5:	e8 f8 f2 ff ff       	call   8010f2 <fd_close>
+		return r;
+  801dfa:	83 c4 10             	add    $0x10,%esp
+  801dfd:	eb e5                	jmp    801de4 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801dff:	83 ec 0c             	sub    $0xc,%esp
+  801e02:	ff 75 f4             	push   -0xc(%ebp)
+  801e05:	e8 d8 f1 ff ff       	call   800fe2 <fd2data>
+  801e0a:	83 c4 0c             	add    $0xc,%esp
+  801e0d:	68 07 04 00 00       	push   $0x407
+  801e12:	50                   	push   %eax
+  801e13:	6a 00                	push   $0x0
+  801e15:	e8 b7 ed ff ff       	call   800bd1 <sys_page_alloc>
+  801e1a:	83 c4 10             	add    $0x10,%esp
+  801e1d:	85 c0                	test   %eax,%eax
+  801e1f:	75 b3                	jne    801dd4 <open+0x69>
+		fd->fd_file.buffered = 1;
+  801e21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e24:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801e28:	eb aa                	jmp    801dd4 <open+0x69>
+		return -E_BAD_PATH;
+  801e2a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e2f:	eb b3                	jmp    801de4 <open+0x79>
+
+00801e31 <readdir>:
+{
+  801e31:	55                   	push   %ebp
+  801e32:	89 e5                	mov    %esp,%ebp
+  801e34:	53                   	push   %ebx
+  801e35:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e38:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e3b:	50                   	push   %eax
+  801e3c:	ff 75 08             	push   0x8(%ebp)
+  801e3f:	e8 0b f2 ff ff       	call   80104f <fd_lookup>
+  801e44:	89 c3                	mov    %eax,%ebx
+  801e46:	83 c4 10             	add    $0x10,%esp
+  801e49:	85 c0                	test   %eax,%eax
+  801e4b:	78 73                	js     801ec0 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801e4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e50:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801e56:	39 08                	cmp    %ecx,(%eax)
+  801e58:	0f 85 82 00 00 00    	jne    801ee0 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801e5e:	83 ec 0c             	sub    $0xc,%esp
+  801e61:	50                   	push   %eax
+  801e62:	e8 c4 f9 ff ff       	call   80182b <devfile_sync>
+  801e67:	89 c3                	mov    %eax,%ebx
+  801e69:	83 c4 10             	add    $0x10,%esp
+  801e6c:	85 c0                	test   %eax,%eax
+  801e6e:	78 50                	js     801ec0 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801e70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e73:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e76:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801e7b:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e7e:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801e83:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e86:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801e8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e90:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e95:	e8 ed f8 ff ff       	call   801787 <fsipc>
+  801e9a:	89 c3                	mov    %eax,%ebx
+  801e9c:	85 c0                	test   %eax,%eax
+  801e9e:	7e 20                	jle    801ec0 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801ea0:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801ea3:	72 22                	jb     801ec7 <readdir+0x96>
+  801ea5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801eaa:	7f 1b                	jg     801ec7 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801eac:	83 ec 04             	sub    $0x4,%esp
+  801eaf:	50                   	push   %eax
+  801eb0:	68 00 60 80 00       	push   $0x806000
+  801eb5:	ff 75 0c             	push   0xc(%ebp)
+  801eb8:	e8 8e ea ff ff       	call   80094b <memmove>
+	return r;
+  801ebd:	83 c4 10             	add    $0x10,%esp
+}
+  801ec0:	89 d8                	mov    %ebx,%eax
+  801ec2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ec5:	c9                   	leave
+  801ec6:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801ec7:	68 87 3d 80 00       	push   $0x803d87
+  801ecc:	68 60 3d 80 00       	push   $0x803d60
+  801ed1:	68 86 01 00 00       	push   $0x186
+  801ed6:	68 75 3d 80 00       	push   $0x803d75
+  801edb:	e8 1c e2 ff ff       	call   8000fc <_panic>
+		return -E_NOT_SUPP;
+  801ee0:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801ee5:	eb d9                	jmp    801ec0 <readdir+0x8f>
+
+00801ee7 <munmap>:
+{
+  801ee7:	55                   	push   %ebp
+  801ee8:	89 e5                	mov    %esp,%ebp
+  801eea:	56                   	push   %esi
+  801eeb:	53                   	push   %ebx
+  801eec:	8b 75 08             	mov    0x8(%ebp),%esi
+  801eef:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801ef2:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801ef8:	75 41                	jne    801f3b <munmap+0x54>
+  801efa:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801f00:	77 39                	ja     801f3b <munmap+0x54>
+  801f02:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f07:	29 f0                	sub    %esi,%eax
+  801f09:	39 d0                	cmp    %edx,%eax
+  801f0b:	72 35                	jb     801f42 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801f0d:	89 f3                	mov    %esi,%ebx
+  801f0f:	01 d6                	add    %edx,%esi
+  801f11:	39 f3                	cmp    %esi,%ebx
+  801f13:	73 1a                	jae    801f2f <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801f15:	83 ec 08             	sub    $0x8,%esp
+  801f18:	53                   	push   %ebx
+  801f19:	6a 00                	push   $0x0
+  801f1b:	e8 3e ed ff ff       	call   800c5e <sys_page_unmap>
+  801f20:	83 c4 10             	add    $0x10,%esp
+  801f23:	85 c0                	test   %eax,%eax
+  801f25:	78 0d                	js     801f34 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801f27:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f2d:	eb e2                	jmp    801f11 <munmap+0x2a>
+	return 0;
+  801f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f37:	5b                   	pop    %ebx
+  801f38:	5e                   	pop    %esi
+  801f39:	5d                   	pop    %ebp
+  801f3a:	c3                   	ret
+		return -E_INVAL;
+  801f3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f40:	eb f2                	jmp    801f34 <munmap+0x4d>
+  801f42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f47:	eb eb                	jmp    801f34 <munmap+0x4d>
+
+00801f49 <mmap>:
+{
+  801f49:	55                   	push   %ebp
+  801f4a:	89 e5                	mov    %esp,%ebp
+  801f4c:	57                   	push   %edi
+  801f4d:	56                   	push   %esi
+  801f4e:	53                   	push   %ebx
+  801f4f:	83 ec 34             	sub    $0x34,%esp
+  801f52:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f55:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f58:	50                   	push   %eax
+  801f59:	ff 75 18             	push   0x18(%ebp)
+  801f5c:	e8 ee f0 ff ff       	call   80104f <fd_lookup>
+  801f61:	89 c3                	mov    %eax,%ebx
+  801f63:	83 c4 10             	add    $0x10,%esp
+  801f66:	85 c0                	test   %eax,%eax
+  801f68:	0f 88 0e 01 00 00    	js     80207c <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801f6e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f71:	a1 20 40 80 00       	mov    0x804020,%eax
+  801f76:	39 02                	cmp    %eax,(%edx)
+  801f78:	0f 85 50 01 00 00    	jne    8020ce <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801f7e:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f81:	83 e0 02             	and    $0x2,%eax
+  801f84:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f87:	74 0a                	je     801f93 <mmap+0x4a>
+  801f89:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801f8d:	0f 84 42 01 00 00    	je     8020d5 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801f93:	8b 42 08             	mov    0x8(%edx),%eax
+  801f96:	83 e0 03             	and    $0x3,%eax
+  801f99:	83 f8 01             	cmp    $0x1,%eax
+  801f9c:	0f 84 3a 01 00 00    	je     8020dc <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  801fa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa5:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801fa8:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801fad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801fb0:	0f 85 2d 01 00 00    	jne    8020e3 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801fb6:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801fba:	0f 88 2a 01 00 00    	js     8020ea <mmap+0x1a1>
+  801fc0:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  801fc7:	0f 87 1d 01 00 00    	ja     8020ea <mmap+0x1a1>
+  801fcd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801fd2:	2b 45 08             	sub    0x8(%ebp),%eax
+  801fd5:	39 f8                	cmp    %edi,%eax
+  801fd7:	0f 82 14 01 00 00    	jb     8020f1 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  801fdd:	83 ec 0c             	sub    $0xc,%esp
+  801fe0:	52                   	push   %edx
+  801fe1:	e8 45 f8 ff ff       	call   80182b <devfile_sync>
+  801fe6:	89 c3                	mov    %eax,%ebx
+  801fe8:	83 c4 10             	add    $0x10,%esp
+  801feb:	85 c0                	test   %eax,%eax
+  801fed:	0f 88 89 00 00 00    	js     80207c <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  801ff3:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  801ff9:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801fff:	be 00 00 00 00       	mov    $0x0,%esi
+  802004:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802007:	39 fe                	cmp    %edi,%esi
+  802009:	73 7b                	jae    802086 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  80200b:	89 f8                	mov    %edi,%eax
+  80200d:	29 f0                	sub    %esi,%eax
+  80200f:	c1 e8 0c             	shr    $0xc,%eax
+  802012:	ba 40 00 00 00       	mov    $0x40,%edx
+  802017:	39 d0                	cmp    %edx,%eax
+  802019:	0f 47 c2             	cmova  %edx,%eax
+  80201c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80201f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802022:	8b 52 0c             	mov    0xc(%edx),%edx
+  802025:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  80202b:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  80202e:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  802034:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802039:	89 f2                	mov    %esi,%edx
+  80203b:	03 55 08             	add    0x8(%ebp),%edx
+  80203e:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802041:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802046:	e8 ea f6 ff ff       	call   801735 <fsipcv>
+  80204b:	85 c0                	test   %eax,%eax
+  80204d:	7e 12                	jle    802061 <mmap+0x118>
+  80204f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802052:	85 c0                	test   %eax,%eax
+  802054:	0f 84 9e 00 00 00    	je     8020f8 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80205a:	c1 e0 0c             	shl    $0xc,%eax
+  80205d:	01 c6                	add    %eax,%esi
+  80205f:	eb a6                	jmp    802007 <mmap+0xbe>
+			munmap(addr, done);
+  802061:	89 c3                	mov    %eax,%ebx
+  802063:	83 ec 08             	sub    $0x8,%esp
+  802066:	56                   	push   %esi
+  802067:	ff 75 08             	push   0x8(%ebp)
+  80206a:	e8 78 fe ff ff       	call   801ee7 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80206f:	83 c4 10             	add    $0x10,%esp
+  802072:	85 db                	test   %ebx,%ebx
+  802074:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802079:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80207c:	89 d8                	mov    %ebx,%eax
+  80207e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802081:	5b                   	pop    %ebx
+  802082:	5e                   	pop    %esi
+  802083:	5f                   	pop    %edi
+  802084:	5d                   	pop    %ebp
+  802085:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802086:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802089:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80208b:	85 c0                	test   %eax,%eax
+  80208d:	74 ed                	je     80207c <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80208f:	be 00 00 00 00       	mov    $0x0,%esi
+  802094:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802097:	39 fe                	cmp    %edi,%esi
+  802099:	73 2e                	jae    8020c9 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80209b:	83 ec 0c             	sub    $0xc,%esp
+  80209e:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8020a1:	50                   	push   %eax
+  8020a2:	e8 11 11 00 00       	call   8031b8 <cowpage>
+  8020a7:	83 c4 10             	add    $0x10,%esp
+  8020aa:	85 c0                	test   %eax,%eax
+  8020ac:	78 08                	js     8020b6 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8020ae:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8020b4:	eb e1                	jmp    802097 <mmap+0x14e>
+				munmap(addr, len);
+  8020b6:	89 c3                	mov    %eax,%ebx
+  8020b8:	83 ec 08             	sub    $0x8,%esp
+  8020bb:	57                   	push   %edi
+  8020bc:	ff 75 08             	push   0x8(%ebp)
+  8020bf:	e8 23 fe ff ff       	call   801ee7 <munmap>
+				return r;
+  8020c4:	83 c4 10             	add    $0x10,%esp
+  8020c7:	eb b3                	jmp    80207c <mmap+0x133>
+	return 0;
+  8020c9:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8020cc:	eb ae                	jmp    80207c <mmap+0x133>
+		return -E_NOT_SUPP;
+  8020ce:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8020d3:	eb a7                	jmp    80207c <mmap+0x133>
+		return -E_NOT_SUPP;
+  8020d5:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8020da:	eb a0                	jmp    80207c <mmap+0x133>
+		return -E_INVAL;
+  8020dc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8020e1:	eb 99                	jmp    80207c <mmap+0x133>
+  8020e3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8020e8:	eb 92                	jmp    80207c <mmap+0x133>
+  8020ea:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8020ef:	eb 8b                	jmp    80207c <mmap+0x133>
+  8020f1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8020f6:	eb 84                	jmp    80207c <mmap+0x133>
+			munmap(addr, done);
+  8020f8:	83 ec 08             	sub    $0x8,%esp
+  8020fb:	56                   	push   %esi
+  8020fc:	ff 75 08             	push   0x8(%ebp)
+  8020ff:	e8 e3 fd ff ff       	call   801ee7 <munmap>
+  802104:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802107:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80210c:	e9 6b ff ff ff       	jmp    80207c <mmap+0x133>
+
+00802111 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802111:	55                   	push   %ebp
+  802112:	89 e5                	mov    %esp,%ebp
+  802114:	56                   	push   %esi
+  802115:	53                   	push   %ebx
+  802116:	83 ec 10             	sub    $0x10,%esp
+  802119:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80211c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80211f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802122:	e8 3d f9 ff ff       	call   801a64 <fsring_slot>
+  802127:	85 c0                	test   %eax,%eax
+  802129:	78 60                	js     80218b <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80212b:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80212e:	8b 56 08             	mov    0x8(%esi),%edx
+  802131:	83 e2 03             	and    $0x3,%edx
+  802134:	83 fa 01             	cmp    $0x1,%edx
+  802137:	74 59                	je     802192 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802139:	ba 01 00 00 00       	mov    $0x1,%edx
+  80213e:	89 c1                	mov    %eax,%ecx
+  802140:	d3 e2                	shl    %cl,%edx
+  802142:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802148:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80214b:	c1 e2 02             	shl    $0x2,%edx
+  80214e:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  802154:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  80215b:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80215e:	8b 55 18             	mov    0x18(%ebp),%edx
+  802161:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802164:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802167:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80216a:	83 ec 08             	sub    $0x8,%esp
+  80216d:	50                   	push   %eax
+  80216e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802173:	39 c3                	cmp    %eax,%ebx
+  802175:	0f 47 d8             	cmova  %eax,%ebx
+  802178:	53                   	push   %ebx
+  802179:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80217c:	89 f2                	mov    %esi,%edx
+  80217e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802183:	e8 1e f5 ff ff       	call   8016a6 <fsring_post>
+  802188:	83 c4 10             	add    $0x10,%esp
+}
+  80218b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80218e:	5b                   	pop    %ebx
+  80218f:	5e                   	pop    %esi
+  802190:	5d                   	pop    %ebp
+  802191:	c3                   	ret
+		return -E_INVAL;
+  802192:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802197:	eb f2                	jmp    80218b <fsring_read+0x7a>
+
+00802199 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802199:	55                   	push   %ebp
+  80219a:	89 e5                	mov    %esp,%ebp
+  80219c:	56                   	push   %esi
+  80219d:	53                   	push   %ebx
+  80219e:	83 ec 10             	sub    $0x10,%esp
+  8021a1:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8021a4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021aa:	e8 b5 f8 ff ff       	call   801a64 <fsring_slot>
+  8021af:	89 c3                	mov    %eax,%ebx
+  8021b1:	85 c0                	test   %eax,%eax
+  8021b3:	78 77                	js     80222c <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8021b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021b8:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8021bc:	74 77                	je     802235 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8021be:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8021c3:	39 c6                	cmp    %eax,%esi
+  8021c5:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8021c8:	83 ec 04             	sub    $0x4,%esp
+  8021cb:	56                   	push   %esi
+  8021cc:	ff 75 0c             	push   0xc(%ebp)
+  8021cf:	89 d8                	mov    %ebx,%eax
+  8021d1:	c1 e0 0c             	shl    $0xc,%eax
+  8021d4:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8021da:	50                   	push   %eax
+  8021db:	e8 6b e7 ff ff       	call   80094b <memmove>
+	fsring_busy |= 1 << slot;
+  8021e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021e5:	89 d9                	mov    %ebx,%ecx
+  8021e7:	d3 e0                	shl    %cl,%eax
+  8021e9:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8021ef:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8021f2:	c1 e0 02             	shl    $0x2,%eax
+  8021f5:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8021fb:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  802202:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802205:	8b 45 18             	mov    0x18(%ebp),%eax
+  802208:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80220b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802212:	83 c4 08             	add    $0x8,%esp
+  802215:	53                   	push   %ebx
+  802216:	56                   	push   %esi
+  802217:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80221a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80221d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802222:	e8 7f f4 ff ff       	call   8016a6 <fsring_post>
+  802227:	89 c3                	mov    %eax,%ebx
+  802229:	83 c4 10             	add    $0x10,%esp
+}
+  80222c:	89 d8                	mov    %ebx,%eax
+  80222e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802231:	5b                   	pop    %ebx
+  802232:	5e                   	pop    %esi
+  802233:	5d                   	pop    %ebp
+  802234:	c3                   	ret
+		return -E_INVAL;
+  802235:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80223a:	eb f0                	jmp    80222c <fsring_write+0x93>
+
+0080223c <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80223c:	55                   	push   %ebp
+  80223d:	89 e5                	mov    %esp,%ebp
+  80223f:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802242:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802245:	8b 45 08             	mov    0x8(%ebp),%eax
+  802248:	e8 17 f8 ff ff       	call   801a64 <fsring_slot>
+  80224d:	85 c0                	test   %eax,%eax
+  80224f:	78 4c                	js     80229d <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802251:	ba 01 00 00 00       	mov    $0x1,%edx
+  802256:	89 c1                	mov    %eax,%ecx
+  802258:	d3 e2                	shl    %cl,%edx
+  80225a:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802260:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802263:	c1 e2 02             	shl    $0x2,%edx
+  802266:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  80226c:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  802273:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802276:	8b 55 10             	mov    0x10(%ebp),%edx
+  802279:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80227c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80227f:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802282:	83 ec 08             	sub    $0x8,%esp
+  802285:	50                   	push   %eax
+  802286:	6a 00                	push   $0x0
+  802288:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80228d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802290:	b8 05 00 00 00       	mov    $0x5,%eax
+  802295:	e8 0c f4 ff ff       	call   8016a6 <fsring_post>
+  80229a:	83 c4 10             	add    $0x10,%esp
+}
+  80229d:	c9                   	leave
+  80229e:	c3                   	ret
+
+0080229f <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  80229f:	55                   	push   %ebp
+  8022a0:	89 e5                	mov    %esp,%ebp
+  8022a2:	57                   	push   %edi
+  8022a3:	56                   	push   %esi
+  8022a4:	53                   	push   %ebx
+  8022a5:	83 ec 1c             	sub    $0x1c,%esp
+  8022a8:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8022ac:	a1 00 50 80 00       	mov    0x805000,%eax
+  8022b1:	8b 40 48             	mov    0x48(%eax),%eax
+  8022b4:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  8022ba:	74 12                	je     8022ce <fsring_reap+0x2f>
+		return 0;
+  8022bc:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8022c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022c4:	5b                   	pop    %ebx
+  8022c5:	5e                   	pop    %esi
+  8022c6:	5f                   	pop    %edi
+  8022c7:	5d                   	pop    %ebp
+  8022c8:	c3                   	ret
+		sys_yield();
+  8022c9:	e8 e4 e8 ff ff       	call   800bb2 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8022ce:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8022d4:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8022d9:	39 c2                	cmp    %eax,%edx
+  8022db:	75 18                	jne    8022f5 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8022dd:	84 db                	test   %bl,%bl
+  8022df:	0f 84 21 01 00 00    	je     802406 <fsring_reap+0x167>
+  8022e5:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  8022ec:	75 db                	jne    8022c9 <fsring_reap+0x2a>
+			return 0;
+  8022ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f3:	eb cc                	jmp    8022c1 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8022f5:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8022fa:	83 e0 0f             	and    $0xf,%eax
+  8022fd:	83 c0 2a             	add    $0x2a,%eax
+  802300:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802307:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  80230e:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802313:	83 c0 01             	add    $0x1,%eax
+  802316:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  80231b:	83 fb 0f             	cmp    $0xf,%ebx
+  80231e:	77 5b                	ja     80237b <fsring_reap+0xdc>
+  802320:	be 01 00 00 00       	mov    $0x1,%esi
+  802325:	89 d9                	mov    %ebx,%ecx
+  802327:	d3 e6                	shl    %cl,%esi
+  802329:	89 f0                	mov    %esi,%eax
+  80232b:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  802331:	74 48                	je     80237b <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802333:	89 d8                	mov    %ebx,%eax
+  802335:	c1 e0 0c             	shl    $0xc,%eax
+  802338:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80233e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802341:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802344:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  80234b:	83 f8 03             	cmp    $0x3,%eax
+  80234e:	74 40                	je     802390 <fsring_reap+0xf1>
+  802350:	83 f8 05             	cmp    $0x5,%eax
+  802353:	74 64                	je     8023b9 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802355:	f7 d6                	not    %esi
+  802357:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  80235d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802360:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  802367:	8b 45 08             	mov    0x8(%ebp),%eax
+  80236a:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  80236c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80236f:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802371:	b8 01 00 00 00       	mov    $0x1,%eax
+  802376:	e9 46 ff ff ff       	jmp    8022c1 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80237b:	53                   	push   %ebx
+  80237c:	68 9d 3d 80 00       	push   $0x803d9d
+  802381:	68 8f 02 00 00       	push   $0x28f
+  802386:	68 75 3d 80 00       	push   $0x803d75
+  80238b:	e8 6c dd ff ff       	call   8000fc <_panic>
+		if (cqe.cqe_result > 0)
+  802390:	85 ff                	test   %edi,%edi
+  802392:	7e c1                	jle    802355 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802394:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802397:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80239c:	39 c7                	cmp    %eax,%edi
+  80239e:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8023a1:	50                   	push   %eax
+  8023a2:	ff 75 e4             	push   -0x1c(%ebp)
+  8023a5:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8023a8:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  8023af:	e8 97 e5 ff ff       	call   80094b <memmove>
+  8023b4:	83 c4 10             	add    $0x10,%esp
+  8023b7:	eb 9c                	jmp    802355 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8023b9:	85 ff                	test   %edi,%edi
+  8023bb:	75 98                	jne    802355 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  8023bd:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8023c0:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8023c7:	83 ec 08             	sub    $0x8,%esp
+  8023ca:	ff 75 e4             	push   -0x1c(%ebp)
+  8023cd:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8023d0:	51                   	push   %ecx
+  8023d1:	e8 ef e3 ff ff       	call   8007c5 <strcpy>
+			st->st_size = ret->ret_size;
+  8023d6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8023d9:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8023df:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8023e2:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8023e8:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8023ee:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8023f4:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8023fb:	40 80 00 
+  8023fe:	83 c4 10             	add    $0x10,%esp
+  802401:	e9 4f ff ff ff       	jmp    802355 <fsring_reap+0xb6>
+			return 0;
+  802406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80240b:	e9 b1 fe ff ff       	jmp    8022c1 <fsring_reap+0x22>
+
+00802410 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802410:	55                   	push   %ebp
+  802411:	89 e5                	mov    %esp,%ebp
+  802413:	57                   	push   %edi
+  802414:	56                   	push   %esi
+  802415:	53                   	push   %ebx
+  802416:	83 ec 28             	sub    $0x28,%esp
+  802419:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80241c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80241f:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802422:	53                   	push   %ebx
+  802423:	e8 62 e3 ff ff       	call   80078a <strlen>
+  802428:	83 c4 10             	add    $0x10,%esp
+  80242b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802430:	0f 8f 02 01 00 00    	jg     802538 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802436:	83 ec 08             	sub    $0x8,%esp
+  802439:	53                   	push   %ebx
+  80243a:	68 00 60 80 00       	push   $0x806000
+  80243f:	e8 81 e3 ff ff       	call   8007c5 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802444:	83 c4 10             	add    $0x10,%esp
+  802447:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  80244d:	76 69                	jbe    8024b8 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80244f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802452:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802458:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80245d:	29 d1                	sub    %edx,%ecx
+  80245f:	39 f9                	cmp    %edi,%ecx
+  802461:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802464:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802467:	89 f9                	mov    %edi,%ecx
+  802469:	01 c1                	add    %eax,%ecx
+  80246b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80246e:	eb 0f                	jmp    80247f <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802470:	0f b6 10             	movzbl (%eax),%edx
+  802473:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802475:	05 00 10 00 00       	add    $0x1000,%eax
+  80247a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80247f:	39 c8                	cmp    %ecx,%eax
+  802481:	72 ed                	jb     802470 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802483:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802486:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  80248c:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802492:	83 ec 0c             	sub    $0xc,%esp
+  802495:	6a 07                	push   $0x7
+  802497:	89 f9                	mov    %edi,%ecx
+  802499:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80249c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8024a1:	e8 3f f1 ff ff       	call   8015e5 <fsipc_pages>
+  8024a6:	89 c7                	mov    %eax,%edi
+  8024a8:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8024ab:	85 f6                	test   %esi,%esi
+  8024ad:	74 7f                	je     80252e <file_slurp+0x11e>
+  8024af:	8d 43 01             	lea    0x1(%ebx),%eax
+  8024b2:	85 ff                	test   %edi,%edi
+  8024b4:	79 3c                	jns    8024f2 <file_slurp+0xe2>
+  8024b6:	eb 76                	jmp    80252e <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8024b8:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8024be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8024c8:	e8 ba f2 ff ff       	call   801787 <fsipc>
+  8024cd:	89 c7                	mov    %eax,%edi
+  8024cf:	85 c0                	test   %eax,%eax
+  8024d1:	7e d8                	jle    8024ab <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8024d3:	83 ec 04             	sub    $0x4,%esp
+  8024d6:	50                   	push   %eax
+  8024d7:	68 08 60 80 00       	push   $0x806008
+  8024dc:	ff 75 0c             	push   0xc(%ebp)
+  8024df:	e8 67 e4 ff ff       	call   80094b <memmove>
+  8024e4:	83 c4 10             	add    $0x10,%esp
+  8024e7:	eb c2                	jmp    8024ab <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8024e9:	80 fa 2f             	cmp    $0x2f,%dl
+  8024ec:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8024ef:	83 c0 01             	add    $0x1,%eax
+  8024f2:	89 c1                	mov    %eax,%ecx
+  8024f4:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8024f8:	84 d2                	test   %dl,%dl
+  8024fa:	75 ed                	jne    8024e9 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8024fc:	83 ec 04             	sub    $0x4,%esp
+  8024ff:	68 80 00 00 00       	push   $0x80
+  802504:	53                   	push   %ebx
+  802505:	56                   	push   %esi
+  802506:	e8 30 e3 ff ff       	call   80083b <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  80250b:	a1 00 60 80 00       	mov    0x806000,%eax
+  802510:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802516:	a1 04 60 80 00       	mov    0x806004,%eax
+  80251b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802521:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  802528:	40 80 00 
+  80252b:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80252e:	89 f8                	mov    %edi,%eax
+  802530:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802533:	5b                   	pop    %ebx
+  802534:	5e                   	pop    %esi
+  802535:	5f                   	pop    %edi
+  802536:	5d                   	pop    %ebp
+  802537:	c3                   	ret
+		return -E_BAD_PATH;
+  802538:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  80253d:	eb ef                	jmp    80252e <file_slurp+0x11e>
+
+0080253f <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80253f:	55                   	push   %ebp
+  802540:	89 e5                	mov    %esp,%ebp
+  802542:	53                   	push   %ebx
+  802543:	83 ec 10             	sub    $0x10,%esp
+  802546:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802549:	53                   	push   %ebx
+  80254a:	e8 3b e2 ff ff       	call   80078a <strlen>
+  80254f:	83 c4 10             	add    $0x10,%esp
+  802552:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802557:	7f 25                	jg     80257e <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802559:	83 ec 08             	sub    $0x8,%esp
+  80255c:	53                   	push   %ebx
+  80255d:	68 00 60 80 00       	push   $0x806000
+  802562:	e8 5e e2 ff ff       	call   8007c5 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802567:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802571:	e8 11 f2 ff ff       	call   801787 <fsipc>
+  802576:	83 c4 10             	add    $0x10,%esp
+}
+  802579:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80257c:	c9                   	leave
+  80257d:	c3                   	ret
+		return -E_BAD_PATH;
+  80257e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802583:	eb f4                	jmp    802579 <remove+0x3a>
+
+00802585 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802585:	55                   	push   %ebp
+  802586:	89 e5                	mov    %esp,%ebp
+  802588:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80258b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802590:	b8 08 00 00 00       	mov    $0x8,%eax
+  802595:	e8 ed f1 ff ff       	call   801787 <fsipc>
+}
+  80259a:	c9                   	leave
+  80259b:	c3                   	ret
+
+0080259c <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  80259c:	55                   	push   %ebp
+  80259d:	89 e5                	mov    %esp,%ebp
+  80259f:	57                   	push   %edi
+  8025a0:	56                   	push   %esi
+  8025a1:	53                   	push   %ebx
+  8025a2:	83 ec 18             	sub    $0x18,%esp
+  8025a5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025a8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8025ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8025ae:	57                   	push   %edi
+  8025af:	e8 d6 e1 ff ff       	call   80078a <strlen>
+  8025b4:	83 c4 10             	add    $0x10,%esp
+  8025b7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025bc:	7f 4c                	jg     80260a <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  8025be:	83 ec 08             	sub    $0x8,%esp
+  8025c1:	57                   	push   %edi
+  8025c2:	68 00 60 80 00       	push   $0x806000
+  8025c7:	e8 f9 e1 ff ff       	call   8007c5 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  8025cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8025d6:	e8 ac f1 ff ff       	call   801787 <fsipc>
+  8025db:	83 c4 10             	add    $0x10,%esp
+  8025de:	85 c0                	test   %eax,%eax
+  8025e0:	78 20                	js     802602 <defrag+0x66>
+		return r;
+	if (before)
+  8025e2:	85 f6                	test   %esi,%esi
+  8025e4:	74 07                	je     8025ed <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  8025e6:	a1 00 60 80 00       	mov    0x806000,%eax
+  8025eb:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  8025ed:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  8025f2:	85 db                	test   %ebx,%ebx
+  8025f4:	74 0c                	je     802602 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  8025f6:	a1 04 60 80 00       	mov    0x806004,%eax
+  8025fb:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8025fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802602:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802605:	5b                   	pop    %ebx
+  802606:	5e                   	pop    %esi
+  802607:	5f                   	pop    %edi
+  802608:	5d                   	pop    %ebp
+  802609:	c3                   	ret
+		return -E_BAD_PATH;
+  80260a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80260f:	eb f1                	jmp    802602 <defrag+0x66>
+
+00802611 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802611:	55                   	push   %ebp
+  802612:	89 e5                	mov    %esp,%ebp
+  802614:	53                   	push   %ebx
+  802615:	83 ec 04             	sub    $0x4,%esp
+  802618:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  80261b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802620:	b8 11 00 00 00       	mov    $0x11,%eax
+  802625:	e8 5d f1 ff ff       	call   801787 <fsipc>
+  80262a:	85 c0                	test   %eax,%eax
+  80262c:	78 34                	js     802662 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  80262e:	a1 00 60 80 00       	mov    0x806000,%eax
+  802633:	89 03                	mov    %eax,(%ebx)
+  802635:	a1 04 60 80 00       	mov    0x806004,%eax
+  80263a:	89 43 04             	mov    %eax,0x4(%ebx)
+  80263d:	a1 08 60 80 00       	mov    0x806008,%eax
+  802642:	89 43 08             	mov    %eax,0x8(%ebx)
+  802645:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  80264a:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80264d:	a1 10 60 80 00       	mov    0x806010,%eax
+  802652:	89 43 10             	mov    %eax,0x10(%ebx)
+  802655:	a1 14 60 80 00       	mov    0x806014,%eax
+  80265a:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  80265d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802662:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802665:	c9                   	leave
+  802666:	c3                   	ret
+
+00802667 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  802667:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80266b:	7f 01                	jg     80266e <writebuf+0x7>
+  80266d:	c3                   	ret
+{
+  80266e:	55                   	push   %ebp
+  80266f:	89 e5                	mov    %esp,%ebp
+  802671:	53                   	push   %ebx
+  802672:	83 ec 08             	sub    $0x8,%esp
+  802675:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  802677:	ff 70 04             	push   0x4(%eax)
+  80267a:	8d 40 10             	lea    0x10(%eax),%eax
+  80267d:	50                   	push   %eax
+  80267e:	ff 33                	push   (%ebx)
+  802680:	e8 fe ec ff ff       	call   801383 <write>
+		if (result > 0)
+  802685:	83 c4 10             	add    $0x10,%esp
+  802688:	85 c0                	test   %eax,%eax
+  80268a:	7e 03                	jle    80268f <writebuf+0x28>
+			b->result += result;
+  80268c:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  80268f:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802692:	74 0d                	je     8026a1 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802694:	85 c0                	test   %eax,%eax
+  802696:	ba 00 00 00 00       	mov    $0x0,%edx
+  80269b:	0f 4f c2             	cmovg  %edx,%eax
+  80269e:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  8026a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026a4:	c9                   	leave
+  8026a5:	c3                   	ret
+
+008026a6 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8026a6:	55                   	push   %ebp
+  8026a7:	89 e5                	mov    %esp,%ebp
+  8026a9:	53                   	push   %ebx
+  8026aa:	83 ec 04             	sub    $0x4,%esp
+  8026ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  8026b0:	8b 53 04             	mov    0x4(%ebx),%edx
+  8026b3:	8d 42 01             	lea    0x1(%edx),%eax
+  8026b6:	89 43 04             	mov    %eax,0x4(%ebx)
+  8026b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8026bc:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  8026c0:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8026c5:	74 05                	je     8026cc <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  8026c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026ca:	c9                   	leave
+  8026cb:	c3                   	ret
+		writebuf(b);
+  8026cc:	89 d8                	mov    %ebx,%eax
+  8026ce:	e8 94 ff ff ff       	call   802667 <writebuf>
+		b->idx = 0;
+  8026d3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  8026da:	eb eb                	jmp    8026c7 <putch+0x21>
+
+008026dc <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  8026dc:	55                   	push   %ebp
+  8026dd:	89 e5                	mov    %esp,%ebp
+  8026df:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  8026e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e8:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  8026ee:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8026f5:	00 00 00 
+	b.result = 0;
+  8026f8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8026ff:	00 00 00 
+	b.error = 1;
+  802702:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  802709:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  80270c:	ff 75 10             	push   0x10(%ebp)
+  80270f:	ff 75 0c             	push   0xc(%ebp)
+  802712:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802718:	50                   	push   %eax
+  802719:	68 a6 26 80 00       	push   $0x8026a6
+  80271e:	e8 ab db ff ff       	call   8002ce <vprintfmt>
+	if (b.idx > 0)
+  802723:	83 c4 10             	add    $0x10,%esp
+  802726:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  80272d:	7f 12                	jg     802741 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  80272f:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802735:	85 c0                	test   %eax,%eax
+  802737:	75 06                	jne    80273f <vfprintf+0x63>
+  802739:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  80273f:	c9                   	leave
+  802740:	c3                   	ret
+		writebuf(&b);
+  802741:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802747:	e8 1b ff ff ff       	call   802667 <writebuf>
+  80274c:	eb e1                	jmp    80272f <vfprintf+0x53>
+
+0080274e <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  80274e:	55                   	push   %ebp
+  80274f:	89 e5                	mov    %esp,%ebp
+  802751:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802754:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  802757:	50                   	push   %eax
+  802758:	ff 75 0c             	push   0xc(%ebp)
+  80275b:	ff 75 08             	push   0x8(%ebp)
+  80275e:	e8 79 ff ff ff       	call   8026dc <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802763:	c9                   	leave
+  802764:	c3                   	ret
+
+00802765 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802765:	55                   	push   %ebp
+  802766:	89 e5                	mov    %esp,%ebp
+  802768:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80276b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  80276e:	50                   	push   %eax
+  80276f:	ff 75 08             	push   0x8(%ebp)
+  802772:	6a 01                	push   $0x1
+  802774:	e8 63 ff ff ff       	call   8026dc <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802779:	c9                   	leave
+  80277a:	c3                   	ret
+
+0080277b <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80277b:	55                   	push   %ebp
+  80277c:	89 e5                	mov    %esp,%ebp
+  80277e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802781:	68 b6 3d 80 00       	push   $0x803db6
+  802786:	ff 75 0c             	push   0xc(%ebp)
+  802789:	e8 37 e0 ff ff       	call   8007c5 <strcpy>
+	return 0;
+}
+  80278e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802793:	c9                   	leave
+  802794:	c3                   	ret
+
+00802795 <devsock_close>:
+{
+  802795:	55                   	push   %ebp
+  802796:	89 e5                	mov    %esp,%ebp
+  802798:	53                   	push   %ebx
+  802799:	83 ec 10             	sub    $0x10,%esp
+  80279c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80279f:	53                   	push   %ebx
+  8027a0:	e8 f4 0d 00 00       	call   803599 <pageref>
+  8027a5:	89 c2                	mov    %eax,%edx
+  8027a7:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8027aa:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8027af:	83 fa 01             	cmp    $0x1,%edx
+  8027b2:	74 05                	je     8027b9 <devsock_close+0x24>
+}
+  8027b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027b7:	c9                   	leave
+  8027b8:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8027b9:	83 ec 0c             	sub    $0xc,%esp
+  8027bc:	ff 73 0c             	push   0xc(%ebx)
+  8027bf:	e8 b7 02 00 00       	call   802a7b <nsipc_close>
+  8027c4:	83 c4 10             	add    $0x10,%esp
+  8027c7:	eb eb                	jmp    8027b4 <devsock_close+0x1f>
+
+008027c9 <devsock_write>:
+{
+  8027c9:	55                   	push   %ebp
+  8027ca:	89 e5                	mov    %esp,%ebp
+  8027cc:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8027cf:	6a 00                	push   $0x0
+  8027d1:	ff 75 10             	push   0x10(%ebp)
+  8027d4:	ff 75 0c             	push   0xc(%ebp)
+  8027d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027da:	ff 70 0c             	push   0xc(%eax)
+  8027dd:	e8 79 03 00 00       	call   802b5b <nsipc_send>
+}
+  8027e2:	c9                   	leave
+  8027e3:	c3                   	ret
+
+008027e4 <devsock_read>:
+{
+  8027e4:	55                   	push   %ebp
+  8027e5:	89 e5                	mov    %esp,%ebp
+  8027e7:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8027ea:	6a 00                	push   $0x0
+  8027ec:	ff 75 10             	push   0x10(%ebp)
+  8027ef:	ff 75 0c             	push   0xc(%ebp)
+  8027f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027f5:	ff 70 0c             	push   0xc(%eax)
+  8027f8:	e8 ef 02 00 00       	call   802aec <nsipc_recv>
+}
+  8027fd:	c9                   	leave
+  8027fe:	c3                   	ret
+
+008027ff <fd2sockid>:
+{
+  8027ff:	55                   	push   %ebp
+  802800:	89 e5                	mov    %esp,%ebp
+  802802:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802805:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802808:	52                   	push   %edx
+  802809:	50                   	push   %eax
+  80280a:	e8 40 e8 ff ff       	call   80104f <fd_lookup>
+  80280f:	83 c4 10             	add    $0x10,%esp
+  802812:	85 c0                	test   %eax,%eax
+  802814:	78 10                	js     802826 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802816:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802819:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  80281f:	39 08                	cmp    %ecx,(%eax)
+  802821:	75 05                	jne    802828 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802823:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802826:	c9                   	leave
+  802827:	c3                   	ret
+		return -E_NOT_SUPP;
+  802828:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80282d:	eb f7                	jmp    802826 <fd2sockid+0x27>
+
+0080282f <alloc_sockfd>:
+{
+  80282f:	55                   	push   %ebp
+  802830:	89 e5                	mov    %esp,%ebp
+  802832:	56                   	push   %esi
+  802833:	53                   	push   %ebx
+  802834:	83 ec 1c             	sub    $0x1c,%esp
+  802837:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802839:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80283c:	50                   	push   %eax
+  80283d:	e8 b7 e7 ff ff       	call   800ff9 <fd_alloc>
+  802842:	89 c3                	mov    %eax,%ebx
+  802844:	83 c4 10             	add    $0x10,%esp
+  802847:	85 c0                	test   %eax,%eax
+  802849:	78 43                	js     80288e <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80284b:	83 ec 04             	sub    $0x4,%esp
+  80284e:	68 07 04 00 00       	push   $0x407
+  802853:	ff 75 f4             	push   -0xc(%ebp)
+  802856:	6a 00                	push   $0x0
+  802858:	e8 74 e3 ff ff       	call   800bd1 <sys_page_alloc>
+  80285d:	89 c3                	mov    %eax,%ebx
+  80285f:	83 c4 10             	add    $0x10,%esp
+  802862:	85 c0                	test   %eax,%eax
+  802864:	78 28                	js     80288e <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802866:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802869:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  80286f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802871:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802874:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80287b:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80287e:	83 ec 0c             	sub    $0xc,%esp
+  802881:	50                   	push   %eax
+  802882:	e8 4b e7 ff ff       	call   800fd2 <fd2num>
+  802887:	89 c3                	mov    %eax,%ebx
+  802889:	83 c4 10             	add    $0x10,%esp
+  80288c:	eb 0c                	jmp    80289a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80288e:	83 ec 0c             	sub    $0xc,%esp
+  802891:	56                   	push   %esi
+  802892:	e8 e4 01 00 00       	call   802a7b <nsipc_close>
+		return r;
+  802897:	83 c4 10             	add    $0x10,%esp
+}
+  80289a:	89 d8                	mov    %ebx,%eax
+  80289c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80289f:	5b                   	pop    %ebx
+  8028a0:	5e                   	pop    %esi
+  8028a1:	5d                   	pop    %ebp
+  8028a2:	c3                   	ret
+
+008028a3 <accept>:
+{
+  8028a3:	55                   	push   %ebp
+  8028a4:	89 e5                	mov    %esp,%ebp
+  8028a6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ac:	e8 4e ff ff ff       	call   8027ff <fd2sockid>
+  8028b1:	85 c0                	test   %eax,%eax
+  8028b3:	78 1b                	js     8028d0 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8028b5:	83 ec 04             	sub    $0x4,%esp
+  8028b8:	ff 75 10             	push   0x10(%ebp)
+  8028bb:	ff 75 0c             	push   0xc(%ebp)
+  8028be:	50                   	push   %eax
+  8028bf:	e8 0e 01 00 00       	call   8029d2 <nsipc_accept>
+  8028c4:	83 c4 10             	add    $0x10,%esp
+  8028c7:	85 c0                	test   %eax,%eax
+  8028c9:	78 05                	js     8028d0 <accept+0x2d>
+	return alloc_sockfd(r);
+  8028cb:	e8 5f ff ff ff       	call   80282f <alloc_sockfd>
+}
+  8028d0:	c9                   	leave
+  8028d1:	c3                   	ret
+
+008028d2 <bind>:
+{
+  8028d2:	55                   	push   %ebp
+  8028d3:	89 e5                	mov    %esp,%ebp
+  8028d5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028db:	e8 1f ff ff ff       	call   8027ff <fd2sockid>
+  8028e0:	85 c0                	test   %eax,%eax
+  8028e2:	78 12                	js     8028f6 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8028e4:	83 ec 04             	sub    $0x4,%esp
+  8028e7:	ff 75 10             	push   0x10(%ebp)
+  8028ea:	ff 75 0c             	push   0xc(%ebp)
+  8028ed:	50                   	push   %eax
+  8028ee:	e8 31 01 00 00       	call   802a24 <nsipc_bind>
+  8028f3:	83 c4 10             	add    $0x10,%esp
+}
+  8028f6:	c9                   	leave
+  8028f7:	c3                   	ret
+
+008028f8 <shutdown>:
+{
+  8028f8:	55                   	push   %ebp
+  8028f9:	89 e5                	mov    %esp,%ebp
+  8028fb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802901:	e8 f9 fe ff ff       	call   8027ff <fd2sockid>
+  802906:	85 c0                	test   %eax,%eax
+  802908:	78 0f                	js     802919 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80290a:	83 ec 08             	sub    $0x8,%esp
+  80290d:	ff 75 0c             	push   0xc(%ebp)
+  802910:	50                   	push   %eax
+  802911:	e8 43 01 00 00       	call   802a59 <nsipc_shutdown>
+  802916:	83 c4 10             	add    $0x10,%esp
+}
+  802919:	c9                   	leave
+  80291a:	c3                   	ret
+
+0080291b <connect>:
+{
+  80291b:	55                   	push   %ebp
+  80291c:	89 e5                	mov    %esp,%ebp
+  80291e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802921:	8b 45 08             	mov    0x8(%ebp),%eax
+  802924:	e8 d6 fe ff ff       	call   8027ff <fd2sockid>
+  802929:	85 c0                	test   %eax,%eax
+  80292b:	78 12                	js     80293f <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80292d:	83 ec 04             	sub    $0x4,%esp
+  802930:	ff 75 10             	push   0x10(%ebp)
+  802933:	ff 75 0c             	push   0xc(%ebp)
+  802936:	50                   	push   %eax
+  802937:	e8 59 01 00 00       	call   802a95 <nsipc_connect>
+  80293c:	83 c4 10             	add    $0x10,%esp
+}
+  80293f:	c9                   	leave
+  802940:	c3                   	ret
+
+00802941 <listen>:
+{
+  802941:	55                   	push   %ebp
+  802942:	89 e5                	mov    %esp,%ebp
+  802944:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802947:	8b 45 08             	mov    0x8(%ebp),%eax
+  80294a:	e8 b0 fe ff ff       	call   8027ff <fd2sockid>
+  80294f:	85 c0                	test   %eax,%eax
+  802951:	78 0f                	js     802962 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802953:	83 ec 08             	sub    $0x8,%esp
+  802956:	ff 75 0c             	push   0xc(%ebp)
+  802959:	50                   	push   %eax
+  80295a:	e8 6b 01 00 00       	call   802aca <nsipc_listen>
+  80295f:	83 c4 10             	add    $0x10,%esp
+}
+  802962:	c9                   	leave
+  802963:	c3                   	ret
+
+00802964 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802964:	55                   	push   %ebp
+  802965:	89 e5                	mov    %esp,%ebp
+  802967:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80296a:	ff 75 10             	push   0x10(%ebp)
+  80296d:	ff 75 0c             	push   0xc(%ebp)
+  802970:	ff 75 08             	push   0x8(%ebp)
+  802973:	e8 41 02 00 00       	call   802bb9 <nsipc_socket>
+  802978:	83 c4 10             	add    $0x10,%esp
+  80297b:	85 c0                	test   %eax,%eax
+  80297d:	78 05                	js     802984 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80297f:	e8 ab fe ff ff       	call   80282f <alloc_sockfd>
+}
+  802984:	c9                   	leave
+  802985:	c3                   	ret
+
+00802986 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802986:	55                   	push   %ebp
+  802987:	89 e5                	mov    %esp,%ebp
+  802989:	53                   	push   %ebx
+  80298a:	83 ec 04             	sub    $0x4,%esp
+  80298d:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80298f:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802996:	74 26                	je     8029be <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802998:	6a 07                	push   $0x7
+  80299a:	68 00 80 80 00       	push   $0x808000
+  80299f:	53                   	push   %ebx
+  8029a0:	ff 35 00 90 80 00    	push   0x809000
+  8029a6:	e8 76 0a 00 00       	call   803421 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8029ab:	83 c4 0c             	add    $0xc,%esp
+  8029ae:	6a 00                	push   $0x0
+  8029b0:	6a 00                	push   $0x0
+  8029b2:	6a 00                	push   $0x0
+  8029b4:	e8 fd 09 00 00       	call   8033b6 <ipc_recv>
+}
+  8029b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029bc:	c9                   	leave
+  8029bd:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8029be:	83 ec 0c             	sub    $0xc,%esp
+  8029c1:	6a 02                	push   $0x2
+  8029c3:	e8 92 0b 00 00       	call   80355a <ipc_find_env>
+  8029c8:	a3 00 90 80 00       	mov    %eax,0x809000
+  8029cd:	83 c4 10             	add    $0x10,%esp
+  8029d0:	eb c6                	jmp    802998 <nsipc+0x12>
+
+008029d2 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8029d2:	55                   	push   %ebp
+  8029d3:	89 e5                	mov    %esp,%ebp
+  8029d5:	56                   	push   %esi
+  8029d6:	53                   	push   %ebx
+  8029d7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8029da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029dd:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8029e2:	8b 06                	mov    (%esi),%eax
+  8029e4:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8029e9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029ee:	e8 93 ff ff ff       	call   802986 <nsipc>
+  8029f3:	89 c3                	mov    %eax,%ebx
+  8029f5:	85 c0                	test   %eax,%eax
+  8029f7:	79 09                	jns    802a02 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8029f9:	89 d8                	mov    %ebx,%eax
+  8029fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029fe:	5b                   	pop    %ebx
+  8029ff:	5e                   	pop    %esi
+  802a00:	5d                   	pop    %ebp
+  802a01:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a02:	83 ec 04             	sub    $0x4,%esp
+  802a05:	ff 35 10 80 80 00    	push   0x808010
+  802a0b:	68 00 80 80 00       	push   $0x808000
+  802a10:	ff 75 0c             	push   0xc(%ebp)
+  802a13:	e8 33 df ff ff       	call   80094b <memmove>
+		*addrlen = ret->ret_addrlen;
+  802a18:	a1 10 80 80 00       	mov    0x808010,%eax
+  802a1d:	89 06                	mov    %eax,(%esi)
+  802a1f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802a22:	eb d5                	jmp    8029f9 <nsipc_accept+0x27>
+
+00802a24 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802a24:	55                   	push   %ebp
+  802a25:	89 e5                	mov    %esp,%ebp
+  802a27:	53                   	push   %ebx
+  802a28:	83 ec 08             	sub    $0x8,%esp
+  802a2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802a2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a31:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802a36:	53                   	push   %ebx
+  802a37:	ff 75 0c             	push   0xc(%ebp)
+  802a3a:	68 04 80 80 00       	push   $0x808004
+  802a3f:	e8 07 df ff ff       	call   80094b <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802a44:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802a4a:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a4f:	e8 32 ff ff ff       	call   802986 <nsipc>
+}
+  802a54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a57:	c9                   	leave
+  802a58:	c3                   	ret
+
+00802a59 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802a59:	55                   	push   %ebp
+  802a5a:	89 e5                	mov    %esp,%ebp
+  802a5c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802a5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a62:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802a67:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a6a:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802a6f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a74:	e8 0d ff ff ff       	call   802986 <nsipc>
+}
+  802a79:	c9                   	leave
+  802a7a:	c3                   	ret
+
+00802a7b <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802a7b:	55                   	push   %ebp
+  802a7c:	89 e5                	mov    %esp,%ebp
+  802a7e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802a81:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a84:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802a89:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a8e:	e8 f3 fe ff ff       	call   802986 <nsipc>
+}
+  802a93:	c9                   	leave
+  802a94:	c3                   	ret
+
+00802a95 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802a95:	55                   	push   %ebp
+  802a96:	89 e5                	mov    %esp,%ebp
+  802a98:	53                   	push   %ebx
+  802a99:	83 ec 08             	sub    $0x8,%esp
+  802a9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa2:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802aa7:	53                   	push   %ebx
+  802aa8:	ff 75 0c             	push   0xc(%ebp)
+  802aab:	68 04 80 80 00       	push   $0x808004
+  802ab0:	e8 96 de ff ff       	call   80094b <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802ab5:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802abb:	b8 05 00 00 00       	mov    $0x5,%eax
+  802ac0:	e8 c1 fe ff ff       	call   802986 <nsipc>
+}
+  802ac5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ac8:	c9                   	leave
+  802ac9:	c3                   	ret
+
+00802aca <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802aca:	55                   	push   %ebp
+  802acb:	89 e5                	mov    %esp,%ebp
+  802acd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802ad0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802ad8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802adb:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802ae0:	b8 06 00 00 00       	mov    $0x6,%eax
+  802ae5:	e8 9c fe ff ff       	call   802986 <nsipc>
+}
+  802aea:	c9                   	leave
+  802aeb:	c3                   	ret
+
+00802aec <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802aec:	55                   	push   %ebp
+  802aed:	89 e5                	mov    %esp,%ebp
+  802aef:	56                   	push   %esi
+  802af0:	53                   	push   %ebx
+  802af1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802af4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802afc:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802b02:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b05:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b0a:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b0f:	e8 72 fe ff ff       	call   802986 <nsipc>
+  802b14:	89 c3                	mov    %eax,%ebx
+  802b16:	85 c0                	test   %eax,%eax
+  802b18:	78 22                	js     802b3c <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802b1a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b1f:	39 c6                	cmp    %eax,%esi
+  802b21:	0f 4e c6             	cmovle %esi,%eax
+  802b24:	39 c3                	cmp    %eax,%ebx
+  802b26:	7f 1d                	jg     802b45 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802b28:	83 ec 04             	sub    $0x4,%esp
+  802b2b:	53                   	push   %ebx
+  802b2c:	68 00 80 80 00       	push   $0x808000
+  802b31:	ff 75 0c             	push   0xc(%ebp)
+  802b34:	e8 12 de ff ff       	call   80094b <memmove>
+  802b39:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802b3c:	89 d8                	mov    %ebx,%eax
+  802b3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b41:	5b                   	pop    %ebx
+  802b42:	5e                   	pop    %esi
+  802b43:	5d                   	pop    %ebp
+  802b44:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802b45:	68 c2 3d 80 00       	push   $0x803dc2
+  802b4a:	68 60 3d 80 00       	push   $0x803d60
+  802b4f:	6a 62                	push   $0x62
+  802b51:	68 d7 3d 80 00       	push   $0x803dd7
+  802b56:	e8 a1 d5 ff ff       	call   8000fc <_panic>
+
+00802b5b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802b5b:	55                   	push   %ebp
+  802b5c:	89 e5                	mov    %esp,%ebp
+  802b5e:	53                   	push   %ebx
+  802b5f:	83 ec 04             	sub    $0x4,%esp
+  802b62:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802b65:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b68:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802b6d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802b73:	7f 2e                	jg     802ba3 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802b75:	83 ec 04             	sub    $0x4,%esp
+  802b78:	53                   	push   %ebx
+  802b79:	ff 75 0c             	push   0xc(%ebp)
+  802b7c:	68 0c 80 80 00       	push   $0x80800c
+  802b81:	e8 c5 dd ff ff       	call   80094b <memmove>
+	nsipcbuf.send.req_size = size;
+  802b86:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802b8c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b8f:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802b94:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b99:	e8 e8 fd ff ff       	call   802986 <nsipc>
+}
+  802b9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ba1:	c9                   	leave
+  802ba2:	c3                   	ret
+	assert(size < 1600);
+  802ba3:	68 e3 3d 80 00       	push   $0x803de3
+  802ba8:	68 60 3d 80 00       	push   $0x803d60
+  802bad:	6a 6d                	push   $0x6d
+  802baf:	68 d7 3d 80 00       	push   $0x803dd7
+  802bb4:	e8 43 d5 ff ff       	call   8000fc <_panic>
+
+00802bb9 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802bb9:	55                   	push   %ebp
+  802bba:	89 e5                	mov    %esp,%ebp
+  802bbc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802bbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802bc7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bca:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802bcf:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bd2:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802bd7:	b8 09 00 00 00       	mov    $0x9,%eax
+  802bdc:	e8 a5 fd ff ff       	call   802986 <nsipc>
+}
+  802be1:	c9                   	leave
+  802be2:	c3                   	ret
+
+00802be3 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802be3:	55                   	push   %ebp
+  802be4:	89 e5                	mov    %esp,%ebp
+  802be6:	56                   	push   %esi
+  802be7:	53                   	push   %ebx
+  802be8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802beb:	83 ec 0c             	sub    $0xc,%esp
+  802bee:	ff 75 08             	push   0x8(%ebp)
+  802bf1:	e8 ec e3 ff ff       	call   800fe2 <fd2data>
+  802bf6:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802bf8:	83 c4 08             	add    $0x8,%esp
+  802bfb:	68 ef 3d 80 00       	push   $0x803def
+  802c00:	53                   	push   %ebx
+  802c01:	e8 bf db ff ff       	call   8007c5 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802c06:	8b 46 04             	mov    0x4(%esi),%eax
+  802c09:	2b 06                	sub    (%esi),%eax
+  802c0b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802c11:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802c18:	00 00 00 
+	stat->st_dev = &devpipe;
+  802c1b:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802c22:	40 80 00 
+	return 0;
+}
+  802c25:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c2d:	5b                   	pop    %ebx
+  802c2e:	5e                   	pop    %esi
+  802c2f:	5d                   	pop    %ebp
+  802c30:	c3                   	ret
+
+00802c31 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802c31:	55                   	push   %ebp
+  802c32:	89 e5                	mov    %esp,%ebp
+  802c34:	53                   	push   %ebx
+  802c35:	83 ec 0c             	sub    $0xc,%esp
+  802c38:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802c3b:	53                   	push   %ebx
+  802c3c:	6a 00                	push   $0x0
+  802c3e:	e8 1b e0 ff ff       	call   800c5e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802c43:	89 1c 24             	mov    %ebx,(%esp)
+  802c46:	e8 97 e3 ff ff       	call   800fe2 <fd2data>
+  802c4b:	83 c4 08             	add    $0x8,%esp
+  802c4e:	50                   	push   %eax
+  802c4f:	6a 00                	push   $0x0
+  802c51:	e8 08 e0 ff ff       	call   800c5e <sys_page_unmap>
+}
+  802c56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c59:	c9                   	leave
+  802c5a:	c3                   	ret
+
+00802c5b <_pipeisclosed>:
+{
+  802c5b:	55                   	push   %ebp
+  802c5c:	89 e5                	mov    %esp,%ebp
+  802c5e:	57                   	push   %edi
+  802c5f:	56                   	push   %esi
+  802c60:	53                   	push   %ebx
+  802c61:	83 ec 1c             	sub    $0x1c,%esp
+  802c64:	89 c7                	mov    %eax,%edi
+  802c66:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802c68:	a1 00 50 80 00       	mov    0x805000,%eax
+  802c6d:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802c70:	83 ec 0c             	sub    $0xc,%esp
+  802c73:	57                   	push   %edi
+  802c74:	e8 20 09 00 00       	call   803599 <pageref>
+  802c79:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c7c:	89 34 24             	mov    %esi,(%esp)
+  802c7f:	e8 15 09 00 00       	call   803599 <pageref>
+		nn = thisenv->env_runs;
+  802c84:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802c8a:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802c8d:	83 c4 10             	add    $0x10,%esp
+  802c90:	39 cb                	cmp    %ecx,%ebx
+  802c92:	74 1b                	je     802caf <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802c94:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c97:	75 cf                	jne    802c68 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802c99:	8b 42 58             	mov    0x58(%edx),%eax
+  802c9c:	6a 01                	push   $0x1
+  802c9e:	50                   	push   %eax
+  802c9f:	53                   	push   %ebx
+  802ca0:	68 f6 3d 80 00       	push   $0x803df6
+  802ca5:	e8 2d d5 ff ff       	call   8001d7 <cprintf>
+  802caa:	83 c4 10             	add    $0x10,%esp
+  802cad:	eb b9                	jmp    802c68 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802caf:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802cb2:	0f 94 c0             	sete   %al
+  802cb5:	0f b6 c0             	movzbl %al,%eax
+}
+  802cb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cbb:	5b                   	pop    %ebx
+  802cbc:	5e                   	pop    %esi
+  802cbd:	5f                   	pop    %edi
+  802cbe:	5d                   	pop    %ebp
+  802cbf:	c3                   	ret
+
+00802cc0 <devpipe_write>:
+{
+  802cc0:	55                   	push   %ebp
+  802cc1:	89 e5                	mov    %esp,%ebp
+  802cc3:	57                   	push   %edi
+  802cc4:	56                   	push   %esi
+  802cc5:	53                   	push   %ebx
+  802cc6:	83 ec 28             	sub    $0x28,%esp
+  802cc9:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802ccc:	56                   	push   %esi
+  802ccd:	e8 10 e3 ff ff       	call   800fe2 <fd2data>
+  802cd2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802cd4:	83 c4 10             	add    $0x10,%esp
+  802cd7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cdc:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802cdf:	75 09                	jne    802cea <devpipe_write+0x2a>
+	return i;
+  802ce1:	89 f8                	mov    %edi,%eax
+  802ce3:	eb 23                	jmp    802d08 <devpipe_write+0x48>
+			sys_yield();
+  802ce5:	e8 c8 de ff ff       	call   800bb2 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802cea:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ced:	8b 0b                	mov    (%ebx),%ecx
+  802cef:	8d 51 20             	lea    0x20(%ecx),%edx
+  802cf2:	39 d0                	cmp    %edx,%eax
+  802cf4:	72 1a                	jb     802d10 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802cf6:	89 da                	mov    %ebx,%edx
+  802cf8:	89 f0                	mov    %esi,%eax
+  802cfa:	e8 5c ff ff ff       	call   802c5b <_pipeisclosed>
+  802cff:	85 c0                	test   %eax,%eax
+  802d01:	74 e2                	je     802ce5 <devpipe_write+0x25>
+				return 0;
+  802d03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d0b:	5b                   	pop    %ebx
+  802d0c:	5e                   	pop    %esi
+  802d0d:	5f                   	pop    %edi
+  802d0e:	5d                   	pop    %ebp
+  802d0f:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802d10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d13:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802d17:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802d1a:	89 c2                	mov    %eax,%edx
+  802d1c:	c1 fa 1f             	sar    $0x1f,%edx
+  802d1f:	89 d1                	mov    %edx,%ecx
+  802d21:	c1 e9 1b             	shr    $0x1b,%ecx
+  802d24:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802d27:	83 e2 1f             	and    $0x1f,%edx
+  802d2a:	29 ca                	sub    %ecx,%edx
+  802d2c:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802d30:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802d34:	83 c0 01             	add    $0x1,%eax
+  802d37:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802d3a:	83 c7 01             	add    $0x1,%edi
+  802d3d:	eb 9d                	jmp    802cdc <devpipe_write+0x1c>
+
+00802d3f <devpipe_read>:
+{
+  802d3f:	55                   	push   %ebp
+  802d40:	89 e5                	mov    %esp,%ebp
+  802d42:	57                   	push   %edi
+  802d43:	56                   	push   %esi
+  802d44:	53                   	push   %ebx
+  802d45:	83 ec 18             	sub    $0x18,%esp
+  802d48:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802d4b:	57                   	push   %edi
+  802d4c:	e8 91 e2 ff ff       	call   800fe2 <fd2data>
+  802d51:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802d53:	83 c4 10             	add    $0x10,%esp
+  802d56:	be 00 00 00 00       	mov    $0x0,%esi
+  802d5b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802d5e:	75 13                	jne    802d73 <devpipe_read+0x34>
+	return i;
+  802d60:	89 f0                	mov    %esi,%eax
+  802d62:	eb 02                	jmp    802d66 <devpipe_read+0x27>
+				return i;
+  802d64:	89 f0                	mov    %esi,%eax
+}
+  802d66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d69:	5b                   	pop    %ebx
+  802d6a:	5e                   	pop    %esi
+  802d6b:	5f                   	pop    %edi
+  802d6c:	5d                   	pop    %ebp
+  802d6d:	c3                   	ret
+			sys_yield();
+  802d6e:	e8 3f de ff ff       	call   800bb2 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802d73:	8b 03                	mov    (%ebx),%eax
+  802d75:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802d78:	75 18                	jne    802d92 <devpipe_read+0x53>
+			if (i > 0)
+  802d7a:	85 f6                	test   %esi,%esi
+  802d7c:	75 e6                	jne    802d64 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802d7e:	89 da                	mov    %ebx,%edx
+  802d80:	89 f8                	mov    %edi,%eax
+  802d82:	e8 d4 fe ff ff       	call   802c5b <_pipeisclosed>
+  802d87:	85 c0                	test   %eax,%eax
+  802d89:	74 e3                	je     802d6e <devpipe_read+0x2f>
+				return 0;
+  802d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d90:	eb d4                	jmp    802d66 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802d92:	99                   	cltd
+  802d93:	c1 ea 1b             	shr    $0x1b,%edx
+  802d96:	01 d0                	add    %edx,%eax
+  802d98:	83 e0 1f             	and    $0x1f,%eax
+  802d9b:	29 d0                	sub    %edx,%eax
+  802d9d:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802da2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802da5:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802da8:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802dab:	83 c6 01             	add    $0x1,%esi
+  802dae:	eb ab                	jmp    802d5b <devpipe_read+0x1c>
+
+00802db0 <pipe>:
+{
+  802db0:	55                   	push   %ebp
+  802db1:	89 e5                	mov    %esp,%ebp
+  802db3:	56                   	push   %esi
+  802db4:	53                   	push   %ebx
+  802db5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802db8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dbb:	50                   	push   %eax
+  802dbc:	e8 38 e2 ff ff       	call   800ff9 <fd_alloc>
+  802dc1:	89 c3                	mov    %eax,%ebx
+  802dc3:	83 c4 10             	add    $0x10,%esp
+  802dc6:	85 c0                	test   %eax,%eax
+  802dc8:	0f 88 23 01 00 00    	js     802ef1 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802dce:	83 ec 04             	sub    $0x4,%esp
+  802dd1:	68 07 04 00 00       	push   $0x407
+  802dd6:	ff 75 f4             	push   -0xc(%ebp)
+  802dd9:	6a 00                	push   $0x0
+  802ddb:	e8 f1 dd ff ff       	call   800bd1 <sys_page_alloc>
+  802de0:	89 c3                	mov    %eax,%ebx
+  802de2:	83 c4 10             	add    $0x10,%esp
+  802de5:	85 c0                	test   %eax,%eax
+  802de7:	0f 88 04 01 00 00    	js     802ef1 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802ded:	83 ec 0c             	sub    $0xc,%esp
+  802df0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802df3:	50                   	push   %eax
+  802df4:	e8 00 e2 ff ff       	call   800ff9 <fd_alloc>
+  802df9:	89 c3                	mov    %eax,%ebx
+  802dfb:	83 c4 10             	add    $0x10,%esp
+  802dfe:	85 c0                	test   %eax,%eax
+  802e00:	0f 88 db 00 00 00    	js     802ee1 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e06:	83 ec 04             	sub    $0x4,%esp
+  802e09:	68 07 04 00 00       	push   $0x407
+  802e0e:	ff 75 f0             	push   -0x10(%ebp)
+  802e11:	6a 00                	push   $0x0
+  802e13:	e8 b9 dd ff ff       	call   800bd1 <sys_page_alloc>
+  802e18:	89 c3                	mov    %eax,%ebx
+  802e1a:	83 c4 10             	add    $0x10,%esp
+  802e1d:	85 c0                	test   %eax,%eax
+  802e1f:	0f 88 bc 00 00 00    	js     802ee1 <pipe+0x131>
+	va = fd2data(fd0);
+  802e25:	83 ec 0c             	sub    $0xc,%esp
+  802e28:	ff 75 f4             	push   -0xc(%ebp)
+  802e2b:	e8 b2 e1 ff ff       	call   800fe2 <fd2data>
+  802e30:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e32:	83 c4 0c             	add    $0xc,%esp
+  802e35:	68 07 04 00 00       	push   $0x407
+  802e3a:	50                   	push   %eax
+  802e3b:	6a 00                	push   $0x0
+  802e3d:	e8 8f dd ff ff       	call   800bd1 <sys_page_alloc>
+  802e42:	89 c3                	mov    %eax,%ebx
+  802e44:	83 c4 10             	add    $0x10,%esp
+  802e47:	85 c0                	test   %eax,%eax
+  802e49:	0f 88 82 00 00 00    	js     802ed1 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e4f:	83 ec 0c             	sub    $0xc,%esp
+  802e52:	ff 75 f0             	push   -0x10(%ebp)
+  802e55:	e8 88 e1 ff ff       	call   800fe2 <fd2data>
+  802e5a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802e61:	50                   	push   %eax
+  802e62:	6a 00                	push   $0x0
+  802e64:	56                   	push   %esi
+  802e65:	6a 00                	push   $0x0
+  802e67:	e8 b0 dd ff ff       	call   800c1c <sys_page_map>
+  802e6c:	89 c3                	mov    %eax,%ebx
+  802e6e:	83 c4 20             	add    $0x20,%esp
+  802e71:	85 c0                	test   %eax,%eax
+  802e73:	78 4e                	js     802ec3 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802e75:	a1 60 40 80 00       	mov    0x804060,%eax
+  802e7a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802e7d:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802e7f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802e82:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802e89:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802e8c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802e8e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802e91:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802e98:	83 ec 0c             	sub    $0xc,%esp
+  802e9b:	ff 75 f4             	push   -0xc(%ebp)
+  802e9e:	e8 2f e1 ff ff       	call   800fd2 <fd2num>
+  802ea3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ea6:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802ea8:	83 c4 04             	add    $0x4,%esp
+  802eab:	ff 75 f0             	push   -0x10(%ebp)
+  802eae:	e8 1f e1 ff ff       	call   800fd2 <fd2num>
+  802eb3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802eb6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802eb9:	83 c4 10             	add    $0x10,%esp
+  802ebc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ec1:	eb 2e                	jmp    802ef1 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802ec3:	83 ec 08             	sub    $0x8,%esp
+  802ec6:	56                   	push   %esi
+  802ec7:	6a 00                	push   $0x0
+  802ec9:	e8 90 dd ff ff       	call   800c5e <sys_page_unmap>
+  802ece:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802ed1:	83 ec 08             	sub    $0x8,%esp
+  802ed4:	ff 75 f0             	push   -0x10(%ebp)
+  802ed7:	6a 00                	push   $0x0
+  802ed9:	e8 80 dd ff ff       	call   800c5e <sys_page_unmap>
+  802ede:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802ee1:	83 ec 08             	sub    $0x8,%esp
+  802ee4:	ff 75 f4             	push   -0xc(%ebp)
+  802ee7:	6a 00                	push   $0x0
+  802ee9:	e8 70 dd ff ff       	call   800c5e <sys_page_unmap>
+  802eee:	83 c4 10             	add    $0x10,%esp
+}
+  802ef1:	89 d8                	mov    %ebx,%eax
+  802ef3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ef6:	5b                   	pop    %ebx
+  802ef7:	5e                   	pop    %esi
+  802ef8:	5d                   	pop    %ebp
+  802ef9:	c3                   	ret
+
+00802efa <pipeisclosed>:
+{
+  802efa:	55                   	push   %ebp
+  802efb:	89 e5                	mov    %esp,%ebp
+  802efd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f00:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f03:	50                   	push   %eax
+  802f04:	ff 75 08             	push   0x8(%ebp)
+  802f07:	e8 43 e1 ff ff       	call   80104f <fd_lookup>
+  802f0c:	83 c4 10             	add    $0x10,%esp
+  802f0f:	85 c0                	test   %eax,%eax
+  802f11:	78 18                	js     802f2b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802f13:	83 ec 0c             	sub    $0xc,%esp
+  802f16:	ff 75 f4             	push   -0xc(%ebp)
+  802f19:	e8 c4 e0 ff ff       	call   800fe2 <fd2data>
+  802f1e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802f20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f23:	e8 33 fd ff ff       	call   802c5b <_pipeisclosed>
+  802f28:	83 c4 10             	add    $0x10,%esp
+}
+  802f2b:	c9                   	leave
+  802f2c:	c3                   	ret
+
+00802f2d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f32:	c3                   	ret
+
+00802f33 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f33:	55                   	push   %ebp
+  802f34:	89 e5                	mov    %esp,%ebp
+  802f36:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802f39:	68 0e 3e 80 00       	push   $0x803e0e
+  802f3e:	ff 75 0c             	push   0xc(%ebp)
+  802f41:	e8 7f d8 ff ff       	call   8007c5 <strcpy>
+	return 0;
+}
+  802f46:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f4b:	c9                   	leave
+  802f4c:	c3                   	ret
+
+00802f4d <devcons_write>:
+{
+  802f4d:	55                   	push   %ebp
+  802f4e:	89 e5                	mov    %esp,%ebp
+  802f50:	57                   	push   %edi
+  802f51:	56                   	push   %esi
+  802f52:	53                   	push   %ebx
+  802f53:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802f59:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802f5e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802f64:	eb 2e                	jmp    802f94 <devcons_write+0x47>
+		m = n - tot;
+  802f66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f69:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802f6b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802f70:	39 c3                	cmp    %eax,%ebx
+  802f72:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802f75:	83 ec 04             	sub    $0x4,%esp
+  802f78:	53                   	push   %ebx
+  802f79:	89 f0                	mov    %esi,%eax
+  802f7b:	03 45 0c             	add    0xc(%ebp),%eax
+  802f7e:	50                   	push   %eax
+  802f7f:	57                   	push   %edi
+  802f80:	e8 c6 d9 ff ff       	call   80094b <memmove>
+		sys_cputs(buf, m);
+  802f85:	83 c4 08             	add    $0x8,%esp
+  802f88:	53                   	push   %ebx
+  802f89:	57                   	push   %edi
+  802f8a:	e8 66 db ff ff       	call   800af5 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802f8f:	01 de                	add    %ebx,%esi
+  802f91:	83 c4 10             	add    $0x10,%esp
+  802f94:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802f97:	72 cd                	jb     802f66 <devcons_write+0x19>
+}
+  802f99:	89 f0                	mov    %esi,%eax
+  802f9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f9e:	5b                   	pop    %ebx
+  802f9f:	5e                   	pop    %esi
+  802fa0:	5f                   	pop    %edi
+  802fa1:	5d                   	pop    %ebp
+  802fa2:	c3                   	ret
+
+00802fa3 <devcons_read>:
+{
+  802fa3:	55                   	push   %ebp
+  802fa4:	89 e5                	mov    %esp,%ebp
+  802fa6:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fae:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802fb2:	75 07                	jne    802fbb <devcons_read+0x18>
+  802fb4:	eb 1f                	jmp    802fd5 <devcons_read+0x32>
+		sys_yield();
+  802fb6:	e8 f7 db ff ff       	call   800bb2 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802fbb:	e8 5b db ff ff       	call   800b1b <sys_cgetc>
+  802fc0:	85 c0                	test   %eax,%eax
+  802fc2:	74 f2                	je     802fb6 <devcons_read+0x13>
+	if (c < 0)
+  802fc4:	78 0f                	js     802fd5 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802fc6:	83 f8 04             	cmp    $0x4,%eax
+  802fc9:	74 0c                	je     802fd7 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802fcb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802fce:	88 02                	mov    %al,(%edx)
+	return 1;
+  802fd0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802fd5:	c9                   	leave
+  802fd6:	c3                   	ret
+		return 0;
+  802fd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fdc:	eb f7                	jmp    802fd5 <devcons_read+0x32>
+
+00802fde <cputchar>:
+{
+  802fde:	55                   	push   %ebp
+  802fdf:	89 e5                	mov    %esp,%ebp
+  802fe1:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802fe4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fe7:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802fea:	6a 01                	push   $0x1
+  802fec:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802fef:	50                   	push   %eax
+  802ff0:	e8 00 db ff ff       	call   800af5 <sys_cputs>
+}
+  802ff5:	83 c4 10             	add    $0x10,%esp
+  802ff8:	c9                   	leave
+  802ff9:	c3                   	ret
+
+00802ffa <getchar>:
+{
+  802ffa:	55                   	push   %ebp
+  802ffb:	89 e5                	mov    %esp,%ebp
+  802ffd:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803000:	6a 01                	push   $0x1
+  803002:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803005:	50                   	push   %eax
+  803006:	6a 00                	push   $0x0
+  803008:	e8 a8 e2 ff ff       	call   8012b5 <read>
+	if (r < 0)
+  80300d:	83 c4 10             	add    $0x10,%esp
+  803010:	85 c0                	test   %eax,%eax
+  803012:	78 06                	js     80301a <getchar+0x20>
+	if (r < 1)
+  803014:	74 06                	je     80301c <getchar+0x22>
+	return c;
+  803016:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80301a:	c9                   	leave
+  80301b:	c3                   	ret
+		return -E_EOF;
+  80301c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803021:	eb f7                	jmp    80301a <getchar+0x20>
+
+00803023 <iscons>:
+{
+  803023:	55                   	push   %ebp
+  803024:	89 e5                	mov    %esp,%ebp
+  803026:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803029:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80302c:	50                   	push   %eax
+  80302d:	ff 75 08             	push   0x8(%ebp)
+  803030:	e8 1a e0 ff ff       	call   80104f <fd_lookup>
+  803035:	83 c4 10             	add    $0x10,%esp
+  803038:	85 c0                	test   %eax,%eax
+  80303a:	78 11                	js     80304d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80303c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80303f:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  803045:	39 10                	cmp    %edx,(%eax)
+  803047:	0f 94 c0             	sete   %al
+  80304a:	0f b6 c0             	movzbl %al,%eax
+}
+  80304d:	c9                   	leave
+  80304e:	c3                   	ret
+
+0080304f <opencons>:
+{
+  80304f:	55                   	push   %ebp
+  803050:	89 e5                	mov    %esp,%ebp
+  803052:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803055:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803058:	50                   	push   %eax
+  803059:	e8 9b df ff ff       	call   800ff9 <fd_alloc>
+  80305e:	83 c4 10             	add    $0x10,%esp
+  803061:	85 c0                	test   %eax,%eax
+  803063:	78 3a                	js     80309f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803065:	83 ec 04             	sub    $0x4,%esp
+  803068:	68 07 04 00 00       	push   $0x407
+  80306d:	ff 75 f4             	push   -0xc(%ebp)
+  803070:	6a 00                	push   $0x0
+  803072:	e8 5a db ff ff       	call   800bd1 <sys_page_alloc>
+  803077:	83 c4 10             	add    $0x10,%esp
+  80307a:	85 c0                	test   %eax,%eax
+  80307c:	78 21                	js     80309f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80307e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803081:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  803087:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803089:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80308c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803093:	83 ec 0c             	sub    $0xc,%esp
+  803096:	50                   	push   %eax
+  803097:	e8 36 df ff ff       	call   800fd2 <fd2num>
+  80309c:	83 c4 10             	add    $0x10,%esp
+}
+  80309f:	c9                   	leave
+  8030a0:	c3                   	ret
+
+008030a1 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  8030a1:	55                   	push   %ebp
+  8030a2:	89 e5                	mov    %esp,%ebp
+  8030a4:	57                   	push   %edi
+  8030a5:	56                   	push   %esi
+  8030a6:	53                   	push   %ebx
+  8030a7:	83 ec 20             	sub    $0x20,%esp
+  8030aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030ad:	89 d7                	mov    %edx,%edi
+  8030af:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  8030b1:	51                   	push   %ecx
+  8030b2:	68 00 f0 7f 00       	push   $0x7ff000
+  8030b7:	6a 00                	push   $0x0
+  8030b9:	e8 13 db ff ff       	call   800bd1 <sys_page_alloc>
+  8030be:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8030c0:	83 c4 10             	add    $0x10,%esp
+  8030c3:	85 c0                	test   %eax,%eax
+  8030c5:	78 45                	js     80310c <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  8030c7:	83 ec 04             	sub    $0x4,%esp
+  8030ca:	68 00 10 00 00       	push   $0x1000
+  8030cf:	57                   	push   %edi
+  8030d0:	68 00 f0 7f 00       	push   $0x7ff000
+  8030d5:	e8 71 d8 ff ff       	call   80094b <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8030da:	89 34 24             	mov    %esi,(%esp)
+  8030dd:	57                   	push   %edi
+  8030de:	ff 75 e4             	push   -0x1c(%ebp)
+  8030e1:	68 00 f0 7f 00       	push   $0x7ff000
+  8030e6:	6a 00                	push   $0x0
+  8030e8:	e8 2f db ff ff       	call   800c1c <sys_page_map>
+  8030ed:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8030ef:	83 c4 20             	add    $0x20,%esp
+  8030f2:	85 c0                	test   %eax,%eax
+  8030f4:	78 16                	js     80310c <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8030f6:	83 ec 08             	sub    $0x8,%esp
+  8030f9:	68 00 f0 7f 00       	push   $0x7ff000
+  8030fe:	6a 00                	push   $0x0
+  803100:	e8 59 db ff ff       	call   800c5e <sys_page_unmap>
+  803105:	83 c4 10             	add    $0x10,%esp
+  803108:	85 c0                	test   %eax,%eax
+  80310a:	75 0a                	jne    803116 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  80310c:	89 d8                	mov    %ebx,%eax
+  80310e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803111:	5b                   	pop    %ebx
+  803112:	5e                   	pop    %esi
+  803113:	5f                   	pop    %edi
+  803114:	5d                   	pop    %ebp
+  803115:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803116:	68 1c 3e 80 00       	push   $0x803e1c
+  80311b:	68 60 3d 80 00       	push   $0x803d60
+  803120:	6a 1b                	push   $0x1b
+  803122:	68 94 3e 80 00       	push   $0x803e94
+  803127:	e8 d0 cf ff ff       	call   8000fc <_panic>
+
+0080312c <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80312c:	55                   	push   %ebp
+  80312d:	89 e5                	mov    %esp,%ebp
+  80312f:	53                   	push   %ebx
+  803130:	83 ec 04             	sub    $0x4,%esp
+  803133:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803136:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803138:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  80313c:	74 21                	je     80315f <pgfault+0x33>
+  80313e:	89 d0                	mov    %edx,%eax
+  803140:	c1 e8 16             	shr    $0x16,%eax
+  803143:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80314a:	a8 01                	test   $0x1,%al
+  80314c:	74 11                	je     80315f <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  80314e:	89 d0                	mov    %edx,%eax
+  803150:	c1 e8 0c             	shr    $0xc,%eax
+  803153:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80315a:	f6 c4 08             	test   $0x8,%ah
+  80315d:	75 17                	jne    803176 <pgfault+0x4a>
+		if (pgfault_next) {
+  80315f:	a1 04 90 80 00       	mov    0x809004,%eax
+  803164:	85 c0                	test   %eax,%eax
+  803166:	74 27                	je     80318f <pgfault+0x63>
+			pgfault_next(utf);
+  803168:	83 ec 0c             	sub    $0xc,%esp
+  80316b:	53                   	push   %ebx
+  80316c:	ff d0                	call   *%eax
+			return;
+  80316e:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803174:	c9                   	leave
+  803175:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803176:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80317c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803181:	b8 00 00 00 00       	mov    $0x0,%eax
+  803186:	e8 16 ff ff ff       	call   8030a1 <copy_page_to>
+  80318b:	85 c0                	test   %eax,%eax
+  80318d:	79 e2                	jns    803171 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  80318f:	a1 00 50 80 00       	mov    0x805000,%eax
+  803194:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803197:	ff 73 28             	push   0x28(%ebx)
+  80319a:	ff 33                	push   (%ebx)
+  80319c:	50                   	push   %eax
+  80319d:	68 40 3e 80 00       	push   $0x803e40
+  8031a2:	e8 30 d0 ff ff       	call   8001d7 <cprintf>
+	sys_env_destroy(0);
+  8031a7:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8031ae:	e8 8f d9 ff ff       	call   800b42 <sys_env_destroy>
+  8031b3:	83 c4 10             	add    $0x10,%esp
+  8031b6:	eb b9                	jmp    803171 <pgfault+0x45>
+
+008031b8 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8031b8:	55                   	push   %ebp
+  8031b9:	89 e5                	mov    %esp,%ebp
+  8031bb:	53                   	push   %ebx
+  8031bc:	83 ec 04             	sub    $0x4,%esp
+  8031bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8031c2:	a1 08 90 80 00       	mov    0x809008,%eax
+  8031c7:	3d 2c 31 80 00       	cmp    $0x80312c,%eax
+  8031cc:	74 15                	je     8031e3 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8031ce:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  8031d3:	83 ec 0c             	sub    $0xc,%esp
+  8031d6:	68 2c 31 80 00       	push   $0x80312c
+  8031db:	e8 fb 03 00 00       	call   8035db <set_pgfault_handler>
+  8031e0:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8031e3:	83 ec 0c             	sub    $0xc,%esp
+  8031e6:	68 05 08 00 00       	push   $0x805
+  8031eb:	53                   	push   %ebx
+  8031ec:	6a 00                	push   $0x0
+  8031ee:	53                   	push   %ebx
+  8031ef:	6a 00                	push   $0x0
+  8031f1:	e8 26 da ff ff       	call   800c1c <sys_page_map>
+}
+  8031f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031f9:	c9                   	leave
+  8031fa:	c3                   	ret
+
+008031fb <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8031fb:	55                   	push   %ebp
+  8031fc:	89 e5                	mov    %esp,%ebp
+  8031fe:	57                   	push   %edi
+  8031ff:	56                   	push   %esi
+  803200:	53                   	push   %ebx
+  803201:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  803204:	68 2c 31 80 00       	push   $0x80312c
+  803209:	e8 cd 03 00 00       	call   8035db <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80320e:	b8 07 00 00 00       	mov    $0x7,%eax
+  803213:	cd 30                	int    $0x30
+  803215:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803218:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  80321b:	83 c4 10             	add    $0x10,%esp
+  80321e:	85 c0                	test   %eax,%eax
+  803220:	0f 88 6b 01 00 00    	js     803391 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803226:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  80322b:	75 37                	jne    803264 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80322d:	e8 59 d9 ff ff       	call   800b8b <sys_getenvid>
+  803232:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803237:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80323d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803242:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  803247:	e9 45 01 00 00       	jmp    803391 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  80324c:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803252:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803258:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80325e:	0f 87 ba 00 00 00    	ja     80331e <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803264:	89 d8                	mov    %ebx,%eax
+  803266:	c1 e8 16             	shr    $0x16,%eax
+  803269:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803270:	a8 01                	test   $0x1,%al
+  803272:	74 d8                	je     80324c <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803274:	89 d8                	mov    %ebx,%eax
+  803276:	c1 e8 0c             	shr    $0xc,%eax
+  803279:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803280:	f6 c2 01             	test   $0x1,%dl
+  803283:	74 cd                	je     803252 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803285:	89 da                	mov    %ebx,%edx
+  803287:	80 e6 df             	and    $0xdf,%dh
+  80328a:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803290:	74 c0                	je     803252 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803292:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803294:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80329b:	f6 c6 04             	test   $0x4,%dh
+  80329e:	75 53                	jne    8032f3 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8032a0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8032a7:	f6 c6 08             	test   $0x8,%dh
+  8032aa:	75 0c                	jne    8032b8 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8032ac:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8032b3:	f6 c2 02             	test   $0x2,%dl
+  8032b6:	74 3b                	je     8032f3 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8032b8:	83 ec 0c             	sub    $0xc,%esp
+  8032bb:	68 05 08 00 00       	push   $0x805
+  8032c0:	57                   	push   %edi
+  8032c1:	ff 75 e4             	push   -0x1c(%ebp)
+  8032c4:	57                   	push   %edi
+  8032c5:	6a 00                	push   $0x0
+  8032c7:	e8 50 d9 ff ff       	call   800c1c <sys_page_map>
+  8032cc:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032ce:	83 c4 20             	add    $0x20,%esp
+  8032d1:	85 c0                	test   %eax,%eax
+  8032d3:	0f 88 a7 00 00 00    	js     803380 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8032d9:	83 ec 0c             	sub    $0xc,%esp
+  8032dc:	68 05 08 00 00       	push   $0x805
+  8032e1:	57                   	push   %edi
+  8032e2:	6a 00                	push   $0x0
+  8032e4:	57                   	push   %edi
+  8032e5:	6a 00                	push   $0x0
+  8032e7:	e8 30 d9 ff ff       	call   800c1c <sys_page_map>
+  8032ec:	89 c6                	mov    %eax,%esi
+	return r;
+  8032ee:	83 c4 20             	add    $0x20,%esp
+  8032f1:	eb 21                	jmp    803314 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8032f3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8032fa:	83 ec 0c             	sub    $0xc,%esp
+  8032fd:	25 07 0e 00 00       	and    $0xe07,%eax
+  803302:	50                   	push   %eax
+  803303:	57                   	push   %edi
+  803304:	ff 75 e4             	push   -0x1c(%ebp)
+  803307:	57                   	push   %edi
+  803308:	6a 00                	push   $0x0
+  80330a:	e8 0d d9 ff ff       	call   800c1c <sys_page_map>
+  80330f:	89 c6                	mov    %eax,%esi
+  803311:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  803314:	85 f6                	test   %esi,%esi
+  803316:	0f 89 36 ff ff ff    	jns    803252 <fork+0x57>
+  80331c:	eb 62                	jmp    803380 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80331e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803323:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  803328:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80332b:	89 f8                	mov    %edi,%eax
+  80332d:	e8 6f fd ff ff       	call   8030a1 <copy_page_to>
+  803332:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803334:	85 c0                	test   %eax,%eax
+  803336:	78 48                	js     803380 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803338:	83 ec 04             	sub    $0x4,%esp
+  80333b:	6a 07                	push   $0x7
+  80333d:	68 00 f0 bf ee       	push   $0xeebff000
+  803342:	57                   	push   %edi
+  803343:	e8 89 d8 ff ff       	call   800bd1 <sys_page_alloc>
+  803348:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80334a:	83 c4 10             	add    $0x10,%esp
+  80334d:	85 c0                	test   %eax,%eax
+  80334f:	78 2f                	js     803380 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803351:	a1 00 50 80 00       	mov    0x805000,%eax
+  803356:	8b 40 64             	mov    0x64(%eax),%eax
+  803359:	83 ec 08             	sub    $0x8,%esp
+  80335c:	50                   	push   %eax
+  80335d:	57                   	push   %edi
+  80335e:	e8 d9 d9 ff ff       	call   800d3c <sys_env_set_pgfault_upcall>
+  803363:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803365:	83 c4 10             	add    $0x10,%esp
+  803368:	85 c0                	test   %eax,%eax
+  80336a:	78 14                	js     803380 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80336c:	83 ec 08             	sub    $0x8,%esp
+  80336f:	6a 02                	push   $0x2
+  803371:	57                   	push   %edi
+  803372:	e8 31 d9 ff ff       	call   800ca8 <sys_env_set_status>
+  803377:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803379:	83 c4 10             	add    $0x10,%esp
+  80337c:	85 c0                	test   %eax,%eax
+  80337e:	79 11                	jns    803391 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803380:	83 ec 0c             	sub    $0xc,%esp
+  803383:	ff 75 e0             	push   -0x20(%ebp)
+  803386:	e8 b7 d7 ff ff       	call   800b42 <sys_env_destroy>
+	return r;
+  80338b:	83 c4 10             	add    $0x10,%esp
+  80338e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803391:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803394:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803397:	5b                   	pop    %ebx
+  803398:	5e                   	pop    %esi
+  803399:	5f                   	pop    %edi
+  80339a:	5d                   	pop    %ebp
+  80339b:	c3                   	ret
+
+0080339c <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80339c:	55                   	push   %ebp
+  80339d:	89 e5                	mov    %esp,%ebp
+  80339f:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8033a2:	68 9f 3e 80 00       	push   $0x803e9f
+  8033a7:	68 bf 00 00 00       	push   $0xbf
+  8033ac:	68 94 3e 80 00       	push   $0x803e94
+  8033b1:	e8 46 cd ff ff       	call   8000fc <_panic>
+
+008033b6 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8033b6:	55                   	push   %ebp
+  8033b7:	89 e5                	mov    %esp,%ebp
+  8033b9:	56                   	push   %esi
+  8033ba:	53                   	push   %ebx
+  8033bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033be:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8033c4:	85 c0                	test   %eax,%eax
+  8033c6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8033cb:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8033ce:	83 ec 0c             	sub    $0xc,%esp
+  8033d1:	50                   	push   %eax
+  8033d2:	e8 42 da ff ff       	call   800e19 <sys_ipc_recv>
+	if (from_env_store)
+  8033d7:	83 c4 10             	add    $0x10,%esp
+  8033da:	85 f6                	test   %esi,%esi
+  8033dc:	74 14                	je     8033f2 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8033de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033e3:	85 c0                	test   %eax,%eax
+  8033e5:	75 09                	jne    8033f0 <ipc_recv+0x3a>
+  8033e7:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8033ed:	8b 52 74             	mov    0x74(%edx),%edx
+  8033f0:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8033f2:	85 db                	test   %ebx,%ebx
+  8033f4:	74 25                	je     80341b <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033f6:	85 c0                	test   %eax,%eax
+  8033f8:	74 0d                	je     803407 <ipc_recv+0x51>
+  8033fa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803400:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803403:	5b                   	pop    %ebx
+  803404:	5e                   	pop    %esi
+  803405:	5d                   	pop    %ebp
+  803406:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803407:	a1 00 50 80 00       	mov    0x805000,%eax
+  80340c:	8b 40 78             	mov    0x78(%eax),%eax
+  80340f:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803411:	a1 00 50 80 00       	mov    0x805000,%eax
+  803416:	8b 40 70             	mov    0x70(%eax),%eax
+  803419:	eb e5                	jmp    803400 <ipc_recv+0x4a>
+  80341b:	85 c0                	test   %eax,%eax
+  80341d:	75 e1                	jne    803400 <ipc_recv+0x4a>
+  80341f:	eb f0                	jmp    803411 <ipc_recv+0x5b>
+
+00803421 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803421:	55                   	push   %ebp
+  803422:	89 e5                	mov    %esp,%ebp
+  803424:	57                   	push   %edi
+  803425:	56                   	push   %esi
+  803426:	53                   	push   %ebx
+  803427:	83 ec 0c             	sub    $0xc,%esp
+  80342a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80342d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803430:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803433:	85 db                	test   %ebx,%ebx
+  803435:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80343a:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80343d:	ff 75 14             	push   0x14(%ebp)
+  803440:	53                   	push   %ebx
+  803441:	56                   	push   %esi
+  803442:	57                   	push   %edi
+  803443:	e8 3e d9 ff ff       	call   800d86 <sys_ipc_try_send>
+  803448:	83 c4 10             	add    $0x10,%esp
+  80344b:	85 c0                	test   %eax,%eax
+  80344d:	74 22                	je     803471 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  80344f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803452:	75 07                	jne    80345b <ipc_send+0x3a>
+		sys_yield();
+  803454:	e8 59 d7 ff ff       	call   800bb2 <sys_yield>
+  803459:	eb e2                	jmp    80343d <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80345b:	68 b5 3e 80 00       	push   $0x803eb5
+  803460:	68 60 3d 80 00       	push   $0x803d60
+  803465:	6a 39                	push   $0x39
+  803467:	68 ca 3e 80 00       	push   $0x803eca
+  80346c:	e8 8b cc ff ff       	call   8000fc <_panic>
+	}
+}
+  803471:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803474:	5b                   	pop    %ebx
+  803475:	5e                   	pop    %esi
+  803476:	5f                   	pop    %edi
+  803477:	5d                   	pop    %ebp
+  803478:	c3                   	ret
+
+00803479 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803479:	55                   	push   %ebp
+  80347a:	89 e5                	mov    %esp,%ebp
+  80347c:	57                   	push   %edi
+  80347d:	56                   	push   %esi
+  80347e:	53                   	push   %ebx
+  80347f:	83 ec 10             	sub    $0x10,%esp
+  803482:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803485:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803488:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80348b:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80348e:	85 c0                	test   %eax,%eax
+  803490:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803495:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803498:	6a 00                	push   $0x0
+  80349a:	ff 33                	push   (%ebx)
+  80349c:	50                   	push   %eax
+  80349d:	e8 34 d9 ff ff       	call   800dd6 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8034a2:	83 c4 10             	add    $0x10,%esp
+  8034a5:	85 c0                	test   %eax,%eax
+  8034a7:	75 3c                	jne    8034e5 <ipc_recvv+0x6c>
+  8034a9:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8034af:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8034b2:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8034b4:	85 ff                	test   %edi,%edi
+  8034b6:	74 4e                	je     803506 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8034b8:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8034be:	8b 52 74             	mov    0x74(%edx),%edx
+  8034c1:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8034c3:	85 f6                	test   %esi,%esi
+  8034c5:	74 18                	je     8034df <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8034c7:	85 c0                	test   %eax,%eax
+  8034c9:	75 2d                	jne    8034f8 <ipc_recvv+0x7f>
+  8034cb:	a1 00 50 80 00       	mov    0x805000,%eax
+  8034d0:	8b 40 78             	mov    0x78(%eax),%eax
+  8034d3:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8034d5:	a1 00 50 80 00       	mov    0x805000,%eax
+  8034da:	8b 40 70             	mov    0x70(%eax),%eax
+  8034dd:	eb 1f                	jmp    8034fe <ipc_recvv+0x85>
+  8034df:	85 c0                	test   %eax,%eax
+  8034e1:	75 1b                	jne    8034fe <ipc_recvv+0x85>
+  8034e3:	eb f0                	jmp    8034d5 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8034e5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8034eb:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8034f0:	85 ff                	test   %edi,%edi
+  8034f2:	75 cd                	jne    8034c1 <ipc_recvv+0x48>
+	if (perm_store)
+  8034f4:	85 f6                	test   %esi,%esi
+  8034f6:	74 e7                	je     8034df <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8034f8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8034fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803501:	5b                   	pop    %ebx
+  803502:	5e                   	pop    %esi
+  803503:	5f                   	pop    %edi
+  803504:	5d                   	pop    %ebp
+  803505:	c3                   	ret
+	if (perm_store)
+  803506:	85 f6                	test   %esi,%esi
+  803508:	75 bd                	jne    8034c7 <ipc_recvv+0x4e>
+  80350a:	eb c9                	jmp    8034d5 <ipc_recvv+0x5c>
+
+0080350c <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  80350c:	55                   	push   %ebp
+  80350d:	89 e5                	mov    %esp,%ebp
+  80350f:	57                   	push   %edi
+  803510:	56                   	push   %esi
+  803511:	53                   	push   %ebx
+  803512:	83 ec 0c             	sub    $0xc,%esp
+  803515:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803518:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80351b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  80351e:	ff 75 14             	push   0x14(%ebp)
+  803521:	53                   	push   %ebx
+  803522:	56                   	push   %esi
+  803523:	57                   	push   %edi
+  803524:	e8 85 d8 ff ff       	call   800dae <sys_ipc_try_sendv>
+  803529:	83 c4 10             	add    $0x10,%esp
+  80352c:	85 c0                	test   %eax,%eax
+  80352e:	74 22                	je     803552 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803530:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803533:	75 07                	jne    80353c <ipc_sendv+0x30>
+		sys_yield();
+  803535:	e8 78 d6 ff ff       	call   800bb2 <sys_yield>
+  80353a:	eb e2                	jmp    80351e <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80353c:	68 b5 3e 80 00       	push   $0x803eb5
+  803541:	68 60 3d 80 00       	push   $0x803d60
+  803546:	6a 5c                	push   $0x5c
+  803548:	68 ca 3e 80 00       	push   $0x803eca
+  80354d:	e8 aa cb ff ff       	call   8000fc <_panic>
+	}
+}
+  803552:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803555:	5b                   	pop    %ebx
+  803556:	5e                   	pop    %esi
+  803557:	5f                   	pop    %edi
+  803558:	5d                   	pop    %ebp
+  803559:	c3                   	ret
+
+0080355a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80355a:	55                   	push   %ebp
+  80355b:	89 e5                	mov    %esp,%ebp
+  80355d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803560:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803565:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80356b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803571:	8b 52 50             	mov    0x50(%edx),%edx
+  803574:	39 ca                	cmp    %ecx,%edx
+  803576:	74 11                	je     803589 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803578:	83 c0 01             	add    $0x1,%eax
+  80357b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803580:	75 e3                	jne    803565 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803582:	b8 00 00 00 00       	mov    $0x0,%eax
+  803587:	eb 0e                	jmp    803597 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803589:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80358f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803594:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803597:	5d                   	pop    %ebp
+  803598:	c3                   	ret
+
+00803599 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803599:	55                   	push   %ebp
+  80359a:	89 e5                	mov    %esp,%ebp
+  80359c:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80359f:	89 c2                	mov    %eax,%edx
+  8035a1:	c1 ea 16             	shr    $0x16,%edx
+  8035a4:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8035ab:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8035b0:	f6 c1 01             	test   $0x1,%cl
+  8035b3:	74 22                	je     8035d7 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8035b5:	c1 e8 0c             	shr    $0xc,%eax
+  8035b8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8035bf:	a8 01                	test   $0x1,%al
+  8035c1:	74 14                	je     8035d7 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8035c3:	c1 e8 0c             	shr    $0xc,%eax
+  8035c6:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8035c9:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8035d0:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8035d4:	0f b7 d2             	movzwl %dx,%edx
+}
+  8035d7:	89 d0                	mov    %edx,%eax
+  8035d9:	5d                   	pop    %ebp
+  8035da:	c3                   	ret
+
+008035db <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8035db:	55                   	push   %ebp
+  8035dc:	89 e5                	mov    %esp,%ebp
+  8035de:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8035e1:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  8035e8:	74 0a                	je     8035f4 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8035ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035ed:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  8035f2:	c9                   	leave
+  8035f3:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8035f4:	83 ec 04             	sub    $0x4,%esp
+  8035f7:	6a 07                	push   $0x7
+  8035f9:	68 00 f0 bf ee       	push   $0xeebff000
+  8035fe:	6a 00                	push   $0x0
+  803600:	e8 cc d5 ff ff       	call   800bd1 <sys_page_alloc>
+  803605:	83 c4 10             	add    $0x10,%esp
+  803608:	85 c0                	test   %eax,%eax
+  80360a:	75 2c                	jne    803638 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80360c:	83 ec 08             	sub    $0x8,%esp
+  80360f:	68 4e 36 80 00       	push   $0x80364e
+  803614:	6a 00                	push   $0x0
+  803616:	e8 21 d7 ff ff       	call   800d3c <sys_env_set_pgfault_upcall>
+  80361b:	83 c4 10             	add    $0x10,%esp
+  80361e:	85 c0                	test   %eax,%eax
+  803620:	74 c8                	je     8035ea <set_pgfault_handler+0xf>
+  803622:	68 1c 3f 80 00       	push   $0x803f1c
+  803627:	68 60 3d 80 00       	push   $0x803d60
+  80362c:	6a 20                	push   $0x20
+  80362e:	68 4c 3f 80 00       	push   $0x803f4c
+  803633:	e8 c4 ca ff ff       	call   8000fc <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803638:	68 d4 3e 80 00       	push   $0x803ed4
+  80363d:	68 60 3d 80 00       	push   $0x803d60
+  803642:	6a 1e                	push   $0x1e
+  803644:	68 4c 3f 80 00       	push   $0x803f4c
+  803649:	e8 ae ca ff ff       	call   8000fc <_panic>
+
+0080364e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80364e:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80364f:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  803654:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803656:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803659:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  80365e:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803663:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803667:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80366a:	83 c4 08             	add    $0x8,%esp
+	popal
+  80366d:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  80366e:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803671:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803672:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803673:	c3                   	ret
+
+00803674 <dm>:
+  803674:	55                   	push   %ebp
+  803675:	57                   	push   %edi
+  803676:	56                   	push   %esi
+  803677:	53                   	push   %ebx
+  803678:	83 ec 24             	sub    $0x24,%esp
+  80367b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80367f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803683:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803687:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80368b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80368f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803693:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803697:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80369c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036a6:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8036ad:	00 
+  8036ae:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8036b5:	00 
+  8036b6:	89 fb                	mov    %edi,%ebx
+  8036b8:	eb 08                	jmp    8036c2 <dm+0x4e>
+  8036ba:	83 e9 01             	sub    $0x1,%ecx
+  8036bd:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8036c0:	74 68                	je     80372a <dm+0xb6>
+  8036c2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8036c6:	01 c0                	add    %eax,%eax
+  8036c8:	89 c6                	mov    %eax,%esi
+  8036ca:	89 d7                	mov    %edx,%edi
+  8036cc:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036d0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036d4:	0f ad d0             	shrd   %cl,%edx,%eax
+  8036d7:	d3 ea                	shr    %cl,%edx
+  8036d9:	f6 c1 20             	test   $0x20,%cl
+  8036dc:	74 04                	je     8036e2 <dm+0x6e>
+  8036de:	89 d0                	mov    %edx,%eax
+  8036e0:	31 d2                	xor    %edx,%edx
+  8036e2:	83 e0 01             	and    $0x1,%eax
+  8036e5:	89 04 24             	mov    %eax,(%esp)
+  8036e8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8036ef:	00 
+  8036f0:	8b 04 24             	mov    (%esp),%eax
+  8036f3:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8036f7:	09 f0                	or     %esi,%eax
+  8036f9:	09 fa                	or     %edi,%edx
+  8036fb:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8036ff:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803703:	39 f0                	cmp    %esi,%eax
+  803705:	89 d5                	mov    %edx,%ebp
+  803707:	19 fd                	sbb    %edi,%ebp
+  803709:	72 af                	jb     8036ba <dm+0x46>
+  80370b:	29 f0                	sub    %esi,%eax
+  80370d:	19 fa                	sbb    %edi,%edx
+  80370f:	89 cf                	mov    %ecx,%edi
+  803711:	c1 ef 05             	shr    $0x5,%edi
+  803714:	83 e7 01             	and    $0x1,%edi
+  803717:	89 fe                	mov    %edi,%esi
+  803719:	83 f6 01             	xor    $0x1,%esi
+  80371c:	d3 e6                	shl    %cl,%esi
+  80371e:	d3 e7                	shl    %cl,%edi
+  803720:	09 74 24 18          	or     %esi,0x18(%esp)
+  803724:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803728:	eb 90                	jmp    8036ba <dm+0x46>
+  80372a:	85 db                	test   %ebx,%ebx
+  80372c:	74 05                	je     803733 <dm+0xbf>
+  80372e:	89 03                	mov    %eax,(%ebx)
+  803730:	89 53 04             	mov    %edx,0x4(%ebx)
+  803733:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803737:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80373b:	83 c4 24             	add    $0x24,%esp
+  80373e:	5b                   	pop    %ebx
+  80373f:	5e                   	pop    %esi
+  803740:	5f                   	pop    %edi
+  803741:	5d                   	pop    %ebp
+  803742:	c3                   	ret
+
+00803743 <__udivdi3>:
+  803743:	83 ec 08             	sub    $0x8,%esp
+  803746:	6a 00                	push   $0x0
+  803748:	ff 74 24 1c          	push   0x1c(%esp)
+  80374c:	ff 74 24 1c          	push   0x1c(%esp)
+  803750:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803754:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803758:	e8 17 ff ff ff       	call   803674 <dm>
+  80375d:	83 c4 14             	add    $0x14,%esp
+  803760:	c3                   	ret
+
+00803761 <__umoddi3>:
+  803761:	83 ec 18             	sub    $0x18,%esp
+  803764:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803768:	50                   	push   %eax
+  803769:	ff 74 24 2c          	push   0x2c(%esp)
+  80376d:	ff 74 24 2c          	push   0x2c(%esp)
+  803771:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803775:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803779:	e8 f6 fe ff ff       	call   803674 <dm>
+  80377e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803782:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803786:	83 c4 24             	add    $0x24,%esp
+  803789:	c3                   	ret
+
+0080378a <__divdi3>:
+  80378a:	53                   	push   %ebx
+  80378b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80378f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803793:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803797:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80379b:	85 d2                	test   %edx,%edx
+  80379d:	78 15                	js     8037b4 <__divdi3+0x2a>
+  80379f:	85 db                	test   %ebx,%ebx
+  8037a1:	78 34                	js     8037d7 <__divdi3+0x4d>
+  8037a3:	83 ec 04             	sub    $0x4,%esp
+  8037a6:	6a 00                	push   $0x0
+  8037a8:	53                   	push   %ebx
+  8037a9:	51                   	push   %ecx
+  8037aa:	e8 c5 fe ff ff       	call   803674 <dm>
+  8037af:	83 c4 10             	add    $0x10,%esp
+  8037b2:	eb 21                	jmp    8037d5 <__divdi3+0x4b>
+  8037b4:	f7 d8                	neg    %eax
+  8037b6:	83 d2 00             	adc    $0x0,%edx
+  8037b9:	f7 da                	neg    %edx
+  8037bb:	85 db                	test   %ebx,%ebx
+  8037bd:	78 30                	js     8037ef <__divdi3+0x65>
+  8037bf:	83 ec 04             	sub    $0x4,%esp
+  8037c2:	6a 00                	push   $0x0
+  8037c4:	53                   	push   %ebx
+  8037c5:	51                   	push   %ecx
+  8037c6:	e8 a9 fe ff ff       	call   803674 <dm>
+  8037cb:	83 c4 10             	add    $0x10,%esp
+  8037ce:	f7 d8                	neg    %eax
+  8037d0:	83 d2 00             	adc    $0x0,%edx
+  8037d3:	f7 da                	neg    %edx
+  8037d5:	5b                   	pop    %ebx
+  8037d6:	c3                   	ret
+  8037d7:	83 ec 04             	sub    $0x4,%esp
+  8037da:	6a 00                	push   $0x0
+  8037dc:	f7 d9                	neg    %ecx
+  8037de:	83 d3 00             	adc    $0x0,%ebx
+  8037e1:	f7 db                	neg    %ebx
+  8037e3:	53                   	push   %ebx
+  8037e4:	51                   	push   %ecx
+  8037e5:	e8 8a fe ff ff       	call   803674 <dm>
+  8037ea:	83 c4 10             	add    $0x10,%esp
+  8037ed:	eb df                	jmp    8037ce <__divdi3+0x44>
+  8037ef:	83 ec 04             	sub    $0x4,%esp
+  8037f2:	6a 00                	push   $0x0
+  8037f4:	f7 d9                	neg    %ecx
+  8037f6:	83 d3 00             	adc    $0x0,%ebx
+  8037f9:	f7 db                	neg    %ebx
+  8037fb:	53                   	push   %ebx
+  8037fc:	51                   	push   %ecx
+  8037fd:	e8 72 fe ff ff       	call   803674 <dm>
+  803802:	83 c4 10             	add    $0x10,%esp
+  803805:	eb ce                	jmp    8037d5 <__divdi3+0x4b>
+
+00803807 <__moddi3>:
+  803807:	55                   	push   %ebp
+  803808:	57                   	push   %edi
+  803809:	56                   	push   %esi
+  80380a:	53                   	push   %ebx
+  80380b:	83 ec 24             	sub    $0x24,%esp
+  80380e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803812:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803816:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80381a:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80381e:	85 d2                	test   %edx,%edx
+  803820:	78 3b                	js     80385d <__moddi3+0x56>
+  803822:	83 ec 04             	sub    $0x4,%esp
+  803825:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803829:	56                   	push   %esi
+  80382a:	89 ce                	mov    %ecx,%esi
+  80382c:	f7 de                	neg    %esi
+  80382e:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803832:	89 de                	mov    %ebx,%esi
+  803834:	83 d6 00             	adc    $0x0,%esi
+  803837:	f7 de                	neg    %esi
+  803839:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80383d:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803841:	0f 48 f1             	cmovs  %ecx,%esi
+  803844:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803849:	53                   	push   %ebx
+  80384a:	56                   	push   %esi
+  80384b:	e8 24 fe ff ff       	call   803674 <dm>
+  803850:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803854:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803858:	83 c4 10             	add    $0x10,%esp
+  80385b:	eb 47                	jmp    8038a4 <__moddi3+0x9d>
+  80385d:	f7 d8                	neg    %eax
+  80385f:	83 d2 00             	adc    $0x0,%edx
+  803862:	f7 da                	neg    %edx
+  803864:	83 ec 04             	sub    $0x4,%esp
+  803867:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80386b:	56                   	push   %esi
+  80386c:	89 cf                	mov    %ecx,%edi
+  80386e:	f7 df                	neg    %edi
+  803870:	89 de                	mov    %ebx,%esi
+  803872:	83 d6 00             	adc    $0x0,%esi
+  803875:	f7 de                	neg    %esi
+  803877:	0f 49 cf             	cmovns %edi,%ecx
+  80387a:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80387e:	0f 49 de             	cmovns %esi,%ebx
+  803881:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803885:	ff 74 24 0c          	push   0xc(%esp)
+  803889:	ff 74 24 0c          	push   0xc(%esp)
+  80388d:	e8 e2 fd ff ff       	call   803674 <dm>
+  803892:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803896:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80389a:	f7 d8                	neg    %eax
+  80389c:	83 d2 00             	adc    $0x0,%edx
+  80389f:	f7 da                	neg    %edx
+  8038a1:	83 c4 10             	add    $0x10,%esp
+  8038a4:	83 c4 24             	add    $0x24,%esp
+  8038a7:	5b                   	pop    %ebx
+  8038a8:	5e                   	pop    %esi
+  8038a9:	5f                   	pop    %edi
+  8038aa:	5d                   	pop    %ebp
+  8038ab:	c3                   	ret
@@ -0,0 +1,7620 @@
+
+obj/user/breakpoint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 04 00 00 00       	call   800035 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $3");
+  800033:	cc                   	int3
+}
+  800034:	c3                   	ret
+
+00800035 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800040:	e8 e9 00 00 00       	call   80012e <sys_getenvid>
+  800045:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004a:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800050:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800055:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80005a:	85 db                	test   %ebx,%ebx
+  80005c:	7e 07                	jle    800065 <libmain+0x30>
+		binaryname = argv[0];
+  80005e:	8b 06                	mov    (%esi),%eax
+  800060:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800065:	83 ec 08             	sub    $0x8,%esp
+  800068:	56                   	push   %esi
+  800069:	53                   	push   %ebx
+  80006a:	e8 c4 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80006f:	e8 0a 00 00 00       	call   80007e <exit>
+}
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007a:	5b                   	pop    %ebx
+  80007b:	5e                   	pop    %esi
+  80007c:	5d                   	pop    %ebp
+  80007d:	c3                   	ret
+
+0080007e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80007e:	55                   	push   %ebp
+  80007f:	89 e5                	mov    %esp,%ebp
+  800081:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800084:	e8 c0 06 00 00       	call   800749 <close_all>
+	sys_env_destroy(0);
+  800089:	83 ec 0c             	sub    $0xc,%esp
+  80008c:	6a 00                	push   $0x0
+  80008e:	e8 52 00 00 00       	call   8000e5 <sys_env_destroy>
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	c9                   	leave
+  800097:	c3                   	ret
+
+00800098 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800098:	55                   	push   %ebp
+  800099:	89 e5                	mov    %esp,%ebp
+  80009b:	57                   	push   %edi
+  80009c:	56                   	push   %esi
+  80009d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80009e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000a9:	89 c3                	mov    %eax,%ebx
+  8000ab:	89 c7                	mov    %eax,%edi
+  8000ad:	55                   	push   %ebp
+  8000ae:	89 e5                	mov    %esp,%ebp
+  8000b0:	8d 35 b8 00 80 00    	lea    0x8000b8,%esi
+  8000b6:	0f 34                	sysenter
+  8000b8:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  8000b9:	5b                   	pop    %ebx
+  8000ba:	5e                   	pop    %esi
+  8000bb:	5f                   	pop    %edi
+  8000bc:	5d                   	pop    %ebp
+  8000bd:	c3                   	ret
+
+008000be <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000be:	55                   	push   %ebp
+  8000bf:	89 e5                	mov    %esp,%ebp
+  8000c1:	57                   	push   %edi
+  8000c2:	56                   	push   %esi
+  8000c3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000ce:	89 d1                	mov    %edx,%ecx
+  8000d0:	89 d3                	mov    %edx,%ebx
+  8000d2:	89 d7                	mov    %edx,%edi
+  8000d4:	55                   	push   %ebp
+  8000d5:	89 e5                	mov    %esp,%ebp
+  8000d7:	8d 35 df 00 80 00    	lea    0x8000df,%esi
+  8000dd:	0f 34                	sysenter
+  8000df:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  8000e0:	5b                   	pop    %ebx
+  8000e1:	5e                   	pop    %esi
+  8000e2:	5f                   	pop    %edi
+  8000e3:	5d                   	pop    %ebp
+  8000e4:	c3                   	ret
+
+008000e5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000e5:	55                   	push   %ebp
+  8000e6:	89 e5                	mov    %esp,%ebp
+  8000e8:	57                   	push   %edi
+  8000e9:	56                   	push   %esi
+  8000ea:	53                   	push   %ebx
+  8000eb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8000ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000fb:	89 cb                	mov    %ecx,%ebx
+  8000fd:	89 cf                	mov    %ecx,%edi
+  8000ff:	55                   	push   %ebp
+  800100:	89 e5                	mov    %esp,%ebp
+  800102:	8d 35 0a 01 80 00    	lea    0x80010a,%esi
+  800108:	0f 34                	sysenter
+  80010a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80010b:	85 c0                	test   %eax,%eax
+  80010d:	7f 08                	jg     800117 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  80010f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800112:	5b                   	pop    %ebx
+  800113:	5e                   	pop    %esi
+  800114:	5f                   	pop    %edi
+  800115:	5d                   	pop    %ebp
+  800116:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800117:	83 ec 0c             	sub    $0xc,%esp
+  80011a:	50                   	push   %eax
+  80011b:	6a 03                	push   $0x3
+  80011d:	68 4a 37 80 00       	push   $0x80374a
+  800122:	6a 3d                	push   $0x3d
+  800124:	68 67 37 80 00       	push   $0x803767
+  800129:	e8 02 24 00 00       	call   802530 <_panic>
+
+0080012e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80012e:	55                   	push   %ebp
+  80012f:	89 e5                	mov    %esp,%ebp
+  800131:	57                   	push   %edi
+  800132:	56                   	push   %esi
+  800133:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800134:	ba 00 00 00 00       	mov    $0x0,%edx
+  800139:	b8 02 00 00 00       	mov    $0x2,%eax
+  80013e:	89 d1                	mov    %edx,%ecx
+  800140:	89 d3                	mov    %edx,%ebx
+  800142:	89 d7                	mov    %edx,%edi
+  800144:	55                   	push   %ebp
+  800145:	89 e5                	mov    %esp,%ebp
+  800147:	8d 35 4f 01 80 00    	lea    0x80014f,%esi
+  80014d:	0f 34                	sysenter
+  80014f:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800150:	5b                   	pop    %ebx
+  800151:	5e                   	pop    %esi
+  800152:	5f                   	pop    %edi
+  800153:	5d                   	pop    %ebp
+  800154:	c3                   	ret
+
+00800155 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800155:	55                   	push   %ebp
+  800156:	89 e5                	mov    %esp,%ebp
+  800158:	57                   	push   %edi
+  800159:	56                   	push   %esi
+  80015a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80015b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800160:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800165:	89 d1                	mov    %edx,%ecx
+  800167:	89 d3                	mov    %edx,%ebx
+  800169:	89 d7                	mov    %edx,%edi
+  80016b:	89 d6                	mov    %edx,%esi
+  80016d:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80016f:	5b                   	pop    %ebx
+  800170:	5e                   	pop    %esi
+  800171:	5f                   	pop    %edi
+  800172:	5d                   	pop    %ebp
+  800173:	c3                   	ret
+
+00800174 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800174:	55                   	push   %ebp
+  800175:	89 e5                	mov    %esp,%ebp
+  800177:	57                   	push   %edi
+  800178:	56                   	push   %esi
+  800179:	53                   	push   %ebx
+  80017a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80017d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800180:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800183:	b8 04 00 00 00       	mov    $0x4,%eax
+  800188:	bf 00 00 00 00       	mov    $0x0,%edi
+  80018d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800190:	55                   	push   %ebp
+  800191:	89 e5                	mov    %esp,%ebp
+  800193:	8d 35 9b 01 80 00    	lea    0x80019b,%esi
+  800199:	0f 34                	sysenter
+  80019b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80019c:	85 c0                	test   %eax,%eax
+  80019e:	7f 08                	jg     8001a8 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  8001a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a3:	5b                   	pop    %ebx
+  8001a4:	5e                   	pop    %esi
+  8001a5:	5f                   	pop    %edi
+  8001a6:	5d                   	pop    %ebp
+  8001a7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001a8:	83 ec 0c             	sub    $0xc,%esp
+  8001ab:	50                   	push   %eax
+  8001ac:	6a 04                	push   $0x4
+  8001ae:	68 4a 37 80 00       	push   $0x80374a
+  8001b3:	6a 3d                	push   $0x3d
+  8001b5:	68 67 37 80 00       	push   $0x803767
+  8001ba:	e8 71 23 00 00       	call   802530 <_panic>
+
+008001bf <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001bf:	55                   	push   %ebp
+  8001c0:	89 e5                	mov    %esp,%ebp
+  8001c2:	57                   	push   %edi
+  8001c3:	56                   	push   %esi
+  8001c4:	53                   	push   %ebx
+  8001c5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ce:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001d6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001d9:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001dc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001de:	85 c0                	test   %eax,%eax
+  8001e0:	7f 08                	jg     8001ea <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001e5:	5b                   	pop    %ebx
+  8001e6:	5e                   	pop    %esi
+  8001e7:	5f                   	pop    %edi
+  8001e8:	5d                   	pop    %ebp
+  8001e9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001ea:	83 ec 0c             	sub    $0xc,%esp
+  8001ed:	50                   	push   %eax
+  8001ee:	6a 05                	push   $0x5
+  8001f0:	68 4a 37 80 00       	push   $0x80374a
+  8001f5:	6a 23                	push   $0x23
+  8001f7:	68 67 37 80 00       	push   $0x803767
+  8001fc:	e8 2f 23 00 00       	call   802530 <_panic>
+
+00800201 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800201:	55                   	push   %ebp
+  800202:	89 e5                	mov    %esp,%ebp
+  800204:	57                   	push   %edi
+  800205:	56                   	push   %esi
+  800206:	53                   	push   %ebx
+  800207:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80020a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80020f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800212:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800215:	b8 06 00 00 00       	mov    $0x6,%eax
+  80021a:	89 df                	mov    %ebx,%edi
+  80021c:	55                   	push   %ebp
+  80021d:	89 e5                	mov    %esp,%ebp
+  80021f:	8d 35 27 02 80 00    	lea    0x800227,%esi
+  800225:	0f 34                	sysenter
+  800227:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800228:	85 c0                	test   %eax,%eax
+  80022a:	7f 08                	jg     800234 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  80022c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80022f:	5b                   	pop    %ebx
+  800230:	5e                   	pop    %esi
+  800231:	5f                   	pop    %edi
+  800232:	5d                   	pop    %ebp
+  800233:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800234:	83 ec 0c             	sub    $0xc,%esp
+  800237:	50                   	push   %eax
+  800238:	6a 06                	push   $0x6
+  80023a:	68 4a 37 80 00       	push   $0x80374a
+  80023f:	6a 3d                	push   $0x3d
+  800241:	68 67 37 80 00       	push   $0x803767
+  800246:	e8 e5 22 00 00       	call   802530 <_panic>
+
+0080024b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80024b:	55                   	push   %ebp
+  80024c:	89 e5                	mov    %esp,%ebp
+  80024e:	57                   	push   %edi
+  80024f:	56                   	push   %esi
+  800250:	53                   	push   %ebx
+  800251:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800254:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800259:	8b 55 08             	mov    0x8(%ebp),%edx
+  80025c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80025f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800264:	89 df                	mov    %ebx,%edi
+  800266:	55                   	push   %ebp
+  800267:	89 e5                	mov    %esp,%ebp
+  800269:	8d 35 71 02 80 00    	lea    0x800271,%esi
+  80026f:	0f 34                	sysenter
+  800271:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800272:	85 c0                	test   %eax,%eax
+  800274:	7f 08                	jg     80027e <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800276:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800279:	5b                   	pop    %ebx
+  80027a:	5e                   	pop    %esi
+  80027b:	5f                   	pop    %edi
+  80027c:	5d                   	pop    %ebp
+  80027d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80027e:	83 ec 0c             	sub    $0xc,%esp
+  800281:	50                   	push   %eax
+  800282:	6a 08                	push   $0x8
+  800284:	68 4a 37 80 00       	push   $0x80374a
+  800289:	6a 3d                	push   $0x3d
+  80028b:	68 67 37 80 00       	push   $0x803767
+  800290:	e8 9b 22 00 00       	call   802530 <_panic>
+
+00800295 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800295:	55                   	push   %ebp
+  800296:	89 e5                	mov    %esp,%ebp
+  800298:	57                   	push   %edi
+  800299:	56                   	push   %esi
+  80029a:	53                   	push   %ebx
+  80029b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80029e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002a9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002ae:	89 df                	mov    %ebx,%edi
+  8002b0:	55                   	push   %ebp
+  8002b1:	89 e5                	mov    %esp,%ebp
+  8002b3:	8d 35 bb 02 80 00    	lea    0x8002bb,%esi
+  8002b9:	0f 34                	sysenter
+  8002bb:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8002bc:	85 c0                	test   %eax,%eax
+  8002be:	7f 08                	jg     8002c8 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  8002c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c3:	5b                   	pop    %ebx
+  8002c4:	5e                   	pop    %esi
+  8002c5:	5f                   	pop    %edi
+  8002c6:	5d                   	pop    %ebp
+  8002c7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002c8:	83 ec 0c             	sub    $0xc,%esp
+  8002cb:	50                   	push   %eax
+  8002cc:	6a 09                	push   $0x9
+  8002ce:	68 4a 37 80 00       	push   $0x80374a
+  8002d3:	6a 3d                	push   $0x3d
+  8002d5:	68 67 37 80 00       	push   $0x803767
+  8002da:	e8 51 22 00 00       	call   802530 <_panic>
+
+008002df <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002df:	55                   	push   %ebp
+  8002e0:	89 e5                	mov    %esp,%ebp
+  8002e2:	57                   	push   %edi
+  8002e3:	56                   	push   %esi
+  8002e4:	53                   	push   %ebx
+  8002e5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8002e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002f8:	89 df                	mov    %ebx,%edi
+  8002fa:	55                   	push   %ebp
+  8002fb:	89 e5                	mov    %esp,%ebp
+  8002fd:	8d 35 05 03 80 00    	lea    0x800305,%esi
+  800303:	0f 34                	sysenter
+  800305:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800306:	85 c0                	test   %eax,%eax
+  800308:	7f 08                	jg     800312 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  80030a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030d:	5b                   	pop    %ebx
+  80030e:	5e                   	pop    %esi
+  80030f:	5f                   	pop    %edi
+  800310:	5d                   	pop    %ebp
+  800311:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800312:	83 ec 0c             	sub    $0xc,%esp
+  800315:	50                   	push   %eax
+  800316:	6a 0a                	push   $0xa
+  800318:	68 4a 37 80 00       	push   $0x80374a
+  80031d:	6a 3d                	push   $0x3d
+  80031f:	68 67 37 80 00       	push   $0x803767
+  800324:	e8 07 22 00 00       	call   802530 <_panic>
+
+00800329 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800329:	55                   	push   %ebp
+  80032a:	89 e5                	mov    %esp,%ebp
+  80032c:	57                   	push   %edi
+  80032d:	56                   	push   %esi
+  80032e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80032f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800332:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800335:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80033a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80033d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800340:	55                   	push   %ebp
+  800341:	89 e5                	mov    %esp,%ebp
+  800343:	8d 35 4b 03 80 00    	lea    0x80034b,%esi
+  800349:	0f 34                	sysenter
+  80034b:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  80034c:	5b                   	pop    %ebx
+  80034d:	5e                   	pop    %esi
+  80034e:	5f                   	pop    %edi
+  80034f:	5d                   	pop    %ebp
+  800350:	c3                   	ret
+
+00800351 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800351:	55                   	push   %ebp
+  800352:	89 e5                	mov    %esp,%ebp
+  800354:	57                   	push   %edi
+  800355:	56                   	push   %esi
+  800356:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800357:	8b 55 08             	mov    0x8(%ebp),%edx
+  80035a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80035d:	b8 17 00 00 00       	mov    $0x17,%eax
+  800362:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800365:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800368:	55                   	push   %ebp
+  800369:	89 e5                	mov    %esp,%ebp
+  80036b:	8d 35 73 03 80 00    	lea    0x800373,%esi
+  800371:	0f 34                	sysenter
+  800373:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800374:	5b                   	pop    %ebx
+  800375:	5e                   	pop    %esi
+  800376:	5f                   	pop    %edi
+  800377:	5d                   	pop    %ebp
+  800378:	c3                   	ret
+
+00800379 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800379:	55                   	push   %ebp
+  80037a:	89 e5                	mov    %esp,%ebp
+  80037c:	57                   	push   %edi
+  80037d:	56                   	push   %esi
+  80037e:	53                   	push   %ebx
+  80037f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800382:	be 00 00 00 00       	mov    $0x0,%esi
+  800387:	8b 55 08             	mov    0x8(%ebp),%edx
+  80038a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80038d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800392:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800395:	89 f7                	mov    %esi,%edi
+  800397:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800399:	85 c0                	test   %eax,%eax
+  80039b:	7f 08                	jg     8003a5 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  80039d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a0:	5b                   	pop    %ebx
+  8003a1:	5e                   	pop    %esi
+  8003a2:	5f                   	pop    %edi
+  8003a3:	5d                   	pop    %ebp
+  8003a4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003a5:	83 ec 0c             	sub    $0xc,%esp
+  8003a8:	50                   	push   %eax
+  8003a9:	6a 0d                	push   $0xd
+  8003ab:	68 4a 37 80 00       	push   $0x80374a
+  8003b0:	6a 23                	push   $0x23
+  8003b2:	68 67 37 80 00       	push   $0x803767
+  8003b7:	e8 74 21 00 00       	call   802530 <_panic>
+
+008003bc <sys_ipc_recv>:
+{
+  8003bc:	55                   	push   %ebp
+  8003bd:	89 e5                	mov    %esp,%ebp
+  8003bf:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  8003c2:	6a 00                	push   $0x0
+  8003c4:	6a 01                	push   $0x1
+  8003c6:	ff 75 08             	push   0x8(%ebp)
+  8003c9:	e8 ab ff ff ff       	call   800379 <sys_ipc_recvv>
+}
+  8003ce:	c9                   	leave
+  8003cf:	c3                   	ret
+
+008003d0 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  8003d0:	55                   	push   %ebp
+  8003d1:	89 e5                	mov    %esp,%ebp
+  8003d3:	57                   	push   %edi
+  8003d4:	56                   	push   %esi
+  8003d5:	53                   	push   %ebx
+  8003d6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003e4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003e9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003ec:	89 de                	mov    %ebx,%esi
+  8003ee:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003f0:	85 c0                	test   %eax,%eax
+  8003f2:	7f 08                	jg     8003fc <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  8003f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f7:	5b                   	pop    %ebx
+  8003f8:	5e                   	pop    %esi
+  8003f9:	5f                   	pop    %edi
+  8003fa:	5d                   	pop    %ebp
+  8003fb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003fc:	83 ec 0c             	sub    $0xc,%esp
+  8003ff:	50                   	push   %eax
+  800400:	6a 0d                	push   $0xd
+  800402:	68 4a 37 80 00       	push   $0x80374a
+  800407:	6a 23                	push   $0x23
+  800409:	68 67 37 80 00       	push   $0x803767
+  80040e:	e8 1d 21 00 00       	call   802530 <_panic>
+
+00800413 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800413:	55                   	push   %ebp
+  800414:	89 e5                	mov    %esp,%ebp
+  800416:	57                   	push   %edi
+  800417:	56                   	push   %esi
+  800418:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800419:	ba 00 00 00 00       	mov    $0x0,%edx
+  80041e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800423:	89 d1                	mov    %edx,%ecx
+  800425:	89 d3                	mov    %edx,%ebx
+  800427:	89 d7                	mov    %edx,%edi
+  800429:	55                   	push   %ebp
+  80042a:	89 e5                	mov    %esp,%ebp
+  80042c:	8d 35 34 04 80 00    	lea    0x800434,%esi
+  800432:	0f 34                	sysenter
+  800434:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800435:	5b                   	pop    %ebx
+  800436:	5e                   	pop    %esi
+  800437:	5f                   	pop    %edi
+  800438:	5d                   	pop    %ebp
+  800439:	c3                   	ret
+
+0080043a <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  80043a:	55                   	push   %ebp
+  80043b:	89 e5                	mov    %esp,%ebp
+  80043d:	57                   	push   %edi
+  80043e:	56                   	push   %esi
+  80043f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800440:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800445:	8b 55 08             	mov    0x8(%ebp),%edx
+  800448:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80044b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800450:	89 df                	mov    %ebx,%edi
+  800452:	55                   	push   %ebp
+  800453:	89 e5                	mov    %esp,%ebp
+  800455:	8d 35 5d 04 80 00    	lea    0x80045d,%esi
+  80045b:	0f 34                	sysenter
+  80045d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  80045e:	5b                   	pop    %ebx
+  80045f:	5e                   	pop    %esi
+  800460:	5f                   	pop    %edi
+  800461:	5d                   	pop    %ebp
+  800462:	c3                   	ret
+
+00800463 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800463:	55                   	push   %ebp
+  800464:	89 e5                	mov    %esp,%ebp
+  800466:	57                   	push   %edi
+  800467:	56                   	push   %esi
+  800468:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800469:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80046e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800471:	b8 10 00 00 00       	mov    $0x10,%eax
+  800476:	89 cb                	mov    %ecx,%ebx
+  800478:	89 cf                	mov    %ecx,%edi
+  80047a:	55                   	push   %ebp
+  80047b:	89 e5                	mov    %esp,%ebp
+  80047d:	8d 35 85 04 80 00    	lea    0x800485,%esi
+  800483:	0f 34                	sysenter
+  800485:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800486:	5b                   	pop    %ebx
+  800487:	5e                   	pop    %esi
+  800488:	5f                   	pop    %edi
+  800489:	5d                   	pop    %ebp
+  80048a:	c3                   	ret
+
+0080048b <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  80048b:	55                   	push   %ebp
+  80048c:	89 e5                	mov    %esp,%ebp
+  80048e:	57                   	push   %edi
+  80048f:	56                   	push   %esi
+  800490:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800491:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800496:	8b 55 08             	mov    0x8(%ebp),%edx
+  800499:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80049c:	b8 12 00 00 00       	mov    $0x12,%eax
+  8004a1:	89 df                	mov    %ebx,%edi
+  8004a3:	55                   	push   %ebp
+  8004a4:	89 e5                	mov    %esp,%ebp
+  8004a6:	8d 35 ae 04 80 00    	lea    0x8004ae,%esi
+  8004ac:	0f 34                	sysenter
+  8004ae:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8004af:	5b                   	pop    %ebx
+  8004b0:	5e                   	pop    %esi
+  8004b1:	5f                   	pop    %edi
+  8004b2:	5d                   	pop    %ebp
+  8004b3:	c3                   	ret
+
+008004b4 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8004b4:	55                   	push   %ebp
+  8004b5:	89 e5                	mov    %esp,%ebp
+  8004b7:	57                   	push   %edi
+  8004b8:	56                   	push   %esi
+  8004b9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c5:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004ca:	89 df                	mov    %ebx,%edi
+  8004cc:	55                   	push   %ebp
+  8004cd:	89 e5                	mov    %esp,%ebp
+  8004cf:	8d 35 d7 04 80 00    	lea    0x8004d7,%esi
+  8004d5:	0f 34                	sysenter
+  8004d7:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  8004d8:	5b                   	pop    %ebx
+  8004d9:	5e                   	pop    %esi
+  8004da:	5f                   	pop    %edi
+  8004db:	5d                   	pop    %ebp
+  8004dc:	c3                   	ret
+
+008004dd <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  8004dd:	55                   	push   %ebp
+  8004de:	89 e5                	mov    %esp,%ebp
+  8004e0:	57                   	push   %edi
+  8004e1:	56                   	push   %esi
+  8004e2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004f1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004f4:	55                   	push   %ebp
+  8004f5:	89 e5                	mov    %esp,%ebp
+  8004f7:	8d 35 ff 04 80 00    	lea    0x8004ff,%esi
+  8004fd:	0f 34                	sysenter
+  8004ff:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800500:	5b                   	pop    %ebx
+  800501:	5e                   	pop    %esi
+  800502:	5f                   	pop    %edi
+  800503:	5d                   	pop    %ebp
+  800504:	c3                   	ret
+
+00800505 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800505:	55                   	push   %ebp
+  800506:	89 e5                	mov    %esp,%ebp
+  800508:	57                   	push   %edi
+  800509:	56                   	push   %esi
+  80050a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80050b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800510:	8b 55 08             	mov    0x8(%ebp),%edx
+  800513:	b8 11 00 00 00       	mov    $0x11,%eax
+  800518:	89 cb                	mov    %ecx,%ebx
+  80051a:	89 cf                	mov    %ecx,%edi
+  80051c:	89 ce                	mov    %ecx,%esi
+  80051e:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800520:	5b                   	pop    %ebx
+  800521:	5e                   	pop    %esi
+  800522:	5f                   	pop    %edi
+  800523:	5d                   	pop    %ebp
+  800524:	c3                   	ret
+
+00800525 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800525:	55                   	push   %ebp
+  800526:	89 e5                	mov    %esp,%ebp
+  800528:	57                   	push   %edi
+  800529:	56                   	push   %esi
+  80052a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80052b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800530:	8b 55 08             	mov    0x8(%ebp),%edx
+  800533:	b8 15 00 00 00       	mov    $0x15,%eax
+  800538:	89 cb                	mov    %ecx,%ebx
+  80053a:	89 cf                	mov    %ecx,%edi
+  80053c:	55                   	push   %ebp
+  80053d:	89 e5                	mov    %esp,%ebp
+  80053f:	8d 35 47 05 80 00    	lea    0x800547,%esi
+  800545:	0f 34                	sysenter
+  800547:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800548:	5b                   	pop    %ebx
+  800549:	5e                   	pop    %esi
+  80054a:	5f                   	pop    %edi
+  80054b:	5d                   	pop    %ebp
+  80054c:	c3                   	ret
+
+0080054d <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  80054d:	55                   	push   %ebp
+  80054e:	89 e5                	mov    %esp,%ebp
+  800550:	57                   	push   %edi
+  800551:	56                   	push   %esi
+  800552:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800553:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800558:	8b 55 08             	mov    0x8(%ebp),%edx
+  80055b:	b8 16 00 00 00       	mov    $0x16,%eax
+  800560:	89 cb                	mov    %ecx,%ebx
+  800562:	89 cf                	mov    %ecx,%edi
+  800564:	55                   	push   %ebp
+  800565:	89 e5                	mov    %esp,%ebp
+  800567:	8d 35 6f 05 80 00    	lea    0x80056f,%esi
+  80056d:	0f 34                	sysenter
+  80056f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800570:	5b                   	pop    %ebx
+  800571:	5e                   	pop    %esi
+  800572:	5f                   	pop    %edi
+  800573:	5d                   	pop    %ebp
+  800574:	c3                   	ret
+
+00800575 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800575:	55                   	push   %ebp
+  800576:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800578:	8b 45 08             	mov    0x8(%ebp),%eax
+  80057b:	05 00 00 00 30       	add    $0x30000000,%eax
+  800580:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800583:	5d                   	pop    %ebp
+  800584:	c3                   	ret
+
+00800585 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800585:	55                   	push   %ebp
+  800586:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800588:	8b 45 08             	mov    0x8(%ebp),%eax
+  80058b:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800590:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800595:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80059a:	5d                   	pop    %ebp
+  80059b:	c3                   	ret
+
+0080059c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80059c:	55                   	push   %ebp
+  80059d:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80059f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8005a4:	eb 02                	jmp    8005a8 <fd_alloc+0xc>
+  8005a6:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8005a8:	89 c2                	mov    %eax,%edx
+  8005aa:	c1 ea 16             	shr    $0x16,%edx
+  8005ad:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8005b4:	f6 c2 01             	test   $0x1,%dl
+  8005b7:	74 2b                	je     8005e4 <fd_alloc+0x48>
+  8005b9:	89 c2                	mov    %eax,%edx
+  8005bb:	c1 ea 0c             	shr    $0xc,%edx
+  8005be:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8005c5:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8005cb:	f6 c1 01             	test   $0x1,%cl
+  8005ce:	74 14                	je     8005e4 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8005d0:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8005d6:	75 ce                	jne    8005a6 <fd_alloc+0xa>
+  8005d8:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8005dd:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8005e2:	eb 05                	jmp    8005e9 <fd_alloc+0x4d>
+			return 0;
+  8005e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8005e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005ec:	89 02                	mov    %eax,(%edx)
+}
+  8005ee:	89 c8                	mov    %ecx,%eax
+  8005f0:	5d                   	pop    %ebp
+  8005f1:	c3                   	ret
+
+008005f2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8005f2:	55                   	push   %ebp
+  8005f3:	89 e5                	mov    %esp,%ebp
+  8005f5:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8005f8:	83 f8 1f             	cmp    $0x1f,%eax
+  8005fb:	77 30                	ja     80062d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8005fd:	c1 e0 0c             	shl    $0xc,%eax
+  800600:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800605:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80060b:	f6 c2 01             	test   $0x1,%dl
+  80060e:	74 24                	je     800634 <fd_lookup+0x42>
+  800610:	89 c2                	mov    %eax,%edx
+  800612:	c1 ea 0c             	shr    $0xc,%edx
+  800615:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80061c:	f6 c2 01             	test   $0x1,%dl
+  80061f:	74 1a                	je     80063b <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800621:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800624:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800626:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80062b:	5d                   	pop    %ebp
+  80062c:	c3                   	ret
+		return -E_INVAL;
+  80062d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800632:	eb f7                	jmp    80062b <fd_lookup+0x39>
+		return -E_INVAL;
+  800634:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800639:	eb f0                	jmp    80062b <fd_lookup+0x39>
+  80063b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800640:	eb e9                	jmp    80062b <fd_lookup+0x39>
+
+00800642 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800642:	55                   	push   %ebp
+  800643:	89 e5                	mov    %esp,%ebp
+  800645:	53                   	push   %ebx
+  800646:	83 ec 04             	sub    $0x4,%esp
+  800649:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80064c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800651:	eb 03                	jmp    800656 <dev_lookup+0x14>
+  800653:	83 c0 01             	add    $0x1,%eax
+  800656:	8b 1c 85 f4 37 80 00 	mov    0x8037f4(,%eax,4),%ebx
+  80065d:	85 db                	test   %ebx,%ebx
+  80065f:	74 0b                	je     80066c <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800661:	39 13                	cmp    %edx,(%ebx)
+  800663:	75 ee                	jne    800653 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800665:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066a:	eb 1f                	jmp    80068b <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80066c:	a1 00 50 80 00       	mov    0x805000,%eax
+  800671:	8b 40 48             	mov    0x48(%eax),%eax
+  800674:	83 ec 04             	sub    $0x4,%esp
+  800677:	52                   	push   %edx
+  800678:	50                   	push   %eax
+  800679:	68 78 37 80 00       	push   $0x803778
+  80067e:	e8 88 1f 00 00       	call   80260b <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800683:	83 c4 10             	add    $0x10,%esp
+  800686:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80068b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80068e:	89 1a                	mov    %ebx,(%edx)
+}
+  800690:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800693:	c9                   	leave
+  800694:	c3                   	ret
+
+00800695 <fd_close>:
+{
+  800695:	55                   	push   %ebp
+  800696:	89 e5                	mov    %esp,%ebp
+  800698:	57                   	push   %edi
+  800699:	56                   	push   %esi
+  80069a:	53                   	push   %ebx
+  80069b:	83 ec 24             	sub    $0x24,%esp
+  80069e:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006a1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006a4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8006a7:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8006a8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8006ae:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006b1:	50                   	push   %eax
+  8006b2:	e8 3b ff ff ff       	call   8005f2 <fd_lookup>
+  8006b7:	89 c3                	mov    %eax,%ebx
+  8006b9:	83 c4 10             	add    $0x10,%esp
+  8006bc:	85 c0                	test   %eax,%eax
+  8006be:	78 05                	js     8006c5 <fd_close+0x30>
+	    || fd != fd2)
+  8006c0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8006c3:	74 16                	je     8006db <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8006c5:	89 f8                	mov    %edi,%eax
+  8006c7:	84 c0                	test   %al,%al
+  8006c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ce:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8006d1:	89 d8                	mov    %ebx,%eax
+  8006d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006d6:	5b                   	pop    %ebx
+  8006d7:	5e                   	pop    %esi
+  8006d8:	5f                   	pop    %edi
+  8006d9:	5d                   	pop    %ebp
+  8006da:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8006db:	83 ec 08             	sub    $0x8,%esp
+  8006de:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8006e1:	50                   	push   %eax
+  8006e2:	ff 36                	push   (%esi)
+  8006e4:	e8 59 ff ff ff       	call   800642 <dev_lookup>
+  8006e9:	89 c3                	mov    %eax,%ebx
+  8006eb:	83 c4 10             	add    $0x10,%esp
+  8006ee:	85 c0                	test   %eax,%eax
+  8006f0:	78 1a                	js     80070c <fd_close+0x77>
+		if (dev->dev_close)
+  8006f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006f5:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8006f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8006fd:	85 c0                	test   %eax,%eax
+  8006ff:	74 0b                	je     80070c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800701:	83 ec 0c             	sub    $0xc,%esp
+  800704:	56                   	push   %esi
+  800705:	ff d0                	call   *%eax
+  800707:	89 c3                	mov    %eax,%ebx
+  800709:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80070c:	83 ec 08             	sub    $0x8,%esp
+  80070f:	56                   	push   %esi
+  800710:	6a 00                	push   $0x0
+  800712:	e8 ea fa ff ff       	call   800201 <sys_page_unmap>
+	return r;
+  800717:	83 c4 10             	add    $0x10,%esp
+  80071a:	eb b5                	jmp    8006d1 <fd_close+0x3c>
+
+0080071c <close>:
+
+int
+close(int fdnum)
+{
+  80071c:	55                   	push   %ebp
+  80071d:	89 e5                	mov    %esp,%ebp
+  80071f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800722:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800725:	50                   	push   %eax
+  800726:	ff 75 08             	push   0x8(%ebp)
+  800729:	e8 c4 fe ff ff       	call   8005f2 <fd_lookup>
+  80072e:	83 c4 10             	add    $0x10,%esp
+  800731:	85 c0                	test   %eax,%eax
+  800733:	79 02                	jns    800737 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800735:	c9                   	leave
+  800736:	c3                   	ret
+		return fd_close(fd, 1);
+  800737:	83 ec 08             	sub    $0x8,%esp
+  80073a:	6a 01                	push   $0x1
+  80073c:	ff 75 f4             	push   -0xc(%ebp)
+  80073f:	e8 51 ff ff ff       	call   800695 <fd_close>
+  800744:	83 c4 10             	add    $0x10,%esp
+  800747:	eb ec                	jmp    800735 <close+0x19>
+
+00800749 <close_all>:
+
+void
+close_all(void)
+{
+  800749:	55                   	push   %ebp
+  80074a:	89 e5                	mov    %esp,%ebp
+  80074c:	53                   	push   %ebx
+  80074d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800750:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800755:	83 ec 0c             	sub    $0xc,%esp
+  800758:	53                   	push   %ebx
+  800759:	e8 be ff ff ff       	call   80071c <close>
+	for (i = 0; i < MAXFD; i++)
+  80075e:	83 c3 01             	add    $0x1,%ebx
+  800761:	83 c4 10             	add    $0x10,%esp
+  800764:	83 fb 20             	cmp    $0x20,%ebx
+  800767:	75 ec                	jne    800755 <close_all+0xc>
+}
+  800769:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80076c:	c9                   	leave
+  80076d:	c3                   	ret
+
+0080076e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80076e:	55                   	push   %ebp
+  80076f:	89 e5                	mov    %esp,%ebp
+  800771:	57                   	push   %edi
+  800772:	56                   	push   %esi
+  800773:	53                   	push   %ebx
+  800774:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800777:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80077a:	50                   	push   %eax
+  80077b:	ff 75 08             	push   0x8(%ebp)
+  80077e:	e8 6f fe ff ff       	call   8005f2 <fd_lookup>
+  800783:	89 c3                	mov    %eax,%ebx
+  800785:	83 c4 10             	add    $0x10,%esp
+  800788:	85 c0                	test   %eax,%eax
+  80078a:	78 7f                	js     80080b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80078c:	83 ec 0c             	sub    $0xc,%esp
+  80078f:	ff 75 0c             	push   0xc(%ebp)
+  800792:	e8 85 ff ff ff       	call   80071c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800797:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80079a:	c1 e6 0c             	shl    $0xc,%esi
+  80079d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8007a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8007a6:	89 3c 24             	mov    %edi,(%esp)
+  8007a9:	e8 d7 fd ff ff       	call   800585 <fd2data>
+  8007ae:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8007b0:	89 34 24             	mov    %esi,(%esp)
+  8007b3:	e8 cd fd ff ff       	call   800585 <fd2data>
+  8007b8:	83 c4 10             	add    $0x10,%esp
+  8007bb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8007be:	89 d8                	mov    %ebx,%eax
+  8007c0:	c1 e8 16             	shr    $0x16,%eax
+  8007c3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8007ca:	a8 01                	test   $0x1,%al
+  8007cc:	74 11                	je     8007df <dup+0x71>
+  8007ce:	89 d8                	mov    %ebx,%eax
+  8007d0:	c1 e8 0c             	shr    $0xc,%eax
+  8007d3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8007da:	f6 c2 01             	test   $0x1,%dl
+  8007dd:	75 36                	jne    800815 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8007df:	89 f8                	mov    %edi,%eax
+  8007e1:	c1 e8 0c             	shr    $0xc,%eax
+  8007e4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8007eb:	83 ec 0c             	sub    $0xc,%esp
+  8007ee:	25 07 0e 00 00       	and    $0xe07,%eax
+  8007f3:	50                   	push   %eax
+  8007f4:	56                   	push   %esi
+  8007f5:	6a 00                	push   $0x0
+  8007f7:	57                   	push   %edi
+  8007f8:	6a 00                	push   $0x0
+  8007fa:	e8 c0 f9 ff ff       	call   8001bf <sys_page_map>
+  8007ff:	89 c3                	mov    %eax,%ebx
+  800801:	83 c4 20             	add    $0x20,%esp
+  800804:	85 c0                	test   %eax,%eax
+  800806:	78 33                	js     80083b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800808:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80080b:	89 d8                	mov    %ebx,%eax
+  80080d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800810:	5b                   	pop    %ebx
+  800811:	5e                   	pop    %esi
+  800812:	5f                   	pop    %edi
+  800813:	5d                   	pop    %ebp
+  800814:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800815:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80081c:	83 ec 0c             	sub    $0xc,%esp
+  80081f:	25 07 0e 00 00       	and    $0xe07,%eax
+  800824:	50                   	push   %eax
+  800825:	ff 75 d4             	push   -0x2c(%ebp)
+  800828:	6a 00                	push   $0x0
+  80082a:	53                   	push   %ebx
+  80082b:	6a 00                	push   $0x0
+  80082d:	e8 8d f9 ff ff       	call   8001bf <sys_page_map>
+  800832:	89 c3                	mov    %eax,%ebx
+  800834:	83 c4 20             	add    $0x20,%esp
+  800837:	85 c0                	test   %eax,%eax
+  800839:	79 a4                	jns    8007df <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80083b:	83 ec 08             	sub    $0x8,%esp
+  80083e:	56                   	push   %esi
+  80083f:	6a 00                	push   $0x0
+  800841:	e8 bb f9 ff ff       	call   800201 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800846:	83 c4 08             	add    $0x8,%esp
+  800849:	ff 75 d4             	push   -0x2c(%ebp)
+  80084c:	6a 00                	push   $0x0
+  80084e:	e8 ae f9 ff ff       	call   800201 <sys_page_unmap>
+	return r;
+  800853:	83 c4 10             	add    $0x10,%esp
+  800856:	eb b3                	jmp    80080b <dup+0x9d>
+
+00800858 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800858:	55                   	push   %ebp
+  800859:	89 e5                	mov    %esp,%ebp
+  80085b:	56                   	push   %esi
+  80085c:	53                   	push   %ebx
+  80085d:	83 ec 18             	sub    $0x18,%esp
+  800860:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800863:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800866:	50                   	push   %eax
+  800867:	56                   	push   %esi
+  800868:	e8 85 fd ff ff       	call   8005f2 <fd_lookup>
+  80086d:	83 c4 10             	add    $0x10,%esp
+  800870:	85 c0                	test   %eax,%eax
+  800872:	78 3c                	js     8008b0 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800874:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800877:	83 ec 08             	sub    $0x8,%esp
+  80087a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80087d:	50                   	push   %eax
+  80087e:	ff 33                	push   (%ebx)
+  800880:	e8 bd fd ff ff       	call   800642 <dev_lookup>
+  800885:	83 c4 10             	add    $0x10,%esp
+  800888:	85 c0                	test   %eax,%eax
+  80088a:	78 24                	js     8008b0 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80088c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80088f:	83 e0 03             	and    $0x3,%eax
+  800892:	83 f8 01             	cmp    $0x1,%eax
+  800895:	74 20                	je     8008b7 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800897:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80089a:	8b 40 08             	mov    0x8(%eax),%eax
+  80089d:	85 c0                	test   %eax,%eax
+  80089f:	74 37                	je     8008d8 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8008a1:	83 ec 04             	sub    $0x4,%esp
+  8008a4:	ff 75 10             	push   0x10(%ebp)
+  8008a7:	ff 75 0c             	push   0xc(%ebp)
+  8008aa:	53                   	push   %ebx
+  8008ab:	ff d0                	call   *%eax
+  8008ad:	83 c4 10             	add    $0x10,%esp
+}
+  8008b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008b3:	5b                   	pop    %ebx
+  8008b4:	5e                   	pop    %esi
+  8008b5:	5d                   	pop    %ebp
+  8008b6:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8008b7:	a1 00 50 80 00       	mov    0x805000,%eax
+  8008bc:	8b 40 48             	mov    0x48(%eax),%eax
+  8008bf:	83 ec 04             	sub    $0x4,%esp
+  8008c2:	56                   	push   %esi
+  8008c3:	50                   	push   %eax
+  8008c4:	68 b9 37 80 00       	push   $0x8037b9
+  8008c9:	e8 3d 1d 00 00       	call   80260b <cprintf>
+		return -E_INVAL;
+  8008ce:	83 c4 10             	add    $0x10,%esp
+  8008d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008d6:	eb d8                	jmp    8008b0 <read+0x58>
+		return -E_NOT_SUPP;
+  8008d8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8008dd:	eb d1                	jmp    8008b0 <read+0x58>
+
+008008df <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8008df:	55                   	push   %ebp
+  8008e0:	89 e5                	mov    %esp,%ebp
+  8008e2:	57                   	push   %edi
+  8008e3:	56                   	push   %esi
+  8008e4:	53                   	push   %ebx
+  8008e5:	83 ec 0c             	sub    $0xc,%esp
+  8008e8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008eb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8008ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008f3:	eb 02                	jmp    8008f7 <readn+0x18>
+  8008f5:	01 c3                	add    %eax,%ebx
+  8008f7:	39 f3                	cmp    %esi,%ebx
+  8008f9:	73 21                	jae    80091c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8008fb:	83 ec 04             	sub    $0x4,%esp
+  8008fe:	89 f0                	mov    %esi,%eax
+  800900:	29 d8                	sub    %ebx,%eax
+  800902:	50                   	push   %eax
+  800903:	89 d8                	mov    %ebx,%eax
+  800905:	03 45 0c             	add    0xc(%ebp),%eax
+  800908:	50                   	push   %eax
+  800909:	57                   	push   %edi
+  80090a:	e8 49 ff ff ff       	call   800858 <read>
+		if (m < 0)
+  80090f:	83 c4 10             	add    $0x10,%esp
+  800912:	85 c0                	test   %eax,%eax
+  800914:	78 04                	js     80091a <readn+0x3b>
+			return m;
+		if (m == 0)
+  800916:	75 dd                	jne    8008f5 <readn+0x16>
+  800918:	eb 02                	jmp    80091c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80091a:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80091c:	89 d8                	mov    %ebx,%eax
+  80091e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800921:	5b                   	pop    %ebx
+  800922:	5e                   	pop    %esi
+  800923:	5f                   	pop    %edi
+  800924:	5d                   	pop    %ebp
+  800925:	c3                   	ret
+
+00800926 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800926:	55                   	push   %ebp
+  800927:	89 e5                	mov    %esp,%ebp
+  800929:	56                   	push   %esi
+  80092a:	53                   	push   %ebx
+  80092b:	83 ec 18             	sub    $0x18,%esp
+  80092e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800931:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800934:	50                   	push   %eax
+  800935:	53                   	push   %ebx
+  800936:	e8 b7 fc ff ff       	call   8005f2 <fd_lookup>
+  80093b:	83 c4 10             	add    $0x10,%esp
+  80093e:	85 c0                	test   %eax,%eax
+  800940:	78 37                	js     800979 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800942:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800945:	83 ec 08             	sub    $0x8,%esp
+  800948:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80094b:	50                   	push   %eax
+  80094c:	ff 36                	push   (%esi)
+  80094e:	e8 ef fc ff ff       	call   800642 <dev_lookup>
+  800953:	83 c4 10             	add    $0x10,%esp
+  800956:	85 c0                	test   %eax,%eax
+  800958:	78 1f                	js     800979 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80095a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80095e:	74 20                	je     800980 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800960:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800963:	8b 40 0c             	mov    0xc(%eax),%eax
+  800966:	85 c0                	test   %eax,%eax
+  800968:	74 37                	je     8009a1 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80096a:	83 ec 04             	sub    $0x4,%esp
+  80096d:	ff 75 10             	push   0x10(%ebp)
+  800970:	ff 75 0c             	push   0xc(%ebp)
+  800973:	56                   	push   %esi
+  800974:	ff d0                	call   *%eax
+  800976:	83 c4 10             	add    $0x10,%esp
+}
+  800979:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80097c:	5b                   	pop    %ebx
+  80097d:	5e                   	pop    %esi
+  80097e:	5d                   	pop    %ebp
+  80097f:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800980:	a1 00 50 80 00       	mov    0x805000,%eax
+  800985:	8b 40 48             	mov    0x48(%eax),%eax
+  800988:	83 ec 04             	sub    $0x4,%esp
+  80098b:	53                   	push   %ebx
+  80098c:	50                   	push   %eax
+  80098d:	68 d5 37 80 00       	push   $0x8037d5
+  800992:	e8 74 1c 00 00       	call   80260b <cprintf>
+		return -E_INVAL;
+  800997:	83 c4 10             	add    $0x10,%esp
+  80099a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80099f:	eb d8                	jmp    800979 <write+0x53>
+		return -E_NOT_SUPP;
+  8009a1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009a6:	eb d1                	jmp    800979 <write+0x53>
+
+008009a8 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8009a8:	55                   	push   %ebp
+  8009a9:	89 e5                	mov    %esp,%ebp
+  8009ab:	53                   	push   %ebx
+  8009ac:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009af:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009b2:	50                   	push   %eax
+  8009b3:	ff 75 08             	push   0x8(%ebp)
+  8009b6:	e8 37 fc ff ff       	call   8005f2 <fd_lookup>
+  8009bb:	83 c4 10             	add    $0x10,%esp
+  8009be:	85 c0                	test   %eax,%eax
+  8009c0:	78 3a                	js     8009fc <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009c2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8009c5:	83 ec 08             	sub    $0x8,%esp
+  8009c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009cb:	50                   	push   %eax
+  8009cc:	ff 33                	push   (%ebx)
+  8009ce:	e8 6f fc ff ff       	call   800642 <dev_lookup>
+  8009d3:	83 c4 10             	add    $0x10,%esp
+  8009d6:	85 c0                	test   %eax,%eax
+  8009d8:	78 22                	js     8009fc <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8009da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009dd:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8009e0:	85 c0                	test   %eax,%eax
+  8009e2:	74 0d                	je     8009f1 <seek+0x49>
+  8009e4:	83 ec 0c             	sub    $0xc,%esp
+  8009e7:	53                   	push   %ebx
+  8009e8:	ff d0                	call   *%eax
+  8009ea:	83 c4 10             	add    $0x10,%esp
+  8009ed:	85 c0                	test   %eax,%eax
+  8009ef:	78 0b                	js     8009fc <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8009f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009f4:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8009f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ff:	c9                   	leave
+  800a00:	c3                   	ret
+
+00800a01 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  800a01:	55                   	push   %ebp
+  800a02:	89 e5                	mov    %esp,%ebp
+  800a04:	53                   	push   %ebx
+  800a05:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a08:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a0b:	50                   	push   %eax
+  800a0c:	ff 75 08             	push   0x8(%ebp)
+  800a0f:	e8 de fb ff ff       	call   8005f2 <fd_lookup>
+  800a14:	83 c4 10             	add    $0x10,%esp
+  800a17:	85 c0                	test   %eax,%eax
+  800a19:	78 2b                	js     800a46 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a1b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a1e:	83 ec 08             	sub    $0x8,%esp
+  800a21:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a24:	50                   	push   %eax
+  800a25:	ff 33                	push   (%ebx)
+  800a27:	e8 16 fc ff ff       	call   800642 <dev_lookup>
+  800a2c:	83 c4 10             	add    $0x10,%esp
+  800a2f:	85 c0                	test   %eax,%eax
+  800a31:	78 13                	js     800a46 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  800a33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a36:	8b 40 1c             	mov    0x1c(%eax),%eax
+  800a39:	85 c0                	test   %eax,%eax
+  800a3b:	74 0e                	je     800a4b <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  800a3d:	83 ec 0c             	sub    $0xc,%esp
+  800a40:	53                   	push   %ebx
+  800a41:	ff d0                	call   *%eax
+  800a43:	83 c4 10             	add    $0x10,%esp
+}
+  800a46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a49:	c9                   	leave
+  800a4a:	c3                   	ret
+		return 0;
+  800a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a50:	eb f4                	jmp    800a46 <fsync+0x45>
+
+00800a52 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a52:	55                   	push   %ebp
+  800a53:	89 e5                	mov    %esp,%ebp
+  800a55:	56                   	push   %esi
+  800a56:	53                   	push   %ebx
+  800a57:	83 ec 18             	sub    $0x18,%esp
+  800a5a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a5d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a60:	50                   	push   %eax
+  800a61:	53                   	push   %ebx
+  800a62:	e8 8b fb ff ff       	call   8005f2 <fd_lookup>
+  800a67:	83 c4 10             	add    $0x10,%esp
+  800a6a:	85 c0                	test   %eax,%eax
+  800a6c:	78 34                	js     800aa2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a6e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a71:	83 ec 08             	sub    $0x8,%esp
+  800a74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a77:	50                   	push   %eax
+  800a78:	ff 36                	push   (%esi)
+  800a7a:	e8 c3 fb ff ff       	call   800642 <dev_lookup>
+  800a7f:	83 c4 10             	add    $0x10,%esp
+  800a82:	85 c0                	test   %eax,%eax
+  800a84:	78 1c                	js     800aa2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a86:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a8a:	74 1d                	je     800aa9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800a8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a8f:	8b 40 18             	mov    0x18(%eax),%eax
+  800a92:	85 c0                	test   %eax,%eax
+  800a94:	74 34                	je     800aca <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800a96:	83 ec 08             	sub    $0x8,%esp
+  800a99:	ff 75 0c             	push   0xc(%ebp)
+  800a9c:	56                   	push   %esi
+  800a9d:	ff d0                	call   *%eax
+  800a9f:	83 c4 10             	add    $0x10,%esp
+}
+  800aa2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aa5:	5b                   	pop    %ebx
+  800aa6:	5e                   	pop    %esi
+  800aa7:	5d                   	pop    %ebp
+  800aa8:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800aa9:	a1 00 50 80 00       	mov    0x805000,%eax
+  800aae:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ab1:	83 ec 04             	sub    $0x4,%esp
+  800ab4:	53                   	push   %ebx
+  800ab5:	50                   	push   %eax
+  800ab6:	68 98 37 80 00       	push   $0x803798
+  800abb:	e8 4b 1b 00 00       	call   80260b <cprintf>
+		return -E_INVAL;
+  800ac0:	83 c4 10             	add    $0x10,%esp
+  800ac3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac8:	eb d8                	jmp    800aa2 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800aca:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800acf:	eb d1                	jmp    800aa2 <ftruncate+0x50>
+
+00800ad1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800ad1:	55                   	push   %ebp
+  800ad2:	89 e5                	mov    %esp,%ebp
+  800ad4:	56                   	push   %esi
+  800ad5:	53                   	push   %ebx
+  800ad6:	83 ec 18             	sub    $0x18,%esp
+  800ad9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800adc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800adf:	50                   	push   %eax
+  800ae0:	ff 75 08             	push   0x8(%ebp)
+  800ae3:	e8 0a fb ff ff       	call   8005f2 <fd_lookup>
+  800ae8:	83 c4 10             	add    $0x10,%esp
+  800aeb:	85 c0                	test   %eax,%eax
+  800aed:	78 49                	js     800b38 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800aef:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800af2:	83 ec 08             	sub    $0x8,%esp
+  800af5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800af8:	50                   	push   %eax
+  800af9:	ff 36                	push   (%esi)
+  800afb:	e8 42 fb ff ff       	call   800642 <dev_lookup>
+  800b00:	83 c4 10             	add    $0x10,%esp
+  800b03:	85 c0                	test   %eax,%eax
+  800b05:	78 31                	js     800b38 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b0a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b0e:	74 2f                	je     800b3f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b10:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b13:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b1a:	00 00 00 
+	stat->st_isdir = 0;
+  800b1d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b24:	00 00 00 
+	stat->st_dev = dev;
+  800b27:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b2d:	83 ec 08             	sub    $0x8,%esp
+  800b30:	53                   	push   %ebx
+  800b31:	56                   	push   %esi
+  800b32:	ff 50 14             	call   *0x14(%eax)
+  800b35:	83 c4 10             	add    $0x10,%esp
+}
+  800b38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b3b:	5b                   	pop    %ebx
+  800b3c:	5e                   	pop    %esi
+  800b3d:	5d                   	pop    %ebp
+  800b3e:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b3f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b44:	eb f2                	jmp    800b38 <fstat+0x67>
+
+00800b46 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b46:	55                   	push   %ebp
+  800b47:	89 e5                	mov    %esp,%ebp
+  800b49:	56                   	push   %esi
+  800b4a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  800b4b:	83 ec 08             	sub    $0x8,%esp
+  800b4e:	68 00 10 00 00       	push   $0x1000
+  800b53:	ff 75 08             	push   0x8(%ebp)
+  800b56:	e8 b3 07 00 00       	call   80130e <open>
+  800b5b:	89 c3                	mov    %eax,%ebx
+  800b5d:	83 c4 10             	add    $0x10,%esp
+  800b60:	85 c0                	test   %eax,%eax
+  800b62:	78 1b                	js     800b7f <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  800b64:	83 ec 08             	sub    $0x8,%esp
+  800b67:	ff 75 0c             	push   0xc(%ebp)
+  800b6a:	50                   	push   %eax
+  800b6b:	e8 61 ff ff ff       	call   800ad1 <fstat>
+  800b70:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800b72:	89 1c 24             	mov    %ebx,(%esp)
+  800b75:	e8 a2 fb ff ff       	call   80071c <close>
+	return r;
+  800b7a:	83 c4 10             	add    $0x10,%esp
+  800b7d:	89 f3                	mov    %esi,%ebx
+}
+  800b7f:	89 d8                	mov    %ebx,%eax
+  800b81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b84:	5b                   	pop    %ebx
+  800b85:	5e                   	pop    %esi
+  800b86:	5d                   	pop    %ebp
+  800b87:	c3                   	ret
+
+00800b88 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  800b88:	55                   	push   %ebp
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	57                   	push   %edi
+  800b8c:	56                   	push   %esi
+  800b8d:	53                   	push   %ebx
+  800b8e:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  800b94:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  800b9a:	89 d6                	mov    %edx,%esi
+  800b9c:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  800ba2:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  800ba5:	89 d3                	mov    %edx,%ebx
+  800ba7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  800bad:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800bb4:	74 1d                	je     800bd3 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  800bb6:	b8 00 60 80 00       	mov    $0x806000,%eax
+  800bbb:	83 c8 07             	or     $0x7,%eax
+  800bbe:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  800bc4:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800bc9:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  800bcf:	01 ce                	add    %ecx,%esi
+  800bd1:	eb 28                	jmp    800bfb <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800bd3:	83 ec 0c             	sub    $0xc,%esp
+  800bd6:	6a 01                	push   $0x1
+  800bd8:	e8 05 28 00 00       	call   8033e2 <ipc_find_env>
+  800bdd:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800be2:	83 c4 10             	add    $0x10,%esp
+  800be5:	eb cf                	jmp    800bb6 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  800be7:	83 c0 01             	add    $0x1,%eax
+  800bea:	89 fa                	mov    %edi,%edx
+  800bec:	09 da                	or     %ebx,%edx
+  800bee:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800bf5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800bfb:	39 f3                	cmp    %esi,%ebx
+  800bfd:	72 e8                	jb     800be7 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  800bff:	83 f8 41             	cmp    $0x41,%eax
+  800c02:	77 2f                	ja     800c33 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  800c04:	50                   	push   %eax
+  800c05:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  800c0b:	50                   	push   %eax
+  800c0c:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  800c12:	ff 35 c8 70 80 00    	push   0x8070c8
+  800c18:	e8 77 27 00 00       	call   803394 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  800c1d:	83 c4 0c             	add    $0xc,%esp
+  800c20:	6a 00                	push   $0x0
+  800c22:	6a 00                	push   $0x0
+  800c24:	6a 00                	push   $0x0
+  800c26:	e8 13 26 00 00       	call   80323e <ipc_recv>
+}
+  800c2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2e:	5b                   	pop    %ebx
+  800c2f:	5e                   	pop    %esi
+  800c30:	5f                   	pop    %edi
+  800c31:	5d                   	pop    %ebp
+  800c32:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  800c33:	68 08 38 80 00       	push   $0x803808
+  800c38:	68 24 38 80 00       	push   $0x803824
+  800c3d:	6a 40                	push   $0x40
+  800c3f:	68 39 38 80 00       	push   $0x803839
+  800c44:	e8 e7 18 00 00       	call   802530 <_panic>
+
+00800c49 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  800c49:	55                   	push   %ebp
+  800c4a:	89 e5                	mov    %esp,%ebp
+  800c4c:	57                   	push   %edi
+  800c4d:	56                   	push   %esi
+  800c4e:	53                   	push   %ebx
+  800c4f:	83 ec 1c             	sub    $0x1c,%esp
+  800c52:	89 c3                	mov    %eax,%ebx
+  800c54:	89 d6                	mov    %edx,%esi
+  800c56:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  800c59:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  800c5f:	89 ca                	mov    %ecx,%edx
+  800c61:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  800c64:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  800c6b:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  800c6e:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  800c75:	8b 76 0c             	mov    0xc(%esi),%esi
+  800c78:	89 fb                	mov    %edi,%ebx
+  800c7a:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  800c81:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c84:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  800c8b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c8e:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  800c95:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c98:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  800c9f:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  800ca2:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  800ca9:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  800cae:	39 c8                	cmp    %ecx,%eax
+  800cb0:	74 0d                	je     800cbf <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  800cb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cba:	5b                   	pop    %ebx
+  800cbb:	5e                   	pop    %esi
+  800cbc:	5f                   	pop    %edi
+  800cbd:	5d                   	pop    %ebp
+  800cbe:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cbf:	6a 07                	push   $0x7
+  800cc1:	68 00 60 80 00       	push   $0x806000
+  800cc6:	6a 0d                	push   $0xd
+  800cc8:	ff 35 c8 70 80 00    	push   0x8070c8
+  800cce:	e8 d6 25 00 00       	call   8032a9 <ipc_send>
+  800cd3:	83 c4 10             	add    $0x10,%esp
+  800cd6:	eb da                	jmp    800cb2 <fsring_post+0x69>
+
+00800cd8 <fsipcv>:
+{
+  800cd8:	55                   	push   %ebp
+  800cd9:	89 e5                	mov    %esp,%ebp
+  800cdb:	57                   	push   %edi
+  800cdc:	56                   	push   %esi
+  800cdd:	53                   	push   %ebx
+  800cde:	83 ec 0c             	sub    $0xc,%esp
+  800ce1:	89 c7                	mov    %eax,%edi
+  800ce3:	89 d3                	mov    %edx,%ebx
+  800ce5:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  800ce7:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800cee:	74 26                	je     800d16 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cf0:	6a 07                	push   $0x7
+  800cf2:	68 00 60 80 00       	push   $0x806000
+  800cf7:	57                   	push   %edi
+  800cf8:	ff 35 c8 70 80 00    	push   0x8070c8
+  800cfe:	e8 a6 25 00 00       	call   8032a9 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  800d03:	6a 00                	push   $0x0
+  800d05:	56                   	push   %esi
+  800d06:	53                   	push   %ebx
+  800d07:	6a 00                	push   $0x0
+  800d09:	e8 f3 25 00 00       	call   803301 <ipc_recvv>
+}
+  800d0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d11:	5b                   	pop    %ebx
+  800d12:	5e                   	pop    %esi
+  800d13:	5f                   	pop    %edi
+  800d14:	5d                   	pop    %ebp
+  800d15:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d16:	83 ec 0c             	sub    $0xc,%esp
+  800d19:	6a 01                	push   $0x1
+  800d1b:	e8 c2 26 00 00       	call   8033e2 <ipc_find_env>
+  800d20:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800d25:	83 c4 10             	add    $0x10,%esp
+  800d28:	eb c6                	jmp    800cf0 <fsipcv+0x18>
+
+00800d2a <fsipc>:
+{
+  800d2a:	55                   	push   %ebp
+  800d2b:	89 e5                	mov    %esp,%ebp
+  800d2d:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  800d30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  800d37:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800d3a:	e8 99 ff ff ff       	call   800cd8 <fsipcv>
+}
+  800d3f:	c9                   	leave
+  800d40:	c3                   	ret
+
+00800d41 <file_write_direct>:
+{
+  800d41:	55                   	push   %ebp
+  800d42:	89 e5                	mov    %esp,%ebp
+  800d44:	56                   	push   %esi
+  800d45:	53                   	push   %ebx
+  800d46:	89 c3                	mov    %eax,%ebx
+  800d48:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800d4a:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  800d50:	77 40                	ja     800d92 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800d52:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  800d57:	39 c8                	cmp    %ecx,%eax
+  800d59:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d5c:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  800d5f:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  800d65:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800d6a:	83 ec 04             	sub    $0x4,%esp
+  800d6d:	50                   	push   %eax
+  800d6e:	52                   	push   %edx
+  800d6f:	68 08 60 80 00       	push   $0x806008
+  800d74:	e8 06 20 00 00       	call   802d7f <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800d79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d83:	e8 a2 ff ff ff       	call   800d2a <fsipc>
+  800d88:	83 c4 10             	add    $0x10,%esp
+}
+  800d8b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d8e:	5b                   	pop    %ebx
+  800d8f:	5e                   	pop    %esi
+  800d90:	5d                   	pop    %ebp
+  800d91:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  800d92:	89 d6                	mov    %edx,%esi
+  800d94:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  800d9a:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  800d9f:	29 f1                	sub    %esi,%ecx
+  800da1:	39 c1                	cmp    %eax,%ecx
+  800da3:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  800da6:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800da9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  800dae:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  800db4:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  800dba:	83 ec 0c             	sub    $0xc,%esp
+  800dbd:	6a 05                	push   $0x5
+  800dbf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dc4:	e8 bf fd ff ff       	call   800b88 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  800dc9:	83 c4 10             	add    $0x10,%esp
+  800dcc:	eb bd                	jmp    800d8b <file_write_direct+0x4a>
+
+00800dce <devfile_sync>:
+{
+  800dce:	55                   	push   %ebp
+  800dcf:	89 e5                	mov    %esp,%ebp
+  800dd1:	57                   	push   %edi
+  800dd2:	56                   	push   %esi
+  800dd3:	53                   	push   %ebx
+  800dd4:	83 ec 28             	sub    $0x28,%esp
+  800dd7:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  800dda:	56                   	push   %esi
+  800ddb:	e8 a5 f7 ff ff       	call   800585 <fd2data>
+  800de0:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  800de2:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  800de5:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  800dec:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800def:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  800df4:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  800df8:	74 45                	je     800e3f <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  800dfa:	8b 46 14             	mov    0x14(%esi),%eax
+  800dfd:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e0d:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  800e10:	39 cb                	cmp    %ecx,%ebx
+  800e12:	73 14                	jae    800e28 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  800e14:	29 d9                	sub    %ebx,%ecx
+  800e16:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800e19:	89 f0                	mov    %esi,%eax
+  800e1b:	e8 21 ff ff ff       	call   800d41 <file_write_direct>
+  800e20:	85 c0                	test   %eax,%eax
+  800e22:	7e 04                	jle    800e28 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e24:	01 c3                	add    %eax,%ebx
+  800e26:	eb e5                	jmp    800e0d <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  800e28:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e2b:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  800e32:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  800e35:	85 c0                	test   %eax,%eax
+  800e37:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  800e3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e42:	5b                   	pop    %ebx
+  800e43:	5e                   	pop    %esi
+  800e44:	5f                   	pop    %edi
+  800e45:	5d                   	pop    %ebp
+  800e46:	c3                   	ret
+
+00800e47 <devfile_write>:
+{
+  800e47:	55                   	push   %ebp
+  800e48:	89 e5                	mov    %esp,%ebp
+  800e4a:	57                   	push   %edi
+  800e4b:	56                   	push   %esi
+  800e4c:	53                   	push   %ebx
+  800e4d:	83 ec 28             	sub    $0x28,%esp
+  800e50:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e53:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  800e56:	53                   	push   %ebx
+  800e57:	e8 29 f7 ff ff       	call   800585 <fd2data>
+  800e5c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  800e5f:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  800e62:	83 c4 10             	add    $0x10,%esp
+  800e65:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  800e69:	74 43                	je     800eae <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  800e6b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  800e72:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800e75:	85 c0                	test   %eax,%eax
+  800e77:	74 43                	je     800ebc <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  800e79:	89 c2                	mov    %eax,%edx
+  800e7b:	03 53 14             	add    0x14(%ebx),%edx
+  800e7e:	39 fa                	cmp    %edi,%edx
+  800e80:	75 0b                	jne    800e8d <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  800e82:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  800e85:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  800e8b:	76 66                	jbe    800ef3 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  800e8d:	83 ec 0c             	sub    $0xc,%esp
+  800e90:	53                   	push   %ebx
+  800e91:	e8 38 ff ff ff       	call   800dce <devfile_sync>
+  800e96:	83 c4 10             	add    $0x10,%esp
+  800e99:	85 c0                	test   %eax,%eax
+  800e9b:	78 4e                	js     800eeb <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800e9d:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800ea3:	77 56                	ja     800efb <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  800ea5:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800ea8:	85 c0                	test   %eax,%eax
+  800eaa:	75 20                	jne    800ecc <devfile_write+0x85>
+  800eac:	eb 16                	jmp    800ec4 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  800eae:	89 f1                	mov    %esi,%ecx
+  800eb0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800eb3:	89 d8                	mov    %ebx,%eax
+  800eb5:	e8 87 fe ff ff       	call   800d41 <file_write_direct>
+  800eba:	eb 2f                	jmp    800eeb <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800ebc:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800ec2:	77 37                	ja     800efb <devfile_write+0xb4>
+		ff->buf_base = pos;
+  800ec4:	89 7b 14             	mov    %edi,0x14(%ebx)
+  800ec7:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  800ecc:	83 ec 04             	sub    $0x4,%esp
+  800ecf:	56                   	push   %esi
+  800ed0:	ff 75 0c             	push   0xc(%ebp)
+  800ed3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800ed6:	01 c1                	add    %eax,%ecx
+  800ed8:	51                   	push   %ecx
+  800ed9:	e8 a1 1e 00 00       	call   802d7f <memmove>
+	ff->buf_wlen += n;
+  800ede:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  800ee1:	01 f7                	add    %esi,%edi
+  800ee3:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  800ee6:	89 f0                	mov    %esi,%eax
+  800ee8:	83 c4 10             	add    $0x10,%esp
+}
+  800eeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eee:	5b                   	pop    %ebx
+  800eef:	5e                   	pop    %esi
+  800ef0:	5f                   	pop    %edi
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  800ef3:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800ef9:	76 d1                	jbe    800ecc <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  800efb:	89 f1                	mov    %esi,%ecx
+  800efd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f00:	89 d8                	mov    %ebx,%eax
+  800f02:	e8 3a fe ff ff       	call   800d41 <file_write_direct>
+  800f07:	eb e2                	jmp    800eeb <devfile_write+0xa4>
+
+00800f09 <devfile_trunc>:
+{
+  800f09:	55                   	push   %ebp
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	53                   	push   %ebx
+  800f0d:	83 ec 10             	sub    $0x10,%esp
+  800f10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  800f13:	53                   	push   %ebx
+  800f14:	e8 b5 fe ff ff       	call   800dce <devfile_sync>
+  800f19:	83 c4 10             	add    $0x10,%esp
+  800f1c:	85 c0                	test   %eax,%eax
+  800f1e:	78 1f                	js     800f3f <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800f20:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f23:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800f28:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f2b:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800f30:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f35:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f3a:	e8 eb fd ff ff       	call   800d2a <fsipc>
+}
+  800f3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f42:	c9                   	leave
+  800f43:	c3                   	ret
+
+00800f44 <devfile_stat>:
+{
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	56                   	push   %esi
+  800f48:	53                   	push   %ebx
+  800f49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800f4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  800f4f:	83 ec 0c             	sub    $0xc,%esp
+  800f52:	53                   	push   %ebx
+  800f53:	e8 76 fe ff ff       	call   800dce <devfile_sync>
+  800f58:	83 c4 10             	add    $0x10,%esp
+  800f5b:	85 c0                	test   %eax,%eax
+  800f5d:	78 47                	js     800fa6 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800f5f:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f62:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800f67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f71:	e8 b4 fd ff ff       	call   800d2a <fsipc>
+  800f76:	85 c0                	test   %eax,%eax
+  800f78:	78 2c                	js     800fa6 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f7a:	83 ec 08             	sub    $0x8,%esp
+  800f7d:	68 00 60 80 00       	push   $0x806000
+  800f82:	56                   	push   %esi
+  800f83:	e8 71 1c 00 00       	call   802bf9 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800f88:	a1 80 60 80 00       	mov    0x806080,%eax
+  800f8d:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800f93:	a1 84 60 80 00       	mov    0x806084,%eax
+  800f98:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  800f9e:	83 c4 10             	add    $0x10,%esp
+  800fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fa6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fa9:	5b                   	pop    %ebx
+  800faa:	5e                   	pop    %esi
+  800fab:	5d                   	pop    %ebp
+  800fac:	c3                   	ret
+
+00800fad <devfile_flush>:
+{
+  800fad:	55                   	push   %ebp
+  800fae:	89 e5                	mov    %esp,%ebp
+  800fb0:	56                   	push   %esi
+  800fb1:	53                   	push   %ebx
+  800fb2:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  800fb5:	83 ec 0c             	sub    $0xc,%esp
+  800fb8:	56                   	push   %esi
+  800fb9:	e8 10 fe ff ff       	call   800dce <devfile_sync>
+  800fbe:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  800fc0:	83 c4 10             	add    $0x10,%esp
+  800fc3:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  800fc7:	75 25                	jne    800fee <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800fc9:	8b 46 0c             	mov    0xc(%esi),%eax
+  800fcc:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  800fd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd6:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fdb:	e8 4a fd ff ff       	call   800d2a <fsipc>
+  800fe0:	85 c0                	test   %eax,%eax
+  800fe2:	0f 45 d8             	cmovne %eax,%ebx
+}
+  800fe5:	89 d8                	mov    %ebx,%eax
+  800fe7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fea:	5b                   	pop    %ebx
+  800feb:	5e                   	pop    %esi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  800fee:	83 ec 0c             	sub    $0xc,%esp
+  800ff1:	56                   	push   %esi
+  800ff2:	e8 8e f5 ff ff       	call   800585 <fd2data>
+  800ff7:	83 c4 08             	add    $0x8,%esp
+  800ffa:	50                   	push   %eax
+  800ffb:	6a 00                	push   $0x0
+  800ffd:	e8 ff f1 ff ff       	call   800201 <sys_page_unmap>
+  801002:	83 c4 10             	add    $0x10,%esp
+  801005:	eb c2                	jmp    800fc9 <devfile_flush+0x1c>
+
+00801007 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801007:	55                   	push   %ebp
+  801008:	89 e5                	mov    %esp,%ebp
+  80100a:	57                   	push   %edi
+  80100b:	56                   	push   %esi
+  80100c:	53                   	push   %ebx
+  80100d:	83 ec 64             	sub    $0x64,%esp
+  801010:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801012:	52                   	push   %edx
+  801013:	50                   	push   %eax
+  801014:	e8 d9 f5 ff ff       	call   8005f2 <fd_lookup>
+  801019:	89 c1                	mov    %eax,%ecx
+  80101b:	83 c4 10             	add    $0x10,%esp
+  80101e:	85 c0                	test   %eax,%eax
+  801020:	0f 88 f2 00 00 00    	js     801118 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801026:	8b 07                	mov    (%edi),%eax
+  801028:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80102e:	39 10                	cmp    %edx,(%eax)
+  801030:	0f 85 03 01 00 00    	jne    801139 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801036:	a1 00 50 80 00       	mov    0x805000,%eax
+  80103b:	8b 40 48             	mov    0x48(%eax),%eax
+  80103e:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801044:	0f 84 96 00 00 00    	je     8010e0 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  80104a:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801051:	0f 84 cb 00 00 00    	je     801122 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801057:	b8 00 60 80 00       	mov    $0x806000,%eax
+  80105c:	83 c8 07             	or     $0x7,%eax
+  80105f:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801062:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801065:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  80106a:	83 ec 04             	sub    $0x4,%esp
+  80106d:	68 07 04 00 00       	push   $0x407
+  801072:	53                   	push   %ebx
+  801073:	6a 00                	push   $0x0
+  801075:	e8 fa f0 ff ff       	call   800174 <sys_page_alloc>
+  80107a:	89 c1                	mov    %eax,%ecx
+  80107c:	83 c4 10             	add    $0x10,%esp
+  80107f:	85 c0                	test   %eax,%eax
+  801081:	0f 88 91 00 00 00    	js     801118 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801087:	89 d8                	mov    %ebx,%eax
+  801089:	83 c8 07             	or     $0x7,%eax
+  80108c:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  80108e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801094:	83 c6 04             	add    $0x4,%esi
+  801097:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  80109d:	75 cb                	jne    80106a <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  80109f:	6a 12                	push   $0x12
+  8010a1:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8010a4:	50                   	push   %eax
+  8010a5:	6a 0c                	push   $0xc
+  8010a7:	ff 35 c8 70 80 00    	push   0x8070c8
+  8010ad:	e8 e2 22 00 00       	call   803394 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8010b2:	83 c4 0c             	add    $0xc,%esp
+  8010b5:	6a 00                	push   $0x0
+  8010b7:	6a 00                	push   $0x0
+  8010b9:	6a 00                	push   $0x0
+  8010bb:	e8 7e 21 00 00       	call   80323e <ipc_recv>
+  8010c0:	89 c1                	mov    %eax,%ecx
+  8010c2:	83 c4 10             	add    $0x10,%esp
+  8010c5:	85 c0                	test   %eax,%eax
+  8010c7:	78 4f                	js     801118 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  8010c9:	a1 00 50 80 00       	mov    0x805000,%eax
+  8010ce:	8b 40 48             	mov    0x48(%eax),%eax
+  8010d1:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  8010d6:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  8010dd:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  8010e0:	83 ec 0c             	sub    $0xc,%esp
+  8010e3:	ff 37                	push   (%edi)
+  8010e5:	e8 e4 fc ff ff       	call   800dce <devfile_sync>
+  8010ea:	89 c1                	mov    %eax,%ecx
+  8010ec:	83 c4 10             	add    $0x10,%esp
+  8010ef:	85 c0                	test   %eax,%eax
+  8010f1:	78 25                	js     801118 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  8010f3:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  8010f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  8010fe:	ba 01 00 00 00       	mov    $0x1,%edx
+  801103:	89 d0                	mov    %edx,%eax
+  801105:	d3 e0                	shl    %cl,%eax
+  801107:	85 d8                	test   %ebx,%eax
+  801109:	74 0d                	je     801118 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  80110b:	83 c1 01             	add    $0x1,%ecx
+  80110e:	83 f9 10             	cmp    $0x10,%ecx
+  801111:	75 f0                	jne    801103 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801113:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801118:	89 c8                	mov    %ecx,%eax
+  80111a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111d:	5b                   	pop    %ebx
+  80111e:	5e                   	pop    %esi
+  80111f:	5f                   	pop    %edi
+  801120:	5d                   	pop    %ebp
+  801121:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801122:	83 ec 0c             	sub    $0xc,%esp
+  801125:	6a 01                	push   $0x1
+  801127:	e8 b6 22 00 00       	call   8033e2 <ipc_find_env>
+  80112c:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801131:	83 c4 10             	add    $0x10,%esp
+  801134:	e9 1e ff ff ff       	jmp    801057 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801139:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  80113e:	eb d8                	jmp    801118 <fsring_slot+0x111>
+
+00801140 <file_read_direct>:
+{
+  801140:	55                   	push   %ebp
+  801141:	89 e5                	mov    %esp,%ebp
+  801143:	57                   	push   %edi
+  801144:	56                   	push   %esi
+  801145:	53                   	push   %ebx
+  801146:	83 ec 1c             	sub    $0x1c,%esp
+  801149:	89 c7                	mov    %eax,%edi
+  80114b:	89 d6                	mov    %edx,%esi
+  80114d:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  80114f:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801155:	77 52                	ja     8011a9 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801157:	8b 40 0c             	mov    0xc(%eax),%eax
+  80115a:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  80115f:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801165:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80116f:	e8 b6 fb ff ff       	call   800d2a <fsipc>
+  801174:	89 c7                	mov    %eax,%edi
+  801176:	85 c0                	test   %eax,%eax
+  801178:	78 25                	js     80119f <file_read_direct+0x5f>
+	assert(r <= n);
+  80117a:	39 c3                	cmp    %eax,%ebx
+  80117c:	0f 82 87 00 00 00    	jb     801209 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801182:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801187:	0f 8f 95 00 00 00    	jg     801222 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80118d:	83 ec 04             	sub    $0x4,%esp
+  801190:	50                   	push   %eax
+  801191:	68 00 60 80 00       	push   $0x806000
+  801196:	56                   	push   %esi
+  801197:	e8 e3 1b 00 00       	call   802d7f <memmove>
+	return r;
+  80119c:	83 c4 10             	add    $0x10,%esp
+}
+  80119f:	89 f8                	mov    %edi,%eax
+  8011a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a4:	5b                   	pop    %ebx
+  8011a5:	5e                   	pop    %esi
+  8011a6:	5f                   	pop    %edi
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8011a9:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8011af:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8011b4:	29 d1                	sub    %edx,%ecx
+  8011b6:	39 d9                	cmp    %ebx,%ecx
+  8011b8:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011bb:	89 f0                	mov    %esi,%eax
+  8011bd:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8011c0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8011c3:	eb 0f                	jmp    8011d4 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8011c5:	0f b6 10             	movzbl (%eax),%edx
+  8011c8:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011ca:	05 00 10 00 00       	add    $0x1000,%eax
+  8011cf:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011d4:	39 c8                	cmp    %ecx,%eax
+  8011d6:	72 ed                	jb     8011c5 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  8011d8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8011db:	8b 47 0c             	mov    0xc(%edi),%eax
+  8011de:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  8011e3:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8011e9:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  8011ef:	83 ec 0c             	sub    $0xc,%esp
+  8011f2:	6a 07                	push   $0x7
+  8011f4:	89 d9                	mov    %ebx,%ecx
+  8011f6:	89 f2                	mov    %esi,%edx
+  8011f8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011fd:	e8 86 f9 ff ff       	call   800b88 <fsipc_pages>
+  801202:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801204:	83 c4 10             	add    $0x10,%esp
+  801207:	eb 96                	jmp    80119f <file_read_direct+0x5f>
+	assert(r <= n);
+  801209:	68 44 38 80 00       	push   $0x803844
+  80120e:	68 24 38 80 00       	push   $0x803824
+  801213:	68 dc 00 00 00       	push   $0xdc
+  801218:	68 39 38 80 00       	push   $0x803839
+  80121d:	e8 0e 13 00 00       	call   802530 <_panic>
+	assert(r <= PGSIZE);
+  801222:	68 55 38 80 00       	push   $0x803855
+  801227:	68 24 38 80 00       	push   $0x803824
+  80122c:	68 dd 00 00 00       	push   $0xdd
+  801231:	68 39 38 80 00       	push   $0x803839
+  801236:	e8 f5 12 00 00       	call   802530 <_panic>
+
+0080123b <devfile_read>:
+{
+  80123b:	55                   	push   %ebp
+  80123c:	89 e5                	mov    %esp,%ebp
+  80123e:	57                   	push   %edi
+  80123f:	56                   	push   %esi
+  801240:	53                   	push   %ebx
+  801241:	83 ec 28             	sub    $0x28,%esp
+  801244:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801247:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80124a:	53                   	push   %ebx
+  80124b:	e8 35 f3 ff ff       	call   800585 <fd2data>
+  801250:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801253:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801256:	83 c4 10             	add    $0x10,%esp
+  801259:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  80125d:	74 7d                	je     8012dc <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80125f:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801263:	0f 85 81 00 00 00    	jne    8012ea <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801269:	8b 43 18             	mov    0x18(%ebx),%eax
+  80126c:	85 c0                	test   %eax,%eax
+  80126e:	74 0d                	je     80127d <devfile_read+0x42>
+  801270:	8b 53 14             	mov    0x14(%ebx),%edx
+  801273:	39 fa                	cmp    %edi,%edx
+  801275:	7f 06                	jg     80127d <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801277:	01 c2                	add    %eax,%edx
+  801279:	39 d7                	cmp    %edx,%edi
+  80127b:	72 28                	jb     8012a5 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  80127d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801284:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80128a:	77 74                	ja     801300 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  80128c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801291:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801294:	89 d8                	mov    %ebx,%eax
+  801296:	e8 a5 fe ff ff       	call   801140 <file_read_direct>
+  80129b:	85 c0                	test   %eax,%eax
+  80129d:	7e 35                	jle    8012d4 <devfile_read+0x99>
+		ff->buf_base = pos;
+  80129f:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8012a2:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8012a5:	8b 53 14             	mov    0x14(%ebx),%edx
+  8012a8:	89 d0                	mov    %edx,%eax
+  8012aa:	03 43 18             	add    0x18(%ebx),%eax
+  8012ad:	29 f8                	sub    %edi,%eax
+  8012af:	39 f0                	cmp    %esi,%eax
+  8012b1:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8012b4:	83 ec 04             	sub    $0x4,%esp
+  8012b7:	56                   	push   %esi
+  8012b8:	89 f8                	mov    %edi,%eax
+  8012ba:	29 d0                	sub    %edx,%eax
+  8012bc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8012bf:	01 c1                	add    %eax,%ecx
+  8012c1:	51                   	push   %ecx
+  8012c2:	ff 75 0c             	push   0xc(%ebp)
+  8012c5:	e8 b5 1a 00 00       	call   802d7f <memmove>
+	fd->fd_offset = pos + n;
+  8012ca:	01 f7                	add    %esi,%edi
+  8012cc:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8012cf:	89 f0                	mov    %esi,%eax
+  8012d1:	83 c4 10             	add    $0x10,%esp
+}
+  8012d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d7:	5b                   	pop    %ebx
+  8012d8:	5e                   	pop    %esi
+  8012d9:	5f                   	pop    %edi
+  8012da:	5d                   	pop    %ebp
+  8012db:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  8012dc:	89 f1                	mov    %esi,%ecx
+  8012de:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012e1:	89 d8                	mov    %ebx,%eax
+  8012e3:	e8 58 fe ff ff       	call   801140 <file_read_direct>
+  8012e8:	eb ea                	jmp    8012d4 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8012ea:	83 ec 0c             	sub    $0xc,%esp
+  8012ed:	53                   	push   %ebx
+  8012ee:	e8 db fa ff ff       	call   800dce <devfile_sync>
+  8012f3:	83 c4 10             	add    $0x10,%esp
+  8012f6:	85 c0                	test   %eax,%eax
+  8012f8:	0f 89 6b ff ff ff    	jns    801269 <devfile_read+0x2e>
+  8012fe:	eb d4                	jmp    8012d4 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801300:	89 f1                	mov    %esi,%ecx
+  801302:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801305:	89 d8                	mov    %ebx,%eax
+  801307:	e8 34 fe ff ff       	call   801140 <file_read_direct>
+  80130c:	eb c6                	jmp    8012d4 <devfile_read+0x99>
+
+0080130e <open>:
+{
+  80130e:	55                   	push   %ebp
+  80130f:	89 e5                	mov    %esp,%ebp
+  801311:	56                   	push   %esi
+  801312:	53                   	push   %ebx
+  801313:	83 ec 1c             	sub    $0x1c,%esp
+  801316:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801319:	56                   	push   %esi
+  80131a:	e8 9f 18 00 00       	call   802bbe <strlen>
+  80131f:	83 c4 10             	add    $0x10,%esp
+  801322:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801327:	0f 8f a0 00 00 00    	jg     8013cd <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  80132d:	83 ec 0c             	sub    $0xc,%esp
+  801330:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801333:	50                   	push   %eax
+  801334:	e8 63 f2 ff ff       	call   80059c <fd_alloc>
+  801339:	89 c3                	mov    %eax,%ebx
+  80133b:	83 c4 10             	add    $0x10,%esp
+  80133e:	85 c0                	test   %eax,%eax
+  801340:	78 45                	js     801387 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801342:	83 ec 08             	sub    $0x8,%esp
+  801345:	56                   	push   %esi
+  801346:	68 00 60 80 00       	push   $0x806000
+  80134b:	e8 a9 18 00 00       	call   802bf9 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801350:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801353:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801358:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80135b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801360:	e8 c5 f9 ff ff       	call   800d2a <fsipc>
+  801365:	89 c3                	mov    %eax,%ebx
+  801367:	83 c4 10             	add    $0x10,%esp
+  80136a:	85 c0                	test   %eax,%eax
+  80136c:	78 22                	js     801390 <open+0x82>
+	if (!(mode & O_NOBUF)
+  80136e:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801375:	74 2b                	je     8013a2 <open+0x94>
+	return fd2num(fd);
+  801377:	83 ec 0c             	sub    $0xc,%esp
+  80137a:	ff 75 f4             	push   -0xc(%ebp)
+  80137d:	e8 f3 f1 ff ff       	call   800575 <fd2num>
+  801382:	89 c3                	mov    %eax,%ebx
+  801384:	83 c4 10             	add    $0x10,%esp
+}
+  801387:	89 d8                	mov    %ebx,%eax
+  801389:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80138c:	5b                   	pop    %ebx
+  80138d:	5e                   	pop    %esi
+  80138e:	5d                   	pop    %ebp
+  80138f:	c3                   	ret
+		fd_close(fd, 0);
+  801390:	83 ec 08             	sub    $0x8,%esp
+  801393:	6a 00                	push   $0x0
+  801395:	ff 75 f4             	push   -0xc(%ebp)
+  801398:	e8 f8 f2 ff ff       	call   800695 <fd_close>
+		return r;
+  80139d:	83 c4 10             	add    $0x10,%esp
+  8013a0:	eb e5                	jmp    801387 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8013a2:	83 ec 0c             	sub    $0xc,%esp
+  8013a5:	ff 75 f4             	push   -0xc(%ebp)
+  8013a8:	e8 d8 f1 ff ff       	call   800585 <fd2data>
+  8013ad:	83 c4 0c             	add    $0xc,%esp
+  8013b0:	68 07 04 00 00       	push   $0x407
+  8013b5:	50                   	push   %eax
+  8013b6:	6a 00                	push   $0x0
+  8013b8:	e8 b7 ed ff ff       	call   800174 <sys_page_alloc>
+  8013bd:	83 c4 10             	add    $0x10,%esp
+  8013c0:	85 c0                	test   %eax,%eax
+  8013c2:	75 b3                	jne    801377 <open+0x69>
+		fd->fd_file.buffered = 1;
+  8013c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013c7:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8013cb:	eb aa                	jmp    801377 <open+0x69>
+		return -E_BAD_PATH;
+  8013cd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8013d2:	eb b3                	jmp    801387 <open+0x79>
+
+008013d4 <readdir>:
+{
+  8013d4:	55                   	push   %ebp
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	53                   	push   %ebx
+  8013d8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013de:	50                   	push   %eax
+  8013df:	ff 75 08             	push   0x8(%ebp)
+  8013e2:	e8 0b f2 ff ff       	call   8005f2 <fd_lookup>
+  8013e7:	89 c3                	mov    %eax,%ebx
+  8013e9:	83 c4 10             	add    $0x10,%esp
+  8013ec:	85 c0                	test   %eax,%eax
+  8013ee:	78 73                	js     801463 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8013f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013f3:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8013f9:	39 08                	cmp    %ecx,(%eax)
+  8013fb:	0f 85 82 00 00 00    	jne    801483 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801401:	83 ec 0c             	sub    $0xc,%esp
+  801404:	50                   	push   %eax
+  801405:	e8 c4 f9 ff ff       	call   800dce <devfile_sync>
+  80140a:	89 c3                	mov    %eax,%ebx
+  80140c:	83 c4 10             	add    $0x10,%esp
+  80140f:	85 c0                	test   %eax,%eax
+  801411:	78 50                	js     801463 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801413:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801416:	8b 40 0c             	mov    0xc(%eax),%eax
+  801419:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  80141e:	8b 45 10             	mov    0x10(%ebp),%eax
+  801421:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801426:	8b 45 14             	mov    0x14(%ebp),%eax
+  801429:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  80142e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801433:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801438:	e8 ed f8 ff ff       	call   800d2a <fsipc>
+  80143d:	89 c3                	mov    %eax,%ebx
+  80143f:	85 c0                	test   %eax,%eax
+  801441:	7e 20                	jle    801463 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801443:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801446:	72 22                	jb     80146a <readdir+0x96>
+  801448:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80144d:	7f 1b                	jg     80146a <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80144f:	83 ec 04             	sub    $0x4,%esp
+  801452:	50                   	push   %eax
+  801453:	68 00 60 80 00       	push   $0x806000
+  801458:	ff 75 0c             	push   0xc(%ebp)
+  80145b:	e8 1f 19 00 00       	call   802d7f <memmove>
+	return r;
+  801460:	83 c4 10             	add    $0x10,%esp
+}
+  801463:	89 d8                	mov    %ebx,%eax
+  801465:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801468:	c9                   	leave
+  801469:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  80146a:	68 4b 38 80 00       	push   $0x80384b
+  80146f:	68 24 38 80 00       	push   $0x803824
+  801474:	68 86 01 00 00       	push   $0x186
+  801479:	68 39 38 80 00       	push   $0x803839
+  80147e:	e8 ad 10 00 00       	call   802530 <_panic>
+		return -E_NOT_SUPP;
+  801483:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801488:	eb d9                	jmp    801463 <readdir+0x8f>
+
+0080148a <munmap>:
+{
+  80148a:	55                   	push   %ebp
+  80148b:	89 e5                	mov    %esp,%ebp
+  80148d:	56                   	push   %esi
+  80148e:	53                   	push   %ebx
+  80148f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801492:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801495:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  80149b:	75 41                	jne    8014de <munmap+0x54>
+  80149d:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8014a3:	77 39                	ja     8014de <munmap+0x54>
+  8014a5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8014aa:	29 f0                	sub    %esi,%eax
+  8014ac:	39 d0                	cmp    %edx,%eax
+  8014ae:	72 35                	jb     8014e5 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014b0:	89 f3                	mov    %esi,%ebx
+  8014b2:	01 d6                	add    %edx,%esi
+  8014b4:	39 f3                	cmp    %esi,%ebx
+  8014b6:	73 1a                	jae    8014d2 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8014b8:	83 ec 08             	sub    $0x8,%esp
+  8014bb:	53                   	push   %ebx
+  8014bc:	6a 00                	push   $0x0
+  8014be:	e8 3e ed ff ff       	call   800201 <sys_page_unmap>
+  8014c3:	83 c4 10             	add    $0x10,%esp
+  8014c6:	85 c0                	test   %eax,%eax
+  8014c8:	78 0d                	js     8014d7 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014ca:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8014d0:	eb e2                	jmp    8014b4 <munmap+0x2a>
+	return 0;
+  8014d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014da:	5b                   	pop    %ebx
+  8014db:	5e                   	pop    %esi
+  8014dc:	5d                   	pop    %ebp
+  8014dd:	c3                   	ret
+		return -E_INVAL;
+  8014de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014e3:	eb f2                	jmp    8014d7 <munmap+0x4d>
+  8014e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014ea:	eb eb                	jmp    8014d7 <munmap+0x4d>
+
+008014ec <mmap>:
+{
+  8014ec:	55                   	push   %ebp
+  8014ed:	89 e5                	mov    %esp,%ebp
+  8014ef:	57                   	push   %edi
+  8014f0:	56                   	push   %esi
+  8014f1:	53                   	push   %ebx
+  8014f2:	83 ec 34             	sub    $0x34,%esp
+  8014f5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014f8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014fb:	50                   	push   %eax
+  8014fc:	ff 75 18             	push   0x18(%ebp)
+  8014ff:	e8 ee f0 ff ff       	call   8005f2 <fd_lookup>
+  801504:	89 c3                	mov    %eax,%ebx
+  801506:	83 c4 10             	add    $0x10,%esp
+  801509:	85 c0                	test   %eax,%eax
+  80150b:	0f 88 0e 01 00 00    	js     80161f <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801511:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801514:	a1 20 40 80 00       	mov    0x804020,%eax
+  801519:	39 02                	cmp    %eax,(%edx)
+  80151b:	0f 85 50 01 00 00    	jne    801671 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801521:	8b 45 10             	mov    0x10(%ebp),%eax
+  801524:	83 e0 02             	and    $0x2,%eax
+  801527:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80152a:	74 0a                	je     801536 <mmap+0x4a>
+  80152c:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801530:	0f 84 42 01 00 00    	je     801678 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801536:	8b 42 08             	mov    0x8(%edx),%eax
+  801539:	83 e0 03             	and    $0x3,%eax
+  80153c:	83 f8 01             	cmp    $0x1,%eax
+  80153f:	0f 84 3a 01 00 00    	je     80167f <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  801545:	8b 45 08             	mov    0x8(%ebp),%eax
+  801548:	0b 45 1c             	or     0x1c(%ebp),%eax
+  80154b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801550:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801553:	0f 85 2d 01 00 00    	jne    801686 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801559:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80155d:	0f 88 2a 01 00 00    	js     80168d <mmap+0x1a1>
+  801563:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80156a:	0f 87 1d 01 00 00    	ja     80168d <mmap+0x1a1>
+  801570:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801575:	2b 45 08             	sub    0x8(%ebp),%eax
+  801578:	39 f8                	cmp    %edi,%eax
+  80157a:	0f 82 14 01 00 00    	jb     801694 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  801580:	83 ec 0c             	sub    $0xc,%esp
+  801583:	52                   	push   %edx
+  801584:	e8 45 f8 ff ff       	call   800dce <devfile_sync>
+  801589:	89 c3                	mov    %eax,%ebx
+  80158b:	83 c4 10             	add    $0x10,%esp
+  80158e:	85 c0                	test   %eax,%eax
+  801590:	0f 88 89 00 00 00    	js     80161f <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  801596:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  80159c:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8015a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a7:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8015aa:	39 fe                	cmp    %edi,%esi
+  8015ac:	73 7b                	jae    801629 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8015ae:	89 f8                	mov    %edi,%eax
+  8015b0:	29 f0                	sub    %esi,%eax
+  8015b2:	c1 e8 0c             	shr    $0xc,%eax
+  8015b5:	ba 40 00 00 00       	mov    $0x40,%edx
+  8015ba:	39 d0                	cmp    %edx,%eax
+  8015bc:	0f 47 c2             	cmova  %edx,%eax
+  8015bf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8015c2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015c5:	8b 52 0c             	mov    0xc(%edx),%edx
+  8015c8:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  8015ce:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8015d1:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  8015d7:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8015dc:	89 f2                	mov    %esi,%edx
+  8015de:	03 55 08             	add    0x8(%ebp),%edx
+  8015e1:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8015e4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015e9:	e8 ea f6 ff ff       	call   800cd8 <fsipcv>
+  8015ee:	85 c0                	test   %eax,%eax
+  8015f0:	7e 12                	jle    801604 <mmap+0x118>
+  8015f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015f5:	85 c0                	test   %eax,%eax
+  8015f7:	0f 84 9e 00 00 00    	je     80169b <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8015fd:	c1 e0 0c             	shl    $0xc,%eax
+  801600:	01 c6                	add    %eax,%esi
+  801602:	eb a6                	jmp    8015aa <mmap+0xbe>
+			munmap(addr, done);
+  801604:	89 c3                	mov    %eax,%ebx
+  801606:	83 ec 08             	sub    $0x8,%esp
+  801609:	56                   	push   %esi
+  80160a:	ff 75 08             	push   0x8(%ebp)
+  80160d:	e8 78 fe ff ff       	call   80148a <munmap>
+			return r < 0 ? r : -E_INVAL;
+  801612:	83 c4 10             	add    $0x10,%esp
+  801615:	85 db                	test   %ebx,%ebx
+  801617:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80161c:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80161f:	89 d8                	mov    %ebx,%eax
+  801621:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801624:	5b                   	pop    %ebx
+  801625:	5e                   	pop    %esi
+  801626:	5f                   	pop    %edi
+  801627:	5d                   	pop    %ebp
+  801628:	c3                   	ret
+	if (prot & PROT_WRITE)
+  801629:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80162c:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80162e:	85 c0                	test   %eax,%eax
+  801630:	74 ed                	je     80161f <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  801632:	be 00 00 00 00       	mov    $0x0,%esi
+  801637:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80163a:	39 fe                	cmp    %edi,%esi
+  80163c:	73 2e                	jae    80166c <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80163e:	83 ec 0c             	sub    $0xc,%esp
+  801641:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  801644:	50                   	push   %eax
+  801645:	e8 f6 19 00 00       	call   803040 <cowpage>
+  80164a:	83 c4 10             	add    $0x10,%esp
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	78 08                	js     801659 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  801651:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801657:	eb e1                	jmp    80163a <mmap+0x14e>
+				munmap(addr, len);
+  801659:	89 c3                	mov    %eax,%ebx
+  80165b:	83 ec 08             	sub    $0x8,%esp
+  80165e:	57                   	push   %edi
+  80165f:	ff 75 08             	push   0x8(%ebp)
+  801662:	e8 23 fe ff ff       	call   80148a <munmap>
+				return r;
+  801667:	83 c4 10             	add    $0x10,%esp
+  80166a:	eb b3                	jmp    80161f <mmap+0x133>
+	return 0;
+  80166c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80166f:	eb ae                	jmp    80161f <mmap+0x133>
+		return -E_NOT_SUPP;
+  801671:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801676:	eb a7                	jmp    80161f <mmap+0x133>
+		return -E_NOT_SUPP;
+  801678:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80167d:	eb a0                	jmp    80161f <mmap+0x133>
+		return -E_INVAL;
+  80167f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801684:	eb 99                	jmp    80161f <mmap+0x133>
+  801686:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80168b:	eb 92                	jmp    80161f <mmap+0x133>
+  80168d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801692:	eb 8b                	jmp    80161f <mmap+0x133>
+  801694:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801699:	eb 84                	jmp    80161f <mmap+0x133>
+			munmap(addr, done);
+  80169b:	83 ec 08             	sub    $0x8,%esp
+  80169e:	56                   	push   %esi
+  80169f:	ff 75 08             	push   0x8(%ebp)
+  8016a2:	e8 e3 fd ff ff       	call   80148a <munmap>
+  8016a7:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8016aa:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016af:	e9 6b ff ff ff       	jmp    80161f <mmap+0x133>
+
+008016b4 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8016b4:	55                   	push   %ebp
+  8016b5:	89 e5                	mov    %esp,%ebp
+  8016b7:	56                   	push   %esi
+  8016b8:	53                   	push   %ebx
+  8016b9:	83 ec 10             	sub    $0x10,%esp
+  8016bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8016bf:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016c5:	e8 3d f9 ff ff       	call   801007 <fsring_slot>
+  8016ca:	85 c0                	test   %eax,%eax
+  8016cc:	78 60                	js     80172e <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8016ce:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8016d1:	8b 56 08             	mov    0x8(%esi),%edx
+  8016d4:	83 e2 03             	and    $0x3,%edx
+  8016d7:	83 fa 01             	cmp    $0x1,%edx
+  8016da:	74 59                	je     801735 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8016dc:	ba 01 00 00 00       	mov    $0x1,%edx
+  8016e1:	89 c1                	mov    %eax,%ecx
+  8016e3:	d3 e2                	shl    %cl,%edx
+  8016e5:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8016eb:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8016ee:	c1 e2 02             	shl    $0x2,%edx
+  8016f1:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8016f7:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  8016fe:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  801701:	8b 55 18             	mov    0x18(%ebp),%edx
+  801704:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  801707:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80170a:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80170d:	83 ec 08             	sub    $0x8,%esp
+  801710:	50                   	push   %eax
+  801711:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801716:	39 c3                	cmp    %eax,%ebx
+  801718:	0f 47 d8             	cmova  %eax,%ebx
+  80171b:	53                   	push   %ebx
+  80171c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80171f:	89 f2                	mov    %esi,%edx
+  801721:	b8 03 00 00 00       	mov    $0x3,%eax
+  801726:	e8 1e f5 ff ff       	call   800c49 <fsring_post>
+  80172b:	83 c4 10             	add    $0x10,%esp
+}
+  80172e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801731:	5b                   	pop    %ebx
+  801732:	5e                   	pop    %esi
+  801733:	5d                   	pop    %ebp
+  801734:	c3                   	ret
+		return -E_INVAL;
+  801735:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80173a:	eb f2                	jmp    80172e <fsring_read+0x7a>
+
+0080173c <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80173c:	55                   	push   %ebp
+  80173d:	89 e5                	mov    %esp,%ebp
+  80173f:	56                   	push   %esi
+  801740:	53                   	push   %ebx
+  801741:	83 ec 10             	sub    $0x10,%esp
+  801744:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  801747:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80174a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80174d:	e8 b5 f8 ff ff       	call   801007 <fsring_slot>
+  801752:	89 c3                	mov    %eax,%ebx
+  801754:	85 c0                	test   %eax,%eax
+  801756:	78 77                	js     8017cf <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801758:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80175b:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80175f:	74 77                	je     8017d8 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  801761:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801766:	39 c6                	cmp    %eax,%esi
+  801768:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80176b:	83 ec 04             	sub    $0x4,%esp
+  80176e:	56                   	push   %esi
+  80176f:	ff 75 0c             	push   0xc(%ebp)
+  801772:	89 d8                	mov    %ebx,%eax
+  801774:	c1 e0 0c             	shl    $0xc,%eax
+  801777:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80177d:	50                   	push   %eax
+  80177e:	e8 fc 15 00 00       	call   802d7f <memmove>
+	fsring_busy |= 1 << slot;
+  801783:	b8 01 00 00 00       	mov    $0x1,%eax
+  801788:	89 d9                	mov    %ebx,%ecx
+  80178a:	d3 e0                	shl    %cl,%eax
+  80178c:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  801792:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801795:	c1 e0 02             	shl    $0x2,%eax
+  801798:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  80179e:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8017a5:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8017a8:	8b 45 18             	mov    0x18(%ebp),%eax
+  8017ab:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8017ae:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8017b5:	83 c4 08             	add    $0x8,%esp
+  8017b8:	53                   	push   %ebx
+  8017b9:	56                   	push   %esi
+  8017ba:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8017bd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8017c0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017c5:	e8 7f f4 ff ff       	call   800c49 <fsring_post>
+  8017ca:	89 c3                	mov    %eax,%ebx
+  8017cc:	83 c4 10             	add    $0x10,%esp
+}
+  8017cf:	89 d8                	mov    %ebx,%eax
+  8017d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017d4:	5b                   	pop    %ebx
+  8017d5:	5e                   	pop    %esi
+  8017d6:	5d                   	pop    %ebp
+  8017d7:	c3                   	ret
+		return -E_INVAL;
+  8017d8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8017dd:	eb f0                	jmp    8017cf <fsring_write+0x93>
+
+008017df <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8017df:	55                   	push   %ebp
+  8017e0:	89 e5                	mov    %esp,%ebp
+  8017e2:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8017e5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8017e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017eb:	e8 17 f8 ff ff       	call   801007 <fsring_slot>
+  8017f0:	85 c0                	test   %eax,%eax
+  8017f2:	78 4c                	js     801840 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8017f4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8017f9:	89 c1                	mov    %eax,%ecx
+  8017fb:	d3 e2                	shl    %cl,%edx
+  8017fd:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  801803:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  801806:	c1 e2 02             	shl    $0x2,%edx
+  801809:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  80180f:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  801816:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  801819:	8b 55 10             	mov    0x10(%ebp),%edx
+  80181c:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80181f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801822:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  801825:	83 ec 08             	sub    $0x8,%esp
+  801828:	50                   	push   %eax
+  801829:	6a 00                	push   $0x0
+  80182b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801830:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801833:	b8 05 00 00 00       	mov    $0x5,%eax
+  801838:	e8 0c f4 ff ff       	call   800c49 <fsring_post>
+  80183d:	83 c4 10             	add    $0x10,%esp
+}
+  801840:	c9                   	leave
+  801841:	c3                   	ret
+
+00801842 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  801842:	55                   	push   %ebp
+  801843:	89 e5                	mov    %esp,%ebp
+  801845:	57                   	push   %edi
+  801846:	56                   	push   %esi
+  801847:	53                   	push   %ebx
+  801848:	83 ec 1c             	sub    $0x1c,%esp
+  80184b:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80184f:	a1 00 50 80 00       	mov    0x805000,%eax
+  801854:	8b 40 48             	mov    0x48(%eax),%eax
+  801857:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  80185d:	74 12                	je     801871 <fsring_reap+0x2f>
+		return 0;
+  80185f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  801864:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801867:	5b                   	pop    %ebx
+  801868:	5e                   	pop    %esi
+  801869:	5f                   	pop    %edi
+  80186a:	5d                   	pop    %ebp
+  80186b:	c3                   	ret
+		sys_yield();
+  80186c:	e8 e4 e8 ff ff       	call   800155 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  801871:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  801877:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80187c:	39 c2                	cmp    %eax,%edx
+  80187e:	75 18                	jne    801898 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  801880:	84 db                	test   %bl,%bl
+  801882:	0f 84 21 01 00 00    	je     8019a9 <fsring_reap+0x167>
+  801888:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  80188f:	75 db                	jne    80186c <fsring_reap+0x2a>
+			return 0;
+  801891:	b8 00 00 00 00       	mov    $0x0,%eax
+  801896:	eb cc                	jmp    801864 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  801898:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80189d:	83 e0 0f             	and    $0xf,%eax
+  8018a0:	83 c0 2a             	add    $0x2a,%eax
+  8018a3:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8018aa:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8018b1:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018b6:	83 c0 01             	add    $0x1,%eax
+  8018b9:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8018be:	83 fb 0f             	cmp    $0xf,%ebx
+  8018c1:	77 5b                	ja     80191e <fsring_reap+0xdc>
+  8018c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8018c8:	89 d9                	mov    %ebx,%ecx
+  8018ca:	d3 e6                	shl    %cl,%esi
+  8018cc:	89 f0                	mov    %esi,%eax
+  8018ce:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8018d4:	74 48                	je     80191e <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8018d6:	89 d8                	mov    %ebx,%eax
+  8018d8:	c1 e0 0c             	shl    $0xc,%eax
+  8018db:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8018e1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8018e4:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8018e7:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  8018ee:	83 f8 03             	cmp    $0x3,%eax
+  8018f1:	74 40                	je     801933 <fsring_reap+0xf1>
+  8018f3:	83 f8 05             	cmp    $0x5,%eax
+  8018f6:	74 64                	je     80195c <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8018f8:	f7 d6                	not    %esi
+  8018fa:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  801900:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801903:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  80190a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80190d:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  80190f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801912:	89 38                	mov    %edi,(%eax)
+	return 1;
+  801914:	b8 01 00 00 00       	mov    $0x1,%eax
+  801919:	e9 46 ff ff ff       	jmp    801864 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80191e:	53                   	push   %ebx
+  80191f:	68 61 38 80 00       	push   $0x803861
+  801924:	68 8f 02 00 00       	push   $0x28f
+  801929:	68 39 38 80 00       	push   $0x803839
+  80192e:	e8 fd 0b 00 00       	call   802530 <_panic>
+		if (cqe.cqe_result > 0)
+  801933:	85 ff                	test   %edi,%edi
+  801935:	7e c1                	jle    8018f8 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801937:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80193a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80193f:	39 c7                	cmp    %eax,%edi
+  801941:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801944:	50                   	push   %eax
+  801945:	ff 75 e4             	push   -0x1c(%ebp)
+  801948:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80194b:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  801952:	e8 28 14 00 00       	call   802d7f <memmove>
+  801957:	83 c4 10             	add    $0x10,%esp
+  80195a:	eb 9c                	jmp    8018f8 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80195c:	85 ff                	test   %edi,%edi
+  80195e:	75 98                	jne    8018f8 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  801960:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801963:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80196a:	83 ec 08             	sub    $0x8,%esp
+  80196d:	ff 75 e4             	push   -0x1c(%ebp)
+  801970:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801973:	51                   	push   %ecx
+  801974:	e8 80 12 00 00       	call   802bf9 <strcpy>
+			st->st_size = ret->ret_size;
+  801979:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80197c:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  801982:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801985:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80198b:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  801991:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  801997:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  80199e:	40 80 00 
+  8019a1:	83 c4 10             	add    $0x10,%esp
+  8019a4:	e9 4f ff ff ff       	jmp    8018f8 <fsring_reap+0xb6>
+			return 0;
+  8019a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ae:	e9 b1 fe ff ff       	jmp    801864 <fsring_reap+0x22>
+
+008019b3 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8019b3:	55                   	push   %ebp
+  8019b4:	89 e5                	mov    %esp,%ebp
+  8019b6:	57                   	push   %edi
+  8019b7:	56                   	push   %esi
+  8019b8:	53                   	push   %ebx
+  8019b9:	83 ec 28             	sub    $0x28,%esp
+  8019bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019bf:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8019c2:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8019c5:	53                   	push   %ebx
+  8019c6:	e8 f3 11 00 00       	call   802bbe <strlen>
+  8019cb:	83 c4 10             	add    $0x10,%esp
+  8019ce:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019d3:	0f 8f 02 01 00 00    	jg     801adb <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8019d9:	83 ec 08             	sub    $0x8,%esp
+  8019dc:	53                   	push   %ebx
+  8019dd:	68 00 60 80 00       	push   $0x806000
+  8019e2:	e8 12 12 00 00       	call   802bf9 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8019e7:	83 c4 10             	add    $0x10,%esp
+  8019ea:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8019f0:	76 69                	jbe    801a5b <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8019f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019f5:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8019fb:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801a00:	29 d1                	sub    %edx,%ecx
+  801a02:	39 f9                	cmp    %edi,%ecx
+  801a04:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a07:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a0a:	89 f9                	mov    %edi,%ecx
+  801a0c:	01 c1                	add    %eax,%ecx
+  801a0e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a11:	eb 0f                	jmp    801a22 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  801a13:	0f b6 10             	movzbl (%eax),%edx
+  801a16:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a18:	05 00 10 00 00       	add    $0x1000,%eax
+  801a1d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a22:	39 c8                	cmp    %ecx,%eax
+  801a24:	72 ed                	jb     801a13 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  801a26:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a29:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  801a2f:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  801a35:	83 ec 0c             	sub    $0xc,%esp
+  801a38:	6a 07                	push   $0x7
+  801a3a:	89 f9                	mov    %edi,%ecx
+  801a3c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a3f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a44:	e8 3f f1 ff ff       	call   800b88 <fsipc_pages>
+  801a49:	89 c7                	mov    %eax,%edi
+  801a4b:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  801a4e:	85 f6                	test   %esi,%esi
+  801a50:	74 7f                	je     801ad1 <file_slurp+0x11e>
+  801a52:	8d 43 01             	lea    0x1(%ebx),%eax
+  801a55:	85 ff                	test   %edi,%edi
+  801a57:	79 3c                	jns    801a95 <file_slurp+0xe2>
+  801a59:	eb 76                	jmp    801ad1 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  801a5b:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  801a61:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a66:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a6b:	e8 ba f2 ff ff       	call   800d2a <fsipc>
+  801a70:	89 c7                	mov    %eax,%edi
+  801a72:	85 c0                	test   %eax,%eax
+  801a74:	7e d8                	jle    801a4e <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  801a76:	83 ec 04             	sub    $0x4,%esp
+  801a79:	50                   	push   %eax
+  801a7a:	68 08 60 80 00       	push   $0x806008
+  801a7f:	ff 75 0c             	push   0xc(%ebp)
+  801a82:	e8 f8 12 00 00       	call   802d7f <memmove>
+  801a87:	83 c4 10             	add    $0x10,%esp
+  801a8a:	eb c2                	jmp    801a4e <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  801a8c:	80 fa 2f             	cmp    $0x2f,%dl
+  801a8f:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  801a92:	83 c0 01             	add    $0x1,%eax
+  801a95:	89 c1                	mov    %eax,%ecx
+  801a97:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  801a9b:	84 d2                	test   %dl,%dl
+  801a9d:	75 ed                	jne    801a8c <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  801a9f:	83 ec 04             	sub    $0x4,%esp
+  801aa2:	68 80 00 00 00       	push   $0x80
+  801aa7:	53                   	push   %ebx
+  801aa8:	56                   	push   %esi
+  801aa9:	e8 c1 11 00 00       	call   802c6f <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  801aae:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ab3:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  801ab9:	a1 04 60 80 00       	mov    0x806004,%eax
+  801abe:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  801ac4:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  801acb:	40 80 00 
+  801ace:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801ad1:	89 f8                	mov    %edi,%eax
+  801ad3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ad6:	5b                   	pop    %ebx
+  801ad7:	5e                   	pop    %esi
+  801ad8:	5f                   	pop    %edi
+  801ad9:	5d                   	pop    %ebp
+  801ada:	c3                   	ret
+		return -E_BAD_PATH;
+  801adb:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  801ae0:	eb ef                	jmp    801ad1 <file_slurp+0x11e>
+
+00801ae2 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801ae2:	55                   	push   %ebp
+  801ae3:	89 e5                	mov    %esp,%ebp
+  801ae5:	53                   	push   %ebx
+  801ae6:	83 ec 10             	sub    $0x10,%esp
+  801ae9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801aec:	53                   	push   %ebx
+  801aed:	e8 cc 10 00 00       	call   802bbe <strlen>
+  801af2:	83 c4 10             	add    $0x10,%esp
+  801af5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801afa:	7f 25                	jg     801b21 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801afc:	83 ec 08             	sub    $0x8,%esp
+  801aff:	53                   	push   %ebx
+  801b00:	68 00 60 80 00       	push   $0x806000
+  801b05:	e8 ef 10 00 00       	call   802bf9 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b0f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b14:	e8 11 f2 ff ff       	call   800d2a <fsipc>
+  801b19:	83 c4 10             	add    $0x10,%esp
+}
+  801b1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b1f:	c9                   	leave
+  801b20:	c3                   	ret
+		return -E_BAD_PATH;
+  801b21:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b26:	eb f4                	jmp    801b1c <remove+0x3a>
+
+00801b28 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b28:	55                   	push   %ebp
+  801b29:	89 e5                	mov    %esp,%ebp
+  801b2b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b33:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b38:	e8 ed f1 ff ff       	call   800d2a <fsipc>
+}
+  801b3d:	c9                   	leave
+  801b3e:	c3                   	ret
+
+00801b3f <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  801b3f:	55                   	push   %ebp
+  801b40:	89 e5                	mov    %esp,%ebp
+  801b42:	57                   	push   %edi
+  801b43:	56                   	push   %esi
+  801b44:	53                   	push   %ebx
+  801b45:	83 ec 18             	sub    $0x18,%esp
+  801b48:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b4b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b4e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801b51:	57                   	push   %edi
+  801b52:	e8 67 10 00 00       	call   802bbe <strlen>
+  801b57:	83 c4 10             	add    $0x10,%esp
+  801b5a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b5f:	7f 4c                	jg     801bad <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  801b61:	83 ec 08             	sub    $0x8,%esp
+  801b64:	57                   	push   %edi
+  801b65:	68 00 60 80 00       	push   $0x806000
+  801b6a:	e8 8a 10 00 00       	call   802bf9 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  801b6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b74:	b8 10 00 00 00       	mov    $0x10,%eax
+  801b79:	e8 ac f1 ff ff       	call   800d2a <fsipc>
+  801b7e:	83 c4 10             	add    $0x10,%esp
+  801b81:	85 c0                	test   %eax,%eax
+  801b83:	78 20                	js     801ba5 <defrag+0x66>
+		return r;
+	if (before)
+  801b85:	85 f6                	test   %esi,%esi
+  801b87:	74 07                	je     801b90 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  801b89:	a1 00 60 80 00       	mov    0x806000,%eax
+  801b8e:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  801b90:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  801b95:	85 db                	test   %ebx,%ebx
+  801b97:	74 0c                	je     801ba5 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  801b99:	a1 04 60 80 00       	mov    0x806004,%eax
+  801b9e:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  801ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ba5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ba8:	5b                   	pop    %ebx
+  801ba9:	5e                   	pop    %esi
+  801baa:	5f                   	pop    %edi
+  801bab:	5d                   	pop    %ebp
+  801bac:	c3                   	ret
+		return -E_BAD_PATH;
+  801bad:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801bb2:	eb f1                	jmp    801ba5 <defrag+0x66>
+
+00801bb4 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  801bb4:	55                   	push   %ebp
+  801bb5:	89 e5                	mov    %esp,%ebp
+  801bb7:	53                   	push   %ebx
+  801bb8:	83 ec 04             	sub    $0x4,%esp
+  801bbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  801bbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc3:	b8 11 00 00 00       	mov    $0x11,%eax
+  801bc8:	e8 5d f1 ff ff       	call   800d2a <fsipc>
+  801bcd:	85 c0                	test   %eax,%eax
+  801bcf:	78 34                	js     801c05 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  801bd1:	a1 00 60 80 00       	mov    0x806000,%eax
+  801bd6:	89 03                	mov    %eax,(%ebx)
+  801bd8:	a1 04 60 80 00       	mov    0x806004,%eax
+  801bdd:	89 43 04             	mov    %eax,0x4(%ebx)
+  801be0:	a1 08 60 80 00       	mov    0x806008,%eax
+  801be5:	89 43 08             	mov    %eax,0x8(%ebx)
+  801be8:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  801bed:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801bf0:	a1 10 60 80 00       	mov    0x806010,%eax
+  801bf5:	89 43 10             	mov    %eax,0x10(%ebx)
+  801bf8:	a1 14 60 80 00       	mov    0x806014,%eax
+  801bfd:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  801c00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c08:	c9                   	leave
+  801c09:	c3                   	ret
+
+00801c0a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c10:	68 7a 38 80 00       	push   $0x80387a
+  801c15:	ff 75 0c             	push   0xc(%ebp)
+  801c18:	e8 dc 0f 00 00       	call   802bf9 <strcpy>
+	return 0;
+}
+  801c1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c22:	c9                   	leave
+  801c23:	c3                   	ret
+
+00801c24 <devsock_close>:
+{
+  801c24:	55                   	push   %ebp
+  801c25:	89 e5                	mov    %esp,%ebp
+  801c27:	53                   	push   %ebx
+  801c28:	83 ec 10             	sub    $0x10,%esp
+  801c2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c2e:	53                   	push   %ebx
+  801c2f:	e8 ed 17 00 00       	call   803421 <pageref>
+  801c34:	89 c2                	mov    %eax,%edx
+  801c36:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c39:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c3e:	83 fa 01             	cmp    $0x1,%edx
+  801c41:	74 05                	je     801c48 <devsock_close+0x24>
+}
+  801c43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c46:	c9                   	leave
+  801c47:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c48:	83 ec 0c             	sub    $0xc,%esp
+  801c4b:	ff 73 0c             	push   0xc(%ebx)
+  801c4e:	e8 b7 02 00 00       	call   801f0a <nsipc_close>
+  801c53:	83 c4 10             	add    $0x10,%esp
+  801c56:	eb eb                	jmp    801c43 <devsock_close+0x1f>
+
+00801c58 <devsock_write>:
+{
+  801c58:	55                   	push   %ebp
+  801c59:	89 e5                	mov    %esp,%ebp
+  801c5b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c5e:	6a 00                	push   $0x0
+  801c60:	ff 75 10             	push   0x10(%ebp)
+  801c63:	ff 75 0c             	push   0xc(%ebp)
+  801c66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c69:	ff 70 0c             	push   0xc(%eax)
+  801c6c:	e8 79 03 00 00       	call   801fea <nsipc_send>
+}
+  801c71:	c9                   	leave
+  801c72:	c3                   	ret
+
+00801c73 <devsock_read>:
+{
+  801c73:	55                   	push   %ebp
+  801c74:	89 e5                	mov    %esp,%ebp
+  801c76:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801c79:	6a 00                	push   $0x0
+  801c7b:	ff 75 10             	push   0x10(%ebp)
+  801c7e:	ff 75 0c             	push   0xc(%ebp)
+  801c81:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c84:	ff 70 0c             	push   0xc(%eax)
+  801c87:	e8 ef 02 00 00       	call   801f7b <nsipc_recv>
+}
+  801c8c:	c9                   	leave
+  801c8d:	c3                   	ret
+
+00801c8e <fd2sockid>:
+{
+  801c8e:	55                   	push   %ebp
+  801c8f:	89 e5                	mov    %esp,%ebp
+  801c91:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c94:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c97:	52                   	push   %edx
+  801c98:	50                   	push   %eax
+  801c99:	e8 54 e9 ff ff       	call   8005f2 <fd_lookup>
+  801c9e:	83 c4 10             	add    $0x10,%esp
+  801ca1:	85 c0                	test   %eax,%eax
+  801ca3:	78 10                	js     801cb5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801ca5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ca8:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801cae:	39 08                	cmp    %ecx,(%eax)
+  801cb0:	75 05                	jne    801cb7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801cb2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801cb5:	c9                   	leave
+  801cb6:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cb7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cbc:	eb f7                	jmp    801cb5 <fd2sockid+0x27>
+
+00801cbe <alloc_sockfd>:
+{
+  801cbe:	55                   	push   %ebp
+  801cbf:	89 e5                	mov    %esp,%ebp
+  801cc1:	56                   	push   %esi
+  801cc2:	53                   	push   %ebx
+  801cc3:	83 ec 1c             	sub    $0x1c,%esp
+  801cc6:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801cc8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ccb:	50                   	push   %eax
+  801ccc:	e8 cb e8 ff ff       	call   80059c <fd_alloc>
+  801cd1:	89 c3                	mov    %eax,%ebx
+  801cd3:	83 c4 10             	add    $0x10,%esp
+  801cd6:	85 c0                	test   %eax,%eax
+  801cd8:	78 43                	js     801d1d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801cda:	83 ec 04             	sub    $0x4,%esp
+  801cdd:	68 07 04 00 00       	push   $0x407
+  801ce2:	ff 75 f4             	push   -0xc(%ebp)
+  801ce5:	6a 00                	push   $0x0
+  801ce7:	e8 88 e4 ff ff       	call   800174 <sys_page_alloc>
+  801cec:	89 c3                	mov    %eax,%ebx
+  801cee:	83 c4 10             	add    $0x10,%esp
+  801cf1:	85 c0                	test   %eax,%eax
+  801cf3:	78 28                	js     801d1d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801cf5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cf8:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801cfe:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d03:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d0a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d0d:	83 ec 0c             	sub    $0xc,%esp
+  801d10:	50                   	push   %eax
+  801d11:	e8 5f e8 ff ff       	call   800575 <fd2num>
+  801d16:	89 c3                	mov    %eax,%ebx
+  801d18:	83 c4 10             	add    $0x10,%esp
+  801d1b:	eb 0c                	jmp    801d29 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d1d:	83 ec 0c             	sub    $0xc,%esp
+  801d20:	56                   	push   %esi
+  801d21:	e8 e4 01 00 00       	call   801f0a <nsipc_close>
+		return r;
+  801d26:	83 c4 10             	add    $0x10,%esp
+}
+  801d29:	89 d8                	mov    %ebx,%eax
+  801d2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d2e:	5b                   	pop    %ebx
+  801d2f:	5e                   	pop    %esi
+  801d30:	5d                   	pop    %ebp
+  801d31:	c3                   	ret
+
+00801d32 <accept>:
+{
+  801d32:	55                   	push   %ebp
+  801d33:	89 e5                	mov    %esp,%ebp
+  801d35:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d38:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d3b:	e8 4e ff ff ff       	call   801c8e <fd2sockid>
+  801d40:	85 c0                	test   %eax,%eax
+  801d42:	78 1b                	js     801d5f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d44:	83 ec 04             	sub    $0x4,%esp
+  801d47:	ff 75 10             	push   0x10(%ebp)
+  801d4a:	ff 75 0c             	push   0xc(%ebp)
+  801d4d:	50                   	push   %eax
+  801d4e:	e8 0e 01 00 00       	call   801e61 <nsipc_accept>
+  801d53:	83 c4 10             	add    $0x10,%esp
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	78 05                	js     801d5f <accept+0x2d>
+	return alloc_sockfd(r);
+  801d5a:	e8 5f ff ff ff       	call   801cbe <alloc_sockfd>
+}
+  801d5f:	c9                   	leave
+  801d60:	c3                   	ret
+
+00801d61 <bind>:
+{
+  801d61:	55                   	push   %ebp
+  801d62:	89 e5                	mov    %esp,%ebp
+  801d64:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d67:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d6a:	e8 1f ff ff ff       	call   801c8e <fd2sockid>
+  801d6f:	85 c0                	test   %eax,%eax
+  801d71:	78 12                	js     801d85 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d73:	83 ec 04             	sub    $0x4,%esp
+  801d76:	ff 75 10             	push   0x10(%ebp)
+  801d79:	ff 75 0c             	push   0xc(%ebp)
+  801d7c:	50                   	push   %eax
+  801d7d:	e8 31 01 00 00       	call   801eb3 <nsipc_bind>
+  801d82:	83 c4 10             	add    $0x10,%esp
+}
+  801d85:	c9                   	leave
+  801d86:	c3                   	ret
+
+00801d87 <shutdown>:
+{
+  801d87:	55                   	push   %ebp
+  801d88:	89 e5                	mov    %esp,%ebp
+  801d8a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d90:	e8 f9 fe ff ff       	call   801c8e <fd2sockid>
+  801d95:	85 c0                	test   %eax,%eax
+  801d97:	78 0f                	js     801da8 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801d99:	83 ec 08             	sub    $0x8,%esp
+  801d9c:	ff 75 0c             	push   0xc(%ebp)
+  801d9f:	50                   	push   %eax
+  801da0:	e8 43 01 00 00       	call   801ee8 <nsipc_shutdown>
+  801da5:	83 c4 10             	add    $0x10,%esp
+}
+  801da8:	c9                   	leave
+  801da9:	c3                   	ret
+
+00801daa <connect>:
+{
+  801daa:	55                   	push   %ebp
+  801dab:	89 e5                	mov    %esp,%ebp
+  801dad:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801db0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db3:	e8 d6 fe ff ff       	call   801c8e <fd2sockid>
+  801db8:	85 c0                	test   %eax,%eax
+  801dba:	78 12                	js     801dce <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801dbc:	83 ec 04             	sub    $0x4,%esp
+  801dbf:	ff 75 10             	push   0x10(%ebp)
+  801dc2:	ff 75 0c             	push   0xc(%ebp)
+  801dc5:	50                   	push   %eax
+  801dc6:	e8 59 01 00 00       	call   801f24 <nsipc_connect>
+  801dcb:	83 c4 10             	add    $0x10,%esp
+}
+  801dce:	c9                   	leave
+  801dcf:	c3                   	ret
+
+00801dd0 <listen>:
+{
+  801dd0:	55                   	push   %ebp
+  801dd1:	89 e5                	mov    %esp,%ebp
+  801dd3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd9:	e8 b0 fe ff ff       	call   801c8e <fd2sockid>
+  801dde:	85 c0                	test   %eax,%eax
+  801de0:	78 0f                	js     801df1 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801de2:	83 ec 08             	sub    $0x8,%esp
+  801de5:	ff 75 0c             	push   0xc(%ebp)
+  801de8:	50                   	push   %eax
+  801de9:	e8 6b 01 00 00       	call   801f59 <nsipc_listen>
+  801dee:	83 c4 10             	add    $0x10,%esp
+}
+  801df1:	c9                   	leave
+  801df2:	c3                   	ret
+
+00801df3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801df3:	55                   	push   %ebp
+  801df4:	89 e5                	mov    %esp,%ebp
+  801df6:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801df9:	ff 75 10             	push   0x10(%ebp)
+  801dfc:	ff 75 0c             	push   0xc(%ebp)
+  801dff:	ff 75 08             	push   0x8(%ebp)
+  801e02:	e8 41 02 00 00       	call   802048 <nsipc_socket>
+  801e07:	83 c4 10             	add    $0x10,%esp
+  801e0a:	85 c0                	test   %eax,%eax
+  801e0c:	78 05                	js     801e13 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e0e:	e8 ab fe ff ff       	call   801cbe <alloc_sockfd>
+}
+  801e13:	c9                   	leave
+  801e14:	c3                   	ret
+
+00801e15 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e15:	55                   	push   %ebp
+  801e16:	89 e5                	mov    %esp,%ebp
+  801e18:	53                   	push   %ebx
+  801e19:	83 ec 04             	sub    $0x4,%esp
+  801e1c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e1e:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  801e25:	74 26                	je     801e4d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e27:	6a 07                	push   $0x7
+  801e29:	68 00 80 80 00       	push   $0x808000
+  801e2e:	53                   	push   %ebx
+  801e2f:	ff 35 00 90 80 00    	push   0x809000
+  801e35:	e8 6f 14 00 00       	call   8032a9 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e3a:	83 c4 0c             	add    $0xc,%esp
+  801e3d:	6a 00                	push   $0x0
+  801e3f:	6a 00                	push   $0x0
+  801e41:	6a 00                	push   $0x0
+  801e43:	e8 f6 13 00 00       	call   80323e <ipc_recv>
+}
+  801e48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e4b:	c9                   	leave
+  801e4c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e4d:	83 ec 0c             	sub    $0xc,%esp
+  801e50:	6a 02                	push   $0x2
+  801e52:	e8 8b 15 00 00       	call   8033e2 <ipc_find_env>
+  801e57:	a3 00 90 80 00       	mov    %eax,0x809000
+  801e5c:	83 c4 10             	add    $0x10,%esp
+  801e5f:	eb c6                	jmp    801e27 <nsipc+0x12>
+
+00801e61 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e61:	55                   	push   %ebp
+  801e62:	89 e5                	mov    %esp,%ebp
+  801e64:	56                   	push   %esi
+  801e65:	53                   	push   %ebx
+  801e66:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e69:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e6c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801e71:	8b 06                	mov    (%esi),%eax
+  801e73:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801e78:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e7d:	e8 93 ff ff ff       	call   801e15 <nsipc>
+  801e82:	89 c3                	mov    %eax,%ebx
+  801e84:	85 c0                	test   %eax,%eax
+  801e86:	79 09                	jns    801e91 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801e88:	89 d8                	mov    %ebx,%eax
+  801e8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e8d:	5b                   	pop    %ebx
+  801e8e:	5e                   	pop    %esi
+  801e8f:	5d                   	pop    %ebp
+  801e90:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801e91:	83 ec 04             	sub    $0x4,%esp
+  801e94:	ff 35 10 80 80 00    	push   0x808010
+  801e9a:	68 00 80 80 00       	push   $0x808000
+  801e9f:	ff 75 0c             	push   0xc(%ebp)
+  801ea2:	e8 d8 0e 00 00       	call   802d7f <memmove>
+		*addrlen = ret->ret_addrlen;
+  801ea7:	a1 10 80 80 00       	mov    0x808010,%eax
+  801eac:	89 06                	mov    %eax,(%esi)
+  801eae:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801eb1:	eb d5                	jmp    801e88 <nsipc_accept+0x27>
+
+00801eb3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801eb3:	55                   	push   %ebp
+  801eb4:	89 e5                	mov    %esp,%ebp
+  801eb6:	53                   	push   %ebx
+  801eb7:	83 ec 08             	sub    $0x8,%esp
+  801eba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ebd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec0:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ec5:	53                   	push   %ebx
+  801ec6:	ff 75 0c             	push   0xc(%ebp)
+  801ec9:	68 04 80 80 00       	push   $0x808004
+  801ece:	e8 ac 0e 00 00       	call   802d7f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801ed3:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801ed9:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ede:	e8 32 ff ff ff       	call   801e15 <nsipc>
+}
+  801ee3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee6:	c9                   	leave
+  801ee7:	c3                   	ret
+
+00801ee8 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801ee8:	55                   	push   %ebp
+  801ee9:	89 e5                	mov    %esp,%ebp
+  801eeb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801eee:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef1:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801ef6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ef9:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801efe:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f03:	e8 0d ff ff ff       	call   801e15 <nsipc>
+}
+  801f08:	c9                   	leave
+  801f09:	c3                   	ret
+
+00801f0a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f0a:	55                   	push   %ebp
+  801f0b:	89 e5                	mov    %esp,%ebp
+  801f0d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f10:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f13:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f18:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f1d:	e8 f3 fe ff ff       	call   801e15 <nsipc>
+}
+  801f22:	c9                   	leave
+  801f23:	c3                   	ret
+
+00801f24 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f24:	55                   	push   %ebp
+  801f25:	89 e5                	mov    %esp,%ebp
+  801f27:	53                   	push   %ebx
+  801f28:	83 ec 08             	sub    $0x8,%esp
+  801f2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f31:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f36:	53                   	push   %ebx
+  801f37:	ff 75 0c             	push   0xc(%ebp)
+  801f3a:	68 04 80 80 00       	push   $0x808004
+  801f3f:	e8 3b 0e 00 00       	call   802d7f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f44:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801f4a:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f4f:	e8 c1 fe ff ff       	call   801e15 <nsipc>
+}
+  801f54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f57:	c9                   	leave
+  801f58:	c3                   	ret
+
+00801f59 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f59:	55                   	push   %ebp
+  801f5a:	89 e5                	mov    %esp,%ebp
+  801f5c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f62:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f67:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f6a:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801f6f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f74:	e8 9c fe ff ff       	call   801e15 <nsipc>
+}
+  801f79:	c9                   	leave
+  801f7a:	c3                   	ret
+
+00801f7b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801f7b:	55                   	push   %ebp
+  801f7c:	89 e5                	mov    %esp,%ebp
+  801f7e:	56                   	push   %esi
+  801f7f:	53                   	push   %ebx
+  801f80:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801f83:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f86:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801f8b:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801f91:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f94:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801f99:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f9e:	e8 72 fe ff ff       	call   801e15 <nsipc>
+  801fa3:	89 c3                	mov    %eax,%ebx
+  801fa5:	85 c0                	test   %eax,%eax
+  801fa7:	78 22                	js     801fcb <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801fa9:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801fae:	39 c6                	cmp    %eax,%esi
+  801fb0:	0f 4e c6             	cmovle %esi,%eax
+  801fb3:	39 c3                	cmp    %eax,%ebx
+  801fb5:	7f 1d                	jg     801fd4 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801fb7:	83 ec 04             	sub    $0x4,%esp
+  801fba:	53                   	push   %ebx
+  801fbb:	68 00 80 80 00       	push   $0x808000
+  801fc0:	ff 75 0c             	push   0xc(%ebp)
+  801fc3:	e8 b7 0d 00 00       	call   802d7f <memmove>
+  801fc8:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801fcb:	89 d8                	mov    %ebx,%eax
+  801fcd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd0:	5b                   	pop    %ebx
+  801fd1:	5e                   	pop    %esi
+  801fd2:	5d                   	pop    %ebp
+  801fd3:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801fd4:	68 86 38 80 00       	push   $0x803886
+  801fd9:	68 24 38 80 00       	push   $0x803824
+  801fde:	6a 62                	push   $0x62
+  801fe0:	68 9b 38 80 00       	push   $0x80389b
+  801fe5:	e8 46 05 00 00       	call   802530 <_panic>
+
+00801fea <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801fea:	55                   	push   %ebp
+  801feb:	89 e5                	mov    %esp,%ebp
+  801fed:	53                   	push   %ebx
+  801fee:	83 ec 04             	sub    $0x4,%esp
+  801ff1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801ff4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff7:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  801ffc:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802002:	7f 2e                	jg     802032 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802004:	83 ec 04             	sub    $0x4,%esp
+  802007:	53                   	push   %ebx
+  802008:	ff 75 0c             	push   0xc(%ebp)
+  80200b:	68 0c 80 80 00       	push   $0x80800c
+  802010:	e8 6a 0d 00 00       	call   802d7f <memmove>
+	nsipcbuf.send.req_size = size;
+  802015:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  80201b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80201e:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802023:	b8 08 00 00 00       	mov    $0x8,%eax
+  802028:	e8 e8 fd ff ff       	call   801e15 <nsipc>
+}
+  80202d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802030:	c9                   	leave
+  802031:	c3                   	ret
+	assert(size < 1600);
+  802032:	68 a7 38 80 00       	push   $0x8038a7
+  802037:	68 24 38 80 00       	push   $0x803824
+  80203c:	6a 6d                	push   $0x6d
+  80203e:	68 9b 38 80 00       	push   $0x80389b
+  802043:	e8 e8 04 00 00       	call   802530 <_panic>
+
+00802048 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802048:	55                   	push   %ebp
+  802049:	89 e5                	mov    %esp,%ebp
+  80204b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80204e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802051:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802056:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802059:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  80205e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802061:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802066:	b8 09 00 00 00       	mov    $0x9,%eax
+  80206b:	e8 a5 fd ff ff       	call   801e15 <nsipc>
+}
+  802070:	c9                   	leave
+  802071:	c3                   	ret
+
+00802072 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802072:	55                   	push   %ebp
+  802073:	89 e5                	mov    %esp,%ebp
+  802075:	56                   	push   %esi
+  802076:	53                   	push   %ebx
+  802077:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80207a:	83 ec 0c             	sub    $0xc,%esp
+  80207d:	ff 75 08             	push   0x8(%ebp)
+  802080:	e8 00 e5 ff ff       	call   800585 <fd2data>
+  802085:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802087:	83 c4 08             	add    $0x8,%esp
+  80208a:	68 b3 38 80 00       	push   $0x8038b3
+  80208f:	53                   	push   %ebx
+  802090:	e8 64 0b 00 00       	call   802bf9 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802095:	8b 46 04             	mov    0x4(%esi),%eax
+  802098:	2b 06                	sub    (%esi),%eax
+  80209a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8020a0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020a7:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020aa:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  8020b1:	40 80 00 
+	return 0;
+}
+  8020b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020bc:	5b                   	pop    %ebx
+  8020bd:	5e                   	pop    %esi
+  8020be:	5d                   	pop    %ebp
+  8020bf:	c3                   	ret
+
+008020c0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020c0:	55                   	push   %ebp
+  8020c1:	89 e5                	mov    %esp,%ebp
+  8020c3:	53                   	push   %ebx
+  8020c4:	83 ec 0c             	sub    $0xc,%esp
+  8020c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020ca:	53                   	push   %ebx
+  8020cb:	6a 00                	push   $0x0
+  8020cd:	e8 2f e1 ff ff       	call   800201 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8020d2:	89 1c 24             	mov    %ebx,(%esp)
+  8020d5:	e8 ab e4 ff ff       	call   800585 <fd2data>
+  8020da:	83 c4 08             	add    $0x8,%esp
+  8020dd:	50                   	push   %eax
+  8020de:	6a 00                	push   $0x0
+  8020e0:	e8 1c e1 ff ff       	call   800201 <sys_page_unmap>
+}
+  8020e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020e8:	c9                   	leave
+  8020e9:	c3                   	ret
+
+008020ea <_pipeisclosed>:
+{
+  8020ea:	55                   	push   %ebp
+  8020eb:	89 e5                	mov    %esp,%ebp
+  8020ed:	57                   	push   %edi
+  8020ee:	56                   	push   %esi
+  8020ef:	53                   	push   %ebx
+  8020f0:	83 ec 1c             	sub    $0x1c,%esp
+  8020f3:	89 c7                	mov    %eax,%edi
+  8020f5:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8020f7:	a1 00 50 80 00       	mov    0x805000,%eax
+  8020fc:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8020ff:	83 ec 0c             	sub    $0xc,%esp
+  802102:	57                   	push   %edi
+  802103:	e8 19 13 00 00       	call   803421 <pageref>
+  802108:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80210b:	89 34 24             	mov    %esi,(%esp)
+  80210e:	e8 0e 13 00 00       	call   803421 <pageref>
+		nn = thisenv->env_runs;
+  802113:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802119:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80211c:	83 c4 10             	add    $0x10,%esp
+  80211f:	39 cb                	cmp    %ecx,%ebx
+  802121:	74 1b                	je     80213e <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802123:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802126:	75 cf                	jne    8020f7 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802128:	8b 42 58             	mov    0x58(%edx),%eax
+  80212b:	6a 01                	push   $0x1
+  80212d:	50                   	push   %eax
+  80212e:	53                   	push   %ebx
+  80212f:	68 ba 38 80 00       	push   $0x8038ba
+  802134:	e8 d2 04 00 00       	call   80260b <cprintf>
+  802139:	83 c4 10             	add    $0x10,%esp
+  80213c:	eb b9                	jmp    8020f7 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80213e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802141:	0f 94 c0             	sete   %al
+  802144:	0f b6 c0             	movzbl %al,%eax
+}
+  802147:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80214a:	5b                   	pop    %ebx
+  80214b:	5e                   	pop    %esi
+  80214c:	5f                   	pop    %edi
+  80214d:	5d                   	pop    %ebp
+  80214e:	c3                   	ret
+
+0080214f <devpipe_write>:
+{
+  80214f:	55                   	push   %ebp
+  802150:	89 e5                	mov    %esp,%ebp
+  802152:	57                   	push   %edi
+  802153:	56                   	push   %esi
+  802154:	53                   	push   %ebx
+  802155:	83 ec 28             	sub    $0x28,%esp
+  802158:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80215b:	56                   	push   %esi
+  80215c:	e8 24 e4 ff ff       	call   800585 <fd2data>
+  802161:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802163:	83 c4 10             	add    $0x10,%esp
+  802166:	bf 00 00 00 00       	mov    $0x0,%edi
+  80216b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80216e:	75 09                	jne    802179 <devpipe_write+0x2a>
+	return i;
+  802170:	89 f8                	mov    %edi,%eax
+  802172:	eb 23                	jmp    802197 <devpipe_write+0x48>
+			sys_yield();
+  802174:	e8 dc df ff ff       	call   800155 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802179:	8b 43 04             	mov    0x4(%ebx),%eax
+  80217c:	8b 0b                	mov    (%ebx),%ecx
+  80217e:	8d 51 20             	lea    0x20(%ecx),%edx
+  802181:	39 d0                	cmp    %edx,%eax
+  802183:	72 1a                	jb     80219f <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802185:	89 da                	mov    %ebx,%edx
+  802187:	89 f0                	mov    %esi,%eax
+  802189:	e8 5c ff ff ff       	call   8020ea <_pipeisclosed>
+  80218e:	85 c0                	test   %eax,%eax
+  802190:	74 e2                	je     802174 <devpipe_write+0x25>
+				return 0;
+  802192:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802197:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80219a:	5b                   	pop    %ebx
+  80219b:	5e                   	pop    %esi
+  80219c:	5f                   	pop    %edi
+  80219d:	5d                   	pop    %ebp
+  80219e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80219f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021a2:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021a6:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021a9:	89 c2                	mov    %eax,%edx
+  8021ab:	c1 fa 1f             	sar    $0x1f,%edx
+  8021ae:	89 d1                	mov    %edx,%ecx
+  8021b0:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021b3:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021b6:	83 e2 1f             	and    $0x1f,%edx
+  8021b9:	29 ca                	sub    %ecx,%edx
+  8021bb:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8021bf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021c3:	83 c0 01             	add    $0x1,%eax
+  8021c6:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8021c9:	83 c7 01             	add    $0x1,%edi
+  8021cc:	eb 9d                	jmp    80216b <devpipe_write+0x1c>
+
+008021ce <devpipe_read>:
+{
+  8021ce:	55                   	push   %ebp
+  8021cf:	89 e5                	mov    %esp,%ebp
+  8021d1:	57                   	push   %edi
+  8021d2:	56                   	push   %esi
+  8021d3:	53                   	push   %ebx
+  8021d4:	83 ec 18             	sub    $0x18,%esp
+  8021d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8021da:	57                   	push   %edi
+  8021db:	e8 a5 e3 ff ff       	call   800585 <fd2data>
+  8021e0:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021e2:	83 c4 10             	add    $0x10,%esp
+  8021e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ea:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021ed:	75 13                	jne    802202 <devpipe_read+0x34>
+	return i;
+  8021ef:	89 f0                	mov    %esi,%eax
+  8021f1:	eb 02                	jmp    8021f5 <devpipe_read+0x27>
+				return i;
+  8021f3:	89 f0                	mov    %esi,%eax
+}
+  8021f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021f8:	5b                   	pop    %ebx
+  8021f9:	5e                   	pop    %esi
+  8021fa:	5f                   	pop    %edi
+  8021fb:	5d                   	pop    %ebp
+  8021fc:	c3                   	ret
+			sys_yield();
+  8021fd:	e8 53 df ff ff       	call   800155 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802202:	8b 03                	mov    (%ebx),%eax
+  802204:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802207:	75 18                	jne    802221 <devpipe_read+0x53>
+			if (i > 0)
+  802209:	85 f6                	test   %esi,%esi
+  80220b:	75 e6                	jne    8021f3 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80220d:	89 da                	mov    %ebx,%edx
+  80220f:	89 f8                	mov    %edi,%eax
+  802211:	e8 d4 fe ff ff       	call   8020ea <_pipeisclosed>
+  802216:	85 c0                	test   %eax,%eax
+  802218:	74 e3                	je     8021fd <devpipe_read+0x2f>
+				return 0;
+  80221a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221f:	eb d4                	jmp    8021f5 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802221:	99                   	cltd
+  802222:	c1 ea 1b             	shr    $0x1b,%edx
+  802225:	01 d0                	add    %edx,%eax
+  802227:	83 e0 1f             	and    $0x1f,%eax
+  80222a:	29 d0                	sub    %edx,%eax
+  80222c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802231:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802234:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802237:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80223a:	83 c6 01             	add    $0x1,%esi
+  80223d:	eb ab                	jmp    8021ea <devpipe_read+0x1c>
+
+0080223f <pipe>:
+{
+  80223f:	55                   	push   %ebp
+  802240:	89 e5                	mov    %esp,%ebp
+  802242:	56                   	push   %esi
+  802243:	53                   	push   %ebx
+  802244:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802247:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80224a:	50                   	push   %eax
+  80224b:	e8 4c e3 ff ff       	call   80059c <fd_alloc>
+  802250:	89 c3                	mov    %eax,%ebx
+  802252:	83 c4 10             	add    $0x10,%esp
+  802255:	85 c0                	test   %eax,%eax
+  802257:	0f 88 23 01 00 00    	js     802380 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80225d:	83 ec 04             	sub    $0x4,%esp
+  802260:	68 07 04 00 00       	push   $0x407
+  802265:	ff 75 f4             	push   -0xc(%ebp)
+  802268:	6a 00                	push   $0x0
+  80226a:	e8 05 df ff ff       	call   800174 <sys_page_alloc>
+  80226f:	89 c3                	mov    %eax,%ebx
+  802271:	83 c4 10             	add    $0x10,%esp
+  802274:	85 c0                	test   %eax,%eax
+  802276:	0f 88 04 01 00 00    	js     802380 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80227c:	83 ec 0c             	sub    $0xc,%esp
+  80227f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802282:	50                   	push   %eax
+  802283:	e8 14 e3 ff ff       	call   80059c <fd_alloc>
+  802288:	89 c3                	mov    %eax,%ebx
+  80228a:	83 c4 10             	add    $0x10,%esp
+  80228d:	85 c0                	test   %eax,%eax
+  80228f:	0f 88 db 00 00 00    	js     802370 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802295:	83 ec 04             	sub    $0x4,%esp
+  802298:	68 07 04 00 00       	push   $0x407
+  80229d:	ff 75 f0             	push   -0x10(%ebp)
+  8022a0:	6a 00                	push   $0x0
+  8022a2:	e8 cd de ff ff       	call   800174 <sys_page_alloc>
+  8022a7:	89 c3                	mov    %eax,%ebx
+  8022a9:	83 c4 10             	add    $0x10,%esp
+  8022ac:	85 c0                	test   %eax,%eax
+  8022ae:	0f 88 bc 00 00 00    	js     802370 <pipe+0x131>
+	va = fd2data(fd0);
+  8022b4:	83 ec 0c             	sub    $0xc,%esp
+  8022b7:	ff 75 f4             	push   -0xc(%ebp)
+  8022ba:	e8 c6 e2 ff ff       	call   800585 <fd2data>
+  8022bf:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022c1:	83 c4 0c             	add    $0xc,%esp
+  8022c4:	68 07 04 00 00       	push   $0x407
+  8022c9:	50                   	push   %eax
+  8022ca:	6a 00                	push   $0x0
+  8022cc:	e8 a3 de ff ff       	call   800174 <sys_page_alloc>
+  8022d1:	89 c3                	mov    %eax,%ebx
+  8022d3:	83 c4 10             	add    $0x10,%esp
+  8022d6:	85 c0                	test   %eax,%eax
+  8022d8:	0f 88 82 00 00 00    	js     802360 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022de:	83 ec 0c             	sub    $0xc,%esp
+  8022e1:	ff 75 f0             	push   -0x10(%ebp)
+  8022e4:	e8 9c e2 ff ff       	call   800585 <fd2data>
+  8022e9:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8022f0:	50                   	push   %eax
+  8022f1:	6a 00                	push   $0x0
+  8022f3:	56                   	push   %esi
+  8022f4:	6a 00                	push   $0x0
+  8022f6:	e8 c4 de ff ff       	call   8001bf <sys_page_map>
+  8022fb:	89 c3                	mov    %eax,%ebx
+  8022fd:	83 c4 20             	add    $0x20,%esp
+  802300:	85 c0                	test   %eax,%eax
+  802302:	78 4e                	js     802352 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802304:	a1 60 40 80 00       	mov    0x804060,%eax
+  802309:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80230c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80230e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802311:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802318:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80231b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80231d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802320:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802327:	83 ec 0c             	sub    $0xc,%esp
+  80232a:	ff 75 f4             	push   -0xc(%ebp)
+  80232d:	e8 43 e2 ff ff       	call   800575 <fd2num>
+  802332:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802335:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802337:	83 c4 04             	add    $0x4,%esp
+  80233a:	ff 75 f0             	push   -0x10(%ebp)
+  80233d:	e8 33 e2 ff ff       	call   800575 <fd2num>
+  802342:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802345:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802348:	83 c4 10             	add    $0x10,%esp
+  80234b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802350:	eb 2e                	jmp    802380 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802352:	83 ec 08             	sub    $0x8,%esp
+  802355:	56                   	push   %esi
+  802356:	6a 00                	push   $0x0
+  802358:	e8 a4 de ff ff       	call   800201 <sys_page_unmap>
+  80235d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802360:	83 ec 08             	sub    $0x8,%esp
+  802363:	ff 75 f0             	push   -0x10(%ebp)
+  802366:	6a 00                	push   $0x0
+  802368:	e8 94 de ff ff       	call   800201 <sys_page_unmap>
+  80236d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802370:	83 ec 08             	sub    $0x8,%esp
+  802373:	ff 75 f4             	push   -0xc(%ebp)
+  802376:	6a 00                	push   $0x0
+  802378:	e8 84 de ff ff       	call   800201 <sys_page_unmap>
+  80237d:	83 c4 10             	add    $0x10,%esp
+}
+  802380:	89 d8                	mov    %ebx,%eax
+  802382:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802385:	5b                   	pop    %ebx
+  802386:	5e                   	pop    %esi
+  802387:	5d                   	pop    %ebp
+  802388:	c3                   	ret
+
+00802389 <pipeisclosed>:
+{
+  802389:	55                   	push   %ebp
+  80238a:	89 e5                	mov    %esp,%ebp
+  80238c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80238f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802392:	50                   	push   %eax
+  802393:	ff 75 08             	push   0x8(%ebp)
+  802396:	e8 57 e2 ff ff       	call   8005f2 <fd_lookup>
+  80239b:	83 c4 10             	add    $0x10,%esp
+  80239e:	85 c0                	test   %eax,%eax
+  8023a0:	78 18                	js     8023ba <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8023a2:	83 ec 0c             	sub    $0xc,%esp
+  8023a5:	ff 75 f4             	push   -0xc(%ebp)
+  8023a8:	e8 d8 e1 ff ff       	call   800585 <fd2data>
+  8023ad:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8023af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b2:	e8 33 fd ff ff       	call   8020ea <_pipeisclosed>
+  8023b7:	83 c4 10             	add    $0x10,%esp
+}
+  8023ba:	c9                   	leave
+  8023bb:	c3                   	ret
+
+008023bc <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8023bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c1:	c3                   	ret
+
+008023c2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023c2:	55                   	push   %ebp
+  8023c3:	89 e5                	mov    %esp,%ebp
+  8023c5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8023c8:	68 d2 38 80 00       	push   $0x8038d2
+  8023cd:	ff 75 0c             	push   0xc(%ebp)
+  8023d0:	e8 24 08 00 00       	call   802bf9 <strcpy>
+	return 0;
+}
+  8023d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023da:	c9                   	leave
+  8023db:	c3                   	ret
+
+008023dc <devcons_write>:
+{
+  8023dc:	55                   	push   %ebp
+  8023dd:	89 e5                	mov    %esp,%ebp
+  8023df:	57                   	push   %edi
+  8023e0:	56                   	push   %esi
+  8023e1:	53                   	push   %ebx
+  8023e2:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8023e8:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8023ed:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8023f3:	eb 2e                	jmp    802423 <devcons_write+0x47>
+		m = n - tot;
+  8023f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023f8:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8023fa:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8023ff:	39 c3                	cmp    %eax,%ebx
+  802401:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802404:	83 ec 04             	sub    $0x4,%esp
+  802407:	53                   	push   %ebx
+  802408:	89 f0                	mov    %esi,%eax
+  80240a:	03 45 0c             	add    0xc(%ebp),%eax
+  80240d:	50                   	push   %eax
+  80240e:	57                   	push   %edi
+  80240f:	e8 6b 09 00 00       	call   802d7f <memmove>
+		sys_cputs(buf, m);
+  802414:	83 c4 08             	add    $0x8,%esp
+  802417:	53                   	push   %ebx
+  802418:	57                   	push   %edi
+  802419:	e8 7a dc ff ff       	call   800098 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80241e:	01 de                	add    %ebx,%esi
+  802420:	83 c4 10             	add    $0x10,%esp
+  802423:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802426:	72 cd                	jb     8023f5 <devcons_write+0x19>
+}
+  802428:	89 f0                	mov    %esi,%eax
+  80242a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80242d:	5b                   	pop    %ebx
+  80242e:	5e                   	pop    %esi
+  80242f:	5f                   	pop    %edi
+  802430:	5d                   	pop    %ebp
+  802431:	c3                   	ret
+
+00802432 <devcons_read>:
+{
+  802432:	55                   	push   %ebp
+  802433:	89 e5                	mov    %esp,%ebp
+  802435:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802441:	75 07                	jne    80244a <devcons_read+0x18>
+  802443:	eb 1f                	jmp    802464 <devcons_read+0x32>
+		sys_yield();
+  802445:	e8 0b dd ff ff       	call   800155 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80244a:	e8 6f dc ff ff       	call   8000be <sys_cgetc>
+  80244f:	85 c0                	test   %eax,%eax
+  802451:	74 f2                	je     802445 <devcons_read+0x13>
+	if (c < 0)
+  802453:	78 0f                	js     802464 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802455:	83 f8 04             	cmp    $0x4,%eax
+  802458:	74 0c                	je     802466 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80245a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80245d:	88 02                	mov    %al,(%edx)
+	return 1;
+  80245f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802464:	c9                   	leave
+  802465:	c3                   	ret
+		return 0;
+  802466:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246b:	eb f7                	jmp    802464 <devcons_read+0x32>
+
+0080246d <cputchar>:
+{
+  80246d:	55                   	push   %ebp
+  80246e:	89 e5                	mov    %esp,%ebp
+  802470:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802473:	8b 45 08             	mov    0x8(%ebp),%eax
+  802476:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802479:	6a 01                	push   $0x1
+  80247b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80247e:	50                   	push   %eax
+  80247f:	e8 14 dc ff ff       	call   800098 <sys_cputs>
+}
+  802484:	83 c4 10             	add    $0x10,%esp
+  802487:	c9                   	leave
+  802488:	c3                   	ret
+
+00802489 <getchar>:
+{
+  802489:	55                   	push   %ebp
+  80248a:	89 e5                	mov    %esp,%ebp
+  80248c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80248f:	6a 01                	push   $0x1
+  802491:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802494:	50                   	push   %eax
+  802495:	6a 00                	push   $0x0
+  802497:	e8 bc e3 ff ff       	call   800858 <read>
+	if (r < 0)
+  80249c:	83 c4 10             	add    $0x10,%esp
+  80249f:	85 c0                	test   %eax,%eax
+  8024a1:	78 06                	js     8024a9 <getchar+0x20>
+	if (r < 1)
+  8024a3:	74 06                	je     8024ab <getchar+0x22>
+	return c;
+  8024a5:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8024a9:	c9                   	leave
+  8024aa:	c3                   	ret
+		return -E_EOF;
+  8024ab:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8024b0:	eb f7                	jmp    8024a9 <getchar+0x20>
+
+008024b2 <iscons>:
+{
+  8024b2:	55                   	push   %ebp
+  8024b3:	89 e5                	mov    %esp,%ebp
+  8024b5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024bb:	50                   	push   %eax
+  8024bc:	ff 75 08             	push   0x8(%ebp)
+  8024bf:	e8 2e e1 ff ff       	call   8005f2 <fd_lookup>
+  8024c4:	83 c4 10             	add    $0x10,%esp
+  8024c7:	85 c0                	test   %eax,%eax
+  8024c9:	78 11                	js     8024dc <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8024cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024ce:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8024d4:	39 10                	cmp    %edx,(%eax)
+  8024d6:	0f 94 c0             	sete   %al
+  8024d9:	0f b6 c0             	movzbl %al,%eax
+}
+  8024dc:	c9                   	leave
+  8024dd:	c3                   	ret
+
+008024de <opencons>:
+{
+  8024de:	55                   	push   %ebp
+  8024df:	89 e5                	mov    %esp,%ebp
+  8024e1:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8024e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024e7:	50                   	push   %eax
+  8024e8:	e8 af e0 ff ff       	call   80059c <fd_alloc>
+  8024ed:	83 c4 10             	add    $0x10,%esp
+  8024f0:	85 c0                	test   %eax,%eax
+  8024f2:	78 3a                	js     80252e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8024f4:	83 ec 04             	sub    $0x4,%esp
+  8024f7:	68 07 04 00 00       	push   $0x407
+  8024fc:	ff 75 f4             	push   -0xc(%ebp)
+  8024ff:	6a 00                	push   $0x0
+  802501:	e8 6e dc ff ff       	call   800174 <sys_page_alloc>
+  802506:	83 c4 10             	add    $0x10,%esp
+  802509:	85 c0                	test   %eax,%eax
+  80250b:	78 21                	js     80252e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80250d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802510:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802516:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802518:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80251b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802522:	83 ec 0c             	sub    $0xc,%esp
+  802525:	50                   	push   %eax
+  802526:	e8 4a e0 ff ff       	call   800575 <fd2num>
+  80252b:	83 c4 10             	add    $0x10,%esp
+}
+  80252e:	c9                   	leave
+  80252f:	c3                   	ret
+
+00802530 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802530:	55                   	push   %ebp
+  802531:	89 e5                	mov    %esp,%ebp
+  802533:	56                   	push   %esi
+  802534:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802535:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802538:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80253e:	e8 eb db ff ff       	call   80012e <sys_getenvid>
+  802543:	83 ec 0c             	sub    $0xc,%esp
+  802546:	ff 75 0c             	push   0xc(%ebp)
+  802549:	ff 75 08             	push   0x8(%ebp)
+  80254c:	56                   	push   %esi
+  80254d:	50                   	push   %eax
+  80254e:	68 e0 38 80 00       	push   $0x8038e0
+  802553:	e8 b3 00 00 00       	call   80260b <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802558:	83 c4 18             	add    $0x18,%esp
+  80255b:	53                   	push   %ebx
+  80255c:	ff 75 10             	push   0x10(%ebp)
+  80255f:	e8 56 00 00 00       	call   8025ba <vcprintf>
+	cprintf("\n");
+  802564:	c7 04 24 cb 38 80 00 	movl   $0x8038cb,(%esp)
+  80256b:	e8 9b 00 00 00       	call   80260b <cprintf>
+  802570:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802573:	cc                   	int3
+	while (1)
+  802574:	eb fd                	jmp    802573 <_panic+0x43>
+
+00802576 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  802576:	55                   	push   %ebp
+  802577:	89 e5                	mov    %esp,%ebp
+  802579:	53                   	push   %ebx
+  80257a:	83 ec 04             	sub    $0x4,%esp
+  80257d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802580:	8b 13                	mov    (%ebx),%edx
+  802582:	8d 42 01             	lea    0x1(%edx),%eax
+  802585:	89 03                	mov    %eax,(%ebx)
+  802587:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80258a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80258e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802593:	74 09                	je     80259e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  802595:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  802599:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80259c:	c9                   	leave
+  80259d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80259e:	83 ec 08             	sub    $0x8,%esp
+  8025a1:	68 ff 00 00 00       	push   $0xff
+  8025a6:	8d 43 08             	lea    0x8(%ebx),%eax
+  8025a9:	50                   	push   %eax
+  8025aa:	e8 e9 da ff ff       	call   800098 <sys_cputs>
+		b->idx = 0;
+  8025af:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8025b5:	83 c4 10             	add    $0x10,%esp
+  8025b8:	eb db                	jmp    802595 <putch+0x1f>
+
+008025ba <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8025ba:	55                   	push   %ebp
+  8025bb:	89 e5                	mov    %esp,%ebp
+  8025bd:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8025c3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8025ca:	00 00 00 
+	b.cnt = 0;
+  8025cd:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8025d4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8025d7:	ff 75 0c             	push   0xc(%ebp)
+  8025da:	ff 75 08             	push   0x8(%ebp)
+  8025dd:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8025e3:	50                   	push   %eax
+  8025e4:	68 76 25 80 00       	push   $0x802576
+  8025e9:	e8 14 01 00 00       	call   802702 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8025ee:	83 c4 08             	add    $0x8,%esp
+  8025f1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8025f7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8025fd:	50                   	push   %eax
+  8025fe:	e8 95 da ff ff       	call   800098 <sys_cputs>
+
+	return b.cnt;
+}
+  802603:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802609:	c9                   	leave
+  80260a:	c3                   	ret
+
+0080260b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80260b:	55                   	push   %ebp
+  80260c:	89 e5                	mov    %esp,%ebp
+  80260e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802611:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802614:	50                   	push   %eax
+  802615:	ff 75 08             	push   0x8(%ebp)
+  802618:	e8 9d ff ff ff       	call   8025ba <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80261d:	c9                   	leave
+  80261e:	c3                   	ret
+
+0080261f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80261f:	55                   	push   %ebp
+  802620:	89 e5                	mov    %esp,%ebp
+  802622:	57                   	push   %edi
+  802623:	56                   	push   %esi
+  802624:	53                   	push   %ebx
+  802625:	83 ec 1c             	sub    $0x1c,%esp
+  802628:	89 c7                	mov    %eax,%edi
+  80262a:	89 d6                	mov    %edx,%esi
+  80262c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80262f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802632:	89 d1                	mov    %edx,%ecx
+  802634:	89 c2                	mov    %eax,%edx
+  802636:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802639:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80263c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80263f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802642:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802645:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80264c:	39 c2                	cmp    %eax,%edx
+  80264e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802651:	72 3e                	jb     802691 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802653:	83 ec 0c             	sub    $0xc,%esp
+  802656:	ff 75 18             	push   0x18(%ebp)
+  802659:	83 eb 01             	sub    $0x1,%ebx
+  80265c:	53                   	push   %ebx
+  80265d:	50                   	push   %eax
+  80265e:	83 ec 08             	sub    $0x8,%esp
+  802661:	ff 75 e4             	push   -0x1c(%ebp)
+  802664:	ff 75 e0             	push   -0x20(%ebp)
+  802667:	ff 75 dc             	push   -0x24(%ebp)
+  80266a:	ff 75 d8             	push   -0x28(%ebp)
+  80266d:	e8 59 0f 00 00       	call   8035cb <__udivdi3>
+  802672:	83 c4 18             	add    $0x18,%esp
+  802675:	52                   	push   %edx
+  802676:	50                   	push   %eax
+  802677:	89 f2                	mov    %esi,%edx
+  802679:	89 f8                	mov    %edi,%eax
+  80267b:	e8 9f ff ff ff       	call   80261f <printnum>
+  802680:	83 c4 20             	add    $0x20,%esp
+  802683:	eb 13                	jmp    802698 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  802685:	83 ec 08             	sub    $0x8,%esp
+  802688:	56                   	push   %esi
+  802689:	ff 75 18             	push   0x18(%ebp)
+  80268c:	ff d7                	call   *%edi
+  80268e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  802691:	83 eb 01             	sub    $0x1,%ebx
+  802694:	85 db                	test   %ebx,%ebx
+  802696:	7f ed                	jg     802685 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  802698:	83 ec 08             	sub    $0x8,%esp
+  80269b:	56                   	push   %esi
+  80269c:	83 ec 04             	sub    $0x4,%esp
+  80269f:	ff 75 e4             	push   -0x1c(%ebp)
+  8026a2:	ff 75 e0             	push   -0x20(%ebp)
+  8026a5:	ff 75 dc             	push   -0x24(%ebp)
+  8026a8:	ff 75 d8             	push   -0x28(%ebp)
+  8026ab:	e8 39 0f 00 00       	call   8035e9 <__umoddi3>
+  8026b0:	83 c4 14             	add    $0x14,%esp
+  8026b3:	0f be 80 03 39 80 00 	movsbl 0x803903(%eax),%eax
+  8026ba:	50                   	push   %eax
+  8026bb:	ff d7                	call   *%edi
+}
+  8026bd:	83 c4 10             	add    $0x10,%esp
+  8026c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026c3:	5b                   	pop    %ebx
+  8026c4:	5e                   	pop    %esi
+  8026c5:	5f                   	pop    %edi
+  8026c6:	5d                   	pop    %ebp
+  8026c7:	c3                   	ret
+
+008026c8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8026c8:	55                   	push   %ebp
+  8026c9:	89 e5                	mov    %esp,%ebp
+  8026cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8026ce:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8026d2:	8b 10                	mov    (%eax),%edx
+  8026d4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8026d7:	73 0a                	jae    8026e3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8026d9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8026dc:	89 08                	mov    %ecx,(%eax)
+  8026de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e1:	88 02                	mov    %al,(%edx)
+}
+  8026e3:	5d                   	pop    %ebp
+  8026e4:	c3                   	ret
+
+008026e5 <printfmt>:
+{
+  8026e5:	55                   	push   %ebp
+  8026e6:	89 e5                	mov    %esp,%ebp
+  8026e8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8026eb:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8026ee:	50                   	push   %eax
+  8026ef:	ff 75 10             	push   0x10(%ebp)
+  8026f2:	ff 75 0c             	push   0xc(%ebp)
+  8026f5:	ff 75 08             	push   0x8(%ebp)
+  8026f8:	e8 05 00 00 00       	call   802702 <vprintfmt>
+}
+  8026fd:	83 c4 10             	add    $0x10,%esp
+  802700:	c9                   	leave
+  802701:	c3                   	ret
+
+00802702 <vprintfmt>:
+{
+  802702:	55                   	push   %ebp
+  802703:	89 e5                	mov    %esp,%ebp
+  802705:	57                   	push   %edi
+  802706:	56                   	push   %esi
+  802707:	53                   	push   %ebx
+  802708:	83 ec 2c             	sub    $0x2c,%esp
+  80270b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80270e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802711:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802714:	eb 0a                	jmp    802720 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  802716:	83 ec 08             	sub    $0x8,%esp
+  802719:	53                   	push   %ebx
+  80271a:	50                   	push   %eax
+  80271b:	ff d6                	call   *%esi
+  80271d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802720:	83 c7 01             	add    $0x1,%edi
+  802723:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  802727:	83 f8 25             	cmp    $0x25,%eax
+  80272a:	74 0c                	je     802738 <vprintfmt+0x36>
+			if (ch == '\0')
+  80272c:	85 c0                	test   %eax,%eax
+  80272e:	75 e6                	jne    802716 <vprintfmt+0x14>
+}
+  802730:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802733:	5b                   	pop    %ebx
+  802734:	5e                   	pop    %esi
+  802735:	5f                   	pop    %edi
+  802736:	5d                   	pop    %ebp
+  802737:	c3                   	ret
+		padc = ' ';
+  802738:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80273c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802743:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80274a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  802751:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  802756:	8d 47 01             	lea    0x1(%edi),%eax
+  802759:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80275c:	0f b6 17             	movzbl (%edi),%edx
+  80275f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  802762:	3c 55                	cmp    $0x55,%al
+  802764:	0f 87 cf 03 00 00    	ja     802b39 <vprintfmt+0x437>
+  80276a:	0f b6 c0             	movzbl %al,%eax
+  80276d:	ff 24 85 60 3a 80 00 	jmp    *0x803a60(,%eax,4)
+  802774:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  802777:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80277b:	eb d9                	jmp    802756 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80277d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802780:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  802784:	eb d0                	jmp    802756 <vprintfmt+0x54>
+  802786:	0f b6 d2             	movzbl %dl,%edx
+  802789:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80278c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802791:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  802794:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  802797:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80279b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80279e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8027a1:	83 f9 09             	cmp    $0x9,%ecx
+  8027a4:	77 55                	ja     8027fb <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8027a6:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8027a9:	eb e9                	jmp    802794 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8027ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027ae:	8b 00                	mov    (%eax),%eax
+  8027b0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8027b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8027b9:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8027bf:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8027c3:	79 91                	jns    802756 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8027c5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8027c8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8027cb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8027d2:	eb 82                	jmp    802756 <vprintfmt+0x54>
+			if (width < 0)
+  8027d4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8027d7:	85 d2                	test   %edx,%edx
+  8027d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027de:	0f 49 c2             	cmovns %edx,%eax
+  8027e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8027e7:	e9 6a ff ff ff       	jmp    802756 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8027ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8027ef:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8027f6:	e9 5b ff ff ff       	jmp    802756 <vprintfmt+0x54>
+  8027fb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8027fe:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802801:	eb bc                	jmp    8027bf <vprintfmt+0xbd>
+			lflag++;
+  802803:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  802806:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  802809:	e9 48 ff ff ff       	jmp    802756 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80280e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802811:	8d 78 04             	lea    0x4(%eax),%edi
+  802814:	83 ec 08             	sub    $0x8,%esp
+  802817:	53                   	push   %ebx
+  802818:	ff 30                	push   (%eax)
+  80281a:	ff d6                	call   *%esi
+			break;
+  80281c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80281f:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  802822:	e9 b1 02 00 00       	jmp    802ad8 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  802827:	8b 45 14             	mov    0x14(%ebp),%eax
+  80282a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80282d:	8b 10                	mov    (%eax),%edx
+  80282f:	89 d0                	mov    %edx,%eax
+  802831:	f7 d8                	neg    %eax
+  802833:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802836:	83 f8 11             	cmp    $0x11,%eax
+  802839:	7f 23                	jg     80285e <vprintfmt+0x15c>
+  80283b:	8b 14 85 c0 3b 80 00 	mov    0x803bc0(,%eax,4),%edx
+  802842:	85 d2                	test   %edx,%edx
+  802844:	74 18                	je     80285e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  802846:	52                   	push   %edx
+  802847:	68 36 38 80 00       	push   $0x803836
+  80284c:	53                   	push   %ebx
+  80284d:	56                   	push   %esi
+  80284e:	e8 92 fe ff ff       	call   8026e5 <printfmt>
+  802853:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802856:	89 7d 14             	mov    %edi,0x14(%ebp)
+  802859:	e9 7a 02 00 00       	jmp    802ad8 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80285e:	50                   	push   %eax
+  80285f:	68 1b 39 80 00       	push   $0x80391b
+  802864:	53                   	push   %ebx
+  802865:	56                   	push   %esi
+  802866:	e8 7a fe ff ff       	call   8026e5 <printfmt>
+  80286b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80286e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802871:	e9 62 02 00 00       	jmp    802ad8 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802876:	8b 45 14             	mov    0x14(%ebp),%eax
+  802879:	83 c0 04             	add    $0x4,%eax
+  80287c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80287f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802882:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  802884:	85 c9                	test   %ecx,%ecx
+  802886:	b8 14 39 80 00       	mov    $0x803914,%eax
+  80288b:	0f 45 c1             	cmovne %ecx,%eax
+  80288e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  802891:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  802895:	7e 06                	jle    80289d <vprintfmt+0x19b>
+  802897:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80289b:	75 0b                	jne    8028a8 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80289d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8028a0:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8028a3:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028a6:	eb 5c                	jmp    802904 <vprintfmt+0x202>
+  8028a8:	83 ec 08             	sub    $0x8,%esp
+  8028ab:	ff 75 d0             	push   -0x30(%ebp)
+  8028ae:	ff 75 cc             	push   -0x34(%ebp)
+  8028b1:	e8 20 03 00 00       	call   802bd6 <strnlen>
+  8028b6:	89 c2                	mov    %eax,%edx
+  8028b8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028bb:	29 d0                	sub    %edx,%eax
+  8028bd:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8028c0:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8028c4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028c7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028ca:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028cc:	eb 0e                	jmp    8028dc <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8028ce:	83 ec 08             	sub    $0x8,%esp
+  8028d1:	53                   	push   %ebx
+  8028d2:	57                   	push   %edi
+  8028d3:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028d6:	83 ee 01             	sub    $0x1,%esi
+  8028d9:	83 c4 10             	add    $0x10,%esp
+  8028dc:	85 f6                	test   %esi,%esi
+  8028de:	7f ee                	jg     8028ce <vprintfmt+0x1cc>
+  8028e0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028e6:	85 c0                	test   %eax,%eax
+  8028e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ed:	0f 49 d0             	cmovns %eax,%edx
+  8028f0:	29 d0                	sub    %edx,%eax
+  8028f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028f5:	eb a6                	jmp    80289d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8028f7:	83 ec 08             	sub    $0x8,%esp
+  8028fa:	53                   	push   %ebx
+  8028fb:	52                   	push   %edx
+  8028fc:	ff 55 08             	call   *0x8(%ebp)
+  8028ff:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802902:	89 f1                	mov    %esi,%ecx
+  802904:	8d 71 01             	lea    0x1(%ecx),%esi
+  802907:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80290b:	0f be d0             	movsbl %al,%edx
+  80290e:	85 d2                	test   %edx,%edx
+  802910:	74 28                	je     80293a <vprintfmt+0x238>
+  802912:	85 ff                	test   %edi,%edi
+  802914:	78 05                	js     80291b <vprintfmt+0x219>
+  802916:	83 ef 01             	sub    $0x1,%edi
+  802919:	78 30                	js     80294b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80291b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80291f:	74 d6                	je     8028f7 <vprintfmt+0x1f5>
+  802921:	0f be c0             	movsbl %al,%eax
+  802924:	83 e8 20             	sub    $0x20,%eax
+  802927:	83 f8 5e             	cmp    $0x5e,%eax
+  80292a:	76 cb                	jbe    8028f7 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80292c:	83 ec 08             	sub    $0x8,%esp
+  80292f:	53                   	push   %ebx
+  802930:	6a 3f                	push   $0x3f
+  802932:	ff 55 08             	call   *0x8(%ebp)
+  802935:	83 c4 10             	add    $0x10,%esp
+  802938:	eb c8                	jmp    802902 <vprintfmt+0x200>
+  80293a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80293d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802940:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802943:	01 d0                	add    %edx,%eax
+  802945:	29 c8                	sub    %ecx,%eax
+  802947:	89 c7                	mov    %eax,%edi
+  802949:	eb 13                	jmp    80295e <vprintfmt+0x25c>
+  80294b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80294e:	eb ed                	jmp    80293d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  802950:	83 ec 08             	sub    $0x8,%esp
+  802953:	53                   	push   %ebx
+  802954:	6a 20                	push   $0x20
+  802956:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  802958:	83 ef 01             	sub    $0x1,%edi
+  80295b:	83 c4 10             	add    $0x10,%esp
+  80295e:	85 ff                	test   %edi,%edi
+  802960:	7f ee                	jg     802950 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802962:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  802965:	89 45 14             	mov    %eax,0x14(%ebp)
+  802968:	e9 6b 01 00 00       	jmp    802ad8 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80296d:	83 f9 01             	cmp    $0x1,%ecx
+  802970:	7f 1f                	jg     802991 <vprintfmt+0x28f>
+	else if (lflag)
+  802972:	85 c9                	test   %ecx,%ecx
+  802974:	74 67                	je     8029dd <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  802976:	8b 45 14             	mov    0x14(%ebp),%eax
+  802979:	8b 00                	mov    (%eax),%eax
+  80297b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80297e:	89 c1                	mov    %eax,%ecx
+  802980:	c1 f9 1f             	sar    $0x1f,%ecx
+  802983:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802986:	8b 45 14             	mov    0x14(%ebp),%eax
+  802989:	8d 40 04             	lea    0x4(%eax),%eax
+  80298c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80298f:	eb 17                	jmp    8029a8 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  802991:	8b 45 14             	mov    0x14(%ebp),%eax
+  802994:	8b 50 04             	mov    0x4(%eax),%edx
+  802997:	8b 00                	mov    (%eax),%eax
+  802999:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80299c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80299f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029a2:	8d 40 08             	lea    0x8(%eax),%eax
+  8029a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8029a8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029ab:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8029ae:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8029b3:	85 c9                	test   %ecx,%ecx
+  8029b5:	0f 89 03 01 00 00    	jns    802abe <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8029bb:	83 ec 08             	sub    $0x8,%esp
+  8029be:	53                   	push   %ebx
+  8029bf:	6a 2d                	push   $0x2d
+  8029c1:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8029c3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029c6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8029c9:	f7 da                	neg    %edx
+  8029cb:	83 d1 00             	adc    $0x0,%ecx
+  8029ce:	f7 d9                	neg    %ecx
+  8029d0:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8029d3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029d8:	e9 e1 00 00 00       	jmp    802abe <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8029dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029e0:	8b 00                	mov    (%eax),%eax
+  8029e2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029e5:	89 c1                	mov    %eax,%ecx
+  8029e7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8029ea:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8029ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8029f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8029f6:	eb b0                	jmp    8029a8 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8029f8:	83 f9 01             	cmp    $0x1,%ecx
+  8029fb:	7f 1e                	jg     802a1b <vprintfmt+0x319>
+	else if (lflag)
+  8029fd:	85 c9                	test   %ecx,%ecx
+  8029ff:	74 32                	je     802a33 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802a01:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a04:	8b 10                	mov    (%eax),%edx
+  802a06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a0b:	8d 40 04             	lea    0x4(%eax),%eax
+  802a0e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a11:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  802a16:	e9 a3 00 00 00       	jmp    802abe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a1b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a1e:	8b 10                	mov    (%eax),%edx
+  802a20:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a23:	8d 40 08             	lea    0x8(%eax),%eax
+  802a26:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a29:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  802a2e:	e9 8b 00 00 00       	jmp    802abe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a33:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a36:	8b 10                	mov    (%eax),%edx
+  802a38:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a3d:	8d 40 04             	lea    0x4(%eax),%eax
+  802a40:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a43:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  802a48:	eb 74                	jmp    802abe <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  802a4a:	83 f9 01             	cmp    $0x1,%ecx
+  802a4d:	7f 1b                	jg     802a6a <vprintfmt+0x368>
+	else if (lflag)
+  802a4f:	85 c9                	test   %ecx,%ecx
+  802a51:	74 2c                	je     802a7f <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  802a53:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a56:	8b 10                	mov    (%eax),%edx
+  802a58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a5d:	8d 40 04             	lea    0x4(%eax),%eax
+  802a60:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a63:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  802a68:	eb 54                	jmp    802abe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a6d:	8b 10                	mov    (%eax),%edx
+  802a6f:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a72:	8d 40 08             	lea    0x8(%eax),%eax
+  802a75:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a78:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  802a7d:	eb 3f                	jmp    802abe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a82:	8b 10                	mov    (%eax),%edx
+  802a84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a89:	8d 40 04             	lea    0x4(%eax),%eax
+  802a8c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a8f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802a94:	eb 28                	jmp    802abe <vprintfmt+0x3bc>
+			putch('0', putdat);
+  802a96:	83 ec 08             	sub    $0x8,%esp
+  802a99:	53                   	push   %ebx
+  802a9a:	6a 30                	push   $0x30
+  802a9c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802a9e:	83 c4 08             	add    $0x8,%esp
+  802aa1:	53                   	push   %ebx
+  802aa2:	6a 78                	push   $0x78
+  802aa4:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802aa6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802aa9:	8b 10                	mov    (%eax),%edx
+  802aab:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802ab0:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802ab3:	8d 40 04             	lea    0x4(%eax),%eax
+  802ab6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802ab9:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802abe:	83 ec 0c             	sub    $0xc,%esp
+  802ac1:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802ac5:	50                   	push   %eax
+  802ac6:	ff 75 e0             	push   -0x20(%ebp)
+  802ac9:	57                   	push   %edi
+  802aca:	51                   	push   %ecx
+  802acb:	52                   	push   %edx
+  802acc:	89 da                	mov    %ebx,%edx
+  802ace:	89 f0                	mov    %esi,%eax
+  802ad0:	e8 4a fb ff ff       	call   80261f <printnum>
+			break;
+  802ad5:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802ad8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802adb:	e9 40 fc ff ff       	jmp    802720 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802ae0:	83 f9 01             	cmp    $0x1,%ecx
+  802ae3:	7f 1b                	jg     802b00 <vprintfmt+0x3fe>
+	else if (lflag)
+  802ae5:	85 c9                	test   %ecx,%ecx
+  802ae7:	74 2c                	je     802b15 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802ae9:	8b 45 14             	mov    0x14(%ebp),%eax
+  802aec:	8b 10                	mov    (%eax),%edx
+  802aee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802af3:	8d 40 04             	lea    0x4(%eax),%eax
+  802af6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802af9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802afe:	eb be                	jmp    802abe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802b00:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b03:	8b 10                	mov    (%eax),%edx
+  802b05:	8b 48 04             	mov    0x4(%eax),%ecx
+  802b08:	8d 40 08             	lea    0x8(%eax),%eax
+  802b0b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b0e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802b13:	eb a9                	jmp    802abe <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802b15:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b18:	8b 10                	mov    (%eax),%edx
+  802b1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b1f:	8d 40 04             	lea    0x4(%eax),%eax
+  802b22:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b25:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  802b2a:	eb 92                	jmp    802abe <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  802b2c:	83 ec 08             	sub    $0x8,%esp
+  802b2f:	53                   	push   %ebx
+  802b30:	6a 25                	push   $0x25
+  802b32:	ff d6                	call   *%esi
+			break;
+  802b34:	83 c4 10             	add    $0x10,%esp
+  802b37:	eb 9f                	jmp    802ad8 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  802b39:	83 ec 08             	sub    $0x8,%esp
+  802b3c:	53                   	push   %ebx
+  802b3d:	6a 25                	push   $0x25
+  802b3f:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802b41:	83 c4 10             	add    $0x10,%esp
+  802b44:	89 f8                	mov    %edi,%eax
+  802b46:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802b4a:	74 05                	je     802b51 <vprintfmt+0x44f>
+  802b4c:	83 e8 01             	sub    $0x1,%eax
+  802b4f:	eb f5                	jmp    802b46 <vprintfmt+0x444>
+  802b51:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b54:	eb 82                	jmp    802ad8 <vprintfmt+0x3d6>
+
+00802b56 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802b56:	55                   	push   %ebp
+  802b57:	89 e5                	mov    %esp,%ebp
+  802b59:	83 ec 18             	sub    $0x18,%esp
+  802b5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  802b62:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802b65:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802b69:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802b6c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802b73:	85 c0                	test   %eax,%eax
+  802b75:	74 26                	je     802b9d <vsnprintf+0x47>
+  802b77:	85 d2                	test   %edx,%edx
+  802b79:	7e 22                	jle    802b9d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  802b7b:	ff 75 14             	push   0x14(%ebp)
+  802b7e:	ff 75 10             	push   0x10(%ebp)
+  802b81:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802b84:	50                   	push   %eax
+  802b85:	68 c8 26 80 00       	push   $0x8026c8
+  802b8a:	e8 73 fb ff ff       	call   802702 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802b8f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802b92:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802b95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b98:	83 c4 10             	add    $0x10,%esp
+}
+  802b9b:	c9                   	leave
+  802b9c:	c3                   	ret
+		return -E_INVAL;
+  802b9d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ba2:	eb f7                	jmp    802b9b <vsnprintf+0x45>
+
+00802ba4 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802ba4:	55                   	push   %ebp
+  802ba5:	89 e5                	mov    %esp,%ebp
+  802ba7:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  802baa:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802bad:	50                   	push   %eax
+  802bae:	ff 75 10             	push   0x10(%ebp)
+  802bb1:	ff 75 0c             	push   0xc(%ebp)
+  802bb4:	ff 75 08             	push   0x8(%ebp)
+  802bb7:	e8 9a ff ff ff       	call   802b56 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802bbc:	c9                   	leave
+  802bbd:	c3                   	ret
+
+00802bbe <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802bbe:	55                   	push   %ebp
+  802bbf:	89 e5                	mov    %esp,%ebp
+  802bc1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc9:	eb 03                	jmp    802bce <strlen+0x10>
+		n++;
+  802bcb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802bce:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802bd2:	75 f7                	jne    802bcb <strlen+0xd>
+	return n;
+}
+  802bd4:	5d                   	pop    %ebp
+  802bd5:	c3                   	ret
+
+00802bd6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802bd6:	55                   	push   %ebp
+  802bd7:	89 e5                	mov    %esp,%ebp
+  802bd9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802bdc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be4:	eb 03                	jmp    802be9 <strnlen+0x13>
+		n++;
+  802be6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802be9:	39 d0                	cmp    %edx,%eax
+  802beb:	74 08                	je     802bf5 <strnlen+0x1f>
+  802bed:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802bf1:	75 f3                	jne    802be6 <strnlen+0x10>
+  802bf3:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802bf5:	89 d0                	mov    %edx,%eax
+  802bf7:	5d                   	pop    %ebp
+  802bf8:	c3                   	ret
+
+00802bf9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802bf9:	55                   	push   %ebp
+  802bfa:	89 e5                	mov    %esp,%ebp
+  802bfc:	53                   	push   %ebx
+  802bfd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c00:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802c03:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c08:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802c0c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802c0f:	83 c0 01             	add    $0x1,%eax
+  802c12:	84 d2                	test   %dl,%dl
+  802c14:	75 f2                	jne    802c08 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  802c16:	89 c8                	mov    %ecx,%eax
+  802c18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c1b:	c9                   	leave
+  802c1c:	c3                   	ret
+
+00802c1d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802c1d:	55                   	push   %ebp
+  802c1e:	89 e5                	mov    %esp,%ebp
+  802c20:	53                   	push   %ebx
+  802c21:	83 ec 10             	sub    $0x10,%esp
+  802c24:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  802c27:	53                   	push   %ebx
+  802c28:	e8 91 ff ff ff       	call   802bbe <strlen>
+  802c2d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  802c30:	ff 75 0c             	push   0xc(%ebp)
+  802c33:	01 d8                	add    %ebx,%eax
+  802c35:	50                   	push   %eax
+  802c36:	e8 be ff ff ff       	call   802bf9 <strcpy>
+	return dst;
+}
+  802c3b:	89 d8                	mov    %ebx,%eax
+  802c3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c40:	c9                   	leave
+  802c41:	c3                   	ret
+
+00802c42 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802c42:	55                   	push   %ebp
+  802c43:	89 e5                	mov    %esp,%ebp
+  802c45:	56                   	push   %esi
+  802c46:	53                   	push   %ebx
+  802c47:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c4a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  802c4d:	89 f3                	mov    %esi,%ebx
+  802c4f:	03 5d 10             	add    0x10(%ebp),%ebx
+  802c52:	89 f0                	mov    %esi,%eax
+  802c54:	eb 0f                	jmp    802c65 <strncpy+0x23>
+		*dst++ = *src;
+  802c56:	83 c0 01             	add    $0x1,%eax
+  802c59:	0f b6 0a             	movzbl (%edx),%ecx
+  802c5c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  802c5f:	80 f9 01             	cmp    $0x1,%cl
+  802c62:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  802c65:	39 d8                	cmp    %ebx,%eax
+  802c67:	75 ed                	jne    802c56 <strncpy+0x14>
+	}
+	return ret;
+}
+  802c69:	89 f0                	mov    %esi,%eax
+  802c6b:	5b                   	pop    %ebx
+  802c6c:	5e                   	pop    %esi
+  802c6d:	5d                   	pop    %ebp
+  802c6e:	c3                   	ret
+
+00802c6f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802c6f:	55                   	push   %ebp
+  802c70:	89 e5                	mov    %esp,%ebp
+  802c72:	56                   	push   %esi
+  802c73:	53                   	push   %ebx
+  802c74:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c7a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  802c7d:	89 f0                	mov    %esi,%eax
+  802c7f:	85 d2                	test   %edx,%edx
+  802c81:	74 21                	je     802ca4 <strlcpy+0x35>
+  802c83:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  802c87:	89 f2                	mov    %esi,%edx
+  802c89:	eb 09                	jmp    802c94 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  802c8b:	83 c1 01             	add    $0x1,%ecx
+  802c8e:	83 c2 01             	add    $0x1,%edx
+  802c91:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  802c94:	39 c2                	cmp    %eax,%edx
+  802c96:	74 09                	je     802ca1 <strlcpy+0x32>
+  802c98:	0f b6 19             	movzbl (%ecx),%ebx
+  802c9b:	84 db                	test   %bl,%bl
+  802c9d:	75 ec                	jne    802c8b <strlcpy+0x1c>
+  802c9f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802ca1:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802ca4:	29 f0                	sub    %esi,%eax
+}
+  802ca6:	5b                   	pop    %ebx
+  802ca7:	5e                   	pop    %esi
+  802ca8:	5d                   	pop    %ebp
+  802ca9:	c3                   	ret
+
+00802caa <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802caa:	55                   	push   %ebp
+  802cab:	89 e5                	mov    %esp,%ebp
+  802cad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802cb0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802cb3:	eb 06                	jmp    802cbb <strcmp+0x11>
+		p++, q++;
+  802cb5:	83 c1 01             	add    $0x1,%ecx
+  802cb8:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802cbb:	0f b6 01             	movzbl (%ecx),%eax
+  802cbe:	84 c0                	test   %al,%al
+  802cc0:	74 04                	je     802cc6 <strcmp+0x1c>
+  802cc2:	3a 02                	cmp    (%edx),%al
+  802cc4:	74 ef                	je     802cb5 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802cc6:	0f b6 c0             	movzbl %al,%eax
+  802cc9:	0f b6 12             	movzbl (%edx),%edx
+  802ccc:	29 d0                	sub    %edx,%eax
+}
+  802cce:	5d                   	pop    %ebp
+  802ccf:	c3                   	ret
+
+00802cd0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802cd0:	55                   	push   %ebp
+  802cd1:	89 e5                	mov    %esp,%ebp
+  802cd3:	53                   	push   %ebx
+  802cd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cda:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802cdd:	eb 09                	jmp    802ce8 <strncmp+0x18>
+		n--, p++, q++;
+  802cdf:	83 ea 01             	sub    $0x1,%edx
+  802ce2:	83 c0 01             	add    $0x1,%eax
+  802ce5:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802ce8:	85 d2                	test   %edx,%edx
+  802cea:	74 18                	je     802d04 <strncmp+0x34>
+  802cec:	0f b6 18             	movzbl (%eax),%ebx
+  802cef:	84 db                	test   %bl,%bl
+  802cf1:	74 04                	je     802cf7 <strncmp+0x27>
+  802cf3:	3a 19                	cmp    (%ecx),%bl
+  802cf5:	74 e8                	je     802cdf <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802cf7:	0f b6 00             	movzbl (%eax),%eax
+  802cfa:	0f b6 11             	movzbl (%ecx),%edx
+  802cfd:	29 d0                	sub    %edx,%eax
+}
+  802cff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d02:	c9                   	leave
+  802d03:	c3                   	ret
+		return 0;
+  802d04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d09:	eb f4                	jmp    802cff <strncmp+0x2f>
+
+00802d0b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802d0b:	55                   	push   %ebp
+  802d0c:	89 e5                	mov    %esp,%ebp
+  802d0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d11:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d15:	eb 03                	jmp    802d1a <strchr+0xf>
+  802d17:	83 c0 01             	add    $0x1,%eax
+  802d1a:	0f b6 10             	movzbl (%eax),%edx
+  802d1d:	84 d2                	test   %dl,%dl
+  802d1f:	74 06                	je     802d27 <strchr+0x1c>
+		if (*s == c)
+  802d21:	38 ca                	cmp    %cl,%dl
+  802d23:	75 f2                	jne    802d17 <strchr+0xc>
+  802d25:	eb 05                	jmp    802d2c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  802d27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d2c:	5d                   	pop    %ebp
+  802d2d:	c3                   	ret
+
+00802d2e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802d2e:	55                   	push   %ebp
+  802d2f:	89 e5                	mov    %esp,%ebp
+  802d31:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d34:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d38:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  802d3b:	38 ca                	cmp    %cl,%dl
+  802d3d:	74 09                	je     802d48 <strfind+0x1a>
+  802d3f:	84 d2                	test   %dl,%dl
+  802d41:	74 05                	je     802d48 <strfind+0x1a>
+	for (; *s; s++)
+  802d43:	83 c0 01             	add    $0x1,%eax
+  802d46:	eb f0                	jmp    802d38 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  802d48:	5d                   	pop    %ebp
+  802d49:	c3                   	ret
+
+00802d4a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802d4a:	55                   	push   %ebp
+  802d4b:	89 e5                	mov    %esp,%ebp
+  802d4d:	57                   	push   %edi
+  802d4e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d51:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  802d54:	85 c9                	test   %ecx,%ecx
+  802d56:	74 20                	je     802d78 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  802d58:	89 f8                	mov    %edi,%eax
+  802d5a:	09 c8                	or     %ecx,%eax
+  802d5c:	a8 03                	test   $0x3,%al
+  802d5e:	75 12                	jne    802d72 <memset+0x28>
+		c &= 0xFF;
+  802d60:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802d64:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  802d6a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  802d6d:	fc                   	cld
+  802d6e:	f3 ab                	rep stos %eax,%es:(%edi)
+  802d70:	eb 06                	jmp    802d78 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  802d72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d75:	fc                   	cld
+  802d76:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  802d78:	89 f8                	mov    %edi,%eax
+  802d7a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802d7d:	c9                   	leave
+  802d7e:	c3                   	ret
+
+00802d7f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  802d7f:	55                   	push   %ebp
+  802d80:	89 e5                	mov    %esp,%ebp
+  802d82:	57                   	push   %edi
+  802d83:	56                   	push   %esi
+  802d84:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d87:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d8a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  802d8d:	39 c6                	cmp    %eax,%esi
+  802d8f:	73 32                	jae    802dc3 <memmove+0x44>
+  802d91:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802d94:	39 d0                	cmp    %edx,%eax
+  802d96:	73 2b                	jae    802dc3 <memmove+0x44>
+		s += n;
+		d += n;
+  802d98:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802d9b:	89 d6                	mov    %edx,%esi
+  802d9d:	09 fe                	or     %edi,%esi
+  802d9f:	09 ce                	or     %ecx,%esi
+  802da1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802da7:	75 0e                	jne    802db7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802da9:	83 ef 04             	sub    $0x4,%edi
+  802dac:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802daf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802db2:	fd                   	std
+  802db3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802db5:	eb 09                	jmp    802dc0 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802db7:	83 ef 01             	sub    $0x1,%edi
+  802dba:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802dbd:	fd                   	std
+  802dbe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802dc0:	fc                   	cld
+  802dc1:	eb 1a                	jmp    802ddd <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802dc3:	89 f2                	mov    %esi,%edx
+  802dc5:	09 c2                	or     %eax,%edx
+  802dc7:	09 ca                	or     %ecx,%edx
+  802dc9:	f6 c2 03             	test   $0x3,%dl
+  802dcc:	75 0a                	jne    802dd8 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802dce:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802dd1:	89 c7                	mov    %eax,%edi
+  802dd3:	fc                   	cld
+  802dd4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802dd6:	eb 05                	jmp    802ddd <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802dd8:	89 c7                	mov    %eax,%edi
+  802dda:	fc                   	cld
+  802ddb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802ddd:	5e                   	pop    %esi
+  802dde:	5f                   	pop    %edi
+  802ddf:	5d                   	pop    %ebp
+  802de0:	c3                   	ret
+
+00802de1 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802de1:	55                   	push   %ebp
+  802de2:	89 e5                	mov    %esp,%ebp
+  802de4:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802de7:	ff 75 10             	push   0x10(%ebp)
+  802dea:	ff 75 0c             	push   0xc(%ebp)
+  802ded:	ff 75 08             	push   0x8(%ebp)
+  802df0:	e8 8a ff ff ff       	call   802d7f <memmove>
+}
+  802df5:	c9                   	leave
+  802df6:	c3                   	ret
+
+00802df7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802df7:	55                   	push   %ebp
+  802df8:	89 e5                	mov    %esp,%ebp
+  802dfa:	56                   	push   %esi
+  802dfb:	53                   	push   %ebx
+  802dfc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dff:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802e02:	89 c6                	mov    %eax,%esi
+  802e04:	03 75 10             	add    0x10(%ebp),%esi
+  802e07:	eb 06                	jmp    802e0f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802e09:	83 c0 01             	add    $0x1,%eax
+  802e0c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802e0f:	39 f0                	cmp    %esi,%eax
+  802e11:	74 14                	je     802e27 <memcmp+0x30>
+		if (*s1 != *s2)
+  802e13:	0f b6 08             	movzbl (%eax),%ecx
+  802e16:	0f b6 1a             	movzbl (%edx),%ebx
+  802e19:	38 d9                	cmp    %bl,%cl
+  802e1b:	74 ec                	je     802e09 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802e1d:	0f b6 c1             	movzbl %cl,%eax
+  802e20:	0f b6 db             	movzbl %bl,%ebx
+  802e23:	29 d8                	sub    %ebx,%eax
+  802e25:	eb 05                	jmp    802e2c <memcmp+0x35>
+	}
+
+	return 0;
+  802e27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e2c:	5b                   	pop    %ebx
+  802e2d:	5e                   	pop    %esi
+  802e2e:	5d                   	pop    %ebp
+  802e2f:	c3                   	ret
+
+00802e30 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802e30:	55                   	push   %ebp
+  802e31:	89 e5                	mov    %esp,%ebp
+  802e33:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802e39:	89 c2                	mov    %eax,%edx
+  802e3b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802e3e:	eb 03                	jmp    802e43 <memfind+0x13>
+  802e40:	83 c0 01             	add    $0x1,%eax
+  802e43:	39 d0                	cmp    %edx,%eax
+  802e45:	73 04                	jae    802e4b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802e47:	38 08                	cmp    %cl,(%eax)
+  802e49:	75 f5                	jne    802e40 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802e4b:	5d                   	pop    %ebp
+  802e4c:	c3                   	ret
+
+00802e4d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802e4d:	55                   	push   %ebp
+  802e4e:	89 e5                	mov    %esp,%ebp
+  802e50:	57                   	push   %edi
+  802e51:	56                   	push   %esi
+  802e52:	53                   	push   %ebx
+  802e53:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e56:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802e59:	eb 03                	jmp    802e5e <strtol+0x11>
+		s++;
+  802e5b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802e5e:	0f b6 02             	movzbl (%edx),%eax
+  802e61:	3c 20                	cmp    $0x20,%al
+  802e63:	74 f6                	je     802e5b <strtol+0xe>
+  802e65:	3c 09                	cmp    $0x9,%al
+  802e67:	74 f2                	je     802e5b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802e69:	3c 2b                	cmp    $0x2b,%al
+  802e6b:	74 2a                	je     802e97 <strtol+0x4a>
+	int neg = 0;
+  802e6d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802e72:	3c 2d                	cmp    $0x2d,%al
+  802e74:	74 2b                	je     802ea1 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802e76:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802e7c:	75 0f                	jne    802e8d <strtol+0x40>
+  802e7e:	80 3a 30             	cmpb   $0x30,(%edx)
+  802e81:	74 28                	je     802eab <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802e83:	85 db                	test   %ebx,%ebx
+  802e85:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802e8a:	0f 44 d8             	cmove  %eax,%ebx
+  802e8d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e92:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802e95:	eb 46                	jmp    802edd <strtol+0x90>
+		s++;
+  802e97:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802e9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e9f:	eb d5                	jmp    802e76 <strtol+0x29>
+		s++, neg = 1;
+  802ea1:	83 c2 01             	add    $0x1,%edx
+  802ea4:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ea9:	eb cb                	jmp    802e76 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802eab:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802eaf:	74 0e                	je     802ebf <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802eb1:	85 db                	test   %ebx,%ebx
+  802eb3:	75 d8                	jne    802e8d <strtol+0x40>
+		s++, base = 8;
+  802eb5:	83 c2 01             	add    $0x1,%edx
+  802eb8:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802ebd:	eb ce                	jmp    802e8d <strtol+0x40>
+		s += 2, base = 16;
+  802ebf:	83 c2 02             	add    $0x2,%edx
+  802ec2:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802ec7:	eb c4                	jmp    802e8d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802ec9:	0f be c0             	movsbl %al,%eax
+  802ecc:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802ecf:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802ed2:	7d 3a                	jge    802f0e <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802ed4:	83 c2 01             	add    $0x1,%edx
+  802ed7:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802edb:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802edd:	0f b6 02             	movzbl (%edx),%eax
+  802ee0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802ee3:	89 f3                	mov    %esi,%ebx
+  802ee5:	80 fb 09             	cmp    $0x9,%bl
+  802ee8:	76 df                	jbe    802ec9 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  802eea:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802eed:	89 f3                	mov    %esi,%ebx
+  802eef:	80 fb 19             	cmp    $0x19,%bl
+  802ef2:	77 08                	ja     802efc <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802ef4:	0f be c0             	movsbl %al,%eax
+  802ef7:	83 e8 57             	sub    $0x57,%eax
+  802efa:	eb d3                	jmp    802ecf <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802efc:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802eff:	89 f3                	mov    %esi,%ebx
+  802f01:	80 fb 19             	cmp    $0x19,%bl
+  802f04:	77 08                	ja     802f0e <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802f06:	0f be c0             	movsbl %al,%eax
+  802f09:	83 e8 37             	sub    $0x37,%eax
+  802f0c:	eb c1                	jmp    802ecf <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802f0e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802f12:	74 05                	je     802f19 <strtol+0xcc>
+		*endptr = (char *) s;
+  802f14:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f17:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802f19:	89 c8                	mov    %ecx,%eax
+  802f1b:	f7 d8                	neg    %eax
+  802f1d:	85 ff                	test   %edi,%edi
+  802f1f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802f22:	89 c8                	mov    %ecx,%eax
+  802f24:	5b                   	pop    %ebx
+  802f25:	5e                   	pop    %esi
+  802f26:	5f                   	pop    %edi
+  802f27:	5d                   	pop    %ebp
+  802f28:	c3                   	ret
+
+00802f29 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802f29:	55                   	push   %ebp
+  802f2a:	89 e5                	mov    %esp,%ebp
+  802f2c:	57                   	push   %edi
+  802f2d:	56                   	push   %esi
+  802f2e:	53                   	push   %ebx
+  802f2f:	83 ec 20             	sub    $0x20,%esp
+  802f32:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f35:	89 d7                	mov    %edx,%edi
+  802f37:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802f39:	51                   	push   %ecx
+  802f3a:	68 00 f0 7f 00       	push   $0x7ff000
+  802f3f:	6a 00                	push   $0x0
+  802f41:	e8 2e d2 ff ff       	call   800174 <sys_page_alloc>
+  802f46:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f48:	83 c4 10             	add    $0x10,%esp
+  802f4b:	85 c0                	test   %eax,%eax
+  802f4d:	78 45                	js     802f94 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802f4f:	83 ec 04             	sub    $0x4,%esp
+  802f52:	68 00 10 00 00       	push   $0x1000
+  802f57:	57                   	push   %edi
+  802f58:	68 00 f0 7f 00       	push   $0x7ff000
+  802f5d:	e8 1d fe ff ff       	call   802d7f <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  802f62:	89 34 24             	mov    %esi,(%esp)
+  802f65:	57                   	push   %edi
+  802f66:	ff 75 e4             	push   -0x1c(%ebp)
+  802f69:	68 00 f0 7f 00       	push   $0x7ff000
+  802f6e:	6a 00                	push   $0x0
+  802f70:	e8 4a d2 ff ff       	call   8001bf <sys_page_map>
+  802f75:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f77:	83 c4 20             	add    $0x20,%esp
+  802f7a:	85 c0                	test   %eax,%eax
+  802f7c:	78 16                	js     802f94 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802f7e:	83 ec 08             	sub    $0x8,%esp
+  802f81:	68 00 f0 7f 00       	push   $0x7ff000
+  802f86:	6a 00                	push   $0x0
+  802f88:	e8 74 d2 ff ff       	call   800201 <sys_page_unmap>
+  802f8d:	83 c4 10             	add    $0x10,%esp
+  802f90:	85 c0                	test   %eax,%eax
+  802f92:	75 0a                	jne    802f9e <copy_page_to+0x75>
+exit:
+	return r;
+}
+  802f94:	89 d8                	mov    %ebx,%eax
+  802f96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f99:	5b                   	pop    %ebx
+  802f9a:	5e                   	pop    %esi
+  802f9b:	5f                   	pop    %edi
+  802f9c:	5d                   	pop    %ebp
+  802f9d:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802f9e:	68 28 3c 80 00       	push   $0x803c28
+  802fa3:	68 24 38 80 00       	push   $0x803824
+  802fa8:	6a 1b                	push   $0x1b
+  802faa:	68 a0 3c 80 00       	push   $0x803ca0
+  802faf:	e8 7c f5 ff ff       	call   802530 <_panic>
+
+00802fb4 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802fb4:	55                   	push   %ebp
+  802fb5:	89 e5                	mov    %esp,%ebp
+  802fb7:	53                   	push   %ebx
+  802fb8:	83 ec 04             	sub    $0x4,%esp
+  802fbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  802fbe:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802fc0:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  802fc4:	74 21                	je     802fe7 <pgfault+0x33>
+  802fc6:	89 d0                	mov    %edx,%eax
+  802fc8:	c1 e8 16             	shr    $0x16,%eax
+  802fcb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802fd2:	a8 01                	test   $0x1,%al
+  802fd4:	74 11                	je     802fe7 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  802fd6:	89 d0                	mov    %edx,%eax
+  802fd8:	c1 e8 0c             	shr    $0xc,%eax
+  802fdb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802fe2:	f6 c4 08             	test   $0x8,%ah
+  802fe5:	75 17                	jne    802ffe <pgfault+0x4a>
+		if (pgfault_next) {
+  802fe7:	a1 04 90 80 00       	mov    0x809004,%eax
+  802fec:	85 c0                	test   %eax,%eax
+  802fee:	74 27                	je     803017 <pgfault+0x63>
+			pgfault_next(utf);
+  802ff0:	83 ec 0c             	sub    $0xc,%esp
+  802ff3:	53                   	push   %ebx
+  802ff4:	ff d0                	call   *%eax
+			return;
+  802ff6:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  802ff9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ffc:	c9                   	leave
+  802ffd:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  802ffe:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803004:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803009:	b8 00 00 00 00       	mov    $0x0,%eax
+  80300e:	e8 16 ff ff ff       	call   802f29 <copy_page_to>
+  803013:	85 c0                	test   %eax,%eax
+  803015:	79 e2                	jns    802ff9 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803017:	a1 00 50 80 00       	mov    0x805000,%eax
+  80301c:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  80301f:	ff 73 28             	push   0x28(%ebx)
+  803022:	ff 33                	push   (%ebx)
+  803024:	50                   	push   %eax
+  803025:	68 4c 3c 80 00       	push   $0x803c4c
+  80302a:	e8 dc f5 ff ff       	call   80260b <cprintf>
+	sys_env_destroy(0);
+  80302f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803036:	e8 aa d0 ff ff       	call   8000e5 <sys_env_destroy>
+  80303b:	83 c4 10             	add    $0x10,%esp
+  80303e:	eb b9                	jmp    802ff9 <pgfault+0x45>
+
+00803040 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803040:	55                   	push   %ebp
+  803041:	89 e5                	mov    %esp,%ebp
+  803043:	53                   	push   %ebx
+  803044:	83 ec 04             	sub    $0x4,%esp
+  803047:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80304a:	a1 08 90 80 00       	mov    0x809008,%eax
+  80304f:	3d b4 2f 80 00       	cmp    $0x802fb4,%eax
+  803054:	74 15                	je     80306b <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803056:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  80305b:	83 ec 0c             	sub    $0xc,%esp
+  80305e:	68 b4 2f 80 00       	push   $0x802fb4
+  803063:	e8 fb 03 00 00       	call   803463 <set_pgfault_handler>
+  803068:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80306b:	83 ec 0c             	sub    $0xc,%esp
+  80306e:	68 05 08 00 00       	push   $0x805
+  803073:	53                   	push   %ebx
+  803074:	6a 00                	push   $0x0
+  803076:	53                   	push   %ebx
+  803077:	6a 00                	push   $0x0
+  803079:	e8 41 d1 ff ff       	call   8001bf <sys_page_map>
+}
+  80307e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803081:	c9                   	leave
+  803082:	c3                   	ret
+
+00803083 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803083:	55                   	push   %ebp
+  803084:	89 e5                	mov    %esp,%ebp
+  803086:	57                   	push   %edi
+  803087:	56                   	push   %esi
+  803088:	53                   	push   %ebx
+  803089:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80308c:	68 b4 2f 80 00       	push   $0x802fb4
+  803091:	e8 cd 03 00 00       	call   803463 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803096:	b8 07 00 00 00       	mov    $0x7,%eax
+  80309b:	cd 30                	int    $0x30
+  80309d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8030a3:	83 c4 10             	add    $0x10,%esp
+  8030a6:	85 c0                	test   %eax,%eax
+  8030a8:	0f 88 6b 01 00 00    	js     803219 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8030b3:	75 37                	jne    8030ec <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8030b5:	e8 74 d0 ff ff       	call   80012e <sys_getenvid>
+  8030ba:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030bf:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8030c5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8030ca:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8030cf:	e9 45 01 00 00       	jmp    803219 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8030d4:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030da:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8030e0:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8030e6:	0f 87 ba 00 00 00    	ja     8031a6 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8030ec:	89 d8                	mov    %ebx,%eax
+  8030ee:	c1 e8 16             	shr    $0x16,%eax
+  8030f1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8030f8:	a8 01                	test   $0x1,%al
+  8030fa:	74 d8                	je     8030d4 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8030fc:	89 d8                	mov    %ebx,%eax
+  8030fe:	c1 e8 0c             	shr    $0xc,%eax
+  803101:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803108:	f6 c2 01             	test   $0x1,%dl
+  80310b:	74 cd                	je     8030da <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  80310d:	89 da                	mov    %ebx,%edx
+  80310f:	80 e6 df             	and    $0xdf,%dh
+  803112:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803118:	74 c0                	je     8030da <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  80311a:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80311c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803123:	f6 c6 04             	test   $0x4,%dh
+  803126:	75 53                	jne    80317b <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803128:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80312f:	f6 c6 08             	test   $0x8,%dh
+  803132:	75 0c                	jne    803140 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803134:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80313b:	f6 c2 02             	test   $0x2,%dl
+  80313e:	74 3b                	je     80317b <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803140:	83 ec 0c             	sub    $0xc,%esp
+  803143:	68 05 08 00 00       	push   $0x805
+  803148:	57                   	push   %edi
+  803149:	ff 75 e4             	push   -0x1c(%ebp)
+  80314c:	57                   	push   %edi
+  80314d:	6a 00                	push   $0x0
+  80314f:	e8 6b d0 ff ff       	call   8001bf <sys_page_map>
+  803154:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803156:	83 c4 20             	add    $0x20,%esp
+  803159:	85 c0                	test   %eax,%eax
+  80315b:	0f 88 a7 00 00 00    	js     803208 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803161:	83 ec 0c             	sub    $0xc,%esp
+  803164:	68 05 08 00 00       	push   $0x805
+  803169:	57                   	push   %edi
+  80316a:	6a 00                	push   $0x0
+  80316c:	57                   	push   %edi
+  80316d:	6a 00                	push   $0x0
+  80316f:	e8 4b d0 ff ff       	call   8001bf <sys_page_map>
+  803174:	89 c6                	mov    %eax,%esi
+	return r;
+  803176:	83 c4 20             	add    $0x20,%esp
+  803179:	eb 21                	jmp    80319c <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  80317b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803182:	83 ec 0c             	sub    $0xc,%esp
+  803185:	25 07 0e 00 00       	and    $0xe07,%eax
+  80318a:	50                   	push   %eax
+  80318b:	57                   	push   %edi
+  80318c:	ff 75 e4             	push   -0x1c(%ebp)
+  80318f:	57                   	push   %edi
+  803190:	6a 00                	push   $0x0
+  803192:	e8 28 d0 ff ff       	call   8001bf <sys_page_map>
+  803197:	89 c6                	mov    %eax,%esi
+  803199:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  80319c:	85 f6                	test   %esi,%esi
+  80319e:	0f 89 36 ff ff ff    	jns    8030da <fork+0x57>
+  8031a4:	eb 62                	jmp    803208 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031a6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031ab:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8031b0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8031b3:	89 f8                	mov    %edi,%eax
+  8031b5:	e8 6f fd ff ff       	call   802f29 <copy_page_to>
+  8031ba:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031bc:	85 c0                	test   %eax,%eax
+  8031be:	78 48                	js     803208 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031c0:	83 ec 04             	sub    $0x4,%esp
+  8031c3:	6a 07                	push   $0x7
+  8031c5:	68 00 f0 bf ee       	push   $0xeebff000
+  8031ca:	57                   	push   %edi
+  8031cb:	e8 a4 cf ff ff       	call   800174 <sys_page_alloc>
+  8031d0:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031d2:	83 c4 10             	add    $0x10,%esp
+  8031d5:	85 c0                	test   %eax,%eax
+  8031d7:	78 2f                	js     803208 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8031d9:	a1 00 50 80 00       	mov    0x805000,%eax
+  8031de:	8b 40 64             	mov    0x64(%eax),%eax
+  8031e1:	83 ec 08             	sub    $0x8,%esp
+  8031e4:	50                   	push   %eax
+  8031e5:	57                   	push   %edi
+  8031e6:	e8 f4 d0 ff ff       	call   8002df <sys_env_set_pgfault_upcall>
+  8031eb:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031ed:	83 c4 10             	add    $0x10,%esp
+  8031f0:	85 c0                	test   %eax,%eax
+  8031f2:	78 14                	js     803208 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8031f4:	83 ec 08             	sub    $0x8,%esp
+  8031f7:	6a 02                	push   $0x2
+  8031f9:	57                   	push   %edi
+  8031fa:	e8 4c d0 ff ff       	call   80024b <sys_env_set_status>
+  8031ff:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803201:	83 c4 10             	add    $0x10,%esp
+  803204:	85 c0                	test   %eax,%eax
+  803206:	79 11                	jns    803219 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803208:	83 ec 0c             	sub    $0xc,%esp
+  80320b:	ff 75 e0             	push   -0x20(%ebp)
+  80320e:	e8 d2 ce ff ff       	call   8000e5 <sys_env_destroy>
+	return r;
+  803213:	83 c4 10             	add    $0x10,%esp
+  803216:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803219:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80321c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80321f:	5b                   	pop    %ebx
+  803220:	5e                   	pop    %esi
+  803221:	5f                   	pop    %edi
+  803222:	5d                   	pop    %ebp
+  803223:	c3                   	ret
+
+00803224 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803224:	55                   	push   %ebp
+  803225:	89 e5                	mov    %esp,%ebp
+  803227:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80322a:	68 ab 3c 80 00       	push   $0x803cab
+  80322f:	68 bf 00 00 00       	push   $0xbf
+  803234:	68 a0 3c 80 00       	push   $0x803ca0
+  803239:	e8 f2 f2 ff ff       	call   802530 <_panic>
+
+0080323e <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80323e:	55                   	push   %ebp
+  80323f:	89 e5                	mov    %esp,%ebp
+  803241:	56                   	push   %esi
+  803242:	53                   	push   %ebx
+  803243:	8b 75 08             	mov    0x8(%ebp),%esi
+  803246:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803249:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80324c:	85 c0                	test   %eax,%eax
+  80324e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803253:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803256:	83 ec 0c             	sub    $0xc,%esp
+  803259:	50                   	push   %eax
+  80325a:	e8 5d d1 ff ff       	call   8003bc <sys_ipc_recv>
+	if (from_env_store)
+  80325f:	83 c4 10             	add    $0x10,%esp
+  803262:	85 f6                	test   %esi,%esi
+  803264:	74 14                	je     80327a <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803266:	ba 00 00 00 00       	mov    $0x0,%edx
+  80326b:	85 c0                	test   %eax,%eax
+  80326d:	75 09                	jne    803278 <ipc_recv+0x3a>
+  80326f:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803275:	8b 52 74             	mov    0x74(%edx),%edx
+  803278:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  80327a:	85 db                	test   %ebx,%ebx
+  80327c:	74 25                	je     8032a3 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80327e:	85 c0                	test   %eax,%eax
+  803280:	74 0d                	je     80328f <ipc_recv+0x51>
+  803282:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803288:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80328b:	5b                   	pop    %ebx
+  80328c:	5e                   	pop    %esi
+  80328d:	5d                   	pop    %ebp
+  80328e:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80328f:	a1 00 50 80 00       	mov    0x805000,%eax
+  803294:	8b 40 78             	mov    0x78(%eax),%eax
+  803297:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803299:	a1 00 50 80 00       	mov    0x805000,%eax
+  80329e:	8b 40 70             	mov    0x70(%eax),%eax
+  8032a1:	eb e5                	jmp    803288 <ipc_recv+0x4a>
+  8032a3:	85 c0                	test   %eax,%eax
+  8032a5:	75 e1                	jne    803288 <ipc_recv+0x4a>
+  8032a7:	eb f0                	jmp    803299 <ipc_recv+0x5b>
+
+008032a9 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8032a9:	55                   	push   %ebp
+  8032aa:	89 e5                	mov    %esp,%ebp
+  8032ac:	57                   	push   %edi
+  8032ad:	56                   	push   %esi
+  8032ae:	53                   	push   %ebx
+  8032af:	83 ec 0c             	sub    $0xc,%esp
+  8032b2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032b5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032bb:	85 db                	test   %ebx,%ebx
+  8032bd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032c2:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8032c5:	ff 75 14             	push   0x14(%ebp)
+  8032c8:	53                   	push   %ebx
+  8032c9:	56                   	push   %esi
+  8032ca:	57                   	push   %edi
+  8032cb:	e8 59 d0 ff ff       	call   800329 <sys_ipc_try_send>
+  8032d0:	83 c4 10             	add    $0x10,%esp
+  8032d3:	85 c0                	test   %eax,%eax
+  8032d5:	74 22                	je     8032f9 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8032d7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032da:	75 07                	jne    8032e3 <ipc_send+0x3a>
+		sys_yield();
+  8032dc:	e8 74 ce ff ff       	call   800155 <sys_yield>
+  8032e1:	eb e2                	jmp    8032c5 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8032e3:	68 c1 3c 80 00       	push   $0x803cc1
+  8032e8:	68 24 38 80 00       	push   $0x803824
+  8032ed:	6a 39                	push   $0x39
+  8032ef:	68 d6 3c 80 00       	push   $0x803cd6
+  8032f4:	e8 37 f2 ff ff       	call   802530 <_panic>
+	}
+}
+  8032f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032fc:	5b                   	pop    %ebx
+  8032fd:	5e                   	pop    %esi
+  8032fe:	5f                   	pop    %edi
+  8032ff:	5d                   	pop    %ebp
+  803300:	c3                   	ret
+
+00803301 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803301:	55                   	push   %ebp
+  803302:	89 e5                	mov    %esp,%ebp
+  803304:	57                   	push   %edi
+  803305:	56                   	push   %esi
+  803306:	53                   	push   %ebx
+  803307:	83 ec 10             	sub    $0x10,%esp
+  80330a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80330d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803310:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803313:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803316:	85 c0                	test   %eax,%eax
+  803318:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80331d:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803320:	6a 00                	push   $0x0
+  803322:	ff 33                	push   (%ebx)
+  803324:	50                   	push   %eax
+  803325:	e8 4f d0 ff ff       	call   800379 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80332a:	83 c4 10             	add    $0x10,%esp
+  80332d:	85 c0                	test   %eax,%eax
+  80332f:	75 3c                	jne    80336d <ipc_recvv+0x6c>
+  803331:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803337:	8b 52 7c             	mov    0x7c(%edx),%edx
+  80333a:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  80333c:	85 ff                	test   %edi,%edi
+  80333e:	74 4e                	je     80338e <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803340:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803346:	8b 52 74             	mov    0x74(%edx),%edx
+  803349:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  80334b:	85 f6                	test   %esi,%esi
+  80334d:	74 18                	je     803367 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80334f:	85 c0                	test   %eax,%eax
+  803351:	75 2d                	jne    803380 <ipc_recvv+0x7f>
+  803353:	a1 00 50 80 00       	mov    0x805000,%eax
+  803358:	8b 40 78             	mov    0x78(%eax),%eax
+  80335b:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  80335d:	a1 00 50 80 00       	mov    0x805000,%eax
+  803362:	8b 40 70             	mov    0x70(%eax),%eax
+  803365:	eb 1f                	jmp    803386 <ipc_recvv+0x85>
+  803367:	85 c0                	test   %eax,%eax
+  803369:	75 1b                	jne    803386 <ipc_recvv+0x85>
+  80336b:	eb f0                	jmp    80335d <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80336d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803373:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803378:	85 ff                	test   %edi,%edi
+  80337a:	75 cd                	jne    803349 <ipc_recvv+0x48>
+	if (perm_store)
+  80337c:	85 f6                	test   %esi,%esi
+  80337e:	74 e7                	je     803367 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803380:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803386:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803389:	5b                   	pop    %ebx
+  80338a:	5e                   	pop    %esi
+  80338b:	5f                   	pop    %edi
+  80338c:	5d                   	pop    %ebp
+  80338d:	c3                   	ret
+	if (perm_store)
+  80338e:	85 f6                	test   %esi,%esi
+  803390:	75 bd                	jne    80334f <ipc_recvv+0x4e>
+  803392:	eb c9                	jmp    80335d <ipc_recvv+0x5c>
+
+00803394 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803394:	55                   	push   %ebp
+  803395:	89 e5                	mov    %esp,%ebp
+  803397:	57                   	push   %edi
+  803398:	56                   	push   %esi
+  803399:	53                   	push   %ebx
+  80339a:	83 ec 0c             	sub    $0xc,%esp
+  80339d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033a0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8033a6:	ff 75 14             	push   0x14(%ebp)
+  8033a9:	53                   	push   %ebx
+  8033aa:	56                   	push   %esi
+  8033ab:	57                   	push   %edi
+  8033ac:	e8 a0 cf ff ff       	call   800351 <sys_ipc_try_sendv>
+  8033b1:	83 c4 10             	add    $0x10,%esp
+  8033b4:	85 c0                	test   %eax,%eax
+  8033b6:	74 22                	je     8033da <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8033b8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033bb:	75 07                	jne    8033c4 <ipc_sendv+0x30>
+		sys_yield();
+  8033bd:	e8 93 cd ff ff       	call   800155 <sys_yield>
+  8033c2:	eb e2                	jmp    8033a6 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8033c4:	68 c1 3c 80 00       	push   $0x803cc1
+  8033c9:	68 24 38 80 00       	push   $0x803824
+  8033ce:	6a 5c                	push   $0x5c
+  8033d0:	68 d6 3c 80 00       	push   $0x803cd6
+  8033d5:	e8 56 f1 ff ff       	call   802530 <_panic>
+	}
+}
+  8033da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033dd:	5b                   	pop    %ebx
+  8033de:	5e                   	pop    %esi
+  8033df:	5f                   	pop    %edi
+  8033e0:	5d                   	pop    %ebp
+  8033e1:	c3                   	ret
+
+008033e2 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8033e2:	55                   	push   %ebp
+  8033e3:	89 e5                	mov    %esp,%ebp
+  8033e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8033e8:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8033ed:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8033f3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8033f9:	8b 52 50             	mov    0x50(%edx),%edx
+  8033fc:	39 ca                	cmp    %ecx,%edx
+  8033fe:	74 11                	je     803411 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803400:	83 c0 01             	add    $0x1,%eax
+  803403:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803408:	75 e3                	jne    8033ed <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80340a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80340f:	eb 0e                	jmp    80341f <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803411:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803417:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80341c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80341f:	5d                   	pop    %ebp
+  803420:	c3                   	ret
+
+00803421 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803421:	55                   	push   %ebp
+  803422:	89 e5                	mov    %esp,%ebp
+  803424:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803427:	89 c2                	mov    %eax,%edx
+  803429:	c1 ea 16             	shr    $0x16,%edx
+  80342c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803433:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803438:	f6 c1 01             	test   $0x1,%cl
+  80343b:	74 22                	je     80345f <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80343d:	c1 e8 0c             	shr    $0xc,%eax
+  803440:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803447:	a8 01                	test   $0x1,%al
+  803449:	74 14                	je     80345f <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80344b:	c1 e8 0c             	shr    $0xc,%eax
+  80344e:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803451:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803458:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  80345c:	0f b7 d2             	movzwl %dx,%edx
+}
+  80345f:	89 d0                	mov    %edx,%eax
+  803461:	5d                   	pop    %ebp
+  803462:	c3                   	ret
+
+00803463 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803463:	55                   	push   %ebp
+  803464:	89 e5                	mov    %esp,%ebp
+  803466:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803469:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  803470:	74 0a                	je     80347c <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803472:	8b 45 08             	mov    0x8(%ebp),%eax
+  803475:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  80347a:	c9                   	leave
+  80347b:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80347c:	83 ec 04             	sub    $0x4,%esp
+  80347f:	6a 07                	push   $0x7
+  803481:	68 00 f0 bf ee       	push   $0xeebff000
+  803486:	6a 00                	push   $0x0
+  803488:	e8 e7 cc ff ff       	call   800174 <sys_page_alloc>
+  80348d:	83 c4 10             	add    $0x10,%esp
+  803490:	85 c0                	test   %eax,%eax
+  803492:	75 2c                	jne    8034c0 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803494:	83 ec 08             	sub    $0x8,%esp
+  803497:	68 d6 34 80 00       	push   $0x8034d6
+  80349c:	6a 00                	push   $0x0
+  80349e:	e8 3c ce ff ff       	call   8002df <sys_env_set_pgfault_upcall>
+  8034a3:	83 c4 10             	add    $0x10,%esp
+  8034a6:	85 c0                	test   %eax,%eax
+  8034a8:	74 c8                	je     803472 <set_pgfault_handler+0xf>
+  8034aa:	68 28 3d 80 00       	push   $0x803d28
+  8034af:	68 24 38 80 00       	push   $0x803824
+  8034b4:	6a 20                	push   $0x20
+  8034b6:	68 58 3d 80 00       	push   $0x803d58
+  8034bb:	e8 70 f0 ff ff       	call   802530 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034c0:	68 e0 3c 80 00       	push   $0x803ce0
+  8034c5:	68 24 38 80 00       	push   $0x803824
+  8034ca:	6a 1e                	push   $0x1e
+  8034cc:	68 58 3d 80 00       	push   $0x803d58
+  8034d1:	e8 5a f0 ff ff       	call   802530 <_panic>
+
+008034d6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8034d6:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8034d7:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  8034dc:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8034de:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8034e1:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8034e6:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8034eb:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8034ef:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8034f2:	83 c4 08             	add    $0x8,%esp
+	popal
+  8034f5:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8034f6:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8034f9:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8034fa:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8034fb:	c3                   	ret
+
+008034fc <dm>:
+  8034fc:	55                   	push   %ebp
+  8034fd:	57                   	push   %edi
+  8034fe:	56                   	push   %esi
+  8034ff:	53                   	push   %ebx
+  803500:	83 ec 24             	sub    $0x24,%esp
+  803503:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803507:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80350b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80350f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803513:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803517:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80351b:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80351f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803524:	b8 00 00 00 00       	mov    $0x0,%eax
+  803529:	ba 00 00 00 00       	mov    $0x0,%edx
+  80352e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803535:	00 
+  803536:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80353d:	00 
+  80353e:	89 fb                	mov    %edi,%ebx
+  803540:	eb 08                	jmp    80354a <dm+0x4e>
+  803542:	83 e9 01             	sub    $0x1,%ecx
+  803545:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803548:	74 68                	je     8035b2 <dm+0xb6>
+  80354a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80354e:	01 c0                	add    %eax,%eax
+  803550:	89 c6                	mov    %eax,%esi
+  803552:	89 d7                	mov    %edx,%edi
+  803554:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803558:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80355c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80355f:	d3 ea                	shr    %cl,%edx
+  803561:	f6 c1 20             	test   $0x20,%cl
+  803564:	74 04                	je     80356a <dm+0x6e>
+  803566:	89 d0                	mov    %edx,%eax
+  803568:	31 d2                	xor    %edx,%edx
+  80356a:	83 e0 01             	and    $0x1,%eax
+  80356d:	89 04 24             	mov    %eax,(%esp)
+  803570:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803577:	00 
+  803578:	8b 04 24             	mov    (%esp),%eax
+  80357b:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80357f:	09 f0                	or     %esi,%eax
+  803581:	09 fa                	or     %edi,%edx
+  803583:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803587:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80358b:	39 f0                	cmp    %esi,%eax
+  80358d:	89 d5                	mov    %edx,%ebp
+  80358f:	19 fd                	sbb    %edi,%ebp
+  803591:	72 af                	jb     803542 <dm+0x46>
+  803593:	29 f0                	sub    %esi,%eax
+  803595:	19 fa                	sbb    %edi,%edx
+  803597:	89 cf                	mov    %ecx,%edi
+  803599:	c1 ef 05             	shr    $0x5,%edi
+  80359c:	83 e7 01             	and    $0x1,%edi
+  80359f:	89 fe                	mov    %edi,%esi
+  8035a1:	83 f6 01             	xor    $0x1,%esi
+  8035a4:	d3 e6                	shl    %cl,%esi
+  8035a6:	d3 e7                	shl    %cl,%edi
+  8035a8:	09 74 24 18          	or     %esi,0x18(%esp)
+  8035ac:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8035b0:	eb 90                	jmp    803542 <dm+0x46>
+  8035b2:	85 db                	test   %ebx,%ebx
+  8035b4:	74 05                	je     8035bb <dm+0xbf>
+  8035b6:	89 03                	mov    %eax,(%ebx)
+  8035b8:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035bb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035bf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035c3:	83 c4 24             	add    $0x24,%esp
+  8035c6:	5b                   	pop    %ebx
+  8035c7:	5e                   	pop    %esi
+  8035c8:	5f                   	pop    %edi
+  8035c9:	5d                   	pop    %ebp
+  8035ca:	c3                   	ret
+
+008035cb <__udivdi3>:
+  8035cb:	83 ec 08             	sub    $0x8,%esp
+  8035ce:	6a 00                	push   $0x0
+  8035d0:	ff 74 24 1c          	push   0x1c(%esp)
+  8035d4:	ff 74 24 1c          	push   0x1c(%esp)
+  8035d8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035dc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035e0:	e8 17 ff ff ff       	call   8034fc <dm>
+  8035e5:	83 c4 14             	add    $0x14,%esp
+  8035e8:	c3                   	ret
+
+008035e9 <__umoddi3>:
+  8035e9:	83 ec 18             	sub    $0x18,%esp
+  8035ec:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8035f0:	50                   	push   %eax
+  8035f1:	ff 74 24 2c          	push   0x2c(%esp)
+  8035f5:	ff 74 24 2c          	push   0x2c(%esp)
+  8035f9:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8035fd:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803601:	e8 f6 fe ff ff       	call   8034fc <dm>
+  803606:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80360a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80360e:	83 c4 24             	add    $0x24,%esp
+  803611:	c3                   	ret
+
+00803612 <__divdi3>:
+  803612:	53                   	push   %ebx
+  803613:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803617:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80361b:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80361f:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803623:	85 d2                	test   %edx,%edx
+  803625:	78 15                	js     80363c <__divdi3+0x2a>
+  803627:	85 db                	test   %ebx,%ebx
+  803629:	78 34                	js     80365f <__divdi3+0x4d>
+  80362b:	83 ec 04             	sub    $0x4,%esp
+  80362e:	6a 00                	push   $0x0
+  803630:	53                   	push   %ebx
+  803631:	51                   	push   %ecx
+  803632:	e8 c5 fe ff ff       	call   8034fc <dm>
+  803637:	83 c4 10             	add    $0x10,%esp
+  80363a:	eb 21                	jmp    80365d <__divdi3+0x4b>
+  80363c:	f7 d8                	neg    %eax
+  80363e:	83 d2 00             	adc    $0x0,%edx
+  803641:	f7 da                	neg    %edx
+  803643:	85 db                	test   %ebx,%ebx
+  803645:	78 30                	js     803677 <__divdi3+0x65>
+  803647:	83 ec 04             	sub    $0x4,%esp
+  80364a:	6a 00                	push   $0x0
+  80364c:	53                   	push   %ebx
+  80364d:	51                   	push   %ecx
+  80364e:	e8 a9 fe ff ff       	call   8034fc <dm>
+  803653:	83 c4 10             	add    $0x10,%esp
+  803656:	f7 d8                	neg    %eax
+  803658:	83 d2 00             	adc    $0x0,%edx
+  80365b:	f7 da                	neg    %edx
+  80365d:	5b                   	pop    %ebx
+  80365e:	c3                   	ret
+  80365f:	83 ec 04             	sub    $0x4,%esp
+  803662:	6a 00                	push   $0x0
+  803664:	f7 d9                	neg    %ecx
+  803666:	83 d3 00             	adc    $0x0,%ebx
+  803669:	f7 db                	neg    %ebx
+  80366b:	53                   	push   %ebx
+  80366c:	51                   	push   %ecx
+  80366d:	e8 8a fe ff ff       	call   8034fc <dm>
+  803672:	83 c4 10             	add    $0x10,%esp
+  803675:	eb df                	jmp    803656 <__divdi3+0x44>
+  803677:	83 ec 04             	sub    $0x4,%esp
+  80367a:	6a 00                	push   $0x0
+  80367c:	f7 d9                	neg    %ecx
+  80367e:	83 d3 00             	adc    $0x0,%ebx
+  803681:	f7 db                	neg    %ebx
+  803683:	53                   	push   %ebx
+  803684:	51                   	push   %ecx
+  803685:	e8 72 fe ff ff       	call   8034fc <dm>
+  80368a:	83 c4 10             	add    $0x10,%esp
+  80368d:	eb ce                	jmp    80365d <__divdi3+0x4b>
+
+0080368f <__moddi3>:
+  80368f:	55                   	push   %ebp
+  803690:	57                   	push   %edi
+  803691:	56                   	push   %esi
+  803692:	53                   	push   %ebx
+  803693:	83 ec 24             	sub    $0x24,%esp
+  803696:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80369a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80369e:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036a2:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036a6:	85 d2                	test   %edx,%edx
+  8036a8:	78 3b                	js     8036e5 <__moddi3+0x56>
+  8036aa:	83 ec 04             	sub    $0x4,%esp
+  8036ad:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036b1:	56                   	push   %esi
+  8036b2:	89 ce                	mov    %ecx,%esi
+  8036b4:	f7 de                	neg    %esi
+  8036b6:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8036ba:	89 de                	mov    %ebx,%esi
+  8036bc:	83 d6 00             	adc    $0x0,%esi
+  8036bf:	f7 de                	neg    %esi
+  8036c1:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8036c5:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8036c9:	0f 48 f1             	cmovs  %ecx,%esi
+  8036cc:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8036d1:	53                   	push   %ebx
+  8036d2:	56                   	push   %esi
+  8036d3:	e8 24 fe ff ff       	call   8034fc <dm>
+  8036d8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036dc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036e0:	83 c4 10             	add    $0x10,%esp
+  8036e3:	eb 47                	jmp    80372c <__moddi3+0x9d>
+  8036e5:	f7 d8                	neg    %eax
+  8036e7:	83 d2 00             	adc    $0x0,%edx
+  8036ea:	f7 da                	neg    %edx
+  8036ec:	83 ec 04             	sub    $0x4,%esp
+  8036ef:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036f3:	56                   	push   %esi
+  8036f4:	89 cf                	mov    %ecx,%edi
+  8036f6:	f7 df                	neg    %edi
+  8036f8:	89 de                	mov    %ebx,%esi
+  8036fa:	83 d6 00             	adc    $0x0,%esi
+  8036fd:	f7 de                	neg    %esi
+  8036ff:	0f 49 cf             	cmovns %edi,%ecx
+  803702:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803706:	0f 49 de             	cmovns %esi,%ebx
+  803709:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80370d:	ff 74 24 0c          	push   0xc(%esp)
+  803711:	ff 74 24 0c          	push   0xc(%esp)
+  803715:	e8 e2 fd ff ff       	call   8034fc <dm>
+  80371a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80371e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803722:	f7 d8                	neg    %eax
+  803724:	83 d2 00             	adc    $0x0,%edx
+  803727:	f7 da                	neg    %edx
+  803729:	83 c4 10             	add    $0x10,%esp
+  80372c:	83 c4 24             	add    $0x24,%esp
+  80372f:	5b                   	pop    %ebx
+  803730:	5e                   	pop    %esi
+  803731:	5f                   	pop    %edi
+  803732:	5d                   	pop    %ebp
+  803733:	c3                   	ret
@@ -0,0 +1,7628 @@
+
+obj/user/buggyhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 16 00 00 00       	call   800047 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs((char*)1, 1);
+  800039:	6a 01                	push   $0x1
+  80003b:	6a 01                	push   $0x1
+  80003d:	e8 68 00 00 00       	call   8000aa <sys_cputs>
+}
+  800042:	83 c4 10             	add    $0x10,%esp
+  800045:	c9                   	leave
+  800046:	c3                   	ret
+
+00800047 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800047:	55                   	push   %ebp
+  800048:	89 e5                	mov    %esp,%ebp
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80004f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800052:	e8 e9 00 00 00       	call   800140 <sys_getenvid>
+  800057:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005c:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800062:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800067:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80006c:	85 db                	test   %ebx,%ebx
+  80006e:	7e 07                	jle    800077 <libmain+0x30>
+		binaryname = argv[0];
+  800070:	8b 06                	mov    (%esi),%eax
+  800072:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800077:	83 ec 08             	sub    $0x8,%esp
+  80007a:	56                   	push   %esi
+  80007b:	53                   	push   %ebx
+  80007c:	e8 b2 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800081:	e8 0a 00 00 00       	call   800090 <exit>
+}
+  800086:	83 c4 10             	add    $0x10,%esp
+  800089:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008c:	5b                   	pop    %ebx
+  80008d:	5e                   	pop    %esi
+  80008e:	5d                   	pop    %ebp
+  80008f:	c3                   	ret
+
+00800090 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800090:	55                   	push   %ebp
+  800091:	89 e5                	mov    %esp,%ebp
+  800093:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800096:	e8 c0 06 00 00       	call   80075b <close_all>
+	sys_env_destroy(0);
+  80009b:	83 ec 0c             	sub    $0xc,%esp
+  80009e:	6a 00                	push   $0x0
+  8000a0:	e8 52 00 00 00       	call   8000f7 <sys_env_destroy>
+}
+  8000a5:	83 c4 10             	add    $0x10,%esp
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+
+008000aa <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000aa:	55                   	push   %ebp
+  8000ab:	89 e5                	mov    %esp,%ebp
+  8000ad:	57                   	push   %edi
+  8000ae:	56                   	push   %esi
+  8000af:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000bb:	89 c3                	mov    %eax,%ebx
+  8000bd:	89 c7                	mov    %eax,%edi
+  8000bf:	55                   	push   %ebp
+  8000c0:	89 e5                	mov    %esp,%ebp
+  8000c2:	8d 35 ca 00 80 00    	lea    0x8000ca,%esi
+  8000c8:	0f 34                	sysenter
+  8000ca:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  8000cb:	5b                   	pop    %ebx
+  8000cc:	5e                   	pop    %esi
+  8000cd:	5f                   	pop    %edi
+  8000ce:	5d                   	pop    %ebp
+  8000cf:	c3                   	ret
+
+008000d0 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000d0:	55                   	push   %ebp
+  8000d1:	89 e5                	mov    %esp,%ebp
+  8000d3:	57                   	push   %edi
+  8000d4:	56                   	push   %esi
+  8000d5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000db:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000e0:	89 d1                	mov    %edx,%ecx
+  8000e2:	89 d3                	mov    %edx,%ebx
+  8000e4:	89 d7                	mov    %edx,%edi
+  8000e6:	55                   	push   %ebp
+  8000e7:	89 e5                	mov    %esp,%ebp
+  8000e9:	8d 35 f1 00 80 00    	lea    0x8000f1,%esi
+  8000ef:	0f 34                	sysenter
+  8000f1:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  8000f2:	5b                   	pop    %ebx
+  8000f3:	5e                   	pop    %esi
+  8000f4:	5f                   	pop    %edi
+  8000f5:	5d                   	pop    %ebp
+  8000f6:	c3                   	ret
+
+008000f7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000f7:	55                   	push   %ebp
+  8000f8:	89 e5                	mov    %esp,%ebp
+  8000fa:	57                   	push   %edi
+  8000fb:	56                   	push   %esi
+  8000fc:	53                   	push   %ebx
+  8000fd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800100:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800105:	8b 55 08             	mov    0x8(%ebp),%edx
+  800108:	b8 03 00 00 00       	mov    $0x3,%eax
+  80010d:	89 cb                	mov    %ecx,%ebx
+  80010f:	89 cf                	mov    %ecx,%edi
+  800111:	55                   	push   %ebp
+  800112:	89 e5                	mov    %esp,%ebp
+  800114:	8d 35 1c 01 80 00    	lea    0x80011c,%esi
+  80011a:	0f 34                	sysenter
+  80011c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80011d:	85 c0                	test   %eax,%eax
+  80011f:	7f 08                	jg     800129 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800121:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800124:	5b                   	pop    %ebx
+  800125:	5e                   	pop    %esi
+  800126:	5f                   	pop    %edi
+  800127:	5d                   	pop    %ebp
+  800128:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800129:	83 ec 0c             	sub    $0xc,%esp
+  80012c:	50                   	push   %eax
+  80012d:	6a 03                	push   $0x3
+  80012f:	68 6a 37 80 00       	push   $0x80376a
+  800134:	6a 3d                	push   $0x3d
+  800136:	68 87 37 80 00       	push   $0x803787
+  80013b:	e8 02 24 00 00       	call   802542 <_panic>
+
+00800140 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800140:	55                   	push   %ebp
+  800141:	89 e5                	mov    %esp,%ebp
+  800143:	57                   	push   %edi
+  800144:	56                   	push   %esi
+  800145:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800146:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800150:	89 d1                	mov    %edx,%ecx
+  800152:	89 d3                	mov    %edx,%ebx
+  800154:	89 d7                	mov    %edx,%edi
+  800156:	55                   	push   %ebp
+  800157:	89 e5                	mov    %esp,%ebp
+  800159:	8d 35 61 01 80 00    	lea    0x800161,%esi
+  80015f:	0f 34                	sysenter
+  800161:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800162:	5b                   	pop    %ebx
+  800163:	5e                   	pop    %esi
+  800164:	5f                   	pop    %edi
+  800165:	5d                   	pop    %ebp
+  800166:	c3                   	ret
+
+00800167 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800167:	55                   	push   %ebp
+  800168:	89 e5                	mov    %esp,%ebp
+  80016a:	57                   	push   %edi
+  80016b:	56                   	push   %esi
+  80016c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80016d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800172:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800177:	89 d1                	mov    %edx,%ecx
+  800179:	89 d3                	mov    %edx,%ebx
+  80017b:	89 d7                	mov    %edx,%edi
+  80017d:	89 d6                	mov    %edx,%esi
+  80017f:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800181:	5b                   	pop    %ebx
+  800182:	5e                   	pop    %esi
+  800183:	5f                   	pop    %edi
+  800184:	5d                   	pop    %ebp
+  800185:	c3                   	ret
+
+00800186 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800186:	55                   	push   %ebp
+  800187:	89 e5                	mov    %esp,%ebp
+  800189:	57                   	push   %edi
+  80018a:	56                   	push   %esi
+  80018b:	53                   	push   %ebx
+  80018c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80018f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800192:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800195:	b8 04 00 00 00       	mov    $0x4,%eax
+  80019a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80019f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001a2:	55                   	push   %ebp
+  8001a3:	89 e5                	mov    %esp,%ebp
+  8001a5:	8d 35 ad 01 80 00    	lea    0x8001ad,%esi
+  8001ab:	0f 34                	sysenter
+  8001ad:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	7f 08                	jg     8001ba <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  8001b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001b5:	5b                   	pop    %ebx
+  8001b6:	5e                   	pop    %esi
+  8001b7:	5f                   	pop    %edi
+  8001b8:	5d                   	pop    %ebp
+  8001b9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001ba:	83 ec 0c             	sub    $0xc,%esp
+  8001bd:	50                   	push   %eax
+  8001be:	6a 04                	push   $0x4
+  8001c0:	68 6a 37 80 00       	push   $0x80376a
+  8001c5:	6a 3d                	push   $0x3d
+  8001c7:	68 87 37 80 00       	push   $0x803787
+  8001cc:	e8 71 23 00 00       	call   802542 <_panic>
+
+008001d1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001d1:	55                   	push   %ebp
+  8001d2:	89 e5                	mov    %esp,%ebp
+  8001d4:	57                   	push   %edi
+  8001d5:	56                   	push   %esi
+  8001d6:	53                   	push   %ebx
+  8001d7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001e0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001e8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001eb:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001ee:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001f0:	85 c0                	test   %eax,%eax
+  8001f2:	7f 08                	jg     8001fc <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001f7:	5b                   	pop    %ebx
+  8001f8:	5e                   	pop    %esi
+  8001f9:	5f                   	pop    %edi
+  8001fa:	5d                   	pop    %ebp
+  8001fb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001fc:	83 ec 0c             	sub    $0xc,%esp
+  8001ff:	50                   	push   %eax
+  800200:	6a 05                	push   $0x5
+  800202:	68 6a 37 80 00       	push   $0x80376a
+  800207:	6a 23                	push   $0x23
+  800209:	68 87 37 80 00       	push   $0x803787
+  80020e:	e8 2f 23 00 00       	call   802542 <_panic>
+
+00800213 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800213:	55                   	push   %ebp
+  800214:	89 e5                	mov    %esp,%ebp
+  800216:	57                   	push   %edi
+  800217:	56                   	push   %esi
+  800218:	53                   	push   %ebx
+  800219:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80021c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800221:	8b 55 08             	mov    0x8(%ebp),%edx
+  800224:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800227:	b8 06 00 00 00       	mov    $0x6,%eax
+  80022c:	89 df                	mov    %ebx,%edi
+  80022e:	55                   	push   %ebp
+  80022f:	89 e5                	mov    %esp,%ebp
+  800231:	8d 35 39 02 80 00    	lea    0x800239,%esi
+  800237:	0f 34                	sysenter
+  800239:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80023a:	85 c0                	test   %eax,%eax
+  80023c:	7f 08                	jg     800246 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  80023e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800241:	5b                   	pop    %ebx
+  800242:	5e                   	pop    %esi
+  800243:	5f                   	pop    %edi
+  800244:	5d                   	pop    %ebp
+  800245:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800246:	83 ec 0c             	sub    $0xc,%esp
+  800249:	50                   	push   %eax
+  80024a:	6a 06                	push   $0x6
+  80024c:	68 6a 37 80 00       	push   $0x80376a
+  800251:	6a 3d                	push   $0x3d
+  800253:	68 87 37 80 00       	push   $0x803787
+  800258:	e8 e5 22 00 00       	call   802542 <_panic>
+
+0080025d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80025d:	55                   	push   %ebp
+  80025e:	89 e5                	mov    %esp,%ebp
+  800260:	57                   	push   %edi
+  800261:	56                   	push   %esi
+  800262:	53                   	push   %ebx
+  800263:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800266:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80026b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80026e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800271:	b8 08 00 00 00       	mov    $0x8,%eax
+  800276:	89 df                	mov    %ebx,%edi
+  800278:	55                   	push   %ebp
+  800279:	89 e5                	mov    %esp,%ebp
+  80027b:	8d 35 83 02 80 00    	lea    0x800283,%esi
+  800281:	0f 34                	sysenter
+  800283:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800284:	85 c0                	test   %eax,%eax
+  800286:	7f 08                	jg     800290 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800288:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028b:	5b                   	pop    %ebx
+  80028c:	5e                   	pop    %esi
+  80028d:	5f                   	pop    %edi
+  80028e:	5d                   	pop    %ebp
+  80028f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800290:	83 ec 0c             	sub    $0xc,%esp
+  800293:	50                   	push   %eax
+  800294:	6a 08                	push   $0x8
+  800296:	68 6a 37 80 00       	push   $0x80376a
+  80029b:	6a 3d                	push   $0x3d
+  80029d:	68 87 37 80 00       	push   $0x803787
+  8002a2:	e8 9b 22 00 00       	call   802542 <_panic>
+
+008002a7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8002a7:	55                   	push   %ebp
+  8002a8:	89 e5                	mov    %esp,%ebp
+  8002aa:	57                   	push   %edi
+  8002ab:	56                   	push   %esi
+  8002ac:	53                   	push   %ebx
+  8002ad:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8002b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002bb:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002c0:	89 df                	mov    %ebx,%edi
+  8002c2:	55                   	push   %ebp
+  8002c3:	89 e5                	mov    %esp,%ebp
+  8002c5:	8d 35 cd 02 80 00    	lea    0x8002cd,%esi
+  8002cb:	0f 34                	sysenter
+  8002cd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8002ce:	85 c0                	test   %eax,%eax
+  8002d0:	7f 08                	jg     8002da <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  8002d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d5:	5b                   	pop    %ebx
+  8002d6:	5e                   	pop    %esi
+  8002d7:	5f                   	pop    %edi
+  8002d8:	5d                   	pop    %ebp
+  8002d9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002da:	83 ec 0c             	sub    $0xc,%esp
+  8002dd:	50                   	push   %eax
+  8002de:	6a 09                	push   $0x9
+  8002e0:	68 6a 37 80 00       	push   $0x80376a
+  8002e5:	6a 3d                	push   $0x3d
+  8002e7:	68 87 37 80 00       	push   $0x803787
+  8002ec:	e8 51 22 00 00       	call   802542 <_panic>
+
+008002f1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002f1:	55                   	push   %ebp
+  8002f2:	89 e5                	mov    %esp,%ebp
+  8002f4:	57                   	push   %edi
+  8002f5:	56                   	push   %esi
+  8002f6:	53                   	push   %ebx
+  8002f7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8002fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800302:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800305:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80030a:	89 df                	mov    %ebx,%edi
+  80030c:	55                   	push   %ebp
+  80030d:	89 e5                	mov    %esp,%ebp
+  80030f:	8d 35 17 03 80 00    	lea    0x800317,%esi
+  800315:	0f 34                	sysenter
+  800317:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800318:	85 c0                	test   %eax,%eax
+  80031a:	7f 08                	jg     800324 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  80031c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031f:	5b                   	pop    %ebx
+  800320:	5e                   	pop    %esi
+  800321:	5f                   	pop    %edi
+  800322:	5d                   	pop    %ebp
+  800323:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	50                   	push   %eax
+  800328:	6a 0a                	push   $0xa
+  80032a:	68 6a 37 80 00       	push   $0x80376a
+  80032f:	6a 3d                	push   $0x3d
+  800331:	68 87 37 80 00       	push   $0x803787
+  800336:	e8 07 22 00 00       	call   802542 <_panic>
+
+0080033b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80033b:	55                   	push   %ebp
+  80033c:	89 e5                	mov    %esp,%ebp
+  80033e:	57                   	push   %edi
+  80033f:	56                   	push   %esi
+  800340:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800341:	8b 55 08             	mov    0x8(%ebp),%edx
+  800344:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800347:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80034c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80034f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800352:	55                   	push   %ebp
+  800353:	89 e5                	mov    %esp,%ebp
+  800355:	8d 35 5d 03 80 00    	lea    0x80035d,%esi
+  80035b:	0f 34                	sysenter
+  80035d:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  80035e:	5b                   	pop    %ebx
+  80035f:	5e                   	pop    %esi
+  800360:	5f                   	pop    %edi
+  800361:	5d                   	pop    %ebp
+  800362:	c3                   	ret
+
+00800363 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800363:	55                   	push   %ebp
+  800364:	89 e5                	mov    %esp,%ebp
+  800366:	57                   	push   %edi
+  800367:	56                   	push   %esi
+  800368:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800369:	8b 55 08             	mov    0x8(%ebp),%edx
+  80036c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80036f:	b8 17 00 00 00       	mov    $0x17,%eax
+  800374:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800377:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80037a:	55                   	push   %ebp
+  80037b:	89 e5                	mov    %esp,%ebp
+  80037d:	8d 35 85 03 80 00    	lea    0x800385,%esi
+  800383:	0f 34                	sysenter
+  800385:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800386:	5b                   	pop    %ebx
+  800387:	5e                   	pop    %esi
+  800388:	5f                   	pop    %edi
+  800389:	5d                   	pop    %ebp
+  80038a:	c3                   	ret
+
+0080038b <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  80038b:	55                   	push   %ebp
+  80038c:	89 e5                	mov    %esp,%ebp
+  80038e:	57                   	push   %edi
+  80038f:	56                   	push   %esi
+  800390:	53                   	push   %ebx
+  800391:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800394:	be 00 00 00 00       	mov    $0x0,%esi
+  800399:	8b 55 08             	mov    0x8(%ebp),%edx
+  80039c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80039f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003a7:	89 f7                	mov    %esi,%edi
+  8003a9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003ab:	85 c0                	test   %eax,%eax
+  8003ad:	7f 08                	jg     8003b7 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8003af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003b2:	5b                   	pop    %ebx
+  8003b3:	5e                   	pop    %esi
+  8003b4:	5f                   	pop    %edi
+  8003b5:	5d                   	pop    %ebp
+  8003b6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003b7:	83 ec 0c             	sub    $0xc,%esp
+  8003ba:	50                   	push   %eax
+  8003bb:	6a 0d                	push   $0xd
+  8003bd:	68 6a 37 80 00       	push   $0x80376a
+  8003c2:	6a 23                	push   $0x23
+  8003c4:	68 87 37 80 00       	push   $0x803787
+  8003c9:	e8 74 21 00 00       	call   802542 <_panic>
+
+008003ce <sys_ipc_recv>:
+{
+  8003ce:	55                   	push   %ebp
+  8003cf:	89 e5                	mov    %esp,%ebp
+  8003d1:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  8003d4:	6a 00                	push   $0x0
+  8003d6:	6a 01                	push   $0x1
+  8003d8:	ff 75 08             	push   0x8(%ebp)
+  8003db:	e8 ab ff ff ff       	call   80038b <sys_ipc_recvv>
+}
+  8003e0:	c9                   	leave
+  8003e1:	c3                   	ret
+
+008003e2 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  8003e2:	55                   	push   %ebp
+  8003e3:	89 e5                	mov    %esp,%ebp
+  8003e5:	57                   	push   %edi
+  8003e6:	56                   	push   %esi
+  8003e7:	53                   	push   %ebx
+  8003e8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003f6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003fb:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003fe:	89 de                	mov    %ebx,%esi
+  800400:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800402:	85 c0                	test   %eax,%eax
+  800404:	7f 08                	jg     80040e <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800406:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800409:	5b                   	pop    %ebx
+  80040a:	5e                   	pop    %esi
+  80040b:	5f                   	pop    %edi
+  80040c:	5d                   	pop    %ebp
+  80040d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80040e:	83 ec 0c             	sub    $0xc,%esp
+  800411:	50                   	push   %eax
+  800412:	6a 0d                	push   $0xd
+  800414:	68 6a 37 80 00       	push   $0x80376a
+  800419:	6a 23                	push   $0x23
+  80041b:	68 87 37 80 00       	push   $0x803787
+  800420:	e8 1d 21 00 00       	call   802542 <_panic>
+
+00800425 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800425:	55                   	push   %ebp
+  800426:	89 e5                	mov    %esp,%ebp
+  800428:	57                   	push   %edi
+  800429:	56                   	push   %esi
+  80042a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80042b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800430:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800435:	89 d1                	mov    %edx,%ecx
+  800437:	89 d3                	mov    %edx,%ebx
+  800439:	89 d7                	mov    %edx,%edi
+  80043b:	55                   	push   %ebp
+  80043c:	89 e5                	mov    %esp,%ebp
+  80043e:	8d 35 46 04 80 00    	lea    0x800446,%esi
+  800444:	0f 34                	sysenter
+  800446:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800447:	5b                   	pop    %ebx
+  800448:	5e                   	pop    %esi
+  800449:	5f                   	pop    %edi
+  80044a:	5d                   	pop    %ebp
+  80044b:	c3                   	ret
+
+0080044c <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  80044c:	55                   	push   %ebp
+  80044d:	89 e5                	mov    %esp,%ebp
+  80044f:	57                   	push   %edi
+  800450:	56                   	push   %esi
+  800451:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800452:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800457:	8b 55 08             	mov    0x8(%ebp),%edx
+  80045a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80045d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800462:	89 df                	mov    %ebx,%edi
+  800464:	55                   	push   %ebp
+  800465:	89 e5                	mov    %esp,%ebp
+  800467:	8d 35 6f 04 80 00    	lea    0x80046f,%esi
+  80046d:	0f 34                	sysenter
+  80046f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800470:	5b                   	pop    %ebx
+  800471:	5e                   	pop    %esi
+  800472:	5f                   	pop    %edi
+  800473:	5d                   	pop    %ebp
+  800474:	c3                   	ret
+
+00800475 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800475:	55                   	push   %ebp
+  800476:	89 e5                	mov    %esp,%ebp
+  800478:	57                   	push   %edi
+  800479:	56                   	push   %esi
+  80047a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80047b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800480:	8b 55 08             	mov    0x8(%ebp),%edx
+  800483:	b8 10 00 00 00       	mov    $0x10,%eax
+  800488:	89 cb                	mov    %ecx,%ebx
+  80048a:	89 cf                	mov    %ecx,%edi
+  80048c:	55                   	push   %ebp
+  80048d:	89 e5                	mov    %esp,%ebp
+  80048f:	8d 35 97 04 80 00    	lea    0x800497,%esi
+  800495:	0f 34                	sysenter
+  800497:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800498:	5b                   	pop    %ebx
+  800499:	5e                   	pop    %esi
+  80049a:	5f                   	pop    %edi
+  80049b:	5d                   	pop    %ebp
+  80049c:	c3                   	ret
+
+0080049d <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  80049d:	55                   	push   %ebp
+  80049e:	89 e5                	mov    %esp,%ebp
+  8004a0:	57                   	push   %edi
+  8004a1:	56                   	push   %esi
+  8004a2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ae:	b8 12 00 00 00       	mov    $0x12,%eax
+  8004b3:	89 df                	mov    %ebx,%edi
+  8004b5:	55                   	push   %ebp
+  8004b6:	89 e5                	mov    %esp,%ebp
+  8004b8:	8d 35 c0 04 80 00    	lea    0x8004c0,%esi
+  8004be:	0f 34                	sysenter
+  8004c0:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8004c1:	5b                   	pop    %ebx
+  8004c2:	5e                   	pop    %esi
+  8004c3:	5f                   	pop    %edi
+  8004c4:	5d                   	pop    %ebp
+  8004c5:	c3                   	ret
+
+008004c6 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8004c6:	55                   	push   %ebp
+  8004c7:	89 e5                	mov    %esp,%ebp
+  8004c9:	57                   	push   %edi
+  8004ca:	56                   	push   %esi
+  8004cb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004d7:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004dc:	89 df                	mov    %ebx,%edi
+  8004de:	55                   	push   %ebp
+  8004df:	89 e5                	mov    %esp,%ebp
+  8004e1:	8d 35 e9 04 80 00    	lea    0x8004e9,%esi
+  8004e7:	0f 34                	sysenter
+  8004e9:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  8004ea:	5b                   	pop    %ebx
+  8004eb:	5e                   	pop    %esi
+  8004ec:	5f                   	pop    %edi
+  8004ed:	5d                   	pop    %ebp
+  8004ee:	c3                   	ret
+
+008004ef <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  8004ef:	55                   	push   %ebp
+  8004f0:	89 e5                	mov    %esp,%ebp
+  8004f2:	57                   	push   %edi
+  8004f3:	56                   	push   %esi
+  8004f4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004fb:	b8 13 00 00 00       	mov    $0x13,%eax
+  800500:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800503:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800506:	55                   	push   %ebp
+  800507:	89 e5                	mov    %esp,%ebp
+  800509:	8d 35 11 05 80 00    	lea    0x800511,%esi
+  80050f:	0f 34                	sysenter
+  800511:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800512:	5b                   	pop    %ebx
+  800513:	5e                   	pop    %esi
+  800514:	5f                   	pop    %edi
+  800515:	5d                   	pop    %ebp
+  800516:	c3                   	ret
+
+00800517 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800517:	55                   	push   %ebp
+  800518:	89 e5                	mov    %esp,%ebp
+  80051a:	57                   	push   %edi
+  80051b:	56                   	push   %esi
+  80051c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80051d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800522:	8b 55 08             	mov    0x8(%ebp),%edx
+  800525:	b8 11 00 00 00       	mov    $0x11,%eax
+  80052a:	89 cb                	mov    %ecx,%ebx
+  80052c:	89 cf                	mov    %ecx,%edi
+  80052e:	89 ce                	mov    %ecx,%esi
+  800530:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800532:	5b                   	pop    %ebx
+  800533:	5e                   	pop    %esi
+  800534:	5f                   	pop    %edi
+  800535:	5d                   	pop    %ebp
+  800536:	c3                   	ret
+
+00800537 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800537:	55                   	push   %ebp
+  800538:	89 e5                	mov    %esp,%ebp
+  80053a:	57                   	push   %edi
+  80053b:	56                   	push   %esi
+  80053c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80053d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800542:	8b 55 08             	mov    0x8(%ebp),%edx
+  800545:	b8 15 00 00 00       	mov    $0x15,%eax
+  80054a:	89 cb                	mov    %ecx,%ebx
+  80054c:	89 cf                	mov    %ecx,%edi
+  80054e:	55                   	push   %ebp
+  80054f:	89 e5                	mov    %esp,%ebp
+  800551:	8d 35 59 05 80 00    	lea    0x800559,%esi
+  800557:	0f 34                	sysenter
+  800559:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  80055a:	5b                   	pop    %ebx
+  80055b:	5e                   	pop    %esi
+  80055c:	5f                   	pop    %edi
+  80055d:	5d                   	pop    %ebp
+  80055e:	c3                   	ret
+
+0080055f <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  80055f:	55                   	push   %ebp
+  800560:	89 e5                	mov    %esp,%ebp
+  800562:	57                   	push   %edi
+  800563:	56                   	push   %esi
+  800564:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800565:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80056a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80056d:	b8 16 00 00 00       	mov    $0x16,%eax
+  800572:	89 cb                	mov    %ecx,%ebx
+  800574:	89 cf                	mov    %ecx,%edi
+  800576:	55                   	push   %ebp
+  800577:	89 e5                	mov    %esp,%ebp
+  800579:	8d 35 81 05 80 00    	lea    0x800581,%esi
+  80057f:	0f 34                	sysenter
+  800581:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800582:	5b                   	pop    %ebx
+  800583:	5e                   	pop    %esi
+  800584:	5f                   	pop    %edi
+  800585:	5d                   	pop    %ebp
+  800586:	c3                   	ret
+
+00800587 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800587:	55                   	push   %ebp
+  800588:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80058a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80058d:	05 00 00 00 30       	add    $0x30000000,%eax
+  800592:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800595:	5d                   	pop    %ebp
+  800596:	c3                   	ret
+
+00800597 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800597:	55                   	push   %ebp
+  800598:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80059a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80059d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8005a2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8005a7:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8005ac:	5d                   	pop    %ebp
+  8005ad:	c3                   	ret
+
+008005ae <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8005ae:	55                   	push   %ebp
+  8005af:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8005b1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8005b6:	eb 02                	jmp    8005ba <fd_alloc+0xc>
+  8005b8:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8005ba:	89 c2                	mov    %eax,%edx
+  8005bc:	c1 ea 16             	shr    $0x16,%edx
+  8005bf:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8005c6:	f6 c2 01             	test   $0x1,%dl
+  8005c9:	74 2b                	je     8005f6 <fd_alloc+0x48>
+  8005cb:	89 c2                	mov    %eax,%edx
+  8005cd:	c1 ea 0c             	shr    $0xc,%edx
+  8005d0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8005d7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8005dd:	f6 c1 01             	test   $0x1,%cl
+  8005e0:	74 14                	je     8005f6 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8005e2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8005e8:	75 ce                	jne    8005b8 <fd_alloc+0xa>
+  8005ea:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8005ef:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8005f4:	eb 05                	jmp    8005fb <fd_alloc+0x4d>
+			return 0;
+  8005f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8005fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005fe:	89 02                	mov    %eax,(%edx)
+}
+  800600:	89 c8                	mov    %ecx,%eax
+  800602:	5d                   	pop    %ebp
+  800603:	c3                   	ret
+
+00800604 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800604:	55                   	push   %ebp
+  800605:	89 e5                	mov    %esp,%ebp
+  800607:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80060a:	83 f8 1f             	cmp    $0x1f,%eax
+  80060d:	77 30                	ja     80063f <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80060f:	c1 e0 0c             	shl    $0xc,%eax
+  800612:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800617:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80061d:	f6 c2 01             	test   $0x1,%dl
+  800620:	74 24                	je     800646 <fd_lookup+0x42>
+  800622:	89 c2                	mov    %eax,%edx
+  800624:	c1 ea 0c             	shr    $0xc,%edx
+  800627:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80062e:	f6 c2 01             	test   $0x1,%dl
+  800631:	74 1a                	je     80064d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800633:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800636:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800638:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80063d:	5d                   	pop    %ebp
+  80063e:	c3                   	ret
+		return -E_INVAL;
+  80063f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800644:	eb f7                	jmp    80063d <fd_lookup+0x39>
+		return -E_INVAL;
+  800646:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80064b:	eb f0                	jmp    80063d <fd_lookup+0x39>
+  80064d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800652:	eb e9                	jmp    80063d <fd_lookup+0x39>
+
+00800654 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800654:	55                   	push   %ebp
+  800655:	89 e5                	mov    %esp,%ebp
+  800657:	53                   	push   %ebx
+  800658:	83 ec 04             	sub    $0x4,%esp
+  80065b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80065e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800663:	eb 03                	jmp    800668 <dev_lookup+0x14>
+  800665:	83 c0 01             	add    $0x1,%eax
+  800668:	8b 1c 85 14 38 80 00 	mov    0x803814(,%eax,4),%ebx
+  80066f:	85 db                	test   %ebx,%ebx
+  800671:	74 0b                	je     80067e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800673:	39 13                	cmp    %edx,(%ebx)
+  800675:	75 ee                	jne    800665 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800677:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067c:	eb 1f                	jmp    80069d <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80067e:	a1 00 50 80 00       	mov    0x805000,%eax
+  800683:	8b 40 48             	mov    0x48(%eax),%eax
+  800686:	83 ec 04             	sub    $0x4,%esp
+  800689:	52                   	push   %edx
+  80068a:	50                   	push   %eax
+  80068b:	68 98 37 80 00       	push   $0x803798
+  800690:	e8 88 1f 00 00       	call   80261d <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800695:	83 c4 10             	add    $0x10,%esp
+  800698:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80069d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006a0:	89 1a                	mov    %ebx,(%edx)
+}
+  8006a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006a5:	c9                   	leave
+  8006a6:	c3                   	ret
+
+008006a7 <fd_close>:
+{
+  8006a7:	55                   	push   %ebp
+  8006a8:	89 e5                	mov    %esp,%ebp
+  8006aa:	57                   	push   %edi
+  8006ab:	56                   	push   %esi
+  8006ac:	53                   	push   %ebx
+  8006ad:	83 ec 24             	sub    $0x24,%esp
+  8006b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006b3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006b6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8006b9:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8006ba:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8006c0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006c3:	50                   	push   %eax
+  8006c4:	e8 3b ff ff ff       	call   800604 <fd_lookup>
+  8006c9:	89 c3                	mov    %eax,%ebx
+  8006cb:	83 c4 10             	add    $0x10,%esp
+  8006ce:	85 c0                	test   %eax,%eax
+  8006d0:	78 05                	js     8006d7 <fd_close+0x30>
+	    || fd != fd2)
+  8006d2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8006d5:	74 16                	je     8006ed <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8006d7:	89 f8                	mov    %edi,%eax
+  8006d9:	84 c0                	test   %al,%al
+  8006db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8006e3:	89 d8                	mov    %ebx,%eax
+  8006e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006e8:	5b                   	pop    %ebx
+  8006e9:	5e                   	pop    %esi
+  8006ea:	5f                   	pop    %edi
+  8006eb:	5d                   	pop    %ebp
+  8006ec:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8006ed:	83 ec 08             	sub    $0x8,%esp
+  8006f0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8006f3:	50                   	push   %eax
+  8006f4:	ff 36                	push   (%esi)
+  8006f6:	e8 59 ff ff ff       	call   800654 <dev_lookup>
+  8006fb:	89 c3                	mov    %eax,%ebx
+  8006fd:	83 c4 10             	add    $0x10,%esp
+  800700:	85 c0                	test   %eax,%eax
+  800702:	78 1a                	js     80071e <fd_close+0x77>
+		if (dev->dev_close)
+  800704:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800707:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80070a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80070f:	85 c0                	test   %eax,%eax
+  800711:	74 0b                	je     80071e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800713:	83 ec 0c             	sub    $0xc,%esp
+  800716:	56                   	push   %esi
+  800717:	ff d0                	call   *%eax
+  800719:	89 c3                	mov    %eax,%ebx
+  80071b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80071e:	83 ec 08             	sub    $0x8,%esp
+  800721:	56                   	push   %esi
+  800722:	6a 00                	push   $0x0
+  800724:	e8 ea fa ff ff       	call   800213 <sys_page_unmap>
+	return r;
+  800729:	83 c4 10             	add    $0x10,%esp
+  80072c:	eb b5                	jmp    8006e3 <fd_close+0x3c>
+
+0080072e <close>:
+
+int
+close(int fdnum)
+{
+  80072e:	55                   	push   %ebp
+  80072f:	89 e5                	mov    %esp,%ebp
+  800731:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800734:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800737:	50                   	push   %eax
+  800738:	ff 75 08             	push   0x8(%ebp)
+  80073b:	e8 c4 fe ff ff       	call   800604 <fd_lookup>
+  800740:	83 c4 10             	add    $0x10,%esp
+  800743:	85 c0                	test   %eax,%eax
+  800745:	79 02                	jns    800749 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800747:	c9                   	leave
+  800748:	c3                   	ret
+		return fd_close(fd, 1);
+  800749:	83 ec 08             	sub    $0x8,%esp
+  80074c:	6a 01                	push   $0x1
+  80074e:	ff 75 f4             	push   -0xc(%ebp)
+  800751:	e8 51 ff ff ff       	call   8006a7 <fd_close>
+  800756:	83 c4 10             	add    $0x10,%esp
+  800759:	eb ec                	jmp    800747 <close+0x19>
+
+0080075b <close_all>:
+
+void
+close_all(void)
+{
+  80075b:	55                   	push   %ebp
+  80075c:	89 e5                	mov    %esp,%ebp
+  80075e:	53                   	push   %ebx
+  80075f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800762:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800767:	83 ec 0c             	sub    $0xc,%esp
+  80076a:	53                   	push   %ebx
+  80076b:	e8 be ff ff ff       	call   80072e <close>
+	for (i = 0; i < MAXFD; i++)
+  800770:	83 c3 01             	add    $0x1,%ebx
+  800773:	83 c4 10             	add    $0x10,%esp
+  800776:	83 fb 20             	cmp    $0x20,%ebx
+  800779:	75 ec                	jne    800767 <close_all+0xc>
+}
+  80077b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80077e:	c9                   	leave
+  80077f:	c3                   	ret
+
+00800780 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800780:	55                   	push   %ebp
+  800781:	89 e5                	mov    %esp,%ebp
+  800783:	57                   	push   %edi
+  800784:	56                   	push   %esi
+  800785:	53                   	push   %ebx
+  800786:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800789:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80078c:	50                   	push   %eax
+  80078d:	ff 75 08             	push   0x8(%ebp)
+  800790:	e8 6f fe ff ff       	call   800604 <fd_lookup>
+  800795:	89 c3                	mov    %eax,%ebx
+  800797:	83 c4 10             	add    $0x10,%esp
+  80079a:	85 c0                	test   %eax,%eax
+  80079c:	78 7f                	js     80081d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80079e:	83 ec 0c             	sub    $0xc,%esp
+  8007a1:	ff 75 0c             	push   0xc(%ebp)
+  8007a4:	e8 85 ff ff ff       	call   80072e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8007a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8007ac:	c1 e6 0c             	shl    $0xc,%esi
+  8007af:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8007b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8007b8:	89 3c 24             	mov    %edi,(%esp)
+  8007bb:	e8 d7 fd ff ff       	call   800597 <fd2data>
+  8007c0:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8007c2:	89 34 24             	mov    %esi,(%esp)
+  8007c5:	e8 cd fd ff ff       	call   800597 <fd2data>
+  8007ca:	83 c4 10             	add    $0x10,%esp
+  8007cd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8007d0:	89 d8                	mov    %ebx,%eax
+  8007d2:	c1 e8 16             	shr    $0x16,%eax
+  8007d5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8007dc:	a8 01                	test   $0x1,%al
+  8007de:	74 11                	je     8007f1 <dup+0x71>
+  8007e0:	89 d8                	mov    %ebx,%eax
+  8007e2:	c1 e8 0c             	shr    $0xc,%eax
+  8007e5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8007ec:	f6 c2 01             	test   $0x1,%dl
+  8007ef:	75 36                	jne    800827 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8007f1:	89 f8                	mov    %edi,%eax
+  8007f3:	c1 e8 0c             	shr    $0xc,%eax
+  8007f6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8007fd:	83 ec 0c             	sub    $0xc,%esp
+  800800:	25 07 0e 00 00       	and    $0xe07,%eax
+  800805:	50                   	push   %eax
+  800806:	56                   	push   %esi
+  800807:	6a 00                	push   $0x0
+  800809:	57                   	push   %edi
+  80080a:	6a 00                	push   $0x0
+  80080c:	e8 c0 f9 ff ff       	call   8001d1 <sys_page_map>
+  800811:	89 c3                	mov    %eax,%ebx
+  800813:	83 c4 20             	add    $0x20,%esp
+  800816:	85 c0                	test   %eax,%eax
+  800818:	78 33                	js     80084d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80081a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80081d:	89 d8                	mov    %ebx,%eax
+  80081f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800822:	5b                   	pop    %ebx
+  800823:	5e                   	pop    %esi
+  800824:	5f                   	pop    %edi
+  800825:	5d                   	pop    %ebp
+  800826:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800827:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80082e:	83 ec 0c             	sub    $0xc,%esp
+  800831:	25 07 0e 00 00       	and    $0xe07,%eax
+  800836:	50                   	push   %eax
+  800837:	ff 75 d4             	push   -0x2c(%ebp)
+  80083a:	6a 00                	push   $0x0
+  80083c:	53                   	push   %ebx
+  80083d:	6a 00                	push   $0x0
+  80083f:	e8 8d f9 ff ff       	call   8001d1 <sys_page_map>
+  800844:	89 c3                	mov    %eax,%ebx
+  800846:	83 c4 20             	add    $0x20,%esp
+  800849:	85 c0                	test   %eax,%eax
+  80084b:	79 a4                	jns    8007f1 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80084d:	83 ec 08             	sub    $0x8,%esp
+  800850:	56                   	push   %esi
+  800851:	6a 00                	push   $0x0
+  800853:	e8 bb f9 ff ff       	call   800213 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800858:	83 c4 08             	add    $0x8,%esp
+  80085b:	ff 75 d4             	push   -0x2c(%ebp)
+  80085e:	6a 00                	push   $0x0
+  800860:	e8 ae f9 ff ff       	call   800213 <sys_page_unmap>
+	return r;
+  800865:	83 c4 10             	add    $0x10,%esp
+  800868:	eb b3                	jmp    80081d <dup+0x9d>
+
+0080086a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80086a:	55                   	push   %ebp
+  80086b:	89 e5                	mov    %esp,%ebp
+  80086d:	56                   	push   %esi
+  80086e:	53                   	push   %ebx
+  80086f:	83 ec 18             	sub    $0x18,%esp
+  800872:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800875:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800878:	50                   	push   %eax
+  800879:	56                   	push   %esi
+  80087a:	e8 85 fd ff ff       	call   800604 <fd_lookup>
+  80087f:	83 c4 10             	add    $0x10,%esp
+  800882:	85 c0                	test   %eax,%eax
+  800884:	78 3c                	js     8008c2 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800886:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800889:	83 ec 08             	sub    $0x8,%esp
+  80088c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80088f:	50                   	push   %eax
+  800890:	ff 33                	push   (%ebx)
+  800892:	e8 bd fd ff ff       	call   800654 <dev_lookup>
+  800897:	83 c4 10             	add    $0x10,%esp
+  80089a:	85 c0                	test   %eax,%eax
+  80089c:	78 24                	js     8008c2 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80089e:	8b 43 08             	mov    0x8(%ebx),%eax
+  8008a1:	83 e0 03             	and    $0x3,%eax
+  8008a4:	83 f8 01             	cmp    $0x1,%eax
+  8008a7:	74 20                	je     8008c9 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8008a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008ac:	8b 40 08             	mov    0x8(%eax),%eax
+  8008af:	85 c0                	test   %eax,%eax
+  8008b1:	74 37                	je     8008ea <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8008b3:	83 ec 04             	sub    $0x4,%esp
+  8008b6:	ff 75 10             	push   0x10(%ebp)
+  8008b9:	ff 75 0c             	push   0xc(%ebp)
+  8008bc:	53                   	push   %ebx
+  8008bd:	ff d0                	call   *%eax
+  8008bf:	83 c4 10             	add    $0x10,%esp
+}
+  8008c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008c5:	5b                   	pop    %ebx
+  8008c6:	5e                   	pop    %esi
+  8008c7:	5d                   	pop    %ebp
+  8008c8:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8008c9:	a1 00 50 80 00       	mov    0x805000,%eax
+  8008ce:	8b 40 48             	mov    0x48(%eax),%eax
+  8008d1:	83 ec 04             	sub    $0x4,%esp
+  8008d4:	56                   	push   %esi
+  8008d5:	50                   	push   %eax
+  8008d6:	68 d9 37 80 00       	push   $0x8037d9
+  8008db:	e8 3d 1d 00 00       	call   80261d <cprintf>
+		return -E_INVAL;
+  8008e0:	83 c4 10             	add    $0x10,%esp
+  8008e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008e8:	eb d8                	jmp    8008c2 <read+0x58>
+		return -E_NOT_SUPP;
+  8008ea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8008ef:	eb d1                	jmp    8008c2 <read+0x58>
+
+008008f1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8008f1:	55                   	push   %ebp
+  8008f2:	89 e5                	mov    %esp,%ebp
+  8008f4:	57                   	push   %edi
+  8008f5:	56                   	push   %esi
+  8008f6:	53                   	push   %ebx
+  8008f7:	83 ec 0c             	sub    $0xc,%esp
+  8008fa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008fd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800900:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800905:	eb 02                	jmp    800909 <readn+0x18>
+  800907:	01 c3                	add    %eax,%ebx
+  800909:	39 f3                	cmp    %esi,%ebx
+  80090b:	73 21                	jae    80092e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80090d:	83 ec 04             	sub    $0x4,%esp
+  800910:	89 f0                	mov    %esi,%eax
+  800912:	29 d8                	sub    %ebx,%eax
+  800914:	50                   	push   %eax
+  800915:	89 d8                	mov    %ebx,%eax
+  800917:	03 45 0c             	add    0xc(%ebp),%eax
+  80091a:	50                   	push   %eax
+  80091b:	57                   	push   %edi
+  80091c:	e8 49 ff ff ff       	call   80086a <read>
+		if (m < 0)
+  800921:	83 c4 10             	add    $0x10,%esp
+  800924:	85 c0                	test   %eax,%eax
+  800926:	78 04                	js     80092c <readn+0x3b>
+			return m;
+		if (m == 0)
+  800928:	75 dd                	jne    800907 <readn+0x16>
+  80092a:	eb 02                	jmp    80092e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80092c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80092e:	89 d8                	mov    %ebx,%eax
+  800930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800933:	5b                   	pop    %ebx
+  800934:	5e                   	pop    %esi
+  800935:	5f                   	pop    %edi
+  800936:	5d                   	pop    %ebp
+  800937:	c3                   	ret
+
+00800938 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800938:	55                   	push   %ebp
+  800939:	89 e5                	mov    %esp,%ebp
+  80093b:	56                   	push   %esi
+  80093c:	53                   	push   %ebx
+  80093d:	83 ec 18             	sub    $0x18,%esp
+  800940:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800943:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800946:	50                   	push   %eax
+  800947:	53                   	push   %ebx
+  800948:	e8 b7 fc ff ff       	call   800604 <fd_lookup>
+  80094d:	83 c4 10             	add    $0x10,%esp
+  800950:	85 c0                	test   %eax,%eax
+  800952:	78 37                	js     80098b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800954:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800957:	83 ec 08             	sub    $0x8,%esp
+  80095a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80095d:	50                   	push   %eax
+  80095e:	ff 36                	push   (%esi)
+  800960:	e8 ef fc ff ff       	call   800654 <dev_lookup>
+  800965:	83 c4 10             	add    $0x10,%esp
+  800968:	85 c0                	test   %eax,%eax
+  80096a:	78 1f                	js     80098b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80096c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800970:	74 20                	je     800992 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800972:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800975:	8b 40 0c             	mov    0xc(%eax),%eax
+  800978:	85 c0                	test   %eax,%eax
+  80097a:	74 37                	je     8009b3 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80097c:	83 ec 04             	sub    $0x4,%esp
+  80097f:	ff 75 10             	push   0x10(%ebp)
+  800982:	ff 75 0c             	push   0xc(%ebp)
+  800985:	56                   	push   %esi
+  800986:	ff d0                	call   *%eax
+  800988:	83 c4 10             	add    $0x10,%esp
+}
+  80098b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80098e:	5b                   	pop    %ebx
+  80098f:	5e                   	pop    %esi
+  800990:	5d                   	pop    %ebp
+  800991:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800992:	a1 00 50 80 00       	mov    0x805000,%eax
+  800997:	8b 40 48             	mov    0x48(%eax),%eax
+  80099a:	83 ec 04             	sub    $0x4,%esp
+  80099d:	53                   	push   %ebx
+  80099e:	50                   	push   %eax
+  80099f:	68 f5 37 80 00       	push   $0x8037f5
+  8009a4:	e8 74 1c 00 00       	call   80261d <cprintf>
+		return -E_INVAL;
+  8009a9:	83 c4 10             	add    $0x10,%esp
+  8009ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009b1:	eb d8                	jmp    80098b <write+0x53>
+		return -E_NOT_SUPP;
+  8009b3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009b8:	eb d1                	jmp    80098b <write+0x53>
+
+008009ba <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8009ba:	55                   	push   %ebp
+  8009bb:	89 e5                	mov    %esp,%ebp
+  8009bd:	53                   	push   %ebx
+  8009be:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009c1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009c4:	50                   	push   %eax
+  8009c5:	ff 75 08             	push   0x8(%ebp)
+  8009c8:	e8 37 fc ff ff       	call   800604 <fd_lookup>
+  8009cd:	83 c4 10             	add    $0x10,%esp
+  8009d0:	85 c0                	test   %eax,%eax
+  8009d2:	78 3a                	js     800a0e <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009d4:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8009d7:	83 ec 08             	sub    $0x8,%esp
+  8009da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009dd:	50                   	push   %eax
+  8009de:	ff 33                	push   (%ebx)
+  8009e0:	e8 6f fc ff ff       	call   800654 <dev_lookup>
+  8009e5:	83 c4 10             	add    $0x10,%esp
+  8009e8:	85 c0                	test   %eax,%eax
+  8009ea:	78 22                	js     800a0e <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8009ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009ef:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8009f2:	85 c0                	test   %eax,%eax
+  8009f4:	74 0d                	je     800a03 <seek+0x49>
+  8009f6:	83 ec 0c             	sub    $0xc,%esp
+  8009f9:	53                   	push   %ebx
+  8009fa:	ff d0                	call   *%eax
+  8009fc:	83 c4 10             	add    $0x10,%esp
+  8009ff:	85 c0                	test   %eax,%eax
+  800a01:	78 0b                	js     800a0e <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  800a03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a06:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  800a09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a11:	c9                   	leave
+  800a12:	c3                   	ret
+
+00800a13 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  800a13:	55                   	push   %ebp
+  800a14:	89 e5                	mov    %esp,%ebp
+  800a16:	53                   	push   %ebx
+  800a17:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a1a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a1d:	50                   	push   %eax
+  800a1e:	ff 75 08             	push   0x8(%ebp)
+  800a21:	e8 de fb ff ff       	call   800604 <fd_lookup>
+  800a26:	83 c4 10             	add    $0x10,%esp
+  800a29:	85 c0                	test   %eax,%eax
+  800a2b:	78 2b                	js     800a58 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a2d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a30:	83 ec 08             	sub    $0x8,%esp
+  800a33:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a36:	50                   	push   %eax
+  800a37:	ff 33                	push   (%ebx)
+  800a39:	e8 16 fc ff ff       	call   800654 <dev_lookup>
+  800a3e:	83 c4 10             	add    $0x10,%esp
+  800a41:	85 c0                	test   %eax,%eax
+  800a43:	78 13                	js     800a58 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  800a45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a48:	8b 40 1c             	mov    0x1c(%eax),%eax
+  800a4b:	85 c0                	test   %eax,%eax
+  800a4d:	74 0e                	je     800a5d <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  800a4f:	83 ec 0c             	sub    $0xc,%esp
+  800a52:	53                   	push   %ebx
+  800a53:	ff d0                	call   *%eax
+  800a55:	83 c4 10             	add    $0x10,%esp
+}
+  800a58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a5b:	c9                   	leave
+  800a5c:	c3                   	ret
+		return 0;
+  800a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a62:	eb f4                	jmp    800a58 <fsync+0x45>
+
+00800a64 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a64:	55                   	push   %ebp
+  800a65:	89 e5                	mov    %esp,%ebp
+  800a67:	56                   	push   %esi
+  800a68:	53                   	push   %ebx
+  800a69:	83 ec 18             	sub    $0x18,%esp
+  800a6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a6f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a72:	50                   	push   %eax
+  800a73:	53                   	push   %ebx
+  800a74:	e8 8b fb ff ff       	call   800604 <fd_lookup>
+  800a79:	83 c4 10             	add    $0x10,%esp
+  800a7c:	85 c0                	test   %eax,%eax
+  800a7e:	78 34                	js     800ab4 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a80:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a83:	83 ec 08             	sub    $0x8,%esp
+  800a86:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a89:	50                   	push   %eax
+  800a8a:	ff 36                	push   (%esi)
+  800a8c:	e8 c3 fb ff ff       	call   800654 <dev_lookup>
+  800a91:	83 c4 10             	add    $0x10,%esp
+  800a94:	85 c0                	test   %eax,%eax
+  800a96:	78 1c                	js     800ab4 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a98:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a9c:	74 1d                	je     800abb <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800a9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800aa1:	8b 40 18             	mov    0x18(%eax),%eax
+  800aa4:	85 c0                	test   %eax,%eax
+  800aa6:	74 34                	je     800adc <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800aa8:	83 ec 08             	sub    $0x8,%esp
+  800aab:	ff 75 0c             	push   0xc(%ebp)
+  800aae:	56                   	push   %esi
+  800aaf:	ff d0                	call   *%eax
+  800ab1:	83 c4 10             	add    $0x10,%esp
+}
+  800ab4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ab7:	5b                   	pop    %ebx
+  800ab8:	5e                   	pop    %esi
+  800ab9:	5d                   	pop    %ebp
+  800aba:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800abb:	a1 00 50 80 00       	mov    0x805000,%eax
+  800ac0:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ac3:	83 ec 04             	sub    $0x4,%esp
+  800ac6:	53                   	push   %ebx
+  800ac7:	50                   	push   %eax
+  800ac8:	68 b8 37 80 00       	push   $0x8037b8
+  800acd:	e8 4b 1b 00 00       	call   80261d <cprintf>
+		return -E_INVAL;
+  800ad2:	83 c4 10             	add    $0x10,%esp
+  800ad5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ada:	eb d8                	jmp    800ab4 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800adc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ae1:	eb d1                	jmp    800ab4 <ftruncate+0x50>
+
+00800ae3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800ae3:	55                   	push   %ebp
+  800ae4:	89 e5                	mov    %esp,%ebp
+  800ae6:	56                   	push   %esi
+  800ae7:	53                   	push   %ebx
+  800ae8:	83 ec 18             	sub    $0x18,%esp
+  800aeb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800aee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800af1:	50                   	push   %eax
+  800af2:	ff 75 08             	push   0x8(%ebp)
+  800af5:	e8 0a fb ff ff       	call   800604 <fd_lookup>
+  800afa:	83 c4 10             	add    $0x10,%esp
+  800afd:	85 c0                	test   %eax,%eax
+  800aff:	78 49                	js     800b4a <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b01:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b04:	83 ec 08             	sub    $0x8,%esp
+  800b07:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b0a:	50                   	push   %eax
+  800b0b:	ff 36                	push   (%esi)
+  800b0d:	e8 42 fb ff ff       	call   800654 <dev_lookup>
+  800b12:	83 c4 10             	add    $0x10,%esp
+  800b15:	85 c0                	test   %eax,%eax
+  800b17:	78 31                	js     800b4a <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b1c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b20:	74 2f                	je     800b51 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b22:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b25:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b2c:	00 00 00 
+	stat->st_isdir = 0;
+  800b2f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b36:	00 00 00 
+	stat->st_dev = dev;
+  800b39:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b3f:	83 ec 08             	sub    $0x8,%esp
+  800b42:	53                   	push   %ebx
+  800b43:	56                   	push   %esi
+  800b44:	ff 50 14             	call   *0x14(%eax)
+  800b47:	83 c4 10             	add    $0x10,%esp
+}
+  800b4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b4d:	5b                   	pop    %ebx
+  800b4e:	5e                   	pop    %esi
+  800b4f:	5d                   	pop    %ebp
+  800b50:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b51:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b56:	eb f2                	jmp    800b4a <fstat+0x67>
+
+00800b58 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b58:	55                   	push   %ebp
+  800b59:	89 e5                	mov    %esp,%ebp
+  800b5b:	56                   	push   %esi
+  800b5c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  800b5d:	83 ec 08             	sub    $0x8,%esp
+  800b60:	68 00 10 00 00       	push   $0x1000
+  800b65:	ff 75 08             	push   0x8(%ebp)
+  800b68:	e8 b3 07 00 00       	call   801320 <open>
+  800b6d:	89 c3                	mov    %eax,%ebx
+  800b6f:	83 c4 10             	add    $0x10,%esp
+  800b72:	85 c0                	test   %eax,%eax
+  800b74:	78 1b                	js     800b91 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  800b76:	83 ec 08             	sub    $0x8,%esp
+  800b79:	ff 75 0c             	push   0xc(%ebp)
+  800b7c:	50                   	push   %eax
+  800b7d:	e8 61 ff ff ff       	call   800ae3 <fstat>
+  800b82:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800b84:	89 1c 24             	mov    %ebx,(%esp)
+  800b87:	e8 a2 fb ff ff       	call   80072e <close>
+	return r;
+  800b8c:	83 c4 10             	add    $0x10,%esp
+  800b8f:	89 f3                	mov    %esi,%ebx
+}
+  800b91:	89 d8                	mov    %ebx,%eax
+  800b93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b96:	5b                   	pop    %ebx
+  800b97:	5e                   	pop    %esi
+  800b98:	5d                   	pop    %ebp
+  800b99:	c3                   	ret
+
+00800b9a <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  800b9a:	55                   	push   %ebp
+  800b9b:	89 e5                	mov    %esp,%ebp
+  800b9d:	57                   	push   %edi
+  800b9e:	56                   	push   %esi
+  800b9f:	53                   	push   %ebx
+  800ba0:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  800ba6:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  800bac:	89 d6                	mov    %edx,%esi
+  800bae:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  800bb4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  800bb7:	89 d3                	mov    %edx,%ebx
+  800bb9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  800bbf:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800bc6:	74 1d                	je     800be5 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  800bc8:	b8 00 60 80 00       	mov    $0x806000,%eax
+  800bcd:	83 c8 07             	or     $0x7,%eax
+  800bd0:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  800bd6:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800bdb:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  800be1:	01 ce                	add    %ecx,%esi
+  800be3:	eb 28                	jmp    800c0d <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800be5:	83 ec 0c             	sub    $0xc,%esp
+  800be8:	6a 01                	push   $0x1
+  800bea:	e8 05 28 00 00       	call   8033f4 <ipc_find_env>
+  800bef:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800bf4:	83 c4 10             	add    $0x10,%esp
+  800bf7:	eb cf                	jmp    800bc8 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  800bf9:	83 c0 01             	add    $0x1,%eax
+  800bfc:	89 fa                	mov    %edi,%edx
+  800bfe:	09 da                	or     %ebx,%edx
+  800c00:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800c07:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800c0d:	39 f3                	cmp    %esi,%ebx
+  800c0f:	72 e8                	jb     800bf9 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  800c11:	83 f8 41             	cmp    $0x41,%eax
+  800c14:	77 2f                	ja     800c45 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  800c16:	50                   	push   %eax
+  800c17:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  800c1d:	50                   	push   %eax
+  800c1e:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  800c24:	ff 35 c8 70 80 00    	push   0x8070c8
+  800c2a:	e8 77 27 00 00       	call   8033a6 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  800c2f:	83 c4 0c             	add    $0xc,%esp
+  800c32:	6a 00                	push   $0x0
+  800c34:	6a 00                	push   $0x0
+  800c36:	6a 00                	push   $0x0
+  800c38:	e8 13 26 00 00       	call   803250 <ipc_recv>
+}
+  800c3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c40:	5b                   	pop    %ebx
+  800c41:	5e                   	pop    %esi
+  800c42:	5f                   	pop    %edi
+  800c43:	5d                   	pop    %ebp
+  800c44:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  800c45:	68 28 38 80 00       	push   $0x803828
+  800c4a:	68 44 38 80 00       	push   $0x803844
+  800c4f:	6a 40                	push   $0x40
+  800c51:	68 59 38 80 00       	push   $0x803859
+  800c56:	e8 e7 18 00 00       	call   802542 <_panic>
+
+00800c5b <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  800c5b:	55                   	push   %ebp
+  800c5c:	89 e5                	mov    %esp,%ebp
+  800c5e:	57                   	push   %edi
+  800c5f:	56                   	push   %esi
+  800c60:	53                   	push   %ebx
+  800c61:	83 ec 1c             	sub    $0x1c,%esp
+  800c64:	89 c3                	mov    %eax,%ebx
+  800c66:	89 d6                	mov    %edx,%esi
+  800c68:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  800c6b:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  800c71:	89 ca                	mov    %ecx,%edx
+  800c73:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  800c76:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  800c7d:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  800c80:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  800c87:	8b 76 0c             	mov    0xc(%esi),%esi
+  800c8a:	89 fb                	mov    %edi,%ebx
+  800c8c:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  800c93:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c96:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  800c9d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ca0:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  800ca7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800caa:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  800cb1:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  800cb4:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  800cbb:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  800cc0:	39 c8                	cmp    %ecx,%eax
+  800cc2:	74 0d                	je     800cd1 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  800cc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ccc:	5b                   	pop    %ebx
+  800ccd:	5e                   	pop    %esi
+  800cce:	5f                   	pop    %edi
+  800ccf:	5d                   	pop    %ebp
+  800cd0:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cd1:	6a 07                	push   $0x7
+  800cd3:	68 00 60 80 00       	push   $0x806000
+  800cd8:	6a 0d                	push   $0xd
+  800cda:	ff 35 c8 70 80 00    	push   0x8070c8
+  800ce0:	e8 d6 25 00 00       	call   8032bb <ipc_send>
+  800ce5:	83 c4 10             	add    $0x10,%esp
+  800ce8:	eb da                	jmp    800cc4 <fsring_post+0x69>
+
+00800cea <fsipcv>:
+{
+  800cea:	55                   	push   %ebp
+  800ceb:	89 e5                	mov    %esp,%ebp
+  800ced:	57                   	push   %edi
+  800cee:	56                   	push   %esi
+  800cef:	53                   	push   %ebx
+  800cf0:	83 ec 0c             	sub    $0xc,%esp
+  800cf3:	89 c7                	mov    %eax,%edi
+  800cf5:	89 d3                	mov    %edx,%ebx
+  800cf7:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  800cf9:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800d00:	74 26                	je     800d28 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800d02:	6a 07                	push   $0x7
+  800d04:	68 00 60 80 00       	push   $0x806000
+  800d09:	57                   	push   %edi
+  800d0a:	ff 35 c8 70 80 00    	push   0x8070c8
+  800d10:	e8 a6 25 00 00       	call   8032bb <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  800d15:	6a 00                	push   $0x0
+  800d17:	56                   	push   %esi
+  800d18:	53                   	push   %ebx
+  800d19:	6a 00                	push   $0x0
+  800d1b:	e8 f3 25 00 00       	call   803313 <ipc_recvv>
+}
+  800d20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d23:	5b                   	pop    %ebx
+  800d24:	5e                   	pop    %esi
+  800d25:	5f                   	pop    %edi
+  800d26:	5d                   	pop    %ebp
+  800d27:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d28:	83 ec 0c             	sub    $0xc,%esp
+  800d2b:	6a 01                	push   $0x1
+  800d2d:	e8 c2 26 00 00       	call   8033f4 <ipc_find_env>
+  800d32:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800d37:	83 c4 10             	add    $0x10,%esp
+  800d3a:	eb c6                	jmp    800d02 <fsipcv+0x18>
+
+00800d3c <fsipc>:
+{
+  800d3c:	55                   	push   %ebp
+  800d3d:	89 e5                	mov    %esp,%ebp
+  800d3f:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  800d42:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  800d49:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800d4c:	e8 99 ff ff ff       	call   800cea <fsipcv>
+}
+  800d51:	c9                   	leave
+  800d52:	c3                   	ret
+
+00800d53 <file_write_direct>:
+{
+  800d53:	55                   	push   %ebp
+  800d54:	89 e5                	mov    %esp,%ebp
+  800d56:	56                   	push   %esi
+  800d57:	53                   	push   %ebx
+  800d58:	89 c3                	mov    %eax,%ebx
+  800d5a:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800d5c:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  800d62:	77 40                	ja     800da4 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800d64:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  800d69:	39 c8                	cmp    %ecx,%eax
+  800d6b:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d6e:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  800d71:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  800d77:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800d7c:	83 ec 04             	sub    $0x4,%esp
+  800d7f:	50                   	push   %eax
+  800d80:	52                   	push   %edx
+  800d81:	68 08 60 80 00       	push   $0x806008
+  800d86:	e8 06 20 00 00       	call   802d91 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800d8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d90:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d95:	e8 a2 ff ff ff       	call   800d3c <fsipc>
+  800d9a:	83 c4 10             	add    $0x10,%esp
+}
+  800d9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800da0:	5b                   	pop    %ebx
+  800da1:	5e                   	pop    %esi
+  800da2:	5d                   	pop    %ebp
+  800da3:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  800da4:	89 d6                	mov    %edx,%esi
+  800da6:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  800dac:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  800db1:	29 f1                	sub    %esi,%ecx
+  800db3:	39 c1                	cmp    %eax,%ecx
+  800db5:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  800db8:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800dbb:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  800dc0:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  800dc6:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  800dcc:	83 ec 0c             	sub    $0xc,%esp
+  800dcf:	6a 05                	push   $0x5
+  800dd1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dd6:	e8 bf fd ff ff       	call   800b9a <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  800ddb:	83 c4 10             	add    $0x10,%esp
+  800dde:	eb bd                	jmp    800d9d <file_write_direct+0x4a>
+
+00800de0 <devfile_sync>:
+{
+  800de0:	55                   	push   %ebp
+  800de1:	89 e5                	mov    %esp,%ebp
+  800de3:	57                   	push   %edi
+  800de4:	56                   	push   %esi
+  800de5:	53                   	push   %ebx
+  800de6:	83 ec 28             	sub    $0x28,%esp
+  800de9:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  800dec:	56                   	push   %esi
+  800ded:	e8 a5 f7 ff ff       	call   800597 <fd2data>
+  800df2:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  800df4:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  800df7:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  800dfe:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800e01:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  800e06:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  800e0a:	74 45                	je     800e51 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  800e0c:	8b 46 14             	mov    0x14(%esi),%eax
+  800e0f:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e1c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e1f:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  800e22:	39 cb                	cmp    %ecx,%ebx
+  800e24:	73 14                	jae    800e3a <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  800e26:	29 d9                	sub    %ebx,%ecx
+  800e28:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800e2b:	89 f0                	mov    %esi,%eax
+  800e2d:	e8 21 ff ff ff       	call   800d53 <file_write_direct>
+  800e32:	85 c0                	test   %eax,%eax
+  800e34:	7e 04                	jle    800e3a <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e36:	01 c3                	add    %eax,%ebx
+  800e38:	eb e5                	jmp    800e1f <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  800e3a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e3d:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  800e44:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  800e47:	85 c0                	test   %eax,%eax
+  800e49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  800e51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e54:	5b                   	pop    %ebx
+  800e55:	5e                   	pop    %esi
+  800e56:	5f                   	pop    %edi
+  800e57:	5d                   	pop    %ebp
+  800e58:	c3                   	ret
+
+00800e59 <devfile_write>:
+{
+  800e59:	55                   	push   %ebp
+  800e5a:	89 e5                	mov    %esp,%ebp
+  800e5c:	57                   	push   %edi
+  800e5d:	56                   	push   %esi
+  800e5e:	53                   	push   %ebx
+  800e5f:	83 ec 28             	sub    $0x28,%esp
+  800e62:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e65:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  800e68:	53                   	push   %ebx
+  800e69:	e8 29 f7 ff ff       	call   800597 <fd2data>
+  800e6e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  800e71:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  800e74:	83 c4 10             	add    $0x10,%esp
+  800e77:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  800e7b:	74 43                	je     800ec0 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  800e7d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  800e84:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800e87:	85 c0                	test   %eax,%eax
+  800e89:	74 43                	je     800ece <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  800e8b:	89 c2                	mov    %eax,%edx
+  800e8d:	03 53 14             	add    0x14(%ebx),%edx
+  800e90:	39 fa                	cmp    %edi,%edx
+  800e92:	75 0b                	jne    800e9f <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  800e94:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  800e97:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  800e9d:	76 66                	jbe    800f05 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  800e9f:	83 ec 0c             	sub    $0xc,%esp
+  800ea2:	53                   	push   %ebx
+  800ea3:	e8 38 ff ff ff       	call   800de0 <devfile_sync>
+  800ea8:	83 c4 10             	add    $0x10,%esp
+  800eab:	85 c0                	test   %eax,%eax
+  800ead:	78 4e                	js     800efd <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800eaf:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800eb5:	77 56                	ja     800f0d <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  800eb7:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800eba:	85 c0                	test   %eax,%eax
+  800ebc:	75 20                	jne    800ede <devfile_write+0x85>
+  800ebe:	eb 16                	jmp    800ed6 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  800ec0:	89 f1                	mov    %esi,%ecx
+  800ec2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ec5:	89 d8                	mov    %ebx,%eax
+  800ec7:	e8 87 fe ff ff       	call   800d53 <file_write_direct>
+  800ecc:	eb 2f                	jmp    800efd <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800ece:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800ed4:	77 37                	ja     800f0d <devfile_write+0xb4>
+		ff->buf_base = pos;
+  800ed6:	89 7b 14             	mov    %edi,0x14(%ebx)
+  800ed9:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  800ede:	83 ec 04             	sub    $0x4,%esp
+  800ee1:	56                   	push   %esi
+  800ee2:	ff 75 0c             	push   0xc(%ebp)
+  800ee5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800ee8:	01 c1                	add    %eax,%ecx
+  800eea:	51                   	push   %ecx
+  800eeb:	e8 a1 1e 00 00       	call   802d91 <memmove>
+	ff->buf_wlen += n;
+  800ef0:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  800ef3:	01 f7                	add    %esi,%edi
+  800ef5:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  800ef8:	89 f0                	mov    %esi,%eax
+  800efa:	83 c4 10             	add    $0x10,%esp
+}
+  800efd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f00:	5b                   	pop    %ebx
+  800f01:	5e                   	pop    %esi
+  800f02:	5f                   	pop    %edi
+  800f03:	5d                   	pop    %ebp
+  800f04:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  800f05:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800f0b:	76 d1                	jbe    800ede <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  800f0d:	89 f1                	mov    %esi,%ecx
+  800f0f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f12:	89 d8                	mov    %ebx,%eax
+  800f14:	e8 3a fe ff ff       	call   800d53 <file_write_direct>
+  800f19:	eb e2                	jmp    800efd <devfile_write+0xa4>
+
+00800f1b <devfile_trunc>:
+{
+  800f1b:	55                   	push   %ebp
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	53                   	push   %ebx
+  800f1f:	83 ec 10             	sub    $0x10,%esp
+  800f22:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  800f25:	53                   	push   %ebx
+  800f26:	e8 b5 fe ff ff       	call   800de0 <devfile_sync>
+  800f2b:	83 c4 10             	add    $0x10,%esp
+  800f2e:	85 c0                	test   %eax,%eax
+  800f30:	78 1f                	js     800f51 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800f32:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f35:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800f3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f3d:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800f42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f47:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f4c:	e8 eb fd ff ff       	call   800d3c <fsipc>
+}
+  800f51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f54:	c9                   	leave
+  800f55:	c3                   	ret
+
+00800f56 <devfile_stat>:
+{
+  800f56:	55                   	push   %ebp
+  800f57:	89 e5                	mov    %esp,%ebp
+  800f59:	56                   	push   %esi
+  800f5a:	53                   	push   %ebx
+  800f5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800f5e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  800f61:	83 ec 0c             	sub    $0xc,%esp
+  800f64:	53                   	push   %ebx
+  800f65:	e8 76 fe ff ff       	call   800de0 <devfile_sync>
+  800f6a:	83 c4 10             	add    $0x10,%esp
+  800f6d:	85 c0                	test   %eax,%eax
+  800f6f:	78 47                	js     800fb8 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800f71:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f74:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800f79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f83:	e8 b4 fd ff ff       	call   800d3c <fsipc>
+  800f88:	85 c0                	test   %eax,%eax
+  800f8a:	78 2c                	js     800fb8 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f8c:	83 ec 08             	sub    $0x8,%esp
+  800f8f:	68 00 60 80 00       	push   $0x806000
+  800f94:	56                   	push   %esi
+  800f95:	e8 71 1c 00 00       	call   802c0b <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800f9a:	a1 80 60 80 00       	mov    0x806080,%eax
+  800f9f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800fa5:	a1 84 60 80 00       	mov    0x806084,%eax
+  800faa:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  800fb0:	83 c4 10             	add    $0x10,%esp
+  800fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fbb:	5b                   	pop    %ebx
+  800fbc:	5e                   	pop    %esi
+  800fbd:	5d                   	pop    %ebp
+  800fbe:	c3                   	ret
+
+00800fbf <devfile_flush>:
+{
+  800fbf:	55                   	push   %ebp
+  800fc0:	89 e5                	mov    %esp,%ebp
+  800fc2:	56                   	push   %esi
+  800fc3:	53                   	push   %ebx
+  800fc4:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  800fc7:	83 ec 0c             	sub    $0xc,%esp
+  800fca:	56                   	push   %esi
+  800fcb:	e8 10 fe ff ff       	call   800de0 <devfile_sync>
+  800fd0:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  800fd2:	83 c4 10             	add    $0x10,%esp
+  800fd5:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  800fd9:	75 25                	jne    801000 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800fdb:	8b 46 0c             	mov    0xc(%esi),%eax
+  800fde:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  800fe3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe8:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fed:	e8 4a fd ff ff       	call   800d3c <fsipc>
+  800ff2:	85 c0                	test   %eax,%eax
+  800ff4:	0f 45 d8             	cmovne %eax,%ebx
+}
+  800ff7:	89 d8                	mov    %ebx,%eax
+  800ff9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ffc:	5b                   	pop    %ebx
+  800ffd:	5e                   	pop    %esi
+  800ffe:	5d                   	pop    %ebp
+  800fff:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801000:	83 ec 0c             	sub    $0xc,%esp
+  801003:	56                   	push   %esi
+  801004:	e8 8e f5 ff ff       	call   800597 <fd2data>
+  801009:	83 c4 08             	add    $0x8,%esp
+  80100c:	50                   	push   %eax
+  80100d:	6a 00                	push   $0x0
+  80100f:	e8 ff f1 ff ff       	call   800213 <sys_page_unmap>
+  801014:	83 c4 10             	add    $0x10,%esp
+  801017:	eb c2                	jmp    800fdb <devfile_flush+0x1c>
+
+00801019 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801019:	55                   	push   %ebp
+  80101a:	89 e5                	mov    %esp,%ebp
+  80101c:	57                   	push   %edi
+  80101d:	56                   	push   %esi
+  80101e:	53                   	push   %ebx
+  80101f:	83 ec 64             	sub    $0x64,%esp
+  801022:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801024:	52                   	push   %edx
+  801025:	50                   	push   %eax
+  801026:	e8 d9 f5 ff ff       	call   800604 <fd_lookup>
+  80102b:	89 c1                	mov    %eax,%ecx
+  80102d:	83 c4 10             	add    $0x10,%esp
+  801030:	85 c0                	test   %eax,%eax
+  801032:	0f 88 f2 00 00 00    	js     80112a <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801038:	8b 07                	mov    (%edi),%eax
+  80103a:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801040:	39 10                	cmp    %edx,(%eax)
+  801042:	0f 85 03 01 00 00    	jne    80114b <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801048:	a1 00 50 80 00       	mov    0x805000,%eax
+  80104d:	8b 40 48             	mov    0x48(%eax),%eax
+  801050:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801056:	0f 84 96 00 00 00    	je     8010f2 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  80105c:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801063:	0f 84 cb 00 00 00    	je     801134 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801069:	b8 00 60 80 00       	mov    $0x806000,%eax
+  80106e:	83 c8 07             	or     $0x7,%eax
+  801071:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801074:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801077:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  80107c:	83 ec 04             	sub    $0x4,%esp
+  80107f:	68 07 04 00 00       	push   $0x407
+  801084:	53                   	push   %ebx
+  801085:	6a 00                	push   $0x0
+  801087:	e8 fa f0 ff ff       	call   800186 <sys_page_alloc>
+  80108c:	89 c1                	mov    %eax,%ecx
+  80108e:	83 c4 10             	add    $0x10,%esp
+  801091:	85 c0                	test   %eax,%eax
+  801093:	0f 88 91 00 00 00    	js     80112a <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801099:	89 d8                	mov    %ebx,%eax
+  80109b:	83 c8 07             	or     $0x7,%eax
+  80109e:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8010a0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8010a6:	83 c6 04             	add    $0x4,%esi
+  8010a9:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8010af:	75 cb                	jne    80107c <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8010b1:	6a 12                	push   $0x12
+  8010b3:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8010b6:	50                   	push   %eax
+  8010b7:	6a 0c                	push   $0xc
+  8010b9:	ff 35 c8 70 80 00    	push   0x8070c8
+  8010bf:	e8 e2 22 00 00       	call   8033a6 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8010c4:	83 c4 0c             	add    $0xc,%esp
+  8010c7:	6a 00                	push   $0x0
+  8010c9:	6a 00                	push   $0x0
+  8010cb:	6a 00                	push   $0x0
+  8010cd:	e8 7e 21 00 00       	call   803250 <ipc_recv>
+  8010d2:	89 c1                	mov    %eax,%ecx
+  8010d4:	83 c4 10             	add    $0x10,%esp
+  8010d7:	85 c0                	test   %eax,%eax
+  8010d9:	78 4f                	js     80112a <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  8010db:	a1 00 50 80 00       	mov    0x805000,%eax
+  8010e0:	8b 40 48             	mov    0x48(%eax),%eax
+  8010e3:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  8010e8:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  8010ef:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  8010f2:	83 ec 0c             	sub    $0xc,%esp
+  8010f5:	ff 37                	push   (%edi)
+  8010f7:	e8 e4 fc ff ff       	call   800de0 <devfile_sync>
+  8010fc:	89 c1                	mov    %eax,%ecx
+  8010fe:	83 c4 10             	add    $0x10,%esp
+  801101:	85 c0                	test   %eax,%eax
+  801103:	78 25                	js     80112a <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801105:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  80110b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801110:	ba 01 00 00 00       	mov    $0x1,%edx
+  801115:	89 d0                	mov    %edx,%eax
+  801117:	d3 e0                	shl    %cl,%eax
+  801119:	85 d8                	test   %ebx,%eax
+  80111b:	74 0d                	je     80112a <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  80111d:	83 c1 01             	add    $0x1,%ecx
+  801120:	83 f9 10             	cmp    $0x10,%ecx
+  801123:	75 f0                	jne    801115 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801125:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  80112a:	89 c8                	mov    %ecx,%eax
+  80112c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112f:	5b                   	pop    %ebx
+  801130:	5e                   	pop    %esi
+  801131:	5f                   	pop    %edi
+  801132:	5d                   	pop    %ebp
+  801133:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801134:	83 ec 0c             	sub    $0xc,%esp
+  801137:	6a 01                	push   $0x1
+  801139:	e8 b6 22 00 00       	call   8033f4 <ipc_find_env>
+  80113e:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801143:	83 c4 10             	add    $0x10,%esp
+  801146:	e9 1e ff ff ff       	jmp    801069 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  80114b:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801150:	eb d8                	jmp    80112a <fsring_slot+0x111>
+
+00801152 <file_read_direct>:
+{
+  801152:	55                   	push   %ebp
+  801153:	89 e5                	mov    %esp,%ebp
+  801155:	57                   	push   %edi
+  801156:	56                   	push   %esi
+  801157:	53                   	push   %ebx
+  801158:	83 ec 1c             	sub    $0x1c,%esp
+  80115b:	89 c7                	mov    %eax,%edi
+  80115d:	89 d6                	mov    %edx,%esi
+  80115f:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801161:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801167:	77 52                	ja     8011bb <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801169:	8b 40 0c             	mov    0xc(%eax),%eax
+  80116c:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801171:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801177:	ba 00 00 00 00       	mov    $0x0,%edx
+  80117c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801181:	e8 b6 fb ff ff       	call   800d3c <fsipc>
+  801186:	89 c7                	mov    %eax,%edi
+  801188:	85 c0                	test   %eax,%eax
+  80118a:	78 25                	js     8011b1 <file_read_direct+0x5f>
+	assert(r <= n);
+  80118c:	39 c3                	cmp    %eax,%ebx
+  80118e:	0f 82 87 00 00 00    	jb     80121b <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801194:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801199:	0f 8f 95 00 00 00    	jg     801234 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80119f:	83 ec 04             	sub    $0x4,%esp
+  8011a2:	50                   	push   %eax
+  8011a3:	68 00 60 80 00       	push   $0x806000
+  8011a8:	56                   	push   %esi
+  8011a9:	e8 e3 1b 00 00       	call   802d91 <memmove>
+	return r;
+  8011ae:	83 c4 10             	add    $0x10,%esp
+}
+  8011b1:	89 f8                	mov    %edi,%eax
+  8011b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b6:	5b                   	pop    %ebx
+  8011b7:	5e                   	pop    %esi
+  8011b8:	5f                   	pop    %edi
+  8011b9:	5d                   	pop    %ebp
+  8011ba:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8011bb:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8011c1:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8011c6:	29 d1                	sub    %edx,%ecx
+  8011c8:	39 d9                	cmp    %ebx,%ecx
+  8011ca:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011cd:	89 f0                	mov    %esi,%eax
+  8011cf:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8011d2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8011d5:	eb 0f                	jmp    8011e6 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8011d7:	0f b6 10             	movzbl (%eax),%edx
+  8011da:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011dc:	05 00 10 00 00       	add    $0x1000,%eax
+  8011e1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011e6:	39 c8                	cmp    %ecx,%eax
+  8011e8:	72 ed                	jb     8011d7 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  8011ea:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8011ed:	8b 47 0c             	mov    0xc(%edi),%eax
+  8011f0:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  8011f5:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8011fb:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801201:	83 ec 0c             	sub    $0xc,%esp
+  801204:	6a 07                	push   $0x7
+  801206:	89 d9                	mov    %ebx,%ecx
+  801208:	89 f2                	mov    %esi,%edx
+  80120a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80120f:	e8 86 f9 ff ff       	call   800b9a <fsipc_pages>
+  801214:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801216:	83 c4 10             	add    $0x10,%esp
+  801219:	eb 96                	jmp    8011b1 <file_read_direct+0x5f>
+	assert(r <= n);
+  80121b:	68 64 38 80 00       	push   $0x803864
+  801220:	68 44 38 80 00       	push   $0x803844
+  801225:	68 dc 00 00 00       	push   $0xdc
+  80122a:	68 59 38 80 00       	push   $0x803859
+  80122f:	e8 0e 13 00 00       	call   802542 <_panic>
+	assert(r <= PGSIZE);
+  801234:	68 75 38 80 00       	push   $0x803875
+  801239:	68 44 38 80 00       	push   $0x803844
+  80123e:	68 dd 00 00 00       	push   $0xdd
+  801243:	68 59 38 80 00       	push   $0x803859
+  801248:	e8 f5 12 00 00       	call   802542 <_panic>
+
+0080124d <devfile_read>:
+{
+  80124d:	55                   	push   %ebp
+  80124e:	89 e5                	mov    %esp,%ebp
+  801250:	57                   	push   %edi
+  801251:	56                   	push   %esi
+  801252:	53                   	push   %ebx
+  801253:	83 ec 28             	sub    $0x28,%esp
+  801256:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801259:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80125c:	53                   	push   %ebx
+  80125d:	e8 35 f3 ff ff       	call   800597 <fd2data>
+  801262:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801265:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801268:	83 c4 10             	add    $0x10,%esp
+  80126b:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  80126f:	74 7d                	je     8012ee <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801271:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801275:	0f 85 81 00 00 00    	jne    8012fc <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  80127b:	8b 43 18             	mov    0x18(%ebx),%eax
+  80127e:	85 c0                	test   %eax,%eax
+  801280:	74 0d                	je     80128f <devfile_read+0x42>
+  801282:	8b 53 14             	mov    0x14(%ebx),%edx
+  801285:	39 fa                	cmp    %edi,%edx
+  801287:	7f 06                	jg     80128f <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801289:	01 c2                	add    %eax,%edx
+  80128b:	39 d7                	cmp    %edx,%edi
+  80128d:	72 28                	jb     8012b7 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  80128f:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801296:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80129c:	77 74                	ja     801312 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  80129e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012a3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8012a6:	89 d8                	mov    %ebx,%eax
+  8012a8:	e8 a5 fe ff ff       	call   801152 <file_read_direct>
+  8012ad:	85 c0                	test   %eax,%eax
+  8012af:	7e 35                	jle    8012e6 <devfile_read+0x99>
+		ff->buf_base = pos;
+  8012b1:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8012b4:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8012b7:	8b 53 14             	mov    0x14(%ebx),%edx
+  8012ba:	89 d0                	mov    %edx,%eax
+  8012bc:	03 43 18             	add    0x18(%ebx),%eax
+  8012bf:	29 f8                	sub    %edi,%eax
+  8012c1:	39 f0                	cmp    %esi,%eax
+  8012c3:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8012c6:	83 ec 04             	sub    $0x4,%esp
+  8012c9:	56                   	push   %esi
+  8012ca:	89 f8                	mov    %edi,%eax
+  8012cc:	29 d0                	sub    %edx,%eax
+  8012ce:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8012d1:	01 c1                	add    %eax,%ecx
+  8012d3:	51                   	push   %ecx
+  8012d4:	ff 75 0c             	push   0xc(%ebp)
+  8012d7:	e8 b5 1a 00 00       	call   802d91 <memmove>
+	fd->fd_offset = pos + n;
+  8012dc:	01 f7                	add    %esi,%edi
+  8012de:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8012e1:	89 f0                	mov    %esi,%eax
+  8012e3:	83 c4 10             	add    $0x10,%esp
+}
+  8012e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e9:	5b                   	pop    %ebx
+  8012ea:	5e                   	pop    %esi
+  8012eb:	5f                   	pop    %edi
+  8012ec:	5d                   	pop    %ebp
+  8012ed:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  8012ee:	89 f1                	mov    %esi,%ecx
+  8012f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012f3:	89 d8                	mov    %ebx,%eax
+  8012f5:	e8 58 fe ff ff       	call   801152 <file_read_direct>
+  8012fa:	eb ea                	jmp    8012e6 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8012fc:	83 ec 0c             	sub    $0xc,%esp
+  8012ff:	53                   	push   %ebx
+  801300:	e8 db fa ff ff       	call   800de0 <devfile_sync>
+  801305:	83 c4 10             	add    $0x10,%esp
+  801308:	85 c0                	test   %eax,%eax
+  80130a:	0f 89 6b ff ff ff    	jns    80127b <devfile_read+0x2e>
+  801310:	eb d4                	jmp    8012e6 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801312:	89 f1                	mov    %esi,%ecx
+  801314:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801317:	89 d8                	mov    %ebx,%eax
+  801319:	e8 34 fe ff ff       	call   801152 <file_read_direct>
+  80131e:	eb c6                	jmp    8012e6 <devfile_read+0x99>
+
+00801320 <open>:
+{
+  801320:	55                   	push   %ebp
+  801321:	89 e5                	mov    %esp,%ebp
+  801323:	56                   	push   %esi
+  801324:	53                   	push   %ebx
+  801325:	83 ec 1c             	sub    $0x1c,%esp
+  801328:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80132b:	56                   	push   %esi
+  80132c:	e8 9f 18 00 00       	call   802bd0 <strlen>
+  801331:	83 c4 10             	add    $0x10,%esp
+  801334:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801339:	0f 8f a0 00 00 00    	jg     8013df <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  80133f:	83 ec 0c             	sub    $0xc,%esp
+  801342:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801345:	50                   	push   %eax
+  801346:	e8 63 f2 ff ff       	call   8005ae <fd_alloc>
+  80134b:	89 c3                	mov    %eax,%ebx
+  80134d:	83 c4 10             	add    $0x10,%esp
+  801350:	85 c0                	test   %eax,%eax
+  801352:	78 45                	js     801399 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801354:	83 ec 08             	sub    $0x8,%esp
+  801357:	56                   	push   %esi
+  801358:	68 00 60 80 00       	push   $0x806000
+  80135d:	e8 a9 18 00 00       	call   802c0b <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801362:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801365:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80136a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80136d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801372:	e8 c5 f9 ff ff       	call   800d3c <fsipc>
+  801377:	89 c3                	mov    %eax,%ebx
+  801379:	83 c4 10             	add    $0x10,%esp
+  80137c:	85 c0                	test   %eax,%eax
+  80137e:	78 22                	js     8013a2 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801380:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801387:	74 2b                	je     8013b4 <open+0x94>
+	return fd2num(fd);
+  801389:	83 ec 0c             	sub    $0xc,%esp
+  80138c:	ff 75 f4             	push   -0xc(%ebp)
+  80138f:	e8 f3 f1 ff ff       	call   800587 <fd2num>
+  801394:	89 c3                	mov    %eax,%ebx
+  801396:	83 c4 10             	add    $0x10,%esp
+}
+  801399:	89 d8                	mov    %ebx,%eax
+  80139b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80139e:	5b                   	pop    %ebx
+  80139f:	5e                   	pop    %esi
+  8013a0:	5d                   	pop    %ebp
+  8013a1:	c3                   	ret
+		fd_close(fd, 0);
+  8013a2:	83 ec 08             	sub    $0x8,%esp
+  8013a5:	6a 00                	push   $0x0
+  8013a7:	ff 75 f4             	push   -0xc(%ebp)
+  8013aa:	e8 f8 f2 ff ff       	call   8006a7 <fd_close>
+		return r;
+  8013af:	83 c4 10             	add    $0x10,%esp
+  8013b2:	eb e5                	jmp    801399 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8013b4:	83 ec 0c             	sub    $0xc,%esp
+  8013b7:	ff 75 f4             	push   -0xc(%ebp)
+  8013ba:	e8 d8 f1 ff ff       	call   800597 <fd2data>
+  8013bf:	83 c4 0c             	add    $0xc,%esp
+  8013c2:	68 07 04 00 00       	push   $0x407
+  8013c7:	50                   	push   %eax
+  8013c8:	6a 00                	push   $0x0
+  8013ca:	e8 b7 ed ff ff       	call   800186 <sys_page_alloc>
+  8013cf:	83 c4 10             	add    $0x10,%esp
+  8013d2:	85 c0                	test   %eax,%eax
+  8013d4:	75 b3                	jne    801389 <open+0x69>
+		fd->fd_file.buffered = 1;
+  8013d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013d9:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8013dd:	eb aa                	jmp    801389 <open+0x69>
+		return -E_BAD_PATH;
+  8013df:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8013e4:	eb b3                	jmp    801399 <open+0x79>
+
+008013e6 <readdir>:
+{
+  8013e6:	55                   	push   %ebp
+  8013e7:	89 e5                	mov    %esp,%ebp
+  8013e9:	53                   	push   %ebx
+  8013ea:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013f0:	50                   	push   %eax
+  8013f1:	ff 75 08             	push   0x8(%ebp)
+  8013f4:	e8 0b f2 ff ff       	call   800604 <fd_lookup>
+  8013f9:	89 c3                	mov    %eax,%ebx
+  8013fb:	83 c4 10             	add    $0x10,%esp
+  8013fe:	85 c0                	test   %eax,%eax
+  801400:	78 73                	js     801475 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801402:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801405:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80140b:	39 08                	cmp    %ecx,(%eax)
+  80140d:	0f 85 82 00 00 00    	jne    801495 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801413:	83 ec 0c             	sub    $0xc,%esp
+  801416:	50                   	push   %eax
+  801417:	e8 c4 f9 ff ff       	call   800de0 <devfile_sync>
+  80141c:	89 c3                	mov    %eax,%ebx
+  80141e:	83 c4 10             	add    $0x10,%esp
+  801421:	85 c0                	test   %eax,%eax
+  801423:	78 50                	js     801475 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801425:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801428:	8b 40 0c             	mov    0xc(%eax),%eax
+  80142b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801430:	8b 45 10             	mov    0x10(%ebp),%eax
+  801433:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801438:	8b 45 14             	mov    0x14(%ebp),%eax
+  80143b:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801440:	ba 00 00 00 00       	mov    $0x0,%edx
+  801445:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80144a:	e8 ed f8 ff ff       	call   800d3c <fsipc>
+  80144f:	89 c3                	mov    %eax,%ebx
+  801451:	85 c0                	test   %eax,%eax
+  801453:	7e 20                	jle    801475 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801455:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801458:	72 22                	jb     80147c <readdir+0x96>
+  80145a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80145f:	7f 1b                	jg     80147c <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801461:	83 ec 04             	sub    $0x4,%esp
+  801464:	50                   	push   %eax
+  801465:	68 00 60 80 00       	push   $0x806000
+  80146a:	ff 75 0c             	push   0xc(%ebp)
+  80146d:	e8 1f 19 00 00       	call   802d91 <memmove>
+	return r;
+  801472:	83 c4 10             	add    $0x10,%esp
+}
+  801475:	89 d8                	mov    %ebx,%eax
+  801477:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80147a:	c9                   	leave
+  80147b:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  80147c:	68 6b 38 80 00       	push   $0x80386b
+  801481:	68 44 38 80 00       	push   $0x803844
+  801486:	68 86 01 00 00       	push   $0x186
+  80148b:	68 59 38 80 00       	push   $0x803859
+  801490:	e8 ad 10 00 00       	call   802542 <_panic>
+		return -E_NOT_SUPP;
+  801495:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80149a:	eb d9                	jmp    801475 <readdir+0x8f>
+
+0080149c <munmap>:
+{
+  80149c:	55                   	push   %ebp
+  80149d:	89 e5                	mov    %esp,%ebp
+  80149f:	56                   	push   %esi
+  8014a0:	53                   	push   %ebx
+  8014a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8014a7:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8014ad:	75 41                	jne    8014f0 <munmap+0x54>
+  8014af:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8014b5:	77 39                	ja     8014f0 <munmap+0x54>
+  8014b7:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8014bc:	29 f0                	sub    %esi,%eax
+  8014be:	39 d0                	cmp    %edx,%eax
+  8014c0:	72 35                	jb     8014f7 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014c2:	89 f3                	mov    %esi,%ebx
+  8014c4:	01 d6                	add    %edx,%esi
+  8014c6:	39 f3                	cmp    %esi,%ebx
+  8014c8:	73 1a                	jae    8014e4 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8014ca:	83 ec 08             	sub    $0x8,%esp
+  8014cd:	53                   	push   %ebx
+  8014ce:	6a 00                	push   $0x0
+  8014d0:	e8 3e ed ff ff       	call   800213 <sys_page_unmap>
+  8014d5:	83 c4 10             	add    $0x10,%esp
+  8014d8:	85 c0                	test   %eax,%eax
+  8014da:	78 0d                	js     8014e9 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014dc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8014e2:	eb e2                	jmp    8014c6 <munmap+0x2a>
+	return 0;
+  8014e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014ec:	5b                   	pop    %ebx
+  8014ed:	5e                   	pop    %esi
+  8014ee:	5d                   	pop    %ebp
+  8014ef:	c3                   	ret
+		return -E_INVAL;
+  8014f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014f5:	eb f2                	jmp    8014e9 <munmap+0x4d>
+  8014f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014fc:	eb eb                	jmp    8014e9 <munmap+0x4d>
+
+008014fe <mmap>:
+{
+  8014fe:	55                   	push   %ebp
+  8014ff:	89 e5                	mov    %esp,%ebp
+  801501:	57                   	push   %edi
+  801502:	56                   	push   %esi
+  801503:	53                   	push   %ebx
+  801504:	83 ec 34             	sub    $0x34,%esp
+  801507:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80150a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80150d:	50                   	push   %eax
+  80150e:	ff 75 18             	push   0x18(%ebp)
+  801511:	e8 ee f0 ff ff       	call   800604 <fd_lookup>
+  801516:	89 c3                	mov    %eax,%ebx
+  801518:	83 c4 10             	add    $0x10,%esp
+  80151b:	85 c0                	test   %eax,%eax
+  80151d:	0f 88 0e 01 00 00    	js     801631 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801523:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801526:	a1 20 40 80 00       	mov    0x804020,%eax
+  80152b:	39 02                	cmp    %eax,(%edx)
+  80152d:	0f 85 50 01 00 00    	jne    801683 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801533:	8b 45 10             	mov    0x10(%ebp),%eax
+  801536:	83 e0 02             	and    $0x2,%eax
+  801539:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80153c:	74 0a                	je     801548 <mmap+0x4a>
+  80153e:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801542:	0f 84 42 01 00 00    	je     80168a <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801548:	8b 42 08             	mov    0x8(%edx),%eax
+  80154b:	83 e0 03             	and    $0x3,%eax
+  80154e:	83 f8 01             	cmp    $0x1,%eax
+  801551:	0f 84 3a 01 00 00    	je     801691 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  801557:	8b 45 08             	mov    0x8(%ebp),%eax
+  80155a:	0b 45 1c             	or     0x1c(%ebp),%eax
+  80155d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801562:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801565:	0f 85 2d 01 00 00    	jne    801698 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80156b:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80156f:	0f 88 2a 01 00 00    	js     80169f <mmap+0x1a1>
+  801575:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80157c:	0f 87 1d 01 00 00    	ja     80169f <mmap+0x1a1>
+  801582:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801587:	2b 45 08             	sub    0x8(%ebp),%eax
+  80158a:	39 f8                	cmp    %edi,%eax
+  80158c:	0f 82 14 01 00 00    	jb     8016a6 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  801592:	83 ec 0c             	sub    $0xc,%esp
+  801595:	52                   	push   %edx
+  801596:	e8 45 f8 ff ff       	call   800de0 <devfile_sync>
+  80159b:	89 c3                	mov    %eax,%ebx
+  80159d:	83 c4 10             	add    $0x10,%esp
+  8015a0:	85 c0                	test   %eax,%eax
+  8015a2:	0f 88 89 00 00 00    	js     801631 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8015a8:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8015ae:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8015b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b9:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8015bc:	39 fe                	cmp    %edi,%esi
+  8015be:	73 7b                	jae    80163b <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8015c0:	89 f8                	mov    %edi,%eax
+  8015c2:	29 f0                	sub    %esi,%eax
+  8015c4:	c1 e8 0c             	shr    $0xc,%eax
+  8015c7:	ba 40 00 00 00       	mov    $0x40,%edx
+  8015cc:	39 d0                	cmp    %edx,%eax
+  8015ce:	0f 47 c2             	cmova  %edx,%eax
+  8015d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8015d4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015d7:	8b 52 0c             	mov    0xc(%edx),%edx
+  8015da:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  8015e0:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8015e3:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  8015e9:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8015ee:	89 f2                	mov    %esi,%edx
+  8015f0:	03 55 08             	add    0x8(%ebp),%edx
+  8015f3:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8015f6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015fb:	e8 ea f6 ff ff       	call   800cea <fsipcv>
+  801600:	85 c0                	test   %eax,%eax
+  801602:	7e 12                	jle    801616 <mmap+0x118>
+  801604:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801607:	85 c0                	test   %eax,%eax
+  801609:	0f 84 9e 00 00 00    	je     8016ad <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80160f:	c1 e0 0c             	shl    $0xc,%eax
+  801612:	01 c6                	add    %eax,%esi
+  801614:	eb a6                	jmp    8015bc <mmap+0xbe>
+			munmap(addr, done);
+  801616:	89 c3                	mov    %eax,%ebx
+  801618:	83 ec 08             	sub    $0x8,%esp
+  80161b:	56                   	push   %esi
+  80161c:	ff 75 08             	push   0x8(%ebp)
+  80161f:	e8 78 fe ff ff       	call   80149c <munmap>
+			return r < 0 ? r : -E_INVAL;
+  801624:	83 c4 10             	add    $0x10,%esp
+  801627:	85 db                	test   %ebx,%ebx
+  801629:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80162e:	0f 49 d8             	cmovns %eax,%ebx
+}
+  801631:	89 d8                	mov    %ebx,%eax
+  801633:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801636:	5b                   	pop    %ebx
+  801637:	5e                   	pop    %esi
+  801638:	5f                   	pop    %edi
+  801639:	5d                   	pop    %ebp
+  80163a:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80163b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80163e:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  801640:	85 c0                	test   %eax,%eax
+  801642:	74 ed                	je     801631 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  801644:	be 00 00 00 00       	mov    $0x0,%esi
+  801649:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80164c:	39 fe                	cmp    %edi,%esi
+  80164e:	73 2e                	jae    80167e <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  801650:	83 ec 0c             	sub    $0xc,%esp
+  801653:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  801656:	50                   	push   %eax
+  801657:	e8 f6 19 00 00       	call   803052 <cowpage>
+  80165c:	83 c4 10             	add    $0x10,%esp
+  80165f:	85 c0                	test   %eax,%eax
+  801661:	78 08                	js     80166b <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  801663:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801669:	eb e1                	jmp    80164c <mmap+0x14e>
+				munmap(addr, len);
+  80166b:	89 c3                	mov    %eax,%ebx
+  80166d:	83 ec 08             	sub    $0x8,%esp
+  801670:	57                   	push   %edi
+  801671:	ff 75 08             	push   0x8(%ebp)
+  801674:	e8 23 fe ff ff       	call   80149c <munmap>
+				return r;
+  801679:	83 c4 10             	add    $0x10,%esp
+  80167c:	eb b3                	jmp    801631 <mmap+0x133>
+	return 0;
+  80167e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801681:	eb ae                	jmp    801631 <mmap+0x133>
+		return -E_NOT_SUPP;
+  801683:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801688:	eb a7                	jmp    801631 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80168a:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80168f:	eb a0                	jmp    801631 <mmap+0x133>
+		return -E_INVAL;
+  801691:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801696:	eb 99                	jmp    801631 <mmap+0x133>
+  801698:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80169d:	eb 92                	jmp    801631 <mmap+0x133>
+  80169f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016a4:	eb 8b                	jmp    801631 <mmap+0x133>
+  8016a6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016ab:	eb 84                	jmp    801631 <mmap+0x133>
+			munmap(addr, done);
+  8016ad:	83 ec 08             	sub    $0x8,%esp
+  8016b0:	56                   	push   %esi
+  8016b1:	ff 75 08             	push   0x8(%ebp)
+  8016b4:	e8 e3 fd ff ff       	call   80149c <munmap>
+  8016b9:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8016bc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016c1:	e9 6b ff ff ff       	jmp    801631 <mmap+0x133>
+
+008016c6 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8016c6:	55                   	push   %ebp
+  8016c7:	89 e5                	mov    %esp,%ebp
+  8016c9:	56                   	push   %esi
+  8016ca:	53                   	push   %ebx
+  8016cb:	83 ec 10             	sub    $0x10,%esp
+  8016ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8016d1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016d7:	e8 3d f9 ff ff       	call   801019 <fsring_slot>
+  8016dc:	85 c0                	test   %eax,%eax
+  8016de:	78 60                	js     801740 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8016e0:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8016e3:	8b 56 08             	mov    0x8(%esi),%edx
+  8016e6:	83 e2 03             	and    $0x3,%edx
+  8016e9:	83 fa 01             	cmp    $0x1,%edx
+  8016ec:	74 59                	je     801747 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8016ee:	ba 01 00 00 00       	mov    $0x1,%edx
+  8016f3:	89 c1                	mov    %eax,%ecx
+  8016f5:	d3 e2                	shl    %cl,%edx
+  8016f7:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8016fd:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  801700:	c1 e2 02             	shl    $0x2,%edx
+  801703:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  801709:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  801710:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  801713:	8b 55 18             	mov    0x18(%ebp),%edx
+  801716:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  801719:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80171c:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80171f:	83 ec 08             	sub    $0x8,%esp
+  801722:	50                   	push   %eax
+  801723:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801728:	39 c3                	cmp    %eax,%ebx
+  80172a:	0f 47 d8             	cmova  %eax,%ebx
+  80172d:	53                   	push   %ebx
+  80172e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801731:	89 f2                	mov    %esi,%edx
+  801733:	b8 03 00 00 00       	mov    $0x3,%eax
+  801738:	e8 1e f5 ff ff       	call   800c5b <fsring_post>
+  80173d:	83 c4 10             	add    $0x10,%esp
+}
+  801740:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801743:	5b                   	pop    %ebx
+  801744:	5e                   	pop    %esi
+  801745:	5d                   	pop    %ebp
+  801746:	c3                   	ret
+		return -E_INVAL;
+  801747:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80174c:	eb f2                	jmp    801740 <fsring_read+0x7a>
+
+0080174e <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80174e:	55                   	push   %ebp
+  80174f:	89 e5                	mov    %esp,%ebp
+  801751:	56                   	push   %esi
+  801752:	53                   	push   %ebx
+  801753:	83 ec 10             	sub    $0x10,%esp
+  801756:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  801759:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80175c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80175f:	e8 b5 f8 ff ff       	call   801019 <fsring_slot>
+  801764:	89 c3                	mov    %eax,%ebx
+  801766:	85 c0                	test   %eax,%eax
+  801768:	78 77                	js     8017e1 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80176a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80176d:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801771:	74 77                	je     8017ea <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  801773:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801778:	39 c6                	cmp    %eax,%esi
+  80177a:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80177d:	83 ec 04             	sub    $0x4,%esp
+  801780:	56                   	push   %esi
+  801781:	ff 75 0c             	push   0xc(%ebp)
+  801784:	89 d8                	mov    %ebx,%eax
+  801786:	c1 e0 0c             	shl    $0xc,%eax
+  801789:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80178f:	50                   	push   %eax
+  801790:	e8 fc 15 00 00       	call   802d91 <memmove>
+	fsring_busy |= 1 << slot;
+  801795:	b8 01 00 00 00       	mov    $0x1,%eax
+  80179a:	89 d9                	mov    %ebx,%ecx
+  80179c:	d3 e0                	shl    %cl,%eax
+  80179e:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8017a4:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8017a7:	c1 e0 02             	shl    $0x2,%eax
+  8017aa:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8017b0:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8017b7:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8017ba:	8b 45 18             	mov    0x18(%ebp),%eax
+  8017bd:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8017c0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8017c7:	83 c4 08             	add    $0x8,%esp
+  8017ca:	53                   	push   %ebx
+  8017cb:	56                   	push   %esi
+  8017cc:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8017cf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8017d2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017d7:	e8 7f f4 ff ff       	call   800c5b <fsring_post>
+  8017dc:	89 c3                	mov    %eax,%ebx
+  8017de:	83 c4 10             	add    $0x10,%esp
+}
+  8017e1:	89 d8                	mov    %ebx,%eax
+  8017e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e6:	5b                   	pop    %ebx
+  8017e7:	5e                   	pop    %esi
+  8017e8:	5d                   	pop    %ebp
+  8017e9:	c3                   	ret
+		return -E_INVAL;
+  8017ea:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8017ef:	eb f0                	jmp    8017e1 <fsring_write+0x93>
+
+008017f1 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8017f1:	55                   	push   %ebp
+  8017f2:	89 e5                	mov    %esp,%ebp
+  8017f4:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8017f7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8017fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017fd:	e8 17 f8 ff ff       	call   801019 <fsring_slot>
+  801802:	85 c0                	test   %eax,%eax
+  801804:	78 4c                	js     801852 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  801806:	ba 01 00 00 00       	mov    $0x1,%edx
+  80180b:	89 c1                	mov    %eax,%ecx
+  80180d:	d3 e2                	shl    %cl,%edx
+  80180f:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  801815:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  801818:	c1 e2 02             	shl    $0x2,%edx
+  80181b:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  801821:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  801828:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80182b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80182e:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  801831:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801834:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  801837:	83 ec 08             	sub    $0x8,%esp
+  80183a:	50                   	push   %eax
+  80183b:	6a 00                	push   $0x0
+  80183d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801842:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801845:	b8 05 00 00 00       	mov    $0x5,%eax
+  80184a:	e8 0c f4 ff ff       	call   800c5b <fsring_post>
+  80184f:	83 c4 10             	add    $0x10,%esp
+}
+  801852:	c9                   	leave
+  801853:	c3                   	ret
+
+00801854 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  801854:	55                   	push   %ebp
+  801855:	89 e5                	mov    %esp,%ebp
+  801857:	57                   	push   %edi
+  801858:	56                   	push   %esi
+  801859:	53                   	push   %ebx
+  80185a:	83 ec 1c             	sub    $0x1c,%esp
+  80185d:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  801861:	a1 00 50 80 00       	mov    0x805000,%eax
+  801866:	8b 40 48             	mov    0x48(%eax),%eax
+  801869:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  80186f:	74 12                	je     801883 <fsring_reap+0x2f>
+		return 0;
+  801871:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  801876:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801879:	5b                   	pop    %ebx
+  80187a:	5e                   	pop    %esi
+  80187b:	5f                   	pop    %edi
+  80187c:	5d                   	pop    %ebp
+  80187d:	c3                   	ret
+		sys_yield();
+  80187e:	e8 e4 e8 ff ff       	call   800167 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  801883:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  801889:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80188e:	39 c2                	cmp    %eax,%edx
+  801890:	75 18                	jne    8018aa <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  801892:	84 db                	test   %bl,%bl
+  801894:	0f 84 21 01 00 00    	je     8019bb <fsring_reap+0x167>
+  80189a:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  8018a1:	75 db                	jne    80187e <fsring_reap+0x2a>
+			return 0;
+  8018a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a8:	eb cc                	jmp    801876 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8018aa:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018af:	83 e0 0f             	and    $0xf,%eax
+  8018b2:	83 c0 2a             	add    $0x2a,%eax
+  8018b5:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8018bc:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8018c3:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018c8:	83 c0 01             	add    $0x1,%eax
+  8018cb:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8018d0:	83 fb 0f             	cmp    $0xf,%ebx
+  8018d3:	77 5b                	ja     801930 <fsring_reap+0xdc>
+  8018d5:	be 01 00 00 00       	mov    $0x1,%esi
+  8018da:	89 d9                	mov    %ebx,%ecx
+  8018dc:	d3 e6                	shl    %cl,%esi
+  8018de:	89 f0                	mov    %esi,%eax
+  8018e0:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8018e6:	74 48                	je     801930 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8018e8:	89 d8                	mov    %ebx,%eax
+  8018ea:	c1 e0 0c             	shl    $0xc,%eax
+  8018ed:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8018f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8018f6:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8018f9:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  801900:	83 f8 03             	cmp    $0x3,%eax
+  801903:	74 40                	je     801945 <fsring_reap+0xf1>
+  801905:	83 f8 05             	cmp    $0x5,%eax
+  801908:	74 64                	je     80196e <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  80190a:	f7 d6                	not    %esi
+  80190c:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  801912:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801915:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  80191c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80191f:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  801921:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801924:	89 38                	mov    %edi,(%eax)
+	return 1;
+  801926:	b8 01 00 00 00       	mov    $0x1,%eax
+  80192b:	e9 46 ff ff ff       	jmp    801876 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  801930:	53                   	push   %ebx
+  801931:	68 81 38 80 00       	push   $0x803881
+  801936:	68 8f 02 00 00       	push   $0x28f
+  80193b:	68 59 38 80 00       	push   $0x803859
+  801940:	e8 fd 0b 00 00       	call   802542 <_panic>
+		if (cqe.cqe_result > 0)
+  801945:	85 ff                	test   %edi,%edi
+  801947:	7e c1                	jle    80190a <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801949:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80194c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801951:	39 c7                	cmp    %eax,%edi
+  801953:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801956:	50                   	push   %eax
+  801957:	ff 75 e4             	push   -0x1c(%ebp)
+  80195a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80195d:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  801964:	e8 28 14 00 00       	call   802d91 <memmove>
+  801969:	83 c4 10             	add    $0x10,%esp
+  80196c:	eb 9c                	jmp    80190a <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80196e:	85 ff                	test   %edi,%edi
+  801970:	75 98                	jne    80190a <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  801972:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801975:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80197c:	83 ec 08             	sub    $0x8,%esp
+  80197f:	ff 75 e4             	push   -0x1c(%ebp)
+  801982:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801985:	51                   	push   %ecx
+  801986:	e8 80 12 00 00       	call   802c0b <strcpy>
+			st->st_size = ret->ret_size;
+  80198b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80198e:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  801994:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801997:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80199d:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8019a3:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8019a9:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8019b0:	40 80 00 
+  8019b3:	83 c4 10             	add    $0x10,%esp
+  8019b6:	e9 4f ff ff ff       	jmp    80190a <fsring_reap+0xb6>
+			return 0;
+  8019bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c0:	e9 b1 fe ff ff       	jmp    801876 <fsring_reap+0x22>
+
+008019c5 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8019c5:	55                   	push   %ebp
+  8019c6:	89 e5                	mov    %esp,%ebp
+  8019c8:	57                   	push   %edi
+  8019c9:	56                   	push   %esi
+  8019ca:	53                   	push   %ebx
+  8019cb:	83 ec 28             	sub    $0x28,%esp
+  8019ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019d1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8019d4:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8019d7:	53                   	push   %ebx
+  8019d8:	e8 f3 11 00 00       	call   802bd0 <strlen>
+  8019dd:	83 c4 10             	add    $0x10,%esp
+  8019e0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019e5:	0f 8f 02 01 00 00    	jg     801aed <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8019eb:	83 ec 08             	sub    $0x8,%esp
+  8019ee:	53                   	push   %ebx
+  8019ef:	68 00 60 80 00       	push   $0x806000
+  8019f4:	e8 12 12 00 00       	call   802c0b <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8019f9:	83 c4 10             	add    $0x10,%esp
+  8019fc:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  801a02:	76 69                	jbe    801a6d <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801a04:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a07:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801a0d:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801a12:	29 d1                	sub    %edx,%ecx
+  801a14:	39 f9                	cmp    %edi,%ecx
+  801a16:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a1c:	89 f9                	mov    %edi,%ecx
+  801a1e:	01 c1                	add    %eax,%ecx
+  801a20:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a23:	eb 0f                	jmp    801a34 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  801a25:	0f b6 10             	movzbl (%eax),%edx
+  801a28:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a2a:	05 00 10 00 00       	add    $0x1000,%eax
+  801a2f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a34:	39 c8                	cmp    %ecx,%eax
+  801a36:	72 ed                	jb     801a25 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  801a38:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a3b:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  801a41:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  801a47:	83 ec 0c             	sub    $0xc,%esp
+  801a4a:	6a 07                	push   $0x7
+  801a4c:	89 f9                	mov    %edi,%ecx
+  801a4e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a51:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a56:	e8 3f f1 ff ff       	call   800b9a <fsipc_pages>
+  801a5b:	89 c7                	mov    %eax,%edi
+  801a5d:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  801a60:	85 f6                	test   %esi,%esi
+  801a62:	74 7f                	je     801ae3 <file_slurp+0x11e>
+  801a64:	8d 43 01             	lea    0x1(%ebx),%eax
+  801a67:	85 ff                	test   %edi,%edi
+  801a69:	79 3c                	jns    801aa7 <file_slurp+0xe2>
+  801a6b:	eb 76                	jmp    801ae3 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  801a6d:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  801a73:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a78:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a7d:	e8 ba f2 ff ff       	call   800d3c <fsipc>
+  801a82:	89 c7                	mov    %eax,%edi
+  801a84:	85 c0                	test   %eax,%eax
+  801a86:	7e d8                	jle    801a60 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  801a88:	83 ec 04             	sub    $0x4,%esp
+  801a8b:	50                   	push   %eax
+  801a8c:	68 08 60 80 00       	push   $0x806008
+  801a91:	ff 75 0c             	push   0xc(%ebp)
+  801a94:	e8 f8 12 00 00       	call   802d91 <memmove>
+  801a99:	83 c4 10             	add    $0x10,%esp
+  801a9c:	eb c2                	jmp    801a60 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  801a9e:	80 fa 2f             	cmp    $0x2f,%dl
+  801aa1:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  801aa4:	83 c0 01             	add    $0x1,%eax
+  801aa7:	89 c1                	mov    %eax,%ecx
+  801aa9:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  801aad:	84 d2                	test   %dl,%dl
+  801aaf:	75 ed                	jne    801a9e <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  801ab1:	83 ec 04             	sub    $0x4,%esp
+  801ab4:	68 80 00 00 00       	push   $0x80
+  801ab9:	53                   	push   %ebx
+  801aba:	56                   	push   %esi
+  801abb:	e8 c1 11 00 00       	call   802c81 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  801ac0:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ac5:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  801acb:	a1 04 60 80 00       	mov    0x806004,%eax
+  801ad0:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  801ad6:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  801add:	40 80 00 
+  801ae0:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801ae3:	89 f8                	mov    %edi,%eax
+  801ae5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ae8:	5b                   	pop    %ebx
+  801ae9:	5e                   	pop    %esi
+  801aea:	5f                   	pop    %edi
+  801aeb:	5d                   	pop    %ebp
+  801aec:	c3                   	ret
+		return -E_BAD_PATH;
+  801aed:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  801af2:	eb ef                	jmp    801ae3 <file_slurp+0x11e>
+
+00801af4 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801af4:	55                   	push   %ebp
+  801af5:	89 e5                	mov    %esp,%ebp
+  801af7:	53                   	push   %ebx
+  801af8:	83 ec 10             	sub    $0x10,%esp
+  801afb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801afe:	53                   	push   %ebx
+  801aff:	e8 cc 10 00 00       	call   802bd0 <strlen>
+  801b04:	83 c4 10             	add    $0x10,%esp
+  801b07:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b0c:	7f 25                	jg     801b33 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b0e:	83 ec 08             	sub    $0x8,%esp
+  801b11:	53                   	push   %ebx
+  801b12:	68 00 60 80 00       	push   $0x806000
+  801b17:	e8 ef 10 00 00       	call   802c0b <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b21:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b26:	e8 11 f2 ff ff       	call   800d3c <fsipc>
+  801b2b:	83 c4 10             	add    $0x10,%esp
+}
+  801b2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b31:	c9                   	leave
+  801b32:	c3                   	ret
+		return -E_BAD_PATH;
+  801b33:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b38:	eb f4                	jmp    801b2e <remove+0x3a>
+
+00801b3a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b3a:	55                   	push   %ebp
+  801b3b:	89 e5                	mov    %esp,%ebp
+  801b3d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b40:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b45:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b4a:	e8 ed f1 ff ff       	call   800d3c <fsipc>
+}
+  801b4f:	c9                   	leave
+  801b50:	c3                   	ret
+
+00801b51 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  801b51:	55                   	push   %ebp
+  801b52:	89 e5                	mov    %esp,%ebp
+  801b54:	57                   	push   %edi
+  801b55:	56                   	push   %esi
+  801b56:	53                   	push   %ebx
+  801b57:	83 ec 18             	sub    $0x18,%esp
+  801b5a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b5d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801b63:	57                   	push   %edi
+  801b64:	e8 67 10 00 00       	call   802bd0 <strlen>
+  801b69:	83 c4 10             	add    $0x10,%esp
+  801b6c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b71:	7f 4c                	jg     801bbf <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  801b73:	83 ec 08             	sub    $0x8,%esp
+  801b76:	57                   	push   %edi
+  801b77:	68 00 60 80 00       	push   $0x806000
+  801b7c:	e8 8a 10 00 00       	call   802c0b <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  801b81:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b86:	b8 10 00 00 00       	mov    $0x10,%eax
+  801b8b:	e8 ac f1 ff ff       	call   800d3c <fsipc>
+  801b90:	83 c4 10             	add    $0x10,%esp
+  801b93:	85 c0                	test   %eax,%eax
+  801b95:	78 20                	js     801bb7 <defrag+0x66>
+		return r;
+	if (before)
+  801b97:	85 f6                	test   %esi,%esi
+  801b99:	74 07                	je     801ba2 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  801b9b:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ba0:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  801ba2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  801ba7:	85 db                	test   %ebx,%ebx
+  801ba9:	74 0c                	je     801bb7 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  801bab:	a1 04 60 80 00       	mov    0x806004,%eax
+  801bb0:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  801bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bba:	5b                   	pop    %ebx
+  801bbb:	5e                   	pop    %esi
+  801bbc:	5f                   	pop    %edi
+  801bbd:	5d                   	pop    %ebp
+  801bbe:	c3                   	ret
+		return -E_BAD_PATH;
+  801bbf:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801bc4:	eb f1                	jmp    801bb7 <defrag+0x66>
+
+00801bc6 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  801bc6:	55                   	push   %ebp
+  801bc7:	89 e5                	mov    %esp,%ebp
+  801bc9:	53                   	push   %ebx
+  801bca:	83 ec 04             	sub    $0x4,%esp
+  801bcd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  801bd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd5:	b8 11 00 00 00       	mov    $0x11,%eax
+  801bda:	e8 5d f1 ff ff       	call   800d3c <fsipc>
+  801bdf:	85 c0                	test   %eax,%eax
+  801be1:	78 34                	js     801c17 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  801be3:	a1 00 60 80 00       	mov    0x806000,%eax
+  801be8:	89 03                	mov    %eax,(%ebx)
+  801bea:	a1 04 60 80 00       	mov    0x806004,%eax
+  801bef:	89 43 04             	mov    %eax,0x4(%ebx)
+  801bf2:	a1 08 60 80 00       	mov    0x806008,%eax
+  801bf7:	89 43 08             	mov    %eax,0x8(%ebx)
+  801bfa:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  801bff:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801c02:	a1 10 60 80 00       	mov    0x806010,%eax
+  801c07:	89 43 10             	mov    %eax,0x10(%ebx)
+  801c0a:	a1 14 60 80 00       	mov    0x806014,%eax
+  801c0f:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  801c12:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c1a:	c9                   	leave
+  801c1b:	c3                   	ret
+
+00801c1c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c1c:	55                   	push   %ebp
+  801c1d:	89 e5                	mov    %esp,%ebp
+  801c1f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c22:	68 9a 38 80 00       	push   $0x80389a
+  801c27:	ff 75 0c             	push   0xc(%ebp)
+  801c2a:	e8 dc 0f 00 00       	call   802c0b <strcpy>
+	return 0;
+}
+  801c2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c34:	c9                   	leave
+  801c35:	c3                   	ret
+
+00801c36 <devsock_close>:
+{
+  801c36:	55                   	push   %ebp
+  801c37:	89 e5                	mov    %esp,%ebp
+  801c39:	53                   	push   %ebx
+  801c3a:	83 ec 10             	sub    $0x10,%esp
+  801c3d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c40:	53                   	push   %ebx
+  801c41:	e8 ed 17 00 00       	call   803433 <pageref>
+  801c46:	89 c2                	mov    %eax,%edx
+  801c48:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c50:	83 fa 01             	cmp    $0x1,%edx
+  801c53:	74 05                	je     801c5a <devsock_close+0x24>
+}
+  801c55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c58:	c9                   	leave
+  801c59:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c5a:	83 ec 0c             	sub    $0xc,%esp
+  801c5d:	ff 73 0c             	push   0xc(%ebx)
+  801c60:	e8 b7 02 00 00       	call   801f1c <nsipc_close>
+  801c65:	83 c4 10             	add    $0x10,%esp
+  801c68:	eb eb                	jmp    801c55 <devsock_close+0x1f>
+
+00801c6a <devsock_write>:
+{
+  801c6a:	55                   	push   %ebp
+  801c6b:	89 e5                	mov    %esp,%ebp
+  801c6d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c70:	6a 00                	push   $0x0
+  801c72:	ff 75 10             	push   0x10(%ebp)
+  801c75:	ff 75 0c             	push   0xc(%ebp)
+  801c78:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7b:	ff 70 0c             	push   0xc(%eax)
+  801c7e:	e8 79 03 00 00       	call   801ffc <nsipc_send>
+}
+  801c83:	c9                   	leave
+  801c84:	c3                   	ret
+
+00801c85 <devsock_read>:
+{
+  801c85:	55                   	push   %ebp
+  801c86:	89 e5                	mov    %esp,%ebp
+  801c88:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801c8b:	6a 00                	push   $0x0
+  801c8d:	ff 75 10             	push   0x10(%ebp)
+  801c90:	ff 75 0c             	push   0xc(%ebp)
+  801c93:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c96:	ff 70 0c             	push   0xc(%eax)
+  801c99:	e8 ef 02 00 00       	call   801f8d <nsipc_recv>
+}
+  801c9e:	c9                   	leave
+  801c9f:	c3                   	ret
+
+00801ca0 <fd2sockid>:
+{
+  801ca0:	55                   	push   %ebp
+  801ca1:	89 e5                	mov    %esp,%ebp
+  801ca3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801ca6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801ca9:	52                   	push   %edx
+  801caa:	50                   	push   %eax
+  801cab:	e8 54 e9 ff ff       	call   800604 <fd_lookup>
+  801cb0:	83 c4 10             	add    $0x10,%esp
+  801cb3:	85 c0                	test   %eax,%eax
+  801cb5:	78 10                	js     801cc7 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801cb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cba:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801cc0:	39 08                	cmp    %ecx,(%eax)
+  801cc2:	75 05                	jne    801cc9 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801cc4:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801cc7:	c9                   	leave
+  801cc8:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cc9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cce:	eb f7                	jmp    801cc7 <fd2sockid+0x27>
+
+00801cd0 <alloc_sockfd>:
+{
+  801cd0:	55                   	push   %ebp
+  801cd1:	89 e5                	mov    %esp,%ebp
+  801cd3:	56                   	push   %esi
+  801cd4:	53                   	push   %ebx
+  801cd5:	83 ec 1c             	sub    $0x1c,%esp
+  801cd8:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801cda:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cdd:	50                   	push   %eax
+  801cde:	e8 cb e8 ff ff       	call   8005ae <fd_alloc>
+  801ce3:	89 c3                	mov    %eax,%ebx
+  801ce5:	83 c4 10             	add    $0x10,%esp
+  801ce8:	85 c0                	test   %eax,%eax
+  801cea:	78 43                	js     801d2f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801cec:	83 ec 04             	sub    $0x4,%esp
+  801cef:	68 07 04 00 00       	push   $0x407
+  801cf4:	ff 75 f4             	push   -0xc(%ebp)
+  801cf7:	6a 00                	push   $0x0
+  801cf9:	e8 88 e4 ff ff       	call   800186 <sys_page_alloc>
+  801cfe:	89 c3                	mov    %eax,%ebx
+  801d00:	83 c4 10             	add    $0x10,%esp
+  801d03:	85 c0                	test   %eax,%eax
+  801d05:	78 28                	js     801d2f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d0a:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801d10:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d15:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d1c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d1f:	83 ec 0c             	sub    $0xc,%esp
+  801d22:	50                   	push   %eax
+  801d23:	e8 5f e8 ff ff       	call   800587 <fd2num>
+  801d28:	89 c3                	mov    %eax,%ebx
+  801d2a:	83 c4 10             	add    $0x10,%esp
+  801d2d:	eb 0c                	jmp    801d3b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d2f:	83 ec 0c             	sub    $0xc,%esp
+  801d32:	56                   	push   %esi
+  801d33:	e8 e4 01 00 00       	call   801f1c <nsipc_close>
+		return r;
+  801d38:	83 c4 10             	add    $0x10,%esp
+}
+  801d3b:	89 d8                	mov    %ebx,%eax
+  801d3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d40:	5b                   	pop    %ebx
+  801d41:	5e                   	pop    %esi
+  801d42:	5d                   	pop    %ebp
+  801d43:	c3                   	ret
+
+00801d44 <accept>:
+{
+  801d44:	55                   	push   %ebp
+  801d45:	89 e5                	mov    %esp,%ebp
+  801d47:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d4d:	e8 4e ff ff ff       	call   801ca0 <fd2sockid>
+  801d52:	85 c0                	test   %eax,%eax
+  801d54:	78 1b                	js     801d71 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d56:	83 ec 04             	sub    $0x4,%esp
+  801d59:	ff 75 10             	push   0x10(%ebp)
+  801d5c:	ff 75 0c             	push   0xc(%ebp)
+  801d5f:	50                   	push   %eax
+  801d60:	e8 0e 01 00 00       	call   801e73 <nsipc_accept>
+  801d65:	83 c4 10             	add    $0x10,%esp
+  801d68:	85 c0                	test   %eax,%eax
+  801d6a:	78 05                	js     801d71 <accept+0x2d>
+	return alloc_sockfd(r);
+  801d6c:	e8 5f ff ff ff       	call   801cd0 <alloc_sockfd>
+}
+  801d71:	c9                   	leave
+  801d72:	c3                   	ret
+
+00801d73 <bind>:
+{
+  801d73:	55                   	push   %ebp
+  801d74:	89 e5                	mov    %esp,%ebp
+  801d76:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d79:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7c:	e8 1f ff ff ff       	call   801ca0 <fd2sockid>
+  801d81:	85 c0                	test   %eax,%eax
+  801d83:	78 12                	js     801d97 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d85:	83 ec 04             	sub    $0x4,%esp
+  801d88:	ff 75 10             	push   0x10(%ebp)
+  801d8b:	ff 75 0c             	push   0xc(%ebp)
+  801d8e:	50                   	push   %eax
+  801d8f:	e8 31 01 00 00       	call   801ec5 <nsipc_bind>
+  801d94:	83 c4 10             	add    $0x10,%esp
+}
+  801d97:	c9                   	leave
+  801d98:	c3                   	ret
+
+00801d99 <shutdown>:
+{
+  801d99:	55                   	push   %ebp
+  801d9a:	89 e5                	mov    %esp,%ebp
+  801d9c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da2:	e8 f9 fe ff ff       	call   801ca0 <fd2sockid>
+  801da7:	85 c0                	test   %eax,%eax
+  801da9:	78 0f                	js     801dba <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801dab:	83 ec 08             	sub    $0x8,%esp
+  801dae:	ff 75 0c             	push   0xc(%ebp)
+  801db1:	50                   	push   %eax
+  801db2:	e8 43 01 00 00       	call   801efa <nsipc_shutdown>
+  801db7:	83 c4 10             	add    $0x10,%esp
+}
+  801dba:	c9                   	leave
+  801dbb:	c3                   	ret
+
+00801dbc <connect>:
+{
+  801dbc:	55                   	push   %ebp
+  801dbd:	89 e5                	mov    %esp,%ebp
+  801dbf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc5:	e8 d6 fe ff ff       	call   801ca0 <fd2sockid>
+  801dca:	85 c0                	test   %eax,%eax
+  801dcc:	78 12                	js     801de0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801dce:	83 ec 04             	sub    $0x4,%esp
+  801dd1:	ff 75 10             	push   0x10(%ebp)
+  801dd4:	ff 75 0c             	push   0xc(%ebp)
+  801dd7:	50                   	push   %eax
+  801dd8:	e8 59 01 00 00       	call   801f36 <nsipc_connect>
+  801ddd:	83 c4 10             	add    $0x10,%esp
+}
+  801de0:	c9                   	leave
+  801de1:	c3                   	ret
+
+00801de2 <listen>:
+{
+  801de2:	55                   	push   %ebp
+  801de3:	89 e5                	mov    %esp,%ebp
+  801de5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801de8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801deb:	e8 b0 fe ff ff       	call   801ca0 <fd2sockid>
+  801df0:	85 c0                	test   %eax,%eax
+  801df2:	78 0f                	js     801e03 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801df4:	83 ec 08             	sub    $0x8,%esp
+  801df7:	ff 75 0c             	push   0xc(%ebp)
+  801dfa:	50                   	push   %eax
+  801dfb:	e8 6b 01 00 00       	call   801f6b <nsipc_listen>
+  801e00:	83 c4 10             	add    $0x10,%esp
+}
+  801e03:	c9                   	leave
+  801e04:	c3                   	ret
+
+00801e05 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e05:	55                   	push   %ebp
+  801e06:	89 e5                	mov    %esp,%ebp
+  801e08:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e0b:	ff 75 10             	push   0x10(%ebp)
+  801e0e:	ff 75 0c             	push   0xc(%ebp)
+  801e11:	ff 75 08             	push   0x8(%ebp)
+  801e14:	e8 41 02 00 00       	call   80205a <nsipc_socket>
+  801e19:	83 c4 10             	add    $0x10,%esp
+  801e1c:	85 c0                	test   %eax,%eax
+  801e1e:	78 05                	js     801e25 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e20:	e8 ab fe ff ff       	call   801cd0 <alloc_sockfd>
+}
+  801e25:	c9                   	leave
+  801e26:	c3                   	ret
+
+00801e27 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e27:	55                   	push   %ebp
+  801e28:	89 e5                	mov    %esp,%ebp
+  801e2a:	53                   	push   %ebx
+  801e2b:	83 ec 04             	sub    $0x4,%esp
+  801e2e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e30:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  801e37:	74 26                	je     801e5f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e39:	6a 07                	push   $0x7
+  801e3b:	68 00 80 80 00       	push   $0x808000
+  801e40:	53                   	push   %ebx
+  801e41:	ff 35 00 90 80 00    	push   0x809000
+  801e47:	e8 6f 14 00 00       	call   8032bb <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e4c:	83 c4 0c             	add    $0xc,%esp
+  801e4f:	6a 00                	push   $0x0
+  801e51:	6a 00                	push   $0x0
+  801e53:	6a 00                	push   $0x0
+  801e55:	e8 f6 13 00 00       	call   803250 <ipc_recv>
+}
+  801e5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e5d:	c9                   	leave
+  801e5e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e5f:	83 ec 0c             	sub    $0xc,%esp
+  801e62:	6a 02                	push   $0x2
+  801e64:	e8 8b 15 00 00       	call   8033f4 <ipc_find_env>
+  801e69:	a3 00 90 80 00       	mov    %eax,0x809000
+  801e6e:	83 c4 10             	add    $0x10,%esp
+  801e71:	eb c6                	jmp    801e39 <nsipc+0x12>
+
+00801e73 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e73:	55                   	push   %ebp
+  801e74:	89 e5                	mov    %esp,%ebp
+  801e76:	56                   	push   %esi
+  801e77:	53                   	push   %ebx
+  801e78:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e7e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801e83:	8b 06                	mov    (%esi),%eax
+  801e85:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801e8a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e8f:	e8 93 ff ff ff       	call   801e27 <nsipc>
+  801e94:	89 c3                	mov    %eax,%ebx
+  801e96:	85 c0                	test   %eax,%eax
+  801e98:	79 09                	jns    801ea3 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801e9a:	89 d8                	mov    %ebx,%eax
+  801e9c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e9f:	5b                   	pop    %ebx
+  801ea0:	5e                   	pop    %esi
+  801ea1:	5d                   	pop    %ebp
+  801ea2:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801ea3:	83 ec 04             	sub    $0x4,%esp
+  801ea6:	ff 35 10 80 80 00    	push   0x808010
+  801eac:	68 00 80 80 00       	push   $0x808000
+  801eb1:	ff 75 0c             	push   0xc(%ebp)
+  801eb4:	e8 d8 0e 00 00       	call   802d91 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801eb9:	a1 10 80 80 00       	mov    0x808010,%eax
+  801ebe:	89 06                	mov    %eax,(%esi)
+  801ec0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801ec3:	eb d5                	jmp    801e9a <nsipc_accept+0x27>
+
+00801ec5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801ec5:	55                   	push   %ebp
+  801ec6:	89 e5                	mov    %esp,%ebp
+  801ec8:	53                   	push   %ebx
+  801ec9:	83 ec 08             	sub    $0x8,%esp
+  801ecc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ecf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed2:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ed7:	53                   	push   %ebx
+  801ed8:	ff 75 0c             	push   0xc(%ebp)
+  801edb:	68 04 80 80 00       	push   $0x808004
+  801ee0:	e8 ac 0e 00 00       	call   802d91 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801ee5:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801eeb:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ef0:	e8 32 ff ff ff       	call   801e27 <nsipc>
+}
+  801ef5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ef8:	c9                   	leave
+  801ef9:	c3                   	ret
+
+00801efa <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801efa:	55                   	push   %ebp
+  801efb:	89 e5                	mov    %esp,%ebp
+  801efd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f00:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f03:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801f08:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f0b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f10:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f15:	e8 0d ff ff ff       	call   801e27 <nsipc>
+}
+  801f1a:	c9                   	leave
+  801f1b:	c3                   	ret
+
+00801f1c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f1c:	55                   	push   %ebp
+  801f1d:	89 e5                	mov    %esp,%ebp
+  801f1f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f22:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f25:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f2a:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f2f:	e8 f3 fe ff ff       	call   801e27 <nsipc>
+}
+  801f34:	c9                   	leave
+  801f35:	c3                   	ret
+
+00801f36 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f36:	55                   	push   %ebp
+  801f37:	89 e5                	mov    %esp,%ebp
+  801f39:	53                   	push   %ebx
+  801f3a:	83 ec 08             	sub    $0x8,%esp
+  801f3d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f40:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f43:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f48:	53                   	push   %ebx
+  801f49:	ff 75 0c             	push   0xc(%ebp)
+  801f4c:	68 04 80 80 00       	push   $0x808004
+  801f51:	e8 3b 0e 00 00       	call   802d91 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f56:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801f5c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f61:	e8 c1 fe ff ff       	call   801e27 <nsipc>
+}
+  801f66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f69:	c9                   	leave
+  801f6a:	c3                   	ret
+
+00801f6b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f6b:	55                   	push   %ebp
+  801f6c:	89 e5                	mov    %esp,%ebp
+  801f6e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f71:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f74:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f7c:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801f81:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f86:	e8 9c fe ff ff       	call   801e27 <nsipc>
+}
+  801f8b:	c9                   	leave
+  801f8c:	c3                   	ret
+
+00801f8d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801f8d:	55                   	push   %ebp
+  801f8e:	89 e5                	mov    %esp,%ebp
+  801f90:	56                   	push   %esi
+  801f91:	53                   	push   %ebx
+  801f92:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801f95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f98:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801f9d:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801fa3:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fa6:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801fab:	b8 07 00 00 00       	mov    $0x7,%eax
+  801fb0:	e8 72 fe ff ff       	call   801e27 <nsipc>
+  801fb5:	89 c3                	mov    %eax,%ebx
+  801fb7:	85 c0                	test   %eax,%eax
+  801fb9:	78 22                	js     801fdd <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801fbb:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801fc0:	39 c6                	cmp    %eax,%esi
+  801fc2:	0f 4e c6             	cmovle %esi,%eax
+  801fc5:	39 c3                	cmp    %eax,%ebx
+  801fc7:	7f 1d                	jg     801fe6 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801fc9:	83 ec 04             	sub    $0x4,%esp
+  801fcc:	53                   	push   %ebx
+  801fcd:	68 00 80 80 00       	push   $0x808000
+  801fd2:	ff 75 0c             	push   0xc(%ebp)
+  801fd5:	e8 b7 0d 00 00       	call   802d91 <memmove>
+  801fda:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801fdd:	89 d8                	mov    %ebx,%eax
+  801fdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe2:	5b                   	pop    %ebx
+  801fe3:	5e                   	pop    %esi
+  801fe4:	5d                   	pop    %ebp
+  801fe5:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801fe6:	68 a6 38 80 00       	push   $0x8038a6
+  801feb:	68 44 38 80 00       	push   $0x803844
+  801ff0:	6a 62                	push   $0x62
+  801ff2:	68 bb 38 80 00       	push   $0x8038bb
+  801ff7:	e8 46 05 00 00       	call   802542 <_panic>
+
+00801ffc <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801ffc:	55                   	push   %ebp
+  801ffd:	89 e5                	mov    %esp,%ebp
+  801fff:	53                   	push   %ebx
+  802000:	83 ec 04             	sub    $0x4,%esp
+  802003:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802006:	8b 45 08             	mov    0x8(%ebp),%eax
+  802009:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80200e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802014:	7f 2e                	jg     802044 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802016:	83 ec 04             	sub    $0x4,%esp
+  802019:	53                   	push   %ebx
+  80201a:	ff 75 0c             	push   0xc(%ebp)
+  80201d:	68 0c 80 80 00       	push   $0x80800c
+  802022:	e8 6a 0d 00 00       	call   802d91 <memmove>
+	nsipcbuf.send.req_size = size;
+  802027:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  80202d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802030:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802035:	b8 08 00 00 00       	mov    $0x8,%eax
+  80203a:	e8 e8 fd ff ff       	call   801e27 <nsipc>
+}
+  80203f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802042:	c9                   	leave
+  802043:	c3                   	ret
+	assert(size < 1600);
+  802044:	68 c7 38 80 00       	push   $0x8038c7
+  802049:	68 44 38 80 00       	push   $0x803844
+  80204e:	6a 6d                	push   $0x6d
+  802050:	68 bb 38 80 00       	push   $0x8038bb
+  802055:	e8 e8 04 00 00       	call   802542 <_panic>
+
+0080205a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80205a:	55                   	push   %ebp
+  80205b:	89 e5                	mov    %esp,%ebp
+  80205d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802060:	8b 45 08             	mov    0x8(%ebp),%eax
+  802063:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802068:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80206b:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802070:	8b 45 10             	mov    0x10(%ebp),%eax
+  802073:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802078:	b8 09 00 00 00       	mov    $0x9,%eax
+  80207d:	e8 a5 fd ff ff       	call   801e27 <nsipc>
+}
+  802082:	c9                   	leave
+  802083:	c3                   	ret
+
+00802084 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802084:	55                   	push   %ebp
+  802085:	89 e5                	mov    %esp,%ebp
+  802087:	56                   	push   %esi
+  802088:	53                   	push   %ebx
+  802089:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80208c:	83 ec 0c             	sub    $0xc,%esp
+  80208f:	ff 75 08             	push   0x8(%ebp)
+  802092:	e8 00 e5 ff ff       	call   800597 <fd2data>
+  802097:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802099:	83 c4 08             	add    $0x8,%esp
+  80209c:	68 d3 38 80 00       	push   $0x8038d3
+  8020a1:	53                   	push   %ebx
+  8020a2:	e8 64 0b 00 00       	call   802c0b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8020a7:	8b 46 04             	mov    0x4(%esi),%eax
+  8020aa:	2b 06                	sub    (%esi),%eax
+  8020ac:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8020b2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020b9:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020bc:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  8020c3:	40 80 00 
+	return 0;
+}
+  8020c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020ce:	5b                   	pop    %ebx
+  8020cf:	5e                   	pop    %esi
+  8020d0:	5d                   	pop    %ebp
+  8020d1:	c3                   	ret
+
+008020d2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020d2:	55                   	push   %ebp
+  8020d3:	89 e5                	mov    %esp,%ebp
+  8020d5:	53                   	push   %ebx
+  8020d6:	83 ec 0c             	sub    $0xc,%esp
+  8020d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020dc:	53                   	push   %ebx
+  8020dd:	6a 00                	push   $0x0
+  8020df:	e8 2f e1 ff ff       	call   800213 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8020e4:	89 1c 24             	mov    %ebx,(%esp)
+  8020e7:	e8 ab e4 ff ff       	call   800597 <fd2data>
+  8020ec:	83 c4 08             	add    $0x8,%esp
+  8020ef:	50                   	push   %eax
+  8020f0:	6a 00                	push   $0x0
+  8020f2:	e8 1c e1 ff ff       	call   800213 <sys_page_unmap>
+}
+  8020f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020fa:	c9                   	leave
+  8020fb:	c3                   	ret
+
+008020fc <_pipeisclosed>:
+{
+  8020fc:	55                   	push   %ebp
+  8020fd:	89 e5                	mov    %esp,%ebp
+  8020ff:	57                   	push   %edi
+  802100:	56                   	push   %esi
+  802101:	53                   	push   %ebx
+  802102:	83 ec 1c             	sub    $0x1c,%esp
+  802105:	89 c7                	mov    %eax,%edi
+  802107:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802109:	a1 00 50 80 00       	mov    0x805000,%eax
+  80210e:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802111:	83 ec 0c             	sub    $0xc,%esp
+  802114:	57                   	push   %edi
+  802115:	e8 19 13 00 00       	call   803433 <pageref>
+  80211a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80211d:	89 34 24             	mov    %esi,(%esp)
+  802120:	e8 0e 13 00 00       	call   803433 <pageref>
+		nn = thisenv->env_runs;
+  802125:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80212b:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80212e:	83 c4 10             	add    $0x10,%esp
+  802131:	39 cb                	cmp    %ecx,%ebx
+  802133:	74 1b                	je     802150 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802135:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802138:	75 cf                	jne    802109 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80213a:	8b 42 58             	mov    0x58(%edx),%eax
+  80213d:	6a 01                	push   $0x1
+  80213f:	50                   	push   %eax
+  802140:	53                   	push   %ebx
+  802141:	68 da 38 80 00       	push   $0x8038da
+  802146:	e8 d2 04 00 00       	call   80261d <cprintf>
+  80214b:	83 c4 10             	add    $0x10,%esp
+  80214e:	eb b9                	jmp    802109 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802150:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802153:	0f 94 c0             	sete   %al
+  802156:	0f b6 c0             	movzbl %al,%eax
+}
+  802159:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80215c:	5b                   	pop    %ebx
+  80215d:	5e                   	pop    %esi
+  80215e:	5f                   	pop    %edi
+  80215f:	5d                   	pop    %ebp
+  802160:	c3                   	ret
+
+00802161 <devpipe_write>:
+{
+  802161:	55                   	push   %ebp
+  802162:	89 e5                	mov    %esp,%ebp
+  802164:	57                   	push   %edi
+  802165:	56                   	push   %esi
+  802166:	53                   	push   %ebx
+  802167:	83 ec 28             	sub    $0x28,%esp
+  80216a:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80216d:	56                   	push   %esi
+  80216e:	e8 24 e4 ff ff       	call   800597 <fd2data>
+  802173:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802175:	83 c4 10             	add    $0x10,%esp
+  802178:	bf 00 00 00 00       	mov    $0x0,%edi
+  80217d:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802180:	75 09                	jne    80218b <devpipe_write+0x2a>
+	return i;
+  802182:	89 f8                	mov    %edi,%eax
+  802184:	eb 23                	jmp    8021a9 <devpipe_write+0x48>
+			sys_yield();
+  802186:	e8 dc df ff ff       	call   800167 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80218b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80218e:	8b 0b                	mov    (%ebx),%ecx
+  802190:	8d 51 20             	lea    0x20(%ecx),%edx
+  802193:	39 d0                	cmp    %edx,%eax
+  802195:	72 1a                	jb     8021b1 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802197:	89 da                	mov    %ebx,%edx
+  802199:	89 f0                	mov    %esi,%eax
+  80219b:	e8 5c ff ff ff       	call   8020fc <_pipeisclosed>
+  8021a0:	85 c0                	test   %eax,%eax
+  8021a2:	74 e2                	je     802186 <devpipe_write+0x25>
+				return 0;
+  8021a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ac:	5b                   	pop    %ebx
+  8021ad:	5e                   	pop    %esi
+  8021ae:	5f                   	pop    %edi
+  8021af:	5d                   	pop    %ebp
+  8021b0:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021b4:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021b8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021bb:	89 c2                	mov    %eax,%edx
+  8021bd:	c1 fa 1f             	sar    $0x1f,%edx
+  8021c0:	89 d1                	mov    %edx,%ecx
+  8021c2:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021c5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021c8:	83 e2 1f             	and    $0x1f,%edx
+  8021cb:	29 ca                	sub    %ecx,%edx
+  8021cd:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8021d1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021d5:	83 c0 01             	add    $0x1,%eax
+  8021d8:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8021db:	83 c7 01             	add    $0x1,%edi
+  8021de:	eb 9d                	jmp    80217d <devpipe_write+0x1c>
+
+008021e0 <devpipe_read>:
+{
+  8021e0:	55                   	push   %ebp
+  8021e1:	89 e5                	mov    %esp,%ebp
+  8021e3:	57                   	push   %edi
+  8021e4:	56                   	push   %esi
+  8021e5:	53                   	push   %ebx
+  8021e6:	83 ec 18             	sub    $0x18,%esp
+  8021e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8021ec:	57                   	push   %edi
+  8021ed:	e8 a5 e3 ff ff       	call   800597 <fd2data>
+  8021f2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021f4:	83 c4 10             	add    $0x10,%esp
+  8021f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8021fc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021ff:	75 13                	jne    802214 <devpipe_read+0x34>
+	return i;
+  802201:	89 f0                	mov    %esi,%eax
+  802203:	eb 02                	jmp    802207 <devpipe_read+0x27>
+				return i;
+  802205:	89 f0                	mov    %esi,%eax
+}
+  802207:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80220a:	5b                   	pop    %ebx
+  80220b:	5e                   	pop    %esi
+  80220c:	5f                   	pop    %edi
+  80220d:	5d                   	pop    %ebp
+  80220e:	c3                   	ret
+			sys_yield();
+  80220f:	e8 53 df ff ff       	call   800167 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802214:	8b 03                	mov    (%ebx),%eax
+  802216:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802219:	75 18                	jne    802233 <devpipe_read+0x53>
+			if (i > 0)
+  80221b:	85 f6                	test   %esi,%esi
+  80221d:	75 e6                	jne    802205 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80221f:	89 da                	mov    %ebx,%edx
+  802221:	89 f8                	mov    %edi,%eax
+  802223:	e8 d4 fe ff ff       	call   8020fc <_pipeisclosed>
+  802228:	85 c0                	test   %eax,%eax
+  80222a:	74 e3                	je     80220f <devpipe_read+0x2f>
+				return 0;
+  80222c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802231:	eb d4                	jmp    802207 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802233:	99                   	cltd
+  802234:	c1 ea 1b             	shr    $0x1b,%edx
+  802237:	01 d0                	add    %edx,%eax
+  802239:	83 e0 1f             	and    $0x1f,%eax
+  80223c:	29 d0                	sub    %edx,%eax
+  80223e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802243:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802246:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802249:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80224c:	83 c6 01             	add    $0x1,%esi
+  80224f:	eb ab                	jmp    8021fc <devpipe_read+0x1c>
+
+00802251 <pipe>:
+{
+  802251:	55                   	push   %ebp
+  802252:	89 e5                	mov    %esp,%ebp
+  802254:	56                   	push   %esi
+  802255:	53                   	push   %ebx
+  802256:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802259:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80225c:	50                   	push   %eax
+  80225d:	e8 4c e3 ff ff       	call   8005ae <fd_alloc>
+  802262:	89 c3                	mov    %eax,%ebx
+  802264:	83 c4 10             	add    $0x10,%esp
+  802267:	85 c0                	test   %eax,%eax
+  802269:	0f 88 23 01 00 00    	js     802392 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80226f:	83 ec 04             	sub    $0x4,%esp
+  802272:	68 07 04 00 00       	push   $0x407
+  802277:	ff 75 f4             	push   -0xc(%ebp)
+  80227a:	6a 00                	push   $0x0
+  80227c:	e8 05 df ff ff       	call   800186 <sys_page_alloc>
+  802281:	89 c3                	mov    %eax,%ebx
+  802283:	83 c4 10             	add    $0x10,%esp
+  802286:	85 c0                	test   %eax,%eax
+  802288:	0f 88 04 01 00 00    	js     802392 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80228e:	83 ec 0c             	sub    $0xc,%esp
+  802291:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802294:	50                   	push   %eax
+  802295:	e8 14 e3 ff ff       	call   8005ae <fd_alloc>
+  80229a:	89 c3                	mov    %eax,%ebx
+  80229c:	83 c4 10             	add    $0x10,%esp
+  80229f:	85 c0                	test   %eax,%eax
+  8022a1:	0f 88 db 00 00 00    	js     802382 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022a7:	83 ec 04             	sub    $0x4,%esp
+  8022aa:	68 07 04 00 00       	push   $0x407
+  8022af:	ff 75 f0             	push   -0x10(%ebp)
+  8022b2:	6a 00                	push   $0x0
+  8022b4:	e8 cd de ff ff       	call   800186 <sys_page_alloc>
+  8022b9:	89 c3                	mov    %eax,%ebx
+  8022bb:	83 c4 10             	add    $0x10,%esp
+  8022be:	85 c0                	test   %eax,%eax
+  8022c0:	0f 88 bc 00 00 00    	js     802382 <pipe+0x131>
+	va = fd2data(fd0);
+  8022c6:	83 ec 0c             	sub    $0xc,%esp
+  8022c9:	ff 75 f4             	push   -0xc(%ebp)
+  8022cc:	e8 c6 e2 ff ff       	call   800597 <fd2data>
+  8022d1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022d3:	83 c4 0c             	add    $0xc,%esp
+  8022d6:	68 07 04 00 00       	push   $0x407
+  8022db:	50                   	push   %eax
+  8022dc:	6a 00                	push   $0x0
+  8022de:	e8 a3 de ff ff       	call   800186 <sys_page_alloc>
+  8022e3:	89 c3                	mov    %eax,%ebx
+  8022e5:	83 c4 10             	add    $0x10,%esp
+  8022e8:	85 c0                	test   %eax,%eax
+  8022ea:	0f 88 82 00 00 00    	js     802372 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022f0:	83 ec 0c             	sub    $0xc,%esp
+  8022f3:	ff 75 f0             	push   -0x10(%ebp)
+  8022f6:	e8 9c e2 ff ff       	call   800597 <fd2data>
+  8022fb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802302:	50                   	push   %eax
+  802303:	6a 00                	push   $0x0
+  802305:	56                   	push   %esi
+  802306:	6a 00                	push   $0x0
+  802308:	e8 c4 de ff ff       	call   8001d1 <sys_page_map>
+  80230d:	89 c3                	mov    %eax,%ebx
+  80230f:	83 c4 20             	add    $0x20,%esp
+  802312:	85 c0                	test   %eax,%eax
+  802314:	78 4e                	js     802364 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802316:	a1 60 40 80 00       	mov    0x804060,%eax
+  80231b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80231e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802320:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802323:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80232a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80232d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80232f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802332:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802339:	83 ec 0c             	sub    $0xc,%esp
+  80233c:	ff 75 f4             	push   -0xc(%ebp)
+  80233f:	e8 43 e2 ff ff       	call   800587 <fd2num>
+  802344:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802347:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802349:	83 c4 04             	add    $0x4,%esp
+  80234c:	ff 75 f0             	push   -0x10(%ebp)
+  80234f:	e8 33 e2 ff ff       	call   800587 <fd2num>
+  802354:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802357:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80235a:	83 c4 10             	add    $0x10,%esp
+  80235d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802362:	eb 2e                	jmp    802392 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802364:	83 ec 08             	sub    $0x8,%esp
+  802367:	56                   	push   %esi
+  802368:	6a 00                	push   $0x0
+  80236a:	e8 a4 de ff ff       	call   800213 <sys_page_unmap>
+  80236f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802372:	83 ec 08             	sub    $0x8,%esp
+  802375:	ff 75 f0             	push   -0x10(%ebp)
+  802378:	6a 00                	push   $0x0
+  80237a:	e8 94 de ff ff       	call   800213 <sys_page_unmap>
+  80237f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802382:	83 ec 08             	sub    $0x8,%esp
+  802385:	ff 75 f4             	push   -0xc(%ebp)
+  802388:	6a 00                	push   $0x0
+  80238a:	e8 84 de ff ff       	call   800213 <sys_page_unmap>
+  80238f:	83 c4 10             	add    $0x10,%esp
+}
+  802392:	89 d8                	mov    %ebx,%eax
+  802394:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802397:	5b                   	pop    %ebx
+  802398:	5e                   	pop    %esi
+  802399:	5d                   	pop    %ebp
+  80239a:	c3                   	ret
+
+0080239b <pipeisclosed>:
+{
+  80239b:	55                   	push   %ebp
+  80239c:	89 e5                	mov    %esp,%ebp
+  80239e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023a4:	50                   	push   %eax
+  8023a5:	ff 75 08             	push   0x8(%ebp)
+  8023a8:	e8 57 e2 ff ff       	call   800604 <fd_lookup>
+  8023ad:	83 c4 10             	add    $0x10,%esp
+  8023b0:	85 c0                	test   %eax,%eax
+  8023b2:	78 18                	js     8023cc <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8023b4:	83 ec 0c             	sub    $0xc,%esp
+  8023b7:	ff 75 f4             	push   -0xc(%ebp)
+  8023ba:	e8 d8 e1 ff ff       	call   800597 <fd2data>
+  8023bf:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8023c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023c4:	e8 33 fd ff ff       	call   8020fc <_pipeisclosed>
+  8023c9:	83 c4 10             	add    $0x10,%esp
+}
+  8023cc:	c9                   	leave
+  8023cd:	c3                   	ret
+
+008023ce <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8023ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d3:	c3                   	ret
+
+008023d4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023d4:	55                   	push   %ebp
+  8023d5:	89 e5                	mov    %esp,%ebp
+  8023d7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8023da:	68 f2 38 80 00       	push   $0x8038f2
+  8023df:	ff 75 0c             	push   0xc(%ebp)
+  8023e2:	e8 24 08 00 00       	call   802c0b <strcpy>
+	return 0;
+}
+  8023e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ec:	c9                   	leave
+  8023ed:	c3                   	ret
+
+008023ee <devcons_write>:
+{
+  8023ee:	55                   	push   %ebp
+  8023ef:	89 e5                	mov    %esp,%ebp
+  8023f1:	57                   	push   %edi
+  8023f2:	56                   	push   %esi
+  8023f3:	53                   	push   %ebx
+  8023f4:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8023fa:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8023ff:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802405:	eb 2e                	jmp    802435 <devcons_write+0x47>
+		m = n - tot;
+  802407:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80240a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80240c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802411:	39 c3                	cmp    %eax,%ebx
+  802413:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802416:	83 ec 04             	sub    $0x4,%esp
+  802419:	53                   	push   %ebx
+  80241a:	89 f0                	mov    %esi,%eax
+  80241c:	03 45 0c             	add    0xc(%ebp),%eax
+  80241f:	50                   	push   %eax
+  802420:	57                   	push   %edi
+  802421:	e8 6b 09 00 00       	call   802d91 <memmove>
+		sys_cputs(buf, m);
+  802426:	83 c4 08             	add    $0x8,%esp
+  802429:	53                   	push   %ebx
+  80242a:	57                   	push   %edi
+  80242b:	e8 7a dc ff ff       	call   8000aa <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802430:	01 de                	add    %ebx,%esi
+  802432:	83 c4 10             	add    $0x10,%esp
+  802435:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802438:	72 cd                	jb     802407 <devcons_write+0x19>
+}
+  80243a:	89 f0                	mov    %esi,%eax
+  80243c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80243f:	5b                   	pop    %ebx
+  802440:	5e                   	pop    %esi
+  802441:	5f                   	pop    %edi
+  802442:	5d                   	pop    %ebp
+  802443:	c3                   	ret
+
+00802444 <devcons_read>:
+{
+  802444:	55                   	push   %ebp
+  802445:	89 e5                	mov    %esp,%ebp
+  802447:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80244a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802453:	75 07                	jne    80245c <devcons_read+0x18>
+  802455:	eb 1f                	jmp    802476 <devcons_read+0x32>
+		sys_yield();
+  802457:	e8 0b dd ff ff       	call   800167 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80245c:	e8 6f dc ff ff       	call   8000d0 <sys_cgetc>
+  802461:	85 c0                	test   %eax,%eax
+  802463:	74 f2                	je     802457 <devcons_read+0x13>
+	if (c < 0)
+  802465:	78 0f                	js     802476 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802467:	83 f8 04             	cmp    $0x4,%eax
+  80246a:	74 0c                	je     802478 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80246c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80246f:	88 02                	mov    %al,(%edx)
+	return 1;
+  802471:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802476:	c9                   	leave
+  802477:	c3                   	ret
+		return 0;
+  802478:	b8 00 00 00 00       	mov    $0x0,%eax
+  80247d:	eb f7                	jmp    802476 <devcons_read+0x32>
+
+0080247f <cputchar>:
+{
+  80247f:	55                   	push   %ebp
+  802480:	89 e5                	mov    %esp,%ebp
+  802482:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802485:	8b 45 08             	mov    0x8(%ebp),%eax
+  802488:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80248b:	6a 01                	push   $0x1
+  80248d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802490:	50                   	push   %eax
+  802491:	e8 14 dc ff ff       	call   8000aa <sys_cputs>
+}
+  802496:	83 c4 10             	add    $0x10,%esp
+  802499:	c9                   	leave
+  80249a:	c3                   	ret
+
+0080249b <getchar>:
+{
+  80249b:	55                   	push   %ebp
+  80249c:	89 e5                	mov    %esp,%ebp
+  80249e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8024a1:	6a 01                	push   $0x1
+  8024a3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024a6:	50                   	push   %eax
+  8024a7:	6a 00                	push   $0x0
+  8024a9:	e8 bc e3 ff ff       	call   80086a <read>
+	if (r < 0)
+  8024ae:	83 c4 10             	add    $0x10,%esp
+  8024b1:	85 c0                	test   %eax,%eax
+  8024b3:	78 06                	js     8024bb <getchar+0x20>
+	if (r < 1)
+  8024b5:	74 06                	je     8024bd <getchar+0x22>
+	return c;
+  8024b7:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8024bb:	c9                   	leave
+  8024bc:	c3                   	ret
+		return -E_EOF;
+  8024bd:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8024c2:	eb f7                	jmp    8024bb <getchar+0x20>
+
+008024c4 <iscons>:
+{
+  8024c4:	55                   	push   %ebp
+  8024c5:	89 e5                	mov    %esp,%ebp
+  8024c7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024cd:	50                   	push   %eax
+  8024ce:	ff 75 08             	push   0x8(%ebp)
+  8024d1:	e8 2e e1 ff ff       	call   800604 <fd_lookup>
+  8024d6:	83 c4 10             	add    $0x10,%esp
+  8024d9:	85 c0                	test   %eax,%eax
+  8024db:	78 11                	js     8024ee <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8024dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024e0:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8024e6:	39 10                	cmp    %edx,(%eax)
+  8024e8:	0f 94 c0             	sete   %al
+  8024eb:	0f b6 c0             	movzbl %al,%eax
+}
+  8024ee:	c9                   	leave
+  8024ef:	c3                   	ret
+
+008024f0 <opencons>:
+{
+  8024f0:	55                   	push   %ebp
+  8024f1:	89 e5                	mov    %esp,%ebp
+  8024f3:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8024f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024f9:	50                   	push   %eax
+  8024fa:	e8 af e0 ff ff       	call   8005ae <fd_alloc>
+  8024ff:	83 c4 10             	add    $0x10,%esp
+  802502:	85 c0                	test   %eax,%eax
+  802504:	78 3a                	js     802540 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802506:	83 ec 04             	sub    $0x4,%esp
+  802509:	68 07 04 00 00       	push   $0x407
+  80250e:	ff 75 f4             	push   -0xc(%ebp)
+  802511:	6a 00                	push   $0x0
+  802513:	e8 6e dc ff ff       	call   800186 <sys_page_alloc>
+  802518:	83 c4 10             	add    $0x10,%esp
+  80251b:	85 c0                	test   %eax,%eax
+  80251d:	78 21                	js     802540 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80251f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802522:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802528:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80252a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80252d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802534:	83 ec 0c             	sub    $0xc,%esp
+  802537:	50                   	push   %eax
+  802538:	e8 4a e0 ff ff       	call   800587 <fd2num>
+  80253d:	83 c4 10             	add    $0x10,%esp
+}
+  802540:	c9                   	leave
+  802541:	c3                   	ret
+
+00802542 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802542:	55                   	push   %ebp
+  802543:	89 e5                	mov    %esp,%ebp
+  802545:	56                   	push   %esi
+  802546:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802547:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80254a:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802550:	e8 eb db ff ff       	call   800140 <sys_getenvid>
+  802555:	83 ec 0c             	sub    $0xc,%esp
+  802558:	ff 75 0c             	push   0xc(%ebp)
+  80255b:	ff 75 08             	push   0x8(%ebp)
+  80255e:	56                   	push   %esi
+  80255f:	50                   	push   %eax
+  802560:	68 00 39 80 00       	push   $0x803900
+  802565:	e8 b3 00 00 00       	call   80261d <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80256a:	83 c4 18             	add    $0x18,%esp
+  80256d:	53                   	push   %ebx
+  80256e:	ff 75 10             	push   0x10(%ebp)
+  802571:	e8 56 00 00 00       	call   8025cc <vcprintf>
+	cprintf("\n");
+  802576:	c7 04 24 eb 38 80 00 	movl   $0x8038eb,(%esp)
+  80257d:	e8 9b 00 00 00       	call   80261d <cprintf>
+  802582:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802585:	cc                   	int3
+	while (1)
+  802586:	eb fd                	jmp    802585 <_panic+0x43>
+
+00802588 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  802588:	55                   	push   %ebp
+  802589:	89 e5                	mov    %esp,%ebp
+  80258b:	53                   	push   %ebx
+  80258c:	83 ec 04             	sub    $0x4,%esp
+  80258f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802592:	8b 13                	mov    (%ebx),%edx
+  802594:	8d 42 01             	lea    0x1(%edx),%eax
+  802597:	89 03                	mov    %eax,(%ebx)
+  802599:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80259c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8025a0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8025a5:	74 09                	je     8025b0 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8025a7:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8025ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025ae:	c9                   	leave
+  8025af:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8025b0:	83 ec 08             	sub    $0x8,%esp
+  8025b3:	68 ff 00 00 00       	push   $0xff
+  8025b8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8025bb:	50                   	push   %eax
+  8025bc:	e8 e9 da ff ff       	call   8000aa <sys_cputs>
+		b->idx = 0;
+  8025c1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8025c7:	83 c4 10             	add    $0x10,%esp
+  8025ca:	eb db                	jmp    8025a7 <putch+0x1f>
+
+008025cc <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8025cc:	55                   	push   %ebp
+  8025cd:	89 e5                	mov    %esp,%ebp
+  8025cf:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8025d5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8025dc:	00 00 00 
+	b.cnt = 0;
+  8025df:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8025e6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8025e9:	ff 75 0c             	push   0xc(%ebp)
+  8025ec:	ff 75 08             	push   0x8(%ebp)
+  8025ef:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8025f5:	50                   	push   %eax
+  8025f6:	68 88 25 80 00       	push   $0x802588
+  8025fb:	e8 14 01 00 00       	call   802714 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802600:	83 c4 08             	add    $0x8,%esp
+  802603:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802609:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80260f:	50                   	push   %eax
+  802610:	e8 95 da ff ff       	call   8000aa <sys_cputs>
+
+	return b.cnt;
+}
+  802615:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80261b:	c9                   	leave
+  80261c:	c3                   	ret
+
+0080261d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80261d:	55                   	push   %ebp
+  80261e:	89 e5                	mov    %esp,%ebp
+  802620:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802623:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802626:	50                   	push   %eax
+  802627:	ff 75 08             	push   0x8(%ebp)
+  80262a:	e8 9d ff ff ff       	call   8025cc <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80262f:	c9                   	leave
+  802630:	c3                   	ret
+
+00802631 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802631:	55                   	push   %ebp
+  802632:	89 e5                	mov    %esp,%ebp
+  802634:	57                   	push   %edi
+  802635:	56                   	push   %esi
+  802636:	53                   	push   %ebx
+  802637:	83 ec 1c             	sub    $0x1c,%esp
+  80263a:	89 c7                	mov    %eax,%edi
+  80263c:	89 d6                	mov    %edx,%esi
+  80263e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802641:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802644:	89 d1                	mov    %edx,%ecx
+  802646:	89 c2                	mov    %eax,%edx
+  802648:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80264b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80264e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802651:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802654:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802657:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80265e:	39 c2                	cmp    %eax,%edx
+  802660:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802663:	72 3e                	jb     8026a3 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802665:	83 ec 0c             	sub    $0xc,%esp
+  802668:	ff 75 18             	push   0x18(%ebp)
+  80266b:	83 eb 01             	sub    $0x1,%ebx
+  80266e:	53                   	push   %ebx
+  80266f:	50                   	push   %eax
+  802670:	83 ec 08             	sub    $0x8,%esp
+  802673:	ff 75 e4             	push   -0x1c(%ebp)
+  802676:	ff 75 e0             	push   -0x20(%ebp)
+  802679:	ff 75 dc             	push   -0x24(%ebp)
+  80267c:	ff 75 d8             	push   -0x28(%ebp)
+  80267f:	e8 59 0f 00 00       	call   8035dd <__udivdi3>
+  802684:	83 c4 18             	add    $0x18,%esp
+  802687:	52                   	push   %edx
+  802688:	50                   	push   %eax
+  802689:	89 f2                	mov    %esi,%edx
+  80268b:	89 f8                	mov    %edi,%eax
+  80268d:	e8 9f ff ff ff       	call   802631 <printnum>
+  802692:	83 c4 20             	add    $0x20,%esp
+  802695:	eb 13                	jmp    8026aa <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  802697:	83 ec 08             	sub    $0x8,%esp
+  80269a:	56                   	push   %esi
+  80269b:	ff 75 18             	push   0x18(%ebp)
+  80269e:	ff d7                	call   *%edi
+  8026a0:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8026a3:	83 eb 01             	sub    $0x1,%ebx
+  8026a6:	85 db                	test   %ebx,%ebx
+  8026a8:	7f ed                	jg     802697 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8026aa:	83 ec 08             	sub    $0x8,%esp
+  8026ad:	56                   	push   %esi
+  8026ae:	83 ec 04             	sub    $0x4,%esp
+  8026b1:	ff 75 e4             	push   -0x1c(%ebp)
+  8026b4:	ff 75 e0             	push   -0x20(%ebp)
+  8026b7:	ff 75 dc             	push   -0x24(%ebp)
+  8026ba:	ff 75 d8             	push   -0x28(%ebp)
+  8026bd:	e8 39 0f 00 00       	call   8035fb <__umoddi3>
+  8026c2:	83 c4 14             	add    $0x14,%esp
+  8026c5:	0f be 80 23 39 80 00 	movsbl 0x803923(%eax),%eax
+  8026cc:	50                   	push   %eax
+  8026cd:	ff d7                	call   *%edi
+}
+  8026cf:	83 c4 10             	add    $0x10,%esp
+  8026d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026d5:	5b                   	pop    %ebx
+  8026d6:	5e                   	pop    %esi
+  8026d7:	5f                   	pop    %edi
+  8026d8:	5d                   	pop    %ebp
+  8026d9:	c3                   	ret
+
+008026da <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8026da:	55                   	push   %ebp
+  8026db:	89 e5                	mov    %esp,%ebp
+  8026dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8026e0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8026e4:	8b 10                	mov    (%eax),%edx
+  8026e6:	3b 50 04             	cmp    0x4(%eax),%edx
+  8026e9:	73 0a                	jae    8026f5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8026eb:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8026ee:	89 08                	mov    %ecx,(%eax)
+  8026f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f3:	88 02                	mov    %al,(%edx)
+}
+  8026f5:	5d                   	pop    %ebp
+  8026f6:	c3                   	ret
+
+008026f7 <printfmt>:
+{
+  8026f7:	55                   	push   %ebp
+  8026f8:	89 e5                	mov    %esp,%ebp
+  8026fa:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8026fd:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  802700:	50                   	push   %eax
+  802701:	ff 75 10             	push   0x10(%ebp)
+  802704:	ff 75 0c             	push   0xc(%ebp)
+  802707:	ff 75 08             	push   0x8(%ebp)
+  80270a:	e8 05 00 00 00       	call   802714 <vprintfmt>
+}
+  80270f:	83 c4 10             	add    $0x10,%esp
+  802712:	c9                   	leave
+  802713:	c3                   	ret
+
+00802714 <vprintfmt>:
+{
+  802714:	55                   	push   %ebp
+  802715:	89 e5                	mov    %esp,%ebp
+  802717:	57                   	push   %edi
+  802718:	56                   	push   %esi
+  802719:	53                   	push   %ebx
+  80271a:	83 ec 2c             	sub    $0x2c,%esp
+  80271d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802720:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802723:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802726:	eb 0a                	jmp    802732 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  802728:	83 ec 08             	sub    $0x8,%esp
+  80272b:	53                   	push   %ebx
+  80272c:	50                   	push   %eax
+  80272d:	ff d6                	call   *%esi
+  80272f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802732:	83 c7 01             	add    $0x1,%edi
+  802735:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  802739:	83 f8 25             	cmp    $0x25,%eax
+  80273c:	74 0c                	je     80274a <vprintfmt+0x36>
+			if (ch == '\0')
+  80273e:	85 c0                	test   %eax,%eax
+  802740:	75 e6                	jne    802728 <vprintfmt+0x14>
+}
+  802742:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802745:	5b                   	pop    %ebx
+  802746:	5e                   	pop    %esi
+  802747:	5f                   	pop    %edi
+  802748:	5d                   	pop    %ebp
+  802749:	c3                   	ret
+		padc = ' ';
+  80274a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80274e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802755:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80275c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  802763:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  802768:	8d 47 01             	lea    0x1(%edi),%eax
+  80276b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80276e:	0f b6 17             	movzbl (%edi),%edx
+  802771:	8d 42 dd             	lea    -0x23(%edx),%eax
+  802774:	3c 55                	cmp    $0x55,%al
+  802776:	0f 87 cf 03 00 00    	ja     802b4b <vprintfmt+0x437>
+  80277c:	0f b6 c0             	movzbl %al,%eax
+  80277f:	ff 24 85 80 3a 80 00 	jmp    *0x803a80(,%eax,4)
+  802786:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  802789:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80278d:	eb d9                	jmp    802768 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80278f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802792:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  802796:	eb d0                	jmp    802768 <vprintfmt+0x54>
+  802798:	0f b6 d2             	movzbl %dl,%edx
+  80279b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80279e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8027a6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8027a9:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8027ad:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8027b0:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8027b3:	83 f9 09             	cmp    $0x9,%ecx
+  8027b6:	77 55                	ja     80280d <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8027b8:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8027bb:	eb e9                	jmp    8027a6 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8027bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027c0:	8b 00                	mov    (%eax),%eax
+  8027c2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8027c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8027cb:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8027d1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8027d5:	79 91                	jns    802768 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8027d7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8027da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8027dd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8027e4:	eb 82                	jmp    802768 <vprintfmt+0x54>
+			if (width < 0)
+  8027e6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8027e9:	85 d2                	test   %edx,%edx
+  8027eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f0:	0f 49 c2             	cmovns %edx,%eax
+  8027f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8027f9:	e9 6a ff ff ff       	jmp    802768 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8027fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  802801:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  802808:	e9 5b ff ff ff       	jmp    802768 <vprintfmt+0x54>
+  80280d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802810:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802813:	eb bc                	jmp    8027d1 <vprintfmt+0xbd>
+			lflag++;
+  802815:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  802818:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80281b:	e9 48 ff ff ff       	jmp    802768 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  802820:	8b 45 14             	mov    0x14(%ebp),%eax
+  802823:	8d 78 04             	lea    0x4(%eax),%edi
+  802826:	83 ec 08             	sub    $0x8,%esp
+  802829:	53                   	push   %ebx
+  80282a:	ff 30                	push   (%eax)
+  80282c:	ff d6                	call   *%esi
+			break;
+  80282e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802831:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  802834:	e9 b1 02 00 00       	jmp    802aea <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  802839:	8b 45 14             	mov    0x14(%ebp),%eax
+  80283c:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80283f:	8b 10                	mov    (%eax),%edx
+  802841:	89 d0                	mov    %edx,%eax
+  802843:	f7 d8                	neg    %eax
+  802845:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802848:	83 f8 11             	cmp    $0x11,%eax
+  80284b:	7f 23                	jg     802870 <vprintfmt+0x15c>
+  80284d:	8b 14 85 e0 3b 80 00 	mov    0x803be0(,%eax,4),%edx
+  802854:	85 d2                	test   %edx,%edx
+  802856:	74 18                	je     802870 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  802858:	52                   	push   %edx
+  802859:	68 56 38 80 00       	push   $0x803856
+  80285e:	53                   	push   %ebx
+  80285f:	56                   	push   %esi
+  802860:	e8 92 fe ff ff       	call   8026f7 <printfmt>
+  802865:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802868:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80286b:	e9 7a 02 00 00       	jmp    802aea <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  802870:	50                   	push   %eax
+  802871:	68 3b 39 80 00       	push   $0x80393b
+  802876:	53                   	push   %ebx
+  802877:	56                   	push   %esi
+  802878:	e8 7a fe ff ff       	call   8026f7 <printfmt>
+  80287d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802880:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802883:	e9 62 02 00 00       	jmp    802aea <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802888:	8b 45 14             	mov    0x14(%ebp),%eax
+  80288b:	83 c0 04             	add    $0x4,%eax
+  80288e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  802891:	8b 45 14             	mov    0x14(%ebp),%eax
+  802894:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  802896:	85 c9                	test   %ecx,%ecx
+  802898:	b8 34 39 80 00       	mov    $0x803934,%eax
+  80289d:	0f 45 c1             	cmovne %ecx,%eax
+  8028a0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8028a3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8028a7:	7e 06                	jle    8028af <vprintfmt+0x19b>
+  8028a9:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8028ad:	75 0b                	jne    8028ba <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028af:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8028b2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8028b5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028b8:	eb 5c                	jmp    802916 <vprintfmt+0x202>
+  8028ba:	83 ec 08             	sub    $0x8,%esp
+  8028bd:	ff 75 d0             	push   -0x30(%ebp)
+  8028c0:	ff 75 cc             	push   -0x34(%ebp)
+  8028c3:	e8 20 03 00 00       	call   802be8 <strnlen>
+  8028c8:	89 c2                	mov    %eax,%edx
+  8028ca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028cd:	29 d0                	sub    %edx,%eax
+  8028cf:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8028d2:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8028d6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028d9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028dc:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028de:	eb 0e                	jmp    8028ee <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8028e0:	83 ec 08             	sub    $0x8,%esp
+  8028e3:	53                   	push   %ebx
+  8028e4:	57                   	push   %edi
+  8028e5:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028e8:	83 ee 01             	sub    $0x1,%esi
+  8028eb:	83 c4 10             	add    $0x10,%esp
+  8028ee:	85 f6                	test   %esi,%esi
+  8028f0:	7f ee                	jg     8028e0 <vprintfmt+0x1cc>
+  8028f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028f8:	85 c0                	test   %eax,%eax
+  8028fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ff:	0f 49 d0             	cmovns %eax,%edx
+  802902:	29 d0                	sub    %edx,%eax
+  802904:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802907:	eb a6                	jmp    8028af <vprintfmt+0x19b>
+					putch(ch, putdat);
+  802909:	83 ec 08             	sub    $0x8,%esp
+  80290c:	53                   	push   %ebx
+  80290d:	52                   	push   %edx
+  80290e:	ff 55 08             	call   *0x8(%ebp)
+  802911:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802914:	89 f1                	mov    %esi,%ecx
+  802916:	8d 71 01             	lea    0x1(%ecx),%esi
+  802919:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80291d:	0f be d0             	movsbl %al,%edx
+  802920:	85 d2                	test   %edx,%edx
+  802922:	74 28                	je     80294c <vprintfmt+0x238>
+  802924:	85 ff                	test   %edi,%edi
+  802926:	78 05                	js     80292d <vprintfmt+0x219>
+  802928:	83 ef 01             	sub    $0x1,%edi
+  80292b:	78 30                	js     80295d <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80292d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802931:	74 d6                	je     802909 <vprintfmt+0x1f5>
+  802933:	0f be c0             	movsbl %al,%eax
+  802936:	83 e8 20             	sub    $0x20,%eax
+  802939:	83 f8 5e             	cmp    $0x5e,%eax
+  80293c:	76 cb                	jbe    802909 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80293e:	83 ec 08             	sub    $0x8,%esp
+  802941:	53                   	push   %ebx
+  802942:	6a 3f                	push   $0x3f
+  802944:	ff 55 08             	call   *0x8(%ebp)
+  802947:	83 c4 10             	add    $0x10,%esp
+  80294a:	eb c8                	jmp    802914 <vprintfmt+0x200>
+  80294c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80294f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802952:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802955:	01 d0                	add    %edx,%eax
+  802957:	29 c8                	sub    %ecx,%eax
+  802959:	89 c7                	mov    %eax,%edi
+  80295b:	eb 13                	jmp    802970 <vprintfmt+0x25c>
+  80295d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802960:	eb ed                	jmp    80294f <vprintfmt+0x23b>
+				putch(' ', putdat);
+  802962:	83 ec 08             	sub    $0x8,%esp
+  802965:	53                   	push   %ebx
+  802966:	6a 20                	push   $0x20
+  802968:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80296a:	83 ef 01             	sub    $0x1,%edi
+  80296d:	83 c4 10             	add    $0x10,%esp
+  802970:	85 ff                	test   %edi,%edi
+  802972:	7f ee                	jg     802962 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802974:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  802977:	89 45 14             	mov    %eax,0x14(%ebp)
+  80297a:	e9 6b 01 00 00       	jmp    802aea <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80297f:	83 f9 01             	cmp    $0x1,%ecx
+  802982:	7f 1f                	jg     8029a3 <vprintfmt+0x28f>
+	else if (lflag)
+  802984:	85 c9                	test   %ecx,%ecx
+  802986:	74 67                	je     8029ef <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  802988:	8b 45 14             	mov    0x14(%ebp),%eax
+  80298b:	8b 00                	mov    (%eax),%eax
+  80298d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802990:	89 c1                	mov    %eax,%ecx
+  802992:	c1 f9 1f             	sar    $0x1f,%ecx
+  802995:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802998:	8b 45 14             	mov    0x14(%ebp),%eax
+  80299b:	8d 40 04             	lea    0x4(%eax),%eax
+  80299e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8029a1:	eb 17                	jmp    8029ba <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8029a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029a6:	8b 50 04             	mov    0x4(%eax),%edx
+  8029a9:	8b 00                	mov    (%eax),%eax
+  8029ab:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029ae:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8029b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029b4:	8d 40 08             	lea    0x8(%eax),%eax
+  8029b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8029ba:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029bd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8029c0:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8029c5:	85 c9                	test   %ecx,%ecx
+  8029c7:	0f 89 03 01 00 00    	jns    802ad0 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8029cd:	83 ec 08             	sub    $0x8,%esp
+  8029d0:	53                   	push   %ebx
+  8029d1:	6a 2d                	push   $0x2d
+  8029d3:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8029d5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029d8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8029db:	f7 da                	neg    %edx
+  8029dd:	83 d1 00             	adc    $0x0,%ecx
+  8029e0:	f7 d9                	neg    %ecx
+  8029e2:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8029e5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029ea:	e9 e1 00 00 00       	jmp    802ad0 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8029ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029f2:	8b 00                	mov    (%eax),%eax
+  8029f4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029f7:	89 c1                	mov    %eax,%ecx
+  8029f9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8029fc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8029ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a02:	8d 40 04             	lea    0x4(%eax),%eax
+  802a05:	89 45 14             	mov    %eax,0x14(%ebp)
+  802a08:	eb b0                	jmp    8029ba <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  802a0a:	83 f9 01             	cmp    $0x1,%ecx
+  802a0d:	7f 1e                	jg     802a2d <vprintfmt+0x319>
+	else if (lflag)
+  802a0f:	85 c9                	test   %ecx,%ecx
+  802a11:	74 32                	je     802a45 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802a13:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a16:	8b 10                	mov    (%eax),%edx
+  802a18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a1d:	8d 40 04             	lea    0x4(%eax),%eax
+  802a20:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a23:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  802a28:	e9 a3 00 00 00       	jmp    802ad0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a30:	8b 10                	mov    (%eax),%edx
+  802a32:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a35:	8d 40 08             	lea    0x8(%eax),%eax
+  802a38:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a3b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  802a40:	e9 8b 00 00 00       	jmp    802ad0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a45:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a48:	8b 10                	mov    (%eax),%edx
+  802a4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a4f:	8d 40 04             	lea    0x4(%eax),%eax
+  802a52:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a55:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  802a5a:	eb 74                	jmp    802ad0 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  802a5c:	83 f9 01             	cmp    $0x1,%ecx
+  802a5f:	7f 1b                	jg     802a7c <vprintfmt+0x368>
+	else if (lflag)
+  802a61:	85 c9                	test   %ecx,%ecx
+  802a63:	74 2c                	je     802a91 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  802a65:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a68:	8b 10                	mov    (%eax),%edx
+  802a6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a6f:	8d 40 04             	lea    0x4(%eax),%eax
+  802a72:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a75:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  802a7a:	eb 54                	jmp    802ad0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a7c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a7f:	8b 10                	mov    (%eax),%edx
+  802a81:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a84:	8d 40 08             	lea    0x8(%eax),%eax
+  802a87:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a8a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  802a8f:	eb 3f                	jmp    802ad0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a91:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a94:	8b 10                	mov    (%eax),%edx
+  802a96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a9b:	8d 40 04             	lea    0x4(%eax),%eax
+  802a9e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802aa1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802aa6:	eb 28                	jmp    802ad0 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  802aa8:	83 ec 08             	sub    $0x8,%esp
+  802aab:	53                   	push   %ebx
+  802aac:	6a 30                	push   $0x30
+  802aae:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802ab0:	83 c4 08             	add    $0x8,%esp
+  802ab3:	53                   	push   %ebx
+  802ab4:	6a 78                	push   $0x78
+  802ab6:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802ab8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802abb:	8b 10                	mov    (%eax),%edx
+  802abd:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802ac2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802ac5:	8d 40 04             	lea    0x4(%eax),%eax
+  802ac8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802acb:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802ad0:	83 ec 0c             	sub    $0xc,%esp
+  802ad3:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802ad7:	50                   	push   %eax
+  802ad8:	ff 75 e0             	push   -0x20(%ebp)
+  802adb:	57                   	push   %edi
+  802adc:	51                   	push   %ecx
+  802add:	52                   	push   %edx
+  802ade:	89 da                	mov    %ebx,%edx
+  802ae0:	89 f0                	mov    %esi,%eax
+  802ae2:	e8 4a fb ff ff       	call   802631 <printnum>
+			break;
+  802ae7:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802aea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802aed:	e9 40 fc ff ff       	jmp    802732 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802af2:	83 f9 01             	cmp    $0x1,%ecx
+  802af5:	7f 1b                	jg     802b12 <vprintfmt+0x3fe>
+	else if (lflag)
+  802af7:	85 c9                	test   %ecx,%ecx
+  802af9:	74 2c                	je     802b27 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802afb:	8b 45 14             	mov    0x14(%ebp),%eax
+  802afe:	8b 10                	mov    (%eax),%edx
+  802b00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b05:	8d 40 04             	lea    0x4(%eax),%eax
+  802b08:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b0b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802b10:	eb be                	jmp    802ad0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802b12:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b15:	8b 10                	mov    (%eax),%edx
+  802b17:	8b 48 04             	mov    0x4(%eax),%ecx
+  802b1a:	8d 40 08             	lea    0x8(%eax),%eax
+  802b1d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b20:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802b25:	eb a9                	jmp    802ad0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802b27:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b2a:	8b 10                	mov    (%eax),%edx
+  802b2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b31:	8d 40 04             	lea    0x4(%eax),%eax
+  802b34:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b37:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  802b3c:	eb 92                	jmp    802ad0 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  802b3e:	83 ec 08             	sub    $0x8,%esp
+  802b41:	53                   	push   %ebx
+  802b42:	6a 25                	push   $0x25
+  802b44:	ff d6                	call   *%esi
+			break;
+  802b46:	83 c4 10             	add    $0x10,%esp
+  802b49:	eb 9f                	jmp    802aea <vprintfmt+0x3d6>
+			putch('%', putdat);
+  802b4b:	83 ec 08             	sub    $0x8,%esp
+  802b4e:	53                   	push   %ebx
+  802b4f:	6a 25                	push   $0x25
+  802b51:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802b53:	83 c4 10             	add    $0x10,%esp
+  802b56:	89 f8                	mov    %edi,%eax
+  802b58:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802b5c:	74 05                	je     802b63 <vprintfmt+0x44f>
+  802b5e:	83 e8 01             	sub    $0x1,%eax
+  802b61:	eb f5                	jmp    802b58 <vprintfmt+0x444>
+  802b63:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b66:	eb 82                	jmp    802aea <vprintfmt+0x3d6>
+
+00802b68 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802b68:	55                   	push   %ebp
+  802b69:	89 e5                	mov    %esp,%ebp
+  802b6b:	83 ec 18             	sub    $0x18,%esp
+  802b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b71:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  802b74:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802b77:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802b7b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802b7e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802b85:	85 c0                	test   %eax,%eax
+  802b87:	74 26                	je     802baf <vsnprintf+0x47>
+  802b89:	85 d2                	test   %edx,%edx
+  802b8b:	7e 22                	jle    802baf <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  802b8d:	ff 75 14             	push   0x14(%ebp)
+  802b90:	ff 75 10             	push   0x10(%ebp)
+  802b93:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802b96:	50                   	push   %eax
+  802b97:	68 da 26 80 00       	push   $0x8026da
+  802b9c:	e8 73 fb ff ff       	call   802714 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802ba1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802ba4:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802ba7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802baa:	83 c4 10             	add    $0x10,%esp
+}
+  802bad:	c9                   	leave
+  802bae:	c3                   	ret
+		return -E_INVAL;
+  802baf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bb4:	eb f7                	jmp    802bad <vsnprintf+0x45>
+
+00802bb6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802bb6:	55                   	push   %ebp
+  802bb7:	89 e5                	mov    %esp,%ebp
+  802bb9:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  802bbc:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802bbf:	50                   	push   %eax
+  802bc0:	ff 75 10             	push   0x10(%ebp)
+  802bc3:	ff 75 0c             	push   0xc(%ebp)
+  802bc6:	ff 75 08             	push   0x8(%ebp)
+  802bc9:	e8 9a ff ff ff       	call   802b68 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802bce:	c9                   	leave
+  802bcf:	c3                   	ret
+
+00802bd0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802bd0:	55                   	push   %ebp
+  802bd1:	89 e5                	mov    %esp,%ebp
+  802bd3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bdb:	eb 03                	jmp    802be0 <strlen+0x10>
+		n++;
+  802bdd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802be0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802be4:	75 f7                	jne    802bdd <strlen+0xd>
+	return n;
+}
+  802be6:	5d                   	pop    %ebp
+  802be7:	c3                   	ret
+
+00802be8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802be8:	55                   	push   %ebp
+  802be9:	89 e5                	mov    %esp,%ebp
+  802beb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802bee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf6:	eb 03                	jmp    802bfb <strnlen+0x13>
+		n++;
+  802bf8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802bfb:	39 d0                	cmp    %edx,%eax
+  802bfd:	74 08                	je     802c07 <strnlen+0x1f>
+  802bff:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802c03:	75 f3                	jne    802bf8 <strnlen+0x10>
+  802c05:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802c07:	89 d0                	mov    %edx,%eax
+  802c09:	5d                   	pop    %ebp
+  802c0a:	c3                   	ret
+
+00802c0b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802c0b:	55                   	push   %ebp
+  802c0c:	89 e5                	mov    %esp,%ebp
+  802c0e:	53                   	push   %ebx
+  802c0f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c12:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802c1e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802c21:	83 c0 01             	add    $0x1,%eax
+  802c24:	84 d2                	test   %dl,%dl
+  802c26:	75 f2                	jne    802c1a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  802c28:	89 c8                	mov    %ecx,%eax
+  802c2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c2d:	c9                   	leave
+  802c2e:	c3                   	ret
+
+00802c2f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802c2f:	55                   	push   %ebp
+  802c30:	89 e5                	mov    %esp,%ebp
+  802c32:	53                   	push   %ebx
+  802c33:	83 ec 10             	sub    $0x10,%esp
+  802c36:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  802c39:	53                   	push   %ebx
+  802c3a:	e8 91 ff ff ff       	call   802bd0 <strlen>
+  802c3f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  802c42:	ff 75 0c             	push   0xc(%ebp)
+  802c45:	01 d8                	add    %ebx,%eax
+  802c47:	50                   	push   %eax
+  802c48:	e8 be ff ff ff       	call   802c0b <strcpy>
+	return dst;
+}
+  802c4d:	89 d8                	mov    %ebx,%eax
+  802c4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c52:	c9                   	leave
+  802c53:	c3                   	ret
+
+00802c54 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802c54:	55                   	push   %ebp
+  802c55:	89 e5                	mov    %esp,%ebp
+  802c57:	56                   	push   %esi
+  802c58:	53                   	push   %ebx
+  802c59:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  802c5f:	89 f3                	mov    %esi,%ebx
+  802c61:	03 5d 10             	add    0x10(%ebp),%ebx
+  802c64:	89 f0                	mov    %esi,%eax
+  802c66:	eb 0f                	jmp    802c77 <strncpy+0x23>
+		*dst++ = *src;
+  802c68:	83 c0 01             	add    $0x1,%eax
+  802c6b:	0f b6 0a             	movzbl (%edx),%ecx
+  802c6e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  802c71:	80 f9 01             	cmp    $0x1,%cl
+  802c74:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  802c77:	39 d8                	cmp    %ebx,%eax
+  802c79:	75 ed                	jne    802c68 <strncpy+0x14>
+	}
+	return ret;
+}
+  802c7b:	89 f0                	mov    %esi,%eax
+  802c7d:	5b                   	pop    %ebx
+  802c7e:	5e                   	pop    %esi
+  802c7f:	5d                   	pop    %ebp
+  802c80:	c3                   	ret
+
+00802c81 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802c81:	55                   	push   %ebp
+  802c82:	89 e5                	mov    %esp,%ebp
+  802c84:	56                   	push   %esi
+  802c85:	53                   	push   %ebx
+  802c86:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c8c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  802c8f:	89 f0                	mov    %esi,%eax
+  802c91:	85 d2                	test   %edx,%edx
+  802c93:	74 21                	je     802cb6 <strlcpy+0x35>
+  802c95:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  802c99:	89 f2                	mov    %esi,%edx
+  802c9b:	eb 09                	jmp    802ca6 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  802c9d:	83 c1 01             	add    $0x1,%ecx
+  802ca0:	83 c2 01             	add    $0x1,%edx
+  802ca3:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  802ca6:	39 c2                	cmp    %eax,%edx
+  802ca8:	74 09                	je     802cb3 <strlcpy+0x32>
+  802caa:	0f b6 19             	movzbl (%ecx),%ebx
+  802cad:	84 db                	test   %bl,%bl
+  802caf:	75 ec                	jne    802c9d <strlcpy+0x1c>
+  802cb1:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802cb3:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802cb6:	29 f0                	sub    %esi,%eax
+}
+  802cb8:	5b                   	pop    %ebx
+  802cb9:	5e                   	pop    %esi
+  802cba:	5d                   	pop    %ebp
+  802cbb:	c3                   	ret
+
+00802cbc <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802cbc:	55                   	push   %ebp
+  802cbd:	89 e5                	mov    %esp,%ebp
+  802cbf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802cc2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802cc5:	eb 06                	jmp    802ccd <strcmp+0x11>
+		p++, q++;
+  802cc7:	83 c1 01             	add    $0x1,%ecx
+  802cca:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802ccd:	0f b6 01             	movzbl (%ecx),%eax
+  802cd0:	84 c0                	test   %al,%al
+  802cd2:	74 04                	je     802cd8 <strcmp+0x1c>
+  802cd4:	3a 02                	cmp    (%edx),%al
+  802cd6:	74 ef                	je     802cc7 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802cd8:	0f b6 c0             	movzbl %al,%eax
+  802cdb:	0f b6 12             	movzbl (%edx),%edx
+  802cde:	29 d0                	sub    %edx,%eax
+}
+  802ce0:	5d                   	pop    %ebp
+  802ce1:	c3                   	ret
+
+00802ce2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802ce2:	55                   	push   %ebp
+  802ce3:	89 e5                	mov    %esp,%ebp
+  802ce5:	53                   	push   %ebx
+  802ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cec:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802cef:	eb 09                	jmp    802cfa <strncmp+0x18>
+		n--, p++, q++;
+  802cf1:	83 ea 01             	sub    $0x1,%edx
+  802cf4:	83 c0 01             	add    $0x1,%eax
+  802cf7:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802cfa:	85 d2                	test   %edx,%edx
+  802cfc:	74 18                	je     802d16 <strncmp+0x34>
+  802cfe:	0f b6 18             	movzbl (%eax),%ebx
+  802d01:	84 db                	test   %bl,%bl
+  802d03:	74 04                	je     802d09 <strncmp+0x27>
+  802d05:	3a 19                	cmp    (%ecx),%bl
+  802d07:	74 e8                	je     802cf1 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802d09:	0f b6 00             	movzbl (%eax),%eax
+  802d0c:	0f b6 11             	movzbl (%ecx),%edx
+  802d0f:	29 d0                	sub    %edx,%eax
+}
+  802d11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d14:	c9                   	leave
+  802d15:	c3                   	ret
+		return 0;
+  802d16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1b:	eb f4                	jmp    802d11 <strncmp+0x2f>
+
+00802d1d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802d1d:	55                   	push   %ebp
+  802d1e:	89 e5                	mov    %esp,%ebp
+  802d20:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d23:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d27:	eb 03                	jmp    802d2c <strchr+0xf>
+  802d29:	83 c0 01             	add    $0x1,%eax
+  802d2c:	0f b6 10             	movzbl (%eax),%edx
+  802d2f:	84 d2                	test   %dl,%dl
+  802d31:	74 06                	je     802d39 <strchr+0x1c>
+		if (*s == c)
+  802d33:	38 ca                	cmp    %cl,%dl
+  802d35:	75 f2                	jne    802d29 <strchr+0xc>
+  802d37:	eb 05                	jmp    802d3e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  802d39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d3e:	5d                   	pop    %ebp
+  802d3f:	c3                   	ret
+
+00802d40 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802d40:	55                   	push   %ebp
+  802d41:	89 e5                	mov    %esp,%ebp
+  802d43:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d46:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d4a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  802d4d:	38 ca                	cmp    %cl,%dl
+  802d4f:	74 09                	je     802d5a <strfind+0x1a>
+  802d51:	84 d2                	test   %dl,%dl
+  802d53:	74 05                	je     802d5a <strfind+0x1a>
+	for (; *s; s++)
+  802d55:	83 c0 01             	add    $0x1,%eax
+  802d58:	eb f0                	jmp    802d4a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  802d5a:	5d                   	pop    %ebp
+  802d5b:	c3                   	ret
+
+00802d5c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802d5c:	55                   	push   %ebp
+  802d5d:	89 e5                	mov    %esp,%ebp
+  802d5f:	57                   	push   %edi
+  802d60:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d63:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  802d66:	85 c9                	test   %ecx,%ecx
+  802d68:	74 20                	je     802d8a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  802d6a:	89 f8                	mov    %edi,%eax
+  802d6c:	09 c8                	or     %ecx,%eax
+  802d6e:	a8 03                	test   $0x3,%al
+  802d70:	75 12                	jne    802d84 <memset+0x28>
+		c &= 0xFF;
+  802d72:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802d76:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  802d7c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  802d7f:	fc                   	cld
+  802d80:	f3 ab                	rep stos %eax,%es:(%edi)
+  802d82:	eb 06                	jmp    802d8a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  802d84:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d87:	fc                   	cld
+  802d88:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  802d8a:	89 f8                	mov    %edi,%eax
+  802d8c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802d8f:	c9                   	leave
+  802d90:	c3                   	ret
+
+00802d91 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  802d91:	55                   	push   %ebp
+  802d92:	89 e5                	mov    %esp,%ebp
+  802d94:	57                   	push   %edi
+  802d95:	56                   	push   %esi
+  802d96:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d99:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d9c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  802d9f:	39 c6                	cmp    %eax,%esi
+  802da1:	73 32                	jae    802dd5 <memmove+0x44>
+  802da3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802da6:	39 d0                	cmp    %edx,%eax
+  802da8:	73 2b                	jae    802dd5 <memmove+0x44>
+		s += n;
+		d += n;
+  802daa:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802dad:	89 d6                	mov    %edx,%esi
+  802daf:	09 fe                	or     %edi,%esi
+  802db1:	09 ce                	or     %ecx,%esi
+  802db3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802db9:	75 0e                	jne    802dc9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802dbb:	83 ef 04             	sub    $0x4,%edi
+  802dbe:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802dc1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802dc4:	fd                   	std
+  802dc5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802dc7:	eb 09                	jmp    802dd2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802dc9:	83 ef 01             	sub    $0x1,%edi
+  802dcc:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802dcf:	fd                   	std
+  802dd0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802dd2:	fc                   	cld
+  802dd3:	eb 1a                	jmp    802def <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802dd5:	89 f2                	mov    %esi,%edx
+  802dd7:	09 c2                	or     %eax,%edx
+  802dd9:	09 ca                	or     %ecx,%edx
+  802ddb:	f6 c2 03             	test   $0x3,%dl
+  802dde:	75 0a                	jne    802dea <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802de0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802de3:	89 c7                	mov    %eax,%edi
+  802de5:	fc                   	cld
+  802de6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802de8:	eb 05                	jmp    802def <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802dea:	89 c7                	mov    %eax,%edi
+  802dec:	fc                   	cld
+  802ded:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802def:	5e                   	pop    %esi
+  802df0:	5f                   	pop    %edi
+  802df1:	5d                   	pop    %ebp
+  802df2:	c3                   	ret
+
+00802df3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802df3:	55                   	push   %ebp
+  802df4:	89 e5                	mov    %esp,%ebp
+  802df6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802df9:	ff 75 10             	push   0x10(%ebp)
+  802dfc:	ff 75 0c             	push   0xc(%ebp)
+  802dff:	ff 75 08             	push   0x8(%ebp)
+  802e02:	e8 8a ff ff ff       	call   802d91 <memmove>
+}
+  802e07:	c9                   	leave
+  802e08:	c3                   	ret
+
+00802e09 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802e09:	55                   	push   %ebp
+  802e0a:	89 e5                	mov    %esp,%ebp
+  802e0c:	56                   	push   %esi
+  802e0d:	53                   	push   %ebx
+  802e0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e11:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802e14:	89 c6                	mov    %eax,%esi
+  802e16:	03 75 10             	add    0x10(%ebp),%esi
+  802e19:	eb 06                	jmp    802e21 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802e1b:	83 c0 01             	add    $0x1,%eax
+  802e1e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802e21:	39 f0                	cmp    %esi,%eax
+  802e23:	74 14                	je     802e39 <memcmp+0x30>
+		if (*s1 != *s2)
+  802e25:	0f b6 08             	movzbl (%eax),%ecx
+  802e28:	0f b6 1a             	movzbl (%edx),%ebx
+  802e2b:	38 d9                	cmp    %bl,%cl
+  802e2d:	74 ec                	je     802e1b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802e2f:	0f b6 c1             	movzbl %cl,%eax
+  802e32:	0f b6 db             	movzbl %bl,%ebx
+  802e35:	29 d8                	sub    %ebx,%eax
+  802e37:	eb 05                	jmp    802e3e <memcmp+0x35>
+	}
+
+	return 0;
+  802e39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e3e:	5b                   	pop    %ebx
+  802e3f:	5e                   	pop    %esi
+  802e40:	5d                   	pop    %ebp
+  802e41:	c3                   	ret
+
+00802e42 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802e42:	55                   	push   %ebp
+  802e43:	89 e5                	mov    %esp,%ebp
+  802e45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802e4b:	89 c2                	mov    %eax,%edx
+  802e4d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802e50:	eb 03                	jmp    802e55 <memfind+0x13>
+  802e52:	83 c0 01             	add    $0x1,%eax
+  802e55:	39 d0                	cmp    %edx,%eax
+  802e57:	73 04                	jae    802e5d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802e59:	38 08                	cmp    %cl,(%eax)
+  802e5b:	75 f5                	jne    802e52 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802e5d:	5d                   	pop    %ebp
+  802e5e:	c3                   	ret
+
+00802e5f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802e5f:	55                   	push   %ebp
+  802e60:	89 e5                	mov    %esp,%ebp
+  802e62:	57                   	push   %edi
+  802e63:	56                   	push   %esi
+  802e64:	53                   	push   %ebx
+  802e65:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802e6b:	eb 03                	jmp    802e70 <strtol+0x11>
+		s++;
+  802e6d:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802e70:	0f b6 02             	movzbl (%edx),%eax
+  802e73:	3c 20                	cmp    $0x20,%al
+  802e75:	74 f6                	je     802e6d <strtol+0xe>
+  802e77:	3c 09                	cmp    $0x9,%al
+  802e79:	74 f2                	je     802e6d <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802e7b:	3c 2b                	cmp    $0x2b,%al
+  802e7d:	74 2a                	je     802ea9 <strtol+0x4a>
+	int neg = 0;
+  802e7f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802e84:	3c 2d                	cmp    $0x2d,%al
+  802e86:	74 2b                	je     802eb3 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802e88:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802e8e:	75 0f                	jne    802e9f <strtol+0x40>
+  802e90:	80 3a 30             	cmpb   $0x30,(%edx)
+  802e93:	74 28                	je     802ebd <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802e95:	85 db                	test   %ebx,%ebx
+  802e97:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802e9c:	0f 44 d8             	cmove  %eax,%ebx
+  802e9f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ea4:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802ea7:	eb 46                	jmp    802eef <strtol+0x90>
+		s++;
+  802ea9:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802eac:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb1:	eb d5                	jmp    802e88 <strtol+0x29>
+		s++, neg = 1;
+  802eb3:	83 c2 01             	add    $0x1,%edx
+  802eb6:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ebb:	eb cb                	jmp    802e88 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802ebd:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802ec1:	74 0e                	je     802ed1 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802ec3:	85 db                	test   %ebx,%ebx
+  802ec5:	75 d8                	jne    802e9f <strtol+0x40>
+		s++, base = 8;
+  802ec7:	83 c2 01             	add    $0x1,%edx
+  802eca:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802ecf:	eb ce                	jmp    802e9f <strtol+0x40>
+		s += 2, base = 16;
+  802ed1:	83 c2 02             	add    $0x2,%edx
+  802ed4:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802ed9:	eb c4                	jmp    802e9f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802edb:	0f be c0             	movsbl %al,%eax
+  802ede:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802ee1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802ee4:	7d 3a                	jge    802f20 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802ee6:	83 c2 01             	add    $0x1,%edx
+  802ee9:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802eed:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802eef:	0f b6 02             	movzbl (%edx),%eax
+  802ef2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802ef5:	89 f3                	mov    %esi,%ebx
+  802ef7:	80 fb 09             	cmp    $0x9,%bl
+  802efa:	76 df                	jbe    802edb <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  802efc:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802eff:	89 f3                	mov    %esi,%ebx
+  802f01:	80 fb 19             	cmp    $0x19,%bl
+  802f04:	77 08                	ja     802f0e <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802f06:	0f be c0             	movsbl %al,%eax
+  802f09:	83 e8 57             	sub    $0x57,%eax
+  802f0c:	eb d3                	jmp    802ee1 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802f0e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802f11:	89 f3                	mov    %esi,%ebx
+  802f13:	80 fb 19             	cmp    $0x19,%bl
+  802f16:	77 08                	ja     802f20 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802f18:	0f be c0             	movsbl %al,%eax
+  802f1b:	83 e8 37             	sub    $0x37,%eax
+  802f1e:	eb c1                	jmp    802ee1 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802f20:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802f24:	74 05                	je     802f2b <strtol+0xcc>
+		*endptr = (char *) s;
+  802f26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f29:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802f2b:	89 c8                	mov    %ecx,%eax
+  802f2d:	f7 d8                	neg    %eax
+  802f2f:	85 ff                	test   %edi,%edi
+  802f31:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802f34:	89 c8                	mov    %ecx,%eax
+  802f36:	5b                   	pop    %ebx
+  802f37:	5e                   	pop    %esi
+  802f38:	5f                   	pop    %edi
+  802f39:	5d                   	pop    %ebp
+  802f3a:	c3                   	ret
+
+00802f3b <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802f3b:	55                   	push   %ebp
+  802f3c:	89 e5                	mov    %esp,%ebp
+  802f3e:	57                   	push   %edi
+  802f3f:	56                   	push   %esi
+  802f40:	53                   	push   %ebx
+  802f41:	83 ec 20             	sub    $0x20,%esp
+  802f44:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f47:	89 d7                	mov    %edx,%edi
+  802f49:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802f4b:	51                   	push   %ecx
+  802f4c:	68 00 f0 7f 00       	push   $0x7ff000
+  802f51:	6a 00                	push   $0x0
+  802f53:	e8 2e d2 ff ff       	call   800186 <sys_page_alloc>
+  802f58:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f5a:	83 c4 10             	add    $0x10,%esp
+  802f5d:	85 c0                	test   %eax,%eax
+  802f5f:	78 45                	js     802fa6 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802f61:	83 ec 04             	sub    $0x4,%esp
+  802f64:	68 00 10 00 00       	push   $0x1000
+  802f69:	57                   	push   %edi
+  802f6a:	68 00 f0 7f 00       	push   $0x7ff000
+  802f6f:	e8 1d fe ff ff       	call   802d91 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  802f74:	89 34 24             	mov    %esi,(%esp)
+  802f77:	57                   	push   %edi
+  802f78:	ff 75 e4             	push   -0x1c(%ebp)
+  802f7b:	68 00 f0 7f 00       	push   $0x7ff000
+  802f80:	6a 00                	push   $0x0
+  802f82:	e8 4a d2 ff ff       	call   8001d1 <sys_page_map>
+  802f87:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f89:	83 c4 20             	add    $0x20,%esp
+  802f8c:	85 c0                	test   %eax,%eax
+  802f8e:	78 16                	js     802fa6 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802f90:	83 ec 08             	sub    $0x8,%esp
+  802f93:	68 00 f0 7f 00       	push   $0x7ff000
+  802f98:	6a 00                	push   $0x0
+  802f9a:	e8 74 d2 ff ff       	call   800213 <sys_page_unmap>
+  802f9f:	83 c4 10             	add    $0x10,%esp
+  802fa2:	85 c0                	test   %eax,%eax
+  802fa4:	75 0a                	jne    802fb0 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  802fa6:	89 d8                	mov    %ebx,%eax
+  802fa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fab:	5b                   	pop    %ebx
+  802fac:	5e                   	pop    %esi
+  802fad:	5f                   	pop    %edi
+  802fae:	5d                   	pop    %ebp
+  802faf:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802fb0:	68 48 3c 80 00       	push   $0x803c48
+  802fb5:	68 44 38 80 00       	push   $0x803844
+  802fba:	6a 1b                	push   $0x1b
+  802fbc:	68 c0 3c 80 00       	push   $0x803cc0
+  802fc1:	e8 7c f5 ff ff       	call   802542 <_panic>
+
+00802fc6 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802fc6:	55                   	push   %ebp
+  802fc7:	89 e5                	mov    %esp,%ebp
+  802fc9:	53                   	push   %ebx
+  802fca:	83 ec 04             	sub    $0x4,%esp
+  802fcd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  802fd0:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802fd2:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  802fd6:	74 21                	je     802ff9 <pgfault+0x33>
+  802fd8:	89 d0                	mov    %edx,%eax
+  802fda:	c1 e8 16             	shr    $0x16,%eax
+  802fdd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802fe4:	a8 01                	test   $0x1,%al
+  802fe6:	74 11                	je     802ff9 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  802fe8:	89 d0                	mov    %edx,%eax
+  802fea:	c1 e8 0c             	shr    $0xc,%eax
+  802fed:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802ff4:	f6 c4 08             	test   $0x8,%ah
+  802ff7:	75 17                	jne    803010 <pgfault+0x4a>
+		if (pgfault_next) {
+  802ff9:	a1 04 90 80 00       	mov    0x809004,%eax
+  802ffe:	85 c0                	test   %eax,%eax
+  803000:	74 27                	je     803029 <pgfault+0x63>
+			pgfault_next(utf);
+  803002:	83 ec 0c             	sub    $0xc,%esp
+  803005:	53                   	push   %ebx
+  803006:	ff d0                	call   *%eax
+			return;
+  803008:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  80300b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80300e:	c9                   	leave
+  80300f:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803010:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803016:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80301b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803020:	e8 16 ff ff ff       	call   802f3b <copy_page_to>
+  803025:	85 c0                	test   %eax,%eax
+  803027:	79 e2                	jns    80300b <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803029:	a1 00 50 80 00       	mov    0x805000,%eax
+  80302e:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803031:	ff 73 28             	push   0x28(%ebx)
+  803034:	ff 33                	push   (%ebx)
+  803036:	50                   	push   %eax
+  803037:	68 6c 3c 80 00       	push   $0x803c6c
+  80303c:	e8 dc f5 ff ff       	call   80261d <cprintf>
+	sys_env_destroy(0);
+  803041:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803048:	e8 aa d0 ff ff       	call   8000f7 <sys_env_destroy>
+  80304d:	83 c4 10             	add    $0x10,%esp
+  803050:	eb b9                	jmp    80300b <pgfault+0x45>
+
+00803052 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803052:	55                   	push   %ebp
+  803053:	89 e5                	mov    %esp,%ebp
+  803055:	53                   	push   %ebx
+  803056:	83 ec 04             	sub    $0x4,%esp
+  803059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80305c:	a1 08 90 80 00       	mov    0x809008,%eax
+  803061:	3d c6 2f 80 00       	cmp    $0x802fc6,%eax
+  803066:	74 15                	je     80307d <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803068:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  80306d:	83 ec 0c             	sub    $0xc,%esp
+  803070:	68 c6 2f 80 00       	push   $0x802fc6
+  803075:	e8 fb 03 00 00       	call   803475 <set_pgfault_handler>
+  80307a:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80307d:	83 ec 0c             	sub    $0xc,%esp
+  803080:	68 05 08 00 00       	push   $0x805
+  803085:	53                   	push   %ebx
+  803086:	6a 00                	push   $0x0
+  803088:	53                   	push   %ebx
+  803089:	6a 00                	push   $0x0
+  80308b:	e8 41 d1 ff ff       	call   8001d1 <sys_page_map>
+}
+  803090:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803093:	c9                   	leave
+  803094:	c3                   	ret
+
+00803095 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803095:	55                   	push   %ebp
+  803096:	89 e5                	mov    %esp,%ebp
+  803098:	57                   	push   %edi
+  803099:	56                   	push   %esi
+  80309a:	53                   	push   %ebx
+  80309b:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80309e:	68 c6 2f 80 00       	push   $0x802fc6
+  8030a3:	e8 cd 03 00 00       	call   803475 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8030a8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030ad:	cd 30                	int    $0x30
+  8030af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8030b5:	83 c4 10             	add    $0x10,%esp
+  8030b8:	85 c0                	test   %eax,%eax
+  8030ba:	0f 88 6b 01 00 00    	js     80322b <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8030c5:	75 37                	jne    8030fe <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8030c7:	e8 74 d0 ff ff       	call   800140 <sys_getenvid>
+  8030cc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030d1:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8030d7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8030dc:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8030e1:	e9 45 01 00 00       	jmp    80322b <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8030e6:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030ec:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8030f2:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8030f8:	0f 87 ba 00 00 00    	ja     8031b8 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8030fe:	89 d8                	mov    %ebx,%eax
+  803100:	c1 e8 16             	shr    $0x16,%eax
+  803103:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80310a:	a8 01                	test   $0x1,%al
+  80310c:	74 d8                	je     8030e6 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  80310e:	89 d8                	mov    %ebx,%eax
+  803110:	c1 e8 0c             	shr    $0xc,%eax
+  803113:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80311a:	f6 c2 01             	test   $0x1,%dl
+  80311d:	74 cd                	je     8030ec <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  80311f:	89 da                	mov    %ebx,%edx
+  803121:	80 e6 df             	and    $0xdf,%dh
+  803124:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  80312a:	74 c0                	je     8030ec <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  80312c:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80312e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803135:	f6 c6 04             	test   $0x4,%dh
+  803138:	75 53                	jne    80318d <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80313a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803141:	f6 c6 08             	test   $0x8,%dh
+  803144:	75 0c                	jne    803152 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803146:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80314d:	f6 c2 02             	test   $0x2,%dl
+  803150:	74 3b                	je     80318d <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803152:	83 ec 0c             	sub    $0xc,%esp
+  803155:	68 05 08 00 00       	push   $0x805
+  80315a:	57                   	push   %edi
+  80315b:	ff 75 e4             	push   -0x1c(%ebp)
+  80315e:	57                   	push   %edi
+  80315f:	6a 00                	push   $0x0
+  803161:	e8 6b d0 ff ff       	call   8001d1 <sys_page_map>
+  803166:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803168:	83 c4 20             	add    $0x20,%esp
+  80316b:	85 c0                	test   %eax,%eax
+  80316d:	0f 88 a7 00 00 00    	js     80321a <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803173:	83 ec 0c             	sub    $0xc,%esp
+  803176:	68 05 08 00 00       	push   $0x805
+  80317b:	57                   	push   %edi
+  80317c:	6a 00                	push   $0x0
+  80317e:	57                   	push   %edi
+  80317f:	6a 00                	push   $0x0
+  803181:	e8 4b d0 ff ff       	call   8001d1 <sys_page_map>
+  803186:	89 c6                	mov    %eax,%esi
+	return r;
+  803188:	83 c4 20             	add    $0x20,%esp
+  80318b:	eb 21                	jmp    8031ae <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  80318d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803194:	83 ec 0c             	sub    $0xc,%esp
+  803197:	25 07 0e 00 00       	and    $0xe07,%eax
+  80319c:	50                   	push   %eax
+  80319d:	57                   	push   %edi
+  80319e:	ff 75 e4             	push   -0x1c(%ebp)
+  8031a1:	57                   	push   %edi
+  8031a2:	6a 00                	push   $0x0
+  8031a4:	e8 28 d0 ff ff       	call   8001d1 <sys_page_map>
+  8031a9:	89 c6                	mov    %eax,%esi
+  8031ab:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8031ae:	85 f6                	test   %esi,%esi
+  8031b0:	0f 89 36 ff ff ff    	jns    8030ec <fork+0x57>
+  8031b6:	eb 62                	jmp    80321a <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031b8:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031bd:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8031c2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8031c5:	89 f8                	mov    %edi,%eax
+  8031c7:	e8 6f fd ff ff       	call   802f3b <copy_page_to>
+  8031cc:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031ce:	85 c0                	test   %eax,%eax
+  8031d0:	78 48                	js     80321a <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031d2:	83 ec 04             	sub    $0x4,%esp
+  8031d5:	6a 07                	push   $0x7
+  8031d7:	68 00 f0 bf ee       	push   $0xeebff000
+  8031dc:	57                   	push   %edi
+  8031dd:	e8 a4 cf ff ff       	call   800186 <sys_page_alloc>
+  8031e2:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031e4:	83 c4 10             	add    $0x10,%esp
+  8031e7:	85 c0                	test   %eax,%eax
+  8031e9:	78 2f                	js     80321a <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8031eb:	a1 00 50 80 00       	mov    0x805000,%eax
+  8031f0:	8b 40 64             	mov    0x64(%eax),%eax
+  8031f3:	83 ec 08             	sub    $0x8,%esp
+  8031f6:	50                   	push   %eax
+  8031f7:	57                   	push   %edi
+  8031f8:	e8 f4 d0 ff ff       	call   8002f1 <sys_env_set_pgfault_upcall>
+  8031fd:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031ff:	83 c4 10             	add    $0x10,%esp
+  803202:	85 c0                	test   %eax,%eax
+  803204:	78 14                	js     80321a <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803206:	83 ec 08             	sub    $0x8,%esp
+  803209:	6a 02                	push   $0x2
+  80320b:	57                   	push   %edi
+  80320c:	e8 4c d0 ff ff       	call   80025d <sys_env_set_status>
+  803211:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803213:	83 c4 10             	add    $0x10,%esp
+  803216:	85 c0                	test   %eax,%eax
+  803218:	79 11                	jns    80322b <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  80321a:	83 ec 0c             	sub    $0xc,%esp
+  80321d:	ff 75 e0             	push   -0x20(%ebp)
+  803220:	e8 d2 ce ff ff       	call   8000f7 <sys_env_destroy>
+	return r;
+  803225:	83 c4 10             	add    $0x10,%esp
+  803228:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  80322b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80322e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803231:	5b                   	pop    %ebx
+  803232:	5e                   	pop    %esi
+  803233:	5f                   	pop    %edi
+  803234:	5d                   	pop    %ebp
+  803235:	c3                   	ret
+
+00803236 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803236:	55                   	push   %ebp
+  803237:	89 e5                	mov    %esp,%ebp
+  803239:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80323c:	68 cb 3c 80 00       	push   $0x803ccb
+  803241:	68 bf 00 00 00       	push   $0xbf
+  803246:	68 c0 3c 80 00       	push   $0x803cc0
+  80324b:	e8 f2 f2 ff ff       	call   802542 <_panic>
+
+00803250 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803250:	55                   	push   %ebp
+  803251:	89 e5                	mov    %esp,%ebp
+  803253:	56                   	push   %esi
+  803254:	53                   	push   %ebx
+  803255:	8b 75 08             	mov    0x8(%ebp),%esi
+  803258:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80325b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80325e:	85 c0                	test   %eax,%eax
+  803260:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803265:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803268:	83 ec 0c             	sub    $0xc,%esp
+  80326b:	50                   	push   %eax
+  80326c:	e8 5d d1 ff ff       	call   8003ce <sys_ipc_recv>
+	if (from_env_store)
+  803271:	83 c4 10             	add    $0x10,%esp
+  803274:	85 f6                	test   %esi,%esi
+  803276:	74 14                	je     80328c <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803278:	ba 00 00 00 00       	mov    $0x0,%edx
+  80327d:	85 c0                	test   %eax,%eax
+  80327f:	75 09                	jne    80328a <ipc_recv+0x3a>
+  803281:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803287:	8b 52 74             	mov    0x74(%edx),%edx
+  80328a:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  80328c:	85 db                	test   %ebx,%ebx
+  80328e:	74 25                	je     8032b5 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803290:	85 c0                	test   %eax,%eax
+  803292:	74 0d                	je     8032a1 <ipc_recv+0x51>
+  803294:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  80329a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80329d:	5b                   	pop    %ebx
+  80329e:	5e                   	pop    %esi
+  80329f:	5d                   	pop    %ebp
+  8032a0:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8032a1:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032a6:	8b 40 78             	mov    0x78(%eax),%eax
+  8032a9:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8032ab:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032b0:	8b 40 70             	mov    0x70(%eax),%eax
+  8032b3:	eb e5                	jmp    80329a <ipc_recv+0x4a>
+  8032b5:	85 c0                	test   %eax,%eax
+  8032b7:	75 e1                	jne    80329a <ipc_recv+0x4a>
+  8032b9:	eb f0                	jmp    8032ab <ipc_recv+0x5b>
+
+008032bb <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8032bb:	55                   	push   %ebp
+  8032bc:	89 e5                	mov    %esp,%ebp
+  8032be:	57                   	push   %edi
+  8032bf:	56                   	push   %esi
+  8032c0:	53                   	push   %ebx
+  8032c1:	83 ec 0c             	sub    $0xc,%esp
+  8032c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032c7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032cd:	85 db                	test   %ebx,%ebx
+  8032cf:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032d4:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8032d7:	ff 75 14             	push   0x14(%ebp)
+  8032da:	53                   	push   %ebx
+  8032db:	56                   	push   %esi
+  8032dc:	57                   	push   %edi
+  8032dd:	e8 59 d0 ff ff       	call   80033b <sys_ipc_try_send>
+  8032e2:	83 c4 10             	add    $0x10,%esp
+  8032e5:	85 c0                	test   %eax,%eax
+  8032e7:	74 22                	je     80330b <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8032e9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032ec:	75 07                	jne    8032f5 <ipc_send+0x3a>
+		sys_yield();
+  8032ee:	e8 74 ce ff ff       	call   800167 <sys_yield>
+  8032f3:	eb e2                	jmp    8032d7 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8032f5:	68 e1 3c 80 00       	push   $0x803ce1
+  8032fa:	68 44 38 80 00       	push   $0x803844
+  8032ff:	6a 39                	push   $0x39
+  803301:	68 f6 3c 80 00       	push   $0x803cf6
+  803306:	e8 37 f2 ff ff       	call   802542 <_panic>
+	}
+}
+  80330b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80330e:	5b                   	pop    %ebx
+  80330f:	5e                   	pop    %esi
+  803310:	5f                   	pop    %edi
+  803311:	5d                   	pop    %ebp
+  803312:	c3                   	ret
+
+00803313 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803313:	55                   	push   %ebp
+  803314:	89 e5                	mov    %esp,%ebp
+  803316:	57                   	push   %edi
+  803317:	56                   	push   %esi
+  803318:	53                   	push   %ebx
+  803319:	83 ec 10             	sub    $0x10,%esp
+  80331c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80331f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803322:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803325:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803328:	85 c0                	test   %eax,%eax
+  80332a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80332f:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803332:	6a 00                	push   $0x0
+  803334:	ff 33                	push   (%ebx)
+  803336:	50                   	push   %eax
+  803337:	e8 4f d0 ff ff       	call   80038b <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80333c:	83 c4 10             	add    $0x10,%esp
+  80333f:	85 c0                	test   %eax,%eax
+  803341:	75 3c                	jne    80337f <ipc_recvv+0x6c>
+  803343:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803349:	8b 52 7c             	mov    0x7c(%edx),%edx
+  80334c:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  80334e:	85 ff                	test   %edi,%edi
+  803350:	74 4e                	je     8033a0 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803352:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803358:	8b 52 74             	mov    0x74(%edx),%edx
+  80335b:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  80335d:	85 f6                	test   %esi,%esi
+  80335f:	74 18                	je     803379 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803361:	85 c0                	test   %eax,%eax
+  803363:	75 2d                	jne    803392 <ipc_recvv+0x7f>
+  803365:	a1 00 50 80 00       	mov    0x805000,%eax
+  80336a:	8b 40 78             	mov    0x78(%eax),%eax
+  80336d:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  80336f:	a1 00 50 80 00       	mov    0x805000,%eax
+  803374:	8b 40 70             	mov    0x70(%eax),%eax
+  803377:	eb 1f                	jmp    803398 <ipc_recvv+0x85>
+  803379:	85 c0                	test   %eax,%eax
+  80337b:	75 1b                	jne    803398 <ipc_recvv+0x85>
+  80337d:	eb f0                	jmp    80336f <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80337f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803385:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  80338a:	85 ff                	test   %edi,%edi
+  80338c:	75 cd                	jne    80335b <ipc_recvv+0x48>
+	if (perm_store)
+  80338e:	85 f6                	test   %esi,%esi
+  803390:	74 e7                	je     803379 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803392:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803398:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80339b:	5b                   	pop    %ebx
+  80339c:	5e                   	pop    %esi
+  80339d:	5f                   	pop    %edi
+  80339e:	5d                   	pop    %ebp
+  80339f:	c3                   	ret
+	if (perm_store)
+  8033a0:	85 f6                	test   %esi,%esi
+  8033a2:	75 bd                	jne    803361 <ipc_recvv+0x4e>
+  8033a4:	eb c9                	jmp    80336f <ipc_recvv+0x5c>
+
+008033a6 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8033a6:	55                   	push   %ebp
+  8033a7:	89 e5                	mov    %esp,%ebp
+  8033a9:	57                   	push   %edi
+  8033aa:	56                   	push   %esi
+  8033ab:	53                   	push   %ebx
+  8033ac:	83 ec 0c             	sub    $0xc,%esp
+  8033af:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033b2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8033b8:	ff 75 14             	push   0x14(%ebp)
+  8033bb:	53                   	push   %ebx
+  8033bc:	56                   	push   %esi
+  8033bd:	57                   	push   %edi
+  8033be:	e8 a0 cf ff ff       	call   800363 <sys_ipc_try_sendv>
+  8033c3:	83 c4 10             	add    $0x10,%esp
+  8033c6:	85 c0                	test   %eax,%eax
+  8033c8:	74 22                	je     8033ec <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8033ca:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033cd:	75 07                	jne    8033d6 <ipc_sendv+0x30>
+		sys_yield();
+  8033cf:	e8 93 cd ff ff       	call   800167 <sys_yield>
+  8033d4:	eb e2                	jmp    8033b8 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8033d6:	68 e1 3c 80 00       	push   $0x803ce1
+  8033db:	68 44 38 80 00       	push   $0x803844
+  8033e0:	6a 5c                	push   $0x5c
+  8033e2:	68 f6 3c 80 00       	push   $0x803cf6
+  8033e7:	e8 56 f1 ff ff       	call   802542 <_panic>
+	}
+}
+  8033ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033ef:	5b                   	pop    %ebx
+  8033f0:	5e                   	pop    %esi
+  8033f1:	5f                   	pop    %edi
+  8033f2:	5d                   	pop    %ebp
+  8033f3:	c3                   	ret
+
+008033f4 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8033f4:	55                   	push   %ebp
+  8033f5:	89 e5                	mov    %esp,%ebp
+  8033f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8033fa:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8033ff:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803405:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80340b:	8b 52 50             	mov    0x50(%edx),%edx
+  80340e:	39 ca                	cmp    %ecx,%edx
+  803410:	74 11                	je     803423 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803412:	83 c0 01             	add    $0x1,%eax
+  803415:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80341a:	75 e3                	jne    8033ff <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80341c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803421:	eb 0e                	jmp    803431 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803423:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803429:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80342e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803431:	5d                   	pop    %ebp
+  803432:	c3                   	ret
+
+00803433 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803433:	55                   	push   %ebp
+  803434:	89 e5                	mov    %esp,%ebp
+  803436:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803439:	89 c2                	mov    %eax,%edx
+  80343b:	c1 ea 16             	shr    $0x16,%edx
+  80343e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803445:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80344a:	f6 c1 01             	test   $0x1,%cl
+  80344d:	74 22                	je     803471 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80344f:	c1 e8 0c             	shr    $0xc,%eax
+  803452:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803459:	a8 01                	test   $0x1,%al
+  80345b:	74 14                	je     803471 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80345d:	c1 e8 0c             	shr    $0xc,%eax
+  803460:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803463:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80346a:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  80346e:	0f b7 d2             	movzwl %dx,%edx
+}
+  803471:	89 d0                	mov    %edx,%eax
+  803473:	5d                   	pop    %ebp
+  803474:	c3                   	ret
+
+00803475 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803475:	55                   	push   %ebp
+  803476:	89 e5                	mov    %esp,%ebp
+  803478:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  80347b:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  803482:	74 0a                	je     80348e <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803484:	8b 45 08             	mov    0x8(%ebp),%eax
+  803487:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  80348c:	c9                   	leave
+  80348d:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80348e:	83 ec 04             	sub    $0x4,%esp
+  803491:	6a 07                	push   $0x7
+  803493:	68 00 f0 bf ee       	push   $0xeebff000
+  803498:	6a 00                	push   $0x0
+  80349a:	e8 e7 cc ff ff       	call   800186 <sys_page_alloc>
+  80349f:	83 c4 10             	add    $0x10,%esp
+  8034a2:	85 c0                	test   %eax,%eax
+  8034a4:	75 2c                	jne    8034d2 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8034a6:	83 ec 08             	sub    $0x8,%esp
+  8034a9:	68 e8 34 80 00       	push   $0x8034e8
+  8034ae:	6a 00                	push   $0x0
+  8034b0:	e8 3c ce ff ff       	call   8002f1 <sys_env_set_pgfault_upcall>
+  8034b5:	83 c4 10             	add    $0x10,%esp
+  8034b8:	85 c0                	test   %eax,%eax
+  8034ba:	74 c8                	je     803484 <set_pgfault_handler+0xf>
+  8034bc:	68 48 3d 80 00       	push   $0x803d48
+  8034c1:	68 44 38 80 00       	push   $0x803844
+  8034c6:	6a 20                	push   $0x20
+  8034c8:	68 78 3d 80 00       	push   $0x803d78
+  8034cd:	e8 70 f0 ff ff       	call   802542 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034d2:	68 00 3d 80 00       	push   $0x803d00
+  8034d7:	68 44 38 80 00       	push   $0x803844
+  8034dc:	6a 1e                	push   $0x1e
+  8034de:	68 78 3d 80 00       	push   $0x803d78
+  8034e3:	e8 5a f0 ff ff       	call   802542 <_panic>
+
+008034e8 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8034e8:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8034e9:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  8034ee:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8034f0:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8034f3:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8034f8:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8034fd:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803501:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803504:	83 c4 08             	add    $0x8,%esp
+	popal
+  803507:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803508:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80350b:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  80350c:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80350d:	c3                   	ret
+
+0080350e <dm>:
+  80350e:	55                   	push   %ebp
+  80350f:	57                   	push   %edi
+  803510:	56                   	push   %esi
+  803511:	53                   	push   %ebx
+  803512:	83 ec 24             	sub    $0x24,%esp
+  803515:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803519:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80351d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803521:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803525:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803529:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80352d:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803531:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803536:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803540:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803547:	00 
+  803548:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80354f:	00 
+  803550:	89 fb                	mov    %edi,%ebx
+  803552:	eb 08                	jmp    80355c <dm+0x4e>
+  803554:	83 e9 01             	sub    $0x1,%ecx
+  803557:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80355a:	74 68                	je     8035c4 <dm+0xb6>
+  80355c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803560:	01 c0                	add    %eax,%eax
+  803562:	89 c6                	mov    %eax,%esi
+  803564:	89 d7                	mov    %edx,%edi
+  803566:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80356a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80356e:	0f ad d0             	shrd   %cl,%edx,%eax
+  803571:	d3 ea                	shr    %cl,%edx
+  803573:	f6 c1 20             	test   $0x20,%cl
+  803576:	74 04                	je     80357c <dm+0x6e>
+  803578:	89 d0                	mov    %edx,%eax
+  80357a:	31 d2                	xor    %edx,%edx
+  80357c:	83 e0 01             	and    $0x1,%eax
+  80357f:	89 04 24             	mov    %eax,(%esp)
+  803582:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803589:	00 
+  80358a:	8b 04 24             	mov    (%esp),%eax
+  80358d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803591:	09 f0                	or     %esi,%eax
+  803593:	09 fa                	or     %edi,%edx
+  803595:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803599:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80359d:	39 f0                	cmp    %esi,%eax
+  80359f:	89 d5                	mov    %edx,%ebp
+  8035a1:	19 fd                	sbb    %edi,%ebp
+  8035a3:	72 af                	jb     803554 <dm+0x46>
+  8035a5:	29 f0                	sub    %esi,%eax
+  8035a7:	19 fa                	sbb    %edi,%edx
+  8035a9:	89 cf                	mov    %ecx,%edi
+  8035ab:	c1 ef 05             	shr    $0x5,%edi
+  8035ae:	83 e7 01             	and    $0x1,%edi
+  8035b1:	89 fe                	mov    %edi,%esi
+  8035b3:	83 f6 01             	xor    $0x1,%esi
+  8035b6:	d3 e6                	shl    %cl,%esi
+  8035b8:	d3 e7                	shl    %cl,%edi
+  8035ba:	09 74 24 18          	or     %esi,0x18(%esp)
+  8035be:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8035c2:	eb 90                	jmp    803554 <dm+0x46>
+  8035c4:	85 db                	test   %ebx,%ebx
+  8035c6:	74 05                	je     8035cd <dm+0xbf>
+  8035c8:	89 03                	mov    %eax,(%ebx)
+  8035ca:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035cd:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035d1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035d5:	83 c4 24             	add    $0x24,%esp
+  8035d8:	5b                   	pop    %ebx
+  8035d9:	5e                   	pop    %esi
+  8035da:	5f                   	pop    %edi
+  8035db:	5d                   	pop    %ebp
+  8035dc:	c3                   	ret
+
+008035dd <__udivdi3>:
+  8035dd:	83 ec 08             	sub    $0x8,%esp
+  8035e0:	6a 00                	push   $0x0
+  8035e2:	ff 74 24 1c          	push   0x1c(%esp)
+  8035e6:	ff 74 24 1c          	push   0x1c(%esp)
+  8035ea:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035ee:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035f2:	e8 17 ff ff ff       	call   80350e <dm>
+  8035f7:	83 c4 14             	add    $0x14,%esp
+  8035fa:	c3                   	ret
+
+008035fb <__umoddi3>:
+  8035fb:	83 ec 18             	sub    $0x18,%esp
+  8035fe:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803602:	50                   	push   %eax
+  803603:	ff 74 24 2c          	push   0x2c(%esp)
+  803607:	ff 74 24 2c          	push   0x2c(%esp)
+  80360b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80360f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803613:	e8 f6 fe ff ff       	call   80350e <dm>
+  803618:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80361c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803620:	83 c4 24             	add    $0x24,%esp
+  803623:	c3                   	ret
+
+00803624 <__divdi3>:
+  803624:	53                   	push   %ebx
+  803625:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803629:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80362d:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803631:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803635:	85 d2                	test   %edx,%edx
+  803637:	78 15                	js     80364e <__divdi3+0x2a>
+  803639:	85 db                	test   %ebx,%ebx
+  80363b:	78 34                	js     803671 <__divdi3+0x4d>
+  80363d:	83 ec 04             	sub    $0x4,%esp
+  803640:	6a 00                	push   $0x0
+  803642:	53                   	push   %ebx
+  803643:	51                   	push   %ecx
+  803644:	e8 c5 fe ff ff       	call   80350e <dm>
+  803649:	83 c4 10             	add    $0x10,%esp
+  80364c:	eb 21                	jmp    80366f <__divdi3+0x4b>
+  80364e:	f7 d8                	neg    %eax
+  803650:	83 d2 00             	adc    $0x0,%edx
+  803653:	f7 da                	neg    %edx
+  803655:	85 db                	test   %ebx,%ebx
+  803657:	78 30                	js     803689 <__divdi3+0x65>
+  803659:	83 ec 04             	sub    $0x4,%esp
+  80365c:	6a 00                	push   $0x0
+  80365e:	53                   	push   %ebx
+  80365f:	51                   	push   %ecx
+  803660:	e8 a9 fe ff ff       	call   80350e <dm>
+  803665:	83 c4 10             	add    $0x10,%esp
+  803668:	f7 d8                	neg    %eax
+  80366a:	83 d2 00             	adc    $0x0,%edx
+  80366d:	f7 da                	neg    %edx
+  80366f:	5b                   	pop    %ebx
+  803670:	c3                   	ret
+  803671:	83 ec 04             	sub    $0x4,%esp
+  803674:	6a 00                	push   $0x0
+  803676:	f7 d9                	neg    %ecx
+  803678:	83 d3 00             	adc    $0x0,%ebx
+  80367b:	f7 db                	neg    %ebx
+  80367d:	53                   	push   %ebx
+  80367e:	51                   	push   %ecx
+  80367f:	e8 8a fe ff ff       	call   80350e <dm>
+  803684:	83 c4 10             	add    $0x10,%esp
+  803687:	eb df                	jmp    803668 <__divdi3+0x44>
+  803689:	83 ec 04             	sub    $0x4,%esp
+  80368c:	6a 00                	push   $0x0
+  80368e:	f7 d9                	neg    %ecx
+  803690:	83 d3 00             	adc    $0x0,%ebx
+  803693:	f7 db                	neg    %ebx
+  803695:	53                   	push   %ebx
+  803696:	51                   	push   %ecx
+  803697:	e8 72 fe ff ff       	call   80350e <dm>
+  80369c:	83 c4 10             	add    $0x10,%esp
+  80369f:	eb ce                	jmp    80366f <__divdi3+0x4b>
+
+008036a1 <__moddi3>:
+  8036a1:	55                   	push   %ebp
+  8036a2:	57                   	push   %edi
+  8036a3:	56                   	push   %esi
+  8036a4:	53                   	push   %ebx
+  8036a5:	83 ec 24             	sub    $0x24,%esp
+  8036a8:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036ac:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036b0:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036b4:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036b8:	85 d2                	test   %edx,%edx
+  8036ba:	78 3b                	js     8036f7 <__moddi3+0x56>
+  8036bc:	83 ec 04             	sub    $0x4,%esp
+  8036bf:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036c3:	56                   	push   %esi
+  8036c4:	89 ce                	mov    %ecx,%esi
+  8036c6:	f7 de                	neg    %esi
+  8036c8:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8036cc:	89 de                	mov    %ebx,%esi
+  8036ce:	83 d6 00             	adc    $0x0,%esi
+  8036d1:	f7 de                	neg    %esi
+  8036d3:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8036d7:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8036db:	0f 48 f1             	cmovs  %ecx,%esi
+  8036de:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8036e3:	53                   	push   %ebx
+  8036e4:	56                   	push   %esi
+  8036e5:	e8 24 fe ff ff       	call   80350e <dm>
+  8036ea:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036ee:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036f2:	83 c4 10             	add    $0x10,%esp
+  8036f5:	eb 47                	jmp    80373e <__moddi3+0x9d>
+  8036f7:	f7 d8                	neg    %eax
+  8036f9:	83 d2 00             	adc    $0x0,%edx
+  8036fc:	f7 da                	neg    %edx
+  8036fe:	83 ec 04             	sub    $0x4,%esp
+  803701:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803705:	56                   	push   %esi
+  803706:	89 cf                	mov    %ecx,%edi
+  803708:	f7 df                	neg    %edi
+  80370a:	89 de                	mov    %ebx,%esi
+  80370c:	83 d6 00             	adc    $0x0,%esi
+  80370f:	f7 de                	neg    %esi
+  803711:	0f 49 cf             	cmovns %edi,%ecx
+  803714:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803718:	0f 49 de             	cmovns %esi,%ebx
+  80371b:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80371f:	ff 74 24 0c          	push   0xc(%esp)
+  803723:	ff 74 24 0c          	push   0xc(%esp)
+  803727:	e8 e2 fd ff ff       	call   80350e <dm>
+  80372c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803730:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803734:	f7 d8                	neg    %eax
+  803736:	83 d2 00             	adc    $0x0,%edx
+  803739:	f7 da                	neg    %edx
+  80373b:	83 c4 10             	add    $0x10,%esp
+  80373e:	83 c4 24             	add    $0x24,%esp
+  803741:	5b                   	pop    %ebx
+  803742:	5e                   	pop    %esi
+  803743:	5f                   	pop    %edi
+  803744:	5d                   	pop    %ebp
+  803745:	c3                   	ret
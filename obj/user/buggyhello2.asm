@@ -0,0 +1,7628 @@
+
+obj/user/buggyhello2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs(hello, 1024*1024);
+  800039:	68 00 00 10 00       	push   $0x100000
+  80003e:	ff 35 00 40 80 00    	push   0x804000
+  800044:	e8 68 00 00 00       	call   8000b1 <sys_cputs>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800059:	e8 e9 00 00 00       	call   800147 <sys_getenvid>
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800069:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006e:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800073:	85 db                	test   %ebx,%ebx
+  800075:	7e 07                	jle    80007e <libmain+0x30>
+		binaryname = argv[0];
+  800077:	8b 06                	mov    (%esi),%eax
+  800079:	a3 04 40 80 00       	mov    %eax,0x804004
+
+	// call user main routine
+	umain(argc, argv);
+  80007e:	83 ec 08             	sub    $0x8,%esp
+  800081:	56                   	push   %esi
+  800082:	53                   	push   %ebx
+  800083:	e8 ab ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800088:	e8 0a 00 00 00       	call   800097 <exit>
+}
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800093:	5b                   	pop    %ebx
+  800094:	5e                   	pop    %esi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+
+00800097 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800097:	55                   	push   %ebp
+  800098:	89 e5                	mov    %esp,%ebp
+  80009a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80009d:	e8 c0 06 00 00       	call   800762 <close_all>
+	sys_env_destroy(0);
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	6a 00                	push   $0x0
+  8000a7:	e8 52 00 00 00       	call   8000fe <sys_env_destroy>
+}
+  8000ac:	83 c4 10             	add    $0x10,%esp
+  8000af:	c9                   	leave
+  8000b0:	c3                   	ret
+
+008000b1 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000b1:	55                   	push   %ebp
+  8000b2:	89 e5                	mov    %esp,%ebp
+  8000b4:	57                   	push   %edi
+  8000b5:	56                   	push   %esi
+  8000b6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000c2:	89 c3                	mov    %eax,%ebx
+  8000c4:	89 c7                	mov    %eax,%edi
+  8000c6:	55                   	push   %ebp
+  8000c7:	89 e5                	mov    %esp,%ebp
+  8000c9:	8d 35 d1 00 80 00    	lea    0x8000d1,%esi
+  8000cf:	0f 34                	sysenter
+  8000d1:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  8000d2:	5b                   	pop    %ebx
+  8000d3:	5e                   	pop    %esi
+  8000d4:	5f                   	pop    %edi
+  8000d5:	5d                   	pop    %ebp
+  8000d6:	c3                   	ret
+
+008000d7 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000d7:	55                   	push   %ebp
+  8000d8:	89 e5                	mov    %esp,%ebp
+  8000da:	57                   	push   %edi
+  8000db:	56                   	push   %esi
+  8000dc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000e7:	89 d1                	mov    %edx,%ecx
+  8000e9:	89 d3                	mov    %edx,%ebx
+  8000eb:	89 d7                	mov    %edx,%edi
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	8d 35 f8 00 80 00    	lea    0x8000f8,%esi
+  8000f6:	0f 34                	sysenter
+  8000f8:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  8000f9:	5b                   	pop    %ebx
+  8000fa:	5e                   	pop    %esi
+  8000fb:	5f                   	pop    %edi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	57                   	push   %edi
+  800102:	56                   	push   %esi
+  800103:	53                   	push   %ebx
+  800104:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800107:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80010c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80010f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800114:	89 cb                	mov    %ecx,%ebx
+  800116:	89 cf                	mov    %ecx,%edi
+  800118:	55                   	push   %ebp
+  800119:	89 e5                	mov    %esp,%ebp
+  80011b:	8d 35 23 01 80 00    	lea    0x800123,%esi
+  800121:	0f 34                	sysenter
+  800123:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800124:	85 c0                	test   %eax,%eax
+  800126:	7f 08                	jg     800130 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800128:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80012b:	5b                   	pop    %ebx
+  80012c:	5e                   	pop    %esi
+  80012d:	5f                   	pop    %edi
+  80012e:	5d                   	pop    %ebp
+  80012f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800130:	83 ec 0c             	sub    $0xc,%esp
+  800133:	50                   	push   %eax
+  800134:	6a 03                	push   $0x3
+  800136:	68 78 37 80 00       	push   $0x803778
+  80013b:	6a 3d                	push   $0x3d
+  80013d:	68 95 37 80 00       	push   $0x803795
+  800142:	e8 02 24 00 00       	call   802549 <_panic>
+
+00800147 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800147:	55                   	push   %ebp
+  800148:	89 e5                	mov    %esp,%ebp
+  80014a:	57                   	push   %edi
+  80014b:	56                   	push   %esi
+  80014c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80014d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800152:	b8 02 00 00 00       	mov    $0x2,%eax
+  800157:	89 d1                	mov    %edx,%ecx
+  800159:	89 d3                	mov    %edx,%ebx
+  80015b:	89 d7                	mov    %edx,%edi
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	8d 35 68 01 80 00    	lea    0x800168,%esi
+  800166:	0f 34                	sysenter
+  800168:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800169:	5b                   	pop    %ebx
+  80016a:	5e                   	pop    %esi
+  80016b:	5f                   	pop    %edi
+  80016c:	5d                   	pop    %ebp
+  80016d:	c3                   	ret
+
+0080016e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80016e:	55                   	push   %ebp
+  80016f:	89 e5                	mov    %esp,%ebp
+  800171:	57                   	push   %edi
+  800172:	56                   	push   %esi
+  800173:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800174:	ba 00 00 00 00       	mov    $0x0,%edx
+  800179:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80017e:	89 d1                	mov    %edx,%ecx
+  800180:	89 d3                	mov    %edx,%ebx
+  800182:	89 d7                	mov    %edx,%edi
+  800184:	89 d6                	mov    %edx,%esi
+  800186:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800188:	5b                   	pop    %ebx
+  800189:	5e                   	pop    %esi
+  80018a:	5f                   	pop    %edi
+  80018b:	5d                   	pop    %ebp
+  80018c:	c3                   	ret
+
+0080018d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80018d:	55                   	push   %ebp
+  80018e:	89 e5                	mov    %esp,%ebp
+  800190:	57                   	push   %edi
+  800191:	56                   	push   %esi
+  800192:	53                   	push   %ebx
+  800193:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800196:	8b 55 08             	mov    0x8(%ebp),%edx
+  800199:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80019c:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001a9:	55                   	push   %ebp
+  8001aa:	89 e5                	mov    %esp,%ebp
+  8001ac:	8d 35 b4 01 80 00    	lea    0x8001b4,%esi
+  8001b2:	0f 34                	sysenter
+  8001b4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8001b5:	85 c0                	test   %eax,%eax
+  8001b7:	7f 08                	jg     8001c1 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  8001b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001bc:	5b                   	pop    %ebx
+  8001bd:	5e                   	pop    %esi
+  8001be:	5f                   	pop    %edi
+  8001bf:	5d                   	pop    %ebp
+  8001c0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001c1:	83 ec 0c             	sub    $0xc,%esp
+  8001c4:	50                   	push   %eax
+  8001c5:	6a 04                	push   $0x4
+  8001c7:	68 78 37 80 00       	push   $0x803778
+  8001cc:	6a 3d                	push   $0x3d
+  8001ce:	68 95 37 80 00       	push   $0x803795
+  8001d3:	e8 71 23 00 00       	call   802549 <_panic>
+
+008001d8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001d8:	55                   	push   %ebp
+  8001d9:	89 e5                	mov    %esp,%ebp
+  8001db:	57                   	push   %edi
+  8001dc:	56                   	push   %esi
+  8001dd:	53                   	push   %ebx
+  8001de:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001e7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001ef:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001f2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001f5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001f7:	85 c0                	test   %eax,%eax
+  8001f9:	7f 08                	jg     800203 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fe:	5b                   	pop    %ebx
+  8001ff:	5e                   	pop    %esi
+  800200:	5f                   	pop    %edi
+  800201:	5d                   	pop    %ebp
+  800202:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800203:	83 ec 0c             	sub    $0xc,%esp
+  800206:	50                   	push   %eax
+  800207:	6a 05                	push   $0x5
+  800209:	68 78 37 80 00       	push   $0x803778
+  80020e:	6a 23                	push   $0x23
+  800210:	68 95 37 80 00       	push   $0x803795
+  800215:	e8 2f 23 00 00       	call   802549 <_panic>
+
+0080021a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80021a:	55                   	push   %ebp
+  80021b:	89 e5                	mov    %esp,%ebp
+  80021d:	57                   	push   %edi
+  80021e:	56                   	push   %esi
+  80021f:	53                   	push   %ebx
+  800220:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800223:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800228:	8b 55 08             	mov    0x8(%ebp),%edx
+  80022b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80022e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800233:	89 df                	mov    %ebx,%edi
+  800235:	55                   	push   %ebp
+  800236:	89 e5                	mov    %esp,%ebp
+  800238:	8d 35 40 02 80 00    	lea    0x800240,%esi
+  80023e:	0f 34                	sysenter
+  800240:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800241:	85 c0                	test   %eax,%eax
+  800243:	7f 08                	jg     80024d <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800245:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800248:	5b                   	pop    %ebx
+  800249:	5e                   	pop    %esi
+  80024a:	5f                   	pop    %edi
+  80024b:	5d                   	pop    %ebp
+  80024c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80024d:	83 ec 0c             	sub    $0xc,%esp
+  800250:	50                   	push   %eax
+  800251:	6a 06                	push   $0x6
+  800253:	68 78 37 80 00       	push   $0x803778
+  800258:	6a 3d                	push   $0x3d
+  80025a:	68 95 37 80 00       	push   $0x803795
+  80025f:	e8 e5 22 00 00       	call   802549 <_panic>
+
+00800264 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800264:	55                   	push   %ebp
+  800265:	89 e5                	mov    %esp,%ebp
+  800267:	57                   	push   %edi
+  800268:	56                   	push   %esi
+  800269:	53                   	push   %ebx
+  80026a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80026d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800272:	8b 55 08             	mov    0x8(%ebp),%edx
+  800275:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800278:	b8 08 00 00 00       	mov    $0x8,%eax
+  80027d:	89 df                	mov    %ebx,%edi
+  80027f:	55                   	push   %ebp
+  800280:	89 e5                	mov    %esp,%ebp
+  800282:	8d 35 8a 02 80 00    	lea    0x80028a,%esi
+  800288:	0f 34                	sysenter
+  80028a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80028b:	85 c0                	test   %eax,%eax
+  80028d:	7f 08                	jg     800297 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  80028f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800292:	5b                   	pop    %ebx
+  800293:	5e                   	pop    %esi
+  800294:	5f                   	pop    %edi
+  800295:	5d                   	pop    %ebp
+  800296:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800297:	83 ec 0c             	sub    $0xc,%esp
+  80029a:	50                   	push   %eax
+  80029b:	6a 08                	push   $0x8
+  80029d:	68 78 37 80 00       	push   $0x803778
+  8002a2:	6a 3d                	push   $0x3d
+  8002a4:	68 95 37 80 00       	push   $0x803795
+  8002a9:	e8 9b 22 00 00       	call   802549 <_panic>
+
+008002ae <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8002ae:	55                   	push   %ebp
+  8002af:	89 e5                	mov    %esp,%ebp
+  8002b1:	57                   	push   %edi
+  8002b2:	56                   	push   %esi
+  8002b3:	53                   	push   %ebx
+  8002b4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8002b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002c7:	89 df                	mov    %ebx,%edi
+  8002c9:	55                   	push   %ebp
+  8002ca:	89 e5                	mov    %esp,%ebp
+  8002cc:	8d 35 d4 02 80 00    	lea    0x8002d4,%esi
+  8002d2:	0f 34                	sysenter
+  8002d4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8002d5:	85 c0                	test   %eax,%eax
+  8002d7:	7f 08                	jg     8002e1 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  8002d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002dc:	5b                   	pop    %ebx
+  8002dd:	5e                   	pop    %esi
+  8002de:	5f                   	pop    %edi
+  8002df:	5d                   	pop    %ebp
+  8002e0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002e1:	83 ec 0c             	sub    $0xc,%esp
+  8002e4:	50                   	push   %eax
+  8002e5:	6a 09                	push   $0x9
+  8002e7:	68 78 37 80 00       	push   $0x803778
+  8002ec:	6a 3d                	push   $0x3d
+  8002ee:	68 95 37 80 00       	push   $0x803795
+  8002f3:	e8 51 22 00 00       	call   802549 <_panic>
+
+008002f8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002f8:	55                   	push   %ebp
+  8002f9:	89 e5                	mov    %esp,%ebp
+  8002fb:	57                   	push   %edi
+  8002fc:	56                   	push   %esi
+  8002fd:	53                   	push   %ebx
+  8002fe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800301:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800306:	8b 55 08             	mov    0x8(%ebp),%edx
+  800309:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80030c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800311:	89 df                	mov    %ebx,%edi
+  800313:	55                   	push   %ebp
+  800314:	89 e5                	mov    %esp,%ebp
+  800316:	8d 35 1e 03 80 00    	lea    0x80031e,%esi
+  80031c:	0f 34                	sysenter
+  80031e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80031f:	85 c0                	test   %eax,%eax
+  800321:	7f 08                	jg     80032b <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800323:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800326:	5b                   	pop    %ebx
+  800327:	5e                   	pop    %esi
+  800328:	5f                   	pop    %edi
+  800329:	5d                   	pop    %ebp
+  80032a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80032b:	83 ec 0c             	sub    $0xc,%esp
+  80032e:	50                   	push   %eax
+  80032f:	6a 0a                	push   $0xa
+  800331:	68 78 37 80 00       	push   $0x803778
+  800336:	6a 3d                	push   $0x3d
+  800338:	68 95 37 80 00       	push   $0x803795
+  80033d:	e8 07 22 00 00       	call   802549 <_panic>
+
+00800342 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800342:	55                   	push   %ebp
+  800343:	89 e5                	mov    %esp,%ebp
+  800345:	57                   	push   %edi
+  800346:	56                   	push   %esi
+  800347:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800348:	8b 55 08             	mov    0x8(%ebp),%edx
+  80034b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80034e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800353:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800356:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800359:	55                   	push   %ebp
+  80035a:	89 e5                	mov    %esp,%ebp
+  80035c:	8d 35 64 03 80 00    	lea    0x800364,%esi
+  800362:	0f 34                	sysenter
+  800364:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800365:	5b                   	pop    %ebx
+  800366:	5e                   	pop    %esi
+  800367:	5f                   	pop    %edi
+  800368:	5d                   	pop    %ebp
+  800369:	c3                   	ret
+
+0080036a <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  80036a:	55                   	push   %ebp
+  80036b:	89 e5                	mov    %esp,%ebp
+  80036d:	57                   	push   %edi
+  80036e:	56                   	push   %esi
+  80036f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800370:	8b 55 08             	mov    0x8(%ebp),%edx
+  800373:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800376:	b8 17 00 00 00       	mov    $0x17,%eax
+  80037b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80037e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800381:	55                   	push   %ebp
+  800382:	89 e5                	mov    %esp,%ebp
+  800384:	8d 35 8c 03 80 00    	lea    0x80038c,%esi
+  80038a:	0f 34                	sysenter
+  80038c:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  80038d:	5b                   	pop    %ebx
+  80038e:	5e                   	pop    %esi
+  80038f:	5f                   	pop    %edi
+  800390:	5d                   	pop    %ebp
+  800391:	c3                   	ret
+
+00800392 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800392:	55                   	push   %ebp
+  800393:	89 e5                	mov    %esp,%ebp
+  800395:	57                   	push   %edi
+  800396:	56                   	push   %esi
+  800397:	53                   	push   %ebx
+  800398:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80039b:	be 00 00 00 00       	mov    $0x0,%esi
+  8003a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003a6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003ae:	89 f7                	mov    %esi,%edi
+  8003b0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003b2:	85 c0                	test   %eax,%eax
+  8003b4:	7f 08                	jg     8003be <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8003b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003b9:	5b                   	pop    %ebx
+  8003ba:	5e                   	pop    %esi
+  8003bb:	5f                   	pop    %edi
+  8003bc:	5d                   	pop    %ebp
+  8003bd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003be:	83 ec 0c             	sub    $0xc,%esp
+  8003c1:	50                   	push   %eax
+  8003c2:	6a 0d                	push   $0xd
+  8003c4:	68 78 37 80 00       	push   $0x803778
+  8003c9:	6a 23                	push   $0x23
+  8003cb:	68 95 37 80 00       	push   $0x803795
+  8003d0:	e8 74 21 00 00       	call   802549 <_panic>
+
+008003d5 <sys_ipc_recv>:
+{
+  8003d5:	55                   	push   %ebp
+  8003d6:	89 e5                	mov    %esp,%ebp
+  8003d8:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  8003db:	6a 00                	push   $0x0
+  8003dd:	6a 01                	push   $0x1
+  8003df:	ff 75 08             	push   0x8(%ebp)
+  8003e2:	e8 ab ff ff ff       	call   800392 <sys_ipc_recvv>
+}
+  8003e7:	c9                   	leave
+  8003e8:	c3                   	ret
+
+008003e9 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  8003e9:	55                   	push   %ebp
+  8003ea:	89 e5                	mov    %esp,%ebp
+  8003ec:	57                   	push   %edi
+  8003ed:	56                   	push   %esi
+  8003ee:	53                   	push   %ebx
+  8003ef:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800402:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800405:	89 de                	mov    %ebx,%esi
+  800407:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800409:	85 c0                	test   %eax,%eax
+  80040b:	7f 08                	jg     800415 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  80040d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800410:	5b                   	pop    %ebx
+  800411:	5e                   	pop    %esi
+  800412:	5f                   	pop    %edi
+  800413:	5d                   	pop    %ebp
+  800414:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800415:	83 ec 0c             	sub    $0xc,%esp
+  800418:	50                   	push   %eax
+  800419:	6a 0d                	push   $0xd
+  80041b:	68 78 37 80 00       	push   $0x803778
+  800420:	6a 23                	push   $0x23
+  800422:	68 95 37 80 00       	push   $0x803795
+  800427:	e8 1d 21 00 00       	call   802549 <_panic>
+
+0080042c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80042c:	55                   	push   %ebp
+  80042d:	89 e5                	mov    %esp,%ebp
+  80042f:	57                   	push   %edi
+  800430:	56                   	push   %esi
+  800431:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800432:	ba 00 00 00 00       	mov    $0x0,%edx
+  800437:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80043c:	89 d1                	mov    %edx,%ecx
+  80043e:	89 d3                	mov    %edx,%ebx
+  800440:	89 d7                	mov    %edx,%edi
+  800442:	55                   	push   %ebp
+  800443:	89 e5                	mov    %esp,%ebp
+  800445:	8d 35 4d 04 80 00    	lea    0x80044d,%esi
+  80044b:	0f 34                	sysenter
+  80044d:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  80044e:	5b                   	pop    %ebx
+  80044f:	5e                   	pop    %esi
+  800450:	5f                   	pop    %edi
+  800451:	5d                   	pop    %ebp
+  800452:	c3                   	ret
+
+00800453 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800453:	55                   	push   %ebp
+  800454:	89 e5                	mov    %esp,%ebp
+  800456:	57                   	push   %edi
+  800457:	56                   	push   %esi
+  800458:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800459:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80045e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800461:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800464:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800469:	89 df                	mov    %ebx,%edi
+  80046b:	55                   	push   %ebp
+  80046c:	89 e5                	mov    %esp,%ebp
+  80046e:	8d 35 76 04 80 00    	lea    0x800476,%esi
+  800474:	0f 34                	sysenter
+  800476:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800477:	5b                   	pop    %ebx
+  800478:	5e                   	pop    %esi
+  800479:	5f                   	pop    %edi
+  80047a:	5d                   	pop    %ebp
+  80047b:	c3                   	ret
+
+0080047c <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  80047c:	55                   	push   %ebp
+  80047d:	89 e5                	mov    %esp,%ebp
+  80047f:	57                   	push   %edi
+  800480:	56                   	push   %esi
+  800481:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800482:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800487:	8b 55 08             	mov    0x8(%ebp),%edx
+  80048a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80048f:	89 cb                	mov    %ecx,%ebx
+  800491:	89 cf                	mov    %ecx,%edi
+  800493:	55                   	push   %ebp
+  800494:	89 e5                	mov    %esp,%ebp
+  800496:	8d 35 9e 04 80 00    	lea    0x80049e,%esi
+  80049c:	0f 34                	sysenter
+  80049e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  80049f:	5b                   	pop    %ebx
+  8004a0:	5e                   	pop    %esi
+  8004a1:	5f                   	pop    %edi
+  8004a2:	5d                   	pop    %ebp
+  8004a3:	c3                   	ret
+
+008004a4 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  8004a4:	55                   	push   %ebp
+  8004a5:	89 e5                	mov    %esp,%ebp
+  8004a7:	57                   	push   %edi
+  8004a8:	56                   	push   %esi
+  8004a9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004b5:	b8 12 00 00 00       	mov    $0x12,%eax
+  8004ba:	89 df                	mov    %ebx,%edi
+  8004bc:	55                   	push   %ebp
+  8004bd:	89 e5                	mov    %esp,%ebp
+  8004bf:	8d 35 c7 04 80 00    	lea    0x8004c7,%esi
+  8004c5:	0f 34                	sysenter
+  8004c7:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8004c8:	5b                   	pop    %ebx
+  8004c9:	5e                   	pop    %esi
+  8004ca:	5f                   	pop    %edi
+  8004cb:	5d                   	pop    %ebp
+  8004cc:	c3                   	ret
+
+008004cd <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8004cd:	55                   	push   %ebp
+  8004ce:	89 e5                	mov    %esp,%ebp
+  8004d0:	57                   	push   %edi
+  8004d1:	56                   	push   %esi
+  8004d2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004de:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004e3:	89 df                	mov    %ebx,%edi
+  8004e5:	55                   	push   %ebp
+  8004e6:	89 e5                	mov    %esp,%ebp
+  8004e8:	8d 35 f0 04 80 00    	lea    0x8004f0,%esi
+  8004ee:	0f 34                	sysenter
+  8004f0:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  8004f1:	5b                   	pop    %ebx
+  8004f2:	5e                   	pop    %esi
+  8004f3:	5f                   	pop    %edi
+  8004f4:	5d                   	pop    %ebp
+  8004f5:	c3                   	ret
+
+008004f6 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  8004f6:	55                   	push   %ebp
+  8004f7:	89 e5                	mov    %esp,%ebp
+  8004f9:	57                   	push   %edi
+  8004fa:	56                   	push   %esi
+  8004fb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800502:	b8 13 00 00 00       	mov    $0x13,%eax
+  800507:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80050a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80050d:	55                   	push   %ebp
+  80050e:	89 e5                	mov    %esp,%ebp
+  800510:	8d 35 18 05 80 00    	lea    0x800518,%esi
+  800516:	0f 34                	sysenter
+  800518:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800519:	5b                   	pop    %ebx
+  80051a:	5e                   	pop    %esi
+  80051b:	5f                   	pop    %edi
+  80051c:	5d                   	pop    %ebp
+  80051d:	c3                   	ret
+
+0080051e <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  80051e:	55                   	push   %ebp
+  80051f:	89 e5                	mov    %esp,%ebp
+  800521:	57                   	push   %edi
+  800522:	56                   	push   %esi
+  800523:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800524:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800529:	8b 55 08             	mov    0x8(%ebp),%edx
+  80052c:	b8 11 00 00 00       	mov    $0x11,%eax
+  800531:	89 cb                	mov    %ecx,%ebx
+  800533:	89 cf                	mov    %ecx,%edi
+  800535:	89 ce                	mov    %ecx,%esi
+  800537:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800539:	5b                   	pop    %ebx
+  80053a:	5e                   	pop    %esi
+  80053b:	5f                   	pop    %edi
+  80053c:	5d                   	pop    %ebp
+  80053d:	c3                   	ret
+
+0080053e <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  80053e:	55                   	push   %ebp
+  80053f:	89 e5                	mov    %esp,%ebp
+  800541:	57                   	push   %edi
+  800542:	56                   	push   %esi
+  800543:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800544:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800549:	8b 55 08             	mov    0x8(%ebp),%edx
+  80054c:	b8 15 00 00 00       	mov    $0x15,%eax
+  800551:	89 cb                	mov    %ecx,%ebx
+  800553:	89 cf                	mov    %ecx,%edi
+  800555:	55                   	push   %ebp
+  800556:	89 e5                	mov    %esp,%ebp
+  800558:	8d 35 60 05 80 00    	lea    0x800560,%esi
+  80055e:	0f 34                	sysenter
+  800560:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800561:	5b                   	pop    %ebx
+  800562:	5e                   	pop    %esi
+  800563:	5f                   	pop    %edi
+  800564:	5d                   	pop    %ebp
+  800565:	c3                   	ret
+
+00800566 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800566:	55                   	push   %ebp
+  800567:	89 e5                	mov    %esp,%ebp
+  800569:	57                   	push   %edi
+  80056a:	56                   	push   %esi
+  80056b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80056c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800571:	8b 55 08             	mov    0x8(%ebp),%edx
+  800574:	b8 16 00 00 00       	mov    $0x16,%eax
+  800579:	89 cb                	mov    %ecx,%ebx
+  80057b:	89 cf                	mov    %ecx,%edi
+  80057d:	55                   	push   %ebp
+  80057e:	89 e5                	mov    %esp,%ebp
+  800580:	8d 35 88 05 80 00    	lea    0x800588,%esi
+  800586:	0f 34                	sysenter
+  800588:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800589:	5b                   	pop    %ebx
+  80058a:	5e                   	pop    %esi
+  80058b:	5f                   	pop    %edi
+  80058c:	5d                   	pop    %ebp
+  80058d:	c3                   	ret
+
+0080058e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80058e:	55                   	push   %ebp
+  80058f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800591:	8b 45 08             	mov    0x8(%ebp),%eax
+  800594:	05 00 00 00 30       	add    $0x30000000,%eax
+  800599:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80059c:	5d                   	pop    %ebp
+  80059d:	c3                   	ret
+
+0080059e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80059e:	55                   	push   %ebp
+  80059f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8005a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005a4:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8005a9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8005ae:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8005b3:	5d                   	pop    %ebp
+  8005b4:	c3                   	ret
+
+008005b5 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8005b5:	55                   	push   %ebp
+  8005b6:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8005b8:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8005bd:	eb 02                	jmp    8005c1 <fd_alloc+0xc>
+  8005bf:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8005c1:	89 c2                	mov    %eax,%edx
+  8005c3:	c1 ea 16             	shr    $0x16,%edx
+  8005c6:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8005cd:	f6 c2 01             	test   $0x1,%dl
+  8005d0:	74 2b                	je     8005fd <fd_alloc+0x48>
+  8005d2:	89 c2                	mov    %eax,%edx
+  8005d4:	c1 ea 0c             	shr    $0xc,%edx
+  8005d7:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8005de:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8005e4:	f6 c1 01             	test   $0x1,%cl
+  8005e7:	74 14                	je     8005fd <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8005e9:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8005ef:	75 ce                	jne    8005bf <fd_alloc+0xa>
+  8005f1:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8005f6:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8005fb:	eb 05                	jmp    800602 <fd_alloc+0x4d>
+			return 0;
+  8005fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800602:	8b 55 08             	mov    0x8(%ebp),%edx
+  800605:	89 02                	mov    %eax,(%edx)
+}
+  800607:	89 c8                	mov    %ecx,%eax
+  800609:	5d                   	pop    %ebp
+  80060a:	c3                   	ret
+
+0080060b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80060b:	55                   	push   %ebp
+  80060c:	89 e5                	mov    %esp,%ebp
+  80060e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800611:	83 f8 1f             	cmp    $0x1f,%eax
+  800614:	77 30                	ja     800646 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800616:	c1 e0 0c             	shl    $0xc,%eax
+  800619:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80061e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800624:	f6 c2 01             	test   $0x1,%dl
+  800627:	74 24                	je     80064d <fd_lookup+0x42>
+  800629:	89 c2                	mov    %eax,%edx
+  80062b:	c1 ea 0c             	shr    $0xc,%edx
+  80062e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800635:	f6 c2 01             	test   $0x1,%dl
+  800638:	74 1a                	je     800654 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80063a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80063d:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80063f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800644:	5d                   	pop    %ebp
+  800645:	c3                   	ret
+		return -E_INVAL;
+  800646:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80064b:	eb f7                	jmp    800644 <fd_lookup+0x39>
+		return -E_INVAL;
+  80064d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800652:	eb f0                	jmp    800644 <fd_lookup+0x39>
+  800654:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800659:	eb e9                	jmp    800644 <fd_lookup+0x39>
+
+0080065b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80065b:	55                   	push   %ebp
+  80065c:	89 e5                	mov    %esp,%ebp
+  80065e:	53                   	push   %ebx
+  80065f:	83 ec 04             	sub    $0x4,%esp
+  800662:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800665:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066a:	eb 03                	jmp    80066f <dev_lookup+0x14>
+  80066c:	83 c0 01             	add    $0x1,%eax
+  80066f:	8b 1c 85 20 38 80 00 	mov    0x803820(,%eax,4),%ebx
+  800676:	85 db                	test   %ebx,%ebx
+  800678:	74 0b                	je     800685 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80067a:	39 13                	cmp    %edx,(%ebx)
+  80067c:	75 ee                	jne    80066c <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80067e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800683:	eb 1f                	jmp    8006a4 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800685:	a1 00 50 80 00       	mov    0x805000,%eax
+  80068a:	8b 40 48             	mov    0x48(%eax),%eax
+  80068d:	83 ec 04             	sub    $0x4,%esp
+  800690:	52                   	push   %edx
+  800691:	50                   	push   %eax
+  800692:	68 a4 37 80 00       	push   $0x8037a4
+  800697:	e8 88 1f 00 00       	call   802624 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80069c:	83 c4 10             	add    $0x10,%esp
+  80069f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8006a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006a7:	89 1a                	mov    %ebx,(%edx)
+}
+  8006a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006ac:	c9                   	leave
+  8006ad:	c3                   	ret
+
+008006ae <fd_close>:
+{
+  8006ae:	55                   	push   %ebp
+  8006af:	89 e5                	mov    %esp,%ebp
+  8006b1:	57                   	push   %edi
+  8006b2:	56                   	push   %esi
+  8006b3:	53                   	push   %ebx
+  8006b4:	83 ec 24             	sub    $0x24,%esp
+  8006b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006ba:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006bd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8006c0:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8006c1:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8006c7:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006ca:	50                   	push   %eax
+  8006cb:	e8 3b ff ff ff       	call   80060b <fd_lookup>
+  8006d0:	89 c3                	mov    %eax,%ebx
+  8006d2:	83 c4 10             	add    $0x10,%esp
+  8006d5:	85 c0                	test   %eax,%eax
+  8006d7:	78 05                	js     8006de <fd_close+0x30>
+	    || fd != fd2)
+  8006d9:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8006dc:	74 16                	je     8006f4 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8006de:	89 f8                	mov    %edi,%eax
+  8006e0:	84 c0                	test   %al,%al
+  8006e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e7:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8006ea:	89 d8                	mov    %ebx,%eax
+  8006ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006ef:	5b                   	pop    %ebx
+  8006f0:	5e                   	pop    %esi
+  8006f1:	5f                   	pop    %edi
+  8006f2:	5d                   	pop    %ebp
+  8006f3:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8006f4:	83 ec 08             	sub    $0x8,%esp
+  8006f7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8006fa:	50                   	push   %eax
+  8006fb:	ff 36                	push   (%esi)
+  8006fd:	e8 59 ff ff ff       	call   80065b <dev_lookup>
+  800702:	89 c3                	mov    %eax,%ebx
+  800704:	83 c4 10             	add    $0x10,%esp
+  800707:	85 c0                	test   %eax,%eax
+  800709:	78 1a                	js     800725 <fd_close+0x77>
+		if (dev->dev_close)
+  80070b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80070e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800711:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800716:	85 c0                	test   %eax,%eax
+  800718:	74 0b                	je     800725 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80071a:	83 ec 0c             	sub    $0xc,%esp
+  80071d:	56                   	push   %esi
+  80071e:	ff d0                	call   *%eax
+  800720:	89 c3                	mov    %eax,%ebx
+  800722:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800725:	83 ec 08             	sub    $0x8,%esp
+  800728:	56                   	push   %esi
+  800729:	6a 00                	push   $0x0
+  80072b:	e8 ea fa ff ff       	call   80021a <sys_page_unmap>
+	return r;
+  800730:	83 c4 10             	add    $0x10,%esp
+  800733:	eb b5                	jmp    8006ea <fd_close+0x3c>
+
+00800735 <close>:
+
+int
+close(int fdnum)
+{
+  800735:	55                   	push   %ebp
+  800736:	89 e5                	mov    %esp,%ebp
+  800738:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80073b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80073e:	50                   	push   %eax
+  80073f:	ff 75 08             	push   0x8(%ebp)
+  800742:	e8 c4 fe ff ff       	call   80060b <fd_lookup>
+  800747:	83 c4 10             	add    $0x10,%esp
+  80074a:	85 c0                	test   %eax,%eax
+  80074c:	79 02                	jns    800750 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80074e:	c9                   	leave
+  80074f:	c3                   	ret
+		return fd_close(fd, 1);
+  800750:	83 ec 08             	sub    $0x8,%esp
+  800753:	6a 01                	push   $0x1
+  800755:	ff 75 f4             	push   -0xc(%ebp)
+  800758:	e8 51 ff ff ff       	call   8006ae <fd_close>
+  80075d:	83 c4 10             	add    $0x10,%esp
+  800760:	eb ec                	jmp    80074e <close+0x19>
+
+00800762 <close_all>:
+
+void
+close_all(void)
+{
+  800762:	55                   	push   %ebp
+  800763:	89 e5                	mov    %esp,%ebp
+  800765:	53                   	push   %ebx
+  800766:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800769:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80076e:	83 ec 0c             	sub    $0xc,%esp
+  800771:	53                   	push   %ebx
+  800772:	e8 be ff ff ff       	call   800735 <close>
+	for (i = 0; i < MAXFD; i++)
+  800777:	83 c3 01             	add    $0x1,%ebx
+  80077a:	83 c4 10             	add    $0x10,%esp
+  80077d:	83 fb 20             	cmp    $0x20,%ebx
+  800780:	75 ec                	jne    80076e <close_all+0xc>
+}
+  800782:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800785:	c9                   	leave
+  800786:	c3                   	ret
+
+00800787 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800787:	55                   	push   %ebp
+  800788:	89 e5                	mov    %esp,%ebp
+  80078a:	57                   	push   %edi
+  80078b:	56                   	push   %esi
+  80078c:	53                   	push   %ebx
+  80078d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800790:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800793:	50                   	push   %eax
+  800794:	ff 75 08             	push   0x8(%ebp)
+  800797:	e8 6f fe ff ff       	call   80060b <fd_lookup>
+  80079c:	89 c3                	mov    %eax,%ebx
+  80079e:	83 c4 10             	add    $0x10,%esp
+  8007a1:	85 c0                	test   %eax,%eax
+  8007a3:	78 7f                	js     800824 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8007a5:	83 ec 0c             	sub    $0xc,%esp
+  8007a8:	ff 75 0c             	push   0xc(%ebp)
+  8007ab:	e8 85 ff ff ff       	call   800735 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8007b0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8007b3:	c1 e6 0c             	shl    $0xc,%esi
+  8007b6:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8007bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8007bf:	89 3c 24             	mov    %edi,(%esp)
+  8007c2:	e8 d7 fd ff ff       	call   80059e <fd2data>
+  8007c7:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8007c9:	89 34 24             	mov    %esi,(%esp)
+  8007cc:	e8 cd fd ff ff       	call   80059e <fd2data>
+  8007d1:	83 c4 10             	add    $0x10,%esp
+  8007d4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8007d7:	89 d8                	mov    %ebx,%eax
+  8007d9:	c1 e8 16             	shr    $0x16,%eax
+  8007dc:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8007e3:	a8 01                	test   $0x1,%al
+  8007e5:	74 11                	je     8007f8 <dup+0x71>
+  8007e7:	89 d8                	mov    %ebx,%eax
+  8007e9:	c1 e8 0c             	shr    $0xc,%eax
+  8007ec:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8007f3:	f6 c2 01             	test   $0x1,%dl
+  8007f6:	75 36                	jne    80082e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8007f8:	89 f8                	mov    %edi,%eax
+  8007fa:	c1 e8 0c             	shr    $0xc,%eax
+  8007fd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800804:	83 ec 0c             	sub    $0xc,%esp
+  800807:	25 07 0e 00 00       	and    $0xe07,%eax
+  80080c:	50                   	push   %eax
+  80080d:	56                   	push   %esi
+  80080e:	6a 00                	push   $0x0
+  800810:	57                   	push   %edi
+  800811:	6a 00                	push   $0x0
+  800813:	e8 c0 f9 ff ff       	call   8001d8 <sys_page_map>
+  800818:	89 c3                	mov    %eax,%ebx
+  80081a:	83 c4 20             	add    $0x20,%esp
+  80081d:	85 c0                	test   %eax,%eax
+  80081f:	78 33                	js     800854 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800821:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800824:	89 d8                	mov    %ebx,%eax
+  800826:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800829:	5b                   	pop    %ebx
+  80082a:	5e                   	pop    %esi
+  80082b:	5f                   	pop    %edi
+  80082c:	5d                   	pop    %ebp
+  80082d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80082e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800835:	83 ec 0c             	sub    $0xc,%esp
+  800838:	25 07 0e 00 00       	and    $0xe07,%eax
+  80083d:	50                   	push   %eax
+  80083e:	ff 75 d4             	push   -0x2c(%ebp)
+  800841:	6a 00                	push   $0x0
+  800843:	53                   	push   %ebx
+  800844:	6a 00                	push   $0x0
+  800846:	e8 8d f9 ff ff       	call   8001d8 <sys_page_map>
+  80084b:	89 c3                	mov    %eax,%ebx
+  80084d:	83 c4 20             	add    $0x20,%esp
+  800850:	85 c0                	test   %eax,%eax
+  800852:	79 a4                	jns    8007f8 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800854:	83 ec 08             	sub    $0x8,%esp
+  800857:	56                   	push   %esi
+  800858:	6a 00                	push   $0x0
+  80085a:	e8 bb f9 ff ff       	call   80021a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80085f:	83 c4 08             	add    $0x8,%esp
+  800862:	ff 75 d4             	push   -0x2c(%ebp)
+  800865:	6a 00                	push   $0x0
+  800867:	e8 ae f9 ff ff       	call   80021a <sys_page_unmap>
+	return r;
+  80086c:	83 c4 10             	add    $0x10,%esp
+  80086f:	eb b3                	jmp    800824 <dup+0x9d>
+
+00800871 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800871:	55                   	push   %ebp
+  800872:	89 e5                	mov    %esp,%ebp
+  800874:	56                   	push   %esi
+  800875:	53                   	push   %ebx
+  800876:	83 ec 18             	sub    $0x18,%esp
+  800879:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80087c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80087f:	50                   	push   %eax
+  800880:	56                   	push   %esi
+  800881:	e8 85 fd ff ff       	call   80060b <fd_lookup>
+  800886:	83 c4 10             	add    $0x10,%esp
+  800889:	85 c0                	test   %eax,%eax
+  80088b:	78 3c                	js     8008c9 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80088d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800890:	83 ec 08             	sub    $0x8,%esp
+  800893:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800896:	50                   	push   %eax
+  800897:	ff 33                	push   (%ebx)
+  800899:	e8 bd fd ff ff       	call   80065b <dev_lookup>
+  80089e:	83 c4 10             	add    $0x10,%esp
+  8008a1:	85 c0                	test   %eax,%eax
+  8008a3:	78 24                	js     8008c9 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8008a5:	8b 43 08             	mov    0x8(%ebx),%eax
+  8008a8:	83 e0 03             	and    $0x3,%eax
+  8008ab:	83 f8 01             	cmp    $0x1,%eax
+  8008ae:	74 20                	je     8008d0 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8008b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008b3:	8b 40 08             	mov    0x8(%eax),%eax
+  8008b6:	85 c0                	test   %eax,%eax
+  8008b8:	74 37                	je     8008f1 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8008ba:	83 ec 04             	sub    $0x4,%esp
+  8008bd:	ff 75 10             	push   0x10(%ebp)
+  8008c0:	ff 75 0c             	push   0xc(%ebp)
+  8008c3:	53                   	push   %ebx
+  8008c4:	ff d0                	call   *%eax
+  8008c6:	83 c4 10             	add    $0x10,%esp
+}
+  8008c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008cc:	5b                   	pop    %ebx
+  8008cd:	5e                   	pop    %esi
+  8008ce:	5d                   	pop    %ebp
+  8008cf:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8008d0:	a1 00 50 80 00       	mov    0x805000,%eax
+  8008d5:	8b 40 48             	mov    0x48(%eax),%eax
+  8008d8:	83 ec 04             	sub    $0x4,%esp
+  8008db:	56                   	push   %esi
+  8008dc:	50                   	push   %eax
+  8008dd:	68 e5 37 80 00       	push   $0x8037e5
+  8008e2:	e8 3d 1d 00 00       	call   802624 <cprintf>
+		return -E_INVAL;
+  8008e7:	83 c4 10             	add    $0x10,%esp
+  8008ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008ef:	eb d8                	jmp    8008c9 <read+0x58>
+		return -E_NOT_SUPP;
+  8008f1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8008f6:	eb d1                	jmp    8008c9 <read+0x58>
+
+008008f8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8008f8:	55                   	push   %ebp
+  8008f9:	89 e5                	mov    %esp,%ebp
+  8008fb:	57                   	push   %edi
+  8008fc:	56                   	push   %esi
+  8008fd:	53                   	push   %ebx
+  8008fe:	83 ec 0c             	sub    $0xc,%esp
+  800901:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800904:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800907:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80090c:	eb 02                	jmp    800910 <readn+0x18>
+  80090e:	01 c3                	add    %eax,%ebx
+  800910:	39 f3                	cmp    %esi,%ebx
+  800912:	73 21                	jae    800935 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800914:	83 ec 04             	sub    $0x4,%esp
+  800917:	89 f0                	mov    %esi,%eax
+  800919:	29 d8                	sub    %ebx,%eax
+  80091b:	50                   	push   %eax
+  80091c:	89 d8                	mov    %ebx,%eax
+  80091e:	03 45 0c             	add    0xc(%ebp),%eax
+  800921:	50                   	push   %eax
+  800922:	57                   	push   %edi
+  800923:	e8 49 ff ff ff       	call   800871 <read>
+		if (m < 0)
+  800928:	83 c4 10             	add    $0x10,%esp
+  80092b:	85 c0                	test   %eax,%eax
+  80092d:	78 04                	js     800933 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80092f:	75 dd                	jne    80090e <readn+0x16>
+  800931:	eb 02                	jmp    800935 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800933:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800935:	89 d8                	mov    %ebx,%eax
+  800937:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80093a:	5b                   	pop    %ebx
+  80093b:	5e                   	pop    %esi
+  80093c:	5f                   	pop    %edi
+  80093d:	5d                   	pop    %ebp
+  80093e:	c3                   	ret
+
+0080093f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	56                   	push   %esi
+  800943:	53                   	push   %ebx
+  800944:	83 ec 18             	sub    $0x18,%esp
+  800947:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80094a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80094d:	50                   	push   %eax
+  80094e:	53                   	push   %ebx
+  80094f:	e8 b7 fc ff ff       	call   80060b <fd_lookup>
+  800954:	83 c4 10             	add    $0x10,%esp
+  800957:	85 c0                	test   %eax,%eax
+  800959:	78 37                	js     800992 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80095b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80095e:	83 ec 08             	sub    $0x8,%esp
+  800961:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800964:	50                   	push   %eax
+  800965:	ff 36                	push   (%esi)
+  800967:	e8 ef fc ff ff       	call   80065b <dev_lookup>
+  80096c:	83 c4 10             	add    $0x10,%esp
+  80096f:	85 c0                	test   %eax,%eax
+  800971:	78 1f                	js     800992 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800973:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800977:	74 20                	je     800999 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800979:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80097c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80097f:	85 c0                	test   %eax,%eax
+  800981:	74 37                	je     8009ba <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800983:	83 ec 04             	sub    $0x4,%esp
+  800986:	ff 75 10             	push   0x10(%ebp)
+  800989:	ff 75 0c             	push   0xc(%ebp)
+  80098c:	56                   	push   %esi
+  80098d:	ff d0                	call   *%eax
+  80098f:	83 c4 10             	add    $0x10,%esp
+}
+  800992:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800995:	5b                   	pop    %ebx
+  800996:	5e                   	pop    %esi
+  800997:	5d                   	pop    %ebp
+  800998:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800999:	a1 00 50 80 00       	mov    0x805000,%eax
+  80099e:	8b 40 48             	mov    0x48(%eax),%eax
+  8009a1:	83 ec 04             	sub    $0x4,%esp
+  8009a4:	53                   	push   %ebx
+  8009a5:	50                   	push   %eax
+  8009a6:	68 01 38 80 00       	push   $0x803801
+  8009ab:	e8 74 1c 00 00       	call   802624 <cprintf>
+		return -E_INVAL;
+  8009b0:	83 c4 10             	add    $0x10,%esp
+  8009b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009b8:	eb d8                	jmp    800992 <write+0x53>
+		return -E_NOT_SUPP;
+  8009ba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009bf:	eb d1                	jmp    800992 <write+0x53>
+
+008009c1 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8009c1:	55                   	push   %ebp
+  8009c2:	89 e5                	mov    %esp,%ebp
+  8009c4:	53                   	push   %ebx
+  8009c5:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009c8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009cb:	50                   	push   %eax
+  8009cc:	ff 75 08             	push   0x8(%ebp)
+  8009cf:	e8 37 fc ff ff       	call   80060b <fd_lookup>
+  8009d4:	83 c4 10             	add    $0x10,%esp
+  8009d7:	85 c0                	test   %eax,%eax
+  8009d9:	78 3a                	js     800a15 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009db:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8009de:	83 ec 08             	sub    $0x8,%esp
+  8009e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009e4:	50                   	push   %eax
+  8009e5:	ff 33                	push   (%ebx)
+  8009e7:	e8 6f fc ff ff       	call   80065b <dev_lookup>
+  8009ec:	83 c4 10             	add    $0x10,%esp
+  8009ef:	85 c0                	test   %eax,%eax
+  8009f1:	78 22                	js     800a15 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8009f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009f6:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8009f9:	85 c0                	test   %eax,%eax
+  8009fb:	74 0d                	je     800a0a <seek+0x49>
+  8009fd:	83 ec 0c             	sub    $0xc,%esp
+  800a00:	53                   	push   %ebx
+  800a01:	ff d0                	call   *%eax
+  800a03:	83 c4 10             	add    $0x10,%esp
+  800a06:	85 c0                	test   %eax,%eax
+  800a08:	78 0b                	js     800a15 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  800a0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a0d:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  800a10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a18:	c9                   	leave
+  800a19:	c3                   	ret
+
+00800a1a <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  800a1a:	55                   	push   %ebp
+  800a1b:	89 e5                	mov    %esp,%ebp
+  800a1d:	53                   	push   %ebx
+  800a1e:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a21:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a24:	50                   	push   %eax
+  800a25:	ff 75 08             	push   0x8(%ebp)
+  800a28:	e8 de fb ff ff       	call   80060b <fd_lookup>
+  800a2d:	83 c4 10             	add    $0x10,%esp
+  800a30:	85 c0                	test   %eax,%eax
+  800a32:	78 2b                	js     800a5f <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a34:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a37:	83 ec 08             	sub    $0x8,%esp
+  800a3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a3d:	50                   	push   %eax
+  800a3e:	ff 33                	push   (%ebx)
+  800a40:	e8 16 fc ff ff       	call   80065b <dev_lookup>
+  800a45:	83 c4 10             	add    $0x10,%esp
+  800a48:	85 c0                	test   %eax,%eax
+  800a4a:	78 13                	js     800a5f <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  800a4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a4f:	8b 40 1c             	mov    0x1c(%eax),%eax
+  800a52:	85 c0                	test   %eax,%eax
+  800a54:	74 0e                	je     800a64 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  800a56:	83 ec 0c             	sub    $0xc,%esp
+  800a59:	53                   	push   %ebx
+  800a5a:	ff d0                	call   *%eax
+  800a5c:	83 c4 10             	add    $0x10,%esp
+}
+  800a5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a62:	c9                   	leave
+  800a63:	c3                   	ret
+		return 0;
+  800a64:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a69:	eb f4                	jmp    800a5f <fsync+0x45>
+
+00800a6b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a6b:	55                   	push   %ebp
+  800a6c:	89 e5                	mov    %esp,%ebp
+  800a6e:	56                   	push   %esi
+  800a6f:	53                   	push   %ebx
+  800a70:	83 ec 18             	sub    $0x18,%esp
+  800a73:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a76:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a79:	50                   	push   %eax
+  800a7a:	53                   	push   %ebx
+  800a7b:	e8 8b fb ff ff       	call   80060b <fd_lookup>
+  800a80:	83 c4 10             	add    $0x10,%esp
+  800a83:	85 c0                	test   %eax,%eax
+  800a85:	78 34                	js     800abb <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a87:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a8a:	83 ec 08             	sub    $0x8,%esp
+  800a8d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a90:	50                   	push   %eax
+  800a91:	ff 36                	push   (%esi)
+  800a93:	e8 c3 fb ff ff       	call   80065b <dev_lookup>
+  800a98:	83 c4 10             	add    $0x10,%esp
+  800a9b:	85 c0                	test   %eax,%eax
+  800a9d:	78 1c                	js     800abb <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a9f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800aa3:	74 1d                	je     800ac2 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800aa5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800aa8:	8b 40 18             	mov    0x18(%eax),%eax
+  800aab:	85 c0                	test   %eax,%eax
+  800aad:	74 34                	je     800ae3 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800aaf:	83 ec 08             	sub    $0x8,%esp
+  800ab2:	ff 75 0c             	push   0xc(%ebp)
+  800ab5:	56                   	push   %esi
+  800ab6:	ff d0                	call   *%eax
+  800ab8:	83 c4 10             	add    $0x10,%esp
+}
+  800abb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800abe:	5b                   	pop    %ebx
+  800abf:	5e                   	pop    %esi
+  800ac0:	5d                   	pop    %ebp
+  800ac1:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800ac2:	a1 00 50 80 00       	mov    0x805000,%eax
+  800ac7:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800aca:	83 ec 04             	sub    $0x4,%esp
+  800acd:	53                   	push   %ebx
+  800ace:	50                   	push   %eax
+  800acf:	68 c4 37 80 00       	push   $0x8037c4
+  800ad4:	e8 4b 1b 00 00       	call   802624 <cprintf>
+		return -E_INVAL;
+  800ad9:	83 c4 10             	add    $0x10,%esp
+  800adc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ae1:	eb d8                	jmp    800abb <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800ae3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ae8:	eb d1                	jmp    800abb <ftruncate+0x50>
+
+00800aea <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	56                   	push   %esi
+  800aee:	53                   	push   %ebx
+  800aef:	83 ec 18             	sub    $0x18,%esp
+  800af2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800af5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800af8:	50                   	push   %eax
+  800af9:	ff 75 08             	push   0x8(%ebp)
+  800afc:	e8 0a fb ff ff       	call   80060b <fd_lookup>
+  800b01:	83 c4 10             	add    $0x10,%esp
+  800b04:	85 c0                	test   %eax,%eax
+  800b06:	78 49                	js     800b51 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b08:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b0b:	83 ec 08             	sub    $0x8,%esp
+  800b0e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b11:	50                   	push   %eax
+  800b12:	ff 36                	push   (%esi)
+  800b14:	e8 42 fb ff ff       	call   80065b <dev_lookup>
+  800b19:	83 c4 10             	add    $0x10,%esp
+  800b1c:	85 c0                	test   %eax,%eax
+  800b1e:	78 31                	js     800b51 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b23:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b27:	74 2f                	je     800b58 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b29:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b2c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b33:	00 00 00 
+	stat->st_isdir = 0;
+  800b36:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b3d:	00 00 00 
+	stat->st_dev = dev;
+  800b40:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b46:	83 ec 08             	sub    $0x8,%esp
+  800b49:	53                   	push   %ebx
+  800b4a:	56                   	push   %esi
+  800b4b:	ff 50 14             	call   *0x14(%eax)
+  800b4e:	83 c4 10             	add    $0x10,%esp
+}
+  800b51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b54:	5b                   	pop    %ebx
+  800b55:	5e                   	pop    %esi
+  800b56:	5d                   	pop    %ebp
+  800b57:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b58:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b5d:	eb f2                	jmp    800b51 <fstat+0x67>
+
+00800b5f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b5f:	55                   	push   %ebp
+  800b60:	89 e5                	mov    %esp,%ebp
+  800b62:	56                   	push   %esi
+  800b63:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  800b64:	83 ec 08             	sub    $0x8,%esp
+  800b67:	68 00 10 00 00       	push   $0x1000
+  800b6c:	ff 75 08             	push   0x8(%ebp)
+  800b6f:	e8 b3 07 00 00       	call   801327 <open>
+  800b74:	89 c3                	mov    %eax,%ebx
+  800b76:	83 c4 10             	add    $0x10,%esp
+  800b79:	85 c0                	test   %eax,%eax
+  800b7b:	78 1b                	js     800b98 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  800b7d:	83 ec 08             	sub    $0x8,%esp
+  800b80:	ff 75 0c             	push   0xc(%ebp)
+  800b83:	50                   	push   %eax
+  800b84:	e8 61 ff ff ff       	call   800aea <fstat>
+  800b89:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800b8b:	89 1c 24             	mov    %ebx,(%esp)
+  800b8e:	e8 a2 fb ff ff       	call   800735 <close>
+	return r;
+  800b93:	83 c4 10             	add    $0x10,%esp
+  800b96:	89 f3                	mov    %esi,%ebx
+}
+  800b98:	89 d8                	mov    %ebx,%eax
+  800b9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b9d:	5b                   	pop    %ebx
+  800b9e:	5e                   	pop    %esi
+  800b9f:	5d                   	pop    %ebp
+  800ba0:	c3                   	ret
+
+00800ba1 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  800ba1:	55                   	push   %ebp
+  800ba2:	89 e5                	mov    %esp,%ebp
+  800ba4:	57                   	push   %edi
+  800ba5:	56                   	push   %esi
+  800ba6:	53                   	push   %ebx
+  800ba7:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  800bad:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  800bb3:	89 d6                	mov    %edx,%esi
+  800bb5:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  800bbb:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  800bbe:	89 d3                	mov    %edx,%ebx
+  800bc0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  800bc6:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800bcd:	74 1d                	je     800bec <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  800bcf:	b8 00 60 80 00       	mov    $0x806000,%eax
+  800bd4:	83 c8 07             	or     $0x7,%eax
+  800bd7:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  800bdd:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800be2:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  800be8:	01 ce                	add    %ecx,%esi
+  800bea:	eb 28                	jmp    800c14 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800bec:	83 ec 0c             	sub    $0xc,%esp
+  800bef:	6a 01                	push   $0x1
+  800bf1:	e8 05 28 00 00       	call   8033fb <ipc_find_env>
+  800bf6:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800bfb:	83 c4 10             	add    $0x10,%esp
+  800bfe:	eb cf                	jmp    800bcf <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  800c00:	83 c0 01             	add    $0x1,%eax
+  800c03:	89 fa                	mov    %edi,%edx
+  800c05:	09 da                	or     %ebx,%edx
+  800c07:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800c0e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800c14:	39 f3                	cmp    %esi,%ebx
+  800c16:	72 e8                	jb     800c00 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  800c18:	83 f8 41             	cmp    $0x41,%eax
+  800c1b:	77 2f                	ja     800c4c <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  800c1d:	50                   	push   %eax
+  800c1e:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  800c24:	50                   	push   %eax
+  800c25:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  800c2b:	ff 35 c8 70 80 00    	push   0x8070c8
+  800c31:	e8 77 27 00 00       	call   8033ad <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  800c36:	83 c4 0c             	add    $0xc,%esp
+  800c39:	6a 00                	push   $0x0
+  800c3b:	6a 00                	push   $0x0
+  800c3d:	6a 00                	push   $0x0
+  800c3f:	e8 13 26 00 00       	call   803257 <ipc_recv>
+}
+  800c44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c47:	5b                   	pop    %ebx
+  800c48:	5e                   	pop    %esi
+  800c49:	5f                   	pop    %edi
+  800c4a:	5d                   	pop    %ebp
+  800c4b:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  800c4c:	68 34 38 80 00       	push   $0x803834
+  800c51:	68 50 38 80 00       	push   $0x803850
+  800c56:	6a 40                	push   $0x40
+  800c58:	68 65 38 80 00       	push   $0x803865
+  800c5d:	e8 e7 18 00 00       	call   802549 <_panic>
+
+00800c62 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  800c62:	55                   	push   %ebp
+  800c63:	89 e5                	mov    %esp,%ebp
+  800c65:	57                   	push   %edi
+  800c66:	56                   	push   %esi
+  800c67:	53                   	push   %ebx
+  800c68:	83 ec 1c             	sub    $0x1c,%esp
+  800c6b:	89 c3                	mov    %eax,%ebx
+  800c6d:	89 d6                	mov    %edx,%esi
+  800c6f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  800c72:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  800c78:	89 ca                	mov    %ecx,%edx
+  800c7a:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  800c7d:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  800c84:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  800c87:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  800c8e:	8b 76 0c             	mov    0xc(%esi),%esi
+  800c91:	89 fb                	mov    %edi,%ebx
+  800c93:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  800c9a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c9d:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  800ca4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ca7:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  800cae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cb1:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  800cb8:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  800cbb:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  800cc2:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  800cc7:	39 c8                	cmp    %ecx,%eax
+  800cc9:	74 0d                	je     800cd8 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  800ccb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd3:	5b                   	pop    %ebx
+  800cd4:	5e                   	pop    %esi
+  800cd5:	5f                   	pop    %edi
+  800cd6:	5d                   	pop    %ebp
+  800cd7:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cd8:	6a 07                	push   $0x7
+  800cda:	68 00 60 80 00       	push   $0x806000
+  800cdf:	6a 0d                	push   $0xd
+  800ce1:	ff 35 c8 70 80 00    	push   0x8070c8
+  800ce7:	e8 d6 25 00 00       	call   8032c2 <ipc_send>
+  800cec:	83 c4 10             	add    $0x10,%esp
+  800cef:	eb da                	jmp    800ccb <fsring_post+0x69>
+
+00800cf1 <fsipcv>:
+{
+  800cf1:	55                   	push   %ebp
+  800cf2:	89 e5                	mov    %esp,%ebp
+  800cf4:	57                   	push   %edi
+  800cf5:	56                   	push   %esi
+  800cf6:	53                   	push   %ebx
+  800cf7:	83 ec 0c             	sub    $0xc,%esp
+  800cfa:	89 c7                	mov    %eax,%edi
+  800cfc:	89 d3                	mov    %edx,%ebx
+  800cfe:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  800d00:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800d07:	74 26                	je     800d2f <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800d09:	6a 07                	push   $0x7
+  800d0b:	68 00 60 80 00       	push   $0x806000
+  800d10:	57                   	push   %edi
+  800d11:	ff 35 c8 70 80 00    	push   0x8070c8
+  800d17:	e8 a6 25 00 00       	call   8032c2 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  800d1c:	6a 00                	push   $0x0
+  800d1e:	56                   	push   %esi
+  800d1f:	53                   	push   %ebx
+  800d20:	6a 00                	push   $0x0
+  800d22:	e8 f3 25 00 00       	call   80331a <ipc_recvv>
+}
+  800d27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d2a:	5b                   	pop    %ebx
+  800d2b:	5e                   	pop    %esi
+  800d2c:	5f                   	pop    %edi
+  800d2d:	5d                   	pop    %ebp
+  800d2e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d2f:	83 ec 0c             	sub    $0xc,%esp
+  800d32:	6a 01                	push   $0x1
+  800d34:	e8 c2 26 00 00       	call   8033fb <ipc_find_env>
+  800d39:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800d3e:	83 c4 10             	add    $0x10,%esp
+  800d41:	eb c6                	jmp    800d09 <fsipcv+0x18>
+
+00800d43 <fsipc>:
+{
+  800d43:	55                   	push   %ebp
+  800d44:	89 e5                	mov    %esp,%ebp
+  800d46:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  800d49:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  800d50:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800d53:	e8 99 ff ff ff       	call   800cf1 <fsipcv>
+}
+  800d58:	c9                   	leave
+  800d59:	c3                   	ret
+
+00800d5a <file_write_direct>:
+{
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	56                   	push   %esi
+  800d5e:	53                   	push   %ebx
+  800d5f:	89 c3                	mov    %eax,%ebx
+  800d61:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800d63:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  800d69:	77 40                	ja     800dab <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800d6b:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  800d70:	39 c8                	cmp    %ecx,%eax
+  800d72:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d75:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  800d78:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  800d7e:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800d83:	83 ec 04             	sub    $0x4,%esp
+  800d86:	50                   	push   %eax
+  800d87:	52                   	push   %edx
+  800d88:	68 08 60 80 00       	push   $0x806008
+  800d8d:	e8 06 20 00 00       	call   802d98 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800d92:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d97:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d9c:	e8 a2 ff ff ff       	call   800d43 <fsipc>
+  800da1:	83 c4 10             	add    $0x10,%esp
+}
+  800da4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800da7:	5b                   	pop    %ebx
+  800da8:	5e                   	pop    %esi
+  800da9:	5d                   	pop    %ebp
+  800daa:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  800dab:	89 d6                	mov    %edx,%esi
+  800dad:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  800db3:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  800db8:	29 f1                	sub    %esi,%ecx
+  800dba:	39 c1                	cmp    %eax,%ecx
+  800dbc:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  800dbf:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800dc2:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  800dc7:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  800dcd:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  800dd3:	83 ec 0c             	sub    $0xc,%esp
+  800dd6:	6a 05                	push   $0x5
+  800dd8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ddd:	e8 bf fd ff ff       	call   800ba1 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  800de2:	83 c4 10             	add    $0x10,%esp
+  800de5:	eb bd                	jmp    800da4 <file_write_direct+0x4a>
+
+00800de7 <devfile_sync>:
+{
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	57                   	push   %edi
+  800deb:	56                   	push   %esi
+  800dec:	53                   	push   %ebx
+  800ded:	83 ec 28             	sub    $0x28,%esp
+  800df0:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  800df3:	56                   	push   %esi
+  800df4:	e8 a5 f7 ff ff       	call   80059e <fd2data>
+  800df9:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  800dfb:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  800dfe:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  800e05:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800e08:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  800e0d:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  800e11:	74 45                	je     800e58 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  800e13:	8b 46 14             	mov    0x14(%esi),%eax
+  800e16:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e23:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e26:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  800e29:	39 cb                	cmp    %ecx,%ebx
+  800e2b:	73 14                	jae    800e41 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  800e2d:	29 d9                	sub    %ebx,%ecx
+  800e2f:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800e32:	89 f0                	mov    %esi,%eax
+  800e34:	e8 21 ff ff ff       	call   800d5a <file_write_direct>
+  800e39:	85 c0                	test   %eax,%eax
+  800e3b:	7e 04                	jle    800e41 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e3d:	01 c3                	add    %eax,%ebx
+  800e3f:	eb e5                	jmp    800e26 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  800e41:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e44:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  800e4b:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  800e4e:	85 c0                	test   %eax,%eax
+  800e50:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e55:	0f 4f c2             	cmovg  %edx,%eax
+}
+  800e58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5b:	5b                   	pop    %ebx
+  800e5c:	5e                   	pop    %esi
+  800e5d:	5f                   	pop    %edi
+  800e5e:	5d                   	pop    %ebp
+  800e5f:	c3                   	ret
+
+00800e60 <devfile_write>:
+{
+  800e60:	55                   	push   %ebp
+  800e61:	89 e5                	mov    %esp,%ebp
+  800e63:	57                   	push   %edi
+  800e64:	56                   	push   %esi
+  800e65:	53                   	push   %ebx
+  800e66:	83 ec 28             	sub    $0x28,%esp
+  800e69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e6c:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  800e6f:	53                   	push   %ebx
+  800e70:	e8 29 f7 ff ff       	call   80059e <fd2data>
+  800e75:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  800e78:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  800e7b:	83 c4 10             	add    $0x10,%esp
+  800e7e:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  800e82:	74 43                	je     800ec7 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  800e84:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  800e8b:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800e8e:	85 c0                	test   %eax,%eax
+  800e90:	74 43                	je     800ed5 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  800e92:	89 c2                	mov    %eax,%edx
+  800e94:	03 53 14             	add    0x14(%ebx),%edx
+  800e97:	39 fa                	cmp    %edi,%edx
+  800e99:	75 0b                	jne    800ea6 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  800e9b:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  800e9e:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  800ea4:	76 66                	jbe    800f0c <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  800ea6:	83 ec 0c             	sub    $0xc,%esp
+  800ea9:	53                   	push   %ebx
+  800eaa:	e8 38 ff ff ff       	call   800de7 <devfile_sync>
+  800eaf:	83 c4 10             	add    $0x10,%esp
+  800eb2:	85 c0                	test   %eax,%eax
+  800eb4:	78 4e                	js     800f04 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800eb6:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800ebc:	77 56                	ja     800f14 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  800ebe:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800ec1:	85 c0                	test   %eax,%eax
+  800ec3:	75 20                	jne    800ee5 <devfile_write+0x85>
+  800ec5:	eb 16                	jmp    800edd <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  800ec7:	89 f1                	mov    %esi,%ecx
+  800ec9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ecc:	89 d8                	mov    %ebx,%eax
+  800ece:	e8 87 fe ff ff       	call   800d5a <file_write_direct>
+  800ed3:	eb 2f                	jmp    800f04 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800ed5:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800edb:	77 37                	ja     800f14 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  800edd:	89 7b 14             	mov    %edi,0x14(%ebx)
+  800ee0:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  800ee5:	83 ec 04             	sub    $0x4,%esp
+  800ee8:	56                   	push   %esi
+  800ee9:	ff 75 0c             	push   0xc(%ebp)
+  800eec:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800eef:	01 c1                	add    %eax,%ecx
+  800ef1:	51                   	push   %ecx
+  800ef2:	e8 a1 1e 00 00       	call   802d98 <memmove>
+	ff->buf_wlen += n;
+  800ef7:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  800efa:	01 f7                	add    %esi,%edi
+  800efc:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  800eff:	89 f0                	mov    %esi,%eax
+  800f01:	83 c4 10             	add    $0x10,%esp
+}
+  800f04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f07:	5b                   	pop    %ebx
+  800f08:	5e                   	pop    %esi
+  800f09:	5f                   	pop    %edi
+  800f0a:	5d                   	pop    %ebp
+  800f0b:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  800f0c:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800f12:	76 d1                	jbe    800ee5 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  800f14:	89 f1                	mov    %esi,%ecx
+  800f16:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f19:	89 d8                	mov    %ebx,%eax
+  800f1b:	e8 3a fe ff ff       	call   800d5a <file_write_direct>
+  800f20:	eb e2                	jmp    800f04 <devfile_write+0xa4>
+
+00800f22 <devfile_trunc>:
+{
+  800f22:	55                   	push   %ebp
+  800f23:	89 e5                	mov    %esp,%ebp
+  800f25:	53                   	push   %ebx
+  800f26:	83 ec 10             	sub    $0x10,%esp
+  800f29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  800f2c:	53                   	push   %ebx
+  800f2d:	e8 b5 fe ff ff       	call   800de7 <devfile_sync>
+  800f32:	83 c4 10             	add    $0x10,%esp
+  800f35:	85 c0                	test   %eax,%eax
+  800f37:	78 1f                	js     800f58 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800f39:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f3c:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800f41:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f44:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800f49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f53:	e8 eb fd ff ff       	call   800d43 <fsipc>
+}
+  800f58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f5b:	c9                   	leave
+  800f5c:	c3                   	ret
+
+00800f5d <devfile_stat>:
+{
+  800f5d:	55                   	push   %ebp
+  800f5e:	89 e5                	mov    %esp,%ebp
+  800f60:	56                   	push   %esi
+  800f61:	53                   	push   %ebx
+  800f62:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800f65:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  800f68:	83 ec 0c             	sub    $0xc,%esp
+  800f6b:	53                   	push   %ebx
+  800f6c:	e8 76 fe ff ff       	call   800de7 <devfile_sync>
+  800f71:	83 c4 10             	add    $0x10,%esp
+  800f74:	85 c0                	test   %eax,%eax
+  800f76:	78 47                	js     800fbf <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800f78:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f7b:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800f80:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f85:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f8a:	e8 b4 fd ff ff       	call   800d43 <fsipc>
+  800f8f:	85 c0                	test   %eax,%eax
+  800f91:	78 2c                	js     800fbf <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f93:	83 ec 08             	sub    $0x8,%esp
+  800f96:	68 00 60 80 00       	push   $0x806000
+  800f9b:	56                   	push   %esi
+  800f9c:	e8 71 1c 00 00       	call   802c12 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800fa1:	a1 80 60 80 00       	mov    0x806080,%eax
+  800fa6:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800fac:	a1 84 60 80 00       	mov    0x806084,%eax
+  800fb1:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  800fb7:	83 c4 10             	add    $0x10,%esp
+  800fba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fbf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fc2:	5b                   	pop    %ebx
+  800fc3:	5e                   	pop    %esi
+  800fc4:	5d                   	pop    %ebp
+  800fc5:	c3                   	ret
+
+00800fc6 <devfile_flush>:
+{
+  800fc6:	55                   	push   %ebp
+  800fc7:	89 e5                	mov    %esp,%ebp
+  800fc9:	56                   	push   %esi
+  800fca:	53                   	push   %ebx
+  800fcb:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  800fce:	83 ec 0c             	sub    $0xc,%esp
+  800fd1:	56                   	push   %esi
+  800fd2:	e8 10 fe ff ff       	call   800de7 <devfile_sync>
+  800fd7:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  800fd9:	83 c4 10             	add    $0x10,%esp
+  800fdc:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  800fe0:	75 25                	jne    801007 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800fe2:	8b 46 0c             	mov    0xc(%esi),%eax
+  800fe5:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  800fea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fef:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ff4:	e8 4a fd ff ff       	call   800d43 <fsipc>
+  800ff9:	85 c0                	test   %eax,%eax
+  800ffb:	0f 45 d8             	cmovne %eax,%ebx
+}
+  800ffe:	89 d8                	mov    %ebx,%eax
+  801000:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801003:	5b                   	pop    %ebx
+  801004:	5e                   	pop    %esi
+  801005:	5d                   	pop    %ebp
+  801006:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801007:	83 ec 0c             	sub    $0xc,%esp
+  80100a:	56                   	push   %esi
+  80100b:	e8 8e f5 ff ff       	call   80059e <fd2data>
+  801010:	83 c4 08             	add    $0x8,%esp
+  801013:	50                   	push   %eax
+  801014:	6a 00                	push   $0x0
+  801016:	e8 ff f1 ff ff       	call   80021a <sys_page_unmap>
+  80101b:	83 c4 10             	add    $0x10,%esp
+  80101e:	eb c2                	jmp    800fe2 <devfile_flush+0x1c>
+
+00801020 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801020:	55                   	push   %ebp
+  801021:	89 e5                	mov    %esp,%ebp
+  801023:	57                   	push   %edi
+  801024:	56                   	push   %esi
+  801025:	53                   	push   %ebx
+  801026:	83 ec 64             	sub    $0x64,%esp
+  801029:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  80102b:	52                   	push   %edx
+  80102c:	50                   	push   %eax
+  80102d:	e8 d9 f5 ff ff       	call   80060b <fd_lookup>
+  801032:	89 c1                	mov    %eax,%ecx
+  801034:	83 c4 10             	add    $0x10,%esp
+  801037:	85 c0                	test   %eax,%eax
+  801039:	0f 88 f2 00 00 00    	js     801131 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  80103f:	8b 07                	mov    (%edi),%eax
+  801041:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801047:	39 10                	cmp    %edx,(%eax)
+  801049:	0f 85 03 01 00 00    	jne    801152 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  80104f:	a1 00 50 80 00       	mov    0x805000,%eax
+  801054:	8b 40 48             	mov    0x48(%eax),%eax
+  801057:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  80105d:	0f 84 96 00 00 00    	je     8010f9 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801063:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  80106a:	0f 84 cb 00 00 00    	je     80113b <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801070:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801075:	83 c8 07             	or     $0x7,%eax
+  801078:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  80107b:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80107e:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801083:	83 ec 04             	sub    $0x4,%esp
+  801086:	68 07 04 00 00       	push   $0x407
+  80108b:	53                   	push   %ebx
+  80108c:	6a 00                	push   $0x0
+  80108e:	e8 fa f0 ff ff       	call   80018d <sys_page_alloc>
+  801093:	89 c1                	mov    %eax,%ecx
+  801095:	83 c4 10             	add    $0x10,%esp
+  801098:	85 c0                	test   %eax,%eax
+  80109a:	0f 88 91 00 00 00    	js     801131 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  8010a0:	89 d8                	mov    %ebx,%eax
+  8010a2:	83 c8 07             	or     $0x7,%eax
+  8010a5:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8010a7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8010ad:	83 c6 04             	add    $0x4,%esi
+  8010b0:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8010b6:	75 cb                	jne    801083 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8010b8:	6a 12                	push   $0x12
+  8010ba:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8010bd:	50                   	push   %eax
+  8010be:	6a 0c                	push   $0xc
+  8010c0:	ff 35 c8 70 80 00    	push   0x8070c8
+  8010c6:	e8 e2 22 00 00       	call   8033ad <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8010cb:	83 c4 0c             	add    $0xc,%esp
+  8010ce:	6a 00                	push   $0x0
+  8010d0:	6a 00                	push   $0x0
+  8010d2:	6a 00                	push   $0x0
+  8010d4:	e8 7e 21 00 00       	call   803257 <ipc_recv>
+  8010d9:	89 c1                	mov    %eax,%ecx
+  8010db:	83 c4 10             	add    $0x10,%esp
+  8010de:	85 c0                	test   %eax,%eax
+  8010e0:	78 4f                	js     801131 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  8010e2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8010e7:	8b 40 48             	mov    0x48(%eax),%eax
+  8010ea:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  8010ef:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  8010f6:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  8010f9:	83 ec 0c             	sub    $0xc,%esp
+  8010fc:	ff 37                	push   (%edi)
+  8010fe:	e8 e4 fc ff ff       	call   800de7 <devfile_sync>
+  801103:	89 c1                	mov    %eax,%ecx
+  801105:	83 c4 10             	add    $0x10,%esp
+  801108:	85 c0                	test   %eax,%eax
+  80110a:	78 25                	js     801131 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  80110c:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801112:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801117:	ba 01 00 00 00       	mov    $0x1,%edx
+  80111c:	89 d0                	mov    %edx,%eax
+  80111e:	d3 e0                	shl    %cl,%eax
+  801120:	85 d8                	test   %ebx,%eax
+  801122:	74 0d                	je     801131 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801124:	83 c1 01             	add    $0x1,%ecx
+  801127:	83 f9 10             	cmp    $0x10,%ecx
+  80112a:	75 f0                	jne    80111c <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  80112c:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801131:	89 c8                	mov    %ecx,%eax
+  801133:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801136:	5b                   	pop    %ebx
+  801137:	5e                   	pop    %esi
+  801138:	5f                   	pop    %edi
+  801139:	5d                   	pop    %ebp
+  80113a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80113b:	83 ec 0c             	sub    $0xc,%esp
+  80113e:	6a 01                	push   $0x1
+  801140:	e8 b6 22 00 00       	call   8033fb <ipc_find_env>
+  801145:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  80114a:	83 c4 10             	add    $0x10,%esp
+  80114d:	e9 1e ff ff ff       	jmp    801070 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801152:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801157:	eb d8                	jmp    801131 <fsring_slot+0x111>
+
+00801159 <file_read_direct>:
+{
+  801159:	55                   	push   %ebp
+  80115a:	89 e5                	mov    %esp,%ebp
+  80115c:	57                   	push   %edi
+  80115d:	56                   	push   %esi
+  80115e:	53                   	push   %ebx
+  80115f:	83 ec 1c             	sub    $0x1c,%esp
+  801162:	89 c7                	mov    %eax,%edi
+  801164:	89 d6                	mov    %edx,%esi
+  801166:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801168:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  80116e:	77 52                	ja     8011c2 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801170:	8b 40 0c             	mov    0xc(%eax),%eax
+  801173:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801178:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80117e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801183:	b8 03 00 00 00       	mov    $0x3,%eax
+  801188:	e8 b6 fb ff ff       	call   800d43 <fsipc>
+  80118d:	89 c7                	mov    %eax,%edi
+  80118f:	85 c0                	test   %eax,%eax
+  801191:	78 25                	js     8011b8 <file_read_direct+0x5f>
+	assert(r <= n);
+  801193:	39 c3                	cmp    %eax,%ebx
+  801195:	0f 82 87 00 00 00    	jb     801222 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  80119b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8011a0:	0f 8f 95 00 00 00    	jg     80123b <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8011a6:	83 ec 04             	sub    $0x4,%esp
+  8011a9:	50                   	push   %eax
+  8011aa:	68 00 60 80 00       	push   $0x806000
+  8011af:	56                   	push   %esi
+  8011b0:	e8 e3 1b 00 00       	call   802d98 <memmove>
+	return r;
+  8011b5:	83 c4 10             	add    $0x10,%esp
+}
+  8011b8:	89 f8                	mov    %edi,%eax
+  8011ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011bd:	5b                   	pop    %ebx
+  8011be:	5e                   	pop    %esi
+  8011bf:	5f                   	pop    %edi
+  8011c0:	5d                   	pop    %ebp
+  8011c1:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8011c2:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8011c8:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8011cd:	29 d1                	sub    %edx,%ecx
+  8011cf:	39 d9                	cmp    %ebx,%ecx
+  8011d1:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011d4:	89 f0                	mov    %esi,%eax
+  8011d6:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8011d9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8011dc:	eb 0f                	jmp    8011ed <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8011de:	0f b6 10             	movzbl (%eax),%edx
+  8011e1:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011e3:	05 00 10 00 00       	add    $0x1000,%eax
+  8011e8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011ed:	39 c8                	cmp    %ecx,%eax
+  8011ef:	72 ed                	jb     8011de <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  8011f1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8011f4:	8b 47 0c             	mov    0xc(%edi),%eax
+  8011f7:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  8011fc:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801202:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801208:	83 ec 0c             	sub    $0xc,%esp
+  80120b:	6a 07                	push   $0x7
+  80120d:	89 d9                	mov    %ebx,%ecx
+  80120f:	89 f2                	mov    %esi,%edx
+  801211:	b8 09 00 00 00       	mov    $0x9,%eax
+  801216:	e8 86 f9 ff ff       	call   800ba1 <fsipc_pages>
+  80121b:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  80121d:	83 c4 10             	add    $0x10,%esp
+  801220:	eb 96                	jmp    8011b8 <file_read_direct+0x5f>
+	assert(r <= n);
+  801222:	68 70 38 80 00       	push   $0x803870
+  801227:	68 50 38 80 00       	push   $0x803850
+  80122c:	68 dc 00 00 00       	push   $0xdc
+  801231:	68 65 38 80 00       	push   $0x803865
+  801236:	e8 0e 13 00 00       	call   802549 <_panic>
+	assert(r <= PGSIZE);
+  80123b:	68 81 38 80 00       	push   $0x803881
+  801240:	68 50 38 80 00       	push   $0x803850
+  801245:	68 dd 00 00 00       	push   $0xdd
+  80124a:	68 65 38 80 00       	push   $0x803865
+  80124f:	e8 f5 12 00 00       	call   802549 <_panic>
+
+00801254 <devfile_read>:
+{
+  801254:	55                   	push   %ebp
+  801255:	89 e5                	mov    %esp,%ebp
+  801257:	57                   	push   %edi
+  801258:	56                   	push   %esi
+  801259:	53                   	push   %ebx
+  80125a:	83 ec 28             	sub    $0x28,%esp
+  80125d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801260:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801263:	53                   	push   %ebx
+  801264:	e8 35 f3 ff ff       	call   80059e <fd2data>
+  801269:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  80126c:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80126f:	83 c4 10             	add    $0x10,%esp
+  801272:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801276:	74 7d                	je     8012f5 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801278:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80127c:	0f 85 81 00 00 00    	jne    801303 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801282:	8b 43 18             	mov    0x18(%ebx),%eax
+  801285:	85 c0                	test   %eax,%eax
+  801287:	74 0d                	je     801296 <devfile_read+0x42>
+  801289:	8b 53 14             	mov    0x14(%ebx),%edx
+  80128c:	39 fa                	cmp    %edi,%edx
+  80128e:	7f 06                	jg     801296 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801290:	01 c2                	add    %eax,%edx
+  801292:	39 d7                	cmp    %edx,%edi
+  801294:	72 28                	jb     8012be <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801296:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  80129d:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8012a3:	77 74                	ja     801319 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8012a5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012aa:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8012ad:	89 d8                	mov    %ebx,%eax
+  8012af:	e8 a5 fe ff ff       	call   801159 <file_read_direct>
+  8012b4:	85 c0                	test   %eax,%eax
+  8012b6:	7e 35                	jle    8012ed <devfile_read+0x99>
+		ff->buf_base = pos;
+  8012b8:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8012bb:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8012be:	8b 53 14             	mov    0x14(%ebx),%edx
+  8012c1:	89 d0                	mov    %edx,%eax
+  8012c3:	03 43 18             	add    0x18(%ebx),%eax
+  8012c6:	29 f8                	sub    %edi,%eax
+  8012c8:	39 f0                	cmp    %esi,%eax
+  8012ca:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8012cd:	83 ec 04             	sub    $0x4,%esp
+  8012d0:	56                   	push   %esi
+  8012d1:	89 f8                	mov    %edi,%eax
+  8012d3:	29 d0                	sub    %edx,%eax
+  8012d5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8012d8:	01 c1                	add    %eax,%ecx
+  8012da:	51                   	push   %ecx
+  8012db:	ff 75 0c             	push   0xc(%ebp)
+  8012de:	e8 b5 1a 00 00       	call   802d98 <memmove>
+	fd->fd_offset = pos + n;
+  8012e3:	01 f7                	add    %esi,%edi
+  8012e5:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8012e8:	89 f0                	mov    %esi,%eax
+  8012ea:	83 c4 10             	add    $0x10,%esp
+}
+  8012ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f0:	5b                   	pop    %ebx
+  8012f1:	5e                   	pop    %esi
+  8012f2:	5f                   	pop    %edi
+  8012f3:	5d                   	pop    %ebp
+  8012f4:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  8012f5:	89 f1                	mov    %esi,%ecx
+  8012f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012fa:	89 d8                	mov    %ebx,%eax
+  8012fc:	e8 58 fe ff ff       	call   801159 <file_read_direct>
+  801301:	eb ea                	jmp    8012ed <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801303:	83 ec 0c             	sub    $0xc,%esp
+  801306:	53                   	push   %ebx
+  801307:	e8 db fa ff ff       	call   800de7 <devfile_sync>
+  80130c:	83 c4 10             	add    $0x10,%esp
+  80130f:	85 c0                	test   %eax,%eax
+  801311:	0f 89 6b ff ff ff    	jns    801282 <devfile_read+0x2e>
+  801317:	eb d4                	jmp    8012ed <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801319:	89 f1                	mov    %esi,%ecx
+  80131b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80131e:	89 d8                	mov    %ebx,%eax
+  801320:	e8 34 fe ff ff       	call   801159 <file_read_direct>
+  801325:	eb c6                	jmp    8012ed <devfile_read+0x99>
+
+00801327 <open>:
+{
+  801327:	55                   	push   %ebp
+  801328:	89 e5                	mov    %esp,%ebp
+  80132a:	56                   	push   %esi
+  80132b:	53                   	push   %ebx
+  80132c:	83 ec 1c             	sub    $0x1c,%esp
+  80132f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801332:	56                   	push   %esi
+  801333:	e8 9f 18 00 00       	call   802bd7 <strlen>
+  801338:	83 c4 10             	add    $0x10,%esp
+  80133b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801340:	0f 8f a0 00 00 00    	jg     8013e6 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801346:	83 ec 0c             	sub    $0xc,%esp
+  801349:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80134c:	50                   	push   %eax
+  80134d:	e8 63 f2 ff ff       	call   8005b5 <fd_alloc>
+  801352:	89 c3                	mov    %eax,%ebx
+  801354:	83 c4 10             	add    $0x10,%esp
+  801357:	85 c0                	test   %eax,%eax
+  801359:	78 45                	js     8013a0 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  80135b:	83 ec 08             	sub    $0x8,%esp
+  80135e:	56                   	push   %esi
+  80135f:	68 00 60 80 00       	push   $0x806000
+  801364:	e8 a9 18 00 00       	call   802c12 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801369:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80136c:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801371:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801374:	b8 01 00 00 00       	mov    $0x1,%eax
+  801379:	e8 c5 f9 ff ff       	call   800d43 <fsipc>
+  80137e:	89 c3                	mov    %eax,%ebx
+  801380:	83 c4 10             	add    $0x10,%esp
+  801383:	85 c0                	test   %eax,%eax
+  801385:	78 22                	js     8013a9 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801387:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  80138e:	74 2b                	je     8013bb <open+0x94>
+	return fd2num(fd);
+  801390:	83 ec 0c             	sub    $0xc,%esp
+  801393:	ff 75 f4             	push   -0xc(%ebp)
+  801396:	e8 f3 f1 ff ff       	call   80058e <fd2num>
+  80139b:	89 c3                	mov    %eax,%ebx
+  80139d:	83 c4 10             	add    $0x10,%esp
+}
+  8013a0:	89 d8                	mov    %ebx,%eax
+  8013a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013a5:	5b                   	pop    %ebx
+  8013a6:	5e                   	pop    %esi
+  8013a7:	5d                   	pop    %ebp
+  8013a8:	c3                   	ret
+		fd_close(fd, 0);
+  8013a9:	83 ec 08             	sub    $0x8,%esp
+  8013ac:	6a 00                	push   $0x0
+  8013ae:	ff 75 f4             	push   -0xc(%ebp)
+  8013b1:	e8 f8 f2 ff ff       	call   8006ae <fd_close>
+		return r;
+  8013b6:	83 c4 10             	add    $0x10,%esp
+  8013b9:	eb e5                	jmp    8013a0 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8013bb:	83 ec 0c             	sub    $0xc,%esp
+  8013be:	ff 75 f4             	push   -0xc(%ebp)
+  8013c1:	e8 d8 f1 ff ff       	call   80059e <fd2data>
+  8013c6:	83 c4 0c             	add    $0xc,%esp
+  8013c9:	68 07 04 00 00       	push   $0x407
+  8013ce:	50                   	push   %eax
+  8013cf:	6a 00                	push   $0x0
+  8013d1:	e8 b7 ed ff ff       	call   80018d <sys_page_alloc>
+  8013d6:	83 c4 10             	add    $0x10,%esp
+  8013d9:	85 c0                	test   %eax,%eax
+  8013db:	75 b3                	jne    801390 <open+0x69>
+		fd->fd_file.buffered = 1;
+  8013dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013e0:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8013e4:	eb aa                	jmp    801390 <open+0x69>
+		return -E_BAD_PATH;
+  8013e6:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8013eb:	eb b3                	jmp    8013a0 <open+0x79>
+
+008013ed <readdir>:
+{
+  8013ed:	55                   	push   %ebp
+  8013ee:	89 e5                	mov    %esp,%ebp
+  8013f0:	53                   	push   %ebx
+  8013f1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013f7:	50                   	push   %eax
+  8013f8:	ff 75 08             	push   0x8(%ebp)
+  8013fb:	e8 0b f2 ff ff       	call   80060b <fd_lookup>
+  801400:	89 c3                	mov    %eax,%ebx
+  801402:	83 c4 10             	add    $0x10,%esp
+  801405:	85 c0                	test   %eax,%eax
+  801407:	78 73                	js     80147c <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801409:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80140c:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801412:	39 08                	cmp    %ecx,(%eax)
+  801414:	0f 85 82 00 00 00    	jne    80149c <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  80141a:	83 ec 0c             	sub    $0xc,%esp
+  80141d:	50                   	push   %eax
+  80141e:	e8 c4 f9 ff ff       	call   800de7 <devfile_sync>
+  801423:	89 c3                	mov    %eax,%ebx
+  801425:	83 c4 10             	add    $0x10,%esp
+  801428:	85 c0                	test   %eax,%eax
+  80142a:	78 50                	js     80147c <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  80142c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80142f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801432:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801437:	8b 45 10             	mov    0x10(%ebp),%eax
+  80143a:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  80143f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801442:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801447:	ba 00 00 00 00       	mov    $0x0,%edx
+  80144c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801451:	e8 ed f8 ff ff       	call   800d43 <fsipc>
+  801456:	89 c3                	mov    %eax,%ebx
+  801458:	85 c0                	test   %eax,%eax
+  80145a:	7e 20                	jle    80147c <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  80145c:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80145f:	72 22                	jb     801483 <readdir+0x96>
+  801461:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801466:	7f 1b                	jg     801483 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801468:	83 ec 04             	sub    $0x4,%esp
+  80146b:	50                   	push   %eax
+  80146c:	68 00 60 80 00       	push   $0x806000
+  801471:	ff 75 0c             	push   0xc(%ebp)
+  801474:	e8 1f 19 00 00       	call   802d98 <memmove>
+	return r;
+  801479:	83 c4 10             	add    $0x10,%esp
+}
+  80147c:	89 d8                	mov    %ebx,%eax
+  80147e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801481:	c9                   	leave
+  801482:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801483:	68 77 38 80 00       	push   $0x803877
+  801488:	68 50 38 80 00       	push   $0x803850
+  80148d:	68 86 01 00 00       	push   $0x186
+  801492:	68 65 38 80 00       	push   $0x803865
+  801497:	e8 ad 10 00 00       	call   802549 <_panic>
+		return -E_NOT_SUPP;
+  80149c:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8014a1:	eb d9                	jmp    80147c <readdir+0x8f>
+
+008014a3 <munmap>:
+{
+  8014a3:	55                   	push   %ebp
+  8014a4:	89 e5                	mov    %esp,%ebp
+  8014a6:	56                   	push   %esi
+  8014a7:	53                   	push   %ebx
+  8014a8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8014ae:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8014b4:	75 41                	jne    8014f7 <munmap+0x54>
+  8014b6:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8014bc:	77 39                	ja     8014f7 <munmap+0x54>
+  8014be:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8014c3:	29 f0                	sub    %esi,%eax
+  8014c5:	39 d0                	cmp    %edx,%eax
+  8014c7:	72 35                	jb     8014fe <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014c9:	89 f3                	mov    %esi,%ebx
+  8014cb:	01 d6                	add    %edx,%esi
+  8014cd:	39 f3                	cmp    %esi,%ebx
+  8014cf:	73 1a                	jae    8014eb <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8014d1:	83 ec 08             	sub    $0x8,%esp
+  8014d4:	53                   	push   %ebx
+  8014d5:	6a 00                	push   $0x0
+  8014d7:	e8 3e ed ff ff       	call   80021a <sys_page_unmap>
+  8014dc:	83 c4 10             	add    $0x10,%esp
+  8014df:	85 c0                	test   %eax,%eax
+  8014e1:	78 0d                	js     8014f0 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014e3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8014e9:	eb e2                	jmp    8014cd <munmap+0x2a>
+	return 0;
+  8014eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014f3:	5b                   	pop    %ebx
+  8014f4:	5e                   	pop    %esi
+  8014f5:	5d                   	pop    %ebp
+  8014f6:	c3                   	ret
+		return -E_INVAL;
+  8014f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014fc:	eb f2                	jmp    8014f0 <munmap+0x4d>
+  8014fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801503:	eb eb                	jmp    8014f0 <munmap+0x4d>
+
+00801505 <mmap>:
+{
+  801505:	55                   	push   %ebp
+  801506:	89 e5                	mov    %esp,%ebp
+  801508:	57                   	push   %edi
+  801509:	56                   	push   %esi
+  80150a:	53                   	push   %ebx
+  80150b:	83 ec 34             	sub    $0x34,%esp
+  80150e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801511:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801514:	50                   	push   %eax
+  801515:	ff 75 18             	push   0x18(%ebp)
+  801518:	e8 ee f0 ff ff       	call   80060b <fd_lookup>
+  80151d:	89 c3                	mov    %eax,%ebx
+  80151f:	83 c4 10             	add    $0x10,%esp
+  801522:	85 c0                	test   %eax,%eax
+  801524:	0f 88 0e 01 00 00    	js     801638 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80152a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80152d:	a1 20 40 80 00       	mov    0x804020,%eax
+  801532:	39 02                	cmp    %eax,(%edx)
+  801534:	0f 85 50 01 00 00    	jne    80168a <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  80153a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80153d:	83 e0 02             	and    $0x2,%eax
+  801540:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801543:	74 0a                	je     80154f <mmap+0x4a>
+  801545:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801549:	0f 84 42 01 00 00    	je     801691 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  80154f:	8b 42 08             	mov    0x8(%edx),%eax
+  801552:	83 e0 03             	and    $0x3,%eax
+  801555:	83 f8 01             	cmp    $0x1,%eax
+  801558:	0f 84 3a 01 00 00    	je     801698 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  80155e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801561:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801564:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801569:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80156c:	0f 85 2d 01 00 00    	jne    80169f <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801572:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801576:	0f 88 2a 01 00 00    	js     8016a6 <mmap+0x1a1>
+  80157c:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  801583:	0f 87 1d 01 00 00    	ja     8016a6 <mmap+0x1a1>
+  801589:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80158e:	2b 45 08             	sub    0x8(%ebp),%eax
+  801591:	39 f8                	cmp    %edi,%eax
+  801593:	0f 82 14 01 00 00    	jb     8016ad <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  801599:	83 ec 0c             	sub    $0xc,%esp
+  80159c:	52                   	push   %edx
+  80159d:	e8 45 f8 ff ff       	call   800de7 <devfile_sync>
+  8015a2:	89 c3                	mov    %eax,%ebx
+  8015a4:	83 c4 10             	add    $0x10,%esp
+  8015a7:	85 c0                	test   %eax,%eax
+  8015a9:	0f 88 89 00 00 00    	js     801638 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8015af:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8015b5:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8015bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c0:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8015c3:	39 fe                	cmp    %edi,%esi
+  8015c5:	73 7b                	jae    801642 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8015c7:	89 f8                	mov    %edi,%eax
+  8015c9:	29 f0                	sub    %esi,%eax
+  8015cb:	c1 e8 0c             	shr    $0xc,%eax
+  8015ce:	ba 40 00 00 00       	mov    $0x40,%edx
+  8015d3:	39 d0                	cmp    %edx,%eax
+  8015d5:	0f 47 c2             	cmova  %edx,%eax
+  8015d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8015db:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015de:	8b 52 0c             	mov    0xc(%edx),%edx
+  8015e1:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  8015e7:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8015ea:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  8015f0:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8015f5:	89 f2                	mov    %esi,%edx
+  8015f7:	03 55 08             	add    0x8(%ebp),%edx
+  8015fa:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8015fd:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801602:	e8 ea f6 ff ff       	call   800cf1 <fsipcv>
+  801607:	85 c0                	test   %eax,%eax
+  801609:	7e 12                	jle    80161d <mmap+0x118>
+  80160b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80160e:	85 c0                	test   %eax,%eax
+  801610:	0f 84 9e 00 00 00    	je     8016b4 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801616:	c1 e0 0c             	shl    $0xc,%eax
+  801619:	01 c6                	add    %eax,%esi
+  80161b:	eb a6                	jmp    8015c3 <mmap+0xbe>
+			munmap(addr, done);
+  80161d:	89 c3                	mov    %eax,%ebx
+  80161f:	83 ec 08             	sub    $0x8,%esp
+  801622:	56                   	push   %esi
+  801623:	ff 75 08             	push   0x8(%ebp)
+  801626:	e8 78 fe ff ff       	call   8014a3 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80162b:	83 c4 10             	add    $0x10,%esp
+  80162e:	85 db                	test   %ebx,%ebx
+  801630:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801635:	0f 49 d8             	cmovns %eax,%ebx
+}
+  801638:	89 d8                	mov    %ebx,%eax
+  80163a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163d:	5b                   	pop    %ebx
+  80163e:	5e                   	pop    %esi
+  80163f:	5f                   	pop    %edi
+  801640:	5d                   	pop    %ebp
+  801641:	c3                   	ret
+	if (prot & PROT_WRITE)
+  801642:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  801645:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  801647:	85 c0                	test   %eax,%eax
+  801649:	74 ed                	je     801638 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80164b:	be 00 00 00 00       	mov    $0x0,%esi
+  801650:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801653:	39 fe                	cmp    %edi,%esi
+  801655:	73 2e                	jae    801685 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  801657:	83 ec 0c             	sub    $0xc,%esp
+  80165a:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  80165d:	50                   	push   %eax
+  80165e:	e8 f6 19 00 00       	call   803059 <cowpage>
+  801663:	83 c4 10             	add    $0x10,%esp
+  801666:	85 c0                	test   %eax,%eax
+  801668:	78 08                	js     801672 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  80166a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801670:	eb e1                	jmp    801653 <mmap+0x14e>
+				munmap(addr, len);
+  801672:	89 c3                	mov    %eax,%ebx
+  801674:	83 ec 08             	sub    $0x8,%esp
+  801677:	57                   	push   %edi
+  801678:	ff 75 08             	push   0x8(%ebp)
+  80167b:	e8 23 fe ff ff       	call   8014a3 <munmap>
+				return r;
+  801680:	83 c4 10             	add    $0x10,%esp
+  801683:	eb b3                	jmp    801638 <mmap+0x133>
+	return 0;
+  801685:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801688:	eb ae                	jmp    801638 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80168a:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80168f:	eb a7                	jmp    801638 <mmap+0x133>
+		return -E_NOT_SUPP;
+  801691:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801696:	eb a0                	jmp    801638 <mmap+0x133>
+		return -E_INVAL;
+  801698:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80169d:	eb 99                	jmp    801638 <mmap+0x133>
+  80169f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016a4:	eb 92                	jmp    801638 <mmap+0x133>
+  8016a6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016ab:	eb 8b                	jmp    801638 <mmap+0x133>
+  8016ad:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016b2:	eb 84                	jmp    801638 <mmap+0x133>
+			munmap(addr, done);
+  8016b4:	83 ec 08             	sub    $0x8,%esp
+  8016b7:	56                   	push   %esi
+  8016b8:	ff 75 08             	push   0x8(%ebp)
+  8016bb:	e8 e3 fd ff ff       	call   8014a3 <munmap>
+  8016c0:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8016c3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016c8:	e9 6b ff ff ff       	jmp    801638 <mmap+0x133>
+
+008016cd <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8016cd:	55                   	push   %ebp
+  8016ce:	89 e5                	mov    %esp,%ebp
+  8016d0:	56                   	push   %esi
+  8016d1:	53                   	push   %ebx
+  8016d2:	83 ec 10             	sub    $0x10,%esp
+  8016d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8016d8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016de:	e8 3d f9 ff ff       	call   801020 <fsring_slot>
+  8016e3:	85 c0                	test   %eax,%eax
+  8016e5:	78 60                	js     801747 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8016e7:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8016ea:	8b 56 08             	mov    0x8(%esi),%edx
+  8016ed:	83 e2 03             	and    $0x3,%edx
+  8016f0:	83 fa 01             	cmp    $0x1,%edx
+  8016f3:	74 59                	je     80174e <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8016f5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8016fa:	89 c1                	mov    %eax,%ecx
+  8016fc:	d3 e2                	shl    %cl,%edx
+  8016fe:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  801704:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  801707:	c1 e2 02             	shl    $0x2,%edx
+  80170a:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  801710:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  801717:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80171a:	8b 55 18             	mov    0x18(%ebp),%edx
+  80171d:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  801720:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801723:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  801726:	83 ec 08             	sub    $0x8,%esp
+  801729:	50                   	push   %eax
+  80172a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80172f:	39 c3                	cmp    %eax,%ebx
+  801731:	0f 47 d8             	cmova  %eax,%ebx
+  801734:	53                   	push   %ebx
+  801735:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801738:	89 f2                	mov    %esi,%edx
+  80173a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80173f:	e8 1e f5 ff ff       	call   800c62 <fsring_post>
+  801744:	83 c4 10             	add    $0x10,%esp
+}
+  801747:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80174a:	5b                   	pop    %ebx
+  80174b:	5e                   	pop    %esi
+  80174c:	5d                   	pop    %ebp
+  80174d:	c3                   	ret
+		return -E_INVAL;
+  80174e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801753:	eb f2                	jmp    801747 <fsring_read+0x7a>
+
+00801755 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  801755:	55                   	push   %ebp
+  801756:	89 e5                	mov    %esp,%ebp
+  801758:	56                   	push   %esi
+  801759:	53                   	push   %ebx
+  80175a:	83 ec 10             	sub    $0x10,%esp
+  80175d:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  801760:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801763:	8b 45 08             	mov    0x8(%ebp),%eax
+  801766:	e8 b5 f8 ff ff       	call   801020 <fsring_slot>
+  80176b:	89 c3                	mov    %eax,%ebx
+  80176d:	85 c0                	test   %eax,%eax
+  80176f:	78 77                	js     8017e8 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801771:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801774:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801778:	74 77                	je     8017f1 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80177a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80177f:	39 c6                	cmp    %eax,%esi
+  801781:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  801784:	83 ec 04             	sub    $0x4,%esp
+  801787:	56                   	push   %esi
+  801788:	ff 75 0c             	push   0xc(%ebp)
+  80178b:	89 d8                	mov    %ebx,%eax
+  80178d:	c1 e0 0c             	shl    $0xc,%eax
+  801790:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  801796:	50                   	push   %eax
+  801797:	e8 fc 15 00 00       	call   802d98 <memmove>
+	fsring_busy |= 1 << slot;
+  80179c:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017a1:	89 d9                	mov    %ebx,%ecx
+  8017a3:	d3 e0                	shl    %cl,%eax
+  8017a5:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8017ab:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8017ae:	c1 e0 02             	shl    $0x2,%eax
+  8017b1:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8017b7:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8017be:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8017c1:	8b 45 18             	mov    0x18(%ebp),%eax
+  8017c4:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8017c7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8017ce:	83 c4 08             	add    $0x8,%esp
+  8017d1:	53                   	push   %ebx
+  8017d2:	56                   	push   %esi
+  8017d3:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8017d6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8017d9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017de:	e8 7f f4 ff ff       	call   800c62 <fsring_post>
+  8017e3:	89 c3                	mov    %eax,%ebx
+  8017e5:	83 c4 10             	add    $0x10,%esp
+}
+  8017e8:	89 d8                	mov    %ebx,%eax
+  8017ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017ed:	5b                   	pop    %ebx
+  8017ee:	5e                   	pop    %esi
+  8017ef:	5d                   	pop    %ebp
+  8017f0:	c3                   	ret
+		return -E_INVAL;
+  8017f1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8017f6:	eb f0                	jmp    8017e8 <fsring_write+0x93>
+
+008017f8 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8017f8:	55                   	push   %ebp
+  8017f9:	89 e5                	mov    %esp,%ebp
+  8017fb:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8017fe:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801801:	8b 45 08             	mov    0x8(%ebp),%eax
+  801804:	e8 17 f8 ff ff       	call   801020 <fsring_slot>
+  801809:	85 c0                	test   %eax,%eax
+  80180b:	78 4c                	js     801859 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  80180d:	ba 01 00 00 00       	mov    $0x1,%edx
+  801812:	89 c1                	mov    %eax,%ecx
+  801814:	d3 e2                	shl    %cl,%edx
+  801816:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  80181c:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80181f:	c1 e2 02             	shl    $0x2,%edx
+  801822:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  801828:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  80182f:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  801832:	8b 55 10             	mov    0x10(%ebp),%edx
+  801835:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  801838:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80183b:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80183e:	83 ec 08             	sub    $0x8,%esp
+  801841:	50                   	push   %eax
+  801842:	6a 00                	push   $0x0
+  801844:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801849:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80184c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801851:	e8 0c f4 ff ff       	call   800c62 <fsring_post>
+  801856:	83 c4 10             	add    $0x10,%esp
+}
+  801859:	c9                   	leave
+  80185a:	c3                   	ret
+
+0080185b <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  80185b:	55                   	push   %ebp
+  80185c:	89 e5                	mov    %esp,%ebp
+  80185e:	57                   	push   %edi
+  80185f:	56                   	push   %esi
+  801860:	53                   	push   %ebx
+  801861:	83 ec 1c             	sub    $0x1c,%esp
+  801864:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  801868:	a1 00 50 80 00       	mov    0x805000,%eax
+  80186d:	8b 40 48             	mov    0x48(%eax),%eax
+  801870:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801876:	74 12                	je     80188a <fsring_reap+0x2f>
+		return 0;
+  801878:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  80187d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801880:	5b                   	pop    %ebx
+  801881:	5e                   	pop    %esi
+  801882:	5f                   	pop    %edi
+  801883:	5d                   	pop    %ebp
+  801884:	c3                   	ret
+		sys_yield();
+  801885:	e8 e4 e8 ff ff       	call   80016e <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  80188a:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  801890:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  801895:	39 c2                	cmp    %eax,%edx
+  801897:	75 18                	jne    8018b1 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  801899:	84 db                	test   %bl,%bl
+  80189b:	0f 84 21 01 00 00    	je     8019c2 <fsring_reap+0x167>
+  8018a1:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  8018a8:	75 db                	jne    801885 <fsring_reap+0x2a>
+			return 0;
+  8018aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018af:	eb cc                	jmp    80187d <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8018b1:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018b6:	83 e0 0f             	and    $0xf,%eax
+  8018b9:	83 c0 2a             	add    $0x2a,%eax
+  8018bc:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8018c3:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8018ca:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018cf:	83 c0 01             	add    $0x1,%eax
+  8018d2:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8018d7:	83 fb 0f             	cmp    $0xf,%ebx
+  8018da:	77 5b                	ja     801937 <fsring_reap+0xdc>
+  8018dc:	be 01 00 00 00       	mov    $0x1,%esi
+  8018e1:	89 d9                	mov    %ebx,%ecx
+  8018e3:	d3 e6                	shl    %cl,%esi
+  8018e5:	89 f0                	mov    %esi,%eax
+  8018e7:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8018ed:	74 48                	je     801937 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8018ef:	89 d8                	mov    %ebx,%eax
+  8018f1:	c1 e0 0c             	shl    $0xc,%eax
+  8018f4:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8018fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8018fd:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801900:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  801907:	83 f8 03             	cmp    $0x3,%eax
+  80190a:	74 40                	je     80194c <fsring_reap+0xf1>
+  80190c:	83 f8 05             	cmp    $0x5,%eax
+  80190f:	74 64                	je     801975 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  801911:	f7 d6                	not    %esi
+  801913:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  801919:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80191c:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  801923:	8b 45 08             	mov    0x8(%ebp),%eax
+  801926:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  801928:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80192b:	89 38                	mov    %edi,(%eax)
+	return 1;
+  80192d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801932:	e9 46 ff ff ff       	jmp    80187d <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  801937:	53                   	push   %ebx
+  801938:	68 8d 38 80 00       	push   $0x80388d
+  80193d:	68 8f 02 00 00       	push   $0x28f
+  801942:	68 65 38 80 00       	push   $0x803865
+  801947:	e8 fd 0b 00 00       	call   802549 <_panic>
+		if (cqe.cqe_result > 0)
+  80194c:	85 ff                	test   %edi,%edi
+  80194e:	7e c1                	jle    801911 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801950:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  801953:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801958:	39 c7                	cmp    %eax,%edi
+  80195a:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80195d:	50                   	push   %eax
+  80195e:	ff 75 e4             	push   -0x1c(%ebp)
+  801961:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801964:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  80196b:	e8 28 14 00 00       	call   802d98 <memmove>
+  801970:	83 c4 10             	add    $0x10,%esp
+  801973:	eb 9c                	jmp    801911 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  801975:	85 ff                	test   %edi,%edi
+  801977:	75 98                	jne    801911 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  801979:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80197c:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  801983:	83 ec 08             	sub    $0x8,%esp
+  801986:	ff 75 e4             	push   -0x1c(%ebp)
+  801989:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80198c:	51                   	push   %ecx
+  80198d:	e8 80 12 00 00       	call   802c12 <strcpy>
+			st->st_size = ret->ret_size;
+  801992:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801995:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  80199b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80199e:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8019a4:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8019aa:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8019b0:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8019b7:	40 80 00 
+  8019ba:	83 c4 10             	add    $0x10,%esp
+  8019bd:	e9 4f ff ff ff       	jmp    801911 <fsring_reap+0xb6>
+			return 0;
+  8019c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c7:	e9 b1 fe ff ff       	jmp    80187d <fsring_reap+0x22>
+
+008019cc <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8019cc:	55                   	push   %ebp
+  8019cd:	89 e5                	mov    %esp,%ebp
+  8019cf:	57                   	push   %edi
+  8019d0:	56                   	push   %esi
+  8019d1:	53                   	push   %ebx
+  8019d2:	83 ec 28             	sub    $0x28,%esp
+  8019d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019d8:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8019db:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8019de:	53                   	push   %ebx
+  8019df:	e8 f3 11 00 00       	call   802bd7 <strlen>
+  8019e4:	83 c4 10             	add    $0x10,%esp
+  8019e7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019ec:	0f 8f 02 01 00 00    	jg     801af4 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8019f2:	83 ec 08             	sub    $0x8,%esp
+  8019f5:	53                   	push   %ebx
+  8019f6:	68 00 60 80 00       	push   $0x806000
+  8019fb:	e8 12 12 00 00       	call   802c12 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  801a00:	83 c4 10             	add    $0x10,%esp
+  801a03:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  801a09:	76 69                	jbe    801a74 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801a0b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a0e:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801a14:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801a19:	29 d1                	sub    %edx,%ecx
+  801a1b:	39 f9                	cmp    %edi,%ecx
+  801a1d:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a20:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a23:	89 f9                	mov    %edi,%ecx
+  801a25:	01 c1                	add    %eax,%ecx
+  801a27:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a2a:	eb 0f                	jmp    801a3b <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  801a2c:	0f b6 10             	movzbl (%eax),%edx
+  801a2f:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a31:	05 00 10 00 00       	add    $0x1000,%eax
+  801a36:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a3b:	39 c8                	cmp    %ecx,%eax
+  801a3d:	72 ed                	jb     801a2c <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  801a3f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a42:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  801a48:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  801a4e:	83 ec 0c             	sub    $0xc,%esp
+  801a51:	6a 07                	push   $0x7
+  801a53:	89 f9                	mov    %edi,%ecx
+  801a55:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a58:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a5d:	e8 3f f1 ff ff       	call   800ba1 <fsipc_pages>
+  801a62:	89 c7                	mov    %eax,%edi
+  801a64:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  801a67:	85 f6                	test   %esi,%esi
+  801a69:	74 7f                	je     801aea <file_slurp+0x11e>
+  801a6b:	8d 43 01             	lea    0x1(%ebx),%eax
+  801a6e:	85 ff                	test   %edi,%edi
+  801a70:	79 3c                	jns    801aae <file_slurp+0xe2>
+  801a72:	eb 76                	jmp    801aea <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  801a74:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  801a7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a7f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a84:	e8 ba f2 ff ff       	call   800d43 <fsipc>
+  801a89:	89 c7                	mov    %eax,%edi
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	7e d8                	jle    801a67 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  801a8f:	83 ec 04             	sub    $0x4,%esp
+  801a92:	50                   	push   %eax
+  801a93:	68 08 60 80 00       	push   $0x806008
+  801a98:	ff 75 0c             	push   0xc(%ebp)
+  801a9b:	e8 f8 12 00 00       	call   802d98 <memmove>
+  801aa0:	83 c4 10             	add    $0x10,%esp
+  801aa3:	eb c2                	jmp    801a67 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  801aa5:	80 fa 2f             	cmp    $0x2f,%dl
+  801aa8:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  801aab:	83 c0 01             	add    $0x1,%eax
+  801aae:	89 c1                	mov    %eax,%ecx
+  801ab0:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  801ab4:	84 d2                	test   %dl,%dl
+  801ab6:	75 ed                	jne    801aa5 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  801ab8:	83 ec 04             	sub    $0x4,%esp
+  801abb:	68 80 00 00 00       	push   $0x80
+  801ac0:	53                   	push   %ebx
+  801ac1:	56                   	push   %esi
+  801ac2:	e8 c1 11 00 00       	call   802c88 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  801ac7:	a1 00 60 80 00       	mov    0x806000,%eax
+  801acc:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  801ad2:	a1 04 60 80 00       	mov    0x806004,%eax
+  801ad7:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  801add:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  801ae4:	40 80 00 
+  801ae7:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801aea:	89 f8                	mov    %edi,%eax
+  801aec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aef:	5b                   	pop    %ebx
+  801af0:	5e                   	pop    %esi
+  801af1:	5f                   	pop    %edi
+  801af2:	5d                   	pop    %ebp
+  801af3:	c3                   	ret
+		return -E_BAD_PATH;
+  801af4:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  801af9:	eb ef                	jmp    801aea <file_slurp+0x11e>
+
+00801afb <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801afb:	55                   	push   %ebp
+  801afc:	89 e5                	mov    %esp,%ebp
+  801afe:	53                   	push   %ebx
+  801aff:	83 ec 10             	sub    $0x10,%esp
+  801b02:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b05:	53                   	push   %ebx
+  801b06:	e8 cc 10 00 00       	call   802bd7 <strlen>
+  801b0b:	83 c4 10             	add    $0x10,%esp
+  801b0e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b13:	7f 25                	jg     801b3a <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b15:	83 ec 08             	sub    $0x8,%esp
+  801b18:	53                   	push   %ebx
+  801b19:	68 00 60 80 00       	push   $0x806000
+  801b1e:	e8 ef 10 00 00       	call   802c12 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b28:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b2d:	e8 11 f2 ff ff       	call   800d43 <fsipc>
+  801b32:	83 c4 10             	add    $0x10,%esp
+}
+  801b35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b38:	c9                   	leave
+  801b39:	c3                   	ret
+		return -E_BAD_PATH;
+  801b3a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b3f:	eb f4                	jmp    801b35 <remove+0x3a>
+
+00801b41 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b41:	55                   	push   %ebp
+  801b42:	89 e5                	mov    %esp,%ebp
+  801b44:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b47:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b4c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b51:	e8 ed f1 ff ff       	call   800d43 <fsipc>
+}
+  801b56:	c9                   	leave
+  801b57:	c3                   	ret
+
+00801b58 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  801b58:	55                   	push   %ebp
+  801b59:	89 e5                	mov    %esp,%ebp
+  801b5b:	57                   	push   %edi
+  801b5c:	56                   	push   %esi
+  801b5d:	53                   	push   %ebx
+  801b5e:	83 ec 18             	sub    $0x18,%esp
+  801b61:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b64:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801b6a:	57                   	push   %edi
+  801b6b:	e8 67 10 00 00       	call   802bd7 <strlen>
+  801b70:	83 c4 10             	add    $0x10,%esp
+  801b73:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b78:	7f 4c                	jg     801bc6 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  801b7a:	83 ec 08             	sub    $0x8,%esp
+  801b7d:	57                   	push   %edi
+  801b7e:	68 00 60 80 00       	push   $0x806000
+  801b83:	e8 8a 10 00 00       	call   802c12 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  801b88:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b8d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801b92:	e8 ac f1 ff ff       	call   800d43 <fsipc>
+  801b97:	83 c4 10             	add    $0x10,%esp
+  801b9a:	85 c0                	test   %eax,%eax
+  801b9c:	78 20                	js     801bbe <defrag+0x66>
+		return r;
+	if (before)
+  801b9e:	85 f6                	test   %esi,%esi
+  801ba0:	74 07                	je     801ba9 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  801ba2:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ba7:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  801ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  801bae:	85 db                	test   %ebx,%ebx
+  801bb0:	74 0c                	je     801bbe <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  801bb2:	a1 04 60 80 00       	mov    0x806004,%eax
+  801bb7:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  801bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bc1:	5b                   	pop    %ebx
+  801bc2:	5e                   	pop    %esi
+  801bc3:	5f                   	pop    %edi
+  801bc4:	5d                   	pop    %ebp
+  801bc5:	c3                   	ret
+		return -E_BAD_PATH;
+  801bc6:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801bcb:	eb f1                	jmp    801bbe <defrag+0x66>
+
+00801bcd <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  801bcd:	55                   	push   %ebp
+  801bce:	89 e5                	mov    %esp,%ebp
+  801bd0:	53                   	push   %ebx
+  801bd1:	83 ec 04             	sub    $0x4,%esp
+  801bd4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  801bd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bdc:	b8 11 00 00 00       	mov    $0x11,%eax
+  801be1:	e8 5d f1 ff ff       	call   800d43 <fsipc>
+  801be6:	85 c0                	test   %eax,%eax
+  801be8:	78 34                	js     801c1e <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  801bea:	a1 00 60 80 00       	mov    0x806000,%eax
+  801bef:	89 03                	mov    %eax,(%ebx)
+  801bf1:	a1 04 60 80 00       	mov    0x806004,%eax
+  801bf6:	89 43 04             	mov    %eax,0x4(%ebx)
+  801bf9:	a1 08 60 80 00       	mov    0x806008,%eax
+  801bfe:	89 43 08             	mov    %eax,0x8(%ebx)
+  801c01:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  801c06:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801c09:	a1 10 60 80 00       	mov    0x806010,%eax
+  801c0e:	89 43 10             	mov    %eax,0x10(%ebx)
+  801c11:	a1 14 60 80 00       	mov    0x806014,%eax
+  801c16:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  801c19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c21:	c9                   	leave
+  801c22:	c3                   	ret
+
+00801c23 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c23:	55                   	push   %ebp
+  801c24:	89 e5                	mov    %esp,%ebp
+  801c26:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c29:	68 a6 38 80 00       	push   $0x8038a6
+  801c2e:	ff 75 0c             	push   0xc(%ebp)
+  801c31:	e8 dc 0f 00 00       	call   802c12 <strcpy>
+	return 0;
+}
+  801c36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c3b:	c9                   	leave
+  801c3c:	c3                   	ret
+
+00801c3d <devsock_close>:
+{
+  801c3d:	55                   	push   %ebp
+  801c3e:	89 e5                	mov    %esp,%ebp
+  801c40:	53                   	push   %ebx
+  801c41:	83 ec 10             	sub    $0x10,%esp
+  801c44:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c47:	53                   	push   %ebx
+  801c48:	e8 ed 17 00 00       	call   80343a <pageref>
+  801c4d:	89 c2                	mov    %eax,%edx
+  801c4f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c52:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c57:	83 fa 01             	cmp    $0x1,%edx
+  801c5a:	74 05                	je     801c61 <devsock_close+0x24>
+}
+  801c5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c5f:	c9                   	leave
+  801c60:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c61:	83 ec 0c             	sub    $0xc,%esp
+  801c64:	ff 73 0c             	push   0xc(%ebx)
+  801c67:	e8 b7 02 00 00       	call   801f23 <nsipc_close>
+  801c6c:	83 c4 10             	add    $0x10,%esp
+  801c6f:	eb eb                	jmp    801c5c <devsock_close+0x1f>
+
+00801c71 <devsock_write>:
+{
+  801c71:	55                   	push   %ebp
+  801c72:	89 e5                	mov    %esp,%ebp
+  801c74:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c77:	6a 00                	push   $0x0
+  801c79:	ff 75 10             	push   0x10(%ebp)
+  801c7c:	ff 75 0c             	push   0xc(%ebp)
+  801c7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c82:	ff 70 0c             	push   0xc(%eax)
+  801c85:	e8 79 03 00 00       	call   802003 <nsipc_send>
+}
+  801c8a:	c9                   	leave
+  801c8b:	c3                   	ret
+
+00801c8c <devsock_read>:
+{
+  801c8c:	55                   	push   %ebp
+  801c8d:	89 e5                	mov    %esp,%ebp
+  801c8f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801c92:	6a 00                	push   $0x0
+  801c94:	ff 75 10             	push   0x10(%ebp)
+  801c97:	ff 75 0c             	push   0xc(%ebp)
+  801c9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c9d:	ff 70 0c             	push   0xc(%eax)
+  801ca0:	e8 ef 02 00 00       	call   801f94 <nsipc_recv>
+}
+  801ca5:	c9                   	leave
+  801ca6:	c3                   	ret
+
+00801ca7 <fd2sockid>:
+{
+  801ca7:	55                   	push   %ebp
+  801ca8:	89 e5                	mov    %esp,%ebp
+  801caa:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801cad:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801cb0:	52                   	push   %edx
+  801cb1:	50                   	push   %eax
+  801cb2:	e8 54 e9 ff ff       	call   80060b <fd_lookup>
+  801cb7:	83 c4 10             	add    $0x10,%esp
+  801cba:	85 c0                	test   %eax,%eax
+  801cbc:	78 10                	js     801cce <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801cbe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cc1:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801cc7:	39 08                	cmp    %ecx,(%eax)
+  801cc9:	75 05                	jne    801cd0 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801ccb:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801cce:	c9                   	leave
+  801ccf:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cd0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cd5:	eb f7                	jmp    801cce <fd2sockid+0x27>
+
+00801cd7 <alloc_sockfd>:
+{
+  801cd7:	55                   	push   %ebp
+  801cd8:	89 e5                	mov    %esp,%ebp
+  801cda:	56                   	push   %esi
+  801cdb:	53                   	push   %ebx
+  801cdc:	83 ec 1c             	sub    $0x1c,%esp
+  801cdf:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801ce1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ce4:	50                   	push   %eax
+  801ce5:	e8 cb e8 ff ff       	call   8005b5 <fd_alloc>
+  801cea:	89 c3                	mov    %eax,%ebx
+  801cec:	83 c4 10             	add    $0x10,%esp
+  801cef:	85 c0                	test   %eax,%eax
+  801cf1:	78 43                	js     801d36 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801cf3:	83 ec 04             	sub    $0x4,%esp
+  801cf6:	68 07 04 00 00       	push   $0x407
+  801cfb:	ff 75 f4             	push   -0xc(%ebp)
+  801cfe:	6a 00                	push   $0x0
+  801d00:	e8 88 e4 ff ff       	call   80018d <sys_page_alloc>
+  801d05:	89 c3                	mov    %eax,%ebx
+  801d07:	83 c4 10             	add    $0x10,%esp
+  801d0a:	85 c0                	test   %eax,%eax
+  801d0c:	78 28                	js     801d36 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d11:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801d17:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d23:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d26:	83 ec 0c             	sub    $0xc,%esp
+  801d29:	50                   	push   %eax
+  801d2a:	e8 5f e8 ff ff       	call   80058e <fd2num>
+  801d2f:	89 c3                	mov    %eax,%ebx
+  801d31:	83 c4 10             	add    $0x10,%esp
+  801d34:	eb 0c                	jmp    801d42 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d36:	83 ec 0c             	sub    $0xc,%esp
+  801d39:	56                   	push   %esi
+  801d3a:	e8 e4 01 00 00       	call   801f23 <nsipc_close>
+		return r;
+  801d3f:	83 c4 10             	add    $0x10,%esp
+}
+  801d42:	89 d8                	mov    %ebx,%eax
+  801d44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d47:	5b                   	pop    %ebx
+  801d48:	5e                   	pop    %esi
+  801d49:	5d                   	pop    %ebp
+  801d4a:	c3                   	ret
+
+00801d4b <accept>:
+{
+  801d4b:	55                   	push   %ebp
+  801d4c:	89 e5                	mov    %esp,%ebp
+  801d4e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d51:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d54:	e8 4e ff ff ff       	call   801ca7 <fd2sockid>
+  801d59:	85 c0                	test   %eax,%eax
+  801d5b:	78 1b                	js     801d78 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d5d:	83 ec 04             	sub    $0x4,%esp
+  801d60:	ff 75 10             	push   0x10(%ebp)
+  801d63:	ff 75 0c             	push   0xc(%ebp)
+  801d66:	50                   	push   %eax
+  801d67:	e8 0e 01 00 00       	call   801e7a <nsipc_accept>
+  801d6c:	83 c4 10             	add    $0x10,%esp
+  801d6f:	85 c0                	test   %eax,%eax
+  801d71:	78 05                	js     801d78 <accept+0x2d>
+	return alloc_sockfd(r);
+  801d73:	e8 5f ff ff ff       	call   801cd7 <alloc_sockfd>
+}
+  801d78:	c9                   	leave
+  801d79:	c3                   	ret
+
+00801d7a <bind>:
+{
+  801d7a:	55                   	push   %ebp
+  801d7b:	89 e5                	mov    %esp,%ebp
+  801d7d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d80:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d83:	e8 1f ff ff ff       	call   801ca7 <fd2sockid>
+  801d88:	85 c0                	test   %eax,%eax
+  801d8a:	78 12                	js     801d9e <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d8c:	83 ec 04             	sub    $0x4,%esp
+  801d8f:	ff 75 10             	push   0x10(%ebp)
+  801d92:	ff 75 0c             	push   0xc(%ebp)
+  801d95:	50                   	push   %eax
+  801d96:	e8 31 01 00 00       	call   801ecc <nsipc_bind>
+  801d9b:	83 c4 10             	add    $0x10,%esp
+}
+  801d9e:	c9                   	leave
+  801d9f:	c3                   	ret
+
+00801da0 <shutdown>:
+{
+  801da0:	55                   	push   %ebp
+  801da1:	89 e5                	mov    %esp,%ebp
+  801da3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801da6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da9:	e8 f9 fe ff ff       	call   801ca7 <fd2sockid>
+  801dae:	85 c0                	test   %eax,%eax
+  801db0:	78 0f                	js     801dc1 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801db2:	83 ec 08             	sub    $0x8,%esp
+  801db5:	ff 75 0c             	push   0xc(%ebp)
+  801db8:	50                   	push   %eax
+  801db9:	e8 43 01 00 00       	call   801f01 <nsipc_shutdown>
+  801dbe:	83 c4 10             	add    $0x10,%esp
+}
+  801dc1:	c9                   	leave
+  801dc2:	c3                   	ret
+
+00801dc3 <connect>:
+{
+  801dc3:	55                   	push   %ebp
+  801dc4:	89 e5                	mov    %esp,%ebp
+  801dc6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dcc:	e8 d6 fe ff ff       	call   801ca7 <fd2sockid>
+  801dd1:	85 c0                	test   %eax,%eax
+  801dd3:	78 12                	js     801de7 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801dd5:	83 ec 04             	sub    $0x4,%esp
+  801dd8:	ff 75 10             	push   0x10(%ebp)
+  801ddb:	ff 75 0c             	push   0xc(%ebp)
+  801dde:	50                   	push   %eax
+  801ddf:	e8 59 01 00 00       	call   801f3d <nsipc_connect>
+  801de4:	83 c4 10             	add    $0x10,%esp
+}
+  801de7:	c9                   	leave
+  801de8:	c3                   	ret
+
+00801de9 <listen>:
+{
+  801de9:	55                   	push   %ebp
+  801dea:	89 e5                	mov    %esp,%ebp
+  801dec:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801def:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df2:	e8 b0 fe ff ff       	call   801ca7 <fd2sockid>
+  801df7:	85 c0                	test   %eax,%eax
+  801df9:	78 0f                	js     801e0a <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801dfb:	83 ec 08             	sub    $0x8,%esp
+  801dfe:	ff 75 0c             	push   0xc(%ebp)
+  801e01:	50                   	push   %eax
+  801e02:	e8 6b 01 00 00       	call   801f72 <nsipc_listen>
+  801e07:	83 c4 10             	add    $0x10,%esp
+}
+  801e0a:	c9                   	leave
+  801e0b:	c3                   	ret
+
+00801e0c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e0c:	55                   	push   %ebp
+  801e0d:	89 e5                	mov    %esp,%ebp
+  801e0f:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e12:	ff 75 10             	push   0x10(%ebp)
+  801e15:	ff 75 0c             	push   0xc(%ebp)
+  801e18:	ff 75 08             	push   0x8(%ebp)
+  801e1b:	e8 41 02 00 00       	call   802061 <nsipc_socket>
+  801e20:	83 c4 10             	add    $0x10,%esp
+  801e23:	85 c0                	test   %eax,%eax
+  801e25:	78 05                	js     801e2c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e27:	e8 ab fe ff ff       	call   801cd7 <alloc_sockfd>
+}
+  801e2c:	c9                   	leave
+  801e2d:	c3                   	ret
+
+00801e2e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e2e:	55                   	push   %ebp
+  801e2f:	89 e5                	mov    %esp,%ebp
+  801e31:	53                   	push   %ebx
+  801e32:	83 ec 04             	sub    $0x4,%esp
+  801e35:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e37:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  801e3e:	74 26                	je     801e66 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e40:	6a 07                	push   $0x7
+  801e42:	68 00 80 80 00       	push   $0x808000
+  801e47:	53                   	push   %ebx
+  801e48:	ff 35 00 90 80 00    	push   0x809000
+  801e4e:	e8 6f 14 00 00       	call   8032c2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e53:	83 c4 0c             	add    $0xc,%esp
+  801e56:	6a 00                	push   $0x0
+  801e58:	6a 00                	push   $0x0
+  801e5a:	6a 00                	push   $0x0
+  801e5c:	e8 f6 13 00 00       	call   803257 <ipc_recv>
+}
+  801e61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e64:	c9                   	leave
+  801e65:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e66:	83 ec 0c             	sub    $0xc,%esp
+  801e69:	6a 02                	push   $0x2
+  801e6b:	e8 8b 15 00 00       	call   8033fb <ipc_find_env>
+  801e70:	a3 00 90 80 00       	mov    %eax,0x809000
+  801e75:	83 c4 10             	add    $0x10,%esp
+  801e78:	eb c6                	jmp    801e40 <nsipc+0x12>
+
+00801e7a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e7a:	55                   	push   %ebp
+  801e7b:	89 e5                	mov    %esp,%ebp
+  801e7d:	56                   	push   %esi
+  801e7e:	53                   	push   %ebx
+  801e7f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e82:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e85:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801e8a:	8b 06                	mov    (%esi),%eax
+  801e8c:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801e91:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e96:	e8 93 ff ff ff       	call   801e2e <nsipc>
+  801e9b:	89 c3                	mov    %eax,%ebx
+  801e9d:	85 c0                	test   %eax,%eax
+  801e9f:	79 09                	jns    801eaa <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801ea1:	89 d8                	mov    %ebx,%eax
+  801ea3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ea6:	5b                   	pop    %ebx
+  801ea7:	5e                   	pop    %esi
+  801ea8:	5d                   	pop    %ebp
+  801ea9:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801eaa:	83 ec 04             	sub    $0x4,%esp
+  801ead:	ff 35 10 80 80 00    	push   0x808010
+  801eb3:	68 00 80 80 00       	push   $0x808000
+  801eb8:	ff 75 0c             	push   0xc(%ebp)
+  801ebb:	e8 d8 0e 00 00       	call   802d98 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801ec0:	a1 10 80 80 00       	mov    0x808010,%eax
+  801ec5:	89 06                	mov    %eax,(%esi)
+  801ec7:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801eca:	eb d5                	jmp    801ea1 <nsipc_accept+0x27>
+
+00801ecc <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801ecc:	55                   	push   %ebp
+  801ecd:	89 e5                	mov    %esp,%ebp
+  801ecf:	53                   	push   %ebx
+  801ed0:	83 ec 08             	sub    $0x8,%esp
+  801ed3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ed6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed9:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ede:	53                   	push   %ebx
+  801edf:	ff 75 0c             	push   0xc(%ebp)
+  801ee2:	68 04 80 80 00       	push   $0x808004
+  801ee7:	e8 ac 0e 00 00       	call   802d98 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801eec:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801ef2:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ef7:	e8 32 ff ff ff       	call   801e2e <nsipc>
+}
+  801efc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eff:	c9                   	leave
+  801f00:	c3                   	ret
+
+00801f01 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f01:	55                   	push   %ebp
+  801f02:	89 e5                	mov    %esp,%ebp
+  801f04:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f07:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f0a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801f0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f12:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f17:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f1c:	e8 0d ff ff ff       	call   801e2e <nsipc>
+}
+  801f21:	c9                   	leave
+  801f22:	c3                   	ret
+
+00801f23 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f23:	55                   	push   %ebp
+  801f24:	89 e5                	mov    %esp,%ebp
+  801f26:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2c:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f31:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f36:	e8 f3 fe ff ff       	call   801e2e <nsipc>
+}
+  801f3b:	c9                   	leave
+  801f3c:	c3                   	ret
+
+00801f3d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f3d:	55                   	push   %ebp
+  801f3e:	89 e5                	mov    %esp,%ebp
+  801f40:	53                   	push   %ebx
+  801f41:	83 ec 08             	sub    $0x8,%esp
+  801f44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f47:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f4a:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f4f:	53                   	push   %ebx
+  801f50:	ff 75 0c             	push   0xc(%ebp)
+  801f53:	68 04 80 80 00       	push   $0x808004
+  801f58:	e8 3b 0e 00 00       	call   802d98 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f5d:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801f63:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f68:	e8 c1 fe ff ff       	call   801e2e <nsipc>
+}
+  801f6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f70:	c9                   	leave
+  801f71:	c3                   	ret
+
+00801f72 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f72:	55                   	push   %ebp
+  801f73:	89 e5                	mov    %esp,%ebp
+  801f75:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f78:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f7b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f80:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f83:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801f88:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f8d:	e8 9c fe ff ff       	call   801e2e <nsipc>
+}
+  801f92:	c9                   	leave
+  801f93:	c3                   	ret
+
+00801f94 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801f94:	55                   	push   %ebp
+  801f95:	89 e5                	mov    %esp,%ebp
+  801f97:	56                   	push   %esi
+  801f98:	53                   	push   %ebx
+  801f99:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801f9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801fa4:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801faa:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fad:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801fb2:	b8 07 00 00 00       	mov    $0x7,%eax
+  801fb7:	e8 72 fe ff ff       	call   801e2e <nsipc>
+  801fbc:	89 c3                	mov    %eax,%ebx
+  801fbe:	85 c0                	test   %eax,%eax
+  801fc0:	78 22                	js     801fe4 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801fc2:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801fc7:	39 c6                	cmp    %eax,%esi
+  801fc9:	0f 4e c6             	cmovle %esi,%eax
+  801fcc:	39 c3                	cmp    %eax,%ebx
+  801fce:	7f 1d                	jg     801fed <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801fd0:	83 ec 04             	sub    $0x4,%esp
+  801fd3:	53                   	push   %ebx
+  801fd4:	68 00 80 80 00       	push   $0x808000
+  801fd9:	ff 75 0c             	push   0xc(%ebp)
+  801fdc:	e8 b7 0d 00 00       	call   802d98 <memmove>
+  801fe1:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801fe4:	89 d8                	mov    %ebx,%eax
+  801fe6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe9:	5b                   	pop    %ebx
+  801fea:	5e                   	pop    %esi
+  801feb:	5d                   	pop    %ebp
+  801fec:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801fed:	68 b2 38 80 00       	push   $0x8038b2
+  801ff2:	68 50 38 80 00       	push   $0x803850
+  801ff7:	6a 62                	push   $0x62
+  801ff9:	68 c7 38 80 00       	push   $0x8038c7
+  801ffe:	e8 46 05 00 00       	call   802549 <_panic>
+
+00802003 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802003:	55                   	push   %ebp
+  802004:	89 e5                	mov    %esp,%ebp
+  802006:	53                   	push   %ebx
+  802007:	83 ec 04             	sub    $0x4,%esp
+  80200a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80200d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802010:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802015:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80201b:	7f 2e                	jg     80204b <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80201d:	83 ec 04             	sub    $0x4,%esp
+  802020:	53                   	push   %ebx
+  802021:	ff 75 0c             	push   0xc(%ebp)
+  802024:	68 0c 80 80 00       	push   $0x80800c
+  802029:	e8 6a 0d 00 00       	call   802d98 <memmove>
+	nsipcbuf.send.req_size = size;
+  80202e:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802034:	8b 45 14             	mov    0x14(%ebp),%eax
+  802037:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  80203c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802041:	e8 e8 fd ff ff       	call   801e2e <nsipc>
+}
+  802046:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802049:	c9                   	leave
+  80204a:	c3                   	ret
+	assert(size < 1600);
+  80204b:	68 d3 38 80 00       	push   $0x8038d3
+  802050:	68 50 38 80 00       	push   $0x803850
+  802055:	6a 6d                	push   $0x6d
+  802057:	68 c7 38 80 00       	push   $0x8038c7
+  80205c:	e8 e8 04 00 00       	call   802549 <_panic>
+
+00802061 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802061:	55                   	push   %ebp
+  802062:	89 e5                	mov    %esp,%ebp
+  802064:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802067:	8b 45 08             	mov    0x8(%ebp),%eax
+  80206a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  80206f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802072:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802077:	8b 45 10             	mov    0x10(%ebp),%eax
+  80207a:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  80207f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802084:	e8 a5 fd ff ff       	call   801e2e <nsipc>
+}
+  802089:	c9                   	leave
+  80208a:	c3                   	ret
+
+0080208b <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80208b:	55                   	push   %ebp
+  80208c:	89 e5                	mov    %esp,%ebp
+  80208e:	56                   	push   %esi
+  80208f:	53                   	push   %ebx
+  802090:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802093:	83 ec 0c             	sub    $0xc,%esp
+  802096:	ff 75 08             	push   0x8(%ebp)
+  802099:	e8 00 e5 ff ff       	call   80059e <fd2data>
+  80209e:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8020a0:	83 c4 08             	add    $0x8,%esp
+  8020a3:	68 df 38 80 00       	push   $0x8038df
+  8020a8:	53                   	push   %ebx
+  8020a9:	e8 64 0b 00 00       	call   802c12 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8020ae:	8b 46 04             	mov    0x4(%esi),%eax
+  8020b1:	2b 06                	sub    (%esi),%eax
+  8020b3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8020b9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020c0:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020c3:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  8020ca:	40 80 00 
+	return 0;
+}
+  8020cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020d5:	5b                   	pop    %ebx
+  8020d6:	5e                   	pop    %esi
+  8020d7:	5d                   	pop    %ebp
+  8020d8:	c3                   	ret
+
+008020d9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020d9:	55                   	push   %ebp
+  8020da:	89 e5                	mov    %esp,%ebp
+  8020dc:	53                   	push   %ebx
+  8020dd:	83 ec 0c             	sub    $0xc,%esp
+  8020e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020e3:	53                   	push   %ebx
+  8020e4:	6a 00                	push   $0x0
+  8020e6:	e8 2f e1 ff ff       	call   80021a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8020eb:	89 1c 24             	mov    %ebx,(%esp)
+  8020ee:	e8 ab e4 ff ff       	call   80059e <fd2data>
+  8020f3:	83 c4 08             	add    $0x8,%esp
+  8020f6:	50                   	push   %eax
+  8020f7:	6a 00                	push   $0x0
+  8020f9:	e8 1c e1 ff ff       	call   80021a <sys_page_unmap>
+}
+  8020fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802101:	c9                   	leave
+  802102:	c3                   	ret
+
+00802103 <_pipeisclosed>:
+{
+  802103:	55                   	push   %ebp
+  802104:	89 e5                	mov    %esp,%ebp
+  802106:	57                   	push   %edi
+  802107:	56                   	push   %esi
+  802108:	53                   	push   %ebx
+  802109:	83 ec 1c             	sub    $0x1c,%esp
+  80210c:	89 c7                	mov    %eax,%edi
+  80210e:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802110:	a1 00 50 80 00       	mov    0x805000,%eax
+  802115:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802118:	83 ec 0c             	sub    $0xc,%esp
+  80211b:	57                   	push   %edi
+  80211c:	e8 19 13 00 00       	call   80343a <pageref>
+  802121:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802124:	89 34 24             	mov    %esi,(%esp)
+  802127:	e8 0e 13 00 00       	call   80343a <pageref>
+		nn = thisenv->env_runs;
+  80212c:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802132:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802135:	83 c4 10             	add    $0x10,%esp
+  802138:	39 cb                	cmp    %ecx,%ebx
+  80213a:	74 1b                	je     802157 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80213c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80213f:	75 cf                	jne    802110 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802141:	8b 42 58             	mov    0x58(%edx),%eax
+  802144:	6a 01                	push   $0x1
+  802146:	50                   	push   %eax
+  802147:	53                   	push   %ebx
+  802148:	68 e6 38 80 00       	push   $0x8038e6
+  80214d:	e8 d2 04 00 00       	call   802624 <cprintf>
+  802152:	83 c4 10             	add    $0x10,%esp
+  802155:	eb b9                	jmp    802110 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802157:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80215a:	0f 94 c0             	sete   %al
+  80215d:	0f b6 c0             	movzbl %al,%eax
+}
+  802160:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802163:	5b                   	pop    %ebx
+  802164:	5e                   	pop    %esi
+  802165:	5f                   	pop    %edi
+  802166:	5d                   	pop    %ebp
+  802167:	c3                   	ret
+
+00802168 <devpipe_write>:
+{
+  802168:	55                   	push   %ebp
+  802169:	89 e5                	mov    %esp,%ebp
+  80216b:	57                   	push   %edi
+  80216c:	56                   	push   %esi
+  80216d:	53                   	push   %ebx
+  80216e:	83 ec 28             	sub    $0x28,%esp
+  802171:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802174:	56                   	push   %esi
+  802175:	e8 24 e4 ff ff       	call   80059e <fd2data>
+  80217a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80217c:	83 c4 10             	add    $0x10,%esp
+  80217f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802184:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802187:	75 09                	jne    802192 <devpipe_write+0x2a>
+	return i;
+  802189:	89 f8                	mov    %edi,%eax
+  80218b:	eb 23                	jmp    8021b0 <devpipe_write+0x48>
+			sys_yield();
+  80218d:	e8 dc df ff ff       	call   80016e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802192:	8b 43 04             	mov    0x4(%ebx),%eax
+  802195:	8b 0b                	mov    (%ebx),%ecx
+  802197:	8d 51 20             	lea    0x20(%ecx),%edx
+  80219a:	39 d0                	cmp    %edx,%eax
+  80219c:	72 1a                	jb     8021b8 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80219e:	89 da                	mov    %ebx,%edx
+  8021a0:	89 f0                	mov    %esi,%eax
+  8021a2:	e8 5c ff ff ff       	call   802103 <_pipeisclosed>
+  8021a7:	85 c0                	test   %eax,%eax
+  8021a9:	74 e2                	je     80218d <devpipe_write+0x25>
+				return 0;
+  8021ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021b3:	5b                   	pop    %ebx
+  8021b4:	5e                   	pop    %esi
+  8021b5:	5f                   	pop    %edi
+  8021b6:	5d                   	pop    %ebp
+  8021b7:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021bb:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021bf:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021c2:	89 c2                	mov    %eax,%edx
+  8021c4:	c1 fa 1f             	sar    $0x1f,%edx
+  8021c7:	89 d1                	mov    %edx,%ecx
+  8021c9:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021cc:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021cf:	83 e2 1f             	and    $0x1f,%edx
+  8021d2:	29 ca                	sub    %ecx,%edx
+  8021d4:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8021d8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021dc:	83 c0 01             	add    $0x1,%eax
+  8021df:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8021e2:	83 c7 01             	add    $0x1,%edi
+  8021e5:	eb 9d                	jmp    802184 <devpipe_write+0x1c>
+
+008021e7 <devpipe_read>:
+{
+  8021e7:	55                   	push   %ebp
+  8021e8:	89 e5                	mov    %esp,%ebp
+  8021ea:	57                   	push   %edi
+  8021eb:	56                   	push   %esi
+  8021ec:	53                   	push   %ebx
+  8021ed:	83 ec 18             	sub    $0x18,%esp
+  8021f0:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8021f3:	57                   	push   %edi
+  8021f4:	e8 a5 e3 ff ff       	call   80059e <fd2data>
+  8021f9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021fb:	83 c4 10             	add    $0x10,%esp
+  8021fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802203:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802206:	75 13                	jne    80221b <devpipe_read+0x34>
+	return i;
+  802208:	89 f0                	mov    %esi,%eax
+  80220a:	eb 02                	jmp    80220e <devpipe_read+0x27>
+				return i;
+  80220c:	89 f0                	mov    %esi,%eax
+}
+  80220e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802211:	5b                   	pop    %ebx
+  802212:	5e                   	pop    %esi
+  802213:	5f                   	pop    %edi
+  802214:	5d                   	pop    %ebp
+  802215:	c3                   	ret
+			sys_yield();
+  802216:	e8 53 df ff ff       	call   80016e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80221b:	8b 03                	mov    (%ebx),%eax
+  80221d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802220:	75 18                	jne    80223a <devpipe_read+0x53>
+			if (i > 0)
+  802222:	85 f6                	test   %esi,%esi
+  802224:	75 e6                	jne    80220c <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802226:	89 da                	mov    %ebx,%edx
+  802228:	89 f8                	mov    %edi,%eax
+  80222a:	e8 d4 fe ff ff       	call   802103 <_pipeisclosed>
+  80222f:	85 c0                	test   %eax,%eax
+  802231:	74 e3                	je     802216 <devpipe_read+0x2f>
+				return 0;
+  802233:	b8 00 00 00 00       	mov    $0x0,%eax
+  802238:	eb d4                	jmp    80220e <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80223a:	99                   	cltd
+  80223b:	c1 ea 1b             	shr    $0x1b,%edx
+  80223e:	01 d0                	add    %edx,%eax
+  802240:	83 e0 1f             	and    $0x1f,%eax
+  802243:	29 d0                	sub    %edx,%eax
+  802245:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80224a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80224d:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802250:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802253:	83 c6 01             	add    $0x1,%esi
+  802256:	eb ab                	jmp    802203 <devpipe_read+0x1c>
+
+00802258 <pipe>:
+{
+  802258:	55                   	push   %ebp
+  802259:	89 e5                	mov    %esp,%ebp
+  80225b:	56                   	push   %esi
+  80225c:	53                   	push   %ebx
+  80225d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802260:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802263:	50                   	push   %eax
+  802264:	e8 4c e3 ff ff       	call   8005b5 <fd_alloc>
+  802269:	89 c3                	mov    %eax,%ebx
+  80226b:	83 c4 10             	add    $0x10,%esp
+  80226e:	85 c0                	test   %eax,%eax
+  802270:	0f 88 23 01 00 00    	js     802399 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802276:	83 ec 04             	sub    $0x4,%esp
+  802279:	68 07 04 00 00       	push   $0x407
+  80227e:	ff 75 f4             	push   -0xc(%ebp)
+  802281:	6a 00                	push   $0x0
+  802283:	e8 05 df ff ff       	call   80018d <sys_page_alloc>
+  802288:	89 c3                	mov    %eax,%ebx
+  80228a:	83 c4 10             	add    $0x10,%esp
+  80228d:	85 c0                	test   %eax,%eax
+  80228f:	0f 88 04 01 00 00    	js     802399 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802295:	83 ec 0c             	sub    $0xc,%esp
+  802298:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80229b:	50                   	push   %eax
+  80229c:	e8 14 e3 ff ff       	call   8005b5 <fd_alloc>
+  8022a1:	89 c3                	mov    %eax,%ebx
+  8022a3:	83 c4 10             	add    $0x10,%esp
+  8022a6:	85 c0                	test   %eax,%eax
+  8022a8:	0f 88 db 00 00 00    	js     802389 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022ae:	83 ec 04             	sub    $0x4,%esp
+  8022b1:	68 07 04 00 00       	push   $0x407
+  8022b6:	ff 75 f0             	push   -0x10(%ebp)
+  8022b9:	6a 00                	push   $0x0
+  8022bb:	e8 cd de ff ff       	call   80018d <sys_page_alloc>
+  8022c0:	89 c3                	mov    %eax,%ebx
+  8022c2:	83 c4 10             	add    $0x10,%esp
+  8022c5:	85 c0                	test   %eax,%eax
+  8022c7:	0f 88 bc 00 00 00    	js     802389 <pipe+0x131>
+	va = fd2data(fd0);
+  8022cd:	83 ec 0c             	sub    $0xc,%esp
+  8022d0:	ff 75 f4             	push   -0xc(%ebp)
+  8022d3:	e8 c6 e2 ff ff       	call   80059e <fd2data>
+  8022d8:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022da:	83 c4 0c             	add    $0xc,%esp
+  8022dd:	68 07 04 00 00       	push   $0x407
+  8022e2:	50                   	push   %eax
+  8022e3:	6a 00                	push   $0x0
+  8022e5:	e8 a3 de ff ff       	call   80018d <sys_page_alloc>
+  8022ea:	89 c3                	mov    %eax,%ebx
+  8022ec:	83 c4 10             	add    $0x10,%esp
+  8022ef:	85 c0                	test   %eax,%eax
+  8022f1:	0f 88 82 00 00 00    	js     802379 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022f7:	83 ec 0c             	sub    $0xc,%esp
+  8022fa:	ff 75 f0             	push   -0x10(%ebp)
+  8022fd:	e8 9c e2 ff ff       	call   80059e <fd2data>
+  802302:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802309:	50                   	push   %eax
+  80230a:	6a 00                	push   $0x0
+  80230c:	56                   	push   %esi
+  80230d:	6a 00                	push   $0x0
+  80230f:	e8 c4 de ff ff       	call   8001d8 <sys_page_map>
+  802314:	89 c3                	mov    %eax,%ebx
+  802316:	83 c4 20             	add    $0x20,%esp
+  802319:	85 c0                	test   %eax,%eax
+  80231b:	78 4e                	js     80236b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80231d:	a1 60 40 80 00       	mov    0x804060,%eax
+  802322:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802325:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802327:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80232a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802331:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802334:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802336:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802339:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802340:	83 ec 0c             	sub    $0xc,%esp
+  802343:	ff 75 f4             	push   -0xc(%ebp)
+  802346:	e8 43 e2 ff ff       	call   80058e <fd2num>
+  80234b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80234e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802350:	83 c4 04             	add    $0x4,%esp
+  802353:	ff 75 f0             	push   -0x10(%ebp)
+  802356:	e8 33 e2 ff ff       	call   80058e <fd2num>
+  80235b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80235e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802361:	83 c4 10             	add    $0x10,%esp
+  802364:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802369:	eb 2e                	jmp    802399 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80236b:	83 ec 08             	sub    $0x8,%esp
+  80236e:	56                   	push   %esi
+  80236f:	6a 00                	push   $0x0
+  802371:	e8 a4 de ff ff       	call   80021a <sys_page_unmap>
+  802376:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802379:	83 ec 08             	sub    $0x8,%esp
+  80237c:	ff 75 f0             	push   -0x10(%ebp)
+  80237f:	6a 00                	push   $0x0
+  802381:	e8 94 de ff ff       	call   80021a <sys_page_unmap>
+  802386:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802389:	83 ec 08             	sub    $0x8,%esp
+  80238c:	ff 75 f4             	push   -0xc(%ebp)
+  80238f:	6a 00                	push   $0x0
+  802391:	e8 84 de ff ff       	call   80021a <sys_page_unmap>
+  802396:	83 c4 10             	add    $0x10,%esp
+}
+  802399:	89 d8                	mov    %ebx,%eax
+  80239b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80239e:	5b                   	pop    %ebx
+  80239f:	5e                   	pop    %esi
+  8023a0:	5d                   	pop    %ebp
+  8023a1:	c3                   	ret
+
+008023a2 <pipeisclosed>:
+{
+  8023a2:	55                   	push   %ebp
+  8023a3:	89 e5                	mov    %esp,%ebp
+  8023a5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023ab:	50                   	push   %eax
+  8023ac:	ff 75 08             	push   0x8(%ebp)
+  8023af:	e8 57 e2 ff ff       	call   80060b <fd_lookup>
+  8023b4:	83 c4 10             	add    $0x10,%esp
+  8023b7:	85 c0                	test   %eax,%eax
+  8023b9:	78 18                	js     8023d3 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8023bb:	83 ec 0c             	sub    $0xc,%esp
+  8023be:	ff 75 f4             	push   -0xc(%ebp)
+  8023c1:	e8 d8 e1 ff ff       	call   80059e <fd2data>
+  8023c6:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8023c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023cb:	e8 33 fd ff ff       	call   802103 <_pipeisclosed>
+  8023d0:	83 c4 10             	add    $0x10,%esp
+}
+  8023d3:	c9                   	leave
+  8023d4:	c3                   	ret
+
+008023d5 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8023d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023da:	c3                   	ret
+
+008023db <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023db:	55                   	push   %ebp
+  8023dc:	89 e5                	mov    %esp,%ebp
+  8023de:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8023e1:	68 fe 38 80 00       	push   $0x8038fe
+  8023e6:	ff 75 0c             	push   0xc(%ebp)
+  8023e9:	e8 24 08 00 00       	call   802c12 <strcpy>
+	return 0;
+}
+  8023ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f3:	c9                   	leave
+  8023f4:	c3                   	ret
+
+008023f5 <devcons_write>:
+{
+  8023f5:	55                   	push   %ebp
+  8023f6:	89 e5                	mov    %esp,%ebp
+  8023f8:	57                   	push   %edi
+  8023f9:	56                   	push   %esi
+  8023fa:	53                   	push   %ebx
+  8023fb:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802401:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802406:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80240c:	eb 2e                	jmp    80243c <devcons_write+0x47>
+		m = n - tot;
+  80240e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802411:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802413:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802418:	39 c3                	cmp    %eax,%ebx
+  80241a:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80241d:	83 ec 04             	sub    $0x4,%esp
+  802420:	53                   	push   %ebx
+  802421:	89 f0                	mov    %esi,%eax
+  802423:	03 45 0c             	add    0xc(%ebp),%eax
+  802426:	50                   	push   %eax
+  802427:	57                   	push   %edi
+  802428:	e8 6b 09 00 00       	call   802d98 <memmove>
+		sys_cputs(buf, m);
+  80242d:	83 c4 08             	add    $0x8,%esp
+  802430:	53                   	push   %ebx
+  802431:	57                   	push   %edi
+  802432:	e8 7a dc ff ff       	call   8000b1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802437:	01 de                	add    %ebx,%esi
+  802439:	83 c4 10             	add    $0x10,%esp
+  80243c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80243f:	72 cd                	jb     80240e <devcons_write+0x19>
+}
+  802441:	89 f0                	mov    %esi,%eax
+  802443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802446:	5b                   	pop    %ebx
+  802447:	5e                   	pop    %esi
+  802448:	5f                   	pop    %edi
+  802449:	5d                   	pop    %ebp
+  80244a:	c3                   	ret
+
+0080244b <devcons_read>:
+{
+  80244b:	55                   	push   %ebp
+  80244c:	89 e5                	mov    %esp,%ebp
+  80244e:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802451:	b8 00 00 00 00       	mov    $0x0,%eax
+  802456:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80245a:	75 07                	jne    802463 <devcons_read+0x18>
+  80245c:	eb 1f                	jmp    80247d <devcons_read+0x32>
+		sys_yield();
+  80245e:	e8 0b dd ff ff       	call   80016e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802463:	e8 6f dc ff ff       	call   8000d7 <sys_cgetc>
+  802468:	85 c0                	test   %eax,%eax
+  80246a:	74 f2                	je     80245e <devcons_read+0x13>
+	if (c < 0)
+  80246c:	78 0f                	js     80247d <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80246e:	83 f8 04             	cmp    $0x4,%eax
+  802471:	74 0c                	je     80247f <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802473:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802476:	88 02                	mov    %al,(%edx)
+	return 1;
+  802478:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80247d:	c9                   	leave
+  80247e:	c3                   	ret
+		return 0;
+  80247f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802484:	eb f7                	jmp    80247d <devcons_read+0x32>
+
+00802486 <cputchar>:
+{
+  802486:	55                   	push   %ebp
+  802487:	89 e5                	mov    %esp,%ebp
+  802489:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80248c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80248f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802492:	6a 01                	push   $0x1
+  802494:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802497:	50                   	push   %eax
+  802498:	e8 14 dc ff ff       	call   8000b1 <sys_cputs>
+}
+  80249d:	83 c4 10             	add    $0x10,%esp
+  8024a0:	c9                   	leave
+  8024a1:	c3                   	ret
+
+008024a2 <getchar>:
+{
+  8024a2:	55                   	push   %ebp
+  8024a3:	89 e5                	mov    %esp,%ebp
+  8024a5:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8024a8:	6a 01                	push   $0x1
+  8024aa:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024ad:	50                   	push   %eax
+  8024ae:	6a 00                	push   $0x0
+  8024b0:	e8 bc e3 ff ff       	call   800871 <read>
+	if (r < 0)
+  8024b5:	83 c4 10             	add    $0x10,%esp
+  8024b8:	85 c0                	test   %eax,%eax
+  8024ba:	78 06                	js     8024c2 <getchar+0x20>
+	if (r < 1)
+  8024bc:	74 06                	je     8024c4 <getchar+0x22>
+	return c;
+  8024be:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8024c2:	c9                   	leave
+  8024c3:	c3                   	ret
+		return -E_EOF;
+  8024c4:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8024c9:	eb f7                	jmp    8024c2 <getchar+0x20>
+
+008024cb <iscons>:
+{
+  8024cb:	55                   	push   %ebp
+  8024cc:	89 e5                	mov    %esp,%ebp
+  8024ce:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024d4:	50                   	push   %eax
+  8024d5:	ff 75 08             	push   0x8(%ebp)
+  8024d8:	e8 2e e1 ff ff       	call   80060b <fd_lookup>
+  8024dd:	83 c4 10             	add    $0x10,%esp
+  8024e0:	85 c0                	test   %eax,%eax
+  8024e2:	78 11                	js     8024f5 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8024e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024e7:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8024ed:	39 10                	cmp    %edx,(%eax)
+  8024ef:	0f 94 c0             	sete   %al
+  8024f2:	0f b6 c0             	movzbl %al,%eax
+}
+  8024f5:	c9                   	leave
+  8024f6:	c3                   	ret
+
+008024f7 <opencons>:
+{
+  8024f7:	55                   	push   %ebp
+  8024f8:	89 e5                	mov    %esp,%ebp
+  8024fa:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8024fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802500:	50                   	push   %eax
+  802501:	e8 af e0 ff ff       	call   8005b5 <fd_alloc>
+  802506:	83 c4 10             	add    $0x10,%esp
+  802509:	85 c0                	test   %eax,%eax
+  80250b:	78 3a                	js     802547 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80250d:	83 ec 04             	sub    $0x4,%esp
+  802510:	68 07 04 00 00       	push   $0x407
+  802515:	ff 75 f4             	push   -0xc(%ebp)
+  802518:	6a 00                	push   $0x0
+  80251a:	e8 6e dc ff ff       	call   80018d <sys_page_alloc>
+  80251f:	83 c4 10             	add    $0x10,%esp
+  802522:	85 c0                	test   %eax,%eax
+  802524:	78 21                	js     802547 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802526:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802529:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80252f:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802531:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802534:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80253b:	83 ec 0c             	sub    $0xc,%esp
+  80253e:	50                   	push   %eax
+  80253f:	e8 4a e0 ff ff       	call   80058e <fd2num>
+  802544:	83 c4 10             	add    $0x10,%esp
+}
+  802547:	c9                   	leave
+  802548:	c3                   	ret
+
+00802549 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802549:	55                   	push   %ebp
+  80254a:	89 e5                	mov    %esp,%ebp
+  80254c:	56                   	push   %esi
+  80254d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80254e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802551:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  802557:	e8 eb db ff ff       	call   800147 <sys_getenvid>
+  80255c:	83 ec 0c             	sub    $0xc,%esp
+  80255f:	ff 75 0c             	push   0xc(%ebp)
+  802562:	ff 75 08             	push   0x8(%ebp)
+  802565:	56                   	push   %esi
+  802566:	50                   	push   %eax
+  802567:	68 0c 39 80 00       	push   $0x80390c
+  80256c:	e8 b3 00 00 00       	call   802624 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802571:	83 c4 18             	add    $0x18,%esp
+  802574:	53                   	push   %ebx
+  802575:	ff 75 10             	push   0x10(%ebp)
+  802578:	e8 56 00 00 00       	call   8025d3 <vcprintf>
+	cprintf("\n");
+  80257d:	c7 04 24 f7 38 80 00 	movl   $0x8038f7,(%esp)
+  802584:	e8 9b 00 00 00       	call   802624 <cprintf>
+  802589:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80258c:	cc                   	int3
+	while (1)
+  80258d:	eb fd                	jmp    80258c <_panic+0x43>
+
+0080258f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80258f:	55                   	push   %ebp
+  802590:	89 e5                	mov    %esp,%ebp
+  802592:	53                   	push   %ebx
+  802593:	83 ec 04             	sub    $0x4,%esp
+  802596:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802599:	8b 13                	mov    (%ebx),%edx
+  80259b:	8d 42 01             	lea    0x1(%edx),%eax
+  80259e:	89 03                	mov    %eax,(%ebx)
+  8025a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025a3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8025a7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8025ac:	74 09                	je     8025b7 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8025ae:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8025b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025b5:	c9                   	leave
+  8025b6:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8025b7:	83 ec 08             	sub    $0x8,%esp
+  8025ba:	68 ff 00 00 00       	push   $0xff
+  8025bf:	8d 43 08             	lea    0x8(%ebx),%eax
+  8025c2:	50                   	push   %eax
+  8025c3:	e8 e9 da ff ff       	call   8000b1 <sys_cputs>
+		b->idx = 0;
+  8025c8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8025ce:	83 c4 10             	add    $0x10,%esp
+  8025d1:	eb db                	jmp    8025ae <putch+0x1f>
+
+008025d3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8025d3:	55                   	push   %ebp
+  8025d4:	89 e5                	mov    %esp,%ebp
+  8025d6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8025dc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8025e3:	00 00 00 
+	b.cnt = 0;
+  8025e6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8025ed:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8025f0:	ff 75 0c             	push   0xc(%ebp)
+  8025f3:	ff 75 08             	push   0x8(%ebp)
+  8025f6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8025fc:	50                   	push   %eax
+  8025fd:	68 8f 25 80 00       	push   $0x80258f
+  802602:	e8 14 01 00 00       	call   80271b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802607:	83 c4 08             	add    $0x8,%esp
+  80260a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802610:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802616:	50                   	push   %eax
+  802617:	e8 95 da ff ff       	call   8000b1 <sys_cputs>
+
+	return b.cnt;
+}
+  80261c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802622:	c9                   	leave
+  802623:	c3                   	ret
+
+00802624 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802624:	55                   	push   %ebp
+  802625:	89 e5                	mov    %esp,%ebp
+  802627:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80262a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80262d:	50                   	push   %eax
+  80262e:	ff 75 08             	push   0x8(%ebp)
+  802631:	e8 9d ff ff ff       	call   8025d3 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802636:	c9                   	leave
+  802637:	c3                   	ret
+
+00802638 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802638:	55                   	push   %ebp
+  802639:	89 e5                	mov    %esp,%ebp
+  80263b:	57                   	push   %edi
+  80263c:	56                   	push   %esi
+  80263d:	53                   	push   %ebx
+  80263e:	83 ec 1c             	sub    $0x1c,%esp
+  802641:	89 c7                	mov    %eax,%edi
+  802643:	89 d6                	mov    %edx,%esi
+  802645:	8b 45 08             	mov    0x8(%ebp),%eax
+  802648:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80264b:	89 d1                	mov    %edx,%ecx
+  80264d:	89 c2                	mov    %eax,%edx
+  80264f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802652:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802655:	8b 45 10             	mov    0x10(%ebp),%eax
+  802658:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80265b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80265e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802665:	39 c2                	cmp    %eax,%edx
+  802667:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80266a:	72 3e                	jb     8026aa <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80266c:	83 ec 0c             	sub    $0xc,%esp
+  80266f:	ff 75 18             	push   0x18(%ebp)
+  802672:	83 eb 01             	sub    $0x1,%ebx
+  802675:	53                   	push   %ebx
+  802676:	50                   	push   %eax
+  802677:	83 ec 08             	sub    $0x8,%esp
+  80267a:	ff 75 e4             	push   -0x1c(%ebp)
+  80267d:	ff 75 e0             	push   -0x20(%ebp)
+  802680:	ff 75 dc             	push   -0x24(%ebp)
+  802683:	ff 75 d8             	push   -0x28(%ebp)
+  802686:	e8 59 0f 00 00       	call   8035e4 <__udivdi3>
+  80268b:	83 c4 18             	add    $0x18,%esp
+  80268e:	52                   	push   %edx
+  80268f:	50                   	push   %eax
+  802690:	89 f2                	mov    %esi,%edx
+  802692:	89 f8                	mov    %edi,%eax
+  802694:	e8 9f ff ff ff       	call   802638 <printnum>
+  802699:	83 c4 20             	add    $0x20,%esp
+  80269c:	eb 13                	jmp    8026b1 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80269e:	83 ec 08             	sub    $0x8,%esp
+  8026a1:	56                   	push   %esi
+  8026a2:	ff 75 18             	push   0x18(%ebp)
+  8026a5:	ff d7                	call   *%edi
+  8026a7:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8026aa:	83 eb 01             	sub    $0x1,%ebx
+  8026ad:	85 db                	test   %ebx,%ebx
+  8026af:	7f ed                	jg     80269e <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8026b1:	83 ec 08             	sub    $0x8,%esp
+  8026b4:	56                   	push   %esi
+  8026b5:	83 ec 04             	sub    $0x4,%esp
+  8026b8:	ff 75 e4             	push   -0x1c(%ebp)
+  8026bb:	ff 75 e0             	push   -0x20(%ebp)
+  8026be:	ff 75 dc             	push   -0x24(%ebp)
+  8026c1:	ff 75 d8             	push   -0x28(%ebp)
+  8026c4:	e8 39 0f 00 00       	call   803602 <__umoddi3>
+  8026c9:	83 c4 14             	add    $0x14,%esp
+  8026cc:	0f be 80 2f 39 80 00 	movsbl 0x80392f(%eax),%eax
+  8026d3:	50                   	push   %eax
+  8026d4:	ff d7                	call   *%edi
+}
+  8026d6:	83 c4 10             	add    $0x10,%esp
+  8026d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026dc:	5b                   	pop    %ebx
+  8026dd:	5e                   	pop    %esi
+  8026de:	5f                   	pop    %edi
+  8026df:	5d                   	pop    %ebp
+  8026e0:	c3                   	ret
+
+008026e1 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8026e1:	55                   	push   %ebp
+  8026e2:	89 e5                	mov    %esp,%ebp
+  8026e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8026e7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8026eb:	8b 10                	mov    (%eax),%edx
+  8026ed:	3b 50 04             	cmp    0x4(%eax),%edx
+  8026f0:	73 0a                	jae    8026fc <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8026f2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8026f5:	89 08                	mov    %ecx,(%eax)
+  8026f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026fa:	88 02                	mov    %al,(%edx)
+}
+  8026fc:	5d                   	pop    %ebp
+  8026fd:	c3                   	ret
+
+008026fe <printfmt>:
+{
+  8026fe:	55                   	push   %ebp
+  8026ff:	89 e5                	mov    %esp,%ebp
+  802701:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  802704:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  802707:	50                   	push   %eax
+  802708:	ff 75 10             	push   0x10(%ebp)
+  80270b:	ff 75 0c             	push   0xc(%ebp)
+  80270e:	ff 75 08             	push   0x8(%ebp)
+  802711:	e8 05 00 00 00       	call   80271b <vprintfmt>
+}
+  802716:	83 c4 10             	add    $0x10,%esp
+  802719:	c9                   	leave
+  80271a:	c3                   	ret
+
+0080271b <vprintfmt>:
+{
+  80271b:	55                   	push   %ebp
+  80271c:	89 e5                	mov    %esp,%ebp
+  80271e:	57                   	push   %edi
+  80271f:	56                   	push   %esi
+  802720:	53                   	push   %ebx
+  802721:	83 ec 2c             	sub    $0x2c,%esp
+  802724:	8b 75 08             	mov    0x8(%ebp),%esi
+  802727:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80272a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80272d:	eb 0a                	jmp    802739 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80272f:	83 ec 08             	sub    $0x8,%esp
+  802732:	53                   	push   %ebx
+  802733:	50                   	push   %eax
+  802734:	ff d6                	call   *%esi
+  802736:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802739:	83 c7 01             	add    $0x1,%edi
+  80273c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  802740:	83 f8 25             	cmp    $0x25,%eax
+  802743:	74 0c                	je     802751 <vprintfmt+0x36>
+			if (ch == '\0')
+  802745:	85 c0                	test   %eax,%eax
+  802747:	75 e6                	jne    80272f <vprintfmt+0x14>
+}
+  802749:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80274c:	5b                   	pop    %ebx
+  80274d:	5e                   	pop    %esi
+  80274e:	5f                   	pop    %edi
+  80274f:	5d                   	pop    %ebp
+  802750:	c3                   	ret
+		padc = ' ';
+  802751:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  802755:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80275c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  802763:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80276a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80276f:	8d 47 01             	lea    0x1(%edi),%eax
+  802772:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802775:	0f b6 17             	movzbl (%edi),%edx
+  802778:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80277b:	3c 55                	cmp    $0x55,%al
+  80277d:	0f 87 cf 03 00 00    	ja     802b52 <vprintfmt+0x437>
+  802783:	0f b6 c0             	movzbl %al,%eax
+  802786:	ff 24 85 80 3a 80 00 	jmp    *0x803a80(,%eax,4)
+  80278d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  802790:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  802794:	eb d9                	jmp    80276f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  802796:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802799:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80279d:	eb d0                	jmp    80276f <vprintfmt+0x54>
+  80279f:	0f b6 d2             	movzbl %dl,%edx
+  8027a2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8027a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027aa:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8027ad:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8027b0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8027b4:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8027b7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8027ba:	83 f9 09             	cmp    $0x9,%ecx
+  8027bd:	77 55                	ja     802814 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8027bf:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8027c2:	eb e9                	jmp    8027ad <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8027c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027c7:	8b 00                	mov    (%eax),%eax
+  8027c9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8027cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8027d2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8027d8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8027dc:	79 91                	jns    80276f <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8027de:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8027e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8027e4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8027eb:	eb 82                	jmp    80276f <vprintfmt+0x54>
+			if (width < 0)
+  8027ed:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8027f0:	85 d2                	test   %edx,%edx
+  8027f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f7:	0f 49 c2             	cmovns %edx,%eax
+  8027fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  802800:	e9 6a ff ff ff       	jmp    80276f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  802805:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  802808:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80280f:	e9 5b ff ff ff       	jmp    80276f <vprintfmt+0x54>
+  802814:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802817:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80281a:	eb bc                	jmp    8027d8 <vprintfmt+0xbd>
+			lflag++;
+  80281c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80281f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  802822:	e9 48 ff ff ff       	jmp    80276f <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  802827:	8b 45 14             	mov    0x14(%ebp),%eax
+  80282a:	8d 78 04             	lea    0x4(%eax),%edi
+  80282d:	83 ec 08             	sub    $0x8,%esp
+  802830:	53                   	push   %ebx
+  802831:	ff 30                	push   (%eax)
+  802833:	ff d6                	call   *%esi
+			break;
+  802835:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802838:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80283b:	e9 b1 02 00 00       	jmp    802af1 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  802840:	8b 45 14             	mov    0x14(%ebp),%eax
+  802843:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  802846:	8b 10                	mov    (%eax),%edx
+  802848:	89 d0                	mov    %edx,%eax
+  80284a:	f7 d8                	neg    %eax
+  80284c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80284f:	83 f8 11             	cmp    $0x11,%eax
+  802852:	7f 23                	jg     802877 <vprintfmt+0x15c>
+  802854:	8b 14 85 e0 3b 80 00 	mov    0x803be0(,%eax,4),%edx
+  80285b:	85 d2                	test   %edx,%edx
+  80285d:	74 18                	je     802877 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80285f:	52                   	push   %edx
+  802860:	68 62 38 80 00       	push   $0x803862
+  802865:	53                   	push   %ebx
+  802866:	56                   	push   %esi
+  802867:	e8 92 fe ff ff       	call   8026fe <printfmt>
+  80286c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80286f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  802872:	e9 7a 02 00 00       	jmp    802af1 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  802877:	50                   	push   %eax
+  802878:	68 47 39 80 00       	push   $0x803947
+  80287d:	53                   	push   %ebx
+  80287e:	56                   	push   %esi
+  80287f:	e8 7a fe ff ff       	call   8026fe <printfmt>
+  802884:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802887:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80288a:	e9 62 02 00 00       	jmp    802af1 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80288f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802892:	83 c0 04             	add    $0x4,%eax
+  802895:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  802898:	8b 45 14             	mov    0x14(%ebp),%eax
+  80289b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80289d:	85 c9                	test   %ecx,%ecx
+  80289f:	b8 40 39 80 00       	mov    $0x803940,%eax
+  8028a4:	0f 45 c1             	cmovne %ecx,%eax
+  8028a7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8028aa:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8028ae:	7e 06                	jle    8028b6 <vprintfmt+0x19b>
+  8028b0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8028b4:	75 0b                	jne    8028c1 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028b6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8028b9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8028bc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028bf:	eb 5c                	jmp    80291d <vprintfmt+0x202>
+  8028c1:	83 ec 08             	sub    $0x8,%esp
+  8028c4:	ff 75 d0             	push   -0x30(%ebp)
+  8028c7:	ff 75 cc             	push   -0x34(%ebp)
+  8028ca:	e8 20 03 00 00       	call   802bef <strnlen>
+  8028cf:	89 c2                	mov    %eax,%edx
+  8028d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028d4:	29 d0                	sub    %edx,%eax
+  8028d6:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8028d9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8028dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028e0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028e3:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028e5:	eb 0e                	jmp    8028f5 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8028e7:	83 ec 08             	sub    $0x8,%esp
+  8028ea:	53                   	push   %ebx
+  8028eb:	57                   	push   %edi
+  8028ec:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028ef:	83 ee 01             	sub    $0x1,%esi
+  8028f2:	83 c4 10             	add    $0x10,%esp
+  8028f5:	85 f6                	test   %esi,%esi
+  8028f7:	7f ee                	jg     8028e7 <vprintfmt+0x1cc>
+  8028f9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028ff:	85 c0                	test   %eax,%eax
+  802901:	ba 00 00 00 00       	mov    $0x0,%edx
+  802906:	0f 49 d0             	cmovns %eax,%edx
+  802909:	29 d0                	sub    %edx,%eax
+  80290b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80290e:	eb a6                	jmp    8028b6 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  802910:	83 ec 08             	sub    $0x8,%esp
+  802913:	53                   	push   %ebx
+  802914:	52                   	push   %edx
+  802915:	ff 55 08             	call   *0x8(%ebp)
+  802918:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80291b:	89 f1                	mov    %esi,%ecx
+  80291d:	8d 71 01             	lea    0x1(%ecx),%esi
+  802920:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802924:	0f be d0             	movsbl %al,%edx
+  802927:	85 d2                	test   %edx,%edx
+  802929:	74 28                	je     802953 <vprintfmt+0x238>
+  80292b:	85 ff                	test   %edi,%edi
+  80292d:	78 05                	js     802934 <vprintfmt+0x219>
+  80292f:	83 ef 01             	sub    $0x1,%edi
+  802932:	78 30                	js     802964 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802934:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802938:	74 d6                	je     802910 <vprintfmt+0x1f5>
+  80293a:	0f be c0             	movsbl %al,%eax
+  80293d:	83 e8 20             	sub    $0x20,%eax
+  802940:	83 f8 5e             	cmp    $0x5e,%eax
+  802943:	76 cb                	jbe    802910 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  802945:	83 ec 08             	sub    $0x8,%esp
+  802948:	53                   	push   %ebx
+  802949:	6a 3f                	push   $0x3f
+  80294b:	ff 55 08             	call   *0x8(%ebp)
+  80294e:	83 c4 10             	add    $0x10,%esp
+  802951:	eb c8                	jmp    80291b <vprintfmt+0x200>
+  802953:	8b 75 08             	mov    0x8(%ebp),%esi
+  802956:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802959:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80295c:	01 d0                	add    %edx,%eax
+  80295e:	29 c8                	sub    %ecx,%eax
+  802960:	89 c7                	mov    %eax,%edi
+  802962:	eb 13                	jmp    802977 <vprintfmt+0x25c>
+  802964:	8b 75 08             	mov    0x8(%ebp),%esi
+  802967:	eb ed                	jmp    802956 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  802969:	83 ec 08             	sub    $0x8,%esp
+  80296c:	53                   	push   %ebx
+  80296d:	6a 20                	push   $0x20
+  80296f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  802971:	83 ef 01             	sub    $0x1,%edi
+  802974:	83 c4 10             	add    $0x10,%esp
+  802977:	85 ff                	test   %edi,%edi
+  802979:	7f ee                	jg     802969 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80297b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80297e:	89 45 14             	mov    %eax,0x14(%ebp)
+  802981:	e9 6b 01 00 00       	jmp    802af1 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  802986:	83 f9 01             	cmp    $0x1,%ecx
+  802989:	7f 1f                	jg     8029aa <vprintfmt+0x28f>
+	else if (lflag)
+  80298b:	85 c9                	test   %ecx,%ecx
+  80298d:	74 67                	je     8029f6 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80298f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802992:	8b 00                	mov    (%eax),%eax
+  802994:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802997:	89 c1                	mov    %eax,%ecx
+  802999:	c1 f9 1f             	sar    $0x1f,%ecx
+  80299c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80299f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8029a5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8029a8:	eb 17                	jmp    8029c1 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8029aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029ad:	8b 50 04             	mov    0x4(%eax),%edx
+  8029b0:	8b 00                	mov    (%eax),%eax
+  8029b2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029b5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8029b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029bb:	8d 40 08             	lea    0x8(%eax),%eax
+  8029be:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8029c1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029c4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8029c7:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8029cc:	85 c9                	test   %ecx,%ecx
+  8029ce:	0f 89 03 01 00 00    	jns    802ad7 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8029d4:	83 ec 08             	sub    $0x8,%esp
+  8029d7:	53                   	push   %ebx
+  8029d8:	6a 2d                	push   $0x2d
+  8029da:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8029dc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029df:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8029e2:	f7 da                	neg    %edx
+  8029e4:	83 d1 00             	adc    $0x0,%ecx
+  8029e7:	f7 d9                	neg    %ecx
+  8029e9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8029ec:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029f1:	e9 e1 00 00 00       	jmp    802ad7 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8029f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029f9:	8b 00                	mov    (%eax),%eax
+  8029fb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029fe:	89 c1                	mov    %eax,%ecx
+  802a00:	c1 f9 1f             	sar    $0x1f,%ecx
+  802a03:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802a06:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a09:	8d 40 04             	lea    0x4(%eax),%eax
+  802a0c:	89 45 14             	mov    %eax,0x14(%ebp)
+  802a0f:	eb b0                	jmp    8029c1 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  802a11:	83 f9 01             	cmp    $0x1,%ecx
+  802a14:	7f 1e                	jg     802a34 <vprintfmt+0x319>
+	else if (lflag)
+  802a16:	85 c9                	test   %ecx,%ecx
+  802a18:	74 32                	je     802a4c <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802a1a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a1d:	8b 10                	mov    (%eax),%edx
+  802a1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a24:	8d 40 04             	lea    0x4(%eax),%eax
+  802a27:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a2a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  802a2f:	e9 a3 00 00 00       	jmp    802ad7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a34:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a37:	8b 10                	mov    (%eax),%edx
+  802a39:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a3c:	8d 40 08             	lea    0x8(%eax),%eax
+  802a3f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a42:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  802a47:	e9 8b 00 00 00       	jmp    802ad7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a4c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a4f:	8b 10                	mov    (%eax),%edx
+  802a51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a56:	8d 40 04             	lea    0x4(%eax),%eax
+  802a59:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a5c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  802a61:	eb 74                	jmp    802ad7 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  802a63:	83 f9 01             	cmp    $0x1,%ecx
+  802a66:	7f 1b                	jg     802a83 <vprintfmt+0x368>
+	else if (lflag)
+  802a68:	85 c9                	test   %ecx,%ecx
+  802a6a:	74 2c                	je     802a98 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  802a6c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a6f:	8b 10                	mov    (%eax),%edx
+  802a71:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a76:	8d 40 04             	lea    0x4(%eax),%eax
+  802a79:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a7c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  802a81:	eb 54                	jmp    802ad7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a83:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a86:	8b 10                	mov    (%eax),%edx
+  802a88:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a8b:	8d 40 08             	lea    0x8(%eax),%eax
+  802a8e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a91:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  802a96:	eb 3f                	jmp    802ad7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a98:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a9b:	8b 10                	mov    (%eax),%edx
+  802a9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802aa2:	8d 40 04             	lea    0x4(%eax),%eax
+  802aa5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802aa8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802aad:	eb 28                	jmp    802ad7 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  802aaf:	83 ec 08             	sub    $0x8,%esp
+  802ab2:	53                   	push   %ebx
+  802ab3:	6a 30                	push   $0x30
+  802ab5:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802ab7:	83 c4 08             	add    $0x8,%esp
+  802aba:	53                   	push   %ebx
+  802abb:	6a 78                	push   $0x78
+  802abd:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802abf:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ac2:	8b 10                	mov    (%eax),%edx
+  802ac4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802ac9:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802acc:	8d 40 04             	lea    0x4(%eax),%eax
+  802acf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802ad2:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802ad7:	83 ec 0c             	sub    $0xc,%esp
+  802ada:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802ade:	50                   	push   %eax
+  802adf:	ff 75 e0             	push   -0x20(%ebp)
+  802ae2:	57                   	push   %edi
+  802ae3:	51                   	push   %ecx
+  802ae4:	52                   	push   %edx
+  802ae5:	89 da                	mov    %ebx,%edx
+  802ae7:	89 f0                	mov    %esi,%eax
+  802ae9:	e8 4a fb ff ff       	call   802638 <printnum>
+			break;
+  802aee:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802af1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802af4:	e9 40 fc ff ff       	jmp    802739 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802af9:	83 f9 01             	cmp    $0x1,%ecx
+  802afc:	7f 1b                	jg     802b19 <vprintfmt+0x3fe>
+	else if (lflag)
+  802afe:	85 c9                	test   %ecx,%ecx
+  802b00:	74 2c                	je     802b2e <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802b02:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b05:	8b 10                	mov    (%eax),%edx
+  802b07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b0c:	8d 40 04             	lea    0x4(%eax),%eax
+  802b0f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b12:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802b17:	eb be                	jmp    802ad7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802b19:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b1c:	8b 10                	mov    (%eax),%edx
+  802b1e:	8b 48 04             	mov    0x4(%eax),%ecx
+  802b21:	8d 40 08             	lea    0x8(%eax),%eax
+  802b24:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b27:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802b2c:	eb a9                	jmp    802ad7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802b2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b31:	8b 10                	mov    (%eax),%edx
+  802b33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b38:	8d 40 04             	lea    0x4(%eax),%eax
+  802b3b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b3e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  802b43:	eb 92                	jmp    802ad7 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  802b45:	83 ec 08             	sub    $0x8,%esp
+  802b48:	53                   	push   %ebx
+  802b49:	6a 25                	push   $0x25
+  802b4b:	ff d6                	call   *%esi
+			break;
+  802b4d:	83 c4 10             	add    $0x10,%esp
+  802b50:	eb 9f                	jmp    802af1 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  802b52:	83 ec 08             	sub    $0x8,%esp
+  802b55:	53                   	push   %ebx
+  802b56:	6a 25                	push   $0x25
+  802b58:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802b5a:	83 c4 10             	add    $0x10,%esp
+  802b5d:	89 f8                	mov    %edi,%eax
+  802b5f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802b63:	74 05                	je     802b6a <vprintfmt+0x44f>
+  802b65:	83 e8 01             	sub    $0x1,%eax
+  802b68:	eb f5                	jmp    802b5f <vprintfmt+0x444>
+  802b6a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b6d:	eb 82                	jmp    802af1 <vprintfmt+0x3d6>
+
+00802b6f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802b6f:	55                   	push   %ebp
+  802b70:	89 e5                	mov    %esp,%ebp
+  802b72:	83 ec 18             	sub    $0x18,%esp
+  802b75:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b78:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  802b7b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802b7e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802b82:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802b85:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802b8c:	85 c0                	test   %eax,%eax
+  802b8e:	74 26                	je     802bb6 <vsnprintf+0x47>
+  802b90:	85 d2                	test   %edx,%edx
+  802b92:	7e 22                	jle    802bb6 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  802b94:	ff 75 14             	push   0x14(%ebp)
+  802b97:	ff 75 10             	push   0x10(%ebp)
+  802b9a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802b9d:	50                   	push   %eax
+  802b9e:	68 e1 26 80 00       	push   $0x8026e1
+  802ba3:	e8 73 fb ff ff       	call   80271b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802ba8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802bab:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802bae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bb1:	83 c4 10             	add    $0x10,%esp
+}
+  802bb4:	c9                   	leave
+  802bb5:	c3                   	ret
+		return -E_INVAL;
+  802bb6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bbb:	eb f7                	jmp    802bb4 <vsnprintf+0x45>
+
+00802bbd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802bbd:	55                   	push   %ebp
+  802bbe:	89 e5                	mov    %esp,%ebp
+  802bc0:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  802bc3:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802bc6:	50                   	push   %eax
+  802bc7:	ff 75 10             	push   0x10(%ebp)
+  802bca:	ff 75 0c             	push   0xc(%ebp)
+  802bcd:	ff 75 08             	push   0x8(%ebp)
+  802bd0:	e8 9a ff ff ff       	call   802b6f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802bd5:	c9                   	leave
+  802bd6:	c3                   	ret
+
+00802bd7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802bd7:	55                   	push   %ebp
+  802bd8:	89 e5                	mov    %esp,%ebp
+  802bda:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be2:	eb 03                	jmp    802be7 <strlen+0x10>
+		n++;
+  802be4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802be7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802beb:	75 f7                	jne    802be4 <strlen+0xd>
+	return n;
+}
+  802bed:	5d                   	pop    %ebp
+  802bee:	c3                   	ret
+
+00802bef <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802bef:	55                   	push   %ebp
+  802bf0:	89 e5                	mov    %esp,%ebp
+  802bf2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802bf5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bfd:	eb 03                	jmp    802c02 <strnlen+0x13>
+		n++;
+  802bff:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802c02:	39 d0                	cmp    %edx,%eax
+  802c04:	74 08                	je     802c0e <strnlen+0x1f>
+  802c06:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802c0a:	75 f3                	jne    802bff <strnlen+0x10>
+  802c0c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802c0e:	89 d0                	mov    %edx,%eax
+  802c10:	5d                   	pop    %ebp
+  802c11:	c3                   	ret
+
+00802c12 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802c12:	55                   	push   %ebp
+  802c13:	89 e5                	mov    %esp,%ebp
+  802c15:	53                   	push   %ebx
+  802c16:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c19:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c21:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802c25:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802c28:	83 c0 01             	add    $0x1,%eax
+  802c2b:	84 d2                	test   %dl,%dl
+  802c2d:	75 f2                	jne    802c21 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  802c2f:	89 c8                	mov    %ecx,%eax
+  802c31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c34:	c9                   	leave
+  802c35:	c3                   	ret
+
+00802c36 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802c36:	55                   	push   %ebp
+  802c37:	89 e5                	mov    %esp,%ebp
+  802c39:	53                   	push   %ebx
+  802c3a:	83 ec 10             	sub    $0x10,%esp
+  802c3d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  802c40:	53                   	push   %ebx
+  802c41:	e8 91 ff ff ff       	call   802bd7 <strlen>
+  802c46:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  802c49:	ff 75 0c             	push   0xc(%ebp)
+  802c4c:	01 d8                	add    %ebx,%eax
+  802c4e:	50                   	push   %eax
+  802c4f:	e8 be ff ff ff       	call   802c12 <strcpy>
+	return dst;
+}
+  802c54:	89 d8                	mov    %ebx,%eax
+  802c56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c59:	c9                   	leave
+  802c5a:	c3                   	ret
+
+00802c5b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802c5b:	55                   	push   %ebp
+  802c5c:	89 e5                	mov    %esp,%ebp
+  802c5e:	56                   	push   %esi
+  802c5f:	53                   	push   %ebx
+  802c60:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c63:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  802c66:	89 f3                	mov    %esi,%ebx
+  802c68:	03 5d 10             	add    0x10(%ebp),%ebx
+  802c6b:	89 f0                	mov    %esi,%eax
+  802c6d:	eb 0f                	jmp    802c7e <strncpy+0x23>
+		*dst++ = *src;
+  802c6f:	83 c0 01             	add    $0x1,%eax
+  802c72:	0f b6 0a             	movzbl (%edx),%ecx
+  802c75:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  802c78:	80 f9 01             	cmp    $0x1,%cl
+  802c7b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  802c7e:	39 d8                	cmp    %ebx,%eax
+  802c80:	75 ed                	jne    802c6f <strncpy+0x14>
+	}
+	return ret;
+}
+  802c82:	89 f0                	mov    %esi,%eax
+  802c84:	5b                   	pop    %ebx
+  802c85:	5e                   	pop    %esi
+  802c86:	5d                   	pop    %ebp
+  802c87:	c3                   	ret
+
+00802c88 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802c88:	55                   	push   %ebp
+  802c89:	89 e5                	mov    %esp,%ebp
+  802c8b:	56                   	push   %esi
+  802c8c:	53                   	push   %ebx
+  802c8d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c93:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  802c96:	89 f0                	mov    %esi,%eax
+  802c98:	85 d2                	test   %edx,%edx
+  802c9a:	74 21                	je     802cbd <strlcpy+0x35>
+  802c9c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  802ca0:	89 f2                	mov    %esi,%edx
+  802ca2:	eb 09                	jmp    802cad <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  802ca4:	83 c1 01             	add    $0x1,%ecx
+  802ca7:	83 c2 01             	add    $0x1,%edx
+  802caa:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  802cad:	39 c2                	cmp    %eax,%edx
+  802caf:	74 09                	je     802cba <strlcpy+0x32>
+  802cb1:	0f b6 19             	movzbl (%ecx),%ebx
+  802cb4:	84 db                	test   %bl,%bl
+  802cb6:	75 ec                	jne    802ca4 <strlcpy+0x1c>
+  802cb8:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802cba:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802cbd:	29 f0                	sub    %esi,%eax
+}
+  802cbf:	5b                   	pop    %ebx
+  802cc0:	5e                   	pop    %esi
+  802cc1:	5d                   	pop    %ebp
+  802cc2:	c3                   	ret
+
+00802cc3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802cc3:	55                   	push   %ebp
+  802cc4:	89 e5                	mov    %esp,%ebp
+  802cc6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802cc9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802ccc:	eb 06                	jmp    802cd4 <strcmp+0x11>
+		p++, q++;
+  802cce:	83 c1 01             	add    $0x1,%ecx
+  802cd1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802cd4:	0f b6 01             	movzbl (%ecx),%eax
+  802cd7:	84 c0                	test   %al,%al
+  802cd9:	74 04                	je     802cdf <strcmp+0x1c>
+  802cdb:	3a 02                	cmp    (%edx),%al
+  802cdd:	74 ef                	je     802cce <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802cdf:	0f b6 c0             	movzbl %al,%eax
+  802ce2:	0f b6 12             	movzbl (%edx),%edx
+  802ce5:	29 d0                	sub    %edx,%eax
+}
+  802ce7:	5d                   	pop    %ebp
+  802ce8:	c3                   	ret
+
+00802ce9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802ce9:	55                   	push   %ebp
+  802cea:	89 e5                	mov    %esp,%ebp
+  802cec:	53                   	push   %ebx
+  802ced:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cf3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802cf6:	eb 09                	jmp    802d01 <strncmp+0x18>
+		n--, p++, q++;
+  802cf8:	83 ea 01             	sub    $0x1,%edx
+  802cfb:	83 c0 01             	add    $0x1,%eax
+  802cfe:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802d01:	85 d2                	test   %edx,%edx
+  802d03:	74 18                	je     802d1d <strncmp+0x34>
+  802d05:	0f b6 18             	movzbl (%eax),%ebx
+  802d08:	84 db                	test   %bl,%bl
+  802d0a:	74 04                	je     802d10 <strncmp+0x27>
+  802d0c:	3a 19                	cmp    (%ecx),%bl
+  802d0e:	74 e8                	je     802cf8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802d10:	0f b6 00             	movzbl (%eax),%eax
+  802d13:	0f b6 11             	movzbl (%ecx),%edx
+  802d16:	29 d0                	sub    %edx,%eax
+}
+  802d18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d1b:	c9                   	leave
+  802d1c:	c3                   	ret
+		return 0;
+  802d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d22:	eb f4                	jmp    802d18 <strncmp+0x2f>
+
+00802d24 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802d24:	55                   	push   %ebp
+  802d25:	89 e5                	mov    %esp,%ebp
+  802d27:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d2a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d2e:	eb 03                	jmp    802d33 <strchr+0xf>
+  802d30:	83 c0 01             	add    $0x1,%eax
+  802d33:	0f b6 10             	movzbl (%eax),%edx
+  802d36:	84 d2                	test   %dl,%dl
+  802d38:	74 06                	je     802d40 <strchr+0x1c>
+		if (*s == c)
+  802d3a:	38 ca                	cmp    %cl,%dl
+  802d3c:	75 f2                	jne    802d30 <strchr+0xc>
+  802d3e:	eb 05                	jmp    802d45 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  802d40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d45:	5d                   	pop    %ebp
+  802d46:	c3                   	ret
+
+00802d47 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802d47:	55                   	push   %ebp
+  802d48:	89 e5                	mov    %esp,%ebp
+  802d4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d4d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d51:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  802d54:	38 ca                	cmp    %cl,%dl
+  802d56:	74 09                	je     802d61 <strfind+0x1a>
+  802d58:	84 d2                	test   %dl,%dl
+  802d5a:	74 05                	je     802d61 <strfind+0x1a>
+	for (; *s; s++)
+  802d5c:	83 c0 01             	add    $0x1,%eax
+  802d5f:	eb f0                	jmp    802d51 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  802d61:	5d                   	pop    %ebp
+  802d62:	c3                   	ret
+
+00802d63 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802d63:	55                   	push   %ebp
+  802d64:	89 e5                	mov    %esp,%ebp
+  802d66:	57                   	push   %edi
+  802d67:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d6a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  802d6d:	85 c9                	test   %ecx,%ecx
+  802d6f:	74 20                	je     802d91 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  802d71:	89 f8                	mov    %edi,%eax
+  802d73:	09 c8                	or     %ecx,%eax
+  802d75:	a8 03                	test   $0x3,%al
+  802d77:	75 12                	jne    802d8b <memset+0x28>
+		c &= 0xFF;
+  802d79:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802d7d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  802d83:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  802d86:	fc                   	cld
+  802d87:	f3 ab                	rep stos %eax,%es:(%edi)
+  802d89:	eb 06                	jmp    802d91 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  802d8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d8e:	fc                   	cld
+  802d8f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  802d91:	89 f8                	mov    %edi,%eax
+  802d93:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802d96:	c9                   	leave
+  802d97:	c3                   	ret
+
+00802d98 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  802d98:	55                   	push   %ebp
+  802d99:	89 e5                	mov    %esp,%ebp
+  802d9b:	57                   	push   %edi
+  802d9c:	56                   	push   %esi
+  802d9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802da3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  802da6:	39 c6                	cmp    %eax,%esi
+  802da8:	73 32                	jae    802ddc <memmove+0x44>
+  802daa:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802dad:	39 d0                	cmp    %edx,%eax
+  802daf:	73 2b                	jae    802ddc <memmove+0x44>
+		s += n;
+		d += n;
+  802db1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802db4:	89 d6                	mov    %edx,%esi
+  802db6:	09 fe                	or     %edi,%esi
+  802db8:	09 ce                	or     %ecx,%esi
+  802dba:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802dc0:	75 0e                	jne    802dd0 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802dc2:	83 ef 04             	sub    $0x4,%edi
+  802dc5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802dc8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802dcb:	fd                   	std
+  802dcc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802dce:	eb 09                	jmp    802dd9 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802dd0:	83 ef 01             	sub    $0x1,%edi
+  802dd3:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802dd6:	fd                   	std
+  802dd7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802dd9:	fc                   	cld
+  802dda:	eb 1a                	jmp    802df6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802ddc:	89 f2                	mov    %esi,%edx
+  802dde:	09 c2                	or     %eax,%edx
+  802de0:	09 ca                	or     %ecx,%edx
+  802de2:	f6 c2 03             	test   $0x3,%dl
+  802de5:	75 0a                	jne    802df1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802de7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802dea:	89 c7                	mov    %eax,%edi
+  802dec:	fc                   	cld
+  802ded:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802def:	eb 05                	jmp    802df6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802df1:	89 c7                	mov    %eax,%edi
+  802df3:	fc                   	cld
+  802df4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802df6:	5e                   	pop    %esi
+  802df7:	5f                   	pop    %edi
+  802df8:	5d                   	pop    %ebp
+  802df9:	c3                   	ret
+
+00802dfa <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802dfa:	55                   	push   %ebp
+  802dfb:	89 e5                	mov    %esp,%ebp
+  802dfd:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802e00:	ff 75 10             	push   0x10(%ebp)
+  802e03:	ff 75 0c             	push   0xc(%ebp)
+  802e06:	ff 75 08             	push   0x8(%ebp)
+  802e09:	e8 8a ff ff ff       	call   802d98 <memmove>
+}
+  802e0e:	c9                   	leave
+  802e0f:	c3                   	ret
+
+00802e10 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802e10:	55                   	push   %ebp
+  802e11:	89 e5                	mov    %esp,%ebp
+  802e13:	56                   	push   %esi
+  802e14:	53                   	push   %ebx
+  802e15:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e18:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802e1b:	89 c6                	mov    %eax,%esi
+  802e1d:	03 75 10             	add    0x10(%ebp),%esi
+  802e20:	eb 06                	jmp    802e28 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802e22:	83 c0 01             	add    $0x1,%eax
+  802e25:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802e28:	39 f0                	cmp    %esi,%eax
+  802e2a:	74 14                	je     802e40 <memcmp+0x30>
+		if (*s1 != *s2)
+  802e2c:	0f b6 08             	movzbl (%eax),%ecx
+  802e2f:	0f b6 1a             	movzbl (%edx),%ebx
+  802e32:	38 d9                	cmp    %bl,%cl
+  802e34:	74 ec                	je     802e22 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802e36:	0f b6 c1             	movzbl %cl,%eax
+  802e39:	0f b6 db             	movzbl %bl,%ebx
+  802e3c:	29 d8                	sub    %ebx,%eax
+  802e3e:	eb 05                	jmp    802e45 <memcmp+0x35>
+	}
+
+	return 0;
+  802e40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e45:	5b                   	pop    %ebx
+  802e46:	5e                   	pop    %esi
+  802e47:	5d                   	pop    %ebp
+  802e48:	c3                   	ret
+
+00802e49 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802e49:	55                   	push   %ebp
+  802e4a:	89 e5                	mov    %esp,%ebp
+  802e4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802e52:	89 c2                	mov    %eax,%edx
+  802e54:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802e57:	eb 03                	jmp    802e5c <memfind+0x13>
+  802e59:	83 c0 01             	add    $0x1,%eax
+  802e5c:	39 d0                	cmp    %edx,%eax
+  802e5e:	73 04                	jae    802e64 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802e60:	38 08                	cmp    %cl,(%eax)
+  802e62:	75 f5                	jne    802e59 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802e64:	5d                   	pop    %ebp
+  802e65:	c3                   	ret
+
+00802e66 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802e66:	55                   	push   %ebp
+  802e67:	89 e5                	mov    %esp,%ebp
+  802e69:	57                   	push   %edi
+  802e6a:	56                   	push   %esi
+  802e6b:	53                   	push   %ebx
+  802e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802e72:	eb 03                	jmp    802e77 <strtol+0x11>
+		s++;
+  802e74:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802e77:	0f b6 02             	movzbl (%edx),%eax
+  802e7a:	3c 20                	cmp    $0x20,%al
+  802e7c:	74 f6                	je     802e74 <strtol+0xe>
+  802e7e:	3c 09                	cmp    $0x9,%al
+  802e80:	74 f2                	je     802e74 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802e82:	3c 2b                	cmp    $0x2b,%al
+  802e84:	74 2a                	je     802eb0 <strtol+0x4a>
+	int neg = 0;
+  802e86:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802e8b:	3c 2d                	cmp    $0x2d,%al
+  802e8d:	74 2b                	je     802eba <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802e8f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802e95:	75 0f                	jne    802ea6 <strtol+0x40>
+  802e97:	80 3a 30             	cmpb   $0x30,(%edx)
+  802e9a:	74 28                	je     802ec4 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802e9c:	85 db                	test   %ebx,%ebx
+  802e9e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802ea3:	0f 44 d8             	cmove  %eax,%ebx
+  802ea6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802eab:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802eae:	eb 46                	jmp    802ef6 <strtol+0x90>
+		s++;
+  802eb0:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802eb3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb8:	eb d5                	jmp    802e8f <strtol+0x29>
+		s++, neg = 1;
+  802eba:	83 c2 01             	add    $0x1,%edx
+  802ebd:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ec2:	eb cb                	jmp    802e8f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802ec4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802ec8:	74 0e                	je     802ed8 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802eca:	85 db                	test   %ebx,%ebx
+  802ecc:	75 d8                	jne    802ea6 <strtol+0x40>
+		s++, base = 8;
+  802ece:	83 c2 01             	add    $0x1,%edx
+  802ed1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802ed6:	eb ce                	jmp    802ea6 <strtol+0x40>
+		s += 2, base = 16;
+  802ed8:	83 c2 02             	add    $0x2,%edx
+  802edb:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802ee0:	eb c4                	jmp    802ea6 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802ee2:	0f be c0             	movsbl %al,%eax
+  802ee5:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802ee8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802eeb:	7d 3a                	jge    802f27 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802eed:	83 c2 01             	add    $0x1,%edx
+  802ef0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802ef4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802ef6:	0f b6 02             	movzbl (%edx),%eax
+  802ef9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802efc:	89 f3                	mov    %esi,%ebx
+  802efe:	80 fb 09             	cmp    $0x9,%bl
+  802f01:	76 df                	jbe    802ee2 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  802f03:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802f06:	89 f3                	mov    %esi,%ebx
+  802f08:	80 fb 19             	cmp    $0x19,%bl
+  802f0b:	77 08                	ja     802f15 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802f0d:	0f be c0             	movsbl %al,%eax
+  802f10:	83 e8 57             	sub    $0x57,%eax
+  802f13:	eb d3                	jmp    802ee8 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802f15:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802f18:	89 f3                	mov    %esi,%ebx
+  802f1a:	80 fb 19             	cmp    $0x19,%bl
+  802f1d:	77 08                	ja     802f27 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802f1f:	0f be c0             	movsbl %al,%eax
+  802f22:	83 e8 37             	sub    $0x37,%eax
+  802f25:	eb c1                	jmp    802ee8 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802f27:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802f2b:	74 05                	je     802f32 <strtol+0xcc>
+		*endptr = (char *) s;
+  802f2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f30:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802f32:	89 c8                	mov    %ecx,%eax
+  802f34:	f7 d8                	neg    %eax
+  802f36:	85 ff                	test   %edi,%edi
+  802f38:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802f3b:	89 c8                	mov    %ecx,%eax
+  802f3d:	5b                   	pop    %ebx
+  802f3e:	5e                   	pop    %esi
+  802f3f:	5f                   	pop    %edi
+  802f40:	5d                   	pop    %ebp
+  802f41:	c3                   	ret
+
+00802f42 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802f42:	55                   	push   %ebp
+  802f43:	89 e5                	mov    %esp,%ebp
+  802f45:	57                   	push   %edi
+  802f46:	56                   	push   %esi
+  802f47:	53                   	push   %ebx
+  802f48:	83 ec 20             	sub    $0x20,%esp
+  802f4b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f4e:	89 d7                	mov    %edx,%edi
+  802f50:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802f52:	51                   	push   %ecx
+  802f53:	68 00 f0 7f 00       	push   $0x7ff000
+  802f58:	6a 00                	push   $0x0
+  802f5a:	e8 2e d2 ff ff       	call   80018d <sys_page_alloc>
+  802f5f:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f61:	83 c4 10             	add    $0x10,%esp
+  802f64:	85 c0                	test   %eax,%eax
+  802f66:	78 45                	js     802fad <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802f68:	83 ec 04             	sub    $0x4,%esp
+  802f6b:	68 00 10 00 00       	push   $0x1000
+  802f70:	57                   	push   %edi
+  802f71:	68 00 f0 7f 00       	push   $0x7ff000
+  802f76:	e8 1d fe ff ff       	call   802d98 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  802f7b:	89 34 24             	mov    %esi,(%esp)
+  802f7e:	57                   	push   %edi
+  802f7f:	ff 75 e4             	push   -0x1c(%ebp)
+  802f82:	68 00 f0 7f 00       	push   $0x7ff000
+  802f87:	6a 00                	push   $0x0
+  802f89:	e8 4a d2 ff ff       	call   8001d8 <sys_page_map>
+  802f8e:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f90:	83 c4 20             	add    $0x20,%esp
+  802f93:	85 c0                	test   %eax,%eax
+  802f95:	78 16                	js     802fad <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802f97:	83 ec 08             	sub    $0x8,%esp
+  802f9a:	68 00 f0 7f 00       	push   $0x7ff000
+  802f9f:	6a 00                	push   $0x0
+  802fa1:	e8 74 d2 ff ff       	call   80021a <sys_page_unmap>
+  802fa6:	83 c4 10             	add    $0x10,%esp
+  802fa9:	85 c0                	test   %eax,%eax
+  802fab:	75 0a                	jne    802fb7 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  802fad:	89 d8                	mov    %ebx,%eax
+  802faf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fb2:	5b                   	pop    %ebx
+  802fb3:	5e                   	pop    %esi
+  802fb4:	5f                   	pop    %edi
+  802fb5:	5d                   	pop    %ebp
+  802fb6:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802fb7:	68 48 3c 80 00       	push   $0x803c48
+  802fbc:	68 50 38 80 00       	push   $0x803850
+  802fc1:	6a 1b                	push   $0x1b
+  802fc3:	68 c0 3c 80 00       	push   $0x803cc0
+  802fc8:	e8 7c f5 ff ff       	call   802549 <_panic>
+
+00802fcd <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802fcd:	55                   	push   %ebp
+  802fce:	89 e5                	mov    %esp,%ebp
+  802fd0:	53                   	push   %ebx
+  802fd1:	83 ec 04             	sub    $0x4,%esp
+  802fd4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  802fd7:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802fd9:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  802fdd:	74 21                	je     803000 <pgfault+0x33>
+  802fdf:	89 d0                	mov    %edx,%eax
+  802fe1:	c1 e8 16             	shr    $0x16,%eax
+  802fe4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802feb:	a8 01                	test   $0x1,%al
+  802fed:	74 11                	je     803000 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  802fef:	89 d0                	mov    %edx,%eax
+  802ff1:	c1 e8 0c             	shr    $0xc,%eax
+  802ff4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802ffb:	f6 c4 08             	test   $0x8,%ah
+  802ffe:	75 17                	jne    803017 <pgfault+0x4a>
+		if (pgfault_next) {
+  803000:	a1 04 90 80 00       	mov    0x809004,%eax
+  803005:	85 c0                	test   %eax,%eax
+  803007:	74 27                	je     803030 <pgfault+0x63>
+			pgfault_next(utf);
+  803009:	83 ec 0c             	sub    $0xc,%esp
+  80300c:	53                   	push   %ebx
+  80300d:	ff d0                	call   *%eax
+			return;
+  80300f:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803012:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803015:	c9                   	leave
+  803016:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803017:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80301d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803022:	b8 00 00 00 00       	mov    $0x0,%eax
+  803027:	e8 16 ff ff ff       	call   802f42 <copy_page_to>
+  80302c:	85 c0                	test   %eax,%eax
+  80302e:	79 e2                	jns    803012 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803030:	a1 00 50 80 00       	mov    0x805000,%eax
+  803035:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803038:	ff 73 28             	push   0x28(%ebx)
+  80303b:	ff 33                	push   (%ebx)
+  80303d:	50                   	push   %eax
+  80303e:	68 6c 3c 80 00       	push   $0x803c6c
+  803043:	e8 dc f5 ff ff       	call   802624 <cprintf>
+	sys_env_destroy(0);
+  803048:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80304f:	e8 aa d0 ff ff       	call   8000fe <sys_env_destroy>
+  803054:	83 c4 10             	add    $0x10,%esp
+  803057:	eb b9                	jmp    803012 <pgfault+0x45>
+
+00803059 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803059:	55                   	push   %ebp
+  80305a:	89 e5                	mov    %esp,%ebp
+  80305c:	53                   	push   %ebx
+  80305d:	83 ec 04             	sub    $0x4,%esp
+  803060:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803063:	a1 08 90 80 00       	mov    0x809008,%eax
+  803068:	3d cd 2f 80 00       	cmp    $0x802fcd,%eax
+  80306d:	74 15                	je     803084 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80306f:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  803074:	83 ec 0c             	sub    $0xc,%esp
+  803077:	68 cd 2f 80 00       	push   $0x802fcd
+  80307c:	e8 fb 03 00 00       	call   80347c <set_pgfault_handler>
+  803081:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803084:	83 ec 0c             	sub    $0xc,%esp
+  803087:	68 05 08 00 00       	push   $0x805
+  80308c:	53                   	push   %ebx
+  80308d:	6a 00                	push   $0x0
+  80308f:	53                   	push   %ebx
+  803090:	6a 00                	push   $0x0
+  803092:	e8 41 d1 ff ff       	call   8001d8 <sys_page_map>
+}
+  803097:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80309a:	c9                   	leave
+  80309b:	c3                   	ret
+
+0080309c <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80309c:	55                   	push   %ebp
+  80309d:	89 e5                	mov    %esp,%ebp
+  80309f:	57                   	push   %edi
+  8030a0:	56                   	push   %esi
+  8030a1:	53                   	push   %ebx
+  8030a2:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8030a5:	68 cd 2f 80 00       	push   $0x802fcd
+  8030aa:	e8 cd 03 00 00       	call   80347c <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8030af:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030b4:	cd 30                	int    $0x30
+  8030b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030b9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8030bc:	83 c4 10             	add    $0x10,%esp
+  8030bf:	85 c0                	test   %eax,%eax
+  8030c1:	0f 88 6b 01 00 00    	js     803232 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8030cc:	75 37                	jne    803105 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8030ce:	e8 74 d0 ff ff       	call   800147 <sys_getenvid>
+  8030d3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030d8:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8030de:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8030e3:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8030e8:	e9 45 01 00 00       	jmp    803232 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8030ed:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030f3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8030f9:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8030ff:	0f 87 ba 00 00 00    	ja     8031bf <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803105:	89 d8                	mov    %ebx,%eax
+  803107:	c1 e8 16             	shr    $0x16,%eax
+  80310a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803111:	a8 01                	test   $0x1,%al
+  803113:	74 d8                	je     8030ed <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803115:	89 d8                	mov    %ebx,%eax
+  803117:	c1 e8 0c             	shr    $0xc,%eax
+  80311a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803121:	f6 c2 01             	test   $0x1,%dl
+  803124:	74 cd                	je     8030f3 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803126:	89 da                	mov    %ebx,%edx
+  803128:	80 e6 df             	and    $0xdf,%dh
+  80312b:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803131:	74 c0                	je     8030f3 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803133:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803135:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80313c:	f6 c6 04             	test   $0x4,%dh
+  80313f:	75 53                	jne    803194 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803141:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803148:	f6 c6 08             	test   $0x8,%dh
+  80314b:	75 0c                	jne    803159 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80314d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803154:	f6 c2 02             	test   $0x2,%dl
+  803157:	74 3b                	je     803194 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803159:	83 ec 0c             	sub    $0xc,%esp
+  80315c:	68 05 08 00 00       	push   $0x805
+  803161:	57                   	push   %edi
+  803162:	ff 75 e4             	push   -0x1c(%ebp)
+  803165:	57                   	push   %edi
+  803166:	6a 00                	push   $0x0
+  803168:	e8 6b d0 ff ff       	call   8001d8 <sys_page_map>
+  80316d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80316f:	83 c4 20             	add    $0x20,%esp
+  803172:	85 c0                	test   %eax,%eax
+  803174:	0f 88 a7 00 00 00    	js     803221 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80317a:	83 ec 0c             	sub    $0xc,%esp
+  80317d:	68 05 08 00 00       	push   $0x805
+  803182:	57                   	push   %edi
+  803183:	6a 00                	push   $0x0
+  803185:	57                   	push   %edi
+  803186:	6a 00                	push   $0x0
+  803188:	e8 4b d0 ff ff       	call   8001d8 <sys_page_map>
+  80318d:	89 c6                	mov    %eax,%esi
+	return r;
+  80318f:	83 c4 20             	add    $0x20,%esp
+  803192:	eb 21                	jmp    8031b5 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803194:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80319b:	83 ec 0c             	sub    $0xc,%esp
+  80319e:	25 07 0e 00 00       	and    $0xe07,%eax
+  8031a3:	50                   	push   %eax
+  8031a4:	57                   	push   %edi
+  8031a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8031a8:	57                   	push   %edi
+  8031a9:	6a 00                	push   $0x0
+  8031ab:	e8 28 d0 ff ff       	call   8001d8 <sys_page_map>
+  8031b0:	89 c6                	mov    %eax,%esi
+  8031b2:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8031b5:	85 f6                	test   %esi,%esi
+  8031b7:	0f 89 36 ff ff ff    	jns    8030f3 <fork+0x57>
+  8031bd:	eb 62                	jmp    803221 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031bf:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031c4:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8031c9:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8031cc:	89 f8                	mov    %edi,%eax
+  8031ce:	e8 6f fd ff ff       	call   802f42 <copy_page_to>
+  8031d3:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031d5:	85 c0                	test   %eax,%eax
+  8031d7:	78 48                	js     803221 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031d9:	83 ec 04             	sub    $0x4,%esp
+  8031dc:	6a 07                	push   $0x7
+  8031de:	68 00 f0 bf ee       	push   $0xeebff000
+  8031e3:	57                   	push   %edi
+  8031e4:	e8 a4 cf ff ff       	call   80018d <sys_page_alloc>
+  8031e9:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031eb:	83 c4 10             	add    $0x10,%esp
+  8031ee:	85 c0                	test   %eax,%eax
+  8031f0:	78 2f                	js     803221 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8031f2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8031f7:	8b 40 64             	mov    0x64(%eax),%eax
+  8031fa:	83 ec 08             	sub    $0x8,%esp
+  8031fd:	50                   	push   %eax
+  8031fe:	57                   	push   %edi
+  8031ff:	e8 f4 d0 ff ff       	call   8002f8 <sys_env_set_pgfault_upcall>
+  803204:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803206:	83 c4 10             	add    $0x10,%esp
+  803209:	85 c0                	test   %eax,%eax
+  80320b:	78 14                	js     803221 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80320d:	83 ec 08             	sub    $0x8,%esp
+  803210:	6a 02                	push   $0x2
+  803212:	57                   	push   %edi
+  803213:	e8 4c d0 ff ff       	call   800264 <sys_env_set_status>
+  803218:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80321a:	83 c4 10             	add    $0x10,%esp
+  80321d:	85 c0                	test   %eax,%eax
+  80321f:	79 11                	jns    803232 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803221:	83 ec 0c             	sub    $0xc,%esp
+  803224:	ff 75 e0             	push   -0x20(%ebp)
+  803227:	e8 d2 ce ff ff       	call   8000fe <sys_env_destroy>
+	return r;
+  80322c:	83 c4 10             	add    $0x10,%esp
+  80322f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803232:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803235:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803238:	5b                   	pop    %ebx
+  803239:	5e                   	pop    %esi
+  80323a:	5f                   	pop    %edi
+  80323b:	5d                   	pop    %ebp
+  80323c:	c3                   	ret
+
+0080323d <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80323d:	55                   	push   %ebp
+  80323e:	89 e5                	mov    %esp,%ebp
+  803240:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803243:	68 cb 3c 80 00       	push   $0x803ccb
+  803248:	68 bf 00 00 00       	push   $0xbf
+  80324d:	68 c0 3c 80 00       	push   $0x803cc0
+  803252:	e8 f2 f2 ff ff       	call   802549 <_panic>
+
+00803257 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803257:	55                   	push   %ebp
+  803258:	89 e5                	mov    %esp,%ebp
+  80325a:	56                   	push   %esi
+  80325b:	53                   	push   %ebx
+  80325c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80325f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803262:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803265:	85 c0                	test   %eax,%eax
+  803267:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80326c:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80326f:	83 ec 0c             	sub    $0xc,%esp
+  803272:	50                   	push   %eax
+  803273:	e8 5d d1 ff ff       	call   8003d5 <sys_ipc_recv>
+	if (from_env_store)
+  803278:	83 c4 10             	add    $0x10,%esp
+  80327b:	85 f6                	test   %esi,%esi
+  80327d:	74 14                	je     803293 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80327f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803284:	85 c0                	test   %eax,%eax
+  803286:	75 09                	jne    803291 <ipc_recv+0x3a>
+  803288:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80328e:	8b 52 74             	mov    0x74(%edx),%edx
+  803291:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803293:	85 db                	test   %ebx,%ebx
+  803295:	74 25                	je     8032bc <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803297:	85 c0                	test   %eax,%eax
+  803299:	74 0d                	je     8032a8 <ipc_recv+0x51>
+  80329b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8032a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032a4:	5b                   	pop    %ebx
+  8032a5:	5e                   	pop    %esi
+  8032a6:	5d                   	pop    %ebp
+  8032a7:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8032a8:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032ad:	8b 40 78             	mov    0x78(%eax),%eax
+  8032b0:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8032b2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032b7:	8b 40 70             	mov    0x70(%eax),%eax
+  8032ba:	eb e5                	jmp    8032a1 <ipc_recv+0x4a>
+  8032bc:	85 c0                	test   %eax,%eax
+  8032be:	75 e1                	jne    8032a1 <ipc_recv+0x4a>
+  8032c0:	eb f0                	jmp    8032b2 <ipc_recv+0x5b>
+
+008032c2 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8032c2:	55                   	push   %ebp
+  8032c3:	89 e5                	mov    %esp,%ebp
+  8032c5:	57                   	push   %edi
+  8032c6:	56                   	push   %esi
+  8032c7:	53                   	push   %ebx
+  8032c8:	83 ec 0c             	sub    $0xc,%esp
+  8032cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032ce:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032d4:	85 db                	test   %ebx,%ebx
+  8032d6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032db:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8032de:	ff 75 14             	push   0x14(%ebp)
+  8032e1:	53                   	push   %ebx
+  8032e2:	56                   	push   %esi
+  8032e3:	57                   	push   %edi
+  8032e4:	e8 59 d0 ff ff       	call   800342 <sys_ipc_try_send>
+  8032e9:	83 c4 10             	add    $0x10,%esp
+  8032ec:	85 c0                	test   %eax,%eax
+  8032ee:	74 22                	je     803312 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8032f0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032f3:	75 07                	jne    8032fc <ipc_send+0x3a>
+		sys_yield();
+  8032f5:	e8 74 ce ff ff       	call   80016e <sys_yield>
+  8032fa:	eb e2                	jmp    8032de <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8032fc:	68 e1 3c 80 00       	push   $0x803ce1
+  803301:	68 50 38 80 00       	push   $0x803850
+  803306:	6a 39                	push   $0x39
+  803308:	68 f6 3c 80 00       	push   $0x803cf6
+  80330d:	e8 37 f2 ff ff       	call   802549 <_panic>
+	}
+}
+  803312:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803315:	5b                   	pop    %ebx
+  803316:	5e                   	pop    %esi
+  803317:	5f                   	pop    %edi
+  803318:	5d                   	pop    %ebp
+  803319:	c3                   	ret
+
+0080331a <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80331a:	55                   	push   %ebp
+  80331b:	89 e5                	mov    %esp,%ebp
+  80331d:	57                   	push   %edi
+  80331e:	56                   	push   %esi
+  80331f:	53                   	push   %ebx
+  803320:	83 ec 10             	sub    $0x10,%esp
+  803323:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803326:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803329:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80332c:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80332f:	85 c0                	test   %eax,%eax
+  803331:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803336:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803339:	6a 00                	push   $0x0
+  80333b:	ff 33                	push   (%ebx)
+  80333d:	50                   	push   %eax
+  80333e:	e8 4f d0 ff ff       	call   800392 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803343:	83 c4 10             	add    $0x10,%esp
+  803346:	85 c0                	test   %eax,%eax
+  803348:	75 3c                	jne    803386 <ipc_recvv+0x6c>
+  80334a:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803350:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803353:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803355:	85 ff                	test   %edi,%edi
+  803357:	74 4e                	je     8033a7 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803359:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80335f:	8b 52 74             	mov    0x74(%edx),%edx
+  803362:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803364:	85 f6                	test   %esi,%esi
+  803366:	74 18                	je     803380 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803368:	85 c0                	test   %eax,%eax
+  80336a:	75 2d                	jne    803399 <ipc_recvv+0x7f>
+  80336c:	a1 00 50 80 00       	mov    0x805000,%eax
+  803371:	8b 40 78             	mov    0x78(%eax),%eax
+  803374:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803376:	a1 00 50 80 00       	mov    0x805000,%eax
+  80337b:	8b 40 70             	mov    0x70(%eax),%eax
+  80337e:	eb 1f                	jmp    80339f <ipc_recvv+0x85>
+  803380:	85 c0                	test   %eax,%eax
+  803382:	75 1b                	jne    80339f <ipc_recvv+0x85>
+  803384:	eb f0                	jmp    803376 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803386:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80338c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803391:	85 ff                	test   %edi,%edi
+  803393:	75 cd                	jne    803362 <ipc_recvv+0x48>
+	if (perm_store)
+  803395:	85 f6                	test   %esi,%esi
+  803397:	74 e7                	je     803380 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803399:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80339f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033a2:	5b                   	pop    %ebx
+  8033a3:	5e                   	pop    %esi
+  8033a4:	5f                   	pop    %edi
+  8033a5:	5d                   	pop    %ebp
+  8033a6:	c3                   	ret
+	if (perm_store)
+  8033a7:	85 f6                	test   %esi,%esi
+  8033a9:	75 bd                	jne    803368 <ipc_recvv+0x4e>
+  8033ab:	eb c9                	jmp    803376 <ipc_recvv+0x5c>
+
+008033ad <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8033ad:	55                   	push   %ebp
+  8033ae:	89 e5                	mov    %esp,%ebp
+  8033b0:	57                   	push   %edi
+  8033b1:	56                   	push   %esi
+  8033b2:	53                   	push   %ebx
+  8033b3:	83 ec 0c             	sub    $0xc,%esp
+  8033b6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8033bf:	ff 75 14             	push   0x14(%ebp)
+  8033c2:	53                   	push   %ebx
+  8033c3:	56                   	push   %esi
+  8033c4:	57                   	push   %edi
+  8033c5:	e8 a0 cf ff ff       	call   80036a <sys_ipc_try_sendv>
+  8033ca:	83 c4 10             	add    $0x10,%esp
+  8033cd:	85 c0                	test   %eax,%eax
+  8033cf:	74 22                	je     8033f3 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8033d1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033d4:	75 07                	jne    8033dd <ipc_sendv+0x30>
+		sys_yield();
+  8033d6:	e8 93 cd ff ff       	call   80016e <sys_yield>
+  8033db:	eb e2                	jmp    8033bf <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8033dd:	68 e1 3c 80 00       	push   $0x803ce1
+  8033e2:	68 50 38 80 00       	push   $0x803850
+  8033e7:	6a 5c                	push   $0x5c
+  8033e9:	68 f6 3c 80 00       	push   $0x803cf6
+  8033ee:	e8 56 f1 ff ff       	call   802549 <_panic>
+	}
+}
+  8033f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033f6:	5b                   	pop    %ebx
+  8033f7:	5e                   	pop    %esi
+  8033f8:	5f                   	pop    %edi
+  8033f9:	5d                   	pop    %ebp
+  8033fa:	c3                   	ret
+
+008033fb <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8033fb:	55                   	push   %ebp
+  8033fc:	89 e5                	mov    %esp,%ebp
+  8033fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803401:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803406:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80340c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803412:	8b 52 50             	mov    0x50(%edx),%edx
+  803415:	39 ca                	cmp    %ecx,%edx
+  803417:	74 11                	je     80342a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803419:	83 c0 01             	add    $0x1,%eax
+  80341c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803421:	75 e3                	jne    803406 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803423:	b8 00 00 00 00       	mov    $0x0,%eax
+  803428:	eb 0e                	jmp    803438 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80342a:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803430:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803435:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803438:	5d                   	pop    %ebp
+  803439:	c3                   	ret
+
+0080343a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80343a:	55                   	push   %ebp
+  80343b:	89 e5                	mov    %esp,%ebp
+  80343d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803440:	89 c2                	mov    %eax,%edx
+  803442:	c1 ea 16             	shr    $0x16,%edx
+  803445:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80344c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803451:	f6 c1 01             	test   $0x1,%cl
+  803454:	74 22                	je     803478 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803456:	c1 e8 0c             	shr    $0xc,%eax
+  803459:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803460:	a8 01                	test   $0x1,%al
+  803462:	74 14                	je     803478 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803464:	c1 e8 0c             	shr    $0xc,%eax
+  803467:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80346a:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803471:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803475:	0f b7 d2             	movzwl %dx,%edx
+}
+  803478:	89 d0                	mov    %edx,%eax
+  80347a:	5d                   	pop    %ebp
+  80347b:	c3                   	ret
+
+0080347c <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80347c:	55                   	push   %ebp
+  80347d:	89 e5                	mov    %esp,%ebp
+  80347f:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803482:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  803489:	74 0a                	je     803495 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80348b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80348e:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  803493:	c9                   	leave
+  803494:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803495:	83 ec 04             	sub    $0x4,%esp
+  803498:	6a 07                	push   $0x7
+  80349a:	68 00 f0 bf ee       	push   $0xeebff000
+  80349f:	6a 00                	push   $0x0
+  8034a1:	e8 e7 cc ff ff       	call   80018d <sys_page_alloc>
+  8034a6:	83 c4 10             	add    $0x10,%esp
+  8034a9:	85 c0                	test   %eax,%eax
+  8034ab:	75 2c                	jne    8034d9 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8034ad:	83 ec 08             	sub    $0x8,%esp
+  8034b0:	68 ef 34 80 00       	push   $0x8034ef
+  8034b5:	6a 00                	push   $0x0
+  8034b7:	e8 3c ce ff ff       	call   8002f8 <sys_env_set_pgfault_upcall>
+  8034bc:	83 c4 10             	add    $0x10,%esp
+  8034bf:	85 c0                	test   %eax,%eax
+  8034c1:	74 c8                	je     80348b <set_pgfault_handler+0xf>
+  8034c3:	68 48 3d 80 00       	push   $0x803d48
+  8034c8:	68 50 38 80 00       	push   $0x803850
+  8034cd:	6a 20                	push   $0x20
+  8034cf:	68 78 3d 80 00       	push   $0x803d78
+  8034d4:	e8 70 f0 ff ff       	call   802549 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034d9:	68 00 3d 80 00       	push   $0x803d00
+  8034de:	68 50 38 80 00       	push   $0x803850
+  8034e3:	6a 1e                	push   $0x1e
+  8034e5:	68 78 3d 80 00       	push   $0x803d78
+  8034ea:	e8 5a f0 ff ff       	call   802549 <_panic>
+
+008034ef <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8034ef:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8034f0:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  8034f5:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8034f7:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8034fa:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8034ff:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803504:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803508:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80350b:	83 c4 08             	add    $0x8,%esp
+	popal
+  80350e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  80350f:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803512:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803513:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803514:	c3                   	ret
+
+00803515 <dm>:
+  803515:	55                   	push   %ebp
+  803516:	57                   	push   %edi
+  803517:	56                   	push   %esi
+  803518:	53                   	push   %ebx
+  803519:	83 ec 24             	sub    $0x24,%esp
+  80351c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803520:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803524:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803528:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80352c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803530:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803534:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803538:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80353d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803542:	ba 00 00 00 00       	mov    $0x0,%edx
+  803547:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80354e:	00 
+  80354f:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803556:	00 
+  803557:	89 fb                	mov    %edi,%ebx
+  803559:	eb 08                	jmp    803563 <dm+0x4e>
+  80355b:	83 e9 01             	sub    $0x1,%ecx
+  80355e:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803561:	74 68                	je     8035cb <dm+0xb6>
+  803563:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803567:	01 c0                	add    %eax,%eax
+  803569:	89 c6                	mov    %eax,%esi
+  80356b:	89 d7                	mov    %edx,%edi
+  80356d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803571:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803575:	0f ad d0             	shrd   %cl,%edx,%eax
+  803578:	d3 ea                	shr    %cl,%edx
+  80357a:	f6 c1 20             	test   $0x20,%cl
+  80357d:	74 04                	je     803583 <dm+0x6e>
+  80357f:	89 d0                	mov    %edx,%eax
+  803581:	31 d2                	xor    %edx,%edx
+  803583:	83 e0 01             	and    $0x1,%eax
+  803586:	89 04 24             	mov    %eax,(%esp)
+  803589:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803590:	00 
+  803591:	8b 04 24             	mov    (%esp),%eax
+  803594:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803598:	09 f0                	or     %esi,%eax
+  80359a:	09 fa                	or     %edi,%edx
+  80359c:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8035a0:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8035a4:	39 f0                	cmp    %esi,%eax
+  8035a6:	89 d5                	mov    %edx,%ebp
+  8035a8:	19 fd                	sbb    %edi,%ebp
+  8035aa:	72 af                	jb     80355b <dm+0x46>
+  8035ac:	29 f0                	sub    %esi,%eax
+  8035ae:	19 fa                	sbb    %edi,%edx
+  8035b0:	89 cf                	mov    %ecx,%edi
+  8035b2:	c1 ef 05             	shr    $0x5,%edi
+  8035b5:	83 e7 01             	and    $0x1,%edi
+  8035b8:	89 fe                	mov    %edi,%esi
+  8035ba:	83 f6 01             	xor    $0x1,%esi
+  8035bd:	d3 e6                	shl    %cl,%esi
+  8035bf:	d3 e7                	shl    %cl,%edi
+  8035c1:	09 74 24 18          	or     %esi,0x18(%esp)
+  8035c5:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8035c9:	eb 90                	jmp    80355b <dm+0x46>
+  8035cb:	85 db                	test   %ebx,%ebx
+  8035cd:	74 05                	je     8035d4 <dm+0xbf>
+  8035cf:	89 03                	mov    %eax,(%ebx)
+  8035d1:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035d4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035d8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035dc:	83 c4 24             	add    $0x24,%esp
+  8035df:	5b                   	pop    %ebx
+  8035e0:	5e                   	pop    %esi
+  8035e1:	5f                   	pop    %edi
+  8035e2:	5d                   	pop    %ebp
+  8035e3:	c3                   	ret
+
+008035e4 <__udivdi3>:
+  8035e4:	83 ec 08             	sub    $0x8,%esp
+  8035e7:	6a 00                	push   $0x0
+  8035e9:	ff 74 24 1c          	push   0x1c(%esp)
+  8035ed:	ff 74 24 1c          	push   0x1c(%esp)
+  8035f1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035f5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035f9:	e8 17 ff ff ff       	call   803515 <dm>
+  8035fe:	83 c4 14             	add    $0x14,%esp
+  803601:	c3                   	ret
+
+00803602 <__umoddi3>:
+  803602:	83 ec 18             	sub    $0x18,%esp
+  803605:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803609:	50                   	push   %eax
+  80360a:	ff 74 24 2c          	push   0x2c(%esp)
+  80360e:	ff 74 24 2c          	push   0x2c(%esp)
+  803612:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803616:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80361a:	e8 f6 fe ff ff       	call   803515 <dm>
+  80361f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803623:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803627:	83 c4 24             	add    $0x24,%esp
+  80362a:	c3                   	ret
+
+0080362b <__divdi3>:
+  80362b:	53                   	push   %ebx
+  80362c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803630:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803634:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803638:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80363c:	85 d2                	test   %edx,%edx
+  80363e:	78 15                	js     803655 <__divdi3+0x2a>
+  803640:	85 db                	test   %ebx,%ebx
+  803642:	78 34                	js     803678 <__divdi3+0x4d>
+  803644:	83 ec 04             	sub    $0x4,%esp
+  803647:	6a 00                	push   $0x0
+  803649:	53                   	push   %ebx
+  80364a:	51                   	push   %ecx
+  80364b:	e8 c5 fe ff ff       	call   803515 <dm>
+  803650:	83 c4 10             	add    $0x10,%esp
+  803653:	eb 21                	jmp    803676 <__divdi3+0x4b>
+  803655:	f7 d8                	neg    %eax
+  803657:	83 d2 00             	adc    $0x0,%edx
+  80365a:	f7 da                	neg    %edx
+  80365c:	85 db                	test   %ebx,%ebx
+  80365e:	78 30                	js     803690 <__divdi3+0x65>
+  803660:	83 ec 04             	sub    $0x4,%esp
+  803663:	6a 00                	push   $0x0
+  803665:	53                   	push   %ebx
+  803666:	51                   	push   %ecx
+  803667:	e8 a9 fe ff ff       	call   803515 <dm>
+  80366c:	83 c4 10             	add    $0x10,%esp
+  80366f:	f7 d8                	neg    %eax
+  803671:	83 d2 00             	adc    $0x0,%edx
+  803674:	f7 da                	neg    %edx
+  803676:	5b                   	pop    %ebx
+  803677:	c3                   	ret
+  803678:	83 ec 04             	sub    $0x4,%esp
+  80367b:	6a 00                	push   $0x0
+  80367d:	f7 d9                	neg    %ecx
+  80367f:	83 d3 00             	adc    $0x0,%ebx
+  803682:	f7 db                	neg    %ebx
+  803684:	53                   	push   %ebx
+  803685:	51                   	push   %ecx
+  803686:	e8 8a fe ff ff       	call   803515 <dm>
+  80368b:	83 c4 10             	add    $0x10,%esp
+  80368e:	eb df                	jmp    80366f <__divdi3+0x44>
+  803690:	83 ec 04             	sub    $0x4,%esp
+  803693:	6a 00                	push   $0x0
+  803695:	f7 d9                	neg    %ecx
+  803697:	83 d3 00             	adc    $0x0,%ebx
+  80369a:	f7 db                	neg    %ebx
+  80369c:	53                   	push   %ebx
+  80369d:	51                   	push   %ecx
+  80369e:	e8 72 fe ff ff       	call   803515 <dm>
+  8036a3:	83 c4 10             	add    $0x10,%esp
+  8036a6:	eb ce                	jmp    803676 <__divdi3+0x4b>
+
+008036a8 <__moddi3>:
+  8036a8:	55                   	push   %ebp
+  8036a9:	57                   	push   %edi
+  8036aa:	56                   	push   %esi
+  8036ab:	53                   	push   %ebx
+  8036ac:	83 ec 24             	sub    $0x24,%esp
+  8036af:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036b3:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036b7:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036bb:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036bf:	85 d2                	test   %edx,%edx
+  8036c1:	78 3b                	js     8036fe <__moddi3+0x56>
+  8036c3:	83 ec 04             	sub    $0x4,%esp
+  8036c6:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036ca:	56                   	push   %esi
+  8036cb:	89 ce                	mov    %ecx,%esi
+  8036cd:	f7 de                	neg    %esi
+  8036cf:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8036d3:	89 de                	mov    %ebx,%esi
+  8036d5:	83 d6 00             	adc    $0x0,%esi
+  8036d8:	f7 de                	neg    %esi
+  8036da:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8036de:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8036e2:	0f 48 f1             	cmovs  %ecx,%esi
+  8036e5:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8036ea:	53                   	push   %ebx
+  8036eb:	56                   	push   %esi
+  8036ec:	e8 24 fe ff ff       	call   803515 <dm>
+  8036f1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036f5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036f9:	83 c4 10             	add    $0x10,%esp
+  8036fc:	eb 47                	jmp    803745 <__moddi3+0x9d>
+  8036fe:	f7 d8                	neg    %eax
+  803700:	83 d2 00             	adc    $0x0,%edx
+  803703:	f7 da                	neg    %edx
+  803705:	83 ec 04             	sub    $0x4,%esp
+  803708:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80370c:	56                   	push   %esi
+  80370d:	89 cf                	mov    %ecx,%edi
+  80370f:	f7 df                	neg    %edi
+  803711:	89 de                	mov    %ebx,%esi
+  803713:	83 d6 00             	adc    $0x0,%esi
+  803716:	f7 de                	neg    %esi
+  803718:	0f 49 cf             	cmovns %edi,%ecx
+  80371b:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80371f:	0f 49 de             	cmovns %esi,%ebx
+  803722:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803726:	ff 74 24 0c          	push   0xc(%esp)
+  80372a:	ff 74 24 0c          	push   0xc(%esp)
+  80372e:	e8 e2 fd ff ff       	call   803515 <dm>
+  803733:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803737:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80373b:	f7 d8                	neg    %eax
+  80373d:	83 d2 00             	adc    $0x0,%edx
+  803740:	f7 da                	neg    %edx
+  803742:	83 c4 10             	add    $0x10,%esp
+  803745:	83 c4 24             	add    $0x24,%esp
+  803748:	5b                   	pop    %ebx
+  803749:	5e                   	pop    %esi
+  80374a:	5f                   	pop    %edi
+  80374b:	5d                   	pop    %ebp
+  80374c:	c3                   	ret
@@ -0,0 +1,7919 @@
+
+obj/user/cat.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 fc 00 00 00       	call   80012d <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <cat>:
+
+char buf[8192];
+
+void
+cat(int f, char *s)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+	long n;
+	int r;
+
+	while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80003b:	83 ec 04             	sub    $0x4,%esp
+  80003e:	68 00 20 00 00       	push   $0x2000
+  800043:	68 00 50 80 00       	push   $0x805000
+  800048:	56                   	push   %esi
+  800049:	e8 fb 12 00 00       	call   801349 <read>
+  80004e:	89 c3                	mov    %eax,%ebx
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	7e 2f                	jle    800086 <cat+0x53>
+		if ((r = write(1, buf, n)) != n)
+  800057:	83 ec 04             	sub    $0x4,%esp
+  80005a:	53                   	push   %ebx
+  80005b:	68 00 50 80 00       	push   $0x805000
+  800060:	6a 01                	push   $0x1
+  800062:	e8 b0 13 00 00       	call   801417 <write>
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	39 c3                	cmp    %eax,%ebx
+  80006c:	74 cd                	je     80003b <cat+0x8>
+			panic("write error copying %s: %e", s, r);
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	50                   	push   %eax
+  800072:	ff 75 0c             	push   0xc(%ebp)
+  800075:	68 40 39 80 00       	push   $0x803940
+  80007a:	6a 0d                	push   $0xd
+  80007c:	68 5b 39 80 00       	push   $0x80395b
+  800081:	e8 0a 01 00 00       	call   800190 <_panic>
+	if (n < 0)
+  800086:	78 07                	js     80008f <cat+0x5c>
+		panic("error reading %s: %e", s, n);
+}
+  800088:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008b:	5b                   	pop    %ebx
+  80008c:	5e                   	pop    %esi
+  80008d:	5d                   	pop    %ebp
+  80008e:	c3                   	ret
+		panic("error reading %s: %e", s, n);
+  80008f:	83 ec 0c             	sub    $0xc,%esp
+  800092:	50                   	push   %eax
+  800093:	ff 75 0c             	push   0xc(%ebp)
+  800096:	68 66 39 80 00       	push   $0x803966
+  80009b:	6a 0f                	push   $0xf
+  80009d:	68 5b 39 80 00       	push   $0x80395b
+  8000a2:	e8 e9 00 00 00       	call   800190 <_panic>
+
+008000a7 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	57                   	push   %edi
+  8000ab:	56                   	push   %esi
+  8000ac:	53                   	push   %ebx
+  8000ad:	83 ec 0c             	sub    $0xc,%esp
+  8000b0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int f, i;
+
+	binaryname = "cat";
+  8000b3:	c7 05 00 40 80 00 7b 	movl   $0x80397b,0x804000
+  8000ba:	39 80 00 
+	if (argc == 1)
+		cat(0, "<stdin>");
+	else
+		for (i = 1; i < argc; i++) {
+  8000bd:	be 01 00 00 00       	mov    $0x1,%esi
+	if (argc == 1)
+  8000c2:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000c6:	75 31                	jne    8000f9 <umain+0x52>
+		cat(0, "<stdin>");
+  8000c8:	83 ec 08             	sub    $0x8,%esp
+  8000cb:	68 7f 39 80 00       	push   $0x80397f
+  8000d0:	6a 00                	push   $0x0
+  8000d2:	e8 5c ff ff ff       	call   800033 <cat>
+  8000d7:	83 c4 10             	add    $0x10,%esp
+			else {
+				cat(f, argv[i]);
+				close(f);
+			}
+		}
+}
+  8000da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000dd:	5b                   	pop    %ebx
+  8000de:	5e                   	pop    %esi
+  8000df:	5f                   	pop    %edi
+  8000e0:	5d                   	pop    %ebp
+  8000e1:	c3                   	ret
+				printf("can't open %s: %e\n", argv[i], f);
+  8000e2:	83 ec 04             	sub    $0x4,%esp
+  8000e5:	50                   	push   %eax
+  8000e6:	ff 34 b7             	push   (%edi,%esi,4)
+  8000e9:	68 87 39 80 00       	push   $0x803987
+  8000ee:	e8 06 27 00 00       	call   8027f9 <printf>
+  8000f3:	83 c4 10             	add    $0x10,%esp
+		for (i = 1; i < argc; i++) {
+  8000f6:	83 c6 01             	add    $0x1,%esi
+  8000f9:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8000fc:	7d dc                	jge    8000da <umain+0x33>
+			f = open(argv[i], O_RDONLY);
+  8000fe:	83 ec 08             	sub    $0x8,%esp
+  800101:	6a 00                	push   $0x0
+  800103:	ff 34 b7             	push   (%edi,%esi,4)
+  800106:	e8 f4 1c 00 00       	call   801dff <open>
+  80010b:	89 c3                	mov    %eax,%ebx
+			if (f < 0)
+  80010d:	83 c4 10             	add    $0x10,%esp
+  800110:	85 c0                	test   %eax,%eax
+  800112:	78 ce                	js     8000e2 <umain+0x3b>
+				cat(f, argv[i]);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	ff 34 b7             	push   (%edi,%esi,4)
+  80011a:	50                   	push   %eax
+  80011b:	e8 13 ff ff ff       	call   800033 <cat>
+				close(f);
+  800120:	89 1c 24             	mov    %ebx,(%esp)
+  800123:	e8 e5 10 00 00       	call   80120d <close>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	eb c9                	jmp    8000f6 <umain+0x4f>
+
+0080012d <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	56                   	push   %esi
+  800131:	53                   	push   %ebx
+  800132:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800135:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800138:	e8 e2 0a 00 00       	call   800c1f <sys_getenvid>
+  80013d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800142:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800148:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80014d:	a3 00 70 80 00       	mov    %eax,0x807000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800152:	85 db                	test   %ebx,%ebx
+  800154:	7e 07                	jle    80015d <libmain+0x30>
+		binaryname = argv[0];
+  800156:	8b 06                	mov    (%esi),%eax
+  800158:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80015d:	83 ec 08             	sub    $0x8,%esp
+  800160:	56                   	push   %esi
+  800161:	53                   	push   %ebx
+  800162:	e8 40 ff ff ff       	call   8000a7 <umain>
+
+	// exit gracefully
+	exit();
+  800167:	e8 0a 00 00 00       	call   800176 <exit>
+}
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800172:	5b                   	pop    %ebx
+  800173:	5e                   	pop    %esi
+  800174:	5d                   	pop    %ebp
+  800175:	c3                   	ret
+
+00800176 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800176:	55                   	push   %ebp
+  800177:	89 e5                	mov    %esp,%ebp
+  800179:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80017c:	e8 b9 10 00 00       	call   80123a <close_all>
+	sys_env_destroy(0);
+  800181:	83 ec 0c             	sub    $0xc,%esp
+  800184:	6a 00                	push   $0x0
+  800186:	e8 4b 0a 00 00       	call   800bd6 <sys_env_destroy>
+}
+  80018b:	83 c4 10             	add    $0x10,%esp
+  80018e:	c9                   	leave
+  80018f:	c3                   	ret
+
+00800190 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800190:	55                   	push   %ebp
+  800191:	89 e5                	mov    %esp,%ebp
+  800193:	56                   	push   %esi
+  800194:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800195:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800198:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80019e:	e8 7c 0a 00 00       	call   800c1f <sys_getenvid>
+  8001a3:	83 ec 0c             	sub    $0xc,%esp
+  8001a6:	ff 75 0c             	push   0xc(%ebp)
+  8001a9:	ff 75 08             	push   0x8(%ebp)
+  8001ac:	56                   	push   %esi
+  8001ad:	50                   	push   %eax
+  8001ae:	68 a4 39 80 00       	push   $0x8039a4
+  8001b3:	e8 b3 00 00 00       	call   80026b <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001b8:	83 c4 18             	add    $0x18,%esp
+  8001bb:	53                   	push   %ebx
+  8001bc:	ff 75 10             	push   0x10(%ebp)
+  8001bf:	e8 56 00 00 00       	call   80021a <vcprintf>
+	cprintf("\n");
+  8001c4:	c7 04 24 67 3e 80 00 	movl   $0x803e67,(%esp)
+  8001cb:	e8 9b 00 00 00       	call   80026b <cprintf>
+  8001d0:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001d3:	cc                   	int3
+	while (1)
+  8001d4:	eb fd                	jmp    8001d3 <_panic+0x43>
+
+008001d6 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001d6:	55                   	push   %ebp
+  8001d7:	89 e5                	mov    %esp,%ebp
+  8001d9:	53                   	push   %ebx
+  8001da:	83 ec 04             	sub    $0x4,%esp
+  8001dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001e0:	8b 13                	mov    (%ebx),%edx
+  8001e2:	8d 42 01             	lea    0x1(%edx),%eax
+  8001e5:	89 03                	mov    %eax,(%ebx)
+  8001e7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001ea:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001ee:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001f3:	74 09                	je     8001fe <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001f5:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001fc:	c9                   	leave
+  8001fd:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001fe:	83 ec 08             	sub    $0x8,%esp
+  800201:	68 ff 00 00 00       	push   $0xff
+  800206:	8d 43 08             	lea    0x8(%ebx),%eax
+  800209:	50                   	push   %eax
+  80020a:	e8 7a 09 00 00       	call   800b89 <sys_cputs>
+		b->idx = 0;
+  80020f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800215:	83 c4 10             	add    $0x10,%esp
+  800218:	eb db                	jmp    8001f5 <putch+0x1f>
+
+0080021a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80021a:	55                   	push   %ebp
+  80021b:	89 e5                	mov    %esp,%ebp
+  80021d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800223:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80022a:	00 00 00 
+	b.cnt = 0;
+  80022d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800234:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800237:	ff 75 0c             	push   0xc(%ebp)
+  80023a:	ff 75 08             	push   0x8(%ebp)
+  80023d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800243:	50                   	push   %eax
+  800244:	68 d6 01 80 00       	push   $0x8001d6
+  800249:	e8 14 01 00 00       	call   800362 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80024e:	83 c4 08             	add    $0x8,%esp
+  800251:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800257:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80025d:	50                   	push   %eax
+  80025e:	e8 26 09 00 00       	call   800b89 <sys_cputs>
+
+	return b.cnt;
+}
+  800263:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800269:	c9                   	leave
+  80026a:	c3                   	ret
+
+0080026b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80026b:	55                   	push   %ebp
+  80026c:	89 e5                	mov    %esp,%ebp
+  80026e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800271:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800274:	50                   	push   %eax
+  800275:	ff 75 08             	push   0x8(%ebp)
+  800278:	e8 9d ff ff ff       	call   80021a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80027d:	c9                   	leave
+  80027e:	c3                   	ret
+
+0080027f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80027f:	55                   	push   %ebp
+  800280:	89 e5                	mov    %esp,%ebp
+  800282:	57                   	push   %edi
+  800283:	56                   	push   %esi
+  800284:	53                   	push   %ebx
+  800285:	83 ec 1c             	sub    $0x1c,%esp
+  800288:	89 c7                	mov    %eax,%edi
+  80028a:	89 d6                	mov    %edx,%esi
+  80028c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800292:	89 d1                	mov    %edx,%ecx
+  800294:	89 c2                	mov    %eax,%edx
+  800296:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800299:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80029c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80029f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002a5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002ac:	39 c2                	cmp    %eax,%edx
+  8002ae:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002b1:	72 3e                	jb     8002f1 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002b3:	83 ec 0c             	sub    $0xc,%esp
+  8002b6:	ff 75 18             	push   0x18(%ebp)
+  8002b9:	83 eb 01             	sub    $0x1,%ebx
+  8002bc:	53                   	push   %ebx
+  8002bd:	50                   	push   %eax
+  8002be:	83 ec 08             	sub    $0x8,%esp
+  8002c1:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c4:	ff 75 e0             	push   -0x20(%ebp)
+  8002c7:	ff 75 dc             	push   -0x24(%ebp)
+  8002ca:	ff 75 d8             	push   -0x28(%ebp)
+  8002cd:	e8 05 35 00 00       	call   8037d7 <__udivdi3>
+  8002d2:	83 c4 18             	add    $0x18,%esp
+  8002d5:	52                   	push   %edx
+  8002d6:	50                   	push   %eax
+  8002d7:	89 f2                	mov    %esi,%edx
+  8002d9:	89 f8                	mov    %edi,%eax
+  8002db:	e8 9f ff ff ff       	call   80027f <printnum>
+  8002e0:	83 c4 20             	add    $0x20,%esp
+  8002e3:	eb 13                	jmp    8002f8 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002e5:	83 ec 08             	sub    $0x8,%esp
+  8002e8:	56                   	push   %esi
+  8002e9:	ff 75 18             	push   0x18(%ebp)
+  8002ec:	ff d7                	call   *%edi
+  8002ee:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002f1:	83 eb 01             	sub    $0x1,%ebx
+  8002f4:	85 db                	test   %ebx,%ebx
+  8002f6:	7f ed                	jg     8002e5 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002f8:	83 ec 08             	sub    $0x8,%esp
+  8002fb:	56                   	push   %esi
+  8002fc:	83 ec 04             	sub    $0x4,%esp
+  8002ff:	ff 75 e4             	push   -0x1c(%ebp)
+  800302:	ff 75 e0             	push   -0x20(%ebp)
+  800305:	ff 75 dc             	push   -0x24(%ebp)
+  800308:	ff 75 d8             	push   -0x28(%ebp)
+  80030b:	e8 e5 34 00 00       	call   8037f5 <__umoddi3>
+  800310:	83 c4 14             	add    $0x14,%esp
+  800313:	0f be 80 c7 39 80 00 	movsbl 0x8039c7(%eax),%eax
+  80031a:	50                   	push   %eax
+  80031b:	ff d7                	call   *%edi
+}
+  80031d:	83 c4 10             	add    $0x10,%esp
+  800320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800323:	5b                   	pop    %ebx
+  800324:	5e                   	pop    %esi
+  800325:	5f                   	pop    %edi
+  800326:	5d                   	pop    %ebp
+  800327:	c3                   	ret
+
+00800328 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800328:	55                   	push   %ebp
+  800329:	89 e5                	mov    %esp,%ebp
+  80032b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80032e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800332:	8b 10                	mov    (%eax),%edx
+  800334:	3b 50 04             	cmp    0x4(%eax),%edx
+  800337:	73 0a                	jae    800343 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800339:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80033c:	89 08                	mov    %ecx,(%eax)
+  80033e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800341:	88 02                	mov    %al,(%edx)
+}
+  800343:	5d                   	pop    %ebp
+  800344:	c3                   	ret
+
+00800345 <printfmt>:
+{
+  800345:	55                   	push   %ebp
+  800346:	89 e5                	mov    %esp,%ebp
+  800348:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80034b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80034e:	50                   	push   %eax
+  80034f:	ff 75 10             	push   0x10(%ebp)
+  800352:	ff 75 0c             	push   0xc(%ebp)
+  800355:	ff 75 08             	push   0x8(%ebp)
+  800358:	e8 05 00 00 00       	call   800362 <vprintfmt>
+}
+  80035d:	83 c4 10             	add    $0x10,%esp
+  800360:	c9                   	leave
+  800361:	c3                   	ret
+
+00800362 <vprintfmt>:
+{
+  800362:	55                   	push   %ebp
+  800363:	89 e5                	mov    %esp,%ebp
+  800365:	57                   	push   %edi
+  800366:	56                   	push   %esi
+  800367:	53                   	push   %ebx
+  800368:	83 ec 2c             	sub    $0x2c,%esp
+  80036b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80036e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800371:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800374:	eb 0a                	jmp    800380 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800376:	83 ec 08             	sub    $0x8,%esp
+  800379:	53                   	push   %ebx
+  80037a:	50                   	push   %eax
+  80037b:	ff d6                	call   *%esi
+  80037d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800380:	83 c7 01             	add    $0x1,%edi
+  800383:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800387:	83 f8 25             	cmp    $0x25,%eax
+  80038a:	74 0c                	je     800398 <vprintfmt+0x36>
+			if (ch == '\0')
+  80038c:	85 c0                	test   %eax,%eax
+  80038e:	75 e6                	jne    800376 <vprintfmt+0x14>
+}
+  800390:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800393:	5b                   	pop    %ebx
+  800394:	5e                   	pop    %esi
+  800395:	5f                   	pop    %edi
+  800396:	5d                   	pop    %ebp
+  800397:	c3                   	ret
+		padc = ' ';
+  800398:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80039c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003a3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003aa:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b6:	8d 47 01             	lea    0x1(%edi),%eax
+  8003b9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003bc:	0f b6 17             	movzbl (%edi),%edx
+  8003bf:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003c2:	3c 55                	cmp    $0x55,%al
+  8003c4:	0f 87 cf 03 00 00    	ja     800799 <vprintfmt+0x437>
+  8003ca:	0f b6 c0             	movzbl %al,%eax
+  8003cd:	ff 24 85 20 3b 80 00 	jmp    *0x803b20(,%eax,4)
+  8003d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003d7:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003db:	eb d9                	jmp    8003b6 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003e0:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003e4:	eb d0                	jmp    8003b6 <vprintfmt+0x54>
+  8003e6:	0f b6 d2             	movzbl %dl,%edx
+  8003e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f1:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003f4:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003f7:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003fb:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003fe:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800401:	83 f9 09             	cmp    $0x9,%ecx
+  800404:	77 55                	ja     80045b <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800406:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800409:	eb e9                	jmp    8003f4 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80040b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040e:	8b 00                	mov    (%eax),%eax
+  800410:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800413:	8b 45 14             	mov    0x14(%ebp),%eax
+  800416:	8d 40 04             	lea    0x4(%eax),%eax
+  800419:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80041c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80041f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800423:	79 91                	jns    8003b6 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800425:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800428:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80042b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800432:	eb 82                	jmp    8003b6 <vprintfmt+0x54>
+			if (width < 0)
+  800434:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800437:	85 d2                	test   %edx,%edx
+  800439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043e:	0f 49 c2             	cmovns %edx,%eax
+  800441:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800444:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800447:	e9 6a ff ff ff       	jmp    8003b6 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80044c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80044f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800456:	e9 5b ff ff ff       	jmp    8003b6 <vprintfmt+0x54>
+  80045b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80045e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800461:	eb bc                	jmp    80041f <vprintfmt+0xbd>
+			lflag++;
+  800463:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800466:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800469:	e9 48 ff ff ff       	jmp    8003b6 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80046e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800471:	8d 78 04             	lea    0x4(%eax),%edi
+  800474:	83 ec 08             	sub    $0x8,%esp
+  800477:	53                   	push   %ebx
+  800478:	ff 30                	push   (%eax)
+  80047a:	ff d6                	call   *%esi
+			break;
+  80047c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80047f:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800482:	e9 b1 02 00 00       	jmp    800738 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800487:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80048d:	8b 10                	mov    (%eax),%edx
+  80048f:	89 d0                	mov    %edx,%eax
+  800491:	f7 d8                	neg    %eax
+  800493:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800496:	83 f8 11             	cmp    $0x11,%eax
+  800499:	7f 23                	jg     8004be <vprintfmt+0x15c>
+  80049b:	8b 14 85 80 3c 80 00 	mov    0x803c80(,%eax,4),%edx
+  8004a2:	85 d2                	test   %edx,%edx
+  8004a4:	74 18                	je     8004be <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004a6:	52                   	push   %edx
+  8004a7:	68 d2 3d 80 00       	push   $0x803dd2
+  8004ac:	53                   	push   %ebx
+  8004ad:	56                   	push   %esi
+  8004ae:	e8 92 fe ff ff       	call   800345 <printfmt>
+  8004b3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004b6:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004b9:	e9 7a 02 00 00       	jmp    800738 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8004be:	50                   	push   %eax
+  8004bf:	68 df 39 80 00       	push   $0x8039df
+  8004c4:	53                   	push   %ebx
+  8004c5:	56                   	push   %esi
+  8004c6:	e8 7a fe ff ff       	call   800345 <printfmt>
+  8004cb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004ce:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004d1:	e9 62 02 00 00       	jmp    800738 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d9:	83 c0 04             	add    $0x4,%eax
+  8004dc:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e2:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004e4:	85 c9                	test   %ecx,%ecx
+  8004e6:	b8 d8 39 80 00       	mov    $0x8039d8,%eax
+  8004eb:	0f 45 c1             	cmovne %ecx,%eax
+  8004ee:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004f1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004f5:	7e 06                	jle    8004fd <vprintfmt+0x19b>
+  8004f7:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004fb:	75 0b                	jne    800508 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fd:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800500:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800503:	89 75 08             	mov    %esi,0x8(%ebp)
+  800506:	eb 5c                	jmp    800564 <vprintfmt+0x202>
+  800508:	83 ec 08             	sub    $0x8,%esp
+  80050b:	ff 75 d0             	push   -0x30(%ebp)
+  80050e:	ff 75 cc             	push   -0x34(%ebp)
+  800511:	e8 20 03 00 00       	call   800836 <strnlen>
+  800516:	89 c2                	mov    %eax,%edx
+  800518:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80051b:	29 d0                	sub    %edx,%eax
+  80051d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800520:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800524:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800527:	89 75 08             	mov    %esi,0x8(%ebp)
+  80052a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80052c:	eb 0e                	jmp    80053c <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80052e:	83 ec 08             	sub    $0x8,%esp
+  800531:	53                   	push   %ebx
+  800532:	57                   	push   %edi
+  800533:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800536:	83 ee 01             	sub    $0x1,%esi
+  800539:	83 c4 10             	add    $0x10,%esp
+  80053c:	85 f6                	test   %esi,%esi
+  80053e:	7f ee                	jg     80052e <vprintfmt+0x1cc>
+  800540:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800543:	8b 75 08             	mov    0x8(%ebp),%esi
+  800546:	85 c0                	test   %eax,%eax
+  800548:	ba 00 00 00 00       	mov    $0x0,%edx
+  80054d:	0f 49 d0             	cmovns %eax,%edx
+  800550:	29 d0                	sub    %edx,%eax
+  800552:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800555:	eb a6                	jmp    8004fd <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800557:	83 ec 08             	sub    $0x8,%esp
+  80055a:	53                   	push   %ebx
+  80055b:	52                   	push   %edx
+  80055c:	ff 55 08             	call   *0x8(%ebp)
+  80055f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800562:	89 f1                	mov    %esi,%ecx
+  800564:	8d 71 01             	lea    0x1(%ecx),%esi
+  800567:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80056b:	0f be d0             	movsbl %al,%edx
+  80056e:	85 d2                	test   %edx,%edx
+  800570:	74 28                	je     80059a <vprintfmt+0x238>
+  800572:	85 ff                	test   %edi,%edi
+  800574:	78 05                	js     80057b <vprintfmt+0x219>
+  800576:	83 ef 01             	sub    $0x1,%edi
+  800579:	78 30                	js     8005ab <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80057b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80057f:	74 d6                	je     800557 <vprintfmt+0x1f5>
+  800581:	0f be c0             	movsbl %al,%eax
+  800584:	83 e8 20             	sub    $0x20,%eax
+  800587:	83 f8 5e             	cmp    $0x5e,%eax
+  80058a:	76 cb                	jbe    800557 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80058c:	83 ec 08             	sub    $0x8,%esp
+  80058f:	53                   	push   %ebx
+  800590:	6a 3f                	push   $0x3f
+  800592:	ff 55 08             	call   *0x8(%ebp)
+  800595:	83 c4 10             	add    $0x10,%esp
+  800598:	eb c8                	jmp    800562 <vprintfmt+0x200>
+  80059a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80059d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005a0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005a3:	01 d0                	add    %edx,%eax
+  8005a5:	29 c8                	sub    %ecx,%eax
+  8005a7:	89 c7                	mov    %eax,%edi
+  8005a9:	eb 13                	jmp    8005be <vprintfmt+0x25c>
+  8005ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ae:	eb ed                	jmp    80059d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005b0:	83 ec 08             	sub    $0x8,%esp
+  8005b3:	53                   	push   %ebx
+  8005b4:	6a 20                	push   $0x20
+  8005b6:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005b8:	83 ef 01             	sub    $0x1,%edi
+  8005bb:	83 c4 10             	add    $0x10,%esp
+  8005be:	85 ff                	test   %edi,%edi
+  8005c0:	7f ee                	jg     8005b0 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005c2:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005c5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c8:	e9 6b 01 00 00       	jmp    800738 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8005cd:	83 f9 01             	cmp    $0x1,%ecx
+  8005d0:	7f 1f                	jg     8005f1 <vprintfmt+0x28f>
+	else if (lflag)
+  8005d2:	85 c9                	test   %ecx,%ecx
+  8005d4:	74 67                	je     80063d <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8005d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d9:	8b 00                	mov    (%eax),%eax
+  8005db:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005de:	89 c1                	mov    %eax,%ecx
+  8005e0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005e3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ec:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ef:	eb 17                	jmp    800608 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8b 50 04             	mov    0x4(%eax),%edx
+  8005f7:	8b 00                	mov    (%eax),%eax
+  8005f9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005fc:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800602:	8d 40 08             	lea    0x8(%eax),%eax
+  800605:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800608:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80060b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80060e:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800613:	85 c9                	test   %ecx,%ecx
+  800615:	0f 89 03 01 00 00    	jns    80071e <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80061b:	83 ec 08             	sub    $0x8,%esp
+  80061e:	53                   	push   %ebx
+  80061f:	6a 2d                	push   $0x2d
+  800621:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800623:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800626:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800629:	f7 da                	neg    %edx
+  80062b:	83 d1 00             	adc    $0x0,%ecx
+  80062e:	f7 d9                	neg    %ecx
+  800630:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800633:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800638:	e9 e1 00 00 00       	jmp    80071e <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80063d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800640:	8b 00                	mov    (%eax),%eax
+  800642:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800645:	89 c1                	mov    %eax,%ecx
+  800647:	c1 f9 1f             	sar    $0x1f,%ecx
+  80064a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80064d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800650:	8d 40 04             	lea    0x4(%eax),%eax
+  800653:	89 45 14             	mov    %eax,0x14(%ebp)
+  800656:	eb b0                	jmp    800608 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800658:	83 f9 01             	cmp    $0x1,%ecx
+  80065b:	7f 1e                	jg     80067b <vprintfmt+0x319>
+	else if (lflag)
+  80065d:	85 c9                	test   %ecx,%ecx
+  80065f:	74 32                	je     800693 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800661:	8b 45 14             	mov    0x14(%ebp),%eax
+  800664:	8b 10                	mov    (%eax),%edx
+  800666:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066b:	8d 40 04             	lea    0x4(%eax),%eax
+  80066e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800671:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800676:	e9 a3 00 00 00       	jmp    80071e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	8b 10                	mov    (%eax),%edx
+  800680:	8b 48 04             	mov    0x4(%eax),%ecx
+  800683:	8d 40 08             	lea    0x8(%eax),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800689:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80068e:	e9 8b 00 00 00       	jmp    80071e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8b 10                	mov    (%eax),%edx
+  800698:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069d:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006a3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006a8:	eb 74                	jmp    80071e <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8006aa:	83 f9 01             	cmp    $0x1,%ecx
+  8006ad:	7f 1b                	jg     8006ca <vprintfmt+0x368>
+	else if (lflag)
+  8006af:	85 c9                	test   %ecx,%ecx
+  8006b1:	74 2c                	je     8006df <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8006b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b6:	8b 10                	mov    (%eax),%edx
+  8006b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006c3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006c8:	eb 54                	jmp    80071e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cd:	8b 10                	mov    (%eax),%edx
+  8006cf:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d2:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006d8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006dd:	eb 3f                	jmp    80071e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e2:	8b 10                	mov    (%eax),%edx
+  8006e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ef:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006f4:	eb 28                	jmp    80071e <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006f6:	83 ec 08             	sub    $0x8,%esp
+  8006f9:	53                   	push   %ebx
+  8006fa:	6a 30                	push   $0x30
+  8006fc:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006fe:	83 c4 08             	add    $0x8,%esp
+  800701:	53                   	push   %ebx
+  800702:	6a 78                	push   $0x78
+  800704:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800706:	8b 45 14             	mov    0x14(%ebp),%eax
+  800709:	8b 10                	mov    (%eax),%edx
+  80070b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800710:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800713:	8d 40 04             	lea    0x4(%eax),%eax
+  800716:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800719:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80071e:	83 ec 0c             	sub    $0xc,%esp
+  800721:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800725:	50                   	push   %eax
+  800726:	ff 75 e0             	push   -0x20(%ebp)
+  800729:	57                   	push   %edi
+  80072a:	51                   	push   %ecx
+  80072b:	52                   	push   %edx
+  80072c:	89 da                	mov    %ebx,%edx
+  80072e:	89 f0                	mov    %esi,%eax
+  800730:	e8 4a fb ff ff       	call   80027f <printnum>
+			break;
+  800735:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800738:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80073b:	e9 40 fc ff ff       	jmp    800380 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800740:	83 f9 01             	cmp    $0x1,%ecx
+  800743:	7f 1b                	jg     800760 <vprintfmt+0x3fe>
+	else if (lflag)
+  800745:	85 c9                	test   %ecx,%ecx
+  800747:	74 2c                	je     800775 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800749:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074c:	8b 10                	mov    (%eax),%edx
+  80074e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800753:	8d 40 04             	lea    0x4(%eax),%eax
+  800756:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800759:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80075e:	eb be                	jmp    80071e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800760:	8b 45 14             	mov    0x14(%ebp),%eax
+  800763:	8b 10                	mov    (%eax),%edx
+  800765:	8b 48 04             	mov    0x4(%eax),%ecx
+  800768:	8d 40 08             	lea    0x8(%eax),%eax
+  80076b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80076e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800773:	eb a9                	jmp    80071e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800775:	8b 45 14             	mov    0x14(%ebp),%eax
+  800778:	8b 10                	mov    (%eax),%edx
+  80077a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077f:	8d 40 04             	lea    0x4(%eax),%eax
+  800782:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800785:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80078a:	eb 92                	jmp    80071e <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80078c:	83 ec 08             	sub    $0x8,%esp
+  80078f:	53                   	push   %ebx
+  800790:	6a 25                	push   $0x25
+  800792:	ff d6                	call   *%esi
+			break;
+  800794:	83 c4 10             	add    $0x10,%esp
+  800797:	eb 9f                	jmp    800738 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800799:	83 ec 08             	sub    $0x8,%esp
+  80079c:	53                   	push   %ebx
+  80079d:	6a 25                	push   $0x25
+  80079f:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007a1:	83 c4 10             	add    $0x10,%esp
+  8007a4:	89 f8                	mov    %edi,%eax
+  8007a6:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007aa:	74 05                	je     8007b1 <vprintfmt+0x44f>
+  8007ac:	83 e8 01             	sub    $0x1,%eax
+  8007af:	eb f5                	jmp    8007a6 <vprintfmt+0x444>
+  8007b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007b4:	eb 82                	jmp    800738 <vprintfmt+0x3d6>
+
+008007b6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007b6:	55                   	push   %ebp
+  8007b7:	89 e5                	mov    %esp,%ebp
+  8007b9:	83 ec 18             	sub    $0x18,%esp
+  8007bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007c2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007c5:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007c9:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007cc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007d3:	85 c0                	test   %eax,%eax
+  8007d5:	74 26                	je     8007fd <vsnprintf+0x47>
+  8007d7:	85 d2                	test   %edx,%edx
+  8007d9:	7e 22                	jle    8007fd <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007db:	ff 75 14             	push   0x14(%ebp)
+  8007de:	ff 75 10             	push   0x10(%ebp)
+  8007e1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007e4:	50                   	push   %eax
+  8007e5:	68 28 03 80 00       	push   $0x800328
+  8007ea:	e8 73 fb ff ff       	call   800362 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007ef:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007f2:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007f8:	83 c4 10             	add    $0x10,%esp
+}
+  8007fb:	c9                   	leave
+  8007fc:	c3                   	ret
+		return -E_INVAL;
+  8007fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800802:	eb f7                	jmp    8007fb <vsnprintf+0x45>
+
+00800804 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800804:	55                   	push   %ebp
+  800805:	89 e5                	mov    %esp,%ebp
+  800807:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80080a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80080d:	50                   	push   %eax
+  80080e:	ff 75 10             	push   0x10(%ebp)
+  800811:	ff 75 0c             	push   0xc(%ebp)
+  800814:	ff 75 08             	push   0x8(%ebp)
+  800817:	e8 9a ff ff ff       	call   8007b6 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80081c:	c9                   	leave
+  80081d:	c3                   	ret
+
+0080081e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80081e:	55                   	push   %ebp
+  80081f:	89 e5                	mov    %esp,%ebp
+  800821:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800824:	b8 00 00 00 00       	mov    $0x0,%eax
+  800829:	eb 03                	jmp    80082e <strlen+0x10>
+		n++;
+  80082b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80082e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800832:	75 f7                	jne    80082b <strlen+0xd>
+	return n;
+}
+  800834:	5d                   	pop    %ebp
+  800835:	c3                   	ret
+
+00800836 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800836:	55                   	push   %ebp
+  800837:	89 e5                	mov    %esp,%ebp
+  800839:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80083c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80083f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800844:	eb 03                	jmp    800849 <strnlen+0x13>
+		n++;
+  800846:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800849:	39 d0                	cmp    %edx,%eax
+  80084b:	74 08                	je     800855 <strnlen+0x1f>
+  80084d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800851:	75 f3                	jne    800846 <strnlen+0x10>
+  800853:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800855:	89 d0                	mov    %edx,%eax
+  800857:	5d                   	pop    %ebp
+  800858:	c3                   	ret
+
+00800859 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800859:	55                   	push   %ebp
+  80085a:	89 e5                	mov    %esp,%ebp
+  80085c:	53                   	push   %ebx
+  80085d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800860:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800863:	b8 00 00 00 00       	mov    $0x0,%eax
+  800868:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80086c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80086f:	83 c0 01             	add    $0x1,%eax
+  800872:	84 d2                	test   %dl,%dl
+  800874:	75 f2                	jne    800868 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800876:	89 c8                	mov    %ecx,%eax
+  800878:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80087b:	c9                   	leave
+  80087c:	c3                   	ret
+
+0080087d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80087d:	55                   	push   %ebp
+  80087e:	89 e5                	mov    %esp,%ebp
+  800880:	53                   	push   %ebx
+  800881:	83 ec 10             	sub    $0x10,%esp
+  800884:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800887:	53                   	push   %ebx
+  800888:	e8 91 ff ff ff       	call   80081e <strlen>
+  80088d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800890:	ff 75 0c             	push   0xc(%ebp)
+  800893:	01 d8                	add    %ebx,%eax
+  800895:	50                   	push   %eax
+  800896:	e8 be ff ff ff       	call   800859 <strcpy>
+	return dst;
+}
+  80089b:	89 d8                	mov    %ebx,%eax
+  80089d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a0:	c9                   	leave
+  8008a1:	c3                   	ret
+
+008008a2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008a2:	55                   	push   %ebp
+  8008a3:	89 e5                	mov    %esp,%ebp
+  8008a5:	56                   	push   %esi
+  8008a6:	53                   	push   %ebx
+  8008a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008ad:	89 f3                	mov    %esi,%ebx
+  8008af:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008b2:	89 f0                	mov    %esi,%eax
+  8008b4:	eb 0f                	jmp    8008c5 <strncpy+0x23>
+		*dst++ = *src;
+  8008b6:	83 c0 01             	add    $0x1,%eax
+  8008b9:	0f b6 0a             	movzbl (%edx),%ecx
+  8008bc:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008bf:	80 f9 01             	cmp    $0x1,%cl
+  8008c2:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008c5:	39 d8                	cmp    %ebx,%eax
+  8008c7:	75 ed                	jne    8008b6 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008c9:	89 f0                	mov    %esi,%eax
+  8008cb:	5b                   	pop    %ebx
+  8008cc:	5e                   	pop    %esi
+  8008cd:	5d                   	pop    %ebp
+  8008ce:	c3                   	ret
+
+008008cf <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008cf:	55                   	push   %ebp
+  8008d0:	89 e5                	mov    %esp,%ebp
+  8008d2:	56                   	push   %esi
+  8008d3:	53                   	push   %ebx
+  8008d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008da:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008dd:	89 f0                	mov    %esi,%eax
+  8008df:	85 d2                	test   %edx,%edx
+  8008e1:	74 21                	je     800904 <strlcpy+0x35>
+  8008e3:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008e7:	89 f2                	mov    %esi,%edx
+  8008e9:	eb 09                	jmp    8008f4 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008eb:	83 c1 01             	add    $0x1,%ecx
+  8008ee:	83 c2 01             	add    $0x1,%edx
+  8008f1:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008f4:	39 c2                	cmp    %eax,%edx
+  8008f6:	74 09                	je     800901 <strlcpy+0x32>
+  8008f8:	0f b6 19             	movzbl (%ecx),%ebx
+  8008fb:	84 db                	test   %bl,%bl
+  8008fd:	75 ec                	jne    8008eb <strlcpy+0x1c>
+  8008ff:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800901:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800904:	29 f0                	sub    %esi,%eax
+}
+  800906:	5b                   	pop    %ebx
+  800907:	5e                   	pop    %esi
+  800908:	5d                   	pop    %ebp
+  800909:	c3                   	ret
+
+0080090a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80090a:	55                   	push   %ebp
+  80090b:	89 e5                	mov    %esp,%ebp
+  80090d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800910:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800913:	eb 06                	jmp    80091b <strcmp+0x11>
+		p++, q++;
+  800915:	83 c1 01             	add    $0x1,%ecx
+  800918:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80091b:	0f b6 01             	movzbl (%ecx),%eax
+  80091e:	84 c0                	test   %al,%al
+  800920:	74 04                	je     800926 <strcmp+0x1c>
+  800922:	3a 02                	cmp    (%edx),%al
+  800924:	74 ef                	je     800915 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800926:	0f b6 c0             	movzbl %al,%eax
+  800929:	0f b6 12             	movzbl (%edx),%edx
+  80092c:	29 d0                	sub    %edx,%eax
+}
+  80092e:	5d                   	pop    %ebp
+  80092f:	c3                   	ret
+
+00800930 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800930:	55                   	push   %ebp
+  800931:	89 e5                	mov    %esp,%ebp
+  800933:	53                   	push   %ebx
+  800934:	8b 45 08             	mov    0x8(%ebp),%eax
+  800937:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80093a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80093d:	eb 09                	jmp    800948 <strncmp+0x18>
+		n--, p++, q++;
+  80093f:	83 ea 01             	sub    $0x1,%edx
+  800942:	83 c0 01             	add    $0x1,%eax
+  800945:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800948:	85 d2                	test   %edx,%edx
+  80094a:	74 18                	je     800964 <strncmp+0x34>
+  80094c:	0f b6 18             	movzbl (%eax),%ebx
+  80094f:	84 db                	test   %bl,%bl
+  800951:	74 04                	je     800957 <strncmp+0x27>
+  800953:	3a 19                	cmp    (%ecx),%bl
+  800955:	74 e8                	je     80093f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800957:	0f b6 00             	movzbl (%eax),%eax
+  80095a:	0f b6 11             	movzbl (%ecx),%edx
+  80095d:	29 d0                	sub    %edx,%eax
+}
+  80095f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800962:	c9                   	leave
+  800963:	c3                   	ret
+		return 0;
+  800964:	b8 00 00 00 00       	mov    $0x0,%eax
+  800969:	eb f4                	jmp    80095f <strncmp+0x2f>
+
+0080096b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80096b:	55                   	push   %ebp
+  80096c:	89 e5                	mov    %esp,%ebp
+  80096e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800971:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800975:	eb 03                	jmp    80097a <strchr+0xf>
+  800977:	83 c0 01             	add    $0x1,%eax
+  80097a:	0f b6 10             	movzbl (%eax),%edx
+  80097d:	84 d2                	test   %dl,%dl
+  80097f:	74 06                	je     800987 <strchr+0x1c>
+		if (*s == c)
+  800981:	38 ca                	cmp    %cl,%dl
+  800983:	75 f2                	jne    800977 <strchr+0xc>
+  800985:	eb 05                	jmp    80098c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800987:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80098c:	5d                   	pop    %ebp
+  80098d:	c3                   	ret
+
+0080098e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80098e:	55                   	push   %ebp
+  80098f:	89 e5                	mov    %esp,%ebp
+  800991:	8b 45 08             	mov    0x8(%ebp),%eax
+  800994:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800998:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80099b:	38 ca                	cmp    %cl,%dl
+  80099d:	74 09                	je     8009a8 <strfind+0x1a>
+  80099f:	84 d2                	test   %dl,%dl
+  8009a1:	74 05                	je     8009a8 <strfind+0x1a>
+	for (; *s; s++)
+  8009a3:	83 c0 01             	add    $0x1,%eax
+  8009a6:	eb f0                	jmp    800998 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009a8:	5d                   	pop    %ebp
+  8009a9:	c3                   	ret
+
+008009aa <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009aa:	55                   	push   %ebp
+  8009ab:	89 e5                	mov    %esp,%ebp
+  8009ad:	57                   	push   %edi
+  8009ae:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009b1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009b4:	85 c9                	test   %ecx,%ecx
+  8009b6:	74 20                	je     8009d8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009b8:	89 f8                	mov    %edi,%eax
+  8009ba:	09 c8                	or     %ecx,%eax
+  8009bc:	a8 03                	test   $0x3,%al
+  8009be:	75 12                	jne    8009d2 <memset+0x28>
+		c &= 0xFF;
+  8009c0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009c4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009ca:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009cd:	fc                   	cld
+  8009ce:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009d0:	eb 06                	jmp    8009d8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009d5:	fc                   	cld
+  8009d6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009d8:	89 f8                	mov    %edi,%eax
+  8009da:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009dd:	c9                   	leave
+  8009de:	c3                   	ret
+
+008009df <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009df:	55                   	push   %ebp
+  8009e0:	89 e5                	mov    %esp,%ebp
+  8009e2:	57                   	push   %edi
+  8009e3:	56                   	push   %esi
+  8009e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009ea:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009ed:	39 c6                	cmp    %eax,%esi
+  8009ef:	73 32                	jae    800a23 <memmove+0x44>
+  8009f1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009f4:	39 d0                	cmp    %edx,%eax
+  8009f6:	73 2b                	jae    800a23 <memmove+0x44>
+		s += n;
+		d += n;
+  8009f8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009fb:	89 d6                	mov    %edx,%esi
+  8009fd:	09 fe                	or     %edi,%esi
+  8009ff:	09 ce                	or     %ecx,%esi
+  800a01:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a07:	75 0e                	jne    800a17 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a09:	83 ef 04             	sub    $0x4,%edi
+  800a0c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a0f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a12:	fd                   	std
+  800a13:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a15:	eb 09                	jmp    800a20 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a17:	83 ef 01             	sub    $0x1,%edi
+  800a1a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a1d:	fd                   	std
+  800a1e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a20:	fc                   	cld
+  800a21:	eb 1a                	jmp    800a3d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a23:	89 f2                	mov    %esi,%edx
+  800a25:	09 c2                	or     %eax,%edx
+  800a27:	09 ca                	or     %ecx,%edx
+  800a29:	f6 c2 03             	test   $0x3,%dl
+  800a2c:	75 0a                	jne    800a38 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a2e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a31:	89 c7                	mov    %eax,%edi
+  800a33:	fc                   	cld
+  800a34:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a36:	eb 05                	jmp    800a3d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a38:	89 c7                	mov    %eax,%edi
+  800a3a:	fc                   	cld
+  800a3b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a3d:	5e                   	pop    %esi
+  800a3e:	5f                   	pop    %edi
+  800a3f:	5d                   	pop    %ebp
+  800a40:	c3                   	ret
+
+00800a41 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a41:	55                   	push   %ebp
+  800a42:	89 e5                	mov    %esp,%ebp
+  800a44:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a47:	ff 75 10             	push   0x10(%ebp)
+  800a4a:	ff 75 0c             	push   0xc(%ebp)
+  800a4d:	ff 75 08             	push   0x8(%ebp)
+  800a50:	e8 8a ff ff ff       	call   8009df <memmove>
+}
+  800a55:	c9                   	leave
+  800a56:	c3                   	ret
+
+00800a57 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a57:	55                   	push   %ebp
+  800a58:	89 e5                	mov    %esp,%ebp
+  800a5a:	56                   	push   %esi
+  800a5b:	53                   	push   %ebx
+  800a5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a62:	89 c6                	mov    %eax,%esi
+  800a64:	03 75 10             	add    0x10(%ebp),%esi
+  800a67:	eb 06                	jmp    800a6f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a69:	83 c0 01             	add    $0x1,%eax
+  800a6c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a6f:	39 f0                	cmp    %esi,%eax
+  800a71:	74 14                	je     800a87 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a73:	0f b6 08             	movzbl (%eax),%ecx
+  800a76:	0f b6 1a             	movzbl (%edx),%ebx
+  800a79:	38 d9                	cmp    %bl,%cl
+  800a7b:	74 ec                	je     800a69 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a7d:	0f b6 c1             	movzbl %cl,%eax
+  800a80:	0f b6 db             	movzbl %bl,%ebx
+  800a83:	29 d8                	sub    %ebx,%eax
+  800a85:	eb 05                	jmp    800a8c <memcmp+0x35>
+	}
+
+	return 0;
+  800a87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a8c:	5b                   	pop    %ebx
+  800a8d:	5e                   	pop    %esi
+  800a8e:	5d                   	pop    %ebp
+  800a8f:	c3                   	ret
+
+00800a90 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a90:	55                   	push   %ebp
+  800a91:	89 e5                	mov    %esp,%ebp
+  800a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a99:	89 c2                	mov    %eax,%edx
+  800a9b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a9e:	eb 03                	jmp    800aa3 <memfind+0x13>
+  800aa0:	83 c0 01             	add    $0x1,%eax
+  800aa3:	39 d0                	cmp    %edx,%eax
+  800aa5:	73 04                	jae    800aab <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800aa7:	38 08                	cmp    %cl,(%eax)
+  800aa9:	75 f5                	jne    800aa0 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800aab:	5d                   	pop    %ebp
+  800aac:	c3                   	ret
+
+00800aad <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800aad:	55                   	push   %ebp
+  800aae:	89 e5                	mov    %esp,%ebp
+  800ab0:	57                   	push   %edi
+  800ab1:	56                   	push   %esi
+  800ab2:	53                   	push   %ebx
+  800ab3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ab6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ab9:	eb 03                	jmp    800abe <strtol+0x11>
+		s++;
+  800abb:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800abe:	0f b6 02             	movzbl (%edx),%eax
+  800ac1:	3c 20                	cmp    $0x20,%al
+  800ac3:	74 f6                	je     800abb <strtol+0xe>
+  800ac5:	3c 09                	cmp    $0x9,%al
+  800ac7:	74 f2                	je     800abb <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ac9:	3c 2b                	cmp    $0x2b,%al
+  800acb:	74 2a                	je     800af7 <strtol+0x4a>
+	int neg = 0;
+  800acd:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ad2:	3c 2d                	cmp    $0x2d,%al
+  800ad4:	74 2b                	je     800b01 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ad6:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800adc:	75 0f                	jne    800aed <strtol+0x40>
+  800ade:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ae1:	74 28                	je     800b0b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ae3:	85 db                	test   %ebx,%ebx
+  800ae5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aea:	0f 44 d8             	cmove  %eax,%ebx
+  800aed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af2:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800af5:	eb 46                	jmp    800b3d <strtol+0x90>
+		s++;
+  800af7:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800afa:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aff:	eb d5                	jmp    800ad6 <strtol+0x29>
+		s++, neg = 1;
+  800b01:	83 c2 01             	add    $0x1,%edx
+  800b04:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b09:	eb cb                	jmp    800ad6 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b0b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b0f:	74 0e                	je     800b1f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b11:	85 db                	test   %ebx,%ebx
+  800b13:	75 d8                	jne    800aed <strtol+0x40>
+		s++, base = 8;
+  800b15:	83 c2 01             	add    $0x1,%edx
+  800b18:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b1d:	eb ce                	jmp    800aed <strtol+0x40>
+		s += 2, base = 16;
+  800b1f:	83 c2 02             	add    $0x2,%edx
+  800b22:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b27:	eb c4                	jmp    800aed <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b29:	0f be c0             	movsbl %al,%eax
+  800b2c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b2f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b32:	7d 3a                	jge    800b6e <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b34:	83 c2 01             	add    $0x1,%edx
+  800b37:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b3b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b3d:	0f b6 02             	movzbl (%edx),%eax
+  800b40:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b43:	89 f3                	mov    %esi,%ebx
+  800b45:	80 fb 09             	cmp    $0x9,%bl
+  800b48:	76 df                	jbe    800b29 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b4a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b4d:	89 f3                	mov    %esi,%ebx
+  800b4f:	80 fb 19             	cmp    $0x19,%bl
+  800b52:	77 08                	ja     800b5c <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b54:	0f be c0             	movsbl %al,%eax
+  800b57:	83 e8 57             	sub    $0x57,%eax
+  800b5a:	eb d3                	jmp    800b2f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b5c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b5f:	89 f3                	mov    %esi,%ebx
+  800b61:	80 fb 19             	cmp    $0x19,%bl
+  800b64:	77 08                	ja     800b6e <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b66:	0f be c0             	movsbl %al,%eax
+  800b69:	83 e8 37             	sub    $0x37,%eax
+  800b6c:	eb c1                	jmp    800b2f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b6e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b72:	74 05                	je     800b79 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b77:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b79:	89 c8                	mov    %ecx,%eax
+  800b7b:	f7 d8                	neg    %eax
+  800b7d:	85 ff                	test   %edi,%edi
+  800b7f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b82:	89 c8                	mov    %ecx,%eax
+  800b84:	5b                   	pop    %ebx
+  800b85:	5e                   	pop    %esi
+  800b86:	5f                   	pop    %edi
+  800b87:	5d                   	pop    %ebp
+  800b88:	c3                   	ret
+
+00800b89 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b89:	55                   	push   %ebp
+  800b8a:	89 e5                	mov    %esp,%ebp
+  800b8c:	57                   	push   %edi
+  800b8d:	56                   	push   %esi
+  800b8e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b9a:	89 c3                	mov    %eax,%ebx
+  800b9c:	89 c7                	mov    %eax,%edi
+  800b9e:	55                   	push   %ebp
+  800b9f:	89 e5                	mov    %esp,%ebp
+  800ba1:	8d 35 a9 0b 80 00    	lea    0x800ba9,%esi
+  800ba7:	0f 34                	sysenter
+  800ba9:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800baa:	5b                   	pop    %ebx
+  800bab:	5e                   	pop    %esi
+  800bac:	5f                   	pop    %edi
+  800bad:	5d                   	pop    %ebp
+  800bae:	c3                   	ret
+
+00800baf <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800baf:	55                   	push   %ebp
+  800bb0:	89 e5                	mov    %esp,%ebp
+  800bb2:	57                   	push   %edi
+  800bb3:	56                   	push   %esi
+  800bb4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800bb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bba:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bbf:	89 d1                	mov    %edx,%ecx
+  800bc1:	89 d3                	mov    %edx,%ebx
+  800bc3:	89 d7                	mov    %edx,%edi
+  800bc5:	55                   	push   %ebp
+  800bc6:	89 e5                	mov    %esp,%ebp
+  800bc8:	8d 35 d0 0b 80 00    	lea    0x800bd0,%esi
+  800bce:	0f 34                	sysenter
+  800bd0:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800bd1:	5b                   	pop    %ebx
+  800bd2:	5e                   	pop    %esi
+  800bd3:	5f                   	pop    %edi
+  800bd4:	5d                   	pop    %ebp
+  800bd5:	c3                   	ret
+
+00800bd6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bd6:	55                   	push   %ebp
+  800bd7:	89 e5                	mov    %esp,%ebp
+  800bd9:	57                   	push   %edi
+  800bda:	56                   	push   %esi
+  800bdb:	53                   	push   %ebx
+  800bdc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800bdf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800be4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bec:	89 cb                	mov    %ecx,%ebx
+  800bee:	89 cf                	mov    %ecx,%edi
+  800bf0:	55                   	push   %ebp
+  800bf1:	89 e5                	mov    %esp,%ebp
+  800bf3:	8d 35 fb 0b 80 00    	lea    0x800bfb,%esi
+  800bf9:	0f 34                	sysenter
+  800bfb:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bfc:	85 c0                	test   %eax,%eax
+  800bfe:	7f 08                	jg     800c08 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800c00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c03:	5b                   	pop    %ebx
+  800c04:	5e                   	pop    %esi
+  800c05:	5f                   	pop    %edi
+  800c06:	5d                   	pop    %ebp
+  800c07:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c08:	83 ec 0c             	sub    $0xc,%esp
+  800c0b:	50                   	push   %eax
+  800c0c:	6a 03                	push   $0x3
+  800c0e:	68 e7 3c 80 00       	push   $0x803ce7
+  800c13:	6a 3d                	push   $0x3d
+  800c15:	68 04 3d 80 00       	push   $0x803d04
+  800c1a:	e8 71 f5 ff ff       	call   800190 <_panic>
+
+00800c1f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c1f:	55                   	push   %ebp
+  800c20:	89 e5                	mov    %esp,%ebp
+  800c22:	57                   	push   %edi
+  800c23:	56                   	push   %esi
+  800c24:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c25:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c2a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c2f:	89 d1                	mov    %edx,%ecx
+  800c31:	89 d3                	mov    %edx,%ebx
+  800c33:	89 d7                	mov    %edx,%edi
+  800c35:	55                   	push   %ebp
+  800c36:	89 e5                	mov    %esp,%ebp
+  800c38:	8d 35 40 0c 80 00    	lea    0x800c40,%esi
+  800c3e:	0f 34                	sysenter
+  800c40:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800c41:	5b                   	pop    %ebx
+  800c42:	5e                   	pop    %esi
+  800c43:	5f                   	pop    %edi
+  800c44:	5d                   	pop    %ebp
+  800c45:	c3                   	ret
+
+00800c46 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c46:	55                   	push   %ebp
+  800c47:	89 e5                	mov    %esp,%ebp
+  800c49:	57                   	push   %edi
+  800c4a:	56                   	push   %esi
+  800c4b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c51:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c56:	89 d1                	mov    %edx,%ecx
+  800c58:	89 d3                	mov    %edx,%ebx
+  800c5a:	89 d7                	mov    %edx,%edi
+  800c5c:	89 d6                	mov    %edx,%esi
+  800c5e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c60:	5b                   	pop    %ebx
+  800c61:	5e                   	pop    %esi
+  800c62:	5f                   	pop    %edi
+  800c63:	5d                   	pop    %ebp
+  800c64:	c3                   	ret
+
+00800c65 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c65:	55                   	push   %ebp
+  800c66:	89 e5                	mov    %esp,%ebp
+  800c68:	57                   	push   %edi
+  800c69:	56                   	push   %esi
+  800c6a:	53                   	push   %ebx
+  800c6b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c74:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c79:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c81:	55                   	push   %ebp
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	8d 35 8c 0c 80 00    	lea    0x800c8c,%esi
+  800c8a:	0f 34                	sysenter
+  800c8c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c8d:	85 c0                	test   %eax,%eax
+  800c8f:	7f 08                	jg     800c99 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800c91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c94:	5b                   	pop    %ebx
+  800c95:	5e                   	pop    %esi
+  800c96:	5f                   	pop    %edi
+  800c97:	5d                   	pop    %ebp
+  800c98:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c99:	83 ec 0c             	sub    $0xc,%esp
+  800c9c:	50                   	push   %eax
+  800c9d:	6a 04                	push   $0x4
+  800c9f:	68 e7 3c 80 00       	push   $0x803ce7
+  800ca4:	6a 3d                	push   $0x3d
+  800ca6:	68 04 3d 80 00       	push   $0x803d04
+  800cab:	e8 e0 f4 ff ff       	call   800190 <_panic>
+
+00800cb0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cb0:	55                   	push   %ebp
+  800cb1:	89 e5                	mov    %esp,%ebp
+  800cb3:	57                   	push   %edi
+  800cb4:	56                   	push   %esi
+  800cb5:	53                   	push   %ebx
+  800cb6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbf:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cc7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cca:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ccd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ccf:	85 c0                	test   %eax,%eax
+  800cd1:	7f 08                	jg     800cdb <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd6:	5b                   	pop    %ebx
+  800cd7:	5e                   	pop    %esi
+  800cd8:	5f                   	pop    %edi
+  800cd9:	5d                   	pop    %ebp
+  800cda:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cdb:	83 ec 0c             	sub    $0xc,%esp
+  800cde:	50                   	push   %eax
+  800cdf:	6a 05                	push   $0x5
+  800ce1:	68 e7 3c 80 00       	push   $0x803ce7
+  800ce6:	6a 23                	push   $0x23
+  800ce8:	68 04 3d 80 00       	push   $0x803d04
+  800ced:	e8 9e f4 ff ff       	call   800190 <_panic>
+
+00800cf2 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cf2:	55                   	push   %ebp
+  800cf3:	89 e5                	mov    %esp,%ebp
+  800cf5:	57                   	push   %edi
+  800cf6:	56                   	push   %esi
+  800cf7:	53                   	push   %ebx
+  800cf8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d06:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d0b:	89 df                	mov    %ebx,%edi
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	8d 35 18 0d 80 00    	lea    0x800d18,%esi
+  800d16:	0f 34                	sysenter
+  800d18:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d19:	85 c0                	test   %eax,%eax
+  800d1b:	7f 08                	jg     800d25 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800d1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d20:	5b                   	pop    %ebx
+  800d21:	5e                   	pop    %esi
+  800d22:	5f                   	pop    %edi
+  800d23:	5d                   	pop    %ebp
+  800d24:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d25:	83 ec 0c             	sub    $0xc,%esp
+  800d28:	50                   	push   %eax
+  800d29:	6a 06                	push   $0x6
+  800d2b:	68 e7 3c 80 00       	push   $0x803ce7
+  800d30:	6a 3d                	push   $0x3d
+  800d32:	68 04 3d 80 00       	push   $0x803d04
+  800d37:	e8 54 f4 ff ff       	call   800190 <_panic>
+
+00800d3c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d3c:	55                   	push   %ebp
+  800d3d:	89 e5                	mov    %esp,%ebp
+  800d3f:	57                   	push   %edi
+  800d40:	56                   	push   %esi
+  800d41:	53                   	push   %ebx
+  800d42:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d50:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d55:	89 df                	mov    %ebx,%edi
+  800d57:	55                   	push   %ebp
+  800d58:	89 e5                	mov    %esp,%ebp
+  800d5a:	8d 35 62 0d 80 00    	lea    0x800d62,%esi
+  800d60:	0f 34                	sysenter
+  800d62:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d63:	85 c0                	test   %eax,%eax
+  800d65:	7f 08                	jg     800d6f <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800d67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6a:	5b                   	pop    %ebx
+  800d6b:	5e                   	pop    %esi
+  800d6c:	5f                   	pop    %edi
+  800d6d:	5d                   	pop    %ebp
+  800d6e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d6f:	83 ec 0c             	sub    $0xc,%esp
+  800d72:	50                   	push   %eax
+  800d73:	6a 08                	push   $0x8
+  800d75:	68 e7 3c 80 00       	push   $0x803ce7
+  800d7a:	6a 3d                	push   $0x3d
+  800d7c:	68 04 3d 80 00       	push   $0x803d04
+  800d81:	e8 0a f4 ff ff       	call   800190 <_panic>
+
+00800d86 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	57                   	push   %edi
+  800d8a:	56                   	push   %esi
+  800d8b:	53                   	push   %ebx
+  800d8c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9a:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d9f:	89 df                	mov    %ebx,%edi
+  800da1:	55                   	push   %ebp
+  800da2:	89 e5                	mov    %esp,%ebp
+  800da4:	8d 35 ac 0d 80 00    	lea    0x800dac,%esi
+  800daa:	0f 34                	sysenter
+  800dac:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800dad:	85 c0                	test   %eax,%eax
+  800daf:	7f 08                	jg     800db9 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800db1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db4:	5b                   	pop    %ebx
+  800db5:	5e                   	pop    %esi
+  800db6:	5f                   	pop    %edi
+  800db7:	5d                   	pop    %ebp
+  800db8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db9:	83 ec 0c             	sub    $0xc,%esp
+  800dbc:	50                   	push   %eax
+  800dbd:	6a 09                	push   $0x9
+  800dbf:	68 e7 3c 80 00       	push   $0x803ce7
+  800dc4:	6a 3d                	push   $0x3d
+  800dc6:	68 04 3d 80 00       	push   $0x803d04
+  800dcb:	e8 c0 f3 ff ff       	call   800190 <_panic>
+
+00800dd0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800dd0:	55                   	push   %ebp
+  800dd1:	89 e5                	mov    %esp,%ebp
+  800dd3:	57                   	push   %edi
+  800dd4:	56                   	push   %esi
+  800dd5:	53                   	push   %ebx
+  800dd6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800dd9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800de9:	89 df                	mov    %ebx,%edi
+  800deb:	55                   	push   %ebp
+  800dec:	89 e5                	mov    %esp,%ebp
+  800dee:	8d 35 f6 0d 80 00    	lea    0x800df6,%esi
+  800df4:	0f 34                	sysenter
+  800df6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800df7:	85 c0                	test   %eax,%eax
+  800df9:	7f 08                	jg     800e03 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800dfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dfe:	5b                   	pop    %ebx
+  800dff:	5e                   	pop    %esi
+  800e00:	5f                   	pop    %edi
+  800e01:	5d                   	pop    %ebp
+  800e02:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e03:	83 ec 0c             	sub    $0xc,%esp
+  800e06:	50                   	push   %eax
+  800e07:	6a 0a                	push   $0xa
+  800e09:	68 e7 3c 80 00       	push   $0x803ce7
+  800e0e:	6a 3d                	push   $0x3d
+  800e10:	68 04 3d 80 00       	push   $0x803d04
+  800e15:	e8 76 f3 ff ff       	call   800190 <_panic>
+
+00800e1a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e1a:	55                   	push   %ebp
+  800e1b:	89 e5                	mov    %esp,%ebp
+  800e1d:	57                   	push   %edi
+  800e1e:	56                   	push   %esi
+  800e1f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e26:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e2e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	8d 35 3c 0e 80 00    	lea    0x800e3c,%esi
+  800e3a:	0f 34                	sysenter
+  800e3c:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800e3d:	5b                   	pop    %ebx
+  800e3e:	5e                   	pop    %esi
+  800e3f:	5f                   	pop    %edi
+  800e40:	5d                   	pop    %ebp
+  800e41:	c3                   	ret
+
+00800e42 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	57                   	push   %edi
+  800e46:	56                   	push   %esi
+  800e47:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4e:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e56:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e59:	55                   	push   %ebp
+  800e5a:	89 e5                	mov    %esp,%ebp
+  800e5c:	8d 35 64 0e 80 00    	lea    0x800e64,%esi
+  800e62:	0f 34                	sysenter
+  800e64:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800e65:	5b                   	pop    %ebx
+  800e66:	5e                   	pop    %esi
+  800e67:	5f                   	pop    %edi
+  800e68:	5d                   	pop    %ebp
+  800e69:	c3                   	ret
+
+00800e6a <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	57                   	push   %edi
+  800e6e:	56                   	push   %esi
+  800e6f:	53                   	push   %ebx
+  800e70:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e73:	be 00 00 00 00       	mov    $0x0,%esi
+  800e78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e83:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e86:	89 f7                	mov    %esi,%edi
+  800e88:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e8a:	85 c0                	test   %eax,%eax
+  800e8c:	7f 08                	jg     800e96 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800e8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e91:	5b                   	pop    %ebx
+  800e92:	5e                   	pop    %esi
+  800e93:	5f                   	pop    %edi
+  800e94:	5d                   	pop    %ebp
+  800e95:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e96:	83 ec 0c             	sub    $0xc,%esp
+  800e99:	50                   	push   %eax
+  800e9a:	6a 0d                	push   $0xd
+  800e9c:	68 e7 3c 80 00       	push   $0x803ce7
+  800ea1:	6a 23                	push   $0x23
+  800ea3:	68 04 3d 80 00       	push   $0x803d04
+  800ea8:	e8 e3 f2 ff ff       	call   800190 <_panic>
+
+00800ead <sys_ipc_recv>:
+{
+  800ead:	55                   	push   %ebp
+  800eae:	89 e5                	mov    %esp,%ebp
+  800eb0:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800eb3:	6a 00                	push   $0x0
+  800eb5:	6a 01                	push   $0x1
+  800eb7:	ff 75 08             	push   0x8(%ebp)
+  800eba:	e8 ab ff ff ff       	call   800e6a <sys_ipc_recvv>
+}
+  800ebf:	c9                   	leave
+  800ec0:	c3                   	ret
+
+00800ec1 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800ec1:	55                   	push   %ebp
+  800ec2:	89 e5                	mov    %esp,%ebp
+  800ec4:	57                   	push   %edi
+  800ec5:	56                   	push   %esi
+  800ec6:	53                   	push   %ebx
+  800ec7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ecf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eda:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800edd:	89 de                	mov    %ebx,%esi
+  800edf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee1:	85 c0                	test   %eax,%eax
+  800ee3:	7f 08                	jg     800eed <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800ee5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee8:	5b                   	pop    %ebx
+  800ee9:	5e                   	pop    %esi
+  800eea:	5f                   	pop    %edi
+  800eeb:	5d                   	pop    %ebp
+  800eec:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eed:	83 ec 0c             	sub    $0xc,%esp
+  800ef0:	50                   	push   %eax
+  800ef1:	6a 0d                	push   $0xd
+  800ef3:	68 e7 3c 80 00       	push   $0x803ce7
+  800ef8:	6a 23                	push   $0x23
+  800efa:	68 04 3d 80 00       	push   $0x803d04
+  800eff:	e8 8c f2 ff ff       	call   800190 <_panic>
+
+00800f04 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f04:	55                   	push   %ebp
+  800f05:	89 e5                	mov    %esp,%ebp
+  800f07:	57                   	push   %edi
+  800f08:	56                   	push   %esi
+  800f09:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f0f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f14:	89 d1                	mov    %edx,%ecx
+  800f16:	89 d3                	mov    %edx,%ebx
+  800f18:	89 d7                	mov    %edx,%edi
+  800f1a:	55                   	push   %ebp
+  800f1b:	89 e5                	mov    %esp,%ebp
+  800f1d:	8d 35 25 0f 80 00    	lea    0x800f25,%esi
+  800f23:	0f 34                	sysenter
+  800f25:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800f26:	5b                   	pop    %ebx
+  800f27:	5e                   	pop    %esi
+  800f28:	5f                   	pop    %edi
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+
+00800f2b <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	57                   	push   %edi
+  800f2f:	56                   	push   %esi
+  800f30:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f41:	89 df                	mov    %ebx,%edi
+  800f43:	55                   	push   %ebp
+  800f44:	89 e5                	mov    %esp,%ebp
+  800f46:	8d 35 4e 0f 80 00    	lea    0x800f4e,%esi
+  800f4c:	0f 34                	sysenter
+  800f4e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800f4f:	5b                   	pop    %ebx
+  800f50:	5e                   	pop    %esi
+  800f51:	5f                   	pop    %edi
+  800f52:	5d                   	pop    %ebp
+  800f53:	c3                   	ret
+
+00800f54 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800f54:	55                   	push   %ebp
+  800f55:	89 e5                	mov    %esp,%ebp
+  800f57:	57                   	push   %edi
+  800f58:	56                   	push   %esi
+  800f59:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f62:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f67:	89 cb                	mov    %ecx,%ebx
+  800f69:	89 cf                	mov    %ecx,%edi
+  800f6b:	55                   	push   %ebp
+  800f6c:	89 e5                	mov    %esp,%ebp
+  800f6e:	8d 35 76 0f 80 00    	lea    0x800f76,%esi
+  800f74:	0f 34                	sysenter
+  800f76:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800f77:	5b                   	pop    %ebx
+  800f78:	5e                   	pop    %esi
+  800f79:	5f                   	pop    %edi
+  800f7a:	5d                   	pop    %ebp
+  800f7b:	c3                   	ret
+
+00800f7c <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	57                   	push   %edi
+  800f80:	56                   	push   %esi
+  800f81:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8d:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f92:	89 df                	mov    %ebx,%edi
+  800f94:	55                   	push   %ebp
+  800f95:	89 e5                	mov    %esp,%ebp
+  800f97:	8d 35 9f 0f 80 00    	lea    0x800f9f,%esi
+  800f9d:	0f 34                	sysenter
+  800f9f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800fa0:	5b                   	pop    %ebx
+  800fa1:	5e                   	pop    %esi
+  800fa2:	5f                   	pop    %edi
+  800fa3:	5d                   	pop    %ebp
+  800fa4:	c3                   	ret
+
+00800fa5 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800fa5:	55                   	push   %ebp
+  800fa6:	89 e5                	mov    %esp,%ebp
+  800fa8:	57                   	push   %edi
+  800fa9:	56                   	push   %esi
+  800faa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb6:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fbb:	89 df                	mov    %ebx,%edi
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	8d 35 c8 0f 80 00    	lea    0x800fc8,%esi
+  800fc6:	0f 34                	sysenter
+  800fc8:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800fc9:	5b                   	pop    %ebx
+  800fca:	5e                   	pop    %esi
+  800fcb:	5f                   	pop    %edi
+  800fcc:	5d                   	pop    %ebp
+  800fcd:	c3                   	ret
+
+00800fce <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	57                   	push   %edi
+  800fd2:	56                   	push   %esi
+  800fd3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fda:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fdf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fe5:	55                   	push   %ebp
+  800fe6:	89 e5                	mov    %esp,%ebp
+  800fe8:	8d 35 f0 0f 80 00    	lea    0x800ff0,%esi
+  800fee:	0f 34                	sysenter
+  800ff0:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800ff1:	5b                   	pop    %ebx
+  800ff2:	5e                   	pop    %esi
+  800ff3:	5f                   	pop    %edi
+  800ff4:	5d                   	pop    %ebp
+  800ff5:	c3                   	ret
+
+00800ff6 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	57                   	push   %edi
+  800ffa:	56                   	push   %esi
+  800ffb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ffc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801001:	8b 55 08             	mov    0x8(%ebp),%edx
+  801004:	b8 11 00 00 00       	mov    $0x11,%eax
+  801009:	89 cb                	mov    %ecx,%ebx
+  80100b:	89 cf                	mov    %ecx,%edi
+  80100d:	89 ce                	mov    %ecx,%esi
+  80100f:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  801011:	5b                   	pop    %ebx
+  801012:	5e                   	pop    %esi
+  801013:	5f                   	pop    %edi
+  801014:	5d                   	pop    %ebp
+  801015:	c3                   	ret
+
+00801016 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  801016:	55                   	push   %ebp
+  801017:	89 e5                	mov    %esp,%ebp
+  801019:	57                   	push   %edi
+  80101a:	56                   	push   %esi
+  80101b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80101c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801021:	8b 55 08             	mov    0x8(%ebp),%edx
+  801024:	b8 15 00 00 00       	mov    $0x15,%eax
+  801029:	89 cb                	mov    %ecx,%ebx
+  80102b:	89 cf                	mov    %ecx,%edi
+  80102d:	55                   	push   %ebp
+  80102e:	89 e5                	mov    %esp,%ebp
+  801030:	8d 35 38 10 80 00    	lea    0x801038,%esi
+  801036:	0f 34                	sysenter
+  801038:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  801039:	5b                   	pop    %ebx
+  80103a:	5e                   	pop    %esi
+  80103b:	5f                   	pop    %edi
+  80103c:	5d                   	pop    %ebp
+  80103d:	c3                   	ret
+
+0080103e <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  80103e:	55                   	push   %ebp
+  80103f:	89 e5                	mov    %esp,%ebp
+  801041:	57                   	push   %edi
+  801042:	56                   	push   %esi
+  801043:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801044:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801049:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801051:	89 cb                	mov    %ecx,%ebx
+  801053:	89 cf                	mov    %ecx,%edi
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	8d 35 60 10 80 00    	lea    0x801060,%esi
+  80105e:	0f 34                	sysenter
+  801060:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  801061:	5b                   	pop    %ebx
+  801062:	5e                   	pop    %esi
+  801063:	5f                   	pop    %edi
+  801064:	5d                   	pop    %ebp
+  801065:	c3                   	ret
+
+00801066 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801066:	55                   	push   %ebp
+  801067:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801069:	8b 45 08             	mov    0x8(%ebp),%eax
+  80106c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801071:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801074:	5d                   	pop    %ebp
+  801075:	c3                   	ret
+
+00801076 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801076:	55                   	push   %ebp
+  801077:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801079:	8b 45 08             	mov    0x8(%ebp),%eax
+  80107c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801081:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801086:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80108b:	5d                   	pop    %ebp
+  80108c:	c3                   	ret
+
+0080108d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80108d:	55                   	push   %ebp
+  80108e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801090:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801095:	eb 02                	jmp    801099 <fd_alloc+0xc>
+  801097:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801099:	89 c2                	mov    %eax,%edx
+  80109b:	c1 ea 16             	shr    $0x16,%edx
+  80109e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8010a5:	f6 c2 01             	test   $0x1,%dl
+  8010a8:	74 2b                	je     8010d5 <fd_alloc+0x48>
+  8010aa:	89 c2                	mov    %eax,%edx
+  8010ac:	c1 ea 0c             	shr    $0xc,%edx
+  8010af:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8010b6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8010bc:	f6 c1 01             	test   $0x1,%cl
+  8010bf:	74 14                	je     8010d5 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8010c1:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8010c7:	75 ce                	jne    801097 <fd_alloc+0xa>
+  8010c9:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8010ce:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8010d3:	eb 05                	jmp    8010da <fd_alloc+0x4d>
+			return 0;
+  8010d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8010da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010dd:	89 02                	mov    %eax,(%edx)
+}
+  8010df:	89 c8                	mov    %ecx,%eax
+  8010e1:	5d                   	pop    %ebp
+  8010e2:	c3                   	ret
+
+008010e3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8010e9:	83 f8 1f             	cmp    $0x1f,%eax
+  8010ec:	77 30                	ja     80111e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8010ee:	c1 e0 0c             	shl    $0xc,%eax
+  8010f1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8010f6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8010fc:	f6 c2 01             	test   $0x1,%dl
+  8010ff:	74 24                	je     801125 <fd_lookup+0x42>
+  801101:	89 c2                	mov    %eax,%edx
+  801103:	c1 ea 0c             	shr    $0xc,%edx
+  801106:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80110d:	f6 c2 01             	test   $0x1,%dl
+  801110:	74 1a                	je     80112c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801112:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801115:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801117:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80111c:	5d                   	pop    %ebp
+  80111d:	c3                   	ret
+		return -E_INVAL;
+  80111e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801123:	eb f7                	jmp    80111c <fd_lookup+0x39>
+		return -E_INVAL;
+  801125:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80112a:	eb f0                	jmp    80111c <fd_lookup+0x39>
+  80112c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801131:	eb e9                	jmp    80111c <fd_lookup+0x39>
+
+00801133 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801133:	55                   	push   %ebp
+  801134:	89 e5                	mov    %esp,%ebp
+  801136:	53                   	push   %ebx
+  801137:	83 ec 04             	sub    $0x4,%esp
+  80113a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80113d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801142:	eb 03                	jmp    801147 <dev_lookup+0x14>
+  801144:	83 c0 01             	add    $0x1,%eax
+  801147:	8b 1c 85 90 3d 80 00 	mov    0x803d90(,%eax,4),%ebx
+  80114e:	85 db                	test   %ebx,%ebx
+  801150:	74 0b                	je     80115d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801152:	39 13                	cmp    %edx,(%ebx)
+  801154:	75 ee                	jne    801144 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80115b:	eb 1f                	jmp    80117c <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80115d:	a1 00 70 80 00       	mov    0x807000,%eax
+  801162:	8b 40 48             	mov    0x48(%eax),%eax
+  801165:	83 ec 04             	sub    $0x4,%esp
+  801168:	52                   	push   %edx
+  801169:	50                   	push   %eax
+  80116a:	68 14 3d 80 00       	push   $0x803d14
+  80116f:	e8 f7 f0 ff ff       	call   80026b <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801174:	83 c4 10             	add    $0x10,%esp
+  801177:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80117c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80117f:	89 1a                	mov    %ebx,(%edx)
+}
+  801181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801184:	c9                   	leave
+  801185:	c3                   	ret
+
+00801186 <fd_close>:
+{
+  801186:	55                   	push   %ebp
+  801187:	89 e5                	mov    %esp,%ebp
+  801189:	57                   	push   %edi
+  80118a:	56                   	push   %esi
+  80118b:	53                   	push   %ebx
+  80118c:	83 ec 24             	sub    $0x24,%esp
+  80118f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801192:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801195:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801198:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801199:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80119f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011a2:	50                   	push   %eax
+  8011a3:	e8 3b ff ff ff       	call   8010e3 <fd_lookup>
+  8011a8:	89 c3                	mov    %eax,%ebx
+  8011aa:	83 c4 10             	add    $0x10,%esp
+  8011ad:	85 c0                	test   %eax,%eax
+  8011af:	78 05                	js     8011b6 <fd_close+0x30>
+	    || fd != fd2)
+  8011b1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011b4:	74 16                	je     8011cc <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8011b6:	89 f8                	mov    %edi,%eax
+  8011b8:	84 c0                	test   %al,%al
+  8011ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011bf:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8011c2:	89 d8                	mov    %ebx,%eax
+  8011c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c7:	5b                   	pop    %ebx
+  8011c8:	5e                   	pop    %esi
+  8011c9:	5f                   	pop    %edi
+  8011ca:	5d                   	pop    %ebp
+  8011cb:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8011cc:	83 ec 08             	sub    $0x8,%esp
+  8011cf:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8011d2:	50                   	push   %eax
+  8011d3:	ff 36                	push   (%esi)
+  8011d5:	e8 59 ff ff ff       	call   801133 <dev_lookup>
+  8011da:	89 c3                	mov    %eax,%ebx
+  8011dc:	83 c4 10             	add    $0x10,%esp
+  8011df:	85 c0                	test   %eax,%eax
+  8011e1:	78 1a                	js     8011fd <fd_close+0x77>
+		if (dev->dev_close)
+  8011e3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8011e6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8011e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8011ee:	85 c0                	test   %eax,%eax
+  8011f0:	74 0b                	je     8011fd <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8011f2:	83 ec 0c             	sub    $0xc,%esp
+  8011f5:	56                   	push   %esi
+  8011f6:	ff d0                	call   *%eax
+  8011f8:	89 c3                	mov    %eax,%ebx
+  8011fa:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8011fd:	83 ec 08             	sub    $0x8,%esp
+  801200:	56                   	push   %esi
+  801201:	6a 00                	push   $0x0
+  801203:	e8 ea fa ff ff       	call   800cf2 <sys_page_unmap>
+	return r;
+  801208:	83 c4 10             	add    $0x10,%esp
+  80120b:	eb b5                	jmp    8011c2 <fd_close+0x3c>
+
+0080120d <close>:
+
+int
+close(int fdnum)
+{
+  80120d:	55                   	push   %ebp
+  80120e:	89 e5                	mov    %esp,%ebp
+  801210:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801213:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801216:	50                   	push   %eax
+  801217:	ff 75 08             	push   0x8(%ebp)
+  80121a:	e8 c4 fe ff ff       	call   8010e3 <fd_lookup>
+  80121f:	83 c4 10             	add    $0x10,%esp
+  801222:	85 c0                	test   %eax,%eax
+  801224:	79 02                	jns    801228 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801226:	c9                   	leave
+  801227:	c3                   	ret
+		return fd_close(fd, 1);
+  801228:	83 ec 08             	sub    $0x8,%esp
+  80122b:	6a 01                	push   $0x1
+  80122d:	ff 75 f4             	push   -0xc(%ebp)
+  801230:	e8 51 ff ff ff       	call   801186 <fd_close>
+  801235:	83 c4 10             	add    $0x10,%esp
+  801238:	eb ec                	jmp    801226 <close+0x19>
+
+0080123a <close_all>:
+
+void
+close_all(void)
+{
+  80123a:	55                   	push   %ebp
+  80123b:	89 e5                	mov    %esp,%ebp
+  80123d:	53                   	push   %ebx
+  80123e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801241:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801246:	83 ec 0c             	sub    $0xc,%esp
+  801249:	53                   	push   %ebx
+  80124a:	e8 be ff ff ff       	call   80120d <close>
+	for (i = 0; i < MAXFD; i++)
+  80124f:	83 c3 01             	add    $0x1,%ebx
+  801252:	83 c4 10             	add    $0x10,%esp
+  801255:	83 fb 20             	cmp    $0x20,%ebx
+  801258:	75 ec                	jne    801246 <close_all+0xc>
+}
+  80125a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80125d:	c9                   	leave
+  80125e:	c3                   	ret
+
+0080125f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80125f:	55                   	push   %ebp
+  801260:	89 e5                	mov    %esp,%ebp
+  801262:	57                   	push   %edi
+  801263:	56                   	push   %esi
+  801264:	53                   	push   %ebx
+  801265:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801268:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80126b:	50                   	push   %eax
+  80126c:	ff 75 08             	push   0x8(%ebp)
+  80126f:	e8 6f fe ff ff       	call   8010e3 <fd_lookup>
+  801274:	89 c3                	mov    %eax,%ebx
+  801276:	83 c4 10             	add    $0x10,%esp
+  801279:	85 c0                	test   %eax,%eax
+  80127b:	78 7f                	js     8012fc <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80127d:	83 ec 0c             	sub    $0xc,%esp
+  801280:	ff 75 0c             	push   0xc(%ebp)
+  801283:	e8 85 ff ff ff       	call   80120d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801288:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80128b:	c1 e6 0c             	shl    $0xc,%esi
+  80128e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801294:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801297:	89 3c 24             	mov    %edi,(%esp)
+  80129a:	e8 d7 fd ff ff       	call   801076 <fd2data>
+  80129f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8012a1:	89 34 24             	mov    %esi,(%esp)
+  8012a4:	e8 cd fd ff ff       	call   801076 <fd2data>
+  8012a9:	83 c4 10             	add    $0x10,%esp
+  8012ac:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8012af:	89 d8                	mov    %ebx,%eax
+  8012b1:	c1 e8 16             	shr    $0x16,%eax
+  8012b4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012bb:	a8 01                	test   $0x1,%al
+  8012bd:	74 11                	je     8012d0 <dup+0x71>
+  8012bf:	89 d8                	mov    %ebx,%eax
+  8012c1:	c1 e8 0c             	shr    $0xc,%eax
+  8012c4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012cb:	f6 c2 01             	test   $0x1,%dl
+  8012ce:	75 36                	jne    801306 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8012d0:	89 f8                	mov    %edi,%eax
+  8012d2:	c1 e8 0c             	shr    $0xc,%eax
+  8012d5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012dc:	83 ec 0c             	sub    $0xc,%esp
+  8012df:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012e4:	50                   	push   %eax
+  8012e5:	56                   	push   %esi
+  8012e6:	6a 00                	push   $0x0
+  8012e8:	57                   	push   %edi
+  8012e9:	6a 00                	push   $0x0
+  8012eb:	e8 c0 f9 ff ff       	call   800cb0 <sys_page_map>
+  8012f0:	89 c3                	mov    %eax,%ebx
+  8012f2:	83 c4 20             	add    $0x20,%esp
+  8012f5:	85 c0                	test   %eax,%eax
+  8012f7:	78 33                	js     80132c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8012f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8012fc:	89 d8                	mov    %ebx,%eax
+  8012fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801301:	5b                   	pop    %ebx
+  801302:	5e                   	pop    %esi
+  801303:	5f                   	pop    %edi
+  801304:	5d                   	pop    %ebp
+  801305:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801306:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80130d:	83 ec 0c             	sub    $0xc,%esp
+  801310:	25 07 0e 00 00       	and    $0xe07,%eax
+  801315:	50                   	push   %eax
+  801316:	ff 75 d4             	push   -0x2c(%ebp)
+  801319:	6a 00                	push   $0x0
+  80131b:	53                   	push   %ebx
+  80131c:	6a 00                	push   $0x0
+  80131e:	e8 8d f9 ff ff       	call   800cb0 <sys_page_map>
+  801323:	89 c3                	mov    %eax,%ebx
+  801325:	83 c4 20             	add    $0x20,%esp
+  801328:	85 c0                	test   %eax,%eax
+  80132a:	79 a4                	jns    8012d0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80132c:	83 ec 08             	sub    $0x8,%esp
+  80132f:	56                   	push   %esi
+  801330:	6a 00                	push   $0x0
+  801332:	e8 bb f9 ff ff       	call   800cf2 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801337:	83 c4 08             	add    $0x8,%esp
+  80133a:	ff 75 d4             	push   -0x2c(%ebp)
+  80133d:	6a 00                	push   $0x0
+  80133f:	e8 ae f9 ff ff       	call   800cf2 <sys_page_unmap>
+	return r;
+  801344:	83 c4 10             	add    $0x10,%esp
+  801347:	eb b3                	jmp    8012fc <dup+0x9d>
+
+00801349 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801349:	55                   	push   %ebp
+  80134a:	89 e5                	mov    %esp,%ebp
+  80134c:	56                   	push   %esi
+  80134d:	53                   	push   %ebx
+  80134e:	83 ec 18             	sub    $0x18,%esp
+  801351:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801354:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801357:	50                   	push   %eax
+  801358:	56                   	push   %esi
+  801359:	e8 85 fd ff ff       	call   8010e3 <fd_lookup>
+  80135e:	83 c4 10             	add    $0x10,%esp
+  801361:	85 c0                	test   %eax,%eax
+  801363:	78 3c                	js     8013a1 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801365:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801368:	83 ec 08             	sub    $0x8,%esp
+  80136b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80136e:	50                   	push   %eax
+  80136f:	ff 33                	push   (%ebx)
+  801371:	e8 bd fd ff ff       	call   801133 <dev_lookup>
+  801376:	83 c4 10             	add    $0x10,%esp
+  801379:	85 c0                	test   %eax,%eax
+  80137b:	78 24                	js     8013a1 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80137d:	8b 43 08             	mov    0x8(%ebx),%eax
+  801380:	83 e0 03             	and    $0x3,%eax
+  801383:	83 f8 01             	cmp    $0x1,%eax
+  801386:	74 20                	je     8013a8 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801388:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80138b:	8b 40 08             	mov    0x8(%eax),%eax
+  80138e:	85 c0                	test   %eax,%eax
+  801390:	74 37                	je     8013c9 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801392:	83 ec 04             	sub    $0x4,%esp
+  801395:	ff 75 10             	push   0x10(%ebp)
+  801398:	ff 75 0c             	push   0xc(%ebp)
+  80139b:	53                   	push   %ebx
+  80139c:	ff d0                	call   *%eax
+  80139e:	83 c4 10             	add    $0x10,%esp
+}
+  8013a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013a4:	5b                   	pop    %ebx
+  8013a5:	5e                   	pop    %esi
+  8013a6:	5d                   	pop    %ebp
+  8013a7:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013a8:	a1 00 70 80 00       	mov    0x807000,%eax
+  8013ad:	8b 40 48             	mov    0x48(%eax),%eax
+  8013b0:	83 ec 04             	sub    $0x4,%esp
+  8013b3:	56                   	push   %esi
+  8013b4:	50                   	push   %eax
+  8013b5:	68 55 3d 80 00       	push   $0x803d55
+  8013ba:	e8 ac ee ff ff       	call   80026b <cprintf>
+		return -E_INVAL;
+  8013bf:	83 c4 10             	add    $0x10,%esp
+  8013c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013c7:	eb d8                	jmp    8013a1 <read+0x58>
+		return -E_NOT_SUPP;
+  8013c9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013ce:	eb d1                	jmp    8013a1 <read+0x58>
+
+008013d0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8013d0:	55                   	push   %ebp
+  8013d1:	89 e5                	mov    %esp,%ebp
+  8013d3:	57                   	push   %edi
+  8013d4:	56                   	push   %esi
+  8013d5:	53                   	push   %ebx
+  8013d6:	83 ec 0c             	sub    $0xc,%esp
+  8013d9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013dc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8013df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e4:	eb 02                	jmp    8013e8 <readn+0x18>
+  8013e6:	01 c3                	add    %eax,%ebx
+  8013e8:	39 f3                	cmp    %esi,%ebx
+  8013ea:	73 21                	jae    80140d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8013ec:	83 ec 04             	sub    $0x4,%esp
+  8013ef:	89 f0                	mov    %esi,%eax
+  8013f1:	29 d8                	sub    %ebx,%eax
+  8013f3:	50                   	push   %eax
+  8013f4:	89 d8                	mov    %ebx,%eax
+  8013f6:	03 45 0c             	add    0xc(%ebp),%eax
+  8013f9:	50                   	push   %eax
+  8013fa:	57                   	push   %edi
+  8013fb:	e8 49 ff ff ff       	call   801349 <read>
+		if (m < 0)
+  801400:	83 c4 10             	add    $0x10,%esp
+  801403:	85 c0                	test   %eax,%eax
+  801405:	78 04                	js     80140b <readn+0x3b>
+			return m;
+		if (m == 0)
+  801407:	75 dd                	jne    8013e6 <readn+0x16>
+  801409:	eb 02                	jmp    80140d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80140b:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80140d:	89 d8                	mov    %ebx,%eax
+  80140f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801412:	5b                   	pop    %ebx
+  801413:	5e                   	pop    %esi
+  801414:	5f                   	pop    %edi
+  801415:	5d                   	pop    %ebp
+  801416:	c3                   	ret
+
+00801417 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801417:	55                   	push   %ebp
+  801418:	89 e5                	mov    %esp,%ebp
+  80141a:	56                   	push   %esi
+  80141b:	53                   	push   %ebx
+  80141c:	83 ec 18             	sub    $0x18,%esp
+  80141f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801422:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801425:	50                   	push   %eax
+  801426:	53                   	push   %ebx
+  801427:	e8 b7 fc ff ff       	call   8010e3 <fd_lookup>
+  80142c:	83 c4 10             	add    $0x10,%esp
+  80142f:	85 c0                	test   %eax,%eax
+  801431:	78 37                	js     80146a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801433:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801436:	83 ec 08             	sub    $0x8,%esp
+  801439:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80143c:	50                   	push   %eax
+  80143d:	ff 36                	push   (%esi)
+  80143f:	e8 ef fc ff ff       	call   801133 <dev_lookup>
+  801444:	83 c4 10             	add    $0x10,%esp
+  801447:	85 c0                	test   %eax,%eax
+  801449:	78 1f                	js     80146a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80144b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80144f:	74 20                	je     801471 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801451:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801454:	8b 40 0c             	mov    0xc(%eax),%eax
+  801457:	85 c0                	test   %eax,%eax
+  801459:	74 37                	je     801492 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80145b:	83 ec 04             	sub    $0x4,%esp
+  80145e:	ff 75 10             	push   0x10(%ebp)
+  801461:	ff 75 0c             	push   0xc(%ebp)
+  801464:	56                   	push   %esi
+  801465:	ff d0                	call   *%eax
+  801467:	83 c4 10             	add    $0x10,%esp
+}
+  80146a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80146d:	5b                   	pop    %ebx
+  80146e:	5e                   	pop    %esi
+  80146f:	5d                   	pop    %ebp
+  801470:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801471:	a1 00 70 80 00       	mov    0x807000,%eax
+  801476:	8b 40 48             	mov    0x48(%eax),%eax
+  801479:	83 ec 04             	sub    $0x4,%esp
+  80147c:	53                   	push   %ebx
+  80147d:	50                   	push   %eax
+  80147e:	68 71 3d 80 00       	push   $0x803d71
+  801483:	e8 e3 ed ff ff       	call   80026b <cprintf>
+		return -E_INVAL;
+  801488:	83 c4 10             	add    $0x10,%esp
+  80148b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801490:	eb d8                	jmp    80146a <write+0x53>
+		return -E_NOT_SUPP;
+  801492:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801497:	eb d1                	jmp    80146a <write+0x53>
+
+00801499 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801499:	55                   	push   %ebp
+  80149a:	89 e5                	mov    %esp,%ebp
+  80149c:	53                   	push   %ebx
+  80149d:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014a0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014a3:	50                   	push   %eax
+  8014a4:	ff 75 08             	push   0x8(%ebp)
+  8014a7:	e8 37 fc ff ff       	call   8010e3 <fd_lookup>
+  8014ac:	83 c4 10             	add    $0x10,%esp
+  8014af:	85 c0                	test   %eax,%eax
+  8014b1:	78 3a                	js     8014ed <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014b3:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014b6:	83 ec 08             	sub    $0x8,%esp
+  8014b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014bc:	50                   	push   %eax
+  8014bd:	ff 33                	push   (%ebx)
+  8014bf:	e8 6f fc ff ff       	call   801133 <dev_lookup>
+  8014c4:	83 c4 10             	add    $0x10,%esp
+  8014c7:	85 c0                	test   %eax,%eax
+  8014c9:	78 22                	js     8014ed <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8014cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014ce:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8014d1:	85 c0                	test   %eax,%eax
+  8014d3:	74 0d                	je     8014e2 <seek+0x49>
+  8014d5:	83 ec 0c             	sub    $0xc,%esp
+  8014d8:	53                   	push   %ebx
+  8014d9:	ff d0                	call   *%eax
+  8014db:	83 c4 10             	add    $0x10,%esp
+  8014de:	85 c0                	test   %eax,%eax
+  8014e0:	78 0b                	js     8014ed <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8014e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014e5:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8014e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014f0:	c9                   	leave
+  8014f1:	c3                   	ret
+
+008014f2 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8014f2:	55                   	push   %ebp
+  8014f3:	89 e5                	mov    %esp,%ebp
+  8014f5:	53                   	push   %ebx
+  8014f6:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014f9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014fc:	50                   	push   %eax
+  8014fd:	ff 75 08             	push   0x8(%ebp)
+  801500:	e8 de fb ff ff       	call   8010e3 <fd_lookup>
+  801505:	83 c4 10             	add    $0x10,%esp
+  801508:	85 c0                	test   %eax,%eax
+  80150a:	78 2b                	js     801537 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80150c:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80150f:	83 ec 08             	sub    $0x8,%esp
+  801512:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801515:	50                   	push   %eax
+  801516:	ff 33                	push   (%ebx)
+  801518:	e8 16 fc ff ff       	call   801133 <dev_lookup>
+  80151d:	83 c4 10             	add    $0x10,%esp
+  801520:	85 c0                	test   %eax,%eax
+  801522:	78 13                	js     801537 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801524:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801527:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80152a:	85 c0                	test   %eax,%eax
+  80152c:	74 0e                	je     80153c <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  80152e:	83 ec 0c             	sub    $0xc,%esp
+  801531:	53                   	push   %ebx
+  801532:	ff d0                	call   *%eax
+  801534:	83 c4 10             	add    $0x10,%esp
+}
+  801537:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80153a:	c9                   	leave
+  80153b:	c3                   	ret
+		return 0;
+  80153c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801541:	eb f4                	jmp    801537 <fsync+0x45>
+
+00801543 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801543:	55                   	push   %ebp
+  801544:	89 e5                	mov    %esp,%ebp
+  801546:	56                   	push   %esi
+  801547:	53                   	push   %ebx
+  801548:	83 ec 18             	sub    $0x18,%esp
+  80154b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80154e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801551:	50                   	push   %eax
+  801552:	53                   	push   %ebx
+  801553:	e8 8b fb ff ff       	call   8010e3 <fd_lookup>
+  801558:	83 c4 10             	add    $0x10,%esp
+  80155b:	85 c0                	test   %eax,%eax
+  80155d:	78 34                	js     801593 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80155f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801562:	83 ec 08             	sub    $0x8,%esp
+  801565:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801568:	50                   	push   %eax
+  801569:	ff 36                	push   (%esi)
+  80156b:	e8 c3 fb ff ff       	call   801133 <dev_lookup>
+  801570:	83 c4 10             	add    $0x10,%esp
+  801573:	85 c0                	test   %eax,%eax
+  801575:	78 1c                	js     801593 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801577:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80157b:	74 1d                	je     80159a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80157d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801580:	8b 40 18             	mov    0x18(%eax),%eax
+  801583:	85 c0                	test   %eax,%eax
+  801585:	74 34                	je     8015bb <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801587:	83 ec 08             	sub    $0x8,%esp
+  80158a:	ff 75 0c             	push   0xc(%ebp)
+  80158d:	56                   	push   %esi
+  80158e:	ff d0                	call   *%eax
+  801590:	83 c4 10             	add    $0x10,%esp
+}
+  801593:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801596:	5b                   	pop    %ebx
+  801597:	5e                   	pop    %esi
+  801598:	5d                   	pop    %ebp
+  801599:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80159a:	a1 00 70 80 00       	mov    0x807000,%eax
+  80159f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015a2:	83 ec 04             	sub    $0x4,%esp
+  8015a5:	53                   	push   %ebx
+  8015a6:	50                   	push   %eax
+  8015a7:	68 34 3d 80 00       	push   $0x803d34
+  8015ac:	e8 ba ec ff ff       	call   80026b <cprintf>
+		return -E_INVAL;
+  8015b1:	83 c4 10             	add    $0x10,%esp
+  8015b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b9:	eb d8                	jmp    801593 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8015bb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015c0:	eb d1                	jmp    801593 <ftruncate+0x50>
+
+008015c2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015c2:	55                   	push   %ebp
+  8015c3:	89 e5                	mov    %esp,%ebp
+  8015c5:	56                   	push   %esi
+  8015c6:	53                   	push   %ebx
+  8015c7:	83 ec 18             	sub    $0x18,%esp
+  8015ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015cd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015d0:	50                   	push   %eax
+  8015d1:	ff 75 08             	push   0x8(%ebp)
+  8015d4:	e8 0a fb ff ff       	call   8010e3 <fd_lookup>
+  8015d9:	83 c4 10             	add    $0x10,%esp
+  8015dc:	85 c0                	test   %eax,%eax
+  8015de:	78 49                	js     801629 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015e0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015e3:	83 ec 08             	sub    $0x8,%esp
+  8015e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015e9:	50                   	push   %eax
+  8015ea:	ff 36                	push   (%esi)
+  8015ec:	e8 42 fb ff ff       	call   801133 <dev_lookup>
+  8015f1:	83 c4 10             	add    $0x10,%esp
+  8015f4:	85 c0                	test   %eax,%eax
+  8015f6:	78 31                	js     801629 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8015f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015fb:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8015ff:	74 2f                	je     801630 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801601:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801604:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80160b:	00 00 00 
+	stat->st_isdir = 0;
+  80160e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801615:	00 00 00 
+	stat->st_dev = dev;
+  801618:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80161e:	83 ec 08             	sub    $0x8,%esp
+  801621:	53                   	push   %ebx
+  801622:	56                   	push   %esi
+  801623:	ff 50 14             	call   *0x14(%eax)
+  801626:	83 c4 10             	add    $0x10,%esp
+}
+  801629:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80162c:	5b                   	pop    %ebx
+  80162d:	5e                   	pop    %esi
+  80162e:	5d                   	pop    %ebp
+  80162f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801630:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801635:	eb f2                	jmp    801629 <fstat+0x67>
+
+00801637 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801637:	55                   	push   %ebp
+  801638:	89 e5                	mov    %esp,%ebp
+  80163a:	56                   	push   %esi
+  80163b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  80163c:	83 ec 08             	sub    $0x8,%esp
+  80163f:	68 00 10 00 00       	push   $0x1000
+  801644:	ff 75 08             	push   0x8(%ebp)
+  801647:	e8 b3 07 00 00       	call   801dff <open>
+  80164c:	89 c3                	mov    %eax,%ebx
+  80164e:	83 c4 10             	add    $0x10,%esp
+  801651:	85 c0                	test   %eax,%eax
+  801653:	78 1b                	js     801670 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801655:	83 ec 08             	sub    $0x8,%esp
+  801658:	ff 75 0c             	push   0xc(%ebp)
+  80165b:	50                   	push   %eax
+  80165c:	e8 61 ff ff ff       	call   8015c2 <fstat>
+  801661:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801663:	89 1c 24             	mov    %ebx,(%esp)
+  801666:	e8 a2 fb ff ff       	call   80120d <close>
+	return r;
+  80166b:	83 c4 10             	add    $0x10,%esp
+  80166e:	89 f3                	mov    %esi,%ebx
+}
+  801670:	89 d8                	mov    %ebx,%eax
+  801672:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801675:	5b                   	pop    %ebx
+  801676:	5e                   	pop    %esi
+  801677:	5d                   	pop    %ebp
+  801678:	c3                   	ret
+
+00801679 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801679:	55                   	push   %ebp
+  80167a:	89 e5                	mov    %esp,%ebp
+  80167c:	57                   	push   %edi
+  80167d:	56                   	push   %esi
+  80167e:	53                   	push   %ebx
+  80167f:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801685:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  80168b:	89 d6                	mov    %edx,%esi
+  80168d:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801693:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801696:	89 d3                	mov    %edx,%ebx
+  801698:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  80169e:	83 3d c8 90 80 00 00 	cmpl   $0x0,0x8090c8
+  8016a5:	74 1d                	je     8016c4 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8016a7:	b8 00 80 80 00       	mov    $0x808000,%eax
+  8016ac:	83 c8 07             	or     $0x7,%eax
+  8016af:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  8016b5:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8016ba:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  8016c0:	01 ce                	add    %ecx,%esi
+  8016c2:	eb 28                	jmp    8016ec <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016c4:	83 ec 0c             	sub    $0xc,%esp
+  8016c7:	6a 01                	push   $0x1
+  8016c9:	e8 20 1f 00 00       	call   8035ee <ipc_find_env>
+  8016ce:	a3 c8 90 80 00       	mov    %eax,0x8090c8
+  8016d3:	83 c4 10             	add    $0x10,%esp
+  8016d6:	eb cf                	jmp    8016a7 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  8016d8:	83 c0 01             	add    $0x1,%eax
+  8016db:	89 fa                	mov    %edi,%edx
+  8016dd:	09 da                	or     %ebx,%edx
+  8016df:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8016e6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8016ec:	39 f3                	cmp    %esi,%ebx
+  8016ee:	72 e8                	jb     8016d8 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  8016f0:	83 f8 41             	cmp    $0x41,%eax
+  8016f3:	77 2f                	ja     801724 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  8016f5:	50                   	push   %eax
+  8016f6:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  8016fc:	50                   	push   %eax
+  8016fd:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801703:	ff 35 c8 90 80 00    	push   0x8090c8
+  801709:	e8 92 1e 00 00       	call   8035a0 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  80170e:	83 c4 0c             	add    $0xc,%esp
+  801711:	6a 00                	push   $0x0
+  801713:	6a 00                	push   $0x0
+  801715:	6a 00                	push   $0x0
+  801717:	e8 2e 1d 00 00       	call   80344a <ipc_recv>
+}
+  80171c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80171f:	5b                   	pop    %ebx
+  801720:	5e                   	pop    %esi
+  801721:	5f                   	pop    %edi
+  801722:	5d                   	pop    %ebp
+  801723:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801724:	68 a4 3d 80 00       	push   $0x803da4
+  801729:	68 c0 3d 80 00       	push   $0x803dc0
+  80172e:	6a 40                	push   $0x40
+  801730:	68 d5 3d 80 00       	push   $0x803dd5
+  801735:	e8 56 ea ff ff       	call   800190 <_panic>
+
+0080173a <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  80173a:	55                   	push   %ebp
+  80173b:	89 e5                	mov    %esp,%ebp
+  80173d:	57                   	push   %edi
+  80173e:	56                   	push   %esi
+  80173f:	53                   	push   %ebx
+  801740:	83 ec 1c             	sub    $0x1c,%esp
+  801743:	89 c3                	mov    %eax,%ebx
+  801745:	89 d6                	mov    %edx,%esi
+  801747:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  80174a:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801750:	89 ca                	mov    %ecx,%edx
+  801752:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801755:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  80175c:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80175f:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801766:	8b 76 0c             	mov    0xc(%esi),%esi
+  801769:	89 fb                	mov    %edi,%ebx
+  80176b:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801772:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801775:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  80177c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80177f:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801786:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801789:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801790:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801793:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  80179a:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  80179f:	39 c8                	cmp    %ecx,%eax
+  8017a1:	74 0d                	je     8017b0 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  8017a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017ab:	5b                   	pop    %ebx
+  8017ac:	5e                   	pop    %esi
+  8017ad:	5f                   	pop    %edi
+  8017ae:	5d                   	pop    %ebp
+  8017af:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017b0:	6a 07                	push   $0x7
+  8017b2:	68 00 80 80 00       	push   $0x808000
+  8017b7:	6a 0d                	push   $0xd
+  8017b9:	ff 35 c8 90 80 00    	push   0x8090c8
+  8017bf:	e8 f1 1c 00 00       	call   8034b5 <ipc_send>
+  8017c4:	83 c4 10             	add    $0x10,%esp
+  8017c7:	eb da                	jmp    8017a3 <fsring_post+0x69>
+
+008017c9 <fsipcv>:
+{
+  8017c9:	55                   	push   %ebp
+  8017ca:	89 e5                	mov    %esp,%ebp
+  8017cc:	57                   	push   %edi
+  8017cd:	56                   	push   %esi
+  8017ce:	53                   	push   %ebx
+  8017cf:	83 ec 0c             	sub    $0xc,%esp
+  8017d2:	89 c7                	mov    %eax,%edi
+  8017d4:	89 d3                	mov    %edx,%ebx
+  8017d6:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  8017d8:	83 3d c8 90 80 00 00 	cmpl   $0x0,0x8090c8
+  8017df:	74 26                	je     801807 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017e1:	6a 07                	push   $0x7
+  8017e3:	68 00 80 80 00       	push   $0x808000
+  8017e8:	57                   	push   %edi
+  8017e9:	ff 35 c8 90 80 00    	push   0x8090c8
+  8017ef:	e8 c1 1c 00 00       	call   8034b5 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  8017f4:	6a 00                	push   $0x0
+  8017f6:	56                   	push   %esi
+  8017f7:	53                   	push   %ebx
+  8017f8:	6a 00                	push   $0x0
+  8017fa:	e8 0e 1d 00 00       	call   80350d <ipc_recvv>
+}
+  8017ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801802:	5b                   	pop    %ebx
+  801803:	5e                   	pop    %esi
+  801804:	5f                   	pop    %edi
+  801805:	5d                   	pop    %ebp
+  801806:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801807:	83 ec 0c             	sub    $0xc,%esp
+  80180a:	6a 01                	push   $0x1
+  80180c:	e8 dd 1d 00 00       	call   8035ee <ipc_find_env>
+  801811:	a3 c8 90 80 00       	mov    %eax,0x8090c8
+  801816:	83 c4 10             	add    $0x10,%esp
+  801819:	eb c6                	jmp    8017e1 <fsipcv+0x18>
+
+0080181b <fsipc>:
+{
+  80181b:	55                   	push   %ebp
+  80181c:	89 e5                	mov    %esp,%ebp
+  80181e:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801821:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801828:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  80182b:	e8 99 ff ff ff       	call   8017c9 <fsipcv>
+}
+  801830:	c9                   	leave
+  801831:	c3                   	ret
+
+00801832 <file_write_direct>:
+{
+  801832:	55                   	push   %ebp
+  801833:	89 e5                	mov    %esp,%ebp
+  801835:	56                   	push   %esi
+  801836:	53                   	push   %ebx
+  801837:	89 c3                	mov    %eax,%ebx
+  801839:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  80183b:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801841:	77 40                	ja     801883 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801843:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801848:	39 c8                	cmp    %ecx,%eax
+  80184a:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80184d:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801850:	89 0d 00 80 80 00    	mov    %ecx,0x808000
+	fsipcbuf.write.req_n = n;
+  801856:	a3 04 80 80 00       	mov    %eax,0x808004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80185b:	83 ec 04             	sub    $0x4,%esp
+  80185e:	50                   	push   %eax
+  80185f:	52                   	push   %edx
+  801860:	68 08 80 80 00       	push   $0x808008
+  801865:	e8 75 f1 ff ff       	call   8009df <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80186a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80186f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801874:	e8 a2 ff ff ff       	call   80181b <fsipc>
+  801879:	83 c4 10             	add    $0x10,%esp
+}
+  80187c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80187f:	5b                   	pop    %ebx
+  801880:	5e                   	pop    %esi
+  801881:	5d                   	pop    %ebp
+  801882:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801883:	89 d6                	mov    %edx,%esi
+  801885:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80188b:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801890:	29 f1                	sub    %esi,%ecx
+  801892:	39 c1                	cmp    %eax,%ecx
+  801894:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801897:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80189a:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.bulk.req_n = n;
+  80189f:	89 0d 04 80 80 00    	mov    %ecx,0x808004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8018a5:	89 35 08 80 80 00    	mov    %esi,0x808008
+	return fsipc_pages(type, buf, n, perm);
+  8018ab:	83 ec 0c             	sub    $0xc,%esp
+  8018ae:	6a 05                	push   $0x5
+  8018b0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8018b5:	e8 bf fd ff ff       	call   801679 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  8018ba:	83 c4 10             	add    $0x10,%esp
+  8018bd:	eb bd                	jmp    80187c <file_write_direct+0x4a>
+
+008018bf <devfile_sync>:
+{
+  8018bf:	55                   	push   %ebp
+  8018c0:	89 e5                	mov    %esp,%ebp
+  8018c2:	57                   	push   %edi
+  8018c3:	56                   	push   %esi
+  8018c4:	53                   	push   %ebx
+  8018c5:	83 ec 28             	sub    $0x28,%esp
+  8018c8:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  8018cb:	56                   	push   %esi
+  8018cc:	e8 a5 f7 ff ff       	call   801076 <fd2data>
+  8018d1:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  8018d3:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  8018d6:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  8018dd:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8018e0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  8018e5:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8018e9:	74 45                	je     801930 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  8018eb:	8b 46 14             	mov    0x14(%esi),%eax
+  8018ee:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8018f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018fb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8018fe:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801901:	39 cb                	cmp    %ecx,%ebx
+  801903:	73 14                	jae    801919 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801905:	29 d9                	sub    %ebx,%ecx
+  801907:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  80190a:	89 f0                	mov    %esi,%eax
+  80190c:	e8 21 ff ff ff       	call   801832 <file_write_direct>
+  801911:	85 c0                	test   %eax,%eax
+  801913:	7e 04                	jle    801919 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801915:	01 c3                	add    %eax,%ebx
+  801917:	eb e5                	jmp    8018fe <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801919:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80191c:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801923:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801926:	85 c0                	test   %eax,%eax
+  801928:	ba 00 00 00 00       	mov    $0x0,%edx
+  80192d:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801933:	5b                   	pop    %ebx
+  801934:	5e                   	pop    %esi
+  801935:	5f                   	pop    %edi
+  801936:	5d                   	pop    %ebp
+  801937:	c3                   	ret
+
+00801938 <devfile_write>:
+{
+  801938:	55                   	push   %ebp
+  801939:	89 e5                	mov    %esp,%ebp
+  80193b:	57                   	push   %edi
+  80193c:	56                   	push   %esi
+  80193d:	53                   	push   %ebx
+  80193e:	83 ec 28             	sub    $0x28,%esp
+  801941:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801944:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801947:	53                   	push   %ebx
+  801948:	e8 29 f7 ff ff       	call   801076 <fd2data>
+  80194d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801950:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801953:	83 c4 10             	add    $0x10,%esp
+  801956:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  80195a:	74 43                	je     80199f <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  80195c:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801963:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801966:	85 c0                	test   %eax,%eax
+  801968:	74 43                	je     8019ad <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  80196a:	89 c2                	mov    %eax,%edx
+  80196c:	03 53 14             	add    0x14(%ebx),%edx
+  80196f:	39 fa                	cmp    %edi,%edx
+  801971:	75 0b                	jne    80197e <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801973:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801976:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  80197c:	76 66                	jbe    8019e4 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  80197e:	83 ec 0c             	sub    $0xc,%esp
+  801981:	53                   	push   %ebx
+  801982:	e8 38 ff ff ff       	call   8018bf <devfile_sync>
+  801987:	83 c4 10             	add    $0x10,%esp
+  80198a:	85 c0                	test   %eax,%eax
+  80198c:	78 4e                	js     8019dc <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  80198e:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801994:	77 56                	ja     8019ec <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801996:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801999:	85 c0                	test   %eax,%eax
+  80199b:	75 20                	jne    8019bd <devfile_write+0x85>
+  80199d:	eb 16                	jmp    8019b5 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  80199f:	89 f1                	mov    %esi,%ecx
+  8019a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019a4:	89 d8                	mov    %ebx,%eax
+  8019a6:	e8 87 fe ff ff       	call   801832 <file_write_direct>
+  8019ab:	eb 2f                	jmp    8019dc <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8019ad:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8019b3:	77 37                	ja     8019ec <devfile_write+0xb4>
+		ff->buf_base = pos;
+  8019b5:	89 7b 14             	mov    %edi,0x14(%ebx)
+  8019b8:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  8019bd:	83 ec 04             	sub    $0x4,%esp
+  8019c0:	56                   	push   %esi
+  8019c1:	ff 75 0c             	push   0xc(%ebp)
+  8019c4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019c7:	01 c1                	add    %eax,%ecx
+  8019c9:	51                   	push   %ecx
+  8019ca:	e8 10 f0 ff ff       	call   8009df <memmove>
+	ff->buf_wlen += n;
+  8019cf:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  8019d2:	01 f7                	add    %esi,%edi
+  8019d4:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8019d7:	89 f0                	mov    %esi,%eax
+  8019d9:	83 c4 10             	add    $0x10,%esp
+}
+  8019dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019df:	5b                   	pop    %ebx
+  8019e0:	5e                   	pop    %esi
+  8019e1:	5f                   	pop    %edi
+  8019e2:	5d                   	pop    %ebp
+  8019e3:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  8019e4:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8019ea:	76 d1                	jbe    8019bd <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  8019ec:	89 f1                	mov    %esi,%ecx
+  8019ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019f1:	89 d8                	mov    %ebx,%eax
+  8019f3:	e8 3a fe ff ff       	call   801832 <file_write_direct>
+  8019f8:	eb e2                	jmp    8019dc <devfile_write+0xa4>
+
+008019fa <devfile_trunc>:
+{
+  8019fa:	55                   	push   %ebp
+  8019fb:	89 e5                	mov    %esp,%ebp
+  8019fd:	53                   	push   %ebx
+  8019fe:	83 ec 10             	sub    $0x10,%esp
+  801a01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801a04:	53                   	push   %ebx
+  801a05:	e8 b5 fe ff ff       	call   8018bf <devfile_sync>
+  801a0a:	83 c4 10             	add    $0x10,%esp
+  801a0d:	85 c0                	test   %eax,%eax
+  801a0f:	78 1f                	js     801a30 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a11:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a14:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801a19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a1c:	a3 04 80 80 00       	mov    %eax,0x808004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801a21:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a26:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a2b:	e8 eb fd ff ff       	call   80181b <fsipc>
+}
+  801a30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a33:	c9                   	leave
+  801a34:	c3                   	ret
+
+00801a35 <devfile_stat>:
+{
+  801a35:	55                   	push   %ebp
+  801a36:	89 e5                	mov    %esp,%ebp
+  801a38:	56                   	push   %esi
+  801a39:	53                   	push   %ebx
+  801a3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a3d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801a40:	83 ec 0c             	sub    $0xc,%esp
+  801a43:	53                   	push   %ebx
+  801a44:	e8 76 fe ff ff       	call   8018bf <devfile_sync>
+  801a49:	83 c4 10             	add    $0x10,%esp
+  801a4c:	85 c0                	test   %eax,%eax
+  801a4e:	78 47                	js     801a97 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a50:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a53:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a58:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a5d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a62:	e8 b4 fd ff ff       	call   80181b <fsipc>
+  801a67:	85 c0                	test   %eax,%eax
+  801a69:	78 2c                	js     801a97 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a6b:	83 ec 08             	sub    $0x8,%esp
+  801a6e:	68 00 80 80 00       	push   $0x808000
+  801a73:	56                   	push   %esi
+  801a74:	e8 e0 ed ff ff       	call   800859 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a79:	a1 80 80 80 00       	mov    0x808080,%eax
+  801a7e:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a84:	a1 84 80 80 00       	mov    0x808084,%eax
+  801a89:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801a8f:	83 c4 10             	add    $0x10,%esp
+  801a92:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a9a:	5b                   	pop    %ebx
+  801a9b:	5e                   	pop    %esi
+  801a9c:	5d                   	pop    %ebp
+  801a9d:	c3                   	ret
+
+00801a9e <devfile_flush>:
+{
+  801a9e:	55                   	push   %ebp
+  801a9f:	89 e5                	mov    %esp,%ebp
+  801aa1:	56                   	push   %esi
+  801aa2:	53                   	push   %ebx
+  801aa3:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801aa6:	83 ec 0c             	sub    $0xc,%esp
+  801aa9:	56                   	push   %esi
+  801aaa:	e8 10 fe ff ff       	call   8018bf <devfile_sync>
+  801aaf:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801ab1:	83 c4 10             	add    $0x10,%esp
+  801ab4:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801ab8:	75 25                	jne    801adf <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801aba:	8b 46 0c             	mov    0xc(%esi),%eax
+  801abd:	a3 00 80 80 00       	mov    %eax,0x808000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801ac2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac7:	b8 06 00 00 00       	mov    $0x6,%eax
+  801acc:	e8 4a fd ff ff       	call   80181b <fsipc>
+  801ad1:	85 c0                	test   %eax,%eax
+  801ad3:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801ad6:	89 d8                	mov    %ebx,%eax
+  801ad8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801adb:	5b                   	pop    %ebx
+  801adc:	5e                   	pop    %esi
+  801add:	5d                   	pop    %ebp
+  801ade:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801adf:	83 ec 0c             	sub    $0xc,%esp
+  801ae2:	56                   	push   %esi
+  801ae3:	e8 8e f5 ff ff       	call   801076 <fd2data>
+  801ae8:	83 c4 08             	add    $0x8,%esp
+  801aeb:	50                   	push   %eax
+  801aec:	6a 00                	push   $0x0
+  801aee:	e8 ff f1 ff ff       	call   800cf2 <sys_page_unmap>
+  801af3:	83 c4 10             	add    $0x10,%esp
+  801af6:	eb c2                	jmp    801aba <devfile_flush+0x1c>
+
+00801af8 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801af8:	55                   	push   %ebp
+  801af9:	89 e5                	mov    %esp,%ebp
+  801afb:	57                   	push   %edi
+  801afc:	56                   	push   %esi
+  801afd:	53                   	push   %ebx
+  801afe:	83 ec 64             	sub    $0x64,%esp
+  801b01:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801b03:	52                   	push   %edx
+  801b04:	50                   	push   %eax
+  801b05:	e8 d9 f5 ff ff       	call   8010e3 <fd_lookup>
+  801b0a:	89 c1                	mov    %eax,%ecx
+  801b0c:	83 c4 10             	add    $0x10,%esp
+  801b0f:	85 c0                	test   %eax,%eax
+  801b11:	0f 88 f2 00 00 00    	js     801c09 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801b17:	8b 07                	mov    (%edi),%eax
+  801b19:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801b1f:	39 10                	cmp    %edx,(%eax)
+  801b21:	0f 85 03 01 00 00    	jne    801c2a <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801b27:	a1 00 70 80 00       	mov    0x807000,%eax
+  801b2c:	8b 40 48             	mov    0x48(%eax),%eax
+  801b2f:	3b 05 c4 90 80 00    	cmp    0x8090c4,%eax
+  801b35:	0f 84 96 00 00 00    	je     801bd1 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801b3b:	83 3d c8 90 80 00 00 	cmpl   $0x0,0x8090c8
+  801b42:	0f 84 cb 00 00 00    	je     801c13 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b48:	b8 00 80 80 00       	mov    $0x808000,%eax
+  801b4d:	83 c8 07             	or     $0x7,%eax
+  801b50:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801b53:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b56:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801b5b:	83 ec 04             	sub    $0x4,%esp
+  801b5e:	68 07 04 00 00       	push   $0x407
+  801b63:	53                   	push   %ebx
+  801b64:	6a 00                	push   $0x0
+  801b66:	e8 fa f0 ff ff       	call   800c65 <sys_page_alloc>
+  801b6b:	89 c1                	mov    %eax,%ecx
+  801b6d:	83 c4 10             	add    $0x10,%esp
+  801b70:	85 c0                	test   %eax,%eax
+  801b72:	0f 88 91 00 00 00    	js     801c09 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801b78:	89 d8                	mov    %ebx,%eax
+  801b7a:	83 c8 07             	or     $0x7,%eax
+  801b7d:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801b7f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b85:	83 c6 04             	add    $0x4,%esi
+  801b88:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801b8e:	75 cb                	jne    801b5b <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801b90:	6a 12                	push   $0x12
+  801b92:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801b95:	50                   	push   %eax
+  801b96:	6a 0c                	push   $0xc
+  801b98:	ff 35 c8 90 80 00    	push   0x8090c8
+  801b9e:	e8 fd 19 00 00       	call   8035a0 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801ba3:	83 c4 0c             	add    $0xc,%esp
+  801ba6:	6a 00                	push   $0x0
+  801ba8:	6a 00                	push   $0x0
+  801baa:	6a 00                	push   $0x0
+  801bac:	e8 99 18 00 00       	call   80344a <ipc_recv>
+  801bb1:	89 c1                	mov    %eax,%ecx
+  801bb3:	83 c4 10             	add    $0x10,%esp
+  801bb6:	85 c0                	test   %eax,%eax
+  801bb8:	78 4f                	js     801c09 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801bba:	a1 00 70 80 00       	mov    0x807000,%eax
+  801bbf:	8b 40 48             	mov    0x48(%eax),%eax
+  801bc2:	a3 c4 90 80 00       	mov    %eax,0x8090c4
+	fsring_busy = 0;
+  801bc7:	c7 05 c0 90 80 00 00 	movl   $0x0,0x8090c0
+  801bce:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801bd1:	83 ec 0c             	sub    $0xc,%esp
+  801bd4:	ff 37                	push   (%edi)
+  801bd6:	e8 e4 fc ff ff       	call   8018bf <devfile_sync>
+  801bdb:	89 c1                	mov    %eax,%ecx
+  801bdd:	83 c4 10             	add    $0x10,%esp
+  801be0:	85 c0                	test   %eax,%eax
+  801be2:	78 25                	js     801c09 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801be4:	8b 1d c0 90 80 00    	mov    0x8090c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801bea:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801bef:	ba 01 00 00 00       	mov    $0x1,%edx
+  801bf4:	89 d0                	mov    %edx,%eax
+  801bf6:	d3 e0                	shl    %cl,%eax
+  801bf8:	85 d8                	test   %ebx,%eax
+  801bfa:	74 0d                	je     801c09 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801bfc:	83 c1 01             	add    $0x1,%ecx
+  801bff:	83 f9 10             	cmp    $0x10,%ecx
+  801c02:	75 f0                	jne    801bf4 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801c04:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801c09:	89 c8                	mov    %ecx,%eax
+  801c0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c0e:	5b                   	pop    %ebx
+  801c0f:	5e                   	pop    %esi
+  801c10:	5f                   	pop    %edi
+  801c11:	5d                   	pop    %ebp
+  801c12:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c13:	83 ec 0c             	sub    $0xc,%esp
+  801c16:	6a 01                	push   $0x1
+  801c18:	e8 d1 19 00 00       	call   8035ee <ipc_find_env>
+  801c1d:	a3 c8 90 80 00       	mov    %eax,0x8090c8
+  801c22:	83 c4 10             	add    $0x10,%esp
+  801c25:	e9 1e ff ff ff       	jmp    801b48 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801c2a:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801c2f:	eb d8                	jmp    801c09 <fsring_slot+0x111>
+
+00801c31 <file_read_direct>:
+{
+  801c31:	55                   	push   %ebp
+  801c32:	89 e5                	mov    %esp,%ebp
+  801c34:	57                   	push   %edi
+  801c35:	56                   	push   %esi
+  801c36:	53                   	push   %ebx
+  801c37:	83 ec 1c             	sub    $0x1c,%esp
+  801c3a:	89 c7                	mov    %eax,%edi
+  801c3c:	89 d6                	mov    %edx,%esi
+  801c3e:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801c40:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801c46:	77 52                	ja     801c9a <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c48:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c4b:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801c50:	89 0d 04 80 80 00    	mov    %ecx,0x808004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c56:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c5b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c60:	e8 b6 fb ff ff       	call   80181b <fsipc>
+  801c65:	89 c7                	mov    %eax,%edi
+  801c67:	85 c0                	test   %eax,%eax
+  801c69:	78 25                	js     801c90 <file_read_direct+0x5f>
+	assert(r <= n);
+  801c6b:	39 c3                	cmp    %eax,%ebx
+  801c6d:	0f 82 87 00 00 00    	jb     801cfa <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801c73:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c78:	0f 8f 95 00 00 00    	jg     801d13 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801c7e:	83 ec 04             	sub    $0x4,%esp
+  801c81:	50                   	push   %eax
+  801c82:	68 00 80 80 00       	push   $0x808000
+  801c87:	56                   	push   %esi
+  801c88:	e8 52 ed ff ff       	call   8009df <memmove>
+	return r;
+  801c8d:	83 c4 10             	add    $0x10,%esp
+}
+  801c90:	89 f8                	mov    %edi,%eax
+  801c92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c95:	5b                   	pop    %ebx
+  801c96:	5e                   	pop    %esi
+  801c97:	5f                   	pop    %edi
+  801c98:	5d                   	pop    %ebp
+  801c99:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801c9a:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801ca0:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801ca5:	29 d1                	sub    %edx,%ecx
+  801ca7:	39 d9                	cmp    %ebx,%ecx
+  801ca9:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801cac:	89 f0                	mov    %esi,%eax
+  801cae:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801cb1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801cb4:	eb 0f                	jmp    801cc5 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801cb6:	0f b6 10             	movzbl (%eax),%edx
+  801cb9:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801cbb:	05 00 10 00 00       	add    $0x1000,%eax
+  801cc0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801cc5:	39 c8                	cmp    %ecx,%eax
+  801cc7:	72 ed                	jb     801cb6 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801cc9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ccc:	8b 47 0c             	mov    0xc(%edi),%eax
+  801ccf:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.bulk.req_n = n;
+  801cd4:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801cda:	89 15 08 80 80 00    	mov    %edx,0x808008
+	return fsipc_pages(type, buf, n, perm);
+  801ce0:	83 ec 0c             	sub    $0xc,%esp
+  801ce3:	6a 07                	push   $0x7
+  801ce5:	89 d9                	mov    %ebx,%ecx
+  801ce7:	89 f2                	mov    %esi,%edx
+  801ce9:	b8 09 00 00 00       	mov    $0x9,%eax
+  801cee:	e8 86 f9 ff ff       	call   801679 <fsipc_pages>
+  801cf3:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801cf5:	83 c4 10             	add    $0x10,%esp
+  801cf8:	eb 96                	jmp    801c90 <file_read_direct+0x5f>
+	assert(r <= n);
+  801cfa:	68 e0 3d 80 00       	push   $0x803de0
+  801cff:	68 c0 3d 80 00       	push   $0x803dc0
+  801d04:	68 dc 00 00 00       	push   $0xdc
+  801d09:	68 d5 3d 80 00       	push   $0x803dd5
+  801d0e:	e8 7d e4 ff ff       	call   800190 <_panic>
+	assert(r <= PGSIZE);
+  801d13:	68 f1 3d 80 00       	push   $0x803df1
+  801d18:	68 c0 3d 80 00       	push   $0x803dc0
+  801d1d:	68 dd 00 00 00       	push   $0xdd
+  801d22:	68 d5 3d 80 00       	push   $0x803dd5
+  801d27:	e8 64 e4 ff ff       	call   800190 <_panic>
+
+00801d2c <devfile_read>:
+{
+  801d2c:	55                   	push   %ebp
+  801d2d:	89 e5                	mov    %esp,%ebp
+  801d2f:	57                   	push   %edi
+  801d30:	56                   	push   %esi
+  801d31:	53                   	push   %ebx
+  801d32:	83 ec 28             	sub    $0x28,%esp
+  801d35:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d38:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801d3b:	53                   	push   %ebx
+  801d3c:	e8 35 f3 ff ff       	call   801076 <fd2data>
+  801d41:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801d44:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801d47:	83 c4 10             	add    $0x10,%esp
+  801d4a:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801d4e:	74 7d                	je     801dcd <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801d50:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801d54:	0f 85 81 00 00 00    	jne    801ddb <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801d5a:	8b 43 18             	mov    0x18(%ebx),%eax
+  801d5d:	85 c0                	test   %eax,%eax
+  801d5f:	74 0d                	je     801d6e <devfile_read+0x42>
+  801d61:	8b 53 14             	mov    0x14(%ebx),%edx
+  801d64:	39 fa                	cmp    %edi,%edx
+  801d66:	7f 06                	jg     801d6e <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801d68:	01 c2                	add    %eax,%edx
+  801d6a:	39 d7                	cmp    %edx,%edi
+  801d6c:	72 28                	jb     801d96 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801d6e:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801d75:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d7b:	77 74                	ja     801df1 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801d7d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d82:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d85:	89 d8                	mov    %ebx,%eax
+  801d87:	e8 a5 fe ff ff       	call   801c31 <file_read_direct>
+  801d8c:	85 c0                	test   %eax,%eax
+  801d8e:	7e 35                	jle    801dc5 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801d90:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801d93:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801d96:	8b 53 14             	mov    0x14(%ebx),%edx
+  801d99:	89 d0                	mov    %edx,%eax
+  801d9b:	03 43 18             	add    0x18(%ebx),%eax
+  801d9e:	29 f8                	sub    %edi,%eax
+  801da0:	39 f0                	cmp    %esi,%eax
+  801da2:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801da5:	83 ec 04             	sub    $0x4,%esp
+  801da8:	56                   	push   %esi
+  801da9:	89 f8                	mov    %edi,%eax
+  801dab:	29 d0                	sub    %edx,%eax
+  801dad:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801db0:	01 c1                	add    %eax,%ecx
+  801db2:	51                   	push   %ecx
+  801db3:	ff 75 0c             	push   0xc(%ebp)
+  801db6:	e8 24 ec ff ff       	call   8009df <memmove>
+	fd->fd_offset = pos + n;
+  801dbb:	01 f7                	add    %esi,%edi
+  801dbd:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801dc0:	89 f0                	mov    %esi,%eax
+  801dc2:	83 c4 10             	add    $0x10,%esp
+}
+  801dc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc8:	5b                   	pop    %ebx
+  801dc9:	5e                   	pop    %esi
+  801dca:	5f                   	pop    %edi
+  801dcb:	5d                   	pop    %ebp
+  801dcc:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801dcd:	89 f1                	mov    %esi,%ecx
+  801dcf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dd2:	89 d8                	mov    %ebx,%eax
+  801dd4:	e8 58 fe ff ff       	call   801c31 <file_read_direct>
+  801dd9:	eb ea                	jmp    801dc5 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801ddb:	83 ec 0c             	sub    $0xc,%esp
+  801dde:	53                   	push   %ebx
+  801ddf:	e8 db fa ff ff       	call   8018bf <devfile_sync>
+  801de4:	83 c4 10             	add    $0x10,%esp
+  801de7:	85 c0                	test   %eax,%eax
+  801de9:	0f 89 6b ff ff ff    	jns    801d5a <devfile_read+0x2e>
+  801def:	eb d4                	jmp    801dc5 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801df1:	89 f1                	mov    %esi,%ecx
+  801df3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801df6:	89 d8                	mov    %ebx,%eax
+  801df8:	e8 34 fe ff ff       	call   801c31 <file_read_direct>
+  801dfd:	eb c6                	jmp    801dc5 <devfile_read+0x99>
+
+00801dff <open>:
+{
+  801dff:	55                   	push   %ebp
+  801e00:	89 e5                	mov    %esp,%ebp
+  801e02:	56                   	push   %esi
+  801e03:	53                   	push   %ebx
+  801e04:	83 ec 1c             	sub    $0x1c,%esp
+  801e07:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801e0a:	56                   	push   %esi
+  801e0b:	e8 0e ea ff ff       	call   80081e <strlen>
+  801e10:	83 c4 10             	add    $0x10,%esp
+  801e13:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e18:	0f 8f a0 00 00 00    	jg     801ebe <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801e1e:	83 ec 0c             	sub    $0xc,%esp
+  801e21:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e24:	50                   	push   %eax
+  801e25:	e8 63 f2 ff ff       	call   80108d <fd_alloc>
+  801e2a:	89 c3                	mov    %eax,%ebx
+  801e2c:	83 c4 10             	add    $0x10,%esp
+  801e2f:	85 c0                	test   %eax,%eax
+  801e31:	78 45                	js     801e78 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801e33:	83 ec 08             	sub    $0x8,%esp
+  801e36:	56                   	push   %esi
+  801e37:	68 00 80 80 00       	push   $0x808000
+  801e3c:	e8 18 ea ff ff       	call   800859 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801e41:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e44:	a3 00 84 80 00       	mov    %eax,0x808400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801e49:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e51:	e8 c5 f9 ff ff       	call   80181b <fsipc>
+  801e56:	89 c3                	mov    %eax,%ebx
+  801e58:	83 c4 10             	add    $0x10,%esp
+  801e5b:	85 c0                	test   %eax,%eax
+  801e5d:	78 22                	js     801e81 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801e5f:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801e66:	74 2b                	je     801e93 <open+0x94>
+	return fd2num(fd);
+  801e68:	83 ec 0c             	sub    $0xc,%esp
+  801e6b:	ff 75 f4             	push   -0xc(%ebp)
+  801e6e:	e8 f3 f1 ff ff       	call   801066 <fd2num>
+  801e73:	89 c3                	mov    %eax,%ebx
+  801e75:	83 c4 10             	add    $0x10,%esp
+}
+  801e78:	89 d8                	mov    %ebx,%eax
+  801e7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e7d:	5b                   	pop    %ebx
+  801e7e:	5e                   	pop    %esi
+  801e7f:	5d                   	pop    %ebp
+  801e80:	c3                   	ret
+		fd_close(fd, 0);
+  801e81:	83 ec 08             	sub    $0x8,%esp
+  801e84:	6a 00                	push   $0x0
+  801e86:	ff 75 f4             	push   -0xc(%ebp)
+  801e89:	e8 f8 f2 ff ff       	call   801186 <fd_close>
+		return r;
+  801e8e:	83 c4 10             	add    $0x10,%esp
+  801e91:	eb e5                	jmp    801e78 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801e93:	83 ec 0c             	sub    $0xc,%esp
+  801e96:	ff 75 f4             	push   -0xc(%ebp)
+  801e99:	e8 d8 f1 ff ff       	call   801076 <fd2data>
+  801e9e:	83 c4 0c             	add    $0xc,%esp
+  801ea1:	68 07 04 00 00       	push   $0x407
+  801ea6:	50                   	push   %eax
+  801ea7:	6a 00                	push   $0x0
+  801ea9:	e8 b7 ed ff ff       	call   800c65 <sys_page_alloc>
+  801eae:	83 c4 10             	add    $0x10,%esp
+  801eb1:	85 c0                	test   %eax,%eax
+  801eb3:	75 b3                	jne    801e68 <open+0x69>
+		fd->fd_file.buffered = 1;
+  801eb5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eb8:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801ebc:	eb aa                	jmp    801e68 <open+0x69>
+		return -E_BAD_PATH;
+  801ebe:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ec3:	eb b3                	jmp    801e78 <open+0x79>
+
+00801ec5 <readdir>:
+{
+  801ec5:	55                   	push   %ebp
+  801ec6:	89 e5                	mov    %esp,%ebp
+  801ec8:	53                   	push   %ebx
+  801ec9:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ecc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ecf:	50                   	push   %eax
+  801ed0:	ff 75 08             	push   0x8(%ebp)
+  801ed3:	e8 0b f2 ff ff       	call   8010e3 <fd_lookup>
+  801ed8:	89 c3                	mov    %eax,%ebx
+  801eda:	83 c4 10             	add    $0x10,%esp
+  801edd:	85 c0                	test   %eax,%eax
+  801edf:	78 73                	js     801f54 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801ee1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ee4:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801eea:	39 08                	cmp    %ecx,(%eax)
+  801eec:	0f 85 82 00 00 00    	jne    801f74 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801ef2:	83 ec 0c             	sub    $0xc,%esp
+  801ef5:	50                   	push   %eax
+  801ef6:	e8 c4 f9 ff ff       	call   8018bf <devfile_sync>
+  801efb:	89 c3                	mov    %eax,%ebx
+  801efd:	83 c4 10             	add    $0x10,%esp
+  801f00:	85 c0                	test   %eax,%eax
+  801f02:	78 50                	js     801f54 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801f04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f07:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f0a:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.readdir.req_n = n;
+  801f0f:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f12:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.readdir.req_flags = flags;
+  801f17:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f1a:	a3 08 80 80 00       	mov    %eax,0x808008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801f1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f24:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f29:	e8 ed f8 ff ff       	call   80181b <fsipc>
+  801f2e:	89 c3                	mov    %eax,%ebx
+  801f30:	85 c0                	test   %eax,%eax
+  801f32:	7e 20                	jle    801f54 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801f34:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801f37:	72 22                	jb     801f5b <readdir+0x96>
+  801f39:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f3e:	7f 1b                	jg     801f5b <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f40:	83 ec 04             	sub    $0x4,%esp
+  801f43:	50                   	push   %eax
+  801f44:	68 00 80 80 00       	push   $0x808000
+  801f49:	ff 75 0c             	push   0xc(%ebp)
+  801f4c:	e8 8e ea ff ff       	call   8009df <memmove>
+	return r;
+  801f51:	83 c4 10             	add    $0x10,%esp
+}
+  801f54:	89 d8                	mov    %ebx,%eax
+  801f56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f59:	c9                   	leave
+  801f5a:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801f5b:	68 e7 3d 80 00       	push   $0x803de7
+  801f60:	68 c0 3d 80 00       	push   $0x803dc0
+  801f65:	68 86 01 00 00       	push   $0x186
+  801f6a:	68 d5 3d 80 00       	push   $0x803dd5
+  801f6f:	e8 1c e2 ff ff       	call   800190 <_panic>
+		return -E_NOT_SUPP;
+  801f74:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801f79:	eb d9                	jmp    801f54 <readdir+0x8f>
+
+00801f7b <munmap>:
+{
+  801f7b:	55                   	push   %ebp
+  801f7c:	89 e5                	mov    %esp,%ebp
+  801f7e:	56                   	push   %esi
+  801f7f:	53                   	push   %ebx
+  801f80:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f83:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801f86:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801f8c:	75 41                	jne    801fcf <munmap+0x54>
+  801f8e:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801f94:	77 39                	ja     801fcf <munmap+0x54>
+  801f96:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f9b:	29 f0                	sub    %esi,%eax
+  801f9d:	39 d0                	cmp    %edx,%eax
+  801f9f:	72 35                	jb     801fd6 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801fa1:	89 f3                	mov    %esi,%ebx
+  801fa3:	01 d6                	add    %edx,%esi
+  801fa5:	39 f3                	cmp    %esi,%ebx
+  801fa7:	73 1a                	jae    801fc3 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801fa9:	83 ec 08             	sub    $0x8,%esp
+  801fac:	53                   	push   %ebx
+  801fad:	6a 00                	push   $0x0
+  801faf:	e8 3e ed ff ff       	call   800cf2 <sys_page_unmap>
+  801fb4:	83 c4 10             	add    $0x10,%esp
+  801fb7:	85 c0                	test   %eax,%eax
+  801fb9:	78 0d                	js     801fc8 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801fbb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801fc1:	eb e2                	jmp    801fa5 <munmap+0x2a>
+	return 0;
+  801fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fc8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fcb:	5b                   	pop    %ebx
+  801fcc:	5e                   	pop    %esi
+  801fcd:	5d                   	pop    %ebp
+  801fce:	c3                   	ret
+		return -E_INVAL;
+  801fcf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fd4:	eb f2                	jmp    801fc8 <munmap+0x4d>
+  801fd6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fdb:	eb eb                	jmp    801fc8 <munmap+0x4d>
+
+00801fdd <mmap>:
+{
+  801fdd:	55                   	push   %ebp
+  801fde:	89 e5                	mov    %esp,%ebp
+  801fe0:	57                   	push   %edi
+  801fe1:	56                   	push   %esi
+  801fe2:	53                   	push   %ebx
+  801fe3:	83 ec 34             	sub    $0x34,%esp
+  801fe6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fe9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fec:	50                   	push   %eax
+  801fed:	ff 75 18             	push   0x18(%ebp)
+  801ff0:	e8 ee f0 ff ff       	call   8010e3 <fd_lookup>
+  801ff5:	89 c3                	mov    %eax,%ebx
+  801ff7:	83 c4 10             	add    $0x10,%esp
+  801ffa:	85 c0                	test   %eax,%eax
+  801ffc:	0f 88 0e 01 00 00    	js     802110 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802002:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802005:	a1 20 40 80 00       	mov    0x804020,%eax
+  80200a:	39 02                	cmp    %eax,(%edx)
+  80200c:	0f 85 50 01 00 00    	jne    802162 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802012:	8b 45 10             	mov    0x10(%ebp),%eax
+  802015:	83 e0 02             	and    $0x2,%eax
+  802018:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80201b:	74 0a                	je     802027 <mmap+0x4a>
+  80201d:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802021:	0f 84 42 01 00 00    	je     802169 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802027:	8b 42 08             	mov    0x8(%edx),%eax
+  80202a:	83 e0 03             	and    $0x3,%eax
+  80202d:	83 f8 01             	cmp    $0x1,%eax
+  802030:	0f 84 3a 01 00 00    	je     802170 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802036:	8b 45 08             	mov    0x8(%ebp),%eax
+  802039:	0b 45 1c             	or     0x1c(%ebp),%eax
+  80203c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802041:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802044:	0f 85 2d 01 00 00    	jne    802177 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80204a:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80204e:	0f 88 2a 01 00 00    	js     80217e <mmap+0x1a1>
+  802054:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80205b:	0f 87 1d 01 00 00    	ja     80217e <mmap+0x1a1>
+  802061:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802066:	2b 45 08             	sub    0x8(%ebp),%eax
+  802069:	39 f8                	cmp    %edi,%eax
+  80206b:	0f 82 14 01 00 00    	jb     802185 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802071:	83 ec 0c             	sub    $0xc,%esp
+  802074:	52                   	push   %edx
+  802075:	e8 45 f8 ff ff       	call   8018bf <devfile_sync>
+  80207a:	89 c3                	mov    %eax,%ebx
+  80207c:	83 c4 10             	add    $0x10,%esp
+  80207f:	85 c0                	test   %eax,%eax
+  802081:	0f 88 89 00 00 00    	js     802110 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802087:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  80208d:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802093:	be 00 00 00 00       	mov    $0x0,%esi
+  802098:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  80209b:	39 fe                	cmp    %edi,%esi
+  80209d:	73 7b                	jae    80211a <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  80209f:	89 f8                	mov    %edi,%eax
+  8020a1:	29 f0                	sub    %esi,%eax
+  8020a3:	c1 e8 0c             	shr    $0xc,%eax
+  8020a6:	ba 40 00 00 00       	mov    $0x40,%edx
+  8020ab:	39 d0                	cmp    %edx,%eax
+  8020ad:	0f 47 c2             	cmova  %edx,%eax
+  8020b0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8020b3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8020b6:	8b 52 0c             	mov    0xc(%edx),%edx
+  8020b9:	89 15 00 80 80 00    	mov    %edx,0x808000
+		fsipcbuf.map.req_offset = offset + done;
+  8020bf:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8020c2:	89 15 04 80 80 00    	mov    %edx,0x808004
+		fsipcbuf.map.req_npages = n;
+  8020c8:	a3 08 80 80 00       	mov    %eax,0x808008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8020cd:	89 f2                	mov    %esi,%edx
+  8020cf:	03 55 08             	add    0x8(%ebp),%edx
+  8020d2:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8020d5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8020da:	e8 ea f6 ff ff       	call   8017c9 <fsipcv>
+  8020df:	85 c0                	test   %eax,%eax
+  8020e1:	7e 12                	jle    8020f5 <mmap+0x118>
+  8020e3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8020e6:	85 c0                	test   %eax,%eax
+  8020e8:	0f 84 9e 00 00 00    	je     80218c <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8020ee:	c1 e0 0c             	shl    $0xc,%eax
+  8020f1:	01 c6                	add    %eax,%esi
+  8020f3:	eb a6                	jmp    80209b <mmap+0xbe>
+			munmap(addr, done);
+  8020f5:	89 c3                	mov    %eax,%ebx
+  8020f7:	83 ec 08             	sub    $0x8,%esp
+  8020fa:	56                   	push   %esi
+  8020fb:	ff 75 08             	push   0x8(%ebp)
+  8020fe:	e8 78 fe ff ff       	call   801f7b <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802103:	83 c4 10             	add    $0x10,%esp
+  802106:	85 db                	test   %ebx,%ebx
+  802108:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80210d:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802110:	89 d8                	mov    %ebx,%eax
+  802112:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802115:	5b                   	pop    %ebx
+  802116:	5e                   	pop    %esi
+  802117:	5f                   	pop    %edi
+  802118:	5d                   	pop    %ebp
+  802119:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80211a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80211d:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80211f:	85 c0                	test   %eax,%eax
+  802121:	74 ed                	je     802110 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802123:	be 00 00 00 00       	mov    $0x0,%esi
+  802128:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80212b:	39 fe                	cmp    %edi,%esi
+  80212d:	73 2e                	jae    80215d <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80212f:	83 ec 0c             	sub    $0xc,%esp
+  802132:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802135:	50                   	push   %eax
+  802136:	e8 11 11 00 00       	call   80324c <cowpage>
+  80213b:	83 c4 10             	add    $0x10,%esp
+  80213e:	85 c0                	test   %eax,%eax
+  802140:	78 08                	js     80214a <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802142:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802148:	eb e1                	jmp    80212b <mmap+0x14e>
+				munmap(addr, len);
+  80214a:	89 c3                	mov    %eax,%ebx
+  80214c:	83 ec 08             	sub    $0x8,%esp
+  80214f:	57                   	push   %edi
+  802150:	ff 75 08             	push   0x8(%ebp)
+  802153:	e8 23 fe ff ff       	call   801f7b <munmap>
+				return r;
+  802158:	83 c4 10             	add    $0x10,%esp
+  80215b:	eb b3                	jmp    802110 <mmap+0x133>
+	return 0;
+  80215d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802160:	eb ae                	jmp    802110 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802162:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802167:	eb a7                	jmp    802110 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802169:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80216e:	eb a0                	jmp    802110 <mmap+0x133>
+		return -E_INVAL;
+  802170:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802175:	eb 99                	jmp    802110 <mmap+0x133>
+  802177:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80217c:	eb 92                	jmp    802110 <mmap+0x133>
+  80217e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802183:	eb 8b                	jmp    802110 <mmap+0x133>
+  802185:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80218a:	eb 84                	jmp    802110 <mmap+0x133>
+			munmap(addr, done);
+  80218c:	83 ec 08             	sub    $0x8,%esp
+  80218f:	56                   	push   %esi
+  802190:	ff 75 08             	push   0x8(%ebp)
+  802193:	e8 e3 fd ff ff       	call   801f7b <munmap>
+  802198:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  80219b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021a0:	e9 6b ff ff ff       	jmp    802110 <mmap+0x133>
+
+008021a5 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8021a5:	55                   	push   %ebp
+  8021a6:	89 e5                	mov    %esp,%ebp
+  8021a8:	56                   	push   %esi
+  8021a9:	53                   	push   %ebx
+  8021aa:	83 ec 10             	sub    $0x10,%esp
+  8021ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8021b0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b6:	e8 3d f9 ff ff       	call   801af8 <fsring_slot>
+  8021bb:	85 c0                	test   %eax,%eax
+  8021bd:	78 60                	js     80221f <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8021bf:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8021c2:	8b 56 08             	mov    0x8(%esi),%edx
+  8021c5:	83 e2 03             	and    $0x3,%edx
+  8021c8:	83 fa 01             	cmp    $0x1,%edx
+  8021cb:	74 59                	je     802226 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8021cd:	ba 01 00 00 00       	mov    $0x1,%edx
+  8021d2:	89 c1                	mov    %eax,%ecx
+  8021d4:	d3 e2                	shl    %cl,%edx
+  8021d6:	09 15 c0 90 80 00    	or     %edx,0x8090c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8021dc:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8021df:	c1 e2 02             	shl    $0x2,%edx
+  8021e2:	8d 8a 00 90 80 00    	lea    0x809000(%edx),%ecx
+  8021e8:	c7 82 00 90 80 00 03 	movl   $0x3,0x809000(%edx)
+  8021ef:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8021f2:	8b 55 18             	mov    0x18(%ebp),%edx
+  8021f5:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8021f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021fb:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8021fe:	83 ec 08             	sub    $0x8,%esp
+  802201:	50                   	push   %eax
+  802202:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802207:	39 c3                	cmp    %eax,%ebx
+  802209:	0f 47 d8             	cmova  %eax,%ebx
+  80220c:	53                   	push   %ebx
+  80220d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802210:	89 f2                	mov    %esi,%edx
+  802212:	b8 03 00 00 00       	mov    $0x3,%eax
+  802217:	e8 1e f5 ff ff       	call   80173a <fsring_post>
+  80221c:	83 c4 10             	add    $0x10,%esp
+}
+  80221f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802222:	5b                   	pop    %ebx
+  802223:	5e                   	pop    %esi
+  802224:	5d                   	pop    %ebp
+  802225:	c3                   	ret
+		return -E_INVAL;
+  802226:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80222b:	eb f2                	jmp    80221f <fsring_read+0x7a>
+
+0080222d <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80222d:	55                   	push   %ebp
+  80222e:	89 e5                	mov    %esp,%ebp
+  802230:	56                   	push   %esi
+  802231:	53                   	push   %ebx
+  802232:	83 ec 10             	sub    $0x10,%esp
+  802235:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802238:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80223b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80223e:	e8 b5 f8 ff ff       	call   801af8 <fsring_slot>
+  802243:	89 c3                	mov    %eax,%ebx
+  802245:	85 c0                	test   %eax,%eax
+  802247:	78 77                	js     8022c0 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802249:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80224c:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802250:	74 77                	je     8022c9 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802252:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802257:	39 c6                	cmp    %eax,%esi
+  802259:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80225c:	83 ec 04             	sub    $0x4,%esp
+  80225f:	56                   	push   %esi
+  802260:	ff 75 0c             	push   0xc(%ebp)
+  802263:	89 d8                	mov    %ebx,%eax
+  802265:	c1 e0 0c             	shl    $0xc,%eax
+  802268:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80226e:	50                   	push   %eax
+  80226f:	e8 6b e7 ff ff       	call   8009df <memmove>
+	fsring_busy |= 1 << slot;
+  802274:	b8 01 00 00 00       	mov    $0x1,%eax
+  802279:	89 d9                	mov    %ebx,%ecx
+  80227b:	d3 e0                	shl    %cl,%eax
+  80227d:	09 05 c0 90 80 00    	or     %eax,0x8090c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802283:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802286:	c1 e0 02             	shl    $0x2,%eax
+  802289:	8d 90 00 90 80 00    	lea    0x809000(%eax),%edx
+  80228f:	c7 80 00 90 80 00 04 	movl   $0x4,0x809000(%eax)
+  802296:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802299:	8b 45 18             	mov    0x18(%ebp),%eax
+  80229c:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80229f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8022a6:	83 c4 08             	add    $0x8,%esp
+  8022a9:	53                   	push   %ebx
+  8022aa:	56                   	push   %esi
+  8022ab:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8022ae:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022b1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022b6:	e8 7f f4 ff ff       	call   80173a <fsring_post>
+  8022bb:	89 c3                	mov    %eax,%ebx
+  8022bd:	83 c4 10             	add    $0x10,%esp
+}
+  8022c0:	89 d8                	mov    %ebx,%eax
+  8022c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022c5:	5b                   	pop    %ebx
+  8022c6:	5e                   	pop    %esi
+  8022c7:	5d                   	pop    %ebp
+  8022c8:	c3                   	ret
+		return -E_INVAL;
+  8022c9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8022ce:	eb f0                	jmp    8022c0 <fsring_write+0x93>
+
+008022d0 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8022d0:	55                   	push   %ebp
+  8022d1:	89 e5                	mov    %esp,%ebp
+  8022d3:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8022d6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8022d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022dc:	e8 17 f8 ff ff       	call   801af8 <fsring_slot>
+  8022e1:	85 c0                	test   %eax,%eax
+  8022e3:	78 4c                	js     802331 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8022e5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8022ea:	89 c1                	mov    %eax,%ecx
+  8022ec:	d3 e2                	shl    %cl,%edx
+  8022ee:	09 15 c0 90 80 00    	or     %edx,0x8090c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8022f4:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8022f7:	c1 e2 02             	shl    $0x2,%edx
+  8022fa:	8d 8a 00 90 80 00    	lea    0x809000(%edx),%ecx
+  802300:	c7 82 00 90 80 00 05 	movl   $0x5,0x809000(%edx)
+  802307:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80230a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80230d:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802310:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802313:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802316:	83 ec 08             	sub    $0x8,%esp
+  802319:	50                   	push   %eax
+  80231a:	6a 00                	push   $0x0
+  80231c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802321:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802324:	b8 05 00 00 00       	mov    $0x5,%eax
+  802329:	e8 0c f4 ff ff       	call   80173a <fsring_post>
+  80232e:	83 c4 10             	add    $0x10,%esp
+}
+  802331:	c9                   	leave
+  802332:	c3                   	ret
+
+00802333 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802333:	55                   	push   %ebp
+  802334:	89 e5                	mov    %esp,%ebp
+  802336:	57                   	push   %edi
+  802337:	56                   	push   %esi
+  802338:	53                   	push   %ebx
+  802339:	83 ec 1c             	sub    $0x1c,%esp
+  80233c:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802340:	a1 00 70 80 00       	mov    0x807000,%eax
+  802345:	8b 40 48             	mov    0x48(%eax),%eax
+  802348:	3b 05 c4 90 80 00    	cmp    0x8090c4,%eax
+  80234e:	74 12                	je     802362 <fsring_reap+0x2f>
+		return 0;
+  802350:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802355:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802358:	5b                   	pop    %ebx
+  802359:	5e                   	pop    %esi
+  80235a:	5f                   	pop    %edi
+  80235b:	5d                   	pop    %ebp
+  80235c:	c3                   	ret
+		sys_yield();
+  80235d:	e8 e4 e8 ff ff       	call   800c46 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802362:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802368:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80236d:	39 c2                	cmp    %eax,%edx
+  80236f:	75 18                	jne    802389 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802371:	84 db                	test   %bl,%bl
+  802373:	0f 84 21 01 00 00    	je     80249a <fsring_reap+0x167>
+  802379:	83 3d c0 90 80 00 00 	cmpl   $0x0,0x8090c0
+  802380:	75 db                	jne    80235d <fsring_reap+0x2a>
+			return 0;
+  802382:	b8 00 00 00 00       	mov    $0x0,%eax
+  802387:	eb cc                	jmp    802355 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802389:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80238e:	83 e0 0f             	and    $0xf,%eax
+  802391:	83 c0 2a             	add    $0x2a,%eax
+  802394:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  80239b:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8023a2:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8023a7:	83 c0 01             	add    $0x1,%eax
+  8023aa:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8023af:	83 fb 0f             	cmp    $0xf,%ebx
+  8023b2:	77 5b                	ja     80240f <fsring_reap+0xdc>
+  8023b4:	be 01 00 00 00       	mov    $0x1,%esi
+  8023b9:	89 d9                	mov    %ebx,%ecx
+  8023bb:	d3 e6                	shl    %cl,%esi
+  8023bd:	89 f0                	mov    %esi,%eax
+  8023bf:	23 05 c0 90 80 00    	and    0x8090c0,%eax
+  8023c5:	74 48                	je     80240f <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8023c7:	89 d8                	mov    %ebx,%eax
+  8023c9:	c1 e0 0c             	shl    $0xc,%eax
+  8023cc:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8023d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8023d5:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8023d8:	8b 04 85 00 90 80 00 	mov    0x809000(,%eax,4),%eax
+  8023df:	83 f8 03             	cmp    $0x3,%eax
+  8023e2:	74 40                	je     802424 <fsring_reap+0xf1>
+  8023e4:	83 f8 05             	cmp    $0x5,%eax
+  8023e7:	74 64                	je     80244d <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8023e9:	f7 d6                	not    %esi
+  8023eb:	21 35 c0 90 80 00    	and    %esi,0x8090c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8023f1:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8023f4:	8b 14 85 04 90 80 00 	mov    0x809004(,%eax,4),%edx
+  8023fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023fe:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802400:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802403:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802405:	b8 01 00 00 00       	mov    $0x1,%eax
+  80240a:	e9 46 ff ff ff       	jmp    802355 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80240f:	53                   	push   %ebx
+  802410:	68 fd 3d 80 00       	push   $0x803dfd
+  802415:	68 8f 02 00 00       	push   $0x28f
+  80241a:	68 d5 3d 80 00       	push   $0x803dd5
+  80241f:	e8 6c dd ff ff       	call   800190 <_panic>
+		if (cqe.cqe_result > 0)
+  802424:	85 ff                	test   %edi,%edi
+  802426:	7e c1                	jle    8023e9 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802428:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80242b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802430:	39 c7                	cmp    %eax,%edi
+  802432:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802435:	50                   	push   %eax
+  802436:	ff 75 e4             	push   -0x1c(%ebp)
+  802439:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80243c:	ff 34 85 08 90 80 00 	push   0x809008(,%eax,4)
+  802443:	e8 97 e5 ff ff       	call   8009df <memmove>
+  802448:	83 c4 10             	add    $0x10,%esp
+  80244b:	eb 9c                	jmp    8023e9 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80244d:	85 ff                	test   %edi,%edi
+  80244f:	75 98                	jne    8023e9 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802451:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802454:	8b 0c 85 08 90 80 00 	mov    0x809008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80245b:	83 ec 08             	sub    $0x8,%esp
+  80245e:	ff 75 e4             	push   -0x1c(%ebp)
+  802461:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802464:	51                   	push   %ecx
+  802465:	e8 ef e3 ff ff       	call   800859 <strcpy>
+			st->st_size = ret->ret_size;
+  80246a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80246d:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802473:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802476:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80247c:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802482:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802488:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  80248f:	40 80 00 
+  802492:	83 c4 10             	add    $0x10,%esp
+  802495:	e9 4f ff ff ff       	jmp    8023e9 <fsring_reap+0xb6>
+			return 0;
+  80249a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249f:	e9 b1 fe ff ff       	jmp    802355 <fsring_reap+0x22>
+
+008024a4 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8024a4:	55                   	push   %ebp
+  8024a5:	89 e5                	mov    %esp,%ebp
+  8024a7:	57                   	push   %edi
+  8024a8:	56                   	push   %esi
+  8024a9:	53                   	push   %ebx
+  8024aa:	83 ec 28             	sub    $0x28,%esp
+  8024ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8024b0:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8024b3:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8024b6:	53                   	push   %ebx
+  8024b7:	e8 62 e3 ff ff       	call   80081e <strlen>
+  8024bc:	83 c4 10             	add    $0x10,%esp
+  8024bf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024c4:	0f 8f 02 01 00 00    	jg     8025cc <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8024ca:	83 ec 08             	sub    $0x8,%esp
+  8024cd:	53                   	push   %ebx
+  8024ce:	68 00 80 80 00       	push   $0x808000
+  8024d3:	e8 81 e3 ff ff       	call   800859 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8024d8:	83 c4 10             	add    $0x10,%esp
+  8024db:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8024e1:	76 69                	jbe    80254c <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8024e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024e6:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8024ec:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8024f1:	29 d1                	sub    %edx,%ecx
+  8024f3:	39 f9                	cmp    %edi,%ecx
+  8024f5:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8024f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024fb:	89 f9                	mov    %edi,%ecx
+  8024fd:	01 c1                	add    %eax,%ecx
+  8024ff:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802502:	eb 0f                	jmp    802513 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802504:	0f b6 10             	movzbl (%eax),%edx
+  802507:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802509:	05 00 10 00 00       	add    $0x1000,%eax
+  80250e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802513:	39 c8                	cmp    %ecx,%eax
+  802515:	72 ed                	jb     802504 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802517:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80251a:	89 3d 00 84 80 00    	mov    %edi,0x808400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802520:	89 15 04 84 80 00    	mov    %edx,0x808404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802526:	83 ec 0c             	sub    $0xc,%esp
+  802529:	6a 07                	push   $0x7
+  80252b:	89 f9                	mov    %edi,%ecx
+  80252d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802530:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802535:	e8 3f f1 ff ff       	call   801679 <fsipc_pages>
+  80253a:	89 c7                	mov    %eax,%edi
+  80253c:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  80253f:	85 f6                	test   %esi,%esi
+  802541:	74 7f                	je     8025c2 <file_slurp+0x11e>
+  802543:	8d 43 01             	lea    0x1(%ebx),%eax
+  802546:	85 ff                	test   %edi,%edi
+  802548:	79 3c                	jns    802586 <file_slurp+0xe2>
+  80254a:	eb 76                	jmp    8025c2 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  80254c:	89 3d 00 84 80 00    	mov    %edi,0x808400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802552:	ba 00 00 00 00       	mov    $0x0,%edx
+  802557:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80255c:	e8 ba f2 ff ff       	call   80181b <fsipc>
+  802561:	89 c7                	mov    %eax,%edi
+  802563:	85 c0                	test   %eax,%eax
+  802565:	7e d8                	jle    80253f <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802567:	83 ec 04             	sub    $0x4,%esp
+  80256a:	50                   	push   %eax
+  80256b:	68 08 80 80 00       	push   $0x808008
+  802570:	ff 75 0c             	push   0xc(%ebp)
+  802573:	e8 67 e4 ff ff       	call   8009df <memmove>
+  802578:	83 c4 10             	add    $0x10,%esp
+  80257b:	eb c2                	jmp    80253f <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  80257d:	80 fa 2f             	cmp    $0x2f,%dl
+  802580:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802583:	83 c0 01             	add    $0x1,%eax
+  802586:	89 c1                	mov    %eax,%ecx
+  802588:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  80258c:	84 d2                	test   %dl,%dl
+  80258e:	75 ed                	jne    80257d <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802590:	83 ec 04             	sub    $0x4,%esp
+  802593:	68 80 00 00 00       	push   $0x80
+  802598:	53                   	push   %ebx
+  802599:	56                   	push   %esi
+  80259a:	e8 30 e3 ff ff       	call   8008cf <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  80259f:	a1 00 80 80 00       	mov    0x808000,%eax
+  8025a4:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8025aa:	a1 04 80 80 00       	mov    0x808004,%eax
+  8025af:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8025b5:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  8025bc:	40 80 00 
+  8025bf:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8025c2:	89 f8                	mov    %edi,%eax
+  8025c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025c7:	5b                   	pop    %ebx
+  8025c8:	5e                   	pop    %esi
+  8025c9:	5f                   	pop    %edi
+  8025ca:	5d                   	pop    %ebp
+  8025cb:	c3                   	ret
+		return -E_BAD_PATH;
+  8025cc:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8025d1:	eb ef                	jmp    8025c2 <file_slurp+0x11e>
+
+008025d3 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8025d3:	55                   	push   %ebp
+  8025d4:	89 e5                	mov    %esp,%ebp
+  8025d6:	53                   	push   %ebx
+  8025d7:	83 ec 10             	sub    $0x10,%esp
+  8025da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8025dd:	53                   	push   %ebx
+  8025de:	e8 3b e2 ff ff       	call   80081e <strlen>
+  8025e3:	83 c4 10             	add    $0x10,%esp
+  8025e6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025eb:	7f 25                	jg     802612 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8025ed:	83 ec 08             	sub    $0x8,%esp
+  8025f0:	53                   	push   %ebx
+  8025f1:	68 00 80 80 00       	push   $0x808000
+  8025f6:	e8 5e e2 ff ff       	call   800859 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8025fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802600:	b8 07 00 00 00       	mov    $0x7,%eax
+  802605:	e8 11 f2 ff ff       	call   80181b <fsipc>
+  80260a:	83 c4 10             	add    $0x10,%esp
+}
+  80260d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802610:	c9                   	leave
+  802611:	c3                   	ret
+		return -E_BAD_PATH;
+  802612:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802617:	eb f4                	jmp    80260d <remove+0x3a>
+
+00802619 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802619:	55                   	push   %ebp
+  80261a:	89 e5                	mov    %esp,%ebp
+  80261c:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80261f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802624:	b8 08 00 00 00       	mov    $0x8,%eax
+  802629:	e8 ed f1 ff ff       	call   80181b <fsipc>
+}
+  80262e:	c9                   	leave
+  80262f:	c3                   	ret
+
+00802630 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802630:	55                   	push   %ebp
+  802631:	89 e5                	mov    %esp,%ebp
+  802633:	57                   	push   %edi
+  802634:	56                   	push   %esi
+  802635:	53                   	push   %ebx
+  802636:	83 ec 18             	sub    $0x18,%esp
+  802639:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80263c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80263f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802642:	57                   	push   %edi
+  802643:	e8 d6 e1 ff ff       	call   80081e <strlen>
+  802648:	83 c4 10             	add    $0x10,%esp
+  80264b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802650:	7f 4c                	jg     80269e <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802652:	83 ec 08             	sub    $0x8,%esp
+  802655:	57                   	push   %edi
+  802656:	68 00 80 80 00       	push   $0x808000
+  80265b:	e8 f9 e1 ff ff       	call   800859 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802660:	ba 00 00 00 00       	mov    $0x0,%edx
+  802665:	b8 10 00 00 00       	mov    $0x10,%eax
+  80266a:	e8 ac f1 ff ff       	call   80181b <fsipc>
+  80266f:	83 c4 10             	add    $0x10,%esp
+  802672:	85 c0                	test   %eax,%eax
+  802674:	78 20                	js     802696 <defrag+0x66>
+		return r;
+	if (before)
+  802676:	85 f6                	test   %esi,%esi
+  802678:	74 07                	je     802681 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  80267a:	a1 00 80 80 00       	mov    0x808000,%eax
+  80267f:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802681:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802686:	85 db                	test   %ebx,%ebx
+  802688:	74 0c                	je     802696 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  80268a:	a1 04 80 80 00       	mov    0x808004,%eax
+  80268f:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802691:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802696:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802699:	5b                   	pop    %ebx
+  80269a:	5e                   	pop    %esi
+  80269b:	5f                   	pop    %edi
+  80269c:	5d                   	pop    %ebp
+  80269d:	c3                   	ret
+		return -E_BAD_PATH;
+  80269e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8026a3:	eb f1                	jmp    802696 <defrag+0x66>
+
+008026a5 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  8026a5:	55                   	push   %ebp
+  8026a6:	89 e5                	mov    %esp,%ebp
+  8026a8:	53                   	push   %ebx
+  8026a9:	83 ec 04             	sub    $0x4,%esp
+  8026ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  8026af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b4:	b8 11 00 00 00       	mov    $0x11,%eax
+  8026b9:	e8 5d f1 ff ff       	call   80181b <fsipc>
+  8026be:	85 c0                	test   %eax,%eax
+  8026c0:	78 34                	js     8026f6 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  8026c2:	a1 00 80 80 00       	mov    0x808000,%eax
+  8026c7:	89 03                	mov    %eax,(%ebx)
+  8026c9:	a1 04 80 80 00       	mov    0x808004,%eax
+  8026ce:	89 43 04             	mov    %eax,0x4(%ebx)
+  8026d1:	a1 08 80 80 00       	mov    0x808008,%eax
+  8026d6:	89 43 08             	mov    %eax,0x8(%ebx)
+  8026d9:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  8026de:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8026e1:	a1 10 80 80 00       	mov    0x808010,%eax
+  8026e6:	89 43 10             	mov    %eax,0x10(%ebx)
+  8026e9:	a1 14 80 80 00       	mov    0x808014,%eax
+  8026ee:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  8026f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026f9:	c9                   	leave
+  8026fa:	c3                   	ret
+
+008026fb <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  8026fb:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8026ff:	7f 01                	jg     802702 <writebuf+0x7>
+  802701:	c3                   	ret
+{
+  802702:	55                   	push   %ebp
+  802703:	89 e5                	mov    %esp,%ebp
+  802705:	53                   	push   %ebx
+  802706:	83 ec 08             	sub    $0x8,%esp
+  802709:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  80270b:	ff 70 04             	push   0x4(%eax)
+  80270e:	8d 40 10             	lea    0x10(%eax),%eax
+  802711:	50                   	push   %eax
+  802712:	ff 33                	push   (%ebx)
+  802714:	e8 fe ec ff ff       	call   801417 <write>
+		if (result > 0)
+  802719:	83 c4 10             	add    $0x10,%esp
+  80271c:	85 c0                	test   %eax,%eax
+  80271e:	7e 03                	jle    802723 <writebuf+0x28>
+			b->result += result;
+  802720:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802723:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802726:	74 0d                	je     802735 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802728:	85 c0                	test   %eax,%eax
+  80272a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80272f:	0f 4f c2             	cmovg  %edx,%eax
+  802732:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802735:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802738:	c9                   	leave
+  802739:	c3                   	ret
+
+0080273a <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80273a:	55                   	push   %ebp
+  80273b:	89 e5                	mov    %esp,%ebp
+  80273d:	53                   	push   %ebx
+  80273e:	83 ec 04             	sub    $0x4,%esp
+  802741:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802744:	8b 53 04             	mov    0x4(%ebx),%edx
+  802747:	8d 42 01             	lea    0x1(%edx),%eax
+  80274a:	89 43 04             	mov    %eax,0x4(%ebx)
+  80274d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802750:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802754:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802759:	74 05                	je     802760 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  80275b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80275e:	c9                   	leave
+  80275f:	c3                   	ret
+		writebuf(b);
+  802760:	89 d8                	mov    %ebx,%eax
+  802762:	e8 94 ff ff ff       	call   8026fb <writebuf>
+		b->idx = 0;
+  802767:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  80276e:	eb eb                	jmp    80275b <putch+0x21>
+
+00802770 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802770:	55                   	push   %ebp
+  802771:	89 e5                	mov    %esp,%ebp
+  802773:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  802779:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277c:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  802782:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  802789:	00 00 00 
+	b.result = 0;
+  80278c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802793:	00 00 00 
+	b.error = 1;
+  802796:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  80279d:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8027a0:	ff 75 10             	push   0x10(%ebp)
+  8027a3:	ff 75 0c             	push   0xc(%ebp)
+  8027a6:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8027ac:	50                   	push   %eax
+  8027ad:	68 3a 27 80 00       	push   $0x80273a
+  8027b2:	e8 ab db ff ff       	call   800362 <vprintfmt>
+	if (b.idx > 0)
+  8027b7:	83 c4 10             	add    $0x10,%esp
+  8027ba:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8027c1:	7f 12                	jg     8027d5 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8027c3:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8027c9:	85 c0                	test   %eax,%eax
+  8027cb:	75 06                	jne    8027d3 <vfprintf+0x63>
+  8027cd:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8027d3:	c9                   	leave
+  8027d4:	c3                   	ret
+		writebuf(&b);
+  8027d5:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8027db:	e8 1b ff ff ff       	call   8026fb <writebuf>
+  8027e0:	eb e1                	jmp    8027c3 <vfprintf+0x53>
+
+008027e2 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8027e2:	55                   	push   %ebp
+  8027e3:	89 e5                	mov    %esp,%ebp
+  8027e5:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8027e8:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8027eb:	50                   	push   %eax
+  8027ec:	ff 75 0c             	push   0xc(%ebp)
+  8027ef:	ff 75 08             	push   0x8(%ebp)
+  8027f2:	e8 79 ff ff ff       	call   802770 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8027f7:	c9                   	leave
+  8027f8:	c3                   	ret
+
+008027f9 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8027f9:	55                   	push   %ebp
+  8027fa:	89 e5                	mov    %esp,%ebp
+  8027fc:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8027ff:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  802802:	50                   	push   %eax
+  802803:	ff 75 08             	push   0x8(%ebp)
+  802806:	6a 01                	push   $0x1
+  802808:	e8 63 ff ff ff       	call   802770 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80280d:	c9                   	leave
+  80280e:	c3                   	ret
+
+0080280f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80280f:	55                   	push   %ebp
+  802810:	89 e5                	mov    %esp,%ebp
+  802812:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802815:	68 16 3e 80 00       	push   $0x803e16
+  80281a:	ff 75 0c             	push   0xc(%ebp)
+  80281d:	e8 37 e0 ff ff       	call   800859 <strcpy>
+	return 0;
+}
+  802822:	b8 00 00 00 00       	mov    $0x0,%eax
+  802827:	c9                   	leave
+  802828:	c3                   	ret
+
+00802829 <devsock_close>:
+{
+  802829:	55                   	push   %ebp
+  80282a:	89 e5                	mov    %esp,%ebp
+  80282c:	53                   	push   %ebx
+  80282d:	83 ec 10             	sub    $0x10,%esp
+  802830:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802833:	53                   	push   %ebx
+  802834:	e8 f4 0d 00 00       	call   80362d <pageref>
+  802839:	89 c2                	mov    %eax,%edx
+  80283b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80283e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802843:	83 fa 01             	cmp    $0x1,%edx
+  802846:	74 05                	je     80284d <devsock_close+0x24>
+}
+  802848:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80284b:	c9                   	leave
+  80284c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80284d:	83 ec 0c             	sub    $0xc,%esp
+  802850:	ff 73 0c             	push   0xc(%ebx)
+  802853:	e8 b7 02 00 00       	call   802b0f <nsipc_close>
+  802858:	83 c4 10             	add    $0x10,%esp
+  80285b:	eb eb                	jmp    802848 <devsock_close+0x1f>
+
+0080285d <devsock_write>:
+{
+  80285d:	55                   	push   %ebp
+  80285e:	89 e5                	mov    %esp,%ebp
+  802860:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802863:	6a 00                	push   $0x0
+  802865:	ff 75 10             	push   0x10(%ebp)
+  802868:	ff 75 0c             	push   0xc(%ebp)
+  80286b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80286e:	ff 70 0c             	push   0xc(%eax)
+  802871:	e8 79 03 00 00       	call   802bef <nsipc_send>
+}
+  802876:	c9                   	leave
+  802877:	c3                   	ret
+
+00802878 <devsock_read>:
+{
+  802878:	55                   	push   %ebp
+  802879:	89 e5                	mov    %esp,%ebp
+  80287b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80287e:	6a 00                	push   $0x0
+  802880:	ff 75 10             	push   0x10(%ebp)
+  802883:	ff 75 0c             	push   0xc(%ebp)
+  802886:	8b 45 08             	mov    0x8(%ebp),%eax
+  802889:	ff 70 0c             	push   0xc(%eax)
+  80288c:	e8 ef 02 00 00       	call   802b80 <nsipc_recv>
+}
+  802891:	c9                   	leave
+  802892:	c3                   	ret
+
+00802893 <fd2sockid>:
+{
+  802893:	55                   	push   %ebp
+  802894:	89 e5                	mov    %esp,%ebp
+  802896:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802899:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80289c:	52                   	push   %edx
+  80289d:	50                   	push   %eax
+  80289e:	e8 40 e8 ff ff       	call   8010e3 <fd_lookup>
+  8028a3:	83 c4 10             	add    $0x10,%esp
+  8028a6:	85 c0                	test   %eax,%eax
+  8028a8:	78 10                	js     8028ba <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8028aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028ad:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  8028b3:	39 08                	cmp    %ecx,(%eax)
+  8028b5:	75 05                	jne    8028bc <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8028b7:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8028ba:	c9                   	leave
+  8028bb:	c3                   	ret
+		return -E_NOT_SUPP;
+  8028bc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028c1:	eb f7                	jmp    8028ba <fd2sockid+0x27>
+
+008028c3 <alloc_sockfd>:
+{
+  8028c3:	55                   	push   %ebp
+  8028c4:	89 e5                	mov    %esp,%ebp
+  8028c6:	56                   	push   %esi
+  8028c7:	53                   	push   %ebx
+  8028c8:	83 ec 1c             	sub    $0x1c,%esp
+  8028cb:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8028cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028d0:	50                   	push   %eax
+  8028d1:	e8 b7 e7 ff ff       	call   80108d <fd_alloc>
+  8028d6:	89 c3                	mov    %eax,%ebx
+  8028d8:	83 c4 10             	add    $0x10,%esp
+  8028db:	85 c0                	test   %eax,%eax
+  8028dd:	78 43                	js     802922 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8028df:	83 ec 04             	sub    $0x4,%esp
+  8028e2:	68 07 04 00 00       	push   $0x407
+  8028e7:	ff 75 f4             	push   -0xc(%ebp)
+  8028ea:	6a 00                	push   $0x0
+  8028ec:	e8 74 e3 ff ff       	call   800c65 <sys_page_alloc>
+  8028f1:	89 c3                	mov    %eax,%ebx
+  8028f3:	83 c4 10             	add    $0x10,%esp
+  8028f6:	85 c0                	test   %eax,%eax
+  8028f8:	78 28                	js     802922 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8028fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028fd:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802903:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802905:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802908:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80290f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802912:	83 ec 0c             	sub    $0xc,%esp
+  802915:	50                   	push   %eax
+  802916:	e8 4b e7 ff ff       	call   801066 <fd2num>
+  80291b:	89 c3                	mov    %eax,%ebx
+  80291d:	83 c4 10             	add    $0x10,%esp
+  802920:	eb 0c                	jmp    80292e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802922:	83 ec 0c             	sub    $0xc,%esp
+  802925:	56                   	push   %esi
+  802926:	e8 e4 01 00 00       	call   802b0f <nsipc_close>
+		return r;
+  80292b:	83 c4 10             	add    $0x10,%esp
+}
+  80292e:	89 d8                	mov    %ebx,%eax
+  802930:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802933:	5b                   	pop    %ebx
+  802934:	5e                   	pop    %esi
+  802935:	5d                   	pop    %ebp
+  802936:	c3                   	ret
+
+00802937 <accept>:
+{
+  802937:	55                   	push   %ebp
+  802938:	89 e5                	mov    %esp,%ebp
+  80293a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80293d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802940:	e8 4e ff ff ff       	call   802893 <fd2sockid>
+  802945:	85 c0                	test   %eax,%eax
+  802947:	78 1b                	js     802964 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802949:	83 ec 04             	sub    $0x4,%esp
+  80294c:	ff 75 10             	push   0x10(%ebp)
+  80294f:	ff 75 0c             	push   0xc(%ebp)
+  802952:	50                   	push   %eax
+  802953:	e8 0e 01 00 00       	call   802a66 <nsipc_accept>
+  802958:	83 c4 10             	add    $0x10,%esp
+  80295b:	85 c0                	test   %eax,%eax
+  80295d:	78 05                	js     802964 <accept+0x2d>
+	return alloc_sockfd(r);
+  80295f:	e8 5f ff ff ff       	call   8028c3 <alloc_sockfd>
+}
+  802964:	c9                   	leave
+  802965:	c3                   	ret
+
+00802966 <bind>:
+{
+  802966:	55                   	push   %ebp
+  802967:	89 e5                	mov    %esp,%ebp
+  802969:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80296c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80296f:	e8 1f ff ff ff       	call   802893 <fd2sockid>
+  802974:	85 c0                	test   %eax,%eax
+  802976:	78 12                	js     80298a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802978:	83 ec 04             	sub    $0x4,%esp
+  80297b:	ff 75 10             	push   0x10(%ebp)
+  80297e:	ff 75 0c             	push   0xc(%ebp)
+  802981:	50                   	push   %eax
+  802982:	e8 31 01 00 00       	call   802ab8 <nsipc_bind>
+  802987:	83 c4 10             	add    $0x10,%esp
+}
+  80298a:	c9                   	leave
+  80298b:	c3                   	ret
+
+0080298c <shutdown>:
+{
+  80298c:	55                   	push   %ebp
+  80298d:	89 e5                	mov    %esp,%ebp
+  80298f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802992:	8b 45 08             	mov    0x8(%ebp),%eax
+  802995:	e8 f9 fe ff ff       	call   802893 <fd2sockid>
+  80299a:	85 c0                	test   %eax,%eax
+  80299c:	78 0f                	js     8029ad <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80299e:	83 ec 08             	sub    $0x8,%esp
+  8029a1:	ff 75 0c             	push   0xc(%ebp)
+  8029a4:	50                   	push   %eax
+  8029a5:	e8 43 01 00 00       	call   802aed <nsipc_shutdown>
+  8029aa:	83 c4 10             	add    $0x10,%esp
+}
+  8029ad:	c9                   	leave
+  8029ae:	c3                   	ret
+
+008029af <connect>:
+{
+  8029af:	55                   	push   %ebp
+  8029b0:	89 e5                	mov    %esp,%ebp
+  8029b2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b8:	e8 d6 fe ff ff       	call   802893 <fd2sockid>
+  8029bd:	85 c0                	test   %eax,%eax
+  8029bf:	78 12                	js     8029d3 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8029c1:	83 ec 04             	sub    $0x4,%esp
+  8029c4:	ff 75 10             	push   0x10(%ebp)
+  8029c7:	ff 75 0c             	push   0xc(%ebp)
+  8029ca:	50                   	push   %eax
+  8029cb:	e8 59 01 00 00       	call   802b29 <nsipc_connect>
+  8029d0:	83 c4 10             	add    $0x10,%esp
+}
+  8029d3:	c9                   	leave
+  8029d4:	c3                   	ret
+
+008029d5 <listen>:
+{
+  8029d5:	55                   	push   %ebp
+  8029d6:	89 e5                	mov    %esp,%ebp
+  8029d8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029de:	e8 b0 fe ff ff       	call   802893 <fd2sockid>
+  8029e3:	85 c0                	test   %eax,%eax
+  8029e5:	78 0f                	js     8029f6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8029e7:	83 ec 08             	sub    $0x8,%esp
+  8029ea:	ff 75 0c             	push   0xc(%ebp)
+  8029ed:	50                   	push   %eax
+  8029ee:	e8 6b 01 00 00       	call   802b5e <nsipc_listen>
+  8029f3:	83 c4 10             	add    $0x10,%esp
+}
+  8029f6:	c9                   	leave
+  8029f7:	c3                   	ret
+
+008029f8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8029f8:	55                   	push   %ebp
+  8029f9:	89 e5                	mov    %esp,%ebp
+  8029fb:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8029fe:	ff 75 10             	push   0x10(%ebp)
+  802a01:	ff 75 0c             	push   0xc(%ebp)
+  802a04:	ff 75 08             	push   0x8(%ebp)
+  802a07:	e8 41 02 00 00       	call   802c4d <nsipc_socket>
+  802a0c:	83 c4 10             	add    $0x10,%esp
+  802a0f:	85 c0                	test   %eax,%eax
+  802a11:	78 05                	js     802a18 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802a13:	e8 ab fe ff ff       	call   8028c3 <alloc_sockfd>
+}
+  802a18:	c9                   	leave
+  802a19:	c3                   	ret
+
+00802a1a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a1a:	55                   	push   %ebp
+  802a1b:	89 e5                	mov    %esp,%ebp
+  802a1d:	53                   	push   %ebx
+  802a1e:	83 ec 04             	sub    $0x4,%esp
+  802a21:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802a23:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  802a2a:	74 26                	je     802a52 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802a2c:	6a 07                	push   $0x7
+  802a2e:	68 00 a0 80 00       	push   $0x80a000
+  802a33:	53                   	push   %ebx
+  802a34:	ff 35 00 b0 80 00    	push   0x80b000
+  802a3a:	e8 76 0a 00 00       	call   8034b5 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802a3f:	83 c4 0c             	add    $0xc,%esp
+  802a42:	6a 00                	push   $0x0
+  802a44:	6a 00                	push   $0x0
+  802a46:	6a 00                	push   $0x0
+  802a48:	e8 fd 09 00 00       	call   80344a <ipc_recv>
+}
+  802a4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a50:	c9                   	leave
+  802a51:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a52:	83 ec 0c             	sub    $0xc,%esp
+  802a55:	6a 02                	push   $0x2
+  802a57:	e8 92 0b 00 00       	call   8035ee <ipc_find_env>
+  802a5c:	a3 00 b0 80 00       	mov    %eax,0x80b000
+  802a61:	83 c4 10             	add    $0x10,%esp
+  802a64:	eb c6                	jmp    802a2c <nsipc+0x12>
+
+00802a66 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802a66:	55                   	push   %ebp
+  802a67:	89 e5                	mov    %esp,%ebp
+  802a69:	56                   	push   %esi
+  802a6a:	53                   	push   %ebx
+  802a6b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802a6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a71:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802a76:	8b 06                	mov    (%esi),%eax
+  802a78:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802a7d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a82:	e8 93 ff ff ff       	call   802a1a <nsipc>
+  802a87:	89 c3                	mov    %eax,%ebx
+  802a89:	85 c0                	test   %eax,%eax
+  802a8b:	79 09                	jns    802a96 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802a8d:	89 d8                	mov    %ebx,%eax
+  802a8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a92:	5b                   	pop    %ebx
+  802a93:	5e                   	pop    %esi
+  802a94:	5d                   	pop    %ebp
+  802a95:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a96:	83 ec 04             	sub    $0x4,%esp
+  802a99:	ff 35 10 a0 80 00    	push   0x80a010
+  802a9f:	68 00 a0 80 00       	push   $0x80a000
+  802aa4:	ff 75 0c             	push   0xc(%ebp)
+  802aa7:	e8 33 df ff ff       	call   8009df <memmove>
+		*addrlen = ret->ret_addrlen;
+  802aac:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802ab1:	89 06                	mov    %eax,(%esi)
+  802ab3:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802ab6:	eb d5                	jmp    802a8d <nsipc_accept+0x27>
+
+00802ab8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802ab8:	55                   	push   %ebp
+  802ab9:	89 e5                	mov    %esp,%ebp
+  802abb:	53                   	push   %ebx
+  802abc:	83 ec 08             	sub    $0x8,%esp
+  802abf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802ac2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac5:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802aca:	53                   	push   %ebx
+  802acb:	ff 75 0c             	push   0xc(%ebp)
+  802ace:	68 04 a0 80 00       	push   $0x80a004
+  802ad3:	e8 07 df ff ff       	call   8009df <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802ad8:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_BIND);
+  802ade:	b8 02 00 00 00       	mov    $0x2,%eax
+  802ae3:	e8 32 ff ff ff       	call   802a1a <nsipc>
+}
+  802ae8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aeb:	c9                   	leave
+  802aec:	c3                   	ret
+
+00802aed <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802aed:	55                   	push   %ebp
+  802aee:	89 e5                	mov    %esp,%ebp
+  802af0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802af3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af6:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.shutdown.req_how = how;
+  802afb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802afe:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_SHUTDOWN);
+  802b03:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b08:	e8 0d ff ff ff       	call   802a1a <nsipc>
+}
+  802b0d:	c9                   	leave
+  802b0e:	c3                   	ret
+
+00802b0f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802b0f:	55                   	push   %ebp
+  802b10:	89 e5                	mov    %esp,%ebp
+  802b12:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802b15:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b18:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_CLOSE);
+  802b1d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b22:	e8 f3 fe ff ff       	call   802a1a <nsipc>
+}
+  802b27:	c9                   	leave
+  802b28:	c3                   	ret
+
+00802b29 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802b29:	55                   	push   %ebp
+  802b2a:	89 e5                	mov    %esp,%ebp
+  802b2c:	53                   	push   %ebx
+  802b2d:	83 ec 08             	sub    $0x8,%esp
+  802b30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802b33:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b36:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802b3b:	53                   	push   %ebx
+  802b3c:	ff 75 0c             	push   0xc(%ebp)
+  802b3f:	68 04 a0 80 00       	push   $0x80a004
+  802b44:	e8 96 de ff ff       	call   8009df <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802b49:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_CONNECT);
+  802b4f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802b54:	e8 c1 fe ff ff       	call   802a1a <nsipc>
+}
+  802b59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b5c:	c9                   	leave
+  802b5d:	c3                   	ret
+
+00802b5e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802b5e:	55                   	push   %ebp
+  802b5f:	89 e5                	mov    %esp,%ebp
+  802b61:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802b64:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b67:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.listen.req_backlog = backlog;
+  802b6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b6f:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_LISTEN);
+  802b74:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b79:	e8 9c fe ff ff       	call   802a1a <nsipc>
+}
+  802b7e:	c9                   	leave
+  802b7f:	c3                   	ret
+
+00802b80 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802b80:	55                   	push   %ebp
+  802b81:	89 e5                	mov    %esp,%ebp
+  802b83:	56                   	push   %esi
+  802b84:	53                   	push   %ebx
+  802b85:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802b88:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b8b:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.recv.req_len = len;
+  802b90:	89 35 04 a0 80 00    	mov    %esi,0x80a004
+	nsipcbuf.recv.req_flags = flags;
+  802b96:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b99:	a3 08 a0 80 00       	mov    %eax,0x80a008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b9e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ba3:	e8 72 fe ff ff       	call   802a1a <nsipc>
+  802ba8:	89 c3                	mov    %eax,%ebx
+  802baa:	85 c0                	test   %eax,%eax
+  802bac:	78 22                	js     802bd0 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802bae:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802bb3:	39 c6                	cmp    %eax,%esi
+  802bb5:	0f 4e c6             	cmovle %esi,%eax
+  802bb8:	39 c3                	cmp    %eax,%ebx
+  802bba:	7f 1d                	jg     802bd9 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802bbc:	83 ec 04             	sub    $0x4,%esp
+  802bbf:	53                   	push   %ebx
+  802bc0:	68 00 a0 80 00       	push   $0x80a000
+  802bc5:	ff 75 0c             	push   0xc(%ebp)
+  802bc8:	e8 12 de ff ff       	call   8009df <memmove>
+  802bcd:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802bd0:	89 d8                	mov    %ebx,%eax
+  802bd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bd5:	5b                   	pop    %ebx
+  802bd6:	5e                   	pop    %esi
+  802bd7:	5d                   	pop    %ebp
+  802bd8:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802bd9:	68 22 3e 80 00       	push   $0x803e22
+  802bde:	68 c0 3d 80 00       	push   $0x803dc0
+  802be3:	6a 62                	push   $0x62
+  802be5:	68 37 3e 80 00       	push   $0x803e37
+  802bea:	e8 a1 d5 ff ff       	call   800190 <_panic>
+
+00802bef <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802bef:	55                   	push   %ebp
+  802bf0:	89 e5                	mov    %esp,%ebp
+  802bf2:	53                   	push   %ebx
+  802bf3:	83 ec 04             	sub    $0x4,%esp
+  802bf6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802bf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bfc:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	assert(size < 1600);
+  802c01:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802c07:	7f 2e                	jg     802c37 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802c09:	83 ec 04             	sub    $0x4,%esp
+  802c0c:	53                   	push   %ebx
+  802c0d:	ff 75 0c             	push   0xc(%ebp)
+  802c10:	68 0c a0 80 00       	push   $0x80a00c
+  802c15:	e8 c5 dd ff ff       	call   8009df <memmove>
+	nsipcbuf.send.req_size = size;
+  802c1a:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	nsipcbuf.send.req_flags = flags;
+  802c20:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c23:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SEND);
+  802c28:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c2d:	e8 e8 fd ff ff       	call   802a1a <nsipc>
+}
+  802c32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c35:	c9                   	leave
+  802c36:	c3                   	ret
+	assert(size < 1600);
+  802c37:	68 43 3e 80 00       	push   $0x803e43
+  802c3c:	68 c0 3d 80 00       	push   $0x803dc0
+  802c41:	6a 6d                	push   $0x6d
+  802c43:	68 37 3e 80 00       	push   $0x803e37
+  802c48:	e8 43 d5 ff ff       	call   800190 <_panic>
+
+00802c4d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802c4d:	55                   	push   %ebp
+  802c4e:	89 e5                	mov    %esp,%ebp
+  802c50:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802c53:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c56:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.socket.req_type = type;
+  802c5b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c5e:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.socket.req_protocol = protocol;
+  802c63:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c66:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SOCKET);
+  802c6b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c70:	e8 a5 fd ff ff       	call   802a1a <nsipc>
+}
+  802c75:	c9                   	leave
+  802c76:	c3                   	ret
+
+00802c77 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c77:	55                   	push   %ebp
+  802c78:	89 e5                	mov    %esp,%ebp
+  802c7a:	56                   	push   %esi
+  802c7b:	53                   	push   %ebx
+  802c7c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802c7f:	83 ec 0c             	sub    $0xc,%esp
+  802c82:	ff 75 08             	push   0x8(%ebp)
+  802c85:	e8 ec e3 ff ff       	call   801076 <fd2data>
+  802c8a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802c8c:	83 c4 08             	add    $0x8,%esp
+  802c8f:	68 4f 3e 80 00       	push   $0x803e4f
+  802c94:	53                   	push   %ebx
+  802c95:	e8 bf db ff ff       	call   800859 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802c9a:	8b 46 04             	mov    0x4(%esi),%eax
+  802c9d:	2b 06                	sub    (%esi),%eax
+  802c9f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802ca5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802cac:	00 00 00 
+	stat->st_dev = &devpipe;
+  802caf:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802cb6:	40 80 00 
+	return 0;
+}
+  802cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cc1:	5b                   	pop    %ebx
+  802cc2:	5e                   	pop    %esi
+  802cc3:	5d                   	pop    %ebp
+  802cc4:	c3                   	ret
+
+00802cc5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802cc5:	55                   	push   %ebp
+  802cc6:	89 e5                	mov    %esp,%ebp
+  802cc8:	53                   	push   %ebx
+  802cc9:	83 ec 0c             	sub    $0xc,%esp
+  802ccc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802ccf:	53                   	push   %ebx
+  802cd0:	6a 00                	push   $0x0
+  802cd2:	e8 1b e0 ff ff       	call   800cf2 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802cd7:	89 1c 24             	mov    %ebx,(%esp)
+  802cda:	e8 97 e3 ff ff       	call   801076 <fd2data>
+  802cdf:	83 c4 08             	add    $0x8,%esp
+  802ce2:	50                   	push   %eax
+  802ce3:	6a 00                	push   $0x0
+  802ce5:	e8 08 e0 ff ff       	call   800cf2 <sys_page_unmap>
+}
+  802cea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ced:	c9                   	leave
+  802cee:	c3                   	ret
+
+00802cef <_pipeisclosed>:
+{
+  802cef:	55                   	push   %ebp
+  802cf0:	89 e5                	mov    %esp,%ebp
+  802cf2:	57                   	push   %edi
+  802cf3:	56                   	push   %esi
+  802cf4:	53                   	push   %ebx
+  802cf5:	83 ec 1c             	sub    $0x1c,%esp
+  802cf8:	89 c7                	mov    %eax,%edi
+  802cfa:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802cfc:	a1 00 70 80 00       	mov    0x807000,%eax
+  802d01:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802d04:	83 ec 0c             	sub    $0xc,%esp
+  802d07:	57                   	push   %edi
+  802d08:	e8 20 09 00 00       	call   80362d <pageref>
+  802d0d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d10:	89 34 24             	mov    %esi,(%esp)
+  802d13:	e8 15 09 00 00       	call   80362d <pageref>
+		nn = thisenv->env_runs;
+  802d18:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  802d1e:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802d21:	83 c4 10             	add    $0x10,%esp
+  802d24:	39 cb                	cmp    %ecx,%ebx
+  802d26:	74 1b                	je     802d43 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802d28:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d2b:	75 cf                	jne    802cfc <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802d2d:	8b 42 58             	mov    0x58(%edx),%eax
+  802d30:	6a 01                	push   $0x1
+  802d32:	50                   	push   %eax
+  802d33:	53                   	push   %ebx
+  802d34:	68 56 3e 80 00       	push   $0x803e56
+  802d39:	e8 2d d5 ff ff       	call   80026b <cprintf>
+  802d3e:	83 c4 10             	add    $0x10,%esp
+  802d41:	eb b9                	jmp    802cfc <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802d43:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d46:	0f 94 c0             	sete   %al
+  802d49:	0f b6 c0             	movzbl %al,%eax
+}
+  802d4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d4f:	5b                   	pop    %ebx
+  802d50:	5e                   	pop    %esi
+  802d51:	5f                   	pop    %edi
+  802d52:	5d                   	pop    %ebp
+  802d53:	c3                   	ret
+
+00802d54 <devpipe_write>:
+{
+  802d54:	55                   	push   %ebp
+  802d55:	89 e5                	mov    %esp,%ebp
+  802d57:	57                   	push   %edi
+  802d58:	56                   	push   %esi
+  802d59:	53                   	push   %ebx
+  802d5a:	83 ec 28             	sub    $0x28,%esp
+  802d5d:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802d60:	56                   	push   %esi
+  802d61:	e8 10 e3 ff ff       	call   801076 <fd2data>
+  802d66:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802d68:	83 c4 10             	add    $0x10,%esp
+  802d6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d70:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802d73:	75 09                	jne    802d7e <devpipe_write+0x2a>
+	return i;
+  802d75:	89 f8                	mov    %edi,%eax
+  802d77:	eb 23                	jmp    802d9c <devpipe_write+0x48>
+			sys_yield();
+  802d79:	e8 c8 de ff ff       	call   800c46 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802d7e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d81:	8b 0b                	mov    (%ebx),%ecx
+  802d83:	8d 51 20             	lea    0x20(%ecx),%edx
+  802d86:	39 d0                	cmp    %edx,%eax
+  802d88:	72 1a                	jb     802da4 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802d8a:	89 da                	mov    %ebx,%edx
+  802d8c:	89 f0                	mov    %esi,%eax
+  802d8e:	e8 5c ff ff ff       	call   802cef <_pipeisclosed>
+  802d93:	85 c0                	test   %eax,%eax
+  802d95:	74 e2                	je     802d79 <devpipe_write+0x25>
+				return 0;
+  802d97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d9f:	5b                   	pop    %ebx
+  802da0:	5e                   	pop    %esi
+  802da1:	5f                   	pop    %edi
+  802da2:	5d                   	pop    %ebp
+  802da3:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802da4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802da7:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802dab:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802dae:	89 c2                	mov    %eax,%edx
+  802db0:	c1 fa 1f             	sar    $0x1f,%edx
+  802db3:	89 d1                	mov    %edx,%ecx
+  802db5:	c1 e9 1b             	shr    $0x1b,%ecx
+  802db8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802dbb:	83 e2 1f             	and    $0x1f,%edx
+  802dbe:	29 ca                	sub    %ecx,%edx
+  802dc0:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802dc4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802dc8:	83 c0 01             	add    $0x1,%eax
+  802dcb:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802dce:	83 c7 01             	add    $0x1,%edi
+  802dd1:	eb 9d                	jmp    802d70 <devpipe_write+0x1c>
+
+00802dd3 <devpipe_read>:
+{
+  802dd3:	55                   	push   %ebp
+  802dd4:	89 e5                	mov    %esp,%ebp
+  802dd6:	57                   	push   %edi
+  802dd7:	56                   	push   %esi
+  802dd8:	53                   	push   %ebx
+  802dd9:	83 ec 18             	sub    $0x18,%esp
+  802ddc:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802ddf:	57                   	push   %edi
+  802de0:	e8 91 e2 ff ff       	call   801076 <fd2data>
+  802de5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802de7:	83 c4 10             	add    $0x10,%esp
+  802dea:	be 00 00 00 00       	mov    $0x0,%esi
+  802def:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802df2:	75 13                	jne    802e07 <devpipe_read+0x34>
+	return i;
+  802df4:	89 f0                	mov    %esi,%eax
+  802df6:	eb 02                	jmp    802dfa <devpipe_read+0x27>
+				return i;
+  802df8:	89 f0                	mov    %esi,%eax
+}
+  802dfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dfd:	5b                   	pop    %ebx
+  802dfe:	5e                   	pop    %esi
+  802dff:	5f                   	pop    %edi
+  802e00:	5d                   	pop    %ebp
+  802e01:	c3                   	ret
+			sys_yield();
+  802e02:	e8 3f de ff ff       	call   800c46 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802e07:	8b 03                	mov    (%ebx),%eax
+  802e09:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802e0c:	75 18                	jne    802e26 <devpipe_read+0x53>
+			if (i > 0)
+  802e0e:	85 f6                	test   %esi,%esi
+  802e10:	75 e6                	jne    802df8 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802e12:	89 da                	mov    %ebx,%edx
+  802e14:	89 f8                	mov    %edi,%eax
+  802e16:	e8 d4 fe ff ff       	call   802cef <_pipeisclosed>
+  802e1b:	85 c0                	test   %eax,%eax
+  802e1d:	74 e3                	je     802e02 <devpipe_read+0x2f>
+				return 0;
+  802e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e24:	eb d4                	jmp    802dfa <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802e26:	99                   	cltd
+  802e27:	c1 ea 1b             	shr    $0x1b,%edx
+  802e2a:	01 d0                	add    %edx,%eax
+  802e2c:	83 e0 1f             	and    $0x1f,%eax
+  802e2f:	29 d0                	sub    %edx,%eax
+  802e31:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802e36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e39:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802e3c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802e3f:	83 c6 01             	add    $0x1,%esi
+  802e42:	eb ab                	jmp    802def <devpipe_read+0x1c>
+
+00802e44 <pipe>:
+{
+  802e44:	55                   	push   %ebp
+  802e45:	89 e5                	mov    %esp,%ebp
+  802e47:	56                   	push   %esi
+  802e48:	53                   	push   %ebx
+  802e49:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802e4c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e4f:	50                   	push   %eax
+  802e50:	e8 38 e2 ff ff       	call   80108d <fd_alloc>
+  802e55:	89 c3                	mov    %eax,%ebx
+  802e57:	83 c4 10             	add    $0x10,%esp
+  802e5a:	85 c0                	test   %eax,%eax
+  802e5c:	0f 88 23 01 00 00    	js     802f85 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e62:	83 ec 04             	sub    $0x4,%esp
+  802e65:	68 07 04 00 00       	push   $0x407
+  802e6a:	ff 75 f4             	push   -0xc(%ebp)
+  802e6d:	6a 00                	push   $0x0
+  802e6f:	e8 f1 dd ff ff       	call   800c65 <sys_page_alloc>
+  802e74:	89 c3                	mov    %eax,%ebx
+  802e76:	83 c4 10             	add    $0x10,%esp
+  802e79:	85 c0                	test   %eax,%eax
+  802e7b:	0f 88 04 01 00 00    	js     802f85 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802e81:	83 ec 0c             	sub    $0xc,%esp
+  802e84:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802e87:	50                   	push   %eax
+  802e88:	e8 00 e2 ff ff       	call   80108d <fd_alloc>
+  802e8d:	89 c3                	mov    %eax,%ebx
+  802e8f:	83 c4 10             	add    $0x10,%esp
+  802e92:	85 c0                	test   %eax,%eax
+  802e94:	0f 88 db 00 00 00    	js     802f75 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e9a:	83 ec 04             	sub    $0x4,%esp
+  802e9d:	68 07 04 00 00       	push   $0x407
+  802ea2:	ff 75 f0             	push   -0x10(%ebp)
+  802ea5:	6a 00                	push   $0x0
+  802ea7:	e8 b9 dd ff ff       	call   800c65 <sys_page_alloc>
+  802eac:	89 c3                	mov    %eax,%ebx
+  802eae:	83 c4 10             	add    $0x10,%esp
+  802eb1:	85 c0                	test   %eax,%eax
+  802eb3:	0f 88 bc 00 00 00    	js     802f75 <pipe+0x131>
+	va = fd2data(fd0);
+  802eb9:	83 ec 0c             	sub    $0xc,%esp
+  802ebc:	ff 75 f4             	push   -0xc(%ebp)
+  802ebf:	e8 b2 e1 ff ff       	call   801076 <fd2data>
+  802ec4:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ec6:	83 c4 0c             	add    $0xc,%esp
+  802ec9:	68 07 04 00 00       	push   $0x407
+  802ece:	50                   	push   %eax
+  802ecf:	6a 00                	push   $0x0
+  802ed1:	e8 8f dd ff ff       	call   800c65 <sys_page_alloc>
+  802ed6:	89 c3                	mov    %eax,%ebx
+  802ed8:	83 c4 10             	add    $0x10,%esp
+  802edb:	85 c0                	test   %eax,%eax
+  802edd:	0f 88 82 00 00 00    	js     802f65 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ee3:	83 ec 0c             	sub    $0xc,%esp
+  802ee6:	ff 75 f0             	push   -0x10(%ebp)
+  802ee9:	e8 88 e1 ff ff       	call   801076 <fd2data>
+  802eee:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802ef5:	50                   	push   %eax
+  802ef6:	6a 00                	push   $0x0
+  802ef8:	56                   	push   %esi
+  802ef9:	6a 00                	push   $0x0
+  802efb:	e8 b0 dd ff ff       	call   800cb0 <sys_page_map>
+  802f00:	89 c3                	mov    %eax,%ebx
+  802f02:	83 c4 20             	add    $0x20,%esp
+  802f05:	85 c0                	test   %eax,%eax
+  802f07:	78 4e                	js     802f57 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802f09:	a1 60 40 80 00       	mov    0x804060,%eax
+  802f0e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f11:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802f13:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f16:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802f1d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802f20:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802f22:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802f25:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802f2c:	83 ec 0c             	sub    $0xc,%esp
+  802f2f:	ff 75 f4             	push   -0xc(%ebp)
+  802f32:	e8 2f e1 ff ff       	call   801066 <fd2num>
+  802f37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f3a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802f3c:	83 c4 04             	add    $0x4,%esp
+  802f3f:	ff 75 f0             	push   -0x10(%ebp)
+  802f42:	e8 1f e1 ff ff       	call   801066 <fd2num>
+  802f47:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f4a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802f4d:	83 c4 10             	add    $0x10,%esp
+  802f50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f55:	eb 2e                	jmp    802f85 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802f57:	83 ec 08             	sub    $0x8,%esp
+  802f5a:	56                   	push   %esi
+  802f5b:	6a 00                	push   $0x0
+  802f5d:	e8 90 dd ff ff       	call   800cf2 <sys_page_unmap>
+  802f62:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802f65:	83 ec 08             	sub    $0x8,%esp
+  802f68:	ff 75 f0             	push   -0x10(%ebp)
+  802f6b:	6a 00                	push   $0x0
+  802f6d:	e8 80 dd ff ff       	call   800cf2 <sys_page_unmap>
+  802f72:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802f75:	83 ec 08             	sub    $0x8,%esp
+  802f78:	ff 75 f4             	push   -0xc(%ebp)
+  802f7b:	6a 00                	push   $0x0
+  802f7d:	e8 70 dd ff ff       	call   800cf2 <sys_page_unmap>
+  802f82:	83 c4 10             	add    $0x10,%esp
+}
+  802f85:	89 d8                	mov    %ebx,%eax
+  802f87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f8a:	5b                   	pop    %ebx
+  802f8b:	5e                   	pop    %esi
+  802f8c:	5d                   	pop    %ebp
+  802f8d:	c3                   	ret
+
+00802f8e <pipeisclosed>:
+{
+  802f8e:	55                   	push   %ebp
+  802f8f:	89 e5                	mov    %esp,%ebp
+  802f91:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f97:	50                   	push   %eax
+  802f98:	ff 75 08             	push   0x8(%ebp)
+  802f9b:	e8 43 e1 ff ff       	call   8010e3 <fd_lookup>
+  802fa0:	83 c4 10             	add    $0x10,%esp
+  802fa3:	85 c0                	test   %eax,%eax
+  802fa5:	78 18                	js     802fbf <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802fa7:	83 ec 0c             	sub    $0xc,%esp
+  802faa:	ff 75 f4             	push   -0xc(%ebp)
+  802fad:	e8 c4 e0 ff ff       	call   801076 <fd2data>
+  802fb2:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802fb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fb7:	e8 33 fd ff ff       	call   802cef <_pipeisclosed>
+  802fbc:	83 c4 10             	add    $0x10,%esp
+}
+  802fbf:	c9                   	leave
+  802fc0:	c3                   	ret
+
+00802fc1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802fc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc6:	c3                   	ret
+
+00802fc7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802fc7:	55                   	push   %ebp
+  802fc8:	89 e5                	mov    %esp,%ebp
+  802fca:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802fcd:	68 6e 3e 80 00       	push   $0x803e6e
+  802fd2:	ff 75 0c             	push   0xc(%ebp)
+  802fd5:	e8 7f d8 ff ff       	call   800859 <strcpy>
+	return 0;
+}
+  802fda:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fdf:	c9                   	leave
+  802fe0:	c3                   	ret
+
+00802fe1 <devcons_write>:
+{
+  802fe1:	55                   	push   %ebp
+  802fe2:	89 e5                	mov    %esp,%ebp
+  802fe4:	57                   	push   %edi
+  802fe5:	56                   	push   %esi
+  802fe6:	53                   	push   %ebx
+  802fe7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802fed:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802ff2:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802ff8:	eb 2e                	jmp    803028 <devcons_write+0x47>
+		m = n - tot;
+  802ffa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ffd:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802fff:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803004:	39 c3                	cmp    %eax,%ebx
+  803006:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803009:	83 ec 04             	sub    $0x4,%esp
+  80300c:	53                   	push   %ebx
+  80300d:	89 f0                	mov    %esi,%eax
+  80300f:	03 45 0c             	add    0xc(%ebp),%eax
+  803012:	50                   	push   %eax
+  803013:	57                   	push   %edi
+  803014:	e8 c6 d9 ff ff       	call   8009df <memmove>
+		sys_cputs(buf, m);
+  803019:	83 c4 08             	add    $0x8,%esp
+  80301c:	53                   	push   %ebx
+  80301d:	57                   	push   %edi
+  80301e:	e8 66 db ff ff       	call   800b89 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803023:	01 de                	add    %ebx,%esi
+  803025:	83 c4 10             	add    $0x10,%esp
+  803028:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80302b:	72 cd                	jb     802ffa <devcons_write+0x19>
+}
+  80302d:	89 f0                	mov    %esi,%eax
+  80302f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803032:	5b                   	pop    %ebx
+  803033:	5e                   	pop    %esi
+  803034:	5f                   	pop    %edi
+  803035:	5d                   	pop    %ebp
+  803036:	c3                   	ret
+
+00803037 <devcons_read>:
+{
+  803037:	55                   	push   %ebp
+  803038:	89 e5                	mov    %esp,%ebp
+  80303a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80303d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803042:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803046:	75 07                	jne    80304f <devcons_read+0x18>
+  803048:	eb 1f                	jmp    803069 <devcons_read+0x32>
+		sys_yield();
+  80304a:	e8 f7 db ff ff       	call   800c46 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80304f:	e8 5b db ff ff       	call   800baf <sys_cgetc>
+  803054:	85 c0                	test   %eax,%eax
+  803056:	74 f2                	je     80304a <devcons_read+0x13>
+	if (c < 0)
+  803058:	78 0f                	js     803069 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80305a:	83 f8 04             	cmp    $0x4,%eax
+  80305d:	74 0c                	je     80306b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80305f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803062:	88 02                	mov    %al,(%edx)
+	return 1;
+  803064:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803069:	c9                   	leave
+  80306a:	c3                   	ret
+		return 0;
+  80306b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803070:	eb f7                	jmp    803069 <devcons_read+0x32>
+
+00803072 <cputchar>:
+{
+  803072:	55                   	push   %ebp
+  803073:	89 e5                	mov    %esp,%ebp
+  803075:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803078:	8b 45 08             	mov    0x8(%ebp),%eax
+  80307b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80307e:	6a 01                	push   $0x1
+  803080:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803083:	50                   	push   %eax
+  803084:	e8 00 db ff ff       	call   800b89 <sys_cputs>
+}
+  803089:	83 c4 10             	add    $0x10,%esp
+  80308c:	c9                   	leave
+  80308d:	c3                   	ret
+
+0080308e <getchar>:
+{
+  80308e:	55                   	push   %ebp
+  80308f:	89 e5                	mov    %esp,%ebp
+  803091:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803094:	6a 01                	push   $0x1
+  803096:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803099:	50                   	push   %eax
+  80309a:	6a 00                	push   $0x0
+  80309c:	e8 a8 e2 ff ff       	call   801349 <read>
+	if (r < 0)
+  8030a1:	83 c4 10             	add    $0x10,%esp
+  8030a4:	85 c0                	test   %eax,%eax
+  8030a6:	78 06                	js     8030ae <getchar+0x20>
+	if (r < 1)
+  8030a8:	74 06                	je     8030b0 <getchar+0x22>
+	return c;
+  8030aa:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8030ae:	c9                   	leave
+  8030af:	c3                   	ret
+		return -E_EOF;
+  8030b0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8030b5:	eb f7                	jmp    8030ae <getchar+0x20>
+
+008030b7 <iscons>:
+{
+  8030b7:	55                   	push   %ebp
+  8030b8:	89 e5                	mov    %esp,%ebp
+  8030ba:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8030bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030c0:	50                   	push   %eax
+  8030c1:	ff 75 08             	push   0x8(%ebp)
+  8030c4:	e8 1a e0 ff ff       	call   8010e3 <fd_lookup>
+  8030c9:	83 c4 10             	add    $0x10,%esp
+  8030cc:	85 c0                	test   %eax,%eax
+  8030ce:	78 11                	js     8030e1 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8030d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030d3:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8030d9:	39 10                	cmp    %edx,(%eax)
+  8030db:	0f 94 c0             	sete   %al
+  8030de:	0f b6 c0             	movzbl %al,%eax
+}
+  8030e1:	c9                   	leave
+  8030e2:	c3                   	ret
+
+008030e3 <opencons>:
+{
+  8030e3:	55                   	push   %ebp
+  8030e4:	89 e5                	mov    %esp,%ebp
+  8030e6:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8030e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030ec:	50                   	push   %eax
+  8030ed:	e8 9b df ff ff       	call   80108d <fd_alloc>
+  8030f2:	83 c4 10             	add    $0x10,%esp
+  8030f5:	85 c0                	test   %eax,%eax
+  8030f7:	78 3a                	js     803133 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8030f9:	83 ec 04             	sub    $0x4,%esp
+  8030fc:	68 07 04 00 00       	push   $0x407
+  803101:	ff 75 f4             	push   -0xc(%ebp)
+  803104:	6a 00                	push   $0x0
+  803106:	e8 5a db ff ff       	call   800c65 <sys_page_alloc>
+  80310b:	83 c4 10             	add    $0x10,%esp
+  80310e:	85 c0                	test   %eax,%eax
+  803110:	78 21                	js     803133 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803112:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803115:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80311b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80311d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803120:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803127:	83 ec 0c             	sub    $0xc,%esp
+  80312a:	50                   	push   %eax
+  80312b:	e8 36 df ff ff       	call   801066 <fd2num>
+  803130:	83 c4 10             	add    $0x10,%esp
+}
+  803133:	c9                   	leave
+  803134:	c3                   	ret
+
+00803135 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  803135:	55                   	push   %ebp
+  803136:	89 e5                	mov    %esp,%ebp
+  803138:	57                   	push   %edi
+  803139:	56                   	push   %esi
+  80313a:	53                   	push   %ebx
+  80313b:	83 ec 20             	sub    $0x20,%esp
+  80313e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803141:	89 d7                	mov    %edx,%edi
+  803143:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  803145:	51                   	push   %ecx
+  803146:	68 00 f0 7f 00       	push   $0x7ff000
+  80314b:	6a 00                	push   $0x0
+  80314d:	e8 13 db ff ff       	call   800c65 <sys_page_alloc>
+  803152:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803154:	83 c4 10             	add    $0x10,%esp
+  803157:	85 c0                	test   %eax,%eax
+  803159:	78 45                	js     8031a0 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  80315b:	83 ec 04             	sub    $0x4,%esp
+  80315e:	68 00 10 00 00       	push   $0x1000
+  803163:	57                   	push   %edi
+  803164:	68 00 f0 7f 00       	push   $0x7ff000
+  803169:	e8 71 d8 ff ff       	call   8009df <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  80316e:	89 34 24             	mov    %esi,(%esp)
+  803171:	57                   	push   %edi
+  803172:	ff 75 e4             	push   -0x1c(%ebp)
+  803175:	68 00 f0 7f 00       	push   $0x7ff000
+  80317a:	6a 00                	push   $0x0
+  80317c:	e8 2f db ff ff       	call   800cb0 <sys_page_map>
+  803181:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803183:	83 c4 20             	add    $0x20,%esp
+  803186:	85 c0                	test   %eax,%eax
+  803188:	78 16                	js     8031a0 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80318a:	83 ec 08             	sub    $0x8,%esp
+  80318d:	68 00 f0 7f 00       	push   $0x7ff000
+  803192:	6a 00                	push   $0x0
+  803194:	e8 59 db ff ff       	call   800cf2 <sys_page_unmap>
+  803199:	83 c4 10             	add    $0x10,%esp
+  80319c:	85 c0                	test   %eax,%eax
+  80319e:	75 0a                	jne    8031aa <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8031a0:	89 d8                	mov    %ebx,%eax
+  8031a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031a5:	5b                   	pop    %ebx
+  8031a6:	5e                   	pop    %esi
+  8031a7:	5f                   	pop    %edi
+  8031a8:	5d                   	pop    %ebp
+  8031a9:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8031aa:	68 7c 3e 80 00       	push   $0x803e7c
+  8031af:	68 c0 3d 80 00       	push   $0x803dc0
+  8031b4:	6a 1b                	push   $0x1b
+  8031b6:	68 f4 3e 80 00       	push   $0x803ef4
+  8031bb:	e8 d0 cf ff ff       	call   800190 <_panic>
+
+008031c0 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8031c0:	55                   	push   %ebp
+  8031c1:	89 e5                	mov    %esp,%ebp
+  8031c3:	53                   	push   %ebx
+  8031c4:	83 ec 04             	sub    $0x4,%esp
+  8031c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8031ca:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8031cc:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  8031d0:	74 21                	je     8031f3 <pgfault+0x33>
+  8031d2:	89 d0                	mov    %edx,%eax
+  8031d4:	c1 e8 16             	shr    $0x16,%eax
+  8031d7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8031de:	a8 01                	test   $0x1,%al
+  8031e0:	74 11                	je     8031f3 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  8031e2:	89 d0                	mov    %edx,%eax
+  8031e4:	c1 e8 0c             	shr    $0xc,%eax
+  8031e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8031ee:	f6 c4 08             	test   $0x8,%ah
+  8031f1:	75 17                	jne    80320a <pgfault+0x4a>
+		if (pgfault_next) {
+  8031f3:	a1 04 b0 80 00       	mov    0x80b004,%eax
+  8031f8:	85 c0                	test   %eax,%eax
+  8031fa:	74 27                	je     803223 <pgfault+0x63>
+			pgfault_next(utf);
+  8031fc:	83 ec 0c             	sub    $0xc,%esp
+  8031ff:	53                   	push   %ebx
+  803200:	ff d0                	call   *%eax
+			return;
+  803202:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803205:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803208:	c9                   	leave
+  803209:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  80320a:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803210:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80321a:	e8 16 ff ff ff       	call   803135 <copy_page_to>
+  80321f:	85 c0                	test   %eax,%eax
+  803221:	79 e2                	jns    803205 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803223:	a1 00 70 80 00       	mov    0x807000,%eax
+  803228:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  80322b:	ff 73 28             	push   0x28(%ebx)
+  80322e:	ff 33                	push   (%ebx)
+  803230:	50                   	push   %eax
+  803231:	68 a0 3e 80 00       	push   $0x803ea0
+  803236:	e8 30 d0 ff ff       	call   80026b <cprintf>
+	sys_env_destroy(0);
+  80323b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803242:	e8 8f d9 ff ff       	call   800bd6 <sys_env_destroy>
+  803247:	83 c4 10             	add    $0x10,%esp
+  80324a:	eb b9                	jmp    803205 <pgfault+0x45>
+
+0080324c <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  80324c:	55                   	push   %ebp
+  80324d:	89 e5                	mov    %esp,%ebp
+  80324f:	53                   	push   %ebx
+  803250:	83 ec 04             	sub    $0x4,%esp
+  803253:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803256:	a1 08 b0 80 00       	mov    0x80b008,%eax
+  80325b:	3d c0 31 80 00       	cmp    $0x8031c0,%eax
+  803260:	74 15                	je     803277 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803262:	a3 04 b0 80 00       	mov    %eax,0x80b004
+		set_pgfault_handler(pgfault);
+  803267:	83 ec 0c             	sub    $0xc,%esp
+  80326a:	68 c0 31 80 00       	push   $0x8031c0
+  80326f:	e8 fb 03 00 00       	call   80366f <set_pgfault_handler>
+  803274:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803277:	83 ec 0c             	sub    $0xc,%esp
+  80327a:	68 05 08 00 00       	push   $0x805
+  80327f:	53                   	push   %ebx
+  803280:	6a 00                	push   $0x0
+  803282:	53                   	push   %ebx
+  803283:	6a 00                	push   $0x0
+  803285:	e8 26 da ff ff       	call   800cb0 <sys_page_map>
+}
+  80328a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80328d:	c9                   	leave
+  80328e:	c3                   	ret
+
+0080328f <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80328f:	55                   	push   %ebp
+  803290:	89 e5                	mov    %esp,%ebp
+  803292:	57                   	push   %edi
+  803293:	56                   	push   %esi
+  803294:	53                   	push   %ebx
+  803295:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  803298:	68 c0 31 80 00       	push   $0x8031c0
+  80329d:	e8 cd 03 00 00       	call   80366f <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8032a2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8032a7:	cd 30                	int    $0x30
+  8032a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8032ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8032af:	83 c4 10             	add    $0x10,%esp
+  8032b2:	85 c0                	test   %eax,%eax
+  8032b4:	0f 88 6b 01 00 00    	js     803425 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8032ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8032bf:	75 37                	jne    8032f8 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8032c1:	e8 59 d9 ff ff       	call   800c1f <sys_getenvid>
+  8032c6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8032cb:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8032d1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8032d6:	a3 00 70 80 00       	mov    %eax,0x807000
+		return 0;
+  8032db:	e9 45 01 00 00       	jmp    803425 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8032e0:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8032e6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8032ec:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8032f2:	0f 87 ba 00 00 00    	ja     8033b2 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8032f8:	89 d8                	mov    %ebx,%eax
+  8032fa:	c1 e8 16             	shr    $0x16,%eax
+  8032fd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803304:	a8 01                	test   $0x1,%al
+  803306:	74 d8                	je     8032e0 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803308:	89 d8                	mov    %ebx,%eax
+  80330a:	c1 e8 0c             	shr    $0xc,%eax
+  80330d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803314:	f6 c2 01             	test   $0x1,%dl
+  803317:	74 cd                	je     8032e6 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803319:	89 da                	mov    %ebx,%edx
+  80331b:	80 e6 df             	and    $0xdf,%dh
+  80331e:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803324:	74 c0                	je     8032e6 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803326:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803328:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80332f:	f6 c6 04             	test   $0x4,%dh
+  803332:	75 53                	jne    803387 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803334:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80333b:	f6 c6 08             	test   $0x8,%dh
+  80333e:	75 0c                	jne    80334c <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803340:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803347:	f6 c2 02             	test   $0x2,%dl
+  80334a:	74 3b                	je     803387 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80334c:	83 ec 0c             	sub    $0xc,%esp
+  80334f:	68 05 08 00 00       	push   $0x805
+  803354:	57                   	push   %edi
+  803355:	ff 75 e4             	push   -0x1c(%ebp)
+  803358:	57                   	push   %edi
+  803359:	6a 00                	push   $0x0
+  80335b:	e8 50 d9 ff ff       	call   800cb0 <sys_page_map>
+  803360:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803362:	83 c4 20             	add    $0x20,%esp
+  803365:	85 c0                	test   %eax,%eax
+  803367:	0f 88 a7 00 00 00    	js     803414 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80336d:	83 ec 0c             	sub    $0xc,%esp
+  803370:	68 05 08 00 00       	push   $0x805
+  803375:	57                   	push   %edi
+  803376:	6a 00                	push   $0x0
+  803378:	57                   	push   %edi
+  803379:	6a 00                	push   $0x0
+  80337b:	e8 30 d9 ff ff       	call   800cb0 <sys_page_map>
+  803380:	89 c6                	mov    %eax,%esi
+	return r;
+  803382:	83 c4 20             	add    $0x20,%esp
+  803385:	eb 21                	jmp    8033a8 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803387:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80338e:	83 ec 0c             	sub    $0xc,%esp
+  803391:	25 07 0e 00 00       	and    $0xe07,%eax
+  803396:	50                   	push   %eax
+  803397:	57                   	push   %edi
+  803398:	ff 75 e4             	push   -0x1c(%ebp)
+  80339b:	57                   	push   %edi
+  80339c:	6a 00                	push   $0x0
+  80339e:	e8 0d d9 ff ff       	call   800cb0 <sys_page_map>
+  8033a3:	89 c6                	mov    %eax,%esi
+  8033a5:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8033a8:	85 f6                	test   %esi,%esi
+  8033aa:	0f 89 36 ff ff ff    	jns    8032e6 <fork+0x57>
+  8033b0:	eb 62                	jmp    803414 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8033b2:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8033b7:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8033bc:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8033bf:	89 f8                	mov    %edi,%eax
+  8033c1:	e8 6f fd ff ff       	call   803135 <copy_page_to>
+  8033c6:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8033c8:	85 c0                	test   %eax,%eax
+  8033ca:	78 48                	js     803414 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8033cc:	83 ec 04             	sub    $0x4,%esp
+  8033cf:	6a 07                	push   $0x7
+  8033d1:	68 00 f0 bf ee       	push   $0xeebff000
+  8033d6:	57                   	push   %edi
+  8033d7:	e8 89 d8 ff ff       	call   800c65 <sys_page_alloc>
+  8033dc:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8033de:	83 c4 10             	add    $0x10,%esp
+  8033e1:	85 c0                	test   %eax,%eax
+  8033e3:	78 2f                	js     803414 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8033e5:	a1 00 70 80 00       	mov    0x807000,%eax
+  8033ea:	8b 40 64             	mov    0x64(%eax),%eax
+  8033ed:	83 ec 08             	sub    $0x8,%esp
+  8033f0:	50                   	push   %eax
+  8033f1:	57                   	push   %edi
+  8033f2:	e8 d9 d9 ff ff       	call   800dd0 <sys_env_set_pgfault_upcall>
+  8033f7:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8033f9:	83 c4 10             	add    $0x10,%esp
+  8033fc:	85 c0                	test   %eax,%eax
+  8033fe:	78 14                	js     803414 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803400:	83 ec 08             	sub    $0x8,%esp
+  803403:	6a 02                	push   $0x2
+  803405:	57                   	push   %edi
+  803406:	e8 31 d9 ff ff       	call   800d3c <sys_env_set_status>
+  80340b:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80340d:	83 c4 10             	add    $0x10,%esp
+  803410:	85 c0                	test   %eax,%eax
+  803412:	79 11                	jns    803425 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803414:	83 ec 0c             	sub    $0xc,%esp
+  803417:	ff 75 e0             	push   -0x20(%ebp)
+  80341a:	e8 b7 d7 ff ff       	call   800bd6 <sys_env_destroy>
+	return r;
+  80341f:	83 c4 10             	add    $0x10,%esp
+  803422:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803425:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803428:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80342b:	5b                   	pop    %ebx
+  80342c:	5e                   	pop    %esi
+  80342d:	5f                   	pop    %edi
+  80342e:	5d                   	pop    %ebp
+  80342f:	c3                   	ret
+
+00803430 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803430:	55                   	push   %ebp
+  803431:	89 e5                	mov    %esp,%ebp
+  803433:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803436:	68 ff 3e 80 00       	push   $0x803eff
+  80343b:	68 bf 00 00 00       	push   $0xbf
+  803440:	68 f4 3e 80 00       	push   $0x803ef4
+  803445:	e8 46 cd ff ff       	call   800190 <_panic>
+
+0080344a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80344a:	55                   	push   %ebp
+  80344b:	89 e5                	mov    %esp,%ebp
+  80344d:	56                   	push   %esi
+  80344e:	53                   	push   %ebx
+  80344f:	8b 75 08             	mov    0x8(%ebp),%esi
+  803452:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803455:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803458:	85 c0                	test   %eax,%eax
+  80345a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80345f:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803462:	83 ec 0c             	sub    $0xc,%esp
+  803465:	50                   	push   %eax
+  803466:	e8 42 da ff ff       	call   800ead <sys_ipc_recv>
+	if (from_env_store)
+  80346b:	83 c4 10             	add    $0x10,%esp
+  80346e:	85 f6                	test   %esi,%esi
+  803470:	74 14                	je     803486 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803472:	ba 00 00 00 00       	mov    $0x0,%edx
+  803477:	85 c0                	test   %eax,%eax
+  803479:	75 09                	jne    803484 <ipc_recv+0x3a>
+  80347b:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  803481:	8b 52 74             	mov    0x74(%edx),%edx
+  803484:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803486:	85 db                	test   %ebx,%ebx
+  803488:	74 25                	je     8034af <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80348a:	85 c0                	test   %eax,%eax
+  80348c:	74 0d                	je     80349b <ipc_recv+0x51>
+  80348e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803494:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803497:	5b                   	pop    %ebx
+  803498:	5e                   	pop    %esi
+  803499:	5d                   	pop    %ebp
+  80349a:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80349b:	a1 00 70 80 00       	mov    0x807000,%eax
+  8034a0:	8b 40 78             	mov    0x78(%eax),%eax
+  8034a3:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8034a5:	a1 00 70 80 00       	mov    0x807000,%eax
+  8034aa:	8b 40 70             	mov    0x70(%eax),%eax
+  8034ad:	eb e5                	jmp    803494 <ipc_recv+0x4a>
+  8034af:	85 c0                	test   %eax,%eax
+  8034b1:	75 e1                	jne    803494 <ipc_recv+0x4a>
+  8034b3:	eb f0                	jmp    8034a5 <ipc_recv+0x5b>
+
+008034b5 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8034b5:	55                   	push   %ebp
+  8034b6:	89 e5                	mov    %esp,%ebp
+  8034b8:	57                   	push   %edi
+  8034b9:	56                   	push   %esi
+  8034ba:	53                   	push   %ebx
+  8034bb:	83 ec 0c             	sub    $0xc,%esp
+  8034be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8034c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8034c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8034c7:	85 db                	test   %ebx,%ebx
+  8034c9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8034ce:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8034d1:	ff 75 14             	push   0x14(%ebp)
+  8034d4:	53                   	push   %ebx
+  8034d5:	56                   	push   %esi
+  8034d6:	57                   	push   %edi
+  8034d7:	e8 3e d9 ff ff       	call   800e1a <sys_ipc_try_send>
+  8034dc:	83 c4 10             	add    $0x10,%esp
+  8034df:	85 c0                	test   %eax,%eax
+  8034e1:	74 22                	je     803505 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8034e3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8034e6:	75 07                	jne    8034ef <ipc_send+0x3a>
+		sys_yield();
+  8034e8:	e8 59 d7 ff ff       	call   800c46 <sys_yield>
+  8034ed:	eb e2                	jmp    8034d1 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8034ef:	68 15 3f 80 00       	push   $0x803f15
+  8034f4:	68 c0 3d 80 00       	push   $0x803dc0
+  8034f9:	6a 39                	push   $0x39
+  8034fb:	68 2a 3f 80 00       	push   $0x803f2a
+  803500:	e8 8b cc ff ff       	call   800190 <_panic>
+	}
+}
+  803505:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803508:	5b                   	pop    %ebx
+  803509:	5e                   	pop    %esi
+  80350a:	5f                   	pop    %edi
+  80350b:	5d                   	pop    %ebp
+  80350c:	c3                   	ret
+
+0080350d <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80350d:	55                   	push   %ebp
+  80350e:	89 e5                	mov    %esp,%ebp
+  803510:	57                   	push   %edi
+  803511:	56                   	push   %esi
+  803512:	53                   	push   %ebx
+  803513:	83 ec 10             	sub    $0x10,%esp
+  803516:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803519:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80351c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80351f:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803522:	85 c0                	test   %eax,%eax
+  803524:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803529:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  80352c:	6a 00                	push   $0x0
+  80352e:	ff 33                	push   (%ebx)
+  803530:	50                   	push   %eax
+  803531:	e8 34 d9 ff ff       	call   800e6a <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803536:	83 c4 10             	add    $0x10,%esp
+  803539:	85 c0                	test   %eax,%eax
+  80353b:	75 3c                	jne    803579 <ipc_recvv+0x6c>
+  80353d:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  803543:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803546:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803548:	85 ff                	test   %edi,%edi
+  80354a:	74 4e                	je     80359a <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80354c:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  803552:	8b 52 74             	mov    0x74(%edx),%edx
+  803555:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803557:	85 f6                	test   %esi,%esi
+  803559:	74 18                	je     803573 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80355b:	85 c0                	test   %eax,%eax
+  80355d:	75 2d                	jne    80358c <ipc_recvv+0x7f>
+  80355f:	a1 00 70 80 00       	mov    0x807000,%eax
+  803564:	8b 40 78             	mov    0x78(%eax),%eax
+  803567:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803569:	a1 00 70 80 00       	mov    0x807000,%eax
+  80356e:	8b 40 70             	mov    0x70(%eax),%eax
+  803571:	eb 1f                	jmp    803592 <ipc_recvv+0x85>
+  803573:	85 c0                	test   %eax,%eax
+  803575:	75 1b                	jne    803592 <ipc_recvv+0x85>
+  803577:	eb f0                	jmp    803569 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803579:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80357f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803584:	85 ff                	test   %edi,%edi
+  803586:	75 cd                	jne    803555 <ipc_recvv+0x48>
+	if (perm_store)
+  803588:	85 f6                	test   %esi,%esi
+  80358a:	74 e7                	je     803573 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80358c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803592:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803595:	5b                   	pop    %ebx
+  803596:	5e                   	pop    %esi
+  803597:	5f                   	pop    %edi
+  803598:	5d                   	pop    %ebp
+  803599:	c3                   	ret
+	if (perm_store)
+  80359a:	85 f6                	test   %esi,%esi
+  80359c:	75 bd                	jne    80355b <ipc_recvv+0x4e>
+  80359e:	eb c9                	jmp    803569 <ipc_recvv+0x5c>
+
+008035a0 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8035a0:	55                   	push   %ebp
+  8035a1:	89 e5                	mov    %esp,%ebp
+  8035a3:	57                   	push   %edi
+  8035a4:	56                   	push   %esi
+  8035a5:	53                   	push   %ebx
+  8035a6:	83 ec 0c             	sub    $0xc,%esp
+  8035a9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8035af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8035b2:	ff 75 14             	push   0x14(%ebp)
+  8035b5:	53                   	push   %ebx
+  8035b6:	56                   	push   %esi
+  8035b7:	57                   	push   %edi
+  8035b8:	e8 85 d8 ff ff       	call   800e42 <sys_ipc_try_sendv>
+  8035bd:	83 c4 10             	add    $0x10,%esp
+  8035c0:	85 c0                	test   %eax,%eax
+  8035c2:	74 22                	je     8035e6 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8035c4:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8035c7:	75 07                	jne    8035d0 <ipc_sendv+0x30>
+		sys_yield();
+  8035c9:	e8 78 d6 ff ff       	call   800c46 <sys_yield>
+  8035ce:	eb e2                	jmp    8035b2 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8035d0:	68 15 3f 80 00       	push   $0x803f15
+  8035d5:	68 c0 3d 80 00       	push   $0x803dc0
+  8035da:	6a 5c                	push   $0x5c
+  8035dc:	68 2a 3f 80 00       	push   $0x803f2a
+  8035e1:	e8 aa cb ff ff       	call   800190 <_panic>
+	}
+}
+  8035e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035e9:	5b                   	pop    %ebx
+  8035ea:	5e                   	pop    %esi
+  8035eb:	5f                   	pop    %edi
+  8035ec:	5d                   	pop    %ebp
+  8035ed:	c3                   	ret
+
+008035ee <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8035ee:	55                   	push   %ebp
+  8035ef:	89 e5                	mov    %esp,%ebp
+  8035f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8035f4:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8035f9:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8035ff:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803605:	8b 52 50             	mov    0x50(%edx),%edx
+  803608:	39 ca                	cmp    %ecx,%edx
+  80360a:	74 11                	je     80361d <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80360c:	83 c0 01             	add    $0x1,%eax
+  80360f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803614:	75 e3                	jne    8035f9 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803616:	b8 00 00 00 00       	mov    $0x0,%eax
+  80361b:	eb 0e                	jmp    80362b <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80361d:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803623:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803628:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80362b:	5d                   	pop    %ebp
+  80362c:	c3                   	ret
+
+0080362d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80362d:	55                   	push   %ebp
+  80362e:	89 e5                	mov    %esp,%ebp
+  803630:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803633:	89 c2                	mov    %eax,%edx
+  803635:	c1 ea 16             	shr    $0x16,%edx
+  803638:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80363f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803644:	f6 c1 01             	test   $0x1,%cl
+  803647:	74 22                	je     80366b <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803649:	c1 e8 0c             	shr    $0xc,%eax
+  80364c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803653:	a8 01                	test   $0x1,%al
+  803655:	74 14                	je     80366b <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803657:	c1 e8 0c             	shr    $0xc,%eax
+  80365a:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80365d:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803664:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803668:	0f b7 d2             	movzwl %dx,%edx
+}
+  80366b:	89 d0                	mov    %edx,%eax
+  80366d:	5d                   	pop    %ebp
+  80366e:	c3                   	ret
+
+0080366f <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80366f:	55                   	push   %ebp
+  803670:	89 e5                	mov    %esp,%ebp
+  803672:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803675:	83 3d 08 b0 80 00 00 	cmpl   $0x0,0x80b008
+  80367c:	74 0a                	je     803688 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80367e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803681:	a3 08 b0 80 00       	mov    %eax,0x80b008
+}
+  803686:	c9                   	leave
+  803687:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803688:	83 ec 04             	sub    $0x4,%esp
+  80368b:	6a 07                	push   $0x7
+  80368d:	68 00 f0 bf ee       	push   $0xeebff000
+  803692:	6a 00                	push   $0x0
+  803694:	e8 cc d5 ff ff       	call   800c65 <sys_page_alloc>
+  803699:	83 c4 10             	add    $0x10,%esp
+  80369c:	85 c0                	test   %eax,%eax
+  80369e:	75 2c                	jne    8036cc <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8036a0:	83 ec 08             	sub    $0x8,%esp
+  8036a3:	68 e2 36 80 00       	push   $0x8036e2
+  8036a8:	6a 00                	push   $0x0
+  8036aa:	e8 21 d7 ff ff       	call   800dd0 <sys_env_set_pgfault_upcall>
+  8036af:	83 c4 10             	add    $0x10,%esp
+  8036b2:	85 c0                	test   %eax,%eax
+  8036b4:	74 c8                	je     80367e <set_pgfault_handler+0xf>
+  8036b6:	68 7c 3f 80 00       	push   $0x803f7c
+  8036bb:	68 c0 3d 80 00       	push   $0x803dc0
+  8036c0:	6a 20                	push   $0x20
+  8036c2:	68 ac 3f 80 00       	push   $0x803fac
+  8036c7:	e8 c4 ca ff ff       	call   800190 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8036cc:	68 34 3f 80 00       	push   $0x803f34
+  8036d1:	68 c0 3d 80 00       	push   $0x803dc0
+  8036d6:	6a 1e                	push   $0x1e
+  8036d8:	68 ac 3f 80 00       	push   $0x803fac
+  8036dd:	e8 ae ca ff ff       	call   800190 <_panic>
+
+008036e2 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8036e2:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8036e3:	a1 08 b0 80 00       	mov    0x80b008,%eax
+	call *%eax
+  8036e8:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8036ea:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8036ed:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8036f2:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8036f7:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8036fb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8036fe:	83 c4 08             	add    $0x8,%esp
+	popal
+  803701:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803702:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803705:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803706:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803707:	c3                   	ret
+
+00803708 <dm>:
+  803708:	55                   	push   %ebp
+  803709:	57                   	push   %edi
+  80370a:	56                   	push   %esi
+  80370b:	53                   	push   %ebx
+  80370c:	83 ec 24             	sub    $0x24,%esp
+  80370f:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803713:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803717:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80371b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80371f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803723:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803727:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80372b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803730:	b8 00 00 00 00       	mov    $0x0,%eax
+  803735:	ba 00 00 00 00       	mov    $0x0,%edx
+  80373a:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803741:	00 
+  803742:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803749:	00 
+  80374a:	89 fb                	mov    %edi,%ebx
+  80374c:	eb 08                	jmp    803756 <dm+0x4e>
+  80374e:	83 e9 01             	sub    $0x1,%ecx
+  803751:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803754:	74 68                	je     8037be <dm+0xb6>
+  803756:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80375a:	01 c0                	add    %eax,%eax
+  80375c:	89 c6                	mov    %eax,%esi
+  80375e:	89 d7                	mov    %edx,%edi
+  803760:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803764:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803768:	0f ad d0             	shrd   %cl,%edx,%eax
+  80376b:	d3 ea                	shr    %cl,%edx
+  80376d:	f6 c1 20             	test   $0x20,%cl
+  803770:	74 04                	je     803776 <dm+0x6e>
+  803772:	89 d0                	mov    %edx,%eax
+  803774:	31 d2                	xor    %edx,%edx
+  803776:	83 e0 01             	and    $0x1,%eax
+  803779:	89 04 24             	mov    %eax,(%esp)
+  80377c:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803783:	00 
+  803784:	8b 04 24             	mov    (%esp),%eax
+  803787:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80378b:	09 f0                	or     %esi,%eax
+  80378d:	09 fa                	or     %edi,%edx
+  80378f:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803793:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803797:	39 f0                	cmp    %esi,%eax
+  803799:	89 d5                	mov    %edx,%ebp
+  80379b:	19 fd                	sbb    %edi,%ebp
+  80379d:	72 af                	jb     80374e <dm+0x46>
+  80379f:	29 f0                	sub    %esi,%eax
+  8037a1:	19 fa                	sbb    %edi,%edx
+  8037a3:	89 cf                	mov    %ecx,%edi
+  8037a5:	c1 ef 05             	shr    $0x5,%edi
+  8037a8:	83 e7 01             	and    $0x1,%edi
+  8037ab:	89 fe                	mov    %edi,%esi
+  8037ad:	83 f6 01             	xor    $0x1,%esi
+  8037b0:	d3 e6                	shl    %cl,%esi
+  8037b2:	d3 e7                	shl    %cl,%edi
+  8037b4:	09 74 24 18          	or     %esi,0x18(%esp)
+  8037b8:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8037bc:	eb 90                	jmp    80374e <dm+0x46>
+  8037be:	85 db                	test   %ebx,%ebx
+  8037c0:	74 05                	je     8037c7 <dm+0xbf>
+  8037c2:	89 03                	mov    %eax,(%ebx)
+  8037c4:	89 53 04             	mov    %edx,0x4(%ebx)
+  8037c7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8037cb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8037cf:	83 c4 24             	add    $0x24,%esp
+  8037d2:	5b                   	pop    %ebx
+  8037d3:	5e                   	pop    %esi
+  8037d4:	5f                   	pop    %edi
+  8037d5:	5d                   	pop    %ebp
+  8037d6:	c3                   	ret
+
+008037d7 <__udivdi3>:
+  8037d7:	83 ec 08             	sub    $0x8,%esp
+  8037da:	6a 00                	push   $0x0
+  8037dc:	ff 74 24 1c          	push   0x1c(%esp)
+  8037e0:	ff 74 24 1c          	push   0x1c(%esp)
+  8037e4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8037e8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8037ec:	e8 17 ff ff ff       	call   803708 <dm>
+  8037f1:	83 c4 14             	add    $0x14,%esp
+  8037f4:	c3                   	ret
+
+008037f5 <__umoddi3>:
+  8037f5:	83 ec 18             	sub    $0x18,%esp
+  8037f8:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8037fc:	50                   	push   %eax
+  8037fd:	ff 74 24 2c          	push   0x2c(%esp)
+  803801:	ff 74 24 2c          	push   0x2c(%esp)
+  803805:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803809:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80380d:	e8 f6 fe ff ff       	call   803708 <dm>
+  803812:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803816:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80381a:	83 c4 24             	add    $0x24,%esp
+  80381d:	c3                   	ret
+
+0080381e <__divdi3>:
+  80381e:	53                   	push   %ebx
+  80381f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803823:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803827:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80382b:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80382f:	85 d2                	test   %edx,%edx
+  803831:	78 15                	js     803848 <__divdi3+0x2a>
+  803833:	85 db                	test   %ebx,%ebx
+  803835:	78 34                	js     80386b <__divdi3+0x4d>
+  803837:	83 ec 04             	sub    $0x4,%esp
+  80383a:	6a 00                	push   $0x0
+  80383c:	53                   	push   %ebx
+  80383d:	51                   	push   %ecx
+  80383e:	e8 c5 fe ff ff       	call   803708 <dm>
+  803843:	83 c4 10             	add    $0x10,%esp
+  803846:	eb 21                	jmp    803869 <__divdi3+0x4b>
+  803848:	f7 d8                	neg    %eax
+  80384a:	83 d2 00             	adc    $0x0,%edx
+  80384d:	f7 da                	neg    %edx
+  80384f:	85 db                	test   %ebx,%ebx
+  803851:	78 30                	js     803883 <__divdi3+0x65>
+  803853:	83 ec 04             	sub    $0x4,%esp
+  803856:	6a 00                	push   $0x0
+  803858:	53                   	push   %ebx
+  803859:	51                   	push   %ecx
+  80385a:	e8 a9 fe ff ff       	call   803708 <dm>
+  80385f:	83 c4 10             	add    $0x10,%esp
+  803862:	f7 d8                	neg    %eax
+  803864:	83 d2 00             	adc    $0x0,%edx
+  803867:	f7 da                	neg    %edx
+  803869:	5b                   	pop    %ebx
+  80386a:	c3                   	ret
+  80386b:	83 ec 04             	sub    $0x4,%esp
+  80386e:	6a 00                	push   $0x0
+  803870:	f7 d9                	neg    %ecx
+  803872:	83 d3 00             	adc    $0x0,%ebx
+  803875:	f7 db                	neg    %ebx
+  803877:	53                   	push   %ebx
+  803878:	51                   	push   %ecx
+  803879:	e8 8a fe ff ff       	call   803708 <dm>
+  80387e:	83 c4 10             	add    $0x10,%esp
+  803881:	eb df                	jmp    803862 <__divdi3+0x44>
+  803883:	83 ec 04             	sub    $0x4,%esp
+  803886:	6a 00                	push   $0x0
+  803888:	f7 d9                	neg    %ecx
+  80388a:	83 d3 00             	adc    $0x0,%ebx
+  80388d:	f7 db                	neg    %ebx
+  80388f:	53                   	push   %ebx
+  803890:	51                   	push   %ecx
+  803891:	e8 72 fe ff ff       	call   803708 <dm>
+  803896:	83 c4 10             	add    $0x10,%esp
+  803899:	eb ce                	jmp    803869 <__divdi3+0x4b>
+
+0080389b <__moddi3>:
+  80389b:	55                   	push   %ebp
+  80389c:	57                   	push   %edi
+  80389d:	56                   	push   %esi
+  80389e:	53                   	push   %ebx
+  80389f:	83 ec 24             	sub    $0x24,%esp
+  8038a2:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038a6:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038aa:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8038ae:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8038b2:	85 d2                	test   %edx,%edx
+  8038b4:	78 3b                	js     8038f1 <__moddi3+0x56>
+  8038b6:	83 ec 04             	sub    $0x4,%esp
+  8038b9:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8038bd:	56                   	push   %esi
+  8038be:	89 ce                	mov    %ecx,%esi
+  8038c0:	f7 de                	neg    %esi
+  8038c2:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8038c6:	89 de                	mov    %ebx,%esi
+  8038c8:	83 d6 00             	adc    $0x0,%esi
+  8038cb:	f7 de                	neg    %esi
+  8038cd:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8038d1:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8038d5:	0f 48 f1             	cmovs  %ecx,%esi
+  8038d8:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8038dd:	53                   	push   %ebx
+  8038de:	56                   	push   %esi
+  8038df:	e8 24 fe ff ff       	call   803708 <dm>
+  8038e4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8038e8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038ec:	83 c4 10             	add    $0x10,%esp
+  8038ef:	eb 47                	jmp    803938 <__moddi3+0x9d>
+  8038f1:	f7 d8                	neg    %eax
+  8038f3:	83 d2 00             	adc    $0x0,%edx
+  8038f6:	f7 da                	neg    %edx
+  8038f8:	83 ec 04             	sub    $0x4,%esp
+  8038fb:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8038ff:	56                   	push   %esi
+  803900:	89 cf                	mov    %ecx,%edi
+  803902:	f7 df                	neg    %edi
+  803904:	89 de                	mov    %ebx,%esi
+  803906:	83 d6 00             	adc    $0x0,%esi
+  803909:	f7 de                	neg    %esi
+  80390b:	0f 49 cf             	cmovns %edi,%ecx
+  80390e:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803912:	0f 49 de             	cmovns %esi,%ebx
+  803915:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803919:	ff 74 24 0c          	push   0xc(%esp)
+  80391d:	ff 74 24 0c          	push   0xc(%esp)
+  803921:	e8 e2 fd ff ff       	call   803708 <dm>
+  803926:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80392a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80392e:	f7 d8                	neg    %eax
+  803930:	83 d2 00             	adc    $0x0,%edx
+  803933:	f7 da                	neg    %edx
+  803935:	83 c4 10             	add    $0x10,%esp
+  803938:	83 c4 24             	add    $0x24,%esp
+  80393b:	5b                   	pop    %ebx
+  80393c:	5e                   	pop    %esi
+  80393d:	5f                   	pop    %edi
+  80393e:	5d                   	pop    %ebp
+  80393f:	c3                   	ret
@@ -0,0 +1,8271 @@
+
+obj/user/defrag.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 57 02 00 00       	call   800288 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <defrag1>:
+	exit();
+}
+
+static void
+defrag1(const char *path)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 18             	sub    $0x18,%esp
+  80003a:	89 c3                	mov    %eax,%ebx
+	uint32_t before, after;
+	int r;
+
+	if ((r = defrag(path, &before, &after)) < 0)
+  80003c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80003f:	50                   	push   %eax
+  800040:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800043:	50                   	push   %eax
+  800044:	53                   	push   %ebx
+  800045:	e8 a1 27 00 00       	call   8027eb <defrag>
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	78 2a                	js     80007b <defrag1+0x48>
+		printf("defrag %s: %e\n", path, r);
+	else if (verbose || after != before)
+  800051:	80 3d 00 70 80 00 00 	cmpb   $0x0,0x807000
+  800058:	75 08                	jne    800062 <defrag1+0x2f>
+  80005a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80005d:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+  800060:	74 14                	je     800076 <defrag1+0x43>
+		printf("%s: %u extents -> %u\n", path, before, after);
+  800062:	ff 75 f0             	push   -0x10(%ebp)
+  800065:	ff 75 f4             	push   -0xc(%ebp)
+  800068:	53                   	push   %ebx
+  800069:	68 0f 3c 80 00       	push   $0x803c0f
+  80006e:	e8 41 29 00 00       	call   8029b4 <printf>
+  800073:	83 c4 10             	add    $0x10,%esp
+}
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+		printf("defrag %s: %e\n", path, r);
+  80007b:	83 ec 04             	sub    $0x4,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 00 3c 80 00       	push   $0x803c00
+  800085:	e8 2a 29 00 00       	call   8029b4 <printf>
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	eb e7                	jmp    800076 <defrag1+0x43>
+
+0080008f <defragdir>:
+
+// Defragment every regular file under the directory 'path'.
+static void
+defragdir(const char *path)
+{
+  80008f:	55                   	push   %ebp
+  800090:	89 e5                	mov    %esp,%ebp
+  800092:	57                   	push   %edi
+  800093:	56                   	push   %esi
+  800094:	53                   	push   %ebx
+  800095:	81 ec 24 04 00 00    	sub    $0x424,%esp
+  80009b:	89 85 e0 fb ff ff    	mov    %eax,-0x420(%ebp)
+	char file[MAXPATHLEN];
+	struct Fsdirent *d;
+	int fd, n, i;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0) {
+  8000a1:	68 00 10 00 00       	push   $0x1000
+  8000a6:	50                   	push   %eax
+  8000a7:	e8 0e 1f 00 00       	call   801fba <open>
+  8000ac:	83 c4 10             	add    $0x10,%esp
+  8000af:	85 c0                	test   %eax,%eax
+  8000b1:	78 37                	js     8000ea <defragdir+0x5b>
+  8000b3:	89 85 dc fb ff ff    	mov    %eax,-0x424(%ebp)
+		printf("open %s: %e\n", path, fd);
+		return;
+	}
+	while ((n = readdir(fd, dirbuf, sizeof dirbuf, FSREADDIR_RECURSIVE)) > 0)
+  8000b9:	6a 01                	push   $0x1
+  8000bb:	68 00 10 00 00       	push   $0x1000
+  8000c0:	68 00 60 80 00       	push   $0x806000
+  8000c5:	ff b5 dc fb ff ff    	push   -0x424(%ebp)
+  8000cb:	e8 b0 1f 00 00       	call   802080 <readdir>
+  8000d0:	89 c2                	mov    %eax,%edx
+  8000d2:	83 c4 10             	add    $0x10,%esp
+  8000d5:	85 c0                	test   %eax,%eax
+  8000d7:	0f 8e 97 00 00 00    	jle    800174 <defragdir+0xe5>
+		for (i = 0; i < n; i += d->d_reclen) {
+  8000dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+			d = (struct Fsdirent *) (dirbuf + i);
+			if (d->d_type != FTYPE_REG)
+				continue;
+			snprintf(file, sizeof file, "%s%s%s", path,
+  8000e2:	89 95 e4 fb ff ff    	mov    %edx,-0x41c(%ebp)
+  8000e8:	eb 2a                	jmp    800114 <defragdir+0x85>
+		printf("open %s: %e\n", path, fd);
+  8000ea:	83 ec 04             	sub    $0x4,%esp
+  8000ed:	50                   	push   %eax
+  8000ee:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  8000f4:	68 27 3c 80 00       	push   $0x803c27
+  8000f9:	e8 b6 28 00 00       	call   8029b4 <printf>
+  8000fe:	83 c4 10             	add    $0x10,%esp
+  800101:	e9 82 00 00 00       	jmp    800188 <defragdir+0xf9>
+		for (i = 0; i < n; i += d->d_reclen) {
+  800106:	0f b7 46 06          	movzwl 0x6(%esi),%eax
+  80010a:	01 c3                	add    %eax,%ebx
+  80010c:	39 9d e4 fb ff ff    	cmp    %ebx,-0x41c(%ebp)
+  800112:	7e a5                	jle    8000b9 <defragdir+0x2a>
+			d = (struct Fsdirent *) (dirbuf + i);
+  800114:	8d b3 00 60 80 00    	lea    0x806000(%ebx),%esi
+			if (d->d_type != FTYPE_REG)
+  80011a:	80 bb 04 60 80 00 00 	cmpb   $0x0,0x806004(%ebx)
+  800121:	75 e3                	jne    800106 <defragdir+0x77>
+				 path[strlen(path) - 1] == '/' ? "" : "/", d->d_name);
+  800123:	8d 7e 08             	lea    0x8(%esi),%edi
+  800126:	83 ec 0c             	sub    $0xc,%esp
+  800129:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  80012f:	e8 56 07 00 00       	call   80088a <strlen>
+			snprintf(file, sizeof file, "%s%s%s", path,
+  800134:	83 c4 08             	add    $0x8,%esp
+  800137:	8b 8d e0 fb ff ff    	mov    -0x420(%ebp),%ecx
+  80013d:	80 7c 01 ff 2f       	cmpb   $0x2f,-0x1(%ecx,%eax,1)
+  800142:	b8 58 3c 80 00       	mov    $0x803c58,%eax
+  800147:	ba 25 3c 80 00       	mov    $0x803c25,%edx
+  80014c:	0f 45 c2             	cmovne %edx,%eax
+  80014f:	57                   	push   %edi
+  800150:	50                   	push   %eax
+  800151:	51                   	push   %ecx
+  800152:	68 34 3c 80 00       	push   $0x803c34
+  800157:	68 00 04 00 00       	push   $0x400
+  80015c:	8d bd e8 fb ff ff    	lea    -0x418(%ebp),%edi
+  800162:	57                   	push   %edi
+  800163:	e8 08 07 00 00       	call   800870 <snprintf>
+			defrag1(file);
+  800168:	83 c4 20             	add    $0x20,%esp
+  80016b:	89 f8                	mov    %edi,%eax
+  80016d:	e8 c1 fe ff ff       	call   800033 <defrag1>
+  800172:	eb 92                	jmp    800106 <defragdir+0x77>
+		}
+	if (n < 0)
+  800174:	8b bd dc fb ff ff    	mov    -0x424(%ebp),%edi
+  80017a:	78 14                	js     800190 <defragdir+0x101>
+		printf("error reading directory %s: %e\n", path, n);
+	close(fd);
+  80017c:	83 ec 0c             	sub    $0xc,%esp
+  80017f:	57                   	push   %edi
+  800180:	e8 43 12 00 00       	call   8013c8 <close>
+  800185:	83 c4 10             	add    $0x10,%esp
+}
+  800188:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80018b:	5b                   	pop    %ebx
+  80018c:	5e                   	pop    %esi
+  80018d:	5f                   	pop    %edi
+  80018e:	5d                   	pop    %ebp
+  80018f:	c3                   	ret
+		printf("error reading directory %s: %e\n", path, n);
+  800190:	83 ec 04             	sub    $0x4,%esp
+  800193:	50                   	push   %eax
+  800194:	ff b5 e0 fb ff ff    	push   -0x420(%ebp)
+  80019a:	68 70 3c 80 00       	push   $0x803c70
+  80019f:	e8 10 28 00 00       	call   8029b4 <printf>
+  8001a4:	83 c4 10             	add    $0x10,%esp
+  8001a7:	eb d3                	jmp    80017c <defragdir+0xed>
+
+008001a9 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8001a9:	55                   	push   %ebp
+  8001aa:	89 e5                	mov    %esp,%ebp
+  8001ac:	57                   	push   %edi
+  8001ad:	56                   	push   %esi
+  8001ae:	53                   	push   %ebx
+  8001af:	81 ec c0 00 00 00    	sub    $0xc0,%esp
+  8001b5:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i;
+	struct Stat st;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  8001b8:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  8001be:	50                   	push   %eax
+  8001bf:	56                   	push   %esi
+  8001c0:	8d 45 08             	lea    0x8(%ebp),%eax
+  8001c3:	50                   	push   %eax
+  8001c4:	e8 09 0f 00 00       	call   8010d2 <argstart>
+	while ((i = argnext(&args)) >= 0)
+  8001c9:	83 c4 10             	add    $0x10,%esp
+  8001cc:	8d 9d 4c ff ff ff    	lea    -0xb4(%ebp),%ebx
+  8001d2:	eb 15                	jmp    8001e9 <umain+0x40>
+	printf("usage: defrag [-v] [file...]\n");
+  8001d4:	83 ec 0c             	sub    $0xc,%esp
+  8001d7:	68 3b 3c 80 00       	push   $0x803c3b
+  8001dc:	e8 d3 27 00 00       	call   8029b4 <printf>
+	exit();
+  8001e1:	e8 eb 00 00 00       	call   8002d1 <exit>
+}
+  8001e6:	83 c4 10             	add    $0x10,%esp
+	while ((i = argnext(&args)) >= 0)
+  8001e9:	83 ec 0c             	sub    $0xc,%esp
+  8001ec:	53                   	push   %ebx
+  8001ed:	e8 10 0f 00 00       	call   801102 <argnext>
+  8001f2:	83 c4 10             	add    $0x10,%esp
+  8001f5:	85 c0                	test   %eax,%eax
+  8001f7:	78 0e                	js     800207 <umain+0x5e>
+		switch (i) {
+  8001f9:	83 f8 76             	cmp    $0x76,%eax
+  8001fc:	75 d6                	jne    8001d4 <umain+0x2b>
+		case 'v':
+			verbose = 1;
+  8001fe:	c6 05 00 70 80 00 01 	movb   $0x1,0x807000
+			break;
+  800205:	eb e2                	jmp    8001e9 <umain+0x40>
+		default:
+			usage();
+		}
+
+	if (argc == 1)
+  800207:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  80020b:	74 0d                	je     80021a <umain+0x71>
+{
+  80020d:	bb 01 00 00 00       	mov    $0x1,%ebx
+		defragdir("/");
+	for (i = 1; i < argc; i++) {
+		if (stat(argv[i], &st) < 0)
+  800212:	8d bd 5c ff ff ff    	lea    -0xa4(%ebp),%edi
+  800218:	eb 32                	jmp    80024c <umain+0xa3>
+		defragdir("/");
+  80021a:	b8 25 3c 80 00       	mov    $0x803c25,%eax
+  80021f:	e8 6b fe ff ff       	call   80008f <defragdir>
+  800224:	eb e7                	jmp    80020d <umain+0x64>
+			printf("stat %s: no such file\n", argv[i]);
+  800226:	83 ec 08             	sub    $0x8,%esp
+  800229:	ff 34 9e             	push   (%esi,%ebx,4)
+  80022c:	68 59 3c 80 00       	push   $0x803c59
+  800231:	e8 7e 27 00 00       	call   8029b4 <printf>
+  800236:	83 c4 10             	add    $0x10,%esp
+  800239:	eb 0e                	jmp    800249 <umain+0xa0>
+		else if (st.st_isdir)
+			defragdir(argv[i]);
+		else
+			defrag1(argv[i]);
+  80023b:	8b 85 44 ff ff ff    	mov    -0xbc(%ebp),%eax
+  800241:	8b 04 86             	mov    (%esi,%eax,4),%eax
+  800244:	e8 ea fd ff ff       	call   800033 <defrag1>
+	for (i = 1; i < argc; i++) {
+  800249:	83 c3 01             	add    $0x1,%ebx
+  80024c:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+  80024f:	7e 2f                	jle    800280 <umain+0xd7>
+		if (stat(argv[i], &st) < 0)
+  800251:	89 9d 44 ff ff ff    	mov    %ebx,-0xbc(%ebp)
+  800257:	83 ec 08             	sub    $0x8,%esp
+  80025a:	57                   	push   %edi
+  80025b:	ff 34 9e             	push   (%esi,%ebx,4)
+  80025e:	e8 8f 15 00 00       	call   8017f2 <stat>
+  800263:	83 c4 10             	add    $0x10,%esp
+  800266:	85 c0                	test   %eax,%eax
+  800268:	78 bc                	js     800226 <umain+0x7d>
+		else if (st.st_isdir)
+  80026a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80026e:	74 cb                	je     80023b <umain+0x92>
+			defragdir(argv[i]);
+  800270:	8b 85 44 ff ff ff    	mov    -0xbc(%ebp),%eax
+  800276:	8b 04 86             	mov    (%esi,%eax,4),%eax
+  800279:	e8 11 fe ff ff       	call   80008f <defragdir>
+  80027e:	eb c9                	jmp    800249 <umain+0xa0>
+	}
+}
+  800280:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800283:	5b                   	pop    %ebx
+  800284:	5e                   	pop    %esi
+  800285:	5f                   	pop    %edi
+  800286:	5d                   	pop    %ebp
+  800287:	c3                   	ret
+
+00800288 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800288:	55                   	push   %ebp
+  800289:	89 e5                	mov    %esp,%ebp
+  80028b:	56                   	push   %esi
+  80028c:	53                   	push   %ebx
+  80028d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800290:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800293:	e8 f3 09 00 00       	call   800c8b <sys_getenvid>
+  800298:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80029d:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8002a3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002a8:	a3 04 70 80 00       	mov    %eax,0x807004
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002ad:	85 db                	test   %ebx,%ebx
+  8002af:	7e 07                	jle    8002b8 <libmain+0x30>
+		binaryname = argv[0];
+  8002b1:	8b 06                	mov    (%esi),%eax
+  8002b3:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8002b8:	83 ec 08             	sub    $0x8,%esp
+  8002bb:	56                   	push   %esi
+  8002bc:	53                   	push   %ebx
+  8002bd:	e8 e7 fe ff ff       	call   8001a9 <umain>
+
+	// exit gracefully
+	exit();
+  8002c2:	e8 0a 00 00 00       	call   8002d1 <exit>
+}
+  8002c7:	83 c4 10             	add    $0x10,%esp
+  8002ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002cd:	5b                   	pop    %ebx
+  8002ce:	5e                   	pop    %esi
+  8002cf:	5d                   	pop    %ebp
+  8002d0:	c3                   	ret
+
+008002d1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002d1:	55                   	push   %ebp
+  8002d2:	89 e5                	mov    %esp,%ebp
+  8002d4:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8002d7:	e8 19 11 00 00       	call   8013f5 <close_all>
+	sys_env_destroy(0);
+  8002dc:	83 ec 0c             	sub    $0xc,%esp
+  8002df:	6a 00                	push   $0x0
+  8002e1:	e8 5c 09 00 00       	call   800c42 <sys_env_destroy>
+}
+  8002e6:	83 c4 10             	add    $0x10,%esp
+  8002e9:	c9                   	leave
+  8002ea:	c3                   	ret
+
+008002eb <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002eb:	55                   	push   %ebp
+  8002ec:	89 e5                	mov    %esp,%ebp
+  8002ee:	57                   	push   %edi
+  8002ef:	56                   	push   %esi
+  8002f0:	53                   	push   %ebx
+  8002f1:	83 ec 1c             	sub    $0x1c,%esp
+  8002f4:	89 c7                	mov    %eax,%edi
+  8002f6:	89 d6                	mov    %edx,%esi
+  8002f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002fe:	89 d1                	mov    %edx,%ecx
+  800300:	89 c2                	mov    %eax,%edx
+  800302:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800305:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800308:	8b 45 10             	mov    0x10(%ebp),%eax
+  80030b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80030e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800311:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800318:	39 c2                	cmp    %eax,%edx
+  80031a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80031d:	72 3e                	jb     80035d <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80031f:	83 ec 0c             	sub    $0xc,%esp
+  800322:	ff 75 18             	push   0x18(%ebp)
+  800325:	83 eb 01             	sub    $0x1,%ebx
+  800328:	53                   	push   %ebx
+  800329:	50                   	push   %eax
+  80032a:	83 ec 08             	sub    $0x8,%esp
+  80032d:	ff 75 e4             	push   -0x1c(%ebp)
+  800330:	ff 75 e0             	push   -0x20(%ebp)
+  800333:	ff 75 dc             	push   -0x24(%ebp)
+  800336:	ff 75 d8             	push   -0x28(%ebp)
+  800339:	e8 43 37 00 00       	call   803a81 <__udivdi3>
+  80033e:	83 c4 18             	add    $0x18,%esp
+  800341:	52                   	push   %edx
+  800342:	50                   	push   %eax
+  800343:	89 f2                	mov    %esi,%edx
+  800345:	89 f8                	mov    %edi,%eax
+  800347:	e8 9f ff ff ff       	call   8002eb <printnum>
+  80034c:	83 c4 20             	add    $0x20,%esp
+  80034f:	eb 13                	jmp    800364 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800351:	83 ec 08             	sub    $0x8,%esp
+  800354:	56                   	push   %esi
+  800355:	ff 75 18             	push   0x18(%ebp)
+  800358:	ff d7                	call   *%edi
+  80035a:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80035d:	83 eb 01             	sub    $0x1,%ebx
+  800360:	85 db                	test   %ebx,%ebx
+  800362:	7f ed                	jg     800351 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800364:	83 ec 08             	sub    $0x8,%esp
+  800367:	56                   	push   %esi
+  800368:	83 ec 04             	sub    $0x4,%esp
+  80036b:	ff 75 e4             	push   -0x1c(%ebp)
+  80036e:	ff 75 e0             	push   -0x20(%ebp)
+  800371:	ff 75 dc             	push   -0x24(%ebp)
+  800374:	ff 75 d8             	push   -0x28(%ebp)
+  800377:	e8 23 37 00 00       	call   803a9f <__umoddi3>
+  80037c:	83 c4 14             	add    $0x14,%esp
+  80037f:	0f be 80 9a 3c 80 00 	movsbl 0x803c9a(%eax),%eax
+  800386:	50                   	push   %eax
+  800387:	ff d7                	call   *%edi
+}
+  800389:	83 c4 10             	add    $0x10,%esp
+  80038c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80038f:	5b                   	pop    %ebx
+  800390:	5e                   	pop    %esi
+  800391:	5f                   	pop    %edi
+  800392:	5d                   	pop    %ebp
+  800393:	c3                   	ret
+
+00800394 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800394:	55                   	push   %ebp
+  800395:	89 e5                	mov    %esp,%ebp
+  800397:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80039a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80039e:	8b 10                	mov    (%eax),%edx
+  8003a0:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003a3:	73 0a                	jae    8003af <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003a5:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003a8:	89 08                	mov    %ecx,(%eax)
+  8003aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003ad:	88 02                	mov    %al,(%edx)
+}
+  8003af:	5d                   	pop    %ebp
+  8003b0:	c3                   	ret
+
+008003b1 <printfmt>:
+{
+  8003b1:	55                   	push   %ebp
+  8003b2:	89 e5                	mov    %esp,%ebp
+  8003b4:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003b7:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003ba:	50                   	push   %eax
+  8003bb:	ff 75 10             	push   0x10(%ebp)
+  8003be:	ff 75 0c             	push   0xc(%ebp)
+  8003c1:	ff 75 08             	push   0x8(%ebp)
+  8003c4:	e8 05 00 00 00       	call   8003ce <vprintfmt>
+}
+  8003c9:	83 c4 10             	add    $0x10,%esp
+  8003cc:	c9                   	leave
+  8003cd:	c3                   	ret
+
+008003ce <vprintfmt>:
+{
+  8003ce:	55                   	push   %ebp
+  8003cf:	89 e5                	mov    %esp,%ebp
+  8003d1:	57                   	push   %edi
+  8003d2:	56                   	push   %esi
+  8003d3:	53                   	push   %ebx
+  8003d4:	83 ec 2c             	sub    $0x2c,%esp
+  8003d7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003dd:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003e0:	eb 0a                	jmp    8003ec <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003e2:	83 ec 08             	sub    $0x8,%esp
+  8003e5:	53                   	push   %ebx
+  8003e6:	50                   	push   %eax
+  8003e7:	ff d6                	call   *%esi
+  8003e9:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003ec:	83 c7 01             	add    $0x1,%edi
+  8003ef:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003f3:	83 f8 25             	cmp    $0x25,%eax
+  8003f6:	74 0c                	je     800404 <vprintfmt+0x36>
+			if (ch == '\0')
+  8003f8:	85 c0                	test   %eax,%eax
+  8003fa:	75 e6                	jne    8003e2 <vprintfmt+0x14>
+}
+  8003fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ff:	5b                   	pop    %ebx
+  800400:	5e                   	pop    %esi
+  800401:	5f                   	pop    %edi
+  800402:	5d                   	pop    %ebp
+  800403:	c3                   	ret
+		padc = ' ';
+  800404:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800408:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80040f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800416:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80041d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800422:	8d 47 01             	lea    0x1(%edi),%eax
+  800425:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800428:	0f b6 17             	movzbl (%edi),%edx
+  80042b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80042e:	3c 55                	cmp    $0x55,%al
+  800430:	0f 87 cf 03 00 00    	ja     800805 <vprintfmt+0x437>
+  800436:	0f b6 c0             	movzbl %al,%eax
+  800439:	ff 24 85 00 3e 80 00 	jmp    *0x803e00(,%eax,4)
+  800440:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800443:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800447:	eb d9                	jmp    800422 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800449:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80044c:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800450:	eb d0                	jmp    800422 <vprintfmt+0x54>
+  800452:	0f b6 d2             	movzbl %dl,%edx
+  800455:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800460:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800463:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800467:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80046a:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80046d:	83 f9 09             	cmp    $0x9,%ecx
+  800470:	77 55                	ja     8004c7 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800472:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800475:	eb e9                	jmp    800460 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800477:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047a:	8b 00                	mov    (%eax),%eax
+  80047c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80047f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800482:	8d 40 04             	lea    0x4(%eax),%eax
+  800485:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800488:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80048b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80048f:	79 91                	jns    800422 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800491:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800494:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800497:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80049e:	eb 82                	jmp    800422 <vprintfmt+0x54>
+			if (width < 0)
+  8004a0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004a3:	85 d2                	test   %edx,%edx
+  8004a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004aa:	0f 49 c2             	cmovns %edx,%eax
+  8004ad:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004b3:	e9 6a ff ff ff       	jmp    800422 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004bb:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004c2:	e9 5b ff ff ff       	jmp    800422 <vprintfmt+0x54>
+  8004c7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004ca:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004cd:	eb bc                	jmp    80048b <vprintfmt+0xbd>
+			lflag++;
+  8004cf:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004d5:	e9 48 ff ff ff       	jmp    800422 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dd:	8d 78 04             	lea    0x4(%eax),%edi
+  8004e0:	83 ec 08             	sub    $0x8,%esp
+  8004e3:	53                   	push   %ebx
+  8004e4:	ff 30                	push   (%eax)
+  8004e6:	ff d6                	call   *%esi
+			break;
+  8004e8:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004eb:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004ee:	e9 b1 02 00 00       	jmp    8007a4 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8004f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f6:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004f9:	8b 10                	mov    (%eax),%edx
+  8004fb:	89 d0                	mov    %edx,%eax
+  8004fd:	f7 d8                	neg    %eax
+  8004ff:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800502:	83 f8 11             	cmp    $0x11,%eax
+  800505:	7f 23                	jg     80052a <vprintfmt+0x15c>
+  800507:	8b 14 85 60 3f 80 00 	mov    0x803f60(,%eax,4),%edx
+  80050e:	85 d2                	test   %edx,%edx
+  800510:	74 18                	je     80052a <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800512:	52                   	push   %edx
+  800513:	68 b2 40 80 00       	push   $0x8040b2
+  800518:	53                   	push   %ebx
+  800519:	56                   	push   %esi
+  80051a:	e8 92 fe ff ff       	call   8003b1 <printfmt>
+  80051f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800522:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800525:	e9 7a 02 00 00       	jmp    8007a4 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80052a:	50                   	push   %eax
+  80052b:	68 b2 3c 80 00       	push   $0x803cb2
+  800530:	53                   	push   %ebx
+  800531:	56                   	push   %esi
+  800532:	e8 7a fe ff ff       	call   8003b1 <printfmt>
+  800537:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80053a:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80053d:	e9 62 02 00 00       	jmp    8007a4 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800542:	8b 45 14             	mov    0x14(%ebp),%eax
+  800545:	83 c0 04             	add    $0x4,%eax
+  800548:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80054b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054e:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800550:	85 c9                	test   %ecx,%ecx
+  800552:	b8 ab 3c 80 00       	mov    $0x803cab,%eax
+  800557:	0f 45 c1             	cmovne %ecx,%eax
+  80055a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80055d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800561:	7e 06                	jle    800569 <vprintfmt+0x19b>
+  800563:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800567:	75 0b                	jne    800574 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800569:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80056c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80056f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800572:	eb 5c                	jmp    8005d0 <vprintfmt+0x202>
+  800574:	83 ec 08             	sub    $0x8,%esp
+  800577:	ff 75 d0             	push   -0x30(%ebp)
+  80057a:	ff 75 cc             	push   -0x34(%ebp)
+  80057d:	e8 20 03 00 00       	call   8008a2 <strnlen>
+  800582:	89 c2                	mov    %eax,%edx
+  800584:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800587:	29 d0                	sub    %edx,%eax
+  800589:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80058c:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800590:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800593:	89 75 08             	mov    %esi,0x8(%ebp)
+  800596:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800598:	eb 0e                	jmp    8005a8 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80059a:	83 ec 08             	sub    $0x8,%esp
+  80059d:	53                   	push   %ebx
+  80059e:	57                   	push   %edi
+  80059f:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005a2:	83 ee 01             	sub    $0x1,%esi
+  8005a5:	83 c4 10             	add    $0x10,%esp
+  8005a8:	85 f6                	test   %esi,%esi
+  8005aa:	7f ee                	jg     80059a <vprintfmt+0x1cc>
+  8005ac:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005af:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005b2:	85 c0                	test   %eax,%eax
+  8005b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b9:	0f 49 d0             	cmovns %eax,%edx
+  8005bc:	29 d0                	sub    %edx,%eax
+  8005be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c1:	eb a6                	jmp    800569 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005c3:	83 ec 08             	sub    $0x8,%esp
+  8005c6:	53                   	push   %ebx
+  8005c7:	52                   	push   %edx
+  8005c8:	ff 55 08             	call   *0x8(%ebp)
+  8005cb:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ce:	89 f1                	mov    %esi,%ecx
+  8005d0:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005d3:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005d7:	0f be d0             	movsbl %al,%edx
+  8005da:	85 d2                	test   %edx,%edx
+  8005dc:	74 28                	je     800606 <vprintfmt+0x238>
+  8005de:	85 ff                	test   %edi,%edi
+  8005e0:	78 05                	js     8005e7 <vprintfmt+0x219>
+  8005e2:	83 ef 01             	sub    $0x1,%edi
+  8005e5:	78 30                	js     800617 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005e7:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005eb:	74 d6                	je     8005c3 <vprintfmt+0x1f5>
+  8005ed:	0f be c0             	movsbl %al,%eax
+  8005f0:	83 e8 20             	sub    $0x20,%eax
+  8005f3:	83 f8 5e             	cmp    $0x5e,%eax
+  8005f6:	76 cb                	jbe    8005c3 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005f8:	83 ec 08             	sub    $0x8,%esp
+  8005fb:	53                   	push   %ebx
+  8005fc:	6a 3f                	push   $0x3f
+  8005fe:	ff 55 08             	call   *0x8(%ebp)
+  800601:	83 c4 10             	add    $0x10,%esp
+  800604:	eb c8                	jmp    8005ce <vprintfmt+0x200>
+  800606:	8b 75 08             	mov    0x8(%ebp),%esi
+  800609:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80060c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80060f:	01 d0                	add    %edx,%eax
+  800611:	29 c8                	sub    %ecx,%eax
+  800613:	89 c7                	mov    %eax,%edi
+  800615:	eb 13                	jmp    80062a <vprintfmt+0x25c>
+  800617:	8b 75 08             	mov    0x8(%ebp),%esi
+  80061a:	eb ed                	jmp    800609 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80061c:	83 ec 08             	sub    $0x8,%esp
+  80061f:	53                   	push   %ebx
+  800620:	6a 20                	push   $0x20
+  800622:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800624:	83 ef 01             	sub    $0x1,%edi
+  800627:	83 c4 10             	add    $0x10,%esp
+  80062a:	85 ff                	test   %edi,%edi
+  80062c:	7f ee                	jg     80061c <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80062e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800631:	89 45 14             	mov    %eax,0x14(%ebp)
+  800634:	e9 6b 01 00 00       	jmp    8007a4 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800639:	83 f9 01             	cmp    $0x1,%ecx
+  80063c:	7f 1f                	jg     80065d <vprintfmt+0x28f>
+	else if (lflag)
+  80063e:	85 c9                	test   %ecx,%ecx
+  800640:	74 67                	je     8006a9 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800642:	8b 45 14             	mov    0x14(%ebp),%eax
+  800645:	8b 00                	mov    (%eax),%eax
+  800647:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80064a:	89 c1                	mov    %eax,%ecx
+  80064c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80064f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800652:	8b 45 14             	mov    0x14(%ebp),%eax
+  800655:	8d 40 04             	lea    0x4(%eax),%eax
+  800658:	89 45 14             	mov    %eax,0x14(%ebp)
+  80065b:	eb 17                	jmp    800674 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80065d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800660:	8b 50 04             	mov    0x4(%eax),%edx
+  800663:	8b 00                	mov    (%eax),%eax
+  800665:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800668:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80066b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066e:	8d 40 08             	lea    0x8(%eax),%eax
+  800671:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800674:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800677:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80067a:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80067f:	85 c9                	test   %ecx,%ecx
+  800681:	0f 89 03 01 00 00    	jns    80078a <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800687:	83 ec 08             	sub    $0x8,%esp
+  80068a:	53                   	push   %ebx
+  80068b:	6a 2d                	push   $0x2d
+  80068d:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80068f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800692:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800695:	f7 da                	neg    %edx
+  800697:	83 d1 00             	adc    $0x0,%ecx
+  80069a:	f7 d9                	neg    %ecx
+  80069c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80069f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006a4:	e9 e1 00 00 00       	jmp    80078a <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8006a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ac:	8b 00                	mov    (%eax),%eax
+  8006ae:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006b1:	89 c1                	mov    %eax,%ecx
+  8006b3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006b6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c2:	eb b0                	jmp    800674 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006c4:	83 f9 01             	cmp    $0x1,%ecx
+  8006c7:	7f 1e                	jg     8006e7 <vprintfmt+0x319>
+	else if (lflag)
+  8006c9:	85 c9                	test   %ecx,%ecx
+  8006cb:	74 32                	je     8006ff <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8006cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d0:	8b 10                	mov    (%eax),%edx
+  8006d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006da:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006dd:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006e2:	e9 a3 00 00 00       	jmp    80078a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ea:	8b 10                	mov    (%eax),%edx
+  8006ec:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006ef:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006f5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006fa:	e9 8b 00 00 00       	jmp    80078a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800702:	8b 10                	mov    (%eax),%edx
+  800704:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800709:	8d 40 04             	lea    0x4(%eax),%eax
+  80070c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80070f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800714:	eb 74                	jmp    80078a <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800716:	83 f9 01             	cmp    $0x1,%ecx
+  800719:	7f 1b                	jg     800736 <vprintfmt+0x368>
+	else if (lflag)
+  80071b:	85 c9                	test   %ecx,%ecx
+  80071d:	74 2c                	je     80074b <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80071f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800722:	8b 10                	mov    (%eax),%edx
+  800724:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800729:	8d 40 04             	lea    0x4(%eax),%eax
+  80072c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80072f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800734:	eb 54                	jmp    80078a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800736:	8b 45 14             	mov    0x14(%ebp),%eax
+  800739:	8b 10                	mov    (%eax),%edx
+  80073b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80073e:	8d 40 08             	lea    0x8(%eax),%eax
+  800741:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800744:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800749:	eb 3f                	jmp    80078a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80074b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074e:	8b 10                	mov    (%eax),%edx
+  800750:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800755:	8d 40 04             	lea    0x4(%eax),%eax
+  800758:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80075b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800760:	eb 28                	jmp    80078a <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800762:	83 ec 08             	sub    $0x8,%esp
+  800765:	53                   	push   %ebx
+  800766:	6a 30                	push   $0x30
+  800768:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80076a:	83 c4 08             	add    $0x8,%esp
+  80076d:	53                   	push   %ebx
+  80076e:	6a 78                	push   $0x78
+  800770:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800772:	8b 45 14             	mov    0x14(%ebp),%eax
+  800775:	8b 10                	mov    (%eax),%edx
+  800777:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80077c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80077f:	8d 40 04             	lea    0x4(%eax),%eax
+  800782:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800785:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80078a:	83 ec 0c             	sub    $0xc,%esp
+  80078d:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800791:	50                   	push   %eax
+  800792:	ff 75 e0             	push   -0x20(%ebp)
+  800795:	57                   	push   %edi
+  800796:	51                   	push   %ecx
+  800797:	52                   	push   %edx
+  800798:	89 da                	mov    %ebx,%edx
+  80079a:	89 f0                	mov    %esi,%eax
+  80079c:	e8 4a fb ff ff       	call   8002eb <printnum>
+			break;
+  8007a1:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007a7:	e9 40 fc ff ff       	jmp    8003ec <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007ac:	83 f9 01             	cmp    $0x1,%ecx
+  8007af:	7f 1b                	jg     8007cc <vprintfmt+0x3fe>
+	else if (lflag)
+  8007b1:	85 c9                	test   %ecx,%ecx
+  8007b3:	74 2c                	je     8007e1 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8007b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b8:	8b 10                	mov    (%eax),%edx
+  8007ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007ca:	eb be                	jmp    80078a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cf:	8b 10                	mov    (%eax),%edx
+  8007d1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007d4:	8d 40 08             	lea    0x8(%eax),%eax
+  8007d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007da:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007df:	eb a9                	jmp    80078a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e4:	8b 10                	mov    (%eax),%edx
+  8007e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007f6:	eb 92                	jmp    80078a <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8007f8:	83 ec 08             	sub    $0x8,%esp
+  8007fb:	53                   	push   %ebx
+  8007fc:	6a 25                	push   $0x25
+  8007fe:	ff d6                	call   *%esi
+			break;
+  800800:	83 c4 10             	add    $0x10,%esp
+  800803:	eb 9f                	jmp    8007a4 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800805:	83 ec 08             	sub    $0x8,%esp
+  800808:	53                   	push   %ebx
+  800809:	6a 25                	push   $0x25
+  80080b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80080d:	83 c4 10             	add    $0x10,%esp
+  800810:	89 f8                	mov    %edi,%eax
+  800812:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800816:	74 05                	je     80081d <vprintfmt+0x44f>
+  800818:	83 e8 01             	sub    $0x1,%eax
+  80081b:	eb f5                	jmp    800812 <vprintfmt+0x444>
+  80081d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800820:	eb 82                	jmp    8007a4 <vprintfmt+0x3d6>
+
+00800822 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800822:	55                   	push   %ebp
+  800823:	89 e5                	mov    %esp,%ebp
+  800825:	83 ec 18             	sub    $0x18,%esp
+  800828:	8b 45 08             	mov    0x8(%ebp),%eax
+  80082b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80082e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800831:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800835:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800838:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80083f:	85 c0                	test   %eax,%eax
+  800841:	74 26                	je     800869 <vsnprintf+0x47>
+  800843:	85 d2                	test   %edx,%edx
+  800845:	7e 22                	jle    800869 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800847:	ff 75 14             	push   0x14(%ebp)
+  80084a:	ff 75 10             	push   0x10(%ebp)
+  80084d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800850:	50                   	push   %eax
+  800851:	68 94 03 80 00       	push   $0x800394
+  800856:	e8 73 fb ff ff       	call   8003ce <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80085b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80085e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800861:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800864:	83 c4 10             	add    $0x10,%esp
+}
+  800867:	c9                   	leave
+  800868:	c3                   	ret
+		return -E_INVAL;
+  800869:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80086e:	eb f7                	jmp    800867 <vsnprintf+0x45>
+
+00800870 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800870:	55                   	push   %ebp
+  800871:	89 e5                	mov    %esp,%ebp
+  800873:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800876:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800879:	50                   	push   %eax
+  80087a:	ff 75 10             	push   0x10(%ebp)
+  80087d:	ff 75 0c             	push   0xc(%ebp)
+  800880:	ff 75 08             	push   0x8(%ebp)
+  800883:	e8 9a ff ff ff       	call   800822 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800888:	c9                   	leave
+  800889:	c3                   	ret
+
+0080088a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80088a:	55                   	push   %ebp
+  80088b:	89 e5                	mov    %esp,%ebp
+  80088d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800890:	b8 00 00 00 00       	mov    $0x0,%eax
+  800895:	eb 03                	jmp    80089a <strlen+0x10>
+		n++;
+  800897:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80089a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80089e:	75 f7                	jne    800897 <strlen+0xd>
+	return n;
+}
+  8008a0:	5d                   	pop    %ebp
+  8008a1:	c3                   	ret
+
+008008a2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008a2:	55                   	push   %ebp
+  8008a3:	89 e5                	mov    %esp,%ebp
+  8008a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b0:	eb 03                	jmp    8008b5 <strnlen+0x13>
+		n++;
+  8008b2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008b5:	39 d0                	cmp    %edx,%eax
+  8008b7:	74 08                	je     8008c1 <strnlen+0x1f>
+  8008b9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008bd:	75 f3                	jne    8008b2 <strnlen+0x10>
+  8008bf:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008c1:	89 d0                	mov    %edx,%eax
+  8008c3:	5d                   	pop    %ebp
+  8008c4:	c3                   	ret
+
+008008c5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008c5:	55                   	push   %ebp
+  8008c6:	89 e5                	mov    %esp,%ebp
+  8008c8:	53                   	push   %ebx
+  8008c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008d8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008db:	83 c0 01             	add    $0x1,%eax
+  8008de:	84 d2                	test   %dl,%dl
+  8008e0:	75 f2                	jne    8008d4 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008e2:	89 c8                	mov    %ecx,%eax
+  8008e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e7:	c9                   	leave
+  8008e8:	c3                   	ret
+
+008008e9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008e9:	55                   	push   %ebp
+  8008ea:	89 e5                	mov    %esp,%ebp
+  8008ec:	53                   	push   %ebx
+  8008ed:	83 ec 10             	sub    $0x10,%esp
+  8008f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008f3:	53                   	push   %ebx
+  8008f4:	e8 91 ff ff ff       	call   80088a <strlen>
+  8008f9:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008fc:	ff 75 0c             	push   0xc(%ebp)
+  8008ff:	01 d8                	add    %ebx,%eax
+  800901:	50                   	push   %eax
+  800902:	e8 be ff ff ff       	call   8008c5 <strcpy>
+	return dst;
+}
+  800907:	89 d8                	mov    %ebx,%eax
+  800909:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80090c:	c9                   	leave
+  80090d:	c3                   	ret
+
+0080090e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80090e:	55                   	push   %ebp
+  80090f:	89 e5                	mov    %esp,%ebp
+  800911:	56                   	push   %esi
+  800912:	53                   	push   %ebx
+  800913:	8b 75 08             	mov    0x8(%ebp),%esi
+  800916:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800919:	89 f3                	mov    %esi,%ebx
+  80091b:	03 5d 10             	add    0x10(%ebp),%ebx
+  80091e:	89 f0                	mov    %esi,%eax
+  800920:	eb 0f                	jmp    800931 <strncpy+0x23>
+		*dst++ = *src;
+  800922:	83 c0 01             	add    $0x1,%eax
+  800925:	0f b6 0a             	movzbl (%edx),%ecx
+  800928:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80092b:	80 f9 01             	cmp    $0x1,%cl
+  80092e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800931:	39 d8                	cmp    %ebx,%eax
+  800933:	75 ed                	jne    800922 <strncpy+0x14>
+	}
+	return ret;
+}
+  800935:	89 f0                	mov    %esi,%eax
+  800937:	5b                   	pop    %ebx
+  800938:	5e                   	pop    %esi
+  800939:	5d                   	pop    %ebp
+  80093a:	c3                   	ret
+
+0080093b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80093b:	55                   	push   %ebp
+  80093c:	89 e5                	mov    %esp,%ebp
+  80093e:	56                   	push   %esi
+  80093f:	53                   	push   %ebx
+  800940:	8b 75 08             	mov    0x8(%ebp),%esi
+  800943:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800946:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800949:	89 f0                	mov    %esi,%eax
+  80094b:	85 d2                	test   %edx,%edx
+  80094d:	74 21                	je     800970 <strlcpy+0x35>
+  80094f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800953:	89 f2                	mov    %esi,%edx
+  800955:	eb 09                	jmp    800960 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800957:	83 c1 01             	add    $0x1,%ecx
+  80095a:	83 c2 01             	add    $0x1,%edx
+  80095d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800960:	39 c2                	cmp    %eax,%edx
+  800962:	74 09                	je     80096d <strlcpy+0x32>
+  800964:	0f b6 19             	movzbl (%ecx),%ebx
+  800967:	84 db                	test   %bl,%bl
+  800969:	75 ec                	jne    800957 <strlcpy+0x1c>
+  80096b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80096d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800970:	29 f0                	sub    %esi,%eax
+}
+  800972:	5b                   	pop    %ebx
+  800973:	5e                   	pop    %esi
+  800974:	5d                   	pop    %ebp
+  800975:	c3                   	ret
+
+00800976 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80097c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80097f:	eb 06                	jmp    800987 <strcmp+0x11>
+		p++, q++;
+  800981:	83 c1 01             	add    $0x1,%ecx
+  800984:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800987:	0f b6 01             	movzbl (%ecx),%eax
+  80098a:	84 c0                	test   %al,%al
+  80098c:	74 04                	je     800992 <strcmp+0x1c>
+  80098e:	3a 02                	cmp    (%edx),%al
+  800990:	74 ef                	je     800981 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800992:	0f b6 c0             	movzbl %al,%eax
+  800995:	0f b6 12             	movzbl (%edx),%edx
+  800998:	29 d0                	sub    %edx,%eax
+}
+  80099a:	5d                   	pop    %ebp
+  80099b:	c3                   	ret
+
+0080099c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80099c:	55                   	push   %ebp
+  80099d:	89 e5                	mov    %esp,%ebp
+  80099f:	53                   	push   %ebx
+  8009a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009a6:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009a9:	eb 09                	jmp    8009b4 <strncmp+0x18>
+		n--, p++, q++;
+  8009ab:	83 ea 01             	sub    $0x1,%edx
+  8009ae:	83 c0 01             	add    $0x1,%eax
+  8009b1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009b4:	85 d2                	test   %edx,%edx
+  8009b6:	74 18                	je     8009d0 <strncmp+0x34>
+  8009b8:	0f b6 18             	movzbl (%eax),%ebx
+  8009bb:	84 db                	test   %bl,%bl
+  8009bd:	74 04                	je     8009c3 <strncmp+0x27>
+  8009bf:	3a 19                	cmp    (%ecx),%bl
+  8009c1:	74 e8                	je     8009ab <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c3:	0f b6 00             	movzbl (%eax),%eax
+  8009c6:	0f b6 11             	movzbl (%ecx),%edx
+  8009c9:	29 d0                	sub    %edx,%eax
+}
+  8009cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ce:	c9                   	leave
+  8009cf:	c3                   	ret
+		return 0;
+  8009d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d5:	eb f4                	jmp    8009cb <strncmp+0x2f>
+
+008009d7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009d7:	55                   	push   %ebp
+  8009d8:	89 e5                	mov    %esp,%ebp
+  8009da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009dd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009e1:	eb 03                	jmp    8009e6 <strchr+0xf>
+  8009e3:	83 c0 01             	add    $0x1,%eax
+  8009e6:	0f b6 10             	movzbl (%eax),%edx
+  8009e9:	84 d2                	test   %dl,%dl
+  8009eb:	74 06                	je     8009f3 <strchr+0x1c>
+		if (*s == c)
+  8009ed:	38 ca                	cmp    %cl,%dl
+  8009ef:	75 f2                	jne    8009e3 <strchr+0xc>
+  8009f1:	eb 05                	jmp    8009f8 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f8:	5d                   	pop    %ebp
+  8009f9:	c3                   	ret
+
+008009fa <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009fa:	55                   	push   %ebp
+  8009fb:	89 e5                	mov    %esp,%ebp
+  8009fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a00:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a04:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a07:	38 ca                	cmp    %cl,%dl
+  800a09:	74 09                	je     800a14 <strfind+0x1a>
+  800a0b:	84 d2                	test   %dl,%dl
+  800a0d:	74 05                	je     800a14 <strfind+0x1a>
+	for (; *s; s++)
+  800a0f:	83 c0 01             	add    $0x1,%eax
+  800a12:	eb f0                	jmp    800a04 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a14:	5d                   	pop    %ebp
+  800a15:	c3                   	ret
+
+00800a16 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a16:	55                   	push   %ebp
+  800a17:	89 e5                	mov    %esp,%ebp
+  800a19:	57                   	push   %edi
+  800a1a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a1d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a20:	85 c9                	test   %ecx,%ecx
+  800a22:	74 20                	je     800a44 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a24:	89 f8                	mov    %edi,%eax
+  800a26:	09 c8                	or     %ecx,%eax
+  800a28:	a8 03                	test   $0x3,%al
+  800a2a:	75 12                	jne    800a3e <memset+0x28>
+		c &= 0xFF;
+  800a2c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a30:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a36:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a39:	fc                   	cld
+  800a3a:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a3c:	eb 06                	jmp    800a44 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a41:	fc                   	cld
+  800a42:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a44:	89 f8                	mov    %edi,%eax
+  800a46:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a49:	c9                   	leave
+  800a4a:	c3                   	ret
+
+00800a4b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a4b:	55                   	push   %ebp
+  800a4c:	89 e5                	mov    %esp,%ebp
+  800a4e:	57                   	push   %edi
+  800a4f:	56                   	push   %esi
+  800a50:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a53:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a56:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a59:	39 c6                	cmp    %eax,%esi
+  800a5b:	73 32                	jae    800a8f <memmove+0x44>
+  800a5d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a60:	39 d0                	cmp    %edx,%eax
+  800a62:	73 2b                	jae    800a8f <memmove+0x44>
+		s += n;
+		d += n;
+  800a64:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a67:	89 d6                	mov    %edx,%esi
+  800a69:	09 fe                	or     %edi,%esi
+  800a6b:	09 ce                	or     %ecx,%esi
+  800a6d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a73:	75 0e                	jne    800a83 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a75:	83 ef 04             	sub    $0x4,%edi
+  800a78:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a7b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a7e:	fd                   	std
+  800a7f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a81:	eb 09                	jmp    800a8c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a83:	83 ef 01             	sub    $0x1,%edi
+  800a86:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a89:	fd                   	std
+  800a8a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a8c:	fc                   	cld
+  800a8d:	eb 1a                	jmp    800aa9 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a8f:	89 f2                	mov    %esi,%edx
+  800a91:	09 c2                	or     %eax,%edx
+  800a93:	09 ca                	or     %ecx,%edx
+  800a95:	f6 c2 03             	test   $0x3,%dl
+  800a98:	75 0a                	jne    800aa4 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a9a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a9d:	89 c7                	mov    %eax,%edi
+  800a9f:	fc                   	cld
+  800aa0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aa2:	eb 05                	jmp    800aa9 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800aa4:	89 c7                	mov    %eax,%edi
+  800aa6:	fc                   	cld
+  800aa7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aa9:	5e                   	pop    %esi
+  800aaa:	5f                   	pop    %edi
+  800aab:	5d                   	pop    %ebp
+  800aac:	c3                   	ret
+
+00800aad <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800aad:	55                   	push   %ebp
+  800aae:	89 e5                	mov    %esp,%ebp
+  800ab0:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ab3:	ff 75 10             	push   0x10(%ebp)
+  800ab6:	ff 75 0c             	push   0xc(%ebp)
+  800ab9:	ff 75 08             	push   0x8(%ebp)
+  800abc:	e8 8a ff ff ff       	call   800a4b <memmove>
+}
+  800ac1:	c9                   	leave
+  800ac2:	c3                   	ret
+
+00800ac3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ac3:	55                   	push   %ebp
+  800ac4:	89 e5                	mov    %esp,%ebp
+  800ac6:	56                   	push   %esi
+  800ac7:	53                   	push   %ebx
+  800ac8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800acb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ace:	89 c6                	mov    %eax,%esi
+  800ad0:	03 75 10             	add    0x10(%ebp),%esi
+  800ad3:	eb 06                	jmp    800adb <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ad5:	83 c0 01             	add    $0x1,%eax
+  800ad8:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800adb:	39 f0                	cmp    %esi,%eax
+  800add:	74 14                	je     800af3 <memcmp+0x30>
+		if (*s1 != *s2)
+  800adf:	0f b6 08             	movzbl (%eax),%ecx
+  800ae2:	0f b6 1a             	movzbl (%edx),%ebx
+  800ae5:	38 d9                	cmp    %bl,%cl
+  800ae7:	74 ec                	je     800ad5 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ae9:	0f b6 c1             	movzbl %cl,%eax
+  800aec:	0f b6 db             	movzbl %bl,%ebx
+  800aef:	29 d8                	sub    %ebx,%eax
+  800af1:	eb 05                	jmp    800af8 <memcmp+0x35>
+	}
+
+	return 0;
+  800af3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af8:	5b                   	pop    %ebx
+  800af9:	5e                   	pop    %esi
+  800afa:	5d                   	pop    %ebp
+  800afb:	c3                   	ret
+
+00800afc <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800afc:	55                   	push   %ebp
+  800afd:	89 e5                	mov    %esp,%ebp
+  800aff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b05:	89 c2                	mov    %eax,%edx
+  800b07:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b0a:	eb 03                	jmp    800b0f <memfind+0x13>
+  800b0c:	83 c0 01             	add    $0x1,%eax
+  800b0f:	39 d0                	cmp    %edx,%eax
+  800b11:	73 04                	jae    800b17 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b13:	38 08                	cmp    %cl,(%eax)
+  800b15:	75 f5                	jne    800b0c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b17:	5d                   	pop    %ebp
+  800b18:	c3                   	ret
+
+00800b19 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b19:	55                   	push   %ebp
+  800b1a:	89 e5                	mov    %esp,%ebp
+  800b1c:	57                   	push   %edi
+  800b1d:	56                   	push   %esi
+  800b1e:	53                   	push   %ebx
+  800b1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b22:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b25:	eb 03                	jmp    800b2a <strtol+0x11>
+		s++;
+  800b27:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b2a:	0f b6 02             	movzbl (%edx),%eax
+  800b2d:	3c 20                	cmp    $0x20,%al
+  800b2f:	74 f6                	je     800b27 <strtol+0xe>
+  800b31:	3c 09                	cmp    $0x9,%al
+  800b33:	74 f2                	je     800b27 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b35:	3c 2b                	cmp    $0x2b,%al
+  800b37:	74 2a                	je     800b63 <strtol+0x4a>
+	int neg = 0;
+  800b39:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b3e:	3c 2d                	cmp    $0x2d,%al
+  800b40:	74 2b                	je     800b6d <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b42:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b48:	75 0f                	jne    800b59 <strtol+0x40>
+  800b4a:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b4d:	74 28                	je     800b77 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b4f:	85 db                	test   %ebx,%ebx
+  800b51:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b56:	0f 44 d8             	cmove  %eax,%ebx
+  800b59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b5e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b61:	eb 46                	jmp    800ba9 <strtol+0x90>
+		s++;
+  800b63:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b66:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b6b:	eb d5                	jmp    800b42 <strtol+0x29>
+		s++, neg = 1;
+  800b6d:	83 c2 01             	add    $0x1,%edx
+  800b70:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b75:	eb cb                	jmp    800b42 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b77:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b7b:	74 0e                	je     800b8b <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b7d:	85 db                	test   %ebx,%ebx
+  800b7f:	75 d8                	jne    800b59 <strtol+0x40>
+		s++, base = 8;
+  800b81:	83 c2 01             	add    $0x1,%edx
+  800b84:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b89:	eb ce                	jmp    800b59 <strtol+0x40>
+		s += 2, base = 16;
+  800b8b:	83 c2 02             	add    $0x2,%edx
+  800b8e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b93:	eb c4                	jmp    800b59 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b95:	0f be c0             	movsbl %al,%eax
+  800b98:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b9b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b9e:	7d 3a                	jge    800bda <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ba0:	83 c2 01             	add    $0x1,%edx
+  800ba3:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ba7:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ba9:	0f b6 02             	movzbl (%edx),%eax
+  800bac:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800baf:	89 f3                	mov    %esi,%ebx
+  800bb1:	80 fb 09             	cmp    $0x9,%bl
+  800bb4:	76 df                	jbe    800b95 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bb6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bb9:	89 f3                	mov    %esi,%ebx
+  800bbb:	80 fb 19             	cmp    $0x19,%bl
+  800bbe:	77 08                	ja     800bc8 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bc0:	0f be c0             	movsbl %al,%eax
+  800bc3:	83 e8 57             	sub    $0x57,%eax
+  800bc6:	eb d3                	jmp    800b9b <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bc8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bcb:	89 f3                	mov    %esi,%ebx
+  800bcd:	80 fb 19             	cmp    $0x19,%bl
+  800bd0:	77 08                	ja     800bda <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bd2:	0f be c0             	movsbl %al,%eax
+  800bd5:	83 e8 37             	sub    $0x37,%eax
+  800bd8:	eb c1                	jmp    800b9b <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bda:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bde:	74 05                	je     800be5 <strtol+0xcc>
+		*endptr = (char *) s;
+  800be0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800be3:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800be5:	89 c8                	mov    %ecx,%eax
+  800be7:	f7 d8                	neg    %eax
+  800be9:	85 ff                	test   %edi,%edi
+  800beb:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bee:	89 c8                	mov    %ecx,%eax
+  800bf0:	5b                   	pop    %ebx
+  800bf1:	5e                   	pop    %esi
+  800bf2:	5f                   	pop    %edi
+  800bf3:	5d                   	pop    %ebp
+  800bf4:	c3                   	ret
+
+00800bf5 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bf5:	55                   	push   %ebp
+  800bf6:	89 e5                	mov    %esp,%ebp
+  800bf8:	57                   	push   %edi
+  800bf9:	56                   	push   %esi
+  800bfa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c06:	89 c3                	mov    %eax,%ebx
+  800c08:	89 c7                	mov    %eax,%edi
+  800c0a:	55                   	push   %ebp
+  800c0b:	89 e5                	mov    %esp,%ebp
+  800c0d:	8d 35 15 0c 80 00    	lea    0x800c15,%esi
+  800c13:	0f 34                	sysenter
+  800c15:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800c16:	5b                   	pop    %ebx
+  800c17:	5e                   	pop    %esi
+  800c18:	5f                   	pop    %edi
+  800c19:	5d                   	pop    %ebp
+  800c1a:	c3                   	ret
+
+00800c1b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c1b:	55                   	push   %ebp
+  800c1c:	89 e5                	mov    %esp,%ebp
+  800c1e:	57                   	push   %edi
+  800c1f:	56                   	push   %esi
+  800c20:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c26:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c2b:	89 d1                	mov    %edx,%ecx
+  800c2d:	89 d3                	mov    %edx,%ebx
+  800c2f:	89 d7                	mov    %edx,%edi
+  800c31:	55                   	push   %ebp
+  800c32:	89 e5                	mov    %esp,%ebp
+  800c34:	8d 35 3c 0c 80 00    	lea    0x800c3c,%esi
+  800c3a:	0f 34                	sysenter
+  800c3c:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800c3d:	5b                   	pop    %ebx
+  800c3e:	5e                   	pop    %esi
+  800c3f:	5f                   	pop    %edi
+  800c40:	5d                   	pop    %ebp
+  800c41:	c3                   	ret
+
+00800c42 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c42:	55                   	push   %ebp
+  800c43:	89 e5                	mov    %esp,%ebp
+  800c45:	57                   	push   %edi
+  800c46:	56                   	push   %esi
+  800c47:	53                   	push   %ebx
+  800c48:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c53:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c58:	89 cb                	mov    %ecx,%ebx
+  800c5a:	89 cf                	mov    %ecx,%edi
+  800c5c:	55                   	push   %ebp
+  800c5d:	89 e5                	mov    %esp,%ebp
+  800c5f:	8d 35 67 0c 80 00    	lea    0x800c67,%esi
+  800c65:	0f 34                	sysenter
+  800c67:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c68:	85 c0                	test   %eax,%eax
+  800c6a:	7f 08                	jg     800c74 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800c6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6f:	5b                   	pop    %ebx
+  800c70:	5e                   	pop    %esi
+  800c71:	5f                   	pop    %edi
+  800c72:	5d                   	pop    %ebp
+  800c73:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c74:	83 ec 0c             	sub    $0xc,%esp
+  800c77:	50                   	push   %eax
+  800c78:	6a 03                	push   $0x3
+  800c7a:	68 c7 3f 80 00       	push   $0x803fc7
+  800c7f:	6a 3d                	push   $0x3d
+  800c81:	68 e4 3f 80 00       	push   $0x803fe4
+  800c86:	e8 65 26 00 00       	call   8032f0 <_panic>
+
+00800c8b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c8b:	55                   	push   %ebp
+  800c8c:	89 e5                	mov    %esp,%ebp
+  800c8e:	57                   	push   %edi
+  800c8f:	56                   	push   %esi
+  800c90:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c91:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c96:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c9b:	89 d1                	mov    %edx,%ecx
+  800c9d:	89 d3                	mov    %edx,%ebx
+  800c9f:	89 d7                	mov    %edx,%edi
+  800ca1:	55                   	push   %ebp
+  800ca2:	89 e5                	mov    %esp,%ebp
+  800ca4:	8d 35 ac 0c 80 00    	lea    0x800cac,%esi
+  800caa:	0f 34                	sysenter
+  800cac:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800cad:	5b                   	pop    %ebx
+  800cae:	5e                   	pop    %esi
+  800caf:	5f                   	pop    %edi
+  800cb0:	5d                   	pop    %ebp
+  800cb1:	c3                   	ret
+
+00800cb2 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cb2:	55                   	push   %ebp
+  800cb3:	89 e5                	mov    %esp,%ebp
+  800cb5:	57                   	push   %edi
+  800cb6:	56                   	push   %esi
+  800cb7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cbd:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cc2:	89 d1                	mov    %edx,%ecx
+  800cc4:	89 d3                	mov    %edx,%ebx
+  800cc6:	89 d7                	mov    %edx,%edi
+  800cc8:	89 d6                	mov    %edx,%esi
+  800cca:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ccc:	5b                   	pop    %ebx
+  800ccd:	5e                   	pop    %esi
+  800cce:	5f                   	pop    %edi
+  800ccf:	5d                   	pop    %ebp
+  800cd0:	c3                   	ret
+
+00800cd1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cd1:	55                   	push   %ebp
+  800cd2:	89 e5                	mov    %esp,%ebp
+  800cd4:	57                   	push   %edi
+  800cd5:	56                   	push   %esi
+  800cd6:	53                   	push   %ebx
+  800cd7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ce5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ced:	55                   	push   %ebp
+  800cee:	89 e5                	mov    %esp,%ebp
+  800cf0:	8d 35 f8 0c 80 00    	lea    0x800cf8,%esi
+  800cf6:	0f 34                	sysenter
+  800cf8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cf9:	85 c0                	test   %eax,%eax
+  800cfb:	7f 08                	jg     800d05 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800cfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d00:	5b                   	pop    %ebx
+  800d01:	5e                   	pop    %esi
+  800d02:	5f                   	pop    %edi
+  800d03:	5d                   	pop    %ebp
+  800d04:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d05:	83 ec 0c             	sub    $0xc,%esp
+  800d08:	50                   	push   %eax
+  800d09:	6a 04                	push   $0x4
+  800d0b:	68 c7 3f 80 00       	push   $0x803fc7
+  800d10:	6a 3d                	push   $0x3d
+  800d12:	68 e4 3f 80 00       	push   $0x803fe4
+  800d17:	e8 d4 25 00 00       	call   8032f0 <_panic>
+
+00800d1c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d1c:	55                   	push   %ebp
+  800d1d:	89 e5                	mov    %esp,%ebp
+  800d1f:	57                   	push   %edi
+  800d20:	56                   	push   %esi
+  800d21:	53                   	push   %ebx
+  800d22:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d33:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d36:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d39:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d3b:	85 c0                	test   %eax,%eax
+  800d3d:	7f 08                	jg     800d47 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d42:	5b                   	pop    %ebx
+  800d43:	5e                   	pop    %esi
+  800d44:	5f                   	pop    %edi
+  800d45:	5d                   	pop    %ebp
+  800d46:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d47:	83 ec 0c             	sub    $0xc,%esp
+  800d4a:	50                   	push   %eax
+  800d4b:	6a 05                	push   $0x5
+  800d4d:	68 c7 3f 80 00       	push   $0x803fc7
+  800d52:	6a 23                	push   $0x23
+  800d54:	68 e4 3f 80 00       	push   $0x803fe4
+  800d59:	e8 92 25 00 00       	call   8032f0 <_panic>
+
+00800d5e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d5e:	55                   	push   %ebp
+  800d5f:	89 e5                	mov    %esp,%ebp
+  800d61:	57                   	push   %edi
+  800d62:	56                   	push   %esi
+  800d63:	53                   	push   %ebx
+  800d64:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d72:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d77:	89 df                	mov    %ebx,%edi
+  800d79:	55                   	push   %ebp
+  800d7a:	89 e5                	mov    %esp,%ebp
+  800d7c:	8d 35 84 0d 80 00    	lea    0x800d84,%esi
+  800d82:	0f 34                	sysenter
+  800d84:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d85:	85 c0                	test   %eax,%eax
+  800d87:	7f 08                	jg     800d91 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800d89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8c:	5b                   	pop    %ebx
+  800d8d:	5e                   	pop    %esi
+  800d8e:	5f                   	pop    %edi
+  800d8f:	5d                   	pop    %ebp
+  800d90:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d91:	83 ec 0c             	sub    $0xc,%esp
+  800d94:	50                   	push   %eax
+  800d95:	6a 06                	push   $0x6
+  800d97:	68 c7 3f 80 00       	push   $0x803fc7
+  800d9c:	6a 3d                	push   $0x3d
+  800d9e:	68 e4 3f 80 00       	push   $0x803fe4
+  800da3:	e8 48 25 00 00       	call   8032f0 <_panic>
+
+00800da8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800da8:	55                   	push   %ebp
+  800da9:	89 e5                	mov    %esp,%ebp
+  800dab:	57                   	push   %edi
+  800dac:	56                   	push   %esi
+  800dad:	53                   	push   %ebx
+  800dae:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800db1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbc:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dc1:	89 df                	mov    %ebx,%edi
+  800dc3:	55                   	push   %ebp
+  800dc4:	89 e5                	mov    %esp,%ebp
+  800dc6:	8d 35 ce 0d 80 00    	lea    0x800dce,%esi
+  800dcc:	0f 34                	sysenter
+  800dce:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800dcf:	85 c0                	test   %eax,%eax
+  800dd1:	7f 08                	jg     800ddb <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800dd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd6:	5b                   	pop    %ebx
+  800dd7:	5e                   	pop    %esi
+  800dd8:	5f                   	pop    %edi
+  800dd9:	5d                   	pop    %ebp
+  800dda:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ddb:	83 ec 0c             	sub    $0xc,%esp
+  800dde:	50                   	push   %eax
+  800ddf:	6a 08                	push   $0x8
+  800de1:	68 c7 3f 80 00       	push   $0x803fc7
+  800de6:	6a 3d                	push   $0x3d
+  800de8:	68 e4 3f 80 00       	push   $0x803fe4
+  800ded:	e8 fe 24 00 00       	call   8032f0 <_panic>
+
+00800df2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	57                   	push   %edi
+  800df6:	56                   	push   %esi
+  800df7:	53                   	push   %ebx
+  800df8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800dfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e06:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e0b:	89 df                	mov    %ebx,%edi
+  800e0d:	55                   	push   %ebp
+  800e0e:	89 e5                	mov    %esp,%ebp
+  800e10:	8d 35 18 0e 80 00    	lea    0x800e18,%esi
+  800e16:	0f 34                	sysenter
+  800e18:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e19:	85 c0                	test   %eax,%eax
+  800e1b:	7f 08                	jg     800e25 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800e1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e20:	5b                   	pop    %ebx
+  800e21:	5e                   	pop    %esi
+  800e22:	5f                   	pop    %edi
+  800e23:	5d                   	pop    %ebp
+  800e24:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e25:	83 ec 0c             	sub    $0xc,%esp
+  800e28:	50                   	push   %eax
+  800e29:	6a 09                	push   $0x9
+  800e2b:	68 c7 3f 80 00       	push   $0x803fc7
+  800e30:	6a 3d                	push   $0x3d
+  800e32:	68 e4 3f 80 00       	push   $0x803fe4
+  800e37:	e8 b4 24 00 00       	call   8032f0 <_panic>
+
+00800e3c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e3c:	55                   	push   %ebp
+  800e3d:	89 e5                	mov    %esp,%ebp
+  800e3f:	57                   	push   %edi
+  800e40:	56                   	push   %esi
+  800e41:	53                   	push   %ebx
+  800e42:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e50:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e55:	89 df                	mov    %ebx,%edi
+  800e57:	55                   	push   %ebp
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	8d 35 62 0e 80 00    	lea    0x800e62,%esi
+  800e60:	0f 34                	sysenter
+  800e62:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e63:	85 c0                	test   %eax,%eax
+  800e65:	7f 08                	jg     800e6f <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800e67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6a:	5b                   	pop    %ebx
+  800e6b:	5e                   	pop    %esi
+  800e6c:	5f                   	pop    %edi
+  800e6d:	5d                   	pop    %ebp
+  800e6e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e6f:	83 ec 0c             	sub    $0xc,%esp
+  800e72:	50                   	push   %eax
+  800e73:	6a 0a                	push   $0xa
+  800e75:	68 c7 3f 80 00       	push   $0x803fc7
+  800e7a:	6a 3d                	push   $0x3d
+  800e7c:	68 e4 3f 80 00       	push   $0x803fe4
+  800e81:	e8 6a 24 00 00       	call   8032f0 <_panic>
+
+00800e86 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e86:	55                   	push   %ebp
+  800e87:	89 e5                	mov    %esp,%ebp
+  800e89:	57                   	push   %edi
+  800e8a:	56                   	push   %esi
+  800e8b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e92:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e9d:	55                   	push   %ebp
+  800e9e:	89 e5                	mov    %esp,%ebp
+  800ea0:	8d 35 a8 0e 80 00    	lea    0x800ea8,%esi
+  800ea6:	0f 34                	sysenter
+  800ea8:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800ea9:	5b                   	pop    %ebx
+  800eaa:	5e                   	pop    %esi
+  800eab:	5f                   	pop    %edi
+  800eac:	5d                   	pop    %ebp
+  800ead:	c3                   	ret
+
+00800eae <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800eae:	55                   	push   %ebp
+  800eaf:	89 e5                	mov    %esp,%ebp
+  800eb1:	57                   	push   %edi
+  800eb2:	56                   	push   %esi
+  800eb3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eba:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ebf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	8d 35 d0 0e 80 00    	lea    0x800ed0,%esi
+  800ece:	0f 34                	sysenter
+  800ed0:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800ed1:	5b                   	pop    %ebx
+  800ed2:	5e                   	pop    %esi
+  800ed3:	5f                   	pop    %edi
+  800ed4:	5d                   	pop    %ebp
+  800ed5:	c3                   	ret
+
+00800ed6 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800ed6:	55                   	push   %ebp
+  800ed7:	89 e5                	mov    %esp,%ebp
+  800ed9:	57                   	push   %edi
+  800eda:	56                   	push   %esi
+  800edb:	53                   	push   %ebx
+  800edc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800edf:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eea:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef2:	89 f7                	mov    %esi,%edi
+  800ef4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef6:	85 c0                	test   %eax,%eax
+  800ef8:	7f 08                	jg     800f02 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800efa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efd:	5b                   	pop    %ebx
+  800efe:	5e                   	pop    %esi
+  800eff:	5f                   	pop    %edi
+  800f00:	5d                   	pop    %ebp
+  800f01:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f02:	83 ec 0c             	sub    $0xc,%esp
+  800f05:	50                   	push   %eax
+  800f06:	6a 0d                	push   $0xd
+  800f08:	68 c7 3f 80 00       	push   $0x803fc7
+  800f0d:	6a 23                	push   $0x23
+  800f0f:	68 e4 3f 80 00       	push   $0x803fe4
+  800f14:	e8 d7 23 00 00       	call   8032f0 <_panic>
+
+00800f19 <sys_ipc_recv>:
+{
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800f1f:	6a 00                	push   $0x0
+  800f21:	6a 01                	push   $0x1
+  800f23:	ff 75 08             	push   0x8(%ebp)
+  800f26:	e8 ab ff ff ff       	call   800ed6 <sys_ipc_recvv>
+}
+  800f2b:	c9                   	leave
+  800f2c:	c3                   	ret
+
+00800f2d <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800f2d:	55                   	push   %ebp
+  800f2e:	89 e5                	mov    %esp,%ebp
+  800f30:	57                   	push   %edi
+  800f31:	56                   	push   %esi
+  800f32:	53                   	push   %ebx
+  800f33:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f41:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f46:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800f49:	89 de                	mov    %ebx,%esi
+  800f4b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4d:	85 c0                	test   %eax,%eax
+  800f4f:	7f 08                	jg     800f59 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800f51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f54:	5b                   	pop    %ebx
+  800f55:	5e                   	pop    %esi
+  800f56:	5f                   	pop    %edi
+  800f57:	5d                   	pop    %ebp
+  800f58:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f59:	83 ec 0c             	sub    $0xc,%esp
+  800f5c:	50                   	push   %eax
+  800f5d:	6a 0d                	push   $0xd
+  800f5f:	68 c7 3f 80 00       	push   $0x803fc7
+  800f64:	6a 23                	push   $0x23
+  800f66:	68 e4 3f 80 00       	push   $0x803fe4
+  800f6b:	e8 80 23 00 00       	call   8032f0 <_panic>
+
+00800f70 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f70:	55                   	push   %ebp
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	57                   	push   %edi
+  800f74:	56                   	push   %esi
+  800f75:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f80:	89 d1                	mov    %edx,%ecx
+  800f82:	89 d3                	mov    %edx,%ebx
+  800f84:	89 d7                	mov    %edx,%edi
+  800f86:	55                   	push   %ebp
+  800f87:	89 e5                	mov    %esp,%ebp
+  800f89:	8d 35 91 0f 80 00    	lea    0x800f91,%esi
+  800f8f:	0f 34                	sysenter
+  800f91:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800f92:	5b                   	pop    %ebx
+  800f93:	5e                   	pop    %esi
+  800f94:	5f                   	pop    %edi
+  800f95:	5d                   	pop    %ebp
+  800f96:	c3                   	ret
+
+00800f97 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800f97:	55                   	push   %ebp
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	57                   	push   %edi
+  800f9b:	56                   	push   %esi
+  800f9c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fad:	89 df                	mov    %ebx,%edi
+  800faf:	55                   	push   %ebp
+  800fb0:	89 e5                	mov    %esp,%ebp
+  800fb2:	8d 35 ba 0f 80 00    	lea    0x800fba,%esi
+  800fb8:	0f 34                	sysenter
+  800fba:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800fbb:	5b                   	pop    %ebx
+  800fbc:	5e                   	pop    %esi
+  800fbd:	5f                   	pop    %edi
+  800fbe:	5d                   	pop    %ebp
+  800fbf:	c3                   	ret
+
+00800fc0 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800fc0:	55                   	push   %ebp
+  800fc1:	89 e5                	mov    %esp,%ebp
+  800fc3:	57                   	push   %edi
+  800fc4:	56                   	push   %esi
+  800fc5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fcb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fce:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fd3:	89 cb                	mov    %ecx,%ebx
+  800fd5:	89 cf                	mov    %ecx,%edi
+  800fd7:	55                   	push   %ebp
+  800fd8:	89 e5                	mov    %esp,%ebp
+  800fda:	8d 35 e2 0f 80 00    	lea    0x800fe2,%esi
+  800fe0:	0f 34                	sysenter
+  800fe2:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800fe3:	5b                   	pop    %ebx
+  800fe4:	5e                   	pop    %esi
+  800fe5:	5f                   	pop    %edi
+  800fe6:	5d                   	pop    %ebp
+  800fe7:	c3                   	ret
+
+00800fe8 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800fe8:	55                   	push   %ebp
+  800fe9:	89 e5                	mov    %esp,%ebp
+  800feb:	57                   	push   %edi
+  800fec:	56                   	push   %esi
+  800fed:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff9:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ffe:	89 df                	mov    %ebx,%edi
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	8d 35 0b 10 80 00    	lea    0x80100b,%esi
+  801009:	0f 34                	sysenter
+  80100b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  80100c:	5b                   	pop    %ebx
+  80100d:	5e                   	pop    %esi
+  80100e:	5f                   	pop    %edi
+  80100f:	5d                   	pop    %ebp
+  801010:	c3                   	ret
+
+00801011 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  801011:	55                   	push   %ebp
+  801012:	89 e5                	mov    %esp,%ebp
+  801014:	57                   	push   %edi
+  801015:	56                   	push   %esi
+  801016:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801017:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801022:	b8 14 00 00 00       	mov    $0x14,%eax
+  801027:	89 df                	mov    %ebx,%edi
+  801029:	55                   	push   %ebp
+  80102a:	89 e5                	mov    %esp,%ebp
+  80102c:	8d 35 34 10 80 00    	lea    0x801034,%esi
+  801032:	0f 34                	sysenter
+  801034:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  801035:	5b                   	pop    %ebx
+  801036:	5e                   	pop    %esi
+  801037:	5f                   	pop    %edi
+  801038:	5d                   	pop    %ebp
+  801039:	c3                   	ret
+
+0080103a <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  80103a:	55                   	push   %ebp
+  80103b:	89 e5                	mov    %esp,%ebp
+  80103d:	57                   	push   %edi
+  80103e:	56                   	push   %esi
+  80103f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801040:	8b 55 08             	mov    0x8(%ebp),%edx
+  801043:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801046:	b8 13 00 00 00       	mov    $0x13,%eax
+  80104b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80104e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	8d 35 5c 10 80 00    	lea    0x80105c,%esi
+  80105a:	0f 34                	sysenter
+  80105c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  80105d:	5b                   	pop    %ebx
+  80105e:	5e                   	pop    %esi
+  80105f:	5f                   	pop    %edi
+  801060:	5d                   	pop    %ebp
+  801061:	c3                   	ret
+
+00801062 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801062:	55                   	push   %ebp
+  801063:	89 e5                	mov    %esp,%ebp
+  801065:	57                   	push   %edi
+  801066:	56                   	push   %esi
+  801067:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801068:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80106d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801070:	b8 11 00 00 00       	mov    $0x11,%eax
+  801075:	89 cb                	mov    %ecx,%ebx
+  801077:	89 cf                	mov    %ecx,%edi
+  801079:	89 ce                	mov    %ecx,%esi
+  80107b:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  80107d:	5b                   	pop    %ebx
+  80107e:	5e                   	pop    %esi
+  80107f:	5f                   	pop    %edi
+  801080:	5d                   	pop    %ebp
+  801081:	c3                   	ret
+
+00801082 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  801082:	55                   	push   %ebp
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	57                   	push   %edi
+  801086:	56                   	push   %esi
+  801087:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801088:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80108d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801090:	b8 15 00 00 00       	mov    $0x15,%eax
+  801095:	89 cb                	mov    %ecx,%ebx
+  801097:	89 cf                	mov    %ecx,%edi
+  801099:	55                   	push   %ebp
+  80109a:	89 e5                	mov    %esp,%ebp
+  80109c:	8d 35 a4 10 80 00    	lea    0x8010a4,%esi
+  8010a2:	0f 34                	sysenter
+  8010a4:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8010a5:	5b                   	pop    %ebx
+  8010a6:	5e                   	pop    %esi
+  8010a7:	5f                   	pop    %edi
+  8010a8:	5d                   	pop    %ebp
+  8010a9:	c3                   	ret
+
+008010aa <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8010aa:	55                   	push   %ebp
+  8010ab:	89 e5                	mov    %esp,%ebp
+  8010ad:	57                   	push   %edi
+  8010ae:	56                   	push   %esi
+  8010af:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b8:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010bd:	89 cb                	mov    %ecx,%ebx
+  8010bf:	89 cf                	mov    %ecx,%edi
+  8010c1:	55                   	push   %ebp
+  8010c2:	89 e5                	mov    %esp,%ebp
+  8010c4:	8d 35 cc 10 80 00    	lea    0x8010cc,%esi
+  8010ca:	0f 34                	sysenter
+  8010cc:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8010cd:	5b                   	pop    %ebx
+  8010ce:	5e                   	pop    %esi
+  8010cf:	5f                   	pop    %edi
+  8010d0:	5d                   	pop    %ebp
+  8010d1:	c3                   	ret
+
+008010d2 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  8010d2:	55                   	push   %ebp
+  8010d3:	89 e5                	mov    %esp,%ebp
+  8010d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010db:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  8010de:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  8010e0:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  8010e3:	83 3a 01             	cmpl   $0x1,(%edx)
+  8010e6:	7e 09                	jle    8010f1 <argstart+0x1f>
+  8010e8:	ba 58 3c 80 00       	mov    $0x803c58,%edx
+  8010ed:	85 c9                	test   %ecx,%ecx
+  8010ef:	75 05                	jne    8010f6 <argstart+0x24>
+  8010f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f6:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  8010f9:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  801100:	5d                   	pop    %ebp
+  801101:	c3                   	ret
+
+00801102 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  801102:	55                   	push   %ebp
+  801103:	89 e5                	mov    %esp,%ebp
+  801105:	53                   	push   %ebx
+  801106:	83 ec 04             	sub    $0x4,%esp
+  801109:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  80110c:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  801113:	8b 43 08             	mov    0x8(%ebx),%eax
+  801116:	85 c0                	test   %eax,%eax
+  801118:	74 74                	je     80118e <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  80111a:	80 38 00             	cmpb   $0x0,(%eax)
+  80111d:	75 48                	jne    801167 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  80111f:	8b 0b                	mov    (%ebx),%ecx
+  801121:	83 39 01             	cmpl   $0x1,(%ecx)
+  801124:	74 5a                	je     801180 <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  801126:	8b 53 04             	mov    0x4(%ebx),%edx
+  801129:	8b 42 04             	mov    0x4(%edx),%eax
+  80112c:	80 38 2d             	cmpb   $0x2d,(%eax)
+  80112f:	75 4f                	jne    801180 <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  801131:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801135:	74 49                	je     801180 <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  801137:	83 c0 01             	add    $0x1,%eax
+  80113a:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  80113d:	83 ec 04             	sub    $0x4,%esp
+  801140:	8b 01                	mov    (%ecx),%eax
+  801142:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  801149:	50                   	push   %eax
+  80114a:	8d 42 08             	lea    0x8(%edx),%eax
+  80114d:	50                   	push   %eax
+  80114e:	83 c2 04             	add    $0x4,%edx
+  801151:	52                   	push   %edx
+  801152:	e8 f4 f8 ff ff       	call   800a4b <memmove>
+		(*args->argc)--;
+  801157:	8b 03                	mov    (%ebx),%eax
+  801159:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  80115c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80115f:	83 c4 10             	add    $0x10,%esp
+  801162:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801165:	74 13                	je     80117a <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  801167:	8b 43 08             	mov    0x8(%ebx),%eax
+  80116a:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  80116d:	83 c0 01             	add    $0x1,%eax
+  801170:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  801173:	89 d0                	mov    %edx,%eax
+  801175:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801178:	c9                   	leave
+  801179:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  80117a:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  80117e:	75 e7                	jne    801167 <argnext+0x65>
+	args->curarg = 0;
+  801180:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  801187:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80118c:	eb e5                	jmp    801173 <argnext+0x71>
+		return -1;
+  80118e:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801193:	eb de                	jmp    801173 <argnext+0x71>
+
+00801195 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  801195:	55                   	push   %ebp
+  801196:	89 e5                	mov    %esp,%ebp
+  801198:	53                   	push   %ebx
+  801199:	83 ec 04             	sub    $0x4,%esp
+  80119c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  80119f:	8b 43 08             	mov    0x8(%ebx),%eax
+  8011a2:	85 c0                	test   %eax,%eax
+  8011a4:	74 12                	je     8011b8 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  8011a6:	80 38 00             	cmpb   $0x0,(%eax)
+  8011a9:	74 12                	je     8011bd <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  8011ab:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  8011ae:	c7 43 08 58 3c 80 00 	movl   $0x803c58,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  8011b5:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  8011b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011bb:	c9                   	leave
+  8011bc:	c3                   	ret
+	} else if (*args->argc > 1) {
+  8011bd:	8b 13                	mov    (%ebx),%edx
+  8011bf:	83 3a 01             	cmpl   $0x1,(%edx)
+  8011c2:	7f 10                	jg     8011d4 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  8011c4:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  8011cb:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  8011d2:	eb e1                	jmp    8011b5 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  8011d4:	8b 43 04             	mov    0x4(%ebx),%eax
+  8011d7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8011da:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8011dd:	83 ec 04             	sub    $0x4,%esp
+  8011e0:	8b 12                	mov    (%edx),%edx
+  8011e2:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  8011e9:	52                   	push   %edx
+  8011ea:	8d 50 08             	lea    0x8(%eax),%edx
+  8011ed:	52                   	push   %edx
+  8011ee:	83 c0 04             	add    $0x4,%eax
+  8011f1:	50                   	push   %eax
+  8011f2:	e8 54 f8 ff ff       	call   800a4b <memmove>
+		(*args->argc)--;
+  8011f7:	8b 03                	mov    (%ebx),%eax
+  8011f9:	83 28 01             	subl   $0x1,(%eax)
+  8011fc:	83 c4 10             	add    $0x10,%esp
+  8011ff:	eb b4                	jmp    8011b5 <argnextvalue+0x20>
+
+00801201 <argvalue>:
+{
+  801201:	55                   	push   %ebp
+  801202:	89 e5                	mov    %esp,%ebp
+  801204:	83 ec 08             	sub    $0x8,%esp
+  801207:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  80120a:	8b 42 0c             	mov    0xc(%edx),%eax
+  80120d:	85 c0                	test   %eax,%eax
+  80120f:	74 02                	je     801213 <argvalue+0x12>
+}
+  801211:	c9                   	leave
+  801212:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801213:	83 ec 0c             	sub    $0xc,%esp
+  801216:	52                   	push   %edx
+  801217:	e8 79 ff ff ff       	call   801195 <argnextvalue>
+  80121c:	83 c4 10             	add    $0x10,%esp
+  80121f:	eb f0                	jmp    801211 <argvalue+0x10>
+
+00801221 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801221:	55                   	push   %ebp
+  801222:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801224:	8b 45 08             	mov    0x8(%ebp),%eax
+  801227:	05 00 00 00 30       	add    $0x30000000,%eax
+  80122c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80122f:	5d                   	pop    %ebp
+  801230:	c3                   	ret
+
+00801231 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801231:	55                   	push   %ebp
+  801232:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801234:	8b 45 08             	mov    0x8(%ebp),%eax
+  801237:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80123c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801241:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801246:	5d                   	pop    %ebp
+  801247:	c3                   	ret
+
+00801248 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801248:	55                   	push   %ebp
+  801249:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80124b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801250:	eb 02                	jmp    801254 <fd_alloc+0xc>
+  801252:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801254:	89 c2                	mov    %eax,%edx
+  801256:	c1 ea 16             	shr    $0x16,%edx
+  801259:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801260:	f6 c2 01             	test   $0x1,%dl
+  801263:	74 2b                	je     801290 <fd_alloc+0x48>
+  801265:	89 c2                	mov    %eax,%edx
+  801267:	c1 ea 0c             	shr    $0xc,%edx
+  80126a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801271:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801277:	f6 c1 01             	test   $0x1,%cl
+  80127a:	74 14                	je     801290 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80127c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801282:	75 ce                	jne    801252 <fd_alloc+0xa>
+  801284:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801289:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80128e:	eb 05                	jmp    801295 <fd_alloc+0x4d>
+			return 0;
+  801290:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801295:	8b 55 08             	mov    0x8(%ebp),%edx
+  801298:	89 02                	mov    %eax,(%edx)
+}
+  80129a:	89 c8                	mov    %ecx,%eax
+  80129c:	5d                   	pop    %ebp
+  80129d:	c3                   	ret
+
+0080129e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80129e:	55                   	push   %ebp
+  80129f:	89 e5                	mov    %esp,%ebp
+  8012a1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8012a4:	83 f8 1f             	cmp    $0x1f,%eax
+  8012a7:	77 30                	ja     8012d9 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8012a9:	c1 e0 0c             	shl    $0xc,%eax
+  8012ac:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8012b1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012b7:	f6 c2 01             	test   $0x1,%dl
+  8012ba:	74 24                	je     8012e0 <fd_lookup+0x42>
+  8012bc:	89 c2                	mov    %eax,%edx
+  8012be:	c1 ea 0c             	shr    $0xc,%edx
+  8012c1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012c8:	f6 c2 01             	test   $0x1,%dl
+  8012cb:	74 1a                	je     8012e7 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012d0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012d7:	5d                   	pop    %ebp
+  8012d8:	c3                   	ret
+		return -E_INVAL;
+  8012d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012de:	eb f7                	jmp    8012d7 <fd_lookup+0x39>
+		return -E_INVAL;
+  8012e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012e5:	eb f0                	jmp    8012d7 <fd_lookup+0x39>
+  8012e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012ec:	eb e9                	jmp    8012d7 <fd_lookup+0x39>
+
+008012ee <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8012ee:	55                   	push   %ebp
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	53                   	push   %ebx
+  8012f2:	83 ec 04             	sub    $0x4,%esp
+  8012f5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8012f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fd:	eb 03                	jmp    801302 <dev_lookup+0x14>
+  8012ff:	83 c0 01             	add    $0x1,%eax
+  801302:	8b 1c 85 70 40 80 00 	mov    0x804070(,%eax,4),%ebx
+  801309:	85 db                	test   %ebx,%ebx
+  80130b:	74 0b                	je     801318 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80130d:	39 13                	cmp    %edx,(%ebx)
+  80130f:	75 ee                	jne    8012ff <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801311:	b8 00 00 00 00       	mov    $0x0,%eax
+  801316:	eb 1f                	jmp    801337 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801318:	a1 04 70 80 00       	mov    0x807004,%eax
+  80131d:	8b 40 48             	mov    0x48(%eax),%eax
+  801320:	83 ec 04             	sub    $0x4,%esp
+  801323:	52                   	push   %edx
+  801324:	50                   	push   %eax
+  801325:	68 f4 3f 80 00       	push   $0x803ff4
+  80132a:	e8 9c 20 00 00       	call   8033cb <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80132f:	83 c4 10             	add    $0x10,%esp
+  801332:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801337:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80133a:	89 1a                	mov    %ebx,(%edx)
+}
+  80133c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80133f:	c9                   	leave
+  801340:	c3                   	ret
+
+00801341 <fd_close>:
+{
+  801341:	55                   	push   %ebp
+  801342:	89 e5                	mov    %esp,%ebp
+  801344:	57                   	push   %edi
+  801345:	56                   	push   %esi
+  801346:	53                   	push   %ebx
+  801347:	83 ec 24             	sub    $0x24,%esp
+  80134a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80134d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801350:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801353:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801354:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80135a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80135d:	50                   	push   %eax
+  80135e:	e8 3b ff ff ff       	call   80129e <fd_lookup>
+  801363:	89 c3                	mov    %eax,%ebx
+  801365:	83 c4 10             	add    $0x10,%esp
+  801368:	85 c0                	test   %eax,%eax
+  80136a:	78 05                	js     801371 <fd_close+0x30>
+	    || fd != fd2)
+  80136c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80136f:	74 16                	je     801387 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801371:	89 f8                	mov    %edi,%eax
+  801373:	84 c0                	test   %al,%al
+  801375:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80137d:	89 d8                	mov    %ebx,%eax
+  80137f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801382:	5b                   	pop    %ebx
+  801383:	5e                   	pop    %esi
+  801384:	5f                   	pop    %edi
+  801385:	5d                   	pop    %ebp
+  801386:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801387:	83 ec 08             	sub    $0x8,%esp
+  80138a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80138d:	50                   	push   %eax
+  80138e:	ff 36                	push   (%esi)
+  801390:	e8 59 ff ff ff       	call   8012ee <dev_lookup>
+  801395:	89 c3                	mov    %eax,%ebx
+  801397:	83 c4 10             	add    $0x10,%esp
+  80139a:	85 c0                	test   %eax,%eax
+  80139c:	78 1a                	js     8013b8 <fd_close+0x77>
+		if (dev->dev_close)
+  80139e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013a1:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8013a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013a9:	85 c0                	test   %eax,%eax
+  8013ab:	74 0b                	je     8013b8 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8013ad:	83 ec 0c             	sub    $0xc,%esp
+  8013b0:	56                   	push   %esi
+  8013b1:	ff d0                	call   *%eax
+  8013b3:	89 c3                	mov    %eax,%ebx
+  8013b5:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013b8:	83 ec 08             	sub    $0x8,%esp
+  8013bb:	56                   	push   %esi
+  8013bc:	6a 00                	push   $0x0
+  8013be:	e8 9b f9 ff ff       	call   800d5e <sys_page_unmap>
+	return r;
+  8013c3:	83 c4 10             	add    $0x10,%esp
+  8013c6:	eb b5                	jmp    80137d <fd_close+0x3c>
+
+008013c8 <close>:
+
+int
+close(int fdnum)
+{
+  8013c8:	55                   	push   %ebp
+  8013c9:	89 e5                	mov    %esp,%ebp
+  8013cb:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013d1:	50                   	push   %eax
+  8013d2:	ff 75 08             	push   0x8(%ebp)
+  8013d5:	e8 c4 fe ff ff       	call   80129e <fd_lookup>
+  8013da:	83 c4 10             	add    $0x10,%esp
+  8013dd:	85 c0                	test   %eax,%eax
+  8013df:	79 02                	jns    8013e3 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8013e1:	c9                   	leave
+  8013e2:	c3                   	ret
+		return fd_close(fd, 1);
+  8013e3:	83 ec 08             	sub    $0x8,%esp
+  8013e6:	6a 01                	push   $0x1
+  8013e8:	ff 75 f4             	push   -0xc(%ebp)
+  8013eb:	e8 51 ff ff ff       	call   801341 <fd_close>
+  8013f0:	83 c4 10             	add    $0x10,%esp
+  8013f3:	eb ec                	jmp    8013e1 <close+0x19>
+
+008013f5 <close_all>:
+
+void
+close_all(void)
+{
+  8013f5:	55                   	push   %ebp
+  8013f6:	89 e5                	mov    %esp,%ebp
+  8013f8:	53                   	push   %ebx
+  8013f9:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8013fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801401:	83 ec 0c             	sub    $0xc,%esp
+  801404:	53                   	push   %ebx
+  801405:	e8 be ff ff ff       	call   8013c8 <close>
+	for (i = 0; i < MAXFD; i++)
+  80140a:	83 c3 01             	add    $0x1,%ebx
+  80140d:	83 c4 10             	add    $0x10,%esp
+  801410:	83 fb 20             	cmp    $0x20,%ebx
+  801413:	75 ec                	jne    801401 <close_all+0xc>
+}
+  801415:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801418:	c9                   	leave
+  801419:	c3                   	ret
+
+0080141a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80141a:	55                   	push   %ebp
+  80141b:	89 e5                	mov    %esp,%ebp
+  80141d:	57                   	push   %edi
+  80141e:	56                   	push   %esi
+  80141f:	53                   	push   %ebx
+  801420:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801423:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801426:	50                   	push   %eax
+  801427:	ff 75 08             	push   0x8(%ebp)
+  80142a:	e8 6f fe ff ff       	call   80129e <fd_lookup>
+  80142f:	89 c3                	mov    %eax,%ebx
+  801431:	83 c4 10             	add    $0x10,%esp
+  801434:	85 c0                	test   %eax,%eax
+  801436:	78 7f                	js     8014b7 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801438:	83 ec 0c             	sub    $0xc,%esp
+  80143b:	ff 75 0c             	push   0xc(%ebp)
+  80143e:	e8 85 ff ff ff       	call   8013c8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801443:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801446:	c1 e6 0c             	shl    $0xc,%esi
+  801449:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80144f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801452:	89 3c 24             	mov    %edi,(%esp)
+  801455:	e8 d7 fd ff ff       	call   801231 <fd2data>
+  80145a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80145c:	89 34 24             	mov    %esi,(%esp)
+  80145f:	e8 cd fd ff ff       	call   801231 <fd2data>
+  801464:	83 c4 10             	add    $0x10,%esp
+  801467:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80146a:	89 d8                	mov    %ebx,%eax
+  80146c:	c1 e8 16             	shr    $0x16,%eax
+  80146f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801476:	a8 01                	test   $0x1,%al
+  801478:	74 11                	je     80148b <dup+0x71>
+  80147a:	89 d8                	mov    %ebx,%eax
+  80147c:	c1 e8 0c             	shr    $0xc,%eax
+  80147f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801486:	f6 c2 01             	test   $0x1,%dl
+  801489:	75 36                	jne    8014c1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80148b:	89 f8                	mov    %edi,%eax
+  80148d:	c1 e8 0c             	shr    $0xc,%eax
+  801490:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801497:	83 ec 0c             	sub    $0xc,%esp
+  80149a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80149f:	50                   	push   %eax
+  8014a0:	56                   	push   %esi
+  8014a1:	6a 00                	push   $0x0
+  8014a3:	57                   	push   %edi
+  8014a4:	6a 00                	push   $0x0
+  8014a6:	e8 71 f8 ff ff       	call   800d1c <sys_page_map>
+  8014ab:	89 c3                	mov    %eax,%ebx
+  8014ad:	83 c4 20             	add    $0x20,%esp
+  8014b0:	85 c0                	test   %eax,%eax
+  8014b2:	78 33                	js     8014e7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014b4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014b7:	89 d8                	mov    %ebx,%eax
+  8014b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014bc:	5b                   	pop    %ebx
+  8014bd:	5e                   	pop    %esi
+  8014be:	5f                   	pop    %edi
+  8014bf:	5d                   	pop    %ebp
+  8014c0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014c1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014c8:	83 ec 0c             	sub    $0xc,%esp
+  8014cb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014d0:	50                   	push   %eax
+  8014d1:	ff 75 d4             	push   -0x2c(%ebp)
+  8014d4:	6a 00                	push   $0x0
+  8014d6:	53                   	push   %ebx
+  8014d7:	6a 00                	push   $0x0
+  8014d9:	e8 3e f8 ff ff       	call   800d1c <sys_page_map>
+  8014de:	89 c3                	mov    %eax,%ebx
+  8014e0:	83 c4 20             	add    $0x20,%esp
+  8014e3:	85 c0                	test   %eax,%eax
+  8014e5:	79 a4                	jns    80148b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8014e7:	83 ec 08             	sub    $0x8,%esp
+  8014ea:	56                   	push   %esi
+  8014eb:	6a 00                	push   $0x0
+  8014ed:	e8 6c f8 ff ff       	call   800d5e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8014f2:	83 c4 08             	add    $0x8,%esp
+  8014f5:	ff 75 d4             	push   -0x2c(%ebp)
+  8014f8:	6a 00                	push   $0x0
+  8014fa:	e8 5f f8 ff ff       	call   800d5e <sys_page_unmap>
+	return r;
+  8014ff:	83 c4 10             	add    $0x10,%esp
+  801502:	eb b3                	jmp    8014b7 <dup+0x9d>
+
+00801504 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801504:	55                   	push   %ebp
+  801505:	89 e5                	mov    %esp,%ebp
+  801507:	56                   	push   %esi
+  801508:	53                   	push   %ebx
+  801509:	83 ec 18             	sub    $0x18,%esp
+  80150c:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80150f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801512:	50                   	push   %eax
+  801513:	56                   	push   %esi
+  801514:	e8 85 fd ff ff       	call   80129e <fd_lookup>
+  801519:	83 c4 10             	add    $0x10,%esp
+  80151c:	85 c0                	test   %eax,%eax
+  80151e:	78 3c                	js     80155c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801520:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801523:	83 ec 08             	sub    $0x8,%esp
+  801526:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801529:	50                   	push   %eax
+  80152a:	ff 33                	push   (%ebx)
+  80152c:	e8 bd fd ff ff       	call   8012ee <dev_lookup>
+  801531:	83 c4 10             	add    $0x10,%esp
+  801534:	85 c0                	test   %eax,%eax
+  801536:	78 24                	js     80155c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801538:	8b 43 08             	mov    0x8(%ebx),%eax
+  80153b:	83 e0 03             	and    $0x3,%eax
+  80153e:	83 f8 01             	cmp    $0x1,%eax
+  801541:	74 20                	je     801563 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801543:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801546:	8b 40 08             	mov    0x8(%eax),%eax
+  801549:	85 c0                	test   %eax,%eax
+  80154b:	74 37                	je     801584 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80154d:	83 ec 04             	sub    $0x4,%esp
+  801550:	ff 75 10             	push   0x10(%ebp)
+  801553:	ff 75 0c             	push   0xc(%ebp)
+  801556:	53                   	push   %ebx
+  801557:	ff d0                	call   *%eax
+  801559:	83 c4 10             	add    $0x10,%esp
+}
+  80155c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80155f:	5b                   	pop    %ebx
+  801560:	5e                   	pop    %esi
+  801561:	5d                   	pop    %ebp
+  801562:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801563:	a1 04 70 80 00       	mov    0x807004,%eax
+  801568:	8b 40 48             	mov    0x48(%eax),%eax
+  80156b:	83 ec 04             	sub    $0x4,%esp
+  80156e:	56                   	push   %esi
+  80156f:	50                   	push   %eax
+  801570:	68 35 40 80 00       	push   $0x804035
+  801575:	e8 51 1e 00 00       	call   8033cb <cprintf>
+		return -E_INVAL;
+  80157a:	83 c4 10             	add    $0x10,%esp
+  80157d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801582:	eb d8                	jmp    80155c <read+0x58>
+		return -E_NOT_SUPP;
+  801584:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801589:	eb d1                	jmp    80155c <read+0x58>
+
+0080158b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80158b:	55                   	push   %ebp
+  80158c:	89 e5                	mov    %esp,%ebp
+  80158e:	57                   	push   %edi
+  80158f:	56                   	push   %esi
+  801590:	53                   	push   %ebx
+  801591:	83 ec 0c             	sub    $0xc,%esp
+  801594:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801597:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80159a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80159f:	eb 02                	jmp    8015a3 <readn+0x18>
+  8015a1:	01 c3                	add    %eax,%ebx
+  8015a3:	39 f3                	cmp    %esi,%ebx
+  8015a5:	73 21                	jae    8015c8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015a7:	83 ec 04             	sub    $0x4,%esp
+  8015aa:	89 f0                	mov    %esi,%eax
+  8015ac:	29 d8                	sub    %ebx,%eax
+  8015ae:	50                   	push   %eax
+  8015af:	89 d8                	mov    %ebx,%eax
+  8015b1:	03 45 0c             	add    0xc(%ebp),%eax
+  8015b4:	50                   	push   %eax
+  8015b5:	57                   	push   %edi
+  8015b6:	e8 49 ff ff ff       	call   801504 <read>
+		if (m < 0)
+  8015bb:	83 c4 10             	add    $0x10,%esp
+  8015be:	85 c0                	test   %eax,%eax
+  8015c0:	78 04                	js     8015c6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8015c2:	75 dd                	jne    8015a1 <readn+0x16>
+  8015c4:	eb 02                	jmp    8015c8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015c6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8015c8:	89 d8                	mov    %ebx,%eax
+  8015ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015cd:	5b                   	pop    %ebx
+  8015ce:	5e                   	pop    %esi
+  8015cf:	5f                   	pop    %edi
+  8015d0:	5d                   	pop    %ebp
+  8015d1:	c3                   	ret
+
+008015d2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015d2:	55                   	push   %ebp
+  8015d3:	89 e5                	mov    %esp,%ebp
+  8015d5:	56                   	push   %esi
+  8015d6:	53                   	push   %ebx
+  8015d7:	83 ec 18             	sub    $0x18,%esp
+  8015da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015dd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015e0:	50                   	push   %eax
+  8015e1:	53                   	push   %ebx
+  8015e2:	e8 b7 fc ff ff       	call   80129e <fd_lookup>
+  8015e7:	83 c4 10             	add    $0x10,%esp
+  8015ea:	85 c0                	test   %eax,%eax
+  8015ec:	78 37                	js     801625 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015ee:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015f1:	83 ec 08             	sub    $0x8,%esp
+  8015f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015f7:	50                   	push   %eax
+  8015f8:	ff 36                	push   (%esi)
+  8015fa:	e8 ef fc ff ff       	call   8012ee <dev_lookup>
+  8015ff:	83 c4 10             	add    $0x10,%esp
+  801602:	85 c0                	test   %eax,%eax
+  801604:	78 1f                	js     801625 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801606:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80160a:	74 20                	je     80162c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80160c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80160f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801612:	85 c0                	test   %eax,%eax
+  801614:	74 37                	je     80164d <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801616:	83 ec 04             	sub    $0x4,%esp
+  801619:	ff 75 10             	push   0x10(%ebp)
+  80161c:	ff 75 0c             	push   0xc(%ebp)
+  80161f:	56                   	push   %esi
+  801620:	ff d0                	call   *%eax
+  801622:	83 c4 10             	add    $0x10,%esp
+}
+  801625:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801628:	5b                   	pop    %ebx
+  801629:	5e                   	pop    %esi
+  80162a:	5d                   	pop    %ebp
+  80162b:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80162c:	a1 04 70 80 00       	mov    0x807004,%eax
+  801631:	8b 40 48             	mov    0x48(%eax),%eax
+  801634:	83 ec 04             	sub    $0x4,%esp
+  801637:	53                   	push   %ebx
+  801638:	50                   	push   %eax
+  801639:	68 51 40 80 00       	push   $0x804051
+  80163e:	e8 88 1d 00 00       	call   8033cb <cprintf>
+		return -E_INVAL;
+  801643:	83 c4 10             	add    $0x10,%esp
+  801646:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80164b:	eb d8                	jmp    801625 <write+0x53>
+		return -E_NOT_SUPP;
+  80164d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801652:	eb d1                	jmp    801625 <write+0x53>
+
+00801654 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801654:	55                   	push   %ebp
+  801655:	89 e5                	mov    %esp,%ebp
+  801657:	53                   	push   %ebx
+  801658:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80165b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80165e:	50                   	push   %eax
+  80165f:	ff 75 08             	push   0x8(%ebp)
+  801662:	e8 37 fc ff ff       	call   80129e <fd_lookup>
+  801667:	83 c4 10             	add    $0x10,%esp
+  80166a:	85 c0                	test   %eax,%eax
+  80166c:	78 3a                	js     8016a8 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80166e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801671:	83 ec 08             	sub    $0x8,%esp
+  801674:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801677:	50                   	push   %eax
+  801678:	ff 33                	push   (%ebx)
+  80167a:	e8 6f fc ff ff       	call   8012ee <dev_lookup>
+  80167f:	83 c4 10             	add    $0x10,%esp
+  801682:	85 c0                	test   %eax,%eax
+  801684:	78 22                	js     8016a8 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801686:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801689:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80168c:	85 c0                	test   %eax,%eax
+  80168e:	74 0d                	je     80169d <seek+0x49>
+  801690:	83 ec 0c             	sub    $0xc,%esp
+  801693:	53                   	push   %ebx
+  801694:	ff d0                	call   *%eax
+  801696:	83 c4 10             	add    $0x10,%esp
+  801699:	85 c0                	test   %eax,%eax
+  80169b:	78 0b                	js     8016a8 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  80169d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016a0:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8016a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016ab:	c9                   	leave
+  8016ac:	c3                   	ret
+
+008016ad <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8016ad:	55                   	push   %ebp
+  8016ae:	89 e5                	mov    %esp,%ebp
+  8016b0:	53                   	push   %ebx
+  8016b1:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016b4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016b7:	50                   	push   %eax
+  8016b8:	ff 75 08             	push   0x8(%ebp)
+  8016bb:	e8 de fb ff ff       	call   80129e <fd_lookup>
+  8016c0:	83 c4 10             	add    $0x10,%esp
+  8016c3:	85 c0                	test   %eax,%eax
+  8016c5:	78 2b                	js     8016f2 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016c7:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016ca:	83 ec 08             	sub    $0x8,%esp
+  8016cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d0:	50                   	push   %eax
+  8016d1:	ff 33                	push   (%ebx)
+  8016d3:	e8 16 fc ff ff       	call   8012ee <dev_lookup>
+  8016d8:	83 c4 10             	add    $0x10,%esp
+  8016db:	85 c0                	test   %eax,%eax
+  8016dd:	78 13                	js     8016f2 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8016df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e2:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8016e5:	85 c0                	test   %eax,%eax
+  8016e7:	74 0e                	je     8016f7 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8016e9:	83 ec 0c             	sub    $0xc,%esp
+  8016ec:	53                   	push   %ebx
+  8016ed:	ff d0                	call   *%eax
+  8016ef:	83 c4 10             	add    $0x10,%esp
+}
+  8016f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016f5:	c9                   	leave
+  8016f6:	c3                   	ret
+		return 0;
+  8016f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fc:	eb f4                	jmp    8016f2 <fsync+0x45>
+
+008016fe <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016fe:	55                   	push   %ebp
+  8016ff:	89 e5                	mov    %esp,%ebp
+  801701:	56                   	push   %esi
+  801702:	53                   	push   %ebx
+  801703:	83 ec 18             	sub    $0x18,%esp
+  801706:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801709:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80170c:	50                   	push   %eax
+  80170d:	53                   	push   %ebx
+  80170e:	e8 8b fb ff ff       	call   80129e <fd_lookup>
+  801713:	83 c4 10             	add    $0x10,%esp
+  801716:	85 c0                	test   %eax,%eax
+  801718:	78 34                	js     80174e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80171a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80171d:	83 ec 08             	sub    $0x8,%esp
+  801720:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801723:	50                   	push   %eax
+  801724:	ff 36                	push   (%esi)
+  801726:	e8 c3 fb ff ff       	call   8012ee <dev_lookup>
+  80172b:	83 c4 10             	add    $0x10,%esp
+  80172e:	85 c0                	test   %eax,%eax
+  801730:	78 1c                	js     80174e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801732:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801736:	74 1d                	je     801755 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801738:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80173b:	8b 40 18             	mov    0x18(%eax),%eax
+  80173e:	85 c0                	test   %eax,%eax
+  801740:	74 34                	je     801776 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801742:	83 ec 08             	sub    $0x8,%esp
+  801745:	ff 75 0c             	push   0xc(%ebp)
+  801748:	56                   	push   %esi
+  801749:	ff d0                	call   *%eax
+  80174b:	83 c4 10             	add    $0x10,%esp
+}
+  80174e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801751:	5b                   	pop    %ebx
+  801752:	5e                   	pop    %esi
+  801753:	5d                   	pop    %ebp
+  801754:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801755:	a1 04 70 80 00       	mov    0x807004,%eax
+  80175a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80175d:	83 ec 04             	sub    $0x4,%esp
+  801760:	53                   	push   %ebx
+  801761:	50                   	push   %eax
+  801762:	68 14 40 80 00       	push   $0x804014
+  801767:	e8 5f 1c 00 00       	call   8033cb <cprintf>
+		return -E_INVAL;
+  80176c:	83 c4 10             	add    $0x10,%esp
+  80176f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801774:	eb d8                	jmp    80174e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801776:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80177b:	eb d1                	jmp    80174e <ftruncate+0x50>
+
+0080177d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80177d:	55                   	push   %ebp
+  80177e:	89 e5                	mov    %esp,%ebp
+  801780:	56                   	push   %esi
+  801781:	53                   	push   %ebx
+  801782:	83 ec 18             	sub    $0x18,%esp
+  801785:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801788:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80178b:	50                   	push   %eax
+  80178c:	ff 75 08             	push   0x8(%ebp)
+  80178f:	e8 0a fb ff ff       	call   80129e <fd_lookup>
+  801794:	83 c4 10             	add    $0x10,%esp
+  801797:	85 c0                	test   %eax,%eax
+  801799:	78 49                	js     8017e4 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80179b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80179e:	83 ec 08             	sub    $0x8,%esp
+  8017a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017a4:	50                   	push   %eax
+  8017a5:	ff 36                	push   (%esi)
+  8017a7:	e8 42 fb ff ff       	call   8012ee <dev_lookup>
+  8017ac:	83 c4 10             	add    $0x10,%esp
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	78 31                	js     8017e4 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8017b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017b6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017ba:	74 2f                	je     8017eb <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017bc:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017bf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017c6:	00 00 00 
+	stat->st_isdir = 0;
+  8017c9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8017d0:	00 00 00 
+	stat->st_dev = dev;
+  8017d3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8017d9:	83 ec 08             	sub    $0x8,%esp
+  8017dc:	53                   	push   %ebx
+  8017dd:	56                   	push   %esi
+  8017de:	ff 50 14             	call   *0x14(%eax)
+  8017e1:	83 c4 10             	add    $0x10,%esp
+}
+  8017e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e7:	5b                   	pop    %ebx
+  8017e8:	5e                   	pop    %esi
+  8017e9:	5d                   	pop    %ebp
+  8017ea:	c3                   	ret
+		return -E_NOT_SUPP;
+  8017eb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017f0:	eb f2                	jmp    8017e4 <fstat+0x67>
+
+008017f2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8017f2:	55                   	push   %ebp
+  8017f3:	89 e5                	mov    %esp,%ebp
+  8017f5:	56                   	push   %esi
+  8017f6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  8017f7:	83 ec 08             	sub    $0x8,%esp
+  8017fa:	68 00 10 00 00       	push   $0x1000
+  8017ff:	ff 75 08             	push   0x8(%ebp)
+  801802:	e8 b3 07 00 00       	call   801fba <open>
+  801807:	89 c3                	mov    %eax,%ebx
+  801809:	83 c4 10             	add    $0x10,%esp
+  80180c:	85 c0                	test   %eax,%eax
+  80180e:	78 1b                	js     80182b <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801810:	83 ec 08             	sub    $0x8,%esp
+  801813:	ff 75 0c             	push   0xc(%ebp)
+  801816:	50                   	push   %eax
+  801817:	e8 61 ff ff ff       	call   80177d <fstat>
+  80181c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80181e:	89 1c 24             	mov    %ebx,(%esp)
+  801821:	e8 a2 fb ff ff       	call   8013c8 <close>
+	return r;
+  801826:	83 c4 10             	add    $0x10,%esp
+  801829:	89 f3                	mov    %esi,%ebx
+}
+  80182b:	89 d8                	mov    %ebx,%eax
+  80182d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801830:	5b                   	pop    %ebx
+  801831:	5e                   	pop    %esi
+  801832:	5d                   	pop    %ebp
+  801833:	c3                   	ret
+
+00801834 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801834:	55                   	push   %ebp
+  801835:	89 e5                	mov    %esp,%ebp
+  801837:	57                   	push   %edi
+  801838:	56                   	push   %esi
+  801839:	53                   	push   %ebx
+  80183a:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801840:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801846:	89 d6                	mov    %edx,%esi
+  801848:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  80184e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801851:	89 d3                	mov    %edx,%ebx
+  801853:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801859:	83 3d c8 90 80 00 00 	cmpl   $0x0,0x8090c8
+  801860:	74 1d                	je     80187f <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801862:	b8 00 80 80 00       	mov    $0x808000,%eax
+  801867:	83 c8 07             	or     $0x7,%eax
+  80186a:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801870:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801875:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  80187b:	01 ce                	add    %ecx,%esi
+  80187d:	eb 28                	jmp    8018a7 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80187f:	83 ec 0c             	sub    $0xc,%esp
+  801882:	6a 01                	push   $0x1
+  801884:	e8 0f 20 00 00       	call   803898 <ipc_find_env>
+  801889:	a3 c8 90 80 00       	mov    %eax,0x8090c8
+  80188e:	83 c4 10             	add    $0x10,%esp
+  801891:	eb cf                	jmp    801862 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801893:	83 c0 01             	add    $0x1,%eax
+  801896:	89 fa                	mov    %edi,%edx
+  801898:	09 da                	or     %ebx,%edx
+  80189a:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8018a1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8018a7:	39 f3                	cmp    %esi,%ebx
+  8018a9:	72 e8                	jb     801893 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  8018ab:	83 f8 41             	cmp    $0x41,%eax
+  8018ae:	77 2f                	ja     8018df <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  8018b0:	50                   	push   %eax
+  8018b1:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  8018b7:	50                   	push   %eax
+  8018b8:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  8018be:	ff 35 c8 90 80 00    	push   0x8090c8
+  8018c4:	e8 81 1f 00 00       	call   80384a <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  8018c9:	83 c4 0c             	add    $0xc,%esp
+  8018cc:	6a 00                	push   $0x0
+  8018ce:	6a 00                	push   $0x0
+  8018d0:	6a 00                	push   $0x0
+  8018d2:	e8 1d 1e 00 00       	call   8036f4 <ipc_recv>
+}
+  8018d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018da:	5b                   	pop    %ebx
+  8018db:	5e                   	pop    %esi
+  8018dc:	5f                   	pop    %edi
+  8018dd:	5d                   	pop    %ebp
+  8018de:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  8018df:	68 84 40 80 00       	push   $0x804084
+  8018e4:	68 a0 40 80 00       	push   $0x8040a0
+  8018e9:	6a 40                	push   $0x40
+  8018eb:	68 b5 40 80 00       	push   $0x8040b5
+  8018f0:	e8 fb 19 00 00       	call   8032f0 <_panic>
+
+008018f5 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  8018f5:	55                   	push   %ebp
+  8018f6:	89 e5                	mov    %esp,%ebp
+  8018f8:	57                   	push   %edi
+  8018f9:	56                   	push   %esi
+  8018fa:	53                   	push   %ebx
+  8018fb:	83 ec 1c             	sub    $0x1c,%esp
+  8018fe:	89 c3                	mov    %eax,%ebx
+  801900:	89 d6                	mov    %edx,%esi
+  801902:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801905:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  80190b:	89 ca                	mov    %ecx,%edx
+  80190d:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801910:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801917:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80191a:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801921:	8b 76 0c             	mov    0xc(%esi),%esi
+  801924:	89 fb                	mov    %edi,%ebx
+  801926:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  80192d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801930:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801937:	8b 75 08             	mov    0x8(%ebp),%esi
+  80193a:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801941:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801944:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  80194b:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  80194e:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801955:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  80195a:	39 c8                	cmp    %ecx,%eax
+  80195c:	74 0d                	je     80196b <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  80195e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801963:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801966:	5b                   	pop    %ebx
+  801967:	5e                   	pop    %esi
+  801968:	5f                   	pop    %edi
+  801969:	5d                   	pop    %ebp
+  80196a:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80196b:	6a 07                	push   $0x7
+  80196d:	68 00 80 80 00       	push   $0x808000
+  801972:	6a 0d                	push   $0xd
+  801974:	ff 35 c8 90 80 00    	push   0x8090c8
+  80197a:	e8 e0 1d 00 00       	call   80375f <ipc_send>
+  80197f:	83 c4 10             	add    $0x10,%esp
+  801982:	eb da                	jmp    80195e <fsring_post+0x69>
+
+00801984 <fsipcv>:
+{
+  801984:	55                   	push   %ebp
+  801985:	89 e5                	mov    %esp,%ebp
+  801987:	57                   	push   %edi
+  801988:	56                   	push   %esi
+  801989:	53                   	push   %ebx
+  80198a:	83 ec 0c             	sub    $0xc,%esp
+  80198d:	89 c7                	mov    %eax,%edi
+  80198f:	89 d3                	mov    %edx,%ebx
+  801991:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801993:	83 3d c8 90 80 00 00 	cmpl   $0x0,0x8090c8
+  80199a:	74 26                	je     8019c2 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80199c:	6a 07                	push   $0x7
+  80199e:	68 00 80 80 00       	push   $0x808000
+  8019a3:	57                   	push   %edi
+  8019a4:	ff 35 c8 90 80 00    	push   0x8090c8
+  8019aa:	e8 b0 1d 00 00       	call   80375f <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  8019af:	6a 00                	push   $0x0
+  8019b1:	56                   	push   %esi
+  8019b2:	53                   	push   %ebx
+  8019b3:	6a 00                	push   $0x0
+  8019b5:	e8 fd 1d 00 00       	call   8037b7 <ipc_recvv>
+}
+  8019ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019bd:	5b                   	pop    %ebx
+  8019be:	5e                   	pop    %esi
+  8019bf:	5f                   	pop    %edi
+  8019c0:	5d                   	pop    %ebp
+  8019c1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019c2:	83 ec 0c             	sub    $0xc,%esp
+  8019c5:	6a 01                	push   $0x1
+  8019c7:	e8 cc 1e 00 00       	call   803898 <ipc_find_env>
+  8019cc:	a3 c8 90 80 00       	mov    %eax,0x8090c8
+  8019d1:	83 c4 10             	add    $0x10,%esp
+  8019d4:	eb c6                	jmp    80199c <fsipcv+0x18>
+
+008019d6 <fsipc>:
+{
+  8019d6:	55                   	push   %ebp
+  8019d7:	89 e5                	mov    %esp,%ebp
+  8019d9:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  8019dc:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  8019e3:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8019e6:	e8 99 ff ff ff       	call   801984 <fsipcv>
+}
+  8019eb:	c9                   	leave
+  8019ec:	c3                   	ret
+
+008019ed <file_write_direct>:
+{
+  8019ed:	55                   	push   %ebp
+  8019ee:	89 e5                	mov    %esp,%ebp
+  8019f0:	56                   	push   %esi
+  8019f1:	53                   	push   %ebx
+  8019f2:	89 c3                	mov    %eax,%ebx
+  8019f4:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8019f6:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  8019fc:	77 40                	ja     801a3e <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8019fe:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801a03:	39 c8                	cmp    %ecx,%eax
+  801a05:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a08:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801a0b:	89 0d 00 80 80 00    	mov    %ecx,0x808000
+	fsipcbuf.write.req_n = n;
+  801a11:	a3 04 80 80 00       	mov    %eax,0x808004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801a16:	83 ec 04             	sub    $0x4,%esp
+  801a19:	50                   	push   %eax
+  801a1a:	52                   	push   %edx
+  801a1b:	68 08 80 80 00       	push   $0x808008
+  801a20:	e8 26 f0 ff ff       	call   800a4b <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801a25:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a2a:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a2f:	e8 a2 ff ff ff       	call   8019d6 <fsipc>
+  801a34:	83 c4 10             	add    $0x10,%esp
+}
+  801a37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a3a:	5b                   	pop    %ebx
+  801a3b:	5e                   	pop    %esi
+  801a3c:	5d                   	pop    %ebp
+  801a3d:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801a3e:	89 d6                	mov    %edx,%esi
+  801a40:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801a46:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801a4b:	29 f1                	sub    %esi,%ecx
+  801a4d:	39 c1                	cmp    %eax,%ecx
+  801a4f:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801a52:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a55:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.bulk.req_n = n;
+  801a5a:	89 0d 04 80 80 00    	mov    %ecx,0x808004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801a60:	89 35 08 80 80 00    	mov    %esi,0x808008
+	return fsipc_pages(type, buf, n, perm);
+  801a66:	83 ec 0c             	sub    $0xc,%esp
+  801a69:	6a 05                	push   $0x5
+  801a6b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801a70:	e8 bf fd ff ff       	call   801834 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801a75:	83 c4 10             	add    $0x10,%esp
+  801a78:	eb bd                	jmp    801a37 <file_write_direct+0x4a>
+
+00801a7a <devfile_sync>:
+{
+  801a7a:	55                   	push   %ebp
+  801a7b:	89 e5                	mov    %esp,%ebp
+  801a7d:	57                   	push   %edi
+  801a7e:	56                   	push   %esi
+  801a7f:	53                   	push   %ebx
+  801a80:	83 ec 28             	sub    $0x28,%esp
+  801a83:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801a86:	56                   	push   %esi
+  801a87:	e8 a5 f7 ff ff       	call   801231 <fd2data>
+  801a8c:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801a8e:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801a91:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801a98:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801a9b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801aa0:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801aa4:	74 45                	je     801aeb <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801aa6:	8b 46 14             	mov    0x14(%esi),%eax
+  801aa9:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801aac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ab6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801ab9:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801abc:	39 cb                	cmp    %ecx,%ebx
+  801abe:	73 14                	jae    801ad4 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801ac0:	29 d9                	sub    %ebx,%ecx
+  801ac2:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801ac5:	89 f0                	mov    %esi,%eax
+  801ac7:	e8 21 ff ff ff       	call   8019ed <file_write_direct>
+  801acc:	85 c0                	test   %eax,%eax
+  801ace:	7e 04                	jle    801ad4 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801ad0:	01 c3                	add    %eax,%ebx
+  801ad2:	eb e5                	jmp    801ab9 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801ad4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801ad7:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801ade:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801ae1:	85 c0                	test   %eax,%eax
+  801ae3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae8:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801aeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aee:	5b                   	pop    %ebx
+  801aef:	5e                   	pop    %esi
+  801af0:	5f                   	pop    %edi
+  801af1:	5d                   	pop    %ebp
+  801af2:	c3                   	ret
+
+00801af3 <devfile_write>:
+{
+  801af3:	55                   	push   %ebp
+  801af4:	89 e5                	mov    %esp,%ebp
+  801af6:	57                   	push   %edi
+  801af7:	56                   	push   %esi
+  801af8:	53                   	push   %ebx
+  801af9:	83 ec 28             	sub    $0x28,%esp
+  801afc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801aff:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801b02:	53                   	push   %ebx
+  801b03:	e8 29 f7 ff ff       	call   801231 <fd2data>
+  801b08:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801b0b:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801b0e:	83 c4 10             	add    $0x10,%esp
+  801b11:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801b15:	74 43                	je     801b5a <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801b17:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801b1e:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801b21:	85 c0                	test   %eax,%eax
+  801b23:	74 43                	je     801b68 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801b25:	89 c2                	mov    %eax,%edx
+  801b27:	03 53 14             	add    0x14(%ebx),%edx
+  801b2a:	39 fa                	cmp    %edi,%edx
+  801b2c:	75 0b                	jne    801b39 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801b2e:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801b31:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801b37:	76 66                	jbe    801b9f <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801b39:	83 ec 0c             	sub    $0xc,%esp
+  801b3c:	53                   	push   %ebx
+  801b3d:	e8 38 ff ff ff       	call   801a7a <devfile_sync>
+  801b42:	83 c4 10             	add    $0x10,%esp
+  801b45:	85 c0                	test   %eax,%eax
+  801b47:	78 4e                	js     801b97 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801b49:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801b4f:	77 56                	ja     801ba7 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801b51:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801b54:	85 c0                	test   %eax,%eax
+  801b56:	75 20                	jne    801b78 <devfile_write+0x85>
+  801b58:	eb 16                	jmp    801b70 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801b5a:	89 f1                	mov    %esi,%ecx
+  801b5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b5f:	89 d8                	mov    %ebx,%eax
+  801b61:	e8 87 fe ff ff       	call   8019ed <file_write_direct>
+  801b66:	eb 2f                	jmp    801b97 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801b68:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801b6e:	77 37                	ja     801ba7 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801b70:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801b73:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801b78:	83 ec 04             	sub    $0x4,%esp
+  801b7b:	56                   	push   %esi
+  801b7c:	ff 75 0c             	push   0xc(%ebp)
+  801b7f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801b82:	01 c1                	add    %eax,%ecx
+  801b84:	51                   	push   %ecx
+  801b85:	e8 c1 ee ff ff       	call   800a4b <memmove>
+	ff->buf_wlen += n;
+  801b8a:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801b8d:	01 f7                	add    %esi,%edi
+  801b8f:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801b92:	89 f0                	mov    %esi,%eax
+  801b94:	83 c4 10             	add    $0x10,%esp
+}
+  801b97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b9a:	5b                   	pop    %ebx
+  801b9b:	5e                   	pop    %esi
+  801b9c:	5f                   	pop    %edi
+  801b9d:	5d                   	pop    %ebp
+  801b9e:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801b9f:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801ba5:	76 d1                	jbe    801b78 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801ba7:	89 f1                	mov    %esi,%ecx
+  801ba9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bac:	89 d8                	mov    %ebx,%eax
+  801bae:	e8 3a fe ff ff       	call   8019ed <file_write_direct>
+  801bb3:	eb e2                	jmp    801b97 <devfile_write+0xa4>
+
+00801bb5 <devfile_trunc>:
+{
+  801bb5:	55                   	push   %ebp
+  801bb6:	89 e5                	mov    %esp,%ebp
+  801bb8:	53                   	push   %ebx
+  801bb9:	83 ec 10             	sub    $0x10,%esp
+  801bbc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801bbf:	53                   	push   %ebx
+  801bc0:	e8 b5 fe ff ff       	call   801a7a <devfile_sync>
+  801bc5:	83 c4 10             	add    $0x10,%esp
+  801bc8:	85 c0                	test   %eax,%eax
+  801bca:	78 1f                	js     801beb <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801bcc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801bcf:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801bd4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bd7:	a3 04 80 80 00       	mov    %eax,0x808004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801bdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801be1:	b8 02 00 00 00       	mov    $0x2,%eax
+  801be6:	e8 eb fd ff ff       	call   8019d6 <fsipc>
+}
+  801beb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bee:	c9                   	leave
+  801bef:	c3                   	ret
+
+00801bf0 <devfile_stat>:
+{
+  801bf0:	55                   	push   %ebp
+  801bf1:	89 e5                	mov    %esp,%ebp
+  801bf3:	56                   	push   %esi
+  801bf4:	53                   	push   %ebx
+  801bf5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801bf8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801bfb:	83 ec 0c             	sub    $0xc,%esp
+  801bfe:	53                   	push   %ebx
+  801bff:	e8 76 fe ff ff       	call   801a7a <devfile_sync>
+  801c04:	83 c4 10             	add    $0x10,%esp
+  801c07:	85 c0                	test   %eax,%eax
+  801c09:	78 47                	js     801c52 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801c0b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c0e:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801c13:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c18:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c1d:	e8 b4 fd ff ff       	call   8019d6 <fsipc>
+  801c22:	85 c0                	test   %eax,%eax
+  801c24:	78 2c                	js     801c52 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c26:	83 ec 08             	sub    $0x8,%esp
+  801c29:	68 00 80 80 00       	push   $0x808000
+  801c2e:	56                   	push   %esi
+  801c2f:	e8 91 ec ff ff       	call   8008c5 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801c34:	a1 80 80 80 00       	mov    0x808080,%eax
+  801c39:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c3f:	a1 84 80 80 00       	mov    0x808084,%eax
+  801c44:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801c4a:	83 c4 10             	add    $0x10,%esp
+  801c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c55:	5b                   	pop    %ebx
+  801c56:	5e                   	pop    %esi
+  801c57:	5d                   	pop    %ebp
+  801c58:	c3                   	ret
+
+00801c59 <devfile_flush>:
+{
+  801c59:	55                   	push   %ebp
+  801c5a:	89 e5                	mov    %esp,%ebp
+  801c5c:	56                   	push   %esi
+  801c5d:	53                   	push   %ebx
+  801c5e:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801c61:	83 ec 0c             	sub    $0xc,%esp
+  801c64:	56                   	push   %esi
+  801c65:	e8 10 fe ff ff       	call   801a7a <devfile_sync>
+  801c6a:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801c6c:	83 c4 10             	add    $0x10,%esp
+  801c6f:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801c73:	75 25                	jne    801c9a <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801c75:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c78:	a3 00 80 80 00       	mov    %eax,0x808000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801c7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c82:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c87:	e8 4a fd ff ff       	call   8019d6 <fsipc>
+  801c8c:	85 c0                	test   %eax,%eax
+  801c8e:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801c91:	89 d8                	mov    %ebx,%eax
+  801c93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c96:	5b                   	pop    %ebx
+  801c97:	5e                   	pop    %esi
+  801c98:	5d                   	pop    %ebp
+  801c99:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801c9a:	83 ec 0c             	sub    $0xc,%esp
+  801c9d:	56                   	push   %esi
+  801c9e:	e8 8e f5 ff ff       	call   801231 <fd2data>
+  801ca3:	83 c4 08             	add    $0x8,%esp
+  801ca6:	50                   	push   %eax
+  801ca7:	6a 00                	push   $0x0
+  801ca9:	e8 b0 f0 ff ff       	call   800d5e <sys_page_unmap>
+  801cae:	83 c4 10             	add    $0x10,%esp
+  801cb1:	eb c2                	jmp    801c75 <devfile_flush+0x1c>
+
+00801cb3 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801cb3:	55                   	push   %ebp
+  801cb4:	89 e5                	mov    %esp,%ebp
+  801cb6:	57                   	push   %edi
+  801cb7:	56                   	push   %esi
+  801cb8:	53                   	push   %ebx
+  801cb9:	83 ec 64             	sub    $0x64,%esp
+  801cbc:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801cbe:	52                   	push   %edx
+  801cbf:	50                   	push   %eax
+  801cc0:	e8 d9 f5 ff ff       	call   80129e <fd_lookup>
+  801cc5:	89 c1                	mov    %eax,%ecx
+  801cc7:	83 c4 10             	add    $0x10,%esp
+  801cca:	85 c0                	test   %eax,%eax
+  801ccc:	0f 88 f2 00 00 00    	js     801dc4 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801cd2:	8b 07                	mov    (%edi),%eax
+  801cd4:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801cda:	39 10                	cmp    %edx,(%eax)
+  801cdc:	0f 85 03 01 00 00    	jne    801de5 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801ce2:	a1 04 70 80 00       	mov    0x807004,%eax
+  801ce7:	8b 40 48             	mov    0x48(%eax),%eax
+  801cea:	3b 05 c4 90 80 00    	cmp    0x8090c4,%eax
+  801cf0:	0f 84 96 00 00 00    	je     801d8c <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801cf6:	83 3d c8 90 80 00 00 	cmpl   $0x0,0x8090c8
+  801cfd:	0f 84 cb 00 00 00    	je     801dce <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801d03:	b8 00 80 80 00       	mov    $0x808000,%eax
+  801d08:	83 c8 07             	or     $0x7,%eax
+  801d0b:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801d0e:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801d11:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801d16:	83 ec 04             	sub    $0x4,%esp
+  801d19:	68 07 04 00 00       	push   $0x407
+  801d1e:	53                   	push   %ebx
+  801d1f:	6a 00                	push   $0x0
+  801d21:	e8 ab ef ff ff       	call   800cd1 <sys_page_alloc>
+  801d26:	89 c1                	mov    %eax,%ecx
+  801d28:	83 c4 10             	add    $0x10,%esp
+  801d2b:	85 c0                	test   %eax,%eax
+  801d2d:	0f 88 91 00 00 00    	js     801dc4 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801d33:	89 d8                	mov    %ebx,%eax
+  801d35:	83 c8 07             	or     $0x7,%eax
+  801d38:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801d3a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d40:	83 c6 04             	add    $0x4,%esi
+  801d43:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801d49:	75 cb                	jne    801d16 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801d4b:	6a 12                	push   $0x12
+  801d4d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801d50:	50                   	push   %eax
+  801d51:	6a 0c                	push   $0xc
+  801d53:	ff 35 c8 90 80 00    	push   0x8090c8
+  801d59:	e8 ec 1a 00 00       	call   80384a <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801d5e:	83 c4 0c             	add    $0xc,%esp
+  801d61:	6a 00                	push   $0x0
+  801d63:	6a 00                	push   $0x0
+  801d65:	6a 00                	push   $0x0
+  801d67:	e8 88 19 00 00       	call   8036f4 <ipc_recv>
+  801d6c:	89 c1                	mov    %eax,%ecx
+  801d6e:	83 c4 10             	add    $0x10,%esp
+  801d71:	85 c0                	test   %eax,%eax
+  801d73:	78 4f                	js     801dc4 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801d75:	a1 04 70 80 00       	mov    0x807004,%eax
+  801d7a:	8b 40 48             	mov    0x48(%eax),%eax
+  801d7d:	a3 c4 90 80 00       	mov    %eax,0x8090c4
+	fsring_busy = 0;
+  801d82:	c7 05 c0 90 80 00 00 	movl   $0x0,0x8090c0
+  801d89:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801d8c:	83 ec 0c             	sub    $0xc,%esp
+  801d8f:	ff 37                	push   (%edi)
+  801d91:	e8 e4 fc ff ff       	call   801a7a <devfile_sync>
+  801d96:	89 c1                	mov    %eax,%ecx
+  801d98:	83 c4 10             	add    $0x10,%esp
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	78 25                	js     801dc4 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801d9f:	8b 1d c0 90 80 00    	mov    0x8090c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801da5:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801daa:	ba 01 00 00 00       	mov    $0x1,%edx
+  801daf:	89 d0                	mov    %edx,%eax
+  801db1:	d3 e0                	shl    %cl,%eax
+  801db3:	85 d8                	test   %ebx,%eax
+  801db5:	74 0d                	je     801dc4 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801db7:	83 c1 01             	add    $0x1,%ecx
+  801dba:	83 f9 10             	cmp    $0x10,%ecx
+  801dbd:	75 f0                	jne    801daf <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801dbf:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801dc4:	89 c8                	mov    %ecx,%eax
+  801dc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc9:	5b                   	pop    %ebx
+  801dca:	5e                   	pop    %esi
+  801dcb:	5f                   	pop    %edi
+  801dcc:	5d                   	pop    %ebp
+  801dcd:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801dce:	83 ec 0c             	sub    $0xc,%esp
+  801dd1:	6a 01                	push   $0x1
+  801dd3:	e8 c0 1a 00 00       	call   803898 <ipc_find_env>
+  801dd8:	a3 c8 90 80 00       	mov    %eax,0x8090c8
+  801ddd:	83 c4 10             	add    $0x10,%esp
+  801de0:	e9 1e ff ff ff       	jmp    801d03 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801de5:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801dea:	eb d8                	jmp    801dc4 <fsring_slot+0x111>
+
+00801dec <file_read_direct>:
+{
+  801dec:	55                   	push   %ebp
+  801ded:	89 e5                	mov    %esp,%ebp
+  801def:	57                   	push   %edi
+  801df0:	56                   	push   %esi
+  801df1:	53                   	push   %ebx
+  801df2:	83 ec 1c             	sub    $0x1c,%esp
+  801df5:	89 c7                	mov    %eax,%edi
+  801df7:	89 d6                	mov    %edx,%esi
+  801df9:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801dfb:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801e01:	77 52                	ja     801e55 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801e03:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e06:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801e0b:	89 0d 04 80 80 00    	mov    %ecx,0x808004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801e11:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e16:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e1b:	e8 b6 fb ff ff       	call   8019d6 <fsipc>
+  801e20:	89 c7                	mov    %eax,%edi
+  801e22:	85 c0                	test   %eax,%eax
+  801e24:	78 25                	js     801e4b <file_read_direct+0x5f>
+	assert(r <= n);
+  801e26:	39 c3                	cmp    %eax,%ebx
+  801e28:	0f 82 87 00 00 00    	jb     801eb5 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801e2e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e33:	0f 8f 95 00 00 00    	jg     801ece <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e39:	83 ec 04             	sub    $0x4,%esp
+  801e3c:	50                   	push   %eax
+  801e3d:	68 00 80 80 00       	push   $0x808000
+  801e42:	56                   	push   %esi
+  801e43:	e8 03 ec ff ff       	call   800a4b <memmove>
+	return r;
+  801e48:	83 c4 10             	add    $0x10,%esp
+}
+  801e4b:	89 f8                	mov    %edi,%eax
+  801e4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e50:	5b                   	pop    %ebx
+  801e51:	5e                   	pop    %esi
+  801e52:	5f                   	pop    %edi
+  801e53:	5d                   	pop    %ebp
+  801e54:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801e55:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801e5b:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801e60:	29 d1                	sub    %edx,%ecx
+  801e62:	39 d9                	cmp    %ebx,%ecx
+  801e64:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801e67:	89 f0                	mov    %esi,%eax
+  801e69:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801e6c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801e6f:	eb 0f                	jmp    801e80 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801e71:	0f b6 10             	movzbl (%eax),%edx
+  801e74:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801e76:	05 00 10 00 00       	add    $0x1000,%eax
+  801e7b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801e80:	39 c8                	cmp    %ecx,%eax
+  801e82:	72 ed                	jb     801e71 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801e84:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801e87:	8b 47 0c             	mov    0xc(%edi),%eax
+  801e8a:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.bulk.req_n = n;
+  801e8f:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801e95:	89 15 08 80 80 00    	mov    %edx,0x808008
+	return fsipc_pages(type, buf, n, perm);
+  801e9b:	83 ec 0c             	sub    $0xc,%esp
+  801e9e:	6a 07                	push   $0x7
+  801ea0:	89 d9                	mov    %ebx,%ecx
+  801ea2:	89 f2                	mov    %esi,%edx
+  801ea4:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ea9:	e8 86 f9 ff ff       	call   801834 <fsipc_pages>
+  801eae:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801eb0:	83 c4 10             	add    $0x10,%esp
+  801eb3:	eb 96                	jmp    801e4b <file_read_direct+0x5f>
+	assert(r <= n);
+  801eb5:	68 c0 40 80 00       	push   $0x8040c0
+  801eba:	68 a0 40 80 00       	push   $0x8040a0
+  801ebf:	68 dc 00 00 00       	push   $0xdc
+  801ec4:	68 b5 40 80 00       	push   $0x8040b5
+  801ec9:	e8 22 14 00 00       	call   8032f0 <_panic>
+	assert(r <= PGSIZE);
+  801ece:	68 d1 40 80 00       	push   $0x8040d1
+  801ed3:	68 a0 40 80 00       	push   $0x8040a0
+  801ed8:	68 dd 00 00 00       	push   $0xdd
+  801edd:	68 b5 40 80 00       	push   $0x8040b5
+  801ee2:	e8 09 14 00 00       	call   8032f0 <_panic>
+
+00801ee7 <devfile_read>:
+{
+  801ee7:	55                   	push   %ebp
+  801ee8:	89 e5                	mov    %esp,%ebp
+  801eea:	57                   	push   %edi
+  801eeb:	56                   	push   %esi
+  801eec:	53                   	push   %ebx
+  801eed:	83 ec 28             	sub    $0x28,%esp
+  801ef0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ef3:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801ef6:	53                   	push   %ebx
+  801ef7:	e8 35 f3 ff ff       	call   801231 <fd2data>
+  801efc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801eff:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801f02:	83 c4 10             	add    $0x10,%esp
+  801f05:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801f09:	74 7d                	je     801f88 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801f0b:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801f0f:	0f 85 81 00 00 00    	jne    801f96 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801f15:	8b 43 18             	mov    0x18(%ebx),%eax
+  801f18:	85 c0                	test   %eax,%eax
+  801f1a:	74 0d                	je     801f29 <devfile_read+0x42>
+  801f1c:	8b 53 14             	mov    0x14(%ebx),%edx
+  801f1f:	39 fa                	cmp    %edi,%edx
+  801f21:	7f 06                	jg     801f29 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801f23:	01 c2                	add    %eax,%edx
+  801f25:	39 d7                	cmp    %edx,%edi
+  801f27:	72 28                	jb     801f51 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801f29:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801f30:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801f36:	77 74                	ja     801fac <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801f38:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801f3d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f40:	89 d8                	mov    %ebx,%eax
+  801f42:	e8 a5 fe ff ff       	call   801dec <file_read_direct>
+  801f47:	85 c0                	test   %eax,%eax
+  801f49:	7e 35                	jle    801f80 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801f4b:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801f4e:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801f51:	8b 53 14             	mov    0x14(%ebx),%edx
+  801f54:	89 d0                	mov    %edx,%eax
+  801f56:	03 43 18             	add    0x18(%ebx),%eax
+  801f59:	29 f8                	sub    %edi,%eax
+  801f5b:	39 f0                	cmp    %esi,%eax
+  801f5d:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801f60:	83 ec 04             	sub    $0x4,%esp
+  801f63:	56                   	push   %esi
+  801f64:	89 f8                	mov    %edi,%eax
+  801f66:	29 d0                	sub    %edx,%eax
+  801f68:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801f6b:	01 c1                	add    %eax,%ecx
+  801f6d:	51                   	push   %ecx
+  801f6e:	ff 75 0c             	push   0xc(%ebp)
+  801f71:	e8 d5 ea ff ff       	call   800a4b <memmove>
+	fd->fd_offset = pos + n;
+  801f76:	01 f7                	add    %esi,%edi
+  801f78:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801f7b:	89 f0                	mov    %esi,%eax
+  801f7d:	83 c4 10             	add    $0x10,%esp
+}
+  801f80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f83:	5b                   	pop    %ebx
+  801f84:	5e                   	pop    %esi
+  801f85:	5f                   	pop    %edi
+  801f86:	5d                   	pop    %ebp
+  801f87:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801f88:	89 f1                	mov    %esi,%ecx
+  801f8a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f8d:	89 d8                	mov    %ebx,%eax
+  801f8f:	e8 58 fe ff ff       	call   801dec <file_read_direct>
+  801f94:	eb ea                	jmp    801f80 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801f96:	83 ec 0c             	sub    $0xc,%esp
+  801f99:	53                   	push   %ebx
+  801f9a:	e8 db fa ff ff       	call   801a7a <devfile_sync>
+  801f9f:	83 c4 10             	add    $0x10,%esp
+  801fa2:	85 c0                	test   %eax,%eax
+  801fa4:	0f 89 6b ff ff ff    	jns    801f15 <devfile_read+0x2e>
+  801faa:	eb d4                	jmp    801f80 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801fac:	89 f1                	mov    %esi,%ecx
+  801fae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fb1:	89 d8                	mov    %ebx,%eax
+  801fb3:	e8 34 fe ff ff       	call   801dec <file_read_direct>
+  801fb8:	eb c6                	jmp    801f80 <devfile_read+0x99>
+
+00801fba <open>:
+{
+  801fba:	55                   	push   %ebp
+  801fbb:	89 e5                	mov    %esp,%ebp
+  801fbd:	56                   	push   %esi
+  801fbe:	53                   	push   %ebx
+  801fbf:	83 ec 1c             	sub    $0x1c,%esp
+  801fc2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801fc5:	56                   	push   %esi
+  801fc6:	e8 bf e8 ff ff       	call   80088a <strlen>
+  801fcb:	83 c4 10             	add    $0x10,%esp
+  801fce:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801fd3:	0f 8f a0 00 00 00    	jg     802079 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801fd9:	83 ec 0c             	sub    $0xc,%esp
+  801fdc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fdf:	50                   	push   %eax
+  801fe0:	e8 63 f2 ff ff       	call   801248 <fd_alloc>
+  801fe5:	89 c3                	mov    %eax,%ebx
+  801fe7:	83 c4 10             	add    $0x10,%esp
+  801fea:	85 c0                	test   %eax,%eax
+  801fec:	78 45                	js     802033 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801fee:	83 ec 08             	sub    $0x8,%esp
+  801ff1:	56                   	push   %esi
+  801ff2:	68 00 80 80 00       	push   $0x808000
+  801ff7:	e8 c9 e8 ff ff       	call   8008c5 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801ffc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fff:	a3 00 84 80 00       	mov    %eax,0x808400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802004:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802007:	b8 01 00 00 00       	mov    $0x1,%eax
+  80200c:	e8 c5 f9 ff ff       	call   8019d6 <fsipc>
+  802011:	89 c3                	mov    %eax,%ebx
+  802013:	83 c4 10             	add    $0x10,%esp
+  802016:	85 c0                	test   %eax,%eax
+  802018:	78 22                	js     80203c <open+0x82>
+	if (!(mode & O_NOBUF)
+  80201a:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  802021:	74 2b                	je     80204e <open+0x94>
+	return fd2num(fd);
+  802023:	83 ec 0c             	sub    $0xc,%esp
+  802026:	ff 75 f4             	push   -0xc(%ebp)
+  802029:	e8 f3 f1 ff ff       	call   801221 <fd2num>
+  80202e:	89 c3                	mov    %eax,%ebx
+  802030:	83 c4 10             	add    $0x10,%esp
+}
+  802033:	89 d8                	mov    %ebx,%eax
+  802035:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802038:	5b                   	pop    %ebx
+  802039:	5e                   	pop    %esi
+  80203a:	5d                   	pop    %ebp
+  80203b:	c3                   	ret
+		fd_close(fd, 0);
+  80203c:	83 ec 08             	sub    $0x8,%esp
+  80203f:	6a 00                	push   $0x0
+  802041:	ff 75 f4             	push   -0xc(%ebp)
+  802044:	e8 f8 f2 ff ff       	call   801341 <fd_close>
+		return r;
+  802049:	83 c4 10             	add    $0x10,%esp
+  80204c:	eb e5                	jmp    802033 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  80204e:	83 ec 0c             	sub    $0xc,%esp
+  802051:	ff 75 f4             	push   -0xc(%ebp)
+  802054:	e8 d8 f1 ff ff       	call   801231 <fd2data>
+  802059:	83 c4 0c             	add    $0xc,%esp
+  80205c:	68 07 04 00 00       	push   $0x407
+  802061:	50                   	push   %eax
+  802062:	6a 00                	push   $0x0
+  802064:	e8 68 ec ff ff       	call   800cd1 <sys_page_alloc>
+  802069:	83 c4 10             	add    $0x10,%esp
+  80206c:	85 c0                	test   %eax,%eax
+  80206e:	75 b3                	jne    802023 <open+0x69>
+		fd->fd_file.buffered = 1;
+  802070:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802073:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802077:	eb aa                	jmp    802023 <open+0x69>
+		return -E_BAD_PATH;
+  802079:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80207e:	eb b3                	jmp    802033 <open+0x79>
+
+00802080 <readdir>:
+{
+  802080:	55                   	push   %ebp
+  802081:	89 e5                	mov    %esp,%ebp
+  802083:	53                   	push   %ebx
+  802084:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802087:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80208a:	50                   	push   %eax
+  80208b:	ff 75 08             	push   0x8(%ebp)
+  80208e:	e8 0b f2 ff ff       	call   80129e <fd_lookup>
+  802093:	89 c3                	mov    %eax,%ebx
+  802095:	83 c4 10             	add    $0x10,%esp
+  802098:	85 c0                	test   %eax,%eax
+  80209a:	78 73                	js     80210f <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80209c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80209f:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  8020a5:	39 08                	cmp    %ecx,(%eax)
+  8020a7:	0f 85 82 00 00 00    	jne    80212f <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  8020ad:	83 ec 0c             	sub    $0xc,%esp
+  8020b0:	50                   	push   %eax
+  8020b1:	e8 c4 f9 ff ff       	call   801a7a <devfile_sync>
+  8020b6:	89 c3                	mov    %eax,%ebx
+  8020b8:	83 c4 10             	add    $0x10,%esp
+  8020bb:	85 c0                	test   %eax,%eax
+  8020bd:	78 50                	js     80210f <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  8020bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020c2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020c5:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.readdir.req_n = n;
+  8020ca:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020cd:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.readdir.req_flags = flags;
+  8020d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020d5:	a3 08 80 80 00       	mov    %eax,0x808008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  8020da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020df:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8020e4:	e8 ed f8 ff ff       	call   8019d6 <fsipc>
+  8020e9:	89 c3                	mov    %eax,%ebx
+  8020eb:	85 c0                	test   %eax,%eax
+  8020ed:	7e 20                	jle    80210f <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  8020ef:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8020f2:	72 22                	jb     802116 <readdir+0x96>
+  8020f4:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8020f9:	7f 1b                	jg     802116 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8020fb:	83 ec 04             	sub    $0x4,%esp
+  8020fe:	50                   	push   %eax
+  8020ff:	68 00 80 80 00       	push   $0x808000
+  802104:	ff 75 0c             	push   0xc(%ebp)
+  802107:	e8 3f e9 ff ff       	call   800a4b <memmove>
+	return r;
+  80210c:	83 c4 10             	add    $0x10,%esp
+}
+  80210f:	89 d8                	mov    %ebx,%eax
+  802111:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802114:	c9                   	leave
+  802115:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  802116:	68 c7 40 80 00       	push   $0x8040c7
+  80211b:	68 a0 40 80 00       	push   $0x8040a0
+  802120:	68 86 01 00 00       	push   $0x186
+  802125:	68 b5 40 80 00       	push   $0x8040b5
+  80212a:	e8 c1 11 00 00       	call   8032f0 <_panic>
+		return -E_NOT_SUPP;
+  80212f:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802134:	eb d9                	jmp    80210f <readdir+0x8f>
+
+00802136 <munmap>:
+{
+  802136:	55                   	push   %ebp
+  802137:	89 e5                	mov    %esp,%ebp
+  802139:	56                   	push   %esi
+  80213a:	53                   	push   %ebx
+  80213b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80213e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802141:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  802147:	75 41                	jne    80218a <munmap+0x54>
+  802149:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  80214f:	77 39                	ja     80218a <munmap+0x54>
+  802151:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802156:	29 f0                	sub    %esi,%eax
+  802158:	39 d0                	cmp    %edx,%eax
+  80215a:	72 35                	jb     802191 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80215c:	89 f3                	mov    %esi,%ebx
+  80215e:	01 d6                	add    %edx,%esi
+  802160:	39 f3                	cmp    %esi,%ebx
+  802162:	73 1a                	jae    80217e <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802164:	83 ec 08             	sub    $0x8,%esp
+  802167:	53                   	push   %ebx
+  802168:	6a 00                	push   $0x0
+  80216a:	e8 ef eb ff ff       	call   800d5e <sys_page_unmap>
+  80216f:	83 c4 10             	add    $0x10,%esp
+  802172:	85 c0                	test   %eax,%eax
+  802174:	78 0d                	js     802183 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802176:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80217c:	eb e2                	jmp    802160 <munmap+0x2a>
+	return 0;
+  80217e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802183:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802186:	5b                   	pop    %ebx
+  802187:	5e                   	pop    %esi
+  802188:	5d                   	pop    %ebp
+  802189:	c3                   	ret
+		return -E_INVAL;
+  80218a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80218f:	eb f2                	jmp    802183 <munmap+0x4d>
+  802191:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802196:	eb eb                	jmp    802183 <munmap+0x4d>
+
+00802198 <mmap>:
+{
+  802198:	55                   	push   %ebp
+  802199:	89 e5                	mov    %esp,%ebp
+  80219b:	57                   	push   %edi
+  80219c:	56                   	push   %esi
+  80219d:	53                   	push   %ebx
+  80219e:	83 ec 34             	sub    $0x34,%esp
+  8021a1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021a4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8021a7:	50                   	push   %eax
+  8021a8:	ff 75 18             	push   0x18(%ebp)
+  8021ab:	e8 ee f0 ff ff       	call   80129e <fd_lookup>
+  8021b0:	89 c3                	mov    %eax,%ebx
+  8021b2:	83 c4 10             	add    $0x10,%esp
+  8021b5:	85 c0                	test   %eax,%eax
+  8021b7:	0f 88 0e 01 00 00    	js     8022cb <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8021bd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8021c0:	a1 20 50 80 00       	mov    0x805020,%eax
+  8021c5:	39 02                	cmp    %eax,(%edx)
+  8021c7:	0f 85 50 01 00 00    	jne    80231d <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  8021cd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8021d0:	83 e0 02             	and    $0x2,%eax
+  8021d3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8021d6:	74 0a                	je     8021e2 <mmap+0x4a>
+  8021d8:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8021dc:	0f 84 42 01 00 00    	je     802324 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  8021e2:	8b 42 08             	mov    0x8(%edx),%eax
+  8021e5:	83 e0 03             	and    $0x3,%eax
+  8021e8:	83 f8 01             	cmp    $0x1,%eax
+  8021eb:	0f 84 3a 01 00 00    	je     80232b <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8021f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f4:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8021f7:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8021fc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8021ff:	0f 85 2d 01 00 00    	jne    802332 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802205:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802209:	0f 88 2a 01 00 00    	js     802339 <mmap+0x1a1>
+  80220f:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  802216:	0f 87 1d 01 00 00    	ja     802339 <mmap+0x1a1>
+  80221c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802221:	2b 45 08             	sub    0x8(%ebp),%eax
+  802224:	39 f8                	cmp    %edi,%eax
+  802226:	0f 82 14 01 00 00    	jb     802340 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  80222c:	83 ec 0c             	sub    $0xc,%esp
+  80222f:	52                   	push   %edx
+  802230:	e8 45 f8 ff ff       	call   801a7a <devfile_sync>
+  802235:	89 c3                	mov    %eax,%ebx
+  802237:	83 c4 10             	add    $0x10,%esp
+  80223a:	85 c0                	test   %eax,%eax
+  80223c:	0f 88 89 00 00 00    	js     8022cb <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802242:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802248:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80224e:	be 00 00 00 00       	mov    $0x0,%esi
+  802253:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802256:	39 fe                	cmp    %edi,%esi
+  802258:	73 7b                	jae    8022d5 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  80225a:	89 f8                	mov    %edi,%eax
+  80225c:	29 f0                	sub    %esi,%eax
+  80225e:	c1 e8 0c             	shr    $0xc,%eax
+  802261:	ba 40 00 00 00       	mov    $0x40,%edx
+  802266:	39 d0                	cmp    %edx,%eax
+  802268:	0f 47 c2             	cmova  %edx,%eax
+  80226b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80226e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802271:	8b 52 0c             	mov    0xc(%edx),%edx
+  802274:	89 15 00 80 80 00    	mov    %edx,0x808000
+		fsipcbuf.map.req_offset = offset + done;
+  80227a:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  80227d:	89 15 04 80 80 00    	mov    %edx,0x808004
+		fsipcbuf.map.req_npages = n;
+  802283:	a3 08 80 80 00       	mov    %eax,0x808008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802288:	89 f2                	mov    %esi,%edx
+  80228a:	03 55 08             	add    0x8(%ebp),%edx
+  80228d:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802290:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802295:	e8 ea f6 ff ff       	call   801984 <fsipcv>
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	7e 12                	jle    8022b0 <mmap+0x118>
+  80229e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8022a1:	85 c0                	test   %eax,%eax
+  8022a3:	0f 84 9e 00 00 00    	je     802347 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8022a9:	c1 e0 0c             	shl    $0xc,%eax
+  8022ac:	01 c6                	add    %eax,%esi
+  8022ae:	eb a6                	jmp    802256 <mmap+0xbe>
+			munmap(addr, done);
+  8022b0:	89 c3                	mov    %eax,%ebx
+  8022b2:	83 ec 08             	sub    $0x8,%esp
+  8022b5:	56                   	push   %esi
+  8022b6:	ff 75 08             	push   0x8(%ebp)
+  8022b9:	e8 78 fe ff ff       	call   802136 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  8022be:	83 c4 10             	add    $0x10,%esp
+  8022c1:	85 db                	test   %ebx,%ebx
+  8022c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022c8:	0f 49 d8             	cmovns %eax,%ebx
+}
+  8022cb:	89 d8                	mov    %ebx,%eax
+  8022cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d0:	5b                   	pop    %ebx
+  8022d1:	5e                   	pop    %esi
+  8022d2:	5f                   	pop    %edi
+  8022d3:	5d                   	pop    %ebp
+  8022d4:	c3                   	ret
+	if (prot & PROT_WRITE)
+  8022d5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8022d8:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8022da:	85 c0                	test   %eax,%eax
+  8022dc:	74 ed                	je     8022cb <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8022de:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022e6:	39 fe                	cmp    %edi,%esi
+  8022e8:	73 2e                	jae    802318 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8022ea:	83 ec 0c             	sub    $0xc,%esp
+  8022ed:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8022f0:	50                   	push   %eax
+  8022f1:	e8 00 12 00 00       	call   8034f6 <cowpage>
+  8022f6:	83 c4 10             	add    $0x10,%esp
+  8022f9:	85 c0                	test   %eax,%eax
+  8022fb:	78 08                	js     802305 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8022fd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802303:	eb e1                	jmp    8022e6 <mmap+0x14e>
+				munmap(addr, len);
+  802305:	89 c3                	mov    %eax,%ebx
+  802307:	83 ec 08             	sub    $0x8,%esp
+  80230a:	57                   	push   %edi
+  80230b:	ff 75 08             	push   0x8(%ebp)
+  80230e:	e8 23 fe ff ff       	call   802136 <munmap>
+				return r;
+  802313:	83 c4 10             	add    $0x10,%esp
+  802316:	eb b3                	jmp    8022cb <mmap+0x133>
+	return 0;
+  802318:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80231b:	eb ae                	jmp    8022cb <mmap+0x133>
+		return -E_NOT_SUPP;
+  80231d:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802322:	eb a7                	jmp    8022cb <mmap+0x133>
+		return -E_NOT_SUPP;
+  802324:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802329:	eb a0                	jmp    8022cb <mmap+0x133>
+		return -E_INVAL;
+  80232b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802330:	eb 99                	jmp    8022cb <mmap+0x133>
+  802332:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802337:	eb 92                	jmp    8022cb <mmap+0x133>
+  802339:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80233e:	eb 8b                	jmp    8022cb <mmap+0x133>
+  802340:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802345:	eb 84                	jmp    8022cb <mmap+0x133>
+			munmap(addr, done);
+  802347:	83 ec 08             	sub    $0x8,%esp
+  80234a:	56                   	push   %esi
+  80234b:	ff 75 08             	push   0x8(%ebp)
+  80234e:	e8 e3 fd ff ff       	call   802136 <munmap>
+  802353:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802356:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80235b:	e9 6b ff ff ff       	jmp    8022cb <mmap+0x133>
+
+00802360 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802360:	55                   	push   %ebp
+  802361:	89 e5                	mov    %esp,%ebp
+  802363:	56                   	push   %esi
+  802364:	53                   	push   %ebx
+  802365:	83 ec 10             	sub    $0x10,%esp
+  802368:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80236b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80236e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802371:	e8 3d f9 ff ff       	call   801cb3 <fsring_slot>
+  802376:	85 c0                	test   %eax,%eax
+  802378:	78 60                	js     8023da <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80237a:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80237d:	8b 56 08             	mov    0x8(%esi),%edx
+  802380:	83 e2 03             	and    $0x3,%edx
+  802383:	83 fa 01             	cmp    $0x1,%edx
+  802386:	74 59                	je     8023e1 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802388:	ba 01 00 00 00       	mov    $0x1,%edx
+  80238d:	89 c1                	mov    %eax,%ecx
+  80238f:	d3 e2                	shl    %cl,%edx
+  802391:	09 15 c0 90 80 00    	or     %edx,0x8090c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802397:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80239a:	c1 e2 02             	shl    $0x2,%edx
+  80239d:	8d 8a 00 90 80 00    	lea    0x809000(%edx),%ecx
+  8023a3:	c7 82 00 90 80 00 03 	movl   $0x3,0x809000(%edx)
+  8023aa:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8023ad:	8b 55 18             	mov    0x18(%ebp),%edx
+  8023b0:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8023b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023b6:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8023b9:	83 ec 08             	sub    $0x8,%esp
+  8023bc:	50                   	push   %eax
+  8023bd:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8023c2:	39 c3                	cmp    %eax,%ebx
+  8023c4:	0f 47 d8             	cmova  %eax,%ebx
+  8023c7:	53                   	push   %ebx
+  8023c8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8023cb:	89 f2                	mov    %esi,%edx
+  8023cd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023d2:	e8 1e f5 ff ff       	call   8018f5 <fsring_post>
+  8023d7:	83 c4 10             	add    $0x10,%esp
+}
+  8023da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023dd:	5b                   	pop    %ebx
+  8023de:	5e                   	pop    %esi
+  8023df:	5d                   	pop    %ebp
+  8023e0:	c3                   	ret
+		return -E_INVAL;
+  8023e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023e6:	eb f2                	jmp    8023da <fsring_read+0x7a>
+
+008023e8 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8023e8:	55                   	push   %ebp
+  8023e9:	89 e5                	mov    %esp,%ebp
+  8023eb:	56                   	push   %esi
+  8023ec:	53                   	push   %ebx
+  8023ed:	83 ec 10             	sub    $0x10,%esp
+  8023f0:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8023f3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8023f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f9:	e8 b5 f8 ff ff       	call   801cb3 <fsring_slot>
+  8023fe:	89 c3                	mov    %eax,%ebx
+  802400:	85 c0                	test   %eax,%eax
+  802402:	78 77                	js     80247b <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802404:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802407:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80240b:	74 77                	je     802484 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80240d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802412:	39 c6                	cmp    %eax,%esi
+  802414:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802417:	83 ec 04             	sub    $0x4,%esp
+  80241a:	56                   	push   %esi
+  80241b:	ff 75 0c             	push   0xc(%ebp)
+  80241e:	89 d8                	mov    %ebx,%eax
+  802420:	c1 e0 0c             	shl    $0xc,%eax
+  802423:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802429:	50                   	push   %eax
+  80242a:	e8 1c e6 ff ff       	call   800a4b <memmove>
+	fsring_busy |= 1 << slot;
+  80242f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802434:	89 d9                	mov    %ebx,%ecx
+  802436:	d3 e0                	shl    %cl,%eax
+  802438:	09 05 c0 90 80 00    	or     %eax,0x8090c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  80243e:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802441:	c1 e0 02             	shl    $0x2,%eax
+  802444:	8d 90 00 90 80 00    	lea    0x809000(%eax),%edx
+  80244a:	c7 80 00 90 80 00 04 	movl   $0x4,0x809000(%eax)
+  802451:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802454:	8b 45 18             	mov    0x18(%ebp),%eax
+  802457:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80245a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802461:	83 c4 08             	add    $0x8,%esp
+  802464:	53                   	push   %ebx
+  802465:	56                   	push   %esi
+  802466:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802469:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80246c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802471:	e8 7f f4 ff ff       	call   8018f5 <fsring_post>
+  802476:	89 c3                	mov    %eax,%ebx
+  802478:	83 c4 10             	add    $0x10,%esp
+}
+  80247b:	89 d8                	mov    %ebx,%eax
+  80247d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802480:	5b                   	pop    %ebx
+  802481:	5e                   	pop    %esi
+  802482:	5d                   	pop    %ebp
+  802483:	c3                   	ret
+		return -E_INVAL;
+  802484:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802489:	eb f0                	jmp    80247b <fsring_write+0x93>
+
+0080248b <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80248b:	55                   	push   %ebp
+  80248c:	89 e5                	mov    %esp,%ebp
+  80248e:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802491:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802494:	8b 45 08             	mov    0x8(%ebp),%eax
+  802497:	e8 17 f8 ff ff       	call   801cb3 <fsring_slot>
+  80249c:	85 c0                	test   %eax,%eax
+  80249e:	78 4c                	js     8024ec <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8024a0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8024a5:	89 c1                	mov    %eax,%ecx
+  8024a7:	d3 e2                	shl    %cl,%edx
+  8024a9:	09 15 c0 90 80 00    	or     %edx,0x8090c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8024af:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8024b2:	c1 e2 02             	shl    $0x2,%edx
+  8024b5:	8d 8a 00 90 80 00    	lea    0x809000(%edx),%ecx
+  8024bb:	c7 82 00 90 80 00 05 	movl   $0x5,0x809000(%edx)
+  8024c2:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8024c5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8024c8:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8024cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024ce:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  8024d1:	83 ec 08             	sub    $0x8,%esp
+  8024d4:	50                   	push   %eax
+  8024d5:	6a 00                	push   $0x0
+  8024d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8024df:	b8 05 00 00 00       	mov    $0x5,%eax
+  8024e4:	e8 0c f4 ff ff       	call   8018f5 <fsring_post>
+  8024e9:	83 c4 10             	add    $0x10,%esp
+}
+  8024ec:	c9                   	leave
+  8024ed:	c3                   	ret
+
+008024ee <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8024ee:	55                   	push   %ebp
+  8024ef:	89 e5                	mov    %esp,%ebp
+  8024f1:	57                   	push   %edi
+  8024f2:	56                   	push   %esi
+  8024f3:	53                   	push   %ebx
+  8024f4:	83 ec 1c             	sub    $0x1c,%esp
+  8024f7:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8024fb:	a1 04 70 80 00       	mov    0x807004,%eax
+  802500:	8b 40 48             	mov    0x48(%eax),%eax
+  802503:	3b 05 c4 90 80 00    	cmp    0x8090c4,%eax
+  802509:	74 12                	je     80251d <fsring_reap+0x2f>
+		return 0;
+  80250b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802510:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802513:	5b                   	pop    %ebx
+  802514:	5e                   	pop    %esi
+  802515:	5f                   	pop    %edi
+  802516:	5d                   	pop    %ebp
+  802517:	c3                   	ret
+		sys_yield();
+  802518:	e8 95 e7 ff ff       	call   800cb2 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  80251d:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802523:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802528:	39 c2                	cmp    %eax,%edx
+  80252a:	75 18                	jne    802544 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  80252c:	84 db                	test   %bl,%bl
+  80252e:	0f 84 21 01 00 00    	je     802655 <fsring_reap+0x167>
+  802534:	83 3d c0 90 80 00 00 	cmpl   $0x0,0x8090c0
+  80253b:	75 db                	jne    802518 <fsring_reap+0x2a>
+			return 0;
+  80253d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802542:	eb cc                	jmp    802510 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802544:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802549:	83 e0 0f             	and    $0xf,%eax
+  80254c:	83 c0 2a             	add    $0x2a,%eax
+  80254f:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802556:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  80255d:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802562:	83 c0 01             	add    $0x1,%eax
+  802565:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  80256a:	83 fb 0f             	cmp    $0xf,%ebx
+  80256d:	77 5b                	ja     8025ca <fsring_reap+0xdc>
+  80256f:	be 01 00 00 00       	mov    $0x1,%esi
+  802574:	89 d9                	mov    %ebx,%ecx
+  802576:	d3 e6                	shl    %cl,%esi
+  802578:	89 f0                	mov    %esi,%eax
+  80257a:	23 05 c0 90 80 00    	and    0x8090c0,%eax
+  802580:	74 48                	je     8025ca <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802582:	89 d8                	mov    %ebx,%eax
+  802584:	c1 e0 0c             	shl    $0xc,%eax
+  802587:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80258d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802590:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802593:	8b 04 85 00 90 80 00 	mov    0x809000(,%eax,4),%eax
+  80259a:	83 f8 03             	cmp    $0x3,%eax
+  80259d:	74 40                	je     8025df <fsring_reap+0xf1>
+  80259f:	83 f8 05             	cmp    $0x5,%eax
+  8025a2:	74 64                	je     802608 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8025a4:	f7 d6                	not    %esi
+  8025a6:	21 35 c0 90 80 00    	and    %esi,0x8090c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8025ac:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8025af:	8b 14 85 04 90 80 00 	mov    0x809004(,%eax,4),%edx
+  8025b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b9:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8025bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025be:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8025c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025c5:	e9 46 ff ff ff       	jmp    802510 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8025ca:	53                   	push   %ebx
+  8025cb:	68 dd 40 80 00       	push   $0x8040dd
+  8025d0:	68 8f 02 00 00       	push   $0x28f
+  8025d5:	68 b5 40 80 00       	push   $0x8040b5
+  8025da:	e8 11 0d 00 00       	call   8032f0 <_panic>
+		if (cqe.cqe_result > 0)
+  8025df:	85 ff                	test   %edi,%edi
+  8025e1:	7e c1                	jle    8025a4 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8025e3:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8025e6:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8025eb:	39 c7                	cmp    %eax,%edi
+  8025ed:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8025f0:	50                   	push   %eax
+  8025f1:	ff 75 e4             	push   -0x1c(%ebp)
+  8025f4:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8025f7:	ff 34 85 08 90 80 00 	push   0x809008(,%eax,4)
+  8025fe:	e8 48 e4 ff ff       	call   800a4b <memmove>
+  802603:	83 c4 10             	add    $0x10,%esp
+  802606:	eb 9c                	jmp    8025a4 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802608:	85 ff                	test   %edi,%edi
+  80260a:	75 98                	jne    8025a4 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80260c:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80260f:	8b 0c 85 08 90 80 00 	mov    0x809008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802616:	83 ec 08             	sub    $0x8,%esp
+  802619:	ff 75 e4             	push   -0x1c(%ebp)
+  80261c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80261f:	51                   	push   %ecx
+  802620:	e8 a0 e2 ff ff       	call   8008c5 <strcpy>
+			st->st_size = ret->ret_size;
+  802625:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802628:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  80262e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802631:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802637:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  80263d:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802643:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  80264a:	50 80 00 
+  80264d:	83 c4 10             	add    $0x10,%esp
+  802650:	e9 4f ff ff ff       	jmp    8025a4 <fsring_reap+0xb6>
+			return 0;
+  802655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80265a:	e9 b1 fe ff ff       	jmp    802510 <fsring_reap+0x22>
+
+0080265f <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  80265f:	55                   	push   %ebp
+  802660:	89 e5                	mov    %esp,%ebp
+  802662:	57                   	push   %edi
+  802663:	56                   	push   %esi
+  802664:	53                   	push   %ebx
+  802665:	83 ec 28             	sub    $0x28,%esp
+  802668:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80266b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80266e:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802671:	53                   	push   %ebx
+  802672:	e8 13 e2 ff ff       	call   80088a <strlen>
+  802677:	83 c4 10             	add    $0x10,%esp
+  80267a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80267f:	0f 8f 02 01 00 00    	jg     802787 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802685:	83 ec 08             	sub    $0x8,%esp
+  802688:	53                   	push   %ebx
+  802689:	68 00 80 80 00       	push   $0x808000
+  80268e:	e8 32 e2 ff ff       	call   8008c5 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802693:	83 c4 10             	add    $0x10,%esp
+  802696:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  80269c:	76 69                	jbe    802707 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80269e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8026a1:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8026a7:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8026ac:	29 d1                	sub    %edx,%ecx
+  8026ae:	39 f9                	cmp    %edi,%ecx
+  8026b0:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8026b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026b6:	89 f9                	mov    %edi,%ecx
+  8026b8:	01 c1                	add    %eax,%ecx
+  8026ba:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8026bd:	eb 0f                	jmp    8026ce <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  8026bf:	0f b6 10             	movzbl (%eax),%edx
+  8026c2:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8026c4:	05 00 10 00 00       	add    $0x1000,%eax
+  8026c9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8026ce:	39 c8                	cmp    %ecx,%eax
+  8026d0:	72 ed                	jb     8026bf <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  8026d2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8026d5:	89 3d 00 84 80 00    	mov    %edi,0x808400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  8026db:	89 15 04 84 80 00    	mov    %edx,0x808404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8026e1:	83 ec 0c             	sub    $0xc,%esp
+  8026e4:	6a 07                	push   $0x7
+  8026e6:	89 f9                	mov    %edi,%ecx
+  8026e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8026eb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8026f0:	e8 3f f1 ff ff       	call   801834 <fsipc_pages>
+  8026f5:	89 c7                	mov    %eax,%edi
+  8026f7:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8026fa:	85 f6                	test   %esi,%esi
+  8026fc:	74 7f                	je     80277d <file_slurp+0x11e>
+  8026fe:	8d 43 01             	lea    0x1(%ebx),%eax
+  802701:	85 ff                	test   %edi,%edi
+  802703:	79 3c                	jns    802741 <file_slurp+0xe2>
+  802705:	eb 76                	jmp    80277d <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802707:	89 3d 00 84 80 00    	mov    %edi,0x808400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  80270d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802712:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802717:	e8 ba f2 ff ff       	call   8019d6 <fsipc>
+  80271c:	89 c7                	mov    %eax,%edi
+  80271e:	85 c0                	test   %eax,%eax
+  802720:	7e d8                	jle    8026fa <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802722:	83 ec 04             	sub    $0x4,%esp
+  802725:	50                   	push   %eax
+  802726:	68 08 80 80 00       	push   $0x808008
+  80272b:	ff 75 0c             	push   0xc(%ebp)
+  80272e:	e8 18 e3 ff ff       	call   800a4b <memmove>
+  802733:	83 c4 10             	add    $0x10,%esp
+  802736:	eb c2                	jmp    8026fa <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802738:	80 fa 2f             	cmp    $0x2f,%dl
+  80273b:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  80273e:	83 c0 01             	add    $0x1,%eax
+  802741:	89 c1                	mov    %eax,%ecx
+  802743:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802747:	84 d2                	test   %dl,%dl
+  802749:	75 ed                	jne    802738 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  80274b:	83 ec 04             	sub    $0x4,%esp
+  80274e:	68 80 00 00 00       	push   $0x80
+  802753:	53                   	push   %ebx
+  802754:	56                   	push   %esi
+  802755:	e8 e1 e1 ff ff       	call   80093b <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  80275a:	a1 00 80 80 00       	mov    0x808000,%eax
+  80275f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802765:	a1 04 80 80 00       	mov    0x808004,%eax
+  80276a:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802770:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  802777:	50 80 00 
+  80277a:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80277d:	89 f8                	mov    %edi,%eax
+  80277f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802782:	5b                   	pop    %ebx
+  802783:	5e                   	pop    %esi
+  802784:	5f                   	pop    %edi
+  802785:	5d                   	pop    %ebp
+  802786:	c3                   	ret
+		return -E_BAD_PATH;
+  802787:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  80278c:	eb ef                	jmp    80277d <file_slurp+0x11e>
+
+0080278e <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80278e:	55                   	push   %ebp
+  80278f:	89 e5                	mov    %esp,%ebp
+  802791:	53                   	push   %ebx
+  802792:	83 ec 10             	sub    $0x10,%esp
+  802795:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802798:	53                   	push   %ebx
+  802799:	e8 ec e0 ff ff       	call   80088a <strlen>
+  80279e:	83 c4 10             	add    $0x10,%esp
+  8027a1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8027a6:	7f 25                	jg     8027cd <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8027a8:	83 ec 08             	sub    $0x8,%esp
+  8027ab:	53                   	push   %ebx
+  8027ac:	68 00 80 80 00       	push   $0x808000
+  8027b1:	e8 0f e1 ff ff       	call   8008c5 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8027b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027bb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8027c0:	e8 11 f2 ff ff       	call   8019d6 <fsipc>
+  8027c5:	83 c4 10             	add    $0x10,%esp
+}
+  8027c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027cb:	c9                   	leave
+  8027cc:	c3                   	ret
+		return -E_BAD_PATH;
+  8027cd:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8027d2:	eb f4                	jmp    8027c8 <remove+0x3a>
+
+008027d4 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8027d4:	55                   	push   %ebp
+  8027d5:	89 e5                	mov    %esp,%ebp
+  8027d7:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8027da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027df:	b8 08 00 00 00       	mov    $0x8,%eax
+  8027e4:	e8 ed f1 ff ff       	call   8019d6 <fsipc>
+}
+  8027e9:	c9                   	leave
+  8027ea:	c3                   	ret
+
+008027eb <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  8027eb:	55                   	push   %ebp
+  8027ec:	89 e5                	mov    %esp,%ebp
+  8027ee:	57                   	push   %edi
+  8027ef:	56                   	push   %esi
+  8027f0:	53                   	push   %ebx
+  8027f1:	83 ec 18             	sub    $0x18,%esp
+  8027f4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8027f7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8027fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8027fd:	57                   	push   %edi
+  8027fe:	e8 87 e0 ff ff       	call   80088a <strlen>
+  802803:	83 c4 10             	add    $0x10,%esp
+  802806:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80280b:	7f 4c                	jg     802859 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  80280d:	83 ec 08             	sub    $0x8,%esp
+  802810:	57                   	push   %edi
+  802811:	68 00 80 80 00       	push   $0x808000
+  802816:	e8 aa e0 ff ff       	call   8008c5 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  80281b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802820:	b8 10 00 00 00       	mov    $0x10,%eax
+  802825:	e8 ac f1 ff ff       	call   8019d6 <fsipc>
+  80282a:	83 c4 10             	add    $0x10,%esp
+  80282d:	85 c0                	test   %eax,%eax
+  80282f:	78 20                	js     802851 <defrag+0x66>
+		return r;
+	if (before)
+  802831:	85 f6                	test   %esi,%esi
+  802833:	74 07                	je     80283c <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802835:	a1 00 80 80 00       	mov    0x808000,%eax
+  80283a:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  80283c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802841:	85 db                	test   %ebx,%ebx
+  802843:	74 0c                	je     802851 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802845:	a1 04 80 80 00       	mov    0x808004,%eax
+  80284a:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  80284c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802851:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802854:	5b                   	pop    %ebx
+  802855:	5e                   	pop    %esi
+  802856:	5f                   	pop    %edi
+  802857:	5d                   	pop    %ebp
+  802858:	c3                   	ret
+		return -E_BAD_PATH;
+  802859:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80285e:	eb f1                	jmp    802851 <defrag+0x66>
+
+00802860 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802860:	55                   	push   %ebp
+  802861:	89 e5                	mov    %esp,%ebp
+  802863:	53                   	push   %ebx
+  802864:	83 ec 04             	sub    $0x4,%esp
+  802867:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  80286a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80286f:	b8 11 00 00 00       	mov    $0x11,%eax
+  802874:	e8 5d f1 ff ff       	call   8019d6 <fsipc>
+  802879:	85 c0                	test   %eax,%eax
+  80287b:	78 34                	js     8028b1 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  80287d:	a1 00 80 80 00       	mov    0x808000,%eax
+  802882:	89 03                	mov    %eax,(%ebx)
+  802884:	a1 04 80 80 00       	mov    0x808004,%eax
+  802889:	89 43 04             	mov    %eax,0x4(%ebx)
+  80288c:	a1 08 80 80 00       	mov    0x808008,%eax
+  802891:	89 43 08             	mov    %eax,0x8(%ebx)
+  802894:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  802899:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80289c:	a1 10 80 80 00       	mov    0x808010,%eax
+  8028a1:	89 43 10             	mov    %eax,0x10(%ebx)
+  8028a4:	a1 14 80 80 00       	mov    0x808014,%eax
+  8028a9:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  8028ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028b4:	c9                   	leave
+  8028b5:	c3                   	ret
+
+008028b6 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  8028b6:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8028ba:	7f 01                	jg     8028bd <writebuf+0x7>
+  8028bc:	c3                   	ret
+{
+  8028bd:	55                   	push   %ebp
+  8028be:	89 e5                	mov    %esp,%ebp
+  8028c0:	53                   	push   %ebx
+  8028c1:	83 ec 08             	sub    $0x8,%esp
+  8028c4:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  8028c6:	ff 70 04             	push   0x4(%eax)
+  8028c9:	8d 40 10             	lea    0x10(%eax),%eax
+  8028cc:	50                   	push   %eax
+  8028cd:	ff 33                	push   (%ebx)
+  8028cf:	e8 fe ec ff ff       	call   8015d2 <write>
+		if (result > 0)
+  8028d4:	83 c4 10             	add    $0x10,%esp
+  8028d7:	85 c0                	test   %eax,%eax
+  8028d9:	7e 03                	jle    8028de <writebuf+0x28>
+			b->result += result;
+  8028db:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  8028de:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8028e1:	74 0d                	je     8028f0 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  8028e3:	85 c0                	test   %eax,%eax
+  8028e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ea:	0f 4f c2             	cmovg  %edx,%eax
+  8028ed:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  8028f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028f3:	c9                   	leave
+  8028f4:	c3                   	ret
+
+008028f5 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8028f5:	55                   	push   %ebp
+  8028f6:	89 e5                	mov    %esp,%ebp
+  8028f8:	53                   	push   %ebx
+  8028f9:	83 ec 04             	sub    $0x4,%esp
+  8028fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  8028ff:	8b 53 04             	mov    0x4(%ebx),%edx
+  802902:	8d 42 01             	lea    0x1(%edx),%eax
+  802905:	89 43 04             	mov    %eax,0x4(%ebx)
+  802908:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80290b:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  80290f:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802914:	74 05                	je     80291b <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  802916:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802919:	c9                   	leave
+  80291a:	c3                   	ret
+		writebuf(b);
+  80291b:	89 d8                	mov    %ebx,%eax
+  80291d:	e8 94 ff ff ff       	call   8028b6 <writebuf>
+		b->idx = 0;
+  802922:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  802929:	eb eb                	jmp    802916 <putch+0x21>
+
+0080292b <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  80292b:	55                   	push   %ebp
+  80292c:	89 e5                	mov    %esp,%ebp
+  80292e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  802934:	8b 45 08             	mov    0x8(%ebp),%eax
+  802937:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  80293d:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  802944:	00 00 00 
+	b.result = 0;
+  802947:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80294e:	00 00 00 
+	b.error = 1;
+  802951:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  802958:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  80295b:	ff 75 10             	push   0x10(%ebp)
+  80295e:	ff 75 0c             	push   0xc(%ebp)
+  802961:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802967:	50                   	push   %eax
+  802968:	68 f5 28 80 00       	push   $0x8028f5
+  80296d:	e8 5c da ff ff       	call   8003ce <vprintfmt>
+	if (b.idx > 0)
+  802972:	83 c4 10             	add    $0x10,%esp
+  802975:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  80297c:	7f 12                	jg     802990 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  80297e:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802984:	85 c0                	test   %eax,%eax
+  802986:	75 06                	jne    80298e <vfprintf+0x63>
+  802988:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  80298e:	c9                   	leave
+  80298f:	c3                   	ret
+		writebuf(&b);
+  802990:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802996:	e8 1b ff ff ff       	call   8028b6 <writebuf>
+  80299b:	eb e1                	jmp    80297e <vfprintf+0x53>
+
+0080299d <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  80299d:	55                   	push   %ebp
+  80299e:	89 e5                	mov    %esp,%ebp
+  8029a0:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8029a3:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8029a6:	50                   	push   %eax
+  8029a7:	ff 75 0c             	push   0xc(%ebp)
+  8029aa:	ff 75 08             	push   0x8(%ebp)
+  8029ad:	e8 79 ff ff ff       	call   80292b <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8029b2:	c9                   	leave
+  8029b3:	c3                   	ret
+
+008029b4 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8029b4:	55                   	push   %ebp
+  8029b5:	89 e5                	mov    %esp,%ebp
+  8029b7:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8029ba:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  8029bd:	50                   	push   %eax
+  8029be:	ff 75 08             	push   0x8(%ebp)
+  8029c1:	6a 01                	push   $0x1
+  8029c3:	e8 63 ff ff ff       	call   80292b <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8029c8:	c9                   	leave
+  8029c9:	c3                   	ret
+
+008029ca <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8029ca:	55                   	push   %ebp
+  8029cb:	89 e5                	mov    %esp,%ebp
+  8029cd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8029d0:	68 f6 40 80 00       	push   $0x8040f6
+  8029d5:	ff 75 0c             	push   0xc(%ebp)
+  8029d8:	e8 e8 de ff ff       	call   8008c5 <strcpy>
+	return 0;
+}
+  8029dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e2:	c9                   	leave
+  8029e3:	c3                   	ret
+
+008029e4 <devsock_close>:
+{
+  8029e4:	55                   	push   %ebp
+  8029e5:	89 e5                	mov    %esp,%ebp
+  8029e7:	53                   	push   %ebx
+  8029e8:	83 ec 10             	sub    $0x10,%esp
+  8029eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8029ee:	53                   	push   %ebx
+  8029ef:	e8 e3 0e 00 00       	call   8038d7 <pageref>
+  8029f4:	89 c2                	mov    %eax,%edx
+  8029f6:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8029f9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8029fe:	83 fa 01             	cmp    $0x1,%edx
+  802a01:	74 05                	je     802a08 <devsock_close+0x24>
+}
+  802a03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a06:	c9                   	leave
+  802a07:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802a08:	83 ec 0c             	sub    $0xc,%esp
+  802a0b:	ff 73 0c             	push   0xc(%ebx)
+  802a0e:	e8 b7 02 00 00       	call   802cca <nsipc_close>
+  802a13:	83 c4 10             	add    $0x10,%esp
+  802a16:	eb eb                	jmp    802a03 <devsock_close+0x1f>
+
+00802a18 <devsock_write>:
+{
+  802a18:	55                   	push   %ebp
+  802a19:	89 e5                	mov    %esp,%ebp
+  802a1b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802a1e:	6a 00                	push   $0x0
+  802a20:	ff 75 10             	push   0x10(%ebp)
+  802a23:	ff 75 0c             	push   0xc(%ebp)
+  802a26:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a29:	ff 70 0c             	push   0xc(%eax)
+  802a2c:	e8 79 03 00 00       	call   802daa <nsipc_send>
+}
+  802a31:	c9                   	leave
+  802a32:	c3                   	ret
+
+00802a33 <devsock_read>:
+{
+  802a33:	55                   	push   %ebp
+  802a34:	89 e5                	mov    %esp,%ebp
+  802a36:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802a39:	6a 00                	push   $0x0
+  802a3b:	ff 75 10             	push   0x10(%ebp)
+  802a3e:	ff 75 0c             	push   0xc(%ebp)
+  802a41:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a44:	ff 70 0c             	push   0xc(%eax)
+  802a47:	e8 ef 02 00 00       	call   802d3b <nsipc_recv>
+}
+  802a4c:	c9                   	leave
+  802a4d:	c3                   	ret
+
+00802a4e <fd2sockid>:
+{
+  802a4e:	55                   	push   %ebp
+  802a4f:	89 e5                	mov    %esp,%ebp
+  802a51:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802a54:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a57:	52                   	push   %edx
+  802a58:	50                   	push   %eax
+  802a59:	e8 40 e8 ff ff       	call   80129e <fd_lookup>
+  802a5e:	83 c4 10             	add    $0x10,%esp
+  802a61:	85 c0                	test   %eax,%eax
+  802a63:	78 10                	js     802a75 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802a65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a68:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802a6e:	39 08                	cmp    %ecx,(%eax)
+  802a70:	75 05                	jne    802a77 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802a72:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802a75:	c9                   	leave
+  802a76:	c3                   	ret
+		return -E_NOT_SUPP;
+  802a77:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a7c:	eb f7                	jmp    802a75 <fd2sockid+0x27>
+
+00802a7e <alloc_sockfd>:
+{
+  802a7e:	55                   	push   %ebp
+  802a7f:	89 e5                	mov    %esp,%ebp
+  802a81:	56                   	push   %esi
+  802a82:	53                   	push   %ebx
+  802a83:	83 ec 1c             	sub    $0x1c,%esp
+  802a86:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802a88:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a8b:	50                   	push   %eax
+  802a8c:	e8 b7 e7 ff ff       	call   801248 <fd_alloc>
+  802a91:	89 c3                	mov    %eax,%ebx
+  802a93:	83 c4 10             	add    $0x10,%esp
+  802a96:	85 c0                	test   %eax,%eax
+  802a98:	78 43                	js     802add <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802a9a:	83 ec 04             	sub    $0x4,%esp
+  802a9d:	68 07 04 00 00       	push   $0x407
+  802aa2:	ff 75 f4             	push   -0xc(%ebp)
+  802aa5:	6a 00                	push   $0x0
+  802aa7:	e8 25 e2 ff ff       	call   800cd1 <sys_page_alloc>
+  802aac:	89 c3                	mov    %eax,%ebx
+  802aae:	83 c4 10             	add    $0x10,%esp
+  802ab1:	85 c0                	test   %eax,%eax
+  802ab3:	78 28                	js     802add <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802ab5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ab8:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802abe:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802ac0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ac3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802aca:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802acd:	83 ec 0c             	sub    $0xc,%esp
+  802ad0:	50                   	push   %eax
+  802ad1:	e8 4b e7 ff ff       	call   801221 <fd2num>
+  802ad6:	89 c3                	mov    %eax,%ebx
+  802ad8:	83 c4 10             	add    $0x10,%esp
+  802adb:	eb 0c                	jmp    802ae9 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802add:	83 ec 0c             	sub    $0xc,%esp
+  802ae0:	56                   	push   %esi
+  802ae1:	e8 e4 01 00 00       	call   802cca <nsipc_close>
+		return r;
+  802ae6:	83 c4 10             	add    $0x10,%esp
+}
+  802ae9:	89 d8                	mov    %ebx,%eax
+  802aeb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802aee:	5b                   	pop    %ebx
+  802aef:	5e                   	pop    %esi
+  802af0:	5d                   	pop    %ebp
+  802af1:	c3                   	ret
+
+00802af2 <accept>:
+{
+  802af2:	55                   	push   %ebp
+  802af3:	89 e5                	mov    %esp,%ebp
+  802af5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802af8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802afb:	e8 4e ff ff ff       	call   802a4e <fd2sockid>
+  802b00:	85 c0                	test   %eax,%eax
+  802b02:	78 1b                	js     802b1f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802b04:	83 ec 04             	sub    $0x4,%esp
+  802b07:	ff 75 10             	push   0x10(%ebp)
+  802b0a:	ff 75 0c             	push   0xc(%ebp)
+  802b0d:	50                   	push   %eax
+  802b0e:	e8 0e 01 00 00       	call   802c21 <nsipc_accept>
+  802b13:	83 c4 10             	add    $0x10,%esp
+  802b16:	85 c0                	test   %eax,%eax
+  802b18:	78 05                	js     802b1f <accept+0x2d>
+	return alloc_sockfd(r);
+  802b1a:	e8 5f ff ff ff       	call   802a7e <alloc_sockfd>
+}
+  802b1f:	c9                   	leave
+  802b20:	c3                   	ret
+
+00802b21 <bind>:
+{
+  802b21:	55                   	push   %ebp
+  802b22:	89 e5                	mov    %esp,%ebp
+  802b24:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b27:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b2a:	e8 1f ff ff ff       	call   802a4e <fd2sockid>
+  802b2f:	85 c0                	test   %eax,%eax
+  802b31:	78 12                	js     802b45 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802b33:	83 ec 04             	sub    $0x4,%esp
+  802b36:	ff 75 10             	push   0x10(%ebp)
+  802b39:	ff 75 0c             	push   0xc(%ebp)
+  802b3c:	50                   	push   %eax
+  802b3d:	e8 31 01 00 00       	call   802c73 <nsipc_bind>
+  802b42:	83 c4 10             	add    $0x10,%esp
+}
+  802b45:	c9                   	leave
+  802b46:	c3                   	ret
+
+00802b47 <shutdown>:
+{
+  802b47:	55                   	push   %ebp
+  802b48:	89 e5                	mov    %esp,%ebp
+  802b4a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b50:	e8 f9 fe ff ff       	call   802a4e <fd2sockid>
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	78 0f                	js     802b68 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802b59:	83 ec 08             	sub    $0x8,%esp
+  802b5c:	ff 75 0c             	push   0xc(%ebp)
+  802b5f:	50                   	push   %eax
+  802b60:	e8 43 01 00 00       	call   802ca8 <nsipc_shutdown>
+  802b65:	83 c4 10             	add    $0x10,%esp
+}
+  802b68:	c9                   	leave
+  802b69:	c3                   	ret
+
+00802b6a <connect>:
+{
+  802b6a:	55                   	push   %ebp
+  802b6b:	89 e5                	mov    %esp,%ebp
+  802b6d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b70:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b73:	e8 d6 fe ff ff       	call   802a4e <fd2sockid>
+  802b78:	85 c0                	test   %eax,%eax
+  802b7a:	78 12                	js     802b8e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802b7c:	83 ec 04             	sub    $0x4,%esp
+  802b7f:	ff 75 10             	push   0x10(%ebp)
+  802b82:	ff 75 0c             	push   0xc(%ebp)
+  802b85:	50                   	push   %eax
+  802b86:	e8 59 01 00 00       	call   802ce4 <nsipc_connect>
+  802b8b:	83 c4 10             	add    $0x10,%esp
+}
+  802b8e:	c9                   	leave
+  802b8f:	c3                   	ret
+
+00802b90 <listen>:
+{
+  802b90:	55                   	push   %ebp
+  802b91:	89 e5                	mov    %esp,%ebp
+  802b93:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b96:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b99:	e8 b0 fe ff ff       	call   802a4e <fd2sockid>
+  802b9e:	85 c0                	test   %eax,%eax
+  802ba0:	78 0f                	js     802bb1 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802ba2:	83 ec 08             	sub    $0x8,%esp
+  802ba5:	ff 75 0c             	push   0xc(%ebp)
+  802ba8:	50                   	push   %eax
+  802ba9:	e8 6b 01 00 00       	call   802d19 <nsipc_listen>
+  802bae:	83 c4 10             	add    $0x10,%esp
+}
+  802bb1:	c9                   	leave
+  802bb2:	c3                   	ret
+
+00802bb3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802bb3:	55                   	push   %ebp
+  802bb4:	89 e5                	mov    %esp,%ebp
+  802bb6:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802bb9:	ff 75 10             	push   0x10(%ebp)
+  802bbc:	ff 75 0c             	push   0xc(%ebp)
+  802bbf:	ff 75 08             	push   0x8(%ebp)
+  802bc2:	e8 41 02 00 00       	call   802e08 <nsipc_socket>
+  802bc7:	83 c4 10             	add    $0x10,%esp
+  802bca:	85 c0                	test   %eax,%eax
+  802bcc:	78 05                	js     802bd3 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802bce:	e8 ab fe ff ff       	call   802a7e <alloc_sockfd>
+}
+  802bd3:	c9                   	leave
+  802bd4:	c3                   	ret
+
+00802bd5 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802bd5:	55                   	push   %ebp
+  802bd6:	89 e5                	mov    %esp,%ebp
+  802bd8:	53                   	push   %ebx
+  802bd9:	83 ec 04             	sub    $0x4,%esp
+  802bdc:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802bde:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  802be5:	74 26                	je     802c0d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802be7:	6a 07                	push   $0x7
+  802be9:	68 00 a0 80 00       	push   $0x80a000
+  802bee:	53                   	push   %ebx
+  802bef:	ff 35 00 b0 80 00    	push   0x80b000
+  802bf5:	e8 65 0b 00 00       	call   80375f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802bfa:	83 c4 0c             	add    $0xc,%esp
+  802bfd:	6a 00                	push   $0x0
+  802bff:	6a 00                	push   $0x0
+  802c01:	6a 00                	push   $0x0
+  802c03:	e8 ec 0a 00 00       	call   8036f4 <ipc_recv>
+}
+  802c08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c0b:	c9                   	leave
+  802c0c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c0d:	83 ec 0c             	sub    $0xc,%esp
+  802c10:	6a 02                	push   $0x2
+  802c12:	e8 81 0c 00 00       	call   803898 <ipc_find_env>
+  802c17:	a3 00 b0 80 00       	mov    %eax,0x80b000
+  802c1c:	83 c4 10             	add    $0x10,%esp
+  802c1f:	eb c6                	jmp    802be7 <nsipc+0x12>
+
+00802c21 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802c21:	55                   	push   %ebp
+  802c22:	89 e5                	mov    %esp,%ebp
+  802c24:	56                   	push   %esi
+  802c25:	53                   	push   %ebx
+  802c26:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802c29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c2c:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802c31:	8b 06                	mov    (%esi),%eax
+  802c33:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802c38:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c3d:	e8 93 ff ff ff       	call   802bd5 <nsipc>
+  802c42:	89 c3                	mov    %eax,%ebx
+  802c44:	85 c0                	test   %eax,%eax
+  802c46:	79 09                	jns    802c51 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802c48:	89 d8                	mov    %ebx,%eax
+  802c4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c4d:	5b                   	pop    %ebx
+  802c4e:	5e                   	pop    %esi
+  802c4f:	5d                   	pop    %ebp
+  802c50:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802c51:	83 ec 04             	sub    $0x4,%esp
+  802c54:	ff 35 10 a0 80 00    	push   0x80a010
+  802c5a:	68 00 a0 80 00       	push   $0x80a000
+  802c5f:	ff 75 0c             	push   0xc(%ebp)
+  802c62:	e8 e4 dd ff ff       	call   800a4b <memmove>
+		*addrlen = ret->ret_addrlen;
+  802c67:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802c6c:	89 06                	mov    %eax,(%esi)
+  802c6e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802c71:	eb d5                	jmp    802c48 <nsipc_accept+0x27>
+
+00802c73 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802c73:	55                   	push   %ebp
+  802c74:	89 e5                	mov    %esp,%ebp
+  802c76:	53                   	push   %ebx
+  802c77:	83 ec 08             	sub    $0x8,%esp
+  802c7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802c7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c80:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802c85:	53                   	push   %ebx
+  802c86:	ff 75 0c             	push   0xc(%ebp)
+  802c89:	68 04 a0 80 00       	push   $0x80a004
+  802c8e:	e8 b8 dd ff ff       	call   800a4b <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802c93:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_BIND);
+  802c99:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c9e:	e8 32 ff ff ff       	call   802bd5 <nsipc>
+}
+  802ca3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ca6:	c9                   	leave
+  802ca7:	c3                   	ret
+
+00802ca8 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802ca8:	55                   	push   %ebp
+  802ca9:	89 e5                	mov    %esp,%ebp
+  802cab:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802cae:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb1:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.shutdown.req_how = how;
+  802cb6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cb9:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_SHUTDOWN);
+  802cbe:	b8 03 00 00 00       	mov    $0x3,%eax
+  802cc3:	e8 0d ff ff ff       	call   802bd5 <nsipc>
+}
+  802cc8:	c9                   	leave
+  802cc9:	c3                   	ret
+
+00802cca <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802cca:	55                   	push   %ebp
+  802ccb:	89 e5                	mov    %esp,%ebp
+  802ccd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802cd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd3:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_CLOSE);
+  802cd8:	b8 04 00 00 00       	mov    $0x4,%eax
+  802cdd:	e8 f3 fe ff ff       	call   802bd5 <nsipc>
+}
+  802ce2:	c9                   	leave
+  802ce3:	c3                   	ret
+
+00802ce4 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802ce4:	55                   	push   %ebp
+  802ce5:	89 e5                	mov    %esp,%ebp
+  802ce7:	53                   	push   %ebx
+  802ce8:	83 ec 08             	sub    $0x8,%esp
+  802ceb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802cee:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf1:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802cf6:	53                   	push   %ebx
+  802cf7:	ff 75 0c             	push   0xc(%ebp)
+  802cfa:	68 04 a0 80 00       	push   $0x80a004
+  802cff:	e8 47 dd ff ff       	call   800a4b <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802d04:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_CONNECT);
+  802d0a:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d0f:	e8 c1 fe ff ff       	call   802bd5 <nsipc>
+}
+  802d14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d17:	c9                   	leave
+  802d18:	c3                   	ret
+
+00802d19 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802d19:	55                   	push   %ebp
+  802d1a:	89 e5                	mov    %esp,%ebp
+  802d1c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802d1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d22:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.listen.req_backlog = backlog;
+  802d27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d2a:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_LISTEN);
+  802d2f:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d34:	e8 9c fe ff ff       	call   802bd5 <nsipc>
+}
+  802d39:	c9                   	leave
+  802d3a:	c3                   	ret
+
+00802d3b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802d3b:	55                   	push   %ebp
+  802d3c:	89 e5                	mov    %esp,%ebp
+  802d3e:	56                   	push   %esi
+  802d3f:	53                   	push   %ebx
+  802d40:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802d43:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d46:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.recv.req_len = len;
+  802d4b:	89 35 04 a0 80 00    	mov    %esi,0x80a004
+	nsipcbuf.recv.req_flags = flags;
+  802d51:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d54:	a3 08 a0 80 00       	mov    %eax,0x80a008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802d59:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d5e:	e8 72 fe ff ff       	call   802bd5 <nsipc>
+  802d63:	89 c3                	mov    %eax,%ebx
+  802d65:	85 c0                	test   %eax,%eax
+  802d67:	78 22                	js     802d8b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802d69:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d6e:	39 c6                	cmp    %eax,%esi
+  802d70:	0f 4e c6             	cmovle %esi,%eax
+  802d73:	39 c3                	cmp    %eax,%ebx
+  802d75:	7f 1d                	jg     802d94 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802d77:	83 ec 04             	sub    $0x4,%esp
+  802d7a:	53                   	push   %ebx
+  802d7b:	68 00 a0 80 00       	push   $0x80a000
+  802d80:	ff 75 0c             	push   0xc(%ebp)
+  802d83:	e8 c3 dc ff ff       	call   800a4b <memmove>
+  802d88:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802d8b:	89 d8                	mov    %ebx,%eax
+  802d8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d90:	5b                   	pop    %ebx
+  802d91:	5e                   	pop    %esi
+  802d92:	5d                   	pop    %ebp
+  802d93:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802d94:	68 02 41 80 00       	push   $0x804102
+  802d99:	68 a0 40 80 00       	push   $0x8040a0
+  802d9e:	6a 62                	push   $0x62
+  802da0:	68 17 41 80 00       	push   $0x804117
+  802da5:	e8 46 05 00 00       	call   8032f0 <_panic>
+
+00802daa <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802daa:	55                   	push   %ebp
+  802dab:	89 e5                	mov    %esp,%ebp
+  802dad:	53                   	push   %ebx
+  802dae:	83 ec 04             	sub    $0x4,%esp
+  802db1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802db4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802db7:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	assert(size < 1600);
+  802dbc:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802dc2:	7f 2e                	jg     802df2 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802dc4:	83 ec 04             	sub    $0x4,%esp
+  802dc7:	53                   	push   %ebx
+  802dc8:	ff 75 0c             	push   0xc(%ebp)
+  802dcb:	68 0c a0 80 00       	push   $0x80a00c
+  802dd0:	e8 76 dc ff ff       	call   800a4b <memmove>
+	nsipcbuf.send.req_size = size;
+  802dd5:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	nsipcbuf.send.req_flags = flags;
+  802ddb:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dde:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SEND);
+  802de3:	b8 08 00 00 00       	mov    $0x8,%eax
+  802de8:	e8 e8 fd ff ff       	call   802bd5 <nsipc>
+}
+  802ded:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802df0:	c9                   	leave
+  802df1:	c3                   	ret
+	assert(size < 1600);
+  802df2:	68 23 41 80 00       	push   $0x804123
+  802df7:	68 a0 40 80 00       	push   $0x8040a0
+  802dfc:	6a 6d                	push   $0x6d
+  802dfe:	68 17 41 80 00       	push   $0x804117
+  802e03:	e8 e8 04 00 00       	call   8032f0 <_panic>
+
+00802e08 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802e08:	55                   	push   %ebp
+  802e09:	89 e5                	mov    %esp,%ebp
+  802e0b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802e0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e11:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.socket.req_type = type;
+  802e16:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e19:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.socket.req_protocol = protocol;
+  802e1e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e21:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SOCKET);
+  802e26:	b8 09 00 00 00       	mov    $0x9,%eax
+  802e2b:	e8 a5 fd ff ff       	call   802bd5 <nsipc>
+}
+  802e30:	c9                   	leave
+  802e31:	c3                   	ret
+
+00802e32 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e32:	55                   	push   %ebp
+  802e33:	89 e5                	mov    %esp,%ebp
+  802e35:	56                   	push   %esi
+  802e36:	53                   	push   %ebx
+  802e37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e3a:	83 ec 0c             	sub    $0xc,%esp
+  802e3d:	ff 75 08             	push   0x8(%ebp)
+  802e40:	e8 ec e3 ff ff       	call   801231 <fd2data>
+  802e45:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802e47:	83 c4 08             	add    $0x8,%esp
+  802e4a:	68 2f 41 80 00       	push   $0x80412f
+  802e4f:	53                   	push   %ebx
+  802e50:	e8 70 da ff ff       	call   8008c5 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802e55:	8b 46 04             	mov    0x4(%esi),%eax
+  802e58:	2b 06                	sub    (%esi),%eax
+  802e5a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802e60:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e67:	00 00 00 
+	stat->st_dev = &devpipe;
+  802e6a:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  802e71:	50 80 00 
+	return 0;
+}
+  802e74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e7c:	5b                   	pop    %ebx
+  802e7d:	5e                   	pop    %esi
+  802e7e:	5d                   	pop    %ebp
+  802e7f:	c3                   	ret
+
+00802e80 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e80:	55                   	push   %ebp
+  802e81:	89 e5                	mov    %esp,%ebp
+  802e83:	53                   	push   %ebx
+  802e84:	83 ec 0c             	sub    $0xc,%esp
+  802e87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802e8a:	53                   	push   %ebx
+  802e8b:	6a 00                	push   $0x0
+  802e8d:	e8 cc de ff ff       	call   800d5e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802e92:	89 1c 24             	mov    %ebx,(%esp)
+  802e95:	e8 97 e3 ff ff       	call   801231 <fd2data>
+  802e9a:	83 c4 08             	add    $0x8,%esp
+  802e9d:	50                   	push   %eax
+  802e9e:	6a 00                	push   $0x0
+  802ea0:	e8 b9 de ff ff       	call   800d5e <sys_page_unmap>
+}
+  802ea5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ea8:	c9                   	leave
+  802ea9:	c3                   	ret
+
+00802eaa <_pipeisclosed>:
+{
+  802eaa:	55                   	push   %ebp
+  802eab:	89 e5                	mov    %esp,%ebp
+  802ead:	57                   	push   %edi
+  802eae:	56                   	push   %esi
+  802eaf:	53                   	push   %ebx
+  802eb0:	83 ec 1c             	sub    $0x1c,%esp
+  802eb3:	89 c7                	mov    %eax,%edi
+  802eb5:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802eb7:	a1 04 70 80 00       	mov    0x807004,%eax
+  802ebc:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802ebf:	83 ec 0c             	sub    $0xc,%esp
+  802ec2:	57                   	push   %edi
+  802ec3:	e8 0f 0a 00 00       	call   8038d7 <pageref>
+  802ec8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ecb:	89 34 24             	mov    %esi,(%esp)
+  802ece:	e8 04 0a 00 00       	call   8038d7 <pageref>
+		nn = thisenv->env_runs;
+  802ed3:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  802ed9:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802edc:	83 c4 10             	add    $0x10,%esp
+  802edf:	39 cb                	cmp    %ecx,%ebx
+  802ee1:	74 1b                	je     802efe <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802ee3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ee6:	75 cf                	jne    802eb7 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802ee8:	8b 42 58             	mov    0x58(%edx),%eax
+  802eeb:	6a 01                	push   $0x1
+  802eed:	50                   	push   %eax
+  802eee:	53                   	push   %ebx
+  802eef:	68 36 41 80 00       	push   $0x804136
+  802ef4:	e8 d2 04 00 00       	call   8033cb <cprintf>
+  802ef9:	83 c4 10             	add    $0x10,%esp
+  802efc:	eb b9                	jmp    802eb7 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802efe:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f01:	0f 94 c0             	sete   %al
+  802f04:	0f b6 c0             	movzbl %al,%eax
+}
+  802f07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f0a:	5b                   	pop    %ebx
+  802f0b:	5e                   	pop    %esi
+  802f0c:	5f                   	pop    %edi
+  802f0d:	5d                   	pop    %ebp
+  802f0e:	c3                   	ret
+
+00802f0f <devpipe_write>:
+{
+  802f0f:	55                   	push   %ebp
+  802f10:	89 e5                	mov    %esp,%ebp
+  802f12:	57                   	push   %edi
+  802f13:	56                   	push   %esi
+  802f14:	53                   	push   %ebx
+  802f15:	83 ec 28             	sub    $0x28,%esp
+  802f18:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802f1b:	56                   	push   %esi
+  802f1c:	e8 10 e3 ff ff       	call   801231 <fd2data>
+  802f21:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f23:	83 c4 10             	add    $0x10,%esp
+  802f26:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f2b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802f2e:	75 09                	jne    802f39 <devpipe_write+0x2a>
+	return i;
+  802f30:	89 f8                	mov    %edi,%eax
+  802f32:	eb 23                	jmp    802f57 <devpipe_write+0x48>
+			sys_yield();
+  802f34:	e8 79 dd ff ff       	call   800cb2 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802f39:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f3c:	8b 0b                	mov    (%ebx),%ecx
+  802f3e:	8d 51 20             	lea    0x20(%ecx),%edx
+  802f41:	39 d0                	cmp    %edx,%eax
+  802f43:	72 1a                	jb     802f5f <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802f45:	89 da                	mov    %ebx,%edx
+  802f47:	89 f0                	mov    %esi,%eax
+  802f49:	e8 5c ff ff ff       	call   802eaa <_pipeisclosed>
+  802f4e:	85 c0                	test   %eax,%eax
+  802f50:	74 e2                	je     802f34 <devpipe_write+0x25>
+				return 0;
+  802f52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f5a:	5b                   	pop    %ebx
+  802f5b:	5e                   	pop    %esi
+  802f5c:	5f                   	pop    %edi
+  802f5d:	5d                   	pop    %ebp
+  802f5e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802f5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f62:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802f66:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802f69:	89 c2                	mov    %eax,%edx
+  802f6b:	c1 fa 1f             	sar    $0x1f,%edx
+  802f6e:	89 d1                	mov    %edx,%ecx
+  802f70:	c1 e9 1b             	shr    $0x1b,%ecx
+  802f73:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802f76:	83 e2 1f             	and    $0x1f,%edx
+  802f79:	29 ca                	sub    %ecx,%edx
+  802f7b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802f7f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802f83:	83 c0 01             	add    $0x1,%eax
+  802f86:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802f89:	83 c7 01             	add    $0x1,%edi
+  802f8c:	eb 9d                	jmp    802f2b <devpipe_write+0x1c>
+
+00802f8e <devpipe_read>:
+{
+  802f8e:	55                   	push   %ebp
+  802f8f:	89 e5                	mov    %esp,%ebp
+  802f91:	57                   	push   %edi
+  802f92:	56                   	push   %esi
+  802f93:	53                   	push   %ebx
+  802f94:	83 ec 18             	sub    $0x18,%esp
+  802f97:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802f9a:	57                   	push   %edi
+  802f9b:	e8 91 e2 ff ff       	call   801231 <fd2data>
+  802fa0:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802fa2:	83 c4 10             	add    $0x10,%esp
+  802fa5:	be 00 00 00 00       	mov    $0x0,%esi
+  802faa:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802fad:	75 13                	jne    802fc2 <devpipe_read+0x34>
+	return i;
+  802faf:	89 f0                	mov    %esi,%eax
+  802fb1:	eb 02                	jmp    802fb5 <devpipe_read+0x27>
+				return i;
+  802fb3:	89 f0                	mov    %esi,%eax
+}
+  802fb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fb8:	5b                   	pop    %ebx
+  802fb9:	5e                   	pop    %esi
+  802fba:	5f                   	pop    %edi
+  802fbb:	5d                   	pop    %ebp
+  802fbc:	c3                   	ret
+			sys_yield();
+  802fbd:	e8 f0 dc ff ff       	call   800cb2 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802fc2:	8b 03                	mov    (%ebx),%eax
+  802fc4:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802fc7:	75 18                	jne    802fe1 <devpipe_read+0x53>
+			if (i > 0)
+  802fc9:	85 f6                	test   %esi,%esi
+  802fcb:	75 e6                	jne    802fb3 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802fcd:	89 da                	mov    %ebx,%edx
+  802fcf:	89 f8                	mov    %edi,%eax
+  802fd1:	e8 d4 fe ff ff       	call   802eaa <_pipeisclosed>
+  802fd6:	85 c0                	test   %eax,%eax
+  802fd8:	74 e3                	je     802fbd <devpipe_read+0x2f>
+				return 0;
+  802fda:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fdf:	eb d4                	jmp    802fb5 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802fe1:	99                   	cltd
+  802fe2:	c1 ea 1b             	shr    $0x1b,%edx
+  802fe5:	01 d0                	add    %edx,%eax
+  802fe7:	83 e0 1f             	and    $0x1f,%eax
+  802fea:	29 d0                	sub    %edx,%eax
+  802fec:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802ff1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ff4:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802ff7:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802ffa:	83 c6 01             	add    $0x1,%esi
+  802ffd:	eb ab                	jmp    802faa <devpipe_read+0x1c>
+
+00802fff <pipe>:
+{
+  802fff:	55                   	push   %ebp
+  803000:	89 e5                	mov    %esp,%ebp
+  803002:	56                   	push   %esi
+  803003:	53                   	push   %ebx
+  803004:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803007:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80300a:	50                   	push   %eax
+  80300b:	e8 38 e2 ff ff       	call   801248 <fd_alloc>
+  803010:	89 c3                	mov    %eax,%ebx
+  803012:	83 c4 10             	add    $0x10,%esp
+  803015:	85 c0                	test   %eax,%eax
+  803017:	0f 88 23 01 00 00    	js     803140 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80301d:	83 ec 04             	sub    $0x4,%esp
+  803020:	68 07 04 00 00       	push   $0x407
+  803025:	ff 75 f4             	push   -0xc(%ebp)
+  803028:	6a 00                	push   $0x0
+  80302a:	e8 a2 dc ff ff       	call   800cd1 <sys_page_alloc>
+  80302f:	89 c3                	mov    %eax,%ebx
+  803031:	83 c4 10             	add    $0x10,%esp
+  803034:	85 c0                	test   %eax,%eax
+  803036:	0f 88 04 01 00 00    	js     803140 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80303c:	83 ec 0c             	sub    $0xc,%esp
+  80303f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803042:	50                   	push   %eax
+  803043:	e8 00 e2 ff ff       	call   801248 <fd_alloc>
+  803048:	89 c3                	mov    %eax,%ebx
+  80304a:	83 c4 10             	add    $0x10,%esp
+  80304d:	85 c0                	test   %eax,%eax
+  80304f:	0f 88 db 00 00 00    	js     803130 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803055:	83 ec 04             	sub    $0x4,%esp
+  803058:	68 07 04 00 00       	push   $0x407
+  80305d:	ff 75 f0             	push   -0x10(%ebp)
+  803060:	6a 00                	push   $0x0
+  803062:	e8 6a dc ff ff       	call   800cd1 <sys_page_alloc>
+  803067:	89 c3                	mov    %eax,%ebx
+  803069:	83 c4 10             	add    $0x10,%esp
+  80306c:	85 c0                	test   %eax,%eax
+  80306e:	0f 88 bc 00 00 00    	js     803130 <pipe+0x131>
+	va = fd2data(fd0);
+  803074:	83 ec 0c             	sub    $0xc,%esp
+  803077:	ff 75 f4             	push   -0xc(%ebp)
+  80307a:	e8 b2 e1 ff ff       	call   801231 <fd2data>
+  80307f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803081:	83 c4 0c             	add    $0xc,%esp
+  803084:	68 07 04 00 00       	push   $0x407
+  803089:	50                   	push   %eax
+  80308a:	6a 00                	push   $0x0
+  80308c:	e8 40 dc ff ff       	call   800cd1 <sys_page_alloc>
+  803091:	89 c3                	mov    %eax,%ebx
+  803093:	83 c4 10             	add    $0x10,%esp
+  803096:	85 c0                	test   %eax,%eax
+  803098:	0f 88 82 00 00 00    	js     803120 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80309e:	83 ec 0c             	sub    $0xc,%esp
+  8030a1:	ff 75 f0             	push   -0x10(%ebp)
+  8030a4:	e8 88 e1 ff ff       	call   801231 <fd2data>
+  8030a9:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8030b0:	50                   	push   %eax
+  8030b1:	6a 00                	push   $0x0
+  8030b3:	56                   	push   %esi
+  8030b4:	6a 00                	push   $0x0
+  8030b6:	e8 61 dc ff ff       	call   800d1c <sys_page_map>
+  8030bb:	89 c3                	mov    %eax,%ebx
+  8030bd:	83 c4 20             	add    $0x20,%esp
+  8030c0:	85 c0                	test   %eax,%eax
+  8030c2:	78 4e                	js     803112 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8030c4:	a1 60 50 80 00       	mov    0x805060,%eax
+  8030c9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030cc:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8030ce:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030d1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8030d8:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8030db:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8030dd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8030e0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8030e7:	83 ec 0c             	sub    $0xc,%esp
+  8030ea:	ff 75 f4             	push   -0xc(%ebp)
+  8030ed:	e8 2f e1 ff ff       	call   801221 <fd2num>
+  8030f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030f5:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8030f7:	83 c4 04             	add    $0x4,%esp
+  8030fa:	ff 75 f0             	push   -0x10(%ebp)
+  8030fd:	e8 1f e1 ff ff       	call   801221 <fd2num>
+  803102:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803105:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803108:	83 c4 10             	add    $0x10,%esp
+  80310b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803110:	eb 2e                	jmp    803140 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803112:	83 ec 08             	sub    $0x8,%esp
+  803115:	56                   	push   %esi
+  803116:	6a 00                	push   $0x0
+  803118:	e8 41 dc ff ff       	call   800d5e <sys_page_unmap>
+  80311d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803120:	83 ec 08             	sub    $0x8,%esp
+  803123:	ff 75 f0             	push   -0x10(%ebp)
+  803126:	6a 00                	push   $0x0
+  803128:	e8 31 dc ff ff       	call   800d5e <sys_page_unmap>
+  80312d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803130:	83 ec 08             	sub    $0x8,%esp
+  803133:	ff 75 f4             	push   -0xc(%ebp)
+  803136:	6a 00                	push   $0x0
+  803138:	e8 21 dc ff ff       	call   800d5e <sys_page_unmap>
+  80313d:	83 c4 10             	add    $0x10,%esp
+}
+  803140:	89 d8                	mov    %ebx,%eax
+  803142:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803145:	5b                   	pop    %ebx
+  803146:	5e                   	pop    %esi
+  803147:	5d                   	pop    %ebp
+  803148:	c3                   	ret
+
+00803149 <pipeisclosed>:
+{
+  803149:	55                   	push   %ebp
+  80314a:	89 e5                	mov    %esp,%ebp
+  80314c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80314f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803152:	50                   	push   %eax
+  803153:	ff 75 08             	push   0x8(%ebp)
+  803156:	e8 43 e1 ff ff       	call   80129e <fd_lookup>
+  80315b:	83 c4 10             	add    $0x10,%esp
+  80315e:	85 c0                	test   %eax,%eax
+  803160:	78 18                	js     80317a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803162:	83 ec 0c             	sub    $0xc,%esp
+  803165:	ff 75 f4             	push   -0xc(%ebp)
+  803168:	e8 c4 e0 ff ff       	call   801231 <fd2data>
+  80316d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80316f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803172:	e8 33 fd ff ff       	call   802eaa <_pipeisclosed>
+  803177:	83 c4 10             	add    $0x10,%esp
+}
+  80317a:	c9                   	leave
+  80317b:	c3                   	ret
+
+0080317c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80317c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803181:	c3                   	ret
+
+00803182 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803182:	55                   	push   %ebp
+  803183:	89 e5                	mov    %esp,%ebp
+  803185:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803188:	68 4e 41 80 00       	push   $0x80414e
+  80318d:	ff 75 0c             	push   0xc(%ebp)
+  803190:	e8 30 d7 ff ff       	call   8008c5 <strcpy>
+	return 0;
+}
+  803195:	b8 00 00 00 00       	mov    $0x0,%eax
+  80319a:	c9                   	leave
+  80319b:	c3                   	ret
+
+0080319c <devcons_write>:
+{
+  80319c:	55                   	push   %ebp
+  80319d:	89 e5                	mov    %esp,%ebp
+  80319f:	57                   	push   %edi
+  8031a0:	56                   	push   %esi
+  8031a1:	53                   	push   %ebx
+  8031a2:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8031a8:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8031ad:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8031b3:	eb 2e                	jmp    8031e3 <devcons_write+0x47>
+		m = n - tot;
+  8031b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8031b8:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8031ba:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8031bf:	39 c3                	cmp    %eax,%ebx
+  8031c1:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8031c4:	83 ec 04             	sub    $0x4,%esp
+  8031c7:	53                   	push   %ebx
+  8031c8:	89 f0                	mov    %esi,%eax
+  8031ca:	03 45 0c             	add    0xc(%ebp),%eax
+  8031cd:	50                   	push   %eax
+  8031ce:	57                   	push   %edi
+  8031cf:	e8 77 d8 ff ff       	call   800a4b <memmove>
+		sys_cputs(buf, m);
+  8031d4:	83 c4 08             	add    $0x8,%esp
+  8031d7:	53                   	push   %ebx
+  8031d8:	57                   	push   %edi
+  8031d9:	e8 17 da ff ff       	call   800bf5 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8031de:	01 de                	add    %ebx,%esi
+  8031e0:	83 c4 10             	add    $0x10,%esp
+  8031e3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8031e6:	72 cd                	jb     8031b5 <devcons_write+0x19>
+}
+  8031e8:	89 f0                	mov    %esi,%eax
+  8031ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031ed:	5b                   	pop    %ebx
+  8031ee:	5e                   	pop    %esi
+  8031ef:	5f                   	pop    %edi
+  8031f0:	5d                   	pop    %ebp
+  8031f1:	c3                   	ret
+
+008031f2 <devcons_read>:
+{
+  8031f2:	55                   	push   %ebp
+  8031f3:	89 e5                	mov    %esp,%ebp
+  8031f5:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8031f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031fd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803201:	75 07                	jne    80320a <devcons_read+0x18>
+  803203:	eb 1f                	jmp    803224 <devcons_read+0x32>
+		sys_yield();
+  803205:	e8 a8 da ff ff       	call   800cb2 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80320a:	e8 0c da ff ff       	call   800c1b <sys_cgetc>
+  80320f:	85 c0                	test   %eax,%eax
+  803211:	74 f2                	je     803205 <devcons_read+0x13>
+	if (c < 0)
+  803213:	78 0f                	js     803224 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803215:	83 f8 04             	cmp    $0x4,%eax
+  803218:	74 0c                	je     803226 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80321a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80321d:	88 02                	mov    %al,(%edx)
+	return 1;
+  80321f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803224:	c9                   	leave
+  803225:	c3                   	ret
+		return 0;
+  803226:	b8 00 00 00 00       	mov    $0x0,%eax
+  80322b:	eb f7                	jmp    803224 <devcons_read+0x32>
+
+0080322d <cputchar>:
+{
+  80322d:	55                   	push   %ebp
+  80322e:	89 e5                	mov    %esp,%ebp
+  803230:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803233:	8b 45 08             	mov    0x8(%ebp),%eax
+  803236:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803239:	6a 01                	push   $0x1
+  80323b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80323e:	50                   	push   %eax
+  80323f:	e8 b1 d9 ff ff       	call   800bf5 <sys_cputs>
+}
+  803244:	83 c4 10             	add    $0x10,%esp
+  803247:	c9                   	leave
+  803248:	c3                   	ret
+
+00803249 <getchar>:
+{
+  803249:	55                   	push   %ebp
+  80324a:	89 e5                	mov    %esp,%ebp
+  80324c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80324f:	6a 01                	push   $0x1
+  803251:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803254:	50                   	push   %eax
+  803255:	6a 00                	push   $0x0
+  803257:	e8 a8 e2 ff ff       	call   801504 <read>
+	if (r < 0)
+  80325c:	83 c4 10             	add    $0x10,%esp
+  80325f:	85 c0                	test   %eax,%eax
+  803261:	78 06                	js     803269 <getchar+0x20>
+	if (r < 1)
+  803263:	74 06                	je     80326b <getchar+0x22>
+	return c;
+  803265:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803269:	c9                   	leave
+  80326a:	c3                   	ret
+		return -E_EOF;
+  80326b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803270:	eb f7                	jmp    803269 <getchar+0x20>
+
+00803272 <iscons>:
+{
+  803272:	55                   	push   %ebp
+  803273:	89 e5                	mov    %esp,%ebp
+  803275:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803278:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80327b:	50                   	push   %eax
+  80327c:	ff 75 08             	push   0x8(%ebp)
+  80327f:	e8 1a e0 ff ff       	call   80129e <fd_lookup>
+  803284:	83 c4 10             	add    $0x10,%esp
+  803287:	85 c0                	test   %eax,%eax
+  803289:	78 11                	js     80329c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80328b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80328e:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803294:	39 10                	cmp    %edx,(%eax)
+  803296:	0f 94 c0             	sete   %al
+  803299:	0f b6 c0             	movzbl %al,%eax
+}
+  80329c:	c9                   	leave
+  80329d:	c3                   	ret
+
+0080329e <opencons>:
+{
+  80329e:	55                   	push   %ebp
+  80329f:	89 e5                	mov    %esp,%ebp
+  8032a1:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8032a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032a7:	50                   	push   %eax
+  8032a8:	e8 9b df ff ff       	call   801248 <fd_alloc>
+  8032ad:	83 c4 10             	add    $0x10,%esp
+  8032b0:	85 c0                	test   %eax,%eax
+  8032b2:	78 3a                	js     8032ee <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8032b4:	83 ec 04             	sub    $0x4,%esp
+  8032b7:	68 07 04 00 00       	push   $0x407
+  8032bc:	ff 75 f4             	push   -0xc(%ebp)
+  8032bf:	6a 00                	push   $0x0
+  8032c1:	e8 0b da ff ff       	call   800cd1 <sys_page_alloc>
+  8032c6:	83 c4 10             	add    $0x10,%esp
+  8032c9:	85 c0                	test   %eax,%eax
+  8032cb:	78 21                	js     8032ee <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8032cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032d0:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8032d6:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8032d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032db:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8032e2:	83 ec 0c             	sub    $0xc,%esp
+  8032e5:	50                   	push   %eax
+  8032e6:	e8 36 df ff ff       	call   801221 <fd2num>
+  8032eb:	83 c4 10             	add    $0x10,%esp
+}
+  8032ee:	c9                   	leave
+  8032ef:	c3                   	ret
+
+008032f0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8032f0:	55                   	push   %ebp
+  8032f1:	89 e5                	mov    %esp,%ebp
+  8032f3:	56                   	push   %esi
+  8032f4:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8032f5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8032f8:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8032fe:	e8 88 d9 ff ff       	call   800c8b <sys_getenvid>
+  803303:	83 ec 0c             	sub    $0xc,%esp
+  803306:	ff 75 0c             	push   0xc(%ebp)
+  803309:	ff 75 08             	push   0x8(%ebp)
+  80330c:	56                   	push   %esi
+  80330d:	50                   	push   %eax
+  80330e:	68 5c 41 80 00       	push   $0x80415c
+  803313:	e8 b3 00 00 00       	call   8033cb <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803318:	83 c4 18             	add    $0x18,%esp
+  80331b:	53                   	push   %ebx
+  80331c:	ff 75 10             	push   0x10(%ebp)
+  80331f:	e8 56 00 00 00       	call   80337a <vcprintf>
+	cprintf("\n");
+  803324:	c7 04 24 57 3c 80 00 	movl   $0x803c57,(%esp)
+  80332b:	e8 9b 00 00 00       	call   8033cb <cprintf>
+  803330:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803333:	cc                   	int3
+	while (1)
+  803334:	eb fd                	jmp    803333 <_panic+0x43>
+
+00803336 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  803336:	55                   	push   %ebp
+  803337:	89 e5                	mov    %esp,%ebp
+  803339:	53                   	push   %ebx
+  80333a:	83 ec 04             	sub    $0x4,%esp
+  80333d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  803340:	8b 13                	mov    (%ebx),%edx
+  803342:	8d 42 01             	lea    0x1(%edx),%eax
+  803345:	89 03                	mov    %eax,(%ebx)
+  803347:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80334a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80334e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  803353:	74 09                	je     80335e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  803355:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  803359:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80335c:	c9                   	leave
+  80335d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80335e:	83 ec 08             	sub    $0x8,%esp
+  803361:	68 ff 00 00 00       	push   $0xff
+  803366:	8d 43 08             	lea    0x8(%ebx),%eax
+  803369:	50                   	push   %eax
+  80336a:	e8 86 d8 ff ff       	call   800bf5 <sys_cputs>
+		b->idx = 0;
+  80336f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803375:	83 c4 10             	add    $0x10,%esp
+  803378:	eb db                	jmp    803355 <putch+0x1f>
+
+0080337a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80337a:	55                   	push   %ebp
+  80337b:	89 e5                	mov    %esp,%ebp
+  80337d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  803383:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80338a:	00 00 00 
+	b.cnt = 0;
+  80338d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  803394:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  803397:	ff 75 0c             	push   0xc(%ebp)
+  80339a:	ff 75 08             	push   0x8(%ebp)
+  80339d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8033a3:	50                   	push   %eax
+  8033a4:	68 36 33 80 00       	push   $0x803336
+  8033a9:	e8 20 d0 ff ff       	call   8003ce <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8033ae:	83 c4 08             	add    $0x8,%esp
+  8033b1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8033b7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8033bd:	50                   	push   %eax
+  8033be:	e8 32 d8 ff ff       	call   800bf5 <sys_cputs>
+
+	return b.cnt;
+}
+  8033c3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8033c9:	c9                   	leave
+  8033ca:	c3                   	ret
+
+008033cb <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8033cb:	55                   	push   %ebp
+  8033cc:	89 e5                	mov    %esp,%ebp
+  8033ce:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8033d1:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8033d4:	50                   	push   %eax
+  8033d5:	ff 75 08             	push   0x8(%ebp)
+  8033d8:	e8 9d ff ff ff       	call   80337a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8033dd:	c9                   	leave
+  8033de:	c3                   	ret
+
+008033df <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  8033df:	55                   	push   %ebp
+  8033e0:	89 e5                	mov    %esp,%ebp
+  8033e2:	57                   	push   %edi
+  8033e3:	56                   	push   %esi
+  8033e4:	53                   	push   %ebx
+  8033e5:	83 ec 20             	sub    $0x20,%esp
+  8033e8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033eb:	89 d7                	mov    %edx,%edi
+  8033ed:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  8033ef:	51                   	push   %ecx
+  8033f0:	68 00 f0 7f 00       	push   $0x7ff000
+  8033f5:	6a 00                	push   $0x0
+  8033f7:	e8 d5 d8 ff ff       	call   800cd1 <sys_page_alloc>
+  8033fc:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8033fe:	83 c4 10             	add    $0x10,%esp
+  803401:	85 c0                	test   %eax,%eax
+  803403:	78 45                	js     80344a <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  803405:	83 ec 04             	sub    $0x4,%esp
+  803408:	68 00 10 00 00       	push   $0x1000
+  80340d:	57                   	push   %edi
+  80340e:	68 00 f0 7f 00       	push   $0x7ff000
+  803413:	e8 33 d6 ff ff       	call   800a4b <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  803418:	89 34 24             	mov    %esi,(%esp)
+  80341b:	57                   	push   %edi
+  80341c:	ff 75 e4             	push   -0x1c(%ebp)
+  80341f:	68 00 f0 7f 00       	push   $0x7ff000
+  803424:	6a 00                	push   $0x0
+  803426:	e8 f1 d8 ff ff       	call   800d1c <sys_page_map>
+  80342b:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80342d:	83 c4 20             	add    $0x20,%esp
+  803430:	85 c0                	test   %eax,%eax
+  803432:	78 16                	js     80344a <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803434:	83 ec 08             	sub    $0x8,%esp
+  803437:	68 00 f0 7f 00       	push   $0x7ff000
+  80343c:	6a 00                	push   $0x0
+  80343e:	e8 1b d9 ff ff       	call   800d5e <sys_page_unmap>
+  803443:	83 c4 10             	add    $0x10,%esp
+  803446:	85 c0                	test   %eax,%eax
+  803448:	75 0a                	jne    803454 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  80344a:	89 d8                	mov    %ebx,%eax
+  80344c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80344f:	5b                   	pop    %ebx
+  803450:	5e                   	pop    %esi
+  803451:	5f                   	pop    %edi
+  803452:	5d                   	pop    %ebp
+  803453:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803454:	68 80 41 80 00       	push   $0x804180
+  803459:	68 a0 40 80 00       	push   $0x8040a0
+  80345e:	6a 1b                	push   $0x1b
+  803460:	68 f8 41 80 00       	push   $0x8041f8
+  803465:	e8 86 fe ff ff       	call   8032f0 <_panic>
+
+0080346a <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80346a:	55                   	push   %ebp
+  80346b:	89 e5                	mov    %esp,%ebp
+  80346d:	53                   	push   %ebx
+  80346e:	83 ec 04             	sub    $0x4,%esp
+  803471:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803474:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803476:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  80347a:	74 21                	je     80349d <pgfault+0x33>
+  80347c:	89 d0                	mov    %edx,%eax
+  80347e:	c1 e8 16             	shr    $0x16,%eax
+  803481:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803488:	a8 01                	test   $0x1,%al
+  80348a:	74 11                	je     80349d <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  80348c:	89 d0                	mov    %edx,%eax
+  80348e:	c1 e8 0c             	shr    $0xc,%eax
+  803491:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803498:	f6 c4 08             	test   $0x8,%ah
+  80349b:	75 17                	jne    8034b4 <pgfault+0x4a>
+		if (pgfault_next) {
+  80349d:	a1 04 b0 80 00       	mov    0x80b004,%eax
+  8034a2:	85 c0                	test   %eax,%eax
+  8034a4:	74 27                	je     8034cd <pgfault+0x63>
+			pgfault_next(utf);
+  8034a6:	83 ec 0c             	sub    $0xc,%esp
+  8034a9:	53                   	push   %ebx
+  8034aa:	ff d0                	call   *%eax
+			return;
+  8034ac:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8034af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034b2:	c9                   	leave
+  8034b3:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8034b4:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8034ba:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8034bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034c4:	e8 16 ff ff ff       	call   8033df <copy_page_to>
+  8034c9:	85 c0                	test   %eax,%eax
+  8034cb:	79 e2                	jns    8034af <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8034cd:	a1 04 70 80 00       	mov    0x807004,%eax
+  8034d2:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8034d5:	ff 73 28             	push   0x28(%ebx)
+  8034d8:	ff 33                	push   (%ebx)
+  8034da:	50                   	push   %eax
+  8034db:	68 a4 41 80 00       	push   $0x8041a4
+  8034e0:	e8 e6 fe ff ff       	call   8033cb <cprintf>
+	sys_env_destroy(0);
+  8034e5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8034ec:	e8 51 d7 ff ff       	call   800c42 <sys_env_destroy>
+  8034f1:	83 c4 10             	add    $0x10,%esp
+  8034f4:	eb b9                	jmp    8034af <pgfault+0x45>
+
+008034f6 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8034f6:	55                   	push   %ebp
+  8034f7:	89 e5                	mov    %esp,%ebp
+  8034f9:	53                   	push   %ebx
+  8034fa:	83 ec 04             	sub    $0x4,%esp
+  8034fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803500:	a1 08 b0 80 00       	mov    0x80b008,%eax
+  803505:	3d 6a 34 80 00       	cmp    $0x80346a,%eax
+  80350a:	74 15                	je     803521 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80350c:	a3 04 b0 80 00       	mov    %eax,0x80b004
+		set_pgfault_handler(pgfault);
+  803511:	83 ec 0c             	sub    $0xc,%esp
+  803514:	68 6a 34 80 00       	push   $0x80346a
+  803519:	e8 fb 03 00 00       	call   803919 <set_pgfault_handler>
+  80351e:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803521:	83 ec 0c             	sub    $0xc,%esp
+  803524:	68 05 08 00 00       	push   $0x805
+  803529:	53                   	push   %ebx
+  80352a:	6a 00                	push   $0x0
+  80352c:	53                   	push   %ebx
+  80352d:	6a 00                	push   $0x0
+  80352f:	e8 e8 d7 ff ff       	call   800d1c <sys_page_map>
+}
+  803534:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803537:	c9                   	leave
+  803538:	c3                   	ret
+
+00803539 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803539:	55                   	push   %ebp
+  80353a:	89 e5                	mov    %esp,%ebp
+  80353c:	57                   	push   %edi
+  80353d:	56                   	push   %esi
+  80353e:	53                   	push   %ebx
+  80353f:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  803542:	68 6a 34 80 00       	push   $0x80346a
+  803547:	e8 cd 03 00 00       	call   803919 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80354c:	b8 07 00 00 00       	mov    $0x7,%eax
+  803551:	cd 30                	int    $0x30
+  803553:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803556:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  803559:	83 c4 10             	add    $0x10,%esp
+  80355c:	85 c0                	test   %eax,%eax
+  80355e:	0f 88 6b 01 00 00    	js     8036cf <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803564:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803569:	75 37                	jne    8035a2 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80356b:	e8 1b d7 ff ff       	call   800c8b <sys_getenvid>
+  803570:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803575:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80357b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803580:	a3 04 70 80 00       	mov    %eax,0x807004
+		return 0;
+  803585:	e9 45 01 00 00       	jmp    8036cf <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  80358a:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803590:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803596:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80359c:	0f 87 ba 00 00 00    	ja     80365c <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8035a2:	89 d8                	mov    %ebx,%eax
+  8035a4:	c1 e8 16             	shr    $0x16,%eax
+  8035a7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8035ae:	a8 01                	test   $0x1,%al
+  8035b0:	74 d8                	je     80358a <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8035b2:	89 d8                	mov    %ebx,%eax
+  8035b4:	c1 e8 0c             	shr    $0xc,%eax
+  8035b7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8035be:	f6 c2 01             	test   $0x1,%dl
+  8035c1:	74 cd                	je     803590 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8035c3:	89 da                	mov    %ebx,%edx
+  8035c5:	80 e6 df             	and    $0xdf,%dh
+  8035c8:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8035ce:	74 c0                	je     803590 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8035d0:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8035d2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8035d9:	f6 c6 04             	test   $0x4,%dh
+  8035dc:	75 53                	jne    803631 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8035de:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8035e5:	f6 c6 08             	test   $0x8,%dh
+  8035e8:	75 0c                	jne    8035f6 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8035ea:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8035f1:	f6 c2 02             	test   $0x2,%dl
+  8035f4:	74 3b                	je     803631 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8035f6:	83 ec 0c             	sub    $0xc,%esp
+  8035f9:	68 05 08 00 00       	push   $0x805
+  8035fe:	57                   	push   %edi
+  8035ff:	ff 75 e4             	push   -0x1c(%ebp)
+  803602:	57                   	push   %edi
+  803603:	6a 00                	push   $0x0
+  803605:	e8 12 d7 ff ff       	call   800d1c <sys_page_map>
+  80360a:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80360c:	83 c4 20             	add    $0x20,%esp
+  80360f:	85 c0                	test   %eax,%eax
+  803611:	0f 88 a7 00 00 00    	js     8036be <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803617:	83 ec 0c             	sub    $0xc,%esp
+  80361a:	68 05 08 00 00       	push   $0x805
+  80361f:	57                   	push   %edi
+  803620:	6a 00                	push   $0x0
+  803622:	57                   	push   %edi
+  803623:	6a 00                	push   $0x0
+  803625:	e8 f2 d6 ff ff       	call   800d1c <sys_page_map>
+  80362a:	89 c6                	mov    %eax,%esi
+	return r;
+  80362c:	83 c4 20             	add    $0x20,%esp
+  80362f:	eb 21                	jmp    803652 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803631:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803638:	83 ec 0c             	sub    $0xc,%esp
+  80363b:	25 07 0e 00 00       	and    $0xe07,%eax
+  803640:	50                   	push   %eax
+  803641:	57                   	push   %edi
+  803642:	ff 75 e4             	push   -0x1c(%ebp)
+  803645:	57                   	push   %edi
+  803646:	6a 00                	push   $0x0
+  803648:	e8 cf d6 ff ff       	call   800d1c <sys_page_map>
+  80364d:	89 c6                	mov    %eax,%esi
+  80364f:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  803652:	85 f6                	test   %esi,%esi
+  803654:	0f 89 36 ff ff ff    	jns    803590 <fork+0x57>
+  80365a:	eb 62                	jmp    8036be <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80365c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803661:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  803666:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803669:	89 f8                	mov    %edi,%eax
+  80366b:	e8 6f fd ff ff       	call   8033df <copy_page_to>
+  803670:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803672:	85 c0                	test   %eax,%eax
+  803674:	78 48                	js     8036be <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803676:	83 ec 04             	sub    $0x4,%esp
+  803679:	6a 07                	push   $0x7
+  80367b:	68 00 f0 bf ee       	push   $0xeebff000
+  803680:	57                   	push   %edi
+  803681:	e8 4b d6 ff ff       	call   800cd1 <sys_page_alloc>
+  803686:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803688:	83 c4 10             	add    $0x10,%esp
+  80368b:	85 c0                	test   %eax,%eax
+  80368d:	78 2f                	js     8036be <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  80368f:	a1 04 70 80 00       	mov    0x807004,%eax
+  803694:	8b 40 64             	mov    0x64(%eax),%eax
+  803697:	83 ec 08             	sub    $0x8,%esp
+  80369a:	50                   	push   %eax
+  80369b:	57                   	push   %edi
+  80369c:	e8 9b d7 ff ff       	call   800e3c <sys_env_set_pgfault_upcall>
+  8036a1:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8036a3:	83 c4 10             	add    $0x10,%esp
+  8036a6:	85 c0                	test   %eax,%eax
+  8036a8:	78 14                	js     8036be <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8036aa:	83 ec 08             	sub    $0x8,%esp
+  8036ad:	6a 02                	push   $0x2
+  8036af:	57                   	push   %edi
+  8036b0:	e8 f3 d6 ff ff       	call   800da8 <sys_env_set_status>
+  8036b5:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8036b7:	83 c4 10             	add    $0x10,%esp
+  8036ba:	85 c0                	test   %eax,%eax
+  8036bc:	79 11                	jns    8036cf <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8036be:	83 ec 0c             	sub    $0xc,%esp
+  8036c1:	ff 75 e0             	push   -0x20(%ebp)
+  8036c4:	e8 79 d5 ff ff       	call   800c42 <sys_env_destroy>
+	return r;
+  8036c9:	83 c4 10             	add    $0x10,%esp
+  8036cc:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8036cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036d5:	5b                   	pop    %ebx
+  8036d6:	5e                   	pop    %esi
+  8036d7:	5f                   	pop    %edi
+  8036d8:	5d                   	pop    %ebp
+  8036d9:	c3                   	ret
+
+008036da <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8036da:	55                   	push   %ebp
+  8036db:	89 e5                	mov    %esp,%ebp
+  8036dd:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8036e0:	68 03 42 80 00       	push   $0x804203
+  8036e5:	68 bf 00 00 00       	push   $0xbf
+  8036ea:	68 f8 41 80 00       	push   $0x8041f8
+  8036ef:	e8 fc fb ff ff       	call   8032f0 <_panic>
+
+008036f4 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8036f4:	55                   	push   %ebp
+  8036f5:	89 e5                	mov    %esp,%ebp
+  8036f7:	56                   	push   %esi
+  8036f8:	53                   	push   %ebx
+  8036f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8036fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803702:	85 c0                	test   %eax,%eax
+  803704:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803709:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80370c:	83 ec 0c             	sub    $0xc,%esp
+  80370f:	50                   	push   %eax
+  803710:	e8 04 d8 ff ff       	call   800f19 <sys_ipc_recv>
+	if (from_env_store)
+  803715:	83 c4 10             	add    $0x10,%esp
+  803718:	85 f6                	test   %esi,%esi
+  80371a:	74 14                	je     803730 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80371c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803721:	85 c0                	test   %eax,%eax
+  803723:	75 09                	jne    80372e <ipc_recv+0x3a>
+  803725:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  80372b:	8b 52 74             	mov    0x74(%edx),%edx
+  80372e:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803730:	85 db                	test   %ebx,%ebx
+  803732:	74 25                	je     803759 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803734:	85 c0                	test   %eax,%eax
+  803736:	74 0d                	je     803745 <ipc_recv+0x51>
+  803738:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  80373e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803741:	5b                   	pop    %ebx
+  803742:	5e                   	pop    %esi
+  803743:	5d                   	pop    %ebp
+  803744:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803745:	a1 04 70 80 00       	mov    0x807004,%eax
+  80374a:	8b 40 78             	mov    0x78(%eax),%eax
+  80374d:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  80374f:	a1 04 70 80 00       	mov    0x807004,%eax
+  803754:	8b 40 70             	mov    0x70(%eax),%eax
+  803757:	eb e5                	jmp    80373e <ipc_recv+0x4a>
+  803759:	85 c0                	test   %eax,%eax
+  80375b:	75 e1                	jne    80373e <ipc_recv+0x4a>
+  80375d:	eb f0                	jmp    80374f <ipc_recv+0x5b>
+
+0080375f <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80375f:	55                   	push   %ebp
+  803760:	89 e5                	mov    %esp,%ebp
+  803762:	57                   	push   %edi
+  803763:	56                   	push   %esi
+  803764:	53                   	push   %ebx
+  803765:	83 ec 0c             	sub    $0xc,%esp
+  803768:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80376b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80376e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803771:	85 db                	test   %ebx,%ebx
+  803773:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803778:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80377b:	ff 75 14             	push   0x14(%ebp)
+  80377e:	53                   	push   %ebx
+  80377f:	56                   	push   %esi
+  803780:	57                   	push   %edi
+  803781:	e8 00 d7 ff ff       	call   800e86 <sys_ipc_try_send>
+  803786:	83 c4 10             	add    $0x10,%esp
+  803789:	85 c0                	test   %eax,%eax
+  80378b:	74 22                	je     8037af <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  80378d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803790:	75 07                	jne    803799 <ipc_send+0x3a>
+		sys_yield();
+  803792:	e8 1b d5 ff ff       	call   800cb2 <sys_yield>
+  803797:	eb e2                	jmp    80377b <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803799:	68 19 42 80 00       	push   $0x804219
+  80379e:	68 a0 40 80 00       	push   $0x8040a0
+  8037a3:	6a 39                	push   $0x39
+  8037a5:	68 2e 42 80 00       	push   $0x80422e
+  8037aa:	e8 41 fb ff ff       	call   8032f0 <_panic>
+	}
+}
+  8037af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037b2:	5b                   	pop    %ebx
+  8037b3:	5e                   	pop    %esi
+  8037b4:	5f                   	pop    %edi
+  8037b5:	5d                   	pop    %ebp
+  8037b6:	c3                   	ret
+
+008037b7 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  8037b7:	55                   	push   %ebp
+  8037b8:	89 e5                	mov    %esp,%ebp
+  8037ba:	57                   	push   %edi
+  8037bb:	56                   	push   %esi
+  8037bc:	53                   	push   %ebx
+  8037bd:	83 ec 10             	sub    $0x10,%esp
+  8037c0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8037c9:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8037cc:	85 c0                	test   %eax,%eax
+  8037ce:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8037d3:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8037d6:	6a 00                	push   $0x0
+  8037d8:	ff 33                	push   (%ebx)
+  8037da:	50                   	push   %eax
+  8037db:	e8 f6 d6 ff ff       	call   800ed6 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8037e0:	83 c4 10             	add    $0x10,%esp
+  8037e3:	85 c0                	test   %eax,%eax
+  8037e5:	75 3c                	jne    803823 <ipc_recvv+0x6c>
+  8037e7:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  8037ed:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8037f0:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8037f2:	85 ff                	test   %edi,%edi
+  8037f4:	74 4e                	je     803844 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8037f6:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  8037fc:	8b 52 74             	mov    0x74(%edx),%edx
+  8037ff:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803801:	85 f6                	test   %esi,%esi
+  803803:	74 18                	je     80381d <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803805:	85 c0                	test   %eax,%eax
+  803807:	75 2d                	jne    803836 <ipc_recvv+0x7f>
+  803809:	a1 04 70 80 00       	mov    0x807004,%eax
+  80380e:	8b 40 78             	mov    0x78(%eax),%eax
+  803811:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803813:	a1 04 70 80 00       	mov    0x807004,%eax
+  803818:	8b 40 70             	mov    0x70(%eax),%eax
+  80381b:	eb 1f                	jmp    80383c <ipc_recvv+0x85>
+  80381d:	85 c0                	test   %eax,%eax
+  80381f:	75 1b                	jne    80383c <ipc_recvv+0x85>
+  803821:	eb f0                	jmp    803813 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803823:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803829:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  80382e:	85 ff                	test   %edi,%edi
+  803830:	75 cd                	jne    8037ff <ipc_recvv+0x48>
+	if (perm_store)
+  803832:	85 f6                	test   %esi,%esi
+  803834:	74 e7                	je     80381d <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803836:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80383c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80383f:	5b                   	pop    %ebx
+  803840:	5e                   	pop    %esi
+  803841:	5f                   	pop    %edi
+  803842:	5d                   	pop    %ebp
+  803843:	c3                   	ret
+	if (perm_store)
+  803844:	85 f6                	test   %esi,%esi
+  803846:	75 bd                	jne    803805 <ipc_recvv+0x4e>
+  803848:	eb c9                	jmp    803813 <ipc_recvv+0x5c>
+
+0080384a <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  80384a:	55                   	push   %ebp
+  80384b:	89 e5                	mov    %esp,%ebp
+  80384d:	57                   	push   %edi
+  80384e:	56                   	push   %esi
+  80384f:	53                   	push   %ebx
+  803850:	83 ec 0c             	sub    $0xc,%esp
+  803853:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803856:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803859:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  80385c:	ff 75 14             	push   0x14(%ebp)
+  80385f:	53                   	push   %ebx
+  803860:	56                   	push   %esi
+  803861:	57                   	push   %edi
+  803862:	e8 47 d6 ff ff       	call   800eae <sys_ipc_try_sendv>
+  803867:	83 c4 10             	add    $0x10,%esp
+  80386a:	85 c0                	test   %eax,%eax
+  80386c:	74 22                	je     803890 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  80386e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803871:	75 07                	jne    80387a <ipc_sendv+0x30>
+		sys_yield();
+  803873:	e8 3a d4 ff ff       	call   800cb2 <sys_yield>
+  803878:	eb e2                	jmp    80385c <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80387a:	68 19 42 80 00       	push   $0x804219
+  80387f:	68 a0 40 80 00       	push   $0x8040a0
+  803884:	6a 5c                	push   $0x5c
+  803886:	68 2e 42 80 00       	push   $0x80422e
+  80388b:	e8 60 fa ff ff       	call   8032f0 <_panic>
+	}
+}
+  803890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803893:	5b                   	pop    %ebx
+  803894:	5e                   	pop    %esi
+  803895:	5f                   	pop    %edi
+  803896:	5d                   	pop    %ebp
+  803897:	c3                   	ret
+
+00803898 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803898:	55                   	push   %ebp
+  803899:	89 e5                	mov    %esp,%ebp
+  80389b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80389e:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8038a3:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8038a9:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8038af:	8b 52 50             	mov    0x50(%edx),%edx
+  8038b2:	39 ca                	cmp    %ecx,%edx
+  8038b4:	74 11                	je     8038c7 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8038b6:	83 c0 01             	add    $0x1,%eax
+  8038b9:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8038be:	75 e3                	jne    8038a3 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8038c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c5:	eb 0e                	jmp    8038d5 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8038c7:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8038cd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038d2:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8038d5:	5d                   	pop    %ebp
+  8038d6:	c3                   	ret
+
+008038d7 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8038d7:	55                   	push   %ebp
+  8038d8:	89 e5                	mov    %esp,%ebp
+  8038da:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8038dd:	89 c2                	mov    %eax,%edx
+  8038df:	c1 ea 16             	shr    $0x16,%edx
+  8038e2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8038e9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8038ee:	f6 c1 01             	test   $0x1,%cl
+  8038f1:	74 22                	je     803915 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8038f3:	c1 e8 0c             	shr    $0xc,%eax
+  8038f6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8038fd:	a8 01                	test   $0x1,%al
+  8038ff:	74 14                	je     803915 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803901:	c1 e8 0c             	shr    $0xc,%eax
+  803904:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803907:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80390e:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803912:	0f b7 d2             	movzwl %dx,%edx
+}
+  803915:	89 d0                	mov    %edx,%eax
+  803917:	5d                   	pop    %ebp
+  803918:	c3                   	ret
+
+00803919 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803919:	55                   	push   %ebp
+  80391a:	89 e5                	mov    %esp,%ebp
+  80391c:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  80391f:	83 3d 08 b0 80 00 00 	cmpl   $0x0,0x80b008
+  803926:	74 0a                	je     803932 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803928:	8b 45 08             	mov    0x8(%ebp),%eax
+  80392b:	a3 08 b0 80 00       	mov    %eax,0x80b008
+}
+  803930:	c9                   	leave
+  803931:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803932:	83 ec 04             	sub    $0x4,%esp
+  803935:	6a 07                	push   $0x7
+  803937:	68 00 f0 bf ee       	push   $0xeebff000
+  80393c:	6a 00                	push   $0x0
+  80393e:	e8 8e d3 ff ff       	call   800cd1 <sys_page_alloc>
+  803943:	83 c4 10             	add    $0x10,%esp
+  803946:	85 c0                	test   %eax,%eax
+  803948:	75 2c                	jne    803976 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80394a:	83 ec 08             	sub    $0x8,%esp
+  80394d:	68 8c 39 80 00       	push   $0x80398c
+  803952:	6a 00                	push   $0x0
+  803954:	e8 e3 d4 ff ff       	call   800e3c <sys_env_set_pgfault_upcall>
+  803959:	83 c4 10             	add    $0x10,%esp
+  80395c:	85 c0                	test   %eax,%eax
+  80395e:	74 c8                	je     803928 <set_pgfault_handler+0xf>
+  803960:	68 80 42 80 00       	push   $0x804280
+  803965:	68 a0 40 80 00       	push   $0x8040a0
+  80396a:	6a 20                	push   $0x20
+  80396c:	68 b0 42 80 00       	push   $0x8042b0
+  803971:	e8 7a f9 ff ff       	call   8032f0 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803976:	68 38 42 80 00       	push   $0x804238
+  80397b:	68 a0 40 80 00       	push   $0x8040a0
+  803980:	6a 1e                	push   $0x1e
+  803982:	68 b0 42 80 00       	push   $0x8042b0
+  803987:	e8 64 f9 ff ff       	call   8032f0 <_panic>
+
+0080398c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80398c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80398d:	a1 08 b0 80 00       	mov    0x80b008,%eax
+	call *%eax
+  803992:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803994:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803997:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  80399c:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8039a1:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8039a5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8039a8:	83 c4 08             	add    $0x8,%esp
+	popal
+  8039ab:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8039ac:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8039af:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8039b0:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8039b1:	c3                   	ret
+
+008039b2 <dm>:
+  8039b2:	55                   	push   %ebp
+  8039b3:	57                   	push   %edi
+  8039b4:	56                   	push   %esi
+  8039b5:	53                   	push   %ebx
+  8039b6:	83 ec 24             	sub    $0x24,%esp
+  8039b9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8039bd:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8039c1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8039c5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8039c9:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8039cd:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8039d1:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8039d5:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8039da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039e4:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8039eb:	00 
+  8039ec:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8039f3:	00 
+  8039f4:	89 fb                	mov    %edi,%ebx
+  8039f6:	eb 08                	jmp    803a00 <dm+0x4e>
+  8039f8:	83 e9 01             	sub    $0x1,%ecx
+  8039fb:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8039fe:	74 68                	je     803a68 <dm+0xb6>
+  803a00:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803a04:	01 c0                	add    %eax,%eax
+  803a06:	89 c6                	mov    %eax,%esi
+  803a08:	89 d7                	mov    %edx,%edi
+  803a0a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a0e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a12:	0f ad d0             	shrd   %cl,%edx,%eax
+  803a15:	d3 ea                	shr    %cl,%edx
+  803a17:	f6 c1 20             	test   $0x20,%cl
+  803a1a:	74 04                	je     803a20 <dm+0x6e>
+  803a1c:	89 d0                	mov    %edx,%eax
+  803a1e:	31 d2                	xor    %edx,%edx
+  803a20:	83 e0 01             	and    $0x1,%eax
+  803a23:	89 04 24             	mov    %eax,(%esp)
+  803a26:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803a2d:	00 
+  803a2e:	8b 04 24             	mov    (%esp),%eax
+  803a31:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803a35:	09 f0                	or     %esi,%eax
+  803a37:	09 fa                	or     %edi,%edx
+  803a39:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803a3d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803a41:	39 f0                	cmp    %esi,%eax
+  803a43:	89 d5                	mov    %edx,%ebp
+  803a45:	19 fd                	sbb    %edi,%ebp
+  803a47:	72 af                	jb     8039f8 <dm+0x46>
+  803a49:	29 f0                	sub    %esi,%eax
+  803a4b:	19 fa                	sbb    %edi,%edx
+  803a4d:	89 cf                	mov    %ecx,%edi
+  803a4f:	c1 ef 05             	shr    $0x5,%edi
+  803a52:	83 e7 01             	and    $0x1,%edi
+  803a55:	89 fe                	mov    %edi,%esi
+  803a57:	83 f6 01             	xor    $0x1,%esi
+  803a5a:	d3 e6                	shl    %cl,%esi
+  803a5c:	d3 e7                	shl    %cl,%edi
+  803a5e:	09 74 24 18          	or     %esi,0x18(%esp)
+  803a62:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803a66:	eb 90                	jmp    8039f8 <dm+0x46>
+  803a68:	85 db                	test   %ebx,%ebx
+  803a6a:	74 05                	je     803a71 <dm+0xbf>
+  803a6c:	89 03                	mov    %eax,(%ebx)
+  803a6e:	89 53 04             	mov    %edx,0x4(%ebx)
+  803a71:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a75:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a79:	83 c4 24             	add    $0x24,%esp
+  803a7c:	5b                   	pop    %ebx
+  803a7d:	5e                   	pop    %esi
+  803a7e:	5f                   	pop    %edi
+  803a7f:	5d                   	pop    %ebp
+  803a80:	c3                   	ret
+
+00803a81 <__udivdi3>:
+  803a81:	83 ec 08             	sub    $0x8,%esp
+  803a84:	6a 00                	push   $0x0
+  803a86:	ff 74 24 1c          	push   0x1c(%esp)
+  803a8a:	ff 74 24 1c          	push   0x1c(%esp)
+  803a8e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a92:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a96:	e8 17 ff ff ff       	call   8039b2 <dm>
+  803a9b:	83 c4 14             	add    $0x14,%esp
+  803a9e:	c3                   	ret
+
+00803a9f <__umoddi3>:
+  803a9f:	83 ec 18             	sub    $0x18,%esp
+  803aa2:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803aa6:	50                   	push   %eax
+  803aa7:	ff 74 24 2c          	push   0x2c(%esp)
+  803aab:	ff 74 24 2c          	push   0x2c(%esp)
+  803aaf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803ab3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803ab7:	e8 f6 fe ff ff       	call   8039b2 <dm>
+  803abc:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803ac0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ac4:	83 c4 24             	add    $0x24,%esp
+  803ac7:	c3                   	ret
+
+00803ac8 <__divdi3>:
+  803ac8:	53                   	push   %ebx
+  803ac9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803acd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803ad1:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803ad5:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803ad9:	85 d2                	test   %edx,%edx
+  803adb:	78 15                	js     803af2 <__divdi3+0x2a>
+  803add:	85 db                	test   %ebx,%ebx
+  803adf:	78 34                	js     803b15 <__divdi3+0x4d>
+  803ae1:	83 ec 04             	sub    $0x4,%esp
+  803ae4:	6a 00                	push   $0x0
+  803ae6:	53                   	push   %ebx
+  803ae7:	51                   	push   %ecx
+  803ae8:	e8 c5 fe ff ff       	call   8039b2 <dm>
+  803aed:	83 c4 10             	add    $0x10,%esp
+  803af0:	eb 21                	jmp    803b13 <__divdi3+0x4b>
+  803af2:	f7 d8                	neg    %eax
+  803af4:	83 d2 00             	adc    $0x0,%edx
+  803af7:	f7 da                	neg    %edx
+  803af9:	85 db                	test   %ebx,%ebx
+  803afb:	78 30                	js     803b2d <__divdi3+0x65>
+  803afd:	83 ec 04             	sub    $0x4,%esp
+  803b00:	6a 00                	push   $0x0
+  803b02:	53                   	push   %ebx
+  803b03:	51                   	push   %ecx
+  803b04:	e8 a9 fe ff ff       	call   8039b2 <dm>
+  803b09:	83 c4 10             	add    $0x10,%esp
+  803b0c:	f7 d8                	neg    %eax
+  803b0e:	83 d2 00             	adc    $0x0,%edx
+  803b11:	f7 da                	neg    %edx
+  803b13:	5b                   	pop    %ebx
+  803b14:	c3                   	ret
+  803b15:	83 ec 04             	sub    $0x4,%esp
+  803b18:	6a 00                	push   $0x0
+  803b1a:	f7 d9                	neg    %ecx
+  803b1c:	83 d3 00             	adc    $0x0,%ebx
+  803b1f:	f7 db                	neg    %ebx
+  803b21:	53                   	push   %ebx
+  803b22:	51                   	push   %ecx
+  803b23:	e8 8a fe ff ff       	call   8039b2 <dm>
+  803b28:	83 c4 10             	add    $0x10,%esp
+  803b2b:	eb df                	jmp    803b0c <__divdi3+0x44>
+  803b2d:	83 ec 04             	sub    $0x4,%esp
+  803b30:	6a 00                	push   $0x0
+  803b32:	f7 d9                	neg    %ecx
+  803b34:	83 d3 00             	adc    $0x0,%ebx
+  803b37:	f7 db                	neg    %ebx
+  803b39:	53                   	push   %ebx
+  803b3a:	51                   	push   %ecx
+  803b3b:	e8 72 fe ff ff       	call   8039b2 <dm>
+  803b40:	83 c4 10             	add    $0x10,%esp
+  803b43:	eb ce                	jmp    803b13 <__divdi3+0x4b>
+
+00803b45 <__moddi3>:
+  803b45:	55                   	push   %ebp
+  803b46:	57                   	push   %edi
+  803b47:	56                   	push   %esi
+  803b48:	53                   	push   %ebx
+  803b49:	83 ec 24             	sub    $0x24,%esp
+  803b4c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803b50:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803b54:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803b58:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803b5c:	85 d2                	test   %edx,%edx
+  803b5e:	78 3b                	js     803b9b <__moddi3+0x56>
+  803b60:	83 ec 04             	sub    $0x4,%esp
+  803b63:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803b67:	56                   	push   %esi
+  803b68:	89 ce                	mov    %ecx,%esi
+  803b6a:	f7 de                	neg    %esi
+  803b6c:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803b70:	89 de                	mov    %ebx,%esi
+  803b72:	83 d6 00             	adc    $0x0,%esi
+  803b75:	f7 de                	neg    %esi
+  803b77:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803b7b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803b7f:	0f 48 f1             	cmovs  %ecx,%esi
+  803b82:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803b87:	53                   	push   %ebx
+  803b88:	56                   	push   %esi
+  803b89:	e8 24 fe ff ff       	call   8039b2 <dm>
+  803b8e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803b92:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803b96:	83 c4 10             	add    $0x10,%esp
+  803b99:	eb 47                	jmp    803be2 <__moddi3+0x9d>
+  803b9b:	f7 d8                	neg    %eax
+  803b9d:	83 d2 00             	adc    $0x0,%edx
+  803ba0:	f7 da                	neg    %edx
+  803ba2:	83 ec 04             	sub    $0x4,%esp
+  803ba5:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803ba9:	56                   	push   %esi
+  803baa:	89 cf                	mov    %ecx,%edi
+  803bac:	f7 df                	neg    %edi
+  803bae:	89 de                	mov    %ebx,%esi
+  803bb0:	83 d6 00             	adc    $0x0,%esi
+  803bb3:	f7 de                	neg    %esi
+  803bb5:	0f 49 cf             	cmovns %edi,%ecx
+  803bb8:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803bbc:	0f 49 de             	cmovns %esi,%ebx
+  803bbf:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803bc3:	ff 74 24 0c          	push   0xc(%esp)
+  803bc7:	ff 74 24 0c          	push   0xc(%esp)
+  803bcb:	e8 e2 fd ff ff       	call   8039b2 <dm>
+  803bd0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803bd4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803bd8:	f7 d8                	neg    %eax
+  803bda:	83 d2 00             	adc    $0x0,%edx
+  803bdd:	f7 da                	neg    %edx
+  803bdf:	83 c4 10             	add    $0x10,%esp
+  803be2:	83 c4 24             	add    $0x24,%esp
+  803be5:	5b                   	pop    %ebx
+  803be6:	5e                   	pop    %esi
+  803be7:	5f                   	pop    %edi
+  803be8:	5d                   	pop    %ebp
+  803be9:	c3                   	ret
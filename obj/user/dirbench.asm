@@ -0,0 +1,8310 @@
+
+obj/user/dirbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 09 03 00 00       	call   80033a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	snprintf(buf, MAXPATHLEN, "%s/bench%05d", dir, i);
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec c0 04 00 00    	sub    $0x4c0,%esp
+  80003f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	char path[MAXPATHLEN];
+	struct Stat st;
+	struct Argstate args;
+
+	n = 10000;
+	argstart(&argc, argv, &args);
+  800042:	8d 85 4c fb ff ff    	lea    -0x4b4(%ebp),%eax
+  800048:	50                   	push   %eax
+  800049:	56                   	push   %esi
+  80004a:	8d 45 08             	lea    0x8(%ebp),%eax
+  80004d:	50                   	push   %eax
+  80004e:	e8 20 12 00 00       	call   801273 <argstart>
+	while ((i = argnext(&args)) >= 0)
+  800053:	83 c4 10             	add    $0x10,%esp
+	n = 10000;
+  800056:	bb 10 27 00 00       	mov    $0x2710,%ebx
+	while ((i = argnext(&args)) >= 0)
+  80005b:	8d bd 4c fb ff ff    	lea    -0x4b4(%ebp),%edi
+  800061:	eb 1b                	jmp    80007e <umain+0x4b>
+		switch (i) {
+		case 'n':
+			n = strtol(argnextvalue(&args), 0, 0);
+  800063:	83 ec 0c             	sub    $0xc,%esp
+  800066:	57                   	push   %edi
+  800067:	e8 ca 12 00 00       	call   801336 <argnextvalue>
+  80006c:	83 c4 0c             	add    $0xc,%esp
+  80006f:	6a 00                	push   $0x0
+  800071:	6a 00                	push   $0x0
+  800073:	50                   	push   %eax
+  800074:	e8 41 0c 00 00       	call   800cba <strtol>
+  800079:	89 c3                	mov    %eax,%ebx
+			break;
+  80007b:	83 c4 10             	add    $0x10,%esp
+	while ((i = argnext(&args)) >= 0)
+  80007e:	83 ec 0c             	sub    $0xc,%esp
+  800081:	57                   	push   %edi
+  800082:	e8 1c 12 00 00       	call   8012a3 <argnext>
+  800087:	83 c4 10             	add    $0x10,%esp
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	78 1c                	js     8000aa <umain+0x77>
+		switch (i) {
+  80008e:	83 f8 6e             	cmp    $0x6e,%eax
+  800091:	74 d0                	je     800063 <umain+0x30>
+	printf("usage: dirbench [-n nfiles] [dir]\n");
+  800093:	83 ec 0c             	sub    $0xc,%esp
+  800096:	68 64 3d 80 00       	push   $0x803d64
+  80009b:	e8 b5 2a 00 00       	call   802b55 <printf>
+	exit();
+  8000a0:	e8 de 02 00 00       	call   800383 <exit>
+}
+  8000a5:	83 c4 10             	add    $0x10,%esp
+  8000a8:	eb d4                	jmp    80007e <umain+0x4b>
+		default:
+			usage();
+		}
+	if (argc > 2)
+  8000aa:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  8000ae:	7f 6e                	jg     80011e <umain+0xeb>
+		usage();
+	dir = argc == 2 ? argv[1] : "";
+  8000b0:	c7 85 44 fb ff ff 88 	movl   $0x804288,-0x4bc(%ebp)
+  8000b7:	42 80 00 
+  8000ba:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  8000be:	74 78                	je     800138 <umain+0x105>
+
+	start = sys_time_msec();
+  8000c0:	e8 4c 10 00 00       	call   801111 <sys_time_msec>
+  8000c5:	89 85 40 fb ff ff    	mov    %eax,-0x4c0(%ebp)
+	for (i = 0; i < n; i++) {
+  8000cb:	be 00 00 00 00       	mov    $0x0,%esi
+	snprintf(buf, MAXPATHLEN, "%s/bench%05d", dir, i);
+  8000d0:	8d bd e8 fb ff ff    	lea    -0x418(%ebp),%edi
+	for (i = 0; i < n; i++) {
+  8000d6:	39 de                	cmp    %ebx,%esi
+  8000d8:	0f 8d 84 00 00 00    	jge    800162 <umain+0x12f>
+	snprintf(buf, MAXPATHLEN, "%s/bench%05d", dir, i);
+  8000de:	83 ec 0c             	sub    $0xc,%esp
+  8000e1:	56                   	push   %esi
+  8000e2:	ff b5 44 fb ff ff    	push   -0x4bc(%ebp)
+  8000e8:	68 a0 3c 80 00       	push   $0x803ca0
+  8000ed:	68 00 04 00 00       	push   $0x400
+  8000f2:	57                   	push   %edi
+  8000f3:	e8 19 09 00 00       	call   800a11 <snprintf>
+		name(path, dir, i);
+		if ((fd = open(path, O_WRONLY | O_CREAT | O_EXCL)) < 0)
+  8000f8:	83 c4 18             	add    $0x18,%esp
+  8000fb:	68 01 05 00 00       	push   $0x501
+  800100:	57                   	push   %edi
+  800101:	e8 55 20 00 00       	call   80215b <open>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	85 c0                	test   %eax,%eax
+  80010b:	78 39                	js     800146 <umain+0x113>
+			panic("create %s: %e", path, fd);
+		close(fd);
+  80010d:	83 ec 0c             	sub    $0xc,%esp
+  800110:	50                   	push   %eax
+  800111:	e8 53 14 00 00       	call   801569 <close>
+	for (i = 0; i < n; i++) {
+  800116:	83 c6 01             	add    $0x1,%esi
+  800119:	83 c4 10             	add    $0x10,%esp
+  80011c:	eb b8                	jmp    8000d6 <umain+0xa3>
+	printf("usage: dirbench [-n nfiles] [dir]\n");
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	68 64 3d 80 00       	push   $0x803d64
+  800126:	e8 2a 2a 00 00       	call   802b55 <printf>
+	exit();
+  80012b:	e8 53 02 00 00       	call   800383 <exit>
+}
+  800130:	83 c4 10             	add    $0x10,%esp
+  800133:	e9 78 ff ff ff       	jmp    8000b0 <umain+0x7d>
+	dir = argc == 2 ? argv[1] : "";
+  800138:	8b 46 04             	mov    0x4(%esi),%eax
+  80013b:	89 85 44 fb ff ff    	mov    %eax,-0x4bc(%ebp)
+  800141:	e9 7a ff ff ff       	jmp    8000c0 <umain+0x8d>
+			panic("create %s: %e", path, fd);
+  800146:	83 ec 0c             	sub    $0xc,%esp
+  800149:	50                   	push   %eax
+  80014a:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  800150:	50                   	push   %eax
+  800151:	68 ad 3c 80 00       	push   $0x803cad
+  800156:	6a 2f                	push   $0x2f
+  800158:	68 bb 3c 80 00       	push   $0x803cbb
+  80015d:	e8 3b 02 00 00       	call   80039d <_panic>
+	}
+	end = sys_time_msec();
+  800162:	e8 aa 0f 00 00       	call   801111 <sys_time_msec>
+	printf("created %d files in %u ms\n", n, end - start);
+  800167:	83 ec 04             	sub    $0x4,%esp
+  80016a:	8b 8d 40 fb ff ff    	mov    -0x4c0(%ebp),%ecx
+  800170:	29 c8                	sub    %ecx,%eax
+  800172:	50                   	push   %eax
+  800173:	53                   	push   %ebx
+  800174:	68 cb 3c 80 00       	push   $0x803ccb
+  800179:	e8 d7 29 00 00       	call   802b55 <printf>
+
+	start = sys_time_msec();
+  80017e:	e8 8e 0f 00 00       	call   801111 <sys_time_msec>
+  800183:	89 85 40 fb ff ff    	mov    %eax,-0x4c0(%ebp)
+	for (i = 0; i < n; i++) {
+  800189:	83 c4 10             	add    $0x10,%esp
+  80018c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800191:	be 00 00 00 00       	mov    $0x0,%esi
+  800196:	39 de                	cmp    %ebx,%esi
+  800198:	7d 69                	jge    800203 <umain+0x1d0>
+	snprintf(buf, MAXPATHLEN, "%s/bench%05d", dir, i);
+  80019a:	83 ec 0c             	sub    $0xc,%esp
+		name(path, dir, (i * 7919) % n);
+  80019d:	89 f8                	mov    %edi,%eax
+  80019f:	99                   	cltd
+  8001a0:	f7 fb                	idiv   %ebx
+	snprintf(buf, MAXPATHLEN, "%s/bench%05d", dir, i);
+  8001a2:	52                   	push   %edx
+  8001a3:	ff b5 44 fb ff ff    	push   -0x4bc(%ebp)
+  8001a9:	68 a0 3c 80 00       	push   $0x803ca0
+  8001ae:	68 00 04 00 00       	push   $0x400
+  8001b3:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  8001b9:	50                   	push   %eax
+  8001ba:	e8 52 08 00 00       	call   800a11 <snprintf>
+		if ((r = stat(path, &st)) < 0)
+  8001bf:	83 c4 18             	add    $0x18,%esp
+  8001c2:	8d 85 5c fb ff ff    	lea    -0x4a4(%ebp),%eax
+  8001c8:	50                   	push   %eax
+  8001c9:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  8001cf:	50                   	push   %eax
+  8001d0:	e8 be 17 00 00       	call   801993 <stat>
+  8001d5:	81 c7 ef 1e 00 00    	add    $0x1eef,%edi
+  8001db:	83 c4 10             	add    $0x10,%esp
+  8001de:	85 c0                	test   %eax,%eax
+  8001e0:	78 05                	js     8001e7 <umain+0x1b4>
+	for (i = 0; i < n; i++) {
+  8001e2:	83 c6 01             	add    $0x1,%esi
+  8001e5:	eb af                	jmp    800196 <umain+0x163>
+			panic("stat %s: %e", path, r);
+  8001e7:	83 ec 0c             	sub    $0xc,%esp
+  8001ea:	50                   	push   %eax
+  8001eb:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  8001f1:	50                   	push   %eax
+  8001f2:	68 e6 3c 80 00       	push   $0x803ce6
+  8001f7:	6a 39                	push   $0x39
+  8001f9:	68 bb 3c 80 00       	push   $0x803cbb
+  8001fe:	e8 9a 01 00 00       	call   80039d <_panic>
+	}
+	end = sys_time_msec();
+  800203:	e8 09 0f 00 00       	call   801111 <sys_time_msec>
+	printf("looked up %d files in %u ms\n", n, end - start);
+  800208:	83 ec 04             	sub    $0x4,%esp
+  80020b:	8b 8d 40 fb ff ff    	mov    -0x4c0(%ebp),%ecx
+  800211:	29 c8                	sub    %ecx,%eax
+  800213:	50                   	push   %eax
+  800214:	53                   	push   %ebx
+  800215:	68 f2 3c 80 00       	push   $0x803cf2
+  80021a:	e8 36 29 00 00       	call   802b55 <printf>
+
+	start = sys_time_msec();
+  80021f:	e8 ed 0e 00 00       	call   801111 <sys_time_msec>
+  800224:	89 85 40 fb ff ff    	mov    %eax,-0x4c0(%ebp)
+	for (i = 0; i < n; i++) {
+  80022a:	83 c4 10             	add    $0x10,%esp
+  80022d:	be 00 00 00 00       	mov    $0x0,%esi
+		snprintf(path, sizeof path, "%s/missing%05d", dir, i);
+  800232:	8d bd e8 fb ff ff    	lea    -0x418(%ebp),%edi
+	for (i = 0; i < n; i++) {
+  800238:	39 de                	cmp    %ebx,%esi
+  80023a:	7d 53                	jge    80028f <umain+0x25c>
+		snprintf(path, sizeof path, "%s/missing%05d", dir, i);
+  80023c:	83 ec 0c             	sub    $0xc,%esp
+  80023f:	56                   	push   %esi
+  800240:	ff b5 44 fb ff ff    	push   -0x4bc(%ebp)
+  800246:	68 0f 3d 80 00       	push   $0x803d0f
+  80024b:	68 00 04 00 00       	push   $0x400
+  800250:	57                   	push   %edi
+  800251:	e8 bb 07 00 00       	call   800a11 <snprintf>
+		if ((r = stat(path, &st)) != -E_NOT_FOUND)
+  800256:	83 c4 18             	add    $0x18,%esp
+  800259:	8d 85 5c fb ff ff    	lea    -0x4a4(%ebp),%eax
+  80025f:	50                   	push   %eax
+  800260:	57                   	push   %edi
+  800261:	e8 2d 17 00 00       	call   801993 <stat>
+  800266:	83 c4 10             	add    $0x10,%esp
+  800269:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80026c:	75 05                	jne    800273 <umain+0x240>
+	for (i = 0; i < n; i++) {
+  80026e:	83 c6 01             	add    $0x1,%esi
+  800271:	eb c5                	jmp    800238 <umain+0x205>
+			panic("stat %s: got %e, wanted not found", path, r);
+  800273:	83 ec 0c             	sub    $0xc,%esp
+  800276:	50                   	push   %eax
+  800277:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  80027d:	50                   	push   %eax
+  80027e:	68 88 3d 80 00       	push   $0x803d88
+  800283:	6a 42                	push   $0x42
+  800285:	68 bb 3c 80 00       	push   $0x803cbb
+  80028a:	e8 0e 01 00 00       	call   80039d <_panic>
+	}
+	end = sys_time_msec();
+  80028f:	e8 7d 0e 00 00       	call   801111 <sys_time_msec>
+	printf("missed %d lookups in %u ms\n", n, end - start);
+  800294:	83 ec 04             	sub    $0x4,%esp
+  800297:	8b 8d 40 fb ff ff    	mov    -0x4c0(%ebp),%ecx
+  80029d:	29 c8                	sub    %ecx,%eax
+  80029f:	50                   	push   %eax
+  8002a0:	53                   	push   %ebx
+  8002a1:	68 1e 3d 80 00       	push   $0x803d1e
+  8002a6:	e8 aa 28 00 00       	call   802b55 <printf>
+
+	start = sys_time_msec();
+  8002ab:	e8 61 0e 00 00       	call   801111 <sys_time_msec>
+  8002b0:	89 85 40 fb ff ff    	mov    %eax,-0x4c0(%ebp)
+	for (i = 0; i < n; i++) {
+  8002b6:	83 c4 10             	add    $0x10,%esp
+  8002b9:	be 00 00 00 00       	mov    $0x0,%esi
+	snprintf(buf, MAXPATHLEN, "%s/bench%05d", dir, i);
+  8002be:	8d bd e8 fb ff ff    	lea    -0x418(%ebp),%edi
+	for (i = 0; i < n; i++) {
+  8002c4:	39 de                	cmp    %ebx,%esi
+  8002c6:	7d 4b                	jge    800313 <umain+0x2e0>
+	snprintf(buf, MAXPATHLEN, "%s/bench%05d", dir, i);
+  8002c8:	83 ec 0c             	sub    $0xc,%esp
+  8002cb:	56                   	push   %esi
+  8002cc:	ff b5 44 fb ff ff    	push   -0x4bc(%ebp)
+  8002d2:	68 a0 3c 80 00       	push   $0x803ca0
+  8002d7:	68 00 04 00 00       	push   $0x400
+  8002dc:	57                   	push   %edi
+  8002dd:	e8 2f 07 00 00       	call   800a11 <snprintf>
+		name(path, dir, i);
+		if ((r = remove(path)) < 0)
+  8002e2:	83 c4 14             	add    $0x14,%esp
+  8002e5:	57                   	push   %edi
+  8002e6:	e8 44 26 00 00       	call   80292f <remove>
+  8002eb:	83 c4 10             	add    $0x10,%esp
+  8002ee:	85 c0                	test   %eax,%eax
+  8002f0:	78 05                	js     8002f7 <umain+0x2c4>
+	for (i = 0; i < n; i++) {
+  8002f2:	83 c6 01             	add    $0x1,%esi
+  8002f5:	eb cd                	jmp    8002c4 <umain+0x291>
+			panic("remove %s: %e", path, r);
+  8002f7:	83 ec 0c             	sub    $0xc,%esp
+  8002fa:	50                   	push   %eax
+  8002fb:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  800301:	50                   	push   %eax
+  800302:	68 3a 3d 80 00       	push   $0x803d3a
+  800307:	6a 4b                	push   $0x4b
+  800309:	68 bb 3c 80 00       	push   $0x803cbb
+  80030e:	e8 8a 00 00 00       	call   80039d <_panic>
+	}
+	end = sys_time_msec();
+  800313:	e8 f9 0d 00 00       	call   801111 <sys_time_msec>
+	printf("removed %d files in %u ms\n", n, end - start);
+  800318:	83 ec 04             	sub    $0x4,%esp
+  80031b:	8b 8d 40 fb ff ff    	mov    -0x4c0(%ebp),%ecx
+  800321:	29 c8                	sub    %ecx,%eax
+  800323:	50                   	push   %eax
+  800324:	53                   	push   %ebx
+  800325:	68 48 3d 80 00       	push   $0x803d48
+  80032a:	e8 26 28 00 00       	call   802b55 <printf>
+}
+  80032f:	83 c4 10             	add    $0x10,%esp
+  800332:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800335:	5b                   	pop    %ebx
+  800336:	5e                   	pop    %esi
+  800337:	5f                   	pop    %edi
+  800338:	5d                   	pop    %ebp
+  800339:	c3                   	ret
+
+0080033a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80033a:	55                   	push   %ebp
+  80033b:	89 e5                	mov    %esp,%ebp
+  80033d:	56                   	push   %esi
+  80033e:	53                   	push   %ebx
+  80033f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800342:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800345:	e8 e2 0a 00 00       	call   800e2c <sys_getenvid>
+  80034a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80034f:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800355:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80035a:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80035f:	85 db                	test   %ebx,%ebx
+  800361:	7e 07                	jle    80036a <libmain+0x30>
+		binaryname = argv[0];
+  800363:	8b 06                	mov    (%esi),%eax
+  800365:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80036a:	83 ec 08             	sub    $0x8,%esp
+  80036d:	56                   	push   %esi
+  80036e:	53                   	push   %ebx
+  80036f:	e8 bf fc ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800374:	e8 0a 00 00 00       	call   800383 <exit>
+}
+  800379:	83 c4 10             	add    $0x10,%esp
+  80037c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80037f:	5b                   	pop    %ebx
+  800380:	5e                   	pop    %esi
+  800381:	5d                   	pop    %ebp
+  800382:	c3                   	ret
+
+00800383 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800383:	55                   	push   %ebp
+  800384:	89 e5                	mov    %esp,%ebp
+  800386:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800389:	e8 08 12 00 00       	call   801596 <close_all>
+	sys_env_destroy(0);
+  80038e:	83 ec 0c             	sub    $0xc,%esp
+  800391:	6a 00                	push   $0x0
+  800393:	e8 4b 0a 00 00       	call   800de3 <sys_env_destroy>
+}
+  800398:	83 c4 10             	add    $0x10,%esp
+  80039b:	c9                   	leave
+  80039c:	c3                   	ret
+
+0080039d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80039d:	55                   	push   %ebp
+  80039e:	89 e5                	mov    %esp,%ebp
+  8003a0:	56                   	push   %esi
+  8003a1:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8003a2:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003a5:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8003ab:	e8 7c 0a 00 00       	call   800e2c <sys_getenvid>
+  8003b0:	83 ec 0c             	sub    $0xc,%esp
+  8003b3:	ff 75 0c             	push   0xc(%ebp)
+  8003b6:	ff 75 08             	push   0x8(%ebp)
+  8003b9:	56                   	push   %esi
+  8003ba:	50                   	push   %eax
+  8003bb:	68 b4 3d 80 00       	push   $0x803db4
+  8003c0:	e8 b3 00 00 00       	call   800478 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8003c5:	83 c4 18             	add    $0x18,%esp
+  8003c8:	53                   	push   %ebx
+  8003c9:	ff 75 10             	push   0x10(%ebp)
+  8003cc:	e8 56 00 00 00       	call   800427 <vcprintf>
+	cprintf("\n");
+  8003d1:	c7 04 24 87 42 80 00 	movl   $0x804287,(%esp)
+  8003d8:	e8 9b 00 00 00       	call   800478 <cprintf>
+  8003dd:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003e0:	cc                   	int3
+	while (1)
+  8003e1:	eb fd                	jmp    8003e0 <_panic+0x43>
+
+008003e3 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003e3:	55                   	push   %ebp
+  8003e4:	89 e5                	mov    %esp,%ebp
+  8003e6:	53                   	push   %ebx
+  8003e7:	83 ec 04             	sub    $0x4,%esp
+  8003ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003ed:	8b 13                	mov    (%ebx),%edx
+  8003ef:	8d 42 01             	lea    0x1(%edx),%eax
+  8003f2:	89 03                	mov    %eax,(%ebx)
+  8003f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003f7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003fb:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800400:	74 09                	je     80040b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800402:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800406:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800409:	c9                   	leave
+  80040a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80040b:	83 ec 08             	sub    $0x8,%esp
+  80040e:	68 ff 00 00 00       	push   $0xff
+  800413:	8d 43 08             	lea    0x8(%ebx),%eax
+  800416:	50                   	push   %eax
+  800417:	e8 7a 09 00 00       	call   800d96 <sys_cputs>
+		b->idx = 0;
+  80041c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800422:	83 c4 10             	add    $0x10,%esp
+  800425:	eb db                	jmp    800402 <putch+0x1f>
+
+00800427 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800427:	55                   	push   %ebp
+  800428:	89 e5                	mov    %esp,%ebp
+  80042a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800430:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800437:	00 00 00 
+	b.cnt = 0;
+  80043a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800441:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800444:	ff 75 0c             	push   0xc(%ebp)
+  800447:	ff 75 08             	push   0x8(%ebp)
+  80044a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800450:	50                   	push   %eax
+  800451:	68 e3 03 80 00       	push   $0x8003e3
+  800456:	e8 14 01 00 00       	call   80056f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80045b:	83 c4 08             	add    $0x8,%esp
+  80045e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800464:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80046a:	50                   	push   %eax
+  80046b:	e8 26 09 00 00       	call   800d96 <sys_cputs>
+
+	return b.cnt;
+}
+  800470:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800476:	c9                   	leave
+  800477:	c3                   	ret
+
+00800478 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800478:	55                   	push   %ebp
+  800479:	89 e5                	mov    %esp,%ebp
+  80047b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80047e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800481:	50                   	push   %eax
+  800482:	ff 75 08             	push   0x8(%ebp)
+  800485:	e8 9d ff ff ff       	call   800427 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80048a:	c9                   	leave
+  80048b:	c3                   	ret
+
+0080048c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80048c:	55                   	push   %ebp
+  80048d:	89 e5                	mov    %esp,%ebp
+  80048f:	57                   	push   %edi
+  800490:	56                   	push   %esi
+  800491:	53                   	push   %ebx
+  800492:	83 ec 1c             	sub    $0x1c,%esp
+  800495:	89 c7                	mov    %eax,%edi
+  800497:	89 d6                	mov    %edx,%esi
+  800499:	8b 45 08             	mov    0x8(%ebp),%eax
+  80049c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80049f:	89 d1                	mov    %edx,%ecx
+  8004a1:	89 c2                	mov    %eax,%edx
+  8004a3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004a6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004a9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8004ac:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8004af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004b2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004b9:	39 c2                	cmp    %eax,%edx
+  8004bb:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8004be:	72 3e                	jb     8004fe <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004c0:	83 ec 0c             	sub    $0xc,%esp
+  8004c3:	ff 75 18             	push   0x18(%ebp)
+  8004c6:	83 eb 01             	sub    $0x1,%ebx
+  8004c9:	53                   	push   %ebx
+  8004ca:	50                   	push   %eax
+  8004cb:	83 ec 08             	sub    $0x8,%esp
+  8004ce:	ff 75 e4             	push   -0x1c(%ebp)
+  8004d1:	ff 75 e0             	push   -0x20(%ebp)
+  8004d4:	ff 75 dc             	push   -0x24(%ebp)
+  8004d7:	ff 75 d8             	push   -0x28(%ebp)
+  8004da:	e8 54 36 00 00       	call   803b33 <__udivdi3>
+  8004df:	83 c4 18             	add    $0x18,%esp
+  8004e2:	52                   	push   %edx
+  8004e3:	50                   	push   %eax
+  8004e4:	89 f2                	mov    %esi,%edx
+  8004e6:	89 f8                	mov    %edi,%eax
+  8004e8:	e8 9f ff ff ff       	call   80048c <printnum>
+  8004ed:	83 c4 20             	add    $0x20,%esp
+  8004f0:	eb 13                	jmp    800505 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8004f2:	83 ec 08             	sub    $0x8,%esp
+  8004f5:	56                   	push   %esi
+  8004f6:	ff 75 18             	push   0x18(%ebp)
+  8004f9:	ff d7                	call   *%edi
+  8004fb:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8004fe:	83 eb 01             	sub    $0x1,%ebx
+  800501:	85 db                	test   %ebx,%ebx
+  800503:	7f ed                	jg     8004f2 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800505:	83 ec 08             	sub    $0x8,%esp
+  800508:	56                   	push   %esi
+  800509:	83 ec 04             	sub    $0x4,%esp
+  80050c:	ff 75 e4             	push   -0x1c(%ebp)
+  80050f:	ff 75 e0             	push   -0x20(%ebp)
+  800512:	ff 75 dc             	push   -0x24(%ebp)
+  800515:	ff 75 d8             	push   -0x28(%ebp)
+  800518:	e8 34 36 00 00       	call   803b51 <__umoddi3>
+  80051d:	83 c4 14             	add    $0x14,%esp
+  800520:	0f be 80 d7 3d 80 00 	movsbl 0x803dd7(%eax),%eax
+  800527:	50                   	push   %eax
+  800528:	ff d7                	call   *%edi
+}
+  80052a:	83 c4 10             	add    $0x10,%esp
+  80052d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800530:	5b                   	pop    %ebx
+  800531:	5e                   	pop    %esi
+  800532:	5f                   	pop    %edi
+  800533:	5d                   	pop    %ebp
+  800534:	c3                   	ret
+
+00800535 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800535:	55                   	push   %ebp
+  800536:	89 e5                	mov    %esp,%ebp
+  800538:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80053b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80053f:	8b 10                	mov    (%eax),%edx
+  800541:	3b 50 04             	cmp    0x4(%eax),%edx
+  800544:	73 0a                	jae    800550 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800546:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800549:	89 08                	mov    %ecx,(%eax)
+  80054b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80054e:	88 02                	mov    %al,(%edx)
+}
+  800550:	5d                   	pop    %ebp
+  800551:	c3                   	ret
+
+00800552 <printfmt>:
+{
+  800552:	55                   	push   %ebp
+  800553:	89 e5                	mov    %esp,%ebp
+  800555:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800558:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80055b:	50                   	push   %eax
+  80055c:	ff 75 10             	push   0x10(%ebp)
+  80055f:	ff 75 0c             	push   0xc(%ebp)
+  800562:	ff 75 08             	push   0x8(%ebp)
+  800565:	e8 05 00 00 00       	call   80056f <vprintfmt>
+}
+  80056a:	83 c4 10             	add    $0x10,%esp
+  80056d:	c9                   	leave
+  80056e:	c3                   	ret
+
+0080056f <vprintfmt>:
+{
+  80056f:	55                   	push   %ebp
+  800570:	89 e5                	mov    %esp,%ebp
+  800572:	57                   	push   %edi
+  800573:	56                   	push   %esi
+  800574:	53                   	push   %ebx
+  800575:	83 ec 2c             	sub    $0x2c,%esp
+  800578:	8b 75 08             	mov    0x8(%ebp),%esi
+  80057b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80057e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800581:	eb 0a                	jmp    80058d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800583:	83 ec 08             	sub    $0x8,%esp
+  800586:	53                   	push   %ebx
+  800587:	50                   	push   %eax
+  800588:	ff d6                	call   *%esi
+  80058a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80058d:	83 c7 01             	add    $0x1,%edi
+  800590:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800594:	83 f8 25             	cmp    $0x25,%eax
+  800597:	74 0c                	je     8005a5 <vprintfmt+0x36>
+			if (ch == '\0')
+  800599:	85 c0                	test   %eax,%eax
+  80059b:	75 e6                	jne    800583 <vprintfmt+0x14>
+}
+  80059d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005a0:	5b                   	pop    %ebx
+  8005a1:	5e                   	pop    %esi
+  8005a2:	5f                   	pop    %edi
+  8005a3:	5d                   	pop    %ebp
+  8005a4:	c3                   	ret
+		padc = ' ';
+  8005a5:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8005a9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8005b0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8005b7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8005be:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005c3:	8d 47 01             	lea    0x1(%edi),%eax
+  8005c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005c9:	0f b6 17             	movzbl (%edi),%edx
+  8005cc:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8005cf:	3c 55                	cmp    $0x55,%al
+  8005d1:	0f 87 cf 03 00 00    	ja     8009a6 <vprintfmt+0x437>
+  8005d7:	0f b6 c0             	movzbl %al,%eax
+  8005da:	ff 24 85 40 3f 80 00 	jmp    *0x803f40(,%eax,4)
+  8005e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8005e4:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8005e8:	eb d9                	jmp    8005c3 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005ed:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8005f1:	eb d0                	jmp    8005c3 <vprintfmt+0x54>
+  8005f3:	0f b6 d2             	movzbl %dl,%edx
+  8005f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8005f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005fe:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800601:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800604:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800608:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80060b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80060e:	83 f9 09             	cmp    $0x9,%ecx
+  800611:	77 55                	ja     800668 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800613:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800616:	eb e9                	jmp    800601 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800618:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061b:	8b 00                	mov    (%eax),%eax
+  80061d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	8d 40 04             	lea    0x4(%eax),%eax
+  800626:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800629:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80062c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800630:	79 91                	jns    8005c3 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800632:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800635:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800638:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80063f:	eb 82                	jmp    8005c3 <vprintfmt+0x54>
+			if (width < 0)
+  800641:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800644:	85 d2                	test   %edx,%edx
+  800646:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064b:	0f 49 c2             	cmovns %edx,%eax
+  80064e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800651:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800654:	e9 6a ff ff ff       	jmp    8005c3 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800659:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80065c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800663:	e9 5b ff ff ff       	jmp    8005c3 <vprintfmt+0x54>
+  800668:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80066b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80066e:	eb bc                	jmp    80062c <vprintfmt+0xbd>
+			lflag++;
+  800670:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800673:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800676:	e9 48 ff ff ff       	jmp    8005c3 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	8d 78 04             	lea    0x4(%eax),%edi
+  800681:	83 ec 08             	sub    $0x8,%esp
+  800684:	53                   	push   %ebx
+  800685:	ff 30                	push   (%eax)
+  800687:	ff d6                	call   *%esi
+			break;
+  800689:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80068c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80068f:	e9 b1 02 00 00       	jmp    800945 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800694:	8b 45 14             	mov    0x14(%ebp),%eax
+  800697:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80069a:	8b 10                	mov    (%eax),%edx
+  80069c:	89 d0                	mov    %edx,%eax
+  80069e:	f7 d8                	neg    %eax
+  8006a0:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006a3:	83 f8 11             	cmp    $0x11,%eax
+  8006a6:	7f 23                	jg     8006cb <vprintfmt+0x15c>
+  8006a8:	8b 14 85 a0 40 80 00 	mov    0x8040a0(,%eax,4),%edx
+  8006af:	85 d2                	test   %edx,%edx
+  8006b1:	74 18                	je     8006cb <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8006b3:	52                   	push   %edx
+  8006b4:	68 f2 41 80 00       	push   $0x8041f2
+  8006b9:	53                   	push   %ebx
+  8006ba:	56                   	push   %esi
+  8006bb:	e8 92 fe ff ff       	call   800552 <printfmt>
+  8006c0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006c3:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8006c6:	e9 7a 02 00 00       	jmp    800945 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8006cb:	50                   	push   %eax
+  8006cc:	68 ef 3d 80 00       	push   $0x803def
+  8006d1:	53                   	push   %ebx
+  8006d2:	56                   	push   %esi
+  8006d3:	e8 7a fe ff ff       	call   800552 <printfmt>
+  8006d8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006db:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006de:	e9 62 02 00 00       	jmp    800945 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e6:	83 c0 04             	add    $0x4,%eax
+  8006e9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8006ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ef:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8006f1:	85 c9                	test   %ecx,%ecx
+  8006f3:	b8 e8 3d 80 00       	mov    $0x803de8,%eax
+  8006f8:	0f 45 c1             	cmovne %ecx,%eax
+  8006fb:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8006fe:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800702:	7e 06                	jle    80070a <vprintfmt+0x19b>
+  800704:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800708:	75 0b                	jne    800715 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80070a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80070d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800710:	89 75 08             	mov    %esi,0x8(%ebp)
+  800713:	eb 5c                	jmp    800771 <vprintfmt+0x202>
+  800715:	83 ec 08             	sub    $0x8,%esp
+  800718:	ff 75 d0             	push   -0x30(%ebp)
+  80071b:	ff 75 cc             	push   -0x34(%ebp)
+  80071e:	e8 20 03 00 00       	call   800a43 <strnlen>
+  800723:	89 c2                	mov    %eax,%edx
+  800725:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800728:	29 d0                	sub    %edx,%eax
+  80072a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80072d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800731:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800734:	89 75 08             	mov    %esi,0x8(%ebp)
+  800737:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800739:	eb 0e                	jmp    800749 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80073b:	83 ec 08             	sub    $0x8,%esp
+  80073e:	53                   	push   %ebx
+  80073f:	57                   	push   %edi
+  800740:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800743:	83 ee 01             	sub    $0x1,%esi
+  800746:	83 c4 10             	add    $0x10,%esp
+  800749:	85 f6                	test   %esi,%esi
+  80074b:	7f ee                	jg     80073b <vprintfmt+0x1cc>
+  80074d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800750:	8b 75 08             	mov    0x8(%ebp),%esi
+  800753:	85 c0                	test   %eax,%eax
+  800755:	ba 00 00 00 00       	mov    $0x0,%edx
+  80075a:	0f 49 d0             	cmovns %eax,%edx
+  80075d:	29 d0                	sub    %edx,%eax
+  80075f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800762:	eb a6                	jmp    80070a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800764:	83 ec 08             	sub    $0x8,%esp
+  800767:	53                   	push   %ebx
+  800768:	52                   	push   %edx
+  800769:	ff 55 08             	call   *0x8(%ebp)
+  80076c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80076f:	89 f1                	mov    %esi,%ecx
+  800771:	8d 71 01             	lea    0x1(%ecx),%esi
+  800774:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800778:	0f be d0             	movsbl %al,%edx
+  80077b:	85 d2                	test   %edx,%edx
+  80077d:	74 28                	je     8007a7 <vprintfmt+0x238>
+  80077f:	85 ff                	test   %edi,%edi
+  800781:	78 05                	js     800788 <vprintfmt+0x219>
+  800783:	83 ef 01             	sub    $0x1,%edi
+  800786:	78 30                	js     8007b8 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800788:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80078c:	74 d6                	je     800764 <vprintfmt+0x1f5>
+  80078e:	0f be c0             	movsbl %al,%eax
+  800791:	83 e8 20             	sub    $0x20,%eax
+  800794:	83 f8 5e             	cmp    $0x5e,%eax
+  800797:	76 cb                	jbe    800764 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800799:	83 ec 08             	sub    $0x8,%esp
+  80079c:	53                   	push   %ebx
+  80079d:	6a 3f                	push   $0x3f
+  80079f:	ff 55 08             	call   *0x8(%ebp)
+  8007a2:	83 c4 10             	add    $0x10,%esp
+  8007a5:	eb c8                	jmp    80076f <vprintfmt+0x200>
+  8007a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007aa:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007ad:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007b0:	01 d0                	add    %edx,%eax
+  8007b2:	29 c8                	sub    %ecx,%eax
+  8007b4:	89 c7                	mov    %eax,%edi
+  8007b6:	eb 13                	jmp    8007cb <vprintfmt+0x25c>
+  8007b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007bb:	eb ed                	jmp    8007aa <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8007bd:	83 ec 08             	sub    $0x8,%esp
+  8007c0:	53                   	push   %ebx
+  8007c1:	6a 20                	push   $0x20
+  8007c3:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8007c5:	83 ef 01             	sub    $0x1,%edi
+  8007c8:	83 c4 10             	add    $0x10,%esp
+  8007cb:	85 ff                	test   %edi,%edi
+  8007cd:	7f ee                	jg     8007bd <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007cf:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8007d2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007d5:	e9 6b 01 00 00       	jmp    800945 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8007da:	83 f9 01             	cmp    $0x1,%ecx
+  8007dd:	7f 1f                	jg     8007fe <vprintfmt+0x28f>
+	else if (lflag)
+  8007df:	85 c9                	test   %ecx,%ecx
+  8007e1:	74 67                	je     80084a <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8007e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e6:	8b 00                	mov    (%eax),%eax
+  8007e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007eb:	89 c1                	mov    %eax,%ecx
+  8007ed:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007f0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007fc:	eb 17                	jmp    800815 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8007fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800801:	8b 50 04             	mov    0x4(%eax),%edx
+  800804:	8b 00                	mov    (%eax),%eax
+  800806:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800809:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80080c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080f:	8d 40 08             	lea    0x8(%eax),%eax
+  800812:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800815:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800818:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80081b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800820:	85 c9                	test   %ecx,%ecx
+  800822:	0f 89 03 01 00 00    	jns    80092b <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800828:	83 ec 08             	sub    $0x8,%esp
+  80082b:	53                   	push   %ebx
+  80082c:	6a 2d                	push   $0x2d
+  80082e:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800830:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800833:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800836:	f7 da                	neg    %edx
+  800838:	83 d1 00             	adc    $0x0,%ecx
+  80083b:	f7 d9                	neg    %ecx
+  80083d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800840:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800845:	e9 e1 00 00 00       	jmp    80092b <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80084a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084d:	8b 00                	mov    (%eax),%eax
+  80084f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800852:	89 c1                	mov    %eax,%ecx
+  800854:	c1 f9 1f             	sar    $0x1f,%ecx
+  800857:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80085a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085d:	8d 40 04             	lea    0x4(%eax),%eax
+  800860:	89 45 14             	mov    %eax,0x14(%ebp)
+  800863:	eb b0                	jmp    800815 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800865:	83 f9 01             	cmp    $0x1,%ecx
+  800868:	7f 1e                	jg     800888 <vprintfmt+0x319>
+	else if (lflag)
+  80086a:	85 c9                	test   %ecx,%ecx
+  80086c:	74 32                	je     8008a0 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80086e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800871:	8b 10                	mov    (%eax),%edx
+  800873:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800878:	8d 40 04             	lea    0x4(%eax),%eax
+  80087b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80087e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800883:	e9 a3 00 00 00       	jmp    80092b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800888:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088b:	8b 10                	mov    (%eax),%edx
+  80088d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800890:	8d 40 08             	lea    0x8(%eax),%eax
+  800893:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800896:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80089b:	e9 8b 00 00 00       	jmp    80092b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a3:	8b 10                	mov    (%eax),%edx
+  8008a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ad:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008b0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8008b5:	eb 74                	jmp    80092b <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8008b7:	83 f9 01             	cmp    $0x1,%ecx
+  8008ba:	7f 1b                	jg     8008d7 <vprintfmt+0x368>
+	else if (lflag)
+  8008bc:	85 c9                	test   %ecx,%ecx
+  8008be:	74 2c                	je     8008ec <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8008c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c3:	8b 10                	mov    (%eax),%edx
+  8008c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8008cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008d0:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8008d5:	eb 54                	jmp    80092b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8008d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008da:	8b 10                	mov    (%eax),%edx
+  8008dc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008df:	8d 40 08             	lea    0x8(%eax),%eax
+  8008e2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008e5:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8008ea:	eb 3f                	jmp    80092b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ef:	8b 10                	mov    (%eax),%edx
+  8008f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008fc:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800901:	eb 28                	jmp    80092b <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800903:	83 ec 08             	sub    $0x8,%esp
+  800906:	53                   	push   %ebx
+  800907:	6a 30                	push   $0x30
+  800909:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80090b:	83 c4 08             	add    $0x8,%esp
+  80090e:	53                   	push   %ebx
+  80090f:	6a 78                	push   $0x78
+  800911:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800913:	8b 45 14             	mov    0x14(%ebp),%eax
+  800916:	8b 10                	mov    (%eax),%edx
+  800918:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80091d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800920:	8d 40 04             	lea    0x4(%eax),%eax
+  800923:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800926:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80092b:	83 ec 0c             	sub    $0xc,%esp
+  80092e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800932:	50                   	push   %eax
+  800933:	ff 75 e0             	push   -0x20(%ebp)
+  800936:	57                   	push   %edi
+  800937:	51                   	push   %ecx
+  800938:	52                   	push   %edx
+  800939:	89 da                	mov    %ebx,%edx
+  80093b:	89 f0                	mov    %esi,%eax
+  80093d:	e8 4a fb ff ff       	call   80048c <printnum>
+			break;
+  800942:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800945:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800948:	e9 40 fc ff ff       	jmp    80058d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80094d:	83 f9 01             	cmp    $0x1,%ecx
+  800950:	7f 1b                	jg     80096d <vprintfmt+0x3fe>
+	else if (lflag)
+  800952:	85 c9                	test   %ecx,%ecx
+  800954:	74 2c                	je     800982 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800956:	8b 45 14             	mov    0x14(%ebp),%eax
+  800959:	8b 10                	mov    (%eax),%edx
+  80095b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800960:	8d 40 04             	lea    0x4(%eax),%eax
+  800963:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800966:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80096b:	eb be                	jmp    80092b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80096d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800970:	8b 10                	mov    (%eax),%edx
+  800972:	8b 48 04             	mov    0x4(%eax),%ecx
+  800975:	8d 40 08             	lea    0x8(%eax),%eax
+  800978:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80097b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800980:	eb a9                	jmp    80092b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800982:	8b 45 14             	mov    0x14(%ebp),%eax
+  800985:	8b 10                	mov    (%eax),%edx
+  800987:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80098c:	8d 40 04             	lea    0x4(%eax),%eax
+  80098f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800992:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800997:	eb 92                	jmp    80092b <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800999:	83 ec 08             	sub    $0x8,%esp
+  80099c:	53                   	push   %ebx
+  80099d:	6a 25                	push   $0x25
+  80099f:	ff d6                	call   *%esi
+			break;
+  8009a1:	83 c4 10             	add    $0x10,%esp
+  8009a4:	eb 9f                	jmp    800945 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8009a6:	83 ec 08             	sub    $0x8,%esp
+  8009a9:	53                   	push   %ebx
+  8009aa:	6a 25                	push   $0x25
+  8009ac:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009ae:	83 c4 10             	add    $0x10,%esp
+  8009b1:	89 f8                	mov    %edi,%eax
+  8009b3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8009b7:	74 05                	je     8009be <vprintfmt+0x44f>
+  8009b9:	83 e8 01             	sub    $0x1,%eax
+  8009bc:	eb f5                	jmp    8009b3 <vprintfmt+0x444>
+  8009be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009c1:	eb 82                	jmp    800945 <vprintfmt+0x3d6>
+
+008009c3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009c3:	55                   	push   %ebp
+  8009c4:	89 e5                	mov    %esp,%ebp
+  8009c6:	83 ec 18             	sub    $0x18,%esp
+  8009c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009cf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009d2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009d6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009d9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009e0:	85 c0                	test   %eax,%eax
+  8009e2:	74 26                	je     800a0a <vsnprintf+0x47>
+  8009e4:	85 d2                	test   %edx,%edx
+  8009e6:	7e 22                	jle    800a0a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009e8:	ff 75 14             	push   0x14(%ebp)
+  8009eb:	ff 75 10             	push   0x10(%ebp)
+  8009ee:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009f1:	50                   	push   %eax
+  8009f2:	68 35 05 80 00       	push   $0x800535
+  8009f7:	e8 73 fb ff ff       	call   80056f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009fc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009ff:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a05:	83 c4 10             	add    $0x10,%esp
+}
+  800a08:	c9                   	leave
+  800a09:	c3                   	ret
+		return -E_INVAL;
+  800a0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a0f:	eb f7                	jmp    800a08 <vsnprintf+0x45>
+
+00800a11 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a11:	55                   	push   %ebp
+  800a12:	89 e5                	mov    %esp,%ebp
+  800a14:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a17:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a1a:	50                   	push   %eax
+  800a1b:	ff 75 10             	push   0x10(%ebp)
+  800a1e:	ff 75 0c             	push   0xc(%ebp)
+  800a21:	ff 75 08             	push   0x8(%ebp)
+  800a24:	e8 9a ff ff ff       	call   8009c3 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a29:	c9                   	leave
+  800a2a:	c3                   	ret
+
+00800a2b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a36:	eb 03                	jmp    800a3b <strlen+0x10>
+		n++;
+  800a38:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a3b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a3f:	75 f7                	jne    800a38 <strlen+0xd>
+	return n;
+}
+  800a41:	5d                   	pop    %ebp
+  800a42:	c3                   	ret
+
+00800a43 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a43:	55                   	push   %ebp
+  800a44:	89 e5                	mov    %esp,%ebp
+  800a46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a49:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a51:	eb 03                	jmp    800a56 <strnlen+0x13>
+		n++;
+  800a53:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a56:	39 d0                	cmp    %edx,%eax
+  800a58:	74 08                	je     800a62 <strnlen+0x1f>
+  800a5a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a5e:	75 f3                	jne    800a53 <strnlen+0x10>
+  800a60:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a62:	89 d0                	mov    %edx,%eax
+  800a64:	5d                   	pop    %ebp
+  800a65:	c3                   	ret
+
+00800a66 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a66:	55                   	push   %ebp
+  800a67:	89 e5                	mov    %esp,%ebp
+  800a69:	53                   	push   %ebx
+  800a6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a6d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a75:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a79:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a7c:	83 c0 01             	add    $0x1,%eax
+  800a7f:	84 d2                	test   %dl,%dl
+  800a81:	75 f2                	jne    800a75 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a83:	89 c8                	mov    %ecx,%eax
+  800a85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a88:	c9                   	leave
+  800a89:	c3                   	ret
+
+00800a8a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a8a:	55                   	push   %ebp
+  800a8b:	89 e5                	mov    %esp,%ebp
+  800a8d:	53                   	push   %ebx
+  800a8e:	83 ec 10             	sub    $0x10,%esp
+  800a91:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a94:	53                   	push   %ebx
+  800a95:	e8 91 ff ff ff       	call   800a2b <strlen>
+  800a9a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a9d:	ff 75 0c             	push   0xc(%ebp)
+  800aa0:	01 d8                	add    %ebx,%eax
+  800aa2:	50                   	push   %eax
+  800aa3:	e8 be ff ff ff       	call   800a66 <strcpy>
+	return dst;
+}
+  800aa8:	89 d8                	mov    %ebx,%eax
+  800aaa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aad:	c9                   	leave
+  800aae:	c3                   	ret
+
+00800aaf <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800aaf:	55                   	push   %ebp
+  800ab0:	89 e5                	mov    %esp,%ebp
+  800ab2:	56                   	push   %esi
+  800ab3:	53                   	push   %ebx
+  800ab4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ab7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800aba:	89 f3                	mov    %esi,%ebx
+  800abc:	03 5d 10             	add    0x10(%ebp),%ebx
+  800abf:	89 f0                	mov    %esi,%eax
+  800ac1:	eb 0f                	jmp    800ad2 <strncpy+0x23>
+		*dst++ = *src;
+  800ac3:	83 c0 01             	add    $0x1,%eax
+  800ac6:	0f b6 0a             	movzbl (%edx),%ecx
+  800ac9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800acc:	80 f9 01             	cmp    $0x1,%cl
+  800acf:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800ad2:	39 d8                	cmp    %ebx,%eax
+  800ad4:	75 ed                	jne    800ac3 <strncpy+0x14>
+	}
+	return ret;
+}
+  800ad6:	89 f0                	mov    %esi,%eax
+  800ad8:	5b                   	pop    %ebx
+  800ad9:	5e                   	pop    %esi
+  800ada:	5d                   	pop    %ebp
+  800adb:	c3                   	ret
+
+00800adc <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800adc:	55                   	push   %ebp
+  800add:	89 e5                	mov    %esp,%ebp
+  800adf:	56                   	push   %esi
+  800ae0:	53                   	push   %ebx
+  800ae1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ae4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae7:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800aea:	89 f0                	mov    %esi,%eax
+  800aec:	85 d2                	test   %edx,%edx
+  800aee:	74 21                	je     800b11 <strlcpy+0x35>
+  800af0:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800af4:	89 f2                	mov    %esi,%edx
+  800af6:	eb 09                	jmp    800b01 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800af8:	83 c1 01             	add    $0x1,%ecx
+  800afb:	83 c2 01             	add    $0x1,%edx
+  800afe:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b01:	39 c2                	cmp    %eax,%edx
+  800b03:	74 09                	je     800b0e <strlcpy+0x32>
+  800b05:	0f b6 19             	movzbl (%ecx),%ebx
+  800b08:	84 db                	test   %bl,%bl
+  800b0a:	75 ec                	jne    800af8 <strlcpy+0x1c>
+  800b0c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b0e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b11:	29 f0                	sub    %esi,%eax
+}
+  800b13:	5b                   	pop    %ebx
+  800b14:	5e                   	pop    %esi
+  800b15:	5d                   	pop    %ebp
+  800b16:	c3                   	ret
+
+00800b17 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b17:	55                   	push   %ebp
+  800b18:	89 e5                	mov    %esp,%ebp
+  800b1a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b20:	eb 06                	jmp    800b28 <strcmp+0x11>
+		p++, q++;
+  800b22:	83 c1 01             	add    $0x1,%ecx
+  800b25:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b28:	0f b6 01             	movzbl (%ecx),%eax
+  800b2b:	84 c0                	test   %al,%al
+  800b2d:	74 04                	je     800b33 <strcmp+0x1c>
+  800b2f:	3a 02                	cmp    (%edx),%al
+  800b31:	74 ef                	je     800b22 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b33:	0f b6 c0             	movzbl %al,%eax
+  800b36:	0f b6 12             	movzbl (%edx),%edx
+  800b39:	29 d0                	sub    %edx,%eax
+}
+  800b3b:	5d                   	pop    %ebp
+  800b3c:	c3                   	ret
+
+00800b3d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b3d:	55                   	push   %ebp
+  800b3e:	89 e5                	mov    %esp,%ebp
+  800b40:	53                   	push   %ebx
+  800b41:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b47:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b4a:	eb 09                	jmp    800b55 <strncmp+0x18>
+		n--, p++, q++;
+  800b4c:	83 ea 01             	sub    $0x1,%edx
+  800b4f:	83 c0 01             	add    $0x1,%eax
+  800b52:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b55:	85 d2                	test   %edx,%edx
+  800b57:	74 18                	je     800b71 <strncmp+0x34>
+  800b59:	0f b6 18             	movzbl (%eax),%ebx
+  800b5c:	84 db                	test   %bl,%bl
+  800b5e:	74 04                	je     800b64 <strncmp+0x27>
+  800b60:	3a 19                	cmp    (%ecx),%bl
+  800b62:	74 e8                	je     800b4c <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b64:	0f b6 00             	movzbl (%eax),%eax
+  800b67:	0f b6 11             	movzbl (%ecx),%edx
+  800b6a:	29 d0                	sub    %edx,%eax
+}
+  800b6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b6f:	c9                   	leave
+  800b70:	c3                   	ret
+		return 0;
+  800b71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b76:	eb f4                	jmp    800b6c <strncmp+0x2f>
+
+00800b78 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b78:	55                   	push   %ebp
+  800b79:	89 e5                	mov    %esp,%ebp
+  800b7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b7e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b82:	eb 03                	jmp    800b87 <strchr+0xf>
+  800b84:	83 c0 01             	add    $0x1,%eax
+  800b87:	0f b6 10             	movzbl (%eax),%edx
+  800b8a:	84 d2                	test   %dl,%dl
+  800b8c:	74 06                	je     800b94 <strchr+0x1c>
+		if (*s == c)
+  800b8e:	38 ca                	cmp    %cl,%dl
+  800b90:	75 f2                	jne    800b84 <strchr+0xc>
+  800b92:	eb 05                	jmp    800b99 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b94:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b99:	5d                   	pop    %ebp
+  800b9a:	c3                   	ret
+
+00800b9b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b9b:	55                   	push   %ebp
+  800b9c:	89 e5                	mov    %esp,%ebp
+  800b9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ba1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ba5:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800ba8:	38 ca                	cmp    %cl,%dl
+  800baa:	74 09                	je     800bb5 <strfind+0x1a>
+  800bac:	84 d2                	test   %dl,%dl
+  800bae:	74 05                	je     800bb5 <strfind+0x1a>
+	for (; *s; s++)
+  800bb0:	83 c0 01             	add    $0x1,%eax
+  800bb3:	eb f0                	jmp    800ba5 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800bb5:	5d                   	pop    %ebp
+  800bb6:	c3                   	ret
+
+00800bb7 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bb7:	55                   	push   %ebp
+  800bb8:	89 e5                	mov    %esp,%ebp
+  800bba:	57                   	push   %edi
+  800bbb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bbe:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bc1:	85 c9                	test   %ecx,%ecx
+  800bc3:	74 20                	je     800be5 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800bc5:	89 f8                	mov    %edi,%eax
+  800bc7:	09 c8                	or     %ecx,%eax
+  800bc9:	a8 03                	test   $0x3,%al
+  800bcb:	75 12                	jne    800bdf <memset+0x28>
+		c &= 0xFF;
+  800bcd:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bd1:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800bd7:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800bda:	fc                   	cld
+  800bdb:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bdd:	eb 06                	jmp    800be5 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800bdf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800be2:	fc                   	cld
+  800be3:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800be5:	89 f8                	mov    %edi,%eax
+  800be7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bea:	c9                   	leave
+  800beb:	c3                   	ret
+
+00800bec <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bec:	55                   	push   %ebp
+  800bed:	89 e5                	mov    %esp,%ebp
+  800bef:	57                   	push   %edi
+  800bf0:	56                   	push   %esi
+  800bf1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bf7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bfa:	39 c6                	cmp    %eax,%esi
+  800bfc:	73 32                	jae    800c30 <memmove+0x44>
+  800bfe:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c01:	39 d0                	cmp    %edx,%eax
+  800c03:	73 2b                	jae    800c30 <memmove+0x44>
+		s += n;
+		d += n;
+  800c05:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c08:	89 d6                	mov    %edx,%esi
+  800c0a:	09 fe                	or     %edi,%esi
+  800c0c:	09 ce                	or     %ecx,%esi
+  800c0e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c14:	75 0e                	jne    800c24 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c16:	83 ef 04             	sub    $0x4,%edi
+  800c19:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c1c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c1f:	fd                   	std
+  800c20:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c22:	eb 09                	jmp    800c2d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c24:	83 ef 01             	sub    $0x1,%edi
+  800c27:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c2a:	fd                   	std
+  800c2b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c2d:	fc                   	cld
+  800c2e:	eb 1a                	jmp    800c4a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c30:	89 f2                	mov    %esi,%edx
+  800c32:	09 c2                	or     %eax,%edx
+  800c34:	09 ca                	or     %ecx,%edx
+  800c36:	f6 c2 03             	test   $0x3,%dl
+  800c39:	75 0a                	jne    800c45 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c3b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c3e:	89 c7                	mov    %eax,%edi
+  800c40:	fc                   	cld
+  800c41:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c43:	eb 05                	jmp    800c4a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c45:	89 c7                	mov    %eax,%edi
+  800c47:	fc                   	cld
+  800c48:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c4a:	5e                   	pop    %esi
+  800c4b:	5f                   	pop    %edi
+  800c4c:	5d                   	pop    %ebp
+  800c4d:	c3                   	ret
+
+00800c4e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c4e:	55                   	push   %ebp
+  800c4f:	89 e5                	mov    %esp,%ebp
+  800c51:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c54:	ff 75 10             	push   0x10(%ebp)
+  800c57:	ff 75 0c             	push   0xc(%ebp)
+  800c5a:	ff 75 08             	push   0x8(%ebp)
+  800c5d:	e8 8a ff ff ff       	call   800bec <memmove>
+}
+  800c62:	c9                   	leave
+  800c63:	c3                   	ret
+
+00800c64 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c64:	55                   	push   %ebp
+  800c65:	89 e5                	mov    %esp,%ebp
+  800c67:	56                   	push   %esi
+  800c68:	53                   	push   %ebx
+  800c69:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c6f:	89 c6                	mov    %eax,%esi
+  800c71:	03 75 10             	add    0x10(%ebp),%esi
+  800c74:	eb 06                	jmp    800c7c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c76:	83 c0 01             	add    $0x1,%eax
+  800c79:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c7c:	39 f0                	cmp    %esi,%eax
+  800c7e:	74 14                	je     800c94 <memcmp+0x30>
+		if (*s1 != *s2)
+  800c80:	0f b6 08             	movzbl (%eax),%ecx
+  800c83:	0f b6 1a             	movzbl (%edx),%ebx
+  800c86:	38 d9                	cmp    %bl,%cl
+  800c88:	74 ec                	je     800c76 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c8a:	0f b6 c1             	movzbl %cl,%eax
+  800c8d:	0f b6 db             	movzbl %bl,%ebx
+  800c90:	29 d8                	sub    %ebx,%eax
+  800c92:	eb 05                	jmp    800c99 <memcmp+0x35>
+	}
+
+	return 0;
+  800c94:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c99:	5b                   	pop    %ebx
+  800c9a:	5e                   	pop    %esi
+  800c9b:	5d                   	pop    %ebp
+  800c9c:	c3                   	ret
+
+00800c9d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c9d:	55                   	push   %ebp
+  800c9e:	89 e5                	mov    %esp,%ebp
+  800ca0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ca6:	89 c2                	mov    %eax,%edx
+  800ca8:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cab:	eb 03                	jmp    800cb0 <memfind+0x13>
+  800cad:	83 c0 01             	add    $0x1,%eax
+  800cb0:	39 d0                	cmp    %edx,%eax
+  800cb2:	73 04                	jae    800cb8 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cb4:	38 08                	cmp    %cl,(%eax)
+  800cb6:	75 f5                	jne    800cad <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800cb8:	5d                   	pop    %ebp
+  800cb9:	c3                   	ret
+
+00800cba <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800cba:	55                   	push   %ebp
+  800cbb:	89 e5                	mov    %esp,%ebp
+  800cbd:	57                   	push   %edi
+  800cbe:	56                   	push   %esi
+  800cbf:	53                   	push   %ebx
+  800cc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cc6:	eb 03                	jmp    800ccb <strtol+0x11>
+		s++;
+  800cc8:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ccb:	0f b6 02             	movzbl (%edx),%eax
+  800cce:	3c 20                	cmp    $0x20,%al
+  800cd0:	74 f6                	je     800cc8 <strtol+0xe>
+  800cd2:	3c 09                	cmp    $0x9,%al
+  800cd4:	74 f2                	je     800cc8 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cd6:	3c 2b                	cmp    $0x2b,%al
+  800cd8:	74 2a                	je     800d04 <strtol+0x4a>
+	int neg = 0;
+  800cda:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800cdf:	3c 2d                	cmp    $0x2d,%al
+  800ce1:	74 2b                	je     800d0e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ce3:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ce9:	75 0f                	jne    800cfa <strtol+0x40>
+  800ceb:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cee:	74 28                	je     800d18 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800cf0:	85 db                	test   %ebx,%ebx
+  800cf2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cf7:	0f 44 d8             	cmove  %eax,%ebx
+  800cfa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cff:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d02:	eb 46                	jmp    800d4a <strtol+0x90>
+		s++;
+  800d04:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d07:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d0c:	eb d5                	jmp    800ce3 <strtol+0x29>
+		s++, neg = 1;
+  800d0e:	83 c2 01             	add    $0x1,%edx
+  800d11:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d16:	eb cb                	jmp    800ce3 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d18:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d1c:	74 0e                	je     800d2c <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d1e:	85 db                	test   %ebx,%ebx
+  800d20:	75 d8                	jne    800cfa <strtol+0x40>
+		s++, base = 8;
+  800d22:	83 c2 01             	add    $0x1,%edx
+  800d25:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d2a:	eb ce                	jmp    800cfa <strtol+0x40>
+		s += 2, base = 16;
+  800d2c:	83 c2 02             	add    $0x2,%edx
+  800d2f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d34:	eb c4                	jmp    800cfa <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d36:	0f be c0             	movsbl %al,%eax
+  800d39:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d3c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d3f:	7d 3a                	jge    800d7b <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d41:	83 c2 01             	add    $0x1,%edx
+  800d44:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d48:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d4a:	0f b6 02             	movzbl (%edx),%eax
+  800d4d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d50:	89 f3                	mov    %esi,%ebx
+  800d52:	80 fb 09             	cmp    $0x9,%bl
+  800d55:	76 df                	jbe    800d36 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d57:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d5a:	89 f3                	mov    %esi,%ebx
+  800d5c:	80 fb 19             	cmp    $0x19,%bl
+  800d5f:	77 08                	ja     800d69 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d61:	0f be c0             	movsbl %al,%eax
+  800d64:	83 e8 57             	sub    $0x57,%eax
+  800d67:	eb d3                	jmp    800d3c <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d69:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d6c:	89 f3                	mov    %esi,%ebx
+  800d6e:	80 fb 19             	cmp    $0x19,%bl
+  800d71:	77 08                	ja     800d7b <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d73:	0f be c0             	movsbl %al,%eax
+  800d76:	83 e8 37             	sub    $0x37,%eax
+  800d79:	eb c1                	jmp    800d3c <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d7b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d7f:	74 05                	je     800d86 <strtol+0xcc>
+		*endptr = (char *) s;
+  800d81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d84:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d86:	89 c8                	mov    %ecx,%eax
+  800d88:	f7 d8                	neg    %eax
+  800d8a:	85 ff                	test   %edi,%edi
+  800d8c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d8f:	89 c8                	mov    %ecx,%eax
+  800d91:	5b                   	pop    %ebx
+  800d92:	5e                   	pop    %esi
+  800d93:	5f                   	pop    %edi
+  800d94:	5d                   	pop    %ebp
+  800d95:	c3                   	ret
+
+00800d96 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d96:	55                   	push   %ebp
+  800d97:	89 e5                	mov    %esp,%ebp
+  800d99:	57                   	push   %edi
+  800d9a:	56                   	push   %esi
+  800d9b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da7:	89 c3                	mov    %eax,%ebx
+  800da9:	89 c7                	mov    %eax,%edi
+  800dab:	55                   	push   %ebp
+  800dac:	89 e5                	mov    %esp,%ebp
+  800dae:	8d 35 b6 0d 80 00    	lea    0x800db6,%esi
+  800db4:	0f 34                	sysenter
+  800db6:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800db7:	5b                   	pop    %ebx
+  800db8:	5e                   	pop    %esi
+  800db9:	5f                   	pop    %edi
+  800dba:	5d                   	pop    %ebp
+  800dbb:	c3                   	ret
+
+00800dbc <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800dbc:	55                   	push   %ebp
+  800dbd:	89 e5                	mov    %esp,%ebp
+  800dbf:	57                   	push   %edi
+  800dc0:	56                   	push   %esi
+  800dc1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800dc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dcc:	89 d1                	mov    %edx,%ecx
+  800dce:	89 d3                	mov    %edx,%ebx
+  800dd0:	89 d7                	mov    %edx,%edi
+  800dd2:	55                   	push   %ebp
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	8d 35 dd 0d 80 00    	lea    0x800ddd,%esi
+  800ddb:	0f 34                	sysenter
+  800ddd:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800dde:	5b                   	pop    %ebx
+  800ddf:	5e                   	pop    %esi
+  800de0:	5f                   	pop    %edi
+  800de1:	5d                   	pop    %ebp
+  800de2:	c3                   	ret
+
+00800de3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800de3:	55                   	push   %ebp
+  800de4:	89 e5                	mov    %esp,%ebp
+  800de6:	57                   	push   %edi
+  800de7:	56                   	push   %esi
+  800de8:	53                   	push   %ebx
+  800de9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800dec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800df9:	89 cb                	mov    %ecx,%ebx
+  800dfb:	89 cf                	mov    %ecx,%edi
+  800dfd:	55                   	push   %ebp
+  800dfe:	89 e5                	mov    %esp,%ebp
+  800e00:	8d 35 08 0e 80 00    	lea    0x800e08,%esi
+  800e06:	0f 34                	sysenter
+  800e08:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e09:	85 c0                	test   %eax,%eax
+  800e0b:	7f 08                	jg     800e15 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800e0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e10:	5b                   	pop    %ebx
+  800e11:	5e                   	pop    %esi
+  800e12:	5f                   	pop    %edi
+  800e13:	5d                   	pop    %ebp
+  800e14:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e15:	83 ec 0c             	sub    $0xc,%esp
+  800e18:	50                   	push   %eax
+  800e19:	6a 03                	push   $0x3
+  800e1b:	68 07 41 80 00       	push   $0x804107
+  800e20:	6a 3d                	push   $0x3d
+  800e22:	68 24 41 80 00       	push   $0x804124
+  800e27:	e8 71 f5 ff ff       	call   80039d <_panic>
+
+00800e2c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e2c:	55                   	push   %ebp
+  800e2d:	89 e5                	mov    %esp,%ebp
+  800e2f:	57                   	push   %edi
+  800e30:	56                   	push   %esi
+  800e31:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e32:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e37:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e3c:	89 d1                	mov    %edx,%ecx
+  800e3e:	89 d3                	mov    %edx,%ebx
+  800e40:	89 d7                	mov    %edx,%edi
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	8d 35 4d 0e 80 00    	lea    0x800e4d,%esi
+  800e4b:	0f 34                	sysenter
+  800e4d:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+
+00800e53 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e53:	55                   	push   %ebp
+  800e54:	89 e5                	mov    %esp,%ebp
+  800e56:	57                   	push   %edi
+  800e57:	56                   	push   %esi
+  800e58:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e59:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e63:	89 d1                	mov    %edx,%ecx
+  800e65:	89 d3                	mov    %edx,%ebx
+  800e67:	89 d7                	mov    %edx,%edi
+  800e69:	89 d6                	mov    %edx,%esi
+  800e6b:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e6d:	5b                   	pop    %ebx
+  800e6e:	5e                   	pop    %esi
+  800e6f:	5f                   	pop    %edi
+  800e70:	5d                   	pop    %ebp
+  800e71:	c3                   	ret
+
+00800e72 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e72:	55                   	push   %ebp
+  800e73:	89 e5                	mov    %esp,%ebp
+  800e75:	57                   	push   %edi
+  800e76:	56                   	push   %esi
+  800e77:	53                   	push   %ebx
+  800e78:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e81:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e86:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e8b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8e:	55                   	push   %ebp
+  800e8f:	89 e5                	mov    %esp,%ebp
+  800e91:	8d 35 99 0e 80 00    	lea    0x800e99,%esi
+  800e97:	0f 34                	sysenter
+  800e99:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e9a:	85 c0                	test   %eax,%eax
+  800e9c:	7f 08                	jg     800ea6 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800e9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea1:	5b                   	pop    %ebx
+  800ea2:	5e                   	pop    %esi
+  800ea3:	5f                   	pop    %edi
+  800ea4:	5d                   	pop    %ebp
+  800ea5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea6:	83 ec 0c             	sub    $0xc,%esp
+  800ea9:	50                   	push   %eax
+  800eaa:	6a 04                	push   $0x4
+  800eac:	68 07 41 80 00       	push   $0x804107
+  800eb1:	6a 3d                	push   $0x3d
+  800eb3:	68 24 41 80 00       	push   $0x804124
+  800eb8:	e8 e0 f4 ff ff       	call   80039d <_panic>
+
+00800ebd <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ebd:	55                   	push   %ebp
+  800ebe:	89 e5                	mov    %esp,%ebp
+  800ec0:	57                   	push   %edi
+  800ec1:	56                   	push   %esi
+  800ec2:	53                   	push   %ebx
+  800ec3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ec6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecc:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ed1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ed4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ed7:	8b 75 18             	mov    0x18(%ebp),%esi
+  800eda:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800edc:	85 c0                	test   %eax,%eax
+  800ede:	7f 08                	jg     800ee8 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ee0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee3:	5b                   	pop    %ebx
+  800ee4:	5e                   	pop    %esi
+  800ee5:	5f                   	pop    %edi
+  800ee6:	5d                   	pop    %ebp
+  800ee7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee8:	83 ec 0c             	sub    $0xc,%esp
+  800eeb:	50                   	push   %eax
+  800eec:	6a 05                	push   $0x5
+  800eee:	68 07 41 80 00       	push   $0x804107
+  800ef3:	6a 23                	push   $0x23
+  800ef5:	68 24 41 80 00       	push   $0x804124
+  800efa:	e8 9e f4 ff ff       	call   80039d <_panic>
+
+00800eff <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800eff:	55                   	push   %ebp
+  800f00:	89 e5                	mov    %esp,%ebp
+  800f02:	57                   	push   %edi
+  800f03:	56                   	push   %esi
+  800f04:	53                   	push   %ebx
+  800f05:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f13:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f18:	89 df                	mov    %ebx,%edi
+  800f1a:	55                   	push   %ebp
+  800f1b:	89 e5                	mov    %esp,%ebp
+  800f1d:	8d 35 25 0f 80 00    	lea    0x800f25,%esi
+  800f23:	0f 34                	sysenter
+  800f25:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f26:	85 c0                	test   %eax,%eax
+  800f28:	7f 08                	jg     800f32 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800f2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2d:	5b                   	pop    %ebx
+  800f2e:	5e                   	pop    %esi
+  800f2f:	5f                   	pop    %edi
+  800f30:	5d                   	pop    %ebp
+  800f31:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f32:	83 ec 0c             	sub    $0xc,%esp
+  800f35:	50                   	push   %eax
+  800f36:	6a 06                	push   $0x6
+  800f38:	68 07 41 80 00       	push   $0x804107
+  800f3d:	6a 3d                	push   $0x3d
+  800f3f:	68 24 41 80 00       	push   $0x804124
+  800f44:	e8 54 f4 ff ff       	call   80039d <_panic>
+
+00800f49 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f49:	55                   	push   %ebp
+  800f4a:	89 e5                	mov    %esp,%ebp
+  800f4c:	57                   	push   %edi
+  800f4d:	56                   	push   %esi
+  800f4e:	53                   	push   %ebx
+  800f4f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f62:	89 df                	mov    %ebx,%edi
+  800f64:	55                   	push   %ebp
+  800f65:	89 e5                	mov    %esp,%ebp
+  800f67:	8d 35 6f 0f 80 00    	lea    0x800f6f,%esi
+  800f6d:	0f 34                	sysenter
+  800f6f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f70:	85 c0                	test   %eax,%eax
+  800f72:	7f 08                	jg     800f7c <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800f74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f77:	5b                   	pop    %ebx
+  800f78:	5e                   	pop    %esi
+  800f79:	5f                   	pop    %edi
+  800f7a:	5d                   	pop    %ebp
+  800f7b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f7c:	83 ec 0c             	sub    $0xc,%esp
+  800f7f:	50                   	push   %eax
+  800f80:	6a 08                	push   $0x8
+  800f82:	68 07 41 80 00       	push   $0x804107
+  800f87:	6a 3d                	push   $0x3d
+  800f89:	68 24 41 80 00       	push   $0x804124
+  800f8e:	e8 0a f4 ff ff       	call   80039d <_panic>
+
+00800f93 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f93:	55                   	push   %ebp
+  800f94:	89 e5                	mov    %esp,%ebp
+  800f96:	57                   	push   %edi
+  800f97:	56                   	push   %esi
+  800f98:	53                   	push   %ebx
+  800f99:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa7:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fac:	89 df                	mov    %ebx,%edi
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  800fb1:	8d 35 b9 0f 80 00    	lea    0x800fb9,%esi
+  800fb7:	0f 34                	sysenter
+  800fb9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800fba:	85 c0                	test   %eax,%eax
+  800fbc:	7f 08                	jg     800fc6 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800fbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc1:	5b                   	pop    %ebx
+  800fc2:	5e                   	pop    %esi
+  800fc3:	5f                   	pop    %edi
+  800fc4:	5d                   	pop    %ebp
+  800fc5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc6:	83 ec 0c             	sub    $0xc,%esp
+  800fc9:	50                   	push   %eax
+  800fca:	6a 09                	push   $0x9
+  800fcc:	68 07 41 80 00       	push   $0x804107
+  800fd1:	6a 3d                	push   $0x3d
+  800fd3:	68 24 41 80 00       	push   $0x804124
+  800fd8:	e8 c0 f3 ff ff       	call   80039d <_panic>
+
+00800fdd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	57                   	push   %edi
+  800fe1:	56                   	push   %esi
+  800fe2:	53                   	push   %ebx
+  800fe3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800fe6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800feb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ff6:	89 df                	mov    %ebx,%edi
+  800ff8:	55                   	push   %ebp
+  800ff9:	89 e5                	mov    %esp,%ebp
+  800ffb:	8d 35 03 10 80 00    	lea    0x801003,%esi
+  801001:	0f 34                	sysenter
+  801003:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801004:	85 c0                	test   %eax,%eax
+  801006:	7f 08                	jg     801010 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  801008:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100b:	5b                   	pop    %ebx
+  80100c:	5e                   	pop    %esi
+  80100d:	5f                   	pop    %edi
+  80100e:	5d                   	pop    %ebp
+  80100f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801010:	83 ec 0c             	sub    $0xc,%esp
+  801013:	50                   	push   %eax
+  801014:	6a 0a                	push   $0xa
+  801016:	68 07 41 80 00       	push   $0x804107
+  80101b:	6a 3d                	push   $0x3d
+  80101d:	68 24 41 80 00       	push   $0x804124
+  801022:	e8 76 f3 ff ff       	call   80039d <_panic>
+
+00801027 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	57                   	push   %edi
+  80102b:	56                   	push   %esi
+  80102c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80102d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801030:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801033:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801038:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80103b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80103e:	55                   	push   %ebp
+  80103f:	89 e5                	mov    %esp,%ebp
+  801041:	8d 35 49 10 80 00    	lea    0x801049,%esi
+  801047:	0f 34                	sysenter
+  801049:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  80104a:	5b                   	pop    %ebx
+  80104b:	5e                   	pop    %esi
+  80104c:	5f                   	pop    %edi
+  80104d:	5d                   	pop    %ebp
+  80104e:	c3                   	ret
+
+0080104f <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  80104f:	55                   	push   %ebp
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	57                   	push   %edi
+  801053:	56                   	push   %esi
+  801054:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801055:	8b 55 08             	mov    0x8(%ebp),%edx
+  801058:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801060:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801063:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801066:	55                   	push   %ebp
+  801067:	89 e5                	mov    %esp,%ebp
+  801069:	8d 35 71 10 80 00    	lea    0x801071,%esi
+  80106f:	0f 34                	sysenter
+  801071:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  801072:	5b                   	pop    %ebx
+  801073:	5e                   	pop    %esi
+  801074:	5f                   	pop    %edi
+  801075:	5d                   	pop    %ebp
+  801076:	c3                   	ret
+
+00801077 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  801077:	55                   	push   %ebp
+  801078:	89 e5                	mov    %esp,%ebp
+  80107a:	57                   	push   %edi
+  80107b:	56                   	push   %esi
+  80107c:	53                   	push   %ebx
+  80107d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801080:	be 00 00 00 00       	mov    $0x0,%esi
+  801085:	8b 55 08             	mov    0x8(%ebp),%edx
+  801088:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801090:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801093:	89 f7                	mov    %esi,%edi
+  801095:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801097:	85 c0                	test   %eax,%eax
+  801099:	7f 08                	jg     8010a3 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  80109b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109e:	5b                   	pop    %ebx
+  80109f:	5e                   	pop    %esi
+  8010a0:	5f                   	pop    %edi
+  8010a1:	5d                   	pop    %ebp
+  8010a2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a3:	83 ec 0c             	sub    $0xc,%esp
+  8010a6:	50                   	push   %eax
+  8010a7:	6a 0d                	push   $0xd
+  8010a9:	68 07 41 80 00       	push   $0x804107
+  8010ae:	6a 23                	push   $0x23
+  8010b0:	68 24 41 80 00       	push   $0x804124
+  8010b5:	e8 e3 f2 ff ff       	call   80039d <_panic>
+
+008010ba <sys_ipc_recv>:
+{
+  8010ba:	55                   	push   %ebp
+  8010bb:	89 e5                	mov    %esp,%ebp
+  8010bd:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  8010c0:	6a 00                	push   $0x0
+  8010c2:	6a 01                	push   $0x1
+  8010c4:	ff 75 08             	push   0x8(%ebp)
+  8010c7:	e8 ab ff ff ff       	call   801077 <sys_ipc_recvv>
+}
+  8010cc:	c9                   	leave
+  8010cd:	c3                   	ret
+
+008010ce <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  8010ce:	55                   	push   %ebp
+  8010cf:	89 e5                	mov    %esp,%ebp
+  8010d1:	57                   	push   %edi
+  8010d2:	56                   	push   %esi
+  8010d3:	53                   	push   %ebx
+  8010d4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010e7:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8010ea:	89 de                	mov    %ebx,%esi
+  8010ec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ee:	85 c0                	test   %eax,%eax
+  8010f0:	7f 08                	jg     8010fa <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  8010f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f5:	5b                   	pop    %ebx
+  8010f6:	5e                   	pop    %esi
+  8010f7:	5f                   	pop    %edi
+  8010f8:	5d                   	pop    %ebp
+  8010f9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010fa:	83 ec 0c             	sub    $0xc,%esp
+  8010fd:	50                   	push   %eax
+  8010fe:	6a 0d                	push   $0xd
+  801100:	68 07 41 80 00       	push   $0x804107
+  801105:	6a 23                	push   $0x23
+  801107:	68 24 41 80 00       	push   $0x804124
+  80110c:	e8 8c f2 ff ff       	call   80039d <_panic>
+
+00801111 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801111:	55                   	push   %ebp
+  801112:	89 e5                	mov    %esp,%ebp
+  801114:	57                   	push   %edi
+  801115:	56                   	push   %esi
+  801116:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801117:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801121:	89 d1                	mov    %edx,%ecx
+  801123:	89 d3                	mov    %edx,%ebx
+  801125:	89 d7                	mov    %edx,%edi
+  801127:	55                   	push   %ebp
+  801128:	89 e5                	mov    %esp,%ebp
+  80112a:	8d 35 32 11 80 00    	lea    0x801132,%esi
+  801130:	0f 34                	sysenter
+  801132:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  801133:	5b                   	pop    %ebx
+  801134:	5e                   	pop    %esi
+  801135:	5f                   	pop    %edi
+  801136:	5d                   	pop    %ebp
+  801137:	c3                   	ret
+
+00801138 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  801138:	55                   	push   %ebp
+  801139:	89 e5                	mov    %esp,%ebp
+  80113b:	57                   	push   %edi
+  80113c:	56                   	push   %esi
+  80113d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80113e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801143:	8b 55 08             	mov    0x8(%ebp),%edx
+  801146:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801149:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80114e:	89 df                	mov    %ebx,%edi
+  801150:	55                   	push   %ebp
+  801151:	89 e5                	mov    %esp,%ebp
+  801153:	8d 35 5b 11 80 00    	lea    0x80115b,%esi
+  801159:	0f 34                	sysenter
+  80115b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  80115c:	5b                   	pop    %ebx
+  80115d:	5e                   	pop    %esi
+  80115e:	5f                   	pop    %edi
+  80115f:	5d                   	pop    %ebp
+  801160:	c3                   	ret
+
+00801161 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  801161:	55                   	push   %ebp
+  801162:	89 e5                	mov    %esp,%ebp
+  801164:	57                   	push   %edi
+  801165:	56                   	push   %esi
+  801166:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801167:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80116c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801174:	89 cb                	mov    %ecx,%ebx
+  801176:	89 cf                	mov    %ecx,%edi
+  801178:	55                   	push   %ebp
+  801179:	89 e5                	mov    %esp,%ebp
+  80117b:	8d 35 83 11 80 00    	lea    0x801183,%esi
+  801181:	0f 34                	sysenter
+  801183:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  801184:	5b                   	pop    %ebx
+  801185:	5e                   	pop    %esi
+  801186:	5f                   	pop    %edi
+  801187:	5d                   	pop    %ebp
+  801188:	c3                   	ret
+
+00801189 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	57                   	push   %edi
+  80118d:	56                   	push   %esi
+  80118e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80118f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801194:	8b 55 08             	mov    0x8(%ebp),%edx
+  801197:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80119f:	89 df                	mov    %ebx,%edi
+  8011a1:	55                   	push   %ebp
+  8011a2:	89 e5                	mov    %esp,%ebp
+  8011a4:	8d 35 ac 11 80 00    	lea    0x8011ac,%esi
+  8011aa:	0f 34                	sysenter
+  8011ac:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8011ad:	5b                   	pop    %ebx
+  8011ae:	5e                   	pop    %esi
+  8011af:	5f                   	pop    %edi
+  8011b0:	5d                   	pop    %ebp
+  8011b1:	c3                   	ret
+
+008011b2 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8011b2:	55                   	push   %ebp
+  8011b3:	89 e5                	mov    %esp,%ebp
+  8011b5:	57                   	push   %edi
+  8011b6:	56                   	push   %esi
+  8011b7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c3:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011c8:	89 df                	mov    %ebx,%edi
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	8d 35 d5 11 80 00    	lea    0x8011d5,%esi
+  8011d3:	0f 34                	sysenter
+  8011d5:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  8011d6:	5b                   	pop    %ebx
+  8011d7:	5e                   	pop    %esi
+  8011d8:	5f                   	pop    %edi
+  8011d9:	5d                   	pop    %ebp
+  8011da:	c3                   	ret
+
+008011db <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	57                   	push   %edi
+  8011df:	56                   	push   %esi
+  8011e0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ef:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  8011f5:	8d 35 fd 11 80 00    	lea    0x8011fd,%esi
+  8011fb:	0f 34                	sysenter
+  8011fd:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  8011fe:	5b                   	pop    %ebx
+  8011ff:	5e                   	pop    %esi
+  801200:	5f                   	pop    %edi
+  801201:	5d                   	pop    %ebp
+  801202:	c3                   	ret
+
+00801203 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801203:	55                   	push   %ebp
+  801204:	89 e5                	mov    %esp,%ebp
+  801206:	57                   	push   %edi
+  801207:	56                   	push   %esi
+  801208:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801209:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80120e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801211:	b8 11 00 00 00       	mov    $0x11,%eax
+  801216:	89 cb                	mov    %ecx,%ebx
+  801218:	89 cf                	mov    %ecx,%edi
+  80121a:	89 ce                	mov    %ecx,%esi
+  80121c:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  80121e:	5b                   	pop    %ebx
+  80121f:	5e                   	pop    %esi
+  801220:	5f                   	pop    %edi
+  801221:	5d                   	pop    %ebp
+  801222:	c3                   	ret
+
+00801223 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  801223:	55                   	push   %ebp
+  801224:	89 e5                	mov    %esp,%ebp
+  801226:	57                   	push   %edi
+  801227:	56                   	push   %esi
+  801228:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801229:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80122e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801231:	b8 15 00 00 00       	mov    $0x15,%eax
+  801236:	89 cb                	mov    %ecx,%ebx
+  801238:	89 cf                	mov    %ecx,%edi
+  80123a:	55                   	push   %ebp
+  80123b:	89 e5                	mov    %esp,%ebp
+  80123d:	8d 35 45 12 80 00    	lea    0x801245,%esi
+  801243:	0f 34                	sysenter
+  801245:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  801246:	5b                   	pop    %ebx
+  801247:	5e                   	pop    %esi
+  801248:	5f                   	pop    %edi
+  801249:	5d                   	pop    %ebp
+  80124a:	c3                   	ret
+
+0080124b <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	57                   	push   %edi
+  80124f:	56                   	push   %esi
+  801250:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801251:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801256:	8b 55 08             	mov    0x8(%ebp),%edx
+  801259:	b8 16 00 00 00       	mov    $0x16,%eax
+  80125e:	89 cb                	mov    %ecx,%ebx
+  801260:	89 cf                	mov    %ecx,%edi
+  801262:	55                   	push   %ebp
+  801263:	89 e5                	mov    %esp,%ebp
+  801265:	8d 35 6d 12 80 00    	lea    0x80126d,%esi
+  80126b:	0f 34                	sysenter
+  80126d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  80126e:	5b                   	pop    %ebx
+  80126f:	5e                   	pop    %esi
+  801270:	5f                   	pop    %edi
+  801271:	5d                   	pop    %ebp
+  801272:	c3                   	ret
+
+00801273 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  801273:	55                   	push   %ebp
+  801274:	89 e5                	mov    %esp,%ebp
+  801276:	8b 55 08             	mov    0x8(%ebp),%edx
+  801279:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127c:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  80127f:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  801281:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  801284:	83 3a 01             	cmpl   $0x1,(%edx)
+  801287:	7e 09                	jle    801292 <argstart+0x1f>
+  801289:	ba 88 42 80 00       	mov    $0x804288,%edx
+  80128e:	85 c9                	test   %ecx,%ecx
+  801290:	75 05                	jne    801297 <argstart+0x24>
+  801292:	ba 00 00 00 00       	mov    $0x0,%edx
+  801297:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  80129a:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  8012a1:	5d                   	pop    %ebp
+  8012a2:	c3                   	ret
+
+008012a3 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  8012a3:	55                   	push   %ebp
+  8012a4:	89 e5                	mov    %esp,%ebp
+  8012a6:	53                   	push   %ebx
+  8012a7:	83 ec 04             	sub    $0x4,%esp
+  8012aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  8012ad:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  8012b4:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012b7:	85 c0                	test   %eax,%eax
+  8012b9:	74 74                	je     80132f <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  8012bb:	80 38 00             	cmpb   $0x0,(%eax)
+  8012be:	75 48                	jne    801308 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  8012c0:	8b 0b                	mov    (%ebx),%ecx
+  8012c2:	83 39 01             	cmpl   $0x1,(%ecx)
+  8012c5:	74 5a                	je     801321 <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  8012c7:	8b 53 04             	mov    0x4(%ebx),%edx
+  8012ca:	8b 42 04             	mov    0x4(%edx),%eax
+  8012cd:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8012d0:	75 4f                	jne    801321 <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  8012d2:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8012d6:	74 49                	je     801321 <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  8012d8:	83 c0 01             	add    $0x1,%eax
+  8012db:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8012de:	83 ec 04             	sub    $0x4,%esp
+  8012e1:	8b 01                	mov    (%ecx),%eax
+  8012e3:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  8012ea:	50                   	push   %eax
+  8012eb:	8d 42 08             	lea    0x8(%edx),%eax
+  8012ee:	50                   	push   %eax
+  8012ef:	83 c2 04             	add    $0x4,%edx
+  8012f2:	52                   	push   %edx
+  8012f3:	e8 f4 f8 ff ff       	call   800bec <memmove>
+		(*args->argc)--;
+  8012f8:	8b 03                	mov    (%ebx),%eax
+  8012fa:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  8012fd:	8b 43 08             	mov    0x8(%ebx),%eax
+  801300:	83 c4 10             	add    $0x10,%esp
+  801303:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801306:	74 13                	je     80131b <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  801308:	8b 43 08             	mov    0x8(%ebx),%eax
+  80130b:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  80130e:	83 c0 01             	add    $0x1,%eax
+  801311:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  801314:	89 d0                	mov    %edx,%eax
+  801316:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801319:	c9                   	leave
+  80131a:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  80131b:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  80131f:	75 e7                	jne    801308 <argnext+0x65>
+	args->curarg = 0;
+  801321:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  801328:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80132d:	eb e5                	jmp    801314 <argnext+0x71>
+		return -1;
+  80132f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801334:	eb de                	jmp    801314 <argnext+0x71>
+
+00801336 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  801336:	55                   	push   %ebp
+  801337:	89 e5                	mov    %esp,%ebp
+  801339:	53                   	push   %ebx
+  80133a:	83 ec 04             	sub    $0x4,%esp
+  80133d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  801340:	8b 43 08             	mov    0x8(%ebx),%eax
+  801343:	85 c0                	test   %eax,%eax
+  801345:	74 12                	je     801359 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  801347:	80 38 00             	cmpb   $0x0,(%eax)
+  80134a:	74 12                	je     80135e <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  80134c:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  80134f:	c7 43 08 88 42 80 00 	movl   $0x804288,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  801356:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  801359:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80135c:	c9                   	leave
+  80135d:	c3                   	ret
+	} else if (*args->argc > 1) {
+  80135e:	8b 13                	mov    (%ebx),%edx
+  801360:	83 3a 01             	cmpl   $0x1,(%edx)
+  801363:	7f 10                	jg     801375 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  801365:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  80136c:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801373:	eb e1                	jmp    801356 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  801375:	8b 43 04             	mov    0x4(%ebx),%eax
+  801378:	8b 48 04             	mov    0x4(%eax),%ecx
+  80137b:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  80137e:	83 ec 04             	sub    $0x4,%esp
+  801381:	8b 12                	mov    (%edx),%edx
+  801383:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  80138a:	52                   	push   %edx
+  80138b:	8d 50 08             	lea    0x8(%eax),%edx
+  80138e:	52                   	push   %edx
+  80138f:	83 c0 04             	add    $0x4,%eax
+  801392:	50                   	push   %eax
+  801393:	e8 54 f8 ff ff       	call   800bec <memmove>
+		(*args->argc)--;
+  801398:	8b 03                	mov    (%ebx),%eax
+  80139a:	83 28 01             	subl   $0x1,(%eax)
+  80139d:	83 c4 10             	add    $0x10,%esp
+  8013a0:	eb b4                	jmp    801356 <argnextvalue+0x20>
+
+008013a2 <argvalue>:
+{
+  8013a2:	55                   	push   %ebp
+  8013a3:	89 e5                	mov    %esp,%ebp
+  8013a5:	83 ec 08             	sub    $0x8,%esp
+  8013a8:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8013ab:	8b 42 0c             	mov    0xc(%edx),%eax
+  8013ae:	85 c0                	test   %eax,%eax
+  8013b0:	74 02                	je     8013b4 <argvalue+0x12>
+}
+  8013b2:	c9                   	leave
+  8013b3:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8013b4:	83 ec 0c             	sub    $0xc,%esp
+  8013b7:	52                   	push   %edx
+  8013b8:	e8 79 ff ff ff       	call   801336 <argnextvalue>
+  8013bd:	83 c4 10             	add    $0x10,%esp
+  8013c0:	eb f0                	jmp    8013b2 <argvalue+0x10>
+
+008013c2 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8013c2:	55                   	push   %ebp
+  8013c3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013c8:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013cd:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013d0:	5d                   	pop    %ebp
+  8013d1:	c3                   	ret
+
+008013d2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013d2:	55                   	push   %ebp
+  8013d3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013d8:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8013dd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8013e2:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013e7:	5d                   	pop    %ebp
+  8013e8:	c3                   	ret
+
+008013e9 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013e9:	55                   	push   %ebp
+  8013ea:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8013ec:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8013f1:	eb 02                	jmp    8013f5 <fd_alloc+0xc>
+  8013f3:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013f5:	89 c2                	mov    %eax,%edx
+  8013f7:	c1 ea 16             	shr    $0x16,%edx
+  8013fa:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801401:	f6 c2 01             	test   $0x1,%dl
+  801404:	74 2b                	je     801431 <fd_alloc+0x48>
+  801406:	89 c2                	mov    %eax,%edx
+  801408:	c1 ea 0c             	shr    $0xc,%edx
+  80140b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801412:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801418:	f6 c1 01             	test   $0x1,%cl
+  80141b:	74 14                	je     801431 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80141d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801423:	75 ce                	jne    8013f3 <fd_alloc+0xa>
+  801425:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80142a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80142f:	eb 05                	jmp    801436 <fd_alloc+0x4d>
+			return 0;
+  801431:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801436:	8b 55 08             	mov    0x8(%ebp),%edx
+  801439:	89 02                	mov    %eax,(%edx)
+}
+  80143b:	89 c8                	mov    %ecx,%eax
+  80143d:	5d                   	pop    %ebp
+  80143e:	c3                   	ret
+
+0080143f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80143f:	55                   	push   %ebp
+  801440:	89 e5                	mov    %esp,%ebp
+  801442:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801445:	83 f8 1f             	cmp    $0x1f,%eax
+  801448:	77 30                	ja     80147a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80144a:	c1 e0 0c             	shl    $0xc,%eax
+  80144d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801452:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801458:	f6 c2 01             	test   $0x1,%dl
+  80145b:	74 24                	je     801481 <fd_lookup+0x42>
+  80145d:	89 c2                	mov    %eax,%edx
+  80145f:	c1 ea 0c             	shr    $0xc,%edx
+  801462:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801469:	f6 c2 01             	test   $0x1,%dl
+  80146c:	74 1a                	je     801488 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80146e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801471:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801473:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801478:	5d                   	pop    %ebp
+  801479:	c3                   	ret
+		return -E_INVAL;
+  80147a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80147f:	eb f7                	jmp    801478 <fd_lookup+0x39>
+		return -E_INVAL;
+  801481:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801486:	eb f0                	jmp    801478 <fd_lookup+0x39>
+  801488:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80148d:	eb e9                	jmp    801478 <fd_lookup+0x39>
+
+0080148f <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80148f:	55                   	push   %ebp
+  801490:	89 e5                	mov    %esp,%ebp
+  801492:	53                   	push   %ebx
+  801493:	83 ec 04             	sub    $0x4,%esp
+  801496:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80149e:	eb 03                	jmp    8014a3 <dev_lookup+0x14>
+  8014a0:	83 c0 01             	add    $0x1,%eax
+  8014a3:	8b 1c 85 b0 41 80 00 	mov    0x8041b0(,%eax,4),%ebx
+  8014aa:	85 db                	test   %ebx,%ebx
+  8014ac:	74 0b                	je     8014b9 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8014ae:	39 13                	cmp    %edx,(%ebx)
+  8014b0:	75 ee                	jne    8014a0 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8014b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b7:	eb 1f                	jmp    8014d8 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8014b9:	a1 00 60 80 00       	mov    0x806000,%eax
+  8014be:	8b 40 48             	mov    0x48(%eax),%eax
+  8014c1:	83 ec 04             	sub    $0x4,%esp
+  8014c4:	52                   	push   %edx
+  8014c5:	50                   	push   %eax
+  8014c6:	68 34 41 80 00       	push   $0x804134
+  8014cb:	e8 a8 ef ff ff       	call   800478 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8014d0:	83 c4 10             	add    $0x10,%esp
+  8014d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8014d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014db:	89 1a                	mov    %ebx,(%edx)
+}
+  8014dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014e0:	c9                   	leave
+  8014e1:	c3                   	ret
+
+008014e2 <fd_close>:
+{
+  8014e2:	55                   	push   %ebp
+  8014e3:	89 e5                	mov    %esp,%ebp
+  8014e5:	57                   	push   %edi
+  8014e6:	56                   	push   %esi
+  8014e7:	53                   	push   %ebx
+  8014e8:	83 ec 24             	sub    $0x24,%esp
+  8014eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014ee:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014f1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014f4:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014f5:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014fb:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014fe:	50                   	push   %eax
+  8014ff:	e8 3b ff ff ff       	call   80143f <fd_lookup>
+  801504:	89 c3                	mov    %eax,%ebx
+  801506:	83 c4 10             	add    $0x10,%esp
+  801509:	85 c0                	test   %eax,%eax
+  80150b:	78 05                	js     801512 <fd_close+0x30>
+	    || fd != fd2)
+  80150d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801510:	74 16                	je     801528 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801512:	89 f8                	mov    %edi,%eax
+  801514:	84 c0                	test   %al,%al
+  801516:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80151e:	89 d8                	mov    %ebx,%eax
+  801520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801523:	5b                   	pop    %ebx
+  801524:	5e                   	pop    %esi
+  801525:	5f                   	pop    %edi
+  801526:	5d                   	pop    %ebp
+  801527:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801528:	83 ec 08             	sub    $0x8,%esp
+  80152b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80152e:	50                   	push   %eax
+  80152f:	ff 36                	push   (%esi)
+  801531:	e8 59 ff ff ff       	call   80148f <dev_lookup>
+  801536:	89 c3                	mov    %eax,%ebx
+  801538:	83 c4 10             	add    $0x10,%esp
+  80153b:	85 c0                	test   %eax,%eax
+  80153d:	78 1a                	js     801559 <fd_close+0x77>
+		if (dev->dev_close)
+  80153f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801542:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801545:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80154a:	85 c0                	test   %eax,%eax
+  80154c:	74 0b                	je     801559 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80154e:	83 ec 0c             	sub    $0xc,%esp
+  801551:	56                   	push   %esi
+  801552:	ff d0                	call   *%eax
+  801554:	89 c3                	mov    %eax,%ebx
+  801556:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801559:	83 ec 08             	sub    $0x8,%esp
+  80155c:	56                   	push   %esi
+  80155d:	6a 00                	push   $0x0
+  80155f:	e8 9b f9 ff ff       	call   800eff <sys_page_unmap>
+	return r;
+  801564:	83 c4 10             	add    $0x10,%esp
+  801567:	eb b5                	jmp    80151e <fd_close+0x3c>
+
+00801569 <close>:
+
+int
+close(int fdnum)
+{
+  801569:	55                   	push   %ebp
+  80156a:	89 e5                	mov    %esp,%ebp
+  80156c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80156f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801572:	50                   	push   %eax
+  801573:	ff 75 08             	push   0x8(%ebp)
+  801576:	e8 c4 fe ff ff       	call   80143f <fd_lookup>
+  80157b:	83 c4 10             	add    $0x10,%esp
+  80157e:	85 c0                	test   %eax,%eax
+  801580:	79 02                	jns    801584 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801582:	c9                   	leave
+  801583:	c3                   	ret
+		return fd_close(fd, 1);
+  801584:	83 ec 08             	sub    $0x8,%esp
+  801587:	6a 01                	push   $0x1
+  801589:	ff 75 f4             	push   -0xc(%ebp)
+  80158c:	e8 51 ff ff ff       	call   8014e2 <fd_close>
+  801591:	83 c4 10             	add    $0x10,%esp
+  801594:	eb ec                	jmp    801582 <close+0x19>
+
+00801596 <close_all>:
+
+void
+close_all(void)
+{
+  801596:	55                   	push   %ebp
+  801597:	89 e5                	mov    %esp,%ebp
+  801599:	53                   	push   %ebx
+  80159a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80159d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8015a2:	83 ec 0c             	sub    $0xc,%esp
+  8015a5:	53                   	push   %ebx
+  8015a6:	e8 be ff ff ff       	call   801569 <close>
+	for (i = 0; i < MAXFD; i++)
+  8015ab:	83 c3 01             	add    $0x1,%ebx
+  8015ae:	83 c4 10             	add    $0x10,%esp
+  8015b1:	83 fb 20             	cmp    $0x20,%ebx
+  8015b4:	75 ec                	jne    8015a2 <close_all+0xc>
+}
+  8015b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015b9:	c9                   	leave
+  8015ba:	c3                   	ret
+
+008015bb <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8015bb:	55                   	push   %ebp
+  8015bc:	89 e5                	mov    %esp,%ebp
+  8015be:	57                   	push   %edi
+  8015bf:	56                   	push   %esi
+  8015c0:	53                   	push   %ebx
+  8015c1:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8015c4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015c7:	50                   	push   %eax
+  8015c8:	ff 75 08             	push   0x8(%ebp)
+  8015cb:	e8 6f fe ff ff       	call   80143f <fd_lookup>
+  8015d0:	89 c3                	mov    %eax,%ebx
+  8015d2:	83 c4 10             	add    $0x10,%esp
+  8015d5:	85 c0                	test   %eax,%eax
+  8015d7:	78 7f                	js     801658 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8015d9:	83 ec 0c             	sub    $0xc,%esp
+  8015dc:	ff 75 0c             	push   0xc(%ebp)
+  8015df:	e8 85 ff ff ff       	call   801569 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8015e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8015e7:	c1 e6 0c             	shl    $0xc,%esi
+  8015ea:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8015f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015f3:	89 3c 24             	mov    %edi,(%esp)
+  8015f6:	e8 d7 fd ff ff       	call   8013d2 <fd2data>
+  8015fb:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8015fd:	89 34 24             	mov    %esi,(%esp)
+  801600:	e8 cd fd ff ff       	call   8013d2 <fd2data>
+  801605:	83 c4 10             	add    $0x10,%esp
+  801608:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80160b:	89 d8                	mov    %ebx,%eax
+  80160d:	c1 e8 16             	shr    $0x16,%eax
+  801610:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801617:	a8 01                	test   $0x1,%al
+  801619:	74 11                	je     80162c <dup+0x71>
+  80161b:	89 d8                	mov    %ebx,%eax
+  80161d:	c1 e8 0c             	shr    $0xc,%eax
+  801620:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801627:	f6 c2 01             	test   $0x1,%dl
+  80162a:	75 36                	jne    801662 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80162c:	89 f8                	mov    %edi,%eax
+  80162e:	c1 e8 0c             	shr    $0xc,%eax
+  801631:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801638:	83 ec 0c             	sub    $0xc,%esp
+  80163b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801640:	50                   	push   %eax
+  801641:	56                   	push   %esi
+  801642:	6a 00                	push   $0x0
+  801644:	57                   	push   %edi
+  801645:	6a 00                	push   $0x0
+  801647:	e8 71 f8 ff ff       	call   800ebd <sys_page_map>
+  80164c:	89 c3                	mov    %eax,%ebx
+  80164e:	83 c4 20             	add    $0x20,%esp
+  801651:	85 c0                	test   %eax,%eax
+  801653:	78 33                	js     801688 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801655:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801658:	89 d8                	mov    %ebx,%eax
+  80165a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80165d:	5b                   	pop    %ebx
+  80165e:	5e                   	pop    %esi
+  80165f:	5f                   	pop    %edi
+  801660:	5d                   	pop    %ebp
+  801661:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801662:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801669:	83 ec 0c             	sub    $0xc,%esp
+  80166c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801671:	50                   	push   %eax
+  801672:	ff 75 d4             	push   -0x2c(%ebp)
+  801675:	6a 00                	push   $0x0
+  801677:	53                   	push   %ebx
+  801678:	6a 00                	push   $0x0
+  80167a:	e8 3e f8 ff ff       	call   800ebd <sys_page_map>
+  80167f:	89 c3                	mov    %eax,%ebx
+  801681:	83 c4 20             	add    $0x20,%esp
+  801684:	85 c0                	test   %eax,%eax
+  801686:	79 a4                	jns    80162c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801688:	83 ec 08             	sub    $0x8,%esp
+  80168b:	56                   	push   %esi
+  80168c:	6a 00                	push   $0x0
+  80168e:	e8 6c f8 ff ff       	call   800eff <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801693:	83 c4 08             	add    $0x8,%esp
+  801696:	ff 75 d4             	push   -0x2c(%ebp)
+  801699:	6a 00                	push   $0x0
+  80169b:	e8 5f f8 ff ff       	call   800eff <sys_page_unmap>
+	return r;
+  8016a0:	83 c4 10             	add    $0x10,%esp
+  8016a3:	eb b3                	jmp    801658 <dup+0x9d>
+
+008016a5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016a5:	55                   	push   %ebp
+  8016a6:	89 e5                	mov    %esp,%ebp
+  8016a8:	56                   	push   %esi
+  8016a9:	53                   	push   %ebx
+  8016aa:	83 ec 18             	sub    $0x18,%esp
+  8016ad:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016b0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016b3:	50                   	push   %eax
+  8016b4:	56                   	push   %esi
+  8016b5:	e8 85 fd ff ff       	call   80143f <fd_lookup>
+  8016ba:	83 c4 10             	add    $0x10,%esp
+  8016bd:	85 c0                	test   %eax,%eax
+  8016bf:	78 3c                	js     8016fd <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016c1:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016c4:	83 ec 08             	sub    $0x8,%esp
+  8016c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ca:	50                   	push   %eax
+  8016cb:	ff 33                	push   (%ebx)
+  8016cd:	e8 bd fd ff ff       	call   80148f <dev_lookup>
+  8016d2:	83 c4 10             	add    $0x10,%esp
+  8016d5:	85 c0                	test   %eax,%eax
+  8016d7:	78 24                	js     8016fd <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016d9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016dc:	83 e0 03             	and    $0x3,%eax
+  8016df:	83 f8 01             	cmp    $0x1,%eax
+  8016e2:	74 20                	je     801704 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8016e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e7:	8b 40 08             	mov    0x8(%eax),%eax
+  8016ea:	85 c0                	test   %eax,%eax
+  8016ec:	74 37                	je     801725 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8016ee:	83 ec 04             	sub    $0x4,%esp
+  8016f1:	ff 75 10             	push   0x10(%ebp)
+  8016f4:	ff 75 0c             	push   0xc(%ebp)
+  8016f7:	53                   	push   %ebx
+  8016f8:	ff d0                	call   *%eax
+  8016fa:	83 c4 10             	add    $0x10,%esp
+}
+  8016fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801700:	5b                   	pop    %ebx
+  801701:	5e                   	pop    %esi
+  801702:	5d                   	pop    %ebp
+  801703:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801704:	a1 00 60 80 00       	mov    0x806000,%eax
+  801709:	8b 40 48             	mov    0x48(%eax),%eax
+  80170c:	83 ec 04             	sub    $0x4,%esp
+  80170f:	56                   	push   %esi
+  801710:	50                   	push   %eax
+  801711:	68 75 41 80 00       	push   $0x804175
+  801716:	e8 5d ed ff ff       	call   800478 <cprintf>
+		return -E_INVAL;
+  80171b:	83 c4 10             	add    $0x10,%esp
+  80171e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801723:	eb d8                	jmp    8016fd <read+0x58>
+		return -E_NOT_SUPP;
+  801725:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80172a:	eb d1                	jmp    8016fd <read+0x58>
+
+0080172c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80172c:	55                   	push   %ebp
+  80172d:	89 e5                	mov    %esp,%ebp
+  80172f:	57                   	push   %edi
+  801730:	56                   	push   %esi
+  801731:	53                   	push   %ebx
+  801732:	83 ec 0c             	sub    $0xc,%esp
+  801735:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801738:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80173b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801740:	eb 02                	jmp    801744 <readn+0x18>
+  801742:	01 c3                	add    %eax,%ebx
+  801744:	39 f3                	cmp    %esi,%ebx
+  801746:	73 21                	jae    801769 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801748:	83 ec 04             	sub    $0x4,%esp
+  80174b:	89 f0                	mov    %esi,%eax
+  80174d:	29 d8                	sub    %ebx,%eax
+  80174f:	50                   	push   %eax
+  801750:	89 d8                	mov    %ebx,%eax
+  801752:	03 45 0c             	add    0xc(%ebp),%eax
+  801755:	50                   	push   %eax
+  801756:	57                   	push   %edi
+  801757:	e8 49 ff ff ff       	call   8016a5 <read>
+		if (m < 0)
+  80175c:	83 c4 10             	add    $0x10,%esp
+  80175f:	85 c0                	test   %eax,%eax
+  801761:	78 04                	js     801767 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801763:	75 dd                	jne    801742 <readn+0x16>
+  801765:	eb 02                	jmp    801769 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801767:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801769:	89 d8                	mov    %ebx,%eax
+  80176b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80176e:	5b                   	pop    %ebx
+  80176f:	5e                   	pop    %esi
+  801770:	5f                   	pop    %edi
+  801771:	5d                   	pop    %ebp
+  801772:	c3                   	ret
+
+00801773 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801773:	55                   	push   %ebp
+  801774:	89 e5                	mov    %esp,%ebp
+  801776:	56                   	push   %esi
+  801777:	53                   	push   %ebx
+  801778:	83 ec 18             	sub    $0x18,%esp
+  80177b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80177e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801781:	50                   	push   %eax
+  801782:	53                   	push   %ebx
+  801783:	e8 b7 fc ff ff       	call   80143f <fd_lookup>
+  801788:	83 c4 10             	add    $0x10,%esp
+  80178b:	85 c0                	test   %eax,%eax
+  80178d:	78 37                	js     8017c6 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80178f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801792:	83 ec 08             	sub    $0x8,%esp
+  801795:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801798:	50                   	push   %eax
+  801799:	ff 36                	push   (%esi)
+  80179b:	e8 ef fc ff ff       	call   80148f <dev_lookup>
+  8017a0:	83 c4 10             	add    $0x10,%esp
+  8017a3:	85 c0                	test   %eax,%eax
+  8017a5:	78 1f                	js     8017c6 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017a7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017ab:	74 20                	je     8017cd <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8017ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017b0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017b3:	85 c0                	test   %eax,%eax
+  8017b5:	74 37                	je     8017ee <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8017b7:	83 ec 04             	sub    $0x4,%esp
+  8017ba:	ff 75 10             	push   0x10(%ebp)
+  8017bd:	ff 75 0c             	push   0xc(%ebp)
+  8017c0:	56                   	push   %esi
+  8017c1:	ff d0                	call   *%eax
+  8017c3:	83 c4 10             	add    $0x10,%esp
+}
+  8017c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017c9:	5b                   	pop    %ebx
+  8017ca:	5e                   	pop    %esi
+  8017cb:	5d                   	pop    %ebp
+  8017cc:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017cd:	a1 00 60 80 00       	mov    0x806000,%eax
+  8017d2:	8b 40 48             	mov    0x48(%eax),%eax
+  8017d5:	83 ec 04             	sub    $0x4,%esp
+  8017d8:	53                   	push   %ebx
+  8017d9:	50                   	push   %eax
+  8017da:	68 91 41 80 00       	push   $0x804191
+  8017df:	e8 94 ec ff ff       	call   800478 <cprintf>
+		return -E_INVAL;
+  8017e4:	83 c4 10             	add    $0x10,%esp
+  8017e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ec:	eb d8                	jmp    8017c6 <write+0x53>
+		return -E_NOT_SUPP;
+  8017ee:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017f3:	eb d1                	jmp    8017c6 <write+0x53>
+
+008017f5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017f5:	55                   	push   %ebp
+  8017f6:	89 e5                	mov    %esp,%ebp
+  8017f8:	53                   	push   %ebx
+  8017f9:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017fc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017ff:	50                   	push   %eax
+  801800:	ff 75 08             	push   0x8(%ebp)
+  801803:	e8 37 fc ff ff       	call   80143f <fd_lookup>
+  801808:	83 c4 10             	add    $0x10,%esp
+  80180b:	85 c0                	test   %eax,%eax
+  80180d:	78 3a                	js     801849 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80180f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801812:	83 ec 08             	sub    $0x8,%esp
+  801815:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801818:	50                   	push   %eax
+  801819:	ff 33                	push   (%ebx)
+  80181b:	e8 6f fc ff ff       	call   80148f <dev_lookup>
+  801820:	83 c4 10             	add    $0x10,%esp
+  801823:	85 c0                	test   %eax,%eax
+  801825:	78 22                	js     801849 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801827:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80182a:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80182d:	85 c0                	test   %eax,%eax
+  80182f:	74 0d                	je     80183e <seek+0x49>
+  801831:	83 ec 0c             	sub    $0xc,%esp
+  801834:	53                   	push   %ebx
+  801835:	ff d0                	call   *%eax
+  801837:	83 c4 10             	add    $0x10,%esp
+  80183a:	85 c0                	test   %eax,%eax
+  80183c:	78 0b                	js     801849 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  80183e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801841:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801844:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801849:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80184c:	c9                   	leave
+  80184d:	c3                   	ret
+
+0080184e <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  80184e:	55                   	push   %ebp
+  80184f:	89 e5                	mov    %esp,%ebp
+  801851:	53                   	push   %ebx
+  801852:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801855:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801858:	50                   	push   %eax
+  801859:	ff 75 08             	push   0x8(%ebp)
+  80185c:	e8 de fb ff ff       	call   80143f <fd_lookup>
+  801861:	83 c4 10             	add    $0x10,%esp
+  801864:	85 c0                	test   %eax,%eax
+  801866:	78 2b                	js     801893 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801868:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80186b:	83 ec 08             	sub    $0x8,%esp
+  80186e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801871:	50                   	push   %eax
+  801872:	ff 33                	push   (%ebx)
+  801874:	e8 16 fc ff ff       	call   80148f <dev_lookup>
+  801879:	83 c4 10             	add    $0x10,%esp
+  80187c:	85 c0                	test   %eax,%eax
+  80187e:	78 13                	js     801893 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801880:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801883:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801886:	85 c0                	test   %eax,%eax
+  801888:	74 0e                	je     801898 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  80188a:	83 ec 0c             	sub    $0xc,%esp
+  80188d:	53                   	push   %ebx
+  80188e:	ff d0                	call   *%eax
+  801890:	83 c4 10             	add    $0x10,%esp
+}
+  801893:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801896:	c9                   	leave
+  801897:	c3                   	ret
+		return 0;
+  801898:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189d:	eb f4                	jmp    801893 <fsync+0x45>
+
+0080189f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80189f:	55                   	push   %ebp
+  8018a0:	89 e5                	mov    %esp,%ebp
+  8018a2:	56                   	push   %esi
+  8018a3:	53                   	push   %ebx
+  8018a4:	83 ec 18             	sub    $0x18,%esp
+  8018a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018aa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018ad:	50                   	push   %eax
+  8018ae:	53                   	push   %ebx
+  8018af:	e8 8b fb ff ff       	call   80143f <fd_lookup>
+  8018b4:	83 c4 10             	add    $0x10,%esp
+  8018b7:	85 c0                	test   %eax,%eax
+  8018b9:	78 34                	js     8018ef <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018bb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018be:	83 ec 08             	sub    $0x8,%esp
+  8018c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c4:	50                   	push   %eax
+  8018c5:	ff 36                	push   (%esi)
+  8018c7:	e8 c3 fb ff ff       	call   80148f <dev_lookup>
+  8018cc:	83 c4 10             	add    $0x10,%esp
+  8018cf:	85 c0                	test   %eax,%eax
+  8018d1:	78 1c                	js     8018ef <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018d3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018d7:	74 1d                	je     8018f6 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8018d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018dc:	8b 40 18             	mov    0x18(%eax),%eax
+  8018df:	85 c0                	test   %eax,%eax
+  8018e1:	74 34                	je     801917 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8018e3:	83 ec 08             	sub    $0x8,%esp
+  8018e6:	ff 75 0c             	push   0xc(%ebp)
+  8018e9:	56                   	push   %esi
+  8018ea:	ff d0                	call   *%eax
+  8018ec:	83 c4 10             	add    $0x10,%esp
+}
+  8018ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018f2:	5b                   	pop    %ebx
+  8018f3:	5e                   	pop    %esi
+  8018f4:	5d                   	pop    %ebp
+  8018f5:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8018f6:	a1 00 60 80 00       	mov    0x806000,%eax
+  8018fb:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8018fe:	83 ec 04             	sub    $0x4,%esp
+  801901:	53                   	push   %ebx
+  801902:	50                   	push   %eax
+  801903:	68 54 41 80 00       	push   $0x804154
+  801908:	e8 6b eb ff ff       	call   800478 <cprintf>
+		return -E_INVAL;
+  80190d:	83 c4 10             	add    $0x10,%esp
+  801910:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801915:	eb d8                	jmp    8018ef <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801917:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80191c:	eb d1                	jmp    8018ef <ftruncate+0x50>
+
+0080191e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80191e:	55                   	push   %ebp
+  80191f:	89 e5                	mov    %esp,%ebp
+  801921:	56                   	push   %esi
+  801922:	53                   	push   %ebx
+  801923:	83 ec 18             	sub    $0x18,%esp
+  801926:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801929:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80192c:	50                   	push   %eax
+  80192d:	ff 75 08             	push   0x8(%ebp)
+  801930:	e8 0a fb ff ff       	call   80143f <fd_lookup>
+  801935:	83 c4 10             	add    $0x10,%esp
+  801938:	85 c0                	test   %eax,%eax
+  80193a:	78 49                	js     801985 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80193c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80193f:	83 ec 08             	sub    $0x8,%esp
+  801942:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801945:	50                   	push   %eax
+  801946:	ff 36                	push   (%esi)
+  801948:	e8 42 fb ff ff       	call   80148f <dev_lookup>
+  80194d:	83 c4 10             	add    $0x10,%esp
+  801950:	85 c0                	test   %eax,%eax
+  801952:	78 31                	js     801985 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801954:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801957:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80195b:	74 2f                	je     80198c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80195d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801960:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801967:	00 00 00 
+	stat->st_isdir = 0;
+  80196a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801971:	00 00 00 
+	stat->st_dev = dev;
+  801974:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80197a:	83 ec 08             	sub    $0x8,%esp
+  80197d:	53                   	push   %ebx
+  80197e:	56                   	push   %esi
+  80197f:	ff 50 14             	call   *0x14(%eax)
+  801982:	83 c4 10             	add    $0x10,%esp
+}
+  801985:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801988:	5b                   	pop    %ebx
+  801989:	5e                   	pop    %esi
+  80198a:	5d                   	pop    %ebp
+  80198b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80198c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801991:	eb f2                	jmp    801985 <fstat+0x67>
+
+00801993 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801993:	55                   	push   %ebp
+  801994:	89 e5                	mov    %esp,%ebp
+  801996:	56                   	push   %esi
+  801997:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801998:	83 ec 08             	sub    $0x8,%esp
+  80199b:	68 00 10 00 00       	push   $0x1000
+  8019a0:	ff 75 08             	push   0x8(%ebp)
+  8019a3:	e8 b3 07 00 00       	call   80215b <open>
+  8019a8:	89 c3                	mov    %eax,%ebx
+  8019aa:	83 c4 10             	add    $0x10,%esp
+  8019ad:	85 c0                	test   %eax,%eax
+  8019af:	78 1b                	js     8019cc <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  8019b1:	83 ec 08             	sub    $0x8,%esp
+  8019b4:	ff 75 0c             	push   0xc(%ebp)
+  8019b7:	50                   	push   %eax
+  8019b8:	e8 61 ff ff ff       	call   80191e <fstat>
+  8019bd:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8019bf:	89 1c 24             	mov    %ebx,(%esp)
+  8019c2:	e8 a2 fb ff ff       	call   801569 <close>
+	return r;
+  8019c7:	83 c4 10             	add    $0x10,%esp
+  8019ca:	89 f3                	mov    %esi,%ebx
+}
+  8019cc:	89 d8                	mov    %ebx,%eax
+  8019ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019d1:	5b                   	pop    %ebx
+  8019d2:	5e                   	pop    %esi
+  8019d3:	5d                   	pop    %ebp
+  8019d4:	c3                   	ret
+
+008019d5 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  8019d5:	55                   	push   %ebp
+  8019d6:	89 e5                	mov    %esp,%ebp
+  8019d8:	57                   	push   %edi
+  8019d9:	56                   	push   %esi
+  8019da:	53                   	push   %ebx
+  8019db:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  8019e1:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  8019e7:	89 d6                	mov    %edx,%esi
+  8019e9:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  8019ef:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  8019f2:	89 d3                	mov    %edx,%ebx
+  8019f4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  8019fa:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801a01:	74 1d                	je     801a20 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a03:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801a08:	83 c8 07             	or     $0x7,%eax
+  801a0b:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801a11:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801a16:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801a1c:	01 ce                	add    %ecx,%esi
+  801a1e:	eb 28                	jmp    801a48 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a20:	83 ec 0c             	sub    $0xc,%esp
+  801a23:	6a 01                	push   $0x1
+  801a25:	e8 20 1f 00 00       	call   80394a <ipc_find_env>
+  801a2a:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801a2f:	83 c4 10             	add    $0x10,%esp
+  801a32:	eb cf                	jmp    801a03 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801a34:	83 c0 01             	add    $0x1,%eax
+  801a37:	89 fa                	mov    %edi,%edx
+  801a39:	09 da                	or     %ebx,%edx
+  801a3b:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801a42:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a48:	39 f3                	cmp    %esi,%ebx
+  801a4a:	72 e8                	jb     801a34 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801a4c:	83 f8 41             	cmp    $0x41,%eax
+  801a4f:	77 2f                	ja     801a80 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801a51:	50                   	push   %eax
+  801a52:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801a58:	50                   	push   %eax
+  801a59:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801a5f:	ff 35 c8 80 80 00    	push   0x8080c8
+  801a65:	e8 92 1e 00 00       	call   8038fc <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801a6a:	83 c4 0c             	add    $0xc,%esp
+  801a6d:	6a 00                	push   $0x0
+  801a6f:	6a 00                	push   $0x0
+  801a71:	6a 00                	push   $0x0
+  801a73:	e8 2e 1d 00 00       	call   8037a6 <ipc_recv>
+}
+  801a78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a7b:	5b                   	pop    %ebx
+  801a7c:	5e                   	pop    %esi
+  801a7d:	5f                   	pop    %edi
+  801a7e:	5d                   	pop    %ebp
+  801a7f:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801a80:	68 c4 41 80 00       	push   $0x8041c4
+  801a85:	68 e0 41 80 00       	push   $0x8041e0
+  801a8a:	6a 40                	push   $0x40
+  801a8c:	68 f5 41 80 00       	push   $0x8041f5
+  801a91:	e8 07 e9 ff ff       	call   80039d <_panic>
+
+00801a96 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801a96:	55                   	push   %ebp
+  801a97:	89 e5                	mov    %esp,%ebp
+  801a99:	57                   	push   %edi
+  801a9a:	56                   	push   %esi
+  801a9b:	53                   	push   %ebx
+  801a9c:	83 ec 1c             	sub    $0x1c,%esp
+  801a9f:	89 c3                	mov    %eax,%ebx
+  801aa1:	89 d6                	mov    %edx,%esi
+  801aa3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801aa6:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801aac:	89 ca                	mov    %ecx,%edx
+  801aae:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801ab1:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801ab8:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801abb:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801ac2:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ac5:	89 fb                	mov    %edi,%ebx
+  801ac7:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801ace:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ad1:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801ad8:	8b 75 08             	mov    0x8(%ebp),%esi
+  801adb:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801ae2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ae5:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801aec:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801aef:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801af6:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801afb:	39 c8                	cmp    %ecx,%eax
+  801afd:	74 0d                	je     801b0c <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801aff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b07:	5b                   	pop    %ebx
+  801b08:	5e                   	pop    %esi
+  801b09:	5f                   	pop    %edi
+  801b0a:	5d                   	pop    %ebp
+  801b0b:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b0c:	6a 07                	push   $0x7
+  801b0e:	68 00 70 80 00       	push   $0x807000
+  801b13:	6a 0d                	push   $0xd
+  801b15:	ff 35 c8 80 80 00    	push   0x8080c8
+  801b1b:	e8 f1 1c 00 00       	call   803811 <ipc_send>
+  801b20:	83 c4 10             	add    $0x10,%esp
+  801b23:	eb da                	jmp    801aff <fsring_post+0x69>
+
+00801b25 <fsipcv>:
+{
+  801b25:	55                   	push   %ebp
+  801b26:	89 e5                	mov    %esp,%ebp
+  801b28:	57                   	push   %edi
+  801b29:	56                   	push   %esi
+  801b2a:	53                   	push   %ebx
+  801b2b:	83 ec 0c             	sub    $0xc,%esp
+  801b2e:	89 c7                	mov    %eax,%edi
+  801b30:	89 d3                	mov    %edx,%ebx
+  801b32:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801b34:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801b3b:	74 26                	je     801b63 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b3d:	6a 07                	push   $0x7
+  801b3f:	68 00 70 80 00       	push   $0x807000
+  801b44:	57                   	push   %edi
+  801b45:	ff 35 c8 80 80 00    	push   0x8080c8
+  801b4b:	e8 c1 1c 00 00       	call   803811 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801b50:	6a 00                	push   $0x0
+  801b52:	56                   	push   %esi
+  801b53:	53                   	push   %ebx
+  801b54:	6a 00                	push   $0x0
+  801b56:	e8 0e 1d 00 00       	call   803869 <ipc_recvv>
+}
+  801b5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b5e:	5b                   	pop    %ebx
+  801b5f:	5e                   	pop    %esi
+  801b60:	5f                   	pop    %edi
+  801b61:	5d                   	pop    %ebp
+  801b62:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b63:	83 ec 0c             	sub    $0xc,%esp
+  801b66:	6a 01                	push   $0x1
+  801b68:	e8 dd 1d 00 00       	call   80394a <ipc_find_env>
+  801b6d:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801b72:	83 c4 10             	add    $0x10,%esp
+  801b75:	eb c6                	jmp    801b3d <fsipcv+0x18>
+
+00801b77 <fsipc>:
+{
+  801b77:	55                   	push   %ebp
+  801b78:	89 e5                	mov    %esp,%ebp
+  801b7a:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801b7d:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801b84:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801b87:	e8 99 ff ff ff       	call   801b25 <fsipcv>
+}
+  801b8c:	c9                   	leave
+  801b8d:	c3                   	ret
+
+00801b8e <file_write_direct>:
+{
+  801b8e:	55                   	push   %ebp
+  801b8f:	89 e5                	mov    %esp,%ebp
+  801b91:	56                   	push   %esi
+  801b92:	53                   	push   %ebx
+  801b93:	89 c3                	mov    %eax,%ebx
+  801b95:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801b97:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801b9d:	77 40                	ja     801bdf <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801b9f:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801ba4:	39 c8                	cmp    %ecx,%eax
+  801ba6:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ba9:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801bac:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  801bb2:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801bb7:	83 ec 04             	sub    $0x4,%esp
+  801bba:	50                   	push   %eax
+  801bbb:	52                   	push   %edx
+  801bbc:	68 08 70 80 00       	push   $0x807008
+  801bc1:	e8 26 f0 ff ff       	call   800bec <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801bc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bcb:	b8 04 00 00 00       	mov    $0x4,%eax
+  801bd0:	e8 a2 ff ff ff       	call   801b77 <fsipc>
+  801bd5:	83 c4 10             	add    $0x10,%esp
+}
+  801bd8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bdb:	5b                   	pop    %ebx
+  801bdc:	5e                   	pop    %esi
+  801bdd:	5d                   	pop    %ebp
+  801bde:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801bdf:	89 d6                	mov    %edx,%esi
+  801be1:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801be7:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801bec:	29 f1                	sub    %esi,%ecx
+  801bee:	39 c1                	cmp    %eax,%ecx
+  801bf0:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801bf3:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801bf6:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801bfb:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801c01:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801c07:	83 ec 0c             	sub    $0xc,%esp
+  801c0a:	6a 05                	push   $0x5
+  801c0c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c11:	e8 bf fd ff ff       	call   8019d5 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801c16:	83 c4 10             	add    $0x10,%esp
+  801c19:	eb bd                	jmp    801bd8 <file_write_direct+0x4a>
+
+00801c1b <devfile_sync>:
+{
+  801c1b:	55                   	push   %ebp
+  801c1c:	89 e5                	mov    %esp,%ebp
+  801c1e:	57                   	push   %edi
+  801c1f:	56                   	push   %esi
+  801c20:	53                   	push   %ebx
+  801c21:	83 ec 28             	sub    $0x28,%esp
+  801c24:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801c27:	56                   	push   %esi
+  801c28:	e8 a5 f7 ff ff       	call   8013d2 <fd2data>
+  801c2d:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801c2f:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801c32:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801c39:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801c41:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801c45:	74 45                	je     801c8c <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801c47:	8b 46 14             	mov    0x14(%esi),%eax
+  801c4a:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c57:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801c5a:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801c5d:	39 cb                	cmp    %ecx,%ebx
+  801c5f:	73 14                	jae    801c75 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801c61:	29 d9                	sub    %ebx,%ecx
+  801c63:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801c66:	89 f0                	mov    %esi,%eax
+  801c68:	e8 21 ff ff ff       	call   801b8e <file_write_direct>
+  801c6d:	85 c0                	test   %eax,%eax
+  801c6f:	7e 04                	jle    801c75 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801c71:	01 c3                	add    %eax,%ebx
+  801c73:	eb e5                	jmp    801c5a <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801c75:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801c78:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801c7f:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801c82:	85 c0                	test   %eax,%eax
+  801c84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c89:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801c8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c8f:	5b                   	pop    %ebx
+  801c90:	5e                   	pop    %esi
+  801c91:	5f                   	pop    %edi
+  801c92:	5d                   	pop    %ebp
+  801c93:	c3                   	ret
+
+00801c94 <devfile_write>:
+{
+  801c94:	55                   	push   %ebp
+  801c95:	89 e5                	mov    %esp,%ebp
+  801c97:	57                   	push   %edi
+  801c98:	56                   	push   %esi
+  801c99:	53                   	push   %ebx
+  801c9a:	83 ec 28             	sub    $0x28,%esp
+  801c9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ca0:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801ca3:	53                   	push   %ebx
+  801ca4:	e8 29 f7 ff ff       	call   8013d2 <fd2data>
+  801ca9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801cac:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801caf:	83 c4 10             	add    $0x10,%esp
+  801cb2:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801cb6:	74 43                	je     801cfb <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801cb8:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801cbf:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801cc2:	85 c0                	test   %eax,%eax
+  801cc4:	74 43                	je     801d09 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801cc6:	89 c2                	mov    %eax,%edx
+  801cc8:	03 53 14             	add    0x14(%ebx),%edx
+  801ccb:	39 fa                	cmp    %edi,%edx
+  801ccd:	75 0b                	jne    801cda <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801ccf:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801cd2:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801cd8:	76 66                	jbe    801d40 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801cda:	83 ec 0c             	sub    $0xc,%esp
+  801cdd:	53                   	push   %ebx
+  801cde:	e8 38 ff ff ff       	call   801c1b <devfile_sync>
+  801ce3:	83 c4 10             	add    $0x10,%esp
+  801ce6:	85 c0                	test   %eax,%eax
+  801ce8:	78 4e                	js     801d38 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801cea:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801cf0:	77 56                	ja     801d48 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801cf2:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801cf5:	85 c0                	test   %eax,%eax
+  801cf7:	75 20                	jne    801d19 <devfile_write+0x85>
+  801cf9:	eb 16                	jmp    801d11 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801cfb:	89 f1                	mov    %esi,%ecx
+  801cfd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d00:	89 d8                	mov    %ebx,%eax
+  801d02:	e8 87 fe ff ff       	call   801b8e <file_write_direct>
+  801d07:	eb 2f                	jmp    801d38 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801d09:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d0f:	77 37                	ja     801d48 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801d11:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801d14:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801d19:	83 ec 04             	sub    $0x4,%esp
+  801d1c:	56                   	push   %esi
+  801d1d:	ff 75 0c             	push   0xc(%ebp)
+  801d20:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d23:	01 c1                	add    %eax,%ecx
+  801d25:	51                   	push   %ecx
+  801d26:	e8 c1 ee ff ff       	call   800bec <memmove>
+	ff->buf_wlen += n;
+  801d2b:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801d2e:	01 f7                	add    %esi,%edi
+  801d30:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801d33:	89 f0                	mov    %esi,%eax
+  801d35:	83 c4 10             	add    $0x10,%esp
+}
+  801d38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d3b:	5b                   	pop    %ebx
+  801d3c:	5e                   	pop    %esi
+  801d3d:	5f                   	pop    %edi
+  801d3e:	5d                   	pop    %ebp
+  801d3f:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801d40:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d46:	76 d1                	jbe    801d19 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801d48:	89 f1                	mov    %esi,%ecx
+  801d4a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d4d:	89 d8                	mov    %ebx,%eax
+  801d4f:	e8 3a fe ff ff       	call   801b8e <file_write_direct>
+  801d54:	eb e2                	jmp    801d38 <devfile_write+0xa4>
+
+00801d56 <devfile_trunc>:
+{
+  801d56:	55                   	push   %ebp
+  801d57:	89 e5                	mov    %esp,%ebp
+  801d59:	53                   	push   %ebx
+  801d5a:	83 ec 10             	sub    $0x10,%esp
+  801d5d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801d60:	53                   	push   %ebx
+  801d61:	e8 b5 fe ff ff       	call   801c1b <devfile_sync>
+  801d66:	83 c4 10             	add    $0x10,%esp
+  801d69:	85 c0                	test   %eax,%eax
+  801d6b:	78 1f                	js     801d8c <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d6d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801d70:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801d75:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d78:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801d7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d82:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d87:	e8 eb fd ff ff       	call   801b77 <fsipc>
+}
+  801d8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d8f:	c9                   	leave
+  801d90:	c3                   	ret
+
+00801d91 <devfile_stat>:
+{
+  801d91:	55                   	push   %ebp
+  801d92:	89 e5                	mov    %esp,%ebp
+  801d94:	56                   	push   %esi
+  801d95:	53                   	push   %ebx
+  801d96:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d99:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801d9c:	83 ec 0c             	sub    $0xc,%esp
+  801d9f:	53                   	push   %ebx
+  801da0:	e8 76 fe ff ff       	call   801c1b <devfile_sync>
+  801da5:	83 c4 10             	add    $0x10,%esp
+  801da8:	85 c0                	test   %eax,%eax
+  801daa:	78 47                	js     801df3 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801dac:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801daf:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801db4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db9:	b8 05 00 00 00       	mov    $0x5,%eax
+  801dbe:	e8 b4 fd ff ff       	call   801b77 <fsipc>
+  801dc3:	85 c0                	test   %eax,%eax
+  801dc5:	78 2c                	js     801df3 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801dc7:	83 ec 08             	sub    $0x8,%esp
+  801dca:	68 00 70 80 00       	push   $0x807000
+  801dcf:	56                   	push   %esi
+  801dd0:	e8 91 ec ff ff       	call   800a66 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801dd5:	a1 80 70 80 00       	mov    0x807080,%eax
+  801dda:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801de0:	a1 84 70 80 00       	mov    0x807084,%eax
+  801de5:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801deb:	83 c4 10             	add    $0x10,%esp
+  801dee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801df3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801df6:	5b                   	pop    %ebx
+  801df7:	5e                   	pop    %esi
+  801df8:	5d                   	pop    %ebp
+  801df9:	c3                   	ret
+
+00801dfa <devfile_flush>:
+{
+  801dfa:	55                   	push   %ebp
+  801dfb:	89 e5                	mov    %esp,%ebp
+  801dfd:	56                   	push   %esi
+  801dfe:	53                   	push   %ebx
+  801dff:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801e02:	83 ec 0c             	sub    $0xc,%esp
+  801e05:	56                   	push   %esi
+  801e06:	e8 10 fe ff ff       	call   801c1b <devfile_sync>
+  801e0b:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801e0d:	83 c4 10             	add    $0x10,%esp
+  801e10:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801e14:	75 25                	jne    801e3b <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e16:	8b 46 0c             	mov    0xc(%esi),%eax
+  801e19:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801e1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e23:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e28:	e8 4a fd ff ff       	call   801b77 <fsipc>
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801e32:	89 d8                	mov    %ebx,%eax
+  801e34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e37:	5b                   	pop    %ebx
+  801e38:	5e                   	pop    %esi
+  801e39:	5d                   	pop    %ebp
+  801e3a:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801e3b:	83 ec 0c             	sub    $0xc,%esp
+  801e3e:	56                   	push   %esi
+  801e3f:	e8 8e f5 ff ff       	call   8013d2 <fd2data>
+  801e44:	83 c4 08             	add    $0x8,%esp
+  801e47:	50                   	push   %eax
+  801e48:	6a 00                	push   $0x0
+  801e4a:	e8 b0 f0 ff ff       	call   800eff <sys_page_unmap>
+  801e4f:	83 c4 10             	add    $0x10,%esp
+  801e52:	eb c2                	jmp    801e16 <devfile_flush+0x1c>
+
+00801e54 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801e54:	55                   	push   %ebp
+  801e55:	89 e5                	mov    %esp,%ebp
+  801e57:	57                   	push   %edi
+  801e58:	56                   	push   %esi
+  801e59:	53                   	push   %ebx
+  801e5a:	83 ec 64             	sub    $0x64,%esp
+  801e5d:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801e5f:	52                   	push   %edx
+  801e60:	50                   	push   %eax
+  801e61:	e8 d9 f5 ff ff       	call   80143f <fd_lookup>
+  801e66:	89 c1                	mov    %eax,%ecx
+  801e68:	83 c4 10             	add    $0x10,%esp
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	0f 88 f2 00 00 00    	js     801f65 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801e73:	8b 07                	mov    (%edi),%eax
+  801e75:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801e7b:	39 10                	cmp    %edx,(%eax)
+  801e7d:	0f 85 03 01 00 00    	jne    801f86 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801e83:	a1 00 60 80 00       	mov    0x806000,%eax
+  801e88:	8b 40 48             	mov    0x48(%eax),%eax
+  801e8b:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  801e91:	0f 84 96 00 00 00    	je     801f2d <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801e97:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801e9e:	0f 84 cb 00 00 00    	je     801f6f <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801ea4:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801ea9:	83 c8 07             	or     $0x7,%eax
+  801eac:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801eaf:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801eb2:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801eb7:	83 ec 04             	sub    $0x4,%esp
+  801eba:	68 07 04 00 00       	push   $0x407
+  801ebf:	53                   	push   %ebx
+  801ec0:	6a 00                	push   $0x0
+  801ec2:	e8 ab ef ff ff       	call   800e72 <sys_page_alloc>
+  801ec7:	89 c1                	mov    %eax,%ecx
+  801ec9:	83 c4 10             	add    $0x10,%esp
+  801ecc:	85 c0                	test   %eax,%eax
+  801ece:	0f 88 91 00 00 00    	js     801f65 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801ed4:	89 d8                	mov    %ebx,%eax
+  801ed6:	83 c8 07             	or     $0x7,%eax
+  801ed9:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801edb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ee1:	83 c6 04             	add    $0x4,%esi
+  801ee4:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801eea:	75 cb                	jne    801eb7 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801eec:	6a 12                	push   $0x12
+  801eee:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801ef1:	50                   	push   %eax
+  801ef2:	6a 0c                	push   $0xc
+  801ef4:	ff 35 c8 80 80 00    	push   0x8080c8
+  801efa:	e8 fd 19 00 00       	call   8038fc <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801eff:	83 c4 0c             	add    $0xc,%esp
+  801f02:	6a 00                	push   $0x0
+  801f04:	6a 00                	push   $0x0
+  801f06:	6a 00                	push   $0x0
+  801f08:	e8 99 18 00 00       	call   8037a6 <ipc_recv>
+  801f0d:	89 c1                	mov    %eax,%ecx
+  801f0f:	83 c4 10             	add    $0x10,%esp
+  801f12:	85 c0                	test   %eax,%eax
+  801f14:	78 4f                	js     801f65 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801f16:	a1 00 60 80 00       	mov    0x806000,%eax
+  801f1b:	8b 40 48             	mov    0x48(%eax),%eax
+  801f1e:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  801f23:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  801f2a:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801f2d:	83 ec 0c             	sub    $0xc,%esp
+  801f30:	ff 37                	push   (%edi)
+  801f32:	e8 e4 fc ff ff       	call   801c1b <devfile_sync>
+  801f37:	89 c1                	mov    %eax,%ecx
+  801f39:	83 c4 10             	add    $0x10,%esp
+  801f3c:	85 c0                	test   %eax,%eax
+  801f3e:	78 25                	js     801f65 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801f40:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801f46:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801f4b:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f50:	89 d0                	mov    %edx,%eax
+  801f52:	d3 e0                	shl    %cl,%eax
+  801f54:	85 d8                	test   %ebx,%eax
+  801f56:	74 0d                	je     801f65 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801f58:	83 c1 01             	add    $0x1,%ecx
+  801f5b:	83 f9 10             	cmp    $0x10,%ecx
+  801f5e:	75 f0                	jne    801f50 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801f60:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801f65:	89 c8                	mov    %ecx,%eax
+  801f67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f6a:	5b                   	pop    %ebx
+  801f6b:	5e                   	pop    %esi
+  801f6c:	5f                   	pop    %edi
+  801f6d:	5d                   	pop    %ebp
+  801f6e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f6f:	83 ec 0c             	sub    $0xc,%esp
+  801f72:	6a 01                	push   $0x1
+  801f74:	e8 d1 19 00 00       	call   80394a <ipc_find_env>
+  801f79:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801f7e:	83 c4 10             	add    $0x10,%esp
+  801f81:	e9 1e ff ff ff       	jmp    801ea4 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801f86:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801f8b:	eb d8                	jmp    801f65 <fsring_slot+0x111>
+
+00801f8d <file_read_direct>:
+{
+  801f8d:	55                   	push   %ebp
+  801f8e:	89 e5                	mov    %esp,%ebp
+  801f90:	57                   	push   %edi
+  801f91:	56                   	push   %esi
+  801f92:	53                   	push   %ebx
+  801f93:	83 ec 1c             	sub    $0x1c,%esp
+  801f96:	89 c7                	mov    %eax,%edi
+  801f98:	89 d6                	mov    %edx,%esi
+  801f9a:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801f9c:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801fa2:	77 52                	ja     801ff6 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fa4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fa7:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801fac:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801fb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb7:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fbc:	e8 b6 fb ff ff       	call   801b77 <fsipc>
+  801fc1:	89 c7                	mov    %eax,%edi
+  801fc3:	85 c0                	test   %eax,%eax
+  801fc5:	78 25                	js     801fec <file_read_direct+0x5f>
+	assert(r <= n);
+  801fc7:	39 c3                	cmp    %eax,%ebx
+  801fc9:	0f 82 87 00 00 00    	jb     802056 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801fcf:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801fd4:	0f 8f 95 00 00 00    	jg     80206f <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801fda:	83 ec 04             	sub    $0x4,%esp
+  801fdd:	50                   	push   %eax
+  801fde:	68 00 70 80 00       	push   $0x807000
+  801fe3:	56                   	push   %esi
+  801fe4:	e8 03 ec ff ff       	call   800bec <memmove>
+	return r;
+  801fe9:	83 c4 10             	add    $0x10,%esp
+}
+  801fec:	89 f8                	mov    %edi,%eax
+  801fee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff1:	5b                   	pop    %ebx
+  801ff2:	5e                   	pop    %esi
+  801ff3:	5f                   	pop    %edi
+  801ff4:	5d                   	pop    %ebp
+  801ff5:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801ff6:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801ffc:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802001:	29 d1                	sub    %edx,%ecx
+  802003:	39 d9                	cmp    %ebx,%ecx
+  802005:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802008:	89 f0                	mov    %esi,%eax
+  80200a:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  80200d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802010:	eb 0f                	jmp    802021 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  802012:	0f b6 10             	movzbl (%eax),%edx
+  802015:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802017:	05 00 10 00 00       	add    $0x1000,%eax
+  80201c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802021:	39 c8                	cmp    %ecx,%eax
+  802023:	72 ed                	jb     802012 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802025:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802028:	8b 47 0c             	mov    0xc(%edi),%eax
+  80202b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  802030:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802036:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  80203c:	83 ec 0c             	sub    $0xc,%esp
+  80203f:	6a 07                	push   $0x7
+  802041:	89 d9                	mov    %ebx,%ecx
+  802043:	89 f2                	mov    %esi,%edx
+  802045:	b8 09 00 00 00       	mov    $0x9,%eax
+  80204a:	e8 86 f9 ff ff       	call   8019d5 <fsipc_pages>
+  80204f:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  802051:	83 c4 10             	add    $0x10,%esp
+  802054:	eb 96                	jmp    801fec <file_read_direct+0x5f>
+	assert(r <= n);
+  802056:	68 00 42 80 00       	push   $0x804200
+  80205b:	68 e0 41 80 00       	push   $0x8041e0
+  802060:	68 dc 00 00 00       	push   $0xdc
+  802065:	68 f5 41 80 00       	push   $0x8041f5
+  80206a:	e8 2e e3 ff ff       	call   80039d <_panic>
+	assert(r <= PGSIZE);
+  80206f:	68 11 42 80 00       	push   $0x804211
+  802074:	68 e0 41 80 00       	push   $0x8041e0
+  802079:	68 dd 00 00 00       	push   $0xdd
+  80207e:	68 f5 41 80 00       	push   $0x8041f5
+  802083:	e8 15 e3 ff ff       	call   80039d <_panic>
+
+00802088 <devfile_read>:
+{
+  802088:	55                   	push   %ebp
+  802089:	89 e5                	mov    %esp,%ebp
+  80208b:	57                   	push   %edi
+  80208c:	56                   	push   %esi
+  80208d:	53                   	push   %ebx
+  80208e:	83 ec 28             	sub    $0x28,%esp
+  802091:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802094:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  802097:	53                   	push   %ebx
+  802098:	e8 35 f3 ff ff       	call   8013d2 <fd2data>
+  80209d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8020a0:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8020a3:	83 c4 10             	add    $0x10,%esp
+  8020a6:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8020aa:	74 7d                	je     802129 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8020ac:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8020b0:	0f 85 81 00 00 00    	jne    802137 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  8020b6:	8b 43 18             	mov    0x18(%ebx),%eax
+  8020b9:	85 c0                	test   %eax,%eax
+  8020bb:	74 0d                	je     8020ca <devfile_read+0x42>
+  8020bd:	8b 53 14             	mov    0x14(%ebx),%edx
+  8020c0:	39 fa                	cmp    %edi,%edx
+  8020c2:	7f 06                	jg     8020ca <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8020c4:	01 c2                	add    %eax,%edx
+  8020c6:	39 d7                	cmp    %edx,%edi
+  8020c8:	72 28                	jb     8020f2 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8020ca:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8020d1:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8020d7:	77 74                	ja     80214d <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8020d9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020de:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8020e1:	89 d8                	mov    %ebx,%eax
+  8020e3:	e8 a5 fe ff ff       	call   801f8d <file_read_direct>
+  8020e8:	85 c0                	test   %eax,%eax
+  8020ea:	7e 35                	jle    802121 <devfile_read+0x99>
+		ff->buf_base = pos;
+  8020ec:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8020ef:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8020f2:	8b 53 14             	mov    0x14(%ebx),%edx
+  8020f5:	89 d0                	mov    %edx,%eax
+  8020f7:	03 43 18             	add    0x18(%ebx),%eax
+  8020fa:	29 f8                	sub    %edi,%eax
+  8020fc:	39 f0                	cmp    %esi,%eax
+  8020fe:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  802101:	83 ec 04             	sub    $0x4,%esp
+  802104:	56                   	push   %esi
+  802105:	89 f8                	mov    %edi,%eax
+  802107:	29 d0                	sub    %edx,%eax
+  802109:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80210c:	01 c1                	add    %eax,%ecx
+  80210e:	51                   	push   %ecx
+  80210f:	ff 75 0c             	push   0xc(%ebp)
+  802112:	e8 d5 ea ff ff       	call   800bec <memmove>
+	fd->fd_offset = pos + n;
+  802117:	01 f7                	add    %esi,%edi
+  802119:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80211c:	89 f0                	mov    %esi,%eax
+  80211e:	83 c4 10             	add    $0x10,%esp
+}
+  802121:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802124:	5b                   	pop    %ebx
+  802125:	5e                   	pop    %esi
+  802126:	5f                   	pop    %edi
+  802127:	5d                   	pop    %ebp
+  802128:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802129:	89 f1                	mov    %esi,%ecx
+  80212b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80212e:	89 d8                	mov    %ebx,%eax
+  802130:	e8 58 fe ff ff       	call   801f8d <file_read_direct>
+  802135:	eb ea                	jmp    802121 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802137:	83 ec 0c             	sub    $0xc,%esp
+  80213a:	53                   	push   %ebx
+  80213b:	e8 db fa ff ff       	call   801c1b <devfile_sync>
+  802140:	83 c4 10             	add    $0x10,%esp
+  802143:	85 c0                	test   %eax,%eax
+  802145:	0f 89 6b ff ff ff    	jns    8020b6 <devfile_read+0x2e>
+  80214b:	eb d4                	jmp    802121 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  80214d:	89 f1                	mov    %esi,%ecx
+  80214f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802152:	89 d8                	mov    %ebx,%eax
+  802154:	e8 34 fe ff ff       	call   801f8d <file_read_direct>
+  802159:	eb c6                	jmp    802121 <devfile_read+0x99>
+
+0080215b <open>:
+{
+  80215b:	55                   	push   %ebp
+  80215c:	89 e5                	mov    %esp,%ebp
+  80215e:	56                   	push   %esi
+  80215f:	53                   	push   %ebx
+  802160:	83 ec 1c             	sub    $0x1c,%esp
+  802163:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802166:	56                   	push   %esi
+  802167:	e8 bf e8 ff ff       	call   800a2b <strlen>
+  80216c:	83 c4 10             	add    $0x10,%esp
+  80216f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802174:	0f 8f a0 00 00 00    	jg     80221a <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  80217a:	83 ec 0c             	sub    $0xc,%esp
+  80217d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802180:	50                   	push   %eax
+  802181:	e8 63 f2 ff ff       	call   8013e9 <fd_alloc>
+  802186:	89 c3                	mov    %eax,%ebx
+  802188:	83 c4 10             	add    $0x10,%esp
+  80218b:	85 c0                	test   %eax,%eax
+  80218d:	78 45                	js     8021d4 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  80218f:	83 ec 08             	sub    $0x8,%esp
+  802192:	56                   	push   %esi
+  802193:	68 00 70 80 00       	push   $0x807000
+  802198:	e8 c9 e8 ff ff       	call   800a66 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80219d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021a0:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021a5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021a8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021ad:	e8 c5 f9 ff ff       	call   801b77 <fsipc>
+  8021b2:	89 c3                	mov    %eax,%ebx
+  8021b4:	83 c4 10             	add    $0x10,%esp
+  8021b7:	85 c0                	test   %eax,%eax
+  8021b9:	78 22                	js     8021dd <open+0x82>
+	if (!(mode & O_NOBUF)
+  8021bb:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8021c2:	74 2b                	je     8021ef <open+0x94>
+	return fd2num(fd);
+  8021c4:	83 ec 0c             	sub    $0xc,%esp
+  8021c7:	ff 75 f4             	push   -0xc(%ebp)
+  8021ca:	e8 f3 f1 ff ff       	call   8013c2 <fd2num>
+  8021cf:	89 c3                	mov    %eax,%ebx
+  8021d1:	83 c4 10             	add    $0x10,%esp
+}
+  8021d4:	89 d8                	mov    %ebx,%eax
+  8021d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021d9:	5b                   	pop    %ebx
+  8021da:	5e                   	pop    %esi
+  8021db:	5d                   	pop    %ebp
+  8021dc:	c3                   	ret
+		fd_close(fd, 0);
+  8021dd:	83 ec 08             	sub    $0x8,%esp
+  8021e0:	6a 00                	push   $0x0
+  8021e2:	ff 75 f4             	push   -0xc(%ebp)
+  8021e5:	e8 f8 f2 ff ff       	call   8014e2 <fd_close>
+		return r;
+  8021ea:	83 c4 10             	add    $0x10,%esp
+  8021ed:	eb e5                	jmp    8021d4 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8021ef:	83 ec 0c             	sub    $0xc,%esp
+  8021f2:	ff 75 f4             	push   -0xc(%ebp)
+  8021f5:	e8 d8 f1 ff ff       	call   8013d2 <fd2data>
+  8021fa:	83 c4 0c             	add    $0xc,%esp
+  8021fd:	68 07 04 00 00       	push   $0x407
+  802202:	50                   	push   %eax
+  802203:	6a 00                	push   $0x0
+  802205:	e8 68 ec ff ff       	call   800e72 <sys_page_alloc>
+  80220a:	83 c4 10             	add    $0x10,%esp
+  80220d:	85 c0                	test   %eax,%eax
+  80220f:	75 b3                	jne    8021c4 <open+0x69>
+		fd->fd_file.buffered = 1;
+  802211:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802214:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802218:	eb aa                	jmp    8021c4 <open+0x69>
+		return -E_BAD_PATH;
+  80221a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80221f:	eb b3                	jmp    8021d4 <open+0x79>
+
+00802221 <readdir>:
+{
+  802221:	55                   	push   %ebp
+  802222:	89 e5                	mov    %esp,%ebp
+  802224:	53                   	push   %ebx
+  802225:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802228:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80222b:	50                   	push   %eax
+  80222c:	ff 75 08             	push   0x8(%ebp)
+  80222f:	e8 0b f2 ff ff       	call   80143f <fd_lookup>
+  802234:	89 c3                	mov    %eax,%ebx
+  802236:	83 c4 10             	add    $0x10,%esp
+  802239:	85 c0                	test   %eax,%eax
+  80223b:	78 73                	js     8022b0 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80223d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802240:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802246:	39 08                	cmp    %ecx,(%eax)
+  802248:	0f 85 82 00 00 00    	jne    8022d0 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  80224e:	83 ec 0c             	sub    $0xc,%esp
+  802251:	50                   	push   %eax
+  802252:	e8 c4 f9 ff ff       	call   801c1b <devfile_sync>
+  802257:	89 c3                	mov    %eax,%ebx
+  802259:	83 c4 10             	add    $0x10,%esp
+  80225c:	85 c0                	test   %eax,%eax
+  80225e:	78 50                	js     8022b0 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802260:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802263:	8b 40 0c             	mov    0xc(%eax),%eax
+  802266:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  80226b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80226e:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  802273:	8b 45 14             	mov    0x14(%ebp),%eax
+  802276:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  80227b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802280:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802285:	e8 ed f8 ff ff       	call   801b77 <fsipc>
+  80228a:	89 c3                	mov    %eax,%ebx
+  80228c:	85 c0                	test   %eax,%eax
+  80228e:	7e 20                	jle    8022b0 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  802290:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802293:	72 22                	jb     8022b7 <readdir+0x96>
+  802295:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80229a:	7f 1b                	jg     8022b7 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80229c:	83 ec 04             	sub    $0x4,%esp
+  80229f:	50                   	push   %eax
+  8022a0:	68 00 70 80 00       	push   $0x807000
+  8022a5:	ff 75 0c             	push   0xc(%ebp)
+  8022a8:	e8 3f e9 ff ff       	call   800bec <memmove>
+	return r;
+  8022ad:	83 c4 10             	add    $0x10,%esp
+}
+  8022b0:	89 d8                	mov    %ebx,%eax
+  8022b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022b5:	c9                   	leave
+  8022b6:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8022b7:	68 07 42 80 00       	push   $0x804207
+  8022bc:	68 e0 41 80 00       	push   $0x8041e0
+  8022c1:	68 86 01 00 00       	push   $0x186
+  8022c6:	68 f5 41 80 00       	push   $0x8041f5
+  8022cb:	e8 cd e0 ff ff       	call   80039d <_panic>
+		return -E_NOT_SUPP;
+  8022d0:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8022d5:	eb d9                	jmp    8022b0 <readdir+0x8f>
+
+008022d7 <munmap>:
+{
+  8022d7:	55                   	push   %ebp
+  8022d8:	89 e5                	mov    %esp,%ebp
+  8022da:	56                   	push   %esi
+  8022db:	53                   	push   %ebx
+  8022dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022df:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8022e2:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8022e8:	75 41                	jne    80232b <munmap+0x54>
+  8022ea:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8022f0:	77 39                	ja     80232b <munmap+0x54>
+  8022f2:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8022f7:	29 f0                	sub    %esi,%eax
+  8022f9:	39 d0                	cmp    %edx,%eax
+  8022fb:	72 35                	jb     802332 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8022fd:	89 f3                	mov    %esi,%ebx
+  8022ff:	01 d6                	add    %edx,%esi
+  802301:	39 f3                	cmp    %esi,%ebx
+  802303:	73 1a                	jae    80231f <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802305:	83 ec 08             	sub    $0x8,%esp
+  802308:	53                   	push   %ebx
+  802309:	6a 00                	push   $0x0
+  80230b:	e8 ef eb ff ff       	call   800eff <sys_page_unmap>
+  802310:	83 c4 10             	add    $0x10,%esp
+  802313:	85 c0                	test   %eax,%eax
+  802315:	78 0d                	js     802324 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802317:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80231d:	eb e2                	jmp    802301 <munmap+0x2a>
+	return 0;
+  80231f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802324:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802327:	5b                   	pop    %ebx
+  802328:	5e                   	pop    %esi
+  802329:	5d                   	pop    %ebp
+  80232a:	c3                   	ret
+		return -E_INVAL;
+  80232b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802330:	eb f2                	jmp    802324 <munmap+0x4d>
+  802332:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802337:	eb eb                	jmp    802324 <munmap+0x4d>
+
+00802339 <mmap>:
+{
+  802339:	55                   	push   %ebp
+  80233a:	89 e5                	mov    %esp,%ebp
+  80233c:	57                   	push   %edi
+  80233d:	56                   	push   %esi
+  80233e:	53                   	push   %ebx
+  80233f:	83 ec 34             	sub    $0x34,%esp
+  802342:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802345:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802348:	50                   	push   %eax
+  802349:	ff 75 18             	push   0x18(%ebp)
+  80234c:	e8 ee f0 ff ff       	call   80143f <fd_lookup>
+  802351:	89 c3                	mov    %eax,%ebx
+  802353:	83 c4 10             	add    $0x10,%esp
+  802356:	85 c0                	test   %eax,%eax
+  802358:	0f 88 0e 01 00 00    	js     80246c <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80235e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802361:	a1 20 50 80 00       	mov    0x805020,%eax
+  802366:	39 02                	cmp    %eax,(%edx)
+  802368:	0f 85 50 01 00 00    	jne    8024be <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  80236e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802371:	83 e0 02             	and    $0x2,%eax
+  802374:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802377:	74 0a                	je     802383 <mmap+0x4a>
+  802379:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80237d:	0f 84 42 01 00 00    	je     8024c5 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802383:	8b 42 08             	mov    0x8(%edx),%eax
+  802386:	83 e0 03             	and    $0x3,%eax
+  802389:	83 f8 01             	cmp    $0x1,%eax
+  80238c:	0f 84 3a 01 00 00    	je     8024cc <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802392:	8b 45 08             	mov    0x8(%ebp),%eax
+  802395:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802398:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80239d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8023a0:	0f 85 2d 01 00 00    	jne    8024d3 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8023a6:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8023aa:	0f 88 2a 01 00 00    	js     8024da <mmap+0x1a1>
+  8023b0:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8023b7:	0f 87 1d 01 00 00    	ja     8024da <mmap+0x1a1>
+  8023bd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8023c2:	2b 45 08             	sub    0x8(%ebp),%eax
+  8023c5:	39 f8                	cmp    %edi,%eax
+  8023c7:	0f 82 14 01 00 00    	jb     8024e1 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8023cd:	83 ec 0c             	sub    $0xc,%esp
+  8023d0:	52                   	push   %edx
+  8023d1:	e8 45 f8 ff ff       	call   801c1b <devfile_sync>
+  8023d6:	89 c3                	mov    %eax,%ebx
+  8023d8:	83 c4 10             	add    $0x10,%esp
+  8023db:	85 c0                	test   %eax,%eax
+  8023dd:	0f 88 89 00 00 00    	js     80246c <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8023e3:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8023e9:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8023ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f4:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8023f7:	39 fe                	cmp    %edi,%esi
+  8023f9:	73 7b                	jae    802476 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8023fb:	89 f8                	mov    %edi,%eax
+  8023fd:	29 f0                	sub    %esi,%eax
+  8023ff:	c1 e8 0c             	shr    $0xc,%eax
+  802402:	ba 40 00 00 00       	mov    $0x40,%edx
+  802407:	39 d0                	cmp    %edx,%eax
+  802409:	0f 47 c2             	cmova  %edx,%eax
+  80240c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80240f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802412:	8b 52 0c             	mov    0xc(%edx),%edx
+  802415:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  80241b:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  80241e:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  802424:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802429:	89 f2                	mov    %esi,%edx
+  80242b:	03 55 08             	add    0x8(%ebp),%edx
+  80242e:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802431:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802436:	e8 ea f6 ff ff       	call   801b25 <fsipcv>
+  80243b:	85 c0                	test   %eax,%eax
+  80243d:	7e 12                	jle    802451 <mmap+0x118>
+  80243f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802442:	85 c0                	test   %eax,%eax
+  802444:	0f 84 9e 00 00 00    	je     8024e8 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80244a:	c1 e0 0c             	shl    $0xc,%eax
+  80244d:	01 c6                	add    %eax,%esi
+  80244f:	eb a6                	jmp    8023f7 <mmap+0xbe>
+			munmap(addr, done);
+  802451:	89 c3                	mov    %eax,%ebx
+  802453:	83 ec 08             	sub    $0x8,%esp
+  802456:	56                   	push   %esi
+  802457:	ff 75 08             	push   0x8(%ebp)
+  80245a:	e8 78 fe ff ff       	call   8022d7 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80245f:	83 c4 10             	add    $0x10,%esp
+  802462:	85 db                	test   %ebx,%ebx
+  802464:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802469:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80246c:	89 d8                	mov    %ebx,%eax
+  80246e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802471:	5b                   	pop    %ebx
+  802472:	5e                   	pop    %esi
+  802473:	5f                   	pop    %edi
+  802474:	5d                   	pop    %ebp
+  802475:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802476:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802479:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80247b:	85 c0                	test   %eax,%eax
+  80247d:	74 ed                	je     80246c <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80247f:	be 00 00 00 00       	mov    $0x0,%esi
+  802484:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802487:	39 fe                	cmp    %edi,%esi
+  802489:	73 2e                	jae    8024b9 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80248b:	83 ec 0c             	sub    $0xc,%esp
+  80248e:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802491:	50                   	push   %eax
+  802492:	e8 11 11 00 00       	call   8035a8 <cowpage>
+  802497:	83 c4 10             	add    $0x10,%esp
+  80249a:	85 c0                	test   %eax,%eax
+  80249c:	78 08                	js     8024a6 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  80249e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8024a4:	eb e1                	jmp    802487 <mmap+0x14e>
+				munmap(addr, len);
+  8024a6:	89 c3                	mov    %eax,%ebx
+  8024a8:	83 ec 08             	sub    $0x8,%esp
+  8024ab:	57                   	push   %edi
+  8024ac:	ff 75 08             	push   0x8(%ebp)
+  8024af:	e8 23 fe ff ff       	call   8022d7 <munmap>
+				return r;
+  8024b4:	83 c4 10             	add    $0x10,%esp
+  8024b7:	eb b3                	jmp    80246c <mmap+0x133>
+	return 0;
+  8024b9:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8024bc:	eb ae                	jmp    80246c <mmap+0x133>
+		return -E_NOT_SUPP;
+  8024be:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8024c3:	eb a7                	jmp    80246c <mmap+0x133>
+		return -E_NOT_SUPP;
+  8024c5:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8024ca:	eb a0                	jmp    80246c <mmap+0x133>
+		return -E_INVAL;
+  8024cc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024d1:	eb 99                	jmp    80246c <mmap+0x133>
+  8024d3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024d8:	eb 92                	jmp    80246c <mmap+0x133>
+  8024da:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024df:	eb 8b                	jmp    80246c <mmap+0x133>
+  8024e1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024e6:	eb 84                	jmp    80246c <mmap+0x133>
+			munmap(addr, done);
+  8024e8:	83 ec 08             	sub    $0x8,%esp
+  8024eb:	56                   	push   %esi
+  8024ec:	ff 75 08             	push   0x8(%ebp)
+  8024ef:	e8 e3 fd ff ff       	call   8022d7 <munmap>
+  8024f4:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8024f7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024fc:	e9 6b ff ff ff       	jmp    80246c <mmap+0x133>
+
+00802501 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802501:	55                   	push   %ebp
+  802502:	89 e5                	mov    %esp,%ebp
+  802504:	56                   	push   %esi
+  802505:	53                   	push   %ebx
+  802506:	83 ec 10             	sub    $0x10,%esp
+  802509:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80250c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80250f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802512:	e8 3d f9 ff ff       	call   801e54 <fsring_slot>
+  802517:	85 c0                	test   %eax,%eax
+  802519:	78 60                	js     80257b <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80251b:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80251e:	8b 56 08             	mov    0x8(%esi),%edx
+  802521:	83 e2 03             	and    $0x3,%edx
+  802524:	83 fa 01             	cmp    $0x1,%edx
+  802527:	74 59                	je     802582 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802529:	ba 01 00 00 00       	mov    $0x1,%edx
+  80252e:	89 c1                	mov    %eax,%ecx
+  802530:	d3 e2                	shl    %cl,%edx
+  802532:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802538:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80253b:	c1 e2 02             	shl    $0x2,%edx
+  80253e:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  802544:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  80254b:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80254e:	8b 55 18             	mov    0x18(%ebp),%edx
+  802551:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802554:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802557:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80255a:	83 ec 08             	sub    $0x8,%esp
+  80255d:	50                   	push   %eax
+  80255e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802563:	39 c3                	cmp    %eax,%ebx
+  802565:	0f 47 d8             	cmova  %eax,%ebx
+  802568:	53                   	push   %ebx
+  802569:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80256c:	89 f2                	mov    %esi,%edx
+  80256e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802573:	e8 1e f5 ff ff       	call   801a96 <fsring_post>
+  802578:	83 c4 10             	add    $0x10,%esp
+}
+  80257b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80257e:	5b                   	pop    %ebx
+  80257f:	5e                   	pop    %esi
+  802580:	5d                   	pop    %ebp
+  802581:	c3                   	ret
+		return -E_INVAL;
+  802582:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802587:	eb f2                	jmp    80257b <fsring_read+0x7a>
+
+00802589 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802589:	55                   	push   %ebp
+  80258a:	89 e5                	mov    %esp,%ebp
+  80258c:	56                   	push   %esi
+  80258d:	53                   	push   %ebx
+  80258e:	83 ec 10             	sub    $0x10,%esp
+  802591:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802594:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802597:	8b 45 08             	mov    0x8(%ebp),%eax
+  80259a:	e8 b5 f8 ff ff       	call   801e54 <fsring_slot>
+  80259f:	89 c3                	mov    %eax,%ebx
+  8025a1:	85 c0                	test   %eax,%eax
+  8025a3:	78 77                	js     80261c <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8025a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025a8:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8025ac:	74 77                	je     802625 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8025ae:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8025b3:	39 c6                	cmp    %eax,%esi
+  8025b5:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8025b8:	83 ec 04             	sub    $0x4,%esp
+  8025bb:	56                   	push   %esi
+  8025bc:	ff 75 0c             	push   0xc(%ebp)
+  8025bf:	89 d8                	mov    %ebx,%eax
+  8025c1:	c1 e0 0c             	shl    $0xc,%eax
+  8025c4:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8025ca:	50                   	push   %eax
+  8025cb:	e8 1c e6 ff ff       	call   800bec <memmove>
+	fsring_busy |= 1 << slot;
+  8025d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025d5:	89 d9                	mov    %ebx,%ecx
+  8025d7:	d3 e0                	shl    %cl,%eax
+  8025d9:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8025df:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8025e2:	c1 e0 02             	shl    $0x2,%eax
+  8025e5:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  8025eb:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  8025f2:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8025f5:	8b 45 18             	mov    0x18(%ebp),%eax
+  8025f8:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8025fb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802602:	83 c4 08             	add    $0x8,%esp
+  802605:	53                   	push   %ebx
+  802606:	56                   	push   %esi
+  802607:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80260a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80260d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802612:	e8 7f f4 ff ff       	call   801a96 <fsring_post>
+  802617:	89 c3                	mov    %eax,%ebx
+  802619:	83 c4 10             	add    $0x10,%esp
+}
+  80261c:	89 d8                	mov    %ebx,%eax
+  80261e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802621:	5b                   	pop    %ebx
+  802622:	5e                   	pop    %esi
+  802623:	5d                   	pop    %ebp
+  802624:	c3                   	ret
+		return -E_INVAL;
+  802625:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80262a:	eb f0                	jmp    80261c <fsring_write+0x93>
+
+0080262c <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80262c:	55                   	push   %ebp
+  80262d:	89 e5                	mov    %esp,%ebp
+  80262f:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802632:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802635:	8b 45 08             	mov    0x8(%ebp),%eax
+  802638:	e8 17 f8 ff ff       	call   801e54 <fsring_slot>
+  80263d:	85 c0                	test   %eax,%eax
+  80263f:	78 4c                	js     80268d <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802641:	ba 01 00 00 00       	mov    $0x1,%edx
+  802646:	89 c1                	mov    %eax,%ecx
+  802648:	d3 e2                	shl    %cl,%edx
+  80264a:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802650:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802653:	c1 e2 02             	shl    $0x2,%edx
+  802656:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  80265c:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  802663:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802666:	8b 55 10             	mov    0x10(%ebp),%edx
+  802669:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80266c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80266f:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802672:	83 ec 08             	sub    $0x8,%esp
+  802675:	50                   	push   %eax
+  802676:	6a 00                	push   $0x0
+  802678:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80267d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802680:	b8 05 00 00 00       	mov    $0x5,%eax
+  802685:	e8 0c f4 ff ff       	call   801a96 <fsring_post>
+  80268a:	83 c4 10             	add    $0x10,%esp
+}
+  80268d:	c9                   	leave
+  80268e:	c3                   	ret
+
+0080268f <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  80268f:	55                   	push   %ebp
+  802690:	89 e5                	mov    %esp,%ebp
+  802692:	57                   	push   %edi
+  802693:	56                   	push   %esi
+  802694:	53                   	push   %ebx
+  802695:	83 ec 1c             	sub    $0x1c,%esp
+  802698:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80269c:	a1 00 60 80 00       	mov    0x806000,%eax
+  8026a1:	8b 40 48             	mov    0x48(%eax),%eax
+  8026a4:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  8026aa:	74 12                	je     8026be <fsring_reap+0x2f>
+		return 0;
+  8026ac:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8026b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026b4:	5b                   	pop    %ebx
+  8026b5:	5e                   	pop    %esi
+  8026b6:	5f                   	pop    %edi
+  8026b7:	5d                   	pop    %ebp
+  8026b8:	c3                   	ret
+		sys_yield();
+  8026b9:	e8 95 e7 ff ff       	call   800e53 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8026be:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8026c4:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8026c9:	39 c2                	cmp    %eax,%edx
+  8026cb:	75 18                	jne    8026e5 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8026cd:	84 db                	test   %bl,%bl
+  8026cf:	0f 84 21 01 00 00    	je     8027f6 <fsring_reap+0x167>
+  8026d5:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  8026dc:	75 db                	jne    8026b9 <fsring_reap+0x2a>
+			return 0;
+  8026de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026e3:	eb cc                	jmp    8026b1 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8026e5:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8026ea:	83 e0 0f             	and    $0xf,%eax
+  8026ed:	83 c0 2a             	add    $0x2a,%eax
+  8026f0:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8026f7:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8026fe:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802703:	83 c0 01             	add    $0x1,%eax
+  802706:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  80270b:	83 fb 0f             	cmp    $0xf,%ebx
+  80270e:	77 5b                	ja     80276b <fsring_reap+0xdc>
+  802710:	be 01 00 00 00       	mov    $0x1,%esi
+  802715:	89 d9                	mov    %ebx,%ecx
+  802717:	d3 e6                	shl    %cl,%esi
+  802719:	89 f0                	mov    %esi,%eax
+  80271b:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  802721:	74 48                	je     80276b <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802723:	89 d8                	mov    %ebx,%eax
+  802725:	c1 e0 0c             	shl    $0xc,%eax
+  802728:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80272e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802731:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802734:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  80273b:	83 f8 03             	cmp    $0x3,%eax
+  80273e:	74 40                	je     802780 <fsring_reap+0xf1>
+  802740:	83 f8 05             	cmp    $0x5,%eax
+  802743:	74 64                	je     8027a9 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802745:	f7 d6                	not    %esi
+  802747:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  80274d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802750:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  802757:	8b 45 08             	mov    0x8(%ebp),%eax
+  80275a:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  80275c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80275f:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802761:	b8 01 00 00 00       	mov    $0x1,%eax
+  802766:	e9 46 ff ff ff       	jmp    8026b1 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80276b:	53                   	push   %ebx
+  80276c:	68 1d 42 80 00       	push   $0x80421d
+  802771:	68 8f 02 00 00       	push   $0x28f
+  802776:	68 f5 41 80 00       	push   $0x8041f5
+  80277b:	e8 1d dc ff ff       	call   80039d <_panic>
+		if (cqe.cqe_result > 0)
+  802780:	85 ff                	test   %edi,%edi
+  802782:	7e c1                	jle    802745 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802784:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802787:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80278c:	39 c7                	cmp    %eax,%edi
+  80278e:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802791:	50                   	push   %eax
+  802792:	ff 75 e4             	push   -0x1c(%ebp)
+  802795:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802798:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  80279f:	e8 48 e4 ff ff       	call   800bec <memmove>
+  8027a4:	83 c4 10             	add    $0x10,%esp
+  8027a7:	eb 9c                	jmp    802745 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8027a9:	85 ff                	test   %edi,%edi
+  8027ab:	75 98                	jne    802745 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  8027ad:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8027b0:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8027b7:	83 ec 08             	sub    $0x8,%esp
+  8027ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8027bd:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8027c0:	51                   	push   %ecx
+  8027c1:	e8 a0 e2 ff ff       	call   800a66 <strcpy>
+			st->st_size = ret->ret_size;
+  8027c6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8027c9:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8027cf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8027d2:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8027d8:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8027de:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8027e4:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  8027eb:	50 80 00 
+  8027ee:	83 c4 10             	add    $0x10,%esp
+  8027f1:	e9 4f ff ff ff       	jmp    802745 <fsring_reap+0xb6>
+			return 0;
+  8027f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027fb:	e9 b1 fe ff ff       	jmp    8026b1 <fsring_reap+0x22>
+
+00802800 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802800:	55                   	push   %ebp
+  802801:	89 e5                	mov    %esp,%ebp
+  802803:	57                   	push   %edi
+  802804:	56                   	push   %esi
+  802805:	53                   	push   %ebx
+  802806:	83 ec 28             	sub    $0x28,%esp
+  802809:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80280c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80280f:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802812:	53                   	push   %ebx
+  802813:	e8 13 e2 ff ff       	call   800a2b <strlen>
+  802818:	83 c4 10             	add    $0x10,%esp
+  80281b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802820:	0f 8f 02 01 00 00    	jg     802928 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802826:	83 ec 08             	sub    $0x8,%esp
+  802829:	53                   	push   %ebx
+  80282a:	68 00 70 80 00       	push   $0x807000
+  80282f:	e8 32 e2 ff ff       	call   800a66 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802834:	83 c4 10             	add    $0x10,%esp
+  802837:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  80283d:	76 69                	jbe    8028a8 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80283f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802842:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802848:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80284d:	29 d1                	sub    %edx,%ecx
+  80284f:	39 f9                	cmp    %edi,%ecx
+  802851:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802854:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802857:	89 f9                	mov    %edi,%ecx
+  802859:	01 c1                	add    %eax,%ecx
+  80285b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80285e:	eb 0f                	jmp    80286f <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802860:	0f b6 10             	movzbl (%eax),%edx
+  802863:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802865:	05 00 10 00 00       	add    $0x1000,%eax
+  80286a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80286f:	39 c8                	cmp    %ecx,%eax
+  802871:	72 ed                	jb     802860 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802873:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802876:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  80287c:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802882:	83 ec 0c             	sub    $0xc,%esp
+  802885:	6a 07                	push   $0x7
+  802887:	89 f9                	mov    %edi,%ecx
+  802889:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80288c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802891:	e8 3f f1 ff ff       	call   8019d5 <fsipc_pages>
+  802896:	89 c7                	mov    %eax,%edi
+  802898:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  80289b:	85 f6                	test   %esi,%esi
+  80289d:	74 7f                	je     80291e <file_slurp+0x11e>
+  80289f:	8d 43 01             	lea    0x1(%ebx),%eax
+  8028a2:	85 ff                	test   %edi,%edi
+  8028a4:	79 3c                	jns    8028e2 <file_slurp+0xe2>
+  8028a6:	eb 76                	jmp    80291e <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8028a8:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8028ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8028b8:	e8 ba f2 ff ff       	call   801b77 <fsipc>
+  8028bd:	89 c7                	mov    %eax,%edi
+  8028bf:	85 c0                	test   %eax,%eax
+  8028c1:	7e d8                	jle    80289b <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8028c3:	83 ec 04             	sub    $0x4,%esp
+  8028c6:	50                   	push   %eax
+  8028c7:	68 08 70 80 00       	push   $0x807008
+  8028cc:	ff 75 0c             	push   0xc(%ebp)
+  8028cf:	e8 18 e3 ff ff       	call   800bec <memmove>
+  8028d4:	83 c4 10             	add    $0x10,%esp
+  8028d7:	eb c2                	jmp    80289b <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8028d9:	80 fa 2f             	cmp    $0x2f,%dl
+  8028dc:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8028df:	83 c0 01             	add    $0x1,%eax
+  8028e2:	89 c1                	mov    %eax,%ecx
+  8028e4:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8028e8:	84 d2                	test   %dl,%dl
+  8028ea:	75 ed                	jne    8028d9 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8028ec:	83 ec 04             	sub    $0x4,%esp
+  8028ef:	68 80 00 00 00       	push   $0x80
+  8028f4:	53                   	push   %ebx
+  8028f5:	56                   	push   %esi
+  8028f6:	e8 e1 e1 ff ff       	call   800adc <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8028fb:	a1 00 70 80 00       	mov    0x807000,%eax
+  802900:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802906:	a1 04 70 80 00       	mov    0x807004,%eax
+  80290b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802911:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  802918:	50 80 00 
+  80291b:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80291e:	89 f8                	mov    %edi,%eax
+  802920:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802923:	5b                   	pop    %ebx
+  802924:	5e                   	pop    %esi
+  802925:	5f                   	pop    %edi
+  802926:	5d                   	pop    %ebp
+  802927:	c3                   	ret
+		return -E_BAD_PATH;
+  802928:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  80292d:	eb ef                	jmp    80291e <file_slurp+0x11e>
+
+0080292f <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80292f:	55                   	push   %ebp
+  802930:	89 e5                	mov    %esp,%ebp
+  802932:	53                   	push   %ebx
+  802933:	83 ec 10             	sub    $0x10,%esp
+  802936:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802939:	53                   	push   %ebx
+  80293a:	e8 ec e0 ff ff       	call   800a2b <strlen>
+  80293f:	83 c4 10             	add    $0x10,%esp
+  802942:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802947:	7f 25                	jg     80296e <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802949:	83 ec 08             	sub    $0x8,%esp
+  80294c:	53                   	push   %ebx
+  80294d:	68 00 70 80 00       	push   $0x807000
+  802952:	e8 0f e1 ff ff       	call   800a66 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802957:	ba 00 00 00 00       	mov    $0x0,%edx
+  80295c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802961:	e8 11 f2 ff ff       	call   801b77 <fsipc>
+  802966:	83 c4 10             	add    $0x10,%esp
+}
+  802969:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80296c:	c9                   	leave
+  80296d:	c3                   	ret
+		return -E_BAD_PATH;
+  80296e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802973:	eb f4                	jmp    802969 <remove+0x3a>
+
+00802975 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802975:	55                   	push   %ebp
+  802976:	89 e5                	mov    %esp,%ebp
+  802978:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80297b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802980:	b8 08 00 00 00       	mov    $0x8,%eax
+  802985:	e8 ed f1 ff ff       	call   801b77 <fsipc>
+}
+  80298a:	c9                   	leave
+  80298b:	c3                   	ret
+
+0080298c <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  80298c:	55                   	push   %ebp
+  80298d:	89 e5                	mov    %esp,%ebp
+  80298f:	57                   	push   %edi
+  802990:	56                   	push   %esi
+  802991:	53                   	push   %ebx
+  802992:	83 ec 18             	sub    $0x18,%esp
+  802995:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802998:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80299b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80299e:	57                   	push   %edi
+  80299f:	e8 87 e0 ff ff       	call   800a2b <strlen>
+  8029a4:	83 c4 10             	add    $0x10,%esp
+  8029a7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8029ac:	7f 4c                	jg     8029fa <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  8029ae:	83 ec 08             	sub    $0x8,%esp
+  8029b1:	57                   	push   %edi
+  8029b2:	68 00 70 80 00       	push   $0x807000
+  8029b7:	e8 aa e0 ff ff       	call   800a66 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  8029bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029c1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8029c6:	e8 ac f1 ff ff       	call   801b77 <fsipc>
+  8029cb:	83 c4 10             	add    $0x10,%esp
+  8029ce:	85 c0                	test   %eax,%eax
+  8029d0:	78 20                	js     8029f2 <defrag+0x66>
+		return r;
+	if (before)
+  8029d2:	85 f6                	test   %esi,%esi
+  8029d4:	74 07                	je     8029dd <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  8029d6:	a1 00 70 80 00       	mov    0x807000,%eax
+  8029db:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  8029dd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  8029e2:	85 db                	test   %ebx,%ebx
+  8029e4:	74 0c                	je     8029f2 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  8029e6:	a1 04 70 80 00       	mov    0x807004,%eax
+  8029eb:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8029ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029f5:	5b                   	pop    %ebx
+  8029f6:	5e                   	pop    %esi
+  8029f7:	5f                   	pop    %edi
+  8029f8:	5d                   	pop    %ebp
+  8029f9:	c3                   	ret
+		return -E_BAD_PATH;
+  8029fa:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8029ff:	eb f1                	jmp    8029f2 <defrag+0x66>
+
+00802a01 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802a01:	55                   	push   %ebp
+  802a02:	89 e5                	mov    %esp,%ebp
+  802a04:	53                   	push   %ebx
+  802a05:	83 ec 04             	sub    $0x4,%esp
+  802a08:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802a0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a10:	b8 11 00 00 00       	mov    $0x11,%eax
+  802a15:	e8 5d f1 ff ff       	call   801b77 <fsipc>
+  802a1a:	85 c0                	test   %eax,%eax
+  802a1c:	78 34                	js     802a52 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802a1e:	a1 00 70 80 00       	mov    0x807000,%eax
+  802a23:	89 03                	mov    %eax,(%ebx)
+  802a25:	a1 04 70 80 00       	mov    0x807004,%eax
+  802a2a:	89 43 04             	mov    %eax,0x4(%ebx)
+  802a2d:	a1 08 70 80 00       	mov    0x807008,%eax
+  802a32:	89 43 08             	mov    %eax,0x8(%ebx)
+  802a35:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  802a3a:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802a3d:	a1 10 70 80 00       	mov    0x807010,%eax
+  802a42:	89 43 10             	mov    %eax,0x10(%ebx)
+  802a45:	a1 14 70 80 00       	mov    0x807014,%eax
+  802a4a:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a55:	c9                   	leave
+  802a56:	c3                   	ret
+
+00802a57 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  802a57:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802a5b:	7f 01                	jg     802a5e <writebuf+0x7>
+  802a5d:	c3                   	ret
+{
+  802a5e:	55                   	push   %ebp
+  802a5f:	89 e5                	mov    %esp,%ebp
+  802a61:	53                   	push   %ebx
+  802a62:	83 ec 08             	sub    $0x8,%esp
+  802a65:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  802a67:	ff 70 04             	push   0x4(%eax)
+  802a6a:	8d 40 10             	lea    0x10(%eax),%eax
+  802a6d:	50                   	push   %eax
+  802a6e:	ff 33                	push   (%ebx)
+  802a70:	e8 fe ec ff ff       	call   801773 <write>
+		if (result > 0)
+  802a75:	83 c4 10             	add    $0x10,%esp
+  802a78:	85 c0                	test   %eax,%eax
+  802a7a:	7e 03                	jle    802a7f <writebuf+0x28>
+			b->result += result;
+  802a7c:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802a7f:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802a82:	74 0d                	je     802a91 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802a84:	85 c0                	test   %eax,%eax
+  802a86:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a8b:	0f 4f c2             	cmovg  %edx,%eax
+  802a8e:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802a91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a94:	c9                   	leave
+  802a95:	c3                   	ret
+
+00802a96 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802a96:	55                   	push   %ebp
+  802a97:	89 e5                	mov    %esp,%ebp
+  802a99:	53                   	push   %ebx
+  802a9a:	83 ec 04             	sub    $0x4,%esp
+  802a9d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802aa0:	8b 53 04             	mov    0x4(%ebx),%edx
+  802aa3:	8d 42 01             	lea    0x1(%edx),%eax
+  802aa6:	89 43 04             	mov    %eax,0x4(%ebx)
+  802aa9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802aac:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802ab0:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802ab5:	74 05                	je     802abc <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  802ab7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aba:	c9                   	leave
+  802abb:	c3                   	ret
+		writebuf(b);
+  802abc:	89 d8                	mov    %ebx,%eax
+  802abe:	e8 94 ff ff ff       	call   802a57 <writebuf>
+		b->idx = 0;
+  802ac3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  802aca:	eb eb                	jmp    802ab7 <putch+0x21>
+
+00802acc <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802acc:	55                   	push   %ebp
+  802acd:	89 e5                	mov    %esp,%ebp
+  802acf:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  802ad5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad8:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  802ade:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  802ae5:	00 00 00 
+	b.result = 0;
+  802ae8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802aef:	00 00 00 
+	b.error = 1;
+  802af2:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  802af9:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  802afc:	ff 75 10             	push   0x10(%ebp)
+  802aff:	ff 75 0c             	push   0xc(%ebp)
+  802b02:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802b08:	50                   	push   %eax
+  802b09:	68 96 2a 80 00       	push   $0x802a96
+  802b0e:	e8 5c da ff ff       	call   80056f <vprintfmt>
+	if (b.idx > 0)
+  802b13:	83 c4 10             	add    $0x10,%esp
+  802b16:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802b1d:	7f 12                	jg     802b31 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  802b1f:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802b25:	85 c0                	test   %eax,%eax
+  802b27:	75 06                	jne    802b2f <vfprintf+0x63>
+  802b29:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  802b2f:	c9                   	leave
+  802b30:	c3                   	ret
+		writebuf(&b);
+  802b31:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802b37:	e8 1b ff ff ff       	call   802a57 <writebuf>
+  802b3c:	eb e1                	jmp    802b1f <vfprintf+0x53>
+
+00802b3e <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802b3e:	55                   	push   %ebp
+  802b3f:	89 e5                	mov    %esp,%ebp
+  802b41:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802b44:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  802b47:	50                   	push   %eax
+  802b48:	ff 75 0c             	push   0xc(%ebp)
+  802b4b:	ff 75 08             	push   0x8(%ebp)
+  802b4e:	e8 79 ff ff ff       	call   802acc <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802b53:	c9                   	leave
+  802b54:	c3                   	ret
+
+00802b55 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802b55:	55                   	push   %ebp
+  802b56:	89 e5                	mov    %esp,%ebp
+  802b58:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802b5b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  802b5e:	50                   	push   %eax
+  802b5f:	ff 75 08             	push   0x8(%ebp)
+  802b62:	6a 01                	push   $0x1
+  802b64:	e8 63 ff ff ff       	call   802acc <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802b69:	c9                   	leave
+  802b6a:	c3                   	ret
+
+00802b6b <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b6b:	55                   	push   %ebp
+  802b6c:	89 e5                	mov    %esp,%ebp
+  802b6e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802b71:	68 36 42 80 00       	push   $0x804236
+  802b76:	ff 75 0c             	push   0xc(%ebp)
+  802b79:	e8 e8 de ff ff       	call   800a66 <strcpy>
+	return 0;
+}
+  802b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b83:	c9                   	leave
+  802b84:	c3                   	ret
+
+00802b85 <devsock_close>:
+{
+  802b85:	55                   	push   %ebp
+  802b86:	89 e5                	mov    %esp,%ebp
+  802b88:	53                   	push   %ebx
+  802b89:	83 ec 10             	sub    $0x10,%esp
+  802b8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802b8f:	53                   	push   %ebx
+  802b90:	e8 f4 0d 00 00       	call   803989 <pageref>
+  802b95:	89 c2                	mov    %eax,%edx
+  802b97:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802b9f:	83 fa 01             	cmp    $0x1,%edx
+  802ba2:	74 05                	je     802ba9 <devsock_close+0x24>
+}
+  802ba4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ba7:	c9                   	leave
+  802ba8:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802ba9:	83 ec 0c             	sub    $0xc,%esp
+  802bac:	ff 73 0c             	push   0xc(%ebx)
+  802baf:	e8 b7 02 00 00       	call   802e6b <nsipc_close>
+  802bb4:	83 c4 10             	add    $0x10,%esp
+  802bb7:	eb eb                	jmp    802ba4 <devsock_close+0x1f>
+
+00802bb9 <devsock_write>:
+{
+  802bb9:	55                   	push   %ebp
+  802bba:	89 e5                	mov    %esp,%ebp
+  802bbc:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802bbf:	6a 00                	push   $0x0
+  802bc1:	ff 75 10             	push   0x10(%ebp)
+  802bc4:	ff 75 0c             	push   0xc(%ebp)
+  802bc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bca:	ff 70 0c             	push   0xc(%eax)
+  802bcd:	e8 79 03 00 00       	call   802f4b <nsipc_send>
+}
+  802bd2:	c9                   	leave
+  802bd3:	c3                   	ret
+
+00802bd4 <devsock_read>:
+{
+  802bd4:	55                   	push   %ebp
+  802bd5:	89 e5                	mov    %esp,%ebp
+  802bd7:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802bda:	6a 00                	push   $0x0
+  802bdc:	ff 75 10             	push   0x10(%ebp)
+  802bdf:	ff 75 0c             	push   0xc(%ebp)
+  802be2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be5:	ff 70 0c             	push   0xc(%eax)
+  802be8:	e8 ef 02 00 00       	call   802edc <nsipc_recv>
+}
+  802bed:	c9                   	leave
+  802bee:	c3                   	ret
+
+00802bef <fd2sockid>:
+{
+  802bef:	55                   	push   %ebp
+  802bf0:	89 e5                	mov    %esp,%ebp
+  802bf2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802bf5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802bf8:	52                   	push   %edx
+  802bf9:	50                   	push   %eax
+  802bfa:	e8 40 e8 ff ff       	call   80143f <fd_lookup>
+  802bff:	83 c4 10             	add    $0x10,%esp
+  802c02:	85 c0                	test   %eax,%eax
+  802c04:	78 10                	js     802c16 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802c06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c09:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802c0f:	39 08                	cmp    %ecx,(%eax)
+  802c11:	75 05                	jne    802c18 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802c13:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802c16:	c9                   	leave
+  802c17:	c3                   	ret
+		return -E_NOT_SUPP;
+  802c18:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802c1d:	eb f7                	jmp    802c16 <fd2sockid+0x27>
+
+00802c1f <alloc_sockfd>:
+{
+  802c1f:	55                   	push   %ebp
+  802c20:	89 e5                	mov    %esp,%ebp
+  802c22:	56                   	push   %esi
+  802c23:	53                   	push   %ebx
+  802c24:	83 ec 1c             	sub    $0x1c,%esp
+  802c27:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802c29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c2c:	50                   	push   %eax
+  802c2d:	e8 b7 e7 ff ff       	call   8013e9 <fd_alloc>
+  802c32:	89 c3                	mov    %eax,%ebx
+  802c34:	83 c4 10             	add    $0x10,%esp
+  802c37:	85 c0                	test   %eax,%eax
+  802c39:	78 43                	js     802c7e <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802c3b:	83 ec 04             	sub    $0x4,%esp
+  802c3e:	68 07 04 00 00       	push   $0x407
+  802c43:	ff 75 f4             	push   -0xc(%ebp)
+  802c46:	6a 00                	push   $0x0
+  802c48:	e8 25 e2 ff ff       	call   800e72 <sys_page_alloc>
+  802c4d:	89 c3                	mov    %eax,%ebx
+  802c4f:	83 c4 10             	add    $0x10,%esp
+  802c52:	85 c0                	test   %eax,%eax
+  802c54:	78 28                	js     802c7e <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802c56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c59:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802c5f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802c61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c64:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802c6b:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802c6e:	83 ec 0c             	sub    $0xc,%esp
+  802c71:	50                   	push   %eax
+  802c72:	e8 4b e7 ff ff       	call   8013c2 <fd2num>
+  802c77:	89 c3                	mov    %eax,%ebx
+  802c79:	83 c4 10             	add    $0x10,%esp
+  802c7c:	eb 0c                	jmp    802c8a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802c7e:	83 ec 0c             	sub    $0xc,%esp
+  802c81:	56                   	push   %esi
+  802c82:	e8 e4 01 00 00       	call   802e6b <nsipc_close>
+		return r;
+  802c87:	83 c4 10             	add    $0x10,%esp
+}
+  802c8a:	89 d8                	mov    %ebx,%eax
+  802c8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c8f:	5b                   	pop    %ebx
+  802c90:	5e                   	pop    %esi
+  802c91:	5d                   	pop    %ebp
+  802c92:	c3                   	ret
+
+00802c93 <accept>:
+{
+  802c93:	55                   	push   %ebp
+  802c94:	89 e5                	mov    %esp,%ebp
+  802c96:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c99:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9c:	e8 4e ff ff ff       	call   802bef <fd2sockid>
+  802ca1:	85 c0                	test   %eax,%eax
+  802ca3:	78 1b                	js     802cc0 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802ca5:	83 ec 04             	sub    $0x4,%esp
+  802ca8:	ff 75 10             	push   0x10(%ebp)
+  802cab:	ff 75 0c             	push   0xc(%ebp)
+  802cae:	50                   	push   %eax
+  802caf:	e8 0e 01 00 00       	call   802dc2 <nsipc_accept>
+  802cb4:	83 c4 10             	add    $0x10,%esp
+  802cb7:	85 c0                	test   %eax,%eax
+  802cb9:	78 05                	js     802cc0 <accept+0x2d>
+	return alloc_sockfd(r);
+  802cbb:	e8 5f ff ff ff       	call   802c1f <alloc_sockfd>
+}
+  802cc0:	c9                   	leave
+  802cc1:	c3                   	ret
+
+00802cc2 <bind>:
+{
+  802cc2:	55                   	push   %ebp
+  802cc3:	89 e5                	mov    %esp,%ebp
+  802cc5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802cc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ccb:	e8 1f ff ff ff       	call   802bef <fd2sockid>
+  802cd0:	85 c0                	test   %eax,%eax
+  802cd2:	78 12                	js     802ce6 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802cd4:	83 ec 04             	sub    $0x4,%esp
+  802cd7:	ff 75 10             	push   0x10(%ebp)
+  802cda:	ff 75 0c             	push   0xc(%ebp)
+  802cdd:	50                   	push   %eax
+  802cde:	e8 31 01 00 00       	call   802e14 <nsipc_bind>
+  802ce3:	83 c4 10             	add    $0x10,%esp
+}
+  802ce6:	c9                   	leave
+  802ce7:	c3                   	ret
+
+00802ce8 <shutdown>:
+{
+  802ce8:	55                   	push   %ebp
+  802ce9:	89 e5                	mov    %esp,%ebp
+  802ceb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802cee:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf1:	e8 f9 fe ff ff       	call   802bef <fd2sockid>
+  802cf6:	85 c0                	test   %eax,%eax
+  802cf8:	78 0f                	js     802d09 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802cfa:	83 ec 08             	sub    $0x8,%esp
+  802cfd:	ff 75 0c             	push   0xc(%ebp)
+  802d00:	50                   	push   %eax
+  802d01:	e8 43 01 00 00       	call   802e49 <nsipc_shutdown>
+  802d06:	83 c4 10             	add    $0x10,%esp
+}
+  802d09:	c9                   	leave
+  802d0a:	c3                   	ret
+
+00802d0b <connect>:
+{
+  802d0b:	55                   	push   %ebp
+  802d0c:	89 e5                	mov    %esp,%ebp
+  802d0e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d11:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d14:	e8 d6 fe ff ff       	call   802bef <fd2sockid>
+  802d19:	85 c0                	test   %eax,%eax
+  802d1b:	78 12                	js     802d2f <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802d1d:	83 ec 04             	sub    $0x4,%esp
+  802d20:	ff 75 10             	push   0x10(%ebp)
+  802d23:	ff 75 0c             	push   0xc(%ebp)
+  802d26:	50                   	push   %eax
+  802d27:	e8 59 01 00 00       	call   802e85 <nsipc_connect>
+  802d2c:	83 c4 10             	add    $0x10,%esp
+}
+  802d2f:	c9                   	leave
+  802d30:	c3                   	ret
+
+00802d31 <listen>:
+{
+  802d31:	55                   	push   %ebp
+  802d32:	89 e5                	mov    %esp,%ebp
+  802d34:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d37:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d3a:	e8 b0 fe ff ff       	call   802bef <fd2sockid>
+  802d3f:	85 c0                	test   %eax,%eax
+  802d41:	78 0f                	js     802d52 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802d43:	83 ec 08             	sub    $0x8,%esp
+  802d46:	ff 75 0c             	push   0xc(%ebp)
+  802d49:	50                   	push   %eax
+  802d4a:	e8 6b 01 00 00       	call   802eba <nsipc_listen>
+  802d4f:	83 c4 10             	add    $0x10,%esp
+}
+  802d52:	c9                   	leave
+  802d53:	c3                   	ret
+
+00802d54 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802d54:	55                   	push   %ebp
+  802d55:	89 e5                	mov    %esp,%ebp
+  802d57:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802d5a:	ff 75 10             	push   0x10(%ebp)
+  802d5d:	ff 75 0c             	push   0xc(%ebp)
+  802d60:	ff 75 08             	push   0x8(%ebp)
+  802d63:	e8 41 02 00 00       	call   802fa9 <nsipc_socket>
+  802d68:	83 c4 10             	add    $0x10,%esp
+  802d6b:	85 c0                	test   %eax,%eax
+  802d6d:	78 05                	js     802d74 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802d6f:	e8 ab fe ff ff       	call   802c1f <alloc_sockfd>
+}
+  802d74:	c9                   	leave
+  802d75:	c3                   	ret
+
+00802d76 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802d76:	55                   	push   %ebp
+  802d77:	89 e5                	mov    %esp,%ebp
+  802d79:	53                   	push   %ebx
+  802d7a:	83 ec 04             	sub    $0x4,%esp
+  802d7d:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802d7f:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802d86:	74 26                	je     802dae <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802d88:	6a 07                	push   $0x7
+  802d8a:	68 00 90 80 00       	push   $0x809000
+  802d8f:	53                   	push   %ebx
+  802d90:	ff 35 00 a0 80 00    	push   0x80a000
+  802d96:	e8 76 0a 00 00       	call   803811 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802d9b:	83 c4 0c             	add    $0xc,%esp
+  802d9e:	6a 00                	push   $0x0
+  802da0:	6a 00                	push   $0x0
+  802da2:	6a 00                	push   $0x0
+  802da4:	e8 fd 09 00 00       	call   8037a6 <ipc_recv>
+}
+  802da9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dac:	c9                   	leave
+  802dad:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802dae:	83 ec 0c             	sub    $0xc,%esp
+  802db1:	6a 02                	push   $0x2
+  802db3:	e8 92 0b 00 00       	call   80394a <ipc_find_env>
+  802db8:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  802dbd:	83 c4 10             	add    $0x10,%esp
+  802dc0:	eb c6                	jmp    802d88 <nsipc+0x12>
+
+00802dc2 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802dc2:	55                   	push   %ebp
+  802dc3:	89 e5                	mov    %esp,%ebp
+  802dc5:	56                   	push   %esi
+  802dc6:	53                   	push   %ebx
+  802dc7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802dca:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dcd:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802dd2:	8b 06                	mov    (%esi),%eax
+  802dd4:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802dd9:	b8 01 00 00 00       	mov    $0x1,%eax
+  802dde:	e8 93 ff ff ff       	call   802d76 <nsipc>
+  802de3:	89 c3                	mov    %eax,%ebx
+  802de5:	85 c0                	test   %eax,%eax
+  802de7:	79 09                	jns    802df2 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802de9:	89 d8                	mov    %ebx,%eax
+  802deb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dee:	5b                   	pop    %ebx
+  802def:	5e                   	pop    %esi
+  802df0:	5d                   	pop    %ebp
+  802df1:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802df2:	83 ec 04             	sub    $0x4,%esp
+  802df5:	ff 35 10 90 80 00    	push   0x809010
+  802dfb:	68 00 90 80 00       	push   $0x809000
+  802e00:	ff 75 0c             	push   0xc(%ebp)
+  802e03:	e8 e4 dd ff ff       	call   800bec <memmove>
+		*addrlen = ret->ret_addrlen;
+  802e08:	a1 10 90 80 00       	mov    0x809010,%eax
+  802e0d:	89 06                	mov    %eax,(%esi)
+  802e0f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802e12:	eb d5                	jmp    802de9 <nsipc_accept+0x27>
+
+00802e14 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802e14:	55                   	push   %ebp
+  802e15:	89 e5                	mov    %esp,%ebp
+  802e17:	53                   	push   %ebx
+  802e18:	83 ec 08             	sub    $0x8,%esp
+  802e1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802e1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e21:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802e26:	53                   	push   %ebx
+  802e27:	ff 75 0c             	push   0xc(%ebp)
+  802e2a:	68 04 90 80 00       	push   $0x809004
+  802e2f:	e8 b8 dd ff ff       	call   800bec <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802e34:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802e3a:	b8 02 00 00 00       	mov    $0x2,%eax
+  802e3f:	e8 32 ff ff ff       	call   802d76 <nsipc>
+}
+  802e44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e47:	c9                   	leave
+  802e48:	c3                   	ret
+
+00802e49 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802e49:	55                   	push   %ebp
+  802e4a:	89 e5                	mov    %esp,%ebp
+  802e4c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802e4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e52:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802e57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e5a:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802e5f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e64:	e8 0d ff ff ff       	call   802d76 <nsipc>
+}
+  802e69:	c9                   	leave
+  802e6a:	c3                   	ret
+
+00802e6b <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802e6b:	55                   	push   %ebp
+  802e6c:	89 e5                	mov    %esp,%ebp
+  802e6e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802e71:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e74:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802e79:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e7e:	e8 f3 fe ff ff       	call   802d76 <nsipc>
+}
+  802e83:	c9                   	leave
+  802e84:	c3                   	ret
+
+00802e85 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802e85:	55                   	push   %ebp
+  802e86:	89 e5                	mov    %esp,%ebp
+  802e88:	53                   	push   %ebx
+  802e89:	83 ec 08             	sub    $0x8,%esp
+  802e8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802e8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e92:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802e97:	53                   	push   %ebx
+  802e98:	ff 75 0c             	push   0xc(%ebp)
+  802e9b:	68 04 90 80 00       	push   $0x809004
+  802ea0:	e8 47 dd ff ff       	call   800bec <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802ea5:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802eab:	b8 05 00 00 00       	mov    $0x5,%eax
+  802eb0:	e8 c1 fe ff ff       	call   802d76 <nsipc>
+}
+  802eb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eb8:	c9                   	leave
+  802eb9:	c3                   	ret
+
+00802eba <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802eba:	55                   	push   %ebp
+  802ebb:	89 e5                	mov    %esp,%ebp
+  802ebd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802ec0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ec3:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802ec8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ecb:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802ed0:	b8 06 00 00 00       	mov    $0x6,%eax
+  802ed5:	e8 9c fe ff ff       	call   802d76 <nsipc>
+}
+  802eda:	c9                   	leave
+  802edb:	c3                   	ret
+
+00802edc <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802edc:	55                   	push   %ebp
+  802edd:	89 e5                	mov    %esp,%ebp
+  802edf:	56                   	push   %esi
+  802ee0:	53                   	push   %ebx
+  802ee1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802ee4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ee7:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802eec:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802ef2:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ef5:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802efa:	b8 07 00 00 00       	mov    $0x7,%eax
+  802eff:	e8 72 fe ff ff       	call   802d76 <nsipc>
+  802f04:	89 c3                	mov    %eax,%ebx
+  802f06:	85 c0                	test   %eax,%eax
+  802f08:	78 22                	js     802f2c <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802f0a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802f0f:	39 c6                	cmp    %eax,%esi
+  802f11:	0f 4e c6             	cmovle %esi,%eax
+  802f14:	39 c3                	cmp    %eax,%ebx
+  802f16:	7f 1d                	jg     802f35 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802f18:	83 ec 04             	sub    $0x4,%esp
+  802f1b:	53                   	push   %ebx
+  802f1c:	68 00 90 80 00       	push   $0x809000
+  802f21:	ff 75 0c             	push   0xc(%ebp)
+  802f24:	e8 c3 dc ff ff       	call   800bec <memmove>
+  802f29:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802f2c:	89 d8                	mov    %ebx,%eax
+  802f2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f31:	5b                   	pop    %ebx
+  802f32:	5e                   	pop    %esi
+  802f33:	5d                   	pop    %ebp
+  802f34:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802f35:	68 42 42 80 00       	push   $0x804242
+  802f3a:	68 e0 41 80 00       	push   $0x8041e0
+  802f3f:	6a 62                	push   $0x62
+  802f41:	68 57 42 80 00       	push   $0x804257
+  802f46:	e8 52 d4 ff ff       	call   80039d <_panic>
+
+00802f4b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802f4b:	55                   	push   %ebp
+  802f4c:	89 e5                	mov    %esp,%ebp
+  802f4e:	53                   	push   %ebx
+  802f4f:	83 ec 04             	sub    $0x4,%esp
+  802f52:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802f55:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f58:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802f5d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f63:	7f 2e                	jg     802f93 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802f65:	83 ec 04             	sub    $0x4,%esp
+  802f68:	53                   	push   %ebx
+  802f69:	ff 75 0c             	push   0xc(%ebp)
+  802f6c:	68 0c 90 80 00       	push   $0x80900c
+  802f71:	e8 76 dc ff ff       	call   800bec <memmove>
+	nsipcbuf.send.req_size = size;
+  802f76:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802f7c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f7f:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802f84:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f89:	e8 e8 fd ff ff       	call   802d76 <nsipc>
+}
+  802f8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f91:	c9                   	leave
+  802f92:	c3                   	ret
+	assert(size < 1600);
+  802f93:	68 63 42 80 00       	push   $0x804263
+  802f98:	68 e0 41 80 00       	push   $0x8041e0
+  802f9d:	6a 6d                	push   $0x6d
+  802f9f:	68 57 42 80 00       	push   $0x804257
+  802fa4:	e8 f4 d3 ff ff       	call   80039d <_panic>
+
+00802fa9 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802fa9:	55                   	push   %ebp
+  802faa:	89 e5                	mov    %esp,%ebp
+  802fac:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802faf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fb2:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802fb7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fba:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802fbf:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fc2:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802fc7:	b8 09 00 00 00       	mov    $0x9,%eax
+  802fcc:	e8 a5 fd ff ff       	call   802d76 <nsipc>
+}
+  802fd1:	c9                   	leave
+  802fd2:	c3                   	ret
+
+00802fd3 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802fd3:	55                   	push   %ebp
+  802fd4:	89 e5                	mov    %esp,%ebp
+  802fd6:	56                   	push   %esi
+  802fd7:	53                   	push   %ebx
+  802fd8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802fdb:	83 ec 0c             	sub    $0xc,%esp
+  802fde:	ff 75 08             	push   0x8(%ebp)
+  802fe1:	e8 ec e3 ff ff       	call   8013d2 <fd2data>
+  802fe6:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802fe8:	83 c4 08             	add    $0x8,%esp
+  802feb:	68 6f 42 80 00       	push   $0x80426f
+  802ff0:	53                   	push   %ebx
+  802ff1:	e8 70 da ff ff       	call   800a66 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802ff6:	8b 46 04             	mov    0x4(%esi),%eax
+  802ff9:	2b 06                	sub    (%esi),%eax
+  802ffb:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803001:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803008:	00 00 00 
+	stat->st_dev = &devpipe;
+  80300b:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  803012:	50 80 00 
+	return 0;
+}
+  803015:	b8 00 00 00 00       	mov    $0x0,%eax
+  80301a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80301d:	5b                   	pop    %ebx
+  80301e:	5e                   	pop    %esi
+  80301f:	5d                   	pop    %ebp
+  803020:	c3                   	ret
+
+00803021 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803021:	55                   	push   %ebp
+  803022:	89 e5                	mov    %esp,%ebp
+  803024:	53                   	push   %ebx
+  803025:	83 ec 0c             	sub    $0xc,%esp
+  803028:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80302b:	53                   	push   %ebx
+  80302c:	6a 00                	push   $0x0
+  80302e:	e8 cc de ff ff       	call   800eff <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803033:	89 1c 24             	mov    %ebx,(%esp)
+  803036:	e8 97 e3 ff ff       	call   8013d2 <fd2data>
+  80303b:	83 c4 08             	add    $0x8,%esp
+  80303e:	50                   	push   %eax
+  80303f:	6a 00                	push   $0x0
+  803041:	e8 b9 de ff ff       	call   800eff <sys_page_unmap>
+}
+  803046:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803049:	c9                   	leave
+  80304a:	c3                   	ret
+
+0080304b <_pipeisclosed>:
+{
+  80304b:	55                   	push   %ebp
+  80304c:	89 e5                	mov    %esp,%ebp
+  80304e:	57                   	push   %edi
+  80304f:	56                   	push   %esi
+  803050:	53                   	push   %ebx
+  803051:	83 ec 1c             	sub    $0x1c,%esp
+  803054:	89 c7                	mov    %eax,%edi
+  803056:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  803058:	a1 00 60 80 00       	mov    0x806000,%eax
+  80305d:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803060:	83 ec 0c             	sub    $0xc,%esp
+  803063:	57                   	push   %edi
+  803064:	e8 20 09 00 00       	call   803989 <pageref>
+  803069:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80306c:	89 34 24             	mov    %esi,(%esp)
+  80306f:	e8 15 09 00 00       	call   803989 <pageref>
+		nn = thisenv->env_runs;
+  803074:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80307a:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80307d:	83 c4 10             	add    $0x10,%esp
+  803080:	39 cb                	cmp    %ecx,%ebx
+  803082:	74 1b                	je     80309f <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  803084:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803087:	75 cf                	jne    803058 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803089:	8b 42 58             	mov    0x58(%edx),%eax
+  80308c:	6a 01                	push   $0x1
+  80308e:	50                   	push   %eax
+  80308f:	53                   	push   %ebx
+  803090:	68 76 42 80 00       	push   $0x804276
+  803095:	e8 de d3 ff ff       	call   800478 <cprintf>
+  80309a:	83 c4 10             	add    $0x10,%esp
+  80309d:	eb b9                	jmp    803058 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80309f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8030a2:	0f 94 c0             	sete   %al
+  8030a5:	0f b6 c0             	movzbl %al,%eax
+}
+  8030a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030ab:	5b                   	pop    %ebx
+  8030ac:	5e                   	pop    %esi
+  8030ad:	5f                   	pop    %edi
+  8030ae:	5d                   	pop    %ebp
+  8030af:	c3                   	ret
+
+008030b0 <devpipe_write>:
+{
+  8030b0:	55                   	push   %ebp
+  8030b1:	89 e5                	mov    %esp,%ebp
+  8030b3:	57                   	push   %edi
+  8030b4:	56                   	push   %esi
+  8030b5:	53                   	push   %ebx
+  8030b6:	83 ec 28             	sub    $0x28,%esp
+  8030b9:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8030bc:	56                   	push   %esi
+  8030bd:	e8 10 e3 ff ff       	call   8013d2 <fd2data>
+  8030c2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8030c4:	83 c4 10             	add    $0x10,%esp
+  8030c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030cc:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8030cf:	75 09                	jne    8030da <devpipe_write+0x2a>
+	return i;
+  8030d1:	89 f8                	mov    %edi,%eax
+  8030d3:	eb 23                	jmp    8030f8 <devpipe_write+0x48>
+			sys_yield();
+  8030d5:	e8 79 dd ff ff       	call   800e53 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8030da:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030dd:	8b 0b                	mov    (%ebx),%ecx
+  8030df:	8d 51 20             	lea    0x20(%ecx),%edx
+  8030e2:	39 d0                	cmp    %edx,%eax
+  8030e4:	72 1a                	jb     803100 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8030e6:	89 da                	mov    %ebx,%edx
+  8030e8:	89 f0                	mov    %esi,%eax
+  8030ea:	e8 5c ff ff ff       	call   80304b <_pipeisclosed>
+  8030ef:	85 c0                	test   %eax,%eax
+  8030f1:	74 e2                	je     8030d5 <devpipe_write+0x25>
+				return 0;
+  8030f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030fb:	5b                   	pop    %ebx
+  8030fc:	5e                   	pop    %esi
+  8030fd:	5f                   	pop    %edi
+  8030fe:	5d                   	pop    %ebp
+  8030ff:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803100:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803103:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803107:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80310a:	89 c2                	mov    %eax,%edx
+  80310c:	c1 fa 1f             	sar    $0x1f,%edx
+  80310f:	89 d1                	mov    %edx,%ecx
+  803111:	c1 e9 1b             	shr    $0x1b,%ecx
+  803114:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803117:	83 e2 1f             	and    $0x1f,%edx
+  80311a:	29 ca                	sub    %ecx,%edx
+  80311c:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803120:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803124:	83 c0 01             	add    $0x1,%eax
+  803127:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80312a:	83 c7 01             	add    $0x1,%edi
+  80312d:	eb 9d                	jmp    8030cc <devpipe_write+0x1c>
+
+0080312f <devpipe_read>:
+{
+  80312f:	55                   	push   %ebp
+  803130:	89 e5                	mov    %esp,%ebp
+  803132:	57                   	push   %edi
+  803133:	56                   	push   %esi
+  803134:	53                   	push   %ebx
+  803135:	83 ec 18             	sub    $0x18,%esp
+  803138:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80313b:	57                   	push   %edi
+  80313c:	e8 91 e2 ff ff       	call   8013d2 <fd2data>
+  803141:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803143:	83 c4 10             	add    $0x10,%esp
+  803146:	be 00 00 00 00       	mov    $0x0,%esi
+  80314b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80314e:	75 13                	jne    803163 <devpipe_read+0x34>
+	return i;
+  803150:	89 f0                	mov    %esi,%eax
+  803152:	eb 02                	jmp    803156 <devpipe_read+0x27>
+				return i;
+  803154:	89 f0                	mov    %esi,%eax
+}
+  803156:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803159:	5b                   	pop    %ebx
+  80315a:	5e                   	pop    %esi
+  80315b:	5f                   	pop    %edi
+  80315c:	5d                   	pop    %ebp
+  80315d:	c3                   	ret
+			sys_yield();
+  80315e:	e8 f0 dc ff ff       	call   800e53 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803163:	8b 03                	mov    (%ebx),%eax
+  803165:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803168:	75 18                	jne    803182 <devpipe_read+0x53>
+			if (i > 0)
+  80316a:	85 f6                	test   %esi,%esi
+  80316c:	75 e6                	jne    803154 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80316e:	89 da                	mov    %ebx,%edx
+  803170:	89 f8                	mov    %edi,%eax
+  803172:	e8 d4 fe ff ff       	call   80304b <_pipeisclosed>
+  803177:	85 c0                	test   %eax,%eax
+  803179:	74 e3                	je     80315e <devpipe_read+0x2f>
+				return 0;
+  80317b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803180:	eb d4                	jmp    803156 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803182:	99                   	cltd
+  803183:	c1 ea 1b             	shr    $0x1b,%edx
+  803186:	01 d0                	add    %edx,%eax
+  803188:	83 e0 1f             	and    $0x1f,%eax
+  80318b:	29 d0                	sub    %edx,%eax
+  80318d:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803192:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803195:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803198:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80319b:	83 c6 01             	add    $0x1,%esi
+  80319e:	eb ab                	jmp    80314b <devpipe_read+0x1c>
+
+008031a0 <pipe>:
+{
+  8031a0:	55                   	push   %ebp
+  8031a1:	89 e5                	mov    %esp,%ebp
+  8031a3:	56                   	push   %esi
+  8031a4:	53                   	push   %ebx
+  8031a5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8031a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031ab:	50                   	push   %eax
+  8031ac:	e8 38 e2 ff ff       	call   8013e9 <fd_alloc>
+  8031b1:	89 c3                	mov    %eax,%ebx
+  8031b3:	83 c4 10             	add    $0x10,%esp
+  8031b6:	85 c0                	test   %eax,%eax
+  8031b8:	0f 88 23 01 00 00    	js     8032e1 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031be:	83 ec 04             	sub    $0x4,%esp
+  8031c1:	68 07 04 00 00       	push   $0x407
+  8031c6:	ff 75 f4             	push   -0xc(%ebp)
+  8031c9:	6a 00                	push   $0x0
+  8031cb:	e8 a2 dc ff ff       	call   800e72 <sys_page_alloc>
+  8031d0:	89 c3                	mov    %eax,%ebx
+  8031d2:	83 c4 10             	add    $0x10,%esp
+  8031d5:	85 c0                	test   %eax,%eax
+  8031d7:	0f 88 04 01 00 00    	js     8032e1 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8031dd:	83 ec 0c             	sub    $0xc,%esp
+  8031e0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031e3:	50                   	push   %eax
+  8031e4:	e8 00 e2 ff ff       	call   8013e9 <fd_alloc>
+  8031e9:	89 c3                	mov    %eax,%ebx
+  8031eb:	83 c4 10             	add    $0x10,%esp
+  8031ee:	85 c0                	test   %eax,%eax
+  8031f0:	0f 88 db 00 00 00    	js     8032d1 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031f6:	83 ec 04             	sub    $0x4,%esp
+  8031f9:	68 07 04 00 00       	push   $0x407
+  8031fe:	ff 75 f0             	push   -0x10(%ebp)
+  803201:	6a 00                	push   $0x0
+  803203:	e8 6a dc ff ff       	call   800e72 <sys_page_alloc>
+  803208:	89 c3                	mov    %eax,%ebx
+  80320a:	83 c4 10             	add    $0x10,%esp
+  80320d:	85 c0                	test   %eax,%eax
+  80320f:	0f 88 bc 00 00 00    	js     8032d1 <pipe+0x131>
+	va = fd2data(fd0);
+  803215:	83 ec 0c             	sub    $0xc,%esp
+  803218:	ff 75 f4             	push   -0xc(%ebp)
+  80321b:	e8 b2 e1 ff ff       	call   8013d2 <fd2data>
+  803220:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803222:	83 c4 0c             	add    $0xc,%esp
+  803225:	68 07 04 00 00       	push   $0x407
+  80322a:	50                   	push   %eax
+  80322b:	6a 00                	push   $0x0
+  80322d:	e8 40 dc ff ff       	call   800e72 <sys_page_alloc>
+  803232:	89 c3                	mov    %eax,%ebx
+  803234:	83 c4 10             	add    $0x10,%esp
+  803237:	85 c0                	test   %eax,%eax
+  803239:	0f 88 82 00 00 00    	js     8032c1 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80323f:	83 ec 0c             	sub    $0xc,%esp
+  803242:	ff 75 f0             	push   -0x10(%ebp)
+  803245:	e8 88 e1 ff ff       	call   8013d2 <fd2data>
+  80324a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803251:	50                   	push   %eax
+  803252:	6a 00                	push   $0x0
+  803254:	56                   	push   %esi
+  803255:	6a 00                	push   $0x0
+  803257:	e8 61 dc ff ff       	call   800ebd <sys_page_map>
+  80325c:	89 c3                	mov    %eax,%ebx
+  80325e:	83 c4 20             	add    $0x20,%esp
+  803261:	85 c0                	test   %eax,%eax
+  803263:	78 4e                	js     8032b3 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803265:	a1 60 50 80 00       	mov    0x805060,%eax
+  80326a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80326d:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80326f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803272:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803279:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80327c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80327e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803281:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803288:	83 ec 0c             	sub    $0xc,%esp
+  80328b:	ff 75 f4             	push   -0xc(%ebp)
+  80328e:	e8 2f e1 ff ff       	call   8013c2 <fd2num>
+  803293:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803296:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803298:	83 c4 04             	add    $0x4,%esp
+  80329b:	ff 75 f0             	push   -0x10(%ebp)
+  80329e:	e8 1f e1 ff ff       	call   8013c2 <fd2num>
+  8032a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032a6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8032a9:	83 c4 10             	add    $0x10,%esp
+  8032ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032b1:	eb 2e                	jmp    8032e1 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8032b3:	83 ec 08             	sub    $0x8,%esp
+  8032b6:	56                   	push   %esi
+  8032b7:	6a 00                	push   $0x0
+  8032b9:	e8 41 dc ff ff       	call   800eff <sys_page_unmap>
+  8032be:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8032c1:	83 ec 08             	sub    $0x8,%esp
+  8032c4:	ff 75 f0             	push   -0x10(%ebp)
+  8032c7:	6a 00                	push   $0x0
+  8032c9:	e8 31 dc ff ff       	call   800eff <sys_page_unmap>
+  8032ce:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8032d1:	83 ec 08             	sub    $0x8,%esp
+  8032d4:	ff 75 f4             	push   -0xc(%ebp)
+  8032d7:	6a 00                	push   $0x0
+  8032d9:	e8 21 dc ff ff       	call   800eff <sys_page_unmap>
+  8032de:	83 c4 10             	add    $0x10,%esp
+}
+  8032e1:	89 d8                	mov    %ebx,%eax
+  8032e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032e6:	5b                   	pop    %ebx
+  8032e7:	5e                   	pop    %esi
+  8032e8:	5d                   	pop    %ebp
+  8032e9:	c3                   	ret
+
+008032ea <pipeisclosed>:
+{
+  8032ea:	55                   	push   %ebp
+  8032eb:	89 e5                	mov    %esp,%ebp
+  8032ed:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032f3:	50                   	push   %eax
+  8032f4:	ff 75 08             	push   0x8(%ebp)
+  8032f7:	e8 43 e1 ff ff       	call   80143f <fd_lookup>
+  8032fc:	83 c4 10             	add    $0x10,%esp
+  8032ff:	85 c0                	test   %eax,%eax
+  803301:	78 18                	js     80331b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803303:	83 ec 0c             	sub    $0xc,%esp
+  803306:	ff 75 f4             	push   -0xc(%ebp)
+  803309:	e8 c4 e0 ff ff       	call   8013d2 <fd2data>
+  80330e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803310:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803313:	e8 33 fd ff ff       	call   80304b <_pipeisclosed>
+  803318:	83 c4 10             	add    $0x10,%esp
+}
+  80331b:	c9                   	leave
+  80331c:	c3                   	ret
+
+0080331d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80331d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803322:	c3                   	ret
+
+00803323 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803323:	55                   	push   %ebp
+  803324:	89 e5                	mov    %esp,%ebp
+  803326:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803329:	68 8e 42 80 00       	push   $0x80428e
+  80332e:	ff 75 0c             	push   0xc(%ebp)
+  803331:	e8 30 d7 ff ff       	call   800a66 <strcpy>
+	return 0;
+}
+  803336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80333b:	c9                   	leave
+  80333c:	c3                   	ret
+
+0080333d <devcons_write>:
+{
+  80333d:	55                   	push   %ebp
+  80333e:	89 e5                	mov    %esp,%ebp
+  803340:	57                   	push   %edi
+  803341:	56                   	push   %esi
+  803342:	53                   	push   %ebx
+  803343:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803349:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80334e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803354:	eb 2e                	jmp    803384 <devcons_write+0x47>
+		m = n - tot;
+  803356:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803359:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80335b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803360:	39 c3                	cmp    %eax,%ebx
+  803362:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803365:	83 ec 04             	sub    $0x4,%esp
+  803368:	53                   	push   %ebx
+  803369:	89 f0                	mov    %esi,%eax
+  80336b:	03 45 0c             	add    0xc(%ebp),%eax
+  80336e:	50                   	push   %eax
+  80336f:	57                   	push   %edi
+  803370:	e8 77 d8 ff ff       	call   800bec <memmove>
+		sys_cputs(buf, m);
+  803375:	83 c4 08             	add    $0x8,%esp
+  803378:	53                   	push   %ebx
+  803379:	57                   	push   %edi
+  80337a:	e8 17 da ff ff       	call   800d96 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80337f:	01 de                	add    %ebx,%esi
+  803381:	83 c4 10             	add    $0x10,%esp
+  803384:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803387:	72 cd                	jb     803356 <devcons_write+0x19>
+}
+  803389:	89 f0                	mov    %esi,%eax
+  80338b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80338e:	5b                   	pop    %ebx
+  80338f:	5e                   	pop    %esi
+  803390:	5f                   	pop    %edi
+  803391:	5d                   	pop    %ebp
+  803392:	c3                   	ret
+
+00803393 <devcons_read>:
+{
+  803393:	55                   	push   %ebp
+  803394:	89 e5                	mov    %esp,%ebp
+  803396:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80339e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033a2:	75 07                	jne    8033ab <devcons_read+0x18>
+  8033a4:	eb 1f                	jmp    8033c5 <devcons_read+0x32>
+		sys_yield();
+  8033a6:	e8 a8 da ff ff       	call   800e53 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8033ab:	e8 0c da ff ff       	call   800dbc <sys_cgetc>
+  8033b0:	85 c0                	test   %eax,%eax
+  8033b2:	74 f2                	je     8033a6 <devcons_read+0x13>
+	if (c < 0)
+  8033b4:	78 0f                	js     8033c5 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8033b6:	83 f8 04             	cmp    $0x4,%eax
+  8033b9:	74 0c                	je     8033c7 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8033bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033be:	88 02                	mov    %al,(%edx)
+	return 1;
+  8033c0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8033c5:	c9                   	leave
+  8033c6:	c3                   	ret
+		return 0;
+  8033c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033cc:	eb f7                	jmp    8033c5 <devcons_read+0x32>
+
+008033ce <cputchar>:
+{
+  8033ce:	55                   	push   %ebp
+  8033cf:	89 e5                	mov    %esp,%ebp
+  8033d1:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8033d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033d7:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8033da:	6a 01                	push   $0x1
+  8033dc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033df:	50                   	push   %eax
+  8033e0:	e8 b1 d9 ff ff       	call   800d96 <sys_cputs>
+}
+  8033e5:	83 c4 10             	add    $0x10,%esp
+  8033e8:	c9                   	leave
+  8033e9:	c3                   	ret
+
+008033ea <getchar>:
+{
+  8033ea:	55                   	push   %ebp
+  8033eb:	89 e5                	mov    %esp,%ebp
+  8033ed:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8033f0:	6a 01                	push   $0x1
+  8033f2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033f5:	50                   	push   %eax
+  8033f6:	6a 00                	push   $0x0
+  8033f8:	e8 a8 e2 ff ff       	call   8016a5 <read>
+	if (r < 0)
+  8033fd:	83 c4 10             	add    $0x10,%esp
+  803400:	85 c0                	test   %eax,%eax
+  803402:	78 06                	js     80340a <getchar+0x20>
+	if (r < 1)
+  803404:	74 06                	je     80340c <getchar+0x22>
+	return c;
+  803406:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80340a:	c9                   	leave
+  80340b:	c3                   	ret
+		return -E_EOF;
+  80340c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803411:	eb f7                	jmp    80340a <getchar+0x20>
+
+00803413 <iscons>:
+{
+  803413:	55                   	push   %ebp
+  803414:	89 e5                	mov    %esp,%ebp
+  803416:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803419:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80341c:	50                   	push   %eax
+  80341d:	ff 75 08             	push   0x8(%ebp)
+  803420:	e8 1a e0 ff ff       	call   80143f <fd_lookup>
+  803425:	83 c4 10             	add    $0x10,%esp
+  803428:	85 c0                	test   %eax,%eax
+  80342a:	78 11                	js     80343d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80342c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80342f:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803435:	39 10                	cmp    %edx,(%eax)
+  803437:	0f 94 c0             	sete   %al
+  80343a:	0f b6 c0             	movzbl %al,%eax
+}
+  80343d:	c9                   	leave
+  80343e:	c3                   	ret
+
+0080343f <opencons>:
+{
+  80343f:	55                   	push   %ebp
+  803440:	89 e5                	mov    %esp,%ebp
+  803442:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803445:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803448:	50                   	push   %eax
+  803449:	e8 9b df ff ff       	call   8013e9 <fd_alloc>
+  80344e:	83 c4 10             	add    $0x10,%esp
+  803451:	85 c0                	test   %eax,%eax
+  803453:	78 3a                	js     80348f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803455:	83 ec 04             	sub    $0x4,%esp
+  803458:	68 07 04 00 00       	push   $0x407
+  80345d:	ff 75 f4             	push   -0xc(%ebp)
+  803460:	6a 00                	push   $0x0
+  803462:	e8 0b da ff ff       	call   800e72 <sys_page_alloc>
+  803467:	83 c4 10             	add    $0x10,%esp
+  80346a:	85 c0                	test   %eax,%eax
+  80346c:	78 21                	js     80348f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80346e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803471:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803477:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803479:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80347c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803483:	83 ec 0c             	sub    $0xc,%esp
+  803486:	50                   	push   %eax
+  803487:	e8 36 df ff ff       	call   8013c2 <fd2num>
+  80348c:	83 c4 10             	add    $0x10,%esp
+}
+  80348f:	c9                   	leave
+  803490:	c3                   	ret
+
+00803491 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  803491:	55                   	push   %ebp
+  803492:	89 e5                	mov    %esp,%ebp
+  803494:	57                   	push   %edi
+  803495:	56                   	push   %esi
+  803496:	53                   	push   %ebx
+  803497:	83 ec 20             	sub    $0x20,%esp
+  80349a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80349d:	89 d7                	mov    %edx,%edi
+  80349f:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  8034a1:	51                   	push   %ecx
+  8034a2:	68 00 f0 7f 00       	push   $0x7ff000
+  8034a7:	6a 00                	push   $0x0
+  8034a9:	e8 c4 d9 ff ff       	call   800e72 <sys_page_alloc>
+  8034ae:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8034b0:	83 c4 10             	add    $0x10,%esp
+  8034b3:	85 c0                	test   %eax,%eax
+  8034b5:	78 45                	js     8034fc <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  8034b7:	83 ec 04             	sub    $0x4,%esp
+  8034ba:	68 00 10 00 00       	push   $0x1000
+  8034bf:	57                   	push   %edi
+  8034c0:	68 00 f0 7f 00       	push   $0x7ff000
+  8034c5:	e8 22 d7 ff ff       	call   800bec <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8034ca:	89 34 24             	mov    %esi,(%esp)
+  8034cd:	57                   	push   %edi
+  8034ce:	ff 75 e4             	push   -0x1c(%ebp)
+  8034d1:	68 00 f0 7f 00       	push   $0x7ff000
+  8034d6:	6a 00                	push   $0x0
+  8034d8:	e8 e0 d9 ff ff       	call   800ebd <sys_page_map>
+  8034dd:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8034df:	83 c4 20             	add    $0x20,%esp
+  8034e2:	85 c0                	test   %eax,%eax
+  8034e4:	78 16                	js     8034fc <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8034e6:	83 ec 08             	sub    $0x8,%esp
+  8034e9:	68 00 f0 7f 00       	push   $0x7ff000
+  8034ee:	6a 00                	push   $0x0
+  8034f0:	e8 0a da ff ff       	call   800eff <sys_page_unmap>
+  8034f5:	83 c4 10             	add    $0x10,%esp
+  8034f8:	85 c0                	test   %eax,%eax
+  8034fa:	75 0a                	jne    803506 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8034fc:	89 d8                	mov    %ebx,%eax
+  8034fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803501:	5b                   	pop    %ebx
+  803502:	5e                   	pop    %esi
+  803503:	5f                   	pop    %edi
+  803504:	5d                   	pop    %ebp
+  803505:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803506:	68 9c 42 80 00       	push   $0x80429c
+  80350b:	68 e0 41 80 00       	push   $0x8041e0
+  803510:	6a 1b                	push   $0x1b
+  803512:	68 14 43 80 00       	push   $0x804314
+  803517:	e8 81 ce ff ff       	call   80039d <_panic>
+
+0080351c <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80351c:	55                   	push   %ebp
+  80351d:	89 e5                	mov    %esp,%ebp
+  80351f:	53                   	push   %ebx
+  803520:	83 ec 04             	sub    $0x4,%esp
+  803523:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803526:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803528:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  80352c:	74 21                	je     80354f <pgfault+0x33>
+  80352e:	89 d0                	mov    %edx,%eax
+  803530:	c1 e8 16             	shr    $0x16,%eax
+  803533:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80353a:	a8 01                	test   $0x1,%al
+  80353c:	74 11                	je     80354f <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  80353e:	89 d0                	mov    %edx,%eax
+  803540:	c1 e8 0c             	shr    $0xc,%eax
+  803543:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80354a:	f6 c4 08             	test   $0x8,%ah
+  80354d:	75 17                	jne    803566 <pgfault+0x4a>
+		if (pgfault_next) {
+  80354f:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  803554:	85 c0                	test   %eax,%eax
+  803556:	74 27                	je     80357f <pgfault+0x63>
+			pgfault_next(utf);
+  803558:	83 ec 0c             	sub    $0xc,%esp
+  80355b:	53                   	push   %ebx
+  80355c:	ff d0                	call   *%eax
+			return;
+  80355e:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803561:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803564:	c9                   	leave
+  803565:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803566:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80356c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803571:	b8 00 00 00 00       	mov    $0x0,%eax
+  803576:	e8 16 ff ff ff       	call   803491 <copy_page_to>
+  80357b:	85 c0                	test   %eax,%eax
+  80357d:	79 e2                	jns    803561 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  80357f:	a1 00 60 80 00       	mov    0x806000,%eax
+  803584:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803587:	ff 73 28             	push   0x28(%ebx)
+  80358a:	ff 33                	push   (%ebx)
+  80358c:	50                   	push   %eax
+  80358d:	68 c0 42 80 00       	push   $0x8042c0
+  803592:	e8 e1 ce ff ff       	call   800478 <cprintf>
+	sys_env_destroy(0);
+  803597:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80359e:	e8 40 d8 ff ff       	call   800de3 <sys_env_destroy>
+  8035a3:	83 c4 10             	add    $0x10,%esp
+  8035a6:	eb b9                	jmp    803561 <pgfault+0x45>
+
+008035a8 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8035a8:	55                   	push   %ebp
+  8035a9:	89 e5                	mov    %esp,%ebp
+  8035ab:	53                   	push   %ebx
+  8035ac:	83 ec 04             	sub    $0x4,%esp
+  8035af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8035b2:	a1 08 a0 80 00       	mov    0x80a008,%eax
+  8035b7:	3d 1c 35 80 00       	cmp    $0x80351c,%eax
+  8035bc:	74 15                	je     8035d3 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8035be:	a3 04 a0 80 00       	mov    %eax,0x80a004
+		set_pgfault_handler(pgfault);
+  8035c3:	83 ec 0c             	sub    $0xc,%esp
+  8035c6:	68 1c 35 80 00       	push   $0x80351c
+  8035cb:	e8 fb 03 00 00       	call   8039cb <set_pgfault_handler>
+  8035d0:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8035d3:	83 ec 0c             	sub    $0xc,%esp
+  8035d6:	68 05 08 00 00       	push   $0x805
+  8035db:	53                   	push   %ebx
+  8035dc:	6a 00                	push   $0x0
+  8035de:	53                   	push   %ebx
+  8035df:	6a 00                	push   $0x0
+  8035e1:	e8 d7 d8 ff ff       	call   800ebd <sys_page_map>
+}
+  8035e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035e9:	c9                   	leave
+  8035ea:	c3                   	ret
+
+008035eb <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8035eb:	55                   	push   %ebp
+  8035ec:	89 e5                	mov    %esp,%ebp
+  8035ee:	57                   	push   %edi
+  8035ef:	56                   	push   %esi
+  8035f0:	53                   	push   %ebx
+  8035f1:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8035f4:	68 1c 35 80 00       	push   $0x80351c
+  8035f9:	e8 cd 03 00 00       	call   8039cb <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8035fe:	b8 07 00 00 00       	mov    $0x7,%eax
+  803603:	cd 30                	int    $0x30
+  803605:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803608:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  80360b:	83 c4 10             	add    $0x10,%esp
+  80360e:	85 c0                	test   %eax,%eax
+  803610:	0f 88 6b 01 00 00    	js     803781 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803616:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  80361b:	75 37                	jne    803654 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80361d:	e8 0a d8 ff ff       	call   800e2c <sys_getenvid>
+  803622:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803627:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80362d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803632:	a3 00 60 80 00       	mov    %eax,0x806000
+		return 0;
+  803637:	e9 45 01 00 00       	jmp    803781 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  80363c:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803642:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803648:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80364e:	0f 87 ba 00 00 00    	ja     80370e <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803654:	89 d8                	mov    %ebx,%eax
+  803656:	c1 e8 16             	shr    $0x16,%eax
+  803659:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803660:	a8 01                	test   $0x1,%al
+  803662:	74 d8                	je     80363c <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803664:	89 d8                	mov    %ebx,%eax
+  803666:	c1 e8 0c             	shr    $0xc,%eax
+  803669:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803670:	f6 c2 01             	test   $0x1,%dl
+  803673:	74 cd                	je     803642 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803675:	89 da                	mov    %ebx,%edx
+  803677:	80 e6 df             	and    $0xdf,%dh
+  80367a:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803680:	74 c0                	je     803642 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803682:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803684:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80368b:	f6 c6 04             	test   $0x4,%dh
+  80368e:	75 53                	jne    8036e3 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803690:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803697:	f6 c6 08             	test   $0x8,%dh
+  80369a:	75 0c                	jne    8036a8 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80369c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8036a3:	f6 c2 02             	test   $0x2,%dl
+  8036a6:	74 3b                	je     8036e3 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8036a8:	83 ec 0c             	sub    $0xc,%esp
+  8036ab:	68 05 08 00 00       	push   $0x805
+  8036b0:	57                   	push   %edi
+  8036b1:	ff 75 e4             	push   -0x1c(%ebp)
+  8036b4:	57                   	push   %edi
+  8036b5:	6a 00                	push   $0x0
+  8036b7:	e8 01 d8 ff ff       	call   800ebd <sys_page_map>
+  8036bc:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8036be:	83 c4 20             	add    $0x20,%esp
+  8036c1:	85 c0                	test   %eax,%eax
+  8036c3:	0f 88 a7 00 00 00    	js     803770 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8036c9:	83 ec 0c             	sub    $0xc,%esp
+  8036cc:	68 05 08 00 00       	push   $0x805
+  8036d1:	57                   	push   %edi
+  8036d2:	6a 00                	push   $0x0
+  8036d4:	57                   	push   %edi
+  8036d5:	6a 00                	push   $0x0
+  8036d7:	e8 e1 d7 ff ff       	call   800ebd <sys_page_map>
+  8036dc:	89 c6                	mov    %eax,%esi
+	return r;
+  8036de:	83 c4 20             	add    $0x20,%esp
+  8036e1:	eb 21                	jmp    803704 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8036e3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8036ea:	83 ec 0c             	sub    $0xc,%esp
+  8036ed:	25 07 0e 00 00       	and    $0xe07,%eax
+  8036f2:	50                   	push   %eax
+  8036f3:	57                   	push   %edi
+  8036f4:	ff 75 e4             	push   -0x1c(%ebp)
+  8036f7:	57                   	push   %edi
+  8036f8:	6a 00                	push   $0x0
+  8036fa:	e8 be d7 ff ff       	call   800ebd <sys_page_map>
+  8036ff:	89 c6                	mov    %eax,%esi
+  803701:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  803704:	85 f6                	test   %esi,%esi
+  803706:	0f 89 36 ff ff ff    	jns    803642 <fork+0x57>
+  80370c:	eb 62                	jmp    803770 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80370e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803713:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  803718:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80371b:	89 f8                	mov    %edi,%eax
+  80371d:	e8 6f fd ff ff       	call   803491 <copy_page_to>
+  803722:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803724:	85 c0                	test   %eax,%eax
+  803726:	78 48                	js     803770 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803728:	83 ec 04             	sub    $0x4,%esp
+  80372b:	6a 07                	push   $0x7
+  80372d:	68 00 f0 bf ee       	push   $0xeebff000
+  803732:	57                   	push   %edi
+  803733:	e8 3a d7 ff ff       	call   800e72 <sys_page_alloc>
+  803738:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80373a:	83 c4 10             	add    $0x10,%esp
+  80373d:	85 c0                	test   %eax,%eax
+  80373f:	78 2f                	js     803770 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803741:	a1 00 60 80 00       	mov    0x806000,%eax
+  803746:	8b 40 64             	mov    0x64(%eax),%eax
+  803749:	83 ec 08             	sub    $0x8,%esp
+  80374c:	50                   	push   %eax
+  80374d:	57                   	push   %edi
+  80374e:	e8 8a d8 ff ff       	call   800fdd <sys_env_set_pgfault_upcall>
+  803753:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803755:	83 c4 10             	add    $0x10,%esp
+  803758:	85 c0                	test   %eax,%eax
+  80375a:	78 14                	js     803770 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80375c:	83 ec 08             	sub    $0x8,%esp
+  80375f:	6a 02                	push   $0x2
+  803761:	57                   	push   %edi
+  803762:	e8 e2 d7 ff ff       	call   800f49 <sys_env_set_status>
+  803767:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803769:	83 c4 10             	add    $0x10,%esp
+  80376c:	85 c0                	test   %eax,%eax
+  80376e:	79 11                	jns    803781 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803770:	83 ec 0c             	sub    $0xc,%esp
+  803773:	ff 75 e0             	push   -0x20(%ebp)
+  803776:	e8 68 d6 ff ff       	call   800de3 <sys_env_destroy>
+	return r;
+  80377b:	83 c4 10             	add    $0x10,%esp
+  80377e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803781:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803784:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803787:	5b                   	pop    %ebx
+  803788:	5e                   	pop    %esi
+  803789:	5f                   	pop    %edi
+  80378a:	5d                   	pop    %ebp
+  80378b:	c3                   	ret
+
+0080378c <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80378c:	55                   	push   %ebp
+  80378d:	89 e5                	mov    %esp,%ebp
+  80378f:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803792:	68 1f 43 80 00       	push   $0x80431f
+  803797:	68 bf 00 00 00       	push   $0xbf
+  80379c:	68 14 43 80 00       	push   $0x804314
+  8037a1:	e8 f7 cb ff ff       	call   80039d <_panic>
+
+008037a6 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8037a6:	55                   	push   %ebp
+  8037a7:	89 e5                	mov    %esp,%ebp
+  8037a9:	56                   	push   %esi
+  8037aa:	53                   	push   %ebx
+  8037ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8037ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8037b4:	85 c0                	test   %eax,%eax
+  8037b6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8037bb:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8037be:	83 ec 0c             	sub    $0xc,%esp
+  8037c1:	50                   	push   %eax
+  8037c2:	e8 f3 d8 ff ff       	call   8010ba <sys_ipc_recv>
+	if (from_env_store)
+  8037c7:	83 c4 10             	add    $0x10,%esp
+  8037ca:	85 f6                	test   %esi,%esi
+  8037cc:	74 14                	je     8037e2 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8037ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037d3:	85 c0                	test   %eax,%eax
+  8037d5:	75 09                	jne    8037e0 <ipc_recv+0x3a>
+  8037d7:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8037dd:	8b 52 74             	mov    0x74(%edx),%edx
+  8037e0:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8037e2:	85 db                	test   %ebx,%ebx
+  8037e4:	74 25                	je     80380b <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8037e6:	85 c0                	test   %eax,%eax
+  8037e8:	74 0d                	je     8037f7 <ipc_recv+0x51>
+  8037ea:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8037f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8037f3:	5b                   	pop    %ebx
+  8037f4:	5e                   	pop    %esi
+  8037f5:	5d                   	pop    %ebp
+  8037f6:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8037f7:	a1 00 60 80 00       	mov    0x806000,%eax
+  8037fc:	8b 40 78             	mov    0x78(%eax),%eax
+  8037ff:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803801:	a1 00 60 80 00       	mov    0x806000,%eax
+  803806:	8b 40 70             	mov    0x70(%eax),%eax
+  803809:	eb e5                	jmp    8037f0 <ipc_recv+0x4a>
+  80380b:	85 c0                	test   %eax,%eax
+  80380d:	75 e1                	jne    8037f0 <ipc_recv+0x4a>
+  80380f:	eb f0                	jmp    803801 <ipc_recv+0x5b>
+
+00803811 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803811:	55                   	push   %ebp
+  803812:	89 e5                	mov    %esp,%ebp
+  803814:	57                   	push   %edi
+  803815:	56                   	push   %esi
+  803816:	53                   	push   %ebx
+  803817:	83 ec 0c             	sub    $0xc,%esp
+  80381a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80381d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803820:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803823:	85 db                	test   %ebx,%ebx
+  803825:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80382a:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80382d:	ff 75 14             	push   0x14(%ebp)
+  803830:	53                   	push   %ebx
+  803831:	56                   	push   %esi
+  803832:	57                   	push   %edi
+  803833:	e8 ef d7 ff ff       	call   801027 <sys_ipc_try_send>
+  803838:	83 c4 10             	add    $0x10,%esp
+  80383b:	85 c0                	test   %eax,%eax
+  80383d:	74 22                	je     803861 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  80383f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803842:	75 07                	jne    80384b <ipc_send+0x3a>
+		sys_yield();
+  803844:	e8 0a d6 ff ff       	call   800e53 <sys_yield>
+  803849:	eb e2                	jmp    80382d <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80384b:	68 35 43 80 00       	push   $0x804335
+  803850:	68 e0 41 80 00       	push   $0x8041e0
+  803855:	6a 39                	push   $0x39
+  803857:	68 4a 43 80 00       	push   $0x80434a
+  80385c:	e8 3c cb ff ff       	call   80039d <_panic>
+	}
+}
+  803861:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803864:	5b                   	pop    %ebx
+  803865:	5e                   	pop    %esi
+  803866:	5f                   	pop    %edi
+  803867:	5d                   	pop    %ebp
+  803868:	c3                   	ret
+
+00803869 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803869:	55                   	push   %ebp
+  80386a:	89 e5                	mov    %esp,%ebp
+  80386c:	57                   	push   %edi
+  80386d:	56                   	push   %esi
+  80386e:	53                   	push   %ebx
+  80386f:	83 ec 10             	sub    $0x10,%esp
+  803872:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803875:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803878:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80387b:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80387e:	85 c0                	test   %eax,%eax
+  803880:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803885:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803888:	6a 00                	push   $0x0
+  80388a:	ff 33                	push   (%ebx)
+  80388c:	50                   	push   %eax
+  80388d:	e8 e5 d7 ff ff       	call   801077 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803892:	83 c4 10             	add    $0x10,%esp
+  803895:	85 c0                	test   %eax,%eax
+  803897:	75 3c                	jne    8038d5 <ipc_recvv+0x6c>
+  803899:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80389f:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8038a2:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8038a4:	85 ff                	test   %edi,%edi
+  8038a6:	74 4e                	je     8038f6 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8038a8:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8038ae:	8b 52 74             	mov    0x74(%edx),%edx
+  8038b1:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8038b3:	85 f6                	test   %esi,%esi
+  8038b5:	74 18                	je     8038cf <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8038b7:	85 c0                	test   %eax,%eax
+  8038b9:	75 2d                	jne    8038e8 <ipc_recvv+0x7f>
+  8038bb:	a1 00 60 80 00       	mov    0x806000,%eax
+  8038c0:	8b 40 78             	mov    0x78(%eax),%eax
+  8038c3:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8038c5:	a1 00 60 80 00       	mov    0x806000,%eax
+  8038ca:	8b 40 70             	mov    0x70(%eax),%eax
+  8038cd:	eb 1f                	jmp    8038ee <ipc_recvv+0x85>
+  8038cf:	85 c0                	test   %eax,%eax
+  8038d1:	75 1b                	jne    8038ee <ipc_recvv+0x85>
+  8038d3:	eb f0                	jmp    8038c5 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8038d5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8038db:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8038e0:	85 ff                	test   %edi,%edi
+  8038e2:	75 cd                	jne    8038b1 <ipc_recvv+0x48>
+	if (perm_store)
+  8038e4:	85 f6                	test   %esi,%esi
+  8038e6:	74 e7                	je     8038cf <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8038e8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8038ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038f1:	5b                   	pop    %ebx
+  8038f2:	5e                   	pop    %esi
+  8038f3:	5f                   	pop    %edi
+  8038f4:	5d                   	pop    %ebp
+  8038f5:	c3                   	ret
+	if (perm_store)
+  8038f6:	85 f6                	test   %esi,%esi
+  8038f8:	75 bd                	jne    8038b7 <ipc_recvv+0x4e>
+  8038fa:	eb c9                	jmp    8038c5 <ipc_recvv+0x5c>
+
+008038fc <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8038fc:	55                   	push   %ebp
+  8038fd:	89 e5                	mov    %esp,%ebp
+  8038ff:	57                   	push   %edi
+  803900:	56                   	push   %esi
+  803901:	53                   	push   %ebx
+  803902:	83 ec 0c             	sub    $0xc,%esp
+  803905:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803908:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80390b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  80390e:	ff 75 14             	push   0x14(%ebp)
+  803911:	53                   	push   %ebx
+  803912:	56                   	push   %esi
+  803913:	57                   	push   %edi
+  803914:	e8 36 d7 ff ff       	call   80104f <sys_ipc_try_sendv>
+  803919:	83 c4 10             	add    $0x10,%esp
+  80391c:	85 c0                	test   %eax,%eax
+  80391e:	74 22                	je     803942 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803920:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803923:	75 07                	jne    80392c <ipc_sendv+0x30>
+		sys_yield();
+  803925:	e8 29 d5 ff ff       	call   800e53 <sys_yield>
+  80392a:	eb e2                	jmp    80390e <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80392c:	68 35 43 80 00       	push   $0x804335
+  803931:	68 e0 41 80 00       	push   $0x8041e0
+  803936:	6a 5c                	push   $0x5c
+  803938:	68 4a 43 80 00       	push   $0x80434a
+  80393d:	e8 5b ca ff ff       	call   80039d <_panic>
+	}
+}
+  803942:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803945:	5b                   	pop    %ebx
+  803946:	5e                   	pop    %esi
+  803947:	5f                   	pop    %edi
+  803948:	5d                   	pop    %ebp
+  803949:	c3                   	ret
+
+0080394a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80394a:	55                   	push   %ebp
+  80394b:	89 e5                	mov    %esp,%ebp
+  80394d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803950:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803955:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80395b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803961:	8b 52 50             	mov    0x50(%edx),%edx
+  803964:	39 ca                	cmp    %ecx,%edx
+  803966:	74 11                	je     803979 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803968:	83 c0 01             	add    $0x1,%eax
+  80396b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803970:	75 e3                	jne    803955 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803972:	b8 00 00 00 00       	mov    $0x0,%eax
+  803977:	eb 0e                	jmp    803987 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803979:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80397f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803984:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803987:	5d                   	pop    %ebp
+  803988:	c3                   	ret
+
+00803989 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803989:	55                   	push   %ebp
+  80398a:	89 e5                	mov    %esp,%ebp
+  80398c:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80398f:	89 c2                	mov    %eax,%edx
+  803991:	c1 ea 16             	shr    $0x16,%edx
+  803994:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80399b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8039a0:	f6 c1 01             	test   $0x1,%cl
+  8039a3:	74 22                	je     8039c7 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8039a5:	c1 e8 0c             	shr    $0xc,%eax
+  8039a8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8039af:	a8 01                	test   $0x1,%al
+  8039b1:	74 14                	je     8039c7 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8039b3:	c1 e8 0c             	shr    $0xc,%eax
+  8039b6:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8039b9:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8039c0:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8039c4:	0f b7 d2             	movzwl %dx,%edx
+}
+  8039c7:	89 d0                	mov    %edx,%eax
+  8039c9:	5d                   	pop    %ebp
+  8039ca:	c3                   	ret
+
+008039cb <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8039cb:	55                   	push   %ebp
+  8039cc:	89 e5                	mov    %esp,%ebp
+  8039ce:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8039d1:	83 3d 08 a0 80 00 00 	cmpl   $0x0,0x80a008
+  8039d8:	74 0a                	je     8039e4 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8039da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039dd:	a3 08 a0 80 00       	mov    %eax,0x80a008
+}
+  8039e2:	c9                   	leave
+  8039e3:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8039e4:	83 ec 04             	sub    $0x4,%esp
+  8039e7:	6a 07                	push   $0x7
+  8039e9:	68 00 f0 bf ee       	push   $0xeebff000
+  8039ee:	6a 00                	push   $0x0
+  8039f0:	e8 7d d4 ff ff       	call   800e72 <sys_page_alloc>
+  8039f5:	83 c4 10             	add    $0x10,%esp
+  8039f8:	85 c0                	test   %eax,%eax
+  8039fa:	75 2c                	jne    803a28 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8039fc:	83 ec 08             	sub    $0x8,%esp
+  8039ff:	68 3e 3a 80 00       	push   $0x803a3e
+  803a04:	6a 00                	push   $0x0
+  803a06:	e8 d2 d5 ff ff       	call   800fdd <sys_env_set_pgfault_upcall>
+  803a0b:	83 c4 10             	add    $0x10,%esp
+  803a0e:	85 c0                	test   %eax,%eax
+  803a10:	74 c8                	je     8039da <set_pgfault_handler+0xf>
+  803a12:	68 9c 43 80 00       	push   $0x80439c
+  803a17:	68 e0 41 80 00       	push   $0x8041e0
+  803a1c:	6a 20                	push   $0x20
+  803a1e:	68 cc 43 80 00       	push   $0x8043cc
+  803a23:	e8 75 c9 ff ff       	call   80039d <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803a28:	68 54 43 80 00       	push   $0x804354
+  803a2d:	68 e0 41 80 00       	push   $0x8041e0
+  803a32:	6a 1e                	push   $0x1e
+  803a34:	68 cc 43 80 00       	push   $0x8043cc
+  803a39:	e8 5f c9 ff ff       	call   80039d <_panic>
+
+00803a3e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803a3e:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803a3f:	a1 08 a0 80 00       	mov    0x80a008,%eax
+	call *%eax
+  803a44:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803a46:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803a49:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803a4e:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803a53:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803a57:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803a5a:	83 c4 08             	add    $0x8,%esp
+	popal
+  803a5d:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803a5e:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803a61:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803a62:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803a63:	c3                   	ret
+
+00803a64 <dm>:
+  803a64:	55                   	push   %ebp
+  803a65:	57                   	push   %edi
+  803a66:	56                   	push   %esi
+  803a67:	53                   	push   %ebx
+  803a68:	83 ec 24             	sub    $0x24,%esp
+  803a6b:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a6f:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a73:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803a77:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803a7b:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803a7f:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803a83:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803a87:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a91:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a96:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803a9d:	00 
+  803a9e:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803aa5:	00 
+  803aa6:	89 fb                	mov    %edi,%ebx
+  803aa8:	eb 08                	jmp    803ab2 <dm+0x4e>
+  803aaa:	83 e9 01             	sub    $0x1,%ecx
+  803aad:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803ab0:	74 68                	je     803b1a <dm+0xb6>
+  803ab2:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803ab6:	01 c0                	add    %eax,%eax
+  803ab8:	89 c6                	mov    %eax,%esi
+  803aba:	89 d7                	mov    %edx,%edi
+  803abc:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803ac0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803ac4:	0f ad d0             	shrd   %cl,%edx,%eax
+  803ac7:	d3 ea                	shr    %cl,%edx
+  803ac9:	f6 c1 20             	test   $0x20,%cl
+  803acc:	74 04                	je     803ad2 <dm+0x6e>
+  803ace:	89 d0                	mov    %edx,%eax
+  803ad0:	31 d2                	xor    %edx,%edx
+  803ad2:	83 e0 01             	and    $0x1,%eax
+  803ad5:	89 04 24             	mov    %eax,(%esp)
+  803ad8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803adf:	00 
+  803ae0:	8b 04 24             	mov    (%esp),%eax
+  803ae3:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803ae7:	09 f0                	or     %esi,%eax
+  803ae9:	09 fa                	or     %edi,%edx
+  803aeb:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803aef:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803af3:	39 f0                	cmp    %esi,%eax
+  803af5:	89 d5                	mov    %edx,%ebp
+  803af7:	19 fd                	sbb    %edi,%ebp
+  803af9:	72 af                	jb     803aaa <dm+0x46>
+  803afb:	29 f0                	sub    %esi,%eax
+  803afd:	19 fa                	sbb    %edi,%edx
+  803aff:	89 cf                	mov    %ecx,%edi
+  803b01:	c1 ef 05             	shr    $0x5,%edi
+  803b04:	83 e7 01             	and    $0x1,%edi
+  803b07:	89 fe                	mov    %edi,%esi
+  803b09:	83 f6 01             	xor    $0x1,%esi
+  803b0c:	d3 e6                	shl    %cl,%esi
+  803b0e:	d3 e7                	shl    %cl,%edi
+  803b10:	09 74 24 18          	or     %esi,0x18(%esp)
+  803b14:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803b18:	eb 90                	jmp    803aaa <dm+0x46>
+  803b1a:	85 db                	test   %ebx,%ebx
+  803b1c:	74 05                	je     803b23 <dm+0xbf>
+  803b1e:	89 03                	mov    %eax,(%ebx)
+  803b20:	89 53 04             	mov    %edx,0x4(%ebx)
+  803b23:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b27:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b2b:	83 c4 24             	add    $0x24,%esp
+  803b2e:	5b                   	pop    %ebx
+  803b2f:	5e                   	pop    %esi
+  803b30:	5f                   	pop    %edi
+  803b31:	5d                   	pop    %ebp
+  803b32:	c3                   	ret
+
+00803b33 <__udivdi3>:
+  803b33:	83 ec 08             	sub    $0x8,%esp
+  803b36:	6a 00                	push   $0x0
+  803b38:	ff 74 24 1c          	push   0x1c(%esp)
+  803b3c:	ff 74 24 1c          	push   0x1c(%esp)
+  803b40:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b44:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b48:	e8 17 ff ff ff       	call   803a64 <dm>
+  803b4d:	83 c4 14             	add    $0x14,%esp
+  803b50:	c3                   	ret
+
+00803b51 <__umoddi3>:
+  803b51:	83 ec 18             	sub    $0x18,%esp
+  803b54:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803b58:	50                   	push   %eax
+  803b59:	ff 74 24 2c          	push   0x2c(%esp)
+  803b5d:	ff 74 24 2c          	push   0x2c(%esp)
+  803b61:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803b65:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803b69:	e8 f6 fe ff ff       	call   803a64 <dm>
+  803b6e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b72:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b76:	83 c4 24             	add    $0x24,%esp
+  803b79:	c3                   	ret
+
+00803b7a <__divdi3>:
+  803b7a:	53                   	push   %ebx
+  803b7b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803b7f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803b83:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803b87:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803b8b:	85 d2                	test   %edx,%edx
+  803b8d:	78 15                	js     803ba4 <__divdi3+0x2a>
+  803b8f:	85 db                	test   %ebx,%ebx
+  803b91:	78 34                	js     803bc7 <__divdi3+0x4d>
+  803b93:	83 ec 04             	sub    $0x4,%esp
+  803b96:	6a 00                	push   $0x0
+  803b98:	53                   	push   %ebx
+  803b99:	51                   	push   %ecx
+  803b9a:	e8 c5 fe ff ff       	call   803a64 <dm>
+  803b9f:	83 c4 10             	add    $0x10,%esp
+  803ba2:	eb 21                	jmp    803bc5 <__divdi3+0x4b>
+  803ba4:	f7 d8                	neg    %eax
+  803ba6:	83 d2 00             	adc    $0x0,%edx
+  803ba9:	f7 da                	neg    %edx
+  803bab:	85 db                	test   %ebx,%ebx
+  803bad:	78 30                	js     803bdf <__divdi3+0x65>
+  803baf:	83 ec 04             	sub    $0x4,%esp
+  803bb2:	6a 00                	push   $0x0
+  803bb4:	53                   	push   %ebx
+  803bb5:	51                   	push   %ecx
+  803bb6:	e8 a9 fe ff ff       	call   803a64 <dm>
+  803bbb:	83 c4 10             	add    $0x10,%esp
+  803bbe:	f7 d8                	neg    %eax
+  803bc0:	83 d2 00             	adc    $0x0,%edx
+  803bc3:	f7 da                	neg    %edx
+  803bc5:	5b                   	pop    %ebx
+  803bc6:	c3                   	ret
+  803bc7:	83 ec 04             	sub    $0x4,%esp
+  803bca:	6a 00                	push   $0x0
+  803bcc:	f7 d9                	neg    %ecx
+  803bce:	83 d3 00             	adc    $0x0,%ebx
+  803bd1:	f7 db                	neg    %ebx
+  803bd3:	53                   	push   %ebx
+  803bd4:	51                   	push   %ecx
+  803bd5:	e8 8a fe ff ff       	call   803a64 <dm>
+  803bda:	83 c4 10             	add    $0x10,%esp
+  803bdd:	eb df                	jmp    803bbe <__divdi3+0x44>
+  803bdf:	83 ec 04             	sub    $0x4,%esp
+  803be2:	6a 00                	push   $0x0
+  803be4:	f7 d9                	neg    %ecx
+  803be6:	83 d3 00             	adc    $0x0,%ebx
+  803be9:	f7 db                	neg    %ebx
+  803beb:	53                   	push   %ebx
+  803bec:	51                   	push   %ecx
+  803bed:	e8 72 fe ff ff       	call   803a64 <dm>
+  803bf2:	83 c4 10             	add    $0x10,%esp
+  803bf5:	eb ce                	jmp    803bc5 <__divdi3+0x4b>
+
+00803bf7 <__moddi3>:
+  803bf7:	55                   	push   %ebp
+  803bf8:	57                   	push   %edi
+  803bf9:	56                   	push   %esi
+  803bfa:	53                   	push   %ebx
+  803bfb:	83 ec 24             	sub    $0x24,%esp
+  803bfe:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803c02:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803c06:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803c0a:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803c0e:	85 d2                	test   %edx,%edx
+  803c10:	78 3b                	js     803c4d <__moddi3+0x56>
+  803c12:	83 ec 04             	sub    $0x4,%esp
+  803c15:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803c19:	56                   	push   %esi
+  803c1a:	89 ce                	mov    %ecx,%esi
+  803c1c:	f7 de                	neg    %esi
+  803c1e:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803c22:	89 de                	mov    %ebx,%esi
+  803c24:	83 d6 00             	adc    $0x0,%esi
+  803c27:	f7 de                	neg    %esi
+  803c29:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803c2d:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803c31:	0f 48 f1             	cmovs  %ecx,%esi
+  803c34:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803c39:	53                   	push   %ebx
+  803c3a:	56                   	push   %esi
+  803c3b:	e8 24 fe ff ff       	call   803a64 <dm>
+  803c40:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803c44:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803c48:	83 c4 10             	add    $0x10,%esp
+  803c4b:	eb 47                	jmp    803c94 <__moddi3+0x9d>
+  803c4d:	f7 d8                	neg    %eax
+  803c4f:	83 d2 00             	adc    $0x0,%edx
+  803c52:	f7 da                	neg    %edx
+  803c54:	83 ec 04             	sub    $0x4,%esp
+  803c57:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803c5b:	56                   	push   %esi
+  803c5c:	89 cf                	mov    %ecx,%edi
+  803c5e:	f7 df                	neg    %edi
+  803c60:	89 de                	mov    %ebx,%esi
+  803c62:	83 d6 00             	adc    $0x0,%esi
+  803c65:	f7 de                	neg    %esi
+  803c67:	0f 49 cf             	cmovns %edi,%ecx
+  803c6a:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803c6e:	0f 49 de             	cmovns %esi,%ebx
+  803c71:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803c75:	ff 74 24 0c          	push   0xc(%esp)
+  803c79:	ff 74 24 0c          	push   0xc(%esp)
+  803c7d:	e8 e2 fd ff ff       	call   803a64 <dm>
+  803c82:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803c86:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803c8a:	f7 d8                	neg    %eax
+  803c8c:	83 d2 00             	adc    $0x0,%edx
+  803c8f:	f7 da                	neg    %edx
+  803c91:	83 c4 10             	add    $0x10,%esp
+  803c94:	83 c4 24             	add    $0x24,%esp
+  803c97:	5b                   	pop    %ebx
+  803c98:	5e                   	pop    %esi
+  803c99:	5f                   	pop    %edi
+  803c9a:	5d                   	pop    %ebp
+  803c9b:	c3                   	ret
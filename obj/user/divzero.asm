@@ -0,0 +1,7631 @@
+
+obj/user/divzero.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+int zero;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	zero = 0;
+  800039:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  800040:	00 00 00 
+	cprintf("1/0 is %08x!\n", 1/zero);
+  800043:	6a 00                	push   $0x0
+  800045:	68 60 37 80 00       	push   $0x803760
+  80004a:	e8 fd 00 00 00       	call   80014c <cprintf>
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80005f:	e8 9c 0a 00 00       	call   800b00 <sys_getenvid>
+  800064:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800069:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80006f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800074:	a3 04 50 80 00       	mov    %eax,0x805004
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800079:	85 db                	test   %ebx,%ebx
+  80007b:	7e 07                	jle    800084 <libmain+0x30>
+		binaryname = argv[0];
+  80007d:	8b 06                	mov    (%esi),%eax
+  80007f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	56                   	push   %esi
+  800088:	53                   	push   %ebx
+  800089:	e8 a5 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80008e:	e8 0a 00 00 00       	call   80009d <exit>
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+
+0080009d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000a3:	e8 73 10 00 00       	call   80111b <close_all>
+	sys_env_destroy(0);
+  8000a8:	83 ec 0c             	sub    $0xc,%esp
+  8000ab:	6a 00                	push   $0x0
+  8000ad:	e8 05 0a 00 00       	call   800ab7 <sys_env_destroy>
+}
+  8000b2:	83 c4 10             	add    $0x10,%esp
+  8000b5:	c9                   	leave
+  8000b6:	c3                   	ret
+
+008000b7 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000b7:	55                   	push   %ebp
+  8000b8:	89 e5                	mov    %esp,%ebp
+  8000ba:	53                   	push   %ebx
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000c1:	8b 13                	mov    (%ebx),%edx
+  8000c3:	8d 42 01             	lea    0x1(%edx),%eax
+  8000c6:	89 03                	mov    %eax,(%ebx)
+  8000c8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000cb:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000cf:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000d4:	74 09                	je     8000df <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000d6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000dd:	c9                   	leave
+  8000de:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000df:	83 ec 08             	sub    $0x8,%esp
+  8000e2:	68 ff 00 00 00       	push   $0xff
+  8000e7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000ea:	50                   	push   %eax
+  8000eb:	e8 7a 09 00 00       	call   800a6a <sys_cputs>
+		b->idx = 0;
+  8000f0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000f6:	83 c4 10             	add    $0x10,%esp
+  8000f9:	eb db                	jmp    8000d6 <putch+0x1f>
+
+008000fb <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000fb:	55                   	push   %ebp
+  8000fc:	89 e5                	mov    %esp,%ebp
+  8000fe:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800104:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80010b:	00 00 00 
+	b.cnt = 0;
+  80010e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800115:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800118:	ff 75 0c             	push   0xc(%ebp)
+  80011b:	ff 75 08             	push   0x8(%ebp)
+  80011e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800124:	50                   	push   %eax
+  800125:	68 b7 00 80 00       	push   $0x8000b7
+  80012a:	e8 14 01 00 00       	call   800243 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80012f:	83 c4 08             	add    $0x8,%esp
+  800132:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800138:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80013e:	50                   	push   %eax
+  80013f:	e8 26 09 00 00       	call   800a6a <sys_cputs>
+
+	return b.cnt;
+}
+  800144:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80014a:	c9                   	leave
+  80014b:	c3                   	ret
+
+0080014c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80014c:	55                   	push   %ebp
+  80014d:	89 e5                	mov    %esp,%ebp
+  80014f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800152:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800155:	50                   	push   %eax
+  800156:	ff 75 08             	push   0x8(%ebp)
+  800159:	e8 9d ff ff ff       	call   8000fb <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80015e:	c9                   	leave
+  80015f:	c3                   	ret
+
+00800160 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800160:	55                   	push   %ebp
+  800161:	89 e5                	mov    %esp,%ebp
+  800163:	57                   	push   %edi
+  800164:	56                   	push   %esi
+  800165:	53                   	push   %ebx
+  800166:	83 ec 1c             	sub    $0x1c,%esp
+  800169:	89 c7                	mov    %eax,%edi
+  80016b:	89 d6                	mov    %edx,%esi
+  80016d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800170:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800173:	89 d1                	mov    %edx,%ecx
+  800175:	89 c2                	mov    %eax,%edx
+  800177:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80017a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80017d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800180:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800183:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800186:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80018d:	39 c2                	cmp    %eax,%edx
+  80018f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800192:	72 3e                	jb     8001d2 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800194:	83 ec 0c             	sub    $0xc,%esp
+  800197:	ff 75 18             	push   0x18(%ebp)
+  80019a:	83 eb 01             	sub    $0x1,%ebx
+  80019d:	53                   	push   %ebx
+  80019e:	50                   	push   %eax
+  80019f:	83 ec 08             	sub    $0x8,%esp
+  8001a2:	ff 75 e4             	push   -0x1c(%ebp)
+  8001a5:	ff 75 e0             	push   -0x20(%ebp)
+  8001a8:	ff 75 dc             	push   -0x24(%ebp)
+  8001ab:	ff 75 d8             	push   -0x28(%ebp)
+  8001ae:	e8 37 34 00 00       	call   8035ea <__udivdi3>
+  8001b3:	83 c4 18             	add    $0x18,%esp
+  8001b6:	52                   	push   %edx
+  8001b7:	50                   	push   %eax
+  8001b8:	89 f2                	mov    %esi,%edx
+  8001ba:	89 f8                	mov    %edi,%eax
+  8001bc:	e8 9f ff ff ff       	call   800160 <printnum>
+  8001c1:	83 c4 20             	add    $0x20,%esp
+  8001c4:	eb 13                	jmp    8001d9 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001c6:	83 ec 08             	sub    $0x8,%esp
+  8001c9:	56                   	push   %esi
+  8001ca:	ff 75 18             	push   0x18(%ebp)
+  8001cd:	ff d7                	call   *%edi
+  8001cf:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001d2:	83 eb 01             	sub    $0x1,%ebx
+  8001d5:	85 db                	test   %ebx,%ebx
+  8001d7:	7f ed                	jg     8001c6 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001d9:	83 ec 08             	sub    $0x8,%esp
+  8001dc:	56                   	push   %esi
+  8001dd:	83 ec 04             	sub    $0x4,%esp
+  8001e0:	ff 75 e4             	push   -0x1c(%ebp)
+  8001e3:	ff 75 e0             	push   -0x20(%ebp)
+  8001e6:	ff 75 dc             	push   -0x24(%ebp)
+  8001e9:	ff 75 d8             	push   -0x28(%ebp)
+  8001ec:	e8 17 34 00 00       	call   803608 <__umoddi3>
+  8001f1:	83 c4 14             	add    $0x14,%esp
+  8001f4:	0f be 80 78 37 80 00 	movsbl 0x803778(%eax),%eax
+  8001fb:	50                   	push   %eax
+  8001fc:	ff d7                	call   *%edi
+}
+  8001fe:	83 c4 10             	add    $0x10,%esp
+  800201:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800204:	5b                   	pop    %ebx
+  800205:	5e                   	pop    %esi
+  800206:	5f                   	pop    %edi
+  800207:	5d                   	pop    %ebp
+  800208:	c3                   	ret
+
+00800209 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80020f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800213:	8b 10                	mov    (%eax),%edx
+  800215:	3b 50 04             	cmp    0x4(%eax),%edx
+  800218:	73 0a                	jae    800224 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80021a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80021d:	89 08                	mov    %ecx,(%eax)
+  80021f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800222:	88 02                	mov    %al,(%edx)
+}
+  800224:	5d                   	pop    %ebp
+  800225:	c3                   	ret
+
+00800226 <printfmt>:
+{
+  800226:	55                   	push   %ebp
+  800227:	89 e5                	mov    %esp,%ebp
+  800229:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80022c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80022f:	50                   	push   %eax
+  800230:	ff 75 10             	push   0x10(%ebp)
+  800233:	ff 75 0c             	push   0xc(%ebp)
+  800236:	ff 75 08             	push   0x8(%ebp)
+  800239:	e8 05 00 00 00       	call   800243 <vprintfmt>
+}
+  80023e:	83 c4 10             	add    $0x10,%esp
+  800241:	c9                   	leave
+  800242:	c3                   	ret
+
+00800243 <vprintfmt>:
+{
+  800243:	55                   	push   %ebp
+  800244:	89 e5                	mov    %esp,%ebp
+  800246:	57                   	push   %edi
+  800247:	56                   	push   %esi
+  800248:	53                   	push   %ebx
+  800249:	83 ec 2c             	sub    $0x2c,%esp
+  80024c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80024f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800252:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800255:	eb 0a                	jmp    800261 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800257:	83 ec 08             	sub    $0x8,%esp
+  80025a:	53                   	push   %ebx
+  80025b:	50                   	push   %eax
+  80025c:	ff d6                	call   *%esi
+  80025e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800261:	83 c7 01             	add    $0x1,%edi
+  800264:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800268:	83 f8 25             	cmp    $0x25,%eax
+  80026b:	74 0c                	je     800279 <vprintfmt+0x36>
+			if (ch == '\0')
+  80026d:	85 c0                	test   %eax,%eax
+  80026f:	75 e6                	jne    800257 <vprintfmt+0x14>
+}
+  800271:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800274:	5b                   	pop    %ebx
+  800275:	5e                   	pop    %esi
+  800276:	5f                   	pop    %edi
+  800277:	5d                   	pop    %ebp
+  800278:	c3                   	ret
+		padc = ' ';
+  800279:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80027d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800284:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80028b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800292:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800297:	8d 47 01             	lea    0x1(%edi),%eax
+  80029a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80029d:	0f b6 17             	movzbl (%edi),%edx
+  8002a0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002a3:	3c 55                	cmp    $0x55,%al
+  8002a5:	0f 87 cf 03 00 00    	ja     80067a <vprintfmt+0x437>
+  8002ab:	0f b6 c0             	movzbl %al,%eax
+  8002ae:	ff 24 85 e0 38 80 00 	jmp    *0x8038e0(,%eax,4)
+  8002b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002b8:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002bc:	eb d9                	jmp    800297 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002c1:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002c5:	eb d0                	jmp    800297 <vprintfmt+0x54>
+  8002c7:	0f b6 d2             	movzbl %dl,%edx
+  8002ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002d5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002d8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002dc:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002df:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002e2:	83 f9 09             	cmp    $0x9,%ecx
+  8002e5:	77 55                	ja     80033c <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002e7:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002ea:	eb e9                	jmp    8002d5 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002ef:	8b 00                	mov    (%eax),%eax
+  8002f1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8002fa:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8002fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800300:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800304:	79 91                	jns    800297 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800306:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800309:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80030c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800313:	eb 82                	jmp    800297 <vprintfmt+0x54>
+			if (width < 0)
+  800315:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800318:	85 d2                	test   %edx,%edx
+  80031a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031f:	0f 49 c2             	cmovns %edx,%eax
+  800322:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800325:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800328:	e9 6a ff ff ff       	jmp    800297 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80032d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800330:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800337:	e9 5b ff ff ff       	jmp    800297 <vprintfmt+0x54>
+  80033c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80033f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800342:	eb bc                	jmp    800300 <vprintfmt+0xbd>
+			lflag++;
+  800344:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800347:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80034a:	e9 48 ff ff ff       	jmp    800297 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80034f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800352:	8d 78 04             	lea    0x4(%eax),%edi
+  800355:	83 ec 08             	sub    $0x8,%esp
+  800358:	53                   	push   %ebx
+  800359:	ff 30                	push   (%eax)
+  80035b:	ff d6                	call   *%esi
+			break;
+  80035d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800360:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800363:	e9 b1 02 00 00       	jmp    800619 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800368:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80036e:	8b 10                	mov    (%eax),%edx
+  800370:	89 d0                	mov    %edx,%eax
+  800372:	f7 d8                	neg    %eax
+  800374:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800377:	83 f8 11             	cmp    $0x11,%eax
+  80037a:	7f 23                	jg     80039f <vprintfmt+0x15c>
+  80037c:	8b 14 85 40 3a 80 00 	mov    0x803a40(,%eax,4),%edx
+  800383:	85 d2                	test   %edx,%edx
+  800385:	74 18                	je     80039f <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800387:	52                   	push   %edx
+  800388:	68 92 3b 80 00       	push   $0x803b92
+  80038d:	53                   	push   %ebx
+  80038e:	56                   	push   %esi
+  80038f:	e8 92 fe ff ff       	call   800226 <printfmt>
+  800394:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800397:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80039a:	e9 7a 02 00 00       	jmp    800619 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80039f:	50                   	push   %eax
+  8003a0:	68 90 37 80 00       	push   $0x803790
+  8003a5:	53                   	push   %ebx
+  8003a6:	56                   	push   %esi
+  8003a7:	e8 7a fe ff ff       	call   800226 <printfmt>
+  8003ac:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003af:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003b2:	e9 62 02 00 00       	jmp    800619 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ba:	83 c0 04             	add    $0x4,%eax
+  8003bd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c3:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003c5:	85 c9                	test   %ecx,%ecx
+  8003c7:	b8 89 37 80 00       	mov    $0x803789,%eax
+  8003cc:	0f 45 c1             	cmovne %ecx,%eax
+  8003cf:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003d2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d6:	7e 06                	jle    8003de <vprintfmt+0x19b>
+  8003d8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003dc:	75 0b                	jne    8003e9 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003de:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003e1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003e4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003e7:	eb 5c                	jmp    800445 <vprintfmt+0x202>
+  8003e9:	83 ec 08             	sub    $0x8,%esp
+  8003ec:	ff 75 d0             	push   -0x30(%ebp)
+  8003ef:	ff 75 cc             	push   -0x34(%ebp)
+  8003f2:	e8 20 03 00 00       	call   800717 <strnlen>
+  8003f7:	89 c2                	mov    %eax,%edx
+  8003f9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003fc:	29 d0                	sub    %edx,%eax
+  8003fe:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800401:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800405:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800408:	89 75 08             	mov    %esi,0x8(%ebp)
+  80040b:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80040d:	eb 0e                	jmp    80041d <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80040f:	83 ec 08             	sub    $0x8,%esp
+  800412:	53                   	push   %ebx
+  800413:	57                   	push   %edi
+  800414:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800417:	83 ee 01             	sub    $0x1,%esi
+  80041a:	83 c4 10             	add    $0x10,%esp
+  80041d:	85 f6                	test   %esi,%esi
+  80041f:	7f ee                	jg     80040f <vprintfmt+0x1cc>
+  800421:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800424:	8b 75 08             	mov    0x8(%ebp),%esi
+  800427:	85 c0                	test   %eax,%eax
+  800429:	ba 00 00 00 00       	mov    $0x0,%edx
+  80042e:	0f 49 d0             	cmovns %eax,%edx
+  800431:	29 d0                	sub    %edx,%eax
+  800433:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800436:	eb a6                	jmp    8003de <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800438:	83 ec 08             	sub    $0x8,%esp
+  80043b:	53                   	push   %ebx
+  80043c:	52                   	push   %edx
+  80043d:	ff 55 08             	call   *0x8(%ebp)
+  800440:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800443:	89 f1                	mov    %esi,%ecx
+  800445:	8d 71 01             	lea    0x1(%ecx),%esi
+  800448:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80044c:	0f be d0             	movsbl %al,%edx
+  80044f:	85 d2                	test   %edx,%edx
+  800451:	74 28                	je     80047b <vprintfmt+0x238>
+  800453:	85 ff                	test   %edi,%edi
+  800455:	78 05                	js     80045c <vprintfmt+0x219>
+  800457:	83 ef 01             	sub    $0x1,%edi
+  80045a:	78 30                	js     80048c <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80045c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800460:	74 d6                	je     800438 <vprintfmt+0x1f5>
+  800462:	0f be c0             	movsbl %al,%eax
+  800465:	83 e8 20             	sub    $0x20,%eax
+  800468:	83 f8 5e             	cmp    $0x5e,%eax
+  80046b:	76 cb                	jbe    800438 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80046d:	83 ec 08             	sub    $0x8,%esp
+  800470:	53                   	push   %ebx
+  800471:	6a 3f                	push   $0x3f
+  800473:	ff 55 08             	call   *0x8(%ebp)
+  800476:	83 c4 10             	add    $0x10,%esp
+  800479:	eb c8                	jmp    800443 <vprintfmt+0x200>
+  80047b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80047e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800481:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800484:	01 d0                	add    %edx,%eax
+  800486:	29 c8                	sub    %ecx,%eax
+  800488:	89 c7                	mov    %eax,%edi
+  80048a:	eb 13                	jmp    80049f <vprintfmt+0x25c>
+  80048c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80048f:	eb ed                	jmp    80047e <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800491:	83 ec 08             	sub    $0x8,%esp
+  800494:	53                   	push   %ebx
+  800495:	6a 20                	push   $0x20
+  800497:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800499:	83 ef 01             	sub    $0x1,%edi
+  80049c:	83 c4 10             	add    $0x10,%esp
+  80049f:	85 ff                	test   %edi,%edi
+  8004a1:	7f ee                	jg     800491 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004a3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004a6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004a9:	e9 6b 01 00 00       	jmp    800619 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004ae:	83 f9 01             	cmp    $0x1,%ecx
+  8004b1:	7f 1f                	jg     8004d2 <vprintfmt+0x28f>
+	else if (lflag)
+  8004b3:	85 c9                	test   %ecx,%ecx
+  8004b5:	74 67                	je     80051e <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ba:	8b 00                	mov    (%eax),%eax
+  8004bc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004bf:	89 c1                	mov    %eax,%ecx
+  8004c1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004c4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8004cd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004d0:	eb 17                	jmp    8004e9 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d5:	8b 50 04             	mov    0x4(%eax),%edx
+  8004d8:	8b 00                	mov    (%eax),%eax
+  8004da:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004dd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e3:	8d 40 08             	lea    0x8(%eax),%eax
+  8004e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004e9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004ec:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004ef:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004f4:	85 c9                	test   %ecx,%ecx
+  8004f6:	0f 89 03 01 00 00    	jns    8005ff <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8004fc:	83 ec 08             	sub    $0x8,%esp
+  8004ff:	53                   	push   %ebx
+  800500:	6a 2d                	push   $0x2d
+  800502:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800504:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800507:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80050a:	f7 da                	neg    %edx
+  80050c:	83 d1 00             	adc    $0x0,%ecx
+  80050f:	f7 d9                	neg    %ecx
+  800511:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800514:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800519:	e9 e1 00 00 00       	jmp    8005ff <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80051e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800521:	8b 00                	mov    (%eax),%eax
+  800523:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800526:	89 c1                	mov    %eax,%ecx
+  800528:	c1 f9 1f             	sar    $0x1f,%ecx
+  80052b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80052e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800531:	8d 40 04             	lea    0x4(%eax),%eax
+  800534:	89 45 14             	mov    %eax,0x14(%ebp)
+  800537:	eb b0                	jmp    8004e9 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800539:	83 f9 01             	cmp    $0x1,%ecx
+  80053c:	7f 1e                	jg     80055c <vprintfmt+0x319>
+	else if (lflag)
+  80053e:	85 c9                	test   %ecx,%ecx
+  800540:	74 32                	je     800574 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800542:	8b 45 14             	mov    0x14(%ebp),%eax
+  800545:	8b 10                	mov    (%eax),%edx
+  800547:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80054c:	8d 40 04             	lea    0x4(%eax),%eax
+  80054f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800552:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800557:	e9 a3 00 00 00       	jmp    8005ff <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80055c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055f:	8b 10                	mov    (%eax),%edx
+  800561:	8b 48 04             	mov    0x4(%eax),%ecx
+  800564:	8d 40 08             	lea    0x8(%eax),%eax
+  800567:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80056a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80056f:	e9 8b 00 00 00       	jmp    8005ff <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800574:	8b 45 14             	mov    0x14(%ebp),%eax
+  800577:	8b 10                	mov    (%eax),%edx
+  800579:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80057e:	8d 40 04             	lea    0x4(%eax),%eax
+  800581:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800584:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800589:	eb 74                	jmp    8005ff <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80058b:	83 f9 01             	cmp    $0x1,%ecx
+  80058e:	7f 1b                	jg     8005ab <vprintfmt+0x368>
+	else if (lflag)
+  800590:	85 c9                	test   %ecx,%ecx
+  800592:	74 2c                	je     8005c0 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800594:	8b 45 14             	mov    0x14(%ebp),%eax
+  800597:	8b 10                	mov    (%eax),%edx
+  800599:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80059e:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005a4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005a9:	eb 54                	jmp    8005ff <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ae:	8b 10                	mov    (%eax),%edx
+  8005b0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005b3:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005b9:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005be:	eb 3f                	jmp    8005ff <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c3:	8b 10                	mov    (%eax),%edx
+  8005c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8005cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005d0:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8005d5:	eb 28                	jmp    8005ff <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8005d7:	83 ec 08             	sub    $0x8,%esp
+  8005da:	53                   	push   %ebx
+  8005db:	6a 30                	push   $0x30
+  8005dd:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005df:	83 c4 08             	add    $0x8,%esp
+  8005e2:	53                   	push   %ebx
+  8005e3:	6a 78                	push   $0x78
+  8005e5:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ea:	8b 10                	mov    (%eax),%edx
+  8005ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005f1:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005f4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8005fa:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005ff:	83 ec 0c             	sub    $0xc,%esp
+  800602:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800606:	50                   	push   %eax
+  800607:	ff 75 e0             	push   -0x20(%ebp)
+  80060a:	57                   	push   %edi
+  80060b:	51                   	push   %ecx
+  80060c:	52                   	push   %edx
+  80060d:	89 da                	mov    %ebx,%edx
+  80060f:	89 f0                	mov    %esi,%eax
+  800611:	e8 4a fb ff ff       	call   800160 <printnum>
+			break;
+  800616:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800619:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80061c:	e9 40 fc ff ff       	jmp    800261 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800621:	83 f9 01             	cmp    $0x1,%ecx
+  800624:	7f 1b                	jg     800641 <vprintfmt+0x3fe>
+	else if (lflag)
+  800626:	85 c9                	test   %ecx,%ecx
+  800628:	74 2c                	je     800656 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80062a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062d:	8b 10                	mov    (%eax),%edx
+  80062f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800634:	8d 40 04             	lea    0x4(%eax),%eax
+  800637:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80063a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80063f:	eb be                	jmp    8005ff <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800641:	8b 45 14             	mov    0x14(%ebp),%eax
+  800644:	8b 10                	mov    (%eax),%edx
+  800646:	8b 48 04             	mov    0x4(%eax),%ecx
+  800649:	8d 40 08             	lea    0x8(%eax),%eax
+  80064c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80064f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800654:	eb a9                	jmp    8005ff <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800656:	8b 45 14             	mov    0x14(%ebp),%eax
+  800659:	8b 10                	mov    (%eax),%edx
+  80065b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800660:	8d 40 04             	lea    0x4(%eax),%eax
+  800663:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800666:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80066b:	eb 92                	jmp    8005ff <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80066d:	83 ec 08             	sub    $0x8,%esp
+  800670:	53                   	push   %ebx
+  800671:	6a 25                	push   $0x25
+  800673:	ff d6                	call   *%esi
+			break;
+  800675:	83 c4 10             	add    $0x10,%esp
+  800678:	eb 9f                	jmp    800619 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80067a:	83 ec 08             	sub    $0x8,%esp
+  80067d:	53                   	push   %ebx
+  80067e:	6a 25                	push   $0x25
+  800680:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800682:	83 c4 10             	add    $0x10,%esp
+  800685:	89 f8                	mov    %edi,%eax
+  800687:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80068b:	74 05                	je     800692 <vprintfmt+0x44f>
+  80068d:	83 e8 01             	sub    $0x1,%eax
+  800690:	eb f5                	jmp    800687 <vprintfmt+0x444>
+  800692:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800695:	eb 82                	jmp    800619 <vprintfmt+0x3d6>
+
+00800697 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800697:	55                   	push   %ebp
+  800698:	89 e5                	mov    %esp,%ebp
+  80069a:	83 ec 18             	sub    $0x18,%esp
+  80069d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006a3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006a6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006aa:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006ad:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006b4:	85 c0                	test   %eax,%eax
+  8006b6:	74 26                	je     8006de <vsnprintf+0x47>
+  8006b8:	85 d2                	test   %edx,%edx
+  8006ba:	7e 22                	jle    8006de <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006bc:	ff 75 14             	push   0x14(%ebp)
+  8006bf:	ff 75 10             	push   0x10(%ebp)
+  8006c2:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006c5:	50                   	push   %eax
+  8006c6:	68 09 02 80 00       	push   $0x800209
+  8006cb:	e8 73 fb ff ff       	call   800243 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006d0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006d3:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006d9:	83 c4 10             	add    $0x10,%esp
+}
+  8006dc:	c9                   	leave
+  8006dd:	c3                   	ret
+		return -E_INVAL;
+  8006de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006e3:	eb f7                	jmp    8006dc <vsnprintf+0x45>
+
+008006e5 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006e5:	55                   	push   %ebp
+  8006e6:	89 e5                	mov    %esp,%ebp
+  8006e8:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006eb:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006ee:	50                   	push   %eax
+  8006ef:	ff 75 10             	push   0x10(%ebp)
+  8006f2:	ff 75 0c             	push   0xc(%ebp)
+  8006f5:	ff 75 08             	push   0x8(%ebp)
+  8006f8:	e8 9a ff ff ff       	call   800697 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006fd:	c9                   	leave
+  8006fe:	c3                   	ret
+
+008006ff <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8006ff:	55                   	push   %ebp
+  800700:	89 e5                	mov    %esp,%ebp
+  800702:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800705:	b8 00 00 00 00       	mov    $0x0,%eax
+  80070a:	eb 03                	jmp    80070f <strlen+0x10>
+		n++;
+  80070c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80070f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800713:	75 f7                	jne    80070c <strlen+0xd>
+	return n;
+}
+  800715:	5d                   	pop    %ebp
+  800716:	c3                   	ret
+
+00800717 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800717:	55                   	push   %ebp
+  800718:	89 e5                	mov    %esp,%ebp
+  80071a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80071d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800720:	b8 00 00 00 00       	mov    $0x0,%eax
+  800725:	eb 03                	jmp    80072a <strnlen+0x13>
+		n++;
+  800727:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80072a:	39 d0                	cmp    %edx,%eax
+  80072c:	74 08                	je     800736 <strnlen+0x1f>
+  80072e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800732:	75 f3                	jne    800727 <strnlen+0x10>
+  800734:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800736:	89 d0                	mov    %edx,%eax
+  800738:	5d                   	pop    %ebp
+  800739:	c3                   	ret
+
+0080073a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80073a:	55                   	push   %ebp
+  80073b:	89 e5                	mov    %esp,%ebp
+  80073d:	53                   	push   %ebx
+  80073e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800741:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800744:	b8 00 00 00 00       	mov    $0x0,%eax
+  800749:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80074d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800750:	83 c0 01             	add    $0x1,%eax
+  800753:	84 d2                	test   %dl,%dl
+  800755:	75 f2                	jne    800749 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800757:	89 c8                	mov    %ecx,%eax
+  800759:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80075c:	c9                   	leave
+  80075d:	c3                   	ret
+
+0080075e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80075e:	55                   	push   %ebp
+  80075f:	89 e5                	mov    %esp,%ebp
+  800761:	53                   	push   %ebx
+  800762:	83 ec 10             	sub    $0x10,%esp
+  800765:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800768:	53                   	push   %ebx
+  800769:	e8 91 ff ff ff       	call   8006ff <strlen>
+  80076e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800771:	ff 75 0c             	push   0xc(%ebp)
+  800774:	01 d8                	add    %ebx,%eax
+  800776:	50                   	push   %eax
+  800777:	e8 be ff ff ff       	call   80073a <strcpy>
+	return dst;
+}
+  80077c:	89 d8                	mov    %ebx,%eax
+  80077e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800781:	c9                   	leave
+  800782:	c3                   	ret
+
+00800783 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800783:	55                   	push   %ebp
+  800784:	89 e5                	mov    %esp,%ebp
+  800786:	56                   	push   %esi
+  800787:	53                   	push   %ebx
+  800788:	8b 75 08             	mov    0x8(%ebp),%esi
+  80078b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80078e:	89 f3                	mov    %esi,%ebx
+  800790:	03 5d 10             	add    0x10(%ebp),%ebx
+  800793:	89 f0                	mov    %esi,%eax
+  800795:	eb 0f                	jmp    8007a6 <strncpy+0x23>
+		*dst++ = *src;
+  800797:	83 c0 01             	add    $0x1,%eax
+  80079a:	0f b6 0a             	movzbl (%edx),%ecx
+  80079d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007a0:	80 f9 01             	cmp    $0x1,%cl
+  8007a3:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007a6:	39 d8                	cmp    %ebx,%eax
+  8007a8:	75 ed                	jne    800797 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007aa:	89 f0                	mov    %esi,%eax
+  8007ac:	5b                   	pop    %ebx
+  8007ad:	5e                   	pop    %esi
+  8007ae:	5d                   	pop    %ebp
+  8007af:	c3                   	ret
+
+008007b0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007b0:	55                   	push   %ebp
+  8007b1:	89 e5                	mov    %esp,%ebp
+  8007b3:	56                   	push   %esi
+  8007b4:	53                   	push   %ebx
+  8007b5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007bb:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007be:	89 f0                	mov    %esi,%eax
+  8007c0:	85 d2                	test   %edx,%edx
+  8007c2:	74 21                	je     8007e5 <strlcpy+0x35>
+  8007c4:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007c8:	89 f2                	mov    %esi,%edx
+  8007ca:	eb 09                	jmp    8007d5 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007cc:	83 c1 01             	add    $0x1,%ecx
+  8007cf:	83 c2 01             	add    $0x1,%edx
+  8007d2:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007d5:	39 c2                	cmp    %eax,%edx
+  8007d7:	74 09                	je     8007e2 <strlcpy+0x32>
+  8007d9:	0f b6 19             	movzbl (%ecx),%ebx
+  8007dc:	84 db                	test   %bl,%bl
+  8007de:	75 ec                	jne    8007cc <strlcpy+0x1c>
+  8007e0:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007e2:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007e5:	29 f0                	sub    %esi,%eax
+}
+  8007e7:	5b                   	pop    %ebx
+  8007e8:	5e                   	pop    %esi
+  8007e9:	5d                   	pop    %ebp
+  8007ea:	c3                   	ret
+
+008007eb <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007eb:	55                   	push   %ebp
+  8007ec:	89 e5                	mov    %esp,%ebp
+  8007ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007f4:	eb 06                	jmp    8007fc <strcmp+0x11>
+		p++, q++;
+  8007f6:	83 c1 01             	add    $0x1,%ecx
+  8007f9:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007fc:	0f b6 01             	movzbl (%ecx),%eax
+  8007ff:	84 c0                	test   %al,%al
+  800801:	74 04                	je     800807 <strcmp+0x1c>
+  800803:	3a 02                	cmp    (%edx),%al
+  800805:	74 ef                	je     8007f6 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800807:	0f b6 c0             	movzbl %al,%eax
+  80080a:	0f b6 12             	movzbl (%edx),%edx
+  80080d:	29 d0                	sub    %edx,%eax
+}
+  80080f:	5d                   	pop    %ebp
+  800810:	c3                   	ret
+
+00800811 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800811:	55                   	push   %ebp
+  800812:	89 e5                	mov    %esp,%ebp
+  800814:	53                   	push   %ebx
+  800815:	8b 45 08             	mov    0x8(%ebp),%eax
+  800818:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80081b:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80081e:	eb 09                	jmp    800829 <strncmp+0x18>
+		n--, p++, q++;
+  800820:	83 ea 01             	sub    $0x1,%edx
+  800823:	83 c0 01             	add    $0x1,%eax
+  800826:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800829:	85 d2                	test   %edx,%edx
+  80082b:	74 18                	je     800845 <strncmp+0x34>
+  80082d:	0f b6 18             	movzbl (%eax),%ebx
+  800830:	84 db                	test   %bl,%bl
+  800832:	74 04                	je     800838 <strncmp+0x27>
+  800834:	3a 19                	cmp    (%ecx),%bl
+  800836:	74 e8                	je     800820 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800838:	0f b6 00             	movzbl (%eax),%eax
+  80083b:	0f b6 11             	movzbl (%ecx),%edx
+  80083e:	29 d0                	sub    %edx,%eax
+}
+  800840:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800843:	c9                   	leave
+  800844:	c3                   	ret
+		return 0;
+  800845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084a:	eb f4                	jmp    800840 <strncmp+0x2f>
+
+0080084c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80084c:	55                   	push   %ebp
+  80084d:	89 e5                	mov    %esp,%ebp
+  80084f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800852:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800856:	eb 03                	jmp    80085b <strchr+0xf>
+  800858:	83 c0 01             	add    $0x1,%eax
+  80085b:	0f b6 10             	movzbl (%eax),%edx
+  80085e:	84 d2                	test   %dl,%dl
+  800860:	74 06                	je     800868 <strchr+0x1c>
+		if (*s == c)
+  800862:	38 ca                	cmp    %cl,%dl
+  800864:	75 f2                	jne    800858 <strchr+0xc>
+  800866:	eb 05                	jmp    80086d <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800868:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80086d:	5d                   	pop    %ebp
+  80086e:	c3                   	ret
+
+0080086f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80086f:	55                   	push   %ebp
+  800870:	89 e5                	mov    %esp,%ebp
+  800872:	8b 45 08             	mov    0x8(%ebp),%eax
+  800875:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800879:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80087c:	38 ca                	cmp    %cl,%dl
+  80087e:	74 09                	je     800889 <strfind+0x1a>
+  800880:	84 d2                	test   %dl,%dl
+  800882:	74 05                	je     800889 <strfind+0x1a>
+	for (; *s; s++)
+  800884:	83 c0 01             	add    $0x1,%eax
+  800887:	eb f0                	jmp    800879 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800889:	5d                   	pop    %ebp
+  80088a:	c3                   	ret
+
+0080088b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	57                   	push   %edi
+  80088f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800892:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800895:	85 c9                	test   %ecx,%ecx
+  800897:	74 20                	je     8008b9 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800899:	89 f8                	mov    %edi,%eax
+  80089b:	09 c8                	or     %ecx,%eax
+  80089d:	a8 03                	test   $0x3,%al
+  80089f:	75 12                	jne    8008b3 <memset+0x28>
+		c &= 0xFF;
+  8008a1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008a5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008ab:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008ae:	fc                   	cld
+  8008af:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008b1:	eb 06                	jmp    8008b9 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008b6:	fc                   	cld
+  8008b7:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008b9:	89 f8                	mov    %edi,%eax
+  8008bb:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008be:	c9                   	leave
+  8008bf:	c3                   	ret
+
+008008c0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008c0:	55                   	push   %ebp
+  8008c1:	89 e5                	mov    %esp,%ebp
+  8008c3:	57                   	push   %edi
+  8008c4:	56                   	push   %esi
+  8008c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008cb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008ce:	39 c6                	cmp    %eax,%esi
+  8008d0:	73 32                	jae    800904 <memmove+0x44>
+  8008d2:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008d5:	39 d0                	cmp    %edx,%eax
+  8008d7:	73 2b                	jae    800904 <memmove+0x44>
+		s += n;
+		d += n;
+  8008d9:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008dc:	89 d6                	mov    %edx,%esi
+  8008de:	09 fe                	or     %edi,%esi
+  8008e0:	09 ce                	or     %ecx,%esi
+  8008e2:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008e8:	75 0e                	jne    8008f8 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008ea:	83 ef 04             	sub    $0x4,%edi
+  8008ed:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008f0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008f3:	fd                   	std
+  8008f4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008f6:	eb 09                	jmp    800901 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008f8:	83 ef 01             	sub    $0x1,%edi
+  8008fb:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8008fe:	fd                   	std
+  8008ff:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800901:	fc                   	cld
+  800902:	eb 1a                	jmp    80091e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800904:	89 f2                	mov    %esi,%edx
+  800906:	09 c2                	or     %eax,%edx
+  800908:	09 ca                	or     %ecx,%edx
+  80090a:	f6 c2 03             	test   $0x3,%dl
+  80090d:	75 0a                	jne    800919 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80090f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800912:	89 c7                	mov    %eax,%edi
+  800914:	fc                   	cld
+  800915:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800917:	eb 05                	jmp    80091e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800919:	89 c7                	mov    %eax,%edi
+  80091b:	fc                   	cld
+  80091c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80091e:	5e                   	pop    %esi
+  80091f:	5f                   	pop    %edi
+  800920:	5d                   	pop    %ebp
+  800921:	c3                   	ret
+
+00800922 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800922:	55                   	push   %ebp
+  800923:	89 e5                	mov    %esp,%ebp
+  800925:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800928:	ff 75 10             	push   0x10(%ebp)
+  80092b:	ff 75 0c             	push   0xc(%ebp)
+  80092e:	ff 75 08             	push   0x8(%ebp)
+  800931:	e8 8a ff ff ff       	call   8008c0 <memmove>
+}
+  800936:	c9                   	leave
+  800937:	c3                   	ret
+
+00800938 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800938:	55                   	push   %ebp
+  800939:	89 e5                	mov    %esp,%ebp
+  80093b:	56                   	push   %esi
+  80093c:	53                   	push   %ebx
+  80093d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800940:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800943:	89 c6                	mov    %eax,%esi
+  800945:	03 75 10             	add    0x10(%ebp),%esi
+  800948:	eb 06                	jmp    800950 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80094a:	83 c0 01             	add    $0x1,%eax
+  80094d:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800950:	39 f0                	cmp    %esi,%eax
+  800952:	74 14                	je     800968 <memcmp+0x30>
+		if (*s1 != *s2)
+  800954:	0f b6 08             	movzbl (%eax),%ecx
+  800957:	0f b6 1a             	movzbl (%edx),%ebx
+  80095a:	38 d9                	cmp    %bl,%cl
+  80095c:	74 ec                	je     80094a <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80095e:	0f b6 c1             	movzbl %cl,%eax
+  800961:	0f b6 db             	movzbl %bl,%ebx
+  800964:	29 d8                	sub    %ebx,%eax
+  800966:	eb 05                	jmp    80096d <memcmp+0x35>
+	}
+
+	return 0;
+  800968:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80096d:	5b                   	pop    %ebx
+  80096e:	5e                   	pop    %esi
+  80096f:	5d                   	pop    %ebp
+  800970:	c3                   	ret
+
+00800971 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800971:	55                   	push   %ebp
+  800972:	89 e5                	mov    %esp,%ebp
+  800974:	8b 45 08             	mov    0x8(%ebp),%eax
+  800977:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80097a:	89 c2                	mov    %eax,%edx
+  80097c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80097f:	eb 03                	jmp    800984 <memfind+0x13>
+  800981:	83 c0 01             	add    $0x1,%eax
+  800984:	39 d0                	cmp    %edx,%eax
+  800986:	73 04                	jae    80098c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800988:	38 08                	cmp    %cl,(%eax)
+  80098a:	75 f5                	jne    800981 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80098c:	5d                   	pop    %ebp
+  80098d:	c3                   	ret
+
+0080098e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80098e:	55                   	push   %ebp
+  80098f:	89 e5                	mov    %esp,%ebp
+  800991:	57                   	push   %edi
+  800992:	56                   	push   %esi
+  800993:	53                   	push   %ebx
+  800994:	8b 55 08             	mov    0x8(%ebp),%edx
+  800997:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80099a:	eb 03                	jmp    80099f <strtol+0x11>
+		s++;
+  80099c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  80099f:	0f b6 02             	movzbl (%edx),%eax
+  8009a2:	3c 20                	cmp    $0x20,%al
+  8009a4:	74 f6                	je     80099c <strtol+0xe>
+  8009a6:	3c 09                	cmp    $0x9,%al
+  8009a8:	74 f2                	je     80099c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009aa:	3c 2b                	cmp    $0x2b,%al
+  8009ac:	74 2a                	je     8009d8 <strtol+0x4a>
+	int neg = 0;
+  8009ae:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009b3:	3c 2d                	cmp    $0x2d,%al
+  8009b5:	74 2b                	je     8009e2 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009b7:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009bd:	75 0f                	jne    8009ce <strtol+0x40>
+  8009bf:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009c2:	74 28                	je     8009ec <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009c4:	85 db                	test   %ebx,%ebx
+  8009c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009cb:	0f 44 d8             	cmove  %eax,%ebx
+  8009ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d3:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009d6:	eb 46                	jmp    800a1e <strtol+0x90>
+		s++;
+  8009d8:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009e0:	eb d5                	jmp    8009b7 <strtol+0x29>
+		s++, neg = 1;
+  8009e2:	83 c2 01             	add    $0x1,%edx
+  8009e5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009ea:	eb cb                	jmp    8009b7 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009ec:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009f0:	74 0e                	je     800a00 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009f2:	85 db                	test   %ebx,%ebx
+  8009f4:	75 d8                	jne    8009ce <strtol+0x40>
+		s++, base = 8;
+  8009f6:	83 c2 01             	add    $0x1,%edx
+  8009f9:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8009fe:	eb ce                	jmp    8009ce <strtol+0x40>
+		s += 2, base = 16;
+  800a00:	83 c2 02             	add    $0x2,%edx
+  800a03:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a08:	eb c4                	jmp    8009ce <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a0a:	0f be c0             	movsbl %al,%eax
+  800a0d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a10:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a13:	7d 3a                	jge    800a4f <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a15:	83 c2 01             	add    $0x1,%edx
+  800a18:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a1c:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a1e:	0f b6 02             	movzbl (%edx),%eax
+  800a21:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a24:	89 f3                	mov    %esi,%ebx
+  800a26:	80 fb 09             	cmp    $0x9,%bl
+  800a29:	76 df                	jbe    800a0a <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a2b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a2e:	89 f3                	mov    %esi,%ebx
+  800a30:	80 fb 19             	cmp    $0x19,%bl
+  800a33:	77 08                	ja     800a3d <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a35:	0f be c0             	movsbl %al,%eax
+  800a38:	83 e8 57             	sub    $0x57,%eax
+  800a3b:	eb d3                	jmp    800a10 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a3d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a40:	89 f3                	mov    %esi,%ebx
+  800a42:	80 fb 19             	cmp    $0x19,%bl
+  800a45:	77 08                	ja     800a4f <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a47:	0f be c0             	movsbl %al,%eax
+  800a4a:	83 e8 37             	sub    $0x37,%eax
+  800a4d:	eb c1                	jmp    800a10 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a4f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a53:	74 05                	je     800a5a <strtol+0xcc>
+		*endptr = (char *) s;
+  800a55:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a58:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a5a:	89 c8                	mov    %ecx,%eax
+  800a5c:	f7 d8                	neg    %eax
+  800a5e:	85 ff                	test   %edi,%edi
+  800a60:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a63:	89 c8                	mov    %ecx,%eax
+  800a65:	5b                   	pop    %ebx
+  800a66:	5e                   	pop    %esi
+  800a67:	5f                   	pop    %edi
+  800a68:	5d                   	pop    %ebp
+  800a69:	c3                   	ret
+
+00800a6a <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800a6a:	55                   	push   %ebp
+  800a6b:	89 e5                	mov    %esp,%ebp
+  800a6d:	57                   	push   %edi
+  800a6e:	56                   	push   %esi
+  800a6f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800a70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a7b:	89 c3                	mov    %eax,%ebx
+  800a7d:	89 c7                	mov    %eax,%edi
+  800a7f:	55                   	push   %ebp
+  800a80:	89 e5                	mov    %esp,%ebp
+  800a82:	8d 35 8a 0a 80 00    	lea    0x800a8a,%esi
+  800a88:	0f 34                	sysenter
+  800a8a:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800a8b:	5b                   	pop    %ebx
+  800a8c:	5e                   	pop    %esi
+  800a8d:	5f                   	pop    %edi
+  800a8e:	5d                   	pop    %ebp
+  800a8f:	c3                   	ret
+
+00800a90 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800a90:	55                   	push   %ebp
+  800a91:	89 e5                	mov    %esp,%ebp
+  800a93:	57                   	push   %edi
+  800a94:	56                   	push   %esi
+  800a95:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800a96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800aa0:	89 d1                	mov    %edx,%ecx
+  800aa2:	89 d3                	mov    %edx,%ebx
+  800aa4:	89 d7                	mov    %edx,%edi
+  800aa6:	55                   	push   %ebp
+  800aa7:	89 e5                	mov    %esp,%ebp
+  800aa9:	8d 35 b1 0a 80 00    	lea    0x800ab1,%esi
+  800aaf:	0f 34                	sysenter
+  800ab1:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800ab2:	5b                   	pop    %ebx
+  800ab3:	5e                   	pop    %esi
+  800ab4:	5f                   	pop    %edi
+  800ab5:	5d                   	pop    %ebp
+  800ab6:	c3                   	ret
+
+00800ab7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ab7:	55                   	push   %ebp
+  800ab8:	89 e5                	mov    %esp,%ebp
+  800aba:	57                   	push   %edi
+  800abb:	56                   	push   %esi
+  800abc:	53                   	push   %ebx
+  800abd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ac0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ac5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ac8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800acd:	89 cb                	mov    %ecx,%ebx
+  800acf:	89 cf                	mov    %ecx,%edi
+  800ad1:	55                   	push   %ebp
+  800ad2:	89 e5                	mov    %esp,%ebp
+  800ad4:	8d 35 dc 0a 80 00    	lea    0x800adc,%esi
+  800ada:	0f 34                	sysenter
+  800adc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800add:	85 c0                	test   %eax,%eax
+  800adf:	7f 08                	jg     800ae9 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800ae1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ae4:	5b                   	pop    %ebx
+  800ae5:	5e                   	pop    %esi
+  800ae6:	5f                   	pop    %edi
+  800ae7:	5d                   	pop    %ebp
+  800ae8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ae9:	83 ec 0c             	sub    $0xc,%esp
+  800aec:	50                   	push   %eax
+  800aed:	6a 03                	push   $0x3
+  800aef:	68 a7 3a 80 00       	push   $0x803aa7
+  800af4:	6a 3d                	push   $0x3d
+  800af6:	68 c4 3a 80 00       	push   $0x803ac4
+  800afb:	e8 02 24 00 00       	call   802f02 <_panic>
+
+00800b00 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b00:	55                   	push   %ebp
+  800b01:	89 e5                	mov    %esp,%ebp
+  800b03:	57                   	push   %edi
+  800b04:	56                   	push   %esi
+  800b05:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b0b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b10:	89 d1                	mov    %edx,%ecx
+  800b12:	89 d3                	mov    %edx,%ebx
+  800b14:	89 d7                	mov    %edx,%edi
+  800b16:	55                   	push   %ebp
+  800b17:	89 e5                	mov    %esp,%ebp
+  800b19:	8d 35 21 0b 80 00    	lea    0x800b21,%esi
+  800b1f:	0f 34                	sysenter
+  800b21:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800b22:	5b                   	pop    %ebx
+  800b23:	5e                   	pop    %esi
+  800b24:	5f                   	pop    %edi
+  800b25:	5d                   	pop    %ebp
+  800b26:	c3                   	ret
+
+00800b27 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b27:	55                   	push   %ebp
+  800b28:	89 e5                	mov    %esp,%ebp
+  800b2a:	57                   	push   %edi
+  800b2b:	56                   	push   %esi
+  800b2c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b32:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b37:	89 d1                	mov    %edx,%ecx
+  800b39:	89 d3                	mov    %edx,%ebx
+  800b3b:	89 d7                	mov    %edx,%edi
+  800b3d:	89 d6                	mov    %edx,%esi
+  800b3f:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b41:	5b                   	pop    %ebx
+  800b42:	5e                   	pop    %esi
+  800b43:	5f                   	pop    %edi
+  800b44:	5d                   	pop    %ebp
+  800b45:	c3                   	ret
+
+00800b46 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800b46:	55                   	push   %ebp
+  800b47:	89 e5                	mov    %esp,%ebp
+  800b49:	57                   	push   %edi
+  800b4a:	56                   	push   %esi
+  800b4b:	53                   	push   %ebx
+  800b4c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b55:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b62:	55                   	push   %ebp
+  800b63:	89 e5                	mov    %esp,%ebp
+  800b65:	8d 35 6d 0b 80 00    	lea    0x800b6d,%esi
+  800b6b:	0f 34                	sysenter
+  800b6d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b6e:	85 c0                	test   %eax,%eax
+  800b70:	7f 08                	jg     800b7a <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800b72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b75:	5b                   	pop    %ebx
+  800b76:	5e                   	pop    %esi
+  800b77:	5f                   	pop    %edi
+  800b78:	5d                   	pop    %ebp
+  800b79:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b7a:	83 ec 0c             	sub    $0xc,%esp
+  800b7d:	50                   	push   %eax
+  800b7e:	6a 04                	push   $0x4
+  800b80:	68 a7 3a 80 00       	push   $0x803aa7
+  800b85:	6a 3d                	push   $0x3d
+  800b87:	68 c4 3a 80 00       	push   $0x803ac4
+  800b8c:	e8 71 23 00 00       	call   802f02 <_panic>
+
+00800b91 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800b91:	55                   	push   %ebp
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	57                   	push   %edi
+  800b95:	56                   	push   %esi
+  800b96:	53                   	push   %ebx
+  800b97:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba0:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ba5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ba8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bab:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bb0:	85 c0                	test   %eax,%eax
+  800bb2:	7f 08                	jg     800bbc <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800bb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bb7:	5b                   	pop    %ebx
+  800bb8:	5e                   	pop    %esi
+  800bb9:	5f                   	pop    %edi
+  800bba:	5d                   	pop    %ebp
+  800bbb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bbc:	83 ec 0c             	sub    $0xc,%esp
+  800bbf:	50                   	push   %eax
+  800bc0:	6a 05                	push   $0x5
+  800bc2:	68 a7 3a 80 00       	push   $0x803aa7
+  800bc7:	6a 23                	push   $0x23
+  800bc9:	68 c4 3a 80 00       	push   $0x803ac4
+  800bce:	e8 2f 23 00 00       	call   802f02 <_panic>
+
+00800bd3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800bd3:	55                   	push   %ebp
+  800bd4:	89 e5                	mov    %esp,%ebp
+  800bd6:	57                   	push   %edi
+  800bd7:	56                   	push   %esi
+  800bd8:	53                   	push   %ebx
+  800bd9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800bdc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800be1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800bec:	89 df                	mov    %ebx,%edi
+  800bee:	55                   	push   %ebp
+  800bef:	89 e5                	mov    %esp,%ebp
+  800bf1:	8d 35 f9 0b 80 00    	lea    0x800bf9,%esi
+  800bf7:	0f 34                	sysenter
+  800bf9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bfa:	85 c0                	test   %eax,%eax
+  800bfc:	7f 08                	jg     800c06 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800bfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c01:	5b                   	pop    %ebx
+  800c02:	5e                   	pop    %esi
+  800c03:	5f                   	pop    %edi
+  800c04:	5d                   	pop    %ebp
+  800c05:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c06:	83 ec 0c             	sub    $0xc,%esp
+  800c09:	50                   	push   %eax
+  800c0a:	6a 06                	push   $0x6
+  800c0c:	68 a7 3a 80 00       	push   $0x803aa7
+  800c11:	6a 3d                	push   $0x3d
+  800c13:	68 c4 3a 80 00       	push   $0x803ac4
+  800c18:	e8 e5 22 00 00       	call   802f02 <_panic>
+
+00800c1d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800c1d:	55                   	push   %ebp
+  800c1e:	89 e5                	mov    %esp,%ebp
+  800c20:	57                   	push   %edi
+  800c21:	56                   	push   %esi
+  800c22:	53                   	push   %ebx
+  800c23:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c31:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c36:	89 df                	mov    %ebx,%edi
+  800c38:	55                   	push   %ebp
+  800c39:	89 e5                	mov    %esp,%ebp
+  800c3b:	8d 35 43 0c 80 00    	lea    0x800c43,%esi
+  800c41:	0f 34                	sysenter
+  800c43:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c44:	85 c0                	test   %eax,%eax
+  800c46:	7f 08                	jg     800c50 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800c48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c4b:	5b                   	pop    %ebx
+  800c4c:	5e                   	pop    %esi
+  800c4d:	5f                   	pop    %edi
+  800c4e:	5d                   	pop    %ebp
+  800c4f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c50:	83 ec 0c             	sub    $0xc,%esp
+  800c53:	50                   	push   %eax
+  800c54:	6a 08                	push   $0x8
+  800c56:	68 a7 3a 80 00       	push   $0x803aa7
+  800c5b:	6a 3d                	push   $0x3d
+  800c5d:	68 c4 3a 80 00       	push   $0x803ac4
+  800c62:	e8 9b 22 00 00       	call   802f02 <_panic>
+
+00800c67 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800c67:	55                   	push   %ebp
+  800c68:	89 e5                	mov    %esp,%ebp
+  800c6a:	57                   	push   %edi
+  800c6b:	56                   	push   %esi
+  800c6c:	53                   	push   %ebx
+  800c6d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c80:	89 df                	mov    %ebx,%edi
+  800c82:	55                   	push   %ebp
+  800c83:	89 e5                	mov    %esp,%ebp
+  800c85:	8d 35 8d 0c 80 00    	lea    0x800c8d,%esi
+  800c8b:	0f 34                	sysenter
+  800c8d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c8e:	85 c0                	test   %eax,%eax
+  800c90:	7f 08                	jg     800c9a <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800c92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c95:	5b                   	pop    %ebx
+  800c96:	5e                   	pop    %esi
+  800c97:	5f                   	pop    %edi
+  800c98:	5d                   	pop    %ebp
+  800c99:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c9a:	83 ec 0c             	sub    $0xc,%esp
+  800c9d:	50                   	push   %eax
+  800c9e:	6a 09                	push   $0x9
+  800ca0:	68 a7 3a 80 00       	push   $0x803aa7
+  800ca5:	6a 3d                	push   $0x3d
+  800ca7:	68 c4 3a 80 00       	push   $0x803ac4
+  800cac:	e8 51 22 00 00       	call   802f02 <_panic>
+
+00800cb1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800cb1:	55                   	push   %ebp
+  800cb2:	89 e5                	mov    %esp,%ebp
+  800cb4:	57                   	push   %edi
+  800cb5:	56                   	push   %esi
+  800cb6:	53                   	push   %ebx
+  800cb7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cca:	89 df                	mov    %ebx,%edi
+  800ccc:	55                   	push   %ebp
+  800ccd:	89 e5                	mov    %esp,%ebp
+  800ccf:	8d 35 d7 0c 80 00    	lea    0x800cd7,%esi
+  800cd5:	0f 34                	sysenter
+  800cd7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cd8:	85 c0                	test   %eax,%eax
+  800cda:	7f 08                	jg     800ce4 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800cdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdf:	5b                   	pop    %ebx
+  800ce0:	5e                   	pop    %esi
+  800ce1:	5f                   	pop    %edi
+  800ce2:	5d                   	pop    %ebp
+  800ce3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce4:	83 ec 0c             	sub    $0xc,%esp
+  800ce7:	50                   	push   %eax
+  800ce8:	6a 0a                	push   $0xa
+  800cea:	68 a7 3a 80 00       	push   $0x803aa7
+  800cef:	6a 3d                	push   $0x3d
+  800cf1:	68 c4 3a 80 00       	push   $0x803ac4
+  800cf6:	e8 07 22 00 00       	call   802f02 <_panic>
+
+00800cfb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800cfb:	55                   	push   %ebp
+  800cfc:	89 e5                	mov    %esp,%ebp
+  800cfe:	57                   	push   %edi
+  800cff:	56                   	push   %esi
+  800d00:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d07:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d0f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d12:	55                   	push   %ebp
+  800d13:	89 e5                	mov    %esp,%ebp
+  800d15:	8d 35 1d 0d 80 00    	lea    0x800d1d,%esi
+  800d1b:	0f 34                	sysenter
+  800d1d:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800d1e:	5b                   	pop    %ebx
+  800d1f:	5e                   	pop    %esi
+  800d20:	5f                   	pop    %edi
+  800d21:	5d                   	pop    %ebp
+  800d22:	c3                   	ret
+
+00800d23 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800d23:	55                   	push   %ebp
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	57                   	push   %edi
+  800d27:	56                   	push   %esi
+  800d28:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2f:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d34:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d37:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d3a:	55                   	push   %ebp
+  800d3b:	89 e5                	mov    %esp,%ebp
+  800d3d:	8d 35 45 0d 80 00    	lea    0x800d45,%esi
+  800d43:	0f 34                	sysenter
+  800d45:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800d46:	5b                   	pop    %ebx
+  800d47:	5e                   	pop    %esi
+  800d48:	5f                   	pop    %edi
+  800d49:	5d                   	pop    %ebp
+  800d4a:	c3                   	ret
+
+00800d4b <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800d4b:	55                   	push   %ebp
+  800d4c:	89 e5                	mov    %esp,%ebp
+  800d4e:	57                   	push   %edi
+  800d4f:	56                   	push   %esi
+  800d50:	53                   	push   %ebx
+  800d51:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d54:	be 00 00 00 00       	mov    $0x0,%esi
+  800d59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d67:	89 f7                	mov    %esi,%edi
+  800d69:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d6b:	85 c0                	test   %eax,%eax
+  800d6d:	7f 08                	jg     800d77 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800d6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d72:	5b                   	pop    %ebx
+  800d73:	5e                   	pop    %esi
+  800d74:	5f                   	pop    %edi
+  800d75:	5d                   	pop    %ebp
+  800d76:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d77:	83 ec 0c             	sub    $0xc,%esp
+  800d7a:	50                   	push   %eax
+  800d7b:	6a 0d                	push   $0xd
+  800d7d:	68 a7 3a 80 00       	push   $0x803aa7
+  800d82:	6a 23                	push   $0x23
+  800d84:	68 c4 3a 80 00       	push   $0x803ac4
+  800d89:	e8 74 21 00 00       	call   802f02 <_panic>
+
+00800d8e <sys_ipc_recv>:
+{
+  800d8e:	55                   	push   %ebp
+  800d8f:	89 e5                	mov    %esp,%ebp
+  800d91:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800d94:	6a 00                	push   $0x0
+  800d96:	6a 01                	push   $0x1
+  800d98:	ff 75 08             	push   0x8(%ebp)
+  800d9b:	e8 ab ff ff ff       	call   800d4b <sys_ipc_recvv>
+}
+  800da0:	c9                   	leave
+  800da1:	c3                   	ret
+
+00800da2 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800da2:	55                   	push   %ebp
+  800da3:	89 e5                	mov    %esp,%ebp
+  800da5:	57                   	push   %edi
+  800da6:	56                   	push   %esi
+  800da7:	53                   	push   %ebx
+  800da8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800dbb:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800dbe:	89 de                	mov    %ebx,%esi
+  800dc0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc2:	85 c0                	test   %eax,%eax
+  800dc4:	7f 08                	jg     800dce <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800dc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc9:	5b                   	pop    %ebx
+  800dca:	5e                   	pop    %esi
+  800dcb:	5f                   	pop    %edi
+  800dcc:	5d                   	pop    %ebp
+  800dcd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dce:	83 ec 0c             	sub    $0xc,%esp
+  800dd1:	50                   	push   %eax
+  800dd2:	6a 0d                	push   $0xd
+  800dd4:	68 a7 3a 80 00       	push   $0x803aa7
+  800dd9:	6a 23                	push   $0x23
+  800ddb:	68 c4 3a 80 00       	push   $0x803ac4
+  800de0:	e8 1d 21 00 00       	call   802f02 <_panic>
+
+00800de5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	57                   	push   %edi
+  800de9:	56                   	push   %esi
+  800dea:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800deb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800df5:	89 d1                	mov    %edx,%ecx
+  800df7:	89 d3                	mov    %edx,%ebx
+  800df9:	89 d7                	mov    %edx,%edi
+  800dfb:	55                   	push   %ebp
+  800dfc:	89 e5                	mov    %esp,%ebp
+  800dfe:	8d 35 06 0e 80 00    	lea    0x800e06,%esi
+  800e04:	0f 34                	sysenter
+  800e06:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800e07:	5b                   	pop    %ebx
+  800e08:	5e                   	pop    %esi
+  800e09:	5f                   	pop    %edi
+  800e0a:	5d                   	pop    %ebp
+  800e0b:	c3                   	ret
+
+00800e0c <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800e0c:	55                   	push   %ebp
+  800e0d:	89 e5                	mov    %esp,%ebp
+  800e0f:	57                   	push   %edi
+  800e10:	56                   	push   %esi
+  800e11:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e22:	89 df                	mov    %ebx,%edi
+  800e24:	55                   	push   %ebp
+  800e25:	89 e5                	mov    %esp,%ebp
+  800e27:	8d 35 2f 0e 80 00    	lea    0x800e2f,%esi
+  800e2d:	0f 34                	sysenter
+  800e2f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800e30:	5b                   	pop    %ebx
+  800e31:	5e                   	pop    %esi
+  800e32:	5f                   	pop    %edi
+  800e33:	5d                   	pop    %ebp
+  800e34:	c3                   	ret
+
+00800e35 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	57                   	push   %edi
+  800e39:	56                   	push   %esi
+  800e3a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e43:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e48:	89 cb                	mov    %ecx,%ebx
+  800e4a:	89 cf                	mov    %ecx,%edi
+  800e4c:	55                   	push   %ebp
+  800e4d:	89 e5                	mov    %esp,%ebp
+  800e4f:	8d 35 57 0e 80 00    	lea    0x800e57,%esi
+  800e55:	0f 34                	sysenter
+  800e57:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5f                   	pop    %edi
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+
+00800e5d <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800e5d:	55                   	push   %ebp
+  800e5e:	89 e5                	mov    %esp,%ebp
+  800e60:	57                   	push   %edi
+  800e61:	56                   	push   %esi
+  800e62:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6e:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e73:	89 df                	mov    %ebx,%edi
+  800e75:	55                   	push   %ebp
+  800e76:	89 e5                	mov    %esp,%ebp
+  800e78:	8d 35 80 0e 80 00    	lea    0x800e80,%esi
+  800e7e:	0f 34                	sysenter
+  800e80:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800e81:	5b                   	pop    %ebx
+  800e82:	5e                   	pop    %esi
+  800e83:	5f                   	pop    %edi
+  800e84:	5d                   	pop    %ebp
+  800e85:	c3                   	ret
+
+00800e86 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800e86:	55                   	push   %ebp
+  800e87:	89 e5                	mov    %esp,%ebp
+  800e89:	57                   	push   %edi
+  800e8a:	56                   	push   %esi
+  800e8b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e97:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e9c:	89 df                	mov    %ebx,%edi
+  800e9e:	55                   	push   %ebp
+  800e9f:	89 e5                	mov    %esp,%ebp
+  800ea1:	8d 35 a9 0e 80 00    	lea    0x800ea9,%esi
+  800ea7:	0f 34                	sysenter
+  800ea9:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800eaa:	5b                   	pop    %ebx
+  800eab:	5e                   	pop    %esi
+  800eac:	5f                   	pop    %edi
+  800ead:	5d                   	pop    %ebp
+  800eae:	c3                   	ret
+
+00800eaf <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800eaf:	55                   	push   %ebp
+  800eb0:	89 e5                	mov    %esp,%ebp
+  800eb2:	57                   	push   %edi
+  800eb3:	56                   	push   %esi
+  800eb4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebb:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ec0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec6:	55                   	push   %ebp
+  800ec7:	89 e5                	mov    %esp,%ebp
+  800ec9:	8d 35 d1 0e 80 00    	lea    0x800ed1,%esi
+  800ecf:	0f 34                	sysenter
+  800ed1:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800ed2:	5b                   	pop    %ebx
+  800ed3:	5e                   	pop    %esi
+  800ed4:	5f                   	pop    %edi
+  800ed5:	5d                   	pop    %ebp
+  800ed6:	c3                   	ret
+
+00800ed7 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800ed7:	55                   	push   %ebp
+  800ed8:	89 e5                	mov    %esp,%ebp
+  800eda:	57                   	push   %edi
+  800edb:	56                   	push   %esi
+  800edc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800edd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ee2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee5:	b8 11 00 00 00       	mov    $0x11,%eax
+  800eea:	89 cb                	mov    %ecx,%ebx
+  800eec:	89 cf                	mov    %ecx,%edi
+  800eee:	89 ce                	mov    %ecx,%esi
+  800ef0:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800ef2:	5b                   	pop    %ebx
+  800ef3:	5e                   	pop    %esi
+  800ef4:	5f                   	pop    %edi
+  800ef5:	5d                   	pop    %ebp
+  800ef6:	c3                   	ret
+
+00800ef7 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800ef7:	55                   	push   %ebp
+  800ef8:	89 e5                	mov    %esp,%ebp
+  800efa:	57                   	push   %edi
+  800efb:	56                   	push   %esi
+  800efc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800efd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f05:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f0a:	89 cb                	mov    %ecx,%ebx
+  800f0c:	89 cf                	mov    %ecx,%edi
+  800f0e:	55                   	push   %ebp
+  800f0f:	89 e5                	mov    %esp,%ebp
+  800f11:	8d 35 19 0f 80 00    	lea    0x800f19,%esi
+  800f17:	0f 34                	sysenter
+  800f19:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800f1a:	5b                   	pop    %ebx
+  800f1b:	5e                   	pop    %esi
+  800f1c:	5f                   	pop    %edi
+  800f1d:	5d                   	pop    %ebp
+  800f1e:	c3                   	ret
+
+00800f1f <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800f1f:	55                   	push   %ebp
+  800f20:	89 e5                	mov    %esp,%ebp
+  800f22:	57                   	push   %edi
+  800f23:	56                   	push   %esi
+  800f24:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f25:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2d:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f32:	89 cb                	mov    %ecx,%ebx
+  800f34:	89 cf                	mov    %ecx,%edi
+  800f36:	55                   	push   %ebp
+  800f37:	89 e5                	mov    %esp,%ebp
+  800f39:	8d 35 41 0f 80 00    	lea    0x800f41,%esi
+  800f3f:	0f 34                	sysenter
+  800f41:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800f42:	5b                   	pop    %ebx
+  800f43:	5e                   	pop    %esi
+  800f44:	5f                   	pop    %edi
+  800f45:	5d                   	pop    %ebp
+  800f46:	c3                   	ret
+
+00800f47 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800f47:	55                   	push   %ebp
+  800f48:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f4d:	05 00 00 00 30       	add    $0x30000000,%eax
+  800f52:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800f55:	5d                   	pop    %ebp
+  800f56:	c3                   	ret
+
+00800f57 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800f57:	55                   	push   %ebp
+  800f58:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f5d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800f62:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800f67:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800f6c:	5d                   	pop    %ebp
+  800f6d:	c3                   	ret
+
+00800f6e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800f6e:	55                   	push   %ebp
+  800f6f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800f71:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800f76:	eb 02                	jmp    800f7a <fd_alloc+0xc>
+  800f78:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800f7a:	89 c2                	mov    %eax,%edx
+  800f7c:	c1 ea 16             	shr    $0x16,%edx
+  800f7f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800f86:	f6 c2 01             	test   $0x1,%dl
+  800f89:	74 2b                	je     800fb6 <fd_alloc+0x48>
+  800f8b:	89 c2                	mov    %eax,%edx
+  800f8d:	c1 ea 0c             	shr    $0xc,%edx
+  800f90:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800f97:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800f9d:	f6 c1 01             	test   $0x1,%cl
+  800fa0:	74 14                	je     800fb6 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800fa2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800fa8:	75 ce                	jne    800f78 <fd_alloc+0xa>
+  800faa:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800faf:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800fb4:	eb 05                	jmp    800fbb <fd_alloc+0x4d>
+			return 0;
+  800fb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800fbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbe:	89 02                	mov    %eax,(%edx)
+}
+  800fc0:	89 c8                	mov    %ecx,%eax
+  800fc2:	5d                   	pop    %ebp
+  800fc3:	c3                   	ret
+
+00800fc4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800fc4:	55                   	push   %ebp
+  800fc5:	89 e5                	mov    %esp,%ebp
+  800fc7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800fca:	83 f8 1f             	cmp    $0x1f,%eax
+  800fcd:	77 30                	ja     800fff <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800fcf:	c1 e0 0c             	shl    $0xc,%eax
+  800fd2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800fd7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800fdd:	f6 c2 01             	test   $0x1,%dl
+  800fe0:	74 24                	je     801006 <fd_lookup+0x42>
+  800fe2:	89 c2                	mov    %eax,%edx
+  800fe4:	c1 ea 0c             	shr    $0xc,%edx
+  800fe7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800fee:	f6 c2 01             	test   $0x1,%dl
+  800ff1:	74 1a                	je     80100d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800ff3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ff6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ffd:	5d                   	pop    %ebp
+  800ffe:	c3                   	ret
+		return -E_INVAL;
+  800fff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801004:	eb f7                	jmp    800ffd <fd_lookup+0x39>
+		return -E_INVAL;
+  801006:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80100b:	eb f0                	jmp    800ffd <fd_lookup+0x39>
+  80100d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801012:	eb e9                	jmp    800ffd <fd_lookup+0x39>
+
+00801014 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801014:	55                   	push   %ebp
+  801015:	89 e5                	mov    %esp,%ebp
+  801017:	53                   	push   %ebx
+  801018:	83 ec 04             	sub    $0x4,%esp
+  80101b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80101e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801023:	eb 03                	jmp    801028 <dev_lookup+0x14>
+  801025:	83 c0 01             	add    $0x1,%eax
+  801028:	8b 1c 85 50 3b 80 00 	mov    0x803b50(,%eax,4),%ebx
+  80102f:	85 db                	test   %ebx,%ebx
+  801031:	74 0b                	je     80103e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801033:	39 13                	cmp    %edx,(%ebx)
+  801035:	75 ee                	jne    801025 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801037:	b8 00 00 00 00       	mov    $0x0,%eax
+  80103c:	eb 1f                	jmp    80105d <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80103e:	a1 04 50 80 00       	mov    0x805004,%eax
+  801043:	8b 40 48             	mov    0x48(%eax),%eax
+  801046:	83 ec 04             	sub    $0x4,%esp
+  801049:	52                   	push   %edx
+  80104a:	50                   	push   %eax
+  80104b:	68 d4 3a 80 00       	push   $0x803ad4
+  801050:	e8 f7 f0 ff ff       	call   80014c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801055:	83 c4 10             	add    $0x10,%esp
+  801058:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80105d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801060:	89 1a                	mov    %ebx,(%edx)
+}
+  801062:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801065:	c9                   	leave
+  801066:	c3                   	ret
+
+00801067 <fd_close>:
+{
+  801067:	55                   	push   %ebp
+  801068:	89 e5                	mov    %esp,%ebp
+  80106a:	57                   	push   %edi
+  80106b:	56                   	push   %esi
+  80106c:	53                   	push   %ebx
+  80106d:	83 ec 24             	sub    $0x24,%esp
+  801070:	8b 75 08             	mov    0x8(%ebp),%esi
+  801073:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801076:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801079:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80107a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801080:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801083:	50                   	push   %eax
+  801084:	e8 3b ff ff ff       	call   800fc4 <fd_lookup>
+  801089:	89 c3                	mov    %eax,%ebx
+  80108b:	83 c4 10             	add    $0x10,%esp
+  80108e:	85 c0                	test   %eax,%eax
+  801090:	78 05                	js     801097 <fd_close+0x30>
+	    || fd != fd2)
+  801092:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801095:	74 16                	je     8010ad <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801097:	89 f8                	mov    %edi,%eax
+  801099:	84 c0                	test   %al,%al
+  80109b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8010a3:	89 d8                	mov    %ebx,%eax
+  8010a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a8:	5b                   	pop    %ebx
+  8010a9:	5e                   	pop    %esi
+  8010aa:	5f                   	pop    %edi
+  8010ab:	5d                   	pop    %ebp
+  8010ac:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8010ad:	83 ec 08             	sub    $0x8,%esp
+  8010b0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8010b3:	50                   	push   %eax
+  8010b4:	ff 36                	push   (%esi)
+  8010b6:	e8 59 ff ff ff       	call   801014 <dev_lookup>
+  8010bb:	89 c3                	mov    %eax,%ebx
+  8010bd:	83 c4 10             	add    $0x10,%esp
+  8010c0:	85 c0                	test   %eax,%eax
+  8010c2:	78 1a                	js     8010de <fd_close+0x77>
+		if (dev->dev_close)
+  8010c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8010c7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8010ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8010cf:	85 c0                	test   %eax,%eax
+  8010d1:	74 0b                	je     8010de <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8010d3:	83 ec 0c             	sub    $0xc,%esp
+  8010d6:	56                   	push   %esi
+  8010d7:	ff d0                	call   *%eax
+  8010d9:	89 c3                	mov    %eax,%ebx
+  8010db:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8010de:	83 ec 08             	sub    $0x8,%esp
+  8010e1:	56                   	push   %esi
+  8010e2:	6a 00                	push   $0x0
+  8010e4:	e8 ea fa ff ff       	call   800bd3 <sys_page_unmap>
+	return r;
+  8010e9:	83 c4 10             	add    $0x10,%esp
+  8010ec:	eb b5                	jmp    8010a3 <fd_close+0x3c>
+
+008010ee <close>:
+
+int
+close(int fdnum)
+{
+  8010ee:	55                   	push   %ebp
+  8010ef:	89 e5                	mov    %esp,%ebp
+  8010f1:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8010f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010f7:	50                   	push   %eax
+  8010f8:	ff 75 08             	push   0x8(%ebp)
+  8010fb:	e8 c4 fe ff ff       	call   800fc4 <fd_lookup>
+  801100:	83 c4 10             	add    $0x10,%esp
+  801103:	85 c0                	test   %eax,%eax
+  801105:	79 02                	jns    801109 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801107:	c9                   	leave
+  801108:	c3                   	ret
+		return fd_close(fd, 1);
+  801109:	83 ec 08             	sub    $0x8,%esp
+  80110c:	6a 01                	push   $0x1
+  80110e:	ff 75 f4             	push   -0xc(%ebp)
+  801111:	e8 51 ff ff ff       	call   801067 <fd_close>
+  801116:	83 c4 10             	add    $0x10,%esp
+  801119:	eb ec                	jmp    801107 <close+0x19>
+
+0080111b <close_all>:
+
+void
+close_all(void)
+{
+  80111b:	55                   	push   %ebp
+  80111c:	89 e5                	mov    %esp,%ebp
+  80111e:	53                   	push   %ebx
+  80111f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801122:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801127:	83 ec 0c             	sub    $0xc,%esp
+  80112a:	53                   	push   %ebx
+  80112b:	e8 be ff ff ff       	call   8010ee <close>
+	for (i = 0; i < MAXFD; i++)
+  801130:	83 c3 01             	add    $0x1,%ebx
+  801133:	83 c4 10             	add    $0x10,%esp
+  801136:	83 fb 20             	cmp    $0x20,%ebx
+  801139:	75 ec                	jne    801127 <close_all+0xc>
+}
+  80113b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80113e:	c9                   	leave
+  80113f:	c3                   	ret
+
+00801140 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801140:	55                   	push   %ebp
+  801141:	89 e5                	mov    %esp,%ebp
+  801143:	57                   	push   %edi
+  801144:	56                   	push   %esi
+  801145:	53                   	push   %ebx
+  801146:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801149:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80114c:	50                   	push   %eax
+  80114d:	ff 75 08             	push   0x8(%ebp)
+  801150:	e8 6f fe ff ff       	call   800fc4 <fd_lookup>
+  801155:	89 c3                	mov    %eax,%ebx
+  801157:	83 c4 10             	add    $0x10,%esp
+  80115a:	85 c0                	test   %eax,%eax
+  80115c:	78 7f                	js     8011dd <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80115e:	83 ec 0c             	sub    $0xc,%esp
+  801161:	ff 75 0c             	push   0xc(%ebp)
+  801164:	e8 85 ff ff ff       	call   8010ee <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801169:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80116c:	c1 e6 0c             	shl    $0xc,%esi
+  80116f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801175:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801178:	89 3c 24             	mov    %edi,(%esp)
+  80117b:	e8 d7 fd ff ff       	call   800f57 <fd2data>
+  801180:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801182:	89 34 24             	mov    %esi,(%esp)
+  801185:	e8 cd fd ff ff       	call   800f57 <fd2data>
+  80118a:	83 c4 10             	add    $0x10,%esp
+  80118d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801190:	89 d8                	mov    %ebx,%eax
+  801192:	c1 e8 16             	shr    $0x16,%eax
+  801195:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80119c:	a8 01                	test   $0x1,%al
+  80119e:	74 11                	je     8011b1 <dup+0x71>
+  8011a0:	89 d8                	mov    %ebx,%eax
+  8011a2:	c1 e8 0c             	shr    $0xc,%eax
+  8011a5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011ac:	f6 c2 01             	test   $0x1,%dl
+  8011af:	75 36                	jne    8011e7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8011b1:	89 f8                	mov    %edi,%eax
+  8011b3:	c1 e8 0c             	shr    $0xc,%eax
+  8011b6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011bd:	83 ec 0c             	sub    $0xc,%esp
+  8011c0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011c5:	50                   	push   %eax
+  8011c6:	56                   	push   %esi
+  8011c7:	6a 00                	push   $0x0
+  8011c9:	57                   	push   %edi
+  8011ca:	6a 00                	push   $0x0
+  8011cc:	e8 c0 f9 ff ff       	call   800b91 <sys_page_map>
+  8011d1:	89 c3                	mov    %eax,%ebx
+  8011d3:	83 c4 20             	add    $0x20,%esp
+  8011d6:	85 c0                	test   %eax,%eax
+  8011d8:	78 33                	js     80120d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8011da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8011dd:	89 d8                	mov    %ebx,%eax
+  8011df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e2:	5b                   	pop    %ebx
+  8011e3:	5e                   	pop    %esi
+  8011e4:	5f                   	pop    %edi
+  8011e5:	5d                   	pop    %ebp
+  8011e6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8011e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011ee:	83 ec 0c             	sub    $0xc,%esp
+  8011f1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011f6:	50                   	push   %eax
+  8011f7:	ff 75 d4             	push   -0x2c(%ebp)
+  8011fa:	6a 00                	push   $0x0
+  8011fc:	53                   	push   %ebx
+  8011fd:	6a 00                	push   $0x0
+  8011ff:	e8 8d f9 ff ff       	call   800b91 <sys_page_map>
+  801204:	89 c3                	mov    %eax,%ebx
+  801206:	83 c4 20             	add    $0x20,%esp
+  801209:	85 c0                	test   %eax,%eax
+  80120b:	79 a4                	jns    8011b1 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80120d:	83 ec 08             	sub    $0x8,%esp
+  801210:	56                   	push   %esi
+  801211:	6a 00                	push   $0x0
+  801213:	e8 bb f9 ff ff       	call   800bd3 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801218:	83 c4 08             	add    $0x8,%esp
+  80121b:	ff 75 d4             	push   -0x2c(%ebp)
+  80121e:	6a 00                	push   $0x0
+  801220:	e8 ae f9 ff ff       	call   800bd3 <sys_page_unmap>
+	return r;
+  801225:	83 c4 10             	add    $0x10,%esp
+  801228:	eb b3                	jmp    8011dd <dup+0x9d>
+
+0080122a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80122a:	55                   	push   %ebp
+  80122b:	89 e5                	mov    %esp,%ebp
+  80122d:	56                   	push   %esi
+  80122e:	53                   	push   %ebx
+  80122f:	83 ec 18             	sub    $0x18,%esp
+  801232:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801235:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801238:	50                   	push   %eax
+  801239:	56                   	push   %esi
+  80123a:	e8 85 fd ff ff       	call   800fc4 <fd_lookup>
+  80123f:	83 c4 10             	add    $0x10,%esp
+  801242:	85 c0                	test   %eax,%eax
+  801244:	78 3c                	js     801282 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801246:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801249:	83 ec 08             	sub    $0x8,%esp
+  80124c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80124f:	50                   	push   %eax
+  801250:	ff 33                	push   (%ebx)
+  801252:	e8 bd fd ff ff       	call   801014 <dev_lookup>
+  801257:	83 c4 10             	add    $0x10,%esp
+  80125a:	85 c0                	test   %eax,%eax
+  80125c:	78 24                	js     801282 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80125e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801261:	83 e0 03             	and    $0x3,%eax
+  801264:	83 f8 01             	cmp    $0x1,%eax
+  801267:	74 20                	je     801289 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801269:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80126c:	8b 40 08             	mov    0x8(%eax),%eax
+  80126f:	85 c0                	test   %eax,%eax
+  801271:	74 37                	je     8012aa <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801273:	83 ec 04             	sub    $0x4,%esp
+  801276:	ff 75 10             	push   0x10(%ebp)
+  801279:	ff 75 0c             	push   0xc(%ebp)
+  80127c:	53                   	push   %ebx
+  80127d:	ff d0                	call   *%eax
+  80127f:	83 c4 10             	add    $0x10,%esp
+}
+  801282:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801285:	5b                   	pop    %ebx
+  801286:	5e                   	pop    %esi
+  801287:	5d                   	pop    %ebp
+  801288:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801289:	a1 04 50 80 00       	mov    0x805004,%eax
+  80128e:	8b 40 48             	mov    0x48(%eax),%eax
+  801291:	83 ec 04             	sub    $0x4,%esp
+  801294:	56                   	push   %esi
+  801295:	50                   	push   %eax
+  801296:	68 15 3b 80 00       	push   $0x803b15
+  80129b:	e8 ac ee ff ff       	call   80014c <cprintf>
+		return -E_INVAL;
+  8012a0:	83 c4 10             	add    $0x10,%esp
+  8012a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012a8:	eb d8                	jmp    801282 <read+0x58>
+		return -E_NOT_SUPP;
+  8012aa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012af:	eb d1                	jmp    801282 <read+0x58>
+
+008012b1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8012b1:	55                   	push   %ebp
+  8012b2:	89 e5                	mov    %esp,%ebp
+  8012b4:	57                   	push   %edi
+  8012b5:	56                   	push   %esi
+  8012b6:	53                   	push   %ebx
+  8012b7:	83 ec 0c             	sub    $0xc,%esp
+  8012ba:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8012bd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8012c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c5:	eb 02                	jmp    8012c9 <readn+0x18>
+  8012c7:	01 c3                	add    %eax,%ebx
+  8012c9:	39 f3                	cmp    %esi,%ebx
+  8012cb:	73 21                	jae    8012ee <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8012cd:	83 ec 04             	sub    $0x4,%esp
+  8012d0:	89 f0                	mov    %esi,%eax
+  8012d2:	29 d8                	sub    %ebx,%eax
+  8012d4:	50                   	push   %eax
+  8012d5:	89 d8                	mov    %ebx,%eax
+  8012d7:	03 45 0c             	add    0xc(%ebp),%eax
+  8012da:	50                   	push   %eax
+  8012db:	57                   	push   %edi
+  8012dc:	e8 49 ff ff ff       	call   80122a <read>
+		if (m < 0)
+  8012e1:	83 c4 10             	add    $0x10,%esp
+  8012e4:	85 c0                	test   %eax,%eax
+  8012e6:	78 04                	js     8012ec <readn+0x3b>
+			return m;
+		if (m == 0)
+  8012e8:	75 dd                	jne    8012c7 <readn+0x16>
+  8012ea:	eb 02                	jmp    8012ee <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8012ec:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8012ee:	89 d8                	mov    %ebx,%eax
+  8012f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f3:	5b                   	pop    %ebx
+  8012f4:	5e                   	pop    %esi
+  8012f5:	5f                   	pop    %edi
+  8012f6:	5d                   	pop    %ebp
+  8012f7:	c3                   	ret
+
+008012f8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	56                   	push   %esi
+  8012fc:	53                   	push   %ebx
+  8012fd:	83 ec 18             	sub    $0x18,%esp
+  801300:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801303:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801306:	50                   	push   %eax
+  801307:	53                   	push   %ebx
+  801308:	e8 b7 fc ff ff       	call   800fc4 <fd_lookup>
+  80130d:	83 c4 10             	add    $0x10,%esp
+  801310:	85 c0                	test   %eax,%eax
+  801312:	78 37                	js     80134b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801314:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801317:	83 ec 08             	sub    $0x8,%esp
+  80131a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80131d:	50                   	push   %eax
+  80131e:	ff 36                	push   (%esi)
+  801320:	e8 ef fc ff ff       	call   801014 <dev_lookup>
+  801325:	83 c4 10             	add    $0x10,%esp
+  801328:	85 c0                	test   %eax,%eax
+  80132a:	78 1f                	js     80134b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80132c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801330:	74 20                	je     801352 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801332:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801335:	8b 40 0c             	mov    0xc(%eax),%eax
+  801338:	85 c0                	test   %eax,%eax
+  80133a:	74 37                	je     801373 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80133c:	83 ec 04             	sub    $0x4,%esp
+  80133f:	ff 75 10             	push   0x10(%ebp)
+  801342:	ff 75 0c             	push   0xc(%ebp)
+  801345:	56                   	push   %esi
+  801346:	ff d0                	call   *%eax
+  801348:	83 c4 10             	add    $0x10,%esp
+}
+  80134b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80134e:	5b                   	pop    %ebx
+  80134f:	5e                   	pop    %esi
+  801350:	5d                   	pop    %ebp
+  801351:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801352:	a1 04 50 80 00       	mov    0x805004,%eax
+  801357:	8b 40 48             	mov    0x48(%eax),%eax
+  80135a:	83 ec 04             	sub    $0x4,%esp
+  80135d:	53                   	push   %ebx
+  80135e:	50                   	push   %eax
+  80135f:	68 31 3b 80 00       	push   $0x803b31
+  801364:	e8 e3 ed ff ff       	call   80014c <cprintf>
+		return -E_INVAL;
+  801369:	83 c4 10             	add    $0x10,%esp
+  80136c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801371:	eb d8                	jmp    80134b <write+0x53>
+		return -E_NOT_SUPP;
+  801373:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801378:	eb d1                	jmp    80134b <write+0x53>
+
+0080137a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80137a:	55                   	push   %ebp
+  80137b:	89 e5                	mov    %esp,%ebp
+  80137d:	53                   	push   %ebx
+  80137e:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801381:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801384:	50                   	push   %eax
+  801385:	ff 75 08             	push   0x8(%ebp)
+  801388:	e8 37 fc ff ff       	call   800fc4 <fd_lookup>
+  80138d:	83 c4 10             	add    $0x10,%esp
+  801390:	85 c0                	test   %eax,%eax
+  801392:	78 3a                	js     8013ce <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801394:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801397:	83 ec 08             	sub    $0x8,%esp
+  80139a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80139d:	50                   	push   %eax
+  80139e:	ff 33                	push   (%ebx)
+  8013a0:	e8 6f fc ff ff       	call   801014 <dev_lookup>
+  8013a5:	83 c4 10             	add    $0x10,%esp
+  8013a8:	85 c0                	test   %eax,%eax
+  8013aa:	78 22                	js     8013ce <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8013ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013af:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8013b2:	85 c0                	test   %eax,%eax
+  8013b4:	74 0d                	je     8013c3 <seek+0x49>
+  8013b6:	83 ec 0c             	sub    $0xc,%esp
+  8013b9:	53                   	push   %ebx
+  8013ba:	ff d0                	call   *%eax
+  8013bc:	83 c4 10             	add    $0x10,%esp
+  8013bf:	85 c0                	test   %eax,%eax
+  8013c1:	78 0b                	js     8013ce <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8013c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013c6:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8013c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013d1:	c9                   	leave
+  8013d2:	c3                   	ret
+
+008013d3 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8013d3:	55                   	push   %ebp
+  8013d4:	89 e5                	mov    %esp,%ebp
+  8013d6:	53                   	push   %ebx
+  8013d7:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013da:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013dd:	50                   	push   %eax
+  8013de:	ff 75 08             	push   0x8(%ebp)
+  8013e1:	e8 de fb ff ff       	call   800fc4 <fd_lookup>
+  8013e6:	83 c4 10             	add    $0x10,%esp
+  8013e9:	85 c0                	test   %eax,%eax
+  8013eb:	78 2b                	js     801418 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013ed:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8013f0:	83 ec 08             	sub    $0x8,%esp
+  8013f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013f6:	50                   	push   %eax
+  8013f7:	ff 33                	push   (%ebx)
+  8013f9:	e8 16 fc ff ff       	call   801014 <dev_lookup>
+  8013fe:	83 c4 10             	add    $0x10,%esp
+  801401:	85 c0                	test   %eax,%eax
+  801403:	78 13                	js     801418 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801405:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801408:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80140b:	85 c0                	test   %eax,%eax
+  80140d:	74 0e                	je     80141d <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  80140f:	83 ec 0c             	sub    $0xc,%esp
+  801412:	53                   	push   %ebx
+  801413:	ff d0                	call   *%eax
+  801415:	83 c4 10             	add    $0x10,%esp
+}
+  801418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80141b:	c9                   	leave
+  80141c:	c3                   	ret
+		return 0;
+  80141d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801422:	eb f4                	jmp    801418 <fsync+0x45>
+
+00801424 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801424:	55                   	push   %ebp
+  801425:	89 e5                	mov    %esp,%ebp
+  801427:	56                   	push   %esi
+  801428:	53                   	push   %ebx
+  801429:	83 ec 18             	sub    $0x18,%esp
+  80142c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80142f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801432:	50                   	push   %eax
+  801433:	53                   	push   %ebx
+  801434:	e8 8b fb ff ff       	call   800fc4 <fd_lookup>
+  801439:	83 c4 10             	add    $0x10,%esp
+  80143c:	85 c0                	test   %eax,%eax
+  80143e:	78 34                	js     801474 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801440:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801443:	83 ec 08             	sub    $0x8,%esp
+  801446:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801449:	50                   	push   %eax
+  80144a:	ff 36                	push   (%esi)
+  80144c:	e8 c3 fb ff ff       	call   801014 <dev_lookup>
+  801451:	83 c4 10             	add    $0x10,%esp
+  801454:	85 c0                	test   %eax,%eax
+  801456:	78 1c                	js     801474 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801458:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80145c:	74 1d                	je     80147b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80145e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801461:	8b 40 18             	mov    0x18(%eax),%eax
+  801464:	85 c0                	test   %eax,%eax
+  801466:	74 34                	je     80149c <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801468:	83 ec 08             	sub    $0x8,%esp
+  80146b:	ff 75 0c             	push   0xc(%ebp)
+  80146e:	56                   	push   %esi
+  80146f:	ff d0                	call   *%eax
+  801471:	83 c4 10             	add    $0x10,%esp
+}
+  801474:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801477:	5b                   	pop    %ebx
+  801478:	5e                   	pop    %esi
+  801479:	5d                   	pop    %ebp
+  80147a:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80147b:	a1 04 50 80 00       	mov    0x805004,%eax
+  801480:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801483:	83 ec 04             	sub    $0x4,%esp
+  801486:	53                   	push   %ebx
+  801487:	50                   	push   %eax
+  801488:	68 f4 3a 80 00       	push   $0x803af4
+  80148d:	e8 ba ec ff ff       	call   80014c <cprintf>
+		return -E_INVAL;
+  801492:	83 c4 10             	add    $0x10,%esp
+  801495:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80149a:	eb d8                	jmp    801474 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80149c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014a1:	eb d1                	jmp    801474 <ftruncate+0x50>
+
+008014a3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8014a3:	55                   	push   %ebp
+  8014a4:	89 e5                	mov    %esp,%ebp
+  8014a6:	56                   	push   %esi
+  8014a7:	53                   	push   %ebx
+  8014a8:	83 ec 18             	sub    $0x18,%esp
+  8014ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014ae:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014b1:	50                   	push   %eax
+  8014b2:	ff 75 08             	push   0x8(%ebp)
+  8014b5:	e8 0a fb ff ff       	call   800fc4 <fd_lookup>
+  8014ba:	83 c4 10             	add    $0x10,%esp
+  8014bd:	85 c0                	test   %eax,%eax
+  8014bf:	78 49                	js     80150a <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014c1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014c4:	83 ec 08             	sub    $0x8,%esp
+  8014c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014ca:	50                   	push   %eax
+  8014cb:	ff 36                	push   (%esi)
+  8014cd:	e8 42 fb ff ff       	call   801014 <dev_lookup>
+  8014d2:	83 c4 10             	add    $0x10,%esp
+  8014d5:	85 c0                	test   %eax,%eax
+  8014d7:	78 31                	js     80150a <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8014d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014dc:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8014e0:	74 2f                	je     801511 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8014e2:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8014e5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8014ec:	00 00 00 
+	stat->st_isdir = 0;
+  8014ef:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8014f6:	00 00 00 
+	stat->st_dev = dev;
+  8014f9:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8014ff:	83 ec 08             	sub    $0x8,%esp
+  801502:	53                   	push   %ebx
+  801503:	56                   	push   %esi
+  801504:	ff 50 14             	call   *0x14(%eax)
+  801507:	83 c4 10             	add    $0x10,%esp
+}
+  80150a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80150d:	5b                   	pop    %ebx
+  80150e:	5e                   	pop    %esi
+  80150f:	5d                   	pop    %ebp
+  801510:	c3                   	ret
+		return -E_NOT_SUPP;
+  801511:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801516:	eb f2                	jmp    80150a <fstat+0x67>
+
+00801518 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801518:	55                   	push   %ebp
+  801519:	89 e5                	mov    %esp,%ebp
+  80151b:	56                   	push   %esi
+  80151c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  80151d:	83 ec 08             	sub    $0x8,%esp
+  801520:	68 00 10 00 00       	push   $0x1000
+  801525:	ff 75 08             	push   0x8(%ebp)
+  801528:	e8 b3 07 00 00       	call   801ce0 <open>
+  80152d:	89 c3                	mov    %eax,%ebx
+  80152f:	83 c4 10             	add    $0x10,%esp
+  801532:	85 c0                	test   %eax,%eax
+  801534:	78 1b                	js     801551 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801536:	83 ec 08             	sub    $0x8,%esp
+  801539:	ff 75 0c             	push   0xc(%ebp)
+  80153c:	50                   	push   %eax
+  80153d:	e8 61 ff ff ff       	call   8014a3 <fstat>
+  801542:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801544:	89 1c 24             	mov    %ebx,(%esp)
+  801547:	e8 a2 fb ff ff       	call   8010ee <close>
+	return r;
+  80154c:	83 c4 10             	add    $0x10,%esp
+  80154f:	89 f3                	mov    %esi,%ebx
+}
+  801551:	89 d8                	mov    %ebx,%eax
+  801553:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801556:	5b                   	pop    %ebx
+  801557:	5e                   	pop    %esi
+  801558:	5d                   	pop    %ebp
+  801559:	c3                   	ret
+
+0080155a <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  80155a:	55                   	push   %ebp
+  80155b:	89 e5                	mov    %esp,%ebp
+  80155d:	57                   	push   %edi
+  80155e:	56                   	push   %esi
+  80155f:	53                   	push   %ebx
+  801560:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801566:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  80156c:	89 d6                	mov    %edx,%esi
+  80156e:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801574:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801577:	89 d3                	mov    %edx,%ebx
+  801579:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  80157f:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801586:	74 1d                	je     8015a5 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801588:	b8 00 60 80 00       	mov    $0x806000,%eax
+  80158d:	83 c8 07             	or     $0x7,%eax
+  801590:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801596:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  80159b:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  8015a1:	01 ce                	add    %ecx,%esi
+  8015a3:	eb 28                	jmp    8015cd <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8015a5:	83 ec 0c             	sub    $0xc,%esp
+  8015a8:	6a 01                	push   $0x1
+  8015aa:	e8 52 1e 00 00       	call   803401 <ipc_find_env>
+  8015af:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8015b4:	83 c4 10             	add    $0x10,%esp
+  8015b7:	eb cf                	jmp    801588 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  8015b9:	83 c0 01             	add    $0x1,%eax
+  8015bc:	89 fa                	mov    %edi,%edx
+  8015be:	09 da                	or     %ebx,%edx
+  8015c0:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8015c7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8015cd:	39 f3                	cmp    %esi,%ebx
+  8015cf:	72 e8                	jb     8015b9 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  8015d1:	83 f8 41             	cmp    $0x41,%eax
+  8015d4:	77 2f                	ja     801605 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  8015d6:	50                   	push   %eax
+  8015d7:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  8015dd:	50                   	push   %eax
+  8015de:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  8015e4:	ff 35 c8 70 80 00    	push   0x8070c8
+  8015ea:	e8 c4 1d 00 00       	call   8033b3 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  8015ef:	83 c4 0c             	add    $0xc,%esp
+  8015f2:	6a 00                	push   $0x0
+  8015f4:	6a 00                	push   $0x0
+  8015f6:	6a 00                	push   $0x0
+  8015f8:	e8 60 1c 00 00       	call   80325d <ipc_recv>
+}
+  8015fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801600:	5b                   	pop    %ebx
+  801601:	5e                   	pop    %esi
+  801602:	5f                   	pop    %edi
+  801603:	5d                   	pop    %ebp
+  801604:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801605:	68 64 3b 80 00       	push   $0x803b64
+  80160a:	68 80 3b 80 00       	push   $0x803b80
+  80160f:	6a 40                	push   $0x40
+  801611:	68 95 3b 80 00       	push   $0x803b95
+  801616:	e8 e7 18 00 00       	call   802f02 <_panic>
+
+0080161b <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  80161b:	55                   	push   %ebp
+  80161c:	89 e5                	mov    %esp,%ebp
+  80161e:	57                   	push   %edi
+  80161f:	56                   	push   %esi
+  801620:	53                   	push   %ebx
+  801621:	83 ec 1c             	sub    $0x1c,%esp
+  801624:	89 c3                	mov    %eax,%ebx
+  801626:	89 d6                	mov    %edx,%esi
+  801628:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  80162b:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801631:	89 ca                	mov    %ecx,%edx
+  801633:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801636:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  80163d:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801640:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801647:	8b 76 0c             	mov    0xc(%esi),%esi
+  80164a:	89 fb                	mov    %edi,%ebx
+  80164c:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801653:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801656:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  80165d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801660:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801667:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80166a:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801671:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801674:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  80167b:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801680:	39 c8                	cmp    %ecx,%eax
+  801682:	74 0d                	je     801691 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801684:	b8 00 00 00 00       	mov    $0x0,%eax
+  801689:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80168c:	5b                   	pop    %ebx
+  80168d:	5e                   	pop    %esi
+  80168e:	5f                   	pop    %edi
+  80168f:	5d                   	pop    %ebp
+  801690:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801691:	6a 07                	push   $0x7
+  801693:	68 00 60 80 00       	push   $0x806000
+  801698:	6a 0d                	push   $0xd
+  80169a:	ff 35 c8 70 80 00    	push   0x8070c8
+  8016a0:	e8 23 1c 00 00       	call   8032c8 <ipc_send>
+  8016a5:	83 c4 10             	add    $0x10,%esp
+  8016a8:	eb da                	jmp    801684 <fsring_post+0x69>
+
+008016aa <fsipcv>:
+{
+  8016aa:	55                   	push   %ebp
+  8016ab:	89 e5                	mov    %esp,%ebp
+  8016ad:	57                   	push   %edi
+  8016ae:	56                   	push   %esi
+  8016af:	53                   	push   %ebx
+  8016b0:	83 ec 0c             	sub    $0xc,%esp
+  8016b3:	89 c7                	mov    %eax,%edi
+  8016b5:	89 d3                	mov    %edx,%ebx
+  8016b7:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  8016b9:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  8016c0:	74 26                	je     8016e8 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016c2:	6a 07                	push   $0x7
+  8016c4:	68 00 60 80 00       	push   $0x806000
+  8016c9:	57                   	push   %edi
+  8016ca:	ff 35 c8 70 80 00    	push   0x8070c8
+  8016d0:	e8 f3 1b 00 00       	call   8032c8 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  8016d5:	6a 00                	push   $0x0
+  8016d7:	56                   	push   %esi
+  8016d8:	53                   	push   %ebx
+  8016d9:	6a 00                	push   $0x0
+  8016db:	e8 40 1c 00 00       	call   803320 <ipc_recvv>
+}
+  8016e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e3:	5b                   	pop    %ebx
+  8016e4:	5e                   	pop    %esi
+  8016e5:	5f                   	pop    %edi
+  8016e6:	5d                   	pop    %ebp
+  8016e7:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016e8:	83 ec 0c             	sub    $0xc,%esp
+  8016eb:	6a 01                	push   $0x1
+  8016ed:	e8 0f 1d 00 00       	call   803401 <ipc_find_env>
+  8016f2:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8016f7:	83 c4 10             	add    $0x10,%esp
+  8016fa:	eb c6                	jmp    8016c2 <fsipcv+0x18>
+
+008016fc <fsipc>:
+{
+  8016fc:	55                   	push   %ebp
+  8016fd:	89 e5                	mov    %esp,%ebp
+  8016ff:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801702:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801709:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  80170c:	e8 99 ff ff ff       	call   8016aa <fsipcv>
+}
+  801711:	c9                   	leave
+  801712:	c3                   	ret
+
+00801713 <file_write_direct>:
+{
+  801713:	55                   	push   %ebp
+  801714:	89 e5                	mov    %esp,%ebp
+  801716:	56                   	push   %esi
+  801717:	53                   	push   %ebx
+  801718:	89 c3                	mov    %eax,%ebx
+  80171a:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  80171c:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801722:	77 40                	ja     801764 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801724:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801729:	39 c8                	cmp    %ecx,%eax
+  80172b:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80172e:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801731:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  801737:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80173c:	83 ec 04             	sub    $0x4,%esp
+  80173f:	50                   	push   %eax
+  801740:	52                   	push   %edx
+  801741:	68 08 60 80 00       	push   $0x806008
+  801746:	e8 75 f1 ff ff       	call   8008c0 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80174b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801750:	b8 04 00 00 00       	mov    $0x4,%eax
+  801755:	e8 a2 ff ff ff       	call   8016fc <fsipc>
+  80175a:	83 c4 10             	add    $0x10,%esp
+}
+  80175d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801760:	5b                   	pop    %ebx
+  801761:	5e                   	pop    %esi
+  801762:	5d                   	pop    %ebp
+  801763:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801764:	89 d6                	mov    %edx,%esi
+  801766:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80176c:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801771:	29 f1                	sub    %esi,%ecx
+  801773:	39 c1                	cmp    %eax,%ecx
+  801775:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801778:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80177b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801780:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801786:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  80178c:	83 ec 0c             	sub    $0xc,%esp
+  80178f:	6a 05                	push   $0x5
+  801791:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801796:	e8 bf fd ff ff       	call   80155a <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  80179b:	83 c4 10             	add    $0x10,%esp
+  80179e:	eb bd                	jmp    80175d <file_write_direct+0x4a>
+
+008017a0 <devfile_sync>:
+{
+  8017a0:	55                   	push   %ebp
+  8017a1:	89 e5                	mov    %esp,%ebp
+  8017a3:	57                   	push   %edi
+  8017a4:	56                   	push   %esi
+  8017a5:	53                   	push   %ebx
+  8017a6:	83 ec 28             	sub    $0x28,%esp
+  8017a9:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  8017ac:	56                   	push   %esi
+  8017ad:	e8 a5 f7 ff ff       	call   800f57 <fd2data>
+  8017b2:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  8017b4:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  8017b7:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  8017be:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8017c1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  8017c6:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8017ca:	74 45                	je     801811 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  8017cc:	8b 46 14             	mov    0x14(%esi),%eax
+  8017cf:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8017d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017dc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8017df:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  8017e2:	39 cb                	cmp    %ecx,%ebx
+  8017e4:	73 14                	jae    8017fa <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  8017e6:	29 d9                	sub    %ebx,%ecx
+  8017e8:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8017eb:	89 f0                	mov    %esi,%eax
+  8017ed:	e8 21 ff ff ff       	call   801713 <file_write_direct>
+  8017f2:	85 c0                	test   %eax,%eax
+  8017f4:	7e 04                	jle    8017fa <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8017f6:	01 c3                	add    %eax,%ebx
+  8017f8:	eb e5                	jmp    8017df <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  8017fa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8017fd:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801804:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801807:	85 c0                	test   %eax,%eax
+  801809:	ba 00 00 00 00       	mov    $0x0,%edx
+  80180e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801811:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801814:	5b                   	pop    %ebx
+  801815:	5e                   	pop    %esi
+  801816:	5f                   	pop    %edi
+  801817:	5d                   	pop    %ebp
+  801818:	c3                   	ret
+
+00801819 <devfile_write>:
+{
+  801819:	55                   	push   %ebp
+  80181a:	89 e5                	mov    %esp,%ebp
+  80181c:	57                   	push   %edi
+  80181d:	56                   	push   %esi
+  80181e:	53                   	push   %ebx
+  80181f:	83 ec 28             	sub    $0x28,%esp
+  801822:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801825:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801828:	53                   	push   %ebx
+  801829:	e8 29 f7 ff ff       	call   800f57 <fd2data>
+  80182e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801831:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801834:	83 c4 10             	add    $0x10,%esp
+  801837:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  80183b:	74 43                	je     801880 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  80183d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801844:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801847:	85 c0                	test   %eax,%eax
+  801849:	74 43                	je     80188e <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  80184b:	89 c2                	mov    %eax,%edx
+  80184d:	03 53 14             	add    0x14(%ebx),%edx
+  801850:	39 fa                	cmp    %edi,%edx
+  801852:	75 0b                	jne    80185f <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801854:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801857:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  80185d:	76 66                	jbe    8018c5 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  80185f:	83 ec 0c             	sub    $0xc,%esp
+  801862:	53                   	push   %ebx
+  801863:	e8 38 ff ff ff       	call   8017a0 <devfile_sync>
+  801868:	83 c4 10             	add    $0x10,%esp
+  80186b:	85 c0                	test   %eax,%eax
+  80186d:	78 4e                	js     8018bd <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  80186f:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801875:	77 56                	ja     8018cd <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801877:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80187a:	85 c0                	test   %eax,%eax
+  80187c:	75 20                	jne    80189e <devfile_write+0x85>
+  80187e:	eb 16                	jmp    801896 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801880:	89 f1                	mov    %esi,%ecx
+  801882:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801885:	89 d8                	mov    %ebx,%eax
+  801887:	e8 87 fe ff ff       	call   801713 <file_write_direct>
+  80188c:	eb 2f                	jmp    8018bd <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  80188e:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801894:	77 37                	ja     8018cd <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801896:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801899:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  80189e:	83 ec 04             	sub    $0x4,%esp
+  8018a1:	56                   	push   %esi
+  8018a2:	ff 75 0c             	push   0xc(%ebp)
+  8018a5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8018a8:	01 c1                	add    %eax,%ecx
+  8018aa:	51                   	push   %ecx
+  8018ab:	e8 10 f0 ff ff       	call   8008c0 <memmove>
+	ff->buf_wlen += n;
+  8018b0:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  8018b3:	01 f7                	add    %esi,%edi
+  8018b5:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8018b8:	89 f0                	mov    %esi,%eax
+  8018ba:	83 c4 10             	add    $0x10,%esp
+}
+  8018bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018c0:	5b                   	pop    %ebx
+  8018c1:	5e                   	pop    %esi
+  8018c2:	5f                   	pop    %edi
+  8018c3:	5d                   	pop    %ebp
+  8018c4:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  8018c5:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8018cb:	76 d1                	jbe    80189e <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  8018cd:	89 f1                	mov    %esi,%ecx
+  8018cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018d2:	89 d8                	mov    %ebx,%eax
+  8018d4:	e8 3a fe ff ff       	call   801713 <file_write_direct>
+  8018d9:	eb e2                	jmp    8018bd <devfile_write+0xa4>
+
+008018db <devfile_trunc>:
+{
+  8018db:	55                   	push   %ebp
+  8018dc:	89 e5                	mov    %esp,%ebp
+  8018de:	53                   	push   %ebx
+  8018df:	83 ec 10             	sub    $0x10,%esp
+  8018e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  8018e5:	53                   	push   %ebx
+  8018e6:	e8 b5 fe ff ff       	call   8017a0 <devfile_sync>
+  8018eb:	83 c4 10             	add    $0x10,%esp
+  8018ee:	85 c0                	test   %eax,%eax
+  8018f0:	78 1f                	js     801911 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018f2:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8018f5:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8018fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018fd:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801902:	ba 00 00 00 00       	mov    $0x0,%edx
+  801907:	b8 02 00 00 00       	mov    $0x2,%eax
+  80190c:	e8 eb fd ff ff       	call   8016fc <fsipc>
+}
+  801911:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801914:	c9                   	leave
+  801915:	c3                   	ret
+
+00801916 <devfile_stat>:
+{
+  801916:	55                   	push   %ebp
+  801917:	89 e5                	mov    %esp,%ebp
+  801919:	56                   	push   %esi
+  80191a:	53                   	push   %ebx
+  80191b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80191e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801921:	83 ec 0c             	sub    $0xc,%esp
+  801924:	53                   	push   %ebx
+  801925:	e8 76 fe ff ff       	call   8017a0 <devfile_sync>
+  80192a:	83 c4 10             	add    $0x10,%esp
+  80192d:	85 c0                	test   %eax,%eax
+  80192f:	78 47                	js     801978 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801931:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801934:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801939:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801943:	e8 b4 fd ff ff       	call   8016fc <fsipc>
+  801948:	85 c0                	test   %eax,%eax
+  80194a:	78 2c                	js     801978 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80194c:	83 ec 08             	sub    $0x8,%esp
+  80194f:	68 00 60 80 00       	push   $0x806000
+  801954:	56                   	push   %esi
+  801955:	e8 e0 ed ff ff       	call   80073a <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80195a:	a1 80 60 80 00       	mov    0x806080,%eax
+  80195f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801965:	a1 84 60 80 00       	mov    0x806084,%eax
+  80196a:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801970:	83 c4 10             	add    $0x10,%esp
+  801973:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801978:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80197b:	5b                   	pop    %ebx
+  80197c:	5e                   	pop    %esi
+  80197d:	5d                   	pop    %ebp
+  80197e:	c3                   	ret
+
+0080197f <devfile_flush>:
+{
+  80197f:	55                   	push   %ebp
+  801980:	89 e5                	mov    %esp,%ebp
+  801982:	56                   	push   %esi
+  801983:	53                   	push   %ebx
+  801984:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801987:	83 ec 0c             	sub    $0xc,%esp
+  80198a:	56                   	push   %esi
+  80198b:	e8 10 fe ff ff       	call   8017a0 <devfile_sync>
+  801990:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801992:	83 c4 10             	add    $0x10,%esp
+  801995:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801999:	75 25                	jne    8019c0 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80199b:	8b 46 0c             	mov    0xc(%esi),%eax
+  80199e:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  8019a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019ad:	e8 4a fd ff ff       	call   8016fc <fsipc>
+  8019b2:	85 c0                	test   %eax,%eax
+  8019b4:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8019b7:	89 d8                	mov    %ebx,%eax
+  8019b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019bc:	5b                   	pop    %ebx
+  8019bd:	5e                   	pop    %esi
+  8019be:	5d                   	pop    %ebp
+  8019bf:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  8019c0:	83 ec 0c             	sub    $0xc,%esp
+  8019c3:	56                   	push   %esi
+  8019c4:	e8 8e f5 ff ff       	call   800f57 <fd2data>
+  8019c9:	83 c4 08             	add    $0x8,%esp
+  8019cc:	50                   	push   %eax
+  8019cd:	6a 00                	push   $0x0
+  8019cf:	e8 ff f1 ff ff       	call   800bd3 <sys_page_unmap>
+  8019d4:	83 c4 10             	add    $0x10,%esp
+  8019d7:	eb c2                	jmp    80199b <devfile_flush+0x1c>
+
+008019d9 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  8019d9:	55                   	push   %ebp
+  8019da:	89 e5                	mov    %esp,%ebp
+  8019dc:	57                   	push   %edi
+  8019dd:	56                   	push   %esi
+  8019de:	53                   	push   %ebx
+  8019df:	83 ec 64             	sub    $0x64,%esp
+  8019e2:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  8019e4:	52                   	push   %edx
+  8019e5:	50                   	push   %eax
+  8019e6:	e8 d9 f5 ff ff       	call   800fc4 <fd_lookup>
+  8019eb:	89 c1                	mov    %eax,%ecx
+  8019ed:	83 c4 10             	add    $0x10,%esp
+  8019f0:	85 c0                	test   %eax,%eax
+  8019f2:	0f 88 f2 00 00 00    	js     801aea <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  8019f8:	8b 07                	mov    (%edi),%eax
+  8019fa:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801a00:	39 10                	cmp    %edx,(%eax)
+  801a02:	0f 85 03 01 00 00    	jne    801b0b <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801a08:	a1 04 50 80 00       	mov    0x805004,%eax
+  801a0d:	8b 40 48             	mov    0x48(%eax),%eax
+  801a10:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801a16:	0f 84 96 00 00 00    	je     801ab2 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801a1c:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801a23:	0f 84 cb 00 00 00    	je     801af4 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a29:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801a2e:	83 c8 07             	or     $0x7,%eax
+  801a31:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801a34:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a37:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801a3c:	83 ec 04             	sub    $0x4,%esp
+  801a3f:	68 07 04 00 00       	push   $0x407
+  801a44:	53                   	push   %ebx
+  801a45:	6a 00                	push   $0x0
+  801a47:	e8 fa f0 ff ff       	call   800b46 <sys_page_alloc>
+  801a4c:	89 c1                	mov    %eax,%ecx
+  801a4e:	83 c4 10             	add    $0x10,%esp
+  801a51:	85 c0                	test   %eax,%eax
+  801a53:	0f 88 91 00 00 00    	js     801aea <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801a59:	89 d8                	mov    %ebx,%eax
+  801a5b:	83 c8 07             	or     $0x7,%eax
+  801a5e:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801a60:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a66:	83 c6 04             	add    $0x4,%esi
+  801a69:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801a6f:	75 cb                	jne    801a3c <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801a71:	6a 12                	push   $0x12
+  801a73:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801a76:	50                   	push   %eax
+  801a77:	6a 0c                	push   $0xc
+  801a79:	ff 35 c8 70 80 00    	push   0x8070c8
+  801a7f:	e8 2f 19 00 00       	call   8033b3 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a84:	83 c4 0c             	add    $0xc,%esp
+  801a87:	6a 00                	push   $0x0
+  801a89:	6a 00                	push   $0x0
+  801a8b:	6a 00                	push   $0x0
+  801a8d:	e8 cb 17 00 00       	call   80325d <ipc_recv>
+  801a92:	89 c1                	mov    %eax,%ecx
+  801a94:	83 c4 10             	add    $0x10,%esp
+  801a97:	85 c0                	test   %eax,%eax
+  801a99:	78 4f                	js     801aea <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801a9b:	a1 04 50 80 00       	mov    0x805004,%eax
+  801aa0:	8b 40 48             	mov    0x48(%eax),%eax
+  801aa3:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801aa8:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801aaf:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801ab2:	83 ec 0c             	sub    $0xc,%esp
+  801ab5:	ff 37                	push   (%edi)
+  801ab7:	e8 e4 fc ff ff       	call   8017a0 <devfile_sync>
+  801abc:	89 c1                	mov    %eax,%ecx
+  801abe:	83 c4 10             	add    $0x10,%esp
+  801ac1:	85 c0                	test   %eax,%eax
+  801ac3:	78 25                	js     801aea <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801ac5:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801acb:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801ad0:	ba 01 00 00 00       	mov    $0x1,%edx
+  801ad5:	89 d0                	mov    %edx,%eax
+  801ad7:	d3 e0                	shl    %cl,%eax
+  801ad9:	85 d8                	test   %ebx,%eax
+  801adb:	74 0d                	je     801aea <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801add:	83 c1 01             	add    $0x1,%ecx
+  801ae0:	83 f9 10             	cmp    $0x10,%ecx
+  801ae3:	75 f0                	jne    801ad5 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801ae5:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801aea:	89 c8                	mov    %ecx,%eax
+  801aec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aef:	5b                   	pop    %ebx
+  801af0:	5e                   	pop    %esi
+  801af1:	5f                   	pop    %edi
+  801af2:	5d                   	pop    %ebp
+  801af3:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801af4:	83 ec 0c             	sub    $0xc,%esp
+  801af7:	6a 01                	push   $0x1
+  801af9:	e8 03 19 00 00       	call   803401 <ipc_find_env>
+  801afe:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801b03:	83 c4 10             	add    $0x10,%esp
+  801b06:	e9 1e ff ff ff       	jmp    801a29 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801b0b:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801b10:	eb d8                	jmp    801aea <fsring_slot+0x111>
+
+00801b12 <file_read_direct>:
+{
+  801b12:	55                   	push   %ebp
+  801b13:	89 e5                	mov    %esp,%ebp
+  801b15:	57                   	push   %edi
+  801b16:	56                   	push   %esi
+  801b17:	53                   	push   %ebx
+  801b18:	83 ec 1c             	sub    $0x1c,%esp
+  801b1b:	89 c7                	mov    %eax,%edi
+  801b1d:	89 d6                	mov    %edx,%esi
+  801b1f:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801b21:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801b27:	77 52                	ja     801b7b <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b29:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b2c:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801b31:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b37:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b41:	e8 b6 fb ff ff       	call   8016fc <fsipc>
+  801b46:	89 c7                	mov    %eax,%edi
+  801b48:	85 c0                	test   %eax,%eax
+  801b4a:	78 25                	js     801b71 <file_read_direct+0x5f>
+	assert(r <= n);
+  801b4c:	39 c3                	cmp    %eax,%ebx
+  801b4e:	0f 82 87 00 00 00    	jb     801bdb <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801b54:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b59:	0f 8f 95 00 00 00    	jg     801bf4 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b5f:	83 ec 04             	sub    $0x4,%esp
+  801b62:	50                   	push   %eax
+  801b63:	68 00 60 80 00       	push   $0x806000
+  801b68:	56                   	push   %esi
+  801b69:	e8 52 ed ff ff       	call   8008c0 <memmove>
+	return r;
+  801b6e:	83 c4 10             	add    $0x10,%esp
+}
+  801b71:	89 f8                	mov    %edi,%eax
+  801b73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b76:	5b                   	pop    %ebx
+  801b77:	5e                   	pop    %esi
+  801b78:	5f                   	pop    %edi
+  801b79:	5d                   	pop    %ebp
+  801b7a:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801b7b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801b81:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b86:	29 d1                	sub    %edx,%ecx
+  801b88:	39 d9                	cmp    %ebx,%ecx
+  801b8a:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801b8d:	89 f0                	mov    %esi,%eax
+  801b8f:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801b92:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b95:	eb 0f                	jmp    801ba6 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801b97:	0f b6 10             	movzbl (%eax),%edx
+  801b9a:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801b9c:	05 00 10 00 00       	add    $0x1000,%eax
+  801ba1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ba6:	39 c8                	cmp    %ecx,%eax
+  801ba8:	72 ed                	jb     801b97 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801baa:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801bad:	8b 47 0c             	mov    0xc(%edi),%eax
+  801bb0:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801bb5:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801bbb:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801bc1:	83 ec 0c             	sub    $0xc,%esp
+  801bc4:	6a 07                	push   $0x7
+  801bc6:	89 d9                	mov    %ebx,%ecx
+  801bc8:	89 f2                	mov    %esi,%edx
+  801bca:	b8 09 00 00 00       	mov    $0x9,%eax
+  801bcf:	e8 86 f9 ff ff       	call   80155a <fsipc_pages>
+  801bd4:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801bd6:	83 c4 10             	add    $0x10,%esp
+  801bd9:	eb 96                	jmp    801b71 <file_read_direct+0x5f>
+	assert(r <= n);
+  801bdb:	68 a0 3b 80 00       	push   $0x803ba0
+  801be0:	68 80 3b 80 00       	push   $0x803b80
+  801be5:	68 dc 00 00 00       	push   $0xdc
+  801bea:	68 95 3b 80 00       	push   $0x803b95
+  801bef:	e8 0e 13 00 00       	call   802f02 <_panic>
+	assert(r <= PGSIZE);
+  801bf4:	68 b1 3b 80 00       	push   $0x803bb1
+  801bf9:	68 80 3b 80 00       	push   $0x803b80
+  801bfe:	68 dd 00 00 00       	push   $0xdd
+  801c03:	68 95 3b 80 00       	push   $0x803b95
+  801c08:	e8 f5 12 00 00       	call   802f02 <_panic>
+
+00801c0d <devfile_read>:
+{
+  801c0d:	55                   	push   %ebp
+  801c0e:	89 e5                	mov    %esp,%ebp
+  801c10:	57                   	push   %edi
+  801c11:	56                   	push   %esi
+  801c12:	53                   	push   %ebx
+  801c13:	83 ec 28             	sub    $0x28,%esp
+  801c16:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c19:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801c1c:	53                   	push   %ebx
+  801c1d:	e8 35 f3 ff ff       	call   800f57 <fd2data>
+  801c22:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801c25:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801c28:	83 c4 10             	add    $0x10,%esp
+  801c2b:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801c2f:	74 7d                	je     801cae <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801c31:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801c35:	0f 85 81 00 00 00    	jne    801cbc <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801c3b:	8b 43 18             	mov    0x18(%ebx),%eax
+  801c3e:	85 c0                	test   %eax,%eax
+  801c40:	74 0d                	je     801c4f <devfile_read+0x42>
+  801c42:	8b 53 14             	mov    0x14(%ebx),%edx
+  801c45:	39 fa                	cmp    %edi,%edx
+  801c47:	7f 06                	jg     801c4f <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801c49:	01 c2                	add    %eax,%edx
+  801c4b:	39 d7                	cmp    %edx,%edi
+  801c4d:	72 28                	jb     801c77 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801c4f:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801c56:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801c5c:	77 74                	ja     801cd2 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801c5e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801c63:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c66:	89 d8                	mov    %ebx,%eax
+  801c68:	e8 a5 fe ff ff       	call   801b12 <file_read_direct>
+  801c6d:	85 c0                	test   %eax,%eax
+  801c6f:	7e 35                	jle    801ca6 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801c71:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801c74:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801c77:	8b 53 14             	mov    0x14(%ebx),%edx
+  801c7a:	89 d0                	mov    %edx,%eax
+  801c7c:	03 43 18             	add    0x18(%ebx),%eax
+  801c7f:	29 f8                	sub    %edi,%eax
+  801c81:	39 f0                	cmp    %esi,%eax
+  801c83:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801c86:	83 ec 04             	sub    $0x4,%esp
+  801c89:	56                   	push   %esi
+  801c8a:	89 f8                	mov    %edi,%eax
+  801c8c:	29 d0                	sub    %edx,%eax
+  801c8e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801c91:	01 c1                	add    %eax,%ecx
+  801c93:	51                   	push   %ecx
+  801c94:	ff 75 0c             	push   0xc(%ebp)
+  801c97:	e8 24 ec ff ff       	call   8008c0 <memmove>
+	fd->fd_offset = pos + n;
+  801c9c:	01 f7                	add    %esi,%edi
+  801c9e:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801ca1:	89 f0                	mov    %esi,%eax
+  801ca3:	83 c4 10             	add    $0x10,%esp
+}
+  801ca6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ca9:	5b                   	pop    %ebx
+  801caa:	5e                   	pop    %esi
+  801cab:	5f                   	pop    %edi
+  801cac:	5d                   	pop    %ebp
+  801cad:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801cae:	89 f1                	mov    %esi,%ecx
+  801cb0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cb3:	89 d8                	mov    %ebx,%eax
+  801cb5:	e8 58 fe ff ff       	call   801b12 <file_read_direct>
+  801cba:	eb ea                	jmp    801ca6 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801cbc:	83 ec 0c             	sub    $0xc,%esp
+  801cbf:	53                   	push   %ebx
+  801cc0:	e8 db fa ff ff       	call   8017a0 <devfile_sync>
+  801cc5:	83 c4 10             	add    $0x10,%esp
+  801cc8:	85 c0                	test   %eax,%eax
+  801cca:	0f 89 6b ff ff ff    	jns    801c3b <devfile_read+0x2e>
+  801cd0:	eb d4                	jmp    801ca6 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801cd2:	89 f1                	mov    %esi,%ecx
+  801cd4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cd7:	89 d8                	mov    %ebx,%eax
+  801cd9:	e8 34 fe ff ff       	call   801b12 <file_read_direct>
+  801cde:	eb c6                	jmp    801ca6 <devfile_read+0x99>
+
+00801ce0 <open>:
+{
+  801ce0:	55                   	push   %ebp
+  801ce1:	89 e5                	mov    %esp,%ebp
+  801ce3:	56                   	push   %esi
+  801ce4:	53                   	push   %ebx
+  801ce5:	83 ec 1c             	sub    $0x1c,%esp
+  801ce8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ceb:	56                   	push   %esi
+  801cec:	e8 0e ea ff ff       	call   8006ff <strlen>
+  801cf1:	83 c4 10             	add    $0x10,%esp
+  801cf4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cf9:	0f 8f a0 00 00 00    	jg     801d9f <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801cff:	83 ec 0c             	sub    $0xc,%esp
+  801d02:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d05:	50                   	push   %eax
+  801d06:	e8 63 f2 ff ff       	call   800f6e <fd_alloc>
+  801d0b:	89 c3                	mov    %eax,%ebx
+  801d0d:	83 c4 10             	add    $0x10,%esp
+  801d10:	85 c0                	test   %eax,%eax
+  801d12:	78 45                	js     801d59 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801d14:	83 ec 08             	sub    $0x8,%esp
+  801d17:	56                   	push   %esi
+  801d18:	68 00 60 80 00       	push   $0x806000
+  801d1d:	e8 18 ea ff ff       	call   80073a <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d22:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d25:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d2a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d2d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d32:	e8 c5 f9 ff ff       	call   8016fc <fsipc>
+  801d37:	89 c3                	mov    %eax,%ebx
+  801d39:	83 c4 10             	add    $0x10,%esp
+  801d3c:	85 c0                	test   %eax,%eax
+  801d3e:	78 22                	js     801d62 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801d40:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801d47:	74 2b                	je     801d74 <open+0x94>
+	return fd2num(fd);
+  801d49:	83 ec 0c             	sub    $0xc,%esp
+  801d4c:	ff 75 f4             	push   -0xc(%ebp)
+  801d4f:	e8 f3 f1 ff ff       	call   800f47 <fd2num>
+  801d54:	89 c3                	mov    %eax,%ebx
+  801d56:	83 c4 10             	add    $0x10,%esp
+}
+  801d59:	89 d8                	mov    %ebx,%eax
+  801d5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d5e:	5b                   	pop    %ebx
+  801d5f:	5e                   	pop    %esi
+  801d60:	5d                   	pop    %ebp
+  801d61:	c3                   	ret
+		fd_close(fd, 0);
+  801d62:	83 ec 08             	sub    $0x8,%esp
+  801d65:	6a 00                	push   $0x0
+  801d67:	ff 75 f4             	push   -0xc(%ebp)
+  801d6a:	e8 f8 f2 ff ff       	call   801067 <fd_close>
+		return r;
+  801d6f:	83 c4 10             	add    $0x10,%esp
+  801d72:	eb e5                	jmp    801d59 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801d74:	83 ec 0c             	sub    $0xc,%esp
+  801d77:	ff 75 f4             	push   -0xc(%ebp)
+  801d7a:	e8 d8 f1 ff ff       	call   800f57 <fd2data>
+  801d7f:	83 c4 0c             	add    $0xc,%esp
+  801d82:	68 07 04 00 00       	push   $0x407
+  801d87:	50                   	push   %eax
+  801d88:	6a 00                	push   $0x0
+  801d8a:	e8 b7 ed ff ff       	call   800b46 <sys_page_alloc>
+  801d8f:	83 c4 10             	add    $0x10,%esp
+  801d92:	85 c0                	test   %eax,%eax
+  801d94:	75 b3                	jne    801d49 <open+0x69>
+		fd->fd_file.buffered = 1;
+  801d96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d99:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801d9d:	eb aa                	jmp    801d49 <open+0x69>
+		return -E_BAD_PATH;
+  801d9f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801da4:	eb b3                	jmp    801d59 <open+0x79>
+
+00801da6 <readdir>:
+{
+  801da6:	55                   	push   %ebp
+  801da7:	89 e5                	mov    %esp,%ebp
+  801da9:	53                   	push   %ebx
+  801daa:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801dad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801db0:	50                   	push   %eax
+  801db1:	ff 75 08             	push   0x8(%ebp)
+  801db4:	e8 0b f2 ff ff       	call   800fc4 <fd_lookup>
+  801db9:	89 c3                	mov    %eax,%ebx
+  801dbb:	83 c4 10             	add    $0x10,%esp
+  801dbe:	85 c0                	test   %eax,%eax
+  801dc0:	78 73                	js     801e35 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801dc2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc5:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801dcb:	39 08                	cmp    %ecx,(%eax)
+  801dcd:	0f 85 82 00 00 00    	jne    801e55 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801dd3:	83 ec 0c             	sub    $0xc,%esp
+  801dd6:	50                   	push   %eax
+  801dd7:	e8 c4 f9 ff ff       	call   8017a0 <devfile_sync>
+  801ddc:	89 c3                	mov    %eax,%ebx
+  801dde:	83 c4 10             	add    $0x10,%esp
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	78 50                	js     801e35 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801de5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801de8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801deb:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801df0:	8b 45 10             	mov    0x10(%ebp),%eax
+  801df3:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801df8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dfb:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801e00:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e05:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e0a:	e8 ed f8 ff ff       	call   8016fc <fsipc>
+  801e0f:	89 c3                	mov    %eax,%ebx
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	7e 20                	jle    801e35 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801e15:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801e18:	72 22                	jb     801e3c <readdir+0x96>
+  801e1a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e1f:	7f 1b                	jg     801e3c <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e21:	83 ec 04             	sub    $0x4,%esp
+  801e24:	50                   	push   %eax
+  801e25:	68 00 60 80 00       	push   $0x806000
+  801e2a:	ff 75 0c             	push   0xc(%ebp)
+  801e2d:	e8 8e ea ff ff       	call   8008c0 <memmove>
+	return r;
+  801e32:	83 c4 10             	add    $0x10,%esp
+}
+  801e35:	89 d8                	mov    %ebx,%eax
+  801e37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e3a:	c9                   	leave
+  801e3b:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801e3c:	68 a7 3b 80 00       	push   $0x803ba7
+  801e41:	68 80 3b 80 00       	push   $0x803b80
+  801e46:	68 86 01 00 00       	push   $0x186
+  801e4b:	68 95 3b 80 00       	push   $0x803b95
+  801e50:	e8 ad 10 00 00       	call   802f02 <_panic>
+		return -E_NOT_SUPP;
+  801e55:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801e5a:	eb d9                	jmp    801e35 <readdir+0x8f>
+
+00801e5c <munmap>:
+{
+  801e5c:	55                   	push   %ebp
+  801e5d:	89 e5                	mov    %esp,%ebp
+  801e5f:	56                   	push   %esi
+  801e60:	53                   	push   %ebx
+  801e61:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e64:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801e67:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801e6d:	75 41                	jne    801eb0 <munmap+0x54>
+  801e6f:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801e75:	77 39                	ja     801eb0 <munmap+0x54>
+  801e77:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801e7c:	29 f0                	sub    %esi,%eax
+  801e7e:	39 d0                	cmp    %edx,%eax
+  801e80:	72 35                	jb     801eb7 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801e82:	89 f3                	mov    %esi,%ebx
+  801e84:	01 d6                	add    %edx,%esi
+  801e86:	39 f3                	cmp    %esi,%ebx
+  801e88:	73 1a                	jae    801ea4 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801e8a:	83 ec 08             	sub    $0x8,%esp
+  801e8d:	53                   	push   %ebx
+  801e8e:	6a 00                	push   $0x0
+  801e90:	e8 3e ed ff ff       	call   800bd3 <sys_page_unmap>
+  801e95:	83 c4 10             	add    $0x10,%esp
+  801e98:	85 c0                	test   %eax,%eax
+  801e9a:	78 0d                	js     801ea9 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801e9c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ea2:	eb e2                	jmp    801e86 <munmap+0x2a>
+	return 0;
+  801ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ea9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eac:	5b                   	pop    %ebx
+  801ead:	5e                   	pop    %esi
+  801eae:	5d                   	pop    %ebp
+  801eaf:	c3                   	ret
+		return -E_INVAL;
+  801eb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eb5:	eb f2                	jmp    801ea9 <munmap+0x4d>
+  801eb7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ebc:	eb eb                	jmp    801ea9 <munmap+0x4d>
+
+00801ebe <mmap>:
+{
+  801ebe:	55                   	push   %ebp
+  801ebf:	89 e5                	mov    %esp,%ebp
+  801ec1:	57                   	push   %edi
+  801ec2:	56                   	push   %esi
+  801ec3:	53                   	push   %ebx
+  801ec4:	83 ec 34             	sub    $0x34,%esp
+  801ec7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801eca:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ecd:	50                   	push   %eax
+  801ece:	ff 75 18             	push   0x18(%ebp)
+  801ed1:	e8 ee f0 ff ff       	call   800fc4 <fd_lookup>
+  801ed6:	89 c3                	mov    %eax,%ebx
+  801ed8:	83 c4 10             	add    $0x10,%esp
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	0f 88 0e 01 00 00    	js     801ff1 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801ee3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ee6:	a1 20 40 80 00       	mov    0x804020,%eax
+  801eeb:	39 02                	cmp    %eax,(%edx)
+  801eed:	0f 85 50 01 00 00    	jne    802043 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801ef3:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ef6:	83 e0 02             	and    $0x2,%eax
+  801ef9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801efc:	74 0a                	je     801f08 <mmap+0x4a>
+  801efe:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801f02:	0f 84 42 01 00 00    	je     80204a <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801f08:	8b 42 08             	mov    0x8(%edx),%eax
+  801f0b:	83 e0 03             	and    $0x3,%eax
+  801f0e:	83 f8 01             	cmp    $0x1,%eax
+  801f11:	0f 84 3a 01 00 00    	je     802051 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  801f17:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1a:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801f1d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f22:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801f25:	0f 85 2d 01 00 00    	jne    802058 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801f2b:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801f2f:	0f 88 2a 01 00 00    	js     80205f <mmap+0x1a1>
+  801f35:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  801f3c:	0f 87 1d 01 00 00    	ja     80205f <mmap+0x1a1>
+  801f42:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f47:	2b 45 08             	sub    0x8(%ebp),%eax
+  801f4a:	39 f8                	cmp    %edi,%eax
+  801f4c:	0f 82 14 01 00 00    	jb     802066 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  801f52:	83 ec 0c             	sub    $0xc,%esp
+  801f55:	52                   	push   %edx
+  801f56:	e8 45 f8 ff ff       	call   8017a0 <devfile_sync>
+  801f5b:	89 c3                	mov    %eax,%ebx
+  801f5d:	83 c4 10             	add    $0x10,%esp
+  801f60:	85 c0                	test   %eax,%eax
+  801f62:	0f 88 89 00 00 00    	js     801ff1 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  801f68:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  801f6e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801f74:	be 00 00 00 00       	mov    $0x0,%esi
+  801f79:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  801f7c:	39 fe                	cmp    %edi,%esi
+  801f7e:	73 7b                	jae    801ffb <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  801f80:	89 f8                	mov    %edi,%eax
+  801f82:	29 f0                	sub    %esi,%eax
+  801f84:	c1 e8 0c             	shr    $0xc,%eax
+  801f87:	ba 40 00 00 00       	mov    $0x40,%edx
+  801f8c:	39 d0                	cmp    %edx,%eax
+  801f8e:	0f 47 c2             	cmova  %edx,%eax
+  801f91:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801f94:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f97:	8b 52 0c             	mov    0xc(%edx),%edx
+  801f9a:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  801fa0:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  801fa3:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  801fa9:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  801fae:	89 f2                	mov    %esi,%edx
+  801fb0:	03 55 08             	add    0x8(%ebp),%edx
+  801fb3:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  801fb6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801fbb:	e8 ea f6 ff ff       	call   8016aa <fsipcv>
+  801fc0:	85 c0                	test   %eax,%eax
+  801fc2:	7e 12                	jle    801fd6 <mmap+0x118>
+  801fc4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801fc7:	85 c0                	test   %eax,%eax
+  801fc9:	0f 84 9e 00 00 00    	je     80206d <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801fcf:	c1 e0 0c             	shl    $0xc,%eax
+  801fd2:	01 c6                	add    %eax,%esi
+  801fd4:	eb a6                	jmp    801f7c <mmap+0xbe>
+			munmap(addr, done);
+  801fd6:	89 c3                	mov    %eax,%ebx
+  801fd8:	83 ec 08             	sub    $0x8,%esp
+  801fdb:	56                   	push   %esi
+  801fdc:	ff 75 08             	push   0x8(%ebp)
+  801fdf:	e8 78 fe ff ff       	call   801e5c <munmap>
+			return r < 0 ? r : -E_INVAL;
+  801fe4:	83 c4 10             	add    $0x10,%esp
+  801fe7:	85 db                	test   %ebx,%ebx
+  801fe9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fee:	0f 49 d8             	cmovns %eax,%ebx
+}
+  801ff1:	89 d8                	mov    %ebx,%eax
+  801ff3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff6:	5b                   	pop    %ebx
+  801ff7:	5e                   	pop    %esi
+  801ff8:	5f                   	pop    %edi
+  801ff9:	5d                   	pop    %ebp
+  801ffa:	c3                   	ret
+	if (prot & PROT_WRITE)
+  801ffb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  801ffe:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802000:	85 c0                	test   %eax,%eax
+  802002:	74 ed                	je     801ff1 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802004:	be 00 00 00 00       	mov    $0x0,%esi
+  802009:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80200c:	39 fe                	cmp    %edi,%esi
+  80200e:	73 2e                	jae    80203e <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802010:	83 ec 0c             	sub    $0xc,%esp
+  802013:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802016:	50                   	push   %eax
+  802017:	e8 43 10 00 00       	call   80305f <cowpage>
+  80201c:	83 c4 10             	add    $0x10,%esp
+  80201f:	85 c0                	test   %eax,%eax
+  802021:	78 08                	js     80202b <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802023:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802029:	eb e1                	jmp    80200c <mmap+0x14e>
+				munmap(addr, len);
+  80202b:	89 c3                	mov    %eax,%ebx
+  80202d:	83 ec 08             	sub    $0x8,%esp
+  802030:	57                   	push   %edi
+  802031:	ff 75 08             	push   0x8(%ebp)
+  802034:	e8 23 fe ff ff       	call   801e5c <munmap>
+				return r;
+  802039:	83 c4 10             	add    $0x10,%esp
+  80203c:	eb b3                	jmp    801ff1 <mmap+0x133>
+	return 0;
+  80203e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802041:	eb ae                	jmp    801ff1 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802043:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802048:	eb a7                	jmp    801ff1 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80204a:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80204f:	eb a0                	jmp    801ff1 <mmap+0x133>
+		return -E_INVAL;
+  802051:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802056:	eb 99                	jmp    801ff1 <mmap+0x133>
+  802058:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80205d:	eb 92                	jmp    801ff1 <mmap+0x133>
+  80205f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802064:	eb 8b                	jmp    801ff1 <mmap+0x133>
+  802066:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80206b:	eb 84                	jmp    801ff1 <mmap+0x133>
+			munmap(addr, done);
+  80206d:	83 ec 08             	sub    $0x8,%esp
+  802070:	56                   	push   %esi
+  802071:	ff 75 08             	push   0x8(%ebp)
+  802074:	e8 e3 fd ff ff       	call   801e5c <munmap>
+  802079:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  80207c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802081:	e9 6b ff ff ff       	jmp    801ff1 <mmap+0x133>
+
+00802086 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802086:	55                   	push   %ebp
+  802087:	89 e5                	mov    %esp,%ebp
+  802089:	56                   	push   %esi
+  80208a:	53                   	push   %ebx
+  80208b:	83 ec 10             	sub    $0x10,%esp
+  80208e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802091:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802094:	8b 45 08             	mov    0x8(%ebp),%eax
+  802097:	e8 3d f9 ff ff       	call   8019d9 <fsring_slot>
+  80209c:	85 c0                	test   %eax,%eax
+  80209e:	78 60                	js     802100 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8020a0:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8020a3:	8b 56 08             	mov    0x8(%esi),%edx
+  8020a6:	83 e2 03             	and    $0x3,%edx
+  8020a9:	83 fa 01             	cmp    $0x1,%edx
+  8020ac:	74 59                	je     802107 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8020ae:	ba 01 00 00 00       	mov    $0x1,%edx
+  8020b3:	89 c1                	mov    %eax,%ecx
+  8020b5:	d3 e2                	shl    %cl,%edx
+  8020b7:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8020bd:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8020c0:	c1 e2 02             	shl    $0x2,%edx
+  8020c3:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8020c9:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  8020d0:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8020d3:	8b 55 18             	mov    0x18(%ebp),%edx
+  8020d6:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8020d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020dc:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8020df:	83 ec 08             	sub    $0x8,%esp
+  8020e2:	50                   	push   %eax
+  8020e3:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8020e8:	39 c3                	cmp    %eax,%ebx
+  8020ea:	0f 47 d8             	cmova  %eax,%ebx
+  8020ed:	53                   	push   %ebx
+  8020ee:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8020f1:	89 f2                	mov    %esi,%edx
+  8020f3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020f8:	e8 1e f5 ff ff       	call   80161b <fsring_post>
+  8020fd:	83 c4 10             	add    $0x10,%esp
+}
+  802100:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802103:	5b                   	pop    %ebx
+  802104:	5e                   	pop    %esi
+  802105:	5d                   	pop    %ebp
+  802106:	c3                   	ret
+		return -E_INVAL;
+  802107:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80210c:	eb f2                	jmp    802100 <fsring_read+0x7a>
+
+0080210e <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80210e:	55                   	push   %ebp
+  80210f:	89 e5                	mov    %esp,%ebp
+  802111:	56                   	push   %esi
+  802112:	53                   	push   %ebx
+  802113:	83 ec 10             	sub    $0x10,%esp
+  802116:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802119:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80211c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80211f:	e8 b5 f8 ff ff       	call   8019d9 <fsring_slot>
+  802124:	89 c3                	mov    %eax,%ebx
+  802126:	85 c0                	test   %eax,%eax
+  802128:	78 77                	js     8021a1 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80212a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80212d:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802131:	74 77                	je     8021aa <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802133:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802138:	39 c6                	cmp    %eax,%esi
+  80213a:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80213d:	83 ec 04             	sub    $0x4,%esp
+  802140:	56                   	push   %esi
+  802141:	ff 75 0c             	push   0xc(%ebp)
+  802144:	89 d8                	mov    %ebx,%eax
+  802146:	c1 e0 0c             	shl    $0xc,%eax
+  802149:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80214f:	50                   	push   %eax
+  802150:	e8 6b e7 ff ff       	call   8008c0 <memmove>
+	fsring_busy |= 1 << slot;
+  802155:	b8 01 00 00 00       	mov    $0x1,%eax
+  80215a:	89 d9                	mov    %ebx,%ecx
+  80215c:	d3 e0                	shl    %cl,%eax
+  80215e:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802164:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802167:	c1 e0 02             	shl    $0x2,%eax
+  80216a:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  802170:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  802177:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80217a:	8b 45 18             	mov    0x18(%ebp),%eax
+  80217d:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  802180:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802187:	83 c4 08             	add    $0x8,%esp
+  80218a:	53                   	push   %ebx
+  80218b:	56                   	push   %esi
+  80218c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80218f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802192:	b8 04 00 00 00       	mov    $0x4,%eax
+  802197:	e8 7f f4 ff ff       	call   80161b <fsring_post>
+  80219c:	89 c3                	mov    %eax,%ebx
+  80219e:	83 c4 10             	add    $0x10,%esp
+}
+  8021a1:	89 d8                	mov    %ebx,%eax
+  8021a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021a6:	5b                   	pop    %ebx
+  8021a7:	5e                   	pop    %esi
+  8021a8:	5d                   	pop    %ebp
+  8021a9:	c3                   	ret
+		return -E_INVAL;
+  8021aa:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021af:	eb f0                	jmp    8021a1 <fsring_write+0x93>
+
+008021b1 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8021b1:	55                   	push   %ebp
+  8021b2:	89 e5                	mov    %esp,%ebp
+  8021b4:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8021b7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021bd:	e8 17 f8 ff ff       	call   8019d9 <fsring_slot>
+  8021c2:	85 c0                	test   %eax,%eax
+  8021c4:	78 4c                	js     802212 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8021c6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8021cb:	89 c1                	mov    %eax,%ecx
+  8021cd:	d3 e2                	shl    %cl,%edx
+  8021cf:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8021d5:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8021d8:	c1 e2 02             	shl    $0x2,%edx
+  8021db:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8021e1:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  8021e8:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8021eb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021ee:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8021f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021f4:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  8021f7:	83 ec 08             	sub    $0x8,%esp
+  8021fa:	50                   	push   %eax
+  8021fb:	6a 00                	push   $0x0
+  8021fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802202:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802205:	b8 05 00 00 00       	mov    $0x5,%eax
+  80220a:	e8 0c f4 ff ff       	call   80161b <fsring_post>
+  80220f:	83 c4 10             	add    $0x10,%esp
+}
+  802212:	c9                   	leave
+  802213:	c3                   	ret
+
+00802214 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802214:	55                   	push   %ebp
+  802215:	89 e5                	mov    %esp,%ebp
+  802217:	57                   	push   %edi
+  802218:	56                   	push   %esi
+  802219:	53                   	push   %ebx
+  80221a:	83 ec 1c             	sub    $0x1c,%esp
+  80221d:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802221:	a1 04 50 80 00       	mov    0x805004,%eax
+  802226:	8b 40 48             	mov    0x48(%eax),%eax
+  802229:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  80222f:	74 12                	je     802243 <fsring_reap+0x2f>
+		return 0;
+  802231:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802236:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802239:	5b                   	pop    %ebx
+  80223a:	5e                   	pop    %esi
+  80223b:	5f                   	pop    %edi
+  80223c:	5d                   	pop    %ebp
+  80223d:	c3                   	ret
+		sys_yield();
+  80223e:	e8 e4 e8 ff ff       	call   800b27 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802243:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802249:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80224e:	39 c2                	cmp    %eax,%edx
+  802250:	75 18                	jne    80226a <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802252:	84 db                	test   %bl,%bl
+  802254:	0f 84 21 01 00 00    	je     80237b <fsring_reap+0x167>
+  80225a:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  802261:	75 db                	jne    80223e <fsring_reap+0x2a>
+			return 0;
+  802263:	b8 00 00 00 00       	mov    $0x0,%eax
+  802268:	eb cc                	jmp    802236 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  80226a:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80226f:	83 e0 0f             	and    $0xf,%eax
+  802272:	83 c0 2a             	add    $0x2a,%eax
+  802275:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  80227c:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802283:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802288:	83 c0 01             	add    $0x1,%eax
+  80228b:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802290:	83 fb 0f             	cmp    $0xf,%ebx
+  802293:	77 5b                	ja     8022f0 <fsring_reap+0xdc>
+  802295:	be 01 00 00 00       	mov    $0x1,%esi
+  80229a:	89 d9                	mov    %ebx,%ecx
+  80229c:	d3 e6                	shl    %cl,%esi
+  80229e:	89 f0                	mov    %esi,%eax
+  8022a0:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8022a6:	74 48                	je     8022f0 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8022a8:	89 d8                	mov    %ebx,%eax
+  8022aa:	c1 e0 0c             	shl    $0xc,%eax
+  8022ad:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8022b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8022b6:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8022b9:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  8022c0:	83 f8 03             	cmp    $0x3,%eax
+  8022c3:	74 40                	je     802305 <fsring_reap+0xf1>
+  8022c5:	83 f8 05             	cmp    $0x5,%eax
+  8022c8:	74 64                	je     80232e <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8022ca:	f7 d6                	not    %esi
+  8022cc:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8022d2:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8022d5:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  8022dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022df:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8022e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022e4:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8022e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022eb:	e9 46 ff ff ff       	jmp    802236 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8022f0:	53                   	push   %ebx
+  8022f1:	68 bd 3b 80 00       	push   $0x803bbd
+  8022f6:	68 8f 02 00 00       	push   $0x28f
+  8022fb:	68 95 3b 80 00       	push   $0x803b95
+  802300:	e8 fd 0b 00 00       	call   802f02 <_panic>
+		if (cqe.cqe_result > 0)
+  802305:	85 ff                	test   %edi,%edi
+  802307:	7e c1                	jle    8022ca <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802309:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80230c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802311:	39 c7                	cmp    %eax,%edi
+  802313:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802316:	50                   	push   %eax
+  802317:	ff 75 e4             	push   -0x1c(%ebp)
+  80231a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80231d:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  802324:	e8 97 e5 ff ff       	call   8008c0 <memmove>
+  802329:	83 c4 10             	add    $0x10,%esp
+  80232c:	eb 9c                	jmp    8022ca <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80232e:	85 ff                	test   %edi,%edi
+  802330:	75 98                	jne    8022ca <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802332:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802335:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80233c:	83 ec 08             	sub    $0x8,%esp
+  80233f:	ff 75 e4             	push   -0x1c(%ebp)
+  802342:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802345:	51                   	push   %ecx
+  802346:	e8 ef e3 ff ff       	call   80073a <strcpy>
+			st->st_size = ret->ret_size;
+  80234b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80234e:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802354:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802357:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80235d:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802363:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802369:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  802370:	40 80 00 
+  802373:	83 c4 10             	add    $0x10,%esp
+  802376:	e9 4f ff ff ff       	jmp    8022ca <fsring_reap+0xb6>
+			return 0;
+  80237b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802380:	e9 b1 fe ff ff       	jmp    802236 <fsring_reap+0x22>
+
+00802385 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802385:	55                   	push   %ebp
+  802386:	89 e5                	mov    %esp,%ebp
+  802388:	57                   	push   %edi
+  802389:	56                   	push   %esi
+  80238a:	53                   	push   %ebx
+  80238b:	83 ec 28             	sub    $0x28,%esp
+  80238e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802391:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802394:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802397:	53                   	push   %ebx
+  802398:	e8 62 e3 ff ff       	call   8006ff <strlen>
+  80239d:	83 c4 10             	add    $0x10,%esp
+  8023a0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8023a5:	0f 8f 02 01 00 00    	jg     8024ad <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8023ab:	83 ec 08             	sub    $0x8,%esp
+  8023ae:	53                   	push   %ebx
+  8023af:	68 00 60 80 00       	push   $0x806000
+  8023b4:	e8 81 e3 ff ff       	call   80073a <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8023b9:	83 c4 10             	add    $0x10,%esp
+  8023bc:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8023c2:	76 69                	jbe    80242d <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8023c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023c7:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8023cd:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8023d2:	29 d1                	sub    %edx,%ecx
+  8023d4:	39 f9                	cmp    %edi,%ecx
+  8023d6:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8023d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023dc:	89 f9                	mov    %edi,%ecx
+  8023de:	01 c1                	add    %eax,%ecx
+  8023e0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8023e3:	eb 0f                	jmp    8023f4 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  8023e5:	0f b6 10             	movzbl (%eax),%edx
+  8023e8:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8023ea:	05 00 10 00 00       	add    $0x1000,%eax
+  8023ef:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8023f4:	39 c8                	cmp    %ecx,%eax
+  8023f6:	72 ed                	jb     8023e5 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  8023f8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8023fb:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802401:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802407:	83 ec 0c             	sub    $0xc,%esp
+  80240a:	6a 07                	push   $0x7
+  80240c:	89 f9                	mov    %edi,%ecx
+  80240e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802411:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802416:	e8 3f f1 ff ff       	call   80155a <fsipc_pages>
+  80241b:	89 c7                	mov    %eax,%edi
+  80241d:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802420:	85 f6                	test   %esi,%esi
+  802422:	74 7f                	je     8024a3 <file_slurp+0x11e>
+  802424:	8d 43 01             	lea    0x1(%ebx),%eax
+  802427:	85 ff                	test   %edi,%edi
+  802429:	79 3c                	jns    802467 <file_slurp+0xe2>
+  80242b:	eb 76                	jmp    8024a3 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  80242d:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802433:	ba 00 00 00 00       	mov    $0x0,%edx
+  802438:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80243d:	e8 ba f2 ff ff       	call   8016fc <fsipc>
+  802442:	89 c7                	mov    %eax,%edi
+  802444:	85 c0                	test   %eax,%eax
+  802446:	7e d8                	jle    802420 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802448:	83 ec 04             	sub    $0x4,%esp
+  80244b:	50                   	push   %eax
+  80244c:	68 08 60 80 00       	push   $0x806008
+  802451:	ff 75 0c             	push   0xc(%ebp)
+  802454:	e8 67 e4 ff ff       	call   8008c0 <memmove>
+  802459:	83 c4 10             	add    $0x10,%esp
+  80245c:	eb c2                	jmp    802420 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  80245e:	80 fa 2f             	cmp    $0x2f,%dl
+  802461:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802464:	83 c0 01             	add    $0x1,%eax
+  802467:	89 c1                	mov    %eax,%ecx
+  802469:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  80246d:	84 d2                	test   %dl,%dl
+  80246f:	75 ed                	jne    80245e <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802471:	83 ec 04             	sub    $0x4,%esp
+  802474:	68 80 00 00 00       	push   $0x80
+  802479:	53                   	push   %ebx
+  80247a:	56                   	push   %esi
+  80247b:	e8 30 e3 ff ff       	call   8007b0 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802480:	a1 00 60 80 00       	mov    0x806000,%eax
+  802485:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  80248b:	a1 04 60 80 00       	mov    0x806004,%eax
+  802490:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802496:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  80249d:	40 80 00 
+  8024a0:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8024a3:	89 f8                	mov    %edi,%eax
+  8024a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024a8:	5b                   	pop    %ebx
+  8024a9:	5e                   	pop    %esi
+  8024aa:	5f                   	pop    %edi
+  8024ab:	5d                   	pop    %ebp
+  8024ac:	c3                   	ret
+		return -E_BAD_PATH;
+  8024ad:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8024b2:	eb ef                	jmp    8024a3 <file_slurp+0x11e>
+
+008024b4 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8024b4:	55                   	push   %ebp
+  8024b5:	89 e5                	mov    %esp,%ebp
+  8024b7:	53                   	push   %ebx
+  8024b8:	83 ec 10             	sub    $0x10,%esp
+  8024bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8024be:	53                   	push   %ebx
+  8024bf:	e8 3b e2 ff ff       	call   8006ff <strlen>
+  8024c4:	83 c4 10             	add    $0x10,%esp
+  8024c7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024cc:	7f 25                	jg     8024f3 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8024ce:	83 ec 08             	sub    $0x8,%esp
+  8024d1:	53                   	push   %ebx
+  8024d2:	68 00 60 80 00       	push   $0x806000
+  8024d7:	e8 5e e2 ff ff       	call   80073a <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8024dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024e1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024e6:	e8 11 f2 ff ff       	call   8016fc <fsipc>
+  8024eb:	83 c4 10             	add    $0x10,%esp
+}
+  8024ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024f1:	c9                   	leave
+  8024f2:	c3                   	ret
+		return -E_BAD_PATH;
+  8024f3:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8024f8:	eb f4                	jmp    8024ee <remove+0x3a>
+
+008024fa <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8024fa:	55                   	push   %ebp
+  8024fb:	89 e5                	mov    %esp,%ebp
+  8024fd:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802500:	ba 00 00 00 00       	mov    $0x0,%edx
+  802505:	b8 08 00 00 00       	mov    $0x8,%eax
+  80250a:	e8 ed f1 ff ff       	call   8016fc <fsipc>
+}
+  80250f:	c9                   	leave
+  802510:	c3                   	ret
+
+00802511 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802511:	55                   	push   %ebp
+  802512:	89 e5                	mov    %esp,%ebp
+  802514:	57                   	push   %edi
+  802515:	56                   	push   %esi
+  802516:	53                   	push   %ebx
+  802517:	83 ec 18             	sub    $0x18,%esp
+  80251a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80251d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802520:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802523:	57                   	push   %edi
+  802524:	e8 d6 e1 ff ff       	call   8006ff <strlen>
+  802529:	83 c4 10             	add    $0x10,%esp
+  80252c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802531:	7f 4c                	jg     80257f <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802533:	83 ec 08             	sub    $0x8,%esp
+  802536:	57                   	push   %edi
+  802537:	68 00 60 80 00       	push   $0x806000
+  80253c:	e8 f9 e1 ff ff       	call   80073a <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802541:	ba 00 00 00 00       	mov    $0x0,%edx
+  802546:	b8 10 00 00 00       	mov    $0x10,%eax
+  80254b:	e8 ac f1 ff ff       	call   8016fc <fsipc>
+  802550:	83 c4 10             	add    $0x10,%esp
+  802553:	85 c0                	test   %eax,%eax
+  802555:	78 20                	js     802577 <defrag+0x66>
+		return r;
+	if (before)
+  802557:	85 f6                	test   %esi,%esi
+  802559:	74 07                	je     802562 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  80255b:	a1 00 60 80 00       	mov    0x806000,%eax
+  802560:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802562:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802567:	85 db                	test   %ebx,%ebx
+  802569:	74 0c                	je     802577 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  80256b:	a1 04 60 80 00       	mov    0x806004,%eax
+  802570:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802572:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802577:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80257a:	5b                   	pop    %ebx
+  80257b:	5e                   	pop    %esi
+  80257c:	5f                   	pop    %edi
+  80257d:	5d                   	pop    %ebp
+  80257e:	c3                   	ret
+		return -E_BAD_PATH;
+  80257f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802584:	eb f1                	jmp    802577 <defrag+0x66>
+
+00802586 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802586:	55                   	push   %ebp
+  802587:	89 e5                	mov    %esp,%ebp
+  802589:	53                   	push   %ebx
+  80258a:	83 ec 04             	sub    $0x4,%esp
+  80258d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802590:	ba 00 00 00 00       	mov    $0x0,%edx
+  802595:	b8 11 00 00 00       	mov    $0x11,%eax
+  80259a:	e8 5d f1 ff ff       	call   8016fc <fsipc>
+  80259f:	85 c0                	test   %eax,%eax
+  8025a1:	78 34                	js     8025d7 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  8025a3:	a1 00 60 80 00       	mov    0x806000,%eax
+  8025a8:	89 03                	mov    %eax,(%ebx)
+  8025aa:	a1 04 60 80 00       	mov    0x806004,%eax
+  8025af:	89 43 04             	mov    %eax,0x4(%ebx)
+  8025b2:	a1 08 60 80 00       	mov    0x806008,%eax
+  8025b7:	89 43 08             	mov    %eax,0x8(%ebx)
+  8025ba:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  8025bf:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8025c2:	a1 10 60 80 00       	mov    0x806010,%eax
+  8025c7:	89 43 10             	mov    %eax,0x10(%ebx)
+  8025ca:	a1 14 60 80 00       	mov    0x806014,%eax
+  8025cf:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  8025d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025da:	c9                   	leave
+  8025db:	c3                   	ret
+
+008025dc <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8025dc:	55                   	push   %ebp
+  8025dd:	89 e5                	mov    %esp,%ebp
+  8025df:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8025e2:	68 d6 3b 80 00       	push   $0x803bd6
+  8025e7:	ff 75 0c             	push   0xc(%ebp)
+  8025ea:	e8 4b e1 ff ff       	call   80073a <strcpy>
+	return 0;
+}
+  8025ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f4:	c9                   	leave
+  8025f5:	c3                   	ret
+
+008025f6 <devsock_close>:
+{
+  8025f6:	55                   	push   %ebp
+  8025f7:	89 e5                	mov    %esp,%ebp
+  8025f9:	53                   	push   %ebx
+  8025fa:	83 ec 10             	sub    $0x10,%esp
+  8025fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802600:	53                   	push   %ebx
+  802601:	e8 3a 0e 00 00       	call   803440 <pageref>
+  802606:	89 c2                	mov    %eax,%edx
+  802608:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80260b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802610:	83 fa 01             	cmp    $0x1,%edx
+  802613:	74 05                	je     80261a <devsock_close+0x24>
+}
+  802615:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802618:	c9                   	leave
+  802619:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80261a:	83 ec 0c             	sub    $0xc,%esp
+  80261d:	ff 73 0c             	push   0xc(%ebx)
+  802620:	e8 b7 02 00 00       	call   8028dc <nsipc_close>
+  802625:	83 c4 10             	add    $0x10,%esp
+  802628:	eb eb                	jmp    802615 <devsock_close+0x1f>
+
+0080262a <devsock_write>:
+{
+  80262a:	55                   	push   %ebp
+  80262b:	89 e5                	mov    %esp,%ebp
+  80262d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802630:	6a 00                	push   $0x0
+  802632:	ff 75 10             	push   0x10(%ebp)
+  802635:	ff 75 0c             	push   0xc(%ebp)
+  802638:	8b 45 08             	mov    0x8(%ebp),%eax
+  80263b:	ff 70 0c             	push   0xc(%eax)
+  80263e:	e8 79 03 00 00       	call   8029bc <nsipc_send>
+}
+  802643:	c9                   	leave
+  802644:	c3                   	ret
+
+00802645 <devsock_read>:
+{
+  802645:	55                   	push   %ebp
+  802646:	89 e5                	mov    %esp,%ebp
+  802648:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80264b:	6a 00                	push   $0x0
+  80264d:	ff 75 10             	push   0x10(%ebp)
+  802650:	ff 75 0c             	push   0xc(%ebp)
+  802653:	8b 45 08             	mov    0x8(%ebp),%eax
+  802656:	ff 70 0c             	push   0xc(%eax)
+  802659:	e8 ef 02 00 00       	call   80294d <nsipc_recv>
+}
+  80265e:	c9                   	leave
+  80265f:	c3                   	ret
+
+00802660 <fd2sockid>:
+{
+  802660:	55                   	push   %ebp
+  802661:	89 e5                	mov    %esp,%ebp
+  802663:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802666:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802669:	52                   	push   %edx
+  80266a:	50                   	push   %eax
+  80266b:	e8 54 e9 ff ff       	call   800fc4 <fd_lookup>
+  802670:	83 c4 10             	add    $0x10,%esp
+  802673:	85 c0                	test   %eax,%eax
+  802675:	78 10                	js     802687 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802677:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80267a:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  802680:	39 08                	cmp    %ecx,(%eax)
+  802682:	75 05                	jne    802689 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802684:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802687:	c9                   	leave
+  802688:	c3                   	ret
+		return -E_NOT_SUPP;
+  802689:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80268e:	eb f7                	jmp    802687 <fd2sockid+0x27>
+
+00802690 <alloc_sockfd>:
+{
+  802690:	55                   	push   %ebp
+  802691:	89 e5                	mov    %esp,%ebp
+  802693:	56                   	push   %esi
+  802694:	53                   	push   %ebx
+  802695:	83 ec 1c             	sub    $0x1c,%esp
+  802698:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80269a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80269d:	50                   	push   %eax
+  80269e:	e8 cb e8 ff ff       	call   800f6e <fd_alloc>
+  8026a3:	89 c3                	mov    %eax,%ebx
+  8026a5:	83 c4 10             	add    $0x10,%esp
+  8026a8:	85 c0                	test   %eax,%eax
+  8026aa:	78 43                	js     8026ef <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8026ac:	83 ec 04             	sub    $0x4,%esp
+  8026af:	68 07 04 00 00       	push   $0x407
+  8026b4:	ff 75 f4             	push   -0xc(%ebp)
+  8026b7:	6a 00                	push   $0x0
+  8026b9:	e8 88 e4 ff ff       	call   800b46 <sys_page_alloc>
+  8026be:	89 c3                	mov    %eax,%ebx
+  8026c0:	83 c4 10             	add    $0x10,%esp
+  8026c3:	85 c0                	test   %eax,%eax
+  8026c5:	78 28                	js     8026ef <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8026c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026ca:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  8026d0:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8026d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026d5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8026dc:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8026df:	83 ec 0c             	sub    $0xc,%esp
+  8026e2:	50                   	push   %eax
+  8026e3:	e8 5f e8 ff ff       	call   800f47 <fd2num>
+  8026e8:	89 c3                	mov    %eax,%ebx
+  8026ea:	83 c4 10             	add    $0x10,%esp
+  8026ed:	eb 0c                	jmp    8026fb <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8026ef:	83 ec 0c             	sub    $0xc,%esp
+  8026f2:	56                   	push   %esi
+  8026f3:	e8 e4 01 00 00       	call   8028dc <nsipc_close>
+		return r;
+  8026f8:	83 c4 10             	add    $0x10,%esp
+}
+  8026fb:	89 d8                	mov    %ebx,%eax
+  8026fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802700:	5b                   	pop    %ebx
+  802701:	5e                   	pop    %esi
+  802702:	5d                   	pop    %ebp
+  802703:	c3                   	ret
+
+00802704 <accept>:
+{
+  802704:	55                   	push   %ebp
+  802705:	89 e5                	mov    %esp,%ebp
+  802707:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80270a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80270d:	e8 4e ff ff ff       	call   802660 <fd2sockid>
+  802712:	85 c0                	test   %eax,%eax
+  802714:	78 1b                	js     802731 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802716:	83 ec 04             	sub    $0x4,%esp
+  802719:	ff 75 10             	push   0x10(%ebp)
+  80271c:	ff 75 0c             	push   0xc(%ebp)
+  80271f:	50                   	push   %eax
+  802720:	e8 0e 01 00 00       	call   802833 <nsipc_accept>
+  802725:	83 c4 10             	add    $0x10,%esp
+  802728:	85 c0                	test   %eax,%eax
+  80272a:	78 05                	js     802731 <accept+0x2d>
+	return alloc_sockfd(r);
+  80272c:	e8 5f ff ff ff       	call   802690 <alloc_sockfd>
+}
+  802731:	c9                   	leave
+  802732:	c3                   	ret
+
+00802733 <bind>:
+{
+  802733:	55                   	push   %ebp
+  802734:	89 e5                	mov    %esp,%ebp
+  802736:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802739:	8b 45 08             	mov    0x8(%ebp),%eax
+  80273c:	e8 1f ff ff ff       	call   802660 <fd2sockid>
+  802741:	85 c0                	test   %eax,%eax
+  802743:	78 12                	js     802757 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802745:	83 ec 04             	sub    $0x4,%esp
+  802748:	ff 75 10             	push   0x10(%ebp)
+  80274b:	ff 75 0c             	push   0xc(%ebp)
+  80274e:	50                   	push   %eax
+  80274f:	e8 31 01 00 00       	call   802885 <nsipc_bind>
+  802754:	83 c4 10             	add    $0x10,%esp
+}
+  802757:	c9                   	leave
+  802758:	c3                   	ret
+
+00802759 <shutdown>:
+{
+  802759:	55                   	push   %ebp
+  80275a:	89 e5                	mov    %esp,%ebp
+  80275c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80275f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802762:	e8 f9 fe ff ff       	call   802660 <fd2sockid>
+  802767:	85 c0                	test   %eax,%eax
+  802769:	78 0f                	js     80277a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80276b:	83 ec 08             	sub    $0x8,%esp
+  80276e:	ff 75 0c             	push   0xc(%ebp)
+  802771:	50                   	push   %eax
+  802772:	e8 43 01 00 00       	call   8028ba <nsipc_shutdown>
+  802777:	83 c4 10             	add    $0x10,%esp
+}
+  80277a:	c9                   	leave
+  80277b:	c3                   	ret
+
+0080277c <connect>:
+{
+  80277c:	55                   	push   %ebp
+  80277d:	89 e5                	mov    %esp,%ebp
+  80277f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802782:	8b 45 08             	mov    0x8(%ebp),%eax
+  802785:	e8 d6 fe ff ff       	call   802660 <fd2sockid>
+  80278a:	85 c0                	test   %eax,%eax
+  80278c:	78 12                	js     8027a0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80278e:	83 ec 04             	sub    $0x4,%esp
+  802791:	ff 75 10             	push   0x10(%ebp)
+  802794:	ff 75 0c             	push   0xc(%ebp)
+  802797:	50                   	push   %eax
+  802798:	e8 59 01 00 00       	call   8028f6 <nsipc_connect>
+  80279d:	83 c4 10             	add    $0x10,%esp
+}
+  8027a0:	c9                   	leave
+  8027a1:	c3                   	ret
+
+008027a2 <listen>:
+{
+  8027a2:	55                   	push   %ebp
+  8027a3:	89 e5                	mov    %esp,%ebp
+  8027a5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ab:	e8 b0 fe ff ff       	call   802660 <fd2sockid>
+  8027b0:	85 c0                	test   %eax,%eax
+  8027b2:	78 0f                	js     8027c3 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8027b4:	83 ec 08             	sub    $0x8,%esp
+  8027b7:	ff 75 0c             	push   0xc(%ebp)
+  8027ba:	50                   	push   %eax
+  8027bb:	e8 6b 01 00 00       	call   80292b <nsipc_listen>
+  8027c0:	83 c4 10             	add    $0x10,%esp
+}
+  8027c3:	c9                   	leave
+  8027c4:	c3                   	ret
+
+008027c5 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8027c5:	55                   	push   %ebp
+  8027c6:	89 e5                	mov    %esp,%ebp
+  8027c8:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8027cb:	ff 75 10             	push   0x10(%ebp)
+  8027ce:	ff 75 0c             	push   0xc(%ebp)
+  8027d1:	ff 75 08             	push   0x8(%ebp)
+  8027d4:	e8 41 02 00 00       	call   802a1a <nsipc_socket>
+  8027d9:	83 c4 10             	add    $0x10,%esp
+  8027dc:	85 c0                	test   %eax,%eax
+  8027de:	78 05                	js     8027e5 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8027e0:	e8 ab fe ff ff       	call   802690 <alloc_sockfd>
+}
+  8027e5:	c9                   	leave
+  8027e6:	c3                   	ret
+
+008027e7 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8027e7:	55                   	push   %ebp
+  8027e8:	89 e5                	mov    %esp,%ebp
+  8027ea:	53                   	push   %ebx
+  8027eb:	83 ec 04             	sub    $0x4,%esp
+  8027ee:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8027f0:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8027f7:	74 26                	je     80281f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8027f9:	6a 07                	push   $0x7
+  8027fb:	68 00 80 80 00       	push   $0x808000
+  802800:	53                   	push   %ebx
+  802801:	ff 35 00 90 80 00    	push   0x809000
+  802807:	e8 bc 0a 00 00       	call   8032c8 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80280c:	83 c4 0c             	add    $0xc,%esp
+  80280f:	6a 00                	push   $0x0
+  802811:	6a 00                	push   $0x0
+  802813:	6a 00                	push   $0x0
+  802815:	e8 43 0a 00 00       	call   80325d <ipc_recv>
+}
+  80281a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80281d:	c9                   	leave
+  80281e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80281f:	83 ec 0c             	sub    $0xc,%esp
+  802822:	6a 02                	push   $0x2
+  802824:	e8 d8 0b 00 00       	call   803401 <ipc_find_env>
+  802829:	a3 00 90 80 00       	mov    %eax,0x809000
+  80282e:	83 c4 10             	add    $0x10,%esp
+  802831:	eb c6                	jmp    8027f9 <nsipc+0x12>
+
+00802833 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802833:	55                   	push   %ebp
+  802834:	89 e5                	mov    %esp,%ebp
+  802836:	56                   	push   %esi
+  802837:	53                   	push   %ebx
+  802838:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80283b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80283e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802843:	8b 06                	mov    (%esi),%eax
+  802845:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80284a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80284f:	e8 93 ff ff ff       	call   8027e7 <nsipc>
+  802854:	89 c3                	mov    %eax,%ebx
+  802856:	85 c0                	test   %eax,%eax
+  802858:	79 09                	jns    802863 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80285a:	89 d8                	mov    %ebx,%eax
+  80285c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80285f:	5b                   	pop    %ebx
+  802860:	5e                   	pop    %esi
+  802861:	5d                   	pop    %ebp
+  802862:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802863:	83 ec 04             	sub    $0x4,%esp
+  802866:	ff 35 10 80 80 00    	push   0x808010
+  80286c:	68 00 80 80 00       	push   $0x808000
+  802871:	ff 75 0c             	push   0xc(%ebp)
+  802874:	e8 47 e0 ff ff       	call   8008c0 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802879:	a1 10 80 80 00       	mov    0x808010,%eax
+  80287e:	89 06                	mov    %eax,(%esi)
+  802880:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802883:	eb d5                	jmp    80285a <nsipc_accept+0x27>
+
+00802885 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802885:	55                   	push   %ebp
+  802886:	89 e5                	mov    %esp,%ebp
+  802888:	53                   	push   %ebx
+  802889:	83 ec 08             	sub    $0x8,%esp
+  80288c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80288f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802892:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802897:	53                   	push   %ebx
+  802898:	ff 75 0c             	push   0xc(%ebp)
+  80289b:	68 04 80 80 00       	push   $0x808004
+  8028a0:	e8 1b e0 ff ff       	call   8008c0 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8028a5:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8028ab:	b8 02 00 00 00       	mov    $0x2,%eax
+  8028b0:	e8 32 ff ff ff       	call   8027e7 <nsipc>
+}
+  8028b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028b8:	c9                   	leave
+  8028b9:	c3                   	ret
+
+008028ba <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8028ba:	55                   	push   %ebp
+  8028bb:	89 e5                	mov    %esp,%ebp
+  8028bd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8028c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028c3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  8028c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028cb:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  8028d0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8028d5:	e8 0d ff ff ff       	call   8027e7 <nsipc>
+}
+  8028da:	c9                   	leave
+  8028db:	c3                   	ret
+
+008028dc <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8028dc:	55                   	push   %ebp
+  8028dd:	89 e5                	mov    %esp,%ebp
+  8028df:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8028e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e5:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8028ea:	b8 04 00 00 00       	mov    $0x4,%eax
+  8028ef:	e8 f3 fe ff ff       	call   8027e7 <nsipc>
+}
+  8028f4:	c9                   	leave
+  8028f5:	c3                   	ret
+
+008028f6 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8028f6:	55                   	push   %ebp
+  8028f7:	89 e5                	mov    %esp,%ebp
+  8028f9:	53                   	push   %ebx
+  8028fa:	83 ec 08             	sub    $0x8,%esp
+  8028fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802900:	8b 45 08             	mov    0x8(%ebp),%eax
+  802903:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802908:	53                   	push   %ebx
+  802909:	ff 75 0c             	push   0xc(%ebp)
+  80290c:	68 04 80 80 00       	push   $0x808004
+  802911:	e8 aa df ff ff       	call   8008c0 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802916:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  80291c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802921:	e8 c1 fe ff ff       	call   8027e7 <nsipc>
+}
+  802926:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802929:	c9                   	leave
+  80292a:	c3                   	ret
+
+0080292b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80292b:	55                   	push   %ebp
+  80292c:	89 e5                	mov    %esp,%ebp
+  80292e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802931:	8b 45 08             	mov    0x8(%ebp),%eax
+  802934:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802939:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80293c:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802941:	b8 06 00 00 00       	mov    $0x6,%eax
+  802946:	e8 9c fe ff ff       	call   8027e7 <nsipc>
+}
+  80294b:	c9                   	leave
+  80294c:	c3                   	ret
+
+0080294d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80294d:	55                   	push   %ebp
+  80294e:	89 e5                	mov    %esp,%ebp
+  802950:	56                   	push   %esi
+  802951:	53                   	push   %ebx
+  802952:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802955:	8b 45 08             	mov    0x8(%ebp),%eax
+  802958:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  80295d:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802963:	8b 45 14             	mov    0x14(%ebp),%eax
+  802966:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80296b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802970:	e8 72 fe ff ff       	call   8027e7 <nsipc>
+  802975:	89 c3                	mov    %eax,%ebx
+  802977:	85 c0                	test   %eax,%eax
+  802979:	78 22                	js     80299d <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80297b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802980:	39 c6                	cmp    %eax,%esi
+  802982:	0f 4e c6             	cmovle %esi,%eax
+  802985:	39 c3                	cmp    %eax,%ebx
+  802987:	7f 1d                	jg     8029a6 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802989:	83 ec 04             	sub    $0x4,%esp
+  80298c:	53                   	push   %ebx
+  80298d:	68 00 80 80 00       	push   $0x808000
+  802992:	ff 75 0c             	push   0xc(%ebp)
+  802995:	e8 26 df ff ff       	call   8008c0 <memmove>
+  80299a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80299d:	89 d8                	mov    %ebx,%eax
+  80299f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029a2:	5b                   	pop    %ebx
+  8029a3:	5e                   	pop    %esi
+  8029a4:	5d                   	pop    %ebp
+  8029a5:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8029a6:	68 e2 3b 80 00       	push   $0x803be2
+  8029ab:	68 80 3b 80 00       	push   $0x803b80
+  8029b0:	6a 62                	push   $0x62
+  8029b2:	68 f7 3b 80 00       	push   $0x803bf7
+  8029b7:	e8 46 05 00 00       	call   802f02 <_panic>
+
+008029bc <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8029bc:	55                   	push   %ebp
+  8029bd:	89 e5                	mov    %esp,%ebp
+  8029bf:	53                   	push   %ebx
+  8029c0:	83 ec 04             	sub    $0x4,%esp
+  8029c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8029c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c9:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  8029ce:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8029d4:	7f 2e                	jg     802a04 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8029d6:	83 ec 04             	sub    $0x4,%esp
+  8029d9:	53                   	push   %ebx
+  8029da:	ff 75 0c             	push   0xc(%ebp)
+  8029dd:	68 0c 80 80 00       	push   $0x80800c
+  8029e2:	e8 d9 de ff ff       	call   8008c0 <memmove>
+	nsipcbuf.send.req_size = size;
+  8029e7:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8029ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029f0:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8029f5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8029fa:	e8 e8 fd ff ff       	call   8027e7 <nsipc>
+}
+  8029ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a02:	c9                   	leave
+  802a03:	c3                   	ret
+	assert(size < 1600);
+  802a04:	68 03 3c 80 00       	push   $0x803c03
+  802a09:	68 80 3b 80 00       	push   $0x803b80
+  802a0e:	6a 6d                	push   $0x6d
+  802a10:	68 f7 3b 80 00       	push   $0x803bf7
+  802a15:	e8 e8 04 00 00       	call   802f02 <_panic>
+
+00802a1a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802a1a:	55                   	push   %ebp
+  802a1b:	89 e5                	mov    %esp,%ebp
+  802a1d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802a20:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a23:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802a28:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a2b:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802a30:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a33:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802a38:	b8 09 00 00 00       	mov    $0x9,%eax
+  802a3d:	e8 a5 fd ff ff       	call   8027e7 <nsipc>
+}
+  802a42:	c9                   	leave
+  802a43:	c3                   	ret
+
+00802a44 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a44:	55                   	push   %ebp
+  802a45:	89 e5                	mov    %esp,%ebp
+  802a47:	56                   	push   %esi
+  802a48:	53                   	push   %ebx
+  802a49:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802a4c:	83 ec 0c             	sub    $0xc,%esp
+  802a4f:	ff 75 08             	push   0x8(%ebp)
+  802a52:	e8 00 e5 ff ff       	call   800f57 <fd2data>
+  802a57:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802a59:	83 c4 08             	add    $0x8,%esp
+  802a5c:	68 0f 3c 80 00       	push   $0x803c0f
+  802a61:	53                   	push   %ebx
+  802a62:	e8 d3 dc ff ff       	call   80073a <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802a67:	8b 46 04             	mov    0x4(%esi),%eax
+  802a6a:	2b 06                	sub    (%esi),%eax
+  802a6c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802a72:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802a79:	00 00 00 
+	stat->st_dev = &devpipe;
+  802a7c:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802a83:	40 80 00 
+	return 0;
+}
+  802a86:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a8e:	5b                   	pop    %ebx
+  802a8f:	5e                   	pop    %esi
+  802a90:	5d                   	pop    %ebp
+  802a91:	c3                   	ret
+
+00802a92 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802a92:	55                   	push   %ebp
+  802a93:	89 e5                	mov    %esp,%ebp
+  802a95:	53                   	push   %ebx
+  802a96:	83 ec 0c             	sub    $0xc,%esp
+  802a99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802a9c:	53                   	push   %ebx
+  802a9d:	6a 00                	push   $0x0
+  802a9f:	e8 2f e1 ff ff       	call   800bd3 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802aa4:	89 1c 24             	mov    %ebx,(%esp)
+  802aa7:	e8 ab e4 ff ff       	call   800f57 <fd2data>
+  802aac:	83 c4 08             	add    $0x8,%esp
+  802aaf:	50                   	push   %eax
+  802ab0:	6a 00                	push   $0x0
+  802ab2:	e8 1c e1 ff ff       	call   800bd3 <sys_page_unmap>
+}
+  802ab7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aba:	c9                   	leave
+  802abb:	c3                   	ret
+
+00802abc <_pipeisclosed>:
+{
+  802abc:	55                   	push   %ebp
+  802abd:	89 e5                	mov    %esp,%ebp
+  802abf:	57                   	push   %edi
+  802ac0:	56                   	push   %esi
+  802ac1:	53                   	push   %ebx
+  802ac2:	83 ec 1c             	sub    $0x1c,%esp
+  802ac5:	89 c7                	mov    %eax,%edi
+  802ac7:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802ac9:	a1 04 50 80 00       	mov    0x805004,%eax
+  802ace:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802ad1:	83 ec 0c             	sub    $0xc,%esp
+  802ad4:	57                   	push   %edi
+  802ad5:	e8 66 09 00 00       	call   803440 <pageref>
+  802ada:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802add:	89 34 24             	mov    %esi,(%esp)
+  802ae0:	e8 5b 09 00 00       	call   803440 <pageref>
+		nn = thisenv->env_runs;
+  802ae5:	8b 15 04 50 80 00    	mov    0x805004,%edx
+  802aeb:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802aee:	83 c4 10             	add    $0x10,%esp
+  802af1:	39 cb                	cmp    %ecx,%ebx
+  802af3:	74 1b                	je     802b10 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802af5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802af8:	75 cf                	jne    802ac9 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802afa:	8b 42 58             	mov    0x58(%edx),%eax
+  802afd:	6a 01                	push   $0x1
+  802aff:	50                   	push   %eax
+  802b00:	53                   	push   %ebx
+  802b01:	68 16 3c 80 00       	push   $0x803c16
+  802b06:	e8 41 d6 ff ff       	call   80014c <cprintf>
+  802b0b:	83 c4 10             	add    $0x10,%esp
+  802b0e:	eb b9                	jmp    802ac9 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802b10:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802b13:	0f 94 c0             	sete   %al
+  802b16:	0f b6 c0             	movzbl %al,%eax
+}
+  802b19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b1c:	5b                   	pop    %ebx
+  802b1d:	5e                   	pop    %esi
+  802b1e:	5f                   	pop    %edi
+  802b1f:	5d                   	pop    %ebp
+  802b20:	c3                   	ret
+
+00802b21 <devpipe_write>:
+{
+  802b21:	55                   	push   %ebp
+  802b22:	89 e5                	mov    %esp,%ebp
+  802b24:	57                   	push   %edi
+  802b25:	56                   	push   %esi
+  802b26:	53                   	push   %ebx
+  802b27:	83 ec 28             	sub    $0x28,%esp
+  802b2a:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802b2d:	56                   	push   %esi
+  802b2e:	e8 24 e4 ff ff       	call   800f57 <fd2data>
+  802b33:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802b35:	83 c4 10             	add    $0x10,%esp
+  802b38:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b3d:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802b40:	75 09                	jne    802b4b <devpipe_write+0x2a>
+	return i;
+  802b42:	89 f8                	mov    %edi,%eax
+  802b44:	eb 23                	jmp    802b69 <devpipe_write+0x48>
+			sys_yield();
+  802b46:	e8 dc df ff ff       	call   800b27 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802b4b:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b4e:	8b 0b                	mov    (%ebx),%ecx
+  802b50:	8d 51 20             	lea    0x20(%ecx),%edx
+  802b53:	39 d0                	cmp    %edx,%eax
+  802b55:	72 1a                	jb     802b71 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802b57:	89 da                	mov    %ebx,%edx
+  802b59:	89 f0                	mov    %esi,%eax
+  802b5b:	e8 5c ff ff ff       	call   802abc <_pipeisclosed>
+  802b60:	85 c0                	test   %eax,%eax
+  802b62:	74 e2                	je     802b46 <devpipe_write+0x25>
+				return 0;
+  802b64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b6c:	5b                   	pop    %ebx
+  802b6d:	5e                   	pop    %esi
+  802b6e:	5f                   	pop    %edi
+  802b6f:	5d                   	pop    %ebp
+  802b70:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802b71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b74:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802b78:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802b7b:	89 c2                	mov    %eax,%edx
+  802b7d:	c1 fa 1f             	sar    $0x1f,%edx
+  802b80:	89 d1                	mov    %edx,%ecx
+  802b82:	c1 e9 1b             	shr    $0x1b,%ecx
+  802b85:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802b88:	83 e2 1f             	and    $0x1f,%edx
+  802b8b:	29 ca                	sub    %ecx,%edx
+  802b8d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802b91:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802b95:	83 c0 01             	add    $0x1,%eax
+  802b98:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802b9b:	83 c7 01             	add    $0x1,%edi
+  802b9e:	eb 9d                	jmp    802b3d <devpipe_write+0x1c>
+
+00802ba0 <devpipe_read>:
+{
+  802ba0:	55                   	push   %ebp
+  802ba1:	89 e5                	mov    %esp,%ebp
+  802ba3:	57                   	push   %edi
+  802ba4:	56                   	push   %esi
+  802ba5:	53                   	push   %ebx
+  802ba6:	83 ec 18             	sub    $0x18,%esp
+  802ba9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802bac:	57                   	push   %edi
+  802bad:	e8 a5 e3 ff ff       	call   800f57 <fd2data>
+  802bb2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802bb4:	83 c4 10             	add    $0x10,%esp
+  802bb7:	be 00 00 00 00       	mov    $0x0,%esi
+  802bbc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802bbf:	75 13                	jne    802bd4 <devpipe_read+0x34>
+	return i;
+  802bc1:	89 f0                	mov    %esi,%eax
+  802bc3:	eb 02                	jmp    802bc7 <devpipe_read+0x27>
+				return i;
+  802bc5:	89 f0                	mov    %esi,%eax
+}
+  802bc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bca:	5b                   	pop    %ebx
+  802bcb:	5e                   	pop    %esi
+  802bcc:	5f                   	pop    %edi
+  802bcd:	5d                   	pop    %ebp
+  802bce:	c3                   	ret
+			sys_yield();
+  802bcf:	e8 53 df ff ff       	call   800b27 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802bd4:	8b 03                	mov    (%ebx),%eax
+  802bd6:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802bd9:	75 18                	jne    802bf3 <devpipe_read+0x53>
+			if (i > 0)
+  802bdb:	85 f6                	test   %esi,%esi
+  802bdd:	75 e6                	jne    802bc5 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802bdf:	89 da                	mov    %ebx,%edx
+  802be1:	89 f8                	mov    %edi,%eax
+  802be3:	e8 d4 fe ff ff       	call   802abc <_pipeisclosed>
+  802be8:	85 c0                	test   %eax,%eax
+  802bea:	74 e3                	je     802bcf <devpipe_read+0x2f>
+				return 0;
+  802bec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf1:	eb d4                	jmp    802bc7 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802bf3:	99                   	cltd
+  802bf4:	c1 ea 1b             	shr    $0x1b,%edx
+  802bf7:	01 d0                	add    %edx,%eax
+  802bf9:	83 e0 1f             	and    $0x1f,%eax
+  802bfc:	29 d0                	sub    %edx,%eax
+  802bfe:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802c03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c06:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802c09:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802c0c:	83 c6 01             	add    $0x1,%esi
+  802c0f:	eb ab                	jmp    802bbc <devpipe_read+0x1c>
+
+00802c11 <pipe>:
+{
+  802c11:	55                   	push   %ebp
+  802c12:	89 e5                	mov    %esp,%ebp
+  802c14:	56                   	push   %esi
+  802c15:	53                   	push   %ebx
+  802c16:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802c19:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c1c:	50                   	push   %eax
+  802c1d:	e8 4c e3 ff ff       	call   800f6e <fd_alloc>
+  802c22:	89 c3                	mov    %eax,%ebx
+  802c24:	83 c4 10             	add    $0x10,%esp
+  802c27:	85 c0                	test   %eax,%eax
+  802c29:	0f 88 23 01 00 00    	js     802d52 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c2f:	83 ec 04             	sub    $0x4,%esp
+  802c32:	68 07 04 00 00       	push   $0x407
+  802c37:	ff 75 f4             	push   -0xc(%ebp)
+  802c3a:	6a 00                	push   $0x0
+  802c3c:	e8 05 df ff ff       	call   800b46 <sys_page_alloc>
+  802c41:	89 c3                	mov    %eax,%ebx
+  802c43:	83 c4 10             	add    $0x10,%esp
+  802c46:	85 c0                	test   %eax,%eax
+  802c48:	0f 88 04 01 00 00    	js     802d52 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802c4e:	83 ec 0c             	sub    $0xc,%esp
+  802c51:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802c54:	50                   	push   %eax
+  802c55:	e8 14 e3 ff ff       	call   800f6e <fd_alloc>
+  802c5a:	89 c3                	mov    %eax,%ebx
+  802c5c:	83 c4 10             	add    $0x10,%esp
+  802c5f:	85 c0                	test   %eax,%eax
+  802c61:	0f 88 db 00 00 00    	js     802d42 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c67:	83 ec 04             	sub    $0x4,%esp
+  802c6a:	68 07 04 00 00       	push   $0x407
+  802c6f:	ff 75 f0             	push   -0x10(%ebp)
+  802c72:	6a 00                	push   $0x0
+  802c74:	e8 cd de ff ff       	call   800b46 <sys_page_alloc>
+  802c79:	89 c3                	mov    %eax,%ebx
+  802c7b:	83 c4 10             	add    $0x10,%esp
+  802c7e:	85 c0                	test   %eax,%eax
+  802c80:	0f 88 bc 00 00 00    	js     802d42 <pipe+0x131>
+	va = fd2data(fd0);
+  802c86:	83 ec 0c             	sub    $0xc,%esp
+  802c89:	ff 75 f4             	push   -0xc(%ebp)
+  802c8c:	e8 c6 e2 ff ff       	call   800f57 <fd2data>
+  802c91:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c93:	83 c4 0c             	add    $0xc,%esp
+  802c96:	68 07 04 00 00       	push   $0x407
+  802c9b:	50                   	push   %eax
+  802c9c:	6a 00                	push   $0x0
+  802c9e:	e8 a3 de ff ff       	call   800b46 <sys_page_alloc>
+  802ca3:	89 c3                	mov    %eax,%ebx
+  802ca5:	83 c4 10             	add    $0x10,%esp
+  802ca8:	85 c0                	test   %eax,%eax
+  802caa:	0f 88 82 00 00 00    	js     802d32 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cb0:	83 ec 0c             	sub    $0xc,%esp
+  802cb3:	ff 75 f0             	push   -0x10(%ebp)
+  802cb6:	e8 9c e2 ff ff       	call   800f57 <fd2data>
+  802cbb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802cc2:	50                   	push   %eax
+  802cc3:	6a 00                	push   $0x0
+  802cc5:	56                   	push   %esi
+  802cc6:	6a 00                	push   $0x0
+  802cc8:	e8 c4 de ff ff       	call   800b91 <sys_page_map>
+  802ccd:	89 c3                	mov    %eax,%ebx
+  802ccf:	83 c4 20             	add    $0x20,%esp
+  802cd2:	85 c0                	test   %eax,%eax
+  802cd4:	78 4e                	js     802d24 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802cd6:	a1 60 40 80 00       	mov    0x804060,%eax
+  802cdb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802cde:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802ce0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802ce3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802cea:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802ced:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802cef:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802cf2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802cf9:	83 ec 0c             	sub    $0xc,%esp
+  802cfc:	ff 75 f4             	push   -0xc(%ebp)
+  802cff:	e8 43 e2 ff ff       	call   800f47 <fd2num>
+  802d04:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d07:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802d09:	83 c4 04             	add    $0x4,%esp
+  802d0c:	ff 75 f0             	push   -0x10(%ebp)
+  802d0f:	e8 33 e2 ff ff       	call   800f47 <fd2num>
+  802d14:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d17:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802d1a:	83 c4 10             	add    $0x10,%esp
+  802d1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d22:	eb 2e                	jmp    802d52 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802d24:	83 ec 08             	sub    $0x8,%esp
+  802d27:	56                   	push   %esi
+  802d28:	6a 00                	push   $0x0
+  802d2a:	e8 a4 de ff ff       	call   800bd3 <sys_page_unmap>
+  802d2f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802d32:	83 ec 08             	sub    $0x8,%esp
+  802d35:	ff 75 f0             	push   -0x10(%ebp)
+  802d38:	6a 00                	push   $0x0
+  802d3a:	e8 94 de ff ff       	call   800bd3 <sys_page_unmap>
+  802d3f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802d42:	83 ec 08             	sub    $0x8,%esp
+  802d45:	ff 75 f4             	push   -0xc(%ebp)
+  802d48:	6a 00                	push   $0x0
+  802d4a:	e8 84 de ff ff       	call   800bd3 <sys_page_unmap>
+  802d4f:	83 c4 10             	add    $0x10,%esp
+}
+  802d52:	89 d8                	mov    %ebx,%eax
+  802d54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d57:	5b                   	pop    %ebx
+  802d58:	5e                   	pop    %esi
+  802d59:	5d                   	pop    %ebp
+  802d5a:	c3                   	ret
+
+00802d5b <pipeisclosed>:
+{
+  802d5b:	55                   	push   %ebp
+  802d5c:	89 e5                	mov    %esp,%ebp
+  802d5e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d64:	50                   	push   %eax
+  802d65:	ff 75 08             	push   0x8(%ebp)
+  802d68:	e8 57 e2 ff ff       	call   800fc4 <fd_lookup>
+  802d6d:	83 c4 10             	add    $0x10,%esp
+  802d70:	85 c0                	test   %eax,%eax
+  802d72:	78 18                	js     802d8c <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802d74:	83 ec 0c             	sub    $0xc,%esp
+  802d77:	ff 75 f4             	push   -0xc(%ebp)
+  802d7a:	e8 d8 e1 ff ff       	call   800f57 <fd2data>
+  802d7f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802d81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d84:	e8 33 fd ff ff       	call   802abc <_pipeisclosed>
+  802d89:	83 c4 10             	add    $0x10,%esp
+}
+  802d8c:	c9                   	leave
+  802d8d:	c3                   	ret
+
+00802d8e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d93:	c3                   	ret
+
+00802d94 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d94:	55                   	push   %ebp
+  802d95:	89 e5                	mov    %esp,%ebp
+  802d97:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802d9a:	68 2e 3c 80 00       	push   $0x803c2e
+  802d9f:	ff 75 0c             	push   0xc(%ebp)
+  802da2:	e8 93 d9 ff ff       	call   80073a <strcpy>
+	return 0;
+}
+  802da7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dac:	c9                   	leave
+  802dad:	c3                   	ret
+
+00802dae <devcons_write>:
+{
+  802dae:	55                   	push   %ebp
+  802daf:	89 e5                	mov    %esp,%ebp
+  802db1:	57                   	push   %edi
+  802db2:	56                   	push   %esi
+  802db3:	53                   	push   %ebx
+  802db4:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802dba:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802dbf:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802dc5:	eb 2e                	jmp    802df5 <devcons_write+0x47>
+		m = n - tot;
+  802dc7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dca:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802dcc:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802dd1:	39 c3                	cmp    %eax,%ebx
+  802dd3:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802dd6:	83 ec 04             	sub    $0x4,%esp
+  802dd9:	53                   	push   %ebx
+  802dda:	89 f0                	mov    %esi,%eax
+  802ddc:	03 45 0c             	add    0xc(%ebp),%eax
+  802ddf:	50                   	push   %eax
+  802de0:	57                   	push   %edi
+  802de1:	e8 da da ff ff       	call   8008c0 <memmove>
+		sys_cputs(buf, m);
+  802de6:	83 c4 08             	add    $0x8,%esp
+  802de9:	53                   	push   %ebx
+  802dea:	57                   	push   %edi
+  802deb:	e8 7a dc ff ff       	call   800a6a <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802df0:	01 de                	add    %ebx,%esi
+  802df2:	83 c4 10             	add    $0x10,%esp
+  802df5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802df8:	72 cd                	jb     802dc7 <devcons_write+0x19>
+}
+  802dfa:	89 f0                	mov    %esi,%eax
+  802dfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dff:	5b                   	pop    %ebx
+  802e00:	5e                   	pop    %esi
+  802e01:	5f                   	pop    %edi
+  802e02:	5d                   	pop    %ebp
+  802e03:	c3                   	ret
+
+00802e04 <devcons_read>:
+{
+  802e04:	55                   	push   %ebp
+  802e05:	89 e5                	mov    %esp,%ebp
+  802e07:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e0f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e13:	75 07                	jne    802e1c <devcons_read+0x18>
+  802e15:	eb 1f                	jmp    802e36 <devcons_read+0x32>
+		sys_yield();
+  802e17:	e8 0b dd ff ff       	call   800b27 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802e1c:	e8 6f dc ff ff       	call   800a90 <sys_cgetc>
+  802e21:	85 c0                	test   %eax,%eax
+  802e23:	74 f2                	je     802e17 <devcons_read+0x13>
+	if (c < 0)
+  802e25:	78 0f                	js     802e36 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802e27:	83 f8 04             	cmp    $0x4,%eax
+  802e2a:	74 0c                	je     802e38 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802e2c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802e2f:	88 02                	mov    %al,(%edx)
+	return 1;
+  802e31:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802e36:	c9                   	leave
+  802e37:	c3                   	ret
+		return 0;
+  802e38:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3d:	eb f7                	jmp    802e36 <devcons_read+0x32>
+
+00802e3f <cputchar>:
+{
+  802e3f:	55                   	push   %ebp
+  802e40:	89 e5                	mov    %esp,%ebp
+  802e42:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802e45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e48:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802e4b:	6a 01                	push   $0x1
+  802e4d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e50:	50                   	push   %eax
+  802e51:	e8 14 dc ff ff       	call   800a6a <sys_cputs>
+}
+  802e56:	83 c4 10             	add    $0x10,%esp
+  802e59:	c9                   	leave
+  802e5a:	c3                   	ret
+
+00802e5b <getchar>:
+{
+  802e5b:	55                   	push   %ebp
+  802e5c:	89 e5                	mov    %esp,%ebp
+  802e5e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802e61:	6a 01                	push   $0x1
+  802e63:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e66:	50                   	push   %eax
+  802e67:	6a 00                	push   $0x0
+  802e69:	e8 bc e3 ff ff       	call   80122a <read>
+	if (r < 0)
+  802e6e:	83 c4 10             	add    $0x10,%esp
+  802e71:	85 c0                	test   %eax,%eax
+  802e73:	78 06                	js     802e7b <getchar+0x20>
+	if (r < 1)
+  802e75:	74 06                	je     802e7d <getchar+0x22>
+	return c;
+  802e77:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802e7b:	c9                   	leave
+  802e7c:	c3                   	ret
+		return -E_EOF;
+  802e7d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802e82:	eb f7                	jmp    802e7b <getchar+0x20>
+
+00802e84 <iscons>:
+{
+  802e84:	55                   	push   %ebp
+  802e85:	89 e5                	mov    %esp,%ebp
+  802e87:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e8d:	50                   	push   %eax
+  802e8e:	ff 75 08             	push   0x8(%ebp)
+  802e91:	e8 2e e1 ff ff       	call   800fc4 <fd_lookup>
+  802e96:	83 c4 10             	add    $0x10,%esp
+  802e99:	85 c0                	test   %eax,%eax
+  802e9b:	78 11                	js     802eae <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802e9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ea0:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802ea6:	39 10                	cmp    %edx,(%eax)
+  802ea8:	0f 94 c0             	sete   %al
+  802eab:	0f b6 c0             	movzbl %al,%eax
+}
+  802eae:	c9                   	leave
+  802eaf:	c3                   	ret
+
+00802eb0 <opencons>:
+{
+  802eb0:	55                   	push   %ebp
+  802eb1:	89 e5                	mov    %esp,%ebp
+  802eb3:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802eb6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802eb9:	50                   	push   %eax
+  802eba:	e8 af e0 ff ff       	call   800f6e <fd_alloc>
+  802ebf:	83 c4 10             	add    $0x10,%esp
+  802ec2:	85 c0                	test   %eax,%eax
+  802ec4:	78 3a                	js     802f00 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802ec6:	83 ec 04             	sub    $0x4,%esp
+  802ec9:	68 07 04 00 00       	push   $0x407
+  802ece:	ff 75 f4             	push   -0xc(%ebp)
+  802ed1:	6a 00                	push   $0x0
+  802ed3:	e8 6e dc ff ff       	call   800b46 <sys_page_alloc>
+  802ed8:	83 c4 10             	add    $0x10,%esp
+  802edb:	85 c0                	test   %eax,%eax
+  802edd:	78 21                	js     802f00 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802edf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ee2:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802ee8:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802eea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802eed:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802ef4:	83 ec 0c             	sub    $0xc,%esp
+  802ef7:	50                   	push   %eax
+  802ef8:	e8 4a e0 ff ff       	call   800f47 <fd2num>
+  802efd:	83 c4 10             	add    $0x10,%esp
+}
+  802f00:	c9                   	leave
+  802f01:	c3                   	ret
+
+00802f02 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802f02:	55                   	push   %ebp
+  802f03:	89 e5                	mov    %esp,%ebp
+  802f05:	56                   	push   %esi
+  802f06:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802f07:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802f0a:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802f10:	e8 eb db ff ff       	call   800b00 <sys_getenvid>
+  802f15:	83 ec 0c             	sub    $0xc,%esp
+  802f18:	ff 75 0c             	push   0xc(%ebp)
+  802f1b:	ff 75 08             	push   0x8(%ebp)
+  802f1e:	56                   	push   %esi
+  802f1f:	50                   	push   %eax
+  802f20:	68 3c 3c 80 00       	push   $0x803c3c
+  802f25:	e8 22 d2 ff ff       	call   80014c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802f2a:	83 c4 18             	add    $0x18,%esp
+  802f2d:	53                   	push   %ebx
+  802f2e:	ff 75 10             	push   0x10(%ebp)
+  802f31:	e8 c5 d1 ff ff       	call   8000fb <vcprintf>
+	cprintf("\n");
+  802f36:	c7 04 24 6c 37 80 00 	movl   $0x80376c,(%esp)
+  802f3d:	e8 0a d2 ff ff       	call   80014c <cprintf>
+  802f42:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802f45:	cc                   	int3
+	while (1)
+  802f46:	eb fd                	jmp    802f45 <_panic+0x43>
+
+00802f48 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802f48:	55                   	push   %ebp
+  802f49:	89 e5                	mov    %esp,%ebp
+  802f4b:	57                   	push   %edi
+  802f4c:	56                   	push   %esi
+  802f4d:	53                   	push   %ebx
+  802f4e:	83 ec 20             	sub    $0x20,%esp
+  802f51:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f54:	89 d7                	mov    %edx,%edi
+  802f56:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802f58:	51                   	push   %ecx
+  802f59:	68 00 f0 7f 00       	push   $0x7ff000
+  802f5e:	6a 00                	push   $0x0
+  802f60:	e8 e1 db ff ff       	call   800b46 <sys_page_alloc>
+  802f65:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f67:	83 c4 10             	add    $0x10,%esp
+  802f6a:	85 c0                	test   %eax,%eax
+  802f6c:	78 45                	js     802fb3 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802f6e:	83 ec 04             	sub    $0x4,%esp
+  802f71:	68 00 10 00 00       	push   $0x1000
+  802f76:	57                   	push   %edi
+  802f77:	68 00 f0 7f 00       	push   $0x7ff000
+  802f7c:	e8 3f d9 ff ff       	call   8008c0 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  802f81:	89 34 24             	mov    %esi,(%esp)
+  802f84:	57                   	push   %edi
+  802f85:	ff 75 e4             	push   -0x1c(%ebp)
+  802f88:	68 00 f0 7f 00       	push   $0x7ff000
+  802f8d:	6a 00                	push   $0x0
+  802f8f:	e8 fd db ff ff       	call   800b91 <sys_page_map>
+  802f94:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f96:	83 c4 20             	add    $0x20,%esp
+  802f99:	85 c0                	test   %eax,%eax
+  802f9b:	78 16                	js     802fb3 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802f9d:	83 ec 08             	sub    $0x8,%esp
+  802fa0:	68 00 f0 7f 00       	push   $0x7ff000
+  802fa5:	6a 00                	push   $0x0
+  802fa7:	e8 27 dc ff ff       	call   800bd3 <sys_page_unmap>
+  802fac:	83 c4 10             	add    $0x10,%esp
+  802faf:	85 c0                	test   %eax,%eax
+  802fb1:	75 0a                	jne    802fbd <copy_page_to+0x75>
+exit:
+	return r;
+}
+  802fb3:	89 d8                	mov    %ebx,%eax
+  802fb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fb8:	5b                   	pop    %ebx
+  802fb9:	5e                   	pop    %esi
+  802fba:	5f                   	pop    %edi
+  802fbb:	5d                   	pop    %ebp
+  802fbc:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802fbd:	68 60 3c 80 00       	push   $0x803c60
+  802fc2:	68 80 3b 80 00       	push   $0x803b80
+  802fc7:	6a 1b                	push   $0x1b
+  802fc9:	68 d8 3c 80 00       	push   $0x803cd8
+  802fce:	e8 2f ff ff ff       	call   802f02 <_panic>
+
+00802fd3 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802fd3:	55                   	push   %ebp
+  802fd4:	89 e5                	mov    %esp,%ebp
+  802fd6:	53                   	push   %ebx
+  802fd7:	83 ec 04             	sub    $0x4,%esp
+  802fda:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  802fdd:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802fdf:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  802fe3:	74 21                	je     803006 <pgfault+0x33>
+  802fe5:	89 d0                	mov    %edx,%eax
+  802fe7:	c1 e8 16             	shr    $0x16,%eax
+  802fea:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802ff1:	a8 01                	test   $0x1,%al
+  802ff3:	74 11                	je     803006 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  802ff5:	89 d0                	mov    %edx,%eax
+  802ff7:	c1 e8 0c             	shr    $0xc,%eax
+  802ffa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803001:	f6 c4 08             	test   $0x8,%ah
+  803004:	75 17                	jne    80301d <pgfault+0x4a>
+		if (pgfault_next) {
+  803006:	a1 04 90 80 00       	mov    0x809004,%eax
+  80300b:	85 c0                	test   %eax,%eax
+  80300d:	74 27                	je     803036 <pgfault+0x63>
+			pgfault_next(utf);
+  80300f:	83 ec 0c             	sub    $0xc,%esp
+  803012:	53                   	push   %ebx
+  803013:	ff d0                	call   *%eax
+			return;
+  803015:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803018:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80301b:	c9                   	leave
+  80301c:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  80301d:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803023:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803028:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302d:	e8 16 ff ff ff       	call   802f48 <copy_page_to>
+  803032:	85 c0                	test   %eax,%eax
+  803034:	79 e2                	jns    803018 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803036:	a1 04 50 80 00       	mov    0x805004,%eax
+  80303b:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  80303e:	ff 73 28             	push   0x28(%ebx)
+  803041:	ff 33                	push   (%ebx)
+  803043:	50                   	push   %eax
+  803044:	68 84 3c 80 00       	push   $0x803c84
+  803049:	e8 fe d0 ff ff       	call   80014c <cprintf>
+	sys_env_destroy(0);
+  80304e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803055:	e8 5d da ff ff       	call   800ab7 <sys_env_destroy>
+  80305a:	83 c4 10             	add    $0x10,%esp
+  80305d:	eb b9                	jmp    803018 <pgfault+0x45>
+
+0080305f <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  80305f:	55                   	push   %ebp
+  803060:	89 e5                	mov    %esp,%ebp
+  803062:	53                   	push   %ebx
+  803063:	83 ec 04             	sub    $0x4,%esp
+  803066:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803069:	a1 08 90 80 00       	mov    0x809008,%eax
+  80306e:	3d d3 2f 80 00       	cmp    $0x802fd3,%eax
+  803073:	74 15                	je     80308a <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803075:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  80307a:	83 ec 0c             	sub    $0xc,%esp
+  80307d:	68 d3 2f 80 00       	push   $0x802fd3
+  803082:	e8 fb 03 00 00       	call   803482 <set_pgfault_handler>
+  803087:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80308a:	83 ec 0c             	sub    $0xc,%esp
+  80308d:	68 05 08 00 00       	push   $0x805
+  803092:	53                   	push   %ebx
+  803093:	6a 00                	push   $0x0
+  803095:	53                   	push   %ebx
+  803096:	6a 00                	push   $0x0
+  803098:	e8 f4 da ff ff       	call   800b91 <sys_page_map>
+}
+  80309d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030a0:	c9                   	leave
+  8030a1:	c3                   	ret
+
+008030a2 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8030a2:	55                   	push   %ebp
+  8030a3:	89 e5                	mov    %esp,%ebp
+  8030a5:	57                   	push   %edi
+  8030a6:	56                   	push   %esi
+  8030a7:	53                   	push   %ebx
+  8030a8:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8030ab:	68 d3 2f 80 00       	push   $0x802fd3
+  8030b0:	e8 cd 03 00 00       	call   803482 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8030b5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030ba:	cd 30                	int    $0x30
+  8030bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8030c2:	83 c4 10             	add    $0x10,%esp
+  8030c5:	85 c0                	test   %eax,%eax
+  8030c7:	0f 88 6b 01 00 00    	js     803238 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8030d2:	75 37                	jne    80310b <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8030d4:	e8 27 da ff ff       	call   800b00 <sys_getenvid>
+  8030d9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030de:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8030e4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8030e9:	a3 04 50 80 00       	mov    %eax,0x805004
+		return 0;
+  8030ee:	e9 45 01 00 00       	jmp    803238 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8030f3:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030f9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8030ff:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803105:	0f 87 ba 00 00 00    	ja     8031c5 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  80310b:	89 d8                	mov    %ebx,%eax
+  80310d:	c1 e8 16             	shr    $0x16,%eax
+  803110:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803117:	a8 01                	test   $0x1,%al
+  803119:	74 d8                	je     8030f3 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  80311b:	89 d8                	mov    %ebx,%eax
+  80311d:	c1 e8 0c             	shr    $0xc,%eax
+  803120:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803127:	f6 c2 01             	test   $0x1,%dl
+  80312a:	74 cd                	je     8030f9 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  80312c:	89 da                	mov    %ebx,%edx
+  80312e:	80 e6 df             	and    $0xdf,%dh
+  803131:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803137:	74 c0                	je     8030f9 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803139:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80313b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803142:	f6 c6 04             	test   $0x4,%dh
+  803145:	75 53                	jne    80319a <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803147:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80314e:	f6 c6 08             	test   $0x8,%dh
+  803151:	75 0c                	jne    80315f <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803153:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80315a:	f6 c2 02             	test   $0x2,%dl
+  80315d:	74 3b                	je     80319a <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80315f:	83 ec 0c             	sub    $0xc,%esp
+  803162:	68 05 08 00 00       	push   $0x805
+  803167:	57                   	push   %edi
+  803168:	ff 75 e4             	push   -0x1c(%ebp)
+  80316b:	57                   	push   %edi
+  80316c:	6a 00                	push   $0x0
+  80316e:	e8 1e da ff ff       	call   800b91 <sys_page_map>
+  803173:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803175:	83 c4 20             	add    $0x20,%esp
+  803178:	85 c0                	test   %eax,%eax
+  80317a:	0f 88 a7 00 00 00    	js     803227 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803180:	83 ec 0c             	sub    $0xc,%esp
+  803183:	68 05 08 00 00       	push   $0x805
+  803188:	57                   	push   %edi
+  803189:	6a 00                	push   $0x0
+  80318b:	57                   	push   %edi
+  80318c:	6a 00                	push   $0x0
+  80318e:	e8 fe d9 ff ff       	call   800b91 <sys_page_map>
+  803193:	89 c6                	mov    %eax,%esi
+	return r;
+  803195:	83 c4 20             	add    $0x20,%esp
+  803198:	eb 21                	jmp    8031bb <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  80319a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8031a1:	83 ec 0c             	sub    $0xc,%esp
+  8031a4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8031a9:	50                   	push   %eax
+  8031aa:	57                   	push   %edi
+  8031ab:	ff 75 e4             	push   -0x1c(%ebp)
+  8031ae:	57                   	push   %edi
+  8031af:	6a 00                	push   $0x0
+  8031b1:	e8 db d9 ff ff       	call   800b91 <sys_page_map>
+  8031b6:	89 c6                	mov    %eax,%esi
+  8031b8:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8031bb:	85 f6                	test   %esi,%esi
+  8031bd:	0f 89 36 ff ff ff    	jns    8030f9 <fork+0x57>
+  8031c3:	eb 62                	jmp    803227 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031c5:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031ca:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8031cf:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8031d2:	89 f8                	mov    %edi,%eax
+  8031d4:	e8 6f fd ff ff       	call   802f48 <copy_page_to>
+  8031d9:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031db:	85 c0                	test   %eax,%eax
+  8031dd:	78 48                	js     803227 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031df:	83 ec 04             	sub    $0x4,%esp
+  8031e2:	6a 07                	push   $0x7
+  8031e4:	68 00 f0 bf ee       	push   $0xeebff000
+  8031e9:	57                   	push   %edi
+  8031ea:	e8 57 d9 ff ff       	call   800b46 <sys_page_alloc>
+  8031ef:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031f1:	83 c4 10             	add    $0x10,%esp
+  8031f4:	85 c0                	test   %eax,%eax
+  8031f6:	78 2f                	js     803227 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8031f8:	a1 04 50 80 00       	mov    0x805004,%eax
+  8031fd:	8b 40 64             	mov    0x64(%eax),%eax
+  803200:	83 ec 08             	sub    $0x8,%esp
+  803203:	50                   	push   %eax
+  803204:	57                   	push   %edi
+  803205:	e8 a7 da ff ff       	call   800cb1 <sys_env_set_pgfault_upcall>
+  80320a:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80320c:	83 c4 10             	add    $0x10,%esp
+  80320f:	85 c0                	test   %eax,%eax
+  803211:	78 14                	js     803227 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803213:	83 ec 08             	sub    $0x8,%esp
+  803216:	6a 02                	push   $0x2
+  803218:	57                   	push   %edi
+  803219:	e8 ff d9 ff ff       	call   800c1d <sys_env_set_status>
+  80321e:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803220:	83 c4 10             	add    $0x10,%esp
+  803223:	85 c0                	test   %eax,%eax
+  803225:	79 11                	jns    803238 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803227:	83 ec 0c             	sub    $0xc,%esp
+  80322a:	ff 75 e0             	push   -0x20(%ebp)
+  80322d:	e8 85 d8 ff ff       	call   800ab7 <sys_env_destroy>
+	return r;
+  803232:	83 c4 10             	add    $0x10,%esp
+  803235:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803238:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80323b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80323e:	5b                   	pop    %ebx
+  80323f:	5e                   	pop    %esi
+  803240:	5f                   	pop    %edi
+  803241:	5d                   	pop    %ebp
+  803242:	c3                   	ret
+
+00803243 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803243:	55                   	push   %ebp
+  803244:	89 e5                	mov    %esp,%ebp
+  803246:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803249:	68 e3 3c 80 00       	push   $0x803ce3
+  80324e:	68 bf 00 00 00       	push   $0xbf
+  803253:	68 d8 3c 80 00       	push   $0x803cd8
+  803258:	e8 a5 fc ff ff       	call   802f02 <_panic>
+
+0080325d <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80325d:	55                   	push   %ebp
+  80325e:	89 e5                	mov    %esp,%ebp
+  803260:	56                   	push   %esi
+  803261:	53                   	push   %ebx
+  803262:	8b 75 08             	mov    0x8(%ebp),%esi
+  803265:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803268:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80326b:	85 c0                	test   %eax,%eax
+  80326d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803272:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803275:	83 ec 0c             	sub    $0xc,%esp
+  803278:	50                   	push   %eax
+  803279:	e8 10 db ff ff       	call   800d8e <sys_ipc_recv>
+	if (from_env_store)
+  80327e:	83 c4 10             	add    $0x10,%esp
+  803281:	85 f6                	test   %esi,%esi
+  803283:	74 14                	je     803299 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803285:	ba 00 00 00 00       	mov    $0x0,%edx
+  80328a:	85 c0                	test   %eax,%eax
+  80328c:	75 09                	jne    803297 <ipc_recv+0x3a>
+  80328e:	8b 15 04 50 80 00    	mov    0x805004,%edx
+  803294:	8b 52 74             	mov    0x74(%edx),%edx
+  803297:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803299:	85 db                	test   %ebx,%ebx
+  80329b:	74 25                	je     8032c2 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80329d:	85 c0                	test   %eax,%eax
+  80329f:	74 0d                	je     8032ae <ipc_recv+0x51>
+  8032a1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8032a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032aa:	5b                   	pop    %ebx
+  8032ab:	5e                   	pop    %esi
+  8032ac:	5d                   	pop    %ebp
+  8032ad:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8032ae:	a1 04 50 80 00       	mov    0x805004,%eax
+  8032b3:	8b 40 78             	mov    0x78(%eax),%eax
+  8032b6:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8032b8:	a1 04 50 80 00       	mov    0x805004,%eax
+  8032bd:	8b 40 70             	mov    0x70(%eax),%eax
+  8032c0:	eb e5                	jmp    8032a7 <ipc_recv+0x4a>
+  8032c2:	85 c0                	test   %eax,%eax
+  8032c4:	75 e1                	jne    8032a7 <ipc_recv+0x4a>
+  8032c6:	eb f0                	jmp    8032b8 <ipc_recv+0x5b>
+
+008032c8 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8032c8:	55                   	push   %ebp
+  8032c9:	89 e5                	mov    %esp,%ebp
+  8032cb:	57                   	push   %edi
+  8032cc:	56                   	push   %esi
+  8032cd:	53                   	push   %ebx
+  8032ce:	83 ec 0c             	sub    $0xc,%esp
+  8032d1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032d4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032da:	85 db                	test   %ebx,%ebx
+  8032dc:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032e1:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8032e4:	ff 75 14             	push   0x14(%ebp)
+  8032e7:	53                   	push   %ebx
+  8032e8:	56                   	push   %esi
+  8032e9:	57                   	push   %edi
+  8032ea:	e8 0c da ff ff       	call   800cfb <sys_ipc_try_send>
+  8032ef:	83 c4 10             	add    $0x10,%esp
+  8032f2:	85 c0                	test   %eax,%eax
+  8032f4:	74 22                	je     803318 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8032f6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032f9:	75 07                	jne    803302 <ipc_send+0x3a>
+		sys_yield();
+  8032fb:	e8 27 d8 ff ff       	call   800b27 <sys_yield>
+  803300:	eb e2                	jmp    8032e4 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803302:	68 f9 3c 80 00       	push   $0x803cf9
+  803307:	68 80 3b 80 00       	push   $0x803b80
+  80330c:	6a 39                	push   $0x39
+  80330e:	68 0e 3d 80 00       	push   $0x803d0e
+  803313:	e8 ea fb ff ff       	call   802f02 <_panic>
+	}
+}
+  803318:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80331b:	5b                   	pop    %ebx
+  80331c:	5e                   	pop    %esi
+  80331d:	5f                   	pop    %edi
+  80331e:	5d                   	pop    %ebp
+  80331f:	c3                   	ret
+
+00803320 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803320:	55                   	push   %ebp
+  803321:	89 e5                	mov    %esp,%ebp
+  803323:	57                   	push   %edi
+  803324:	56                   	push   %esi
+  803325:	53                   	push   %ebx
+  803326:	83 ec 10             	sub    $0x10,%esp
+  803329:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80332c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80332f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803332:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803335:	85 c0                	test   %eax,%eax
+  803337:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80333c:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  80333f:	6a 00                	push   $0x0
+  803341:	ff 33                	push   (%ebx)
+  803343:	50                   	push   %eax
+  803344:	e8 02 da ff ff       	call   800d4b <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803349:	83 c4 10             	add    $0x10,%esp
+  80334c:	85 c0                	test   %eax,%eax
+  80334e:	75 3c                	jne    80338c <ipc_recvv+0x6c>
+  803350:	8b 15 04 50 80 00    	mov    0x805004,%edx
+  803356:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803359:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  80335b:	85 ff                	test   %edi,%edi
+  80335d:	74 4e                	je     8033ad <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80335f:	8b 15 04 50 80 00    	mov    0x805004,%edx
+  803365:	8b 52 74             	mov    0x74(%edx),%edx
+  803368:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  80336a:	85 f6                	test   %esi,%esi
+  80336c:	74 18                	je     803386 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80336e:	85 c0                	test   %eax,%eax
+  803370:	75 2d                	jne    80339f <ipc_recvv+0x7f>
+  803372:	a1 04 50 80 00       	mov    0x805004,%eax
+  803377:	8b 40 78             	mov    0x78(%eax),%eax
+  80337a:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  80337c:	a1 04 50 80 00       	mov    0x805004,%eax
+  803381:	8b 40 70             	mov    0x70(%eax),%eax
+  803384:	eb 1f                	jmp    8033a5 <ipc_recvv+0x85>
+  803386:	85 c0                	test   %eax,%eax
+  803388:	75 1b                	jne    8033a5 <ipc_recvv+0x85>
+  80338a:	eb f0                	jmp    80337c <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80338c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803392:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803397:	85 ff                	test   %edi,%edi
+  803399:	75 cd                	jne    803368 <ipc_recvv+0x48>
+	if (perm_store)
+  80339b:	85 f6                	test   %esi,%esi
+  80339d:	74 e7                	je     803386 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80339f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8033a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033a8:	5b                   	pop    %ebx
+  8033a9:	5e                   	pop    %esi
+  8033aa:	5f                   	pop    %edi
+  8033ab:	5d                   	pop    %ebp
+  8033ac:	c3                   	ret
+	if (perm_store)
+  8033ad:	85 f6                	test   %esi,%esi
+  8033af:	75 bd                	jne    80336e <ipc_recvv+0x4e>
+  8033b1:	eb c9                	jmp    80337c <ipc_recvv+0x5c>
+
+008033b3 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8033b3:	55                   	push   %ebp
+  8033b4:	89 e5                	mov    %esp,%ebp
+  8033b6:	57                   	push   %edi
+  8033b7:	56                   	push   %esi
+  8033b8:	53                   	push   %ebx
+  8033b9:	83 ec 0c             	sub    $0xc,%esp
+  8033bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033bf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8033c5:	ff 75 14             	push   0x14(%ebp)
+  8033c8:	53                   	push   %ebx
+  8033c9:	56                   	push   %esi
+  8033ca:	57                   	push   %edi
+  8033cb:	e8 53 d9 ff ff       	call   800d23 <sys_ipc_try_sendv>
+  8033d0:	83 c4 10             	add    $0x10,%esp
+  8033d3:	85 c0                	test   %eax,%eax
+  8033d5:	74 22                	je     8033f9 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8033d7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033da:	75 07                	jne    8033e3 <ipc_sendv+0x30>
+		sys_yield();
+  8033dc:	e8 46 d7 ff ff       	call   800b27 <sys_yield>
+  8033e1:	eb e2                	jmp    8033c5 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8033e3:	68 f9 3c 80 00       	push   $0x803cf9
+  8033e8:	68 80 3b 80 00       	push   $0x803b80
+  8033ed:	6a 5c                	push   $0x5c
+  8033ef:	68 0e 3d 80 00       	push   $0x803d0e
+  8033f4:	e8 09 fb ff ff       	call   802f02 <_panic>
+	}
+}
+  8033f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033fc:	5b                   	pop    %ebx
+  8033fd:	5e                   	pop    %esi
+  8033fe:	5f                   	pop    %edi
+  8033ff:	5d                   	pop    %ebp
+  803400:	c3                   	ret
+
+00803401 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803401:	55                   	push   %ebp
+  803402:	89 e5                	mov    %esp,%ebp
+  803404:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803407:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80340c:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803412:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803418:	8b 52 50             	mov    0x50(%edx),%edx
+  80341b:	39 ca                	cmp    %ecx,%edx
+  80341d:	74 11                	je     803430 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80341f:	83 c0 01             	add    $0x1,%eax
+  803422:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803427:	75 e3                	jne    80340c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803429:	b8 00 00 00 00       	mov    $0x0,%eax
+  80342e:	eb 0e                	jmp    80343e <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803430:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803436:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80343b:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80343e:	5d                   	pop    %ebp
+  80343f:	c3                   	ret
+
+00803440 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803440:	55                   	push   %ebp
+  803441:	89 e5                	mov    %esp,%ebp
+  803443:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803446:	89 c2                	mov    %eax,%edx
+  803448:	c1 ea 16             	shr    $0x16,%edx
+  80344b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803452:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803457:	f6 c1 01             	test   $0x1,%cl
+  80345a:	74 22                	je     80347e <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80345c:	c1 e8 0c             	shr    $0xc,%eax
+  80345f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803466:	a8 01                	test   $0x1,%al
+  803468:	74 14                	je     80347e <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80346a:	c1 e8 0c             	shr    $0xc,%eax
+  80346d:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803470:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803477:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  80347b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80347e:	89 d0                	mov    %edx,%eax
+  803480:	5d                   	pop    %ebp
+  803481:	c3                   	ret
+
+00803482 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803482:	55                   	push   %ebp
+  803483:	89 e5                	mov    %esp,%ebp
+  803485:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803488:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  80348f:	74 0a                	je     80349b <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803491:	8b 45 08             	mov    0x8(%ebp),%eax
+  803494:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  803499:	c9                   	leave
+  80349a:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80349b:	83 ec 04             	sub    $0x4,%esp
+  80349e:	6a 07                	push   $0x7
+  8034a0:	68 00 f0 bf ee       	push   $0xeebff000
+  8034a5:	6a 00                	push   $0x0
+  8034a7:	e8 9a d6 ff ff       	call   800b46 <sys_page_alloc>
+  8034ac:	83 c4 10             	add    $0x10,%esp
+  8034af:	85 c0                	test   %eax,%eax
+  8034b1:	75 2c                	jne    8034df <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8034b3:	83 ec 08             	sub    $0x8,%esp
+  8034b6:	68 f5 34 80 00       	push   $0x8034f5
+  8034bb:	6a 00                	push   $0x0
+  8034bd:	e8 ef d7 ff ff       	call   800cb1 <sys_env_set_pgfault_upcall>
+  8034c2:	83 c4 10             	add    $0x10,%esp
+  8034c5:	85 c0                	test   %eax,%eax
+  8034c7:	74 c8                	je     803491 <set_pgfault_handler+0xf>
+  8034c9:	68 60 3d 80 00       	push   $0x803d60
+  8034ce:	68 80 3b 80 00       	push   $0x803b80
+  8034d3:	6a 20                	push   $0x20
+  8034d5:	68 90 3d 80 00       	push   $0x803d90
+  8034da:	e8 23 fa ff ff       	call   802f02 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034df:	68 18 3d 80 00       	push   $0x803d18
+  8034e4:	68 80 3b 80 00       	push   $0x803b80
+  8034e9:	6a 1e                	push   $0x1e
+  8034eb:	68 90 3d 80 00       	push   $0x803d90
+  8034f0:	e8 0d fa ff ff       	call   802f02 <_panic>
+
+008034f5 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8034f5:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8034f6:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  8034fb:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8034fd:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803500:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803505:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  80350a:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  80350e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803511:	83 c4 08             	add    $0x8,%esp
+	popal
+  803514:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803515:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803518:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803519:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80351a:	c3                   	ret
+
+0080351b <dm>:
+  80351b:	55                   	push   %ebp
+  80351c:	57                   	push   %edi
+  80351d:	56                   	push   %esi
+  80351e:	53                   	push   %ebx
+  80351f:	83 ec 24             	sub    $0x24,%esp
+  803522:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803526:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80352a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80352e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803532:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803536:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80353a:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80353e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803543:	b8 00 00 00 00       	mov    $0x0,%eax
+  803548:	ba 00 00 00 00       	mov    $0x0,%edx
+  80354d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803554:	00 
+  803555:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80355c:	00 
+  80355d:	89 fb                	mov    %edi,%ebx
+  80355f:	eb 08                	jmp    803569 <dm+0x4e>
+  803561:	83 e9 01             	sub    $0x1,%ecx
+  803564:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803567:	74 68                	je     8035d1 <dm+0xb6>
+  803569:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80356d:	01 c0                	add    %eax,%eax
+  80356f:	89 c6                	mov    %eax,%esi
+  803571:	89 d7                	mov    %edx,%edi
+  803573:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803577:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80357b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80357e:	d3 ea                	shr    %cl,%edx
+  803580:	f6 c1 20             	test   $0x20,%cl
+  803583:	74 04                	je     803589 <dm+0x6e>
+  803585:	89 d0                	mov    %edx,%eax
+  803587:	31 d2                	xor    %edx,%edx
+  803589:	83 e0 01             	and    $0x1,%eax
+  80358c:	89 04 24             	mov    %eax,(%esp)
+  80358f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803596:	00 
+  803597:	8b 04 24             	mov    (%esp),%eax
+  80359a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80359e:	09 f0                	or     %esi,%eax
+  8035a0:	09 fa                	or     %edi,%edx
+  8035a2:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8035a6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8035aa:	39 f0                	cmp    %esi,%eax
+  8035ac:	89 d5                	mov    %edx,%ebp
+  8035ae:	19 fd                	sbb    %edi,%ebp
+  8035b0:	72 af                	jb     803561 <dm+0x46>
+  8035b2:	29 f0                	sub    %esi,%eax
+  8035b4:	19 fa                	sbb    %edi,%edx
+  8035b6:	89 cf                	mov    %ecx,%edi
+  8035b8:	c1 ef 05             	shr    $0x5,%edi
+  8035bb:	83 e7 01             	and    $0x1,%edi
+  8035be:	89 fe                	mov    %edi,%esi
+  8035c0:	83 f6 01             	xor    $0x1,%esi
+  8035c3:	d3 e6                	shl    %cl,%esi
+  8035c5:	d3 e7                	shl    %cl,%edi
+  8035c7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8035cb:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8035cf:	eb 90                	jmp    803561 <dm+0x46>
+  8035d1:	85 db                	test   %ebx,%ebx
+  8035d3:	74 05                	je     8035da <dm+0xbf>
+  8035d5:	89 03                	mov    %eax,(%ebx)
+  8035d7:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035da:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035de:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035e2:	83 c4 24             	add    $0x24,%esp
+  8035e5:	5b                   	pop    %ebx
+  8035e6:	5e                   	pop    %esi
+  8035e7:	5f                   	pop    %edi
+  8035e8:	5d                   	pop    %ebp
+  8035e9:	c3                   	ret
+
+008035ea <__udivdi3>:
+  8035ea:	83 ec 08             	sub    $0x8,%esp
+  8035ed:	6a 00                	push   $0x0
+  8035ef:	ff 74 24 1c          	push   0x1c(%esp)
+  8035f3:	ff 74 24 1c          	push   0x1c(%esp)
+  8035f7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035fb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035ff:	e8 17 ff ff ff       	call   80351b <dm>
+  803604:	83 c4 14             	add    $0x14,%esp
+  803607:	c3                   	ret
+
+00803608 <__umoddi3>:
+  803608:	83 ec 18             	sub    $0x18,%esp
+  80360b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80360f:	50                   	push   %eax
+  803610:	ff 74 24 2c          	push   0x2c(%esp)
+  803614:	ff 74 24 2c          	push   0x2c(%esp)
+  803618:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80361c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803620:	e8 f6 fe ff ff       	call   80351b <dm>
+  803625:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803629:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80362d:	83 c4 24             	add    $0x24,%esp
+  803630:	c3                   	ret
+
+00803631 <__divdi3>:
+  803631:	53                   	push   %ebx
+  803632:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803636:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80363a:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80363e:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803642:	85 d2                	test   %edx,%edx
+  803644:	78 15                	js     80365b <__divdi3+0x2a>
+  803646:	85 db                	test   %ebx,%ebx
+  803648:	78 34                	js     80367e <__divdi3+0x4d>
+  80364a:	83 ec 04             	sub    $0x4,%esp
+  80364d:	6a 00                	push   $0x0
+  80364f:	53                   	push   %ebx
+  803650:	51                   	push   %ecx
+  803651:	e8 c5 fe ff ff       	call   80351b <dm>
+  803656:	83 c4 10             	add    $0x10,%esp
+  803659:	eb 21                	jmp    80367c <__divdi3+0x4b>
+  80365b:	f7 d8                	neg    %eax
+  80365d:	83 d2 00             	adc    $0x0,%edx
+  803660:	f7 da                	neg    %edx
+  803662:	85 db                	test   %ebx,%ebx
+  803664:	78 30                	js     803696 <__divdi3+0x65>
+  803666:	83 ec 04             	sub    $0x4,%esp
+  803669:	6a 00                	push   $0x0
+  80366b:	53                   	push   %ebx
+  80366c:	51                   	push   %ecx
+  80366d:	e8 a9 fe ff ff       	call   80351b <dm>
+  803672:	83 c4 10             	add    $0x10,%esp
+  803675:	f7 d8                	neg    %eax
+  803677:	83 d2 00             	adc    $0x0,%edx
+  80367a:	f7 da                	neg    %edx
+  80367c:	5b                   	pop    %ebx
+  80367d:	c3                   	ret
+  80367e:	83 ec 04             	sub    $0x4,%esp
+  803681:	6a 00                	push   $0x0
+  803683:	f7 d9                	neg    %ecx
+  803685:	83 d3 00             	adc    $0x0,%ebx
+  803688:	f7 db                	neg    %ebx
+  80368a:	53                   	push   %ebx
+  80368b:	51                   	push   %ecx
+  80368c:	e8 8a fe ff ff       	call   80351b <dm>
+  803691:	83 c4 10             	add    $0x10,%esp
+  803694:	eb df                	jmp    803675 <__divdi3+0x44>
+  803696:	83 ec 04             	sub    $0x4,%esp
+  803699:	6a 00                	push   $0x0
+  80369b:	f7 d9                	neg    %ecx
+  80369d:	83 d3 00             	adc    $0x0,%ebx
+  8036a0:	f7 db                	neg    %ebx
+  8036a2:	53                   	push   %ebx
+  8036a3:	51                   	push   %ecx
+  8036a4:	e8 72 fe ff ff       	call   80351b <dm>
+  8036a9:	83 c4 10             	add    $0x10,%esp
+  8036ac:	eb ce                	jmp    80367c <__divdi3+0x4b>
+
+008036ae <__moddi3>:
+  8036ae:	55                   	push   %ebp
+  8036af:	57                   	push   %edi
+  8036b0:	56                   	push   %esi
+  8036b1:	53                   	push   %ebx
+  8036b2:	83 ec 24             	sub    $0x24,%esp
+  8036b5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036b9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036bd:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036c1:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036c5:	85 d2                	test   %edx,%edx
+  8036c7:	78 3b                	js     803704 <__moddi3+0x56>
+  8036c9:	83 ec 04             	sub    $0x4,%esp
+  8036cc:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036d0:	56                   	push   %esi
+  8036d1:	89 ce                	mov    %ecx,%esi
+  8036d3:	f7 de                	neg    %esi
+  8036d5:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8036d9:	89 de                	mov    %ebx,%esi
+  8036db:	83 d6 00             	adc    $0x0,%esi
+  8036de:	f7 de                	neg    %esi
+  8036e0:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8036e4:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8036e8:	0f 48 f1             	cmovs  %ecx,%esi
+  8036eb:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8036f0:	53                   	push   %ebx
+  8036f1:	56                   	push   %esi
+  8036f2:	e8 24 fe ff ff       	call   80351b <dm>
+  8036f7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036fb:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036ff:	83 c4 10             	add    $0x10,%esp
+  803702:	eb 47                	jmp    80374b <__moddi3+0x9d>
+  803704:	f7 d8                	neg    %eax
+  803706:	83 d2 00             	adc    $0x0,%edx
+  803709:	f7 da                	neg    %edx
+  80370b:	83 ec 04             	sub    $0x4,%esp
+  80370e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803712:	56                   	push   %esi
+  803713:	89 cf                	mov    %ecx,%edi
+  803715:	f7 df                	neg    %edi
+  803717:	89 de                	mov    %ebx,%esi
+  803719:	83 d6 00             	adc    $0x0,%esi
+  80371c:	f7 de                	neg    %esi
+  80371e:	0f 49 cf             	cmovns %edi,%ecx
+  803721:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803725:	0f 49 de             	cmovns %esi,%ebx
+  803728:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80372c:	ff 74 24 0c          	push   0xc(%esp)
+  803730:	ff 74 24 0c          	push   0xc(%esp)
+  803734:	e8 e2 fd ff ff       	call   80351b <dm>
+  803739:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80373d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803741:	f7 d8                	neg    %eax
+  803743:	83 d2 00             	adc    $0x0,%edx
+  803746:	f7 da                	neg    %edx
+  803748:	83 c4 10             	add    $0x10,%esp
+  80374b:	83 c4 24             	add    $0x24,%esp
+  80374e:	5b                   	pop    %ebx
+  80374f:	5e                   	pop    %esi
+  803750:	5f                   	pop    %edi
+  803751:	5d                   	pop    %ebp
+  803752:	c3                   	ret
@@ -0,0 +1,7823 @@
+
+obj/user/dumbfork.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9d 01 00 00       	call   8001ce <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <duppage>:
+	}
+}
+
+void
+duppage(envid_t dstenv, void *addr)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	// This is NOT what you should do in your fork.
+	if ((r = sys_page_alloc(dstenv, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  80003e:	83 ec 04             	sub    $0x4,%esp
+  800041:	6a 07                	push   $0x7
+  800043:	53                   	push   %ebx
+  800044:	56                   	push   %esi
+  800045:	e8 bc 0c 00 00       	call   800d06 <sys_page_alloc>
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	78 4a                	js     80009b <duppage+0x68>
+		panic("sys_page_alloc: %e", r);
+	if ((r = sys_page_map(dstenv, addr, 0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  800051:	83 ec 0c             	sub    $0xc,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 40 00       	push   $0x400000
+  80005b:	6a 00                	push   $0x0
+  80005d:	53                   	push   %ebx
+  80005e:	56                   	push   %esi
+  80005f:	e8 ed 0c 00 00       	call   800d51 <sys_page_map>
+  800064:	83 c4 20             	add    $0x20,%esp
+  800067:	85 c0                	test   %eax,%eax
+  800069:	78 42                	js     8000ad <duppage+0x7a>
+		panic("sys_page_map: %e", r);
+	memmove(UTEMP, addr, PGSIZE);
+  80006b:	83 ec 04             	sub    $0x4,%esp
+  80006e:	68 00 10 00 00       	push   $0x1000
+  800073:	53                   	push   %ebx
+  800074:	68 00 00 40 00       	push   $0x400000
+  800079:	e8 02 0a 00 00       	call   800a80 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80007e:	83 c4 08             	add    $0x8,%esp
+  800081:	68 00 00 40 00       	push   $0x400000
+  800086:	6a 00                	push   $0x0
+  800088:	e8 06 0d 00 00       	call   800d93 <sys_page_unmap>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	85 c0                	test   %eax,%eax
+  800092:	78 2b                	js     8000bf <duppage+0x8c>
+		panic("sys_page_unmap: %e", r);
+}
+  800094:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800097:	5b                   	pop    %ebx
+  800098:	5e                   	pop    %esi
+  800099:	5d                   	pop    %ebp
+  80009a:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  80009b:	50                   	push   %eax
+  80009c:	68 e0 38 80 00       	push   $0x8038e0
+  8000a1:	6a 20                	push   $0x20
+  8000a3:	68 f3 38 80 00       	push   $0x8038f3
+  8000a8:	e8 84 01 00 00       	call   800231 <_panic>
+		panic("sys_page_map: %e", r);
+  8000ad:	50                   	push   %eax
+  8000ae:	68 03 39 80 00       	push   $0x803903
+  8000b3:	6a 22                	push   $0x22
+  8000b5:	68 f3 38 80 00       	push   $0x8038f3
+  8000ba:	e8 72 01 00 00       	call   800231 <_panic>
+		panic("sys_page_unmap: %e", r);
+  8000bf:	50                   	push   %eax
+  8000c0:	68 14 39 80 00       	push   $0x803914
+  8000c5:	6a 25                	push   $0x25
+  8000c7:	68 f3 38 80 00       	push   $0x8038f3
+  8000cc:	e8 60 01 00 00       	call   800231 <_panic>
+
+008000d1 <dumbfork>:
+
+envid_t
+dumbfork(void)
+{
+  8000d1:	55                   	push   %ebp
+  8000d2:	89 e5                	mov    %esp,%ebp
+  8000d4:	53                   	push   %ebx
+  8000d5:	83 ec 14             	sub    $0x14,%esp
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8000d8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8000dd:	cd 30                	int    $0x30
+  8000df:	89 c3                	mov    %eax,%ebx
+	// The kernel will initialize it with a copy of our register state,
+	// so that the child will appear to have called sys_exofork() too -
+	// except that in the child, this "fake" call to sys_exofork()
+	// will return 0 instead of the envid of the child.
+	envid = sys_exofork();
+	if (envid < 0)
+  8000e1:	85 c0                	test   %eax,%eax
+  8000e3:	78 23                	js     800108 <dumbfork+0x37>
+		panic("sys_exofork: %e", envid);
+	if (envid == 0) {
+  8000e5:	ba 00 00 80 00       	mov    $0x800000,%edx
+  8000ea:	75 44                	jne    800130 <dumbfork+0x5f>
+		// We're the child.
+		// The copied value of the global variable 'thisenv'
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8000ec:	e8 cf 0b 00 00       	call   800cc0 <sys_getenvid>
+  8000f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f6:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8000fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800101:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  800106:	eb 57                	jmp    80015f <dumbfork+0x8e>
+		panic("sys_exofork: %e", envid);
+  800108:	50                   	push   %eax
+  800109:	68 27 39 80 00       	push   $0x803927
+  80010e:	6a 37                	push   $0x37
+  800110:	68 f3 38 80 00       	push   $0x8038f3
+  800115:	e8 17 01 00 00       	call   800231 <_panic>
+
+	// We're the parent.
+	// Eagerly copy our entire address space into the child.
+	// This is NOT what you should do in your fork implementation.
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+		duppage(envid, addr);
+  80011a:	83 ec 08             	sub    $0x8,%esp
+  80011d:	52                   	push   %edx
+  80011e:	53                   	push   %ebx
+  80011f:	e8 0f ff ff ff       	call   800033 <duppage>
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+  800124:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800127:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80012d:	83 c4 10             	add    $0x10,%esp
+  800130:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  800133:	81 fa 0c 90 80 00    	cmp    $0x80900c,%edx
+  800139:	72 df                	jb     80011a <dumbfork+0x49>
+
+	// Also copy the stack we are currently running on.
+	duppage(envid, ROUNDDOWN(&addr, PGSIZE));
+  80013b:	83 ec 08             	sub    $0x8,%esp
+  80013e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800141:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800146:	50                   	push   %eax
+  800147:	53                   	push   %ebx
+  800148:	e8 e6 fe ff ff       	call   800033 <duppage>
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80014d:	83 c4 08             	add    $0x8,%esp
+  800150:	6a 02                	push   $0x2
+  800152:	53                   	push   %ebx
+  800153:	e8 85 0c 00 00       	call   800ddd <sys_env_set_status>
+  800158:	83 c4 10             	add    $0x10,%esp
+  80015b:	85 c0                	test   %eax,%eax
+  80015d:	78 07                	js     800166 <dumbfork+0x95>
+		panic("sys_env_set_status: %e", r);
+
+	return envid;
+}
+  80015f:	89 d8                	mov    %ebx,%eax
+  800161:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+		panic("sys_env_set_status: %e", r);
+  800166:	50                   	push   %eax
+  800167:	68 37 39 80 00       	push   $0x803937
+  80016c:	6a 4c                	push   $0x4c
+  80016e:	68 f3 38 80 00       	push   $0x8038f3
+  800173:	e8 b9 00 00 00       	call   800231 <_panic>
+
+00800178 <umain>:
+{
+  800178:	55                   	push   %ebp
+  800179:	89 e5                	mov    %esp,%ebp
+  80017b:	57                   	push   %edi
+  80017c:	56                   	push   %esi
+  80017d:	53                   	push   %ebx
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+	who = dumbfork();
+  800181:	e8 4b ff ff ff       	call   8000d1 <dumbfork>
+  800186:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  800188:	85 c0                	test   %eax,%eax
+  80018a:	bf 4e 39 80 00       	mov    $0x80394e,%edi
+  80018f:	b8 55 39 80 00       	mov    $0x803955,%eax
+  800194:	0f 44 f8             	cmove  %eax,%edi
+  800197:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80019c:	eb 1f                	jmp    8001bd <umain+0x45>
+  80019e:	83 fb 13             	cmp    $0x13,%ebx
+  8001a1:	7f 23                	jg     8001c6 <umain+0x4e>
+		cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  8001a3:	83 ec 04             	sub    $0x4,%esp
+  8001a6:	57                   	push   %edi
+  8001a7:	53                   	push   %ebx
+  8001a8:	68 5b 39 80 00       	push   $0x80395b
+  8001ad:	e8 5a 01 00 00       	call   80030c <cprintf>
+		sys_yield();
+  8001b2:	e8 30 0b 00 00       	call   800ce7 <sys_yield>
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  8001b7:	83 c3 01             	add    $0x1,%ebx
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	85 f6                	test   %esi,%esi
+  8001bf:	74 dd                	je     80019e <umain+0x26>
+  8001c1:	83 fb 09             	cmp    $0x9,%ebx
+  8001c4:	7e dd                	jle    8001a3 <umain+0x2b>
+}
+  8001c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c9:	5b                   	pop    %ebx
+  8001ca:	5e                   	pop    %esi
+  8001cb:	5f                   	pop    %edi
+  8001cc:	5d                   	pop    %ebp
+  8001cd:	c3                   	ret
+
+008001ce <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ce:	55                   	push   %ebp
+  8001cf:	89 e5                	mov    %esp,%ebp
+  8001d1:	56                   	push   %esi
+  8001d2:	53                   	push   %ebx
+  8001d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001d9:	e8 e2 0a 00 00       	call   800cc0 <sys_getenvid>
+  8001de:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001e3:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8001e9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001ee:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001f3:	85 db                	test   %ebx,%ebx
+  8001f5:	7e 07                	jle    8001fe <libmain+0x30>
+		binaryname = argv[0];
+  8001f7:	8b 06                	mov    (%esi),%eax
+  8001f9:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8001fe:	83 ec 08             	sub    $0x8,%esp
+  800201:	56                   	push   %esi
+  800202:	53                   	push   %ebx
+  800203:	e8 70 ff ff ff       	call   800178 <umain>
+
+	// exit gracefully
+	exit();
+  800208:	e8 0a 00 00 00       	call   800217 <exit>
+}
+  80020d:	83 c4 10             	add    $0x10,%esp
+  800210:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800213:	5b                   	pop    %ebx
+  800214:	5e                   	pop    %esi
+  800215:	5d                   	pop    %ebp
+  800216:	c3                   	ret
+
+00800217 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800217:	55                   	push   %ebp
+  800218:	89 e5                	mov    %esp,%ebp
+  80021a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80021d:	e8 b9 10 00 00       	call   8012db <close_all>
+	sys_env_destroy(0);
+  800222:	83 ec 0c             	sub    $0xc,%esp
+  800225:	6a 00                	push   $0x0
+  800227:	e8 4b 0a 00 00       	call   800c77 <sys_env_destroy>
+}
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	c9                   	leave
+  800230:	c3                   	ret
+
+00800231 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800231:	55                   	push   %ebp
+  800232:	89 e5                	mov    %esp,%ebp
+  800234:	56                   	push   %esi
+  800235:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800236:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800239:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80023f:	e8 7c 0a 00 00       	call   800cc0 <sys_getenvid>
+  800244:	83 ec 0c             	sub    $0xc,%esp
+  800247:	ff 75 0c             	push   0xc(%ebp)
+  80024a:	ff 75 08             	push   0x8(%ebp)
+  80024d:	56                   	push   %esi
+  80024e:	50                   	push   %eax
+  80024f:	68 78 39 80 00       	push   $0x803978
+  800254:	e8 b3 00 00 00       	call   80030c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800259:	83 c4 18             	add    $0x18,%esp
+  80025c:	53                   	push   %ebx
+  80025d:	ff 75 10             	push   0x10(%ebp)
+  800260:	e8 56 00 00 00       	call   8002bb <vcprintf>
+	cprintf("\n");
+  800265:	c7 04 24 6b 39 80 00 	movl   $0x80396b,(%esp)
+  80026c:	e8 9b 00 00 00       	call   80030c <cprintf>
+  800271:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800274:	cc                   	int3
+	while (1)
+  800275:	eb fd                	jmp    800274 <_panic+0x43>
+
+00800277 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800277:	55                   	push   %ebp
+  800278:	89 e5                	mov    %esp,%ebp
+  80027a:	53                   	push   %ebx
+  80027b:	83 ec 04             	sub    $0x4,%esp
+  80027e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800281:	8b 13                	mov    (%ebx),%edx
+  800283:	8d 42 01             	lea    0x1(%edx),%eax
+  800286:	89 03                	mov    %eax,(%ebx)
+  800288:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80028b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80028f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800294:	74 09                	je     80029f <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800296:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80029a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80029d:	c9                   	leave
+  80029e:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80029f:	83 ec 08             	sub    $0x8,%esp
+  8002a2:	68 ff 00 00 00       	push   $0xff
+  8002a7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002aa:	50                   	push   %eax
+  8002ab:	e8 7a 09 00 00       	call   800c2a <sys_cputs>
+		b->idx = 0;
+  8002b0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002b6:	83 c4 10             	add    $0x10,%esp
+  8002b9:	eb db                	jmp    800296 <putch+0x1f>
+
+008002bb <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002bb:	55                   	push   %ebp
+  8002bc:	89 e5                	mov    %esp,%ebp
+  8002be:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002c4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002cb:	00 00 00 
+	b.cnt = 0;
+  8002ce:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002d5:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002d8:	ff 75 0c             	push   0xc(%ebp)
+  8002db:	ff 75 08             	push   0x8(%ebp)
+  8002de:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002e4:	50                   	push   %eax
+  8002e5:	68 77 02 80 00       	push   $0x800277
+  8002ea:	e8 14 01 00 00       	call   800403 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002ef:	83 c4 08             	add    $0x8,%esp
+  8002f2:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002f8:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002fe:	50                   	push   %eax
+  8002ff:	e8 26 09 00 00       	call   800c2a <sys_cputs>
+
+	return b.cnt;
+}
+  800304:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80030a:	c9                   	leave
+  80030b:	c3                   	ret
+
+0080030c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80030c:	55                   	push   %ebp
+  80030d:	89 e5                	mov    %esp,%ebp
+  80030f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800312:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800315:	50                   	push   %eax
+  800316:	ff 75 08             	push   0x8(%ebp)
+  800319:	e8 9d ff ff ff       	call   8002bb <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80031e:	c9                   	leave
+  80031f:	c3                   	ret
+
+00800320 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800320:	55                   	push   %ebp
+  800321:	89 e5                	mov    %esp,%ebp
+  800323:	57                   	push   %edi
+  800324:	56                   	push   %esi
+  800325:	53                   	push   %ebx
+  800326:	83 ec 1c             	sub    $0x1c,%esp
+  800329:	89 c7                	mov    %eax,%edi
+  80032b:	89 d6                	mov    %edx,%esi
+  80032d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800330:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800333:	89 d1                	mov    %edx,%ecx
+  800335:	89 c2                	mov    %eax,%edx
+  800337:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80033a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80033d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800340:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800343:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800346:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80034d:	39 c2                	cmp    %eax,%edx
+  80034f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800352:	72 3e                	jb     800392 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800354:	83 ec 0c             	sub    $0xc,%esp
+  800357:	ff 75 18             	push   0x18(%ebp)
+  80035a:	83 eb 01             	sub    $0x1,%ebx
+  80035d:	53                   	push   %ebx
+  80035e:	50                   	push   %eax
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	ff 75 e4             	push   -0x1c(%ebp)
+  800365:	ff 75 e0             	push   -0x20(%ebp)
+  800368:	ff 75 dc             	push   -0x24(%ebp)
+  80036b:	ff 75 d8             	push   -0x28(%ebp)
+  80036e:	e8 f1 33 00 00       	call   803764 <__udivdi3>
+  800373:	83 c4 18             	add    $0x18,%esp
+  800376:	52                   	push   %edx
+  800377:	50                   	push   %eax
+  800378:	89 f2                	mov    %esi,%edx
+  80037a:	89 f8                	mov    %edi,%eax
+  80037c:	e8 9f ff ff ff       	call   800320 <printnum>
+  800381:	83 c4 20             	add    $0x20,%esp
+  800384:	eb 13                	jmp    800399 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800386:	83 ec 08             	sub    $0x8,%esp
+  800389:	56                   	push   %esi
+  80038a:	ff 75 18             	push   0x18(%ebp)
+  80038d:	ff d7                	call   *%edi
+  80038f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800392:	83 eb 01             	sub    $0x1,%ebx
+  800395:	85 db                	test   %ebx,%ebx
+  800397:	7f ed                	jg     800386 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800399:	83 ec 08             	sub    $0x8,%esp
+  80039c:	56                   	push   %esi
+  80039d:	83 ec 04             	sub    $0x4,%esp
+  8003a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a3:	ff 75 e0             	push   -0x20(%ebp)
+  8003a6:	ff 75 dc             	push   -0x24(%ebp)
+  8003a9:	ff 75 d8             	push   -0x28(%ebp)
+  8003ac:	e8 d1 33 00 00       	call   803782 <__umoddi3>
+  8003b1:	83 c4 14             	add    $0x14,%esp
+  8003b4:	0f be 80 9b 39 80 00 	movsbl 0x80399b(%eax),%eax
+  8003bb:	50                   	push   %eax
+  8003bc:	ff d7                	call   *%edi
+}
+  8003be:	83 c4 10             	add    $0x10,%esp
+  8003c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c4:	5b                   	pop    %ebx
+  8003c5:	5e                   	pop    %esi
+  8003c6:	5f                   	pop    %edi
+  8003c7:	5d                   	pop    %ebp
+  8003c8:	c3                   	ret
+
+008003c9 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003c9:	55                   	push   %ebp
+  8003ca:	89 e5                	mov    %esp,%ebp
+  8003cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003cf:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003d3:	8b 10                	mov    (%eax),%edx
+  8003d5:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003d8:	73 0a                	jae    8003e4 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003da:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003dd:	89 08                	mov    %ecx,(%eax)
+  8003df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003e2:	88 02                	mov    %al,(%edx)
+}
+  8003e4:	5d                   	pop    %ebp
+  8003e5:	c3                   	ret
+
+008003e6 <printfmt>:
+{
+  8003e6:	55                   	push   %ebp
+  8003e7:	89 e5                	mov    %esp,%ebp
+  8003e9:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003ec:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003ef:	50                   	push   %eax
+  8003f0:	ff 75 10             	push   0x10(%ebp)
+  8003f3:	ff 75 0c             	push   0xc(%ebp)
+  8003f6:	ff 75 08             	push   0x8(%ebp)
+  8003f9:	e8 05 00 00 00       	call   800403 <vprintfmt>
+}
+  8003fe:	83 c4 10             	add    $0x10,%esp
+  800401:	c9                   	leave
+  800402:	c3                   	ret
+
+00800403 <vprintfmt>:
+{
+  800403:	55                   	push   %ebp
+  800404:	89 e5                	mov    %esp,%ebp
+  800406:	57                   	push   %edi
+  800407:	56                   	push   %esi
+  800408:	53                   	push   %ebx
+  800409:	83 ec 2c             	sub    $0x2c,%esp
+  80040c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80040f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800412:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800415:	eb 0a                	jmp    800421 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800417:	83 ec 08             	sub    $0x8,%esp
+  80041a:	53                   	push   %ebx
+  80041b:	50                   	push   %eax
+  80041c:	ff d6                	call   *%esi
+  80041e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800421:	83 c7 01             	add    $0x1,%edi
+  800424:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800428:	83 f8 25             	cmp    $0x25,%eax
+  80042b:	74 0c                	je     800439 <vprintfmt+0x36>
+			if (ch == '\0')
+  80042d:	85 c0                	test   %eax,%eax
+  80042f:	75 e6                	jne    800417 <vprintfmt+0x14>
+}
+  800431:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800434:	5b                   	pop    %ebx
+  800435:	5e                   	pop    %esi
+  800436:	5f                   	pop    %edi
+  800437:	5d                   	pop    %ebp
+  800438:	c3                   	ret
+		padc = ' ';
+  800439:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80043d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800444:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80044b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800452:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800457:	8d 47 01             	lea    0x1(%edi),%eax
+  80045a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80045d:	0f b6 17             	movzbl (%edi),%edx
+  800460:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800463:	3c 55                	cmp    $0x55,%al
+  800465:	0f 87 cf 03 00 00    	ja     80083a <vprintfmt+0x437>
+  80046b:	0f b6 c0             	movzbl %al,%eax
+  80046e:	ff 24 85 00 3b 80 00 	jmp    *0x803b00(,%eax,4)
+  800475:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800478:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80047c:	eb d9                	jmp    800457 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800481:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800485:	eb d0                	jmp    800457 <vprintfmt+0x54>
+  800487:	0f b6 d2             	movzbl %dl,%edx
+  80048a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80048d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800492:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800495:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800498:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80049c:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80049f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004a2:	83 f9 09             	cmp    $0x9,%ecx
+  8004a5:	77 55                	ja     8004fc <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004a7:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004aa:	eb e9                	jmp    800495 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004af:	8b 00                	mov    (%eax),%eax
+  8004b1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8004ba:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004c0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c4:	79 91                	jns    800457 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004c6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004cc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004d3:	eb 82                	jmp    800457 <vprintfmt+0x54>
+			if (width < 0)
+  8004d5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d8:	85 d2                	test   %edx,%edx
+  8004da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004df:	0f 49 c2             	cmovns %edx,%eax
+  8004e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004e8:	e9 6a ff ff ff       	jmp    800457 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004f0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004f7:	e9 5b ff ff ff       	jmp    800457 <vprintfmt+0x54>
+  8004fc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004ff:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800502:	eb bc                	jmp    8004c0 <vprintfmt+0xbd>
+			lflag++;
+  800504:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800507:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80050a:	e9 48 ff ff ff       	jmp    800457 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80050f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800512:	8d 78 04             	lea    0x4(%eax),%edi
+  800515:	83 ec 08             	sub    $0x8,%esp
+  800518:	53                   	push   %ebx
+  800519:	ff 30                	push   (%eax)
+  80051b:	ff d6                	call   *%esi
+			break;
+  80051d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800520:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800523:	e9 b1 02 00 00       	jmp    8007d9 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80052e:	8b 10                	mov    (%eax),%edx
+  800530:	89 d0                	mov    %edx,%eax
+  800532:	f7 d8                	neg    %eax
+  800534:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800537:	83 f8 11             	cmp    $0x11,%eax
+  80053a:	7f 23                	jg     80055f <vprintfmt+0x15c>
+  80053c:	8b 14 85 60 3c 80 00 	mov    0x803c60(,%eax,4),%edx
+  800543:	85 d2                	test   %edx,%edx
+  800545:	74 18                	je     80055f <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800547:	52                   	push   %edx
+  800548:	68 b2 3d 80 00       	push   $0x803db2
+  80054d:	53                   	push   %ebx
+  80054e:	56                   	push   %esi
+  80054f:	e8 92 fe ff ff       	call   8003e6 <printfmt>
+  800554:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800557:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80055a:	e9 7a 02 00 00       	jmp    8007d9 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80055f:	50                   	push   %eax
+  800560:	68 b3 39 80 00       	push   $0x8039b3
+  800565:	53                   	push   %ebx
+  800566:	56                   	push   %esi
+  800567:	e8 7a fe ff ff       	call   8003e6 <printfmt>
+  80056c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80056f:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800572:	e9 62 02 00 00       	jmp    8007d9 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800577:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057a:	83 c0 04             	add    $0x4,%eax
+  80057d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800580:	8b 45 14             	mov    0x14(%ebp),%eax
+  800583:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800585:	85 c9                	test   %ecx,%ecx
+  800587:	b8 ac 39 80 00       	mov    $0x8039ac,%eax
+  80058c:	0f 45 c1             	cmovne %ecx,%eax
+  80058f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800592:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800596:	7e 06                	jle    80059e <vprintfmt+0x19b>
+  800598:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80059c:	75 0b                	jne    8005a9 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005a1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005a4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005a7:	eb 5c                	jmp    800605 <vprintfmt+0x202>
+  8005a9:	83 ec 08             	sub    $0x8,%esp
+  8005ac:	ff 75 d0             	push   -0x30(%ebp)
+  8005af:	ff 75 cc             	push   -0x34(%ebp)
+  8005b2:	e8 20 03 00 00       	call   8008d7 <strnlen>
+  8005b7:	89 c2                	mov    %eax,%edx
+  8005b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005bc:	29 d0                	sub    %edx,%eax
+  8005be:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005c1:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005cb:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005cd:	eb 0e                	jmp    8005dd <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005cf:	83 ec 08             	sub    $0x8,%esp
+  8005d2:	53                   	push   %ebx
+  8005d3:	57                   	push   %edi
+  8005d4:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d7:	83 ee 01             	sub    $0x1,%esi
+  8005da:	83 c4 10             	add    $0x10,%esp
+  8005dd:	85 f6                	test   %esi,%esi
+  8005df:	7f ee                	jg     8005cf <vprintfmt+0x1cc>
+  8005e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e7:	85 c0                	test   %eax,%eax
+  8005e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ee:	0f 49 d0             	cmovns %eax,%edx
+  8005f1:	29 d0                	sub    %edx,%eax
+  8005f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f6:	eb a6                	jmp    80059e <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005f8:	83 ec 08             	sub    $0x8,%esp
+  8005fb:	53                   	push   %ebx
+  8005fc:	52                   	push   %edx
+  8005fd:	ff 55 08             	call   *0x8(%ebp)
+  800600:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800603:	89 f1                	mov    %esi,%ecx
+  800605:	8d 71 01             	lea    0x1(%ecx),%esi
+  800608:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80060c:	0f be d0             	movsbl %al,%edx
+  80060f:	85 d2                	test   %edx,%edx
+  800611:	74 28                	je     80063b <vprintfmt+0x238>
+  800613:	85 ff                	test   %edi,%edi
+  800615:	78 05                	js     80061c <vprintfmt+0x219>
+  800617:	83 ef 01             	sub    $0x1,%edi
+  80061a:	78 30                	js     80064c <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80061c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800620:	74 d6                	je     8005f8 <vprintfmt+0x1f5>
+  800622:	0f be c0             	movsbl %al,%eax
+  800625:	83 e8 20             	sub    $0x20,%eax
+  800628:	83 f8 5e             	cmp    $0x5e,%eax
+  80062b:	76 cb                	jbe    8005f8 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80062d:	83 ec 08             	sub    $0x8,%esp
+  800630:	53                   	push   %ebx
+  800631:	6a 3f                	push   $0x3f
+  800633:	ff 55 08             	call   *0x8(%ebp)
+  800636:	83 c4 10             	add    $0x10,%esp
+  800639:	eb c8                	jmp    800603 <vprintfmt+0x200>
+  80063b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80063e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800641:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800644:	01 d0                	add    %edx,%eax
+  800646:	29 c8                	sub    %ecx,%eax
+  800648:	89 c7                	mov    %eax,%edi
+  80064a:	eb 13                	jmp    80065f <vprintfmt+0x25c>
+  80064c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064f:	eb ed                	jmp    80063e <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800651:	83 ec 08             	sub    $0x8,%esp
+  800654:	53                   	push   %ebx
+  800655:	6a 20                	push   $0x20
+  800657:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800659:	83 ef 01             	sub    $0x1,%edi
+  80065c:	83 c4 10             	add    $0x10,%esp
+  80065f:	85 ff                	test   %edi,%edi
+  800661:	7f ee                	jg     800651 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800663:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800666:	89 45 14             	mov    %eax,0x14(%ebp)
+  800669:	e9 6b 01 00 00       	jmp    8007d9 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80066e:	83 f9 01             	cmp    $0x1,%ecx
+  800671:	7f 1f                	jg     800692 <vprintfmt+0x28f>
+	else if (lflag)
+  800673:	85 c9                	test   %ecx,%ecx
+  800675:	74 67                	je     8006de <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067a:	8b 00                	mov    (%eax),%eax
+  80067c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067f:	89 c1                	mov    %eax,%ecx
+  800681:	c1 f9 1f             	sar    $0x1f,%ecx
+  800684:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800687:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068a:	8d 40 04             	lea    0x4(%eax),%eax
+  80068d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800690:	eb 17                	jmp    8006a9 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800692:	8b 45 14             	mov    0x14(%ebp),%eax
+  800695:	8b 50 04             	mov    0x4(%eax),%edx
+  800698:	8b 00                	mov    (%eax),%eax
+  80069a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80069d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006a9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006ac:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006af:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006b4:	85 c9                	test   %ecx,%ecx
+  8006b6:	0f 89 03 01 00 00    	jns    8007bf <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8006bc:	83 ec 08             	sub    $0x8,%esp
+  8006bf:	53                   	push   %ebx
+  8006c0:	6a 2d                	push   $0x2d
+  8006c2:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006c4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006c7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006ca:	f7 da                	neg    %edx
+  8006cc:	83 d1 00             	adc    $0x0,%ecx
+  8006cf:	f7 d9                	neg    %ecx
+  8006d1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006d9:	e9 e1 00 00 00       	jmp    8007bf <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8006de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e1:	8b 00                	mov    (%eax),%eax
+  8006e3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e6:	89 c1                	mov    %eax,%ecx
+  8006e8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006eb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f7:	eb b0                	jmp    8006a9 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006f9:	83 f9 01             	cmp    $0x1,%ecx
+  8006fc:	7f 1e                	jg     80071c <vprintfmt+0x319>
+	else if (lflag)
+  8006fe:	85 c9                	test   %ecx,%ecx
+  800700:	74 32                	je     800734 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8b 10                	mov    (%eax),%edx
+  800707:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070c:	8d 40 04             	lea    0x4(%eax),%eax
+  80070f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800712:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800717:	e9 a3 00 00 00       	jmp    8007bf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80071c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071f:	8b 10                	mov    (%eax),%edx
+  800721:	8b 48 04             	mov    0x4(%eax),%ecx
+  800724:	8d 40 08             	lea    0x8(%eax),%eax
+  800727:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80072a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80072f:	e9 8b 00 00 00       	jmp    8007bf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800734:	8b 45 14             	mov    0x14(%ebp),%eax
+  800737:	8b 10                	mov    (%eax),%edx
+  800739:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073e:	8d 40 04             	lea    0x4(%eax),%eax
+  800741:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800744:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800749:	eb 74                	jmp    8007bf <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80074b:	83 f9 01             	cmp    $0x1,%ecx
+  80074e:	7f 1b                	jg     80076b <vprintfmt+0x368>
+	else if (lflag)
+  800750:	85 c9                	test   %ecx,%ecx
+  800752:	74 2c                	je     800780 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800754:	8b 45 14             	mov    0x14(%ebp),%eax
+  800757:	8b 10                	mov    (%eax),%edx
+  800759:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075e:	8d 40 04             	lea    0x4(%eax),%eax
+  800761:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800764:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800769:	eb 54                	jmp    8007bf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80076b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076e:	8b 10                	mov    (%eax),%edx
+  800770:	8b 48 04             	mov    0x4(%eax),%ecx
+  800773:	8d 40 08             	lea    0x8(%eax),%eax
+  800776:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800779:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80077e:	eb 3f                	jmp    8007bf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800780:	8b 45 14             	mov    0x14(%ebp),%eax
+  800783:	8b 10                	mov    (%eax),%edx
+  800785:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80078a:	8d 40 04             	lea    0x4(%eax),%eax
+  80078d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800790:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800795:	eb 28                	jmp    8007bf <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800797:	83 ec 08             	sub    $0x8,%esp
+  80079a:	53                   	push   %ebx
+  80079b:	6a 30                	push   $0x30
+  80079d:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80079f:	83 c4 08             	add    $0x8,%esp
+  8007a2:	53                   	push   %ebx
+  8007a3:	6a 78                	push   $0x78
+  8007a5:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007aa:	8b 10                	mov    (%eax),%edx
+  8007ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007b1:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ba:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007bf:	83 ec 0c             	sub    $0xc,%esp
+  8007c2:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007c6:	50                   	push   %eax
+  8007c7:	ff 75 e0             	push   -0x20(%ebp)
+  8007ca:	57                   	push   %edi
+  8007cb:	51                   	push   %ecx
+  8007cc:	52                   	push   %edx
+  8007cd:	89 da                	mov    %ebx,%edx
+  8007cf:	89 f0                	mov    %esi,%eax
+  8007d1:	e8 4a fb ff ff       	call   800320 <printnum>
+			break;
+  8007d6:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007dc:	e9 40 fc ff ff       	jmp    800421 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007e1:	83 f9 01             	cmp    $0x1,%ecx
+  8007e4:	7f 1b                	jg     800801 <vprintfmt+0x3fe>
+	else if (lflag)
+  8007e6:	85 c9                	test   %ecx,%ecx
+  8007e8:	74 2c                	je     800816 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8007ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ed:	8b 10                	mov    (%eax),%edx
+  8007ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007fa:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007ff:	eb be                	jmp    8007bf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800801:	8b 45 14             	mov    0x14(%ebp),%eax
+  800804:	8b 10                	mov    (%eax),%edx
+  800806:	8b 48 04             	mov    0x4(%eax),%ecx
+  800809:	8d 40 08             	lea    0x8(%eax),%eax
+  80080c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80080f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800814:	eb a9                	jmp    8007bf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800816:	8b 45 14             	mov    0x14(%ebp),%eax
+  800819:	8b 10                	mov    (%eax),%edx
+  80081b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800820:	8d 40 04             	lea    0x4(%eax),%eax
+  800823:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800826:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80082b:	eb 92                	jmp    8007bf <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80082d:	83 ec 08             	sub    $0x8,%esp
+  800830:	53                   	push   %ebx
+  800831:	6a 25                	push   $0x25
+  800833:	ff d6                	call   *%esi
+			break;
+  800835:	83 c4 10             	add    $0x10,%esp
+  800838:	eb 9f                	jmp    8007d9 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80083a:	83 ec 08             	sub    $0x8,%esp
+  80083d:	53                   	push   %ebx
+  80083e:	6a 25                	push   $0x25
+  800840:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800842:	83 c4 10             	add    $0x10,%esp
+  800845:	89 f8                	mov    %edi,%eax
+  800847:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80084b:	74 05                	je     800852 <vprintfmt+0x44f>
+  80084d:	83 e8 01             	sub    $0x1,%eax
+  800850:	eb f5                	jmp    800847 <vprintfmt+0x444>
+  800852:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800855:	eb 82                	jmp    8007d9 <vprintfmt+0x3d6>
+
+00800857 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800857:	55                   	push   %ebp
+  800858:	89 e5                	mov    %esp,%ebp
+  80085a:	83 ec 18             	sub    $0x18,%esp
+  80085d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800860:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800863:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800866:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80086a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80086d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800874:	85 c0                	test   %eax,%eax
+  800876:	74 26                	je     80089e <vsnprintf+0x47>
+  800878:	85 d2                	test   %edx,%edx
+  80087a:	7e 22                	jle    80089e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80087c:	ff 75 14             	push   0x14(%ebp)
+  80087f:	ff 75 10             	push   0x10(%ebp)
+  800882:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800885:	50                   	push   %eax
+  800886:	68 c9 03 80 00       	push   $0x8003c9
+  80088b:	e8 73 fb ff ff       	call   800403 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800890:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800893:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800896:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800899:	83 c4 10             	add    $0x10,%esp
+}
+  80089c:	c9                   	leave
+  80089d:	c3                   	ret
+		return -E_INVAL;
+  80089e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008a3:	eb f7                	jmp    80089c <vsnprintf+0x45>
+
+008008a5 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008a5:	55                   	push   %ebp
+  8008a6:	89 e5                	mov    %esp,%ebp
+  8008a8:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008ab:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008ae:	50                   	push   %eax
+  8008af:	ff 75 10             	push   0x10(%ebp)
+  8008b2:	ff 75 0c             	push   0xc(%ebp)
+  8008b5:	ff 75 08             	push   0x8(%ebp)
+  8008b8:	e8 9a ff ff ff       	call   800857 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008bd:	c9                   	leave
+  8008be:	c3                   	ret
+
+008008bf <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008bf:	55                   	push   %ebp
+  8008c0:	89 e5                	mov    %esp,%ebp
+  8008c2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ca:	eb 03                	jmp    8008cf <strlen+0x10>
+		n++;
+  8008cc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008cf:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008d3:	75 f7                	jne    8008cc <strlen+0xd>
+	return n;
+}
+  8008d5:	5d                   	pop    %ebp
+  8008d6:	c3                   	ret
+
+008008d7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008d7:	55                   	push   %ebp
+  8008d8:	89 e5                	mov    %esp,%ebp
+  8008da:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e5:	eb 03                	jmp    8008ea <strnlen+0x13>
+		n++;
+  8008e7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008ea:	39 d0                	cmp    %edx,%eax
+  8008ec:	74 08                	je     8008f6 <strnlen+0x1f>
+  8008ee:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008f2:	75 f3                	jne    8008e7 <strnlen+0x10>
+  8008f4:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008f6:	89 d0                	mov    %edx,%eax
+  8008f8:	5d                   	pop    %ebp
+  8008f9:	c3                   	ret
+
+008008fa <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008fa:	55                   	push   %ebp
+  8008fb:	89 e5                	mov    %esp,%ebp
+  8008fd:	53                   	push   %ebx
+  8008fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800901:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800904:	b8 00 00 00 00       	mov    $0x0,%eax
+  800909:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80090d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800910:	83 c0 01             	add    $0x1,%eax
+  800913:	84 d2                	test   %dl,%dl
+  800915:	75 f2                	jne    800909 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800917:	89 c8                	mov    %ecx,%eax
+  800919:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80091c:	c9                   	leave
+  80091d:	c3                   	ret
+
+0080091e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80091e:	55                   	push   %ebp
+  80091f:	89 e5                	mov    %esp,%ebp
+  800921:	53                   	push   %ebx
+  800922:	83 ec 10             	sub    $0x10,%esp
+  800925:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800928:	53                   	push   %ebx
+  800929:	e8 91 ff ff ff       	call   8008bf <strlen>
+  80092e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800931:	ff 75 0c             	push   0xc(%ebp)
+  800934:	01 d8                	add    %ebx,%eax
+  800936:	50                   	push   %eax
+  800937:	e8 be ff ff ff       	call   8008fa <strcpy>
+	return dst;
+}
+  80093c:	89 d8                	mov    %ebx,%eax
+  80093e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800941:	c9                   	leave
+  800942:	c3                   	ret
+
+00800943 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800943:	55                   	push   %ebp
+  800944:	89 e5                	mov    %esp,%ebp
+  800946:	56                   	push   %esi
+  800947:	53                   	push   %ebx
+  800948:	8b 75 08             	mov    0x8(%ebp),%esi
+  80094b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80094e:	89 f3                	mov    %esi,%ebx
+  800950:	03 5d 10             	add    0x10(%ebp),%ebx
+  800953:	89 f0                	mov    %esi,%eax
+  800955:	eb 0f                	jmp    800966 <strncpy+0x23>
+		*dst++ = *src;
+  800957:	83 c0 01             	add    $0x1,%eax
+  80095a:	0f b6 0a             	movzbl (%edx),%ecx
+  80095d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800960:	80 f9 01             	cmp    $0x1,%cl
+  800963:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800966:	39 d8                	cmp    %ebx,%eax
+  800968:	75 ed                	jne    800957 <strncpy+0x14>
+	}
+	return ret;
+}
+  80096a:	89 f0                	mov    %esi,%eax
+  80096c:	5b                   	pop    %ebx
+  80096d:	5e                   	pop    %esi
+  80096e:	5d                   	pop    %ebp
+  80096f:	c3                   	ret
+
+00800970 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800970:	55                   	push   %ebp
+  800971:	89 e5                	mov    %esp,%ebp
+  800973:	56                   	push   %esi
+  800974:	53                   	push   %ebx
+  800975:	8b 75 08             	mov    0x8(%ebp),%esi
+  800978:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80097b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80097e:	89 f0                	mov    %esi,%eax
+  800980:	85 d2                	test   %edx,%edx
+  800982:	74 21                	je     8009a5 <strlcpy+0x35>
+  800984:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800988:	89 f2                	mov    %esi,%edx
+  80098a:	eb 09                	jmp    800995 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80098c:	83 c1 01             	add    $0x1,%ecx
+  80098f:	83 c2 01             	add    $0x1,%edx
+  800992:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800995:	39 c2                	cmp    %eax,%edx
+  800997:	74 09                	je     8009a2 <strlcpy+0x32>
+  800999:	0f b6 19             	movzbl (%ecx),%ebx
+  80099c:	84 db                	test   %bl,%bl
+  80099e:	75 ec                	jne    80098c <strlcpy+0x1c>
+  8009a0:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009a2:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009a5:	29 f0                	sub    %esi,%eax
+}
+  8009a7:	5b                   	pop    %ebx
+  8009a8:	5e                   	pop    %esi
+  8009a9:	5d                   	pop    %ebp
+  8009aa:	c3                   	ret
+
+008009ab <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009ab:	55                   	push   %ebp
+  8009ac:	89 e5                	mov    %esp,%ebp
+  8009ae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009b4:	eb 06                	jmp    8009bc <strcmp+0x11>
+		p++, q++;
+  8009b6:	83 c1 01             	add    $0x1,%ecx
+  8009b9:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009bc:	0f b6 01             	movzbl (%ecx),%eax
+  8009bf:	84 c0                	test   %al,%al
+  8009c1:	74 04                	je     8009c7 <strcmp+0x1c>
+  8009c3:	3a 02                	cmp    (%edx),%al
+  8009c5:	74 ef                	je     8009b6 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c7:	0f b6 c0             	movzbl %al,%eax
+  8009ca:	0f b6 12             	movzbl (%edx),%edx
+  8009cd:	29 d0                	sub    %edx,%eax
+}
+  8009cf:	5d                   	pop    %ebp
+  8009d0:	c3                   	ret
+
+008009d1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	53                   	push   %ebx
+  8009d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009db:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009de:	eb 09                	jmp    8009e9 <strncmp+0x18>
+		n--, p++, q++;
+  8009e0:	83 ea 01             	sub    $0x1,%edx
+  8009e3:	83 c0 01             	add    $0x1,%eax
+  8009e6:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009e9:	85 d2                	test   %edx,%edx
+  8009eb:	74 18                	je     800a05 <strncmp+0x34>
+  8009ed:	0f b6 18             	movzbl (%eax),%ebx
+  8009f0:	84 db                	test   %bl,%bl
+  8009f2:	74 04                	je     8009f8 <strncmp+0x27>
+  8009f4:	3a 19                	cmp    (%ecx),%bl
+  8009f6:	74 e8                	je     8009e0 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009f8:	0f b6 00             	movzbl (%eax),%eax
+  8009fb:	0f b6 11             	movzbl (%ecx),%edx
+  8009fe:	29 d0                	sub    %edx,%eax
+}
+  800a00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a03:	c9                   	leave
+  800a04:	c3                   	ret
+		return 0;
+  800a05:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0a:	eb f4                	jmp    800a00 <strncmp+0x2f>
+
+00800a0c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a0c:	55                   	push   %ebp
+  800a0d:	89 e5                	mov    %esp,%ebp
+  800a0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a12:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a16:	eb 03                	jmp    800a1b <strchr+0xf>
+  800a18:	83 c0 01             	add    $0x1,%eax
+  800a1b:	0f b6 10             	movzbl (%eax),%edx
+  800a1e:	84 d2                	test   %dl,%dl
+  800a20:	74 06                	je     800a28 <strchr+0x1c>
+		if (*s == c)
+  800a22:	38 ca                	cmp    %cl,%dl
+  800a24:	75 f2                	jne    800a18 <strchr+0xc>
+  800a26:	eb 05                	jmp    800a2d <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a2d:	5d                   	pop    %ebp
+  800a2e:	c3                   	ret
+
+00800a2f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a2f:	55                   	push   %ebp
+  800a30:	89 e5                	mov    %esp,%ebp
+  800a32:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a35:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a39:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a3c:	38 ca                	cmp    %cl,%dl
+  800a3e:	74 09                	je     800a49 <strfind+0x1a>
+  800a40:	84 d2                	test   %dl,%dl
+  800a42:	74 05                	je     800a49 <strfind+0x1a>
+	for (; *s; s++)
+  800a44:	83 c0 01             	add    $0x1,%eax
+  800a47:	eb f0                	jmp    800a39 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a49:	5d                   	pop    %ebp
+  800a4a:	c3                   	ret
+
+00800a4b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a4b:	55                   	push   %ebp
+  800a4c:	89 e5                	mov    %esp,%ebp
+  800a4e:	57                   	push   %edi
+  800a4f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a52:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a55:	85 c9                	test   %ecx,%ecx
+  800a57:	74 20                	je     800a79 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a59:	89 f8                	mov    %edi,%eax
+  800a5b:	09 c8                	or     %ecx,%eax
+  800a5d:	a8 03                	test   $0x3,%al
+  800a5f:	75 12                	jne    800a73 <memset+0x28>
+		c &= 0xFF;
+  800a61:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a65:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a6b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a6e:	fc                   	cld
+  800a6f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a71:	eb 06                	jmp    800a79 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a73:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a76:	fc                   	cld
+  800a77:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a79:	89 f8                	mov    %edi,%eax
+  800a7b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a7e:	c9                   	leave
+  800a7f:	c3                   	ret
+
+00800a80 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a80:	55                   	push   %ebp
+  800a81:	89 e5                	mov    %esp,%ebp
+  800a83:	57                   	push   %edi
+  800a84:	56                   	push   %esi
+  800a85:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a88:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a8b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a8e:	39 c6                	cmp    %eax,%esi
+  800a90:	73 32                	jae    800ac4 <memmove+0x44>
+  800a92:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a95:	39 d0                	cmp    %edx,%eax
+  800a97:	73 2b                	jae    800ac4 <memmove+0x44>
+		s += n;
+		d += n;
+  800a99:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a9c:	89 d6                	mov    %edx,%esi
+  800a9e:	09 fe                	or     %edi,%esi
+  800aa0:	09 ce                	or     %ecx,%esi
+  800aa2:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aa8:	75 0e                	jne    800ab8 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800aaa:	83 ef 04             	sub    $0x4,%edi
+  800aad:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ab0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ab3:	fd                   	std
+  800ab4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ab6:	eb 09                	jmp    800ac1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ab8:	83 ef 01             	sub    $0x1,%edi
+  800abb:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800abe:	fd                   	std
+  800abf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ac1:	fc                   	cld
+  800ac2:	eb 1a                	jmp    800ade <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ac4:	89 f2                	mov    %esi,%edx
+  800ac6:	09 c2                	or     %eax,%edx
+  800ac8:	09 ca                	or     %ecx,%edx
+  800aca:	f6 c2 03             	test   $0x3,%dl
+  800acd:	75 0a                	jne    800ad9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800acf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ad2:	89 c7                	mov    %eax,%edi
+  800ad4:	fc                   	cld
+  800ad5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad7:	eb 05                	jmp    800ade <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ad9:	89 c7                	mov    %eax,%edi
+  800adb:	fc                   	cld
+  800adc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ade:	5e                   	pop    %esi
+  800adf:	5f                   	pop    %edi
+  800ae0:	5d                   	pop    %ebp
+  800ae1:	c3                   	ret
+
+00800ae2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ae2:	55                   	push   %ebp
+  800ae3:	89 e5                	mov    %esp,%ebp
+  800ae5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ae8:	ff 75 10             	push   0x10(%ebp)
+  800aeb:	ff 75 0c             	push   0xc(%ebp)
+  800aee:	ff 75 08             	push   0x8(%ebp)
+  800af1:	e8 8a ff ff ff       	call   800a80 <memmove>
+}
+  800af6:	c9                   	leave
+  800af7:	c3                   	ret
+
+00800af8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800af8:	55                   	push   %ebp
+  800af9:	89 e5                	mov    %esp,%ebp
+  800afb:	56                   	push   %esi
+  800afc:	53                   	push   %ebx
+  800afd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b00:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b03:	89 c6                	mov    %eax,%esi
+  800b05:	03 75 10             	add    0x10(%ebp),%esi
+  800b08:	eb 06                	jmp    800b10 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b0a:	83 c0 01             	add    $0x1,%eax
+  800b0d:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b10:	39 f0                	cmp    %esi,%eax
+  800b12:	74 14                	je     800b28 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b14:	0f b6 08             	movzbl (%eax),%ecx
+  800b17:	0f b6 1a             	movzbl (%edx),%ebx
+  800b1a:	38 d9                	cmp    %bl,%cl
+  800b1c:	74 ec                	je     800b0a <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b1e:	0f b6 c1             	movzbl %cl,%eax
+  800b21:	0f b6 db             	movzbl %bl,%ebx
+  800b24:	29 d8                	sub    %ebx,%eax
+  800b26:	eb 05                	jmp    800b2d <memcmp+0x35>
+	}
+
+	return 0;
+  800b28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b2d:	5b                   	pop    %ebx
+  800b2e:	5e                   	pop    %esi
+  800b2f:	5d                   	pop    %ebp
+  800b30:	c3                   	ret
+
+00800b31 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b31:	55                   	push   %ebp
+  800b32:	89 e5                	mov    %esp,%ebp
+  800b34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b3a:	89 c2                	mov    %eax,%edx
+  800b3c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b3f:	eb 03                	jmp    800b44 <memfind+0x13>
+  800b41:	83 c0 01             	add    $0x1,%eax
+  800b44:	39 d0                	cmp    %edx,%eax
+  800b46:	73 04                	jae    800b4c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b48:	38 08                	cmp    %cl,(%eax)
+  800b4a:	75 f5                	jne    800b41 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b4c:	5d                   	pop    %ebp
+  800b4d:	c3                   	ret
+
+00800b4e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b4e:	55                   	push   %ebp
+  800b4f:	89 e5                	mov    %esp,%ebp
+  800b51:	57                   	push   %edi
+  800b52:	56                   	push   %esi
+  800b53:	53                   	push   %ebx
+  800b54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b5a:	eb 03                	jmp    800b5f <strtol+0x11>
+		s++;
+  800b5c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b5f:	0f b6 02             	movzbl (%edx),%eax
+  800b62:	3c 20                	cmp    $0x20,%al
+  800b64:	74 f6                	je     800b5c <strtol+0xe>
+  800b66:	3c 09                	cmp    $0x9,%al
+  800b68:	74 f2                	je     800b5c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b6a:	3c 2b                	cmp    $0x2b,%al
+  800b6c:	74 2a                	je     800b98 <strtol+0x4a>
+	int neg = 0;
+  800b6e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b73:	3c 2d                	cmp    $0x2d,%al
+  800b75:	74 2b                	je     800ba2 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b77:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b7d:	75 0f                	jne    800b8e <strtol+0x40>
+  800b7f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b82:	74 28                	je     800bac <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b84:	85 db                	test   %ebx,%ebx
+  800b86:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b8b:	0f 44 d8             	cmove  %eax,%ebx
+  800b8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b93:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b96:	eb 46                	jmp    800bde <strtol+0x90>
+		s++;
+  800b98:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ba0:	eb d5                	jmp    800b77 <strtol+0x29>
+		s++, neg = 1;
+  800ba2:	83 c2 01             	add    $0x1,%edx
+  800ba5:	bf 01 00 00 00       	mov    $0x1,%edi
+  800baa:	eb cb                	jmp    800b77 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bac:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bb0:	74 0e                	je     800bc0 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bb2:	85 db                	test   %ebx,%ebx
+  800bb4:	75 d8                	jne    800b8e <strtol+0x40>
+		s++, base = 8;
+  800bb6:	83 c2 01             	add    $0x1,%edx
+  800bb9:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bbe:	eb ce                	jmp    800b8e <strtol+0x40>
+		s += 2, base = 16;
+  800bc0:	83 c2 02             	add    $0x2,%edx
+  800bc3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bc8:	eb c4                	jmp    800b8e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bca:	0f be c0             	movsbl %al,%eax
+  800bcd:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bd0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bd3:	7d 3a                	jge    800c0f <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bd5:	83 c2 01             	add    $0x1,%edx
+  800bd8:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bdc:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bde:	0f b6 02             	movzbl (%edx),%eax
+  800be1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800be4:	89 f3                	mov    %esi,%ebx
+  800be6:	80 fb 09             	cmp    $0x9,%bl
+  800be9:	76 df                	jbe    800bca <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800beb:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bee:	89 f3                	mov    %esi,%ebx
+  800bf0:	80 fb 19             	cmp    $0x19,%bl
+  800bf3:	77 08                	ja     800bfd <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bf5:	0f be c0             	movsbl %al,%eax
+  800bf8:	83 e8 57             	sub    $0x57,%eax
+  800bfb:	eb d3                	jmp    800bd0 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bfd:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c00:	89 f3                	mov    %esi,%ebx
+  800c02:	80 fb 19             	cmp    $0x19,%bl
+  800c05:	77 08                	ja     800c0f <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c07:	0f be c0             	movsbl %al,%eax
+  800c0a:	83 e8 37             	sub    $0x37,%eax
+  800c0d:	eb c1                	jmp    800bd0 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c0f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c13:	74 05                	je     800c1a <strtol+0xcc>
+		*endptr = (char *) s;
+  800c15:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c18:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c1a:	89 c8                	mov    %ecx,%eax
+  800c1c:	f7 d8                	neg    %eax
+  800c1e:	85 ff                	test   %edi,%edi
+  800c20:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c23:	89 c8                	mov    %ecx,%eax
+  800c25:	5b                   	pop    %ebx
+  800c26:	5e                   	pop    %esi
+  800c27:	5f                   	pop    %edi
+  800c28:	5d                   	pop    %ebp
+  800c29:	c3                   	ret
+
+00800c2a <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c2a:	55                   	push   %ebp
+  800c2b:	89 e5                	mov    %esp,%ebp
+  800c2d:	57                   	push   %edi
+  800c2e:	56                   	push   %esi
+  800c2f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3b:	89 c3                	mov    %eax,%ebx
+  800c3d:	89 c7                	mov    %eax,%edi
+  800c3f:	55                   	push   %ebp
+  800c40:	89 e5                	mov    %esp,%ebp
+  800c42:	8d 35 4a 0c 80 00    	lea    0x800c4a,%esi
+  800c48:	0f 34                	sysenter
+  800c4a:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800c4b:	5b                   	pop    %ebx
+  800c4c:	5e                   	pop    %esi
+  800c4d:	5f                   	pop    %edi
+  800c4e:	5d                   	pop    %ebp
+  800c4f:	c3                   	ret
+
+00800c50 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c50:	55                   	push   %ebp
+  800c51:	89 e5                	mov    %esp,%ebp
+  800c53:	57                   	push   %edi
+  800c54:	56                   	push   %esi
+  800c55:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c56:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c5b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c60:	89 d1                	mov    %edx,%ecx
+  800c62:	89 d3                	mov    %edx,%ebx
+  800c64:	89 d7                	mov    %edx,%edi
+  800c66:	55                   	push   %ebp
+  800c67:	89 e5                	mov    %esp,%ebp
+  800c69:	8d 35 71 0c 80 00    	lea    0x800c71,%esi
+  800c6f:	0f 34                	sysenter
+  800c71:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800c72:	5b                   	pop    %ebx
+  800c73:	5e                   	pop    %esi
+  800c74:	5f                   	pop    %edi
+  800c75:	5d                   	pop    %ebp
+  800c76:	c3                   	ret
+
+00800c77 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c77:	55                   	push   %ebp
+  800c78:	89 e5                	mov    %esp,%ebp
+  800c7a:	57                   	push   %edi
+  800c7b:	56                   	push   %esi
+  800c7c:	53                   	push   %ebx
+  800c7d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c88:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c8d:	89 cb                	mov    %ecx,%ebx
+  800c8f:	89 cf                	mov    %ecx,%edi
+  800c91:	55                   	push   %ebp
+  800c92:	89 e5                	mov    %esp,%ebp
+  800c94:	8d 35 9c 0c 80 00    	lea    0x800c9c,%esi
+  800c9a:	0f 34                	sysenter
+  800c9c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c9d:	85 c0                	test   %eax,%eax
+  800c9f:	7f 08                	jg     800ca9 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800ca1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca4:	5b                   	pop    %ebx
+  800ca5:	5e                   	pop    %esi
+  800ca6:	5f                   	pop    %edi
+  800ca7:	5d                   	pop    %ebp
+  800ca8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca9:	83 ec 0c             	sub    $0xc,%esp
+  800cac:	50                   	push   %eax
+  800cad:	6a 03                	push   $0x3
+  800caf:	68 c7 3c 80 00       	push   $0x803cc7
+  800cb4:	6a 3d                	push   $0x3d
+  800cb6:	68 e4 3c 80 00       	push   $0x803ce4
+  800cbb:	e8 71 f5 ff ff       	call   800231 <_panic>
+
+00800cc0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cc0:	55                   	push   %ebp
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	57                   	push   %edi
+  800cc4:	56                   	push   %esi
+  800cc5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800cc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ccb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cd0:	89 d1                	mov    %edx,%ecx
+  800cd2:	89 d3                	mov    %edx,%ebx
+  800cd4:	89 d7                	mov    %edx,%edi
+  800cd6:	55                   	push   %ebp
+  800cd7:	89 e5                	mov    %esp,%ebp
+  800cd9:	8d 35 e1 0c 80 00    	lea    0x800ce1,%esi
+  800cdf:	0f 34                	sysenter
+  800ce1:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800ce2:	5b                   	pop    %ebx
+  800ce3:	5e                   	pop    %esi
+  800ce4:	5f                   	pop    %edi
+  800ce5:	5d                   	pop    %ebp
+  800ce6:	c3                   	ret
+
+00800ce7 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	57                   	push   %edi
+  800ceb:	56                   	push   %esi
+  800cec:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ced:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cf7:	89 d1                	mov    %edx,%ecx
+  800cf9:	89 d3                	mov    %edx,%ebx
+  800cfb:	89 d7                	mov    %edx,%edi
+  800cfd:	89 d6                	mov    %edx,%esi
+  800cff:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d01:	5b                   	pop    %ebx
+  800d02:	5e                   	pop    %esi
+  800d03:	5f                   	pop    %edi
+  800d04:	5d                   	pop    %ebp
+  800d05:	c3                   	ret
+
+00800d06 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d06:	55                   	push   %ebp
+  800d07:	89 e5                	mov    %esp,%ebp
+  800d09:	57                   	push   %edi
+  800d0a:	56                   	push   %esi
+  800d0b:	53                   	push   %ebx
+  800d0c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d15:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d22:	55                   	push   %ebp
+  800d23:	89 e5                	mov    %esp,%ebp
+  800d25:	8d 35 2d 0d 80 00    	lea    0x800d2d,%esi
+  800d2b:	0f 34                	sysenter
+  800d2d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d2e:	85 c0                	test   %eax,%eax
+  800d30:	7f 08                	jg     800d3a <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800d32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d35:	5b                   	pop    %ebx
+  800d36:	5e                   	pop    %esi
+  800d37:	5f                   	pop    %edi
+  800d38:	5d                   	pop    %ebp
+  800d39:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d3a:	83 ec 0c             	sub    $0xc,%esp
+  800d3d:	50                   	push   %eax
+  800d3e:	6a 04                	push   $0x4
+  800d40:	68 c7 3c 80 00       	push   $0x803cc7
+  800d45:	6a 3d                	push   $0x3d
+  800d47:	68 e4 3c 80 00       	push   $0x803ce4
+  800d4c:	e8 e0 f4 ff ff       	call   800231 <_panic>
+
+00800d51 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d51:	55                   	push   %ebp
+  800d52:	89 e5                	mov    %esp,%ebp
+  800d54:	57                   	push   %edi
+  800d55:	56                   	push   %esi
+  800d56:	53                   	push   %ebx
+  800d57:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d60:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d68:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d6b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d6e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d70:	85 c0                	test   %eax,%eax
+  800d72:	7f 08                	jg     800d7c <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d77:	5b                   	pop    %ebx
+  800d78:	5e                   	pop    %esi
+  800d79:	5f                   	pop    %edi
+  800d7a:	5d                   	pop    %ebp
+  800d7b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d7c:	83 ec 0c             	sub    $0xc,%esp
+  800d7f:	50                   	push   %eax
+  800d80:	6a 05                	push   $0x5
+  800d82:	68 c7 3c 80 00       	push   $0x803cc7
+  800d87:	6a 23                	push   $0x23
+  800d89:	68 e4 3c 80 00       	push   $0x803ce4
+  800d8e:	e8 9e f4 ff ff       	call   800231 <_panic>
+
+00800d93 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d93:	55                   	push   %ebp
+  800d94:	89 e5                	mov    %esp,%ebp
+  800d96:	57                   	push   %edi
+  800d97:	56                   	push   %esi
+  800d98:	53                   	push   %ebx
+  800d99:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800da1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dac:	89 df                	mov    %ebx,%edi
+  800dae:	55                   	push   %ebp
+  800daf:	89 e5                	mov    %esp,%ebp
+  800db1:	8d 35 b9 0d 80 00    	lea    0x800db9,%esi
+  800db7:	0f 34                	sysenter
+  800db9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800dba:	85 c0                	test   %eax,%eax
+  800dbc:	7f 08                	jg     800dc6 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800dbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc1:	5b                   	pop    %ebx
+  800dc2:	5e                   	pop    %esi
+  800dc3:	5f                   	pop    %edi
+  800dc4:	5d                   	pop    %ebp
+  800dc5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dc6:	83 ec 0c             	sub    $0xc,%esp
+  800dc9:	50                   	push   %eax
+  800dca:	6a 06                	push   $0x6
+  800dcc:	68 c7 3c 80 00       	push   $0x803cc7
+  800dd1:	6a 3d                	push   $0x3d
+  800dd3:	68 e4 3c 80 00       	push   $0x803ce4
+  800dd8:	e8 54 f4 ff ff       	call   800231 <_panic>
+
+00800ddd <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ddd:	55                   	push   %ebp
+  800dde:	89 e5                	mov    %esp,%ebp
+  800de0:	57                   	push   %edi
+  800de1:	56                   	push   %esi
+  800de2:	53                   	push   %ebx
+  800de3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800de6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800deb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df1:	b8 08 00 00 00       	mov    $0x8,%eax
+  800df6:	89 df                	mov    %ebx,%edi
+  800df8:	55                   	push   %ebp
+  800df9:	89 e5                	mov    %esp,%ebp
+  800dfb:	8d 35 03 0e 80 00    	lea    0x800e03,%esi
+  800e01:	0f 34                	sysenter
+  800e03:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e04:	85 c0                	test   %eax,%eax
+  800e06:	7f 08                	jg     800e10 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800e08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0b:	5b                   	pop    %ebx
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5f                   	pop    %edi
+  800e0e:	5d                   	pop    %ebp
+  800e0f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e10:	83 ec 0c             	sub    $0xc,%esp
+  800e13:	50                   	push   %eax
+  800e14:	6a 08                	push   $0x8
+  800e16:	68 c7 3c 80 00       	push   $0x803cc7
+  800e1b:	6a 3d                	push   $0x3d
+  800e1d:	68 e4 3c 80 00       	push   $0x803ce4
+  800e22:	e8 0a f4 ff ff       	call   800231 <_panic>
+
+00800e27 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	56                   	push   %esi
+  800e2c:	53                   	push   %ebx
+  800e2d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e40:	89 df                	mov    %ebx,%edi
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	8d 35 4d 0e 80 00    	lea    0x800e4d,%esi
+  800e4b:	0f 34                	sysenter
+  800e4d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e4e:	85 c0                	test   %eax,%eax
+  800e50:	7f 08                	jg     800e5a <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800e52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e55:	5b                   	pop    %ebx
+  800e56:	5e                   	pop    %esi
+  800e57:	5f                   	pop    %edi
+  800e58:	5d                   	pop    %ebp
+  800e59:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5a:	83 ec 0c             	sub    $0xc,%esp
+  800e5d:	50                   	push   %eax
+  800e5e:	6a 09                	push   $0x9
+  800e60:	68 c7 3c 80 00       	push   $0x803cc7
+  800e65:	6a 3d                	push   $0x3d
+  800e67:	68 e4 3c 80 00       	push   $0x803ce4
+  800e6c:	e8 c0 f3 ff ff       	call   800231 <_panic>
+
+00800e71 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e71:	55                   	push   %ebp
+  800e72:	89 e5                	mov    %esp,%ebp
+  800e74:	57                   	push   %edi
+  800e75:	56                   	push   %esi
+  800e76:	53                   	push   %ebx
+  800e77:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e85:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e8a:	89 df                	mov    %ebx,%edi
+  800e8c:	55                   	push   %ebp
+  800e8d:	89 e5                	mov    %esp,%ebp
+  800e8f:	8d 35 97 0e 80 00    	lea    0x800e97,%esi
+  800e95:	0f 34                	sysenter
+  800e97:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e98:	85 c0                	test   %eax,%eax
+  800e9a:	7f 08                	jg     800ea4 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800e9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9f:	5b                   	pop    %ebx
+  800ea0:	5e                   	pop    %esi
+  800ea1:	5f                   	pop    %edi
+  800ea2:	5d                   	pop    %ebp
+  800ea3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea4:	83 ec 0c             	sub    $0xc,%esp
+  800ea7:	50                   	push   %eax
+  800ea8:	6a 0a                	push   $0xa
+  800eaa:	68 c7 3c 80 00       	push   $0x803cc7
+  800eaf:	6a 3d                	push   $0x3d
+  800eb1:	68 e4 3c 80 00       	push   $0x803ce4
+  800eb6:	e8 76 f3 ff ff       	call   800231 <_panic>
+
+00800ebb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800ebb:	55                   	push   %ebp
+  800ebc:	89 e5                	mov    %esp,%ebp
+  800ebe:	57                   	push   %edi
+  800ebf:	56                   	push   %esi
+  800ec0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ec1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ecc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ed2:	55                   	push   %ebp
+  800ed3:	89 e5                	mov    %esp,%ebp
+  800ed5:	8d 35 dd 0e 80 00    	lea    0x800edd,%esi
+  800edb:	0f 34                	sysenter
+  800edd:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800ede:	5b                   	pop    %ebx
+  800edf:	5e                   	pop    %esi
+  800ee0:	5f                   	pop    %edi
+  800ee1:	5d                   	pop    %ebp
+  800ee2:	c3                   	ret
+
+00800ee3 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800ee3:	55                   	push   %ebp
+  800ee4:	89 e5                	mov    %esp,%ebp
+  800ee6:	57                   	push   %edi
+  800ee7:	56                   	push   %esi
+  800ee8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ee9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eef:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ef4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800efa:	55                   	push   %ebp
+  800efb:	89 e5                	mov    %esp,%ebp
+  800efd:	8d 35 05 0f 80 00    	lea    0x800f05,%esi
+  800f03:	0f 34                	sysenter
+  800f05:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800f06:	5b                   	pop    %ebx
+  800f07:	5e                   	pop    %esi
+  800f08:	5f                   	pop    %edi
+  800f09:	5d                   	pop    %ebp
+  800f0a:	c3                   	ret
+
+00800f0b <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800f0b:	55                   	push   %ebp
+  800f0c:	89 e5                	mov    %esp,%ebp
+  800f0e:	57                   	push   %edi
+  800f0f:	56                   	push   %esi
+  800f10:	53                   	push   %ebx
+  800f11:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f14:	be 00 00 00 00       	mov    $0x0,%esi
+  800f19:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f27:	89 f7                	mov    %esi,%edi
+  800f29:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f2b:	85 c0                	test   %eax,%eax
+  800f2d:	7f 08                	jg     800f37 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800f2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f32:	5b                   	pop    %ebx
+  800f33:	5e                   	pop    %esi
+  800f34:	5f                   	pop    %edi
+  800f35:	5d                   	pop    %ebp
+  800f36:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f37:	83 ec 0c             	sub    $0xc,%esp
+  800f3a:	50                   	push   %eax
+  800f3b:	6a 0d                	push   $0xd
+  800f3d:	68 c7 3c 80 00       	push   $0x803cc7
+  800f42:	6a 23                	push   $0x23
+  800f44:	68 e4 3c 80 00       	push   $0x803ce4
+  800f49:	e8 e3 f2 ff ff       	call   800231 <_panic>
+
+00800f4e <sys_ipc_recv>:
+{
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800f54:	6a 00                	push   $0x0
+  800f56:	6a 01                	push   $0x1
+  800f58:	ff 75 08             	push   0x8(%ebp)
+  800f5b:	e8 ab ff ff ff       	call   800f0b <sys_ipc_recvv>
+}
+  800f60:	c9                   	leave
+  800f61:	c3                   	ret
+
+00800f62 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+  800f65:	57                   	push   %edi
+  800f66:	56                   	push   %esi
+  800f67:	53                   	push   %ebx
+  800f68:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f76:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f7b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800f7e:	89 de                	mov    %ebx,%esi
+  800f80:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f82:	85 c0                	test   %eax,%eax
+  800f84:	7f 08                	jg     800f8e <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800f86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f89:	5b                   	pop    %ebx
+  800f8a:	5e                   	pop    %esi
+  800f8b:	5f                   	pop    %edi
+  800f8c:	5d                   	pop    %ebp
+  800f8d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8e:	83 ec 0c             	sub    $0xc,%esp
+  800f91:	50                   	push   %eax
+  800f92:	6a 0d                	push   $0xd
+  800f94:	68 c7 3c 80 00       	push   $0x803cc7
+  800f99:	6a 23                	push   $0x23
+  800f9b:	68 e4 3c 80 00       	push   $0x803ce4
+  800fa0:	e8 8c f2 ff ff       	call   800231 <_panic>
+
+00800fa5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fa5:	55                   	push   %ebp
+  800fa6:	89 e5                	mov    %esp,%ebp
+  800fa8:	57                   	push   %edi
+  800fa9:	56                   	push   %esi
+  800faa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fb5:	89 d1                	mov    %edx,%ecx
+  800fb7:	89 d3                	mov    %edx,%ebx
+  800fb9:	89 d7                	mov    %edx,%edi
+  800fbb:	55                   	push   %ebp
+  800fbc:	89 e5                	mov    %esp,%ebp
+  800fbe:	8d 35 c6 0f 80 00    	lea    0x800fc6,%esi
+  800fc4:	0f 34                	sysenter
+  800fc6:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800fc7:	5b                   	pop    %ebx
+  800fc8:	5e                   	pop    %esi
+  800fc9:	5f                   	pop    %edi
+  800fca:	5d                   	pop    %ebp
+  800fcb:	c3                   	ret
+
+00800fcc <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800fcc:	55                   	push   %ebp
+  800fcd:	89 e5                	mov    %esp,%ebp
+  800fcf:	57                   	push   %edi
+  800fd0:	56                   	push   %esi
+  800fd1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fe2:	89 df                	mov    %ebx,%edi
+  800fe4:	55                   	push   %ebp
+  800fe5:	89 e5                	mov    %esp,%ebp
+  800fe7:	8d 35 ef 0f 80 00    	lea    0x800fef,%esi
+  800fed:	0f 34                	sysenter
+  800fef:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800ff0:	5b                   	pop    %ebx
+  800ff1:	5e                   	pop    %esi
+  800ff2:	5f                   	pop    %edi
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+
+00800ff5 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800ff5:	55                   	push   %ebp
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	57                   	push   %edi
+  800ff9:	56                   	push   %esi
+  800ffa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ffb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801000:	8b 55 08             	mov    0x8(%ebp),%edx
+  801003:	b8 10 00 00 00       	mov    $0x10,%eax
+  801008:	89 cb                	mov    %ecx,%ebx
+  80100a:	89 cf                	mov    %ecx,%edi
+  80100c:	55                   	push   %ebp
+  80100d:	89 e5                	mov    %esp,%ebp
+  80100f:	8d 35 17 10 80 00    	lea    0x801017,%esi
+  801015:	0f 34                	sysenter
+  801017:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  801018:	5b                   	pop    %ebx
+  801019:	5e                   	pop    %esi
+  80101a:	5f                   	pop    %edi
+  80101b:	5d                   	pop    %ebp
+  80101c:	c3                   	ret
+
+0080101d <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  80101d:	55                   	push   %ebp
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	57                   	push   %edi
+  801021:	56                   	push   %esi
+  801022:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801023:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801028:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801033:	89 df                	mov    %ebx,%edi
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	8d 35 40 10 80 00    	lea    0x801040,%esi
+  80103e:	0f 34                	sysenter
+  801040:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  801041:	5b                   	pop    %ebx
+  801042:	5e                   	pop    %esi
+  801043:	5f                   	pop    %edi
+  801044:	5d                   	pop    %ebp
+  801045:	c3                   	ret
+
+00801046 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  801046:	55                   	push   %ebp
+  801047:	89 e5                	mov    %esp,%ebp
+  801049:	57                   	push   %edi
+  80104a:	56                   	push   %esi
+  80104b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80104c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801051:	8b 55 08             	mov    0x8(%ebp),%edx
+  801054:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801057:	b8 14 00 00 00       	mov    $0x14,%eax
+  80105c:	89 df                	mov    %ebx,%edi
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	8d 35 69 10 80 00    	lea    0x801069,%esi
+  801067:	0f 34                	sysenter
+  801069:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  80106a:	5b                   	pop    %ebx
+  80106b:	5e                   	pop    %esi
+  80106c:	5f                   	pop    %edi
+  80106d:	5d                   	pop    %ebp
+  80106e:	c3                   	ret
+
+0080106f <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	57                   	push   %edi
+  801073:	56                   	push   %esi
+  801074:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801075:	8b 55 08             	mov    0x8(%ebp),%edx
+  801078:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801080:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801083:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	8d 35 91 10 80 00    	lea    0x801091,%esi
+  80108f:	0f 34                	sysenter
+  801091:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  801092:	5b                   	pop    %ebx
+  801093:	5e                   	pop    %esi
+  801094:	5f                   	pop    %edi
+  801095:	5d                   	pop    %ebp
+  801096:	c3                   	ret
+
+00801097 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801097:	55                   	push   %ebp
+  801098:	89 e5                	mov    %esp,%ebp
+  80109a:	57                   	push   %edi
+  80109b:	56                   	push   %esi
+  80109c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80109d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010aa:	89 cb                	mov    %ecx,%ebx
+  8010ac:	89 cf                	mov    %ecx,%edi
+  8010ae:	89 ce                	mov    %ecx,%esi
+  8010b0:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  8010b2:	5b                   	pop    %ebx
+  8010b3:	5e                   	pop    %esi
+  8010b4:	5f                   	pop    %edi
+  8010b5:	5d                   	pop    %ebp
+  8010b6:	c3                   	ret
+
+008010b7 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  8010b7:	55                   	push   %ebp
+  8010b8:	89 e5                	mov    %esp,%ebp
+  8010ba:	57                   	push   %edi
+  8010bb:	56                   	push   %esi
+  8010bc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c5:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010ca:	89 cb                	mov    %ecx,%ebx
+  8010cc:	89 cf                	mov    %ecx,%edi
+  8010ce:	55                   	push   %ebp
+  8010cf:	89 e5                	mov    %esp,%ebp
+  8010d1:	8d 35 d9 10 80 00    	lea    0x8010d9,%esi
+  8010d7:	0f 34                	sysenter
+  8010d9:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8010da:	5b                   	pop    %ebx
+  8010db:	5e                   	pop    %esi
+  8010dc:	5f                   	pop    %edi
+  8010dd:	5d                   	pop    %ebp
+  8010de:	c3                   	ret
+
+008010df <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8010df:	55                   	push   %ebp
+  8010e0:	89 e5                	mov    %esp,%ebp
+  8010e2:	57                   	push   %edi
+  8010e3:	56                   	push   %esi
+  8010e4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ed:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010f2:	89 cb                	mov    %ecx,%ebx
+  8010f4:	89 cf                	mov    %ecx,%edi
+  8010f6:	55                   	push   %ebp
+  8010f7:	89 e5                	mov    %esp,%ebp
+  8010f9:	8d 35 01 11 80 00    	lea    0x801101,%esi
+  8010ff:	0f 34                	sysenter
+  801101:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  801102:	5b                   	pop    %ebx
+  801103:	5e                   	pop    %esi
+  801104:	5f                   	pop    %edi
+  801105:	5d                   	pop    %ebp
+  801106:	c3                   	ret
+
+00801107 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801107:	55                   	push   %ebp
+  801108:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80110a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80110d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801112:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801115:	5d                   	pop    %ebp
+  801116:	c3                   	ret
+
+00801117 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801117:	55                   	push   %ebp
+  801118:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80111a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80111d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801122:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801127:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80112c:	5d                   	pop    %ebp
+  80112d:	c3                   	ret
+
+0080112e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801131:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801136:	eb 02                	jmp    80113a <fd_alloc+0xc>
+  801138:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80113a:	89 c2                	mov    %eax,%edx
+  80113c:	c1 ea 16             	shr    $0x16,%edx
+  80113f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801146:	f6 c2 01             	test   $0x1,%dl
+  801149:	74 2b                	je     801176 <fd_alloc+0x48>
+  80114b:	89 c2                	mov    %eax,%edx
+  80114d:	c1 ea 0c             	shr    $0xc,%edx
+  801150:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801157:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80115d:	f6 c1 01             	test   $0x1,%cl
+  801160:	74 14                	je     801176 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801162:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801168:	75 ce                	jne    801138 <fd_alloc+0xa>
+  80116a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80116f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801174:	eb 05                	jmp    80117b <fd_alloc+0x4d>
+			return 0;
+  801176:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80117b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117e:	89 02                	mov    %eax,(%edx)
+}
+  801180:	89 c8                	mov    %ecx,%eax
+  801182:	5d                   	pop    %ebp
+  801183:	c3                   	ret
+
+00801184 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801184:	55                   	push   %ebp
+  801185:	89 e5                	mov    %esp,%ebp
+  801187:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80118a:	83 f8 1f             	cmp    $0x1f,%eax
+  80118d:	77 30                	ja     8011bf <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80118f:	c1 e0 0c             	shl    $0xc,%eax
+  801192:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801197:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80119d:	f6 c2 01             	test   $0x1,%dl
+  8011a0:	74 24                	je     8011c6 <fd_lookup+0x42>
+  8011a2:	89 c2                	mov    %eax,%edx
+  8011a4:	c1 ea 0c             	shr    $0xc,%edx
+  8011a7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011ae:	f6 c2 01             	test   $0x1,%dl
+  8011b1:	74 1a                	je     8011cd <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8011b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011b6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8011b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011bd:	5d                   	pop    %ebp
+  8011be:	c3                   	ret
+		return -E_INVAL;
+  8011bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011c4:	eb f7                	jmp    8011bd <fd_lookup+0x39>
+		return -E_INVAL;
+  8011c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011cb:	eb f0                	jmp    8011bd <fd_lookup+0x39>
+  8011cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011d2:	eb e9                	jmp    8011bd <fd_lookup+0x39>
+
+008011d4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011d4:	55                   	push   %ebp
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	53                   	push   %ebx
+  8011d8:	83 ec 04             	sub    $0x4,%esp
+  8011db:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8011de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e3:	eb 03                	jmp    8011e8 <dev_lookup+0x14>
+  8011e5:	83 c0 01             	add    $0x1,%eax
+  8011e8:	8b 1c 85 70 3d 80 00 	mov    0x803d70(,%eax,4),%ebx
+  8011ef:	85 db                	test   %ebx,%ebx
+  8011f1:	74 0b                	je     8011fe <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8011f3:	39 13                	cmp    %edx,(%ebx)
+  8011f5:	75 ee                	jne    8011e5 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8011f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011fc:	eb 1f                	jmp    80121d <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8011fe:	a1 00 50 80 00       	mov    0x805000,%eax
+  801203:	8b 40 48             	mov    0x48(%eax),%eax
+  801206:	83 ec 04             	sub    $0x4,%esp
+  801209:	52                   	push   %edx
+  80120a:	50                   	push   %eax
+  80120b:	68 f4 3c 80 00       	push   $0x803cf4
+  801210:	e8 f7 f0 ff ff       	call   80030c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801215:	83 c4 10             	add    $0x10,%esp
+  801218:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80121d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801220:	89 1a                	mov    %ebx,(%edx)
+}
+  801222:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801225:	c9                   	leave
+  801226:	c3                   	ret
+
+00801227 <fd_close>:
+{
+  801227:	55                   	push   %ebp
+  801228:	89 e5                	mov    %esp,%ebp
+  80122a:	57                   	push   %edi
+  80122b:	56                   	push   %esi
+  80122c:	53                   	push   %ebx
+  80122d:	83 ec 24             	sub    $0x24,%esp
+  801230:	8b 75 08             	mov    0x8(%ebp),%esi
+  801233:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801236:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801239:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80123a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801240:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801243:	50                   	push   %eax
+  801244:	e8 3b ff ff ff       	call   801184 <fd_lookup>
+  801249:	89 c3                	mov    %eax,%ebx
+  80124b:	83 c4 10             	add    $0x10,%esp
+  80124e:	85 c0                	test   %eax,%eax
+  801250:	78 05                	js     801257 <fd_close+0x30>
+	    || fd != fd2)
+  801252:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801255:	74 16                	je     80126d <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801257:	89 f8                	mov    %edi,%eax
+  801259:	84 c0                	test   %al,%al
+  80125b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801260:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801263:	89 d8                	mov    %ebx,%eax
+  801265:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801268:	5b                   	pop    %ebx
+  801269:	5e                   	pop    %esi
+  80126a:	5f                   	pop    %edi
+  80126b:	5d                   	pop    %ebp
+  80126c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80126d:	83 ec 08             	sub    $0x8,%esp
+  801270:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801273:	50                   	push   %eax
+  801274:	ff 36                	push   (%esi)
+  801276:	e8 59 ff ff ff       	call   8011d4 <dev_lookup>
+  80127b:	89 c3                	mov    %eax,%ebx
+  80127d:	83 c4 10             	add    $0x10,%esp
+  801280:	85 c0                	test   %eax,%eax
+  801282:	78 1a                	js     80129e <fd_close+0x77>
+		if (dev->dev_close)
+  801284:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801287:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80128a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80128f:	85 c0                	test   %eax,%eax
+  801291:	74 0b                	je     80129e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801293:	83 ec 0c             	sub    $0xc,%esp
+  801296:	56                   	push   %esi
+  801297:	ff d0                	call   *%eax
+  801299:	89 c3                	mov    %eax,%ebx
+  80129b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80129e:	83 ec 08             	sub    $0x8,%esp
+  8012a1:	56                   	push   %esi
+  8012a2:	6a 00                	push   $0x0
+  8012a4:	e8 ea fa ff ff       	call   800d93 <sys_page_unmap>
+	return r;
+  8012a9:	83 c4 10             	add    $0x10,%esp
+  8012ac:	eb b5                	jmp    801263 <fd_close+0x3c>
+
+008012ae <close>:
+
+int
+close(int fdnum)
+{
+  8012ae:	55                   	push   %ebp
+  8012af:	89 e5                	mov    %esp,%ebp
+  8012b1:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012b7:	50                   	push   %eax
+  8012b8:	ff 75 08             	push   0x8(%ebp)
+  8012bb:	e8 c4 fe ff ff       	call   801184 <fd_lookup>
+  8012c0:	83 c4 10             	add    $0x10,%esp
+  8012c3:	85 c0                	test   %eax,%eax
+  8012c5:	79 02                	jns    8012c9 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8012c7:	c9                   	leave
+  8012c8:	c3                   	ret
+		return fd_close(fd, 1);
+  8012c9:	83 ec 08             	sub    $0x8,%esp
+  8012cc:	6a 01                	push   $0x1
+  8012ce:	ff 75 f4             	push   -0xc(%ebp)
+  8012d1:	e8 51 ff ff ff       	call   801227 <fd_close>
+  8012d6:	83 c4 10             	add    $0x10,%esp
+  8012d9:	eb ec                	jmp    8012c7 <close+0x19>
+
+008012db <close_all>:
+
+void
+close_all(void)
+{
+  8012db:	55                   	push   %ebp
+  8012dc:	89 e5                	mov    %esp,%ebp
+  8012de:	53                   	push   %ebx
+  8012df:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8012e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8012e7:	83 ec 0c             	sub    $0xc,%esp
+  8012ea:	53                   	push   %ebx
+  8012eb:	e8 be ff ff ff       	call   8012ae <close>
+	for (i = 0; i < MAXFD; i++)
+  8012f0:	83 c3 01             	add    $0x1,%ebx
+  8012f3:	83 c4 10             	add    $0x10,%esp
+  8012f6:	83 fb 20             	cmp    $0x20,%ebx
+  8012f9:	75 ec                	jne    8012e7 <close_all+0xc>
+}
+  8012fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012fe:	c9                   	leave
+  8012ff:	c3                   	ret
+
+00801300 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801300:	55                   	push   %ebp
+  801301:	89 e5                	mov    %esp,%ebp
+  801303:	57                   	push   %edi
+  801304:	56                   	push   %esi
+  801305:	53                   	push   %ebx
+  801306:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801309:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80130c:	50                   	push   %eax
+  80130d:	ff 75 08             	push   0x8(%ebp)
+  801310:	e8 6f fe ff ff       	call   801184 <fd_lookup>
+  801315:	89 c3                	mov    %eax,%ebx
+  801317:	83 c4 10             	add    $0x10,%esp
+  80131a:	85 c0                	test   %eax,%eax
+  80131c:	78 7f                	js     80139d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80131e:	83 ec 0c             	sub    $0xc,%esp
+  801321:	ff 75 0c             	push   0xc(%ebp)
+  801324:	e8 85 ff ff ff       	call   8012ae <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801329:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80132c:	c1 e6 0c             	shl    $0xc,%esi
+  80132f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801335:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801338:	89 3c 24             	mov    %edi,(%esp)
+  80133b:	e8 d7 fd ff ff       	call   801117 <fd2data>
+  801340:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801342:	89 34 24             	mov    %esi,(%esp)
+  801345:	e8 cd fd ff ff       	call   801117 <fd2data>
+  80134a:	83 c4 10             	add    $0x10,%esp
+  80134d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801350:	89 d8                	mov    %ebx,%eax
+  801352:	c1 e8 16             	shr    $0x16,%eax
+  801355:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80135c:	a8 01                	test   $0x1,%al
+  80135e:	74 11                	je     801371 <dup+0x71>
+  801360:	89 d8                	mov    %ebx,%eax
+  801362:	c1 e8 0c             	shr    $0xc,%eax
+  801365:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80136c:	f6 c2 01             	test   $0x1,%dl
+  80136f:	75 36                	jne    8013a7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801371:	89 f8                	mov    %edi,%eax
+  801373:	c1 e8 0c             	shr    $0xc,%eax
+  801376:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80137d:	83 ec 0c             	sub    $0xc,%esp
+  801380:	25 07 0e 00 00       	and    $0xe07,%eax
+  801385:	50                   	push   %eax
+  801386:	56                   	push   %esi
+  801387:	6a 00                	push   $0x0
+  801389:	57                   	push   %edi
+  80138a:	6a 00                	push   $0x0
+  80138c:	e8 c0 f9 ff ff       	call   800d51 <sys_page_map>
+  801391:	89 c3                	mov    %eax,%ebx
+  801393:	83 c4 20             	add    $0x20,%esp
+  801396:	85 c0                	test   %eax,%eax
+  801398:	78 33                	js     8013cd <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80139a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80139d:	89 d8                	mov    %ebx,%eax
+  80139f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a2:	5b                   	pop    %ebx
+  8013a3:	5e                   	pop    %esi
+  8013a4:	5f                   	pop    %edi
+  8013a5:	5d                   	pop    %ebp
+  8013a6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013a7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013ae:	83 ec 0c             	sub    $0xc,%esp
+  8013b1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013b6:	50                   	push   %eax
+  8013b7:	ff 75 d4             	push   -0x2c(%ebp)
+  8013ba:	6a 00                	push   $0x0
+  8013bc:	53                   	push   %ebx
+  8013bd:	6a 00                	push   $0x0
+  8013bf:	e8 8d f9 ff ff       	call   800d51 <sys_page_map>
+  8013c4:	89 c3                	mov    %eax,%ebx
+  8013c6:	83 c4 20             	add    $0x20,%esp
+  8013c9:	85 c0                	test   %eax,%eax
+  8013cb:	79 a4                	jns    801371 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8013cd:	83 ec 08             	sub    $0x8,%esp
+  8013d0:	56                   	push   %esi
+  8013d1:	6a 00                	push   $0x0
+  8013d3:	e8 bb f9 ff ff       	call   800d93 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8013d8:	83 c4 08             	add    $0x8,%esp
+  8013db:	ff 75 d4             	push   -0x2c(%ebp)
+  8013de:	6a 00                	push   $0x0
+  8013e0:	e8 ae f9 ff ff       	call   800d93 <sys_page_unmap>
+	return r;
+  8013e5:	83 c4 10             	add    $0x10,%esp
+  8013e8:	eb b3                	jmp    80139d <dup+0x9d>
+
+008013ea <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8013ea:	55                   	push   %ebp
+  8013eb:	89 e5                	mov    %esp,%ebp
+  8013ed:	56                   	push   %esi
+  8013ee:	53                   	push   %ebx
+  8013ef:	83 ec 18             	sub    $0x18,%esp
+  8013f2:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013f5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013f8:	50                   	push   %eax
+  8013f9:	56                   	push   %esi
+  8013fa:	e8 85 fd ff ff       	call   801184 <fd_lookup>
+  8013ff:	83 c4 10             	add    $0x10,%esp
+  801402:	85 c0                	test   %eax,%eax
+  801404:	78 3c                	js     801442 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801406:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801409:	83 ec 08             	sub    $0x8,%esp
+  80140c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80140f:	50                   	push   %eax
+  801410:	ff 33                	push   (%ebx)
+  801412:	e8 bd fd ff ff       	call   8011d4 <dev_lookup>
+  801417:	83 c4 10             	add    $0x10,%esp
+  80141a:	85 c0                	test   %eax,%eax
+  80141c:	78 24                	js     801442 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80141e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801421:	83 e0 03             	and    $0x3,%eax
+  801424:	83 f8 01             	cmp    $0x1,%eax
+  801427:	74 20                	je     801449 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801429:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80142c:	8b 40 08             	mov    0x8(%eax),%eax
+  80142f:	85 c0                	test   %eax,%eax
+  801431:	74 37                	je     80146a <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801433:	83 ec 04             	sub    $0x4,%esp
+  801436:	ff 75 10             	push   0x10(%ebp)
+  801439:	ff 75 0c             	push   0xc(%ebp)
+  80143c:	53                   	push   %ebx
+  80143d:	ff d0                	call   *%eax
+  80143f:	83 c4 10             	add    $0x10,%esp
+}
+  801442:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801445:	5b                   	pop    %ebx
+  801446:	5e                   	pop    %esi
+  801447:	5d                   	pop    %ebp
+  801448:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801449:	a1 00 50 80 00       	mov    0x805000,%eax
+  80144e:	8b 40 48             	mov    0x48(%eax),%eax
+  801451:	83 ec 04             	sub    $0x4,%esp
+  801454:	56                   	push   %esi
+  801455:	50                   	push   %eax
+  801456:	68 35 3d 80 00       	push   $0x803d35
+  80145b:	e8 ac ee ff ff       	call   80030c <cprintf>
+		return -E_INVAL;
+  801460:	83 c4 10             	add    $0x10,%esp
+  801463:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801468:	eb d8                	jmp    801442 <read+0x58>
+		return -E_NOT_SUPP;
+  80146a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80146f:	eb d1                	jmp    801442 <read+0x58>
+
+00801471 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801471:	55                   	push   %ebp
+  801472:	89 e5                	mov    %esp,%ebp
+  801474:	57                   	push   %edi
+  801475:	56                   	push   %esi
+  801476:	53                   	push   %ebx
+  801477:	83 ec 0c             	sub    $0xc,%esp
+  80147a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80147d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801480:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801485:	eb 02                	jmp    801489 <readn+0x18>
+  801487:	01 c3                	add    %eax,%ebx
+  801489:	39 f3                	cmp    %esi,%ebx
+  80148b:	73 21                	jae    8014ae <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80148d:	83 ec 04             	sub    $0x4,%esp
+  801490:	89 f0                	mov    %esi,%eax
+  801492:	29 d8                	sub    %ebx,%eax
+  801494:	50                   	push   %eax
+  801495:	89 d8                	mov    %ebx,%eax
+  801497:	03 45 0c             	add    0xc(%ebp),%eax
+  80149a:	50                   	push   %eax
+  80149b:	57                   	push   %edi
+  80149c:	e8 49 ff ff ff       	call   8013ea <read>
+		if (m < 0)
+  8014a1:	83 c4 10             	add    $0x10,%esp
+  8014a4:	85 c0                	test   %eax,%eax
+  8014a6:	78 04                	js     8014ac <readn+0x3b>
+			return m;
+		if (m == 0)
+  8014a8:	75 dd                	jne    801487 <readn+0x16>
+  8014aa:	eb 02                	jmp    8014ae <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014ac:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8014ae:	89 d8                	mov    %ebx,%eax
+  8014b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b3:	5b                   	pop    %ebx
+  8014b4:	5e                   	pop    %esi
+  8014b5:	5f                   	pop    %edi
+  8014b6:	5d                   	pop    %ebp
+  8014b7:	c3                   	ret
+
+008014b8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8014b8:	55                   	push   %ebp
+  8014b9:	89 e5                	mov    %esp,%ebp
+  8014bb:	56                   	push   %esi
+  8014bc:	53                   	push   %ebx
+  8014bd:	83 ec 18             	sub    $0x18,%esp
+  8014c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014c3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014c6:	50                   	push   %eax
+  8014c7:	53                   	push   %ebx
+  8014c8:	e8 b7 fc ff ff       	call   801184 <fd_lookup>
+  8014cd:	83 c4 10             	add    $0x10,%esp
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	78 37                	js     80150b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014d4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014d7:	83 ec 08             	sub    $0x8,%esp
+  8014da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014dd:	50                   	push   %eax
+  8014de:	ff 36                	push   (%esi)
+  8014e0:	e8 ef fc ff ff       	call   8011d4 <dev_lookup>
+  8014e5:	83 c4 10             	add    $0x10,%esp
+  8014e8:	85 c0                	test   %eax,%eax
+  8014ea:	78 1f                	js     80150b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014ec:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014f0:	74 20                	je     801512 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8014f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014f5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014f8:	85 c0                	test   %eax,%eax
+  8014fa:	74 37                	je     801533 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8014fc:	83 ec 04             	sub    $0x4,%esp
+  8014ff:	ff 75 10             	push   0x10(%ebp)
+  801502:	ff 75 0c             	push   0xc(%ebp)
+  801505:	56                   	push   %esi
+  801506:	ff d0                	call   *%eax
+  801508:	83 c4 10             	add    $0x10,%esp
+}
+  80150b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80150e:	5b                   	pop    %ebx
+  80150f:	5e                   	pop    %esi
+  801510:	5d                   	pop    %ebp
+  801511:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801512:	a1 00 50 80 00       	mov    0x805000,%eax
+  801517:	8b 40 48             	mov    0x48(%eax),%eax
+  80151a:	83 ec 04             	sub    $0x4,%esp
+  80151d:	53                   	push   %ebx
+  80151e:	50                   	push   %eax
+  80151f:	68 51 3d 80 00       	push   $0x803d51
+  801524:	e8 e3 ed ff ff       	call   80030c <cprintf>
+		return -E_INVAL;
+  801529:	83 c4 10             	add    $0x10,%esp
+  80152c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801531:	eb d8                	jmp    80150b <write+0x53>
+		return -E_NOT_SUPP;
+  801533:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801538:	eb d1                	jmp    80150b <write+0x53>
+
+0080153a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80153a:	55                   	push   %ebp
+  80153b:	89 e5                	mov    %esp,%ebp
+  80153d:	53                   	push   %ebx
+  80153e:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801541:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801544:	50                   	push   %eax
+  801545:	ff 75 08             	push   0x8(%ebp)
+  801548:	e8 37 fc ff ff       	call   801184 <fd_lookup>
+  80154d:	83 c4 10             	add    $0x10,%esp
+  801550:	85 c0                	test   %eax,%eax
+  801552:	78 3a                	js     80158e <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801554:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801557:	83 ec 08             	sub    $0x8,%esp
+  80155a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80155d:	50                   	push   %eax
+  80155e:	ff 33                	push   (%ebx)
+  801560:	e8 6f fc ff ff       	call   8011d4 <dev_lookup>
+  801565:	83 c4 10             	add    $0x10,%esp
+  801568:	85 c0                	test   %eax,%eax
+  80156a:	78 22                	js     80158e <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  80156c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80156f:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801572:	85 c0                	test   %eax,%eax
+  801574:	74 0d                	je     801583 <seek+0x49>
+  801576:	83 ec 0c             	sub    $0xc,%esp
+  801579:	53                   	push   %ebx
+  80157a:	ff d0                	call   *%eax
+  80157c:	83 c4 10             	add    $0x10,%esp
+  80157f:	85 c0                	test   %eax,%eax
+  801581:	78 0b                	js     80158e <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801583:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801586:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801589:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80158e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801591:	c9                   	leave
+  801592:	c3                   	ret
+
+00801593 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801593:	55                   	push   %ebp
+  801594:	89 e5                	mov    %esp,%ebp
+  801596:	53                   	push   %ebx
+  801597:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80159a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80159d:	50                   	push   %eax
+  80159e:	ff 75 08             	push   0x8(%ebp)
+  8015a1:	e8 de fb ff ff       	call   801184 <fd_lookup>
+  8015a6:	83 c4 10             	add    $0x10,%esp
+  8015a9:	85 c0                	test   %eax,%eax
+  8015ab:	78 2b                	js     8015d8 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015ad:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8015b0:	83 ec 08             	sub    $0x8,%esp
+  8015b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015b6:	50                   	push   %eax
+  8015b7:	ff 33                	push   (%ebx)
+  8015b9:	e8 16 fc ff ff       	call   8011d4 <dev_lookup>
+  8015be:	83 c4 10             	add    $0x10,%esp
+  8015c1:	85 c0                	test   %eax,%eax
+  8015c3:	78 13                	js     8015d8 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8015c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015c8:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8015cb:	85 c0                	test   %eax,%eax
+  8015cd:	74 0e                	je     8015dd <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8015cf:	83 ec 0c             	sub    $0xc,%esp
+  8015d2:	53                   	push   %ebx
+  8015d3:	ff d0                	call   *%eax
+  8015d5:	83 c4 10             	add    $0x10,%esp
+}
+  8015d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015db:	c9                   	leave
+  8015dc:	c3                   	ret
+		return 0;
+  8015dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e2:	eb f4                	jmp    8015d8 <fsync+0x45>
+
+008015e4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8015e4:	55                   	push   %ebp
+  8015e5:	89 e5                	mov    %esp,%ebp
+  8015e7:	56                   	push   %esi
+  8015e8:	53                   	push   %ebx
+  8015e9:	83 ec 18             	sub    $0x18,%esp
+  8015ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ef:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015f2:	50                   	push   %eax
+  8015f3:	53                   	push   %ebx
+  8015f4:	e8 8b fb ff ff       	call   801184 <fd_lookup>
+  8015f9:	83 c4 10             	add    $0x10,%esp
+  8015fc:	85 c0                	test   %eax,%eax
+  8015fe:	78 34                	js     801634 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801600:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801603:	83 ec 08             	sub    $0x8,%esp
+  801606:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801609:	50                   	push   %eax
+  80160a:	ff 36                	push   (%esi)
+  80160c:	e8 c3 fb ff ff       	call   8011d4 <dev_lookup>
+  801611:	83 c4 10             	add    $0x10,%esp
+  801614:	85 c0                	test   %eax,%eax
+  801616:	78 1c                	js     801634 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801618:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80161c:	74 1d                	je     80163b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80161e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801621:	8b 40 18             	mov    0x18(%eax),%eax
+  801624:	85 c0                	test   %eax,%eax
+  801626:	74 34                	je     80165c <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801628:	83 ec 08             	sub    $0x8,%esp
+  80162b:	ff 75 0c             	push   0xc(%ebp)
+  80162e:	56                   	push   %esi
+  80162f:	ff d0                	call   *%eax
+  801631:	83 c4 10             	add    $0x10,%esp
+}
+  801634:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801637:	5b                   	pop    %ebx
+  801638:	5e                   	pop    %esi
+  801639:	5d                   	pop    %ebp
+  80163a:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80163b:	a1 00 50 80 00       	mov    0x805000,%eax
+  801640:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801643:	83 ec 04             	sub    $0x4,%esp
+  801646:	53                   	push   %ebx
+  801647:	50                   	push   %eax
+  801648:	68 14 3d 80 00       	push   $0x803d14
+  80164d:	e8 ba ec ff ff       	call   80030c <cprintf>
+		return -E_INVAL;
+  801652:	83 c4 10             	add    $0x10,%esp
+  801655:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80165a:	eb d8                	jmp    801634 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80165c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801661:	eb d1                	jmp    801634 <ftruncate+0x50>
+
+00801663 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801663:	55                   	push   %ebp
+  801664:	89 e5                	mov    %esp,%ebp
+  801666:	56                   	push   %esi
+  801667:	53                   	push   %ebx
+  801668:	83 ec 18             	sub    $0x18,%esp
+  80166b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80166e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801671:	50                   	push   %eax
+  801672:	ff 75 08             	push   0x8(%ebp)
+  801675:	e8 0a fb ff ff       	call   801184 <fd_lookup>
+  80167a:	83 c4 10             	add    $0x10,%esp
+  80167d:	85 c0                	test   %eax,%eax
+  80167f:	78 49                	js     8016ca <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801681:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801684:	83 ec 08             	sub    $0x8,%esp
+  801687:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80168a:	50                   	push   %eax
+  80168b:	ff 36                	push   (%esi)
+  80168d:	e8 42 fb ff ff       	call   8011d4 <dev_lookup>
+  801692:	83 c4 10             	add    $0x10,%esp
+  801695:	85 c0                	test   %eax,%eax
+  801697:	78 31                	js     8016ca <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801699:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80169c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016a0:	74 2f                	je     8016d1 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016a2:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016a5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016ac:	00 00 00 
+	stat->st_isdir = 0;
+  8016af:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016b6:	00 00 00 
+	stat->st_dev = dev;
+  8016b9:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8016bf:	83 ec 08             	sub    $0x8,%esp
+  8016c2:	53                   	push   %ebx
+  8016c3:	56                   	push   %esi
+  8016c4:	ff 50 14             	call   *0x14(%eax)
+  8016c7:	83 c4 10             	add    $0x10,%esp
+}
+  8016ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016cd:	5b                   	pop    %ebx
+  8016ce:	5e                   	pop    %esi
+  8016cf:	5d                   	pop    %ebp
+  8016d0:	c3                   	ret
+		return -E_NOT_SUPP;
+  8016d1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016d6:	eb f2                	jmp    8016ca <fstat+0x67>
+
+008016d8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8016d8:	55                   	push   %ebp
+  8016d9:	89 e5                	mov    %esp,%ebp
+  8016db:	56                   	push   %esi
+  8016dc:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  8016dd:	83 ec 08             	sub    $0x8,%esp
+  8016e0:	68 00 10 00 00       	push   $0x1000
+  8016e5:	ff 75 08             	push   0x8(%ebp)
+  8016e8:	e8 b3 07 00 00       	call   801ea0 <open>
+  8016ed:	89 c3                	mov    %eax,%ebx
+  8016ef:	83 c4 10             	add    $0x10,%esp
+  8016f2:	85 c0                	test   %eax,%eax
+  8016f4:	78 1b                	js     801711 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  8016f6:	83 ec 08             	sub    $0x8,%esp
+  8016f9:	ff 75 0c             	push   0xc(%ebp)
+  8016fc:	50                   	push   %eax
+  8016fd:	e8 61 ff ff ff       	call   801663 <fstat>
+  801702:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801704:	89 1c 24             	mov    %ebx,(%esp)
+  801707:	e8 a2 fb ff ff       	call   8012ae <close>
+	return r;
+  80170c:	83 c4 10             	add    $0x10,%esp
+  80170f:	89 f3                	mov    %esi,%ebx
+}
+  801711:	89 d8                	mov    %ebx,%eax
+  801713:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801716:	5b                   	pop    %ebx
+  801717:	5e                   	pop    %esi
+  801718:	5d                   	pop    %ebp
+  801719:	c3                   	ret
+
+0080171a <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  80171a:	55                   	push   %ebp
+  80171b:	89 e5                	mov    %esp,%ebp
+  80171d:	57                   	push   %edi
+  80171e:	56                   	push   %esi
+  80171f:	53                   	push   %ebx
+  801720:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801726:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  80172c:	89 d6                	mov    %edx,%esi
+  80172e:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801734:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801737:	89 d3                	mov    %edx,%ebx
+  801739:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  80173f:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801746:	74 1d                	je     801765 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801748:	b8 00 60 80 00       	mov    $0x806000,%eax
+  80174d:	83 c8 07             	or     $0x7,%eax
+  801750:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801756:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  80175b:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801761:	01 ce                	add    %ecx,%esi
+  801763:	eb 28                	jmp    80178d <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801765:	83 ec 0c             	sub    $0xc,%esp
+  801768:	6a 01                	push   $0x1
+  80176a:	e8 0c 1e 00 00       	call   80357b <ipc_find_env>
+  80176f:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801774:	83 c4 10             	add    $0x10,%esp
+  801777:	eb cf                	jmp    801748 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801779:	83 c0 01             	add    $0x1,%eax
+  80177c:	89 fa                	mov    %edi,%edx
+  80177e:	09 da                	or     %ebx,%edx
+  801780:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801787:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80178d:	39 f3                	cmp    %esi,%ebx
+  80178f:	72 e8                	jb     801779 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801791:	83 f8 41             	cmp    $0x41,%eax
+  801794:	77 2f                	ja     8017c5 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801796:	50                   	push   %eax
+  801797:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  80179d:	50                   	push   %eax
+  80179e:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  8017a4:	ff 35 c8 70 80 00    	push   0x8070c8
+  8017aa:	e8 7e 1d 00 00       	call   80352d <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  8017af:	83 c4 0c             	add    $0xc,%esp
+  8017b2:	6a 00                	push   $0x0
+  8017b4:	6a 00                	push   $0x0
+  8017b6:	6a 00                	push   $0x0
+  8017b8:	e8 1a 1c 00 00       	call   8033d7 <ipc_recv>
+}
+  8017bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c0:	5b                   	pop    %ebx
+  8017c1:	5e                   	pop    %esi
+  8017c2:	5f                   	pop    %edi
+  8017c3:	5d                   	pop    %ebp
+  8017c4:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  8017c5:	68 84 3d 80 00       	push   $0x803d84
+  8017ca:	68 a0 3d 80 00       	push   $0x803da0
+  8017cf:	6a 40                	push   $0x40
+  8017d1:	68 b5 3d 80 00       	push   $0x803db5
+  8017d6:	e8 56 ea ff ff       	call   800231 <_panic>
+
+008017db <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  8017db:	55                   	push   %ebp
+  8017dc:	89 e5                	mov    %esp,%ebp
+  8017de:	57                   	push   %edi
+  8017df:	56                   	push   %esi
+  8017e0:	53                   	push   %ebx
+  8017e1:	83 ec 1c             	sub    $0x1c,%esp
+  8017e4:	89 c3                	mov    %eax,%ebx
+  8017e6:	89 d6                	mov    %edx,%esi
+  8017e8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  8017eb:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  8017f1:	89 ca                	mov    %ecx,%edx
+  8017f3:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  8017f6:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  8017fd:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801800:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801807:	8b 76 0c             	mov    0xc(%esi),%esi
+  80180a:	89 fb                	mov    %edi,%ebx
+  80180c:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801813:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801816:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  80181d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801820:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801827:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80182a:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801831:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801834:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  80183b:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801840:	39 c8                	cmp    %ecx,%eax
+  801842:	74 0d                	je     801851 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801844:	b8 00 00 00 00       	mov    $0x0,%eax
+  801849:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80184c:	5b                   	pop    %ebx
+  80184d:	5e                   	pop    %esi
+  80184e:	5f                   	pop    %edi
+  80184f:	5d                   	pop    %ebp
+  801850:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801851:	6a 07                	push   $0x7
+  801853:	68 00 60 80 00       	push   $0x806000
+  801858:	6a 0d                	push   $0xd
+  80185a:	ff 35 c8 70 80 00    	push   0x8070c8
+  801860:	e8 dd 1b 00 00       	call   803442 <ipc_send>
+  801865:	83 c4 10             	add    $0x10,%esp
+  801868:	eb da                	jmp    801844 <fsring_post+0x69>
+
+0080186a <fsipcv>:
+{
+  80186a:	55                   	push   %ebp
+  80186b:	89 e5                	mov    %esp,%ebp
+  80186d:	57                   	push   %edi
+  80186e:	56                   	push   %esi
+  80186f:	53                   	push   %ebx
+  801870:	83 ec 0c             	sub    $0xc,%esp
+  801873:	89 c7                	mov    %eax,%edi
+  801875:	89 d3                	mov    %edx,%ebx
+  801877:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801879:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801880:	74 26                	je     8018a8 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801882:	6a 07                	push   $0x7
+  801884:	68 00 60 80 00       	push   $0x806000
+  801889:	57                   	push   %edi
+  80188a:	ff 35 c8 70 80 00    	push   0x8070c8
+  801890:	e8 ad 1b 00 00       	call   803442 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801895:	6a 00                	push   $0x0
+  801897:	56                   	push   %esi
+  801898:	53                   	push   %ebx
+  801899:	6a 00                	push   $0x0
+  80189b:	e8 fa 1b 00 00       	call   80349a <ipc_recvv>
+}
+  8018a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a3:	5b                   	pop    %ebx
+  8018a4:	5e                   	pop    %esi
+  8018a5:	5f                   	pop    %edi
+  8018a6:	5d                   	pop    %ebp
+  8018a7:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018a8:	83 ec 0c             	sub    $0xc,%esp
+  8018ab:	6a 01                	push   $0x1
+  8018ad:	e8 c9 1c 00 00       	call   80357b <ipc_find_env>
+  8018b2:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8018b7:	83 c4 10             	add    $0x10,%esp
+  8018ba:	eb c6                	jmp    801882 <fsipcv+0x18>
+
+008018bc <fsipc>:
+{
+  8018bc:	55                   	push   %ebp
+  8018bd:	89 e5                	mov    %esp,%ebp
+  8018bf:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  8018c2:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  8018c9:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8018cc:	e8 99 ff ff ff       	call   80186a <fsipcv>
+}
+  8018d1:	c9                   	leave
+  8018d2:	c3                   	ret
+
+008018d3 <file_write_direct>:
+{
+  8018d3:	55                   	push   %ebp
+  8018d4:	89 e5                	mov    %esp,%ebp
+  8018d6:	56                   	push   %esi
+  8018d7:	53                   	push   %ebx
+  8018d8:	89 c3                	mov    %eax,%ebx
+  8018da:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8018dc:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  8018e2:	77 40                	ja     801924 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8018e4:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  8018e9:	39 c8                	cmp    %ecx,%eax
+  8018eb:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8018ee:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  8018f1:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  8018f7:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8018fc:	83 ec 04             	sub    $0x4,%esp
+  8018ff:	50                   	push   %eax
+  801900:	52                   	push   %edx
+  801901:	68 08 60 80 00       	push   $0x806008
+  801906:	e8 75 f1 ff ff       	call   800a80 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80190b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801910:	b8 04 00 00 00       	mov    $0x4,%eax
+  801915:	e8 a2 ff ff ff       	call   8018bc <fsipc>
+  80191a:	83 c4 10             	add    $0x10,%esp
+}
+  80191d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801920:	5b                   	pop    %ebx
+  801921:	5e                   	pop    %esi
+  801922:	5d                   	pop    %ebp
+  801923:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801924:	89 d6                	mov    %edx,%esi
+  801926:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80192c:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801931:	29 f1                	sub    %esi,%ecx
+  801933:	39 c1                	cmp    %eax,%ecx
+  801935:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801938:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80193b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801940:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801946:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  80194c:	83 ec 0c             	sub    $0xc,%esp
+  80194f:	6a 05                	push   $0x5
+  801951:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801956:	e8 bf fd ff ff       	call   80171a <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  80195b:	83 c4 10             	add    $0x10,%esp
+  80195e:	eb bd                	jmp    80191d <file_write_direct+0x4a>
+
+00801960 <devfile_sync>:
+{
+  801960:	55                   	push   %ebp
+  801961:	89 e5                	mov    %esp,%ebp
+  801963:	57                   	push   %edi
+  801964:	56                   	push   %esi
+  801965:	53                   	push   %ebx
+  801966:	83 ec 28             	sub    $0x28,%esp
+  801969:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  80196c:	56                   	push   %esi
+  80196d:	e8 a5 f7 ff ff       	call   801117 <fd2data>
+  801972:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801974:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801977:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  80197e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801981:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801986:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  80198a:	74 45                	je     8019d1 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  80198c:	8b 46 14             	mov    0x14(%esi),%eax
+  80198f:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801992:	b8 00 00 00 00       	mov    $0x0,%eax
+  801997:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80199c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  80199f:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  8019a2:	39 cb                	cmp    %ecx,%ebx
+  8019a4:	73 14                	jae    8019ba <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  8019a6:	29 d9                	sub    %ebx,%ecx
+  8019a8:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8019ab:	89 f0                	mov    %esi,%eax
+  8019ad:	e8 21 ff ff ff       	call   8018d3 <file_write_direct>
+  8019b2:	85 c0                	test   %eax,%eax
+  8019b4:	7e 04                	jle    8019ba <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8019b6:	01 c3                	add    %eax,%ebx
+  8019b8:	eb e5                	jmp    80199f <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  8019ba:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019bd:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  8019c4:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  8019c7:	85 c0                	test   %eax,%eax
+  8019c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ce:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8019d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d4:	5b                   	pop    %ebx
+  8019d5:	5e                   	pop    %esi
+  8019d6:	5f                   	pop    %edi
+  8019d7:	5d                   	pop    %ebp
+  8019d8:	c3                   	ret
+
+008019d9 <devfile_write>:
+{
+  8019d9:	55                   	push   %ebp
+  8019da:	89 e5                	mov    %esp,%ebp
+  8019dc:	57                   	push   %edi
+  8019dd:	56                   	push   %esi
+  8019de:	53                   	push   %ebx
+  8019df:	83 ec 28             	sub    $0x28,%esp
+  8019e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019e5:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8019e8:	53                   	push   %ebx
+  8019e9:	e8 29 f7 ff ff       	call   801117 <fd2data>
+  8019ee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8019f1:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8019f4:	83 c4 10             	add    $0x10,%esp
+  8019f7:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8019fb:	74 43                	je     801a40 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  8019fd:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801a04:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801a07:	85 c0                	test   %eax,%eax
+  801a09:	74 43                	je     801a4e <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801a0b:	89 c2                	mov    %eax,%edx
+  801a0d:	03 53 14             	add    0x14(%ebx),%edx
+  801a10:	39 fa                	cmp    %edi,%edx
+  801a12:	75 0b                	jne    801a1f <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801a14:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801a17:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801a1d:	76 66                	jbe    801a85 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801a1f:	83 ec 0c             	sub    $0xc,%esp
+  801a22:	53                   	push   %ebx
+  801a23:	e8 38 ff ff ff       	call   801960 <devfile_sync>
+  801a28:	83 c4 10             	add    $0x10,%esp
+  801a2b:	85 c0                	test   %eax,%eax
+  801a2d:	78 4e                	js     801a7d <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801a2f:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801a35:	77 56                	ja     801a8d <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801a37:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801a3a:	85 c0                	test   %eax,%eax
+  801a3c:	75 20                	jne    801a5e <devfile_write+0x85>
+  801a3e:	eb 16                	jmp    801a56 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801a40:	89 f1                	mov    %esi,%ecx
+  801a42:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a45:	89 d8                	mov    %ebx,%eax
+  801a47:	e8 87 fe ff ff       	call   8018d3 <file_write_direct>
+  801a4c:	eb 2f                	jmp    801a7d <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801a4e:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801a54:	77 37                	ja     801a8d <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801a56:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801a59:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801a5e:	83 ec 04             	sub    $0x4,%esp
+  801a61:	56                   	push   %esi
+  801a62:	ff 75 0c             	push   0xc(%ebp)
+  801a65:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801a68:	01 c1                	add    %eax,%ecx
+  801a6a:	51                   	push   %ecx
+  801a6b:	e8 10 f0 ff ff       	call   800a80 <memmove>
+	ff->buf_wlen += n;
+  801a70:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801a73:	01 f7                	add    %esi,%edi
+  801a75:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801a78:	89 f0                	mov    %esi,%eax
+  801a7a:	83 c4 10             	add    $0x10,%esp
+}
+  801a7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a80:	5b                   	pop    %ebx
+  801a81:	5e                   	pop    %esi
+  801a82:	5f                   	pop    %edi
+  801a83:	5d                   	pop    %ebp
+  801a84:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801a85:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801a8b:	76 d1                	jbe    801a5e <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801a8d:	89 f1                	mov    %esi,%ecx
+  801a8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a92:	89 d8                	mov    %ebx,%eax
+  801a94:	e8 3a fe ff ff       	call   8018d3 <file_write_direct>
+  801a99:	eb e2                	jmp    801a7d <devfile_write+0xa4>
+
+00801a9b <devfile_trunc>:
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	53                   	push   %ebx
+  801a9f:	83 ec 10             	sub    $0x10,%esp
+  801aa2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801aa5:	53                   	push   %ebx
+  801aa6:	e8 b5 fe ff ff       	call   801960 <devfile_sync>
+  801aab:	83 c4 10             	add    $0x10,%esp
+  801aae:	85 c0                	test   %eax,%eax
+  801ab0:	78 1f                	js     801ad1 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ab2:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801ab5:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801aba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801abd:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ac2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac7:	b8 02 00 00 00       	mov    $0x2,%eax
+  801acc:	e8 eb fd ff ff       	call   8018bc <fsipc>
+}
+  801ad1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ad4:	c9                   	leave
+  801ad5:	c3                   	ret
+
+00801ad6 <devfile_stat>:
+{
+  801ad6:	55                   	push   %ebp
+  801ad7:	89 e5                	mov    %esp,%ebp
+  801ad9:	56                   	push   %esi
+  801ada:	53                   	push   %ebx
+  801adb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ade:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801ae1:	83 ec 0c             	sub    $0xc,%esp
+  801ae4:	53                   	push   %ebx
+  801ae5:	e8 76 fe ff ff       	call   801960 <devfile_sync>
+  801aea:	83 c4 10             	add    $0x10,%esp
+  801aed:	85 c0                	test   %eax,%eax
+  801aef:	78 47                	js     801b38 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801af1:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801af4:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801af9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801afe:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b03:	e8 b4 fd ff ff       	call   8018bc <fsipc>
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	78 2c                	js     801b38 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b0c:	83 ec 08             	sub    $0x8,%esp
+  801b0f:	68 00 60 80 00       	push   $0x806000
+  801b14:	56                   	push   %esi
+  801b15:	e8 e0 ed ff ff       	call   8008fa <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801b1a:	a1 80 60 80 00       	mov    0x806080,%eax
+  801b1f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b25:	a1 84 60 80 00       	mov    0x806084,%eax
+  801b2a:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801b30:	83 c4 10             	add    $0x10,%esp
+  801b33:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b3b:	5b                   	pop    %ebx
+  801b3c:	5e                   	pop    %esi
+  801b3d:	5d                   	pop    %ebp
+  801b3e:	c3                   	ret
+
+00801b3f <devfile_flush>:
+{
+  801b3f:	55                   	push   %ebp
+  801b40:	89 e5                	mov    %esp,%ebp
+  801b42:	56                   	push   %esi
+  801b43:	53                   	push   %ebx
+  801b44:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801b47:	83 ec 0c             	sub    $0xc,%esp
+  801b4a:	56                   	push   %esi
+  801b4b:	e8 10 fe ff ff       	call   801960 <devfile_sync>
+  801b50:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801b52:	83 c4 10             	add    $0x10,%esp
+  801b55:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801b59:	75 25                	jne    801b80 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b5b:	8b 46 0c             	mov    0xc(%esi),%eax
+  801b5e:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801b63:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b68:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b6d:	e8 4a fd ff ff       	call   8018bc <fsipc>
+  801b72:	85 c0                	test   %eax,%eax
+  801b74:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801b77:	89 d8                	mov    %ebx,%eax
+  801b79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b7c:	5b                   	pop    %ebx
+  801b7d:	5e                   	pop    %esi
+  801b7e:	5d                   	pop    %ebp
+  801b7f:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801b80:	83 ec 0c             	sub    $0xc,%esp
+  801b83:	56                   	push   %esi
+  801b84:	e8 8e f5 ff ff       	call   801117 <fd2data>
+  801b89:	83 c4 08             	add    $0x8,%esp
+  801b8c:	50                   	push   %eax
+  801b8d:	6a 00                	push   $0x0
+  801b8f:	e8 ff f1 ff ff       	call   800d93 <sys_page_unmap>
+  801b94:	83 c4 10             	add    $0x10,%esp
+  801b97:	eb c2                	jmp    801b5b <devfile_flush+0x1c>
+
+00801b99 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801b99:	55                   	push   %ebp
+  801b9a:	89 e5                	mov    %esp,%ebp
+  801b9c:	57                   	push   %edi
+  801b9d:	56                   	push   %esi
+  801b9e:	53                   	push   %ebx
+  801b9f:	83 ec 64             	sub    $0x64,%esp
+  801ba2:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801ba4:	52                   	push   %edx
+  801ba5:	50                   	push   %eax
+  801ba6:	e8 d9 f5 ff ff       	call   801184 <fd_lookup>
+  801bab:	89 c1                	mov    %eax,%ecx
+  801bad:	83 c4 10             	add    $0x10,%esp
+  801bb0:	85 c0                	test   %eax,%eax
+  801bb2:	0f 88 f2 00 00 00    	js     801caa <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801bb8:	8b 07                	mov    (%edi),%eax
+  801bba:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801bc0:	39 10                	cmp    %edx,(%eax)
+  801bc2:	0f 85 03 01 00 00    	jne    801ccb <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801bc8:	a1 00 50 80 00       	mov    0x805000,%eax
+  801bcd:	8b 40 48             	mov    0x48(%eax),%eax
+  801bd0:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801bd6:	0f 84 96 00 00 00    	je     801c72 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801bdc:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801be3:	0f 84 cb 00 00 00    	je     801cb4 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801be9:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801bee:	83 c8 07             	or     $0x7,%eax
+  801bf1:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801bf4:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801bf7:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801bfc:	83 ec 04             	sub    $0x4,%esp
+  801bff:	68 07 04 00 00       	push   $0x407
+  801c04:	53                   	push   %ebx
+  801c05:	6a 00                	push   $0x0
+  801c07:	e8 fa f0 ff ff       	call   800d06 <sys_page_alloc>
+  801c0c:	89 c1                	mov    %eax,%ecx
+  801c0e:	83 c4 10             	add    $0x10,%esp
+  801c11:	85 c0                	test   %eax,%eax
+  801c13:	0f 88 91 00 00 00    	js     801caa <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801c19:	89 d8                	mov    %ebx,%eax
+  801c1b:	83 c8 07             	or     $0x7,%eax
+  801c1e:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801c20:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c26:	83 c6 04             	add    $0x4,%esi
+  801c29:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801c2f:	75 cb                	jne    801bfc <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801c31:	6a 12                	push   $0x12
+  801c33:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801c36:	50                   	push   %eax
+  801c37:	6a 0c                	push   $0xc
+  801c39:	ff 35 c8 70 80 00    	push   0x8070c8
+  801c3f:	e8 e9 18 00 00       	call   80352d <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801c44:	83 c4 0c             	add    $0xc,%esp
+  801c47:	6a 00                	push   $0x0
+  801c49:	6a 00                	push   $0x0
+  801c4b:	6a 00                	push   $0x0
+  801c4d:	e8 85 17 00 00       	call   8033d7 <ipc_recv>
+  801c52:	89 c1                	mov    %eax,%ecx
+  801c54:	83 c4 10             	add    $0x10,%esp
+  801c57:	85 c0                	test   %eax,%eax
+  801c59:	78 4f                	js     801caa <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801c5b:	a1 00 50 80 00       	mov    0x805000,%eax
+  801c60:	8b 40 48             	mov    0x48(%eax),%eax
+  801c63:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801c68:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801c6f:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801c72:	83 ec 0c             	sub    $0xc,%esp
+  801c75:	ff 37                	push   (%edi)
+  801c77:	e8 e4 fc ff ff       	call   801960 <devfile_sync>
+  801c7c:	89 c1                	mov    %eax,%ecx
+  801c7e:	83 c4 10             	add    $0x10,%esp
+  801c81:	85 c0                	test   %eax,%eax
+  801c83:	78 25                	js     801caa <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801c85:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801c8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801c90:	ba 01 00 00 00       	mov    $0x1,%edx
+  801c95:	89 d0                	mov    %edx,%eax
+  801c97:	d3 e0                	shl    %cl,%eax
+  801c99:	85 d8                	test   %ebx,%eax
+  801c9b:	74 0d                	je     801caa <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801c9d:	83 c1 01             	add    $0x1,%ecx
+  801ca0:	83 f9 10             	cmp    $0x10,%ecx
+  801ca3:	75 f0                	jne    801c95 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801ca5:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801caa:	89 c8                	mov    %ecx,%eax
+  801cac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801caf:	5b                   	pop    %ebx
+  801cb0:	5e                   	pop    %esi
+  801cb1:	5f                   	pop    %edi
+  801cb2:	5d                   	pop    %ebp
+  801cb3:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801cb4:	83 ec 0c             	sub    $0xc,%esp
+  801cb7:	6a 01                	push   $0x1
+  801cb9:	e8 bd 18 00 00       	call   80357b <ipc_find_env>
+  801cbe:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801cc3:	83 c4 10             	add    $0x10,%esp
+  801cc6:	e9 1e ff ff ff       	jmp    801be9 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801ccb:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801cd0:	eb d8                	jmp    801caa <fsring_slot+0x111>
+
+00801cd2 <file_read_direct>:
+{
+  801cd2:	55                   	push   %ebp
+  801cd3:	89 e5                	mov    %esp,%ebp
+  801cd5:	57                   	push   %edi
+  801cd6:	56                   	push   %esi
+  801cd7:	53                   	push   %ebx
+  801cd8:	83 ec 1c             	sub    $0x1c,%esp
+  801cdb:	89 c7                	mov    %eax,%edi
+  801cdd:	89 d6                	mov    %edx,%esi
+  801cdf:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801ce1:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801ce7:	77 52                	ja     801d3b <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ce9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cec:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801cf1:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801cf7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cfc:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d01:	e8 b6 fb ff ff       	call   8018bc <fsipc>
+  801d06:	89 c7                	mov    %eax,%edi
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	78 25                	js     801d31 <file_read_direct+0x5f>
+	assert(r <= n);
+  801d0c:	39 c3                	cmp    %eax,%ebx
+  801d0e:	0f 82 87 00 00 00    	jb     801d9b <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801d14:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801d19:	0f 8f 95 00 00 00    	jg     801db4 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801d1f:	83 ec 04             	sub    $0x4,%esp
+  801d22:	50                   	push   %eax
+  801d23:	68 00 60 80 00       	push   $0x806000
+  801d28:	56                   	push   %esi
+  801d29:	e8 52 ed ff ff       	call   800a80 <memmove>
+	return r;
+  801d2e:	83 c4 10             	add    $0x10,%esp
+}
+  801d31:	89 f8                	mov    %edi,%eax
+  801d33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d36:	5b                   	pop    %ebx
+  801d37:	5e                   	pop    %esi
+  801d38:	5f                   	pop    %edi
+  801d39:	5d                   	pop    %ebp
+  801d3a:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801d3b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801d41:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801d46:	29 d1                	sub    %edx,%ecx
+  801d48:	39 d9                	cmp    %ebx,%ecx
+  801d4a:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801d4d:	89 f0                	mov    %esi,%eax
+  801d4f:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801d52:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801d55:	eb 0f                	jmp    801d66 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801d57:	0f b6 10             	movzbl (%eax),%edx
+  801d5a:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801d5c:	05 00 10 00 00       	add    $0x1000,%eax
+  801d61:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d66:	39 c8                	cmp    %ecx,%eax
+  801d68:	72 ed                	jb     801d57 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801d6a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d6d:	8b 47 0c             	mov    0xc(%edi),%eax
+  801d70:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801d75:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801d7b:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801d81:	83 ec 0c             	sub    $0xc,%esp
+  801d84:	6a 07                	push   $0x7
+  801d86:	89 d9                	mov    %ebx,%ecx
+  801d88:	89 f2                	mov    %esi,%edx
+  801d8a:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d8f:	e8 86 f9 ff ff       	call   80171a <fsipc_pages>
+  801d94:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801d96:	83 c4 10             	add    $0x10,%esp
+  801d99:	eb 96                	jmp    801d31 <file_read_direct+0x5f>
+	assert(r <= n);
+  801d9b:	68 c0 3d 80 00       	push   $0x803dc0
+  801da0:	68 a0 3d 80 00       	push   $0x803da0
+  801da5:	68 dc 00 00 00       	push   $0xdc
+  801daa:	68 b5 3d 80 00       	push   $0x803db5
+  801daf:	e8 7d e4 ff ff       	call   800231 <_panic>
+	assert(r <= PGSIZE);
+  801db4:	68 d1 3d 80 00       	push   $0x803dd1
+  801db9:	68 a0 3d 80 00       	push   $0x803da0
+  801dbe:	68 dd 00 00 00       	push   $0xdd
+  801dc3:	68 b5 3d 80 00       	push   $0x803db5
+  801dc8:	e8 64 e4 ff ff       	call   800231 <_panic>
+
+00801dcd <devfile_read>:
+{
+  801dcd:	55                   	push   %ebp
+  801dce:	89 e5                	mov    %esp,%ebp
+  801dd0:	57                   	push   %edi
+  801dd1:	56                   	push   %esi
+  801dd2:	53                   	push   %ebx
+  801dd3:	83 ec 28             	sub    $0x28,%esp
+  801dd6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801dd9:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801ddc:	53                   	push   %ebx
+  801ddd:	e8 35 f3 ff ff       	call   801117 <fd2data>
+  801de2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801de5:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801de8:	83 c4 10             	add    $0x10,%esp
+  801deb:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801def:	74 7d                	je     801e6e <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801df1:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801df5:	0f 85 81 00 00 00    	jne    801e7c <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801dfb:	8b 43 18             	mov    0x18(%ebx),%eax
+  801dfe:	85 c0                	test   %eax,%eax
+  801e00:	74 0d                	je     801e0f <devfile_read+0x42>
+  801e02:	8b 53 14             	mov    0x14(%ebx),%edx
+  801e05:	39 fa                	cmp    %edi,%edx
+  801e07:	7f 06                	jg     801e0f <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801e09:	01 c2                	add    %eax,%edx
+  801e0b:	39 d7                	cmp    %edx,%edi
+  801e0d:	72 28                	jb     801e37 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801e0f:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801e16:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e1c:	77 74                	ja     801e92 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801e1e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e23:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801e26:	89 d8                	mov    %ebx,%eax
+  801e28:	e8 a5 fe ff ff       	call   801cd2 <file_read_direct>
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	7e 35                	jle    801e66 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801e31:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801e34:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801e37:	8b 53 14             	mov    0x14(%ebx),%edx
+  801e3a:	89 d0                	mov    %edx,%eax
+  801e3c:	03 43 18             	add    0x18(%ebx),%eax
+  801e3f:	29 f8                	sub    %edi,%eax
+  801e41:	39 f0                	cmp    %esi,%eax
+  801e43:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801e46:	83 ec 04             	sub    $0x4,%esp
+  801e49:	56                   	push   %esi
+  801e4a:	89 f8                	mov    %edi,%eax
+  801e4c:	29 d0                	sub    %edx,%eax
+  801e4e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e51:	01 c1                	add    %eax,%ecx
+  801e53:	51                   	push   %ecx
+  801e54:	ff 75 0c             	push   0xc(%ebp)
+  801e57:	e8 24 ec ff ff       	call   800a80 <memmove>
+	fd->fd_offset = pos + n;
+  801e5c:	01 f7                	add    %esi,%edi
+  801e5e:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801e61:	89 f0                	mov    %esi,%eax
+  801e63:	83 c4 10             	add    $0x10,%esp
+}
+  801e66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e69:	5b                   	pop    %ebx
+  801e6a:	5e                   	pop    %esi
+  801e6b:	5f                   	pop    %edi
+  801e6c:	5d                   	pop    %ebp
+  801e6d:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801e6e:	89 f1                	mov    %esi,%ecx
+  801e70:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e73:	89 d8                	mov    %ebx,%eax
+  801e75:	e8 58 fe ff ff       	call   801cd2 <file_read_direct>
+  801e7a:	eb ea                	jmp    801e66 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801e7c:	83 ec 0c             	sub    $0xc,%esp
+  801e7f:	53                   	push   %ebx
+  801e80:	e8 db fa ff ff       	call   801960 <devfile_sync>
+  801e85:	83 c4 10             	add    $0x10,%esp
+  801e88:	85 c0                	test   %eax,%eax
+  801e8a:	0f 89 6b ff ff ff    	jns    801dfb <devfile_read+0x2e>
+  801e90:	eb d4                	jmp    801e66 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801e92:	89 f1                	mov    %esi,%ecx
+  801e94:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e97:	89 d8                	mov    %ebx,%eax
+  801e99:	e8 34 fe ff ff       	call   801cd2 <file_read_direct>
+  801e9e:	eb c6                	jmp    801e66 <devfile_read+0x99>
+
+00801ea0 <open>:
+{
+  801ea0:	55                   	push   %ebp
+  801ea1:	89 e5                	mov    %esp,%ebp
+  801ea3:	56                   	push   %esi
+  801ea4:	53                   	push   %ebx
+  801ea5:	83 ec 1c             	sub    $0x1c,%esp
+  801ea8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801eab:	56                   	push   %esi
+  801eac:	e8 0e ea ff ff       	call   8008bf <strlen>
+  801eb1:	83 c4 10             	add    $0x10,%esp
+  801eb4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801eb9:	0f 8f a0 00 00 00    	jg     801f5f <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801ebf:	83 ec 0c             	sub    $0xc,%esp
+  801ec2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ec5:	50                   	push   %eax
+  801ec6:	e8 63 f2 ff ff       	call   80112e <fd_alloc>
+  801ecb:	89 c3                	mov    %eax,%ebx
+  801ecd:	83 c4 10             	add    $0x10,%esp
+  801ed0:	85 c0                	test   %eax,%eax
+  801ed2:	78 45                	js     801f19 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801ed4:	83 ec 08             	sub    $0x8,%esp
+  801ed7:	56                   	push   %esi
+  801ed8:	68 00 60 80 00       	push   $0x806000
+  801edd:	e8 18 ea ff ff       	call   8008fa <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801ee2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ee5:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801eea:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801eed:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ef2:	e8 c5 f9 ff ff       	call   8018bc <fsipc>
+  801ef7:	89 c3                	mov    %eax,%ebx
+  801ef9:	83 c4 10             	add    $0x10,%esp
+  801efc:	85 c0                	test   %eax,%eax
+  801efe:	78 22                	js     801f22 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801f00:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801f07:	74 2b                	je     801f34 <open+0x94>
+	return fd2num(fd);
+  801f09:	83 ec 0c             	sub    $0xc,%esp
+  801f0c:	ff 75 f4             	push   -0xc(%ebp)
+  801f0f:	e8 f3 f1 ff ff       	call   801107 <fd2num>
+  801f14:	89 c3                	mov    %eax,%ebx
+  801f16:	83 c4 10             	add    $0x10,%esp
+}
+  801f19:	89 d8                	mov    %ebx,%eax
+  801f1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f1e:	5b                   	pop    %ebx
+  801f1f:	5e                   	pop    %esi
+  801f20:	5d                   	pop    %ebp
+  801f21:	c3                   	ret
+		fd_close(fd, 0);
+  801f22:	83 ec 08             	sub    $0x8,%esp
+  801f25:	6a 00                	push   $0x0
+  801f27:	ff 75 f4             	push   -0xc(%ebp)
+  801f2a:	e8 f8 f2 ff ff       	call   801227 <fd_close>
+		return r;
+  801f2f:	83 c4 10             	add    $0x10,%esp
+  801f32:	eb e5                	jmp    801f19 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801f34:	83 ec 0c             	sub    $0xc,%esp
+  801f37:	ff 75 f4             	push   -0xc(%ebp)
+  801f3a:	e8 d8 f1 ff ff       	call   801117 <fd2data>
+  801f3f:	83 c4 0c             	add    $0xc,%esp
+  801f42:	68 07 04 00 00       	push   $0x407
+  801f47:	50                   	push   %eax
+  801f48:	6a 00                	push   $0x0
+  801f4a:	e8 b7 ed ff ff       	call   800d06 <sys_page_alloc>
+  801f4f:	83 c4 10             	add    $0x10,%esp
+  801f52:	85 c0                	test   %eax,%eax
+  801f54:	75 b3                	jne    801f09 <open+0x69>
+		fd->fd_file.buffered = 1;
+  801f56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f59:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801f5d:	eb aa                	jmp    801f09 <open+0x69>
+		return -E_BAD_PATH;
+  801f5f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f64:	eb b3                	jmp    801f19 <open+0x79>
+
+00801f66 <readdir>:
+{
+  801f66:	55                   	push   %ebp
+  801f67:	89 e5                	mov    %esp,%ebp
+  801f69:	53                   	push   %ebx
+  801f6a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f6d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f70:	50                   	push   %eax
+  801f71:	ff 75 08             	push   0x8(%ebp)
+  801f74:	e8 0b f2 ff ff       	call   801184 <fd_lookup>
+  801f79:	89 c3                	mov    %eax,%ebx
+  801f7b:	83 c4 10             	add    $0x10,%esp
+  801f7e:	85 c0                	test   %eax,%eax
+  801f80:	78 73                	js     801ff5 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801f82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f85:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801f8b:	39 08                	cmp    %ecx,(%eax)
+  801f8d:	0f 85 82 00 00 00    	jne    802015 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801f93:	83 ec 0c             	sub    $0xc,%esp
+  801f96:	50                   	push   %eax
+  801f97:	e8 c4 f9 ff ff       	call   801960 <devfile_sync>
+  801f9c:	89 c3                	mov    %eax,%ebx
+  801f9e:	83 c4 10             	add    $0x10,%esp
+  801fa1:	85 c0                	test   %eax,%eax
+  801fa3:	78 50                	js     801ff5 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801fa5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fa8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fab:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801fb0:	8b 45 10             	mov    0x10(%ebp),%eax
+  801fb3:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801fb8:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fbb:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801fc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801fca:	e8 ed f8 ff ff       	call   8018bc <fsipc>
+  801fcf:	89 c3                	mov    %eax,%ebx
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	7e 20                	jle    801ff5 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801fd5:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801fd8:	72 22                	jb     801ffc <readdir+0x96>
+  801fda:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801fdf:	7f 1b                	jg     801ffc <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801fe1:	83 ec 04             	sub    $0x4,%esp
+  801fe4:	50                   	push   %eax
+  801fe5:	68 00 60 80 00       	push   $0x806000
+  801fea:	ff 75 0c             	push   0xc(%ebp)
+  801fed:	e8 8e ea ff ff       	call   800a80 <memmove>
+	return r;
+  801ff2:	83 c4 10             	add    $0x10,%esp
+}
+  801ff5:	89 d8                	mov    %ebx,%eax
+  801ff7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ffa:	c9                   	leave
+  801ffb:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801ffc:	68 c7 3d 80 00       	push   $0x803dc7
+  802001:	68 a0 3d 80 00       	push   $0x803da0
+  802006:	68 86 01 00 00       	push   $0x186
+  80200b:	68 b5 3d 80 00       	push   $0x803db5
+  802010:	e8 1c e2 ff ff       	call   800231 <_panic>
+		return -E_NOT_SUPP;
+  802015:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80201a:	eb d9                	jmp    801ff5 <readdir+0x8f>
+
+0080201c <munmap>:
+{
+  80201c:	55                   	push   %ebp
+  80201d:	89 e5                	mov    %esp,%ebp
+  80201f:	56                   	push   %esi
+  802020:	53                   	push   %ebx
+  802021:	8b 75 08             	mov    0x8(%ebp),%esi
+  802024:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802027:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  80202d:	75 41                	jne    802070 <munmap+0x54>
+  80202f:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  802035:	77 39                	ja     802070 <munmap+0x54>
+  802037:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80203c:	29 f0                	sub    %esi,%eax
+  80203e:	39 d0                	cmp    %edx,%eax
+  802040:	72 35                	jb     802077 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802042:	89 f3                	mov    %esi,%ebx
+  802044:	01 d6                	add    %edx,%esi
+  802046:	39 f3                	cmp    %esi,%ebx
+  802048:	73 1a                	jae    802064 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  80204a:	83 ec 08             	sub    $0x8,%esp
+  80204d:	53                   	push   %ebx
+  80204e:	6a 00                	push   $0x0
+  802050:	e8 3e ed ff ff       	call   800d93 <sys_page_unmap>
+  802055:	83 c4 10             	add    $0x10,%esp
+  802058:	85 c0                	test   %eax,%eax
+  80205a:	78 0d                	js     802069 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80205c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802062:	eb e2                	jmp    802046 <munmap+0x2a>
+	return 0;
+  802064:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802069:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80206c:	5b                   	pop    %ebx
+  80206d:	5e                   	pop    %esi
+  80206e:	5d                   	pop    %ebp
+  80206f:	c3                   	ret
+		return -E_INVAL;
+  802070:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802075:	eb f2                	jmp    802069 <munmap+0x4d>
+  802077:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80207c:	eb eb                	jmp    802069 <munmap+0x4d>
+
+0080207e <mmap>:
+{
+  80207e:	55                   	push   %ebp
+  80207f:	89 e5                	mov    %esp,%ebp
+  802081:	57                   	push   %edi
+  802082:	56                   	push   %esi
+  802083:	53                   	push   %ebx
+  802084:	83 ec 34             	sub    $0x34,%esp
+  802087:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80208a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80208d:	50                   	push   %eax
+  80208e:	ff 75 18             	push   0x18(%ebp)
+  802091:	e8 ee f0 ff ff       	call   801184 <fd_lookup>
+  802096:	89 c3                	mov    %eax,%ebx
+  802098:	83 c4 10             	add    $0x10,%esp
+  80209b:	85 c0                	test   %eax,%eax
+  80209d:	0f 88 0e 01 00 00    	js     8021b1 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8020a3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8020a6:	a1 20 40 80 00       	mov    0x804020,%eax
+  8020ab:	39 02                	cmp    %eax,(%edx)
+  8020ad:	0f 85 50 01 00 00    	jne    802203 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  8020b3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020b6:	83 e0 02             	and    $0x2,%eax
+  8020b9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8020bc:	74 0a                	je     8020c8 <mmap+0x4a>
+  8020be:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8020c2:	0f 84 42 01 00 00    	je     80220a <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  8020c8:	8b 42 08             	mov    0x8(%edx),%eax
+  8020cb:	83 e0 03             	and    $0x3,%eax
+  8020ce:	83 f8 01             	cmp    $0x1,%eax
+  8020d1:	0f 84 3a 01 00 00    	je     802211 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8020d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020da:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8020dd:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8020e2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8020e5:	0f 85 2d 01 00 00    	jne    802218 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8020eb:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8020ef:	0f 88 2a 01 00 00    	js     80221f <mmap+0x1a1>
+  8020f5:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8020fc:	0f 87 1d 01 00 00    	ja     80221f <mmap+0x1a1>
+  802102:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802107:	2b 45 08             	sub    0x8(%ebp),%eax
+  80210a:	39 f8                	cmp    %edi,%eax
+  80210c:	0f 82 14 01 00 00    	jb     802226 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802112:	83 ec 0c             	sub    $0xc,%esp
+  802115:	52                   	push   %edx
+  802116:	e8 45 f8 ff ff       	call   801960 <devfile_sync>
+  80211b:	89 c3                	mov    %eax,%ebx
+  80211d:	83 c4 10             	add    $0x10,%esp
+  802120:	85 c0                	test   %eax,%eax
+  802122:	0f 88 89 00 00 00    	js     8021b1 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802128:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  80212e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802134:	be 00 00 00 00       	mov    $0x0,%esi
+  802139:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  80213c:	39 fe                	cmp    %edi,%esi
+  80213e:	73 7b                	jae    8021bb <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  802140:	89 f8                	mov    %edi,%eax
+  802142:	29 f0                	sub    %esi,%eax
+  802144:	c1 e8 0c             	shr    $0xc,%eax
+  802147:	ba 40 00 00 00       	mov    $0x40,%edx
+  80214c:	39 d0                	cmp    %edx,%eax
+  80214e:	0f 47 c2             	cmova  %edx,%eax
+  802151:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802154:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802157:	8b 52 0c             	mov    0xc(%edx),%edx
+  80215a:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  802160:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802163:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  802169:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  80216e:	89 f2                	mov    %esi,%edx
+  802170:	03 55 08             	add    0x8(%ebp),%edx
+  802173:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802176:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80217b:	e8 ea f6 ff ff       	call   80186a <fsipcv>
+  802180:	85 c0                	test   %eax,%eax
+  802182:	7e 12                	jle    802196 <mmap+0x118>
+  802184:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802187:	85 c0                	test   %eax,%eax
+  802189:	0f 84 9e 00 00 00    	je     80222d <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80218f:	c1 e0 0c             	shl    $0xc,%eax
+  802192:	01 c6                	add    %eax,%esi
+  802194:	eb a6                	jmp    80213c <mmap+0xbe>
+			munmap(addr, done);
+  802196:	89 c3                	mov    %eax,%ebx
+  802198:	83 ec 08             	sub    $0x8,%esp
+  80219b:	56                   	push   %esi
+  80219c:	ff 75 08             	push   0x8(%ebp)
+  80219f:	e8 78 fe ff ff       	call   80201c <munmap>
+			return r < 0 ? r : -E_INVAL;
+  8021a4:	83 c4 10             	add    $0x10,%esp
+  8021a7:	85 db                	test   %ebx,%ebx
+  8021a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021ae:	0f 49 d8             	cmovns %eax,%ebx
+}
+  8021b1:	89 d8                	mov    %ebx,%eax
+  8021b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021b6:	5b                   	pop    %ebx
+  8021b7:	5e                   	pop    %esi
+  8021b8:	5f                   	pop    %edi
+  8021b9:	5d                   	pop    %ebp
+  8021ba:	c3                   	ret
+	if (prot & PROT_WRITE)
+  8021bb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8021be:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8021c0:	85 c0                	test   %eax,%eax
+  8021c2:	74 ed                	je     8021b1 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8021c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8021cc:	39 fe                	cmp    %edi,%esi
+  8021ce:	73 2e                	jae    8021fe <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8021d0:	83 ec 0c             	sub    $0xc,%esp
+  8021d3:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8021d6:	50                   	push   %eax
+  8021d7:	e8 fd 0f 00 00       	call   8031d9 <cowpage>
+  8021dc:	83 c4 10             	add    $0x10,%esp
+  8021df:	85 c0                	test   %eax,%eax
+  8021e1:	78 08                	js     8021eb <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8021e3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8021e9:	eb e1                	jmp    8021cc <mmap+0x14e>
+				munmap(addr, len);
+  8021eb:	89 c3                	mov    %eax,%ebx
+  8021ed:	83 ec 08             	sub    $0x8,%esp
+  8021f0:	57                   	push   %edi
+  8021f1:	ff 75 08             	push   0x8(%ebp)
+  8021f4:	e8 23 fe ff ff       	call   80201c <munmap>
+				return r;
+  8021f9:	83 c4 10             	add    $0x10,%esp
+  8021fc:	eb b3                	jmp    8021b1 <mmap+0x133>
+	return 0;
+  8021fe:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802201:	eb ae                	jmp    8021b1 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802203:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802208:	eb a7                	jmp    8021b1 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80220a:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80220f:	eb a0                	jmp    8021b1 <mmap+0x133>
+		return -E_INVAL;
+  802211:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802216:	eb 99                	jmp    8021b1 <mmap+0x133>
+  802218:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80221d:	eb 92                	jmp    8021b1 <mmap+0x133>
+  80221f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802224:	eb 8b                	jmp    8021b1 <mmap+0x133>
+  802226:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80222b:	eb 84                	jmp    8021b1 <mmap+0x133>
+			munmap(addr, done);
+  80222d:	83 ec 08             	sub    $0x8,%esp
+  802230:	56                   	push   %esi
+  802231:	ff 75 08             	push   0x8(%ebp)
+  802234:	e8 e3 fd ff ff       	call   80201c <munmap>
+  802239:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  80223c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802241:	e9 6b ff ff ff       	jmp    8021b1 <mmap+0x133>
+
+00802246 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802246:	55                   	push   %ebp
+  802247:	89 e5                	mov    %esp,%ebp
+  802249:	56                   	push   %esi
+  80224a:	53                   	push   %ebx
+  80224b:	83 ec 10             	sub    $0x10,%esp
+  80224e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802251:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802254:	8b 45 08             	mov    0x8(%ebp),%eax
+  802257:	e8 3d f9 ff ff       	call   801b99 <fsring_slot>
+  80225c:	85 c0                	test   %eax,%eax
+  80225e:	78 60                	js     8022c0 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802260:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802263:	8b 56 08             	mov    0x8(%esi),%edx
+  802266:	83 e2 03             	and    $0x3,%edx
+  802269:	83 fa 01             	cmp    $0x1,%edx
+  80226c:	74 59                	je     8022c7 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  80226e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802273:	89 c1                	mov    %eax,%ecx
+  802275:	d3 e2                	shl    %cl,%edx
+  802277:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  80227d:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802280:	c1 e2 02             	shl    $0x2,%edx
+  802283:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  802289:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  802290:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802293:	8b 55 18             	mov    0x18(%ebp),%edx
+  802296:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802299:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80229c:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80229f:	83 ec 08             	sub    $0x8,%esp
+  8022a2:	50                   	push   %eax
+  8022a3:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8022a8:	39 c3                	cmp    %eax,%ebx
+  8022aa:	0f 47 d8             	cmova  %eax,%ebx
+  8022ad:	53                   	push   %ebx
+  8022ae:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8022b1:	89 f2                	mov    %esi,%edx
+  8022b3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022b8:	e8 1e f5 ff ff       	call   8017db <fsring_post>
+  8022bd:	83 c4 10             	add    $0x10,%esp
+}
+  8022c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022c3:	5b                   	pop    %ebx
+  8022c4:	5e                   	pop    %esi
+  8022c5:	5d                   	pop    %ebp
+  8022c6:	c3                   	ret
+		return -E_INVAL;
+  8022c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022cc:	eb f2                	jmp    8022c0 <fsring_read+0x7a>
+
+008022ce <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8022ce:	55                   	push   %ebp
+  8022cf:	89 e5                	mov    %esp,%ebp
+  8022d1:	56                   	push   %esi
+  8022d2:	53                   	push   %ebx
+  8022d3:	83 ec 10             	sub    $0x10,%esp
+  8022d6:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8022d9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8022dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022df:	e8 b5 f8 ff ff       	call   801b99 <fsring_slot>
+  8022e4:	89 c3                	mov    %eax,%ebx
+  8022e6:	85 c0                	test   %eax,%eax
+  8022e8:	78 77                	js     802361 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8022ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022ed:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8022f1:	74 77                	je     80236a <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8022f3:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8022f8:	39 c6                	cmp    %eax,%esi
+  8022fa:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8022fd:	83 ec 04             	sub    $0x4,%esp
+  802300:	56                   	push   %esi
+  802301:	ff 75 0c             	push   0xc(%ebp)
+  802304:	89 d8                	mov    %ebx,%eax
+  802306:	c1 e0 0c             	shl    $0xc,%eax
+  802309:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80230f:	50                   	push   %eax
+  802310:	e8 6b e7 ff ff       	call   800a80 <memmove>
+	fsring_busy |= 1 << slot;
+  802315:	b8 01 00 00 00       	mov    $0x1,%eax
+  80231a:	89 d9                	mov    %ebx,%ecx
+  80231c:	d3 e0                	shl    %cl,%eax
+  80231e:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802324:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802327:	c1 e0 02             	shl    $0x2,%eax
+  80232a:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  802330:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  802337:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80233a:	8b 45 18             	mov    0x18(%ebp),%eax
+  80233d:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  802340:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802347:	83 c4 08             	add    $0x8,%esp
+  80234a:	53                   	push   %ebx
+  80234b:	56                   	push   %esi
+  80234c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80234f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802352:	b8 04 00 00 00       	mov    $0x4,%eax
+  802357:	e8 7f f4 ff ff       	call   8017db <fsring_post>
+  80235c:	89 c3                	mov    %eax,%ebx
+  80235e:	83 c4 10             	add    $0x10,%esp
+}
+  802361:	89 d8                	mov    %ebx,%eax
+  802363:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802366:	5b                   	pop    %ebx
+  802367:	5e                   	pop    %esi
+  802368:	5d                   	pop    %ebp
+  802369:	c3                   	ret
+		return -E_INVAL;
+  80236a:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80236f:	eb f0                	jmp    802361 <fsring_write+0x93>
+
+00802371 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802371:	55                   	push   %ebp
+  802372:	89 e5                	mov    %esp,%ebp
+  802374:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802377:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80237a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237d:	e8 17 f8 ff ff       	call   801b99 <fsring_slot>
+  802382:	85 c0                	test   %eax,%eax
+  802384:	78 4c                	js     8023d2 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802386:	ba 01 00 00 00       	mov    $0x1,%edx
+  80238b:	89 c1                	mov    %eax,%ecx
+  80238d:	d3 e2                	shl    %cl,%edx
+  80238f:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802395:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802398:	c1 e2 02             	shl    $0x2,%edx
+  80239b:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8023a1:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  8023a8:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8023ab:	8b 55 10             	mov    0x10(%ebp),%edx
+  8023ae:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8023b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023b4:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  8023b7:	83 ec 08             	sub    $0x8,%esp
+  8023ba:	50                   	push   %eax
+  8023bb:	6a 00                	push   $0x0
+  8023bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023c2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023c5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8023ca:	e8 0c f4 ff ff       	call   8017db <fsring_post>
+  8023cf:	83 c4 10             	add    $0x10,%esp
+}
+  8023d2:	c9                   	leave
+  8023d3:	c3                   	ret
+
+008023d4 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8023d4:	55                   	push   %ebp
+  8023d5:	89 e5                	mov    %esp,%ebp
+  8023d7:	57                   	push   %edi
+  8023d8:	56                   	push   %esi
+  8023d9:	53                   	push   %ebx
+  8023da:	83 ec 1c             	sub    $0x1c,%esp
+  8023dd:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8023e1:	a1 00 50 80 00       	mov    0x805000,%eax
+  8023e6:	8b 40 48             	mov    0x48(%eax),%eax
+  8023e9:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  8023ef:	74 12                	je     802403 <fsring_reap+0x2f>
+		return 0;
+  8023f1:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8023f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023f9:	5b                   	pop    %ebx
+  8023fa:	5e                   	pop    %esi
+  8023fb:	5f                   	pop    %edi
+  8023fc:	5d                   	pop    %ebp
+  8023fd:	c3                   	ret
+		sys_yield();
+  8023fe:	e8 e4 e8 ff ff       	call   800ce7 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802403:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802409:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80240e:	39 c2                	cmp    %eax,%edx
+  802410:	75 18                	jne    80242a <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802412:	84 db                	test   %bl,%bl
+  802414:	0f 84 21 01 00 00    	je     80253b <fsring_reap+0x167>
+  80241a:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  802421:	75 db                	jne    8023fe <fsring_reap+0x2a>
+			return 0;
+  802423:	b8 00 00 00 00       	mov    $0x0,%eax
+  802428:	eb cc                	jmp    8023f6 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  80242a:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80242f:	83 e0 0f             	and    $0xf,%eax
+  802432:	83 c0 2a             	add    $0x2a,%eax
+  802435:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  80243c:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802443:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802448:	83 c0 01             	add    $0x1,%eax
+  80244b:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802450:	83 fb 0f             	cmp    $0xf,%ebx
+  802453:	77 5b                	ja     8024b0 <fsring_reap+0xdc>
+  802455:	be 01 00 00 00       	mov    $0x1,%esi
+  80245a:	89 d9                	mov    %ebx,%ecx
+  80245c:	d3 e6                	shl    %cl,%esi
+  80245e:	89 f0                	mov    %esi,%eax
+  802460:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  802466:	74 48                	je     8024b0 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802468:	89 d8                	mov    %ebx,%eax
+  80246a:	c1 e0 0c             	shl    $0xc,%eax
+  80246d:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802473:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802476:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802479:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  802480:	83 f8 03             	cmp    $0x3,%eax
+  802483:	74 40                	je     8024c5 <fsring_reap+0xf1>
+  802485:	83 f8 05             	cmp    $0x5,%eax
+  802488:	74 64                	je     8024ee <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  80248a:	f7 d6                	not    %esi
+  80248c:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802492:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802495:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  80249c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249f:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8024a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024a4:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8024a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024ab:	e9 46 ff ff ff       	jmp    8023f6 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8024b0:	53                   	push   %ebx
+  8024b1:	68 dd 3d 80 00       	push   $0x803ddd
+  8024b6:	68 8f 02 00 00       	push   $0x28f
+  8024bb:	68 b5 3d 80 00       	push   $0x803db5
+  8024c0:	e8 6c dd ff ff       	call   800231 <_panic>
+		if (cqe.cqe_result > 0)
+  8024c5:	85 ff                	test   %edi,%edi
+  8024c7:	7e c1                	jle    80248a <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8024c9:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8024cc:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8024d1:	39 c7                	cmp    %eax,%edi
+  8024d3:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8024d6:	50                   	push   %eax
+  8024d7:	ff 75 e4             	push   -0x1c(%ebp)
+  8024da:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8024dd:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  8024e4:	e8 97 e5 ff ff       	call   800a80 <memmove>
+  8024e9:	83 c4 10             	add    $0x10,%esp
+  8024ec:	eb 9c                	jmp    80248a <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8024ee:	85 ff                	test   %edi,%edi
+  8024f0:	75 98                	jne    80248a <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  8024f2:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8024f5:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8024fc:	83 ec 08             	sub    $0x8,%esp
+  8024ff:	ff 75 e4             	push   -0x1c(%ebp)
+  802502:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802505:	51                   	push   %ecx
+  802506:	e8 ef e3 ff ff       	call   8008fa <strcpy>
+			st->st_size = ret->ret_size;
+  80250b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80250e:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802514:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802517:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80251d:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802523:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802529:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  802530:	40 80 00 
+  802533:	83 c4 10             	add    $0x10,%esp
+  802536:	e9 4f ff ff ff       	jmp    80248a <fsring_reap+0xb6>
+			return 0;
+  80253b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802540:	e9 b1 fe ff ff       	jmp    8023f6 <fsring_reap+0x22>
+
+00802545 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802545:	55                   	push   %ebp
+  802546:	89 e5                	mov    %esp,%ebp
+  802548:	57                   	push   %edi
+  802549:	56                   	push   %esi
+  80254a:	53                   	push   %ebx
+  80254b:	83 ec 28             	sub    $0x28,%esp
+  80254e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802551:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802554:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802557:	53                   	push   %ebx
+  802558:	e8 62 e3 ff ff       	call   8008bf <strlen>
+  80255d:	83 c4 10             	add    $0x10,%esp
+  802560:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802565:	0f 8f 02 01 00 00    	jg     80266d <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  80256b:	83 ec 08             	sub    $0x8,%esp
+  80256e:	53                   	push   %ebx
+  80256f:	68 00 60 80 00       	push   $0x806000
+  802574:	e8 81 e3 ff ff       	call   8008fa <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802579:	83 c4 10             	add    $0x10,%esp
+  80257c:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802582:	76 69                	jbe    8025ed <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802584:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802587:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80258d:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802592:	29 d1                	sub    %edx,%ecx
+  802594:	39 f9                	cmp    %edi,%ecx
+  802596:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802599:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80259c:	89 f9                	mov    %edi,%ecx
+  80259e:	01 c1                	add    %eax,%ecx
+  8025a0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8025a3:	eb 0f                	jmp    8025b4 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  8025a5:	0f b6 10             	movzbl (%eax),%edx
+  8025a8:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8025aa:	05 00 10 00 00       	add    $0x1000,%eax
+  8025af:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8025b4:	39 c8                	cmp    %ecx,%eax
+  8025b6:	72 ed                	jb     8025a5 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  8025b8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025bb:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  8025c1:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8025c7:	83 ec 0c             	sub    $0xc,%esp
+  8025ca:	6a 07                	push   $0x7
+  8025cc:	89 f9                	mov    %edi,%ecx
+  8025ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025d1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8025d6:	e8 3f f1 ff ff       	call   80171a <fsipc_pages>
+  8025db:	89 c7                	mov    %eax,%edi
+  8025dd:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8025e0:	85 f6                	test   %esi,%esi
+  8025e2:	74 7f                	je     802663 <file_slurp+0x11e>
+  8025e4:	8d 43 01             	lea    0x1(%ebx),%eax
+  8025e7:	85 ff                	test   %edi,%edi
+  8025e9:	79 3c                	jns    802627 <file_slurp+0xe2>
+  8025eb:	eb 76                	jmp    802663 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8025ed:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8025f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8025fd:	e8 ba f2 ff ff       	call   8018bc <fsipc>
+  802602:	89 c7                	mov    %eax,%edi
+  802604:	85 c0                	test   %eax,%eax
+  802606:	7e d8                	jle    8025e0 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802608:	83 ec 04             	sub    $0x4,%esp
+  80260b:	50                   	push   %eax
+  80260c:	68 08 60 80 00       	push   $0x806008
+  802611:	ff 75 0c             	push   0xc(%ebp)
+  802614:	e8 67 e4 ff ff       	call   800a80 <memmove>
+  802619:	83 c4 10             	add    $0x10,%esp
+  80261c:	eb c2                	jmp    8025e0 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  80261e:	80 fa 2f             	cmp    $0x2f,%dl
+  802621:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802624:	83 c0 01             	add    $0x1,%eax
+  802627:	89 c1                	mov    %eax,%ecx
+  802629:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  80262d:	84 d2                	test   %dl,%dl
+  80262f:	75 ed                	jne    80261e <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802631:	83 ec 04             	sub    $0x4,%esp
+  802634:	68 80 00 00 00       	push   $0x80
+  802639:	53                   	push   %ebx
+  80263a:	56                   	push   %esi
+  80263b:	e8 30 e3 ff ff       	call   800970 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802640:	a1 00 60 80 00       	mov    0x806000,%eax
+  802645:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  80264b:	a1 04 60 80 00       	mov    0x806004,%eax
+  802650:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802656:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  80265d:	40 80 00 
+  802660:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802663:	89 f8                	mov    %edi,%eax
+  802665:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802668:	5b                   	pop    %ebx
+  802669:	5e                   	pop    %esi
+  80266a:	5f                   	pop    %edi
+  80266b:	5d                   	pop    %ebp
+  80266c:	c3                   	ret
+		return -E_BAD_PATH;
+  80266d:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802672:	eb ef                	jmp    802663 <file_slurp+0x11e>
+
+00802674 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802674:	55                   	push   %ebp
+  802675:	89 e5                	mov    %esp,%ebp
+  802677:	53                   	push   %ebx
+  802678:	83 ec 10             	sub    $0x10,%esp
+  80267b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80267e:	53                   	push   %ebx
+  80267f:	e8 3b e2 ff ff       	call   8008bf <strlen>
+  802684:	83 c4 10             	add    $0x10,%esp
+  802687:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80268c:	7f 25                	jg     8026b3 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80268e:	83 ec 08             	sub    $0x8,%esp
+  802691:	53                   	push   %ebx
+  802692:	68 00 60 80 00       	push   $0x806000
+  802697:	e8 5e e2 ff ff       	call   8008fa <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80269c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026a6:	e8 11 f2 ff ff       	call   8018bc <fsipc>
+  8026ab:	83 c4 10             	add    $0x10,%esp
+}
+  8026ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026b1:	c9                   	leave
+  8026b2:	c3                   	ret
+		return -E_BAD_PATH;
+  8026b3:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8026b8:	eb f4                	jmp    8026ae <remove+0x3a>
+
+008026ba <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8026ba:	55                   	push   %ebp
+  8026bb:	89 e5                	mov    %esp,%ebp
+  8026bd:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8026c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026c5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8026ca:	e8 ed f1 ff ff       	call   8018bc <fsipc>
+}
+  8026cf:	c9                   	leave
+  8026d0:	c3                   	ret
+
+008026d1 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  8026d1:	55                   	push   %ebp
+  8026d2:	89 e5                	mov    %esp,%ebp
+  8026d4:	57                   	push   %edi
+  8026d5:	56                   	push   %esi
+  8026d6:	53                   	push   %ebx
+  8026d7:	83 ec 18             	sub    $0x18,%esp
+  8026da:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8026dd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8026e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8026e3:	57                   	push   %edi
+  8026e4:	e8 d6 e1 ff ff       	call   8008bf <strlen>
+  8026e9:	83 c4 10             	add    $0x10,%esp
+  8026ec:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8026f1:	7f 4c                	jg     80273f <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  8026f3:	83 ec 08             	sub    $0x8,%esp
+  8026f6:	57                   	push   %edi
+  8026f7:	68 00 60 80 00       	push   $0x806000
+  8026fc:	e8 f9 e1 ff ff       	call   8008fa <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802701:	ba 00 00 00 00       	mov    $0x0,%edx
+  802706:	b8 10 00 00 00       	mov    $0x10,%eax
+  80270b:	e8 ac f1 ff ff       	call   8018bc <fsipc>
+  802710:	83 c4 10             	add    $0x10,%esp
+  802713:	85 c0                	test   %eax,%eax
+  802715:	78 20                	js     802737 <defrag+0x66>
+		return r;
+	if (before)
+  802717:	85 f6                	test   %esi,%esi
+  802719:	74 07                	je     802722 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  80271b:	a1 00 60 80 00       	mov    0x806000,%eax
+  802720:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802722:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802727:	85 db                	test   %ebx,%ebx
+  802729:	74 0c                	je     802737 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  80272b:	a1 04 60 80 00       	mov    0x806004,%eax
+  802730:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802732:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802737:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80273a:	5b                   	pop    %ebx
+  80273b:	5e                   	pop    %esi
+  80273c:	5f                   	pop    %edi
+  80273d:	5d                   	pop    %ebp
+  80273e:	c3                   	ret
+		return -E_BAD_PATH;
+  80273f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802744:	eb f1                	jmp    802737 <defrag+0x66>
+
+00802746 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802746:	55                   	push   %ebp
+  802747:	89 e5                	mov    %esp,%ebp
+  802749:	53                   	push   %ebx
+  80274a:	83 ec 04             	sub    $0x4,%esp
+  80274d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802750:	ba 00 00 00 00       	mov    $0x0,%edx
+  802755:	b8 11 00 00 00       	mov    $0x11,%eax
+  80275a:	e8 5d f1 ff ff       	call   8018bc <fsipc>
+  80275f:	85 c0                	test   %eax,%eax
+  802761:	78 34                	js     802797 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802763:	a1 00 60 80 00       	mov    0x806000,%eax
+  802768:	89 03                	mov    %eax,(%ebx)
+  80276a:	a1 04 60 80 00       	mov    0x806004,%eax
+  80276f:	89 43 04             	mov    %eax,0x4(%ebx)
+  802772:	a1 08 60 80 00       	mov    0x806008,%eax
+  802777:	89 43 08             	mov    %eax,0x8(%ebx)
+  80277a:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  80277f:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802782:	a1 10 60 80 00       	mov    0x806010,%eax
+  802787:	89 43 10             	mov    %eax,0x10(%ebx)
+  80278a:	a1 14 60 80 00       	mov    0x806014,%eax
+  80278f:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802792:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802797:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80279a:	c9                   	leave
+  80279b:	c3                   	ret
+
+0080279c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80279c:	55                   	push   %ebp
+  80279d:	89 e5                	mov    %esp,%ebp
+  80279f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8027a2:	68 f6 3d 80 00       	push   $0x803df6
+  8027a7:	ff 75 0c             	push   0xc(%ebp)
+  8027aa:	e8 4b e1 ff ff       	call   8008fa <strcpy>
+	return 0;
+}
+  8027af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b4:	c9                   	leave
+  8027b5:	c3                   	ret
+
+008027b6 <devsock_close>:
+{
+  8027b6:	55                   	push   %ebp
+  8027b7:	89 e5                	mov    %esp,%ebp
+  8027b9:	53                   	push   %ebx
+  8027ba:	83 ec 10             	sub    $0x10,%esp
+  8027bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8027c0:	53                   	push   %ebx
+  8027c1:	e8 f4 0d 00 00       	call   8035ba <pageref>
+  8027c6:	89 c2                	mov    %eax,%edx
+  8027c8:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8027cb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8027d0:	83 fa 01             	cmp    $0x1,%edx
+  8027d3:	74 05                	je     8027da <devsock_close+0x24>
+}
+  8027d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027d8:	c9                   	leave
+  8027d9:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8027da:	83 ec 0c             	sub    $0xc,%esp
+  8027dd:	ff 73 0c             	push   0xc(%ebx)
+  8027e0:	e8 b7 02 00 00       	call   802a9c <nsipc_close>
+  8027e5:	83 c4 10             	add    $0x10,%esp
+  8027e8:	eb eb                	jmp    8027d5 <devsock_close+0x1f>
+
+008027ea <devsock_write>:
+{
+  8027ea:	55                   	push   %ebp
+  8027eb:	89 e5                	mov    %esp,%ebp
+  8027ed:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8027f0:	6a 00                	push   $0x0
+  8027f2:	ff 75 10             	push   0x10(%ebp)
+  8027f5:	ff 75 0c             	push   0xc(%ebp)
+  8027f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027fb:	ff 70 0c             	push   0xc(%eax)
+  8027fe:	e8 79 03 00 00       	call   802b7c <nsipc_send>
+}
+  802803:	c9                   	leave
+  802804:	c3                   	ret
+
+00802805 <devsock_read>:
+{
+  802805:	55                   	push   %ebp
+  802806:	89 e5                	mov    %esp,%ebp
+  802808:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80280b:	6a 00                	push   $0x0
+  80280d:	ff 75 10             	push   0x10(%ebp)
+  802810:	ff 75 0c             	push   0xc(%ebp)
+  802813:	8b 45 08             	mov    0x8(%ebp),%eax
+  802816:	ff 70 0c             	push   0xc(%eax)
+  802819:	e8 ef 02 00 00       	call   802b0d <nsipc_recv>
+}
+  80281e:	c9                   	leave
+  80281f:	c3                   	ret
+
+00802820 <fd2sockid>:
+{
+  802820:	55                   	push   %ebp
+  802821:	89 e5                	mov    %esp,%ebp
+  802823:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802826:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802829:	52                   	push   %edx
+  80282a:	50                   	push   %eax
+  80282b:	e8 54 e9 ff ff       	call   801184 <fd_lookup>
+  802830:	83 c4 10             	add    $0x10,%esp
+  802833:	85 c0                	test   %eax,%eax
+  802835:	78 10                	js     802847 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802837:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80283a:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  802840:	39 08                	cmp    %ecx,(%eax)
+  802842:	75 05                	jne    802849 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802844:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802847:	c9                   	leave
+  802848:	c3                   	ret
+		return -E_NOT_SUPP;
+  802849:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80284e:	eb f7                	jmp    802847 <fd2sockid+0x27>
+
+00802850 <alloc_sockfd>:
+{
+  802850:	55                   	push   %ebp
+  802851:	89 e5                	mov    %esp,%ebp
+  802853:	56                   	push   %esi
+  802854:	53                   	push   %ebx
+  802855:	83 ec 1c             	sub    $0x1c,%esp
+  802858:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80285a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80285d:	50                   	push   %eax
+  80285e:	e8 cb e8 ff ff       	call   80112e <fd_alloc>
+  802863:	89 c3                	mov    %eax,%ebx
+  802865:	83 c4 10             	add    $0x10,%esp
+  802868:	85 c0                	test   %eax,%eax
+  80286a:	78 43                	js     8028af <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80286c:	83 ec 04             	sub    $0x4,%esp
+  80286f:	68 07 04 00 00       	push   $0x407
+  802874:	ff 75 f4             	push   -0xc(%ebp)
+  802877:	6a 00                	push   $0x0
+  802879:	e8 88 e4 ff ff       	call   800d06 <sys_page_alloc>
+  80287e:	89 c3                	mov    %eax,%ebx
+  802880:	83 c4 10             	add    $0x10,%esp
+  802883:	85 c0                	test   %eax,%eax
+  802885:	78 28                	js     8028af <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802887:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80288a:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802890:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802892:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802895:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80289c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80289f:	83 ec 0c             	sub    $0xc,%esp
+  8028a2:	50                   	push   %eax
+  8028a3:	e8 5f e8 ff ff       	call   801107 <fd2num>
+  8028a8:	89 c3                	mov    %eax,%ebx
+  8028aa:	83 c4 10             	add    $0x10,%esp
+  8028ad:	eb 0c                	jmp    8028bb <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8028af:	83 ec 0c             	sub    $0xc,%esp
+  8028b2:	56                   	push   %esi
+  8028b3:	e8 e4 01 00 00       	call   802a9c <nsipc_close>
+		return r;
+  8028b8:	83 c4 10             	add    $0x10,%esp
+}
+  8028bb:	89 d8                	mov    %ebx,%eax
+  8028bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028c0:	5b                   	pop    %ebx
+  8028c1:	5e                   	pop    %esi
+  8028c2:	5d                   	pop    %ebp
+  8028c3:	c3                   	ret
+
+008028c4 <accept>:
+{
+  8028c4:	55                   	push   %ebp
+  8028c5:	89 e5                	mov    %esp,%ebp
+  8028c7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028cd:	e8 4e ff ff ff       	call   802820 <fd2sockid>
+  8028d2:	85 c0                	test   %eax,%eax
+  8028d4:	78 1b                	js     8028f1 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8028d6:	83 ec 04             	sub    $0x4,%esp
+  8028d9:	ff 75 10             	push   0x10(%ebp)
+  8028dc:	ff 75 0c             	push   0xc(%ebp)
+  8028df:	50                   	push   %eax
+  8028e0:	e8 0e 01 00 00       	call   8029f3 <nsipc_accept>
+  8028e5:	83 c4 10             	add    $0x10,%esp
+  8028e8:	85 c0                	test   %eax,%eax
+  8028ea:	78 05                	js     8028f1 <accept+0x2d>
+	return alloc_sockfd(r);
+  8028ec:	e8 5f ff ff ff       	call   802850 <alloc_sockfd>
+}
+  8028f1:	c9                   	leave
+  8028f2:	c3                   	ret
+
+008028f3 <bind>:
+{
+  8028f3:	55                   	push   %ebp
+  8028f4:	89 e5                	mov    %esp,%ebp
+  8028f6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028fc:	e8 1f ff ff ff       	call   802820 <fd2sockid>
+  802901:	85 c0                	test   %eax,%eax
+  802903:	78 12                	js     802917 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802905:	83 ec 04             	sub    $0x4,%esp
+  802908:	ff 75 10             	push   0x10(%ebp)
+  80290b:	ff 75 0c             	push   0xc(%ebp)
+  80290e:	50                   	push   %eax
+  80290f:	e8 31 01 00 00       	call   802a45 <nsipc_bind>
+  802914:	83 c4 10             	add    $0x10,%esp
+}
+  802917:	c9                   	leave
+  802918:	c3                   	ret
+
+00802919 <shutdown>:
+{
+  802919:	55                   	push   %ebp
+  80291a:	89 e5                	mov    %esp,%ebp
+  80291c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80291f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802922:	e8 f9 fe ff ff       	call   802820 <fd2sockid>
+  802927:	85 c0                	test   %eax,%eax
+  802929:	78 0f                	js     80293a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80292b:	83 ec 08             	sub    $0x8,%esp
+  80292e:	ff 75 0c             	push   0xc(%ebp)
+  802931:	50                   	push   %eax
+  802932:	e8 43 01 00 00       	call   802a7a <nsipc_shutdown>
+  802937:	83 c4 10             	add    $0x10,%esp
+}
+  80293a:	c9                   	leave
+  80293b:	c3                   	ret
+
+0080293c <connect>:
+{
+  80293c:	55                   	push   %ebp
+  80293d:	89 e5                	mov    %esp,%ebp
+  80293f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802942:	8b 45 08             	mov    0x8(%ebp),%eax
+  802945:	e8 d6 fe ff ff       	call   802820 <fd2sockid>
+  80294a:	85 c0                	test   %eax,%eax
+  80294c:	78 12                	js     802960 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80294e:	83 ec 04             	sub    $0x4,%esp
+  802951:	ff 75 10             	push   0x10(%ebp)
+  802954:	ff 75 0c             	push   0xc(%ebp)
+  802957:	50                   	push   %eax
+  802958:	e8 59 01 00 00       	call   802ab6 <nsipc_connect>
+  80295d:	83 c4 10             	add    $0x10,%esp
+}
+  802960:	c9                   	leave
+  802961:	c3                   	ret
+
+00802962 <listen>:
+{
+  802962:	55                   	push   %ebp
+  802963:	89 e5                	mov    %esp,%ebp
+  802965:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802968:	8b 45 08             	mov    0x8(%ebp),%eax
+  80296b:	e8 b0 fe ff ff       	call   802820 <fd2sockid>
+  802970:	85 c0                	test   %eax,%eax
+  802972:	78 0f                	js     802983 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802974:	83 ec 08             	sub    $0x8,%esp
+  802977:	ff 75 0c             	push   0xc(%ebp)
+  80297a:	50                   	push   %eax
+  80297b:	e8 6b 01 00 00       	call   802aeb <nsipc_listen>
+  802980:	83 c4 10             	add    $0x10,%esp
+}
+  802983:	c9                   	leave
+  802984:	c3                   	ret
+
+00802985 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802985:	55                   	push   %ebp
+  802986:	89 e5                	mov    %esp,%ebp
+  802988:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80298b:	ff 75 10             	push   0x10(%ebp)
+  80298e:	ff 75 0c             	push   0xc(%ebp)
+  802991:	ff 75 08             	push   0x8(%ebp)
+  802994:	e8 41 02 00 00       	call   802bda <nsipc_socket>
+  802999:	83 c4 10             	add    $0x10,%esp
+  80299c:	85 c0                	test   %eax,%eax
+  80299e:	78 05                	js     8029a5 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8029a0:	e8 ab fe ff ff       	call   802850 <alloc_sockfd>
+}
+  8029a5:	c9                   	leave
+  8029a6:	c3                   	ret
+
+008029a7 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8029a7:	55                   	push   %ebp
+  8029a8:	89 e5                	mov    %esp,%ebp
+  8029aa:	53                   	push   %ebx
+  8029ab:	83 ec 04             	sub    $0x4,%esp
+  8029ae:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8029b0:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8029b7:	74 26                	je     8029df <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8029b9:	6a 07                	push   $0x7
+  8029bb:	68 00 80 80 00       	push   $0x808000
+  8029c0:	53                   	push   %ebx
+  8029c1:	ff 35 00 90 80 00    	push   0x809000
+  8029c7:	e8 76 0a 00 00       	call   803442 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8029cc:	83 c4 0c             	add    $0xc,%esp
+  8029cf:	6a 00                	push   $0x0
+  8029d1:	6a 00                	push   $0x0
+  8029d3:	6a 00                	push   $0x0
+  8029d5:	e8 fd 09 00 00       	call   8033d7 <ipc_recv>
+}
+  8029da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029dd:	c9                   	leave
+  8029de:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8029df:	83 ec 0c             	sub    $0xc,%esp
+  8029e2:	6a 02                	push   $0x2
+  8029e4:	e8 92 0b 00 00       	call   80357b <ipc_find_env>
+  8029e9:	a3 00 90 80 00       	mov    %eax,0x809000
+  8029ee:	83 c4 10             	add    $0x10,%esp
+  8029f1:	eb c6                	jmp    8029b9 <nsipc+0x12>
+
+008029f3 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8029f3:	55                   	push   %ebp
+  8029f4:	89 e5                	mov    %esp,%ebp
+  8029f6:	56                   	push   %esi
+  8029f7:	53                   	push   %ebx
+  8029f8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8029fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029fe:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802a03:	8b 06                	mov    (%esi),%eax
+  802a05:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802a0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a0f:	e8 93 ff ff ff       	call   8029a7 <nsipc>
+  802a14:	89 c3                	mov    %eax,%ebx
+  802a16:	85 c0                	test   %eax,%eax
+  802a18:	79 09                	jns    802a23 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802a1a:	89 d8                	mov    %ebx,%eax
+  802a1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a1f:	5b                   	pop    %ebx
+  802a20:	5e                   	pop    %esi
+  802a21:	5d                   	pop    %ebp
+  802a22:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a23:	83 ec 04             	sub    $0x4,%esp
+  802a26:	ff 35 10 80 80 00    	push   0x808010
+  802a2c:	68 00 80 80 00       	push   $0x808000
+  802a31:	ff 75 0c             	push   0xc(%ebp)
+  802a34:	e8 47 e0 ff ff       	call   800a80 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802a39:	a1 10 80 80 00       	mov    0x808010,%eax
+  802a3e:	89 06                	mov    %eax,(%esi)
+  802a40:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802a43:	eb d5                	jmp    802a1a <nsipc_accept+0x27>
+
+00802a45 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802a45:	55                   	push   %ebp
+  802a46:	89 e5                	mov    %esp,%ebp
+  802a48:	53                   	push   %ebx
+  802a49:	83 ec 08             	sub    $0x8,%esp
+  802a4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802a4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a52:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802a57:	53                   	push   %ebx
+  802a58:	ff 75 0c             	push   0xc(%ebp)
+  802a5b:	68 04 80 80 00       	push   $0x808004
+  802a60:	e8 1b e0 ff ff       	call   800a80 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802a65:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802a6b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a70:	e8 32 ff ff ff       	call   8029a7 <nsipc>
+}
+  802a75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a78:	c9                   	leave
+  802a79:	c3                   	ret
+
+00802a7a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802a7a:	55                   	push   %ebp
+  802a7b:	89 e5                	mov    %esp,%ebp
+  802a7d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802a80:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a83:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802a88:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a8b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802a90:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a95:	e8 0d ff ff ff       	call   8029a7 <nsipc>
+}
+  802a9a:	c9                   	leave
+  802a9b:	c3                   	ret
+
+00802a9c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802a9c:	55                   	push   %ebp
+  802a9d:	89 e5                	mov    %esp,%ebp
+  802a9f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802aa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa5:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802aaa:	b8 04 00 00 00       	mov    $0x4,%eax
+  802aaf:	e8 f3 fe ff ff       	call   8029a7 <nsipc>
+}
+  802ab4:	c9                   	leave
+  802ab5:	c3                   	ret
+
+00802ab6 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802ab6:	55                   	push   %ebp
+  802ab7:	89 e5                	mov    %esp,%ebp
+  802ab9:	53                   	push   %ebx
+  802aba:	83 ec 08             	sub    $0x8,%esp
+  802abd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802ac0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac3:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802ac8:	53                   	push   %ebx
+  802ac9:	ff 75 0c             	push   0xc(%ebp)
+  802acc:	68 04 80 80 00       	push   $0x808004
+  802ad1:	e8 aa df ff ff       	call   800a80 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802ad6:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802adc:	b8 05 00 00 00       	mov    $0x5,%eax
+  802ae1:	e8 c1 fe ff ff       	call   8029a7 <nsipc>
+}
+  802ae6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ae9:	c9                   	leave
+  802aea:	c3                   	ret
+
+00802aeb <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802aeb:	55                   	push   %ebp
+  802aec:	89 e5                	mov    %esp,%ebp
+  802aee:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802af1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af4:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802af9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802afc:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802b01:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b06:	e8 9c fe ff ff       	call   8029a7 <nsipc>
+}
+  802b0b:	c9                   	leave
+  802b0c:	c3                   	ret
+
+00802b0d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802b0d:	55                   	push   %ebp
+  802b0e:	89 e5                	mov    %esp,%ebp
+  802b10:	56                   	push   %esi
+  802b11:	53                   	push   %ebx
+  802b12:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802b15:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b18:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802b1d:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802b23:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b26:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b2b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b30:	e8 72 fe ff ff       	call   8029a7 <nsipc>
+  802b35:	89 c3                	mov    %eax,%ebx
+  802b37:	85 c0                	test   %eax,%eax
+  802b39:	78 22                	js     802b5d <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802b3b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b40:	39 c6                	cmp    %eax,%esi
+  802b42:	0f 4e c6             	cmovle %esi,%eax
+  802b45:	39 c3                	cmp    %eax,%ebx
+  802b47:	7f 1d                	jg     802b66 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802b49:	83 ec 04             	sub    $0x4,%esp
+  802b4c:	53                   	push   %ebx
+  802b4d:	68 00 80 80 00       	push   $0x808000
+  802b52:	ff 75 0c             	push   0xc(%ebp)
+  802b55:	e8 26 df ff ff       	call   800a80 <memmove>
+  802b5a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802b5d:	89 d8                	mov    %ebx,%eax
+  802b5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b62:	5b                   	pop    %ebx
+  802b63:	5e                   	pop    %esi
+  802b64:	5d                   	pop    %ebp
+  802b65:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802b66:	68 02 3e 80 00       	push   $0x803e02
+  802b6b:	68 a0 3d 80 00       	push   $0x803da0
+  802b70:	6a 62                	push   $0x62
+  802b72:	68 17 3e 80 00       	push   $0x803e17
+  802b77:	e8 b5 d6 ff ff       	call   800231 <_panic>
+
+00802b7c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802b7c:	55                   	push   %ebp
+  802b7d:	89 e5                	mov    %esp,%ebp
+  802b7f:	53                   	push   %ebx
+  802b80:	83 ec 04             	sub    $0x4,%esp
+  802b83:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802b86:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b89:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802b8e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802b94:	7f 2e                	jg     802bc4 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802b96:	83 ec 04             	sub    $0x4,%esp
+  802b99:	53                   	push   %ebx
+  802b9a:	ff 75 0c             	push   0xc(%ebp)
+  802b9d:	68 0c 80 80 00       	push   $0x80800c
+  802ba2:	e8 d9 de ff ff       	call   800a80 <memmove>
+	nsipcbuf.send.req_size = size;
+  802ba7:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802bad:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bb0:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802bb5:	b8 08 00 00 00       	mov    $0x8,%eax
+  802bba:	e8 e8 fd ff ff       	call   8029a7 <nsipc>
+}
+  802bbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bc2:	c9                   	leave
+  802bc3:	c3                   	ret
+	assert(size < 1600);
+  802bc4:	68 23 3e 80 00       	push   $0x803e23
+  802bc9:	68 a0 3d 80 00       	push   $0x803da0
+  802bce:	6a 6d                	push   $0x6d
+  802bd0:	68 17 3e 80 00       	push   $0x803e17
+  802bd5:	e8 57 d6 ff ff       	call   800231 <_panic>
+
+00802bda <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802bda:	55                   	push   %ebp
+  802bdb:	89 e5                	mov    %esp,%ebp
+  802bdd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802be0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802be8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802beb:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802bf0:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bf3:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802bf8:	b8 09 00 00 00       	mov    $0x9,%eax
+  802bfd:	e8 a5 fd ff ff       	call   8029a7 <nsipc>
+}
+  802c02:	c9                   	leave
+  802c03:	c3                   	ret
+
+00802c04 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c04:	55                   	push   %ebp
+  802c05:	89 e5                	mov    %esp,%ebp
+  802c07:	56                   	push   %esi
+  802c08:	53                   	push   %ebx
+  802c09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802c0c:	83 ec 0c             	sub    $0xc,%esp
+  802c0f:	ff 75 08             	push   0x8(%ebp)
+  802c12:	e8 00 e5 ff ff       	call   801117 <fd2data>
+  802c17:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802c19:	83 c4 08             	add    $0x8,%esp
+  802c1c:	68 2f 3e 80 00       	push   $0x803e2f
+  802c21:	53                   	push   %ebx
+  802c22:	e8 d3 dc ff ff       	call   8008fa <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802c27:	8b 46 04             	mov    0x4(%esi),%eax
+  802c2a:	2b 06                	sub    (%esi),%eax
+  802c2c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802c32:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802c39:	00 00 00 
+	stat->st_dev = &devpipe;
+  802c3c:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802c43:	40 80 00 
+	return 0;
+}
+  802c46:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c4e:	5b                   	pop    %ebx
+  802c4f:	5e                   	pop    %esi
+  802c50:	5d                   	pop    %ebp
+  802c51:	c3                   	ret
+
+00802c52 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802c52:	55                   	push   %ebp
+  802c53:	89 e5                	mov    %esp,%ebp
+  802c55:	53                   	push   %ebx
+  802c56:	83 ec 0c             	sub    $0xc,%esp
+  802c59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802c5c:	53                   	push   %ebx
+  802c5d:	6a 00                	push   $0x0
+  802c5f:	e8 2f e1 ff ff       	call   800d93 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802c64:	89 1c 24             	mov    %ebx,(%esp)
+  802c67:	e8 ab e4 ff ff       	call   801117 <fd2data>
+  802c6c:	83 c4 08             	add    $0x8,%esp
+  802c6f:	50                   	push   %eax
+  802c70:	6a 00                	push   $0x0
+  802c72:	e8 1c e1 ff ff       	call   800d93 <sys_page_unmap>
+}
+  802c77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c7a:	c9                   	leave
+  802c7b:	c3                   	ret
+
+00802c7c <_pipeisclosed>:
+{
+  802c7c:	55                   	push   %ebp
+  802c7d:	89 e5                	mov    %esp,%ebp
+  802c7f:	57                   	push   %edi
+  802c80:	56                   	push   %esi
+  802c81:	53                   	push   %ebx
+  802c82:	83 ec 1c             	sub    $0x1c,%esp
+  802c85:	89 c7                	mov    %eax,%edi
+  802c87:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802c89:	a1 00 50 80 00       	mov    0x805000,%eax
+  802c8e:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802c91:	83 ec 0c             	sub    $0xc,%esp
+  802c94:	57                   	push   %edi
+  802c95:	e8 20 09 00 00       	call   8035ba <pageref>
+  802c9a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c9d:	89 34 24             	mov    %esi,(%esp)
+  802ca0:	e8 15 09 00 00       	call   8035ba <pageref>
+		nn = thisenv->env_runs;
+  802ca5:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802cab:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802cae:	83 c4 10             	add    $0x10,%esp
+  802cb1:	39 cb                	cmp    %ecx,%ebx
+  802cb3:	74 1b                	je     802cd0 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802cb5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802cb8:	75 cf                	jne    802c89 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802cba:	8b 42 58             	mov    0x58(%edx),%eax
+  802cbd:	6a 01                	push   $0x1
+  802cbf:	50                   	push   %eax
+  802cc0:	53                   	push   %ebx
+  802cc1:	68 36 3e 80 00       	push   $0x803e36
+  802cc6:	e8 41 d6 ff ff       	call   80030c <cprintf>
+  802ccb:	83 c4 10             	add    $0x10,%esp
+  802cce:	eb b9                	jmp    802c89 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802cd0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802cd3:	0f 94 c0             	sete   %al
+  802cd6:	0f b6 c0             	movzbl %al,%eax
+}
+  802cd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cdc:	5b                   	pop    %ebx
+  802cdd:	5e                   	pop    %esi
+  802cde:	5f                   	pop    %edi
+  802cdf:	5d                   	pop    %ebp
+  802ce0:	c3                   	ret
+
+00802ce1 <devpipe_write>:
+{
+  802ce1:	55                   	push   %ebp
+  802ce2:	89 e5                	mov    %esp,%ebp
+  802ce4:	57                   	push   %edi
+  802ce5:	56                   	push   %esi
+  802ce6:	53                   	push   %ebx
+  802ce7:	83 ec 28             	sub    $0x28,%esp
+  802cea:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802ced:	56                   	push   %esi
+  802cee:	e8 24 e4 ff ff       	call   801117 <fd2data>
+  802cf3:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802cf5:	83 c4 10             	add    $0x10,%esp
+  802cf8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cfd:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802d00:	75 09                	jne    802d0b <devpipe_write+0x2a>
+	return i;
+  802d02:	89 f8                	mov    %edi,%eax
+  802d04:	eb 23                	jmp    802d29 <devpipe_write+0x48>
+			sys_yield();
+  802d06:	e8 dc df ff ff       	call   800ce7 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802d0b:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d0e:	8b 0b                	mov    (%ebx),%ecx
+  802d10:	8d 51 20             	lea    0x20(%ecx),%edx
+  802d13:	39 d0                	cmp    %edx,%eax
+  802d15:	72 1a                	jb     802d31 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802d17:	89 da                	mov    %ebx,%edx
+  802d19:	89 f0                	mov    %esi,%eax
+  802d1b:	e8 5c ff ff ff       	call   802c7c <_pipeisclosed>
+  802d20:	85 c0                	test   %eax,%eax
+  802d22:	74 e2                	je     802d06 <devpipe_write+0x25>
+				return 0;
+  802d24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d2c:	5b                   	pop    %ebx
+  802d2d:	5e                   	pop    %esi
+  802d2e:	5f                   	pop    %edi
+  802d2f:	5d                   	pop    %ebp
+  802d30:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802d31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d34:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802d38:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802d3b:	89 c2                	mov    %eax,%edx
+  802d3d:	c1 fa 1f             	sar    $0x1f,%edx
+  802d40:	89 d1                	mov    %edx,%ecx
+  802d42:	c1 e9 1b             	shr    $0x1b,%ecx
+  802d45:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802d48:	83 e2 1f             	and    $0x1f,%edx
+  802d4b:	29 ca                	sub    %ecx,%edx
+  802d4d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802d51:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802d55:	83 c0 01             	add    $0x1,%eax
+  802d58:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802d5b:	83 c7 01             	add    $0x1,%edi
+  802d5e:	eb 9d                	jmp    802cfd <devpipe_write+0x1c>
+
+00802d60 <devpipe_read>:
+{
+  802d60:	55                   	push   %ebp
+  802d61:	89 e5                	mov    %esp,%ebp
+  802d63:	57                   	push   %edi
+  802d64:	56                   	push   %esi
+  802d65:	53                   	push   %ebx
+  802d66:	83 ec 18             	sub    $0x18,%esp
+  802d69:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802d6c:	57                   	push   %edi
+  802d6d:	e8 a5 e3 ff ff       	call   801117 <fd2data>
+  802d72:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802d74:	83 c4 10             	add    $0x10,%esp
+  802d77:	be 00 00 00 00       	mov    $0x0,%esi
+  802d7c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802d7f:	75 13                	jne    802d94 <devpipe_read+0x34>
+	return i;
+  802d81:	89 f0                	mov    %esi,%eax
+  802d83:	eb 02                	jmp    802d87 <devpipe_read+0x27>
+				return i;
+  802d85:	89 f0                	mov    %esi,%eax
+}
+  802d87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d8a:	5b                   	pop    %ebx
+  802d8b:	5e                   	pop    %esi
+  802d8c:	5f                   	pop    %edi
+  802d8d:	5d                   	pop    %ebp
+  802d8e:	c3                   	ret
+			sys_yield();
+  802d8f:	e8 53 df ff ff       	call   800ce7 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802d94:	8b 03                	mov    (%ebx),%eax
+  802d96:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802d99:	75 18                	jne    802db3 <devpipe_read+0x53>
+			if (i > 0)
+  802d9b:	85 f6                	test   %esi,%esi
+  802d9d:	75 e6                	jne    802d85 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802d9f:	89 da                	mov    %ebx,%edx
+  802da1:	89 f8                	mov    %edi,%eax
+  802da3:	e8 d4 fe ff ff       	call   802c7c <_pipeisclosed>
+  802da8:	85 c0                	test   %eax,%eax
+  802daa:	74 e3                	je     802d8f <devpipe_read+0x2f>
+				return 0;
+  802dac:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db1:	eb d4                	jmp    802d87 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802db3:	99                   	cltd
+  802db4:	c1 ea 1b             	shr    $0x1b,%edx
+  802db7:	01 d0                	add    %edx,%eax
+  802db9:	83 e0 1f             	and    $0x1f,%eax
+  802dbc:	29 d0                	sub    %edx,%eax
+  802dbe:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802dc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802dc6:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802dc9:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802dcc:	83 c6 01             	add    $0x1,%esi
+  802dcf:	eb ab                	jmp    802d7c <devpipe_read+0x1c>
+
+00802dd1 <pipe>:
+{
+  802dd1:	55                   	push   %ebp
+  802dd2:	89 e5                	mov    %esp,%ebp
+  802dd4:	56                   	push   %esi
+  802dd5:	53                   	push   %ebx
+  802dd6:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802dd9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ddc:	50                   	push   %eax
+  802ddd:	e8 4c e3 ff ff       	call   80112e <fd_alloc>
+  802de2:	89 c3                	mov    %eax,%ebx
+  802de4:	83 c4 10             	add    $0x10,%esp
+  802de7:	85 c0                	test   %eax,%eax
+  802de9:	0f 88 23 01 00 00    	js     802f12 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802def:	83 ec 04             	sub    $0x4,%esp
+  802df2:	68 07 04 00 00       	push   $0x407
+  802df7:	ff 75 f4             	push   -0xc(%ebp)
+  802dfa:	6a 00                	push   $0x0
+  802dfc:	e8 05 df ff ff       	call   800d06 <sys_page_alloc>
+  802e01:	89 c3                	mov    %eax,%ebx
+  802e03:	83 c4 10             	add    $0x10,%esp
+  802e06:	85 c0                	test   %eax,%eax
+  802e08:	0f 88 04 01 00 00    	js     802f12 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802e0e:	83 ec 0c             	sub    $0xc,%esp
+  802e11:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802e14:	50                   	push   %eax
+  802e15:	e8 14 e3 ff ff       	call   80112e <fd_alloc>
+  802e1a:	89 c3                	mov    %eax,%ebx
+  802e1c:	83 c4 10             	add    $0x10,%esp
+  802e1f:	85 c0                	test   %eax,%eax
+  802e21:	0f 88 db 00 00 00    	js     802f02 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e27:	83 ec 04             	sub    $0x4,%esp
+  802e2a:	68 07 04 00 00       	push   $0x407
+  802e2f:	ff 75 f0             	push   -0x10(%ebp)
+  802e32:	6a 00                	push   $0x0
+  802e34:	e8 cd de ff ff       	call   800d06 <sys_page_alloc>
+  802e39:	89 c3                	mov    %eax,%ebx
+  802e3b:	83 c4 10             	add    $0x10,%esp
+  802e3e:	85 c0                	test   %eax,%eax
+  802e40:	0f 88 bc 00 00 00    	js     802f02 <pipe+0x131>
+	va = fd2data(fd0);
+  802e46:	83 ec 0c             	sub    $0xc,%esp
+  802e49:	ff 75 f4             	push   -0xc(%ebp)
+  802e4c:	e8 c6 e2 ff ff       	call   801117 <fd2data>
+  802e51:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e53:	83 c4 0c             	add    $0xc,%esp
+  802e56:	68 07 04 00 00       	push   $0x407
+  802e5b:	50                   	push   %eax
+  802e5c:	6a 00                	push   $0x0
+  802e5e:	e8 a3 de ff ff       	call   800d06 <sys_page_alloc>
+  802e63:	89 c3                	mov    %eax,%ebx
+  802e65:	83 c4 10             	add    $0x10,%esp
+  802e68:	85 c0                	test   %eax,%eax
+  802e6a:	0f 88 82 00 00 00    	js     802ef2 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e70:	83 ec 0c             	sub    $0xc,%esp
+  802e73:	ff 75 f0             	push   -0x10(%ebp)
+  802e76:	e8 9c e2 ff ff       	call   801117 <fd2data>
+  802e7b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802e82:	50                   	push   %eax
+  802e83:	6a 00                	push   $0x0
+  802e85:	56                   	push   %esi
+  802e86:	6a 00                	push   $0x0
+  802e88:	e8 c4 de ff ff       	call   800d51 <sys_page_map>
+  802e8d:	89 c3                	mov    %eax,%ebx
+  802e8f:	83 c4 20             	add    $0x20,%esp
+  802e92:	85 c0                	test   %eax,%eax
+  802e94:	78 4e                	js     802ee4 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802e96:	a1 60 40 80 00       	mov    0x804060,%eax
+  802e9b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802e9e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802ea0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802ea3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802eaa:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802ead:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802eaf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802eb2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802eb9:	83 ec 0c             	sub    $0xc,%esp
+  802ebc:	ff 75 f4             	push   -0xc(%ebp)
+  802ebf:	e8 43 e2 ff ff       	call   801107 <fd2num>
+  802ec4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ec7:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802ec9:	83 c4 04             	add    $0x4,%esp
+  802ecc:	ff 75 f0             	push   -0x10(%ebp)
+  802ecf:	e8 33 e2 ff ff       	call   801107 <fd2num>
+  802ed4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ed7:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802eda:	83 c4 10             	add    $0x10,%esp
+  802edd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ee2:	eb 2e                	jmp    802f12 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802ee4:	83 ec 08             	sub    $0x8,%esp
+  802ee7:	56                   	push   %esi
+  802ee8:	6a 00                	push   $0x0
+  802eea:	e8 a4 de ff ff       	call   800d93 <sys_page_unmap>
+  802eef:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802ef2:	83 ec 08             	sub    $0x8,%esp
+  802ef5:	ff 75 f0             	push   -0x10(%ebp)
+  802ef8:	6a 00                	push   $0x0
+  802efa:	e8 94 de ff ff       	call   800d93 <sys_page_unmap>
+  802eff:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802f02:	83 ec 08             	sub    $0x8,%esp
+  802f05:	ff 75 f4             	push   -0xc(%ebp)
+  802f08:	6a 00                	push   $0x0
+  802f0a:	e8 84 de ff ff       	call   800d93 <sys_page_unmap>
+  802f0f:	83 c4 10             	add    $0x10,%esp
+}
+  802f12:	89 d8                	mov    %ebx,%eax
+  802f14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f17:	5b                   	pop    %ebx
+  802f18:	5e                   	pop    %esi
+  802f19:	5d                   	pop    %ebp
+  802f1a:	c3                   	ret
+
+00802f1b <pipeisclosed>:
+{
+  802f1b:	55                   	push   %ebp
+  802f1c:	89 e5                	mov    %esp,%ebp
+  802f1e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f21:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f24:	50                   	push   %eax
+  802f25:	ff 75 08             	push   0x8(%ebp)
+  802f28:	e8 57 e2 ff ff       	call   801184 <fd_lookup>
+  802f2d:	83 c4 10             	add    $0x10,%esp
+  802f30:	85 c0                	test   %eax,%eax
+  802f32:	78 18                	js     802f4c <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802f34:	83 ec 0c             	sub    $0xc,%esp
+  802f37:	ff 75 f4             	push   -0xc(%ebp)
+  802f3a:	e8 d8 e1 ff ff       	call   801117 <fd2data>
+  802f3f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802f41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f44:	e8 33 fd ff ff       	call   802c7c <_pipeisclosed>
+  802f49:	83 c4 10             	add    $0x10,%esp
+}
+  802f4c:	c9                   	leave
+  802f4d:	c3                   	ret
+
+00802f4e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802f4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f53:	c3                   	ret
+
+00802f54 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f54:	55                   	push   %ebp
+  802f55:	89 e5                	mov    %esp,%ebp
+  802f57:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802f5a:	68 4e 3e 80 00       	push   $0x803e4e
+  802f5f:	ff 75 0c             	push   0xc(%ebp)
+  802f62:	e8 93 d9 ff ff       	call   8008fa <strcpy>
+	return 0;
+}
+  802f67:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f6c:	c9                   	leave
+  802f6d:	c3                   	ret
+
+00802f6e <devcons_write>:
+{
+  802f6e:	55                   	push   %ebp
+  802f6f:	89 e5                	mov    %esp,%ebp
+  802f71:	57                   	push   %edi
+  802f72:	56                   	push   %esi
+  802f73:	53                   	push   %ebx
+  802f74:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802f7a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802f7f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802f85:	eb 2e                	jmp    802fb5 <devcons_write+0x47>
+		m = n - tot;
+  802f87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f8a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802f8c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802f91:	39 c3                	cmp    %eax,%ebx
+  802f93:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802f96:	83 ec 04             	sub    $0x4,%esp
+  802f99:	53                   	push   %ebx
+  802f9a:	89 f0                	mov    %esi,%eax
+  802f9c:	03 45 0c             	add    0xc(%ebp),%eax
+  802f9f:	50                   	push   %eax
+  802fa0:	57                   	push   %edi
+  802fa1:	e8 da da ff ff       	call   800a80 <memmove>
+		sys_cputs(buf, m);
+  802fa6:	83 c4 08             	add    $0x8,%esp
+  802fa9:	53                   	push   %ebx
+  802faa:	57                   	push   %edi
+  802fab:	e8 7a dc ff ff       	call   800c2a <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802fb0:	01 de                	add    %ebx,%esi
+  802fb2:	83 c4 10             	add    $0x10,%esp
+  802fb5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802fb8:	72 cd                	jb     802f87 <devcons_write+0x19>
+}
+  802fba:	89 f0                	mov    %esi,%eax
+  802fbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fbf:	5b                   	pop    %ebx
+  802fc0:	5e                   	pop    %esi
+  802fc1:	5f                   	pop    %edi
+  802fc2:	5d                   	pop    %ebp
+  802fc3:	c3                   	ret
+
+00802fc4 <devcons_read>:
+{
+  802fc4:	55                   	push   %ebp
+  802fc5:	89 e5                	mov    %esp,%ebp
+  802fc7:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802fca:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fcf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802fd3:	75 07                	jne    802fdc <devcons_read+0x18>
+  802fd5:	eb 1f                	jmp    802ff6 <devcons_read+0x32>
+		sys_yield();
+  802fd7:	e8 0b dd ff ff       	call   800ce7 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802fdc:	e8 6f dc ff ff       	call   800c50 <sys_cgetc>
+  802fe1:	85 c0                	test   %eax,%eax
+  802fe3:	74 f2                	je     802fd7 <devcons_read+0x13>
+	if (c < 0)
+  802fe5:	78 0f                	js     802ff6 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802fe7:	83 f8 04             	cmp    $0x4,%eax
+  802fea:	74 0c                	je     802ff8 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802fec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802fef:	88 02                	mov    %al,(%edx)
+	return 1;
+  802ff1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802ff6:	c9                   	leave
+  802ff7:	c3                   	ret
+		return 0;
+  802ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ffd:	eb f7                	jmp    802ff6 <devcons_read+0x32>
+
+00802fff <cputchar>:
+{
+  802fff:	55                   	push   %ebp
+  803000:	89 e5                	mov    %esp,%ebp
+  803002:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803005:	8b 45 08             	mov    0x8(%ebp),%eax
+  803008:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80300b:	6a 01                	push   $0x1
+  80300d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803010:	50                   	push   %eax
+  803011:	e8 14 dc ff ff       	call   800c2a <sys_cputs>
+}
+  803016:	83 c4 10             	add    $0x10,%esp
+  803019:	c9                   	leave
+  80301a:	c3                   	ret
+
+0080301b <getchar>:
+{
+  80301b:	55                   	push   %ebp
+  80301c:	89 e5                	mov    %esp,%ebp
+  80301e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803021:	6a 01                	push   $0x1
+  803023:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803026:	50                   	push   %eax
+  803027:	6a 00                	push   $0x0
+  803029:	e8 bc e3 ff ff       	call   8013ea <read>
+	if (r < 0)
+  80302e:	83 c4 10             	add    $0x10,%esp
+  803031:	85 c0                	test   %eax,%eax
+  803033:	78 06                	js     80303b <getchar+0x20>
+	if (r < 1)
+  803035:	74 06                	je     80303d <getchar+0x22>
+	return c;
+  803037:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80303b:	c9                   	leave
+  80303c:	c3                   	ret
+		return -E_EOF;
+  80303d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803042:	eb f7                	jmp    80303b <getchar+0x20>
+
+00803044 <iscons>:
+{
+  803044:	55                   	push   %ebp
+  803045:	89 e5                	mov    %esp,%ebp
+  803047:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80304a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80304d:	50                   	push   %eax
+  80304e:	ff 75 08             	push   0x8(%ebp)
+  803051:	e8 2e e1 ff ff       	call   801184 <fd_lookup>
+  803056:	83 c4 10             	add    $0x10,%esp
+  803059:	85 c0                	test   %eax,%eax
+  80305b:	78 11                	js     80306e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80305d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803060:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  803066:	39 10                	cmp    %edx,(%eax)
+  803068:	0f 94 c0             	sete   %al
+  80306b:	0f b6 c0             	movzbl %al,%eax
+}
+  80306e:	c9                   	leave
+  80306f:	c3                   	ret
+
+00803070 <opencons>:
+{
+  803070:	55                   	push   %ebp
+  803071:	89 e5                	mov    %esp,%ebp
+  803073:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803076:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803079:	50                   	push   %eax
+  80307a:	e8 af e0 ff ff       	call   80112e <fd_alloc>
+  80307f:	83 c4 10             	add    $0x10,%esp
+  803082:	85 c0                	test   %eax,%eax
+  803084:	78 3a                	js     8030c0 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803086:	83 ec 04             	sub    $0x4,%esp
+  803089:	68 07 04 00 00       	push   $0x407
+  80308e:	ff 75 f4             	push   -0xc(%ebp)
+  803091:	6a 00                	push   $0x0
+  803093:	e8 6e dc ff ff       	call   800d06 <sys_page_alloc>
+  803098:	83 c4 10             	add    $0x10,%esp
+  80309b:	85 c0                	test   %eax,%eax
+  80309d:	78 21                	js     8030c0 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80309f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030a2:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8030a8:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8030aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030ad:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8030b4:	83 ec 0c             	sub    $0xc,%esp
+  8030b7:	50                   	push   %eax
+  8030b8:	e8 4a e0 ff ff       	call   801107 <fd2num>
+  8030bd:	83 c4 10             	add    $0x10,%esp
+}
+  8030c0:	c9                   	leave
+  8030c1:	c3                   	ret
+
+008030c2 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  8030c2:	55                   	push   %ebp
+  8030c3:	89 e5                	mov    %esp,%ebp
+  8030c5:	57                   	push   %edi
+  8030c6:	56                   	push   %esi
+  8030c7:	53                   	push   %ebx
+  8030c8:	83 ec 20             	sub    $0x20,%esp
+  8030cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030ce:	89 d7                	mov    %edx,%edi
+  8030d0:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  8030d2:	51                   	push   %ecx
+  8030d3:	68 00 f0 7f 00       	push   $0x7ff000
+  8030d8:	6a 00                	push   $0x0
+  8030da:	e8 27 dc ff ff       	call   800d06 <sys_page_alloc>
+  8030df:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8030e1:	83 c4 10             	add    $0x10,%esp
+  8030e4:	85 c0                	test   %eax,%eax
+  8030e6:	78 45                	js     80312d <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  8030e8:	83 ec 04             	sub    $0x4,%esp
+  8030eb:	68 00 10 00 00       	push   $0x1000
+  8030f0:	57                   	push   %edi
+  8030f1:	68 00 f0 7f 00       	push   $0x7ff000
+  8030f6:	e8 85 d9 ff ff       	call   800a80 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8030fb:	89 34 24             	mov    %esi,(%esp)
+  8030fe:	57                   	push   %edi
+  8030ff:	ff 75 e4             	push   -0x1c(%ebp)
+  803102:	68 00 f0 7f 00       	push   $0x7ff000
+  803107:	6a 00                	push   $0x0
+  803109:	e8 43 dc ff ff       	call   800d51 <sys_page_map>
+  80310e:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803110:	83 c4 20             	add    $0x20,%esp
+  803113:	85 c0                	test   %eax,%eax
+  803115:	78 16                	js     80312d <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803117:	83 ec 08             	sub    $0x8,%esp
+  80311a:	68 00 f0 7f 00       	push   $0x7ff000
+  80311f:	6a 00                	push   $0x0
+  803121:	e8 6d dc ff ff       	call   800d93 <sys_page_unmap>
+  803126:	83 c4 10             	add    $0x10,%esp
+  803129:	85 c0                	test   %eax,%eax
+  80312b:	75 0a                	jne    803137 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  80312d:	89 d8                	mov    %ebx,%eax
+  80312f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803132:	5b                   	pop    %ebx
+  803133:	5e                   	pop    %esi
+  803134:	5f                   	pop    %edi
+  803135:	5d                   	pop    %ebp
+  803136:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803137:	68 5c 3e 80 00       	push   $0x803e5c
+  80313c:	68 a0 3d 80 00       	push   $0x803da0
+  803141:	6a 1b                	push   $0x1b
+  803143:	68 d4 3e 80 00       	push   $0x803ed4
+  803148:	e8 e4 d0 ff ff       	call   800231 <_panic>
+
+0080314d <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80314d:	55                   	push   %ebp
+  80314e:	89 e5                	mov    %esp,%ebp
+  803150:	53                   	push   %ebx
+  803151:	83 ec 04             	sub    $0x4,%esp
+  803154:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803157:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803159:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  80315d:	74 21                	je     803180 <pgfault+0x33>
+  80315f:	89 d0                	mov    %edx,%eax
+  803161:	c1 e8 16             	shr    $0x16,%eax
+  803164:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80316b:	a8 01                	test   $0x1,%al
+  80316d:	74 11                	je     803180 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  80316f:	89 d0                	mov    %edx,%eax
+  803171:	c1 e8 0c             	shr    $0xc,%eax
+  803174:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80317b:	f6 c4 08             	test   $0x8,%ah
+  80317e:	75 17                	jne    803197 <pgfault+0x4a>
+		if (pgfault_next) {
+  803180:	a1 04 90 80 00       	mov    0x809004,%eax
+  803185:	85 c0                	test   %eax,%eax
+  803187:	74 27                	je     8031b0 <pgfault+0x63>
+			pgfault_next(utf);
+  803189:	83 ec 0c             	sub    $0xc,%esp
+  80318c:	53                   	push   %ebx
+  80318d:	ff d0                	call   *%eax
+			return;
+  80318f:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803192:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803195:	c9                   	leave
+  803196:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803197:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80319d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a7:	e8 16 ff ff ff       	call   8030c2 <copy_page_to>
+  8031ac:	85 c0                	test   %eax,%eax
+  8031ae:	79 e2                	jns    803192 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8031b0:	a1 00 50 80 00       	mov    0x805000,%eax
+  8031b5:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8031b8:	ff 73 28             	push   0x28(%ebx)
+  8031bb:	ff 33                	push   (%ebx)
+  8031bd:	50                   	push   %eax
+  8031be:	68 80 3e 80 00       	push   $0x803e80
+  8031c3:	e8 44 d1 ff ff       	call   80030c <cprintf>
+	sys_env_destroy(0);
+  8031c8:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8031cf:	e8 a3 da ff ff       	call   800c77 <sys_env_destroy>
+  8031d4:	83 c4 10             	add    $0x10,%esp
+  8031d7:	eb b9                	jmp    803192 <pgfault+0x45>
+
+008031d9 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8031d9:	55                   	push   %ebp
+  8031da:	89 e5                	mov    %esp,%ebp
+  8031dc:	53                   	push   %ebx
+  8031dd:	83 ec 04             	sub    $0x4,%esp
+  8031e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8031e3:	a1 08 90 80 00       	mov    0x809008,%eax
+  8031e8:	3d 4d 31 80 00       	cmp    $0x80314d,%eax
+  8031ed:	74 15                	je     803204 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8031ef:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  8031f4:	83 ec 0c             	sub    $0xc,%esp
+  8031f7:	68 4d 31 80 00       	push   $0x80314d
+  8031fc:	e8 fb 03 00 00       	call   8035fc <set_pgfault_handler>
+  803201:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803204:	83 ec 0c             	sub    $0xc,%esp
+  803207:	68 05 08 00 00       	push   $0x805
+  80320c:	53                   	push   %ebx
+  80320d:	6a 00                	push   $0x0
+  80320f:	53                   	push   %ebx
+  803210:	6a 00                	push   $0x0
+  803212:	e8 3a db ff ff       	call   800d51 <sys_page_map>
+}
+  803217:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80321a:	c9                   	leave
+  80321b:	c3                   	ret
+
+0080321c <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80321c:	55                   	push   %ebp
+  80321d:	89 e5                	mov    %esp,%ebp
+  80321f:	57                   	push   %edi
+  803220:	56                   	push   %esi
+  803221:	53                   	push   %ebx
+  803222:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  803225:	68 4d 31 80 00       	push   $0x80314d
+  80322a:	e8 cd 03 00 00       	call   8035fc <set_pgfault_handler>
+  80322f:	b8 07 00 00 00       	mov    $0x7,%eax
+  803234:	cd 30                	int    $0x30
+  803236:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803239:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  80323c:	83 c4 10             	add    $0x10,%esp
+  80323f:	85 c0                	test   %eax,%eax
+  803241:	0f 88 6b 01 00 00    	js     8033b2 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803247:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  80324c:	75 37                	jne    803285 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80324e:	e8 6d da ff ff       	call   800cc0 <sys_getenvid>
+  803253:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803258:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80325e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803263:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  803268:	e9 45 01 00 00       	jmp    8033b2 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  80326d:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803273:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803279:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80327f:	0f 87 ba 00 00 00    	ja     80333f <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803285:	89 d8                	mov    %ebx,%eax
+  803287:	c1 e8 16             	shr    $0x16,%eax
+  80328a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803291:	a8 01                	test   $0x1,%al
+  803293:	74 d8                	je     80326d <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803295:	89 d8                	mov    %ebx,%eax
+  803297:	c1 e8 0c             	shr    $0xc,%eax
+  80329a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8032a1:	f6 c2 01             	test   $0x1,%dl
+  8032a4:	74 cd                	je     803273 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8032a6:	89 da                	mov    %ebx,%edx
+  8032a8:	80 e6 df             	and    $0xdf,%dh
+  8032ab:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8032b1:	74 c0                	je     803273 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8032b3:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8032b5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8032bc:	f6 c6 04             	test   $0x4,%dh
+  8032bf:	75 53                	jne    803314 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8032c1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8032c8:	f6 c6 08             	test   $0x8,%dh
+  8032cb:	75 0c                	jne    8032d9 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8032cd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8032d4:	f6 c2 02             	test   $0x2,%dl
+  8032d7:	74 3b                	je     803314 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8032d9:	83 ec 0c             	sub    $0xc,%esp
+  8032dc:	68 05 08 00 00       	push   $0x805
+  8032e1:	57                   	push   %edi
+  8032e2:	ff 75 e4             	push   -0x1c(%ebp)
+  8032e5:	57                   	push   %edi
+  8032e6:	6a 00                	push   $0x0
+  8032e8:	e8 64 da ff ff       	call   800d51 <sys_page_map>
+  8032ed:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032ef:	83 c4 20             	add    $0x20,%esp
+  8032f2:	85 c0                	test   %eax,%eax
+  8032f4:	0f 88 a7 00 00 00    	js     8033a1 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8032fa:	83 ec 0c             	sub    $0xc,%esp
+  8032fd:	68 05 08 00 00       	push   $0x805
+  803302:	57                   	push   %edi
+  803303:	6a 00                	push   $0x0
+  803305:	57                   	push   %edi
+  803306:	6a 00                	push   $0x0
+  803308:	e8 44 da ff ff       	call   800d51 <sys_page_map>
+  80330d:	89 c6                	mov    %eax,%esi
+	return r;
+  80330f:	83 c4 20             	add    $0x20,%esp
+  803312:	eb 21                	jmp    803335 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803314:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80331b:	83 ec 0c             	sub    $0xc,%esp
+  80331e:	25 07 0e 00 00       	and    $0xe07,%eax
+  803323:	50                   	push   %eax
+  803324:	57                   	push   %edi
+  803325:	ff 75 e4             	push   -0x1c(%ebp)
+  803328:	57                   	push   %edi
+  803329:	6a 00                	push   $0x0
+  80332b:	e8 21 da ff ff       	call   800d51 <sys_page_map>
+  803330:	89 c6                	mov    %eax,%esi
+  803332:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  803335:	85 f6                	test   %esi,%esi
+  803337:	0f 89 36 ff ff ff    	jns    803273 <fork+0x57>
+  80333d:	eb 62                	jmp    8033a1 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80333f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803344:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  803349:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80334c:	89 f8                	mov    %edi,%eax
+  80334e:	e8 6f fd ff ff       	call   8030c2 <copy_page_to>
+  803353:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803355:	85 c0                	test   %eax,%eax
+  803357:	78 48                	js     8033a1 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803359:	83 ec 04             	sub    $0x4,%esp
+  80335c:	6a 07                	push   $0x7
+  80335e:	68 00 f0 bf ee       	push   $0xeebff000
+  803363:	57                   	push   %edi
+  803364:	e8 9d d9 ff ff       	call   800d06 <sys_page_alloc>
+  803369:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80336b:	83 c4 10             	add    $0x10,%esp
+  80336e:	85 c0                	test   %eax,%eax
+  803370:	78 2f                	js     8033a1 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803372:	a1 00 50 80 00       	mov    0x805000,%eax
+  803377:	8b 40 64             	mov    0x64(%eax),%eax
+  80337a:	83 ec 08             	sub    $0x8,%esp
+  80337d:	50                   	push   %eax
+  80337e:	57                   	push   %edi
+  80337f:	e8 ed da ff ff       	call   800e71 <sys_env_set_pgfault_upcall>
+  803384:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803386:	83 c4 10             	add    $0x10,%esp
+  803389:	85 c0                	test   %eax,%eax
+  80338b:	78 14                	js     8033a1 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80338d:	83 ec 08             	sub    $0x8,%esp
+  803390:	6a 02                	push   $0x2
+  803392:	57                   	push   %edi
+  803393:	e8 45 da ff ff       	call   800ddd <sys_env_set_status>
+  803398:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80339a:	83 c4 10             	add    $0x10,%esp
+  80339d:	85 c0                	test   %eax,%eax
+  80339f:	79 11                	jns    8033b2 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8033a1:	83 ec 0c             	sub    $0xc,%esp
+  8033a4:	ff 75 e0             	push   -0x20(%ebp)
+  8033a7:	e8 cb d8 ff ff       	call   800c77 <sys_env_destroy>
+	return r;
+  8033ac:	83 c4 10             	add    $0x10,%esp
+  8033af:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8033b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033b8:	5b                   	pop    %ebx
+  8033b9:	5e                   	pop    %esi
+  8033ba:	5f                   	pop    %edi
+  8033bb:	5d                   	pop    %ebp
+  8033bc:	c3                   	ret
+
+008033bd <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8033bd:	55                   	push   %ebp
+  8033be:	89 e5                	mov    %esp,%ebp
+  8033c0:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8033c3:	68 df 3e 80 00       	push   $0x803edf
+  8033c8:	68 bf 00 00 00       	push   $0xbf
+  8033cd:	68 d4 3e 80 00       	push   $0x803ed4
+  8033d2:	e8 5a ce ff ff       	call   800231 <_panic>
+
+008033d7 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8033d7:	55                   	push   %ebp
+  8033d8:	89 e5                	mov    %esp,%ebp
+  8033da:	56                   	push   %esi
+  8033db:	53                   	push   %ebx
+  8033dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8033e5:	85 c0                	test   %eax,%eax
+  8033e7:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8033ec:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8033ef:	83 ec 0c             	sub    $0xc,%esp
+  8033f2:	50                   	push   %eax
+  8033f3:	e8 56 db ff ff       	call   800f4e <sys_ipc_recv>
+	if (from_env_store)
+  8033f8:	83 c4 10             	add    $0x10,%esp
+  8033fb:	85 f6                	test   %esi,%esi
+  8033fd:	74 14                	je     803413 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8033ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  803404:	85 c0                	test   %eax,%eax
+  803406:	75 09                	jne    803411 <ipc_recv+0x3a>
+  803408:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80340e:	8b 52 74             	mov    0x74(%edx),%edx
+  803411:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803413:	85 db                	test   %ebx,%ebx
+  803415:	74 25                	je     80343c <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803417:	85 c0                	test   %eax,%eax
+  803419:	74 0d                	je     803428 <ipc_recv+0x51>
+  80341b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803421:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803424:	5b                   	pop    %ebx
+  803425:	5e                   	pop    %esi
+  803426:	5d                   	pop    %ebp
+  803427:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803428:	a1 00 50 80 00       	mov    0x805000,%eax
+  80342d:	8b 40 78             	mov    0x78(%eax),%eax
+  803430:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803432:	a1 00 50 80 00       	mov    0x805000,%eax
+  803437:	8b 40 70             	mov    0x70(%eax),%eax
+  80343a:	eb e5                	jmp    803421 <ipc_recv+0x4a>
+  80343c:	85 c0                	test   %eax,%eax
+  80343e:	75 e1                	jne    803421 <ipc_recv+0x4a>
+  803440:	eb f0                	jmp    803432 <ipc_recv+0x5b>
+
+00803442 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803442:	55                   	push   %ebp
+  803443:	89 e5                	mov    %esp,%ebp
+  803445:	57                   	push   %edi
+  803446:	56                   	push   %esi
+  803447:	53                   	push   %ebx
+  803448:	83 ec 0c             	sub    $0xc,%esp
+  80344b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80344e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803451:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803454:	85 db                	test   %ebx,%ebx
+  803456:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80345b:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80345e:	ff 75 14             	push   0x14(%ebp)
+  803461:	53                   	push   %ebx
+  803462:	56                   	push   %esi
+  803463:	57                   	push   %edi
+  803464:	e8 52 da ff ff       	call   800ebb <sys_ipc_try_send>
+  803469:	83 c4 10             	add    $0x10,%esp
+  80346c:	85 c0                	test   %eax,%eax
+  80346e:	74 22                	je     803492 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803470:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803473:	75 07                	jne    80347c <ipc_send+0x3a>
+		sys_yield();
+  803475:	e8 6d d8 ff ff       	call   800ce7 <sys_yield>
+  80347a:	eb e2                	jmp    80345e <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80347c:	68 f5 3e 80 00       	push   $0x803ef5
+  803481:	68 a0 3d 80 00       	push   $0x803da0
+  803486:	6a 39                	push   $0x39
+  803488:	68 0a 3f 80 00       	push   $0x803f0a
+  80348d:	e8 9f cd ff ff       	call   800231 <_panic>
+	}
+}
+  803492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803495:	5b                   	pop    %ebx
+  803496:	5e                   	pop    %esi
+  803497:	5f                   	pop    %edi
+  803498:	5d                   	pop    %ebp
+  803499:	c3                   	ret
+
+0080349a <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80349a:	55                   	push   %ebp
+  80349b:	89 e5                	mov    %esp,%ebp
+  80349d:	57                   	push   %edi
+  80349e:	56                   	push   %esi
+  80349f:	53                   	push   %ebx
+  8034a0:	83 ec 10             	sub    $0x10,%esp
+  8034a3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8034a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8034ac:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8034af:	85 c0                	test   %eax,%eax
+  8034b1:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8034b6:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8034b9:	6a 00                	push   $0x0
+  8034bb:	ff 33                	push   (%ebx)
+  8034bd:	50                   	push   %eax
+  8034be:	e8 48 da ff ff       	call   800f0b <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8034c3:	83 c4 10             	add    $0x10,%esp
+  8034c6:	85 c0                	test   %eax,%eax
+  8034c8:	75 3c                	jne    803506 <ipc_recvv+0x6c>
+  8034ca:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8034d0:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8034d3:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8034d5:	85 ff                	test   %edi,%edi
+  8034d7:	74 4e                	je     803527 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8034d9:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8034df:	8b 52 74             	mov    0x74(%edx),%edx
+  8034e2:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8034e4:	85 f6                	test   %esi,%esi
+  8034e6:	74 18                	je     803500 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8034e8:	85 c0                	test   %eax,%eax
+  8034ea:	75 2d                	jne    803519 <ipc_recvv+0x7f>
+  8034ec:	a1 00 50 80 00       	mov    0x805000,%eax
+  8034f1:	8b 40 78             	mov    0x78(%eax),%eax
+  8034f4:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8034f6:	a1 00 50 80 00       	mov    0x805000,%eax
+  8034fb:	8b 40 70             	mov    0x70(%eax),%eax
+  8034fe:	eb 1f                	jmp    80351f <ipc_recvv+0x85>
+  803500:	85 c0                	test   %eax,%eax
+  803502:	75 1b                	jne    80351f <ipc_recvv+0x85>
+  803504:	eb f0                	jmp    8034f6 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803506:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80350c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803511:	85 ff                	test   %edi,%edi
+  803513:	75 cd                	jne    8034e2 <ipc_recvv+0x48>
+	if (perm_store)
+  803515:	85 f6                	test   %esi,%esi
+  803517:	74 e7                	je     803500 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803519:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80351f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803522:	5b                   	pop    %ebx
+  803523:	5e                   	pop    %esi
+  803524:	5f                   	pop    %edi
+  803525:	5d                   	pop    %ebp
+  803526:	c3                   	ret
+	if (perm_store)
+  803527:	85 f6                	test   %esi,%esi
+  803529:	75 bd                	jne    8034e8 <ipc_recvv+0x4e>
+  80352b:	eb c9                	jmp    8034f6 <ipc_recvv+0x5c>
+
+0080352d <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  80352d:	55                   	push   %ebp
+  80352e:	89 e5                	mov    %esp,%ebp
+  803530:	57                   	push   %edi
+  803531:	56                   	push   %esi
+  803532:	53                   	push   %ebx
+  803533:	83 ec 0c             	sub    $0xc,%esp
+  803536:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803539:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80353c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  80353f:	ff 75 14             	push   0x14(%ebp)
+  803542:	53                   	push   %ebx
+  803543:	56                   	push   %esi
+  803544:	57                   	push   %edi
+  803545:	e8 99 d9 ff ff       	call   800ee3 <sys_ipc_try_sendv>
+  80354a:	83 c4 10             	add    $0x10,%esp
+  80354d:	85 c0                	test   %eax,%eax
+  80354f:	74 22                	je     803573 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803551:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803554:	75 07                	jne    80355d <ipc_sendv+0x30>
+		sys_yield();
+  803556:	e8 8c d7 ff ff       	call   800ce7 <sys_yield>
+  80355b:	eb e2                	jmp    80353f <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80355d:	68 f5 3e 80 00       	push   $0x803ef5
+  803562:	68 a0 3d 80 00       	push   $0x803da0
+  803567:	6a 5c                	push   $0x5c
+  803569:	68 0a 3f 80 00       	push   $0x803f0a
+  80356e:	e8 be cc ff ff       	call   800231 <_panic>
+	}
+}
+  803573:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803576:	5b                   	pop    %ebx
+  803577:	5e                   	pop    %esi
+  803578:	5f                   	pop    %edi
+  803579:	5d                   	pop    %ebp
+  80357a:	c3                   	ret
+
+0080357b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80357b:	55                   	push   %ebp
+  80357c:	89 e5                	mov    %esp,%ebp
+  80357e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803581:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803586:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80358c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803592:	8b 52 50             	mov    0x50(%edx),%edx
+  803595:	39 ca                	cmp    %ecx,%edx
+  803597:	74 11                	je     8035aa <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803599:	83 c0 01             	add    $0x1,%eax
+  80359c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8035a1:	75 e3                	jne    803586 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8035a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a8:	eb 0e                	jmp    8035b8 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8035aa:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8035b0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8035b5:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8035b8:	5d                   	pop    %ebp
+  8035b9:	c3                   	ret
+
+008035ba <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8035ba:	55                   	push   %ebp
+  8035bb:	89 e5                	mov    %esp,%ebp
+  8035bd:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8035c0:	89 c2                	mov    %eax,%edx
+  8035c2:	c1 ea 16             	shr    $0x16,%edx
+  8035c5:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8035cc:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8035d1:	f6 c1 01             	test   $0x1,%cl
+  8035d4:	74 22                	je     8035f8 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8035d6:	c1 e8 0c             	shr    $0xc,%eax
+  8035d9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8035e0:	a8 01                	test   $0x1,%al
+  8035e2:	74 14                	je     8035f8 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8035e4:	c1 e8 0c             	shr    $0xc,%eax
+  8035e7:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8035ea:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8035f1:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8035f5:	0f b7 d2             	movzwl %dx,%edx
+}
+  8035f8:	89 d0                	mov    %edx,%eax
+  8035fa:	5d                   	pop    %ebp
+  8035fb:	c3                   	ret
+
+008035fc <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8035fc:	55                   	push   %ebp
+  8035fd:	89 e5                	mov    %esp,%ebp
+  8035ff:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803602:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  803609:	74 0a                	je     803615 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80360b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80360e:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  803613:	c9                   	leave
+  803614:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803615:	83 ec 04             	sub    $0x4,%esp
+  803618:	6a 07                	push   $0x7
+  80361a:	68 00 f0 bf ee       	push   $0xeebff000
+  80361f:	6a 00                	push   $0x0
+  803621:	e8 e0 d6 ff ff       	call   800d06 <sys_page_alloc>
+  803626:	83 c4 10             	add    $0x10,%esp
+  803629:	85 c0                	test   %eax,%eax
+  80362b:	75 2c                	jne    803659 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80362d:	83 ec 08             	sub    $0x8,%esp
+  803630:	68 6f 36 80 00       	push   $0x80366f
+  803635:	6a 00                	push   $0x0
+  803637:	e8 35 d8 ff ff       	call   800e71 <sys_env_set_pgfault_upcall>
+  80363c:	83 c4 10             	add    $0x10,%esp
+  80363f:	85 c0                	test   %eax,%eax
+  803641:	74 c8                	je     80360b <set_pgfault_handler+0xf>
+  803643:	68 5c 3f 80 00       	push   $0x803f5c
+  803648:	68 a0 3d 80 00       	push   $0x803da0
+  80364d:	6a 20                	push   $0x20
+  80364f:	68 8c 3f 80 00       	push   $0x803f8c
+  803654:	e8 d8 cb ff ff       	call   800231 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803659:	68 14 3f 80 00       	push   $0x803f14
+  80365e:	68 a0 3d 80 00       	push   $0x803da0
+  803663:	6a 1e                	push   $0x1e
+  803665:	68 8c 3f 80 00       	push   $0x803f8c
+  80366a:	e8 c2 cb ff ff       	call   800231 <_panic>
+
+0080366f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80366f:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803670:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  803675:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803677:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80367a:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  80367f:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803684:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803688:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80368b:	83 c4 08             	add    $0x8,%esp
+	popal
+  80368e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  80368f:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803692:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803693:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803694:	c3                   	ret
+
+00803695 <dm>:
+  803695:	55                   	push   %ebp
+  803696:	57                   	push   %edi
+  803697:	56                   	push   %esi
+  803698:	53                   	push   %ebx
+  803699:	83 ec 24             	sub    $0x24,%esp
+  80369c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8036a0:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8036a4:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036a8:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036ac:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8036b0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8036b4:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8036b8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8036bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036c7:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8036ce:	00 
+  8036cf:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8036d6:	00 
+  8036d7:	89 fb                	mov    %edi,%ebx
+  8036d9:	eb 08                	jmp    8036e3 <dm+0x4e>
+  8036db:	83 e9 01             	sub    $0x1,%ecx
+  8036de:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8036e1:	74 68                	je     80374b <dm+0xb6>
+  8036e3:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8036e7:	01 c0                	add    %eax,%eax
+  8036e9:	89 c6                	mov    %eax,%esi
+  8036eb:	89 d7                	mov    %edx,%edi
+  8036ed:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036f1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036f5:	0f ad d0             	shrd   %cl,%edx,%eax
+  8036f8:	d3 ea                	shr    %cl,%edx
+  8036fa:	f6 c1 20             	test   $0x20,%cl
+  8036fd:	74 04                	je     803703 <dm+0x6e>
+  8036ff:	89 d0                	mov    %edx,%eax
+  803701:	31 d2                	xor    %edx,%edx
+  803703:	83 e0 01             	and    $0x1,%eax
+  803706:	89 04 24             	mov    %eax,(%esp)
+  803709:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803710:	00 
+  803711:	8b 04 24             	mov    (%esp),%eax
+  803714:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803718:	09 f0                	or     %esi,%eax
+  80371a:	09 fa                	or     %edi,%edx
+  80371c:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803720:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803724:	39 f0                	cmp    %esi,%eax
+  803726:	89 d5                	mov    %edx,%ebp
+  803728:	19 fd                	sbb    %edi,%ebp
+  80372a:	72 af                	jb     8036db <dm+0x46>
+  80372c:	29 f0                	sub    %esi,%eax
+  80372e:	19 fa                	sbb    %edi,%edx
+  803730:	89 cf                	mov    %ecx,%edi
+  803732:	c1 ef 05             	shr    $0x5,%edi
+  803735:	83 e7 01             	and    $0x1,%edi
+  803738:	89 fe                	mov    %edi,%esi
+  80373a:	83 f6 01             	xor    $0x1,%esi
+  80373d:	d3 e6                	shl    %cl,%esi
+  80373f:	d3 e7                	shl    %cl,%edi
+  803741:	09 74 24 18          	or     %esi,0x18(%esp)
+  803745:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803749:	eb 90                	jmp    8036db <dm+0x46>
+  80374b:	85 db                	test   %ebx,%ebx
+  80374d:	74 05                	je     803754 <dm+0xbf>
+  80374f:	89 03                	mov    %eax,(%ebx)
+  803751:	89 53 04             	mov    %edx,0x4(%ebx)
+  803754:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803758:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80375c:	83 c4 24             	add    $0x24,%esp
+  80375f:	5b                   	pop    %ebx
+  803760:	5e                   	pop    %esi
+  803761:	5f                   	pop    %edi
+  803762:	5d                   	pop    %ebp
+  803763:	c3                   	ret
+
+00803764 <__udivdi3>:
+  803764:	83 ec 08             	sub    $0x8,%esp
+  803767:	6a 00                	push   $0x0
+  803769:	ff 74 24 1c          	push   0x1c(%esp)
+  80376d:	ff 74 24 1c          	push   0x1c(%esp)
+  803771:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803775:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803779:	e8 17 ff ff ff       	call   803695 <dm>
+  80377e:	83 c4 14             	add    $0x14,%esp
+  803781:	c3                   	ret
+
+00803782 <__umoddi3>:
+  803782:	83 ec 18             	sub    $0x18,%esp
+  803785:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803789:	50                   	push   %eax
+  80378a:	ff 74 24 2c          	push   0x2c(%esp)
+  80378e:	ff 74 24 2c          	push   0x2c(%esp)
+  803792:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803796:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80379a:	e8 f6 fe ff ff       	call   803695 <dm>
+  80379f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8037a3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8037a7:	83 c4 24             	add    $0x24,%esp
+  8037aa:	c3                   	ret
+
+008037ab <__divdi3>:
+  8037ab:	53                   	push   %ebx
+  8037ac:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8037b0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8037b4:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8037b8:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8037bc:	85 d2                	test   %edx,%edx
+  8037be:	78 15                	js     8037d5 <__divdi3+0x2a>
+  8037c0:	85 db                	test   %ebx,%ebx
+  8037c2:	78 34                	js     8037f8 <__divdi3+0x4d>
+  8037c4:	83 ec 04             	sub    $0x4,%esp
+  8037c7:	6a 00                	push   $0x0
+  8037c9:	53                   	push   %ebx
+  8037ca:	51                   	push   %ecx
+  8037cb:	e8 c5 fe ff ff       	call   803695 <dm>
+  8037d0:	83 c4 10             	add    $0x10,%esp
+  8037d3:	eb 21                	jmp    8037f6 <__divdi3+0x4b>
+  8037d5:	f7 d8                	neg    %eax
+  8037d7:	83 d2 00             	adc    $0x0,%edx
+  8037da:	f7 da                	neg    %edx
+  8037dc:	85 db                	test   %ebx,%ebx
+  8037de:	78 30                	js     803810 <__divdi3+0x65>
+  8037e0:	83 ec 04             	sub    $0x4,%esp
+  8037e3:	6a 00                	push   $0x0
+  8037e5:	53                   	push   %ebx
+  8037e6:	51                   	push   %ecx
+  8037e7:	e8 a9 fe ff ff       	call   803695 <dm>
+  8037ec:	83 c4 10             	add    $0x10,%esp
+  8037ef:	f7 d8                	neg    %eax
+  8037f1:	83 d2 00             	adc    $0x0,%edx
+  8037f4:	f7 da                	neg    %edx
+  8037f6:	5b                   	pop    %ebx
+  8037f7:	c3                   	ret
+  8037f8:	83 ec 04             	sub    $0x4,%esp
+  8037fb:	6a 00                	push   $0x0
+  8037fd:	f7 d9                	neg    %ecx
+  8037ff:	83 d3 00             	adc    $0x0,%ebx
+  803802:	f7 db                	neg    %ebx
+  803804:	53                   	push   %ebx
+  803805:	51                   	push   %ecx
+  803806:	e8 8a fe ff ff       	call   803695 <dm>
+  80380b:	83 c4 10             	add    $0x10,%esp
+  80380e:	eb df                	jmp    8037ef <__divdi3+0x44>
+  803810:	83 ec 04             	sub    $0x4,%esp
+  803813:	6a 00                	push   $0x0
+  803815:	f7 d9                	neg    %ecx
+  803817:	83 d3 00             	adc    $0x0,%ebx
+  80381a:	f7 db                	neg    %ebx
+  80381c:	53                   	push   %ebx
+  80381d:	51                   	push   %ecx
+  80381e:	e8 72 fe ff ff       	call   803695 <dm>
+  803823:	83 c4 10             	add    $0x10,%esp
+  803826:	eb ce                	jmp    8037f6 <__divdi3+0x4b>
+
+00803828 <__moddi3>:
+  803828:	55                   	push   %ebp
+  803829:	57                   	push   %edi
+  80382a:	56                   	push   %esi
+  80382b:	53                   	push   %ebx
+  80382c:	83 ec 24             	sub    $0x24,%esp
+  80382f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803833:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803837:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80383b:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80383f:	85 d2                	test   %edx,%edx
+  803841:	78 3b                	js     80387e <__moddi3+0x56>
+  803843:	83 ec 04             	sub    $0x4,%esp
+  803846:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80384a:	56                   	push   %esi
+  80384b:	89 ce                	mov    %ecx,%esi
+  80384d:	f7 de                	neg    %esi
+  80384f:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803853:	89 de                	mov    %ebx,%esi
+  803855:	83 d6 00             	adc    $0x0,%esi
+  803858:	f7 de                	neg    %esi
+  80385a:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80385e:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803862:	0f 48 f1             	cmovs  %ecx,%esi
+  803865:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80386a:	53                   	push   %ebx
+  80386b:	56                   	push   %esi
+  80386c:	e8 24 fe ff ff       	call   803695 <dm>
+  803871:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803875:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803879:	83 c4 10             	add    $0x10,%esp
+  80387c:	eb 47                	jmp    8038c5 <__moddi3+0x9d>
+  80387e:	f7 d8                	neg    %eax
+  803880:	83 d2 00             	adc    $0x0,%edx
+  803883:	f7 da                	neg    %edx
+  803885:	83 ec 04             	sub    $0x4,%esp
+  803888:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80388c:	56                   	push   %esi
+  80388d:	89 cf                	mov    %ecx,%edi
+  80388f:	f7 df                	neg    %edi
+  803891:	89 de                	mov    %ebx,%esi
+  803893:	83 d6 00             	adc    $0x0,%esi
+  803896:	f7 de                	neg    %esi
+  803898:	0f 49 cf             	cmovns %edi,%ecx
+  80389b:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80389f:	0f 49 de             	cmovns %esi,%ebx
+  8038a2:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8038a6:	ff 74 24 0c          	push   0xc(%esp)
+  8038aa:	ff 74 24 0c          	push   0xc(%esp)
+  8038ae:	e8 e2 fd ff ff       	call   803695 <dm>
+  8038b3:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8038b7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038bb:	f7 d8                	neg    %eax
+  8038bd:	83 d2 00             	adc    $0x0,%edx
+  8038c0:	f7 da                	neg    %edx
+  8038c2:	83 c4 10             	add    $0x10,%esp
+  8038c5:	83 c4 24             	add    $0x24,%esp
+  8038c8:	5b                   	pop    %ebx
+  8038c9:	5e                   	pop    %esi
+  8038ca:	5f                   	pop    %edi
+  8038cb:	5d                   	pop    %ebp
+  8038cc:	c3                   	ret
@@ -0,0 +1,7704 @@
+
+obj/user/echo.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b3 00 00 00       	call   8000e4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80003f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i, nflag;
+
+	nflag = 0;
+  800042:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800049:	83 ff 01             	cmp    $0x1,%edi
+  80004c:	7f 07                	jg     800055 <umain+0x22>
+		nflag = 1;
+		argc--;
+		argv++;
+	}
+	for (i = 1; i < argc; i++) {
+  80004e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800053:	eb 4c                	jmp    8000a1 <umain+0x6e>
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	68 00 38 80 00       	push   $0x803800
+  80005d:	ff 76 04             	push   0x4(%esi)
+  800060:	e8 ce 01 00 00       	call   800233 <strcmp>
+  800065:	83 c4 10             	add    $0x10,%esp
+	nflag = 0;
+  800068:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	75 db                	jne    80004e <umain+0x1b>
+		argc--;
+  800073:	83 ef 01             	sub    $0x1,%edi
+		argv++;
+  800076:	83 c6 04             	add    $0x4,%esi
+		nflag = 1;
+  800079:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  800080:	eb cc                	jmp    80004e <umain+0x1b>
+		if (i > 1)
+			write(1, " ", 1);
+		write(1, argv[i], strlen(argv[i]));
+  800082:	83 ec 0c             	sub    $0xc,%esp
+  800085:	ff 34 9e             	push   (%esi,%ebx,4)
+  800088:	e8 ba 00 00 00       	call   800147 <strlen>
+  80008d:	83 c4 0c             	add    $0xc,%esp
+  800090:	50                   	push   %eax
+  800091:	ff 34 9e             	push   (%esi,%ebx,4)
+  800094:	6a 01                	push   $0x1
+  800096:	e8 a5 0c 00 00       	call   800d40 <write>
+	for (i = 1; i < argc; i++) {
+  80009b:	83 c3 01             	add    $0x1,%ebx
+  80009e:	83 c4 10             	add    $0x10,%esp
+  8000a1:	39 df                	cmp    %ebx,%edi
+  8000a3:	7e 1b                	jle    8000c0 <umain+0x8d>
+		if (i > 1)
+  8000a5:	83 fb 01             	cmp    $0x1,%ebx
+  8000a8:	7e d8                	jle    800082 <umain+0x4f>
+			write(1, " ", 1);
+  8000aa:	83 ec 04             	sub    $0x4,%esp
+  8000ad:	6a 01                	push   $0x1
+  8000af:	68 03 38 80 00       	push   $0x803803
+  8000b4:	6a 01                	push   $0x1
+  8000b6:	e8 85 0c 00 00       	call   800d40 <write>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	eb c2                	jmp    800082 <umain+0x4f>
+	}
+	if (!nflag)
+  8000c0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8000c4:	74 08                	je     8000ce <umain+0x9b>
+		write(1, "\n", 1);
+}
+  8000c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000c9:	5b                   	pop    %ebx
+  8000ca:	5e                   	pop    %esi
+  8000cb:	5f                   	pop    %edi
+  8000cc:	5d                   	pop    %ebp
+  8000cd:	c3                   	ret
+		write(1, "\n", 1);
+  8000ce:	83 ec 04             	sub    $0x4,%esp
+  8000d1:	6a 01                	push   $0x1
+  8000d3:	68 8f 39 80 00       	push   $0x80398f
+  8000d8:	6a 01                	push   $0x1
+  8000da:	e8 61 0c 00 00       	call   800d40 <write>
+  8000df:	83 c4 10             	add    $0x10,%esp
+}
+  8000e2:	eb e2                	jmp    8000c6 <umain+0x93>
+
+008000e4 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	56                   	push   %esi
+  8000e8:	53                   	push   %ebx
+  8000e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000ef:	e8 54 04 00 00       	call   800548 <sys_getenvid>
+  8000f4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f9:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8000ff:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800104:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800109:	85 db                	test   %ebx,%ebx
+  80010b:	7e 07                	jle    800114 <libmain+0x30>
+		binaryname = argv[0];
+  80010d:	8b 06                	mov    (%esi),%eax
+  80010f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	56                   	push   %esi
+  800118:	53                   	push   %ebx
+  800119:	e8 15 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80011e:	e8 0a 00 00 00       	call   80012d <exit>
+}
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800129:	5b                   	pop    %ebx
+  80012a:	5e                   	pop    %esi
+  80012b:	5d                   	pop    %ebp
+  80012c:	c3                   	ret
+
+0080012d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800133:	e8 2b 0a 00 00       	call   800b63 <close_all>
+	sys_env_destroy(0);
+  800138:	83 ec 0c             	sub    $0xc,%esp
+  80013b:	6a 00                	push   $0x0
+  80013d:	e8 bd 03 00 00       	call   8004ff <sys_env_destroy>
+}
+  800142:	83 c4 10             	add    $0x10,%esp
+  800145:	c9                   	leave
+  800146:	c3                   	ret
+
+00800147 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800147:	55                   	push   %ebp
+  800148:	89 e5                	mov    %esp,%ebp
+  80014a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80014d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800152:	eb 03                	jmp    800157 <strlen+0x10>
+		n++;
+  800154:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800157:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80015b:	75 f7                	jne    800154 <strlen+0xd>
+	return n;
+}
+  80015d:	5d                   	pop    %ebp
+  80015e:	c3                   	ret
+
+0080015f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80015f:	55                   	push   %ebp
+  800160:	89 e5                	mov    %esp,%ebp
+  800162:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800165:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800168:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016d:	eb 03                	jmp    800172 <strnlen+0x13>
+		n++;
+  80016f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800172:	39 d0                	cmp    %edx,%eax
+  800174:	74 08                	je     80017e <strnlen+0x1f>
+  800176:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80017a:	75 f3                	jne    80016f <strnlen+0x10>
+  80017c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80017e:	89 d0                	mov    %edx,%eax
+  800180:	5d                   	pop    %ebp
+  800181:	c3                   	ret
+
+00800182 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800182:	55                   	push   %ebp
+  800183:	89 e5                	mov    %esp,%ebp
+  800185:	53                   	push   %ebx
+  800186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800195:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800198:	83 c0 01             	add    $0x1,%eax
+  80019b:	84 d2                	test   %dl,%dl
+  80019d:	75 f2                	jne    800191 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80019f:	89 c8                	mov    %ecx,%eax
+  8001a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001a4:	c9                   	leave
+  8001a5:	c3                   	ret
+
+008001a6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8001a6:	55                   	push   %ebp
+  8001a7:	89 e5                	mov    %esp,%ebp
+  8001a9:	53                   	push   %ebx
+  8001aa:	83 ec 10             	sub    $0x10,%esp
+  8001ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8001b0:	53                   	push   %ebx
+  8001b1:	e8 91 ff ff ff       	call   800147 <strlen>
+  8001b6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8001b9:	ff 75 0c             	push   0xc(%ebp)
+  8001bc:	01 d8                	add    %ebx,%eax
+  8001be:	50                   	push   %eax
+  8001bf:	e8 be ff ff ff       	call   800182 <strcpy>
+	return dst;
+}
+  8001c4:	89 d8                	mov    %ebx,%eax
+  8001c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c9:	c9                   	leave
+  8001ca:	c3                   	ret
+
+008001cb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8001cb:	55                   	push   %ebp
+  8001cc:	89 e5                	mov    %esp,%ebp
+  8001ce:	56                   	push   %esi
+  8001cf:	53                   	push   %ebx
+  8001d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8001d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8001d6:	89 f3                	mov    %esi,%ebx
+  8001d8:	03 5d 10             	add    0x10(%ebp),%ebx
+  8001db:	89 f0                	mov    %esi,%eax
+  8001dd:	eb 0f                	jmp    8001ee <strncpy+0x23>
+		*dst++ = *src;
+  8001df:	83 c0 01             	add    $0x1,%eax
+  8001e2:	0f b6 0a             	movzbl (%edx),%ecx
+  8001e5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8001e8:	80 f9 01             	cmp    $0x1,%cl
+  8001eb:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8001ee:	39 d8                	cmp    %ebx,%eax
+  8001f0:	75 ed                	jne    8001df <strncpy+0x14>
+	}
+	return ret;
+}
+  8001f2:	89 f0                	mov    %esi,%eax
+  8001f4:	5b                   	pop    %ebx
+  8001f5:	5e                   	pop    %esi
+  8001f6:	5d                   	pop    %ebp
+  8001f7:	c3                   	ret
+
+008001f8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8001f8:	55                   	push   %ebp
+  8001f9:	89 e5                	mov    %esp,%ebp
+  8001fb:	56                   	push   %esi
+  8001fc:	53                   	push   %ebx
+  8001fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800200:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800203:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800206:	89 f0                	mov    %esi,%eax
+  800208:	85 d2                	test   %edx,%edx
+  80020a:	74 21                	je     80022d <strlcpy+0x35>
+  80020c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800210:	89 f2                	mov    %esi,%edx
+  800212:	eb 09                	jmp    80021d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800214:	83 c1 01             	add    $0x1,%ecx
+  800217:	83 c2 01             	add    $0x1,%edx
+  80021a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80021d:	39 c2                	cmp    %eax,%edx
+  80021f:	74 09                	je     80022a <strlcpy+0x32>
+  800221:	0f b6 19             	movzbl (%ecx),%ebx
+  800224:	84 db                	test   %bl,%bl
+  800226:	75 ec                	jne    800214 <strlcpy+0x1c>
+  800228:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80022a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80022d:	29 f0                	sub    %esi,%eax
+}
+  80022f:	5b                   	pop    %ebx
+  800230:	5e                   	pop    %esi
+  800231:	5d                   	pop    %ebp
+  800232:	c3                   	ret
+
+00800233 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800233:	55                   	push   %ebp
+  800234:	89 e5                	mov    %esp,%ebp
+  800236:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800239:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80023c:	eb 06                	jmp    800244 <strcmp+0x11>
+		p++, q++;
+  80023e:	83 c1 01             	add    $0x1,%ecx
+  800241:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800244:	0f b6 01             	movzbl (%ecx),%eax
+  800247:	84 c0                	test   %al,%al
+  800249:	74 04                	je     80024f <strcmp+0x1c>
+  80024b:	3a 02                	cmp    (%edx),%al
+  80024d:	74 ef                	je     80023e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80024f:	0f b6 c0             	movzbl %al,%eax
+  800252:	0f b6 12             	movzbl (%edx),%edx
+  800255:	29 d0                	sub    %edx,%eax
+}
+  800257:	5d                   	pop    %ebp
+  800258:	c3                   	ret
+
+00800259 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800259:	55                   	push   %ebp
+  80025a:	89 e5                	mov    %esp,%ebp
+  80025c:	53                   	push   %ebx
+  80025d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800260:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800263:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800266:	eb 09                	jmp    800271 <strncmp+0x18>
+		n--, p++, q++;
+  800268:	83 ea 01             	sub    $0x1,%edx
+  80026b:	83 c0 01             	add    $0x1,%eax
+  80026e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800271:	85 d2                	test   %edx,%edx
+  800273:	74 18                	je     80028d <strncmp+0x34>
+  800275:	0f b6 18             	movzbl (%eax),%ebx
+  800278:	84 db                	test   %bl,%bl
+  80027a:	74 04                	je     800280 <strncmp+0x27>
+  80027c:	3a 19                	cmp    (%ecx),%bl
+  80027e:	74 e8                	je     800268 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800280:	0f b6 00             	movzbl (%eax),%eax
+  800283:	0f b6 11             	movzbl (%ecx),%edx
+  800286:	29 d0                	sub    %edx,%eax
+}
+  800288:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80028b:	c9                   	leave
+  80028c:	c3                   	ret
+		return 0;
+  80028d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800292:	eb f4                	jmp    800288 <strncmp+0x2f>
+
+00800294 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800294:	55                   	push   %ebp
+  800295:	89 e5                	mov    %esp,%ebp
+  800297:	8b 45 08             	mov    0x8(%ebp),%eax
+  80029a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80029e:	eb 03                	jmp    8002a3 <strchr+0xf>
+  8002a0:	83 c0 01             	add    $0x1,%eax
+  8002a3:	0f b6 10             	movzbl (%eax),%edx
+  8002a6:	84 d2                	test   %dl,%dl
+  8002a8:	74 06                	je     8002b0 <strchr+0x1c>
+		if (*s == c)
+  8002aa:	38 ca                	cmp    %cl,%dl
+  8002ac:	75 f2                	jne    8002a0 <strchr+0xc>
+  8002ae:	eb 05                	jmp    8002b5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8002b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8002b5:	5d                   	pop    %ebp
+  8002b6:	c3                   	ret
+
+008002b7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8002b7:	55                   	push   %ebp
+  8002b8:	89 e5                	mov    %esp,%ebp
+  8002ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002bd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8002c1:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8002c4:	38 ca                	cmp    %cl,%dl
+  8002c6:	74 09                	je     8002d1 <strfind+0x1a>
+  8002c8:	84 d2                	test   %dl,%dl
+  8002ca:	74 05                	je     8002d1 <strfind+0x1a>
+	for (; *s; s++)
+  8002cc:	83 c0 01             	add    $0x1,%eax
+  8002cf:	eb f0                	jmp    8002c1 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8002d1:	5d                   	pop    %ebp
+  8002d2:	c3                   	ret
+
+008002d3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8002d3:	55                   	push   %ebp
+  8002d4:	89 e5                	mov    %esp,%ebp
+  8002d6:	57                   	push   %edi
+  8002d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002da:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8002dd:	85 c9                	test   %ecx,%ecx
+  8002df:	74 20                	je     800301 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8002e1:	89 f8                	mov    %edi,%eax
+  8002e3:	09 c8                	or     %ecx,%eax
+  8002e5:	a8 03                	test   $0x3,%al
+  8002e7:	75 12                	jne    8002fb <memset+0x28>
+		c &= 0xFF;
+  8002e9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8002ed:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8002f3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8002f6:	fc                   	cld
+  8002f7:	f3 ab                	rep stos %eax,%es:(%edi)
+  8002f9:	eb 06                	jmp    800301 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8002fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002fe:	fc                   	cld
+  8002ff:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800301:	89 f8                	mov    %edi,%eax
+  800303:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800306:	c9                   	leave
+  800307:	c3                   	ret
+
+00800308 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800308:	55                   	push   %ebp
+  800309:	89 e5                	mov    %esp,%ebp
+  80030b:	57                   	push   %edi
+  80030c:	56                   	push   %esi
+  80030d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800310:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800313:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800316:	39 c6                	cmp    %eax,%esi
+  800318:	73 32                	jae    80034c <memmove+0x44>
+  80031a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80031d:	39 d0                	cmp    %edx,%eax
+  80031f:	73 2b                	jae    80034c <memmove+0x44>
+		s += n;
+		d += n;
+  800321:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800324:	89 d6                	mov    %edx,%esi
+  800326:	09 fe                	or     %edi,%esi
+  800328:	09 ce                	or     %ecx,%esi
+  80032a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800330:	75 0e                	jne    800340 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800332:	83 ef 04             	sub    $0x4,%edi
+  800335:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800338:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80033b:	fd                   	std
+  80033c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80033e:	eb 09                	jmp    800349 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800340:	83 ef 01             	sub    $0x1,%edi
+  800343:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800346:	fd                   	std
+  800347:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800349:	fc                   	cld
+  80034a:	eb 1a                	jmp    800366 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80034c:	89 f2                	mov    %esi,%edx
+  80034e:	09 c2                	or     %eax,%edx
+  800350:	09 ca                	or     %ecx,%edx
+  800352:	f6 c2 03             	test   $0x3,%dl
+  800355:	75 0a                	jne    800361 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800357:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80035a:	89 c7                	mov    %eax,%edi
+  80035c:	fc                   	cld
+  80035d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80035f:	eb 05                	jmp    800366 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800361:	89 c7                	mov    %eax,%edi
+  800363:	fc                   	cld
+  800364:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800366:	5e                   	pop    %esi
+  800367:	5f                   	pop    %edi
+  800368:	5d                   	pop    %ebp
+  800369:	c3                   	ret
+
+0080036a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80036a:	55                   	push   %ebp
+  80036b:	89 e5                	mov    %esp,%ebp
+  80036d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800370:	ff 75 10             	push   0x10(%ebp)
+  800373:	ff 75 0c             	push   0xc(%ebp)
+  800376:	ff 75 08             	push   0x8(%ebp)
+  800379:	e8 8a ff ff ff       	call   800308 <memmove>
+}
+  80037e:	c9                   	leave
+  80037f:	c3                   	ret
+
+00800380 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800380:	55                   	push   %ebp
+  800381:	89 e5                	mov    %esp,%ebp
+  800383:	56                   	push   %esi
+  800384:	53                   	push   %ebx
+  800385:	8b 45 08             	mov    0x8(%ebp),%eax
+  800388:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80038b:	89 c6                	mov    %eax,%esi
+  80038d:	03 75 10             	add    0x10(%ebp),%esi
+  800390:	eb 06                	jmp    800398 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800392:	83 c0 01             	add    $0x1,%eax
+  800395:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800398:	39 f0                	cmp    %esi,%eax
+  80039a:	74 14                	je     8003b0 <memcmp+0x30>
+		if (*s1 != *s2)
+  80039c:	0f b6 08             	movzbl (%eax),%ecx
+  80039f:	0f b6 1a             	movzbl (%edx),%ebx
+  8003a2:	38 d9                	cmp    %bl,%cl
+  8003a4:	74 ec                	je     800392 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8003a6:	0f b6 c1             	movzbl %cl,%eax
+  8003a9:	0f b6 db             	movzbl %bl,%ebx
+  8003ac:	29 d8                	sub    %ebx,%eax
+  8003ae:	eb 05                	jmp    8003b5 <memcmp+0x35>
+	}
+
+	return 0;
+  8003b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003b5:	5b                   	pop    %ebx
+  8003b6:	5e                   	pop    %esi
+  8003b7:	5d                   	pop    %ebp
+  8003b8:	c3                   	ret
+
+008003b9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8003b9:	55                   	push   %ebp
+  8003ba:	89 e5                	mov    %esp,%ebp
+  8003bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8003c2:	89 c2                	mov    %eax,%edx
+  8003c4:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8003c7:	eb 03                	jmp    8003cc <memfind+0x13>
+  8003c9:	83 c0 01             	add    $0x1,%eax
+  8003cc:	39 d0                	cmp    %edx,%eax
+  8003ce:	73 04                	jae    8003d4 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8003d0:	38 08                	cmp    %cl,(%eax)
+  8003d2:	75 f5                	jne    8003c9 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8003d4:	5d                   	pop    %ebp
+  8003d5:	c3                   	ret
+
+008003d6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8003d6:	55                   	push   %ebp
+  8003d7:	89 e5                	mov    %esp,%ebp
+  8003d9:	57                   	push   %edi
+  8003da:	56                   	push   %esi
+  8003db:	53                   	push   %ebx
+  8003dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8003e2:	eb 03                	jmp    8003e7 <strtol+0x11>
+		s++;
+  8003e4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8003e7:	0f b6 02             	movzbl (%edx),%eax
+  8003ea:	3c 20                	cmp    $0x20,%al
+  8003ec:	74 f6                	je     8003e4 <strtol+0xe>
+  8003ee:	3c 09                	cmp    $0x9,%al
+  8003f0:	74 f2                	je     8003e4 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8003f2:	3c 2b                	cmp    $0x2b,%al
+  8003f4:	74 2a                	je     800420 <strtol+0x4a>
+	int neg = 0;
+  8003f6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8003fb:	3c 2d                	cmp    $0x2d,%al
+  8003fd:	74 2b                	je     80042a <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8003ff:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800405:	75 0f                	jne    800416 <strtol+0x40>
+  800407:	80 3a 30             	cmpb   $0x30,(%edx)
+  80040a:	74 28                	je     800434 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80040c:	85 db                	test   %ebx,%ebx
+  80040e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800413:	0f 44 d8             	cmove  %eax,%ebx
+  800416:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80041b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80041e:	eb 46                	jmp    800466 <strtol+0x90>
+		s++;
+  800420:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800423:	bf 00 00 00 00       	mov    $0x0,%edi
+  800428:	eb d5                	jmp    8003ff <strtol+0x29>
+		s++, neg = 1;
+  80042a:	83 c2 01             	add    $0x1,%edx
+  80042d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800432:	eb cb                	jmp    8003ff <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800434:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800438:	74 0e                	je     800448 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  80043a:	85 db                	test   %ebx,%ebx
+  80043c:	75 d8                	jne    800416 <strtol+0x40>
+		s++, base = 8;
+  80043e:	83 c2 01             	add    $0x1,%edx
+  800441:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800446:	eb ce                	jmp    800416 <strtol+0x40>
+		s += 2, base = 16;
+  800448:	83 c2 02             	add    $0x2,%edx
+  80044b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800450:	eb c4                	jmp    800416 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800452:	0f be c0             	movsbl %al,%eax
+  800455:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800458:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80045b:	7d 3a                	jge    800497 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  80045d:	83 c2 01             	add    $0x1,%edx
+  800460:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800464:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800466:	0f b6 02             	movzbl (%edx),%eax
+  800469:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80046c:	89 f3                	mov    %esi,%ebx
+  80046e:	80 fb 09             	cmp    $0x9,%bl
+  800471:	76 df                	jbe    800452 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800473:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800476:	89 f3                	mov    %esi,%ebx
+  800478:	80 fb 19             	cmp    $0x19,%bl
+  80047b:	77 08                	ja     800485 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  80047d:	0f be c0             	movsbl %al,%eax
+  800480:	83 e8 57             	sub    $0x57,%eax
+  800483:	eb d3                	jmp    800458 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800485:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800488:	89 f3                	mov    %esi,%ebx
+  80048a:	80 fb 19             	cmp    $0x19,%bl
+  80048d:	77 08                	ja     800497 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80048f:	0f be c0             	movsbl %al,%eax
+  800492:	83 e8 37             	sub    $0x37,%eax
+  800495:	eb c1                	jmp    800458 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800497:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80049b:	74 05                	je     8004a2 <strtol+0xcc>
+		*endptr = (char *) s;
+  80049d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8004a0:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8004a2:	89 c8                	mov    %ecx,%eax
+  8004a4:	f7 d8                	neg    %eax
+  8004a6:	85 ff                	test   %edi,%edi
+  8004a8:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8004ab:	89 c8                	mov    %ecx,%eax
+  8004ad:	5b                   	pop    %ebx
+  8004ae:	5e                   	pop    %esi
+  8004af:	5f                   	pop    %edi
+  8004b0:	5d                   	pop    %ebp
+  8004b1:	c3                   	ret
+
+008004b2 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8004b2:	55                   	push   %ebp
+  8004b3:	89 e5                	mov    %esp,%ebp
+  8004b5:	57                   	push   %edi
+  8004b6:	56                   	push   %esi
+  8004b7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c3:	89 c3                	mov    %eax,%ebx
+  8004c5:	89 c7                	mov    %eax,%edi
+  8004c7:	55                   	push   %ebp
+  8004c8:	89 e5                	mov    %esp,%ebp
+  8004ca:	8d 35 d2 04 80 00    	lea    0x8004d2,%esi
+  8004d0:	0f 34                	sysenter
+  8004d2:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  8004d3:	5b                   	pop    %ebx
+  8004d4:	5e                   	pop    %esi
+  8004d5:	5f                   	pop    %edi
+  8004d6:	5d                   	pop    %ebp
+  8004d7:	c3                   	ret
+
+008004d8 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8004d8:	55                   	push   %ebp
+  8004d9:	89 e5                	mov    %esp,%ebp
+  8004db:	57                   	push   %edi
+  8004dc:	56                   	push   %esi
+  8004dd:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004e8:	89 d1                	mov    %edx,%ecx
+  8004ea:	89 d3                	mov    %edx,%ebx
+  8004ec:	89 d7                	mov    %edx,%edi
+  8004ee:	55                   	push   %ebp
+  8004ef:	89 e5                	mov    %esp,%ebp
+  8004f1:	8d 35 f9 04 80 00    	lea    0x8004f9,%esi
+  8004f7:	0f 34                	sysenter
+  8004f9:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  8004fa:	5b                   	pop    %ebx
+  8004fb:	5e                   	pop    %esi
+  8004fc:	5f                   	pop    %edi
+  8004fd:	5d                   	pop    %ebp
+  8004fe:	c3                   	ret
+
+008004ff <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8004ff:	55                   	push   %ebp
+  800500:	89 e5                	mov    %esp,%ebp
+  800502:	57                   	push   %edi
+  800503:	56                   	push   %esi
+  800504:	53                   	push   %ebx
+  800505:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800508:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80050d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800510:	b8 03 00 00 00       	mov    $0x3,%eax
+  800515:	89 cb                	mov    %ecx,%ebx
+  800517:	89 cf                	mov    %ecx,%edi
+  800519:	55                   	push   %ebp
+  80051a:	89 e5                	mov    %esp,%ebp
+  80051c:	8d 35 24 05 80 00    	lea    0x800524,%esi
+  800522:	0f 34                	sysenter
+  800524:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800525:	85 c0                	test   %eax,%eax
+  800527:	7f 08                	jg     800531 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80052c:	5b                   	pop    %ebx
+  80052d:	5e                   	pop    %esi
+  80052e:	5f                   	pop    %edi
+  80052f:	5d                   	pop    %ebp
+  800530:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800531:	83 ec 0c             	sub    $0xc,%esp
+  800534:	50                   	push   %eax
+  800535:	6a 03                	push   $0x3
+  800537:	68 0f 38 80 00       	push   $0x80380f
+  80053c:	6a 3d                	push   $0x3d
+  80053e:	68 2c 38 80 00       	push   $0x80382c
+  800543:	e8 02 24 00 00       	call   80294a <_panic>
+
+00800548 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800548:	55                   	push   %ebp
+  800549:	89 e5                	mov    %esp,%ebp
+  80054b:	57                   	push   %edi
+  80054c:	56                   	push   %esi
+  80054d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80054e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800553:	b8 02 00 00 00       	mov    $0x2,%eax
+  800558:	89 d1                	mov    %edx,%ecx
+  80055a:	89 d3                	mov    %edx,%ebx
+  80055c:	89 d7                	mov    %edx,%edi
+  80055e:	55                   	push   %ebp
+  80055f:	89 e5                	mov    %esp,%ebp
+  800561:	8d 35 69 05 80 00    	lea    0x800569,%esi
+  800567:	0f 34                	sysenter
+  800569:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  80056a:	5b                   	pop    %ebx
+  80056b:	5e                   	pop    %esi
+  80056c:	5f                   	pop    %edi
+  80056d:	5d                   	pop    %ebp
+  80056e:	c3                   	ret
+
+0080056f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80056f:	55                   	push   %ebp
+  800570:	89 e5                	mov    %esp,%ebp
+  800572:	57                   	push   %edi
+  800573:	56                   	push   %esi
+  800574:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800575:	ba 00 00 00 00       	mov    $0x0,%edx
+  80057a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80057f:	89 d1                	mov    %edx,%ecx
+  800581:	89 d3                	mov    %edx,%ebx
+  800583:	89 d7                	mov    %edx,%edi
+  800585:	89 d6                	mov    %edx,%esi
+  800587:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800589:	5b                   	pop    %ebx
+  80058a:	5e                   	pop    %esi
+  80058b:	5f                   	pop    %edi
+  80058c:	5d                   	pop    %ebp
+  80058d:	c3                   	ret
+
+0080058e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80058e:	55                   	push   %ebp
+  80058f:	89 e5                	mov    %esp,%ebp
+  800591:	57                   	push   %edi
+  800592:	56                   	push   %esi
+  800593:	53                   	push   %ebx
+  800594:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800597:	8b 55 08             	mov    0x8(%ebp),%edx
+  80059a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80059d:	b8 04 00 00 00       	mov    $0x4,%eax
+  8005a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005aa:	55                   	push   %ebp
+  8005ab:	89 e5                	mov    %esp,%ebp
+  8005ad:	8d 35 b5 05 80 00    	lea    0x8005b5,%esi
+  8005b3:	0f 34                	sysenter
+  8005b5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8005b6:	85 c0                	test   %eax,%eax
+  8005b8:	7f 08                	jg     8005c2 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  8005ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005bd:	5b                   	pop    %ebx
+  8005be:	5e                   	pop    %esi
+  8005bf:	5f                   	pop    %edi
+  8005c0:	5d                   	pop    %ebp
+  8005c1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8005c2:	83 ec 0c             	sub    $0xc,%esp
+  8005c5:	50                   	push   %eax
+  8005c6:	6a 04                	push   $0x4
+  8005c8:	68 0f 38 80 00       	push   $0x80380f
+  8005cd:	6a 3d                	push   $0x3d
+  8005cf:	68 2c 38 80 00       	push   $0x80382c
+  8005d4:	e8 71 23 00 00       	call   80294a <_panic>
+
+008005d9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8005d9:	55                   	push   %ebp
+  8005da:	89 e5                	mov    %esp,%ebp
+  8005dc:	57                   	push   %edi
+  8005dd:	56                   	push   %esi
+  8005de:	53                   	push   %ebx
+  8005df:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8005e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005e8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8005ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005f0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8005f3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8005f6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8005f8:	85 c0                	test   %eax,%eax
+  8005fa:	7f 08                	jg     800604 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8005fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005ff:	5b                   	pop    %ebx
+  800600:	5e                   	pop    %esi
+  800601:	5f                   	pop    %edi
+  800602:	5d                   	pop    %ebp
+  800603:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800604:	83 ec 0c             	sub    $0xc,%esp
+  800607:	50                   	push   %eax
+  800608:	6a 05                	push   $0x5
+  80060a:	68 0f 38 80 00       	push   $0x80380f
+  80060f:	6a 23                	push   $0x23
+  800611:	68 2c 38 80 00       	push   $0x80382c
+  800616:	e8 2f 23 00 00       	call   80294a <_panic>
+
+0080061b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80061b:	55                   	push   %ebp
+  80061c:	89 e5                	mov    %esp,%ebp
+  80061e:	57                   	push   %edi
+  80061f:	56                   	push   %esi
+  800620:	53                   	push   %ebx
+  800621:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800624:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800629:	8b 55 08             	mov    0x8(%ebp),%edx
+  80062c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80062f:	b8 06 00 00 00       	mov    $0x6,%eax
+  800634:	89 df                	mov    %ebx,%edi
+  800636:	55                   	push   %ebp
+  800637:	89 e5                	mov    %esp,%ebp
+  800639:	8d 35 41 06 80 00    	lea    0x800641,%esi
+  80063f:	0f 34                	sysenter
+  800641:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800642:	85 c0                	test   %eax,%eax
+  800644:	7f 08                	jg     80064e <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800646:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800649:	5b                   	pop    %ebx
+  80064a:	5e                   	pop    %esi
+  80064b:	5f                   	pop    %edi
+  80064c:	5d                   	pop    %ebp
+  80064d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80064e:	83 ec 0c             	sub    $0xc,%esp
+  800651:	50                   	push   %eax
+  800652:	6a 06                	push   $0x6
+  800654:	68 0f 38 80 00       	push   $0x80380f
+  800659:	6a 3d                	push   $0x3d
+  80065b:	68 2c 38 80 00       	push   $0x80382c
+  800660:	e8 e5 22 00 00       	call   80294a <_panic>
+
+00800665 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800665:	55                   	push   %ebp
+  800666:	89 e5                	mov    %esp,%ebp
+  800668:	57                   	push   %edi
+  800669:	56                   	push   %esi
+  80066a:	53                   	push   %ebx
+  80066b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80066e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800673:	8b 55 08             	mov    0x8(%ebp),%edx
+  800676:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800679:	b8 08 00 00 00       	mov    $0x8,%eax
+  80067e:	89 df                	mov    %ebx,%edi
+  800680:	55                   	push   %ebp
+  800681:	89 e5                	mov    %esp,%ebp
+  800683:	8d 35 8b 06 80 00    	lea    0x80068b,%esi
+  800689:	0f 34                	sysenter
+  80068b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80068c:	85 c0                	test   %eax,%eax
+  80068e:	7f 08                	jg     800698 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800690:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800693:	5b                   	pop    %ebx
+  800694:	5e                   	pop    %esi
+  800695:	5f                   	pop    %edi
+  800696:	5d                   	pop    %ebp
+  800697:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800698:	83 ec 0c             	sub    $0xc,%esp
+  80069b:	50                   	push   %eax
+  80069c:	6a 08                	push   $0x8
+  80069e:	68 0f 38 80 00       	push   $0x80380f
+  8006a3:	6a 3d                	push   $0x3d
+  8006a5:	68 2c 38 80 00       	push   $0x80382c
+  8006aa:	e8 9b 22 00 00       	call   80294a <_panic>
+
+008006af <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8006af:	55                   	push   %ebp
+  8006b0:	89 e5                	mov    %esp,%ebp
+  8006b2:	57                   	push   %edi
+  8006b3:	56                   	push   %esi
+  8006b4:	53                   	push   %ebx
+  8006b5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8006b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006c3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8006c8:	89 df                	mov    %ebx,%edi
+  8006ca:	55                   	push   %ebp
+  8006cb:	89 e5                	mov    %esp,%ebp
+  8006cd:	8d 35 d5 06 80 00    	lea    0x8006d5,%esi
+  8006d3:	0f 34                	sysenter
+  8006d5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8006d6:	85 c0                	test   %eax,%eax
+  8006d8:	7f 08                	jg     8006e2 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  8006da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006dd:	5b                   	pop    %ebx
+  8006de:	5e                   	pop    %esi
+  8006df:	5f                   	pop    %edi
+  8006e0:	5d                   	pop    %ebp
+  8006e1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006e2:	83 ec 0c             	sub    $0xc,%esp
+  8006e5:	50                   	push   %eax
+  8006e6:	6a 09                	push   $0x9
+  8006e8:	68 0f 38 80 00       	push   $0x80380f
+  8006ed:	6a 3d                	push   $0x3d
+  8006ef:	68 2c 38 80 00       	push   $0x80382c
+  8006f4:	e8 51 22 00 00       	call   80294a <_panic>
+
+008006f9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8006f9:	55                   	push   %ebp
+  8006fa:	89 e5                	mov    %esp,%ebp
+  8006fc:	57                   	push   %edi
+  8006fd:	56                   	push   %esi
+  8006fe:	53                   	push   %ebx
+  8006ff:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800702:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800707:	8b 55 08             	mov    0x8(%ebp),%edx
+  80070a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80070d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800712:	89 df                	mov    %ebx,%edi
+  800714:	55                   	push   %ebp
+  800715:	89 e5                	mov    %esp,%ebp
+  800717:	8d 35 1f 07 80 00    	lea    0x80071f,%esi
+  80071d:	0f 34                	sysenter
+  80071f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800720:	85 c0                	test   %eax,%eax
+  800722:	7f 08                	jg     80072c <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800724:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800727:	5b                   	pop    %ebx
+  800728:	5e                   	pop    %esi
+  800729:	5f                   	pop    %edi
+  80072a:	5d                   	pop    %ebp
+  80072b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80072c:	83 ec 0c             	sub    $0xc,%esp
+  80072f:	50                   	push   %eax
+  800730:	6a 0a                	push   $0xa
+  800732:	68 0f 38 80 00       	push   $0x80380f
+  800737:	6a 3d                	push   $0x3d
+  800739:	68 2c 38 80 00       	push   $0x80382c
+  80073e:	e8 07 22 00 00       	call   80294a <_panic>
+
+00800743 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800743:	55                   	push   %ebp
+  800744:	89 e5                	mov    %esp,%ebp
+  800746:	57                   	push   %edi
+  800747:	56                   	push   %esi
+  800748:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800749:	8b 55 08             	mov    0x8(%ebp),%edx
+  80074c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80074f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800754:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800757:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80075a:	55                   	push   %ebp
+  80075b:	89 e5                	mov    %esp,%ebp
+  80075d:	8d 35 65 07 80 00    	lea    0x800765,%esi
+  800763:	0f 34                	sysenter
+  800765:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800766:	5b                   	pop    %ebx
+  800767:	5e                   	pop    %esi
+  800768:	5f                   	pop    %edi
+  800769:	5d                   	pop    %ebp
+  80076a:	c3                   	ret
+
+0080076b <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  80076b:	55                   	push   %ebp
+  80076c:	89 e5                	mov    %esp,%ebp
+  80076e:	57                   	push   %edi
+  80076f:	56                   	push   %esi
+  800770:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800771:	8b 55 08             	mov    0x8(%ebp),%edx
+  800774:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800777:	b8 17 00 00 00       	mov    $0x17,%eax
+  80077c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80077f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800782:	55                   	push   %ebp
+  800783:	89 e5                	mov    %esp,%ebp
+  800785:	8d 35 8d 07 80 00    	lea    0x80078d,%esi
+  80078b:	0f 34                	sysenter
+  80078d:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  80078e:	5b                   	pop    %ebx
+  80078f:	5e                   	pop    %esi
+  800790:	5f                   	pop    %edi
+  800791:	5d                   	pop    %ebp
+  800792:	c3                   	ret
+
+00800793 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800793:	55                   	push   %ebp
+  800794:	89 e5                	mov    %esp,%ebp
+  800796:	57                   	push   %edi
+  800797:	56                   	push   %esi
+  800798:	53                   	push   %ebx
+  800799:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80079c:	be 00 00 00 00       	mov    $0x0,%esi
+  8007a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007a7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8007ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8007af:	89 f7                	mov    %esi,%edi
+  8007b1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8007b3:	85 c0                	test   %eax,%eax
+  8007b5:	7f 08                	jg     8007bf <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8007b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ba:	5b                   	pop    %ebx
+  8007bb:	5e                   	pop    %esi
+  8007bc:	5f                   	pop    %edi
+  8007bd:	5d                   	pop    %ebp
+  8007be:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007bf:	83 ec 0c             	sub    $0xc,%esp
+  8007c2:	50                   	push   %eax
+  8007c3:	6a 0d                	push   $0xd
+  8007c5:	68 0f 38 80 00       	push   $0x80380f
+  8007ca:	6a 23                	push   $0x23
+  8007cc:	68 2c 38 80 00       	push   $0x80382c
+  8007d1:	e8 74 21 00 00       	call   80294a <_panic>
+
+008007d6 <sys_ipc_recv>:
+{
+  8007d6:	55                   	push   %ebp
+  8007d7:	89 e5                	mov    %esp,%ebp
+  8007d9:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  8007dc:	6a 00                	push   $0x0
+  8007de:	6a 01                	push   $0x1
+  8007e0:	ff 75 08             	push   0x8(%ebp)
+  8007e3:	e8 ab ff ff ff       	call   800793 <sys_ipc_recvv>
+}
+  8007e8:	c9                   	leave
+  8007e9:	c3                   	ret
+
+008007ea <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  8007ea:	55                   	push   %ebp
+  8007eb:	89 e5                	mov    %esp,%ebp
+  8007ed:	57                   	push   %edi
+  8007ee:	56                   	push   %esi
+  8007ef:	53                   	push   %ebx
+  8007f0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8007f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007fe:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800803:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800806:	89 de                	mov    %ebx,%esi
+  800808:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80080a:	85 c0                	test   %eax,%eax
+  80080c:	7f 08                	jg     800816 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  80080e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800811:	5b                   	pop    %ebx
+  800812:	5e                   	pop    %esi
+  800813:	5f                   	pop    %edi
+  800814:	5d                   	pop    %ebp
+  800815:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800816:	83 ec 0c             	sub    $0xc,%esp
+  800819:	50                   	push   %eax
+  80081a:	6a 0d                	push   $0xd
+  80081c:	68 0f 38 80 00       	push   $0x80380f
+  800821:	6a 23                	push   $0x23
+  800823:	68 2c 38 80 00       	push   $0x80382c
+  800828:	e8 1d 21 00 00       	call   80294a <_panic>
+
+0080082d <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80082d:	55                   	push   %ebp
+  80082e:	89 e5                	mov    %esp,%ebp
+  800830:	57                   	push   %edi
+  800831:	56                   	push   %esi
+  800832:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800833:	ba 00 00 00 00       	mov    $0x0,%edx
+  800838:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80083d:	89 d1                	mov    %edx,%ecx
+  80083f:	89 d3                	mov    %edx,%ebx
+  800841:	89 d7                	mov    %edx,%edi
+  800843:	55                   	push   %ebp
+  800844:	89 e5                	mov    %esp,%ebp
+  800846:	8d 35 4e 08 80 00    	lea    0x80084e,%esi
+  80084c:	0f 34                	sysenter
+  80084e:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  80084f:	5b                   	pop    %ebx
+  800850:	5e                   	pop    %esi
+  800851:	5f                   	pop    %edi
+  800852:	5d                   	pop    %ebp
+  800853:	c3                   	ret
+
+00800854 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	57                   	push   %edi
+  800858:	56                   	push   %esi
+  800859:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80085a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80085f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800862:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800865:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80086a:	89 df                	mov    %ebx,%edi
+  80086c:	55                   	push   %ebp
+  80086d:	89 e5                	mov    %esp,%ebp
+  80086f:	8d 35 77 08 80 00    	lea    0x800877,%esi
+  800875:	0f 34                	sysenter
+  800877:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800878:	5b                   	pop    %ebx
+  800879:	5e                   	pop    %esi
+  80087a:	5f                   	pop    %edi
+  80087b:	5d                   	pop    %ebp
+  80087c:	c3                   	ret
+
+0080087d <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  80087d:	55                   	push   %ebp
+  80087e:	89 e5                	mov    %esp,%ebp
+  800880:	57                   	push   %edi
+  800881:	56                   	push   %esi
+  800882:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800883:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800888:	8b 55 08             	mov    0x8(%ebp),%edx
+  80088b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800890:	89 cb                	mov    %ecx,%ebx
+  800892:	89 cf                	mov    %ecx,%edi
+  800894:	55                   	push   %ebp
+  800895:	89 e5                	mov    %esp,%ebp
+  800897:	8d 35 9f 08 80 00    	lea    0x80089f,%esi
+  80089d:	0f 34                	sysenter
+  80089f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  8008a0:	5b                   	pop    %ebx
+  8008a1:	5e                   	pop    %esi
+  8008a2:	5f                   	pop    %edi
+  8008a3:	5d                   	pop    %ebp
+  8008a4:	c3                   	ret
+
+008008a5 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  8008a5:	55                   	push   %ebp
+  8008a6:	89 e5                	mov    %esp,%ebp
+  8008a8:	57                   	push   %edi
+  8008a9:	56                   	push   %esi
+  8008aa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8008ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008b6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8008bb:	89 df                	mov    %ebx,%edi
+  8008bd:	55                   	push   %ebp
+  8008be:	89 e5                	mov    %esp,%ebp
+  8008c0:	8d 35 c8 08 80 00    	lea    0x8008c8,%esi
+  8008c6:	0f 34                	sysenter
+  8008c8:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8008c9:	5b                   	pop    %ebx
+  8008ca:	5e                   	pop    %esi
+  8008cb:	5f                   	pop    %edi
+  8008cc:	5d                   	pop    %ebp
+  8008cd:	c3                   	ret
+
+008008ce <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8008ce:	55                   	push   %ebp
+  8008cf:	89 e5                	mov    %esp,%ebp
+  8008d1:	57                   	push   %edi
+  8008d2:	56                   	push   %esi
+  8008d3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8008d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008df:	b8 14 00 00 00       	mov    $0x14,%eax
+  8008e4:	89 df                	mov    %ebx,%edi
+  8008e6:	55                   	push   %ebp
+  8008e7:	89 e5                	mov    %esp,%ebp
+  8008e9:	8d 35 f1 08 80 00    	lea    0x8008f1,%esi
+  8008ef:	0f 34                	sysenter
+  8008f1:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  8008f2:	5b                   	pop    %ebx
+  8008f3:	5e                   	pop    %esi
+  8008f4:	5f                   	pop    %edi
+  8008f5:	5d                   	pop    %ebp
+  8008f6:	c3                   	ret
+
+008008f7 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  8008f7:	55                   	push   %ebp
+  8008f8:	89 e5                	mov    %esp,%ebp
+  8008fa:	57                   	push   %edi
+  8008fb:	56                   	push   %esi
+  8008fc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8008fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800900:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800903:	b8 13 00 00 00       	mov    $0x13,%eax
+  800908:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80090b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80090e:	55                   	push   %ebp
+  80090f:	89 e5                	mov    %esp,%ebp
+  800911:	8d 35 19 09 80 00    	lea    0x800919,%esi
+  800917:	0f 34                	sysenter
+  800919:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  80091a:	5b                   	pop    %ebx
+  80091b:	5e                   	pop    %esi
+  80091c:	5f                   	pop    %edi
+  80091d:	5d                   	pop    %ebp
+  80091e:	c3                   	ret
+
+0080091f <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  80091f:	55                   	push   %ebp
+  800920:	89 e5                	mov    %esp,%ebp
+  800922:	57                   	push   %edi
+  800923:	56                   	push   %esi
+  800924:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800925:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80092a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80092d:	b8 11 00 00 00       	mov    $0x11,%eax
+  800932:	89 cb                	mov    %ecx,%ebx
+  800934:	89 cf                	mov    %ecx,%edi
+  800936:	89 ce                	mov    %ecx,%esi
+  800938:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  80093a:	5b                   	pop    %ebx
+  80093b:	5e                   	pop    %esi
+  80093c:	5f                   	pop    %edi
+  80093d:	5d                   	pop    %ebp
+  80093e:	c3                   	ret
+
+0080093f <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	57                   	push   %edi
+  800943:	56                   	push   %esi
+  800944:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800945:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80094d:	b8 15 00 00 00       	mov    $0x15,%eax
+  800952:	89 cb                	mov    %ecx,%ebx
+  800954:	89 cf                	mov    %ecx,%edi
+  800956:	55                   	push   %ebp
+  800957:	89 e5                	mov    %esp,%ebp
+  800959:	8d 35 61 09 80 00    	lea    0x800961,%esi
+  80095f:	0f 34                	sysenter
+  800961:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800962:	5b                   	pop    %ebx
+  800963:	5e                   	pop    %esi
+  800964:	5f                   	pop    %edi
+  800965:	5d                   	pop    %ebp
+  800966:	c3                   	ret
+
+00800967 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800967:	55                   	push   %ebp
+  800968:	89 e5                	mov    %esp,%ebp
+  80096a:	57                   	push   %edi
+  80096b:	56                   	push   %esi
+  80096c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80096d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800972:	8b 55 08             	mov    0x8(%ebp),%edx
+  800975:	b8 16 00 00 00       	mov    $0x16,%eax
+  80097a:	89 cb                	mov    %ecx,%ebx
+  80097c:	89 cf                	mov    %ecx,%edi
+  80097e:	55                   	push   %ebp
+  80097f:	89 e5                	mov    %esp,%ebp
+  800981:	8d 35 89 09 80 00    	lea    0x800989,%esi
+  800987:	0f 34                	sysenter
+  800989:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  80098a:	5b                   	pop    %ebx
+  80098b:	5e                   	pop    %esi
+  80098c:	5f                   	pop    %edi
+  80098d:	5d                   	pop    %ebp
+  80098e:	c3                   	ret
+
+0080098f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80098f:	55                   	push   %ebp
+  800990:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800992:	8b 45 08             	mov    0x8(%ebp),%eax
+  800995:	05 00 00 00 30       	add    $0x30000000,%eax
+  80099a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80099d:	5d                   	pop    %ebp
+  80099e:	c3                   	ret
+
+0080099f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80099f:	55                   	push   %ebp
+  8009a0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8009a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a5:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8009aa:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8009af:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8009b4:	5d                   	pop    %ebp
+  8009b5:	c3                   	ret
+
+008009b6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8009b6:	55                   	push   %ebp
+  8009b7:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8009b9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8009be:	eb 02                	jmp    8009c2 <fd_alloc+0xc>
+  8009c0:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8009c2:	89 c2                	mov    %eax,%edx
+  8009c4:	c1 ea 16             	shr    $0x16,%edx
+  8009c7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8009ce:	f6 c2 01             	test   $0x1,%dl
+  8009d1:	74 2b                	je     8009fe <fd_alloc+0x48>
+  8009d3:	89 c2                	mov    %eax,%edx
+  8009d5:	c1 ea 0c             	shr    $0xc,%edx
+  8009d8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8009df:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8009e5:	f6 c1 01             	test   $0x1,%cl
+  8009e8:	74 14                	je     8009fe <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8009ea:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8009f0:	75 ce                	jne    8009c0 <fd_alloc+0xa>
+  8009f2:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8009f7:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8009fc:	eb 05                	jmp    800a03 <fd_alloc+0x4d>
+			return 0;
+  8009fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800a03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a06:	89 02                	mov    %eax,(%edx)
+}
+  800a08:	89 c8                	mov    %ecx,%eax
+  800a0a:	5d                   	pop    %ebp
+  800a0b:	c3                   	ret
+
+00800a0c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800a0c:	55                   	push   %ebp
+  800a0d:	89 e5                	mov    %esp,%ebp
+  800a0f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800a12:	83 f8 1f             	cmp    $0x1f,%eax
+  800a15:	77 30                	ja     800a47 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800a17:	c1 e0 0c             	shl    $0xc,%eax
+  800a1a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800a1f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800a25:	f6 c2 01             	test   $0x1,%dl
+  800a28:	74 24                	je     800a4e <fd_lookup+0x42>
+  800a2a:	89 c2                	mov    %eax,%edx
+  800a2c:	c1 ea 0c             	shr    $0xc,%edx
+  800a2f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800a36:	f6 c2 01             	test   $0x1,%dl
+  800a39:	74 1a                	je     800a55 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800a3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a3e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800a40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a45:	5d                   	pop    %ebp
+  800a46:	c3                   	ret
+		return -E_INVAL;
+  800a47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a4c:	eb f7                	jmp    800a45 <fd_lookup+0x39>
+		return -E_INVAL;
+  800a4e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a53:	eb f0                	jmp    800a45 <fd_lookup+0x39>
+  800a55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a5a:	eb e9                	jmp    800a45 <fd_lookup+0x39>
+
+00800a5c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800a5c:	55                   	push   %ebp
+  800a5d:	89 e5                	mov    %esp,%ebp
+  800a5f:	53                   	push   %ebx
+  800a60:	83 ec 04             	sub    $0x4,%esp
+  800a63:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800a66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6b:	eb 03                	jmp    800a70 <dev_lookup+0x14>
+  800a6d:	83 c0 01             	add    $0x1,%eax
+  800a70:	8b 1c 85 b8 38 80 00 	mov    0x8038b8(,%eax,4),%ebx
+  800a77:	85 db                	test   %ebx,%ebx
+  800a79:	74 0b                	je     800a86 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800a7b:	39 13                	cmp    %edx,(%ebx)
+  800a7d:	75 ee                	jne    800a6d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a84:	eb 1f                	jmp    800aa5 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800a86:	a1 00 50 80 00       	mov    0x805000,%eax
+  800a8b:	8b 40 48             	mov    0x48(%eax),%eax
+  800a8e:	83 ec 04             	sub    $0x4,%esp
+  800a91:	52                   	push   %edx
+  800a92:	50                   	push   %eax
+  800a93:	68 3c 38 80 00       	push   $0x80383c
+  800a98:	e8 88 1f 00 00       	call   802a25 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800a9d:	83 c4 10             	add    $0x10,%esp
+  800aa0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800aa5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aa8:	89 1a                	mov    %ebx,(%edx)
+}
+  800aaa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aad:	c9                   	leave
+  800aae:	c3                   	ret
+
+00800aaf <fd_close>:
+{
+  800aaf:	55                   	push   %ebp
+  800ab0:	89 e5                	mov    %esp,%ebp
+  800ab2:	57                   	push   %edi
+  800ab3:	56                   	push   %esi
+  800ab4:	53                   	push   %ebx
+  800ab5:	83 ec 24             	sub    $0x24,%esp
+  800ab8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800abb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800abe:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800ac1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800ac2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800ac8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800acb:	50                   	push   %eax
+  800acc:	e8 3b ff ff ff       	call   800a0c <fd_lookup>
+  800ad1:	89 c3                	mov    %eax,%ebx
+  800ad3:	83 c4 10             	add    $0x10,%esp
+  800ad6:	85 c0                	test   %eax,%eax
+  800ad8:	78 05                	js     800adf <fd_close+0x30>
+	    || fd != fd2)
+  800ada:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800add:	74 16                	je     800af5 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  800adf:	89 f8                	mov    %edi,%eax
+  800ae1:	84 c0                	test   %al,%al
+  800ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800aeb:	89 d8                	mov    %ebx,%eax
+  800aed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800af0:	5b                   	pop    %ebx
+  800af1:	5e                   	pop    %esi
+  800af2:	5f                   	pop    %edi
+  800af3:	5d                   	pop    %ebp
+  800af4:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800af5:	83 ec 08             	sub    $0x8,%esp
+  800af8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800afb:	50                   	push   %eax
+  800afc:	ff 36                	push   (%esi)
+  800afe:	e8 59 ff ff ff       	call   800a5c <dev_lookup>
+  800b03:	89 c3                	mov    %eax,%ebx
+  800b05:	83 c4 10             	add    $0x10,%esp
+  800b08:	85 c0                	test   %eax,%eax
+  800b0a:	78 1a                	js     800b26 <fd_close+0x77>
+		if (dev->dev_close)
+  800b0c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b0f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800b12:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800b17:	85 c0                	test   %eax,%eax
+  800b19:	74 0b                	je     800b26 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800b1b:	83 ec 0c             	sub    $0xc,%esp
+  800b1e:	56                   	push   %esi
+  800b1f:	ff d0                	call   *%eax
+  800b21:	89 c3                	mov    %eax,%ebx
+  800b23:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800b26:	83 ec 08             	sub    $0x8,%esp
+  800b29:	56                   	push   %esi
+  800b2a:	6a 00                	push   $0x0
+  800b2c:	e8 ea fa ff ff       	call   80061b <sys_page_unmap>
+	return r;
+  800b31:	83 c4 10             	add    $0x10,%esp
+  800b34:	eb b5                	jmp    800aeb <fd_close+0x3c>
+
+00800b36 <close>:
+
+int
+close(int fdnum)
+{
+  800b36:	55                   	push   %ebp
+  800b37:	89 e5                	mov    %esp,%ebp
+  800b39:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b3c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b3f:	50                   	push   %eax
+  800b40:	ff 75 08             	push   0x8(%ebp)
+  800b43:	e8 c4 fe ff ff       	call   800a0c <fd_lookup>
+  800b48:	83 c4 10             	add    $0x10,%esp
+  800b4b:	85 c0                	test   %eax,%eax
+  800b4d:	79 02                	jns    800b51 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800b4f:	c9                   	leave
+  800b50:	c3                   	ret
+		return fd_close(fd, 1);
+  800b51:	83 ec 08             	sub    $0x8,%esp
+  800b54:	6a 01                	push   $0x1
+  800b56:	ff 75 f4             	push   -0xc(%ebp)
+  800b59:	e8 51 ff ff ff       	call   800aaf <fd_close>
+  800b5e:	83 c4 10             	add    $0x10,%esp
+  800b61:	eb ec                	jmp    800b4f <close+0x19>
+
+00800b63 <close_all>:
+
+void
+close_all(void)
+{
+  800b63:	55                   	push   %ebp
+  800b64:	89 e5                	mov    %esp,%ebp
+  800b66:	53                   	push   %ebx
+  800b67:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800b6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800b6f:	83 ec 0c             	sub    $0xc,%esp
+  800b72:	53                   	push   %ebx
+  800b73:	e8 be ff ff ff       	call   800b36 <close>
+	for (i = 0; i < MAXFD; i++)
+  800b78:	83 c3 01             	add    $0x1,%ebx
+  800b7b:	83 c4 10             	add    $0x10,%esp
+  800b7e:	83 fb 20             	cmp    $0x20,%ebx
+  800b81:	75 ec                	jne    800b6f <close_all+0xc>
+}
+  800b83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b86:	c9                   	leave
+  800b87:	c3                   	ret
+
+00800b88 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800b88:	55                   	push   %ebp
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	57                   	push   %edi
+  800b8c:	56                   	push   %esi
+  800b8d:	53                   	push   %ebx
+  800b8e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800b91:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800b94:	50                   	push   %eax
+  800b95:	ff 75 08             	push   0x8(%ebp)
+  800b98:	e8 6f fe ff ff       	call   800a0c <fd_lookup>
+  800b9d:	89 c3                	mov    %eax,%ebx
+  800b9f:	83 c4 10             	add    $0x10,%esp
+  800ba2:	85 c0                	test   %eax,%eax
+  800ba4:	78 7f                	js     800c25 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800ba6:	83 ec 0c             	sub    $0xc,%esp
+  800ba9:	ff 75 0c             	push   0xc(%ebp)
+  800bac:	e8 85 ff ff ff       	call   800b36 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800bb1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bb4:	c1 e6 0c             	shl    $0xc,%esi
+  800bb7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800bbd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800bc0:	89 3c 24             	mov    %edi,(%esp)
+  800bc3:	e8 d7 fd ff ff       	call   80099f <fd2data>
+  800bc8:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800bca:	89 34 24             	mov    %esi,(%esp)
+  800bcd:	e8 cd fd ff ff       	call   80099f <fd2data>
+  800bd2:	83 c4 10             	add    $0x10,%esp
+  800bd5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800bd8:	89 d8                	mov    %ebx,%eax
+  800bda:	c1 e8 16             	shr    $0x16,%eax
+  800bdd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800be4:	a8 01                	test   $0x1,%al
+  800be6:	74 11                	je     800bf9 <dup+0x71>
+  800be8:	89 d8                	mov    %ebx,%eax
+  800bea:	c1 e8 0c             	shr    $0xc,%eax
+  800bed:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800bf4:	f6 c2 01             	test   $0x1,%dl
+  800bf7:	75 36                	jne    800c2f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800bf9:	89 f8                	mov    %edi,%eax
+  800bfb:	c1 e8 0c             	shr    $0xc,%eax
+  800bfe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800c05:	83 ec 0c             	sub    $0xc,%esp
+  800c08:	25 07 0e 00 00       	and    $0xe07,%eax
+  800c0d:	50                   	push   %eax
+  800c0e:	56                   	push   %esi
+  800c0f:	6a 00                	push   $0x0
+  800c11:	57                   	push   %edi
+  800c12:	6a 00                	push   $0x0
+  800c14:	e8 c0 f9 ff ff       	call   8005d9 <sys_page_map>
+  800c19:	89 c3                	mov    %eax,%ebx
+  800c1b:	83 c4 20             	add    $0x20,%esp
+  800c1e:	85 c0                	test   %eax,%eax
+  800c20:	78 33                	js     800c55 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800c22:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800c25:	89 d8                	mov    %ebx,%eax
+  800c27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2a:	5b                   	pop    %ebx
+  800c2b:	5e                   	pop    %esi
+  800c2c:	5f                   	pop    %edi
+  800c2d:	5d                   	pop    %ebp
+  800c2e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800c2f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800c36:	83 ec 0c             	sub    $0xc,%esp
+  800c39:	25 07 0e 00 00       	and    $0xe07,%eax
+  800c3e:	50                   	push   %eax
+  800c3f:	ff 75 d4             	push   -0x2c(%ebp)
+  800c42:	6a 00                	push   $0x0
+  800c44:	53                   	push   %ebx
+  800c45:	6a 00                	push   $0x0
+  800c47:	e8 8d f9 ff ff       	call   8005d9 <sys_page_map>
+  800c4c:	89 c3                	mov    %eax,%ebx
+  800c4e:	83 c4 20             	add    $0x20,%esp
+  800c51:	85 c0                	test   %eax,%eax
+  800c53:	79 a4                	jns    800bf9 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800c55:	83 ec 08             	sub    $0x8,%esp
+  800c58:	56                   	push   %esi
+  800c59:	6a 00                	push   $0x0
+  800c5b:	e8 bb f9 ff ff       	call   80061b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800c60:	83 c4 08             	add    $0x8,%esp
+  800c63:	ff 75 d4             	push   -0x2c(%ebp)
+  800c66:	6a 00                	push   $0x0
+  800c68:	e8 ae f9 ff ff       	call   80061b <sys_page_unmap>
+	return r;
+  800c6d:	83 c4 10             	add    $0x10,%esp
+  800c70:	eb b3                	jmp    800c25 <dup+0x9d>
+
+00800c72 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800c72:	55                   	push   %ebp
+  800c73:	89 e5                	mov    %esp,%ebp
+  800c75:	56                   	push   %esi
+  800c76:	53                   	push   %ebx
+  800c77:	83 ec 18             	sub    $0x18,%esp
+  800c7a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800c7d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800c80:	50                   	push   %eax
+  800c81:	56                   	push   %esi
+  800c82:	e8 85 fd ff ff       	call   800a0c <fd_lookup>
+  800c87:	83 c4 10             	add    $0x10,%esp
+  800c8a:	85 c0                	test   %eax,%eax
+  800c8c:	78 3c                	js     800cca <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800c8e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800c91:	83 ec 08             	sub    $0x8,%esp
+  800c94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c97:	50                   	push   %eax
+  800c98:	ff 33                	push   (%ebx)
+  800c9a:	e8 bd fd ff ff       	call   800a5c <dev_lookup>
+  800c9f:	83 c4 10             	add    $0x10,%esp
+  800ca2:	85 c0                	test   %eax,%eax
+  800ca4:	78 24                	js     800cca <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800ca6:	8b 43 08             	mov    0x8(%ebx),%eax
+  800ca9:	83 e0 03             	and    $0x3,%eax
+  800cac:	83 f8 01             	cmp    $0x1,%eax
+  800caf:	74 20                	je     800cd1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800cb1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cb4:	8b 40 08             	mov    0x8(%eax),%eax
+  800cb7:	85 c0                	test   %eax,%eax
+  800cb9:	74 37                	je     800cf2 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800cbb:	83 ec 04             	sub    $0x4,%esp
+  800cbe:	ff 75 10             	push   0x10(%ebp)
+  800cc1:	ff 75 0c             	push   0xc(%ebp)
+  800cc4:	53                   	push   %ebx
+  800cc5:	ff d0                	call   *%eax
+  800cc7:	83 c4 10             	add    $0x10,%esp
+}
+  800cca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ccd:	5b                   	pop    %ebx
+  800cce:	5e                   	pop    %esi
+  800ccf:	5d                   	pop    %ebp
+  800cd0:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800cd1:	a1 00 50 80 00       	mov    0x805000,%eax
+  800cd6:	8b 40 48             	mov    0x48(%eax),%eax
+  800cd9:	83 ec 04             	sub    $0x4,%esp
+  800cdc:	56                   	push   %esi
+  800cdd:	50                   	push   %eax
+  800cde:	68 7d 38 80 00       	push   $0x80387d
+  800ce3:	e8 3d 1d 00 00       	call   802a25 <cprintf>
+		return -E_INVAL;
+  800ce8:	83 c4 10             	add    $0x10,%esp
+  800ceb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cf0:	eb d8                	jmp    800cca <read+0x58>
+		return -E_NOT_SUPP;
+  800cf2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800cf7:	eb d1                	jmp    800cca <read+0x58>
+
+00800cf9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800cf9:	55                   	push   %ebp
+  800cfa:	89 e5                	mov    %esp,%ebp
+  800cfc:	57                   	push   %edi
+  800cfd:	56                   	push   %esi
+  800cfe:	53                   	push   %ebx
+  800cff:	83 ec 0c             	sub    $0xc,%esp
+  800d02:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d05:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800d08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d0d:	eb 02                	jmp    800d11 <readn+0x18>
+  800d0f:	01 c3                	add    %eax,%ebx
+  800d11:	39 f3                	cmp    %esi,%ebx
+  800d13:	73 21                	jae    800d36 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800d15:	83 ec 04             	sub    $0x4,%esp
+  800d18:	89 f0                	mov    %esi,%eax
+  800d1a:	29 d8                	sub    %ebx,%eax
+  800d1c:	50                   	push   %eax
+  800d1d:	89 d8                	mov    %ebx,%eax
+  800d1f:	03 45 0c             	add    0xc(%ebp),%eax
+  800d22:	50                   	push   %eax
+  800d23:	57                   	push   %edi
+  800d24:	e8 49 ff ff ff       	call   800c72 <read>
+		if (m < 0)
+  800d29:	83 c4 10             	add    $0x10,%esp
+  800d2c:	85 c0                	test   %eax,%eax
+  800d2e:	78 04                	js     800d34 <readn+0x3b>
+			return m;
+		if (m == 0)
+  800d30:	75 dd                	jne    800d0f <readn+0x16>
+  800d32:	eb 02                	jmp    800d36 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800d34:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800d36:	89 d8                	mov    %ebx,%eax
+  800d38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3b:	5b                   	pop    %ebx
+  800d3c:	5e                   	pop    %esi
+  800d3d:	5f                   	pop    %edi
+  800d3e:	5d                   	pop    %ebp
+  800d3f:	c3                   	ret
+
+00800d40 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800d40:	55                   	push   %ebp
+  800d41:	89 e5                	mov    %esp,%ebp
+  800d43:	56                   	push   %esi
+  800d44:	53                   	push   %ebx
+  800d45:	83 ec 18             	sub    $0x18,%esp
+  800d48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800d4b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800d4e:	50                   	push   %eax
+  800d4f:	53                   	push   %ebx
+  800d50:	e8 b7 fc ff ff       	call   800a0c <fd_lookup>
+  800d55:	83 c4 10             	add    $0x10,%esp
+  800d58:	85 c0                	test   %eax,%eax
+  800d5a:	78 37                	js     800d93 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800d5c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800d5f:	83 ec 08             	sub    $0x8,%esp
+  800d62:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d65:	50                   	push   %eax
+  800d66:	ff 36                	push   (%esi)
+  800d68:	e8 ef fc ff ff       	call   800a5c <dev_lookup>
+  800d6d:	83 c4 10             	add    $0x10,%esp
+  800d70:	85 c0                	test   %eax,%eax
+  800d72:	78 1f                	js     800d93 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d74:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800d78:	74 20                	je     800d9a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800d7a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d7d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d80:	85 c0                	test   %eax,%eax
+  800d82:	74 37                	je     800dbb <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800d84:	83 ec 04             	sub    $0x4,%esp
+  800d87:	ff 75 10             	push   0x10(%ebp)
+  800d8a:	ff 75 0c             	push   0xc(%ebp)
+  800d8d:	56                   	push   %esi
+  800d8e:	ff d0                	call   *%eax
+  800d90:	83 c4 10             	add    $0x10,%esp
+}
+  800d93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d96:	5b                   	pop    %ebx
+  800d97:	5e                   	pop    %esi
+  800d98:	5d                   	pop    %ebp
+  800d99:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800d9a:	a1 00 50 80 00       	mov    0x805000,%eax
+  800d9f:	8b 40 48             	mov    0x48(%eax),%eax
+  800da2:	83 ec 04             	sub    $0x4,%esp
+  800da5:	53                   	push   %ebx
+  800da6:	50                   	push   %eax
+  800da7:	68 99 38 80 00       	push   $0x803899
+  800dac:	e8 74 1c 00 00       	call   802a25 <cprintf>
+		return -E_INVAL;
+  800db1:	83 c4 10             	add    $0x10,%esp
+  800db4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800db9:	eb d8                	jmp    800d93 <write+0x53>
+		return -E_NOT_SUPP;
+  800dbb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800dc0:	eb d1                	jmp    800d93 <write+0x53>
+
+00800dc2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800dc2:	55                   	push   %ebp
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	53                   	push   %ebx
+  800dc6:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800dc9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800dcc:	50                   	push   %eax
+  800dcd:	ff 75 08             	push   0x8(%ebp)
+  800dd0:	e8 37 fc ff ff       	call   800a0c <fd_lookup>
+  800dd5:	83 c4 10             	add    $0x10,%esp
+  800dd8:	85 c0                	test   %eax,%eax
+  800dda:	78 3a                	js     800e16 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800ddc:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800ddf:	83 ec 08             	sub    $0x8,%esp
+  800de2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800de5:	50                   	push   %eax
+  800de6:	ff 33                	push   (%ebx)
+  800de8:	e8 6f fc ff ff       	call   800a5c <dev_lookup>
+  800ded:	83 c4 10             	add    $0x10,%esp
+  800df0:	85 c0                	test   %eax,%eax
+  800df2:	78 22                	js     800e16 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  800df4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800df7:	8b 40 1c             	mov    0x1c(%eax),%eax
+  800dfa:	85 c0                	test   %eax,%eax
+  800dfc:	74 0d                	je     800e0b <seek+0x49>
+  800dfe:	83 ec 0c             	sub    $0xc,%esp
+  800e01:	53                   	push   %ebx
+  800e02:	ff d0                	call   *%eax
+  800e04:	83 c4 10             	add    $0x10,%esp
+  800e07:	85 c0                	test   %eax,%eax
+  800e09:	78 0b                	js     800e16 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  800e0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e0e:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  800e11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e19:	c9                   	leave
+  800e1a:	c3                   	ret
+
+00800e1b <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  800e1b:	55                   	push   %ebp
+  800e1c:	89 e5                	mov    %esp,%ebp
+  800e1e:	53                   	push   %ebx
+  800e1f:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800e22:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800e25:	50                   	push   %eax
+  800e26:	ff 75 08             	push   0x8(%ebp)
+  800e29:	e8 de fb ff ff       	call   800a0c <fd_lookup>
+  800e2e:	83 c4 10             	add    $0x10,%esp
+  800e31:	85 c0                	test   %eax,%eax
+  800e33:	78 2b                	js     800e60 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800e35:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800e38:	83 ec 08             	sub    $0x8,%esp
+  800e3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e3e:	50                   	push   %eax
+  800e3f:	ff 33                	push   (%ebx)
+  800e41:	e8 16 fc ff ff       	call   800a5c <dev_lookup>
+  800e46:	83 c4 10             	add    $0x10,%esp
+  800e49:	85 c0                	test   %eax,%eax
+  800e4b:	78 13                	js     800e60 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  800e4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e50:	8b 40 1c             	mov    0x1c(%eax),%eax
+  800e53:	85 c0                	test   %eax,%eax
+  800e55:	74 0e                	je     800e65 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  800e57:	83 ec 0c             	sub    $0xc,%esp
+  800e5a:	53                   	push   %ebx
+  800e5b:	ff d0                	call   *%eax
+  800e5d:	83 c4 10             	add    $0x10,%esp
+}
+  800e60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e63:	c9                   	leave
+  800e64:	c3                   	ret
+		return 0;
+  800e65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6a:	eb f4                	jmp    800e60 <fsync+0x45>
+
+00800e6c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800e6c:	55                   	push   %ebp
+  800e6d:	89 e5                	mov    %esp,%ebp
+  800e6f:	56                   	push   %esi
+  800e70:	53                   	push   %ebx
+  800e71:	83 ec 18             	sub    $0x18,%esp
+  800e74:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800e77:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800e7a:	50                   	push   %eax
+  800e7b:	53                   	push   %ebx
+  800e7c:	e8 8b fb ff ff       	call   800a0c <fd_lookup>
+  800e81:	83 c4 10             	add    $0x10,%esp
+  800e84:	85 c0                	test   %eax,%eax
+  800e86:	78 34                	js     800ebc <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800e88:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800e8b:	83 ec 08             	sub    $0x8,%esp
+  800e8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e91:	50                   	push   %eax
+  800e92:	ff 36                	push   (%esi)
+  800e94:	e8 c3 fb ff ff       	call   800a5c <dev_lookup>
+  800e99:	83 c4 10             	add    $0x10,%esp
+  800e9c:	85 c0                	test   %eax,%eax
+  800e9e:	78 1c                	js     800ebc <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800ea0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ea4:	74 1d                	je     800ec3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800ea6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ea9:	8b 40 18             	mov    0x18(%eax),%eax
+  800eac:	85 c0                	test   %eax,%eax
+  800eae:	74 34                	je     800ee4 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800eb0:	83 ec 08             	sub    $0x8,%esp
+  800eb3:	ff 75 0c             	push   0xc(%ebp)
+  800eb6:	56                   	push   %esi
+  800eb7:	ff d0                	call   *%eax
+  800eb9:	83 c4 10             	add    $0x10,%esp
+}
+  800ebc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ebf:	5b                   	pop    %ebx
+  800ec0:	5e                   	pop    %esi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800ec3:	a1 00 50 80 00       	mov    0x805000,%eax
+  800ec8:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ecb:	83 ec 04             	sub    $0x4,%esp
+  800ece:	53                   	push   %ebx
+  800ecf:	50                   	push   %eax
+  800ed0:	68 5c 38 80 00       	push   $0x80385c
+  800ed5:	e8 4b 1b 00 00       	call   802a25 <cprintf>
+		return -E_INVAL;
+  800eda:	83 c4 10             	add    $0x10,%esp
+  800edd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ee2:	eb d8                	jmp    800ebc <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800ee4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ee9:	eb d1                	jmp    800ebc <ftruncate+0x50>
+
+00800eeb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800eeb:	55                   	push   %ebp
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	56                   	push   %esi
+  800eef:	53                   	push   %ebx
+  800ef0:	83 ec 18             	sub    $0x18,%esp
+  800ef3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ef6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ef9:	50                   	push   %eax
+  800efa:	ff 75 08             	push   0x8(%ebp)
+  800efd:	e8 0a fb ff ff       	call   800a0c <fd_lookup>
+  800f02:	83 c4 10             	add    $0x10,%esp
+  800f05:	85 c0                	test   %eax,%eax
+  800f07:	78 49                	js     800f52 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800f09:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f0c:	83 ec 08             	sub    $0x8,%esp
+  800f0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f12:	50                   	push   %eax
+  800f13:	ff 36                	push   (%esi)
+  800f15:	e8 42 fb ff ff       	call   800a5c <dev_lookup>
+  800f1a:	83 c4 10             	add    $0x10,%esp
+  800f1d:	85 c0                	test   %eax,%eax
+  800f1f:	78 31                	js     800f52 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800f21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f24:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800f28:	74 2f                	je     800f59 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800f2a:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800f2d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800f34:	00 00 00 
+	stat->st_isdir = 0;
+  800f37:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800f3e:	00 00 00 
+	stat->st_dev = dev;
+  800f41:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800f47:	83 ec 08             	sub    $0x8,%esp
+  800f4a:	53                   	push   %ebx
+  800f4b:	56                   	push   %esi
+  800f4c:	ff 50 14             	call   *0x14(%eax)
+  800f4f:	83 c4 10             	add    $0x10,%esp
+}
+  800f52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f55:	5b                   	pop    %ebx
+  800f56:	5e                   	pop    %esi
+  800f57:	5d                   	pop    %ebp
+  800f58:	c3                   	ret
+		return -E_NOT_SUPP;
+  800f59:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f5e:	eb f2                	jmp    800f52 <fstat+0x67>
+
+00800f60 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800f60:	55                   	push   %ebp
+  800f61:	89 e5                	mov    %esp,%ebp
+  800f63:	56                   	push   %esi
+  800f64:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  800f65:	83 ec 08             	sub    $0x8,%esp
+  800f68:	68 00 10 00 00       	push   $0x1000
+  800f6d:	ff 75 08             	push   0x8(%ebp)
+  800f70:	e8 b3 07 00 00       	call   801728 <open>
+  800f75:	89 c3                	mov    %eax,%ebx
+  800f77:	83 c4 10             	add    $0x10,%esp
+  800f7a:	85 c0                	test   %eax,%eax
+  800f7c:	78 1b                	js     800f99 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  800f7e:	83 ec 08             	sub    $0x8,%esp
+  800f81:	ff 75 0c             	push   0xc(%ebp)
+  800f84:	50                   	push   %eax
+  800f85:	e8 61 ff ff ff       	call   800eeb <fstat>
+  800f8a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800f8c:	89 1c 24             	mov    %ebx,(%esp)
+  800f8f:	e8 a2 fb ff ff       	call   800b36 <close>
+	return r;
+  800f94:	83 c4 10             	add    $0x10,%esp
+  800f97:	89 f3                	mov    %esi,%ebx
+}
+  800f99:	89 d8                	mov    %ebx,%eax
+  800f9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f9e:	5b                   	pop    %ebx
+  800f9f:	5e                   	pop    %esi
+  800fa0:	5d                   	pop    %ebp
+  800fa1:	c3                   	ret
+
+00800fa2 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  800fa2:	55                   	push   %ebp
+  800fa3:	89 e5                	mov    %esp,%ebp
+  800fa5:	57                   	push   %edi
+  800fa6:	56                   	push   %esi
+  800fa7:	53                   	push   %ebx
+  800fa8:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  800fae:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  800fb4:	89 d6                	mov    %edx,%esi
+  800fb6:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  800fbc:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  800fbf:	89 d3                	mov    %edx,%ebx
+  800fc1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  800fc7:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800fce:	74 1d                	je     800fed <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  800fd0:	b8 00 60 80 00       	mov    $0x806000,%eax
+  800fd5:	83 c8 07             	or     $0x7,%eax
+  800fd8:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  800fde:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800fe3:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  800fe9:	01 ce                	add    %ecx,%esi
+  800feb:	eb 28                	jmp    801015 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800fed:	83 ec 0c             	sub    $0xc,%esp
+  800ff0:	6a 01                	push   $0x1
+  800ff2:	e8 9a 24 00 00       	call   803491 <ipc_find_env>
+  800ff7:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800ffc:	83 c4 10             	add    $0x10,%esp
+  800fff:	eb cf                	jmp    800fd0 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801001:	83 c0 01             	add    $0x1,%eax
+  801004:	89 fa                	mov    %edi,%edx
+  801006:	09 da                	or     %ebx,%edx
+  801008:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  80100f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801015:	39 f3                	cmp    %esi,%ebx
+  801017:	72 e8                	jb     801001 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801019:	83 f8 41             	cmp    $0x41,%eax
+  80101c:	77 2f                	ja     80104d <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  80101e:	50                   	push   %eax
+  80101f:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801025:	50                   	push   %eax
+  801026:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  80102c:	ff 35 c8 70 80 00    	push   0x8070c8
+  801032:	e8 0c 24 00 00       	call   803443 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801037:	83 c4 0c             	add    $0xc,%esp
+  80103a:	6a 00                	push   $0x0
+  80103c:	6a 00                	push   $0x0
+  80103e:	6a 00                	push   $0x0
+  801040:	e8 a8 22 00 00       	call   8032ed <ipc_recv>
+}
+  801045:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801048:	5b                   	pop    %ebx
+  801049:	5e                   	pop    %esi
+  80104a:	5f                   	pop    %edi
+  80104b:	5d                   	pop    %ebp
+  80104c:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  80104d:	68 cc 38 80 00       	push   $0x8038cc
+  801052:	68 e8 38 80 00       	push   $0x8038e8
+  801057:	6a 40                	push   $0x40
+  801059:	68 fd 38 80 00       	push   $0x8038fd
+  80105e:	e8 e7 18 00 00       	call   80294a <_panic>
+
+00801063 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801063:	55                   	push   %ebp
+  801064:	89 e5                	mov    %esp,%ebp
+  801066:	57                   	push   %edi
+  801067:	56                   	push   %esi
+  801068:	53                   	push   %ebx
+  801069:	83 ec 1c             	sub    $0x1c,%esp
+  80106c:	89 c3                	mov    %eax,%ebx
+  80106e:	89 d6                	mov    %edx,%esi
+  801070:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801073:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801079:	89 ca                	mov    %ecx,%edx
+  80107b:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  80107e:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801085:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801088:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  80108f:	8b 76 0c             	mov    0xc(%esi),%esi
+  801092:	89 fb                	mov    %edi,%ebx
+  801094:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  80109b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80109e:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  8010a5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010a8:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  8010af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010b2:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  8010b9:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  8010bc:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  8010c3:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  8010c8:	39 c8                	cmp    %ecx,%eax
+  8010ca:	74 0d                	je     8010d9 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  8010cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d4:	5b                   	pop    %ebx
+  8010d5:	5e                   	pop    %esi
+  8010d6:	5f                   	pop    %edi
+  8010d7:	5d                   	pop    %ebp
+  8010d8:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8010d9:	6a 07                	push   $0x7
+  8010db:	68 00 60 80 00       	push   $0x806000
+  8010e0:	6a 0d                	push   $0xd
+  8010e2:	ff 35 c8 70 80 00    	push   0x8070c8
+  8010e8:	e8 6b 22 00 00       	call   803358 <ipc_send>
+  8010ed:	83 c4 10             	add    $0x10,%esp
+  8010f0:	eb da                	jmp    8010cc <fsring_post+0x69>
+
+008010f2 <fsipcv>:
+{
+  8010f2:	55                   	push   %ebp
+  8010f3:	89 e5                	mov    %esp,%ebp
+  8010f5:	57                   	push   %edi
+  8010f6:	56                   	push   %esi
+  8010f7:	53                   	push   %ebx
+  8010f8:	83 ec 0c             	sub    $0xc,%esp
+  8010fb:	89 c7                	mov    %eax,%edi
+  8010fd:	89 d3                	mov    %edx,%ebx
+  8010ff:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801101:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801108:	74 26                	je     801130 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80110a:	6a 07                	push   $0x7
+  80110c:	68 00 60 80 00       	push   $0x806000
+  801111:	57                   	push   %edi
+  801112:	ff 35 c8 70 80 00    	push   0x8070c8
+  801118:	e8 3b 22 00 00       	call   803358 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  80111d:	6a 00                	push   $0x0
+  80111f:	56                   	push   %esi
+  801120:	53                   	push   %ebx
+  801121:	6a 00                	push   $0x0
+  801123:	e8 88 22 00 00       	call   8033b0 <ipc_recvv>
+}
+  801128:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112b:	5b                   	pop    %ebx
+  80112c:	5e                   	pop    %esi
+  80112d:	5f                   	pop    %edi
+  80112e:	5d                   	pop    %ebp
+  80112f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801130:	83 ec 0c             	sub    $0xc,%esp
+  801133:	6a 01                	push   $0x1
+  801135:	e8 57 23 00 00       	call   803491 <ipc_find_env>
+  80113a:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  80113f:	83 c4 10             	add    $0x10,%esp
+  801142:	eb c6                	jmp    80110a <fsipcv+0x18>
+
+00801144 <fsipc>:
+{
+  801144:	55                   	push   %ebp
+  801145:	89 e5                	mov    %esp,%ebp
+  801147:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  80114a:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801151:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801154:	e8 99 ff ff ff       	call   8010f2 <fsipcv>
+}
+  801159:	c9                   	leave
+  80115a:	c3                   	ret
+
+0080115b <file_write_direct>:
+{
+  80115b:	55                   	push   %ebp
+  80115c:	89 e5                	mov    %esp,%ebp
+  80115e:	56                   	push   %esi
+  80115f:	53                   	push   %ebx
+  801160:	89 c3                	mov    %eax,%ebx
+  801162:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801164:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  80116a:	77 40                	ja     8011ac <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80116c:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801171:	39 c8                	cmp    %ecx,%eax
+  801173:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801176:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801179:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  80117f:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801184:	83 ec 04             	sub    $0x4,%esp
+  801187:	50                   	push   %eax
+  801188:	52                   	push   %edx
+  801189:	68 08 60 80 00       	push   $0x806008
+  80118e:	e8 75 f1 ff ff       	call   800308 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801193:	ba 00 00 00 00       	mov    $0x0,%edx
+  801198:	b8 04 00 00 00       	mov    $0x4,%eax
+  80119d:	e8 a2 ff ff ff       	call   801144 <fsipc>
+  8011a2:	83 c4 10             	add    $0x10,%esp
+}
+  8011a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011a8:	5b                   	pop    %ebx
+  8011a9:	5e                   	pop    %esi
+  8011aa:	5d                   	pop    %ebp
+  8011ab:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8011ac:	89 d6                	mov    %edx,%esi
+  8011ae:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8011b4:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8011b9:	29 f1                	sub    %esi,%ecx
+  8011bb:	39 c1                	cmp    %eax,%ecx
+  8011bd:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  8011c0:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8011c3:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  8011c8:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8011ce:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  8011d4:	83 ec 0c             	sub    $0xc,%esp
+  8011d7:	6a 05                	push   $0x5
+  8011d9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011de:	e8 bf fd ff ff       	call   800fa2 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  8011e3:	83 c4 10             	add    $0x10,%esp
+  8011e6:	eb bd                	jmp    8011a5 <file_write_direct+0x4a>
+
+008011e8 <devfile_sync>:
+{
+  8011e8:	55                   	push   %ebp
+  8011e9:	89 e5                	mov    %esp,%ebp
+  8011eb:	57                   	push   %edi
+  8011ec:	56                   	push   %esi
+  8011ed:	53                   	push   %ebx
+  8011ee:	83 ec 28             	sub    $0x28,%esp
+  8011f1:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  8011f4:	56                   	push   %esi
+  8011f5:	e8 a5 f7 ff ff       	call   80099f <fd2data>
+  8011fa:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  8011fc:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  8011ff:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801206:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801209:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  80120e:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801212:	74 45                	je     801259 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801214:	8b 46 14             	mov    0x14(%esi),%eax
+  801217:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80121a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80121f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801224:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801227:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  80122a:	39 cb                	cmp    %ecx,%ebx
+  80122c:	73 14                	jae    801242 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  80122e:	29 d9                	sub    %ebx,%ecx
+  801230:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801233:	89 f0                	mov    %esi,%eax
+  801235:	e8 21 ff ff ff       	call   80115b <file_write_direct>
+  80123a:	85 c0                	test   %eax,%eax
+  80123c:	7e 04                	jle    801242 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80123e:	01 c3                	add    %eax,%ebx
+  801240:	eb e5                	jmp    801227 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801242:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801245:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  80124c:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  80124f:	85 c0                	test   %eax,%eax
+  801251:	ba 00 00 00 00       	mov    $0x0,%edx
+  801256:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801259:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125c:	5b                   	pop    %ebx
+  80125d:	5e                   	pop    %esi
+  80125e:	5f                   	pop    %edi
+  80125f:	5d                   	pop    %ebp
+  801260:	c3                   	ret
+
+00801261 <devfile_write>:
+{
+  801261:	55                   	push   %ebp
+  801262:	89 e5                	mov    %esp,%ebp
+  801264:	57                   	push   %edi
+  801265:	56                   	push   %esi
+  801266:	53                   	push   %ebx
+  801267:	83 ec 28             	sub    $0x28,%esp
+  80126a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80126d:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801270:	53                   	push   %ebx
+  801271:	e8 29 f7 ff ff       	call   80099f <fd2data>
+  801276:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801279:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80127c:	83 c4 10             	add    $0x10,%esp
+  80127f:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801283:	74 43                	je     8012c8 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801285:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  80128c:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80128f:	85 c0                	test   %eax,%eax
+  801291:	74 43                	je     8012d6 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801293:	89 c2                	mov    %eax,%edx
+  801295:	03 53 14             	add    0x14(%ebx),%edx
+  801298:	39 fa                	cmp    %edi,%edx
+  80129a:	75 0b                	jne    8012a7 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  80129c:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  80129f:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  8012a5:	76 66                	jbe    80130d <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  8012a7:	83 ec 0c             	sub    $0xc,%esp
+  8012aa:	53                   	push   %ebx
+  8012ab:	e8 38 ff ff ff       	call   8011e8 <devfile_sync>
+  8012b0:	83 c4 10             	add    $0x10,%esp
+  8012b3:	85 c0                	test   %eax,%eax
+  8012b5:	78 4e                	js     801305 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8012b7:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8012bd:	77 56                	ja     801315 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  8012bf:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8012c2:	85 c0                	test   %eax,%eax
+  8012c4:	75 20                	jne    8012e6 <devfile_write+0x85>
+  8012c6:	eb 16                	jmp    8012de <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  8012c8:	89 f1                	mov    %esi,%ecx
+  8012ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012cd:	89 d8                	mov    %ebx,%eax
+  8012cf:	e8 87 fe ff ff       	call   80115b <file_write_direct>
+  8012d4:	eb 2f                	jmp    801305 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8012d6:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8012dc:	77 37                	ja     801315 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  8012de:	89 7b 14             	mov    %edi,0x14(%ebx)
+  8012e1:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  8012e6:	83 ec 04             	sub    $0x4,%esp
+  8012e9:	56                   	push   %esi
+  8012ea:	ff 75 0c             	push   0xc(%ebp)
+  8012ed:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8012f0:	01 c1                	add    %eax,%ecx
+  8012f2:	51                   	push   %ecx
+  8012f3:	e8 10 f0 ff ff       	call   800308 <memmove>
+	ff->buf_wlen += n;
+  8012f8:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  8012fb:	01 f7                	add    %esi,%edi
+  8012fd:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801300:	89 f0                	mov    %esi,%eax
+  801302:	83 c4 10             	add    $0x10,%esp
+}
+  801305:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801308:	5b                   	pop    %ebx
+  801309:	5e                   	pop    %esi
+  80130a:	5f                   	pop    %edi
+  80130b:	5d                   	pop    %ebp
+  80130c:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  80130d:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801313:	76 d1                	jbe    8012e6 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801315:	89 f1                	mov    %esi,%ecx
+  801317:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80131a:	89 d8                	mov    %ebx,%eax
+  80131c:	e8 3a fe ff ff       	call   80115b <file_write_direct>
+  801321:	eb e2                	jmp    801305 <devfile_write+0xa4>
+
+00801323 <devfile_trunc>:
+{
+  801323:	55                   	push   %ebp
+  801324:	89 e5                	mov    %esp,%ebp
+  801326:	53                   	push   %ebx
+  801327:	83 ec 10             	sub    $0x10,%esp
+  80132a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  80132d:	53                   	push   %ebx
+  80132e:	e8 b5 fe ff ff       	call   8011e8 <devfile_sync>
+  801333:	83 c4 10             	add    $0x10,%esp
+  801336:	85 c0                	test   %eax,%eax
+  801338:	78 1f                	js     801359 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80133a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80133d:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801342:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801345:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80134a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80134f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801354:	e8 eb fd ff ff       	call   801144 <fsipc>
+}
+  801359:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80135c:	c9                   	leave
+  80135d:	c3                   	ret
+
+0080135e <devfile_stat>:
+{
+  80135e:	55                   	push   %ebp
+  80135f:	89 e5                	mov    %esp,%ebp
+  801361:	56                   	push   %esi
+  801362:	53                   	push   %ebx
+  801363:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801366:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801369:	83 ec 0c             	sub    $0xc,%esp
+  80136c:	53                   	push   %ebx
+  80136d:	e8 76 fe ff ff       	call   8011e8 <devfile_sync>
+  801372:	83 c4 10             	add    $0x10,%esp
+  801375:	85 c0                	test   %eax,%eax
+  801377:	78 47                	js     8013c0 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801379:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80137c:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801381:	ba 00 00 00 00       	mov    $0x0,%edx
+  801386:	b8 05 00 00 00       	mov    $0x5,%eax
+  80138b:	e8 b4 fd ff ff       	call   801144 <fsipc>
+  801390:	85 c0                	test   %eax,%eax
+  801392:	78 2c                	js     8013c0 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801394:	83 ec 08             	sub    $0x8,%esp
+  801397:	68 00 60 80 00       	push   $0x806000
+  80139c:	56                   	push   %esi
+  80139d:	e8 e0 ed ff ff       	call   800182 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8013a2:	a1 80 60 80 00       	mov    0x806080,%eax
+  8013a7:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8013ad:	a1 84 60 80 00       	mov    0x806084,%eax
+  8013b2:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  8013b8:	83 c4 10             	add    $0x10,%esp
+  8013bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013c3:	5b                   	pop    %ebx
+  8013c4:	5e                   	pop    %esi
+  8013c5:	5d                   	pop    %ebp
+  8013c6:	c3                   	ret
+
+008013c7 <devfile_flush>:
+{
+  8013c7:	55                   	push   %ebp
+  8013c8:	89 e5                	mov    %esp,%ebp
+  8013ca:	56                   	push   %esi
+  8013cb:	53                   	push   %ebx
+  8013cc:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  8013cf:	83 ec 0c             	sub    $0xc,%esp
+  8013d2:	56                   	push   %esi
+  8013d3:	e8 10 fe ff ff       	call   8011e8 <devfile_sync>
+  8013d8:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  8013da:	83 c4 10             	add    $0x10,%esp
+  8013dd:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  8013e1:	75 25                	jne    801408 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8013e3:	8b 46 0c             	mov    0xc(%esi),%eax
+  8013e6:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  8013eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8013f5:	e8 4a fd ff ff       	call   801144 <fsipc>
+  8013fa:	85 c0                	test   %eax,%eax
+  8013fc:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8013ff:	89 d8                	mov    %ebx,%eax
+  801401:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801404:	5b                   	pop    %ebx
+  801405:	5e                   	pop    %esi
+  801406:	5d                   	pop    %ebp
+  801407:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801408:	83 ec 0c             	sub    $0xc,%esp
+  80140b:	56                   	push   %esi
+  80140c:	e8 8e f5 ff ff       	call   80099f <fd2data>
+  801411:	83 c4 08             	add    $0x8,%esp
+  801414:	50                   	push   %eax
+  801415:	6a 00                	push   $0x0
+  801417:	e8 ff f1 ff ff       	call   80061b <sys_page_unmap>
+  80141c:	83 c4 10             	add    $0x10,%esp
+  80141f:	eb c2                	jmp    8013e3 <devfile_flush+0x1c>
+
+00801421 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801421:	55                   	push   %ebp
+  801422:	89 e5                	mov    %esp,%ebp
+  801424:	57                   	push   %edi
+  801425:	56                   	push   %esi
+  801426:	53                   	push   %ebx
+  801427:	83 ec 64             	sub    $0x64,%esp
+  80142a:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  80142c:	52                   	push   %edx
+  80142d:	50                   	push   %eax
+  80142e:	e8 d9 f5 ff ff       	call   800a0c <fd_lookup>
+  801433:	89 c1                	mov    %eax,%ecx
+  801435:	83 c4 10             	add    $0x10,%esp
+  801438:	85 c0                	test   %eax,%eax
+  80143a:	0f 88 f2 00 00 00    	js     801532 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801440:	8b 07                	mov    (%edi),%eax
+  801442:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801448:	39 10                	cmp    %edx,(%eax)
+  80144a:	0f 85 03 01 00 00    	jne    801553 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801450:	a1 00 50 80 00       	mov    0x805000,%eax
+  801455:	8b 40 48             	mov    0x48(%eax),%eax
+  801458:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  80145e:	0f 84 96 00 00 00    	je     8014fa <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801464:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  80146b:	0f 84 cb 00 00 00    	je     80153c <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801471:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801476:	83 c8 07             	or     $0x7,%eax
+  801479:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  80147c:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80147f:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801484:	83 ec 04             	sub    $0x4,%esp
+  801487:	68 07 04 00 00       	push   $0x407
+  80148c:	53                   	push   %ebx
+  80148d:	6a 00                	push   $0x0
+  80148f:	e8 fa f0 ff ff       	call   80058e <sys_page_alloc>
+  801494:	89 c1                	mov    %eax,%ecx
+  801496:	83 c4 10             	add    $0x10,%esp
+  801499:	85 c0                	test   %eax,%eax
+  80149b:	0f 88 91 00 00 00    	js     801532 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  8014a1:	89 d8                	mov    %ebx,%eax
+  8014a3:	83 c8 07             	or     $0x7,%eax
+  8014a6:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8014a8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8014ae:	83 c6 04             	add    $0x4,%esi
+  8014b1:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8014b7:	75 cb                	jne    801484 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8014b9:	6a 12                	push   $0x12
+  8014bb:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8014be:	50                   	push   %eax
+  8014bf:	6a 0c                	push   $0xc
+  8014c1:	ff 35 c8 70 80 00    	push   0x8070c8
+  8014c7:	e8 77 1f 00 00       	call   803443 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8014cc:	83 c4 0c             	add    $0xc,%esp
+  8014cf:	6a 00                	push   $0x0
+  8014d1:	6a 00                	push   $0x0
+  8014d3:	6a 00                	push   $0x0
+  8014d5:	e8 13 1e 00 00       	call   8032ed <ipc_recv>
+  8014da:	89 c1                	mov    %eax,%ecx
+  8014dc:	83 c4 10             	add    $0x10,%esp
+  8014df:	85 c0                	test   %eax,%eax
+  8014e1:	78 4f                	js     801532 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  8014e3:	a1 00 50 80 00       	mov    0x805000,%eax
+  8014e8:	8b 40 48             	mov    0x48(%eax),%eax
+  8014eb:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  8014f0:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  8014f7:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  8014fa:	83 ec 0c             	sub    $0xc,%esp
+  8014fd:	ff 37                	push   (%edi)
+  8014ff:	e8 e4 fc ff ff       	call   8011e8 <devfile_sync>
+  801504:	89 c1                	mov    %eax,%ecx
+  801506:	83 c4 10             	add    $0x10,%esp
+  801509:	85 c0                	test   %eax,%eax
+  80150b:	78 25                	js     801532 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  80150d:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801513:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801518:	ba 01 00 00 00       	mov    $0x1,%edx
+  80151d:	89 d0                	mov    %edx,%eax
+  80151f:	d3 e0                	shl    %cl,%eax
+  801521:	85 d8                	test   %ebx,%eax
+  801523:	74 0d                	je     801532 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801525:	83 c1 01             	add    $0x1,%ecx
+  801528:	83 f9 10             	cmp    $0x10,%ecx
+  80152b:	75 f0                	jne    80151d <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  80152d:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801532:	89 c8                	mov    %ecx,%eax
+  801534:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801537:	5b                   	pop    %ebx
+  801538:	5e                   	pop    %esi
+  801539:	5f                   	pop    %edi
+  80153a:	5d                   	pop    %ebp
+  80153b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80153c:	83 ec 0c             	sub    $0xc,%esp
+  80153f:	6a 01                	push   $0x1
+  801541:	e8 4b 1f 00 00       	call   803491 <ipc_find_env>
+  801546:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  80154b:	83 c4 10             	add    $0x10,%esp
+  80154e:	e9 1e ff ff ff       	jmp    801471 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801553:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801558:	eb d8                	jmp    801532 <fsring_slot+0x111>
+
+0080155a <file_read_direct>:
+{
+  80155a:	55                   	push   %ebp
+  80155b:	89 e5                	mov    %esp,%ebp
+  80155d:	57                   	push   %edi
+  80155e:	56                   	push   %esi
+  80155f:	53                   	push   %ebx
+  801560:	83 ec 1c             	sub    $0x1c,%esp
+  801563:	89 c7                	mov    %eax,%edi
+  801565:	89 d6                	mov    %edx,%esi
+  801567:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801569:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  80156f:	77 52                	ja     8015c3 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801571:	8b 40 0c             	mov    0xc(%eax),%eax
+  801574:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801579:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80157f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801584:	b8 03 00 00 00       	mov    $0x3,%eax
+  801589:	e8 b6 fb ff ff       	call   801144 <fsipc>
+  80158e:	89 c7                	mov    %eax,%edi
+  801590:	85 c0                	test   %eax,%eax
+  801592:	78 25                	js     8015b9 <file_read_direct+0x5f>
+	assert(r <= n);
+  801594:	39 c3                	cmp    %eax,%ebx
+  801596:	0f 82 87 00 00 00    	jb     801623 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  80159c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8015a1:	0f 8f 95 00 00 00    	jg     80163c <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8015a7:	83 ec 04             	sub    $0x4,%esp
+  8015aa:	50                   	push   %eax
+  8015ab:	68 00 60 80 00       	push   $0x806000
+  8015b0:	56                   	push   %esi
+  8015b1:	e8 52 ed ff ff       	call   800308 <memmove>
+	return r;
+  8015b6:	83 c4 10             	add    $0x10,%esp
+}
+  8015b9:	89 f8                	mov    %edi,%eax
+  8015bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015be:	5b                   	pop    %ebx
+  8015bf:	5e                   	pop    %esi
+  8015c0:	5f                   	pop    %edi
+  8015c1:	5d                   	pop    %ebp
+  8015c2:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8015c3:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8015c9:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8015ce:	29 d1                	sub    %edx,%ecx
+  8015d0:	39 d9                	cmp    %ebx,%ecx
+  8015d2:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8015d5:	89 f0                	mov    %esi,%eax
+  8015d7:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8015da:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8015dd:	eb 0f                	jmp    8015ee <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8015df:	0f b6 10             	movzbl (%eax),%edx
+  8015e2:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8015e4:	05 00 10 00 00       	add    $0x1000,%eax
+  8015e9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8015ee:	39 c8                	cmp    %ecx,%eax
+  8015f0:	72 ed                	jb     8015df <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  8015f2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015f5:	8b 47 0c             	mov    0xc(%edi),%eax
+  8015f8:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  8015fd:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801603:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801609:	83 ec 0c             	sub    $0xc,%esp
+  80160c:	6a 07                	push   $0x7
+  80160e:	89 d9                	mov    %ebx,%ecx
+  801610:	89 f2                	mov    %esi,%edx
+  801612:	b8 09 00 00 00       	mov    $0x9,%eax
+  801617:	e8 86 f9 ff ff       	call   800fa2 <fsipc_pages>
+  80161c:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  80161e:	83 c4 10             	add    $0x10,%esp
+  801621:	eb 96                	jmp    8015b9 <file_read_direct+0x5f>
+	assert(r <= n);
+  801623:	68 08 39 80 00       	push   $0x803908
+  801628:	68 e8 38 80 00       	push   $0x8038e8
+  80162d:	68 dc 00 00 00       	push   $0xdc
+  801632:	68 fd 38 80 00       	push   $0x8038fd
+  801637:	e8 0e 13 00 00       	call   80294a <_panic>
+	assert(r <= PGSIZE);
+  80163c:	68 19 39 80 00       	push   $0x803919
+  801641:	68 e8 38 80 00       	push   $0x8038e8
+  801646:	68 dd 00 00 00       	push   $0xdd
+  80164b:	68 fd 38 80 00       	push   $0x8038fd
+  801650:	e8 f5 12 00 00       	call   80294a <_panic>
+
+00801655 <devfile_read>:
+{
+  801655:	55                   	push   %ebp
+  801656:	89 e5                	mov    %esp,%ebp
+  801658:	57                   	push   %edi
+  801659:	56                   	push   %esi
+  80165a:	53                   	push   %ebx
+  80165b:	83 ec 28             	sub    $0x28,%esp
+  80165e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801661:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801664:	53                   	push   %ebx
+  801665:	e8 35 f3 ff ff       	call   80099f <fd2data>
+  80166a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  80166d:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801670:	83 c4 10             	add    $0x10,%esp
+  801673:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801677:	74 7d                	je     8016f6 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801679:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80167d:	0f 85 81 00 00 00    	jne    801704 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801683:	8b 43 18             	mov    0x18(%ebx),%eax
+  801686:	85 c0                	test   %eax,%eax
+  801688:	74 0d                	je     801697 <devfile_read+0x42>
+  80168a:	8b 53 14             	mov    0x14(%ebx),%edx
+  80168d:	39 fa                	cmp    %edi,%edx
+  80168f:	7f 06                	jg     801697 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801691:	01 c2                	add    %eax,%edx
+  801693:	39 d7                	cmp    %edx,%edi
+  801695:	72 28                	jb     8016bf <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801697:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  80169e:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8016a4:	77 74                	ja     80171a <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8016a6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8016ab:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8016ae:	89 d8                	mov    %ebx,%eax
+  8016b0:	e8 a5 fe ff ff       	call   80155a <file_read_direct>
+  8016b5:	85 c0                	test   %eax,%eax
+  8016b7:	7e 35                	jle    8016ee <devfile_read+0x99>
+		ff->buf_base = pos;
+  8016b9:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8016bc:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8016bf:	8b 53 14             	mov    0x14(%ebx),%edx
+  8016c2:	89 d0                	mov    %edx,%eax
+  8016c4:	03 43 18             	add    0x18(%ebx),%eax
+  8016c7:	29 f8                	sub    %edi,%eax
+  8016c9:	39 f0                	cmp    %esi,%eax
+  8016cb:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8016ce:	83 ec 04             	sub    $0x4,%esp
+  8016d1:	56                   	push   %esi
+  8016d2:	89 f8                	mov    %edi,%eax
+  8016d4:	29 d0                	sub    %edx,%eax
+  8016d6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8016d9:	01 c1                	add    %eax,%ecx
+  8016db:	51                   	push   %ecx
+  8016dc:	ff 75 0c             	push   0xc(%ebp)
+  8016df:	e8 24 ec ff ff       	call   800308 <memmove>
+	fd->fd_offset = pos + n;
+  8016e4:	01 f7                	add    %esi,%edi
+  8016e6:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8016e9:	89 f0                	mov    %esi,%eax
+  8016eb:	83 c4 10             	add    $0x10,%esp
+}
+  8016ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f1:	5b                   	pop    %ebx
+  8016f2:	5e                   	pop    %esi
+  8016f3:	5f                   	pop    %edi
+  8016f4:	5d                   	pop    %ebp
+  8016f5:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  8016f6:	89 f1                	mov    %esi,%ecx
+  8016f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016fb:	89 d8                	mov    %ebx,%eax
+  8016fd:	e8 58 fe ff ff       	call   80155a <file_read_direct>
+  801702:	eb ea                	jmp    8016ee <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801704:	83 ec 0c             	sub    $0xc,%esp
+  801707:	53                   	push   %ebx
+  801708:	e8 db fa ff ff       	call   8011e8 <devfile_sync>
+  80170d:	83 c4 10             	add    $0x10,%esp
+  801710:	85 c0                	test   %eax,%eax
+  801712:	0f 89 6b ff ff ff    	jns    801683 <devfile_read+0x2e>
+  801718:	eb d4                	jmp    8016ee <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  80171a:	89 f1                	mov    %esi,%ecx
+  80171c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80171f:	89 d8                	mov    %ebx,%eax
+  801721:	e8 34 fe ff ff       	call   80155a <file_read_direct>
+  801726:	eb c6                	jmp    8016ee <devfile_read+0x99>
+
+00801728 <open>:
+{
+  801728:	55                   	push   %ebp
+  801729:	89 e5                	mov    %esp,%ebp
+  80172b:	56                   	push   %esi
+  80172c:	53                   	push   %ebx
+  80172d:	83 ec 1c             	sub    $0x1c,%esp
+  801730:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801733:	56                   	push   %esi
+  801734:	e8 0e ea ff ff       	call   800147 <strlen>
+  801739:	83 c4 10             	add    $0x10,%esp
+  80173c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801741:	0f 8f a0 00 00 00    	jg     8017e7 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801747:	83 ec 0c             	sub    $0xc,%esp
+  80174a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80174d:	50                   	push   %eax
+  80174e:	e8 63 f2 ff ff       	call   8009b6 <fd_alloc>
+  801753:	89 c3                	mov    %eax,%ebx
+  801755:	83 c4 10             	add    $0x10,%esp
+  801758:	85 c0                	test   %eax,%eax
+  80175a:	78 45                	js     8017a1 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  80175c:	83 ec 08             	sub    $0x8,%esp
+  80175f:	56                   	push   %esi
+  801760:	68 00 60 80 00       	push   $0x806000
+  801765:	e8 18 ea ff ff       	call   800182 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80176a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80176d:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801772:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801775:	b8 01 00 00 00       	mov    $0x1,%eax
+  80177a:	e8 c5 f9 ff ff       	call   801144 <fsipc>
+  80177f:	89 c3                	mov    %eax,%ebx
+  801781:	83 c4 10             	add    $0x10,%esp
+  801784:	85 c0                	test   %eax,%eax
+  801786:	78 22                	js     8017aa <open+0x82>
+	if (!(mode & O_NOBUF)
+  801788:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  80178f:	74 2b                	je     8017bc <open+0x94>
+	return fd2num(fd);
+  801791:	83 ec 0c             	sub    $0xc,%esp
+  801794:	ff 75 f4             	push   -0xc(%ebp)
+  801797:	e8 f3 f1 ff ff       	call   80098f <fd2num>
+  80179c:	89 c3                	mov    %eax,%ebx
+  80179e:	83 c4 10             	add    $0x10,%esp
+}
+  8017a1:	89 d8                	mov    %ebx,%eax
+  8017a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a6:	5b                   	pop    %ebx
+  8017a7:	5e                   	pop    %esi
+  8017a8:	5d                   	pop    %ebp
+  8017a9:	c3                   	ret
+		fd_close(fd, 0);
+  8017aa:	83 ec 08             	sub    $0x8,%esp
+  8017ad:	6a 00                	push   $0x0
+  8017af:	ff 75 f4             	push   -0xc(%ebp)
+  8017b2:	e8 f8 f2 ff ff       	call   800aaf <fd_close>
+		return r;
+  8017b7:	83 c4 10             	add    $0x10,%esp
+  8017ba:	eb e5                	jmp    8017a1 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8017bc:	83 ec 0c             	sub    $0xc,%esp
+  8017bf:	ff 75 f4             	push   -0xc(%ebp)
+  8017c2:	e8 d8 f1 ff ff       	call   80099f <fd2data>
+  8017c7:	83 c4 0c             	add    $0xc,%esp
+  8017ca:	68 07 04 00 00       	push   $0x407
+  8017cf:	50                   	push   %eax
+  8017d0:	6a 00                	push   $0x0
+  8017d2:	e8 b7 ed ff ff       	call   80058e <sys_page_alloc>
+  8017d7:	83 c4 10             	add    $0x10,%esp
+  8017da:	85 c0                	test   %eax,%eax
+  8017dc:	75 b3                	jne    801791 <open+0x69>
+		fd->fd_file.buffered = 1;
+  8017de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017e1:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8017e5:	eb aa                	jmp    801791 <open+0x69>
+		return -E_BAD_PATH;
+  8017e7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8017ec:	eb b3                	jmp    8017a1 <open+0x79>
+
+008017ee <readdir>:
+{
+  8017ee:	55                   	push   %ebp
+  8017ef:	89 e5                	mov    %esp,%ebp
+  8017f1:	53                   	push   %ebx
+  8017f2:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017f8:	50                   	push   %eax
+  8017f9:	ff 75 08             	push   0x8(%ebp)
+  8017fc:	e8 0b f2 ff ff       	call   800a0c <fd_lookup>
+  801801:	89 c3                	mov    %eax,%ebx
+  801803:	83 c4 10             	add    $0x10,%esp
+  801806:	85 c0                	test   %eax,%eax
+  801808:	78 73                	js     80187d <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80180a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80180d:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801813:	39 08                	cmp    %ecx,(%eax)
+  801815:	0f 85 82 00 00 00    	jne    80189d <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  80181b:	83 ec 0c             	sub    $0xc,%esp
+  80181e:	50                   	push   %eax
+  80181f:	e8 c4 f9 ff ff       	call   8011e8 <devfile_sync>
+  801824:	89 c3                	mov    %eax,%ebx
+  801826:	83 c4 10             	add    $0x10,%esp
+  801829:	85 c0                	test   %eax,%eax
+  80182b:	78 50                	js     80187d <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  80182d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801830:	8b 40 0c             	mov    0xc(%eax),%eax
+  801833:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801838:	8b 45 10             	mov    0x10(%ebp),%eax
+  80183b:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801840:	8b 45 14             	mov    0x14(%ebp),%eax
+  801843:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801848:	ba 00 00 00 00       	mov    $0x0,%edx
+  80184d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801852:	e8 ed f8 ff ff       	call   801144 <fsipc>
+  801857:	89 c3                	mov    %eax,%ebx
+  801859:	85 c0                	test   %eax,%eax
+  80185b:	7e 20                	jle    80187d <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  80185d:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801860:	72 22                	jb     801884 <readdir+0x96>
+  801862:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801867:	7f 1b                	jg     801884 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801869:	83 ec 04             	sub    $0x4,%esp
+  80186c:	50                   	push   %eax
+  80186d:	68 00 60 80 00       	push   $0x806000
+  801872:	ff 75 0c             	push   0xc(%ebp)
+  801875:	e8 8e ea ff ff       	call   800308 <memmove>
+	return r;
+  80187a:	83 c4 10             	add    $0x10,%esp
+}
+  80187d:	89 d8                	mov    %ebx,%eax
+  80187f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801882:	c9                   	leave
+  801883:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801884:	68 0f 39 80 00       	push   $0x80390f
+  801889:	68 e8 38 80 00       	push   $0x8038e8
+  80188e:	68 86 01 00 00       	push   $0x186
+  801893:	68 fd 38 80 00       	push   $0x8038fd
+  801898:	e8 ad 10 00 00       	call   80294a <_panic>
+		return -E_NOT_SUPP;
+  80189d:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8018a2:	eb d9                	jmp    80187d <readdir+0x8f>
+
+008018a4 <munmap>:
+{
+  8018a4:	55                   	push   %ebp
+  8018a5:	89 e5                	mov    %esp,%ebp
+  8018a7:	56                   	push   %esi
+  8018a8:	53                   	push   %ebx
+  8018a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8018af:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8018b5:	75 41                	jne    8018f8 <munmap+0x54>
+  8018b7:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8018bd:	77 39                	ja     8018f8 <munmap+0x54>
+  8018bf:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8018c4:	29 f0                	sub    %esi,%eax
+  8018c6:	39 d0                	cmp    %edx,%eax
+  8018c8:	72 35                	jb     8018ff <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8018ca:	89 f3                	mov    %esi,%ebx
+  8018cc:	01 d6                	add    %edx,%esi
+  8018ce:	39 f3                	cmp    %esi,%ebx
+  8018d0:	73 1a                	jae    8018ec <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8018d2:	83 ec 08             	sub    $0x8,%esp
+  8018d5:	53                   	push   %ebx
+  8018d6:	6a 00                	push   $0x0
+  8018d8:	e8 3e ed ff ff       	call   80061b <sys_page_unmap>
+  8018dd:	83 c4 10             	add    $0x10,%esp
+  8018e0:	85 c0                	test   %eax,%eax
+  8018e2:	78 0d                	js     8018f1 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8018e4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8018ea:	eb e2                	jmp    8018ce <munmap+0x2a>
+	return 0;
+  8018ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018f4:	5b                   	pop    %ebx
+  8018f5:	5e                   	pop    %esi
+  8018f6:	5d                   	pop    %ebp
+  8018f7:	c3                   	ret
+		return -E_INVAL;
+  8018f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018fd:	eb f2                	jmp    8018f1 <munmap+0x4d>
+  8018ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801904:	eb eb                	jmp    8018f1 <munmap+0x4d>
+
+00801906 <mmap>:
+{
+  801906:	55                   	push   %ebp
+  801907:	89 e5                	mov    %esp,%ebp
+  801909:	57                   	push   %edi
+  80190a:	56                   	push   %esi
+  80190b:	53                   	push   %ebx
+  80190c:	83 ec 34             	sub    $0x34,%esp
+  80190f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801912:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801915:	50                   	push   %eax
+  801916:	ff 75 18             	push   0x18(%ebp)
+  801919:	e8 ee f0 ff ff       	call   800a0c <fd_lookup>
+  80191e:	89 c3                	mov    %eax,%ebx
+  801920:	83 c4 10             	add    $0x10,%esp
+  801923:	85 c0                	test   %eax,%eax
+  801925:	0f 88 0e 01 00 00    	js     801a39 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80192b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80192e:	a1 20 40 80 00       	mov    0x804020,%eax
+  801933:	39 02                	cmp    %eax,(%edx)
+  801935:	0f 85 50 01 00 00    	jne    801a8b <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  80193b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80193e:	83 e0 02             	and    $0x2,%eax
+  801941:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801944:	74 0a                	je     801950 <mmap+0x4a>
+  801946:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80194a:	0f 84 42 01 00 00    	je     801a92 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801950:	8b 42 08             	mov    0x8(%edx),%eax
+  801953:	83 e0 03             	and    $0x3,%eax
+  801956:	83 f8 01             	cmp    $0x1,%eax
+  801959:	0f 84 3a 01 00 00    	je     801a99 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  80195f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801962:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801965:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80196a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80196d:	0f 85 2d 01 00 00    	jne    801aa0 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801973:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801977:	0f 88 2a 01 00 00    	js     801aa7 <mmap+0x1a1>
+  80197d:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  801984:	0f 87 1d 01 00 00    	ja     801aa7 <mmap+0x1a1>
+  80198a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80198f:	2b 45 08             	sub    0x8(%ebp),%eax
+  801992:	39 f8                	cmp    %edi,%eax
+  801994:	0f 82 14 01 00 00    	jb     801aae <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  80199a:	83 ec 0c             	sub    $0xc,%esp
+  80199d:	52                   	push   %edx
+  80199e:	e8 45 f8 ff ff       	call   8011e8 <devfile_sync>
+  8019a3:	89 c3                	mov    %eax,%ebx
+  8019a5:	83 c4 10             	add    $0x10,%esp
+  8019a8:	85 c0                	test   %eax,%eax
+  8019aa:	0f 88 89 00 00 00    	js     801a39 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8019b0:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8019b6:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8019bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c1:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8019c4:	39 fe                	cmp    %edi,%esi
+  8019c6:	73 7b                	jae    801a43 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8019c8:	89 f8                	mov    %edi,%eax
+  8019ca:	29 f0                	sub    %esi,%eax
+  8019cc:	c1 e8 0c             	shr    $0xc,%eax
+  8019cf:	ba 40 00 00 00       	mov    $0x40,%edx
+  8019d4:	39 d0                	cmp    %edx,%eax
+  8019d6:	0f 47 c2             	cmova  %edx,%eax
+  8019d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8019dc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8019df:	8b 52 0c             	mov    0xc(%edx),%edx
+  8019e2:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  8019e8:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8019eb:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  8019f1:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8019f6:	89 f2                	mov    %esi,%edx
+  8019f8:	03 55 08             	add    0x8(%ebp),%edx
+  8019fb:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8019fe:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801a03:	e8 ea f6 ff ff       	call   8010f2 <fsipcv>
+  801a08:	85 c0                	test   %eax,%eax
+  801a0a:	7e 12                	jle    801a1e <mmap+0x118>
+  801a0c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a0f:	85 c0                	test   %eax,%eax
+  801a11:	0f 84 9e 00 00 00    	je     801ab5 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801a17:	c1 e0 0c             	shl    $0xc,%eax
+  801a1a:	01 c6                	add    %eax,%esi
+  801a1c:	eb a6                	jmp    8019c4 <mmap+0xbe>
+			munmap(addr, done);
+  801a1e:	89 c3                	mov    %eax,%ebx
+  801a20:	83 ec 08             	sub    $0x8,%esp
+  801a23:	56                   	push   %esi
+  801a24:	ff 75 08             	push   0x8(%ebp)
+  801a27:	e8 78 fe ff ff       	call   8018a4 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  801a2c:	83 c4 10             	add    $0x10,%esp
+  801a2f:	85 db                	test   %ebx,%ebx
+  801a31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a36:	0f 49 d8             	cmovns %eax,%ebx
+}
+  801a39:	89 d8                	mov    %ebx,%eax
+  801a3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a3e:	5b                   	pop    %ebx
+  801a3f:	5e                   	pop    %esi
+  801a40:	5f                   	pop    %edi
+  801a41:	5d                   	pop    %ebp
+  801a42:	c3                   	ret
+	if (prot & PROT_WRITE)
+  801a43:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  801a46:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  801a48:	85 c0                	test   %eax,%eax
+  801a4a:	74 ed                	je     801a39 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  801a4c:	be 00 00 00 00       	mov    $0x0,%esi
+  801a51:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a54:	39 fe                	cmp    %edi,%esi
+  801a56:	73 2e                	jae    801a86 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  801a58:	83 ec 0c             	sub    $0xc,%esp
+  801a5b:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  801a5e:	50                   	push   %eax
+  801a5f:	e8 8b 16 00 00       	call   8030ef <cowpage>
+  801a64:	83 c4 10             	add    $0x10,%esp
+  801a67:	85 c0                	test   %eax,%eax
+  801a69:	78 08                	js     801a73 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  801a6b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801a71:	eb e1                	jmp    801a54 <mmap+0x14e>
+				munmap(addr, len);
+  801a73:	89 c3                	mov    %eax,%ebx
+  801a75:	83 ec 08             	sub    $0x8,%esp
+  801a78:	57                   	push   %edi
+  801a79:	ff 75 08             	push   0x8(%ebp)
+  801a7c:	e8 23 fe ff ff       	call   8018a4 <munmap>
+				return r;
+  801a81:	83 c4 10             	add    $0x10,%esp
+  801a84:	eb b3                	jmp    801a39 <mmap+0x133>
+	return 0;
+  801a86:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801a89:	eb ae                	jmp    801a39 <mmap+0x133>
+		return -E_NOT_SUPP;
+  801a8b:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801a90:	eb a7                	jmp    801a39 <mmap+0x133>
+		return -E_NOT_SUPP;
+  801a92:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801a97:	eb a0                	jmp    801a39 <mmap+0x133>
+		return -E_INVAL;
+  801a99:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801a9e:	eb 99                	jmp    801a39 <mmap+0x133>
+  801aa0:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801aa5:	eb 92                	jmp    801a39 <mmap+0x133>
+  801aa7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801aac:	eb 8b                	jmp    801a39 <mmap+0x133>
+  801aae:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801ab3:	eb 84                	jmp    801a39 <mmap+0x133>
+			munmap(addr, done);
+  801ab5:	83 ec 08             	sub    $0x8,%esp
+  801ab8:	56                   	push   %esi
+  801ab9:	ff 75 08             	push   0x8(%ebp)
+  801abc:	e8 e3 fd ff ff       	call   8018a4 <munmap>
+  801ac1:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  801ac4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801ac9:	e9 6b ff ff ff       	jmp    801a39 <mmap+0x133>
+
+00801ace <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  801ace:	55                   	push   %ebp
+  801acf:	89 e5                	mov    %esp,%ebp
+  801ad1:	56                   	push   %esi
+  801ad2:	53                   	push   %ebx
+  801ad3:	83 ec 10             	sub    $0x10,%esp
+  801ad6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  801ad9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801adc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801adf:	e8 3d f9 ff ff       	call   801421 <fsring_slot>
+  801ae4:	85 c0                	test   %eax,%eax
+  801ae6:	78 60                	js     801b48 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  801ae8:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  801aeb:	8b 56 08             	mov    0x8(%esi),%edx
+  801aee:	83 e2 03             	and    $0x3,%edx
+  801af1:	83 fa 01             	cmp    $0x1,%edx
+  801af4:	74 59                	je     801b4f <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  801af6:	ba 01 00 00 00       	mov    $0x1,%edx
+  801afb:	89 c1                	mov    %eax,%ecx
+  801afd:	d3 e2                	shl    %cl,%edx
+  801aff:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  801b05:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  801b08:	c1 e2 02             	shl    $0x2,%edx
+  801b0b:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  801b11:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  801b18:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  801b1b:	8b 55 18             	mov    0x18(%ebp),%edx
+  801b1e:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  801b21:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b24:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  801b27:	83 ec 08             	sub    $0x8,%esp
+  801b2a:	50                   	push   %eax
+  801b2b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801b30:	39 c3                	cmp    %eax,%ebx
+  801b32:	0f 47 d8             	cmova  %eax,%ebx
+  801b35:	53                   	push   %ebx
+  801b36:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801b39:	89 f2                	mov    %esi,%edx
+  801b3b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b40:	e8 1e f5 ff ff       	call   801063 <fsring_post>
+  801b45:	83 c4 10             	add    $0x10,%esp
+}
+  801b48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b4b:	5b                   	pop    %ebx
+  801b4c:	5e                   	pop    %esi
+  801b4d:	5d                   	pop    %ebp
+  801b4e:	c3                   	ret
+		return -E_INVAL;
+  801b4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b54:	eb f2                	jmp    801b48 <fsring_read+0x7a>
+
+00801b56 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  801b56:	55                   	push   %ebp
+  801b57:	89 e5                	mov    %esp,%ebp
+  801b59:	56                   	push   %esi
+  801b5a:	53                   	push   %ebx
+  801b5b:	83 ec 10             	sub    $0x10,%esp
+  801b5e:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  801b61:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801b64:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b67:	e8 b5 f8 ff ff       	call   801421 <fsring_slot>
+  801b6c:	89 c3                	mov    %eax,%ebx
+  801b6e:	85 c0                	test   %eax,%eax
+  801b70:	78 77                	js     801be9 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801b72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b75:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801b79:	74 77                	je     801bf2 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  801b7b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801b80:	39 c6                	cmp    %eax,%esi
+  801b82:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  801b85:	83 ec 04             	sub    $0x4,%esp
+  801b88:	56                   	push   %esi
+  801b89:	ff 75 0c             	push   0xc(%ebp)
+  801b8c:	89 d8                	mov    %ebx,%eax
+  801b8e:	c1 e0 0c             	shl    $0xc,%eax
+  801b91:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  801b97:	50                   	push   %eax
+  801b98:	e8 6b e7 ff ff       	call   800308 <memmove>
+	fsring_busy |= 1 << slot;
+  801b9d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ba2:	89 d9                	mov    %ebx,%ecx
+  801ba4:	d3 e0                	shl    %cl,%eax
+  801ba6:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  801bac:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801baf:	c1 e0 02             	shl    $0x2,%eax
+  801bb2:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  801bb8:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  801bbf:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  801bc2:	8b 45 18             	mov    0x18(%ebp),%eax
+  801bc5:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  801bc8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  801bcf:	83 c4 08             	add    $0x8,%esp
+  801bd2:	53                   	push   %ebx
+  801bd3:	56                   	push   %esi
+  801bd4:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801bd7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801bda:	b8 04 00 00 00       	mov    $0x4,%eax
+  801bdf:	e8 7f f4 ff ff       	call   801063 <fsring_post>
+  801be4:	89 c3                	mov    %eax,%ebx
+  801be6:	83 c4 10             	add    $0x10,%esp
+}
+  801be9:	89 d8                	mov    %ebx,%eax
+  801beb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bee:	5b                   	pop    %ebx
+  801bef:	5e                   	pop    %esi
+  801bf0:	5d                   	pop    %ebp
+  801bf1:	c3                   	ret
+		return -E_INVAL;
+  801bf2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801bf7:	eb f0                	jmp    801be9 <fsring_write+0x93>
+
+00801bf9 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  801bf9:	55                   	push   %ebp
+  801bfa:	89 e5                	mov    %esp,%ebp
+  801bfc:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  801bff:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c05:	e8 17 f8 ff ff       	call   801421 <fsring_slot>
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	78 4c                	js     801c5a <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  801c0e:	ba 01 00 00 00       	mov    $0x1,%edx
+  801c13:	89 c1                	mov    %eax,%ecx
+  801c15:	d3 e2                	shl    %cl,%edx
+  801c17:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  801c1d:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  801c20:	c1 e2 02             	shl    $0x2,%edx
+  801c23:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  801c29:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  801c30:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  801c33:	8b 55 10             	mov    0x10(%ebp),%edx
+  801c36:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  801c39:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c3c:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  801c3f:	83 ec 08             	sub    $0x8,%esp
+  801c42:	50                   	push   %eax
+  801c43:	6a 00                	push   $0x0
+  801c45:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c4a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c4d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c52:	e8 0c f4 ff ff       	call   801063 <fsring_post>
+  801c57:	83 c4 10             	add    $0x10,%esp
+}
+  801c5a:	c9                   	leave
+  801c5b:	c3                   	ret
+
+00801c5c <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  801c5c:	55                   	push   %ebp
+  801c5d:	89 e5                	mov    %esp,%ebp
+  801c5f:	57                   	push   %edi
+  801c60:	56                   	push   %esi
+  801c61:	53                   	push   %ebx
+  801c62:	83 ec 1c             	sub    $0x1c,%esp
+  801c65:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  801c69:	a1 00 50 80 00       	mov    0x805000,%eax
+  801c6e:	8b 40 48             	mov    0x48(%eax),%eax
+  801c71:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801c77:	74 12                	je     801c8b <fsring_reap+0x2f>
+		return 0;
+  801c79:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  801c7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c81:	5b                   	pop    %ebx
+  801c82:	5e                   	pop    %esi
+  801c83:	5f                   	pop    %edi
+  801c84:	5d                   	pop    %ebp
+  801c85:	c3                   	ret
+		sys_yield();
+  801c86:	e8 e4 e8 ff ff       	call   80056f <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  801c8b:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  801c91:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  801c96:	39 c2                	cmp    %eax,%edx
+  801c98:	75 18                	jne    801cb2 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  801c9a:	84 db                	test   %bl,%bl
+  801c9c:	0f 84 21 01 00 00    	je     801dc3 <fsring_reap+0x167>
+  801ca2:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  801ca9:	75 db                	jne    801c86 <fsring_reap+0x2a>
+			return 0;
+  801cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb0:	eb cc                	jmp    801c7e <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  801cb2:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  801cb7:	83 e0 0f             	and    $0xf,%eax
+  801cba:	83 c0 2a             	add    $0x2a,%eax
+  801cbd:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  801cc4:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  801ccb:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  801cd0:	83 c0 01             	add    $0x1,%eax
+  801cd3:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  801cd8:	83 fb 0f             	cmp    $0xf,%ebx
+  801cdb:	77 5b                	ja     801d38 <fsring_reap+0xdc>
+  801cdd:	be 01 00 00 00       	mov    $0x1,%esi
+  801ce2:	89 d9                	mov    %ebx,%ecx
+  801ce4:	d3 e6                	shl    %cl,%esi
+  801ce6:	89 f0                	mov    %esi,%eax
+  801ce8:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  801cee:	74 48                	je     801d38 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  801cf0:	89 d8                	mov    %ebx,%eax
+  801cf2:	c1 e0 0c             	shl    $0xc,%eax
+  801cf5:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  801cfb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  801cfe:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801d01:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  801d08:	83 f8 03             	cmp    $0x3,%eax
+  801d0b:	74 40                	je     801d4d <fsring_reap+0xf1>
+  801d0d:	83 f8 05             	cmp    $0x5,%eax
+  801d10:	74 64                	je     801d76 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  801d12:	f7 d6                	not    %esi
+  801d14:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  801d1a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801d1d:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  801d24:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d27:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  801d29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d2c:	89 38                	mov    %edi,(%eax)
+	return 1;
+  801d2e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d33:	e9 46 ff ff ff       	jmp    801c7e <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  801d38:	53                   	push   %ebx
+  801d39:	68 25 39 80 00       	push   $0x803925
+  801d3e:	68 8f 02 00 00       	push   $0x28f
+  801d43:	68 fd 38 80 00       	push   $0x8038fd
+  801d48:	e8 fd 0b 00 00       	call   80294a <_panic>
+		if (cqe.cqe_result > 0)
+  801d4d:	85 ff                	test   %edi,%edi
+  801d4f:	7e c1                	jle    801d12 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801d51:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  801d54:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801d59:	39 c7                	cmp    %eax,%edi
+  801d5b:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801d5e:	50                   	push   %eax
+  801d5f:	ff 75 e4             	push   -0x1c(%ebp)
+  801d62:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801d65:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  801d6c:	e8 97 e5 ff ff       	call   800308 <memmove>
+  801d71:	83 c4 10             	add    $0x10,%esp
+  801d74:	eb 9c                	jmp    801d12 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  801d76:	85 ff                	test   %edi,%edi
+  801d78:	75 98                	jne    801d12 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  801d7a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801d7d:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  801d84:	83 ec 08             	sub    $0x8,%esp
+  801d87:	ff 75 e4             	push   -0x1c(%ebp)
+  801d8a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801d8d:	51                   	push   %ecx
+  801d8e:	e8 ef e3 ff ff       	call   800182 <strcpy>
+			st->st_size = ret->ret_size;
+  801d93:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d96:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  801d9c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801d9f:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  801da5:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  801dab:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  801db1:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  801db8:	40 80 00 
+  801dbb:	83 c4 10             	add    $0x10,%esp
+  801dbe:	e9 4f ff ff ff       	jmp    801d12 <fsring_reap+0xb6>
+			return 0;
+  801dc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc8:	e9 b1 fe ff ff       	jmp    801c7e <fsring_reap+0x22>
+
+00801dcd <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  801dcd:	55                   	push   %ebp
+  801dce:	89 e5                	mov    %esp,%ebp
+  801dd0:	57                   	push   %edi
+  801dd1:	56                   	push   %esi
+  801dd2:	53                   	push   %ebx
+  801dd3:	83 ec 28             	sub    $0x28,%esp
+  801dd6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801dd9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801ddc:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801ddf:	53                   	push   %ebx
+  801de0:	e8 62 e3 ff ff       	call   800147 <strlen>
+  801de5:	83 c4 10             	add    $0x10,%esp
+  801de8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ded:	0f 8f 02 01 00 00    	jg     801ef5 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  801df3:	83 ec 08             	sub    $0x8,%esp
+  801df6:	53                   	push   %ebx
+  801df7:	68 00 60 80 00       	push   $0x806000
+  801dfc:	e8 81 e3 ff ff       	call   800182 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  801e01:	83 c4 10             	add    $0x10,%esp
+  801e04:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  801e0a:	76 69                	jbe    801e75 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801e0c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e0f:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801e15:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801e1a:	29 d1                	sub    %edx,%ecx
+  801e1c:	39 f9                	cmp    %edi,%ecx
+  801e1e:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801e21:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e24:	89 f9                	mov    %edi,%ecx
+  801e26:	01 c1                	add    %eax,%ecx
+  801e28:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801e2b:	eb 0f                	jmp    801e3c <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  801e2d:	0f b6 10             	movzbl (%eax),%edx
+  801e30:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801e32:	05 00 10 00 00       	add    $0x1000,%eax
+  801e37:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801e3c:	39 c8                	cmp    %ecx,%eax
+  801e3e:	72 ed                	jb     801e2d <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  801e40:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801e43:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  801e49:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  801e4f:	83 ec 0c             	sub    $0xc,%esp
+  801e52:	6a 07                	push   $0x7
+  801e54:	89 f9                	mov    %edi,%ecx
+  801e56:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e59:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801e5e:	e8 3f f1 ff ff       	call   800fa2 <fsipc_pages>
+  801e63:	89 c7                	mov    %eax,%edi
+  801e65:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  801e68:	85 f6                	test   %esi,%esi
+  801e6a:	74 7f                	je     801eeb <file_slurp+0x11e>
+  801e6c:	8d 43 01             	lea    0x1(%ebx),%eax
+  801e6f:	85 ff                	test   %edi,%edi
+  801e71:	79 3c                	jns    801eaf <file_slurp+0xe2>
+  801e73:	eb 76                	jmp    801eeb <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  801e75:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  801e7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e80:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801e85:	e8 ba f2 ff ff       	call   801144 <fsipc>
+  801e8a:	89 c7                	mov    %eax,%edi
+  801e8c:	85 c0                	test   %eax,%eax
+  801e8e:	7e d8                	jle    801e68 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  801e90:	83 ec 04             	sub    $0x4,%esp
+  801e93:	50                   	push   %eax
+  801e94:	68 08 60 80 00       	push   $0x806008
+  801e99:	ff 75 0c             	push   0xc(%ebp)
+  801e9c:	e8 67 e4 ff ff       	call   800308 <memmove>
+  801ea1:	83 c4 10             	add    $0x10,%esp
+  801ea4:	eb c2                	jmp    801e68 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  801ea6:	80 fa 2f             	cmp    $0x2f,%dl
+  801ea9:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  801eac:	83 c0 01             	add    $0x1,%eax
+  801eaf:	89 c1                	mov    %eax,%ecx
+  801eb1:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  801eb5:	84 d2                	test   %dl,%dl
+  801eb7:	75 ed                	jne    801ea6 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  801eb9:	83 ec 04             	sub    $0x4,%esp
+  801ebc:	68 80 00 00 00       	push   $0x80
+  801ec1:	53                   	push   %ebx
+  801ec2:	56                   	push   %esi
+  801ec3:	e8 30 e3 ff ff       	call   8001f8 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  801ec8:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ecd:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  801ed3:	a1 04 60 80 00       	mov    0x806004,%eax
+  801ed8:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  801ede:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  801ee5:	40 80 00 
+  801ee8:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801eeb:	89 f8                	mov    %edi,%eax
+  801eed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ef0:	5b                   	pop    %ebx
+  801ef1:	5e                   	pop    %esi
+  801ef2:	5f                   	pop    %edi
+  801ef3:	5d                   	pop    %ebp
+  801ef4:	c3                   	ret
+		return -E_BAD_PATH;
+  801ef5:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  801efa:	eb ef                	jmp    801eeb <file_slurp+0x11e>
+
+00801efc <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801efc:	55                   	push   %ebp
+  801efd:	89 e5                	mov    %esp,%ebp
+  801eff:	53                   	push   %ebx
+  801f00:	83 ec 10             	sub    $0x10,%esp
+  801f03:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801f06:	53                   	push   %ebx
+  801f07:	e8 3b e2 ff ff       	call   800147 <strlen>
+  801f0c:	83 c4 10             	add    $0x10,%esp
+  801f0f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f14:	7f 25                	jg     801f3b <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801f16:	83 ec 08             	sub    $0x8,%esp
+  801f19:	53                   	push   %ebx
+  801f1a:	68 00 60 80 00       	push   $0x806000
+  801f1f:	e8 5e e2 ff ff       	call   800182 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801f24:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f29:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f2e:	e8 11 f2 ff ff       	call   801144 <fsipc>
+  801f33:	83 c4 10             	add    $0x10,%esp
+}
+  801f36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f39:	c9                   	leave
+  801f3a:	c3                   	ret
+		return -E_BAD_PATH;
+  801f3b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801f40:	eb f4                	jmp    801f36 <remove+0x3a>
+
+00801f42 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801f42:	55                   	push   %ebp
+  801f43:	89 e5                	mov    %esp,%ebp
+  801f45:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801f48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f52:	e8 ed f1 ff ff       	call   801144 <fsipc>
+}
+  801f57:	c9                   	leave
+  801f58:	c3                   	ret
+
+00801f59 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  801f59:	55                   	push   %ebp
+  801f5a:	89 e5                	mov    %esp,%ebp
+  801f5c:	57                   	push   %edi
+  801f5d:	56                   	push   %esi
+  801f5e:	53                   	push   %ebx
+  801f5f:	83 ec 18             	sub    $0x18,%esp
+  801f62:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f65:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801f6b:	57                   	push   %edi
+  801f6c:	e8 d6 e1 ff ff       	call   800147 <strlen>
+  801f71:	83 c4 10             	add    $0x10,%esp
+  801f74:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f79:	7f 4c                	jg     801fc7 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  801f7b:	83 ec 08             	sub    $0x8,%esp
+  801f7e:	57                   	push   %edi
+  801f7f:	68 00 60 80 00       	push   $0x806000
+  801f84:	e8 f9 e1 ff ff       	call   800182 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  801f89:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f8e:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f93:	e8 ac f1 ff ff       	call   801144 <fsipc>
+  801f98:	83 c4 10             	add    $0x10,%esp
+  801f9b:	85 c0                	test   %eax,%eax
+  801f9d:	78 20                	js     801fbf <defrag+0x66>
+		return r;
+	if (before)
+  801f9f:	85 f6                	test   %esi,%esi
+  801fa1:	74 07                	je     801faa <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  801fa3:	a1 00 60 80 00       	mov    0x806000,%eax
+  801fa8:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  801faa:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  801faf:	85 db                	test   %ebx,%ebx
+  801fb1:	74 0c                	je     801fbf <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  801fb3:	a1 04 60 80 00       	mov    0x806004,%eax
+  801fb8:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  801fba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc2:	5b                   	pop    %ebx
+  801fc3:	5e                   	pop    %esi
+  801fc4:	5f                   	pop    %edi
+  801fc5:	5d                   	pop    %ebp
+  801fc6:	c3                   	ret
+		return -E_BAD_PATH;
+  801fc7:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801fcc:	eb f1                	jmp    801fbf <defrag+0x66>
+
+00801fce <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  801fce:	55                   	push   %ebp
+  801fcf:	89 e5                	mov    %esp,%ebp
+  801fd1:	53                   	push   %ebx
+  801fd2:	83 ec 04             	sub    $0x4,%esp
+  801fd5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  801fd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fdd:	b8 11 00 00 00       	mov    $0x11,%eax
+  801fe2:	e8 5d f1 ff ff       	call   801144 <fsipc>
+  801fe7:	85 c0                	test   %eax,%eax
+  801fe9:	78 34                	js     80201f <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  801feb:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ff0:	89 03                	mov    %eax,(%ebx)
+  801ff2:	a1 04 60 80 00       	mov    0x806004,%eax
+  801ff7:	89 43 04             	mov    %eax,0x4(%ebx)
+  801ffa:	a1 08 60 80 00       	mov    0x806008,%eax
+  801fff:	89 43 08             	mov    %eax,0x8(%ebx)
+  802002:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  802007:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80200a:	a1 10 60 80 00       	mov    0x806010,%eax
+  80200f:	89 43 10             	mov    %eax,0x10(%ebx)
+  802012:	a1 14 60 80 00       	mov    0x806014,%eax
+  802017:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  80201a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80201f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802022:	c9                   	leave
+  802023:	c3                   	ret
+
+00802024 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802024:	55                   	push   %ebp
+  802025:	89 e5                	mov    %esp,%ebp
+  802027:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80202a:	68 3e 39 80 00       	push   $0x80393e
+  80202f:	ff 75 0c             	push   0xc(%ebp)
+  802032:	e8 4b e1 ff ff       	call   800182 <strcpy>
+	return 0;
+}
+  802037:	b8 00 00 00 00       	mov    $0x0,%eax
+  80203c:	c9                   	leave
+  80203d:	c3                   	ret
+
+0080203e <devsock_close>:
+{
+  80203e:	55                   	push   %ebp
+  80203f:	89 e5                	mov    %esp,%ebp
+  802041:	53                   	push   %ebx
+  802042:	83 ec 10             	sub    $0x10,%esp
+  802045:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802048:	53                   	push   %ebx
+  802049:	e8 82 14 00 00       	call   8034d0 <pageref>
+  80204e:	89 c2                	mov    %eax,%edx
+  802050:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802053:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802058:	83 fa 01             	cmp    $0x1,%edx
+  80205b:	74 05                	je     802062 <devsock_close+0x24>
+}
+  80205d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802060:	c9                   	leave
+  802061:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802062:	83 ec 0c             	sub    $0xc,%esp
+  802065:	ff 73 0c             	push   0xc(%ebx)
+  802068:	e8 b7 02 00 00       	call   802324 <nsipc_close>
+  80206d:	83 c4 10             	add    $0x10,%esp
+  802070:	eb eb                	jmp    80205d <devsock_close+0x1f>
+
+00802072 <devsock_write>:
+{
+  802072:	55                   	push   %ebp
+  802073:	89 e5                	mov    %esp,%ebp
+  802075:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802078:	6a 00                	push   $0x0
+  80207a:	ff 75 10             	push   0x10(%ebp)
+  80207d:	ff 75 0c             	push   0xc(%ebp)
+  802080:	8b 45 08             	mov    0x8(%ebp),%eax
+  802083:	ff 70 0c             	push   0xc(%eax)
+  802086:	e8 79 03 00 00       	call   802404 <nsipc_send>
+}
+  80208b:	c9                   	leave
+  80208c:	c3                   	ret
+
+0080208d <devsock_read>:
+{
+  80208d:	55                   	push   %ebp
+  80208e:	89 e5                	mov    %esp,%ebp
+  802090:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802093:	6a 00                	push   $0x0
+  802095:	ff 75 10             	push   0x10(%ebp)
+  802098:	ff 75 0c             	push   0xc(%ebp)
+  80209b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80209e:	ff 70 0c             	push   0xc(%eax)
+  8020a1:	e8 ef 02 00 00       	call   802395 <nsipc_recv>
+}
+  8020a6:	c9                   	leave
+  8020a7:	c3                   	ret
+
+008020a8 <fd2sockid>:
+{
+  8020a8:	55                   	push   %ebp
+  8020a9:	89 e5                	mov    %esp,%ebp
+  8020ab:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8020ae:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8020b1:	52                   	push   %edx
+  8020b2:	50                   	push   %eax
+  8020b3:	e8 54 e9 ff ff       	call   800a0c <fd_lookup>
+  8020b8:	83 c4 10             	add    $0x10,%esp
+  8020bb:	85 c0                	test   %eax,%eax
+  8020bd:	78 10                	js     8020cf <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8020bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020c2:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  8020c8:	39 08                	cmp    %ecx,(%eax)
+  8020ca:	75 05                	jne    8020d1 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8020cc:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8020cf:	c9                   	leave
+  8020d0:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020d1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020d6:	eb f7                	jmp    8020cf <fd2sockid+0x27>
+
+008020d8 <alloc_sockfd>:
+{
+  8020d8:	55                   	push   %ebp
+  8020d9:	89 e5                	mov    %esp,%ebp
+  8020db:	56                   	push   %esi
+  8020dc:	53                   	push   %ebx
+  8020dd:	83 ec 1c             	sub    $0x1c,%esp
+  8020e0:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8020e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020e5:	50                   	push   %eax
+  8020e6:	e8 cb e8 ff ff       	call   8009b6 <fd_alloc>
+  8020eb:	89 c3                	mov    %eax,%ebx
+  8020ed:	83 c4 10             	add    $0x10,%esp
+  8020f0:	85 c0                	test   %eax,%eax
+  8020f2:	78 43                	js     802137 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8020f4:	83 ec 04             	sub    $0x4,%esp
+  8020f7:	68 07 04 00 00       	push   $0x407
+  8020fc:	ff 75 f4             	push   -0xc(%ebp)
+  8020ff:	6a 00                	push   $0x0
+  802101:	e8 88 e4 ff ff       	call   80058e <sys_page_alloc>
+  802106:	89 c3                	mov    %eax,%ebx
+  802108:	83 c4 10             	add    $0x10,%esp
+  80210b:	85 c0                	test   %eax,%eax
+  80210d:	78 28                	js     802137 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80210f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802112:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802118:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80211a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80211d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802124:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802127:	83 ec 0c             	sub    $0xc,%esp
+  80212a:	50                   	push   %eax
+  80212b:	e8 5f e8 ff ff       	call   80098f <fd2num>
+  802130:	89 c3                	mov    %eax,%ebx
+  802132:	83 c4 10             	add    $0x10,%esp
+  802135:	eb 0c                	jmp    802143 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802137:	83 ec 0c             	sub    $0xc,%esp
+  80213a:	56                   	push   %esi
+  80213b:	e8 e4 01 00 00       	call   802324 <nsipc_close>
+		return r;
+  802140:	83 c4 10             	add    $0x10,%esp
+}
+  802143:	89 d8                	mov    %ebx,%eax
+  802145:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802148:	5b                   	pop    %ebx
+  802149:	5e                   	pop    %esi
+  80214a:	5d                   	pop    %ebp
+  80214b:	c3                   	ret
+
+0080214c <accept>:
+{
+  80214c:	55                   	push   %ebp
+  80214d:	89 e5                	mov    %esp,%ebp
+  80214f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802152:	8b 45 08             	mov    0x8(%ebp),%eax
+  802155:	e8 4e ff ff ff       	call   8020a8 <fd2sockid>
+  80215a:	85 c0                	test   %eax,%eax
+  80215c:	78 1b                	js     802179 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80215e:	83 ec 04             	sub    $0x4,%esp
+  802161:	ff 75 10             	push   0x10(%ebp)
+  802164:	ff 75 0c             	push   0xc(%ebp)
+  802167:	50                   	push   %eax
+  802168:	e8 0e 01 00 00       	call   80227b <nsipc_accept>
+  80216d:	83 c4 10             	add    $0x10,%esp
+  802170:	85 c0                	test   %eax,%eax
+  802172:	78 05                	js     802179 <accept+0x2d>
+	return alloc_sockfd(r);
+  802174:	e8 5f ff ff ff       	call   8020d8 <alloc_sockfd>
+}
+  802179:	c9                   	leave
+  80217a:	c3                   	ret
+
+0080217b <bind>:
+{
+  80217b:	55                   	push   %ebp
+  80217c:	89 e5                	mov    %esp,%ebp
+  80217e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802181:	8b 45 08             	mov    0x8(%ebp),%eax
+  802184:	e8 1f ff ff ff       	call   8020a8 <fd2sockid>
+  802189:	85 c0                	test   %eax,%eax
+  80218b:	78 12                	js     80219f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80218d:	83 ec 04             	sub    $0x4,%esp
+  802190:	ff 75 10             	push   0x10(%ebp)
+  802193:	ff 75 0c             	push   0xc(%ebp)
+  802196:	50                   	push   %eax
+  802197:	e8 31 01 00 00       	call   8022cd <nsipc_bind>
+  80219c:	83 c4 10             	add    $0x10,%esp
+}
+  80219f:	c9                   	leave
+  8021a0:	c3                   	ret
+
+008021a1 <shutdown>:
+{
+  8021a1:	55                   	push   %ebp
+  8021a2:	89 e5                	mov    %esp,%ebp
+  8021a4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021aa:	e8 f9 fe ff ff       	call   8020a8 <fd2sockid>
+  8021af:	85 c0                	test   %eax,%eax
+  8021b1:	78 0f                	js     8021c2 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8021b3:	83 ec 08             	sub    $0x8,%esp
+  8021b6:	ff 75 0c             	push   0xc(%ebp)
+  8021b9:	50                   	push   %eax
+  8021ba:	e8 43 01 00 00       	call   802302 <nsipc_shutdown>
+  8021bf:	83 c4 10             	add    $0x10,%esp
+}
+  8021c2:	c9                   	leave
+  8021c3:	c3                   	ret
+
+008021c4 <connect>:
+{
+  8021c4:	55                   	push   %ebp
+  8021c5:	89 e5                	mov    %esp,%ebp
+  8021c7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021cd:	e8 d6 fe ff ff       	call   8020a8 <fd2sockid>
+  8021d2:	85 c0                	test   %eax,%eax
+  8021d4:	78 12                	js     8021e8 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8021d6:	83 ec 04             	sub    $0x4,%esp
+  8021d9:	ff 75 10             	push   0x10(%ebp)
+  8021dc:	ff 75 0c             	push   0xc(%ebp)
+  8021df:	50                   	push   %eax
+  8021e0:	e8 59 01 00 00       	call   80233e <nsipc_connect>
+  8021e5:	83 c4 10             	add    $0x10,%esp
+}
+  8021e8:	c9                   	leave
+  8021e9:	c3                   	ret
+
+008021ea <listen>:
+{
+  8021ea:	55                   	push   %ebp
+  8021eb:	89 e5                	mov    %esp,%ebp
+  8021ed:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f3:	e8 b0 fe ff ff       	call   8020a8 <fd2sockid>
+  8021f8:	85 c0                	test   %eax,%eax
+  8021fa:	78 0f                	js     80220b <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8021fc:	83 ec 08             	sub    $0x8,%esp
+  8021ff:	ff 75 0c             	push   0xc(%ebp)
+  802202:	50                   	push   %eax
+  802203:	e8 6b 01 00 00       	call   802373 <nsipc_listen>
+  802208:	83 c4 10             	add    $0x10,%esp
+}
+  80220b:	c9                   	leave
+  80220c:	c3                   	ret
+
+0080220d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80220d:	55                   	push   %ebp
+  80220e:	89 e5                	mov    %esp,%ebp
+  802210:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802213:	ff 75 10             	push   0x10(%ebp)
+  802216:	ff 75 0c             	push   0xc(%ebp)
+  802219:	ff 75 08             	push   0x8(%ebp)
+  80221c:	e8 41 02 00 00       	call   802462 <nsipc_socket>
+  802221:	83 c4 10             	add    $0x10,%esp
+  802224:	85 c0                	test   %eax,%eax
+  802226:	78 05                	js     80222d <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802228:	e8 ab fe ff ff       	call   8020d8 <alloc_sockfd>
+}
+  80222d:	c9                   	leave
+  80222e:	c3                   	ret
+
+0080222f <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80222f:	55                   	push   %ebp
+  802230:	89 e5                	mov    %esp,%ebp
+  802232:	53                   	push   %ebx
+  802233:	83 ec 04             	sub    $0x4,%esp
+  802236:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802238:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80223f:	74 26                	je     802267 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802241:	6a 07                	push   $0x7
+  802243:	68 00 80 80 00       	push   $0x808000
+  802248:	53                   	push   %ebx
+  802249:	ff 35 00 90 80 00    	push   0x809000
+  80224f:	e8 04 11 00 00       	call   803358 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802254:	83 c4 0c             	add    $0xc,%esp
+  802257:	6a 00                	push   $0x0
+  802259:	6a 00                	push   $0x0
+  80225b:	6a 00                	push   $0x0
+  80225d:	e8 8b 10 00 00       	call   8032ed <ipc_recv>
+}
+  802262:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802265:	c9                   	leave
+  802266:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802267:	83 ec 0c             	sub    $0xc,%esp
+  80226a:	6a 02                	push   $0x2
+  80226c:	e8 20 12 00 00       	call   803491 <ipc_find_env>
+  802271:	a3 00 90 80 00       	mov    %eax,0x809000
+  802276:	83 c4 10             	add    $0x10,%esp
+  802279:	eb c6                	jmp    802241 <nsipc+0x12>
+
+0080227b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80227b:	55                   	push   %ebp
+  80227c:	89 e5                	mov    %esp,%ebp
+  80227e:	56                   	push   %esi
+  80227f:	53                   	push   %ebx
+  802280:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802283:	8b 45 08             	mov    0x8(%ebp),%eax
+  802286:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80228b:	8b 06                	mov    (%esi),%eax
+  80228d:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802292:	b8 01 00 00 00       	mov    $0x1,%eax
+  802297:	e8 93 ff ff ff       	call   80222f <nsipc>
+  80229c:	89 c3                	mov    %eax,%ebx
+  80229e:	85 c0                	test   %eax,%eax
+  8022a0:	79 09                	jns    8022ab <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8022a2:	89 d8                	mov    %ebx,%eax
+  8022a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022a7:	5b                   	pop    %ebx
+  8022a8:	5e                   	pop    %esi
+  8022a9:	5d                   	pop    %ebp
+  8022aa:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8022ab:	83 ec 04             	sub    $0x4,%esp
+  8022ae:	ff 35 10 80 80 00    	push   0x808010
+  8022b4:	68 00 80 80 00       	push   $0x808000
+  8022b9:	ff 75 0c             	push   0xc(%ebp)
+  8022bc:	e8 47 e0 ff ff       	call   800308 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8022c1:	a1 10 80 80 00       	mov    0x808010,%eax
+  8022c6:	89 06                	mov    %eax,(%esi)
+  8022c8:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8022cb:	eb d5                	jmp    8022a2 <nsipc_accept+0x27>
+
+008022cd <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8022cd:	55                   	push   %ebp
+  8022ce:	89 e5                	mov    %esp,%ebp
+  8022d0:	53                   	push   %ebx
+  8022d1:	83 ec 08             	sub    $0x8,%esp
+  8022d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022da:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022df:	53                   	push   %ebx
+  8022e0:	ff 75 0c             	push   0xc(%ebp)
+  8022e3:	68 04 80 80 00       	push   $0x808004
+  8022e8:	e8 1b e0 ff ff       	call   800308 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8022ed:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8022f3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022f8:	e8 32 ff ff ff       	call   80222f <nsipc>
+}
+  8022fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802300:	c9                   	leave
+  802301:	c3                   	ret
+
+00802302 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802302:	55                   	push   %ebp
+  802303:	89 e5                	mov    %esp,%ebp
+  802305:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802308:	8b 45 08             	mov    0x8(%ebp),%eax
+  80230b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802310:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802313:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802318:	b8 03 00 00 00       	mov    $0x3,%eax
+  80231d:	e8 0d ff ff ff       	call   80222f <nsipc>
+}
+  802322:	c9                   	leave
+  802323:	c3                   	ret
+
+00802324 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802324:	55                   	push   %ebp
+  802325:	89 e5                	mov    %esp,%ebp
+  802327:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80232a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232d:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802332:	b8 04 00 00 00       	mov    $0x4,%eax
+  802337:	e8 f3 fe ff ff       	call   80222f <nsipc>
+}
+  80233c:	c9                   	leave
+  80233d:	c3                   	ret
+
+0080233e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80233e:	55                   	push   %ebp
+  80233f:	89 e5                	mov    %esp,%ebp
+  802341:	53                   	push   %ebx
+  802342:	83 ec 08             	sub    $0x8,%esp
+  802345:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802348:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234b:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802350:	53                   	push   %ebx
+  802351:	ff 75 0c             	push   0xc(%ebp)
+  802354:	68 04 80 80 00       	push   $0x808004
+  802359:	e8 aa df ff ff       	call   800308 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80235e:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802364:	b8 05 00 00 00       	mov    $0x5,%eax
+  802369:	e8 c1 fe ff ff       	call   80222f <nsipc>
+}
+  80236e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802371:	c9                   	leave
+  802372:	c3                   	ret
+
+00802373 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802373:	55                   	push   %ebp
+  802374:	89 e5                	mov    %esp,%ebp
+  802376:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802379:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802381:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802384:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802389:	b8 06 00 00 00       	mov    $0x6,%eax
+  80238e:	e8 9c fe ff ff       	call   80222f <nsipc>
+}
+  802393:	c9                   	leave
+  802394:	c3                   	ret
+
+00802395 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802395:	55                   	push   %ebp
+  802396:	89 e5                	mov    %esp,%ebp
+  802398:	56                   	push   %esi
+  802399:	53                   	push   %ebx
+  80239a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80239d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a0:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8023a5:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8023ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023ae:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8023b3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023b8:	e8 72 fe ff ff       	call   80222f <nsipc>
+  8023bd:	89 c3                	mov    %eax,%ebx
+  8023bf:	85 c0                	test   %eax,%eax
+  8023c1:	78 22                	js     8023e5 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8023c3:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8023c8:	39 c6                	cmp    %eax,%esi
+  8023ca:	0f 4e c6             	cmovle %esi,%eax
+  8023cd:	39 c3                	cmp    %eax,%ebx
+  8023cf:	7f 1d                	jg     8023ee <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023d1:	83 ec 04             	sub    $0x4,%esp
+  8023d4:	53                   	push   %ebx
+  8023d5:	68 00 80 80 00       	push   $0x808000
+  8023da:	ff 75 0c             	push   0xc(%ebp)
+  8023dd:	e8 26 df ff ff       	call   800308 <memmove>
+  8023e2:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8023e5:	89 d8                	mov    %ebx,%eax
+  8023e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023ea:	5b                   	pop    %ebx
+  8023eb:	5e                   	pop    %esi
+  8023ec:	5d                   	pop    %ebp
+  8023ed:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8023ee:	68 4a 39 80 00       	push   $0x80394a
+  8023f3:	68 e8 38 80 00       	push   $0x8038e8
+  8023f8:	6a 62                	push   $0x62
+  8023fa:	68 5f 39 80 00       	push   $0x80395f
+  8023ff:	e8 46 05 00 00       	call   80294a <_panic>
+
+00802404 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802404:	55                   	push   %ebp
+  802405:	89 e5                	mov    %esp,%ebp
+  802407:	53                   	push   %ebx
+  802408:	83 ec 04             	sub    $0x4,%esp
+  80240b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80240e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802411:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802416:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80241c:	7f 2e                	jg     80244c <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80241e:	83 ec 04             	sub    $0x4,%esp
+  802421:	53                   	push   %ebx
+  802422:	ff 75 0c             	push   0xc(%ebp)
+  802425:	68 0c 80 80 00       	push   $0x80800c
+  80242a:	e8 d9 de ff ff       	call   800308 <memmove>
+	nsipcbuf.send.req_size = size;
+  80242f:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802435:	8b 45 14             	mov    0x14(%ebp),%eax
+  802438:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  80243d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802442:	e8 e8 fd ff ff       	call   80222f <nsipc>
+}
+  802447:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80244a:	c9                   	leave
+  80244b:	c3                   	ret
+	assert(size < 1600);
+  80244c:	68 6b 39 80 00       	push   $0x80396b
+  802451:	68 e8 38 80 00       	push   $0x8038e8
+  802456:	6a 6d                	push   $0x6d
+  802458:	68 5f 39 80 00       	push   $0x80395f
+  80245d:	e8 e8 04 00 00       	call   80294a <_panic>
+
+00802462 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802462:	55                   	push   %ebp
+  802463:	89 e5                	mov    %esp,%ebp
+  802465:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802468:	8b 45 08             	mov    0x8(%ebp),%eax
+  80246b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802470:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802473:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802478:	8b 45 10             	mov    0x10(%ebp),%eax
+  80247b:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802480:	b8 09 00 00 00       	mov    $0x9,%eax
+  802485:	e8 a5 fd ff ff       	call   80222f <nsipc>
+}
+  80248a:	c9                   	leave
+  80248b:	c3                   	ret
+
+0080248c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80248c:	55                   	push   %ebp
+  80248d:	89 e5                	mov    %esp,%ebp
+  80248f:	56                   	push   %esi
+  802490:	53                   	push   %ebx
+  802491:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802494:	83 ec 0c             	sub    $0xc,%esp
+  802497:	ff 75 08             	push   0x8(%ebp)
+  80249a:	e8 00 e5 ff ff       	call   80099f <fd2data>
+  80249f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8024a1:	83 c4 08             	add    $0x8,%esp
+  8024a4:	68 77 39 80 00       	push   $0x803977
+  8024a9:	53                   	push   %ebx
+  8024aa:	e8 d3 dc ff ff       	call   800182 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8024af:	8b 46 04             	mov    0x4(%esi),%eax
+  8024b2:	2b 06                	sub    (%esi),%eax
+  8024b4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8024ba:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024c1:	00 00 00 
+	stat->st_dev = &devpipe;
+  8024c4:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  8024cb:	40 80 00 
+	return 0;
+}
+  8024ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024d6:	5b                   	pop    %ebx
+  8024d7:	5e                   	pop    %esi
+  8024d8:	5d                   	pop    %ebp
+  8024d9:	c3                   	ret
+
+008024da <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024da:	55                   	push   %ebp
+  8024db:	89 e5                	mov    %esp,%ebp
+  8024dd:	53                   	push   %ebx
+  8024de:	83 ec 0c             	sub    $0xc,%esp
+  8024e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8024e4:	53                   	push   %ebx
+  8024e5:	6a 00                	push   $0x0
+  8024e7:	e8 2f e1 ff ff       	call   80061b <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8024ec:	89 1c 24             	mov    %ebx,(%esp)
+  8024ef:	e8 ab e4 ff ff       	call   80099f <fd2data>
+  8024f4:	83 c4 08             	add    $0x8,%esp
+  8024f7:	50                   	push   %eax
+  8024f8:	6a 00                	push   $0x0
+  8024fa:	e8 1c e1 ff ff       	call   80061b <sys_page_unmap>
+}
+  8024ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802502:	c9                   	leave
+  802503:	c3                   	ret
+
+00802504 <_pipeisclosed>:
+{
+  802504:	55                   	push   %ebp
+  802505:	89 e5                	mov    %esp,%ebp
+  802507:	57                   	push   %edi
+  802508:	56                   	push   %esi
+  802509:	53                   	push   %ebx
+  80250a:	83 ec 1c             	sub    $0x1c,%esp
+  80250d:	89 c7                	mov    %eax,%edi
+  80250f:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802511:	a1 00 50 80 00       	mov    0x805000,%eax
+  802516:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802519:	83 ec 0c             	sub    $0xc,%esp
+  80251c:	57                   	push   %edi
+  80251d:	e8 ae 0f 00 00       	call   8034d0 <pageref>
+  802522:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802525:	89 34 24             	mov    %esi,(%esp)
+  802528:	e8 a3 0f 00 00       	call   8034d0 <pageref>
+		nn = thisenv->env_runs;
+  80252d:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802533:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802536:	83 c4 10             	add    $0x10,%esp
+  802539:	39 cb                	cmp    %ecx,%ebx
+  80253b:	74 1b                	je     802558 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80253d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802540:	75 cf                	jne    802511 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802542:	8b 42 58             	mov    0x58(%edx),%eax
+  802545:	6a 01                	push   $0x1
+  802547:	50                   	push   %eax
+  802548:	53                   	push   %ebx
+  802549:	68 7e 39 80 00       	push   $0x80397e
+  80254e:	e8 d2 04 00 00       	call   802a25 <cprintf>
+  802553:	83 c4 10             	add    $0x10,%esp
+  802556:	eb b9                	jmp    802511 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802558:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80255b:	0f 94 c0             	sete   %al
+  80255e:	0f b6 c0             	movzbl %al,%eax
+}
+  802561:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802564:	5b                   	pop    %ebx
+  802565:	5e                   	pop    %esi
+  802566:	5f                   	pop    %edi
+  802567:	5d                   	pop    %ebp
+  802568:	c3                   	ret
+
+00802569 <devpipe_write>:
+{
+  802569:	55                   	push   %ebp
+  80256a:	89 e5                	mov    %esp,%ebp
+  80256c:	57                   	push   %edi
+  80256d:	56                   	push   %esi
+  80256e:	53                   	push   %ebx
+  80256f:	83 ec 28             	sub    $0x28,%esp
+  802572:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802575:	56                   	push   %esi
+  802576:	e8 24 e4 ff ff       	call   80099f <fd2data>
+  80257b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80257d:	83 c4 10             	add    $0x10,%esp
+  802580:	bf 00 00 00 00       	mov    $0x0,%edi
+  802585:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802588:	75 09                	jne    802593 <devpipe_write+0x2a>
+	return i;
+  80258a:	89 f8                	mov    %edi,%eax
+  80258c:	eb 23                	jmp    8025b1 <devpipe_write+0x48>
+			sys_yield();
+  80258e:	e8 dc df ff ff       	call   80056f <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802593:	8b 43 04             	mov    0x4(%ebx),%eax
+  802596:	8b 0b                	mov    (%ebx),%ecx
+  802598:	8d 51 20             	lea    0x20(%ecx),%edx
+  80259b:	39 d0                	cmp    %edx,%eax
+  80259d:	72 1a                	jb     8025b9 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80259f:	89 da                	mov    %ebx,%edx
+  8025a1:	89 f0                	mov    %esi,%eax
+  8025a3:	e8 5c ff ff ff       	call   802504 <_pipeisclosed>
+  8025a8:	85 c0                	test   %eax,%eax
+  8025aa:	74 e2                	je     80258e <devpipe_write+0x25>
+				return 0;
+  8025ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025b4:	5b                   	pop    %ebx
+  8025b5:	5e                   	pop    %esi
+  8025b6:	5f                   	pop    %edi
+  8025b7:	5d                   	pop    %ebp
+  8025b8:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025bc:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8025c0:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8025c3:	89 c2                	mov    %eax,%edx
+  8025c5:	c1 fa 1f             	sar    $0x1f,%edx
+  8025c8:	89 d1                	mov    %edx,%ecx
+  8025ca:	c1 e9 1b             	shr    $0x1b,%ecx
+  8025cd:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8025d0:	83 e2 1f             	and    $0x1f,%edx
+  8025d3:	29 ca                	sub    %ecx,%edx
+  8025d5:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8025d9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8025dd:	83 c0 01             	add    $0x1,%eax
+  8025e0:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8025e3:	83 c7 01             	add    $0x1,%edi
+  8025e6:	eb 9d                	jmp    802585 <devpipe_write+0x1c>
+
+008025e8 <devpipe_read>:
+{
+  8025e8:	55                   	push   %ebp
+  8025e9:	89 e5                	mov    %esp,%ebp
+  8025eb:	57                   	push   %edi
+  8025ec:	56                   	push   %esi
+  8025ed:	53                   	push   %ebx
+  8025ee:	83 ec 18             	sub    $0x18,%esp
+  8025f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8025f4:	57                   	push   %edi
+  8025f5:	e8 a5 e3 ff ff       	call   80099f <fd2data>
+  8025fa:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8025fc:	83 c4 10             	add    $0x10,%esp
+  8025ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802604:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802607:	75 13                	jne    80261c <devpipe_read+0x34>
+	return i;
+  802609:	89 f0                	mov    %esi,%eax
+  80260b:	eb 02                	jmp    80260f <devpipe_read+0x27>
+				return i;
+  80260d:	89 f0                	mov    %esi,%eax
+}
+  80260f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802612:	5b                   	pop    %ebx
+  802613:	5e                   	pop    %esi
+  802614:	5f                   	pop    %edi
+  802615:	5d                   	pop    %ebp
+  802616:	c3                   	ret
+			sys_yield();
+  802617:	e8 53 df ff ff       	call   80056f <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80261c:	8b 03                	mov    (%ebx),%eax
+  80261e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802621:	75 18                	jne    80263b <devpipe_read+0x53>
+			if (i > 0)
+  802623:	85 f6                	test   %esi,%esi
+  802625:	75 e6                	jne    80260d <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802627:	89 da                	mov    %ebx,%edx
+  802629:	89 f8                	mov    %edi,%eax
+  80262b:	e8 d4 fe ff ff       	call   802504 <_pipeisclosed>
+  802630:	85 c0                	test   %eax,%eax
+  802632:	74 e3                	je     802617 <devpipe_read+0x2f>
+				return 0;
+  802634:	b8 00 00 00 00       	mov    $0x0,%eax
+  802639:	eb d4                	jmp    80260f <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80263b:	99                   	cltd
+  80263c:	c1 ea 1b             	shr    $0x1b,%edx
+  80263f:	01 d0                	add    %edx,%eax
+  802641:	83 e0 1f             	and    $0x1f,%eax
+  802644:	29 d0                	sub    %edx,%eax
+  802646:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80264b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80264e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802651:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802654:	83 c6 01             	add    $0x1,%esi
+  802657:	eb ab                	jmp    802604 <devpipe_read+0x1c>
+
+00802659 <pipe>:
+{
+  802659:	55                   	push   %ebp
+  80265a:	89 e5                	mov    %esp,%ebp
+  80265c:	56                   	push   %esi
+  80265d:	53                   	push   %ebx
+  80265e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802661:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802664:	50                   	push   %eax
+  802665:	e8 4c e3 ff ff       	call   8009b6 <fd_alloc>
+  80266a:	89 c3                	mov    %eax,%ebx
+  80266c:	83 c4 10             	add    $0x10,%esp
+  80266f:	85 c0                	test   %eax,%eax
+  802671:	0f 88 23 01 00 00    	js     80279a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802677:	83 ec 04             	sub    $0x4,%esp
+  80267a:	68 07 04 00 00       	push   $0x407
+  80267f:	ff 75 f4             	push   -0xc(%ebp)
+  802682:	6a 00                	push   $0x0
+  802684:	e8 05 df ff ff       	call   80058e <sys_page_alloc>
+  802689:	89 c3                	mov    %eax,%ebx
+  80268b:	83 c4 10             	add    $0x10,%esp
+  80268e:	85 c0                	test   %eax,%eax
+  802690:	0f 88 04 01 00 00    	js     80279a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802696:	83 ec 0c             	sub    $0xc,%esp
+  802699:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80269c:	50                   	push   %eax
+  80269d:	e8 14 e3 ff ff       	call   8009b6 <fd_alloc>
+  8026a2:	89 c3                	mov    %eax,%ebx
+  8026a4:	83 c4 10             	add    $0x10,%esp
+  8026a7:	85 c0                	test   %eax,%eax
+  8026a9:	0f 88 db 00 00 00    	js     80278a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026af:	83 ec 04             	sub    $0x4,%esp
+  8026b2:	68 07 04 00 00       	push   $0x407
+  8026b7:	ff 75 f0             	push   -0x10(%ebp)
+  8026ba:	6a 00                	push   $0x0
+  8026bc:	e8 cd de ff ff       	call   80058e <sys_page_alloc>
+  8026c1:	89 c3                	mov    %eax,%ebx
+  8026c3:	83 c4 10             	add    $0x10,%esp
+  8026c6:	85 c0                	test   %eax,%eax
+  8026c8:	0f 88 bc 00 00 00    	js     80278a <pipe+0x131>
+	va = fd2data(fd0);
+  8026ce:	83 ec 0c             	sub    $0xc,%esp
+  8026d1:	ff 75 f4             	push   -0xc(%ebp)
+  8026d4:	e8 c6 e2 ff ff       	call   80099f <fd2data>
+  8026d9:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026db:	83 c4 0c             	add    $0xc,%esp
+  8026de:	68 07 04 00 00       	push   $0x407
+  8026e3:	50                   	push   %eax
+  8026e4:	6a 00                	push   $0x0
+  8026e6:	e8 a3 de ff ff       	call   80058e <sys_page_alloc>
+  8026eb:	89 c3                	mov    %eax,%ebx
+  8026ed:	83 c4 10             	add    $0x10,%esp
+  8026f0:	85 c0                	test   %eax,%eax
+  8026f2:	0f 88 82 00 00 00    	js     80277a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026f8:	83 ec 0c             	sub    $0xc,%esp
+  8026fb:	ff 75 f0             	push   -0x10(%ebp)
+  8026fe:	e8 9c e2 ff ff       	call   80099f <fd2data>
+  802703:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80270a:	50                   	push   %eax
+  80270b:	6a 00                	push   $0x0
+  80270d:	56                   	push   %esi
+  80270e:	6a 00                	push   $0x0
+  802710:	e8 c4 de ff ff       	call   8005d9 <sys_page_map>
+  802715:	89 c3                	mov    %eax,%ebx
+  802717:	83 c4 20             	add    $0x20,%esp
+  80271a:	85 c0                	test   %eax,%eax
+  80271c:	78 4e                	js     80276c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80271e:	a1 60 40 80 00       	mov    0x804060,%eax
+  802723:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802726:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802728:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80272b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802732:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802735:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802737:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80273a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802741:	83 ec 0c             	sub    $0xc,%esp
+  802744:	ff 75 f4             	push   -0xc(%ebp)
+  802747:	e8 43 e2 ff ff       	call   80098f <fd2num>
+  80274c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80274f:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802751:	83 c4 04             	add    $0x4,%esp
+  802754:	ff 75 f0             	push   -0x10(%ebp)
+  802757:	e8 33 e2 ff ff       	call   80098f <fd2num>
+  80275c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80275f:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802762:	83 c4 10             	add    $0x10,%esp
+  802765:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80276a:	eb 2e                	jmp    80279a <pipe+0x141>
+	sys_page_unmap(0, va);
+  80276c:	83 ec 08             	sub    $0x8,%esp
+  80276f:	56                   	push   %esi
+  802770:	6a 00                	push   $0x0
+  802772:	e8 a4 de ff ff       	call   80061b <sys_page_unmap>
+  802777:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80277a:	83 ec 08             	sub    $0x8,%esp
+  80277d:	ff 75 f0             	push   -0x10(%ebp)
+  802780:	6a 00                	push   $0x0
+  802782:	e8 94 de ff ff       	call   80061b <sys_page_unmap>
+  802787:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80278a:	83 ec 08             	sub    $0x8,%esp
+  80278d:	ff 75 f4             	push   -0xc(%ebp)
+  802790:	6a 00                	push   $0x0
+  802792:	e8 84 de ff ff       	call   80061b <sys_page_unmap>
+  802797:	83 c4 10             	add    $0x10,%esp
+}
+  80279a:	89 d8                	mov    %ebx,%eax
+  80279c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80279f:	5b                   	pop    %ebx
+  8027a0:	5e                   	pop    %esi
+  8027a1:	5d                   	pop    %ebp
+  8027a2:	c3                   	ret
+
+008027a3 <pipeisclosed>:
+{
+  8027a3:	55                   	push   %ebp
+  8027a4:	89 e5                	mov    %esp,%ebp
+  8027a6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027ac:	50                   	push   %eax
+  8027ad:	ff 75 08             	push   0x8(%ebp)
+  8027b0:	e8 57 e2 ff ff       	call   800a0c <fd_lookup>
+  8027b5:	83 c4 10             	add    $0x10,%esp
+  8027b8:	85 c0                	test   %eax,%eax
+  8027ba:	78 18                	js     8027d4 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8027bc:	83 ec 0c             	sub    $0xc,%esp
+  8027bf:	ff 75 f4             	push   -0xc(%ebp)
+  8027c2:	e8 d8 e1 ff ff       	call   80099f <fd2data>
+  8027c7:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8027c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027cc:	e8 33 fd ff ff       	call   802504 <_pipeisclosed>
+  8027d1:	83 c4 10             	add    $0x10,%esp
+}
+  8027d4:	c9                   	leave
+  8027d5:	c3                   	ret
+
+008027d6 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8027d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027db:	c3                   	ret
+
+008027dc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8027dc:	55                   	push   %ebp
+  8027dd:	89 e5                	mov    %esp,%ebp
+  8027df:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8027e2:	68 96 39 80 00       	push   $0x803996
+  8027e7:	ff 75 0c             	push   0xc(%ebp)
+  8027ea:	e8 93 d9 ff ff       	call   800182 <strcpy>
+	return 0;
+}
+  8027ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f4:	c9                   	leave
+  8027f5:	c3                   	ret
+
+008027f6 <devcons_write>:
+{
+  8027f6:	55                   	push   %ebp
+  8027f7:	89 e5                	mov    %esp,%ebp
+  8027f9:	57                   	push   %edi
+  8027fa:	56                   	push   %esi
+  8027fb:	53                   	push   %ebx
+  8027fc:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802802:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802807:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80280d:	eb 2e                	jmp    80283d <devcons_write+0x47>
+		m = n - tot;
+  80280f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802812:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802814:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802819:	39 c3                	cmp    %eax,%ebx
+  80281b:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80281e:	83 ec 04             	sub    $0x4,%esp
+  802821:	53                   	push   %ebx
+  802822:	89 f0                	mov    %esi,%eax
+  802824:	03 45 0c             	add    0xc(%ebp),%eax
+  802827:	50                   	push   %eax
+  802828:	57                   	push   %edi
+  802829:	e8 da da ff ff       	call   800308 <memmove>
+		sys_cputs(buf, m);
+  80282e:	83 c4 08             	add    $0x8,%esp
+  802831:	53                   	push   %ebx
+  802832:	57                   	push   %edi
+  802833:	e8 7a dc ff ff       	call   8004b2 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802838:	01 de                	add    %ebx,%esi
+  80283a:	83 c4 10             	add    $0x10,%esp
+  80283d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802840:	72 cd                	jb     80280f <devcons_write+0x19>
+}
+  802842:	89 f0                	mov    %esi,%eax
+  802844:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802847:	5b                   	pop    %ebx
+  802848:	5e                   	pop    %esi
+  802849:	5f                   	pop    %edi
+  80284a:	5d                   	pop    %ebp
+  80284b:	c3                   	ret
+
+0080284c <devcons_read>:
+{
+  80284c:	55                   	push   %ebp
+  80284d:	89 e5                	mov    %esp,%ebp
+  80284f:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802852:	b8 00 00 00 00       	mov    $0x0,%eax
+  802857:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80285b:	75 07                	jne    802864 <devcons_read+0x18>
+  80285d:	eb 1f                	jmp    80287e <devcons_read+0x32>
+		sys_yield();
+  80285f:	e8 0b dd ff ff       	call   80056f <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802864:	e8 6f dc ff ff       	call   8004d8 <sys_cgetc>
+  802869:	85 c0                	test   %eax,%eax
+  80286b:	74 f2                	je     80285f <devcons_read+0x13>
+	if (c < 0)
+  80286d:	78 0f                	js     80287e <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80286f:	83 f8 04             	cmp    $0x4,%eax
+  802872:	74 0c                	je     802880 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802874:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802877:	88 02                	mov    %al,(%edx)
+	return 1;
+  802879:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80287e:	c9                   	leave
+  80287f:	c3                   	ret
+		return 0;
+  802880:	b8 00 00 00 00       	mov    $0x0,%eax
+  802885:	eb f7                	jmp    80287e <devcons_read+0x32>
+
+00802887 <cputchar>:
+{
+  802887:	55                   	push   %ebp
+  802888:	89 e5                	mov    %esp,%ebp
+  80288a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80288d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802890:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802893:	6a 01                	push   $0x1
+  802895:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802898:	50                   	push   %eax
+  802899:	e8 14 dc ff ff       	call   8004b2 <sys_cputs>
+}
+  80289e:	83 c4 10             	add    $0x10,%esp
+  8028a1:	c9                   	leave
+  8028a2:	c3                   	ret
+
+008028a3 <getchar>:
+{
+  8028a3:	55                   	push   %ebp
+  8028a4:	89 e5                	mov    %esp,%ebp
+  8028a6:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8028a9:	6a 01                	push   $0x1
+  8028ab:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028ae:	50                   	push   %eax
+  8028af:	6a 00                	push   $0x0
+  8028b1:	e8 bc e3 ff ff       	call   800c72 <read>
+	if (r < 0)
+  8028b6:	83 c4 10             	add    $0x10,%esp
+  8028b9:	85 c0                	test   %eax,%eax
+  8028bb:	78 06                	js     8028c3 <getchar+0x20>
+	if (r < 1)
+  8028bd:	74 06                	je     8028c5 <getchar+0x22>
+	return c;
+  8028bf:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8028c3:	c9                   	leave
+  8028c4:	c3                   	ret
+		return -E_EOF;
+  8028c5:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8028ca:	eb f7                	jmp    8028c3 <getchar+0x20>
+
+008028cc <iscons>:
+{
+  8028cc:	55                   	push   %ebp
+  8028cd:	89 e5                	mov    %esp,%ebp
+  8028cf:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8028d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028d5:	50                   	push   %eax
+  8028d6:	ff 75 08             	push   0x8(%ebp)
+  8028d9:	e8 2e e1 ff ff       	call   800a0c <fd_lookup>
+  8028de:	83 c4 10             	add    $0x10,%esp
+  8028e1:	85 c0                	test   %eax,%eax
+  8028e3:	78 11                	js     8028f6 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8028e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028e8:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8028ee:	39 10                	cmp    %edx,(%eax)
+  8028f0:	0f 94 c0             	sete   %al
+  8028f3:	0f b6 c0             	movzbl %al,%eax
+}
+  8028f6:	c9                   	leave
+  8028f7:	c3                   	ret
+
+008028f8 <opencons>:
+{
+  8028f8:	55                   	push   %ebp
+  8028f9:	89 e5                	mov    %esp,%ebp
+  8028fb:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8028fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802901:	50                   	push   %eax
+  802902:	e8 af e0 ff ff       	call   8009b6 <fd_alloc>
+  802907:	83 c4 10             	add    $0x10,%esp
+  80290a:	85 c0                	test   %eax,%eax
+  80290c:	78 3a                	js     802948 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80290e:	83 ec 04             	sub    $0x4,%esp
+  802911:	68 07 04 00 00       	push   $0x407
+  802916:	ff 75 f4             	push   -0xc(%ebp)
+  802919:	6a 00                	push   $0x0
+  80291b:	e8 6e dc ff ff       	call   80058e <sys_page_alloc>
+  802920:	83 c4 10             	add    $0x10,%esp
+  802923:	85 c0                	test   %eax,%eax
+  802925:	78 21                	js     802948 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802927:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80292a:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802930:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802932:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802935:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80293c:	83 ec 0c             	sub    $0xc,%esp
+  80293f:	50                   	push   %eax
+  802940:	e8 4a e0 ff ff       	call   80098f <fd2num>
+  802945:	83 c4 10             	add    $0x10,%esp
+}
+  802948:	c9                   	leave
+  802949:	c3                   	ret
+
+0080294a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80294a:	55                   	push   %ebp
+  80294b:	89 e5                	mov    %esp,%ebp
+  80294d:	56                   	push   %esi
+  80294e:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80294f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802952:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802958:	e8 eb db ff ff       	call   800548 <sys_getenvid>
+  80295d:	83 ec 0c             	sub    $0xc,%esp
+  802960:	ff 75 0c             	push   0xc(%ebp)
+  802963:	ff 75 08             	push   0x8(%ebp)
+  802966:	56                   	push   %esi
+  802967:	50                   	push   %eax
+  802968:	68 a4 39 80 00       	push   $0x8039a4
+  80296d:	e8 b3 00 00 00       	call   802a25 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802972:	83 c4 18             	add    $0x18,%esp
+  802975:	53                   	push   %ebx
+  802976:	ff 75 10             	push   0x10(%ebp)
+  802979:	e8 56 00 00 00       	call   8029d4 <vcprintf>
+	cprintf("\n");
+  80297e:	c7 04 24 8f 39 80 00 	movl   $0x80398f,(%esp)
+  802985:	e8 9b 00 00 00       	call   802a25 <cprintf>
+  80298a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80298d:	cc                   	int3
+	while (1)
+  80298e:	eb fd                	jmp    80298d <_panic+0x43>
+
+00802990 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  802990:	55                   	push   %ebp
+  802991:	89 e5                	mov    %esp,%ebp
+  802993:	53                   	push   %ebx
+  802994:	83 ec 04             	sub    $0x4,%esp
+  802997:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80299a:	8b 13                	mov    (%ebx),%edx
+  80299c:	8d 42 01             	lea    0x1(%edx),%eax
+  80299f:	89 03                	mov    %eax,(%ebx)
+  8029a1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029a4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8029a8:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8029ad:	74 09                	je     8029b8 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8029af:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8029b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029b6:	c9                   	leave
+  8029b7:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8029b8:	83 ec 08             	sub    $0x8,%esp
+  8029bb:	68 ff 00 00 00       	push   $0xff
+  8029c0:	8d 43 08             	lea    0x8(%ebx),%eax
+  8029c3:	50                   	push   %eax
+  8029c4:	e8 e9 da ff ff       	call   8004b2 <sys_cputs>
+		b->idx = 0;
+  8029c9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8029cf:	83 c4 10             	add    $0x10,%esp
+  8029d2:	eb db                	jmp    8029af <putch+0x1f>
+
+008029d4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8029d4:	55                   	push   %ebp
+  8029d5:	89 e5                	mov    %esp,%ebp
+  8029d7:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8029dd:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8029e4:	00 00 00 
+	b.cnt = 0;
+  8029e7:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8029ee:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8029f1:	ff 75 0c             	push   0xc(%ebp)
+  8029f4:	ff 75 08             	push   0x8(%ebp)
+  8029f7:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8029fd:	50                   	push   %eax
+  8029fe:	68 90 29 80 00       	push   $0x802990
+  802a03:	e8 14 01 00 00       	call   802b1c <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802a08:	83 c4 08             	add    $0x8,%esp
+  802a0b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802a11:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802a17:	50                   	push   %eax
+  802a18:	e8 95 da ff ff       	call   8004b2 <sys_cputs>
+
+	return b.cnt;
+}
+  802a1d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802a23:	c9                   	leave
+  802a24:	c3                   	ret
+
+00802a25 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802a25:	55                   	push   %ebp
+  802a26:	89 e5                	mov    %esp,%ebp
+  802a28:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802a2b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802a2e:	50                   	push   %eax
+  802a2f:	ff 75 08             	push   0x8(%ebp)
+  802a32:	e8 9d ff ff ff       	call   8029d4 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802a37:	c9                   	leave
+  802a38:	c3                   	ret
+
+00802a39 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802a39:	55                   	push   %ebp
+  802a3a:	89 e5                	mov    %esp,%ebp
+  802a3c:	57                   	push   %edi
+  802a3d:	56                   	push   %esi
+  802a3e:	53                   	push   %ebx
+  802a3f:	83 ec 1c             	sub    $0x1c,%esp
+  802a42:	89 c7                	mov    %eax,%edi
+  802a44:	89 d6                	mov    %edx,%esi
+  802a46:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a49:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a4c:	89 d1                	mov    %edx,%ecx
+  802a4e:	89 c2                	mov    %eax,%edx
+  802a50:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802a53:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802a56:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a59:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802a5c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802a5f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802a66:	39 c2                	cmp    %eax,%edx
+  802a68:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802a6b:	72 3e                	jb     802aab <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802a6d:	83 ec 0c             	sub    $0xc,%esp
+  802a70:	ff 75 18             	push   0x18(%ebp)
+  802a73:	83 eb 01             	sub    $0x1,%ebx
+  802a76:	53                   	push   %ebx
+  802a77:	50                   	push   %eax
+  802a78:	83 ec 08             	sub    $0x8,%esp
+  802a7b:	ff 75 e4             	push   -0x1c(%ebp)
+  802a7e:	ff 75 e0             	push   -0x20(%ebp)
+  802a81:	ff 75 dc             	push   -0x24(%ebp)
+  802a84:	ff 75 d8             	push   -0x28(%ebp)
+  802a87:	e8 ee 0b 00 00       	call   80367a <__udivdi3>
+  802a8c:	83 c4 18             	add    $0x18,%esp
+  802a8f:	52                   	push   %edx
+  802a90:	50                   	push   %eax
+  802a91:	89 f2                	mov    %esi,%edx
+  802a93:	89 f8                	mov    %edi,%eax
+  802a95:	e8 9f ff ff ff       	call   802a39 <printnum>
+  802a9a:	83 c4 20             	add    $0x20,%esp
+  802a9d:	eb 13                	jmp    802ab2 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  802a9f:	83 ec 08             	sub    $0x8,%esp
+  802aa2:	56                   	push   %esi
+  802aa3:	ff 75 18             	push   0x18(%ebp)
+  802aa6:	ff d7                	call   *%edi
+  802aa8:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  802aab:	83 eb 01             	sub    $0x1,%ebx
+  802aae:	85 db                	test   %ebx,%ebx
+  802ab0:	7f ed                	jg     802a9f <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  802ab2:	83 ec 08             	sub    $0x8,%esp
+  802ab5:	56                   	push   %esi
+  802ab6:	83 ec 04             	sub    $0x4,%esp
+  802ab9:	ff 75 e4             	push   -0x1c(%ebp)
+  802abc:	ff 75 e0             	push   -0x20(%ebp)
+  802abf:	ff 75 dc             	push   -0x24(%ebp)
+  802ac2:	ff 75 d8             	push   -0x28(%ebp)
+  802ac5:	e8 ce 0b 00 00       	call   803698 <__umoddi3>
+  802aca:	83 c4 14             	add    $0x14,%esp
+  802acd:	0f be 80 c7 39 80 00 	movsbl 0x8039c7(%eax),%eax
+  802ad4:	50                   	push   %eax
+  802ad5:	ff d7                	call   *%edi
+}
+  802ad7:	83 c4 10             	add    $0x10,%esp
+  802ada:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802add:	5b                   	pop    %ebx
+  802ade:	5e                   	pop    %esi
+  802adf:	5f                   	pop    %edi
+  802ae0:	5d                   	pop    %ebp
+  802ae1:	c3                   	ret
+
+00802ae2 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802ae2:	55                   	push   %ebp
+  802ae3:	89 e5                	mov    %esp,%ebp
+  802ae5:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  802ae8:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  802aec:	8b 10                	mov    (%eax),%edx
+  802aee:	3b 50 04             	cmp    0x4(%eax),%edx
+  802af1:	73 0a                	jae    802afd <sprintputch+0x1b>
+		*b->buf++ = ch;
+  802af3:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802af6:	89 08                	mov    %ecx,(%eax)
+  802af8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802afb:	88 02                	mov    %al,(%edx)
+}
+  802afd:	5d                   	pop    %ebp
+  802afe:	c3                   	ret
+
+00802aff <printfmt>:
+{
+  802aff:	55                   	push   %ebp
+  802b00:	89 e5                	mov    %esp,%ebp
+  802b02:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  802b05:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  802b08:	50                   	push   %eax
+  802b09:	ff 75 10             	push   0x10(%ebp)
+  802b0c:	ff 75 0c             	push   0xc(%ebp)
+  802b0f:	ff 75 08             	push   0x8(%ebp)
+  802b12:	e8 05 00 00 00       	call   802b1c <vprintfmt>
+}
+  802b17:	83 c4 10             	add    $0x10,%esp
+  802b1a:	c9                   	leave
+  802b1b:	c3                   	ret
+
+00802b1c <vprintfmt>:
+{
+  802b1c:	55                   	push   %ebp
+  802b1d:	89 e5                	mov    %esp,%ebp
+  802b1f:	57                   	push   %edi
+  802b20:	56                   	push   %esi
+  802b21:	53                   	push   %ebx
+  802b22:	83 ec 2c             	sub    $0x2c,%esp
+  802b25:	8b 75 08             	mov    0x8(%ebp),%esi
+  802b28:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802b2b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802b2e:	eb 0a                	jmp    802b3a <vprintfmt+0x1e>
+			putch(ch, putdat);
+  802b30:	83 ec 08             	sub    $0x8,%esp
+  802b33:	53                   	push   %ebx
+  802b34:	50                   	push   %eax
+  802b35:	ff d6                	call   *%esi
+  802b37:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802b3a:	83 c7 01             	add    $0x1,%edi
+  802b3d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  802b41:	83 f8 25             	cmp    $0x25,%eax
+  802b44:	74 0c                	je     802b52 <vprintfmt+0x36>
+			if (ch == '\0')
+  802b46:	85 c0                	test   %eax,%eax
+  802b48:	75 e6                	jne    802b30 <vprintfmt+0x14>
+}
+  802b4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b4d:	5b                   	pop    %ebx
+  802b4e:	5e                   	pop    %esi
+  802b4f:	5f                   	pop    %edi
+  802b50:	5d                   	pop    %ebp
+  802b51:	c3                   	ret
+		padc = ' ';
+  802b52:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  802b56:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802b5d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  802b64:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  802b6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  802b70:	8d 47 01             	lea    0x1(%edi),%eax
+  802b73:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b76:	0f b6 17             	movzbl (%edi),%edx
+  802b79:	8d 42 dd             	lea    -0x23(%edx),%eax
+  802b7c:	3c 55                	cmp    $0x55,%al
+  802b7e:	0f 87 cf 03 00 00    	ja     802f53 <vprintfmt+0x437>
+  802b84:	0f b6 c0             	movzbl %al,%eax
+  802b87:	ff 24 85 20 3b 80 00 	jmp    *0x803b20(,%eax,4)
+  802b8e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  802b91:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  802b95:	eb d9                	jmp    802b70 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  802b97:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802b9a:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  802b9e:	eb d0                	jmp    802b70 <vprintfmt+0x54>
+  802ba0:	0f b6 d2             	movzbl %dl,%edx
+  802ba3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  802ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bab:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  802bae:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  802bb1:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  802bb5:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  802bb8:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  802bbb:	83 f9 09             	cmp    $0x9,%ecx
+  802bbe:	77 55                	ja     802c15 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  802bc0:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  802bc3:	eb e9                	jmp    802bae <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  802bc5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bc8:	8b 00                	mov    (%eax),%eax
+  802bca:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802bcd:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bd0:	8d 40 04             	lea    0x4(%eax),%eax
+  802bd3:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802bd6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  802bd9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  802bdd:	79 91                	jns    802b70 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  802bdf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802be2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802be5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  802bec:	eb 82                	jmp    802b70 <vprintfmt+0x54>
+			if (width < 0)
+  802bee:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802bf1:	85 d2                	test   %edx,%edx
+  802bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf8:	0f 49 c2             	cmovns %edx,%eax
+  802bfb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802bfe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  802c01:	e9 6a ff ff ff       	jmp    802b70 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c06:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  802c09:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  802c10:	e9 5b ff ff ff       	jmp    802b70 <vprintfmt+0x54>
+  802c15:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802c18:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802c1b:	eb bc                	jmp    802bd9 <vprintfmt+0xbd>
+			lflag++;
+  802c1d:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  802c20:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  802c23:	e9 48 ff ff ff       	jmp    802b70 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  802c28:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c2b:	8d 78 04             	lea    0x4(%eax),%edi
+  802c2e:	83 ec 08             	sub    $0x8,%esp
+  802c31:	53                   	push   %ebx
+  802c32:	ff 30                	push   (%eax)
+  802c34:	ff d6                	call   *%esi
+			break;
+  802c36:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802c39:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  802c3c:	e9 b1 02 00 00       	jmp    802ef2 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  802c41:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c44:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  802c47:	8b 10                	mov    (%eax),%edx
+  802c49:	89 d0                	mov    %edx,%eax
+  802c4b:	f7 d8                	neg    %eax
+  802c4d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802c50:	83 f8 11             	cmp    $0x11,%eax
+  802c53:	7f 23                	jg     802c78 <vprintfmt+0x15c>
+  802c55:	8b 14 85 80 3c 80 00 	mov    0x803c80(,%eax,4),%edx
+  802c5c:	85 d2                	test   %edx,%edx
+  802c5e:	74 18                	je     802c78 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  802c60:	52                   	push   %edx
+  802c61:	68 fa 38 80 00       	push   $0x8038fa
+  802c66:	53                   	push   %ebx
+  802c67:	56                   	push   %esi
+  802c68:	e8 92 fe ff ff       	call   802aff <printfmt>
+  802c6d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802c70:	89 7d 14             	mov    %edi,0x14(%ebp)
+  802c73:	e9 7a 02 00 00       	jmp    802ef2 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  802c78:	50                   	push   %eax
+  802c79:	68 df 39 80 00       	push   $0x8039df
+  802c7e:	53                   	push   %ebx
+  802c7f:	56                   	push   %esi
+  802c80:	e8 7a fe ff ff       	call   802aff <printfmt>
+  802c85:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802c88:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802c8b:	e9 62 02 00 00       	jmp    802ef2 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802c90:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c93:	83 c0 04             	add    $0x4,%eax
+  802c96:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  802c99:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c9c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  802c9e:	85 c9                	test   %ecx,%ecx
+  802ca0:	b8 d8 39 80 00       	mov    $0x8039d8,%eax
+  802ca5:	0f 45 c1             	cmovne %ecx,%eax
+  802ca8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  802cab:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  802caf:	7e 06                	jle    802cb7 <vprintfmt+0x19b>
+  802cb1:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  802cb5:	75 0b                	jne    802cc2 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802cb7:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  802cba:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  802cbd:	89 75 08             	mov    %esi,0x8(%ebp)
+  802cc0:	eb 5c                	jmp    802d1e <vprintfmt+0x202>
+  802cc2:	83 ec 08             	sub    $0x8,%esp
+  802cc5:	ff 75 d0             	push   -0x30(%ebp)
+  802cc8:	ff 75 cc             	push   -0x34(%ebp)
+  802ccb:	e8 8f d4 ff ff       	call   80015f <strnlen>
+  802cd0:	89 c2                	mov    %eax,%edx
+  802cd2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802cd5:	29 d0                	sub    %edx,%eax
+  802cd7:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  802cda:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  802cde:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802ce1:	89 75 08             	mov    %esi,0x8(%ebp)
+  802ce4:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802ce6:	eb 0e                	jmp    802cf6 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  802ce8:	83 ec 08             	sub    $0x8,%esp
+  802ceb:	53                   	push   %ebx
+  802cec:	57                   	push   %edi
+  802ced:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802cf0:	83 ee 01             	sub    $0x1,%esi
+  802cf3:	83 c4 10             	add    $0x10,%esp
+  802cf6:	85 f6                	test   %esi,%esi
+  802cf8:	7f ee                	jg     802ce8 <vprintfmt+0x1cc>
+  802cfa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802cfd:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d00:	85 c0                	test   %eax,%eax
+  802d02:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d07:	0f 49 d0             	cmovns %eax,%edx
+  802d0a:	29 d0                	sub    %edx,%eax
+  802d0c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802d0f:	eb a6                	jmp    802cb7 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  802d11:	83 ec 08             	sub    $0x8,%esp
+  802d14:	53                   	push   %ebx
+  802d15:	52                   	push   %edx
+  802d16:	ff 55 08             	call   *0x8(%ebp)
+  802d19:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802d1c:	89 f1                	mov    %esi,%ecx
+  802d1e:	8d 71 01             	lea    0x1(%ecx),%esi
+  802d21:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802d25:	0f be d0             	movsbl %al,%edx
+  802d28:	85 d2                	test   %edx,%edx
+  802d2a:	74 28                	je     802d54 <vprintfmt+0x238>
+  802d2c:	85 ff                	test   %edi,%edi
+  802d2e:	78 05                	js     802d35 <vprintfmt+0x219>
+  802d30:	83 ef 01             	sub    $0x1,%edi
+  802d33:	78 30                	js     802d65 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802d35:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802d39:	74 d6                	je     802d11 <vprintfmt+0x1f5>
+  802d3b:	0f be c0             	movsbl %al,%eax
+  802d3e:	83 e8 20             	sub    $0x20,%eax
+  802d41:	83 f8 5e             	cmp    $0x5e,%eax
+  802d44:	76 cb                	jbe    802d11 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  802d46:	83 ec 08             	sub    $0x8,%esp
+  802d49:	53                   	push   %ebx
+  802d4a:	6a 3f                	push   $0x3f
+  802d4c:	ff 55 08             	call   *0x8(%ebp)
+  802d4f:	83 c4 10             	add    $0x10,%esp
+  802d52:	eb c8                	jmp    802d1c <vprintfmt+0x200>
+  802d54:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d57:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802d5a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802d5d:	01 d0                	add    %edx,%eax
+  802d5f:	29 c8                	sub    %ecx,%eax
+  802d61:	89 c7                	mov    %eax,%edi
+  802d63:	eb 13                	jmp    802d78 <vprintfmt+0x25c>
+  802d65:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d68:	eb ed                	jmp    802d57 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  802d6a:	83 ec 08             	sub    $0x8,%esp
+  802d6d:	53                   	push   %ebx
+  802d6e:	6a 20                	push   $0x20
+  802d70:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  802d72:	83 ef 01             	sub    $0x1,%edi
+  802d75:	83 c4 10             	add    $0x10,%esp
+  802d78:	85 ff                	test   %edi,%edi
+  802d7a:	7f ee                	jg     802d6a <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802d7c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  802d7f:	89 45 14             	mov    %eax,0x14(%ebp)
+  802d82:	e9 6b 01 00 00       	jmp    802ef2 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  802d87:	83 f9 01             	cmp    $0x1,%ecx
+  802d8a:	7f 1f                	jg     802dab <vprintfmt+0x28f>
+	else if (lflag)
+  802d8c:	85 c9                	test   %ecx,%ecx
+  802d8e:	74 67                	je     802df7 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  802d90:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d93:	8b 00                	mov    (%eax),%eax
+  802d95:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802d98:	89 c1                	mov    %eax,%ecx
+  802d9a:	c1 f9 1f             	sar    $0x1f,%ecx
+  802d9d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802da0:	8b 45 14             	mov    0x14(%ebp),%eax
+  802da3:	8d 40 04             	lea    0x4(%eax),%eax
+  802da6:	89 45 14             	mov    %eax,0x14(%ebp)
+  802da9:	eb 17                	jmp    802dc2 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  802dab:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dae:	8b 50 04             	mov    0x4(%eax),%edx
+  802db1:	8b 00                	mov    (%eax),%eax
+  802db3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802db6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802db9:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dbc:	8d 40 08             	lea    0x8(%eax),%eax
+  802dbf:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802dc2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802dc5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802dc8:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  802dcd:	85 c9                	test   %ecx,%ecx
+  802dcf:	0f 89 03 01 00 00    	jns    802ed8 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  802dd5:	83 ec 08             	sub    $0x8,%esp
+  802dd8:	53                   	push   %ebx
+  802dd9:	6a 2d                	push   $0x2d
+  802ddb:	ff d6                	call   *%esi
+				num = -(long long) num;
+  802ddd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802de0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802de3:	f7 da                	neg    %edx
+  802de5:	83 d1 00             	adc    $0x0,%ecx
+  802de8:	f7 d9                	neg    %ecx
+  802dea:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802ded:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802df2:	e9 e1 00 00 00       	jmp    802ed8 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  802df7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dfa:	8b 00                	mov    (%eax),%eax
+  802dfc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802dff:	89 c1                	mov    %eax,%ecx
+  802e01:	c1 f9 1f             	sar    $0x1f,%ecx
+  802e04:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802e07:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e0a:	8d 40 04             	lea    0x4(%eax),%eax
+  802e0d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e10:	eb b0                	jmp    802dc2 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  802e12:	83 f9 01             	cmp    $0x1,%ecx
+  802e15:	7f 1e                	jg     802e35 <vprintfmt+0x319>
+	else if (lflag)
+  802e17:	85 c9                	test   %ecx,%ecx
+  802e19:	74 32                	je     802e4d <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802e1b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e1e:	8b 10                	mov    (%eax),%edx
+  802e20:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e25:	8d 40 04             	lea    0x4(%eax),%eax
+  802e28:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802e2b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  802e30:	e9 a3 00 00 00       	jmp    802ed8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802e35:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e38:	8b 10                	mov    (%eax),%edx
+  802e3a:	8b 48 04             	mov    0x4(%eax),%ecx
+  802e3d:	8d 40 08             	lea    0x8(%eax),%eax
+  802e40:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802e43:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  802e48:	e9 8b 00 00 00       	jmp    802ed8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802e4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e50:	8b 10                	mov    (%eax),%edx
+  802e52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e57:	8d 40 04             	lea    0x4(%eax),%eax
+  802e5a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802e5d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  802e62:	eb 74                	jmp    802ed8 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  802e64:	83 f9 01             	cmp    $0x1,%ecx
+  802e67:	7f 1b                	jg     802e84 <vprintfmt+0x368>
+	else if (lflag)
+  802e69:	85 c9                	test   %ecx,%ecx
+  802e6b:	74 2c                	je     802e99 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  802e6d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e70:	8b 10                	mov    (%eax),%edx
+  802e72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e77:	8d 40 04             	lea    0x4(%eax),%eax
+  802e7a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802e7d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  802e82:	eb 54                	jmp    802ed8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802e84:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e87:	8b 10                	mov    (%eax),%edx
+  802e89:	8b 48 04             	mov    0x4(%eax),%ecx
+  802e8c:	8d 40 08             	lea    0x8(%eax),%eax
+  802e8f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802e92:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  802e97:	eb 3f                	jmp    802ed8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802e99:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e9c:	8b 10                	mov    (%eax),%edx
+  802e9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ea3:	8d 40 04             	lea    0x4(%eax),%eax
+  802ea6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802ea9:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802eae:	eb 28                	jmp    802ed8 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  802eb0:	83 ec 08             	sub    $0x8,%esp
+  802eb3:	53                   	push   %ebx
+  802eb4:	6a 30                	push   $0x30
+  802eb6:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802eb8:	83 c4 08             	add    $0x8,%esp
+  802ebb:	53                   	push   %ebx
+  802ebc:	6a 78                	push   $0x78
+  802ebe:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802ec0:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ec3:	8b 10                	mov    (%eax),%edx
+  802ec5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802eca:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802ecd:	8d 40 04             	lea    0x4(%eax),%eax
+  802ed0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802ed3:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802ed8:	83 ec 0c             	sub    $0xc,%esp
+  802edb:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802edf:	50                   	push   %eax
+  802ee0:	ff 75 e0             	push   -0x20(%ebp)
+  802ee3:	57                   	push   %edi
+  802ee4:	51                   	push   %ecx
+  802ee5:	52                   	push   %edx
+  802ee6:	89 da                	mov    %ebx,%edx
+  802ee8:	89 f0                	mov    %esi,%eax
+  802eea:	e8 4a fb ff ff       	call   802a39 <printnum>
+			break;
+  802eef:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802ef2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802ef5:	e9 40 fc ff ff       	jmp    802b3a <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802efa:	83 f9 01             	cmp    $0x1,%ecx
+  802efd:	7f 1b                	jg     802f1a <vprintfmt+0x3fe>
+	else if (lflag)
+  802eff:	85 c9                	test   %ecx,%ecx
+  802f01:	74 2c                	je     802f2f <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802f03:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f06:	8b 10                	mov    (%eax),%edx
+  802f08:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f0d:	8d 40 04             	lea    0x4(%eax),%eax
+  802f10:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802f13:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802f18:	eb be                	jmp    802ed8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802f1a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f1d:	8b 10                	mov    (%eax),%edx
+  802f1f:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f22:	8d 40 08             	lea    0x8(%eax),%eax
+  802f25:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802f28:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802f2d:	eb a9                	jmp    802ed8 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802f2f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f32:	8b 10                	mov    (%eax),%edx
+  802f34:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f39:	8d 40 04             	lea    0x4(%eax),%eax
+  802f3c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802f3f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  802f44:	eb 92                	jmp    802ed8 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  802f46:	83 ec 08             	sub    $0x8,%esp
+  802f49:	53                   	push   %ebx
+  802f4a:	6a 25                	push   $0x25
+  802f4c:	ff d6                	call   *%esi
+			break;
+  802f4e:	83 c4 10             	add    $0x10,%esp
+  802f51:	eb 9f                	jmp    802ef2 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  802f53:	83 ec 08             	sub    $0x8,%esp
+  802f56:	53                   	push   %ebx
+  802f57:	6a 25                	push   $0x25
+  802f59:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802f5b:	83 c4 10             	add    $0x10,%esp
+  802f5e:	89 f8                	mov    %edi,%eax
+  802f60:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802f64:	74 05                	je     802f6b <vprintfmt+0x44f>
+  802f66:	83 e8 01             	sub    $0x1,%eax
+  802f69:	eb f5                	jmp    802f60 <vprintfmt+0x444>
+  802f6b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f6e:	eb 82                	jmp    802ef2 <vprintfmt+0x3d6>
+
+00802f70 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802f70:	55                   	push   %ebp
+  802f71:	89 e5                	mov    %esp,%ebp
+  802f73:	83 ec 18             	sub    $0x18,%esp
+  802f76:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f79:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  802f7c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802f7f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802f83:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802f86:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802f8d:	85 c0                	test   %eax,%eax
+  802f8f:	74 26                	je     802fb7 <vsnprintf+0x47>
+  802f91:	85 d2                	test   %edx,%edx
+  802f93:	7e 22                	jle    802fb7 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  802f95:	ff 75 14             	push   0x14(%ebp)
+  802f98:	ff 75 10             	push   0x10(%ebp)
+  802f9b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802f9e:	50                   	push   %eax
+  802f9f:	68 e2 2a 80 00       	push   $0x802ae2
+  802fa4:	e8 73 fb ff ff       	call   802b1c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802fa9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802fac:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802faf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fb2:	83 c4 10             	add    $0x10,%esp
+}
+  802fb5:	c9                   	leave
+  802fb6:	c3                   	ret
+		return -E_INVAL;
+  802fb7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fbc:	eb f7                	jmp    802fb5 <vsnprintf+0x45>
+
+00802fbe <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802fbe:	55                   	push   %ebp
+  802fbf:	89 e5                	mov    %esp,%ebp
+  802fc1:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  802fc4:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802fc7:	50                   	push   %eax
+  802fc8:	ff 75 10             	push   0x10(%ebp)
+  802fcb:	ff 75 0c             	push   0xc(%ebp)
+  802fce:	ff 75 08             	push   0x8(%ebp)
+  802fd1:	e8 9a ff ff ff       	call   802f70 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802fd6:	c9                   	leave
+  802fd7:	c3                   	ret
+
+00802fd8 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802fd8:	55                   	push   %ebp
+  802fd9:	89 e5                	mov    %esp,%ebp
+  802fdb:	57                   	push   %edi
+  802fdc:	56                   	push   %esi
+  802fdd:	53                   	push   %ebx
+  802fde:	83 ec 20             	sub    $0x20,%esp
+  802fe1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802fe4:	89 d7                	mov    %edx,%edi
+  802fe6:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802fe8:	51                   	push   %ecx
+  802fe9:	68 00 f0 7f 00       	push   $0x7ff000
+  802fee:	6a 00                	push   $0x0
+  802ff0:	e8 99 d5 ff ff       	call   80058e <sys_page_alloc>
+  802ff5:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802ff7:	83 c4 10             	add    $0x10,%esp
+  802ffa:	85 c0                	test   %eax,%eax
+  802ffc:	78 45                	js     803043 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802ffe:	83 ec 04             	sub    $0x4,%esp
+  803001:	68 00 10 00 00       	push   $0x1000
+  803006:	57                   	push   %edi
+  803007:	68 00 f0 7f 00       	push   $0x7ff000
+  80300c:	e8 f7 d2 ff ff       	call   800308 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  803011:	89 34 24             	mov    %esi,(%esp)
+  803014:	57                   	push   %edi
+  803015:	ff 75 e4             	push   -0x1c(%ebp)
+  803018:	68 00 f0 7f 00       	push   $0x7ff000
+  80301d:	6a 00                	push   $0x0
+  80301f:	e8 b5 d5 ff ff       	call   8005d9 <sys_page_map>
+  803024:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803026:	83 c4 20             	add    $0x20,%esp
+  803029:	85 c0                	test   %eax,%eax
+  80302b:	78 16                	js     803043 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80302d:	83 ec 08             	sub    $0x8,%esp
+  803030:	68 00 f0 7f 00       	push   $0x7ff000
+  803035:	6a 00                	push   $0x0
+  803037:	e8 df d5 ff ff       	call   80061b <sys_page_unmap>
+  80303c:	83 c4 10             	add    $0x10,%esp
+  80303f:	85 c0                	test   %eax,%eax
+  803041:	75 0a                	jne    80304d <copy_page_to+0x75>
+exit:
+	return r;
+}
+  803043:	89 d8                	mov    %ebx,%eax
+  803045:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803048:	5b                   	pop    %ebx
+  803049:	5e                   	pop    %esi
+  80304a:	5f                   	pop    %edi
+  80304b:	5d                   	pop    %ebp
+  80304c:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80304d:	68 e8 3c 80 00       	push   $0x803ce8
+  803052:	68 e8 38 80 00       	push   $0x8038e8
+  803057:	6a 1b                	push   $0x1b
+  803059:	68 60 3d 80 00       	push   $0x803d60
+  80305e:	e8 e7 f8 ff ff       	call   80294a <_panic>
+
+00803063 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803063:	55                   	push   %ebp
+  803064:	89 e5                	mov    %esp,%ebp
+  803066:	53                   	push   %ebx
+  803067:	83 ec 04             	sub    $0x4,%esp
+  80306a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  80306d:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80306f:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  803073:	74 21                	je     803096 <pgfault+0x33>
+  803075:	89 d0                	mov    %edx,%eax
+  803077:	c1 e8 16             	shr    $0x16,%eax
+  80307a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803081:	a8 01                	test   $0x1,%al
+  803083:	74 11                	je     803096 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803085:	89 d0                	mov    %edx,%eax
+  803087:	c1 e8 0c             	shr    $0xc,%eax
+  80308a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803091:	f6 c4 08             	test   $0x8,%ah
+  803094:	75 17                	jne    8030ad <pgfault+0x4a>
+		if (pgfault_next) {
+  803096:	a1 04 90 80 00       	mov    0x809004,%eax
+  80309b:	85 c0                	test   %eax,%eax
+  80309d:	74 27                	je     8030c6 <pgfault+0x63>
+			pgfault_next(utf);
+  80309f:	83 ec 0c             	sub    $0xc,%esp
+  8030a2:	53                   	push   %ebx
+  8030a3:	ff d0                	call   *%eax
+			return;
+  8030a5:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8030a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030ab:	c9                   	leave
+  8030ac:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8030ad:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8030b3:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8030b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030bd:	e8 16 ff ff ff       	call   802fd8 <copy_page_to>
+  8030c2:	85 c0                	test   %eax,%eax
+  8030c4:	79 e2                	jns    8030a8 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8030c6:	a1 00 50 80 00       	mov    0x805000,%eax
+  8030cb:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8030ce:	ff 73 28             	push   0x28(%ebx)
+  8030d1:	ff 33                	push   (%ebx)
+  8030d3:	50                   	push   %eax
+  8030d4:	68 0c 3d 80 00       	push   $0x803d0c
+  8030d9:	e8 47 f9 ff ff       	call   802a25 <cprintf>
+	sys_env_destroy(0);
+  8030de:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8030e5:	e8 15 d4 ff ff       	call   8004ff <sys_env_destroy>
+  8030ea:	83 c4 10             	add    $0x10,%esp
+  8030ed:	eb b9                	jmp    8030a8 <pgfault+0x45>
+
+008030ef <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8030ef:	55                   	push   %ebp
+  8030f0:	89 e5                	mov    %esp,%ebp
+  8030f2:	53                   	push   %ebx
+  8030f3:	83 ec 04             	sub    $0x4,%esp
+  8030f6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8030f9:	a1 08 90 80 00       	mov    0x809008,%eax
+  8030fe:	3d 63 30 80 00       	cmp    $0x803063,%eax
+  803103:	74 15                	je     80311a <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803105:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  80310a:	83 ec 0c             	sub    $0xc,%esp
+  80310d:	68 63 30 80 00       	push   $0x803063
+  803112:	e8 fb 03 00 00       	call   803512 <set_pgfault_handler>
+  803117:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80311a:	83 ec 0c             	sub    $0xc,%esp
+  80311d:	68 05 08 00 00       	push   $0x805
+  803122:	53                   	push   %ebx
+  803123:	6a 00                	push   $0x0
+  803125:	53                   	push   %ebx
+  803126:	6a 00                	push   $0x0
+  803128:	e8 ac d4 ff ff       	call   8005d9 <sys_page_map>
+}
+  80312d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803130:	c9                   	leave
+  803131:	c3                   	ret
+
+00803132 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803132:	55                   	push   %ebp
+  803133:	89 e5                	mov    %esp,%ebp
+  803135:	57                   	push   %edi
+  803136:	56                   	push   %esi
+  803137:	53                   	push   %ebx
+  803138:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80313b:	68 63 30 80 00       	push   $0x803063
+  803140:	e8 cd 03 00 00       	call   803512 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803145:	b8 07 00 00 00       	mov    $0x7,%eax
+  80314a:	cd 30                	int    $0x30
+  80314c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80314f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  803152:	83 c4 10             	add    $0x10,%esp
+  803155:	85 c0                	test   %eax,%eax
+  803157:	0f 88 6b 01 00 00    	js     8032c8 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80315d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803162:	75 37                	jne    80319b <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803164:	e8 df d3 ff ff       	call   800548 <sys_getenvid>
+  803169:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80316e:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803174:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803179:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  80317e:	e9 45 01 00 00       	jmp    8032c8 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803183:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803189:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80318f:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803195:	0f 87 ba 00 00 00    	ja     803255 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  80319b:	89 d8                	mov    %ebx,%eax
+  80319d:	c1 e8 16             	shr    $0x16,%eax
+  8031a0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8031a7:	a8 01                	test   $0x1,%al
+  8031a9:	74 d8                	je     803183 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8031ab:	89 d8                	mov    %ebx,%eax
+  8031ad:	c1 e8 0c             	shr    $0xc,%eax
+  8031b0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031b7:	f6 c2 01             	test   $0x1,%dl
+  8031ba:	74 cd                	je     803189 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8031bc:	89 da                	mov    %ebx,%edx
+  8031be:	80 e6 df             	and    $0xdf,%dh
+  8031c1:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8031c7:	74 c0                	je     803189 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8031c9:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8031cb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031d2:	f6 c6 04             	test   $0x4,%dh
+  8031d5:	75 53                	jne    80322a <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8031d7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8031de:	f6 c6 08             	test   $0x8,%dh
+  8031e1:	75 0c                	jne    8031ef <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8031e3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031ea:	f6 c2 02             	test   $0x2,%dl
+  8031ed:	74 3b                	je     80322a <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8031ef:	83 ec 0c             	sub    $0xc,%esp
+  8031f2:	68 05 08 00 00       	push   $0x805
+  8031f7:	57                   	push   %edi
+  8031f8:	ff 75 e4             	push   -0x1c(%ebp)
+  8031fb:	57                   	push   %edi
+  8031fc:	6a 00                	push   $0x0
+  8031fe:	e8 d6 d3 ff ff       	call   8005d9 <sys_page_map>
+  803203:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803205:	83 c4 20             	add    $0x20,%esp
+  803208:	85 c0                	test   %eax,%eax
+  80320a:	0f 88 a7 00 00 00    	js     8032b7 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803210:	83 ec 0c             	sub    $0xc,%esp
+  803213:	68 05 08 00 00       	push   $0x805
+  803218:	57                   	push   %edi
+  803219:	6a 00                	push   $0x0
+  80321b:	57                   	push   %edi
+  80321c:	6a 00                	push   $0x0
+  80321e:	e8 b6 d3 ff ff       	call   8005d9 <sys_page_map>
+  803223:	89 c6                	mov    %eax,%esi
+	return r;
+  803225:	83 c4 20             	add    $0x20,%esp
+  803228:	eb 21                	jmp    80324b <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  80322a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803231:	83 ec 0c             	sub    $0xc,%esp
+  803234:	25 07 0e 00 00       	and    $0xe07,%eax
+  803239:	50                   	push   %eax
+  80323a:	57                   	push   %edi
+  80323b:	ff 75 e4             	push   -0x1c(%ebp)
+  80323e:	57                   	push   %edi
+  80323f:	6a 00                	push   $0x0
+  803241:	e8 93 d3 ff ff       	call   8005d9 <sys_page_map>
+  803246:	89 c6                	mov    %eax,%esi
+  803248:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  80324b:	85 f6                	test   %esi,%esi
+  80324d:	0f 89 36 ff ff ff    	jns    803189 <fork+0x57>
+  803253:	eb 62                	jmp    8032b7 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803255:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80325a:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  80325f:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803262:	89 f8                	mov    %edi,%eax
+  803264:	e8 6f fd ff ff       	call   802fd8 <copy_page_to>
+  803269:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80326b:	85 c0                	test   %eax,%eax
+  80326d:	78 48                	js     8032b7 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80326f:	83 ec 04             	sub    $0x4,%esp
+  803272:	6a 07                	push   $0x7
+  803274:	68 00 f0 bf ee       	push   $0xeebff000
+  803279:	57                   	push   %edi
+  80327a:	e8 0f d3 ff ff       	call   80058e <sys_page_alloc>
+  80327f:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803281:	83 c4 10             	add    $0x10,%esp
+  803284:	85 c0                	test   %eax,%eax
+  803286:	78 2f                	js     8032b7 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803288:	a1 00 50 80 00       	mov    0x805000,%eax
+  80328d:	8b 40 64             	mov    0x64(%eax),%eax
+  803290:	83 ec 08             	sub    $0x8,%esp
+  803293:	50                   	push   %eax
+  803294:	57                   	push   %edi
+  803295:	e8 5f d4 ff ff       	call   8006f9 <sys_env_set_pgfault_upcall>
+  80329a:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80329c:	83 c4 10             	add    $0x10,%esp
+  80329f:	85 c0                	test   %eax,%eax
+  8032a1:	78 14                	js     8032b7 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8032a3:	83 ec 08             	sub    $0x8,%esp
+  8032a6:	6a 02                	push   $0x2
+  8032a8:	57                   	push   %edi
+  8032a9:	e8 b7 d3 ff ff       	call   800665 <sys_env_set_status>
+  8032ae:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032b0:	83 c4 10             	add    $0x10,%esp
+  8032b3:	85 c0                	test   %eax,%eax
+  8032b5:	79 11                	jns    8032c8 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8032b7:	83 ec 0c             	sub    $0xc,%esp
+  8032ba:	ff 75 e0             	push   -0x20(%ebp)
+  8032bd:	e8 3d d2 ff ff       	call   8004ff <sys_env_destroy>
+	return r;
+  8032c2:	83 c4 10             	add    $0x10,%esp
+  8032c5:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8032c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032ce:	5b                   	pop    %ebx
+  8032cf:	5e                   	pop    %esi
+  8032d0:	5f                   	pop    %edi
+  8032d1:	5d                   	pop    %ebp
+  8032d2:	c3                   	ret
+
+008032d3 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8032d3:	55                   	push   %ebp
+  8032d4:	89 e5                	mov    %esp,%ebp
+  8032d6:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8032d9:	68 6b 3d 80 00       	push   $0x803d6b
+  8032de:	68 bf 00 00 00       	push   $0xbf
+  8032e3:	68 60 3d 80 00       	push   $0x803d60
+  8032e8:	e8 5d f6 ff ff       	call   80294a <_panic>
+
+008032ed <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8032ed:	55                   	push   %ebp
+  8032ee:	89 e5                	mov    %esp,%ebp
+  8032f0:	56                   	push   %esi
+  8032f1:	53                   	push   %ebx
+  8032f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032fb:	85 c0                	test   %eax,%eax
+  8032fd:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803302:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803305:	83 ec 0c             	sub    $0xc,%esp
+  803308:	50                   	push   %eax
+  803309:	e8 c8 d4 ff ff       	call   8007d6 <sys_ipc_recv>
+	if (from_env_store)
+  80330e:	83 c4 10             	add    $0x10,%esp
+  803311:	85 f6                	test   %esi,%esi
+  803313:	74 14                	je     803329 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803315:	ba 00 00 00 00       	mov    $0x0,%edx
+  80331a:	85 c0                	test   %eax,%eax
+  80331c:	75 09                	jne    803327 <ipc_recv+0x3a>
+  80331e:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803324:	8b 52 74             	mov    0x74(%edx),%edx
+  803327:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803329:	85 db                	test   %ebx,%ebx
+  80332b:	74 25                	je     803352 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80332d:	85 c0                	test   %eax,%eax
+  80332f:	74 0d                	je     80333e <ipc_recv+0x51>
+  803331:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803337:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80333a:	5b                   	pop    %ebx
+  80333b:	5e                   	pop    %esi
+  80333c:	5d                   	pop    %ebp
+  80333d:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80333e:	a1 00 50 80 00       	mov    0x805000,%eax
+  803343:	8b 40 78             	mov    0x78(%eax),%eax
+  803346:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803348:	a1 00 50 80 00       	mov    0x805000,%eax
+  80334d:	8b 40 70             	mov    0x70(%eax),%eax
+  803350:	eb e5                	jmp    803337 <ipc_recv+0x4a>
+  803352:	85 c0                	test   %eax,%eax
+  803354:	75 e1                	jne    803337 <ipc_recv+0x4a>
+  803356:	eb f0                	jmp    803348 <ipc_recv+0x5b>
+
+00803358 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803358:	55                   	push   %ebp
+  803359:	89 e5                	mov    %esp,%ebp
+  80335b:	57                   	push   %edi
+  80335c:	56                   	push   %esi
+  80335d:	53                   	push   %ebx
+  80335e:	83 ec 0c             	sub    $0xc,%esp
+  803361:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803364:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803367:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80336a:	85 db                	test   %ebx,%ebx
+  80336c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803371:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803374:	ff 75 14             	push   0x14(%ebp)
+  803377:	53                   	push   %ebx
+  803378:	56                   	push   %esi
+  803379:	57                   	push   %edi
+  80337a:	e8 c4 d3 ff ff       	call   800743 <sys_ipc_try_send>
+  80337f:	83 c4 10             	add    $0x10,%esp
+  803382:	85 c0                	test   %eax,%eax
+  803384:	74 22                	je     8033a8 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803386:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803389:	75 07                	jne    803392 <ipc_send+0x3a>
+		sys_yield();
+  80338b:	e8 df d1 ff ff       	call   80056f <sys_yield>
+  803390:	eb e2                	jmp    803374 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803392:	68 81 3d 80 00       	push   $0x803d81
+  803397:	68 e8 38 80 00       	push   $0x8038e8
+  80339c:	6a 39                	push   $0x39
+  80339e:	68 96 3d 80 00       	push   $0x803d96
+  8033a3:	e8 a2 f5 ff ff       	call   80294a <_panic>
+	}
+}
+  8033a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033ab:	5b                   	pop    %ebx
+  8033ac:	5e                   	pop    %esi
+  8033ad:	5f                   	pop    %edi
+  8033ae:	5d                   	pop    %ebp
+  8033af:	c3                   	ret
+
+008033b0 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  8033b0:	55                   	push   %ebp
+  8033b1:	89 e5                	mov    %esp,%ebp
+  8033b3:	57                   	push   %edi
+  8033b4:	56                   	push   %esi
+  8033b5:	53                   	push   %ebx
+  8033b6:	83 ec 10             	sub    $0x10,%esp
+  8033b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033c2:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8033c5:	85 c0                	test   %eax,%eax
+  8033c7:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8033cc:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8033cf:	6a 00                	push   $0x0
+  8033d1:	ff 33                	push   (%ebx)
+  8033d3:	50                   	push   %eax
+  8033d4:	e8 ba d3 ff ff       	call   800793 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8033d9:	83 c4 10             	add    $0x10,%esp
+  8033dc:	85 c0                	test   %eax,%eax
+  8033de:	75 3c                	jne    80341c <ipc_recvv+0x6c>
+  8033e0:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8033e6:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8033e9:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8033eb:	85 ff                	test   %edi,%edi
+  8033ed:	74 4e                	je     80343d <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8033ef:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8033f5:	8b 52 74             	mov    0x74(%edx),%edx
+  8033f8:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8033fa:	85 f6                	test   %esi,%esi
+  8033fc:	74 18                	je     803416 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033fe:	85 c0                	test   %eax,%eax
+  803400:	75 2d                	jne    80342f <ipc_recvv+0x7f>
+  803402:	a1 00 50 80 00       	mov    0x805000,%eax
+  803407:	8b 40 78             	mov    0x78(%eax),%eax
+  80340a:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  80340c:	a1 00 50 80 00       	mov    0x805000,%eax
+  803411:	8b 40 70             	mov    0x70(%eax),%eax
+  803414:	eb 1f                	jmp    803435 <ipc_recvv+0x85>
+  803416:	85 c0                	test   %eax,%eax
+  803418:	75 1b                	jne    803435 <ipc_recvv+0x85>
+  80341a:	eb f0                	jmp    80340c <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80341c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803422:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803427:	85 ff                	test   %edi,%edi
+  803429:	75 cd                	jne    8033f8 <ipc_recvv+0x48>
+	if (perm_store)
+  80342b:	85 f6                	test   %esi,%esi
+  80342d:	74 e7                	je     803416 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80342f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803435:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803438:	5b                   	pop    %ebx
+  803439:	5e                   	pop    %esi
+  80343a:	5f                   	pop    %edi
+  80343b:	5d                   	pop    %ebp
+  80343c:	c3                   	ret
+	if (perm_store)
+  80343d:	85 f6                	test   %esi,%esi
+  80343f:	75 bd                	jne    8033fe <ipc_recvv+0x4e>
+  803441:	eb c9                	jmp    80340c <ipc_recvv+0x5c>
+
+00803443 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803443:	55                   	push   %ebp
+  803444:	89 e5                	mov    %esp,%ebp
+  803446:	57                   	push   %edi
+  803447:	56                   	push   %esi
+  803448:	53                   	push   %ebx
+  803449:	83 ec 0c             	sub    $0xc,%esp
+  80344c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80344f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803452:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  803455:	ff 75 14             	push   0x14(%ebp)
+  803458:	53                   	push   %ebx
+  803459:	56                   	push   %esi
+  80345a:	57                   	push   %edi
+  80345b:	e8 0b d3 ff ff       	call   80076b <sys_ipc_try_sendv>
+  803460:	83 c4 10             	add    $0x10,%esp
+  803463:	85 c0                	test   %eax,%eax
+  803465:	74 22                	je     803489 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803467:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80346a:	75 07                	jne    803473 <ipc_sendv+0x30>
+		sys_yield();
+  80346c:	e8 fe d0 ff ff       	call   80056f <sys_yield>
+  803471:	eb e2                	jmp    803455 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803473:	68 81 3d 80 00       	push   $0x803d81
+  803478:	68 e8 38 80 00       	push   $0x8038e8
+  80347d:	6a 5c                	push   $0x5c
+  80347f:	68 96 3d 80 00       	push   $0x803d96
+  803484:	e8 c1 f4 ff ff       	call   80294a <_panic>
+	}
+}
+  803489:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80348c:	5b                   	pop    %ebx
+  80348d:	5e                   	pop    %esi
+  80348e:	5f                   	pop    %edi
+  80348f:	5d                   	pop    %ebp
+  803490:	c3                   	ret
+
+00803491 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803491:	55                   	push   %ebp
+  803492:	89 e5                	mov    %esp,%ebp
+  803494:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803497:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80349c:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8034a2:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8034a8:	8b 52 50             	mov    0x50(%edx),%edx
+  8034ab:	39 ca                	cmp    %ecx,%edx
+  8034ad:	74 11                	je     8034c0 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8034af:	83 c0 01             	add    $0x1,%eax
+  8034b2:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8034b7:	75 e3                	jne    80349c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8034b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034be:	eb 0e                	jmp    8034ce <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8034c0:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8034c6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8034cb:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8034ce:	5d                   	pop    %ebp
+  8034cf:	c3                   	ret
+
+008034d0 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8034d0:	55                   	push   %ebp
+  8034d1:	89 e5                	mov    %esp,%ebp
+  8034d3:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8034d6:	89 c2                	mov    %eax,%edx
+  8034d8:	c1 ea 16             	shr    $0x16,%edx
+  8034db:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8034e2:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8034e7:	f6 c1 01             	test   $0x1,%cl
+  8034ea:	74 22                	je     80350e <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8034ec:	c1 e8 0c             	shr    $0xc,%eax
+  8034ef:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8034f6:	a8 01                	test   $0x1,%al
+  8034f8:	74 14                	je     80350e <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8034fa:	c1 e8 0c             	shr    $0xc,%eax
+  8034fd:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803500:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803507:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  80350b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80350e:	89 d0                	mov    %edx,%eax
+  803510:	5d                   	pop    %ebp
+  803511:	c3                   	ret
+
+00803512 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803512:	55                   	push   %ebp
+  803513:	89 e5                	mov    %esp,%ebp
+  803515:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803518:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  80351f:	74 0a                	je     80352b <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803521:	8b 45 08             	mov    0x8(%ebp),%eax
+  803524:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  803529:	c9                   	leave
+  80352a:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80352b:	83 ec 04             	sub    $0x4,%esp
+  80352e:	6a 07                	push   $0x7
+  803530:	68 00 f0 bf ee       	push   $0xeebff000
+  803535:	6a 00                	push   $0x0
+  803537:	e8 52 d0 ff ff       	call   80058e <sys_page_alloc>
+  80353c:	83 c4 10             	add    $0x10,%esp
+  80353f:	85 c0                	test   %eax,%eax
+  803541:	75 2c                	jne    80356f <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803543:	83 ec 08             	sub    $0x8,%esp
+  803546:	68 85 35 80 00       	push   $0x803585
+  80354b:	6a 00                	push   $0x0
+  80354d:	e8 a7 d1 ff ff       	call   8006f9 <sys_env_set_pgfault_upcall>
+  803552:	83 c4 10             	add    $0x10,%esp
+  803555:	85 c0                	test   %eax,%eax
+  803557:	74 c8                	je     803521 <set_pgfault_handler+0xf>
+  803559:	68 e8 3d 80 00       	push   $0x803de8
+  80355e:	68 e8 38 80 00       	push   $0x8038e8
+  803563:	6a 20                	push   $0x20
+  803565:	68 18 3e 80 00       	push   $0x803e18
+  80356a:	e8 db f3 ff ff       	call   80294a <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80356f:	68 a0 3d 80 00       	push   $0x803da0
+  803574:	68 e8 38 80 00       	push   $0x8038e8
+  803579:	6a 1e                	push   $0x1e
+  80357b:	68 18 3e 80 00       	push   $0x803e18
+  803580:	e8 c5 f3 ff ff       	call   80294a <_panic>
+
+00803585 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803585:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803586:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  80358b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80358d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803590:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803595:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  80359a:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  80359e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8035a1:	83 c4 08             	add    $0x8,%esp
+	popal
+  8035a4:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8035a5:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8035a8:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8035a9:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8035aa:	c3                   	ret
+
+008035ab <dm>:
+  8035ab:	55                   	push   %ebp
+  8035ac:	57                   	push   %edi
+  8035ad:	56                   	push   %esi
+  8035ae:	53                   	push   %ebx
+  8035af:	83 ec 24             	sub    $0x24,%esp
+  8035b2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8035b6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035ba:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035be:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035c2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035c6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035ca:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8035ce:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035dd:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035e4:	00 
+  8035e5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035ec:	00 
+  8035ed:	89 fb                	mov    %edi,%ebx
+  8035ef:	eb 08                	jmp    8035f9 <dm+0x4e>
+  8035f1:	83 e9 01             	sub    $0x1,%ecx
+  8035f4:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8035f7:	74 68                	je     803661 <dm+0xb6>
+  8035f9:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8035fd:	01 c0                	add    %eax,%eax
+  8035ff:	89 c6                	mov    %eax,%esi
+  803601:	89 d7                	mov    %edx,%edi
+  803603:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803607:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80360b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80360e:	d3 ea                	shr    %cl,%edx
+  803610:	f6 c1 20             	test   $0x20,%cl
+  803613:	74 04                	je     803619 <dm+0x6e>
+  803615:	89 d0                	mov    %edx,%eax
+  803617:	31 d2                	xor    %edx,%edx
+  803619:	83 e0 01             	and    $0x1,%eax
+  80361c:	89 04 24             	mov    %eax,(%esp)
+  80361f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803626:	00 
+  803627:	8b 04 24             	mov    (%esp),%eax
+  80362a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80362e:	09 f0                	or     %esi,%eax
+  803630:	09 fa                	or     %edi,%edx
+  803632:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803636:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80363a:	39 f0                	cmp    %esi,%eax
+  80363c:	89 d5                	mov    %edx,%ebp
+  80363e:	19 fd                	sbb    %edi,%ebp
+  803640:	72 af                	jb     8035f1 <dm+0x46>
+  803642:	29 f0                	sub    %esi,%eax
+  803644:	19 fa                	sbb    %edi,%edx
+  803646:	89 cf                	mov    %ecx,%edi
+  803648:	c1 ef 05             	shr    $0x5,%edi
+  80364b:	83 e7 01             	and    $0x1,%edi
+  80364e:	89 fe                	mov    %edi,%esi
+  803650:	83 f6 01             	xor    $0x1,%esi
+  803653:	d3 e6                	shl    %cl,%esi
+  803655:	d3 e7                	shl    %cl,%edi
+  803657:	09 74 24 18          	or     %esi,0x18(%esp)
+  80365b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80365f:	eb 90                	jmp    8035f1 <dm+0x46>
+  803661:	85 db                	test   %ebx,%ebx
+  803663:	74 05                	je     80366a <dm+0xbf>
+  803665:	89 03                	mov    %eax,(%ebx)
+  803667:	89 53 04             	mov    %edx,0x4(%ebx)
+  80366a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80366e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803672:	83 c4 24             	add    $0x24,%esp
+  803675:	5b                   	pop    %ebx
+  803676:	5e                   	pop    %esi
+  803677:	5f                   	pop    %edi
+  803678:	5d                   	pop    %ebp
+  803679:	c3                   	ret
+
+0080367a <__udivdi3>:
+  80367a:	83 ec 08             	sub    $0x8,%esp
+  80367d:	6a 00                	push   $0x0
+  80367f:	ff 74 24 1c          	push   0x1c(%esp)
+  803683:	ff 74 24 1c          	push   0x1c(%esp)
+  803687:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80368b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80368f:	e8 17 ff ff ff       	call   8035ab <dm>
+  803694:	83 c4 14             	add    $0x14,%esp
+  803697:	c3                   	ret
+
+00803698 <__umoddi3>:
+  803698:	83 ec 18             	sub    $0x18,%esp
+  80369b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80369f:	50                   	push   %eax
+  8036a0:	ff 74 24 2c          	push   0x2c(%esp)
+  8036a4:	ff 74 24 2c          	push   0x2c(%esp)
+  8036a8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036ac:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036b0:	e8 f6 fe ff ff       	call   8035ab <dm>
+  8036b5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036b9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036bd:	83 c4 24             	add    $0x24,%esp
+  8036c0:	c3                   	ret
+
+008036c1 <__divdi3>:
+  8036c1:	53                   	push   %ebx
+  8036c2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036c6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036ca:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8036ce:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036d2:	85 d2                	test   %edx,%edx
+  8036d4:	78 15                	js     8036eb <__divdi3+0x2a>
+  8036d6:	85 db                	test   %ebx,%ebx
+  8036d8:	78 34                	js     80370e <__divdi3+0x4d>
+  8036da:	83 ec 04             	sub    $0x4,%esp
+  8036dd:	6a 00                	push   $0x0
+  8036df:	53                   	push   %ebx
+  8036e0:	51                   	push   %ecx
+  8036e1:	e8 c5 fe ff ff       	call   8035ab <dm>
+  8036e6:	83 c4 10             	add    $0x10,%esp
+  8036e9:	eb 21                	jmp    80370c <__divdi3+0x4b>
+  8036eb:	f7 d8                	neg    %eax
+  8036ed:	83 d2 00             	adc    $0x0,%edx
+  8036f0:	f7 da                	neg    %edx
+  8036f2:	85 db                	test   %ebx,%ebx
+  8036f4:	78 30                	js     803726 <__divdi3+0x65>
+  8036f6:	83 ec 04             	sub    $0x4,%esp
+  8036f9:	6a 00                	push   $0x0
+  8036fb:	53                   	push   %ebx
+  8036fc:	51                   	push   %ecx
+  8036fd:	e8 a9 fe ff ff       	call   8035ab <dm>
+  803702:	83 c4 10             	add    $0x10,%esp
+  803705:	f7 d8                	neg    %eax
+  803707:	83 d2 00             	adc    $0x0,%edx
+  80370a:	f7 da                	neg    %edx
+  80370c:	5b                   	pop    %ebx
+  80370d:	c3                   	ret
+  80370e:	83 ec 04             	sub    $0x4,%esp
+  803711:	6a 00                	push   $0x0
+  803713:	f7 d9                	neg    %ecx
+  803715:	83 d3 00             	adc    $0x0,%ebx
+  803718:	f7 db                	neg    %ebx
+  80371a:	53                   	push   %ebx
+  80371b:	51                   	push   %ecx
+  80371c:	e8 8a fe ff ff       	call   8035ab <dm>
+  803721:	83 c4 10             	add    $0x10,%esp
+  803724:	eb df                	jmp    803705 <__divdi3+0x44>
+  803726:	83 ec 04             	sub    $0x4,%esp
+  803729:	6a 00                	push   $0x0
+  80372b:	f7 d9                	neg    %ecx
+  80372d:	83 d3 00             	adc    $0x0,%ebx
+  803730:	f7 db                	neg    %ebx
+  803732:	53                   	push   %ebx
+  803733:	51                   	push   %ecx
+  803734:	e8 72 fe ff ff       	call   8035ab <dm>
+  803739:	83 c4 10             	add    $0x10,%esp
+  80373c:	eb ce                	jmp    80370c <__divdi3+0x4b>
+
+0080373e <__moddi3>:
+  80373e:	55                   	push   %ebp
+  80373f:	57                   	push   %edi
+  803740:	56                   	push   %esi
+  803741:	53                   	push   %ebx
+  803742:	83 ec 24             	sub    $0x24,%esp
+  803745:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803749:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80374d:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803751:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803755:	85 d2                	test   %edx,%edx
+  803757:	78 3b                	js     803794 <__moddi3+0x56>
+  803759:	83 ec 04             	sub    $0x4,%esp
+  80375c:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803760:	56                   	push   %esi
+  803761:	89 ce                	mov    %ecx,%esi
+  803763:	f7 de                	neg    %esi
+  803765:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803769:	89 de                	mov    %ebx,%esi
+  80376b:	83 d6 00             	adc    $0x0,%esi
+  80376e:	f7 de                	neg    %esi
+  803770:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803774:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803778:	0f 48 f1             	cmovs  %ecx,%esi
+  80377b:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803780:	53                   	push   %ebx
+  803781:	56                   	push   %esi
+  803782:	e8 24 fe ff ff       	call   8035ab <dm>
+  803787:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80378b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80378f:	83 c4 10             	add    $0x10,%esp
+  803792:	eb 47                	jmp    8037db <__moddi3+0x9d>
+  803794:	f7 d8                	neg    %eax
+  803796:	83 d2 00             	adc    $0x0,%edx
+  803799:	f7 da                	neg    %edx
+  80379b:	83 ec 04             	sub    $0x4,%esp
+  80379e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8037a2:	56                   	push   %esi
+  8037a3:	89 cf                	mov    %ecx,%edi
+  8037a5:	f7 df                	neg    %edi
+  8037a7:	89 de                	mov    %ebx,%esi
+  8037a9:	83 d6 00             	adc    $0x0,%esi
+  8037ac:	f7 de                	neg    %esi
+  8037ae:	0f 49 cf             	cmovns %edi,%ecx
+  8037b1:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8037b5:	0f 49 de             	cmovns %esi,%ebx
+  8037b8:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8037bc:	ff 74 24 0c          	push   0xc(%esp)
+  8037c0:	ff 74 24 0c          	push   0xc(%esp)
+  8037c4:	e8 e2 fd ff ff       	call   8035ab <dm>
+  8037c9:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037cd:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037d1:	f7 d8                	neg    %eax
+  8037d3:	83 d2 00             	adc    $0x0,%edx
+  8037d6:	f7 da                	neg    %edx
+  8037d8:	83 c4 10             	add    $0x10,%esp
+  8037db:	83 c4 24             	add    $0x24,%esp
+  8037de:	5b                   	pop    %ebx
+  8037df:	5e                   	pop    %esi
+  8037e0:	5f                   	pop    %edi
+  8037e1:	5d                   	pop    %ebp
+  8037e2:	c3                   	ret
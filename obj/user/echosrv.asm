@@ -0,0 +1,8271 @@
+
+obj/user/echosrv.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 be 04 00 00       	call   8004ef <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+#define BUFFSIZE 32
+#define MAXPENDING 5    // Max connection requests
+
+static void
+die(char *m)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 50 3c 80 00       	push   $0x803c50
+  80003f:	e8 a3 05 00 00       	call   8005e7 <cprintf>
+	exit();
+  800044:	e8 ef 04 00 00       	call   800538 <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <handle_client>:
+
+void
+handle_client(int sock)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 30             	sub    $0x30,%esp
+  800057:	8b 75 08             	mov    0x8(%ebp),%esi
+	char buffer[BUFFSIZE];
+	int received = -1;
+	// Receive message
+	if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  80005a:	6a 20                	push   $0x20
+  80005c:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80005f:	50                   	push   %eax
+  800060:	56                   	push   %esi
+  800061:	e8 5f 16 00 00       	call   8016c5 <read>
+  800066:	89 c3                	mov    %eax,%ebx
+  800068:	83 c4 10             	add    $0x10,%esp
+		die("Failed to receive initial bytes from client");
+
+	// Send bytes and check for more incoming data in loop
+	while (received > 0) {
+		// Send back received data
+		if (write(sock, buffer, received) != received)
+  80006b:	8d 7d c8             	lea    -0x38(%ebp),%edi
+	if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  80006e:	85 c0                	test   %eax,%eax
+  800070:	79 33                	jns    8000a5 <handle_client+0x57>
+		die("Failed to receive initial bytes from client");
+  800072:	b8 54 3c 80 00       	mov    $0x803c54,%eax
+  800077:	e8 b7 ff ff ff       	call   800033 <die>
+
+		// Check for more data
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+			die("Failed to receive additional bytes from client");
+	}
+	close(sock);
+  80007c:	83 ec 0c             	sub    $0xc,%esp
+  80007f:	56                   	push   %esi
+  800080:	e8 04 15 00 00       	call   801589 <close>
+}
+  800085:	83 c4 10             	add    $0x10,%esp
+  800088:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80008b:	5b                   	pop    %ebx
+  80008c:	5e                   	pop    %esi
+  80008d:	5f                   	pop    %edi
+  80008e:	5d                   	pop    %ebp
+  80008f:	c3                   	ret
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  800090:	83 ec 04             	sub    $0x4,%esp
+  800093:	6a 20                	push   $0x20
+  800095:	57                   	push   %edi
+  800096:	56                   	push   %esi
+  800097:	e8 29 16 00 00       	call   8016c5 <read>
+  80009c:	89 c3                	mov    %eax,%ebx
+  80009e:	83 c4 10             	add    $0x10,%esp
+  8000a1:	85 c0                	test   %eax,%eax
+  8000a3:	78 22                	js     8000c7 <handle_client+0x79>
+	while (received > 0) {
+  8000a5:	85 db                	test   %ebx,%ebx
+  8000a7:	7e d3                	jle    80007c <handle_client+0x2e>
+		if (write(sock, buffer, received) != received)
+  8000a9:	83 ec 04             	sub    $0x4,%esp
+  8000ac:	53                   	push   %ebx
+  8000ad:	57                   	push   %edi
+  8000ae:	56                   	push   %esi
+  8000af:	e8 df 16 00 00       	call   801793 <write>
+  8000b4:	83 c4 10             	add    $0x10,%esp
+  8000b7:	39 d8                	cmp    %ebx,%eax
+  8000b9:	74 d5                	je     800090 <handle_client+0x42>
+			die("Failed to send bytes to client");
+  8000bb:	b8 80 3c 80 00       	mov    $0x803c80,%eax
+  8000c0:	e8 6e ff ff ff       	call   800033 <die>
+  8000c5:	eb c9                	jmp    800090 <handle_client+0x42>
+			die("Failed to receive additional bytes from client");
+  8000c7:	b8 a0 3c 80 00       	mov    $0x803ca0,%eax
+  8000cc:	e8 62 ff ff ff       	call   800033 <die>
+  8000d1:	eb d2                	jmp    8000a5 <handle_client+0x57>
+
+008000d3 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000d3:	55                   	push   %ebp
+  8000d4:	89 e5                	mov    %esp,%ebp
+  8000d6:	57                   	push   %edi
+  8000d7:	56                   	push   %esi
+  8000d8:	53                   	push   %ebx
+  8000d9:	83 ec 40             	sub    $0x40,%esp
+	char buffer[BUFFSIZE];
+	unsigned int echolen;
+	int received = 0;
+
+	// Create the TCP socket
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  8000dc:	6a 06                	push   $0x6
+  8000de:	6a 01                	push   $0x1
+  8000e0:	6a 02                	push   $0x2
+  8000e2:	e8 79 2b 00 00       	call   802c60 <socket>
+  8000e7:	89 c6                	mov    %eax,%esi
+  8000e9:	83 c4 10             	add    $0x10,%esp
+  8000ec:	85 c0                	test   %eax,%eax
+  8000ee:	0f 88 86 00 00 00    	js     80017a <umain+0xa7>
+		die("Failed to create socket");
+
+	cprintf("opened socket\n");
+  8000f4:	83 ec 0c             	sub    $0xc,%esp
+  8000f7:	68 18 3c 80 00       	push   $0x803c18
+  8000fc:	e8 e6 04 00 00       	call   8005e7 <cprintf>
+
+	// Construct the server sockaddr_in structure
+	memset(&echoserver, 0, sizeof(echoserver));       // Clear struct
+  800101:	83 c4 0c             	add    $0xc,%esp
+  800104:	6a 10                	push   $0x10
+  800106:	6a 00                	push   $0x0
+  800108:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  80010b:	53                   	push   %ebx
+  80010c:	e8 15 0c 00 00       	call   800d26 <memset>
+	echoserver.sin_family = AF_INET;                  // Internet/IP
+  800111:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	echoserver.sin_addr.s_addr = htonl(INADDR_ANY);   // IP address
+  800115:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80011c:	e8 90 01 00 00       	call   8002b1 <htonl>
+  800121:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	echoserver.sin_port = htons(PORT);		  // server port
+  800124:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80012b:	e8 67 01 00 00       	call   800297 <htons>
+  800130:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	cprintf("trying to bind\n");
+  800134:	c7 04 24 27 3c 80 00 	movl   $0x803c27,(%esp)
+  80013b:	e8 a7 04 00 00       	call   8005e7 <cprintf>
+
+	// Bind the server socket
+	if (bind(serversock, (struct sockaddr *) &echoserver,
+  800140:	83 c4 0c             	add    $0xc,%esp
+  800143:	6a 10                	push   $0x10
+  800145:	53                   	push   %ebx
+  800146:	56                   	push   %esi
+  800147:	e8 82 2a 00 00       	call   802bce <bind>
+  80014c:	83 c4 10             	add    $0x10,%esp
+  80014f:	85 c0                	test   %eax,%eax
+  800151:	78 36                	js     800189 <umain+0xb6>
+		 sizeof(echoserver)) < 0) {
+		die("Failed to bind the server socket");
+	}
+
+	// Listen on the server socket
+	if (listen(serversock, MAXPENDING) < 0)
+  800153:	83 ec 08             	sub    $0x8,%esp
+  800156:	6a 05                	push   $0x5
+  800158:	56                   	push   %esi
+  800159:	e8 df 2a 00 00       	call   802c3d <listen>
+  80015e:	83 c4 10             	add    $0x10,%esp
+  800161:	85 c0                	test   %eax,%eax
+  800163:	78 30                	js     800195 <umain+0xc2>
+		die("Failed to listen on server socket");
+
+	cprintf("bound\n");
+  800165:	83 ec 0c             	sub    $0xc,%esp
+  800168:	68 37 3c 80 00       	push   $0x803c37
+  80016d:	e8 75 04 00 00       	call   8005e7 <cprintf>
+  800172:	83 c4 10             	add    $0x10,%esp
+	// Run until canceled
+	while (1) {
+		unsigned int clientlen = sizeof(echoclient);
+		// Wait for client connection
+		if ((clientsock =
+		     accept(serversock, (struct sockaddr *) &echoclient,
+  800175:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+  800178:	eb 55                	jmp    8001cf <umain+0xfc>
+		die("Failed to create socket");
+  80017a:	b8 00 3c 80 00       	mov    $0x803c00,%eax
+  80017f:	e8 af fe ff ff       	call   800033 <die>
+  800184:	e9 6b ff ff ff       	jmp    8000f4 <umain+0x21>
+		die("Failed to bind the server socket");
+  800189:	b8 d0 3c 80 00       	mov    $0x803cd0,%eax
+  80018e:	e8 a0 fe ff ff       	call   800033 <die>
+  800193:	eb be                	jmp    800153 <umain+0x80>
+		die("Failed to listen on server socket");
+  800195:	b8 f4 3c 80 00       	mov    $0x803cf4,%eax
+  80019a:	e8 94 fe ff ff       	call   800033 <die>
+  80019f:	eb c4                	jmp    800165 <umain+0x92>
+			    &clientlen)) < 0) {
+			die("Failed to accept client connection");
+  8001a1:	b8 18 3d 80 00       	mov    $0x803d18,%eax
+  8001a6:	e8 88 fe ff ff       	call   800033 <die>
+		}
+		cprintf("Client connected: %s\n", inet_ntoa(echoclient.sin_addr));
+  8001ab:	83 ec 0c             	sub    $0xc,%esp
+  8001ae:	ff 75 cc             	push   -0x34(%ebp)
+  8001b1:	e8 39 00 00 00       	call   8001ef <inet_ntoa>
+  8001b6:	83 c4 08             	add    $0x8,%esp
+  8001b9:	50                   	push   %eax
+  8001ba:	68 3e 3c 80 00       	push   $0x803c3e
+  8001bf:	e8 23 04 00 00       	call   8005e7 <cprintf>
+		handle_client(clientsock);
+  8001c4:	89 1c 24             	mov    %ebx,(%esp)
+  8001c7:	e8 82 fe ff ff       	call   80004e <handle_client>
+	while (1) {
+  8001cc:	83 c4 10             	add    $0x10,%esp
+		unsigned int clientlen = sizeof(echoclient);
+  8001cf:	c7 45 c4 10 00 00 00 	movl   $0x10,-0x3c(%ebp)
+		     accept(serversock, (struct sockaddr *) &echoclient,
+  8001d6:	83 ec 04             	sub    $0x4,%esp
+  8001d9:	57                   	push   %edi
+  8001da:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8001dd:	50                   	push   %eax
+  8001de:	56                   	push   %esi
+  8001df:	e8 bb 29 00 00       	call   802b9f <accept>
+  8001e4:	89 c3                	mov    %eax,%ebx
+		if ((clientsock =
+  8001e6:	83 c4 10             	add    $0x10,%esp
+  8001e9:	85 c0                	test   %eax,%eax
+  8001eb:	78 b4                	js     8001a1 <umain+0xce>
+  8001ed:	eb bc                	jmp    8001ab <umain+0xd8>
+
+008001ef <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8001ef:	55                   	push   %ebp
+  8001f0:	89 e5                	mov    %esp,%ebp
+  8001f2:	57                   	push   %edi
+  8001f3:	56                   	push   %esi
+  8001f4:	53                   	push   %ebx
+  8001f5:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8001f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001fb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8001fe:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  800201:	b9 00 60 80 00       	mov    $0x806000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  800206:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  80020b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80020e:	eb 31                	jmp    800241 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  800210:	0f b6 c8             	movzbl %al,%ecx
+  800213:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  800218:	88 0a                	mov    %cl,(%edx)
+  80021a:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  80021d:	83 e8 01             	sub    $0x1,%eax
+  800220:	3c ff                	cmp    $0xff,%al
+  800222:	75 ec                	jne    800210 <inet_ntoa+0x21>
+  800224:	0f b6 db             	movzbl %bl,%ebx
+  800227:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80022a:	01 d8                	add    %ebx,%eax
+  80022c:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  80022e:	8d 40 01             	lea    0x1(%eax),%eax
+  800231:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800234:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  800237:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  80023a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80023d:	39 c7                	cmp    %eax,%edi
+  80023f:	74 46                	je     800287 <inet_ntoa+0x98>
+  800241:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  800244:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800249:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  80024c:	89 f0                	mov    %esi,%eax
+  80024e:	f6 e2                	mul    %dl
+  800250:	66 c1 e8 0b          	shr    $0xb,%ax
+  800254:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  800257:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  80025a:	01 c9                	add    %ecx,%ecx
+  80025c:	89 d0                	mov    %edx,%eax
+  80025e:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800260:	89 d7                	mov    %edx,%edi
+  800262:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800266:	89 d9                	mov    %ebx,%ecx
+  800268:	83 c3 01             	add    $0x1,%ebx
+  80026b:	0f b6 c9             	movzbl %cl,%ecx
+  80026e:	83 c0 30             	add    $0x30,%eax
+  800271:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  800275:	89 f8                	mov    %edi,%eax
+  800277:	3c 09                	cmp    $0x9,%al
+  800279:	77 d1                	ja     80024c <inet_ntoa+0x5d>
+  80027b:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80027e:	88 17                	mov    %dl,(%edi)
+  800280:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800283:	89 d8                	mov    %ebx,%eax
+  800285:	eb 96                	jmp    80021d <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  800287:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  80028a:	b8 00 60 80 00       	mov    $0x806000,%eax
+  80028f:	83 c4 1c             	add    $0x1c,%esp
+  800292:	5b                   	pop    %ebx
+  800293:	5e                   	pop    %esi
+  800294:	5f                   	pop    %edi
+  800295:	5d                   	pop    %ebp
+  800296:	c3                   	ret
+
+00800297 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80029a:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  80029e:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  8002a2:	5d                   	pop    %ebp
+  8002a3:	c3                   	ret
+
+008002a4 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8002a7:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8002ab:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  8002af:	5d                   	pop    %ebp
+  8002b0:	c3                   	ret
+
+008002b1 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  8002b1:	55                   	push   %ebp
+  8002b2:	89 e5                	mov    %esp,%ebp
+  8002b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  8002b7:	89 d0                	mov    %edx,%eax
+  8002b9:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  8002bc:	89 d1                	mov    %edx,%ecx
+  8002be:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002c1:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  8002c3:	89 d1                	mov    %edx,%ecx
+  8002c5:	c1 e1 08             	shl    $0x8,%ecx
+  8002c8:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002ce:	09 c8                	or     %ecx,%eax
+  8002d0:	c1 ea 08             	shr    $0x8,%edx
+  8002d3:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8002d9:	09 d0                	or     %edx,%eax
+}
+  8002db:	5d                   	pop    %ebp
+  8002dc:	c3                   	ret
+
+008002dd <inet_aton>:
+{
+  8002dd:	55                   	push   %ebp
+  8002de:	89 e5                	mov    %esp,%ebp
+  8002e0:	57                   	push   %edi
+  8002e1:	56                   	push   %esi
+  8002e2:	53                   	push   %ebx
+  8002e3:	83 ec 2c             	sub    $0x2c,%esp
+  8002e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8002e9:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8002ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8002ef:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8002f2:	e9 9b 00 00 00       	jmp    800392 <inet_aton+0xb5>
+      c = *++cp;
+  8002f7:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8002fb:	89 c1                	mov    %eax,%ecx
+  8002fd:	83 e1 df             	and    $0xffffffdf,%ecx
+  800300:	80 f9 58             	cmp    $0x58,%cl
+  800303:	74 10                	je     800315 <inet_aton+0x38>
+      c = *++cp;
+  800305:	83 c2 01             	add    $0x1,%edx
+  800308:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  80030b:	bf 08 00 00 00       	mov    $0x8,%edi
+  800310:	e9 97 00 00 00       	jmp    8003ac <inet_aton+0xcf>
+        c = *++cp;
+  800315:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  800319:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  80031c:	bf 10 00 00 00       	mov    $0x10,%edi
+  800321:	e9 86 00 00 00       	jmp    8003ac <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  800326:	0f af d7             	imul   %edi,%edx
+  800329:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  80032d:	0f be 01             	movsbl (%ecx),%eax
+  800330:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  800333:	88 45 d7             	mov    %al,-0x29(%ebp)
+  800336:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  800339:	80 fb 09             	cmp    $0x9,%bl
+  80033c:	76 e8                	jbe    800326 <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  80033e:	83 ff 10             	cmp    $0x10,%edi
+  800341:	75 2e                	jne    800371 <inet_aton+0x94>
+  800343:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  800347:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  80034a:	83 e3 df             	and    $0xffffffdf,%ebx
+  80034d:	83 eb 41             	sub    $0x41,%ebx
+  800350:	80 fb 05             	cmp    $0x5,%bl
+  800353:	77 1c                	ja     800371 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  800355:	c1 e2 04             	shl    $0x4,%edx
+  800358:	83 c0 0a             	add    $0xa,%eax
+  80035b:	89 f3                	mov    %esi,%ebx
+  80035d:	80 fb 1a             	cmp    $0x1a,%bl
+  800360:	19 db                	sbb    %ebx,%ebx
+  800362:	83 e3 20             	and    $0x20,%ebx
+  800365:	83 c3 41             	add    $0x41,%ebx
+  800368:	29 d8                	sub    %ebx,%eax
+  80036a:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  80036c:	0f be 01             	movsbl (%ecx),%eax
+  80036f:	eb bf                	jmp    800330 <inet_aton+0x53>
+    if (c == '.') {
+  800371:	83 f8 2e             	cmp    $0x2e,%eax
+  800374:	75 43                	jne    8003b9 <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  800376:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800379:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80037c:	39 f0                	cmp    %esi,%eax
+  80037e:	0f 84 22 01 00 00    	je     8004a6 <inet_aton+0x1c9>
+      *pp++ = val;
+  800384:	83 c0 04             	add    $0x4,%eax
+  800387:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80038a:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  80038d:	89 ca                	mov    %ecx,%edx
+  80038f:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  800392:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800395:	80 f9 09             	cmp    $0x9,%cl
+  800398:	0f 87 01 01 00 00    	ja     80049f <inet_aton+0x1c2>
+    base = 10;
+  80039e:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  8003a3:	83 f8 30             	cmp    $0x30,%eax
+  8003a6:	0f 84 4b ff ff ff    	je     8002f7 <inet_aton+0x1a>
+  8003ac:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  8003af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b4:	e9 7a ff ff ff       	jmp    800333 <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003b9:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8003bd:	89 d6                	mov    %edx,%esi
+  8003bf:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8003c2:	85 c0                	test   %eax,%eax
+  8003c4:	74 2e                	je     8003f4 <inet_aton+0x117>
+    return (0);
+  8003c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003cb:	89 fa                	mov    %edi,%edx
+  8003cd:	80 fa 1f             	cmp    $0x1f,%dl
+  8003d0:	0f 86 d5 00 00 00    	jbe    8004ab <inet_aton+0x1ce>
+  8003d6:	84 c0                	test   %al,%al
+  8003d8:	0f 88 cd 00 00 00    	js     8004ab <inet_aton+0x1ce>
+  8003de:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8003e1:	83 f9 04             	cmp    $0x4,%ecx
+  8003e4:	76 0e                	jbe    8003f4 <inet_aton+0x117>
+    return (0);
+  8003e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003eb:	83 f8 20             	cmp    $0x20,%eax
+  8003ee:	0f 85 b7 00 00 00    	jne    8004ab <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8003f4:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8003f7:	89 d8                	mov    %ebx,%eax
+  8003f9:	29 c8                	sub    %ecx,%eax
+  8003fb:	c1 f8 02             	sar    $0x2,%eax
+  8003fe:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  800401:	83 f8 02             	cmp    $0x2,%eax
+  800404:	74 7a                	je     800480 <inet_aton+0x1a3>
+  800406:	83 f9 03             	cmp    $0x3,%ecx
+  800409:	7f 49                	jg     800454 <inet_aton+0x177>
+  80040b:	85 c9                	test   %ecx,%ecx
+  80040d:	0f 84 98 00 00 00    	je     8004ab <inet_aton+0x1ce>
+  800413:	83 f9 02             	cmp    $0x2,%ecx
+  800416:	75 19                	jne    800431 <inet_aton+0x154>
+      return (0);
+  800418:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  80041d:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  800423:	0f 87 82 00 00 00    	ja     8004ab <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  800429:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80042c:	c1 e0 18             	shl    $0x18,%eax
+  80042f:	09 c6                	or     %eax,%esi
+  return (1);
+  800431:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  800436:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80043a:	74 6f                	je     8004ab <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  80043c:	83 ec 0c             	sub    $0xc,%esp
+  80043f:	56                   	push   %esi
+  800440:	e8 6c fe ff ff       	call   8002b1 <htonl>
+  800445:	83 c4 10             	add    $0x10,%esp
+  800448:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80044b:	89 06                	mov    %eax,(%esi)
+  return (1);
+  80044d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800452:	eb 57                	jmp    8004ab <inet_aton+0x1ce>
+  switch (n) {
+  800454:	83 f9 04             	cmp    $0x4,%ecx
+  800457:	75 d8                	jne    800431 <inet_aton+0x154>
+      return (0);
+  800459:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  80045e:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  800464:	77 45                	ja     8004ab <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  800466:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800469:	c1 e0 18             	shl    $0x18,%eax
+  80046c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80046f:	c1 e1 10             	shl    $0x10,%ecx
+  800472:	09 c8                	or     %ecx,%eax
+  800474:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800477:	c1 e1 08             	shl    $0x8,%ecx
+  80047a:	09 c8                	or     %ecx,%eax
+  80047c:	09 c6                	or     %eax,%esi
+    break;
+  80047e:	eb b1                	jmp    800431 <inet_aton+0x154>
+      return (0);
+  800480:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  800485:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  80048b:	77 1e                	ja     8004ab <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  80048d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800490:	c1 e0 18             	shl    $0x18,%eax
+  800493:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800496:	c1 e1 10             	shl    $0x10,%ecx
+  800499:	09 c8                	or     %ecx,%eax
+  80049b:	09 c6                	or     %eax,%esi
+    break;
+  80049d:	eb 92                	jmp    800431 <inet_aton+0x154>
+      return (0);
+  80049f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004a4:	eb 05                	jmp    8004ab <inet_aton+0x1ce>
+        return (0);
+  8004a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  8004ab:	89 c8                	mov    %ecx,%eax
+  8004ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b0:	5b                   	pop    %ebx
+  8004b1:	5e                   	pop    %esi
+  8004b2:	5f                   	pop    %edi
+  8004b3:	5d                   	pop    %ebp
+  8004b4:	c3                   	ret
+
+008004b5 <inet_addr>:
+{
+  8004b5:	55                   	push   %ebp
+  8004b6:	89 e5                	mov    %esp,%ebp
+  8004b8:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  8004bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8004be:	50                   	push   %eax
+  8004bf:	ff 75 08             	push   0x8(%ebp)
+  8004c2:	e8 16 fe ff ff       	call   8002dd <inet_aton>
+  8004c7:	89 c2                	mov    %eax,%edx
+  8004c9:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8004cc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8004d1:	85 d2                	test   %edx,%edx
+  8004d3:	75 02                	jne    8004d7 <inet_addr+0x22>
+}
+  8004d5:	c9                   	leave
+  8004d6:	c3                   	ret
+    return (val.s_addr);
+  8004d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8004da:	eb f9                	jmp    8004d5 <inet_addr+0x20>
+
+008004dc <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8004dc:	55                   	push   %ebp
+  8004dd:	89 e5                	mov    %esp,%ebp
+  8004df:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8004e2:	ff 75 08             	push   0x8(%ebp)
+  8004e5:	e8 c7 fd ff ff       	call   8002b1 <htonl>
+  8004ea:	83 c4 10             	add    $0x10,%esp
+}
+  8004ed:	c9                   	leave
+  8004ee:	c3                   	ret
+
+008004ef <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004ef:	55                   	push   %ebp
+  8004f0:	89 e5                	mov    %esp,%ebp
+  8004f2:	56                   	push   %esi
+  8004f3:	53                   	push   %ebx
+  8004f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004f7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8004fa:	e8 9c 0a 00 00       	call   800f9b <sys_getenvid>
+  8004ff:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800504:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80050a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80050f:	a3 10 60 80 00       	mov    %eax,0x806010
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800514:	85 db                	test   %ebx,%ebx
+  800516:	7e 07                	jle    80051f <libmain+0x30>
+		binaryname = argv[0];
+  800518:	8b 06                	mov    (%esi),%eax
+  80051a:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80051f:	83 ec 08             	sub    $0x8,%esp
+  800522:	56                   	push   %esi
+  800523:	53                   	push   %ebx
+  800524:	e8 aa fb ff ff       	call   8000d3 <umain>
+
+	// exit gracefully
+	exit();
+  800529:	e8 0a 00 00 00       	call   800538 <exit>
+}
+  80052e:	83 c4 10             	add    $0x10,%esp
+  800531:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800534:	5b                   	pop    %ebx
+  800535:	5e                   	pop    %esi
+  800536:	5d                   	pop    %ebp
+  800537:	c3                   	ret
+
+00800538 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800538:	55                   	push   %ebp
+  800539:	89 e5                	mov    %esp,%ebp
+  80053b:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80053e:	e8 73 10 00 00       	call   8015b6 <close_all>
+	sys_env_destroy(0);
+  800543:	83 ec 0c             	sub    $0xc,%esp
+  800546:	6a 00                	push   $0x0
+  800548:	e8 05 0a 00 00       	call   800f52 <sys_env_destroy>
+}
+  80054d:	83 c4 10             	add    $0x10,%esp
+  800550:	c9                   	leave
+  800551:	c3                   	ret
+
+00800552 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800552:	55                   	push   %ebp
+  800553:	89 e5                	mov    %esp,%ebp
+  800555:	53                   	push   %ebx
+  800556:	83 ec 04             	sub    $0x4,%esp
+  800559:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80055c:	8b 13                	mov    (%ebx),%edx
+  80055e:	8d 42 01             	lea    0x1(%edx),%eax
+  800561:	89 03                	mov    %eax,(%ebx)
+  800563:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800566:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80056a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80056f:	74 09                	je     80057a <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800571:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800575:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800578:	c9                   	leave
+  800579:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80057a:	83 ec 08             	sub    $0x8,%esp
+  80057d:	68 ff 00 00 00       	push   $0xff
+  800582:	8d 43 08             	lea    0x8(%ebx),%eax
+  800585:	50                   	push   %eax
+  800586:	e8 7a 09 00 00       	call   800f05 <sys_cputs>
+		b->idx = 0;
+  80058b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800591:	83 c4 10             	add    $0x10,%esp
+  800594:	eb db                	jmp    800571 <putch+0x1f>
+
+00800596 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800596:	55                   	push   %ebp
+  800597:	89 e5                	mov    %esp,%ebp
+  800599:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80059f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005a6:	00 00 00 
+	b.cnt = 0;
+  8005a9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005b0:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8005b3:	ff 75 0c             	push   0xc(%ebp)
+  8005b6:	ff 75 08             	push   0x8(%ebp)
+  8005b9:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005bf:	50                   	push   %eax
+  8005c0:	68 52 05 80 00       	push   $0x800552
+  8005c5:	e8 14 01 00 00       	call   8006de <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005ca:	83 c4 08             	add    $0x8,%esp
+  8005cd:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005d3:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005d9:	50                   	push   %eax
+  8005da:	e8 26 09 00 00       	call   800f05 <sys_cputs>
+
+	return b.cnt;
+}
+  8005df:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005e5:	c9                   	leave
+  8005e6:	c3                   	ret
+
+008005e7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8005e7:	55                   	push   %ebp
+  8005e8:	89 e5                	mov    %esp,%ebp
+  8005ea:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8005ed:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8005f0:	50                   	push   %eax
+  8005f1:	ff 75 08             	push   0x8(%ebp)
+  8005f4:	e8 9d ff ff ff       	call   800596 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005f9:	c9                   	leave
+  8005fa:	c3                   	ret
+
+008005fb <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005fb:	55                   	push   %ebp
+  8005fc:	89 e5                	mov    %esp,%ebp
+  8005fe:	57                   	push   %edi
+  8005ff:	56                   	push   %esi
+  800600:	53                   	push   %ebx
+  800601:	83 ec 1c             	sub    $0x1c,%esp
+  800604:	89 c7                	mov    %eax,%edi
+  800606:	89 d6                	mov    %edx,%esi
+  800608:	8b 45 08             	mov    0x8(%ebp),%eax
+  80060b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80060e:	89 d1                	mov    %edx,%ecx
+  800610:	89 c2                	mov    %eax,%edx
+  800612:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800615:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800618:	8b 45 10             	mov    0x10(%ebp),%eax
+  80061b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80061e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800621:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800628:	39 c2                	cmp    %eax,%edx
+  80062a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80062d:	72 3e                	jb     80066d <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80062f:	83 ec 0c             	sub    $0xc,%esp
+  800632:	ff 75 18             	push   0x18(%ebp)
+  800635:	83 eb 01             	sub    $0x1,%ebx
+  800638:	53                   	push   %ebx
+  800639:	50                   	push   %eax
+  80063a:	83 ec 08             	sub    $0x8,%esp
+  80063d:	ff 75 e4             	push   -0x1c(%ebp)
+  800640:	ff 75 e0             	push   -0x20(%ebp)
+  800643:	ff 75 dc             	push   -0x24(%ebp)
+  800646:	ff 75 d8             	push   -0x28(%ebp)
+  800649:	e8 37 34 00 00       	call   803a85 <__udivdi3>
+  80064e:	83 c4 18             	add    $0x18,%esp
+  800651:	52                   	push   %edx
+  800652:	50                   	push   %eax
+  800653:	89 f2                	mov    %esi,%edx
+  800655:	89 f8                	mov    %edi,%eax
+  800657:	e8 9f ff ff ff       	call   8005fb <printnum>
+  80065c:	83 c4 20             	add    $0x20,%esp
+  80065f:	eb 13                	jmp    800674 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800661:	83 ec 08             	sub    $0x8,%esp
+  800664:	56                   	push   %esi
+  800665:	ff 75 18             	push   0x18(%ebp)
+  800668:	ff d7                	call   *%edi
+  80066a:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80066d:	83 eb 01             	sub    $0x1,%ebx
+  800670:	85 db                	test   %ebx,%ebx
+  800672:	7f ed                	jg     800661 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800674:	83 ec 08             	sub    $0x8,%esp
+  800677:	56                   	push   %esi
+  800678:	83 ec 04             	sub    $0x4,%esp
+  80067b:	ff 75 e4             	push   -0x1c(%ebp)
+  80067e:	ff 75 e0             	push   -0x20(%ebp)
+  800681:	ff 75 dc             	push   -0x24(%ebp)
+  800684:	ff 75 d8             	push   -0x28(%ebp)
+  800687:	e8 17 34 00 00       	call   803aa3 <__umoddi3>
+  80068c:	83 c4 14             	add    $0x14,%esp
+  80068f:	0f be 80 45 3d 80 00 	movsbl 0x803d45(%eax),%eax
+  800696:	50                   	push   %eax
+  800697:	ff d7                	call   *%edi
+}
+  800699:	83 c4 10             	add    $0x10,%esp
+  80069c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80069f:	5b                   	pop    %ebx
+  8006a0:	5e                   	pop    %esi
+  8006a1:	5f                   	pop    %edi
+  8006a2:	5d                   	pop    %ebp
+  8006a3:	c3                   	ret
+
+008006a4 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8006a4:	55                   	push   %ebp
+  8006a5:	89 e5                	mov    %esp,%ebp
+  8006a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8006aa:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8006ae:	8b 10                	mov    (%eax),%edx
+  8006b0:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006b3:	73 0a                	jae    8006bf <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8006b5:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006b8:	89 08                	mov    %ecx,(%eax)
+  8006ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006bd:	88 02                	mov    %al,(%edx)
+}
+  8006bf:	5d                   	pop    %ebp
+  8006c0:	c3                   	ret
+
+008006c1 <printfmt>:
+{
+  8006c1:	55                   	push   %ebp
+  8006c2:	89 e5                	mov    %esp,%ebp
+  8006c4:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006c7:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006ca:	50                   	push   %eax
+  8006cb:	ff 75 10             	push   0x10(%ebp)
+  8006ce:	ff 75 0c             	push   0xc(%ebp)
+  8006d1:	ff 75 08             	push   0x8(%ebp)
+  8006d4:	e8 05 00 00 00       	call   8006de <vprintfmt>
+}
+  8006d9:	83 c4 10             	add    $0x10,%esp
+  8006dc:	c9                   	leave
+  8006dd:	c3                   	ret
+
+008006de <vprintfmt>:
+{
+  8006de:	55                   	push   %ebp
+  8006df:	89 e5                	mov    %esp,%ebp
+  8006e1:	57                   	push   %edi
+  8006e2:	56                   	push   %esi
+  8006e3:	53                   	push   %ebx
+  8006e4:	83 ec 2c             	sub    $0x2c,%esp
+  8006e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006ed:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8006f0:	eb 0a                	jmp    8006fc <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8006f2:	83 ec 08             	sub    $0x8,%esp
+  8006f5:	53                   	push   %ebx
+  8006f6:	50                   	push   %eax
+  8006f7:	ff d6                	call   *%esi
+  8006f9:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006fc:	83 c7 01             	add    $0x1,%edi
+  8006ff:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800703:	83 f8 25             	cmp    $0x25,%eax
+  800706:	74 0c                	je     800714 <vprintfmt+0x36>
+			if (ch == '\0')
+  800708:	85 c0                	test   %eax,%eax
+  80070a:	75 e6                	jne    8006f2 <vprintfmt+0x14>
+}
+  80070c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80070f:	5b                   	pop    %ebx
+  800710:	5e                   	pop    %esi
+  800711:	5f                   	pop    %edi
+  800712:	5d                   	pop    %ebp
+  800713:	c3                   	ret
+		padc = ' ';
+  800714:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800718:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80071f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800726:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80072d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800732:	8d 47 01             	lea    0x1(%edi),%eax
+  800735:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800738:	0f b6 17             	movzbl (%edi),%edx
+  80073b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80073e:	3c 55                	cmp    $0x55,%al
+  800740:	0f 87 cf 03 00 00    	ja     800b15 <vprintfmt+0x437>
+  800746:	0f b6 c0             	movzbl %al,%eax
+  800749:	ff 24 85 a0 3e 80 00 	jmp    *0x803ea0(,%eax,4)
+  800750:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800753:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800757:	eb d9                	jmp    800732 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800759:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80075c:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800760:	eb d0                	jmp    800732 <vprintfmt+0x54>
+  800762:	0f b6 d2             	movzbl %dl,%edx
+  800765:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800770:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800773:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800777:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80077a:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80077d:	83 f9 09             	cmp    $0x9,%ecx
+  800780:	77 55                	ja     8007d7 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800782:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800785:	eb e9                	jmp    800770 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800787:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078a:	8b 00                	mov    (%eax),%eax
+  80078c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8d 40 04             	lea    0x4(%eax),%eax
+  800795:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800798:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80079b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80079f:	79 91                	jns    800732 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8007a1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007a7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8007ae:	eb 82                	jmp    800732 <vprintfmt+0x54>
+			if (width < 0)
+  8007b0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007b3:	85 d2                	test   %edx,%edx
+  8007b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ba:	0f 49 c2             	cmovns %edx,%eax
+  8007bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007c3:	e9 6a ff ff ff       	jmp    800732 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8007cb:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007d2:	e9 5b ff ff ff       	jmp    800732 <vprintfmt+0x54>
+  8007d7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007da:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007dd:	eb bc                	jmp    80079b <vprintfmt+0xbd>
+			lflag++;
+  8007df:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007e5:	e9 48 ff ff ff       	jmp    800732 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8007ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ed:	8d 78 04             	lea    0x4(%eax),%edi
+  8007f0:	83 ec 08             	sub    $0x8,%esp
+  8007f3:	53                   	push   %ebx
+  8007f4:	ff 30                	push   (%eax)
+  8007f6:	ff d6                	call   *%esi
+			break;
+  8007f8:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8007fb:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8007fe:	e9 b1 02 00 00       	jmp    800ab4 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800803:	8b 45 14             	mov    0x14(%ebp),%eax
+  800806:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800809:	8b 10                	mov    (%eax),%edx
+  80080b:	89 d0                	mov    %edx,%eax
+  80080d:	f7 d8                	neg    %eax
+  80080f:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800812:	83 f8 11             	cmp    $0x11,%eax
+  800815:	7f 23                	jg     80083a <vprintfmt+0x15c>
+  800817:	8b 14 85 00 40 80 00 	mov    0x804000(,%eax,4),%edx
+  80081e:	85 d2                	test   %edx,%edx
+  800820:	74 18                	je     80083a <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800822:	52                   	push   %edx
+  800823:	68 52 41 80 00       	push   $0x804152
+  800828:	53                   	push   %ebx
+  800829:	56                   	push   %esi
+  80082a:	e8 92 fe ff ff       	call   8006c1 <printfmt>
+  80082f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800832:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800835:	e9 7a 02 00 00       	jmp    800ab4 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80083a:	50                   	push   %eax
+  80083b:	68 5d 3d 80 00       	push   $0x803d5d
+  800840:	53                   	push   %ebx
+  800841:	56                   	push   %esi
+  800842:	e8 7a fe ff ff       	call   8006c1 <printfmt>
+  800847:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80084a:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80084d:	e9 62 02 00 00       	jmp    800ab4 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800852:	8b 45 14             	mov    0x14(%ebp),%eax
+  800855:	83 c0 04             	add    $0x4,%eax
+  800858:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80085b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085e:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800860:	85 c9                	test   %ecx,%ecx
+  800862:	b8 56 3d 80 00       	mov    $0x803d56,%eax
+  800867:	0f 45 c1             	cmovne %ecx,%eax
+  80086a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80086d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800871:	7e 06                	jle    800879 <vprintfmt+0x19b>
+  800873:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800877:	75 0b                	jne    800884 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800879:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80087c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80087f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800882:	eb 5c                	jmp    8008e0 <vprintfmt+0x202>
+  800884:	83 ec 08             	sub    $0x8,%esp
+  800887:	ff 75 d0             	push   -0x30(%ebp)
+  80088a:	ff 75 cc             	push   -0x34(%ebp)
+  80088d:	e8 20 03 00 00       	call   800bb2 <strnlen>
+  800892:	89 c2                	mov    %eax,%edx
+  800894:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800897:	29 d0                	sub    %edx,%eax
+  800899:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80089c:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8008a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008a3:	89 75 08             	mov    %esi,0x8(%ebp)
+  8008a6:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008a8:	eb 0e                	jmp    8008b8 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8008aa:	83 ec 08             	sub    $0x8,%esp
+  8008ad:	53                   	push   %ebx
+  8008ae:	57                   	push   %edi
+  8008af:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008b2:	83 ee 01             	sub    $0x1,%esi
+  8008b5:	83 c4 10             	add    $0x10,%esp
+  8008b8:	85 f6                	test   %esi,%esi
+  8008ba:	7f ee                	jg     8008aa <vprintfmt+0x1cc>
+  8008bc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008c2:	85 c0                	test   %eax,%eax
+  8008c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008c9:	0f 49 d0             	cmovns %eax,%edx
+  8008cc:	29 d0                	sub    %edx,%eax
+  8008ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008d1:	eb a6                	jmp    800879 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8008d3:	83 ec 08             	sub    $0x8,%esp
+  8008d6:	53                   	push   %ebx
+  8008d7:	52                   	push   %edx
+  8008d8:	ff 55 08             	call   *0x8(%ebp)
+  8008db:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008de:	89 f1                	mov    %esi,%ecx
+  8008e0:	8d 71 01             	lea    0x1(%ecx),%esi
+  8008e3:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8008e7:	0f be d0             	movsbl %al,%edx
+  8008ea:	85 d2                	test   %edx,%edx
+  8008ec:	74 28                	je     800916 <vprintfmt+0x238>
+  8008ee:	85 ff                	test   %edi,%edi
+  8008f0:	78 05                	js     8008f7 <vprintfmt+0x219>
+  8008f2:	83 ef 01             	sub    $0x1,%edi
+  8008f5:	78 30                	js     800927 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008f7:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008fb:	74 d6                	je     8008d3 <vprintfmt+0x1f5>
+  8008fd:	0f be c0             	movsbl %al,%eax
+  800900:	83 e8 20             	sub    $0x20,%eax
+  800903:	83 f8 5e             	cmp    $0x5e,%eax
+  800906:	76 cb                	jbe    8008d3 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800908:	83 ec 08             	sub    $0x8,%esp
+  80090b:	53                   	push   %ebx
+  80090c:	6a 3f                	push   $0x3f
+  80090e:	ff 55 08             	call   *0x8(%ebp)
+  800911:	83 c4 10             	add    $0x10,%esp
+  800914:	eb c8                	jmp    8008de <vprintfmt+0x200>
+  800916:	8b 75 08             	mov    0x8(%ebp),%esi
+  800919:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80091c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80091f:	01 d0                	add    %edx,%eax
+  800921:	29 c8                	sub    %ecx,%eax
+  800923:	89 c7                	mov    %eax,%edi
+  800925:	eb 13                	jmp    80093a <vprintfmt+0x25c>
+  800927:	8b 75 08             	mov    0x8(%ebp),%esi
+  80092a:	eb ed                	jmp    800919 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80092c:	83 ec 08             	sub    $0x8,%esp
+  80092f:	53                   	push   %ebx
+  800930:	6a 20                	push   $0x20
+  800932:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800934:	83 ef 01             	sub    $0x1,%edi
+  800937:	83 c4 10             	add    $0x10,%esp
+  80093a:	85 ff                	test   %edi,%edi
+  80093c:	7f ee                	jg     80092c <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80093e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800941:	89 45 14             	mov    %eax,0x14(%ebp)
+  800944:	e9 6b 01 00 00       	jmp    800ab4 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800949:	83 f9 01             	cmp    $0x1,%ecx
+  80094c:	7f 1f                	jg     80096d <vprintfmt+0x28f>
+	else if (lflag)
+  80094e:	85 c9                	test   %ecx,%ecx
+  800950:	74 67                	je     8009b9 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800952:	8b 45 14             	mov    0x14(%ebp),%eax
+  800955:	8b 00                	mov    (%eax),%eax
+  800957:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80095a:	89 c1                	mov    %eax,%ecx
+  80095c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80095f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800962:	8b 45 14             	mov    0x14(%ebp),%eax
+  800965:	8d 40 04             	lea    0x4(%eax),%eax
+  800968:	89 45 14             	mov    %eax,0x14(%ebp)
+  80096b:	eb 17                	jmp    800984 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80096d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800970:	8b 50 04             	mov    0x4(%eax),%edx
+  800973:	8b 00                	mov    (%eax),%eax
+  800975:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800978:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80097b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097e:	8d 40 08             	lea    0x8(%eax),%eax
+  800981:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800984:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800987:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80098a:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80098f:	85 c9                	test   %ecx,%ecx
+  800991:	0f 89 03 01 00 00    	jns    800a9a <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800997:	83 ec 08             	sub    $0x8,%esp
+  80099a:	53                   	push   %ebx
+  80099b:	6a 2d                	push   $0x2d
+  80099d:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80099f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009a2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8009a5:	f7 da                	neg    %edx
+  8009a7:	83 d1 00             	adc    $0x0,%ecx
+  8009aa:	f7 d9                	neg    %ecx
+  8009ac:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8009af:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8009b4:	e9 e1 00 00 00       	jmp    800a9a <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8009b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009bc:	8b 00                	mov    (%eax),%eax
+  8009be:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009c1:	89 c1                	mov    %eax,%ecx
+  8009c3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009c6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8009cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009d2:	eb b0                	jmp    800984 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8009d4:	83 f9 01             	cmp    $0x1,%ecx
+  8009d7:	7f 1e                	jg     8009f7 <vprintfmt+0x319>
+	else if (lflag)
+  8009d9:	85 c9                	test   %ecx,%ecx
+  8009db:	74 32                	je     800a0f <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8009dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e0:	8b 10                	mov    (%eax),%edx
+  8009e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009ed:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8009f2:	e9 a3 00 00 00       	jmp    800a9a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009fa:	8b 10                	mov    (%eax),%edx
+  8009fc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009ff:	8d 40 08             	lea    0x8(%eax),%eax
+  800a02:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a05:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800a0a:	e9 8b 00 00 00       	jmp    800a9a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800a0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a12:	8b 10                	mov    (%eax),%edx
+  800a14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a19:	8d 40 04             	lea    0x4(%eax),%eax
+  800a1c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a1f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800a24:	eb 74                	jmp    800a9a <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800a26:	83 f9 01             	cmp    $0x1,%ecx
+  800a29:	7f 1b                	jg     800a46 <vprintfmt+0x368>
+	else if (lflag)
+  800a2b:	85 c9                	test   %ecx,%ecx
+  800a2d:	74 2c                	je     800a5b <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800a2f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a32:	8b 10                	mov    (%eax),%edx
+  800a34:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a39:	8d 40 04             	lea    0x4(%eax),%eax
+  800a3c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a3f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800a44:	eb 54                	jmp    800a9a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800a46:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a49:	8b 10                	mov    (%eax),%edx
+  800a4b:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a4e:	8d 40 08             	lea    0x8(%eax),%eax
+  800a51:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a54:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800a59:	eb 3f                	jmp    800a9a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800a5b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5e:	8b 10                	mov    (%eax),%edx
+  800a60:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a65:	8d 40 04             	lea    0x4(%eax),%eax
+  800a68:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a6b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800a70:	eb 28                	jmp    800a9a <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800a72:	83 ec 08             	sub    $0x8,%esp
+  800a75:	53                   	push   %ebx
+  800a76:	6a 30                	push   $0x30
+  800a78:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800a7a:	83 c4 08             	add    $0x8,%esp
+  800a7d:	53                   	push   %ebx
+  800a7e:	6a 78                	push   $0x78
+  800a80:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800a82:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a85:	8b 10                	mov    (%eax),%edx
+  800a87:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a8c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a8f:	8d 40 04             	lea    0x4(%eax),%eax
+  800a92:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a95:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800a9a:	83 ec 0c             	sub    $0xc,%esp
+  800a9d:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800aa1:	50                   	push   %eax
+  800aa2:	ff 75 e0             	push   -0x20(%ebp)
+  800aa5:	57                   	push   %edi
+  800aa6:	51                   	push   %ecx
+  800aa7:	52                   	push   %edx
+  800aa8:	89 da                	mov    %ebx,%edx
+  800aaa:	89 f0                	mov    %esi,%eax
+  800aac:	e8 4a fb ff ff       	call   8005fb <printnum>
+			break;
+  800ab1:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800ab4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ab7:	e9 40 fc ff ff       	jmp    8006fc <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800abc:	83 f9 01             	cmp    $0x1,%ecx
+  800abf:	7f 1b                	jg     800adc <vprintfmt+0x3fe>
+	else if (lflag)
+  800ac1:	85 c9                	test   %ecx,%ecx
+  800ac3:	74 2c                	je     800af1 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800ac5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac8:	8b 10                	mov    (%eax),%edx
+  800aca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800acf:	8d 40 04             	lea    0x4(%eax),%eax
+  800ad2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ad5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800ada:	eb be                	jmp    800a9a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800adc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800adf:	8b 10                	mov    (%eax),%edx
+  800ae1:	8b 48 04             	mov    0x4(%eax),%ecx
+  800ae4:	8d 40 08             	lea    0x8(%eax),%eax
+  800ae7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800aea:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800aef:	eb a9                	jmp    800a9a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800af1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af4:	8b 10                	mov    (%eax),%edx
+  800af6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800afb:	8d 40 04             	lea    0x4(%eax),%eax
+  800afe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b01:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800b06:	eb 92                	jmp    800a9a <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800b08:	83 ec 08             	sub    $0x8,%esp
+  800b0b:	53                   	push   %ebx
+  800b0c:	6a 25                	push   $0x25
+  800b0e:	ff d6                	call   *%esi
+			break;
+  800b10:	83 c4 10             	add    $0x10,%esp
+  800b13:	eb 9f                	jmp    800ab4 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800b15:	83 ec 08             	sub    $0x8,%esp
+  800b18:	53                   	push   %ebx
+  800b19:	6a 25                	push   $0x25
+  800b1b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b1d:	83 c4 10             	add    $0x10,%esp
+  800b20:	89 f8                	mov    %edi,%eax
+  800b22:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b26:	74 05                	je     800b2d <vprintfmt+0x44f>
+  800b28:	83 e8 01             	sub    $0x1,%eax
+  800b2b:	eb f5                	jmp    800b22 <vprintfmt+0x444>
+  800b2d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b30:	eb 82                	jmp    800ab4 <vprintfmt+0x3d6>
+
+00800b32 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b32:	55                   	push   %ebp
+  800b33:	89 e5                	mov    %esp,%ebp
+  800b35:	83 ec 18             	sub    $0x18,%esp
+  800b38:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b3e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b41:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b45:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b48:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b4f:	85 c0                	test   %eax,%eax
+  800b51:	74 26                	je     800b79 <vsnprintf+0x47>
+  800b53:	85 d2                	test   %edx,%edx
+  800b55:	7e 22                	jle    800b79 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b57:	ff 75 14             	push   0x14(%ebp)
+  800b5a:	ff 75 10             	push   0x10(%ebp)
+  800b5d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b60:	50                   	push   %eax
+  800b61:	68 a4 06 80 00       	push   $0x8006a4
+  800b66:	e8 73 fb ff ff       	call   8006de <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b6b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b6e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b74:	83 c4 10             	add    $0x10,%esp
+}
+  800b77:	c9                   	leave
+  800b78:	c3                   	ret
+		return -E_INVAL;
+  800b79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b7e:	eb f7                	jmp    800b77 <vsnprintf+0x45>
+
+00800b80 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b86:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b89:	50                   	push   %eax
+  800b8a:	ff 75 10             	push   0x10(%ebp)
+  800b8d:	ff 75 0c             	push   0xc(%ebp)
+  800b90:	ff 75 08             	push   0x8(%ebp)
+  800b93:	e8 9a ff ff ff       	call   800b32 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b98:	c9                   	leave
+  800b99:	c3                   	ret
+
+00800b9a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b9a:	55                   	push   %ebp
+  800b9b:	89 e5                	mov    %esp,%ebp
+  800b9d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba5:	eb 03                	jmp    800baa <strlen+0x10>
+		n++;
+  800ba7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800baa:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800bae:	75 f7                	jne    800ba7 <strlen+0xd>
+	return n;
+}
+  800bb0:	5d                   	pop    %ebp
+  800bb1:	c3                   	ret
+
+00800bb2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800bb2:	55                   	push   %ebp
+  800bb3:	89 e5                	mov    %esp,%ebp
+  800bb5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bb8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc0:	eb 03                	jmp    800bc5 <strnlen+0x13>
+		n++;
+  800bc2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bc5:	39 d0                	cmp    %edx,%eax
+  800bc7:	74 08                	je     800bd1 <strnlen+0x1f>
+  800bc9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bcd:	75 f3                	jne    800bc2 <strnlen+0x10>
+  800bcf:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800bd1:	89 d0                	mov    %edx,%eax
+  800bd3:	5d                   	pop    %ebp
+  800bd4:	c3                   	ret
+
+00800bd5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800bd5:	55                   	push   %ebp
+  800bd6:	89 e5                	mov    %esp,%ebp
+  800bd8:	53                   	push   %ebx
+  800bd9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bdc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800be8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800beb:	83 c0 01             	add    $0x1,%eax
+  800bee:	84 d2                	test   %dl,%dl
+  800bf0:	75 f2                	jne    800be4 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800bf2:	89 c8                	mov    %ecx,%eax
+  800bf4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bf7:	c9                   	leave
+  800bf8:	c3                   	ret
+
+00800bf9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800bf9:	55                   	push   %ebp
+  800bfa:	89 e5                	mov    %esp,%ebp
+  800bfc:	53                   	push   %ebx
+  800bfd:	83 ec 10             	sub    $0x10,%esp
+  800c00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c03:	53                   	push   %ebx
+  800c04:	e8 91 ff ff ff       	call   800b9a <strlen>
+  800c09:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c0c:	ff 75 0c             	push   0xc(%ebp)
+  800c0f:	01 d8                	add    %ebx,%eax
+  800c11:	50                   	push   %eax
+  800c12:	e8 be ff ff ff       	call   800bd5 <strcpy>
+	return dst;
+}
+  800c17:	89 d8                	mov    %ebx,%eax
+  800c19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c1c:	c9                   	leave
+  800c1d:	c3                   	ret
+
+00800c1e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c1e:	55                   	push   %ebp
+  800c1f:	89 e5                	mov    %esp,%ebp
+  800c21:	56                   	push   %esi
+  800c22:	53                   	push   %ebx
+  800c23:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c26:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c29:	89 f3                	mov    %esi,%ebx
+  800c2b:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c2e:	89 f0                	mov    %esi,%eax
+  800c30:	eb 0f                	jmp    800c41 <strncpy+0x23>
+		*dst++ = *src;
+  800c32:	83 c0 01             	add    $0x1,%eax
+  800c35:	0f b6 0a             	movzbl (%edx),%ecx
+  800c38:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c3b:	80 f9 01             	cmp    $0x1,%cl
+  800c3e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c41:	39 d8                	cmp    %ebx,%eax
+  800c43:	75 ed                	jne    800c32 <strncpy+0x14>
+	}
+	return ret;
+}
+  800c45:	89 f0                	mov    %esi,%eax
+  800c47:	5b                   	pop    %ebx
+  800c48:	5e                   	pop    %esi
+  800c49:	5d                   	pop    %ebp
+  800c4a:	c3                   	ret
+
+00800c4b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c4b:	55                   	push   %ebp
+  800c4c:	89 e5                	mov    %esp,%ebp
+  800c4e:	56                   	push   %esi
+  800c4f:	53                   	push   %ebx
+  800c50:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c56:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c59:	89 f0                	mov    %esi,%eax
+  800c5b:	85 d2                	test   %edx,%edx
+  800c5d:	74 21                	je     800c80 <strlcpy+0x35>
+  800c5f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c63:	89 f2                	mov    %esi,%edx
+  800c65:	eb 09                	jmp    800c70 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c67:	83 c1 01             	add    $0x1,%ecx
+  800c6a:	83 c2 01             	add    $0x1,%edx
+  800c6d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c70:	39 c2                	cmp    %eax,%edx
+  800c72:	74 09                	je     800c7d <strlcpy+0x32>
+  800c74:	0f b6 19             	movzbl (%ecx),%ebx
+  800c77:	84 db                	test   %bl,%bl
+  800c79:	75 ec                	jne    800c67 <strlcpy+0x1c>
+  800c7b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c7d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c80:	29 f0                	sub    %esi,%eax
+}
+  800c82:	5b                   	pop    %ebx
+  800c83:	5e                   	pop    %esi
+  800c84:	5d                   	pop    %ebp
+  800c85:	c3                   	ret
+
+00800c86 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c86:	55                   	push   %ebp
+  800c87:	89 e5                	mov    %esp,%ebp
+  800c89:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c8f:	eb 06                	jmp    800c97 <strcmp+0x11>
+		p++, q++;
+  800c91:	83 c1 01             	add    $0x1,%ecx
+  800c94:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c97:	0f b6 01             	movzbl (%ecx),%eax
+  800c9a:	84 c0                	test   %al,%al
+  800c9c:	74 04                	je     800ca2 <strcmp+0x1c>
+  800c9e:	3a 02                	cmp    (%edx),%al
+  800ca0:	74 ef                	je     800c91 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ca2:	0f b6 c0             	movzbl %al,%eax
+  800ca5:	0f b6 12             	movzbl (%edx),%edx
+  800ca8:	29 d0                	sub    %edx,%eax
+}
+  800caa:	5d                   	pop    %ebp
+  800cab:	c3                   	ret
+
+00800cac <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800cac:	55                   	push   %ebp
+  800cad:	89 e5                	mov    %esp,%ebp
+  800caf:	53                   	push   %ebx
+  800cb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb6:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800cb9:	eb 09                	jmp    800cc4 <strncmp+0x18>
+		n--, p++, q++;
+  800cbb:	83 ea 01             	sub    $0x1,%edx
+  800cbe:	83 c0 01             	add    $0x1,%eax
+  800cc1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800cc4:	85 d2                	test   %edx,%edx
+  800cc6:	74 18                	je     800ce0 <strncmp+0x34>
+  800cc8:	0f b6 18             	movzbl (%eax),%ebx
+  800ccb:	84 db                	test   %bl,%bl
+  800ccd:	74 04                	je     800cd3 <strncmp+0x27>
+  800ccf:	3a 19                	cmp    (%ecx),%bl
+  800cd1:	74 e8                	je     800cbb <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cd3:	0f b6 00             	movzbl (%eax),%eax
+  800cd6:	0f b6 11             	movzbl (%ecx),%edx
+  800cd9:	29 d0                	sub    %edx,%eax
+}
+  800cdb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cde:	c9                   	leave
+  800cdf:	c3                   	ret
+		return 0;
+  800ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce5:	eb f4                	jmp    800cdb <strncmp+0x2f>
+
+00800ce7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ced:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cf1:	eb 03                	jmp    800cf6 <strchr+0xf>
+  800cf3:	83 c0 01             	add    $0x1,%eax
+  800cf6:	0f b6 10             	movzbl (%eax),%edx
+  800cf9:	84 d2                	test   %dl,%dl
+  800cfb:	74 06                	je     800d03 <strchr+0x1c>
+		if (*s == c)
+  800cfd:	38 ca                	cmp    %cl,%dl
+  800cff:	75 f2                	jne    800cf3 <strchr+0xc>
+  800d01:	eb 05                	jmp    800d08 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800d03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d08:	5d                   	pop    %ebp
+  800d09:	c3                   	ret
+
+00800d0a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d0a:	55                   	push   %ebp
+  800d0b:	89 e5                	mov    %esp,%ebp
+  800d0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d10:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d14:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d17:	38 ca                	cmp    %cl,%dl
+  800d19:	74 09                	je     800d24 <strfind+0x1a>
+  800d1b:	84 d2                	test   %dl,%dl
+  800d1d:	74 05                	je     800d24 <strfind+0x1a>
+	for (; *s; s++)
+  800d1f:	83 c0 01             	add    $0x1,%eax
+  800d22:	eb f0                	jmp    800d14 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800d24:	5d                   	pop    %ebp
+  800d25:	c3                   	ret
+
+00800d26 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d26:	55                   	push   %ebp
+  800d27:	89 e5                	mov    %esp,%ebp
+  800d29:	57                   	push   %edi
+  800d2a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d2d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d30:	85 c9                	test   %ecx,%ecx
+  800d32:	74 20                	je     800d54 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d34:	89 f8                	mov    %edi,%eax
+  800d36:	09 c8                	or     %ecx,%eax
+  800d38:	a8 03                	test   $0x3,%al
+  800d3a:	75 12                	jne    800d4e <memset+0x28>
+		c &= 0xFF;
+  800d3c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d40:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d46:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d49:	fc                   	cld
+  800d4a:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d4c:	eb 06                	jmp    800d54 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d4e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d51:	fc                   	cld
+  800d52:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d54:	89 f8                	mov    %edi,%eax
+  800d56:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d59:	c9                   	leave
+  800d5a:	c3                   	ret
+
+00800d5b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d5b:	55                   	push   %ebp
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	57                   	push   %edi
+  800d5f:	56                   	push   %esi
+  800d60:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d63:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d66:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d69:	39 c6                	cmp    %eax,%esi
+  800d6b:	73 32                	jae    800d9f <memmove+0x44>
+  800d6d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d70:	39 d0                	cmp    %edx,%eax
+  800d72:	73 2b                	jae    800d9f <memmove+0x44>
+		s += n;
+		d += n;
+  800d74:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d77:	89 d6                	mov    %edx,%esi
+  800d79:	09 fe                	or     %edi,%esi
+  800d7b:	09 ce                	or     %ecx,%esi
+  800d7d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d83:	75 0e                	jne    800d93 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d85:	83 ef 04             	sub    $0x4,%edi
+  800d88:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d8b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d8e:	fd                   	std
+  800d8f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d91:	eb 09                	jmp    800d9c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d93:	83 ef 01             	sub    $0x1,%edi
+  800d96:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d99:	fd                   	std
+  800d9a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d9c:	fc                   	cld
+  800d9d:	eb 1a                	jmp    800db9 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d9f:	89 f2                	mov    %esi,%edx
+  800da1:	09 c2                	or     %eax,%edx
+  800da3:	09 ca                	or     %ecx,%edx
+  800da5:	f6 c2 03             	test   $0x3,%dl
+  800da8:	75 0a                	jne    800db4 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800daa:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800dad:	89 c7                	mov    %eax,%edi
+  800daf:	fc                   	cld
+  800db0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800db2:	eb 05                	jmp    800db9 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800db4:	89 c7                	mov    %eax,%edi
+  800db6:	fc                   	cld
+  800db7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800db9:	5e                   	pop    %esi
+  800dba:	5f                   	pop    %edi
+  800dbb:	5d                   	pop    %ebp
+  800dbc:	c3                   	ret
+
+00800dbd <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800dbd:	55                   	push   %ebp
+  800dbe:	89 e5                	mov    %esp,%ebp
+  800dc0:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800dc3:	ff 75 10             	push   0x10(%ebp)
+  800dc6:	ff 75 0c             	push   0xc(%ebp)
+  800dc9:	ff 75 08             	push   0x8(%ebp)
+  800dcc:	e8 8a ff ff ff       	call   800d5b <memmove>
+}
+  800dd1:	c9                   	leave
+  800dd2:	c3                   	ret
+
+00800dd3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800dd3:	55                   	push   %ebp
+  800dd4:	89 e5                	mov    %esp,%ebp
+  800dd6:	56                   	push   %esi
+  800dd7:	53                   	push   %ebx
+  800dd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ddb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800dde:	89 c6                	mov    %eax,%esi
+  800de0:	03 75 10             	add    0x10(%ebp),%esi
+  800de3:	eb 06                	jmp    800deb <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800de5:	83 c0 01             	add    $0x1,%eax
+  800de8:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800deb:	39 f0                	cmp    %esi,%eax
+  800ded:	74 14                	je     800e03 <memcmp+0x30>
+		if (*s1 != *s2)
+  800def:	0f b6 08             	movzbl (%eax),%ecx
+  800df2:	0f b6 1a             	movzbl (%edx),%ebx
+  800df5:	38 d9                	cmp    %bl,%cl
+  800df7:	74 ec                	je     800de5 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800df9:	0f b6 c1             	movzbl %cl,%eax
+  800dfc:	0f b6 db             	movzbl %bl,%ebx
+  800dff:	29 d8                	sub    %ebx,%eax
+  800e01:	eb 05                	jmp    800e08 <memcmp+0x35>
+	}
+
+	return 0;
+  800e03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e08:	5b                   	pop    %ebx
+  800e09:	5e                   	pop    %esi
+  800e0a:	5d                   	pop    %ebp
+  800e0b:	c3                   	ret
+
+00800e0c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e0c:	55                   	push   %ebp
+  800e0d:	89 e5                	mov    %esp,%ebp
+  800e0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e15:	89 c2                	mov    %eax,%edx
+  800e17:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e1a:	eb 03                	jmp    800e1f <memfind+0x13>
+  800e1c:	83 c0 01             	add    $0x1,%eax
+  800e1f:	39 d0                	cmp    %edx,%eax
+  800e21:	73 04                	jae    800e27 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e23:	38 08                	cmp    %cl,(%eax)
+  800e25:	75 f5                	jne    800e1c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800e27:	5d                   	pop    %ebp
+  800e28:	c3                   	ret
+
+00800e29 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e29:	55                   	push   %ebp
+  800e2a:	89 e5                	mov    %esp,%ebp
+  800e2c:	57                   	push   %edi
+  800e2d:	56                   	push   %esi
+  800e2e:	53                   	push   %ebx
+  800e2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e35:	eb 03                	jmp    800e3a <strtol+0x11>
+		s++;
+  800e37:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e3a:	0f b6 02             	movzbl (%edx),%eax
+  800e3d:	3c 20                	cmp    $0x20,%al
+  800e3f:	74 f6                	je     800e37 <strtol+0xe>
+  800e41:	3c 09                	cmp    $0x9,%al
+  800e43:	74 f2                	je     800e37 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e45:	3c 2b                	cmp    $0x2b,%al
+  800e47:	74 2a                	je     800e73 <strtol+0x4a>
+	int neg = 0;
+  800e49:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e4e:	3c 2d                	cmp    $0x2d,%al
+  800e50:	74 2b                	je     800e7d <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e52:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e58:	75 0f                	jne    800e69 <strtol+0x40>
+  800e5a:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e5d:	74 28                	je     800e87 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e5f:	85 db                	test   %ebx,%ebx
+  800e61:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e66:	0f 44 d8             	cmove  %eax,%ebx
+  800e69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e71:	eb 46                	jmp    800eb9 <strtol+0x90>
+		s++;
+  800e73:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e76:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e7b:	eb d5                	jmp    800e52 <strtol+0x29>
+		s++, neg = 1;
+  800e7d:	83 c2 01             	add    $0x1,%edx
+  800e80:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e85:	eb cb                	jmp    800e52 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e87:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e8b:	74 0e                	je     800e9b <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800e8d:	85 db                	test   %ebx,%ebx
+  800e8f:	75 d8                	jne    800e69 <strtol+0x40>
+		s++, base = 8;
+  800e91:	83 c2 01             	add    $0x1,%edx
+  800e94:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e99:	eb ce                	jmp    800e69 <strtol+0x40>
+		s += 2, base = 16;
+  800e9b:	83 c2 02             	add    $0x2,%edx
+  800e9e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ea3:	eb c4                	jmp    800e69 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ea5:	0f be c0             	movsbl %al,%eax
+  800ea8:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800eab:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800eae:	7d 3a                	jge    800eea <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800eb0:	83 c2 01             	add    $0x1,%edx
+  800eb3:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800eb7:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800eb9:	0f b6 02             	movzbl (%edx),%eax
+  800ebc:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ebf:	89 f3                	mov    %esi,%ebx
+  800ec1:	80 fb 09             	cmp    $0x9,%bl
+  800ec4:	76 df                	jbe    800ea5 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ec6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ec9:	89 f3                	mov    %esi,%ebx
+  800ecb:	80 fb 19             	cmp    $0x19,%bl
+  800ece:	77 08                	ja     800ed8 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ed0:	0f be c0             	movsbl %al,%eax
+  800ed3:	83 e8 57             	sub    $0x57,%eax
+  800ed6:	eb d3                	jmp    800eab <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ed8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800edb:	89 f3                	mov    %esi,%ebx
+  800edd:	80 fb 19             	cmp    $0x19,%bl
+  800ee0:	77 08                	ja     800eea <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ee2:	0f be c0             	movsbl %al,%eax
+  800ee5:	83 e8 37             	sub    $0x37,%eax
+  800ee8:	eb c1                	jmp    800eab <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800eea:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800eee:	74 05                	je     800ef5 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ef0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ef3:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ef5:	89 c8                	mov    %ecx,%eax
+  800ef7:	f7 d8                	neg    %eax
+  800ef9:	85 ff                	test   %edi,%edi
+  800efb:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800efe:	89 c8                	mov    %ecx,%eax
+  800f00:	5b                   	pop    %ebx
+  800f01:	5e                   	pop    %esi
+  800f02:	5f                   	pop    %edi
+  800f03:	5d                   	pop    %ebp
+  800f04:	c3                   	ret
+
+00800f05 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f05:	55                   	push   %ebp
+  800f06:	89 e5                	mov    %esp,%ebp
+  800f08:	57                   	push   %edi
+  800f09:	56                   	push   %esi
+  800f0a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f16:	89 c3                	mov    %eax,%ebx
+  800f18:	89 c7                	mov    %eax,%edi
+  800f1a:	55                   	push   %ebp
+  800f1b:	89 e5                	mov    %esp,%ebp
+  800f1d:	8d 35 25 0f 80 00    	lea    0x800f25,%esi
+  800f23:	0f 34                	sysenter
+  800f25:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800f26:	5b                   	pop    %ebx
+  800f27:	5e                   	pop    %esi
+  800f28:	5f                   	pop    %edi
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+
+00800f2b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	57                   	push   %edi
+  800f2f:	56                   	push   %esi
+  800f30:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f36:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f3b:	89 d1                	mov    %edx,%ecx
+  800f3d:	89 d3                	mov    %edx,%ebx
+  800f3f:	89 d7                	mov    %edx,%edi
+  800f41:	55                   	push   %ebp
+  800f42:	89 e5                	mov    %esp,%ebp
+  800f44:	8d 35 4c 0f 80 00    	lea    0x800f4c,%esi
+  800f4a:	0f 34                	sysenter
+  800f4c:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800f4d:	5b                   	pop    %ebx
+  800f4e:	5e                   	pop    %esi
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+
+00800f52 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f52:	55                   	push   %ebp
+  800f53:	89 e5                	mov    %esp,%ebp
+  800f55:	57                   	push   %edi
+  800f56:	56                   	push   %esi
+  800f57:	53                   	push   %ebx
+  800f58:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f63:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f68:	89 cb                	mov    %ecx,%ebx
+  800f6a:	89 cf                	mov    %ecx,%edi
+  800f6c:	55                   	push   %ebp
+  800f6d:	89 e5                	mov    %esp,%ebp
+  800f6f:	8d 35 77 0f 80 00    	lea    0x800f77,%esi
+  800f75:	0f 34                	sysenter
+  800f77:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f78:	85 c0                	test   %eax,%eax
+  800f7a:	7f 08                	jg     800f84 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800f7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7f:	5b                   	pop    %ebx
+  800f80:	5e                   	pop    %esi
+  800f81:	5f                   	pop    %edi
+  800f82:	5d                   	pop    %ebp
+  800f83:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f84:	83 ec 0c             	sub    $0xc,%esp
+  800f87:	50                   	push   %eax
+  800f88:	6a 03                	push   $0x3
+  800f8a:	68 67 40 80 00       	push   $0x804067
+  800f8f:	6a 3d                	push   $0x3d
+  800f91:	68 84 40 80 00       	push   $0x804084
+  800f96:	e8 02 24 00 00       	call   80339d <_panic>
+
+00800f9b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	57                   	push   %edi
+  800f9f:	56                   	push   %esi
+  800fa0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa6:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fab:	89 d1                	mov    %edx,%ecx
+  800fad:	89 d3                	mov    %edx,%ebx
+  800faf:	89 d7                	mov    %edx,%edi
+  800fb1:	55                   	push   %ebp
+  800fb2:	89 e5                	mov    %esp,%ebp
+  800fb4:	8d 35 bc 0f 80 00    	lea    0x800fbc,%esi
+  800fba:	0f 34                	sysenter
+  800fbc:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800fbd:	5b                   	pop    %ebx
+  800fbe:	5e                   	pop    %esi
+  800fbf:	5f                   	pop    %edi
+  800fc0:	5d                   	pop    %ebp
+  800fc1:	c3                   	ret
+
+00800fc2 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800fc2:	55                   	push   %ebp
+  800fc3:	89 e5                	mov    %esp,%ebp
+  800fc5:	57                   	push   %edi
+  800fc6:	56                   	push   %esi
+  800fc7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fcd:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800fd2:	89 d1                	mov    %edx,%ecx
+  800fd4:	89 d3                	mov    %edx,%ebx
+  800fd6:	89 d7                	mov    %edx,%edi
+  800fd8:	89 d6                	mov    %edx,%esi
+  800fda:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800fdc:	5b                   	pop    %ebx
+  800fdd:	5e                   	pop    %esi
+  800fde:	5f                   	pop    %edi
+  800fdf:	5d                   	pop    %ebp
+  800fe0:	c3                   	ret
+
+00800fe1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800fe1:	55                   	push   %ebp
+  800fe2:	89 e5                	mov    %esp,%ebp
+  800fe4:	57                   	push   %edi
+  800fe5:	56                   	push   %esi
+  800fe6:	53                   	push   %ebx
+  800fe7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800fea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ff5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ffa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ffd:	55                   	push   %ebp
+  800ffe:	89 e5                	mov    %esp,%ebp
+  801000:	8d 35 08 10 80 00    	lea    0x801008,%esi
+  801006:	0f 34                	sysenter
+  801008:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801009:	85 c0                	test   %eax,%eax
+  80100b:	7f 08                	jg     801015 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  80100d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801010:	5b                   	pop    %ebx
+  801011:	5e                   	pop    %esi
+  801012:	5f                   	pop    %edi
+  801013:	5d                   	pop    %ebp
+  801014:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801015:	83 ec 0c             	sub    $0xc,%esp
+  801018:	50                   	push   %eax
+  801019:	6a 04                	push   $0x4
+  80101b:	68 67 40 80 00       	push   $0x804067
+  801020:	6a 3d                	push   $0x3d
+  801022:	68 84 40 80 00       	push   $0x804084
+  801027:	e8 71 23 00 00       	call   80339d <_panic>
+
+0080102c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80102c:	55                   	push   %ebp
+  80102d:	89 e5                	mov    %esp,%ebp
+  80102f:	57                   	push   %edi
+  801030:	56                   	push   %esi
+  801031:	53                   	push   %ebx
+  801032:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801035:	8b 55 08             	mov    0x8(%ebp),%edx
+  801038:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801040:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801043:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801046:	8b 75 18             	mov    0x18(%ebp),%esi
+  801049:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80104b:	85 c0                	test   %eax,%eax
+  80104d:	7f 08                	jg     801057 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80104f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801052:	5b                   	pop    %ebx
+  801053:	5e                   	pop    %esi
+  801054:	5f                   	pop    %edi
+  801055:	5d                   	pop    %ebp
+  801056:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801057:	83 ec 0c             	sub    $0xc,%esp
+  80105a:	50                   	push   %eax
+  80105b:	6a 05                	push   $0x5
+  80105d:	68 67 40 80 00       	push   $0x804067
+  801062:	6a 23                	push   $0x23
+  801064:	68 84 40 80 00       	push   $0x804084
+  801069:	e8 2f 23 00 00       	call   80339d <_panic>
+
+0080106e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80106e:	55                   	push   %ebp
+  80106f:	89 e5                	mov    %esp,%ebp
+  801071:	57                   	push   %edi
+  801072:	56                   	push   %esi
+  801073:	53                   	push   %ebx
+  801074:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801077:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801082:	b8 06 00 00 00       	mov    $0x6,%eax
+  801087:	89 df                	mov    %ebx,%edi
+  801089:	55                   	push   %ebp
+  80108a:	89 e5                	mov    %esp,%ebp
+  80108c:	8d 35 94 10 80 00    	lea    0x801094,%esi
+  801092:	0f 34                	sysenter
+  801094:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801095:	85 c0                	test   %eax,%eax
+  801097:	7f 08                	jg     8010a1 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  801099:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109c:	5b                   	pop    %ebx
+  80109d:	5e                   	pop    %esi
+  80109e:	5f                   	pop    %edi
+  80109f:	5d                   	pop    %ebp
+  8010a0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a1:	83 ec 0c             	sub    $0xc,%esp
+  8010a4:	50                   	push   %eax
+  8010a5:	6a 06                	push   $0x6
+  8010a7:	68 67 40 80 00       	push   $0x804067
+  8010ac:	6a 3d                	push   $0x3d
+  8010ae:	68 84 40 80 00       	push   $0x804084
+  8010b3:	e8 e5 22 00 00       	call   80339d <_panic>
+
+008010b8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010b8:	55                   	push   %ebp
+  8010b9:	89 e5                	mov    %esp,%ebp
+  8010bb:	57                   	push   %edi
+  8010bc:	56                   	push   %esi
+  8010bd:	53                   	push   %ebx
+  8010be:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8010c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cc:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010d1:	89 df                	mov    %ebx,%edi
+  8010d3:	55                   	push   %ebp
+  8010d4:	89 e5                	mov    %esp,%ebp
+  8010d6:	8d 35 de 10 80 00    	lea    0x8010de,%esi
+  8010dc:	0f 34                	sysenter
+  8010de:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010df:	85 c0                	test   %eax,%eax
+  8010e1:	7f 08                	jg     8010eb <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  8010e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e6:	5b                   	pop    %ebx
+  8010e7:	5e                   	pop    %esi
+  8010e8:	5f                   	pop    %edi
+  8010e9:	5d                   	pop    %ebp
+  8010ea:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010eb:	83 ec 0c             	sub    $0xc,%esp
+  8010ee:	50                   	push   %eax
+  8010ef:	6a 08                	push   $0x8
+  8010f1:	68 67 40 80 00       	push   $0x804067
+  8010f6:	6a 3d                	push   $0x3d
+  8010f8:	68 84 40 80 00       	push   $0x804084
+  8010fd:	e8 9b 22 00 00       	call   80339d <_panic>
+
+00801102 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801102:	55                   	push   %ebp
+  801103:	89 e5                	mov    %esp,%ebp
+  801105:	57                   	push   %edi
+  801106:	56                   	push   %esi
+  801107:	53                   	push   %ebx
+  801108:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80110b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801110:	8b 55 08             	mov    0x8(%ebp),%edx
+  801113:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801116:	b8 09 00 00 00       	mov    $0x9,%eax
+  80111b:	89 df                	mov    %ebx,%edi
+  80111d:	55                   	push   %ebp
+  80111e:	89 e5                	mov    %esp,%ebp
+  801120:	8d 35 28 11 80 00    	lea    0x801128,%esi
+  801126:	0f 34                	sysenter
+  801128:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801129:	85 c0                	test   %eax,%eax
+  80112b:	7f 08                	jg     801135 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  80112d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801130:	5b                   	pop    %ebx
+  801131:	5e                   	pop    %esi
+  801132:	5f                   	pop    %edi
+  801133:	5d                   	pop    %ebp
+  801134:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801135:	83 ec 0c             	sub    $0xc,%esp
+  801138:	50                   	push   %eax
+  801139:	6a 09                	push   $0x9
+  80113b:	68 67 40 80 00       	push   $0x804067
+  801140:	6a 3d                	push   $0x3d
+  801142:	68 84 40 80 00       	push   $0x804084
+  801147:	e8 51 22 00 00       	call   80339d <_panic>
+
+0080114c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80114c:	55                   	push   %ebp
+  80114d:	89 e5                	mov    %esp,%ebp
+  80114f:	57                   	push   %edi
+  801150:	56                   	push   %esi
+  801151:	53                   	push   %ebx
+  801152:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801155:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801160:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801165:	89 df                	mov    %ebx,%edi
+  801167:	55                   	push   %ebp
+  801168:	89 e5                	mov    %esp,%ebp
+  80116a:	8d 35 72 11 80 00    	lea    0x801172,%esi
+  801170:	0f 34                	sysenter
+  801172:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801173:	85 c0                	test   %eax,%eax
+  801175:	7f 08                	jg     80117f <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  801177:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117a:	5b                   	pop    %ebx
+  80117b:	5e                   	pop    %esi
+  80117c:	5f                   	pop    %edi
+  80117d:	5d                   	pop    %ebp
+  80117e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80117f:	83 ec 0c             	sub    $0xc,%esp
+  801182:	50                   	push   %eax
+  801183:	6a 0a                	push   $0xa
+  801185:	68 67 40 80 00       	push   $0x804067
+  80118a:	6a 3d                	push   $0x3d
+  80118c:	68 84 40 80 00       	push   $0x804084
+  801191:	e8 07 22 00 00       	call   80339d <_panic>
+
+00801196 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801196:	55                   	push   %ebp
+  801197:	89 e5                	mov    %esp,%ebp
+  801199:	57                   	push   %edi
+  80119a:	56                   	push   %esi
+  80119b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80119c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011aa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011ad:	55                   	push   %ebp
+  8011ae:	89 e5                	mov    %esp,%ebp
+  8011b0:	8d 35 b8 11 80 00    	lea    0x8011b8,%esi
+  8011b6:	0f 34                	sysenter
+  8011b8:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  8011b9:	5b                   	pop    %ebx
+  8011ba:	5e                   	pop    %esi
+  8011bb:	5f                   	pop    %edi
+  8011bc:	5d                   	pop    %ebp
+  8011bd:	c3                   	ret
+
+008011be <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  8011be:	55                   	push   %ebp
+  8011bf:	89 e5                	mov    %esp,%ebp
+  8011c1:	57                   	push   %edi
+  8011c2:	56                   	push   %esi
+  8011c3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ca:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011d5:	55                   	push   %ebp
+  8011d6:	89 e5                	mov    %esp,%ebp
+  8011d8:	8d 35 e0 11 80 00    	lea    0x8011e0,%esi
+  8011de:	0f 34                	sysenter
+  8011e0:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  8011e1:	5b                   	pop    %ebx
+  8011e2:	5e                   	pop    %esi
+  8011e3:	5f                   	pop    %edi
+  8011e4:	5d                   	pop    %ebp
+  8011e5:	c3                   	ret
+
+008011e6 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	57                   	push   %edi
+  8011ea:	56                   	push   %esi
+  8011eb:	53                   	push   %ebx
+  8011ec:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011fa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801202:	89 f7                	mov    %esi,%edi
+  801204:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801206:	85 c0                	test   %eax,%eax
+  801208:	7f 08                	jg     801212 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  80120a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120d:	5b                   	pop    %ebx
+  80120e:	5e                   	pop    %esi
+  80120f:	5f                   	pop    %edi
+  801210:	5d                   	pop    %ebp
+  801211:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801212:	83 ec 0c             	sub    $0xc,%esp
+  801215:	50                   	push   %eax
+  801216:	6a 0d                	push   $0xd
+  801218:	68 67 40 80 00       	push   $0x804067
+  80121d:	6a 23                	push   $0x23
+  80121f:	68 84 40 80 00       	push   $0x804084
+  801224:	e8 74 21 00 00       	call   80339d <_panic>
+
+00801229 <sys_ipc_recv>:
+{
+  801229:	55                   	push   %ebp
+  80122a:	89 e5                	mov    %esp,%ebp
+  80122c:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  80122f:	6a 00                	push   $0x0
+  801231:	6a 01                	push   $0x1
+  801233:	ff 75 08             	push   0x8(%ebp)
+  801236:	e8 ab ff ff ff       	call   8011e6 <sys_ipc_recvv>
+}
+  80123b:	c9                   	leave
+  80123c:	c3                   	ret
+
+0080123d <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  80123d:	55                   	push   %ebp
+  80123e:	89 e5                	mov    %esp,%ebp
+  801240:	57                   	push   %edi
+  801241:	56                   	push   %esi
+  801242:	53                   	push   %ebx
+  801243:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801246:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801251:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801256:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801259:	89 de                	mov    %ebx,%esi
+  80125b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80125d:	85 c0                	test   %eax,%eax
+  80125f:	7f 08                	jg     801269 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  801261:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801264:	5b                   	pop    %ebx
+  801265:	5e                   	pop    %esi
+  801266:	5f                   	pop    %edi
+  801267:	5d                   	pop    %ebp
+  801268:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801269:	83 ec 0c             	sub    $0xc,%esp
+  80126c:	50                   	push   %eax
+  80126d:	6a 0d                	push   $0xd
+  80126f:	68 67 40 80 00       	push   $0x804067
+  801274:	6a 23                	push   $0x23
+  801276:	68 84 40 80 00       	push   $0x804084
+  80127b:	e8 1d 21 00 00       	call   80339d <_panic>
+
+00801280 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801280:	55                   	push   %ebp
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	57                   	push   %edi
+  801284:	56                   	push   %esi
+  801285:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801286:	ba 00 00 00 00       	mov    $0x0,%edx
+  80128b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801290:	89 d1                	mov    %edx,%ecx
+  801292:	89 d3                	mov    %edx,%ebx
+  801294:	89 d7                	mov    %edx,%edi
+  801296:	55                   	push   %ebp
+  801297:	89 e5                	mov    %esp,%ebp
+  801299:	8d 35 a1 12 80 00    	lea    0x8012a1,%esi
+  80129f:	0f 34                	sysenter
+  8012a1:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  8012a2:	5b                   	pop    %ebx
+  8012a3:	5e                   	pop    %esi
+  8012a4:	5f                   	pop    %edi
+  8012a5:	5d                   	pop    %ebp
+  8012a6:	c3                   	ret
+
+008012a7 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  8012a7:	55                   	push   %ebp
+  8012a8:	89 e5                	mov    %esp,%ebp
+  8012aa:	57                   	push   %edi
+  8012ab:	56                   	push   %esi
+  8012ac:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012bd:	89 df                	mov    %ebx,%edi
+  8012bf:	55                   	push   %ebp
+  8012c0:	89 e5                	mov    %esp,%ebp
+  8012c2:	8d 35 ca 12 80 00    	lea    0x8012ca,%esi
+  8012c8:	0f 34                	sysenter
+  8012ca:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  8012cb:	5b                   	pop    %ebx
+  8012cc:	5e                   	pop    %esi
+  8012cd:	5f                   	pop    %edi
+  8012ce:	5d                   	pop    %ebp
+  8012cf:	c3                   	ret
+
+008012d0 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  8012d0:	55                   	push   %ebp
+  8012d1:	89 e5                	mov    %esp,%ebp
+  8012d3:	57                   	push   %edi
+  8012d4:	56                   	push   %esi
+  8012d5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012de:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012e3:	89 cb                	mov    %ecx,%ebx
+  8012e5:	89 cf                	mov    %ecx,%edi
+  8012e7:	55                   	push   %ebp
+  8012e8:	89 e5                	mov    %esp,%ebp
+  8012ea:	8d 35 f2 12 80 00    	lea    0x8012f2,%esi
+  8012f0:	0f 34                	sysenter
+  8012f2:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  8012f3:	5b                   	pop    %ebx
+  8012f4:	5e                   	pop    %esi
+  8012f5:	5f                   	pop    %edi
+  8012f6:	5d                   	pop    %ebp
+  8012f7:	c3                   	ret
+
+008012f8 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	57                   	push   %edi
+  8012fc:	56                   	push   %esi
+  8012fd:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801303:	8b 55 08             	mov    0x8(%ebp),%edx
+  801306:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801309:	b8 12 00 00 00       	mov    $0x12,%eax
+  80130e:	89 df                	mov    %ebx,%edi
+  801310:	55                   	push   %ebp
+  801311:	89 e5                	mov    %esp,%ebp
+  801313:	8d 35 1b 13 80 00    	lea    0x80131b,%esi
+  801319:	0f 34                	sysenter
+  80131b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  80131c:	5b                   	pop    %ebx
+  80131d:	5e                   	pop    %esi
+  80131e:	5f                   	pop    %edi
+  80131f:	5d                   	pop    %ebp
+  801320:	c3                   	ret
+
+00801321 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  801321:	55                   	push   %ebp
+  801322:	89 e5                	mov    %esp,%ebp
+  801324:	57                   	push   %edi
+  801325:	56                   	push   %esi
+  801326:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801327:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801332:	b8 14 00 00 00       	mov    $0x14,%eax
+  801337:	89 df                	mov    %ebx,%edi
+  801339:	55                   	push   %ebp
+  80133a:	89 e5                	mov    %esp,%ebp
+  80133c:	8d 35 44 13 80 00    	lea    0x801344,%esi
+  801342:	0f 34                	sysenter
+  801344:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  801345:	5b                   	pop    %ebx
+  801346:	5e                   	pop    %esi
+  801347:	5f                   	pop    %edi
+  801348:	5d                   	pop    %ebp
+  801349:	c3                   	ret
+
+0080134a <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  80134a:	55                   	push   %ebp
+  80134b:	89 e5                	mov    %esp,%ebp
+  80134d:	57                   	push   %edi
+  80134e:	56                   	push   %esi
+  80134f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801350:	8b 55 08             	mov    0x8(%ebp),%edx
+  801353:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801356:	b8 13 00 00 00       	mov    $0x13,%eax
+  80135b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80135e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801361:	55                   	push   %ebp
+  801362:	89 e5                	mov    %esp,%ebp
+  801364:	8d 35 6c 13 80 00    	lea    0x80136c,%esi
+  80136a:	0f 34                	sysenter
+  80136c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  80136d:	5b                   	pop    %ebx
+  80136e:	5e                   	pop    %esi
+  80136f:	5f                   	pop    %edi
+  801370:	5d                   	pop    %ebp
+  801371:	c3                   	ret
+
+00801372 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801372:	55                   	push   %ebp
+  801373:	89 e5                	mov    %esp,%ebp
+  801375:	57                   	push   %edi
+  801376:	56                   	push   %esi
+  801377:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801378:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80137d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801380:	b8 11 00 00 00       	mov    $0x11,%eax
+  801385:	89 cb                	mov    %ecx,%ebx
+  801387:	89 cf                	mov    %ecx,%edi
+  801389:	89 ce                	mov    %ecx,%esi
+  80138b:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  80138d:	5b                   	pop    %ebx
+  80138e:	5e                   	pop    %esi
+  80138f:	5f                   	pop    %edi
+  801390:	5d                   	pop    %ebp
+  801391:	c3                   	ret
+
+00801392 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  801392:	55                   	push   %ebp
+  801393:	89 e5                	mov    %esp,%ebp
+  801395:	57                   	push   %edi
+  801396:	56                   	push   %esi
+  801397:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801398:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80139d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a0:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013a5:	89 cb                	mov    %ecx,%ebx
+  8013a7:	89 cf                	mov    %ecx,%edi
+  8013a9:	55                   	push   %ebp
+  8013aa:	89 e5                	mov    %esp,%ebp
+  8013ac:	8d 35 b4 13 80 00    	lea    0x8013b4,%esi
+  8013b2:	0f 34                	sysenter
+  8013b4:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8013b5:	5b                   	pop    %ebx
+  8013b6:	5e                   	pop    %esi
+  8013b7:	5f                   	pop    %edi
+  8013b8:	5d                   	pop    %ebp
+  8013b9:	c3                   	ret
+
+008013ba <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8013ba:	55                   	push   %ebp
+  8013bb:	89 e5                	mov    %esp,%ebp
+  8013bd:	57                   	push   %edi
+  8013be:	56                   	push   %esi
+  8013bf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8013c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c8:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013cd:	89 cb                	mov    %ecx,%ebx
+  8013cf:	89 cf                	mov    %ecx,%edi
+  8013d1:	55                   	push   %ebp
+  8013d2:	89 e5                	mov    %esp,%ebp
+  8013d4:	8d 35 dc 13 80 00    	lea    0x8013dc,%esi
+  8013da:	0f 34                	sysenter
+  8013dc:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8013dd:	5b                   	pop    %ebx
+  8013de:	5e                   	pop    %esi
+  8013df:	5f                   	pop    %edi
+  8013e0:	5d                   	pop    %ebp
+  8013e1:	c3                   	ret
+
+008013e2 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8013e2:	55                   	push   %ebp
+  8013e3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013e8:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013ed:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013f0:	5d                   	pop    %ebp
+  8013f1:	c3                   	ret
+
+008013f2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013f2:	55                   	push   %ebp
+  8013f3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013f8:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8013fd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801402:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801407:	5d                   	pop    %ebp
+  801408:	c3                   	ret
+
+00801409 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801409:	55                   	push   %ebp
+  80140a:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80140c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801411:	eb 02                	jmp    801415 <fd_alloc+0xc>
+  801413:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801415:	89 c2                	mov    %eax,%edx
+  801417:	c1 ea 16             	shr    $0x16,%edx
+  80141a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801421:	f6 c2 01             	test   $0x1,%dl
+  801424:	74 2b                	je     801451 <fd_alloc+0x48>
+  801426:	89 c2                	mov    %eax,%edx
+  801428:	c1 ea 0c             	shr    $0xc,%edx
+  80142b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801432:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801438:	f6 c1 01             	test   $0x1,%cl
+  80143b:	74 14                	je     801451 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80143d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801443:	75 ce                	jne    801413 <fd_alloc+0xa>
+  801445:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80144a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80144f:	eb 05                	jmp    801456 <fd_alloc+0x4d>
+			return 0;
+  801451:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801456:	8b 55 08             	mov    0x8(%ebp),%edx
+  801459:	89 02                	mov    %eax,(%edx)
+}
+  80145b:	89 c8                	mov    %ecx,%eax
+  80145d:	5d                   	pop    %ebp
+  80145e:	c3                   	ret
+
+0080145f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80145f:	55                   	push   %ebp
+  801460:	89 e5                	mov    %esp,%ebp
+  801462:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801465:	83 f8 1f             	cmp    $0x1f,%eax
+  801468:	77 30                	ja     80149a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80146a:	c1 e0 0c             	shl    $0xc,%eax
+  80146d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801472:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801478:	f6 c2 01             	test   $0x1,%dl
+  80147b:	74 24                	je     8014a1 <fd_lookup+0x42>
+  80147d:	89 c2                	mov    %eax,%edx
+  80147f:	c1 ea 0c             	shr    $0xc,%edx
+  801482:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801489:	f6 c2 01             	test   $0x1,%dl
+  80148c:	74 1a                	je     8014a8 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80148e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801491:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801493:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801498:	5d                   	pop    %ebp
+  801499:	c3                   	ret
+		return -E_INVAL;
+  80149a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80149f:	eb f7                	jmp    801498 <fd_lookup+0x39>
+		return -E_INVAL;
+  8014a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014a6:	eb f0                	jmp    801498 <fd_lookup+0x39>
+  8014a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014ad:	eb e9                	jmp    801498 <fd_lookup+0x39>
+
+008014af <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8014af:	55                   	push   %ebp
+  8014b0:	89 e5                	mov    %esp,%ebp
+  8014b2:	53                   	push   %ebx
+  8014b3:	83 ec 04             	sub    $0x4,%esp
+  8014b6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8014b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014be:	eb 03                	jmp    8014c3 <dev_lookup+0x14>
+  8014c0:	83 c0 01             	add    $0x1,%eax
+  8014c3:	8b 1c 85 10 41 80 00 	mov    0x804110(,%eax,4),%ebx
+  8014ca:	85 db                	test   %ebx,%ebx
+  8014cc:	74 0b                	je     8014d9 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8014ce:	39 13                	cmp    %edx,(%ebx)
+  8014d0:	75 ee                	jne    8014c0 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8014d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d7:	eb 1f                	jmp    8014f8 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8014d9:	a1 10 60 80 00       	mov    0x806010,%eax
+  8014de:	8b 40 48             	mov    0x48(%eax),%eax
+  8014e1:	83 ec 04             	sub    $0x4,%esp
+  8014e4:	52                   	push   %edx
+  8014e5:	50                   	push   %eax
+  8014e6:	68 94 40 80 00       	push   $0x804094
+  8014eb:	e8 f7 f0 ff ff       	call   8005e7 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8014f0:	83 c4 10             	add    $0x10,%esp
+  8014f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8014f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014fb:	89 1a                	mov    %ebx,(%edx)
+}
+  8014fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801500:	c9                   	leave
+  801501:	c3                   	ret
+
+00801502 <fd_close>:
+{
+  801502:	55                   	push   %ebp
+  801503:	89 e5                	mov    %esp,%ebp
+  801505:	57                   	push   %edi
+  801506:	56                   	push   %esi
+  801507:	53                   	push   %ebx
+  801508:	83 ec 24             	sub    $0x24,%esp
+  80150b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80150e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801511:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801514:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801515:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80151b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80151e:	50                   	push   %eax
+  80151f:	e8 3b ff ff ff       	call   80145f <fd_lookup>
+  801524:	89 c3                	mov    %eax,%ebx
+  801526:	83 c4 10             	add    $0x10,%esp
+  801529:	85 c0                	test   %eax,%eax
+  80152b:	78 05                	js     801532 <fd_close+0x30>
+	    || fd != fd2)
+  80152d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801530:	74 16                	je     801548 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801532:	89 f8                	mov    %edi,%eax
+  801534:	84 c0                	test   %al,%al
+  801536:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80153e:	89 d8                	mov    %ebx,%eax
+  801540:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801543:	5b                   	pop    %ebx
+  801544:	5e                   	pop    %esi
+  801545:	5f                   	pop    %edi
+  801546:	5d                   	pop    %ebp
+  801547:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801548:	83 ec 08             	sub    $0x8,%esp
+  80154b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80154e:	50                   	push   %eax
+  80154f:	ff 36                	push   (%esi)
+  801551:	e8 59 ff ff ff       	call   8014af <dev_lookup>
+  801556:	89 c3                	mov    %eax,%ebx
+  801558:	83 c4 10             	add    $0x10,%esp
+  80155b:	85 c0                	test   %eax,%eax
+  80155d:	78 1a                	js     801579 <fd_close+0x77>
+		if (dev->dev_close)
+  80155f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801562:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801565:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80156a:	85 c0                	test   %eax,%eax
+  80156c:	74 0b                	je     801579 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80156e:	83 ec 0c             	sub    $0xc,%esp
+  801571:	56                   	push   %esi
+  801572:	ff d0                	call   *%eax
+  801574:	89 c3                	mov    %eax,%ebx
+  801576:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801579:	83 ec 08             	sub    $0x8,%esp
+  80157c:	56                   	push   %esi
+  80157d:	6a 00                	push   $0x0
+  80157f:	e8 ea fa ff ff       	call   80106e <sys_page_unmap>
+	return r;
+  801584:	83 c4 10             	add    $0x10,%esp
+  801587:	eb b5                	jmp    80153e <fd_close+0x3c>
+
+00801589 <close>:
+
+int
+close(int fdnum)
+{
+  801589:	55                   	push   %ebp
+  80158a:	89 e5                	mov    %esp,%ebp
+  80158c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80158f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801592:	50                   	push   %eax
+  801593:	ff 75 08             	push   0x8(%ebp)
+  801596:	e8 c4 fe ff ff       	call   80145f <fd_lookup>
+  80159b:	83 c4 10             	add    $0x10,%esp
+  80159e:	85 c0                	test   %eax,%eax
+  8015a0:	79 02                	jns    8015a4 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8015a2:	c9                   	leave
+  8015a3:	c3                   	ret
+		return fd_close(fd, 1);
+  8015a4:	83 ec 08             	sub    $0x8,%esp
+  8015a7:	6a 01                	push   $0x1
+  8015a9:	ff 75 f4             	push   -0xc(%ebp)
+  8015ac:	e8 51 ff ff ff       	call   801502 <fd_close>
+  8015b1:	83 c4 10             	add    $0x10,%esp
+  8015b4:	eb ec                	jmp    8015a2 <close+0x19>
+
+008015b6 <close_all>:
+
+void
+close_all(void)
+{
+  8015b6:	55                   	push   %ebp
+  8015b7:	89 e5                	mov    %esp,%ebp
+  8015b9:	53                   	push   %ebx
+  8015ba:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8015bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8015c2:	83 ec 0c             	sub    $0xc,%esp
+  8015c5:	53                   	push   %ebx
+  8015c6:	e8 be ff ff ff       	call   801589 <close>
+	for (i = 0; i < MAXFD; i++)
+  8015cb:	83 c3 01             	add    $0x1,%ebx
+  8015ce:	83 c4 10             	add    $0x10,%esp
+  8015d1:	83 fb 20             	cmp    $0x20,%ebx
+  8015d4:	75 ec                	jne    8015c2 <close_all+0xc>
+}
+  8015d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015d9:	c9                   	leave
+  8015da:	c3                   	ret
+
+008015db <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8015db:	55                   	push   %ebp
+  8015dc:	89 e5                	mov    %esp,%ebp
+  8015de:	57                   	push   %edi
+  8015df:	56                   	push   %esi
+  8015e0:	53                   	push   %ebx
+  8015e1:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8015e4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015e7:	50                   	push   %eax
+  8015e8:	ff 75 08             	push   0x8(%ebp)
+  8015eb:	e8 6f fe ff ff       	call   80145f <fd_lookup>
+  8015f0:	89 c3                	mov    %eax,%ebx
+  8015f2:	83 c4 10             	add    $0x10,%esp
+  8015f5:	85 c0                	test   %eax,%eax
+  8015f7:	78 7f                	js     801678 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8015f9:	83 ec 0c             	sub    $0xc,%esp
+  8015fc:	ff 75 0c             	push   0xc(%ebp)
+  8015ff:	e8 85 ff ff ff       	call   801589 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801604:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801607:	c1 e6 0c             	shl    $0xc,%esi
+  80160a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801610:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801613:	89 3c 24             	mov    %edi,(%esp)
+  801616:	e8 d7 fd ff ff       	call   8013f2 <fd2data>
+  80161b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80161d:	89 34 24             	mov    %esi,(%esp)
+  801620:	e8 cd fd ff ff       	call   8013f2 <fd2data>
+  801625:	83 c4 10             	add    $0x10,%esp
+  801628:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80162b:	89 d8                	mov    %ebx,%eax
+  80162d:	c1 e8 16             	shr    $0x16,%eax
+  801630:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801637:	a8 01                	test   $0x1,%al
+  801639:	74 11                	je     80164c <dup+0x71>
+  80163b:	89 d8                	mov    %ebx,%eax
+  80163d:	c1 e8 0c             	shr    $0xc,%eax
+  801640:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801647:	f6 c2 01             	test   $0x1,%dl
+  80164a:	75 36                	jne    801682 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80164c:	89 f8                	mov    %edi,%eax
+  80164e:	c1 e8 0c             	shr    $0xc,%eax
+  801651:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801658:	83 ec 0c             	sub    $0xc,%esp
+  80165b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801660:	50                   	push   %eax
+  801661:	56                   	push   %esi
+  801662:	6a 00                	push   $0x0
+  801664:	57                   	push   %edi
+  801665:	6a 00                	push   $0x0
+  801667:	e8 c0 f9 ff ff       	call   80102c <sys_page_map>
+  80166c:	89 c3                	mov    %eax,%ebx
+  80166e:	83 c4 20             	add    $0x20,%esp
+  801671:	85 c0                	test   %eax,%eax
+  801673:	78 33                	js     8016a8 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801675:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801678:	89 d8                	mov    %ebx,%eax
+  80167a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80167d:	5b                   	pop    %ebx
+  80167e:	5e                   	pop    %esi
+  80167f:	5f                   	pop    %edi
+  801680:	5d                   	pop    %ebp
+  801681:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801682:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801689:	83 ec 0c             	sub    $0xc,%esp
+  80168c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801691:	50                   	push   %eax
+  801692:	ff 75 d4             	push   -0x2c(%ebp)
+  801695:	6a 00                	push   $0x0
+  801697:	53                   	push   %ebx
+  801698:	6a 00                	push   $0x0
+  80169a:	e8 8d f9 ff ff       	call   80102c <sys_page_map>
+  80169f:	89 c3                	mov    %eax,%ebx
+  8016a1:	83 c4 20             	add    $0x20,%esp
+  8016a4:	85 c0                	test   %eax,%eax
+  8016a6:	79 a4                	jns    80164c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8016a8:	83 ec 08             	sub    $0x8,%esp
+  8016ab:	56                   	push   %esi
+  8016ac:	6a 00                	push   $0x0
+  8016ae:	e8 bb f9 ff ff       	call   80106e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8016b3:	83 c4 08             	add    $0x8,%esp
+  8016b6:	ff 75 d4             	push   -0x2c(%ebp)
+  8016b9:	6a 00                	push   $0x0
+  8016bb:	e8 ae f9 ff ff       	call   80106e <sys_page_unmap>
+	return r;
+  8016c0:	83 c4 10             	add    $0x10,%esp
+  8016c3:	eb b3                	jmp    801678 <dup+0x9d>
+
+008016c5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016c5:	55                   	push   %ebp
+  8016c6:	89 e5                	mov    %esp,%ebp
+  8016c8:	56                   	push   %esi
+  8016c9:	53                   	push   %ebx
+  8016ca:	83 ec 18             	sub    $0x18,%esp
+  8016cd:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016d0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016d3:	50                   	push   %eax
+  8016d4:	56                   	push   %esi
+  8016d5:	e8 85 fd ff ff       	call   80145f <fd_lookup>
+  8016da:	83 c4 10             	add    $0x10,%esp
+  8016dd:	85 c0                	test   %eax,%eax
+  8016df:	78 3c                	js     80171d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016e1:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016e4:	83 ec 08             	sub    $0x8,%esp
+  8016e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ea:	50                   	push   %eax
+  8016eb:	ff 33                	push   (%ebx)
+  8016ed:	e8 bd fd ff ff       	call   8014af <dev_lookup>
+  8016f2:	83 c4 10             	add    $0x10,%esp
+  8016f5:	85 c0                	test   %eax,%eax
+  8016f7:	78 24                	js     80171d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016f9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016fc:	83 e0 03             	and    $0x3,%eax
+  8016ff:	83 f8 01             	cmp    $0x1,%eax
+  801702:	74 20                	je     801724 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801704:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801707:	8b 40 08             	mov    0x8(%eax),%eax
+  80170a:	85 c0                	test   %eax,%eax
+  80170c:	74 37                	je     801745 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80170e:	83 ec 04             	sub    $0x4,%esp
+  801711:	ff 75 10             	push   0x10(%ebp)
+  801714:	ff 75 0c             	push   0xc(%ebp)
+  801717:	53                   	push   %ebx
+  801718:	ff d0                	call   *%eax
+  80171a:	83 c4 10             	add    $0x10,%esp
+}
+  80171d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801720:	5b                   	pop    %ebx
+  801721:	5e                   	pop    %esi
+  801722:	5d                   	pop    %ebp
+  801723:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801724:	a1 10 60 80 00       	mov    0x806010,%eax
+  801729:	8b 40 48             	mov    0x48(%eax),%eax
+  80172c:	83 ec 04             	sub    $0x4,%esp
+  80172f:	56                   	push   %esi
+  801730:	50                   	push   %eax
+  801731:	68 d5 40 80 00       	push   $0x8040d5
+  801736:	e8 ac ee ff ff       	call   8005e7 <cprintf>
+		return -E_INVAL;
+  80173b:	83 c4 10             	add    $0x10,%esp
+  80173e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801743:	eb d8                	jmp    80171d <read+0x58>
+		return -E_NOT_SUPP;
+  801745:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80174a:	eb d1                	jmp    80171d <read+0x58>
+
+0080174c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80174c:	55                   	push   %ebp
+  80174d:	89 e5                	mov    %esp,%ebp
+  80174f:	57                   	push   %edi
+  801750:	56                   	push   %esi
+  801751:	53                   	push   %ebx
+  801752:	83 ec 0c             	sub    $0xc,%esp
+  801755:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801758:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80175b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801760:	eb 02                	jmp    801764 <readn+0x18>
+  801762:	01 c3                	add    %eax,%ebx
+  801764:	39 f3                	cmp    %esi,%ebx
+  801766:	73 21                	jae    801789 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801768:	83 ec 04             	sub    $0x4,%esp
+  80176b:	89 f0                	mov    %esi,%eax
+  80176d:	29 d8                	sub    %ebx,%eax
+  80176f:	50                   	push   %eax
+  801770:	89 d8                	mov    %ebx,%eax
+  801772:	03 45 0c             	add    0xc(%ebp),%eax
+  801775:	50                   	push   %eax
+  801776:	57                   	push   %edi
+  801777:	e8 49 ff ff ff       	call   8016c5 <read>
+		if (m < 0)
+  80177c:	83 c4 10             	add    $0x10,%esp
+  80177f:	85 c0                	test   %eax,%eax
+  801781:	78 04                	js     801787 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801783:	75 dd                	jne    801762 <readn+0x16>
+  801785:	eb 02                	jmp    801789 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801787:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801789:	89 d8                	mov    %ebx,%eax
+  80178b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80178e:	5b                   	pop    %ebx
+  80178f:	5e                   	pop    %esi
+  801790:	5f                   	pop    %edi
+  801791:	5d                   	pop    %ebp
+  801792:	c3                   	ret
+
+00801793 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801793:	55                   	push   %ebp
+  801794:	89 e5                	mov    %esp,%ebp
+  801796:	56                   	push   %esi
+  801797:	53                   	push   %ebx
+  801798:	83 ec 18             	sub    $0x18,%esp
+  80179b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80179e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017a1:	50                   	push   %eax
+  8017a2:	53                   	push   %ebx
+  8017a3:	e8 b7 fc ff ff       	call   80145f <fd_lookup>
+  8017a8:	83 c4 10             	add    $0x10,%esp
+  8017ab:	85 c0                	test   %eax,%eax
+  8017ad:	78 37                	js     8017e6 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017af:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017b2:	83 ec 08             	sub    $0x8,%esp
+  8017b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b8:	50                   	push   %eax
+  8017b9:	ff 36                	push   (%esi)
+  8017bb:	e8 ef fc ff ff       	call   8014af <dev_lookup>
+  8017c0:	83 c4 10             	add    $0x10,%esp
+  8017c3:	85 c0                	test   %eax,%eax
+  8017c5:	78 1f                	js     8017e6 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017c7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017cb:	74 20                	je     8017ed <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8017cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017d0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017d3:	85 c0                	test   %eax,%eax
+  8017d5:	74 37                	je     80180e <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8017d7:	83 ec 04             	sub    $0x4,%esp
+  8017da:	ff 75 10             	push   0x10(%ebp)
+  8017dd:	ff 75 0c             	push   0xc(%ebp)
+  8017e0:	56                   	push   %esi
+  8017e1:	ff d0                	call   *%eax
+  8017e3:	83 c4 10             	add    $0x10,%esp
+}
+  8017e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e9:	5b                   	pop    %ebx
+  8017ea:	5e                   	pop    %esi
+  8017eb:	5d                   	pop    %ebp
+  8017ec:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017ed:	a1 10 60 80 00       	mov    0x806010,%eax
+  8017f2:	8b 40 48             	mov    0x48(%eax),%eax
+  8017f5:	83 ec 04             	sub    $0x4,%esp
+  8017f8:	53                   	push   %ebx
+  8017f9:	50                   	push   %eax
+  8017fa:	68 f1 40 80 00       	push   $0x8040f1
+  8017ff:	e8 e3 ed ff ff       	call   8005e7 <cprintf>
+		return -E_INVAL;
+  801804:	83 c4 10             	add    $0x10,%esp
+  801807:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80180c:	eb d8                	jmp    8017e6 <write+0x53>
+		return -E_NOT_SUPP;
+  80180e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801813:	eb d1                	jmp    8017e6 <write+0x53>
+
+00801815 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801815:	55                   	push   %ebp
+  801816:	89 e5                	mov    %esp,%ebp
+  801818:	53                   	push   %ebx
+  801819:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80181c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80181f:	50                   	push   %eax
+  801820:	ff 75 08             	push   0x8(%ebp)
+  801823:	e8 37 fc ff ff       	call   80145f <fd_lookup>
+  801828:	83 c4 10             	add    $0x10,%esp
+  80182b:	85 c0                	test   %eax,%eax
+  80182d:	78 3a                	js     801869 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80182f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801832:	83 ec 08             	sub    $0x8,%esp
+  801835:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801838:	50                   	push   %eax
+  801839:	ff 33                	push   (%ebx)
+  80183b:	e8 6f fc ff ff       	call   8014af <dev_lookup>
+  801840:	83 c4 10             	add    $0x10,%esp
+  801843:	85 c0                	test   %eax,%eax
+  801845:	78 22                	js     801869 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801847:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80184a:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80184d:	85 c0                	test   %eax,%eax
+  80184f:	74 0d                	je     80185e <seek+0x49>
+  801851:	83 ec 0c             	sub    $0xc,%esp
+  801854:	53                   	push   %ebx
+  801855:	ff d0                	call   *%eax
+  801857:	83 c4 10             	add    $0x10,%esp
+  80185a:	85 c0                	test   %eax,%eax
+  80185c:	78 0b                	js     801869 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  80185e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801861:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801864:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801869:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80186c:	c9                   	leave
+  80186d:	c3                   	ret
+
+0080186e <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  80186e:	55                   	push   %ebp
+  80186f:	89 e5                	mov    %esp,%ebp
+  801871:	53                   	push   %ebx
+  801872:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801875:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801878:	50                   	push   %eax
+  801879:	ff 75 08             	push   0x8(%ebp)
+  80187c:	e8 de fb ff ff       	call   80145f <fd_lookup>
+  801881:	83 c4 10             	add    $0x10,%esp
+  801884:	85 c0                	test   %eax,%eax
+  801886:	78 2b                	js     8018b3 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801888:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80188b:	83 ec 08             	sub    $0x8,%esp
+  80188e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801891:	50                   	push   %eax
+  801892:	ff 33                	push   (%ebx)
+  801894:	e8 16 fc ff ff       	call   8014af <dev_lookup>
+  801899:	83 c4 10             	add    $0x10,%esp
+  80189c:	85 c0                	test   %eax,%eax
+  80189e:	78 13                	js     8018b3 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8018a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018a3:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8018a6:	85 c0                	test   %eax,%eax
+  8018a8:	74 0e                	je     8018b8 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8018aa:	83 ec 0c             	sub    $0xc,%esp
+  8018ad:	53                   	push   %ebx
+  8018ae:	ff d0                	call   *%eax
+  8018b0:	83 c4 10             	add    $0x10,%esp
+}
+  8018b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018b6:	c9                   	leave
+  8018b7:	c3                   	ret
+		return 0;
+  8018b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018bd:	eb f4                	jmp    8018b3 <fsync+0x45>
+
+008018bf <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018bf:	55                   	push   %ebp
+  8018c0:	89 e5                	mov    %esp,%ebp
+  8018c2:	56                   	push   %esi
+  8018c3:	53                   	push   %ebx
+  8018c4:	83 ec 18             	sub    $0x18,%esp
+  8018c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018ca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018cd:	50                   	push   %eax
+  8018ce:	53                   	push   %ebx
+  8018cf:	e8 8b fb ff ff       	call   80145f <fd_lookup>
+  8018d4:	83 c4 10             	add    $0x10,%esp
+  8018d7:	85 c0                	test   %eax,%eax
+  8018d9:	78 34                	js     80190f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018db:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018de:	83 ec 08             	sub    $0x8,%esp
+  8018e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018e4:	50                   	push   %eax
+  8018e5:	ff 36                	push   (%esi)
+  8018e7:	e8 c3 fb ff ff       	call   8014af <dev_lookup>
+  8018ec:	83 c4 10             	add    $0x10,%esp
+  8018ef:	85 c0                	test   %eax,%eax
+  8018f1:	78 1c                	js     80190f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018f3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018f7:	74 1d                	je     801916 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8018f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018fc:	8b 40 18             	mov    0x18(%eax),%eax
+  8018ff:	85 c0                	test   %eax,%eax
+  801901:	74 34                	je     801937 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801903:	83 ec 08             	sub    $0x8,%esp
+  801906:	ff 75 0c             	push   0xc(%ebp)
+  801909:	56                   	push   %esi
+  80190a:	ff d0                	call   *%eax
+  80190c:	83 c4 10             	add    $0x10,%esp
+}
+  80190f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801912:	5b                   	pop    %ebx
+  801913:	5e                   	pop    %esi
+  801914:	5d                   	pop    %ebp
+  801915:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801916:	a1 10 60 80 00       	mov    0x806010,%eax
+  80191b:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80191e:	83 ec 04             	sub    $0x4,%esp
+  801921:	53                   	push   %ebx
+  801922:	50                   	push   %eax
+  801923:	68 b4 40 80 00       	push   $0x8040b4
+  801928:	e8 ba ec ff ff       	call   8005e7 <cprintf>
+		return -E_INVAL;
+  80192d:	83 c4 10             	add    $0x10,%esp
+  801930:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801935:	eb d8                	jmp    80190f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801937:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80193c:	eb d1                	jmp    80190f <ftruncate+0x50>
+
+0080193e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80193e:	55                   	push   %ebp
+  80193f:	89 e5                	mov    %esp,%ebp
+  801941:	56                   	push   %esi
+  801942:	53                   	push   %ebx
+  801943:	83 ec 18             	sub    $0x18,%esp
+  801946:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801949:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80194c:	50                   	push   %eax
+  80194d:	ff 75 08             	push   0x8(%ebp)
+  801950:	e8 0a fb ff ff       	call   80145f <fd_lookup>
+  801955:	83 c4 10             	add    $0x10,%esp
+  801958:	85 c0                	test   %eax,%eax
+  80195a:	78 49                	js     8019a5 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80195c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80195f:	83 ec 08             	sub    $0x8,%esp
+  801962:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801965:	50                   	push   %eax
+  801966:	ff 36                	push   (%esi)
+  801968:	e8 42 fb ff ff       	call   8014af <dev_lookup>
+  80196d:	83 c4 10             	add    $0x10,%esp
+  801970:	85 c0                	test   %eax,%eax
+  801972:	78 31                	js     8019a5 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801974:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801977:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80197b:	74 2f                	je     8019ac <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80197d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801980:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801987:	00 00 00 
+	stat->st_isdir = 0;
+  80198a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801991:	00 00 00 
+	stat->st_dev = dev;
+  801994:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80199a:	83 ec 08             	sub    $0x8,%esp
+  80199d:	53                   	push   %ebx
+  80199e:	56                   	push   %esi
+  80199f:	ff 50 14             	call   *0x14(%eax)
+  8019a2:	83 c4 10             	add    $0x10,%esp
+}
+  8019a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019a8:	5b                   	pop    %ebx
+  8019a9:	5e                   	pop    %esi
+  8019aa:	5d                   	pop    %ebp
+  8019ab:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019ac:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019b1:	eb f2                	jmp    8019a5 <fstat+0x67>
+
+008019b3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8019b3:	55                   	push   %ebp
+  8019b4:	89 e5                	mov    %esp,%ebp
+  8019b6:	56                   	push   %esi
+  8019b7:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  8019b8:	83 ec 08             	sub    $0x8,%esp
+  8019bb:	68 00 10 00 00       	push   $0x1000
+  8019c0:	ff 75 08             	push   0x8(%ebp)
+  8019c3:	e8 b3 07 00 00       	call   80217b <open>
+  8019c8:	89 c3                	mov    %eax,%ebx
+  8019ca:	83 c4 10             	add    $0x10,%esp
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	78 1b                	js     8019ec <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  8019d1:	83 ec 08             	sub    $0x8,%esp
+  8019d4:	ff 75 0c             	push   0xc(%ebp)
+  8019d7:	50                   	push   %eax
+  8019d8:	e8 61 ff ff ff       	call   80193e <fstat>
+  8019dd:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8019df:	89 1c 24             	mov    %ebx,(%esp)
+  8019e2:	e8 a2 fb ff ff       	call   801589 <close>
+	return r;
+  8019e7:	83 c4 10             	add    $0x10,%esp
+  8019ea:	89 f3                	mov    %esi,%ebx
+}
+  8019ec:	89 d8                	mov    %ebx,%eax
+  8019ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019f1:	5b                   	pop    %ebx
+  8019f2:	5e                   	pop    %esi
+  8019f3:	5d                   	pop    %ebp
+  8019f4:	c3                   	ret
+
+008019f5 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  8019f5:	55                   	push   %ebp
+  8019f6:	89 e5                	mov    %esp,%ebp
+  8019f8:	57                   	push   %edi
+  8019f9:	56                   	push   %esi
+  8019fa:	53                   	push   %ebx
+  8019fb:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801a01:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801a07:	89 d6                	mov    %edx,%esi
+  801a09:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801a0f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801a12:	89 d3                	mov    %edx,%ebx
+  801a14:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801a1a:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801a21:	74 1d                	je     801a40 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a23:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801a28:	83 c8 07             	or     $0x7,%eax
+  801a2b:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801a31:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801a36:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801a3c:	01 ce                	add    %ecx,%esi
+  801a3e:	eb 28                	jmp    801a68 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a40:	83 ec 0c             	sub    $0xc,%esp
+  801a43:	6a 01                	push   $0x1
+  801a45:	e8 52 1e 00 00       	call   80389c <ipc_find_env>
+  801a4a:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801a4f:	83 c4 10             	add    $0x10,%esp
+  801a52:	eb cf                	jmp    801a23 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801a54:	83 c0 01             	add    $0x1,%eax
+  801a57:	89 fa                	mov    %edi,%edx
+  801a59:	09 da                	or     %ebx,%edx
+  801a5b:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801a62:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a68:	39 f3                	cmp    %esi,%ebx
+  801a6a:	72 e8                	jb     801a54 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801a6c:	83 f8 41             	cmp    $0x41,%eax
+  801a6f:	77 2f                	ja     801aa0 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801a71:	50                   	push   %eax
+  801a72:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801a78:	50                   	push   %eax
+  801a79:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801a7f:	ff 35 c8 80 80 00    	push   0x8080c8
+  801a85:	e8 c4 1d 00 00       	call   80384e <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801a8a:	83 c4 0c             	add    $0xc,%esp
+  801a8d:	6a 00                	push   $0x0
+  801a8f:	6a 00                	push   $0x0
+  801a91:	6a 00                	push   $0x0
+  801a93:	e8 60 1c 00 00       	call   8036f8 <ipc_recv>
+}
+  801a98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a9b:	5b                   	pop    %ebx
+  801a9c:	5e                   	pop    %esi
+  801a9d:	5f                   	pop    %edi
+  801a9e:	5d                   	pop    %ebp
+  801a9f:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801aa0:	68 24 41 80 00       	push   $0x804124
+  801aa5:	68 40 41 80 00       	push   $0x804140
+  801aaa:	6a 40                	push   $0x40
+  801aac:	68 55 41 80 00       	push   $0x804155
+  801ab1:	e8 e7 18 00 00       	call   80339d <_panic>
+
+00801ab6 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801ab6:	55                   	push   %ebp
+  801ab7:	89 e5                	mov    %esp,%ebp
+  801ab9:	57                   	push   %edi
+  801aba:	56                   	push   %esi
+  801abb:	53                   	push   %ebx
+  801abc:	83 ec 1c             	sub    $0x1c,%esp
+  801abf:	89 c3                	mov    %eax,%ebx
+  801ac1:	89 d6                	mov    %edx,%esi
+  801ac3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801ac6:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801acc:	89 ca                	mov    %ecx,%edx
+  801ace:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801ad1:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801ad8:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801adb:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801ae2:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ae5:	89 fb                	mov    %edi,%ebx
+  801ae7:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801aee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801af1:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801af8:	8b 75 08             	mov    0x8(%ebp),%esi
+  801afb:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801b02:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b05:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801b0c:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801b0f:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801b16:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801b1b:	39 c8                	cmp    %ecx,%eax
+  801b1d:	74 0d                	je     801b2c <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b27:	5b                   	pop    %ebx
+  801b28:	5e                   	pop    %esi
+  801b29:	5f                   	pop    %edi
+  801b2a:	5d                   	pop    %ebp
+  801b2b:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b2c:	6a 07                	push   $0x7
+  801b2e:	68 00 70 80 00       	push   $0x807000
+  801b33:	6a 0d                	push   $0xd
+  801b35:	ff 35 c8 80 80 00    	push   0x8080c8
+  801b3b:	e8 23 1c 00 00       	call   803763 <ipc_send>
+  801b40:	83 c4 10             	add    $0x10,%esp
+  801b43:	eb da                	jmp    801b1f <fsring_post+0x69>
+
+00801b45 <fsipcv>:
+{
+  801b45:	55                   	push   %ebp
+  801b46:	89 e5                	mov    %esp,%ebp
+  801b48:	57                   	push   %edi
+  801b49:	56                   	push   %esi
+  801b4a:	53                   	push   %ebx
+  801b4b:	83 ec 0c             	sub    $0xc,%esp
+  801b4e:	89 c7                	mov    %eax,%edi
+  801b50:	89 d3                	mov    %edx,%ebx
+  801b52:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801b54:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801b5b:	74 26                	je     801b83 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b5d:	6a 07                	push   $0x7
+  801b5f:	68 00 70 80 00       	push   $0x807000
+  801b64:	57                   	push   %edi
+  801b65:	ff 35 c8 80 80 00    	push   0x8080c8
+  801b6b:	e8 f3 1b 00 00       	call   803763 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801b70:	6a 00                	push   $0x0
+  801b72:	56                   	push   %esi
+  801b73:	53                   	push   %ebx
+  801b74:	6a 00                	push   $0x0
+  801b76:	e8 40 1c 00 00       	call   8037bb <ipc_recvv>
+}
+  801b7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b7e:	5b                   	pop    %ebx
+  801b7f:	5e                   	pop    %esi
+  801b80:	5f                   	pop    %edi
+  801b81:	5d                   	pop    %ebp
+  801b82:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b83:	83 ec 0c             	sub    $0xc,%esp
+  801b86:	6a 01                	push   $0x1
+  801b88:	e8 0f 1d 00 00       	call   80389c <ipc_find_env>
+  801b8d:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801b92:	83 c4 10             	add    $0x10,%esp
+  801b95:	eb c6                	jmp    801b5d <fsipcv+0x18>
+
+00801b97 <fsipc>:
+{
+  801b97:	55                   	push   %ebp
+  801b98:	89 e5                	mov    %esp,%ebp
+  801b9a:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801b9d:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801ba4:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801ba7:	e8 99 ff ff ff       	call   801b45 <fsipcv>
+}
+  801bac:	c9                   	leave
+  801bad:	c3                   	ret
+
+00801bae <file_write_direct>:
+{
+  801bae:	55                   	push   %ebp
+  801baf:	89 e5                	mov    %esp,%ebp
+  801bb1:	56                   	push   %esi
+  801bb2:	53                   	push   %ebx
+  801bb3:	89 c3                	mov    %eax,%ebx
+  801bb5:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801bb7:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801bbd:	77 40                	ja     801bff <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801bbf:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801bc4:	39 c8                	cmp    %ecx,%eax
+  801bc6:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801bc9:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801bcc:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  801bd2:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801bd7:	83 ec 04             	sub    $0x4,%esp
+  801bda:	50                   	push   %eax
+  801bdb:	52                   	push   %edx
+  801bdc:	68 08 70 80 00       	push   $0x807008
+  801be1:	e8 75 f1 ff ff       	call   800d5b <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801be6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801beb:	b8 04 00 00 00       	mov    $0x4,%eax
+  801bf0:	e8 a2 ff ff ff       	call   801b97 <fsipc>
+  801bf5:	83 c4 10             	add    $0x10,%esp
+}
+  801bf8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bfb:	5b                   	pop    %ebx
+  801bfc:	5e                   	pop    %esi
+  801bfd:	5d                   	pop    %ebp
+  801bfe:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801bff:	89 d6                	mov    %edx,%esi
+  801c01:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801c07:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801c0c:	29 f1                	sub    %esi,%ecx
+  801c0e:	39 c1                	cmp    %eax,%ecx
+  801c10:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801c13:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c16:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801c1b:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801c21:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801c27:	83 ec 0c             	sub    $0xc,%esp
+  801c2a:	6a 05                	push   $0x5
+  801c2c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c31:	e8 bf fd ff ff       	call   8019f5 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801c36:	83 c4 10             	add    $0x10,%esp
+  801c39:	eb bd                	jmp    801bf8 <file_write_direct+0x4a>
+
+00801c3b <devfile_sync>:
+{
+  801c3b:	55                   	push   %ebp
+  801c3c:	89 e5                	mov    %esp,%ebp
+  801c3e:	57                   	push   %edi
+  801c3f:	56                   	push   %esi
+  801c40:	53                   	push   %ebx
+  801c41:	83 ec 28             	sub    $0x28,%esp
+  801c44:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801c47:	56                   	push   %esi
+  801c48:	e8 a5 f7 ff ff       	call   8013f2 <fd2data>
+  801c4d:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801c4f:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801c52:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801c59:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801c61:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801c65:	74 45                	je     801cac <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801c67:	8b 46 14             	mov    0x14(%esi),%eax
+  801c6a:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c77:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801c7a:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801c7d:	39 cb                	cmp    %ecx,%ebx
+  801c7f:	73 14                	jae    801c95 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801c81:	29 d9                	sub    %ebx,%ecx
+  801c83:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801c86:	89 f0                	mov    %esi,%eax
+  801c88:	e8 21 ff ff ff       	call   801bae <file_write_direct>
+  801c8d:	85 c0                	test   %eax,%eax
+  801c8f:	7e 04                	jle    801c95 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801c91:	01 c3                	add    %eax,%ebx
+  801c93:	eb e5                	jmp    801c7a <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801c95:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801c98:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801c9f:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801ca2:	85 c0                	test   %eax,%eax
+  801ca4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ca9:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801cac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801caf:	5b                   	pop    %ebx
+  801cb0:	5e                   	pop    %esi
+  801cb1:	5f                   	pop    %edi
+  801cb2:	5d                   	pop    %ebp
+  801cb3:	c3                   	ret
+
+00801cb4 <devfile_write>:
+{
+  801cb4:	55                   	push   %ebp
+  801cb5:	89 e5                	mov    %esp,%ebp
+  801cb7:	57                   	push   %edi
+  801cb8:	56                   	push   %esi
+  801cb9:	53                   	push   %ebx
+  801cba:	83 ec 28             	sub    $0x28,%esp
+  801cbd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801cc0:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801cc3:	53                   	push   %ebx
+  801cc4:	e8 29 f7 ff ff       	call   8013f2 <fd2data>
+  801cc9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801ccc:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801ccf:	83 c4 10             	add    $0x10,%esp
+  801cd2:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801cd6:	74 43                	je     801d1b <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801cd8:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801cdf:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	74 43                	je     801d29 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801ce6:	89 c2                	mov    %eax,%edx
+  801ce8:	03 53 14             	add    0x14(%ebx),%edx
+  801ceb:	39 fa                	cmp    %edi,%edx
+  801ced:	75 0b                	jne    801cfa <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801cef:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801cf2:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801cf8:	76 66                	jbe    801d60 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801cfa:	83 ec 0c             	sub    $0xc,%esp
+  801cfd:	53                   	push   %ebx
+  801cfe:	e8 38 ff ff ff       	call   801c3b <devfile_sync>
+  801d03:	83 c4 10             	add    $0x10,%esp
+  801d06:	85 c0                	test   %eax,%eax
+  801d08:	78 4e                	js     801d58 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801d0a:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d10:	77 56                	ja     801d68 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801d12:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801d15:	85 c0                	test   %eax,%eax
+  801d17:	75 20                	jne    801d39 <devfile_write+0x85>
+  801d19:	eb 16                	jmp    801d31 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801d1b:	89 f1                	mov    %esi,%ecx
+  801d1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d20:	89 d8                	mov    %ebx,%eax
+  801d22:	e8 87 fe ff ff       	call   801bae <file_write_direct>
+  801d27:	eb 2f                	jmp    801d58 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801d29:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d2f:	77 37                	ja     801d68 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801d31:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801d34:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801d39:	83 ec 04             	sub    $0x4,%esp
+  801d3c:	56                   	push   %esi
+  801d3d:	ff 75 0c             	push   0xc(%ebp)
+  801d40:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d43:	01 c1                	add    %eax,%ecx
+  801d45:	51                   	push   %ecx
+  801d46:	e8 10 f0 ff ff       	call   800d5b <memmove>
+	ff->buf_wlen += n;
+  801d4b:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801d4e:	01 f7                	add    %esi,%edi
+  801d50:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801d53:	89 f0                	mov    %esi,%eax
+  801d55:	83 c4 10             	add    $0x10,%esp
+}
+  801d58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d5b:	5b                   	pop    %ebx
+  801d5c:	5e                   	pop    %esi
+  801d5d:	5f                   	pop    %edi
+  801d5e:	5d                   	pop    %ebp
+  801d5f:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801d60:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d66:	76 d1                	jbe    801d39 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801d68:	89 f1                	mov    %esi,%ecx
+  801d6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d6d:	89 d8                	mov    %ebx,%eax
+  801d6f:	e8 3a fe ff ff       	call   801bae <file_write_direct>
+  801d74:	eb e2                	jmp    801d58 <devfile_write+0xa4>
+
+00801d76 <devfile_trunc>:
+{
+  801d76:	55                   	push   %ebp
+  801d77:	89 e5                	mov    %esp,%ebp
+  801d79:	53                   	push   %ebx
+  801d7a:	83 ec 10             	sub    $0x10,%esp
+  801d7d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801d80:	53                   	push   %ebx
+  801d81:	e8 b5 fe ff ff       	call   801c3b <devfile_sync>
+  801d86:	83 c4 10             	add    $0x10,%esp
+  801d89:	85 c0                	test   %eax,%eax
+  801d8b:	78 1f                	js     801dac <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d8d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801d90:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801d95:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d98:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801d9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801da2:	b8 02 00 00 00       	mov    $0x2,%eax
+  801da7:	e8 eb fd ff ff       	call   801b97 <fsipc>
+}
+  801dac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801daf:	c9                   	leave
+  801db0:	c3                   	ret
+
+00801db1 <devfile_stat>:
+{
+  801db1:	55                   	push   %ebp
+  801db2:	89 e5                	mov    %esp,%ebp
+  801db4:	56                   	push   %esi
+  801db5:	53                   	push   %ebx
+  801db6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801db9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801dbc:	83 ec 0c             	sub    $0xc,%esp
+  801dbf:	53                   	push   %ebx
+  801dc0:	e8 76 fe ff ff       	call   801c3b <devfile_sync>
+  801dc5:	83 c4 10             	add    $0x10,%esp
+  801dc8:	85 c0                	test   %eax,%eax
+  801dca:	78 47                	js     801e13 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801dcc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801dcf:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801dd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd9:	b8 05 00 00 00       	mov    $0x5,%eax
+  801dde:	e8 b4 fd ff ff       	call   801b97 <fsipc>
+  801de3:	85 c0                	test   %eax,%eax
+  801de5:	78 2c                	js     801e13 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801de7:	83 ec 08             	sub    $0x8,%esp
+  801dea:	68 00 70 80 00       	push   $0x807000
+  801def:	56                   	push   %esi
+  801df0:	e8 e0 ed ff ff       	call   800bd5 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801df5:	a1 80 70 80 00       	mov    0x807080,%eax
+  801dfa:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e00:	a1 84 70 80 00       	mov    0x807084,%eax
+  801e05:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801e0b:	83 c4 10             	add    $0x10,%esp
+  801e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e16:	5b                   	pop    %ebx
+  801e17:	5e                   	pop    %esi
+  801e18:	5d                   	pop    %ebp
+  801e19:	c3                   	ret
+
+00801e1a <devfile_flush>:
+{
+  801e1a:	55                   	push   %ebp
+  801e1b:	89 e5                	mov    %esp,%ebp
+  801e1d:	56                   	push   %esi
+  801e1e:	53                   	push   %ebx
+  801e1f:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801e22:	83 ec 0c             	sub    $0xc,%esp
+  801e25:	56                   	push   %esi
+  801e26:	e8 10 fe ff ff       	call   801c3b <devfile_sync>
+  801e2b:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801e2d:	83 c4 10             	add    $0x10,%esp
+  801e30:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801e34:	75 25                	jne    801e5b <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e36:	8b 46 0c             	mov    0xc(%esi),%eax
+  801e39:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e43:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e48:	e8 4a fd ff ff       	call   801b97 <fsipc>
+  801e4d:	85 c0                	test   %eax,%eax
+  801e4f:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801e52:	89 d8                	mov    %ebx,%eax
+  801e54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e57:	5b                   	pop    %ebx
+  801e58:	5e                   	pop    %esi
+  801e59:	5d                   	pop    %ebp
+  801e5a:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801e5b:	83 ec 0c             	sub    $0xc,%esp
+  801e5e:	56                   	push   %esi
+  801e5f:	e8 8e f5 ff ff       	call   8013f2 <fd2data>
+  801e64:	83 c4 08             	add    $0x8,%esp
+  801e67:	50                   	push   %eax
+  801e68:	6a 00                	push   $0x0
+  801e6a:	e8 ff f1 ff ff       	call   80106e <sys_page_unmap>
+  801e6f:	83 c4 10             	add    $0x10,%esp
+  801e72:	eb c2                	jmp    801e36 <devfile_flush+0x1c>
+
+00801e74 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801e74:	55                   	push   %ebp
+  801e75:	89 e5                	mov    %esp,%ebp
+  801e77:	57                   	push   %edi
+  801e78:	56                   	push   %esi
+  801e79:	53                   	push   %ebx
+  801e7a:	83 ec 64             	sub    $0x64,%esp
+  801e7d:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801e7f:	52                   	push   %edx
+  801e80:	50                   	push   %eax
+  801e81:	e8 d9 f5 ff ff       	call   80145f <fd_lookup>
+  801e86:	89 c1                	mov    %eax,%ecx
+  801e88:	83 c4 10             	add    $0x10,%esp
+  801e8b:	85 c0                	test   %eax,%eax
+  801e8d:	0f 88 f2 00 00 00    	js     801f85 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801e93:	8b 07                	mov    (%edi),%eax
+  801e95:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801e9b:	39 10                	cmp    %edx,(%eax)
+  801e9d:	0f 85 03 01 00 00    	jne    801fa6 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801ea3:	a1 10 60 80 00       	mov    0x806010,%eax
+  801ea8:	8b 40 48             	mov    0x48(%eax),%eax
+  801eab:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  801eb1:	0f 84 96 00 00 00    	je     801f4d <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801eb7:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801ebe:	0f 84 cb 00 00 00    	je     801f8f <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801ec4:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801ec9:	83 c8 07             	or     $0x7,%eax
+  801ecc:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801ecf:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801ed2:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801ed7:	83 ec 04             	sub    $0x4,%esp
+  801eda:	68 07 04 00 00       	push   $0x407
+  801edf:	53                   	push   %ebx
+  801ee0:	6a 00                	push   $0x0
+  801ee2:	e8 fa f0 ff ff       	call   800fe1 <sys_page_alloc>
+  801ee7:	89 c1                	mov    %eax,%ecx
+  801ee9:	83 c4 10             	add    $0x10,%esp
+  801eec:	85 c0                	test   %eax,%eax
+  801eee:	0f 88 91 00 00 00    	js     801f85 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801ef4:	89 d8                	mov    %ebx,%eax
+  801ef6:	83 c8 07             	or     $0x7,%eax
+  801ef9:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801efb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f01:	83 c6 04             	add    $0x4,%esi
+  801f04:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801f0a:	75 cb                	jne    801ed7 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801f0c:	6a 12                	push   $0x12
+  801f0e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801f11:	50                   	push   %eax
+  801f12:	6a 0c                	push   $0xc
+  801f14:	ff 35 c8 80 80 00    	push   0x8080c8
+  801f1a:	e8 2f 19 00 00       	call   80384e <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801f1f:	83 c4 0c             	add    $0xc,%esp
+  801f22:	6a 00                	push   $0x0
+  801f24:	6a 00                	push   $0x0
+  801f26:	6a 00                	push   $0x0
+  801f28:	e8 cb 17 00 00       	call   8036f8 <ipc_recv>
+  801f2d:	89 c1                	mov    %eax,%ecx
+  801f2f:	83 c4 10             	add    $0x10,%esp
+  801f32:	85 c0                	test   %eax,%eax
+  801f34:	78 4f                	js     801f85 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801f36:	a1 10 60 80 00       	mov    0x806010,%eax
+  801f3b:	8b 40 48             	mov    0x48(%eax),%eax
+  801f3e:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  801f43:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  801f4a:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801f4d:	83 ec 0c             	sub    $0xc,%esp
+  801f50:	ff 37                	push   (%edi)
+  801f52:	e8 e4 fc ff ff       	call   801c3b <devfile_sync>
+  801f57:	89 c1                	mov    %eax,%ecx
+  801f59:	83 c4 10             	add    $0x10,%esp
+  801f5c:	85 c0                	test   %eax,%eax
+  801f5e:	78 25                	js     801f85 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801f60:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801f66:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801f6b:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f70:	89 d0                	mov    %edx,%eax
+  801f72:	d3 e0                	shl    %cl,%eax
+  801f74:	85 d8                	test   %ebx,%eax
+  801f76:	74 0d                	je     801f85 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801f78:	83 c1 01             	add    $0x1,%ecx
+  801f7b:	83 f9 10             	cmp    $0x10,%ecx
+  801f7e:	75 f0                	jne    801f70 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801f80:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801f85:	89 c8                	mov    %ecx,%eax
+  801f87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f8a:	5b                   	pop    %ebx
+  801f8b:	5e                   	pop    %esi
+  801f8c:	5f                   	pop    %edi
+  801f8d:	5d                   	pop    %ebp
+  801f8e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f8f:	83 ec 0c             	sub    $0xc,%esp
+  801f92:	6a 01                	push   $0x1
+  801f94:	e8 03 19 00 00       	call   80389c <ipc_find_env>
+  801f99:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801f9e:	83 c4 10             	add    $0x10,%esp
+  801fa1:	e9 1e ff ff ff       	jmp    801ec4 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801fa6:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801fab:	eb d8                	jmp    801f85 <fsring_slot+0x111>
+
+00801fad <file_read_direct>:
+{
+  801fad:	55                   	push   %ebp
+  801fae:	89 e5                	mov    %esp,%ebp
+  801fb0:	57                   	push   %edi
+  801fb1:	56                   	push   %esi
+  801fb2:	53                   	push   %ebx
+  801fb3:	83 ec 1c             	sub    $0x1c,%esp
+  801fb6:	89 c7                	mov    %eax,%edi
+  801fb8:	89 d6                	mov    %edx,%esi
+  801fba:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801fbc:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801fc2:	77 52                	ja     802016 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fc4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fc7:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801fcc:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801fd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd7:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fdc:	e8 b6 fb ff ff       	call   801b97 <fsipc>
+  801fe1:	89 c7                	mov    %eax,%edi
+  801fe3:	85 c0                	test   %eax,%eax
+  801fe5:	78 25                	js     80200c <file_read_direct+0x5f>
+	assert(r <= n);
+  801fe7:	39 c3                	cmp    %eax,%ebx
+  801fe9:	0f 82 87 00 00 00    	jb     802076 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801fef:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ff4:	0f 8f 95 00 00 00    	jg     80208f <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801ffa:	83 ec 04             	sub    $0x4,%esp
+  801ffd:	50                   	push   %eax
+  801ffe:	68 00 70 80 00       	push   $0x807000
+  802003:	56                   	push   %esi
+  802004:	e8 52 ed ff ff       	call   800d5b <memmove>
+	return r;
+  802009:	83 c4 10             	add    $0x10,%esp
+}
+  80200c:	89 f8                	mov    %edi,%eax
+  80200e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802011:	5b                   	pop    %ebx
+  802012:	5e                   	pop    %esi
+  802013:	5f                   	pop    %edi
+  802014:	5d                   	pop    %ebp
+  802015:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802016:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80201c:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802021:	29 d1                	sub    %edx,%ecx
+  802023:	39 d9                	cmp    %ebx,%ecx
+  802025:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802028:	89 f0                	mov    %esi,%eax
+  80202a:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  80202d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802030:	eb 0f                	jmp    802041 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  802032:	0f b6 10             	movzbl (%eax),%edx
+  802035:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802037:	05 00 10 00 00       	add    $0x1000,%eax
+  80203c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802041:	39 c8                	cmp    %ecx,%eax
+  802043:	72 ed                	jb     802032 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802045:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802048:	8b 47 0c             	mov    0xc(%edi),%eax
+  80204b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  802050:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802056:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  80205c:	83 ec 0c             	sub    $0xc,%esp
+  80205f:	6a 07                	push   $0x7
+  802061:	89 d9                	mov    %ebx,%ecx
+  802063:	89 f2                	mov    %esi,%edx
+  802065:	b8 09 00 00 00       	mov    $0x9,%eax
+  80206a:	e8 86 f9 ff ff       	call   8019f5 <fsipc_pages>
+  80206f:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  802071:	83 c4 10             	add    $0x10,%esp
+  802074:	eb 96                	jmp    80200c <file_read_direct+0x5f>
+	assert(r <= n);
+  802076:	68 60 41 80 00       	push   $0x804160
+  80207b:	68 40 41 80 00       	push   $0x804140
+  802080:	68 dc 00 00 00       	push   $0xdc
+  802085:	68 55 41 80 00       	push   $0x804155
+  80208a:	e8 0e 13 00 00       	call   80339d <_panic>
+	assert(r <= PGSIZE);
+  80208f:	68 71 41 80 00       	push   $0x804171
+  802094:	68 40 41 80 00       	push   $0x804140
+  802099:	68 dd 00 00 00       	push   $0xdd
+  80209e:	68 55 41 80 00       	push   $0x804155
+  8020a3:	e8 f5 12 00 00       	call   80339d <_panic>
+
+008020a8 <devfile_read>:
+{
+  8020a8:	55                   	push   %ebp
+  8020a9:	89 e5                	mov    %esp,%ebp
+  8020ab:	57                   	push   %edi
+  8020ac:	56                   	push   %esi
+  8020ad:	53                   	push   %ebx
+  8020ae:	83 ec 28             	sub    $0x28,%esp
+  8020b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020b4:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8020b7:	53                   	push   %ebx
+  8020b8:	e8 35 f3 ff ff       	call   8013f2 <fd2data>
+  8020bd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8020c0:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8020c3:	83 c4 10             	add    $0x10,%esp
+  8020c6:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8020ca:	74 7d                	je     802149 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8020cc:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8020d0:	0f 85 81 00 00 00    	jne    802157 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  8020d6:	8b 43 18             	mov    0x18(%ebx),%eax
+  8020d9:	85 c0                	test   %eax,%eax
+  8020db:	74 0d                	je     8020ea <devfile_read+0x42>
+  8020dd:	8b 53 14             	mov    0x14(%ebx),%edx
+  8020e0:	39 fa                	cmp    %edi,%edx
+  8020e2:	7f 06                	jg     8020ea <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8020e4:	01 c2                	add    %eax,%edx
+  8020e6:	39 d7                	cmp    %edx,%edi
+  8020e8:	72 28                	jb     802112 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8020ea:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8020f1:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8020f7:	77 74                	ja     80216d <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8020f9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020fe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802101:	89 d8                	mov    %ebx,%eax
+  802103:	e8 a5 fe ff ff       	call   801fad <file_read_direct>
+  802108:	85 c0                	test   %eax,%eax
+  80210a:	7e 35                	jle    802141 <devfile_read+0x99>
+		ff->buf_base = pos;
+  80210c:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  80210f:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  802112:	8b 53 14             	mov    0x14(%ebx),%edx
+  802115:	89 d0                	mov    %edx,%eax
+  802117:	03 43 18             	add    0x18(%ebx),%eax
+  80211a:	29 f8                	sub    %edi,%eax
+  80211c:	39 f0                	cmp    %esi,%eax
+  80211e:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  802121:	83 ec 04             	sub    $0x4,%esp
+  802124:	56                   	push   %esi
+  802125:	89 f8                	mov    %edi,%eax
+  802127:	29 d0                	sub    %edx,%eax
+  802129:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80212c:	01 c1                	add    %eax,%ecx
+  80212e:	51                   	push   %ecx
+  80212f:	ff 75 0c             	push   0xc(%ebp)
+  802132:	e8 24 ec ff ff       	call   800d5b <memmove>
+	fd->fd_offset = pos + n;
+  802137:	01 f7                	add    %esi,%edi
+  802139:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80213c:	89 f0                	mov    %esi,%eax
+  80213e:	83 c4 10             	add    $0x10,%esp
+}
+  802141:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802144:	5b                   	pop    %ebx
+  802145:	5e                   	pop    %esi
+  802146:	5f                   	pop    %edi
+  802147:	5d                   	pop    %ebp
+  802148:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802149:	89 f1                	mov    %esi,%ecx
+  80214b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80214e:	89 d8                	mov    %ebx,%eax
+  802150:	e8 58 fe ff ff       	call   801fad <file_read_direct>
+  802155:	eb ea                	jmp    802141 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802157:	83 ec 0c             	sub    $0xc,%esp
+  80215a:	53                   	push   %ebx
+  80215b:	e8 db fa ff ff       	call   801c3b <devfile_sync>
+  802160:	83 c4 10             	add    $0x10,%esp
+  802163:	85 c0                	test   %eax,%eax
+  802165:	0f 89 6b ff ff ff    	jns    8020d6 <devfile_read+0x2e>
+  80216b:	eb d4                	jmp    802141 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  80216d:	89 f1                	mov    %esi,%ecx
+  80216f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802172:	89 d8                	mov    %ebx,%eax
+  802174:	e8 34 fe ff ff       	call   801fad <file_read_direct>
+  802179:	eb c6                	jmp    802141 <devfile_read+0x99>
+
+0080217b <open>:
+{
+  80217b:	55                   	push   %ebp
+  80217c:	89 e5                	mov    %esp,%ebp
+  80217e:	56                   	push   %esi
+  80217f:	53                   	push   %ebx
+  802180:	83 ec 1c             	sub    $0x1c,%esp
+  802183:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802186:	56                   	push   %esi
+  802187:	e8 0e ea ff ff       	call   800b9a <strlen>
+  80218c:	83 c4 10             	add    $0x10,%esp
+  80218f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802194:	0f 8f a0 00 00 00    	jg     80223a <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  80219a:	83 ec 0c             	sub    $0xc,%esp
+  80219d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021a0:	50                   	push   %eax
+  8021a1:	e8 63 f2 ff ff       	call   801409 <fd_alloc>
+  8021a6:	89 c3                	mov    %eax,%ebx
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	85 c0                	test   %eax,%eax
+  8021ad:	78 45                	js     8021f4 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  8021af:	83 ec 08             	sub    $0x8,%esp
+  8021b2:	56                   	push   %esi
+  8021b3:	68 00 70 80 00       	push   $0x807000
+  8021b8:	e8 18 ea ff ff       	call   800bd5 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021c0:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021c5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021cd:	e8 c5 f9 ff ff       	call   801b97 <fsipc>
+  8021d2:	89 c3                	mov    %eax,%ebx
+  8021d4:	83 c4 10             	add    $0x10,%esp
+  8021d7:	85 c0                	test   %eax,%eax
+  8021d9:	78 22                	js     8021fd <open+0x82>
+	if (!(mode & O_NOBUF)
+  8021db:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8021e2:	74 2b                	je     80220f <open+0x94>
+	return fd2num(fd);
+  8021e4:	83 ec 0c             	sub    $0xc,%esp
+  8021e7:	ff 75 f4             	push   -0xc(%ebp)
+  8021ea:	e8 f3 f1 ff ff       	call   8013e2 <fd2num>
+  8021ef:	89 c3                	mov    %eax,%ebx
+  8021f1:	83 c4 10             	add    $0x10,%esp
+}
+  8021f4:	89 d8                	mov    %ebx,%eax
+  8021f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021f9:	5b                   	pop    %ebx
+  8021fa:	5e                   	pop    %esi
+  8021fb:	5d                   	pop    %ebp
+  8021fc:	c3                   	ret
+		fd_close(fd, 0);
+  8021fd:	83 ec 08             	sub    $0x8,%esp
+  802200:	6a 00                	push   $0x0
+  802202:	ff 75 f4             	push   -0xc(%ebp)
+  802205:	e8 f8 f2 ff ff       	call   801502 <fd_close>
+		return r;
+  80220a:	83 c4 10             	add    $0x10,%esp
+  80220d:	eb e5                	jmp    8021f4 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  80220f:	83 ec 0c             	sub    $0xc,%esp
+  802212:	ff 75 f4             	push   -0xc(%ebp)
+  802215:	e8 d8 f1 ff ff       	call   8013f2 <fd2data>
+  80221a:	83 c4 0c             	add    $0xc,%esp
+  80221d:	68 07 04 00 00       	push   $0x407
+  802222:	50                   	push   %eax
+  802223:	6a 00                	push   $0x0
+  802225:	e8 b7 ed ff ff       	call   800fe1 <sys_page_alloc>
+  80222a:	83 c4 10             	add    $0x10,%esp
+  80222d:	85 c0                	test   %eax,%eax
+  80222f:	75 b3                	jne    8021e4 <open+0x69>
+		fd->fd_file.buffered = 1;
+  802231:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802234:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802238:	eb aa                	jmp    8021e4 <open+0x69>
+		return -E_BAD_PATH;
+  80223a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80223f:	eb b3                	jmp    8021f4 <open+0x79>
+
+00802241 <readdir>:
+{
+  802241:	55                   	push   %ebp
+  802242:	89 e5                	mov    %esp,%ebp
+  802244:	53                   	push   %ebx
+  802245:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802248:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80224b:	50                   	push   %eax
+  80224c:	ff 75 08             	push   0x8(%ebp)
+  80224f:	e8 0b f2 ff ff       	call   80145f <fd_lookup>
+  802254:	89 c3                	mov    %eax,%ebx
+  802256:	83 c4 10             	add    $0x10,%esp
+  802259:	85 c0                	test   %eax,%eax
+  80225b:	78 73                	js     8022d0 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80225d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802260:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802266:	39 08                	cmp    %ecx,(%eax)
+  802268:	0f 85 82 00 00 00    	jne    8022f0 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  80226e:	83 ec 0c             	sub    $0xc,%esp
+  802271:	50                   	push   %eax
+  802272:	e8 c4 f9 ff ff       	call   801c3b <devfile_sync>
+  802277:	89 c3                	mov    %eax,%ebx
+  802279:	83 c4 10             	add    $0x10,%esp
+  80227c:	85 c0                	test   %eax,%eax
+  80227e:	78 50                	js     8022d0 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802280:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802283:	8b 40 0c             	mov    0xc(%eax),%eax
+  802286:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  80228b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80228e:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  802293:	8b 45 14             	mov    0x14(%ebp),%eax
+  802296:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  80229b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8022a5:	e8 ed f8 ff ff       	call   801b97 <fsipc>
+  8022aa:	89 c3                	mov    %eax,%ebx
+  8022ac:	85 c0                	test   %eax,%eax
+  8022ae:	7e 20                	jle    8022d0 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  8022b0:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8022b3:	72 22                	jb     8022d7 <readdir+0x96>
+  8022b5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8022ba:	7f 1b                	jg     8022d7 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8022bc:	83 ec 04             	sub    $0x4,%esp
+  8022bf:	50                   	push   %eax
+  8022c0:	68 00 70 80 00       	push   $0x807000
+  8022c5:	ff 75 0c             	push   0xc(%ebp)
+  8022c8:	e8 8e ea ff ff       	call   800d5b <memmove>
+	return r;
+  8022cd:	83 c4 10             	add    $0x10,%esp
+}
+  8022d0:	89 d8                	mov    %ebx,%eax
+  8022d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022d5:	c9                   	leave
+  8022d6:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8022d7:	68 67 41 80 00       	push   $0x804167
+  8022dc:	68 40 41 80 00       	push   $0x804140
+  8022e1:	68 86 01 00 00       	push   $0x186
+  8022e6:	68 55 41 80 00       	push   $0x804155
+  8022eb:	e8 ad 10 00 00       	call   80339d <_panic>
+		return -E_NOT_SUPP;
+  8022f0:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8022f5:	eb d9                	jmp    8022d0 <readdir+0x8f>
+
+008022f7 <munmap>:
+{
+  8022f7:	55                   	push   %ebp
+  8022f8:	89 e5                	mov    %esp,%ebp
+  8022fa:	56                   	push   %esi
+  8022fb:	53                   	push   %ebx
+  8022fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802302:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  802308:	75 41                	jne    80234b <munmap+0x54>
+  80230a:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  802310:	77 39                	ja     80234b <munmap+0x54>
+  802312:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802317:	29 f0                	sub    %esi,%eax
+  802319:	39 d0                	cmp    %edx,%eax
+  80231b:	72 35                	jb     802352 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80231d:	89 f3                	mov    %esi,%ebx
+  80231f:	01 d6                	add    %edx,%esi
+  802321:	39 f3                	cmp    %esi,%ebx
+  802323:	73 1a                	jae    80233f <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802325:	83 ec 08             	sub    $0x8,%esp
+  802328:	53                   	push   %ebx
+  802329:	6a 00                	push   $0x0
+  80232b:	e8 3e ed ff ff       	call   80106e <sys_page_unmap>
+  802330:	83 c4 10             	add    $0x10,%esp
+  802333:	85 c0                	test   %eax,%eax
+  802335:	78 0d                	js     802344 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802337:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80233d:	eb e2                	jmp    802321 <munmap+0x2a>
+	return 0;
+  80233f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802344:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802347:	5b                   	pop    %ebx
+  802348:	5e                   	pop    %esi
+  802349:	5d                   	pop    %ebp
+  80234a:	c3                   	ret
+		return -E_INVAL;
+  80234b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802350:	eb f2                	jmp    802344 <munmap+0x4d>
+  802352:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802357:	eb eb                	jmp    802344 <munmap+0x4d>
+
+00802359 <mmap>:
+{
+  802359:	55                   	push   %ebp
+  80235a:	89 e5                	mov    %esp,%ebp
+  80235c:	57                   	push   %edi
+  80235d:	56                   	push   %esi
+  80235e:	53                   	push   %ebx
+  80235f:	83 ec 34             	sub    $0x34,%esp
+  802362:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802365:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802368:	50                   	push   %eax
+  802369:	ff 75 18             	push   0x18(%ebp)
+  80236c:	e8 ee f0 ff ff       	call   80145f <fd_lookup>
+  802371:	89 c3                	mov    %eax,%ebx
+  802373:	83 c4 10             	add    $0x10,%esp
+  802376:	85 c0                	test   %eax,%eax
+  802378:	0f 88 0e 01 00 00    	js     80248c <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80237e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802381:	a1 20 50 80 00       	mov    0x805020,%eax
+  802386:	39 02                	cmp    %eax,(%edx)
+  802388:	0f 85 50 01 00 00    	jne    8024de <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  80238e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802391:	83 e0 02             	and    $0x2,%eax
+  802394:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802397:	74 0a                	je     8023a3 <mmap+0x4a>
+  802399:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80239d:	0f 84 42 01 00 00    	je     8024e5 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  8023a3:	8b 42 08             	mov    0x8(%edx),%eax
+  8023a6:	83 e0 03             	and    $0x3,%eax
+  8023a9:	83 f8 01             	cmp    $0x1,%eax
+  8023ac:	0f 84 3a 01 00 00    	je     8024ec <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8023b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b5:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8023b8:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8023bd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8023c0:	0f 85 2d 01 00 00    	jne    8024f3 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8023c6:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8023ca:	0f 88 2a 01 00 00    	js     8024fa <mmap+0x1a1>
+  8023d0:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8023d7:	0f 87 1d 01 00 00    	ja     8024fa <mmap+0x1a1>
+  8023dd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8023e2:	2b 45 08             	sub    0x8(%ebp),%eax
+  8023e5:	39 f8                	cmp    %edi,%eax
+  8023e7:	0f 82 14 01 00 00    	jb     802501 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8023ed:	83 ec 0c             	sub    $0xc,%esp
+  8023f0:	52                   	push   %edx
+  8023f1:	e8 45 f8 ff ff       	call   801c3b <devfile_sync>
+  8023f6:	89 c3                	mov    %eax,%ebx
+  8023f8:	83 c4 10             	add    $0x10,%esp
+  8023fb:	85 c0                	test   %eax,%eax
+  8023fd:	0f 88 89 00 00 00    	js     80248c <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802403:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802409:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80240f:	be 00 00 00 00       	mov    $0x0,%esi
+  802414:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802417:	39 fe                	cmp    %edi,%esi
+  802419:	73 7b                	jae    802496 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  80241b:	89 f8                	mov    %edi,%eax
+  80241d:	29 f0                	sub    %esi,%eax
+  80241f:	c1 e8 0c             	shr    $0xc,%eax
+  802422:	ba 40 00 00 00       	mov    $0x40,%edx
+  802427:	39 d0                	cmp    %edx,%eax
+  802429:	0f 47 c2             	cmova  %edx,%eax
+  80242c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80242f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802432:	8b 52 0c             	mov    0xc(%edx),%edx
+  802435:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  80243b:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  80243e:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  802444:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802449:	89 f2                	mov    %esi,%edx
+  80244b:	03 55 08             	add    0x8(%ebp),%edx
+  80244e:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802451:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802456:	e8 ea f6 ff ff       	call   801b45 <fsipcv>
+  80245b:	85 c0                	test   %eax,%eax
+  80245d:	7e 12                	jle    802471 <mmap+0x118>
+  80245f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802462:	85 c0                	test   %eax,%eax
+  802464:	0f 84 9e 00 00 00    	je     802508 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80246a:	c1 e0 0c             	shl    $0xc,%eax
+  80246d:	01 c6                	add    %eax,%esi
+  80246f:	eb a6                	jmp    802417 <mmap+0xbe>
+			munmap(addr, done);
+  802471:	89 c3                	mov    %eax,%ebx
+  802473:	83 ec 08             	sub    $0x8,%esp
+  802476:	56                   	push   %esi
+  802477:	ff 75 08             	push   0x8(%ebp)
+  80247a:	e8 78 fe ff ff       	call   8022f7 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80247f:	83 c4 10             	add    $0x10,%esp
+  802482:	85 db                	test   %ebx,%ebx
+  802484:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802489:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80248c:	89 d8                	mov    %ebx,%eax
+  80248e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802491:	5b                   	pop    %ebx
+  802492:	5e                   	pop    %esi
+  802493:	5f                   	pop    %edi
+  802494:	5d                   	pop    %ebp
+  802495:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802496:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802499:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80249b:	85 c0                	test   %eax,%eax
+  80249d:	74 ed                	je     80248c <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80249f:	be 00 00 00 00       	mov    $0x0,%esi
+  8024a4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8024a7:	39 fe                	cmp    %edi,%esi
+  8024a9:	73 2e                	jae    8024d9 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8024ab:	83 ec 0c             	sub    $0xc,%esp
+  8024ae:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8024b1:	50                   	push   %eax
+  8024b2:	e8 43 10 00 00       	call   8034fa <cowpage>
+  8024b7:	83 c4 10             	add    $0x10,%esp
+  8024ba:	85 c0                	test   %eax,%eax
+  8024bc:	78 08                	js     8024c6 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8024be:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8024c4:	eb e1                	jmp    8024a7 <mmap+0x14e>
+				munmap(addr, len);
+  8024c6:	89 c3                	mov    %eax,%ebx
+  8024c8:	83 ec 08             	sub    $0x8,%esp
+  8024cb:	57                   	push   %edi
+  8024cc:	ff 75 08             	push   0x8(%ebp)
+  8024cf:	e8 23 fe ff ff       	call   8022f7 <munmap>
+				return r;
+  8024d4:	83 c4 10             	add    $0x10,%esp
+  8024d7:	eb b3                	jmp    80248c <mmap+0x133>
+	return 0;
+  8024d9:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8024dc:	eb ae                	jmp    80248c <mmap+0x133>
+		return -E_NOT_SUPP;
+  8024de:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8024e3:	eb a7                	jmp    80248c <mmap+0x133>
+		return -E_NOT_SUPP;
+  8024e5:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8024ea:	eb a0                	jmp    80248c <mmap+0x133>
+		return -E_INVAL;
+  8024ec:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024f1:	eb 99                	jmp    80248c <mmap+0x133>
+  8024f3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024f8:	eb 92                	jmp    80248c <mmap+0x133>
+  8024fa:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024ff:	eb 8b                	jmp    80248c <mmap+0x133>
+  802501:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802506:	eb 84                	jmp    80248c <mmap+0x133>
+			munmap(addr, done);
+  802508:	83 ec 08             	sub    $0x8,%esp
+  80250b:	56                   	push   %esi
+  80250c:	ff 75 08             	push   0x8(%ebp)
+  80250f:	e8 e3 fd ff ff       	call   8022f7 <munmap>
+  802514:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802517:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80251c:	e9 6b ff ff ff       	jmp    80248c <mmap+0x133>
+
+00802521 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802521:	55                   	push   %ebp
+  802522:	89 e5                	mov    %esp,%ebp
+  802524:	56                   	push   %esi
+  802525:	53                   	push   %ebx
+  802526:	83 ec 10             	sub    $0x10,%esp
+  802529:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80252c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80252f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802532:	e8 3d f9 ff ff       	call   801e74 <fsring_slot>
+  802537:	85 c0                	test   %eax,%eax
+  802539:	78 60                	js     80259b <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80253b:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80253e:	8b 56 08             	mov    0x8(%esi),%edx
+  802541:	83 e2 03             	and    $0x3,%edx
+  802544:	83 fa 01             	cmp    $0x1,%edx
+  802547:	74 59                	je     8025a2 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802549:	ba 01 00 00 00       	mov    $0x1,%edx
+  80254e:	89 c1                	mov    %eax,%ecx
+  802550:	d3 e2                	shl    %cl,%edx
+  802552:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802558:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80255b:	c1 e2 02             	shl    $0x2,%edx
+  80255e:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  802564:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  80256b:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80256e:	8b 55 18             	mov    0x18(%ebp),%edx
+  802571:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802574:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802577:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80257a:	83 ec 08             	sub    $0x8,%esp
+  80257d:	50                   	push   %eax
+  80257e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802583:	39 c3                	cmp    %eax,%ebx
+  802585:	0f 47 d8             	cmova  %eax,%ebx
+  802588:	53                   	push   %ebx
+  802589:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80258c:	89 f2                	mov    %esi,%edx
+  80258e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802593:	e8 1e f5 ff ff       	call   801ab6 <fsring_post>
+  802598:	83 c4 10             	add    $0x10,%esp
+}
+  80259b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80259e:	5b                   	pop    %ebx
+  80259f:	5e                   	pop    %esi
+  8025a0:	5d                   	pop    %ebp
+  8025a1:	c3                   	ret
+		return -E_INVAL;
+  8025a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025a7:	eb f2                	jmp    80259b <fsring_read+0x7a>
+
+008025a9 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8025a9:	55                   	push   %ebp
+  8025aa:	89 e5                	mov    %esp,%ebp
+  8025ac:	56                   	push   %esi
+  8025ad:	53                   	push   %ebx
+  8025ae:	83 ec 10             	sub    $0x10,%esp
+  8025b1:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8025b4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ba:	e8 b5 f8 ff ff       	call   801e74 <fsring_slot>
+  8025bf:	89 c3                	mov    %eax,%ebx
+  8025c1:	85 c0                	test   %eax,%eax
+  8025c3:	78 77                	js     80263c <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8025c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025c8:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8025cc:	74 77                	je     802645 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8025ce:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8025d3:	39 c6                	cmp    %eax,%esi
+  8025d5:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8025d8:	83 ec 04             	sub    $0x4,%esp
+  8025db:	56                   	push   %esi
+  8025dc:	ff 75 0c             	push   0xc(%ebp)
+  8025df:	89 d8                	mov    %ebx,%eax
+  8025e1:	c1 e0 0c             	shl    $0xc,%eax
+  8025e4:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8025ea:	50                   	push   %eax
+  8025eb:	e8 6b e7 ff ff       	call   800d5b <memmove>
+	fsring_busy |= 1 << slot;
+  8025f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025f5:	89 d9                	mov    %ebx,%ecx
+  8025f7:	d3 e0                	shl    %cl,%eax
+  8025f9:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8025ff:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802602:	c1 e0 02             	shl    $0x2,%eax
+  802605:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  80260b:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  802612:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802615:	8b 45 18             	mov    0x18(%ebp),%eax
+  802618:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80261b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802622:	83 c4 08             	add    $0x8,%esp
+  802625:	53                   	push   %ebx
+  802626:	56                   	push   %esi
+  802627:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80262a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80262d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802632:	e8 7f f4 ff ff       	call   801ab6 <fsring_post>
+  802637:	89 c3                	mov    %eax,%ebx
+  802639:	83 c4 10             	add    $0x10,%esp
+}
+  80263c:	89 d8                	mov    %ebx,%eax
+  80263e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802641:	5b                   	pop    %ebx
+  802642:	5e                   	pop    %esi
+  802643:	5d                   	pop    %ebp
+  802644:	c3                   	ret
+		return -E_INVAL;
+  802645:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80264a:	eb f0                	jmp    80263c <fsring_write+0x93>
+
+0080264c <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80264c:	55                   	push   %ebp
+  80264d:	89 e5                	mov    %esp,%ebp
+  80264f:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802652:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802655:	8b 45 08             	mov    0x8(%ebp),%eax
+  802658:	e8 17 f8 ff ff       	call   801e74 <fsring_slot>
+  80265d:	85 c0                	test   %eax,%eax
+  80265f:	78 4c                	js     8026ad <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802661:	ba 01 00 00 00       	mov    $0x1,%edx
+  802666:	89 c1                	mov    %eax,%ecx
+  802668:	d3 e2                	shl    %cl,%edx
+  80266a:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802670:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802673:	c1 e2 02             	shl    $0x2,%edx
+  802676:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  80267c:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  802683:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802686:	8b 55 10             	mov    0x10(%ebp),%edx
+  802689:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80268c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80268f:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802692:	83 ec 08             	sub    $0x8,%esp
+  802695:	50                   	push   %eax
+  802696:	6a 00                	push   $0x0
+  802698:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80269d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026a0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8026a5:	e8 0c f4 ff ff       	call   801ab6 <fsring_post>
+  8026aa:	83 c4 10             	add    $0x10,%esp
+}
+  8026ad:	c9                   	leave
+  8026ae:	c3                   	ret
+
+008026af <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8026af:	55                   	push   %ebp
+  8026b0:	89 e5                	mov    %esp,%ebp
+  8026b2:	57                   	push   %edi
+  8026b3:	56                   	push   %esi
+  8026b4:	53                   	push   %ebx
+  8026b5:	83 ec 1c             	sub    $0x1c,%esp
+  8026b8:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8026bc:	a1 10 60 80 00       	mov    0x806010,%eax
+  8026c1:	8b 40 48             	mov    0x48(%eax),%eax
+  8026c4:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  8026ca:	74 12                	je     8026de <fsring_reap+0x2f>
+		return 0;
+  8026cc:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8026d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026d4:	5b                   	pop    %ebx
+  8026d5:	5e                   	pop    %esi
+  8026d6:	5f                   	pop    %edi
+  8026d7:	5d                   	pop    %ebp
+  8026d8:	c3                   	ret
+		sys_yield();
+  8026d9:	e8 e4 e8 ff ff       	call   800fc2 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8026de:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8026e4:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8026e9:	39 c2                	cmp    %eax,%edx
+  8026eb:	75 18                	jne    802705 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8026ed:	84 db                	test   %bl,%bl
+  8026ef:	0f 84 21 01 00 00    	je     802816 <fsring_reap+0x167>
+  8026f5:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  8026fc:	75 db                	jne    8026d9 <fsring_reap+0x2a>
+			return 0;
+  8026fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802703:	eb cc                	jmp    8026d1 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802705:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80270a:	83 e0 0f             	and    $0xf,%eax
+  80270d:	83 c0 2a             	add    $0x2a,%eax
+  802710:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802717:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  80271e:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802723:	83 c0 01             	add    $0x1,%eax
+  802726:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  80272b:	83 fb 0f             	cmp    $0xf,%ebx
+  80272e:	77 5b                	ja     80278b <fsring_reap+0xdc>
+  802730:	be 01 00 00 00       	mov    $0x1,%esi
+  802735:	89 d9                	mov    %ebx,%ecx
+  802737:	d3 e6                	shl    %cl,%esi
+  802739:	89 f0                	mov    %esi,%eax
+  80273b:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  802741:	74 48                	je     80278b <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802743:	89 d8                	mov    %ebx,%eax
+  802745:	c1 e0 0c             	shl    $0xc,%eax
+  802748:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80274e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802751:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802754:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  80275b:	83 f8 03             	cmp    $0x3,%eax
+  80275e:	74 40                	je     8027a0 <fsring_reap+0xf1>
+  802760:	83 f8 05             	cmp    $0x5,%eax
+  802763:	74 64                	je     8027c9 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802765:	f7 d6                	not    %esi
+  802767:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  80276d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802770:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  802777:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277a:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  80277c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80277f:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802781:	b8 01 00 00 00       	mov    $0x1,%eax
+  802786:	e9 46 ff ff ff       	jmp    8026d1 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80278b:	53                   	push   %ebx
+  80278c:	68 7d 41 80 00       	push   $0x80417d
+  802791:	68 8f 02 00 00       	push   $0x28f
+  802796:	68 55 41 80 00       	push   $0x804155
+  80279b:	e8 fd 0b 00 00       	call   80339d <_panic>
+		if (cqe.cqe_result > 0)
+  8027a0:	85 ff                	test   %edi,%edi
+  8027a2:	7e c1                	jle    802765 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8027a4:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8027a7:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8027ac:	39 c7                	cmp    %eax,%edi
+  8027ae:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8027b1:	50                   	push   %eax
+  8027b2:	ff 75 e4             	push   -0x1c(%ebp)
+  8027b5:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8027b8:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  8027bf:	e8 97 e5 ff ff       	call   800d5b <memmove>
+  8027c4:	83 c4 10             	add    $0x10,%esp
+  8027c7:	eb 9c                	jmp    802765 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8027c9:	85 ff                	test   %edi,%edi
+  8027cb:	75 98                	jne    802765 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  8027cd:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8027d0:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8027d7:	83 ec 08             	sub    $0x8,%esp
+  8027da:	ff 75 e4             	push   -0x1c(%ebp)
+  8027dd:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8027e0:	51                   	push   %ecx
+  8027e1:	e8 ef e3 ff ff       	call   800bd5 <strcpy>
+			st->st_size = ret->ret_size;
+  8027e6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8027e9:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8027ef:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8027f2:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8027f8:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8027fe:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802804:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  80280b:	50 80 00 
+  80280e:	83 c4 10             	add    $0x10,%esp
+  802811:	e9 4f ff ff ff       	jmp    802765 <fsring_reap+0xb6>
+			return 0;
+  802816:	b8 00 00 00 00       	mov    $0x0,%eax
+  80281b:	e9 b1 fe ff ff       	jmp    8026d1 <fsring_reap+0x22>
+
+00802820 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802820:	55                   	push   %ebp
+  802821:	89 e5                	mov    %esp,%ebp
+  802823:	57                   	push   %edi
+  802824:	56                   	push   %esi
+  802825:	53                   	push   %ebx
+  802826:	83 ec 28             	sub    $0x28,%esp
+  802829:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80282c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80282f:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802832:	53                   	push   %ebx
+  802833:	e8 62 e3 ff ff       	call   800b9a <strlen>
+  802838:	83 c4 10             	add    $0x10,%esp
+  80283b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802840:	0f 8f 02 01 00 00    	jg     802948 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802846:	83 ec 08             	sub    $0x8,%esp
+  802849:	53                   	push   %ebx
+  80284a:	68 00 70 80 00       	push   $0x807000
+  80284f:	e8 81 e3 ff ff       	call   800bd5 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802854:	83 c4 10             	add    $0x10,%esp
+  802857:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  80285d:	76 69                	jbe    8028c8 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80285f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802862:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802868:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80286d:	29 d1                	sub    %edx,%ecx
+  80286f:	39 f9                	cmp    %edi,%ecx
+  802871:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802874:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802877:	89 f9                	mov    %edi,%ecx
+  802879:	01 c1                	add    %eax,%ecx
+  80287b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80287e:	eb 0f                	jmp    80288f <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802880:	0f b6 10             	movzbl (%eax),%edx
+  802883:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802885:	05 00 10 00 00       	add    $0x1000,%eax
+  80288a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80288f:	39 c8                	cmp    %ecx,%eax
+  802891:	72 ed                	jb     802880 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802893:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802896:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  80289c:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8028a2:	83 ec 0c             	sub    $0xc,%esp
+  8028a5:	6a 07                	push   $0x7
+  8028a7:	89 f9                	mov    %edi,%ecx
+  8028a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028ac:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8028b1:	e8 3f f1 ff ff       	call   8019f5 <fsipc_pages>
+  8028b6:	89 c7                	mov    %eax,%edi
+  8028b8:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8028bb:	85 f6                	test   %esi,%esi
+  8028bd:	74 7f                	je     80293e <file_slurp+0x11e>
+  8028bf:	8d 43 01             	lea    0x1(%ebx),%eax
+  8028c2:	85 ff                	test   %edi,%edi
+  8028c4:	79 3c                	jns    802902 <file_slurp+0xe2>
+  8028c6:	eb 76                	jmp    80293e <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8028c8:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8028ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8028d8:	e8 ba f2 ff ff       	call   801b97 <fsipc>
+  8028dd:	89 c7                	mov    %eax,%edi
+  8028df:	85 c0                	test   %eax,%eax
+  8028e1:	7e d8                	jle    8028bb <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8028e3:	83 ec 04             	sub    $0x4,%esp
+  8028e6:	50                   	push   %eax
+  8028e7:	68 08 70 80 00       	push   $0x807008
+  8028ec:	ff 75 0c             	push   0xc(%ebp)
+  8028ef:	e8 67 e4 ff ff       	call   800d5b <memmove>
+  8028f4:	83 c4 10             	add    $0x10,%esp
+  8028f7:	eb c2                	jmp    8028bb <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8028f9:	80 fa 2f             	cmp    $0x2f,%dl
+  8028fc:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8028ff:	83 c0 01             	add    $0x1,%eax
+  802902:	89 c1                	mov    %eax,%ecx
+  802904:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802908:	84 d2                	test   %dl,%dl
+  80290a:	75 ed                	jne    8028f9 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  80290c:	83 ec 04             	sub    $0x4,%esp
+  80290f:	68 80 00 00 00       	push   $0x80
+  802914:	53                   	push   %ebx
+  802915:	56                   	push   %esi
+  802916:	e8 30 e3 ff ff       	call   800c4b <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  80291b:	a1 00 70 80 00       	mov    0x807000,%eax
+  802920:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802926:	a1 04 70 80 00       	mov    0x807004,%eax
+  80292b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802931:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  802938:	50 80 00 
+  80293b:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80293e:	89 f8                	mov    %edi,%eax
+  802940:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802943:	5b                   	pop    %ebx
+  802944:	5e                   	pop    %esi
+  802945:	5f                   	pop    %edi
+  802946:	5d                   	pop    %ebp
+  802947:	c3                   	ret
+		return -E_BAD_PATH;
+  802948:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  80294d:	eb ef                	jmp    80293e <file_slurp+0x11e>
+
+0080294f <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80294f:	55                   	push   %ebp
+  802950:	89 e5                	mov    %esp,%ebp
+  802952:	53                   	push   %ebx
+  802953:	83 ec 10             	sub    $0x10,%esp
+  802956:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802959:	53                   	push   %ebx
+  80295a:	e8 3b e2 ff ff       	call   800b9a <strlen>
+  80295f:	83 c4 10             	add    $0x10,%esp
+  802962:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802967:	7f 25                	jg     80298e <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802969:	83 ec 08             	sub    $0x8,%esp
+  80296c:	53                   	push   %ebx
+  80296d:	68 00 70 80 00       	push   $0x807000
+  802972:	e8 5e e2 ff ff       	call   800bd5 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802977:	ba 00 00 00 00       	mov    $0x0,%edx
+  80297c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802981:	e8 11 f2 ff ff       	call   801b97 <fsipc>
+  802986:	83 c4 10             	add    $0x10,%esp
+}
+  802989:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80298c:	c9                   	leave
+  80298d:	c3                   	ret
+		return -E_BAD_PATH;
+  80298e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802993:	eb f4                	jmp    802989 <remove+0x3a>
+
+00802995 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802995:	55                   	push   %ebp
+  802996:	89 e5                	mov    %esp,%ebp
+  802998:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80299b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029a0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8029a5:	e8 ed f1 ff ff       	call   801b97 <fsipc>
+}
+  8029aa:	c9                   	leave
+  8029ab:	c3                   	ret
+
+008029ac <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  8029ac:	55                   	push   %ebp
+  8029ad:	89 e5                	mov    %esp,%ebp
+  8029af:	57                   	push   %edi
+  8029b0:	56                   	push   %esi
+  8029b1:	53                   	push   %ebx
+  8029b2:	83 ec 18             	sub    $0x18,%esp
+  8029b5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8029b8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8029bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8029be:	57                   	push   %edi
+  8029bf:	e8 d6 e1 ff ff       	call   800b9a <strlen>
+  8029c4:	83 c4 10             	add    $0x10,%esp
+  8029c7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8029cc:	7f 4c                	jg     802a1a <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  8029ce:	83 ec 08             	sub    $0x8,%esp
+  8029d1:	57                   	push   %edi
+  8029d2:	68 00 70 80 00       	push   $0x807000
+  8029d7:	e8 f9 e1 ff ff       	call   800bd5 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  8029dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029e1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8029e6:	e8 ac f1 ff ff       	call   801b97 <fsipc>
+  8029eb:	83 c4 10             	add    $0x10,%esp
+  8029ee:	85 c0                	test   %eax,%eax
+  8029f0:	78 20                	js     802a12 <defrag+0x66>
+		return r;
+	if (before)
+  8029f2:	85 f6                	test   %esi,%esi
+  8029f4:	74 07                	je     8029fd <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  8029f6:	a1 00 70 80 00       	mov    0x807000,%eax
+  8029fb:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  8029fd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802a02:	85 db                	test   %ebx,%ebx
+  802a04:	74 0c                	je     802a12 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802a06:	a1 04 70 80 00       	mov    0x807004,%eax
+  802a0b:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a15:	5b                   	pop    %ebx
+  802a16:	5e                   	pop    %esi
+  802a17:	5f                   	pop    %edi
+  802a18:	5d                   	pop    %ebp
+  802a19:	c3                   	ret
+		return -E_BAD_PATH;
+  802a1a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802a1f:	eb f1                	jmp    802a12 <defrag+0x66>
+
+00802a21 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802a21:	55                   	push   %ebp
+  802a22:	89 e5                	mov    %esp,%ebp
+  802a24:	53                   	push   %ebx
+  802a25:	83 ec 04             	sub    $0x4,%esp
+  802a28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802a2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a30:	b8 11 00 00 00       	mov    $0x11,%eax
+  802a35:	e8 5d f1 ff ff       	call   801b97 <fsipc>
+  802a3a:	85 c0                	test   %eax,%eax
+  802a3c:	78 34                	js     802a72 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802a3e:	a1 00 70 80 00       	mov    0x807000,%eax
+  802a43:	89 03                	mov    %eax,(%ebx)
+  802a45:	a1 04 70 80 00       	mov    0x807004,%eax
+  802a4a:	89 43 04             	mov    %eax,0x4(%ebx)
+  802a4d:	a1 08 70 80 00       	mov    0x807008,%eax
+  802a52:	89 43 08             	mov    %eax,0x8(%ebx)
+  802a55:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  802a5a:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802a5d:	a1 10 70 80 00       	mov    0x807010,%eax
+  802a62:	89 43 10             	mov    %eax,0x10(%ebx)
+  802a65:	a1 14 70 80 00       	mov    0x807014,%eax
+  802a6a:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a75:	c9                   	leave
+  802a76:	c3                   	ret
+
+00802a77 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a77:	55                   	push   %ebp
+  802a78:	89 e5                	mov    %esp,%ebp
+  802a7a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802a7d:	68 96 41 80 00       	push   $0x804196
+  802a82:	ff 75 0c             	push   0xc(%ebp)
+  802a85:	e8 4b e1 ff ff       	call   800bd5 <strcpy>
+	return 0;
+}
+  802a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8f:	c9                   	leave
+  802a90:	c3                   	ret
+
+00802a91 <devsock_close>:
+{
+  802a91:	55                   	push   %ebp
+  802a92:	89 e5                	mov    %esp,%ebp
+  802a94:	53                   	push   %ebx
+  802a95:	83 ec 10             	sub    $0x10,%esp
+  802a98:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802a9b:	53                   	push   %ebx
+  802a9c:	e8 3a 0e 00 00       	call   8038db <pageref>
+  802aa1:	89 c2                	mov    %eax,%edx
+  802aa3:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802aab:	83 fa 01             	cmp    $0x1,%edx
+  802aae:	74 05                	je     802ab5 <devsock_close+0x24>
+}
+  802ab0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ab3:	c9                   	leave
+  802ab4:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802ab5:	83 ec 0c             	sub    $0xc,%esp
+  802ab8:	ff 73 0c             	push   0xc(%ebx)
+  802abb:	e8 b7 02 00 00       	call   802d77 <nsipc_close>
+  802ac0:	83 c4 10             	add    $0x10,%esp
+  802ac3:	eb eb                	jmp    802ab0 <devsock_close+0x1f>
+
+00802ac5 <devsock_write>:
+{
+  802ac5:	55                   	push   %ebp
+  802ac6:	89 e5                	mov    %esp,%ebp
+  802ac8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802acb:	6a 00                	push   $0x0
+  802acd:	ff 75 10             	push   0x10(%ebp)
+  802ad0:	ff 75 0c             	push   0xc(%ebp)
+  802ad3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad6:	ff 70 0c             	push   0xc(%eax)
+  802ad9:	e8 79 03 00 00       	call   802e57 <nsipc_send>
+}
+  802ade:	c9                   	leave
+  802adf:	c3                   	ret
+
+00802ae0 <devsock_read>:
+{
+  802ae0:	55                   	push   %ebp
+  802ae1:	89 e5                	mov    %esp,%ebp
+  802ae3:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802ae6:	6a 00                	push   $0x0
+  802ae8:	ff 75 10             	push   0x10(%ebp)
+  802aeb:	ff 75 0c             	push   0xc(%ebp)
+  802aee:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af1:	ff 70 0c             	push   0xc(%eax)
+  802af4:	e8 ef 02 00 00       	call   802de8 <nsipc_recv>
+}
+  802af9:	c9                   	leave
+  802afa:	c3                   	ret
+
+00802afb <fd2sockid>:
+{
+  802afb:	55                   	push   %ebp
+  802afc:	89 e5                	mov    %esp,%ebp
+  802afe:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802b01:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b04:	52                   	push   %edx
+  802b05:	50                   	push   %eax
+  802b06:	e8 54 e9 ff ff       	call   80145f <fd_lookup>
+  802b0b:	83 c4 10             	add    $0x10,%esp
+  802b0e:	85 c0                	test   %eax,%eax
+  802b10:	78 10                	js     802b22 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802b12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b15:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802b1b:	39 08                	cmp    %ecx,(%eax)
+  802b1d:	75 05                	jne    802b24 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802b1f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802b22:	c9                   	leave
+  802b23:	c3                   	ret
+		return -E_NOT_SUPP;
+  802b24:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802b29:	eb f7                	jmp    802b22 <fd2sockid+0x27>
+
+00802b2b <alloc_sockfd>:
+{
+  802b2b:	55                   	push   %ebp
+  802b2c:	89 e5                	mov    %esp,%ebp
+  802b2e:	56                   	push   %esi
+  802b2f:	53                   	push   %ebx
+  802b30:	83 ec 1c             	sub    $0x1c,%esp
+  802b33:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802b35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b38:	50                   	push   %eax
+  802b39:	e8 cb e8 ff ff       	call   801409 <fd_alloc>
+  802b3e:	89 c3                	mov    %eax,%ebx
+  802b40:	83 c4 10             	add    $0x10,%esp
+  802b43:	85 c0                	test   %eax,%eax
+  802b45:	78 43                	js     802b8a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802b47:	83 ec 04             	sub    $0x4,%esp
+  802b4a:	68 07 04 00 00       	push   $0x407
+  802b4f:	ff 75 f4             	push   -0xc(%ebp)
+  802b52:	6a 00                	push   $0x0
+  802b54:	e8 88 e4 ff ff       	call   800fe1 <sys_page_alloc>
+  802b59:	89 c3                	mov    %eax,%ebx
+  802b5b:	83 c4 10             	add    $0x10,%esp
+  802b5e:	85 c0                	test   %eax,%eax
+  802b60:	78 28                	js     802b8a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802b62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b65:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802b6b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802b6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b70:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802b77:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802b7a:	83 ec 0c             	sub    $0xc,%esp
+  802b7d:	50                   	push   %eax
+  802b7e:	e8 5f e8 ff ff       	call   8013e2 <fd2num>
+  802b83:	89 c3                	mov    %eax,%ebx
+  802b85:	83 c4 10             	add    $0x10,%esp
+  802b88:	eb 0c                	jmp    802b96 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802b8a:	83 ec 0c             	sub    $0xc,%esp
+  802b8d:	56                   	push   %esi
+  802b8e:	e8 e4 01 00 00       	call   802d77 <nsipc_close>
+		return r;
+  802b93:	83 c4 10             	add    $0x10,%esp
+}
+  802b96:	89 d8                	mov    %ebx,%eax
+  802b98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b9b:	5b                   	pop    %ebx
+  802b9c:	5e                   	pop    %esi
+  802b9d:	5d                   	pop    %ebp
+  802b9e:	c3                   	ret
+
+00802b9f <accept>:
+{
+  802b9f:	55                   	push   %ebp
+  802ba0:	89 e5                	mov    %esp,%ebp
+  802ba2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ba5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba8:	e8 4e ff ff ff       	call   802afb <fd2sockid>
+  802bad:	85 c0                	test   %eax,%eax
+  802baf:	78 1b                	js     802bcc <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802bb1:	83 ec 04             	sub    $0x4,%esp
+  802bb4:	ff 75 10             	push   0x10(%ebp)
+  802bb7:	ff 75 0c             	push   0xc(%ebp)
+  802bba:	50                   	push   %eax
+  802bbb:	e8 0e 01 00 00       	call   802cce <nsipc_accept>
+  802bc0:	83 c4 10             	add    $0x10,%esp
+  802bc3:	85 c0                	test   %eax,%eax
+  802bc5:	78 05                	js     802bcc <accept+0x2d>
+	return alloc_sockfd(r);
+  802bc7:	e8 5f ff ff ff       	call   802b2b <alloc_sockfd>
+}
+  802bcc:	c9                   	leave
+  802bcd:	c3                   	ret
+
+00802bce <bind>:
+{
+  802bce:	55                   	push   %ebp
+  802bcf:	89 e5                	mov    %esp,%ebp
+  802bd1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd7:	e8 1f ff ff ff       	call   802afb <fd2sockid>
+  802bdc:	85 c0                	test   %eax,%eax
+  802bde:	78 12                	js     802bf2 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802be0:	83 ec 04             	sub    $0x4,%esp
+  802be3:	ff 75 10             	push   0x10(%ebp)
+  802be6:	ff 75 0c             	push   0xc(%ebp)
+  802be9:	50                   	push   %eax
+  802bea:	e8 31 01 00 00       	call   802d20 <nsipc_bind>
+  802bef:	83 c4 10             	add    $0x10,%esp
+}
+  802bf2:	c9                   	leave
+  802bf3:	c3                   	ret
+
+00802bf4 <shutdown>:
+{
+  802bf4:	55                   	push   %ebp
+  802bf5:	89 e5                	mov    %esp,%ebp
+  802bf7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bfa:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bfd:	e8 f9 fe ff ff       	call   802afb <fd2sockid>
+  802c02:	85 c0                	test   %eax,%eax
+  802c04:	78 0f                	js     802c15 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802c06:	83 ec 08             	sub    $0x8,%esp
+  802c09:	ff 75 0c             	push   0xc(%ebp)
+  802c0c:	50                   	push   %eax
+  802c0d:	e8 43 01 00 00       	call   802d55 <nsipc_shutdown>
+  802c12:	83 c4 10             	add    $0x10,%esp
+}
+  802c15:	c9                   	leave
+  802c16:	c3                   	ret
+
+00802c17 <connect>:
+{
+  802c17:	55                   	push   %ebp
+  802c18:	89 e5                	mov    %esp,%ebp
+  802c1a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c20:	e8 d6 fe ff ff       	call   802afb <fd2sockid>
+  802c25:	85 c0                	test   %eax,%eax
+  802c27:	78 12                	js     802c3b <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802c29:	83 ec 04             	sub    $0x4,%esp
+  802c2c:	ff 75 10             	push   0x10(%ebp)
+  802c2f:	ff 75 0c             	push   0xc(%ebp)
+  802c32:	50                   	push   %eax
+  802c33:	e8 59 01 00 00       	call   802d91 <nsipc_connect>
+  802c38:	83 c4 10             	add    $0x10,%esp
+}
+  802c3b:	c9                   	leave
+  802c3c:	c3                   	ret
+
+00802c3d <listen>:
+{
+  802c3d:	55                   	push   %ebp
+  802c3e:	89 e5                	mov    %esp,%ebp
+  802c40:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c43:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c46:	e8 b0 fe ff ff       	call   802afb <fd2sockid>
+  802c4b:	85 c0                	test   %eax,%eax
+  802c4d:	78 0f                	js     802c5e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c4f:	83 ec 08             	sub    $0x8,%esp
+  802c52:	ff 75 0c             	push   0xc(%ebp)
+  802c55:	50                   	push   %eax
+  802c56:	e8 6b 01 00 00       	call   802dc6 <nsipc_listen>
+  802c5b:	83 c4 10             	add    $0x10,%esp
+}
+  802c5e:	c9                   	leave
+  802c5f:	c3                   	ret
+
+00802c60 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802c60:	55                   	push   %ebp
+  802c61:	89 e5                	mov    %esp,%ebp
+  802c63:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802c66:	ff 75 10             	push   0x10(%ebp)
+  802c69:	ff 75 0c             	push   0xc(%ebp)
+  802c6c:	ff 75 08             	push   0x8(%ebp)
+  802c6f:	e8 41 02 00 00       	call   802eb5 <nsipc_socket>
+  802c74:	83 c4 10             	add    $0x10,%esp
+  802c77:	85 c0                	test   %eax,%eax
+  802c79:	78 05                	js     802c80 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802c7b:	e8 ab fe ff ff       	call   802b2b <alloc_sockfd>
+}
+  802c80:	c9                   	leave
+  802c81:	c3                   	ret
+
+00802c82 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802c82:	55                   	push   %ebp
+  802c83:	89 e5                	mov    %esp,%ebp
+  802c85:	53                   	push   %ebx
+  802c86:	83 ec 04             	sub    $0x4,%esp
+  802c89:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802c8b:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802c92:	74 26                	je     802cba <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802c94:	6a 07                	push   $0x7
+  802c96:	68 00 90 80 00       	push   $0x809000
+  802c9b:	53                   	push   %ebx
+  802c9c:	ff 35 00 a0 80 00    	push   0x80a000
+  802ca2:	e8 bc 0a 00 00       	call   803763 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802ca7:	83 c4 0c             	add    $0xc,%esp
+  802caa:	6a 00                	push   $0x0
+  802cac:	6a 00                	push   $0x0
+  802cae:	6a 00                	push   $0x0
+  802cb0:	e8 43 0a 00 00       	call   8036f8 <ipc_recv>
+}
+  802cb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cb8:	c9                   	leave
+  802cb9:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802cba:	83 ec 0c             	sub    $0xc,%esp
+  802cbd:	6a 02                	push   $0x2
+  802cbf:	e8 d8 0b 00 00       	call   80389c <ipc_find_env>
+  802cc4:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  802cc9:	83 c4 10             	add    $0x10,%esp
+  802ccc:	eb c6                	jmp    802c94 <nsipc+0x12>
+
+00802cce <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802cce:	55                   	push   %ebp
+  802ccf:	89 e5                	mov    %esp,%ebp
+  802cd1:	56                   	push   %esi
+  802cd2:	53                   	push   %ebx
+  802cd3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802cd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd9:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802cde:	8b 06                	mov    (%esi),%eax
+  802ce0:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802ce5:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cea:	e8 93 ff ff ff       	call   802c82 <nsipc>
+  802cef:	89 c3                	mov    %eax,%ebx
+  802cf1:	85 c0                	test   %eax,%eax
+  802cf3:	79 09                	jns    802cfe <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802cf5:	89 d8                	mov    %ebx,%eax
+  802cf7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cfa:	5b                   	pop    %ebx
+  802cfb:	5e                   	pop    %esi
+  802cfc:	5d                   	pop    %ebp
+  802cfd:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802cfe:	83 ec 04             	sub    $0x4,%esp
+  802d01:	ff 35 10 90 80 00    	push   0x809010
+  802d07:	68 00 90 80 00       	push   $0x809000
+  802d0c:	ff 75 0c             	push   0xc(%ebp)
+  802d0f:	e8 47 e0 ff ff       	call   800d5b <memmove>
+		*addrlen = ret->ret_addrlen;
+  802d14:	a1 10 90 80 00       	mov    0x809010,%eax
+  802d19:	89 06                	mov    %eax,(%esi)
+  802d1b:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802d1e:	eb d5                	jmp    802cf5 <nsipc_accept+0x27>
+
+00802d20 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802d20:	55                   	push   %ebp
+  802d21:	89 e5                	mov    %esp,%ebp
+  802d23:	53                   	push   %ebx
+  802d24:	83 ec 08             	sub    $0x8,%esp
+  802d27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802d2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d2d:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802d32:	53                   	push   %ebx
+  802d33:	ff 75 0c             	push   0xc(%ebp)
+  802d36:	68 04 90 80 00       	push   $0x809004
+  802d3b:	e8 1b e0 ff ff       	call   800d5b <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d40:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802d46:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d4b:	e8 32 ff ff ff       	call   802c82 <nsipc>
+}
+  802d50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d53:	c9                   	leave
+  802d54:	c3                   	ret
+
+00802d55 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d55:	55                   	push   %ebp
+  802d56:	89 e5                	mov    %esp,%ebp
+  802d58:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802d5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d5e:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802d63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d66:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802d6b:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d70:	e8 0d ff ff ff       	call   802c82 <nsipc>
+}
+  802d75:	c9                   	leave
+  802d76:	c3                   	ret
+
+00802d77 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d77:	55                   	push   %ebp
+  802d78:	89 e5                	mov    %esp,%ebp
+  802d7a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802d7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d80:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802d85:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d8a:	e8 f3 fe ff ff       	call   802c82 <nsipc>
+}
+  802d8f:	c9                   	leave
+  802d90:	c3                   	ret
+
+00802d91 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802d91:	55                   	push   %ebp
+  802d92:	89 e5                	mov    %esp,%ebp
+  802d94:	53                   	push   %ebx
+  802d95:	83 ec 08             	sub    $0x8,%esp
+  802d98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802d9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d9e:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802da3:	53                   	push   %ebx
+  802da4:	ff 75 0c             	push   0xc(%ebp)
+  802da7:	68 04 90 80 00       	push   $0x809004
+  802dac:	e8 aa df ff ff       	call   800d5b <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802db1:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802db7:	b8 05 00 00 00       	mov    $0x5,%eax
+  802dbc:	e8 c1 fe ff ff       	call   802c82 <nsipc>
+}
+  802dc1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dc4:	c9                   	leave
+  802dc5:	c3                   	ret
+
+00802dc6 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802dc6:	55                   	push   %ebp
+  802dc7:	89 e5                	mov    %esp,%ebp
+  802dc9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802dcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dcf:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802dd4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dd7:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802ddc:	b8 06 00 00 00       	mov    $0x6,%eax
+  802de1:	e8 9c fe ff ff       	call   802c82 <nsipc>
+}
+  802de6:	c9                   	leave
+  802de7:	c3                   	ret
+
+00802de8 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802de8:	55                   	push   %ebp
+  802de9:	89 e5                	mov    %esp,%ebp
+  802deb:	56                   	push   %esi
+  802dec:	53                   	push   %ebx
+  802ded:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802df0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802df3:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802df8:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802dfe:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e01:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802e06:	b8 07 00 00 00       	mov    $0x7,%eax
+  802e0b:	e8 72 fe ff ff       	call   802c82 <nsipc>
+  802e10:	89 c3                	mov    %eax,%ebx
+  802e12:	85 c0                	test   %eax,%eax
+  802e14:	78 22                	js     802e38 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802e16:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802e1b:	39 c6                	cmp    %eax,%esi
+  802e1d:	0f 4e c6             	cmovle %esi,%eax
+  802e20:	39 c3                	cmp    %eax,%ebx
+  802e22:	7f 1d                	jg     802e41 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802e24:	83 ec 04             	sub    $0x4,%esp
+  802e27:	53                   	push   %ebx
+  802e28:	68 00 90 80 00       	push   $0x809000
+  802e2d:	ff 75 0c             	push   0xc(%ebp)
+  802e30:	e8 26 df ff ff       	call   800d5b <memmove>
+  802e35:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e38:	89 d8                	mov    %ebx,%eax
+  802e3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e3d:	5b                   	pop    %ebx
+  802e3e:	5e                   	pop    %esi
+  802e3f:	5d                   	pop    %ebp
+  802e40:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e41:	68 a2 41 80 00       	push   $0x8041a2
+  802e46:	68 40 41 80 00       	push   $0x804140
+  802e4b:	6a 62                	push   $0x62
+  802e4d:	68 b7 41 80 00       	push   $0x8041b7
+  802e52:	e8 46 05 00 00       	call   80339d <_panic>
+
+00802e57 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e57:	55                   	push   %ebp
+  802e58:	89 e5                	mov    %esp,%ebp
+  802e5a:	53                   	push   %ebx
+  802e5b:	83 ec 04             	sub    $0x4,%esp
+  802e5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802e61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e64:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802e69:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802e6f:	7f 2e                	jg     802e9f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802e71:	83 ec 04             	sub    $0x4,%esp
+  802e74:	53                   	push   %ebx
+  802e75:	ff 75 0c             	push   0xc(%ebp)
+  802e78:	68 0c 90 80 00       	push   $0x80900c
+  802e7d:	e8 d9 de ff ff       	call   800d5b <memmove>
+	nsipcbuf.send.req_size = size;
+  802e82:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802e88:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e8b:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802e90:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e95:	e8 e8 fd ff ff       	call   802c82 <nsipc>
+}
+  802e9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e9d:	c9                   	leave
+  802e9e:	c3                   	ret
+	assert(size < 1600);
+  802e9f:	68 c3 41 80 00       	push   $0x8041c3
+  802ea4:	68 40 41 80 00       	push   $0x804140
+  802ea9:	6a 6d                	push   $0x6d
+  802eab:	68 b7 41 80 00       	push   $0x8041b7
+  802eb0:	e8 e8 04 00 00       	call   80339d <_panic>
+
+00802eb5 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802eb5:	55                   	push   %ebp
+  802eb6:	89 e5                	mov    %esp,%ebp
+  802eb8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802ebb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ebe:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802ec3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ec6:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802ecb:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ece:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802ed3:	b8 09 00 00 00       	mov    $0x9,%eax
+  802ed8:	e8 a5 fd ff ff       	call   802c82 <nsipc>
+}
+  802edd:	c9                   	leave
+  802ede:	c3                   	ret
+
+00802edf <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802edf:	55                   	push   %ebp
+  802ee0:	89 e5                	mov    %esp,%ebp
+  802ee2:	56                   	push   %esi
+  802ee3:	53                   	push   %ebx
+  802ee4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802ee7:	83 ec 0c             	sub    $0xc,%esp
+  802eea:	ff 75 08             	push   0x8(%ebp)
+  802eed:	e8 00 e5 ff ff       	call   8013f2 <fd2data>
+  802ef2:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802ef4:	83 c4 08             	add    $0x8,%esp
+  802ef7:	68 cf 41 80 00       	push   $0x8041cf
+  802efc:	53                   	push   %ebx
+  802efd:	e8 d3 dc ff ff       	call   800bd5 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802f02:	8b 46 04             	mov    0x4(%esi),%eax
+  802f05:	2b 06                	sub    (%esi),%eax
+  802f07:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802f0d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f14:	00 00 00 
+	stat->st_dev = &devpipe;
+  802f17:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  802f1e:	50 80 00 
+	return 0;
+}
+  802f21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f29:	5b                   	pop    %ebx
+  802f2a:	5e                   	pop    %esi
+  802f2b:	5d                   	pop    %ebp
+  802f2c:	c3                   	ret
+
+00802f2d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802f2d:	55                   	push   %ebp
+  802f2e:	89 e5                	mov    %esp,%ebp
+  802f30:	53                   	push   %ebx
+  802f31:	83 ec 0c             	sub    $0xc,%esp
+  802f34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802f37:	53                   	push   %ebx
+  802f38:	6a 00                	push   $0x0
+  802f3a:	e8 2f e1 ff ff       	call   80106e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802f3f:	89 1c 24             	mov    %ebx,(%esp)
+  802f42:	e8 ab e4 ff ff       	call   8013f2 <fd2data>
+  802f47:	83 c4 08             	add    $0x8,%esp
+  802f4a:	50                   	push   %eax
+  802f4b:	6a 00                	push   $0x0
+  802f4d:	e8 1c e1 ff ff       	call   80106e <sys_page_unmap>
+}
+  802f52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f55:	c9                   	leave
+  802f56:	c3                   	ret
+
+00802f57 <_pipeisclosed>:
+{
+  802f57:	55                   	push   %ebp
+  802f58:	89 e5                	mov    %esp,%ebp
+  802f5a:	57                   	push   %edi
+  802f5b:	56                   	push   %esi
+  802f5c:	53                   	push   %ebx
+  802f5d:	83 ec 1c             	sub    $0x1c,%esp
+  802f60:	89 c7                	mov    %eax,%edi
+  802f62:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802f64:	a1 10 60 80 00       	mov    0x806010,%eax
+  802f69:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802f6c:	83 ec 0c             	sub    $0xc,%esp
+  802f6f:	57                   	push   %edi
+  802f70:	e8 66 09 00 00       	call   8038db <pageref>
+  802f75:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f78:	89 34 24             	mov    %esi,(%esp)
+  802f7b:	e8 5b 09 00 00       	call   8038db <pageref>
+		nn = thisenv->env_runs;
+  802f80:	8b 15 10 60 80 00    	mov    0x806010,%edx
+  802f86:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802f89:	83 c4 10             	add    $0x10,%esp
+  802f8c:	39 cb                	cmp    %ecx,%ebx
+  802f8e:	74 1b                	je     802fab <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802f90:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f93:	75 cf                	jne    802f64 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802f95:	8b 42 58             	mov    0x58(%edx),%eax
+  802f98:	6a 01                	push   $0x1
+  802f9a:	50                   	push   %eax
+  802f9b:	53                   	push   %ebx
+  802f9c:	68 d6 41 80 00       	push   $0x8041d6
+  802fa1:	e8 41 d6 ff ff       	call   8005e7 <cprintf>
+  802fa6:	83 c4 10             	add    $0x10,%esp
+  802fa9:	eb b9                	jmp    802f64 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802fab:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802fae:	0f 94 c0             	sete   %al
+  802fb1:	0f b6 c0             	movzbl %al,%eax
+}
+  802fb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fb7:	5b                   	pop    %ebx
+  802fb8:	5e                   	pop    %esi
+  802fb9:	5f                   	pop    %edi
+  802fba:	5d                   	pop    %ebp
+  802fbb:	c3                   	ret
+
+00802fbc <devpipe_write>:
+{
+  802fbc:	55                   	push   %ebp
+  802fbd:	89 e5                	mov    %esp,%ebp
+  802fbf:	57                   	push   %edi
+  802fc0:	56                   	push   %esi
+  802fc1:	53                   	push   %ebx
+  802fc2:	83 ec 28             	sub    $0x28,%esp
+  802fc5:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802fc8:	56                   	push   %esi
+  802fc9:	e8 24 e4 ff ff       	call   8013f2 <fd2data>
+  802fce:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802fd0:	83 c4 10             	add    $0x10,%esp
+  802fd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802fdb:	75 09                	jne    802fe6 <devpipe_write+0x2a>
+	return i;
+  802fdd:	89 f8                	mov    %edi,%eax
+  802fdf:	eb 23                	jmp    803004 <devpipe_write+0x48>
+			sys_yield();
+  802fe1:	e8 dc df ff ff       	call   800fc2 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802fe6:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fe9:	8b 0b                	mov    (%ebx),%ecx
+  802feb:	8d 51 20             	lea    0x20(%ecx),%edx
+  802fee:	39 d0                	cmp    %edx,%eax
+  802ff0:	72 1a                	jb     80300c <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802ff2:	89 da                	mov    %ebx,%edx
+  802ff4:	89 f0                	mov    %esi,%eax
+  802ff6:	e8 5c ff ff ff       	call   802f57 <_pipeisclosed>
+  802ffb:	85 c0                	test   %eax,%eax
+  802ffd:	74 e2                	je     802fe1 <devpipe_write+0x25>
+				return 0;
+  802fff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803004:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803007:	5b                   	pop    %ebx
+  803008:	5e                   	pop    %esi
+  803009:	5f                   	pop    %edi
+  80300a:	5d                   	pop    %ebp
+  80300b:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80300c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80300f:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803013:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803016:	89 c2                	mov    %eax,%edx
+  803018:	c1 fa 1f             	sar    $0x1f,%edx
+  80301b:	89 d1                	mov    %edx,%ecx
+  80301d:	c1 e9 1b             	shr    $0x1b,%ecx
+  803020:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803023:	83 e2 1f             	and    $0x1f,%edx
+  803026:	29 ca                	sub    %ecx,%edx
+  803028:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80302c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803030:	83 c0 01             	add    $0x1,%eax
+  803033:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803036:	83 c7 01             	add    $0x1,%edi
+  803039:	eb 9d                	jmp    802fd8 <devpipe_write+0x1c>
+
+0080303b <devpipe_read>:
+{
+  80303b:	55                   	push   %ebp
+  80303c:	89 e5                	mov    %esp,%ebp
+  80303e:	57                   	push   %edi
+  80303f:	56                   	push   %esi
+  803040:	53                   	push   %ebx
+  803041:	83 ec 18             	sub    $0x18,%esp
+  803044:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803047:	57                   	push   %edi
+  803048:	e8 a5 e3 ff ff       	call   8013f2 <fd2data>
+  80304d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80304f:	83 c4 10             	add    $0x10,%esp
+  803052:	be 00 00 00 00       	mov    $0x0,%esi
+  803057:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80305a:	75 13                	jne    80306f <devpipe_read+0x34>
+	return i;
+  80305c:	89 f0                	mov    %esi,%eax
+  80305e:	eb 02                	jmp    803062 <devpipe_read+0x27>
+				return i;
+  803060:	89 f0                	mov    %esi,%eax
+}
+  803062:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803065:	5b                   	pop    %ebx
+  803066:	5e                   	pop    %esi
+  803067:	5f                   	pop    %edi
+  803068:	5d                   	pop    %ebp
+  803069:	c3                   	ret
+			sys_yield();
+  80306a:	e8 53 df ff ff       	call   800fc2 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80306f:	8b 03                	mov    (%ebx),%eax
+  803071:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803074:	75 18                	jne    80308e <devpipe_read+0x53>
+			if (i > 0)
+  803076:	85 f6                	test   %esi,%esi
+  803078:	75 e6                	jne    803060 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80307a:	89 da                	mov    %ebx,%edx
+  80307c:	89 f8                	mov    %edi,%eax
+  80307e:	e8 d4 fe ff ff       	call   802f57 <_pipeisclosed>
+  803083:	85 c0                	test   %eax,%eax
+  803085:	74 e3                	je     80306a <devpipe_read+0x2f>
+				return 0;
+  803087:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308c:	eb d4                	jmp    803062 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80308e:	99                   	cltd
+  80308f:	c1 ea 1b             	shr    $0x1b,%edx
+  803092:	01 d0                	add    %edx,%eax
+  803094:	83 e0 1f             	and    $0x1f,%eax
+  803097:	29 d0                	sub    %edx,%eax
+  803099:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80309e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030a1:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8030a4:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8030a7:	83 c6 01             	add    $0x1,%esi
+  8030aa:	eb ab                	jmp    803057 <devpipe_read+0x1c>
+
+008030ac <pipe>:
+{
+  8030ac:	55                   	push   %ebp
+  8030ad:	89 e5                	mov    %esp,%ebp
+  8030af:	56                   	push   %esi
+  8030b0:	53                   	push   %ebx
+  8030b1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8030b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030b7:	50                   	push   %eax
+  8030b8:	e8 4c e3 ff ff       	call   801409 <fd_alloc>
+  8030bd:	89 c3                	mov    %eax,%ebx
+  8030bf:	83 c4 10             	add    $0x10,%esp
+  8030c2:	85 c0                	test   %eax,%eax
+  8030c4:	0f 88 23 01 00 00    	js     8031ed <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030ca:	83 ec 04             	sub    $0x4,%esp
+  8030cd:	68 07 04 00 00       	push   $0x407
+  8030d2:	ff 75 f4             	push   -0xc(%ebp)
+  8030d5:	6a 00                	push   $0x0
+  8030d7:	e8 05 df ff ff       	call   800fe1 <sys_page_alloc>
+  8030dc:	89 c3                	mov    %eax,%ebx
+  8030de:	83 c4 10             	add    $0x10,%esp
+  8030e1:	85 c0                	test   %eax,%eax
+  8030e3:	0f 88 04 01 00 00    	js     8031ed <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8030e9:	83 ec 0c             	sub    $0xc,%esp
+  8030ec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030ef:	50                   	push   %eax
+  8030f0:	e8 14 e3 ff ff       	call   801409 <fd_alloc>
+  8030f5:	89 c3                	mov    %eax,%ebx
+  8030f7:	83 c4 10             	add    $0x10,%esp
+  8030fa:	85 c0                	test   %eax,%eax
+  8030fc:	0f 88 db 00 00 00    	js     8031dd <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803102:	83 ec 04             	sub    $0x4,%esp
+  803105:	68 07 04 00 00       	push   $0x407
+  80310a:	ff 75 f0             	push   -0x10(%ebp)
+  80310d:	6a 00                	push   $0x0
+  80310f:	e8 cd de ff ff       	call   800fe1 <sys_page_alloc>
+  803114:	89 c3                	mov    %eax,%ebx
+  803116:	83 c4 10             	add    $0x10,%esp
+  803119:	85 c0                	test   %eax,%eax
+  80311b:	0f 88 bc 00 00 00    	js     8031dd <pipe+0x131>
+	va = fd2data(fd0);
+  803121:	83 ec 0c             	sub    $0xc,%esp
+  803124:	ff 75 f4             	push   -0xc(%ebp)
+  803127:	e8 c6 e2 ff ff       	call   8013f2 <fd2data>
+  80312c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80312e:	83 c4 0c             	add    $0xc,%esp
+  803131:	68 07 04 00 00       	push   $0x407
+  803136:	50                   	push   %eax
+  803137:	6a 00                	push   $0x0
+  803139:	e8 a3 de ff ff       	call   800fe1 <sys_page_alloc>
+  80313e:	89 c3                	mov    %eax,%ebx
+  803140:	83 c4 10             	add    $0x10,%esp
+  803143:	85 c0                	test   %eax,%eax
+  803145:	0f 88 82 00 00 00    	js     8031cd <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80314b:	83 ec 0c             	sub    $0xc,%esp
+  80314e:	ff 75 f0             	push   -0x10(%ebp)
+  803151:	e8 9c e2 ff ff       	call   8013f2 <fd2data>
+  803156:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80315d:	50                   	push   %eax
+  80315e:	6a 00                	push   $0x0
+  803160:	56                   	push   %esi
+  803161:	6a 00                	push   $0x0
+  803163:	e8 c4 de ff ff       	call   80102c <sys_page_map>
+  803168:	89 c3                	mov    %eax,%ebx
+  80316a:	83 c4 20             	add    $0x20,%esp
+  80316d:	85 c0                	test   %eax,%eax
+  80316f:	78 4e                	js     8031bf <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803171:	a1 60 50 80 00       	mov    0x805060,%eax
+  803176:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803179:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80317b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80317e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803185:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803188:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80318a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80318d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803194:	83 ec 0c             	sub    $0xc,%esp
+  803197:	ff 75 f4             	push   -0xc(%ebp)
+  80319a:	e8 43 e2 ff ff       	call   8013e2 <fd2num>
+  80319f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031a2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8031a4:	83 c4 04             	add    $0x4,%esp
+  8031a7:	ff 75 f0             	push   -0x10(%ebp)
+  8031aa:	e8 33 e2 ff ff       	call   8013e2 <fd2num>
+  8031af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031b2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8031b5:	83 c4 10             	add    $0x10,%esp
+  8031b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031bd:	eb 2e                	jmp    8031ed <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031bf:	83 ec 08             	sub    $0x8,%esp
+  8031c2:	56                   	push   %esi
+  8031c3:	6a 00                	push   $0x0
+  8031c5:	e8 a4 de ff ff       	call   80106e <sys_page_unmap>
+  8031ca:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8031cd:	83 ec 08             	sub    $0x8,%esp
+  8031d0:	ff 75 f0             	push   -0x10(%ebp)
+  8031d3:	6a 00                	push   $0x0
+  8031d5:	e8 94 de ff ff       	call   80106e <sys_page_unmap>
+  8031da:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8031dd:	83 ec 08             	sub    $0x8,%esp
+  8031e0:	ff 75 f4             	push   -0xc(%ebp)
+  8031e3:	6a 00                	push   $0x0
+  8031e5:	e8 84 de ff ff       	call   80106e <sys_page_unmap>
+  8031ea:	83 c4 10             	add    $0x10,%esp
+}
+  8031ed:	89 d8                	mov    %ebx,%eax
+  8031ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031f2:	5b                   	pop    %ebx
+  8031f3:	5e                   	pop    %esi
+  8031f4:	5d                   	pop    %ebp
+  8031f5:	c3                   	ret
+
+008031f6 <pipeisclosed>:
+{
+  8031f6:	55                   	push   %ebp
+  8031f7:	89 e5                	mov    %esp,%ebp
+  8031f9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031ff:	50                   	push   %eax
+  803200:	ff 75 08             	push   0x8(%ebp)
+  803203:	e8 57 e2 ff ff       	call   80145f <fd_lookup>
+  803208:	83 c4 10             	add    $0x10,%esp
+  80320b:	85 c0                	test   %eax,%eax
+  80320d:	78 18                	js     803227 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80320f:	83 ec 0c             	sub    $0xc,%esp
+  803212:	ff 75 f4             	push   -0xc(%ebp)
+  803215:	e8 d8 e1 ff ff       	call   8013f2 <fd2data>
+  80321a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80321c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80321f:	e8 33 fd ff ff       	call   802f57 <_pipeisclosed>
+  803224:	83 c4 10             	add    $0x10,%esp
+}
+  803227:	c9                   	leave
+  803228:	c3                   	ret
+
+00803229 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803229:	b8 00 00 00 00       	mov    $0x0,%eax
+  80322e:	c3                   	ret
+
+0080322f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80322f:	55                   	push   %ebp
+  803230:	89 e5                	mov    %esp,%ebp
+  803232:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803235:	68 ee 41 80 00       	push   $0x8041ee
+  80323a:	ff 75 0c             	push   0xc(%ebp)
+  80323d:	e8 93 d9 ff ff       	call   800bd5 <strcpy>
+	return 0;
+}
+  803242:	b8 00 00 00 00       	mov    $0x0,%eax
+  803247:	c9                   	leave
+  803248:	c3                   	ret
+
+00803249 <devcons_write>:
+{
+  803249:	55                   	push   %ebp
+  80324a:	89 e5                	mov    %esp,%ebp
+  80324c:	57                   	push   %edi
+  80324d:	56                   	push   %esi
+  80324e:	53                   	push   %ebx
+  80324f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803255:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80325a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803260:	eb 2e                	jmp    803290 <devcons_write+0x47>
+		m = n - tot;
+  803262:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803265:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803267:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80326c:	39 c3                	cmp    %eax,%ebx
+  80326e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803271:	83 ec 04             	sub    $0x4,%esp
+  803274:	53                   	push   %ebx
+  803275:	89 f0                	mov    %esi,%eax
+  803277:	03 45 0c             	add    0xc(%ebp),%eax
+  80327a:	50                   	push   %eax
+  80327b:	57                   	push   %edi
+  80327c:	e8 da da ff ff       	call   800d5b <memmove>
+		sys_cputs(buf, m);
+  803281:	83 c4 08             	add    $0x8,%esp
+  803284:	53                   	push   %ebx
+  803285:	57                   	push   %edi
+  803286:	e8 7a dc ff ff       	call   800f05 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80328b:	01 de                	add    %ebx,%esi
+  80328d:	83 c4 10             	add    $0x10,%esp
+  803290:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803293:	72 cd                	jb     803262 <devcons_write+0x19>
+}
+  803295:	89 f0                	mov    %esi,%eax
+  803297:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80329a:	5b                   	pop    %ebx
+  80329b:	5e                   	pop    %esi
+  80329c:	5f                   	pop    %edi
+  80329d:	5d                   	pop    %ebp
+  80329e:	c3                   	ret
+
+0080329f <devcons_read>:
+{
+  80329f:	55                   	push   %ebp
+  8032a0:	89 e5                	mov    %esp,%ebp
+  8032a2:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8032a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032aa:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8032ae:	75 07                	jne    8032b7 <devcons_read+0x18>
+  8032b0:	eb 1f                	jmp    8032d1 <devcons_read+0x32>
+		sys_yield();
+  8032b2:	e8 0b dd ff ff       	call   800fc2 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8032b7:	e8 6f dc ff ff       	call   800f2b <sys_cgetc>
+  8032bc:	85 c0                	test   %eax,%eax
+  8032be:	74 f2                	je     8032b2 <devcons_read+0x13>
+	if (c < 0)
+  8032c0:	78 0f                	js     8032d1 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8032c2:	83 f8 04             	cmp    $0x4,%eax
+  8032c5:	74 0c                	je     8032d3 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8032c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032ca:	88 02                	mov    %al,(%edx)
+	return 1;
+  8032cc:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8032d1:	c9                   	leave
+  8032d2:	c3                   	ret
+		return 0;
+  8032d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d8:	eb f7                	jmp    8032d1 <devcons_read+0x32>
+
+008032da <cputchar>:
+{
+  8032da:	55                   	push   %ebp
+  8032db:	89 e5                	mov    %esp,%ebp
+  8032dd:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8032e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032e3:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8032e6:	6a 01                	push   $0x1
+  8032e8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032eb:	50                   	push   %eax
+  8032ec:	e8 14 dc ff ff       	call   800f05 <sys_cputs>
+}
+  8032f1:	83 c4 10             	add    $0x10,%esp
+  8032f4:	c9                   	leave
+  8032f5:	c3                   	ret
+
+008032f6 <getchar>:
+{
+  8032f6:	55                   	push   %ebp
+  8032f7:	89 e5                	mov    %esp,%ebp
+  8032f9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8032fc:	6a 01                	push   $0x1
+  8032fe:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803301:	50                   	push   %eax
+  803302:	6a 00                	push   $0x0
+  803304:	e8 bc e3 ff ff       	call   8016c5 <read>
+	if (r < 0)
+  803309:	83 c4 10             	add    $0x10,%esp
+  80330c:	85 c0                	test   %eax,%eax
+  80330e:	78 06                	js     803316 <getchar+0x20>
+	if (r < 1)
+  803310:	74 06                	je     803318 <getchar+0x22>
+	return c;
+  803312:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803316:	c9                   	leave
+  803317:	c3                   	ret
+		return -E_EOF;
+  803318:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80331d:	eb f7                	jmp    803316 <getchar+0x20>
+
+0080331f <iscons>:
+{
+  80331f:	55                   	push   %ebp
+  803320:	89 e5                	mov    %esp,%ebp
+  803322:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803325:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803328:	50                   	push   %eax
+  803329:	ff 75 08             	push   0x8(%ebp)
+  80332c:	e8 2e e1 ff ff       	call   80145f <fd_lookup>
+  803331:	83 c4 10             	add    $0x10,%esp
+  803334:	85 c0                	test   %eax,%eax
+  803336:	78 11                	js     803349 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803338:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80333b:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803341:	39 10                	cmp    %edx,(%eax)
+  803343:	0f 94 c0             	sete   %al
+  803346:	0f b6 c0             	movzbl %al,%eax
+}
+  803349:	c9                   	leave
+  80334a:	c3                   	ret
+
+0080334b <opencons>:
+{
+  80334b:	55                   	push   %ebp
+  80334c:	89 e5                	mov    %esp,%ebp
+  80334e:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803351:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803354:	50                   	push   %eax
+  803355:	e8 af e0 ff ff       	call   801409 <fd_alloc>
+  80335a:	83 c4 10             	add    $0x10,%esp
+  80335d:	85 c0                	test   %eax,%eax
+  80335f:	78 3a                	js     80339b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803361:	83 ec 04             	sub    $0x4,%esp
+  803364:	68 07 04 00 00       	push   $0x407
+  803369:	ff 75 f4             	push   -0xc(%ebp)
+  80336c:	6a 00                	push   $0x0
+  80336e:	e8 6e dc ff ff       	call   800fe1 <sys_page_alloc>
+  803373:	83 c4 10             	add    $0x10,%esp
+  803376:	85 c0                	test   %eax,%eax
+  803378:	78 21                	js     80339b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80337a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80337d:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803383:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803385:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803388:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80338f:	83 ec 0c             	sub    $0xc,%esp
+  803392:	50                   	push   %eax
+  803393:	e8 4a e0 ff ff       	call   8013e2 <fd2num>
+  803398:	83 c4 10             	add    $0x10,%esp
+}
+  80339b:	c9                   	leave
+  80339c:	c3                   	ret
+
+0080339d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80339d:	55                   	push   %ebp
+  80339e:	89 e5                	mov    %esp,%ebp
+  8033a0:	56                   	push   %esi
+  8033a1:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8033a2:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8033a5:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8033ab:	e8 eb db ff ff       	call   800f9b <sys_getenvid>
+  8033b0:	83 ec 0c             	sub    $0xc,%esp
+  8033b3:	ff 75 0c             	push   0xc(%ebp)
+  8033b6:	ff 75 08             	push   0x8(%ebp)
+  8033b9:	56                   	push   %esi
+  8033ba:	50                   	push   %eax
+  8033bb:	68 fc 41 80 00       	push   $0x8041fc
+  8033c0:	e8 22 d2 ff ff       	call   8005e7 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8033c5:	83 c4 18             	add    $0x18,%esp
+  8033c8:	53                   	push   %ebx
+  8033c9:	ff 75 10             	push   0x10(%ebp)
+  8033cc:	e8 c5 d1 ff ff       	call   800596 <vcprintf>
+	cprintf("\n");
+  8033d1:	c7 04 24 e7 41 80 00 	movl   $0x8041e7,(%esp)
+  8033d8:	e8 0a d2 ff ff       	call   8005e7 <cprintf>
+  8033dd:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8033e0:	cc                   	int3
+	while (1)
+  8033e1:	eb fd                	jmp    8033e0 <_panic+0x43>
+
+008033e3 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  8033e3:	55                   	push   %ebp
+  8033e4:	89 e5                	mov    %esp,%ebp
+  8033e6:	57                   	push   %edi
+  8033e7:	56                   	push   %esi
+  8033e8:	53                   	push   %ebx
+  8033e9:	83 ec 20             	sub    $0x20,%esp
+  8033ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033ef:	89 d7                	mov    %edx,%edi
+  8033f1:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  8033f3:	51                   	push   %ecx
+  8033f4:	68 00 f0 7f 00       	push   $0x7ff000
+  8033f9:	6a 00                	push   $0x0
+  8033fb:	e8 e1 db ff ff       	call   800fe1 <sys_page_alloc>
+  803400:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803402:	83 c4 10             	add    $0x10,%esp
+  803405:	85 c0                	test   %eax,%eax
+  803407:	78 45                	js     80344e <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  803409:	83 ec 04             	sub    $0x4,%esp
+  80340c:	68 00 10 00 00       	push   $0x1000
+  803411:	57                   	push   %edi
+  803412:	68 00 f0 7f 00       	push   $0x7ff000
+  803417:	e8 3f d9 ff ff       	call   800d5b <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  80341c:	89 34 24             	mov    %esi,(%esp)
+  80341f:	57                   	push   %edi
+  803420:	ff 75 e4             	push   -0x1c(%ebp)
+  803423:	68 00 f0 7f 00       	push   $0x7ff000
+  803428:	6a 00                	push   $0x0
+  80342a:	e8 fd db ff ff       	call   80102c <sys_page_map>
+  80342f:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803431:	83 c4 20             	add    $0x20,%esp
+  803434:	85 c0                	test   %eax,%eax
+  803436:	78 16                	js     80344e <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803438:	83 ec 08             	sub    $0x8,%esp
+  80343b:	68 00 f0 7f 00       	push   $0x7ff000
+  803440:	6a 00                	push   $0x0
+  803442:	e8 27 dc ff ff       	call   80106e <sys_page_unmap>
+  803447:	83 c4 10             	add    $0x10,%esp
+  80344a:	85 c0                	test   %eax,%eax
+  80344c:	75 0a                	jne    803458 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  80344e:	89 d8                	mov    %ebx,%eax
+  803450:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803453:	5b                   	pop    %ebx
+  803454:	5e                   	pop    %esi
+  803455:	5f                   	pop    %edi
+  803456:	5d                   	pop    %ebp
+  803457:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803458:	68 20 42 80 00       	push   $0x804220
+  80345d:	68 40 41 80 00       	push   $0x804140
+  803462:	6a 1b                	push   $0x1b
+  803464:	68 98 42 80 00       	push   $0x804298
+  803469:	e8 2f ff ff ff       	call   80339d <_panic>
+
+0080346e <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80346e:	55                   	push   %ebp
+  80346f:	89 e5                	mov    %esp,%ebp
+  803471:	53                   	push   %ebx
+  803472:	83 ec 04             	sub    $0x4,%esp
+  803475:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803478:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80347a:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  80347e:	74 21                	je     8034a1 <pgfault+0x33>
+  803480:	89 d0                	mov    %edx,%eax
+  803482:	c1 e8 16             	shr    $0x16,%eax
+  803485:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80348c:	a8 01                	test   $0x1,%al
+  80348e:	74 11                	je     8034a1 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803490:	89 d0                	mov    %edx,%eax
+  803492:	c1 e8 0c             	shr    $0xc,%eax
+  803495:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80349c:	f6 c4 08             	test   $0x8,%ah
+  80349f:	75 17                	jne    8034b8 <pgfault+0x4a>
+		if (pgfault_next) {
+  8034a1:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  8034a6:	85 c0                	test   %eax,%eax
+  8034a8:	74 27                	je     8034d1 <pgfault+0x63>
+			pgfault_next(utf);
+  8034aa:	83 ec 0c             	sub    $0xc,%esp
+  8034ad:	53                   	push   %ebx
+  8034ae:	ff d0                	call   *%eax
+			return;
+  8034b0:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8034b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034b6:	c9                   	leave
+  8034b7:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8034b8:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8034be:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8034c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034c8:	e8 16 ff ff ff       	call   8033e3 <copy_page_to>
+  8034cd:	85 c0                	test   %eax,%eax
+  8034cf:	79 e2                	jns    8034b3 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8034d1:	a1 10 60 80 00       	mov    0x806010,%eax
+  8034d6:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8034d9:	ff 73 28             	push   0x28(%ebx)
+  8034dc:	ff 33                	push   (%ebx)
+  8034de:	50                   	push   %eax
+  8034df:	68 44 42 80 00       	push   $0x804244
+  8034e4:	e8 fe d0 ff ff       	call   8005e7 <cprintf>
+	sys_env_destroy(0);
+  8034e9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8034f0:	e8 5d da ff ff       	call   800f52 <sys_env_destroy>
+  8034f5:	83 c4 10             	add    $0x10,%esp
+  8034f8:	eb b9                	jmp    8034b3 <pgfault+0x45>
+
+008034fa <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8034fa:	55                   	push   %ebp
+  8034fb:	89 e5                	mov    %esp,%ebp
+  8034fd:	53                   	push   %ebx
+  8034fe:	83 ec 04             	sub    $0x4,%esp
+  803501:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803504:	a1 08 a0 80 00       	mov    0x80a008,%eax
+  803509:	3d 6e 34 80 00       	cmp    $0x80346e,%eax
+  80350e:	74 15                	je     803525 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803510:	a3 04 a0 80 00       	mov    %eax,0x80a004
+		set_pgfault_handler(pgfault);
+  803515:	83 ec 0c             	sub    $0xc,%esp
+  803518:	68 6e 34 80 00       	push   $0x80346e
+  80351d:	e8 fb 03 00 00       	call   80391d <set_pgfault_handler>
+  803522:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803525:	83 ec 0c             	sub    $0xc,%esp
+  803528:	68 05 08 00 00       	push   $0x805
+  80352d:	53                   	push   %ebx
+  80352e:	6a 00                	push   $0x0
+  803530:	53                   	push   %ebx
+  803531:	6a 00                	push   $0x0
+  803533:	e8 f4 da ff ff       	call   80102c <sys_page_map>
+}
+  803538:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80353b:	c9                   	leave
+  80353c:	c3                   	ret
+
+0080353d <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80353d:	55                   	push   %ebp
+  80353e:	89 e5                	mov    %esp,%ebp
+  803540:	57                   	push   %edi
+  803541:	56                   	push   %esi
+  803542:	53                   	push   %ebx
+  803543:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  803546:	68 6e 34 80 00       	push   $0x80346e
+  80354b:	e8 cd 03 00 00       	call   80391d <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803550:	b8 07 00 00 00       	mov    $0x7,%eax
+  803555:	cd 30                	int    $0x30
+  803557:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80355a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  80355d:	83 c4 10             	add    $0x10,%esp
+  803560:	85 c0                	test   %eax,%eax
+  803562:	0f 88 6b 01 00 00    	js     8036d3 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803568:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  80356d:	75 37                	jne    8035a6 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80356f:	e8 27 da ff ff       	call   800f9b <sys_getenvid>
+  803574:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803579:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80357f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803584:	a3 10 60 80 00       	mov    %eax,0x806010
+		return 0;
+  803589:	e9 45 01 00 00       	jmp    8036d3 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  80358e:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803594:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80359a:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8035a0:	0f 87 ba 00 00 00    	ja     803660 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8035a6:	89 d8                	mov    %ebx,%eax
+  8035a8:	c1 e8 16             	shr    $0x16,%eax
+  8035ab:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8035b2:	a8 01                	test   $0x1,%al
+  8035b4:	74 d8                	je     80358e <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8035b6:	89 d8                	mov    %ebx,%eax
+  8035b8:	c1 e8 0c             	shr    $0xc,%eax
+  8035bb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8035c2:	f6 c2 01             	test   $0x1,%dl
+  8035c5:	74 cd                	je     803594 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8035c7:	89 da                	mov    %ebx,%edx
+  8035c9:	80 e6 df             	and    $0xdf,%dh
+  8035cc:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8035d2:	74 c0                	je     803594 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8035d4:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8035d6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8035dd:	f6 c6 04             	test   $0x4,%dh
+  8035e0:	75 53                	jne    803635 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8035e2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8035e9:	f6 c6 08             	test   $0x8,%dh
+  8035ec:	75 0c                	jne    8035fa <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8035ee:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8035f5:	f6 c2 02             	test   $0x2,%dl
+  8035f8:	74 3b                	je     803635 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8035fa:	83 ec 0c             	sub    $0xc,%esp
+  8035fd:	68 05 08 00 00       	push   $0x805
+  803602:	57                   	push   %edi
+  803603:	ff 75 e4             	push   -0x1c(%ebp)
+  803606:	57                   	push   %edi
+  803607:	6a 00                	push   $0x0
+  803609:	e8 1e da ff ff       	call   80102c <sys_page_map>
+  80360e:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803610:	83 c4 20             	add    $0x20,%esp
+  803613:	85 c0                	test   %eax,%eax
+  803615:	0f 88 a7 00 00 00    	js     8036c2 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80361b:	83 ec 0c             	sub    $0xc,%esp
+  80361e:	68 05 08 00 00       	push   $0x805
+  803623:	57                   	push   %edi
+  803624:	6a 00                	push   $0x0
+  803626:	57                   	push   %edi
+  803627:	6a 00                	push   $0x0
+  803629:	e8 fe d9 ff ff       	call   80102c <sys_page_map>
+  80362e:	89 c6                	mov    %eax,%esi
+	return r;
+  803630:	83 c4 20             	add    $0x20,%esp
+  803633:	eb 21                	jmp    803656 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803635:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80363c:	83 ec 0c             	sub    $0xc,%esp
+  80363f:	25 07 0e 00 00       	and    $0xe07,%eax
+  803644:	50                   	push   %eax
+  803645:	57                   	push   %edi
+  803646:	ff 75 e4             	push   -0x1c(%ebp)
+  803649:	57                   	push   %edi
+  80364a:	6a 00                	push   $0x0
+  80364c:	e8 db d9 ff ff       	call   80102c <sys_page_map>
+  803651:	89 c6                	mov    %eax,%esi
+  803653:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  803656:	85 f6                	test   %esi,%esi
+  803658:	0f 89 36 ff ff ff    	jns    803594 <fork+0x57>
+  80365e:	eb 62                	jmp    8036c2 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803660:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803665:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  80366a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80366d:	89 f8                	mov    %edi,%eax
+  80366f:	e8 6f fd ff ff       	call   8033e3 <copy_page_to>
+  803674:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803676:	85 c0                	test   %eax,%eax
+  803678:	78 48                	js     8036c2 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80367a:	83 ec 04             	sub    $0x4,%esp
+  80367d:	6a 07                	push   $0x7
+  80367f:	68 00 f0 bf ee       	push   $0xeebff000
+  803684:	57                   	push   %edi
+  803685:	e8 57 d9 ff ff       	call   800fe1 <sys_page_alloc>
+  80368a:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80368c:	83 c4 10             	add    $0x10,%esp
+  80368f:	85 c0                	test   %eax,%eax
+  803691:	78 2f                	js     8036c2 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803693:	a1 10 60 80 00       	mov    0x806010,%eax
+  803698:	8b 40 64             	mov    0x64(%eax),%eax
+  80369b:	83 ec 08             	sub    $0x8,%esp
+  80369e:	50                   	push   %eax
+  80369f:	57                   	push   %edi
+  8036a0:	e8 a7 da ff ff       	call   80114c <sys_env_set_pgfault_upcall>
+  8036a5:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8036a7:	83 c4 10             	add    $0x10,%esp
+  8036aa:	85 c0                	test   %eax,%eax
+  8036ac:	78 14                	js     8036c2 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8036ae:	83 ec 08             	sub    $0x8,%esp
+  8036b1:	6a 02                	push   $0x2
+  8036b3:	57                   	push   %edi
+  8036b4:	e8 ff d9 ff ff       	call   8010b8 <sys_env_set_status>
+  8036b9:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8036bb:	83 c4 10             	add    $0x10,%esp
+  8036be:	85 c0                	test   %eax,%eax
+  8036c0:	79 11                	jns    8036d3 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8036c2:	83 ec 0c             	sub    $0xc,%esp
+  8036c5:	ff 75 e0             	push   -0x20(%ebp)
+  8036c8:	e8 85 d8 ff ff       	call   800f52 <sys_env_destroy>
+	return r;
+  8036cd:	83 c4 10             	add    $0x10,%esp
+  8036d0:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8036d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036d9:	5b                   	pop    %ebx
+  8036da:	5e                   	pop    %esi
+  8036db:	5f                   	pop    %edi
+  8036dc:	5d                   	pop    %ebp
+  8036dd:	c3                   	ret
+
+008036de <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8036de:	55                   	push   %ebp
+  8036df:	89 e5                	mov    %esp,%ebp
+  8036e1:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8036e4:	68 a3 42 80 00       	push   $0x8042a3
+  8036e9:	68 bf 00 00 00       	push   $0xbf
+  8036ee:	68 98 42 80 00       	push   $0x804298
+  8036f3:	e8 a5 fc ff ff       	call   80339d <_panic>
+
+008036f8 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8036f8:	55                   	push   %ebp
+  8036f9:	89 e5                	mov    %esp,%ebp
+  8036fb:	56                   	push   %esi
+  8036fc:	53                   	push   %ebx
+  8036fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  803700:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803703:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803706:	85 c0                	test   %eax,%eax
+  803708:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80370d:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803710:	83 ec 0c             	sub    $0xc,%esp
+  803713:	50                   	push   %eax
+  803714:	e8 10 db ff ff       	call   801229 <sys_ipc_recv>
+	if (from_env_store)
+  803719:	83 c4 10             	add    $0x10,%esp
+  80371c:	85 f6                	test   %esi,%esi
+  80371e:	74 14                	je     803734 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803720:	ba 00 00 00 00       	mov    $0x0,%edx
+  803725:	85 c0                	test   %eax,%eax
+  803727:	75 09                	jne    803732 <ipc_recv+0x3a>
+  803729:	8b 15 10 60 80 00    	mov    0x806010,%edx
+  80372f:	8b 52 74             	mov    0x74(%edx),%edx
+  803732:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803734:	85 db                	test   %ebx,%ebx
+  803736:	74 25                	je     80375d <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803738:	85 c0                	test   %eax,%eax
+  80373a:	74 0d                	je     803749 <ipc_recv+0x51>
+  80373c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803742:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803745:	5b                   	pop    %ebx
+  803746:	5e                   	pop    %esi
+  803747:	5d                   	pop    %ebp
+  803748:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803749:	a1 10 60 80 00       	mov    0x806010,%eax
+  80374e:	8b 40 78             	mov    0x78(%eax),%eax
+  803751:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803753:	a1 10 60 80 00       	mov    0x806010,%eax
+  803758:	8b 40 70             	mov    0x70(%eax),%eax
+  80375b:	eb e5                	jmp    803742 <ipc_recv+0x4a>
+  80375d:	85 c0                	test   %eax,%eax
+  80375f:	75 e1                	jne    803742 <ipc_recv+0x4a>
+  803761:	eb f0                	jmp    803753 <ipc_recv+0x5b>
+
+00803763 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803763:	55                   	push   %ebp
+  803764:	89 e5                	mov    %esp,%ebp
+  803766:	57                   	push   %edi
+  803767:	56                   	push   %esi
+  803768:	53                   	push   %ebx
+  803769:	83 ec 0c             	sub    $0xc,%esp
+  80376c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80376f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803772:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803775:	85 db                	test   %ebx,%ebx
+  803777:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80377c:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80377f:	ff 75 14             	push   0x14(%ebp)
+  803782:	53                   	push   %ebx
+  803783:	56                   	push   %esi
+  803784:	57                   	push   %edi
+  803785:	e8 0c da ff ff       	call   801196 <sys_ipc_try_send>
+  80378a:	83 c4 10             	add    $0x10,%esp
+  80378d:	85 c0                	test   %eax,%eax
+  80378f:	74 22                	je     8037b3 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803791:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803794:	75 07                	jne    80379d <ipc_send+0x3a>
+		sys_yield();
+  803796:	e8 27 d8 ff ff       	call   800fc2 <sys_yield>
+  80379b:	eb e2                	jmp    80377f <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80379d:	68 b9 42 80 00       	push   $0x8042b9
+  8037a2:	68 40 41 80 00       	push   $0x804140
+  8037a7:	6a 39                	push   $0x39
+  8037a9:	68 ce 42 80 00       	push   $0x8042ce
+  8037ae:	e8 ea fb ff ff       	call   80339d <_panic>
+	}
+}
+  8037b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037b6:	5b                   	pop    %ebx
+  8037b7:	5e                   	pop    %esi
+  8037b8:	5f                   	pop    %edi
+  8037b9:	5d                   	pop    %ebp
+  8037ba:	c3                   	ret
+
+008037bb <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  8037bb:	55                   	push   %ebp
+  8037bc:	89 e5                	mov    %esp,%ebp
+  8037be:	57                   	push   %edi
+  8037bf:	56                   	push   %esi
+  8037c0:	53                   	push   %ebx
+  8037c1:	83 ec 10             	sub    $0x10,%esp
+  8037c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8037cd:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8037d0:	85 c0                	test   %eax,%eax
+  8037d2:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8037d7:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8037da:	6a 00                	push   $0x0
+  8037dc:	ff 33                	push   (%ebx)
+  8037de:	50                   	push   %eax
+  8037df:	e8 02 da ff ff       	call   8011e6 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8037e4:	83 c4 10             	add    $0x10,%esp
+  8037e7:	85 c0                	test   %eax,%eax
+  8037e9:	75 3c                	jne    803827 <ipc_recvv+0x6c>
+  8037eb:	8b 15 10 60 80 00    	mov    0x806010,%edx
+  8037f1:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8037f4:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8037f6:	85 ff                	test   %edi,%edi
+  8037f8:	74 4e                	je     803848 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8037fa:	8b 15 10 60 80 00    	mov    0x806010,%edx
+  803800:	8b 52 74             	mov    0x74(%edx),%edx
+  803803:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803805:	85 f6                	test   %esi,%esi
+  803807:	74 18                	je     803821 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803809:	85 c0                	test   %eax,%eax
+  80380b:	75 2d                	jne    80383a <ipc_recvv+0x7f>
+  80380d:	a1 10 60 80 00       	mov    0x806010,%eax
+  803812:	8b 40 78             	mov    0x78(%eax),%eax
+  803815:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803817:	a1 10 60 80 00       	mov    0x806010,%eax
+  80381c:	8b 40 70             	mov    0x70(%eax),%eax
+  80381f:	eb 1f                	jmp    803840 <ipc_recvv+0x85>
+  803821:	85 c0                	test   %eax,%eax
+  803823:	75 1b                	jne    803840 <ipc_recvv+0x85>
+  803825:	eb f0                	jmp    803817 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803827:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80382d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803832:	85 ff                	test   %edi,%edi
+  803834:	75 cd                	jne    803803 <ipc_recvv+0x48>
+	if (perm_store)
+  803836:	85 f6                	test   %esi,%esi
+  803838:	74 e7                	je     803821 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80383a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803843:	5b                   	pop    %ebx
+  803844:	5e                   	pop    %esi
+  803845:	5f                   	pop    %edi
+  803846:	5d                   	pop    %ebp
+  803847:	c3                   	ret
+	if (perm_store)
+  803848:	85 f6                	test   %esi,%esi
+  80384a:	75 bd                	jne    803809 <ipc_recvv+0x4e>
+  80384c:	eb c9                	jmp    803817 <ipc_recvv+0x5c>
+
+0080384e <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  80384e:	55                   	push   %ebp
+  80384f:	89 e5                	mov    %esp,%ebp
+  803851:	57                   	push   %edi
+  803852:	56                   	push   %esi
+  803853:	53                   	push   %ebx
+  803854:	83 ec 0c             	sub    $0xc,%esp
+  803857:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80385a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80385d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  803860:	ff 75 14             	push   0x14(%ebp)
+  803863:	53                   	push   %ebx
+  803864:	56                   	push   %esi
+  803865:	57                   	push   %edi
+  803866:	e8 53 d9 ff ff       	call   8011be <sys_ipc_try_sendv>
+  80386b:	83 c4 10             	add    $0x10,%esp
+  80386e:	85 c0                	test   %eax,%eax
+  803870:	74 22                	je     803894 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803872:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803875:	75 07                	jne    80387e <ipc_sendv+0x30>
+		sys_yield();
+  803877:	e8 46 d7 ff ff       	call   800fc2 <sys_yield>
+  80387c:	eb e2                	jmp    803860 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80387e:	68 b9 42 80 00       	push   $0x8042b9
+  803883:	68 40 41 80 00       	push   $0x804140
+  803888:	6a 5c                	push   $0x5c
+  80388a:	68 ce 42 80 00       	push   $0x8042ce
+  80388f:	e8 09 fb ff ff       	call   80339d <_panic>
+	}
+}
+  803894:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803897:	5b                   	pop    %ebx
+  803898:	5e                   	pop    %esi
+  803899:	5f                   	pop    %edi
+  80389a:	5d                   	pop    %ebp
+  80389b:	c3                   	ret
+
+0080389c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80389c:	55                   	push   %ebp
+  80389d:	89 e5                	mov    %esp,%ebp
+  80389f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8038a2:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8038a7:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8038ad:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8038b3:	8b 52 50             	mov    0x50(%edx),%edx
+  8038b6:	39 ca                	cmp    %ecx,%edx
+  8038b8:	74 11                	je     8038cb <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8038ba:	83 c0 01             	add    $0x1,%eax
+  8038bd:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8038c2:	75 e3                	jne    8038a7 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8038c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c9:	eb 0e                	jmp    8038d9 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8038cb:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8038d1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038d6:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8038d9:	5d                   	pop    %ebp
+  8038da:	c3                   	ret
+
+008038db <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8038db:	55                   	push   %ebp
+  8038dc:	89 e5                	mov    %esp,%ebp
+  8038de:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8038e1:	89 c2                	mov    %eax,%edx
+  8038e3:	c1 ea 16             	shr    $0x16,%edx
+  8038e6:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8038ed:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8038f2:	f6 c1 01             	test   $0x1,%cl
+  8038f5:	74 22                	je     803919 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8038f7:	c1 e8 0c             	shr    $0xc,%eax
+  8038fa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803901:	a8 01                	test   $0x1,%al
+  803903:	74 14                	je     803919 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803905:	c1 e8 0c             	shr    $0xc,%eax
+  803908:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80390b:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803912:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803916:	0f b7 d2             	movzwl %dx,%edx
+}
+  803919:	89 d0                	mov    %edx,%eax
+  80391b:	5d                   	pop    %ebp
+  80391c:	c3                   	ret
+
+0080391d <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80391d:	55                   	push   %ebp
+  80391e:	89 e5                	mov    %esp,%ebp
+  803920:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803923:	83 3d 08 a0 80 00 00 	cmpl   $0x0,0x80a008
+  80392a:	74 0a                	je     803936 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80392c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80392f:	a3 08 a0 80 00       	mov    %eax,0x80a008
+}
+  803934:	c9                   	leave
+  803935:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803936:	83 ec 04             	sub    $0x4,%esp
+  803939:	6a 07                	push   $0x7
+  80393b:	68 00 f0 bf ee       	push   $0xeebff000
+  803940:	6a 00                	push   $0x0
+  803942:	e8 9a d6 ff ff       	call   800fe1 <sys_page_alloc>
+  803947:	83 c4 10             	add    $0x10,%esp
+  80394a:	85 c0                	test   %eax,%eax
+  80394c:	75 2c                	jne    80397a <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80394e:	83 ec 08             	sub    $0x8,%esp
+  803951:	68 90 39 80 00       	push   $0x803990
+  803956:	6a 00                	push   $0x0
+  803958:	e8 ef d7 ff ff       	call   80114c <sys_env_set_pgfault_upcall>
+  80395d:	83 c4 10             	add    $0x10,%esp
+  803960:	85 c0                	test   %eax,%eax
+  803962:	74 c8                	je     80392c <set_pgfault_handler+0xf>
+  803964:	68 20 43 80 00       	push   $0x804320
+  803969:	68 40 41 80 00       	push   $0x804140
+  80396e:	6a 20                	push   $0x20
+  803970:	68 50 43 80 00       	push   $0x804350
+  803975:	e8 23 fa ff ff       	call   80339d <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80397a:	68 d8 42 80 00       	push   $0x8042d8
+  80397f:	68 40 41 80 00       	push   $0x804140
+  803984:	6a 1e                	push   $0x1e
+  803986:	68 50 43 80 00       	push   $0x804350
+  80398b:	e8 0d fa ff ff       	call   80339d <_panic>
+
+00803990 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803990:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803991:	a1 08 a0 80 00       	mov    0x80a008,%eax
+	call *%eax
+  803996:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803998:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80399b:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8039a0:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8039a5:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8039a9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8039ac:	83 c4 08             	add    $0x8,%esp
+	popal
+  8039af:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8039b0:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8039b3:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8039b4:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8039b5:	c3                   	ret
+
+008039b6 <dm>:
+  8039b6:	55                   	push   %ebp
+  8039b7:	57                   	push   %edi
+  8039b8:	56                   	push   %esi
+  8039b9:	53                   	push   %ebx
+  8039ba:	83 ec 24             	sub    $0x24,%esp
+  8039bd:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8039c1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8039c5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8039c9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8039cd:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8039d1:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8039d5:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8039d9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8039de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039e8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8039ef:	00 
+  8039f0:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8039f7:	00 
+  8039f8:	89 fb                	mov    %edi,%ebx
+  8039fa:	eb 08                	jmp    803a04 <dm+0x4e>
+  8039fc:	83 e9 01             	sub    $0x1,%ecx
+  8039ff:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803a02:	74 68                	je     803a6c <dm+0xb6>
+  803a04:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803a08:	01 c0                	add    %eax,%eax
+  803a0a:	89 c6                	mov    %eax,%esi
+  803a0c:	89 d7                	mov    %edx,%edi
+  803a0e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a12:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a16:	0f ad d0             	shrd   %cl,%edx,%eax
+  803a19:	d3 ea                	shr    %cl,%edx
+  803a1b:	f6 c1 20             	test   $0x20,%cl
+  803a1e:	74 04                	je     803a24 <dm+0x6e>
+  803a20:	89 d0                	mov    %edx,%eax
+  803a22:	31 d2                	xor    %edx,%edx
+  803a24:	83 e0 01             	and    $0x1,%eax
+  803a27:	89 04 24             	mov    %eax,(%esp)
+  803a2a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803a31:	00 
+  803a32:	8b 04 24             	mov    (%esp),%eax
+  803a35:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803a39:	09 f0                	or     %esi,%eax
+  803a3b:	09 fa                	or     %edi,%edx
+  803a3d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803a41:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803a45:	39 f0                	cmp    %esi,%eax
+  803a47:	89 d5                	mov    %edx,%ebp
+  803a49:	19 fd                	sbb    %edi,%ebp
+  803a4b:	72 af                	jb     8039fc <dm+0x46>
+  803a4d:	29 f0                	sub    %esi,%eax
+  803a4f:	19 fa                	sbb    %edi,%edx
+  803a51:	89 cf                	mov    %ecx,%edi
+  803a53:	c1 ef 05             	shr    $0x5,%edi
+  803a56:	83 e7 01             	and    $0x1,%edi
+  803a59:	89 fe                	mov    %edi,%esi
+  803a5b:	83 f6 01             	xor    $0x1,%esi
+  803a5e:	d3 e6                	shl    %cl,%esi
+  803a60:	d3 e7                	shl    %cl,%edi
+  803a62:	09 74 24 18          	or     %esi,0x18(%esp)
+  803a66:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803a6a:	eb 90                	jmp    8039fc <dm+0x46>
+  803a6c:	85 db                	test   %ebx,%ebx
+  803a6e:	74 05                	je     803a75 <dm+0xbf>
+  803a70:	89 03                	mov    %eax,(%ebx)
+  803a72:	89 53 04             	mov    %edx,0x4(%ebx)
+  803a75:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a79:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a7d:	83 c4 24             	add    $0x24,%esp
+  803a80:	5b                   	pop    %ebx
+  803a81:	5e                   	pop    %esi
+  803a82:	5f                   	pop    %edi
+  803a83:	5d                   	pop    %ebp
+  803a84:	c3                   	ret
+
+00803a85 <__udivdi3>:
+  803a85:	83 ec 08             	sub    $0x8,%esp
+  803a88:	6a 00                	push   $0x0
+  803a8a:	ff 74 24 1c          	push   0x1c(%esp)
+  803a8e:	ff 74 24 1c          	push   0x1c(%esp)
+  803a92:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a96:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a9a:	e8 17 ff ff ff       	call   8039b6 <dm>
+  803a9f:	83 c4 14             	add    $0x14,%esp
+  803aa2:	c3                   	ret
+
+00803aa3 <__umoddi3>:
+  803aa3:	83 ec 18             	sub    $0x18,%esp
+  803aa6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803aaa:	50                   	push   %eax
+  803aab:	ff 74 24 2c          	push   0x2c(%esp)
+  803aaf:	ff 74 24 2c          	push   0x2c(%esp)
+  803ab3:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803ab7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803abb:	e8 f6 fe ff ff       	call   8039b6 <dm>
+  803ac0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803ac4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ac8:	83 c4 24             	add    $0x24,%esp
+  803acb:	c3                   	ret
+
+00803acc <__divdi3>:
+  803acc:	53                   	push   %ebx
+  803acd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803ad1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803ad5:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803ad9:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803add:	85 d2                	test   %edx,%edx
+  803adf:	78 15                	js     803af6 <__divdi3+0x2a>
+  803ae1:	85 db                	test   %ebx,%ebx
+  803ae3:	78 34                	js     803b19 <__divdi3+0x4d>
+  803ae5:	83 ec 04             	sub    $0x4,%esp
+  803ae8:	6a 00                	push   $0x0
+  803aea:	53                   	push   %ebx
+  803aeb:	51                   	push   %ecx
+  803aec:	e8 c5 fe ff ff       	call   8039b6 <dm>
+  803af1:	83 c4 10             	add    $0x10,%esp
+  803af4:	eb 21                	jmp    803b17 <__divdi3+0x4b>
+  803af6:	f7 d8                	neg    %eax
+  803af8:	83 d2 00             	adc    $0x0,%edx
+  803afb:	f7 da                	neg    %edx
+  803afd:	85 db                	test   %ebx,%ebx
+  803aff:	78 30                	js     803b31 <__divdi3+0x65>
+  803b01:	83 ec 04             	sub    $0x4,%esp
+  803b04:	6a 00                	push   $0x0
+  803b06:	53                   	push   %ebx
+  803b07:	51                   	push   %ecx
+  803b08:	e8 a9 fe ff ff       	call   8039b6 <dm>
+  803b0d:	83 c4 10             	add    $0x10,%esp
+  803b10:	f7 d8                	neg    %eax
+  803b12:	83 d2 00             	adc    $0x0,%edx
+  803b15:	f7 da                	neg    %edx
+  803b17:	5b                   	pop    %ebx
+  803b18:	c3                   	ret
+  803b19:	83 ec 04             	sub    $0x4,%esp
+  803b1c:	6a 00                	push   $0x0
+  803b1e:	f7 d9                	neg    %ecx
+  803b20:	83 d3 00             	adc    $0x0,%ebx
+  803b23:	f7 db                	neg    %ebx
+  803b25:	53                   	push   %ebx
+  803b26:	51                   	push   %ecx
+  803b27:	e8 8a fe ff ff       	call   8039b6 <dm>
+  803b2c:	83 c4 10             	add    $0x10,%esp
+  803b2f:	eb df                	jmp    803b10 <__divdi3+0x44>
+  803b31:	83 ec 04             	sub    $0x4,%esp
+  803b34:	6a 00                	push   $0x0
+  803b36:	f7 d9                	neg    %ecx
+  803b38:	83 d3 00             	adc    $0x0,%ebx
+  803b3b:	f7 db                	neg    %ebx
+  803b3d:	53                   	push   %ebx
+  803b3e:	51                   	push   %ecx
+  803b3f:	e8 72 fe ff ff       	call   8039b6 <dm>
+  803b44:	83 c4 10             	add    $0x10,%esp
+  803b47:	eb ce                	jmp    803b17 <__divdi3+0x4b>
+
+00803b49 <__moddi3>:
+  803b49:	55                   	push   %ebp
+  803b4a:	57                   	push   %edi
+  803b4b:	56                   	push   %esi
+  803b4c:	53                   	push   %ebx
+  803b4d:	83 ec 24             	sub    $0x24,%esp
+  803b50:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803b54:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803b58:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803b5c:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803b60:	85 d2                	test   %edx,%edx
+  803b62:	78 3b                	js     803b9f <__moddi3+0x56>
+  803b64:	83 ec 04             	sub    $0x4,%esp
+  803b67:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803b6b:	56                   	push   %esi
+  803b6c:	89 ce                	mov    %ecx,%esi
+  803b6e:	f7 de                	neg    %esi
+  803b70:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803b74:	89 de                	mov    %ebx,%esi
+  803b76:	83 d6 00             	adc    $0x0,%esi
+  803b79:	f7 de                	neg    %esi
+  803b7b:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803b7f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803b83:	0f 48 f1             	cmovs  %ecx,%esi
+  803b86:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803b8b:	53                   	push   %ebx
+  803b8c:	56                   	push   %esi
+  803b8d:	e8 24 fe ff ff       	call   8039b6 <dm>
+  803b92:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803b96:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803b9a:	83 c4 10             	add    $0x10,%esp
+  803b9d:	eb 47                	jmp    803be6 <__moddi3+0x9d>
+  803b9f:	f7 d8                	neg    %eax
+  803ba1:	83 d2 00             	adc    $0x0,%edx
+  803ba4:	f7 da                	neg    %edx
+  803ba6:	83 ec 04             	sub    $0x4,%esp
+  803ba9:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803bad:	56                   	push   %esi
+  803bae:	89 cf                	mov    %ecx,%edi
+  803bb0:	f7 df                	neg    %edi
+  803bb2:	89 de                	mov    %ebx,%esi
+  803bb4:	83 d6 00             	adc    $0x0,%esi
+  803bb7:	f7 de                	neg    %esi
+  803bb9:	0f 49 cf             	cmovns %edi,%ecx
+  803bbc:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803bc0:	0f 49 de             	cmovns %esi,%ebx
+  803bc3:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803bc7:	ff 74 24 0c          	push   0xc(%esp)
+  803bcb:	ff 74 24 0c          	push   0xc(%esp)
+  803bcf:	e8 e2 fd ff ff       	call   8039b6 <dm>
+  803bd4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803bd8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803bdc:	f7 d8                	neg    %eax
+  803bde:	83 d2 00             	adc    $0x0,%edx
+  803be1:	f7 da                	neg    %edx
+  803be3:	83 c4 10             	add    $0x10,%esp
+  803be6:	83 c4 24             	add    $0x24,%esp
+  803be9:	5b                   	pop    %ebx
+  803bea:	5e                   	pop    %esi
+  803beb:	5f                   	pop    %edi
+  803bec:	5d                   	pop    %ebp
+  803bed:	c3                   	ret
@@ -0,0 +1,8225 @@
+
+obj/user/echotest.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a6 04 00 00       	call   8004d7 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+
+const char *msg = "Hello world!\n";
+
+static void
+die(char *m)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 e0 3b 80 00       	push   $0x803be0
+  80003f:	e8 8b 05 00 00       	call   8005cf <cprintf>
+	exit();
+  800044:	e8 d7 04 00 00       	call   800520 <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <umain>:
+
+void umain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 58             	sub    $0x58,%esp
+	struct sockaddr_in echoserver;
+	char buffer[BUFFSIZE];
+	unsigned int echolen;
+	int received = 0;
+
+	cprintf("Connecting to:\n");
+  800057:	68 e4 3b 80 00       	push   $0x803be4
+  80005c:	e8 6e 05 00 00       	call   8005cf <cprintf>
+	cprintf("\tip address %s = %x\n", IPADDR, inet_addr(IPADDR));
+  800061:	c7 04 24 f4 3b 80 00 	movl   $0x803bf4,(%esp)
+  800068:	e8 30 04 00 00       	call   80049d <inet_addr>
+  80006d:	83 c4 0c             	add    $0xc,%esp
+  800070:	50                   	push   %eax
+  800071:	68 f4 3b 80 00       	push   $0x803bf4
+  800076:	68 fe 3b 80 00       	push   $0x803bfe
+  80007b:	e8 4f 05 00 00       	call   8005cf <cprintf>
+
+	// Create the TCP socket
+	if ((sock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800080:	83 c4 0c             	add    $0xc,%esp
+  800083:	6a 06                	push   $0x6
+  800085:	6a 01                	push   $0x1
+  800087:	6a 02                	push   $0x2
+  800089:	e8 ba 2b 00 00       	call   802c48 <socket>
+  80008e:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  800091:	83 c4 10             	add    $0x10,%esp
+  800094:	85 c0                	test   %eax,%eax
+  800096:	0f 88 b4 00 00 00    	js     800150 <umain+0x102>
+		die("Failed to create socket");
+
+	cprintf("opened socket\n");
+  80009c:	83 ec 0c             	sub    $0xc,%esp
+  80009f:	68 2b 3c 80 00       	push   $0x803c2b
+  8000a4:	e8 26 05 00 00       	call   8005cf <cprintf>
+
+	// Construct the server sockaddr_in structure
+	memset(&echoserver, 0, sizeof(echoserver));       // Clear struct
+  8000a9:	83 c4 0c             	add    $0xc,%esp
+  8000ac:	6a 10                	push   $0x10
+  8000ae:	6a 00                	push   $0x0
+  8000b0:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  8000b3:	53                   	push   %ebx
+  8000b4:	e8 55 0c 00 00       	call   800d0e <memset>
+	echoserver.sin_family = AF_INET;                  // Internet/IP
+  8000b9:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	echoserver.sin_addr.s_addr = inet_addr(IPADDR);   // IP address
+  8000bd:	c7 04 24 f4 3b 80 00 	movl   $0x803bf4,(%esp)
+  8000c4:	e8 d4 03 00 00       	call   80049d <inet_addr>
+  8000c9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	echoserver.sin_port = htons(PORT);		  // server port
+  8000cc:	c7 04 24 10 27 00 00 	movl   $0x2710,(%esp)
+  8000d3:	e8 a7 01 00 00       	call   80027f <htons>
+  8000d8:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	cprintf("trying to connect to server\n");
+  8000dc:	c7 04 24 3a 3c 80 00 	movl   $0x803c3a,(%esp)
+  8000e3:	e8 e7 04 00 00       	call   8005cf <cprintf>
+
+	// Establish connection
+	if (connect(sock, (struct sockaddr *) &echoserver, sizeof(echoserver)) < 0)
+  8000e8:	83 c4 0c             	add    $0xc,%esp
+  8000eb:	6a 10                	push   $0x10
+  8000ed:	53                   	push   %ebx
+  8000ee:	ff 75 b4             	push   -0x4c(%ebp)
+  8000f1:	e8 09 2b 00 00       	call   802bff <connect>
+  8000f6:	83 c4 10             	add    $0x10,%esp
+  8000f9:	85 c0                	test   %eax,%eax
+  8000fb:	78 62                	js     80015f <umain+0x111>
+		die("Failed to connect with server");
+
+	cprintf("connected to server\n");
+  8000fd:	83 ec 0c             	sub    $0xc,%esp
+  800100:	68 75 3c 80 00       	push   $0x803c75
+  800105:	e8 c5 04 00 00       	call   8005cf <cprintf>
+
+	// Send the word to the server
+	echolen = strlen(msg);
+  80010a:	83 c4 04             	add    $0x4,%esp
+  80010d:	ff 35 00 50 80 00    	push   0x805000
+  800113:	e8 6a 0a 00 00       	call   800b82 <strlen>
+  800118:	89 c7                	mov    %eax,%edi
+  80011a:	89 45 b0             	mov    %eax,-0x50(%ebp)
+	if (write(sock, msg, echolen) != echolen)
+  80011d:	83 c4 0c             	add    $0xc,%esp
+  800120:	50                   	push   %eax
+  800121:	ff 35 00 50 80 00    	push   0x805000
+  800127:	ff 75 b4             	push   -0x4c(%ebp)
+  80012a:	e8 4c 16 00 00       	call   80177b <write>
+  80012f:	83 c4 10             	add    $0x10,%esp
+  800132:	39 c7                	cmp    %eax,%edi
+  800134:	75 35                	jne    80016b <umain+0x11d>
+		die("Mismatch in number of sent bytes");
+
+	// Receive the word back from the server
+	cprintf("Received: \n");
+  800136:	83 ec 0c             	sub    $0xc,%esp
+  800139:	68 8a 3c 80 00       	push   $0x803c8a
+  80013e:	e8 8c 04 00 00       	call   8005cf <cprintf>
+	while (received < echolen) {
+  800143:	83 c4 10             	add    $0x10,%esp
+	int received = 0;
+  800146:	be 00 00 00 00       	mov    $0x0,%esi
+		int bytes = 0;
+		if ((bytes = read(sock, buffer, BUFFSIZE-1)) < 1) {
+  80014b:	8d 7d b8             	lea    -0x48(%ebp),%edi
+	while (received < echolen) {
+  80014e:	eb 3a                	jmp    80018a <umain+0x13c>
+		die("Failed to create socket");
+  800150:	b8 13 3c 80 00       	mov    $0x803c13,%eax
+  800155:	e8 d9 fe ff ff       	call   800033 <die>
+  80015a:	e9 3d ff ff ff       	jmp    80009c <umain+0x4e>
+		die("Failed to connect with server");
+  80015f:	b8 57 3c 80 00       	mov    $0x803c57,%eax
+  800164:	e8 ca fe ff ff       	call   800033 <die>
+  800169:	eb 92                	jmp    8000fd <umain+0xaf>
+		die("Mismatch in number of sent bytes");
+  80016b:	b8 a4 3c 80 00       	mov    $0x803ca4,%eax
+  800170:	e8 be fe ff ff       	call   800033 <die>
+  800175:	eb bf                	jmp    800136 <umain+0xe8>
+			die("Failed to receive bytes from server");
+		}
+		received += bytes;
+  800177:	01 de                	add    %ebx,%esi
+		buffer[bytes] = '\0';        // Assure null terminated string
+  800179:	c6 44 1d b8 00       	movb   $0x0,-0x48(%ebp,%ebx,1)
+		cprintf(buffer);
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+  800181:	57                   	push   %edi
+  800182:	e8 48 04 00 00       	call   8005cf <cprintf>
+  800187:	83 c4 10             	add    $0x10,%esp
+	while (received < echolen) {
+  80018a:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  80018d:	39 c6                	cmp    %eax,%esi
+  80018f:	73 23                	jae    8001b4 <umain+0x166>
+		if ((bytes = read(sock, buffer, BUFFSIZE-1)) < 1) {
+  800191:	83 ec 04             	sub    $0x4,%esp
+  800194:	6a 1f                	push   $0x1f
+  800196:	57                   	push   %edi
+  800197:	ff 75 b4             	push   -0x4c(%ebp)
+  80019a:	e8 0e 15 00 00       	call   8016ad <read>
+  80019f:	89 c3                	mov    %eax,%ebx
+  8001a1:	83 c4 10             	add    $0x10,%esp
+  8001a4:	85 c0                	test   %eax,%eax
+  8001a6:	7f cf                	jg     800177 <umain+0x129>
+			die("Failed to receive bytes from server");
+  8001a8:	b8 c8 3c 80 00       	mov    $0x803cc8,%eax
+  8001ad:	e8 81 fe ff ff       	call   800033 <die>
+  8001b2:	eb c3                	jmp    800177 <umain+0x129>
+	}
+	cprintf("\n");
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	68 94 3c 80 00       	push   $0x803c94
+  8001bc:	e8 0e 04 00 00       	call   8005cf <cprintf>
+
+	close(sock);
+  8001c1:	83 c4 04             	add    $0x4,%esp
+  8001c4:	ff 75 b4             	push   -0x4c(%ebp)
+  8001c7:	e8 a5 13 00 00       	call   801571 <close>
+}
+  8001cc:	83 c4 10             	add    $0x10,%esp
+  8001cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d2:	5b                   	pop    %ebx
+  8001d3:	5e                   	pop    %esi
+  8001d4:	5f                   	pop    %edi
+  8001d5:	5d                   	pop    %ebp
+  8001d6:	c3                   	ret
+
+008001d7 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	57                   	push   %edi
+  8001db:	56                   	push   %esi
+  8001dc:	53                   	push   %ebx
+  8001dd:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8001e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8001e6:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  8001e9:	b9 00 60 80 00       	mov    $0x806000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  8001ee:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  8001f3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001f6:	eb 31                	jmp    800229 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  8001f8:	0f b6 c8             	movzbl %al,%ecx
+  8001fb:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  800200:	88 0a                	mov    %cl,(%edx)
+  800202:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  800205:	83 e8 01             	sub    $0x1,%eax
+  800208:	3c ff                	cmp    $0xff,%al
+  80020a:	75 ec                	jne    8001f8 <inet_ntoa+0x21>
+  80020c:	0f b6 db             	movzbl %bl,%ebx
+  80020f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800212:	01 d8                	add    %ebx,%eax
+  800214:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  800216:	8d 40 01             	lea    0x1(%eax),%eax
+  800219:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80021c:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  80021f:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  800222:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800225:	39 c7                	cmp    %eax,%edi
+  800227:	74 46                	je     80026f <inet_ntoa+0x98>
+  800229:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  80022c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800231:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  800234:	89 f0                	mov    %esi,%eax
+  800236:	f6 e2                	mul    %dl
+  800238:	66 c1 e8 0b          	shr    $0xb,%ax
+  80023c:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  80023f:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  800242:	01 c9                	add    %ecx,%ecx
+  800244:	89 d0                	mov    %edx,%eax
+  800246:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800248:	89 d7                	mov    %edx,%edi
+  80024a:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  80024e:	89 d9                	mov    %ebx,%ecx
+  800250:	83 c3 01             	add    $0x1,%ebx
+  800253:	0f b6 c9             	movzbl %cl,%ecx
+  800256:	83 c0 30             	add    $0x30,%eax
+  800259:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  80025d:	89 f8                	mov    %edi,%eax
+  80025f:	3c 09                	cmp    $0x9,%al
+  800261:	77 d1                	ja     800234 <inet_ntoa+0x5d>
+  800263:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  800266:	88 17                	mov    %dl,(%edi)
+  800268:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  80026b:	89 d8                	mov    %ebx,%eax
+  80026d:	eb 96                	jmp    800205 <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  80026f:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  800272:	b8 00 60 80 00       	mov    $0x806000,%eax
+  800277:	83 c4 1c             	add    $0x1c,%esp
+  80027a:	5b                   	pop    %ebx
+  80027b:	5e                   	pop    %esi
+  80027c:	5f                   	pop    %edi
+  80027d:	5d                   	pop    %ebp
+  80027e:	c3                   	ret
+
+0080027f <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  80027f:	55                   	push   %ebp
+  800280:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  800282:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800286:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  80028a:	5d                   	pop    %ebp
+  80028b:	c3                   	ret
+
+0080028c <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  80028c:	55                   	push   %ebp
+  80028d:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80028f:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800293:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  800297:	5d                   	pop    %ebp
+  800298:	c3                   	ret
+
+00800299 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  800299:	55                   	push   %ebp
+  80029a:	89 e5                	mov    %esp,%ebp
+  80029c:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  80029f:	89 d0                	mov    %edx,%eax
+  8002a1:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  8002a4:	89 d1                	mov    %edx,%ecx
+  8002a6:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002a9:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  8002ab:	89 d1                	mov    %edx,%ecx
+  8002ad:	c1 e1 08             	shl    $0x8,%ecx
+  8002b0:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002b6:	09 c8                	or     %ecx,%eax
+  8002b8:	c1 ea 08             	shr    $0x8,%edx
+  8002bb:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8002c1:	09 d0                	or     %edx,%eax
+}
+  8002c3:	5d                   	pop    %ebp
+  8002c4:	c3                   	ret
+
+008002c5 <inet_aton>:
+{
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	57                   	push   %edi
+  8002c9:	56                   	push   %esi
+  8002ca:	53                   	push   %ebx
+  8002cb:	83 ec 2c             	sub    $0x2c,%esp
+  8002ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8002d1:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8002d4:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8002d7:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8002da:	e9 9b 00 00 00       	jmp    80037a <inet_aton+0xb5>
+      c = *++cp;
+  8002df:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8002e3:	89 c1                	mov    %eax,%ecx
+  8002e5:	83 e1 df             	and    $0xffffffdf,%ecx
+  8002e8:	80 f9 58             	cmp    $0x58,%cl
+  8002eb:	74 10                	je     8002fd <inet_aton+0x38>
+      c = *++cp;
+  8002ed:	83 c2 01             	add    $0x1,%edx
+  8002f0:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  8002f3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8002f8:	e9 97 00 00 00       	jmp    800394 <inet_aton+0xcf>
+        c = *++cp;
+  8002fd:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  800301:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  800304:	bf 10 00 00 00       	mov    $0x10,%edi
+  800309:	e9 86 00 00 00       	jmp    800394 <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  80030e:	0f af d7             	imul   %edi,%edx
+  800311:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  800315:	0f be 01             	movsbl (%ecx),%eax
+  800318:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  80031b:	88 45 d7             	mov    %al,-0x29(%ebp)
+  80031e:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  800321:	80 fb 09             	cmp    $0x9,%bl
+  800324:	76 e8                	jbe    80030e <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  800326:	83 ff 10             	cmp    $0x10,%edi
+  800329:	75 2e                	jne    800359 <inet_aton+0x94>
+  80032b:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  80032f:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  800332:	83 e3 df             	and    $0xffffffdf,%ebx
+  800335:	83 eb 41             	sub    $0x41,%ebx
+  800338:	80 fb 05             	cmp    $0x5,%bl
+  80033b:	77 1c                	ja     800359 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  80033d:	c1 e2 04             	shl    $0x4,%edx
+  800340:	83 c0 0a             	add    $0xa,%eax
+  800343:	89 f3                	mov    %esi,%ebx
+  800345:	80 fb 1a             	cmp    $0x1a,%bl
+  800348:	19 db                	sbb    %ebx,%ebx
+  80034a:	83 e3 20             	and    $0x20,%ebx
+  80034d:	83 c3 41             	add    $0x41,%ebx
+  800350:	29 d8                	sub    %ebx,%eax
+  800352:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  800354:	0f be 01             	movsbl (%ecx),%eax
+  800357:	eb bf                	jmp    800318 <inet_aton+0x53>
+    if (c == '.') {
+  800359:	83 f8 2e             	cmp    $0x2e,%eax
+  80035c:	75 43                	jne    8003a1 <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  80035e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800361:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800364:	39 f0                	cmp    %esi,%eax
+  800366:	0f 84 22 01 00 00    	je     80048e <inet_aton+0x1c9>
+      *pp++ = val;
+  80036c:	83 c0 04             	add    $0x4,%eax
+  80036f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800372:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  800375:	89 ca                	mov    %ecx,%edx
+  800377:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  80037a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80037d:	80 f9 09             	cmp    $0x9,%cl
+  800380:	0f 87 01 01 00 00    	ja     800487 <inet_aton+0x1c2>
+    base = 10;
+  800386:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  80038b:	83 f8 30             	cmp    $0x30,%eax
+  80038e:	0f 84 4b ff ff ff    	je     8002df <inet_aton+0x1a>
+  800394:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  800397:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039c:	e9 7a ff ff ff       	jmp    80031b <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003a1:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8003a5:	89 d6                	mov    %edx,%esi
+  8003a7:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8003aa:	85 c0                	test   %eax,%eax
+  8003ac:	74 2e                	je     8003dc <inet_aton+0x117>
+    return (0);
+  8003ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003b3:	89 fa                	mov    %edi,%edx
+  8003b5:	80 fa 1f             	cmp    $0x1f,%dl
+  8003b8:	0f 86 d5 00 00 00    	jbe    800493 <inet_aton+0x1ce>
+  8003be:	84 c0                	test   %al,%al
+  8003c0:	0f 88 cd 00 00 00    	js     800493 <inet_aton+0x1ce>
+  8003c6:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8003c9:	83 f9 04             	cmp    $0x4,%ecx
+  8003cc:	76 0e                	jbe    8003dc <inet_aton+0x117>
+    return (0);
+  8003ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003d3:	83 f8 20             	cmp    $0x20,%eax
+  8003d6:	0f 85 b7 00 00 00    	jne    800493 <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8003dc:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8003df:	89 d8                	mov    %ebx,%eax
+  8003e1:	29 c8                	sub    %ecx,%eax
+  8003e3:	c1 f8 02             	sar    $0x2,%eax
+  8003e6:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  8003e9:	83 f8 02             	cmp    $0x2,%eax
+  8003ec:	74 7a                	je     800468 <inet_aton+0x1a3>
+  8003ee:	83 f9 03             	cmp    $0x3,%ecx
+  8003f1:	7f 49                	jg     80043c <inet_aton+0x177>
+  8003f3:	85 c9                	test   %ecx,%ecx
+  8003f5:	0f 84 98 00 00 00    	je     800493 <inet_aton+0x1ce>
+  8003fb:	83 f9 02             	cmp    $0x2,%ecx
+  8003fe:	75 19                	jne    800419 <inet_aton+0x154>
+      return (0);
+  800400:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  800405:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  80040b:	0f 87 82 00 00 00    	ja     800493 <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  800411:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800414:	c1 e0 18             	shl    $0x18,%eax
+  800417:	09 c6                	or     %eax,%esi
+  return (1);
+  800419:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  80041e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800422:	74 6f                	je     800493 <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  800424:	83 ec 0c             	sub    $0xc,%esp
+  800427:	56                   	push   %esi
+  800428:	e8 6c fe ff ff       	call   800299 <htonl>
+  80042d:	83 c4 10             	add    $0x10,%esp
+  800430:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800433:	89 06                	mov    %eax,(%esi)
+  return (1);
+  800435:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80043a:	eb 57                	jmp    800493 <inet_aton+0x1ce>
+  switch (n) {
+  80043c:	83 f9 04             	cmp    $0x4,%ecx
+  80043f:	75 d8                	jne    800419 <inet_aton+0x154>
+      return (0);
+  800441:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  800446:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  80044c:	77 45                	ja     800493 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  80044e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800451:	c1 e0 18             	shl    $0x18,%eax
+  800454:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800457:	c1 e1 10             	shl    $0x10,%ecx
+  80045a:	09 c8                	or     %ecx,%eax
+  80045c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80045f:	c1 e1 08             	shl    $0x8,%ecx
+  800462:	09 c8                	or     %ecx,%eax
+  800464:	09 c6                	or     %eax,%esi
+    break;
+  800466:	eb b1                	jmp    800419 <inet_aton+0x154>
+      return (0);
+  800468:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  80046d:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  800473:	77 1e                	ja     800493 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  800475:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800478:	c1 e0 18             	shl    $0x18,%eax
+  80047b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80047e:	c1 e1 10             	shl    $0x10,%ecx
+  800481:	09 c8                	or     %ecx,%eax
+  800483:	09 c6                	or     %eax,%esi
+    break;
+  800485:	eb 92                	jmp    800419 <inet_aton+0x154>
+      return (0);
+  800487:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80048c:	eb 05                	jmp    800493 <inet_aton+0x1ce>
+        return (0);
+  80048e:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  800493:	89 c8                	mov    %ecx,%eax
+  800495:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800498:	5b                   	pop    %ebx
+  800499:	5e                   	pop    %esi
+  80049a:	5f                   	pop    %edi
+  80049b:	5d                   	pop    %ebp
+  80049c:	c3                   	ret
+
+0080049d <inet_addr>:
+{
+  80049d:	55                   	push   %ebp
+  80049e:	89 e5                	mov    %esp,%ebp
+  8004a0:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  8004a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8004a6:	50                   	push   %eax
+  8004a7:	ff 75 08             	push   0x8(%ebp)
+  8004aa:	e8 16 fe ff ff       	call   8002c5 <inet_aton>
+  8004af:	89 c2                	mov    %eax,%edx
+  8004b1:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8004b4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8004b9:	85 d2                	test   %edx,%edx
+  8004bb:	75 02                	jne    8004bf <inet_addr+0x22>
+}
+  8004bd:	c9                   	leave
+  8004be:	c3                   	ret
+    return (val.s_addr);
+  8004bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8004c2:	eb f9                	jmp    8004bd <inet_addr+0x20>
+
+008004c4 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8004c4:	55                   	push   %ebp
+  8004c5:	89 e5                	mov    %esp,%ebp
+  8004c7:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8004ca:	ff 75 08             	push   0x8(%ebp)
+  8004cd:	e8 c7 fd ff ff       	call   800299 <htonl>
+  8004d2:	83 c4 10             	add    $0x10,%esp
+}
+  8004d5:	c9                   	leave
+  8004d6:	c3                   	ret
+
+008004d7 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004d7:	55                   	push   %ebp
+  8004d8:	89 e5                	mov    %esp,%ebp
+  8004da:	56                   	push   %esi
+  8004db:	53                   	push   %ebx
+  8004dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004df:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8004e2:	e8 9c 0a 00 00       	call   800f83 <sys_getenvid>
+  8004e7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004ec:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8004f2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004f7:	a3 10 60 80 00       	mov    %eax,0x806010
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004fc:	85 db                	test   %ebx,%ebx
+  8004fe:	7e 07                	jle    800507 <libmain+0x30>
+		binaryname = argv[0];
+  800500:	8b 06                	mov    (%esi),%eax
+  800502:	a3 04 50 80 00       	mov    %eax,0x805004
+
+	// call user main routine
+	umain(argc, argv);
+  800507:	83 ec 08             	sub    $0x8,%esp
+  80050a:	56                   	push   %esi
+  80050b:	53                   	push   %ebx
+  80050c:	e8 3d fb ff ff       	call   80004e <umain>
+
+	// exit gracefully
+	exit();
+  800511:	e8 0a 00 00 00       	call   800520 <exit>
+}
+  800516:	83 c4 10             	add    $0x10,%esp
+  800519:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80051c:	5b                   	pop    %ebx
+  80051d:	5e                   	pop    %esi
+  80051e:	5d                   	pop    %ebp
+  80051f:	c3                   	ret
+
+00800520 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800520:	55                   	push   %ebp
+  800521:	89 e5                	mov    %esp,%ebp
+  800523:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800526:	e8 73 10 00 00       	call   80159e <close_all>
+	sys_env_destroy(0);
+  80052b:	83 ec 0c             	sub    $0xc,%esp
+  80052e:	6a 00                	push   $0x0
+  800530:	e8 05 0a 00 00       	call   800f3a <sys_env_destroy>
+}
+  800535:	83 c4 10             	add    $0x10,%esp
+  800538:	c9                   	leave
+  800539:	c3                   	ret
+
+0080053a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80053a:	55                   	push   %ebp
+  80053b:	89 e5                	mov    %esp,%ebp
+  80053d:	53                   	push   %ebx
+  80053e:	83 ec 04             	sub    $0x4,%esp
+  800541:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800544:	8b 13                	mov    (%ebx),%edx
+  800546:	8d 42 01             	lea    0x1(%edx),%eax
+  800549:	89 03                	mov    %eax,(%ebx)
+  80054b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80054e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800552:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800557:	74 09                	je     800562 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800559:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80055d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800560:	c9                   	leave
+  800561:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800562:	83 ec 08             	sub    $0x8,%esp
+  800565:	68 ff 00 00 00       	push   $0xff
+  80056a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80056d:	50                   	push   %eax
+  80056e:	e8 7a 09 00 00       	call   800eed <sys_cputs>
+		b->idx = 0;
+  800573:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800579:	83 c4 10             	add    $0x10,%esp
+  80057c:	eb db                	jmp    800559 <putch+0x1f>
+
+0080057e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80057e:	55                   	push   %ebp
+  80057f:	89 e5                	mov    %esp,%ebp
+  800581:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800587:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80058e:	00 00 00 
+	b.cnt = 0;
+  800591:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800598:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80059b:	ff 75 0c             	push   0xc(%ebp)
+  80059e:	ff 75 08             	push   0x8(%ebp)
+  8005a1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005a7:	50                   	push   %eax
+  8005a8:	68 3a 05 80 00       	push   $0x80053a
+  8005ad:	e8 14 01 00 00       	call   8006c6 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005b2:	83 c4 08             	add    $0x8,%esp
+  8005b5:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005bb:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005c1:	50                   	push   %eax
+  8005c2:	e8 26 09 00 00       	call   800eed <sys_cputs>
+
+	return b.cnt;
+}
+  8005c7:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005cd:	c9                   	leave
+  8005ce:	c3                   	ret
+
+008005cf <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8005cf:	55                   	push   %ebp
+  8005d0:	89 e5                	mov    %esp,%ebp
+  8005d2:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8005d5:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8005d8:	50                   	push   %eax
+  8005d9:	ff 75 08             	push   0x8(%ebp)
+  8005dc:	e8 9d ff ff ff       	call   80057e <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005e1:	c9                   	leave
+  8005e2:	c3                   	ret
+
+008005e3 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005e3:	55                   	push   %ebp
+  8005e4:	89 e5                	mov    %esp,%ebp
+  8005e6:	57                   	push   %edi
+  8005e7:	56                   	push   %esi
+  8005e8:	53                   	push   %ebx
+  8005e9:	83 ec 1c             	sub    $0x1c,%esp
+  8005ec:	89 c7                	mov    %eax,%edi
+  8005ee:	89 d6                	mov    %edx,%esi
+  8005f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8005f6:	89 d1                	mov    %edx,%ecx
+  8005f8:	89 c2                	mov    %eax,%edx
+  8005fa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005fd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800600:	8b 45 10             	mov    0x10(%ebp),%eax
+  800603:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800606:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800609:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800610:	39 c2                	cmp    %eax,%edx
+  800612:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800615:	72 3e                	jb     800655 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800617:	83 ec 0c             	sub    $0xc,%esp
+  80061a:	ff 75 18             	push   0x18(%ebp)
+  80061d:	83 eb 01             	sub    $0x1,%ebx
+  800620:	53                   	push   %ebx
+  800621:	50                   	push   %eax
+  800622:	83 ec 08             	sub    $0x8,%esp
+  800625:	ff 75 e4             	push   -0x1c(%ebp)
+  800628:	ff 75 e0             	push   -0x20(%ebp)
+  80062b:	ff 75 dc             	push   -0x24(%ebp)
+  80062e:	ff 75 d8             	push   -0x28(%ebp)
+  800631:	e8 37 34 00 00       	call   803a6d <__udivdi3>
+  800636:	83 c4 18             	add    $0x18,%esp
+  800639:	52                   	push   %edx
+  80063a:	50                   	push   %eax
+  80063b:	89 f2                	mov    %esi,%edx
+  80063d:	89 f8                	mov    %edi,%eax
+  80063f:	e8 9f ff ff ff       	call   8005e3 <printnum>
+  800644:	83 c4 20             	add    $0x20,%esp
+  800647:	eb 13                	jmp    80065c <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800649:	83 ec 08             	sub    $0x8,%esp
+  80064c:	56                   	push   %esi
+  80064d:	ff 75 18             	push   0x18(%ebp)
+  800650:	ff d7                	call   *%edi
+  800652:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800655:	83 eb 01             	sub    $0x1,%ebx
+  800658:	85 db                	test   %ebx,%ebx
+  80065a:	7f ed                	jg     800649 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80065c:	83 ec 08             	sub    $0x8,%esp
+  80065f:	56                   	push   %esi
+  800660:	83 ec 04             	sub    $0x4,%esp
+  800663:	ff 75 e4             	push   -0x1c(%ebp)
+  800666:	ff 75 e0             	push   -0x20(%ebp)
+  800669:	ff 75 dc             	push   -0x24(%ebp)
+  80066c:	ff 75 d8             	push   -0x28(%ebp)
+  80066f:	e8 17 34 00 00       	call   803a8b <__umoddi3>
+  800674:	83 c4 14             	add    $0x14,%esp
+  800677:	0f be 80 f6 3c 80 00 	movsbl 0x803cf6(%eax),%eax
+  80067e:	50                   	push   %eax
+  80067f:	ff d7                	call   *%edi
+}
+  800681:	83 c4 10             	add    $0x10,%esp
+  800684:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800687:	5b                   	pop    %ebx
+  800688:	5e                   	pop    %esi
+  800689:	5f                   	pop    %edi
+  80068a:	5d                   	pop    %ebp
+  80068b:	c3                   	ret
+
+0080068c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80068c:	55                   	push   %ebp
+  80068d:	89 e5                	mov    %esp,%ebp
+  80068f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800692:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800696:	8b 10                	mov    (%eax),%edx
+  800698:	3b 50 04             	cmp    0x4(%eax),%edx
+  80069b:	73 0a                	jae    8006a7 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80069d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006a0:	89 08                	mov    %ecx,(%eax)
+  8006a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006a5:	88 02                	mov    %al,(%edx)
+}
+  8006a7:	5d                   	pop    %ebp
+  8006a8:	c3                   	ret
+
+008006a9 <printfmt>:
+{
+  8006a9:	55                   	push   %ebp
+  8006aa:	89 e5                	mov    %esp,%ebp
+  8006ac:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006af:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006b2:	50                   	push   %eax
+  8006b3:	ff 75 10             	push   0x10(%ebp)
+  8006b6:	ff 75 0c             	push   0xc(%ebp)
+  8006b9:	ff 75 08             	push   0x8(%ebp)
+  8006bc:	e8 05 00 00 00       	call   8006c6 <vprintfmt>
+}
+  8006c1:	83 c4 10             	add    $0x10,%esp
+  8006c4:	c9                   	leave
+  8006c5:	c3                   	ret
+
+008006c6 <vprintfmt>:
+{
+  8006c6:	55                   	push   %ebp
+  8006c7:	89 e5                	mov    %esp,%ebp
+  8006c9:	57                   	push   %edi
+  8006ca:	56                   	push   %esi
+  8006cb:	53                   	push   %ebx
+  8006cc:	83 ec 2c             	sub    $0x2c,%esp
+  8006cf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006d5:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8006d8:	eb 0a                	jmp    8006e4 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8006da:	83 ec 08             	sub    $0x8,%esp
+  8006dd:	53                   	push   %ebx
+  8006de:	50                   	push   %eax
+  8006df:	ff d6                	call   *%esi
+  8006e1:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006e4:	83 c7 01             	add    $0x1,%edi
+  8006e7:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8006eb:	83 f8 25             	cmp    $0x25,%eax
+  8006ee:	74 0c                	je     8006fc <vprintfmt+0x36>
+			if (ch == '\0')
+  8006f0:	85 c0                	test   %eax,%eax
+  8006f2:	75 e6                	jne    8006da <vprintfmt+0x14>
+}
+  8006f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006f7:	5b                   	pop    %ebx
+  8006f8:	5e                   	pop    %esi
+  8006f9:	5f                   	pop    %edi
+  8006fa:	5d                   	pop    %ebp
+  8006fb:	c3                   	ret
+		padc = ' ';
+  8006fc:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800700:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800707:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80070e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800715:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80071a:	8d 47 01             	lea    0x1(%edi),%eax
+  80071d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800720:	0f b6 17             	movzbl (%edi),%edx
+  800723:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800726:	3c 55                	cmp    $0x55,%al
+  800728:	0f 87 cf 03 00 00    	ja     800afd <vprintfmt+0x437>
+  80072e:	0f b6 c0             	movzbl %al,%eax
+  800731:	ff 24 85 60 3e 80 00 	jmp    *0x803e60(,%eax,4)
+  800738:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80073b:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80073f:	eb d9                	jmp    80071a <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800741:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800744:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800748:	eb d0                	jmp    80071a <vprintfmt+0x54>
+  80074a:	0f b6 d2             	movzbl %dl,%edx
+  80074d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800750:	b8 00 00 00 00       	mov    $0x0,%eax
+  800755:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800758:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80075b:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80075f:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800762:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800765:	83 f9 09             	cmp    $0x9,%ecx
+  800768:	77 55                	ja     8007bf <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80076a:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80076d:	eb e9                	jmp    800758 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80076f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800772:	8b 00                	mov    (%eax),%eax
+  800774:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800777:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077a:	8d 40 04             	lea    0x4(%eax),%eax
+  80077d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800780:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800783:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800787:	79 91                	jns    80071a <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800789:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80078c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80078f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800796:	eb 82                	jmp    80071a <vprintfmt+0x54>
+			if (width < 0)
+  800798:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80079b:	85 d2                	test   %edx,%edx
+  80079d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a2:	0f 49 c2             	cmovns %edx,%eax
+  8007a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007ab:	e9 6a ff ff ff       	jmp    80071a <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8007b3:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007ba:	e9 5b ff ff ff       	jmp    80071a <vprintfmt+0x54>
+  8007bf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007c2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007c5:	eb bc                	jmp    800783 <vprintfmt+0xbd>
+			lflag++;
+  8007c7:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007cd:	e9 48 ff ff ff       	jmp    80071a <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8007d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d5:	8d 78 04             	lea    0x4(%eax),%edi
+  8007d8:	83 ec 08             	sub    $0x8,%esp
+  8007db:	53                   	push   %ebx
+  8007dc:	ff 30                	push   (%eax)
+  8007de:	ff d6                	call   *%esi
+			break;
+  8007e0:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8007e3:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8007e6:	e9 b1 02 00 00       	jmp    800a9c <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8007eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ee:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8007f1:	8b 10                	mov    (%eax),%edx
+  8007f3:	89 d0                	mov    %edx,%eax
+  8007f5:	f7 d8                	neg    %eax
+  8007f7:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007fa:	83 f8 11             	cmp    $0x11,%eax
+  8007fd:	7f 23                	jg     800822 <vprintfmt+0x15c>
+  8007ff:	8b 14 85 c0 3f 80 00 	mov    0x803fc0(,%eax,4),%edx
+  800806:	85 d2                	test   %edx,%edx
+  800808:	74 18                	je     800822 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80080a:	52                   	push   %edx
+  80080b:	68 12 41 80 00       	push   $0x804112
+  800810:	53                   	push   %ebx
+  800811:	56                   	push   %esi
+  800812:	e8 92 fe ff ff       	call   8006a9 <printfmt>
+  800817:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80081a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80081d:	e9 7a 02 00 00       	jmp    800a9c <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800822:	50                   	push   %eax
+  800823:	68 0e 3d 80 00       	push   $0x803d0e
+  800828:	53                   	push   %ebx
+  800829:	56                   	push   %esi
+  80082a:	e8 7a fe ff ff       	call   8006a9 <printfmt>
+  80082f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800832:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800835:	e9 62 02 00 00       	jmp    800a9c <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80083a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083d:	83 c0 04             	add    $0x4,%eax
+  800840:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800843:	8b 45 14             	mov    0x14(%ebp),%eax
+  800846:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800848:	85 c9                	test   %ecx,%ecx
+  80084a:	b8 07 3d 80 00       	mov    $0x803d07,%eax
+  80084f:	0f 45 c1             	cmovne %ecx,%eax
+  800852:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800855:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800859:	7e 06                	jle    800861 <vprintfmt+0x19b>
+  80085b:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80085f:	75 0b                	jne    80086c <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800861:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800864:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800867:	89 75 08             	mov    %esi,0x8(%ebp)
+  80086a:	eb 5c                	jmp    8008c8 <vprintfmt+0x202>
+  80086c:	83 ec 08             	sub    $0x8,%esp
+  80086f:	ff 75 d0             	push   -0x30(%ebp)
+  800872:	ff 75 cc             	push   -0x34(%ebp)
+  800875:	e8 20 03 00 00       	call   800b9a <strnlen>
+  80087a:	89 c2                	mov    %eax,%edx
+  80087c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80087f:	29 d0                	sub    %edx,%eax
+  800881:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800884:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800888:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80088b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80088e:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800890:	eb 0e                	jmp    8008a0 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800892:	83 ec 08             	sub    $0x8,%esp
+  800895:	53                   	push   %ebx
+  800896:	57                   	push   %edi
+  800897:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80089a:	83 ee 01             	sub    $0x1,%esi
+  80089d:	83 c4 10             	add    $0x10,%esp
+  8008a0:	85 f6                	test   %esi,%esi
+  8008a2:	7f ee                	jg     800892 <vprintfmt+0x1cc>
+  8008a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008aa:	85 c0                	test   %eax,%eax
+  8008ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008b1:	0f 49 d0             	cmovns %eax,%edx
+  8008b4:	29 d0                	sub    %edx,%eax
+  8008b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008b9:	eb a6                	jmp    800861 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8008bb:	83 ec 08             	sub    $0x8,%esp
+  8008be:	53                   	push   %ebx
+  8008bf:	52                   	push   %edx
+  8008c0:	ff 55 08             	call   *0x8(%ebp)
+  8008c3:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008c6:	89 f1                	mov    %esi,%ecx
+  8008c8:	8d 71 01             	lea    0x1(%ecx),%esi
+  8008cb:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8008cf:	0f be d0             	movsbl %al,%edx
+  8008d2:	85 d2                	test   %edx,%edx
+  8008d4:	74 28                	je     8008fe <vprintfmt+0x238>
+  8008d6:	85 ff                	test   %edi,%edi
+  8008d8:	78 05                	js     8008df <vprintfmt+0x219>
+  8008da:	83 ef 01             	sub    $0x1,%edi
+  8008dd:	78 30                	js     80090f <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008df:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008e3:	74 d6                	je     8008bb <vprintfmt+0x1f5>
+  8008e5:	0f be c0             	movsbl %al,%eax
+  8008e8:	83 e8 20             	sub    $0x20,%eax
+  8008eb:	83 f8 5e             	cmp    $0x5e,%eax
+  8008ee:	76 cb                	jbe    8008bb <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8008f0:	83 ec 08             	sub    $0x8,%esp
+  8008f3:	53                   	push   %ebx
+  8008f4:	6a 3f                	push   $0x3f
+  8008f6:	ff 55 08             	call   *0x8(%ebp)
+  8008f9:	83 c4 10             	add    $0x10,%esp
+  8008fc:	eb c8                	jmp    8008c6 <vprintfmt+0x200>
+  8008fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  800901:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800904:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800907:	01 d0                	add    %edx,%eax
+  800909:	29 c8                	sub    %ecx,%eax
+  80090b:	89 c7                	mov    %eax,%edi
+  80090d:	eb 13                	jmp    800922 <vprintfmt+0x25c>
+  80090f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800912:	eb ed                	jmp    800901 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800914:	83 ec 08             	sub    $0x8,%esp
+  800917:	53                   	push   %ebx
+  800918:	6a 20                	push   $0x20
+  80091a:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80091c:	83 ef 01             	sub    $0x1,%edi
+  80091f:	83 c4 10             	add    $0x10,%esp
+  800922:	85 ff                	test   %edi,%edi
+  800924:	7f ee                	jg     800914 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800926:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800929:	89 45 14             	mov    %eax,0x14(%ebp)
+  80092c:	e9 6b 01 00 00       	jmp    800a9c <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800931:	83 f9 01             	cmp    $0x1,%ecx
+  800934:	7f 1f                	jg     800955 <vprintfmt+0x28f>
+	else if (lflag)
+  800936:	85 c9                	test   %ecx,%ecx
+  800938:	74 67                	je     8009a1 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80093a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093d:	8b 00                	mov    (%eax),%eax
+  80093f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800942:	89 c1                	mov    %eax,%ecx
+  800944:	c1 f9 1f             	sar    $0x1f,%ecx
+  800947:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80094a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094d:	8d 40 04             	lea    0x4(%eax),%eax
+  800950:	89 45 14             	mov    %eax,0x14(%ebp)
+  800953:	eb 17                	jmp    80096c <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800955:	8b 45 14             	mov    0x14(%ebp),%eax
+  800958:	8b 50 04             	mov    0x4(%eax),%edx
+  80095b:	8b 00                	mov    (%eax),%eax
+  80095d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800960:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800963:	8b 45 14             	mov    0x14(%ebp),%eax
+  800966:	8d 40 08             	lea    0x8(%eax),%eax
+  800969:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80096c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80096f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800972:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800977:	85 c9                	test   %ecx,%ecx
+  800979:	0f 89 03 01 00 00    	jns    800a82 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80097f:	83 ec 08             	sub    $0x8,%esp
+  800982:	53                   	push   %ebx
+  800983:	6a 2d                	push   $0x2d
+  800985:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800987:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80098a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80098d:	f7 da                	neg    %edx
+  80098f:	83 d1 00             	adc    $0x0,%ecx
+  800992:	f7 d9                	neg    %ecx
+  800994:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800997:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80099c:	e9 e1 00 00 00       	jmp    800a82 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8009a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a4:	8b 00                	mov    (%eax),%eax
+  8009a6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009a9:	89 c1                	mov    %eax,%ecx
+  8009ab:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009ae:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009ba:	eb b0                	jmp    80096c <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8009bc:	83 f9 01             	cmp    $0x1,%ecx
+  8009bf:	7f 1e                	jg     8009df <vprintfmt+0x319>
+	else if (lflag)
+  8009c1:	85 c9                	test   %ecx,%ecx
+  8009c3:	74 32                	je     8009f7 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8009c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c8:	8b 10                	mov    (%eax),%edx
+  8009ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8009d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009d5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8009da:	e9 a3 00 00 00       	jmp    800a82 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e2:	8b 10                	mov    (%eax),%edx
+  8009e4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009e7:	8d 40 08             	lea    0x8(%eax),%eax
+  8009ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009ed:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8009f2:	e9 8b 00 00 00       	jmp    800a82 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8009f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009fa:	8b 10                	mov    (%eax),%edx
+  8009fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a01:	8d 40 04             	lea    0x4(%eax),%eax
+  800a04:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a07:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800a0c:	eb 74                	jmp    800a82 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800a0e:	83 f9 01             	cmp    $0x1,%ecx
+  800a11:	7f 1b                	jg     800a2e <vprintfmt+0x368>
+	else if (lflag)
+  800a13:	85 c9                	test   %ecx,%ecx
+  800a15:	74 2c                	je     800a43 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800a17:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1a:	8b 10                	mov    (%eax),%edx
+  800a1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a21:	8d 40 04             	lea    0x4(%eax),%eax
+  800a24:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a27:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800a2c:	eb 54                	jmp    800a82 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800a2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a31:	8b 10                	mov    (%eax),%edx
+  800a33:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a36:	8d 40 08             	lea    0x8(%eax),%eax
+  800a39:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a3c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800a41:	eb 3f                	jmp    800a82 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800a43:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a46:	8b 10                	mov    (%eax),%edx
+  800a48:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a4d:	8d 40 04             	lea    0x4(%eax),%eax
+  800a50:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a53:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800a58:	eb 28                	jmp    800a82 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800a5a:	83 ec 08             	sub    $0x8,%esp
+  800a5d:	53                   	push   %ebx
+  800a5e:	6a 30                	push   $0x30
+  800a60:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800a62:	83 c4 08             	add    $0x8,%esp
+  800a65:	53                   	push   %ebx
+  800a66:	6a 78                	push   $0x78
+  800a68:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800a6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6d:	8b 10                	mov    (%eax),%edx
+  800a6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a74:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a77:	8d 40 04             	lea    0x4(%eax),%eax
+  800a7a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a7d:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800a82:	83 ec 0c             	sub    $0xc,%esp
+  800a85:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800a89:	50                   	push   %eax
+  800a8a:	ff 75 e0             	push   -0x20(%ebp)
+  800a8d:	57                   	push   %edi
+  800a8e:	51                   	push   %ecx
+  800a8f:	52                   	push   %edx
+  800a90:	89 da                	mov    %ebx,%edx
+  800a92:	89 f0                	mov    %esi,%eax
+  800a94:	e8 4a fb ff ff       	call   8005e3 <printnum>
+			break;
+  800a99:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800a9c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a9f:	e9 40 fc ff ff       	jmp    8006e4 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800aa4:	83 f9 01             	cmp    $0x1,%ecx
+  800aa7:	7f 1b                	jg     800ac4 <vprintfmt+0x3fe>
+	else if (lflag)
+  800aa9:	85 c9                	test   %ecx,%ecx
+  800aab:	74 2c                	je     800ad9 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800aad:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ab0:	8b 10                	mov    (%eax),%edx
+  800ab2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ab7:	8d 40 04             	lea    0x4(%eax),%eax
+  800aba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800abd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800ac2:	eb be                	jmp    800a82 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800ac4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac7:	8b 10                	mov    (%eax),%edx
+  800ac9:	8b 48 04             	mov    0x4(%eax),%ecx
+  800acc:	8d 40 08             	lea    0x8(%eax),%eax
+  800acf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ad2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800ad7:	eb a9                	jmp    800a82 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800ad9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800adc:	8b 10                	mov    (%eax),%edx
+  800ade:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ae3:	8d 40 04             	lea    0x4(%eax),%eax
+  800ae6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ae9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800aee:	eb 92                	jmp    800a82 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800af0:	83 ec 08             	sub    $0x8,%esp
+  800af3:	53                   	push   %ebx
+  800af4:	6a 25                	push   $0x25
+  800af6:	ff d6                	call   *%esi
+			break;
+  800af8:	83 c4 10             	add    $0x10,%esp
+  800afb:	eb 9f                	jmp    800a9c <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800afd:	83 ec 08             	sub    $0x8,%esp
+  800b00:	53                   	push   %ebx
+  800b01:	6a 25                	push   $0x25
+  800b03:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b05:	83 c4 10             	add    $0x10,%esp
+  800b08:	89 f8                	mov    %edi,%eax
+  800b0a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b0e:	74 05                	je     800b15 <vprintfmt+0x44f>
+  800b10:	83 e8 01             	sub    $0x1,%eax
+  800b13:	eb f5                	jmp    800b0a <vprintfmt+0x444>
+  800b15:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b18:	eb 82                	jmp    800a9c <vprintfmt+0x3d6>
+
+00800b1a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b1a:	55                   	push   %ebp
+  800b1b:	89 e5                	mov    %esp,%ebp
+  800b1d:	83 ec 18             	sub    $0x18,%esp
+  800b20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b23:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b26:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b29:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b2d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b30:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b37:	85 c0                	test   %eax,%eax
+  800b39:	74 26                	je     800b61 <vsnprintf+0x47>
+  800b3b:	85 d2                	test   %edx,%edx
+  800b3d:	7e 22                	jle    800b61 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b3f:	ff 75 14             	push   0x14(%ebp)
+  800b42:	ff 75 10             	push   0x10(%ebp)
+  800b45:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b48:	50                   	push   %eax
+  800b49:	68 8c 06 80 00       	push   $0x80068c
+  800b4e:	e8 73 fb ff ff       	call   8006c6 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b53:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b56:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b5c:	83 c4 10             	add    $0x10,%esp
+}
+  800b5f:	c9                   	leave
+  800b60:	c3                   	ret
+		return -E_INVAL;
+  800b61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b66:	eb f7                	jmp    800b5f <vsnprintf+0x45>
+
+00800b68 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b68:	55                   	push   %ebp
+  800b69:	89 e5                	mov    %esp,%ebp
+  800b6b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b6e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b71:	50                   	push   %eax
+  800b72:	ff 75 10             	push   0x10(%ebp)
+  800b75:	ff 75 0c             	push   0xc(%ebp)
+  800b78:	ff 75 08             	push   0x8(%ebp)
+  800b7b:	e8 9a ff ff ff       	call   800b1a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b80:	c9                   	leave
+  800b81:	c3                   	ret
+
+00800b82 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b8d:	eb 03                	jmp    800b92 <strlen+0x10>
+		n++;
+  800b8f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b92:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b96:	75 f7                	jne    800b8f <strlen+0xd>
+	return n;
+}
+  800b98:	5d                   	pop    %ebp
+  800b99:	c3                   	ret
+
+00800b9a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b9a:	55                   	push   %ebp
+  800b9b:	89 e5                	mov    %esp,%ebp
+  800b9d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ba0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba8:	eb 03                	jmp    800bad <strnlen+0x13>
+		n++;
+  800baa:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bad:	39 d0                	cmp    %edx,%eax
+  800baf:	74 08                	je     800bb9 <strnlen+0x1f>
+  800bb1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bb5:	75 f3                	jne    800baa <strnlen+0x10>
+  800bb7:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800bb9:	89 d0                	mov    %edx,%eax
+  800bbb:	5d                   	pop    %ebp
+  800bbc:	c3                   	ret
+
+00800bbd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800bbd:	55                   	push   %ebp
+  800bbe:	89 e5                	mov    %esp,%ebp
+  800bc0:	53                   	push   %ebx
+  800bc1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bc4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bcc:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bd0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bd3:	83 c0 01             	add    $0x1,%eax
+  800bd6:	84 d2                	test   %dl,%dl
+  800bd8:	75 f2                	jne    800bcc <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800bda:	89 c8                	mov    %ecx,%eax
+  800bdc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bdf:	c9                   	leave
+  800be0:	c3                   	ret
+
+00800be1 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800be1:	55                   	push   %ebp
+  800be2:	89 e5                	mov    %esp,%ebp
+  800be4:	53                   	push   %ebx
+  800be5:	83 ec 10             	sub    $0x10,%esp
+  800be8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800beb:	53                   	push   %ebx
+  800bec:	e8 91 ff ff ff       	call   800b82 <strlen>
+  800bf1:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800bf4:	ff 75 0c             	push   0xc(%ebp)
+  800bf7:	01 d8                	add    %ebx,%eax
+  800bf9:	50                   	push   %eax
+  800bfa:	e8 be ff ff ff       	call   800bbd <strcpy>
+	return dst;
+}
+  800bff:	89 d8                	mov    %ebx,%eax
+  800c01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c04:	c9                   	leave
+  800c05:	c3                   	ret
+
+00800c06 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c06:	55                   	push   %ebp
+  800c07:	89 e5                	mov    %esp,%ebp
+  800c09:	56                   	push   %esi
+  800c0a:	53                   	push   %ebx
+  800c0b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c11:	89 f3                	mov    %esi,%ebx
+  800c13:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c16:	89 f0                	mov    %esi,%eax
+  800c18:	eb 0f                	jmp    800c29 <strncpy+0x23>
+		*dst++ = *src;
+  800c1a:	83 c0 01             	add    $0x1,%eax
+  800c1d:	0f b6 0a             	movzbl (%edx),%ecx
+  800c20:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c23:	80 f9 01             	cmp    $0x1,%cl
+  800c26:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c29:	39 d8                	cmp    %ebx,%eax
+  800c2b:	75 ed                	jne    800c1a <strncpy+0x14>
+	}
+	return ret;
+}
+  800c2d:	89 f0                	mov    %esi,%eax
+  800c2f:	5b                   	pop    %ebx
+  800c30:	5e                   	pop    %esi
+  800c31:	5d                   	pop    %ebp
+  800c32:	c3                   	ret
+
+00800c33 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c33:	55                   	push   %ebp
+  800c34:	89 e5                	mov    %esp,%ebp
+  800c36:	56                   	push   %esi
+  800c37:	53                   	push   %ebx
+  800c38:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c41:	89 f0                	mov    %esi,%eax
+  800c43:	85 d2                	test   %edx,%edx
+  800c45:	74 21                	je     800c68 <strlcpy+0x35>
+  800c47:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c4b:	89 f2                	mov    %esi,%edx
+  800c4d:	eb 09                	jmp    800c58 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c4f:	83 c1 01             	add    $0x1,%ecx
+  800c52:	83 c2 01             	add    $0x1,%edx
+  800c55:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c58:	39 c2                	cmp    %eax,%edx
+  800c5a:	74 09                	je     800c65 <strlcpy+0x32>
+  800c5c:	0f b6 19             	movzbl (%ecx),%ebx
+  800c5f:	84 db                	test   %bl,%bl
+  800c61:	75 ec                	jne    800c4f <strlcpy+0x1c>
+  800c63:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c65:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c68:	29 f0                	sub    %esi,%eax
+}
+  800c6a:	5b                   	pop    %ebx
+  800c6b:	5e                   	pop    %esi
+  800c6c:	5d                   	pop    %ebp
+  800c6d:	c3                   	ret
+
+00800c6e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c6e:	55                   	push   %ebp
+  800c6f:	89 e5                	mov    %esp,%ebp
+  800c71:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c74:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c77:	eb 06                	jmp    800c7f <strcmp+0x11>
+		p++, q++;
+  800c79:	83 c1 01             	add    $0x1,%ecx
+  800c7c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c7f:	0f b6 01             	movzbl (%ecx),%eax
+  800c82:	84 c0                	test   %al,%al
+  800c84:	74 04                	je     800c8a <strcmp+0x1c>
+  800c86:	3a 02                	cmp    (%edx),%al
+  800c88:	74 ef                	je     800c79 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c8a:	0f b6 c0             	movzbl %al,%eax
+  800c8d:	0f b6 12             	movzbl (%edx),%edx
+  800c90:	29 d0                	sub    %edx,%eax
+}
+  800c92:	5d                   	pop    %ebp
+  800c93:	c3                   	ret
+
+00800c94 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c94:	55                   	push   %ebp
+  800c95:	89 e5                	mov    %esp,%ebp
+  800c97:	53                   	push   %ebx
+  800c98:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9e:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800ca1:	eb 09                	jmp    800cac <strncmp+0x18>
+		n--, p++, q++;
+  800ca3:	83 ea 01             	sub    $0x1,%edx
+  800ca6:	83 c0 01             	add    $0x1,%eax
+  800ca9:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800cac:	85 d2                	test   %edx,%edx
+  800cae:	74 18                	je     800cc8 <strncmp+0x34>
+  800cb0:	0f b6 18             	movzbl (%eax),%ebx
+  800cb3:	84 db                	test   %bl,%bl
+  800cb5:	74 04                	je     800cbb <strncmp+0x27>
+  800cb7:	3a 19                	cmp    (%ecx),%bl
+  800cb9:	74 e8                	je     800ca3 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cbb:	0f b6 00             	movzbl (%eax),%eax
+  800cbe:	0f b6 11             	movzbl (%ecx),%edx
+  800cc1:	29 d0                	sub    %edx,%eax
+}
+  800cc3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cc6:	c9                   	leave
+  800cc7:	c3                   	ret
+		return 0;
+  800cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccd:	eb f4                	jmp    800cc3 <strncmp+0x2f>
+
+00800ccf <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ccf:	55                   	push   %ebp
+  800cd0:	89 e5                	mov    %esp,%ebp
+  800cd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cd9:	eb 03                	jmp    800cde <strchr+0xf>
+  800cdb:	83 c0 01             	add    $0x1,%eax
+  800cde:	0f b6 10             	movzbl (%eax),%edx
+  800ce1:	84 d2                	test   %dl,%dl
+  800ce3:	74 06                	je     800ceb <strchr+0x1c>
+		if (*s == c)
+  800ce5:	38 ca                	cmp    %cl,%dl
+  800ce7:	75 f2                	jne    800cdb <strchr+0xc>
+  800ce9:	eb 05                	jmp    800cf0 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cf0:	5d                   	pop    %ebp
+  800cf1:	c3                   	ret
+
+00800cf2 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cf2:	55                   	push   %ebp
+  800cf3:	89 e5                	mov    %esp,%ebp
+  800cf5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cfc:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cff:	38 ca                	cmp    %cl,%dl
+  800d01:	74 09                	je     800d0c <strfind+0x1a>
+  800d03:	84 d2                	test   %dl,%dl
+  800d05:	74 05                	je     800d0c <strfind+0x1a>
+	for (; *s; s++)
+  800d07:	83 c0 01             	add    $0x1,%eax
+  800d0a:	eb f0                	jmp    800cfc <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800d0c:	5d                   	pop    %ebp
+  800d0d:	c3                   	ret
+
+00800d0e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d0e:	55                   	push   %ebp
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	57                   	push   %edi
+  800d12:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d15:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d18:	85 c9                	test   %ecx,%ecx
+  800d1a:	74 20                	je     800d3c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d1c:	89 f8                	mov    %edi,%eax
+  800d1e:	09 c8                	or     %ecx,%eax
+  800d20:	a8 03                	test   $0x3,%al
+  800d22:	75 12                	jne    800d36 <memset+0x28>
+		c &= 0xFF;
+  800d24:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d28:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d2e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d31:	fc                   	cld
+  800d32:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d34:	eb 06                	jmp    800d3c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d36:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d39:	fc                   	cld
+  800d3a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d3c:	89 f8                	mov    %edi,%eax
+  800d3e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d41:	c9                   	leave
+  800d42:	c3                   	ret
+
+00800d43 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d43:	55                   	push   %ebp
+  800d44:	89 e5                	mov    %esp,%ebp
+  800d46:	57                   	push   %edi
+  800d47:	56                   	push   %esi
+  800d48:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d4b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d4e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d51:	39 c6                	cmp    %eax,%esi
+  800d53:	73 32                	jae    800d87 <memmove+0x44>
+  800d55:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d58:	39 d0                	cmp    %edx,%eax
+  800d5a:	73 2b                	jae    800d87 <memmove+0x44>
+		s += n;
+		d += n;
+  800d5c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d5f:	89 d6                	mov    %edx,%esi
+  800d61:	09 fe                	or     %edi,%esi
+  800d63:	09 ce                	or     %ecx,%esi
+  800d65:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d6b:	75 0e                	jne    800d7b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d6d:	83 ef 04             	sub    $0x4,%edi
+  800d70:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d73:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d76:	fd                   	std
+  800d77:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d79:	eb 09                	jmp    800d84 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d7b:	83 ef 01             	sub    $0x1,%edi
+  800d7e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d81:	fd                   	std
+  800d82:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d84:	fc                   	cld
+  800d85:	eb 1a                	jmp    800da1 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d87:	89 f2                	mov    %esi,%edx
+  800d89:	09 c2                	or     %eax,%edx
+  800d8b:	09 ca                	or     %ecx,%edx
+  800d8d:	f6 c2 03             	test   $0x3,%dl
+  800d90:	75 0a                	jne    800d9c <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d92:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d95:	89 c7                	mov    %eax,%edi
+  800d97:	fc                   	cld
+  800d98:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d9a:	eb 05                	jmp    800da1 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d9c:	89 c7                	mov    %eax,%edi
+  800d9e:	fc                   	cld
+  800d9f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800da1:	5e                   	pop    %esi
+  800da2:	5f                   	pop    %edi
+  800da3:	5d                   	pop    %ebp
+  800da4:	c3                   	ret
+
+00800da5 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800da5:	55                   	push   %ebp
+  800da6:	89 e5                	mov    %esp,%ebp
+  800da8:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800dab:	ff 75 10             	push   0x10(%ebp)
+  800dae:	ff 75 0c             	push   0xc(%ebp)
+  800db1:	ff 75 08             	push   0x8(%ebp)
+  800db4:	e8 8a ff ff ff       	call   800d43 <memmove>
+}
+  800db9:	c9                   	leave
+  800dba:	c3                   	ret
+
+00800dbb <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800dbb:	55                   	push   %ebp
+  800dbc:	89 e5                	mov    %esp,%ebp
+  800dbe:	56                   	push   %esi
+  800dbf:	53                   	push   %ebx
+  800dc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800dc6:	89 c6                	mov    %eax,%esi
+  800dc8:	03 75 10             	add    0x10(%ebp),%esi
+  800dcb:	eb 06                	jmp    800dd3 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800dcd:	83 c0 01             	add    $0x1,%eax
+  800dd0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800dd3:	39 f0                	cmp    %esi,%eax
+  800dd5:	74 14                	je     800deb <memcmp+0x30>
+		if (*s1 != *s2)
+  800dd7:	0f b6 08             	movzbl (%eax),%ecx
+  800dda:	0f b6 1a             	movzbl (%edx),%ebx
+  800ddd:	38 d9                	cmp    %bl,%cl
+  800ddf:	74 ec                	je     800dcd <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800de1:	0f b6 c1             	movzbl %cl,%eax
+  800de4:	0f b6 db             	movzbl %bl,%ebx
+  800de7:	29 d8                	sub    %ebx,%eax
+  800de9:	eb 05                	jmp    800df0 <memcmp+0x35>
+	}
+
+	return 0;
+  800deb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800df0:	5b                   	pop    %ebx
+  800df1:	5e                   	pop    %esi
+  800df2:	5d                   	pop    %ebp
+  800df3:	c3                   	ret
+
+00800df4 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800dfd:	89 c2                	mov    %eax,%edx
+  800dff:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e02:	eb 03                	jmp    800e07 <memfind+0x13>
+  800e04:	83 c0 01             	add    $0x1,%eax
+  800e07:	39 d0                	cmp    %edx,%eax
+  800e09:	73 04                	jae    800e0f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e0b:	38 08                	cmp    %cl,(%eax)
+  800e0d:	75 f5                	jne    800e04 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800e0f:	5d                   	pop    %ebp
+  800e10:	c3                   	ret
+
+00800e11 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	57                   	push   %edi
+  800e15:	56                   	push   %esi
+  800e16:	53                   	push   %ebx
+  800e17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e1d:	eb 03                	jmp    800e22 <strtol+0x11>
+		s++;
+  800e1f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e22:	0f b6 02             	movzbl (%edx),%eax
+  800e25:	3c 20                	cmp    $0x20,%al
+  800e27:	74 f6                	je     800e1f <strtol+0xe>
+  800e29:	3c 09                	cmp    $0x9,%al
+  800e2b:	74 f2                	je     800e1f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e2d:	3c 2b                	cmp    $0x2b,%al
+  800e2f:	74 2a                	je     800e5b <strtol+0x4a>
+	int neg = 0;
+  800e31:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e36:	3c 2d                	cmp    $0x2d,%al
+  800e38:	74 2b                	je     800e65 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e3a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e40:	75 0f                	jne    800e51 <strtol+0x40>
+  800e42:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e45:	74 28                	je     800e6f <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e47:	85 db                	test   %ebx,%ebx
+  800e49:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e4e:	0f 44 d8             	cmove  %eax,%ebx
+  800e51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e56:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e59:	eb 46                	jmp    800ea1 <strtol+0x90>
+		s++;
+  800e5b:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e63:	eb d5                	jmp    800e3a <strtol+0x29>
+		s++, neg = 1;
+  800e65:	83 c2 01             	add    $0x1,%edx
+  800e68:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e6d:	eb cb                	jmp    800e3a <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e6f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e73:	74 0e                	je     800e83 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800e75:	85 db                	test   %ebx,%ebx
+  800e77:	75 d8                	jne    800e51 <strtol+0x40>
+		s++, base = 8;
+  800e79:	83 c2 01             	add    $0x1,%edx
+  800e7c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e81:	eb ce                	jmp    800e51 <strtol+0x40>
+		s += 2, base = 16;
+  800e83:	83 c2 02             	add    $0x2,%edx
+  800e86:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e8b:	eb c4                	jmp    800e51 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e8d:	0f be c0             	movsbl %al,%eax
+  800e90:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e93:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e96:	7d 3a                	jge    800ed2 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800e98:	83 c2 01             	add    $0x1,%edx
+  800e9b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e9f:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ea1:	0f b6 02             	movzbl (%edx),%eax
+  800ea4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ea7:	89 f3                	mov    %esi,%ebx
+  800ea9:	80 fb 09             	cmp    $0x9,%bl
+  800eac:	76 df                	jbe    800e8d <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800eae:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800eb1:	89 f3                	mov    %esi,%ebx
+  800eb3:	80 fb 19             	cmp    $0x19,%bl
+  800eb6:	77 08                	ja     800ec0 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800eb8:	0f be c0             	movsbl %al,%eax
+  800ebb:	83 e8 57             	sub    $0x57,%eax
+  800ebe:	eb d3                	jmp    800e93 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ec0:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ec3:	89 f3                	mov    %esi,%ebx
+  800ec5:	80 fb 19             	cmp    $0x19,%bl
+  800ec8:	77 08                	ja     800ed2 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800eca:	0f be c0             	movsbl %al,%eax
+  800ecd:	83 e8 37             	sub    $0x37,%eax
+  800ed0:	eb c1                	jmp    800e93 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ed2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ed6:	74 05                	je     800edd <strtol+0xcc>
+		*endptr = (char *) s;
+  800ed8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800edb:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800edd:	89 c8                	mov    %ecx,%eax
+  800edf:	f7 d8                	neg    %eax
+  800ee1:	85 ff                	test   %edi,%edi
+  800ee3:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ee6:	89 c8                	mov    %ecx,%eax
+  800ee8:	5b                   	pop    %ebx
+  800ee9:	5e                   	pop    %esi
+  800eea:	5f                   	pop    %edi
+  800eeb:	5d                   	pop    %ebp
+  800eec:	c3                   	ret
+
+00800eed <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800eed:	55                   	push   %ebp
+  800eee:	89 e5                	mov    %esp,%ebp
+  800ef0:	57                   	push   %edi
+  800ef1:	56                   	push   %esi
+  800ef2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ef8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efe:	89 c3                	mov    %eax,%ebx
+  800f00:	89 c7                	mov    %eax,%edi
+  800f02:	55                   	push   %ebp
+  800f03:	89 e5                	mov    %esp,%ebp
+  800f05:	8d 35 0d 0f 80 00    	lea    0x800f0d,%esi
+  800f0b:	0f 34                	sysenter
+  800f0d:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800f0e:	5b                   	pop    %ebx
+  800f0f:	5e                   	pop    %esi
+  800f10:	5f                   	pop    %edi
+  800f11:	5d                   	pop    %ebp
+  800f12:	c3                   	ret
+
+00800f13 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	56                   	push   %esi
+  800f18:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f19:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f1e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f23:	89 d1                	mov    %edx,%ecx
+  800f25:	89 d3                	mov    %edx,%ebx
+  800f27:	89 d7                	mov    %edx,%edi
+  800f29:	55                   	push   %ebp
+  800f2a:	89 e5                	mov    %esp,%ebp
+  800f2c:	8d 35 34 0f 80 00    	lea    0x800f34,%esi
+  800f32:	0f 34                	sysenter
+  800f34:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800f35:	5b                   	pop    %ebx
+  800f36:	5e                   	pop    %esi
+  800f37:	5f                   	pop    %edi
+  800f38:	5d                   	pop    %ebp
+  800f39:	c3                   	ret
+
+00800f3a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f3a:	55                   	push   %ebp
+  800f3b:	89 e5                	mov    %esp,%ebp
+  800f3d:	57                   	push   %edi
+  800f3e:	56                   	push   %esi
+  800f3f:	53                   	push   %ebx
+  800f40:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f43:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f50:	89 cb                	mov    %ecx,%ebx
+  800f52:	89 cf                	mov    %ecx,%edi
+  800f54:	55                   	push   %ebp
+  800f55:	89 e5                	mov    %esp,%ebp
+  800f57:	8d 35 5f 0f 80 00    	lea    0x800f5f,%esi
+  800f5d:	0f 34                	sysenter
+  800f5f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f60:	85 c0                	test   %eax,%eax
+  800f62:	7f 08                	jg     800f6c <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800f64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f67:	5b                   	pop    %ebx
+  800f68:	5e                   	pop    %esi
+  800f69:	5f                   	pop    %edi
+  800f6a:	5d                   	pop    %ebp
+  800f6b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6c:	83 ec 0c             	sub    $0xc,%esp
+  800f6f:	50                   	push   %eax
+  800f70:	6a 03                	push   $0x3
+  800f72:	68 27 40 80 00       	push   $0x804027
+  800f77:	6a 3d                	push   $0x3d
+  800f79:	68 44 40 80 00       	push   $0x804044
+  800f7e:	e8 02 24 00 00       	call   803385 <_panic>
+
+00800f83 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	57                   	push   %edi
+  800f87:	56                   	push   %esi
+  800f88:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f8e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f93:	89 d1                	mov    %edx,%ecx
+  800f95:	89 d3                	mov    %edx,%ebx
+  800f97:	89 d7                	mov    %edx,%edi
+  800f99:	55                   	push   %ebp
+  800f9a:	89 e5                	mov    %esp,%ebp
+  800f9c:	8d 35 a4 0f 80 00    	lea    0x800fa4,%esi
+  800fa2:	0f 34                	sysenter
+  800fa4:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800fa5:	5b                   	pop    %ebx
+  800fa6:	5e                   	pop    %esi
+  800fa7:	5f                   	pop    %edi
+  800fa8:	5d                   	pop    %ebp
+  800fa9:	c3                   	ret
+
+00800faa <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800faa:	55                   	push   %ebp
+  800fab:	89 e5                	mov    %esp,%ebp
+  800fad:	57                   	push   %edi
+  800fae:	56                   	push   %esi
+  800faf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800fba:	89 d1                	mov    %edx,%ecx
+  800fbc:	89 d3                	mov    %edx,%ebx
+  800fbe:	89 d7                	mov    %edx,%edi
+  800fc0:	89 d6                	mov    %edx,%esi
+  800fc2:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800fc4:	5b                   	pop    %ebx
+  800fc5:	5e                   	pop    %esi
+  800fc6:	5f                   	pop    %edi
+  800fc7:	5d                   	pop    %ebp
+  800fc8:	c3                   	ret
+
+00800fc9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800fc9:	55                   	push   %ebp
+  800fca:	89 e5                	mov    %esp,%ebp
+  800fcc:	57                   	push   %edi
+  800fcd:	56                   	push   %esi
+  800fce:	53                   	push   %ebx
+  800fcf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800fd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fdd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fe2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe5:	55                   	push   %ebp
+  800fe6:	89 e5                	mov    %esp,%ebp
+  800fe8:	8d 35 f0 0f 80 00    	lea    0x800ff0,%esi
+  800fee:	0f 34                	sysenter
+  800ff0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ff1:	85 c0                	test   %eax,%eax
+  800ff3:	7f 08                	jg     800ffd <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800ff5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff8:	5b                   	pop    %ebx
+  800ff9:	5e                   	pop    %esi
+  800ffa:	5f                   	pop    %edi
+  800ffb:	5d                   	pop    %ebp
+  800ffc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ffd:	83 ec 0c             	sub    $0xc,%esp
+  801000:	50                   	push   %eax
+  801001:	6a 04                	push   $0x4
+  801003:	68 27 40 80 00       	push   $0x804027
+  801008:	6a 3d                	push   $0x3d
+  80100a:	68 44 40 80 00       	push   $0x804044
+  80100f:	e8 71 23 00 00       	call   803385 <_panic>
+
+00801014 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801014:	55                   	push   %ebp
+  801015:	89 e5                	mov    %esp,%ebp
+  801017:	57                   	push   %edi
+  801018:	56                   	push   %esi
+  801019:	53                   	push   %ebx
+  80101a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80101d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801020:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801023:	b8 05 00 00 00       	mov    $0x5,%eax
+  801028:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80102b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80102e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801031:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801033:	85 c0                	test   %eax,%eax
+  801035:	7f 08                	jg     80103f <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801037:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103a:	5b                   	pop    %ebx
+  80103b:	5e                   	pop    %esi
+  80103c:	5f                   	pop    %edi
+  80103d:	5d                   	pop    %ebp
+  80103e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80103f:	83 ec 0c             	sub    $0xc,%esp
+  801042:	50                   	push   %eax
+  801043:	6a 05                	push   $0x5
+  801045:	68 27 40 80 00       	push   $0x804027
+  80104a:	6a 23                	push   $0x23
+  80104c:	68 44 40 80 00       	push   $0x804044
+  801051:	e8 2f 23 00 00       	call   803385 <_panic>
+
+00801056 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801056:	55                   	push   %ebp
+  801057:	89 e5                	mov    %esp,%ebp
+  801059:	57                   	push   %edi
+  80105a:	56                   	push   %esi
+  80105b:	53                   	push   %ebx
+  80105c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80105f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801064:	8b 55 08             	mov    0x8(%ebp),%edx
+  801067:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80106f:	89 df                	mov    %ebx,%edi
+  801071:	55                   	push   %ebp
+  801072:	89 e5                	mov    %esp,%ebp
+  801074:	8d 35 7c 10 80 00    	lea    0x80107c,%esi
+  80107a:	0f 34                	sysenter
+  80107c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80107d:	85 c0                	test   %eax,%eax
+  80107f:	7f 08                	jg     801089 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  801081:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801084:	5b                   	pop    %ebx
+  801085:	5e                   	pop    %esi
+  801086:	5f                   	pop    %edi
+  801087:	5d                   	pop    %ebp
+  801088:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801089:	83 ec 0c             	sub    $0xc,%esp
+  80108c:	50                   	push   %eax
+  80108d:	6a 06                	push   $0x6
+  80108f:	68 27 40 80 00       	push   $0x804027
+  801094:	6a 3d                	push   $0x3d
+  801096:	68 44 40 80 00       	push   $0x804044
+  80109b:	e8 e5 22 00 00       	call   803385 <_panic>
+
+008010a0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010a0:	55                   	push   %ebp
+  8010a1:	89 e5                	mov    %esp,%ebp
+  8010a3:	57                   	push   %edi
+  8010a4:	56                   	push   %esi
+  8010a5:	53                   	push   %ebx
+  8010a6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8010a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010b9:	89 df                	mov    %ebx,%edi
+  8010bb:	55                   	push   %ebp
+  8010bc:	89 e5                	mov    %esp,%ebp
+  8010be:	8d 35 c6 10 80 00    	lea    0x8010c6,%esi
+  8010c4:	0f 34                	sysenter
+  8010c6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010c7:	85 c0                	test   %eax,%eax
+  8010c9:	7f 08                	jg     8010d3 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  8010cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ce:	5b                   	pop    %ebx
+  8010cf:	5e                   	pop    %esi
+  8010d0:	5f                   	pop    %edi
+  8010d1:	5d                   	pop    %ebp
+  8010d2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d3:	83 ec 0c             	sub    $0xc,%esp
+  8010d6:	50                   	push   %eax
+  8010d7:	6a 08                	push   $0x8
+  8010d9:	68 27 40 80 00       	push   $0x804027
+  8010de:	6a 3d                	push   $0x3d
+  8010e0:	68 44 40 80 00       	push   $0x804044
+  8010e5:	e8 9b 22 00 00       	call   803385 <_panic>
+
+008010ea <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010ea:	55                   	push   %ebp
+  8010eb:	89 e5                	mov    %esp,%ebp
+  8010ed:	57                   	push   %edi
+  8010ee:	56                   	push   %esi
+  8010ef:	53                   	push   %ebx
+  8010f0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8010f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fe:	b8 09 00 00 00       	mov    $0x9,%eax
+  801103:	89 df                	mov    %ebx,%edi
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	8d 35 10 11 80 00    	lea    0x801110,%esi
+  80110e:	0f 34                	sysenter
+  801110:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801111:	85 c0                	test   %eax,%eax
+  801113:	7f 08                	jg     80111d <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  801115:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801118:	5b                   	pop    %ebx
+  801119:	5e                   	pop    %esi
+  80111a:	5f                   	pop    %edi
+  80111b:	5d                   	pop    %ebp
+  80111c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80111d:	83 ec 0c             	sub    $0xc,%esp
+  801120:	50                   	push   %eax
+  801121:	6a 09                	push   $0x9
+  801123:	68 27 40 80 00       	push   $0x804027
+  801128:	6a 3d                	push   $0x3d
+  80112a:	68 44 40 80 00       	push   $0x804044
+  80112f:	e8 51 22 00 00       	call   803385 <_panic>
+
+00801134 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801134:	55                   	push   %ebp
+  801135:	89 e5                	mov    %esp,%ebp
+  801137:	57                   	push   %edi
+  801138:	56                   	push   %esi
+  801139:	53                   	push   %ebx
+  80113a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80113d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801142:	8b 55 08             	mov    0x8(%ebp),%edx
+  801145:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801148:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80114d:	89 df                	mov    %ebx,%edi
+  80114f:	55                   	push   %ebp
+  801150:	89 e5                	mov    %esp,%ebp
+  801152:	8d 35 5a 11 80 00    	lea    0x80115a,%esi
+  801158:	0f 34                	sysenter
+  80115a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80115b:	85 c0                	test   %eax,%eax
+  80115d:	7f 08                	jg     801167 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  80115f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801162:	5b                   	pop    %ebx
+  801163:	5e                   	pop    %esi
+  801164:	5f                   	pop    %edi
+  801165:	5d                   	pop    %ebp
+  801166:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801167:	83 ec 0c             	sub    $0xc,%esp
+  80116a:	50                   	push   %eax
+  80116b:	6a 0a                	push   $0xa
+  80116d:	68 27 40 80 00       	push   $0x804027
+  801172:	6a 3d                	push   $0x3d
+  801174:	68 44 40 80 00       	push   $0x804044
+  801179:	e8 07 22 00 00       	call   803385 <_panic>
+
+0080117e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80117e:	55                   	push   %ebp
+  80117f:	89 e5                	mov    %esp,%ebp
+  801181:	57                   	push   %edi
+  801182:	56                   	push   %esi
+  801183:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801184:	8b 55 08             	mov    0x8(%ebp),%edx
+  801187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80118f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801192:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801195:	55                   	push   %ebp
+  801196:	89 e5                	mov    %esp,%ebp
+  801198:	8d 35 a0 11 80 00    	lea    0x8011a0,%esi
+  80119e:	0f 34                	sysenter
+  8011a0:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  8011a1:	5b                   	pop    %ebx
+  8011a2:	5e                   	pop    %esi
+  8011a3:	5f                   	pop    %edi
+  8011a4:	5d                   	pop    %ebp
+  8011a5:	c3                   	ret
+
+008011a6 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	57                   	push   %edi
+  8011aa:	56                   	push   %esi
+  8011ab:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b2:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ba:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011bd:	55                   	push   %ebp
+  8011be:	89 e5                	mov    %esp,%ebp
+  8011c0:	8d 35 c8 11 80 00    	lea    0x8011c8,%esi
+  8011c6:	0f 34                	sysenter
+  8011c8:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  8011c9:	5b                   	pop    %ebx
+  8011ca:	5e                   	pop    %esi
+  8011cb:	5f                   	pop    %edi
+  8011cc:	5d                   	pop    %ebp
+  8011cd:	c3                   	ret
+
+008011ce <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  8011ce:	55                   	push   %ebp
+  8011cf:	89 e5                	mov    %esp,%ebp
+  8011d1:	57                   	push   %edi
+  8011d2:	56                   	push   %esi
+  8011d3:	53                   	push   %ebx
+  8011d4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ea:	89 f7                	mov    %esi,%edi
+  8011ec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011ee:	85 c0                	test   %eax,%eax
+  8011f0:	7f 08                	jg     8011fa <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8011f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f5:	5b                   	pop    %ebx
+  8011f6:	5e                   	pop    %esi
+  8011f7:	5f                   	pop    %edi
+  8011f8:	5d                   	pop    %ebp
+  8011f9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011fa:	83 ec 0c             	sub    $0xc,%esp
+  8011fd:	50                   	push   %eax
+  8011fe:	6a 0d                	push   $0xd
+  801200:	68 27 40 80 00       	push   $0x804027
+  801205:	6a 23                	push   $0x23
+  801207:	68 44 40 80 00       	push   $0x804044
+  80120c:	e8 74 21 00 00       	call   803385 <_panic>
+
+00801211 <sys_ipc_recv>:
+{
+  801211:	55                   	push   %ebp
+  801212:	89 e5                	mov    %esp,%ebp
+  801214:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  801217:	6a 00                	push   $0x0
+  801219:	6a 01                	push   $0x1
+  80121b:	ff 75 08             	push   0x8(%ebp)
+  80121e:	e8 ab ff ff ff       	call   8011ce <sys_ipc_recvv>
+}
+  801223:	c9                   	leave
+  801224:	c3                   	ret
+
+00801225 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  801225:	55                   	push   %ebp
+  801226:	89 e5                	mov    %esp,%ebp
+  801228:	57                   	push   %edi
+  801229:	56                   	push   %esi
+  80122a:	53                   	push   %ebx
+  80122b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80122e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801233:	8b 55 08             	mov    0x8(%ebp),%edx
+  801236:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801239:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80123e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801241:	89 de                	mov    %ebx,%esi
+  801243:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801245:	85 c0                	test   %eax,%eax
+  801247:	7f 08                	jg     801251 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  801249:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124c:	5b                   	pop    %ebx
+  80124d:	5e                   	pop    %esi
+  80124e:	5f                   	pop    %edi
+  80124f:	5d                   	pop    %ebp
+  801250:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801251:	83 ec 0c             	sub    $0xc,%esp
+  801254:	50                   	push   %eax
+  801255:	6a 0d                	push   $0xd
+  801257:	68 27 40 80 00       	push   $0x804027
+  80125c:	6a 23                	push   $0x23
+  80125e:	68 44 40 80 00       	push   $0x804044
+  801263:	e8 1d 21 00 00       	call   803385 <_panic>
+
+00801268 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801268:	55                   	push   %ebp
+  801269:	89 e5                	mov    %esp,%ebp
+  80126b:	57                   	push   %edi
+  80126c:	56                   	push   %esi
+  80126d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80126e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801273:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801278:	89 d1                	mov    %edx,%ecx
+  80127a:	89 d3                	mov    %edx,%ebx
+  80127c:	89 d7                	mov    %edx,%edi
+  80127e:	55                   	push   %ebp
+  80127f:	89 e5                	mov    %esp,%ebp
+  801281:	8d 35 89 12 80 00    	lea    0x801289,%esi
+  801287:	0f 34                	sysenter
+  801289:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  80128a:	5b                   	pop    %ebx
+  80128b:	5e                   	pop    %esi
+  80128c:	5f                   	pop    %edi
+  80128d:	5d                   	pop    %ebp
+  80128e:	c3                   	ret
+
+0080128f <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  80128f:	55                   	push   %ebp
+  801290:	89 e5                	mov    %esp,%ebp
+  801292:	57                   	push   %edi
+  801293:	56                   	push   %esi
+  801294:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801295:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012a5:	89 df                	mov    %ebx,%edi
+  8012a7:	55                   	push   %ebp
+  8012a8:	89 e5                	mov    %esp,%ebp
+  8012aa:	8d 35 b2 12 80 00    	lea    0x8012b2,%esi
+  8012b0:	0f 34                	sysenter
+  8012b2:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  8012b3:	5b                   	pop    %ebx
+  8012b4:	5e                   	pop    %esi
+  8012b5:	5f                   	pop    %edi
+  8012b6:	5d                   	pop    %ebp
+  8012b7:	c3                   	ret
+
+008012b8 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  8012b8:	55                   	push   %ebp
+  8012b9:	89 e5                	mov    %esp,%ebp
+  8012bb:	57                   	push   %edi
+  8012bc:	56                   	push   %esi
+  8012bd:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c6:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012cb:	89 cb                	mov    %ecx,%ebx
+  8012cd:	89 cf                	mov    %ecx,%edi
+  8012cf:	55                   	push   %ebp
+  8012d0:	89 e5                	mov    %esp,%ebp
+  8012d2:	8d 35 da 12 80 00    	lea    0x8012da,%esi
+  8012d8:	0f 34                	sysenter
+  8012da:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  8012db:	5b                   	pop    %ebx
+  8012dc:	5e                   	pop    %esi
+  8012dd:	5f                   	pop    %edi
+  8012de:	5d                   	pop    %ebp
+  8012df:	c3                   	ret
+
+008012e0 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  8012e0:	55                   	push   %ebp
+  8012e1:	89 e5                	mov    %esp,%ebp
+  8012e3:	57                   	push   %edi
+  8012e4:	56                   	push   %esi
+  8012e5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012f6:	89 df                	mov    %ebx,%edi
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	8d 35 03 13 80 00    	lea    0x801303,%esi
+  801301:	0f 34                	sysenter
+  801303:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  801304:	5b                   	pop    %ebx
+  801305:	5e                   	pop    %esi
+  801306:	5f                   	pop    %edi
+  801307:	5d                   	pop    %ebp
+  801308:	c3                   	ret
+
+00801309 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  801309:	55                   	push   %ebp
+  80130a:	89 e5                	mov    %esp,%ebp
+  80130c:	57                   	push   %edi
+  80130d:	56                   	push   %esi
+  80130e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80130f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801314:	8b 55 08             	mov    0x8(%ebp),%edx
+  801317:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80131f:	89 df                	mov    %ebx,%edi
+  801321:	55                   	push   %ebp
+  801322:	89 e5                	mov    %esp,%ebp
+  801324:	8d 35 2c 13 80 00    	lea    0x80132c,%esi
+  80132a:	0f 34                	sysenter
+  80132c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  80132d:	5b                   	pop    %ebx
+  80132e:	5e                   	pop    %esi
+  80132f:	5f                   	pop    %edi
+  801330:	5d                   	pop    %ebp
+  801331:	c3                   	ret
+
+00801332 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  801332:	55                   	push   %ebp
+  801333:	89 e5                	mov    %esp,%ebp
+  801335:	57                   	push   %edi
+  801336:	56                   	push   %esi
+  801337:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801338:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801343:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801346:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801349:	55                   	push   %ebp
+  80134a:	89 e5                	mov    %esp,%ebp
+  80134c:	8d 35 54 13 80 00    	lea    0x801354,%esi
+  801352:	0f 34                	sysenter
+  801354:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  801355:	5b                   	pop    %ebx
+  801356:	5e                   	pop    %esi
+  801357:	5f                   	pop    %edi
+  801358:	5d                   	pop    %ebp
+  801359:	c3                   	ret
+
+0080135a <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  80135a:	55                   	push   %ebp
+  80135b:	89 e5                	mov    %esp,%ebp
+  80135d:	57                   	push   %edi
+  80135e:	56                   	push   %esi
+  80135f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801365:	8b 55 08             	mov    0x8(%ebp),%edx
+  801368:	b8 11 00 00 00       	mov    $0x11,%eax
+  80136d:	89 cb                	mov    %ecx,%ebx
+  80136f:	89 cf                	mov    %ecx,%edi
+  801371:	89 ce                	mov    %ecx,%esi
+  801373:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  801375:	5b                   	pop    %ebx
+  801376:	5e                   	pop    %esi
+  801377:	5f                   	pop    %edi
+  801378:	5d                   	pop    %ebp
+  801379:	c3                   	ret
+
+0080137a <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  80137a:	55                   	push   %ebp
+  80137b:	89 e5                	mov    %esp,%ebp
+  80137d:	57                   	push   %edi
+  80137e:	56                   	push   %esi
+  80137f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801380:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801385:	8b 55 08             	mov    0x8(%ebp),%edx
+  801388:	b8 15 00 00 00       	mov    $0x15,%eax
+  80138d:	89 cb                	mov    %ecx,%ebx
+  80138f:	89 cf                	mov    %ecx,%edi
+  801391:	55                   	push   %ebp
+  801392:	89 e5                	mov    %esp,%ebp
+  801394:	8d 35 9c 13 80 00    	lea    0x80139c,%esi
+  80139a:	0f 34                	sysenter
+  80139c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  80139d:	5b                   	pop    %ebx
+  80139e:	5e                   	pop    %esi
+  80139f:	5f                   	pop    %edi
+  8013a0:	5d                   	pop    %ebp
+  8013a1:	c3                   	ret
+
+008013a2 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8013a2:	55                   	push   %ebp
+  8013a3:	89 e5                	mov    %esp,%ebp
+  8013a5:	57                   	push   %edi
+  8013a6:	56                   	push   %esi
+  8013a7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8013a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b0:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013b5:	89 cb                	mov    %ecx,%ebx
+  8013b7:	89 cf                	mov    %ecx,%edi
+  8013b9:	55                   	push   %ebp
+  8013ba:	89 e5                	mov    %esp,%ebp
+  8013bc:	8d 35 c4 13 80 00    	lea    0x8013c4,%esi
+  8013c2:	0f 34                	sysenter
+  8013c4:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8013c5:	5b                   	pop    %ebx
+  8013c6:	5e                   	pop    %esi
+  8013c7:	5f                   	pop    %edi
+  8013c8:	5d                   	pop    %ebp
+  8013c9:	c3                   	ret
+
+008013ca <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8013ca:	55                   	push   %ebp
+  8013cb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013d0:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013d5:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013d8:	5d                   	pop    %ebp
+  8013d9:	c3                   	ret
+
+008013da <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013da:	55                   	push   %ebp
+  8013db:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013e0:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8013e5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8013ea:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013ef:	5d                   	pop    %ebp
+  8013f0:	c3                   	ret
+
+008013f1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013f1:	55                   	push   %ebp
+  8013f2:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8013f4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8013f9:	eb 02                	jmp    8013fd <fd_alloc+0xc>
+  8013fb:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013fd:	89 c2                	mov    %eax,%edx
+  8013ff:	c1 ea 16             	shr    $0x16,%edx
+  801402:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801409:	f6 c2 01             	test   $0x1,%dl
+  80140c:	74 2b                	je     801439 <fd_alloc+0x48>
+  80140e:	89 c2                	mov    %eax,%edx
+  801410:	c1 ea 0c             	shr    $0xc,%edx
+  801413:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80141a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801420:	f6 c1 01             	test   $0x1,%cl
+  801423:	74 14                	je     801439 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801425:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80142b:	75 ce                	jne    8013fb <fd_alloc+0xa>
+  80142d:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801432:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801437:	eb 05                	jmp    80143e <fd_alloc+0x4d>
+			return 0;
+  801439:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80143e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801441:	89 02                	mov    %eax,(%edx)
+}
+  801443:	89 c8                	mov    %ecx,%eax
+  801445:	5d                   	pop    %ebp
+  801446:	c3                   	ret
+
+00801447 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801447:	55                   	push   %ebp
+  801448:	89 e5                	mov    %esp,%ebp
+  80144a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80144d:	83 f8 1f             	cmp    $0x1f,%eax
+  801450:	77 30                	ja     801482 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801452:	c1 e0 0c             	shl    $0xc,%eax
+  801455:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80145a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801460:	f6 c2 01             	test   $0x1,%dl
+  801463:	74 24                	je     801489 <fd_lookup+0x42>
+  801465:	89 c2                	mov    %eax,%edx
+  801467:	c1 ea 0c             	shr    $0xc,%edx
+  80146a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801471:	f6 c2 01             	test   $0x1,%dl
+  801474:	74 1a                	je     801490 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801476:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801479:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80147b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801480:	5d                   	pop    %ebp
+  801481:	c3                   	ret
+		return -E_INVAL;
+  801482:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801487:	eb f7                	jmp    801480 <fd_lookup+0x39>
+		return -E_INVAL;
+  801489:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80148e:	eb f0                	jmp    801480 <fd_lookup+0x39>
+  801490:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801495:	eb e9                	jmp    801480 <fd_lookup+0x39>
+
+00801497 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801497:	55                   	push   %ebp
+  801498:	89 e5                	mov    %esp,%ebp
+  80149a:	53                   	push   %ebx
+  80149b:	83 ec 04             	sub    $0x4,%esp
+  80149e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8014a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a6:	eb 03                	jmp    8014ab <dev_lookup+0x14>
+  8014a8:	83 c0 01             	add    $0x1,%eax
+  8014ab:	8b 1c 85 d0 40 80 00 	mov    0x8040d0(,%eax,4),%ebx
+  8014b2:	85 db                	test   %ebx,%ebx
+  8014b4:	74 0b                	je     8014c1 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8014b6:	39 13                	cmp    %edx,(%ebx)
+  8014b8:	75 ee                	jne    8014a8 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8014ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014bf:	eb 1f                	jmp    8014e0 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8014c1:	a1 10 60 80 00       	mov    0x806010,%eax
+  8014c6:	8b 40 48             	mov    0x48(%eax),%eax
+  8014c9:	83 ec 04             	sub    $0x4,%esp
+  8014cc:	52                   	push   %edx
+  8014cd:	50                   	push   %eax
+  8014ce:	68 54 40 80 00       	push   $0x804054
+  8014d3:	e8 f7 f0 ff ff       	call   8005cf <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8014d8:	83 c4 10             	add    $0x10,%esp
+  8014db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8014e0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014e3:	89 1a                	mov    %ebx,(%edx)
+}
+  8014e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014e8:	c9                   	leave
+  8014e9:	c3                   	ret
+
+008014ea <fd_close>:
+{
+  8014ea:	55                   	push   %ebp
+  8014eb:	89 e5                	mov    %esp,%ebp
+  8014ed:	57                   	push   %edi
+  8014ee:	56                   	push   %esi
+  8014ef:	53                   	push   %ebx
+  8014f0:	83 ec 24             	sub    $0x24,%esp
+  8014f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014f6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014f9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014fc:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014fd:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801503:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801506:	50                   	push   %eax
+  801507:	e8 3b ff ff ff       	call   801447 <fd_lookup>
+  80150c:	89 c3                	mov    %eax,%ebx
+  80150e:	83 c4 10             	add    $0x10,%esp
+  801511:	85 c0                	test   %eax,%eax
+  801513:	78 05                	js     80151a <fd_close+0x30>
+	    || fd != fd2)
+  801515:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801518:	74 16                	je     801530 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80151a:	89 f8                	mov    %edi,%eax
+  80151c:	84 c0                	test   %al,%al
+  80151e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801523:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801526:	89 d8                	mov    %ebx,%eax
+  801528:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80152b:	5b                   	pop    %ebx
+  80152c:	5e                   	pop    %esi
+  80152d:	5f                   	pop    %edi
+  80152e:	5d                   	pop    %ebp
+  80152f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801530:	83 ec 08             	sub    $0x8,%esp
+  801533:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801536:	50                   	push   %eax
+  801537:	ff 36                	push   (%esi)
+  801539:	e8 59 ff ff ff       	call   801497 <dev_lookup>
+  80153e:	89 c3                	mov    %eax,%ebx
+  801540:	83 c4 10             	add    $0x10,%esp
+  801543:	85 c0                	test   %eax,%eax
+  801545:	78 1a                	js     801561 <fd_close+0x77>
+		if (dev->dev_close)
+  801547:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80154a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80154d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801552:	85 c0                	test   %eax,%eax
+  801554:	74 0b                	je     801561 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801556:	83 ec 0c             	sub    $0xc,%esp
+  801559:	56                   	push   %esi
+  80155a:	ff d0                	call   *%eax
+  80155c:	89 c3                	mov    %eax,%ebx
+  80155e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801561:	83 ec 08             	sub    $0x8,%esp
+  801564:	56                   	push   %esi
+  801565:	6a 00                	push   $0x0
+  801567:	e8 ea fa ff ff       	call   801056 <sys_page_unmap>
+	return r;
+  80156c:	83 c4 10             	add    $0x10,%esp
+  80156f:	eb b5                	jmp    801526 <fd_close+0x3c>
+
+00801571 <close>:
+
+int
+close(int fdnum)
+{
+  801571:	55                   	push   %ebp
+  801572:	89 e5                	mov    %esp,%ebp
+  801574:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801577:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80157a:	50                   	push   %eax
+  80157b:	ff 75 08             	push   0x8(%ebp)
+  80157e:	e8 c4 fe ff ff       	call   801447 <fd_lookup>
+  801583:	83 c4 10             	add    $0x10,%esp
+  801586:	85 c0                	test   %eax,%eax
+  801588:	79 02                	jns    80158c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80158a:	c9                   	leave
+  80158b:	c3                   	ret
+		return fd_close(fd, 1);
+  80158c:	83 ec 08             	sub    $0x8,%esp
+  80158f:	6a 01                	push   $0x1
+  801591:	ff 75 f4             	push   -0xc(%ebp)
+  801594:	e8 51 ff ff ff       	call   8014ea <fd_close>
+  801599:	83 c4 10             	add    $0x10,%esp
+  80159c:	eb ec                	jmp    80158a <close+0x19>
+
+0080159e <close_all>:
+
+void
+close_all(void)
+{
+  80159e:	55                   	push   %ebp
+  80159f:	89 e5                	mov    %esp,%ebp
+  8015a1:	53                   	push   %ebx
+  8015a2:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8015a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8015aa:	83 ec 0c             	sub    $0xc,%esp
+  8015ad:	53                   	push   %ebx
+  8015ae:	e8 be ff ff ff       	call   801571 <close>
+	for (i = 0; i < MAXFD; i++)
+  8015b3:	83 c3 01             	add    $0x1,%ebx
+  8015b6:	83 c4 10             	add    $0x10,%esp
+  8015b9:	83 fb 20             	cmp    $0x20,%ebx
+  8015bc:	75 ec                	jne    8015aa <close_all+0xc>
+}
+  8015be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015c1:	c9                   	leave
+  8015c2:	c3                   	ret
+
+008015c3 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8015c3:	55                   	push   %ebp
+  8015c4:	89 e5                	mov    %esp,%ebp
+  8015c6:	57                   	push   %edi
+  8015c7:	56                   	push   %esi
+  8015c8:	53                   	push   %ebx
+  8015c9:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8015cc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015cf:	50                   	push   %eax
+  8015d0:	ff 75 08             	push   0x8(%ebp)
+  8015d3:	e8 6f fe ff ff       	call   801447 <fd_lookup>
+  8015d8:	89 c3                	mov    %eax,%ebx
+  8015da:	83 c4 10             	add    $0x10,%esp
+  8015dd:	85 c0                	test   %eax,%eax
+  8015df:	78 7f                	js     801660 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8015e1:	83 ec 0c             	sub    $0xc,%esp
+  8015e4:	ff 75 0c             	push   0xc(%ebp)
+  8015e7:	e8 85 ff ff ff       	call   801571 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8015ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8015ef:	c1 e6 0c             	shl    $0xc,%esi
+  8015f2:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8015f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015fb:	89 3c 24             	mov    %edi,(%esp)
+  8015fe:	e8 d7 fd ff ff       	call   8013da <fd2data>
+  801603:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801605:	89 34 24             	mov    %esi,(%esp)
+  801608:	e8 cd fd ff ff       	call   8013da <fd2data>
+  80160d:	83 c4 10             	add    $0x10,%esp
+  801610:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801613:	89 d8                	mov    %ebx,%eax
+  801615:	c1 e8 16             	shr    $0x16,%eax
+  801618:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80161f:	a8 01                	test   $0x1,%al
+  801621:	74 11                	je     801634 <dup+0x71>
+  801623:	89 d8                	mov    %ebx,%eax
+  801625:	c1 e8 0c             	shr    $0xc,%eax
+  801628:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80162f:	f6 c2 01             	test   $0x1,%dl
+  801632:	75 36                	jne    80166a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801634:	89 f8                	mov    %edi,%eax
+  801636:	c1 e8 0c             	shr    $0xc,%eax
+  801639:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801640:	83 ec 0c             	sub    $0xc,%esp
+  801643:	25 07 0e 00 00       	and    $0xe07,%eax
+  801648:	50                   	push   %eax
+  801649:	56                   	push   %esi
+  80164a:	6a 00                	push   $0x0
+  80164c:	57                   	push   %edi
+  80164d:	6a 00                	push   $0x0
+  80164f:	e8 c0 f9 ff ff       	call   801014 <sys_page_map>
+  801654:	89 c3                	mov    %eax,%ebx
+  801656:	83 c4 20             	add    $0x20,%esp
+  801659:	85 c0                	test   %eax,%eax
+  80165b:	78 33                	js     801690 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80165d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801660:	89 d8                	mov    %ebx,%eax
+  801662:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801665:	5b                   	pop    %ebx
+  801666:	5e                   	pop    %esi
+  801667:	5f                   	pop    %edi
+  801668:	5d                   	pop    %ebp
+  801669:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80166a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801671:	83 ec 0c             	sub    $0xc,%esp
+  801674:	25 07 0e 00 00       	and    $0xe07,%eax
+  801679:	50                   	push   %eax
+  80167a:	ff 75 d4             	push   -0x2c(%ebp)
+  80167d:	6a 00                	push   $0x0
+  80167f:	53                   	push   %ebx
+  801680:	6a 00                	push   $0x0
+  801682:	e8 8d f9 ff ff       	call   801014 <sys_page_map>
+  801687:	89 c3                	mov    %eax,%ebx
+  801689:	83 c4 20             	add    $0x20,%esp
+  80168c:	85 c0                	test   %eax,%eax
+  80168e:	79 a4                	jns    801634 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801690:	83 ec 08             	sub    $0x8,%esp
+  801693:	56                   	push   %esi
+  801694:	6a 00                	push   $0x0
+  801696:	e8 bb f9 ff ff       	call   801056 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80169b:	83 c4 08             	add    $0x8,%esp
+  80169e:	ff 75 d4             	push   -0x2c(%ebp)
+  8016a1:	6a 00                	push   $0x0
+  8016a3:	e8 ae f9 ff ff       	call   801056 <sys_page_unmap>
+	return r;
+  8016a8:	83 c4 10             	add    $0x10,%esp
+  8016ab:	eb b3                	jmp    801660 <dup+0x9d>
+
+008016ad <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016ad:	55                   	push   %ebp
+  8016ae:	89 e5                	mov    %esp,%ebp
+  8016b0:	56                   	push   %esi
+  8016b1:	53                   	push   %ebx
+  8016b2:	83 ec 18             	sub    $0x18,%esp
+  8016b5:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016b8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016bb:	50                   	push   %eax
+  8016bc:	56                   	push   %esi
+  8016bd:	e8 85 fd ff ff       	call   801447 <fd_lookup>
+  8016c2:	83 c4 10             	add    $0x10,%esp
+  8016c5:	85 c0                	test   %eax,%eax
+  8016c7:	78 3c                	js     801705 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016c9:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016cc:	83 ec 08             	sub    $0x8,%esp
+  8016cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d2:	50                   	push   %eax
+  8016d3:	ff 33                	push   (%ebx)
+  8016d5:	e8 bd fd ff ff       	call   801497 <dev_lookup>
+  8016da:	83 c4 10             	add    $0x10,%esp
+  8016dd:	85 c0                	test   %eax,%eax
+  8016df:	78 24                	js     801705 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016e1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016e4:	83 e0 03             	and    $0x3,%eax
+  8016e7:	83 f8 01             	cmp    $0x1,%eax
+  8016ea:	74 20                	je     80170c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8016ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ef:	8b 40 08             	mov    0x8(%eax),%eax
+  8016f2:	85 c0                	test   %eax,%eax
+  8016f4:	74 37                	je     80172d <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8016f6:	83 ec 04             	sub    $0x4,%esp
+  8016f9:	ff 75 10             	push   0x10(%ebp)
+  8016fc:	ff 75 0c             	push   0xc(%ebp)
+  8016ff:	53                   	push   %ebx
+  801700:	ff d0                	call   *%eax
+  801702:	83 c4 10             	add    $0x10,%esp
+}
+  801705:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801708:	5b                   	pop    %ebx
+  801709:	5e                   	pop    %esi
+  80170a:	5d                   	pop    %ebp
+  80170b:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80170c:	a1 10 60 80 00       	mov    0x806010,%eax
+  801711:	8b 40 48             	mov    0x48(%eax),%eax
+  801714:	83 ec 04             	sub    $0x4,%esp
+  801717:	56                   	push   %esi
+  801718:	50                   	push   %eax
+  801719:	68 95 40 80 00       	push   $0x804095
+  80171e:	e8 ac ee ff ff       	call   8005cf <cprintf>
+		return -E_INVAL;
+  801723:	83 c4 10             	add    $0x10,%esp
+  801726:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80172b:	eb d8                	jmp    801705 <read+0x58>
+		return -E_NOT_SUPP;
+  80172d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801732:	eb d1                	jmp    801705 <read+0x58>
+
+00801734 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801734:	55                   	push   %ebp
+  801735:	89 e5                	mov    %esp,%ebp
+  801737:	57                   	push   %edi
+  801738:	56                   	push   %esi
+  801739:	53                   	push   %ebx
+  80173a:	83 ec 0c             	sub    $0xc,%esp
+  80173d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801740:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801743:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801748:	eb 02                	jmp    80174c <readn+0x18>
+  80174a:	01 c3                	add    %eax,%ebx
+  80174c:	39 f3                	cmp    %esi,%ebx
+  80174e:	73 21                	jae    801771 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801750:	83 ec 04             	sub    $0x4,%esp
+  801753:	89 f0                	mov    %esi,%eax
+  801755:	29 d8                	sub    %ebx,%eax
+  801757:	50                   	push   %eax
+  801758:	89 d8                	mov    %ebx,%eax
+  80175a:	03 45 0c             	add    0xc(%ebp),%eax
+  80175d:	50                   	push   %eax
+  80175e:	57                   	push   %edi
+  80175f:	e8 49 ff ff ff       	call   8016ad <read>
+		if (m < 0)
+  801764:	83 c4 10             	add    $0x10,%esp
+  801767:	85 c0                	test   %eax,%eax
+  801769:	78 04                	js     80176f <readn+0x3b>
+			return m;
+		if (m == 0)
+  80176b:	75 dd                	jne    80174a <readn+0x16>
+  80176d:	eb 02                	jmp    801771 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80176f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801771:	89 d8                	mov    %ebx,%eax
+  801773:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801776:	5b                   	pop    %ebx
+  801777:	5e                   	pop    %esi
+  801778:	5f                   	pop    %edi
+  801779:	5d                   	pop    %ebp
+  80177a:	c3                   	ret
+
+0080177b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80177b:	55                   	push   %ebp
+  80177c:	89 e5                	mov    %esp,%ebp
+  80177e:	56                   	push   %esi
+  80177f:	53                   	push   %ebx
+  801780:	83 ec 18             	sub    $0x18,%esp
+  801783:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801786:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801789:	50                   	push   %eax
+  80178a:	53                   	push   %ebx
+  80178b:	e8 b7 fc ff ff       	call   801447 <fd_lookup>
+  801790:	83 c4 10             	add    $0x10,%esp
+  801793:	85 c0                	test   %eax,%eax
+  801795:	78 37                	js     8017ce <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801797:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80179a:	83 ec 08             	sub    $0x8,%esp
+  80179d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017a0:	50                   	push   %eax
+  8017a1:	ff 36                	push   (%esi)
+  8017a3:	e8 ef fc ff ff       	call   801497 <dev_lookup>
+  8017a8:	83 c4 10             	add    $0x10,%esp
+  8017ab:	85 c0                	test   %eax,%eax
+  8017ad:	78 1f                	js     8017ce <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017af:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017b3:	74 20                	je     8017d5 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8017b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017b8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017bb:	85 c0                	test   %eax,%eax
+  8017bd:	74 37                	je     8017f6 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8017bf:	83 ec 04             	sub    $0x4,%esp
+  8017c2:	ff 75 10             	push   0x10(%ebp)
+  8017c5:	ff 75 0c             	push   0xc(%ebp)
+  8017c8:	56                   	push   %esi
+  8017c9:	ff d0                	call   *%eax
+  8017cb:	83 c4 10             	add    $0x10,%esp
+}
+  8017ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017d1:	5b                   	pop    %ebx
+  8017d2:	5e                   	pop    %esi
+  8017d3:	5d                   	pop    %ebp
+  8017d4:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017d5:	a1 10 60 80 00       	mov    0x806010,%eax
+  8017da:	8b 40 48             	mov    0x48(%eax),%eax
+  8017dd:	83 ec 04             	sub    $0x4,%esp
+  8017e0:	53                   	push   %ebx
+  8017e1:	50                   	push   %eax
+  8017e2:	68 b1 40 80 00       	push   $0x8040b1
+  8017e7:	e8 e3 ed ff ff       	call   8005cf <cprintf>
+		return -E_INVAL;
+  8017ec:	83 c4 10             	add    $0x10,%esp
+  8017ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017f4:	eb d8                	jmp    8017ce <write+0x53>
+		return -E_NOT_SUPP;
+  8017f6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017fb:	eb d1                	jmp    8017ce <write+0x53>
+
+008017fd <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017fd:	55                   	push   %ebp
+  8017fe:	89 e5                	mov    %esp,%ebp
+  801800:	53                   	push   %ebx
+  801801:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801804:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801807:	50                   	push   %eax
+  801808:	ff 75 08             	push   0x8(%ebp)
+  80180b:	e8 37 fc ff ff       	call   801447 <fd_lookup>
+  801810:	83 c4 10             	add    $0x10,%esp
+  801813:	85 c0                	test   %eax,%eax
+  801815:	78 3a                	js     801851 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801817:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80181a:	83 ec 08             	sub    $0x8,%esp
+  80181d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801820:	50                   	push   %eax
+  801821:	ff 33                	push   (%ebx)
+  801823:	e8 6f fc ff ff       	call   801497 <dev_lookup>
+  801828:	83 c4 10             	add    $0x10,%esp
+  80182b:	85 c0                	test   %eax,%eax
+  80182d:	78 22                	js     801851 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  80182f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801832:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801835:	85 c0                	test   %eax,%eax
+  801837:	74 0d                	je     801846 <seek+0x49>
+  801839:	83 ec 0c             	sub    $0xc,%esp
+  80183c:	53                   	push   %ebx
+  80183d:	ff d0                	call   *%eax
+  80183f:	83 c4 10             	add    $0x10,%esp
+  801842:	85 c0                	test   %eax,%eax
+  801844:	78 0b                	js     801851 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801846:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801849:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  80184c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801851:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801854:	c9                   	leave
+  801855:	c3                   	ret
+
+00801856 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801856:	55                   	push   %ebp
+  801857:	89 e5                	mov    %esp,%ebp
+  801859:	53                   	push   %ebx
+  80185a:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80185d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801860:	50                   	push   %eax
+  801861:	ff 75 08             	push   0x8(%ebp)
+  801864:	e8 de fb ff ff       	call   801447 <fd_lookup>
+  801869:	83 c4 10             	add    $0x10,%esp
+  80186c:	85 c0                	test   %eax,%eax
+  80186e:	78 2b                	js     80189b <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801870:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801873:	83 ec 08             	sub    $0x8,%esp
+  801876:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801879:	50                   	push   %eax
+  80187a:	ff 33                	push   (%ebx)
+  80187c:	e8 16 fc ff ff       	call   801497 <dev_lookup>
+  801881:	83 c4 10             	add    $0x10,%esp
+  801884:	85 c0                	test   %eax,%eax
+  801886:	78 13                	js     80189b <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801888:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80188b:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80188e:	85 c0                	test   %eax,%eax
+  801890:	74 0e                	je     8018a0 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801892:	83 ec 0c             	sub    $0xc,%esp
+  801895:	53                   	push   %ebx
+  801896:	ff d0                	call   *%eax
+  801898:	83 c4 10             	add    $0x10,%esp
+}
+  80189b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80189e:	c9                   	leave
+  80189f:	c3                   	ret
+		return 0;
+  8018a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a5:	eb f4                	jmp    80189b <fsync+0x45>
+
+008018a7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018a7:	55                   	push   %ebp
+  8018a8:	89 e5                	mov    %esp,%ebp
+  8018aa:	56                   	push   %esi
+  8018ab:	53                   	push   %ebx
+  8018ac:	83 ec 18             	sub    $0x18,%esp
+  8018af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018b2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018b5:	50                   	push   %eax
+  8018b6:	53                   	push   %ebx
+  8018b7:	e8 8b fb ff ff       	call   801447 <fd_lookup>
+  8018bc:	83 c4 10             	add    $0x10,%esp
+  8018bf:	85 c0                	test   %eax,%eax
+  8018c1:	78 34                	js     8018f7 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018c3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018c6:	83 ec 08             	sub    $0x8,%esp
+  8018c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018cc:	50                   	push   %eax
+  8018cd:	ff 36                	push   (%esi)
+  8018cf:	e8 c3 fb ff ff       	call   801497 <dev_lookup>
+  8018d4:	83 c4 10             	add    $0x10,%esp
+  8018d7:	85 c0                	test   %eax,%eax
+  8018d9:	78 1c                	js     8018f7 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018db:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018df:	74 1d                	je     8018fe <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8018e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018e4:	8b 40 18             	mov    0x18(%eax),%eax
+  8018e7:	85 c0                	test   %eax,%eax
+  8018e9:	74 34                	je     80191f <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8018eb:	83 ec 08             	sub    $0x8,%esp
+  8018ee:	ff 75 0c             	push   0xc(%ebp)
+  8018f1:	56                   	push   %esi
+  8018f2:	ff d0                	call   *%eax
+  8018f4:	83 c4 10             	add    $0x10,%esp
+}
+  8018f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018fa:	5b                   	pop    %ebx
+  8018fb:	5e                   	pop    %esi
+  8018fc:	5d                   	pop    %ebp
+  8018fd:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8018fe:	a1 10 60 80 00       	mov    0x806010,%eax
+  801903:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801906:	83 ec 04             	sub    $0x4,%esp
+  801909:	53                   	push   %ebx
+  80190a:	50                   	push   %eax
+  80190b:	68 74 40 80 00       	push   $0x804074
+  801910:	e8 ba ec ff ff       	call   8005cf <cprintf>
+		return -E_INVAL;
+  801915:	83 c4 10             	add    $0x10,%esp
+  801918:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80191d:	eb d8                	jmp    8018f7 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80191f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801924:	eb d1                	jmp    8018f7 <ftruncate+0x50>
+
+00801926 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801926:	55                   	push   %ebp
+  801927:	89 e5                	mov    %esp,%ebp
+  801929:	56                   	push   %esi
+  80192a:	53                   	push   %ebx
+  80192b:	83 ec 18             	sub    $0x18,%esp
+  80192e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801931:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801934:	50                   	push   %eax
+  801935:	ff 75 08             	push   0x8(%ebp)
+  801938:	e8 0a fb ff ff       	call   801447 <fd_lookup>
+  80193d:	83 c4 10             	add    $0x10,%esp
+  801940:	85 c0                	test   %eax,%eax
+  801942:	78 49                	js     80198d <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801944:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801947:	83 ec 08             	sub    $0x8,%esp
+  80194a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80194d:	50                   	push   %eax
+  80194e:	ff 36                	push   (%esi)
+  801950:	e8 42 fb ff ff       	call   801497 <dev_lookup>
+  801955:	83 c4 10             	add    $0x10,%esp
+  801958:	85 c0                	test   %eax,%eax
+  80195a:	78 31                	js     80198d <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80195c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80195f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801963:	74 2f                	je     801994 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801965:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801968:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80196f:	00 00 00 
+	stat->st_isdir = 0;
+  801972:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801979:	00 00 00 
+	stat->st_dev = dev;
+  80197c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801982:	83 ec 08             	sub    $0x8,%esp
+  801985:	53                   	push   %ebx
+  801986:	56                   	push   %esi
+  801987:	ff 50 14             	call   *0x14(%eax)
+  80198a:	83 c4 10             	add    $0x10,%esp
+}
+  80198d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801990:	5b                   	pop    %ebx
+  801991:	5e                   	pop    %esi
+  801992:	5d                   	pop    %ebp
+  801993:	c3                   	ret
+		return -E_NOT_SUPP;
+  801994:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801999:	eb f2                	jmp    80198d <fstat+0x67>
+
+0080199b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80199b:	55                   	push   %ebp
+  80199c:	89 e5                	mov    %esp,%ebp
+  80199e:	56                   	push   %esi
+  80199f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  8019a0:	83 ec 08             	sub    $0x8,%esp
+  8019a3:	68 00 10 00 00       	push   $0x1000
+  8019a8:	ff 75 08             	push   0x8(%ebp)
+  8019ab:	e8 b3 07 00 00       	call   802163 <open>
+  8019b0:	89 c3                	mov    %eax,%ebx
+  8019b2:	83 c4 10             	add    $0x10,%esp
+  8019b5:	85 c0                	test   %eax,%eax
+  8019b7:	78 1b                	js     8019d4 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  8019b9:	83 ec 08             	sub    $0x8,%esp
+  8019bc:	ff 75 0c             	push   0xc(%ebp)
+  8019bf:	50                   	push   %eax
+  8019c0:	e8 61 ff ff ff       	call   801926 <fstat>
+  8019c5:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8019c7:	89 1c 24             	mov    %ebx,(%esp)
+  8019ca:	e8 a2 fb ff ff       	call   801571 <close>
+	return r;
+  8019cf:	83 c4 10             	add    $0x10,%esp
+  8019d2:	89 f3                	mov    %esi,%ebx
+}
+  8019d4:	89 d8                	mov    %ebx,%eax
+  8019d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019d9:	5b                   	pop    %ebx
+  8019da:	5e                   	pop    %esi
+  8019db:	5d                   	pop    %ebp
+  8019dc:	c3                   	ret
+
+008019dd <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  8019dd:	55                   	push   %ebp
+  8019de:	89 e5                	mov    %esp,%ebp
+  8019e0:	57                   	push   %edi
+  8019e1:	56                   	push   %esi
+  8019e2:	53                   	push   %ebx
+  8019e3:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  8019e9:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  8019ef:	89 d6                	mov    %edx,%esi
+  8019f1:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  8019f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  8019fa:	89 d3                	mov    %edx,%ebx
+  8019fc:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801a02:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801a09:	74 1d                	je     801a28 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a0b:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801a10:	83 c8 07             	or     $0x7,%eax
+  801a13:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801a19:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801a1e:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801a24:	01 ce                	add    %ecx,%esi
+  801a26:	eb 28                	jmp    801a50 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a28:	83 ec 0c             	sub    $0xc,%esp
+  801a2b:	6a 01                	push   $0x1
+  801a2d:	e8 52 1e 00 00       	call   803884 <ipc_find_env>
+  801a32:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801a37:	83 c4 10             	add    $0x10,%esp
+  801a3a:	eb cf                	jmp    801a0b <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801a3c:	83 c0 01             	add    $0x1,%eax
+  801a3f:	89 fa                	mov    %edi,%edx
+  801a41:	09 da                	or     %ebx,%edx
+  801a43:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801a4a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a50:	39 f3                	cmp    %esi,%ebx
+  801a52:	72 e8                	jb     801a3c <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801a54:	83 f8 41             	cmp    $0x41,%eax
+  801a57:	77 2f                	ja     801a88 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801a59:	50                   	push   %eax
+  801a5a:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801a60:	50                   	push   %eax
+  801a61:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801a67:	ff 35 c8 80 80 00    	push   0x8080c8
+  801a6d:	e8 c4 1d 00 00       	call   803836 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801a72:	83 c4 0c             	add    $0xc,%esp
+  801a75:	6a 00                	push   $0x0
+  801a77:	6a 00                	push   $0x0
+  801a79:	6a 00                	push   $0x0
+  801a7b:	e8 60 1c 00 00       	call   8036e0 <ipc_recv>
+}
+  801a80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a83:	5b                   	pop    %ebx
+  801a84:	5e                   	pop    %esi
+  801a85:	5f                   	pop    %edi
+  801a86:	5d                   	pop    %ebp
+  801a87:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801a88:	68 e4 40 80 00       	push   $0x8040e4
+  801a8d:	68 00 41 80 00       	push   $0x804100
+  801a92:	6a 40                	push   $0x40
+  801a94:	68 15 41 80 00       	push   $0x804115
+  801a99:	e8 e7 18 00 00       	call   803385 <_panic>
+
+00801a9e <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801a9e:	55                   	push   %ebp
+  801a9f:	89 e5                	mov    %esp,%ebp
+  801aa1:	57                   	push   %edi
+  801aa2:	56                   	push   %esi
+  801aa3:	53                   	push   %ebx
+  801aa4:	83 ec 1c             	sub    $0x1c,%esp
+  801aa7:	89 c3                	mov    %eax,%ebx
+  801aa9:	89 d6                	mov    %edx,%esi
+  801aab:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801aae:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801ab4:	89 ca                	mov    %ecx,%edx
+  801ab6:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801ab9:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801ac0:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801ac3:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801aca:	8b 76 0c             	mov    0xc(%esi),%esi
+  801acd:	89 fb                	mov    %edi,%ebx
+  801acf:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801ad6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ad9:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801ae0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ae3:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801aea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801aed:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801af4:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801af7:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801afe:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801b03:	39 c8                	cmp    %ecx,%eax
+  801b05:	74 0d                	je     801b14 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801b07:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b0f:	5b                   	pop    %ebx
+  801b10:	5e                   	pop    %esi
+  801b11:	5f                   	pop    %edi
+  801b12:	5d                   	pop    %ebp
+  801b13:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b14:	6a 07                	push   $0x7
+  801b16:	68 00 70 80 00       	push   $0x807000
+  801b1b:	6a 0d                	push   $0xd
+  801b1d:	ff 35 c8 80 80 00    	push   0x8080c8
+  801b23:	e8 23 1c 00 00       	call   80374b <ipc_send>
+  801b28:	83 c4 10             	add    $0x10,%esp
+  801b2b:	eb da                	jmp    801b07 <fsring_post+0x69>
+
+00801b2d <fsipcv>:
+{
+  801b2d:	55                   	push   %ebp
+  801b2e:	89 e5                	mov    %esp,%ebp
+  801b30:	57                   	push   %edi
+  801b31:	56                   	push   %esi
+  801b32:	53                   	push   %ebx
+  801b33:	83 ec 0c             	sub    $0xc,%esp
+  801b36:	89 c7                	mov    %eax,%edi
+  801b38:	89 d3                	mov    %edx,%ebx
+  801b3a:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801b3c:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801b43:	74 26                	je     801b6b <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b45:	6a 07                	push   $0x7
+  801b47:	68 00 70 80 00       	push   $0x807000
+  801b4c:	57                   	push   %edi
+  801b4d:	ff 35 c8 80 80 00    	push   0x8080c8
+  801b53:	e8 f3 1b 00 00       	call   80374b <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801b58:	6a 00                	push   $0x0
+  801b5a:	56                   	push   %esi
+  801b5b:	53                   	push   %ebx
+  801b5c:	6a 00                	push   $0x0
+  801b5e:	e8 40 1c 00 00       	call   8037a3 <ipc_recvv>
+}
+  801b63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b66:	5b                   	pop    %ebx
+  801b67:	5e                   	pop    %esi
+  801b68:	5f                   	pop    %edi
+  801b69:	5d                   	pop    %ebp
+  801b6a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b6b:	83 ec 0c             	sub    $0xc,%esp
+  801b6e:	6a 01                	push   $0x1
+  801b70:	e8 0f 1d 00 00       	call   803884 <ipc_find_env>
+  801b75:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801b7a:	83 c4 10             	add    $0x10,%esp
+  801b7d:	eb c6                	jmp    801b45 <fsipcv+0x18>
+
+00801b7f <fsipc>:
+{
+  801b7f:	55                   	push   %ebp
+  801b80:	89 e5                	mov    %esp,%ebp
+  801b82:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801b85:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801b8c:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801b8f:	e8 99 ff ff ff       	call   801b2d <fsipcv>
+}
+  801b94:	c9                   	leave
+  801b95:	c3                   	ret
+
+00801b96 <file_write_direct>:
+{
+  801b96:	55                   	push   %ebp
+  801b97:	89 e5                	mov    %esp,%ebp
+  801b99:	56                   	push   %esi
+  801b9a:	53                   	push   %ebx
+  801b9b:	89 c3                	mov    %eax,%ebx
+  801b9d:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801b9f:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801ba5:	77 40                	ja     801be7 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801ba7:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801bac:	39 c8                	cmp    %ecx,%eax
+  801bae:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801bb1:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801bb4:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  801bba:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801bbf:	83 ec 04             	sub    $0x4,%esp
+  801bc2:	50                   	push   %eax
+  801bc3:	52                   	push   %edx
+  801bc4:	68 08 70 80 00       	push   $0x807008
+  801bc9:	e8 75 f1 ff ff       	call   800d43 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801bce:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd3:	b8 04 00 00 00       	mov    $0x4,%eax
+  801bd8:	e8 a2 ff ff ff       	call   801b7f <fsipc>
+  801bdd:	83 c4 10             	add    $0x10,%esp
+}
+  801be0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be3:	5b                   	pop    %ebx
+  801be4:	5e                   	pop    %esi
+  801be5:	5d                   	pop    %ebp
+  801be6:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801be7:	89 d6                	mov    %edx,%esi
+  801be9:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801bef:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801bf4:	29 f1                	sub    %esi,%ecx
+  801bf6:	39 c1                	cmp    %eax,%ecx
+  801bf8:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801bfb:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801bfe:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801c03:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801c09:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801c0f:	83 ec 0c             	sub    $0xc,%esp
+  801c12:	6a 05                	push   $0x5
+  801c14:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c19:	e8 bf fd ff ff       	call   8019dd <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801c1e:	83 c4 10             	add    $0x10,%esp
+  801c21:	eb bd                	jmp    801be0 <file_write_direct+0x4a>
+
+00801c23 <devfile_sync>:
+{
+  801c23:	55                   	push   %ebp
+  801c24:	89 e5                	mov    %esp,%ebp
+  801c26:	57                   	push   %edi
+  801c27:	56                   	push   %esi
+  801c28:	53                   	push   %ebx
+  801c29:	83 ec 28             	sub    $0x28,%esp
+  801c2c:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801c2f:	56                   	push   %esi
+  801c30:	e8 a5 f7 ff ff       	call   8013da <fd2data>
+  801c35:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801c37:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801c3a:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801c41:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c44:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801c49:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801c4d:	74 45                	je     801c94 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801c4f:	8b 46 14             	mov    0x14(%esi),%eax
+  801c52:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801c55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c5f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801c62:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801c65:	39 cb                	cmp    %ecx,%ebx
+  801c67:	73 14                	jae    801c7d <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801c69:	29 d9                	sub    %ebx,%ecx
+  801c6b:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801c6e:	89 f0                	mov    %esi,%eax
+  801c70:	e8 21 ff ff ff       	call   801b96 <file_write_direct>
+  801c75:	85 c0                	test   %eax,%eax
+  801c77:	7e 04                	jle    801c7d <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801c79:	01 c3                	add    %eax,%ebx
+  801c7b:	eb e5                	jmp    801c62 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801c7d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801c80:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801c87:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801c8a:	85 c0                	test   %eax,%eax
+  801c8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c91:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801c94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c97:	5b                   	pop    %ebx
+  801c98:	5e                   	pop    %esi
+  801c99:	5f                   	pop    %edi
+  801c9a:	5d                   	pop    %ebp
+  801c9b:	c3                   	ret
+
+00801c9c <devfile_write>:
+{
+  801c9c:	55                   	push   %ebp
+  801c9d:	89 e5                	mov    %esp,%ebp
+  801c9f:	57                   	push   %edi
+  801ca0:	56                   	push   %esi
+  801ca1:	53                   	push   %ebx
+  801ca2:	83 ec 28             	sub    $0x28,%esp
+  801ca5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ca8:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801cab:	53                   	push   %ebx
+  801cac:	e8 29 f7 ff ff       	call   8013da <fd2data>
+  801cb1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801cb4:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801cb7:	83 c4 10             	add    $0x10,%esp
+  801cba:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801cbe:	74 43                	je     801d03 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801cc0:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801cc7:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801cca:	85 c0                	test   %eax,%eax
+  801ccc:	74 43                	je     801d11 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801cce:	89 c2                	mov    %eax,%edx
+  801cd0:	03 53 14             	add    0x14(%ebx),%edx
+  801cd3:	39 fa                	cmp    %edi,%edx
+  801cd5:	75 0b                	jne    801ce2 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801cd7:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801cda:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801ce0:	76 66                	jbe    801d48 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801ce2:	83 ec 0c             	sub    $0xc,%esp
+  801ce5:	53                   	push   %ebx
+  801ce6:	e8 38 ff ff ff       	call   801c23 <devfile_sync>
+  801ceb:	83 c4 10             	add    $0x10,%esp
+  801cee:	85 c0                	test   %eax,%eax
+  801cf0:	78 4e                	js     801d40 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801cf2:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801cf8:	77 56                	ja     801d50 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801cfa:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801cfd:	85 c0                	test   %eax,%eax
+  801cff:	75 20                	jne    801d21 <devfile_write+0x85>
+  801d01:	eb 16                	jmp    801d19 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801d03:	89 f1                	mov    %esi,%ecx
+  801d05:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d08:	89 d8                	mov    %ebx,%eax
+  801d0a:	e8 87 fe ff ff       	call   801b96 <file_write_direct>
+  801d0f:	eb 2f                	jmp    801d40 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801d11:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d17:	77 37                	ja     801d50 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801d19:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801d1c:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801d21:	83 ec 04             	sub    $0x4,%esp
+  801d24:	56                   	push   %esi
+  801d25:	ff 75 0c             	push   0xc(%ebp)
+  801d28:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d2b:	01 c1                	add    %eax,%ecx
+  801d2d:	51                   	push   %ecx
+  801d2e:	e8 10 f0 ff ff       	call   800d43 <memmove>
+	ff->buf_wlen += n;
+  801d33:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801d36:	01 f7                	add    %esi,%edi
+  801d38:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801d3b:	89 f0                	mov    %esi,%eax
+  801d3d:	83 c4 10             	add    $0x10,%esp
+}
+  801d40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d43:	5b                   	pop    %ebx
+  801d44:	5e                   	pop    %esi
+  801d45:	5f                   	pop    %edi
+  801d46:	5d                   	pop    %ebp
+  801d47:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801d48:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d4e:	76 d1                	jbe    801d21 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801d50:	89 f1                	mov    %esi,%ecx
+  801d52:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d55:	89 d8                	mov    %ebx,%eax
+  801d57:	e8 3a fe ff ff       	call   801b96 <file_write_direct>
+  801d5c:	eb e2                	jmp    801d40 <devfile_write+0xa4>
+
+00801d5e <devfile_trunc>:
+{
+  801d5e:	55                   	push   %ebp
+  801d5f:	89 e5                	mov    %esp,%ebp
+  801d61:	53                   	push   %ebx
+  801d62:	83 ec 10             	sub    $0x10,%esp
+  801d65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801d68:	53                   	push   %ebx
+  801d69:	e8 b5 fe ff ff       	call   801c23 <devfile_sync>
+  801d6e:	83 c4 10             	add    $0x10,%esp
+  801d71:	85 c0                	test   %eax,%eax
+  801d73:	78 1f                	js     801d94 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d75:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801d78:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801d7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d80:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801d85:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d8a:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d8f:	e8 eb fd ff ff       	call   801b7f <fsipc>
+}
+  801d94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d97:	c9                   	leave
+  801d98:	c3                   	ret
+
+00801d99 <devfile_stat>:
+{
+  801d99:	55                   	push   %ebp
+  801d9a:	89 e5                	mov    %esp,%ebp
+  801d9c:	56                   	push   %esi
+  801d9d:	53                   	push   %ebx
+  801d9e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801da1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801da4:	83 ec 0c             	sub    $0xc,%esp
+  801da7:	53                   	push   %ebx
+  801da8:	e8 76 fe ff ff       	call   801c23 <devfile_sync>
+  801dad:	83 c4 10             	add    $0x10,%esp
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	78 47                	js     801dfb <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801db4:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801db7:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801dbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dc1:	b8 05 00 00 00       	mov    $0x5,%eax
+  801dc6:	e8 b4 fd ff ff       	call   801b7f <fsipc>
+  801dcb:	85 c0                	test   %eax,%eax
+  801dcd:	78 2c                	js     801dfb <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801dcf:	83 ec 08             	sub    $0x8,%esp
+  801dd2:	68 00 70 80 00       	push   $0x807000
+  801dd7:	56                   	push   %esi
+  801dd8:	e8 e0 ed ff ff       	call   800bbd <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801ddd:	a1 80 70 80 00       	mov    0x807080,%eax
+  801de2:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801de8:	a1 84 70 80 00       	mov    0x807084,%eax
+  801ded:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801df3:	83 c4 10             	add    $0x10,%esp
+  801df6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dfb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dfe:	5b                   	pop    %ebx
+  801dff:	5e                   	pop    %esi
+  801e00:	5d                   	pop    %ebp
+  801e01:	c3                   	ret
+
+00801e02 <devfile_flush>:
+{
+  801e02:	55                   	push   %ebp
+  801e03:	89 e5                	mov    %esp,%ebp
+  801e05:	56                   	push   %esi
+  801e06:	53                   	push   %ebx
+  801e07:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801e0a:	83 ec 0c             	sub    $0xc,%esp
+  801e0d:	56                   	push   %esi
+  801e0e:	e8 10 fe ff ff       	call   801c23 <devfile_sync>
+  801e13:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801e15:	83 c4 10             	add    $0x10,%esp
+  801e18:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801e1c:	75 25                	jne    801e43 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e1e:	8b 46 0c             	mov    0xc(%esi),%eax
+  801e21:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801e26:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e2b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e30:	e8 4a fd ff ff       	call   801b7f <fsipc>
+  801e35:	85 c0                	test   %eax,%eax
+  801e37:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801e3a:	89 d8                	mov    %ebx,%eax
+  801e3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e3f:	5b                   	pop    %ebx
+  801e40:	5e                   	pop    %esi
+  801e41:	5d                   	pop    %ebp
+  801e42:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801e43:	83 ec 0c             	sub    $0xc,%esp
+  801e46:	56                   	push   %esi
+  801e47:	e8 8e f5 ff ff       	call   8013da <fd2data>
+  801e4c:	83 c4 08             	add    $0x8,%esp
+  801e4f:	50                   	push   %eax
+  801e50:	6a 00                	push   $0x0
+  801e52:	e8 ff f1 ff ff       	call   801056 <sys_page_unmap>
+  801e57:	83 c4 10             	add    $0x10,%esp
+  801e5a:	eb c2                	jmp    801e1e <devfile_flush+0x1c>
+
+00801e5c <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801e5c:	55                   	push   %ebp
+  801e5d:	89 e5                	mov    %esp,%ebp
+  801e5f:	57                   	push   %edi
+  801e60:	56                   	push   %esi
+  801e61:	53                   	push   %ebx
+  801e62:	83 ec 64             	sub    $0x64,%esp
+  801e65:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801e67:	52                   	push   %edx
+  801e68:	50                   	push   %eax
+  801e69:	e8 d9 f5 ff ff       	call   801447 <fd_lookup>
+  801e6e:	89 c1                	mov    %eax,%ecx
+  801e70:	83 c4 10             	add    $0x10,%esp
+  801e73:	85 c0                	test   %eax,%eax
+  801e75:	0f 88 f2 00 00 00    	js     801f6d <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801e7b:	8b 07                	mov    (%edi),%eax
+  801e7d:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801e83:	39 10                	cmp    %edx,(%eax)
+  801e85:	0f 85 03 01 00 00    	jne    801f8e <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801e8b:	a1 10 60 80 00       	mov    0x806010,%eax
+  801e90:	8b 40 48             	mov    0x48(%eax),%eax
+  801e93:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  801e99:	0f 84 96 00 00 00    	je     801f35 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801e9f:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801ea6:	0f 84 cb 00 00 00    	je     801f77 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801eac:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801eb1:	83 c8 07             	or     $0x7,%eax
+  801eb4:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801eb7:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801eba:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801ebf:	83 ec 04             	sub    $0x4,%esp
+  801ec2:	68 07 04 00 00       	push   $0x407
+  801ec7:	53                   	push   %ebx
+  801ec8:	6a 00                	push   $0x0
+  801eca:	e8 fa f0 ff ff       	call   800fc9 <sys_page_alloc>
+  801ecf:	89 c1                	mov    %eax,%ecx
+  801ed1:	83 c4 10             	add    $0x10,%esp
+  801ed4:	85 c0                	test   %eax,%eax
+  801ed6:	0f 88 91 00 00 00    	js     801f6d <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801edc:	89 d8                	mov    %ebx,%eax
+  801ede:	83 c8 07             	or     $0x7,%eax
+  801ee1:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801ee3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ee9:	83 c6 04             	add    $0x4,%esi
+  801eec:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801ef2:	75 cb                	jne    801ebf <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801ef4:	6a 12                	push   $0x12
+  801ef6:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801ef9:	50                   	push   %eax
+  801efa:	6a 0c                	push   $0xc
+  801efc:	ff 35 c8 80 80 00    	push   0x8080c8
+  801f02:	e8 2f 19 00 00       	call   803836 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801f07:	83 c4 0c             	add    $0xc,%esp
+  801f0a:	6a 00                	push   $0x0
+  801f0c:	6a 00                	push   $0x0
+  801f0e:	6a 00                	push   $0x0
+  801f10:	e8 cb 17 00 00       	call   8036e0 <ipc_recv>
+  801f15:	89 c1                	mov    %eax,%ecx
+  801f17:	83 c4 10             	add    $0x10,%esp
+  801f1a:	85 c0                	test   %eax,%eax
+  801f1c:	78 4f                	js     801f6d <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801f1e:	a1 10 60 80 00       	mov    0x806010,%eax
+  801f23:	8b 40 48             	mov    0x48(%eax),%eax
+  801f26:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  801f2b:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  801f32:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801f35:	83 ec 0c             	sub    $0xc,%esp
+  801f38:	ff 37                	push   (%edi)
+  801f3a:	e8 e4 fc ff ff       	call   801c23 <devfile_sync>
+  801f3f:	89 c1                	mov    %eax,%ecx
+  801f41:	83 c4 10             	add    $0x10,%esp
+  801f44:	85 c0                	test   %eax,%eax
+  801f46:	78 25                	js     801f6d <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801f48:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801f4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801f53:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f58:	89 d0                	mov    %edx,%eax
+  801f5a:	d3 e0                	shl    %cl,%eax
+  801f5c:	85 d8                	test   %ebx,%eax
+  801f5e:	74 0d                	je     801f6d <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801f60:	83 c1 01             	add    $0x1,%ecx
+  801f63:	83 f9 10             	cmp    $0x10,%ecx
+  801f66:	75 f0                	jne    801f58 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801f68:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801f6d:	89 c8                	mov    %ecx,%eax
+  801f6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f72:	5b                   	pop    %ebx
+  801f73:	5e                   	pop    %esi
+  801f74:	5f                   	pop    %edi
+  801f75:	5d                   	pop    %ebp
+  801f76:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f77:	83 ec 0c             	sub    $0xc,%esp
+  801f7a:	6a 01                	push   $0x1
+  801f7c:	e8 03 19 00 00       	call   803884 <ipc_find_env>
+  801f81:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801f86:	83 c4 10             	add    $0x10,%esp
+  801f89:	e9 1e ff ff ff       	jmp    801eac <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801f8e:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801f93:	eb d8                	jmp    801f6d <fsring_slot+0x111>
+
+00801f95 <file_read_direct>:
+{
+  801f95:	55                   	push   %ebp
+  801f96:	89 e5                	mov    %esp,%ebp
+  801f98:	57                   	push   %edi
+  801f99:	56                   	push   %esi
+  801f9a:	53                   	push   %ebx
+  801f9b:	83 ec 1c             	sub    $0x1c,%esp
+  801f9e:	89 c7                	mov    %eax,%edi
+  801fa0:	89 d6                	mov    %edx,%esi
+  801fa2:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801fa4:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801faa:	77 52                	ja     801ffe <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fac:	8b 40 0c             	mov    0xc(%eax),%eax
+  801faf:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801fb4:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801fba:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fbf:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fc4:	e8 b6 fb ff ff       	call   801b7f <fsipc>
+  801fc9:	89 c7                	mov    %eax,%edi
+  801fcb:	85 c0                	test   %eax,%eax
+  801fcd:	78 25                	js     801ff4 <file_read_direct+0x5f>
+	assert(r <= n);
+  801fcf:	39 c3                	cmp    %eax,%ebx
+  801fd1:	0f 82 87 00 00 00    	jb     80205e <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801fd7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801fdc:	0f 8f 95 00 00 00    	jg     802077 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801fe2:	83 ec 04             	sub    $0x4,%esp
+  801fe5:	50                   	push   %eax
+  801fe6:	68 00 70 80 00       	push   $0x807000
+  801feb:	56                   	push   %esi
+  801fec:	e8 52 ed ff ff       	call   800d43 <memmove>
+	return r;
+  801ff1:	83 c4 10             	add    $0x10,%esp
+}
+  801ff4:	89 f8                	mov    %edi,%eax
+  801ff6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff9:	5b                   	pop    %ebx
+  801ffa:	5e                   	pop    %esi
+  801ffb:	5f                   	pop    %edi
+  801ffc:	5d                   	pop    %ebp
+  801ffd:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801ffe:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802004:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802009:	29 d1                	sub    %edx,%ecx
+  80200b:	39 d9                	cmp    %ebx,%ecx
+  80200d:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802010:	89 f0                	mov    %esi,%eax
+  802012:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  802015:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802018:	eb 0f                	jmp    802029 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  80201a:	0f b6 10             	movzbl (%eax),%edx
+  80201d:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80201f:	05 00 10 00 00       	add    $0x1000,%eax
+  802024:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802029:	39 c8                	cmp    %ecx,%eax
+  80202b:	72 ed                	jb     80201a <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  80202d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802030:	8b 47 0c             	mov    0xc(%edi),%eax
+  802033:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  802038:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  80203e:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  802044:	83 ec 0c             	sub    $0xc,%esp
+  802047:	6a 07                	push   $0x7
+  802049:	89 d9                	mov    %ebx,%ecx
+  80204b:	89 f2                	mov    %esi,%edx
+  80204d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802052:	e8 86 f9 ff ff       	call   8019dd <fsipc_pages>
+  802057:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  802059:	83 c4 10             	add    $0x10,%esp
+  80205c:	eb 96                	jmp    801ff4 <file_read_direct+0x5f>
+	assert(r <= n);
+  80205e:	68 20 41 80 00       	push   $0x804120
+  802063:	68 00 41 80 00       	push   $0x804100
+  802068:	68 dc 00 00 00       	push   $0xdc
+  80206d:	68 15 41 80 00       	push   $0x804115
+  802072:	e8 0e 13 00 00       	call   803385 <_panic>
+	assert(r <= PGSIZE);
+  802077:	68 31 41 80 00       	push   $0x804131
+  80207c:	68 00 41 80 00       	push   $0x804100
+  802081:	68 dd 00 00 00       	push   $0xdd
+  802086:	68 15 41 80 00       	push   $0x804115
+  80208b:	e8 f5 12 00 00       	call   803385 <_panic>
+
+00802090 <devfile_read>:
+{
+  802090:	55                   	push   %ebp
+  802091:	89 e5                	mov    %esp,%ebp
+  802093:	57                   	push   %edi
+  802094:	56                   	push   %esi
+  802095:	53                   	push   %ebx
+  802096:	83 ec 28             	sub    $0x28,%esp
+  802099:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80209c:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80209f:	53                   	push   %ebx
+  8020a0:	e8 35 f3 ff ff       	call   8013da <fd2data>
+  8020a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8020a8:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8020ab:	83 c4 10             	add    $0x10,%esp
+  8020ae:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8020b2:	74 7d                	je     802131 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8020b4:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8020b8:	0f 85 81 00 00 00    	jne    80213f <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  8020be:	8b 43 18             	mov    0x18(%ebx),%eax
+  8020c1:	85 c0                	test   %eax,%eax
+  8020c3:	74 0d                	je     8020d2 <devfile_read+0x42>
+  8020c5:	8b 53 14             	mov    0x14(%ebx),%edx
+  8020c8:	39 fa                	cmp    %edi,%edx
+  8020ca:	7f 06                	jg     8020d2 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8020cc:	01 c2                	add    %eax,%edx
+  8020ce:	39 d7                	cmp    %edx,%edi
+  8020d0:	72 28                	jb     8020fa <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8020d2:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8020d9:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8020df:	77 74                	ja     802155 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8020e1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020e6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8020e9:	89 d8                	mov    %ebx,%eax
+  8020eb:	e8 a5 fe ff ff       	call   801f95 <file_read_direct>
+  8020f0:	85 c0                	test   %eax,%eax
+  8020f2:	7e 35                	jle    802129 <devfile_read+0x99>
+		ff->buf_base = pos;
+  8020f4:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8020f7:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8020fa:	8b 53 14             	mov    0x14(%ebx),%edx
+  8020fd:	89 d0                	mov    %edx,%eax
+  8020ff:	03 43 18             	add    0x18(%ebx),%eax
+  802102:	29 f8                	sub    %edi,%eax
+  802104:	39 f0                	cmp    %esi,%eax
+  802106:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  802109:	83 ec 04             	sub    $0x4,%esp
+  80210c:	56                   	push   %esi
+  80210d:	89 f8                	mov    %edi,%eax
+  80210f:	29 d0                	sub    %edx,%eax
+  802111:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802114:	01 c1                	add    %eax,%ecx
+  802116:	51                   	push   %ecx
+  802117:	ff 75 0c             	push   0xc(%ebp)
+  80211a:	e8 24 ec ff ff       	call   800d43 <memmove>
+	fd->fd_offset = pos + n;
+  80211f:	01 f7                	add    %esi,%edi
+  802121:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802124:	89 f0                	mov    %esi,%eax
+  802126:	83 c4 10             	add    $0x10,%esp
+}
+  802129:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80212c:	5b                   	pop    %ebx
+  80212d:	5e                   	pop    %esi
+  80212e:	5f                   	pop    %edi
+  80212f:	5d                   	pop    %ebp
+  802130:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802131:	89 f1                	mov    %esi,%ecx
+  802133:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802136:	89 d8                	mov    %ebx,%eax
+  802138:	e8 58 fe ff ff       	call   801f95 <file_read_direct>
+  80213d:	eb ea                	jmp    802129 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80213f:	83 ec 0c             	sub    $0xc,%esp
+  802142:	53                   	push   %ebx
+  802143:	e8 db fa ff ff       	call   801c23 <devfile_sync>
+  802148:	83 c4 10             	add    $0x10,%esp
+  80214b:	85 c0                	test   %eax,%eax
+  80214d:	0f 89 6b ff ff ff    	jns    8020be <devfile_read+0x2e>
+  802153:	eb d4                	jmp    802129 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  802155:	89 f1                	mov    %esi,%ecx
+  802157:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80215a:	89 d8                	mov    %ebx,%eax
+  80215c:	e8 34 fe ff ff       	call   801f95 <file_read_direct>
+  802161:	eb c6                	jmp    802129 <devfile_read+0x99>
+
+00802163 <open>:
+{
+  802163:	55                   	push   %ebp
+  802164:	89 e5                	mov    %esp,%ebp
+  802166:	56                   	push   %esi
+  802167:	53                   	push   %ebx
+  802168:	83 ec 1c             	sub    $0x1c,%esp
+  80216b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80216e:	56                   	push   %esi
+  80216f:	e8 0e ea ff ff       	call   800b82 <strlen>
+  802174:	83 c4 10             	add    $0x10,%esp
+  802177:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80217c:	0f 8f a0 00 00 00    	jg     802222 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  802182:	83 ec 0c             	sub    $0xc,%esp
+  802185:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802188:	50                   	push   %eax
+  802189:	e8 63 f2 ff ff       	call   8013f1 <fd_alloc>
+  80218e:	89 c3                	mov    %eax,%ebx
+  802190:	83 c4 10             	add    $0x10,%esp
+  802193:	85 c0                	test   %eax,%eax
+  802195:	78 45                	js     8021dc <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  802197:	83 ec 08             	sub    $0x8,%esp
+  80219a:	56                   	push   %esi
+  80219b:	68 00 70 80 00       	push   $0x807000
+  8021a0:	e8 18 ea ff ff       	call   800bbd <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021a8:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021ad:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021b5:	e8 c5 f9 ff ff       	call   801b7f <fsipc>
+  8021ba:	89 c3                	mov    %eax,%ebx
+  8021bc:	83 c4 10             	add    $0x10,%esp
+  8021bf:	85 c0                	test   %eax,%eax
+  8021c1:	78 22                	js     8021e5 <open+0x82>
+	if (!(mode & O_NOBUF)
+  8021c3:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8021ca:	74 2b                	je     8021f7 <open+0x94>
+	return fd2num(fd);
+  8021cc:	83 ec 0c             	sub    $0xc,%esp
+  8021cf:	ff 75 f4             	push   -0xc(%ebp)
+  8021d2:	e8 f3 f1 ff ff       	call   8013ca <fd2num>
+  8021d7:	89 c3                	mov    %eax,%ebx
+  8021d9:	83 c4 10             	add    $0x10,%esp
+}
+  8021dc:	89 d8                	mov    %ebx,%eax
+  8021de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021e1:	5b                   	pop    %ebx
+  8021e2:	5e                   	pop    %esi
+  8021e3:	5d                   	pop    %ebp
+  8021e4:	c3                   	ret
+		fd_close(fd, 0);
+  8021e5:	83 ec 08             	sub    $0x8,%esp
+  8021e8:	6a 00                	push   $0x0
+  8021ea:	ff 75 f4             	push   -0xc(%ebp)
+  8021ed:	e8 f8 f2 ff ff       	call   8014ea <fd_close>
+		return r;
+  8021f2:	83 c4 10             	add    $0x10,%esp
+  8021f5:	eb e5                	jmp    8021dc <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8021f7:	83 ec 0c             	sub    $0xc,%esp
+  8021fa:	ff 75 f4             	push   -0xc(%ebp)
+  8021fd:	e8 d8 f1 ff ff       	call   8013da <fd2data>
+  802202:	83 c4 0c             	add    $0xc,%esp
+  802205:	68 07 04 00 00       	push   $0x407
+  80220a:	50                   	push   %eax
+  80220b:	6a 00                	push   $0x0
+  80220d:	e8 b7 ed ff ff       	call   800fc9 <sys_page_alloc>
+  802212:	83 c4 10             	add    $0x10,%esp
+  802215:	85 c0                	test   %eax,%eax
+  802217:	75 b3                	jne    8021cc <open+0x69>
+		fd->fd_file.buffered = 1;
+  802219:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80221c:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802220:	eb aa                	jmp    8021cc <open+0x69>
+		return -E_BAD_PATH;
+  802222:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802227:	eb b3                	jmp    8021dc <open+0x79>
+
+00802229 <readdir>:
+{
+  802229:	55                   	push   %ebp
+  80222a:	89 e5                	mov    %esp,%ebp
+  80222c:	53                   	push   %ebx
+  80222d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802230:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802233:	50                   	push   %eax
+  802234:	ff 75 08             	push   0x8(%ebp)
+  802237:	e8 0b f2 ff ff       	call   801447 <fd_lookup>
+  80223c:	89 c3                	mov    %eax,%ebx
+  80223e:	83 c4 10             	add    $0x10,%esp
+  802241:	85 c0                	test   %eax,%eax
+  802243:	78 73                	js     8022b8 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802245:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802248:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  80224e:	39 08                	cmp    %ecx,(%eax)
+  802250:	0f 85 82 00 00 00    	jne    8022d8 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802256:	83 ec 0c             	sub    $0xc,%esp
+  802259:	50                   	push   %eax
+  80225a:	e8 c4 f9 ff ff       	call   801c23 <devfile_sync>
+  80225f:	89 c3                	mov    %eax,%ebx
+  802261:	83 c4 10             	add    $0x10,%esp
+  802264:	85 c0                	test   %eax,%eax
+  802266:	78 50                	js     8022b8 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802268:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80226b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80226e:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  802273:	8b 45 10             	mov    0x10(%ebp),%eax
+  802276:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  80227b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80227e:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  802283:	ba 00 00 00 00       	mov    $0x0,%edx
+  802288:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80228d:	e8 ed f8 ff ff       	call   801b7f <fsipc>
+  802292:	89 c3                	mov    %eax,%ebx
+  802294:	85 c0                	test   %eax,%eax
+  802296:	7e 20                	jle    8022b8 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  802298:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80229b:	72 22                	jb     8022bf <readdir+0x96>
+  80229d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8022a2:	7f 1b                	jg     8022bf <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8022a4:	83 ec 04             	sub    $0x4,%esp
+  8022a7:	50                   	push   %eax
+  8022a8:	68 00 70 80 00       	push   $0x807000
+  8022ad:	ff 75 0c             	push   0xc(%ebp)
+  8022b0:	e8 8e ea ff ff       	call   800d43 <memmove>
+	return r;
+  8022b5:	83 c4 10             	add    $0x10,%esp
+}
+  8022b8:	89 d8                	mov    %ebx,%eax
+  8022ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022bd:	c9                   	leave
+  8022be:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8022bf:	68 27 41 80 00       	push   $0x804127
+  8022c4:	68 00 41 80 00       	push   $0x804100
+  8022c9:	68 86 01 00 00       	push   $0x186
+  8022ce:	68 15 41 80 00       	push   $0x804115
+  8022d3:	e8 ad 10 00 00       	call   803385 <_panic>
+		return -E_NOT_SUPP;
+  8022d8:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8022dd:	eb d9                	jmp    8022b8 <readdir+0x8f>
+
+008022df <munmap>:
+{
+  8022df:	55                   	push   %ebp
+  8022e0:	89 e5                	mov    %esp,%ebp
+  8022e2:	56                   	push   %esi
+  8022e3:	53                   	push   %ebx
+  8022e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8022ea:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8022f0:	75 41                	jne    802333 <munmap+0x54>
+  8022f2:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8022f8:	77 39                	ja     802333 <munmap+0x54>
+  8022fa:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8022ff:	29 f0                	sub    %esi,%eax
+  802301:	39 d0                	cmp    %edx,%eax
+  802303:	72 35                	jb     80233a <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802305:	89 f3                	mov    %esi,%ebx
+  802307:	01 d6                	add    %edx,%esi
+  802309:	39 f3                	cmp    %esi,%ebx
+  80230b:	73 1a                	jae    802327 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  80230d:	83 ec 08             	sub    $0x8,%esp
+  802310:	53                   	push   %ebx
+  802311:	6a 00                	push   $0x0
+  802313:	e8 3e ed ff ff       	call   801056 <sys_page_unmap>
+  802318:	83 c4 10             	add    $0x10,%esp
+  80231b:	85 c0                	test   %eax,%eax
+  80231d:	78 0d                	js     80232c <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80231f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802325:	eb e2                	jmp    802309 <munmap+0x2a>
+	return 0;
+  802327:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80232c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80232f:	5b                   	pop    %ebx
+  802330:	5e                   	pop    %esi
+  802331:	5d                   	pop    %ebp
+  802332:	c3                   	ret
+		return -E_INVAL;
+  802333:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802338:	eb f2                	jmp    80232c <munmap+0x4d>
+  80233a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80233f:	eb eb                	jmp    80232c <munmap+0x4d>
+
+00802341 <mmap>:
+{
+  802341:	55                   	push   %ebp
+  802342:	89 e5                	mov    %esp,%ebp
+  802344:	57                   	push   %edi
+  802345:	56                   	push   %esi
+  802346:	53                   	push   %ebx
+  802347:	83 ec 34             	sub    $0x34,%esp
+  80234a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80234d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802350:	50                   	push   %eax
+  802351:	ff 75 18             	push   0x18(%ebp)
+  802354:	e8 ee f0 ff ff       	call   801447 <fd_lookup>
+  802359:	89 c3                	mov    %eax,%ebx
+  80235b:	83 c4 10             	add    $0x10,%esp
+  80235e:	85 c0                	test   %eax,%eax
+  802360:	0f 88 0e 01 00 00    	js     802474 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802366:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802369:	a1 20 50 80 00       	mov    0x805020,%eax
+  80236e:	39 02                	cmp    %eax,(%edx)
+  802370:	0f 85 50 01 00 00    	jne    8024c6 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802376:	8b 45 10             	mov    0x10(%ebp),%eax
+  802379:	83 e0 02             	and    $0x2,%eax
+  80237c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80237f:	74 0a                	je     80238b <mmap+0x4a>
+  802381:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802385:	0f 84 42 01 00 00    	je     8024cd <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  80238b:	8b 42 08             	mov    0x8(%edx),%eax
+  80238e:	83 e0 03             	and    $0x3,%eax
+  802391:	83 f8 01             	cmp    $0x1,%eax
+  802394:	0f 84 3a 01 00 00    	je     8024d4 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  80239a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80239d:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8023a0:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8023a5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8023a8:	0f 85 2d 01 00 00    	jne    8024db <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8023ae:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8023b2:	0f 88 2a 01 00 00    	js     8024e2 <mmap+0x1a1>
+  8023b8:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8023bf:	0f 87 1d 01 00 00    	ja     8024e2 <mmap+0x1a1>
+  8023c5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8023ca:	2b 45 08             	sub    0x8(%ebp),%eax
+  8023cd:	39 f8                	cmp    %edi,%eax
+  8023cf:	0f 82 14 01 00 00    	jb     8024e9 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8023d5:	83 ec 0c             	sub    $0xc,%esp
+  8023d8:	52                   	push   %edx
+  8023d9:	e8 45 f8 ff ff       	call   801c23 <devfile_sync>
+  8023de:	89 c3                	mov    %eax,%ebx
+  8023e0:	83 c4 10             	add    $0x10,%esp
+  8023e3:	85 c0                	test   %eax,%eax
+  8023e5:	0f 88 89 00 00 00    	js     802474 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8023eb:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8023f1:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8023f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8023fc:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8023ff:	39 fe                	cmp    %edi,%esi
+  802401:	73 7b                	jae    80247e <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  802403:	89 f8                	mov    %edi,%eax
+  802405:	29 f0                	sub    %esi,%eax
+  802407:	c1 e8 0c             	shr    $0xc,%eax
+  80240a:	ba 40 00 00 00       	mov    $0x40,%edx
+  80240f:	39 d0                	cmp    %edx,%eax
+  802411:	0f 47 c2             	cmova  %edx,%eax
+  802414:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802417:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80241a:	8b 52 0c             	mov    0xc(%edx),%edx
+  80241d:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  802423:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802426:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  80242c:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802431:	89 f2                	mov    %esi,%edx
+  802433:	03 55 08             	add    0x8(%ebp),%edx
+  802436:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802439:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80243e:	e8 ea f6 ff ff       	call   801b2d <fsipcv>
+  802443:	85 c0                	test   %eax,%eax
+  802445:	7e 12                	jle    802459 <mmap+0x118>
+  802447:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80244a:	85 c0                	test   %eax,%eax
+  80244c:	0f 84 9e 00 00 00    	je     8024f0 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802452:	c1 e0 0c             	shl    $0xc,%eax
+  802455:	01 c6                	add    %eax,%esi
+  802457:	eb a6                	jmp    8023ff <mmap+0xbe>
+			munmap(addr, done);
+  802459:	89 c3                	mov    %eax,%ebx
+  80245b:	83 ec 08             	sub    $0x8,%esp
+  80245e:	56                   	push   %esi
+  80245f:	ff 75 08             	push   0x8(%ebp)
+  802462:	e8 78 fe ff ff       	call   8022df <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802467:	83 c4 10             	add    $0x10,%esp
+  80246a:	85 db                	test   %ebx,%ebx
+  80246c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802471:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802474:	89 d8                	mov    %ebx,%eax
+  802476:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802479:	5b                   	pop    %ebx
+  80247a:	5e                   	pop    %esi
+  80247b:	5f                   	pop    %edi
+  80247c:	5d                   	pop    %ebp
+  80247d:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80247e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802481:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802483:	85 c0                	test   %eax,%eax
+  802485:	74 ed                	je     802474 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802487:	be 00 00 00 00       	mov    $0x0,%esi
+  80248c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80248f:	39 fe                	cmp    %edi,%esi
+  802491:	73 2e                	jae    8024c1 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802493:	83 ec 0c             	sub    $0xc,%esp
+  802496:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802499:	50                   	push   %eax
+  80249a:	e8 43 10 00 00       	call   8034e2 <cowpage>
+  80249f:	83 c4 10             	add    $0x10,%esp
+  8024a2:	85 c0                	test   %eax,%eax
+  8024a4:	78 08                	js     8024ae <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8024a6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8024ac:	eb e1                	jmp    80248f <mmap+0x14e>
+				munmap(addr, len);
+  8024ae:	89 c3                	mov    %eax,%ebx
+  8024b0:	83 ec 08             	sub    $0x8,%esp
+  8024b3:	57                   	push   %edi
+  8024b4:	ff 75 08             	push   0x8(%ebp)
+  8024b7:	e8 23 fe ff ff       	call   8022df <munmap>
+				return r;
+  8024bc:	83 c4 10             	add    $0x10,%esp
+  8024bf:	eb b3                	jmp    802474 <mmap+0x133>
+	return 0;
+  8024c1:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8024c4:	eb ae                	jmp    802474 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8024c6:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8024cb:	eb a7                	jmp    802474 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8024cd:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8024d2:	eb a0                	jmp    802474 <mmap+0x133>
+		return -E_INVAL;
+  8024d4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024d9:	eb 99                	jmp    802474 <mmap+0x133>
+  8024db:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024e0:	eb 92                	jmp    802474 <mmap+0x133>
+  8024e2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024e7:	eb 8b                	jmp    802474 <mmap+0x133>
+  8024e9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024ee:	eb 84                	jmp    802474 <mmap+0x133>
+			munmap(addr, done);
+  8024f0:	83 ec 08             	sub    $0x8,%esp
+  8024f3:	56                   	push   %esi
+  8024f4:	ff 75 08             	push   0x8(%ebp)
+  8024f7:	e8 e3 fd ff ff       	call   8022df <munmap>
+  8024fc:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8024ff:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802504:	e9 6b ff ff ff       	jmp    802474 <mmap+0x133>
+
+00802509 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802509:	55                   	push   %ebp
+  80250a:	89 e5                	mov    %esp,%ebp
+  80250c:	56                   	push   %esi
+  80250d:	53                   	push   %ebx
+  80250e:	83 ec 10             	sub    $0x10,%esp
+  802511:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802514:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802517:	8b 45 08             	mov    0x8(%ebp),%eax
+  80251a:	e8 3d f9 ff ff       	call   801e5c <fsring_slot>
+  80251f:	85 c0                	test   %eax,%eax
+  802521:	78 60                	js     802583 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802523:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802526:	8b 56 08             	mov    0x8(%esi),%edx
+  802529:	83 e2 03             	and    $0x3,%edx
+  80252c:	83 fa 01             	cmp    $0x1,%edx
+  80252f:	74 59                	je     80258a <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802531:	ba 01 00 00 00       	mov    $0x1,%edx
+  802536:	89 c1                	mov    %eax,%ecx
+  802538:	d3 e2                	shl    %cl,%edx
+  80253a:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802540:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802543:	c1 e2 02             	shl    $0x2,%edx
+  802546:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  80254c:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  802553:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802556:	8b 55 18             	mov    0x18(%ebp),%edx
+  802559:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80255c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80255f:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802562:	83 ec 08             	sub    $0x8,%esp
+  802565:	50                   	push   %eax
+  802566:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80256b:	39 c3                	cmp    %eax,%ebx
+  80256d:	0f 47 d8             	cmova  %eax,%ebx
+  802570:	53                   	push   %ebx
+  802571:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802574:	89 f2                	mov    %esi,%edx
+  802576:	b8 03 00 00 00       	mov    $0x3,%eax
+  80257b:	e8 1e f5 ff ff       	call   801a9e <fsring_post>
+  802580:	83 c4 10             	add    $0x10,%esp
+}
+  802583:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802586:	5b                   	pop    %ebx
+  802587:	5e                   	pop    %esi
+  802588:	5d                   	pop    %ebp
+  802589:	c3                   	ret
+		return -E_INVAL;
+  80258a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80258f:	eb f2                	jmp    802583 <fsring_read+0x7a>
+
+00802591 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802591:	55                   	push   %ebp
+  802592:	89 e5                	mov    %esp,%ebp
+  802594:	56                   	push   %esi
+  802595:	53                   	push   %ebx
+  802596:	83 ec 10             	sub    $0x10,%esp
+  802599:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80259c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80259f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a2:	e8 b5 f8 ff ff       	call   801e5c <fsring_slot>
+  8025a7:	89 c3                	mov    %eax,%ebx
+  8025a9:	85 c0                	test   %eax,%eax
+  8025ab:	78 77                	js     802624 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8025ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025b0:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8025b4:	74 77                	je     80262d <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8025b6:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8025bb:	39 c6                	cmp    %eax,%esi
+  8025bd:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8025c0:	83 ec 04             	sub    $0x4,%esp
+  8025c3:	56                   	push   %esi
+  8025c4:	ff 75 0c             	push   0xc(%ebp)
+  8025c7:	89 d8                	mov    %ebx,%eax
+  8025c9:	c1 e0 0c             	shl    $0xc,%eax
+  8025cc:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8025d2:	50                   	push   %eax
+  8025d3:	e8 6b e7 ff ff       	call   800d43 <memmove>
+	fsring_busy |= 1 << slot;
+  8025d8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025dd:	89 d9                	mov    %ebx,%ecx
+  8025df:	d3 e0                	shl    %cl,%eax
+  8025e1:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8025e7:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8025ea:	c1 e0 02             	shl    $0x2,%eax
+  8025ed:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  8025f3:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  8025fa:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8025fd:	8b 45 18             	mov    0x18(%ebp),%eax
+  802600:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  802603:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  80260a:	83 c4 08             	add    $0x8,%esp
+  80260d:	53                   	push   %ebx
+  80260e:	56                   	push   %esi
+  80260f:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802612:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802615:	b8 04 00 00 00       	mov    $0x4,%eax
+  80261a:	e8 7f f4 ff ff       	call   801a9e <fsring_post>
+  80261f:	89 c3                	mov    %eax,%ebx
+  802621:	83 c4 10             	add    $0x10,%esp
+}
+  802624:	89 d8                	mov    %ebx,%eax
+  802626:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802629:	5b                   	pop    %ebx
+  80262a:	5e                   	pop    %esi
+  80262b:	5d                   	pop    %ebp
+  80262c:	c3                   	ret
+		return -E_INVAL;
+  80262d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802632:	eb f0                	jmp    802624 <fsring_write+0x93>
+
+00802634 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802634:	55                   	push   %ebp
+  802635:	89 e5                	mov    %esp,%ebp
+  802637:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80263a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80263d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802640:	e8 17 f8 ff ff       	call   801e5c <fsring_slot>
+  802645:	85 c0                	test   %eax,%eax
+  802647:	78 4c                	js     802695 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802649:	ba 01 00 00 00       	mov    $0x1,%edx
+  80264e:	89 c1                	mov    %eax,%ecx
+  802650:	d3 e2                	shl    %cl,%edx
+  802652:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802658:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80265b:	c1 e2 02             	shl    $0x2,%edx
+  80265e:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  802664:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  80266b:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80266e:	8b 55 10             	mov    0x10(%ebp),%edx
+  802671:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802674:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802677:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80267a:	83 ec 08             	sub    $0x8,%esp
+  80267d:	50                   	push   %eax
+  80267e:	6a 00                	push   $0x0
+  802680:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802685:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802688:	b8 05 00 00 00       	mov    $0x5,%eax
+  80268d:	e8 0c f4 ff ff       	call   801a9e <fsring_post>
+  802692:	83 c4 10             	add    $0x10,%esp
+}
+  802695:	c9                   	leave
+  802696:	c3                   	ret
+
+00802697 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802697:	55                   	push   %ebp
+  802698:	89 e5                	mov    %esp,%ebp
+  80269a:	57                   	push   %edi
+  80269b:	56                   	push   %esi
+  80269c:	53                   	push   %ebx
+  80269d:	83 ec 1c             	sub    $0x1c,%esp
+  8026a0:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8026a4:	a1 10 60 80 00       	mov    0x806010,%eax
+  8026a9:	8b 40 48             	mov    0x48(%eax),%eax
+  8026ac:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  8026b2:	74 12                	je     8026c6 <fsring_reap+0x2f>
+		return 0;
+  8026b4:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8026b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026bc:	5b                   	pop    %ebx
+  8026bd:	5e                   	pop    %esi
+  8026be:	5f                   	pop    %edi
+  8026bf:	5d                   	pop    %ebp
+  8026c0:	c3                   	ret
+		sys_yield();
+  8026c1:	e8 e4 e8 ff ff       	call   800faa <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8026c6:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8026cc:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8026d1:	39 c2                	cmp    %eax,%edx
+  8026d3:	75 18                	jne    8026ed <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8026d5:	84 db                	test   %bl,%bl
+  8026d7:	0f 84 21 01 00 00    	je     8027fe <fsring_reap+0x167>
+  8026dd:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  8026e4:	75 db                	jne    8026c1 <fsring_reap+0x2a>
+			return 0;
+  8026e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026eb:	eb cc                	jmp    8026b9 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8026ed:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8026f2:	83 e0 0f             	and    $0xf,%eax
+  8026f5:	83 c0 2a             	add    $0x2a,%eax
+  8026f8:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8026ff:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802706:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80270b:	83 c0 01             	add    $0x1,%eax
+  80270e:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802713:	83 fb 0f             	cmp    $0xf,%ebx
+  802716:	77 5b                	ja     802773 <fsring_reap+0xdc>
+  802718:	be 01 00 00 00       	mov    $0x1,%esi
+  80271d:	89 d9                	mov    %ebx,%ecx
+  80271f:	d3 e6                	shl    %cl,%esi
+  802721:	89 f0                	mov    %esi,%eax
+  802723:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  802729:	74 48                	je     802773 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  80272b:	89 d8                	mov    %ebx,%eax
+  80272d:	c1 e0 0c             	shl    $0xc,%eax
+  802730:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802736:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802739:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80273c:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  802743:	83 f8 03             	cmp    $0x3,%eax
+  802746:	74 40                	je     802788 <fsring_reap+0xf1>
+  802748:	83 f8 05             	cmp    $0x5,%eax
+  80274b:	74 64                	je     8027b1 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  80274d:	f7 d6                	not    %esi
+  80274f:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802755:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802758:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  80275f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802762:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802764:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802767:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802769:	b8 01 00 00 00       	mov    $0x1,%eax
+  80276e:	e9 46 ff ff ff       	jmp    8026b9 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802773:	53                   	push   %ebx
+  802774:	68 3d 41 80 00       	push   $0x80413d
+  802779:	68 8f 02 00 00       	push   $0x28f
+  80277e:	68 15 41 80 00       	push   $0x804115
+  802783:	e8 fd 0b 00 00       	call   803385 <_panic>
+		if (cqe.cqe_result > 0)
+  802788:	85 ff                	test   %edi,%edi
+  80278a:	7e c1                	jle    80274d <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80278c:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80278f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802794:	39 c7                	cmp    %eax,%edi
+  802796:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802799:	50                   	push   %eax
+  80279a:	ff 75 e4             	push   -0x1c(%ebp)
+  80279d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8027a0:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  8027a7:	e8 97 e5 ff ff       	call   800d43 <memmove>
+  8027ac:	83 c4 10             	add    $0x10,%esp
+  8027af:	eb 9c                	jmp    80274d <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8027b1:	85 ff                	test   %edi,%edi
+  8027b3:	75 98                	jne    80274d <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  8027b5:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8027b8:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8027bf:	83 ec 08             	sub    $0x8,%esp
+  8027c2:	ff 75 e4             	push   -0x1c(%ebp)
+  8027c5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8027c8:	51                   	push   %ecx
+  8027c9:	e8 ef e3 ff ff       	call   800bbd <strcpy>
+			st->st_size = ret->ret_size;
+  8027ce:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8027d1:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8027d7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8027da:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8027e0:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8027e6:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8027ec:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  8027f3:	50 80 00 
+  8027f6:	83 c4 10             	add    $0x10,%esp
+  8027f9:	e9 4f ff ff ff       	jmp    80274d <fsring_reap+0xb6>
+			return 0;
+  8027fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802803:	e9 b1 fe ff ff       	jmp    8026b9 <fsring_reap+0x22>
+
+00802808 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802808:	55                   	push   %ebp
+  802809:	89 e5                	mov    %esp,%ebp
+  80280b:	57                   	push   %edi
+  80280c:	56                   	push   %esi
+  80280d:	53                   	push   %ebx
+  80280e:	83 ec 28             	sub    $0x28,%esp
+  802811:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802814:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802817:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80281a:	53                   	push   %ebx
+  80281b:	e8 62 e3 ff ff       	call   800b82 <strlen>
+  802820:	83 c4 10             	add    $0x10,%esp
+  802823:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802828:	0f 8f 02 01 00 00    	jg     802930 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  80282e:	83 ec 08             	sub    $0x8,%esp
+  802831:	53                   	push   %ebx
+  802832:	68 00 70 80 00       	push   $0x807000
+  802837:	e8 81 e3 ff ff       	call   800bbd <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  80283c:	83 c4 10             	add    $0x10,%esp
+  80283f:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802845:	76 69                	jbe    8028b0 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802847:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80284a:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802850:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802855:	29 d1                	sub    %edx,%ecx
+  802857:	39 f9                	cmp    %edi,%ecx
+  802859:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80285c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80285f:	89 f9                	mov    %edi,%ecx
+  802861:	01 c1                	add    %eax,%ecx
+  802863:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802866:	eb 0f                	jmp    802877 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802868:	0f b6 10             	movzbl (%eax),%edx
+  80286b:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80286d:	05 00 10 00 00       	add    $0x1000,%eax
+  802872:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802877:	39 c8                	cmp    %ecx,%eax
+  802879:	72 ed                	jb     802868 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  80287b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80287e:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802884:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  80288a:	83 ec 0c             	sub    $0xc,%esp
+  80288d:	6a 07                	push   $0x7
+  80288f:	89 f9                	mov    %edi,%ecx
+  802891:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802894:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802899:	e8 3f f1 ff ff       	call   8019dd <fsipc_pages>
+  80289e:	89 c7                	mov    %eax,%edi
+  8028a0:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8028a3:	85 f6                	test   %esi,%esi
+  8028a5:	74 7f                	je     802926 <file_slurp+0x11e>
+  8028a7:	8d 43 01             	lea    0x1(%ebx),%eax
+  8028aa:	85 ff                	test   %edi,%edi
+  8028ac:	79 3c                	jns    8028ea <file_slurp+0xe2>
+  8028ae:	eb 76                	jmp    802926 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8028b0:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8028b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028bb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8028c0:	e8 ba f2 ff ff       	call   801b7f <fsipc>
+  8028c5:	89 c7                	mov    %eax,%edi
+  8028c7:	85 c0                	test   %eax,%eax
+  8028c9:	7e d8                	jle    8028a3 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8028cb:	83 ec 04             	sub    $0x4,%esp
+  8028ce:	50                   	push   %eax
+  8028cf:	68 08 70 80 00       	push   $0x807008
+  8028d4:	ff 75 0c             	push   0xc(%ebp)
+  8028d7:	e8 67 e4 ff ff       	call   800d43 <memmove>
+  8028dc:	83 c4 10             	add    $0x10,%esp
+  8028df:	eb c2                	jmp    8028a3 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8028e1:	80 fa 2f             	cmp    $0x2f,%dl
+  8028e4:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8028e7:	83 c0 01             	add    $0x1,%eax
+  8028ea:	89 c1                	mov    %eax,%ecx
+  8028ec:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8028f0:	84 d2                	test   %dl,%dl
+  8028f2:	75 ed                	jne    8028e1 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8028f4:	83 ec 04             	sub    $0x4,%esp
+  8028f7:	68 80 00 00 00       	push   $0x80
+  8028fc:	53                   	push   %ebx
+  8028fd:	56                   	push   %esi
+  8028fe:	e8 30 e3 ff ff       	call   800c33 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802903:	a1 00 70 80 00       	mov    0x807000,%eax
+  802908:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  80290e:	a1 04 70 80 00       	mov    0x807004,%eax
+  802913:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802919:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  802920:	50 80 00 
+  802923:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802926:	89 f8                	mov    %edi,%eax
+  802928:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80292b:	5b                   	pop    %ebx
+  80292c:	5e                   	pop    %esi
+  80292d:	5f                   	pop    %edi
+  80292e:	5d                   	pop    %ebp
+  80292f:	c3                   	ret
+		return -E_BAD_PATH;
+  802930:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802935:	eb ef                	jmp    802926 <file_slurp+0x11e>
+
+00802937 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802937:	55                   	push   %ebp
+  802938:	89 e5                	mov    %esp,%ebp
+  80293a:	53                   	push   %ebx
+  80293b:	83 ec 10             	sub    $0x10,%esp
+  80293e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802941:	53                   	push   %ebx
+  802942:	e8 3b e2 ff ff       	call   800b82 <strlen>
+  802947:	83 c4 10             	add    $0x10,%esp
+  80294a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80294f:	7f 25                	jg     802976 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802951:	83 ec 08             	sub    $0x8,%esp
+  802954:	53                   	push   %ebx
+  802955:	68 00 70 80 00       	push   $0x807000
+  80295a:	e8 5e e2 ff ff       	call   800bbd <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80295f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802964:	b8 07 00 00 00       	mov    $0x7,%eax
+  802969:	e8 11 f2 ff ff       	call   801b7f <fsipc>
+  80296e:	83 c4 10             	add    $0x10,%esp
+}
+  802971:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802974:	c9                   	leave
+  802975:	c3                   	ret
+		return -E_BAD_PATH;
+  802976:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80297b:	eb f4                	jmp    802971 <remove+0x3a>
+
+0080297d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80297d:	55                   	push   %ebp
+  80297e:	89 e5                	mov    %esp,%ebp
+  802980:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802983:	ba 00 00 00 00       	mov    $0x0,%edx
+  802988:	b8 08 00 00 00       	mov    $0x8,%eax
+  80298d:	e8 ed f1 ff ff       	call   801b7f <fsipc>
+}
+  802992:	c9                   	leave
+  802993:	c3                   	ret
+
+00802994 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802994:	55                   	push   %ebp
+  802995:	89 e5                	mov    %esp,%ebp
+  802997:	57                   	push   %edi
+  802998:	56                   	push   %esi
+  802999:	53                   	push   %ebx
+  80299a:	83 ec 18             	sub    $0x18,%esp
+  80299d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8029a0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8029a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8029a6:	57                   	push   %edi
+  8029a7:	e8 d6 e1 ff ff       	call   800b82 <strlen>
+  8029ac:	83 c4 10             	add    $0x10,%esp
+  8029af:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8029b4:	7f 4c                	jg     802a02 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  8029b6:	83 ec 08             	sub    $0x8,%esp
+  8029b9:	57                   	push   %edi
+  8029ba:	68 00 70 80 00       	push   $0x807000
+  8029bf:	e8 f9 e1 ff ff       	call   800bbd <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  8029c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029c9:	b8 10 00 00 00       	mov    $0x10,%eax
+  8029ce:	e8 ac f1 ff ff       	call   801b7f <fsipc>
+  8029d3:	83 c4 10             	add    $0x10,%esp
+  8029d6:	85 c0                	test   %eax,%eax
+  8029d8:	78 20                	js     8029fa <defrag+0x66>
+		return r;
+	if (before)
+  8029da:	85 f6                	test   %esi,%esi
+  8029dc:	74 07                	je     8029e5 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  8029de:	a1 00 70 80 00       	mov    0x807000,%eax
+  8029e3:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  8029e5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  8029ea:	85 db                	test   %ebx,%ebx
+  8029ec:	74 0c                	je     8029fa <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  8029ee:	a1 04 70 80 00       	mov    0x807004,%eax
+  8029f3:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8029f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029fd:	5b                   	pop    %ebx
+  8029fe:	5e                   	pop    %esi
+  8029ff:	5f                   	pop    %edi
+  802a00:	5d                   	pop    %ebp
+  802a01:	c3                   	ret
+		return -E_BAD_PATH;
+  802a02:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802a07:	eb f1                	jmp    8029fa <defrag+0x66>
+
+00802a09 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802a09:	55                   	push   %ebp
+  802a0a:	89 e5                	mov    %esp,%ebp
+  802a0c:	53                   	push   %ebx
+  802a0d:	83 ec 04             	sub    $0x4,%esp
+  802a10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802a13:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a18:	b8 11 00 00 00       	mov    $0x11,%eax
+  802a1d:	e8 5d f1 ff ff       	call   801b7f <fsipc>
+  802a22:	85 c0                	test   %eax,%eax
+  802a24:	78 34                	js     802a5a <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802a26:	a1 00 70 80 00       	mov    0x807000,%eax
+  802a2b:	89 03                	mov    %eax,(%ebx)
+  802a2d:	a1 04 70 80 00       	mov    0x807004,%eax
+  802a32:	89 43 04             	mov    %eax,0x4(%ebx)
+  802a35:	a1 08 70 80 00       	mov    0x807008,%eax
+  802a3a:	89 43 08             	mov    %eax,0x8(%ebx)
+  802a3d:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  802a42:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802a45:	a1 10 70 80 00       	mov    0x807010,%eax
+  802a4a:	89 43 10             	mov    %eax,0x10(%ebx)
+  802a4d:	a1 14 70 80 00       	mov    0x807014,%eax
+  802a52:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802a55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a5d:	c9                   	leave
+  802a5e:	c3                   	ret
+
+00802a5f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a5f:	55                   	push   %ebp
+  802a60:	89 e5                	mov    %esp,%ebp
+  802a62:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802a65:	68 56 41 80 00       	push   $0x804156
+  802a6a:	ff 75 0c             	push   0xc(%ebp)
+  802a6d:	e8 4b e1 ff ff       	call   800bbd <strcpy>
+	return 0;
+}
+  802a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a77:	c9                   	leave
+  802a78:	c3                   	ret
+
+00802a79 <devsock_close>:
+{
+  802a79:	55                   	push   %ebp
+  802a7a:	89 e5                	mov    %esp,%ebp
+  802a7c:	53                   	push   %ebx
+  802a7d:	83 ec 10             	sub    $0x10,%esp
+  802a80:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802a83:	53                   	push   %ebx
+  802a84:	e8 3a 0e 00 00       	call   8038c3 <pageref>
+  802a89:	89 c2                	mov    %eax,%edx
+  802a8b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802a93:	83 fa 01             	cmp    $0x1,%edx
+  802a96:	74 05                	je     802a9d <devsock_close+0x24>
+}
+  802a98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a9b:	c9                   	leave
+  802a9c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802a9d:	83 ec 0c             	sub    $0xc,%esp
+  802aa0:	ff 73 0c             	push   0xc(%ebx)
+  802aa3:	e8 b7 02 00 00       	call   802d5f <nsipc_close>
+  802aa8:	83 c4 10             	add    $0x10,%esp
+  802aab:	eb eb                	jmp    802a98 <devsock_close+0x1f>
+
+00802aad <devsock_write>:
+{
+  802aad:	55                   	push   %ebp
+  802aae:	89 e5                	mov    %esp,%ebp
+  802ab0:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802ab3:	6a 00                	push   $0x0
+  802ab5:	ff 75 10             	push   0x10(%ebp)
+  802ab8:	ff 75 0c             	push   0xc(%ebp)
+  802abb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802abe:	ff 70 0c             	push   0xc(%eax)
+  802ac1:	e8 79 03 00 00       	call   802e3f <nsipc_send>
+}
+  802ac6:	c9                   	leave
+  802ac7:	c3                   	ret
+
+00802ac8 <devsock_read>:
+{
+  802ac8:	55                   	push   %ebp
+  802ac9:	89 e5                	mov    %esp,%ebp
+  802acb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802ace:	6a 00                	push   $0x0
+  802ad0:	ff 75 10             	push   0x10(%ebp)
+  802ad3:	ff 75 0c             	push   0xc(%ebp)
+  802ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad9:	ff 70 0c             	push   0xc(%eax)
+  802adc:	e8 ef 02 00 00       	call   802dd0 <nsipc_recv>
+}
+  802ae1:	c9                   	leave
+  802ae2:	c3                   	ret
+
+00802ae3 <fd2sockid>:
+{
+  802ae3:	55                   	push   %ebp
+  802ae4:	89 e5                	mov    %esp,%ebp
+  802ae6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802ae9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802aec:	52                   	push   %edx
+  802aed:	50                   	push   %eax
+  802aee:	e8 54 e9 ff ff       	call   801447 <fd_lookup>
+  802af3:	83 c4 10             	add    $0x10,%esp
+  802af6:	85 c0                	test   %eax,%eax
+  802af8:	78 10                	js     802b0a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802afa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802afd:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802b03:	39 08                	cmp    %ecx,(%eax)
+  802b05:	75 05                	jne    802b0c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802b07:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802b0a:	c9                   	leave
+  802b0b:	c3                   	ret
+		return -E_NOT_SUPP;
+  802b0c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802b11:	eb f7                	jmp    802b0a <fd2sockid+0x27>
+
+00802b13 <alloc_sockfd>:
+{
+  802b13:	55                   	push   %ebp
+  802b14:	89 e5                	mov    %esp,%ebp
+  802b16:	56                   	push   %esi
+  802b17:	53                   	push   %ebx
+  802b18:	83 ec 1c             	sub    $0x1c,%esp
+  802b1b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802b1d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b20:	50                   	push   %eax
+  802b21:	e8 cb e8 ff ff       	call   8013f1 <fd_alloc>
+  802b26:	89 c3                	mov    %eax,%ebx
+  802b28:	83 c4 10             	add    $0x10,%esp
+  802b2b:	85 c0                	test   %eax,%eax
+  802b2d:	78 43                	js     802b72 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802b2f:	83 ec 04             	sub    $0x4,%esp
+  802b32:	68 07 04 00 00       	push   $0x407
+  802b37:	ff 75 f4             	push   -0xc(%ebp)
+  802b3a:	6a 00                	push   $0x0
+  802b3c:	e8 88 e4 ff ff       	call   800fc9 <sys_page_alloc>
+  802b41:	89 c3                	mov    %eax,%ebx
+  802b43:	83 c4 10             	add    $0x10,%esp
+  802b46:	85 c0                	test   %eax,%eax
+  802b48:	78 28                	js     802b72 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802b4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b4d:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802b53:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802b55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b58:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802b5f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802b62:	83 ec 0c             	sub    $0xc,%esp
+  802b65:	50                   	push   %eax
+  802b66:	e8 5f e8 ff ff       	call   8013ca <fd2num>
+  802b6b:	89 c3                	mov    %eax,%ebx
+  802b6d:	83 c4 10             	add    $0x10,%esp
+  802b70:	eb 0c                	jmp    802b7e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802b72:	83 ec 0c             	sub    $0xc,%esp
+  802b75:	56                   	push   %esi
+  802b76:	e8 e4 01 00 00       	call   802d5f <nsipc_close>
+		return r;
+  802b7b:	83 c4 10             	add    $0x10,%esp
+}
+  802b7e:	89 d8                	mov    %ebx,%eax
+  802b80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b83:	5b                   	pop    %ebx
+  802b84:	5e                   	pop    %esi
+  802b85:	5d                   	pop    %ebp
+  802b86:	c3                   	ret
+
+00802b87 <accept>:
+{
+  802b87:	55                   	push   %ebp
+  802b88:	89 e5                	mov    %esp,%ebp
+  802b8a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b90:	e8 4e ff ff ff       	call   802ae3 <fd2sockid>
+  802b95:	85 c0                	test   %eax,%eax
+  802b97:	78 1b                	js     802bb4 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802b99:	83 ec 04             	sub    $0x4,%esp
+  802b9c:	ff 75 10             	push   0x10(%ebp)
+  802b9f:	ff 75 0c             	push   0xc(%ebp)
+  802ba2:	50                   	push   %eax
+  802ba3:	e8 0e 01 00 00       	call   802cb6 <nsipc_accept>
+  802ba8:	83 c4 10             	add    $0x10,%esp
+  802bab:	85 c0                	test   %eax,%eax
+  802bad:	78 05                	js     802bb4 <accept+0x2d>
+	return alloc_sockfd(r);
+  802baf:	e8 5f ff ff ff       	call   802b13 <alloc_sockfd>
+}
+  802bb4:	c9                   	leave
+  802bb5:	c3                   	ret
+
+00802bb6 <bind>:
+{
+  802bb6:	55                   	push   %ebp
+  802bb7:	89 e5                	mov    %esp,%ebp
+  802bb9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bbf:	e8 1f ff ff ff       	call   802ae3 <fd2sockid>
+  802bc4:	85 c0                	test   %eax,%eax
+  802bc6:	78 12                	js     802bda <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802bc8:	83 ec 04             	sub    $0x4,%esp
+  802bcb:	ff 75 10             	push   0x10(%ebp)
+  802bce:	ff 75 0c             	push   0xc(%ebp)
+  802bd1:	50                   	push   %eax
+  802bd2:	e8 31 01 00 00       	call   802d08 <nsipc_bind>
+  802bd7:	83 c4 10             	add    $0x10,%esp
+}
+  802bda:	c9                   	leave
+  802bdb:	c3                   	ret
+
+00802bdc <shutdown>:
+{
+  802bdc:	55                   	push   %ebp
+  802bdd:	89 e5                	mov    %esp,%ebp
+  802bdf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802be2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be5:	e8 f9 fe ff ff       	call   802ae3 <fd2sockid>
+  802bea:	85 c0                	test   %eax,%eax
+  802bec:	78 0f                	js     802bfd <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802bee:	83 ec 08             	sub    $0x8,%esp
+  802bf1:	ff 75 0c             	push   0xc(%ebp)
+  802bf4:	50                   	push   %eax
+  802bf5:	e8 43 01 00 00       	call   802d3d <nsipc_shutdown>
+  802bfa:	83 c4 10             	add    $0x10,%esp
+}
+  802bfd:	c9                   	leave
+  802bfe:	c3                   	ret
+
+00802bff <connect>:
+{
+  802bff:	55                   	push   %ebp
+  802c00:	89 e5                	mov    %esp,%ebp
+  802c02:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c05:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c08:	e8 d6 fe ff ff       	call   802ae3 <fd2sockid>
+  802c0d:	85 c0                	test   %eax,%eax
+  802c0f:	78 12                	js     802c23 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802c11:	83 ec 04             	sub    $0x4,%esp
+  802c14:	ff 75 10             	push   0x10(%ebp)
+  802c17:	ff 75 0c             	push   0xc(%ebp)
+  802c1a:	50                   	push   %eax
+  802c1b:	e8 59 01 00 00       	call   802d79 <nsipc_connect>
+  802c20:	83 c4 10             	add    $0x10,%esp
+}
+  802c23:	c9                   	leave
+  802c24:	c3                   	ret
+
+00802c25 <listen>:
+{
+  802c25:	55                   	push   %ebp
+  802c26:	89 e5                	mov    %esp,%ebp
+  802c28:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c2e:	e8 b0 fe ff ff       	call   802ae3 <fd2sockid>
+  802c33:	85 c0                	test   %eax,%eax
+  802c35:	78 0f                	js     802c46 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c37:	83 ec 08             	sub    $0x8,%esp
+  802c3a:	ff 75 0c             	push   0xc(%ebp)
+  802c3d:	50                   	push   %eax
+  802c3e:	e8 6b 01 00 00       	call   802dae <nsipc_listen>
+  802c43:	83 c4 10             	add    $0x10,%esp
+}
+  802c46:	c9                   	leave
+  802c47:	c3                   	ret
+
+00802c48 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802c48:	55                   	push   %ebp
+  802c49:	89 e5                	mov    %esp,%ebp
+  802c4b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802c4e:	ff 75 10             	push   0x10(%ebp)
+  802c51:	ff 75 0c             	push   0xc(%ebp)
+  802c54:	ff 75 08             	push   0x8(%ebp)
+  802c57:	e8 41 02 00 00       	call   802e9d <nsipc_socket>
+  802c5c:	83 c4 10             	add    $0x10,%esp
+  802c5f:	85 c0                	test   %eax,%eax
+  802c61:	78 05                	js     802c68 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802c63:	e8 ab fe ff ff       	call   802b13 <alloc_sockfd>
+}
+  802c68:	c9                   	leave
+  802c69:	c3                   	ret
+
+00802c6a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802c6a:	55                   	push   %ebp
+  802c6b:	89 e5                	mov    %esp,%ebp
+  802c6d:	53                   	push   %ebx
+  802c6e:	83 ec 04             	sub    $0x4,%esp
+  802c71:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802c73:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802c7a:	74 26                	je     802ca2 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802c7c:	6a 07                	push   $0x7
+  802c7e:	68 00 90 80 00       	push   $0x809000
+  802c83:	53                   	push   %ebx
+  802c84:	ff 35 00 a0 80 00    	push   0x80a000
+  802c8a:	e8 bc 0a 00 00       	call   80374b <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802c8f:	83 c4 0c             	add    $0xc,%esp
+  802c92:	6a 00                	push   $0x0
+  802c94:	6a 00                	push   $0x0
+  802c96:	6a 00                	push   $0x0
+  802c98:	e8 43 0a 00 00       	call   8036e0 <ipc_recv>
+}
+  802c9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ca0:	c9                   	leave
+  802ca1:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802ca2:	83 ec 0c             	sub    $0xc,%esp
+  802ca5:	6a 02                	push   $0x2
+  802ca7:	e8 d8 0b 00 00       	call   803884 <ipc_find_env>
+  802cac:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  802cb1:	83 c4 10             	add    $0x10,%esp
+  802cb4:	eb c6                	jmp    802c7c <nsipc+0x12>
+
+00802cb6 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802cb6:	55                   	push   %ebp
+  802cb7:	89 e5                	mov    %esp,%ebp
+  802cb9:	56                   	push   %esi
+  802cba:	53                   	push   %ebx
+  802cbb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802cbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc1:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802cc6:	8b 06                	mov    (%esi),%eax
+  802cc8:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802ccd:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cd2:	e8 93 ff ff ff       	call   802c6a <nsipc>
+  802cd7:	89 c3                	mov    %eax,%ebx
+  802cd9:	85 c0                	test   %eax,%eax
+  802cdb:	79 09                	jns    802ce6 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802cdd:	89 d8                	mov    %ebx,%eax
+  802cdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ce2:	5b                   	pop    %ebx
+  802ce3:	5e                   	pop    %esi
+  802ce4:	5d                   	pop    %ebp
+  802ce5:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802ce6:	83 ec 04             	sub    $0x4,%esp
+  802ce9:	ff 35 10 90 80 00    	push   0x809010
+  802cef:	68 00 90 80 00       	push   $0x809000
+  802cf4:	ff 75 0c             	push   0xc(%ebp)
+  802cf7:	e8 47 e0 ff ff       	call   800d43 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802cfc:	a1 10 90 80 00       	mov    0x809010,%eax
+  802d01:	89 06                	mov    %eax,(%esi)
+  802d03:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802d06:	eb d5                	jmp    802cdd <nsipc_accept+0x27>
+
+00802d08 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802d08:	55                   	push   %ebp
+  802d09:	89 e5                	mov    %esp,%ebp
+  802d0b:	53                   	push   %ebx
+  802d0c:	83 ec 08             	sub    $0x8,%esp
+  802d0f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802d12:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d15:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802d1a:	53                   	push   %ebx
+  802d1b:	ff 75 0c             	push   0xc(%ebp)
+  802d1e:	68 04 90 80 00       	push   $0x809004
+  802d23:	e8 1b e0 ff ff       	call   800d43 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d28:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802d2e:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d33:	e8 32 ff ff ff       	call   802c6a <nsipc>
+}
+  802d38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d3b:	c9                   	leave
+  802d3c:	c3                   	ret
+
+00802d3d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d3d:	55                   	push   %ebp
+  802d3e:	89 e5                	mov    %esp,%ebp
+  802d40:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802d43:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d46:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802d4b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d4e:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802d53:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d58:	e8 0d ff ff ff       	call   802c6a <nsipc>
+}
+  802d5d:	c9                   	leave
+  802d5e:	c3                   	ret
+
+00802d5f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d5f:	55                   	push   %ebp
+  802d60:	89 e5                	mov    %esp,%ebp
+  802d62:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802d65:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d68:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802d6d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d72:	e8 f3 fe ff ff       	call   802c6a <nsipc>
+}
+  802d77:	c9                   	leave
+  802d78:	c3                   	ret
+
+00802d79 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802d79:	55                   	push   %ebp
+  802d7a:	89 e5                	mov    %esp,%ebp
+  802d7c:	53                   	push   %ebx
+  802d7d:	83 ec 08             	sub    $0x8,%esp
+  802d80:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802d83:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d86:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802d8b:	53                   	push   %ebx
+  802d8c:	ff 75 0c             	push   0xc(%ebp)
+  802d8f:	68 04 90 80 00       	push   $0x809004
+  802d94:	e8 aa df ff ff       	call   800d43 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802d99:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802d9f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802da4:	e8 c1 fe ff ff       	call   802c6a <nsipc>
+}
+  802da9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dac:	c9                   	leave
+  802dad:	c3                   	ret
+
+00802dae <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802dae:	55                   	push   %ebp
+  802daf:	89 e5                	mov    %esp,%ebp
+  802db1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802db4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802db7:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802dbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dbf:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802dc4:	b8 06 00 00 00       	mov    $0x6,%eax
+  802dc9:	e8 9c fe ff ff       	call   802c6a <nsipc>
+}
+  802dce:	c9                   	leave
+  802dcf:	c3                   	ret
+
+00802dd0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802dd0:	55                   	push   %ebp
+  802dd1:	89 e5                	mov    %esp,%ebp
+  802dd3:	56                   	push   %esi
+  802dd4:	53                   	push   %ebx
+  802dd5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802dd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ddb:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802de0:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802de6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802de9:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802dee:	b8 07 00 00 00       	mov    $0x7,%eax
+  802df3:	e8 72 fe ff ff       	call   802c6a <nsipc>
+  802df8:	89 c3                	mov    %eax,%ebx
+  802dfa:	85 c0                	test   %eax,%eax
+  802dfc:	78 22                	js     802e20 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802dfe:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802e03:	39 c6                	cmp    %eax,%esi
+  802e05:	0f 4e c6             	cmovle %esi,%eax
+  802e08:	39 c3                	cmp    %eax,%ebx
+  802e0a:	7f 1d                	jg     802e29 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802e0c:	83 ec 04             	sub    $0x4,%esp
+  802e0f:	53                   	push   %ebx
+  802e10:	68 00 90 80 00       	push   $0x809000
+  802e15:	ff 75 0c             	push   0xc(%ebp)
+  802e18:	e8 26 df ff ff       	call   800d43 <memmove>
+  802e1d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e20:	89 d8                	mov    %ebx,%eax
+  802e22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e25:	5b                   	pop    %ebx
+  802e26:	5e                   	pop    %esi
+  802e27:	5d                   	pop    %ebp
+  802e28:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e29:	68 62 41 80 00       	push   $0x804162
+  802e2e:	68 00 41 80 00       	push   $0x804100
+  802e33:	6a 62                	push   $0x62
+  802e35:	68 77 41 80 00       	push   $0x804177
+  802e3a:	e8 46 05 00 00       	call   803385 <_panic>
+
+00802e3f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e3f:	55                   	push   %ebp
+  802e40:	89 e5                	mov    %esp,%ebp
+  802e42:	53                   	push   %ebx
+  802e43:	83 ec 04             	sub    $0x4,%esp
+  802e46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802e49:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e4c:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802e51:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802e57:	7f 2e                	jg     802e87 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802e59:	83 ec 04             	sub    $0x4,%esp
+  802e5c:	53                   	push   %ebx
+  802e5d:	ff 75 0c             	push   0xc(%ebp)
+  802e60:	68 0c 90 80 00       	push   $0x80900c
+  802e65:	e8 d9 de ff ff       	call   800d43 <memmove>
+	nsipcbuf.send.req_size = size;
+  802e6a:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802e70:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e73:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802e78:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e7d:	e8 e8 fd ff ff       	call   802c6a <nsipc>
+}
+  802e82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e85:	c9                   	leave
+  802e86:	c3                   	ret
+	assert(size < 1600);
+  802e87:	68 83 41 80 00       	push   $0x804183
+  802e8c:	68 00 41 80 00       	push   $0x804100
+  802e91:	6a 6d                	push   $0x6d
+  802e93:	68 77 41 80 00       	push   $0x804177
+  802e98:	e8 e8 04 00 00       	call   803385 <_panic>
+
+00802e9d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802e9d:	55                   	push   %ebp
+  802e9e:	89 e5                	mov    %esp,%ebp
+  802ea0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802ea3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ea6:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802eab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802eae:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802eb3:	8b 45 10             	mov    0x10(%ebp),%eax
+  802eb6:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802ebb:	b8 09 00 00 00       	mov    $0x9,%eax
+  802ec0:	e8 a5 fd ff ff       	call   802c6a <nsipc>
+}
+  802ec5:	c9                   	leave
+  802ec6:	c3                   	ret
+
+00802ec7 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802ec7:	55                   	push   %ebp
+  802ec8:	89 e5                	mov    %esp,%ebp
+  802eca:	56                   	push   %esi
+  802ecb:	53                   	push   %ebx
+  802ecc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802ecf:	83 ec 0c             	sub    $0xc,%esp
+  802ed2:	ff 75 08             	push   0x8(%ebp)
+  802ed5:	e8 00 e5 ff ff       	call   8013da <fd2data>
+  802eda:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802edc:	83 c4 08             	add    $0x8,%esp
+  802edf:	68 8f 41 80 00       	push   $0x80418f
+  802ee4:	53                   	push   %ebx
+  802ee5:	e8 d3 dc ff ff       	call   800bbd <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802eea:	8b 46 04             	mov    0x4(%esi),%eax
+  802eed:	2b 06                	sub    (%esi),%eax
+  802eef:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802ef5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802efc:	00 00 00 
+	stat->st_dev = &devpipe;
+  802eff:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  802f06:	50 80 00 
+	return 0;
+}
+  802f09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f11:	5b                   	pop    %ebx
+  802f12:	5e                   	pop    %esi
+  802f13:	5d                   	pop    %ebp
+  802f14:	c3                   	ret
+
+00802f15 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802f15:	55                   	push   %ebp
+  802f16:	89 e5                	mov    %esp,%ebp
+  802f18:	53                   	push   %ebx
+  802f19:	83 ec 0c             	sub    $0xc,%esp
+  802f1c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802f1f:	53                   	push   %ebx
+  802f20:	6a 00                	push   $0x0
+  802f22:	e8 2f e1 ff ff       	call   801056 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802f27:	89 1c 24             	mov    %ebx,(%esp)
+  802f2a:	e8 ab e4 ff ff       	call   8013da <fd2data>
+  802f2f:	83 c4 08             	add    $0x8,%esp
+  802f32:	50                   	push   %eax
+  802f33:	6a 00                	push   $0x0
+  802f35:	e8 1c e1 ff ff       	call   801056 <sys_page_unmap>
+}
+  802f3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f3d:	c9                   	leave
+  802f3e:	c3                   	ret
+
+00802f3f <_pipeisclosed>:
+{
+  802f3f:	55                   	push   %ebp
+  802f40:	89 e5                	mov    %esp,%ebp
+  802f42:	57                   	push   %edi
+  802f43:	56                   	push   %esi
+  802f44:	53                   	push   %ebx
+  802f45:	83 ec 1c             	sub    $0x1c,%esp
+  802f48:	89 c7                	mov    %eax,%edi
+  802f4a:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802f4c:	a1 10 60 80 00       	mov    0x806010,%eax
+  802f51:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802f54:	83 ec 0c             	sub    $0xc,%esp
+  802f57:	57                   	push   %edi
+  802f58:	e8 66 09 00 00       	call   8038c3 <pageref>
+  802f5d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f60:	89 34 24             	mov    %esi,(%esp)
+  802f63:	e8 5b 09 00 00       	call   8038c3 <pageref>
+		nn = thisenv->env_runs;
+  802f68:	8b 15 10 60 80 00    	mov    0x806010,%edx
+  802f6e:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802f71:	83 c4 10             	add    $0x10,%esp
+  802f74:	39 cb                	cmp    %ecx,%ebx
+  802f76:	74 1b                	je     802f93 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802f78:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f7b:	75 cf                	jne    802f4c <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802f7d:	8b 42 58             	mov    0x58(%edx),%eax
+  802f80:	6a 01                	push   $0x1
+  802f82:	50                   	push   %eax
+  802f83:	53                   	push   %ebx
+  802f84:	68 96 41 80 00       	push   $0x804196
+  802f89:	e8 41 d6 ff ff       	call   8005cf <cprintf>
+  802f8e:	83 c4 10             	add    $0x10,%esp
+  802f91:	eb b9                	jmp    802f4c <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802f93:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f96:	0f 94 c0             	sete   %al
+  802f99:	0f b6 c0             	movzbl %al,%eax
+}
+  802f9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f9f:	5b                   	pop    %ebx
+  802fa0:	5e                   	pop    %esi
+  802fa1:	5f                   	pop    %edi
+  802fa2:	5d                   	pop    %ebp
+  802fa3:	c3                   	ret
+
+00802fa4 <devpipe_write>:
+{
+  802fa4:	55                   	push   %ebp
+  802fa5:	89 e5                	mov    %esp,%ebp
+  802fa7:	57                   	push   %edi
+  802fa8:	56                   	push   %esi
+  802fa9:	53                   	push   %ebx
+  802faa:	83 ec 28             	sub    $0x28,%esp
+  802fad:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802fb0:	56                   	push   %esi
+  802fb1:	e8 24 e4 ff ff       	call   8013da <fd2data>
+  802fb6:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802fb8:	83 c4 10             	add    $0x10,%esp
+  802fbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fc0:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802fc3:	75 09                	jne    802fce <devpipe_write+0x2a>
+	return i;
+  802fc5:	89 f8                	mov    %edi,%eax
+  802fc7:	eb 23                	jmp    802fec <devpipe_write+0x48>
+			sys_yield();
+  802fc9:	e8 dc df ff ff       	call   800faa <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802fce:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fd1:	8b 0b                	mov    (%ebx),%ecx
+  802fd3:	8d 51 20             	lea    0x20(%ecx),%edx
+  802fd6:	39 d0                	cmp    %edx,%eax
+  802fd8:	72 1a                	jb     802ff4 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802fda:	89 da                	mov    %ebx,%edx
+  802fdc:	89 f0                	mov    %esi,%eax
+  802fde:	e8 5c ff ff ff       	call   802f3f <_pipeisclosed>
+  802fe3:	85 c0                	test   %eax,%eax
+  802fe5:	74 e2                	je     802fc9 <devpipe_write+0x25>
+				return 0;
+  802fe7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fef:	5b                   	pop    %ebx
+  802ff0:	5e                   	pop    %esi
+  802ff1:	5f                   	pop    %edi
+  802ff2:	5d                   	pop    %ebp
+  802ff3:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802ff4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ff7:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802ffb:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802ffe:	89 c2                	mov    %eax,%edx
+  803000:	c1 fa 1f             	sar    $0x1f,%edx
+  803003:	89 d1                	mov    %edx,%ecx
+  803005:	c1 e9 1b             	shr    $0x1b,%ecx
+  803008:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80300b:	83 e2 1f             	and    $0x1f,%edx
+  80300e:	29 ca                	sub    %ecx,%edx
+  803010:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803014:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803018:	83 c0 01             	add    $0x1,%eax
+  80301b:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80301e:	83 c7 01             	add    $0x1,%edi
+  803021:	eb 9d                	jmp    802fc0 <devpipe_write+0x1c>
+
+00803023 <devpipe_read>:
+{
+  803023:	55                   	push   %ebp
+  803024:	89 e5                	mov    %esp,%ebp
+  803026:	57                   	push   %edi
+  803027:	56                   	push   %esi
+  803028:	53                   	push   %ebx
+  803029:	83 ec 18             	sub    $0x18,%esp
+  80302c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80302f:	57                   	push   %edi
+  803030:	e8 a5 e3 ff ff       	call   8013da <fd2data>
+  803035:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803037:	83 c4 10             	add    $0x10,%esp
+  80303a:	be 00 00 00 00       	mov    $0x0,%esi
+  80303f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803042:	75 13                	jne    803057 <devpipe_read+0x34>
+	return i;
+  803044:	89 f0                	mov    %esi,%eax
+  803046:	eb 02                	jmp    80304a <devpipe_read+0x27>
+				return i;
+  803048:	89 f0                	mov    %esi,%eax
+}
+  80304a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80304d:	5b                   	pop    %ebx
+  80304e:	5e                   	pop    %esi
+  80304f:	5f                   	pop    %edi
+  803050:	5d                   	pop    %ebp
+  803051:	c3                   	ret
+			sys_yield();
+  803052:	e8 53 df ff ff       	call   800faa <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803057:	8b 03                	mov    (%ebx),%eax
+  803059:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80305c:	75 18                	jne    803076 <devpipe_read+0x53>
+			if (i > 0)
+  80305e:	85 f6                	test   %esi,%esi
+  803060:	75 e6                	jne    803048 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803062:	89 da                	mov    %ebx,%edx
+  803064:	89 f8                	mov    %edi,%eax
+  803066:	e8 d4 fe ff ff       	call   802f3f <_pipeisclosed>
+  80306b:	85 c0                	test   %eax,%eax
+  80306d:	74 e3                	je     803052 <devpipe_read+0x2f>
+				return 0;
+  80306f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803074:	eb d4                	jmp    80304a <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803076:	99                   	cltd
+  803077:	c1 ea 1b             	shr    $0x1b,%edx
+  80307a:	01 d0                	add    %edx,%eax
+  80307c:	83 e0 1f             	and    $0x1f,%eax
+  80307f:	29 d0                	sub    %edx,%eax
+  803081:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803086:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803089:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80308c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80308f:	83 c6 01             	add    $0x1,%esi
+  803092:	eb ab                	jmp    80303f <devpipe_read+0x1c>
+
+00803094 <pipe>:
+{
+  803094:	55                   	push   %ebp
+  803095:	89 e5                	mov    %esp,%ebp
+  803097:	56                   	push   %esi
+  803098:	53                   	push   %ebx
+  803099:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80309c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80309f:	50                   	push   %eax
+  8030a0:	e8 4c e3 ff ff       	call   8013f1 <fd_alloc>
+  8030a5:	89 c3                	mov    %eax,%ebx
+  8030a7:	83 c4 10             	add    $0x10,%esp
+  8030aa:	85 c0                	test   %eax,%eax
+  8030ac:	0f 88 23 01 00 00    	js     8031d5 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030b2:	83 ec 04             	sub    $0x4,%esp
+  8030b5:	68 07 04 00 00       	push   $0x407
+  8030ba:	ff 75 f4             	push   -0xc(%ebp)
+  8030bd:	6a 00                	push   $0x0
+  8030bf:	e8 05 df ff ff       	call   800fc9 <sys_page_alloc>
+  8030c4:	89 c3                	mov    %eax,%ebx
+  8030c6:	83 c4 10             	add    $0x10,%esp
+  8030c9:	85 c0                	test   %eax,%eax
+  8030cb:	0f 88 04 01 00 00    	js     8031d5 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8030d1:	83 ec 0c             	sub    $0xc,%esp
+  8030d4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030d7:	50                   	push   %eax
+  8030d8:	e8 14 e3 ff ff       	call   8013f1 <fd_alloc>
+  8030dd:	89 c3                	mov    %eax,%ebx
+  8030df:	83 c4 10             	add    $0x10,%esp
+  8030e2:	85 c0                	test   %eax,%eax
+  8030e4:	0f 88 db 00 00 00    	js     8031c5 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030ea:	83 ec 04             	sub    $0x4,%esp
+  8030ed:	68 07 04 00 00       	push   $0x407
+  8030f2:	ff 75 f0             	push   -0x10(%ebp)
+  8030f5:	6a 00                	push   $0x0
+  8030f7:	e8 cd de ff ff       	call   800fc9 <sys_page_alloc>
+  8030fc:	89 c3                	mov    %eax,%ebx
+  8030fe:	83 c4 10             	add    $0x10,%esp
+  803101:	85 c0                	test   %eax,%eax
+  803103:	0f 88 bc 00 00 00    	js     8031c5 <pipe+0x131>
+	va = fd2data(fd0);
+  803109:	83 ec 0c             	sub    $0xc,%esp
+  80310c:	ff 75 f4             	push   -0xc(%ebp)
+  80310f:	e8 c6 e2 ff ff       	call   8013da <fd2data>
+  803114:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803116:	83 c4 0c             	add    $0xc,%esp
+  803119:	68 07 04 00 00       	push   $0x407
+  80311e:	50                   	push   %eax
+  80311f:	6a 00                	push   $0x0
+  803121:	e8 a3 de ff ff       	call   800fc9 <sys_page_alloc>
+  803126:	89 c3                	mov    %eax,%ebx
+  803128:	83 c4 10             	add    $0x10,%esp
+  80312b:	85 c0                	test   %eax,%eax
+  80312d:	0f 88 82 00 00 00    	js     8031b5 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803133:	83 ec 0c             	sub    $0xc,%esp
+  803136:	ff 75 f0             	push   -0x10(%ebp)
+  803139:	e8 9c e2 ff ff       	call   8013da <fd2data>
+  80313e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803145:	50                   	push   %eax
+  803146:	6a 00                	push   $0x0
+  803148:	56                   	push   %esi
+  803149:	6a 00                	push   $0x0
+  80314b:	e8 c4 de ff ff       	call   801014 <sys_page_map>
+  803150:	89 c3                	mov    %eax,%ebx
+  803152:	83 c4 20             	add    $0x20,%esp
+  803155:	85 c0                	test   %eax,%eax
+  803157:	78 4e                	js     8031a7 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803159:	a1 60 50 80 00       	mov    0x805060,%eax
+  80315e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803161:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803163:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803166:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80316d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803170:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803172:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803175:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80317c:	83 ec 0c             	sub    $0xc,%esp
+  80317f:	ff 75 f4             	push   -0xc(%ebp)
+  803182:	e8 43 e2 ff ff       	call   8013ca <fd2num>
+  803187:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80318a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80318c:	83 c4 04             	add    $0x4,%esp
+  80318f:	ff 75 f0             	push   -0x10(%ebp)
+  803192:	e8 33 e2 ff ff       	call   8013ca <fd2num>
+  803197:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80319a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80319d:	83 c4 10             	add    $0x10,%esp
+  8031a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031a5:	eb 2e                	jmp    8031d5 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031a7:	83 ec 08             	sub    $0x8,%esp
+  8031aa:	56                   	push   %esi
+  8031ab:	6a 00                	push   $0x0
+  8031ad:	e8 a4 de ff ff       	call   801056 <sys_page_unmap>
+  8031b2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8031b5:	83 ec 08             	sub    $0x8,%esp
+  8031b8:	ff 75 f0             	push   -0x10(%ebp)
+  8031bb:	6a 00                	push   $0x0
+  8031bd:	e8 94 de ff ff       	call   801056 <sys_page_unmap>
+  8031c2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8031c5:	83 ec 08             	sub    $0x8,%esp
+  8031c8:	ff 75 f4             	push   -0xc(%ebp)
+  8031cb:	6a 00                	push   $0x0
+  8031cd:	e8 84 de ff ff       	call   801056 <sys_page_unmap>
+  8031d2:	83 c4 10             	add    $0x10,%esp
+}
+  8031d5:	89 d8                	mov    %ebx,%eax
+  8031d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031da:	5b                   	pop    %ebx
+  8031db:	5e                   	pop    %esi
+  8031dc:	5d                   	pop    %ebp
+  8031dd:	c3                   	ret
+
+008031de <pipeisclosed>:
+{
+  8031de:	55                   	push   %ebp
+  8031df:	89 e5                	mov    %esp,%ebp
+  8031e1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031e7:	50                   	push   %eax
+  8031e8:	ff 75 08             	push   0x8(%ebp)
+  8031eb:	e8 57 e2 ff ff       	call   801447 <fd_lookup>
+  8031f0:	83 c4 10             	add    $0x10,%esp
+  8031f3:	85 c0                	test   %eax,%eax
+  8031f5:	78 18                	js     80320f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8031f7:	83 ec 0c             	sub    $0xc,%esp
+  8031fa:	ff 75 f4             	push   -0xc(%ebp)
+  8031fd:	e8 d8 e1 ff ff       	call   8013da <fd2data>
+  803202:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803204:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803207:	e8 33 fd ff ff       	call   802f3f <_pipeisclosed>
+  80320c:	83 c4 10             	add    $0x10,%esp
+}
+  80320f:	c9                   	leave
+  803210:	c3                   	ret
+
+00803211 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803211:	b8 00 00 00 00       	mov    $0x0,%eax
+  803216:	c3                   	ret
+
+00803217 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803217:	55                   	push   %ebp
+  803218:	89 e5                	mov    %esp,%ebp
+  80321a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80321d:	68 ae 41 80 00       	push   $0x8041ae
+  803222:	ff 75 0c             	push   0xc(%ebp)
+  803225:	e8 93 d9 ff ff       	call   800bbd <strcpy>
+	return 0;
+}
+  80322a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80322f:	c9                   	leave
+  803230:	c3                   	ret
+
+00803231 <devcons_write>:
+{
+  803231:	55                   	push   %ebp
+  803232:	89 e5                	mov    %esp,%ebp
+  803234:	57                   	push   %edi
+  803235:	56                   	push   %esi
+  803236:	53                   	push   %ebx
+  803237:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80323d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803242:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803248:	eb 2e                	jmp    803278 <devcons_write+0x47>
+		m = n - tot;
+  80324a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80324d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80324f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803254:	39 c3                	cmp    %eax,%ebx
+  803256:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803259:	83 ec 04             	sub    $0x4,%esp
+  80325c:	53                   	push   %ebx
+  80325d:	89 f0                	mov    %esi,%eax
+  80325f:	03 45 0c             	add    0xc(%ebp),%eax
+  803262:	50                   	push   %eax
+  803263:	57                   	push   %edi
+  803264:	e8 da da ff ff       	call   800d43 <memmove>
+		sys_cputs(buf, m);
+  803269:	83 c4 08             	add    $0x8,%esp
+  80326c:	53                   	push   %ebx
+  80326d:	57                   	push   %edi
+  80326e:	e8 7a dc ff ff       	call   800eed <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803273:	01 de                	add    %ebx,%esi
+  803275:	83 c4 10             	add    $0x10,%esp
+  803278:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80327b:	72 cd                	jb     80324a <devcons_write+0x19>
+}
+  80327d:	89 f0                	mov    %esi,%eax
+  80327f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803282:	5b                   	pop    %ebx
+  803283:	5e                   	pop    %esi
+  803284:	5f                   	pop    %edi
+  803285:	5d                   	pop    %ebp
+  803286:	c3                   	ret
+
+00803287 <devcons_read>:
+{
+  803287:	55                   	push   %ebp
+  803288:	89 e5                	mov    %esp,%ebp
+  80328a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80328d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803292:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803296:	75 07                	jne    80329f <devcons_read+0x18>
+  803298:	eb 1f                	jmp    8032b9 <devcons_read+0x32>
+		sys_yield();
+  80329a:	e8 0b dd ff ff       	call   800faa <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80329f:	e8 6f dc ff ff       	call   800f13 <sys_cgetc>
+  8032a4:	85 c0                	test   %eax,%eax
+  8032a6:	74 f2                	je     80329a <devcons_read+0x13>
+	if (c < 0)
+  8032a8:	78 0f                	js     8032b9 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8032aa:	83 f8 04             	cmp    $0x4,%eax
+  8032ad:	74 0c                	je     8032bb <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8032af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032b2:	88 02                	mov    %al,(%edx)
+	return 1;
+  8032b4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8032b9:	c9                   	leave
+  8032ba:	c3                   	ret
+		return 0;
+  8032bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c0:	eb f7                	jmp    8032b9 <devcons_read+0x32>
+
+008032c2 <cputchar>:
+{
+  8032c2:	55                   	push   %ebp
+  8032c3:	89 e5                	mov    %esp,%ebp
+  8032c5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8032c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032cb:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8032ce:	6a 01                	push   $0x1
+  8032d0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032d3:	50                   	push   %eax
+  8032d4:	e8 14 dc ff ff       	call   800eed <sys_cputs>
+}
+  8032d9:	83 c4 10             	add    $0x10,%esp
+  8032dc:	c9                   	leave
+  8032dd:	c3                   	ret
+
+008032de <getchar>:
+{
+  8032de:	55                   	push   %ebp
+  8032df:	89 e5                	mov    %esp,%ebp
+  8032e1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8032e4:	6a 01                	push   $0x1
+  8032e6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032e9:	50                   	push   %eax
+  8032ea:	6a 00                	push   $0x0
+  8032ec:	e8 bc e3 ff ff       	call   8016ad <read>
+	if (r < 0)
+  8032f1:	83 c4 10             	add    $0x10,%esp
+  8032f4:	85 c0                	test   %eax,%eax
+  8032f6:	78 06                	js     8032fe <getchar+0x20>
+	if (r < 1)
+  8032f8:	74 06                	je     803300 <getchar+0x22>
+	return c;
+  8032fa:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8032fe:	c9                   	leave
+  8032ff:	c3                   	ret
+		return -E_EOF;
+  803300:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803305:	eb f7                	jmp    8032fe <getchar+0x20>
+
+00803307 <iscons>:
+{
+  803307:	55                   	push   %ebp
+  803308:	89 e5                	mov    %esp,%ebp
+  80330a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80330d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803310:	50                   	push   %eax
+  803311:	ff 75 08             	push   0x8(%ebp)
+  803314:	e8 2e e1 ff ff       	call   801447 <fd_lookup>
+  803319:	83 c4 10             	add    $0x10,%esp
+  80331c:	85 c0                	test   %eax,%eax
+  80331e:	78 11                	js     803331 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803320:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803323:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803329:	39 10                	cmp    %edx,(%eax)
+  80332b:	0f 94 c0             	sete   %al
+  80332e:	0f b6 c0             	movzbl %al,%eax
+}
+  803331:	c9                   	leave
+  803332:	c3                   	ret
+
+00803333 <opencons>:
+{
+  803333:	55                   	push   %ebp
+  803334:	89 e5                	mov    %esp,%ebp
+  803336:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803339:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80333c:	50                   	push   %eax
+  80333d:	e8 af e0 ff ff       	call   8013f1 <fd_alloc>
+  803342:	83 c4 10             	add    $0x10,%esp
+  803345:	85 c0                	test   %eax,%eax
+  803347:	78 3a                	js     803383 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803349:	83 ec 04             	sub    $0x4,%esp
+  80334c:	68 07 04 00 00       	push   $0x407
+  803351:	ff 75 f4             	push   -0xc(%ebp)
+  803354:	6a 00                	push   $0x0
+  803356:	e8 6e dc ff ff       	call   800fc9 <sys_page_alloc>
+  80335b:	83 c4 10             	add    $0x10,%esp
+  80335e:	85 c0                	test   %eax,%eax
+  803360:	78 21                	js     803383 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803362:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803365:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80336b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80336d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803370:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803377:	83 ec 0c             	sub    $0xc,%esp
+  80337a:	50                   	push   %eax
+  80337b:	e8 4a e0 ff ff       	call   8013ca <fd2num>
+  803380:	83 c4 10             	add    $0x10,%esp
+}
+  803383:	c9                   	leave
+  803384:	c3                   	ret
+
+00803385 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803385:	55                   	push   %ebp
+  803386:	89 e5                	mov    %esp,%ebp
+  803388:	56                   	push   %esi
+  803389:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80338a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80338d:	8b 35 04 50 80 00    	mov    0x805004,%esi
+  803393:	e8 eb db ff ff       	call   800f83 <sys_getenvid>
+  803398:	83 ec 0c             	sub    $0xc,%esp
+  80339b:	ff 75 0c             	push   0xc(%ebp)
+  80339e:	ff 75 08             	push   0x8(%ebp)
+  8033a1:	56                   	push   %esi
+  8033a2:	50                   	push   %eax
+  8033a3:	68 bc 41 80 00       	push   $0x8041bc
+  8033a8:	e8 22 d2 ff ff       	call   8005cf <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8033ad:	83 c4 18             	add    $0x18,%esp
+  8033b0:	53                   	push   %ebx
+  8033b1:	ff 75 10             	push   0x10(%ebp)
+  8033b4:	e8 c5 d1 ff ff       	call   80057e <vcprintf>
+	cprintf("\n");
+  8033b9:	c7 04 24 94 3c 80 00 	movl   $0x803c94,(%esp)
+  8033c0:	e8 0a d2 ff ff       	call   8005cf <cprintf>
+  8033c5:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8033c8:	cc                   	int3
+	while (1)
+  8033c9:	eb fd                	jmp    8033c8 <_panic+0x43>
+
+008033cb <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  8033cb:	55                   	push   %ebp
+  8033cc:	89 e5                	mov    %esp,%ebp
+  8033ce:	57                   	push   %edi
+  8033cf:	56                   	push   %esi
+  8033d0:	53                   	push   %ebx
+  8033d1:	83 ec 20             	sub    $0x20,%esp
+  8033d4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8033d7:	89 d7                	mov    %edx,%edi
+  8033d9:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  8033db:	51                   	push   %ecx
+  8033dc:	68 00 f0 7f 00       	push   $0x7ff000
+  8033e1:	6a 00                	push   $0x0
+  8033e3:	e8 e1 db ff ff       	call   800fc9 <sys_page_alloc>
+  8033e8:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8033ea:	83 c4 10             	add    $0x10,%esp
+  8033ed:	85 c0                	test   %eax,%eax
+  8033ef:	78 45                	js     803436 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  8033f1:	83 ec 04             	sub    $0x4,%esp
+  8033f4:	68 00 10 00 00       	push   $0x1000
+  8033f9:	57                   	push   %edi
+  8033fa:	68 00 f0 7f 00       	push   $0x7ff000
+  8033ff:	e8 3f d9 ff ff       	call   800d43 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  803404:	89 34 24             	mov    %esi,(%esp)
+  803407:	57                   	push   %edi
+  803408:	ff 75 e4             	push   -0x1c(%ebp)
+  80340b:	68 00 f0 7f 00       	push   $0x7ff000
+  803410:	6a 00                	push   $0x0
+  803412:	e8 fd db ff ff       	call   801014 <sys_page_map>
+  803417:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803419:	83 c4 20             	add    $0x20,%esp
+  80341c:	85 c0                	test   %eax,%eax
+  80341e:	78 16                	js     803436 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803420:	83 ec 08             	sub    $0x8,%esp
+  803423:	68 00 f0 7f 00       	push   $0x7ff000
+  803428:	6a 00                	push   $0x0
+  80342a:	e8 27 dc ff ff       	call   801056 <sys_page_unmap>
+  80342f:	83 c4 10             	add    $0x10,%esp
+  803432:	85 c0                	test   %eax,%eax
+  803434:	75 0a                	jne    803440 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  803436:	89 d8                	mov    %ebx,%eax
+  803438:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80343b:	5b                   	pop    %ebx
+  80343c:	5e                   	pop    %esi
+  80343d:	5f                   	pop    %edi
+  80343e:	5d                   	pop    %ebp
+  80343f:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803440:	68 e0 41 80 00       	push   $0x8041e0
+  803445:	68 00 41 80 00       	push   $0x804100
+  80344a:	6a 1b                	push   $0x1b
+  80344c:	68 58 42 80 00       	push   $0x804258
+  803451:	e8 2f ff ff ff       	call   803385 <_panic>
+
+00803456 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803456:	55                   	push   %ebp
+  803457:	89 e5                	mov    %esp,%ebp
+  803459:	53                   	push   %ebx
+  80345a:	83 ec 04             	sub    $0x4,%esp
+  80345d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803460:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803462:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  803466:	74 21                	je     803489 <pgfault+0x33>
+  803468:	89 d0                	mov    %edx,%eax
+  80346a:	c1 e8 16             	shr    $0x16,%eax
+  80346d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803474:	a8 01                	test   $0x1,%al
+  803476:	74 11                	je     803489 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803478:	89 d0                	mov    %edx,%eax
+  80347a:	c1 e8 0c             	shr    $0xc,%eax
+  80347d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803484:	f6 c4 08             	test   $0x8,%ah
+  803487:	75 17                	jne    8034a0 <pgfault+0x4a>
+		if (pgfault_next) {
+  803489:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  80348e:	85 c0                	test   %eax,%eax
+  803490:	74 27                	je     8034b9 <pgfault+0x63>
+			pgfault_next(utf);
+  803492:	83 ec 0c             	sub    $0xc,%esp
+  803495:	53                   	push   %ebx
+  803496:	ff d0                	call   *%eax
+			return;
+  803498:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  80349b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80349e:	c9                   	leave
+  80349f:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8034a0:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8034a6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8034ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b0:	e8 16 ff ff ff       	call   8033cb <copy_page_to>
+  8034b5:	85 c0                	test   %eax,%eax
+  8034b7:	79 e2                	jns    80349b <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8034b9:	a1 10 60 80 00       	mov    0x806010,%eax
+  8034be:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8034c1:	ff 73 28             	push   0x28(%ebx)
+  8034c4:	ff 33                	push   (%ebx)
+  8034c6:	50                   	push   %eax
+  8034c7:	68 04 42 80 00       	push   $0x804204
+  8034cc:	e8 fe d0 ff ff       	call   8005cf <cprintf>
+	sys_env_destroy(0);
+  8034d1:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8034d8:	e8 5d da ff ff       	call   800f3a <sys_env_destroy>
+  8034dd:	83 c4 10             	add    $0x10,%esp
+  8034e0:	eb b9                	jmp    80349b <pgfault+0x45>
+
+008034e2 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8034e2:	55                   	push   %ebp
+  8034e3:	89 e5                	mov    %esp,%ebp
+  8034e5:	53                   	push   %ebx
+  8034e6:	83 ec 04             	sub    $0x4,%esp
+  8034e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8034ec:	a1 08 a0 80 00       	mov    0x80a008,%eax
+  8034f1:	3d 56 34 80 00       	cmp    $0x803456,%eax
+  8034f6:	74 15                	je     80350d <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8034f8:	a3 04 a0 80 00       	mov    %eax,0x80a004
+		set_pgfault_handler(pgfault);
+  8034fd:	83 ec 0c             	sub    $0xc,%esp
+  803500:	68 56 34 80 00       	push   $0x803456
+  803505:	e8 fb 03 00 00       	call   803905 <set_pgfault_handler>
+  80350a:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80350d:	83 ec 0c             	sub    $0xc,%esp
+  803510:	68 05 08 00 00       	push   $0x805
+  803515:	53                   	push   %ebx
+  803516:	6a 00                	push   $0x0
+  803518:	53                   	push   %ebx
+  803519:	6a 00                	push   $0x0
+  80351b:	e8 f4 da ff ff       	call   801014 <sys_page_map>
+}
+  803520:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803523:	c9                   	leave
+  803524:	c3                   	ret
+
+00803525 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803525:	55                   	push   %ebp
+  803526:	89 e5                	mov    %esp,%ebp
+  803528:	57                   	push   %edi
+  803529:	56                   	push   %esi
+  80352a:	53                   	push   %ebx
+  80352b:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80352e:	68 56 34 80 00       	push   $0x803456
+  803533:	e8 cd 03 00 00       	call   803905 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803538:	b8 07 00 00 00       	mov    $0x7,%eax
+  80353d:	cd 30                	int    $0x30
+  80353f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803542:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  803545:	83 c4 10             	add    $0x10,%esp
+  803548:	85 c0                	test   %eax,%eax
+  80354a:	0f 88 6b 01 00 00    	js     8036bb <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803550:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803555:	75 37                	jne    80358e <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803557:	e8 27 da ff ff       	call   800f83 <sys_getenvid>
+  80355c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803561:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803567:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80356c:	a3 10 60 80 00       	mov    %eax,0x806010
+		return 0;
+  803571:	e9 45 01 00 00       	jmp    8036bb <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803576:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80357c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803582:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803588:	0f 87 ba 00 00 00    	ja     803648 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  80358e:	89 d8                	mov    %ebx,%eax
+  803590:	c1 e8 16             	shr    $0x16,%eax
+  803593:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80359a:	a8 01                	test   $0x1,%al
+  80359c:	74 d8                	je     803576 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  80359e:	89 d8                	mov    %ebx,%eax
+  8035a0:	c1 e8 0c             	shr    $0xc,%eax
+  8035a3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8035aa:	f6 c2 01             	test   $0x1,%dl
+  8035ad:	74 cd                	je     80357c <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8035af:	89 da                	mov    %ebx,%edx
+  8035b1:	80 e6 df             	and    $0xdf,%dh
+  8035b4:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8035ba:	74 c0                	je     80357c <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8035bc:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8035be:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8035c5:	f6 c6 04             	test   $0x4,%dh
+  8035c8:	75 53                	jne    80361d <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8035ca:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8035d1:	f6 c6 08             	test   $0x8,%dh
+  8035d4:	75 0c                	jne    8035e2 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8035d6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8035dd:	f6 c2 02             	test   $0x2,%dl
+  8035e0:	74 3b                	je     80361d <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8035e2:	83 ec 0c             	sub    $0xc,%esp
+  8035e5:	68 05 08 00 00       	push   $0x805
+  8035ea:	57                   	push   %edi
+  8035eb:	ff 75 e4             	push   -0x1c(%ebp)
+  8035ee:	57                   	push   %edi
+  8035ef:	6a 00                	push   $0x0
+  8035f1:	e8 1e da ff ff       	call   801014 <sys_page_map>
+  8035f6:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8035f8:	83 c4 20             	add    $0x20,%esp
+  8035fb:	85 c0                	test   %eax,%eax
+  8035fd:	0f 88 a7 00 00 00    	js     8036aa <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803603:	83 ec 0c             	sub    $0xc,%esp
+  803606:	68 05 08 00 00       	push   $0x805
+  80360b:	57                   	push   %edi
+  80360c:	6a 00                	push   $0x0
+  80360e:	57                   	push   %edi
+  80360f:	6a 00                	push   $0x0
+  803611:	e8 fe d9 ff ff       	call   801014 <sys_page_map>
+  803616:	89 c6                	mov    %eax,%esi
+	return r;
+  803618:	83 c4 20             	add    $0x20,%esp
+  80361b:	eb 21                	jmp    80363e <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  80361d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803624:	83 ec 0c             	sub    $0xc,%esp
+  803627:	25 07 0e 00 00       	and    $0xe07,%eax
+  80362c:	50                   	push   %eax
+  80362d:	57                   	push   %edi
+  80362e:	ff 75 e4             	push   -0x1c(%ebp)
+  803631:	57                   	push   %edi
+  803632:	6a 00                	push   $0x0
+  803634:	e8 db d9 ff ff       	call   801014 <sys_page_map>
+  803639:	89 c6                	mov    %eax,%esi
+  80363b:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  80363e:	85 f6                	test   %esi,%esi
+  803640:	0f 89 36 ff ff ff    	jns    80357c <fork+0x57>
+  803646:	eb 62                	jmp    8036aa <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803648:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80364d:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  803652:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803655:	89 f8                	mov    %edi,%eax
+  803657:	e8 6f fd ff ff       	call   8033cb <copy_page_to>
+  80365c:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80365e:	85 c0                	test   %eax,%eax
+  803660:	78 48                	js     8036aa <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803662:	83 ec 04             	sub    $0x4,%esp
+  803665:	6a 07                	push   $0x7
+  803667:	68 00 f0 bf ee       	push   $0xeebff000
+  80366c:	57                   	push   %edi
+  80366d:	e8 57 d9 ff ff       	call   800fc9 <sys_page_alloc>
+  803672:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803674:	83 c4 10             	add    $0x10,%esp
+  803677:	85 c0                	test   %eax,%eax
+  803679:	78 2f                	js     8036aa <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  80367b:	a1 10 60 80 00       	mov    0x806010,%eax
+  803680:	8b 40 64             	mov    0x64(%eax),%eax
+  803683:	83 ec 08             	sub    $0x8,%esp
+  803686:	50                   	push   %eax
+  803687:	57                   	push   %edi
+  803688:	e8 a7 da ff ff       	call   801134 <sys_env_set_pgfault_upcall>
+  80368d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80368f:	83 c4 10             	add    $0x10,%esp
+  803692:	85 c0                	test   %eax,%eax
+  803694:	78 14                	js     8036aa <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803696:	83 ec 08             	sub    $0x8,%esp
+  803699:	6a 02                	push   $0x2
+  80369b:	57                   	push   %edi
+  80369c:	e8 ff d9 ff ff       	call   8010a0 <sys_env_set_status>
+  8036a1:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8036a3:	83 c4 10             	add    $0x10,%esp
+  8036a6:	85 c0                	test   %eax,%eax
+  8036a8:	79 11                	jns    8036bb <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8036aa:	83 ec 0c             	sub    $0xc,%esp
+  8036ad:	ff 75 e0             	push   -0x20(%ebp)
+  8036b0:	e8 85 d8 ff ff       	call   800f3a <sys_env_destroy>
+	return r;
+  8036b5:	83 c4 10             	add    $0x10,%esp
+  8036b8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8036bb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036c1:	5b                   	pop    %ebx
+  8036c2:	5e                   	pop    %esi
+  8036c3:	5f                   	pop    %edi
+  8036c4:	5d                   	pop    %ebp
+  8036c5:	c3                   	ret
+
+008036c6 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8036c6:	55                   	push   %ebp
+  8036c7:	89 e5                	mov    %esp,%ebp
+  8036c9:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8036cc:	68 63 42 80 00       	push   $0x804263
+  8036d1:	68 bf 00 00 00       	push   $0xbf
+  8036d6:	68 58 42 80 00       	push   $0x804258
+  8036db:	e8 a5 fc ff ff       	call   803385 <_panic>
+
+008036e0 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8036e0:	55                   	push   %ebp
+  8036e1:	89 e5                	mov    %esp,%ebp
+  8036e3:	56                   	push   %esi
+  8036e4:	53                   	push   %ebx
+  8036e5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8036e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8036ee:	85 c0                	test   %eax,%eax
+  8036f0:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8036f5:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8036f8:	83 ec 0c             	sub    $0xc,%esp
+  8036fb:	50                   	push   %eax
+  8036fc:	e8 10 db ff ff       	call   801211 <sys_ipc_recv>
+	if (from_env_store)
+  803701:	83 c4 10             	add    $0x10,%esp
+  803704:	85 f6                	test   %esi,%esi
+  803706:	74 14                	je     80371c <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803708:	ba 00 00 00 00       	mov    $0x0,%edx
+  80370d:	85 c0                	test   %eax,%eax
+  80370f:	75 09                	jne    80371a <ipc_recv+0x3a>
+  803711:	8b 15 10 60 80 00    	mov    0x806010,%edx
+  803717:	8b 52 74             	mov    0x74(%edx),%edx
+  80371a:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  80371c:	85 db                	test   %ebx,%ebx
+  80371e:	74 25                	je     803745 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803720:	85 c0                	test   %eax,%eax
+  803722:	74 0d                	je     803731 <ipc_recv+0x51>
+  803724:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  80372a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80372d:	5b                   	pop    %ebx
+  80372e:	5e                   	pop    %esi
+  80372f:	5d                   	pop    %ebp
+  803730:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803731:	a1 10 60 80 00       	mov    0x806010,%eax
+  803736:	8b 40 78             	mov    0x78(%eax),%eax
+  803739:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  80373b:	a1 10 60 80 00       	mov    0x806010,%eax
+  803740:	8b 40 70             	mov    0x70(%eax),%eax
+  803743:	eb e5                	jmp    80372a <ipc_recv+0x4a>
+  803745:	85 c0                	test   %eax,%eax
+  803747:	75 e1                	jne    80372a <ipc_recv+0x4a>
+  803749:	eb f0                	jmp    80373b <ipc_recv+0x5b>
+
+0080374b <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80374b:	55                   	push   %ebp
+  80374c:	89 e5                	mov    %esp,%ebp
+  80374e:	57                   	push   %edi
+  80374f:	56                   	push   %esi
+  803750:	53                   	push   %ebx
+  803751:	83 ec 0c             	sub    $0xc,%esp
+  803754:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803757:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80375a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80375d:	85 db                	test   %ebx,%ebx
+  80375f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803764:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803767:	ff 75 14             	push   0x14(%ebp)
+  80376a:	53                   	push   %ebx
+  80376b:	56                   	push   %esi
+  80376c:	57                   	push   %edi
+  80376d:	e8 0c da ff ff       	call   80117e <sys_ipc_try_send>
+  803772:	83 c4 10             	add    $0x10,%esp
+  803775:	85 c0                	test   %eax,%eax
+  803777:	74 22                	je     80379b <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803779:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80377c:	75 07                	jne    803785 <ipc_send+0x3a>
+		sys_yield();
+  80377e:	e8 27 d8 ff ff       	call   800faa <sys_yield>
+  803783:	eb e2                	jmp    803767 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803785:	68 79 42 80 00       	push   $0x804279
+  80378a:	68 00 41 80 00       	push   $0x804100
+  80378f:	6a 39                	push   $0x39
+  803791:	68 8e 42 80 00       	push   $0x80428e
+  803796:	e8 ea fb ff ff       	call   803385 <_panic>
+	}
+}
+  80379b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80379e:	5b                   	pop    %ebx
+  80379f:	5e                   	pop    %esi
+  8037a0:	5f                   	pop    %edi
+  8037a1:	5d                   	pop    %ebp
+  8037a2:	c3                   	ret
+
+008037a3 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  8037a3:	55                   	push   %ebp
+  8037a4:	89 e5                	mov    %esp,%ebp
+  8037a6:	57                   	push   %edi
+  8037a7:	56                   	push   %esi
+  8037a8:	53                   	push   %ebx
+  8037a9:	83 ec 10             	sub    $0x10,%esp
+  8037ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037af:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8037b5:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8037b8:	85 c0                	test   %eax,%eax
+  8037ba:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8037bf:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8037c2:	6a 00                	push   $0x0
+  8037c4:	ff 33                	push   (%ebx)
+  8037c6:	50                   	push   %eax
+  8037c7:	e8 02 da ff ff       	call   8011ce <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8037cc:	83 c4 10             	add    $0x10,%esp
+  8037cf:	85 c0                	test   %eax,%eax
+  8037d1:	75 3c                	jne    80380f <ipc_recvv+0x6c>
+  8037d3:	8b 15 10 60 80 00    	mov    0x806010,%edx
+  8037d9:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8037dc:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8037de:	85 ff                	test   %edi,%edi
+  8037e0:	74 4e                	je     803830 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8037e2:	8b 15 10 60 80 00    	mov    0x806010,%edx
+  8037e8:	8b 52 74             	mov    0x74(%edx),%edx
+  8037eb:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8037ed:	85 f6                	test   %esi,%esi
+  8037ef:	74 18                	je     803809 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8037f1:	85 c0                	test   %eax,%eax
+  8037f3:	75 2d                	jne    803822 <ipc_recvv+0x7f>
+  8037f5:	a1 10 60 80 00       	mov    0x806010,%eax
+  8037fa:	8b 40 78             	mov    0x78(%eax),%eax
+  8037fd:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8037ff:	a1 10 60 80 00       	mov    0x806010,%eax
+  803804:	8b 40 70             	mov    0x70(%eax),%eax
+  803807:	eb 1f                	jmp    803828 <ipc_recvv+0x85>
+  803809:	85 c0                	test   %eax,%eax
+  80380b:	75 1b                	jne    803828 <ipc_recvv+0x85>
+  80380d:	eb f0                	jmp    8037ff <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80380f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803815:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  80381a:	85 ff                	test   %edi,%edi
+  80381c:	75 cd                	jne    8037eb <ipc_recvv+0x48>
+	if (perm_store)
+  80381e:	85 f6                	test   %esi,%esi
+  803820:	74 e7                	je     803809 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803822:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803828:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80382b:	5b                   	pop    %ebx
+  80382c:	5e                   	pop    %esi
+  80382d:	5f                   	pop    %edi
+  80382e:	5d                   	pop    %ebp
+  80382f:	c3                   	ret
+	if (perm_store)
+  803830:	85 f6                	test   %esi,%esi
+  803832:	75 bd                	jne    8037f1 <ipc_recvv+0x4e>
+  803834:	eb c9                	jmp    8037ff <ipc_recvv+0x5c>
+
+00803836 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803836:	55                   	push   %ebp
+  803837:	89 e5                	mov    %esp,%ebp
+  803839:	57                   	push   %edi
+  80383a:	56                   	push   %esi
+  80383b:	53                   	push   %ebx
+  80383c:	83 ec 0c             	sub    $0xc,%esp
+  80383f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803842:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803845:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  803848:	ff 75 14             	push   0x14(%ebp)
+  80384b:	53                   	push   %ebx
+  80384c:	56                   	push   %esi
+  80384d:	57                   	push   %edi
+  80384e:	e8 53 d9 ff ff       	call   8011a6 <sys_ipc_try_sendv>
+  803853:	83 c4 10             	add    $0x10,%esp
+  803856:	85 c0                	test   %eax,%eax
+  803858:	74 22                	je     80387c <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  80385a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80385d:	75 07                	jne    803866 <ipc_sendv+0x30>
+		sys_yield();
+  80385f:	e8 46 d7 ff ff       	call   800faa <sys_yield>
+  803864:	eb e2                	jmp    803848 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803866:	68 79 42 80 00       	push   $0x804279
+  80386b:	68 00 41 80 00       	push   $0x804100
+  803870:	6a 5c                	push   $0x5c
+  803872:	68 8e 42 80 00       	push   $0x80428e
+  803877:	e8 09 fb ff ff       	call   803385 <_panic>
+	}
+}
+  80387c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80387f:	5b                   	pop    %ebx
+  803880:	5e                   	pop    %esi
+  803881:	5f                   	pop    %edi
+  803882:	5d                   	pop    %ebp
+  803883:	c3                   	ret
+
+00803884 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803884:	55                   	push   %ebp
+  803885:	89 e5                	mov    %esp,%ebp
+  803887:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80388a:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80388f:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803895:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80389b:	8b 52 50             	mov    0x50(%edx),%edx
+  80389e:	39 ca                	cmp    %ecx,%edx
+  8038a0:	74 11                	je     8038b3 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8038a2:	83 c0 01             	add    $0x1,%eax
+  8038a5:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8038aa:	75 e3                	jne    80388f <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8038ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b1:	eb 0e                	jmp    8038c1 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8038b3:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8038b9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038be:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8038c1:	5d                   	pop    %ebp
+  8038c2:	c3                   	ret
+
+008038c3 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8038c3:	55                   	push   %ebp
+  8038c4:	89 e5                	mov    %esp,%ebp
+  8038c6:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8038c9:	89 c2                	mov    %eax,%edx
+  8038cb:	c1 ea 16             	shr    $0x16,%edx
+  8038ce:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8038d5:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8038da:	f6 c1 01             	test   $0x1,%cl
+  8038dd:	74 22                	je     803901 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8038df:	c1 e8 0c             	shr    $0xc,%eax
+  8038e2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8038e9:	a8 01                	test   $0x1,%al
+  8038eb:	74 14                	je     803901 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8038ed:	c1 e8 0c             	shr    $0xc,%eax
+  8038f0:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8038f3:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8038fa:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8038fe:	0f b7 d2             	movzwl %dx,%edx
+}
+  803901:	89 d0                	mov    %edx,%eax
+  803903:	5d                   	pop    %ebp
+  803904:	c3                   	ret
+
+00803905 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803905:	55                   	push   %ebp
+  803906:	89 e5                	mov    %esp,%ebp
+  803908:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  80390b:	83 3d 08 a0 80 00 00 	cmpl   $0x0,0x80a008
+  803912:	74 0a                	je     80391e <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803914:	8b 45 08             	mov    0x8(%ebp),%eax
+  803917:	a3 08 a0 80 00       	mov    %eax,0x80a008
+}
+  80391c:	c9                   	leave
+  80391d:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80391e:	83 ec 04             	sub    $0x4,%esp
+  803921:	6a 07                	push   $0x7
+  803923:	68 00 f0 bf ee       	push   $0xeebff000
+  803928:	6a 00                	push   $0x0
+  80392a:	e8 9a d6 ff ff       	call   800fc9 <sys_page_alloc>
+  80392f:	83 c4 10             	add    $0x10,%esp
+  803932:	85 c0                	test   %eax,%eax
+  803934:	75 2c                	jne    803962 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803936:	83 ec 08             	sub    $0x8,%esp
+  803939:	68 78 39 80 00       	push   $0x803978
+  80393e:	6a 00                	push   $0x0
+  803940:	e8 ef d7 ff ff       	call   801134 <sys_env_set_pgfault_upcall>
+  803945:	83 c4 10             	add    $0x10,%esp
+  803948:	85 c0                	test   %eax,%eax
+  80394a:	74 c8                	je     803914 <set_pgfault_handler+0xf>
+  80394c:	68 e0 42 80 00       	push   $0x8042e0
+  803951:	68 00 41 80 00       	push   $0x804100
+  803956:	6a 20                	push   $0x20
+  803958:	68 10 43 80 00       	push   $0x804310
+  80395d:	e8 23 fa ff ff       	call   803385 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803962:	68 98 42 80 00       	push   $0x804298
+  803967:	68 00 41 80 00       	push   $0x804100
+  80396c:	6a 1e                	push   $0x1e
+  80396e:	68 10 43 80 00       	push   $0x804310
+  803973:	e8 0d fa ff ff       	call   803385 <_panic>
+
+00803978 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803978:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803979:	a1 08 a0 80 00       	mov    0x80a008,%eax
+	call *%eax
+  80397e:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803980:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803983:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803988:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  80398d:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803991:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803994:	83 c4 08             	add    $0x8,%esp
+	popal
+  803997:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803998:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80399b:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  80399c:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80399d:	c3                   	ret
+
+0080399e <dm>:
+  80399e:	55                   	push   %ebp
+  80399f:	57                   	push   %edi
+  8039a0:	56                   	push   %esi
+  8039a1:	53                   	push   %ebx
+  8039a2:	83 ec 24             	sub    $0x24,%esp
+  8039a5:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8039a9:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8039ad:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8039b1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8039b5:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8039b9:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8039bd:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8039c1:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8039c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039d0:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8039d7:	00 
+  8039d8:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8039df:	00 
+  8039e0:	89 fb                	mov    %edi,%ebx
+  8039e2:	eb 08                	jmp    8039ec <dm+0x4e>
+  8039e4:	83 e9 01             	sub    $0x1,%ecx
+  8039e7:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8039ea:	74 68                	je     803a54 <dm+0xb6>
+  8039ec:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8039f0:	01 c0                	add    %eax,%eax
+  8039f2:	89 c6                	mov    %eax,%esi
+  8039f4:	89 d7                	mov    %edx,%edi
+  8039f6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039fa:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039fe:	0f ad d0             	shrd   %cl,%edx,%eax
+  803a01:	d3 ea                	shr    %cl,%edx
+  803a03:	f6 c1 20             	test   $0x20,%cl
+  803a06:	74 04                	je     803a0c <dm+0x6e>
+  803a08:	89 d0                	mov    %edx,%eax
+  803a0a:	31 d2                	xor    %edx,%edx
+  803a0c:	83 e0 01             	and    $0x1,%eax
+  803a0f:	89 04 24             	mov    %eax,(%esp)
+  803a12:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803a19:	00 
+  803a1a:	8b 04 24             	mov    (%esp),%eax
+  803a1d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803a21:	09 f0                	or     %esi,%eax
+  803a23:	09 fa                	or     %edi,%edx
+  803a25:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803a29:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803a2d:	39 f0                	cmp    %esi,%eax
+  803a2f:	89 d5                	mov    %edx,%ebp
+  803a31:	19 fd                	sbb    %edi,%ebp
+  803a33:	72 af                	jb     8039e4 <dm+0x46>
+  803a35:	29 f0                	sub    %esi,%eax
+  803a37:	19 fa                	sbb    %edi,%edx
+  803a39:	89 cf                	mov    %ecx,%edi
+  803a3b:	c1 ef 05             	shr    $0x5,%edi
+  803a3e:	83 e7 01             	and    $0x1,%edi
+  803a41:	89 fe                	mov    %edi,%esi
+  803a43:	83 f6 01             	xor    $0x1,%esi
+  803a46:	d3 e6                	shl    %cl,%esi
+  803a48:	d3 e7                	shl    %cl,%edi
+  803a4a:	09 74 24 18          	or     %esi,0x18(%esp)
+  803a4e:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803a52:	eb 90                	jmp    8039e4 <dm+0x46>
+  803a54:	85 db                	test   %ebx,%ebx
+  803a56:	74 05                	je     803a5d <dm+0xbf>
+  803a58:	89 03                	mov    %eax,(%ebx)
+  803a5a:	89 53 04             	mov    %edx,0x4(%ebx)
+  803a5d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a61:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a65:	83 c4 24             	add    $0x24,%esp
+  803a68:	5b                   	pop    %ebx
+  803a69:	5e                   	pop    %esi
+  803a6a:	5f                   	pop    %edi
+  803a6b:	5d                   	pop    %ebp
+  803a6c:	c3                   	ret
+
+00803a6d <__udivdi3>:
+  803a6d:	83 ec 08             	sub    $0x8,%esp
+  803a70:	6a 00                	push   $0x0
+  803a72:	ff 74 24 1c          	push   0x1c(%esp)
+  803a76:	ff 74 24 1c          	push   0x1c(%esp)
+  803a7a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a7e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a82:	e8 17 ff ff ff       	call   80399e <dm>
+  803a87:	83 c4 14             	add    $0x14,%esp
+  803a8a:	c3                   	ret
+
+00803a8b <__umoddi3>:
+  803a8b:	83 ec 18             	sub    $0x18,%esp
+  803a8e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803a92:	50                   	push   %eax
+  803a93:	ff 74 24 2c          	push   0x2c(%esp)
+  803a97:	ff 74 24 2c          	push   0x2c(%esp)
+  803a9b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a9f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803aa3:	e8 f6 fe ff ff       	call   80399e <dm>
+  803aa8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803aac:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ab0:	83 c4 24             	add    $0x24,%esp
+  803ab3:	c3                   	ret
+
+00803ab4 <__divdi3>:
+  803ab4:	53                   	push   %ebx
+  803ab5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803ab9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803abd:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803ac1:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803ac5:	85 d2                	test   %edx,%edx
+  803ac7:	78 15                	js     803ade <__divdi3+0x2a>
+  803ac9:	85 db                	test   %ebx,%ebx
+  803acb:	78 34                	js     803b01 <__divdi3+0x4d>
+  803acd:	83 ec 04             	sub    $0x4,%esp
+  803ad0:	6a 00                	push   $0x0
+  803ad2:	53                   	push   %ebx
+  803ad3:	51                   	push   %ecx
+  803ad4:	e8 c5 fe ff ff       	call   80399e <dm>
+  803ad9:	83 c4 10             	add    $0x10,%esp
+  803adc:	eb 21                	jmp    803aff <__divdi3+0x4b>
+  803ade:	f7 d8                	neg    %eax
+  803ae0:	83 d2 00             	adc    $0x0,%edx
+  803ae3:	f7 da                	neg    %edx
+  803ae5:	85 db                	test   %ebx,%ebx
+  803ae7:	78 30                	js     803b19 <__divdi3+0x65>
+  803ae9:	83 ec 04             	sub    $0x4,%esp
+  803aec:	6a 00                	push   $0x0
+  803aee:	53                   	push   %ebx
+  803aef:	51                   	push   %ecx
+  803af0:	e8 a9 fe ff ff       	call   80399e <dm>
+  803af5:	83 c4 10             	add    $0x10,%esp
+  803af8:	f7 d8                	neg    %eax
+  803afa:	83 d2 00             	adc    $0x0,%edx
+  803afd:	f7 da                	neg    %edx
+  803aff:	5b                   	pop    %ebx
+  803b00:	c3                   	ret
+  803b01:	83 ec 04             	sub    $0x4,%esp
+  803b04:	6a 00                	push   $0x0
+  803b06:	f7 d9                	neg    %ecx
+  803b08:	83 d3 00             	adc    $0x0,%ebx
+  803b0b:	f7 db                	neg    %ebx
+  803b0d:	53                   	push   %ebx
+  803b0e:	51                   	push   %ecx
+  803b0f:	e8 8a fe ff ff       	call   80399e <dm>
+  803b14:	83 c4 10             	add    $0x10,%esp
+  803b17:	eb df                	jmp    803af8 <__divdi3+0x44>
+  803b19:	83 ec 04             	sub    $0x4,%esp
+  803b1c:	6a 00                	push   $0x0
+  803b1e:	f7 d9                	neg    %ecx
+  803b20:	83 d3 00             	adc    $0x0,%ebx
+  803b23:	f7 db                	neg    %ebx
+  803b25:	53                   	push   %ebx
+  803b26:	51                   	push   %ecx
+  803b27:	e8 72 fe ff ff       	call   80399e <dm>
+  803b2c:	83 c4 10             	add    $0x10,%esp
+  803b2f:	eb ce                	jmp    803aff <__divdi3+0x4b>
+
+00803b31 <__moddi3>:
+  803b31:	55                   	push   %ebp
+  803b32:	57                   	push   %edi
+  803b33:	56                   	push   %esi
+  803b34:	53                   	push   %ebx
+  803b35:	83 ec 24             	sub    $0x24,%esp
+  803b38:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803b3c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803b40:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803b44:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803b48:	85 d2                	test   %edx,%edx
+  803b4a:	78 3b                	js     803b87 <__moddi3+0x56>
+  803b4c:	83 ec 04             	sub    $0x4,%esp
+  803b4f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803b53:	56                   	push   %esi
+  803b54:	89 ce                	mov    %ecx,%esi
+  803b56:	f7 de                	neg    %esi
+  803b58:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803b5c:	89 de                	mov    %ebx,%esi
+  803b5e:	83 d6 00             	adc    $0x0,%esi
+  803b61:	f7 de                	neg    %esi
+  803b63:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803b67:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803b6b:	0f 48 f1             	cmovs  %ecx,%esi
+  803b6e:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803b73:	53                   	push   %ebx
+  803b74:	56                   	push   %esi
+  803b75:	e8 24 fe ff ff       	call   80399e <dm>
+  803b7a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803b7e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803b82:	83 c4 10             	add    $0x10,%esp
+  803b85:	eb 47                	jmp    803bce <__moddi3+0x9d>
+  803b87:	f7 d8                	neg    %eax
+  803b89:	83 d2 00             	adc    $0x0,%edx
+  803b8c:	f7 da                	neg    %edx
+  803b8e:	83 ec 04             	sub    $0x4,%esp
+  803b91:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803b95:	56                   	push   %esi
+  803b96:	89 cf                	mov    %ecx,%edi
+  803b98:	f7 df                	neg    %edi
+  803b9a:	89 de                	mov    %ebx,%esi
+  803b9c:	83 d6 00             	adc    $0x0,%esi
+  803b9f:	f7 de                	neg    %esi
+  803ba1:	0f 49 cf             	cmovns %edi,%ecx
+  803ba4:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803ba8:	0f 49 de             	cmovns %esi,%ebx
+  803bab:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803baf:	ff 74 24 0c          	push   0xc(%esp)
+  803bb3:	ff 74 24 0c          	push   0xc(%esp)
+  803bb7:	e8 e2 fd ff ff       	call   80399e <dm>
+  803bbc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803bc0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803bc4:	f7 d8                	neg    %eax
+  803bc6:	83 d2 00             	adc    $0x0,%edx
+  803bc9:	f7 da                	neg    %edx
+  803bcb:	83 c4 10             	add    $0x10,%esp
+  803bce:	83 c4 24             	add    $0x24,%esp
+  803bd1:	5b                   	pop    %ebx
+  803bd2:	5e                   	pop    %esi
+  803bd3:	5f                   	pop    %edi
+  803bd4:	5d                   	pop    %ebp
+  803bd5:	c3                   	ret
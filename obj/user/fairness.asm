@@ -0,0 +1,7670 @@
+
+obj/user/fairness.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 70 00 00 00       	call   8000a1 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+	envid_t who, id;
+
+	id = sys_getenvid();
+  80003b:	e8 0d 0b 00 00       	call   800b4d <sys_getenvid>
+  800040:	89 c3                	mov    %eax,%ebx
+
+	if (thisenv == &envs[1]) {
+  800042:	81 3d 00 50 80 00 8c 	cmpl   $0xeec0008c,0x805000
+  800049:	00 c0 ee 
+  80004c:	74 2d                	je     80007b <umain+0x48>
+		while (1) {
+			ipc_recv(&who, 0, 0);
+			cprintf("%x recv from %x\n", id, who);
+		}
+	} else {
+		cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  80004e:	a1 d4 00 c0 ee       	mov    0xeec000d4,%eax
+  800053:	83 ec 04             	sub    $0x4,%esp
+  800056:	50                   	push   %eax
+  800057:	53                   	push   %ebx
+  800058:	68 b1 37 80 00       	push   $0x8037b1
+  80005d:	e8 37 01 00 00       	call   800199 <cprintf>
+  800062:	83 c4 10             	add    $0x10,%esp
+		while (1)
+			ipc_send(envs[1].env_id, 0, 0, 0);
+  800065:	a1 d4 00 c0 ee       	mov    0xeec000d4,%eax
+  80006a:	6a 00                	push   $0x0
+  80006c:	6a 00                	push   $0x0
+  80006e:	6a 00                	push   $0x0
+  800070:	50                   	push   %eax
+  800071:	e8 89 0f 00 00       	call   800fff <ipc_send>
+  800076:	83 c4 10             	add    $0x10,%esp
+  800079:	eb ea                	jmp    800065 <umain+0x32>
+			ipc_recv(&who, 0, 0);
+  80007b:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  80007e:	83 ec 04             	sub    $0x4,%esp
+  800081:	6a 00                	push   $0x0
+  800083:	6a 00                	push   $0x0
+  800085:	56                   	push   %esi
+  800086:	e8 09 0f 00 00       	call   800f94 <ipc_recv>
+			cprintf("%x recv from %x\n", id, who);
+  80008b:	83 c4 0c             	add    $0xc,%esp
+  80008e:	ff 75 f4             	push   -0xc(%ebp)
+  800091:	53                   	push   %ebx
+  800092:	68 a0 37 80 00       	push   $0x8037a0
+  800097:	e8 fd 00 00 00       	call   800199 <cprintf>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb dd                	jmp    80007e <umain+0x4b>
+
+008000a1 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000a1:	55                   	push   %ebp
+  8000a2:	89 e5                	mov    %esp,%ebp
+  8000a4:	56                   	push   %esi
+  8000a5:	53                   	push   %ebx
+  8000a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000ac:	e8 9c 0a 00 00       	call   800b4d <sys_getenvid>
+  8000b1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000b6:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8000bc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000c1:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000c6:	85 db                	test   %ebx,%ebx
+  8000c8:	7e 07                	jle    8000d1 <libmain+0x30>
+		binaryname = argv[0];
+  8000ca:	8b 06                	mov    (%esi),%eax
+  8000cc:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000d1:	83 ec 08             	sub    $0x8,%esp
+  8000d4:	56                   	push   %esi
+  8000d5:	53                   	push   %ebx
+  8000d6:	e8 58 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000db:	e8 0a 00 00 00       	call   8000ea <exit>
+}
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5d                   	pop    %ebp
+  8000e9:	c3                   	ret
+
+008000ea <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000ea:	55                   	push   %ebp
+  8000eb:	89 e5                	mov    %esp,%ebp
+  8000ed:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000f0:	e8 56 12 00 00       	call   80134b <close_all>
+	sys_env_destroy(0);
+  8000f5:	83 ec 0c             	sub    $0xc,%esp
+  8000f8:	6a 00                	push   $0x0
+  8000fa:	e8 05 0a 00 00       	call   800b04 <sys_env_destroy>
+}
+  8000ff:	83 c4 10             	add    $0x10,%esp
+  800102:	c9                   	leave
+  800103:	c3                   	ret
+
+00800104 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800104:	55                   	push   %ebp
+  800105:	89 e5                	mov    %esp,%ebp
+  800107:	53                   	push   %ebx
+  800108:	83 ec 04             	sub    $0x4,%esp
+  80010b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80010e:	8b 13                	mov    (%ebx),%edx
+  800110:	8d 42 01             	lea    0x1(%edx),%eax
+  800113:	89 03                	mov    %eax,(%ebx)
+  800115:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800118:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80011c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800121:	74 09                	je     80012c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800123:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800127:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80012a:	c9                   	leave
+  80012b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80012c:	83 ec 08             	sub    $0x8,%esp
+  80012f:	68 ff 00 00 00       	push   $0xff
+  800134:	8d 43 08             	lea    0x8(%ebx),%eax
+  800137:	50                   	push   %eax
+  800138:	e8 7a 09 00 00       	call   800ab7 <sys_cputs>
+		b->idx = 0;
+  80013d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800143:	83 c4 10             	add    $0x10,%esp
+  800146:	eb db                	jmp    800123 <putch+0x1f>
+
+00800148 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800148:	55                   	push   %ebp
+  800149:	89 e5                	mov    %esp,%ebp
+  80014b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800151:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800158:	00 00 00 
+	b.cnt = 0;
+  80015b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800162:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800165:	ff 75 0c             	push   0xc(%ebp)
+  800168:	ff 75 08             	push   0x8(%ebp)
+  80016b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800171:	50                   	push   %eax
+  800172:	68 04 01 80 00       	push   $0x800104
+  800177:	e8 14 01 00 00       	call   800290 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80017c:	83 c4 08             	add    $0x8,%esp
+  80017f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800185:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80018b:	50                   	push   %eax
+  80018c:	e8 26 09 00 00       	call   800ab7 <sys_cputs>
+
+	return b.cnt;
+}
+  800191:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800197:	c9                   	leave
+  800198:	c3                   	ret
+
+00800199 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800199:	55                   	push   %ebp
+  80019a:	89 e5                	mov    %esp,%ebp
+  80019c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80019f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001a2:	50                   	push   %eax
+  8001a3:	ff 75 08             	push   0x8(%ebp)
+  8001a6:	e8 9d ff ff ff       	call   800148 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001ab:	c9                   	leave
+  8001ac:	c3                   	ret
+
+008001ad <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001ad:	55                   	push   %ebp
+  8001ae:	89 e5                	mov    %esp,%ebp
+  8001b0:	57                   	push   %edi
+  8001b1:	56                   	push   %esi
+  8001b2:	53                   	push   %ebx
+  8001b3:	83 ec 1c             	sub    $0x1c,%esp
+  8001b6:	89 c7                	mov    %eax,%edi
+  8001b8:	89 d6                	mov    %edx,%esi
+  8001ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001c0:	89 d1                	mov    %edx,%ecx
+  8001c2:	89 c2                	mov    %eax,%edx
+  8001c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001c7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001ca:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001cd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001d3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001da:	39 c2                	cmp    %eax,%edx
+  8001dc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001df:	72 3e                	jb     80021f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001e1:	83 ec 0c             	sub    $0xc,%esp
+  8001e4:	ff 75 18             	push   0x18(%ebp)
+  8001e7:	83 eb 01             	sub    $0x1,%ebx
+  8001ea:	53                   	push   %ebx
+  8001eb:	50                   	push   %eax
+  8001ec:	83 ec 08             	sub    $0x8,%esp
+  8001ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8001f2:	ff 75 e0             	push   -0x20(%ebp)
+  8001f5:	ff 75 dc             	push   -0x24(%ebp)
+  8001f8:	ff 75 d8             	push   -0x28(%ebp)
+  8001fb:	e8 37 34 00 00       	call   803637 <__udivdi3>
+  800200:	83 c4 18             	add    $0x18,%esp
+  800203:	52                   	push   %edx
+  800204:	50                   	push   %eax
+  800205:	89 f2                	mov    %esi,%edx
+  800207:	89 f8                	mov    %edi,%eax
+  800209:	e8 9f ff ff ff       	call   8001ad <printnum>
+  80020e:	83 c4 20             	add    $0x20,%esp
+  800211:	eb 13                	jmp    800226 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800213:	83 ec 08             	sub    $0x8,%esp
+  800216:	56                   	push   %esi
+  800217:	ff 75 18             	push   0x18(%ebp)
+  80021a:	ff d7                	call   *%edi
+  80021c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80021f:	83 eb 01             	sub    $0x1,%ebx
+  800222:	85 db                	test   %ebx,%ebx
+  800224:	7f ed                	jg     800213 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800226:	83 ec 08             	sub    $0x8,%esp
+  800229:	56                   	push   %esi
+  80022a:	83 ec 04             	sub    $0x4,%esp
+  80022d:	ff 75 e4             	push   -0x1c(%ebp)
+  800230:	ff 75 e0             	push   -0x20(%ebp)
+  800233:	ff 75 dc             	push   -0x24(%ebp)
+  800236:	ff 75 d8             	push   -0x28(%ebp)
+  800239:	e8 17 34 00 00       	call   803655 <__umoddi3>
+  80023e:	83 c4 14             	add    $0x14,%esp
+  800241:	0f be 80 d2 37 80 00 	movsbl 0x8037d2(%eax),%eax
+  800248:	50                   	push   %eax
+  800249:	ff d7                	call   *%edi
+}
+  80024b:	83 c4 10             	add    $0x10,%esp
+  80024e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800251:	5b                   	pop    %ebx
+  800252:	5e                   	pop    %esi
+  800253:	5f                   	pop    %edi
+  800254:	5d                   	pop    %ebp
+  800255:	c3                   	ret
+
+00800256 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800256:	55                   	push   %ebp
+  800257:	89 e5                	mov    %esp,%ebp
+  800259:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80025c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800260:	8b 10                	mov    (%eax),%edx
+  800262:	3b 50 04             	cmp    0x4(%eax),%edx
+  800265:	73 0a                	jae    800271 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800267:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80026a:	89 08                	mov    %ecx,(%eax)
+  80026c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80026f:	88 02                	mov    %al,(%edx)
+}
+  800271:	5d                   	pop    %ebp
+  800272:	c3                   	ret
+
+00800273 <printfmt>:
+{
+  800273:	55                   	push   %ebp
+  800274:	89 e5                	mov    %esp,%ebp
+  800276:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800279:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80027c:	50                   	push   %eax
+  80027d:	ff 75 10             	push   0x10(%ebp)
+  800280:	ff 75 0c             	push   0xc(%ebp)
+  800283:	ff 75 08             	push   0x8(%ebp)
+  800286:	e8 05 00 00 00       	call   800290 <vprintfmt>
+}
+  80028b:	83 c4 10             	add    $0x10,%esp
+  80028e:	c9                   	leave
+  80028f:	c3                   	ret
+
+00800290 <vprintfmt>:
+{
+  800290:	55                   	push   %ebp
+  800291:	89 e5                	mov    %esp,%ebp
+  800293:	57                   	push   %edi
+  800294:	56                   	push   %esi
+  800295:	53                   	push   %ebx
+  800296:	83 ec 2c             	sub    $0x2c,%esp
+  800299:	8b 75 08             	mov    0x8(%ebp),%esi
+  80029c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80029f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002a2:	eb 0a                	jmp    8002ae <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002a4:	83 ec 08             	sub    $0x8,%esp
+  8002a7:	53                   	push   %ebx
+  8002a8:	50                   	push   %eax
+  8002a9:	ff d6                	call   *%esi
+  8002ab:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002ae:	83 c7 01             	add    $0x1,%edi
+  8002b1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002b5:	83 f8 25             	cmp    $0x25,%eax
+  8002b8:	74 0c                	je     8002c6 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002ba:	85 c0                	test   %eax,%eax
+  8002bc:	75 e6                	jne    8002a4 <vprintfmt+0x14>
+}
+  8002be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c1:	5b                   	pop    %ebx
+  8002c2:	5e                   	pop    %esi
+  8002c3:	5f                   	pop    %edi
+  8002c4:	5d                   	pop    %ebp
+  8002c5:	c3                   	ret
+		padc = ' ';
+  8002c6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002ca:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002d1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002d8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002df:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002e4:	8d 47 01             	lea    0x1(%edi),%eax
+  8002e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002ea:	0f b6 17             	movzbl (%edi),%edx
+  8002ed:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002f0:	3c 55                	cmp    $0x55,%al
+  8002f2:	0f 87 cf 03 00 00    	ja     8006c7 <vprintfmt+0x437>
+  8002f8:	0f b6 c0             	movzbl %al,%eax
+  8002fb:	ff 24 85 40 39 80 00 	jmp    *0x803940(,%eax,4)
+  800302:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800305:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800309:	eb d9                	jmp    8002e4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80030b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80030e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800312:	eb d0                	jmp    8002e4 <vprintfmt+0x54>
+  800314:	0f b6 d2             	movzbl %dl,%edx
+  800317:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80031a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800322:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800325:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800329:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80032c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80032f:	83 f9 09             	cmp    $0x9,%ecx
+  800332:	77 55                	ja     800389 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800334:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800337:	eb e9                	jmp    800322 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800339:	8b 45 14             	mov    0x14(%ebp),%eax
+  80033c:	8b 00                	mov    (%eax),%eax
+  80033e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800341:	8b 45 14             	mov    0x14(%ebp),%eax
+  800344:	8d 40 04             	lea    0x4(%eax),%eax
+  800347:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80034a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80034d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800351:	79 91                	jns    8002e4 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800353:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800356:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800359:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800360:	eb 82                	jmp    8002e4 <vprintfmt+0x54>
+			if (width < 0)
+  800362:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800365:	85 d2                	test   %edx,%edx
+  800367:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036c:	0f 49 c2             	cmovns %edx,%eax
+  80036f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800372:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800375:	e9 6a ff ff ff       	jmp    8002e4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80037a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80037d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800384:	e9 5b ff ff ff       	jmp    8002e4 <vprintfmt+0x54>
+  800389:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80038c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80038f:	eb bc                	jmp    80034d <vprintfmt+0xbd>
+			lflag++;
+  800391:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800394:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800397:	e9 48 ff ff ff       	jmp    8002e4 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80039c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039f:	8d 78 04             	lea    0x4(%eax),%edi
+  8003a2:	83 ec 08             	sub    $0x8,%esp
+  8003a5:	53                   	push   %ebx
+  8003a6:	ff 30                	push   (%eax)
+  8003a8:	ff d6                	call   *%esi
+			break;
+  8003aa:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003ad:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003b0:	e9 b1 02 00 00       	jmp    800666 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003bb:	8b 10                	mov    (%eax),%edx
+  8003bd:	89 d0                	mov    %edx,%eax
+  8003bf:	f7 d8                	neg    %eax
+  8003c1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003c4:	83 f8 11             	cmp    $0x11,%eax
+  8003c7:	7f 23                	jg     8003ec <vprintfmt+0x15c>
+  8003c9:	8b 14 85 a0 3a 80 00 	mov    0x803aa0(,%eax,4),%edx
+  8003d0:	85 d2                	test   %edx,%edx
+  8003d2:	74 18                	je     8003ec <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003d4:	52                   	push   %edx
+  8003d5:	68 59 3b 80 00       	push   $0x803b59
+  8003da:	53                   	push   %ebx
+  8003db:	56                   	push   %esi
+  8003dc:	e8 92 fe ff ff       	call   800273 <printfmt>
+  8003e1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003e4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003e7:	e9 7a 02 00 00       	jmp    800666 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003ec:	50                   	push   %eax
+  8003ed:	68 ea 37 80 00       	push   $0x8037ea
+  8003f2:	53                   	push   %ebx
+  8003f3:	56                   	push   %esi
+  8003f4:	e8 7a fe ff ff       	call   800273 <printfmt>
+  8003f9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003fc:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003ff:	e9 62 02 00 00       	jmp    800666 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800404:	8b 45 14             	mov    0x14(%ebp),%eax
+  800407:	83 c0 04             	add    $0x4,%eax
+  80040a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80040d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800410:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800412:	85 c9                	test   %ecx,%ecx
+  800414:	b8 e3 37 80 00       	mov    $0x8037e3,%eax
+  800419:	0f 45 c1             	cmovne %ecx,%eax
+  80041c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80041f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800423:	7e 06                	jle    80042b <vprintfmt+0x19b>
+  800425:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800429:	75 0b                	jne    800436 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80042b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80042e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800431:	89 75 08             	mov    %esi,0x8(%ebp)
+  800434:	eb 5c                	jmp    800492 <vprintfmt+0x202>
+  800436:	83 ec 08             	sub    $0x8,%esp
+  800439:	ff 75 d0             	push   -0x30(%ebp)
+  80043c:	ff 75 cc             	push   -0x34(%ebp)
+  80043f:	e8 20 03 00 00       	call   800764 <strnlen>
+  800444:	89 c2                	mov    %eax,%edx
+  800446:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800449:	29 d0                	sub    %edx,%eax
+  80044b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80044e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800452:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800455:	89 75 08             	mov    %esi,0x8(%ebp)
+  800458:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80045a:	eb 0e                	jmp    80046a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80045c:	83 ec 08             	sub    $0x8,%esp
+  80045f:	53                   	push   %ebx
+  800460:	57                   	push   %edi
+  800461:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800464:	83 ee 01             	sub    $0x1,%esi
+  800467:	83 c4 10             	add    $0x10,%esp
+  80046a:	85 f6                	test   %esi,%esi
+  80046c:	7f ee                	jg     80045c <vprintfmt+0x1cc>
+  80046e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800471:	8b 75 08             	mov    0x8(%ebp),%esi
+  800474:	85 c0                	test   %eax,%eax
+  800476:	ba 00 00 00 00       	mov    $0x0,%edx
+  80047b:	0f 49 d0             	cmovns %eax,%edx
+  80047e:	29 d0                	sub    %edx,%eax
+  800480:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800483:	eb a6                	jmp    80042b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800485:	83 ec 08             	sub    $0x8,%esp
+  800488:	53                   	push   %ebx
+  800489:	52                   	push   %edx
+  80048a:	ff 55 08             	call   *0x8(%ebp)
+  80048d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800490:	89 f1                	mov    %esi,%ecx
+  800492:	8d 71 01             	lea    0x1(%ecx),%esi
+  800495:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800499:	0f be d0             	movsbl %al,%edx
+  80049c:	85 d2                	test   %edx,%edx
+  80049e:	74 28                	je     8004c8 <vprintfmt+0x238>
+  8004a0:	85 ff                	test   %edi,%edi
+  8004a2:	78 05                	js     8004a9 <vprintfmt+0x219>
+  8004a4:	83 ef 01             	sub    $0x1,%edi
+  8004a7:	78 30                	js     8004d9 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004a9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004ad:	74 d6                	je     800485 <vprintfmt+0x1f5>
+  8004af:	0f be c0             	movsbl %al,%eax
+  8004b2:	83 e8 20             	sub    $0x20,%eax
+  8004b5:	83 f8 5e             	cmp    $0x5e,%eax
+  8004b8:	76 cb                	jbe    800485 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004ba:	83 ec 08             	sub    $0x8,%esp
+  8004bd:	53                   	push   %ebx
+  8004be:	6a 3f                	push   $0x3f
+  8004c0:	ff 55 08             	call   *0x8(%ebp)
+  8004c3:	83 c4 10             	add    $0x10,%esp
+  8004c6:	eb c8                	jmp    800490 <vprintfmt+0x200>
+  8004c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004cb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d1:	01 d0                	add    %edx,%eax
+  8004d3:	29 c8                	sub    %ecx,%eax
+  8004d5:	89 c7                	mov    %eax,%edi
+  8004d7:	eb 13                	jmp    8004ec <vprintfmt+0x25c>
+  8004d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004dc:	eb ed                	jmp    8004cb <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004de:	83 ec 08             	sub    $0x8,%esp
+  8004e1:	53                   	push   %ebx
+  8004e2:	6a 20                	push   $0x20
+  8004e4:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004e6:	83 ef 01             	sub    $0x1,%edi
+  8004e9:	83 c4 10             	add    $0x10,%esp
+  8004ec:	85 ff                	test   %edi,%edi
+  8004ee:	7f ee                	jg     8004de <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004f0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004f6:	e9 6b 01 00 00       	jmp    800666 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004fb:	83 f9 01             	cmp    $0x1,%ecx
+  8004fe:	7f 1f                	jg     80051f <vprintfmt+0x28f>
+	else if (lflag)
+  800500:	85 c9                	test   %ecx,%ecx
+  800502:	74 67                	je     80056b <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800504:	8b 45 14             	mov    0x14(%ebp),%eax
+  800507:	8b 00                	mov    (%eax),%eax
+  800509:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80050c:	89 c1                	mov    %eax,%ecx
+  80050e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800511:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800514:	8b 45 14             	mov    0x14(%ebp),%eax
+  800517:	8d 40 04             	lea    0x4(%eax),%eax
+  80051a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80051d:	eb 17                	jmp    800536 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80051f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800522:	8b 50 04             	mov    0x4(%eax),%edx
+  800525:	8b 00                	mov    (%eax),%eax
+  800527:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80052d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800530:	8d 40 08             	lea    0x8(%eax),%eax
+  800533:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800536:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800539:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80053c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800541:	85 c9                	test   %ecx,%ecx
+  800543:	0f 89 03 01 00 00    	jns    80064c <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800549:	83 ec 08             	sub    $0x8,%esp
+  80054c:	53                   	push   %ebx
+  80054d:	6a 2d                	push   $0x2d
+  80054f:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800551:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800554:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800557:	f7 da                	neg    %edx
+  800559:	83 d1 00             	adc    $0x0,%ecx
+  80055c:	f7 d9                	neg    %ecx
+  80055e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800561:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800566:	e9 e1 00 00 00       	jmp    80064c <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80056b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056e:	8b 00                	mov    (%eax),%eax
+  800570:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800573:	89 c1                	mov    %eax,%ecx
+  800575:	c1 f9 1f             	sar    $0x1f,%ecx
+  800578:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80057b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057e:	8d 40 04             	lea    0x4(%eax),%eax
+  800581:	89 45 14             	mov    %eax,0x14(%ebp)
+  800584:	eb b0                	jmp    800536 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800586:	83 f9 01             	cmp    $0x1,%ecx
+  800589:	7f 1e                	jg     8005a9 <vprintfmt+0x319>
+	else if (lflag)
+  80058b:	85 c9                	test   %ecx,%ecx
+  80058d:	74 32                	je     8005c1 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8b 10                	mov    (%eax),%edx
+  800594:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800599:	8d 40 04             	lea    0x4(%eax),%eax
+  80059c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80059f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005a4:	e9 a3 00 00 00       	jmp    80064c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ac:	8b 10                	mov    (%eax),%edx
+  8005ae:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005b1:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005b7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005bc:	e9 8b 00 00 00       	jmp    80064c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c4:	8b 10                	mov    (%eax),%edx
+  8005c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005d6:	eb 74                	jmp    80064c <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005d8:	83 f9 01             	cmp    $0x1,%ecx
+  8005db:	7f 1b                	jg     8005f8 <vprintfmt+0x368>
+	else if (lflag)
+  8005dd:	85 c9                	test   %ecx,%ecx
+  8005df:	74 2c                	je     80060d <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e4:	8b 10                	mov    (%eax),%edx
+  8005e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005f1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005f6:	eb 54                	jmp    80064c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fb:	8b 10                	mov    (%eax),%edx
+  8005fd:	8b 48 04             	mov    0x4(%eax),%ecx
+  800600:	8d 40 08             	lea    0x8(%eax),%eax
+  800603:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800606:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80060b:	eb 3f                	jmp    80064c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80060d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800610:	8b 10                	mov    (%eax),%edx
+  800612:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800617:	8d 40 04             	lea    0x4(%eax),%eax
+  80061a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80061d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800622:	eb 28                	jmp    80064c <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800624:	83 ec 08             	sub    $0x8,%esp
+  800627:	53                   	push   %ebx
+  800628:	6a 30                	push   $0x30
+  80062a:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80062c:	83 c4 08             	add    $0x8,%esp
+  80062f:	53                   	push   %ebx
+  800630:	6a 78                	push   $0x78
+  800632:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800634:	8b 45 14             	mov    0x14(%ebp),%eax
+  800637:	8b 10                	mov    (%eax),%edx
+  800639:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80063e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800641:	8d 40 04             	lea    0x4(%eax),%eax
+  800644:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800647:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80064c:	83 ec 0c             	sub    $0xc,%esp
+  80064f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800653:	50                   	push   %eax
+  800654:	ff 75 e0             	push   -0x20(%ebp)
+  800657:	57                   	push   %edi
+  800658:	51                   	push   %ecx
+  800659:	52                   	push   %edx
+  80065a:	89 da                	mov    %ebx,%edx
+  80065c:	89 f0                	mov    %esi,%eax
+  80065e:	e8 4a fb ff ff       	call   8001ad <printnum>
+			break;
+  800663:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800666:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800669:	e9 40 fc ff ff       	jmp    8002ae <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80066e:	83 f9 01             	cmp    $0x1,%ecx
+  800671:	7f 1b                	jg     80068e <vprintfmt+0x3fe>
+	else if (lflag)
+  800673:	85 c9                	test   %ecx,%ecx
+  800675:	74 2c                	je     8006a3 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067a:	8b 10                	mov    (%eax),%edx
+  80067c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800681:	8d 40 04             	lea    0x4(%eax),%eax
+  800684:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800687:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80068c:	eb be                	jmp    80064c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	8b 10                	mov    (%eax),%edx
+  800693:	8b 48 04             	mov    0x4(%eax),%ecx
+  800696:	8d 40 08             	lea    0x8(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80069c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006a1:	eb a9                	jmp    80064c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8b 10                	mov    (%eax),%edx
+  8006a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006b8:	eb 92                	jmp    80064c <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006ba:	83 ec 08             	sub    $0x8,%esp
+  8006bd:	53                   	push   %ebx
+  8006be:	6a 25                	push   $0x25
+  8006c0:	ff d6                	call   *%esi
+			break;
+  8006c2:	83 c4 10             	add    $0x10,%esp
+  8006c5:	eb 9f                	jmp    800666 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006c7:	83 ec 08             	sub    $0x8,%esp
+  8006ca:	53                   	push   %ebx
+  8006cb:	6a 25                	push   $0x25
+  8006cd:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006cf:	83 c4 10             	add    $0x10,%esp
+  8006d2:	89 f8                	mov    %edi,%eax
+  8006d4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006d8:	74 05                	je     8006df <vprintfmt+0x44f>
+  8006da:	83 e8 01             	sub    $0x1,%eax
+  8006dd:	eb f5                	jmp    8006d4 <vprintfmt+0x444>
+  8006df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006e2:	eb 82                	jmp    800666 <vprintfmt+0x3d6>
+
+008006e4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006e4:	55                   	push   %ebp
+  8006e5:	89 e5                	mov    %esp,%ebp
+  8006e7:	83 ec 18             	sub    $0x18,%esp
+  8006ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006f0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006f3:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006f7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006fa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800701:	85 c0                	test   %eax,%eax
+  800703:	74 26                	je     80072b <vsnprintf+0x47>
+  800705:	85 d2                	test   %edx,%edx
+  800707:	7e 22                	jle    80072b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800709:	ff 75 14             	push   0x14(%ebp)
+  80070c:	ff 75 10             	push   0x10(%ebp)
+  80070f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800712:	50                   	push   %eax
+  800713:	68 56 02 80 00       	push   $0x800256
+  800718:	e8 73 fb ff ff       	call   800290 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80071d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800720:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800723:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800726:	83 c4 10             	add    $0x10,%esp
+}
+  800729:	c9                   	leave
+  80072a:	c3                   	ret
+		return -E_INVAL;
+  80072b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800730:	eb f7                	jmp    800729 <vsnprintf+0x45>
+
+00800732 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800732:	55                   	push   %ebp
+  800733:	89 e5                	mov    %esp,%ebp
+  800735:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800738:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80073b:	50                   	push   %eax
+  80073c:	ff 75 10             	push   0x10(%ebp)
+  80073f:	ff 75 0c             	push   0xc(%ebp)
+  800742:	ff 75 08             	push   0x8(%ebp)
+  800745:	e8 9a ff ff ff       	call   8006e4 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80074a:	c9                   	leave
+  80074b:	c3                   	ret
+
+0080074c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80074c:	55                   	push   %ebp
+  80074d:	89 e5                	mov    %esp,%ebp
+  80074f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800752:	b8 00 00 00 00       	mov    $0x0,%eax
+  800757:	eb 03                	jmp    80075c <strlen+0x10>
+		n++;
+  800759:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80075c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800760:	75 f7                	jne    800759 <strlen+0xd>
+	return n;
+}
+  800762:	5d                   	pop    %ebp
+  800763:	c3                   	ret
+
+00800764 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800764:	55                   	push   %ebp
+  800765:	89 e5                	mov    %esp,%ebp
+  800767:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80076a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80076d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800772:	eb 03                	jmp    800777 <strnlen+0x13>
+		n++;
+  800774:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800777:	39 d0                	cmp    %edx,%eax
+  800779:	74 08                	je     800783 <strnlen+0x1f>
+  80077b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80077f:	75 f3                	jne    800774 <strnlen+0x10>
+  800781:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800783:	89 d0                	mov    %edx,%eax
+  800785:	5d                   	pop    %ebp
+  800786:	c3                   	ret
+
+00800787 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800787:	55                   	push   %ebp
+  800788:	89 e5                	mov    %esp,%ebp
+  80078a:	53                   	push   %ebx
+  80078b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80078e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800791:	b8 00 00 00 00       	mov    $0x0,%eax
+  800796:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80079a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80079d:	83 c0 01             	add    $0x1,%eax
+  8007a0:	84 d2                	test   %dl,%dl
+  8007a2:	75 f2                	jne    800796 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007a4:	89 c8                	mov    %ecx,%eax
+  8007a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007a9:	c9                   	leave
+  8007aa:	c3                   	ret
+
+008007ab <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007ab:	55                   	push   %ebp
+  8007ac:	89 e5                	mov    %esp,%ebp
+  8007ae:	53                   	push   %ebx
+  8007af:	83 ec 10             	sub    $0x10,%esp
+  8007b2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007b5:	53                   	push   %ebx
+  8007b6:	e8 91 ff ff ff       	call   80074c <strlen>
+  8007bb:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007be:	ff 75 0c             	push   0xc(%ebp)
+  8007c1:	01 d8                	add    %ebx,%eax
+  8007c3:	50                   	push   %eax
+  8007c4:	e8 be ff ff ff       	call   800787 <strcpy>
+	return dst;
+}
+  8007c9:	89 d8                	mov    %ebx,%eax
+  8007cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ce:	c9                   	leave
+  8007cf:	c3                   	ret
+
+008007d0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007d0:	55                   	push   %ebp
+  8007d1:	89 e5                	mov    %esp,%ebp
+  8007d3:	56                   	push   %esi
+  8007d4:	53                   	push   %ebx
+  8007d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007db:	89 f3                	mov    %esi,%ebx
+  8007dd:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007e0:	89 f0                	mov    %esi,%eax
+  8007e2:	eb 0f                	jmp    8007f3 <strncpy+0x23>
+		*dst++ = *src;
+  8007e4:	83 c0 01             	add    $0x1,%eax
+  8007e7:	0f b6 0a             	movzbl (%edx),%ecx
+  8007ea:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007ed:	80 f9 01             	cmp    $0x1,%cl
+  8007f0:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007f3:	39 d8                	cmp    %ebx,%eax
+  8007f5:	75 ed                	jne    8007e4 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007f7:	89 f0                	mov    %esi,%eax
+  8007f9:	5b                   	pop    %ebx
+  8007fa:	5e                   	pop    %esi
+  8007fb:	5d                   	pop    %ebp
+  8007fc:	c3                   	ret
+
+008007fd <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007fd:	55                   	push   %ebp
+  8007fe:	89 e5                	mov    %esp,%ebp
+  800800:	56                   	push   %esi
+  800801:	53                   	push   %ebx
+  800802:	8b 75 08             	mov    0x8(%ebp),%esi
+  800805:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800808:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80080b:	89 f0                	mov    %esi,%eax
+  80080d:	85 d2                	test   %edx,%edx
+  80080f:	74 21                	je     800832 <strlcpy+0x35>
+  800811:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800815:	89 f2                	mov    %esi,%edx
+  800817:	eb 09                	jmp    800822 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800819:	83 c1 01             	add    $0x1,%ecx
+  80081c:	83 c2 01             	add    $0x1,%edx
+  80081f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800822:	39 c2                	cmp    %eax,%edx
+  800824:	74 09                	je     80082f <strlcpy+0x32>
+  800826:	0f b6 19             	movzbl (%ecx),%ebx
+  800829:	84 db                	test   %bl,%bl
+  80082b:	75 ec                	jne    800819 <strlcpy+0x1c>
+  80082d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80082f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800832:	29 f0                	sub    %esi,%eax
+}
+  800834:	5b                   	pop    %ebx
+  800835:	5e                   	pop    %esi
+  800836:	5d                   	pop    %ebp
+  800837:	c3                   	ret
+
+00800838 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800838:	55                   	push   %ebp
+  800839:	89 e5                	mov    %esp,%ebp
+  80083b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80083e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800841:	eb 06                	jmp    800849 <strcmp+0x11>
+		p++, q++;
+  800843:	83 c1 01             	add    $0x1,%ecx
+  800846:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800849:	0f b6 01             	movzbl (%ecx),%eax
+  80084c:	84 c0                	test   %al,%al
+  80084e:	74 04                	je     800854 <strcmp+0x1c>
+  800850:	3a 02                	cmp    (%edx),%al
+  800852:	74 ef                	je     800843 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800854:	0f b6 c0             	movzbl %al,%eax
+  800857:	0f b6 12             	movzbl (%edx),%edx
+  80085a:	29 d0                	sub    %edx,%eax
+}
+  80085c:	5d                   	pop    %ebp
+  80085d:	c3                   	ret
+
+0080085e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80085e:	55                   	push   %ebp
+  80085f:	89 e5                	mov    %esp,%ebp
+  800861:	53                   	push   %ebx
+  800862:	8b 45 08             	mov    0x8(%ebp),%eax
+  800865:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800868:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80086b:	eb 09                	jmp    800876 <strncmp+0x18>
+		n--, p++, q++;
+  80086d:	83 ea 01             	sub    $0x1,%edx
+  800870:	83 c0 01             	add    $0x1,%eax
+  800873:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800876:	85 d2                	test   %edx,%edx
+  800878:	74 18                	je     800892 <strncmp+0x34>
+  80087a:	0f b6 18             	movzbl (%eax),%ebx
+  80087d:	84 db                	test   %bl,%bl
+  80087f:	74 04                	je     800885 <strncmp+0x27>
+  800881:	3a 19                	cmp    (%ecx),%bl
+  800883:	74 e8                	je     80086d <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800885:	0f b6 00             	movzbl (%eax),%eax
+  800888:	0f b6 11             	movzbl (%ecx),%edx
+  80088b:	29 d0                	sub    %edx,%eax
+}
+  80088d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800890:	c9                   	leave
+  800891:	c3                   	ret
+		return 0;
+  800892:	b8 00 00 00 00       	mov    $0x0,%eax
+  800897:	eb f4                	jmp    80088d <strncmp+0x2f>
+
+00800899 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800899:	55                   	push   %ebp
+  80089a:	89 e5                	mov    %esp,%ebp
+  80089c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008a3:	eb 03                	jmp    8008a8 <strchr+0xf>
+  8008a5:	83 c0 01             	add    $0x1,%eax
+  8008a8:	0f b6 10             	movzbl (%eax),%edx
+  8008ab:	84 d2                	test   %dl,%dl
+  8008ad:	74 06                	je     8008b5 <strchr+0x1c>
+		if (*s == c)
+  8008af:	38 ca                	cmp    %cl,%dl
+  8008b1:	75 f2                	jne    8008a5 <strchr+0xc>
+  8008b3:	eb 05                	jmp    8008ba <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008ba:	5d                   	pop    %ebp
+  8008bb:	c3                   	ret
+
+008008bc <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008bc:	55                   	push   %ebp
+  8008bd:	89 e5                	mov    %esp,%ebp
+  8008bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008c6:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008c9:	38 ca                	cmp    %cl,%dl
+  8008cb:	74 09                	je     8008d6 <strfind+0x1a>
+  8008cd:	84 d2                	test   %dl,%dl
+  8008cf:	74 05                	je     8008d6 <strfind+0x1a>
+	for (; *s; s++)
+  8008d1:	83 c0 01             	add    $0x1,%eax
+  8008d4:	eb f0                	jmp    8008c6 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008d6:	5d                   	pop    %ebp
+  8008d7:	c3                   	ret
+
+008008d8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008d8:	55                   	push   %ebp
+  8008d9:	89 e5                	mov    %esp,%ebp
+  8008db:	57                   	push   %edi
+  8008dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008df:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008e2:	85 c9                	test   %ecx,%ecx
+  8008e4:	74 20                	je     800906 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008e6:	89 f8                	mov    %edi,%eax
+  8008e8:	09 c8                	or     %ecx,%eax
+  8008ea:	a8 03                	test   $0x3,%al
+  8008ec:	75 12                	jne    800900 <memset+0x28>
+		c &= 0xFF;
+  8008ee:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008f2:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008f8:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008fb:	fc                   	cld
+  8008fc:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008fe:	eb 06                	jmp    800906 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800900:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800903:	fc                   	cld
+  800904:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800906:	89 f8                	mov    %edi,%eax
+  800908:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80090b:	c9                   	leave
+  80090c:	c3                   	ret
+
+0080090d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80090d:	55                   	push   %ebp
+  80090e:	89 e5                	mov    %esp,%ebp
+  800910:	57                   	push   %edi
+  800911:	56                   	push   %esi
+  800912:	8b 45 08             	mov    0x8(%ebp),%eax
+  800915:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800918:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80091b:	39 c6                	cmp    %eax,%esi
+  80091d:	73 32                	jae    800951 <memmove+0x44>
+  80091f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800922:	39 d0                	cmp    %edx,%eax
+  800924:	73 2b                	jae    800951 <memmove+0x44>
+		s += n;
+		d += n;
+  800926:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800929:	89 d6                	mov    %edx,%esi
+  80092b:	09 fe                	or     %edi,%esi
+  80092d:	09 ce                	or     %ecx,%esi
+  80092f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800935:	75 0e                	jne    800945 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800937:	83 ef 04             	sub    $0x4,%edi
+  80093a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80093d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800940:	fd                   	std
+  800941:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800943:	eb 09                	jmp    80094e <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800945:	83 ef 01             	sub    $0x1,%edi
+  800948:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80094b:	fd                   	std
+  80094c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80094e:	fc                   	cld
+  80094f:	eb 1a                	jmp    80096b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800951:	89 f2                	mov    %esi,%edx
+  800953:	09 c2                	or     %eax,%edx
+  800955:	09 ca                	or     %ecx,%edx
+  800957:	f6 c2 03             	test   $0x3,%dl
+  80095a:	75 0a                	jne    800966 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80095c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80095f:	89 c7                	mov    %eax,%edi
+  800961:	fc                   	cld
+  800962:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800964:	eb 05                	jmp    80096b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800966:	89 c7                	mov    %eax,%edi
+  800968:	fc                   	cld
+  800969:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80096b:	5e                   	pop    %esi
+  80096c:	5f                   	pop    %edi
+  80096d:	5d                   	pop    %ebp
+  80096e:	c3                   	ret
+
+0080096f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80096f:	55                   	push   %ebp
+  800970:	89 e5                	mov    %esp,%ebp
+  800972:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800975:	ff 75 10             	push   0x10(%ebp)
+  800978:	ff 75 0c             	push   0xc(%ebp)
+  80097b:	ff 75 08             	push   0x8(%ebp)
+  80097e:	e8 8a ff ff ff       	call   80090d <memmove>
+}
+  800983:	c9                   	leave
+  800984:	c3                   	ret
+
+00800985 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800985:	55                   	push   %ebp
+  800986:	89 e5                	mov    %esp,%ebp
+  800988:	56                   	push   %esi
+  800989:	53                   	push   %ebx
+  80098a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800990:	89 c6                	mov    %eax,%esi
+  800992:	03 75 10             	add    0x10(%ebp),%esi
+  800995:	eb 06                	jmp    80099d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800997:	83 c0 01             	add    $0x1,%eax
+  80099a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80099d:	39 f0                	cmp    %esi,%eax
+  80099f:	74 14                	je     8009b5 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009a1:	0f b6 08             	movzbl (%eax),%ecx
+  8009a4:	0f b6 1a             	movzbl (%edx),%ebx
+  8009a7:	38 d9                	cmp    %bl,%cl
+  8009a9:	74 ec                	je     800997 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009ab:	0f b6 c1             	movzbl %cl,%eax
+  8009ae:	0f b6 db             	movzbl %bl,%ebx
+  8009b1:	29 d8                	sub    %ebx,%eax
+  8009b3:	eb 05                	jmp    8009ba <memcmp+0x35>
+	}
+
+	return 0;
+  8009b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009ba:	5b                   	pop    %ebx
+  8009bb:	5e                   	pop    %esi
+  8009bc:	5d                   	pop    %ebp
+  8009bd:	c3                   	ret
+
+008009be <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009be:	55                   	push   %ebp
+  8009bf:	89 e5                	mov    %esp,%ebp
+  8009c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009c7:	89 c2                	mov    %eax,%edx
+  8009c9:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009cc:	eb 03                	jmp    8009d1 <memfind+0x13>
+  8009ce:	83 c0 01             	add    $0x1,%eax
+  8009d1:	39 d0                	cmp    %edx,%eax
+  8009d3:	73 04                	jae    8009d9 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009d5:	38 08                	cmp    %cl,(%eax)
+  8009d7:	75 f5                	jne    8009ce <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009d9:	5d                   	pop    %ebp
+  8009da:	c3                   	ret
+
+008009db <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	57                   	push   %edi
+  8009df:	56                   	push   %esi
+  8009e0:	53                   	push   %ebx
+  8009e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009e7:	eb 03                	jmp    8009ec <strtol+0x11>
+		s++;
+  8009e9:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009ec:	0f b6 02             	movzbl (%edx),%eax
+  8009ef:	3c 20                	cmp    $0x20,%al
+  8009f1:	74 f6                	je     8009e9 <strtol+0xe>
+  8009f3:	3c 09                	cmp    $0x9,%al
+  8009f5:	74 f2                	je     8009e9 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009f7:	3c 2b                	cmp    $0x2b,%al
+  8009f9:	74 2a                	je     800a25 <strtol+0x4a>
+	int neg = 0;
+  8009fb:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a00:	3c 2d                	cmp    $0x2d,%al
+  800a02:	74 2b                	je     800a2f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a04:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a0a:	75 0f                	jne    800a1b <strtol+0x40>
+  800a0c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a0f:	74 28                	je     800a39 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a11:	85 db                	test   %ebx,%ebx
+  800a13:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a18:	0f 44 d8             	cmove  %eax,%ebx
+  800a1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a20:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a23:	eb 46                	jmp    800a6b <strtol+0x90>
+		s++;
+  800a25:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a28:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a2d:	eb d5                	jmp    800a04 <strtol+0x29>
+		s++, neg = 1;
+  800a2f:	83 c2 01             	add    $0x1,%edx
+  800a32:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a37:	eb cb                	jmp    800a04 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a39:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a3d:	74 0e                	je     800a4d <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a3f:	85 db                	test   %ebx,%ebx
+  800a41:	75 d8                	jne    800a1b <strtol+0x40>
+		s++, base = 8;
+  800a43:	83 c2 01             	add    $0x1,%edx
+  800a46:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a4b:	eb ce                	jmp    800a1b <strtol+0x40>
+		s += 2, base = 16;
+  800a4d:	83 c2 02             	add    $0x2,%edx
+  800a50:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a55:	eb c4                	jmp    800a1b <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a57:	0f be c0             	movsbl %al,%eax
+  800a5a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a5d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a60:	7d 3a                	jge    800a9c <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a62:	83 c2 01             	add    $0x1,%edx
+  800a65:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a69:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a6b:	0f b6 02             	movzbl (%edx),%eax
+  800a6e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a71:	89 f3                	mov    %esi,%ebx
+  800a73:	80 fb 09             	cmp    $0x9,%bl
+  800a76:	76 df                	jbe    800a57 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a78:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a7b:	89 f3                	mov    %esi,%ebx
+  800a7d:	80 fb 19             	cmp    $0x19,%bl
+  800a80:	77 08                	ja     800a8a <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a82:	0f be c0             	movsbl %al,%eax
+  800a85:	83 e8 57             	sub    $0x57,%eax
+  800a88:	eb d3                	jmp    800a5d <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a8a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a8d:	89 f3                	mov    %esi,%ebx
+  800a8f:	80 fb 19             	cmp    $0x19,%bl
+  800a92:	77 08                	ja     800a9c <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a94:	0f be c0             	movsbl %al,%eax
+  800a97:	83 e8 37             	sub    $0x37,%eax
+  800a9a:	eb c1                	jmp    800a5d <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a9c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800aa0:	74 05                	je     800aa7 <strtol+0xcc>
+		*endptr = (char *) s;
+  800aa2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aa5:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800aa7:	89 c8                	mov    %ecx,%eax
+  800aa9:	f7 d8                	neg    %eax
+  800aab:	85 ff                	test   %edi,%edi
+  800aad:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ab0:	89 c8                	mov    %ecx,%eax
+  800ab2:	5b                   	pop    %ebx
+  800ab3:	5e                   	pop    %esi
+  800ab4:	5f                   	pop    %edi
+  800ab5:	5d                   	pop    %ebp
+  800ab6:	c3                   	ret
+
+00800ab7 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ab7:	55                   	push   %ebp
+  800ab8:	89 e5                	mov    %esp,%ebp
+  800aba:	57                   	push   %edi
+  800abb:	56                   	push   %esi
+  800abc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ac5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ac8:	89 c3                	mov    %eax,%ebx
+  800aca:	89 c7                	mov    %eax,%edi
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	8d 35 d7 0a 80 00    	lea    0x800ad7,%esi
+  800ad5:	0f 34                	sysenter
+  800ad7:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800ad8:	5b                   	pop    %ebx
+  800ad9:	5e                   	pop    %esi
+  800ada:	5f                   	pop    %edi
+  800adb:	5d                   	pop    %ebp
+  800adc:	c3                   	ret
+
+00800add <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800add:	55                   	push   %ebp
+  800ade:	89 e5                	mov    %esp,%ebp
+  800ae0:	57                   	push   %edi
+  800ae1:	56                   	push   %esi
+  800ae2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ae3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ae8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800aed:	89 d1                	mov    %edx,%ecx
+  800aef:	89 d3                	mov    %edx,%ebx
+  800af1:	89 d7                	mov    %edx,%edi
+  800af3:	55                   	push   %ebp
+  800af4:	89 e5                	mov    %esp,%ebp
+  800af6:	8d 35 fe 0a 80 00    	lea    0x800afe,%esi
+  800afc:	0f 34                	sysenter
+  800afe:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800aff:	5b                   	pop    %ebx
+  800b00:	5e                   	pop    %esi
+  800b01:	5f                   	pop    %edi
+  800b02:	5d                   	pop    %ebp
+  800b03:	c3                   	ret
+
+00800b04 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b04:	55                   	push   %ebp
+  800b05:	89 e5                	mov    %esp,%ebp
+  800b07:	57                   	push   %edi
+  800b08:	56                   	push   %esi
+  800b09:	53                   	push   %ebx
+  800b0a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b15:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b1a:	89 cb                	mov    %ecx,%ebx
+  800b1c:	89 cf                	mov    %ecx,%edi
+  800b1e:	55                   	push   %ebp
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	8d 35 29 0b 80 00    	lea    0x800b29,%esi
+  800b27:	0f 34                	sysenter
+  800b29:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b2a:	85 c0                	test   %eax,%eax
+  800b2c:	7f 08                	jg     800b36 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800b2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b31:	5b                   	pop    %ebx
+  800b32:	5e                   	pop    %esi
+  800b33:	5f                   	pop    %edi
+  800b34:	5d                   	pop    %ebp
+  800b35:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b36:	83 ec 0c             	sub    $0xc,%esp
+  800b39:	50                   	push   %eax
+  800b3a:	6a 03                	push   $0x3
+  800b3c:	68 07 3b 80 00       	push   $0x803b07
+  800b41:	6a 3d                	push   $0x3d
+  800b43:	68 24 3b 80 00       	push   $0x803b24
+  800b48:	e8 e5 25 00 00       	call   803132 <_panic>
+
+00800b4d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b4d:	55                   	push   %ebp
+  800b4e:	89 e5                	mov    %esp,%ebp
+  800b50:	57                   	push   %edi
+  800b51:	56                   	push   %esi
+  800b52:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b58:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b5d:	89 d1                	mov    %edx,%ecx
+  800b5f:	89 d3                	mov    %edx,%ebx
+  800b61:	89 d7                	mov    %edx,%edi
+  800b63:	55                   	push   %ebp
+  800b64:	89 e5                	mov    %esp,%ebp
+  800b66:	8d 35 6e 0b 80 00    	lea    0x800b6e,%esi
+  800b6c:	0f 34                	sysenter
+  800b6e:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800b6f:	5b                   	pop    %ebx
+  800b70:	5e                   	pop    %esi
+  800b71:	5f                   	pop    %edi
+  800b72:	5d                   	pop    %ebp
+  800b73:	c3                   	ret
+
+00800b74 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b74:	55                   	push   %ebp
+  800b75:	89 e5                	mov    %esp,%ebp
+  800b77:	57                   	push   %edi
+  800b78:	56                   	push   %esi
+  800b79:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b7f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b84:	89 d1                	mov    %edx,%ecx
+  800b86:	89 d3                	mov    %edx,%ebx
+  800b88:	89 d7                	mov    %edx,%edi
+  800b8a:	89 d6                	mov    %edx,%esi
+  800b8c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b8e:	5b                   	pop    %ebx
+  800b8f:	5e                   	pop    %esi
+  800b90:	5f                   	pop    %edi
+  800b91:	5d                   	pop    %ebp
+  800b92:	c3                   	ret
+
+00800b93 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800b93:	55                   	push   %ebp
+  800b94:	89 e5                	mov    %esp,%ebp
+  800b96:	57                   	push   %edi
+  800b97:	56                   	push   %esi
+  800b98:	53                   	push   %ebx
+  800b99:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ba7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800baf:	55                   	push   %ebp
+  800bb0:	89 e5                	mov    %esp,%ebp
+  800bb2:	8d 35 ba 0b 80 00    	lea    0x800bba,%esi
+  800bb8:	0f 34                	sysenter
+  800bba:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bbb:	85 c0                	test   %eax,%eax
+  800bbd:	7f 08                	jg     800bc7 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800bbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc2:	5b                   	pop    %ebx
+  800bc3:	5e                   	pop    %esi
+  800bc4:	5f                   	pop    %edi
+  800bc5:	5d                   	pop    %ebp
+  800bc6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bc7:	83 ec 0c             	sub    $0xc,%esp
+  800bca:	50                   	push   %eax
+  800bcb:	6a 04                	push   $0x4
+  800bcd:	68 07 3b 80 00       	push   $0x803b07
+  800bd2:	6a 3d                	push   $0x3d
+  800bd4:	68 24 3b 80 00       	push   $0x803b24
+  800bd9:	e8 54 25 00 00       	call   803132 <_panic>
+
+00800bde <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800bde:	55                   	push   %ebp
+  800bdf:	89 e5                	mov    %esp,%ebp
+  800be1:	57                   	push   %edi
+  800be2:	56                   	push   %esi
+  800be3:	53                   	push   %ebx
+  800be4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800be7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bed:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bf2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bf5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bf8:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bfb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bfd:	85 c0                	test   %eax,%eax
+  800bff:	7f 08                	jg     800c09 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c04:	5b                   	pop    %ebx
+  800c05:	5e                   	pop    %esi
+  800c06:	5f                   	pop    %edi
+  800c07:	5d                   	pop    %ebp
+  800c08:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c09:	83 ec 0c             	sub    $0xc,%esp
+  800c0c:	50                   	push   %eax
+  800c0d:	6a 05                	push   $0x5
+  800c0f:	68 07 3b 80 00       	push   $0x803b07
+  800c14:	6a 23                	push   $0x23
+  800c16:	68 24 3b 80 00       	push   $0x803b24
+  800c1b:	e8 12 25 00 00       	call   803132 <_panic>
+
+00800c20 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c20:	55                   	push   %ebp
+  800c21:	89 e5                	mov    %esp,%ebp
+  800c23:	57                   	push   %edi
+  800c24:	56                   	push   %esi
+  800c25:	53                   	push   %ebx
+  800c26:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c34:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c39:	89 df                	mov    %ebx,%edi
+  800c3b:	55                   	push   %ebp
+  800c3c:	89 e5                	mov    %esp,%ebp
+  800c3e:	8d 35 46 0c 80 00    	lea    0x800c46,%esi
+  800c44:	0f 34                	sysenter
+  800c46:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c47:	85 c0                	test   %eax,%eax
+  800c49:	7f 08                	jg     800c53 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800c4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c4e:	5b                   	pop    %ebx
+  800c4f:	5e                   	pop    %esi
+  800c50:	5f                   	pop    %edi
+  800c51:	5d                   	pop    %ebp
+  800c52:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c53:	83 ec 0c             	sub    $0xc,%esp
+  800c56:	50                   	push   %eax
+  800c57:	6a 06                	push   $0x6
+  800c59:	68 07 3b 80 00       	push   $0x803b07
+  800c5e:	6a 3d                	push   $0x3d
+  800c60:	68 24 3b 80 00       	push   $0x803b24
+  800c65:	e8 c8 24 00 00       	call   803132 <_panic>
+
+00800c6a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800c6a:	55                   	push   %ebp
+  800c6b:	89 e5                	mov    %esp,%ebp
+  800c6d:	57                   	push   %edi
+  800c6e:	56                   	push   %esi
+  800c6f:	53                   	push   %ebx
+  800c70:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c83:	89 df                	mov    %ebx,%edi
+  800c85:	55                   	push   %ebp
+  800c86:	89 e5                	mov    %esp,%ebp
+  800c88:	8d 35 90 0c 80 00    	lea    0x800c90,%esi
+  800c8e:	0f 34                	sysenter
+  800c90:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c91:	85 c0                	test   %eax,%eax
+  800c93:	7f 08                	jg     800c9d <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800c95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c98:	5b                   	pop    %ebx
+  800c99:	5e                   	pop    %esi
+  800c9a:	5f                   	pop    %edi
+  800c9b:	5d                   	pop    %ebp
+  800c9c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c9d:	83 ec 0c             	sub    $0xc,%esp
+  800ca0:	50                   	push   %eax
+  800ca1:	6a 08                	push   $0x8
+  800ca3:	68 07 3b 80 00       	push   $0x803b07
+  800ca8:	6a 3d                	push   $0x3d
+  800caa:	68 24 3b 80 00       	push   $0x803b24
+  800caf:	e8 7e 24 00 00       	call   803132 <_panic>
+
+00800cb4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800cb4:	55                   	push   %ebp
+  800cb5:	89 e5                	mov    %esp,%ebp
+  800cb7:	57                   	push   %edi
+  800cb8:	56                   	push   %esi
+  800cb9:	53                   	push   %ebx
+  800cba:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc8:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ccd:	89 df                	mov    %ebx,%edi
+  800ccf:	55                   	push   %ebp
+  800cd0:	89 e5                	mov    %esp,%ebp
+  800cd2:	8d 35 da 0c 80 00    	lea    0x800cda,%esi
+  800cd8:	0f 34                	sysenter
+  800cda:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cdb:	85 c0                	test   %eax,%eax
+  800cdd:	7f 08                	jg     800ce7 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800cdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce2:	5b                   	pop    %ebx
+  800ce3:	5e                   	pop    %esi
+  800ce4:	5f                   	pop    %edi
+  800ce5:	5d                   	pop    %ebp
+  800ce6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce7:	83 ec 0c             	sub    $0xc,%esp
+  800cea:	50                   	push   %eax
+  800ceb:	6a 09                	push   $0x9
+  800ced:	68 07 3b 80 00       	push   $0x803b07
+  800cf2:	6a 3d                	push   $0x3d
+  800cf4:	68 24 3b 80 00       	push   $0x803b24
+  800cf9:	e8 34 24 00 00       	call   803132 <_panic>
+
+00800cfe <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800cfe:	55                   	push   %ebp
+  800cff:	89 e5                	mov    %esp,%ebp
+  800d01:	57                   	push   %edi
+  800d02:	56                   	push   %esi
+  800d03:	53                   	push   %ebx
+  800d04:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d12:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d17:	89 df                	mov    %ebx,%edi
+  800d19:	55                   	push   %ebp
+  800d1a:	89 e5                	mov    %esp,%ebp
+  800d1c:	8d 35 24 0d 80 00    	lea    0x800d24,%esi
+  800d22:	0f 34                	sysenter
+  800d24:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d25:	85 c0                	test   %eax,%eax
+  800d27:	7f 08                	jg     800d31 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800d29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d2c:	5b                   	pop    %ebx
+  800d2d:	5e                   	pop    %esi
+  800d2e:	5f                   	pop    %edi
+  800d2f:	5d                   	pop    %ebp
+  800d30:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d31:	83 ec 0c             	sub    $0xc,%esp
+  800d34:	50                   	push   %eax
+  800d35:	6a 0a                	push   $0xa
+  800d37:	68 07 3b 80 00       	push   $0x803b07
+  800d3c:	6a 3d                	push   $0x3d
+  800d3e:	68 24 3b 80 00       	push   $0x803b24
+  800d43:	e8 ea 23 00 00       	call   803132 <_panic>
+
+00800d48 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800d48:	55                   	push   %ebp
+  800d49:	89 e5                	mov    %esp,%ebp
+  800d4b:	57                   	push   %edi
+  800d4c:	56                   	push   %esi
+  800d4d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d54:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d5c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d5f:	55                   	push   %ebp
+  800d60:	89 e5                	mov    %esp,%ebp
+  800d62:	8d 35 6a 0d 80 00    	lea    0x800d6a,%esi
+  800d68:	0f 34                	sysenter
+  800d6a:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800d6b:	5b                   	pop    %ebx
+  800d6c:	5e                   	pop    %esi
+  800d6d:	5f                   	pop    %edi
+  800d6e:	5d                   	pop    %ebp
+  800d6f:	c3                   	ret
+
+00800d70 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800d70:	55                   	push   %ebp
+  800d71:	89 e5                	mov    %esp,%ebp
+  800d73:	57                   	push   %edi
+  800d74:	56                   	push   %esi
+  800d75:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7c:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d84:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	8d 35 92 0d 80 00    	lea    0x800d92,%esi
+  800d90:	0f 34                	sysenter
+  800d92:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800d93:	5b                   	pop    %ebx
+  800d94:	5e                   	pop    %esi
+  800d95:	5f                   	pop    %edi
+  800d96:	5d                   	pop    %ebp
+  800d97:	c3                   	ret
+
+00800d98 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800d98:	55                   	push   %ebp
+  800d99:	89 e5                	mov    %esp,%ebp
+  800d9b:	57                   	push   %edi
+  800d9c:	56                   	push   %esi
+  800d9d:	53                   	push   %ebx
+  800d9e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800da1:	be 00 00 00 00       	mov    $0x0,%esi
+  800da6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dac:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800db1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db4:	89 f7                	mov    %esi,%edi
+  800db6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800db8:	85 c0                	test   %eax,%eax
+  800dba:	7f 08                	jg     800dc4 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800dbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dbf:	5b                   	pop    %ebx
+  800dc0:	5e                   	pop    %esi
+  800dc1:	5f                   	pop    %edi
+  800dc2:	5d                   	pop    %ebp
+  800dc3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dc4:	83 ec 0c             	sub    $0xc,%esp
+  800dc7:	50                   	push   %eax
+  800dc8:	6a 0d                	push   $0xd
+  800dca:	68 07 3b 80 00       	push   $0x803b07
+  800dcf:	6a 23                	push   $0x23
+  800dd1:	68 24 3b 80 00       	push   $0x803b24
+  800dd6:	e8 57 23 00 00       	call   803132 <_panic>
+
+00800ddb <sys_ipc_recv>:
+{
+  800ddb:	55                   	push   %ebp
+  800ddc:	89 e5                	mov    %esp,%ebp
+  800dde:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800de1:	6a 00                	push   $0x0
+  800de3:	6a 01                	push   $0x1
+  800de5:	ff 75 08             	push   0x8(%ebp)
+  800de8:	e8 ab ff ff ff       	call   800d98 <sys_ipc_recvv>
+}
+  800ded:	c9                   	leave
+  800dee:	c3                   	ret
+
+00800def <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800def:	55                   	push   %ebp
+  800df0:	89 e5                	mov    %esp,%ebp
+  800df2:	57                   	push   %edi
+  800df3:	56                   	push   %esi
+  800df4:	53                   	push   %ebx
+  800df5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800df8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e03:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e08:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e0b:	89 de                	mov    %ebx,%esi
+  800e0d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e0f:	85 c0                	test   %eax,%eax
+  800e11:	7f 08                	jg     800e1b <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800e13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e16:	5b                   	pop    %ebx
+  800e17:	5e                   	pop    %esi
+  800e18:	5f                   	pop    %edi
+  800e19:	5d                   	pop    %ebp
+  800e1a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e1b:	83 ec 0c             	sub    $0xc,%esp
+  800e1e:	50                   	push   %eax
+  800e1f:	6a 0d                	push   $0xd
+  800e21:	68 07 3b 80 00       	push   $0x803b07
+  800e26:	6a 23                	push   $0x23
+  800e28:	68 24 3b 80 00       	push   $0x803b24
+  800e2d:	e8 00 23 00 00       	call   803132 <_panic>
+
+00800e32 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e32:	55                   	push   %ebp
+  800e33:	89 e5                	mov    %esp,%ebp
+  800e35:	57                   	push   %edi
+  800e36:	56                   	push   %esi
+  800e37:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e38:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e42:	89 d1                	mov    %edx,%ecx
+  800e44:	89 d3                	mov    %edx,%ebx
+  800e46:	89 d7                	mov    %edx,%edi
+  800e48:	55                   	push   %ebp
+  800e49:	89 e5                	mov    %esp,%ebp
+  800e4b:	8d 35 53 0e 80 00    	lea    0x800e53,%esi
+  800e51:	0f 34                	sysenter
+  800e53:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800e54:	5b                   	pop    %ebx
+  800e55:	5e                   	pop    %esi
+  800e56:	5f                   	pop    %edi
+  800e57:	5d                   	pop    %ebp
+  800e58:	c3                   	ret
+
+00800e59 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800e59:	55                   	push   %ebp
+  800e5a:	89 e5                	mov    %esp,%ebp
+  800e5c:	57                   	push   %edi
+  800e5d:	56                   	push   %esi
+  800e5e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e6f:	89 df                	mov    %ebx,%edi
+  800e71:	55                   	push   %ebp
+  800e72:	89 e5                	mov    %esp,%ebp
+  800e74:	8d 35 7c 0e 80 00    	lea    0x800e7c,%esi
+  800e7a:	0f 34                	sysenter
+  800e7c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800e7d:	5b                   	pop    %ebx
+  800e7e:	5e                   	pop    %esi
+  800e7f:	5f                   	pop    %edi
+  800e80:	5d                   	pop    %ebp
+  800e81:	c3                   	ret
+
+00800e82 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	57                   	push   %edi
+  800e86:	56                   	push   %esi
+  800e87:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e90:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e95:	89 cb                	mov    %ecx,%ebx
+  800e97:	89 cf                	mov    %ecx,%edi
+  800e99:	55                   	push   %ebp
+  800e9a:	89 e5                	mov    %esp,%ebp
+  800e9c:	8d 35 a4 0e 80 00    	lea    0x800ea4,%esi
+  800ea2:	0f 34                	sysenter
+  800ea4:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800ea5:	5b                   	pop    %ebx
+  800ea6:	5e                   	pop    %esi
+  800ea7:	5f                   	pop    %edi
+  800ea8:	5d                   	pop    %ebp
+  800ea9:	c3                   	ret
+
+00800eaa <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800eaa:	55                   	push   %ebp
+  800eab:	89 e5                	mov    %esp,%ebp
+  800ead:	57                   	push   %edi
+  800eae:	56                   	push   %esi
+  800eaf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebb:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ec0:	89 df                	mov    %ebx,%edi
+  800ec2:	55                   	push   %ebp
+  800ec3:	89 e5                	mov    %esp,%ebp
+  800ec5:	8d 35 cd 0e 80 00    	lea    0x800ecd,%esi
+  800ecb:	0f 34                	sysenter
+  800ecd:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800ece:	5b                   	pop    %ebx
+  800ecf:	5e                   	pop    %esi
+  800ed0:	5f                   	pop    %edi
+  800ed1:	5d                   	pop    %ebp
+  800ed2:	c3                   	ret
+
+00800ed3 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800ed3:	55                   	push   %ebp
+  800ed4:	89 e5                	mov    %esp,%ebp
+  800ed6:	57                   	push   %edi
+  800ed7:	56                   	push   %esi
+  800ed8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ed9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ede:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee4:	b8 14 00 00 00       	mov    $0x14,%eax
+  800ee9:	89 df                	mov    %ebx,%edi
+  800eeb:	55                   	push   %ebp
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	8d 35 f6 0e 80 00    	lea    0x800ef6,%esi
+  800ef4:	0f 34                	sysenter
+  800ef6:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+
+00800efc <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800efc:	55                   	push   %ebp
+  800efd:	89 e5                	mov    %esp,%ebp
+  800eff:	57                   	push   %edi
+  800f00:	56                   	push   %esi
+  800f01:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f08:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f10:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	8d 35 1e 0f 80 00    	lea    0x800f1e,%esi
+  800f1c:	0f 34                	sysenter
+  800f1e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800f1f:	5b                   	pop    %ebx
+  800f20:	5e                   	pop    %esi
+  800f21:	5f                   	pop    %edi
+  800f22:	5d                   	pop    %ebp
+  800f23:	c3                   	ret
+
+00800f24 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800f24:	55                   	push   %ebp
+  800f25:	89 e5                	mov    %esp,%ebp
+  800f27:	57                   	push   %edi
+  800f28:	56                   	push   %esi
+  800f29:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f32:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f37:	89 cb                	mov    %ecx,%ebx
+  800f39:	89 cf                	mov    %ecx,%edi
+  800f3b:	89 ce                	mov    %ecx,%esi
+  800f3d:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800f3f:	5b                   	pop    %ebx
+  800f40:	5e                   	pop    %esi
+  800f41:	5f                   	pop    %edi
+  800f42:	5d                   	pop    %ebp
+  800f43:	c3                   	ret
+
+00800f44 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	57                   	push   %edi
+  800f48:	56                   	push   %esi
+  800f49:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f52:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f57:	89 cb                	mov    %ecx,%ebx
+  800f59:	89 cf                	mov    %ecx,%edi
+  800f5b:	55                   	push   %ebp
+  800f5c:	89 e5                	mov    %esp,%ebp
+  800f5e:	8d 35 66 0f 80 00    	lea    0x800f66,%esi
+  800f64:	0f 34                	sysenter
+  800f66:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800f67:	5b                   	pop    %ebx
+  800f68:	5e                   	pop    %esi
+  800f69:	5f                   	pop    %edi
+  800f6a:	5d                   	pop    %ebp
+  800f6b:	c3                   	ret
+
+00800f6c <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800f6c:	55                   	push   %ebp
+  800f6d:	89 e5                	mov    %esp,%ebp
+  800f6f:	57                   	push   %edi
+  800f70:	56                   	push   %esi
+  800f71:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7a:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f7f:	89 cb                	mov    %ecx,%ebx
+  800f81:	89 cf                	mov    %ecx,%edi
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	8d 35 8e 0f 80 00    	lea    0x800f8e,%esi
+  800f8c:	0f 34                	sysenter
+  800f8e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800f8f:	5b                   	pop    %ebx
+  800f90:	5e                   	pop    %esi
+  800f91:	5f                   	pop    %edi
+  800f92:	5d                   	pop    %ebp
+  800f93:	c3                   	ret
+
+00800f94 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  800f94:	55                   	push   %ebp
+  800f95:	89 e5                	mov    %esp,%ebp
+  800f97:	56                   	push   %esi
+  800f98:	53                   	push   %ebx
+  800f99:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  800fa2:	85 c0                	test   %eax,%eax
+  800fa4:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  800fa9:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  800fac:	83 ec 0c             	sub    $0xc,%esp
+  800faf:	50                   	push   %eax
+  800fb0:	e8 26 fe ff ff       	call   800ddb <sys_ipc_recv>
+	if (from_env_store)
+  800fb5:	83 c4 10             	add    $0x10,%esp
+  800fb8:	85 f6                	test   %esi,%esi
+  800fba:	74 14                	je     800fd0 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  800fbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc1:	85 c0                	test   %eax,%eax
+  800fc3:	75 09                	jne    800fce <ipc_recv+0x3a>
+  800fc5:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  800fcb:	8b 52 74             	mov    0x74(%edx),%edx
+  800fce:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  800fd0:	85 db                	test   %ebx,%ebx
+  800fd2:	74 25                	je     800ff9 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  800fd4:	85 c0                	test   %eax,%eax
+  800fd6:	74 0d                	je     800fe5 <ipc_recv+0x51>
+  800fd8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  800fde:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fe1:	5b                   	pop    %ebx
+  800fe2:	5e                   	pop    %esi
+  800fe3:	5d                   	pop    %ebp
+  800fe4:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  800fe5:	a1 00 50 80 00       	mov    0x805000,%eax
+  800fea:	8b 40 78             	mov    0x78(%eax),%eax
+  800fed:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  800fef:	a1 00 50 80 00       	mov    0x805000,%eax
+  800ff4:	8b 40 70             	mov    0x70(%eax),%eax
+  800ff7:	eb e5                	jmp    800fde <ipc_recv+0x4a>
+  800ff9:	85 c0                	test   %eax,%eax
+  800ffb:	75 e1                	jne    800fde <ipc_recv+0x4a>
+  800ffd:	eb f0                	jmp    800fef <ipc_recv+0x5b>
+
+00800fff <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  800fff:	55                   	push   %ebp
+  801000:	89 e5                	mov    %esp,%ebp
+  801002:	57                   	push   %edi
+  801003:	56                   	push   %esi
+  801004:	53                   	push   %ebx
+  801005:	83 ec 0c             	sub    $0xc,%esp
+  801008:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80100b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80100e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801011:	85 db                	test   %ebx,%ebx
+  801013:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801018:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80101b:	ff 75 14             	push   0x14(%ebp)
+  80101e:	53                   	push   %ebx
+  80101f:	56                   	push   %esi
+  801020:	57                   	push   %edi
+  801021:	e8 22 fd ff ff       	call   800d48 <sys_ipc_try_send>
+  801026:	83 c4 10             	add    $0x10,%esp
+  801029:	85 c0                	test   %eax,%eax
+  80102b:	74 22                	je     80104f <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  80102d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801030:	75 07                	jne    801039 <ipc_send+0x3a>
+		sys_yield();
+  801032:	e8 3d fb ff ff       	call   800b74 <sys_yield>
+  801037:	eb e2                	jmp    80101b <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  801039:	68 32 3b 80 00       	push   $0x803b32
+  80103e:	68 47 3b 80 00       	push   $0x803b47
+  801043:	6a 39                	push   $0x39
+  801045:	68 5c 3b 80 00       	push   $0x803b5c
+  80104a:	e8 e3 20 00 00       	call   803132 <_panic>
+	}
+}
+  80104f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801052:	5b                   	pop    %ebx
+  801053:	5e                   	pop    %esi
+  801054:	5f                   	pop    %edi
+  801055:	5d                   	pop    %ebp
+  801056:	c3                   	ret
+
+00801057 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  801057:	55                   	push   %ebp
+  801058:	89 e5                	mov    %esp,%ebp
+  80105a:	57                   	push   %edi
+  80105b:	56                   	push   %esi
+  80105c:	53                   	push   %ebx
+  80105d:	83 ec 10             	sub    $0x10,%esp
+  801060:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801063:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801066:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801069:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80106c:	85 c0                	test   %eax,%eax
+  80106e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801073:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  801076:	6a 00                	push   $0x0
+  801078:	ff 33                	push   (%ebx)
+  80107a:	50                   	push   %eax
+  80107b:	e8 18 fd ff ff       	call   800d98 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  801080:	83 c4 10             	add    $0x10,%esp
+  801083:	85 c0                	test   %eax,%eax
+  801085:	75 3c                	jne    8010c3 <ipc_recvv+0x6c>
+  801087:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80108d:	8b 52 7c             	mov    0x7c(%edx),%edx
+  801090:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  801092:	85 ff                	test   %edi,%edi
+  801094:	74 4e                	je     8010e4 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801096:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80109c:	8b 52 74             	mov    0x74(%edx),%edx
+  80109f:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8010a1:	85 f6                	test   %esi,%esi
+  8010a3:	74 18                	je     8010bd <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8010a5:	85 c0                	test   %eax,%eax
+  8010a7:	75 2d                	jne    8010d6 <ipc_recvv+0x7f>
+  8010a9:	a1 00 50 80 00       	mov    0x805000,%eax
+  8010ae:	8b 40 78             	mov    0x78(%eax),%eax
+  8010b1:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8010b3:	a1 00 50 80 00       	mov    0x805000,%eax
+  8010b8:	8b 40 70             	mov    0x70(%eax),%eax
+  8010bb:	eb 1f                	jmp    8010dc <ipc_recvv+0x85>
+  8010bd:	85 c0                	test   %eax,%eax
+  8010bf:	75 1b                	jne    8010dc <ipc_recvv+0x85>
+  8010c1:	eb f0                	jmp    8010b3 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8010c3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8010c9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8010ce:	85 ff                	test   %edi,%edi
+  8010d0:	75 cd                	jne    80109f <ipc_recvv+0x48>
+	if (perm_store)
+  8010d2:	85 f6                	test   %esi,%esi
+  8010d4:	74 e7                	je     8010bd <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8010d6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8010dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010df:	5b                   	pop    %ebx
+  8010e0:	5e                   	pop    %esi
+  8010e1:	5f                   	pop    %edi
+  8010e2:	5d                   	pop    %ebp
+  8010e3:	c3                   	ret
+	if (perm_store)
+  8010e4:	85 f6                	test   %esi,%esi
+  8010e6:	75 bd                	jne    8010a5 <ipc_recvv+0x4e>
+  8010e8:	eb c9                	jmp    8010b3 <ipc_recvv+0x5c>
+
+008010ea <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8010ea:	55                   	push   %ebp
+  8010eb:	89 e5                	mov    %esp,%ebp
+  8010ed:	57                   	push   %edi
+  8010ee:	56                   	push   %esi
+  8010ef:	53                   	push   %ebx
+  8010f0:	83 ec 0c             	sub    $0xc,%esp
+  8010f3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8010f6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8010fc:	ff 75 14             	push   0x14(%ebp)
+  8010ff:	53                   	push   %ebx
+  801100:	56                   	push   %esi
+  801101:	57                   	push   %edi
+  801102:	e8 69 fc ff ff       	call   800d70 <sys_ipc_try_sendv>
+  801107:	83 c4 10             	add    $0x10,%esp
+  80110a:	85 c0                	test   %eax,%eax
+  80110c:	74 22                	je     801130 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  80110e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801111:	75 07                	jne    80111a <ipc_sendv+0x30>
+		sys_yield();
+  801113:	e8 5c fa ff ff       	call   800b74 <sys_yield>
+  801118:	eb e2                	jmp    8010fc <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80111a:	68 32 3b 80 00       	push   $0x803b32
+  80111f:	68 47 3b 80 00       	push   $0x803b47
+  801124:	6a 5c                	push   $0x5c
+  801126:	68 5c 3b 80 00       	push   $0x803b5c
+  80112b:	e8 02 20 00 00       	call   803132 <_panic>
+	}
+}
+  801130:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801133:	5b                   	pop    %ebx
+  801134:	5e                   	pop    %esi
+  801135:	5f                   	pop    %edi
+  801136:	5d                   	pop    %ebp
+  801137:	c3                   	ret
+
+00801138 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801138:	55                   	push   %ebp
+  801139:	89 e5                	mov    %esp,%ebp
+  80113b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80113e:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801143:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  801149:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80114f:	8b 52 50             	mov    0x50(%edx),%edx
+  801152:	39 ca                	cmp    %ecx,%edx
+  801154:	74 11                	je     801167 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801156:	83 c0 01             	add    $0x1,%eax
+  801159:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80115e:	75 e3                	jne    801143 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801160:	b8 00 00 00 00       	mov    $0x0,%eax
+  801165:	eb 0e                	jmp    801175 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801167:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80116d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801172:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801175:	5d                   	pop    %ebp
+  801176:	c3                   	ret
+
+00801177 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801177:	55                   	push   %ebp
+  801178:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80117a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80117d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801182:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801185:	5d                   	pop    %ebp
+  801186:	c3                   	ret
+
+00801187 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801187:	55                   	push   %ebp
+  801188:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80118a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80118d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801192:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801197:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80119c:	5d                   	pop    %ebp
+  80119d:	c3                   	ret
+
+0080119e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80119e:	55                   	push   %ebp
+  80119f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8011a1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8011a6:	eb 02                	jmp    8011aa <fd_alloc+0xc>
+  8011a8:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8011aa:	89 c2                	mov    %eax,%edx
+  8011ac:	c1 ea 16             	shr    $0x16,%edx
+  8011af:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8011b6:	f6 c2 01             	test   $0x1,%dl
+  8011b9:	74 2b                	je     8011e6 <fd_alloc+0x48>
+  8011bb:	89 c2                	mov    %eax,%edx
+  8011bd:	c1 ea 0c             	shr    $0xc,%edx
+  8011c0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8011c7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011cd:	f6 c1 01             	test   $0x1,%cl
+  8011d0:	74 14                	je     8011e6 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8011d2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8011d8:	75 ce                	jne    8011a8 <fd_alloc+0xa>
+  8011da:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8011df:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011e4:	eb 05                	jmp    8011eb <fd_alloc+0x4d>
+			return 0;
+  8011e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8011eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ee:	89 02                	mov    %eax,(%edx)
+}
+  8011f0:	89 c8                	mov    %ecx,%eax
+  8011f2:	5d                   	pop    %ebp
+  8011f3:	c3                   	ret
+
+008011f4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011f4:	55                   	push   %ebp
+  8011f5:	89 e5                	mov    %esp,%ebp
+  8011f7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8011fa:	83 f8 1f             	cmp    $0x1f,%eax
+  8011fd:	77 30                	ja     80122f <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011ff:	c1 e0 0c             	shl    $0xc,%eax
+  801202:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801207:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80120d:	f6 c2 01             	test   $0x1,%dl
+  801210:	74 24                	je     801236 <fd_lookup+0x42>
+  801212:	89 c2                	mov    %eax,%edx
+  801214:	c1 ea 0c             	shr    $0xc,%edx
+  801217:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80121e:	f6 c2 01             	test   $0x1,%dl
+  801221:	74 1a                	je     80123d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801223:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801226:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801228:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80122d:	5d                   	pop    %ebp
+  80122e:	c3                   	ret
+		return -E_INVAL;
+  80122f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801234:	eb f7                	jmp    80122d <fd_lookup+0x39>
+		return -E_INVAL;
+  801236:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80123b:	eb f0                	jmp    80122d <fd_lookup+0x39>
+  80123d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801242:	eb e9                	jmp    80122d <fd_lookup+0x39>
+
+00801244 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801244:	55                   	push   %ebp
+  801245:	89 e5                	mov    %esp,%ebp
+  801247:	53                   	push   %ebx
+  801248:	83 ec 04             	sub    $0x4,%esp
+  80124b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80124e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801253:	eb 03                	jmp    801258 <dev_lookup+0x14>
+  801255:	83 c0 01             	add    $0x1,%eax
+  801258:	8b 1c 85 e4 3b 80 00 	mov    0x803be4(,%eax,4),%ebx
+  80125f:	85 db                	test   %ebx,%ebx
+  801261:	74 0b                	je     80126e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801263:	39 13                	cmp    %edx,(%ebx)
+  801265:	75 ee                	jne    801255 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801267:	b8 00 00 00 00       	mov    $0x0,%eax
+  80126c:	eb 1f                	jmp    80128d <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80126e:	a1 00 50 80 00       	mov    0x805000,%eax
+  801273:	8b 40 48             	mov    0x48(%eax),%eax
+  801276:	83 ec 04             	sub    $0x4,%esp
+  801279:	52                   	push   %edx
+  80127a:	50                   	push   %eax
+  80127b:	68 68 3b 80 00       	push   $0x803b68
+  801280:	e8 14 ef ff ff       	call   800199 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801285:	83 c4 10             	add    $0x10,%esp
+  801288:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80128d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801290:	89 1a                	mov    %ebx,(%edx)
+}
+  801292:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801295:	c9                   	leave
+  801296:	c3                   	ret
+
+00801297 <fd_close>:
+{
+  801297:	55                   	push   %ebp
+  801298:	89 e5                	mov    %esp,%ebp
+  80129a:	57                   	push   %edi
+  80129b:	56                   	push   %esi
+  80129c:	53                   	push   %ebx
+  80129d:	83 ec 24             	sub    $0x24,%esp
+  8012a0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012a3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012a6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012a9:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012aa:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8012b0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012b3:	50                   	push   %eax
+  8012b4:	e8 3b ff ff ff       	call   8011f4 <fd_lookup>
+  8012b9:	89 c3                	mov    %eax,%ebx
+  8012bb:	83 c4 10             	add    $0x10,%esp
+  8012be:	85 c0                	test   %eax,%eax
+  8012c0:	78 05                	js     8012c7 <fd_close+0x30>
+	    || fd != fd2)
+  8012c2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8012c5:	74 16                	je     8012dd <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8012c7:	89 f8                	mov    %edi,%eax
+  8012c9:	84 c0                	test   %al,%al
+  8012cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012d3:	89 d8                	mov    %ebx,%eax
+  8012d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d8:	5b                   	pop    %ebx
+  8012d9:	5e                   	pop    %esi
+  8012da:	5f                   	pop    %edi
+  8012db:	5d                   	pop    %ebp
+  8012dc:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012dd:	83 ec 08             	sub    $0x8,%esp
+  8012e0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012e3:	50                   	push   %eax
+  8012e4:	ff 36                	push   (%esi)
+  8012e6:	e8 59 ff ff ff       	call   801244 <dev_lookup>
+  8012eb:	89 c3                	mov    %eax,%ebx
+  8012ed:	83 c4 10             	add    $0x10,%esp
+  8012f0:	85 c0                	test   %eax,%eax
+  8012f2:	78 1a                	js     80130e <fd_close+0x77>
+		if (dev->dev_close)
+  8012f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012f7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8012fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8012ff:	85 c0                	test   %eax,%eax
+  801301:	74 0b                	je     80130e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801303:	83 ec 0c             	sub    $0xc,%esp
+  801306:	56                   	push   %esi
+  801307:	ff d0                	call   *%eax
+  801309:	89 c3                	mov    %eax,%ebx
+  80130b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80130e:	83 ec 08             	sub    $0x8,%esp
+  801311:	56                   	push   %esi
+  801312:	6a 00                	push   $0x0
+  801314:	e8 07 f9 ff ff       	call   800c20 <sys_page_unmap>
+	return r;
+  801319:	83 c4 10             	add    $0x10,%esp
+  80131c:	eb b5                	jmp    8012d3 <fd_close+0x3c>
+
+0080131e <close>:
+
+int
+close(int fdnum)
+{
+  80131e:	55                   	push   %ebp
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801324:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801327:	50                   	push   %eax
+  801328:	ff 75 08             	push   0x8(%ebp)
+  80132b:	e8 c4 fe ff ff       	call   8011f4 <fd_lookup>
+  801330:	83 c4 10             	add    $0x10,%esp
+  801333:	85 c0                	test   %eax,%eax
+  801335:	79 02                	jns    801339 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801337:	c9                   	leave
+  801338:	c3                   	ret
+		return fd_close(fd, 1);
+  801339:	83 ec 08             	sub    $0x8,%esp
+  80133c:	6a 01                	push   $0x1
+  80133e:	ff 75 f4             	push   -0xc(%ebp)
+  801341:	e8 51 ff ff ff       	call   801297 <fd_close>
+  801346:	83 c4 10             	add    $0x10,%esp
+  801349:	eb ec                	jmp    801337 <close+0x19>
+
+0080134b <close_all>:
+
+void
+close_all(void)
+{
+  80134b:	55                   	push   %ebp
+  80134c:	89 e5                	mov    %esp,%ebp
+  80134e:	53                   	push   %ebx
+  80134f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801352:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801357:	83 ec 0c             	sub    $0xc,%esp
+  80135a:	53                   	push   %ebx
+  80135b:	e8 be ff ff ff       	call   80131e <close>
+	for (i = 0; i < MAXFD; i++)
+  801360:	83 c3 01             	add    $0x1,%ebx
+  801363:	83 c4 10             	add    $0x10,%esp
+  801366:	83 fb 20             	cmp    $0x20,%ebx
+  801369:	75 ec                	jne    801357 <close_all+0xc>
+}
+  80136b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80136e:	c9                   	leave
+  80136f:	c3                   	ret
+
+00801370 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801370:	55                   	push   %ebp
+  801371:	89 e5                	mov    %esp,%ebp
+  801373:	57                   	push   %edi
+  801374:	56                   	push   %esi
+  801375:	53                   	push   %ebx
+  801376:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801379:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80137c:	50                   	push   %eax
+  80137d:	ff 75 08             	push   0x8(%ebp)
+  801380:	e8 6f fe ff ff       	call   8011f4 <fd_lookup>
+  801385:	89 c3                	mov    %eax,%ebx
+  801387:	83 c4 10             	add    $0x10,%esp
+  80138a:	85 c0                	test   %eax,%eax
+  80138c:	78 7f                	js     80140d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80138e:	83 ec 0c             	sub    $0xc,%esp
+  801391:	ff 75 0c             	push   0xc(%ebp)
+  801394:	e8 85 ff ff ff       	call   80131e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801399:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80139c:	c1 e6 0c             	shl    $0xc,%esi
+  80139f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8013a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8013a8:	89 3c 24             	mov    %edi,(%esp)
+  8013ab:	e8 d7 fd ff ff       	call   801187 <fd2data>
+  8013b0:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8013b2:	89 34 24             	mov    %esi,(%esp)
+  8013b5:	e8 cd fd ff ff       	call   801187 <fd2data>
+  8013ba:	83 c4 10             	add    $0x10,%esp
+  8013bd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8013c0:	89 d8                	mov    %ebx,%eax
+  8013c2:	c1 e8 16             	shr    $0x16,%eax
+  8013c5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013cc:	a8 01                	test   $0x1,%al
+  8013ce:	74 11                	je     8013e1 <dup+0x71>
+  8013d0:	89 d8                	mov    %ebx,%eax
+  8013d2:	c1 e8 0c             	shr    $0xc,%eax
+  8013d5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013dc:	f6 c2 01             	test   $0x1,%dl
+  8013df:	75 36                	jne    801417 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013e1:	89 f8                	mov    %edi,%eax
+  8013e3:	c1 e8 0c             	shr    $0xc,%eax
+  8013e6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013ed:	83 ec 0c             	sub    $0xc,%esp
+  8013f0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013f5:	50                   	push   %eax
+  8013f6:	56                   	push   %esi
+  8013f7:	6a 00                	push   $0x0
+  8013f9:	57                   	push   %edi
+  8013fa:	6a 00                	push   $0x0
+  8013fc:	e8 dd f7 ff ff       	call   800bde <sys_page_map>
+  801401:	89 c3                	mov    %eax,%ebx
+  801403:	83 c4 20             	add    $0x20,%esp
+  801406:	85 c0                	test   %eax,%eax
+  801408:	78 33                	js     80143d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80140a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80140d:	89 d8                	mov    %ebx,%eax
+  80140f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801412:	5b                   	pop    %ebx
+  801413:	5e                   	pop    %esi
+  801414:	5f                   	pop    %edi
+  801415:	5d                   	pop    %ebp
+  801416:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801417:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80141e:	83 ec 0c             	sub    $0xc,%esp
+  801421:	25 07 0e 00 00       	and    $0xe07,%eax
+  801426:	50                   	push   %eax
+  801427:	ff 75 d4             	push   -0x2c(%ebp)
+  80142a:	6a 00                	push   $0x0
+  80142c:	53                   	push   %ebx
+  80142d:	6a 00                	push   $0x0
+  80142f:	e8 aa f7 ff ff       	call   800bde <sys_page_map>
+  801434:	89 c3                	mov    %eax,%ebx
+  801436:	83 c4 20             	add    $0x20,%esp
+  801439:	85 c0                	test   %eax,%eax
+  80143b:	79 a4                	jns    8013e1 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80143d:	83 ec 08             	sub    $0x8,%esp
+  801440:	56                   	push   %esi
+  801441:	6a 00                	push   $0x0
+  801443:	e8 d8 f7 ff ff       	call   800c20 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801448:	83 c4 08             	add    $0x8,%esp
+  80144b:	ff 75 d4             	push   -0x2c(%ebp)
+  80144e:	6a 00                	push   $0x0
+  801450:	e8 cb f7 ff ff       	call   800c20 <sys_page_unmap>
+	return r;
+  801455:	83 c4 10             	add    $0x10,%esp
+  801458:	eb b3                	jmp    80140d <dup+0x9d>
+
+0080145a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80145a:	55                   	push   %ebp
+  80145b:	89 e5                	mov    %esp,%ebp
+  80145d:	56                   	push   %esi
+  80145e:	53                   	push   %ebx
+  80145f:	83 ec 18             	sub    $0x18,%esp
+  801462:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801465:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801468:	50                   	push   %eax
+  801469:	56                   	push   %esi
+  80146a:	e8 85 fd ff ff       	call   8011f4 <fd_lookup>
+  80146f:	83 c4 10             	add    $0x10,%esp
+  801472:	85 c0                	test   %eax,%eax
+  801474:	78 3c                	js     8014b2 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801476:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801479:	83 ec 08             	sub    $0x8,%esp
+  80147c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80147f:	50                   	push   %eax
+  801480:	ff 33                	push   (%ebx)
+  801482:	e8 bd fd ff ff       	call   801244 <dev_lookup>
+  801487:	83 c4 10             	add    $0x10,%esp
+  80148a:	85 c0                	test   %eax,%eax
+  80148c:	78 24                	js     8014b2 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80148e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801491:	83 e0 03             	and    $0x3,%eax
+  801494:	83 f8 01             	cmp    $0x1,%eax
+  801497:	74 20                	je     8014b9 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801499:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80149c:	8b 40 08             	mov    0x8(%eax),%eax
+  80149f:	85 c0                	test   %eax,%eax
+  8014a1:	74 37                	je     8014da <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8014a3:	83 ec 04             	sub    $0x4,%esp
+  8014a6:	ff 75 10             	push   0x10(%ebp)
+  8014a9:	ff 75 0c             	push   0xc(%ebp)
+  8014ac:	53                   	push   %ebx
+  8014ad:	ff d0                	call   *%eax
+  8014af:	83 c4 10             	add    $0x10,%esp
+}
+  8014b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014b5:	5b                   	pop    %ebx
+  8014b6:	5e                   	pop    %esi
+  8014b7:	5d                   	pop    %ebp
+  8014b8:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014b9:	a1 00 50 80 00       	mov    0x805000,%eax
+  8014be:	8b 40 48             	mov    0x48(%eax),%eax
+  8014c1:	83 ec 04             	sub    $0x4,%esp
+  8014c4:	56                   	push   %esi
+  8014c5:	50                   	push   %eax
+  8014c6:	68 a9 3b 80 00       	push   $0x803ba9
+  8014cb:	e8 c9 ec ff ff       	call   800199 <cprintf>
+		return -E_INVAL;
+  8014d0:	83 c4 10             	add    $0x10,%esp
+  8014d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014d8:	eb d8                	jmp    8014b2 <read+0x58>
+		return -E_NOT_SUPP;
+  8014da:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014df:	eb d1                	jmp    8014b2 <read+0x58>
+
+008014e1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014e1:	55                   	push   %ebp
+  8014e2:	89 e5                	mov    %esp,%ebp
+  8014e4:	57                   	push   %edi
+  8014e5:	56                   	push   %esi
+  8014e6:	53                   	push   %ebx
+  8014e7:	83 ec 0c             	sub    $0xc,%esp
+  8014ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014ed:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f5:	eb 02                	jmp    8014f9 <readn+0x18>
+  8014f7:	01 c3                	add    %eax,%ebx
+  8014f9:	39 f3                	cmp    %esi,%ebx
+  8014fb:	73 21                	jae    80151e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014fd:	83 ec 04             	sub    $0x4,%esp
+  801500:	89 f0                	mov    %esi,%eax
+  801502:	29 d8                	sub    %ebx,%eax
+  801504:	50                   	push   %eax
+  801505:	89 d8                	mov    %ebx,%eax
+  801507:	03 45 0c             	add    0xc(%ebp),%eax
+  80150a:	50                   	push   %eax
+  80150b:	57                   	push   %edi
+  80150c:	e8 49 ff ff ff       	call   80145a <read>
+		if (m < 0)
+  801511:	83 c4 10             	add    $0x10,%esp
+  801514:	85 c0                	test   %eax,%eax
+  801516:	78 04                	js     80151c <readn+0x3b>
+			return m;
+		if (m == 0)
+  801518:	75 dd                	jne    8014f7 <readn+0x16>
+  80151a:	eb 02                	jmp    80151e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80151c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80151e:	89 d8                	mov    %ebx,%eax
+  801520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801523:	5b                   	pop    %ebx
+  801524:	5e                   	pop    %esi
+  801525:	5f                   	pop    %edi
+  801526:	5d                   	pop    %ebp
+  801527:	c3                   	ret
+
+00801528 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801528:	55                   	push   %ebp
+  801529:	89 e5                	mov    %esp,%ebp
+  80152b:	56                   	push   %esi
+  80152c:	53                   	push   %ebx
+  80152d:	83 ec 18             	sub    $0x18,%esp
+  801530:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801533:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801536:	50                   	push   %eax
+  801537:	53                   	push   %ebx
+  801538:	e8 b7 fc ff ff       	call   8011f4 <fd_lookup>
+  80153d:	83 c4 10             	add    $0x10,%esp
+  801540:	85 c0                	test   %eax,%eax
+  801542:	78 37                	js     80157b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801544:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801547:	83 ec 08             	sub    $0x8,%esp
+  80154a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80154d:	50                   	push   %eax
+  80154e:	ff 36                	push   (%esi)
+  801550:	e8 ef fc ff ff       	call   801244 <dev_lookup>
+  801555:	83 c4 10             	add    $0x10,%esp
+  801558:	85 c0                	test   %eax,%eax
+  80155a:	78 1f                	js     80157b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80155c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801560:	74 20                	je     801582 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801562:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801565:	8b 40 0c             	mov    0xc(%eax),%eax
+  801568:	85 c0                	test   %eax,%eax
+  80156a:	74 37                	je     8015a3 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80156c:	83 ec 04             	sub    $0x4,%esp
+  80156f:	ff 75 10             	push   0x10(%ebp)
+  801572:	ff 75 0c             	push   0xc(%ebp)
+  801575:	56                   	push   %esi
+  801576:	ff d0                	call   *%eax
+  801578:	83 c4 10             	add    $0x10,%esp
+}
+  80157b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80157e:	5b                   	pop    %ebx
+  80157f:	5e                   	pop    %esi
+  801580:	5d                   	pop    %ebp
+  801581:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801582:	a1 00 50 80 00       	mov    0x805000,%eax
+  801587:	8b 40 48             	mov    0x48(%eax),%eax
+  80158a:	83 ec 04             	sub    $0x4,%esp
+  80158d:	53                   	push   %ebx
+  80158e:	50                   	push   %eax
+  80158f:	68 c5 3b 80 00       	push   $0x803bc5
+  801594:	e8 00 ec ff ff       	call   800199 <cprintf>
+		return -E_INVAL;
+  801599:	83 c4 10             	add    $0x10,%esp
+  80159c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015a1:	eb d8                	jmp    80157b <write+0x53>
+		return -E_NOT_SUPP;
+  8015a3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015a8:	eb d1                	jmp    80157b <write+0x53>
+
+008015aa <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015aa:	55                   	push   %ebp
+  8015ab:	89 e5                	mov    %esp,%ebp
+  8015ad:	53                   	push   %ebx
+  8015ae:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015b1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015b4:	50                   	push   %eax
+  8015b5:	ff 75 08             	push   0x8(%ebp)
+  8015b8:	e8 37 fc ff ff       	call   8011f4 <fd_lookup>
+  8015bd:	83 c4 10             	add    $0x10,%esp
+  8015c0:	85 c0                	test   %eax,%eax
+  8015c2:	78 3a                	js     8015fe <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015c4:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8015c7:	83 ec 08             	sub    $0x8,%esp
+  8015ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015cd:	50                   	push   %eax
+  8015ce:	ff 33                	push   (%ebx)
+  8015d0:	e8 6f fc ff ff       	call   801244 <dev_lookup>
+  8015d5:	83 c4 10             	add    $0x10,%esp
+  8015d8:	85 c0                	test   %eax,%eax
+  8015da:	78 22                	js     8015fe <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8015dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015df:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8015e2:	85 c0                	test   %eax,%eax
+  8015e4:	74 0d                	je     8015f3 <seek+0x49>
+  8015e6:	83 ec 0c             	sub    $0xc,%esp
+  8015e9:	53                   	push   %ebx
+  8015ea:	ff d0                	call   *%eax
+  8015ec:	83 c4 10             	add    $0x10,%esp
+  8015ef:	85 c0                	test   %eax,%eax
+  8015f1:	78 0b                	js     8015fe <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8015f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015f6:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8015f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801601:	c9                   	leave
+  801602:	c3                   	ret
+
+00801603 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801603:	55                   	push   %ebp
+  801604:	89 e5                	mov    %esp,%ebp
+  801606:	53                   	push   %ebx
+  801607:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80160a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80160d:	50                   	push   %eax
+  80160e:	ff 75 08             	push   0x8(%ebp)
+  801611:	e8 de fb ff ff       	call   8011f4 <fd_lookup>
+  801616:	83 c4 10             	add    $0x10,%esp
+  801619:	85 c0                	test   %eax,%eax
+  80161b:	78 2b                	js     801648 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80161d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801620:	83 ec 08             	sub    $0x8,%esp
+  801623:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801626:	50                   	push   %eax
+  801627:	ff 33                	push   (%ebx)
+  801629:	e8 16 fc ff ff       	call   801244 <dev_lookup>
+  80162e:	83 c4 10             	add    $0x10,%esp
+  801631:	85 c0                	test   %eax,%eax
+  801633:	78 13                	js     801648 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801635:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801638:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80163b:	85 c0                	test   %eax,%eax
+  80163d:	74 0e                	je     80164d <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  80163f:	83 ec 0c             	sub    $0xc,%esp
+  801642:	53                   	push   %ebx
+  801643:	ff d0                	call   *%eax
+  801645:	83 c4 10             	add    $0x10,%esp
+}
+  801648:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80164b:	c9                   	leave
+  80164c:	c3                   	ret
+		return 0;
+  80164d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801652:	eb f4                	jmp    801648 <fsync+0x45>
+
+00801654 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801654:	55                   	push   %ebp
+  801655:	89 e5                	mov    %esp,%ebp
+  801657:	56                   	push   %esi
+  801658:	53                   	push   %ebx
+  801659:	83 ec 18             	sub    $0x18,%esp
+  80165c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80165f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801662:	50                   	push   %eax
+  801663:	53                   	push   %ebx
+  801664:	e8 8b fb ff ff       	call   8011f4 <fd_lookup>
+  801669:	83 c4 10             	add    $0x10,%esp
+  80166c:	85 c0                	test   %eax,%eax
+  80166e:	78 34                	js     8016a4 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801670:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801673:	83 ec 08             	sub    $0x8,%esp
+  801676:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801679:	50                   	push   %eax
+  80167a:	ff 36                	push   (%esi)
+  80167c:	e8 c3 fb ff ff       	call   801244 <dev_lookup>
+  801681:	83 c4 10             	add    $0x10,%esp
+  801684:	85 c0                	test   %eax,%eax
+  801686:	78 1c                	js     8016a4 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801688:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80168c:	74 1d                	je     8016ab <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80168e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801691:	8b 40 18             	mov    0x18(%eax),%eax
+  801694:	85 c0                	test   %eax,%eax
+  801696:	74 34                	je     8016cc <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801698:	83 ec 08             	sub    $0x8,%esp
+  80169b:	ff 75 0c             	push   0xc(%ebp)
+  80169e:	56                   	push   %esi
+  80169f:	ff d0                	call   *%eax
+  8016a1:	83 c4 10             	add    $0x10,%esp
+}
+  8016a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016a7:	5b                   	pop    %ebx
+  8016a8:	5e                   	pop    %esi
+  8016a9:	5d                   	pop    %ebp
+  8016aa:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8016ab:	a1 00 50 80 00       	mov    0x805000,%eax
+  8016b0:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8016b3:	83 ec 04             	sub    $0x4,%esp
+  8016b6:	53                   	push   %ebx
+  8016b7:	50                   	push   %eax
+  8016b8:	68 88 3b 80 00       	push   $0x803b88
+  8016bd:	e8 d7 ea ff ff       	call   800199 <cprintf>
+		return -E_INVAL;
+  8016c2:	83 c4 10             	add    $0x10,%esp
+  8016c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ca:	eb d8                	jmp    8016a4 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016cc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016d1:	eb d1                	jmp    8016a4 <ftruncate+0x50>
+
+008016d3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016d3:	55                   	push   %ebp
+  8016d4:	89 e5                	mov    %esp,%ebp
+  8016d6:	56                   	push   %esi
+  8016d7:	53                   	push   %ebx
+  8016d8:	83 ec 18             	sub    $0x18,%esp
+  8016db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016de:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016e1:	50                   	push   %eax
+  8016e2:	ff 75 08             	push   0x8(%ebp)
+  8016e5:	e8 0a fb ff ff       	call   8011f4 <fd_lookup>
+  8016ea:	83 c4 10             	add    $0x10,%esp
+  8016ed:	85 c0                	test   %eax,%eax
+  8016ef:	78 49                	js     80173a <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016f1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016f4:	83 ec 08             	sub    $0x8,%esp
+  8016f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016fa:	50                   	push   %eax
+  8016fb:	ff 36                	push   (%esi)
+  8016fd:	e8 42 fb ff ff       	call   801244 <dev_lookup>
+  801702:	83 c4 10             	add    $0x10,%esp
+  801705:	85 c0                	test   %eax,%eax
+  801707:	78 31                	js     80173a <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801709:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80170c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801710:	74 2f                	je     801741 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801712:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801715:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80171c:	00 00 00 
+	stat->st_isdir = 0;
+  80171f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801726:	00 00 00 
+	stat->st_dev = dev;
+  801729:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80172f:	83 ec 08             	sub    $0x8,%esp
+  801732:	53                   	push   %ebx
+  801733:	56                   	push   %esi
+  801734:	ff 50 14             	call   *0x14(%eax)
+  801737:	83 c4 10             	add    $0x10,%esp
+}
+  80173a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80173d:	5b                   	pop    %ebx
+  80173e:	5e                   	pop    %esi
+  80173f:	5d                   	pop    %ebp
+  801740:	c3                   	ret
+		return -E_NOT_SUPP;
+  801741:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801746:	eb f2                	jmp    80173a <fstat+0x67>
+
+00801748 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801748:	55                   	push   %ebp
+  801749:	89 e5                	mov    %esp,%ebp
+  80174b:	56                   	push   %esi
+  80174c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  80174d:	83 ec 08             	sub    $0x8,%esp
+  801750:	68 00 10 00 00       	push   $0x1000
+  801755:	ff 75 08             	push   0x8(%ebp)
+  801758:	e8 b3 07 00 00       	call   801f10 <open>
+  80175d:	89 c3                	mov    %eax,%ebx
+  80175f:	83 c4 10             	add    $0x10,%esp
+  801762:	85 c0                	test   %eax,%eax
+  801764:	78 1b                	js     801781 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801766:	83 ec 08             	sub    $0x8,%esp
+  801769:	ff 75 0c             	push   0xc(%ebp)
+  80176c:	50                   	push   %eax
+  80176d:	e8 61 ff ff ff       	call   8016d3 <fstat>
+  801772:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801774:	89 1c 24             	mov    %ebx,(%esp)
+  801777:	e8 a2 fb ff ff       	call   80131e <close>
+	return r;
+  80177c:	83 c4 10             	add    $0x10,%esp
+  80177f:	89 f3                	mov    %esi,%ebx
+}
+  801781:	89 d8                	mov    %ebx,%eax
+  801783:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801786:	5b                   	pop    %ebx
+  801787:	5e                   	pop    %esi
+  801788:	5d                   	pop    %ebp
+  801789:	c3                   	ret
+
+0080178a <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  80178a:	55                   	push   %ebp
+  80178b:	89 e5                	mov    %esp,%ebp
+  80178d:	57                   	push   %edi
+  80178e:	56                   	push   %esi
+  80178f:	53                   	push   %ebx
+  801790:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801796:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  80179c:	89 d6                	mov    %edx,%esi
+  80179e:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  8017a4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  8017a7:	89 d3                	mov    %edx,%ebx
+  8017a9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  8017af:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  8017b6:	74 1d                	je     8017d5 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8017b8:	b8 00 60 80 00       	mov    $0x806000,%eax
+  8017bd:	83 c8 07             	or     $0x7,%eax
+  8017c0:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  8017c6:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8017cb:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  8017d1:	01 ce                	add    %ecx,%esi
+  8017d3:	eb 28                	jmp    8017fd <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017d5:	83 ec 0c             	sub    $0xc,%esp
+  8017d8:	6a 01                	push   $0x1
+  8017da:	e8 59 f9 ff ff       	call   801138 <ipc_find_env>
+  8017df:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8017e4:	83 c4 10             	add    $0x10,%esp
+  8017e7:	eb cf                	jmp    8017b8 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  8017e9:	83 c0 01             	add    $0x1,%eax
+  8017ec:	89 fa                	mov    %edi,%edx
+  8017ee:	09 da                	or     %ebx,%edx
+  8017f0:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8017f7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8017fd:	39 f3                	cmp    %esi,%ebx
+  8017ff:	72 e8                	jb     8017e9 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801801:	83 f8 41             	cmp    $0x41,%eax
+  801804:	77 2f                	ja     801835 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801806:	50                   	push   %eax
+  801807:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  80180d:	50                   	push   %eax
+  80180e:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801814:	ff 35 c8 70 80 00    	push   0x8070c8
+  80181a:	e8 cb f8 ff ff       	call   8010ea <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  80181f:	83 c4 0c             	add    $0xc,%esp
+  801822:	6a 00                	push   $0x0
+  801824:	6a 00                	push   $0x0
+  801826:	6a 00                	push   $0x0
+  801828:	e8 67 f7 ff ff       	call   800f94 <ipc_recv>
+}
+  80182d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801830:	5b                   	pop    %ebx
+  801831:	5e                   	pop    %esi
+  801832:	5f                   	pop    %edi
+  801833:	5d                   	pop    %ebp
+  801834:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801835:	68 f8 3b 80 00       	push   $0x803bf8
+  80183a:	68 47 3b 80 00       	push   $0x803b47
+  80183f:	6a 40                	push   $0x40
+  801841:	68 14 3c 80 00       	push   $0x803c14
+  801846:	e8 e7 18 00 00       	call   803132 <_panic>
+
+0080184b <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  80184b:	55                   	push   %ebp
+  80184c:	89 e5                	mov    %esp,%ebp
+  80184e:	57                   	push   %edi
+  80184f:	56                   	push   %esi
+  801850:	53                   	push   %ebx
+  801851:	83 ec 1c             	sub    $0x1c,%esp
+  801854:	89 c3                	mov    %eax,%ebx
+  801856:	89 d6                	mov    %edx,%esi
+  801858:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  80185b:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801861:	89 ca                	mov    %ecx,%edx
+  801863:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801866:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  80186d:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801870:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801877:	8b 76 0c             	mov    0xc(%esi),%esi
+  80187a:	89 fb                	mov    %edi,%ebx
+  80187c:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801883:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801886:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  80188d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801890:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801897:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80189a:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  8018a1:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  8018a4:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  8018ab:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  8018b0:	39 c8                	cmp    %ecx,%eax
+  8018b2:	74 0d                	je     8018c1 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  8018b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018bc:	5b                   	pop    %ebx
+  8018bd:	5e                   	pop    %esi
+  8018be:	5f                   	pop    %edi
+  8018bf:	5d                   	pop    %ebp
+  8018c0:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018c1:	6a 07                	push   $0x7
+  8018c3:	68 00 60 80 00       	push   $0x806000
+  8018c8:	6a 0d                	push   $0xd
+  8018ca:	ff 35 c8 70 80 00    	push   0x8070c8
+  8018d0:	e8 2a f7 ff ff       	call   800fff <ipc_send>
+  8018d5:	83 c4 10             	add    $0x10,%esp
+  8018d8:	eb da                	jmp    8018b4 <fsring_post+0x69>
+
+008018da <fsipcv>:
+{
+  8018da:	55                   	push   %ebp
+  8018db:	89 e5                	mov    %esp,%ebp
+  8018dd:	57                   	push   %edi
+  8018de:	56                   	push   %esi
+  8018df:	53                   	push   %ebx
+  8018e0:	83 ec 0c             	sub    $0xc,%esp
+  8018e3:	89 c7                	mov    %eax,%edi
+  8018e5:	89 d3                	mov    %edx,%ebx
+  8018e7:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  8018e9:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  8018f0:	74 26                	je     801918 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018f2:	6a 07                	push   $0x7
+  8018f4:	68 00 60 80 00       	push   $0x806000
+  8018f9:	57                   	push   %edi
+  8018fa:	ff 35 c8 70 80 00    	push   0x8070c8
+  801900:	e8 fa f6 ff ff       	call   800fff <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801905:	6a 00                	push   $0x0
+  801907:	56                   	push   %esi
+  801908:	53                   	push   %ebx
+  801909:	6a 00                	push   $0x0
+  80190b:	e8 47 f7 ff ff       	call   801057 <ipc_recvv>
+}
+  801910:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801913:	5b                   	pop    %ebx
+  801914:	5e                   	pop    %esi
+  801915:	5f                   	pop    %edi
+  801916:	5d                   	pop    %ebp
+  801917:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801918:	83 ec 0c             	sub    $0xc,%esp
+  80191b:	6a 01                	push   $0x1
+  80191d:	e8 16 f8 ff ff       	call   801138 <ipc_find_env>
+  801922:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801927:	83 c4 10             	add    $0x10,%esp
+  80192a:	eb c6                	jmp    8018f2 <fsipcv+0x18>
+
+0080192c <fsipc>:
+{
+  80192c:	55                   	push   %ebp
+  80192d:	89 e5                	mov    %esp,%ebp
+  80192f:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801932:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801939:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  80193c:	e8 99 ff ff ff       	call   8018da <fsipcv>
+}
+  801941:	c9                   	leave
+  801942:	c3                   	ret
+
+00801943 <file_write_direct>:
+{
+  801943:	55                   	push   %ebp
+  801944:	89 e5                	mov    %esp,%ebp
+  801946:	56                   	push   %esi
+  801947:	53                   	push   %ebx
+  801948:	89 c3                	mov    %eax,%ebx
+  80194a:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  80194c:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801952:	77 40                	ja     801994 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801954:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801959:	39 c8                	cmp    %ecx,%eax
+  80195b:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80195e:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801961:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  801967:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80196c:	83 ec 04             	sub    $0x4,%esp
+  80196f:	50                   	push   %eax
+  801970:	52                   	push   %edx
+  801971:	68 08 60 80 00       	push   $0x806008
+  801976:	e8 92 ef ff ff       	call   80090d <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80197b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801980:	b8 04 00 00 00       	mov    $0x4,%eax
+  801985:	e8 a2 ff ff ff       	call   80192c <fsipc>
+  80198a:	83 c4 10             	add    $0x10,%esp
+}
+  80198d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801990:	5b                   	pop    %ebx
+  801991:	5e                   	pop    %esi
+  801992:	5d                   	pop    %ebp
+  801993:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801994:	89 d6                	mov    %edx,%esi
+  801996:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80199c:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8019a1:	29 f1                	sub    %esi,%ecx
+  8019a3:	39 c1                	cmp    %eax,%ecx
+  8019a5:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  8019a8:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8019ab:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  8019b0:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8019b6:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  8019bc:	83 ec 0c             	sub    $0xc,%esp
+  8019bf:	6a 05                	push   $0x5
+  8019c1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8019c6:	e8 bf fd ff ff       	call   80178a <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  8019cb:	83 c4 10             	add    $0x10,%esp
+  8019ce:	eb bd                	jmp    80198d <file_write_direct+0x4a>
+
+008019d0 <devfile_sync>:
+{
+  8019d0:	55                   	push   %ebp
+  8019d1:	89 e5                	mov    %esp,%ebp
+  8019d3:	57                   	push   %edi
+  8019d4:	56                   	push   %esi
+  8019d5:	53                   	push   %ebx
+  8019d6:	83 ec 28             	sub    $0x28,%esp
+  8019d9:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  8019dc:	56                   	push   %esi
+  8019dd:	e8 a5 f7 ff ff       	call   801187 <fd2data>
+  8019e2:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  8019e4:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  8019e7:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  8019ee:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8019f1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  8019f6:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8019fa:	74 45                	je     801a41 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  8019fc:	8b 46 14             	mov    0x14(%esi),%eax
+  8019ff:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a0c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801a0f:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801a12:	39 cb                	cmp    %ecx,%ebx
+  801a14:	73 14                	jae    801a2a <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801a16:	29 d9                	sub    %ebx,%ecx
+  801a18:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801a1b:	89 f0                	mov    %esi,%eax
+  801a1d:	e8 21 ff ff ff       	call   801943 <file_write_direct>
+  801a22:	85 c0                	test   %eax,%eax
+  801a24:	7e 04                	jle    801a2a <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801a26:	01 c3                	add    %eax,%ebx
+  801a28:	eb e5                	jmp    801a0f <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801a2a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801a2d:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801a34:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801a37:	85 c0                	test   %eax,%eax
+  801a39:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a3e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801a41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a44:	5b                   	pop    %ebx
+  801a45:	5e                   	pop    %esi
+  801a46:	5f                   	pop    %edi
+  801a47:	5d                   	pop    %ebp
+  801a48:	c3                   	ret
+
+00801a49 <devfile_write>:
+{
+  801a49:	55                   	push   %ebp
+  801a4a:	89 e5                	mov    %esp,%ebp
+  801a4c:	57                   	push   %edi
+  801a4d:	56                   	push   %esi
+  801a4e:	53                   	push   %ebx
+  801a4f:	83 ec 28             	sub    $0x28,%esp
+  801a52:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a55:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801a58:	53                   	push   %ebx
+  801a59:	e8 29 f7 ff ff       	call   801187 <fd2data>
+  801a5e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801a61:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801a64:	83 c4 10             	add    $0x10,%esp
+  801a67:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801a6b:	74 43                	je     801ab0 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801a6d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801a74:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801a77:	85 c0                	test   %eax,%eax
+  801a79:	74 43                	je     801abe <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801a7b:	89 c2                	mov    %eax,%edx
+  801a7d:	03 53 14             	add    0x14(%ebx),%edx
+  801a80:	39 fa                	cmp    %edi,%edx
+  801a82:	75 0b                	jne    801a8f <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801a84:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801a87:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801a8d:	76 66                	jbe    801af5 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801a8f:	83 ec 0c             	sub    $0xc,%esp
+  801a92:	53                   	push   %ebx
+  801a93:	e8 38 ff ff ff       	call   8019d0 <devfile_sync>
+  801a98:	83 c4 10             	add    $0x10,%esp
+  801a9b:	85 c0                	test   %eax,%eax
+  801a9d:	78 4e                	js     801aed <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801a9f:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801aa5:	77 56                	ja     801afd <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801aa7:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801aaa:	85 c0                	test   %eax,%eax
+  801aac:	75 20                	jne    801ace <devfile_write+0x85>
+  801aae:	eb 16                	jmp    801ac6 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801ab0:	89 f1                	mov    %esi,%ecx
+  801ab2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ab5:	89 d8                	mov    %ebx,%eax
+  801ab7:	e8 87 fe ff ff       	call   801943 <file_write_direct>
+  801abc:	eb 2f                	jmp    801aed <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801abe:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801ac4:	77 37                	ja     801afd <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801ac6:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801ace:	83 ec 04             	sub    $0x4,%esp
+  801ad1:	56                   	push   %esi
+  801ad2:	ff 75 0c             	push   0xc(%ebp)
+  801ad5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801ad8:	01 c1                	add    %eax,%ecx
+  801ada:	51                   	push   %ecx
+  801adb:	e8 2d ee ff ff       	call   80090d <memmove>
+	ff->buf_wlen += n;
+  801ae0:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801ae3:	01 f7                	add    %esi,%edi
+  801ae5:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801ae8:	89 f0                	mov    %esi,%eax
+  801aea:	83 c4 10             	add    $0x10,%esp
+}
+  801aed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801af0:	5b                   	pop    %ebx
+  801af1:	5e                   	pop    %esi
+  801af2:	5f                   	pop    %edi
+  801af3:	5d                   	pop    %ebp
+  801af4:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801af5:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801afb:	76 d1                	jbe    801ace <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801afd:	89 f1                	mov    %esi,%ecx
+  801aff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b02:	89 d8                	mov    %ebx,%eax
+  801b04:	e8 3a fe ff ff       	call   801943 <file_write_direct>
+  801b09:	eb e2                	jmp    801aed <devfile_write+0xa4>
+
+00801b0b <devfile_trunc>:
+{
+  801b0b:	55                   	push   %ebp
+  801b0c:	89 e5                	mov    %esp,%ebp
+  801b0e:	53                   	push   %ebx
+  801b0f:	83 ec 10             	sub    $0x10,%esp
+  801b12:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801b15:	53                   	push   %ebx
+  801b16:	e8 b5 fe ff ff       	call   8019d0 <devfile_sync>
+  801b1b:	83 c4 10             	add    $0x10,%esp
+  801b1e:	85 c0                	test   %eax,%eax
+  801b20:	78 1f                	js     801b41 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b22:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b25:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801b2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b2d:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801b32:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b37:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b3c:	e8 eb fd ff ff       	call   80192c <fsipc>
+}
+  801b41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b44:	c9                   	leave
+  801b45:	c3                   	ret
+
+00801b46 <devfile_stat>:
+{
+  801b46:	55                   	push   %ebp
+  801b47:	89 e5                	mov    %esp,%ebp
+  801b49:	56                   	push   %esi
+  801b4a:	53                   	push   %ebx
+  801b4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801b4e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801b51:	83 ec 0c             	sub    $0xc,%esp
+  801b54:	53                   	push   %ebx
+  801b55:	e8 76 fe ff ff       	call   8019d0 <devfile_sync>
+  801b5a:	83 c4 10             	add    $0x10,%esp
+  801b5d:	85 c0                	test   %eax,%eax
+  801b5f:	78 47                	js     801ba8 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b61:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b64:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b73:	e8 b4 fd ff ff       	call   80192c <fsipc>
+  801b78:	85 c0                	test   %eax,%eax
+  801b7a:	78 2c                	js     801ba8 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b7c:	83 ec 08             	sub    $0x8,%esp
+  801b7f:	68 00 60 80 00       	push   $0x806000
+  801b84:	56                   	push   %esi
+  801b85:	e8 fd eb ff ff       	call   800787 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801b8a:	a1 80 60 80 00       	mov    0x806080,%eax
+  801b8f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b95:	a1 84 60 80 00       	mov    0x806084,%eax
+  801b9a:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801ba0:	83 c4 10             	add    $0x10,%esp
+  801ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ba8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bab:	5b                   	pop    %ebx
+  801bac:	5e                   	pop    %esi
+  801bad:	5d                   	pop    %ebp
+  801bae:	c3                   	ret
+
+00801baf <devfile_flush>:
+{
+  801baf:	55                   	push   %ebp
+  801bb0:	89 e5                	mov    %esp,%ebp
+  801bb2:	56                   	push   %esi
+  801bb3:	53                   	push   %ebx
+  801bb4:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801bb7:	83 ec 0c             	sub    $0xc,%esp
+  801bba:	56                   	push   %esi
+  801bbb:	e8 10 fe ff ff       	call   8019d0 <devfile_sync>
+  801bc0:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801bc2:	83 c4 10             	add    $0x10,%esp
+  801bc5:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801bc9:	75 25                	jne    801bf0 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801bcb:	8b 46 0c             	mov    0xc(%esi),%eax
+  801bce:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801bd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd8:	b8 06 00 00 00       	mov    $0x6,%eax
+  801bdd:	e8 4a fd ff ff       	call   80192c <fsipc>
+  801be2:	85 c0                	test   %eax,%eax
+  801be4:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801be7:	89 d8                	mov    %ebx,%eax
+  801be9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bec:	5b                   	pop    %ebx
+  801bed:	5e                   	pop    %esi
+  801bee:	5d                   	pop    %ebp
+  801bef:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801bf0:	83 ec 0c             	sub    $0xc,%esp
+  801bf3:	56                   	push   %esi
+  801bf4:	e8 8e f5 ff ff       	call   801187 <fd2data>
+  801bf9:	83 c4 08             	add    $0x8,%esp
+  801bfc:	50                   	push   %eax
+  801bfd:	6a 00                	push   $0x0
+  801bff:	e8 1c f0 ff ff       	call   800c20 <sys_page_unmap>
+  801c04:	83 c4 10             	add    $0x10,%esp
+  801c07:	eb c2                	jmp    801bcb <devfile_flush+0x1c>
+
+00801c09 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801c09:	55                   	push   %ebp
+  801c0a:	89 e5                	mov    %esp,%ebp
+  801c0c:	57                   	push   %edi
+  801c0d:	56                   	push   %esi
+  801c0e:	53                   	push   %ebx
+  801c0f:	83 ec 64             	sub    $0x64,%esp
+  801c12:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801c14:	52                   	push   %edx
+  801c15:	50                   	push   %eax
+  801c16:	e8 d9 f5 ff ff       	call   8011f4 <fd_lookup>
+  801c1b:	89 c1                	mov    %eax,%ecx
+  801c1d:	83 c4 10             	add    $0x10,%esp
+  801c20:	85 c0                	test   %eax,%eax
+  801c22:	0f 88 f2 00 00 00    	js     801d1a <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801c28:	8b 07                	mov    (%edi),%eax
+  801c2a:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801c30:	39 10                	cmp    %edx,(%eax)
+  801c32:	0f 85 03 01 00 00    	jne    801d3b <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801c38:	a1 00 50 80 00       	mov    0x805000,%eax
+  801c3d:	8b 40 48             	mov    0x48(%eax),%eax
+  801c40:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801c46:	0f 84 96 00 00 00    	je     801ce2 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801c4c:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801c53:	0f 84 cb 00 00 00    	je     801d24 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801c59:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801c5e:	83 c8 07             	or     $0x7,%eax
+  801c61:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801c64:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801c67:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801c6c:	83 ec 04             	sub    $0x4,%esp
+  801c6f:	68 07 04 00 00       	push   $0x407
+  801c74:	53                   	push   %ebx
+  801c75:	6a 00                	push   $0x0
+  801c77:	e8 17 ef ff ff       	call   800b93 <sys_page_alloc>
+  801c7c:	89 c1                	mov    %eax,%ecx
+  801c7e:	83 c4 10             	add    $0x10,%esp
+  801c81:	85 c0                	test   %eax,%eax
+  801c83:	0f 88 91 00 00 00    	js     801d1a <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801c89:	89 d8                	mov    %ebx,%eax
+  801c8b:	83 c8 07             	or     $0x7,%eax
+  801c8e:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801c90:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c96:	83 c6 04             	add    $0x4,%esi
+  801c99:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801c9f:	75 cb                	jne    801c6c <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801ca1:	6a 12                	push   $0x12
+  801ca3:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801ca6:	50                   	push   %eax
+  801ca7:	6a 0c                	push   $0xc
+  801ca9:	ff 35 c8 70 80 00    	push   0x8070c8
+  801caf:	e8 36 f4 ff ff       	call   8010ea <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801cb4:	83 c4 0c             	add    $0xc,%esp
+  801cb7:	6a 00                	push   $0x0
+  801cb9:	6a 00                	push   $0x0
+  801cbb:	6a 00                	push   $0x0
+  801cbd:	e8 d2 f2 ff ff       	call   800f94 <ipc_recv>
+  801cc2:	89 c1                	mov    %eax,%ecx
+  801cc4:	83 c4 10             	add    $0x10,%esp
+  801cc7:	85 c0                	test   %eax,%eax
+  801cc9:	78 4f                	js     801d1a <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801ccb:	a1 00 50 80 00       	mov    0x805000,%eax
+  801cd0:	8b 40 48             	mov    0x48(%eax),%eax
+  801cd3:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801cd8:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801cdf:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801ce2:	83 ec 0c             	sub    $0xc,%esp
+  801ce5:	ff 37                	push   (%edi)
+  801ce7:	e8 e4 fc ff ff       	call   8019d0 <devfile_sync>
+  801cec:	89 c1                	mov    %eax,%ecx
+  801cee:	83 c4 10             	add    $0x10,%esp
+  801cf1:	85 c0                	test   %eax,%eax
+  801cf3:	78 25                	js     801d1a <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801cf5:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801cfb:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801d00:	ba 01 00 00 00       	mov    $0x1,%edx
+  801d05:	89 d0                	mov    %edx,%eax
+  801d07:	d3 e0                	shl    %cl,%eax
+  801d09:	85 d8                	test   %ebx,%eax
+  801d0b:	74 0d                	je     801d1a <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801d0d:	83 c1 01             	add    $0x1,%ecx
+  801d10:	83 f9 10             	cmp    $0x10,%ecx
+  801d13:	75 f0                	jne    801d05 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801d15:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801d1a:	89 c8                	mov    %ecx,%eax
+  801d1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d1f:	5b                   	pop    %ebx
+  801d20:	5e                   	pop    %esi
+  801d21:	5f                   	pop    %edi
+  801d22:	5d                   	pop    %ebp
+  801d23:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d24:	83 ec 0c             	sub    $0xc,%esp
+  801d27:	6a 01                	push   $0x1
+  801d29:	e8 0a f4 ff ff       	call   801138 <ipc_find_env>
+  801d2e:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801d33:	83 c4 10             	add    $0x10,%esp
+  801d36:	e9 1e ff ff ff       	jmp    801c59 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801d3b:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801d40:	eb d8                	jmp    801d1a <fsring_slot+0x111>
+
+00801d42 <file_read_direct>:
+{
+  801d42:	55                   	push   %ebp
+  801d43:	89 e5                	mov    %esp,%ebp
+  801d45:	57                   	push   %edi
+  801d46:	56                   	push   %esi
+  801d47:	53                   	push   %ebx
+  801d48:	83 ec 1c             	sub    $0x1c,%esp
+  801d4b:	89 c7                	mov    %eax,%edi
+  801d4d:	89 d6                	mov    %edx,%esi
+  801d4f:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801d51:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801d57:	77 52                	ja     801dab <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801d59:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d5c:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801d61:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801d67:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d6c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d71:	e8 b6 fb ff ff       	call   80192c <fsipc>
+  801d76:	89 c7                	mov    %eax,%edi
+  801d78:	85 c0                	test   %eax,%eax
+  801d7a:	78 25                	js     801da1 <file_read_direct+0x5f>
+	assert(r <= n);
+  801d7c:	39 c3                	cmp    %eax,%ebx
+  801d7e:	0f 82 87 00 00 00    	jb     801e0b <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801d84:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801d89:	0f 8f 95 00 00 00    	jg     801e24 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801d8f:	83 ec 04             	sub    $0x4,%esp
+  801d92:	50                   	push   %eax
+  801d93:	68 00 60 80 00       	push   $0x806000
+  801d98:	56                   	push   %esi
+  801d99:	e8 6f eb ff ff       	call   80090d <memmove>
+	return r;
+  801d9e:	83 c4 10             	add    $0x10,%esp
+}
+  801da1:	89 f8                	mov    %edi,%eax
+  801da3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801da6:	5b                   	pop    %ebx
+  801da7:	5e                   	pop    %esi
+  801da8:	5f                   	pop    %edi
+  801da9:	5d                   	pop    %ebp
+  801daa:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801dab:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801db1:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801db6:	29 d1                	sub    %edx,%ecx
+  801db8:	39 d9                	cmp    %ebx,%ecx
+  801dba:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801dbd:	89 f0                	mov    %esi,%eax
+  801dbf:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801dc2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801dc5:	eb 0f                	jmp    801dd6 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801dc7:	0f b6 10             	movzbl (%eax),%edx
+  801dca:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801dcc:	05 00 10 00 00       	add    $0x1000,%eax
+  801dd1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801dd6:	39 c8                	cmp    %ecx,%eax
+  801dd8:	72 ed                	jb     801dc7 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801dda:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ddd:	8b 47 0c             	mov    0xc(%edi),%eax
+  801de0:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801de5:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801deb:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801df1:	83 ec 0c             	sub    $0xc,%esp
+  801df4:	6a 07                	push   $0x7
+  801df6:	89 d9                	mov    %ebx,%ecx
+  801df8:	89 f2                	mov    %esi,%edx
+  801dfa:	b8 09 00 00 00       	mov    $0x9,%eax
+  801dff:	e8 86 f9 ff ff       	call   80178a <fsipc_pages>
+  801e04:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801e06:	83 c4 10             	add    $0x10,%esp
+  801e09:	eb 96                	jmp    801da1 <file_read_direct+0x5f>
+	assert(r <= n);
+  801e0b:	68 1f 3c 80 00       	push   $0x803c1f
+  801e10:	68 47 3b 80 00       	push   $0x803b47
+  801e15:	68 dc 00 00 00       	push   $0xdc
+  801e1a:	68 14 3c 80 00       	push   $0x803c14
+  801e1f:	e8 0e 13 00 00       	call   803132 <_panic>
+	assert(r <= PGSIZE);
+  801e24:	68 30 3c 80 00       	push   $0x803c30
+  801e29:	68 47 3b 80 00       	push   $0x803b47
+  801e2e:	68 dd 00 00 00       	push   $0xdd
+  801e33:	68 14 3c 80 00       	push   $0x803c14
+  801e38:	e8 f5 12 00 00       	call   803132 <_panic>
+
+00801e3d <devfile_read>:
+{
+  801e3d:	55                   	push   %ebp
+  801e3e:	89 e5                	mov    %esp,%ebp
+  801e40:	57                   	push   %edi
+  801e41:	56                   	push   %esi
+  801e42:	53                   	push   %ebx
+  801e43:	83 ec 28             	sub    $0x28,%esp
+  801e46:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e49:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801e4c:	53                   	push   %ebx
+  801e4d:	e8 35 f3 ff ff       	call   801187 <fd2data>
+  801e52:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801e55:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801e58:	83 c4 10             	add    $0x10,%esp
+  801e5b:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801e5f:	74 7d                	je     801ede <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801e61:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801e65:	0f 85 81 00 00 00    	jne    801eec <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801e6b:	8b 43 18             	mov    0x18(%ebx),%eax
+  801e6e:	85 c0                	test   %eax,%eax
+  801e70:	74 0d                	je     801e7f <devfile_read+0x42>
+  801e72:	8b 53 14             	mov    0x14(%ebx),%edx
+  801e75:	39 fa                	cmp    %edi,%edx
+  801e77:	7f 06                	jg     801e7f <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801e79:	01 c2                	add    %eax,%edx
+  801e7b:	39 d7                	cmp    %edx,%edi
+  801e7d:	72 28                	jb     801ea7 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801e7f:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801e86:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e8c:	77 74                	ja     801f02 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801e8e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e93:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801e96:	89 d8                	mov    %ebx,%eax
+  801e98:	e8 a5 fe ff ff       	call   801d42 <file_read_direct>
+  801e9d:	85 c0                	test   %eax,%eax
+  801e9f:	7e 35                	jle    801ed6 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801ea1:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801ea4:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801ea7:	8b 53 14             	mov    0x14(%ebx),%edx
+  801eaa:	89 d0                	mov    %edx,%eax
+  801eac:	03 43 18             	add    0x18(%ebx),%eax
+  801eaf:	29 f8                	sub    %edi,%eax
+  801eb1:	39 f0                	cmp    %esi,%eax
+  801eb3:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801eb6:	83 ec 04             	sub    $0x4,%esp
+  801eb9:	56                   	push   %esi
+  801eba:	89 f8                	mov    %edi,%eax
+  801ebc:	29 d0                	sub    %edx,%eax
+  801ebe:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801ec1:	01 c1                	add    %eax,%ecx
+  801ec3:	51                   	push   %ecx
+  801ec4:	ff 75 0c             	push   0xc(%ebp)
+  801ec7:	e8 41 ea ff ff       	call   80090d <memmove>
+	fd->fd_offset = pos + n;
+  801ecc:	01 f7                	add    %esi,%edi
+  801ece:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801ed1:	89 f0                	mov    %esi,%eax
+  801ed3:	83 c4 10             	add    $0x10,%esp
+}
+  801ed6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ed9:	5b                   	pop    %ebx
+  801eda:	5e                   	pop    %esi
+  801edb:	5f                   	pop    %edi
+  801edc:	5d                   	pop    %ebp
+  801edd:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801ede:	89 f1                	mov    %esi,%ecx
+  801ee0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ee3:	89 d8                	mov    %ebx,%eax
+  801ee5:	e8 58 fe ff ff       	call   801d42 <file_read_direct>
+  801eea:	eb ea                	jmp    801ed6 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801eec:	83 ec 0c             	sub    $0xc,%esp
+  801eef:	53                   	push   %ebx
+  801ef0:	e8 db fa ff ff       	call   8019d0 <devfile_sync>
+  801ef5:	83 c4 10             	add    $0x10,%esp
+  801ef8:	85 c0                	test   %eax,%eax
+  801efa:	0f 89 6b ff ff ff    	jns    801e6b <devfile_read+0x2e>
+  801f00:	eb d4                	jmp    801ed6 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801f02:	89 f1                	mov    %esi,%ecx
+  801f04:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f07:	89 d8                	mov    %ebx,%eax
+  801f09:	e8 34 fe ff ff       	call   801d42 <file_read_direct>
+  801f0e:	eb c6                	jmp    801ed6 <devfile_read+0x99>
+
+00801f10 <open>:
+{
+  801f10:	55                   	push   %ebp
+  801f11:	89 e5                	mov    %esp,%ebp
+  801f13:	56                   	push   %esi
+  801f14:	53                   	push   %ebx
+  801f15:	83 ec 1c             	sub    $0x1c,%esp
+  801f18:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801f1b:	56                   	push   %esi
+  801f1c:	e8 2b e8 ff ff       	call   80074c <strlen>
+  801f21:	83 c4 10             	add    $0x10,%esp
+  801f24:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f29:	0f 8f a0 00 00 00    	jg     801fcf <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801f2f:	83 ec 0c             	sub    $0xc,%esp
+  801f32:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f35:	50                   	push   %eax
+  801f36:	e8 63 f2 ff ff       	call   80119e <fd_alloc>
+  801f3b:	89 c3                	mov    %eax,%ebx
+  801f3d:	83 c4 10             	add    $0x10,%esp
+  801f40:	85 c0                	test   %eax,%eax
+  801f42:	78 45                	js     801f89 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801f44:	83 ec 08             	sub    $0x8,%esp
+  801f47:	56                   	push   %esi
+  801f48:	68 00 60 80 00       	push   $0x806000
+  801f4d:	e8 35 e8 ff ff       	call   800787 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801f52:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f55:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801f5a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f5d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f62:	e8 c5 f9 ff ff       	call   80192c <fsipc>
+  801f67:	89 c3                	mov    %eax,%ebx
+  801f69:	83 c4 10             	add    $0x10,%esp
+  801f6c:	85 c0                	test   %eax,%eax
+  801f6e:	78 22                	js     801f92 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801f70:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801f77:	74 2b                	je     801fa4 <open+0x94>
+	return fd2num(fd);
+  801f79:	83 ec 0c             	sub    $0xc,%esp
+  801f7c:	ff 75 f4             	push   -0xc(%ebp)
+  801f7f:	e8 f3 f1 ff ff       	call   801177 <fd2num>
+  801f84:	89 c3                	mov    %eax,%ebx
+  801f86:	83 c4 10             	add    $0x10,%esp
+}
+  801f89:	89 d8                	mov    %ebx,%eax
+  801f8b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f8e:	5b                   	pop    %ebx
+  801f8f:	5e                   	pop    %esi
+  801f90:	5d                   	pop    %ebp
+  801f91:	c3                   	ret
+		fd_close(fd, 0);
+  801f92:	83 ec 08             	sub    $0x8,%esp
+  801f95:	6a 00                	push   $0x0
+  801f97:	ff 75 f4             	push   -0xc(%ebp)
+  801f9a:	e8 f8 f2 ff ff       	call   801297 <fd_close>
+		return r;
+  801f9f:	83 c4 10             	add    $0x10,%esp
+  801fa2:	eb e5                	jmp    801f89 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801fa4:	83 ec 0c             	sub    $0xc,%esp
+  801fa7:	ff 75 f4             	push   -0xc(%ebp)
+  801faa:	e8 d8 f1 ff ff       	call   801187 <fd2data>
+  801faf:	83 c4 0c             	add    $0xc,%esp
+  801fb2:	68 07 04 00 00       	push   $0x407
+  801fb7:	50                   	push   %eax
+  801fb8:	6a 00                	push   $0x0
+  801fba:	e8 d4 eb ff ff       	call   800b93 <sys_page_alloc>
+  801fbf:	83 c4 10             	add    $0x10,%esp
+  801fc2:	85 c0                	test   %eax,%eax
+  801fc4:	75 b3                	jne    801f79 <open+0x69>
+		fd->fd_file.buffered = 1;
+  801fc6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fc9:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801fcd:	eb aa                	jmp    801f79 <open+0x69>
+		return -E_BAD_PATH;
+  801fcf:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801fd4:	eb b3                	jmp    801f89 <open+0x79>
+
+00801fd6 <readdir>:
+{
+  801fd6:	55                   	push   %ebp
+  801fd7:	89 e5                	mov    %esp,%ebp
+  801fd9:	53                   	push   %ebx
+  801fda:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fdd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fe0:	50                   	push   %eax
+  801fe1:	ff 75 08             	push   0x8(%ebp)
+  801fe4:	e8 0b f2 ff ff       	call   8011f4 <fd_lookup>
+  801fe9:	89 c3                	mov    %eax,%ebx
+  801feb:	83 c4 10             	add    $0x10,%esp
+  801fee:	85 c0                	test   %eax,%eax
+  801ff0:	78 73                	js     802065 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801ff2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ff5:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801ffb:	39 08                	cmp    %ecx,(%eax)
+  801ffd:	0f 85 82 00 00 00    	jne    802085 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802003:	83 ec 0c             	sub    $0xc,%esp
+  802006:	50                   	push   %eax
+  802007:	e8 c4 f9 ff ff       	call   8019d0 <devfile_sync>
+  80200c:	89 c3                	mov    %eax,%ebx
+  80200e:	83 c4 10             	add    $0x10,%esp
+  802011:	85 c0                	test   %eax,%eax
+  802013:	78 50                	js     802065 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802015:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802018:	8b 40 0c             	mov    0xc(%eax),%eax
+  80201b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  802020:	8b 45 10             	mov    0x10(%ebp),%eax
+  802023:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  802028:	8b 45 14             	mov    0x14(%ebp),%eax
+  80202b:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  802030:	ba 00 00 00 00       	mov    $0x0,%edx
+  802035:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80203a:	e8 ed f8 ff ff       	call   80192c <fsipc>
+  80203f:	89 c3                	mov    %eax,%ebx
+  802041:	85 c0                	test   %eax,%eax
+  802043:	7e 20                	jle    802065 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  802045:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802048:	72 22                	jb     80206c <readdir+0x96>
+  80204a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80204f:	7f 1b                	jg     80206c <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802051:	83 ec 04             	sub    $0x4,%esp
+  802054:	50                   	push   %eax
+  802055:	68 00 60 80 00       	push   $0x806000
+  80205a:	ff 75 0c             	push   0xc(%ebp)
+  80205d:	e8 ab e8 ff ff       	call   80090d <memmove>
+	return r;
+  802062:	83 c4 10             	add    $0x10,%esp
+}
+  802065:	89 d8                	mov    %ebx,%eax
+  802067:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80206a:	c9                   	leave
+  80206b:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  80206c:	68 26 3c 80 00       	push   $0x803c26
+  802071:	68 47 3b 80 00       	push   $0x803b47
+  802076:	68 86 01 00 00       	push   $0x186
+  80207b:	68 14 3c 80 00       	push   $0x803c14
+  802080:	e8 ad 10 00 00       	call   803132 <_panic>
+		return -E_NOT_SUPP;
+  802085:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80208a:	eb d9                	jmp    802065 <readdir+0x8f>
+
+0080208c <munmap>:
+{
+  80208c:	55                   	push   %ebp
+  80208d:	89 e5                	mov    %esp,%ebp
+  80208f:	56                   	push   %esi
+  802090:	53                   	push   %ebx
+  802091:	8b 75 08             	mov    0x8(%ebp),%esi
+  802094:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802097:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  80209d:	75 41                	jne    8020e0 <munmap+0x54>
+  80209f:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8020a5:	77 39                	ja     8020e0 <munmap+0x54>
+  8020a7:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8020ac:	29 f0                	sub    %esi,%eax
+  8020ae:	39 d0                	cmp    %edx,%eax
+  8020b0:	72 35                	jb     8020e7 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8020b2:	89 f3                	mov    %esi,%ebx
+  8020b4:	01 d6                	add    %edx,%esi
+  8020b6:	39 f3                	cmp    %esi,%ebx
+  8020b8:	73 1a                	jae    8020d4 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8020ba:	83 ec 08             	sub    $0x8,%esp
+  8020bd:	53                   	push   %ebx
+  8020be:	6a 00                	push   $0x0
+  8020c0:	e8 5b eb ff ff       	call   800c20 <sys_page_unmap>
+  8020c5:	83 c4 10             	add    $0x10,%esp
+  8020c8:	85 c0                	test   %eax,%eax
+  8020ca:	78 0d                	js     8020d9 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8020cc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8020d2:	eb e2                	jmp    8020b6 <munmap+0x2a>
+	return 0;
+  8020d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020dc:	5b                   	pop    %ebx
+  8020dd:	5e                   	pop    %esi
+  8020de:	5d                   	pop    %ebp
+  8020df:	c3                   	ret
+		return -E_INVAL;
+  8020e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020e5:	eb f2                	jmp    8020d9 <munmap+0x4d>
+  8020e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020ec:	eb eb                	jmp    8020d9 <munmap+0x4d>
+
+008020ee <mmap>:
+{
+  8020ee:	55                   	push   %ebp
+  8020ef:	89 e5                	mov    %esp,%ebp
+  8020f1:	57                   	push   %edi
+  8020f2:	56                   	push   %esi
+  8020f3:	53                   	push   %ebx
+  8020f4:	83 ec 34             	sub    $0x34,%esp
+  8020f7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020fa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020fd:	50                   	push   %eax
+  8020fe:	ff 75 18             	push   0x18(%ebp)
+  802101:	e8 ee f0 ff ff       	call   8011f4 <fd_lookup>
+  802106:	89 c3                	mov    %eax,%ebx
+  802108:	83 c4 10             	add    $0x10,%esp
+  80210b:	85 c0                	test   %eax,%eax
+  80210d:	0f 88 0e 01 00 00    	js     802221 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802113:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802116:	a1 20 40 80 00       	mov    0x804020,%eax
+  80211b:	39 02                	cmp    %eax,(%edx)
+  80211d:	0f 85 50 01 00 00    	jne    802273 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802123:	8b 45 10             	mov    0x10(%ebp),%eax
+  802126:	83 e0 02             	and    $0x2,%eax
+  802129:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80212c:	74 0a                	je     802138 <mmap+0x4a>
+  80212e:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802132:	0f 84 42 01 00 00    	je     80227a <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802138:	8b 42 08             	mov    0x8(%edx),%eax
+  80213b:	83 e0 03             	and    $0x3,%eax
+  80213e:	83 f8 01             	cmp    $0x1,%eax
+  802141:	0f 84 3a 01 00 00    	je     802281 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802147:	8b 45 08             	mov    0x8(%ebp),%eax
+  80214a:	0b 45 1c             	or     0x1c(%ebp),%eax
+  80214d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802152:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802155:	0f 85 2d 01 00 00    	jne    802288 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80215b:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80215f:	0f 88 2a 01 00 00    	js     80228f <mmap+0x1a1>
+  802165:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80216c:	0f 87 1d 01 00 00    	ja     80228f <mmap+0x1a1>
+  802172:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802177:	2b 45 08             	sub    0x8(%ebp),%eax
+  80217a:	39 f8                	cmp    %edi,%eax
+  80217c:	0f 82 14 01 00 00    	jb     802296 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802182:	83 ec 0c             	sub    $0xc,%esp
+  802185:	52                   	push   %edx
+  802186:	e8 45 f8 ff ff       	call   8019d0 <devfile_sync>
+  80218b:	89 c3                	mov    %eax,%ebx
+  80218d:	83 c4 10             	add    $0x10,%esp
+  802190:	85 c0                	test   %eax,%eax
+  802192:	0f 88 89 00 00 00    	js     802221 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802198:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  80219e:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8021a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a9:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8021ac:	39 fe                	cmp    %edi,%esi
+  8021ae:	73 7b                	jae    80222b <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8021b0:	89 f8                	mov    %edi,%eax
+  8021b2:	29 f0                	sub    %esi,%eax
+  8021b4:	c1 e8 0c             	shr    $0xc,%eax
+  8021b7:	ba 40 00 00 00       	mov    $0x40,%edx
+  8021bc:	39 d0                	cmp    %edx,%eax
+  8021be:	0f 47 c2             	cmova  %edx,%eax
+  8021c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8021c4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8021c7:	8b 52 0c             	mov    0xc(%edx),%edx
+  8021ca:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  8021d0:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8021d3:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  8021d9:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8021de:	89 f2                	mov    %esi,%edx
+  8021e0:	03 55 08             	add    0x8(%ebp),%edx
+  8021e3:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8021e6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8021eb:	e8 ea f6 ff ff       	call   8018da <fsipcv>
+  8021f0:	85 c0                	test   %eax,%eax
+  8021f2:	7e 12                	jle    802206 <mmap+0x118>
+  8021f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8021f7:	85 c0                	test   %eax,%eax
+  8021f9:	0f 84 9e 00 00 00    	je     80229d <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8021ff:	c1 e0 0c             	shl    $0xc,%eax
+  802202:	01 c6                	add    %eax,%esi
+  802204:	eb a6                	jmp    8021ac <mmap+0xbe>
+			munmap(addr, done);
+  802206:	89 c3                	mov    %eax,%ebx
+  802208:	83 ec 08             	sub    $0x8,%esp
+  80220b:	56                   	push   %esi
+  80220c:	ff 75 08             	push   0x8(%ebp)
+  80220f:	e8 78 fe ff ff       	call   80208c <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802214:	83 c4 10             	add    $0x10,%esp
+  802217:	85 db                	test   %ebx,%ebx
+  802219:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80221e:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802221:	89 d8                	mov    %ebx,%eax
+  802223:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802226:	5b                   	pop    %ebx
+  802227:	5e                   	pop    %esi
+  802228:	5f                   	pop    %edi
+  802229:	5d                   	pop    %ebp
+  80222a:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80222b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80222e:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802230:	85 c0                	test   %eax,%eax
+  802232:	74 ed                	je     802221 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802234:	be 00 00 00 00       	mov    $0x0,%esi
+  802239:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80223c:	39 fe                	cmp    %edi,%esi
+  80223e:	73 2e                	jae    80226e <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802240:	83 ec 0c             	sub    $0xc,%esp
+  802243:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802246:	50                   	push   %eax
+  802247:	e8 43 10 00 00       	call   80328f <cowpage>
+  80224c:	83 c4 10             	add    $0x10,%esp
+  80224f:	85 c0                	test   %eax,%eax
+  802251:	78 08                	js     80225b <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802253:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802259:	eb e1                	jmp    80223c <mmap+0x14e>
+				munmap(addr, len);
+  80225b:	89 c3                	mov    %eax,%ebx
+  80225d:	83 ec 08             	sub    $0x8,%esp
+  802260:	57                   	push   %edi
+  802261:	ff 75 08             	push   0x8(%ebp)
+  802264:	e8 23 fe ff ff       	call   80208c <munmap>
+				return r;
+  802269:	83 c4 10             	add    $0x10,%esp
+  80226c:	eb b3                	jmp    802221 <mmap+0x133>
+	return 0;
+  80226e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802271:	eb ae                	jmp    802221 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802273:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802278:	eb a7                	jmp    802221 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80227a:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80227f:	eb a0                	jmp    802221 <mmap+0x133>
+		return -E_INVAL;
+  802281:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802286:	eb 99                	jmp    802221 <mmap+0x133>
+  802288:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80228d:	eb 92                	jmp    802221 <mmap+0x133>
+  80228f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802294:	eb 8b                	jmp    802221 <mmap+0x133>
+  802296:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80229b:	eb 84                	jmp    802221 <mmap+0x133>
+			munmap(addr, done);
+  80229d:	83 ec 08             	sub    $0x8,%esp
+  8022a0:	56                   	push   %esi
+  8022a1:	ff 75 08             	push   0x8(%ebp)
+  8022a4:	e8 e3 fd ff ff       	call   80208c <munmap>
+  8022a9:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8022ac:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8022b1:	e9 6b ff ff ff       	jmp    802221 <mmap+0x133>
+
+008022b6 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8022b6:	55                   	push   %ebp
+  8022b7:	89 e5                	mov    %esp,%ebp
+  8022b9:	56                   	push   %esi
+  8022ba:	53                   	push   %ebx
+  8022bb:	83 ec 10             	sub    $0x10,%esp
+  8022be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8022c1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8022c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c7:	e8 3d f9 ff ff       	call   801c09 <fsring_slot>
+  8022cc:	85 c0                	test   %eax,%eax
+  8022ce:	78 60                	js     802330 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8022d0:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8022d3:	8b 56 08             	mov    0x8(%esi),%edx
+  8022d6:	83 e2 03             	and    $0x3,%edx
+  8022d9:	83 fa 01             	cmp    $0x1,%edx
+  8022dc:	74 59                	je     802337 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8022de:	ba 01 00 00 00       	mov    $0x1,%edx
+  8022e3:	89 c1                	mov    %eax,%ecx
+  8022e5:	d3 e2                	shl    %cl,%edx
+  8022e7:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8022ed:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8022f0:	c1 e2 02             	shl    $0x2,%edx
+  8022f3:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8022f9:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  802300:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802303:	8b 55 18             	mov    0x18(%ebp),%edx
+  802306:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802309:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80230c:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80230f:	83 ec 08             	sub    $0x8,%esp
+  802312:	50                   	push   %eax
+  802313:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802318:	39 c3                	cmp    %eax,%ebx
+  80231a:	0f 47 d8             	cmova  %eax,%ebx
+  80231d:	53                   	push   %ebx
+  80231e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802321:	89 f2                	mov    %esi,%edx
+  802323:	b8 03 00 00 00       	mov    $0x3,%eax
+  802328:	e8 1e f5 ff ff       	call   80184b <fsring_post>
+  80232d:	83 c4 10             	add    $0x10,%esp
+}
+  802330:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802333:	5b                   	pop    %ebx
+  802334:	5e                   	pop    %esi
+  802335:	5d                   	pop    %ebp
+  802336:	c3                   	ret
+		return -E_INVAL;
+  802337:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80233c:	eb f2                	jmp    802330 <fsring_read+0x7a>
+
+0080233e <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80233e:	55                   	push   %ebp
+  80233f:	89 e5                	mov    %esp,%ebp
+  802341:	56                   	push   %esi
+  802342:	53                   	push   %ebx
+  802343:	83 ec 10             	sub    $0x10,%esp
+  802346:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802349:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80234c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234f:	e8 b5 f8 ff ff       	call   801c09 <fsring_slot>
+  802354:	89 c3                	mov    %eax,%ebx
+  802356:	85 c0                	test   %eax,%eax
+  802358:	78 77                	js     8023d1 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80235a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80235d:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802361:	74 77                	je     8023da <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802363:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802368:	39 c6                	cmp    %eax,%esi
+  80236a:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80236d:	83 ec 04             	sub    $0x4,%esp
+  802370:	56                   	push   %esi
+  802371:	ff 75 0c             	push   0xc(%ebp)
+  802374:	89 d8                	mov    %ebx,%eax
+  802376:	c1 e0 0c             	shl    $0xc,%eax
+  802379:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80237f:	50                   	push   %eax
+  802380:	e8 88 e5 ff ff       	call   80090d <memmove>
+	fsring_busy |= 1 << slot;
+  802385:	b8 01 00 00 00       	mov    $0x1,%eax
+  80238a:	89 d9                	mov    %ebx,%ecx
+  80238c:	d3 e0                	shl    %cl,%eax
+  80238e:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802394:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802397:	c1 e0 02             	shl    $0x2,%eax
+  80239a:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8023a0:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8023a7:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8023aa:	8b 45 18             	mov    0x18(%ebp),%eax
+  8023ad:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8023b0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8023b7:	83 c4 08             	add    $0x8,%esp
+  8023ba:	53                   	push   %ebx
+  8023bb:	56                   	push   %esi
+  8023bc:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8023bf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023c2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8023c7:	e8 7f f4 ff ff       	call   80184b <fsring_post>
+  8023cc:	89 c3                	mov    %eax,%ebx
+  8023ce:	83 c4 10             	add    $0x10,%esp
+}
+  8023d1:	89 d8                	mov    %ebx,%eax
+  8023d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023d6:	5b                   	pop    %ebx
+  8023d7:	5e                   	pop    %esi
+  8023d8:	5d                   	pop    %ebp
+  8023d9:	c3                   	ret
+		return -E_INVAL;
+  8023da:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023df:	eb f0                	jmp    8023d1 <fsring_write+0x93>
+
+008023e1 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8023e1:	55                   	push   %ebp
+  8023e2:	89 e5                	mov    %esp,%ebp
+  8023e4:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8023e7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8023ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ed:	e8 17 f8 ff ff       	call   801c09 <fsring_slot>
+  8023f2:	85 c0                	test   %eax,%eax
+  8023f4:	78 4c                	js     802442 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8023f6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8023fb:	89 c1                	mov    %eax,%ecx
+  8023fd:	d3 e2                	shl    %cl,%edx
+  8023ff:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802405:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802408:	c1 e2 02             	shl    $0x2,%edx
+  80240b:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  802411:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  802418:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80241b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80241e:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802421:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802424:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802427:	83 ec 08             	sub    $0x8,%esp
+  80242a:	50                   	push   %eax
+  80242b:	6a 00                	push   $0x0
+  80242d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802432:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802435:	b8 05 00 00 00       	mov    $0x5,%eax
+  80243a:	e8 0c f4 ff ff       	call   80184b <fsring_post>
+  80243f:	83 c4 10             	add    $0x10,%esp
+}
+  802442:	c9                   	leave
+  802443:	c3                   	ret
+
+00802444 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802444:	55                   	push   %ebp
+  802445:	89 e5                	mov    %esp,%ebp
+  802447:	57                   	push   %edi
+  802448:	56                   	push   %esi
+  802449:	53                   	push   %ebx
+  80244a:	83 ec 1c             	sub    $0x1c,%esp
+  80244d:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802451:	a1 00 50 80 00       	mov    0x805000,%eax
+  802456:	8b 40 48             	mov    0x48(%eax),%eax
+  802459:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  80245f:	74 12                	je     802473 <fsring_reap+0x2f>
+		return 0;
+  802461:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802466:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802469:	5b                   	pop    %ebx
+  80246a:	5e                   	pop    %esi
+  80246b:	5f                   	pop    %edi
+  80246c:	5d                   	pop    %ebp
+  80246d:	c3                   	ret
+		sys_yield();
+  80246e:	e8 01 e7 ff ff       	call   800b74 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802473:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802479:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80247e:	39 c2                	cmp    %eax,%edx
+  802480:	75 18                	jne    80249a <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802482:	84 db                	test   %bl,%bl
+  802484:	0f 84 21 01 00 00    	je     8025ab <fsring_reap+0x167>
+  80248a:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  802491:	75 db                	jne    80246e <fsring_reap+0x2a>
+			return 0;
+  802493:	b8 00 00 00 00       	mov    $0x0,%eax
+  802498:	eb cc                	jmp    802466 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  80249a:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80249f:	83 e0 0f             	and    $0xf,%eax
+  8024a2:	83 c0 2a             	add    $0x2a,%eax
+  8024a5:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8024ac:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8024b3:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8024b8:	83 c0 01             	add    $0x1,%eax
+  8024bb:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8024c0:	83 fb 0f             	cmp    $0xf,%ebx
+  8024c3:	77 5b                	ja     802520 <fsring_reap+0xdc>
+  8024c5:	be 01 00 00 00       	mov    $0x1,%esi
+  8024ca:	89 d9                	mov    %ebx,%ecx
+  8024cc:	d3 e6                	shl    %cl,%esi
+  8024ce:	89 f0                	mov    %esi,%eax
+  8024d0:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8024d6:	74 48                	je     802520 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8024d8:	89 d8                	mov    %ebx,%eax
+  8024da:	c1 e0 0c             	shl    $0xc,%eax
+  8024dd:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8024e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8024e6:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8024e9:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  8024f0:	83 f8 03             	cmp    $0x3,%eax
+  8024f3:	74 40                	je     802535 <fsring_reap+0xf1>
+  8024f5:	83 f8 05             	cmp    $0x5,%eax
+  8024f8:	74 64                	je     80255e <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8024fa:	f7 d6                	not    %esi
+  8024fc:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802502:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802505:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  80250c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250f:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802511:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802514:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802516:	b8 01 00 00 00       	mov    $0x1,%eax
+  80251b:	e9 46 ff ff ff       	jmp    802466 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802520:	53                   	push   %ebx
+  802521:	68 3c 3c 80 00       	push   $0x803c3c
+  802526:	68 8f 02 00 00       	push   $0x28f
+  80252b:	68 14 3c 80 00       	push   $0x803c14
+  802530:	e8 fd 0b 00 00       	call   803132 <_panic>
+		if (cqe.cqe_result > 0)
+  802535:	85 ff                	test   %edi,%edi
+  802537:	7e c1                	jle    8024fa <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802539:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80253c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802541:	39 c7                	cmp    %eax,%edi
+  802543:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802546:	50                   	push   %eax
+  802547:	ff 75 e4             	push   -0x1c(%ebp)
+  80254a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80254d:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  802554:	e8 b4 e3 ff ff       	call   80090d <memmove>
+  802559:	83 c4 10             	add    $0x10,%esp
+  80255c:	eb 9c                	jmp    8024fa <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80255e:	85 ff                	test   %edi,%edi
+  802560:	75 98                	jne    8024fa <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802562:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802565:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80256c:	83 ec 08             	sub    $0x8,%esp
+  80256f:	ff 75 e4             	push   -0x1c(%ebp)
+  802572:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802575:	51                   	push   %ecx
+  802576:	e8 0c e2 ff ff       	call   800787 <strcpy>
+			st->st_size = ret->ret_size;
+  80257b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80257e:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802584:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802587:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80258d:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802593:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802599:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8025a0:	40 80 00 
+  8025a3:	83 c4 10             	add    $0x10,%esp
+  8025a6:	e9 4f ff ff ff       	jmp    8024fa <fsring_reap+0xb6>
+			return 0;
+  8025ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b0:	e9 b1 fe ff ff       	jmp    802466 <fsring_reap+0x22>
+
+008025b5 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8025b5:	55                   	push   %ebp
+  8025b6:	89 e5                	mov    %esp,%ebp
+  8025b8:	57                   	push   %edi
+  8025b9:	56                   	push   %esi
+  8025ba:	53                   	push   %ebx
+  8025bb:	83 ec 28             	sub    $0x28,%esp
+  8025be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8025c1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8025c4:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8025c7:	53                   	push   %ebx
+  8025c8:	e8 7f e1 ff ff       	call   80074c <strlen>
+  8025cd:	83 c4 10             	add    $0x10,%esp
+  8025d0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025d5:	0f 8f 02 01 00 00    	jg     8026dd <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8025db:	83 ec 08             	sub    $0x8,%esp
+  8025de:	53                   	push   %ebx
+  8025df:	68 00 60 80 00       	push   $0x806000
+  8025e4:	e8 9e e1 ff ff       	call   800787 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8025e9:	83 c4 10             	add    $0x10,%esp
+  8025ec:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8025f2:	76 69                	jbe    80265d <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8025f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025f7:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8025fd:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802602:	29 d1                	sub    %edx,%ecx
+  802604:	39 f9                	cmp    %edi,%ecx
+  802606:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802609:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80260c:	89 f9                	mov    %edi,%ecx
+  80260e:	01 c1                	add    %eax,%ecx
+  802610:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802613:	eb 0f                	jmp    802624 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802615:	0f b6 10             	movzbl (%eax),%edx
+  802618:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80261a:	05 00 10 00 00       	add    $0x1000,%eax
+  80261f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802624:	39 c8                	cmp    %ecx,%eax
+  802626:	72 ed                	jb     802615 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802628:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80262b:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802631:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802637:	83 ec 0c             	sub    $0xc,%esp
+  80263a:	6a 07                	push   $0x7
+  80263c:	89 f9                	mov    %edi,%ecx
+  80263e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802641:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802646:	e8 3f f1 ff ff       	call   80178a <fsipc_pages>
+  80264b:	89 c7                	mov    %eax,%edi
+  80264d:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802650:	85 f6                	test   %esi,%esi
+  802652:	74 7f                	je     8026d3 <file_slurp+0x11e>
+  802654:	8d 43 01             	lea    0x1(%ebx),%eax
+  802657:	85 ff                	test   %edi,%edi
+  802659:	79 3c                	jns    802697 <file_slurp+0xe2>
+  80265b:	eb 76                	jmp    8026d3 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  80265d:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802663:	ba 00 00 00 00       	mov    $0x0,%edx
+  802668:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80266d:	e8 ba f2 ff ff       	call   80192c <fsipc>
+  802672:	89 c7                	mov    %eax,%edi
+  802674:	85 c0                	test   %eax,%eax
+  802676:	7e d8                	jle    802650 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802678:	83 ec 04             	sub    $0x4,%esp
+  80267b:	50                   	push   %eax
+  80267c:	68 08 60 80 00       	push   $0x806008
+  802681:	ff 75 0c             	push   0xc(%ebp)
+  802684:	e8 84 e2 ff ff       	call   80090d <memmove>
+  802689:	83 c4 10             	add    $0x10,%esp
+  80268c:	eb c2                	jmp    802650 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  80268e:	80 fa 2f             	cmp    $0x2f,%dl
+  802691:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802694:	83 c0 01             	add    $0x1,%eax
+  802697:	89 c1                	mov    %eax,%ecx
+  802699:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  80269d:	84 d2                	test   %dl,%dl
+  80269f:	75 ed                	jne    80268e <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8026a1:	83 ec 04             	sub    $0x4,%esp
+  8026a4:	68 80 00 00 00       	push   $0x80
+  8026a9:	53                   	push   %ebx
+  8026aa:	56                   	push   %esi
+  8026ab:	e8 4d e1 ff ff       	call   8007fd <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8026b0:	a1 00 60 80 00       	mov    0x806000,%eax
+  8026b5:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8026bb:	a1 04 60 80 00       	mov    0x806004,%eax
+  8026c0:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8026c6:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  8026cd:	40 80 00 
+  8026d0:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8026d3:	89 f8                	mov    %edi,%eax
+  8026d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026d8:	5b                   	pop    %ebx
+  8026d9:	5e                   	pop    %esi
+  8026da:	5f                   	pop    %edi
+  8026db:	5d                   	pop    %ebp
+  8026dc:	c3                   	ret
+		return -E_BAD_PATH;
+  8026dd:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8026e2:	eb ef                	jmp    8026d3 <file_slurp+0x11e>
+
+008026e4 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8026e4:	55                   	push   %ebp
+  8026e5:	89 e5                	mov    %esp,%ebp
+  8026e7:	53                   	push   %ebx
+  8026e8:	83 ec 10             	sub    $0x10,%esp
+  8026eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8026ee:	53                   	push   %ebx
+  8026ef:	e8 58 e0 ff ff       	call   80074c <strlen>
+  8026f4:	83 c4 10             	add    $0x10,%esp
+  8026f7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8026fc:	7f 25                	jg     802723 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8026fe:	83 ec 08             	sub    $0x8,%esp
+  802701:	53                   	push   %ebx
+  802702:	68 00 60 80 00       	push   $0x806000
+  802707:	e8 7b e0 ff ff       	call   800787 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80270c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802711:	b8 07 00 00 00       	mov    $0x7,%eax
+  802716:	e8 11 f2 ff ff       	call   80192c <fsipc>
+  80271b:	83 c4 10             	add    $0x10,%esp
+}
+  80271e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802721:	c9                   	leave
+  802722:	c3                   	ret
+		return -E_BAD_PATH;
+  802723:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802728:	eb f4                	jmp    80271e <remove+0x3a>
+
+0080272a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80272a:	55                   	push   %ebp
+  80272b:	89 e5                	mov    %esp,%ebp
+  80272d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802730:	ba 00 00 00 00       	mov    $0x0,%edx
+  802735:	b8 08 00 00 00       	mov    $0x8,%eax
+  80273a:	e8 ed f1 ff ff       	call   80192c <fsipc>
+}
+  80273f:	c9                   	leave
+  802740:	c3                   	ret
+
+00802741 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802741:	55                   	push   %ebp
+  802742:	89 e5                	mov    %esp,%ebp
+  802744:	57                   	push   %edi
+  802745:	56                   	push   %esi
+  802746:	53                   	push   %ebx
+  802747:	83 ec 18             	sub    $0x18,%esp
+  80274a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80274d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802750:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802753:	57                   	push   %edi
+  802754:	e8 f3 df ff ff       	call   80074c <strlen>
+  802759:	83 c4 10             	add    $0x10,%esp
+  80275c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802761:	7f 4c                	jg     8027af <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802763:	83 ec 08             	sub    $0x8,%esp
+  802766:	57                   	push   %edi
+  802767:	68 00 60 80 00       	push   $0x806000
+  80276c:	e8 16 e0 ff ff       	call   800787 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802771:	ba 00 00 00 00       	mov    $0x0,%edx
+  802776:	b8 10 00 00 00       	mov    $0x10,%eax
+  80277b:	e8 ac f1 ff ff       	call   80192c <fsipc>
+  802780:	83 c4 10             	add    $0x10,%esp
+  802783:	85 c0                	test   %eax,%eax
+  802785:	78 20                	js     8027a7 <defrag+0x66>
+		return r;
+	if (before)
+  802787:	85 f6                	test   %esi,%esi
+  802789:	74 07                	je     802792 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  80278b:	a1 00 60 80 00       	mov    0x806000,%eax
+  802790:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802792:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802797:	85 db                	test   %ebx,%ebx
+  802799:	74 0c                	je     8027a7 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  80279b:	a1 04 60 80 00       	mov    0x806004,%eax
+  8027a0:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8027a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027aa:	5b                   	pop    %ebx
+  8027ab:	5e                   	pop    %esi
+  8027ac:	5f                   	pop    %edi
+  8027ad:	5d                   	pop    %ebp
+  8027ae:	c3                   	ret
+		return -E_BAD_PATH;
+  8027af:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8027b4:	eb f1                	jmp    8027a7 <defrag+0x66>
+
+008027b6 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  8027b6:	55                   	push   %ebp
+  8027b7:	89 e5                	mov    %esp,%ebp
+  8027b9:	53                   	push   %ebx
+  8027ba:	83 ec 04             	sub    $0x4,%esp
+  8027bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  8027c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027c5:	b8 11 00 00 00       	mov    $0x11,%eax
+  8027ca:	e8 5d f1 ff ff       	call   80192c <fsipc>
+  8027cf:	85 c0                	test   %eax,%eax
+  8027d1:	78 34                	js     802807 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  8027d3:	a1 00 60 80 00       	mov    0x806000,%eax
+  8027d8:	89 03                	mov    %eax,(%ebx)
+  8027da:	a1 04 60 80 00       	mov    0x806004,%eax
+  8027df:	89 43 04             	mov    %eax,0x4(%ebx)
+  8027e2:	a1 08 60 80 00       	mov    0x806008,%eax
+  8027e7:	89 43 08             	mov    %eax,0x8(%ebx)
+  8027ea:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  8027ef:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8027f2:	a1 10 60 80 00       	mov    0x806010,%eax
+  8027f7:	89 43 10             	mov    %eax,0x10(%ebx)
+  8027fa:	a1 14 60 80 00       	mov    0x806014,%eax
+  8027ff:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802802:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802807:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80280a:	c9                   	leave
+  80280b:	c3                   	ret
+
+0080280c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80280c:	55                   	push   %ebp
+  80280d:	89 e5                	mov    %esp,%ebp
+  80280f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802812:	68 55 3c 80 00       	push   $0x803c55
+  802817:	ff 75 0c             	push   0xc(%ebp)
+  80281a:	e8 68 df ff ff       	call   800787 <strcpy>
+	return 0;
+}
+  80281f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802824:	c9                   	leave
+  802825:	c3                   	ret
+
+00802826 <devsock_close>:
+{
+  802826:	55                   	push   %ebp
+  802827:	89 e5                	mov    %esp,%ebp
+  802829:	53                   	push   %ebx
+  80282a:	83 ec 10             	sub    $0x10,%esp
+  80282d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802830:	53                   	push   %ebx
+  802831:	e8 57 0c 00 00       	call   80348d <pageref>
+  802836:	89 c2                	mov    %eax,%edx
+  802838:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80283b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802840:	83 fa 01             	cmp    $0x1,%edx
+  802843:	74 05                	je     80284a <devsock_close+0x24>
+}
+  802845:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802848:	c9                   	leave
+  802849:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80284a:	83 ec 0c             	sub    $0xc,%esp
+  80284d:	ff 73 0c             	push   0xc(%ebx)
+  802850:	e8 b7 02 00 00       	call   802b0c <nsipc_close>
+  802855:	83 c4 10             	add    $0x10,%esp
+  802858:	eb eb                	jmp    802845 <devsock_close+0x1f>
+
+0080285a <devsock_write>:
+{
+  80285a:	55                   	push   %ebp
+  80285b:	89 e5                	mov    %esp,%ebp
+  80285d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802860:	6a 00                	push   $0x0
+  802862:	ff 75 10             	push   0x10(%ebp)
+  802865:	ff 75 0c             	push   0xc(%ebp)
+  802868:	8b 45 08             	mov    0x8(%ebp),%eax
+  80286b:	ff 70 0c             	push   0xc(%eax)
+  80286e:	e8 79 03 00 00       	call   802bec <nsipc_send>
+}
+  802873:	c9                   	leave
+  802874:	c3                   	ret
+
+00802875 <devsock_read>:
+{
+  802875:	55                   	push   %ebp
+  802876:	89 e5                	mov    %esp,%ebp
+  802878:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80287b:	6a 00                	push   $0x0
+  80287d:	ff 75 10             	push   0x10(%ebp)
+  802880:	ff 75 0c             	push   0xc(%ebp)
+  802883:	8b 45 08             	mov    0x8(%ebp),%eax
+  802886:	ff 70 0c             	push   0xc(%eax)
+  802889:	e8 ef 02 00 00       	call   802b7d <nsipc_recv>
+}
+  80288e:	c9                   	leave
+  80288f:	c3                   	ret
+
+00802890 <fd2sockid>:
+{
+  802890:	55                   	push   %ebp
+  802891:	89 e5                	mov    %esp,%ebp
+  802893:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802896:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802899:	52                   	push   %edx
+  80289a:	50                   	push   %eax
+  80289b:	e8 54 e9 ff ff       	call   8011f4 <fd_lookup>
+  8028a0:	83 c4 10             	add    $0x10,%esp
+  8028a3:	85 c0                	test   %eax,%eax
+  8028a5:	78 10                	js     8028b7 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8028a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028aa:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  8028b0:	39 08                	cmp    %ecx,(%eax)
+  8028b2:	75 05                	jne    8028b9 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8028b4:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8028b7:	c9                   	leave
+  8028b8:	c3                   	ret
+		return -E_NOT_SUPP;
+  8028b9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028be:	eb f7                	jmp    8028b7 <fd2sockid+0x27>
+
+008028c0 <alloc_sockfd>:
+{
+  8028c0:	55                   	push   %ebp
+  8028c1:	89 e5                	mov    %esp,%ebp
+  8028c3:	56                   	push   %esi
+  8028c4:	53                   	push   %ebx
+  8028c5:	83 ec 1c             	sub    $0x1c,%esp
+  8028c8:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8028ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028cd:	50                   	push   %eax
+  8028ce:	e8 cb e8 ff ff       	call   80119e <fd_alloc>
+  8028d3:	89 c3                	mov    %eax,%ebx
+  8028d5:	83 c4 10             	add    $0x10,%esp
+  8028d8:	85 c0                	test   %eax,%eax
+  8028da:	78 43                	js     80291f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8028dc:	83 ec 04             	sub    $0x4,%esp
+  8028df:	68 07 04 00 00       	push   $0x407
+  8028e4:	ff 75 f4             	push   -0xc(%ebp)
+  8028e7:	6a 00                	push   $0x0
+  8028e9:	e8 a5 e2 ff ff       	call   800b93 <sys_page_alloc>
+  8028ee:	89 c3                	mov    %eax,%ebx
+  8028f0:	83 c4 10             	add    $0x10,%esp
+  8028f3:	85 c0                	test   %eax,%eax
+  8028f5:	78 28                	js     80291f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8028f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028fa:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802900:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802902:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802905:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80290c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80290f:	83 ec 0c             	sub    $0xc,%esp
+  802912:	50                   	push   %eax
+  802913:	e8 5f e8 ff ff       	call   801177 <fd2num>
+  802918:	89 c3                	mov    %eax,%ebx
+  80291a:	83 c4 10             	add    $0x10,%esp
+  80291d:	eb 0c                	jmp    80292b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80291f:	83 ec 0c             	sub    $0xc,%esp
+  802922:	56                   	push   %esi
+  802923:	e8 e4 01 00 00       	call   802b0c <nsipc_close>
+		return r;
+  802928:	83 c4 10             	add    $0x10,%esp
+}
+  80292b:	89 d8                	mov    %ebx,%eax
+  80292d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802930:	5b                   	pop    %ebx
+  802931:	5e                   	pop    %esi
+  802932:	5d                   	pop    %ebp
+  802933:	c3                   	ret
+
+00802934 <accept>:
+{
+  802934:	55                   	push   %ebp
+  802935:	89 e5                	mov    %esp,%ebp
+  802937:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80293a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80293d:	e8 4e ff ff ff       	call   802890 <fd2sockid>
+  802942:	85 c0                	test   %eax,%eax
+  802944:	78 1b                	js     802961 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802946:	83 ec 04             	sub    $0x4,%esp
+  802949:	ff 75 10             	push   0x10(%ebp)
+  80294c:	ff 75 0c             	push   0xc(%ebp)
+  80294f:	50                   	push   %eax
+  802950:	e8 0e 01 00 00       	call   802a63 <nsipc_accept>
+  802955:	83 c4 10             	add    $0x10,%esp
+  802958:	85 c0                	test   %eax,%eax
+  80295a:	78 05                	js     802961 <accept+0x2d>
+	return alloc_sockfd(r);
+  80295c:	e8 5f ff ff ff       	call   8028c0 <alloc_sockfd>
+}
+  802961:	c9                   	leave
+  802962:	c3                   	ret
+
+00802963 <bind>:
+{
+  802963:	55                   	push   %ebp
+  802964:	89 e5                	mov    %esp,%ebp
+  802966:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802969:	8b 45 08             	mov    0x8(%ebp),%eax
+  80296c:	e8 1f ff ff ff       	call   802890 <fd2sockid>
+  802971:	85 c0                	test   %eax,%eax
+  802973:	78 12                	js     802987 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802975:	83 ec 04             	sub    $0x4,%esp
+  802978:	ff 75 10             	push   0x10(%ebp)
+  80297b:	ff 75 0c             	push   0xc(%ebp)
+  80297e:	50                   	push   %eax
+  80297f:	e8 31 01 00 00       	call   802ab5 <nsipc_bind>
+  802984:	83 c4 10             	add    $0x10,%esp
+}
+  802987:	c9                   	leave
+  802988:	c3                   	ret
+
+00802989 <shutdown>:
+{
+  802989:	55                   	push   %ebp
+  80298a:	89 e5                	mov    %esp,%ebp
+  80298c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80298f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802992:	e8 f9 fe ff ff       	call   802890 <fd2sockid>
+  802997:	85 c0                	test   %eax,%eax
+  802999:	78 0f                	js     8029aa <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80299b:	83 ec 08             	sub    $0x8,%esp
+  80299e:	ff 75 0c             	push   0xc(%ebp)
+  8029a1:	50                   	push   %eax
+  8029a2:	e8 43 01 00 00       	call   802aea <nsipc_shutdown>
+  8029a7:	83 c4 10             	add    $0x10,%esp
+}
+  8029aa:	c9                   	leave
+  8029ab:	c3                   	ret
+
+008029ac <connect>:
+{
+  8029ac:	55                   	push   %ebp
+  8029ad:	89 e5                	mov    %esp,%ebp
+  8029af:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b5:	e8 d6 fe ff ff       	call   802890 <fd2sockid>
+  8029ba:	85 c0                	test   %eax,%eax
+  8029bc:	78 12                	js     8029d0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8029be:	83 ec 04             	sub    $0x4,%esp
+  8029c1:	ff 75 10             	push   0x10(%ebp)
+  8029c4:	ff 75 0c             	push   0xc(%ebp)
+  8029c7:	50                   	push   %eax
+  8029c8:	e8 59 01 00 00       	call   802b26 <nsipc_connect>
+  8029cd:	83 c4 10             	add    $0x10,%esp
+}
+  8029d0:	c9                   	leave
+  8029d1:	c3                   	ret
+
+008029d2 <listen>:
+{
+  8029d2:	55                   	push   %ebp
+  8029d3:	89 e5                	mov    %esp,%ebp
+  8029d5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029db:	e8 b0 fe ff ff       	call   802890 <fd2sockid>
+  8029e0:	85 c0                	test   %eax,%eax
+  8029e2:	78 0f                	js     8029f3 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8029e4:	83 ec 08             	sub    $0x8,%esp
+  8029e7:	ff 75 0c             	push   0xc(%ebp)
+  8029ea:	50                   	push   %eax
+  8029eb:	e8 6b 01 00 00       	call   802b5b <nsipc_listen>
+  8029f0:	83 c4 10             	add    $0x10,%esp
+}
+  8029f3:	c9                   	leave
+  8029f4:	c3                   	ret
+
+008029f5 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8029f5:	55                   	push   %ebp
+  8029f6:	89 e5                	mov    %esp,%ebp
+  8029f8:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8029fb:	ff 75 10             	push   0x10(%ebp)
+  8029fe:	ff 75 0c             	push   0xc(%ebp)
+  802a01:	ff 75 08             	push   0x8(%ebp)
+  802a04:	e8 41 02 00 00       	call   802c4a <nsipc_socket>
+  802a09:	83 c4 10             	add    $0x10,%esp
+  802a0c:	85 c0                	test   %eax,%eax
+  802a0e:	78 05                	js     802a15 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802a10:	e8 ab fe ff ff       	call   8028c0 <alloc_sockfd>
+}
+  802a15:	c9                   	leave
+  802a16:	c3                   	ret
+
+00802a17 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a17:	55                   	push   %ebp
+  802a18:	89 e5                	mov    %esp,%ebp
+  802a1a:	53                   	push   %ebx
+  802a1b:	83 ec 04             	sub    $0x4,%esp
+  802a1e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802a20:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802a27:	74 26                	je     802a4f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802a29:	6a 07                	push   $0x7
+  802a2b:	68 00 80 80 00       	push   $0x808000
+  802a30:	53                   	push   %ebx
+  802a31:	ff 35 00 90 80 00    	push   0x809000
+  802a37:	e8 c3 e5 ff ff       	call   800fff <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802a3c:	83 c4 0c             	add    $0xc,%esp
+  802a3f:	6a 00                	push   $0x0
+  802a41:	6a 00                	push   $0x0
+  802a43:	6a 00                	push   $0x0
+  802a45:	e8 4a e5 ff ff       	call   800f94 <ipc_recv>
+}
+  802a4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a4d:	c9                   	leave
+  802a4e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a4f:	83 ec 0c             	sub    $0xc,%esp
+  802a52:	6a 02                	push   $0x2
+  802a54:	e8 df e6 ff ff       	call   801138 <ipc_find_env>
+  802a59:	a3 00 90 80 00       	mov    %eax,0x809000
+  802a5e:	83 c4 10             	add    $0x10,%esp
+  802a61:	eb c6                	jmp    802a29 <nsipc+0x12>
+
+00802a63 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802a63:	55                   	push   %ebp
+  802a64:	89 e5                	mov    %esp,%ebp
+  802a66:	56                   	push   %esi
+  802a67:	53                   	push   %ebx
+  802a68:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802a6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a6e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802a73:	8b 06                	mov    (%esi),%eax
+  802a75:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802a7a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a7f:	e8 93 ff ff ff       	call   802a17 <nsipc>
+  802a84:	89 c3                	mov    %eax,%ebx
+  802a86:	85 c0                	test   %eax,%eax
+  802a88:	79 09                	jns    802a93 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802a8a:	89 d8                	mov    %ebx,%eax
+  802a8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a8f:	5b                   	pop    %ebx
+  802a90:	5e                   	pop    %esi
+  802a91:	5d                   	pop    %ebp
+  802a92:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a93:	83 ec 04             	sub    $0x4,%esp
+  802a96:	ff 35 10 80 80 00    	push   0x808010
+  802a9c:	68 00 80 80 00       	push   $0x808000
+  802aa1:	ff 75 0c             	push   0xc(%ebp)
+  802aa4:	e8 64 de ff ff       	call   80090d <memmove>
+		*addrlen = ret->ret_addrlen;
+  802aa9:	a1 10 80 80 00       	mov    0x808010,%eax
+  802aae:	89 06                	mov    %eax,(%esi)
+  802ab0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802ab3:	eb d5                	jmp    802a8a <nsipc_accept+0x27>
+
+00802ab5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802ab5:	55                   	push   %ebp
+  802ab6:	89 e5                	mov    %esp,%ebp
+  802ab8:	53                   	push   %ebx
+  802ab9:	83 ec 08             	sub    $0x8,%esp
+  802abc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802abf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac2:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802ac7:	53                   	push   %ebx
+  802ac8:	ff 75 0c             	push   0xc(%ebp)
+  802acb:	68 04 80 80 00       	push   $0x808004
+  802ad0:	e8 38 de ff ff       	call   80090d <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802ad5:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802adb:	b8 02 00 00 00       	mov    $0x2,%eax
+  802ae0:	e8 32 ff ff ff       	call   802a17 <nsipc>
+}
+  802ae5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ae8:	c9                   	leave
+  802ae9:	c3                   	ret
+
+00802aea <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802aea:	55                   	push   %ebp
+  802aeb:	89 e5                	mov    %esp,%ebp
+  802aed:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802af0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802af8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802afb:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802b00:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b05:	e8 0d ff ff ff       	call   802a17 <nsipc>
+}
+  802b0a:	c9                   	leave
+  802b0b:	c3                   	ret
+
+00802b0c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802b0c:	55                   	push   %ebp
+  802b0d:	89 e5                	mov    %esp,%ebp
+  802b0f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802b12:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b15:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802b1a:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b1f:	e8 f3 fe ff ff       	call   802a17 <nsipc>
+}
+  802b24:	c9                   	leave
+  802b25:	c3                   	ret
+
+00802b26 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802b26:	55                   	push   %ebp
+  802b27:	89 e5                	mov    %esp,%ebp
+  802b29:	53                   	push   %ebx
+  802b2a:	83 ec 08             	sub    $0x8,%esp
+  802b2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802b30:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b33:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802b38:	53                   	push   %ebx
+  802b39:	ff 75 0c             	push   0xc(%ebp)
+  802b3c:	68 04 80 80 00       	push   $0x808004
+  802b41:	e8 c7 dd ff ff       	call   80090d <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802b46:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802b4c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802b51:	e8 c1 fe ff ff       	call   802a17 <nsipc>
+}
+  802b56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b59:	c9                   	leave
+  802b5a:	c3                   	ret
+
+00802b5b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802b5b:	55                   	push   %ebp
+  802b5c:	89 e5                	mov    %esp,%ebp
+  802b5e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802b61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b64:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802b69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b6c:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802b71:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b76:	e8 9c fe ff ff       	call   802a17 <nsipc>
+}
+  802b7b:	c9                   	leave
+  802b7c:	c3                   	ret
+
+00802b7d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802b7d:	55                   	push   %ebp
+  802b7e:	89 e5                	mov    %esp,%ebp
+  802b80:	56                   	push   %esi
+  802b81:	53                   	push   %ebx
+  802b82:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802b85:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b88:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802b8d:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802b93:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b96:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b9b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ba0:	e8 72 fe ff ff       	call   802a17 <nsipc>
+  802ba5:	89 c3                	mov    %eax,%ebx
+  802ba7:	85 c0                	test   %eax,%eax
+  802ba9:	78 22                	js     802bcd <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802bab:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802bb0:	39 c6                	cmp    %eax,%esi
+  802bb2:	0f 4e c6             	cmovle %esi,%eax
+  802bb5:	39 c3                	cmp    %eax,%ebx
+  802bb7:	7f 1d                	jg     802bd6 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802bb9:	83 ec 04             	sub    $0x4,%esp
+  802bbc:	53                   	push   %ebx
+  802bbd:	68 00 80 80 00       	push   $0x808000
+  802bc2:	ff 75 0c             	push   0xc(%ebp)
+  802bc5:	e8 43 dd ff ff       	call   80090d <memmove>
+  802bca:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802bcd:	89 d8                	mov    %ebx,%eax
+  802bcf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bd2:	5b                   	pop    %ebx
+  802bd3:	5e                   	pop    %esi
+  802bd4:	5d                   	pop    %ebp
+  802bd5:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802bd6:	68 61 3c 80 00       	push   $0x803c61
+  802bdb:	68 47 3b 80 00       	push   $0x803b47
+  802be0:	6a 62                	push   $0x62
+  802be2:	68 76 3c 80 00       	push   $0x803c76
+  802be7:	e8 46 05 00 00       	call   803132 <_panic>
+
+00802bec <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802bec:	55                   	push   %ebp
+  802bed:	89 e5                	mov    %esp,%ebp
+  802bef:	53                   	push   %ebx
+  802bf0:	83 ec 04             	sub    $0x4,%esp
+  802bf3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802bf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf9:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802bfe:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802c04:	7f 2e                	jg     802c34 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802c06:	83 ec 04             	sub    $0x4,%esp
+  802c09:	53                   	push   %ebx
+  802c0a:	ff 75 0c             	push   0xc(%ebp)
+  802c0d:	68 0c 80 80 00       	push   $0x80800c
+  802c12:	e8 f6 dc ff ff       	call   80090d <memmove>
+	nsipcbuf.send.req_size = size;
+  802c17:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802c1d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c20:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802c25:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c2a:	e8 e8 fd ff ff       	call   802a17 <nsipc>
+}
+  802c2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c32:	c9                   	leave
+  802c33:	c3                   	ret
+	assert(size < 1600);
+  802c34:	68 82 3c 80 00       	push   $0x803c82
+  802c39:	68 47 3b 80 00       	push   $0x803b47
+  802c3e:	6a 6d                	push   $0x6d
+  802c40:	68 76 3c 80 00       	push   $0x803c76
+  802c45:	e8 e8 04 00 00       	call   803132 <_panic>
+
+00802c4a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802c4a:	55                   	push   %ebp
+  802c4b:	89 e5                	mov    %esp,%ebp
+  802c4d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802c50:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c53:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802c58:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c5b:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802c60:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c63:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802c68:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c6d:	e8 a5 fd ff ff       	call   802a17 <nsipc>
+}
+  802c72:	c9                   	leave
+  802c73:	c3                   	ret
+
+00802c74 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c74:	55                   	push   %ebp
+  802c75:	89 e5                	mov    %esp,%ebp
+  802c77:	56                   	push   %esi
+  802c78:	53                   	push   %ebx
+  802c79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802c7c:	83 ec 0c             	sub    $0xc,%esp
+  802c7f:	ff 75 08             	push   0x8(%ebp)
+  802c82:	e8 00 e5 ff ff       	call   801187 <fd2data>
+  802c87:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802c89:	83 c4 08             	add    $0x8,%esp
+  802c8c:	68 8e 3c 80 00       	push   $0x803c8e
+  802c91:	53                   	push   %ebx
+  802c92:	e8 f0 da ff ff       	call   800787 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802c97:	8b 46 04             	mov    0x4(%esi),%eax
+  802c9a:	2b 06                	sub    (%esi),%eax
+  802c9c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802ca2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802ca9:	00 00 00 
+	stat->st_dev = &devpipe;
+  802cac:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802cb3:	40 80 00 
+	return 0;
+}
+  802cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cbe:	5b                   	pop    %ebx
+  802cbf:	5e                   	pop    %esi
+  802cc0:	5d                   	pop    %ebp
+  802cc1:	c3                   	ret
+
+00802cc2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802cc2:	55                   	push   %ebp
+  802cc3:	89 e5                	mov    %esp,%ebp
+  802cc5:	53                   	push   %ebx
+  802cc6:	83 ec 0c             	sub    $0xc,%esp
+  802cc9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802ccc:	53                   	push   %ebx
+  802ccd:	6a 00                	push   $0x0
+  802ccf:	e8 4c df ff ff       	call   800c20 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802cd4:	89 1c 24             	mov    %ebx,(%esp)
+  802cd7:	e8 ab e4 ff ff       	call   801187 <fd2data>
+  802cdc:	83 c4 08             	add    $0x8,%esp
+  802cdf:	50                   	push   %eax
+  802ce0:	6a 00                	push   $0x0
+  802ce2:	e8 39 df ff ff       	call   800c20 <sys_page_unmap>
+}
+  802ce7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cea:	c9                   	leave
+  802ceb:	c3                   	ret
+
+00802cec <_pipeisclosed>:
+{
+  802cec:	55                   	push   %ebp
+  802ced:	89 e5                	mov    %esp,%ebp
+  802cef:	57                   	push   %edi
+  802cf0:	56                   	push   %esi
+  802cf1:	53                   	push   %ebx
+  802cf2:	83 ec 1c             	sub    $0x1c,%esp
+  802cf5:	89 c7                	mov    %eax,%edi
+  802cf7:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802cf9:	a1 00 50 80 00       	mov    0x805000,%eax
+  802cfe:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802d01:	83 ec 0c             	sub    $0xc,%esp
+  802d04:	57                   	push   %edi
+  802d05:	e8 83 07 00 00       	call   80348d <pageref>
+  802d0a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d0d:	89 34 24             	mov    %esi,(%esp)
+  802d10:	e8 78 07 00 00       	call   80348d <pageref>
+		nn = thisenv->env_runs;
+  802d15:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802d1b:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802d1e:	83 c4 10             	add    $0x10,%esp
+  802d21:	39 cb                	cmp    %ecx,%ebx
+  802d23:	74 1b                	je     802d40 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802d25:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d28:	75 cf                	jne    802cf9 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802d2a:	8b 42 58             	mov    0x58(%edx),%eax
+  802d2d:	6a 01                	push   $0x1
+  802d2f:	50                   	push   %eax
+  802d30:	53                   	push   %ebx
+  802d31:	68 95 3c 80 00       	push   $0x803c95
+  802d36:	e8 5e d4 ff ff       	call   800199 <cprintf>
+  802d3b:	83 c4 10             	add    $0x10,%esp
+  802d3e:	eb b9                	jmp    802cf9 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802d40:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d43:	0f 94 c0             	sete   %al
+  802d46:	0f b6 c0             	movzbl %al,%eax
+}
+  802d49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d4c:	5b                   	pop    %ebx
+  802d4d:	5e                   	pop    %esi
+  802d4e:	5f                   	pop    %edi
+  802d4f:	5d                   	pop    %ebp
+  802d50:	c3                   	ret
+
+00802d51 <devpipe_write>:
+{
+  802d51:	55                   	push   %ebp
+  802d52:	89 e5                	mov    %esp,%ebp
+  802d54:	57                   	push   %edi
+  802d55:	56                   	push   %esi
+  802d56:	53                   	push   %ebx
+  802d57:	83 ec 28             	sub    $0x28,%esp
+  802d5a:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802d5d:	56                   	push   %esi
+  802d5e:	e8 24 e4 ff ff       	call   801187 <fd2data>
+  802d63:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802d65:	83 c4 10             	add    $0x10,%esp
+  802d68:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d6d:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802d70:	75 09                	jne    802d7b <devpipe_write+0x2a>
+	return i;
+  802d72:	89 f8                	mov    %edi,%eax
+  802d74:	eb 23                	jmp    802d99 <devpipe_write+0x48>
+			sys_yield();
+  802d76:	e8 f9 dd ff ff       	call   800b74 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802d7b:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d7e:	8b 0b                	mov    (%ebx),%ecx
+  802d80:	8d 51 20             	lea    0x20(%ecx),%edx
+  802d83:	39 d0                	cmp    %edx,%eax
+  802d85:	72 1a                	jb     802da1 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802d87:	89 da                	mov    %ebx,%edx
+  802d89:	89 f0                	mov    %esi,%eax
+  802d8b:	e8 5c ff ff ff       	call   802cec <_pipeisclosed>
+  802d90:	85 c0                	test   %eax,%eax
+  802d92:	74 e2                	je     802d76 <devpipe_write+0x25>
+				return 0;
+  802d94:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d9c:	5b                   	pop    %ebx
+  802d9d:	5e                   	pop    %esi
+  802d9e:	5f                   	pop    %edi
+  802d9f:	5d                   	pop    %ebp
+  802da0:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802da1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802da4:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802da8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802dab:	89 c2                	mov    %eax,%edx
+  802dad:	c1 fa 1f             	sar    $0x1f,%edx
+  802db0:	89 d1                	mov    %edx,%ecx
+  802db2:	c1 e9 1b             	shr    $0x1b,%ecx
+  802db5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802db8:	83 e2 1f             	and    $0x1f,%edx
+  802dbb:	29 ca                	sub    %ecx,%edx
+  802dbd:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802dc1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802dc5:	83 c0 01             	add    $0x1,%eax
+  802dc8:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802dcb:	83 c7 01             	add    $0x1,%edi
+  802dce:	eb 9d                	jmp    802d6d <devpipe_write+0x1c>
+
+00802dd0 <devpipe_read>:
+{
+  802dd0:	55                   	push   %ebp
+  802dd1:	89 e5                	mov    %esp,%ebp
+  802dd3:	57                   	push   %edi
+  802dd4:	56                   	push   %esi
+  802dd5:	53                   	push   %ebx
+  802dd6:	83 ec 18             	sub    $0x18,%esp
+  802dd9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802ddc:	57                   	push   %edi
+  802ddd:	e8 a5 e3 ff ff       	call   801187 <fd2data>
+  802de2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802de4:	83 c4 10             	add    $0x10,%esp
+  802de7:	be 00 00 00 00       	mov    $0x0,%esi
+  802dec:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802def:	75 13                	jne    802e04 <devpipe_read+0x34>
+	return i;
+  802df1:	89 f0                	mov    %esi,%eax
+  802df3:	eb 02                	jmp    802df7 <devpipe_read+0x27>
+				return i;
+  802df5:	89 f0                	mov    %esi,%eax
+}
+  802df7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dfa:	5b                   	pop    %ebx
+  802dfb:	5e                   	pop    %esi
+  802dfc:	5f                   	pop    %edi
+  802dfd:	5d                   	pop    %ebp
+  802dfe:	c3                   	ret
+			sys_yield();
+  802dff:	e8 70 dd ff ff       	call   800b74 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802e04:	8b 03                	mov    (%ebx),%eax
+  802e06:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802e09:	75 18                	jne    802e23 <devpipe_read+0x53>
+			if (i > 0)
+  802e0b:	85 f6                	test   %esi,%esi
+  802e0d:	75 e6                	jne    802df5 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802e0f:	89 da                	mov    %ebx,%edx
+  802e11:	89 f8                	mov    %edi,%eax
+  802e13:	e8 d4 fe ff ff       	call   802cec <_pipeisclosed>
+  802e18:	85 c0                	test   %eax,%eax
+  802e1a:	74 e3                	je     802dff <devpipe_read+0x2f>
+				return 0;
+  802e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e21:	eb d4                	jmp    802df7 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802e23:	99                   	cltd
+  802e24:	c1 ea 1b             	shr    $0x1b,%edx
+  802e27:	01 d0                	add    %edx,%eax
+  802e29:	83 e0 1f             	and    $0x1f,%eax
+  802e2c:	29 d0                	sub    %edx,%eax
+  802e2e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802e33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e36:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802e39:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802e3c:	83 c6 01             	add    $0x1,%esi
+  802e3f:	eb ab                	jmp    802dec <devpipe_read+0x1c>
+
+00802e41 <pipe>:
+{
+  802e41:	55                   	push   %ebp
+  802e42:	89 e5                	mov    %esp,%ebp
+  802e44:	56                   	push   %esi
+  802e45:	53                   	push   %ebx
+  802e46:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802e49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e4c:	50                   	push   %eax
+  802e4d:	e8 4c e3 ff ff       	call   80119e <fd_alloc>
+  802e52:	89 c3                	mov    %eax,%ebx
+  802e54:	83 c4 10             	add    $0x10,%esp
+  802e57:	85 c0                	test   %eax,%eax
+  802e59:	0f 88 23 01 00 00    	js     802f82 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e5f:	83 ec 04             	sub    $0x4,%esp
+  802e62:	68 07 04 00 00       	push   $0x407
+  802e67:	ff 75 f4             	push   -0xc(%ebp)
+  802e6a:	6a 00                	push   $0x0
+  802e6c:	e8 22 dd ff ff       	call   800b93 <sys_page_alloc>
+  802e71:	89 c3                	mov    %eax,%ebx
+  802e73:	83 c4 10             	add    $0x10,%esp
+  802e76:	85 c0                	test   %eax,%eax
+  802e78:	0f 88 04 01 00 00    	js     802f82 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802e7e:	83 ec 0c             	sub    $0xc,%esp
+  802e81:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802e84:	50                   	push   %eax
+  802e85:	e8 14 e3 ff ff       	call   80119e <fd_alloc>
+  802e8a:	89 c3                	mov    %eax,%ebx
+  802e8c:	83 c4 10             	add    $0x10,%esp
+  802e8f:	85 c0                	test   %eax,%eax
+  802e91:	0f 88 db 00 00 00    	js     802f72 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e97:	83 ec 04             	sub    $0x4,%esp
+  802e9a:	68 07 04 00 00       	push   $0x407
+  802e9f:	ff 75 f0             	push   -0x10(%ebp)
+  802ea2:	6a 00                	push   $0x0
+  802ea4:	e8 ea dc ff ff       	call   800b93 <sys_page_alloc>
+  802ea9:	89 c3                	mov    %eax,%ebx
+  802eab:	83 c4 10             	add    $0x10,%esp
+  802eae:	85 c0                	test   %eax,%eax
+  802eb0:	0f 88 bc 00 00 00    	js     802f72 <pipe+0x131>
+	va = fd2data(fd0);
+  802eb6:	83 ec 0c             	sub    $0xc,%esp
+  802eb9:	ff 75 f4             	push   -0xc(%ebp)
+  802ebc:	e8 c6 e2 ff ff       	call   801187 <fd2data>
+  802ec1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ec3:	83 c4 0c             	add    $0xc,%esp
+  802ec6:	68 07 04 00 00       	push   $0x407
+  802ecb:	50                   	push   %eax
+  802ecc:	6a 00                	push   $0x0
+  802ece:	e8 c0 dc ff ff       	call   800b93 <sys_page_alloc>
+  802ed3:	89 c3                	mov    %eax,%ebx
+  802ed5:	83 c4 10             	add    $0x10,%esp
+  802ed8:	85 c0                	test   %eax,%eax
+  802eda:	0f 88 82 00 00 00    	js     802f62 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ee0:	83 ec 0c             	sub    $0xc,%esp
+  802ee3:	ff 75 f0             	push   -0x10(%ebp)
+  802ee6:	e8 9c e2 ff ff       	call   801187 <fd2data>
+  802eeb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802ef2:	50                   	push   %eax
+  802ef3:	6a 00                	push   $0x0
+  802ef5:	56                   	push   %esi
+  802ef6:	6a 00                	push   $0x0
+  802ef8:	e8 e1 dc ff ff       	call   800bde <sys_page_map>
+  802efd:	89 c3                	mov    %eax,%ebx
+  802eff:	83 c4 20             	add    $0x20,%esp
+  802f02:	85 c0                	test   %eax,%eax
+  802f04:	78 4e                	js     802f54 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802f06:	a1 60 40 80 00       	mov    0x804060,%eax
+  802f0b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f0e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802f10:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f13:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802f1a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802f1d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802f1f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802f22:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802f29:	83 ec 0c             	sub    $0xc,%esp
+  802f2c:	ff 75 f4             	push   -0xc(%ebp)
+  802f2f:	e8 43 e2 ff ff       	call   801177 <fd2num>
+  802f34:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f37:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802f39:	83 c4 04             	add    $0x4,%esp
+  802f3c:	ff 75 f0             	push   -0x10(%ebp)
+  802f3f:	e8 33 e2 ff ff       	call   801177 <fd2num>
+  802f44:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f47:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802f4a:	83 c4 10             	add    $0x10,%esp
+  802f4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f52:	eb 2e                	jmp    802f82 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802f54:	83 ec 08             	sub    $0x8,%esp
+  802f57:	56                   	push   %esi
+  802f58:	6a 00                	push   $0x0
+  802f5a:	e8 c1 dc ff ff       	call   800c20 <sys_page_unmap>
+  802f5f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802f62:	83 ec 08             	sub    $0x8,%esp
+  802f65:	ff 75 f0             	push   -0x10(%ebp)
+  802f68:	6a 00                	push   $0x0
+  802f6a:	e8 b1 dc ff ff       	call   800c20 <sys_page_unmap>
+  802f6f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802f72:	83 ec 08             	sub    $0x8,%esp
+  802f75:	ff 75 f4             	push   -0xc(%ebp)
+  802f78:	6a 00                	push   $0x0
+  802f7a:	e8 a1 dc ff ff       	call   800c20 <sys_page_unmap>
+  802f7f:	83 c4 10             	add    $0x10,%esp
+}
+  802f82:	89 d8                	mov    %ebx,%eax
+  802f84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f87:	5b                   	pop    %ebx
+  802f88:	5e                   	pop    %esi
+  802f89:	5d                   	pop    %ebp
+  802f8a:	c3                   	ret
+
+00802f8b <pipeisclosed>:
+{
+  802f8b:	55                   	push   %ebp
+  802f8c:	89 e5                	mov    %esp,%ebp
+  802f8e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f91:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f94:	50                   	push   %eax
+  802f95:	ff 75 08             	push   0x8(%ebp)
+  802f98:	e8 57 e2 ff ff       	call   8011f4 <fd_lookup>
+  802f9d:	83 c4 10             	add    $0x10,%esp
+  802fa0:	85 c0                	test   %eax,%eax
+  802fa2:	78 18                	js     802fbc <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802fa4:	83 ec 0c             	sub    $0xc,%esp
+  802fa7:	ff 75 f4             	push   -0xc(%ebp)
+  802faa:	e8 d8 e1 ff ff       	call   801187 <fd2data>
+  802faf:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802fb1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fb4:	e8 33 fd ff ff       	call   802cec <_pipeisclosed>
+  802fb9:	83 c4 10             	add    $0x10,%esp
+}
+  802fbc:	c9                   	leave
+  802fbd:	c3                   	ret
+
+00802fbe <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc3:	c3                   	ret
+
+00802fc4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802fc4:	55                   	push   %ebp
+  802fc5:	89 e5                	mov    %esp,%ebp
+  802fc7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802fca:	68 ad 3c 80 00       	push   $0x803cad
+  802fcf:	ff 75 0c             	push   0xc(%ebp)
+  802fd2:	e8 b0 d7 ff ff       	call   800787 <strcpy>
+	return 0;
+}
+  802fd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fdc:	c9                   	leave
+  802fdd:	c3                   	ret
+
+00802fde <devcons_write>:
+{
+  802fde:	55                   	push   %ebp
+  802fdf:	89 e5                	mov    %esp,%ebp
+  802fe1:	57                   	push   %edi
+  802fe2:	56                   	push   %esi
+  802fe3:	53                   	push   %ebx
+  802fe4:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802fea:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802fef:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802ff5:	eb 2e                	jmp    803025 <devcons_write+0x47>
+		m = n - tot;
+  802ff7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ffa:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802ffc:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803001:	39 c3                	cmp    %eax,%ebx
+  803003:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803006:	83 ec 04             	sub    $0x4,%esp
+  803009:	53                   	push   %ebx
+  80300a:	89 f0                	mov    %esi,%eax
+  80300c:	03 45 0c             	add    0xc(%ebp),%eax
+  80300f:	50                   	push   %eax
+  803010:	57                   	push   %edi
+  803011:	e8 f7 d8 ff ff       	call   80090d <memmove>
+		sys_cputs(buf, m);
+  803016:	83 c4 08             	add    $0x8,%esp
+  803019:	53                   	push   %ebx
+  80301a:	57                   	push   %edi
+  80301b:	e8 97 da ff ff       	call   800ab7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803020:	01 de                	add    %ebx,%esi
+  803022:	83 c4 10             	add    $0x10,%esp
+  803025:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803028:	72 cd                	jb     802ff7 <devcons_write+0x19>
+}
+  80302a:	89 f0                	mov    %esi,%eax
+  80302c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80302f:	5b                   	pop    %ebx
+  803030:	5e                   	pop    %esi
+  803031:	5f                   	pop    %edi
+  803032:	5d                   	pop    %ebp
+  803033:	c3                   	ret
+
+00803034 <devcons_read>:
+{
+  803034:	55                   	push   %ebp
+  803035:	89 e5                	mov    %esp,%ebp
+  803037:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80303a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803043:	75 07                	jne    80304c <devcons_read+0x18>
+  803045:	eb 1f                	jmp    803066 <devcons_read+0x32>
+		sys_yield();
+  803047:	e8 28 db ff ff       	call   800b74 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80304c:	e8 8c da ff ff       	call   800add <sys_cgetc>
+  803051:	85 c0                	test   %eax,%eax
+  803053:	74 f2                	je     803047 <devcons_read+0x13>
+	if (c < 0)
+  803055:	78 0f                	js     803066 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803057:	83 f8 04             	cmp    $0x4,%eax
+  80305a:	74 0c                	je     803068 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80305c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80305f:	88 02                	mov    %al,(%edx)
+	return 1;
+  803061:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803066:	c9                   	leave
+  803067:	c3                   	ret
+		return 0;
+  803068:	b8 00 00 00 00       	mov    $0x0,%eax
+  80306d:	eb f7                	jmp    803066 <devcons_read+0x32>
+
+0080306f <cputchar>:
+{
+  80306f:	55                   	push   %ebp
+  803070:	89 e5                	mov    %esp,%ebp
+  803072:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803075:	8b 45 08             	mov    0x8(%ebp),%eax
+  803078:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80307b:	6a 01                	push   $0x1
+  80307d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803080:	50                   	push   %eax
+  803081:	e8 31 da ff ff       	call   800ab7 <sys_cputs>
+}
+  803086:	83 c4 10             	add    $0x10,%esp
+  803089:	c9                   	leave
+  80308a:	c3                   	ret
+
+0080308b <getchar>:
+{
+  80308b:	55                   	push   %ebp
+  80308c:	89 e5                	mov    %esp,%ebp
+  80308e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803091:	6a 01                	push   $0x1
+  803093:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803096:	50                   	push   %eax
+  803097:	6a 00                	push   $0x0
+  803099:	e8 bc e3 ff ff       	call   80145a <read>
+	if (r < 0)
+  80309e:	83 c4 10             	add    $0x10,%esp
+  8030a1:	85 c0                	test   %eax,%eax
+  8030a3:	78 06                	js     8030ab <getchar+0x20>
+	if (r < 1)
+  8030a5:	74 06                	je     8030ad <getchar+0x22>
+	return c;
+  8030a7:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8030ab:	c9                   	leave
+  8030ac:	c3                   	ret
+		return -E_EOF;
+  8030ad:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8030b2:	eb f7                	jmp    8030ab <getchar+0x20>
+
+008030b4 <iscons>:
+{
+  8030b4:	55                   	push   %ebp
+  8030b5:	89 e5                	mov    %esp,%ebp
+  8030b7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8030ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030bd:	50                   	push   %eax
+  8030be:	ff 75 08             	push   0x8(%ebp)
+  8030c1:	e8 2e e1 ff ff       	call   8011f4 <fd_lookup>
+  8030c6:	83 c4 10             	add    $0x10,%esp
+  8030c9:	85 c0                	test   %eax,%eax
+  8030cb:	78 11                	js     8030de <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8030cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030d0:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8030d6:	39 10                	cmp    %edx,(%eax)
+  8030d8:	0f 94 c0             	sete   %al
+  8030db:	0f b6 c0             	movzbl %al,%eax
+}
+  8030de:	c9                   	leave
+  8030df:	c3                   	ret
+
+008030e0 <opencons>:
+{
+  8030e0:	55                   	push   %ebp
+  8030e1:	89 e5                	mov    %esp,%ebp
+  8030e3:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8030e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030e9:	50                   	push   %eax
+  8030ea:	e8 af e0 ff ff       	call   80119e <fd_alloc>
+  8030ef:	83 c4 10             	add    $0x10,%esp
+  8030f2:	85 c0                	test   %eax,%eax
+  8030f4:	78 3a                	js     803130 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8030f6:	83 ec 04             	sub    $0x4,%esp
+  8030f9:	68 07 04 00 00       	push   $0x407
+  8030fe:	ff 75 f4             	push   -0xc(%ebp)
+  803101:	6a 00                	push   $0x0
+  803103:	e8 8b da ff ff       	call   800b93 <sys_page_alloc>
+  803108:	83 c4 10             	add    $0x10,%esp
+  80310b:	85 c0                	test   %eax,%eax
+  80310d:	78 21                	js     803130 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80310f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803112:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  803118:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80311a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80311d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803124:	83 ec 0c             	sub    $0xc,%esp
+  803127:	50                   	push   %eax
+  803128:	e8 4a e0 ff ff       	call   801177 <fd2num>
+  80312d:	83 c4 10             	add    $0x10,%esp
+}
+  803130:	c9                   	leave
+  803131:	c3                   	ret
+
+00803132 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803132:	55                   	push   %ebp
+  803133:	89 e5                	mov    %esp,%ebp
+  803135:	56                   	push   %esi
+  803136:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803137:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80313a:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  803140:	e8 08 da ff ff       	call   800b4d <sys_getenvid>
+  803145:	83 ec 0c             	sub    $0xc,%esp
+  803148:	ff 75 0c             	push   0xc(%ebp)
+  80314b:	ff 75 08             	push   0x8(%ebp)
+  80314e:	56                   	push   %esi
+  80314f:	50                   	push   %eax
+  803150:	68 bc 3c 80 00       	push   $0x803cbc
+  803155:	e8 3f d0 ff ff       	call   800199 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80315a:	83 c4 18             	add    $0x18,%esp
+  80315d:	53                   	push   %ebx
+  80315e:	ff 75 10             	push   0x10(%ebp)
+  803161:	e8 e2 cf ff ff       	call   800148 <vcprintf>
+	cprintf("\n");
+  803166:	c7 04 24 a6 3c 80 00 	movl   $0x803ca6,(%esp)
+  80316d:	e8 27 d0 ff ff       	call   800199 <cprintf>
+  803172:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803175:	cc                   	int3
+	while (1)
+  803176:	eb fd                	jmp    803175 <_panic+0x43>
+
+00803178 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  803178:	55                   	push   %ebp
+  803179:	89 e5                	mov    %esp,%ebp
+  80317b:	57                   	push   %edi
+  80317c:	56                   	push   %esi
+  80317d:	53                   	push   %ebx
+  80317e:	83 ec 20             	sub    $0x20,%esp
+  803181:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803184:	89 d7                	mov    %edx,%edi
+  803186:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  803188:	51                   	push   %ecx
+  803189:	68 00 f0 7f 00       	push   $0x7ff000
+  80318e:	6a 00                	push   $0x0
+  803190:	e8 fe d9 ff ff       	call   800b93 <sys_page_alloc>
+  803195:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803197:	83 c4 10             	add    $0x10,%esp
+  80319a:	85 c0                	test   %eax,%eax
+  80319c:	78 45                	js     8031e3 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  80319e:	83 ec 04             	sub    $0x4,%esp
+  8031a1:	68 00 10 00 00       	push   $0x1000
+  8031a6:	57                   	push   %edi
+  8031a7:	68 00 f0 7f 00       	push   $0x7ff000
+  8031ac:	e8 5c d7 ff ff       	call   80090d <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8031b1:	89 34 24             	mov    %esi,(%esp)
+  8031b4:	57                   	push   %edi
+  8031b5:	ff 75 e4             	push   -0x1c(%ebp)
+  8031b8:	68 00 f0 7f 00       	push   $0x7ff000
+  8031bd:	6a 00                	push   $0x0
+  8031bf:	e8 1a da ff ff       	call   800bde <sys_page_map>
+  8031c4:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8031c6:	83 c4 20             	add    $0x20,%esp
+  8031c9:	85 c0                	test   %eax,%eax
+  8031cb:	78 16                	js     8031e3 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8031cd:	83 ec 08             	sub    $0x8,%esp
+  8031d0:	68 00 f0 7f 00       	push   $0x7ff000
+  8031d5:	6a 00                	push   $0x0
+  8031d7:	e8 44 da ff ff       	call   800c20 <sys_page_unmap>
+  8031dc:	83 c4 10             	add    $0x10,%esp
+  8031df:	85 c0                	test   %eax,%eax
+  8031e1:	75 0a                	jne    8031ed <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8031e3:	89 d8                	mov    %ebx,%eax
+  8031e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031e8:	5b                   	pop    %ebx
+  8031e9:	5e                   	pop    %esi
+  8031ea:	5f                   	pop    %edi
+  8031eb:	5d                   	pop    %ebp
+  8031ec:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8031ed:	68 e0 3c 80 00       	push   $0x803ce0
+  8031f2:	68 47 3b 80 00       	push   $0x803b47
+  8031f7:	6a 1b                	push   $0x1b
+  8031f9:	68 58 3d 80 00       	push   $0x803d58
+  8031fe:	e8 2f ff ff ff       	call   803132 <_panic>
+
+00803203 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803203:	55                   	push   %ebp
+  803204:	89 e5                	mov    %esp,%ebp
+  803206:	53                   	push   %ebx
+  803207:	83 ec 04             	sub    $0x4,%esp
+  80320a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  80320d:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80320f:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  803213:	74 21                	je     803236 <pgfault+0x33>
+  803215:	89 d0                	mov    %edx,%eax
+  803217:	c1 e8 16             	shr    $0x16,%eax
+  80321a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803221:	a8 01                	test   $0x1,%al
+  803223:	74 11                	je     803236 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803225:	89 d0                	mov    %edx,%eax
+  803227:	c1 e8 0c             	shr    $0xc,%eax
+  80322a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803231:	f6 c4 08             	test   $0x8,%ah
+  803234:	75 17                	jne    80324d <pgfault+0x4a>
+		if (pgfault_next) {
+  803236:	a1 04 90 80 00       	mov    0x809004,%eax
+  80323b:	85 c0                	test   %eax,%eax
+  80323d:	74 27                	je     803266 <pgfault+0x63>
+			pgfault_next(utf);
+  80323f:	83 ec 0c             	sub    $0xc,%esp
+  803242:	53                   	push   %ebx
+  803243:	ff d0                	call   *%eax
+			return;
+  803245:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80324b:	c9                   	leave
+  80324c:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  80324d:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803253:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803258:	b8 00 00 00 00       	mov    $0x0,%eax
+  80325d:	e8 16 ff ff ff       	call   803178 <copy_page_to>
+  803262:	85 c0                	test   %eax,%eax
+  803264:	79 e2                	jns    803248 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803266:	a1 00 50 80 00       	mov    0x805000,%eax
+  80326b:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  80326e:	ff 73 28             	push   0x28(%ebx)
+  803271:	ff 33                	push   (%ebx)
+  803273:	50                   	push   %eax
+  803274:	68 04 3d 80 00       	push   $0x803d04
+  803279:	e8 1b cf ff ff       	call   800199 <cprintf>
+	sys_env_destroy(0);
+  80327e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803285:	e8 7a d8 ff ff       	call   800b04 <sys_env_destroy>
+  80328a:	83 c4 10             	add    $0x10,%esp
+  80328d:	eb b9                	jmp    803248 <pgfault+0x45>
+
+0080328f <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  80328f:	55                   	push   %ebp
+  803290:	89 e5                	mov    %esp,%ebp
+  803292:	53                   	push   %ebx
+  803293:	83 ec 04             	sub    $0x4,%esp
+  803296:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803299:	a1 08 90 80 00       	mov    0x809008,%eax
+  80329e:	3d 03 32 80 00       	cmp    $0x803203,%eax
+  8032a3:	74 15                	je     8032ba <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8032a5:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  8032aa:	83 ec 0c             	sub    $0xc,%esp
+  8032ad:	68 03 32 80 00       	push   $0x803203
+  8032b2:	e8 18 02 00 00       	call   8034cf <set_pgfault_handler>
+  8032b7:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8032ba:	83 ec 0c             	sub    $0xc,%esp
+  8032bd:	68 05 08 00 00       	push   $0x805
+  8032c2:	53                   	push   %ebx
+  8032c3:	6a 00                	push   $0x0
+  8032c5:	53                   	push   %ebx
+  8032c6:	6a 00                	push   $0x0
+  8032c8:	e8 11 d9 ff ff       	call   800bde <sys_page_map>
+}
+  8032cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032d0:	c9                   	leave
+  8032d1:	c3                   	ret
+
+008032d2 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8032d2:	55                   	push   %ebp
+  8032d3:	89 e5                	mov    %esp,%ebp
+  8032d5:	57                   	push   %edi
+  8032d6:	56                   	push   %esi
+  8032d7:	53                   	push   %ebx
+  8032d8:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8032db:	68 03 32 80 00       	push   $0x803203
+  8032e0:	e8 ea 01 00 00       	call   8034cf <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8032e5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8032ea:	cd 30                	int    $0x30
+  8032ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8032ef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8032f2:	83 c4 10             	add    $0x10,%esp
+  8032f5:	85 c0                	test   %eax,%eax
+  8032f7:	0f 88 6b 01 00 00    	js     803468 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8032fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803302:	75 37                	jne    80333b <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803304:	e8 44 d8 ff ff       	call   800b4d <sys_getenvid>
+  803309:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80330e:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803314:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803319:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  80331e:	e9 45 01 00 00       	jmp    803468 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803323:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803329:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80332f:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803335:	0f 87 ba 00 00 00    	ja     8033f5 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  80333b:	89 d8                	mov    %ebx,%eax
+  80333d:	c1 e8 16             	shr    $0x16,%eax
+  803340:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803347:	a8 01                	test   $0x1,%al
+  803349:	74 d8                	je     803323 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  80334b:	89 d8                	mov    %ebx,%eax
+  80334d:	c1 e8 0c             	shr    $0xc,%eax
+  803350:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803357:	f6 c2 01             	test   $0x1,%dl
+  80335a:	74 cd                	je     803329 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  80335c:	89 da                	mov    %ebx,%edx
+  80335e:	80 e6 df             	and    $0xdf,%dh
+  803361:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803367:	74 c0                	je     803329 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803369:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80336b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803372:	f6 c6 04             	test   $0x4,%dh
+  803375:	75 53                	jne    8033ca <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803377:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80337e:	f6 c6 08             	test   $0x8,%dh
+  803381:	75 0c                	jne    80338f <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803383:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80338a:	f6 c2 02             	test   $0x2,%dl
+  80338d:	74 3b                	je     8033ca <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80338f:	83 ec 0c             	sub    $0xc,%esp
+  803392:	68 05 08 00 00       	push   $0x805
+  803397:	57                   	push   %edi
+  803398:	ff 75 e4             	push   -0x1c(%ebp)
+  80339b:	57                   	push   %edi
+  80339c:	6a 00                	push   $0x0
+  80339e:	e8 3b d8 ff ff       	call   800bde <sys_page_map>
+  8033a3:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8033a5:	83 c4 20             	add    $0x20,%esp
+  8033a8:	85 c0                	test   %eax,%eax
+  8033aa:	0f 88 a7 00 00 00    	js     803457 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8033b0:	83 ec 0c             	sub    $0xc,%esp
+  8033b3:	68 05 08 00 00       	push   $0x805
+  8033b8:	57                   	push   %edi
+  8033b9:	6a 00                	push   $0x0
+  8033bb:	57                   	push   %edi
+  8033bc:	6a 00                	push   $0x0
+  8033be:	e8 1b d8 ff ff       	call   800bde <sys_page_map>
+  8033c3:	89 c6                	mov    %eax,%esi
+	return r;
+  8033c5:	83 c4 20             	add    $0x20,%esp
+  8033c8:	eb 21                	jmp    8033eb <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8033ca:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033d1:	83 ec 0c             	sub    $0xc,%esp
+  8033d4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8033d9:	50                   	push   %eax
+  8033da:	57                   	push   %edi
+  8033db:	ff 75 e4             	push   -0x1c(%ebp)
+  8033de:	57                   	push   %edi
+  8033df:	6a 00                	push   $0x0
+  8033e1:	e8 f8 d7 ff ff       	call   800bde <sys_page_map>
+  8033e6:	89 c6                	mov    %eax,%esi
+  8033e8:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8033eb:	85 f6                	test   %esi,%esi
+  8033ed:	0f 89 36 ff ff ff    	jns    803329 <fork+0x57>
+  8033f3:	eb 62                	jmp    803457 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8033f5:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8033fa:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8033ff:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803402:	89 f8                	mov    %edi,%eax
+  803404:	e8 6f fd ff ff       	call   803178 <copy_page_to>
+  803409:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80340b:	85 c0                	test   %eax,%eax
+  80340d:	78 48                	js     803457 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80340f:	83 ec 04             	sub    $0x4,%esp
+  803412:	6a 07                	push   $0x7
+  803414:	68 00 f0 bf ee       	push   $0xeebff000
+  803419:	57                   	push   %edi
+  80341a:	e8 74 d7 ff ff       	call   800b93 <sys_page_alloc>
+  80341f:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803421:	83 c4 10             	add    $0x10,%esp
+  803424:	85 c0                	test   %eax,%eax
+  803426:	78 2f                	js     803457 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803428:	a1 00 50 80 00       	mov    0x805000,%eax
+  80342d:	8b 40 64             	mov    0x64(%eax),%eax
+  803430:	83 ec 08             	sub    $0x8,%esp
+  803433:	50                   	push   %eax
+  803434:	57                   	push   %edi
+  803435:	e8 c4 d8 ff ff       	call   800cfe <sys_env_set_pgfault_upcall>
+  80343a:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80343c:	83 c4 10             	add    $0x10,%esp
+  80343f:	85 c0                	test   %eax,%eax
+  803441:	78 14                	js     803457 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803443:	83 ec 08             	sub    $0x8,%esp
+  803446:	6a 02                	push   $0x2
+  803448:	57                   	push   %edi
+  803449:	e8 1c d8 ff ff       	call   800c6a <sys_env_set_status>
+  80344e:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803450:	83 c4 10             	add    $0x10,%esp
+  803453:	85 c0                	test   %eax,%eax
+  803455:	79 11                	jns    803468 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803457:	83 ec 0c             	sub    $0xc,%esp
+  80345a:	ff 75 e0             	push   -0x20(%ebp)
+  80345d:	e8 a2 d6 ff ff       	call   800b04 <sys_env_destroy>
+	return r;
+  803462:	83 c4 10             	add    $0x10,%esp
+  803465:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803468:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80346b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80346e:	5b                   	pop    %ebx
+  80346f:	5e                   	pop    %esi
+  803470:	5f                   	pop    %edi
+  803471:	5d                   	pop    %ebp
+  803472:	c3                   	ret
+
+00803473 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803473:	55                   	push   %ebp
+  803474:	89 e5                	mov    %esp,%ebp
+  803476:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803479:	68 63 3d 80 00       	push   $0x803d63
+  80347e:	68 bf 00 00 00       	push   $0xbf
+  803483:	68 58 3d 80 00       	push   $0x803d58
+  803488:	e8 a5 fc ff ff       	call   803132 <_panic>
+
+0080348d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80348d:	55                   	push   %ebp
+  80348e:	89 e5                	mov    %esp,%ebp
+  803490:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803493:	89 c2                	mov    %eax,%edx
+  803495:	c1 ea 16             	shr    $0x16,%edx
+  803498:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80349f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8034a4:	f6 c1 01             	test   $0x1,%cl
+  8034a7:	74 22                	je     8034cb <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8034a9:	c1 e8 0c             	shr    $0xc,%eax
+  8034ac:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8034b3:	a8 01                	test   $0x1,%al
+  8034b5:	74 14                	je     8034cb <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8034b7:	c1 e8 0c             	shr    $0xc,%eax
+  8034ba:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8034bd:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8034c4:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8034c8:	0f b7 d2             	movzwl %dx,%edx
+}
+  8034cb:	89 d0                	mov    %edx,%eax
+  8034cd:	5d                   	pop    %ebp
+  8034ce:	c3                   	ret
+
+008034cf <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8034cf:	55                   	push   %ebp
+  8034d0:	89 e5                	mov    %esp,%ebp
+  8034d2:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8034d5:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  8034dc:	74 0a                	je     8034e8 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8034de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034e1:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  8034e6:	c9                   	leave
+  8034e7:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034e8:	83 ec 04             	sub    $0x4,%esp
+  8034eb:	6a 07                	push   $0x7
+  8034ed:	68 00 f0 bf ee       	push   $0xeebff000
+  8034f2:	6a 00                	push   $0x0
+  8034f4:	e8 9a d6 ff ff       	call   800b93 <sys_page_alloc>
+  8034f9:	83 c4 10             	add    $0x10,%esp
+  8034fc:	85 c0                	test   %eax,%eax
+  8034fe:	75 2c                	jne    80352c <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803500:	83 ec 08             	sub    $0x8,%esp
+  803503:	68 42 35 80 00       	push   $0x803542
+  803508:	6a 00                	push   $0x0
+  80350a:	e8 ef d7 ff ff       	call   800cfe <sys_env_set_pgfault_upcall>
+  80350f:	83 c4 10             	add    $0x10,%esp
+  803512:	85 c0                	test   %eax,%eax
+  803514:	74 c8                	je     8034de <set_pgfault_handler+0xf>
+  803516:	68 c4 3d 80 00       	push   $0x803dc4
+  80351b:	68 47 3b 80 00       	push   $0x803b47
+  803520:	6a 20                	push   $0x20
+  803522:	68 f4 3d 80 00       	push   $0x803df4
+  803527:	e8 06 fc ff ff       	call   803132 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80352c:	68 7c 3d 80 00       	push   $0x803d7c
+  803531:	68 47 3b 80 00       	push   $0x803b47
+  803536:	6a 1e                	push   $0x1e
+  803538:	68 f4 3d 80 00       	push   $0x803df4
+  80353d:	e8 f0 fb ff ff       	call   803132 <_panic>
+
+00803542 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803542:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803543:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  803548:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80354a:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80354d:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803552:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803557:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  80355b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80355e:	83 c4 08             	add    $0x8,%esp
+	popal
+  803561:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803562:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803565:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803566:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803567:	c3                   	ret
+
+00803568 <dm>:
+  803568:	55                   	push   %ebp
+  803569:	57                   	push   %edi
+  80356a:	56                   	push   %esi
+  80356b:	53                   	push   %ebx
+  80356c:	83 ec 24             	sub    $0x24,%esp
+  80356f:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803573:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803577:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80357b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80357f:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803583:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803587:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80358b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803590:	b8 00 00 00 00       	mov    $0x0,%eax
+  803595:	ba 00 00 00 00       	mov    $0x0,%edx
+  80359a:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035a1:	00 
+  8035a2:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035a9:	00 
+  8035aa:	89 fb                	mov    %edi,%ebx
+  8035ac:	eb 08                	jmp    8035b6 <dm+0x4e>
+  8035ae:	83 e9 01             	sub    $0x1,%ecx
+  8035b1:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8035b4:	74 68                	je     80361e <dm+0xb6>
+  8035b6:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8035ba:	01 c0                	add    %eax,%eax
+  8035bc:	89 c6                	mov    %eax,%esi
+  8035be:	89 d7                	mov    %edx,%edi
+  8035c0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8035c4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8035c8:	0f ad d0             	shrd   %cl,%edx,%eax
+  8035cb:	d3 ea                	shr    %cl,%edx
+  8035cd:	f6 c1 20             	test   $0x20,%cl
+  8035d0:	74 04                	je     8035d6 <dm+0x6e>
+  8035d2:	89 d0                	mov    %edx,%eax
+  8035d4:	31 d2                	xor    %edx,%edx
+  8035d6:	83 e0 01             	and    $0x1,%eax
+  8035d9:	89 04 24             	mov    %eax,(%esp)
+  8035dc:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8035e3:	00 
+  8035e4:	8b 04 24             	mov    (%esp),%eax
+  8035e7:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8035eb:	09 f0                	or     %esi,%eax
+  8035ed:	09 fa                	or     %edi,%edx
+  8035ef:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8035f3:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8035f7:	39 f0                	cmp    %esi,%eax
+  8035f9:	89 d5                	mov    %edx,%ebp
+  8035fb:	19 fd                	sbb    %edi,%ebp
+  8035fd:	72 af                	jb     8035ae <dm+0x46>
+  8035ff:	29 f0                	sub    %esi,%eax
+  803601:	19 fa                	sbb    %edi,%edx
+  803603:	89 cf                	mov    %ecx,%edi
+  803605:	c1 ef 05             	shr    $0x5,%edi
+  803608:	83 e7 01             	and    $0x1,%edi
+  80360b:	89 fe                	mov    %edi,%esi
+  80360d:	83 f6 01             	xor    $0x1,%esi
+  803610:	d3 e6                	shl    %cl,%esi
+  803612:	d3 e7                	shl    %cl,%edi
+  803614:	09 74 24 18          	or     %esi,0x18(%esp)
+  803618:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80361c:	eb 90                	jmp    8035ae <dm+0x46>
+  80361e:	85 db                	test   %ebx,%ebx
+  803620:	74 05                	je     803627 <dm+0xbf>
+  803622:	89 03                	mov    %eax,(%ebx)
+  803624:	89 53 04             	mov    %edx,0x4(%ebx)
+  803627:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80362b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80362f:	83 c4 24             	add    $0x24,%esp
+  803632:	5b                   	pop    %ebx
+  803633:	5e                   	pop    %esi
+  803634:	5f                   	pop    %edi
+  803635:	5d                   	pop    %ebp
+  803636:	c3                   	ret
+
+00803637 <__udivdi3>:
+  803637:	83 ec 08             	sub    $0x8,%esp
+  80363a:	6a 00                	push   $0x0
+  80363c:	ff 74 24 1c          	push   0x1c(%esp)
+  803640:	ff 74 24 1c          	push   0x1c(%esp)
+  803644:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803648:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80364c:	e8 17 ff ff ff       	call   803568 <dm>
+  803651:	83 c4 14             	add    $0x14,%esp
+  803654:	c3                   	ret
+
+00803655 <__umoddi3>:
+  803655:	83 ec 18             	sub    $0x18,%esp
+  803658:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80365c:	50                   	push   %eax
+  80365d:	ff 74 24 2c          	push   0x2c(%esp)
+  803661:	ff 74 24 2c          	push   0x2c(%esp)
+  803665:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803669:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80366d:	e8 f6 fe ff ff       	call   803568 <dm>
+  803672:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803676:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80367a:	83 c4 24             	add    $0x24,%esp
+  80367d:	c3                   	ret
+
+0080367e <__divdi3>:
+  80367e:	53                   	push   %ebx
+  80367f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803683:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803687:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80368b:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80368f:	85 d2                	test   %edx,%edx
+  803691:	78 15                	js     8036a8 <__divdi3+0x2a>
+  803693:	85 db                	test   %ebx,%ebx
+  803695:	78 34                	js     8036cb <__divdi3+0x4d>
+  803697:	83 ec 04             	sub    $0x4,%esp
+  80369a:	6a 00                	push   $0x0
+  80369c:	53                   	push   %ebx
+  80369d:	51                   	push   %ecx
+  80369e:	e8 c5 fe ff ff       	call   803568 <dm>
+  8036a3:	83 c4 10             	add    $0x10,%esp
+  8036a6:	eb 21                	jmp    8036c9 <__divdi3+0x4b>
+  8036a8:	f7 d8                	neg    %eax
+  8036aa:	83 d2 00             	adc    $0x0,%edx
+  8036ad:	f7 da                	neg    %edx
+  8036af:	85 db                	test   %ebx,%ebx
+  8036b1:	78 30                	js     8036e3 <__divdi3+0x65>
+  8036b3:	83 ec 04             	sub    $0x4,%esp
+  8036b6:	6a 00                	push   $0x0
+  8036b8:	53                   	push   %ebx
+  8036b9:	51                   	push   %ecx
+  8036ba:	e8 a9 fe ff ff       	call   803568 <dm>
+  8036bf:	83 c4 10             	add    $0x10,%esp
+  8036c2:	f7 d8                	neg    %eax
+  8036c4:	83 d2 00             	adc    $0x0,%edx
+  8036c7:	f7 da                	neg    %edx
+  8036c9:	5b                   	pop    %ebx
+  8036ca:	c3                   	ret
+  8036cb:	83 ec 04             	sub    $0x4,%esp
+  8036ce:	6a 00                	push   $0x0
+  8036d0:	f7 d9                	neg    %ecx
+  8036d2:	83 d3 00             	adc    $0x0,%ebx
+  8036d5:	f7 db                	neg    %ebx
+  8036d7:	53                   	push   %ebx
+  8036d8:	51                   	push   %ecx
+  8036d9:	e8 8a fe ff ff       	call   803568 <dm>
+  8036de:	83 c4 10             	add    $0x10,%esp
+  8036e1:	eb df                	jmp    8036c2 <__divdi3+0x44>
+  8036e3:	83 ec 04             	sub    $0x4,%esp
+  8036e6:	6a 00                	push   $0x0
+  8036e8:	f7 d9                	neg    %ecx
+  8036ea:	83 d3 00             	adc    $0x0,%ebx
+  8036ed:	f7 db                	neg    %ebx
+  8036ef:	53                   	push   %ebx
+  8036f0:	51                   	push   %ecx
+  8036f1:	e8 72 fe ff ff       	call   803568 <dm>
+  8036f6:	83 c4 10             	add    $0x10,%esp
+  8036f9:	eb ce                	jmp    8036c9 <__divdi3+0x4b>
+
+008036fb <__moddi3>:
+  8036fb:	55                   	push   %ebp
+  8036fc:	57                   	push   %edi
+  8036fd:	56                   	push   %esi
+  8036fe:	53                   	push   %ebx
+  8036ff:	83 ec 24             	sub    $0x24,%esp
+  803702:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803706:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80370a:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80370e:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803712:	85 d2                	test   %edx,%edx
+  803714:	78 3b                	js     803751 <__moddi3+0x56>
+  803716:	83 ec 04             	sub    $0x4,%esp
+  803719:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80371d:	56                   	push   %esi
+  80371e:	89 ce                	mov    %ecx,%esi
+  803720:	f7 de                	neg    %esi
+  803722:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803726:	89 de                	mov    %ebx,%esi
+  803728:	83 d6 00             	adc    $0x0,%esi
+  80372b:	f7 de                	neg    %esi
+  80372d:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803731:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803735:	0f 48 f1             	cmovs  %ecx,%esi
+  803738:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80373d:	53                   	push   %ebx
+  80373e:	56                   	push   %esi
+  80373f:	e8 24 fe ff ff       	call   803568 <dm>
+  803744:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803748:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80374c:	83 c4 10             	add    $0x10,%esp
+  80374f:	eb 47                	jmp    803798 <__moddi3+0x9d>
+  803751:	f7 d8                	neg    %eax
+  803753:	83 d2 00             	adc    $0x0,%edx
+  803756:	f7 da                	neg    %edx
+  803758:	83 ec 04             	sub    $0x4,%esp
+  80375b:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80375f:	56                   	push   %esi
+  803760:	89 cf                	mov    %ecx,%edi
+  803762:	f7 df                	neg    %edi
+  803764:	89 de                	mov    %ebx,%esi
+  803766:	83 d6 00             	adc    $0x0,%esi
+  803769:	f7 de                	neg    %esi
+  80376b:	0f 49 cf             	cmovns %edi,%ecx
+  80376e:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803772:	0f 49 de             	cmovns %esi,%ebx
+  803775:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803779:	ff 74 24 0c          	push   0xc(%esp)
+  80377d:	ff 74 24 0c          	push   0xc(%esp)
+  803781:	e8 e2 fd ff ff       	call   803568 <dm>
+  803786:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80378a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80378e:	f7 d8                	neg    %eax
+  803790:	83 d2 00             	adc    $0x0,%edx
+  803793:	f7 da                	neg    %edx
+  803795:	83 c4 10             	add    $0x10,%esp
+  803798:	83 c4 24             	add    $0x24,%esp
+  80379b:	5b                   	pop    %ebx
+  80379c:	5e                   	pop    %esi
+  80379d:	5f                   	pop    %edi
+  80379e:	5d                   	pop    %ebp
+  80379f:	c3                   	ret
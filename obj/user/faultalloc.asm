@@ -0,0 +1,7688 @@
+
+obj/user/faultalloc.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 00 00 00       	call   8000ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 e0 37 80 00       	push   $0x8037e0
+  800045:	e8 be 01 00 00       	call   800208 <cprintf>
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 a4 0b 00 00       	call   800c02 <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800065:	53                   	push   %ebx
+  800066:	68 2c 38 80 00       	push   $0x80382c
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 2e 07 00 00       	call   8007a1 <snprintf>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 00 38 80 00       	push   $0x803800
+  800085:	6a 0e                	push   $0xe
+  800087:	68 ea 37 80 00       	push   $0x8037ea
+  80008c:	e8 9c 00 00 00       	call   80012d <_panic>
+
+00800091 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 62 0f 00 00       	call   801003 <set_pgfault_handler>
+	cprintf("%s\n", (char*)0xDeadBeef);
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	68 ef be ad de       	push   $0xdeadbeef
+  8000a9:	68 fc 37 80 00       	push   $0x8037fc
+  8000ae:	e8 55 01 00 00       	call   800208 <cprintf>
+	cprintf("%s\n", (char*)0xCafeBffe);
+  8000b3:	83 c4 08             	add    $0x8,%esp
+  8000b6:	68 fe bf fe ca       	push   $0xcafebffe
+  8000bb:	68 fc 37 80 00       	push   $0x8037fc
+  8000c0:	e8 43 01 00 00       	call   800208 <cprintf>
+}
+  8000c5:	83 c4 10             	add    $0x10,%esp
+  8000c8:	c9                   	leave
+  8000c9:	c3                   	ret
+
+008000ca <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000ca:	55                   	push   %ebp
+  8000cb:	89 e5                	mov    %esp,%ebp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000d5:	e8 e2 0a 00 00       	call   800bbc <sys_getenvid>
+  8000da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000df:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8000e5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ea:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000ef:	85 db                	test   %ebx,%ebx
+  8000f1:	7e 07                	jle    8000fa <libmain+0x30>
+		binaryname = argv[0];
+  8000f3:	8b 06                	mov    (%esi),%eax
+  8000f5:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000fa:	83 ec 08             	sub    $0x8,%esp
+  8000fd:	56                   	push   %esi
+  8000fe:	53                   	push   %ebx
+  8000ff:	e8 8d ff ff ff       	call   800091 <umain>
+
+	// exit gracefully
+	exit();
+  800104:	e8 0a 00 00 00       	call   800113 <exit>
+}
+  800109:	83 c4 10             	add    $0x10,%esp
+  80010c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80010f:	5b                   	pop    %ebx
+  800110:	5e                   	pop    %esi
+  800111:	5d                   	pop    %ebp
+  800112:	c3                   	ret
+
+00800113 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800113:	55                   	push   %ebp
+  800114:	89 e5                	mov    %esp,%ebp
+  800116:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800119:	e8 52 11 00 00       	call   801270 <close_all>
+	sys_env_destroy(0);
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	6a 00                	push   $0x0
+  800123:	e8 4b 0a 00 00       	call   800b73 <sys_env_destroy>
+}
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	c9                   	leave
+  80012c:	c3                   	ret
+
+0080012d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	56                   	push   %esi
+  800131:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800132:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800135:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80013b:	e8 7c 0a 00 00       	call   800bbc <sys_getenvid>
+  800140:	83 ec 0c             	sub    $0xc,%esp
+  800143:	ff 75 0c             	push   0xc(%ebp)
+  800146:	ff 75 08             	push   0x8(%ebp)
+  800149:	56                   	push   %esi
+  80014a:	50                   	push   %eax
+  80014b:	68 58 38 80 00       	push   $0x803858
+  800150:	e8 b3 00 00 00       	call   800208 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800155:	83 c4 18             	add    $0x18,%esp
+  800158:	53                   	push   %ebx
+  800159:	ff 75 10             	push   0x10(%ebp)
+  80015c:	e8 56 00 00 00       	call   8001b7 <vcprintf>
+	cprintf("\n");
+  800161:	c7 04 24 ae 3d 80 00 	movl   $0x803dae,(%esp)
+  800168:	e8 9b 00 00 00       	call   800208 <cprintf>
+  80016d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800170:	cc                   	int3
+	while (1)
+  800171:	eb fd                	jmp    800170 <_panic+0x43>
+
+00800173 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800173:	55                   	push   %ebp
+  800174:	89 e5                	mov    %esp,%ebp
+  800176:	53                   	push   %ebx
+  800177:	83 ec 04             	sub    $0x4,%esp
+  80017a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80017d:	8b 13                	mov    (%ebx),%edx
+  80017f:	8d 42 01             	lea    0x1(%edx),%eax
+  800182:	89 03                	mov    %eax,(%ebx)
+  800184:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800187:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80018b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800190:	74 09                	je     80019b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800192:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800196:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800199:	c9                   	leave
+  80019a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80019b:	83 ec 08             	sub    $0x8,%esp
+  80019e:	68 ff 00 00 00       	push   $0xff
+  8001a3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001a6:	50                   	push   %eax
+  8001a7:	e8 7a 09 00 00       	call   800b26 <sys_cputs>
+		b->idx = 0;
+  8001ac:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001b2:	83 c4 10             	add    $0x10,%esp
+  8001b5:	eb db                	jmp    800192 <putch+0x1f>
+
+008001b7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001b7:	55                   	push   %ebp
+  8001b8:	89 e5                	mov    %esp,%ebp
+  8001ba:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001c0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001c7:	00 00 00 
+	b.cnt = 0;
+  8001ca:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001d1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001d4:	ff 75 0c             	push   0xc(%ebp)
+  8001d7:	ff 75 08             	push   0x8(%ebp)
+  8001da:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001e0:	50                   	push   %eax
+  8001e1:	68 73 01 80 00       	push   $0x800173
+  8001e6:	e8 14 01 00 00       	call   8002ff <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001eb:	83 c4 08             	add    $0x8,%esp
+  8001ee:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001f4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001fa:	50                   	push   %eax
+  8001fb:	e8 26 09 00 00       	call   800b26 <sys_cputs>
+
+	return b.cnt;
+}
+  800200:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800206:	c9                   	leave
+  800207:	c3                   	ret
+
+00800208 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800208:	55                   	push   %ebp
+  800209:	89 e5                	mov    %esp,%ebp
+  80020b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80020e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800211:	50                   	push   %eax
+  800212:	ff 75 08             	push   0x8(%ebp)
+  800215:	e8 9d ff ff ff       	call   8001b7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80021a:	c9                   	leave
+  80021b:	c3                   	ret
+
+0080021c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80021c:	55                   	push   %ebp
+  80021d:	89 e5                	mov    %esp,%ebp
+  80021f:	57                   	push   %edi
+  800220:	56                   	push   %esi
+  800221:	53                   	push   %ebx
+  800222:	83 ec 1c             	sub    $0x1c,%esp
+  800225:	89 c7                	mov    %eax,%edi
+  800227:	89 d6                	mov    %edx,%esi
+  800229:	8b 45 08             	mov    0x8(%ebp),%eax
+  80022c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80022f:	89 d1                	mov    %edx,%ecx
+  800231:	89 c2                	mov    %eax,%edx
+  800233:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800236:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800239:	8b 45 10             	mov    0x10(%ebp),%eax
+  80023c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80023f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800242:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800249:	39 c2                	cmp    %eax,%edx
+  80024b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80024e:	72 3e                	jb     80028e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800250:	83 ec 0c             	sub    $0xc,%esp
+  800253:	ff 75 18             	push   0x18(%ebp)
+  800256:	83 eb 01             	sub    $0x1,%ebx
+  800259:	53                   	push   %ebx
+  80025a:	50                   	push   %eax
+  80025b:	83 ec 08             	sub    $0x8,%esp
+  80025e:	ff 75 e4             	push   -0x1c(%ebp)
+  800261:	ff 75 e0             	push   -0x20(%ebp)
+  800264:	ff 75 dc             	push   -0x24(%ebp)
+  800267:	ff 75 d8             	push   -0x28(%ebp)
+  80026a:	e8 f1 33 00 00       	call   803660 <__udivdi3>
+  80026f:	83 c4 18             	add    $0x18,%esp
+  800272:	52                   	push   %edx
+  800273:	50                   	push   %eax
+  800274:	89 f2                	mov    %esi,%edx
+  800276:	89 f8                	mov    %edi,%eax
+  800278:	e8 9f ff ff ff       	call   80021c <printnum>
+  80027d:	83 c4 20             	add    $0x20,%esp
+  800280:	eb 13                	jmp    800295 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800282:	83 ec 08             	sub    $0x8,%esp
+  800285:	56                   	push   %esi
+  800286:	ff 75 18             	push   0x18(%ebp)
+  800289:	ff d7                	call   *%edi
+  80028b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80028e:	83 eb 01             	sub    $0x1,%ebx
+  800291:	85 db                	test   %ebx,%ebx
+  800293:	7f ed                	jg     800282 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800295:	83 ec 08             	sub    $0x8,%esp
+  800298:	56                   	push   %esi
+  800299:	83 ec 04             	sub    $0x4,%esp
+  80029c:	ff 75 e4             	push   -0x1c(%ebp)
+  80029f:	ff 75 e0             	push   -0x20(%ebp)
+  8002a2:	ff 75 dc             	push   -0x24(%ebp)
+  8002a5:	ff 75 d8             	push   -0x28(%ebp)
+  8002a8:	e8 d1 33 00 00       	call   80367e <__umoddi3>
+  8002ad:	83 c4 14             	add    $0x14,%esp
+  8002b0:	0f be 80 7b 38 80 00 	movsbl 0x80387b(%eax),%eax
+  8002b7:	50                   	push   %eax
+  8002b8:	ff d7                	call   *%edi
+}
+  8002ba:	83 c4 10             	add    $0x10,%esp
+  8002bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c0:	5b                   	pop    %ebx
+  8002c1:	5e                   	pop    %esi
+  8002c2:	5f                   	pop    %edi
+  8002c3:	5d                   	pop    %ebp
+  8002c4:	c3                   	ret
+
+008002c5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002cb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002cf:	8b 10                	mov    (%eax),%edx
+  8002d1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002d4:	73 0a                	jae    8002e0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002d6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002d9:	89 08                	mov    %ecx,(%eax)
+  8002db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002de:	88 02                	mov    %al,(%edx)
+}
+  8002e0:	5d                   	pop    %ebp
+  8002e1:	c3                   	ret
+
+008002e2 <printfmt>:
+{
+  8002e2:	55                   	push   %ebp
+  8002e3:	89 e5                	mov    %esp,%ebp
+  8002e5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002e8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002eb:	50                   	push   %eax
+  8002ec:	ff 75 10             	push   0x10(%ebp)
+  8002ef:	ff 75 0c             	push   0xc(%ebp)
+  8002f2:	ff 75 08             	push   0x8(%ebp)
+  8002f5:	e8 05 00 00 00       	call   8002ff <vprintfmt>
+}
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	c9                   	leave
+  8002fe:	c3                   	ret
+
+008002ff <vprintfmt>:
+{
+  8002ff:	55                   	push   %ebp
+  800300:	89 e5                	mov    %esp,%ebp
+  800302:	57                   	push   %edi
+  800303:	56                   	push   %esi
+  800304:	53                   	push   %ebx
+  800305:	83 ec 2c             	sub    $0x2c,%esp
+  800308:	8b 75 08             	mov    0x8(%ebp),%esi
+  80030b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80030e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800311:	eb 0a                	jmp    80031d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800313:	83 ec 08             	sub    $0x8,%esp
+  800316:	53                   	push   %ebx
+  800317:	50                   	push   %eax
+  800318:	ff d6                	call   *%esi
+  80031a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80031d:	83 c7 01             	add    $0x1,%edi
+  800320:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800324:	83 f8 25             	cmp    $0x25,%eax
+  800327:	74 0c                	je     800335 <vprintfmt+0x36>
+			if (ch == '\0')
+  800329:	85 c0                	test   %eax,%eax
+  80032b:	75 e6                	jne    800313 <vprintfmt+0x14>
+}
+  80032d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800330:	5b                   	pop    %ebx
+  800331:	5e                   	pop    %esi
+  800332:	5f                   	pop    %edi
+  800333:	5d                   	pop    %ebp
+  800334:	c3                   	ret
+		padc = ' ';
+  800335:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800339:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800340:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800347:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80034e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800353:	8d 47 01             	lea    0x1(%edi),%eax
+  800356:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800359:	0f b6 17             	movzbl (%edi),%edx
+  80035c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80035f:	3c 55                	cmp    $0x55,%al
+  800361:	0f 87 cf 03 00 00    	ja     800736 <vprintfmt+0x437>
+  800367:	0f b6 c0             	movzbl %al,%eax
+  80036a:	ff 24 85 e0 39 80 00 	jmp    *0x8039e0(,%eax,4)
+  800371:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800374:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800378:	eb d9                	jmp    800353 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80037a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80037d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800381:	eb d0                	jmp    800353 <vprintfmt+0x54>
+  800383:	0f b6 d2             	movzbl %dl,%edx
+  800386:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800389:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800391:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800394:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800398:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80039b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80039e:	83 f9 09             	cmp    $0x9,%ecx
+  8003a1:	77 55                	ja     8003f8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003a3:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003a6:	eb e9                	jmp    800391 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ab:	8b 00                	mov    (%eax),%eax
+  8003ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8003b6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003bc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003c0:	79 91                	jns    800353 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003c2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003c8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003cf:	eb 82                	jmp    800353 <vprintfmt+0x54>
+			if (width < 0)
+  8003d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003d4:	85 d2                	test   %edx,%edx
+  8003d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003db:	0f 49 c2             	cmovns %edx,%eax
+  8003de:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003e4:	e9 6a ff ff ff       	jmp    800353 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003ec:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003f3:	e9 5b ff ff ff       	jmp    800353 <vprintfmt+0x54>
+  8003f8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003fe:	eb bc                	jmp    8003bc <vprintfmt+0xbd>
+			lflag++;
+  800400:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800403:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800406:	e9 48 ff ff ff       	jmp    800353 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80040b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040e:	8d 78 04             	lea    0x4(%eax),%edi
+  800411:	83 ec 08             	sub    $0x8,%esp
+  800414:	53                   	push   %ebx
+  800415:	ff 30                	push   (%eax)
+  800417:	ff d6                	call   *%esi
+			break;
+  800419:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80041c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80041f:	e9 b1 02 00 00       	jmp    8006d5 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800424:	8b 45 14             	mov    0x14(%ebp),%eax
+  800427:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80042a:	8b 10                	mov    (%eax),%edx
+  80042c:	89 d0                	mov    %edx,%eax
+  80042e:	f7 d8                	neg    %eax
+  800430:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800433:	83 f8 11             	cmp    $0x11,%eax
+  800436:	7f 23                	jg     80045b <vprintfmt+0x15c>
+  800438:	8b 14 85 40 3b 80 00 	mov    0x803b40(,%eax,4),%edx
+  80043f:	85 d2                	test   %edx,%edx
+  800441:	74 18                	je     80045b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800443:	52                   	push   %edx
+  800444:	68 5e 3c 80 00       	push   $0x803c5e
+  800449:	53                   	push   %ebx
+  80044a:	56                   	push   %esi
+  80044b:	e8 92 fe ff ff       	call   8002e2 <printfmt>
+  800450:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800453:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800456:	e9 7a 02 00 00       	jmp    8006d5 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80045b:	50                   	push   %eax
+  80045c:	68 93 38 80 00       	push   $0x803893
+  800461:	53                   	push   %ebx
+  800462:	56                   	push   %esi
+  800463:	e8 7a fe ff ff       	call   8002e2 <printfmt>
+  800468:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80046b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80046e:	e9 62 02 00 00       	jmp    8006d5 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800473:	8b 45 14             	mov    0x14(%ebp),%eax
+  800476:	83 c0 04             	add    $0x4,%eax
+  800479:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80047c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800481:	85 c9                	test   %ecx,%ecx
+  800483:	b8 8c 38 80 00       	mov    $0x80388c,%eax
+  800488:	0f 45 c1             	cmovne %ecx,%eax
+  80048b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80048e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800492:	7e 06                	jle    80049a <vprintfmt+0x19b>
+  800494:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800498:	75 0b                	jne    8004a5 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80049a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80049d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004a0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004a3:	eb 5c                	jmp    800501 <vprintfmt+0x202>
+  8004a5:	83 ec 08             	sub    $0x8,%esp
+  8004a8:	ff 75 d0             	push   -0x30(%ebp)
+  8004ab:	ff 75 cc             	push   -0x34(%ebp)
+  8004ae:	e8 20 03 00 00       	call   8007d3 <strnlen>
+  8004b3:	89 c2                	mov    %eax,%edx
+  8004b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b8:	29 d0                	sub    %edx,%eax
+  8004ba:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004bd:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004c7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c9:	eb 0e                	jmp    8004d9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004cb:	83 ec 08             	sub    $0x8,%esp
+  8004ce:	53                   	push   %ebx
+  8004cf:	57                   	push   %edi
+  8004d0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d3:	83 ee 01             	sub    $0x1,%esi
+  8004d6:	83 c4 10             	add    $0x10,%esp
+  8004d9:	85 f6                	test   %esi,%esi
+  8004db:	7f ee                	jg     8004cb <vprintfmt+0x1cc>
+  8004dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e3:	85 c0                	test   %eax,%eax
+  8004e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004ea:	0f 49 d0             	cmovns %eax,%edx
+  8004ed:	29 d0                	sub    %edx,%eax
+  8004ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f2:	eb a6                	jmp    80049a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004f4:	83 ec 08             	sub    $0x8,%esp
+  8004f7:	53                   	push   %ebx
+  8004f8:	52                   	push   %edx
+  8004f9:	ff 55 08             	call   *0x8(%ebp)
+  8004fc:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ff:	89 f1                	mov    %esi,%ecx
+  800501:	8d 71 01             	lea    0x1(%ecx),%esi
+  800504:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800508:	0f be d0             	movsbl %al,%edx
+  80050b:	85 d2                	test   %edx,%edx
+  80050d:	74 28                	je     800537 <vprintfmt+0x238>
+  80050f:	85 ff                	test   %edi,%edi
+  800511:	78 05                	js     800518 <vprintfmt+0x219>
+  800513:	83 ef 01             	sub    $0x1,%edi
+  800516:	78 30                	js     800548 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800518:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80051c:	74 d6                	je     8004f4 <vprintfmt+0x1f5>
+  80051e:	0f be c0             	movsbl %al,%eax
+  800521:	83 e8 20             	sub    $0x20,%eax
+  800524:	83 f8 5e             	cmp    $0x5e,%eax
+  800527:	76 cb                	jbe    8004f4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800529:	83 ec 08             	sub    $0x8,%esp
+  80052c:	53                   	push   %ebx
+  80052d:	6a 3f                	push   $0x3f
+  80052f:	ff 55 08             	call   *0x8(%ebp)
+  800532:	83 c4 10             	add    $0x10,%esp
+  800535:	eb c8                	jmp    8004ff <vprintfmt+0x200>
+  800537:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80053d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800540:	01 d0                	add    %edx,%eax
+  800542:	29 c8                	sub    %ecx,%eax
+  800544:	89 c7                	mov    %eax,%edi
+  800546:	eb 13                	jmp    80055b <vprintfmt+0x25c>
+  800548:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054b:	eb ed                	jmp    80053a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80054d:	83 ec 08             	sub    $0x8,%esp
+  800550:	53                   	push   %ebx
+  800551:	6a 20                	push   $0x20
+  800553:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800555:	83 ef 01             	sub    $0x1,%edi
+  800558:	83 c4 10             	add    $0x10,%esp
+  80055b:	85 ff                	test   %edi,%edi
+  80055d:	7f ee                	jg     80054d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80055f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800562:	89 45 14             	mov    %eax,0x14(%ebp)
+  800565:	e9 6b 01 00 00       	jmp    8006d5 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80056a:	83 f9 01             	cmp    $0x1,%ecx
+  80056d:	7f 1f                	jg     80058e <vprintfmt+0x28f>
+	else if (lflag)
+  80056f:	85 c9                	test   %ecx,%ecx
+  800571:	74 67                	je     8005da <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800573:	8b 45 14             	mov    0x14(%ebp),%eax
+  800576:	8b 00                	mov    (%eax),%eax
+  800578:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80057b:	89 c1                	mov    %eax,%ecx
+  80057d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800580:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800583:	8b 45 14             	mov    0x14(%ebp),%eax
+  800586:	8d 40 04             	lea    0x4(%eax),%eax
+  800589:	89 45 14             	mov    %eax,0x14(%ebp)
+  80058c:	eb 17                	jmp    8005a5 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80058e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800591:	8b 50 04             	mov    0x4(%eax),%edx
+  800594:	8b 00                	mov    (%eax),%eax
+  800596:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800599:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80059c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059f:	8d 40 08             	lea    0x8(%eax),%eax
+  8005a2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005a5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005a8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005ab:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005b0:	85 c9                	test   %ecx,%ecx
+  8005b2:	0f 89 03 01 00 00    	jns    8006bb <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005b8:	83 ec 08             	sub    $0x8,%esp
+  8005bb:	53                   	push   %ebx
+  8005bc:	6a 2d                	push   $0x2d
+  8005be:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005c0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005c6:	f7 da                	neg    %edx
+  8005c8:	83 d1 00             	adc    $0x0,%ecx
+  8005cb:	f7 d9                	neg    %ecx
+  8005cd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005d0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005d5:	e9 e1 00 00 00       	jmp    8006bb <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8b 00                	mov    (%eax),%eax
+  8005df:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e2:	89 c1                	mov    %eax,%ecx
+  8005e4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f3:	eb b0                	jmp    8005a5 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005f5:	83 f9 01             	cmp    $0x1,%ecx
+  8005f8:	7f 1e                	jg     800618 <vprintfmt+0x319>
+	else if (lflag)
+  8005fa:	85 c9                	test   %ecx,%ecx
+  8005fc:	74 32                	je     800630 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800601:	8b 10                	mov    (%eax),%edx
+  800603:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800608:	8d 40 04             	lea    0x4(%eax),%eax
+  80060b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80060e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800613:	e9 a3 00 00 00       	jmp    8006bb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800618:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061b:	8b 10                	mov    (%eax),%edx
+  80061d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800620:	8d 40 08             	lea    0x8(%eax),%eax
+  800623:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800626:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80062b:	e9 8b 00 00 00       	jmp    8006bb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8b 10                	mov    (%eax),%edx
+  800635:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80063a:	8d 40 04             	lea    0x4(%eax),%eax
+  80063d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800640:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800645:	eb 74                	jmp    8006bb <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800647:	83 f9 01             	cmp    $0x1,%ecx
+  80064a:	7f 1b                	jg     800667 <vprintfmt+0x368>
+	else if (lflag)
+  80064c:	85 c9                	test   %ecx,%ecx
+  80064e:	74 2c                	je     80067c <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800650:	8b 45 14             	mov    0x14(%ebp),%eax
+  800653:	8b 10                	mov    (%eax),%edx
+  800655:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065a:	8d 40 04             	lea    0x4(%eax),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800660:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800665:	eb 54                	jmp    8006bb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800667:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066a:	8b 10                	mov    (%eax),%edx
+  80066c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80066f:	8d 40 08             	lea    0x8(%eax),%eax
+  800672:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800675:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80067a:	eb 3f                	jmp    8006bb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80067c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067f:	8b 10                	mov    (%eax),%edx
+  800681:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800686:	8d 40 04             	lea    0x4(%eax),%eax
+  800689:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80068c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800691:	eb 28                	jmp    8006bb <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800693:	83 ec 08             	sub    $0x8,%esp
+  800696:	53                   	push   %ebx
+  800697:	6a 30                	push   $0x30
+  800699:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80069b:	83 c4 08             	add    $0x8,%esp
+  80069e:	53                   	push   %ebx
+  80069f:	6a 78                	push   $0x78
+  8006a1:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8b 10                	mov    (%eax),%edx
+  8006a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006ad:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b6:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006bb:	83 ec 0c             	sub    $0xc,%esp
+  8006be:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006c2:	50                   	push   %eax
+  8006c3:	ff 75 e0             	push   -0x20(%ebp)
+  8006c6:	57                   	push   %edi
+  8006c7:	51                   	push   %ecx
+  8006c8:	52                   	push   %edx
+  8006c9:	89 da                	mov    %ebx,%edx
+  8006cb:	89 f0                	mov    %esi,%eax
+  8006cd:	e8 4a fb ff ff       	call   80021c <printnum>
+			break;
+  8006d2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006d8:	e9 40 fc ff ff       	jmp    80031d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006dd:	83 f9 01             	cmp    $0x1,%ecx
+  8006e0:	7f 1b                	jg     8006fd <vprintfmt+0x3fe>
+	else if (lflag)
+  8006e2:	85 c9                	test   %ecx,%ecx
+  8006e4:	74 2c                	je     800712 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e9:	8b 10                	mov    (%eax),%edx
+  8006eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006fb:	eb be                	jmp    8006bb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800700:	8b 10                	mov    (%eax),%edx
+  800702:	8b 48 04             	mov    0x4(%eax),%ecx
+  800705:	8d 40 08             	lea    0x8(%eax),%eax
+  800708:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80070b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800710:	eb a9                	jmp    8006bb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800712:	8b 45 14             	mov    0x14(%ebp),%eax
+  800715:	8b 10                	mov    (%eax),%edx
+  800717:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071c:	8d 40 04             	lea    0x4(%eax),%eax
+  80071f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800722:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800727:	eb 92                	jmp    8006bb <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800729:	83 ec 08             	sub    $0x8,%esp
+  80072c:	53                   	push   %ebx
+  80072d:	6a 25                	push   $0x25
+  80072f:	ff d6                	call   *%esi
+			break;
+  800731:	83 c4 10             	add    $0x10,%esp
+  800734:	eb 9f                	jmp    8006d5 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800736:	83 ec 08             	sub    $0x8,%esp
+  800739:	53                   	push   %ebx
+  80073a:	6a 25                	push   $0x25
+  80073c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80073e:	83 c4 10             	add    $0x10,%esp
+  800741:	89 f8                	mov    %edi,%eax
+  800743:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800747:	74 05                	je     80074e <vprintfmt+0x44f>
+  800749:	83 e8 01             	sub    $0x1,%eax
+  80074c:	eb f5                	jmp    800743 <vprintfmt+0x444>
+  80074e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800751:	eb 82                	jmp    8006d5 <vprintfmt+0x3d6>
+
+00800753 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800753:	55                   	push   %ebp
+  800754:	89 e5                	mov    %esp,%ebp
+  800756:	83 ec 18             	sub    $0x18,%esp
+  800759:	8b 45 08             	mov    0x8(%ebp),%eax
+  80075c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80075f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800762:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800766:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800769:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800770:	85 c0                	test   %eax,%eax
+  800772:	74 26                	je     80079a <vsnprintf+0x47>
+  800774:	85 d2                	test   %edx,%edx
+  800776:	7e 22                	jle    80079a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800778:	ff 75 14             	push   0x14(%ebp)
+  80077b:	ff 75 10             	push   0x10(%ebp)
+  80077e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800781:	50                   	push   %eax
+  800782:	68 c5 02 80 00       	push   $0x8002c5
+  800787:	e8 73 fb ff ff       	call   8002ff <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80078c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80078f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800792:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800795:	83 c4 10             	add    $0x10,%esp
+}
+  800798:	c9                   	leave
+  800799:	c3                   	ret
+		return -E_INVAL;
+  80079a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80079f:	eb f7                	jmp    800798 <vsnprintf+0x45>
+
+008007a1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007a1:	55                   	push   %ebp
+  8007a2:	89 e5                	mov    %esp,%ebp
+  8007a4:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007a7:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007aa:	50                   	push   %eax
+  8007ab:	ff 75 10             	push   0x10(%ebp)
+  8007ae:	ff 75 0c             	push   0xc(%ebp)
+  8007b1:	ff 75 08             	push   0x8(%ebp)
+  8007b4:	e8 9a ff ff ff       	call   800753 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007b9:	c9                   	leave
+  8007ba:	c3                   	ret
+
+008007bb <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007bb:	55                   	push   %ebp
+  8007bc:	89 e5                	mov    %esp,%ebp
+  8007be:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c6:	eb 03                	jmp    8007cb <strlen+0x10>
+		n++;
+  8007c8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007cb:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007cf:	75 f7                	jne    8007c8 <strlen+0xd>
+	return n;
+}
+  8007d1:	5d                   	pop    %ebp
+  8007d2:	c3                   	ret
+
+008007d3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007d3:	55                   	push   %ebp
+  8007d4:	89 e5                	mov    %esp,%ebp
+  8007d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e1:	eb 03                	jmp    8007e6 <strnlen+0x13>
+		n++;
+  8007e3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007e6:	39 d0                	cmp    %edx,%eax
+  8007e8:	74 08                	je     8007f2 <strnlen+0x1f>
+  8007ea:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007ee:	75 f3                	jne    8007e3 <strnlen+0x10>
+  8007f0:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007f2:	89 d0                	mov    %edx,%eax
+  8007f4:	5d                   	pop    %ebp
+  8007f5:	c3                   	ret
+
+008007f6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007f6:	55                   	push   %ebp
+  8007f7:	89 e5                	mov    %esp,%ebp
+  8007f9:	53                   	push   %ebx
+  8007fa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800800:	b8 00 00 00 00       	mov    $0x0,%eax
+  800805:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800809:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80080c:	83 c0 01             	add    $0x1,%eax
+  80080f:	84 d2                	test   %dl,%dl
+  800811:	75 f2                	jne    800805 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800813:	89 c8                	mov    %ecx,%eax
+  800815:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800818:	c9                   	leave
+  800819:	c3                   	ret
+
+0080081a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80081a:	55                   	push   %ebp
+  80081b:	89 e5                	mov    %esp,%ebp
+  80081d:	53                   	push   %ebx
+  80081e:	83 ec 10             	sub    $0x10,%esp
+  800821:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800824:	53                   	push   %ebx
+  800825:	e8 91 ff ff ff       	call   8007bb <strlen>
+  80082a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80082d:	ff 75 0c             	push   0xc(%ebp)
+  800830:	01 d8                	add    %ebx,%eax
+  800832:	50                   	push   %eax
+  800833:	e8 be ff ff ff       	call   8007f6 <strcpy>
+	return dst;
+}
+  800838:	89 d8                	mov    %ebx,%eax
+  80083a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083d:	c9                   	leave
+  80083e:	c3                   	ret
+
+0080083f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80083f:	55                   	push   %ebp
+  800840:	89 e5                	mov    %esp,%ebp
+  800842:	56                   	push   %esi
+  800843:	53                   	push   %ebx
+  800844:	8b 75 08             	mov    0x8(%ebp),%esi
+  800847:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80084a:	89 f3                	mov    %esi,%ebx
+  80084c:	03 5d 10             	add    0x10(%ebp),%ebx
+  80084f:	89 f0                	mov    %esi,%eax
+  800851:	eb 0f                	jmp    800862 <strncpy+0x23>
+		*dst++ = *src;
+  800853:	83 c0 01             	add    $0x1,%eax
+  800856:	0f b6 0a             	movzbl (%edx),%ecx
+  800859:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80085c:	80 f9 01             	cmp    $0x1,%cl
+  80085f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800862:	39 d8                	cmp    %ebx,%eax
+  800864:	75 ed                	jne    800853 <strncpy+0x14>
+	}
+	return ret;
+}
+  800866:	89 f0                	mov    %esi,%eax
+  800868:	5b                   	pop    %ebx
+  800869:	5e                   	pop    %esi
+  80086a:	5d                   	pop    %ebp
+  80086b:	c3                   	ret
+
+0080086c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80086c:	55                   	push   %ebp
+  80086d:	89 e5                	mov    %esp,%ebp
+  80086f:	56                   	push   %esi
+  800870:	53                   	push   %ebx
+  800871:	8b 75 08             	mov    0x8(%ebp),%esi
+  800874:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800877:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80087a:	89 f0                	mov    %esi,%eax
+  80087c:	85 d2                	test   %edx,%edx
+  80087e:	74 21                	je     8008a1 <strlcpy+0x35>
+  800880:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800884:	89 f2                	mov    %esi,%edx
+  800886:	eb 09                	jmp    800891 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800888:	83 c1 01             	add    $0x1,%ecx
+  80088b:	83 c2 01             	add    $0x1,%edx
+  80088e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800891:	39 c2                	cmp    %eax,%edx
+  800893:	74 09                	je     80089e <strlcpy+0x32>
+  800895:	0f b6 19             	movzbl (%ecx),%ebx
+  800898:	84 db                	test   %bl,%bl
+  80089a:	75 ec                	jne    800888 <strlcpy+0x1c>
+  80089c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80089e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008a1:	29 f0                	sub    %esi,%eax
+}
+  8008a3:	5b                   	pop    %ebx
+  8008a4:	5e                   	pop    %esi
+  8008a5:	5d                   	pop    %ebp
+  8008a6:	c3                   	ret
+
+008008a7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008a7:	55                   	push   %ebp
+  8008a8:	89 e5                	mov    %esp,%ebp
+  8008aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008b0:	eb 06                	jmp    8008b8 <strcmp+0x11>
+		p++, q++;
+  8008b2:	83 c1 01             	add    $0x1,%ecx
+  8008b5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008b8:	0f b6 01             	movzbl (%ecx),%eax
+  8008bb:	84 c0                	test   %al,%al
+  8008bd:	74 04                	je     8008c3 <strcmp+0x1c>
+  8008bf:	3a 02                	cmp    (%edx),%al
+  8008c1:	74 ef                	je     8008b2 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008c3:	0f b6 c0             	movzbl %al,%eax
+  8008c6:	0f b6 12             	movzbl (%edx),%edx
+  8008c9:	29 d0                	sub    %edx,%eax
+}
+  8008cb:	5d                   	pop    %ebp
+  8008cc:	c3                   	ret
+
+008008cd <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008cd:	55                   	push   %ebp
+  8008ce:	89 e5                	mov    %esp,%ebp
+  8008d0:	53                   	push   %ebx
+  8008d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008da:	eb 09                	jmp    8008e5 <strncmp+0x18>
+		n--, p++, q++;
+  8008dc:	83 ea 01             	sub    $0x1,%edx
+  8008df:	83 c0 01             	add    $0x1,%eax
+  8008e2:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008e5:	85 d2                	test   %edx,%edx
+  8008e7:	74 18                	je     800901 <strncmp+0x34>
+  8008e9:	0f b6 18             	movzbl (%eax),%ebx
+  8008ec:	84 db                	test   %bl,%bl
+  8008ee:	74 04                	je     8008f4 <strncmp+0x27>
+  8008f0:	3a 19                	cmp    (%ecx),%bl
+  8008f2:	74 e8                	je     8008dc <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008f4:	0f b6 00             	movzbl (%eax),%eax
+  8008f7:	0f b6 11             	movzbl (%ecx),%edx
+  8008fa:	29 d0                	sub    %edx,%eax
+}
+  8008fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ff:	c9                   	leave
+  800900:	c3                   	ret
+		return 0;
+  800901:	b8 00 00 00 00       	mov    $0x0,%eax
+  800906:	eb f4                	jmp    8008fc <strncmp+0x2f>
+
+00800908 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800908:	55                   	push   %ebp
+  800909:	89 e5                	mov    %esp,%ebp
+  80090b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800912:	eb 03                	jmp    800917 <strchr+0xf>
+  800914:	83 c0 01             	add    $0x1,%eax
+  800917:	0f b6 10             	movzbl (%eax),%edx
+  80091a:	84 d2                	test   %dl,%dl
+  80091c:	74 06                	je     800924 <strchr+0x1c>
+		if (*s == c)
+  80091e:	38 ca                	cmp    %cl,%dl
+  800920:	75 f2                	jne    800914 <strchr+0xc>
+  800922:	eb 05                	jmp    800929 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800924:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800929:	5d                   	pop    %ebp
+  80092a:	c3                   	ret
+
+0080092b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80092b:	55                   	push   %ebp
+  80092c:	89 e5                	mov    %esp,%ebp
+  80092e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800931:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800935:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800938:	38 ca                	cmp    %cl,%dl
+  80093a:	74 09                	je     800945 <strfind+0x1a>
+  80093c:	84 d2                	test   %dl,%dl
+  80093e:	74 05                	je     800945 <strfind+0x1a>
+	for (; *s; s++)
+  800940:	83 c0 01             	add    $0x1,%eax
+  800943:	eb f0                	jmp    800935 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800945:	5d                   	pop    %ebp
+  800946:	c3                   	ret
+
+00800947 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800947:	55                   	push   %ebp
+  800948:	89 e5                	mov    %esp,%ebp
+  80094a:	57                   	push   %edi
+  80094b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80094e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800951:	85 c9                	test   %ecx,%ecx
+  800953:	74 20                	je     800975 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800955:	89 f8                	mov    %edi,%eax
+  800957:	09 c8                	or     %ecx,%eax
+  800959:	a8 03                	test   $0x3,%al
+  80095b:	75 12                	jne    80096f <memset+0x28>
+		c &= 0xFF;
+  80095d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800961:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800967:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80096a:	fc                   	cld
+  80096b:	f3 ab                	rep stos %eax,%es:(%edi)
+  80096d:	eb 06                	jmp    800975 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80096f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800972:	fc                   	cld
+  800973:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800975:	89 f8                	mov    %edi,%eax
+  800977:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80097a:	c9                   	leave
+  80097b:	c3                   	ret
+
+0080097c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80097c:	55                   	push   %ebp
+  80097d:	89 e5                	mov    %esp,%ebp
+  80097f:	57                   	push   %edi
+  800980:	56                   	push   %esi
+  800981:	8b 45 08             	mov    0x8(%ebp),%eax
+  800984:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800987:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80098a:	39 c6                	cmp    %eax,%esi
+  80098c:	73 32                	jae    8009c0 <memmove+0x44>
+  80098e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800991:	39 d0                	cmp    %edx,%eax
+  800993:	73 2b                	jae    8009c0 <memmove+0x44>
+		s += n;
+		d += n;
+  800995:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800998:	89 d6                	mov    %edx,%esi
+  80099a:	09 fe                	or     %edi,%esi
+  80099c:	09 ce                	or     %ecx,%esi
+  80099e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009a4:	75 0e                	jne    8009b4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009a6:	83 ef 04             	sub    $0x4,%edi
+  8009a9:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009ac:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009af:	fd                   	std
+  8009b0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009b2:	eb 09                	jmp    8009bd <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009b4:	83 ef 01             	sub    $0x1,%edi
+  8009b7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009ba:	fd                   	std
+  8009bb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009bd:	fc                   	cld
+  8009be:	eb 1a                	jmp    8009da <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009c0:	89 f2                	mov    %esi,%edx
+  8009c2:	09 c2                	or     %eax,%edx
+  8009c4:	09 ca                	or     %ecx,%edx
+  8009c6:	f6 c2 03             	test   $0x3,%dl
+  8009c9:	75 0a                	jne    8009d5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009cb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009ce:	89 c7                	mov    %eax,%edi
+  8009d0:	fc                   	cld
+  8009d1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009d3:	eb 05                	jmp    8009da <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009d5:	89 c7                	mov    %eax,%edi
+  8009d7:	fc                   	cld
+  8009d8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009da:	5e                   	pop    %esi
+  8009db:	5f                   	pop    %edi
+  8009dc:	5d                   	pop    %ebp
+  8009dd:	c3                   	ret
+
+008009de <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009de:	55                   	push   %ebp
+  8009df:	89 e5                	mov    %esp,%ebp
+  8009e1:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009e4:	ff 75 10             	push   0x10(%ebp)
+  8009e7:	ff 75 0c             	push   0xc(%ebp)
+  8009ea:	ff 75 08             	push   0x8(%ebp)
+  8009ed:	e8 8a ff ff ff       	call   80097c <memmove>
+}
+  8009f2:	c9                   	leave
+  8009f3:	c3                   	ret
+
+008009f4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009f4:	55                   	push   %ebp
+  8009f5:	89 e5                	mov    %esp,%ebp
+  8009f7:	56                   	push   %esi
+  8009f8:	53                   	push   %ebx
+  8009f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009ff:	89 c6                	mov    %eax,%esi
+  800a01:	03 75 10             	add    0x10(%ebp),%esi
+  800a04:	eb 06                	jmp    800a0c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a06:	83 c0 01             	add    $0x1,%eax
+  800a09:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a0c:	39 f0                	cmp    %esi,%eax
+  800a0e:	74 14                	je     800a24 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a10:	0f b6 08             	movzbl (%eax),%ecx
+  800a13:	0f b6 1a             	movzbl (%edx),%ebx
+  800a16:	38 d9                	cmp    %bl,%cl
+  800a18:	74 ec                	je     800a06 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a1a:	0f b6 c1             	movzbl %cl,%eax
+  800a1d:	0f b6 db             	movzbl %bl,%ebx
+  800a20:	29 d8                	sub    %ebx,%eax
+  800a22:	eb 05                	jmp    800a29 <memcmp+0x35>
+	}
+
+	return 0;
+  800a24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a29:	5b                   	pop    %ebx
+  800a2a:	5e                   	pop    %esi
+  800a2b:	5d                   	pop    %ebp
+  800a2c:	c3                   	ret
+
+00800a2d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a2d:	55                   	push   %ebp
+  800a2e:	89 e5                	mov    %esp,%ebp
+  800a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a36:	89 c2                	mov    %eax,%edx
+  800a38:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a3b:	eb 03                	jmp    800a40 <memfind+0x13>
+  800a3d:	83 c0 01             	add    $0x1,%eax
+  800a40:	39 d0                	cmp    %edx,%eax
+  800a42:	73 04                	jae    800a48 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a44:	38 08                	cmp    %cl,(%eax)
+  800a46:	75 f5                	jne    800a3d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a48:	5d                   	pop    %ebp
+  800a49:	c3                   	ret
+
+00800a4a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a4a:	55                   	push   %ebp
+  800a4b:	89 e5                	mov    %esp,%ebp
+  800a4d:	57                   	push   %edi
+  800a4e:	56                   	push   %esi
+  800a4f:	53                   	push   %ebx
+  800a50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a56:	eb 03                	jmp    800a5b <strtol+0x11>
+		s++;
+  800a58:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a5b:	0f b6 02             	movzbl (%edx),%eax
+  800a5e:	3c 20                	cmp    $0x20,%al
+  800a60:	74 f6                	je     800a58 <strtol+0xe>
+  800a62:	3c 09                	cmp    $0x9,%al
+  800a64:	74 f2                	je     800a58 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a66:	3c 2b                	cmp    $0x2b,%al
+  800a68:	74 2a                	je     800a94 <strtol+0x4a>
+	int neg = 0;
+  800a6a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a6f:	3c 2d                	cmp    $0x2d,%al
+  800a71:	74 2b                	je     800a9e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a73:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a79:	75 0f                	jne    800a8a <strtol+0x40>
+  800a7b:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a7e:	74 28                	je     800aa8 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a80:	85 db                	test   %ebx,%ebx
+  800a82:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a87:	0f 44 d8             	cmove  %eax,%ebx
+  800a8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a8f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a92:	eb 46                	jmp    800ada <strtol+0x90>
+		s++;
+  800a94:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a97:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a9c:	eb d5                	jmp    800a73 <strtol+0x29>
+		s++, neg = 1;
+  800a9e:	83 c2 01             	add    $0x1,%edx
+  800aa1:	bf 01 00 00 00       	mov    $0x1,%edi
+  800aa6:	eb cb                	jmp    800a73 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa8:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800aac:	74 0e                	je     800abc <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800aae:	85 db                	test   %ebx,%ebx
+  800ab0:	75 d8                	jne    800a8a <strtol+0x40>
+		s++, base = 8;
+  800ab2:	83 c2 01             	add    $0x1,%edx
+  800ab5:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aba:	eb ce                	jmp    800a8a <strtol+0x40>
+		s += 2, base = 16;
+  800abc:	83 c2 02             	add    $0x2,%edx
+  800abf:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ac4:	eb c4                	jmp    800a8a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ac6:	0f be c0             	movsbl %al,%eax
+  800ac9:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800acc:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800acf:	7d 3a                	jge    800b0b <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ad1:	83 c2 01             	add    $0x1,%edx
+  800ad4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ad8:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ada:	0f b6 02             	movzbl (%edx),%eax
+  800add:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ae0:	89 f3                	mov    %esi,%ebx
+  800ae2:	80 fb 09             	cmp    $0x9,%bl
+  800ae5:	76 df                	jbe    800ac6 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ae7:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800aea:	89 f3                	mov    %esi,%ebx
+  800aec:	80 fb 19             	cmp    $0x19,%bl
+  800aef:	77 08                	ja     800af9 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800af1:	0f be c0             	movsbl %al,%eax
+  800af4:	83 e8 57             	sub    $0x57,%eax
+  800af7:	eb d3                	jmp    800acc <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800af9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800afc:	89 f3                	mov    %esi,%ebx
+  800afe:	80 fb 19             	cmp    $0x19,%bl
+  800b01:	77 08                	ja     800b0b <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b03:	0f be c0             	movsbl %al,%eax
+  800b06:	83 e8 37             	sub    $0x37,%eax
+  800b09:	eb c1                	jmp    800acc <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b0b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b0f:	74 05                	je     800b16 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b11:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b14:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b16:	89 c8                	mov    %ecx,%eax
+  800b18:	f7 d8                	neg    %eax
+  800b1a:	85 ff                	test   %edi,%edi
+  800b1c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b1f:	89 c8                	mov    %ecx,%eax
+  800b21:	5b                   	pop    %ebx
+  800b22:	5e                   	pop    %esi
+  800b23:	5f                   	pop    %edi
+  800b24:	5d                   	pop    %ebp
+  800b25:	c3                   	ret
+
+00800b26 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b26:	55                   	push   %ebp
+  800b27:	89 e5                	mov    %esp,%ebp
+  800b29:	57                   	push   %edi
+  800b2a:	56                   	push   %esi
+  800b2b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b37:	89 c3                	mov    %eax,%ebx
+  800b39:	89 c7                	mov    %eax,%edi
+  800b3b:	55                   	push   %ebp
+  800b3c:	89 e5                	mov    %esp,%ebp
+  800b3e:	8d 35 46 0b 80 00    	lea    0x800b46,%esi
+  800b44:	0f 34                	sysenter
+  800b46:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800b47:	5b                   	pop    %ebx
+  800b48:	5e                   	pop    %esi
+  800b49:	5f                   	pop    %edi
+  800b4a:	5d                   	pop    %ebp
+  800b4b:	c3                   	ret
+
+00800b4c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b4c:	55                   	push   %ebp
+  800b4d:	89 e5                	mov    %esp,%ebp
+  800b4f:	57                   	push   %edi
+  800b50:	56                   	push   %esi
+  800b51:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b52:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b57:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b5c:	89 d1                	mov    %edx,%ecx
+  800b5e:	89 d3                	mov    %edx,%ebx
+  800b60:	89 d7                	mov    %edx,%edi
+  800b62:	55                   	push   %ebp
+  800b63:	89 e5                	mov    %esp,%ebp
+  800b65:	8d 35 6d 0b 80 00    	lea    0x800b6d,%esi
+  800b6b:	0f 34                	sysenter
+  800b6d:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800b6e:	5b                   	pop    %ebx
+  800b6f:	5e                   	pop    %esi
+  800b70:	5f                   	pop    %edi
+  800b71:	5d                   	pop    %ebp
+  800b72:	c3                   	ret
+
+00800b73 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b73:	55                   	push   %ebp
+  800b74:	89 e5                	mov    %esp,%ebp
+  800b76:	57                   	push   %edi
+  800b77:	56                   	push   %esi
+  800b78:	53                   	push   %ebx
+  800b79:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b84:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b89:	89 cb                	mov    %ecx,%ebx
+  800b8b:	89 cf                	mov    %ecx,%edi
+  800b8d:	55                   	push   %ebp
+  800b8e:	89 e5                	mov    %esp,%ebp
+  800b90:	8d 35 98 0b 80 00    	lea    0x800b98,%esi
+  800b96:	0f 34                	sysenter
+  800b98:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b99:	85 c0                	test   %eax,%eax
+  800b9b:	7f 08                	jg     800ba5 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800b9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba0:	5b                   	pop    %ebx
+  800ba1:	5e                   	pop    %esi
+  800ba2:	5f                   	pop    %edi
+  800ba3:	5d                   	pop    %ebp
+  800ba4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ba5:	83 ec 0c             	sub    $0xc,%esp
+  800ba8:	50                   	push   %eax
+  800ba9:	6a 03                	push   $0x3
+  800bab:	68 a7 3b 80 00       	push   $0x803ba7
+  800bb0:	6a 3d                	push   $0x3d
+  800bb2:	68 c4 3b 80 00       	push   $0x803bc4
+  800bb7:	e8 71 f5 ff ff       	call   80012d <_panic>
+
+00800bbc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bbc:	55                   	push   %ebp
+  800bbd:	89 e5                	mov    %esp,%ebp
+  800bbf:	57                   	push   %edi
+  800bc0:	56                   	push   %esi
+  800bc1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800bc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bc7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bcc:	89 d1                	mov    %edx,%ecx
+  800bce:	89 d3                	mov    %edx,%ebx
+  800bd0:	89 d7                	mov    %edx,%edi
+  800bd2:	55                   	push   %ebp
+  800bd3:	89 e5                	mov    %esp,%ebp
+  800bd5:	8d 35 dd 0b 80 00    	lea    0x800bdd,%esi
+  800bdb:	0f 34                	sysenter
+  800bdd:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800bde:	5b                   	pop    %ebx
+  800bdf:	5e                   	pop    %esi
+  800be0:	5f                   	pop    %edi
+  800be1:	5d                   	pop    %ebp
+  800be2:	c3                   	ret
+
+00800be3 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800be3:	55                   	push   %ebp
+  800be4:	89 e5                	mov    %esp,%ebp
+  800be6:	57                   	push   %edi
+  800be7:	56                   	push   %esi
+  800be8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800be9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bee:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bf3:	89 d1                	mov    %edx,%ecx
+  800bf5:	89 d3                	mov    %edx,%ebx
+  800bf7:	89 d7                	mov    %edx,%edi
+  800bf9:	89 d6                	mov    %edx,%esi
+  800bfb:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bfd:	5b                   	pop    %ebx
+  800bfe:	5e                   	pop    %esi
+  800bff:	5f                   	pop    %edi
+  800c00:	5d                   	pop    %ebp
+  800c01:	c3                   	ret
+
+00800c02 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c02:	55                   	push   %ebp
+  800c03:	89 e5                	mov    %esp,%ebp
+  800c05:	57                   	push   %edi
+  800c06:	56                   	push   %esi
+  800c07:	53                   	push   %ebx
+  800c08:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c11:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c16:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c1e:	55                   	push   %ebp
+  800c1f:	89 e5                	mov    %esp,%ebp
+  800c21:	8d 35 29 0c 80 00    	lea    0x800c29,%esi
+  800c27:	0f 34                	sysenter
+  800c29:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c2a:	85 c0                	test   %eax,%eax
+  800c2c:	7f 08                	jg     800c36 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800c2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c31:	5b                   	pop    %ebx
+  800c32:	5e                   	pop    %esi
+  800c33:	5f                   	pop    %edi
+  800c34:	5d                   	pop    %ebp
+  800c35:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c36:	83 ec 0c             	sub    $0xc,%esp
+  800c39:	50                   	push   %eax
+  800c3a:	6a 04                	push   $0x4
+  800c3c:	68 a7 3b 80 00       	push   $0x803ba7
+  800c41:	6a 3d                	push   $0x3d
+  800c43:	68 c4 3b 80 00       	push   $0x803bc4
+  800c48:	e8 e0 f4 ff ff       	call   80012d <_panic>
+
+00800c4d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c4d:	55                   	push   %ebp
+  800c4e:	89 e5                	mov    %esp,%ebp
+  800c50:	57                   	push   %edi
+  800c51:	56                   	push   %esi
+  800c52:	53                   	push   %ebx
+  800c53:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c64:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c67:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c6a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c6c:	85 c0                	test   %eax,%eax
+  800c6e:	7f 08                	jg     800c78 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c73:	5b                   	pop    %ebx
+  800c74:	5e                   	pop    %esi
+  800c75:	5f                   	pop    %edi
+  800c76:	5d                   	pop    %ebp
+  800c77:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c78:	83 ec 0c             	sub    $0xc,%esp
+  800c7b:	50                   	push   %eax
+  800c7c:	6a 05                	push   $0x5
+  800c7e:	68 a7 3b 80 00       	push   $0x803ba7
+  800c83:	6a 23                	push   $0x23
+  800c85:	68 c4 3b 80 00       	push   $0x803bc4
+  800c8a:	e8 9e f4 ff ff       	call   80012d <_panic>
+
+00800c8f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c8f:	55                   	push   %ebp
+  800c90:	89 e5                	mov    %esp,%ebp
+  800c92:	57                   	push   %edi
+  800c93:	56                   	push   %esi
+  800c94:	53                   	push   %ebx
+  800c95:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca3:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ca8:	89 df                	mov    %ebx,%edi
+  800caa:	55                   	push   %ebp
+  800cab:	89 e5                	mov    %esp,%ebp
+  800cad:	8d 35 b5 0c 80 00    	lea    0x800cb5,%esi
+  800cb3:	0f 34                	sysenter
+  800cb5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cb6:	85 c0                	test   %eax,%eax
+  800cb8:	7f 08                	jg     800cc2 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800cba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbd:	5b                   	pop    %ebx
+  800cbe:	5e                   	pop    %esi
+  800cbf:	5f                   	pop    %edi
+  800cc0:	5d                   	pop    %ebp
+  800cc1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cc2:	83 ec 0c             	sub    $0xc,%esp
+  800cc5:	50                   	push   %eax
+  800cc6:	6a 06                	push   $0x6
+  800cc8:	68 a7 3b 80 00       	push   $0x803ba7
+  800ccd:	6a 3d                	push   $0x3d
+  800ccf:	68 c4 3b 80 00       	push   $0x803bc4
+  800cd4:	e8 54 f4 ff ff       	call   80012d <_panic>
+
+00800cd9 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800cd9:	55                   	push   %ebp
+  800cda:	89 e5                	mov    %esp,%ebp
+  800cdc:	57                   	push   %edi
+  800cdd:	56                   	push   %esi
+  800cde:	53                   	push   %ebx
+  800cdf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ce2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ced:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cf2:	89 df                	mov    %ebx,%edi
+  800cf4:	55                   	push   %ebp
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	8d 35 ff 0c 80 00    	lea    0x800cff,%esi
+  800cfd:	0f 34                	sysenter
+  800cff:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d00:	85 c0                	test   %eax,%eax
+  800d02:	7f 08                	jg     800d0c <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800d04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d07:	5b                   	pop    %ebx
+  800d08:	5e                   	pop    %esi
+  800d09:	5f                   	pop    %edi
+  800d0a:	5d                   	pop    %ebp
+  800d0b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d0c:	83 ec 0c             	sub    $0xc,%esp
+  800d0f:	50                   	push   %eax
+  800d10:	6a 08                	push   $0x8
+  800d12:	68 a7 3b 80 00       	push   $0x803ba7
+  800d17:	6a 3d                	push   $0x3d
+  800d19:	68 c4 3b 80 00       	push   $0x803bc4
+  800d1e:	e8 0a f4 ff ff       	call   80012d <_panic>
+
+00800d23 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d23:	55                   	push   %ebp
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	57                   	push   %edi
+  800d27:	56                   	push   %esi
+  800d28:	53                   	push   %ebx
+  800d29:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d37:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d3c:	89 df                	mov    %ebx,%edi
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	8d 35 49 0d 80 00    	lea    0x800d49,%esi
+  800d47:	0f 34                	sysenter
+  800d49:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d4a:	85 c0                	test   %eax,%eax
+  800d4c:	7f 08                	jg     800d56 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800d4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d51:	5b                   	pop    %ebx
+  800d52:	5e                   	pop    %esi
+  800d53:	5f                   	pop    %edi
+  800d54:	5d                   	pop    %ebp
+  800d55:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d56:	83 ec 0c             	sub    $0xc,%esp
+  800d59:	50                   	push   %eax
+  800d5a:	6a 09                	push   $0x9
+  800d5c:	68 a7 3b 80 00       	push   $0x803ba7
+  800d61:	6a 3d                	push   $0x3d
+  800d63:	68 c4 3b 80 00       	push   $0x803bc4
+  800d68:	e8 c0 f3 ff ff       	call   80012d <_panic>
+
+00800d6d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	57                   	push   %edi
+  800d71:	56                   	push   %esi
+  800d72:	53                   	push   %ebx
+  800d73:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d81:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d86:	89 df                	mov    %ebx,%edi
+  800d88:	55                   	push   %ebp
+  800d89:	89 e5                	mov    %esp,%ebp
+  800d8b:	8d 35 93 0d 80 00    	lea    0x800d93,%esi
+  800d91:	0f 34                	sysenter
+  800d93:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d94:	85 c0                	test   %eax,%eax
+  800d96:	7f 08                	jg     800da0 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800d98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9b:	5b                   	pop    %ebx
+  800d9c:	5e                   	pop    %esi
+  800d9d:	5f                   	pop    %edi
+  800d9e:	5d                   	pop    %ebp
+  800d9f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da0:	83 ec 0c             	sub    $0xc,%esp
+  800da3:	50                   	push   %eax
+  800da4:	6a 0a                	push   $0xa
+  800da6:	68 a7 3b 80 00       	push   $0x803ba7
+  800dab:	6a 3d                	push   $0x3d
+  800dad:	68 c4 3b 80 00       	push   $0x803bc4
+  800db2:	e8 76 f3 ff ff       	call   80012d <_panic>
+
+00800db7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800db7:	55                   	push   %ebp
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	57                   	push   %edi
+  800dbb:	56                   	push   %esi
+  800dbc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800dbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800dc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dcb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dce:	55                   	push   %ebp
+  800dcf:	89 e5                	mov    %esp,%ebp
+  800dd1:	8d 35 d9 0d 80 00    	lea    0x800dd9,%esi
+  800dd7:	0f 34                	sysenter
+  800dd9:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800dda:	5b                   	pop    %ebx
+  800ddb:	5e                   	pop    %esi
+  800ddc:	5f                   	pop    %edi
+  800ddd:	5d                   	pop    %ebp
+  800dde:	c3                   	ret
+
+00800ddf <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800ddf:	55                   	push   %ebp
+  800de0:	89 e5                	mov    %esp,%ebp
+  800de2:	57                   	push   %edi
+  800de3:	56                   	push   %esi
+  800de4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800de5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800deb:	b8 17 00 00 00       	mov    $0x17,%eax
+  800df0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800df6:	55                   	push   %ebp
+  800df7:	89 e5                	mov    %esp,%ebp
+  800df9:	8d 35 01 0e 80 00    	lea    0x800e01,%esi
+  800dff:	0f 34                	sysenter
+  800e01:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800e02:	5b                   	pop    %ebx
+  800e03:	5e                   	pop    %esi
+  800e04:	5f                   	pop    %edi
+  800e05:	5d                   	pop    %ebp
+  800e06:	c3                   	ret
+
+00800e07 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800e07:	55                   	push   %ebp
+  800e08:	89 e5                	mov    %esp,%ebp
+  800e0a:	57                   	push   %edi
+  800e0b:	56                   	push   %esi
+  800e0c:	53                   	push   %ebx
+  800e0d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e10:	be 00 00 00 00       	mov    $0x0,%esi
+  800e15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e23:	89 f7                	mov    %esi,%edi
+  800e25:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e27:	85 c0                	test   %eax,%eax
+  800e29:	7f 08                	jg     800e33 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800e2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2e:	5b                   	pop    %ebx
+  800e2f:	5e                   	pop    %esi
+  800e30:	5f                   	pop    %edi
+  800e31:	5d                   	pop    %ebp
+  800e32:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e33:	83 ec 0c             	sub    $0xc,%esp
+  800e36:	50                   	push   %eax
+  800e37:	6a 0d                	push   $0xd
+  800e39:	68 a7 3b 80 00       	push   $0x803ba7
+  800e3e:	6a 23                	push   $0x23
+  800e40:	68 c4 3b 80 00       	push   $0x803bc4
+  800e45:	e8 e3 f2 ff ff       	call   80012d <_panic>
+
+00800e4a <sys_ipc_recv>:
+{
+  800e4a:	55                   	push   %ebp
+  800e4b:	89 e5                	mov    %esp,%ebp
+  800e4d:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800e50:	6a 00                	push   $0x0
+  800e52:	6a 01                	push   $0x1
+  800e54:	ff 75 08             	push   0x8(%ebp)
+  800e57:	e8 ab ff ff ff       	call   800e07 <sys_ipc_recvv>
+}
+  800e5c:	c9                   	leave
+  800e5d:	c3                   	ret
+
+00800e5e <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800e5e:	55                   	push   %ebp
+  800e5f:	89 e5                	mov    %esp,%ebp
+  800e61:	57                   	push   %edi
+  800e62:	56                   	push   %esi
+  800e63:	53                   	push   %ebx
+  800e64:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e72:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e77:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e7a:	89 de                	mov    %ebx,%esi
+  800e7c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e7e:	85 c0                	test   %eax,%eax
+  800e80:	7f 08                	jg     800e8a <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800e82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e85:	5b                   	pop    %ebx
+  800e86:	5e                   	pop    %esi
+  800e87:	5f                   	pop    %edi
+  800e88:	5d                   	pop    %ebp
+  800e89:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8a:	83 ec 0c             	sub    $0xc,%esp
+  800e8d:	50                   	push   %eax
+  800e8e:	6a 0d                	push   $0xd
+  800e90:	68 a7 3b 80 00       	push   $0x803ba7
+  800e95:	6a 23                	push   $0x23
+  800e97:	68 c4 3b 80 00       	push   $0x803bc4
+  800e9c:	e8 8c f2 ff ff       	call   80012d <_panic>
+
+00800ea1 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ea1:	55                   	push   %ebp
+  800ea2:	89 e5                	mov    %esp,%ebp
+  800ea4:	57                   	push   %edi
+  800ea5:	56                   	push   %esi
+  800ea6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ea7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eac:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800eb1:	89 d1                	mov    %edx,%ecx
+  800eb3:	89 d3                	mov    %edx,%ebx
+  800eb5:	89 d7                	mov    %edx,%edi
+  800eb7:	55                   	push   %ebp
+  800eb8:	89 e5                	mov    %esp,%ebp
+  800eba:	8d 35 c2 0e 80 00    	lea    0x800ec2,%esi
+  800ec0:	0f 34                	sysenter
+  800ec2:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800ec3:	5b                   	pop    %ebx
+  800ec4:	5e                   	pop    %esi
+  800ec5:	5f                   	pop    %edi
+  800ec6:	5d                   	pop    %ebp
+  800ec7:	c3                   	ret
+
+00800ec8 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800ec8:	55                   	push   %ebp
+  800ec9:	89 e5                	mov    %esp,%ebp
+  800ecb:	57                   	push   %edi
+  800ecc:	56                   	push   %esi
+  800ecd:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ece:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ede:	89 df                	mov    %ebx,%edi
+  800ee0:	55                   	push   %ebp
+  800ee1:	89 e5                	mov    %esp,%ebp
+  800ee3:	8d 35 eb 0e 80 00    	lea    0x800eeb,%esi
+  800ee9:	0f 34                	sysenter
+  800eeb:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800eec:	5b                   	pop    %ebx
+  800eed:	5e                   	pop    %esi
+  800eee:	5f                   	pop    %edi
+  800eef:	5d                   	pop    %ebp
+  800ef0:	c3                   	ret
+
+00800ef1 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800ef1:	55                   	push   %ebp
+  800ef2:	89 e5                	mov    %esp,%ebp
+  800ef4:	57                   	push   %edi
+  800ef5:	56                   	push   %esi
+  800ef6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ef7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800efc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eff:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f04:	89 cb                	mov    %ecx,%ebx
+  800f06:	89 cf                	mov    %ecx,%edi
+  800f08:	55                   	push   %ebp
+  800f09:	89 e5                	mov    %esp,%ebp
+  800f0b:	8d 35 13 0f 80 00    	lea    0x800f13,%esi
+  800f11:	0f 34                	sysenter
+  800f13:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800f14:	5b                   	pop    %ebx
+  800f15:	5e                   	pop    %esi
+  800f16:	5f                   	pop    %edi
+  800f17:	5d                   	pop    %ebp
+  800f18:	c3                   	ret
+
+00800f19 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	57                   	push   %edi
+  800f1d:	56                   	push   %esi
+  800f1e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f24:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2a:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f2f:	89 df                	mov    %ebx,%edi
+  800f31:	55                   	push   %ebp
+  800f32:	89 e5                	mov    %esp,%ebp
+  800f34:	8d 35 3c 0f 80 00    	lea    0x800f3c,%esi
+  800f3a:	0f 34                	sysenter
+  800f3c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800f3d:	5b                   	pop    %ebx
+  800f3e:	5e                   	pop    %esi
+  800f3f:	5f                   	pop    %edi
+  800f40:	5d                   	pop    %ebp
+  800f41:	c3                   	ret
+
+00800f42 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800f42:	55                   	push   %ebp
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	57                   	push   %edi
+  800f46:	56                   	push   %esi
+  800f47:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f53:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f58:	89 df                	mov    %ebx,%edi
+  800f5a:	55                   	push   %ebp
+  800f5b:	89 e5                	mov    %esp,%ebp
+  800f5d:	8d 35 65 0f 80 00    	lea    0x800f65,%esi
+  800f63:	0f 34                	sysenter
+  800f65:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800f66:	5b                   	pop    %ebx
+  800f67:	5e                   	pop    %esi
+  800f68:	5f                   	pop    %edi
+  800f69:	5d                   	pop    %ebp
+  800f6a:	c3                   	ret
+
+00800f6b <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800f6b:	55                   	push   %ebp
+  800f6c:	89 e5                	mov    %esp,%ebp
+  800f6e:	57                   	push   %edi
+  800f6f:	56                   	push   %esi
+  800f70:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f77:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f7c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f7f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f82:	55                   	push   %ebp
+  800f83:	89 e5                	mov    %esp,%ebp
+  800f85:	8d 35 8d 0f 80 00    	lea    0x800f8d,%esi
+  800f8b:	0f 34                	sysenter
+  800f8d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800f8e:	5b                   	pop    %ebx
+  800f8f:	5e                   	pop    %esi
+  800f90:	5f                   	pop    %edi
+  800f91:	5d                   	pop    %ebp
+  800f92:	c3                   	ret
+
+00800f93 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800f93:	55                   	push   %ebp
+  800f94:	89 e5                	mov    %esp,%ebp
+  800f96:	57                   	push   %edi
+  800f97:	56                   	push   %esi
+  800f98:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa1:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fa6:	89 cb                	mov    %ecx,%ebx
+  800fa8:	89 cf                	mov    %ecx,%edi
+  800faa:	89 ce                	mov    %ecx,%esi
+  800fac:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800fae:	5b                   	pop    %ebx
+  800faf:	5e                   	pop    %esi
+  800fb0:	5f                   	pop    %edi
+  800fb1:	5d                   	pop    %ebp
+  800fb2:	c3                   	ret
+
+00800fb3 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800fb3:	55                   	push   %ebp
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	57                   	push   %edi
+  800fb7:	56                   	push   %esi
+  800fb8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fb9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc1:	b8 15 00 00 00       	mov    $0x15,%eax
+  800fc6:	89 cb                	mov    %ecx,%ebx
+  800fc8:	89 cf                	mov    %ecx,%edi
+  800fca:	55                   	push   %ebp
+  800fcb:	89 e5                	mov    %esp,%ebp
+  800fcd:	8d 35 d5 0f 80 00    	lea    0x800fd5,%esi
+  800fd3:	0f 34                	sysenter
+  800fd5:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800fd6:	5b                   	pop    %ebx
+  800fd7:	5e                   	pop    %esi
+  800fd8:	5f                   	pop    %edi
+  800fd9:	5d                   	pop    %ebp
+  800fda:	c3                   	ret
+
+00800fdb <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800fdb:	55                   	push   %ebp
+  800fdc:	89 e5                	mov    %esp,%ebp
+  800fde:	57                   	push   %edi
+  800fdf:	56                   	push   %esi
+  800fe0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fe1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe9:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fee:	89 cb                	mov    %ecx,%ebx
+  800ff0:	89 cf                	mov    %ecx,%edi
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	8d 35 fd 0f 80 00    	lea    0x800ffd,%esi
+  800ffb:	0f 34                	sysenter
+  800ffd:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800ffe:	5b                   	pop    %ebx
+  800fff:	5e                   	pop    %esi
+  801000:	5f                   	pop    %edi
+  801001:	5d                   	pop    %ebp
+  801002:	c3                   	ret
+
+00801003 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801003:	55                   	push   %ebp
+  801004:	89 e5                	mov    %esp,%ebp
+  801006:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  801009:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801010:	74 0a                	je     80101c <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801012:	8b 45 08             	mov    0x8(%ebp),%eax
+  801015:	a3 04 50 80 00       	mov    %eax,0x805004
+}
+  80101a:	c9                   	leave
+  80101b:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80101c:	83 ec 04             	sub    $0x4,%esp
+  80101f:	6a 07                	push   $0x7
+  801021:	68 00 f0 bf ee       	push   $0xeebff000
+  801026:	6a 00                	push   $0x0
+  801028:	e8 d5 fb ff ff       	call   800c02 <sys_page_alloc>
+  80102d:	83 c4 10             	add    $0x10,%esp
+  801030:	85 c0                	test   %eax,%eax
+  801032:	75 2c                	jne    801060 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  801034:	83 ec 08             	sub    $0x8,%esp
+  801037:	68 76 10 80 00       	push   $0x801076
+  80103c:	6a 00                	push   $0x0
+  80103e:	e8 2a fd ff ff       	call   800d6d <sys_env_set_pgfault_upcall>
+  801043:	83 c4 10             	add    $0x10,%esp
+  801046:	85 c0                	test   %eax,%eax
+  801048:	74 c8                	je     801012 <set_pgfault_handler+0xf>
+  80104a:	68 1c 3c 80 00       	push   $0x803c1c
+  80104f:	68 4c 3c 80 00       	push   $0x803c4c
+  801054:	6a 20                	push   $0x20
+  801056:	68 61 3c 80 00       	push   $0x803c61
+  80105b:	e8 cd f0 ff ff       	call   80012d <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  801060:	68 d4 3b 80 00       	push   $0x803bd4
+  801065:	68 4c 3c 80 00       	push   $0x803c4c
+  80106a:	6a 1e                	push   $0x1e
+  80106c:	68 61 3c 80 00       	push   $0x803c61
+  801071:	e8 b7 f0 ff ff       	call   80012d <_panic>
+
+00801076 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801076:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801077:	a1 04 50 80 00       	mov    0x805004,%eax
+	call *%eax
+  80107c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80107e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  801081:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  801086:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  80108b:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  80108f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  801092:	83 c4 08             	add    $0x8,%esp
+	popal
+  801095:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  801096:	83 c4 04             	add    $0x4,%esp
+	popfl
+  801099:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  80109a:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80109b:	c3                   	ret
+
+0080109c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80109c:	55                   	push   %ebp
+  80109d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80109f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010a2:	05 00 00 00 30       	add    $0x30000000,%eax
+  8010a7:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8010aa:	5d                   	pop    %ebp
+  8010ab:	c3                   	ret
+
+008010ac <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010b2:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8010b7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8010bc:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8010c1:	5d                   	pop    %ebp
+  8010c2:	c3                   	ret
+
+008010c3 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8010c3:	55                   	push   %ebp
+  8010c4:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8010c6:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8010cb:	eb 02                	jmp    8010cf <fd_alloc+0xc>
+  8010cd:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8010cf:	89 c2                	mov    %eax,%edx
+  8010d1:	c1 ea 16             	shr    $0x16,%edx
+  8010d4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8010db:	f6 c2 01             	test   $0x1,%dl
+  8010de:	74 2b                	je     80110b <fd_alloc+0x48>
+  8010e0:	89 c2                	mov    %eax,%edx
+  8010e2:	c1 ea 0c             	shr    $0xc,%edx
+  8010e5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8010ec:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8010f2:	f6 c1 01             	test   $0x1,%cl
+  8010f5:	74 14                	je     80110b <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8010f7:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8010fd:	75 ce                	jne    8010cd <fd_alloc+0xa>
+  8010ff:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801104:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801109:	eb 05                	jmp    801110 <fd_alloc+0x4d>
+			return 0;
+  80110b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801110:	8b 55 08             	mov    0x8(%ebp),%edx
+  801113:	89 02                	mov    %eax,(%edx)
+}
+  801115:	89 c8                	mov    %ecx,%eax
+  801117:	5d                   	pop    %ebp
+  801118:	c3                   	ret
+
+00801119 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801119:	55                   	push   %ebp
+  80111a:	89 e5                	mov    %esp,%ebp
+  80111c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80111f:	83 f8 1f             	cmp    $0x1f,%eax
+  801122:	77 30                	ja     801154 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801124:	c1 e0 0c             	shl    $0xc,%eax
+  801127:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80112c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801132:	f6 c2 01             	test   $0x1,%dl
+  801135:	74 24                	je     80115b <fd_lookup+0x42>
+  801137:	89 c2                	mov    %eax,%edx
+  801139:	c1 ea 0c             	shr    $0xc,%edx
+  80113c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801143:	f6 c2 01             	test   $0x1,%dl
+  801146:	74 1a                	je     801162 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801148:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80114b:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80114d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801152:	5d                   	pop    %ebp
+  801153:	c3                   	ret
+		return -E_INVAL;
+  801154:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801159:	eb f7                	jmp    801152 <fd_lookup+0x39>
+		return -E_INVAL;
+  80115b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801160:	eb f0                	jmp    801152 <fd_lookup+0x39>
+  801162:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801167:	eb e9                	jmp    801152 <fd_lookup+0x39>
+
+00801169 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801169:	55                   	push   %ebp
+  80116a:	89 e5                	mov    %esp,%ebp
+  80116c:	53                   	push   %ebx
+  80116d:	83 ec 04             	sub    $0x4,%esp
+  801170:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801173:	b8 00 00 00 00       	mov    $0x0,%eax
+  801178:	eb 03                	jmp    80117d <dev_lookup+0x14>
+  80117a:	83 c0 01             	add    $0x1,%eax
+  80117d:	8b 1c 85 ec 3c 80 00 	mov    0x803cec(,%eax,4),%ebx
+  801184:	85 db                	test   %ebx,%ebx
+  801186:	74 0b                	je     801193 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801188:	39 13                	cmp    %edx,(%ebx)
+  80118a:	75 ee                	jne    80117a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80118c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801191:	eb 1f                	jmp    8011b2 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801193:	a1 00 50 80 00       	mov    0x805000,%eax
+  801198:	8b 40 48             	mov    0x48(%eax),%eax
+  80119b:	83 ec 04             	sub    $0x4,%esp
+  80119e:	52                   	push   %edx
+  80119f:	50                   	push   %eax
+  8011a0:	68 70 3c 80 00       	push   $0x803c70
+  8011a5:	e8 5e f0 ff ff       	call   800208 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8011aa:	83 c4 10             	add    $0x10,%esp
+  8011ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8011b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011b5:	89 1a                	mov    %ebx,(%edx)
+}
+  8011b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011ba:	c9                   	leave
+  8011bb:	c3                   	ret
+
+008011bc <fd_close>:
+{
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	57                   	push   %edi
+  8011c0:	56                   	push   %esi
+  8011c1:	53                   	push   %ebx
+  8011c2:	83 ec 24             	sub    $0x24,%esp
+  8011c5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011c8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011cb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011ce:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011cf:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8011d5:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011d8:	50                   	push   %eax
+  8011d9:	e8 3b ff ff ff       	call   801119 <fd_lookup>
+  8011de:	89 c3                	mov    %eax,%ebx
+  8011e0:	83 c4 10             	add    $0x10,%esp
+  8011e3:	85 c0                	test   %eax,%eax
+  8011e5:	78 05                	js     8011ec <fd_close+0x30>
+	    || fd != fd2)
+  8011e7:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011ea:	74 16                	je     801202 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8011ec:	89 f8                	mov    %edi,%eax
+  8011ee:	84 c0                	test   %al,%al
+  8011f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f5:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8011f8:	89 d8                	mov    %ebx,%eax
+  8011fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011fd:	5b                   	pop    %ebx
+  8011fe:	5e                   	pop    %esi
+  8011ff:	5f                   	pop    %edi
+  801200:	5d                   	pop    %ebp
+  801201:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801202:	83 ec 08             	sub    $0x8,%esp
+  801205:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801208:	50                   	push   %eax
+  801209:	ff 36                	push   (%esi)
+  80120b:	e8 59 ff ff ff       	call   801169 <dev_lookup>
+  801210:	89 c3                	mov    %eax,%ebx
+  801212:	83 c4 10             	add    $0x10,%esp
+  801215:	85 c0                	test   %eax,%eax
+  801217:	78 1a                	js     801233 <fd_close+0x77>
+		if (dev->dev_close)
+  801219:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80121c:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80121f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801224:	85 c0                	test   %eax,%eax
+  801226:	74 0b                	je     801233 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801228:	83 ec 0c             	sub    $0xc,%esp
+  80122b:	56                   	push   %esi
+  80122c:	ff d0                	call   *%eax
+  80122e:	89 c3                	mov    %eax,%ebx
+  801230:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801233:	83 ec 08             	sub    $0x8,%esp
+  801236:	56                   	push   %esi
+  801237:	6a 00                	push   $0x0
+  801239:	e8 51 fa ff ff       	call   800c8f <sys_page_unmap>
+	return r;
+  80123e:	83 c4 10             	add    $0x10,%esp
+  801241:	eb b5                	jmp    8011f8 <fd_close+0x3c>
+
+00801243 <close>:
+
+int
+close(int fdnum)
+{
+  801243:	55                   	push   %ebp
+  801244:	89 e5                	mov    %esp,%ebp
+  801246:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801249:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80124c:	50                   	push   %eax
+  80124d:	ff 75 08             	push   0x8(%ebp)
+  801250:	e8 c4 fe ff ff       	call   801119 <fd_lookup>
+  801255:	83 c4 10             	add    $0x10,%esp
+  801258:	85 c0                	test   %eax,%eax
+  80125a:	79 02                	jns    80125e <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80125c:	c9                   	leave
+  80125d:	c3                   	ret
+		return fd_close(fd, 1);
+  80125e:	83 ec 08             	sub    $0x8,%esp
+  801261:	6a 01                	push   $0x1
+  801263:	ff 75 f4             	push   -0xc(%ebp)
+  801266:	e8 51 ff ff ff       	call   8011bc <fd_close>
+  80126b:	83 c4 10             	add    $0x10,%esp
+  80126e:	eb ec                	jmp    80125c <close+0x19>
+
+00801270 <close_all>:
+
+void
+close_all(void)
+{
+  801270:	55                   	push   %ebp
+  801271:	89 e5                	mov    %esp,%ebp
+  801273:	53                   	push   %ebx
+  801274:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801277:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80127c:	83 ec 0c             	sub    $0xc,%esp
+  80127f:	53                   	push   %ebx
+  801280:	e8 be ff ff ff       	call   801243 <close>
+	for (i = 0; i < MAXFD; i++)
+  801285:	83 c3 01             	add    $0x1,%ebx
+  801288:	83 c4 10             	add    $0x10,%esp
+  80128b:	83 fb 20             	cmp    $0x20,%ebx
+  80128e:	75 ec                	jne    80127c <close_all+0xc>
+}
+  801290:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801293:	c9                   	leave
+  801294:	c3                   	ret
+
+00801295 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801295:	55                   	push   %ebp
+  801296:	89 e5                	mov    %esp,%ebp
+  801298:	57                   	push   %edi
+  801299:	56                   	push   %esi
+  80129a:	53                   	push   %ebx
+  80129b:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80129e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012a1:	50                   	push   %eax
+  8012a2:	ff 75 08             	push   0x8(%ebp)
+  8012a5:	e8 6f fe ff ff       	call   801119 <fd_lookup>
+  8012aa:	89 c3                	mov    %eax,%ebx
+  8012ac:	83 c4 10             	add    $0x10,%esp
+  8012af:	85 c0                	test   %eax,%eax
+  8012b1:	78 7f                	js     801332 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8012b3:	83 ec 0c             	sub    $0xc,%esp
+  8012b6:	ff 75 0c             	push   0xc(%ebp)
+  8012b9:	e8 85 ff ff ff       	call   801243 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8012be:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8012c1:	c1 e6 0c             	shl    $0xc,%esi
+  8012c4:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8012ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8012cd:	89 3c 24             	mov    %edi,(%esp)
+  8012d0:	e8 d7 fd ff ff       	call   8010ac <fd2data>
+  8012d5:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8012d7:	89 34 24             	mov    %esi,(%esp)
+  8012da:	e8 cd fd ff ff       	call   8010ac <fd2data>
+  8012df:	83 c4 10             	add    $0x10,%esp
+  8012e2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8012e5:	89 d8                	mov    %ebx,%eax
+  8012e7:	c1 e8 16             	shr    $0x16,%eax
+  8012ea:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012f1:	a8 01                	test   $0x1,%al
+  8012f3:	74 11                	je     801306 <dup+0x71>
+  8012f5:	89 d8                	mov    %ebx,%eax
+  8012f7:	c1 e8 0c             	shr    $0xc,%eax
+  8012fa:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801301:	f6 c2 01             	test   $0x1,%dl
+  801304:	75 36                	jne    80133c <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801306:	89 f8                	mov    %edi,%eax
+  801308:	c1 e8 0c             	shr    $0xc,%eax
+  80130b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801312:	83 ec 0c             	sub    $0xc,%esp
+  801315:	25 07 0e 00 00       	and    $0xe07,%eax
+  80131a:	50                   	push   %eax
+  80131b:	56                   	push   %esi
+  80131c:	6a 00                	push   $0x0
+  80131e:	57                   	push   %edi
+  80131f:	6a 00                	push   $0x0
+  801321:	e8 27 f9 ff ff       	call   800c4d <sys_page_map>
+  801326:	89 c3                	mov    %eax,%ebx
+  801328:	83 c4 20             	add    $0x20,%esp
+  80132b:	85 c0                	test   %eax,%eax
+  80132d:	78 33                	js     801362 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80132f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801332:	89 d8                	mov    %ebx,%eax
+  801334:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801337:	5b                   	pop    %ebx
+  801338:	5e                   	pop    %esi
+  801339:	5f                   	pop    %edi
+  80133a:	5d                   	pop    %ebp
+  80133b:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80133c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801343:	83 ec 0c             	sub    $0xc,%esp
+  801346:	25 07 0e 00 00       	and    $0xe07,%eax
+  80134b:	50                   	push   %eax
+  80134c:	ff 75 d4             	push   -0x2c(%ebp)
+  80134f:	6a 00                	push   $0x0
+  801351:	53                   	push   %ebx
+  801352:	6a 00                	push   $0x0
+  801354:	e8 f4 f8 ff ff       	call   800c4d <sys_page_map>
+  801359:	89 c3                	mov    %eax,%ebx
+  80135b:	83 c4 20             	add    $0x20,%esp
+  80135e:	85 c0                	test   %eax,%eax
+  801360:	79 a4                	jns    801306 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801362:	83 ec 08             	sub    $0x8,%esp
+  801365:	56                   	push   %esi
+  801366:	6a 00                	push   $0x0
+  801368:	e8 22 f9 ff ff       	call   800c8f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80136d:	83 c4 08             	add    $0x8,%esp
+  801370:	ff 75 d4             	push   -0x2c(%ebp)
+  801373:	6a 00                	push   $0x0
+  801375:	e8 15 f9 ff ff       	call   800c8f <sys_page_unmap>
+	return r;
+  80137a:	83 c4 10             	add    $0x10,%esp
+  80137d:	eb b3                	jmp    801332 <dup+0x9d>
+
+0080137f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80137f:	55                   	push   %ebp
+  801380:	89 e5                	mov    %esp,%ebp
+  801382:	56                   	push   %esi
+  801383:	53                   	push   %ebx
+  801384:	83 ec 18             	sub    $0x18,%esp
+  801387:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80138a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80138d:	50                   	push   %eax
+  80138e:	56                   	push   %esi
+  80138f:	e8 85 fd ff ff       	call   801119 <fd_lookup>
+  801394:	83 c4 10             	add    $0x10,%esp
+  801397:	85 c0                	test   %eax,%eax
+  801399:	78 3c                	js     8013d7 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80139b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80139e:	83 ec 08             	sub    $0x8,%esp
+  8013a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013a4:	50                   	push   %eax
+  8013a5:	ff 33                	push   (%ebx)
+  8013a7:	e8 bd fd ff ff       	call   801169 <dev_lookup>
+  8013ac:	83 c4 10             	add    $0x10,%esp
+  8013af:	85 c0                	test   %eax,%eax
+  8013b1:	78 24                	js     8013d7 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8013b3:	8b 43 08             	mov    0x8(%ebx),%eax
+  8013b6:	83 e0 03             	and    $0x3,%eax
+  8013b9:	83 f8 01             	cmp    $0x1,%eax
+  8013bc:	74 20                	je     8013de <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8013be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013c1:	8b 40 08             	mov    0x8(%eax),%eax
+  8013c4:	85 c0                	test   %eax,%eax
+  8013c6:	74 37                	je     8013ff <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8013c8:	83 ec 04             	sub    $0x4,%esp
+  8013cb:	ff 75 10             	push   0x10(%ebp)
+  8013ce:	ff 75 0c             	push   0xc(%ebp)
+  8013d1:	53                   	push   %ebx
+  8013d2:	ff d0                	call   *%eax
+  8013d4:	83 c4 10             	add    $0x10,%esp
+}
+  8013d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013da:	5b                   	pop    %ebx
+  8013db:	5e                   	pop    %esi
+  8013dc:	5d                   	pop    %ebp
+  8013dd:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013de:	a1 00 50 80 00       	mov    0x805000,%eax
+  8013e3:	8b 40 48             	mov    0x48(%eax),%eax
+  8013e6:	83 ec 04             	sub    $0x4,%esp
+  8013e9:	56                   	push   %esi
+  8013ea:	50                   	push   %eax
+  8013eb:	68 b1 3c 80 00       	push   $0x803cb1
+  8013f0:	e8 13 ee ff ff       	call   800208 <cprintf>
+		return -E_INVAL;
+  8013f5:	83 c4 10             	add    $0x10,%esp
+  8013f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013fd:	eb d8                	jmp    8013d7 <read+0x58>
+		return -E_NOT_SUPP;
+  8013ff:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801404:	eb d1                	jmp    8013d7 <read+0x58>
+
+00801406 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801406:	55                   	push   %ebp
+  801407:	89 e5                	mov    %esp,%ebp
+  801409:	57                   	push   %edi
+  80140a:	56                   	push   %esi
+  80140b:	53                   	push   %ebx
+  80140c:	83 ec 0c             	sub    $0xc,%esp
+  80140f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801412:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801415:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141a:	eb 02                	jmp    80141e <readn+0x18>
+  80141c:	01 c3                	add    %eax,%ebx
+  80141e:	39 f3                	cmp    %esi,%ebx
+  801420:	73 21                	jae    801443 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801422:	83 ec 04             	sub    $0x4,%esp
+  801425:	89 f0                	mov    %esi,%eax
+  801427:	29 d8                	sub    %ebx,%eax
+  801429:	50                   	push   %eax
+  80142a:	89 d8                	mov    %ebx,%eax
+  80142c:	03 45 0c             	add    0xc(%ebp),%eax
+  80142f:	50                   	push   %eax
+  801430:	57                   	push   %edi
+  801431:	e8 49 ff ff ff       	call   80137f <read>
+		if (m < 0)
+  801436:	83 c4 10             	add    $0x10,%esp
+  801439:	85 c0                	test   %eax,%eax
+  80143b:	78 04                	js     801441 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80143d:	75 dd                	jne    80141c <readn+0x16>
+  80143f:	eb 02                	jmp    801443 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801441:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801443:	89 d8                	mov    %ebx,%eax
+  801445:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801448:	5b                   	pop    %ebx
+  801449:	5e                   	pop    %esi
+  80144a:	5f                   	pop    %edi
+  80144b:	5d                   	pop    %ebp
+  80144c:	c3                   	ret
+
+0080144d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80144d:	55                   	push   %ebp
+  80144e:	89 e5                	mov    %esp,%ebp
+  801450:	56                   	push   %esi
+  801451:	53                   	push   %ebx
+  801452:	83 ec 18             	sub    $0x18,%esp
+  801455:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801458:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80145b:	50                   	push   %eax
+  80145c:	53                   	push   %ebx
+  80145d:	e8 b7 fc ff ff       	call   801119 <fd_lookup>
+  801462:	83 c4 10             	add    $0x10,%esp
+  801465:	85 c0                	test   %eax,%eax
+  801467:	78 37                	js     8014a0 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801469:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80146c:	83 ec 08             	sub    $0x8,%esp
+  80146f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801472:	50                   	push   %eax
+  801473:	ff 36                	push   (%esi)
+  801475:	e8 ef fc ff ff       	call   801169 <dev_lookup>
+  80147a:	83 c4 10             	add    $0x10,%esp
+  80147d:	85 c0                	test   %eax,%eax
+  80147f:	78 1f                	js     8014a0 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801481:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801485:	74 20                	je     8014a7 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801487:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80148a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80148d:	85 c0                	test   %eax,%eax
+  80148f:	74 37                	je     8014c8 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801491:	83 ec 04             	sub    $0x4,%esp
+  801494:	ff 75 10             	push   0x10(%ebp)
+  801497:	ff 75 0c             	push   0xc(%ebp)
+  80149a:	56                   	push   %esi
+  80149b:	ff d0                	call   *%eax
+  80149d:	83 c4 10             	add    $0x10,%esp
+}
+  8014a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014a3:	5b                   	pop    %ebx
+  8014a4:	5e                   	pop    %esi
+  8014a5:	5d                   	pop    %ebp
+  8014a6:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014a7:	a1 00 50 80 00       	mov    0x805000,%eax
+  8014ac:	8b 40 48             	mov    0x48(%eax),%eax
+  8014af:	83 ec 04             	sub    $0x4,%esp
+  8014b2:	53                   	push   %ebx
+  8014b3:	50                   	push   %eax
+  8014b4:	68 cd 3c 80 00       	push   $0x803ccd
+  8014b9:	e8 4a ed ff ff       	call   800208 <cprintf>
+		return -E_INVAL;
+  8014be:	83 c4 10             	add    $0x10,%esp
+  8014c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014c6:	eb d8                	jmp    8014a0 <write+0x53>
+		return -E_NOT_SUPP;
+  8014c8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014cd:	eb d1                	jmp    8014a0 <write+0x53>
+
+008014cf <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8014cf:	55                   	push   %ebp
+  8014d0:	89 e5                	mov    %esp,%ebp
+  8014d2:	53                   	push   %ebx
+  8014d3:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014d6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014d9:	50                   	push   %eax
+  8014da:	ff 75 08             	push   0x8(%ebp)
+  8014dd:	e8 37 fc ff ff       	call   801119 <fd_lookup>
+  8014e2:	83 c4 10             	add    $0x10,%esp
+  8014e5:	85 c0                	test   %eax,%eax
+  8014e7:	78 3a                	js     801523 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014e9:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014ec:	83 ec 08             	sub    $0x8,%esp
+  8014ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014f2:	50                   	push   %eax
+  8014f3:	ff 33                	push   (%ebx)
+  8014f5:	e8 6f fc ff ff       	call   801169 <dev_lookup>
+  8014fa:	83 c4 10             	add    $0x10,%esp
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	78 22                	js     801523 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801501:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801504:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801507:	85 c0                	test   %eax,%eax
+  801509:	74 0d                	je     801518 <seek+0x49>
+  80150b:	83 ec 0c             	sub    $0xc,%esp
+  80150e:	53                   	push   %ebx
+  80150f:	ff d0                	call   *%eax
+  801511:	83 c4 10             	add    $0x10,%esp
+  801514:	85 c0                	test   %eax,%eax
+  801516:	78 0b                	js     801523 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801518:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80151b:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  80151e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801523:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801526:	c9                   	leave
+  801527:	c3                   	ret
+
+00801528 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801528:	55                   	push   %ebp
+  801529:	89 e5                	mov    %esp,%ebp
+  80152b:	53                   	push   %ebx
+  80152c:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80152f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801532:	50                   	push   %eax
+  801533:	ff 75 08             	push   0x8(%ebp)
+  801536:	e8 de fb ff ff       	call   801119 <fd_lookup>
+  80153b:	83 c4 10             	add    $0x10,%esp
+  80153e:	85 c0                	test   %eax,%eax
+  801540:	78 2b                	js     80156d <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801542:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801545:	83 ec 08             	sub    $0x8,%esp
+  801548:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80154b:	50                   	push   %eax
+  80154c:	ff 33                	push   (%ebx)
+  80154e:	e8 16 fc ff ff       	call   801169 <dev_lookup>
+  801553:	83 c4 10             	add    $0x10,%esp
+  801556:	85 c0                	test   %eax,%eax
+  801558:	78 13                	js     80156d <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  80155a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80155d:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801560:	85 c0                	test   %eax,%eax
+  801562:	74 0e                	je     801572 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801564:	83 ec 0c             	sub    $0xc,%esp
+  801567:	53                   	push   %ebx
+  801568:	ff d0                	call   *%eax
+  80156a:	83 c4 10             	add    $0x10,%esp
+}
+  80156d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801570:	c9                   	leave
+  801571:	c3                   	ret
+		return 0;
+  801572:	b8 00 00 00 00       	mov    $0x0,%eax
+  801577:	eb f4                	jmp    80156d <fsync+0x45>
+
+00801579 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801579:	55                   	push   %ebp
+  80157a:	89 e5                	mov    %esp,%ebp
+  80157c:	56                   	push   %esi
+  80157d:	53                   	push   %ebx
+  80157e:	83 ec 18             	sub    $0x18,%esp
+  801581:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801584:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801587:	50                   	push   %eax
+  801588:	53                   	push   %ebx
+  801589:	e8 8b fb ff ff       	call   801119 <fd_lookup>
+  80158e:	83 c4 10             	add    $0x10,%esp
+  801591:	85 c0                	test   %eax,%eax
+  801593:	78 34                	js     8015c9 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801595:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801598:	83 ec 08             	sub    $0x8,%esp
+  80159b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80159e:	50                   	push   %eax
+  80159f:	ff 36                	push   (%esi)
+  8015a1:	e8 c3 fb ff ff       	call   801169 <dev_lookup>
+  8015a6:	83 c4 10             	add    $0x10,%esp
+  8015a9:	85 c0                	test   %eax,%eax
+  8015ab:	78 1c                	js     8015c9 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015ad:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015b1:	74 1d                	je     8015d0 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8015b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015b6:	8b 40 18             	mov    0x18(%eax),%eax
+  8015b9:	85 c0                	test   %eax,%eax
+  8015bb:	74 34                	je     8015f1 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8015bd:	83 ec 08             	sub    $0x8,%esp
+  8015c0:	ff 75 0c             	push   0xc(%ebp)
+  8015c3:	56                   	push   %esi
+  8015c4:	ff d0                	call   *%eax
+  8015c6:	83 c4 10             	add    $0x10,%esp
+}
+  8015c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015cc:	5b                   	pop    %ebx
+  8015cd:	5e                   	pop    %esi
+  8015ce:	5d                   	pop    %ebp
+  8015cf:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8015d0:	a1 00 50 80 00       	mov    0x805000,%eax
+  8015d5:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015d8:	83 ec 04             	sub    $0x4,%esp
+  8015db:	53                   	push   %ebx
+  8015dc:	50                   	push   %eax
+  8015dd:	68 90 3c 80 00       	push   $0x803c90
+  8015e2:	e8 21 ec ff ff       	call   800208 <cprintf>
+		return -E_INVAL;
+  8015e7:	83 c4 10             	add    $0x10,%esp
+  8015ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ef:	eb d8                	jmp    8015c9 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8015f1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015f6:	eb d1                	jmp    8015c9 <ftruncate+0x50>
+
+008015f8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015f8:	55                   	push   %ebp
+  8015f9:	89 e5                	mov    %esp,%ebp
+  8015fb:	56                   	push   %esi
+  8015fc:	53                   	push   %ebx
+  8015fd:	83 ec 18             	sub    $0x18,%esp
+  801600:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801603:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801606:	50                   	push   %eax
+  801607:	ff 75 08             	push   0x8(%ebp)
+  80160a:	e8 0a fb ff ff       	call   801119 <fd_lookup>
+  80160f:	83 c4 10             	add    $0x10,%esp
+  801612:	85 c0                	test   %eax,%eax
+  801614:	78 49                	js     80165f <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801616:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801619:	83 ec 08             	sub    $0x8,%esp
+  80161c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80161f:	50                   	push   %eax
+  801620:	ff 36                	push   (%esi)
+  801622:	e8 42 fb ff ff       	call   801169 <dev_lookup>
+  801627:	83 c4 10             	add    $0x10,%esp
+  80162a:	85 c0                	test   %eax,%eax
+  80162c:	78 31                	js     80165f <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80162e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801631:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801635:	74 2f                	je     801666 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801637:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80163a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801641:	00 00 00 
+	stat->st_isdir = 0;
+  801644:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80164b:	00 00 00 
+	stat->st_dev = dev;
+  80164e:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801654:	83 ec 08             	sub    $0x8,%esp
+  801657:	53                   	push   %ebx
+  801658:	56                   	push   %esi
+  801659:	ff 50 14             	call   *0x14(%eax)
+  80165c:	83 c4 10             	add    $0x10,%esp
+}
+  80165f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801662:	5b                   	pop    %ebx
+  801663:	5e                   	pop    %esi
+  801664:	5d                   	pop    %ebp
+  801665:	c3                   	ret
+		return -E_NOT_SUPP;
+  801666:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80166b:	eb f2                	jmp    80165f <fstat+0x67>
+
+0080166d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80166d:	55                   	push   %ebp
+  80166e:	89 e5                	mov    %esp,%ebp
+  801670:	56                   	push   %esi
+  801671:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801672:	83 ec 08             	sub    $0x8,%esp
+  801675:	68 00 10 00 00       	push   $0x1000
+  80167a:	ff 75 08             	push   0x8(%ebp)
+  80167d:	e8 b3 07 00 00       	call   801e35 <open>
+  801682:	89 c3                	mov    %eax,%ebx
+  801684:	83 c4 10             	add    $0x10,%esp
+  801687:	85 c0                	test   %eax,%eax
+  801689:	78 1b                	js     8016a6 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  80168b:	83 ec 08             	sub    $0x8,%esp
+  80168e:	ff 75 0c             	push   0xc(%ebp)
+  801691:	50                   	push   %eax
+  801692:	e8 61 ff ff ff       	call   8015f8 <fstat>
+  801697:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801699:	89 1c 24             	mov    %ebx,(%esp)
+  80169c:	e8 a2 fb ff ff       	call   801243 <close>
+	return r;
+  8016a1:	83 c4 10             	add    $0x10,%esp
+  8016a4:	89 f3                	mov    %esi,%ebx
+}
+  8016a6:	89 d8                	mov    %ebx,%eax
+  8016a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016ab:	5b                   	pop    %ebx
+  8016ac:	5e                   	pop    %esi
+  8016ad:	5d                   	pop    %ebp
+  8016ae:	c3                   	ret
+
+008016af <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  8016af:	55                   	push   %ebp
+  8016b0:	89 e5                	mov    %esp,%ebp
+  8016b2:	57                   	push   %edi
+  8016b3:	56                   	push   %esi
+  8016b4:	53                   	push   %ebx
+  8016b5:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  8016bb:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  8016c1:	89 d6                	mov    %edx,%esi
+  8016c3:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  8016c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  8016cc:	89 d3                	mov    %edx,%ebx
+  8016ce:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  8016d4:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  8016db:	74 1d                	je     8016fa <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8016dd:	b8 00 60 80 00       	mov    $0x806000,%eax
+  8016e2:	83 c8 07             	or     $0x7,%eax
+  8016e5:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  8016eb:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8016f0:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  8016f6:	01 ce                	add    %ecx,%esi
+  8016f8:	eb 28                	jmp    801722 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016fa:	83 ec 0c             	sub    $0xc,%esp
+  8016fd:	6a 01                	push   $0x1
+  8016ff:	e8 0c 1e 00 00       	call   803510 <ipc_find_env>
+  801704:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801709:	83 c4 10             	add    $0x10,%esp
+  80170c:	eb cf                	jmp    8016dd <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  80170e:	83 c0 01             	add    $0x1,%eax
+  801711:	89 fa                	mov    %edi,%edx
+  801713:	09 da                	or     %ebx,%edx
+  801715:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  80171c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801722:	39 f3                	cmp    %esi,%ebx
+  801724:	72 e8                	jb     80170e <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801726:	83 f8 41             	cmp    $0x41,%eax
+  801729:	77 2f                	ja     80175a <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  80172b:	50                   	push   %eax
+  80172c:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801732:	50                   	push   %eax
+  801733:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801739:	ff 35 c8 70 80 00    	push   0x8070c8
+  80173f:	e8 7e 1d 00 00       	call   8034c2 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801744:	83 c4 0c             	add    $0xc,%esp
+  801747:	6a 00                	push   $0x0
+  801749:	6a 00                	push   $0x0
+  80174b:	6a 00                	push   $0x0
+  80174d:	e8 1a 1c 00 00       	call   80336c <ipc_recv>
+}
+  801752:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801755:	5b                   	pop    %ebx
+  801756:	5e                   	pop    %esi
+  801757:	5f                   	pop    %edi
+  801758:	5d                   	pop    %ebp
+  801759:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  80175a:	68 00 3d 80 00       	push   $0x803d00
+  80175f:	68 4c 3c 80 00       	push   $0x803c4c
+  801764:	6a 40                	push   $0x40
+  801766:	68 1c 3d 80 00       	push   $0x803d1c
+  80176b:	e8 bd e9 ff ff       	call   80012d <_panic>
+
+00801770 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801770:	55                   	push   %ebp
+  801771:	89 e5                	mov    %esp,%ebp
+  801773:	57                   	push   %edi
+  801774:	56                   	push   %esi
+  801775:	53                   	push   %ebx
+  801776:	83 ec 1c             	sub    $0x1c,%esp
+  801779:	89 c3                	mov    %eax,%ebx
+  80177b:	89 d6                	mov    %edx,%esi
+  80177d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801780:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801786:	89 ca                	mov    %ecx,%edx
+  801788:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  80178b:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801792:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801795:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  80179c:	8b 76 0c             	mov    0xc(%esi),%esi
+  80179f:	89 fb                	mov    %edi,%ebx
+  8017a1:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  8017a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8017ab:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  8017b2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017b5:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  8017bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017bf:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  8017c6:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  8017c9:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  8017d0:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  8017d5:	39 c8                	cmp    %ecx,%eax
+  8017d7:	74 0d                	je     8017e6 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  8017d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017e1:	5b                   	pop    %ebx
+  8017e2:	5e                   	pop    %esi
+  8017e3:	5f                   	pop    %edi
+  8017e4:	5d                   	pop    %ebp
+  8017e5:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017e6:	6a 07                	push   $0x7
+  8017e8:	68 00 60 80 00       	push   $0x806000
+  8017ed:	6a 0d                	push   $0xd
+  8017ef:	ff 35 c8 70 80 00    	push   0x8070c8
+  8017f5:	e8 dd 1b 00 00       	call   8033d7 <ipc_send>
+  8017fa:	83 c4 10             	add    $0x10,%esp
+  8017fd:	eb da                	jmp    8017d9 <fsring_post+0x69>
+
+008017ff <fsipcv>:
+{
+  8017ff:	55                   	push   %ebp
+  801800:	89 e5                	mov    %esp,%ebp
+  801802:	57                   	push   %edi
+  801803:	56                   	push   %esi
+  801804:	53                   	push   %ebx
+  801805:	83 ec 0c             	sub    $0xc,%esp
+  801808:	89 c7                	mov    %eax,%edi
+  80180a:	89 d3                	mov    %edx,%ebx
+  80180c:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  80180e:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801815:	74 26                	je     80183d <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801817:	6a 07                	push   $0x7
+  801819:	68 00 60 80 00       	push   $0x806000
+  80181e:	57                   	push   %edi
+  80181f:	ff 35 c8 70 80 00    	push   0x8070c8
+  801825:	e8 ad 1b 00 00       	call   8033d7 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  80182a:	6a 00                	push   $0x0
+  80182c:	56                   	push   %esi
+  80182d:	53                   	push   %ebx
+  80182e:	6a 00                	push   $0x0
+  801830:	e8 fa 1b 00 00       	call   80342f <ipc_recvv>
+}
+  801835:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801838:	5b                   	pop    %ebx
+  801839:	5e                   	pop    %esi
+  80183a:	5f                   	pop    %edi
+  80183b:	5d                   	pop    %ebp
+  80183c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80183d:	83 ec 0c             	sub    $0xc,%esp
+  801840:	6a 01                	push   $0x1
+  801842:	e8 c9 1c 00 00       	call   803510 <ipc_find_env>
+  801847:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  80184c:	83 c4 10             	add    $0x10,%esp
+  80184f:	eb c6                	jmp    801817 <fsipcv+0x18>
+
+00801851 <fsipc>:
+{
+  801851:	55                   	push   %ebp
+  801852:	89 e5                	mov    %esp,%ebp
+  801854:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801857:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  80185e:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801861:	e8 99 ff ff ff       	call   8017ff <fsipcv>
+}
+  801866:	c9                   	leave
+  801867:	c3                   	ret
+
+00801868 <file_write_direct>:
+{
+  801868:	55                   	push   %ebp
+  801869:	89 e5                	mov    %esp,%ebp
+  80186b:	56                   	push   %esi
+  80186c:	53                   	push   %ebx
+  80186d:	89 c3                	mov    %eax,%ebx
+  80186f:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801871:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801877:	77 40                	ja     8018b9 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801879:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  80187e:	39 c8                	cmp    %ecx,%eax
+  801880:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801883:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801886:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  80188c:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801891:	83 ec 04             	sub    $0x4,%esp
+  801894:	50                   	push   %eax
+  801895:	52                   	push   %edx
+  801896:	68 08 60 80 00       	push   $0x806008
+  80189b:	e8 dc f0 ff ff       	call   80097c <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8018a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018aa:	e8 a2 ff ff ff       	call   801851 <fsipc>
+  8018af:	83 c4 10             	add    $0x10,%esp
+}
+  8018b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b5:	5b                   	pop    %ebx
+  8018b6:	5e                   	pop    %esi
+  8018b7:	5d                   	pop    %ebp
+  8018b8:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8018b9:	89 d6                	mov    %edx,%esi
+  8018bb:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8018c1:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8018c6:	29 f1                	sub    %esi,%ecx
+  8018c8:	39 c1                	cmp    %eax,%ecx
+  8018ca:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  8018cd:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8018d0:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  8018d5:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8018db:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  8018e1:	83 ec 0c             	sub    $0xc,%esp
+  8018e4:	6a 05                	push   $0x5
+  8018e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8018eb:	e8 bf fd ff ff       	call   8016af <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  8018f0:	83 c4 10             	add    $0x10,%esp
+  8018f3:	eb bd                	jmp    8018b2 <file_write_direct+0x4a>
+
+008018f5 <devfile_sync>:
+{
+  8018f5:	55                   	push   %ebp
+  8018f6:	89 e5                	mov    %esp,%ebp
+  8018f8:	57                   	push   %edi
+  8018f9:	56                   	push   %esi
+  8018fa:	53                   	push   %ebx
+  8018fb:	83 ec 28             	sub    $0x28,%esp
+  8018fe:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801901:	56                   	push   %esi
+  801902:	e8 a5 f7 ff ff       	call   8010ac <fd2data>
+  801907:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801909:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  80190c:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801913:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801916:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  80191b:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  80191f:	74 45                	je     801966 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801921:	8b 46 14             	mov    0x14(%esi),%eax
+  801924:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801931:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801934:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801937:	39 cb                	cmp    %ecx,%ebx
+  801939:	73 14                	jae    80194f <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  80193b:	29 d9                	sub    %ebx,%ecx
+  80193d:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801940:	89 f0                	mov    %esi,%eax
+  801942:	e8 21 ff ff ff       	call   801868 <file_write_direct>
+  801947:	85 c0                	test   %eax,%eax
+  801949:	7e 04                	jle    80194f <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80194b:	01 c3                	add    %eax,%ebx
+  80194d:	eb e5                	jmp    801934 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  80194f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801952:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801959:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  80195c:	85 c0                	test   %eax,%eax
+  80195e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801963:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801966:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801969:	5b                   	pop    %ebx
+  80196a:	5e                   	pop    %esi
+  80196b:	5f                   	pop    %edi
+  80196c:	5d                   	pop    %ebp
+  80196d:	c3                   	ret
+
+0080196e <devfile_write>:
+{
+  80196e:	55                   	push   %ebp
+  80196f:	89 e5                	mov    %esp,%ebp
+  801971:	57                   	push   %edi
+  801972:	56                   	push   %esi
+  801973:	53                   	push   %ebx
+  801974:	83 ec 28             	sub    $0x28,%esp
+  801977:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80197a:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80197d:	53                   	push   %ebx
+  80197e:	e8 29 f7 ff ff       	call   8010ac <fd2data>
+  801983:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801986:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801989:	83 c4 10             	add    $0x10,%esp
+  80198c:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801990:	74 43                	je     8019d5 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801992:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801999:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80199c:	85 c0                	test   %eax,%eax
+  80199e:	74 43                	je     8019e3 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  8019a0:	89 c2                	mov    %eax,%edx
+  8019a2:	03 53 14             	add    0x14(%ebx),%edx
+  8019a5:	39 fa                	cmp    %edi,%edx
+  8019a7:	75 0b                	jne    8019b4 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  8019a9:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  8019ac:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  8019b2:	76 66                	jbe    801a1a <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  8019b4:	83 ec 0c             	sub    $0xc,%esp
+  8019b7:	53                   	push   %ebx
+  8019b8:	e8 38 ff ff ff       	call   8018f5 <devfile_sync>
+  8019bd:	83 c4 10             	add    $0x10,%esp
+  8019c0:	85 c0                	test   %eax,%eax
+  8019c2:	78 4e                	js     801a12 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8019c4:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8019ca:	77 56                	ja     801a22 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  8019cc:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8019cf:	85 c0                	test   %eax,%eax
+  8019d1:	75 20                	jne    8019f3 <devfile_write+0x85>
+  8019d3:	eb 16                	jmp    8019eb <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  8019d5:	89 f1                	mov    %esi,%ecx
+  8019d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019da:	89 d8                	mov    %ebx,%eax
+  8019dc:	e8 87 fe ff ff       	call   801868 <file_write_direct>
+  8019e1:	eb 2f                	jmp    801a12 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8019e3:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8019e9:	77 37                	ja     801a22 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  8019eb:	89 7b 14             	mov    %edi,0x14(%ebx)
+  8019ee:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  8019f3:	83 ec 04             	sub    $0x4,%esp
+  8019f6:	56                   	push   %esi
+  8019f7:	ff 75 0c             	push   0xc(%ebp)
+  8019fa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019fd:	01 c1                	add    %eax,%ecx
+  8019ff:	51                   	push   %ecx
+  801a00:	e8 77 ef ff ff       	call   80097c <memmove>
+	ff->buf_wlen += n;
+  801a05:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801a08:	01 f7                	add    %esi,%edi
+  801a0a:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801a0d:	89 f0                	mov    %esi,%eax
+  801a0f:	83 c4 10             	add    $0x10,%esp
+}
+  801a12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a15:	5b                   	pop    %ebx
+  801a16:	5e                   	pop    %esi
+  801a17:	5f                   	pop    %edi
+  801a18:	5d                   	pop    %ebp
+  801a19:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801a1a:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801a20:	76 d1                	jbe    8019f3 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801a22:	89 f1                	mov    %esi,%ecx
+  801a24:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a27:	89 d8                	mov    %ebx,%eax
+  801a29:	e8 3a fe ff ff       	call   801868 <file_write_direct>
+  801a2e:	eb e2                	jmp    801a12 <devfile_write+0xa4>
+
+00801a30 <devfile_trunc>:
+{
+  801a30:	55                   	push   %ebp
+  801a31:	89 e5                	mov    %esp,%ebp
+  801a33:	53                   	push   %ebx
+  801a34:	83 ec 10             	sub    $0x10,%esp
+  801a37:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801a3a:	53                   	push   %ebx
+  801a3b:	e8 b5 fe ff ff       	call   8018f5 <devfile_sync>
+  801a40:	83 c4 10             	add    $0x10,%esp
+  801a43:	85 c0                	test   %eax,%eax
+  801a45:	78 1f                	js     801a66 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a47:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a4a:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801a4f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a52:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801a57:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a5c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a61:	e8 eb fd ff ff       	call   801851 <fsipc>
+}
+  801a66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a69:	c9                   	leave
+  801a6a:	c3                   	ret
+
+00801a6b <devfile_stat>:
+{
+  801a6b:	55                   	push   %ebp
+  801a6c:	89 e5                	mov    %esp,%ebp
+  801a6e:	56                   	push   %esi
+  801a6f:	53                   	push   %ebx
+  801a70:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a73:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801a76:	83 ec 0c             	sub    $0xc,%esp
+  801a79:	53                   	push   %ebx
+  801a7a:	e8 76 fe ff ff       	call   8018f5 <devfile_sync>
+  801a7f:	83 c4 10             	add    $0x10,%esp
+  801a82:	85 c0                	test   %eax,%eax
+  801a84:	78 47                	js     801acd <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a86:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a89:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a93:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a98:	e8 b4 fd ff ff       	call   801851 <fsipc>
+  801a9d:	85 c0                	test   %eax,%eax
+  801a9f:	78 2c                	js     801acd <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801aa1:	83 ec 08             	sub    $0x8,%esp
+  801aa4:	68 00 60 80 00       	push   $0x806000
+  801aa9:	56                   	push   %esi
+  801aaa:	e8 47 ed ff ff       	call   8007f6 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801aaf:	a1 80 60 80 00       	mov    0x806080,%eax
+  801ab4:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801aba:	a1 84 60 80 00       	mov    0x806084,%eax
+  801abf:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801ac5:	83 c4 10             	add    $0x10,%esp
+  801ac8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801acd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ad0:	5b                   	pop    %ebx
+  801ad1:	5e                   	pop    %esi
+  801ad2:	5d                   	pop    %ebp
+  801ad3:	c3                   	ret
+
+00801ad4 <devfile_flush>:
+{
+  801ad4:	55                   	push   %ebp
+  801ad5:	89 e5                	mov    %esp,%ebp
+  801ad7:	56                   	push   %esi
+  801ad8:	53                   	push   %ebx
+  801ad9:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801adc:	83 ec 0c             	sub    $0xc,%esp
+  801adf:	56                   	push   %esi
+  801ae0:	e8 10 fe ff ff       	call   8018f5 <devfile_sync>
+  801ae5:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801ae7:	83 c4 10             	add    $0x10,%esp
+  801aea:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801aee:	75 25                	jne    801b15 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801af0:	8b 46 0c             	mov    0xc(%esi),%eax
+  801af3:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801af8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801afd:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b02:	e8 4a fd ff ff       	call   801851 <fsipc>
+  801b07:	85 c0                	test   %eax,%eax
+  801b09:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801b0c:	89 d8                	mov    %ebx,%eax
+  801b0e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b11:	5b                   	pop    %ebx
+  801b12:	5e                   	pop    %esi
+  801b13:	5d                   	pop    %ebp
+  801b14:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801b15:	83 ec 0c             	sub    $0xc,%esp
+  801b18:	56                   	push   %esi
+  801b19:	e8 8e f5 ff ff       	call   8010ac <fd2data>
+  801b1e:	83 c4 08             	add    $0x8,%esp
+  801b21:	50                   	push   %eax
+  801b22:	6a 00                	push   $0x0
+  801b24:	e8 66 f1 ff ff       	call   800c8f <sys_page_unmap>
+  801b29:	83 c4 10             	add    $0x10,%esp
+  801b2c:	eb c2                	jmp    801af0 <devfile_flush+0x1c>
+
+00801b2e <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801b2e:	55                   	push   %ebp
+  801b2f:	89 e5                	mov    %esp,%ebp
+  801b31:	57                   	push   %edi
+  801b32:	56                   	push   %esi
+  801b33:	53                   	push   %ebx
+  801b34:	83 ec 64             	sub    $0x64,%esp
+  801b37:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801b39:	52                   	push   %edx
+  801b3a:	50                   	push   %eax
+  801b3b:	e8 d9 f5 ff ff       	call   801119 <fd_lookup>
+  801b40:	89 c1                	mov    %eax,%ecx
+  801b42:	83 c4 10             	add    $0x10,%esp
+  801b45:	85 c0                	test   %eax,%eax
+  801b47:	0f 88 f2 00 00 00    	js     801c3f <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801b4d:	8b 07                	mov    (%edi),%eax
+  801b4f:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801b55:	39 10                	cmp    %edx,(%eax)
+  801b57:	0f 85 03 01 00 00    	jne    801c60 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801b5d:	a1 00 50 80 00       	mov    0x805000,%eax
+  801b62:	8b 40 48             	mov    0x48(%eax),%eax
+  801b65:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801b6b:	0f 84 96 00 00 00    	je     801c07 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801b71:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801b78:	0f 84 cb 00 00 00    	je     801c49 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b7e:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801b83:	83 c8 07             	or     $0x7,%eax
+  801b86:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801b89:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b8c:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801b91:	83 ec 04             	sub    $0x4,%esp
+  801b94:	68 07 04 00 00       	push   $0x407
+  801b99:	53                   	push   %ebx
+  801b9a:	6a 00                	push   $0x0
+  801b9c:	e8 61 f0 ff ff       	call   800c02 <sys_page_alloc>
+  801ba1:	89 c1                	mov    %eax,%ecx
+  801ba3:	83 c4 10             	add    $0x10,%esp
+  801ba6:	85 c0                	test   %eax,%eax
+  801ba8:	0f 88 91 00 00 00    	js     801c3f <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801bae:	89 d8                	mov    %ebx,%eax
+  801bb0:	83 c8 07             	or     $0x7,%eax
+  801bb3:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801bb5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801bbb:	83 c6 04             	add    $0x4,%esi
+  801bbe:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801bc4:	75 cb                	jne    801b91 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801bc6:	6a 12                	push   $0x12
+  801bc8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801bcb:	50                   	push   %eax
+  801bcc:	6a 0c                	push   $0xc
+  801bce:	ff 35 c8 70 80 00    	push   0x8070c8
+  801bd4:	e8 e9 18 00 00       	call   8034c2 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801bd9:	83 c4 0c             	add    $0xc,%esp
+  801bdc:	6a 00                	push   $0x0
+  801bde:	6a 00                	push   $0x0
+  801be0:	6a 00                	push   $0x0
+  801be2:	e8 85 17 00 00       	call   80336c <ipc_recv>
+  801be7:	89 c1                	mov    %eax,%ecx
+  801be9:	83 c4 10             	add    $0x10,%esp
+  801bec:	85 c0                	test   %eax,%eax
+  801bee:	78 4f                	js     801c3f <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801bf0:	a1 00 50 80 00       	mov    0x805000,%eax
+  801bf5:	8b 40 48             	mov    0x48(%eax),%eax
+  801bf8:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801bfd:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801c04:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801c07:	83 ec 0c             	sub    $0xc,%esp
+  801c0a:	ff 37                	push   (%edi)
+  801c0c:	e8 e4 fc ff ff       	call   8018f5 <devfile_sync>
+  801c11:	89 c1                	mov    %eax,%ecx
+  801c13:	83 c4 10             	add    $0x10,%esp
+  801c16:	85 c0                	test   %eax,%eax
+  801c18:	78 25                	js     801c3f <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801c1a:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801c20:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801c25:	ba 01 00 00 00       	mov    $0x1,%edx
+  801c2a:	89 d0                	mov    %edx,%eax
+  801c2c:	d3 e0                	shl    %cl,%eax
+  801c2e:	85 d8                	test   %ebx,%eax
+  801c30:	74 0d                	je     801c3f <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801c32:	83 c1 01             	add    $0x1,%ecx
+  801c35:	83 f9 10             	cmp    $0x10,%ecx
+  801c38:	75 f0                	jne    801c2a <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801c3a:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801c3f:	89 c8                	mov    %ecx,%eax
+  801c41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c44:	5b                   	pop    %ebx
+  801c45:	5e                   	pop    %esi
+  801c46:	5f                   	pop    %edi
+  801c47:	5d                   	pop    %ebp
+  801c48:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c49:	83 ec 0c             	sub    $0xc,%esp
+  801c4c:	6a 01                	push   $0x1
+  801c4e:	e8 bd 18 00 00       	call   803510 <ipc_find_env>
+  801c53:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801c58:	83 c4 10             	add    $0x10,%esp
+  801c5b:	e9 1e ff ff ff       	jmp    801b7e <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801c60:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801c65:	eb d8                	jmp    801c3f <fsring_slot+0x111>
+
+00801c67 <file_read_direct>:
+{
+  801c67:	55                   	push   %ebp
+  801c68:	89 e5                	mov    %esp,%ebp
+  801c6a:	57                   	push   %edi
+  801c6b:	56                   	push   %esi
+  801c6c:	53                   	push   %ebx
+  801c6d:	83 ec 1c             	sub    $0x1c,%esp
+  801c70:	89 c7                	mov    %eax,%edi
+  801c72:	89 d6                	mov    %edx,%esi
+  801c74:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801c76:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801c7c:	77 52                	ja     801cd0 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c7e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c81:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801c86:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c91:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c96:	e8 b6 fb ff ff       	call   801851 <fsipc>
+  801c9b:	89 c7                	mov    %eax,%edi
+  801c9d:	85 c0                	test   %eax,%eax
+  801c9f:	78 25                	js     801cc6 <file_read_direct+0x5f>
+	assert(r <= n);
+  801ca1:	39 c3                	cmp    %eax,%ebx
+  801ca3:	0f 82 87 00 00 00    	jb     801d30 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801ca9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801cae:	0f 8f 95 00 00 00    	jg     801d49 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801cb4:	83 ec 04             	sub    $0x4,%esp
+  801cb7:	50                   	push   %eax
+  801cb8:	68 00 60 80 00       	push   $0x806000
+  801cbd:	56                   	push   %esi
+  801cbe:	e8 b9 ec ff ff       	call   80097c <memmove>
+	return r;
+  801cc3:	83 c4 10             	add    $0x10,%esp
+}
+  801cc6:	89 f8                	mov    %edi,%eax
+  801cc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ccb:	5b                   	pop    %ebx
+  801ccc:	5e                   	pop    %esi
+  801ccd:	5f                   	pop    %edi
+  801cce:	5d                   	pop    %ebp
+  801ccf:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801cd0:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801cd6:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801cdb:	29 d1                	sub    %edx,%ecx
+  801cdd:	39 d9                	cmp    %ebx,%ecx
+  801cdf:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801ce2:	89 f0                	mov    %esi,%eax
+  801ce4:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801ce7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801cea:	eb 0f                	jmp    801cfb <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801cec:	0f b6 10             	movzbl (%eax),%edx
+  801cef:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801cf1:	05 00 10 00 00       	add    $0x1000,%eax
+  801cf6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801cfb:	39 c8                	cmp    %ecx,%eax
+  801cfd:	72 ed                	jb     801cec <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801cff:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d02:	8b 47 0c             	mov    0xc(%edi),%eax
+  801d05:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801d0a:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801d10:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801d16:	83 ec 0c             	sub    $0xc,%esp
+  801d19:	6a 07                	push   $0x7
+  801d1b:	89 d9                	mov    %ebx,%ecx
+  801d1d:	89 f2                	mov    %esi,%edx
+  801d1f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d24:	e8 86 f9 ff ff       	call   8016af <fsipc_pages>
+  801d29:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801d2b:	83 c4 10             	add    $0x10,%esp
+  801d2e:	eb 96                	jmp    801cc6 <file_read_direct+0x5f>
+	assert(r <= n);
+  801d30:	68 27 3d 80 00       	push   $0x803d27
+  801d35:	68 4c 3c 80 00       	push   $0x803c4c
+  801d3a:	68 dc 00 00 00       	push   $0xdc
+  801d3f:	68 1c 3d 80 00       	push   $0x803d1c
+  801d44:	e8 e4 e3 ff ff       	call   80012d <_panic>
+	assert(r <= PGSIZE);
+  801d49:	68 38 3d 80 00       	push   $0x803d38
+  801d4e:	68 4c 3c 80 00       	push   $0x803c4c
+  801d53:	68 dd 00 00 00       	push   $0xdd
+  801d58:	68 1c 3d 80 00       	push   $0x803d1c
+  801d5d:	e8 cb e3 ff ff       	call   80012d <_panic>
+
+00801d62 <devfile_read>:
+{
+  801d62:	55                   	push   %ebp
+  801d63:	89 e5                	mov    %esp,%ebp
+  801d65:	57                   	push   %edi
+  801d66:	56                   	push   %esi
+  801d67:	53                   	push   %ebx
+  801d68:	83 ec 28             	sub    $0x28,%esp
+  801d6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d6e:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801d71:	53                   	push   %ebx
+  801d72:	e8 35 f3 ff ff       	call   8010ac <fd2data>
+  801d77:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801d7a:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801d7d:	83 c4 10             	add    $0x10,%esp
+  801d80:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801d84:	74 7d                	je     801e03 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801d86:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801d8a:	0f 85 81 00 00 00    	jne    801e11 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801d90:	8b 43 18             	mov    0x18(%ebx),%eax
+  801d93:	85 c0                	test   %eax,%eax
+  801d95:	74 0d                	je     801da4 <devfile_read+0x42>
+  801d97:	8b 53 14             	mov    0x14(%ebx),%edx
+  801d9a:	39 fa                	cmp    %edi,%edx
+  801d9c:	7f 06                	jg     801da4 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801d9e:	01 c2                	add    %eax,%edx
+  801da0:	39 d7                	cmp    %edx,%edi
+  801da2:	72 28                	jb     801dcc <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801da4:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801dab:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801db1:	77 74                	ja     801e27 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801db3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801db8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801dbb:	89 d8                	mov    %ebx,%eax
+  801dbd:	e8 a5 fe ff ff       	call   801c67 <file_read_direct>
+  801dc2:	85 c0                	test   %eax,%eax
+  801dc4:	7e 35                	jle    801dfb <devfile_read+0x99>
+		ff->buf_base = pos;
+  801dc6:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801dc9:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801dcc:	8b 53 14             	mov    0x14(%ebx),%edx
+  801dcf:	89 d0                	mov    %edx,%eax
+  801dd1:	03 43 18             	add    0x18(%ebx),%eax
+  801dd4:	29 f8                	sub    %edi,%eax
+  801dd6:	39 f0                	cmp    %esi,%eax
+  801dd8:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801ddb:	83 ec 04             	sub    $0x4,%esp
+  801dde:	56                   	push   %esi
+  801ddf:	89 f8                	mov    %edi,%eax
+  801de1:	29 d0                	sub    %edx,%eax
+  801de3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801de6:	01 c1                	add    %eax,%ecx
+  801de8:	51                   	push   %ecx
+  801de9:	ff 75 0c             	push   0xc(%ebp)
+  801dec:	e8 8b eb ff ff       	call   80097c <memmove>
+	fd->fd_offset = pos + n;
+  801df1:	01 f7                	add    %esi,%edi
+  801df3:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801df6:	89 f0                	mov    %esi,%eax
+  801df8:	83 c4 10             	add    $0x10,%esp
+}
+  801dfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dfe:	5b                   	pop    %ebx
+  801dff:	5e                   	pop    %esi
+  801e00:	5f                   	pop    %edi
+  801e01:	5d                   	pop    %ebp
+  801e02:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801e03:	89 f1                	mov    %esi,%ecx
+  801e05:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e08:	89 d8                	mov    %ebx,%eax
+  801e0a:	e8 58 fe ff ff       	call   801c67 <file_read_direct>
+  801e0f:	eb ea                	jmp    801dfb <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801e11:	83 ec 0c             	sub    $0xc,%esp
+  801e14:	53                   	push   %ebx
+  801e15:	e8 db fa ff ff       	call   8018f5 <devfile_sync>
+  801e1a:	83 c4 10             	add    $0x10,%esp
+  801e1d:	85 c0                	test   %eax,%eax
+  801e1f:	0f 89 6b ff ff ff    	jns    801d90 <devfile_read+0x2e>
+  801e25:	eb d4                	jmp    801dfb <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801e27:	89 f1                	mov    %esi,%ecx
+  801e29:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e2c:	89 d8                	mov    %ebx,%eax
+  801e2e:	e8 34 fe ff ff       	call   801c67 <file_read_direct>
+  801e33:	eb c6                	jmp    801dfb <devfile_read+0x99>
+
+00801e35 <open>:
+{
+  801e35:	55                   	push   %ebp
+  801e36:	89 e5                	mov    %esp,%ebp
+  801e38:	56                   	push   %esi
+  801e39:	53                   	push   %ebx
+  801e3a:	83 ec 1c             	sub    $0x1c,%esp
+  801e3d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801e40:	56                   	push   %esi
+  801e41:	e8 75 e9 ff ff       	call   8007bb <strlen>
+  801e46:	83 c4 10             	add    $0x10,%esp
+  801e49:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e4e:	0f 8f a0 00 00 00    	jg     801ef4 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801e54:	83 ec 0c             	sub    $0xc,%esp
+  801e57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e5a:	50                   	push   %eax
+  801e5b:	e8 63 f2 ff ff       	call   8010c3 <fd_alloc>
+  801e60:	89 c3                	mov    %eax,%ebx
+  801e62:	83 c4 10             	add    $0x10,%esp
+  801e65:	85 c0                	test   %eax,%eax
+  801e67:	78 45                	js     801eae <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801e69:	83 ec 08             	sub    $0x8,%esp
+  801e6c:	56                   	push   %esi
+  801e6d:	68 00 60 80 00       	push   $0x806000
+  801e72:	e8 7f e9 ff ff       	call   8007f6 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801e77:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e7a:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801e7f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e82:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e87:	e8 c5 f9 ff ff       	call   801851 <fsipc>
+  801e8c:	89 c3                	mov    %eax,%ebx
+  801e8e:	83 c4 10             	add    $0x10,%esp
+  801e91:	85 c0                	test   %eax,%eax
+  801e93:	78 22                	js     801eb7 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801e95:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801e9c:	74 2b                	je     801ec9 <open+0x94>
+	return fd2num(fd);
+  801e9e:	83 ec 0c             	sub    $0xc,%esp
+  801ea1:	ff 75 f4             	push   -0xc(%ebp)
+  801ea4:	e8 f3 f1 ff ff       	call   80109c <fd2num>
+  801ea9:	89 c3                	mov    %eax,%ebx
+  801eab:	83 c4 10             	add    $0x10,%esp
+}
+  801eae:	89 d8                	mov    %ebx,%eax
+  801eb0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb3:	5b                   	pop    %ebx
+  801eb4:	5e                   	pop    %esi
+  801eb5:	5d                   	pop    %ebp
+  801eb6:	c3                   	ret
+		fd_close(fd, 0);
+  801eb7:	83 ec 08             	sub    $0x8,%esp
+  801eba:	6a 00                	push   $0x0
+  801ebc:	ff 75 f4             	push   -0xc(%ebp)
+  801ebf:	e8 f8 f2 ff ff       	call   8011bc <fd_close>
+		return r;
+  801ec4:	83 c4 10             	add    $0x10,%esp
+  801ec7:	eb e5                	jmp    801eae <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801ec9:	83 ec 0c             	sub    $0xc,%esp
+  801ecc:	ff 75 f4             	push   -0xc(%ebp)
+  801ecf:	e8 d8 f1 ff ff       	call   8010ac <fd2data>
+  801ed4:	83 c4 0c             	add    $0xc,%esp
+  801ed7:	68 07 04 00 00       	push   $0x407
+  801edc:	50                   	push   %eax
+  801edd:	6a 00                	push   $0x0
+  801edf:	e8 1e ed ff ff       	call   800c02 <sys_page_alloc>
+  801ee4:	83 c4 10             	add    $0x10,%esp
+  801ee7:	85 c0                	test   %eax,%eax
+  801ee9:	75 b3                	jne    801e9e <open+0x69>
+		fd->fd_file.buffered = 1;
+  801eeb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eee:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801ef2:	eb aa                	jmp    801e9e <open+0x69>
+		return -E_BAD_PATH;
+  801ef4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ef9:	eb b3                	jmp    801eae <open+0x79>
+
+00801efb <readdir>:
+{
+  801efb:	55                   	push   %ebp
+  801efc:	89 e5                	mov    %esp,%ebp
+  801efe:	53                   	push   %ebx
+  801eff:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f02:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f05:	50                   	push   %eax
+  801f06:	ff 75 08             	push   0x8(%ebp)
+  801f09:	e8 0b f2 ff ff       	call   801119 <fd_lookup>
+  801f0e:	89 c3                	mov    %eax,%ebx
+  801f10:	83 c4 10             	add    $0x10,%esp
+  801f13:	85 c0                	test   %eax,%eax
+  801f15:	78 73                	js     801f8a <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801f17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f1a:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801f20:	39 08                	cmp    %ecx,(%eax)
+  801f22:	0f 85 82 00 00 00    	jne    801faa <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801f28:	83 ec 0c             	sub    $0xc,%esp
+  801f2b:	50                   	push   %eax
+  801f2c:	e8 c4 f9 ff ff       	call   8018f5 <devfile_sync>
+  801f31:	89 c3                	mov    %eax,%ebx
+  801f33:	83 c4 10             	add    $0x10,%esp
+  801f36:	85 c0                	test   %eax,%eax
+  801f38:	78 50                	js     801f8a <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801f3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f3d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f40:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801f45:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f48:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801f4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f50:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801f55:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f5a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f5f:	e8 ed f8 ff ff       	call   801851 <fsipc>
+  801f64:	89 c3                	mov    %eax,%ebx
+  801f66:	85 c0                	test   %eax,%eax
+  801f68:	7e 20                	jle    801f8a <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801f6a:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801f6d:	72 22                	jb     801f91 <readdir+0x96>
+  801f6f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f74:	7f 1b                	jg     801f91 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f76:	83 ec 04             	sub    $0x4,%esp
+  801f79:	50                   	push   %eax
+  801f7a:	68 00 60 80 00       	push   $0x806000
+  801f7f:	ff 75 0c             	push   0xc(%ebp)
+  801f82:	e8 f5 e9 ff ff       	call   80097c <memmove>
+	return r;
+  801f87:	83 c4 10             	add    $0x10,%esp
+}
+  801f8a:	89 d8                	mov    %ebx,%eax
+  801f8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f8f:	c9                   	leave
+  801f90:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801f91:	68 2e 3d 80 00       	push   $0x803d2e
+  801f96:	68 4c 3c 80 00       	push   $0x803c4c
+  801f9b:	68 86 01 00 00       	push   $0x186
+  801fa0:	68 1c 3d 80 00       	push   $0x803d1c
+  801fa5:	e8 83 e1 ff ff       	call   80012d <_panic>
+		return -E_NOT_SUPP;
+  801faa:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801faf:	eb d9                	jmp    801f8a <readdir+0x8f>
+
+00801fb1 <munmap>:
+{
+  801fb1:	55                   	push   %ebp
+  801fb2:	89 e5                	mov    %esp,%ebp
+  801fb4:	56                   	push   %esi
+  801fb5:	53                   	push   %ebx
+  801fb6:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fb9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801fbc:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801fc2:	75 41                	jne    802005 <munmap+0x54>
+  801fc4:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801fca:	77 39                	ja     802005 <munmap+0x54>
+  801fcc:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801fd1:	29 f0                	sub    %esi,%eax
+  801fd3:	39 d0                	cmp    %edx,%eax
+  801fd5:	72 35                	jb     80200c <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801fd7:	89 f3                	mov    %esi,%ebx
+  801fd9:	01 d6                	add    %edx,%esi
+  801fdb:	39 f3                	cmp    %esi,%ebx
+  801fdd:	73 1a                	jae    801ff9 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801fdf:	83 ec 08             	sub    $0x8,%esp
+  801fe2:	53                   	push   %ebx
+  801fe3:	6a 00                	push   $0x0
+  801fe5:	e8 a5 ec ff ff       	call   800c8f <sys_page_unmap>
+  801fea:	83 c4 10             	add    $0x10,%esp
+  801fed:	85 c0                	test   %eax,%eax
+  801fef:	78 0d                	js     801ffe <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801ff1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ff7:	eb e2                	jmp    801fdb <munmap+0x2a>
+	return 0;
+  801ff9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ffe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802001:	5b                   	pop    %ebx
+  802002:	5e                   	pop    %esi
+  802003:	5d                   	pop    %ebp
+  802004:	c3                   	ret
+		return -E_INVAL;
+  802005:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80200a:	eb f2                	jmp    801ffe <munmap+0x4d>
+  80200c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802011:	eb eb                	jmp    801ffe <munmap+0x4d>
+
+00802013 <mmap>:
+{
+  802013:	55                   	push   %ebp
+  802014:	89 e5                	mov    %esp,%ebp
+  802016:	57                   	push   %edi
+  802017:	56                   	push   %esi
+  802018:	53                   	push   %ebx
+  802019:	83 ec 34             	sub    $0x34,%esp
+  80201c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80201f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802022:	50                   	push   %eax
+  802023:	ff 75 18             	push   0x18(%ebp)
+  802026:	e8 ee f0 ff ff       	call   801119 <fd_lookup>
+  80202b:	89 c3                	mov    %eax,%ebx
+  80202d:	83 c4 10             	add    $0x10,%esp
+  802030:	85 c0                	test   %eax,%eax
+  802032:	0f 88 0e 01 00 00    	js     802146 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802038:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80203b:	a1 20 40 80 00       	mov    0x804020,%eax
+  802040:	39 02                	cmp    %eax,(%edx)
+  802042:	0f 85 50 01 00 00    	jne    802198 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802048:	8b 45 10             	mov    0x10(%ebp),%eax
+  80204b:	83 e0 02             	and    $0x2,%eax
+  80204e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802051:	74 0a                	je     80205d <mmap+0x4a>
+  802053:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802057:	0f 84 42 01 00 00    	je     80219f <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  80205d:	8b 42 08             	mov    0x8(%edx),%eax
+  802060:	83 e0 03             	and    $0x3,%eax
+  802063:	83 f8 01             	cmp    $0x1,%eax
+  802066:	0f 84 3a 01 00 00    	je     8021a6 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  80206c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80206f:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802072:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802077:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80207a:	0f 85 2d 01 00 00    	jne    8021ad <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802080:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802084:	0f 88 2a 01 00 00    	js     8021b4 <mmap+0x1a1>
+  80208a:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  802091:	0f 87 1d 01 00 00    	ja     8021b4 <mmap+0x1a1>
+  802097:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80209c:	2b 45 08             	sub    0x8(%ebp),%eax
+  80209f:	39 f8                	cmp    %edi,%eax
+  8020a1:	0f 82 14 01 00 00    	jb     8021bb <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8020a7:	83 ec 0c             	sub    $0xc,%esp
+  8020aa:	52                   	push   %edx
+  8020ab:	e8 45 f8 ff ff       	call   8018f5 <devfile_sync>
+  8020b0:	89 c3                	mov    %eax,%ebx
+  8020b2:	83 c4 10             	add    $0x10,%esp
+  8020b5:	85 c0                	test   %eax,%eax
+  8020b7:	0f 88 89 00 00 00    	js     802146 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8020bd:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8020c3:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8020c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ce:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8020d1:	39 fe                	cmp    %edi,%esi
+  8020d3:	73 7b                	jae    802150 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8020d5:	89 f8                	mov    %edi,%eax
+  8020d7:	29 f0                	sub    %esi,%eax
+  8020d9:	c1 e8 0c             	shr    $0xc,%eax
+  8020dc:	ba 40 00 00 00       	mov    $0x40,%edx
+  8020e1:	39 d0                	cmp    %edx,%eax
+  8020e3:	0f 47 c2             	cmova  %edx,%eax
+  8020e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8020e9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8020ec:	8b 52 0c             	mov    0xc(%edx),%edx
+  8020ef:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  8020f5:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8020f8:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  8020fe:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802103:	89 f2                	mov    %esi,%edx
+  802105:	03 55 08             	add    0x8(%ebp),%edx
+  802108:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80210b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802110:	e8 ea f6 ff ff       	call   8017ff <fsipcv>
+  802115:	85 c0                	test   %eax,%eax
+  802117:	7e 12                	jle    80212b <mmap+0x118>
+  802119:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80211c:	85 c0                	test   %eax,%eax
+  80211e:	0f 84 9e 00 00 00    	je     8021c2 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802124:	c1 e0 0c             	shl    $0xc,%eax
+  802127:	01 c6                	add    %eax,%esi
+  802129:	eb a6                	jmp    8020d1 <mmap+0xbe>
+			munmap(addr, done);
+  80212b:	89 c3                	mov    %eax,%ebx
+  80212d:	83 ec 08             	sub    $0x8,%esp
+  802130:	56                   	push   %esi
+  802131:	ff 75 08             	push   0x8(%ebp)
+  802134:	e8 78 fe ff ff       	call   801fb1 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802139:	83 c4 10             	add    $0x10,%esp
+  80213c:	85 db                	test   %ebx,%ebx
+  80213e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802143:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802146:	89 d8                	mov    %ebx,%eax
+  802148:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80214b:	5b                   	pop    %ebx
+  80214c:	5e                   	pop    %esi
+  80214d:	5f                   	pop    %edi
+  80214e:	5d                   	pop    %ebp
+  80214f:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802150:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802153:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802155:	85 c0                	test   %eax,%eax
+  802157:	74 ed                	je     802146 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802159:	be 00 00 00 00       	mov    $0x0,%esi
+  80215e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802161:	39 fe                	cmp    %edi,%esi
+  802163:	73 2e                	jae    802193 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802165:	83 ec 0c             	sub    $0xc,%esp
+  802168:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  80216b:	50                   	push   %eax
+  80216c:	e8 fd 0f 00 00       	call   80316e <cowpage>
+  802171:	83 c4 10             	add    $0x10,%esp
+  802174:	85 c0                	test   %eax,%eax
+  802176:	78 08                	js     802180 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802178:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80217e:	eb e1                	jmp    802161 <mmap+0x14e>
+				munmap(addr, len);
+  802180:	89 c3                	mov    %eax,%ebx
+  802182:	83 ec 08             	sub    $0x8,%esp
+  802185:	57                   	push   %edi
+  802186:	ff 75 08             	push   0x8(%ebp)
+  802189:	e8 23 fe ff ff       	call   801fb1 <munmap>
+				return r;
+  80218e:	83 c4 10             	add    $0x10,%esp
+  802191:	eb b3                	jmp    802146 <mmap+0x133>
+	return 0;
+  802193:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802196:	eb ae                	jmp    802146 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802198:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80219d:	eb a7                	jmp    802146 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80219f:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8021a4:	eb a0                	jmp    802146 <mmap+0x133>
+		return -E_INVAL;
+  8021a6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021ab:	eb 99                	jmp    802146 <mmap+0x133>
+  8021ad:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021b2:	eb 92                	jmp    802146 <mmap+0x133>
+  8021b4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021b9:	eb 8b                	jmp    802146 <mmap+0x133>
+  8021bb:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021c0:	eb 84                	jmp    802146 <mmap+0x133>
+			munmap(addr, done);
+  8021c2:	83 ec 08             	sub    $0x8,%esp
+  8021c5:	56                   	push   %esi
+  8021c6:	ff 75 08             	push   0x8(%ebp)
+  8021c9:	e8 e3 fd ff ff       	call   801fb1 <munmap>
+  8021ce:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8021d1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021d6:	e9 6b ff ff ff       	jmp    802146 <mmap+0x133>
+
+008021db <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8021db:	55                   	push   %ebp
+  8021dc:	89 e5                	mov    %esp,%ebp
+  8021de:	56                   	push   %esi
+  8021df:	53                   	push   %ebx
+  8021e0:	83 ec 10             	sub    $0x10,%esp
+  8021e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8021e6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ec:	e8 3d f9 ff ff       	call   801b2e <fsring_slot>
+  8021f1:	85 c0                	test   %eax,%eax
+  8021f3:	78 60                	js     802255 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8021f5:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8021f8:	8b 56 08             	mov    0x8(%esi),%edx
+  8021fb:	83 e2 03             	and    $0x3,%edx
+  8021fe:	83 fa 01             	cmp    $0x1,%edx
+  802201:	74 59                	je     80225c <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802203:	ba 01 00 00 00       	mov    $0x1,%edx
+  802208:	89 c1                	mov    %eax,%ecx
+  80220a:	d3 e2                	shl    %cl,%edx
+  80220c:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802212:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802215:	c1 e2 02             	shl    $0x2,%edx
+  802218:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  80221e:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  802225:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802228:	8b 55 18             	mov    0x18(%ebp),%edx
+  80222b:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80222e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802231:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802234:	83 ec 08             	sub    $0x8,%esp
+  802237:	50                   	push   %eax
+  802238:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80223d:	39 c3                	cmp    %eax,%ebx
+  80223f:	0f 47 d8             	cmova  %eax,%ebx
+  802242:	53                   	push   %ebx
+  802243:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802246:	89 f2                	mov    %esi,%edx
+  802248:	b8 03 00 00 00       	mov    $0x3,%eax
+  80224d:	e8 1e f5 ff ff       	call   801770 <fsring_post>
+  802252:	83 c4 10             	add    $0x10,%esp
+}
+  802255:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802258:	5b                   	pop    %ebx
+  802259:	5e                   	pop    %esi
+  80225a:	5d                   	pop    %ebp
+  80225b:	c3                   	ret
+		return -E_INVAL;
+  80225c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802261:	eb f2                	jmp    802255 <fsring_read+0x7a>
+
+00802263 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802263:	55                   	push   %ebp
+  802264:	89 e5                	mov    %esp,%ebp
+  802266:	56                   	push   %esi
+  802267:	53                   	push   %ebx
+  802268:	83 ec 10             	sub    $0x10,%esp
+  80226b:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80226e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802271:	8b 45 08             	mov    0x8(%ebp),%eax
+  802274:	e8 b5 f8 ff ff       	call   801b2e <fsring_slot>
+  802279:	89 c3                	mov    %eax,%ebx
+  80227b:	85 c0                	test   %eax,%eax
+  80227d:	78 77                	js     8022f6 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80227f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802282:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802286:	74 77                	je     8022ff <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802288:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80228d:	39 c6                	cmp    %eax,%esi
+  80228f:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802292:	83 ec 04             	sub    $0x4,%esp
+  802295:	56                   	push   %esi
+  802296:	ff 75 0c             	push   0xc(%ebp)
+  802299:	89 d8                	mov    %ebx,%eax
+  80229b:	c1 e0 0c             	shl    $0xc,%eax
+  80229e:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8022a4:	50                   	push   %eax
+  8022a5:	e8 d2 e6 ff ff       	call   80097c <memmove>
+	fsring_busy |= 1 << slot;
+  8022aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022af:	89 d9                	mov    %ebx,%ecx
+  8022b1:	d3 e0                	shl    %cl,%eax
+  8022b3:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8022b9:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8022bc:	c1 e0 02             	shl    $0x2,%eax
+  8022bf:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8022c5:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8022cc:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8022cf:	8b 45 18             	mov    0x18(%ebp),%eax
+  8022d2:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8022d5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8022dc:	83 c4 08             	add    $0x8,%esp
+  8022df:	53                   	push   %ebx
+  8022e0:	56                   	push   %esi
+  8022e1:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8022e4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022e7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022ec:	e8 7f f4 ff ff       	call   801770 <fsring_post>
+  8022f1:	89 c3                	mov    %eax,%ebx
+  8022f3:	83 c4 10             	add    $0x10,%esp
+}
+  8022f6:	89 d8                	mov    %ebx,%eax
+  8022f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022fb:	5b                   	pop    %ebx
+  8022fc:	5e                   	pop    %esi
+  8022fd:	5d                   	pop    %ebp
+  8022fe:	c3                   	ret
+		return -E_INVAL;
+  8022ff:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802304:	eb f0                	jmp    8022f6 <fsring_write+0x93>
+
+00802306 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802306:	55                   	push   %ebp
+  802307:	89 e5                	mov    %esp,%ebp
+  802309:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80230c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80230f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802312:	e8 17 f8 ff ff       	call   801b2e <fsring_slot>
+  802317:	85 c0                	test   %eax,%eax
+  802319:	78 4c                	js     802367 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  80231b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802320:	89 c1                	mov    %eax,%ecx
+  802322:	d3 e2                	shl    %cl,%edx
+  802324:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  80232a:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80232d:	c1 e2 02             	shl    $0x2,%edx
+  802330:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  802336:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  80233d:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802340:	8b 55 10             	mov    0x10(%ebp),%edx
+  802343:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802346:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802349:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80234c:	83 ec 08             	sub    $0x8,%esp
+  80234f:	50                   	push   %eax
+  802350:	6a 00                	push   $0x0
+  802352:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802357:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80235a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80235f:	e8 0c f4 ff ff       	call   801770 <fsring_post>
+  802364:	83 c4 10             	add    $0x10,%esp
+}
+  802367:	c9                   	leave
+  802368:	c3                   	ret
+
+00802369 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802369:	55                   	push   %ebp
+  80236a:	89 e5                	mov    %esp,%ebp
+  80236c:	57                   	push   %edi
+  80236d:	56                   	push   %esi
+  80236e:	53                   	push   %ebx
+  80236f:	83 ec 1c             	sub    $0x1c,%esp
+  802372:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802376:	a1 00 50 80 00       	mov    0x805000,%eax
+  80237b:	8b 40 48             	mov    0x48(%eax),%eax
+  80237e:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  802384:	74 12                	je     802398 <fsring_reap+0x2f>
+		return 0;
+  802386:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  80238b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80238e:	5b                   	pop    %ebx
+  80238f:	5e                   	pop    %esi
+  802390:	5f                   	pop    %edi
+  802391:	5d                   	pop    %ebp
+  802392:	c3                   	ret
+		sys_yield();
+  802393:	e8 4b e8 ff ff       	call   800be3 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802398:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  80239e:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8023a3:	39 c2                	cmp    %eax,%edx
+  8023a5:	75 18                	jne    8023bf <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8023a7:	84 db                	test   %bl,%bl
+  8023a9:	0f 84 21 01 00 00    	je     8024d0 <fsring_reap+0x167>
+  8023af:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  8023b6:	75 db                	jne    802393 <fsring_reap+0x2a>
+			return 0;
+  8023b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023bd:	eb cc                	jmp    80238b <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8023bf:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8023c4:	83 e0 0f             	and    $0xf,%eax
+  8023c7:	83 c0 2a             	add    $0x2a,%eax
+  8023ca:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8023d1:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8023d8:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8023dd:	83 c0 01             	add    $0x1,%eax
+  8023e0:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8023e5:	83 fb 0f             	cmp    $0xf,%ebx
+  8023e8:	77 5b                	ja     802445 <fsring_reap+0xdc>
+  8023ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ef:	89 d9                	mov    %ebx,%ecx
+  8023f1:	d3 e6                	shl    %cl,%esi
+  8023f3:	89 f0                	mov    %esi,%eax
+  8023f5:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8023fb:	74 48                	je     802445 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8023fd:	89 d8                	mov    %ebx,%eax
+  8023ff:	c1 e0 0c             	shl    $0xc,%eax
+  802402:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802408:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  80240b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80240e:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  802415:	83 f8 03             	cmp    $0x3,%eax
+  802418:	74 40                	je     80245a <fsring_reap+0xf1>
+  80241a:	83 f8 05             	cmp    $0x5,%eax
+  80241d:	74 64                	je     802483 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  80241f:	f7 d6                	not    %esi
+  802421:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802427:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80242a:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  802431:	8b 45 08             	mov    0x8(%ebp),%eax
+  802434:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802436:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802439:	89 38                	mov    %edi,(%eax)
+	return 1;
+  80243b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802440:	e9 46 ff ff ff       	jmp    80238b <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802445:	53                   	push   %ebx
+  802446:	68 44 3d 80 00       	push   $0x803d44
+  80244b:	68 8f 02 00 00       	push   $0x28f
+  802450:	68 1c 3d 80 00       	push   $0x803d1c
+  802455:	e8 d3 dc ff ff       	call   80012d <_panic>
+		if (cqe.cqe_result > 0)
+  80245a:	85 ff                	test   %edi,%edi
+  80245c:	7e c1                	jle    80241f <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80245e:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802461:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802466:	39 c7                	cmp    %eax,%edi
+  802468:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80246b:	50                   	push   %eax
+  80246c:	ff 75 e4             	push   -0x1c(%ebp)
+  80246f:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802472:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  802479:	e8 fe e4 ff ff       	call   80097c <memmove>
+  80247e:	83 c4 10             	add    $0x10,%esp
+  802481:	eb 9c                	jmp    80241f <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802483:	85 ff                	test   %edi,%edi
+  802485:	75 98                	jne    80241f <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802487:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80248a:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802491:	83 ec 08             	sub    $0x8,%esp
+  802494:	ff 75 e4             	push   -0x1c(%ebp)
+  802497:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80249a:	51                   	push   %ecx
+  80249b:	e8 56 e3 ff ff       	call   8007f6 <strcpy>
+			st->st_size = ret->ret_size;
+  8024a0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024a3:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8024a9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8024ac:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8024b2:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8024b8:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8024be:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8024c5:	40 80 00 
+  8024c8:	83 c4 10             	add    $0x10,%esp
+  8024cb:	e9 4f ff ff ff       	jmp    80241f <fsring_reap+0xb6>
+			return 0;
+  8024d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d5:	e9 b1 fe ff ff       	jmp    80238b <fsring_reap+0x22>
+
+008024da <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8024da:	55                   	push   %ebp
+  8024db:	89 e5                	mov    %esp,%ebp
+  8024dd:	57                   	push   %edi
+  8024de:	56                   	push   %esi
+  8024df:	53                   	push   %ebx
+  8024e0:	83 ec 28             	sub    $0x28,%esp
+  8024e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8024e6:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8024e9:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8024ec:	53                   	push   %ebx
+  8024ed:	e8 c9 e2 ff ff       	call   8007bb <strlen>
+  8024f2:	83 c4 10             	add    $0x10,%esp
+  8024f5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024fa:	0f 8f 02 01 00 00    	jg     802602 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802500:	83 ec 08             	sub    $0x8,%esp
+  802503:	53                   	push   %ebx
+  802504:	68 00 60 80 00       	push   $0x806000
+  802509:	e8 e8 e2 ff ff       	call   8007f6 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  80250e:	83 c4 10             	add    $0x10,%esp
+  802511:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802517:	76 69                	jbe    802582 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802519:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80251c:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802522:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802527:	29 d1                	sub    %edx,%ecx
+  802529:	39 f9                	cmp    %edi,%ecx
+  80252b:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80252e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802531:	89 f9                	mov    %edi,%ecx
+  802533:	01 c1                	add    %eax,%ecx
+  802535:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802538:	eb 0f                	jmp    802549 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  80253a:	0f b6 10             	movzbl (%eax),%edx
+  80253d:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80253f:	05 00 10 00 00       	add    $0x1000,%eax
+  802544:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802549:	39 c8                	cmp    %ecx,%eax
+  80254b:	72 ed                	jb     80253a <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  80254d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802550:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802556:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  80255c:	83 ec 0c             	sub    $0xc,%esp
+  80255f:	6a 07                	push   $0x7
+  802561:	89 f9                	mov    %edi,%ecx
+  802563:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802566:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80256b:	e8 3f f1 ff ff       	call   8016af <fsipc_pages>
+  802570:	89 c7                	mov    %eax,%edi
+  802572:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802575:	85 f6                	test   %esi,%esi
+  802577:	74 7f                	je     8025f8 <file_slurp+0x11e>
+  802579:	8d 43 01             	lea    0x1(%ebx),%eax
+  80257c:	85 ff                	test   %edi,%edi
+  80257e:	79 3c                	jns    8025bc <file_slurp+0xe2>
+  802580:	eb 76                	jmp    8025f8 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802582:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802588:	ba 00 00 00 00       	mov    $0x0,%edx
+  80258d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802592:	e8 ba f2 ff ff       	call   801851 <fsipc>
+  802597:	89 c7                	mov    %eax,%edi
+  802599:	85 c0                	test   %eax,%eax
+  80259b:	7e d8                	jle    802575 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  80259d:	83 ec 04             	sub    $0x4,%esp
+  8025a0:	50                   	push   %eax
+  8025a1:	68 08 60 80 00       	push   $0x806008
+  8025a6:	ff 75 0c             	push   0xc(%ebp)
+  8025a9:	e8 ce e3 ff ff       	call   80097c <memmove>
+  8025ae:	83 c4 10             	add    $0x10,%esp
+  8025b1:	eb c2                	jmp    802575 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8025b3:	80 fa 2f             	cmp    $0x2f,%dl
+  8025b6:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8025b9:	83 c0 01             	add    $0x1,%eax
+  8025bc:	89 c1                	mov    %eax,%ecx
+  8025be:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8025c2:	84 d2                	test   %dl,%dl
+  8025c4:	75 ed                	jne    8025b3 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8025c6:	83 ec 04             	sub    $0x4,%esp
+  8025c9:	68 80 00 00 00       	push   $0x80
+  8025ce:	53                   	push   %ebx
+  8025cf:	56                   	push   %esi
+  8025d0:	e8 97 e2 ff ff       	call   80086c <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8025d5:	a1 00 60 80 00       	mov    0x806000,%eax
+  8025da:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8025e0:	a1 04 60 80 00       	mov    0x806004,%eax
+  8025e5:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8025eb:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  8025f2:	40 80 00 
+  8025f5:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8025f8:	89 f8                	mov    %edi,%eax
+  8025fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025fd:	5b                   	pop    %ebx
+  8025fe:	5e                   	pop    %esi
+  8025ff:	5f                   	pop    %edi
+  802600:	5d                   	pop    %ebp
+  802601:	c3                   	ret
+		return -E_BAD_PATH;
+  802602:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802607:	eb ef                	jmp    8025f8 <file_slurp+0x11e>
+
+00802609 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802609:	55                   	push   %ebp
+  80260a:	89 e5                	mov    %esp,%ebp
+  80260c:	53                   	push   %ebx
+  80260d:	83 ec 10             	sub    $0x10,%esp
+  802610:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802613:	53                   	push   %ebx
+  802614:	e8 a2 e1 ff ff       	call   8007bb <strlen>
+  802619:	83 c4 10             	add    $0x10,%esp
+  80261c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802621:	7f 25                	jg     802648 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802623:	83 ec 08             	sub    $0x8,%esp
+  802626:	53                   	push   %ebx
+  802627:	68 00 60 80 00       	push   $0x806000
+  80262c:	e8 c5 e1 ff ff       	call   8007f6 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802631:	ba 00 00 00 00       	mov    $0x0,%edx
+  802636:	b8 07 00 00 00       	mov    $0x7,%eax
+  80263b:	e8 11 f2 ff ff       	call   801851 <fsipc>
+  802640:	83 c4 10             	add    $0x10,%esp
+}
+  802643:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802646:	c9                   	leave
+  802647:	c3                   	ret
+		return -E_BAD_PATH;
+  802648:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80264d:	eb f4                	jmp    802643 <remove+0x3a>
+
+0080264f <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80264f:	55                   	push   %ebp
+  802650:	89 e5                	mov    %esp,%ebp
+  802652:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802655:	ba 00 00 00 00       	mov    $0x0,%edx
+  80265a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80265f:	e8 ed f1 ff ff       	call   801851 <fsipc>
+}
+  802664:	c9                   	leave
+  802665:	c3                   	ret
+
+00802666 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802666:	55                   	push   %ebp
+  802667:	89 e5                	mov    %esp,%ebp
+  802669:	57                   	push   %edi
+  80266a:	56                   	push   %esi
+  80266b:	53                   	push   %ebx
+  80266c:	83 ec 18             	sub    $0x18,%esp
+  80266f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802672:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802675:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802678:	57                   	push   %edi
+  802679:	e8 3d e1 ff ff       	call   8007bb <strlen>
+  80267e:	83 c4 10             	add    $0x10,%esp
+  802681:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802686:	7f 4c                	jg     8026d4 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802688:	83 ec 08             	sub    $0x8,%esp
+  80268b:	57                   	push   %edi
+  80268c:	68 00 60 80 00       	push   $0x806000
+  802691:	e8 60 e1 ff ff       	call   8007f6 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802696:	ba 00 00 00 00       	mov    $0x0,%edx
+  80269b:	b8 10 00 00 00       	mov    $0x10,%eax
+  8026a0:	e8 ac f1 ff ff       	call   801851 <fsipc>
+  8026a5:	83 c4 10             	add    $0x10,%esp
+  8026a8:	85 c0                	test   %eax,%eax
+  8026aa:	78 20                	js     8026cc <defrag+0x66>
+		return r;
+	if (before)
+  8026ac:	85 f6                	test   %esi,%esi
+  8026ae:	74 07                	je     8026b7 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  8026b0:	a1 00 60 80 00       	mov    0x806000,%eax
+  8026b5:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  8026b7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  8026bc:	85 db                	test   %ebx,%ebx
+  8026be:	74 0c                	je     8026cc <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  8026c0:	a1 04 60 80 00       	mov    0x806004,%eax
+  8026c5:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8026c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026cf:	5b                   	pop    %ebx
+  8026d0:	5e                   	pop    %esi
+  8026d1:	5f                   	pop    %edi
+  8026d2:	5d                   	pop    %ebp
+  8026d3:	c3                   	ret
+		return -E_BAD_PATH;
+  8026d4:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8026d9:	eb f1                	jmp    8026cc <defrag+0x66>
+
+008026db <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  8026db:	55                   	push   %ebp
+  8026dc:	89 e5                	mov    %esp,%ebp
+  8026de:	53                   	push   %ebx
+  8026df:	83 ec 04             	sub    $0x4,%esp
+  8026e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  8026e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026ea:	b8 11 00 00 00       	mov    $0x11,%eax
+  8026ef:	e8 5d f1 ff ff       	call   801851 <fsipc>
+  8026f4:	85 c0                	test   %eax,%eax
+  8026f6:	78 34                	js     80272c <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  8026f8:	a1 00 60 80 00       	mov    0x806000,%eax
+  8026fd:	89 03                	mov    %eax,(%ebx)
+  8026ff:	a1 04 60 80 00       	mov    0x806004,%eax
+  802704:	89 43 04             	mov    %eax,0x4(%ebx)
+  802707:	a1 08 60 80 00       	mov    0x806008,%eax
+  80270c:	89 43 08             	mov    %eax,0x8(%ebx)
+  80270f:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  802714:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802717:	a1 10 60 80 00       	mov    0x806010,%eax
+  80271c:	89 43 10             	mov    %eax,0x10(%ebx)
+  80271f:	a1 14 60 80 00       	mov    0x806014,%eax
+  802724:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802727:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80272c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80272f:	c9                   	leave
+  802730:	c3                   	ret
+
+00802731 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802731:	55                   	push   %ebp
+  802732:	89 e5                	mov    %esp,%ebp
+  802734:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802737:	68 5d 3d 80 00       	push   $0x803d5d
+  80273c:	ff 75 0c             	push   0xc(%ebp)
+  80273f:	e8 b2 e0 ff ff       	call   8007f6 <strcpy>
+	return 0;
+}
+  802744:	b8 00 00 00 00       	mov    $0x0,%eax
+  802749:	c9                   	leave
+  80274a:	c3                   	ret
+
+0080274b <devsock_close>:
+{
+  80274b:	55                   	push   %ebp
+  80274c:	89 e5                	mov    %esp,%ebp
+  80274e:	53                   	push   %ebx
+  80274f:	83 ec 10             	sub    $0x10,%esp
+  802752:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802755:	53                   	push   %ebx
+  802756:	e8 f4 0d 00 00       	call   80354f <pageref>
+  80275b:	89 c2                	mov    %eax,%edx
+  80275d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802760:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802765:	83 fa 01             	cmp    $0x1,%edx
+  802768:	74 05                	je     80276f <devsock_close+0x24>
+}
+  80276a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80276d:	c9                   	leave
+  80276e:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80276f:	83 ec 0c             	sub    $0xc,%esp
+  802772:	ff 73 0c             	push   0xc(%ebx)
+  802775:	e8 b7 02 00 00       	call   802a31 <nsipc_close>
+  80277a:	83 c4 10             	add    $0x10,%esp
+  80277d:	eb eb                	jmp    80276a <devsock_close+0x1f>
+
+0080277f <devsock_write>:
+{
+  80277f:	55                   	push   %ebp
+  802780:	89 e5                	mov    %esp,%ebp
+  802782:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802785:	6a 00                	push   $0x0
+  802787:	ff 75 10             	push   0x10(%ebp)
+  80278a:	ff 75 0c             	push   0xc(%ebp)
+  80278d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802790:	ff 70 0c             	push   0xc(%eax)
+  802793:	e8 79 03 00 00       	call   802b11 <nsipc_send>
+}
+  802798:	c9                   	leave
+  802799:	c3                   	ret
+
+0080279a <devsock_read>:
+{
+  80279a:	55                   	push   %ebp
+  80279b:	89 e5                	mov    %esp,%ebp
+  80279d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8027a0:	6a 00                	push   $0x0
+  8027a2:	ff 75 10             	push   0x10(%ebp)
+  8027a5:	ff 75 0c             	push   0xc(%ebp)
+  8027a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ab:	ff 70 0c             	push   0xc(%eax)
+  8027ae:	e8 ef 02 00 00       	call   802aa2 <nsipc_recv>
+}
+  8027b3:	c9                   	leave
+  8027b4:	c3                   	ret
+
+008027b5 <fd2sockid>:
+{
+  8027b5:	55                   	push   %ebp
+  8027b6:	89 e5                	mov    %esp,%ebp
+  8027b8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8027bb:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027be:	52                   	push   %edx
+  8027bf:	50                   	push   %eax
+  8027c0:	e8 54 e9 ff ff       	call   801119 <fd_lookup>
+  8027c5:	83 c4 10             	add    $0x10,%esp
+  8027c8:	85 c0                	test   %eax,%eax
+  8027ca:	78 10                	js     8027dc <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8027cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027cf:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  8027d5:	39 08                	cmp    %ecx,(%eax)
+  8027d7:	75 05                	jne    8027de <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8027d9:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8027dc:	c9                   	leave
+  8027dd:	c3                   	ret
+		return -E_NOT_SUPP;
+  8027de:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027e3:	eb f7                	jmp    8027dc <fd2sockid+0x27>
+
+008027e5 <alloc_sockfd>:
+{
+  8027e5:	55                   	push   %ebp
+  8027e6:	89 e5                	mov    %esp,%ebp
+  8027e8:	56                   	push   %esi
+  8027e9:	53                   	push   %ebx
+  8027ea:	83 ec 1c             	sub    $0x1c,%esp
+  8027ed:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8027ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027f2:	50                   	push   %eax
+  8027f3:	e8 cb e8 ff ff       	call   8010c3 <fd_alloc>
+  8027f8:	89 c3                	mov    %eax,%ebx
+  8027fa:	83 c4 10             	add    $0x10,%esp
+  8027fd:	85 c0                	test   %eax,%eax
+  8027ff:	78 43                	js     802844 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802801:	83 ec 04             	sub    $0x4,%esp
+  802804:	68 07 04 00 00       	push   $0x407
+  802809:	ff 75 f4             	push   -0xc(%ebp)
+  80280c:	6a 00                	push   $0x0
+  80280e:	e8 ef e3 ff ff       	call   800c02 <sys_page_alloc>
+  802813:	89 c3                	mov    %eax,%ebx
+  802815:	83 c4 10             	add    $0x10,%esp
+  802818:	85 c0                	test   %eax,%eax
+  80281a:	78 28                	js     802844 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80281c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80281f:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802825:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802827:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80282a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802831:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802834:	83 ec 0c             	sub    $0xc,%esp
+  802837:	50                   	push   %eax
+  802838:	e8 5f e8 ff ff       	call   80109c <fd2num>
+  80283d:	89 c3                	mov    %eax,%ebx
+  80283f:	83 c4 10             	add    $0x10,%esp
+  802842:	eb 0c                	jmp    802850 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802844:	83 ec 0c             	sub    $0xc,%esp
+  802847:	56                   	push   %esi
+  802848:	e8 e4 01 00 00       	call   802a31 <nsipc_close>
+		return r;
+  80284d:	83 c4 10             	add    $0x10,%esp
+}
+  802850:	89 d8                	mov    %ebx,%eax
+  802852:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802855:	5b                   	pop    %ebx
+  802856:	5e                   	pop    %esi
+  802857:	5d                   	pop    %ebp
+  802858:	c3                   	ret
+
+00802859 <accept>:
+{
+  802859:	55                   	push   %ebp
+  80285a:	89 e5                	mov    %esp,%ebp
+  80285c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80285f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802862:	e8 4e ff ff ff       	call   8027b5 <fd2sockid>
+  802867:	85 c0                	test   %eax,%eax
+  802869:	78 1b                	js     802886 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80286b:	83 ec 04             	sub    $0x4,%esp
+  80286e:	ff 75 10             	push   0x10(%ebp)
+  802871:	ff 75 0c             	push   0xc(%ebp)
+  802874:	50                   	push   %eax
+  802875:	e8 0e 01 00 00       	call   802988 <nsipc_accept>
+  80287a:	83 c4 10             	add    $0x10,%esp
+  80287d:	85 c0                	test   %eax,%eax
+  80287f:	78 05                	js     802886 <accept+0x2d>
+	return alloc_sockfd(r);
+  802881:	e8 5f ff ff ff       	call   8027e5 <alloc_sockfd>
+}
+  802886:	c9                   	leave
+  802887:	c3                   	ret
+
+00802888 <bind>:
+{
+  802888:	55                   	push   %ebp
+  802889:	89 e5                	mov    %esp,%ebp
+  80288b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80288e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802891:	e8 1f ff ff ff       	call   8027b5 <fd2sockid>
+  802896:	85 c0                	test   %eax,%eax
+  802898:	78 12                	js     8028ac <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80289a:	83 ec 04             	sub    $0x4,%esp
+  80289d:	ff 75 10             	push   0x10(%ebp)
+  8028a0:	ff 75 0c             	push   0xc(%ebp)
+  8028a3:	50                   	push   %eax
+  8028a4:	e8 31 01 00 00       	call   8029da <nsipc_bind>
+  8028a9:	83 c4 10             	add    $0x10,%esp
+}
+  8028ac:	c9                   	leave
+  8028ad:	c3                   	ret
+
+008028ae <shutdown>:
+{
+  8028ae:	55                   	push   %ebp
+  8028af:	89 e5                	mov    %esp,%ebp
+  8028b1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028b7:	e8 f9 fe ff ff       	call   8027b5 <fd2sockid>
+  8028bc:	85 c0                	test   %eax,%eax
+  8028be:	78 0f                	js     8028cf <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8028c0:	83 ec 08             	sub    $0x8,%esp
+  8028c3:	ff 75 0c             	push   0xc(%ebp)
+  8028c6:	50                   	push   %eax
+  8028c7:	e8 43 01 00 00       	call   802a0f <nsipc_shutdown>
+  8028cc:	83 c4 10             	add    $0x10,%esp
+}
+  8028cf:	c9                   	leave
+  8028d0:	c3                   	ret
+
+008028d1 <connect>:
+{
+  8028d1:	55                   	push   %ebp
+  8028d2:	89 e5                	mov    %esp,%ebp
+  8028d4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028da:	e8 d6 fe ff ff       	call   8027b5 <fd2sockid>
+  8028df:	85 c0                	test   %eax,%eax
+  8028e1:	78 12                	js     8028f5 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8028e3:	83 ec 04             	sub    $0x4,%esp
+  8028e6:	ff 75 10             	push   0x10(%ebp)
+  8028e9:	ff 75 0c             	push   0xc(%ebp)
+  8028ec:	50                   	push   %eax
+  8028ed:	e8 59 01 00 00       	call   802a4b <nsipc_connect>
+  8028f2:	83 c4 10             	add    $0x10,%esp
+}
+  8028f5:	c9                   	leave
+  8028f6:	c3                   	ret
+
+008028f7 <listen>:
+{
+  8028f7:	55                   	push   %ebp
+  8028f8:	89 e5                	mov    %esp,%ebp
+  8028fa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802900:	e8 b0 fe ff ff       	call   8027b5 <fd2sockid>
+  802905:	85 c0                	test   %eax,%eax
+  802907:	78 0f                	js     802918 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802909:	83 ec 08             	sub    $0x8,%esp
+  80290c:	ff 75 0c             	push   0xc(%ebp)
+  80290f:	50                   	push   %eax
+  802910:	e8 6b 01 00 00       	call   802a80 <nsipc_listen>
+  802915:	83 c4 10             	add    $0x10,%esp
+}
+  802918:	c9                   	leave
+  802919:	c3                   	ret
+
+0080291a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80291a:	55                   	push   %ebp
+  80291b:	89 e5                	mov    %esp,%ebp
+  80291d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802920:	ff 75 10             	push   0x10(%ebp)
+  802923:	ff 75 0c             	push   0xc(%ebp)
+  802926:	ff 75 08             	push   0x8(%ebp)
+  802929:	e8 41 02 00 00       	call   802b6f <nsipc_socket>
+  80292e:	83 c4 10             	add    $0x10,%esp
+  802931:	85 c0                	test   %eax,%eax
+  802933:	78 05                	js     80293a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802935:	e8 ab fe ff ff       	call   8027e5 <alloc_sockfd>
+}
+  80293a:	c9                   	leave
+  80293b:	c3                   	ret
+
+0080293c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80293c:	55                   	push   %ebp
+  80293d:	89 e5                	mov    %esp,%ebp
+  80293f:	53                   	push   %ebx
+  802940:	83 ec 04             	sub    $0x4,%esp
+  802943:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802945:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80294c:	74 26                	je     802974 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80294e:	6a 07                	push   $0x7
+  802950:	68 00 80 80 00       	push   $0x808000
+  802955:	53                   	push   %ebx
+  802956:	ff 35 00 90 80 00    	push   0x809000
+  80295c:	e8 76 0a 00 00       	call   8033d7 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802961:	83 c4 0c             	add    $0xc,%esp
+  802964:	6a 00                	push   $0x0
+  802966:	6a 00                	push   $0x0
+  802968:	6a 00                	push   $0x0
+  80296a:	e8 fd 09 00 00       	call   80336c <ipc_recv>
+}
+  80296f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802972:	c9                   	leave
+  802973:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802974:	83 ec 0c             	sub    $0xc,%esp
+  802977:	6a 02                	push   $0x2
+  802979:	e8 92 0b 00 00       	call   803510 <ipc_find_env>
+  80297e:	a3 00 90 80 00       	mov    %eax,0x809000
+  802983:	83 c4 10             	add    $0x10,%esp
+  802986:	eb c6                	jmp    80294e <nsipc+0x12>
+
+00802988 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802988:	55                   	push   %ebp
+  802989:	89 e5                	mov    %esp,%ebp
+  80298b:	56                   	push   %esi
+  80298c:	53                   	push   %ebx
+  80298d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802990:	8b 45 08             	mov    0x8(%ebp),%eax
+  802993:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802998:	8b 06                	mov    (%esi),%eax
+  80299a:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80299f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029a4:	e8 93 ff ff ff       	call   80293c <nsipc>
+  8029a9:	89 c3                	mov    %eax,%ebx
+  8029ab:	85 c0                	test   %eax,%eax
+  8029ad:	79 09                	jns    8029b8 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8029af:	89 d8                	mov    %ebx,%eax
+  8029b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029b4:	5b                   	pop    %ebx
+  8029b5:	5e                   	pop    %esi
+  8029b6:	5d                   	pop    %ebp
+  8029b7:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8029b8:	83 ec 04             	sub    $0x4,%esp
+  8029bb:	ff 35 10 80 80 00    	push   0x808010
+  8029c1:	68 00 80 80 00       	push   $0x808000
+  8029c6:	ff 75 0c             	push   0xc(%ebp)
+  8029c9:	e8 ae df ff ff       	call   80097c <memmove>
+		*addrlen = ret->ret_addrlen;
+  8029ce:	a1 10 80 80 00       	mov    0x808010,%eax
+  8029d3:	89 06                	mov    %eax,(%esi)
+  8029d5:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8029d8:	eb d5                	jmp    8029af <nsipc_accept+0x27>
+
+008029da <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8029da:	55                   	push   %ebp
+  8029db:	89 e5                	mov    %esp,%ebp
+  8029dd:	53                   	push   %ebx
+  8029de:	83 ec 08             	sub    $0x8,%esp
+  8029e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8029e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029e7:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8029ec:	53                   	push   %ebx
+  8029ed:	ff 75 0c             	push   0xc(%ebp)
+  8029f0:	68 04 80 80 00       	push   $0x808004
+  8029f5:	e8 82 df ff ff       	call   80097c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8029fa:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802a00:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a05:	e8 32 ff ff ff       	call   80293c <nsipc>
+}
+  802a0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a0d:	c9                   	leave
+  802a0e:	c3                   	ret
+
+00802a0f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802a0f:	55                   	push   %ebp
+  802a10:	89 e5                	mov    %esp,%ebp
+  802a12:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a18:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802a1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a20:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802a25:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a2a:	e8 0d ff ff ff       	call   80293c <nsipc>
+}
+  802a2f:	c9                   	leave
+  802a30:	c3                   	ret
+
+00802a31 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802a31:	55                   	push   %ebp
+  802a32:	89 e5                	mov    %esp,%ebp
+  802a34:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802a37:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a3a:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802a3f:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a44:	e8 f3 fe ff ff       	call   80293c <nsipc>
+}
+  802a49:	c9                   	leave
+  802a4a:	c3                   	ret
+
+00802a4b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802a4b:	55                   	push   %ebp
+  802a4c:	89 e5                	mov    %esp,%ebp
+  802a4e:	53                   	push   %ebx
+  802a4f:	83 ec 08             	sub    $0x8,%esp
+  802a52:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802a55:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a58:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802a5d:	53                   	push   %ebx
+  802a5e:	ff 75 0c             	push   0xc(%ebp)
+  802a61:	68 04 80 80 00       	push   $0x808004
+  802a66:	e8 11 df ff ff       	call   80097c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802a6b:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802a71:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a76:	e8 c1 fe ff ff       	call   80293c <nsipc>
+}
+  802a7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a7e:	c9                   	leave
+  802a7f:	c3                   	ret
+
+00802a80 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802a80:	55                   	push   %ebp
+  802a81:	89 e5                	mov    %esp,%ebp
+  802a83:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802a86:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a89:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802a8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a91:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802a96:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a9b:	e8 9c fe ff ff       	call   80293c <nsipc>
+}
+  802aa0:	c9                   	leave
+  802aa1:	c3                   	ret
+
+00802aa2 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802aa2:	55                   	push   %ebp
+  802aa3:	89 e5                	mov    %esp,%ebp
+  802aa5:	56                   	push   %esi
+  802aa6:	53                   	push   %ebx
+  802aa7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802aaa:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aad:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802ab2:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802ab8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802abb:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802ac0:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ac5:	e8 72 fe ff ff       	call   80293c <nsipc>
+  802aca:	89 c3                	mov    %eax,%ebx
+  802acc:	85 c0                	test   %eax,%eax
+  802ace:	78 22                	js     802af2 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802ad0:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ad5:	39 c6                	cmp    %eax,%esi
+  802ad7:	0f 4e c6             	cmovle %esi,%eax
+  802ada:	39 c3                	cmp    %eax,%ebx
+  802adc:	7f 1d                	jg     802afb <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ade:	83 ec 04             	sub    $0x4,%esp
+  802ae1:	53                   	push   %ebx
+  802ae2:	68 00 80 80 00       	push   $0x808000
+  802ae7:	ff 75 0c             	push   0xc(%ebp)
+  802aea:	e8 8d de ff ff       	call   80097c <memmove>
+  802aef:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802af2:	89 d8                	mov    %ebx,%eax
+  802af4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802af7:	5b                   	pop    %ebx
+  802af8:	5e                   	pop    %esi
+  802af9:	5d                   	pop    %ebp
+  802afa:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802afb:	68 69 3d 80 00       	push   $0x803d69
+  802b00:	68 4c 3c 80 00       	push   $0x803c4c
+  802b05:	6a 62                	push   $0x62
+  802b07:	68 7e 3d 80 00       	push   $0x803d7e
+  802b0c:	e8 1c d6 ff ff       	call   80012d <_panic>
+
+00802b11 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802b11:	55                   	push   %ebp
+  802b12:	89 e5                	mov    %esp,%ebp
+  802b14:	53                   	push   %ebx
+  802b15:	83 ec 04             	sub    $0x4,%esp
+  802b18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802b1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b1e:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802b23:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802b29:	7f 2e                	jg     802b59 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802b2b:	83 ec 04             	sub    $0x4,%esp
+  802b2e:	53                   	push   %ebx
+  802b2f:	ff 75 0c             	push   0xc(%ebp)
+  802b32:	68 0c 80 80 00       	push   $0x80800c
+  802b37:	e8 40 de ff ff       	call   80097c <memmove>
+	nsipcbuf.send.req_size = size;
+  802b3c:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802b42:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b45:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802b4a:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b4f:	e8 e8 fd ff ff       	call   80293c <nsipc>
+}
+  802b54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b57:	c9                   	leave
+  802b58:	c3                   	ret
+	assert(size < 1600);
+  802b59:	68 8a 3d 80 00       	push   $0x803d8a
+  802b5e:	68 4c 3c 80 00       	push   $0x803c4c
+  802b63:	6a 6d                	push   $0x6d
+  802b65:	68 7e 3d 80 00       	push   $0x803d7e
+  802b6a:	e8 be d5 ff ff       	call   80012d <_panic>
+
+00802b6f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b6f:	55                   	push   %ebp
+  802b70:	89 e5                	mov    %esp,%ebp
+  802b72:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b75:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b78:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802b7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b80:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802b85:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b88:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802b8d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b92:	e8 a5 fd ff ff       	call   80293c <nsipc>
+}
+  802b97:	c9                   	leave
+  802b98:	c3                   	ret
+
+00802b99 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b99:	55                   	push   %ebp
+  802b9a:	89 e5                	mov    %esp,%ebp
+  802b9c:	56                   	push   %esi
+  802b9d:	53                   	push   %ebx
+  802b9e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802ba1:	83 ec 0c             	sub    $0xc,%esp
+  802ba4:	ff 75 08             	push   0x8(%ebp)
+  802ba7:	e8 00 e5 ff ff       	call   8010ac <fd2data>
+  802bac:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802bae:	83 c4 08             	add    $0x8,%esp
+  802bb1:	68 96 3d 80 00       	push   $0x803d96
+  802bb6:	53                   	push   %ebx
+  802bb7:	e8 3a dc ff ff       	call   8007f6 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802bbc:	8b 46 04             	mov    0x4(%esi),%eax
+  802bbf:	2b 06                	sub    (%esi),%eax
+  802bc1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802bc7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802bce:	00 00 00 
+	stat->st_dev = &devpipe;
+  802bd1:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802bd8:	40 80 00 
+	return 0;
+}
+  802bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802be3:	5b                   	pop    %ebx
+  802be4:	5e                   	pop    %esi
+  802be5:	5d                   	pop    %ebp
+  802be6:	c3                   	ret
+
+00802be7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802be7:	55                   	push   %ebp
+  802be8:	89 e5                	mov    %esp,%ebp
+  802bea:	53                   	push   %ebx
+  802beb:	83 ec 0c             	sub    $0xc,%esp
+  802bee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802bf1:	53                   	push   %ebx
+  802bf2:	6a 00                	push   $0x0
+  802bf4:	e8 96 e0 ff ff       	call   800c8f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802bf9:	89 1c 24             	mov    %ebx,(%esp)
+  802bfc:	e8 ab e4 ff ff       	call   8010ac <fd2data>
+  802c01:	83 c4 08             	add    $0x8,%esp
+  802c04:	50                   	push   %eax
+  802c05:	6a 00                	push   $0x0
+  802c07:	e8 83 e0 ff ff       	call   800c8f <sys_page_unmap>
+}
+  802c0c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c0f:	c9                   	leave
+  802c10:	c3                   	ret
+
+00802c11 <_pipeisclosed>:
+{
+  802c11:	55                   	push   %ebp
+  802c12:	89 e5                	mov    %esp,%ebp
+  802c14:	57                   	push   %edi
+  802c15:	56                   	push   %esi
+  802c16:	53                   	push   %ebx
+  802c17:	83 ec 1c             	sub    $0x1c,%esp
+  802c1a:	89 c7                	mov    %eax,%edi
+  802c1c:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802c1e:	a1 00 50 80 00       	mov    0x805000,%eax
+  802c23:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802c26:	83 ec 0c             	sub    $0xc,%esp
+  802c29:	57                   	push   %edi
+  802c2a:	e8 20 09 00 00       	call   80354f <pageref>
+  802c2f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c32:	89 34 24             	mov    %esi,(%esp)
+  802c35:	e8 15 09 00 00       	call   80354f <pageref>
+		nn = thisenv->env_runs;
+  802c3a:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802c40:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802c43:	83 c4 10             	add    $0x10,%esp
+  802c46:	39 cb                	cmp    %ecx,%ebx
+  802c48:	74 1b                	je     802c65 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802c4a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c4d:	75 cf                	jne    802c1e <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802c4f:	8b 42 58             	mov    0x58(%edx),%eax
+  802c52:	6a 01                	push   $0x1
+  802c54:	50                   	push   %eax
+  802c55:	53                   	push   %ebx
+  802c56:	68 9d 3d 80 00       	push   $0x803d9d
+  802c5b:	e8 a8 d5 ff ff       	call   800208 <cprintf>
+  802c60:	83 c4 10             	add    $0x10,%esp
+  802c63:	eb b9                	jmp    802c1e <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802c65:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c68:	0f 94 c0             	sete   %al
+  802c6b:	0f b6 c0             	movzbl %al,%eax
+}
+  802c6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c71:	5b                   	pop    %ebx
+  802c72:	5e                   	pop    %esi
+  802c73:	5f                   	pop    %edi
+  802c74:	5d                   	pop    %ebp
+  802c75:	c3                   	ret
+
+00802c76 <devpipe_write>:
+{
+  802c76:	55                   	push   %ebp
+  802c77:	89 e5                	mov    %esp,%ebp
+  802c79:	57                   	push   %edi
+  802c7a:	56                   	push   %esi
+  802c7b:	53                   	push   %ebx
+  802c7c:	83 ec 28             	sub    $0x28,%esp
+  802c7f:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802c82:	56                   	push   %esi
+  802c83:	e8 24 e4 ff ff       	call   8010ac <fd2data>
+  802c88:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802c8a:	83 c4 10             	add    $0x10,%esp
+  802c8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c92:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802c95:	75 09                	jne    802ca0 <devpipe_write+0x2a>
+	return i;
+  802c97:	89 f8                	mov    %edi,%eax
+  802c99:	eb 23                	jmp    802cbe <devpipe_write+0x48>
+			sys_yield();
+  802c9b:	e8 43 df ff ff       	call   800be3 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802ca0:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ca3:	8b 0b                	mov    (%ebx),%ecx
+  802ca5:	8d 51 20             	lea    0x20(%ecx),%edx
+  802ca8:	39 d0                	cmp    %edx,%eax
+  802caa:	72 1a                	jb     802cc6 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802cac:	89 da                	mov    %ebx,%edx
+  802cae:	89 f0                	mov    %esi,%eax
+  802cb0:	e8 5c ff ff ff       	call   802c11 <_pipeisclosed>
+  802cb5:	85 c0                	test   %eax,%eax
+  802cb7:	74 e2                	je     802c9b <devpipe_write+0x25>
+				return 0;
+  802cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cc1:	5b                   	pop    %ebx
+  802cc2:	5e                   	pop    %esi
+  802cc3:	5f                   	pop    %edi
+  802cc4:	5d                   	pop    %ebp
+  802cc5:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802cc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cc9:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802ccd:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802cd0:	89 c2                	mov    %eax,%edx
+  802cd2:	c1 fa 1f             	sar    $0x1f,%edx
+  802cd5:	89 d1                	mov    %edx,%ecx
+  802cd7:	c1 e9 1b             	shr    $0x1b,%ecx
+  802cda:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802cdd:	83 e2 1f             	and    $0x1f,%edx
+  802ce0:	29 ca                	sub    %ecx,%edx
+  802ce2:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802ce6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802cea:	83 c0 01             	add    $0x1,%eax
+  802ced:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802cf0:	83 c7 01             	add    $0x1,%edi
+  802cf3:	eb 9d                	jmp    802c92 <devpipe_write+0x1c>
+
+00802cf5 <devpipe_read>:
+{
+  802cf5:	55                   	push   %ebp
+  802cf6:	89 e5                	mov    %esp,%ebp
+  802cf8:	57                   	push   %edi
+  802cf9:	56                   	push   %esi
+  802cfa:	53                   	push   %ebx
+  802cfb:	83 ec 18             	sub    $0x18,%esp
+  802cfe:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802d01:	57                   	push   %edi
+  802d02:	e8 a5 e3 ff ff       	call   8010ac <fd2data>
+  802d07:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802d09:	83 c4 10             	add    $0x10,%esp
+  802d0c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d11:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802d14:	75 13                	jne    802d29 <devpipe_read+0x34>
+	return i;
+  802d16:	89 f0                	mov    %esi,%eax
+  802d18:	eb 02                	jmp    802d1c <devpipe_read+0x27>
+				return i;
+  802d1a:	89 f0                	mov    %esi,%eax
+}
+  802d1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d1f:	5b                   	pop    %ebx
+  802d20:	5e                   	pop    %esi
+  802d21:	5f                   	pop    %edi
+  802d22:	5d                   	pop    %ebp
+  802d23:	c3                   	ret
+			sys_yield();
+  802d24:	e8 ba de ff ff       	call   800be3 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802d29:	8b 03                	mov    (%ebx),%eax
+  802d2b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802d2e:	75 18                	jne    802d48 <devpipe_read+0x53>
+			if (i > 0)
+  802d30:	85 f6                	test   %esi,%esi
+  802d32:	75 e6                	jne    802d1a <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802d34:	89 da                	mov    %ebx,%edx
+  802d36:	89 f8                	mov    %edi,%eax
+  802d38:	e8 d4 fe ff ff       	call   802c11 <_pipeisclosed>
+  802d3d:	85 c0                	test   %eax,%eax
+  802d3f:	74 e3                	je     802d24 <devpipe_read+0x2f>
+				return 0;
+  802d41:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d46:	eb d4                	jmp    802d1c <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802d48:	99                   	cltd
+  802d49:	c1 ea 1b             	shr    $0x1b,%edx
+  802d4c:	01 d0                	add    %edx,%eax
+  802d4e:	83 e0 1f             	and    $0x1f,%eax
+  802d51:	29 d0                	sub    %edx,%eax
+  802d53:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802d58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d5b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802d5e:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802d61:	83 c6 01             	add    $0x1,%esi
+  802d64:	eb ab                	jmp    802d11 <devpipe_read+0x1c>
+
+00802d66 <pipe>:
+{
+  802d66:	55                   	push   %ebp
+  802d67:	89 e5                	mov    %esp,%ebp
+  802d69:	56                   	push   %esi
+  802d6a:	53                   	push   %ebx
+  802d6b:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802d6e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d71:	50                   	push   %eax
+  802d72:	e8 4c e3 ff ff       	call   8010c3 <fd_alloc>
+  802d77:	89 c3                	mov    %eax,%ebx
+  802d79:	83 c4 10             	add    $0x10,%esp
+  802d7c:	85 c0                	test   %eax,%eax
+  802d7e:	0f 88 23 01 00 00    	js     802ea7 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d84:	83 ec 04             	sub    $0x4,%esp
+  802d87:	68 07 04 00 00       	push   $0x407
+  802d8c:	ff 75 f4             	push   -0xc(%ebp)
+  802d8f:	6a 00                	push   $0x0
+  802d91:	e8 6c de ff ff       	call   800c02 <sys_page_alloc>
+  802d96:	89 c3                	mov    %eax,%ebx
+  802d98:	83 c4 10             	add    $0x10,%esp
+  802d9b:	85 c0                	test   %eax,%eax
+  802d9d:	0f 88 04 01 00 00    	js     802ea7 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802da3:	83 ec 0c             	sub    $0xc,%esp
+  802da6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802da9:	50                   	push   %eax
+  802daa:	e8 14 e3 ff ff       	call   8010c3 <fd_alloc>
+  802daf:	89 c3                	mov    %eax,%ebx
+  802db1:	83 c4 10             	add    $0x10,%esp
+  802db4:	85 c0                	test   %eax,%eax
+  802db6:	0f 88 db 00 00 00    	js     802e97 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802dbc:	83 ec 04             	sub    $0x4,%esp
+  802dbf:	68 07 04 00 00       	push   $0x407
+  802dc4:	ff 75 f0             	push   -0x10(%ebp)
+  802dc7:	6a 00                	push   $0x0
+  802dc9:	e8 34 de ff ff       	call   800c02 <sys_page_alloc>
+  802dce:	89 c3                	mov    %eax,%ebx
+  802dd0:	83 c4 10             	add    $0x10,%esp
+  802dd3:	85 c0                	test   %eax,%eax
+  802dd5:	0f 88 bc 00 00 00    	js     802e97 <pipe+0x131>
+	va = fd2data(fd0);
+  802ddb:	83 ec 0c             	sub    $0xc,%esp
+  802dde:	ff 75 f4             	push   -0xc(%ebp)
+  802de1:	e8 c6 e2 ff ff       	call   8010ac <fd2data>
+  802de6:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802de8:	83 c4 0c             	add    $0xc,%esp
+  802deb:	68 07 04 00 00       	push   $0x407
+  802df0:	50                   	push   %eax
+  802df1:	6a 00                	push   $0x0
+  802df3:	e8 0a de ff ff       	call   800c02 <sys_page_alloc>
+  802df8:	89 c3                	mov    %eax,%ebx
+  802dfa:	83 c4 10             	add    $0x10,%esp
+  802dfd:	85 c0                	test   %eax,%eax
+  802dff:	0f 88 82 00 00 00    	js     802e87 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e05:	83 ec 0c             	sub    $0xc,%esp
+  802e08:	ff 75 f0             	push   -0x10(%ebp)
+  802e0b:	e8 9c e2 ff ff       	call   8010ac <fd2data>
+  802e10:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802e17:	50                   	push   %eax
+  802e18:	6a 00                	push   $0x0
+  802e1a:	56                   	push   %esi
+  802e1b:	6a 00                	push   $0x0
+  802e1d:	e8 2b de ff ff       	call   800c4d <sys_page_map>
+  802e22:	89 c3                	mov    %eax,%ebx
+  802e24:	83 c4 20             	add    $0x20,%esp
+  802e27:	85 c0                	test   %eax,%eax
+  802e29:	78 4e                	js     802e79 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802e2b:	a1 60 40 80 00       	mov    0x804060,%eax
+  802e30:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802e33:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802e35:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802e38:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802e3f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802e42:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802e44:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802e47:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802e4e:	83 ec 0c             	sub    $0xc,%esp
+  802e51:	ff 75 f4             	push   -0xc(%ebp)
+  802e54:	e8 43 e2 ff ff       	call   80109c <fd2num>
+  802e59:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802e5c:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802e5e:	83 c4 04             	add    $0x4,%esp
+  802e61:	ff 75 f0             	push   -0x10(%ebp)
+  802e64:	e8 33 e2 ff ff       	call   80109c <fd2num>
+  802e69:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802e6c:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802e6f:	83 c4 10             	add    $0x10,%esp
+  802e72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e77:	eb 2e                	jmp    802ea7 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802e79:	83 ec 08             	sub    $0x8,%esp
+  802e7c:	56                   	push   %esi
+  802e7d:	6a 00                	push   $0x0
+  802e7f:	e8 0b de ff ff       	call   800c8f <sys_page_unmap>
+  802e84:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802e87:	83 ec 08             	sub    $0x8,%esp
+  802e8a:	ff 75 f0             	push   -0x10(%ebp)
+  802e8d:	6a 00                	push   $0x0
+  802e8f:	e8 fb dd ff ff       	call   800c8f <sys_page_unmap>
+  802e94:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802e97:	83 ec 08             	sub    $0x8,%esp
+  802e9a:	ff 75 f4             	push   -0xc(%ebp)
+  802e9d:	6a 00                	push   $0x0
+  802e9f:	e8 eb dd ff ff       	call   800c8f <sys_page_unmap>
+  802ea4:	83 c4 10             	add    $0x10,%esp
+}
+  802ea7:	89 d8                	mov    %ebx,%eax
+  802ea9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802eac:	5b                   	pop    %ebx
+  802ead:	5e                   	pop    %esi
+  802eae:	5d                   	pop    %ebp
+  802eaf:	c3                   	ret
+
+00802eb0 <pipeisclosed>:
+{
+  802eb0:	55                   	push   %ebp
+  802eb1:	89 e5                	mov    %esp,%ebp
+  802eb3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802eb6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802eb9:	50                   	push   %eax
+  802eba:	ff 75 08             	push   0x8(%ebp)
+  802ebd:	e8 57 e2 ff ff       	call   801119 <fd_lookup>
+  802ec2:	83 c4 10             	add    $0x10,%esp
+  802ec5:	85 c0                	test   %eax,%eax
+  802ec7:	78 18                	js     802ee1 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802ec9:	83 ec 0c             	sub    $0xc,%esp
+  802ecc:	ff 75 f4             	push   -0xc(%ebp)
+  802ecf:	e8 d8 e1 ff ff       	call   8010ac <fd2data>
+  802ed4:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802ed6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ed9:	e8 33 fd ff ff       	call   802c11 <_pipeisclosed>
+  802ede:	83 c4 10             	add    $0x10,%esp
+}
+  802ee1:	c9                   	leave
+  802ee2:	c3                   	ret
+
+00802ee3 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee8:	c3                   	ret
+
+00802ee9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802ee9:	55                   	push   %ebp
+  802eea:	89 e5                	mov    %esp,%ebp
+  802eec:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802eef:	68 b5 3d 80 00       	push   $0x803db5
+  802ef4:	ff 75 0c             	push   0xc(%ebp)
+  802ef7:	e8 fa d8 ff ff       	call   8007f6 <strcpy>
+	return 0;
+}
+  802efc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f01:	c9                   	leave
+  802f02:	c3                   	ret
+
+00802f03 <devcons_write>:
+{
+  802f03:	55                   	push   %ebp
+  802f04:	89 e5                	mov    %esp,%ebp
+  802f06:	57                   	push   %edi
+  802f07:	56                   	push   %esi
+  802f08:	53                   	push   %ebx
+  802f09:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802f0f:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802f14:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802f1a:	eb 2e                	jmp    802f4a <devcons_write+0x47>
+		m = n - tot;
+  802f1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f1f:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802f21:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802f26:	39 c3                	cmp    %eax,%ebx
+  802f28:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802f2b:	83 ec 04             	sub    $0x4,%esp
+  802f2e:	53                   	push   %ebx
+  802f2f:	89 f0                	mov    %esi,%eax
+  802f31:	03 45 0c             	add    0xc(%ebp),%eax
+  802f34:	50                   	push   %eax
+  802f35:	57                   	push   %edi
+  802f36:	e8 41 da ff ff       	call   80097c <memmove>
+		sys_cputs(buf, m);
+  802f3b:	83 c4 08             	add    $0x8,%esp
+  802f3e:	53                   	push   %ebx
+  802f3f:	57                   	push   %edi
+  802f40:	e8 e1 db ff ff       	call   800b26 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802f45:	01 de                	add    %ebx,%esi
+  802f47:	83 c4 10             	add    $0x10,%esp
+  802f4a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802f4d:	72 cd                	jb     802f1c <devcons_write+0x19>
+}
+  802f4f:	89 f0                	mov    %esi,%eax
+  802f51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f54:	5b                   	pop    %ebx
+  802f55:	5e                   	pop    %esi
+  802f56:	5f                   	pop    %edi
+  802f57:	5d                   	pop    %ebp
+  802f58:	c3                   	ret
+
+00802f59 <devcons_read>:
+{
+  802f59:	55                   	push   %ebp
+  802f5a:	89 e5                	mov    %esp,%ebp
+  802f5c:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802f5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f64:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f68:	75 07                	jne    802f71 <devcons_read+0x18>
+  802f6a:	eb 1f                	jmp    802f8b <devcons_read+0x32>
+		sys_yield();
+  802f6c:	e8 72 dc ff ff       	call   800be3 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802f71:	e8 d6 db ff ff       	call   800b4c <sys_cgetc>
+  802f76:	85 c0                	test   %eax,%eax
+  802f78:	74 f2                	je     802f6c <devcons_read+0x13>
+	if (c < 0)
+  802f7a:	78 0f                	js     802f8b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802f7c:	83 f8 04             	cmp    $0x4,%eax
+  802f7f:	74 0c                	je     802f8d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802f81:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802f84:	88 02                	mov    %al,(%edx)
+	return 1;
+  802f86:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802f8b:	c9                   	leave
+  802f8c:	c3                   	ret
+		return 0;
+  802f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f92:	eb f7                	jmp    802f8b <devcons_read+0x32>
+
+00802f94 <cputchar>:
+{
+  802f94:	55                   	push   %ebp
+  802f95:	89 e5                	mov    %esp,%ebp
+  802f97:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802f9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f9d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802fa0:	6a 01                	push   $0x1
+  802fa2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802fa5:	50                   	push   %eax
+  802fa6:	e8 7b db ff ff       	call   800b26 <sys_cputs>
+}
+  802fab:	83 c4 10             	add    $0x10,%esp
+  802fae:	c9                   	leave
+  802faf:	c3                   	ret
+
+00802fb0 <getchar>:
+{
+  802fb0:	55                   	push   %ebp
+  802fb1:	89 e5                	mov    %esp,%ebp
+  802fb3:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802fb6:	6a 01                	push   $0x1
+  802fb8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802fbb:	50                   	push   %eax
+  802fbc:	6a 00                	push   $0x0
+  802fbe:	e8 bc e3 ff ff       	call   80137f <read>
+	if (r < 0)
+  802fc3:	83 c4 10             	add    $0x10,%esp
+  802fc6:	85 c0                	test   %eax,%eax
+  802fc8:	78 06                	js     802fd0 <getchar+0x20>
+	if (r < 1)
+  802fca:	74 06                	je     802fd2 <getchar+0x22>
+	return c;
+  802fcc:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802fd0:	c9                   	leave
+  802fd1:	c3                   	ret
+		return -E_EOF;
+  802fd2:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802fd7:	eb f7                	jmp    802fd0 <getchar+0x20>
+
+00802fd9 <iscons>:
+{
+  802fd9:	55                   	push   %ebp
+  802fda:	89 e5                	mov    %esp,%ebp
+  802fdc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802fdf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fe2:	50                   	push   %eax
+  802fe3:	ff 75 08             	push   0x8(%ebp)
+  802fe6:	e8 2e e1 ff ff       	call   801119 <fd_lookup>
+  802feb:	83 c4 10             	add    $0x10,%esp
+  802fee:	85 c0                	test   %eax,%eax
+  802ff0:	78 11                	js     803003 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802ff2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ff5:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802ffb:	39 10                	cmp    %edx,(%eax)
+  802ffd:	0f 94 c0             	sete   %al
+  803000:	0f b6 c0             	movzbl %al,%eax
+}
+  803003:	c9                   	leave
+  803004:	c3                   	ret
+
+00803005 <opencons>:
+{
+  803005:	55                   	push   %ebp
+  803006:	89 e5                	mov    %esp,%ebp
+  803008:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80300b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80300e:	50                   	push   %eax
+  80300f:	e8 af e0 ff ff       	call   8010c3 <fd_alloc>
+  803014:	83 c4 10             	add    $0x10,%esp
+  803017:	85 c0                	test   %eax,%eax
+  803019:	78 3a                	js     803055 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80301b:	83 ec 04             	sub    $0x4,%esp
+  80301e:	68 07 04 00 00       	push   $0x407
+  803023:	ff 75 f4             	push   -0xc(%ebp)
+  803026:	6a 00                	push   $0x0
+  803028:	e8 d5 db ff ff       	call   800c02 <sys_page_alloc>
+  80302d:	83 c4 10             	add    $0x10,%esp
+  803030:	85 c0                	test   %eax,%eax
+  803032:	78 21                	js     803055 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803034:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803037:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80303d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80303f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803042:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803049:	83 ec 0c             	sub    $0xc,%esp
+  80304c:	50                   	push   %eax
+  80304d:	e8 4a e0 ff ff       	call   80109c <fd2num>
+  803052:	83 c4 10             	add    $0x10,%esp
+}
+  803055:	c9                   	leave
+  803056:	c3                   	ret
+
+00803057 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  803057:	55                   	push   %ebp
+  803058:	89 e5                	mov    %esp,%ebp
+  80305a:	57                   	push   %edi
+  80305b:	56                   	push   %esi
+  80305c:	53                   	push   %ebx
+  80305d:	83 ec 20             	sub    $0x20,%esp
+  803060:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803063:	89 d7                	mov    %edx,%edi
+  803065:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  803067:	51                   	push   %ecx
+  803068:	68 00 f0 7f 00       	push   $0x7ff000
+  80306d:	6a 00                	push   $0x0
+  80306f:	e8 8e db ff ff       	call   800c02 <sys_page_alloc>
+  803074:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803076:	83 c4 10             	add    $0x10,%esp
+  803079:	85 c0                	test   %eax,%eax
+  80307b:	78 45                	js     8030c2 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  80307d:	83 ec 04             	sub    $0x4,%esp
+  803080:	68 00 10 00 00       	push   $0x1000
+  803085:	57                   	push   %edi
+  803086:	68 00 f0 7f 00       	push   $0x7ff000
+  80308b:	e8 ec d8 ff ff       	call   80097c <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  803090:	89 34 24             	mov    %esi,(%esp)
+  803093:	57                   	push   %edi
+  803094:	ff 75 e4             	push   -0x1c(%ebp)
+  803097:	68 00 f0 7f 00       	push   $0x7ff000
+  80309c:	6a 00                	push   $0x0
+  80309e:	e8 aa db ff ff       	call   800c4d <sys_page_map>
+  8030a3:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8030a5:	83 c4 20             	add    $0x20,%esp
+  8030a8:	85 c0                	test   %eax,%eax
+  8030aa:	78 16                	js     8030c2 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8030ac:	83 ec 08             	sub    $0x8,%esp
+  8030af:	68 00 f0 7f 00       	push   $0x7ff000
+  8030b4:	6a 00                	push   $0x0
+  8030b6:	e8 d4 db ff ff       	call   800c8f <sys_page_unmap>
+  8030bb:	83 c4 10             	add    $0x10,%esp
+  8030be:	85 c0                	test   %eax,%eax
+  8030c0:	75 0a                	jne    8030cc <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8030c2:	89 d8                	mov    %ebx,%eax
+  8030c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030c7:	5b                   	pop    %ebx
+  8030c8:	5e                   	pop    %esi
+  8030c9:	5f                   	pop    %edi
+  8030ca:	5d                   	pop    %ebp
+  8030cb:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8030cc:	68 c4 3d 80 00       	push   $0x803dc4
+  8030d1:	68 4c 3c 80 00       	push   $0x803c4c
+  8030d6:	6a 1b                	push   $0x1b
+  8030d8:	68 3c 3e 80 00       	push   $0x803e3c
+  8030dd:	e8 4b d0 ff ff       	call   80012d <_panic>
+
+008030e2 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8030e2:	55                   	push   %ebp
+  8030e3:	89 e5                	mov    %esp,%ebp
+  8030e5:	53                   	push   %ebx
+  8030e6:	83 ec 04             	sub    $0x4,%esp
+  8030e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8030ec:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8030ee:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  8030f2:	74 21                	je     803115 <pgfault+0x33>
+  8030f4:	89 d0                	mov    %edx,%eax
+  8030f6:	c1 e8 16             	shr    $0x16,%eax
+  8030f9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803100:	a8 01                	test   $0x1,%al
+  803102:	74 11                	je     803115 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803104:	89 d0                	mov    %edx,%eax
+  803106:	c1 e8 0c             	shr    $0xc,%eax
+  803109:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803110:	f6 c4 08             	test   $0x8,%ah
+  803113:	75 17                	jne    80312c <pgfault+0x4a>
+		if (pgfault_next) {
+  803115:	a1 04 90 80 00       	mov    0x809004,%eax
+  80311a:	85 c0                	test   %eax,%eax
+  80311c:	74 27                	je     803145 <pgfault+0x63>
+			pgfault_next(utf);
+  80311e:	83 ec 0c             	sub    $0xc,%esp
+  803121:	53                   	push   %ebx
+  803122:	ff d0                	call   *%eax
+			return;
+  803124:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803127:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80312a:	c9                   	leave
+  80312b:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  80312c:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803132:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803137:	b8 00 00 00 00       	mov    $0x0,%eax
+  80313c:	e8 16 ff ff ff       	call   803057 <copy_page_to>
+  803141:	85 c0                	test   %eax,%eax
+  803143:	79 e2                	jns    803127 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803145:	a1 00 50 80 00       	mov    0x805000,%eax
+  80314a:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  80314d:	ff 73 28             	push   0x28(%ebx)
+  803150:	ff 33                	push   (%ebx)
+  803152:	50                   	push   %eax
+  803153:	68 e8 3d 80 00       	push   $0x803de8
+  803158:	e8 ab d0 ff ff       	call   800208 <cprintf>
+	sys_env_destroy(0);
+  80315d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803164:	e8 0a da ff ff       	call   800b73 <sys_env_destroy>
+  803169:	83 c4 10             	add    $0x10,%esp
+  80316c:	eb b9                	jmp    803127 <pgfault+0x45>
+
+0080316e <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  80316e:	55                   	push   %ebp
+  80316f:	89 e5                	mov    %esp,%ebp
+  803171:	53                   	push   %ebx
+  803172:	83 ec 04             	sub    $0x4,%esp
+  803175:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803178:	a1 04 50 80 00       	mov    0x805004,%eax
+  80317d:	3d e2 30 80 00       	cmp    $0x8030e2,%eax
+  803182:	74 15                	je     803199 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803184:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  803189:	83 ec 0c             	sub    $0xc,%esp
+  80318c:	68 e2 30 80 00       	push   $0x8030e2
+  803191:	e8 6d de ff ff       	call   801003 <set_pgfault_handler>
+  803196:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803199:	83 ec 0c             	sub    $0xc,%esp
+  80319c:	68 05 08 00 00       	push   $0x805
+  8031a1:	53                   	push   %ebx
+  8031a2:	6a 00                	push   $0x0
+  8031a4:	53                   	push   %ebx
+  8031a5:	6a 00                	push   $0x0
+  8031a7:	e8 a1 da ff ff       	call   800c4d <sys_page_map>
+}
+  8031ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031af:	c9                   	leave
+  8031b0:	c3                   	ret
+
+008031b1 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8031b1:	55                   	push   %ebp
+  8031b2:	89 e5                	mov    %esp,%ebp
+  8031b4:	57                   	push   %edi
+  8031b5:	56                   	push   %esi
+  8031b6:	53                   	push   %ebx
+  8031b7:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8031ba:	68 e2 30 80 00       	push   $0x8030e2
+  8031bf:	e8 3f de ff ff       	call   801003 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8031c4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8031c9:	cd 30                	int    $0x30
+  8031cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8031ce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8031d1:	83 c4 10             	add    $0x10,%esp
+  8031d4:	85 c0                	test   %eax,%eax
+  8031d6:	0f 88 6b 01 00 00    	js     803347 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8031dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8031e1:	75 37                	jne    80321a <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8031e3:	e8 d4 d9 ff ff       	call   800bbc <sys_getenvid>
+  8031e8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031ed:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8031f3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8031f8:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8031fd:	e9 45 01 00 00       	jmp    803347 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803202:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803208:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80320e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803214:	0f 87 ba 00 00 00    	ja     8032d4 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  80321a:	89 d8                	mov    %ebx,%eax
+  80321c:	c1 e8 16             	shr    $0x16,%eax
+  80321f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803226:	a8 01                	test   $0x1,%al
+  803228:	74 d8                	je     803202 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  80322a:	89 d8                	mov    %ebx,%eax
+  80322c:	c1 e8 0c             	shr    $0xc,%eax
+  80322f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803236:	f6 c2 01             	test   $0x1,%dl
+  803239:	74 cd                	je     803208 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  80323b:	89 da                	mov    %ebx,%edx
+  80323d:	80 e6 df             	and    $0xdf,%dh
+  803240:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803246:	74 c0                	je     803208 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803248:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80324a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803251:	f6 c6 04             	test   $0x4,%dh
+  803254:	75 53                	jne    8032a9 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803256:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80325d:	f6 c6 08             	test   $0x8,%dh
+  803260:	75 0c                	jne    80326e <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803262:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803269:	f6 c2 02             	test   $0x2,%dl
+  80326c:	74 3b                	je     8032a9 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80326e:	83 ec 0c             	sub    $0xc,%esp
+  803271:	68 05 08 00 00       	push   $0x805
+  803276:	57                   	push   %edi
+  803277:	ff 75 e4             	push   -0x1c(%ebp)
+  80327a:	57                   	push   %edi
+  80327b:	6a 00                	push   $0x0
+  80327d:	e8 cb d9 ff ff       	call   800c4d <sys_page_map>
+  803282:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803284:	83 c4 20             	add    $0x20,%esp
+  803287:	85 c0                	test   %eax,%eax
+  803289:	0f 88 a7 00 00 00    	js     803336 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80328f:	83 ec 0c             	sub    $0xc,%esp
+  803292:	68 05 08 00 00       	push   $0x805
+  803297:	57                   	push   %edi
+  803298:	6a 00                	push   $0x0
+  80329a:	57                   	push   %edi
+  80329b:	6a 00                	push   $0x0
+  80329d:	e8 ab d9 ff ff       	call   800c4d <sys_page_map>
+  8032a2:	89 c6                	mov    %eax,%esi
+	return r;
+  8032a4:	83 c4 20             	add    $0x20,%esp
+  8032a7:	eb 21                	jmp    8032ca <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8032a9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8032b0:	83 ec 0c             	sub    $0xc,%esp
+  8032b3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8032b8:	50                   	push   %eax
+  8032b9:	57                   	push   %edi
+  8032ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8032bd:	57                   	push   %edi
+  8032be:	6a 00                	push   $0x0
+  8032c0:	e8 88 d9 ff ff       	call   800c4d <sys_page_map>
+  8032c5:	89 c6                	mov    %eax,%esi
+  8032c7:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8032ca:	85 f6                	test   %esi,%esi
+  8032cc:	0f 89 36 ff ff ff    	jns    803208 <fork+0x57>
+  8032d2:	eb 62                	jmp    803336 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8032d4:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8032d9:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8032de:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8032e1:	89 f8                	mov    %edi,%eax
+  8032e3:	e8 6f fd ff ff       	call   803057 <copy_page_to>
+  8032e8:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032ea:	85 c0                	test   %eax,%eax
+  8032ec:	78 48                	js     803336 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8032ee:	83 ec 04             	sub    $0x4,%esp
+  8032f1:	6a 07                	push   $0x7
+  8032f3:	68 00 f0 bf ee       	push   $0xeebff000
+  8032f8:	57                   	push   %edi
+  8032f9:	e8 04 d9 ff ff       	call   800c02 <sys_page_alloc>
+  8032fe:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803300:	83 c4 10             	add    $0x10,%esp
+  803303:	85 c0                	test   %eax,%eax
+  803305:	78 2f                	js     803336 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803307:	a1 00 50 80 00       	mov    0x805000,%eax
+  80330c:	8b 40 64             	mov    0x64(%eax),%eax
+  80330f:	83 ec 08             	sub    $0x8,%esp
+  803312:	50                   	push   %eax
+  803313:	57                   	push   %edi
+  803314:	e8 54 da ff ff       	call   800d6d <sys_env_set_pgfault_upcall>
+  803319:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80331b:	83 c4 10             	add    $0x10,%esp
+  80331e:	85 c0                	test   %eax,%eax
+  803320:	78 14                	js     803336 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803322:	83 ec 08             	sub    $0x8,%esp
+  803325:	6a 02                	push   $0x2
+  803327:	57                   	push   %edi
+  803328:	e8 ac d9 ff ff       	call   800cd9 <sys_env_set_status>
+  80332d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80332f:	83 c4 10             	add    $0x10,%esp
+  803332:	85 c0                	test   %eax,%eax
+  803334:	79 11                	jns    803347 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803336:	83 ec 0c             	sub    $0xc,%esp
+  803339:	ff 75 e0             	push   -0x20(%ebp)
+  80333c:	e8 32 d8 ff ff       	call   800b73 <sys_env_destroy>
+	return r;
+  803341:	83 c4 10             	add    $0x10,%esp
+  803344:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803347:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80334a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80334d:	5b                   	pop    %ebx
+  80334e:	5e                   	pop    %esi
+  80334f:	5f                   	pop    %edi
+  803350:	5d                   	pop    %ebp
+  803351:	c3                   	ret
+
+00803352 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803352:	55                   	push   %ebp
+  803353:	89 e5                	mov    %esp,%ebp
+  803355:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803358:	68 47 3e 80 00       	push   $0x803e47
+  80335d:	68 bf 00 00 00       	push   $0xbf
+  803362:	68 3c 3e 80 00       	push   $0x803e3c
+  803367:	e8 c1 cd ff ff       	call   80012d <_panic>
+
+0080336c <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80336c:	55                   	push   %ebp
+  80336d:	89 e5                	mov    %esp,%ebp
+  80336f:	56                   	push   %esi
+  803370:	53                   	push   %ebx
+  803371:	8b 75 08             	mov    0x8(%ebp),%esi
+  803374:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803377:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80337a:	85 c0                	test   %eax,%eax
+  80337c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803381:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803384:	83 ec 0c             	sub    $0xc,%esp
+  803387:	50                   	push   %eax
+  803388:	e8 bd da ff ff       	call   800e4a <sys_ipc_recv>
+	if (from_env_store)
+  80338d:	83 c4 10             	add    $0x10,%esp
+  803390:	85 f6                	test   %esi,%esi
+  803392:	74 14                	je     8033a8 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803394:	ba 00 00 00 00       	mov    $0x0,%edx
+  803399:	85 c0                	test   %eax,%eax
+  80339b:	75 09                	jne    8033a6 <ipc_recv+0x3a>
+  80339d:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8033a3:	8b 52 74             	mov    0x74(%edx),%edx
+  8033a6:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8033a8:	85 db                	test   %ebx,%ebx
+  8033aa:	74 25                	je     8033d1 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033ac:	85 c0                	test   %eax,%eax
+  8033ae:	74 0d                	je     8033bd <ipc_recv+0x51>
+  8033b0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8033b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033b9:	5b                   	pop    %ebx
+  8033ba:	5e                   	pop    %esi
+  8033bb:	5d                   	pop    %ebp
+  8033bc:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033bd:	a1 00 50 80 00       	mov    0x805000,%eax
+  8033c2:	8b 40 78             	mov    0x78(%eax),%eax
+  8033c5:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8033c7:	a1 00 50 80 00       	mov    0x805000,%eax
+  8033cc:	8b 40 70             	mov    0x70(%eax),%eax
+  8033cf:	eb e5                	jmp    8033b6 <ipc_recv+0x4a>
+  8033d1:	85 c0                	test   %eax,%eax
+  8033d3:	75 e1                	jne    8033b6 <ipc_recv+0x4a>
+  8033d5:	eb f0                	jmp    8033c7 <ipc_recv+0x5b>
+
+008033d7 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8033d7:	55                   	push   %ebp
+  8033d8:	89 e5                	mov    %esp,%ebp
+  8033da:	57                   	push   %edi
+  8033db:	56                   	push   %esi
+  8033dc:	53                   	push   %ebx
+  8033dd:	83 ec 0c             	sub    $0xc,%esp
+  8033e0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8033e9:	85 db                	test   %ebx,%ebx
+  8033eb:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8033f0:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8033f3:	ff 75 14             	push   0x14(%ebp)
+  8033f6:	53                   	push   %ebx
+  8033f7:	56                   	push   %esi
+  8033f8:	57                   	push   %edi
+  8033f9:	e8 b9 d9 ff ff       	call   800db7 <sys_ipc_try_send>
+  8033fe:	83 c4 10             	add    $0x10,%esp
+  803401:	85 c0                	test   %eax,%eax
+  803403:	74 22                	je     803427 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803405:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803408:	75 07                	jne    803411 <ipc_send+0x3a>
+		sys_yield();
+  80340a:	e8 d4 d7 ff ff       	call   800be3 <sys_yield>
+  80340f:	eb e2                	jmp    8033f3 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803411:	68 5d 3e 80 00       	push   $0x803e5d
+  803416:	68 4c 3c 80 00       	push   $0x803c4c
+  80341b:	6a 39                	push   $0x39
+  80341d:	68 72 3e 80 00       	push   $0x803e72
+  803422:	e8 06 cd ff ff       	call   80012d <_panic>
+	}
+}
+  803427:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80342a:	5b                   	pop    %ebx
+  80342b:	5e                   	pop    %esi
+  80342c:	5f                   	pop    %edi
+  80342d:	5d                   	pop    %ebp
+  80342e:	c3                   	ret
+
+0080342f <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80342f:	55                   	push   %ebp
+  803430:	89 e5                	mov    %esp,%ebp
+  803432:	57                   	push   %edi
+  803433:	56                   	push   %esi
+  803434:	53                   	push   %ebx
+  803435:	83 ec 10             	sub    $0x10,%esp
+  803438:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80343b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80343e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803441:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803444:	85 c0                	test   %eax,%eax
+  803446:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80344b:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  80344e:	6a 00                	push   $0x0
+  803450:	ff 33                	push   (%ebx)
+  803452:	50                   	push   %eax
+  803453:	e8 af d9 ff ff       	call   800e07 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803458:	83 c4 10             	add    $0x10,%esp
+  80345b:	85 c0                	test   %eax,%eax
+  80345d:	75 3c                	jne    80349b <ipc_recvv+0x6c>
+  80345f:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803465:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803468:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  80346a:	85 ff                	test   %edi,%edi
+  80346c:	74 4e                	je     8034bc <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80346e:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803474:	8b 52 74             	mov    0x74(%edx),%edx
+  803477:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803479:	85 f6                	test   %esi,%esi
+  80347b:	74 18                	je     803495 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80347d:	85 c0                	test   %eax,%eax
+  80347f:	75 2d                	jne    8034ae <ipc_recvv+0x7f>
+  803481:	a1 00 50 80 00       	mov    0x805000,%eax
+  803486:	8b 40 78             	mov    0x78(%eax),%eax
+  803489:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  80348b:	a1 00 50 80 00       	mov    0x805000,%eax
+  803490:	8b 40 70             	mov    0x70(%eax),%eax
+  803493:	eb 1f                	jmp    8034b4 <ipc_recvv+0x85>
+  803495:	85 c0                	test   %eax,%eax
+  803497:	75 1b                	jne    8034b4 <ipc_recvv+0x85>
+  803499:	eb f0                	jmp    80348b <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80349b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8034a1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8034a6:	85 ff                	test   %edi,%edi
+  8034a8:	75 cd                	jne    803477 <ipc_recvv+0x48>
+	if (perm_store)
+  8034aa:	85 f6                	test   %esi,%esi
+  8034ac:	74 e7                	je     803495 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8034ae:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8034b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034b7:	5b                   	pop    %ebx
+  8034b8:	5e                   	pop    %esi
+  8034b9:	5f                   	pop    %edi
+  8034ba:	5d                   	pop    %ebp
+  8034bb:	c3                   	ret
+	if (perm_store)
+  8034bc:	85 f6                	test   %esi,%esi
+  8034be:	75 bd                	jne    80347d <ipc_recvv+0x4e>
+  8034c0:	eb c9                	jmp    80348b <ipc_recvv+0x5c>
+
+008034c2 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8034c2:	55                   	push   %ebp
+  8034c3:	89 e5                	mov    %esp,%ebp
+  8034c5:	57                   	push   %edi
+  8034c6:	56                   	push   %esi
+  8034c7:	53                   	push   %ebx
+  8034c8:	83 ec 0c             	sub    $0xc,%esp
+  8034cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8034ce:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8034d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8034d4:	ff 75 14             	push   0x14(%ebp)
+  8034d7:	53                   	push   %ebx
+  8034d8:	56                   	push   %esi
+  8034d9:	57                   	push   %edi
+  8034da:	e8 00 d9 ff ff       	call   800ddf <sys_ipc_try_sendv>
+  8034df:	83 c4 10             	add    $0x10,%esp
+  8034e2:	85 c0                	test   %eax,%eax
+  8034e4:	74 22                	je     803508 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8034e6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8034e9:	75 07                	jne    8034f2 <ipc_sendv+0x30>
+		sys_yield();
+  8034eb:	e8 f3 d6 ff ff       	call   800be3 <sys_yield>
+  8034f0:	eb e2                	jmp    8034d4 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8034f2:	68 5d 3e 80 00       	push   $0x803e5d
+  8034f7:	68 4c 3c 80 00       	push   $0x803c4c
+  8034fc:	6a 5c                	push   $0x5c
+  8034fe:	68 72 3e 80 00       	push   $0x803e72
+  803503:	e8 25 cc ff ff       	call   80012d <_panic>
+	}
+}
+  803508:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80350b:	5b                   	pop    %ebx
+  80350c:	5e                   	pop    %esi
+  80350d:	5f                   	pop    %edi
+  80350e:	5d                   	pop    %ebp
+  80350f:	c3                   	ret
+
+00803510 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803510:	55                   	push   %ebp
+  803511:	89 e5                	mov    %esp,%ebp
+  803513:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803516:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80351b:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803521:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803527:	8b 52 50             	mov    0x50(%edx),%edx
+  80352a:	39 ca                	cmp    %ecx,%edx
+  80352c:	74 11                	je     80353f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80352e:	83 c0 01             	add    $0x1,%eax
+  803531:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803536:	75 e3                	jne    80351b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803538:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353d:	eb 0e                	jmp    80354d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80353f:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803545:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80354a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80354d:	5d                   	pop    %ebp
+  80354e:	c3                   	ret
+
+0080354f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80354f:	55                   	push   %ebp
+  803550:	89 e5                	mov    %esp,%ebp
+  803552:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803555:	89 c2                	mov    %eax,%edx
+  803557:	c1 ea 16             	shr    $0x16,%edx
+  80355a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803561:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803566:	f6 c1 01             	test   $0x1,%cl
+  803569:	74 22                	je     80358d <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80356b:	c1 e8 0c             	shr    $0xc,%eax
+  80356e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803575:	a8 01                	test   $0x1,%al
+  803577:	74 14                	je     80358d <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803579:	c1 e8 0c             	shr    $0xc,%eax
+  80357c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80357f:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803586:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  80358a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80358d:	89 d0                	mov    %edx,%eax
+  80358f:	5d                   	pop    %ebp
+  803590:	c3                   	ret
+
+00803591 <dm>:
+  803591:	55                   	push   %ebp
+  803592:	57                   	push   %edi
+  803593:	56                   	push   %esi
+  803594:	53                   	push   %ebx
+  803595:	83 ec 24             	sub    $0x24,%esp
+  803598:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80359c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035a0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035a4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035a8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035ac:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035b0:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8035b4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035c3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035ca:	00 
+  8035cb:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035d2:	00 
+  8035d3:	89 fb                	mov    %edi,%ebx
+  8035d5:	eb 08                	jmp    8035df <dm+0x4e>
+  8035d7:	83 e9 01             	sub    $0x1,%ecx
+  8035da:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8035dd:	74 68                	je     803647 <dm+0xb6>
+  8035df:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8035e3:	01 c0                	add    %eax,%eax
+  8035e5:	89 c6                	mov    %eax,%esi
+  8035e7:	89 d7                	mov    %edx,%edi
+  8035e9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8035ed:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8035f1:	0f ad d0             	shrd   %cl,%edx,%eax
+  8035f4:	d3 ea                	shr    %cl,%edx
+  8035f6:	f6 c1 20             	test   $0x20,%cl
+  8035f9:	74 04                	je     8035ff <dm+0x6e>
+  8035fb:	89 d0                	mov    %edx,%eax
+  8035fd:	31 d2                	xor    %edx,%edx
+  8035ff:	83 e0 01             	and    $0x1,%eax
+  803602:	89 04 24             	mov    %eax,(%esp)
+  803605:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80360c:	00 
+  80360d:	8b 04 24             	mov    (%esp),%eax
+  803610:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803614:	09 f0                	or     %esi,%eax
+  803616:	09 fa                	or     %edi,%edx
+  803618:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80361c:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803620:	39 f0                	cmp    %esi,%eax
+  803622:	89 d5                	mov    %edx,%ebp
+  803624:	19 fd                	sbb    %edi,%ebp
+  803626:	72 af                	jb     8035d7 <dm+0x46>
+  803628:	29 f0                	sub    %esi,%eax
+  80362a:	19 fa                	sbb    %edi,%edx
+  80362c:	89 cf                	mov    %ecx,%edi
+  80362e:	c1 ef 05             	shr    $0x5,%edi
+  803631:	83 e7 01             	and    $0x1,%edi
+  803634:	89 fe                	mov    %edi,%esi
+  803636:	83 f6 01             	xor    $0x1,%esi
+  803639:	d3 e6                	shl    %cl,%esi
+  80363b:	d3 e7                	shl    %cl,%edi
+  80363d:	09 74 24 18          	or     %esi,0x18(%esp)
+  803641:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803645:	eb 90                	jmp    8035d7 <dm+0x46>
+  803647:	85 db                	test   %ebx,%ebx
+  803649:	74 05                	je     803650 <dm+0xbf>
+  80364b:	89 03                	mov    %eax,(%ebx)
+  80364d:	89 53 04             	mov    %edx,0x4(%ebx)
+  803650:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803654:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803658:	83 c4 24             	add    $0x24,%esp
+  80365b:	5b                   	pop    %ebx
+  80365c:	5e                   	pop    %esi
+  80365d:	5f                   	pop    %edi
+  80365e:	5d                   	pop    %ebp
+  80365f:	c3                   	ret
+
+00803660 <__udivdi3>:
+  803660:	83 ec 08             	sub    $0x8,%esp
+  803663:	6a 00                	push   $0x0
+  803665:	ff 74 24 1c          	push   0x1c(%esp)
+  803669:	ff 74 24 1c          	push   0x1c(%esp)
+  80366d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803671:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803675:	e8 17 ff ff ff       	call   803591 <dm>
+  80367a:	83 c4 14             	add    $0x14,%esp
+  80367d:	c3                   	ret
+
+0080367e <__umoddi3>:
+  80367e:	83 ec 18             	sub    $0x18,%esp
+  803681:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803685:	50                   	push   %eax
+  803686:	ff 74 24 2c          	push   0x2c(%esp)
+  80368a:	ff 74 24 2c          	push   0x2c(%esp)
+  80368e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803692:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803696:	e8 f6 fe ff ff       	call   803591 <dm>
+  80369b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80369f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036a3:	83 c4 24             	add    $0x24,%esp
+  8036a6:	c3                   	ret
+
+008036a7 <__divdi3>:
+  8036a7:	53                   	push   %ebx
+  8036a8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036ac:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036b0:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8036b4:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036b8:	85 d2                	test   %edx,%edx
+  8036ba:	78 15                	js     8036d1 <__divdi3+0x2a>
+  8036bc:	85 db                	test   %ebx,%ebx
+  8036be:	78 34                	js     8036f4 <__divdi3+0x4d>
+  8036c0:	83 ec 04             	sub    $0x4,%esp
+  8036c3:	6a 00                	push   $0x0
+  8036c5:	53                   	push   %ebx
+  8036c6:	51                   	push   %ecx
+  8036c7:	e8 c5 fe ff ff       	call   803591 <dm>
+  8036cc:	83 c4 10             	add    $0x10,%esp
+  8036cf:	eb 21                	jmp    8036f2 <__divdi3+0x4b>
+  8036d1:	f7 d8                	neg    %eax
+  8036d3:	83 d2 00             	adc    $0x0,%edx
+  8036d6:	f7 da                	neg    %edx
+  8036d8:	85 db                	test   %ebx,%ebx
+  8036da:	78 30                	js     80370c <__divdi3+0x65>
+  8036dc:	83 ec 04             	sub    $0x4,%esp
+  8036df:	6a 00                	push   $0x0
+  8036e1:	53                   	push   %ebx
+  8036e2:	51                   	push   %ecx
+  8036e3:	e8 a9 fe ff ff       	call   803591 <dm>
+  8036e8:	83 c4 10             	add    $0x10,%esp
+  8036eb:	f7 d8                	neg    %eax
+  8036ed:	83 d2 00             	adc    $0x0,%edx
+  8036f0:	f7 da                	neg    %edx
+  8036f2:	5b                   	pop    %ebx
+  8036f3:	c3                   	ret
+  8036f4:	83 ec 04             	sub    $0x4,%esp
+  8036f7:	6a 00                	push   $0x0
+  8036f9:	f7 d9                	neg    %ecx
+  8036fb:	83 d3 00             	adc    $0x0,%ebx
+  8036fe:	f7 db                	neg    %ebx
+  803700:	53                   	push   %ebx
+  803701:	51                   	push   %ecx
+  803702:	e8 8a fe ff ff       	call   803591 <dm>
+  803707:	83 c4 10             	add    $0x10,%esp
+  80370a:	eb df                	jmp    8036eb <__divdi3+0x44>
+  80370c:	83 ec 04             	sub    $0x4,%esp
+  80370f:	6a 00                	push   $0x0
+  803711:	f7 d9                	neg    %ecx
+  803713:	83 d3 00             	adc    $0x0,%ebx
+  803716:	f7 db                	neg    %ebx
+  803718:	53                   	push   %ebx
+  803719:	51                   	push   %ecx
+  80371a:	e8 72 fe ff ff       	call   803591 <dm>
+  80371f:	83 c4 10             	add    $0x10,%esp
+  803722:	eb ce                	jmp    8036f2 <__divdi3+0x4b>
+
+00803724 <__moddi3>:
+  803724:	55                   	push   %ebp
+  803725:	57                   	push   %edi
+  803726:	56                   	push   %esi
+  803727:	53                   	push   %ebx
+  803728:	83 ec 24             	sub    $0x24,%esp
+  80372b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80372f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803733:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803737:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80373b:	85 d2                	test   %edx,%edx
+  80373d:	78 3b                	js     80377a <__moddi3+0x56>
+  80373f:	83 ec 04             	sub    $0x4,%esp
+  803742:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803746:	56                   	push   %esi
+  803747:	89 ce                	mov    %ecx,%esi
+  803749:	f7 de                	neg    %esi
+  80374b:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80374f:	89 de                	mov    %ebx,%esi
+  803751:	83 d6 00             	adc    $0x0,%esi
+  803754:	f7 de                	neg    %esi
+  803756:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80375a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80375e:	0f 48 f1             	cmovs  %ecx,%esi
+  803761:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803766:	53                   	push   %ebx
+  803767:	56                   	push   %esi
+  803768:	e8 24 fe ff ff       	call   803591 <dm>
+  80376d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803771:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803775:	83 c4 10             	add    $0x10,%esp
+  803778:	eb 47                	jmp    8037c1 <__moddi3+0x9d>
+  80377a:	f7 d8                	neg    %eax
+  80377c:	83 d2 00             	adc    $0x0,%edx
+  80377f:	f7 da                	neg    %edx
+  803781:	83 ec 04             	sub    $0x4,%esp
+  803784:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803788:	56                   	push   %esi
+  803789:	89 cf                	mov    %ecx,%edi
+  80378b:	f7 df                	neg    %edi
+  80378d:	89 de                	mov    %ebx,%esi
+  80378f:	83 d6 00             	adc    $0x0,%esi
+  803792:	f7 de                	neg    %esi
+  803794:	0f 49 cf             	cmovns %edi,%ecx
+  803797:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80379b:	0f 49 de             	cmovns %esi,%ebx
+  80379e:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8037a2:	ff 74 24 0c          	push   0xc(%esp)
+  8037a6:	ff 74 24 0c          	push   0xc(%esp)
+  8037aa:	e8 e2 fd ff ff       	call   803591 <dm>
+  8037af:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037b3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037b7:	f7 d8                	neg    %eax
+  8037b9:	83 d2 00             	adc    $0x0,%edx
+  8037bc:	f7 da                	neg    %edx
+  8037be:	83 c4 10             	add    $0x10,%esp
+  8037c1:	83 c4 24             	add    $0x24,%esp
+  8037c4:	5b                   	pop    %ebx
+  8037c5:	5e                   	pop    %esi
+  8037c6:	5f                   	pop    %edi
+  8037c7:	5d                   	pop    %ebp
+  8037c8:	c3                   	ret
@@ -0,0 +1,7683 @@
+
+obj/user/faultallocbad.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 c0 37 80 00       	push   $0x8037c0
+  800045:	e8 a9 01 00 00       	call   8001f3 <cprintf>
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 8f 0b 00 00       	call   800bed <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800065:	53                   	push   %ebx
+  800066:	68 0c 38 80 00       	push   $0x80380c
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 19 07 00 00       	call   80078c <snprintf>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 e0 37 80 00       	push   $0x8037e0
+  800085:	6a 0f                	push   $0xf
+  800087:	68 ca 37 80 00       	push   $0x8037ca
+  80008c:	e8 87 00 00 00       	call   800118 <_panic>
+
+00800091 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 4d 0f 00 00       	call   800fee <set_pgfault_handler>
+	sys_cputs((char*)0xDEADBEEF, 4);
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	6a 04                	push   $0x4
+  8000a6:	68 ef be ad de       	push   $0xdeadbeef
+  8000ab:	e8 61 0a 00 00       	call   800b11 <sys_cputs>
+}
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000c0:	e8 e2 0a 00 00       	call   800ba7 <sys_getenvid>
+  8000c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ca:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8000d0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d5:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000da:	85 db                	test   %ebx,%ebx
+  8000dc:	7e 07                	jle    8000e5 <libmain+0x30>
+		binaryname = argv[0];
+  8000de:	8b 06                	mov    (%esi),%eax
+  8000e0:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000e5:	83 ec 08             	sub    $0x8,%esp
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	e8 a2 ff ff ff       	call   800091 <umain>
+
+	// exit gracefully
+	exit();
+  8000ef:	e8 0a 00 00 00       	call   8000fe <exit>
+}
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800104:	e8 52 11 00 00       	call   80125b <close_all>
+	sys_env_destroy(0);
+  800109:	83 ec 0c             	sub    $0xc,%esp
+  80010c:	6a 00                	push   $0x0
+  80010e:	e8 4b 0a 00 00       	call   800b5e <sys_env_destroy>
+}
+  800113:	83 c4 10             	add    $0x10,%esp
+  800116:	c9                   	leave
+  800117:	c3                   	ret
+
+00800118 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800118:	55                   	push   %ebp
+  800119:	89 e5                	mov    %esp,%ebp
+  80011b:	56                   	push   %esi
+  80011c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80011d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800120:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800126:	e8 7c 0a 00 00       	call   800ba7 <sys_getenvid>
+  80012b:	83 ec 0c             	sub    $0xc,%esp
+  80012e:	ff 75 0c             	push   0xc(%ebp)
+  800131:	ff 75 08             	push   0x8(%ebp)
+  800134:	56                   	push   %esi
+  800135:	50                   	push   %eax
+  800136:	68 38 38 80 00       	push   $0x803838
+  80013b:	e8 b3 00 00 00       	call   8001f3 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800140:	83 c4 18             	add    $0x18,%esp
+  800143:	53                   	push   %ebx
+  800144:	ff 75 10             	push   0x10(%ebp)
+  800147:	e8 56 00 00 00       	call   8001a2 <vcprintf>
+	cprintf("\n");
+  80014c:	c7 04 24 8e 3d 80 00 	movl   $0x803d8e,(%esp)
+  800153:	e8 9b 00 00 00       	call   8001f3 <cprintf>
+  800158:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80015b:	cc                   	int3
+	while (1)
+  80015c:	eb fd                	jmp    80015b <_panic+0x43>
+
+0080015e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80015e:	55                   	push   %ebp
+  80015f:	89 e5                	mov    %esp,%ebp
+  800161:	53                   	push   %ebx
+  800162:	83 ec 04             	sub    $0x4,%esp
+  800165:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800168:	8b 13                	mov    (%ebx),%edx
+  80016a:	8d 42 01             	lea    0x1(%edx),%eax
+  80016d:	89 03                	mov    %eax,(%ebx)
+  80016f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800172:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800176:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80017b:	74 09                	je     800186 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80017d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800184:	c9                   	leave
+  800185:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800186:	83 ec 08             	sub    $0x8,%esp
+  800189:	68 ff 00 00 00       	push   $0xff
+  80018e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800191:	50                   	push   %eax
+  800192:	e8 7a 09 00 00       	call   800b11 <sys_cputs>
+		b->idx = 0;
+  800197:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	eb db                	jmp    80017d <putch+0x1f>
+
+008001a2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001a2:	55                   	push   %ebp
+  8001a3:	89 e5                	mov    %esp,%ebp
+  8001a5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ab:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001b2:	00 00 00 
+	b.cnt = 0;
+  8001b5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001bc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001bf:	ff 75 0c             	push   0xc(%ebp)
+  8001c2:	ff 75 08             	push   0x8(%ebp)
+  8001c5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001cb:	50                   	push   %eax
+  8001cc:	68 5e 01 80 00       	push   $0x80015e
+  8001d1:	e8 14 01 00 00       	call   8002ea <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001d6:	83 c4 08             	add    $0x8,%esp
+  8001d9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001df:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001e5:	50                   	push   %eax
+  8001e6:	e8 26 09 00 00       	call   800b11 <sys_cputs>
+
+	return b.cnt;
+}
+  8001eb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f1:	c9                   	leave
+  8001f2:	c3                   	ret
+
+008001f3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001f3:	55                   	push   %ebp
+  8001f4:	89 e5                	mov    %esp,%ebp
+  8001f6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001f9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001fc:	50                   	push   %eax
+  8001fd:	ff 75 08             	push   0x8(%ebp)
+  800200:	e8 9d ff ff ff       	call   8001a2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800205:	c9                   	leave
+  800206:	c3                   	ret
+
+00800207 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800207:	55                   	push   %ebp
+  800208:	89 e5                	mov    %esp,%ebp
+  80020a:	57                   	push   %edi
+  80020b:	56                   	push   %esi
+  80020c:	53                   	push   %ebx
+  80020d:	83 ec 1c             	sub    $0x1c,%esp
+  800210:	89 c7                	mov    %eax,%edi
+  800212:	89 d6                	mov    %edx,%esi
+  800214:	8b 45 08             	mov    0x8(%ebp),%eax
+  800217:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80021a:	89 d1                	mov    %edx,%ecx
+  80021c:	89 c2                	mov    %eax,%edx
+  80021e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800221:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800224:	8b 45 10             	mov    0x10(%ebp),%eax
+  800227:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80022a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80022d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800234:	39 c2                	cmp    %eax,%edx
+  800236:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800239:	72 3e                	jb     800279 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	ff 75 18             	push   0x18(%ebp)
+  800241:	83 eb 01             	sub    $0x1,%ebx
+  800244:	53                   	push   %ebx
+  800245:	50                   	push   %eax
+  800246:	83 ec 08             	sub    $0x8,%esp
+  800249:	ff 75 e4             	push   -0x1c(%ebp)
+  80024c:	ff 75 e0             	push   -0x20(%ebp)
+  80024f:	ff 75 dc             	push   -0x24(%ebp)
+  800252:	ff 75 d8             	push   -0x28(%ebp)
+  800255:	e8 f1 33 00 00       	call   80364b <__udivdi3>
+  80025a:	83 c4 18             	add    $0x18,%esp
+  80025d:	52                   	push   %edx
+  80025e:	50                   	push   %eax
+  80025f:	89 f2                	mov    %esi,%edx
+  800261:	89 f8                	mov    %edi,%eax
+  800263:	e8 9f ff ff ff       	call   800207 <printnum>
+  800268:	83 c4 20             	add    $0x20,%esp
+  80026b:	eb 13                	jmp    800280 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80026d:	83 ec 08             	sub    $0x8,%esp
+  800270:	56                   	push   %esi
+  800271:	ff 75 18             	push   0x18(%ebp)
+  800274:	ff d7                	call   *%edi
+  800276:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800279:	83 eb 01             	sub    $0x1,%ebx
+  80027c:	85 db                	test   %ebx,%ebx
+  80027e:	7f ed                	jg     80026d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800280:	83 ec 08             	sub    $0x8,%esp
+  800283:	56                   	push   %esi
+  800284:	83 ec 04             	sub    $0x4,%esp
+  800287:	ff 75 e4             	push   -0x1c(%ebp)
+  80028a:	ff 75 e0             	push   -0x20(%ebp)
+  80028d:	ff 75 dc             	push   -0x24(%ebp)
+  800290:	ff 75 d8             	push   -0x28(%ebp)
+  800293:	e8 d1 33 00 00       	call   803669 <__umoddi3>
+  800298:	83 c4 14             	add    $0x14,%esp
+  80029b:	0f be 80 5b 38 80 00 	movsbl 0x80385b(%eax),%eax
+  8002a2:	50                   	push   %eax
+  8002a3:	ff d7                	call   *%edi
+}
+  8002a5:	83 c4 10             	add    $0x10,%esp
+  8002a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ab:	5b                   	pop    %ebx
+  8002ac:	5e                   	pop    %esi
+  8002ad:	5f                   	pop    %edi
+  8002ae:	5d                   	pop    %ebp
+  8002af:	c3                   	ret
+
+008002b0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002b0:	55                   	push   %ebp
+  8002b1:	89 e5                	mov    %esp,%ebp
+  8002b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002b6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002ba:	8b 10                	mov    (%eax),%edx
+  8002bc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002bf:	73 0a                	jae    8002cb <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002c1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002c4:	89 08                	mov    %ecx,(%eax)
+  8002c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002c9:	88 02                	mov    %al,(%edx)
+}
+  8002cb:	5d                   	pop    %ebp
+  8002cc:	c3                   	ret
+
+008002cd <printfmt>:
+{
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002d3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002d6:	50                   	push   %eax
+  8002d7:	ff 75 10             	push   0x10(%ebp)
+  8002da:	ff 75 0c             	push   0xc(%ebp)
+  8002dd:	ff 75 08             	push   0x8(%ebp)
+  8002e0:	e8 05 00 00 00       	call   8002ea <vprintfmt>
+}
+  8002e5:	83 c4 10             	add    $0x10,%esp
+  8002e8:	c9                   	leave
+  8002e9:	c3                   	ret
+
+008002ea <vprintfmt>:
+{
+  8002ea:	55                   	push   %ebp
+  8002eb:	89 e5                	mov    %esp,%ebp
+  8002ed:	57                   	push   %edi
+  8002ee:	56                   	push   %esi
+  8002ef:	53                   	push   %ebx
+  8002f0:	83 ec 2c             	sub    $0x2c,%esp
+  8002f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002f9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002fc:	eb 0a                	jmp    800308 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002fe:	83 ec 08             	sub    $0x8,%esp
+  800301:	53                   	push   %ebx
+  800302:	50                   	push   %eax
+  800303:	ff d6                	call   *%esi
+  800305:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800308:	83 c7 01             	add    $0x1,%edi
+  80030b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80030f:	83 f8 25             	cmp    $0x25,%eax
+  800312:	74 0c                	je     800320 <vprintfmt+0x36>
+			if (ch == '\0')
+  800314:	85 c0                	test   %eax,%eax
+  800316:	75 e6                	jne    8002fe <vprintfmt+0x14>
+}
+  800318:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031b:	5b                   	pop    %ebx
+  80031c:	5e                   	pop    %esi
+  80031d:	5f                   	pop    %edi
+  80031e:	5d                   	pop    %ebp
+  80031f:	c3                   	ret
+		padc = ' ';
+  800320:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800324:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80032b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800332:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800339:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80033e:	8d 47 01             	lea    0x1(%edi),%eax
+  800341:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800344:	0f b6 17             	movzbl (%edi),%edx
+  800347:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80034a:	3c 55                	cmp    $0x55,%al
+  80034c:	0f 87 cf 03 00 00    	ja     800721 <vprintfmt+0x437>
+  800352:	0f b6 c0             	movzbl %al,%eax
+  800355:	ff 24 85 c0 39 80 00 	jmp    *0x8039c0(,%eax,4)
+  80035c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80035f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800363:	eb d9                	jmp    80033e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800365:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800368:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80036c:	eb d0                	jmp    80033e <vprintfmt+0x54>
+  80036e:	0f b6 d2             	movzbl %dl,%edx
+  800371:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800374:	b8 00 00 00 00       	mov    $0x0,%eax
+  800379:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80037c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80037f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800383:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800386:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800389:	83 f9 09             	cmp    $0x9,%ecx
+  80038c:	77 55                	ja     8003e3 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80038e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800391:	eb e9                	jmp    80037c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800393:	8b 45 14             	mov    0x14(%ebp),%eax
+  800396:	8b 00                	mov    (%eax),%eax
+  800398:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80039b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039e:	8d 40 04             	lea    0x4(%eax),%eax
+  8003a1:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003a7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ab:	79 91                	jns    80033e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003ad:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003b0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003ba:	eb 82                	jmp    80033e <vprintfmt+0x54>
+			if (width < 0)
+  8003bc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003bf:	85 d2                	test   %edx,%edx
+  8003c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c6:	0f 49 c2             	cmovns %edx,%eax
+  8003c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003cf:	e9 6a ff ff ff       	jmp    80033e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003d7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003de:	e9 5b ff ff ff       	jmp    80033e <vprintfmt+0x54>
+  8003e3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003e6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003e9:	eb bc                	jmp    8003a7 <vprintfmt+0xbd>
+			lflag++;
+  8003eb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f1:	e9 48 ff ff ff       	jmp    80033e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f9:	8d 78 04             	lea    0x4(%eax),%edi
+  8003fc:	83 ec 08             	sub    $0x8,%esp
+  8003ff:	53                   	push   %ebx
+  800400:	ff 30                	push   (%eax)
+  800402:	ff d6                	call   *%esi
+			break;
+  800404:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800407:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80040a:	e9 b1 02 00 00       	jmp    8006c0 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80040f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800412:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800415:	8b 10                	mov    (%eax),%edx
+  800417:	89 d0                	mov    %edx,%eax
+  800419:	f7 d8                	neg    %eax
+  80041b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80041e:	83 f8 11             	cmp    $0x11,%eax
+  800421:	7f 23                	jg     800446 <vprintfmt+0x15c>
+  800423:	8b 14 85 20 3b 80 00 	mov    0x803b20(,%eax,4),%edx
+  80042a:	85 d2                	test   %edx,%edx
+  80042c:	74 18                	je     800446 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80042e:	52                   	push   %edx
+  80042f:	68 3e 3c 80 00       	push   $0x803c3e
+  800434:	53                   	push   %ebx
+  800435:	56                   	push   %esi
+  800436:	e8 92 fe ff ff       	call   8002cd <printfmt>
+  80043b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80043e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800441:	e9 7a 02 00 00       	jmp    8006c0 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800446:	50                   	push   %eax
+  800447:	68 73 38 80 00       	push   $0x803873
+  80044c:	53                   	push   %ebx
+  80044d:	56                   	push   %esi
+  80044e:	e8 7a fe ff ff       	call   8002cd <printfmt>
+  800453:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800456:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800459:	e9 62 02 00 00       	jmp    8006c0 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80045e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800461:	83 c0 04             	add    $0x4,%eax
+  800464:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800467:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80046c:	85 c9                	test   %ecx,%ecx
+  80046e:	b8 6c 38 80 00       	mov    $0x80386c,%eax
+  800473:	0f 45 c1             	cmovne %ecx,%eax
+  800476:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800479:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80047d:	7e 06                	jle    800485 <vprintfmt+0x19b>
+  80047f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800483:	75 0b                	jne    800490 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800485:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800488:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80048b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80048e:	eb 5c                	jmp    8004ec <vprintfmt+0x202>
+  800490:	83 ec 08             	sub    $0x8,%esp
+  800493:	ff 75 d0             	push   -0x30(%ebp)
+  800496:	ff 75 cc             	push   -0x34(%ebp)
+  800499:	e8 20 03 00 00       	call   8007be <strnlen>
+  80049e:	89 c2                	mov    %eax,%edx
+  8004a0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004a3:	29 d0                	sub    %edx,%eax
+  8004a5:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004a8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004af:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004b2:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004b4:	eb 0e                	jmp    8004c4 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004b6:	83 ec 08             	sub    $0x8,%esp
+  8004b9:	53                   	push   %ebx
+  8004ba:	57                   	push   %edi
+  8004bb:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004be:	83 ee 01             	sub    $0x1,%esi
+  8004c1:	83 c4 10             	add    $0x10,%esp
+  8004c4:	85 f6                	test   %esi,%esi
+  8004c6:	7f ee                	jg     8004b6 <vprintfmt+0x1cc>
+  8004c8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ce:	85 c0                	test   %eax,%eax
+  8004d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d5:	0f 49 d0             	cmovns %eax,%edx
+  8004d8:	29 d0                	sub    %edx,%eax
+  8004da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004dd:	eb a6                	jmp    800485 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004df:	83 ec 08             	sub    $0x8,%esp
+  8004e2:	53                   	push   %ebx
+  8004e3:	52                   	push   %edx
+  8004e4:	ff 55 08             	call   *0x8(%ebp)
+  8004e7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ea:	89 f1                	mov    %esi,%ecx
+  8004ec:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004ef:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004f3:	0f be d0             	movsbl %al,%edx
+  8004f6:	85 d2                	test   %edx,%edx
+  8004f8:	74 28                	je     800522 <vprintfmt+0x238>
+  8004fa:	85 ff                	test   %edi,%edi
+  8004fc:	78 05                	js     800503 <vprintfmt+0x219>
+  8004fe:	83 ef 01             	sub    $0x1,%edi
+  800501:	78 30                	js     800533 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800503:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800507:	74 d6                	je     8004df <vprintfmt+0x1f5>
+  800509:	0f be c0             	movsbl %al,%eax
+  80050c:	83 e8 20             	sub    $0x20,%eax
+  80050f:	83 f8 5e             	cmp    $0x5e,%eax
+  800512:	76 cb                	jbe    8004df <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800514:	83 ec 08             	sub    $0x8,%esp
+  800517:	53                   	push   %ebx
+  800518:	6a 3f                	push   $0x3f
+  80051a:	ff 55 08             	call   *0x8(%ebp)
+  80051d:	83 c4 10             	add    $0x10,%esp
+  800520:	eb c8                	jmp    8004ea <vprintfmt+0x200>
+  800522:	8b 75 08             	mov    0x8(%ebp),%esi
+  800525:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800528:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80052b:	01 d0                	add    %edx,%eax
+  80052d:	29 c8                	sub    %ecx,%eax
+  80052f:	89 c7                	mov    %eax,%edi
+  800531:	eb 13                	jmp    800546 <vprintfmt+0x25c>
+  800533:	8b 75 08             	mov    0x8(%ebp),%esi
+  800536:	eb ed                	jmp    800525 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800538:	83 ec 08             	sub    $0x8,%esp
+  80053b:	53                   	push   %ebx
+  80053c:	6a 20                	push   $0x20
+  80053e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800540:	83 ef 01             	sub    $0x1,%edi
+  800543:	83 c4 10             	add    $0x10,%esp
+  800546:	85 ff                	test   %edi,%edi
+  800548:	7f ee                	jg     800538 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80054a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80054d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800550:	e9 6b 01 00 00       	jmp    8006c0 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800555:	83 f9 01             	cmp    $0x1,%ecx
+  800558:	7f 1f                	jg     800579 <vprintfmt+0x28f>
+	else if (lflag)
+  80055a:	85 c9                	test   %ecx,%ecx
+  80055c:	74 67                	je     8005c5 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80055e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800561:	8b 00                	mov    (%eax),%eax
+  800563:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800566:	89 c1                	mov    %eax,%ecx
+  800568:	c1 f9 1f             	sar    $0x1f,%ecx
+  80056b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80056e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800571:	8d 40 04             	lea    0x4(%eax),%eax
+  800574:	89 45 14             	mov    %eax,0x14(%ebp)
+  800577:	eb 17                	jmp    800590 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800579:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057c:	8b 50 04             	mov    0x4(%eax),%edx
+  80057f:	8b 00                	mov    (%eax),%eax
+  800581:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800584:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800587:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058a:	8d 40 08             	lea    0x8(%eax),%eax
+  80058d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800590:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800593:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800596:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80059b:	85 c9                	test   %ecx,%ecx
+  80059d:	0f 89 03 01 00 00    	jns    8006a6 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005a3:	83 ec 08             	sub    $0x8,%esp
+  8005a6:	53                   	push   %ebx
+  8005a7:	6a 2d                	push   $0x2d
+  8005a9:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005ab:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ae:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005b1:	f7 da                	neg    %edx
+  8005b3:	83 d1 00             	adc    $0x0,%ecx
+  8005b6:	f7 d9                	neg    %ecx
+  8005b8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005bb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005c0:	e9 e1 00 00 00       	jmp    8006a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c8:	8b 00                	mov    (%eax),%eax
+  8005ca:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005cd:	89 c1                	mov    %eax,%ecx
+  8005cf:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005d2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005db:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005de:	eb b0                	jmp    800590 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005e0:	83 f9 01             	cmp    $0x1,%ecx
+  8005e3:	7f 1e                	jg     800603 <vprintfmt+0x319>
+	else if (lflag)
+  8005e5:	85 c9                	test   %ecx,%ecx
+  8005e7:	74 32                	je     80061b <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ec:	8b 10                	mov    (%eax),%edx
+  8005ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005fe:	e9 a3 00 00 00       	jmp    8006a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800603:	8b 45 14             	mov    0x14(%ebp),%eax
+  800606:	8b 10                	mov    (%eax),%edx
+  800608:	8b 48 04             	mov    0x4(%eax),%ecx
+  80060b:	8d 40 08             	lea    0x8(%eax),%eax
+  80060e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800611:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800616:	e9 8b 00 00 00       	jmp    8006a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80061b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061e:	8b 10                	mov    (%eax),%edx
+  800620:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800625:	8d 40 04             	lea    0x4(%eax),%eax
+  800628:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80062b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800630:	eb 74                	jmp    8006a6 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800632:	83 f9 01             	cmp    $0x1,%ecx
+  800635:	7f 1b                	jg     800652 <vprintfmt+0x368>
+	else if (lflag)
+  800637:	85 c9                	test   %ecx,%ecx
+  800639:	74 2c                	je     800667 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80063b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063e:	8b 10                	mov    (%eax),%edx
+  800640:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800645:	8d 40 04             	lea    0x4(%eax),%eax
+  800648:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80064b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800650:	eb 54                	jmp    8006a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800652:	8b 45 14             	mov    0x14(%ebp),%eax
+  800655:	8b 10                	mov    (%eax),%edx
+  800657:	8b 48 04             	mov    0x4(%eax),%ecx
+  80065a:	8d 40 08             	lea    0x8(%eax),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800660:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800665:	eb 3f                	jmp    8006a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800667:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066a:	8b 10                	mov    (%eax),%edx
+  80066c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800671:	8d 40 04             	lea    0x4(%eax),%eax
+  800674:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800677:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80067c:	eb 28                	jmp    8006a6 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80067e:	83 ec 08             	sub    $0x8,%esp
+  800681:	53                   	push   %ebx
+  800682:	6a 30                	push   $0x30
+  800684:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800686:	83 c4 08             	add    $0x8,%esp
+  800689:	53                   	push   %ebx
+  80068a:	6a 78                	push   $0x78
+  80068c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	8b 10                	mov    (%eax),%edx
+  800693:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800698:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80069b:	8d 40 04             	lea    0x4(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a1:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006a6:	83 ec 0c             	sub    $0xc,%esp
+  8006a9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006ad:	50                   	push   %eax
+  8006ae:	ff 75 e0             	push   -0x20(%ebp)
+  8006b1:	57                   	push   %edi
+  8006b2:	51                   	push   %ecx
+  8006b3:	52                   	push   %edx
+  8006b4:	89 da                	mov    %ebx,%edx
+  8006b6:	89 f0                	mov    %esi,%eax
+  8006b8:	e8 4a fb ff ff       	call   800207 <printnum>
+			break;
+  8006bd:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006c3:	e9 40 fc ff ff       	jmp    800308 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006c8:	83 f9 01             	cmp    $0x1,%ecx
+  8006cb:	7f 1b                	jg     8006e8 <vprintfmt+0x3fe>
+	else if (lflag)
+  8006cd:	85 c9                	test   %ecx,%ecx
+  8006cf:	74 2c                	je     8006fd <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	8b 10                	mov    (%eax),%edx
+  8006d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006db:	8d 40 04             	lea    0x4(%eax),%eax
+  8006de:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006e6:	eb be                	jmp    8006a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006eb:	8b 10                	mov    (%eax),%edx
+  8006ed:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006fb:	eb a9                	jmp    8006a6 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800700:	8b 10                	mov    (%eax),%edx
+  800702:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800707:	8d 40 04             	lea    0x4(%eax),%eax
+  80070a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80070d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800712:	eb 92                	jmp    8006a6 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800714:	83 ec 08             	sub    $0x8,%esp
+  800717:	53                   	push   %ebx
+  800718:	6a 25                	push   $0x25
+  80071a:	ff d6                	call   *%esi
+			break;
+  80071c:	83 c4 10             	add    $0x10,%esp
+  80071f:	eb 9f                	jmp    8006c0 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800721:	83 ec 08             	sub    $0x8,%esp
+  800724:	53                   	push   %ebx
+  800725:	6a 25                	push   $0x25
+  800727:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800729:	83 c4 10             	add    $0x10,%esp
+  80072c:	89 f8                	mov    %edi,%eax
+  80072e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800732:	74 05                	je     800739 <vprintfmt+0x44f>
+  800734:	83 e8 01             	sub    $0x1,%eax
+  800737:	eb f5                	jmp    80072e <vprintfmt+0x444>
+  800739:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80073c:	eb 82                	jmp    8006c0 <vprintfmt+0x3d6>
+
+0080073e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80073e:	55                   	push   %ebp
+  80073f:	89 e5                	mov    %esp,%ebp
+  800741:	83 ec 18             	sub    $0x18,%esp
+  800744:	8b 45 08             	mov    0x8(%ebp),%eax
+  800747:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80074a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80074d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800751:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800754:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80075b:	85 c0                	test   %eax,%eax
+  80075d:	74 26                	je     800785 <vsnprintf+0x47>
+  80075f:	85 d2                	test   %edx,%edx
+  800761:	7e 22                	jle    800785 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800763:	ff 75 14             	push   0x14(%ebp)
+  800766:	ff 75 10             	push   0x10(%ebp)
+  800769:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80076c:	50                   	push   %eax
+  80076d:	68 b0 02 80 00       	push   $0x8002b0
+  800772:	e8 73 fb ff ff       	call   8002ea <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800777:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80077a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80077d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800780:	83 c4 10             	add    $0x10,%esp
+}
+  800783:	c9                   	leave
+  800784:	c3                   	ret
+		return -E_INVAL;
+  800785:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80078a:	eb f7                	jmp    800783 <vsnprintf+0x45>
+
+0080078c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80078c:	55                   	push   %ebp
+  80078d:	89 e5                	mov    %esp,%ebp
+  80078f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800792:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800795:	50                   	push   %eax
+  800796:	ff 75 10             	push   0x10(%ebp)
+  800799:	ff 75 0c             	push   0xc(%ebp)
+  80079c:	ff 75 08             	push   0x8(%ebp)
+  80079f:	e8 9a ff ff ff       	call   80073e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007a4:	c9                   	leave
+  8007a5:	c3                   	ret
+
+008007a6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007a6:	55                   	push   %ebp
+  8007a7:	89 e5                	mov    %esp,%ebp
+  8007a9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b1:	eb 03                	jmp    8007b6 <strlen+0x10>
+		n++;
+  8007b3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007b6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007ba:	75 f7                	jne    8007b3 <strlen+0xd>
+	return n;
+}
+  8007bc:	5d                   	pop    %ebp
+  8007bd:	c3                   	ret
+
+008007be <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007be:	55                   	push   %ebp
+  8007bf:	89 e5                	mov    %esp,%ebp
+  8007c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007cc:	eb 03                	jmp    8007d1 <strnlen+0x13>
+		n++;
+  8007ce:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007d1:	39 d0                	cmp    %edx,%eax
+  8007d3:	74 08                	je     8007dd <strnlen+0x1f>
+  8007d5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007d9:	75 f3                	jne    8007ce <strnlen+0x10>
+  8007db:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007dd:	89 d0                	mov    %edx,%eax
+  8007df:	5d                   	pop    %ebp
+  8007e0:	c3                   	ret
+
+008007e1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007e1:	55                   	push   %ebp
+  8007e2:	89 e5                	mov    %esp,%ebp
+  8007e4:	53                   	push   %ebx
+  8007e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007e8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007f7:	83 c0 01             	add    $0x1,%eax
+  8007fa:	84 d2                	test   %dl,%dl
+  8007fc:	75 f2                	jne    8007f0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007fe:	89 c8                	mov    %ecx,%eax
+  800800:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800803:	c9                   	leave
+  800804:	c3                   	ret
+
+00800805 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800805:	55                   	push   %ebp
+  800806:	89 e5                	mov    %esp,%ebp
+  800808:	53                   	push   %ebx
+  800809:	83 ec 10             	sub    $0x10,%esp
+  80080c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80080f:	53                   	push   %ebx
+  800810:	e8 91 ff ff ff       	call   8007a6 <strlen>
+  800815:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800818:	ff 75 0c             	push   0xc(%ebp)
+  80081b:	01 d8                	add    %ebx,%eax
+  80081d:	50                   	push   %eax
+  80081e:	e8 be ff ff ff       	call   8007e1 <strcpy>
+	return dst;
+}
+  800823:	89 d8                	mov    %ebx,%eax
+  800825:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800828:	c9                   	leave
+  800829:	c3                   	ret
+
+0080082a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80082a:	55                   	push   %ebp
+  80082b:	89 e5                	mov    %esp,%ebp
+  80082d:	56                   	push   %esi
+  80082e:	53                   	push   %ebx
+  80082f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800832:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800835:	89 f3                	mov    %esi,%ebx
+  800837:	03 5d 10             	add    0x10(%ebp),%ebx
+  80083a:	89 f0                	mov    %esi,%eax
+  80083c:	eb 0f                	jmp    80084d <strncpy+0x23>
+		*dst++ = *src;
+  80083e:	83 c0 01             	add    $0x1,%eax
+  800841:	0f b6 0a             	movzbl (%edx),%ecx
+  800844:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800847:	80 f9 01             	cmp    $0x1,%cl
+  80084a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80084d:	39 d8                	cmp    %ebx,%eax
+  80084f:	75 ed                	jne    80083e <strncpy+0x14>
+	}
+	return ret;
+}
+  800851:	89 f0                	mov    %esi,%eax
+  800853:	5b                   	pop    %ebx
+  800854:	5e                   	pop    %esi
+  800855:	5d                   	pop    %ebp
+  800856:	c3                   	ret
+
+00800857 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800857:	55                   	push   %ebp
+  800858:	89 e5                	mov    %esp,%ebp
+  80085a:	56                   	push   %esi
+  80085b:	53                   	push   %ebx
+  80085c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80085f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800862:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800865:	89 f0                	mov    %esi,%eax
+  800867:	85 d2                	test   %edx,%edx
+  800869:	74 21                	je     80088c <strlcpy+0x35>
+  80086b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80086f:	89 f2                	mov    %esi,%edx
+  800871:	eb 09                	jmp    80087c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800873:	83 c1 01             	add    $0x1,%ecx
+  800876:	83 c2 01             	add    $0x1,%edx
+  800879:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80087c:	39 c2                	cmp    %eax,%edx
+  80087e:	74 09                	je     800889 <strlcpy+0x32>
+  800880:	0f b6 19             	movzbl (%ecx),%ebx
+  800883:	84 db                	test   %bl,%bl
+  800885:	75 ec                	jne    800873 <strlcpy+0x1c>
+  800887:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800889:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80088c:	29 f0                	sub    %esi,%eax
+}
+  80088e:	5b                   	pop    %ebx
+  80088f:	5e                   	pop    %esi
+  800890:	5d                   	pop    %ebp
+  800891:	c3                   	ret
+
+00800892 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800892:	55                   	push   %ebp
+  800893:	89 e5                	mov    %esp,%ebp
+  800895:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800898:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80089b:	eb 06                	jmp    8008a3 <strcmp+0x11>
+		p++, q++;
+  80089d:	83 c1 01             	add    $0x1,%ecx
+  8008a0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008a3:	0f b6 01             	movzbl (%ecx),%eax
+  8008a6:	84 c0                	test   %al,%al
+  8008a8:	74 04                	je     8008ae <strcmp+0x1c>
+  8008aa:	3a 02                	cmp    (%edx),%al
+  8008ac:	74 ef                	je     80089d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ae:	0f b6 c0             	movzbl %al,%eax
+  8008b1:	0f b6 12             	movzbl (%edx),%edx
+  8008b4:	29 d0                	sub    %edx,%eax
+}
+  8008b6:	5d                   	pop    %ebp
+  8008b7:	c3                   	ret
+
+008008b8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008b8:	55                   	push   %ebp
+  8008b9:	89 e5                	mov    %esp,%ebp
+  8008bb:	53                   	push   %ebx
+  8008bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008c2:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008c5:	eb 09                	jmp    8008d0 <strncmp+0x18>
+		n--, p++, q++;
+  8008c7:	83 ea 01             	sub    $0x1,%edx
+  8008ca:	83 c0 01             	add    $0x1,%eax
+  8008cd:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008d0:	85 d2                	test   %edx,%edx
+  8008d2:	74 18                	je     8008ec <strncmp+0x34>
+  8008d4:	0f b6 18             	movzbl (%eax),%ebx
+  8008d7:	84 db                	test   %bl,%bl
+  8008d9:	74 04                	je     8008df <strncmp+0x27>
+  8008db:	3a 19                	cmp    (%ecx),%bl
+  8008dd:	74 e8                	je     8008c7 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008df:	0f b6 00             	movzbl (%eax),%eax
+  8008e2:	0f b6 11             	movzbl (%ecx),%edx
+  8008e5:	29 d0                	sub    %edx,%eax
+}
+  8008e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ea:	c9                   	leave
+  8008eb:	c3                   	ret
+		return 0;
+  8008ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f1:	eb f4                	jmp    8008e7 <strncmp+0x2f>
+
+008008f3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008f3:	55                   	push   %ebp
+  8008f4:	89 e5                	mov    %esp,%ebp
+  8008f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008fd:	eb 03                	jmp    800902 <strchr+0xf>
+  8008ff:	83 c0 01             	add    $0x1,%eax
+  800902:	0f b6 10             	movzbl (%eax),%edx
+  800905:	84 d2                	test   %dl,%dl
+  800907:	74 06                	je     80090f <strchr+0x1c>
+		if (*s == c)
+  800909:	38 ca                	cmp    %cl,%dl
+  80090b:	75 f2                	jne    8008ff <strchr+0xc>
+  80090d:	eb 05                	jmp    800914 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80090f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800914:	5d                   	pop    %ebp
+  800915:	c3                   	ret
+
+00800916 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800916:	55                   	push   %ebp
+  800917:	89 e5                	mov    %esp,%ebp
+  800919:	8b 45 08             	mov    0x8(%ebp),%eax
+  80091c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800920:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800923:	38 ca                	cmp    %cl,%dl
+  800925:	74 09                	je     800930 <strfind+0x1a>
+  800927:	84 d2                	test   %dl,%dl
+  800929:	74 05                	je     800930 <strfind+0x1a>
+	for (; *s; s++)
+  80092b:	83 c0 01             	add    $0x1,%eax
+  80092e:	eb f0                	jmp    800920 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800930:	5d                   	pop    %ebp
+  800931:	c3                   	ret
+
+00800932 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800932:	55                   	push   %ebp
+  800933:	89 e5                	mov    %esp,%ebp
+  800935:	57                   	push   %edi
+  800936:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800939:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80093c:	85 c9                	test   %ecx,%ecx
+  80093e:	74 20                	je     800960 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800940:	89 f8                	mov    %edi,%eax
+  800942:	09 c8                	or     %ecx,%eax
+  800944:	a8 03                	test   $0x3,%al
+  800946:	75 12                	jne    80095a <memset+0x28>
+		c &= 0xFF;
+  800948:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80094c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800952:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800955:	fc                   	cld
+  800956:	f3 ab                	rep stos %eax,%es:(%edi)
+  800958:	eb 06                	jmp    800960 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80095a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80095d:	fc                   	cld
+  80095e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800960:	89 f8                	mov    %edi,%eax
+  800962:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800965:	c9                   	leave
+  800966:	c3                   	ret
+
+00800967 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800967:	55                   	push   %ebp
+  800968:	89 e5                	mov    %esp,%ebp
+  80096a:	57                   	push   %edi
+  80096b:	56                   	push   %esi
+  80096c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800972:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800975:	39 c6                	cmp    %eax,%esi
+  800977:	73 32                	jae    8009ab <memmove+0x44>
+  800979:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80097c:	39 d0                	cmp    %edx,%eax
+  80097e:	73 2b                	jae    8009ab <memmove+0x44>
+		s += n;
+		d += n;
+  800980:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800983:	89 d6                	mov    %edx,%esi
+  800985:	09 fe                	or     %edi,%esi
+  800987:	09 ce                	or     %ecx,%esi
+  800989:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80098f:	75 0e                	jne    80099f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800991:	83 ef 04             	sub    $0x4,%edi
+  800994:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800997:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80099a:	fd                   	std
+  80099b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80099d:	eb 09                	jmp    8009a8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80099f:	83 ef 01             	sub    $0x1,%edi
+  8009a2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009a5:	fd                   	std
+  8009a6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009a8:	fc                   	cld
+  8009a9:	eb 1a                	jmp    8009c5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ab:	89 f2                	mov    %esi,%edx
+  8009ad:	09 c2                	or     %eax,%edx
+  8009af:	09 ca                	or     %ecx,%edx
+  8009b1:	f6 c2 03             	test   $0x3,%dl
+  8009b4:	75 0a                	jne    8009c0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009b6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009b9:	89 c7                	mov    %eax,%edi
+  8009bb:	fc                   	cld
+  8009bc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009be:	eb 05                	jmp    8009c5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009c0:	89 c7                	mov    %eax,%edi
+  8009c2:	fc                   	cld
+  8009c3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009c5:	5e                   	pop    %esi
+  8009c6:	5f                   	pop    %edi
+  8009c7:	5d                   	pop    %ebp
+  8009c8:	c3                   	ret
+
+008009c9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009c9:	55                   	push   %ebp
+  8009ca:	89 e5                	mov    %esp,%ebp
+  8009cc:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009cf:	ff 75 10             	push   0x10(%ebp)
+  8009d2:	ff 75 0c             	push   0xc(%ebp)
+  8009d5:	ff 75 08             	push   0x8(%ebp)
+  8009d8:	e8 8a ff ff ff       	call   800967 <memmove>
+}
+  8009dd:	c9                   	leave
+  8009de:	c3                   	ret
+
+008009df <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009df:	55                   	push   %ebp
+  8009e0:	89 e5                	mov    %esp,%ebp
+  8009e2:	56                   	push   %esi
+  8009e3:	53                   	push   %ebx
+  8009e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009ea:	89 c6                	mov    %eax,%esi
+  8009ec:	03 75 10             	add    0x10(%ebp),%esi
+  8009ef:	eb 06                	jmp    8009f7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009f1:	83 c0 01             	add    $0x1,%eax
+  8009f4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009f7:	39 f0                	cmp    %esi,%eax
+  8009f9:	74 14                	je     800a0f <memcmp+0x30>
+		if (*s1 != *s2)
+  8009fb:	0f b6 08             	movzbl (%eax),%ecx
+  8009fe:	0f b6 1a             	movzbl (%edx),%ebx
+  800a01:	38 d9                	cmp    %bl,%cl
+  800a03:	74 ec                	je     8009f1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a05:	0f b6 c1             	movzbl %cl,%eax
+  800a08:	0f b6 db             	movzbl %bl,%ebx
+  800a0b:	29 d8                	sub    %ebx,%eax
+  800a0d:	eb 05                	jmp    800a14 <memcmp+0x35>
+	}
+
+	return 0;
+  800a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a14:	5b                   	pop    %ebx
+  800a15:	5e                   	pop    %esi
+  800a16:	5d                   	pop    %ebp
+  800a17:	c3                   	ret
+
+00800a18 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a18:	55                   	push   %ebp
+  800a19:	89 e5                	mov    %esp,%ebp
+  800a1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a21:	89 c2                	mov    %eax,%edx
+  800a23:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a26:	eb 03                	jmp    800a2b <memfind+0x13>
+  800a28:	83 c0 01             	add    $0x1,%eax
+  800a2b:	39 d0                	cmp    %edx,%eax
+  800a2d:	73 04                	jae    800a33 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a2f:	38 08                	cmp    %cl,(%eax)
+  800a31:	75 f5                	jne    800a28 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a33:	5d                   	pop    %ebp
+  800a34:	c3                   	ret
+
+00800a35 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a35:	55                   	push   %ebp
+  800a36:	89 e5                	mov    %esp,%ebp
+  800a38:	57                   	push   %edi
+  800a39:	56                   	push   %esi
+  800a3a:	53                   	push   %ebx
+  800a3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a41:	eb 03                	jmp    800a46 <strtol+0x11>
+		s++;
+  800a43:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a46:	0f b6 02             	movzbl (%edx),%eax
+  800a49:	3c 20                	cmp    $0x20,%al
+  800a4b:	74 f6                	je     800a43 <strtol+0xe>
+  800a4d:	3c 09                	cmp    $0x9,%al
+  800a4f:	74 f2                	je     800a43 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a51:	3c 2b                	cmp    $0x2b,%al
+  800a53:	74 2a                	je     800a7f <strtol+0x4a>
+	int neg = 0;
+  800a55:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a5a:	3c 2d                	cmp    $0x2d,%al
+  800a5c:	74 2b                	je     800a89 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a5e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a64:	75 0f                	jne    800a75 <strtol+0x40>
+  800a66:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a69:	74 28                	je     800a93 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a6b:	85 db                	test   %ebx,%ebx
+  800a6d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a72:	0f 44 d8             	cmove  %eax,%ebx
+  800a75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a7a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a7d:	eb 46                	jmp    800ac5 <strtol+0x90>
+		s++;
+  800a7f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a82:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a87:	eb d5                	jmp    800a5e <strtol+0x29>
+		s++, neg = 1;
+  800a89:	83 c2 01             	add    $0x1,%edx
+  800a8c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a91:	eb cb                	jmp    800a5e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a93:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a97:	74 0e                	je     800aa7 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a99:	85 db                	test   %ebx,%ebx
+  800a9b:	75 d8                	jne    800a75 <strtol+0x40>
+		s++, base = 8;
+  800a9d:	83 c2 01             	add    $0x1,%edx
+  800aa0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aa5:	eb ce                	jmp    800a75 <strtol+0x40>
+		s += 2, base = 16;
+  800aa7:	83 c2 02             	add    $0x2,%edx
+  800aaa:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800aaf:	eb c4                	jmp    800a75 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ab1:	0f be c0             	movsbl %al,%eax
+  800ab4:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ab7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800aba:	7d 3a                	jge    800af6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800abc:	83 c2 01             	add    $0x1,%edx
+  800abf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ac3:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ac5:	0f b6 02             	movzbl (%edx),%eax
+  800ac8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800acb:	89 f3                	mov    %esi,%ebx
+  800acd:	80 fb 09             	cmp    $0x9,%bl
+  800ad0:	76 df                	jbe    800ab1 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ad2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ad5:	89 f3                	mov    %esi,%ebx
+  800ad7:	80 fb 19             	cmp    $0x19,%bl
+  800ada:	77 08                	ja     800ae4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800adc:	0f be c0             	movsbl %al,%eax
+  800adf:	83 e8 57             	sub    $0x57,%eax
+  800ae2:	eb d3                	jmp    800ab7 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ae4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ae7:	89 f3                	mov    %esi,%ebx
+  800ae9:	80 fb 19             	cmp    $0x19,%bl
+  800aec:	77 08                	ja     800af6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800aee:	0f be c0             	movsbl %al,%eax
+  800af1:	83 e8 37             	sub    $0x37,%eax
+  800af4:	eb c1                	jmp    800ab7 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800af6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800afa:	74 05                	je     800b01 <strtol+0xcc>
+		*endptr = (char *) s;
+  800afc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aff:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b01:	89 c8                	mov    %ecx,%eax
+  800b03:	f7 d8                	neg    %eax
+  800b05:	85 ff                	test   %edi,%edi
+  800b07:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b0a:	89 c8                	mov    %ecx,%eax
+  800b0c:	5b                   	pop    %ebx
+  800b0d:	5e                   	pop    %esi
+  800b0e:	5f                   	pop    %edi
+  800b0f:	5d                   	pop    %ebp
+  800b10:	c3                   	ret
+
+00800b11 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b11:	55                   	push   %ebp
+  800b12:	89 e5                	mov    %esp,%ebp
+  800b14:	57                   	push   %edi
+  800b15:	56                   	push   %esi
+  800b16:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b22:	89 c3                	mov    %eax,%ebx
+  800b24:	89 c7                	mov    %eax,%edi
+  800b26:	55                   	push   %ebp
+  800b27:	89 e5                	mov    %esp,%ebp
+  800b29:	8d 35 31 0b 80 00    	lea    0x800b31,%esi
+  800b2f:	0f 34                	sysenter
+  800b31:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800b32:	5b                   	pop    %ebx
+  800b33:	5e                   	pop    %esi
+  800b34:	5f                   	pop    %edi
+  800b35:	5d                   	pop    %ebp
+  800b36:	c3                   	ret
+
+00800b37 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b37:	55                   	push   %ebp
+  800b38:	89 e5                	mov    %esp,%ebp
+  800b3a:	57                   	push   %edi
+  800b3b:	56                   	push   %esi
+  800b3c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b42:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b47:	89 d1                	mov    %edx,%ecx
+  800b49:	89 d3                	mov    %edx,%ebx
+  800b4b:	89 d7                	mov    %edx,%edi
+  800b4d:	55                   	push   %ebp
+  800b4e:	89 e5                	mov    %esp,%ebp
+  800b50:	8d 35 58 0b 80 00    	lea    0x800b58,%esi
+  800b56:	0f 34                	sysenter
+  800b58:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800b59:	5b                   	pop    %ebx
+  800b5a:	5e                   	pop    %esi
+  800b5b:	5f                   	pop    %edi
+  800b5c:	5d                   	pop    %ebp
+  800b5d:	c3                   	ret
+
+00800b5e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b5e:	55                   	push   %ebp
+  800b5f:	89 e5                	mov    %esp,%ebp
+  800b61:	57                   	push   %edi
+  800b62:	56                   	push   %esi
+  800b63:	53                   	push   %ebx
+  800b64:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b74:	89 cb                	mov    %ecx,%ebx
+  800b76:	89 cf                	mov    %ecx,%edi
+  800b78:	55                   	push   %ebp
+  800b79:	89 e5                	mov    %esp,%ebp
+  800b7b:	8d 35 83 0b 80 00    	lea    0x800b83,%esi
+  800b81:	0f 34                	sysenter
+  800b83:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b84:	85 c0                	test   %eax,%eax
+  800b86:	7f 08                	jg     800b90 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800b88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b8b:	5b                   	pop    %ebx
+  800b8c:	5e                   	pop    %esi
+  800b8d:	5f                   	pop    %edi
+  800b8e:	5d                   	pop    %ebp
+  800b8f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b90:	83 ec 0c             	sub    $0xc,%esp
+  800b93:	50                   	push   %eax
+  800b94:	6a 03                	push   $0x3
+  800b96:	68 87 3b 80 00       	push   $0x803b87
+  800b9b:	6a 3d                	push   $0x3d
+  800b9d:	68 a4 3b 80 00       	push   $0x803ba4
+  800ba2:	e8 71 f5 ff ff       	call   800118 <_panic>
+
+00800ba7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ba7:	55                   	push   %ebp
+  800ba8:	89 e5                	mov    %esp,%ebp
+  800baa:	57                   	push   %edi
+  800bab:	56                   	push   %esi
+  800bac:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800bad:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bb2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bb7:	89 d1                	mov    %edx,%ecx
+  800bb9:	89 d3                	mov    %edx,%ebx
+  800bbb:	89 d7                	mov    %edx,%edi
+  800bbd:	55                   	push   %ebp
+  800bbe:	89 e5                	mov    %esp,%ebp
+  800bc0:	8d 35 c8 0b 80 00    	lea    0x800bc8,%esi
+  800bc6:	0f 34                	sysenter
+  800bc8:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800bc9:	5b                   	pop    %ebx
+  800bca:	5e                   	pop    %esi
+  800bcb:	5f                   	pop    %edi
+  800bcc:	5d                   	pop    %ebp
+  800bcd:	c3                   	ret
+
+00800bce <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	57                   	push   %edi
+  800bd2:	56                   	push   %esi
+  800bd3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bde:	89 d1                	mov    %edx,%ecx
+  800be0:	89 d3                	mov    %edx,%ebx
+  800be2:	89 d7                	mov    %edx,%edi
+  800be4:	89 d6                	mov    %edx,%esi
+  800be6:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800be8:	5b                   	pop    %ebx
+  800be9:	5e                   	pop    %esi
+  800bea:	5f                   	pop    %edi
+  800beb:	5d                   	pop    %ebp
+  800bec:	c3                   	ret
+
+00800bed <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bed:	55                   	push   %ebp
+  800bee:	89 e5                	mov    %esp,%ebp
+  800bf0:	57                   	push   %edi
+  800bf1:	56                   	push   %esi
+  800bf2:	53                   	push   %ebx
+  800bf3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800bf6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bfc:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c01:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c06:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c09:	55                   	push   %ebp
+  800c0a:	89 e5                	mov    %esp,%ebp
+  800c0c:	8d 35 14 0c 80 00    	lea    0x800c14,%esi
+  800c12:	0f 34                	sysenter
+  800c14:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c15:	85 c0                	test   %eax,%eax
+  800c17:	7f 08                	jg     800c21 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800c19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c1c:	5b                   	pop    %ebx
+  800c1d:	5e                   	pop    %esi
+  800c1e:	5f                   	pop    %edi
+  800c1f:	5d                   	pop    %ebp
+  800c20:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c21:	83 ec 0c             	sub    $0xc,%esp
+  800c24:	50                   	push   %eax
+  800c25:	6a 04                	push   $0x4
+  800c27:	68 87 3b 80 00       	push   $0x803b87
+  800c2c:	6a 3d                	push   $0x3d
+  800c2e:	68 a4 3b 80 00       	push   $0x803ba4
+  800c33:	e8 e0 f4 ff ff       	call   800118 <_panic>
+
+00800c38 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c38:	55                   	push   %ebp
+  800c39:	89 e5                	mov    %esp,%ebp
+  800c3b:	57                   	push   %edi
+  800c3c:	56                   	push   %esi
+  800c3d:	53                   	push   %ebx
+  800c3e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c47:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c4f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c52:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c55:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c57:	85 c0                	test   %eax,%eax
+  800c59:	7f 08                	jg     800c63 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c5e:	5b                   	pop    %ebx
+  800c5f:	5e                   	pop    %esi
+  800c60:	5f                   	pop    %edi
+  800c61:	5d                   	pop    %ebp
+  800c62:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c63:	83 ec 0c             	sub    $0xc,%esp
+  800c66:	50                   	push   %eax
+  800c67:	6a 05                	push   $0x5
+  800c69:	68 87 3b 80 00       	push   $0x803b87
+  800c6e:	6a 23                	push   $0x23
+  800c70:	68 a4 3b 80 00       	push   $0x803ba4
+  800c75:	e8 9e f4 ff ff       	call   800118 <_panic>
+
+00800c7a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c7a:	55                   	push   %ebp
+  800c7b:	89 e5                	mov    %esp,%ebp
+  800c7d:	57                   	push   %edi
+  800c7e:	56                   	push   %esi
+  800c7f:	53                   	push   %ebx
+  800c80:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c93:	89 df                	mov    %ebx,%edi
+  800c95:	55                   	push   %ebp
+  800c96:	89 e5                	mov    %esp,%ebp
+  800c98:	8d 35 a0 0c 80 00    	lea    0x800ca0,%esi
+  800c9e:	0f 34                	sysenter
+  800ca0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ca1:	85 c0                	test   %eax,%eax
+  800ca3:	7f 08                	jg     800cad <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800ca5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca8:	5b                   	pop    %ebx
+  800ca9:	5e                   	pop    %esi
+  800caa:	5f                   	pop    %edi
+  800cab:	5d                   	pop    %ebp
+  800cac:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cad:	83 ec 0c             	sub    $0xc,%esp
+  800cb0:	50                   	push   %eax
+  800cb1:	6a 06                	push   $0x6
+  800cb3:	68 87 3b 80 00       	push   $0x803b87
+  800cb8:	6a 3d                	push   $0x3d
+  800cba:	68 a4 3b 80 00       	push   $0x803ba4
+  800cbf:	e8 54 f4 ff ff       	call   800118 <_panic>
+
+00800cc4 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800cc4:	55                   	push   %ebp
+  800cc5:	89 e5                	mov    %esp,%ebp
+  800cc7:	57                   	push   %edi
+  800cc8:	56                   	push   %esi
+  800cc9:	53                   	push   %ebx
+  800cca:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ccd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd8:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cdd:	89 df                	mov    %ebx,%edi
+  800cdf:	55                   	push   %ebp
+  800ce0:	89 e5                	mov    %esp,%ebp
+  800ce2:	8d 35 ea 0c 80 00    	lea    0x800cea,%esi
+  800ce8:	0f 34                	sysenter
+  800cea:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ceb:	85 c0                	test   %eax,%eax
+  800ced:	7f 08                	jg     800cf7 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800cef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf2:	5b                   	pop    %ebx
+  800cf3:	5e                   	pop    %esi
+  800cf4:	5f                   	pop    %edi
+  800cf5:	5d                   	pop    %ebp
+  800cf6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf7:	83 ec 0c             	sub    $0xc,%esp
+  800cfa:	50                   	push   %eax
+  800cfb:	6a 08                	push   $0x8
+  800cfd:	68 87 3b 80 00       	push   $0x803b87
+  800d02:	6a 3d                	push   $0x3d
+  800d04:	68 a4 3b 80 00       	push   $0x803ba4
+  800d09:	e8 0a f4 ff ff       	call   800118 <_panic>
+
+00800d0e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d0e:	55                   	push   %ebp
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	57                   	push   %edi
+  800d12:	56                   	push   %esi
+  800d13:	53                   	push   %ebx
+  800d14:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d22:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d27:	89 df                	mov    %ebx,%edi
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	8d 35 34 0d 80 00    	lea    0x800d34,%esi
+  800d32:	0f 34                	sysenter
+  800d34:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d35:	85 c0                	test   %eax,%eax
+  800d37:	7f 08                	jg     800d41 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800d39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3c:	5b                   	pop    %ebx
+  800d3d:	5e                   	pop    %esi
+  800d3e:	5f                   	pop    %edi
+  800d3f:	5d                   	pop    %ebp
+  800d40:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d41:	83 ec 0c             	sub    $0xc,%esp
+  800d44:	50                   	push   %eax
+  800d45:	6a 09                	push   $0x9
+  800d47:	68 87 3b 80 00       	push   $0x803b87
+  800d4c:	6a 3d                	push   $0x3d
+  800d4e:	68 a4 3b 80 00       	push   $0x803ba4
+  800d53:	e8 c0 f3 ff ff       	call   800118 <_panic>
+
+00800d58 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d58:	55                   	push   %ebp
+  800d59:	89 e5                	mov    %esp,%ebp
+  800d5b:	57                   	push   %edi
+  800d5c:	56                   	push   %esi
+  800d5d:	53                   	push   %ebx
+  800d5e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d71:	89 df                	mov    %ebx,%edi
+  800d73:	55                   	push   %ebp
+  800d74:	89 e5                	mov    %esp,%ebp
+  800d76:	8d 35 7e 0d 80 00    	lea    0x800d7e,%esi
+  800d7c:	0f 34                	sysenter
+  800d7e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d7f:	85 c0                	test   %eax,%eax
+  800d81:	7f 08                	jg     800d8b <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800d83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d86:	5b                   	pop    %ebx
+  800d87:	5e                   	pop    %esi
+  800d88:	5f                   	pop    %edi
+  800d89:	5d                   	pop    %ebp
+  800d8a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8b:	83 ec 0c             	sub    $0xc,%esp
+  800d8e:	50                   	push   %eax
+  800d8f:	6a 0a                	push   $0xa
+  800d91:	68 87 3b 80 00       	push   $0x803b87
+  800d96:	6a 3d                	push   $0x3d
+  800d98:	68 a4 3b 80 00       	push   $0x803ba4
+  800d9d:	e8 76 f3 ff ff       	call   800118 <_panic>
+
+00800da2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800da2:	55                   	push   %ebp
+  800da3:	89 e5                	mov    %esp,%ebp
+  800da5:	57                   	push   %edi
+  800da6:	56                   	push   %esi
+  800da7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800da8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dae:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800db3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db9:	55                   	push   %ebp
+  800dba:	89 e5                	mov    %esp,%ebp
+  800dbc:	8d 35 c4 0d 80 00    	lea    0x800dc4,%esi
+  800dc2:	0f 34                	sysenter
+  800dc4:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800dc5:	5b                   	pop    %ebx
+  800dc6:	5e                   	pop    %esi
+  800dc7:	5f                   	pop    %edi
+  800dc8:	5d                   	pop    %ebp
+  800dc9:	c3                   	ret
+
+00800dca <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	57                   	push   %edi
+  800dce:	56                   	push   %esi
+  800dcf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800dd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd6:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ddb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dde:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800de1:	55                   	push   %ebp
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	8d 35 ec 0d 80 00    	lea    0x800dec,%esi
+  800dea:	0f 34                	sysenter
+  800dec:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800ded:	5b                   	pop    %ebx
+  800dee:	5e                   	pop    %esi
+  800def:	5f                   	pop    %edi
+  800df0:	5d                   	pop    %ebp
+  800df1:	c3                   	ret
+
+00800df2 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	57                   	push   %edi
+  800df6:	56                   	push   %esi
+  800df7:	53                   	push   %ebx
+  800df8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dfb:	be 00 00 00 00       	mov    $0x0,%esi
+  800e00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e06:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e0b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e0e:	89 f7                	mov    %esi,%edi
+  800e10:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e12:	85 c0                	test   %eax,%eax
+  800e14:	7f 08                	jg     800e1e <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800e16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e19:	5b                   	pop    %ebx
+  800e1a:	5e                   	pop    %esi
+  800e1b:	5f                   	pop    %edi
+  800e1c:	5d                   	pop    %ebp
+  800e1d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e1e:	83 ec 0c             	sub    $0xc,%esp
+  800e21:	50                   	push   %eax
+  800e22:	6a 0d                	push   $0xd
+  800e24:	68 87 3b 80 00       	push   $0x803b87
+  800e29:	6a 23                	push   $0x23
+  800e2b:	68 a4 3b 80 00       	push   $0x803ba4
+  800e30:	e8 e3 f2 ff ff       	call   800118 <_panic>
+
+00800e35 <sys_ipc_recv>:
+{
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800e3b:	6a 00                	push   $0x0
+  800e3d:	6a 01                	push   $0x1
+  800e3f:	ff 75 08             	push   0x8(%ebp)
+  800e42:	e8 ab ff ff ff       	call   800df2 <sys_ipc_recvv>
+}
+  800e47:	c9                   	leave
+  800e48:	c3                   	ret
+
+00800e49 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800e49:	55                   	push   %ebp
+  800e4a:	89 e5                	mov    %esp,%ebp
+  800e4c:	57                   	push   %edi
+  800e4d:	56                   	push   %esi
+  800e4e:	53                   	push   %ebx
+  800e4f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e62:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e65:	89 de                	mov    %ebx,%esi
+  800e67:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e69:	85 c0                	test   %eax,%eax
+  800e6b:	7f 08                	jg     800e75 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800e6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e70:	5b                   	pop    %ebx
+  800e71:	5e                   	pop    %esi
+  800e72:	5f                   	pop    %edi
+  800e73:	5d                   	pop    %ebp
+  800e74:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e75:	83 ec 0c             	sub    $0xc,%esp
+  800e78:	50                   	push   %eax
+  800e79:	6a 0d                	push   $0xd
+  800e7b:	68 87 3b 80 00       	push   $0x803b87
+  800e80:	6a 23                	push   $0x23
+  800e82:	68 a4 3b 80 00       	push   $0x803ba4
+  800e87:	e8 8c f2 ff ff       	call   800118 <_panic>
+
+00800e8c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e8c:	55                   	push   %ebp
+  800e8d:	89 e5                	mov    %esp,%ebp
+  800e8f:	57                   	push   %edi
+  800e90:	56                   	push   %esi
+  800e91:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e92:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e97:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e9c:	89 d1                	mov    %edx,%ecx
+  800e9e:	89 d3                	mov    %edx,%ebx
+  800ea0:	89 d7                	mov    %edx,%edi
+  800ea2:	55                   	push   %ebp
+  800ea3:	89 e5                	mov    %esp,%ebp
+  800ea5:	8d 35 ad 0e 80 00    	lea    0x800ead,%esi
+  800eab:	0f 34                	sysenter
+  800ead:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800eae:	5b                   	pop    %ebx
+  800eaf:	5e                   	pop    %esi
+  800eb0:	5f                   	pop    %edi
+  800eb1:	5d                   	pop    %ebp
+  800eb2:	c3                   	ret
+
+00800eb3 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800eb3:	55                   	push   %ebp
+  800eb4:	89 e5                	mov    %esp,%ebp
+  800eb6:	57                   	push   %edi
+  800eb7:	56                   	push   %esi
+  800eb8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ec9:	89 df                	mov    %ebx,%edi
+  800ecb:	55                   	push   %ebp
+  800ecc:	89 e5                	mov    %esp,%ebp
+  800ece:	8d 35 d6 0e 80 00    	lea    0x800ed6,%esi
+  800ed4:	0f 34                	sysenter
+  800ed6:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800ed7:	5b                   	pop    %ebx
+  800ed8:	5e                   	pop    %esi
+  800ed9:	5f                   	pop    %edi
+  800eda:	5d                   	pop    %ebp
+  800edb:	c3                   	ret
+
+00800edc <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800edc:	55                   	push   %ebp
+  800edd:	89 e5                	mov    %esp,%ebp
+  800edf:	57                   	push   %edi
+  800ee0:	56                   	push   %esi
+  800ee1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ee2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ee7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eea:	b8 10 00 00 00       	mov    $0x10,%eax
+  800eef:	89 cb                	mov    %ecx,%ebx
+  800ef1:	89 cf                	mov    %ecx,%edi
+  800ef3:	55                   	push   %ebp
+  800ef4:	89 e5                	mov    %esp,%ebp
+  800ef6:	8d 35 fe 0e 80 00    	lea    0x800efe,%esi
+  800efc:	0f 34                	sysenter
+  800efe:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800eff:	5b                   	pop    %ebx
+  800f00:	5e                   	pop    %esi
+  800f01:	5f                   	pop    %edi
+  800f02:	5d                   	pop    %ebp
+  800f03:	c3                   	ret
+
+00800f04 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800f04:	55                   	push   %ebp
+  800f05:	89 e5                	mov    %esp,%ebp
+  800f07:	57                   	push   %edi
+  800f08:	56                   	push   %esi
+  800f09:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f15:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f1a:	89 df                	mov    %ebx,%edi
+  800f1c:	55                   	push   %ebp
+  800f1d:	89 e5                	mov    %esp,%ebp
+  800f1f:	8d 35 27 0f 80 00    	lea    0x800f27,%esi
+  800f25:	0f 34                	sysenter
+  800f27:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800f28:	5b                   	pop    %ebx
+  800f29:	5e                   	pop    %esi
+  800f2a:	5f                   	pop    %edi
+  800f2b:	5d                   	pop    %ebp
+  800f2c:	c3                   	ret
+
+00800f2d <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800f2d:	55                   	push   %ebp
+  800f2e:	89 e5                	mov    %esp,%ebp
+  800f30:	57                   	push   %edi
+  800f31:	56                   	push   %esi
+  800f32:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3e:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f43:	89 df                	mov    %ebx,%edi
+  800f45:	55                   	push   %ebp
+  800f46:	89 e5                	mov    %esp,%ebp
+  800f48:	8d 35 50 0f 80 00    	lea    0x800f50,%esi
+  800f4e:	0f 34                	sysenter
+  800f50:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800f51:	5b                   	pop    %ebx
+  800f52:	5e                   	pop    %esi
+  800f53:	5f                   	pop    %edi
+  800f54:	5d                   	pop    %ebp
+  800f55:	c3                   	ret
+
+00800f56 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800f56:	55                   	push   %ebp
+  800f57:	89 e5                	mov    %esp,%ebp
+  800f59:	57                   	push   %edi
+  800f5a:	56                   	push   %esi
+  800f5b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f62:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f6a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f6d:	55                   	push   %ebp
+  800f6e:	89 e5                	mov    %esp,%ebp
+  800f70:	8d 35 78 0f 80 00    	lea    0x800f78,%esi
+  800f76:	0f 34                	sysenter
+  800f78:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800f79:	5b                   	pop    %ebx
+  800f7a:	5e                   	pop    %esi
+  800f7b:	5f                   	pop    %edi
+  800f7c:	5d                   	pop    %ebp
+  800f7d:	c3                   	ret
+
+00800f7e <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800f7e:	55                   	push   %ebp
+  800f7f:	89 e5                	mov    %esp,%ebp
+  800f81:	57                   	push   %edi
+  800f82:	56                   	push   %esi
+  800f83:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8c:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f91:	89 cb                	mov    %ecx,%ebx
+  800f93:	89 cf                	mov    %ecx,%edi
+  800f95:	89 ce                	mov    %ecx,%esi
+  800f97:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800f99:	5b                   	pop    %ebx
+  800f9a:	5e                   	pop    %esi
+  800f9b:	5f                   	pop    %edi
+  800f9c:	5d                   	pop    %ebp
+  800f9d:	c3                   	ret
+
+00800f9e <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800f9e:	55                   	push   %ebp
+  800f9f:	89 e5                	mov    %esp,%ebp
+  800fa1:	57                   	push   %edi
+  800fa2:	56                   	push   %esi
+  800fa3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fa4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fac:	b8 15 00 00 00       	mov    $0x15,%eax
+  800fb1:	89 cb                	mov    %ecx,%ebx
+  800fb3:	89 cf                	mov    %ecx,%edi
+  800fb5:	55                   	push   %ebp
+  800fb6:	89 e5                	mov    %esp,%ebp
+  800fb8:	8d 35 c0 0f 80 00    	lea    0x800fc0,%esi
+  800fbe:	0f 34                	sysenter
+  800fc0:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800fc1:	5b                   	pop    %ebx
+  800fc2:	5e                   	pop    %esi
+  800fc3:	5f                   	pop    %edi
+  800fc4:	5d                   	pop    %ebp
+  800fc5:	c3                   	ret
+
+00800fc6 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800fc6:	55                   	push   %ebp
+  800fc7:	89 e5                	mov    %esp,%ebp
+  800fc9:	57                   	push   %edi
+  800fca:	56                   	push   %esi
+  800fcb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fcc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd4:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fd9:	89 cb                	mov    %ecx,%ebx
+  800fdb:	89 cf                	mov    %ecx,%edi
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	8d 35 e8 0f 80 00    	lea    0x800fe8,%esi
+  800fe6:	0f 34                	sysenter
+  800fe8:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800fe9:	5b                   	pop    %ebx
+  800fea:	5e                   	pop    %esi
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+
+00800fee <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  800ff4:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  800ffb:	74 0a                	je     801007 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  800ffd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801000:	a3 04 50 80 00       	mov    %eax,0x805004
+}
+  801005:	c9                   	leave
+  801006:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  801007:	83 ec 04             	sub    $0x4,%esp
+  80100a:	6a 07                	push   $0x7
+  80100c:	68 00 f0 bf ee       	push   $0xeebff000
+  801011:	6a 00                	push   $0x0
+  801013:	e8 d5 fb ff ff       	call   800bed <sys_page_alloc>
+  801018:	83 c4 10             	add    $0x10,%esp
+  80101b:	85 c0                	test   %eax,%eax
+  80101d:	75 2c                	jne    80104b <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80101f:	83 ec 08             	sub    $0x8,%esp
+  801022:	68 61 10 80 00       	push   $0x801061
+  801027:	6a 00                	push   $0x0
+  801029:	e8 2a fd ff ff       	call   800d58 <sys_env_set_pgfault_upcall>
+  80102e:	83 c4 10             	add    $0x10,%esp
+  801031:	85 c0                	test   %eax,%eax
+  801033:	74 c8                	je     800ffd <set_pgfault_handler+0xf>
+  801035:	68 fc 3b 80 00       	push   $0x803bfc
+  80103a:	68 2c 3c 80 00       	push   $0x803c2c
+  80103f:	6a 20                	push   $0x20
+  801041:	68 41 3c 80 00       	push   $0x803c41
+  801046:	e8 cd f0 ff ff       	call   800118 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80104b:	68 b4 3b 80 00       	push   $0x803bb4
+  801050:	68 2c 3c 80 00       	push   $0x803c2c
+  801055:	6a 1e                	push   $0x1e
+  801057:	68 41 3c 80 00       	push   $0x803c41
+  80105c:	e8 b7 f0 ff ff       	call   800118 <_panic>
+
+00801061 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801061:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801062:	a1 04 50 80 00       	mov    0x805004,%eax
+	call *%eax
+  801067:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801069:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80106c:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  801071:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  801076:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  80107a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80107d:	83 c4 08             	add    $0x8,%esp
+	popal
+  801080:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  801081:	83 c4 04             	add    $0x4,%esp
+	popfl
+  801084:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  801085:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  801086:	c3                   	ret
+
+00801087 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801087:	55                   	push   %ebp
+  801088:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80108a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80108d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801092:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801095:	5d                   	pop    %ebp
+  801096:	c3                   	ret
+
+00801097 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801097:	55                   	push   %ebp
+  801098:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80109a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80109d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8010a2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8010a7:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8010ac:	5d                   	pop    %ebp
+  8010ad:	c3                   	ret
+
+008010ae <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8010ae:	55                   	push   %ebp
+  8010af:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8010b1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8010b6:	eb 02                	jmp    8010ba <fd_alloc+0xc>
+  8010b8:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8010ba:	89 c2                	mov    %eax,%edx
+  8010bc:	c1 ea 16             	shr    $0x16,%edx
+  8010bf:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8010c6:	f6 c2 01             	test   $0x1,%dl
+  8010c9:	74 2b                	je     8010f6 <fd_alloc+0x48>
+  8010cb:	89 c2                	mov    %eax,%edx
+  8010cd:	c1 ea 0c             	shr    $0xc,%edx
+  8010d0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8010d7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8010dd:	f6 c1 01             	test   $0x1,%cl
+  8010e0:	74 14                	je     8010f6 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8010e2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8010e8:	75 ce                	jne    8010b8 <fd_alloc+0xa>
+  8010ea:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8010ef:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8010f4:	eb 05                	jmp    8010fb <fd_alloc+0x4d>
+			return 0;
+  8010f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8010fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fe:	89 02                	mov    %eax,(%edx)
+}
+  801100:	89 c8                	mov    %ecx,%eax
+  801102:	5d                   	pop    %ebp
+  801103:	c3                   	ret
+
+00801104 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801104:	55                   	push   %ebp
+  801105:	89 e5                	mov    %esp,%ebp
+  801107:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80110a:	83 f8 1f             	cmp    $0x1f,%eax
+  80110d:	77 30                	ja     80113f <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80110f:	c1 e0 0c             	shl    $0xc,%eax
+  801112:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801117:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80111d:	f6 c2 01             	test   $0x1,%dl
+  801120:	74 24                	je     801146 <fd_lookup+0x42>
+  801122:	89 c2                	mov    %eax,%edx
+  801124:	c1 ea 0c             	shr    $0xc,%edx
+  801127:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80112e:	f6 c2 01             	test   $0x1,%dl
+  801131:	74 1a                	je     80114d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801133:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801136:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801138:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80113d:	5d                   	pop    %ebp
+  80113e:	c3                   	ret
+		return -E_INVAL;
+  80113f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801144:	eb f7                	jmp    80113d <fd_lookup+0x39>
+		return -E_INVAL;
+  801146:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80114b:	eb f0                	jmp    80113d <fd_lookup+0x39>
+  80114d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801152:	eb e9                	jmp    80113d <fd_lookup+0x39>
+
+00801154 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801154:	55                   	push   %ebp
+  801155:	89 e5                	mov    %esp,%ebp
+  801157:	53                   	push   %ebx
+  801158:	83 ec 04             	sub    $0x4,%esp
+  80115b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80115e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801163:	eb 03                	jmp    801168 <dev_lookup+0x14>
+  801165:	83 c0 01             	add    $0x1,%eax
+  801168:	8b 1c 85 cc 3c 80 00 	mov    0x803ccc(,%eax,4),%ebx
+  80116f:	85 db                	test   %ebx,%ebx
+  801171:	74 0b                	je     80117e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801173:	39 13                	cmp    %edx,(%ebx)
+  801175:	75 ee                	jne    801165 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801177:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117c:	eb 1f                	jmp    80119d <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80117e:	a1 00 50 80 00       	mov    0x805000,%eax
+  801183:	8b 40 48             	mov    0x48(%eax),%eax
+  801186:	83 ec 04             	sub    $0x4,%esp
+  801189:	52                   	push   %edx
+  80118a:	50                   	push   %eax
+  80118b:	68 50 3c 80 00       	push   $0x803c50
+  801190:	e8 5e f0 ff ff       	call   8001f3 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801195:	83 c4 10             	add    $0x10,%esp
+  801198:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80119d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011a0:	89 1a                	mov    %ebx,(%edx)
+}
+  8011a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011a5:	c9                   	leave
+  8011a6:	c3                   	ret
+
+008011a7 <fd_close>:
+{
+  8011a7:	55                   	push   %ebp
+  8011a8:	89 e5                	mov    %esp,%ebp
+  8011aa:	57                   	push   %edi
+  8011ab:	56                   	push   %esi
+  8011ac:	53                   	push   %ebx
+  8011ad:	83 ec 24             	sub    $0x24,%esp
+  8011b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011b3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011b6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011b9:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011ba:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8011c0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011c3:	50                   	push   %eax
+  8011c4:	e8 3b ff ff ff       	call   801104 <fd_lookup>
+  8011c9:	89 c3                	mov    %eax,%ebx
+  8011cb:	83 c4 10             	add    $0x10,%esp
+  8011ce:	85 c0                	test   %eax,%eax
+  8011d0:	78 05                	js     8011d7 <fd_close+0x30>
+	    || fd != fd2)
+  8011d2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011d5:	74 16                	je     8011ed <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8011d7:	89 f8                	mov    %edi,%eax
+  8011d9:	84 c0                	test   %al,%al
+  8011db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8011e3:	89 d8                	mov    %ebx,%eax
+  8011e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e8:	5b                   	pop    %ebx
+  8011e9:	5e                   	pop    %esi
+  8011ea:	5f                   	pop    %edi
+  8011eb:	5d                   	pop    %ebp
+  8011ec:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8011ed:	83 ec 08             	sub    $0x8,%esp
+  8011f0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8011f3:	50                   	push   %eax
+  8011f4:	ff 36                	push   (%esi)
+  8011f6:	e8 59 ff ff ff       	call   801154 <dev_lookup>
+  8011fb:	89 c3                	mov    %eax,%ebx
+  8011fd:	83 c4 10             	add    $0x10,%esp
+  801200:	85 c0                	test   %eax,%eax
+  801202:	78 1a                	js     80121e <fd_close+0x77>
+		if (dev->dev_close)
+  801204:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801207:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80120a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80120f:	85 c0                	test   %eax,%eax
+  801211:	74 0b                	je     80121e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801213:	83 ec 0c             	sub    $0xc,%esp
+  801216:	56                   	push   %esi
+  801217:	ff d0                	call   *%eax
+  801219:	89 c3                	mov    %eax,%ebx
+  80121b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80121e:	83 ec 08             	sub    $0x8,%esp
+  801221:	56                   	push   %esi
+  801222:	6a 00                	push   $0x0
+  801224:	e8 51 fa ff ff       	call   800c7a <sys_page_unmap>
+	return r;
+  801229:	83 c4 10             	add    $0x10,%esp
+  80122c:	eb b5                	jmp    8011e3 <fd_close+0x3c>
+
+0080122e <close>:
+
+int
+close(int fdnum)
+{
+  80122e:	55                   	push   %ebp
+  80122f:	89 e5                	mov    %esp,%ebp
+  801231:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801234:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801237:	50                   	push   %eax
+  801238:	ff 75 08             	push   0x8(%ebp)
+  80123b:	e8 c4 fe ff ff       	call   801104 <fd_lookup>
+  801240:	83 c4 10             	add    $0x10,%esp
+  801243:	85 c0                	test   %eax,%eax
+  801245:	79 02                	jns    801249 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801247:	c9                   	leave
+  801248:	c3                   	ret
+		return fd_close(fd, 1);
+  801249:	83 ec 08             	sub    $0x8,%esp
+  80124c:	6a 01                	push   $0x1
+  80124e:	ff 75 f4             	push   -0xc(%ebp)
+  801251:	e8 51 ff ff ff       	call   8011a7 <fd_close>
+  801256:	83 c4 10             	add    $0x10,%esp
+  801259:	eb ec                	jmp    801247 <close+0x19>
+
+0080125b <close_all>:
+
+void
+close_all(void)
+{
+  80125b:	55                   	push   %ebp
+  80125c:	89 e5                	mov    %esp,%ebp
+  80125e:	53                   	push   %ebx
+  80125f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801262:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801267:	83 ec 0c             	sub    $0xc,%esp
+  80126a:	53                   	push   %ebx
+  80126b:	e8 be ff ff ff       	call   80122e <close>
+	for (i = 0; i < MAXFD; i++)
+  801270:	83 c3 01             	add    $0x1,%ebx
+  801273:	83 c4 10             	add    $0x10,%esp
+  801276:	83 fb 20             	cmp    $0x20,%ebx
+  801279:	75 ec                	jne    801267 <close_all+0xc>
+}
+  80127b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80127e:	c9                   	leave
+  80127f:	c3                   	ret
+
+00801280 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801280:	55                   	push   %ebp
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	57                   	push   %edi
+  801284:	56                   	push   %esi
+  801285:	53                   	push   %ebx
+  801286:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801289:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80128c:	50                   	push   %eax
+  80128d:	ff 75 08             	push   0x8(%ebp)
+  801290:	e8 6f fe ff ff       	call   801104 <fd_lookup>
+  801295:	89 c3                	mov    %eax,%ebx
+  801297:	83 c4 10             	add    $0x10,%esp
+  80129a:	85 c0                	test   %eax,%eax
+  80129c:	78 7f                	js     80131d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80129e:	83 ec 0c             	sub    $0xc,%esp
+  8012a1:	ff 75 0c             	push   0xc(%ebp)
+  8012a4:	e8 85 ff ff ff       	call   80122e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8012a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8012ac:	c1 e6 0c             	shl    $0xc,%esi
+  8012af:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8012b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8012b8:	89 3c 24             	mov    %edi,(%esp)
+  8012bb:	e8 d7 fd ff ff       	call   801097 <fd2data>
+  8012c0:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8012c2:	89 34 24             	mov    %esi,(%esp)
+  8012c5:	e8 cd fd ff ff       	call   801097 <fd2data>
+  8012ca:	83 c4 10             	add    $0x10,%esp
+  8012cd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8012d0:	89 d8                	mov    %ebx,%eax
+  8012d2:	c1 e8 16             	shr    $0x16,%eax
+  8012d5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012dc:	a8 01                	test   $0x1,%al
+  8012de:	74 11                	je     8012f1 <dup+0x71>
+  8012e0:	89 d8                	mov    %ebx,%eax
+  8012e2:	c1 e8 0c             	shr    $0xc,%eax
+  8012e5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012ec:	f6 c2 01             	test   $0x1,%dl
+  8012ef:	75 36                	jne    801327 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8012f1:	89 f8                	mov    %edi,%eax
+  8012f3:	c1 e8 0c             	shr    $0xc,%eax
+  8012f6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012fd:	83 ec 0c             	sub    $0xc,%esp
+  801300:	25 07 0e 00 00       	and    $0xe07,%eax
+  801305:	50                   	push   %eax
+  801306:	56                   	push   %esi
+  801307:	6a 00                	push   $0x0
+  801309:	57                   	push   %edi
+  80130a:	6a 00                	push   $0x0
+  80130c:	e8 27 f9 ff ff       	call   800c38 <sys_page_map>
+  801311:	89 c3                	mov    %eax,%ebx
+  801313:	83 c4 20             	add    $0x20,%esp
+  801316:	85 c0                	test   %eax,%eax
+  801318:	78 33                	js     80134d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80131a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80131d:	89 d8                	mov    %ebx,%eax
+  80131f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801322:	5b                   	pop    %ebx
+  801323:	5e                   	pop    %esi
+  801324:	5f                   	pop    %edi
+  801325:	5d                   	pop    %ebp
+  801326:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801327:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80132e:	83 ec 0c             	sub    $0xc,%esp
+  801331:	25 07 0e 00 00       	and    $0xe07,%eax
+  801336:	50                   	push   %eax
+  801337:	ff 75 d4             	push   -0x2c(%ebp)
+  80133a:	6a 00                	push   $0x0
+  80133c:	53                   	push   %ebx
+  80133d:	6a 00                	push   $0x0
+  80133f:	e8 f4 f8 ff ff       	call   800c38 <sys_page_map>
+  801344:	89 c3                	mov    %eax,%ebx
+  801346:	83 c4 20             	add    $0x20,%esp
+  801349:	85 c0                	test   %eax,%eax
+  80134b:	79 a4                	jns    8012f1 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80134d:	83 ec 08             	sub    $0x8,%esp
+  801350:	56                   	push   %esi
+  801351:	6a 00                	push   $0x0
+  801353:	e8 22 f9 ff ff       	call   800c7a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801358:	83 c4 08             	add    $0x8,%esp
+  80135b:	ff 75 d4             	push   -0x2c(%ebp)
+  80135e:	6a 00                	push   $0x0
+  801360:	e8 15 f9 ff ff       	call   800c7a <sys_page_unmap>
+	return r;
+  801365:	83 c4 10             	add    $0x10,%esp
+  801368:	eb b3                	jmp    80131d <dup+0x9d>
+
+0080136a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80136a:	55                   	push   %ebp
+  80136b:	89 e5                	mov    %esp,%ebp
+  80136d:	56                   	push   %esi
+  80136e:	53                   	push   %ebx
+  80136f:	83 ec 18             	sub    $0x18,%esp
+  801372:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801375:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801378:	50                   	push   %eax
+  801379:	56                   	push   %esi
+  80137a:	e8 85 fd ff ff       	call   801104 <fd_lookup>
+  80137f:	83 c4 10             	add    $0x10,%esp
+  801382:	85 c0                	test   %eax,%eax
+  801384:	78 3c                	js     8013c2 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801386:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801389:	83 ec 08             	sub    $0x8,%esp
+  80138c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80138f:	50                   	push   %eax
+  801390:	ff 33                	push   (%ebx)
+  801392:	e8 bd fd ff ff       	call   801154 <dev_lookup>
+  801397:	83 c4 10             	add    $0x10,%esp
+  80139a:	85 c0                	test   %eax,%eax
+  80139c:	78 24                	js     8013c2 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80139e:	8b 43 08             	mov    0x8(%ebx),%eax
+  8013a1:	83 e0 03             	and    $0x3,%eax
+  8013a4:	83 f8 01             	cmp    $0x1,%eax
+  8013a7:	74 20                	je     8013c9 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8013a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013ac:	8b 40 08             	mov    0x8(%eax),%eax
+  8013af:	85 c0                	test   %eax,%eax
+  8013b1:	74 37                	je     8013ea <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8013b3:	83 ec 04             	sub    $0x4,%esp
+  8013b6:	ff 75 10             	push   0x10(%ebp)
+  8013b9:	ff 75 0c             	push   0xc(%ebp)
+  8013bc:	53                   	push   %ebx
+  8013bd:	ff d0                	call   *%eax
+  8013bf:	83 c4 10             	add    $0x10,%esp
+}
+  8013c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013c5:	5b                   	pop    %ebx
+  8013c6:	5e                   	pop    %esi
+  8013c7:	5d                   	pop    %ebp
+  8013c8:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013c9:	a1 00 50 80 00       	mov    0x805000,%eax
+  8013ce:	8b 40 48             	mov    0x48(%eax),%eax
+  8013d1:	83 ec 04             	sub    $0x4,%esp
+  8013d4:	56                   	push   %esi
+  8013d5:	50                   	push   %eax
+  8013d6:	68 91 3c 80 00       	push   $0x803c91
+  8013db:	e8 13 ee ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  8013e0:	83 c4 10             	add    $0x10,%esp
+  8013e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013e8:	eb d8                	jmp    8013c2 <read+0x58>
+		return -E_NOT_SUPP;
+  8013ea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013ef:	eb d1                	jmp    8013c2 <read+0x58>
+
+008013f1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8013f1:	55                   	push   %ebp
+  8013f2:	89 e5                	mov    %esp,%ebp
+  8013f4:	57                   	push   %edi
+  8013f5:	56                   	push   %esi
+  8013f6:	53                   	push   %ebx
+  8013f7:	83 ec 0c             	sub    $0xc,%esp
+  8013fa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013fd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801400:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801405:	eb 02                	jmp    801409 <readn+0x18>
+  801407:	01 c3                	add    %eax,%ebx
+  801409:	39 f3                	cmp    %esi,%ebx
+  80140b:	73 21                	jae    80142e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80140d:	83 ec 04             	sub    $0x4,%esp
+  801410:	89 f0                	mov    %esi,%eax
+  801412:	29 d8                	sub    %ebx,%eax
+  801414:	50                   	push   %eax
+  801415:	89 d8                	mov    %ebx,%eax
+  801417:	03 45 0c             	add    0xc(%ebp),%eax
+  80141a:	50                   	push   %eax
+  80141b:	57                   	push   %edi
+  80141c:	e8 49 ff ff ff       	call   80136a <read>
+		if (m < 0)
+  801421:	83 c4 10             	add    $0x10,%esp
+  801424:	85 c0                	test   %eax,%eax
+  801426:	78 04                	js     80142c <readn+0x3b>
+			return m;
+		if (m == 0)
+  801428:	75 dd                	jne    801407 <readn+0x16>
+  80142a:	eb 02                	jmp    80142e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80142c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80142e:	89 d8                	mov    %ebx,%eax
+  801430:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801433:	5b                   	pop    %ebx
+  801434:	5e                   	pop    %esi
+  801435:	5f                   	pop    %edi
+  801436:	5d                   	pop    %ebp
+  801437:	c3                   	ret
+
+00801438 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801438:	55                   	push   %ebp
+  801439:	89 e5                	mov    %esp,%ebp
+  80143b:	56                   	push   %esi
+  80143c:	53                   	push   %ebx
+  80143d:	83 ec 18             	sub    $0x18,%esp
+  801440:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801443:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801446:	50                   	push   %eax
+  801447:	53                   	push   %ebx
+  801448:	e8 b7 fc ff ff       	call   801104 <fd_lookup>
+  80144d:	83 c4 10             	add    $0x10,%esp
+  801450:	85 c0                	test   %eax,%eax
+  801452:	78 37                	js     80148b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801454:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801457:	83 ec 08             	sub    $0x8,%esp
+  80145a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80145d:	50                   	push   %eax
+  80145e:	ff 36                	push   (%esi)
+  801460:	e8 ef fc ff ff       	call   801154 <dev_lookup>
+  801465:	83 c4 10             	add    $0x10,%esp
+  801468:	85 c0                	test   %eax,%eax
+  80146a:	78 1f                	js     80148b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80146c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801470:	74 20                	je     801492 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801472:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801475:	8b 40 0c             	mov    0xc(%eax),%eax
+  801478:	85 c0                	test   %eax,%eax
+  80147a:	74 37                	je     8014b3 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80147c:	83 ec 04             	sub    $0x4,%esp
+  80147f:	ff 75 10             	push   0x10(%ebp)
+  801482:	ff 75 0c             	push   0xc(%ebp)
+  801485:	56                   	push   %esi
+  801486:	ff d0                	call   *%eax
+  801488:	83 c4 10             	add    $0x10,%esp
+}
+  80148b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80148e:	5b                   	pop    %ebx
+  80148f:	5e                   	pop    %esi
+  801490:	5d                   	pop    %ebp
+  801491:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801492:	a1 00 50 80 00       	mov    0x805000,%eax
+  801497:	8b 40 48             	mov    0x48(%eax),%eax
+  80149a:	83 ec 04             	sub    $0x4,%esp
+  80149d:	53                   	push   %ebx
+  80149e:	50                   	push   %eax
+  80149f:	68 ad 3c 80 00       	push   $0x803cad
+  8014a4:	e8 4a ed ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  8014a9:	83 c4 10             	add    $0x10,%esp
+  8014ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014b1:	eb d8                	jmp    80148b <write+0x53>
+		return -E_NOT_SUPP;
+  8014b3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014b8:	eb d1                	jmp    80148b <write+0x53>
+
+008014ba <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8014ba:	55                   	push   %ebp
+  8014bb:	89 e5                	mov    %esp,%ebp
+  8014bd:	53                   	push   %ebx
+  8014be:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014c1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014c4:	50                   	push   %eax
+  8014c5:	ff 75 08             	push   0x8(%ebp)
+  8014c8:	e8 37 fc ff ff       	call   801104 <fd_lookup>
+  8014cd:	83 c4 10             	add    $0x10,%esp
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	78 3a                	js     80150e <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014d4:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014d7:	83 ec 08             	sub    $0x8,%esp
+  8014da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014dd:	50                   	push   %eax
+  8014de:	ff 33                	push   (%ebx)
+  8014e0:	e8 6f fc ff ff       	call   801154 <dev_lookup>
+  8014e5:	83 c4 10             	add    $0x10,%esp
+  8014e8:	85 c0                	test   %eax,%eax
+  8014ea:	78 22                	js     80150e <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8014ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014ef:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8014f2:	85 c0                	test   %eax,%eax
+  8014f4:	74 0d                	je     801503 <seek+0x49>
+  8014f6:	83 ec 0c             	sub    $0xc,%esp
+  8014f9:	53                   	push   %ebx
+  8014fa:	ff d0                	call   *%eax
+  8014fc:	83 c4 10             	add    $0x10,%esp
+  8014ff:	85 c0                	test   %eax,%eax
+  801501:	78 0b                	js     80150e <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801503:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801506:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801509:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80150e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801511:	c9                   	leave
+  801512:	c3                   	ret
+
+00801513 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801513:	55                   	push   %ebp
+  801514:	89 e5                	mov    %esp,%ebp
+  801516:	53                   	push   %ebx
+  801517:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80151a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80151d:	50                   	push   %eax
+  80151e:	ff 75 08             	push   0x8(%ebp)
+  801521:	e8 de fb ff ff       	call   801104 <fd_lookup>
+  801526:	83 c4 10             	add    $0x10,%esp
+  801529:	85 c0                	test   %eax,%eax
+  80152b:	78 2b                	js     801558 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80152d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801530:	83 ec 08             	sub    $0x8,%esp
+  801533:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801536:	50                   	push   %eax
+  801537:	ff 33                	push   (%ebx)
+  801539:	e8 16 fc ff ff       	call   801154 <dev_lookup>
+  80153e:	83 c4 10             	add    $0x10,%esp
+  801541:	85 c0                	test   %eax,%eax
+  801543:	78 13                	js     801558 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801545:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801548:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80154b:	85 c0                	test   %eax,%eax
+  80154d:	74 0e                	je     80155d <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  80154f:	83 ec 0c             	sub    $0xc,%esp
+  801552:	53                   	push   %ebx
+  801553:	ff d0                	call   *%eax
+  801555:	83 c4 10             	add    $0x10,%esp
+}
+  801558:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80155b:	c9                   	leave
+  80155c:	c3                   	ret
+		return 0;
+  80155d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801562:	eb f4                	jmp    801558 <fsync+0x45>
+
+00801564 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801564:	55                   	push   %ebp
+  801565:	89 e5                	mov    %esp,%ebp
+  801567:	56                   	push   %esi
+  801568:	53                   	push   %ebx
+  801569:	83 ec 18             	sub    $0x18,%esp
+  80156c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80156f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801572:	50                   	push   %eax
+  801573:	53                   	push   %ebx
+  801574:	e8 8b fb ff ff       	call   801104 <fd_lookup>
+  801579:	83 c4 10             	add    $0x10,%esp
+  80157c:	85 c0                	test   %eax,%eax
+  80157e:	78 34                	js     8015b4 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801580:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801583:	83 ec 08             	sub    $0x8,%esp
+  801586:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801589:	50                   	push   %eax
+  80158a:	ff 36                	push   (%esi)
+  80158c:	e8 c3 fb ff ff       	call   801154 <dev_lookup>
+  801591:	83 c4 10             	add    $0x10,%esp
+  801594:	85 c0                	test   %eax,%eax
+  801596:	78 1c                	js     8015b4 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801598:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80159c:	74 1d                	je     8015bb <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80159e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015a1:	8b 40 18             	mov    0x18(%eax),%eax
+  8015a4:	85 c0                	test   %eax,%eax
+  8015a6:	74 34                	je     8015dc <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8015a8:	83 ec 08             	sub    $0x8,%esp
+  8015ab:	ff 75 0c             	push   0xc(%ebp)
+  8015ae:	56                   	push   %esi
+  8015af:	ff d0                	call   *%eax
+  8015b1:	83 c4 10             	add    $0x10,%esp
+}
+  8015b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015b7:	5b                   	pop    %ebx
+  8015b8:	5e                   	pop    %esi
+  8015b9:	5d                   	pop    %ebp
+  8015ba:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8015bb:	a1 00 50 80 00       	mov    0x805000,%eax
+  8015c0:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015c3:	83 ec 04             	sub    $0x4,%esp
+  8015c6:	53                   	push   %ebx
+  8015c7:	50                   	push   %eax
+  8015c8:	68 70 3c 80 00       	push   $0x803c70
+  8015cd:	e8 21 ec ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  8015d2:	83 c4 10             	add    $0x10,%esp
+  8015d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015da:	eb d8                	jmp    8015b4 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8015dc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015e1:	eb d1                	jmp    8015b4 <ftruncate+0x50>
+
+008015e3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015e3:	55                   	push   %ebp
+  8015e4:	89 e5                	mov    %esp,%ebp
+  8015e6:	56                   	push   %esi
+  8015e7:	53                   	push   %ebx
+  8015e8:	83 ec 18             	sub    $0x18,%esp
+  8015eb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015f1:	50                   	push   %eax
+  8015f2:	ff 75 08             	push   0x8(%ebp)
+  8015f5:	e8 0a fb ff ff       	call   801104 <fd_lookup>
+  8015fa:	83 c4 10             	add    $0x10,%esp
+  8015fd:	85 c0                	test   %eax,%eax
+  8015ff:	78 49                	js     80164a <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801601:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801604:	83 ec 08             	sub    $0x8,%esp
+  801607:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80160a:	50                   	push   %eax
+  80160b:	ff 36                	push   (%esi)
+  80160d:	e8 42 fb ff ff       	call   801154 <dev_lookup>
+  801612:	83 c4 10             	add    $0x10,%esp
+  801615:	85 c0                	test   %eax,%eax
+  801617:	78 31                	js     80164a <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801619:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80161c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801620:	74 2f                	je     801651 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801622:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801625:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80162c:	00 00 00 
+	stat->st_isdir = 0;
+  80162f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801636:	00 00 00 
+	stat->st_dev = dev;
+  801639:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80163f:	83 ec 08             	sub    $0x8,%esp
+  801642:	53                   	push   %ebx
+  801643:	56                   	push   %esi
+  801644:	ff 50 14             	call   *0x14(%eax)
+  801647:	83 c4 10             	add    $0x10,%esp
+}
+  80164a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80164d:	5b                   	pop    %ebx
+  80164e:	5e                   	pop    %esi
+  80164f:	5d                   	pop    %ebp
+  801650:	c3                   	ret
+		return -E_NOT_SUPP;
+  801651:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801656:	eb f2                	jmp    80164a <fstat+0x67>
+
+00801658 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801658:	55                   	push   %ebp
+  801659:	89 e5                	mov    %esp,%ebp
+  80165b:	56                   	push   %esi
+  80165c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  80165d:	83 ec 08             	sub    $0x8,%esp
+  801660:	68 00 10 00 00       	push   $0x1000
+  801665:	ff 75 08             	push   0x8(%ebp)
+  801668:	e8 b3 07 00 00       	call   801e20 <open>
+  80166d:	89 c3                	mov    %eax,%ebx
+  80166f:	83 c4 10             	add    $0x10,%esp
+  801672:	85 c0                	test   %eax,%eax
+  801674:	78 1b                	js     801691 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801676:	83 ec 08             	sub    $0x8,%esp
+  801679:	ff 75 0c             	push   0xc(%ebp)
+  80167c:	50                   	push   %eax
+  80167d:	e8 61 ff ff ff       	call   8015e3 <fstat>
+  801682:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801684:	89 1c 24             	mov    %ebx,(%esp)
+  801687:	e8 a2 fb ff ff       	call   80122e <close>
+	return r;
+  80168c:	83 c4 10             	add    $0x10,%esp
+  80168f:	89 f3                	mov    %esi,%ebx
+}
+  801691:	89 d8                	mov    %ebx,%eax
+  801693:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801696:	5b                   	pop    %ebx
+  801697:	5e                   	pop    %esi
+  801698:	5d                   	pop    %ebp
+  801699:	c3                   	ret
+
+0080169a <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  80169a:	55                   	push   %ebp
+  80169b:	89 e5                	mov    %esp,%ebp
+  80169d:	57                   	push   %edi
+  80169e:	56                   	push   %esi
+  80169f:	53                   	push   %ebx
+  8016a0:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  8016a6:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  8016ac:	89 d6                	mov    %edx,%esi
+  8016ae:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  8016b4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  8016b7:	89 d3                	mov    %edx,%ebx
+  8016b9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  8016bf:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  8016c6:	74 1d                	je     8016e5 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8016c8:	b8 00 60 80 00       	mov    $0x806000,%eax
+  8016cd:	83 c8 07             	or     $0x7,%eax
+  8016d0:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  8016d6:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8016db:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  8016e1:	01 ce                	add    %ecx,%esi
+  8016e3:	eb 28                	jmp    80170d <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016e5:	83 ec 0c             	sub    $0xc,%esp
+  8016e8:	6a 01                	push   $0x1
+  8016ea:	e8 0c 1e 00 00       	call   8034fb <ipc_find_env>
+  8016ef:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8016f4:	83 c4 10             	add    $0x10,%esp
+  8016f7:	eb cf                	jmp    8016c8 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  8016f9:	83 c0 01             	add    $0x1,%eax
+  8016fc:	89 fa                	mov    %edi,%edx
+  8016fe:	09 da                	or     %ebx,%edx
+  801700:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801707:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80170d:	39 f3                	cmp    %esi,%ebx
+  80170f:	72 e8                	jb     8016f9 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801711:	83 f8 41             	cmp    $0x41,%eax
+  801714:	77 2f                	ja     801745 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801716:	50                   	push   %eax
+  801717:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  80171d:	50                   	push   %eax
+  80171e:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801724:	ff 35 c8 70 80 00    	push   0x8070c8
+  80172a:	e8 7e 1d 00 00       	call   8034ad <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  80172f:	83 c4 0c             	add    $0xc,%esp
+  801732:	6a 00                	push   $0x0
+  801734:	6a 00                	push   $0x0
+  801736:	6a 00                	push   $0x0
+  801738:	e8 1a 1c 00 00       	call   803357 <ipc_recv>
+}
+  80173d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801740:	5b                   	pop    %ebx
+  801741:	5e                   	pop    %esi
+  801742:	5f                   	pop    %edi
+  801743:	5d                   	pop    %ebp
+  801744:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801745:	68 e0 3c 80 00       	push   $0x803ce0
+  80174a:	68 2c 3c 80 00       	push   $0x803c2c
+  80174f:	6a 40                	push   $0x40
+  801751:	68 fc 3c 80 00       	push   $0x803cfc
+  801756:	e8 bd e9 ff ff       	call   800118 <_panic>
+
+0080175b <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  80175b:	55                   	push   %ebp
+  80175c:	89 e5                	mov    %esp,%ebp
+  80175e:	57                   	push   %edi
+  80175f:	56                   	push   %esi
+  801760:	53                   	push   %ebx
+  801761:	83 ec 1c             	sub    $0x1c,%esp
+  801764:	89 c3                	mov    %eax,%ebx
+  801766:	89 d6                	mov    %edx,%esi
+  801768:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  80176b:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801771:	89 ca                	mov    %ecx,%edx
+  801773:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801776:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  80177d:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801780:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801787:	8b 76 0c             	mov    0xc(%esi),%esi
+  80178a:	89 fb                	mov    %edi,%ebx
+  80178c:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801793:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801796:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  80179d:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017a0:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  8017a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017aa:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  8017b1:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  8017b4:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  8017bb:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  8017c0:	39 c8                	cmp    %ecx,%eax
+  8017c2:	74 0d                	je     8017d1 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  8017c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017cc:	5b                   	pop    %ebx
+  8017cd:	5e                   	pop    %esi
+  8017ce:	5f                   	pop    %edi
+  8017cf:	5d                   	pop    %ebp
+  8017d0:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017d1:	6a 07                	push   $0x7
+  8017d3:	68 00 60 80 00       	push   $0x806000
+  8017d8:	6a 0d                	push   $0xd
+  8017da:	ff 35 c8 70 80 00    	push   0x8070c8
+  8017e0:	e8 dd 1b 00 00       	call   8033c2 <ipc_send>
+  8017e5:	83 c4 10             	add    $0x10,%esp
+  8017e8:	eb da                	jmp    8017c4 <fsring_post+0x69>
+
+008017ea <fsipcv>:
+{
+  8017ea:	55                   	push   %ebp
+  8017eb:	89 e5                	mov    %esp,%ebp
+  8017ed:	57                   	push   %edi
+  8017ee:	56                   	push   %esi
+  8017ef:	53                   	push   %ebx
+  8017f0:	83 ec 0c             	sub    $0xc,%esp
+  8017f3:	89 c7                	mov    %eax,%edi
+  8017f5:	89 d3                	mov    %edx,%ebx
+  8017f7:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  8017f9:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801800:	74 26                	je     801828 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801802:	6a 07                	push   $0x7
+  801804:	68 00 60 80 00       	push   $0x806000
+  801809:	57                   	push   %edi
+  80180a:	ff 35 c8 70 80 00    	push   0x8070c8
+  801810:	e8 ad 1b 00 00       	call   8033c2 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801815:	6a 00                	push   $0x0
+  801817:	56                   	push   %esi
+  801818:	53                   	push   %ebx
+  801819:	6a 00                	push   $0x0
+  80181b:	e8 fa 1b 00 00       	call   80341a <ipc_recvv>
+}
+  801820:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801823:	5b                   	pop    %ebx
+  801824:	5e                   	pop    %esi
+  801825:	5f                   	pop    %edi
+  801826:	5d                   	pop    %ebp
+  801827:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801828:	83 ec 0c             	sub    $0xc,%esp
+  80182b:	6a 01                	push   $0x1
+  80182d:	e8 c9 1c 00 00       	call   8034fb <ipc_find_env>
+  801832:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801837:	83 c4 10             	add    $0x10,%esp
+  80183a:	eb c6                	jmp    801802 <fsipcv+0x18>
+
+0080183c <fsipc>:
+{
+  80183c:	55                   	push   %ebp
+  80183d:	89 e5                	mov    %esp,%ebp
+  80183f:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801842:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801849:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  80184c:	e8 99 ff ff ff       	call   8017ea <fsipcv>
+}
+  801851:	c9                   	leave
+  801852:	c3                   	ret
+
+00801853 <file_write_direct>:
+{
+  801853:	55                   	push   %ebp
+  801854:	89 e5                	mov    %esp,%ebp
+  801856:	56                   	push   %esi
+  801857:	53                   	push   %ebx
+  801858:	89 c3                	mov    %eax,%ebx
+  80185a:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  80185c:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801862:	77 40                	ja     8018a4 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801864:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801869:	39 c8                	cmp    %ecx,%eax
+  80186b:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80186e:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801871:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  801877:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80187c:	83 ec 04             	sub    $0x4,%esp
+  80187f:	50                   	push   %eax
+  801880:	52                   	push   %edx
+  801881:	68 08 60 80 00       	push   $0x806008
+  801886:	e8 dc f0 ff ff       	call   800967 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80188b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801890:	b8 04 00 00 00       	mov    $0x4,%eax
+  801895:	e8 a2 ff ff ff       	call   80183c <fsipc>
+  80189a:	83 c4 10             	add    $0x10,%esp
+}
+  80189d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018a0:	5b                   	pop    %ebx
+  8018a1:	5e                   	pop    %esi
+  8018a2:	5d                   	pop    %ebp
+  8018a3:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8018a4:	89 d6                	mov    %edx,%esi
+  8018a6:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8018ac:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8018b1:	29 f1                	sub    %esi,%ecx
+  8018b3:	39 c1                	cmp    %eax,%ecx
+  8018b5:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  8018b8:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8018bb:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  8018c0:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8018c6:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  8018cc:	83 ec 0c             	sub    $0xc,%esp
+  8018cf:	6a 05                	push   $0x5
+  8018d1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8018d6:	e8 bf fd ff ff       	call   80169a <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  8018db:	83 c4 10             	add    $0x10,%esp
+  8018de:	eb bd                	jmp    80189d <file_write_direct+0x4a>
+
+008018e0 <devfile_sync>:
+{
+  8018e0:	55                   	push   %ebp
+  8018e1:	89 e5                	mov    %esp,%ebp
+  8018e3:	57                   	push   %edi
+  8018e4:	56                   	push   %esi
+  8018e5:	53                   	push   %ebx
+  8018e6:	83 ec 28             	sub    $0x28,%esp
+  8018e9:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  8018ec:	56                   	push   %esi
+  8018ed:	e8 a5 f7 ff ff       	call   801097 <fd2data>
+  8018f2:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  8018f4:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  8018f7:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  8018fe:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801901:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801906:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  80190a:	74 45                	je     801951 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  80190c:	8b 46 14             	mov    0x14(%esi),%eax
+  80190f:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801912:	b8 00 00 00 00       	mov    $0x0,%eax
+  801917:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80191c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  80191f:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801922:	39 cb                	cmp    %ecx,%ebx
+  801924:	73 14                	jae    80193a <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801926:	29 d9                	sub    %ebx,%ecx
+  801928:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  80192b:	89 f0                	mov    %esi,%eax
+  80192d:	e8 21 ff ff ff       	call   801853 <file_write_direct>
+  801932:	85 c0                	test   %eax,%eax
+  801934:	7e 04                	jle    80193a <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801936:	01 c3                	add    %eax,%ebx
+  801938:	eb e5                	jmp    80191f <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  80193a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80193d:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801944:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801947:	85 c0                	test   %eax,%eax
+  801949:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194e:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801951:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801954:	5b                   	pop    %ebx
+  801955:	5e                   	pop    %esi
+  801956:	5f                   	pop    %edi
+  801957:	5d                   	pop    %ebp
+  801958:	c3                   	ret
+
+00801959 <devfile_write>:
+{
+  801959:	55                   	push   %ebp
+  80195a:	89 e5                	mov    %esp,%ebp
+  80195c:	57                   	push   %edi
+  80195d:	56                   	push   %esi
+  80195e:	53                   	push   %ebx
+  80195f:	83 ec 28             	sub    $0x28,%esp
+  801962:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801965:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801968:	53                   	push   %ebx
+  801969:	e8 29 f7 ff ff       	call   801097 <fd2data>
+  80196e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801971:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801974:	83 c4 10             	add    $0x10,%esp
+  801977:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  80197b:	74 43                	je     8019c0 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  80197d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801984:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801987:	85 c0                	test   %eax,%eax
+  801989:	74 43                	je     8019ce <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  80198b:	89 c2                	mov    %eax,%edx
+  80198d:	03 53 14             	add    0x14(%ebx),%edx
+  801990:	39 fa                	cmp    %edi,%edx
+  801992:	75 0b                	jne    80199f <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801994:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801997:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  80199d:	76 66                	jbe    801a05 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  80199f:	83 ec 0c             	sub    $0xc,%esp
+  8019a2:	53                   	push   %ebx
+  8019a3:	e8 38 ff ff ff       	call   8018e0 <devfile_sync>
+  8019a8:	83 c4 10             	add    $0x10,%esp
+  8019ab:	85 c0                	test   %eax,%eax
+  8019ad:	78 4e                	js     8019fd <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8019af:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8019b5:	77 56                	ja     801a0d <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  8019b7:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8019ba:	85 c0                	test   %eax,%eax
+  8019bc:	75 20                	jne    8019de <devfile_write+0x85>
+  8019be:	eb 16                	jmp    8019d6 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  8019c0:	89 f1                	mov    %esi,%ecx
+  8019c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019c5:	89 d8                	mov    %ebx,%eax
+  8019c7:	e8 87 fe ff ff       	call   801853 <file_write_direct>
+  8019cc:	eb 2f                	jmp    8019fd <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8019ce:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8019d4:	77 37                	ja     801a0d <devfile_write+0xb4>
+		ff->buf_base = pos;
+  8019d6:	89 7b 14             	mov    %edi,0x14(%ebx)
+  8019d9:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  8019de:	83 ec 04             	sub    $0x4,%esp
+  8019e1:	56                   	push   %esi
+  8019e2:	ff 75 0c             	push   0xc(%ebp)
+  8019e5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019e8:	01 c1                	add    %eax,%ecx
+  8019ea:	51                   	push   %ecx
+  8019eb:	e8 77 ef ff ff       	call   800967 <memmove>
+	ff->buf_wlen += n;
+  8019f0:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  8019f3:	01 f7                	add    %esi,%edi
+  8019f5:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8019f8:	89 f0                	mov    %esi,%eax
+  8019fa:	83 c4 10             	add    $0x10,%esp
+}
+  8019fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a00:	5b                   	pop    %ebx
+  801a01:	5e                   	pop    %esi
+  801a02:	5f                   	pop    %edi
+  801a03:	5d                   	pop    %ebp
+  801a04:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801a05:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801a0b:	76 d1                	jbe    8019de <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801a0d:	89 f1                	mov    %esi,%ecx
+  801a0f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a12:	89 d8                	mov    %ebx,%eax
+  801a14:	e8 3a fe ff ff       	call   801853 <file_write_direct>
+  801a19:	eb e2                	jmp    8019fd <devfile_write+0xa4>
+
+00801a1b <devfile_trunc>:
+{
+  801a1b:	55                   	push   %ebp
+  801a1c:	89 e5                	mov    %esp,%ebp
+  801a1e:	53                   	push   %ebx
+  801a1f:	83 ec 10             	sub    $0x10,%esp
+  801a22:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801a25:	53                   	push   %ebx
+  801a26:	e8 b5 fe ff ff       	call   8018e0 <devfile_sync>
+  801a2b:	83 c4 10             	add    $0x10,%esp
+  801a2e:	85 c0                	test   %eax,%eax
+  801a30:	78 1f                	js     801a51 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a32:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a35:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801a3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a3d:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801a42:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a47:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a4c:	e8 eb fd ff ff       	call   80183c <fsipc>
+}
+  801a51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a54:	c9                   	leave
+  801a55:	c3                   	ret
+
+00801a56 <devfile_stat>:
+{
+  801a56:	55                   	push   %ebp
+  801a57:	89 e5                	mov    %esp,%ebp
+  801a59:	56                   	push   %esi
+  801a5a:	53                   	push   %ebx
+  801a5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a5e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801a61:	83 ec 0c             	sub    $0xc,%esp
+  801a64:	53                   	push   %ebx
+  801a65:	e8 76 fe ff ff       	call   8018e0 <devfile_sync>
+  801a6a:	83 c4 10             	add    $0x10,%esp
+  801a6d:	85 c0                	test   %eax,%eax
+  801a6f:	78 47                	js     801ab8 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a71:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a74:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a7e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a83:	e8 b4 fd ff ff       	call   80183c <fsipc>
+  801a88:	85 c0                	test   %eax,%eax
+  801a8a:	78 2c                	js     801ab8 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a8c:	83 ec 08             	sub    $0x8,%esp
+  801a8f:	68 00 60 80 00       	push   $0x806000
+  801a94:	56                   	push   %esi
+  801a95:	e8 47 ed ff ff       	call   8007e1 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a9a:	a1 80 60 80 00       	mov    0x806080,%eax
+  801a9f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801aa5:	a1 84 60 80 00       	mov    0x806084,%eax
+  801aaa:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801ab0:	83 c4 10             	add    $0x10,%esp
+  801ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ab8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801abb:	5b                   	pop    %ebx
+  801abc:	5e                   	pop    %esi
+  801abd:	5d                   	pop    %ebp
+  801abe:	c3                   	ret
+
+00801abf <devfile_flush>:
+{
+  801abf:	55                   	push   %ebp
+  801ac0:	89 e5                	mov    %esp,%ebp
+  801ac2:	56                   	push   %esi
+  801ac3:	53                   	push   %ebx
+  801ac4:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801ac7:	83 ec 0c             	sub    $0xc,%esp
+  801aca:	56                   	push   %esi
+  801acb:	e8 10 fe ff ff       	call   8018e0 <devfile_sync>
+  801ad0:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801ad2:	83 c4 10             	add    $0x10,%esp
+  801ad5:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801ad9:	75 25                	jne    801b00 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801adb:	8b 46 0c             	mov    0xc(%esi),%eax
+  801ade:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801ae3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae8:	b8 06 00 00 00       	mov    $0x6,%eax
+  801aed:	e8 4a fd ff ff       	call   80183c <fsipc>
+  801af2:	85 c0                	test   %eax,%eax
+  801af4:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801af7:	89 d8                	mov    %ebx,%eax
+  801af9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801afc:	5b                   	pop    %ebx
+  801afd:	5e                   	pop    %esi
+  801afe:	5d                   	pop    %ebp
+  801aff:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801b00:	83 ec 0c             	sub    $0xc,%esp
+  801b03:	56                   	push   %esi
+  801b04:	e8 8e f5 ff ff       	call   801097 <fd2data>
+  801b09:	83 c4 08             	add    $0x8,%esp
+  801b0c:	50                   	push   %eax
+  801b0d:	6a 00                	push   $0x0
+  801b0f:	e8 66 f1 ff ff       	call   800c7a <sys_page_unmap>
+  801b14:	83 c4 10             	add    $0x10,%esp
+  801b17:	eb c2                	jmp    801adb <devfile_flush+0x1c>
+
+00801b19 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801b19:	55                   	push   %ebp
+  801b1a:	89 e5                	mov    %esp,%ebp
+  801b1c:	57                   	push   %edi
+  801b1d:	56                   	push   %esi
+  801b1e:	53                   	push   %ebx
+  801b1f:	83 ec 64             	sub    $0x64,%esp
+  801b22:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801b24:	52                   	push   %edx
+  801b25:	50                   	push   %eax
+  801b26:	e8 d9 f5 ff ff       	call   801104 <fd_lookup>
+  801b2b:	89 c1                	mov    %eax,%ecx
+  801b2d:	83 c4 10             	add    $0x10,%esp
+  801b30:	85 c0                	test   %eax,%eax
+  801b32:	0f 88 f2 00 00 00    	js     801c2a <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801b38:	8b 07                	mov    (%edi),%eax
+  801b3a:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801b40:	39 10                	cmp    %edx,(%eax)
+  801b42:	0f 85 03 01 00 00    	jne    801c4b <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801b48:	a1 00 50 80 00       	mov    0x805000,%eax
+  801b4d:	8b 40 48             	mov    0x48(%eax),%eax
+  801b50:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801b56:	0f 84 96 00 00 00    	je     801bf2 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801b5c:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801b63:	0f 84 cb 00 00 00    	je     801c34 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b69:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801b6e:	83 c8 07             	or     $0x7,%eax
+  801b71:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801b74:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b77:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801b7c:	83 ec 04             	sub    $0x4,%esp
+  801b7f:	68 07 04 00 00       	push   $0x407
+  801b84:	53                   	push   %ebx
+  801b85:	6a 00                	push   $0x0
+  801b87:	e8 61 f0 ff ff       	call   800bed <sys_page_alloc>
+  801b8c:	89 c1                	mov    %eax,%ecx
+  801b8e:	83 c4 10             	add    $0x10,%esp
+  801b91:	85 c0                	test   %eax,%eax
+  801b93:	0f 88 91 00 00 00    	js     801c2a <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801b99:	89 d8                	mov    %ebx,%eax
+  801b9b:	83 c8 07             	or     $0x7,%eax
+  801b9e:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801ba0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ba6:	83 c6 04             	add    $0x4,%esi
+  801ba9:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801baf:	75 cb                	jne    801b7c <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801bb1:	6a 12                	push   $0x12
+  801bb3:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801bb6:	50                   	push   %eax
+  801bb7:	6a 0c                	push   $0xc
+  801bb9:	ff 35 c8 70 80 00    	push   0x8070c8
+  801bbf:	e8 e9 18 00 00       	call   8034ad <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801bc4:	83 c4 0c             	add    $0xc,%esp
+  801bc7:	6a 00                	push   $0x0
+  801bc9:	6a 00                	push   $0x0
+  801bcb:	6a 00                	push   $0x0
+  801bcd:	e8 85 17 00 00       	call   803357 <ipc_recv>
+  801bd2:	89 c1                	mov    %eax,%ecx
+  801bd4:	83 c4 10             	add    $0x10,%esp
+  801bd7:	85 c0                	test   %eax,%eax
+  801bd9:	78 4f                	js     801c2a <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801bdb:	a1 00 50 80 00       	mov    0x805000,%eax
+  801be0:	8b 40 48             	mov    0x48(%eax),%eax
+  801be3:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801be8:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801bef:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801bf2:	83 ec 0c             	sub    $0xc,%esp
+  801bf5:	ff 37                	push   (%edi)
+  801bf7:	e8 e4 fc ff ff       	call   8018e0 <devfile_sync>
+  801bfc:	89 c1                	mov    %eax,%ecx
+  801bfe:	83 c4 10             	add    $0x10,%esp
+  801c01:	85 c0                	test   %eax,%eax
+  801c03:	78 25                	js     801c2a <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801c05:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801c0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801c10:	ba 01 00 00 00       	mov    $0x1,%edx
+  801c15:	89 d0                	mov    %edx,%eax
+  801c17:	d3 e0                	shl    %cl,%eax
+  801c19:	85 d8                	test   %ebx,%eax
+  801c1b:	74 0d                	je     801c2a <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801c1d:	83 c1 01             	add    $0x1,%ecx
+  801c20:	83 f9 10             	cmp    $0x10,%ecx
+  801c23:	75 f0                	jne    801c15 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801c25:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801c2a:	89 c8                	mov    %ecx,%eax
+  801c2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c2f:	5b                   	pop    %ebx
+  801c30:	5e                   	pop    %esi
+  801c31:	5f                   	pop    %edi
+  801c32:	5d                   	pop    %ebp
+  801c33:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c34:	83 ec 0c             	sub    $0xc,%esp
+  801c37:	6a 01                	push   $0x1
+  801c39:	e8 bd 18 00 00       	call   8034fb <ipc_find_env>
+  801c3e:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801c43:	83 c4 10             	add    $0x10,%esp
+  801c46:	e9 1e ff ff ff       	jmp    801b69 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801c4b:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801c50:	eb d8                	jmp    801c2a <fsring_slot+0x111>
+
+00801c52 <file_read_direct>:
+{
+  801c52:	55                   	push   %ebp
+  801c53:	89 e5                	mov    %esp,%ebp
+  801c55:	57                   	push   %edi
+  801c56:	56                   	push   %esi
+  801c57:	53                   	push   %ebx
+  801c58:	83 ec 1c             	sub    $0x1c,%esp
+  801c5b:	89 c7                	mov    %eax,%edi
+  801c5d:	89 d6                	mov    %edx,%esi
+  801c5f:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801c61:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801c67:	77 52                	ja     801cbb <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c69:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c6c:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801c71:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c77:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c81:	e8 b6 fb ff ff       	call   80183c <fsipc>
+  801c86:	89 c7                	mov    %eax,%edi
+  801c88:	85 c0                	test   %eax,%eax
+  801c8a:	78 25                	js     801cb1 <file_read_direct+0x5f>
+	assert(r <= n);
+  801c8c:	39 c3                	cmp    %eax,%ebx
+  801c8e:	0f 82 87 00 00 00    	jb     801d1b <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801c94:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c99:	0f 8f 95 00 00 00    	jg     801d34 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801c9f:	83 ec 04             	sub    $0x4,%esp
+  801ca2:	50                   	push   %eax
+  801ca3:	68 00 60 80 00       	push   $0x806000
+  801ca8:	56                   	push   %esi
+  801ca9:	e8 b9 ec ff ff       	call   800967 <memmove>
+	return r;
+  801cae:	83 c4 10             	add    $0x10,%esp
+}
+  801cb1:	89 f8                	mov    %edi,%eax
+  801cb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cb6:	5b                   	pop    %ebx
+  801cb7:	5e                   	pop    %esi
+  801cb8:	5f                   	pop    %edi
+  801cb9:	5d                   	pop    %ebp
+  801cba:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801cbb:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801cc1:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801cc6:	29 d1                	sub    %edx,%ecx
+  801cc8:	39 d9                	cmp    %ebx,%ecx
+  801cca:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801ccd:	89 f0                	mov    %esi,%eax
+  801ccf:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801cd2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801cd5:	eb 0f                	jmp    801ce6 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801cd7:	0f b6 10             	movzbl (%eax),%edx
+  801cda:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801cdc:	05 00 10 00 00       	add    $0x1000,%eax
+  801ce1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ce6:	39 c8                	cmp    %ecx,%eax
+  801ce8:	72 ed                	jb     801cd7 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801cea:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ced:	8b 47 0c             	mov    0xc(%edi),%eax
+  801cf0:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801cf5:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801cfb:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801d01:	83 ec 0c             	sub    $0xc,%esp
+  801d04:	6a 07                	push   $0x7
+  801d06:	89 d9                	mov    %ebx,%ecx
+  801d08:	89 f2                	mov    %esi,%edx
+  801d0a:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d0f:	e8 86 f9 ff ff       	call   80169a <fsipc_pages>
+  801d14:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801d16:	83 c4 10             	add    $0x10,%esp
+  801d19:	eb 96                	jmp    801cb1 <file_read_direct+0x5f>
+	assert(r <= n);
+  801d1b:	68 07 3d 80 00       	push   $0x803d07
+  801d20:	68 2c 3c 80 00       	push   $0x803c2c
+  801d25:	68 dc 00 00 00       	push   $0xdc
+  801d2a:	68 fc 3c 80 00       	push   $0x803cfc
+  801d2f:	e8 e4 e3 ff ff       	call   800118 <_panic>
+	assert(r <= PGSIZE);
+  801d34:	68 18 3d 80 00       	push   $0x803d18
+  801d39:	68 2c 3c 80 00       	push   $0x803c2c
+  801d3e:	68 dd 00 00 00       	push   $0xdd
+  801d43:	68 fc 3c 80 00       	push   $0x803cfc
+  801d48:	e8 cb e3 ff ff       	call   800118 <_panic>
+
+00801d4d <devfile_read>:
+{
+  801d4d:	55                   	push   %ebp
+  801d4e:	89 e5                	mov    %esp,%ebp
+  801d50:	57                   	push   %edi
+  801d51:	56                   	push   %esi
+  801d52:	53                   	push   %ebx
+  801d53:	83 ec 28             	sub    $0x28,%esp
+  801d56:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d59:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801d5c:	53                   	push   %ebx
+  801d5d:	e8 35 f3 ff ff       	call   801097 <fd2data>
+  801d62:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801d65:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801d68:	83 c4 10             	add    $0x10,%esp
+  801d6b:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801d6f:	74 7d                	je     801dee <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801d71:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801d75:	0f 85 81 00 00 00    	jne    801dfc <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801d7b:	8b 43 18             	mov    0x18(%ebx),%eax
+  801d7e:	85 c0                	test   %eax,%eax
+  801d80:	74 0d                	je     801d8f <devfile_read+0x42>
+  801d82:	8b 53 14             	mov    0x14(%ebx),%edx
+  801d85:	39 fa                	cmp    %edi,%edx
+  801d87:	7f 06                	jg     801d8f <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801d89:	01 c2                	add    %eax,%edx
+  801d8b:	39 d7                	cmp    %edx,%edi
+  801d8d:	72 28                	jb     801db7 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801d8f:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801d96:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d9c:	77 74                	ja     801e12 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801d9e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801da3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801da6:	89 d8                	mov    %ebx,%eax
+  801da8:	e8 a5 fe ff ff       	call   801c52 <file_read_direct>
+  801dad:	85 c0                	test   %eax,%eax
+  801daf:	7e 35                	jle    801de6 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801db1:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801db4:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801db7:	8b 53 14             	mov    0x14(%ebx),%edx
+  801dba:	89 d0                	mov    %edx,%eax
+  801dbc:	03 43 18             	add    0x18(%ebx),%eax
+  801dbf:	29 f8                	sub    %edi,%eax
+  801dc1:	39 f0                	cmp    %esi,%eax
+  801dc3:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801dc6:	83 ec 04             	sub    $0x4,%esp
+  801dc9:	56                   	push   %esi
+  801dca:	89 f8                	mov    %edi,%eax
+  801dcc:	29 d0                	sub    %edx,%eax
+  801dce:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801dd1:	01 c1                	add    %eax,%ecx
+  801dd3:	51                   	push   %ecx
+  801dd4:	ff 75 0c             	push   0xc(%ebp)
+  801dd7:	e8 8b eb ff ff       	call   800967 <memmove>
+	fd->fd_offset = pos + n;
+  801ddc:	01 f7                	add    %esi,%edi
+  801dde:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801de1:	89 f0                	mov    %esi,%eax
+  801de3:	83 c4 10             	add    $0x10,%esp
+}
+  801de6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801de9:	5b                   	pop    %ebx
+  801dea:	5e                   	pop    %esi
+  801deb:	5f                   	pop    %edi
+  801dec:	5d                   	pop    %ebp
+  801ded:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801dee:	89 f1                	mov    %esi,%ecx
+  801df0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801df3:	89 d8                	mov    %ebx,%eax
+  801df5:	e8 58 fe ff ff       	call   801c52 <file_read_direct>
+  801dfa:	eb ea                	jmp    801de6 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801dfc:	83 ec 0c             	sub    $0xc,%esp
+  801dff:	53                   	push   %ebx
+  801e00:	e8 db fa ff ff       	call   8018e0 <devfile_sync>
+  801e05:	83 c4 10             	add    $0x10,%esp
+  801e08:	85 c0                	test   %eax,%eax
+  801e0a:	0f 89 6b ff ff ff    	jns    801d7b <devfile_read+0x2e>
+  801e10:	eb d4                	jmp    801de6 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801e12:	89 f1                	mov    %esi,%ecx
+  801e14:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e17:	89 d8                	mov    %ebx,%eax
+  801e19:	e8 34 fe ff ff       	call   801c52 <file_read_direct>
+  801e1e:	eb c6                	jmp    801de6 <devfile_read+0x99>
+
+00801e20 <open>:
+{
+  801e20:	55                   	push   %ebp
+  801e21:	89 e5                	mov    %esp,%ebp
+  801e23:	56                   	push   %esi
+  801e24:	53                   	push   %ebx
+  801e25:	83 ec 1c             	sub    $0x1c,%esp
+  801e28:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801e2b:	56                   	push   %esi
+  801e2c:	e8 75 e9 ff ff       	call   8007a6 <strlen>
+  801e31:	83 c4 10             	add    $0x10,%esp
+  801e34:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e39:	0f 8f a0 00 00 00    	jg     801edf <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801e3f:	83 ec 0c             	sub    $0xc,%esp
+  801e42:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e45:	50                   	push   %eax
+  801e46:	e8 63 f2 ff ff       	call   8010ae <fd_alloc>
+  801e4b:	89 c3                	mov    %eax,%ebx
+  801e4d:	83 c4 10             	add    $0x10,%esp
+  801e50:	85 c0                	test   %eax,%eax
+  801e52:	78 45                	js     801e99 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801e54:	83 ec 08             	sub    $0x8,%esp
+  801e57:	56                   	push   %esi
+  801e58:	68 00 60 80 00       	push   $0x806000
+  801e5d:	e8 7f e9 ff ff       	call   8007e1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801e62:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e65:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801e6a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e6d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e72:	e8 c5 f9 ff ff       	call   80183c <fsipc>
+  801e77:	89 c3                	mov    %eax,%ebx
+  801e79:	83 c4 10             	add    $0x10,%esp
+  801e7c:	85 c0                	test   %eax,%eax
+  801e7e:	78 22                	js     801ea2 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801e80:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801e87:	74 2b                	je     801eb4 <open+0x94>
+	return fd2num(fd);
+  801e89:	83 ec 0c             	sub    $0xc,%esp
+  801e8c:	ff 75 f4             	push   -0xc(%ebp)
+  801e8f:	e8 f3 f1 ff ff       	call   801087 <fd2num>
+  801e94:	89 c3                	mov    %eax,%ebx
+  801e96:	83 c4 10             	add    $0x10,%esp
+}
+  801e99:	89 d8                	mov    %ebx,%eax
+  801e9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e9e:	5b                   	pop    %ebx
+  801e9f:	5e                   	pop    %esi
+  801ea0:	5d                   	pop    %ebp
+  801ea1:	c3                   	ret
+		fd_close(fd, 0);
+  801ea2:	83 ec 08             	sub    $0x8,%esp
+  801ea5:	6a 00                	push   $0x0
+  801ea7:	ff 75 f4             	push   -0xc(%ebp)
+  801eaa:	e8 f8 f2 ff ff       	call   8011a7 <fd_close>
+		return r;
+  801eaf:	83 c4 10             	add    $0x10,%esp
+  801eb2:	eb e5                	jmp    801e99 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801eb4:	83 ec 0c             	sub    $0xc,%esp
+  801eb7:	ff 75 f4             	push   -0xc(%ebp)
+  801eba:	e8 d8 f1 ff ff       	call   801097 <fd2data>
+  801ebf:	83 c4 0c             	add    $0xc,%esp
+  801ec2:	68 07 04 00 00       	push   $0x407
+  801ec7:	50                   	push   %eax
+  801ec8:	6a 00                	push   $0x0
+  801eca:	e8 1e ed ff ff       	call   800bed <sys_page_alloc>
+  801ecf:	83 c4 10             	add    $0x10,%esp
+  801ed2:	85 c0                	test   %eax,%eax
+  801ed4:	75 b3                	jne    801e89 <open+0x69>
+		fd->fd_file.buffered = 1;
+  801ed6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ed9:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801edd:	eb aa                	jmp    801e89 <open+0x69>
+		return -E_BAD_PATH;
+  801edf:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ee4:	eb b3                	jmp    801e99 <open+0x79>
+
+00801ee6 <readdir>:
+{
+  801ee6:	55                   	push   %ebp
+  801ee7:	89 e5                	mov    %esp,%ebp
+  801ee9:	53                   	push   %ebx
+  801eea:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801eed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ef0:	50                   	push   %eax
+  801ef1:	ff 75 08             	push   0x8(%ebp)
+  801ef4:	e8 0b f2 ff ff       	call   801104 <fd_lookup>
+  801ef9:	89 c3                	mov    %eax,%ebx
+  801efb:	83 c4 10             	add    $0x10,%esp
+  801efe:	85 c0                	test   %eax,%eax
+  801f00:	78 73                	js     801f75 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801f02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f05:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801f0b:	39 08                	cmp    %ecx,(%eax)
+  801f0d:	0f 85 82 00 00 00    	jne    801f95 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801f13:	83 ec 0c             	sub    $0xc,%esp
+  801f16:	50                   	push   %eax
+  801f17:	e8 c4 f9 ff ff       	call   8018e0 <devfile_sync>
+  801f1c:	89 c3                	mov    %eax,%ebx
+  801f1e:	83 c4 10             	add    $0x10,%esp
+  801f21:	85 c0                	test   %eax,%eax
+  801f23:	78 50                	js     801f75 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801f25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f28:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f2b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801f30:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f33:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801f38:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f3b:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801f40:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f45:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f4a:	e8 ed f8 ff ff       	call   80183c <fsipc>
+  801f4f:	89 c3                	mov    %eax,%ebx
+  801f51:	85 c0                	test   %eax,%eax
+  801f53:	7e 20                	jle    801f75 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801f55:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801f58:	72 22                	jb     801f7c <readdir+0x96>
+  801f5a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f5f:	7f 1b                	jg     801f7c <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f61:	83 ec 04             	sub    $0x4,%esp
+  801f64:	50                   	push   %eax
+  801f65:	68 00 60 80 00       	push   $0x806000
+  801f6a:	ff 75 0c             	push   0xc(%ebp)
+  801f6d:	e8 f5 e9 ff ff       	call   800967 <memmove>
+	return r;
+  801f72:	83 c4 10             	add    $0x10,%esp
+}
+  801f75:	89 d8                	mov    %ebx,%eax
+  801f77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f7a:	c9                   	leave
+  801f7b:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801f7c:	68 0e 3d 80 00       	push   $0x803d0e
+  801f81:	68 2c 3c 80 00       	push   $0x803c2c
+  801f86:	68 86 01 00 00       	push   $0x186
+  801f8b:	68 fc 3c 80 00       	push   $0x803cfc
+  801f90:	e8 83 e1 ff ff       	call   800118 <_panic>
+		return -E_NOT_SUPP;
+  801f95:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801f9a:	eb d9                	jmp    801f75 <readdir+0x8f>
+
+00801f9c <munmap>:
+{
+  801f9c:	55                   	push   %ebp
+  801f9d:	89 e5                	mov    %esp,%ebp
+  801f9f:	56                   	push   %esi
+  801fa0:	53                   	push   %ebx
+  801fa1:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fa4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801fa7:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801fad:	75 41                	jne    801ff0 <munmap+0x54>
+  801faf:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801fb5:	77 39                	ja     801ff0 <munmap+0x54>
+  801fb7:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801fbc:	29 f0                	sub    %esi,%eax
+  801fbe:	39 d0                	cmp    %edx,%eax
+  801fc0:	72 35                	jb     801ff7 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801fc2:	89 f3                	mov    %esi,%ebx
+  801fc4:	01 d6                	add    %edx,%esi
+  801fc6:	39 f3                	cmp    %esi,%ebx
+  801fc8:	73 1a                	jae    801fe4 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801fca:	83 ec 08             	sub    $0x8,%esp
+  801fcd:	53                   	push   %ebx
+  801fce:	6a 00                	push   $0x0
+  801fd0:	e8 a5 ec ff ff       	call   800c7a <sys_page_unmap>
+  801fd5:	83 c4 10             	add    $0x10,%esp
+  801fd8:	85 c0                	test   %eax,%eax
+  801fda:	78 0d                	js     801fe9 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801fdc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801fe2:	eb e2                	jmp    801fc6 <munmap+0x2a>
+	return 0;
+  801fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fe9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fec:	5b                   	pop    %ebx
+  801fed:	5e                   	pop    %esi
+  801fee:	5d                   	pop    %ebp
+  801fef:	c3                   	ret
+		return -E_INVAL;
+  801ff0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ff5:	eb f2                	jmp    801fe9 <munmap+0x4d>
+  801ff7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ffc:	eb eb                	jmp    801fe9 <munmap+0x4d>
+
+00801ffe <mmap>:
+{
+  801ffe:	55                   	push   %ebp
+  801fff:	89 e5                	mov    %esp,%ebp
+  802001:	57                   	push   %edi
+  802002:	56                   	push   %esi
+  802003:	53                   	push   %ebx
+  802004:	83 ec 34             	sub    $0x34,%esp
+  802007:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80200a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80200d:	50                   	push   %eax
+  80200e:	ff 75 18             	push   0x18(%ebp)
+  802011:	e8 ee f0 ff ff       	call   801104 <fd_lookup>
+  802016:	89 c3                	mov    %eax,%ebx
+  802018:	83 c4 10             	add    $0x10,%esp
+  80201b:	85 c0                	test   %eax,%eax
+  80201d:	0f 88 0e 01 00 00    	js     802131 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802023:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802026:	a1 20 40 80 00       	mov    0x804020,%eax
+  80202b:	39 02                	cmp    %eax,(%edx)
+  80202d:	0f 85 50 01 00 00    	jne    802183 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802033:	8b 45 10             	mov    0x10(%ebp),%eax
+  802036:	83 e0 02             	and    $0x2,%eax
+  802039:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80203c:	74 0a                	je     802048 <mmap+0x4a>
+  80203e:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802042:	0f 84 42 01 00 00    	je     80218a <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802048:	8b 42 08             	mov    0x8(%edx),%eax
+  80204b:	83 e0 03             	and    $0x3,%eax
+  80204e:	83 f8 01             	cmp    $0x1,%eax
+  802051:	0f 84 3a 01 00 00    	je     802191 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802057:	8b 45 08             	mov    0x8(%ebp),%eax
+  80205a:	0b 45 1c             	or     0x1c(%ebp),%eax
+  80205d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802062:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802065:	0f 85 2d 01 00 00    	jne    802198 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80206b:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80206f:	0f 88 2a 01 00 00    	js     80219f <mmap+0x1a1>
+  802075:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80207c:	0f 87 1d 01 00 00    	ja     80219f <mmap+0x1a1>
+  802082:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802087:	2b 45 08             	sub    0x8(%ebp),%eax
+  80208a:	39 f8                	cmp    %edi,%eax
+  80208c:	0f 82 14 01 00 00    	jb     8021a6 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802092:	83 ec 0c             	sub    $0xc,%esp
+  802095:	52                   	push   %edx
+  802096:	e8 45 f8 ff ff       	call   8018e0 <devfile_sync>
+  80209b:	89 c3                	mov    %eax,%ebx
+  80209d:	83 c4 10             	add    $0x10,%esp
+  8020a0:	85 c0                	test   %eax,%eax
+  8020a2:	0f 88 89 00 00 00    	js     802131 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8020a8:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8020ae:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8020b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b9:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8020bc:	39 fe                	cmp    %edi,%esi
+  8020be:	73 7b                	jae    80213b <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8020c0:	89 f8                	mov    %edi,%eax
+  8020c2:	29 f0                	sub    %esi,%eax
+  8020c4:	c1 e8 0c             	shr    $0xc,%eax
+  8020c7:	ba 40 00 00 00       	mov    $0x40,%edx
+  8020cc:	39 d0                	cmp    %edx,%eax
+  8020ce:	0f 47 c2             	cmova  %edx,%eax
+  8020d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8020d4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8020d7:	8b 52 0c             	mov    0xc(%edx),%edx
+  8020da:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  8020e0:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8020e3:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  8020e9:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8020ee:	89 f2                	mov    %esi,%edx
+  8020f0:	03 55 08             	add    0x8(%ebp),%edx
+  8020f3:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8020f6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8020fb:	e8 ea f6 ff ff       	call   8017ea <fsipcv>
+  802100:	85 c0                	test   %eax,%eax
+  802102:	7e 12                	jle    802116 <mmap+0x118>
+  802104:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802107:	85 c0                	test   %eax,%eax
+  802109:	0f 84 9e 00 00 00    	je     8021ad <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80210f:	c1 e0 0c             	shl    $0xc,%eax
+  802112:	01 c6                	add    %eax,%esi
+  802114:	eb a6                	jmp    8020bc <mmap+0xbe>
+			munmap(addr, done);
+  802116:	89 c3                	mov    %eax,%ebx
+  802118:	83 ec 08             	sub    $0x8,%esp
+  80211b:	56                   	push   %esi
+  80211c:	ff 75 08             	push   0x8(%ebp)
+  80211f:	e8 78 fe ff ff       	call   801f9c <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802124:	83 c4 10             	add    $0x10,%esp
+  802127:	85 db                	test   %ebx,%ebx
+  802129:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80212e:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802131:	89 d8                	mov    %ebx,%eax
+  802133:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802136:	5b                   	pop    %ebx
+  802137:	5e                   	pop    %esi
+  802138:	5f                   	pop    %edi
+  802139:	5d                   	pop    %ebp
+  80213a:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80213b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80213e:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802140:	85 c0                	test   %eax,%eax
+  802142:	74 ed                	je     802131 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802144:	be 00 00 00 00       	mov    $0x0,%esi
+  802149:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80214c:	39 fe                	cmp    %edi,%esi
+  80214e:	73 2e                	jae    80217e <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802150:	83 ec 0c             	sub    $0xc,%esp
+  802153:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802156:	50                   	push   %eax
+  802157:	e8 fd 0f 00 00       	call   803159 <cowpage>
+  80215c:	83 c4 10             	add    $0x10,%esp
+  80215f:	85 c0                	test   %eax,%eax
+  802161:	78 08                	js     80216b <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802163:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802169:	eb e1                	jmp    80214c <mmap+0x14e>
+				munmap(addr, len);
+  80216b:	89 c3                	mov    %eax,%ebx
+  80216d:	83 ec 08             	sub    $0x8,%esp
+  802170:	57                   	push   %edi
+  802171:	ff 75 08             	push   0x8(%ebp)
+  802174:	e8 23 fe ff ff       	call   801f9c <munmap>
+				return r;
+  802179:	83 c4 10             	add    $0x10,%esp
+  80217c:	eb b3                	jmp    802131 <mmap+0x133>
+	return 0;
+  80217e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802181:	eb ae                	jmp    802131 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802183:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802188:	eb a7                	jmp    802131 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80218a:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80218f:	eb a0                	jmp    802131 <mmap+0x133>
+		return -E_INVAL;
+  802191:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802196:	eb 99                	jmp    802131 <mmap+0x133>
+  802198:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80219d:	eb 92                	jmp    802131 <mmap+0x133>
+  80219f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021a4:	eb 8b                	jmp    802131 <mmap+0x133>
+  8021a6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021ab:	eb 84                	jmp    802131 <mmap+0x133>
+			munmap(addr, done);
+  8021ad:	83 ec 08             	sub    $0x8,%esp
+  8021b0:	56                   	push   %esi
+  8021b1:	ff 75 08             	push   0x8(%ebp)
+  8021b4:	e8 e3 fd ff ff       	call   801f9c <munmap>
+  8021b9:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8021bc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021c1:	e9 6b ff ff ff       	jmp    802131 <mmap+0x133>
+
+008021c6 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8021c6:	55                   	push   %ebp
+  8021c7:	89 e5                	mov    %esp,%ebp
+  8021c9:	56                   	push   %esi
+  8021ca:	53                   	push   %ebx
+  8021cb:	83 ec 10             	sub    $0x10,%esp
+  8021ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8021d1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d7:	e8 3d f9 ff ff       	call   801b19 <fsring_slot>
+  8021dc:	85 c0                	test   %eax,%eax
+  8021de:	78 60                	js     802240 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8021e0:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8021e3:	8b 56 08             	mov    0x8(%esi),%edx
+  8021e6:	83 e2 03             	and    $0x3,%edx
+  8021e9:	83 fa 01             	cmp    $0x1,%edx
+  8021ec:	74 59                	je     802247 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8021ee:	ba 01 00 00 00       	mov    $0x1,%edx
+  8021f3:	89 c1                	mov    %eax,%ecx
+  8021f5:	d3 e2                	shl    %cl,%edx
+  8021f7:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8021fd:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802200:	c1 e2 02             	shl    $0x2,%edx
+  802203:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  802209:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  802210:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802213:	8b 55 18             	mov    0x18(%ebp),%edx
+  802216:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802219:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80221c:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80221f:	83 ec 08             	sub    $0x8,%esp
+  802222:	50                   	push   %eax
+  802223:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802228:	39 c3                	cmp    %eax,%ebx
+  80222a:	0f 47 d8             	cmova  %eax,%ebx
+  80222d:	53                   	push   %ebx
+  80222e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802231:	89 f2                	mov    %esi,%edx
+  802233:	b8 03 00 00 00       	mov    $0x3,%eax
+  802238:	e8 1e f5 ff ff       	call   80175b <fsring_post>
+  80223d:	83 c4 10             	add    $0x10,%esp
+}
+  802240:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802243:	5b                   	pop    %ebx
+  802244:	5e                   	pop    %esi
+  802245:	5d                   	pop    %ebp
+  802246:	c3                   	ret
+		return -E_INVAL;
+  802247:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80224c:	eb f2                	jmp    802240 <fsring_read+0x7a>
+
+0080224e <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80224e:	55                   	push   %ebp
+  80224f:	89 e5                	mov    %esp,%ebp
+  802251:	56                   	push   %esi
+  802252:	53                   	push   %ebx
+  802253:	83 ec 10             	sub    $0x10,%esp
+  802256:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802259:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80225c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80225f:	e8 b5 f8 ff ff       	call   801b19 <fsring_slot>
+  802264:	89 c3                	mov    %eax,%ebx
+  802266:	85 c0                	test   %eax,%eax
+  802268:	78 77                	js     8022e1 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80226a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80226d:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802271:	74 77                	je     8022ea <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802273:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802278:	39 c6                	cmp    %eax,%esi
+  80227a:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80227d:	83 ec 04             	sub    $0x4,%esp
+  802280:	56                   	push   %esi
+  802281:	ff 75 0c             	push   0xc(%ebp)
+  802284:	89 d8                	mov    %ebx,%eax
+  802286:	c1 e0 0c             	shl    $0xc,%eax
+  802289:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80228f:	50                   	push   %eax
+  802290:	e8 d2 e6 ff ff       	call   800967 <memmove>
+	fsring_busy |= 1 << slot;
+  802295:	b8 01 00 00 00       	mov    $0x1,%eax
+  80229a:	89 d9                	mov    %ebx,%ecx
+  80229c:	d3 e0                	shl    %cl,%eax
+  80229e:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8022a4:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8022a7:	c1 e0 02             	shl    $0x2,%eax
+  8022aa:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8022b0:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8022b7:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8022ba:	8b 45 18             	mov    0x18(%ebp),%eax
+  8022bd:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8022c0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8022c7:	83 c4 08             	add    $0x8,%esp
+  8022ca:	53                   	push   %ebx
+  8022cb:	56                   	push   %esi
+  8022cc:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8022cf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022d2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022d7:	e8 7f f4 ff ff       	call   80175b <fsring_post>
+  8022dc:	89 c3                	mov    %eax,%ebx
+  8022de:	83 c4 10             	add    $0x10,%esp
+}
+  8022e1:	89 d8                	mov    %ebx,%eax
+  8022e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022e6:	5b                   	pop    %ebx
+  8022e7:	5e                   	pop    %esi
+  8022e8:	5d                   	pop    %ebp
+  8022e9:	c3                   	ret
+		return -E_INVAL;
+  8022ea:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8022ef:	eb f0                	jmp    8022e1 <fsring_write+0x93>
+
+008022f1 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8022f1:	55                   	push   %ebp
+  8022f2:	89 e5                	mov    %esp,%ebp
+  8022f4:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8022f7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8022fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022fd:	e8 17 f8 ff ff       	call   801b19 <fsring_slot>
+  802302:	85 c0                	test   %eax,%eax
+  802304:	78 4c                	js     802352 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802306:	ba 01 00 00 00       	mov    $0x1,%edx
+  80230b:	89 c1                	mov    %eax,%ecx
+  80230d:	d3 e2                	shl    %cl,%edx
+  80230f:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802315:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802318:	c1 e2 02             	shl    $0x2,%edx
+  80231b:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  802321:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  802328:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80232b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80232e:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802331:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802334:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802337:	83 ec 08             	sub    $0x8,%esp
+  80233a:	50                   	push   %eax
+  80233b:	6a 00                	push   $0x0
+  80233d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802342:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802345:	b8 05 00 00 00       	mov    $0x5,%eax
+  80234a:	e8 0c f4 ff ff       	call   80175b <fsring_post>
+  80234f:	83 c4 10             	add    $0x10,%esp
+}
+  802352:	c9                   	leave
+  802353:	c3                   	ret
+
+00802354 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802354:	55                   	push   %ebp
+  802355:	89 e5                	mov    %esp,%ebp
+  802357:	57                   	push   %edi
+  802358:	56                   	push   %esi
+  802359:	53                   	push   %ebx
+  80235a:	83 ec 1c             	sub    $0x1c,%esp
+  80235d:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802361:	a1 00 50 80 00       	mov    0x805000,%eax
+  802366:	8b 40 48             	mov    0x48(%eax),%eax
+  802369:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  80236f:	74 12                	je     802383 <fsring_reap+0x2f>
+		return 0;
+  802371:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802376:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802379:	5b                   	pop    %ebx
+  80237a:	5e                   	pop    %esi
+  80237b:	5f                   	pop    %edi
+  80237c:	5d                   	pop    %ebp
+  80237d:	c3                   	ret
+		sys_yield();
+  80237e:	e8 4b e8 ff ff       	call   800bce <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802383:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802389:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80238e:	39 c2                	cmp    %eax,%edx
+  802390:	75 18                	jne    8023aa <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802392:	84 db                	test   %bl,%bl
+  802394:	0f 84 21 01 00 00    	je     8024bb <fsring_reap+0x167>
+  80239a:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  8023a1:	75 db                	jne    80237e <fsring_reap+0x2a>
+			return 0;
+  8023a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a8:	eb cc                	jmp    802376 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8023aa:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8023af:	83 e0 0f             	and    $0xf,%eax
+  8023b2:	83 c0 2a             	add    $0x2a,%eax
+  8023b5:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8023bc:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8023c3:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8023c8:	83 c0 01             	add    $0x1,%eax
+  8023cb:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8023d0:	83 fb 0f             	cmp    $0xf,%ebx
+  8023d3:	77 5b                	ja     802430 <fsring_reap+0xdc>
+  8023d5:	be 01 00 00 00       	mov    $0x1,%esi
+  8023da:	89 d9                	mov    %ebx,%ecx
+  8023dc:	d3 e6                	shl    %cl,%esi
+  8023de:	89 f0                	mov    %esi,%eax
+  8023e0:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8023e6:	74 48                	je     802430 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8023e8:	89 d8                	mov    %ebx,%eax
+  8023ea:	c1 e0 0c             	shl    $0xc,%eax
+  8023ed:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8023f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8023f6:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8023f9:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  802400:	83 f8 03             	cmp    $0x3,%eax
+  802403:	74 40                	je     802445 <fsring_reap+0xf1>
+  802405:	83 f8 05             	cmp    $0x5,%eax
+  802408:	74 64                	je     80246e <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  80240a:	f7 d6                	not    %esi
+  80240c:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802412:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802415:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  80241c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80241f:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802421:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802424:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802426:	b8 01 00 00 00       	mov    $0x1,%eax
+  80242b:	e9 46 ff ff ff       	jmp    802376 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802430:	53                   	push   %ebx
+  802431:	68 24 3d 80 00       	push   $0x803d24
+  802436:	68 8f 02 00 00       	push   $0x28f
+  80243b:	68 fc 3c 80 00       	push   $0x803cfc
+  802440:	e8 d3 dc ff ff       	call   800118 <_panic>
+		if (cqe.cqe_result > 0)
+  802445:	85 ff                	test   %edi,%edi
+  802447:	7e c1                	jle    80240a <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802449:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80244c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802451:	39 c7                	cmp    %eax,%edi
+  802453:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802456:	50                   	push   %eax
+  802457:	ff 75 e4             	push   -0x1c(%ebp)
+  80245a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80245d:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  802464:	e8 fe e4 ff ff       	call   800967 <memmove>
+  802469:	83 c4 10             	add    $0x10,%esp
+  80246c:	eb 9c                	jmp    80240a <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80246e:	85 ff                	test   %edi,%edi
+  802470:	75 98                	jne    80240a <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802472:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802475:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80247c:	83 ec 08             	sub    $0x8,%esp
+  80247f:	ff 75 e4             	push   -0x1c(%ebp)
+  802482:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802485:	51                   	push   %ecx
+  802486:	e8 56 e3 ff ff       	call   8007e1 <strcpy>
+			st->st_size = ret->ret_size;
+  80248b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80248e:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802494:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802497:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80249d:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8024a3:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8024a9:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8024b0:	40 80 00 
+  8024b3:	83 c4 10             	add    $0x10,%esp
+  8024b6:	e9 4f ff ff ff       	jmp    80240a <fsring_reap+0xb6>
+			return 0;
+  8024bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c0:	e9 b1 fe ff ff       	jmp    802376 <fsring_reap+0x22>
+
+008024c5 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8024c5:	55                   	push   %ebp
+  8024c6:	89 e5                	mov    %esp,%ebp
+  8024c8:	57                   	push   %edi
+  8024c9:	56                   	push   %esi
+  8024ca:	53                   	push   %ebx
+  8024cb:	83 ec 28             	sub    $0x28,%esp
+  8024ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8024d1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8024d4:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8024d7:	53                   	push   %ebx
+  8024d8:	e8 c9 e2 ff ff       	call   8007a6 <strlen>
+  8024dd:	83 c4 10             	add    $0x10,%esp
+  8024e0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024e5:	0f 8f 02 01 00 00    	jg     8025ed <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8024eb:	83 ec 08             	sub    $0x8,%esp
+  8024ee:	53                   	push   %ebx
+  8024ef:	68 00 60 80 00       	push   $0x806000
+  8024f4:	e8 e8 e2 ff ff       	call   8007e1 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8024f9:	83 c4 10             	add    $0x10,%esp
+  8024fc:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802502:	76 69                	jbe    80256d <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802504:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802507:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80250d:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802512:	29 d1                	sub    %edx,%ecx
+  802514:	39 f9                	cmp    %edi,%ecx
+  802516:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802519:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80251c:	89 f9                	mov    %edi,%ecx
+  80251e:	01 c1                	add    %eax,%ecx
+  802520:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802523:	eb 0f                	jmp    802534 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802525:	0f b6 10             	movzbl (%eax),%edx
+  802528:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80252a:	05 00 10 00 00       	add    $0x1000,%eax
+  80252f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802534:	39 c8                	cmp    %ecx,%eax
+  802536:	72 ed                	jb     802525 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802538:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80253b:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802541:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802547:	83 ec 0c             	sub    $0xc,%esp
+  80254a:	6a 07                	push   $0x7
+  80254c:	89 f9                	mov    %edi,%ecx
+  80254e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802551:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802556:	e8 3f f1 ff ff       	call   80169a <fsipc_pages>
+  80255b:	89 c7                	mov    %eax,%edi
+  80255d:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802560:	85 f6                	test   %esi,%esi
+  802562:	74 7f                	je     8025e3 <file_slurp+0x11e>
+  802564:	8d 43 01             	lea    0x1(%ebx),%eax
+  802567:	85 ff                	test   %edi,%edi
+  802569:	79 3c                	jns    8025a7 <file_slurp+0xe2>
+  80256b:	eb 76                	jmp    8025e3 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  80256d:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802573:	ba 00 00 00 00       	mov    $0x0,%edx
+  802578:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80257d:	e8 ba f2 ff ff       	call   80183c <fsipc>
+  802582:	89 c7                	mov    %eax,%edi
+  802584:	85 c0                	test   %eax,%eax
+  802586:	7e d8                	jle    802560 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802588:	83 ec 04             	sub    $0x4,%esp
+  80258b:	50                   	push   %eax
+  80258c:	68 08 60 80 00       	push   $0x806008
+  802591:	ff 75 0c             	push   0xc(%ebp)
+  802594:	e8 ce e3 ff ff       	call   800967 <memmove>
+  802599:	83 c4 10             	add    $0x10,%esp
+  80259c:	eb c2                	jmp    802560 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  80259e:	80 fa 2f             	cmp    $0x2f,%dl
+  8025a1:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8025a4:	83 c0 01             	add    $0x1,%eax
+  8025a7:	89 c1                	mov    %eax,%ecx
+  8025a9:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8025ad:	84 d2                	test   %dl,%dl
+  8025af:	75 ed                	jne    80259e <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8025b1:	83 ec 04             	sub    $0x4,%esp
+  8025b4:	68 80 00 00 00       	push   $0x80
+  8025b9:	53                   	push   %ebx
+  8025ba:	56                   	push   %esi
+  8025bb:	e8 97 e2 ff ff       	call   800857 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8025c0:	a1 00 60 80 00       	mov    0x806000,%eax
+  8025c5:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8025cb:	a1 04 60 80 00       	mov    0x806004,%eax
+  8025d0:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8025d6:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  8025dd:	40 80 00 
+  8025e0:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8025e3:	89 f8                	mov    %edi,%eax
+  8025e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025e8:	5b                   	pop    %ebx
+  8025e9:	5e                   	pop    %esi
+  8025ea:	5f                   	pop    %edi
+  8025eb:	5d                   	pop    %ebp
+  8025ec:	c3                   	ret
+		return -E_BAD_PATH;
+  8025ed:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8025f2:	eb ef                	jmp    8025e3 <file_slurp+0x11e>
+
+008025f4 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8025f4:	55                   	push   %ebp
+  8025f5:	89 e5                	mov    %esp,%ebp
+  8025f7:	53                   	push   %ebx
+  8025f8:	83 ec 10             	sub    $0x10,%esp
+  8025fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8025fe:	53                   	push   %ebx
+  8025ff:	e8 a2 e1 ff ff       	call   8007a6 <strlen>
+  802604:	83 c4 10             	add    $0x10,%esp
+  802607:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80260c:	7f 25                	jg     802633 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80260e:	83 ec 08             	sub    $0x8,%esp
+  802611:	53                   	push   %ebx
+  802612:	68 00 60 80 00       	push   $0x806000
+  802617:	e8 c5 e1 ff ff       	call   8007e1 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80261c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802621:	b8 07 00 00 00       	mov    $0x7,%eax
+  802626:	e8 11 f2 ff ff       	call   80183c <fsipc>
+  80262b:	83 c4 10             	add    $0x10,%esp
+}
+  80262e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802631:	c9                   	leave
+  802632:	c3                   	ret
+		return -E_BAD_PATH;
+  802633:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802638:	eb f4                	jmp    80262e <remove+0x3a>
+
+0080263a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80263a:	55                   	push   %ebp
+  80263b:	89 e5                	mov    %esp,%ebp
+  80263d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802640:	ba 00 00 00 00       	mov    $0x0,%edx
+  802645:	b8 08 00 00 00       	mov    $0x8,%eax
+  80264a:	e8 ed f1 ff ff       	call   80183c <fsipc>
+}
+  80264f:	c9                   	leave
+  802650:	c3                   	ret
+
+00802651 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802651:	55                   	push   %ebp
+  802652:	89 e5                	mov    %esp,%ebp
+  802654:	57                   	push   %edi
+  802655:	56                   	push   %esi
+  802656:	53                   	push   %ebx
+  802657:	83 ec 18             	sub    $0x18,%esp
+  80265a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80265d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802660:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802663:	57                   	push   %edi
+  802664:	e8 3d e1 ff ff       	call   8007a6 <strlen>
+  802669:	83 c4 10             	add    $0x10,%esp
+  80266c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802671:	7f 4c                	jg     8026bf <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802673:	83 ec 08             	sub    $0x8,%esp
+  802676:	57                   	push   %edi
+  802677:	68 00 60 80 00       	push   $0x806000
+  80267c:	e8 60 e1 ff ff       	call   8007e1 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802681:	ba 00 00 00 00       	mov    $0x0,%edx
+  802686:	b8 10 00 00 00       	mov    $0x10,%eax
+  80268b:	e8 ac f1 ff ff       	call   80183c <fsipc>
+  802690:	83 c4 10             	add    $0x10,%esp
+  802693:	85 c0                	test   %eax,%eax
+  802695:	78 20                	js     8026b7 <defrag+0x66>
+		return r;
+	if (before)
+  802697:	85 f6                	test   %esi,%esi
+  802699:	74 07                	je     8026a2 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  80269b:	a1 00 60 80 00       	mov    0x806000,%eax
+  8026a0:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  8026a2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  8026a7:	85 db                	test   %ebx,%ebx
+  8026a9:	74 0c                	je     8026b7 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  8026ab:	a1 04 60 80 00       	mov    0x806004,%eax
+  8026b0:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8026b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026ba:	5b                   	pop    %ebx
+  8026bb:	5e                   	pop    %esi
+  8026bc:	5f                   	pop    %edi
+  8026bd:	5d                   	pop    %ebp
+  8026be:	c3                   	ret
+		return -E_BAD_PATH;
+  8026bf:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8026c4:	eb f1                	jmp    8026b7 <defrag+0x66>
+
+008026c6 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  8026c6:	55                   	push   %ebp
+  8026c7:	89 e5                	mov    %esp,%ebp
+  8026c9:	53                   	push   %ebx
+  8026ca:	83 ec 04             	sub    $0x4,%esp
+  8026cd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  8026d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026d5:	b8 11 00 00 00       	mov    $0x11,%eax
+  8026da:	e8 5d f1 ff ff       	call   80183c <fsipc>
+  8026df:	85 c0                	test   %eax,%eax
+  8026e1:	78 34                	js     802717 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  8026e3:	a1 00 60 80 00       	mov    0x806000,%eax
+  8026e8:	89 03                	mov    %eax,(%ebx)
+  8026ea:	a1 04 60 80 00       	mov    0x806004,%eax
+  8026ef:	89 43 04             	mov    %eax,0x4(%ebx)
+  8026f2:	a1 08 60 80 00       	mov    0x806008,%eax
+  8026f7:	89 43 08             	mov    %eax,0x8(%ebx)
+  8026fa:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  8026ff:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802702:	a1 10 60 80 00       	mov    0x806010,%eax
+  802707:	89 43 10             	mov    %eax,0x10(%ebx)
+  80270a:	a1 14 60 80 00       	mov    0x806014,%eax
+  80270f:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802712:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802717:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80271a:	c9                   	leave
+  80271b:	c3                   	ret
+
+0080271c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80271c:	55                   	push   %ebp
+  80271d:	89 e5                	mov    %esp,%ebp
+  80271f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802722:	68 3d 3d 80 00       	push   $0x803d3d
+  802727:	ff 75 0c             	push   0xc(%ebp)
+  80272a:	e8 b2 e0 ff ff       	call   8007e1 <strcpy>
+	return 0;
+}
+  80272f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802734:	c9                   	leave
+  802735:	c3                   	ret
+
+00802736 <devsock_close>:
+{
+  802736:	55                   	push   %ebp
+  802737:	89 e5                	mov    %esp,%ebp
+  802739:	53                   	push   %ebx
+  80273a:	83 ec 10             	sub    $0x10,%esp
+  80273d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802740:	53                   	push   %ebx
+  802741:	e8 f4 0d 00 00       	call   80353a <pageref>
+  802746:	89 c2                	mov    %eax,%edx
+  802748:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80274b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802750:	83 fa 01             	cmp    $0x1,%edx
+  802753:	74 05                	je     80275a <devsock_close+0x24>
+}
+  802755:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802758:	c9                   	leave
+  802759:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80275a:	83 ec 0c             	sub    $0xc,%esp
+  80275d:	ff 73 0c             	push   0xc(%ebx)
+  802760:	e8 b7 02 00 00       	call   802a1c <nsipc_close>
+  802765:	83 c4 10             	add    $0x10,%esp
+  802768:	eb eb                	jmp    802755 <devsock_close+0x1f>
+
+0080276a <devsock_write>:
+{
+  80276a:	55                   	push   %ebp
+  80276b:	89 e5                	mov    %esp,%ebp
+  80276d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802770:	6a 00                	push   $0x0
+  802772:	ff 75 10             	push   0x10(%ebp)
+  802775:	ff 75 0c             	push   0xc(%ebp)
+  802778:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277b:	ff 70 0c             	push   0xc(%eax)
+  80277e:	e8 79 03 00 00       	call   802afc <nsipc_send>
+}
+  802783:	c9                   	leave
+  802784:	c3                   	ret
+
+00802785 <devsock_read>:
+{
+  802785:	55                   	push   %ebp
+  802786:	89 e5                	mov    %esp,%ebp
+  802788:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80278b:	6a 00                	push   $0x0
+  80278d:	ff 75 10             	push   0x10(%ebp)
+  802790:	ff 75 0c             	push   0xc(%ebp)
+  802793:	8b 45 08             	mov    0x8(%ebp),%eax
+  802796:	ff 70 0c             	push   0xc(%eax)
+  802799:	e8 ef 02 00 00       	call   802a8d <nsipc_recv>
+}
+  80279e:	c9                   	leave
+  80279f:	c3                   	ret
+
+008027a0 <fd2sockid>:
+{
+  8027a0:	55                   	push   %ebp
+  8027a1:	89 e5                	mov    %esp,%ebp
+  8027a3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8027a6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027a9:	52                   	push   %edx
+  8027aa:	50                   	push   %eax
+  8027ab:	e8 54 e9 ff ff       	call   801104 <fd_lookup>
+  8027b0:	83 c4 10             	add    $0x10,%esp
+  8027b3:	85 c0                	test   %eax,%eax
+  8027b5:	78 10                	js     8027c7 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8027b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027ba:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  8027c0:	39 08                	cmp    %ecx,(%eax)
+  8027c2:	75 05                	jne    8027c9 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8027c4:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8027c7:	c9                   	leave
+  8027c8:	c3                   	ret
+		return -E_NOT_SUPP;
+  8027c9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027ce:	eb f7                	jmp    8027c7 <fd2sockid+0x27>
+
+008027d0 <alloc_sockfd>:
+{
+  8027d0:	55                   	push   %ebp
+  8027d1:	89 e5                	mov    %esp,%ebp
+  8027d3:	56                   	push   %esi
+  8027d4:	53                   	push   %ebx
+  8027d5:	83 ec 1c             	sub    $0x1c,%esp
+  8027d8:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8027da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027dd:	50                   	push   %eax
+  8027de:	e8 cb e8 ff ff       	call   8010ae <fd_alloc>
+  8027e3:	89 c3                	mov    %eax,%ebx
+  8027e5:	83 c4 10             	add    $0x10,%esp
+  8027e8:	85 c0                	test   %eax,%eax
+  8027ea:	78 43                	js     80282f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8027ec:	83 ec 04             	sub    $0x4,%esp
+  8027ef:	68 07 04 00 00       	push   $0x407
+  8027f4:	ff 75 f4             	push   -0xc(%ebp)
+  8027f7:	6a 00                	push   $0x0
+  8027f9:	e8 ef e3 ff ff       	call   800bed <sys_page_alloc>
+  8027fe:	89 c3                	mov    %eax,%ebx
+  802800:	83 c4 10             	add    $0x10,%esp
+  802803:	85 c0                	test   %eax,%eax
+  802805:	78 28                	js     80282f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802807:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80280a:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802810:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802812:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802815:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80281c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80281f:	83 ec 0c             	sub    $0xc,%esp
+  802822:	50                   	push   %eax
+  802823:	e8 5f e8 ff ff       	call   801087 <fd2num>
+  802828:	89 c3                	mov    %eax,%ebx
+  80282a:	83 c4 10             	add    $0x10,%esp
+  80282d:	eb 0c                	jmp    80283b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80282f:	83 ec 0c             	sub    $0xc,%esp
+  802832:	56                   	push   %esi
+  802833:	e8 e4 01 00 00       	call   802a1c <nsipc_close>
+		return r;
+  802838:	83 c4 10             	add    $0x10,%esp
+}
+  80283b:	89 d8                	mov    %ebx,%eax
+  80283d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802840:	5b                   	pop    %ebx
+  802841:	5e                   	pop    %esi
+  802842:	5d                   	pop    %ebp
+  802843:	c3                   	ret
+
+00802844 <accept>:
+{
+  802844:	55                   	push   %ebp
+  802845:	89 e5                	mov    %esp,%ebp
+  802847:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80284a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80284d:	e8 4e ff ff ff       	call   8027a0 <fd2sockid>
+  802852:	85 c0                	test   %eax,%eax
+  802854:	78 1b                	js     802871 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802856:	83 ec 04             	sub    $0x4,%esp
+  802859:	ff 75 10             	push   0x10(%ebp)
+  80285c:	ff 75 0c             	push   0xc(%ebp)
+  80285f:	50                   	push   %eax
+  802860:	e8 0e 01 00 00       	call   802973 <nsipc_accept>
+  802865:	83 c4 10             	add    $0x10,%esp
+  802868:	85 c0                	test   %eax,%eax
+  80286a:	78 05                	js     802871 <accept+0x2d>
+	return alloc_sockfd(r);
+  80286c:	e8 5f ff ff ff       	call   8027d0 <alloc_sockfd>
+}
+  802871:	c9                   	leave
+  802872:	c3                   	ret
+
+00802873 <bind>:
+{
+  802873:	55                   	push   %ebp
+  802874:	89 e5                	mov    %esp,%ebp
+  802876:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802879:	8b 45 08             	mov    0x8(%ebp),%eax
+  80287c:	e8 1f ff ff ff       	call   8027a0 <fd2sockid>
+  802881:	85 c0                	test   %eax,%eax
+  802883:	78 12                	js     802897 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802885:	83 ec 04             	sub    $0x4,%esp
+  802888:	ff 75 10             	push   0x10(%ebp)
+  80288b:	ff 75 0c             	push   0xc(%ebp)
+  80288e:	50                   	push   %eax
+  80288f:	e8 31 01 00 00       	call   8029c5 <nsipc_bind>
+  802894:	83 c4 10             	add    $0x10,%esp
+}
+  802897:	c9                   	leave
+  802898:	c3                   	ret
+
+00802899 <shutdown>:
+{
+  802899:	55                   	push   %ebp
+  80289a:	89 e5                	mov    %esp,%ebp
+  80289c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80289f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a2:	e8 f9 fe ff ff       	call   8027a0 <fd2sockid>
+  8028a7:	85 c0                	test   %eax,%eax
+  8028a9:	78 0f                	js     8028ba <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8028ab:	83 ec 08             	sub    $0x8,%esp
+  8028ae:	ff 75 0c             	push   0xc(%ebp)
+  8028b1:	50                   	push   %eax
+  8028b2:	e8 43 01 00 00       	call   8029fa <nsipc_shutdown>
+  8028b7:	83 c4 10             	add    $0x10,%esp
+}
+  8028ba:	c9                   	leave
+  8028bb:	c3                   	ret
+
+008028bc <connect>:
+{
+  8028bc:	55                   	push   %ebp
+  8028bd:	89 e5                	mov    %esp,%ebp
+  8028bf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028c5:	e8 d6 fe ff ff       	call   8027a0 <fd2sockid>
+  8028ca:	85 c0                	test   %eax,%eax
+  8028cc:	78 12                	js     8028e0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8028ce:	83 ec 04             	sub    $0x4,%esp
+  8028d1:	ff 75 10             	push   0x10(%ebp)
+  8028d4:	ff 75 0c             	push   0xc(%ebp)
+  8028d7:	50                   	push   %eax
+  8028d8:	e8 59 01 00 00       	call   802a36 <nsipc_connect>
+  8028dd:	83 c4 10             	add    $0x10,%esp
+}
+  8028e0:	c9                   	leave
+  8028e1:	c3                   	ret
+
+008028e2 <listen>:
+{
+  8028e2:	55                   	push   %ebp
+  8028e3:	89 e5                	mov    %esp,%ebp
+  8028e5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028eb:	e8 b0 fe ff ff       	call   8027a0 <fd2sockid>
+  8028f0:	85 c0                	test   %eax,%eax
+  8028f2:	78 0f                	js     802903 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8028f4:	83 ec 08             	sub    $0x8,%esp
+  8028f7:	ff 75 0c             	push   0xc(%ebp)
+  8028fa:	50                   	push   %eax
+  8028fb:	e8 6b 01 00 00       	call   802a6b <nsipc_listen>
+  802900:	83 c4 10             	add    $0x10,%esp
+}
+  802903:	c9                   	leave
+  802904:	c3                   	ret
+
+00802905 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802905:	55                   	push   %ebp
+  802906:	89 e5                	mov    %esp,%ebp
+  802908:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80290b:	ff 75 10             	push   0x10(%ebp)
+  80290e:	ff 75 0c             	push   0xc(%ebp)
+  802911:	ff 75 08             	push   0x8(%ebp)
+  802914:	e8 41 02 00 00       	call   802b5a <nsipc_socket>
+  802919:	83 c4 10             	add    $0x10,%esp
+  80291c:	85 c0                	test   %eax,%eax
+  80291e:	78 05                	js     802925 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802920:	e8 ab fe ff ff       	call   8027d0 <alloc_sockfd>
+}
+  802925:	c9                   	leave
+  802926:	c3                   	ret
+
+00802927 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802927:	55                   	push   %ebp
+  802928:	89 e5                	mov    %esp,%ebp
+  80292a:	53                   	push   %ebx
+  80292b:	83 ec 04             	sub    $0x4,%esp
+  80292e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802930:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802937:	74 26                	je     80295f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802939:	6a 07                	push   $0x7
+  80293b:	68 00 80 80 00       	push   $0x808000
+  802940:	53                   	push   %ebx
+  802941:	ff 35 00 90 80 00    	push   0x809000
+  802947:	e8 76 0a 00 00       	call   8033c2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80294c:	83 c4 0c             	add    $0xc,%esp
+  80294f:	6a 00                	push   $0x0
+  802951:	6a 00                	push   $0x0
+  802953:	6a 00                	push   $0x0
+  802955:	e8 fd 09 00 00       	call   803357 <ipc_recv>
+}
+  80295a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80295d:	c9                   	leave
+  80295e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80295f:	83 ec 0c             	sub    $0xc,%esp
+  802962:	6a 02                	push   $0x2
+  802964:	e8 92 0b 00 00       	call   8034fb <ipc_find_env>
+  802969:	a3 00 90 80 00       	mov    %eax,0x809000
+  80296e:	83 c4 10             	add    $0x10,%esp
+  802971:	eb c6                	jmp    802939 <nsipc+0x12>
+
+00802973 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802973:	55                   	push   %ebp
+  802974:	89 e5                	mov    %esp,%ebp
+  802976:	56                   	push   %esi
+  802977:	53                   	push   %ebx
+  802978:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80297b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80297e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802983:	8b 06                	mov    (%esi),%eax
+  802985:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80298a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80298f:	e8 93 ff ff ff       	call   802927 <nsipc>
+  802994:	89 c3                	mov    %eax,%ebx
+  802996:	85 c0                	test   %eax,%eax
+  802998:	79 09                	jns    8029a3 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80299a:	89 d8                	mov    %ebx,%eax
+  80299c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80299f:	5b                   	pop    %ebx
+  8029a0:	5e                   	pop    %esi
+  8029a1:	5d                   	pop    %ebp
+  8029a2:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8029a3:	83 ec 04             	sub    $0x4,%esp
+  8029a6:	ff 35 10 80 80 00    	push   0x808010
+  8029ac:	68 00 80 80 00       	push   $0x808000
+  8029b1:	ff 75 0c             	push   0xc(%ebp)
+  8029b4:	e8 ae df ff ff       	call   800967 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8029b9:	a1 10 80 80 00       	mov    0x808010,%eax
+  8029be:	89 06                	mov    %eax,(%esi)
+  8029c0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8029c3:	eb d5                	jmp    80299a <nsipc_accept+0x27>
+
+008029c5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8029c5:	55                   	push   %ebp
+  8029c6:	89 e5                	mov    %esp,%ebp
+  8029c8:	53                   	push   %ebx
+  8029c9:	83 ec 08             	sub    $0x8,%esp
+  8029cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8029cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029d2:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8029d7:	53                   	push   %ebx
+  8029d8:	ff 75 0c             	push   0xc(%ebp)
+  8029db:	68 04 80 80 00       	push   $0x808004
+  8029e0:	e8 82 df ff ff       	call   800967 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8029e5:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8029eb:	b8 02 00 00 00       	mov    $0x2,%eax
+  8029f0:	e8 32 ff ff ff       	call   802927 <nsipc>
+}
+  8029f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029f8:	c9                   	leave
+  8029f9:	c3                   	ret
+
+008029fa <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8029fa:	55                   	push   %ebp
+  8029fb:	89 e5                	mov    %esp,%ebp
+  8029fd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802a00:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a03:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802a08:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a0b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802a10:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a15:	e8 0d ff ff ff       	call   802927 <nsipc>
+}
+  802a1a:	c9                   	leave
+  802a1b:	c3                   	ret
+
+00802a1c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802a1c:	55                   	push   %ebp
+  802a1d:	89 e5                	mov    %esp,%ebp
+  802a1f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802a22:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a25:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802a2a:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a2f:	e8 f3 fe ff ff       	call   802927 <nsipc>
+}
+  802a34:	c9                   	leave
+  802a35:	c3                   	ret
+
+00802a36 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802a36:	55                   	push   %ebp
+  802a37:	89 e5                	mov    %esp,%ebp
+  802a39:	53                   	push   %ebx
+  802a3a:	83 ec 08             	sub    $0x8,%esp
+  802a3d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802a40:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a43:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802a48:	53                   	push   %ebx
+  802a49:	ff 75 0c             	push   0xc(%ebp)
+  802a4c:	68 04 80 80 00       	push   $0x808004
+  802a51:	e8 11 df ff ff       	call   800967 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802a56:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802a5c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a61:	e8 c1 fe ff ff       	call   802927 <nsipc>
+}
+  802a66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a69:	c9                   	leave
+  802a6a:	c3                   	ret
+
+00802a6b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802a6b:	55                   	push   %ebp
+  802a6c:	89 e5                	mov    %esp,%ebp
+  802a6e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802a71:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a74:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802a79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a7c:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802a81:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a86:	e8 9c fe ff ff       	call   802927 <nsipc>
+}
+  802a8b:	c9                   	leave
+  802a8c:	c3                   	ret
+
+00802a8d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802a8d:	55                   	push   %ebp
+  802a8e:	89 e5                	mov    %esp,%ebp
+  802a90:	56                   	push   %esi
+  802a91:	53                   	push   %ebx
+  802a92:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802a95:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a98:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802a9d:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802aa3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802aa6:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802aab:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ab0:	e8 72 fe ff ff       	call   802927 <nsipc>
+  802ab5:	89 c3                	mov    %eax,%ebx
+  802ab7:	85 c0                	test   %eax,%eax
+  802ab9:	78 22                	js     802add <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802abb:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ac0:	39 c6                	cmp    %eax,%esi
+  802ac2:	0f 4e c6             	cmovle %esi,%eax
+  802ac5:	39 c3                	cmp    %eax,%ebx
+  802ac7:	7f 1d                	jg     802ae6 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ac9:	83 ec 04             	sub    $0x4,%esp
+  802acc:	53                   	push   %ebx
+  802acd:	68 00 80 80 00       	push   $0x808000
+  802ad2:	ff 75 0c             	push   0xc(%ebp)
+  802ad5:	e8 8d de ff ff       	call   800967 <memmove>
+  802ada:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802add:	89 d8                	mov    %ebx,%eax
+  802adf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ae2:	5b                   	pop    %ebx
+  802ae3:	5e                   	pop    %esi
+  802ae4:	5d                   	pop    %ebp
+  802ae5:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802ae6:	68 49 3d 80 00       	push   $0x803d49
+  802aeb:	68 2c 3c 80 00       	push   $0x803c2c
+  802af0:	6a 62                	push   $0x62
+  802af2:	68 5e 3d 80 00       	push   $0x803d5e
+  802af7:	e8 1c d6 ff ff       	call   800118 <_panic>
+
+00802afc <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802afc:	55                   	push   %ebp
+  802afd:	89 e5                	mov    %esp,%ebp
+  802aff:	53                   	push   %ebx
+  802b00:	83 ec 04             	sub    $0x4,%esp
+  802b03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b09:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802b0e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802b14:	7f 2e                	jg     802b44 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802b16:	83 ec 04             	sub    $0x4,%esp
+  802b19:	53                   	push   %ebx
+  802b1a:	ff 75 0c             	push   0xc(%ebp)
+  802b1d:	68 0c 80 80 00       	push   $0x80800c
+  802b22:	e8 40 de ff ff       	call   800967 <memmove>
+	nsipcbuf.send.req_size = size;
+  802b27:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802b2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b30:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802b35:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b3a:	e8 e8 fd ff ff       	call   802927 <nsipc>
+}
+  802b3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b42:	c9                   	leave
+  802b43:	c3                   	ret
+	assert(size < 1600);
+  802b44:	68 6a 3d 80 00       	push   $0x803d6a
+  802b49:	68 2c 3c 80 00       	push   $0x803c2c
+  802b4e:	6a 6d                	push   $0x6d
+  802b50:	68 5e 3d 80 00       	push   $0x803d5e
+  802b55:	e8 be d5 ff ff       	call   800118 <_panic>
+
+00802b5a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b5a:	55                   	push   %ebp
+  802b5b:	89 e5                	mov    %esp,%ebp
+  802b5d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b60:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b63:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802b68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b6b:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802b70:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b73:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802b78:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b7d:	e8 a5 fd ff ff       	call   802927 <nsipc>
+}
+  802b82:	c9                   	leave
+  802b83:	c3                   	ret
+
+00802b84 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b84:	55                   	push   %ebp
+  802b85:	89 e5                	mov    %esp,%ebp
+  802b87:	56                   	push   %esi
+  802b88:	53                   	push   %ebx
+  802b89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802b8c:	83 ec 0c             	sub    $0xc,%esp
+  802b8f:	ff 75 08             	push   0x8(%ebp)
+  802b92:	e8 00 e5 ff ff       	call   801097 <fd2data>
+  802b97:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802b99:	83 c4 08             	add    $0x8,%esp
+  802b9c:	68 76 3d 80 00       	push   $0x803d76
+  802ba1:	53                   	push   %ebx
+  802ba2:	e8 3a dc ff ff       	call   8007e1 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802ba7:	8b 46 04             	mov    0x4(%esi),%eax
+  802baa:	2b 06                	sub    (%esi),%eax
+  802bac:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802bb2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802bb9:	00 00 00 
+	stat->st_dev = &devpipe;
+  802bbc:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802bc3:	40 80 00 
+	return 0;
+}
+  802bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bcb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bce:	5b                   	pop    %ebx
+  802bcf:	5e                   	pop    %esi
+  802bd0:	5d                   	pop    %ebp
+  802bd1:	c3                   	ret
+
+00802bd2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802bd2:	55                   	push   %ebp
+  802bd3:	89 e5                	mov    %esp,%ebp
+  802bd5:	53                   	push   %ebx
+  802bd6:	83 ec 0c             	sub    $0xc,%esp
+  802bd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802bdc:	53                   	push   %ebx
+  802bdd:	6a 00                	push   $0x0
+  802bdf:	e8 96 e0 ff ff       	call   800c7a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802be4:	89 1c 24             	mov    %ebx,(%esp)
+  802be7:	e8 ab e4 ff ff       	call   801097 <fd2data>
+  802bec:	83 c4 08             	add    $0x8,%esp
+  802bef:	50                   	push   %eax
+  802bf0:	6a 00                	push   $0x0
+  802bf2:	e8 83 e0 ff ff       	call   800c7a <sys_page_unmap>
+}
+  802bf7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bfa:	c9                   	leave
+  802bfb:	c3                   	ret
+
+00802bfc <_pipeisclosed>:
+{
+  802bfc:	55                   	push   %ebp
+  802bfd:	89 e5                	mov    %esp,%ebp
+  802bff:	57                   	push   %edi
+  802c00:	56                   	push   %esi
+  802c01:	53                   	push   %ebx
+  802c02:	83 ec 1c             	sub    $0x1c,%esp
+  802c05:	89 c7                	mov    %eax,%edi
+  802c07:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802c09:	a1 00 50 80 00       	mov    0x805000,%eax
+  802c0e:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802c11:	83 ec 0c             	sub    $0xc,%esp
+  802c14:	57                   	push   %edi
+  802c15:	e8 20 09 00 00       	call   80353a <pageref>
+  802c1a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c1d:	89 34 24             	mov    %esi,(%esp)
+  802c20:	e8 15 09 00 00       	call   80353a <pageref>
+		nn = thisenv->env_runs;
+  802c25:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802c2b:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802c2e:	83 c4 10             	add    $0x10,%esp
+  802c31:	39 cb                	cmp    %ecx,%ebx
+  802c33:	74 1b                	je     802c50 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802c35:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c38:	75 cf                	jne    802c09 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802c3a:	8b 42 58             	mov    0x58(%edx),%eax
+  802c3d:	6a 01                	push   $0x1
+  802c3f:	50                   	push   %eax
+  802c40:	53                   	push   %ebx
+  802c41:	68 7d 3d 80 00       	push   $0x803d7d
+  802c46:	e8 a8 d5 ff ff       	call   8001f3 <cprintf>
+  802c4b:	83 c4 10             	add    $0x10,%esp
+  802c4e:	eb b9                	jmp    802c09 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802c50:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c53:	0f 94 c0             	sete   %al
+  802c56:	0f b6 c0             	movzbl %al,%eax
+}
+  802c59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c5c:	5b                   	pop    %ebx
+  802c5d:	5e                   	pop    %esi
+  802c5e:	5f                   	pop    %edi
+  802c5f:	5d                   	pop    %ebp
+  802c60:	c3                   	ret
+
+00802c61 <devpipe_write>:
+{
+  802c61:	55                   	push   %ebp
+  802c62:	89 e5                	mov    %esp,%ebp
+  802c64:	57                   	push   %edi
+  802c65:	56                   	push   %esi
+  802c66:	53                   	push   %ebx
+  802c67:	83 ec 28             	sub    $0x28,%esp
+  802c6a:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802c6d:	56                   	push   %esi
+  802c6e:	e8 24 e4 ff ff       	call   801097 <fd2data>
+  802c73:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802c75:	83 c4 10             	add    $0x10,%esp
+  802c78:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c7d:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802c80:	75 09                	jne    802c8b <devpipe_write+0x2a>
+	return i;
+  802c82:	89 f8                	mov    %edi,%eax
+  802c84:	eb 23                	jmp    802ca9 <devpipe_write+0x48>
+			sys_yield();
+  802c86:	e8 43 df ff ff       	call   800bce <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802c8b:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c8e:	8b 0b                	mov    (%ebx),%ecx
+  802c90:	8d 51 20             	lea    0x20(%ecx),%edx
+  802c93:	39 d0                	cmp    %edx,%eax
+  802c95:	72 1a                	jb     802cb1 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802c97:	89 da                	mov    %ebx,%edx
+  802c99:	89 f0                	mov    %esi,%eax
+  802c9b:	e8 5c ff ff ff       	call   802bfc <_pipeisclosed>
+  802ca0:	85 c0                	test   %eax,%eax
+  802ca2:	74 e2                	je     802c86 <devpipe_write+0x25>
+				return 0;
+  802ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ca9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cac:	5b                   	pop    %ebx
+  802cad:	5e                   	pop    %esi
+  802cae:	5f                   	pop    %edi
+  802caf:	5d                   	pop    %ebp
+  802cb0:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802cb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cb4:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802cb8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802cbb:	89 c2                	mov    %eax,%edx
+  802cbd:	c1 fa 1f             	sar    $0x1f,%edx
+  802cc0:	89 d1                	mov    %edx,%ecx
+  802cc2:	c1 e9 1b             	shr    $0x1b,%ecx
+  802cc5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802cc8:	83 e2 1f             	and    $0x1f,%edx
+  802ccb:	29 ca                	sub    %ecx,%edx
+  802ccd:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802cd1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802cd5:	83 c0 01             	add    $0x1,%eax
+  802cd8:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802cdb:	83 c7 01             	add    $0x1,%edi
+  802cde:	eb 9d                	jmp    802c7d <devpipe_write+0x1c>
+
+00802ce0 <devpipe_read>:
+{
+  802ce0:	55                   	push   %ebp
+  802ce1:	89 e5                	mov    %esp,%ebp
+  802ce3:	57                   	push   %edi
+  802ce4:	56                   	push   %esi
+  802ce5:	53                   	push   %ebx
+  802ce6:	83 ec 18             	sub    $0x18,%esp
+  802ce9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802cec:	57                   	push   %edi
+  802ced:	e8 a5 e3 ff ff       	call   801097 <fd2data>
+  802cf2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802cf4:	83 c4 10             	add    $0x10,%esp
+  802cf7:	be 00 00 00 00       	mov    $0x0,%esi
+  802cfc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802cff:	75 13                	jne    802d14 <devpipe_read+0x34>
+	return i;
+  802d01:	89 f0                	mov    %esi,%eax
+  802d03:	eb 02                	jmp    802d07 <devpipe_read+0x27>
+				return i;
+  802d05:	89 f0                	mov    %esi,%eax
+}
+  802d07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d0a:	5b                   	pop    %ebx
+  802d0b:	5e                   	pop    %esi
+  802d0c:	5f                   	pop    %edi
+  802d0d:	5d                   	pop    %ebp
+  802d0e:	c3                   	ret
+			sys_yield();
+  802d0f:	e8 ba de ff ff       	call   800bce <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802d14:	8b 03                	mov    (%ebx),%eax
+  802d16:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802d19:	75 18                	jne    802d33 <devpipe_read+0x53>
+			if (i > 0)
+  802d1b:	85 f6                	test   %esi,%esi
+  802d1d:	75 e6                	jne    802d05 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802d1f:	89 da                	mov    %ebx,%edx
+  802d21:	89 f8                	mov    %edi,%eax
+  802d23:	e8 d4 fe ff ff       	call   802bfc <_pipeisclosed>
+  802d28:	85 c0                	test   %eax,%eax
+  802d2a:	74 e3                	je     802d0f <devpipe_read+0x2f>
+				return 0;
+  802d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d31:	eb d4                	jmp    802d07 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802d33:	99                   	cltd
+  802d34:	c1 ea 1b             	shr    $0x1b,%edx
+  802d37:	01 d0                	add    %edx,%eax
+  802d39:	83 e0 1f             	and    $0x1f,%eax
+  802d3c:	29 d0                	sub    %edx,%eax
+  802d3e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802d43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d46:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802d49:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802d4c:	83 c6 01             	add    $0x1,%esi
+  802d4f:	eb ab                	jmp    802cfc <devpipe_read+0x1c>
+
+00802d51 <pipe>:
+{
+  802d51:	55                   	push   %ebp
+  802d52:	89 e5                	mov    %esp,%ebp
+  802d54:	56                   	push   %esi
+  802d55:	53                   	push   %ebx
+  802d56:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802d59:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d5c:	50                   	push   %eax
+  802d5d:	e8 4c e3 ff ff       	call   8010ae <fd_alloc>
+  802d62:	89 c3                	mov    %eax,%ebx
+  802d64:	83 c4 10             	add    $0x10,%esp
+  802d67:	85 c0                	test   %eax,%eax
+  802d69:	0f 88 23 01 00 00    	js     802e92 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d6f:	83 ec 04             	sub    $0x4,%esp
+  802d72:	68 07 04 00 00       	push   $0x407
+  802d77:	ff 75 f4             	push   -0xc(%ebp)
+  802d7a:	6a 00                	push   $0x0
+  802d7c:	e8 6c de ff ff       	call   800bed <sys_page_alloc>
+  802d81:	89 c3                	mov    %eax,%ebx
+  802d83:	83 c4 10             	add    $0x10,%esp
+  802d86:	85 c0                	test   %eax,%eax
+  802d88:	0f 88 04 01 00 00    	js     802e92 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802d8e:	83 ec 0c             	sub    $0xc,%esp
+  802d91:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802d94:	50                   	push   %eax
+  802d95:	e8 14 e3 ff ff       	call   8010ae <fd_alloc>
+  802d9a:	89 c3                	mov    %eax,%ebx
+  802d9c:	83 c4 10             	add    $0x10,%esp
+  802d9f:	85 c0                	test   %eax,%eax
+  802da1:	0f 88 db 00 00 00    	js     802e82 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802da7:	83 ec 04             	sub    $0x4,%esp
+  802daa:	68 07 04 00 00       	push   $0x407
+  802daf:	ff 75 f0             	push   -0x10(%ebp)
+  802db2:	6a 00                	push   $0x0
+  802db4:	e8 34 de ff ff       	call   800bed <sys_page_alloc>
+  802db9:	89 c3                	mov    %eax,%ebx
+  802dbb:	83 c4 10             	add    $0x10,%esp
+  802dbe:	85 c0                	test   %eax,%eax
+  802dc0:	0f 88 bc 00 00 00    	js     802e82 <pipe+0x131>
+	va = fd2data(fd0);
+  802dc6:	83 ec 0c             	sub    $0xc,%esp
+  802dc9:	ff 75 f4             	push   -0xc(%ebp)
+  802dcc:	e8 c6 e2 ff ff       	call   801097 <fd2data>
+  802dd1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802dd3:	83 c4 0c             	add    $0xc,%esp
+  802dd6:	68 07 04 00 00       	push   $0x407
+  802ddb:	50                   	push   %eax
+  802ddc:	6a 00                	push   $0x0
+  802dde:	e8 0a de ff ff       	call   800bed <sys_page_alloc>
+  802de3:	89 c3                	mov    %eax,%ebx
+  802de5:	83 c4 10             	add    $0x10,%esp
+  802de8:	85 c0                	test   %eax,%eax
+  802dea:	0f 88 82 00 00 00    	js     802e72 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802df0:	83 ec 0c             	sub    $0xc,%esp
+  802df3:	ff 75 f0             	push   -0x10(%ebp)
+  802df6:	e8 9c e2 ff ff       	call   801097 <fd2data>
+  802dfb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802e02:	50                   	push   %eax
+  802e03:	6a 00                	push   $0x0
+  802e05:	56                   	push   %esi
+  802e06:	6a 00                	push   $0x0
+  802e08:	e8 2b de ff ff       	call   800c38 <sys_page_map>
+  802e0d:	89 c3                	mov    %eax,%ebx
+  802e0f:	83 c4 20             	add    $0x20,%esp
+  802e12:	85 c0                	test   %eax,%eax
+  802e14:	78 4e                	js     802e64 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802e16:	a1 60 40 80 00       	mov    0x804060,%eax
+  802e1b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802e1e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802e20:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802e23:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802e2a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802e2d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802e2f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802e32:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802e39:	83 ec 0c             	sub    $0xc,%esp
+  802e3c:	ff 75 f4             	push   -0xc(%ebp)
+  802e3f:	e8 43 e2 ff ff       	call   801087 <fd2num>
+  802e44:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802e47:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802e49:	83 c4 04             	add    $0x4,%esp
+  802e4c:	ff 75 f0             	push   -0x10(%ebp)
+  802e4f:	e8 33 e2 ff ff       	call   801087 <fd2num>
+  802e54:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802e57:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802e5a:	83 c4 10             	add    $0x10,%esp
+  802e5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e62:	eb 2e                	jmp    802e92 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802e64:	83 ec 08             	sub    $0x8,%esp
+  802e67:	56                   	push   %esi
+  802e68:	6a 00                	push   $0x0
+  802e6a:	e8 0b de ff ff       	call   800c7a <sys_page_unmap>
+  802e6f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802e72:	83 ec 08             	sub    $0x8,%esp
+  802e75:	ff 75 f0             	push   -0x10(%ebp)
+  802e78:	6a 00                	push   $0x0
+  802e7a:	e8 fb dd ff ff       	call   800c7a <sys_page_unmap>
+  802e7f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802e82:	83 ec 08             	sub    $0x8,%esp
+  802e85:	ff 75 f4             	push   -0xc(%ebp)
+  802e88:	6a 00                	push   $0x0
+  802e8a:	e8 eb dd ff ff       	call   800c7a <sys_page_unmap>
+  802e8f:	83 c4 10             	add    $0x10,%esp
+}
+  802e92:	89 d8                	mov    %ebx,%eax
+  802e94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e97:	5b                   	pop    %ebx
+  802e98:	5e                   	pop    %esi
+  802e99:	5d                   	pop    %ebp
+  802e9a:	c3                   	ret
+
+00802e9b <pipeisclosed>:
+{
+  802e9b:	55                   	push   %ebp
+  802e9c:	89 e5                	mov    %esp,%ebp
+  802e9e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ea1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ea4:	50                   	push   %eax
+  802ea5:	ff 75 08             	push   0x8(%ebp)
+  802ea8:	e8 57 e2 ff ff       	call   801104 <fd_lookup>
+  802ead:	83 c4 10             	add    $0x10,%esp
+  802eb0:	85 c0                	test   %eax,%eax
+  802eb2:	78 18                	js     802ecc <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802eb4:	83 ec 0c             	sub    $0xc,%esp
+  802eb7:	ff 75 f4             	push   -0xc(%ebp)
+  802eba:	e8 d8 e1 ff ff       	call   801097 <fd2data>
+  802ebf:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802ec1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ec4:	e8 33 fd ff ff       	call   802bfc <_pipeisclosed>
+  802ec9:	83 c4 10             	add    $0x10,%esp
+}
+  802ecc:	c9                   	leave
+  802ecd:	c3                   	ret
+
+00802ece <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802ece:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed3:	c3                   	ret
+
+00802ed4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802ed4:	55                   	push   %ebp
+  802ed5:	89 e5                	mov    %esp,%ebp
+  802ed7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802eda:	68 95 3d 80 00       	push   $0x803d95
+  802edf:	ff 75 0c             	push   0xc(%ebp)
+  802ee2:	e8 fa d8 ff ff       	call   8007e1 <strcpy>
+	return 0;
+}
+  802ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eec:	c9                   	leave
+  802eed:	c3                   	ret
+
+00802eee <devcons_write>:
+{
+  802eee:	55                   	push   %ebp
+  802eef:	89 e5                	mov    %esp,%ebp
+  802ef1:	57                   	push   %edi
+  802ef2:	56                   	push   %esi
+  802ef3:	53                   	push   %ebx
+  802ef4:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802efa:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802eff:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802f05:	eb 2e                	jmp    802f35 <devcons_write+0x47>
+		m = n - tot;
+  802f07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f0a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802f0c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802f11:	39 c3                	cmp    %eax,%ebx
+  802f13:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802f16:	83 ec 04             	sub    $0x4,%esp
+  802f19:	53                   	push   %ebx
+  802f1a:	89 f0                	mov    %esi,%eax
+  802f1c:	03 45 0c             	add    0xc(%ebp),%eax
+  802f1f:	50                   	push   %eax
+  802f20:	57                   	push   %edi
+  802f21:	e8 41 da ff ff       	call   800967 <memmove>
+		sys_cputs(buf, m);
+  802f26:	83 c4 08             	add    $0x8,%esp
+  802f29:	53                   	push   %ebx
+  802f2a:	57                   	push   %edi
+  802f2b:	e8 e1 db ff ff       	call   800b11 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802f30:	01 de                	add    %ebx,%esi
+  802f32:	83 c4 10             	add    $0x10,%esp
+  802f35:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802f38:	72 cd                	jb     802f07 <devcons_write+0x19>
+}
+  802f3a:	89 f0                	mov    %esi,%eax
+  802f3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f3f:	5b                   	pop    %ebx
+  802f40:	5e                   	pop    %esi
+  802f41:	5f                   	pop    %edi
+  802f42:	5d                   	pop    %ebp
+  802f43:	c3                   	ret
+
+00802f44 <devcons_read>:
+{
+  802f44:	55                   	push   %ebp
+  802f45:	89 e5                	mov    %esp,%ebp
+  802f47:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f4f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f53:	75 07                	jne    802f5c <devcons_read+0x18>
+  802f55:	eb 1f                	jmp    802f76 <devcons_read+0x32>
+		sys_yield();
+  802f57:	e8 72 dc ff ff       	call   800bce <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802f5c:	e8 d6 db ff ff       	call   800b37 <sys_cgetc>
+  802f61:	85 c0                	test   %eax,%eax
+  802f63:	74 f2                	je     802f57 <devcons_read+0x13>
+	if (c < 0)
+  802f65:	78 0f                	js     802f76 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802f67:	83 f8 04             	cmp    $0x4,%eax
+  802f6a:	74 0c                	je     802f78 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802f6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802f6f:	88 02                	mov    %al,(%edx)
+	return 1;
+  802f71:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802f76:	c9                   	leave
+  802f77:	c3                   	ret
+		return 0;
+  802f78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7d:	eb f7                	jmp    802f76 <devcons_read+0x32>
+
+00802f7f <cputchar>:
+{
+  802f7f:	55                   	push   %ebp
+  802f80:	89 e5                	mov    %esp,%ebp
+  802f82:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802f85:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f88:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802f8b:	6a 01                	push   $0x1
+  802f8d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802f90:	50                   	push   %eax
+  802f91:	e8 7b db ff ff       	call   800b11 <sys_cputs>
+}
+  802f96:	83 c4 10             	add    $0x10,%esp
+  802f99:	c9                   	leave
+  802f9a:	c3                   	ret
+
+00802f9b <getchar>:
+{
+  802f9b:	55                   	push   %ebp
+  802f9c:	89 e5                	mov    %esp,%ebp
+  802f9e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802fa1:	6a 01                	push   $0x1
+  802fa3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802fa6:	50                   	push   %eax
+  802fa7:	6a 00                	push   $0x0
+  802fa9:	e8 bc e3 ff ff       	call   80136a <read>
+	if (r < 0)
+  802fae:	83 c4 10             	add    $0x10,%esp
+  802fb1:	85 c0                	test   %eax,%eax
+  802fb3:	78 06                	js     802fbb <getchar+0x20>
+	if (r < 1)
+  802fb5:	74 06                	je     802fbd <getchar+0x22>
+	return c;
+  802fb7:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802fbb:	c9                   	leave
+  802fbc:	c3                   	ret
+		return -E_EOF;
+  802fbd:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802fc2:	eb f7                	jmp    802fbb <getchar+0x20>
+
+00802fc4 <iscons>:
+{
+  802fc4:	55                   	push   %ebp
+  802fc5:	89 e5                	mov    %esp,%ebp
+  802fc7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802fca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fcd:	50                   	push   %eax
+  802fce:	ff 75 08             	push   0x8(%ebp)
+  802fd1:	e8 2e e1 ff ff       	call   801104 <fd_lookup>
+  802fd6:	83 c4 10             	add    $0x10,%esp
+  802fd9:	85 c0                	test   %eax,%eax
+  802fdb:	78 11                	js     802fee <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802fdd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fe0:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802fe6:	39 10                	cmp    %edx,(%eax)
+  802fe8:	0f 94 c0             	sete   %al
+  802feb:	0f b6 c0             	movzbl %al,%eax
+}
+  802fee:	c9                   	leave
+  802fef:	c3                   	ret
+
+00802ff0 <opencons>:
+{
+  802ff0:	55                   	push   %ebp
+  802ff1:	89 e5                	mov    %esp,%ebp
+  802ff3:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802ff6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ff9:	50                   	push   %eax
+  802ffa:	e8 af e0 ff ff       	call   8010ae <fd_alloc>
+  802fff:	83 c4 10             	add    $0x10,%esp
+  803002:	85 c0                	test   %eax,%eax
+  803004:	78 3a                	js     803040 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803006:	83 ec 04             	sub    $0x4,%esp
+  803009:	68 07 04 00 00       	push   $0x407
+  80300e:	ff 75 f4             	push   -0xc(%ebp)
+  803011:	6a 00                	push   $0x0
+  803013:	e8 d5 db ff ff       	call   800bed <sys_page_alloc>
+  803018:	83 c4 10             	add    $0x10,%esp
+  80301b:	85 c0                	test   %eax,%eax
+  80301d:	78 21                	js     803040 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80301f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803022:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  803028:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80302a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80302d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803034:	83 ec 0c             	sub    $0xc,%esp
+  803037:	50                   	push   %eax
+  803038:	e8 4a e0 ff ff       	call   801087 <fd2num>
+  80303d:	83 c4 10             	add    $0x10,%esp
+}
+  803040:	c9                   	leave
+  803041:	c3                   	ret
+
+00803042 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  803042:	55                   	push   %ebp
+  803043:	89 e5                	mov    %esp,%ebp
+  803045:	57                   	push   %edi
+  803046:	56                   	push   %esi
+  803047:	53                   	push   %ebx
+  803048:	83 ec 20             	sub    $0x20,%esp
+  80304b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80304e:	89 d7                	mov    %edx,%edi
+  803050:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  803052:	51                   	push   %ecx
+  803053:	68 00 f0 7f 00       	push   $0x7ff000
+  803058:	6a 00                	push   $0x0
+  80305a:	e8 8e db ff ff       	call   800bed <sys_page_alloc>
+  80305f:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803061:	83 c4 10             	add    $0x10,%esp
+  803064:	85 c0                	test   %eax,%eax
+  803066:	78 45                	js     8030ad <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  803068:	83 ec 04             	sub    $0x4,%esp
+  80306b:	68 00 10 00 00       	push   $0x1000
+  803070:	57                   	push   %edi
+  803071:	68 00 f0 7f 00       	push   $0x7ff000
+  803076:	e8 ec d8 ff ff       	call   800967 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  80307b:	89 34 24             	mov    %esi,(%esp)
+  80307e:	57                   	push   %edi
+  80307f:	ff 75 e4             	push   -0x1c(%ebp)
+  803082:	68 00 f0 7f 00       	push   $0x7ff000
+  803087:	6a 00                	push   $0x0
+  803089:	e8 aa db ff ff       	call   800c38 <sys_page_map>
+  80308e:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803090:	83 c4 20             	add    $0x20,%esp
+  803093:	85 c0                	test   %eax,%eax
+  803095:	78 16                	js     8030ad <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803097:	83 ec 08             	sub    $0x8,%esp
+  80309a:	68 00 f0 7f 00       	push   $0x7ff000
+  80309f:	6a 00                	push   $0x0
+  8030a1:	e8 d4 db ff ff       	call   800c7a <sys_page_unmap>
+  8030a6:	83 c4 10             	add    $0x10,%esp
+  8030a9:	85 c0                	test   %eax,%eax
+  8030ab:	75 0a                	jne    8030b7 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8030ad:	89 d8                	mov    %ebx,%eax
+  8030af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030b2:	5b                   	pop    %ebx
+  8030b3:	5e                   	pop    %esi
+  8030b4:	5f                   	pop    %edi
+  8030b5:	5d                   	pop    %ebp
+  8030b6:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8030b7:	68 a4 3d 80 00       	push   $0x803da4
+  8030bc:	68 2c 3c 80 00       	push   $0x803c2c
+  8030c1:	6a 1b                	push   $0x1b
+  8030c3:	68 1c 3e 80 00       	push   $0x803e1c
+  8030c8:	e8 4b d0 ff ff       	call   800118 <_panic>
+
+008030cd <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8030cd:	55                   	push   %ebp
+  8030ce:	89 e5                	mov    %esp,%ebp
+  8030d0:	53                   	push   %ebx
+  8030d1:	83 ec 04             	sub    $0x4,%esp
+  8030d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8030d7:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8030d9:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  8030dd:	74 21                	je     803100 <pgfault+0x33>
+  8030df:	89 d0                	mov    %edx,%eax
+  8030e1:	c1 e8 16             	shr    $0x16,%eax
+  8030e4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8030eb:	a8 01                	test   $0x1,%al
+  8030ed:	74 11                	je     803100 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  8030ef:	89 d0                	mov    %edx,%eax
+  8030f1:	c1 e8 0c             	shr    $0xc,%eax
+  8030f4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8030fb:	f6 c4 08             	test   $0x8,%ah
+  8030fe:	75 17                	jne    803117 <pgfault+0x4a>
+		if (pgfault_next) {
+  803100:	a1 04 90 80 00       	mov    0x809004,%eax
+  803105:	85 c0                	test   %eax,%eax
+  803107:	74 27                	je     803130 <pgfault+0x63>
+			pgfault_next(utf);
+  803109:	83 ec 0c             	sub    $0xc,%esp
+  80310c:	53                   	push   %ebx
+  80310d:	ff d0                	call   *%eax
+			return;
+  80310f:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803112:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803115:	c9                   	leave
+  803116:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803117:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80311d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803122:	b8 00 00 00 00       	mov    $0x0,%eax
+  803127:	e8 16 ff ff ff       	call   803042 <copy_page_to>
+  80312c:	85 c0                	test   %eax,%eax
+  80312e:	79 e2                	jns    803112 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803130:	a1 00 50 80 00       	mov    0x805000,%eax
+  803135:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803138:	ff 73 28             	push   0x28(%ebx)
+  80313b:	ff 33                	push   (%ebx)
+  80313d:	50                   	push   %eax
+  80313e:	68 c8 3d 80 00       	push   $0x803dc8
+  803143:	e8 ab d0 ff ff       	call   8001f3 <cprintf>
+	sys_env_destroy(0);
+  803148:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80314f:	e8 0a da ff ff       	call   800b5e <sys_env_destroy>
+  803154:	83 c4 10             	add    $0x10,%esp
+  803157:	eb b9                	jmp    803112 <pgfault+0x45>
+
+00803159 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803159:	55                   	push   %ebp
+  80315a:	89 e5                	mov    %esp,%ebp
+  80315c:	53                   	push   %ebx
+  80315d:	83 ec 04             	sub    $0x4,%esp
+  803160:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803163:	a1 04 50 80 00       	mov    0x805004,%eax
+  803168:	3d cd 30 80 00       	cmp    $0x8030cd,%eax
+  80316d:	74 15                	je     803184 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80316f:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  803174:	83 ec 0c             	sub    $0xc,%esp
+  803177:	68 cd 30 80 00       	push   $0x8030cd
+  80317c:	e8 6d de ff ff       	call   800fee <set_pgfault_handler>
+  803181:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803184:	83 ec 0c             	sub    $0xc,%esp
+  803187:	68 05 08 00 00       	push   $0x805
+  80318c:	53                   	push   %ebx
+  80318d:	6a 00                	push   $0x0
+  80318f:	53                   	push   %ebx
+  803190:	6a 00                	push   $0x0
+  803192:	e8 a1 da ff ff       	call   800c38 <sys_page_map>
+}
+  803197:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80319a:	c9                   	leave
+  80319b:	c3                   	ret
+
+0080319c <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80319c:	55                   	push   %ebp
+  80319d:	89 e5                	mov    %esp,%ebp
+  80319f:	57                   	push   %edi
+  8031a0:	56                   	push   %esi
+  8031a1:	53                   	push   %ebx
+  8031a2:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8031a5:	68 cd 30 80 00       	push   $0x8030cd
+  8031aa:	e8 3f de ff ff       	call   800fee <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8031af:	b8 07 00 00 00       	mov    $0x7,%eax
+  8031b4:	cd 30                	int    $0x30
+  8031b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8031b9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8031bc:	83 c4 10             	add    $0x10,%esp
+  8031bf:	85 c0                	test   %eax,%eax
+  8031c1:	0f 88 6b 01 00 00    	js     803332 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8031c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8031cc:	75 37                	jne    803205 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8031ce:	e8 d4 d9 ff ff       	call   800ba7 <sys_getenvid>
+  8031d3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031d8:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8031de:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8031e3:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8031e8:	e9 45 01 00 00       	jmp    803332 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8031ed:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8031f3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8031f9:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8031ff:	0f 87 ba 00 00 00    	ja     8032bf <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803205:	89 d8                	mov    %ebx,%eax
+  803207:	c1 e8 16             	shr    $0x16,%eax
+  80320a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803211:	a8 01                	test   $0x1,%al
+  803213:	74 d8                	je     8031ed <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803215:	89 d8                	mov    %ebx,%eax
+  803217:	c1 e8 0c             	shr    $0xc,%eax
+  80321a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803221:	f6 c2 01             	test   $0x1,%dl
+  803224:	74 cd                	je     8031f3 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803226:	89 da                	mov    %ebx,%edx
+  803228:	80 e6 df             	and    $0xdf,%dh
+  80322b:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803231:	74 c0                	je     8031f3 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803233:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803235:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80323c:	f6 c6 04             	test   $0x4,%dh
+  80323f:	75 53                	jne    803294 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803241:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803248:	f6 c6 08             	test   $0x8,%dh
+  80324b:	75 0c                	jne    803259 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80324d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803254:	f6 c2 02             	test   $0x2,%dl
+  803257:	74 3b                	je     803294 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803259:	83 ec 0c             	sub    $0xc,%esp
+  80325c:	68 05 08 00 00       	push   $0x805
+  803261:	57                   	push   %edi
+  803262:	ff 75 e4             	push   -0x1c(%ebp)
+  803265:	57                   	push   %edi
+  803266:	6a 00                	push   $0x0
+  803268:	e8 cb d9 ff ff       	call   800c38 <sys_page_map>
+  80326d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80326f:	83 c4 20             	add    $0x20,%esp
+  803272:	85 c0                	test   %eax,%eax
+  803274:	0f 88 a7 00 00 00    	js     803321 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80327a:	83 ec 0c             	sub    $0xc,%esp
+  80327d:	68 05 08 00 00       	push   $0x805
+  803282:	57                   	push   %edi
+  803283:	6a 00                	push   $0x0
+  803285:	57                   	push   %edi
+  803286:	6a 00                	push   $0x0
+  803288:	e8 ab d9 ff ff       	call   800c38 <sys_page_map>
+  80328d:	89 c6                	mov    %eax,%esi
+	return r;
+  80328f:	83 c4 20             	add    $0x20,%esp
+  803292:	eb 21                	jmp    8032b5 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803294:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80329b:	83 ec 0c             	sub    $0xc,%esp
+  80329e:	25 07 0e 00 00       	and    $0xe07,%eax
+  8032a3:	50                   	push   %eax
+  8032a4:	57                   	push   %edi
+  8032a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8032a8:	57                   	push   %edi
+  8032a9:	6a 00                	push   $0x0
+  8032ab:	e8 88 d9 ff ff       	call   800c38 <sys_page_map>
+  8032b0:	89 c6                	mov    %eax,%esi
+  8032b2:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8032b5:	85 f6                	test   %esi,%esi
+  8032b7:	0f 89 36 ff ff ff    	jns    8031f3 <fork+0x57>
+  8032bd:	eb 62                	jmp    803321 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8032bf:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8032c4:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8032c9:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8032cc:	89 f8                	mov    %edi,%eax
+  8032ce:	e8 6f fd ff ff       	call   803042 <copy_page_to>
+  8032d3:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032d5:	85 c0                	test   %eax,%eax
+  8032d7:	78 48                	js     803321 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8032d9:	83 ec 04             	sub    $0x4,%esp
+  8032dc:	6a 07                	push   $0x7
+  8032de:	68 00 f0 bf ee       	push   $0xeebff000
+  8032e3:	57                   	push   %edi
+  8032e4:	e8 04 d9 ff ff       	call   800bed <sys_page_alloc>
+  8032e9:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032eb:	83 c4 10             	add    $0x10,%esp
+  8032ee:	85 c0                	test   %eax,%eax
+  8032f0:	78 2f                	js     803321 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8032f2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032f7:	8b 40 64             	mov    0x64(%eax),%eax
+  8032fa:	83 ec 08             	sub    $0x8,%esp
+  8032fd:	50                   	push   %eax
+  8032fe:	57                   	push   %edi
+  8032ff:	e8 54 da ff ff       	call   800d58 <sys_env_set_pgfault_upcall>
+  803304:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803306:	83 c4 10             	add    $0x10,%esp
+  803309:	85 c0                	test   %eax,%eax
+  80330b:	78 14                	js     803321 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80330d:	83 ec 08             	sub    $0x8,%esp
+  803310:	6a 02                	push   $0x2
+  803312:	57                   	push   %edi
+  803313:	e8 ac d9 ff ff       	call   800cc4 <sys_env_set_status>
+  803318:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80331a:	83 c4 10             	add    $0x10,%esp
+  80331d:	85 c0                	test   %eax,%eax
+  80331f:	79 11                	jns    803332 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803321:	83 ec 0c             	sub    $0xc,%esp
+  803324:	ff 75 e0             	push   -0x20(%ebp)
+  803327:	e8 32 d8 ff ff       	call   800b5e <sys_env_destroy>
+	return r;
+  80332c:	83 c4 10             	add    $0x10,%esp
+  80332f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803332:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803338:	5b                   	pop    %ebx
+  803339:	5e                   	pop    %esi
+  80333a:	5f                   	pop    %edi
+  80333b:	5d                   	pop    %ebp
+  80333c:	c3                   	ret
+
+0080333d <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80333d:	55                   	push   %ebp
+  80333e:	89 e5                	mov    %esp,%ebp
+  803340:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803343:	68 27 3e 80 00       	push   $0x803e27
+  803348:	68 bf 00 00 00       	push   $0xbf
+  80334d:	68 1c 3e 80 00       	push   $0x803e1c
+  803352:	e8 c1 cd ff ff       	call   800118 <_panic>
+
+00803357 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803357:	55                   	push   %ebp
+  803358:	89 e5                	mov    %esp,%ebp
+  80335a:	56                   	push   %esi
+  80335b:	53                   	push   %ebx
+  80335c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80335f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803362:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803365:	85 c0                	test   %eax,%eax
+  803367:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80336c:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80336f:	83 ec 0c             	sub    $0xc,%esp
+  803372:	50                   	push   %eax
+  803373:	e8 bd da ff ff       	call   800e35 <sys_ipc_recv>
+	if (from_env_store)
+  803378:	83 c4 10             	add    $0x10,%esp
+  80337b:	85 f6                	test   %esi,%esi
+  80337d:	74 14                	je     803393 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80337f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803384:	85 c0                	test   %eax,%eax
+  803386:	75 09                	jne    803391 <ipc_recv+0x3a>
+  803388:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80338e:	8b 52 74             	mov    0x74(%edx),%edx
+  803391:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803393:	85 db                	test   %ebx,%ebx
+  803395:	74 25                	je     8033bc <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803397:	85 c0                	test   %eax,%eax
+  803399:	74 0d                	je     8033a8 <ipc_recv+0x51>
+  80339b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8033a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033a4:	5b                   	pop    %ebx
+  8033a5:	5e                   	pop    %esi
+  8033a6:	5d                   	pop    %ebp
+  8033a7:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033a8:	a1 00 50 80 00       	mov    0x805000,%eax
+  8033ad:	8b 40 78             	mov    0x78(%eax),%eax
+  8033b0:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8033b2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8033b7:	8b 40 70             	mov    0x70(%eax),%eax
+  8033ba:	eb e5                	jmp    8033a1 <ipc_recv+0x4a>
+  8033bc:	85 c0                	test   %eax,%eax
+  8033be:	75 e1                	jne    8033a1 <ipc_recv+0x4a>
+  8033c0:	eb f0                	jmp    8033b2 <ipc_recv+0x5b>
+
+008033c2 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8033c2:	55                   	push   %ebp
+  8033c3:	89 e5                	mov    %esp,%ebp
+  8033c5:	57                   	push   %edi
+  8033c6:	56                   	push   %esi
+  8033c7:	53                   	push   %ebx
+  8033c8:	83 ec 0c             	sub    $0xc,%esp
+  8033cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033ce:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8033d4:	85 db                	test   %ebx,%ebx
+  8033d6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8033db:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8033de:	ff 75 14             	push   0x14(%ebp)
+  8033e1:	53                   	push   %ebx
+  8033e2:	56                   	push   %esi
+  8033e3:	57                   	push   %edi
+  8033e4:	e8 b9 d9 ff ff       	call   800da2 <sys_ipc_try_send>
+  8033e9:	83 c4 10             	add    $0x10,%esp
+  8033ec:	85 c0                	test   %eax,%eax
+  8033ee:	74 22                	je     803412 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8033f0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033f3:	75 07                	jne    8033fc <ipc_send+0x3a>
+		sys_yield();
+  8033f5:	e8 d4 d7 ff ff       	call   800bce <sys_yield>
+  8033fa:	eb e2                	jmp    8033de <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8033fc:	68 3d 3e 80 00       	push   $0x803e3d
+  803401:	68 2c 3c 80 00       	push   $0x803c2c
+  803406:	6a 39                	push   $0x39
+  803408:	68 52 3e 80 00       	push   $0x803e52
+  80340d:	e8 06 cd ff ff       	call   800118 <_panic>
+	}
+}
+  803412:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803415:	5b                   	pop    %ebx
+  803416:	5e                   	pop    %esi
+  803417:	5f                   	pop    %edi
+  803418:	5d                   	pop    %ebp
+  803419:	c3                   	ret
+
+0080341a <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80341a:	55                   	push   %ebp
+  80341b:	89 e5                	mov    %esp,%ebp
+  80341d:	57                   	push   %edi
+  80341e:	56                   	push   %esi
+  80341f:	53                   	push   %ebx
+  803420:	83 ec 10             	sub    $0x10,%esp
+  803423:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803426:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803429:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80342c:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80342f:	85 c0                	test   %eax,%eax
+  803431:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803436:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803439:	6a 00                	push   $0x0
+  80343b:	ff 33                	push   (%ebx)
+  80343d:	50                   	push   %eax
+  80343e:	e8 af d9 ff ff       	call   800df2 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803443:	83 c4 10             	add    $0x10,%esp
+  803446:	85 c0                	test   %eax,%eax
+  803448:	75 3c                	jne    803486 <ipc_recvv+0x6c>
+  80344a:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803450:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803453:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803455:	85 ff                	test   %edi,%edi
+  803457:	74 4e                	je     8034a7 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803459:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80345f:	8b 52 74             	mov    0x74(%edx),%edx
+  803462:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803464:	85 f6                	test   %esi,%esi
+  803466:	74 18                	je     803480 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803468:	85 c0                	test   %eax,%eax
+  80346a:	75 2d                	jne    803499 <ipc_recvv+0x7f>
+  80346c:	a1 00 50 80 00       	mov    0x805000,%eax
+  803471:	8b 40 78             	mov    0x78(%eax),%eax
+  803474:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803476:	a1 00 50 80 00       	mov    0x805000,%eax
+  80347b:	8b 40 70             	mov    0x70(%eax),%eax
+  80347e:	eb 1f                	jmp    80349f <ipc_recvv+0x85>
+  803480:	85 c0                	test   %eax,%eax
+  803482:	75 1b                	jne    80349f <ipc_recvv+0x85>
+  803484:	eb f0                	jmp    803476 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803486:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80348c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803491:	85 ff                	test   %edi,%edi
+  803493:	75 cd                	jne    803462 <ipc_recvv+0x48>
+	if (perm_store)
+  803495:	85 f6                	test   %esi,%esi
+  803497:	74 e7                	je     803480 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803499:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80349f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034a2:	5b                   	pop    %ebx
+  8034a3:	5e                   	pop    %esi
+  8034a4:	5f                   	pop    %edi
+  8034a5:	5d                   	pop    %ebp
+  8034a6:	c3                   	ret
+	if (perm_store)
+  8034a7:	85 f6                	test   %esi,%esi
+  8034a9:	75 bd                	jne    803468 <ipc_recvv+0x4e>
+  8034ab:	eb c9                	jmp    803476 <ipc_recvv+0x5c>
+
+008034ad <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8034ad:	55                   	push   %ebp
+  8034ae:	89 e5                	mov    %esp,%ebp
+  8034b0:	57                   	push   %edi
+  8034b1:	56                   	push   %esi
+  8034b2:	53                   	push   %ebx
+  8034b3:	83 ec 0c             	sub    $0xc,%esp
+  8034b6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8034b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8034bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8034bf:	ff 75 14             	push   0x14(%ebp)
+  8034c2:	53                   	push   %ebx
+  8034c3:	56                   	push   %esi
+  8034c4:	57                   	push   %edi
+  8034c5:	e8 00 d9 ff ff       	call   800dca <sys_ipc_try_sendv>
+  8034ca:	83 c4 10             	add    $0x10,%esp
+  8034cd:	85 c0                	test   %eax,%eax
+  8034cf:	74 22                	je     8034f3 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8034d1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8034d4:	75 07                	jne    8034dd <ipc_sendv+0x30>
+		sys_yield();
+  8034d6:	e8 f3 d6 ff ff       	call   800bce <sys_yield>
+  8034db:	eb e2                	jmp    8034bf <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8034dd:	68 3d 3e 80 00       	push   $0x803e3d
+  8034e2:	68 2c 3c 80 00       	push   $0x803c2c
+  8034e7:	6a 5c                	push   $0x5c
+  8034e9:	68 52 3e 80 00       	push   $0x803e52
+  8034ee:	e8 25 cc ff ff       	call   800118 <_panic>
+	}
+}
+  8034f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034f6:	5b                   	pop    %ebx
+  8034f7:	5e                   	pop    %esi
+  8034f8:	5f                   	pop    %edi
+  8034f9:	5d                   	pop    %ebp
+  8034fa:	c3                   	ret
+
+008034fb <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8034fb:	55                   	push   %ebp
+  8034fc:	89 e5                	mov    %esp,%ebp
+  8034fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803501:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803506:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80350c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803512:	8b 52 50             	mov    0x50(%edx),%edx
+  803515:	39 ca                	cmp    %ecx,%edx
+  803517:	74 11                	je     80352a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803519:	83 c0 01             	add    $0x1,%eax
+  80351c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803521:	75 e3                	jne    803506 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803523:	b8 00 00 00 00       	mov    $0x0,%eax
+  803528:	eb 0e                	jmp    803538 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80352a:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803530:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803535:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803538:	5d                   	pop    %ebp
+  803539:	c3                   	ret
+
+0080353a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80353a:	55                   	push   %ebp
+  80353b:	89 e5                	mov    %esp,%ebp
+  80353d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803540:	89 c2                	mov    %eax,%edx
+  803542:	c1 ea 16             	shr    $0x16,%edx
+  803545:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80354c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803551:	f6 c1 01             	test   $0x1,%cl
+  803554:	74 22                	je     803578 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803556:	c1 e8 0c             	shr    $0xc,%eax
+  803559:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803560:	a8 01                	test   $0x1,%al
+  803562:	74 14                	je     803578 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803564:	c1 e8 0c             	shr    $0xc,%eax
+  803567:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80356a:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803571:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803575:	0f b7 d2             	movzwl %dx,%edx
+}
+  803578:	89 d0                	mov    %edx,%eax
+  80357a:	5d                   	pop    %ebp
+  80357b:	c3                   	ret
+
+0080357c <dm>:
+  80357c:	55                   	push   %ebp
+  80357d:	57                   	push   %edi
+  80357e:	56                   	push   %esi
+  80357f:	53                   	push   %ebx
+  803580:	83 ec 24             	sub    $0x24,%esp
+  803583:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803587:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80358b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80358f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803593:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803597:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80359b:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80359f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035ae:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035b5:	00 
+  8035b6:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035bd:	00 
+  8035be:	89 fb                	mov    %edi,%ebx
+  8035c0:	eb 08                	jmp    8035ca <dm+0x4e>
+  8035c2:	83 e9 01             	sub    $0x1,%ecx
+  8035c5:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8035c8:	74 68                	je     803632 <dm+0xb6>
+  8035ca:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8035ce:	01 c0                	add    %eax,%eax
+  8035d0:	89 c6                	mov    %eax,%esi
+  8035d2:	89 d7                	mov    %edx,%edi
+  8035d4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8035d8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8035dc:	0f ad d0             	shrd   %cl,%edx,%eax
+  8035df:	d3 ea                	shr    %cl,%edx
+  8035e1:	f6 c1 20             	test   $0x20,%cl
+  8035e4:	74 04                	je     8035ea <dm+0x6e>
+  8035e6:	89 d0                	mov    %edx,%eax
+  8035e8:	31 d2                	xor    %edx,%edx
+  8035ea:	83 e0 01             	and    $0x1,%eax
+  8035ed:	89 04 24             	mov    %eax,(%esp)
+  8035f0:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8035f7:	00 
+  8035f8:	8b 04 24             	mov    (%esp),%eax
+  8035fb:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8035ff:	09 f0                	or     %esi,%eax
+  803601:	09 fa                	or     %edi,%edx
+  803603:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803607:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80360b:	39 f0                	cmp    %esi,%eax
+  80360d:	89 d5                	mov    %edx,%ebp
+  80360f:	19 fd                	sbb    %edi,%ebp
+  803611:	72 af                	jb     8035c2 <dm+0x46>
+  803613:	29 f0                	sub    %esi,%eax
+  803615:	19 fa                	sbb    %edi,%edx
+  803617:	89 cf                	mov    %ecx,%edi
+  803619:	c1 ef 05             	shr    $0x5,%edi
+  80361c:	83 e7 01             	and    $0x1,%edi
+  80361f:	89 fe                	mov    %edi,%esi
+  803621:	83 f6 01             	xor    $0x1,%esi
+  803624:	d3 e6                	shl    %cl,%esi
+  803626:	d3 e7                	shl    %cl,%edi
+  803628:	09 74 24 18          	or     %esi,0x18(%esp)
+  80362c:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803630:	eb 90                	jmp    8035c2 <dm+0x46>
+  803632:	85 db                	test   %ebx,%ebx
+  803634:	74 05                	je     80363b <dm+0xbf>
+  803636:	89 03                	mov    %eax,(%ebx)
+  803638:	89 53 04             	mov    %edx,0x4(%ebx)
+  80363b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80363f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803643:	83 c4 24             	add    $0x24,%esp
+  803646:	5b                   	pop    %ebx
+  803647:	5e                   	pop    %esi
+  803648:	5f                   	pop    %edi
+  803649:	5d                   	pop    %ebp
+  80364a:	c3                   	ret
+
+0080364b <__udivdi3>:
+  80364b:	83 ec 08             	sub    $0x8,%esp
+  80364e:	6a 00                	push   $0x0
+  803650:	ff 74 24 1c          	push   0x1c(%esp)
+  803654:	ff 74 24 1c          	push   0x1c(%esp)
+  803658:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80365c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803660:	e8 17 ff ff ff       	call   80357c <dm>
+  803665:	83 c4 14             	add    $0x14,%esp
+  803668:	c3                   	ret
+
+00803669 <__umoddi3>:
+  803669:	83 ec 18             	sub    $0x18,%esp
+  80366c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803670:	50                   	push   %eax
+  803671:	ff 74 24 2c          	push   0x2c(%esp)
+  803675:	ff 74 24 2c          	push   0x2c(%esp)
+  803679:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80367d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803681:	e8 f6 fe ff ff       	call   80357c <dm>
+  803686:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80368a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80368e:	83 c4 24             	add    $0x24,%esp
+  803691:	c3                   	ret
+
+00803692 <__divdi3>:
+  803692:	53                   	push   %ebx
+  803693:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803697:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80369b:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80369f:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036a3:	85 d2                	test   %edx,%edx
+  8036a5:	78 15                	js     8036bc <__divdi3+0x2a>
+  8036a7:	85 db                	test   %ebx,%ebx
+  8036a9:	78 34                	js     8036df <__divdi3+0x4d>
+  8036ab:	83 ec 04             	sub    $0x4,%esp
+  8036ae:	6a 00                	push   $0x0
+  8036b0:	53                   	push   %ebx
+  8036b1:	51                   	push   %ecx
+  8036b2:	e8 c5 fe ff ff       	call   80357c <dm>
+  8036b7:	83 c4 10             	add    $0x10,%esp
+  8036ba:	eb 21                	jmp    8036dd <__divdi3+0x4b>
+  8036bc:	f7 d8                	neg    %eax
+  8036be:	83 d2 00             	adc    $0x0,%edx
+  8036c1:	f7 da                	neg    %edx
+  8036c3:	85 db                	test   %ebx,%ebx
+  8036c5:	78 30                	js     8036f7 <__divdi3+0x65>
+  8036c7:	83 ec 04             	sub    $0x4,%esp
+  8036ca:	6a 00                	push   $0x0
+  8036cc:	53                   	push   %ebx
+  8036cd:	51                   	push   %ecx
+  8036ce:	e8 a9 fe ff ff       	call   80357c <dm>
+  8036d3:	83 c4 10             	add    $0x10,%esp
+  8036d6:	f7 d8                	neg    %eax
+  8036d8:	83 d2 00             	adc    $0x0,%edx
+  8036db:	f7 da                	neg    %edx
+  8036dd:	5b                   	pop    %ebx
+  8036de:	c3                   	ret
+  8036df:	83 ec 04             	sub    $0x4,%esp
+  8036e2:	6a 00                	push   $0x0
+  8036e4:	f7 d9                	neg    %ecx
+  8036e6:	83 d3 00             	adc    $0x0,%ebx
+  8036e9:	f7 db                	neg    %ebx
+  8036eb:	53                   	push   %ebx
+  8036ec:	51                   	push   %ecx
+  8036ed:	e8 8a fe ff ff       	call   80357c <dm>
+  8036f2:	83 c4 10             	add    $0x10,%esp
+  8036f5:	eb df                	jmp    8036d6 <__divdi3+0x44>
+  8036f7:	83 ec 04             	sub    $0x4,%esp
+  8036fa:	6a 00                	push   $0x0
+  8036fc:	f7 d9                	neg    %ecx
+  8036fe:	83 d3 00             	adc    $0x0,%ebx
+  803701:	f7 db                	neg    %ebx
+  803703:	53                   	push   %ebx
+  803704:	51                   	push   %ecx
+  803705:	e8 72 fe ff ff       	call   80357c <dm>
+  80370a:	83 c4 10             	add    $0x10,%esp
+  80370d:	eb ce                	jmp    8036dd <__divdi3+0x4b>
+
+0080370f <__moddi3>:
+  80370f:	55                   	push   %ebp
+  803710:	57                   	push   %edi
+  803711:	56                   	push   %esi
+  803712:	53                   	push   %ebx
+  803713:	83 ec 24             	sub    $0x24,%esp
+  803716:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80371a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80371e:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803722:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803726:	85 d2                	test   %edx,%edx
+  803728:	78 3b                	js     803765 <__moddi3+0x56>
+  80372a:	83 ec 04             	sub    $0x4,%esp
+  80372d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803731:	56                   	push   %esi
+  803732:	89 ce                	mov    %ecx,%esi
+  803734:	f7 de                	neg    %esi
+  803736:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80373a:	89 de                	mov    %ebx,%esi
+  80373c:	83 d6 00             	adc    $0x0,%esi
+  80373f:	f7 de                	neg    %esi
+  803741:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803745:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803749:	0f 48 f1             	cmovs  %ecx,%esi
+  80374c:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803751:	53                   	push   %ebx
+  803752:	56                   	push   %esi
+  803753:	e8 24 fe ff ff       	call   80357c <dm>
+  803758:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80375c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803760:	83 c4 10             	add    $0x10,%esp
+  803763:	eb 47                	jmp    8037ac <__moddi3+0x9d>
+  803765:	f7 d8                	neg    %eax
+  803767:	83 d2 00             	adc    $0x0,%edx
+  80376a:	f7 da                	neg    %edx
+  80376c:	83 ec 04             	sub    $0x4,%esp
+  80376f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803773:	56                   	push   %esi
+  803774:	89 cf                	mov    %ecx,%edi
+  803776:	f7 df                	neg    %edi
+  803778:	89 de                	mov    %ebx,%esi
+  80377a:	83 d6 00             	adc    $0x0,%esi
+  80377d:	f7 de                	neg    %esi
+  80377f:	0f 49 cf             	cmovns %edi,%ecx
+  803782:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803786:	0f 49 de             	cmovns %esi,%ebx
+  803789:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80378d:	ff 74 24 0c          	push   0xc(%esp)
+  803791:	ff 74 24 0c          	push   0xc(%esp)
+  803795:	e8 e2 fd ff ff       	call   80357c <dm>
+  80379a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80379e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037a2:	f7 d8                	neg    %eax
+  8037a4:	83 d2 00             	adc    $0x0,%edx
+  8037a7:	f7 da                	neg    %edx
+  8037a9:	83 c4 10             	add    $0x10,%esp
+  8037ac:	83 c4 24             	add    $0x24,%esp
+  8037af:	5b                   	pop    %ebx
+  8037b0:	5e                   	pop    %esi
+  8037b1:	5f                   	pop    %edi
+  8037b2:	5d                   	pop    %ebp
+  8037b3:	c3                   	ret
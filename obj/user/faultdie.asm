@@ -0,0 +1,7657 @@
+
+obj/user/faultdie.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4f 00 00 00       	call   800080 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+  800039:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void*)utf->utf_fault_va;
+	uint32_t err = utf->utf_err;
+	cprintf("i faulted at va %x, err %x\n", addr, err & 7);
+  80003c:	8b 42 04             	mov    0x4(%edx),%eax
+  80003f:	83 e0 07             	and    $0x7,%eax
+  800042:	50                   	push   %eax
+  800043:	ff 32                	push   (%edx)
+  800045:	68 80 37 80 00       	push   $0x803780
+  80004a:	e8 29 01 00 00       	call   800178 <cprintf>
+	sys_env_destroy(sys_getenvid());
+  80004f:	e8 d8 0a 00 00       	call   800b2c <sys_getenvid>
+  800054:	89 04 24             	mov    %eax,(%esp)
+  800057:	e8 87 0a 00 00       	call   800ae3 <sys_env_destroy>
+}
+  80005c:	83 c4 10             	add    $0x10,%esp
+  80005f:	c9                   	leave
+  800060:	c3                   	ret
+
+00800061 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800061:	55                   	push   %ebp
+  800062:	89 e5                	mov    %esp,%ebp
+  800064:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800067:	68 33 00 80 00       	push   $0x800033
+  80006c:	e8 02 0f 00 00       	call   800f73 <set_pgfault_handler>
+	*(int*)0xDeadBeef = 0;
+  800071:	c7 05 ef be ad de 00 	movl   $0x0,0xdeadbeef
+  800078:	00 00 00 
+}
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	c9                   	leave
+  80007f:	c3                   	ret
+
+00800080 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800080:	55                   	push   %ebp
+  800081:	89 e5                	mov    %esp,%ebp
+  800083:	56                   	push   %esi
+  800084:	53                   	push   %ebx
+  800085:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800088:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80008b:	e8 9c 0a 00 00       	call   800b2c <sys_getenvid>
+  800090:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800095:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80009b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000a0:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000a5:	85 db                	test   %ebx,%ebx
+  8000a7:	7e 07                	jle    8000b0 <libmain+0x30>
+		binaryname = argv[0];
+  8000a9:	8b 06                	mov    (%esi),%eax
+  8000ab:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000b0:	83 ec 08             	sub    $0x8,%esp
+  8000b3:	56                   	push   %esi
+  8000b4:	53                   	push   %ebx
+  8000b5:	e8 a7 ff ff ff       	call   800061 <umain>
+
+	// exit gracefully
+	exit();
+  8000ba:	e8 0a 00 00 00       	call   8000c9 <exit>
+}
+  8000bf:	83 c4 10             	add    $0x10,%esp
+  8000c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c5:	5b                   	pop    %ebx
+  8000c6:	5e                   	pop    %esi
+  8000c7:	5d                   	pop    %ebp
+  8000c8:	c3                   	ret
+
+008000c9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c9:	55                   	push   %ebp
+  8000ca:	89 e5                	mov    %esp,%ebp
+  8000cc:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000cf:	e8 0c 11 00 00       	call   8011e0 <close_all>
+	sys_env_destroy(0);
+  8000d4:	83 ec 0c             	sub    $0xc,%esp
+  8000d7:	6a 00                	push   $0x0
+  8000d9:	e8 05 0a 00 00       	call   800ae3 <sys_env_destroy>
+}
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+
+008000e3 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	53                   	push   %ebx
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000ed:	8b 13                	mov    (%ebx),%edx
+  8000ef:	8d 42 01             	lea    0x1(%edx),%eax
+  8000f2:	89 03                	mov    %eax,(%ebx)
+  8000f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000f7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000fb:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800100:	74 09                	je     80010b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800102:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800106:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800109:	c9                   	leave
+  80010a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80010b:	83 ec 08             	sub    $0x8,%esp
+  80010e:	68 ff 00 00 00       	push   $0xff
+  800113:	8d 43 08             	lea    0x8(%ebx),%eax
+  800116:	50                   	push   %eax
+  800117:	e8 7a 09 00 00       	call   800a96 <sys_cputs>
+		b->idx = 0;
+  80011c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	eb db                	jmp    800102 <putch+0x1f>
+
+00800127 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800127:	55                   	push   %ebp
+  800128:	89 e5                	mov    %esp,%ebp
+  80012a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800130:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800137:	00 00 00 
+	b.cnt = 0;
+  80013a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800141:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800144:	ff 75 0c             	push   0xc(%ebp)
+  800147:	ff 75 08             	push   0x8(%ebp)
+  80014a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800150:	50                   	push   %eax
+  800151:	68 e3 00 80 00       	push   $0x8000e3
+  800156:	e8 14 01 00 00       	call   80026f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80015b:	83 c4 08             	add    $0x8,%esp
+  80015e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800164:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80016a:	50                   	push   %eax
+  80016b:	e8 26 09 00 00       	call   800a96 <sys_cputs>
+
+	return b.cnt;
+}
+  800170:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800176:	c9                   	leave
+  800177:	c3                   	ret
+
+00800178 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800178:	55                   	push   %ebp
+  800179:	89 e5                	mov    %esp,%ebp
+  80017b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80017e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800181:	50                   	push   %eax
+  800182:	ff 75 08             	push   0x8(%ebp)
+  800185:	e8 9d ff ff ff       	call   800127 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80018a:	c9                   	leave
+  80018b:	c3                   	ret
+
+0080018c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80018c:	55                   	push   %ebp
+  80018d:	89 e5                	mov    %esp,%ebp
+  80018f:	57                   	push   %edi
+  800190:	56                   	push   %esi
+  800191:	53                   	push   %ebx
+  800192:	83 ec 1c             	sub    $0x1c,%esp
+  800195:	89 c7                	mov    %eax,%edi
+  800197:	89 d6                	mov    %edx,%esi
+  800199:	8b 45 08             	mov    0x8(%ebp),%eax
+  80019c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80019f:	89 d1                	mov    %edx,%ecx
+  8001a1:	89 c2                	mov    %eax,%edx
+  8001a3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001a6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001a9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ac:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001b2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001b9:	39 c2                	cmp    %eax,%edx
+  8001bb:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001be:	72 3e                	jb     8001fe <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001c0:	83 ec 0c             	sub    $0xc,%esp
+  8001c3:	ff 75 18             	push   0x18(%ebp)
+  8001c6:	83 eb 01             	sub    $0x1,%ebx
+  8001c9:	53                   	push   %ebx
+  8001ca:	50                   	push   %eax
+  8001cb:	83 ec 08             	sub    $0x8,%esp
+  8001ce:	ff 75 e4             	push   -0x1c(%ebp)
+  8001d1:	ff 75 e0             	push   -0x20(%ebp)
+  8001d4:	ff 75 dc             	push   -0x24(%ebp)
+  8001d7:	ff 75 d8             	push   -0x28(%ebp)
+  8001da:	e8 37 34 00 00       	call   803616 <__udivdi3>
+  8001df:	83 c4 18             	add    $0x18,%esp
+  8001e2:	52                   	push   %edx
+  8001e3:	50                   	push   %eax
+  8001e4:	89 f2                	mov    %esi,%edx
+  8001e6:	89 f8                	mov    %edi,%eax
+  8001e8:	e8 9f ff ff ff       	call   80018c <printnum>
+  8001ed:	83 c4 20             	add    $0x20,%esp
+  8001f0:	eb 13                	jmp    800205 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001f2:	83 ec 08             	sub    $0x8,%esp
+  8001f5:	56                   	push   %esi
+  8001f6:	ff 75 18             	push   0x18(%ebp)
+  8001f9:	ff d7                	call   *%edi
+  8001fb:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001fe:	83 eb 01             	sub    $0x1,%ebx
+  800201:	85 db                	test   %ebx,%ebx
+  800203:	7f ed                	jg     8001f2 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800205:	83 ec 08             	sub    $0x8,%esp
+  800208:	56                   	push   %esi
+  800209:	83 ec 04             	sub    $0x4,%esp
+  80020c:	ff 75 e4             	push   -0x1c(%ebp)
+  80020f:	ff 75 e0             	push   -0x20(%ebp)
+  800212:	ff 75 dc             	push   -0x24(%ebp)
+  800215:	ff 75 d8             	push   -0x28(%ebp)
+  800218:	e8 17 34 00 00       	call   803634 <__umoddi3>
+  80021d:	83 c4 14             	add    $0x14,%esp
+  800220:	0f be 80 a6 37 80 00 	movsbl 0x8037a6(%eax),%eax
+  800227:	50                   	push   %eax
+  800228:	ff d7                	call   *%edi
+}
+  80022a:	83 c4 10             	add    $0x10,%esp
+  80022d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800230:	5b                   	pop    %ebx
+  800231:	5e                   	pop    %esi
+  800232:	5f                   	pop    %edi
+  800233:	5d                   	pop    %ebp
+  800234:	c3                   	ret
+
+00800235 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800235:	55                   	push   %ebp
+  800236:	89 e5                	mov    %esp,%ebp
+  800238:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80023b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80023f:	8b 10                	mov    (%eax),%edx
+  800241:	3b 50 04             	cmp    0x4(%eax),%edx
+  800244:	73 0a                	jae    800250 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800246:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800249:	89 08                	mov    %ecx,(%eax)
+  80024b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80024e:	88 02                	mov    %al,(%edx)
+}
+  800250:	5d                   	pop    %ebp
+  800251:	c3                   	ret
+
+00800252 <printfmt>:
+{
+  800252:	55                   	push   %ebp
+  800253:	89 e5                	mov    %esp,%ebp
+  800255:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800258:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80025b:	50                   	push   %eax
+  80025c:	ff 75 10             	push   0x10(%ebp)
+  80025f:	ff 75 0c             	push   0xc(%ebp)
+  800262:	ff 75 08             	push   0x8(%ebp)
+  800265:	e8 05 00 00 00       	call   80026f <vprintfmt>
+}
+  80026a:	83 c4 10             	add    $0x10,%esp
+  80026d:	c9                   	leave
+  80026e:	c3                   	ret
+
+0080026f <vprintfmt>:
+{
+  80026f:	55                   	push   %ebp
+  800270:	89 e5                	mov    %esp,%ebp
+  800272:	57                   	push   %edi
+  800273:	56                   	push   %esi
+  800274:	53                   	push   %ebx
+  800275:	83 ec 2c             	sub    $0x2c,%esp
+  800278:	8b 75 08             	mov    0x8(%ebp),%esi
+  80027b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80027e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800281:	eb 0a                	jmp    80028d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800283:	83 ec 08             	sub    $0x8,%esp
+  800286:	53                   	push   %ebx
+  800287:	50                   	push   %eax
+  800288:	ff d6                	call   *%esi
+  80028a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80028d:	83 c7 01             	add    $0x1,%edi
+  800290:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800294:	83 f8 25             	cmp    $0x25,%eax
+  800297:	74 0c                	je     8002a5 <vprintfmt+0x36>
+			if (ch == '\0')
+  800299:	85 c0                	test   %eax,%eax
+  80029b:	75 e6                	jne    800283 <vprintfmt+0x14>
+}
+  80029d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a0:	5b                   	pop    %ebx
+  8002a1:	5e                   	pop    %esi
+  8002a2:	5f                   	pop    %edi
+  8002a3:	5d                   	pop    %ebp
+  8002a4:	c3                   	ret
+		padc = ' ';
+  8002a5:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002a9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002b0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002b7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002be:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002c3:	8d 47 01             	lea    0x1(%edi),%eax
+  8002c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002c9:	0f b6 17             	movzbl (%edi),%edx
+  8002cc:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002cf:	3c 55                	cmp    $0x55,%al
+  8002d1:	0f 87 cf 03 00 00    	ja     8006a6 <vprintfmt+0x437>
+  8002d7:	0f b6 c0             	movzbl %al,%eax
+  8002da:	ff 24 85 00 39 80 00 	jmp    *0x803900(,%eax,4)
+  8002e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002e4:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002e8:	eb d9                	jmp    8002c3 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002ed:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002f1:	eb d0                	jmp    8002c3 <vprintfmt+0x54>
+  8002f3:	0f b6 d2             	movzbl %dl,%edx
+  8002f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fe:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800301:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800304:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800308:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80030b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80030e:	83 f9 09             	cmp    $0x9,%ecx
+  800311:	77 55                	ja     800368 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800313:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800316:	eb e9                	jmp    800301 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800318:	8b 45 14             	mov    0x14(%ebp),%eax
+  80031b:	8b 00                	mov    (%eax),%eax
+  80031d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800320:	8b 45 14             	mov    0x14(%ebp),%eax
+  800323:	8d 40 04             	lea    0x4(%eax),%eax
+  800326:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800329:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80032c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800330:	79 91                	jns    8002c3 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800332:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800335:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800338:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80033f:	eb 82                	jmp    8002c3 <vprintfmt+0x54>
+			if (width < 0)
+  800341:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800344:	85 d2                	test   %edx,%edx
+  800346:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034b:	0f 49 c2             	cmovns %edx,%eax
+  80034e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800351:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800354:	e9 6a ff ff ff       	jmp    8002c3 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800359:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80035c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800363:	e9 5b ff ff ff       	jmp    8002c3 <vprintfmt+0x54>
+  800368:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80036b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80036e:	eb bc                	jmp    80032c <vprintfmt+0xbd>
+			lflag++;
+  800370:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800373:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800376:	e9 48 ff ff ff       	jmp    8002c3 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80037b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037e:	8d 78 04             	lea    0x4(%eax),%edi
+  800381:	83 ec 08             	sub    $0x8,%esp
+  800384:	53                   	push   %ebx
+  800385:	ff 30                	push   (%eax)
+  800387:	ff d6                	call   *%esi
+			break;
+  800389:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80038c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80038f:	e9 b1 02 00 00       	jmp    800645 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800394:	8b 45 14             	mov    0x14(%ebp),%eax
+  800397:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80039a:	8b 10                	mov    (%eax),%edx
+  80039c:	89 d0                	mov    %edx,%eax
+  80039e:	f7 d8                	neg    %eax
+  8003a0:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003a3:	83 f8 11             	cmp    $0x11,%eax
+  8003a6:	7f 23                	jg     8003cb <vprintfmt+0x15c>
+  8003a8:	8b 14 85 60 3a 80 00 	mov    0x803a60(,%eax,4),%edx
+  8003af:	85 d2                	test   %edx,%edx
+  8003b1:	74 18                	je     8003cb <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003b3:	52                   	push   %edx
+  8003b4:	68 7e 3b 80 00       	push   $0x803b7e
+  8003b9:	53                   	push   %ebx
+  8003ba:	56                   	push   %esi
+  8003bb:	e8 92 fe ff ff       	call   800252 <printfmt>
+  8003c0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003c3:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003c6:	e9 7a 02 00 00       	jmp    800645 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003cb:	50                   	push   %eax
+  8003cc:	68 be 37 80 00       	push   $0x8037be
+  8003d1:	53                   	push   %ebx
+  8003d2:	56                   	push   %esi
+  8003d3:	e8 7a fe ff ff       	call   800252 <printfmt>
+  8003d8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003db:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003de:	e9 62 02 00 00       	jmp    800645 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e6:	83 c0 04             	add    $0x4,%eax
+  8003e9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ef:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003f1:	85 c9                	test   %ecx,%ecx
+  8003f3:	b8 b7 37 80 00       	mov    $0x8037b7,%eax
+  8003f8:	0f 45 c1             	cmovne %ecx,%eax
+  8003fb:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003fe:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800402:	7e 06                	jle    80040a <vprintfmt+0x19b>
+  800404:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800408:	75 0b                	jne    800415 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80040a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80040d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800410:	89 75 08             	mov    %esi,0x8(%ebp)
+  800413:	eb 5c                	jmp    800471 <vprintfmt+0x202>
+  800415:	83 ec 08             	sub    $0x8,%esp
+  800418:	ff 75 d0             	push   -0x30(%ebp)
+  80041b:	ff 75 cc             	push   -0x34(%ebp)
+  80041e:	e8 20 03 00 00       	call   800743 <strnlen>
+  800423:	89 c2                	mov    %eax,%edx
+  800425:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800428:	29 d0                	sub    %edx,%eax
+  80042a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80042d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800431:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800434:	89 75 08             	mov    %esi,0x8(%ebp)
+  800437:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800439:	eb 0e                	jmp    800449 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80043b:	83 ec 08             	sub    $0x8,%esp
+  80043e:	53                   	push   %ebx
+  80043f:	57                   	push   %edi
+  800440:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800443:	83 ee 01             	sub    $0x1,%esi
+  800446:	83 c4 10             	add    $0x10,%esp
+  800449:	85 f6                	test   %esi,%esi
+  80044b:	7f ee                	jg     80043b <vprintfmt+0x1cc>
+  80044d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800450:	8b 75 08             	mov    0x8(%ebp),%esi
+  800453:	85 c0                	test   %eax,%eax
+  800455:	ba 00 00 00 00       	mov    $0x0,%edx
+  80045a:	0f 49 d0             	cmovns %eax,%edx
+  80045d:	29 d0                	sub    %edx,%eax
+  80045f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800462:	eb a6                	jmp    80040a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800464:	83 ec 08             	sub    $0x8,%esp
+  800467:	53                   	push   %ebx
+  800468:	52                   	push   %edx
+  800469:	ff 55 08             	call   *0x8(%ebp)
+  80046c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80046f:	89 f1                	mov    %esi,%ecx
+  800471:	8d 71 01             	lea    0x1(%ecx),%esi
+  800474:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800478:	0f be d0             	movsbl %al,%edx
+  80047b:	85 d2                	test   %edx,%edx
+  80047d:	74 28                	je     8004a7 <vprintfmt+0x238>
+  80047f:	85 ff                	test   %edi,%edi
+  800481:	78 05                	js     800488 <vprintfmt+0x219>
+  800483:	83 ef 01             	sub    $0x1,%edi
+  800486:	78 30                	js     8004b8 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800488:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80048c:	74 d6                	je     800464 <vprintfmt+0x1f5>
+  80048e:	0f be c0             	movsbl %al,%eax
+  800491:	83 e8 20             	sub    $0x20,%eax
+  800494:	83 f8 5e             	cmp    $0x5e,%eax
+  800497:	76 cb                	jbe    800464 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800499:	83 ec 08             	sub    $0x8,%esp
+  80049c:	53                   	push   %ebx
+  80049d:	6a 3f                	push   $0x3f
+  80049f:	ff 55 08             	call   *0x8(%ebp)
+  8004a2:	83 c4 10             	add    $0x10,%esp
+  8004a5:	eb c8                	jmp    80046f <vprintfmt+0x200>
+  8004a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004aa:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ad:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004b0:	01 d0                	add    %edx,%eax
+  8004b2:	29 c8                	sub    %ecx,%eax
+  8004b4:	89 c7                	mov    %eax,%edi
+  8004b6:	eb 13                	jmp    8004cb <vprintfmt+0x25c>
+  8004b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004bb:	eb ed                	jmp    8004aa <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004bd:	83 ec 08             	sub    $0x8,%esp
+  8004c0:	53                   	push   %ebx
+  8004c1:	6a 20                	push   $0x20
+  8004c3:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004c5:	83 ef 01             	sub    $0x1,%edi
+  8004c8:	83 c4 10             	add    $0x10,%esp
+  8004cb:	85 ff                	test   %edi,%edi
+  8004cd:	7f ee                	jg     8004bd <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004cf:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004d2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004d5:	e9 6b 01 00 00       	jmp    800645 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004da:	83 f9 01             	cmp    $0x1,%ecx
+  8004dd:	7f 1f                	jg     8004fe <vprintfmt+0x28f>
+	else if (lflag)
+  8004df:	85 c9                	test   %ecx,%ecx
+  8004e1:	74 67                	je     80054a <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e6:	8b 00                	mov    (%eax),%eax
+  8004e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004eb:	89 c1                	mov    %eax,%ecx
+  8004ed:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004f0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8004f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004fc:	eb 17                	jmp    800515 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800501:	8b 50 04             	mov    0x4(%eax),%edx
+  800504:	8b 00                	mov    (%eax),%eax
+  800506:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800509:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80050c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050f:	8d 40 08             	lea    0x8(%eax),%eax
+  800512:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800515:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800518:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80051b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800520:	85 c9                	test   %ecx,%ecx
+  800522:	0f 89 03 01 00 00    	jns    80062b <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800528:	83 ec 08             	sub    $0x8,%esp
+  80052b:	53                   	push   %ebx
+  80052c:	6a 2d                	push   $0x2d
+  80052e:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800530:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800533:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800536:	f7 da                	neg    %edx
+  800538:	83 d1 00             	adc    $0x0,%ecx
+  80053b:	f7 d9                	neg    %ecx
+  80053d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800540:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800545:	e9 e1 00 00 00       	jmp    80062b <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80054a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054d:	8b 00                	mov    (%eax),%eax
+  80054f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800552:	89 c1                	mov    %eax,%ecx
+  800554:	c1 f9 1f             	sar    $0x1f,%ecx
+  800557:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80055a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055d:	8d 40 04             	lea    0x4(%eax),%eax
+  800560:	89 45 14             	mov    %eax,0x14(%ebp)
+  800563:	eb b0                	jmp    800515 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800565:	83 f9 01             	cmp    $0x1,%ecx
+  800568:	7f 1e                	jg     800588 <vprintfmt+0x319>
+	else if (lflag)
+  80056a:	85 c9                	test   %ecx,%ecx
+  80056c:	74 32                	je     8005a0 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80056e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800571:	8b 10                	mov    (%eax),%edx
+  800573:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800578:	8d 40 04             	lea    0x4(%eax),%eax
+  80057b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80057e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800583:	e9 a3 00 00 00       	jmp    80062b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800588:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058b:	8b 10                	mov    (%eax),%edx
+  80058d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800590:	8d 40 08             	lea    0x8(%eax),%eax
+  800593:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800596:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80059b:	e9 8b 00 00 00       	jmp    80062b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a3:	8b 10                	mov    (%eax),%edx
+  8005a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ad:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005b0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005b5:	eb 74                	jmp    80062b <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005b7:	83 f9 01             	cmp    $0x1,%ecx
+  8005ba:	7f 1b                	jg     8005d7 <vprintfmt+0x368>
+	else if (lflag)
+  8005bc:	85 c9                	test   %ecx,%ecx
+  8005be:	74 2c                	je     8005ec <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c3:	8b 10                	mov    (%eax),%edx
+  8005c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8005cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005d0:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005d5:	eb 54                	jmp    80062b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005da:	8b 10                	mov    (%eax),%edx
+  8005dc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005df:	8d 40 08             	lea    0x8(%eax),%eax
+  8005e2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005e5:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005ea:	eb 3f                	jmp    80062b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ef:	8b 10                	mov    (%eax),%edx
+  8005f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005fc:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800601:	eb 28                	jmp    80062b <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800603:	83 ec 08             	sub    $0x8,%esp
+  800606:	53                   	push   %ebx
+  800607:	6a 30                	push   $0x30
+  800609:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80060b:	83 c4 08             	add    $0x8,%esp
+  80060e:	53                   	push   %ebx
+  80060f:	6a 78                	push   $0x78
+  800611:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800613:	8b 45 14             	mov    0x14(%ebp),%eax
+  800616:	8b 10                	mov    (%eax),%edx
+  800618:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80061d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800620:	8d 40 04             	lea    0x4(%eax),%eax
+  800623:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800626:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80062b:	83 ec 0c             	sub    $0xc,%esp
+  80062e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800632:	50                   	push   %eax
+  800633:	ff 75 e0             	push   -0x20(%ebp)
+  800636:	57                   	push   %edi
+  800637:	51                   	push   %ecx
+  800638:	52                   	push   %edx
+  800639:	89 da                	mov    %ebx,%edx
+  80063b:	89 f0                	mov    %esi,%eax
+  80063d:	e8 4a fb ff ff       	call   80018c <printnum>
+			break;
+  800642:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800645:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800648:	e9 40 fc ff ff       	jmp    80028d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80064d:	83 f9 01             	cmp    $0x1,%ecx
+  800650:	7f 1b                	jg     80066d <vprintfmt+0x3fe>
+	else if (lflag)
+  800652:	85 c9                	test   %ecx,%ecx
+  800654:	74 2c                	je     800682 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800656:	8b 45 14             	mov    0x14(%ebp),%eax
+  800659:	8b 10                	mov    (%eax),%edx
+  80065b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800660:	8d 40 04             	lea    0x4(%eax),%eax
+  800663:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800666:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80066b:	eb be                	jmp    80062b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80066d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800670:	8b 10                	mov    (%eax),%edx
+  800672:	8b 48 04             	mov    0x4(%eax),%ecx
+  800675:	8d 40 08             	lea    0x8(%eax),%eax
+  800678:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80067b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800680:	eb a9                	jmp    80062b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800682:	8b 45 14             	mov    0x14(%ebp),%eax
+  800685:	8b 10                	mov    (%eax),%edx
+  800687:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068c:	8d 40 04             	lea    0x4(%eax),%eax
+  80068f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800692:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800697:	eb 92                	jmp    80062b <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800699:	83 ec 08             	sub    $0x8,%esp
+  80069c:	53                   	push   %ebx
+  80069d:	6a 25                	push   $0x25
+  80069f:	ff d6                	call   *%esi
+			break;
+  8006a1:	83 c4 10             	add    $0x10,%esp
+  8006a4:	eb 9f                	jmp    800645 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006a6:	83 ec 08             	sub    $0x8,%esp
+  8006a9:	53                   	push   %ebx
+  8006aa:	6a 25                	push   $0x25
+  8006ac:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006ae:	83 c4 10             	add    $0x10,%esp
+  8006b1:	89 f8                	mov    %edi,%eax
+  8006b3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006b7:	74 05                	je     8006be <vprintfmt+0x44f>
+  8006b9:	83 e8 01             	sub    $0x1,%eax
+  8006bc:	eb f5                	jmp    8006b3 <vprintfmt+0x444>
+  8006be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006c1:	eb 82                	jmp    800645 <vprintfmt+0x3d6>
+
+008006c3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006c3:	55                   	push   %ebp
+  8006c4:	89 e5                	mov    %esp,%ebp
+  8006c6:	83 ec 18             	sub    $0x18,%esp
+  8006c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006cf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006d2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006d6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006d9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006e0:	85 c0                	test   %eax,%eax
+  8006e2:	74 26                	je     80070a <vsnprintf+0x47>
+  8006e4:	85 d2                	test   %edx,%edx
+  8006e6:	7e 22                	jle    80070a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006e8:	ff 75 14             	push   0x14(%ebp)
+  8006eb:	ff 75 10             	push   0x10(%ebp)
+  8006ee:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006f1:	50                   	push   %eax
+  8006f2:	68 35 02 80 00       	push   $0x800235
+  8006f7:	e8 73 fb ff ff       	call   80026f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006fc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006ff:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800702:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800705:	83 c4 10             	add    $0x10,%esp
+}
+  800708:	c9                   	leave
+  800709:	c3                   	ret
+		return -E_INVAL;
+  80070a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80070f:	eb f7                	jmp    800708 <vsnprintf+0x45>
+
+00800711 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800711:	55                   	push   %ebp
+  800712:	89 e5                	mov    %esp,%ebp
+  800714:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800717:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80071a:	50                   	push   %eax
+  80071b:	ff 75 10             	push   0x10(%ebp)
+  80071e:	ff 75 0c             	push   0xc(%ebp)
+  800721:	ff 75 08             	push   0x8(%ebp)
+  800724:	e8 9a ff ff ff       	call   8006c3 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800729:	c9                   	leave
+  80072a:	c3                   	ret
+
+0080072b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80072b:	55                   	push   %ebp
+  80072c:	89 e5                	mov    %esp,%ebp
+  80072e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800731:	b8 00 00 00 00       	mov    $0x0,%eax
+  800736:	eb 03                	jmp    80073b <strlen+0x10>
+		n++;
+  800738:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80073b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80073f:	75 f7                	jne    800738 <strlen+0xd>
+	return n;
+}
+  800741:	5d                   	pop    %ebp
+  800742:	c3                   	ret
+
+00800743 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800743:	55                   	push   %ebp
+  800744:	89 e5                	mov    %esp,%ebp
+  800746:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800749:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80074c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800751:	eb 03                	jmp    800756 <strnlen+0x13>
+		n++;
+  800753:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800756:	39 d0                	cmp    %edx,%eax
+  800758:	74 08                	je     800762 <strnlen+0x1f>
+  80075a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80075e:	75 f3                	jne    800753 <strnlen+0x10>
+  800760:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800762:	89 d0                	mov    %edx,%eax
+  800764:	5d                   	pop    %ebp
+  800765:	c3                   	ret
+
+00800766 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800766:	55                   	push   %ebp
+  800767:	89 e5                	mov    %esp,%ebp
+  800769:	53                   	push   %ebx
+  80076a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80076d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800770:	b8 00 00 00 00       	mov    $0x0,%eax
+  800775:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800779:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80077c:	83 c0 01             	add    $0x1,%eax
+  80077f:	84 d2                	test   %dl,%dl
+  800781:	75 f2                	jne    800775 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800783:	89 c8                	mov    %ecx,%eax
+  800785:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800788:	c9                   	leave
+  800789:	c3                   	ret
+
+0080078a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80078a:	55                   	push   %ebp
+  80078b:	89 e5                	mov    %esp,%ebp
+  80078d:	53                   	push   %ebx
+  80078e:	83 ec 10             	sub    $0x10,%esp
+  800791:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800794:	53                   	push   %ebx
+  800795:	e8 91 ff ff ff       	call   80072b <strlen>
+  80079a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80079d:	ff 75 0c             	push   0xc(%ebp)
+  8007a0:	01 d8                	add    %ebx,%eax
+  8007a2:	50                   	push   %eax
+  8007a3:	e8 be ff ff ff       	call   800766 <strcpy>
+	return dst;
+}
+  8007a8:	89 d8                	mov    %ebx,%eax
+  8007aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ad:	c9                   	leave
+  8007ae:	c3                   	ret
+
+008007af <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007af:	55                   	push   %ebp
+  8007b0:	89 e5                	mov    %esp,%ebp
+  8007b2:	56                   	push   %esi
+  8007b3:	53                   	push   %ebx
+  8007b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007ba:	89 f3                	mov    %esi,%ebx
+  8007bc:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007bf:	89 f0                	mov    %esi,%eax
+  8007c1:	eb 0f                	jmp    8007d2 <strncpy+0x23>
+		*dst++ = *src;
+  8007c3:	83 c0 01             	add    $0x1,%eax
+  8007c6:	0f b6 0a             	movzbl (%edx),%ecx
+  8007c9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007cc:	80 f9 01             	cmp    $0x1,%cl
+  8007cf:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007d2:	39 d8                	cmp    %ebx,%eax
+  8007d4:	75 ed                	jne    8007c3 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007d6:	89 f0                	mov    %esi,%eax
+  8007d8:	5b                   	pop    %ebx
+  8007d9:	5e                   	pop    %esi
+  8007da:	5d                   	pop    %ebp
+  8007db:	c3                   	ret
+
+008007dc <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007dc:	55                   	push   %ebp
+  8007dd:	89 e5                	mov    %esp,%ebp
+  8007df:	56                   	push   %esi
+  8007e0:	53                   	push   %ebx
+  8007e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007e7:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007ea:	89 f0                	mov    %esi,%eax
+  8007ec:	85 d2                	test   %edx,%edx
+  8007ee:	74 21                	je     800811 <strlcpy+0x35>
+  8007f0:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007f4:	89 f2                	mov    %esi,%edx
+  8007f6:	eb 09                	jmp    800801 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007f8:	83 c1 01             	add    $0x1,%ecx
+  8007fb:	83 c2 01             	add    $0x1,%edx
+  8007fe:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800801:	39 c2                	cmp    %eax,%edx
+  800803:	74 09                	je     80080e <strlcpy+0x32>
+  800805:	0f b6 19             	movzbl (%ecx),%ebx
+  800808:	84 db                	test   %bl,%bl
+  80080a:	75 ec                	jne    8007f8 <strlcpy+0x1c>
+  80080c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80080e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800811:	29 f0                	sub    %esi,%eax
+}
+  800813:	5b                   	pop    %ebx
+  800814:	5e                   	pop    %esi
+  800815:	5d                   	pop    %ebp
+  800816:	c3                   	ret
+
+00800817 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800817:	55                   	push   %ebp
+  800818:	89 e5                	mov    %esp,%ebp
+  80081a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80081d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800820:	eb 06                	jmp    800828 <strcmp+0x11>
+		p++, q++;
+  800822:	83 c1 01             	add    $0x1,%ecx
+  800825:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800828:	0f b6 01             	movzbl (%ecx),%eax
+  80082b:	84 c0                	test   %al,%al
+  80082d:	74 04                	je     800833 <strcmp+0x1c>
+  80082f:	3a 02                	cmp    (%edx),%al
+  800831:	74 ef                	je     800822 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800833:	0f b6 c0             	movzbl %al,%eax
+  800836:	0f b6 12             	movzbl (%edx),%edx
+  800839:	29 d0                	sub    %edx,%eax
+}
+  80083b:	5d                   	pop    %ebp
+  80083c:	c3                   	ret
+
+0080083d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80083d:	55                   	push   %ebp
+  80083e:	89 e5                	mov    %esp,%ebp
+  800840:	53                   	push   %ebx
+  800841:	8b 45 08             	mov    0x8(%ebp),%eax
+  800844:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800847:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80084a:	eb 09                	jmp    800855 <strncmp+0x18>
+		n--, p++, q++;
+  80084c:	83 ea 01             	sub    $0x1,%edx
+  80084f:	83 c0 01             	add    $0x1,%eax
+  800852:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800855:	85 d2                	test   %edx,%edx
+  800857:	74 18                	je     800871 <strncmp+0x34>
+  800859:	0f b6 18             	movzbl (%eax),%ebx
+  80085c:	84 db                	test   %bl,%bl
+  80085e:	74 04                	je     800864 <strncmp+0x27>
+  800860:	3a 19                	cmp    (%ecx),%bl
+  800862:	74 e8                	je     80084c <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800864:	0f b6 00             	movzbl (%eax),%eax
+  800867:	0f b6 11             	movzbl (%ecx),%edx
+  80086a:	29 d0                	sub    %edx,%eax
+}
+  80086c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80086f:	c9                   	leave
+  800870:	c3                   	ret
+		return 0;
+  800871:	b8 00 00 00 00       	mov    $0x0,%eax
+  800876:	eb f4                	jmp    80086c <strncmp+0x2f>
+
+00800878 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800878:	55                   	push   %ebp
+  800879:	89 e5                	mov    %esp,%ebp
+  80087b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800882:	eb 03                	jmp    800887 <strchr+0xf>
+  800884:	83 c0 01             	add    $0x1,%eax
+  800887:	0f b6 10             	movzbl (%eax),%edx
+  80088a:	84 d2                	test   %dl,%dl
+  80088c:	74 06                	je     800894 <strchr+0x1c>
+		if (*s == c)
+  80088e:	38 ca                	cmp    %cl,%dl
+  800890:	75 f2                	jne    800884 <strchr+0xc>
+  800892:	eb 05                	jmp    800899 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800894:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800899:	5d                   	pop    %ebp
+  80089a:	c3                   	ret
+
+0080089b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80089b:	55                   	push   %ebp
+  80089c:	89 e5                	mov    %esp,%ebp
+  80089e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008a1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008a5:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008a8:	38 ca                	cmp    %cl,%dl
+  8008aa:	74 09                	je     8008b5 <strfind+0x1a>
+  8008ac:	84 d2                	test   %dl,%dl
+  8008ae:	74 05                	je     8008b5 <strfind+0x1a>
+	for (; *s; s++)
+  8008b0:	83 c0 01             	add    $0x1,%eax
+  8008b3:	eb f0                	jmp    8008a5 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008b5:	5d                   	pop    %ebp
+  8008b6:	c3                   	ret
+
+008008b7 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008b7:	55                   	push   %ebp
+  8008b8:	89 e5                	mov    %esp,%ebp
+  8008ba:	57                   	push   %edi
+  8008bb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008be:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008c1:	85 c9                	test   %ecx,%ecx
+  8008c3:	74 20                	je     8008e5 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008c5:	89 f8                	mov    %edi,%eax
+  8008c7:	09 c8                	or     %ecx,%eax
+  8008c9:	a8 03                	test   $0x3,%al
+  8008cb:	75 12                	jne    8008df <memset+0x28>
+		c &= 0xFF;
+  8008cd:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008d1:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008d7:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008da:	fc                   	cld
+  8008db:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008dd:	eb 06                	jmp    8008e5 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008e2:	fc                   	cld
+  8008e3:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008e5:	89 f8                	mov    %edi,%eax
+  8008e7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008ea:	c9                   	leave
+  8008eb:	c3                   	ret
+
+008008ec <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008ec:	55                   	push   %ebp
+  8008ed:	89 e5                	mov    %esp,%ebp
+  8008ef:	57                   	push   %edi
+  8008f0:	56                   	push   %esi
+  8008f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008fa:	39 c6                	cmp    %eax,%esi
+  8008fc:	73 32                	jae    800930 <memmove+0x44>
+  8008fe:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800901:	39 d0                	cmp    %edx,%eax
+  800903:	73 2b                	jae    800930 <memmove+0x44>
+		s += n;
+		d += n;
+  800905:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800908:	89 d6                	mov    %edx,%esi
+  80090a:	09 fe                	or     %edi,%esi
+  80090c:	09 ce                	or     %ecx,%esi
+  80090e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800914:	75 0e                	jne    800924 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800916:	83 ef 04             	sub    $0x4,%edi
+  800919:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80091c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80091f:	fd                   	std
+  800920:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800922:	eb 09                	jmp    80092d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800924:	83 ef 01             	sub    $0x1,%edi
+  800927:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80092a:	fd                   	std
+  80092b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80092d:	fc                   	cld
+  80092e:	eb 1a                	jmp    80094a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800930:	89 f2                	mov    %esi,%edx
+  800932:	09 c2                	or     %eax,%edx
+  800934:	09 ca                	or     %ecx,%edx
+  800936:	f6 c2 03             	test   $0x3,%dl
+  800939:	75 0a                	jne    800945 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80093b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80093e:	89 c7                	mov    %eax,%edi
+  800940:	fc                   	cld
+  800941:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800943:	eb 05                	jmp    80094a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800945:	89 c7                	mov    %eax,%edi
+  800947:	fc                   	cld
+  800948:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80094a:	5e                   	pop    %esi
+  80094b:	5f                   	pop    %edi
+  80094c:	5d                   	pop    %ebp
+  80094d:	c3                   	ret
+
+0080094e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80094e:	55                   	push   %ebp
+  80094f:	89 e5                	mov    %esp,%ebp
+  800951:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800954:	ff 75 10             	push   0x10(%ebp)
+  800957:	ff 75 0c             	push   0xc(%ebp)
+  80095a:	ff 75 08             	push   0x8(%ebp)
+  80095d:	e8 8a ff ff ff       	call   8008ec <memmove>
+}
+  800962:	c9                   	leave
+  800963:	c3                   	ret
+
+00800964 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800964:	55                   	push   %ebp
+  800965:	89 e5                	mov    %esp,%ebp
+  800967:	56                   	push   %esi
+  800968:	53                   	push   %ebx
+  800969:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80096f:	89 c6                	mov    %eax,%esi
+  800971:	03 75 10             	add    0x10(%ebp),%esi
+  800974:	eb 06                	jmp    80097c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800976:	83 c0 01             	add    $0x1,%eax
+  800979:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80097c:	39 f0                	cmp    %esi,%eax
+  80097e:	74 14                	je     800994 <memcmp+0x30>
+		if (*s1 != *s2)
+  800980:	0f b6 08             	movzbl (%eax),%ecx
+  800983:	0f b6 1a             	movzbl (%edx),%ebx
+  800986:	38 d9                	cmp    %bl,%cl
+  800988:	74 ec                	je     800976 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80098a:	0f b6 c1             	movzbl %cl,%eax
+  80098d:	0f b6 db             	movzbl %bl,%ebx
+  800990:	29 d8                	sub    %ebx,%eax
+  800992:	eb 05                	jmp    800999 <memcmp+0x35>
+	}
+
+	return 0;
+  800994:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800999:	5b                   	pop    %ebx
+  80099a:	5e                   	pop    %esi
+  80099b:	5d                   	pop    %ebp
+  80099c:	c3                   	ret
+
+0080099d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80099d:	55                   	push   %ebp
+  80099e:	89 e5                	mov    %esp,%ebp
+  8009a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009a6:	89 c2                	mov    %eax,%edx
+  8009a8:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009ab:	eb 03                	jmp    8009b0 <memfind+0x13>
+  8009ad:	83 c0 01             	add    $0x1,%eax
+  8009b0:	39 d0                	cmp    %edx,%eax
+  8009b2:	73 04                	jae    8009b8 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009b4:	38 08                	cmp    %cl,(%eax)
+  8009b6:	75 f5                	jne    8009ad <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009b8:	5d                   	pop    %ebp
+  8009b9:	c3                   	ret
+
+008009ba <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009ba:	55                   	push   %ebp
+  8009bb:	89 e5                	mov    %esp,%ebp
+  8009bd:	57                   	push   %edi
+  8009be:	56                   	push   %esi
+  8009bf:	53                   	push   %ebx
+  8009c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009c6:	eb 03                	jmp    8009cb <strtol+0x11>
+		s++;
+  8009c8:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009cb:	0f b6 02             	movzbl (%edx),%eax
+  8009ce:	3c 20                	cmp    $0x20,%al
+  8009d0:	74 f6                	je     8009c8 <strtol+0xe>
+  8009d2:	3c 09                	cmp    $0x9,%al
+  8009d4:	74 f2                	je     8009c8 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009d6:	3c 2b                	cmp    $0x2b,%al
+  8009d8:	74 2a                	je     800a04 <strtol+0x4a>
+	int neg = 0;
+  8009da:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009df:	3c 2d                	cmp    $0x2d,%al
+  8009e1:	74 2b                	je     800a0e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009e3:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009e9:	75 0f                	jne    8009fa <strtol+0x40>
+  8009eb:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009ee:	74 28                	je     800a18 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009f0:	85 db                	test   %ebx,%ebx
+  8009f2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009f7:	0f 44 d8             	cmove  %eax,%ebx
+  8009fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ff:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a02:	eb 46                	jmp    800a4a <strtol+0x90>
+		s++;
+  800a04:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a07:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a0c:	eb d5                	jmp    8009e3 <strtol+0x29>
+		s++, neg = 1;
+  800a0e:	83 c2 01             	add    $0x1,%edx
+  800a11:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a16:	eb cb                	jmp    8009e3 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a18:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a1c:	74 0e                	je     800a2c <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a1e:	85 db                	test   %ebx,%ebx
+  800a20:	75 d8                	jne    8009fa <strtol+0x40>
+		s++, base = 8;
+  800a22:	83 c2 01             	add    $0x1,%edx
+  800a25:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a2a:	eb ce                	jmp    8009fa <strtol+0x40>
+		s += 2, base = 16;
+  800a2c:	83 c2 02             	add    $0x2,%edx
+  800a2f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a34:	eb c4                	jmp    8009fa <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a36:	0f be c0             	movsbl %al,%eax
+  800a39:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a3c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a3f:	7d 3a                	jge    800a7b <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a41:	83 c2 01             	add    $0x1,%edx
+  800a44:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a48:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a4a:	0f b6 02             	movzbl (%edx),%eax
+  800a4d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a50:	89 f3                	mov    %esi,%ebx
+  800a52:	80 fb 09             	cmp    $0x9,%bl
+  800a55:	76 df                	jbe    800a36 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a57:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a5a:	89 f3                	mov    %esi,%ebx
+  800a5c:	80 fb 19             	cmp    $0x19,%bl
+  800a5f:	77 08                	ja     800a69 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a61:	0f be c0             	movsbl %al,%eax
+  800a64:	83 e8 57             	sub    $0x57,%eax
+  800a67:	eb d3                	jmp    800a3c <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a69:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a6c:	89 f3                	mov    %esi,%ebx
+  800a6e:	80 fb 19             	cmp    $0x19,%bl
+  800a71:	77 08                	ja     800a7b <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a73:	0f be c0             	movsbl %al,%eax
+  800a76:	83 e8 37             	sub    $0x37,%eax
+  800a79:	eb c1                	jmp    800a3c <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a7b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a7f:	74 05                	je     800a86 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a84:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a86:	89 c8                	mov    %ecx,%eax
+  800a88:	f7 d8                	neg    %eax
+  800a8a:	85 ff                	test   %edi,%edi
+  800a8c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a8f:	89 c8                	mov    %ecx,%eax
+  800a91:	5b                   	pop    %ebx
+  800a92:	5e                   	pop    %esi
+  800a93:	5f                   	pop    %edi
+  800a94:	5d                   	pop    %ebp
+  800a95:	c3                   	ret
+
+00800a96 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800a96:	55                   	push   %ebp
+  800a97:	89 e5                	mov    %esp,%ebp
+  800a99:	57                   	push   %edi
+  800a9a:	56                   	push   %esi
+  800a9b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aa4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aa7:	89 c3                	mov    %eax,%ebx
+  800aa9:	89 c7                	mov    %eax,%edi
+  800aab:	55                   	push   %ebp
+  800aac:	89 e5                	mov    %esp,%ebp
+  800aae:	8d 35 b6 0a 80 00    	lea    0x800ab6,%esi
+  800ab4:	0f 34                	sysenter
+  800ab6:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800ab7:	5b                   	pop    %ebx
+  800ab8:	5e                   	pop    %esi
+  800ab9:	5f                   	pop    %edi
+  800aba:	5d                   	pop    %ebp
+  800abb:	c3                   	ret
+
+00800abc <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800abc:	55                   	push   %ebp
+  800abd:	89 e5                	mov    %esp,%ebp
+  800abf:	57                   	push   %edi
+  800ac0:	56                   	push   %esi
+  800ac1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ac2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ac7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800acc:	89 d1                	mov    %edx,%ecx
+  800ace:	89 d3                	mov    %edx,%ebx
+  800ad0:	89 d7                	mov    %edx,%edi
+  800ad2:	55                   	push   %ebp
+  800ad3:	89 e5                	mov    %esp,%ebp
+  800ad5:	8d 35 dd 0a 80 00    	lea    0x800add,%esi
+  800adb:	0f 34                	sysenter
+  800add:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800ade:	5b                   	pop    %ebx
+  800adf:	5e                   	pop    %esi
+  800ae0:	5f                   	pop    %edi
+  800ae1:	5d                   	pop    %ebp
+  800ae2:	c3                   	ret
+
+00800ae3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ae3:	55                   	push   %ebp
+  800ae4:	89 e5                	mov    %esp,%ebp
+  800ae6:	57                   	push   %edi
+  800ae7:	56                   	push   %esi
+  800ae8:	53                   	push   %ebx
+  800ae9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800aec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800af4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800af9:	89 cb                	mov    %ecx,%ebx
+  800afb:	89 cf                	mov    %ecx,%edi
+  800afd:	55                   	push   %ebp
+  800afe:	89 e5                	mov    %esp,%ebp
+  800b00:	8d 35 08 0b 80 00    	lea    0x800b08,%esi
+  800b06:	0f 34                	sysenter
+  800b08:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b09:	85 c0                	test   %eax,%eax
+  800b0b:	7f 08                	jg     800b15 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800b0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b10:	5b                   	pop    %ebx
+  800b11:	5e                   	pop    %esi
+  800b12:	5f                   	pop    %edi
+  800b13:	5d                   	pop    %ebp
+  800b14:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b15:	83 ec 0c             	sub    $0xc,%esp
+  800b18:	50                   	push   %eax
+  800b19:	6a 03                	push   $0x3
+  800b1b:	68 c7 3a 80 00       	push   $0x803ac7
+  800b20:	6a 3d                	push   $0x3d
+  800b22:	68 e4 3a 80 00       	push   $0x803ae4
+  800b27:	e8 9b 24 00 00       	call   802fc7 <_panic>
+
+00800b2c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b2c:	55                   	push   %ebp
+  800b2d:	89 e5                	mov    %esp,%ebp
+  800b2f:	57                   	push   %edi
+  800b30:	56                   	push   %esi
+  800b31:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b32:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b37:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b3c:	89 d1                	mov    %edx,%ecx
+  800b3e:	89 d3                	mov    %edx,%ebx
+  800b40:	89 d7                	mov    %edx,%edi
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	8d 35 4d 0b 80 00    	lea    0x800b4d,%esi
+  800b4b:	0f 34                	sysenter
+  800b4d:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800b4e:	5b                   	pop    %ebx
+  800b4f:	5e                   	pop    %esi
+  800b50:	5f                   	pop    %edi
+  800b51:	5d                   	pop    %ebp
+  800b52:	c3                   	ret
+
+00800b53 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b53:	55                   	push   %ebp
+  800b54:	89 e5                	mov    %esp,%ebp
+  800b56:	57                   	push   %edi
+  800b57:	56                   	push   %esi
+  800b58:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b59:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b5e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b63:	89 d1                	mov    %edx,%ecx
+  800b65:	89 d3                	mov    %edx,%ebx
+  800b67:	89 d7                	mov    %edx,%edi
+  800b69:	89 d6                	mov    %edx,%esi
+  800b6b:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b6d:	5b                   	pop    %ebx
+  800b6e:	5e                   	pop    %esi
+  800b6f:	5f                   	pop    %edi
+  800b70:	5d                   	pop    %ebp
+  800b71:	c3                   	ret
+
+00800b72 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800b72:	55                   	push   %ebp
+  800b73:	89 e5                	mov    %esp,%ebp
+  800b75:	57                   	push   %edi
+  800b76:	56                   	push   %esi
+  800b77:	53                   	push   %ebx
+  800b78:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b81:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b86:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b8b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b8e:	55                   	push   %ebp
+  800b8f:	89 e5                	mov    %esp,%ebp
+  800b91:	8d 35 99 0b 80 00    	lea    0x800b99,%esi
+  800b97:	0f 34                	sysenter
+  800b99:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b9a:	85 c0                	test   %eax,%eax
+  800b9c:	7f 08                	jg     800ba6 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800b9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba1:	5b                   	pop    %ebx
+  800ba2:	5e                   	pop    %esi
+  800ba3:	5f                   	pop    %edi
+  800ba4:	5d                   	pop    %ebp
+  800ba5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ba6:	83 ec 0c             	sub    $0xc,%esp
+  800ba9:	50                   	push   %eax
+  800baa:	6a 04                	push   $0x4
+  800bac:	68 c7 3a 80 00       	push   $0x803ac7
+  800bb1:	6a 3d                	push   $0x3d
+  800bb3:	68 e4 3a 80 00       	push   $0x803ae4
+  800bb8:	e8 0a 24 00 00       	call   802fc7 <_panic>
+
+00800bbd <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800bbd:	55                   	push   %ebp
+  800bbe:	89 e5                	mov    %esp,%ebp
+  800bc0:	57                   	push   %edi
+  800bc1:	56                   	push   %esi
+  800bc2:	53                   	push   %ebx
+  800bc3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bcc:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bd4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bd7:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bda:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bdc:	85 c0                	test   %eax,%eax
+  800bde:	7f 08                	jg     800be8 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800be0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be3:	5b                   	pop    %ebx
+  800be4:	5e                   	pop    %esi
+  800be5:	5f                   	pop    %edi
+  800be6:	5d                   	pop    %ebp
+  800be7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800be8:	83 ec 0c             	sub    $0xc,%esp
+  800beb:	50                   	push   %eax
+  800bec:	6a 05                	push   $0x5
+  800bee:	68 c7 3a 80 00       	push   $0x803ac7
+  800bf3:	6a 23                	push   $0x23
+  800bf5:	68 e4 3a 80 00       	push   $0x803ae4
+  800bfa:	e8 c8 23 00 00       	call   802fc7 <_panic>
+
+00800bff <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800bff:	55                   	push   %ebp
+  800c00:	89 e5                	mov    %esp,%ebp
+  800c02:	57                   	push   %edi
+  800c03:	56                   	push   %esi
+  800c04:	53                   	push   %ebx
+  800c05:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c13:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c18:	89 df                	mov    %ebx,%edi
+  800c1a:	55                   	push   %ebp
+  800c1b:	89 e5                	mov    %esp,%ebp
+  800c1d:	8d 35 25 0c 80 00    	lea    0x800c25,%esi
+  800c23:	0f 34                	sysenter
+  800c25:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c26:	85 c0                	test   %eax,%eax
+  800c28:	7f 08                	jg     800c32 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800c2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2d:	5b                   	pop    %ebx
+  800c2e:	5e                   	pop    %esi
+  800c2f:	5f                   	pop    %edi
+  800c30:	5d                   	pop    %ebp
+  800c31:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c32:	83 ec 0c             	sub    $0xc,%esp
+  800c35:	50                   	push   %eax
+  800c36:	6a 06                	push   $0x6
+  800c38:	68 c7 3a 80 00       	push   $0x803ac7
+  800c3d:	6a 3d                	push   $0x3d
+  800c3f:	68 e4 3a 80 00       	push   $0x803ae4
+  800c44:	e8 7e 23 00 00       	call   802fc7 <_panic>
+
+00800c49 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800c49:	55                   	push   %ebp
+  800c4a:	89 e5                	mov    %esp,%ebp
+  800c4c:	57                   	push   %edi
+  800c4d:	56                   	push   %esi
+  800c4e:	53                   	push   %ebx
+  800c4f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c62:	89 df                	mov    %ebx,%edi
+  800c64:	55                   	push   %ebp
+  800c65:	89 e5                	mov    %esp,%ebp
+  800c67:	8d 35 6f 0c 80 00    	lea    0x800c6f,%esi
+  800c6d:	0f 34                	sysenter
+  800c6f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c70:	85 c0                	test   %eax,%eax
+  800c72:	7f 08                	jg     800c7c <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800c74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c77:	5b                   	pop    %ebx
+  800c78:	5e                   	pop    %esi
+  800c79:	5f                   	pop    %edi
+  800c7a:	5d                   	pop    %ebp
+  800c7b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c7c:	83 ec 0c             	sub    $0xc,%esp
+  800c7f:	50                   	push   %eax
+  800c80:	6a 08                	push   $0x8
+  800c82:	68 c7 3a 80 00       	push   $0x803ac7
+  800c87:	6a 3d                	push   $0x3d
+  800c89:	68 e4 3a 80 00       	push   $0x803ae4
+  800c8e:	e8 34 23 00 00       	call   802fc7 <_panic>
+
+00800c93 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800c93:	55                   	push   %ebp
+  800c94:	89 e5                	mov    %esp,%ebp
+  800c96:	57                   	push   %edi
+  800c97:	56                   	push   %esi
+  800c98:	53                   	push   %ebx
+  800c99:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ca1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca7:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cac:	89 df                	mov    %ebx,%edi
+  800cae:	55                   	push   %ebp
+  800caf:	89 e5                	mov    %esp,%ebp
+  800cb1:	8d 35 b9 0c 80 00    	lea    0x800cb9,%esi
+  800cb7:	0f 34                	sysenter
+  800cb9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cba:	85 c0                	test   %eax,%eax
+  800cbc:	7f 08                	jg     800cc6 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800cbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc1:	5b                   	pop    %ebx
+  800cc2:	5e                   	pop    %esi
+  800cc3:	5f                   	pop    %edi
+  800cc4:	5d                   	pop    %ebp
+  800cc5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cc6:	83 ec 0c             	sub    $0xc,%esp
+  800cc9:	50                   	push   %eax
+  800cca:	6a 09                	push   $0x9
+  800ccc:	68 c7 3a 80 00       	push   $0x803ac7
+  800cd1:	6a 3d                	push   $0x3d
+  800cd3:	68 e4 3a 80 00       	push   $0x803ae4
+  800cd8:	e8 ea 22 00 00       	call   802fc7 <_panic>
+
+00800cdd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800cdd:	55                   	push   %ebp
+  800cde:	89 e5                	mov    %esp,%ebp
+  800ce0:	57                   	push   %edi
+  800ce1:	56                   	push   %esi
+  800ce2:	53                   	push   %ebx
+  800ce3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ce6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ceb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cf6:	89 df                	mov    %ebx,%edi
+  800cf8:	55                   	push   %ebp
+  800cf9:	89 e5                	mov    %esp,%ebp
+  800cfb:	8d 35 03 0d 80 00    	lea    0x800d03,%esi
+  800d01:	0f 34                	sysenter
+  800d03:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d04:	85 c0                	test   %eax,%eax
+  800d06:	7f 08                	jg     800d10 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800d08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0b:	5b                   	pop    %ebx
+  800d0c:	5e                   	pop    %esi
+  800d0d:	5f                   	pop    %edi
+  800d0e:	5d                   	pop    %ebp
+  800d0f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d10:	83 ec 0c             	sub    $0xc,%esp
+  800d13:	50                   	push   %eax
+  800d14:	6a 0a                	push   $0xa
+  800d16:	68 c7 3a 80 00       	push   $0x803ac7
+  800d1b:	6a 3d                	push   $0x3d
+  800d1d:	68 e4 3a 80 00       	push   $0x803ae4
+  800d22:	e8 a0 22 00 00       	call   802fc7 <_panic>
+
+00800d27 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800d27:	55                   	push   %ebp
+  800d28:	89 e5                	mov    %esp,%ebp
+  800d2a:	57                   	push   %edi
+  800d2b:	56                   	push   %esi
+  800d2c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d33:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d38:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d3b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	8d 35 49 0d 80 00    	lea    0x800d49,%esi
+  800d47:	0f 34                	sysenter
+  800d49:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800d4a:	5b                   	pop    %ebx
+  800d4b:	5e                   	pop    %esi
+  800d4c:	5f                   	pop    %edi
+  800d4d:	5d                   	pop    %ebp
+  800d4e:	c3                   	ret
+
+00800d4f <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	57                   	push   %edi
+  800d53:	56                   	push   %esi
+  800d54:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5b:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d63:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d66:	55                   	push   %ebp
+  800d67:	89 e5                	mov    %esp,%ebp
+  800d69:	8d 35 71 0d 80 00    	lea    0x800d71,%esi
+  800d6f:	0f 34                	sysenter
+  800d71:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800d72:	5b                   	pop    %ebx
+  800d73:	5e                   	pop    %esi
+  800d74:	5f                   	pop    %edi
+  800d75:	5d                   	pop    %ebp
+  800d76:	c3                   	ret
+
+00800d77 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800d77:	55                   	push   %ebp
+  800d78:	89 e5                	mov    %esp,%ebp
+  800d7a:	57                   	push   %edi
+  800d7b:	56                   	push   %esi
+  800d7c:	53                   	push   %ebx
+  800d7d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d80:	be 00 00 00 00       	mov    $0x0,%esi
+  800d85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d90:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d93:	89 f7                	mov    %esi,%edi
+  800d95:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d97:	85 c0                	test   %eax,%eax
+  800d99:	7f 08                	jg     800da3 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800d9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9e:	5b                   	pop    %ebx
+  800d9f:	5e                   	pop    %esi
+  800da0:	5f                   	pop    %edi
+  800da1:	5d                   	pop    %ebp
+  800da2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da3:	83 ec 0c             	sub    $0xc,%esp
+  800da6:	50                   	push   %eax
+  800da7:	6a 0d                	push   $0xd
+  800da9:	68 c7 3a 80 00       	push   $0x803ac7
+  800dae:	6a 23                	push   $0x23
+  800db0:	68 e4 3a 80 00       	push   $0x803ae4
+  800db5:	e8 0d 22 00 00       	call   802fc7 <_panic>
+
+00800dba <sys_ipc_recv>:
+{
+  800dba:	55                   	push   %ebp
+  800dbb:	89 e5                	mov    %esp,%ebp
+  800dbd:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800dc0:	6a 00                	push   $0x0
+  800dc2:	6a 01                	push   $0x1
+  800dc4:	ff 75 08             	push   0x8(%ebp)
+  800dc7:	e8 ab ff ff ff       	call   800d77 <sys_ipc_recvv>
+}
+  800dcc:	c9                   	leave
+  800dcd:	c3                   	ret
+
+00800dce <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800dce:	55                   	push   %ebp
+  800dcf:	89 e5                	mov    %esp,%ebp
+  800dd1:	57                   	push   %edi
+  800dd2:	56                   	push   %esi
+  800dd3:	53                   	push   %ebx
+  800dd4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ddc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800de7:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800dea:	89 de                	mov    %ebx,%esi
+  800dec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dee:	85 c0                	test   %eax,%eax
+  800df0:	7f 08                	jg     800dfa <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800df2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df5:	5b                   	pop    %ebx
+  800df6:	5e                   	pop    %esi
+  800df7:	5f                   	pop    %edi
+  800df8:	5d                   	pop    %ebp
+  800df9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dfa:	83 ec 0c             	sub    $0xc,%esp
+  800dfd:	50                   	push   %eax
+  800dfe:	6a 0d                	push   $0xd
+  800e00:	68 c7 3a 80 00       	push   $0x803ac7
+  800e05:	6a 23                	push   $0x23
+  800e07:	68 e4 3a 80 00       	push   $0x803ae4
+  800e0c:	e8 b6 21 00 00       	call   802fc7 <_panic>
+
+00800e11 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	57                   	push   %edi
+  800e15:	56                   	push   %esi
+  800e16:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e21:	89 d1                	mov    %edx,%ecx
+  800e23:	89 d3                	mov    %edx,%ebx
+  800e25:	89 d7                	mov    %edx,%edi
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	8d 35 32 0e 80 00    	lea    0x800e32,%esi
+  800e30:	0f 34                	sysenter
+  800e32:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800e33:	5b                   	pop    %ebx
+  800e34:	5e                   	pop    %esi
+  800e35:	5f                   	pop    %edi
+  800e36:	5d                   	pop    %ebp
+  800e37:	c3                   	ret
+
+00800e38 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800e38:	55                   	push   %ebp
+  800e39:	89 e5                	mov    %esp,%ebp
+  800e3b:	57                   	push   %edi
+  800e3c:	56                   	push   %esi
+  800e3d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e49:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e4e:	89 df                	mov    %ebx,%edi
+  800e50:	55                   	push   %ebp
+  800e51:	89 e5                	mov    %esp,%ebp
+  800e53:	8d 35 5b 0e 80 00    	lea    0x800e5b,%esi
+  800e59:	0f 34                	sysenter
+  800e5b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800e5c:	5b                   	pop    %ebx
+  800e5d:	5e                   	pop    %esi
+  800e5e:	5f                   	pop    %edi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+
+00800e61 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800e61:	55                   	push   %ebp
+  800e62:	89 e5                	mov    %esp,%ebp
+  800e64:	57                   	push   %edi
+  800e65:	56                   	push   %esi
+  800e66:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e74:	89 cb                	mov    %ecx,%ebx
+  800e76:	89 cf                	mov    %ecx,%edi
+  800e78:	55                   	push   %ebp
+  800e79:	89 e5                	mov    %esp,%ebp
+  800e7b:	8d 35 83 0e 80 00    	lea    0x800e83,%esi
+  800e81:	0f 34                	sysenter
+  800e83:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800e84:	5b                   	pop    %ebx
+  800e85:	5e                   	pop    %esi
+  800e86:	5f                   	pop    %edi
+  800e87:	5d                   	pop    %ebp
+  800e88:	c3                   	ret
+
+00800e89 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800e89:	55                   	push   %ebp
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	57                   	push   %edi
+  800e8d:	56                   	push   %esi
+  800e8e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9a:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e9f:	89 df                	mov    %ebx,%edi
+  800ea1:	55                   	push   %ebp
+  800ea2:	89 e5                	mov    %esp,%ebp
+  800ea4:	8d 35 ac 0e 80 00    	lea    0x800eac,%esi
+  800eaa:	0f 34                	sysenter
+  800eac:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800ead:	5b                   	pop    %ebx
+  800eae:	5e                   	pop    %esi
+  800eaf:	5f                   	pop    %edi
+  800eb0:	5d                   	pop    %ebp
+  800eb1:	c3                   	ret
+
+00800eb2 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800eb2:	55                   	push   %ebp
+  800eb3:	89 e5                	mov    %esp,%ebp
+  800eb5:	57                   	push   %edi
+  800eb6:	56                   	push   %esi
+  800eb7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec3:	b8 14 00 00 00       	mov    $0x14,%eax
+  800ec8:	89 df                	mov    %ebx,%edi
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	8d 35 d5 0e 80 00    	lea    0x800ed5,%esi
+  800ed3:	0f 34                	sysenter
+  800ed5:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800ed6:	5b                   	pop    %ebx
+  800ed7:	5e                   	pop    %esi
+  800ed8:	5f                   	pop    %edi
+  800ed9:	5d                   	pop    %ebp
+  800eda:	c3                   	ret
+
+00800edb <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800edb:	55                   	push   %ebp
+  800edc:	89 e5                	mov    %esp,%ebp
+  800ede:	57                   	push   %edi
+  800edf:	56                   	push   %esi
+  800ee0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ee1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee7:	b8 13 00 00 00       	mov    $0x13,%eax
+  800eec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eef:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef2:	55                   	push   %ebp
+  800ef3:	89 e5                	mov    %esp,%ebp
+  800ef5:	8d 35 fd 0e 80 00    	lea    0x800efd,%esi
+  800efb:	0f 34                	sysenter
+  800efd:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800efe:	5b                   	pop    %ebx
+  800eff:	5e                   	pop    %esi
+  800f00:	5f                   	pop    %edi
+  800f01:	5d                   	pop    %ebp
+  800f02:	c3                   	ret
+
+00800f03 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800f03:	55                   	push   %ebp
+  800f04:	89 e5                	mov    %esp,%ebp
+  800f06:	57                   	push   %edi
+  800f07:	56                   	push   %esi
+  800f08:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f09:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f11:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f16:	89 cb                	mov    %ecx,%ebx
+  800f18:	89 cf                	mov    %ecx,%edi
+  800f1a:	89 ce                	mov    %ecx,%esi
+  800f1c:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800f1e:	5b                   	pop    %ebx
+  800f1f:	5e                   	pop    %esi
+  800f20:	5f                   	pop    %edi
+  800f21:	5d                   	pop    %ebp
+  800f22:	c3                   	ret
+
+00800f23 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800f23:	55                   	push   %ebp
+  800f24:	89 e5                	mov    %esp,%ebp
+  800f26:	57                   	push   %edi
+  800f27:	56                   	push   %esi
+  800f28:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f29:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f31:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f36:	89 cb                	mov    %ecx,%ebx
+  800f38:	89 cf                	mov    %ecx,%edi
+  800f3a:	55                   	push   %ebp
+  800f3b:	89 e5                	mov    %esp,%ebp
+  800f3d:	8d 35 45 0f 80 00    	lea    0x800f45,%esi
+  800f43:	0f 34                	sysenter
+  800f45:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800f46:	5b                   	pop    %ebx
+  800f47:	5e                   	pop    %esi
+  800f48:	5f                   	pop    %edi
+  800f49:	5d                   	pop    %ebp
+  800f4a:	c3                   	ret
+
+00800f4b <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800f4b:	55                   	push   %ebp
+  800f4c:	89 e5                	mov    %esp,%ebp
+  800f4e:	57                   	push   %edi
+  800f4f:	56                   	push   %esi
+  800f50:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f59:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f5e:	89 cb                	mov    %ecx,%ebx
+  800f60:	89 cf                	mov    %ecx,%edi
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+  800f65:	8d 35 6d 0f 80 00    	lea    0x800f6d,%esi
+  800f6b:	0f 34                	sysenter
+  800f6d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800f6e:	5b                   	pop    %ebx
+  800f6f:	5e                   	pop    %esi
+  800f70:	5f                   	pop    %edi
+  800f71:	5d                   	pop    %ebp
+  800f72:	c3                   	ret
+
+00800f73 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  800f73:	55                   	push   %ebp
+  800f74:	89 e5                	mov    %esp,%ebp
+  800f76:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  800f79:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  800f80:	74 0a                	je     800f8c <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  800f82:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f85:	a3 04 50 80 00       	mov    %eax,0x805004
+}
+  800f8a:	c9                   	leave
+  800f8b:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  800f8c:	83 ec 04             	sub    $0x4,%esp
+  800f8f:	6a 07                	push   $0x7
+  800f91:	68 00 f0 bf ee       	push   $0xeebff000
+  800f96:	6a 00                	push   $0x0
+  800f98:	e8 d5 fb ff ff       	call   800b72 <sys_page_alloc>
+  800f9d:	83 c4 10             	add    $0x10,%esp
+  800fa0:	85 c0                	test   %eax,%eax
+  800fa2:	75 2c                	jne    800fd0 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  800fa4:	83 ec 08             	sub    $0x8,%esp
+  800fa7:	68 e6 0f 80 00       	push   $0x800fe6
+  800fac:	6a 00                	push   $0x0
+  800fae:	e8 2a fd ff ff       	call   800cdd <sys_env_set_pgfault_upcall>
+  800fb3:	83 c4 10             	add    $0x10,%esp
+  800fb6:	85 c0                	test   %eax,%eax
+  800fb8:	74 c8                	je     800f82 <set_pgfault_handler+0xf>
+  800fba:	68 3c 3b 80 00       	push   $0x803b3c
+  800fbf:	68 6c 3b 80 00       	push   $0x803b6c
+  800fc4:	6a 20                	push   $0x20
+  800fc6:	68 81 3b 80 00       	push   $0x803b81
+  800fcb:	e8 f7 1f 00 00       	call   802fc7 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  800fd0:	68 f4 3a 80 00       	push   $0x803af4
+  800fd5:	68 6c 3b 80 00       	push   $0x803b6c
+  800fda:	6a 1e                	push   $0x1e
+  800fdc:	68 81 3b 80 00       	push   $0x803b81
+  800fe1:	e8 e1 1f 00 00       	call   802fc7 <_panic>
+
+00800fe6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  800fe6:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  800fe7:	a1 04 50 80 00       	mov    0x805004,%eax
+	call *%eax
+  800fec:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  800fee:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  800ff1:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  800ff6:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  800ffb:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  800fff:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  801002:	83 c4 08             	add    $0x8,%esp
+	popal
+  801005:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  801006:	83 c4 04             	add    $0x4,%esp
+	popfl
+  801009:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  80100a:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80100b:	c3                   	ret
+
+0080100c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80100c:	55                   	push   %ebp
+  80100d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80100f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801012:	05 00 00 00 30       	add    $0x30000000,%eax
+  801017:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80101a:	5d                   	pop    %ebp
+  80101b:	c3                   	ret
+
+0080101c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80101f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801022:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801027:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80102c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801031:	5d                   	pop    %ebp
+  801032:	c3                   	ret
+
+00801033 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801033:	55                   	push   %ebp
+  801034:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801036:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80103b:	eb 02                	jmp    80103f <fd_alloc+0xc>
+  80103d:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80103f:	89 c2                	mov    %eax,%edx
+  801041:	c1 ea 16             	shr    $0x16,%edx
+  801044:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80104b:	f6 c2 01             	test   $0x1,%dl
+  80104e:	74 2b                	je     80107b <fd_alloc+0x48>
+  801050:	89 c2                	mov    %eax,%edx
+  801052:	c1 ea 0c             	shr    $0xc,%edx
+  801055:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80105c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801062:	f6 c1 01             	test   $0x1,%cl
+  801065:	74 14                	je     80107b <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801067:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80106d:	75 ce                	jne    80103d <fd_alloc+0xa>
+  80106f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801074:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801079:	eb 05                	jmp    801080 <fd_alloc+0x4d>
+			return 0;
+  80107b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801080:	8b 55 08             	mov    0x8(%ebp),%edx
+  801083:	89 02                	mov    %eax,(%edx)
+}
+  801085:	89 c8                	mov    %ecx,%eax
+  801087:	5d                   	pop    %ebp
+  801088:	c3                   	ret
+
+00801089 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801089:	55                   	push   %ebp
+  80108a:	89 e5                	mov    %esp,%ebp
+  80108c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80108f:	83 f8 1f             	cmp    $0x1f,%eax
+  801092:	77 30                	ja     8010c4 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801094:	c1 e0 0c             	shl    $0xc,%eax
+  801097:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80109c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8010a2:	f6 c2 01             	test   $0x1,%dl
+  8010a5:	74 24                	je     8010cb <fd_lookup+0x42>
+  8010a7:	89 c2                	mov    %eax,%edx
+  8010a9:	c1 ea 0c             	shr    $0xc,%edx
+  8010ac:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8010b3:	f6 c2 01             	test   $0x1,%dl
+  8010b6:	74 1a                	je     8010d2 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8010b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010bb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8010bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010c2:	5d                   	pop    %ebp
+  8010c3:	c3                   	ret
+		return -E_INVAL;
+  8010c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010c9:	eb f7                	jmp    8010c2 <fd_lookup+0x39>
+		return -E_INVAL;
+  8010cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010d0:	eb f0                	jmp    8010c2 <fd_lookup+0x39>
+  8010d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010d7:	eb e9                	jmp    8010c2 <fd_lookup+0x39>
+
+008010d9 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8010d9:	55                   	push   %ebp
+  8010da:	89 e5                	mov    %esp,%ebp
+  8010dc:	53                   	push   %ebx
+  8010dd:	83 ec 04             	sub    $0x4,%esp
+  8010e0:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8010e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e8:	eb 03                	jmp    8010ed <dev_lookup+0x14>
+  8010ea:	83 c0 01             	add    $0x1,%eax
+  8010ed:	8b 1c 85 0c 3c 80 00 	mov    0x803c0c(,%eax,4),%ebx
+  8010f4:	85 db                	test   %ebx,%ebx
+  8010f6:	74 0b                	je     801103 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8010f8:	39 13                	cmp    %edx,(%ebx)
+  8010fa:	75 ee                	jne    8010ea <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8010fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801101:	eb 1f                	jmp    801122 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801103:	a1 00 50 80 00       	mov    0x805000,%eax
+  801108:	8b 40 48             	mov    0x48(%eax),%eax
+  80110b:	83 ec 04             	sub    $0x4,%esp
+  80110e:	52                   	push   %edx
+  80110f:	50                   	push   %eax
+  801110:	68 90 3b 80 00       	push   $0x803b90
+  801115:	e8 5e f0 ff ff       	call   800178 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80111a:	83 c4 10             	add    $0x10,%esp
+  80111d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801122:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801125:	89 1a                	mov    %ebx,(%edx)
+}
+  801127:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80112a:	c9                   	leave
+  80112b:	c3                   	ret
+
+0080112c <fd_close>:
+{
+  80112c:	55                   	push   %ebp
+  80112d:	89 e5                	mov    %esp,%ebp
+  80112f:	57                   	push   %edi
+  801130:	56                   	push   %esi
+  801131:	53                   	push   %ebx
+  801132:	83 ec 24             	sub    $0x24,%esp
+  801135:	8b 75 08             	mov    0x8(%ebp),%esi
+  801138:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80113b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80113e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80113f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801145:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801148:	50                   	push   %eax
+  801149:	e8 3b ff ff ff       	call   801089 <fd_lookup>
+  80114e:	89 c3                	mov    %eax,%ebx
+  801150:	83 c4 10             	add    $0x10,%esp
+  801153:	85 c0                	test   %eax,%eax
+  801155:	78 05                	js     80115c <fd_close+0x30>
+	    || fd != fd2)
+  801157:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80115a:	74 16                	je     801172 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80115c:	89 f8                	mov    %edi,%eax
+  80115e:	84 c0                	test   %al,%al
+  801160:	b8 00 00 00 00       	mov    $0x0,%eax
+  801165:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801168:	89 d8                	mov    %ebx,%eax
+  80116a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116d:	5b                   	pop    %ebx
+  80116e:	5e                   	pop    %esi
+  80116f:	5f                   	pop    %edi
+  801170:	5d                   	pop    %ebp
+  801171:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801172:	83 ec 08             	sub    $0x8,%esp
+  801175:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801178:	50                   	push   %eax
+  801179:	ff 36                	push   (%esi)
+  80117b:	e8 59 ff ff ff       	call   8010d9 <dev_lookup>
+  801180:	89 c3                	mov    %eax,%ebx
+  801182:	83 c4 10             	add    $0x10,%esp
+  801185:	85 c0                	test   %eax,%eax
+  801187:	78 1a                	js     8011a3 <fd_close+0x77>
+		if (dev->dev_close)
+  801189:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80118c:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80118f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801194:	85 c0                	test   %eax,%eax
+  801196:	74 0b                	je     8011a3 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801198:	83 ec 0c             	sub    $0xc,%esp
+  80119b:	56                   	push   %esi
+  80119c:	ff d0                	call   *%eax
+  80119e:	89 c3                	mov    %eax,%ebx
+  8011a0:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8011a3:	83 ec 08             	sub    $0x8,%esp
+  8011a6:	56                   	push   %esi
+  8011a7:	6a 00                	push   $0x0
+  8011a9:	e8 51 fa ff ff       	call   800bff <sys_page_unmap>
+	return r;
+  8011ae:	83 c4 10             	add    $0x10,%esp
+  8011b1:	eb b5                	jmp    801168 <fd_close+0x3c>
+
+008011b3 <close>:
+
+int
+close(int fdnum)
+{
+  8011b3:	55                   	push   %ebp
+  8011b4:	89 e5                	mov    %esp,%ebp
+  8011b6:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8011b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011bc:	50                   	push   %eax
+  8011bd:	ff 75 08             	push   0x8(%ebp)
+  8011c0:	e8 c4 fe ff ff       	call   801089 <fd_lookup>
+  8011c5:	83 c4 10             	add    $0x10,%esp
+  8011c8:	85 c0                	test   %eax,%eax
+  8011ca:	79 02                	jns    8011ce <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8011cc:	c9                   	leave
+  8011cd:	c3                   	ret
+		return fd_close(fd, 1);
+  8011ce:	83 ec 08             	sub    $0x8,%esp
+  8011d1:	6a 01                	push   $0x1
+  8011d3:	ff 75 f4             	push   -0xc(%ebp)
+  8011d6:	e8 51 ff ff ff       	call   80112c <fd_close>
+  8011db:	83 c4 10             	add    $0x10,%esp
+  8011de:	eb ec                	jmp    8011cc <close+0x19>
+
+008011e0 <close_all>:
+
+void
+close_all(void)
+{
+  8011e0:	55                   	push   %ebp
+  8011e1:	89 e5                	mov    %esp,%ebp
+  8011e3:	53                   	push   %ebx
+  8011e4:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8011e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8011ec:	83 ec 0c             	sub    $0xc,%esp
+  8011ef:	53                   	push   %ebx
+  8011f0:	e8 be ff ff ff       	call   8011b3 <close>
+	for (i = 0; i < MAXFD; i++)
+  8011f5:	83 c3 01             	add    $0x1,%ebx
+  8011f8:	83 c4 10             	add    $0x10,%esp
+  8011fb:	83 fb 20             	cmp    $0x20,%ebx
+  8011fe:	75 ec                	jne    8011ec <close_all+0xc>
+}
+  801200:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801203:	c9                   	leave
+  801204:	c3                   	ret
+
+00801205 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801205:	55                   	push   %ebp
+  801206:	89 e5                	mov    %esp,%ebp
+  801208:	57                   	push   %edi
+  801209:	56                   	push   %esi
+  80120a:	53                   	push   %ebx
+  80120b:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80120e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801211:	50                   	push   %eax
+  801212:	ff 75 08             	push   0x8(%ebp)
+  801215:	e8 6f fe ff ff       	call   801089 <fd_lookup>
+  80121a:	89 c3                	mov    %eax,%ebx
+  80121c:	83 c4 10             	add    $0x10,%esp
+  80121f:	85 c0                	test   %eax,%eax
+  801221:	78 7f                	js     8012a2 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801223:	83 ec 0c             	sub    $0xc,%esp
+  801226:	ff 75 0c             	push   0xc(%ebp)
+  801229:	e8 85 ff ff ff       	call   8011b3 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80122e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801231:	c1 e6 0c             	shl    $0xc,%esi
+  801234:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80123a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80123d:	89 3c 24             	mov    %edi,(%esp)
+  801240:	e8 d7 fd ff ff       	call   80101c <fd2data>
+  801245:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801247:	89 34 24             	mov    %esi,(%esp)
+  80124a:	e8 cd fd ff ff       	call   80101c <fd2data>
+  80124f:	83 c4 10             	add    $0x10,%esp
+  801252:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801255:	89 d8                	mov    %ebx,%eax
+  801257:	c1 e8 16             	shr    $0x16,%eax
+  80125a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801261:	a8 01                	test   $0x1,%al
+  801263:	74 11                	je     801276 <dup+0x71>
+  801265:	89 d8                	mov    %ebx,%eax
+  801267:	c1 e8 0c             	shr    $0xc,%eax
+  80126a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801271:	f6 c2 01             	test   $0x1,%dl
+  801274:	75 36                	jne    8012ac <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801276:	89 f8                	mov    %edi,%eax
+  801278:	c1 e8 0c             	shr    $0xc,%eax
+  80127b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801282:	83 ec 0c             	sub    $0xc,%esp
+  801285:	25 07 0e 00 00       	and    $0xe07,%eax
+  80128a:	50                   	push   %eax
+  80128b:	56                   	push   %esi
+  80128c:	6a 00                	push   $0x0
+  80128e:	57                   	push   %edi
+  80128f:	6a 00                	push   $0x0
+  801291:	e8 27 f9 ff ff       	call   800bbd <sys_page_map>
+  801296:	89 c3                	mov    %eax,%ebx
+  801298:	83 c4 20             	add    $0x20,%esp
+  80129b:	85 c0                	test   %eax,%eax
+  80129d:	78 33                	js     8012d2 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80129f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8012a2:	89 d8                	mov    %ebx,%eax
+  8012a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a7:	5b                   	pop    %ebx
+  8012a8:	5e                   	pop    %esi
+  8012a9:	5f                   	pop    %edi
+  8012aa:	5d                   	pop    %ebp
+  8012ab:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8012ac:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012b3:	83 ec 0c             	sub    $0xc,%esp
+  8012b6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012bb:	50                   	push   %eax
+  8012bc:	ff 75 d4             	push   -0x2c(%ebp)
+  8012bf:	6a 00                	push   $0x0
+  8012c1:	53                   	push   %ebx
+  8012c2:	6a 00                	push   $0x0
+  8012c4:	e8 f4 f8 ff ff       	call   800bbd <sys_page_map>
+  8012c9:	89 c3                	mov    %eax,%ebx
+  8012cb:	83 c4 20             	add    $0x20,%esp
+  8012ce:	85 c0                	test   %eax,%eax
+  8012d0:	79 a4                	jns    801276 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8012d2:	83 ec 08             	sub    $0x8,%esp
+  8012d5:	56                   	push   %esi
+  8012d6:	6a 00                	push   $0x0
+  8012d8:	e8 22 f9 ff ff       	call   800bff <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8012dd:	83 c4 08             	add    $0x8,%esp
+  8012e0:	ff 75 d4             	push   -0x2c(%ebp)
+  8012e3:	6a 00                	push   $0x0
+  8012e5:	e8 15 f9 ff ff       	call   800bff <sys_page_unmap>
+	return r;
+  8012ea:	83 c4 10             	add    $0x10,%esp
+  8012ed:	eb b3                	jmp    8012a2 <dup+0x9d>
+
+008012ef <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	56                   	push   %esi
+  8012f3:	53                   	push   %ebx
+  8012f4:	83 ec 18             	sub    $0x18,%esp
+  8012f7:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012fa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012fd:	50                   	push   %eax
+  8012fe:	56                   	push   %esi
+  8012ff:	e8 85 fd ff ff       	call   801089 <fd_lookup>
+  801304:	83 c4 10             	add    $0x10,%esp
+  801307:	85 c0                	test   %eax,%eax
+  801309:	78 3c                	js     801347 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80130b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80130e:	83 ec 08             	sub    $0x8,%esp
+  801311:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801314:	50                   	push   %eax
+  801315:	ff 33                	push   (%ebx)
+  801317:	e8 bd fd ff ff       	call   8010d9 <dev_lookup>
+  80131c:	83 c4 10             	add    $0x10,%esp
+  80131f:	85 c0                	test   %eax,%eax
+  801321:	78 24                	js     801347 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801323:	8b 43 08             	mov    0x8(%ebx),%eax
+  801326:	83 e0 03             	and    $0x3,%eax
+  801329:	83 f8 01             	cmp    $0x1,%eax
+  80132c:	74 20                	je     80134e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80132e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801331:	8b 40 08             	mov    0x8(%eax),%eax
+  801334:	85 c0                	test   %eax,%eax
+  801336:	74 37                	je     80136f <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801338:	83 ec 04             	sub    $0x4,%esp
+  80133b:	ff 75 10             	push   0x10(%ebp)
+  80133e:	ff 75 0c             	push   0xc(%ebp)
+  801341:	53                   	push   %ebx
+  801342:	ff d0                	call   *%eax
+  801344:	83 c4 10             	add    $0x10,%esp
+}
+  801347:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80134a:	5b                   	pop    %ebx
+  80134b:	5e                   	pop    %esi
+  80134c:	5d                   	pop    %ebp
+  80134d:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80134e:	a1 00 50 80 00       	mov    0x805000,%eax
+  801353:	8b 40 48             	mov    0x48(%eax),%eax
+  801356:	83 ec 04             	sub    $0x4,%esp
+  801359:	56                   	push   %esi
+  80135a:	50                   	push   %eax
+  80135b:	68 d1 3b 80 00       	push   $0x803bd1
+  801360:	e8 13 ee ff ff       	call   800178 <cprintf>
+		return -E_INVAL;
+  801365:	83 c4 10             	add    $0x10,%esp
+  801368:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80136d:	eb d8                	jmp    801347 <read+0x58>
+		return -E_NOT_SUPP;
+  80136f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801374:	eb d1                	jmp    801347 <read+0x58>
+
+00801376 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801376:	55                   	push   %ebp
+  801377:	89 e5                	mov    %esp,%ebp
+  801379:	57                   	push   %edi
+  80137a:	56                   	push   %esi
+  80137b:	53                   	push   %ebx
+  80137c:	83 ec 0c             	sub    $0xc,%esp
+  80137f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801382:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801385:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138a:	eb 02                	jmp    80138e <readn+0x18>
+  80138c:	01 c3                	add    %eax,%ebx
+  80138e:	39 f3                	cmp    %esi,%ebx
+  801390:	73 21                	jae    8013b3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801392:	83 ec 04             	sub    $0x4,%esp
+  801395:	89 f0                	mov    %esi,%eax
+  801397:	29 d8                	sub    %ebx,%eax
+  801399:	50                   	push   %eax
+  80139a:	89 d8                	mov    %ebx,%eax
+  80139c:	03 45 0c             	add    0xc(%ebp),%eax
+  80139f:	50                   	push   %eax
+  8013a0:	57                   	push   %edi
+  8013a1:	e8 49 ff ff ff       	call   8012ef <read>
+		if (m < 0)
+  8013a6:	83 c4 10             	add    $0x10,%esp
+  8013a9:	85 c0                	test   %eax,%eax
+  8013ab:	78 04                	js     8013b1 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8013ad:	75 dd                	jne    80138c <readn+0x16>
+  8013af:	eb 02                	jmp    8013b3 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8013b1:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8013b3:	89 d8                	mov    %ebx,%eax
+  8013b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b8:	5b                   	pop    %ebx
+  8013b9:	5e                   	pop    %esi
+  8013ba:	5f                   	pop    %edi
+  8013bb:	5d                   	pop    %ebp
+  8013bc:	c3                   	ret
+
+008013bd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8013bd:	55                   	push   %ebp
+  8013be:	89 e5                	mov    %esp,%ebp
+  8013c0:	56                   	push   %esi
+  8013c1:	53                   	push   %ebx
+  8013c2:	83 ec 18             	sub    $0x18,%esp
+  8013c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013c8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013cb:	50                   	push   %eax
+  8013cc:	53                   	push   %ebx
+  8013cd:	e8 b7 fc ff ff       	call   801089 <fd_lookup>
+  8013d2:	83 c4 10             	add    $0x10,%esp
+  8013d5:	85 c0                	test   %eax,%eax
+  8013d7:	78 37                	js     801410 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013d9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013dc:	83 ec 08             	sub    $0x8,%esp
+  8013df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013e2:	50                   	push   %eax
+  8013e3:	ff 36                	push   (%esi)
+  8013e5:	e8 ef fc ff ff       	call   8010d9 <dev_lookup>
+  8013ea:	83 c4 10             	add    $0x10,%esp
+  8013ed:	85 c0                	test   %eax,%eax
+  8013ef:	78 1f                	js     801410 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8013f1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8013f5:	74 20                	je     801417 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8013f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013fa:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013fd:	85 c0                	test   %eax,%eax
+  8013ff:	74 37                	je     801438 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801401:	83 ec 04             	sub    $0x4,%esp
+  801404:	ff 75 10             	push   0x10(%ebp)
+  801407:	ff 75 0c             	push   0xc(%ebp)
+  80140a:	56                   	push   %esi
+  80140b:	ff d0                	call   *%eax
+  80140d:	83 c4 10             	add    $0x10,%esp
+}
+  801410:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801413:	5b                   	pop    %ebx
+  801414:	5e                   	pop    %esi
+  801415:	5d                   	pop    %ebp
+  801416:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801417:	a1 00 50 80 00       	mov    0x805000,%eax
+  80141c:	8b 40 48             	mov    0x48(%eax),%eax
+  80141f:	83 ec 04             	sub    $0x4,%esp
+  801422:	53                   	push   %ebx
+  801423:	50                   	push   %eax
+  801424:	68 ed 3b 80 00       	push   $0x803bed
+  801429:	e8 4a ed ff ff       	call   800178 <cprintf>
+		return -E_INVAL;
+  80142e:	83 c4 10             	add    $0x10,%esp
+  801431:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801436:	eb d8                	jmp    801410 <write+0x53>
+		return -E_NOT_SUPP;
+  801438:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80143d:	eb d1                	jmp    801410 <write+0x53>
+
+0080143f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80143f:	55                   	push   %ebp
+  801440:	89 e5                	mov    %esp,%ebp
+  801442:	53                   	push   %ebx
+  801443:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801446:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801449:	50                   	push   %eax
+  80144a:	ff 75 08             	push   0x8(%ebp)
+  80144d:	e8 37 fc ff ff       	call   801089 <fd_lookup>
+  801452:	83 c4 10             	add    $0x10,%esp
+  801455:	85 c0                	test   %eax,%eax
+  801457:	78 3a                	js     801493 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801459:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80145c:	83 ec 08             	sub    $0x8,%esp
+  80145f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801462:	50                   	push   %eax
+  801463:	ff 33                	push   (%ebx)
+  801465:	e8 6f fc ff ff       	call   8010d9 <dev_lookup>
+  80146a:	83 c4 10             	add    $0x10,%esp
+  80146d:	85 c0                	test   %eax,%eax
+  80146f:	78 22                	js     801493 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801471:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801474:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801477:	85 c0                	test   %eax,%eax
+  801479:	74 0d                	je     801488 <seek+0x49>
+  80147b:	83 ec 0c             	sub    $0xc,%esp
+  80147e:	53                   	push   %ebx
+  80147f:	ff d0                	call   *%eax
+  801481:	83 c4 10             	add    $0x10,%esp
+  801484:	85 c0                	test   %eax,%eax
+  801486:	78 0b                	js     801493 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801488:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80148b:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  80148e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801493:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801496:	c9                   	leave
+  801497:	c3                   	ret
+
+00801498 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801498:	55                   	push   %ebp
+  801499:	89 e5                	mov    %esp,%ebp
+  80149b:	53                   	push   %ebx
+  80149c:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80149f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014a2:	50                   	push   %eax
+  8014a3:	ff 75 08             	push   0x8(%ebp)
+  8014a6:	e8 de fb ff ff       	call   801089 <fd_lookup>
+  8014ab:	83 c4 10             	add    $0x10,%esp
+  8014ae:	85 c0                	test   %eax,%eax
+  8014b0:	78 2b                	js     8014dd <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014b2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014b5:	83 ec 08             	sub    $0x8,%esp
+  8014b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014bb:	50                   	push   %eax
+  8014bc:	ff 33                	push   (%ebx)
+  8014be:	e8 16 fc ff ff       	call   8010d9 <dev_lookup>
+  8014c3:	83 c4 10             	add    $0x10,%esp
+  8014c6:	85 c0                	test   %eax,%eax
+  8014c8:	78 13                	js     8014dd <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8014ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014cd:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	74 0e                	je     8014e2 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8014d4:	83 ec 0c             	sub    $0xc,%esp
+  8014d7:	53                   	push   %ebx
+  8014d8:	ff d0                	call   *%eax
+  8014da:	83 c4 10             	add    $0x10,%esp
+}
+  8014dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014e0:	c9                   	leave
+  8014e1:	c3                   	ret
+		return 0;
+  8014e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e7:	eb f4                	jmp    8014dd <fsync+0x45>
+
+008014e9 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8014e9:	55                   	push   %ebp
+  8014ea:	89 e5                	mov    %esp,%ebp
+  8014ec:	56                   	push   %esi
+  8014ed:	53                   	push   %ebx
+  8014ee:	83 ec 18             	sub    $0x18,%esp
+  8014f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014f4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014f7:	50                   	push   %eax
+  8014f8:	53                   	push   %ebx
+  8014f9:	e8 8b fb ff ff       	call   801089 <fd_lookup>
+  8014fe:	83 c4 10             	add    $0x10,%esp
+  801501:	85 c0                	test   %eax,%eax
+  801503:	78 34                	js     801539 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801505:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801508:	83 ec 08             	sub    $0x8,%esp
+  80150b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80150e:	50                   	push   %eax
+  80150f:	ff 36                	push   (%esi)
+  801511:	e8 c3 fb ff ff       	call   8010d9 <dev_lookup>
+  801516:	83 c4 10             	add    $0x10,%esp
+  801519:	85 c0                	test   %eax,%eax
+  80151b:	78 1c                	js     801539 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80151d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801521:	74 1d                	je     801540 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801523:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801526:	8b 40 18             	mov    0x18(%eax),%eax
+  801529:	85 c0                	test   %eax,%eax
+  80152b:	74 34                	je     801561 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80152d:	83 ec 08             	sub    $0x8,%esp
+  801530:	ff 75 0c             	push   0xc(%ebp)
+  801533:	56                   	push   %esi
+  801534:	ff d0                	call   *%eax
+  801536:	83 c4 10             	add    $0x10,%esp
+}
+  801539:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80153c:	5b                   	pop    %ebx
+  80153d:	5e                   	pop    %esi
+  80153e:	5d                   	pop    %ebp
+  80153f:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801540:	a1 00 50 80 00       	mov    0x805000,%eax
+  801545:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801548:	83 ec 04             	sub    $0x4,%esp
+  80154b:	53                   	push   %ebx
+  80154c:	50                   	push   %eax
+  80154d:	68 b0 3b 80 00       	push   $0x803bb0
+  801552:	e8 21 ec ff ff       	call   800178 <cprintf>
+		return -E_INVAL;
+  801557:	83 c4 10             	add    $0x10,%esp
+  80155a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80155f:	eb d8                	jmp    801539 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801561:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801566:	eb d1                	jmp    801539 <ftruncate+0x50>
+
+00801568 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	56                   	push   %esi
+  80156c:	53                   	push   %ebx
+  80156d:	83 ec 18             	sub    $0x18,%esp
+  801570:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801573:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801576:	50                   	push   %eax
+  801577:	ff 75 08             	push   0x8(%ebp)
+  80157a:	e8 0a fb ff ff       	call   801089 <fd_lookup>
+  80157f:	83 c4 10             	add    $0x10,%esp
+  801582:	85 c0                	test   %eax,%eax
+  801584:	78 49                	js     8015cf <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801586:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801589:	83 ec 08             	sub    $0x8,%esp
+  80158c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80158f:	50                   	push   %eax
+  801590:	ff 36                	push   (%esi)
+  801592:	e8 42 fb ff ff       	call   8010d9 <dev_lookup>
+  801597:	83 c4 10             	add    $0x10,%esp
+  80159a:	85 c0                	test   %eax,%eax
+  80159c:	78 31                	js     8015cf <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80159e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015a1:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8015a5:	74 2f                	je     8015d6 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8015a7:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8015aa:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8015b1:	00 00 00 
+	stat->st_isdir = 0;
+  8015b4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8015bb:	00 00 00 
+	stat->st_dev = dev;
+  8015be:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8015c4:	83 ec 08             	sub    $0x8,%esp
+  8015c7:	53                   	push   %ebx
+  8015c8:	56                   	push   %esi
+  8015c9:	ff 50 14             	call   *0x14(%eax)
+  8015cc:	83 c4 10             	add    $0x10,%esp
+}
+  8015cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015d2:	5b                   	pop    %ebx
+  8015d3:	5e                   	pop    %esi
+  8015d4:	5d                   	pop    %ebp
+  8015d5:	c3                   	ret
+		return -E_NOT_SUPP;
+  8015d6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015db:	eb f2                	jmp    8015cf <fstat+0x67>
+
+008015dd <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8015dd:	55                   	push   %ebp
+  8015de:	89 e5                	mov    %esp,%ebp
+  8015e0:	56                   	push   %esi
+  8015e1:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  8015e2:	83 ec 08             	sub    $0x8,%esp
+  8015e5:	68 00 10 00 00       	push   $0x1000
+  8015ea:	ff 75 08             	push   0x8(%ebp)
+  8015ed:	e8 b3 07 00 00       	call   801da5 <open>
+  8015f2:	89 c3                	mov    %eax,%ebx
+  8015f4:	83 c4 10             	add    $0x10,%esp
+  8015f7:	85 c0                	test   %eax,%eax
+  8015f9:	78 1b                	js     801616 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  8015fb:	83 ec 08             	sub    $0x8,%esp
+  8015fe:	ff 75 0c             	push   0xc(%ebp)
+  801601:	50                   	push   %eax
+  801602:	e8 61 ff ff ff       	call   801568 <fstat>
+  801607:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801609:	89 1c 24             	mov    %ebx,(%esp)
+  80160c:	e8 a2 fb ff ff       	call   8011b3 <close>
+	return r;
+  801611:	83 c4 10             	add    $0x10,%esp
+  801614:	89 f3                	mov    %esi,%ebx
+}
+  801616:	89 d8                	mov    %ebx,%eax
+  801618:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80161b:	5b                   	pop    %ebx
+  80161c:	5e                   	pop    %esi
+  80161d:	5d                   	pop    %ebp
+  80161e:	c3                   	ret
+
+0080161f <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  80161f:	55                   	push   %ebp
+  801620:	89 e5                	mov    %esp,%ebp
+  801622:	57                   	push   %edi
+  801623:	56                   	push   %esi
+  801624:	53                   	push   %ebx
+  801625:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  80162b:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801631:	89 d6                	mov    %edx,%esi
+  801633:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801639:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  80163c:	89 d3                	mov    %edx,%ebx
+  80163e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801644:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  80164b:	74 1d                	je     80166a <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80164d:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801652:	83 c8 07             	or     $0x7,%eax
+  801655:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  80165b:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801660:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801666:	01 ce                	add    %ecx,%esi
+  801668:	eb 28                	jmp    801692 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80166a:	83 ec 0c             	sub    $0xc,%esp
+  80166d:	6a 01                	push   $0x1
+  80166f:	e8 52 1e 00 00       	call   8034c6 <ipc_find_env>
+  801674:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801679:	83 c4 10             	add    $0x10,%esp
+  80167c:	eb cf                	jmp    80164d <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  80167e:	83 c0 01             	add    $0x1,%eax
+  801681:	89 fa                	mov    %edi,%edx
+  801683:	09 da                	or     %ebx,%edx
+  801685:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  80168c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801692:	39 f3                	cmp    %esi,%ebx
+  801694:	72 e8                	jb     80167e <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801696:	83 f8 41             	cmp    $0x41,%eax
+  801699:	77 2f                	ja     8016ca <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  80169b:	50                   	push   %eax
+  80169c:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  8016a2:	50                   	push   %eax
+  8016a3:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  8016a9:	ff 35 c8 70 80 00    	push   0x8070c8
+  8016af:	e8 c4 1d 00 00       	call   803478 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  8016b4:	83 c4 0c             	add    $0xc,%esp
+  8016b7:	6a 00                	push   $0x0
+  8016b9:	6a 00                	push   $0x0
+  8016bb:	6a 00                	push   $0x0
+  8016bd:	e8 60 1c 00 00       	call   803322 <ipc_recv>
+}
+  8016c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016c5:	5b                   	pop    %ebx
+  8016c6:	5e                   	pop    %esi
+  8016c7:	5f                   	pop    %edi
+  8016c8:	5d                   	pop    %ebp
+  8016c9:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  8016ca:	68 20 3c 80 00       	push   $0x803c20
+  8016cf:	68 6c 3b 80 00       	push   $0x803b6c
+  8016d4:	6a 40                	push   $0x40
+  8016d6:	68 3c 3c 80 00       	push   $0x803c3c
+  8016db:	e8 e7 18 00 00       	call   802fc7 <_panic>
+
+008016e0 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  8016e0:	55                   	push   %ebp
+  8016e1:	89 e5                	mov    %esp,%ebp
+  8016e3:	57                   	push   %edi
+  8016e4:	56                   	push   %esi
+  8016e5:	53                   	push   %ebx
+  8016e6:	83 ec 1c             	sub    $0x1c,%esp
+  8016e9:	89 c3                	mov    %eax,%ebx
+  8016eb:	89 d6                	mov    %edx,%esi
+  8016ed:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  8016f0:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  8016f6:	89 ca                	mov    %ecx,%edx
+  8016f8:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  8016fb:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801702:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801705:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  80170c:	8b 76 0c             	mov    0xc(%esi),%esi
+  80170f:	89 fb                	mov    %edi,%ebx
+  801711:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801718:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80171b:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801722:	8b 75 08             	mov    0x8(%ebp),%esi
+  801725:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  80172c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80172f:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801736:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801739:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801740:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801745:	39 c8                	cmp    %ecx,%eax
+  801747:	74 0d                	je     801756 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801749:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801751:	5b                   	pop    %ebx
+  801752:	5e                   	pop    %esi
+  801753:	5f                   	pop    %edi
+  801754:	5d                   	pop    %ebp
+  801755:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801756:	6a 07                	push   $0x7
+  801758:	68 00 60 80 00       	push   $0x806000
+  80175d:	6a 0d                	push   $0xd
+  80175f:	ff 35 c8 70 80 00    	push   0x8070c8
+  801765:	e8 23 1c 00 00       	call   80338d <ipc_send>
+  80176a:	83 c4 10             	add    $0x10,%esp
+  80176d:	eb da                	jmp    801749 <fsring_post+0x69>
+
+0080176f <fsipcv>:
+{
+  80176f:	55                   	push   %ebp
+  801770:	89 e5                	mov    %esp,%ebp
+  801772:	57                   	push   %edi
+  801773:	56                   	push   %esi
+  801774:	53                   	push   %ebx
+  801775:	83 ec 0c             	sub    $0xc,%esp
+  801778:	89 c7                	mov    %eax,%edi
+  80177a:	89 d3                	mov    %edx,%ebx
+  80177c:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  80177e:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801785:	74 26                	je     8017ad <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801787:	6a 07                	push   $0x7
+  801789:	68 00 60 80 00       	push   $0x806000
+  80178e:	57                   	push   %edi
+  80178f:	ff 35 c8 70 80 00    	push   0x8070c8
+  801795:	e8 f3 1b 00 00       	call   80338d <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  80179a:	6a 00                	push   $0x0
+  80179c:	56                   	push   %esi
+  80179d:	53                   	push   %ebx
+  80179e:	6a 00                	push   $0x0
+  8017a0:	e8 40 1c 00 00       	call   8033e5 <ipc_recvv>
+}
+  8017a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017a8:	5b                   	pop    %ebx
+  8017a9:	5e                   	pop    %esi
+  8017aa:	5f                   	pop    %edi
+  8017ab:	5d                   	pop    %ebp
+  8017ac:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017ad:	83 ec 0c             	sub    $0xc,%esp
+  8017b0:	6a 01                	push   $0x1
+  8017b2:	e8 0f 1d 00 00       	call   8034c6 <ipc_find_env>
+  8017b7:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8017bc:	83 c4 10             	add    $0x10,%esp
+  8017bf:	eb c6                	jmp    801787 <fsipcv+0x18>
+
+008017c1 <fsipc>:
+{
+  8017c1:	55                   	push   %ebp
+  8017c2:	89 e5                	mov    %esp,%ebp
+  8017c4:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  8017c7:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  8017ce:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8017d1:	e8 99 ff ff ff       	call   80176f <fsipcv>
+}
+  8017d6:	c9                   	leave
+  8017d7:	c3                   	ret
+
+008017d8 <file_write_direct>:
+{
+  8017d8:	55                   	push   %ebp
+  8017d9:	89 e5                	mov    %esp,%ebp
+  8017db:	56                   	push   %esi
+  8017dc:	53                   	push   %ebx
+  8017dd:	89 c3                	mov    %eax,%ebx
+  8017df:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8017e1:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  8017e7:	77 40                	ja     801829 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8017e9:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  8017ee:	39 c8                	cmp    %ecx,%eax
+  8017f0:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8017f3:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  8017f6:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  8017fc:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801801:	83 ec 04             	sub    $0x4,%esp
+  801804:	50                   	push   %eax
+  801805:	52                   	push   %edx
+  801806:	68 08 60 80 00       	push   $0x806008
+  80180b:	e8 dc f0 ff ff       	call   8008ec <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801810:	ba 00 00 00 00       	mov    $0x0,%edx
+  801815:	b8 04 00 00 00       	mov    $0x4,%eax
+  80181a:	e8 a2 ff ff ff       	call   8017c1 <fsipc>
+  80181f:	83 c4 10             	add    $0x10,%esp
+}
+  801822:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801825:	5b                   	pop    %ebx
+  801826:	5e                   	pop    %esi
+  801827:	5d                   	pop    %ebp
+  801828:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801829:	89 d6                	mov    %edx,%esi
+  80182b:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801831:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801836:	29 f1                	sub    %esi,%ecx
+  801838:	39 c1                	cmp    %eax,%ecx
+  80183a:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  80183d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801840:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801845:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  80184b:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801851:	83 ec 0c             	sub    $0xc,%esp
+  801854:	6a 05                	push   $0x5
+  801856:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80185b:	e8 bf fd ff ff       	call   80161f <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801860:	83 c4 10             	add    $0x10,%esp
+  801863:	eb bd                	jmp    801822 <file_write_direct+0x4a>
+
+00801865 <devfile_sync>:
+{
+  801865:	55                   	push   %ebp
+  801866:	89 e5                	mov    %esp,%ebp
+  801868:	57                   	push   %edi
+  801869:	56                   	push   %esi
+  80186a:	53                   	push   %ebx
+  80186b:	83 ec 28             	sub    $0x28,%esp
+  80186e:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801871:	56                   	push   %esi
+  801872:	e8 a5 f7 ff ff       	call   80101c <fd2data>
+  801877:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801879:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  80187c:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801883:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801886:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  80188b:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  80188f:	74 45                	je     8018d6 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801891:	8b 46 14             	mov    0x14(%esi),%eax
+  801894:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801897:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a1:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8018a4:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  8018a7:	39 cb                	cmp    %ecx,%ebx
+  8018a9:	73 14                	jae    8018bf <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  8018ab:	29 d9                	sub    %ebx,%ecx
+  8018ad:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8018b0:	89 f0                	mov    %esi,%eax
+  8018b2:	e8 21 ff ff ff       	call   8017d8 <file_write_direct>
+  8018b7:	85 c0                	test   %eax,%eax
+  8018b9:	7e 04                	jle    8018bf <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8018bb:	01 c3                	add    %eax,%ebx
+  8018bd:	eb e5                	jmp    8018a4 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  8018bf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8018c2:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  8018c9:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  8018cc:	85 c0                	test   %eax,%eax
+  8018ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d3:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8018d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018d9:	5b                   	pop    %ebx
+  8018da:	5e                   	pop    %esi
+  8018db:	5f                   	pop    %edi
+  8018dc:	5d                   	pop    %ebp
+  8018dd:	c3                   	ret
+
+008018de <devfile_write>:
+{
+  8018de:	55                   	push   %ebp
+  8018df:	89 e5                	mov    %esp,%ebp
+  8018e1:	57                   	push   %edi
+  8018e2:	56                   	push   %esi
+  8018e3:	53                   	push   %ebx
+  8018e4:	83 ec 28             	sub    $0x28,%esp
+  8018e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8018ea:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8018ed:	53                   	push   %ebx
+  8018ee:	e8 29 f7 ff ff       	call   80101c <fd2data>
+  8018f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8018f6:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8018f9:	83 c4 10             	add    $0x10,%esp
+  8018fc:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801900:	74 43                	je     801945 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801902:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801909:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80190c:	85 c0                	test   %eax,%eax
+  80190e:	74 43                	je     801953 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801910:	89 c2                	mov    %eax,%edx
+  801912:	03 53 14             	add    0x14(%ebx),%edx
+  801915:	39 fa                	cmp    %edi,%edx
+  801917:	75 0b                	jne    801924 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801919:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  80191c:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801922:	76 66                	jbe    80198a <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801924:	83 ec 0c             	sub    $0xc,%esp
+  801927:	53                   	push   %ebx
+  801928:	e8 38 ff ff ff       	call   801865 <devfile_sync>
+  80192d:	83 c4 10             	add    $0x10,%esp
+  801930:	85 c0                	test   %eax,%eax
+  801932:	78 4e                	js     801982 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801934:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80193a:	77 56                	ja     801992 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  80193c:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80193f:	85 c0                	test   %eax,%eax
+  801941:	75 20                	jne    801963 <devfile_write+0x85>
+  801943:	eb 16                	jmp    80195b <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801945:	89 f1                	mov    %esi,%ecx
+  801947:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80194a:	89 d8                	mov    %ebx,%eax
+  80194c:	e8 87 fe ff ff       	call   8017d8 <file_write_direct>
+  801951:	eb 2f                	jmp    801982 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801953:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801959:	77 37                	ja     801992 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  80195b:	89 7b 14             	mov    %edi,0x14(%ebx)
+  80195e:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801963:	83 ec 04             	sub    $0x4,%esp
+  801966:	56                   	push   %esi
+  801967:	ff 75 0c             	push   0xc(%ebp)
+  80196a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80196d:	01 c1                	add    %eax,%ecx
+  80196f:	51                   	push   %ecx
+  801970:	e8 77 ef ff ff       	call   8008ec <memmove>
+	ff->buf_wlen += n;
+  801975:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801978:	01 f7                	add    %esi,%edi
+  80197a:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80197d:	89 f0                	mov    %esi,%eax
+  80197f:	83 c4 10             	add    $0x10,%esp
+}
+  801982:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801985:	5b                   	pop    %ebx
+  801986:	5e                   	pop    %esi
+  801987:	5f                   	pop    %edi
+  801988:	5d                   	pop    %ebp
+  801989:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  80198a:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801990:	76 d1                	jbe    801963 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801992:	89 f1                	mov    %esi,%ecx
+  801994:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801997:	89 d8                	mov    %ebx,%eax
+  801999:	e8 3a fe ff ff       	call   8017d8 <file_write_direct>
+  80199e:	eb e2                	jmp    801982 <devfile_write+0xa4>
+
+008019a0 <devfile_trunc>:
+{
+  8019a0:	55                   	push   %ebp
+  8019a1:	89 e5                	mov    %esp,%ebp
+  8019a3:	53                   	push   %ebx
+  8019a4:	83 ec 10             	sub    $0x10,%esp
+  8019a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  8019aa:	53                   	push   %ebx
+  8019ab:	e8 b5 fe ff ff       	call   801865 <devfile_sync>
+  8019b0:	83 c4 10             	add    $0x10,%esp
+  8019b3:	85 c0                	test   %eax,%eax
+  8019b5:	78 1f                	js     8019d6 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019b7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8019ba:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8019bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019c2:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8019c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019cc:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019d1:	e8 eb fd ff ff       	call   8017c1 <fsipc>
+}
+  8019d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019d9:	c9                   	leave
+  8019da:	c3                   	ret
+
+008019db <devfile_stat>:
+{
+  8019db:	55                   	push   %ebp
+  8019dc:	89 e5                	mov    %esp,%ebp
+  8019de:	56                   	push   %esi
+  8019df:	53                   	push   %ebx
+  8019e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  8019e6:	83 ec 0c             	sub    $0xc,%esp
+  8019e9:	53                   	push   %ebx
+  8019ea:	e8 76 fe ff ff       	call   801865 <devfile_sync>
+  8019ef:	83 c4 10             	add    $0x10,%esp
+  8019f2:	85 c0                	test   %eax,%eax
+  8019f4:	78 47                	js     801a3d <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019f6:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8019f9:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a03:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a08:	e8 b4 fd ff ff       	call   8017c1 <fsipc>
+  801a0d:	85 c0                	test   %eax,%eax
+  801a0f:	78 2c                	js     801a3d <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a11:	83 ec 08             	sub    $0x8,%esp
+  801a14:	68 00 60 80 00       	push   $0x806000
+  801a19:	56                   	push   %esi
+  801a1a:	e8 47 ed ff ff       	call   800766 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a1f:	a1 80 60 80 00       	mov    0x806080,%eax
+  801a24:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a2a:	a1 84 60 80 00       	mov    0x806084,%eax
+  801a2f:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801a35:	83 c4 10             	add    $0x10,%esp
+  801a38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a40:	5b                   	pop    %ebx
+  801a41:	5e                   	pop    %esi
+  801a42:	5d                   	pop    %ebp
+  801a43:	c3                   	ret
+
+00801a44 <devfile_flush>:
+{
+  801a44:	55                   	push   %ebp
+  801a45:	89 e5                	mov    %esp,%ebp
+  801a47:	56                   	push   %esi
+  801a48:	53                   	push   %ebx
+  801a49:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801a4c:	83 ec 0c             	sub    $0xc,%esp
+  801a4f:	56                   	push   %esi
+  801a50:	e8 10 fe ff ff       	call   801865 <devfile_sync>
+  801a55:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801a57:	83 c4 10             	add    $0x10,%esp
+  801a5a:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801a5e:	75 25                	jne    801a85 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a60:	8b 46 0c             	mov    0xc(%esi),%eax
+  801a63:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801a68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a72:	e8 4a fd ff ff       	call   8017c1 <fsipc>
+  801a77:	85 c0                	test   %eax,%eax
+  801a79:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801a7c:	89 d8                	mov    %ebx,%eax
+  801a7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a81:	5b                   	pop    %ebx
+  801a82:	5e                   	pop    %esi
+  801a83:	5d                   	pop    %ebp
+  801a84:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801a85:	83 ec 0c             	sub    $0xc,%esp
+  801a88:	56                   	push   %esi
+  801a89:	e8 8e f5 ff ff       	call   80101c <fd2data>
+  801a8e:	83 c4 08             	add    $0x8,%esp
+  801a91:	50                   	push   %eax
+  801a92:	6a 00                	push   $0x0
+  801a94:	e8 66 f1 ff ff       	call   800bff <sys_page_unmap>
+  801a99:	83 c4 10             	add    $0x10,%esp
+  801a9c:	eb c2                	jmp    801a60 <devfile_flush+0x1c>
+
+00801a9e <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801a9e:	55                   	push   %ebp
+  801a9f:	89 e5                	mov    %esp,%ebp
+  801aa1:	57                   	push   %edi
+  801aa2:	56                   	push   %esi
+  801aa3:	53                   	push   %ebx
+  801aa4:	83 ec 64             	sub    $0x64,%esp
+  801aa7:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801aa9:	52                   	push   %edx
+  801aaa:	50                   	push   %eax
+  801aab:	e8 d9 f5 ff ff       	call   801089 <fd_lookup>
+  801ab0:	89 c1                	mov    %eax,%ecx
+  801ab2:	83 c4 10             	add    $0x10,%esp
+  801ab5:	85 c0                	test   %eax,%eax
+  801ab7:	0f 88 f2 00 00 00    	js     801baf <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801abd:	8b 07                	mov    (%edi),%eax
+  801abf:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801ac5:	39 10                	cmp    %edx,(%eax)
+  801ac7:	0f 85 03 01 00 00    	jne    801bd0 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801acd:	a1 00 50 80 00       	mov    0x805000,%eax
+  801ad2:	8b 40 48             	mov    0x48(%eax),%eax
+  801ad5:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801adb:	0f 84 96 00 00 00    	je     801b77 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801ae1:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801ae8:	0f 84 cb 00 00 00    	je     801bb9 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801aee:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801af3:	83 c8 07             	or     $0x7,%eax
+  801af6:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801af9:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801afc:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801b01:	83 ec 04             	sub    $0x4,%esp
+  801b04:	68 07 04 00 00       	push   $0x407
+  801b09:	53                   	push   %ebx
+  801b0a:	6a 00                	push   $0x0
+  801b0c:	e8 61 f0 ff ff       	call   800b72 <sys_page_alloc>
+  801b11:	89 c1                	mov    %eax,%ecx
+  801b13:	83 c4 10             	add    $0x10,%esp
+  801b16:	85 c0                	test   %eax,%eax
+  801b18:	0f 88 91 00 00 00    	js     801baf <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801b1e:	89 d8                	mov    %ebx,%eax
+  801b20:	83 c8 07             	or     $0x7,%eax
+  801b23:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801b25:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b2b:	83 c6 04             	add    $0x4,%esi
+  801b2e:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801b34:	75 cb                	jne    801b01 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801b36:	6a 12                	push   $0x12
+  801b38:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801b3b:	50                   	push   %eax
+  801b3c:	6a 0c                	push   $0xc
+  801b3e:	ff 35 c8 70 80 00    	push   0x8070c8
+  801b44:	e8 2f 19 00 00       	call   803478 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801b49:	83 c4 0c             	add    $0xc,%esp
+  801b4c:	6a 00                	push   $0x0
+  801b4e:	6a 00                	push   $0x0
+  801b50:	6a 00                	push   $0x0
+  801b52:	e8 cb 17 00 00       	call   803322 <ipc_recv>
+  801b57:	89 c1                	mov    %eax,%ecx
+  801b59:	83 c4 10             	add    $0x10,%esp
+  801b5c:	85 c0                	test   %eax,%eax
+  801b5e:	78 4f                	js     801baf <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801b60:	a1 00 50 80 00       	mov    0x805000,%eax
+  801b65:	8b 40 48             	mov    0x48(%eax),%eax
+  801b68:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801b6d:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801b74:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801b77:	83 ec 0c             	sub    $0xc,%esp
+  801b7a:	ff 37                	push   (%edi)
+  801b7c:	e8 e4 fc ff ff       	call   801865 <devfile_sync>
+  801b81:	89 c1                	mov    %eax,%ecx
+  801b83:	83 c4 10             	add    $0x10,%esp
+  801b86:	85 c0                	test   %eax,%eax
+  801b88:	78 25                	js     801baf <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801b8a:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801b90:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801b95:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b9a:	89 d0                	mov    %edx,%eax
+  801b9c:	d3 e0                	shl    %cl,%eax
+  801b9e:	85 d8                	test   %ebx,%eax
+  801ba0:	74 0d                	je     801baf <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801ba2:	83 c1 01             	add    $0x1,%ecx
+  801ba5:	83 f9 10             	cmp    $0x10,%ecx
+  801ba8:	75 f0                	jne    801b9a <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801baa:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801baf:	89 c8                	mov    %ecx,%eax
+  801bb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bb4:	5b                   	pop    %ebx
+  801bb5:	5e                   	pop    %esi
+  801bb6:	5f                   	pop    %edi
+  801bb7:	5d                   	pop    %ebp
+  801bb8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801bb9:	83 ec 0c             	sub    $0xc,%esp
+  801bbc:	6a 01                	push   $0x1
+  801bbe:	e8 03 19 00 00       	call   8034c6 <ipc_find_env>
+  801bc3:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801bc8:	83 c4 10             	add    $0x10,%esp
+  801bcb:	e9 1e ff ff ff       	jmp    801aee <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801bd0:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801bd5:	eb d8                	jmp    801baf <fsring_slot+0x111>
+
+00801bd7 <file_read_direct>:
+{
+  801bd7:	55                   	push   %ebp
+  801bd8:	89 e5                	mov    %esp,%ebp
+  801bda:	57                   	push   %edi
+  801bdb:	56                   	push   %esi
+  801bdc:	53                   	push   %ebx
+  801bdd:	83 ec 1c             	sub    $0x1c,%esp
+  801be0:	89 c7                	mov    %eax,%edi
+  801be2:	89 d6                	mov    %edx,%esi
+  801be4:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801be6:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801bec:	77 52                	ja     801c40 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bee:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bf1:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801bf6:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801bfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c01:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c06:	e8 b6 fb ff ff       	call   8017c1 <fsipc>
+  801c0b:	89 c7                	mov    %eax,%edi
+  801c0d:	85 c0                	test   %eax,%eax
+  801c0f:	78 25                	js     801c36 <file_read_direct+0x5f>
+	assert(r <= n);
+  801c11:	39 c3                	cmp    %eax,%ebx
+  801c13:	0f 82 87 00 00 00    	jb     801ca0 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801c19:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c1e:	0f 8f 95 00 00 00    	jg     801cb9 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801c24:	83 ec 04             	sub    $0x4,%esp
+  801c27:	50                   	push   %eax
+  801c28:	68 00 60 80 00       	push   $0x806000
+  801c2d:	56                   	push   %esi
+  801c2e:	e8 b9 ec ff ff       	call   8008ec <memmove>
+	return r;
+  801c33:	83 c4 10             	add    $0x10,%esp
+}
+  801c36:	89 f8                	mov    %edi,%eax
+  801c38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3b:	5b                   	pop    %ebx
+  801c3c:	5e                   	pop    %esi
+  801c3d:	5f                   	pop    %edi
+  801c3e:	5d                   	pop    %ebp
+  801c3f:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801c40:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801c46:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801c4b:	29 d1                	sub    %edx,%ecx
+  801c4d:	39 d9                	cmp    %ebx,%ecx
+  801c4f:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801c52:	89 f0                	mov    %esi,%eax
+  801c54:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801c57:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801c5a:	eb 0f                	jmp    801c6b <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801c5c:	0f b6 10             	movzbl (%eax),%edx
+  801c5f:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801c61:	05 00 10 00 00       	add    $0x1000,%eax
+  801c66:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c6b:	39 c8                	cmp    %ecx,%eax
+  801c6d:	72 ed                	jb     801c5c <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801c6f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c72:	8b 47 0c             	mov    0xc(%edi),%eax
+  801c75:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801c7a:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801c80:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801c86:	83 ec 0c             	sub    $0xc,%esp
+  801c89:	6a 07                	push   $0x7
+  801c8b:	89 d9                	mov    %ebx,%ecx
+  801c8d:	89 f2                	mov    %esi,%edx
+  801c8f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c94:	e8 86 f9 ff ff       	call   80161f <fsipc_pages>
+  801c99:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801c9b:	83 c4 10             	add    $0x10,%esp
+  801c9e:	eb 96                	jmp    801c36 <file_read_direct+0x5f>
+	assert(r <= n);
+  801ca0:	68 47 3c 80 00       	push   $0x803c47
+  801ca5:	68 6c 3b 80 00       	push   $0x803b6c
+  801caa:	68 dc 00 00 00       	push   $0xdc
+  801caf:	68 3c 3c 80 00       	push   $0x803c3c
+  801cb4:	e8 0e 13 00 00       	call   802fc7 <_panic>
+	assert(r <= PGSIZE);
+  801cb9:	68 58 3c 80 00       	push   $0x803c58
+  801cbe:	68 6c 3b 80 00       	push   $0x803b6c
+  801cc3:	68 dd 00 00 00       	push   $0xdd
+  801cc8:	68 3c 3c 80 00       	push   $0x803c3c
+  801ccd:	e8 f5 12 00 00       	call   802fc7 <_panic>
+
+00801cd2 <devfile_read>:
+{
+  801cd2:	55                   	push   %ebp
+  801cd3:	89 e5                	mov    %esp,%ebp
+  801cd5:	57                   	push   %edi
+  801cd6:	56                   	push   %esi
+  801cd7:	53                   	push   %ebx
+  801cd8:	83 ec 28             	sub    $0x28,%esp
+  801cdb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801cde:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801ce1:	53                   	push   %ebx
+  801ce2:	e8 35 f3 ff ff       	call   80101c <fd2data>
+  801ce7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801cea:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801cf4:	74 7d                	je     801d73 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801cf6:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801cfa:	0f 85 81 00 00 00    	jne    801d81 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801d00:	8b 43 18             	mov    0x18(%ebx),%eax
+  801d03:	85 c0                	test   %eax,%eax
+  801d05:	74 0d                	je     801d14 <devfile_read+0x42>
+  801d07:	8b 53 14             	mov    0x14(%ebx),%edx
+  801d0a:	39 fa                	cmp    %edi,%edx
+  801d0c:	7f 06                	jg     801d14 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801d0e:	01 c2                	add    %eax,%edx
+  801d10:	39 d7                	cmp    %edx,%edi
+  801d12:	72 28                	jb     801d3c <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801d14:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801d1b:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d21:	77 74                	ja     801d97 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801d23:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d28:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d2b:	89 d8                	mov    %ebx,%eax
+  801d2d:	e8 a5 fe ff ff       	call   801bd7 <file_read_direct>
+  801d32:	85 c0                	test   %eax,%eax
+  801d34:	7e 35                	jle    801d6b <devfile_read+0x99>
+		ff->buf_base = pos;
+  801d36:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801d39:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801d3c:	8b 53 14             	mov    0x14(%ebx),%edx
+  801d3f:	89 d0                	mov    %edx,%eax
+  801d41:	03 43 18             	add    0x18(%ebx),%eax
+  801d44:	29 f8                	sub    %edi,%eax
+  801d46:	39 f0                	cmp    %esi,%eax
+  801d48:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801d4b:	83 ec 04             	sub    $0x4,%esp
+  801d4e:	56                   	push   %esi
+  801d4f:	89 f8                	mov    %edi,%eax
+  801d51:	29 d0                	sub    %edx,%eax
+  801d53:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d56:	01 c1                	add    %eax,%ecx
+  801d58:	51                   	push   %ecx
+  801d59:	ff 75 0c             	push   0xc(%ebp)
+  801d5c:	e8 8b eb ff ff       	call   8008ec <memmove>
+	fd->fd_offset = pos + n;
+  801d61:	01 f7                	add    %esi,%edi
+  801d63:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801d66:	89 f0                	mov    %esi,%eax
+  801d68:	83 c4 10             	add    $0x10,%esp
+}
+  801d6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d6e:	5b                   	pop    %ebx
+  801d6f:	5e                   	pop    %esi
+  801d70:	5f                   	pop    %edi
+  801d71:	5d                   	pop    %ebp
+  801d72:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801d73:	89 f1                	mov    %esi,%ecx
+  801d75:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d78:	89 d8                	mov    %ebx,%eax
+  801d7a:	e8 58 fe ff ff       	call   801bd7 <file_read_direct>
+  801d7f:	eb ea                	jmp    801d6b <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801d81:	83 ec 0c             	sub    $0xc,%esp
+  801d84:	53                   	push   %ebx
+  801d85:	e8 db fa ff ff       	call   801865 <devfile_sync>
+  801d8a:	83 c4 10             	add    $0x10,%esp
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	0f 89 6b ff ff ff    	jns    801d00 <devfile_read+0x2e>
+  801d95:	eb d4                	jmp    801d6b <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801d97:	89 f1                	mov    %esi,%ecx
+  801d99:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d9c:	89 d8                	mov    %ebx,%eax
+  801d9e:	e8 34 fe ff ff       	call   801bd7 <file_read_direct>
+  801da3:	eb c6                	jmp    801d6b <devfile_read+0x99>
+
+00801da5 <open>:
+{
+  801da5:	55                   	push   %ebp
+  801da6:	89 e5                	mov    %esp,%ebp
+  801da8:	56                   	push   %esi
+  801da9:	53                   	push   %ebx
+  801daa:	83 ec 1c             	sub    $0x1c,%esp
+  801dad:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801db0:	56                   	push   %esi
+  801db1:	e8 75 e9 ff ff       	call   80072b <strlen>
+  801db6:	83 c4 10             	add    $0x10,%esp
+  801db9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801dbe:	0f 8f a0 00 00 00    	jg     801e64 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801dc4:	83 ec 0c             	sub    $0xc,%esp
+  801dc7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dca:	50                   	push   %eax
+  801dcb:	e8 63 f2 ff ff       	call   801033 <fd_alloc>
+  801dd0:	89 c3                	mov    %eax,%ebx
+  801dd2:	83 c4 10             	add    $0x10,%esp
+  801dd5:	85 c0                	test   %eax,%eax
+  801dd7:	78 45                	js     801e1e <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801dd9:	83 ec 08             	sub    $0x8,%esp
+  801ddc:	56                   	push   %esi
+  801ddd:	68 00 60 80 00       	push   $0x806000
+  801de2:	e8 7f e9 ff ff       	call   800766 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801de7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dea:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801def:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801df2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801df7:	e8 c5 f9 ff ff       	call   8017c1 <fsipc>
+  801dfc:	89 c3                	mov    %eax,%ebx
+  801dfe:	83 c4 10             	add    $0x10,%esp
+  801e01:	85 c0                	test   %eax,%eax
+  801e03:	78 22                	js     801e27 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801e05:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801e0c:	74 2b                	je     801e39 <open+0x94>
+	return fd2num(fd);
+  801e0e:	83 ec 0c             	sub    $0xc,%esp
+  801e11:	ff 75 f4             	push   -0xc(%ebp)
+  801e14:	e8 f3 f1 ff ff       	call   80100c <fd2num>
+  801e19:	89 c3                	mov    %eax,%ebx
+  801e1b:	83 c4 10             	add    $0x10,%esp
+}
+  801e1e:	89 d8                	mov    %ebx,%eax
+  801e20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e23:	5b                   	pop    %ebx
+  801e24:	5e                   	pop    %esi
+  801e25:	5d                   	pop    %ebp
+  801e26:	c3                   	ret
+		fd_close(fd, 0);
+  801e27:	83 ec 08             	sub    $0x8,%esp
+  801e2a:	6a 00                	push   $0x0
+  801e2c:	ff 75 f4             	push   -0xc(%ebp)
+  801e2f:	e8 f8 f2 ff ff       	call   80112c <fd_close>
+		return r;
+  801e34:	83 c4 10             	add    $0x10,%esp
+  801e37:	eb e5                	jmp    801e1e <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801e39:	83 ec 0c             	sub    $0xc,%esp
+  801e3c:	ff 75 f4             	push   -0xc(%ebp)
+  801e3f:	e8 d8 f1 ff ff       	call   80101c <fd2data>
+  801e44:	83 c4 0c             	add    $0xc,%esp
+  801e47:	68 07 04 00 00       	push   $0x407
+  801e4c:	50                   	push   %eax
+  801e4d:	6a 00                	push   $0x0
+  801e4f:	e8 1e ed ff ff       	call   800b72 <sys_page_alloc>
+  801e54:	83 c4 10             	add    $0x10,%esp
+  801e57:	85 c0                	test   %eax,%eax
+  801e59:	75 b3                	jne    801e0e <open+0x69>
+		fd->fd_file.buffered = 1;
+  801e5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e5e:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801e62:	eb aa                	jmp    801e0e <open+0x69>
+		return -E_BAD_PATH;
+  801e64:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e69:	eb b3                	jmp    801e1e <open+0x79>
+
+00801e6b <readdir>:
+{
+  801e6b:	55                   	push   %ebp
+  801e6c:	89 e5                	mov    %esp,%ebp
+  801e6e:	53                   	push   %ebx
+  801e6f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e72:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e75:	50                   	push   %eax
+  801e76:	ff 75 08             	push   0x8(%ebp)
+  801e79:	e8 0b f2 ff ff       	call   801089 <fd_lookup>
+  801e7e:	89 c3                	mov    %eax,%ebx
+  801e80:	83 c4 10             	add    $0x10,%esp
+  801e83:	85 c0                	test   %eax,%eax
+  801e85:	78 73                	js     801efa <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801e87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e8a:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801e90:	39 08                	cmp    %ecx,(%eax)
+  801e92:	0f 85 82 00 00 00    	jne    801f1a <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801e98:	83 ec 0c             	sub    $0xc,%esp
+  801e9b:	50                   	push   %eax
+  801e9c:	e8 c4 f9 ff ff       	call   801865 <devfile_sync>
+  801ea1:	89 c3                	mov    %eax,%ebx
+  801ea3:	83 c4 10             	add    $0x10,%esp
+  801ea6:	85 c0                	test   %eax,%eax
+  801ea8:	78 50                	js     801efa <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801eaa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ead:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eb0:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801eb5:	8b 45 10             	mov    0x10(%ebp),%eax
+  801eb8:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801ebd:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ec0:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801ec5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eca:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ecf:	e8 ed f8 ff ff       	call   8017c1 <fsipc>
+  801ed4:	89 c3                	mov    %eax,%ebx
+  801ed6:	85 c0                	test   %eax,%eax
+  801ed8:	7e 20                	jle    801efa <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801eda:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801edd:	72 22                	jb     801f01 <readdir+0x96>
+  801edf:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ee4:	7f 1b                	jg     801f01 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801ee6:	83 ec 04             	sub    $0x4,%esp
+  801ee9:	50                   	push   %eax
+  801eea:	68 00 60 80 00       	push   $0x806000
+  801eef:	ff 75 0c             	push   0xc(%ebp)
+  801ef2:	e8 f5 e9 ff ff       	call   8008ec <memmove>
+	return r;
+  801ef7:	83 c4 10             	add    $0x10,%esp
+}
+  801efa:	89 d8                	mov    %ebx,%eax
+  801efc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eff:	c9                   	leave
+  801f00:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801f01:	68 4e 3c 80 00       	push   $0x803c4e
+  801f06:	68 6c 3b 80 00       	push   $0x803b6c
+  801f0b:	68 86 01 00 00       	push   $0x186
+  801f10:	68 3c 3c 80 00       	push   $0x803c3c
+  801f15:	e8 ad 10 00 00       	call   802fc7 <_panic>
+		return -E_NOT_SUPP;
+  801f1a:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801f1f:	eb d9                	jmp    801efa <readdir+0x8f>
+
+00801f21 <munmap>:
+{
+  801f21:	55                   	push   %ebp
+  801f22:	89 e5                	mov    %esp,%ebp
+  801f24:	56                   	push   %esi
+  801f25:	53                   	push   %ebx
+  801f26:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f29:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801f2c:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801f32:	75 41                	jne    801f75 <munmap+0x54>
+  801f34:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801f3a:	77 39                	ja     801f75 <munmap+0x54>
+  801f3c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f41:	29 f0                	sub    %esi,%eax
+  801f43:	39 d0                	cmp    %edx,%eax
+  801f45:	72 35                	jb     801f7c <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801f47:	89 f3                	mov    %esi,%ebx
+  801f49:	01 d6                	add    %edx,%esi
+  801f4b:	39 f3                	cmp    %esi,%ebx
+  801f4d:	73 1a                	jae    801f69 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801f4f:	83 ec 08             	sub    $0x8,%esp
+  801f52:	53                   	push   %ebx
+  801f53:	6a 00                	push   $0x0
+  801f55:	e8 a5 ec ff ff       	call   800bff <sys_page_unmap>
+  801f5a:	83 c4 10             	add    $0x10,%esp
+  801f5d:	85 c0                	test   %eax,%eax
+  801f5f:	78 0d                	js     801f6e <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801f61:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f67:	eb e2                	jmp    801f4b <munmap+0x2a>
+	return 0;
+  801f69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f71:	5b                   	pop    %ebx
+  801f72:	5e                   	pop    %esi
+  801f73:	5d                   	pop    %ebp
+  801f74:	c3                   	ret
+		return -E_INVAL;
+  801f75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f7a:	eb f2                	jmp    801f6e <munmap+0x4d>
+  801f7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f81:	eb eb                	jmp    801f6e <munmap+0x4d>
+
+00801f83 <mmap>:
+{
+  801f83:	55                   	push   %ebp
+  801f84:	89 e5                	mov    %esp,%ebp
+  801f86:	57                   	push   %edi
+  801f87:	56                   	push   %esi
+  801f88:	53                   	push   %ebx
+  801f89:	83 ec 34             	sub    $0x34,%esp
+  801f8c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f8f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f92:	50                   	push   %eax
+  801f93:	ff 75 18             	push   0x18(%ebp)
+  801f96:	e8 ee f0 ff ff       	call   801089 <fd_lookup>
+  801f9b:	89 c3                	mov    %eax,%ebx
+  801f9d:	83 c4 10             	add    $0x10,%esp
+  801fa0:	85 c0                	test   %eax,%eax
+  801fa2:	0f 88 0e 01 00 00    	js     8020b6 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801fa8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fab:	a1 20 40 80 00       	mov    0x804020,%eax
+  801fb0:	39 02                	cmp    %eax,(%edx)
+  801fb2:	0f 85 50 01 00 00    	jne    802108 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801fb8:	8b 45 10             	mov    0x10(%ebp),%eax
+  801fbb:	83 e0 02             	and    $0x2,%eax
+  801fbe:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801fc1:	74 0a                	je     801fcd <mmap+0x4a>
+  801fc3:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801fc7:	0f 84 42 01 00 00    	je     80210f <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801fcd:	8b 42 08             	mov    0x8(%edx),%eax
+  801fd0:	83 e0 03             	and    $0x3,%eax
+  801fd3:	83 f8 01             	cmp    $0x1,%eax
+  801fd6:	0f 84 3a 01 00 00    	je     802116 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  801fdc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fdf:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801fe2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801fe7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801fea:	0f 85 2d 01 00 00    	jne    80211d <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801ff0:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801ff4:	0f 88 2a 01 00 00    	js     802124 <mmap+0x1a1>
+  801ffa:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  802001:	0f 87 1d 01 00 00    	ja     802124 <mmap+0x1a1>
+  802007:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80200c:	2b 45 08             	sub    0x8(%ebp),%eax
+  80200f:	39 f8                	cmp    %edi,%eax
+  802011:	0f 82 14 01 00 00    	jb     80212b <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802017:	83 ec 0c             	sub    $0xc,%esp
+  80201a:	52                   	push   %edx
+  80201b:	e8 45 f8 ff ff       	call   801865 <devfile_sync>
+  802020:	89 c3                	mov    %eax,%ebx
+  802022:	83 c4 10             	add    $0x10,%esp
+  802025:	85 c0                	test   %eax,%eax
+  802027:	0f 88 89 00 00 00    	js     8020b6 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  80202d:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802033:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802039:	be 00 00 00 00       	mov    $0x0,%esi
+  80203e:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802041:	39 fe                	cmp    %edi,%esi
+  802043:	73 7b                	jae    8020c0 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  802045:	89 f8                	mov    %edi,%eax
+  802047:	29 f0                	sub    %esi,%eax
+  802049:	c1 e8 0c             	shr    $0xc,%eax
+  80204c:	ba 40 00 00 00       	mov    $0x40,%edx
+  802051:	39 d0                	cmp    %edx,%eax
+  802053:	0f 47 c2             	cmova  %edx,%eax
+  802056:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802059:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80205c:	8b 52 0c             	mov    0xc(%edx),%edx
+  80205f:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  802065:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802068:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  80206e:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802073:	89 f2                	mov    %esi,%edx
+  802075:	03 55 08             	add    0x8(%ebp),%edx
+  802078:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80207b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802080:	e8 ea f6 ff ff       	call   80176f <fsipcv>
+  802085:	85 c0                	test   %eax,%eax
+  802087:	7e 12                	jle    80209b <mmap+0x118>
+  802089:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80208c:	85 c0                	test   %eax,%eax
+  80208e:	0f 84 9e 00 00 00    	je     802132 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802094:	c1 e0 0c             	shl    $0xc,%eax
+  802097:	01 c6                	add    %eax,%esi
+  802099:	eb a6                	jmp    802041 <mmap+0xbe>
+			munmap(addr, done);
+  80209b:	89 c3                	mov    %eax,%ebx
+  80209d:	83 ec 08             	sub    $0x8,%esp
+  8020a0:	56                   	push   %esi
+  8020a1:	ff 75 08             	push   0x8(%ebp)
+  8020a4:	e8 78 fe ff ff       	call   801f21 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  8020a9:	83 c4 10             	add    $0x10,%esp
+  8020ac:	85 db                	test   %ebx,%ebx
+  8020ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020b3:	0f 49 d8             	cmovns %eax,%ebx
+}
+  8020b6:	89 d8                	mov    %ebx,%eax
+  8020b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020bb:	5b                   	pop    %ebx
+  8020bc:	5e                   	pop    %esi
+  8020bd:	5f                   	pop    %edi
+  8020be:	5d                   	pop    %ebp
+  8020bf:	c3                   	ret
+	if (prot & PROT_WRITE)
+  8020c0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8020c3:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8020c5:	85 c0                	test   %eax,%eax
+  8020c7:	74 ed                	je     8020b6 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8020c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020d1:	39 fe                	cmp    %edi,%esi
+  8020d3:	73 2e                	jae    802103 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8020d5:	83 ec 0c             	sub    $0xc,%esp
+  8020d8:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8020db:	50                   	push   %eax
+  8020dc:	e8 43 10 00 00       	call   803124 <cowpage>
+  8020e1:	83 c4 10             	add    $0x10,%esp
+  8020e4:	85 c0                	test   %eax,%eax
+  8020e6:	78 08                	js     8020f0 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8020e8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8020ee:	eb e1                	jmp    8020d1 <mmap+0x14e>
+				munmap(addr, len);
+  8020f0:	89 c3                	mov    %eax,%ebx
+  8020f2:	83 ec 08             	sub    $0x8,%esp
+  8020f5:	57                   	push   %edi
+  8020f6:	ff 75 08             	push   0x8(%ebp)
+  8020f9:	e8 23 fe ff ff       	call   801f21 <munmap>
+				return r;
+  8020fe:	83 c4 10             	add    $0x10,%esp
+  802101:	eb b3                	jmp    8020b6 <mmap+0x133>
+	return 0;
+  802103:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802106:	eb ae                	jmp    8020b6 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802108:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80210d:	eb a7                	jmp    8020b6 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80210f:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802114:	eb a0                	jmp    8020b6 <mmap+0x133>
+		return -E_INVAL;
+  802116:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80211b:	eb 99                	jmp    8020b6 <mmap+0x133>
+  80211d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802122:	eb 92                	jmp    8020b6 <mmap+0x133>
+  802124:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802129:	eb 8b                	jmp    8020b6 <mmap+0x133>
+  80212b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802130:	eb 84                	jmp    8020b6 <mmap+0x133>
+			munmap(addr, done);
+  802132:	83 ec 08             	sub    $0x8,%esp
+  802135:	56                   	push   %esi
+  802136:	ff 75 08             	push   0x8(%ebp)
+  802139:	e8 e3 fd ff ff       	call   801f21 <munmap>
+  80213e:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802141:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802146:	e9 6b ff ff ff       	jmp    8020b6 <mmap+0x133>
+
+0080214b <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80214b:	55                   	push   %ebp
+  80214c:	89 e5                	mov    %esp,%ebp
+  80214e:	56                   	push   %esi
+  80214f:	53                   	push   %ebx
+  802150:	83 ec 10             	sub    $0x10,%esp
+  802153:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802156:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802159:	8b 45 08             	mov    0x8(%ebp),%eax
+  80215c:	e8 3d f9 ff ff       	call   801a9e <fsring_slot>
+  802161:	85 c0                	test   %eax,%eax
+  802163:	78 60                	js     8021c5 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802165:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802168:	8b 56 08             	mov    0x8(%esi),%edx
+  80216b:	83 e2 03             	and    $0x3,%edx
+  80216e:	83 fa 01             	cmp    $0x1,%edx
+  802171:	74 59                	je     8021cc <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802173:	ba 01 00 00 00       	mov    $0x1,%edx
+  802178:	89 c1                	mov    %eax,%ecx
+  80217a:	d3 e2                	shl    %cl,%edx
+  80217c:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802182:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802185:	c1 e2 02             	shl    $0x2,%edx
+  802188:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  80218e:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  802195:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802198:	8b 55 18             	mov    0x18(%ebp),%edx
+  80219b:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80219e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021a1:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8021a4:	83 ec 08             	sub    $0x8,%esp
+  8021a7:	50                   	push   %eax
+  8021a8:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8021ad:	39 c3                	cmp    %eax,%ebx
+  8021af:	0f 47 d8             	cmova  %eax,%ebx
+  8021b2:	53                   	push   %ebx
+  8021b3:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8021b6:	89 f2                	mov    %esi,%edx
+  8021b8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021bd:	e8 1e f5 ff ff       	call   8016e0 <fsring_post>
+  8021c2:	83 c4 10             	add    $0x10,%esp
+}
+  8021c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021c8:	5b                   	pop    %ebx
+  8021c9:	5e                   	pop    %esi
+  8021ca:	5d                   	pop    %ebp
+  8021cb:	c3                   	ret
+		return -E_INVAL;
+  8021cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021d1:	eb f2                	jmp    8021c5 <fsring_read+0x7a>
+
+008021d3 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8021d3:	55                   	push   %ebp
+  8021d4:	89 e5                	mov    %esp,%ebp
+  8021d6:	56                   	push   %esi
+  8021d7:	53                   	push   %ebx
+  8021d8:	83 ec 10             	sub    $0x10,%esp
+  8021db:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8021de:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e4:	e8 b5 f8 ff ff       	call   801a9e <fsring_slot>
+  8021e9:	89 c3                	mov    %eax,%ebx
+  8021eb:	85 c0                	test   %eax,%eax
+  8021ed:	78 77                	js     802266 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8021ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021f2:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8021f6:	74 77                	je     80226f <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8021f8:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8021fd:	39 c6                	cmp    %eax,%esi
+  8021ff:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802202:	83 ec 04             	sub    $0x4,%esp
+  802205:	56                   	push   %esi
+  802206:	ff 75 0c             	push   0xc(%ebp)
+  802209:	89 d8                	mov    %ebx,%eax
+  80220b:	c1 e0 0c             	shl    $0xc,%eax
+  80220e:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802214:	50                   	push   %eax
+  802215:	e8 d2 e6 ff ff       	call   8008ec <memmove>
+	fsring_busy |= 1 << slot;
+  80221a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80221f:	89 d9                	mov    %ebx,%ecx
+  802221:	d3 e0                	shl    %cl,%eax
+  802223:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802229:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80222c:	c1 e0 02             	shl    $0x2,%eax
+  80222f:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  802235:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  80223c:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80223f:	8b 45 18             	mov    0x18(%ebp),%eax
+  802242:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  802245:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  80224c:	83 c4 08             	add    $0x8,%esp
+  80224f:	53                   	push   %ebx
+  802250:	56                   	push   %esi
+  802251:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802254:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802257:	b8 04 00 00 00       	mov    $0x4,%eax
+  80225c:	e8 7f f4 ff ff       	call   8016e0 <fsring_post>
+  802261:	89 c3                	mov    %eax,%ebx
+  802263:	83 c4 10             	add    $0x10,%esp
+}
+  802266:	89 d8                	mov    %ebx,%eax
+  802268:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80226b:	5b                   	pop    %ebx
+  80226c:	5e                   	pop    %esi
+  80226d:	5d                   	pop    %ebp
+  80226e:	c3                   	ret
+		return -E_INVAL;
+  80226f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802274:	eb f0                	jmp    802266 <fsring_write+0x93>
+
+00802276 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802276:	55                   	push   %ebp
+  802277:	89 e5                	mov    %esp,%ebp
+  802279:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80227c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80227f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802282:	e8 17 f8 ff ff       	call   801a9e <fsring_slot>
+  802287:	85 c0                	test   %eax,%eax
+  802289:	78 4c                	js     8022d7 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  80228b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802290:	89 c1                	mov    %eax,%ecx
+  802292:	d3 e2                	shl    %cl,%edx
+  802294:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  80229a:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80229d:	c1 e2 02             	shl    $0x2,%edx
+  8022a0:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8022a6:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  8022ad:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8022b0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8022b3:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8022b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022b9:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  8022bc:	83 ec 08             	sub    $0x8,%esp
+  8022bf:	50                   	push   %eax
+  8022c0:	6a 00                	push   $0x0
+  8022c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022c7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022ca:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022cf:	e8 0c f4 ff ff       	call   8016e0 <fsring_post>
+  8022d4:	83 c4 10             	add    $0x10,%esp
+}
+  8022d7:	c9                   	leave
+  8022d8:	c3                   	ret
+
+008022d9 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8022d9:	55                   	push   %ebp
+  8022da:	89 e5                	mov    %esp,%ebp
+  8022dc:	57                   	push   %edi
+  8022dd:	56                   	push   %esi
+  8022de:	53                   	push   %ebx
+  8022df:	83 ec 1c             	sub    $0x1c,%esp
+  8022e2:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8022e6:	a1 00 50 80 00       	mov    0x805000,%eax
+  8022eb:	8b 40 48             	mov    0x48(%eax),%eax
+  8022ee:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  8022f4:	74 12                	je     802308 <fsring_reap+0x2f>
+		return 0;
+  8022f6:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8022fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022fe:	5b                   	pop    %ebx
+  8022ff:	5e                   	pop    %esi
+  802300:	5f                   	pop    %edi
+  802301:	5d                   	pop    %ebp
+  802302:	c3                   	ret
+		sys_yield();
+  802303:	e8 4b e8 ff ff       	call   800b53 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802308:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  80230e:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802313:	39 c2                	cmp    %eax,%edx
+  802315:	75 18                	jne    80232f <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802317:	84 db                	test   %bl,%bl
+  802319:	0f 84 21 01 00 00    	je     802440 <fsring_reap+0x167>
+  80231f:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  802326:	75 db                	jne    802303 <fsring_reap+0x2a>
+			return 0;
+  802328:	b8 00 00 00 00       	mov    $0x0,%eax
+  80232d:	eb cc                	jmp    8022fb <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  80232f:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802334:	83 e0 0f             	and    $0xf,%eax
+  802337:	83 c0 2a             	add    $0x2a,%eax
+  80233a:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802341:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802348:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80234d:	83 c0 01             	add    $0x1,%eax
+  802350:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802355:	83 fb 0f             	cmp    $0xf,%ebx
+  802358:	77 5b                	ja     8023b5 <fsring_reap+0xdc>
+  80235a:	be 01 00 00 00       	mov    $0x1,%esi
+  80235f:	89 d9                	mov    %ebx,%ecx
+  802361:	d3 e6                	shl    %cl,%esi
+  802363:	89 f0                	mov    %esi,%eax
+  802365:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  80236b:	74 48                	je     8023b5 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  80236d:	89 d8                	mov    %ebx,%eax
+  80236f:	c1 e0 0c             	shl    $0xc,%eax
+  802372:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802378:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  80237b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80237e:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  802385:	83 f8 03             	cmp    $0x3,%eax
+  802388:	74 40                	je     8023ca <fsring_reap+0xf1>
+  80238a:	83 f8 05             	cmp    $0x5,%eax
+  80238d:	74 64                	je     8023f3 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  80238f:	f7 d6                	not    %esi
+  802391:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802397:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80239a:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  8023a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a4:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8023a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023a9:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8023ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023b0:	e9 46 ff ff ff       	jmp    8022fb <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8023b5:	53                   	push   %ebx
+  8023b6:	68 64 3c 80 00       	push   $0x803c64
+  8023bb:	68 8f 02 00 00       	push   $0x28f
+  8023c0:	68 3c 3c 80 00       	push   $0x803c3c
+  8023c5:	e8 fd 0b 00 00       	call   802fc7 <_panic>
+		if (cqe.cqe_result > 0)
+  8023ca:	85 ff                	test   %edi,%edi
+  8023cc:	7e c1                	jle    80238f <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8023ce:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8023d1:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8023d6:	39 c7                	cmp    %eax,%edi
+  8023d8:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8023db:	50                   	push   %eax
+  8023dc:	ff 75 e4             	push   -0x1c(%ebp)
+  8023df:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8023e2:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  8023e9:	e8 fe e4 ff ff       	call   8008ec <memmove>
+  8023ee:	83 c4 10             	add    $0x10,%esp
+  8023f1:	eb 9c                	jmp    80238f <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8023f3:	85 ff                	test   %edi,%edi
+  8023f5:	75 98                	jne    80238f <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  8023f7:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8023fa:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802401:	83 ec 08             	sub    $0x8,%esp
+  802404:	ff 75 e4             	push   -0x1c(%ebp)
+  802407:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80240a:	51                   	push   %ecx
+  80240b:	e8 56 e3 ff ff       	call   800766 <strcpy>
+			st->st_size = ret->ret_size;
+  802410:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802413:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802419:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80241c:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802422:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802428:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  80242e:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  802435:	40 80 00 
+  802438:	83 c4 10             	add    $0x10,%esp
+  80243b:	e9 4f ff ff ff       	jmp    80238f <fsring_reap+0xb6>
+			return 0;
+  802440:	b8 00 00 00 00       	mov    $0x0,%eax
+  802445:	e9 b1 fe ff ff       	jmp    8022fb <fsring_reap+0x22>
+
+0080244a <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  80244a:	55                   	push   %ebp
+  80244b:	89 e5                	mov    %esp,%ebp
+  80244d:	57                   	push   %edi
+  80244e:	56                   	push   %esi
+  80244f:	53                   	push   %ebx
+  802450:	83 ec 28             	sub    $0x28,%esp
+  802453:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802456:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802459:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80245c:	53                   	push   %ebx
+  80245d:	e8 c9 e2 ff ff       	call   80072b <strlen>
+  802462:	83 c4 10             	add    $0x10,%esp
+  802465:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80246a:	0f 8f 02 01 00 00    	jg     802572 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802470:	83 ec 08             	sub    $0x8,%esp
+  802473:	53                   	push   %ebx
+  802474:	68 00 60 80 00       	push   $0x806000
+  802479:	e8 e8 e2 ff ff       	call   800766 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  80247e:	83 c4 10             	add    $0x10,%esp
+  802481:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802487:	76 69                	jbe    8024f2 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802489:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80248c:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802492:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802497:	29 d1                	sub    %edx,%ecx
+  802499:	39 f9                	cmp    %edi,%ecx
+  80249b:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80249e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024a1:	89 f9                	mov    %edi,%ecx
+  8024a3:	01 c1                	add    %eax,%ecx
+  8024a5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8024a8:	eb 0f                	jmp    8024b9 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  8024aa:	0f b6 10             	movzbl (%eax),%edx
+  8024ad:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8024af:	05 00 10 00 00       	add    $0x1000,%eax
+  8024b4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8024b9:	39 c8                	cmp    %ecx,%eax
+  8024bb:	72 ed                	jb     8024aa <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  8024bd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024c0:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  8024c6:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8024cc:	83 ec 0c             	sub    $0xc,%esp
+  8024cf:	6a 07                	push   $0x7
+  8024d1:	89 f9                	mov    %edi,%ecx
+  8024d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024d6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8024db:	e8 3f f1 ff ff       	call   80161f <fsipc_pages>
+  8024e0:	89 c7                	mov    %eax,%edi
+  8024e2:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8024e5:	85 f6                	test   %esi,%esi
+  8024e7:	74 7f                	je     802568 <file_slurp+0x11e>
+  8024e9:	8d 43 01             	lea    0x1(%ebx),%eax
+  8024ec:	85 ff                	test   %edi,%edi
+  8024ee:	79 3c                	jns    80252c <file_slurp+0xe2>
+  8024f0:	eb 76                	jmp    802568 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8024f2:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8024f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024fd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802502:	e8 ba f2 ff ff       	call   8017c1 <fsipc>
+  802507:	89 c7                	mov    %eax,%edi
+  802509:	85 c0                	test   %eax,%eax
+  80250b:	7e d8                	jle    8024e5 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  80250d:	83 ec 04             	sub    $0x4,%esp
+  802510:	50                   	push   %eax
+  802511:	68 08 60 80 00       	push   $0x806008
+  802516:	ff 75 0c             	push   0xc(%ebp)
+  802519:	e8 ce e3 ff ff       	call   8008ec <memmove>
+  80251e:	83 c4 10             	add    $0x10,%esp
+  802521:	eb c2                	jmp    8024e5 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802523:	80 fa 2f             	cmp    $0x2f,%dl
+  802526:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802529:	83 c0 01             	add    $0x1,%eax
+  80252c:	89 c1                	mov    %eax,%ecx
+  80252e:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802532:	84 d2                	test   %dl,%dl
+  802534:	75 ed                	jne    802523 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802536:	83 ec 04             	sub    $0x4,%esp
+  802539:	68 80 00 00 00       	push   $0x80
+  80253e:	53                   	push   %ebx
+  80253f:	56                   	push   %esi
+  802540:	e8 97 e2 ff ff       	call   8007dc <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802545:	a1 00 60 80 00       	mov    0x806000,%eax
+  80254a:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802550:	a1 04 60 80 00       	mov    0x806004,%eax
+  802555:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  80255b:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  802562:	40 80 00 
+  802565:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802568:	89 f8                	mov    %edi,%eax
+  80256a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80256d:	5b                   	pop    %ebx
+  80256e:	5e                   	pop    %esi
+  80256f:	5f                   	pop    %edi
+  802570:	5d                   	pop    %ebp
+  802571:	c3                   	ret
+		return -E_BAD_PATH;
+  802572:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802577:	eb ef                	jmp    802568 <file_slurp+0x11e>
+
+00802579 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802579:	55                   	push   %ebp
+  80257a:	89 e5                	mov    %esp,%ebp
+  80257c:	53                   	push   %ebx
+  80257d:	83 ec 10             	sub    $0x10,%esp
+  802580:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802583:	53                   	push   %ebx
+  802584:	e8 a2 e1 ff ff       	call   80072b <strlen>
+  802589:	83 c4 10             	add    $0x10,%esp
+  80258c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802591:	7f 25                	jg     8025b8 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802593:	83 ec 08             	sub    $0x8,%esp
+  802596:	53                   	push   %ebx
+  802597:	68 00 60 80 00       	push   $0x806000
+  80259c:	e8 c5 e1 ff ff       	call   800766 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8025a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8025ab:	e8 11 f2 ff ff       	call   8017c1 <fsipc>
+  8025b0:	83 c4 10             	add    $0x10,%esp
+}
+  8025b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025b6:	c9                   	leave
+  8025b7:	c3                   	ret
+		return -E_BAD_PATH;
+  8025b8:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8025bd:	eb f4                	jmp    8025b3 <remove+0x3a>
+
+008025bf <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8025bf:	55                   	push   %ebp
+  8025c0:	89 e5                	mov    %esp,%ebp
+  8025c2:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8025c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ca:	b8 08 00 00 00       	mov    $0x8,%eax
+  8025cf:	e8 ed f1 ff ff       	call   8017c1 <fsipc>
+}
+  8025d4:	c9                   	leave
+  8025d5:	c3                   	ret
+
+008025d6 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  8025d6:	55                   	push   %ebp
+  8025d7:	89 e5                	mov    %esp,%ebp
+  8025d9:	57                   	push   %edi
+  8025da:	56                   	push   %esi
+  8025db:	53                   	push   %ebx
+  8025dc:	83 ec 18             	sub    $0x18,%esp
+  8025df:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025e2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8025e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8025e8:	57                   	push   %edi
+  8025e9:	e8 3d e1 ff ff       	call   80072b <strlen>
+  8025ee:	83 c4 10             	add    $0x10,%esp
+  8025f1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025f6:	7f 4c                	jg     802644 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  8025f8:	83 ec 08             	sub    $0x8,%esp
+  8025fb:	57                   	push   %edi
+  8025fc:	68 00 60 80 00       	push   $0x806000
+  802601:	e8 60 e1 ff ff       	call   800766 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802606:	ba 00 00 00 00       	mov    $0x0,%edx
+  80260b:	b8 10 00 00 00       	mov    $0x10,%eax
+  802610:	e8 ac f1 ff ff       	call   8017c1 <fsipc>
+  802615:	83 c4 10             	add    $0x10,%esp
+  802618:	85 c0                	test   %eax,%eax
+  80261a:	78 20                	js     80263c <defrag+0x66>
+		return r;
+	if (before)
+  80261c:	85 f6                	test   %esi,%esi
+  80261e:	74 07                	je     802627 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802620:	a1 00 60 80 00       	mov    0x806000,%eax
+  802625:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802627:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  80262c:	85 db                	test   %ebx,%ebx
+  80262e:	74 0c                	je     80263c <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802630:	a1 04 60 80 00       	mov    0x806004,%eax
+  802635:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802637:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80263c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80263f:	5b                   	pop    %ebx
+  802640:	5e                   	pop    %esi
+  802641:	5f                   	pop    %edi
+  802642:	5d                   	pop    %ebp
+  802643:	c3                   	ret
+		return -E_BAD_PATH;
+  802644:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802649:	eb f1                	jmp    80263c <defrag+0x66>
+
+0080264b <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  80264b:	55                   	push   %ebp
+  80264c:	89 e5                	mov    %esp,%ebp
+  80264e:	53                   	push   %ebx
+  80264f:	83 ec 04             	sub    $0x4,%esp
+  802652:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802655:	ba 00 00 00 00       	mov    $0x0,%edx
+  80265a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80265f:	e8 5d f1 ff ff       	call   8017c1 <fsipc>
+  802664:	85 c0                	test   %eax,%eax
+  802666:	78 34                	js     80269c <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802668:	a1 00 60 80 00       	mov    0x806000,%eax
+  80266d:	89 03                	mov    %eax,(%ebx)
+  80266f:	a1 04 60 80 00       	mov    0x806004,%eax
+  802674:	89 43 04             	mov    %eax,0x4(%ebx)
+  802677:	a1 08 60 80 00       	mov    0x806008,%eax
+  80267c:	89 43 08             	mov    %eax,0x8(%ebx)
+  80267f:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  802684:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802687:	a1 10 60 80 00       	mov    0x806010,%eax
+  80268c:	89 43 10             	mov    %eax,0x10(%ebx)
+  80268f:	a1 14 60 80 00       	mov    0x806014,%eax
+  802694:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802697:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80269c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80269f:	c9                   	leave
+  8026a0:	c3                   	ret
+
+008026a1 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026a1:	55                   	push   %ebp
+  8026a2:	89 e5                	mov    %esp,%ebp
+  8026a4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8026a7:	68 7d 3c 80 00       	push   $0x803c7d
+  8026ac:	ff 75 0c             	push   0xc(%ebp)
+  8026af:	e8 b2 e0 ff ff       	call   800766 <strcpy>
+	return 0;
+}
+  8026b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b9:	c9                   	leave
+  8026ba:	c3                   	ret
+
+008026bb <devsock_close>:
+{
+  8026bb:	55                   	push   %ebp
+  8026bc:	89 e5                	mov    %esp,%ebp
+  8026be:	53                   	push   %ebx
+  8026bf:	83 ec 10             	sub    $0x10,%esp
+  8026c2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8026c5:	53                   	push   %ebx
+  8026c6:	e8 3a 0e 00 00       	call   803505 <pageref>
+  8026cb:	89 c2                	mov    %eax,%edx
+  8026cd:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8026d0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8026d5:	83 fa 01             	cmp    $0x1,%edx
+  8026d8:	74 05                	je     8026df <devsock_close+0x24>
+}
+  8026da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026dd:	c9                   	leave
+  8026de:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8026df:	83 ec 0c             	sub    $0xc,%esp
+  8026e2:	ff 73 0c             	push   0xc(%ebx)
+  8026e5:	e8 b7 02 00 00       	call   8029a1 <nsipc_close>
+  8026ea:	83 c4 10             	add    $0x10,%esp
+  8026ed:	eb eb                	jmp    8026da <devsock_close+0x1f>
+
+008026ef <devsock_write>:
+{
+  8026ef:	55                   	push   %ebp
+  8026f0:	89 e5                	mov    %esp,%ebp
+  8026f2:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8026f5:	6a 00                	push   $0x0
+  8026f7:	ff 75 10             	push   0x10(%ebp)
+  8026fa:	ff 75 0c             	push   0xc(%ebp)
+  8026fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802700:	ff 70 0c             	push   0xc(%eax)
+  802703:	e8 79 03 00 00       	call   802a81 <nsipc_send>
+}
+  802708:	c9                   	leave
+  802709:	c3                   	ret
+
+0080270a <devsock_read>:
+{
+  80270a:	55                   	push   %ebp
+  80270b:	89 e5                	mov    %esp,%ebp
+  80270d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802710:	6a 00                	push   $0x0
+  802712:	ff 75 10             	push   0x10(%ebp)
+  802715:	ff 75 0c             	push   0xc(%ebp)
+  802718:	8b 45 08             	mov    0x8(%ebp),%eax
+  80271b:	ff 70 0c             	push   0xc(%eax)
+  80271e:	e8 ef 02 00 00       	call   802a12 <nsipc_recv>
+}
+  802723:	c9                   	leave
+  802724:	c3                   	ret
+
+00802725 <fd2sockid>:
+{
+  802725:	55                   	push   %ebp
+  802726:	89 e5                	mov    %esp,%ebp
+  802728:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80272b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80272e:	52                   	push   %edx
+  80272f:	50                   	push   %eax
+  802730:	e8 54 e9 ff ff       	call   801089 <fd_lookup>
+  802735:	83 c4 10             	add    $0x10,%esp
+  802738:	85 c0                	test   %eax,%eax
+  80273a:	78 10                	js     80274c <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80273c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80273f:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  802745:	39 08                	cmp    %ecx,(%eax)
+  802747:	75 05                	jne    80274e <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802749:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80274c:	c9                   	leave
+  80274d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80274e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802753:	eb f7                	jmp    80274c <fd2sockid+0x27>
+
+00802755 <alloc_sockfd>:
+{
+  802755:	55                   	push   %ebp
+  802756:	89 e5                	mov    %esp,%ebp
+  802758:	56                   	push   %esi
+  802759:	53                   	push   %ebx
+  80275a:	83 ec 1c             	sub    $0x1c,%esp
+  80275d:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80275f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802762:	50                   	push   %eax
+  802763:	e8 cb e8 ff ff       	call   801033 <fd_alloc>
+  802768:	89 c3                	mov    %eax,%ebx
+  80276a:	83 c4 10             	add    $0x10,%esp
+  80276d:	85 c0                	test   %eax,%eax
+  80276f:	78 43                	js     8027b4 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802771:	83 ec 04             	sub    $0x4,%esp
+  802774:	68 07 04 00 00       	push   $0x407
+  802779:	ff 75 f4             	push   -0xc(%ebp)
+  80277c:	6a 00                	push   $0x0
+  80277e:	e8 ef e3 ff ff       	call   800b72 <sys_page_alloc>
+  802783:	89 c3                	mov    %eax,%ebx
+  802785:	83 c4 10             	add    $0x10,%esp
+  802788:	85 c0                	test   %eax,%eax
+  80278a:	78 28                	js     8027b4 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80278c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80278f:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802795:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802797:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80279a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8027a1:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8027a4:	83 ec 0c             	sub    $0xc,%esp
+  8027a7:	50                   	push   %eax
+  8027a8:	e8 5f e8 ff ff       	call   80100c <fd2num>
+  8027ad:	89 c3                	mov    %eax,%ebx
+  8027af:	83 c4 10             	add    $0x10,%esp
+  8027b2:	eb 0c                	jmp    8027c0 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8027b4:	83 ec 0c             	sub    $0xc,%esp
+  8027b7:	56                   	push   %esi
+  8027b8:	e8 e4 01 00 00       	call   8029a1 <nsipc_close>
+		return r;
+  8027bd:	83 c4 10             	add    $0x10,%esp
+}
+  8027c0:	89 d8                	mov    %ebx,%eax
+  8027c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027c5:	5b                   	pop    %ebx
+  8027c6:	5e                   	pop    %esi
+  8027c7:	5d                   	pop    %ebp
+  8027c8:	c3                   	ret
+
+008027c9 <accept>:
+{
+  8027c9:	55                   	push   %ebp
+  8027ca:	89 e5                	mov    %esp,%ebp
+  8027cc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027d2:	e8 4e ff ff ff       	call   802725 <fd2sockid>
+  8027d7:	85 c0                	test   %eax,%eax
+  8027d9:	78 1b                	js     8027f6 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8027db:	83 ec 04             	sub    $0x4,%esp
+  8027de:	ff 75 10             	push   0x10(%ebp)
+  8027e1:	ff 75 0c             	push   0xc(%ebp)
+  8027e4:	50                   	push   %eax
+  8027e5:	e8 0e 01 00 00       	call   8028f8 <nsipc_accept>
+  8027ea:	83 c4 10             	add    $0x10,%esp
+  8027ed:	85 c0                	test   %eax,%eax
+  8027ef:	78 05                	js     8027f6 <accept+0x2d>
+	return alloc_sockfd(r);
+  8027f1:	e8 5f ff ff ff       	call   802755 <alloc_sockfd>
+}
+  8027f6:	c9                   	leave
+  8027f7:	c3                   	ret
+
+008027f8 <bind>:
+{
+  8027f8:	55                   	push   %ebp
+  8027f9:	89 e5                	mov    %esp,%ebp
+  8027fb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802801:	e8 1f ff ff ff       	call   802725 <fd2sockid>
+  802806:	85 c0                	test   %eax,%eax
+  802808:	78 12                	js     80281c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80280a:	83 ec 04             	sub    $0x4,%esp
+  80280d:	ff 75 10             	push   0x10(%ebp)
+  802810:	ff 75 0c             	push   0xc(%ebp)
+  802813:	50                   	push   %eax
+  802814:	e8 31 01 00 00       	call   80294a <nsipc_bind>
+  802819:	83 c4 10             	add    $0x10,%esp
+}
+  80281c:	c9                   	leave
+  80281d:	c3                   	ret
+
+0080281e <shutdown>:
+{
+  80281e:	55                   	push   %ebp
+  80281f:	89 e5                	mov    %esp,%ebp
+  802821:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802824:	8b 45 08             	mov    0x8(%ebp),%eax
+  802827:	e8 f9 fe ff ff       	call   802725 <fd2sockid>
+  80282c:	85 c0                	test   %eax,%eax
+  80282e:	78 0f                	js     80283f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802830:	83 ec 08             	sub    $0x8,%esp
+  802833:	ff 75 0c             	push   0xc(%ebp)
+  802836:	50                   	push   %eax
+  802837:	e8 43 01 00 00       	call   80297f <nsipc_shutdown>
+  80283c:	83 c4 10             	add    $0x10,%esp
+}
+  80283f:	c9                   	leave
+  802840:	c3                   	ret
+
+00802841 <connect>:
+{
+  802841:	55                   	push   %ebp
+  802842:	89 e5                	mov    %esp,%ebp
+  802844:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802847:	8b 45 08             	mov    0x8(%ebp),%eax
+  80284a:	e8 d6 fe ff ff       	call   802725 <fd2sockid>
+  80284f:	85 c0                	test   %eax,%eax
+  802851:	78 12                	js     802865 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802853:	83 ec 04             	sub    $0x4,%esp
+  802856:	ff 75 10             	push   0x10(%ebp)
+  802859:	ff 75 0c             	push   0xc(%ebp)
+  80285c:	50                   	push   %eax
+  80285d:	e8 59 01 00 00       	call   8029bb <nsipc_connect>
+  802862:	83 c4 10             	add    $0x10,%esp
+}
+  802865:	c9                   	leave
+  802866:	c3                   	ret
+
+00802867 <listen>:
+{
+  802867:	55                   	push   %ebp
+  802868:	89 e5                	mov    %esp,%ebp
+  80286a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80286d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802870:	e8 b0 fe ff ff       	call   802725 <fd2sockid>
+  802875:	85 c0                	test   %eax,%eax
+  802877:	78 0f                	js     802888 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802879:	83 ec 08             	sub    $0x8,%esp
+  80287c:	ff 75 0c             	push   0xc(%ebp)
+  80287f:	50                   	push   %eax
+  802880:	e8 6b 01 00 00       	call   8029f0 <nsipc_listen>
+  802885:	83 c4 10             	add    $0x10,%esp
+}
+  802888:	c9                   	leave
+  802889:	c3                   	ret
+
+0080288a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80288a:	55                   	push   %ebp
+  80288b:	89 e5                	mov    %esp,%ebp
+  80288d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802890:	ff 75 10             	push   0x10(%ebp)
+  802893:	ff 75 0c             	push   0xc(%ebp)
+  802896:	ff 75 08             	push   0x8(%ebp)
+  802899:	e8 41 02 00 00       	call   802adf <nsipc_socket>
+  80289e:	83 c4 10             	add    $0x10,%esp
+  8028a1:	85 c0                	test   %eax,%eax
+  8028a3:	78 05                	js     8028aa <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8028a5:	e8 ab fe ff ff       	call   802755 <alloc_sockfd>
+}
+  8028aa:	c9                   	leave
+  8028ab:	c3                   	ret
+
+008028ac <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8028ac:	55                   	push   %ebp
+  8028ad:	89 e5                	mov    %esp,%ebp
+  8028af:	53                   	push   %ebx
+  8028b0:	83 ec 04             	sub    $0x4,%esp
+  8028b3:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8028b5:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8028bc:	74 26                	je     8028e4 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8028be:	6a 07                	push   $0x7
+  8028c0:	68 00 80 80 00       	push   $0x808000
+  8028c5:	53                   	push   %ebx
+  8028c6:	ff 35 00 90 80 00    	push   0x809000
+  8028cc:	e8 bc 0a 00 00       	call   80338d <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8028d1:	83 c4 0c             	add    $0xc,%esp
+  8028d4:	6a 00                	push   $0x0
+  8028d6:	6a 00                	push   $0x0
+  8028d8:	6a 00                	push   $0x0
+  8028da:	e8 43 0a 00 00       	call   803322 <ipc_recv>
+}
+  8028df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028e2:	c9                   	leave
+  8028e3:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8028e4:	83 ec 0c             	sub    $0xc,%esp
+  8028e7:	6a 02                	push   $0x2
+  8028e9:	e8 d8 0b 00 00       	call   8034c6 <ipc_find_env>
+  8028ee:	a3 00 90 80 00       	mov    %eax,0x809000
+  8028f3:	83 c4 10             	add    $0x10,%esp
+  8028f6:	eb c6                	jmp    8028be <nsipc+0x12>
+
+008028f8 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8028f8:	55                   	push   %ebp
+  8028f9:	89 e5                	mov    %esp,%ebp
+  8028fb:	56                   	push   %esi
+  8028fc:	53                   	push   %ebx
+  8028fd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802900:	8b 45 08             	mov    0x8(%ebp),%eax
+  802903:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802908:	8b 06                	mov    (%esi),%eax
+  80290a:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80290f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802914:	e8 93 ff ff ff       	call   8028ac <nsipc>
+  802919:	89 c3                	mov    %eax,%ebx
+  80291b:	85 c0                	test   %eax,%eax
+  80291d:	79 09                	jns    802928 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80291f:	89 d8                	mov    %ebx,%eax
+  802921:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802924:	5b                   	pop    %ebx
+  802925:	5e                   	pop    %esi
+  802926:	5d                   	pop    %ebp
+  802927:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802928:	83 ec 04             	sub    $0x4,%esp
+  80292b:	ff 35 10 80 80 00    	push   0x808010
+  802931:	68 00 80 80 00       	push   $0x808000
+  802936:	ff 75 0c             	push   0xc(%ebp)
+  802939:	e8 ae df ff ff       	call   8008ec <memmove>
+		*addrlen = ret->ret_addrlen;
+  80293e:	a1 10 80 80 00       	mov    0x808010,%eax
+  802943:	89 06                	mov    %eax,(%esi)
+  802945:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802948:	eb d5                	jmp    80291f <nsipc_accept+0x27>
+
+0080294a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80294a:	55                   	push   %ebp
+  80294b:	89 e5                	mov    %esp,%ebp
+  80294d:	53                   	push   %ebx
+  80294e:	83 ec 08             	sub    $0x8,%esp
+  802951:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802954:	8b 45 08             	mov    0x8(%ebp),%eax
+  802957:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80295c:	53                   	push   %ebx
+  80295d:	ff 75 0c             	push   0xc(%ebp)
+  802960:	68 04 80 80 00       	push   $0x808004
+  802965:	e8 82 df ff ff       	call   8008ec <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80296a:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802970:	b8 02 00 00 00       	mov    $0x2,%eax
+  802975:	e8 32 ff ff ff       	call   8028ac <nsipc>
+}
+  80297a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80297d:	c9                   	leave
+  80297e:	c3                   	ret
+
+0080297f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80297f:	55                   	push   %ebp
+  802980:	89 e5                	mov    %esp,%ebp
+  802982:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802985:	8b 45 08             	mov    0x8(%ebp),%eax
+  802988:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  80298d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802990:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802995:	b8 03 00 00 00       	mov    $0x3,%eax
+  80299a:	e8 0d ff ff ff       	call   8028ac <nsipc>
+}
+  80299f:	c9                   	leave
+  8029a0:	c3                   	ret
+
+008029a1 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8029a1:	55                   	push   %ebp
+  8029a2:	89 e5                	mov    %esp,%ebp
+  8029a4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8029a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029aa:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8029af:	b8 04 00 00 00       	mov    $0x4,%eax
+  8029b4:	e8 f3 fe ff ff       	call   8028ac <nsipc>
+}
+  8029b9:	c9                   	leave
+  8029ba:	c3                   	ret
+
+008029bb <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8029bb:	55                   	push   %ebp
+  8029bc:	89 e5                	mov    %esp,%ebp
+  8029be:	53                   	push   %ebx
+  8029bf:	83 ec 08             	sub    $0x8,%esp
+  8029c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8029c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c8:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8029cd:	53                   	push   %ebx
+  8029ce:	ff 75 0c             	push   0xc(%ebp)
+  8029d1:	68 04 80 80 00       	push   $0x808004
+  8029d6:	e8 11 df ff ff       	call   8008ec <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8029db:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8029e1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8029e6:	e8 c1 fe ff ff       	call   8028ac <nsipc>
+}
+  8029eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029ee:	c9                   	leave
+  8029ef:	c3                   	ret
+
+008029f0 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8029f0:	55                   	push   %ebp
+  8029f1:	89 e5                	mov    %esp,%ebp
+  8029f3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8029f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029f9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8029fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a01:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802a06:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a0b:	e8 9c fe ff ff       	call   8028ac <nsipc>
+}
+  802a10:	c9                   	leave
+  802a11:	c3                   	ret
+
+00802a12 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802a12:	55                   	push   %ebp
+  802a13:	89 e5                	mov    %esp,%ebp
+  802a15:	56                   	push   %esi
+  802a16:	53                   	push   %ebx
+  802a17:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802a1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a1d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802a22:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802a28:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a2b:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802a30:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a35:	e8 72 fe ff ff       	call   8028ac <nsipc>
+  802a3a:	89 c3                	mov    %eax,%ebx
+  802a3c:	85 c0                	test   %eax,%eax
+  802a3e:	78 22                	js     802a62 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802a40:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802a45:	39 c6                	cmp    %eax,%esi
+  802a47:	0f 4e c6             	cmovle %esi,%eax
+  802a4a:	39 c3                	cmp    %eax,%ebx
+  802a4c:	7f 1d                	jg     802a6b <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802a4e:	83 ec 04             	sub    $0x4,%esp
+  802a51:	53                   	push   %ebx
+  802a52:	68 00 80 80 00       	push   $0x808000
+  802a57:	ff 75 0c             	push   0xc(%ebp)
+  802a5a:	e8 8d de ff ff       	call   8008ec <memmove>
+  802a5f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802a62:	89 d8                	mov    %ebx,%eax
+  802a64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a67:	5b                   	pop    %ebx
+  802a68:	5e                   	pop    %esi
+  802a69:	5d                   	pop    %ebp
+  802a6a:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802a6b:	68 89 3c 80 00       	push   $0x803c89
+  802a70:	68 6c 3b 80 00       	push   $0x803b6c
+  802a75:	6a 62                	push   $0x62
+  802a77:	68 9e 3c 80 00       	push   $0x803c9e
+  802a7c:	e8 46 05 00 00       	call   802fc7 <_panic>
+
+00802a81 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802a81:	55                   	push   %ebp
+  802a82:	89 e5                	mov    %esp,%ebp
+  802a84:	53                   	push   %ebx
+  802a85:	83 ec 04             	sub    $0x4,%esp
+  802a88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802a8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8e:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802a93:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802a99:	7f 2e                	jg     802ac9 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802a9b:	83 ec 04             	sub    $0x4,%esp
+  802a9e:	53                   	push   %ebx
+  802a9f:	ff 75 0c             	push   0xc(%ebp)
+  802aa2:	68 0c 80 80 00       	push   $0x80800c
+  802aa7:	e8 40 de ff ff       	call   8008ec <memmove>
+	nsipcbuf.send.req_size = size;
+  802aac:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802ab2:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ab5:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802aba:	b8 08 00 00 00       	mov    $0x8,%eax
+  802abf:	e8 e8 fd ff ff       	call   8028ac <nsipc>
+}
+  802ac4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ac7:	c9                   	leave
+  802ac8:	c3                   	ret
+	assert(size < 1600);
+  802ac9:	68 aa 3c 80 00       	push   $0x803caa
+  802ace:	68 6c 3b 80 00       	push   $0x803b6c
+  802ad3:	6a 6d                	push   $0x6d
+  802ad5:	68 9e 3c 80 00       	push   $0x803c9e
+  802ada:	e8 e8 04 00 00       	call   802fc7 <_panic>
+
+00802adf <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802adf:	55                   	push   %ebp
+  802ae0:	89 e5                	mov    %esp,%ebp
+  802ae2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802ae5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae8:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802aed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802af0:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802af5:	8b 45 10             	mov    0x10(%ebp),%eax
+  802af8:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802afd:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b02:	e8 a5 fd ff ff       	call   8028ac <nsipc>
+}
+  802b07:	c9                   	leave
+  802b08:	c3                   	ret
+
+00802b09 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b09:	55                   	push   %ebp
+  802b0a:	89 e5                	mov    %esp,%ebp
+  802b0c:	56                   	push   %esi
+  802b0d:	53                   	push   %ebx
+  802b0e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802b11:	83 ec 0c             	sub    $0xc,%esp
+  802b14:	ff 75 08             	push   0x8(%ebp)
+  802b17:	e8 00 e5 ff ff       	call   80101c <fd2data>
+  802b1c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802b1e:	83 c4 08             	add    $0x8,%esp
+  802b21:	68 b6 3c 80 00       	push   $0x803cb6
+  802b26:	53                   	push   %ebx
+  802b27:	e8 3a dc ff ff       	call   800766 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802b2c:	8b 46 04             	mov    0x4(%esi),%eax
+  802b2f:	2b 06                	sub    (%esi),%eax
+  802b31:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802b37:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802b3e:	00 00 00 
+	stat->st_dev = &devpipe;
+  802b41:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802b48:	40 80 00 
+	return 0;
+}
+  802b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b53:	5b                   	pop    %ebx
+  802b54:	5e                   	pop    %esi
+  802b55:	5d                   	pop    %ebp
+  802b56:	c3                   	ret
+
+00802b57 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802b57:	55                   	push   %ebp
+  802b58:	89 e5                	mov    %esp,%ebp
+  802b5a:	53                   	push   %ebx
+  802b5b:	83 ec 0c             	sub    $0xc,%esp
+  802b5e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802b61:	53                   	push   %ebx
+  802b62:	6a 00                	push   $0x0
+  802b64:	e8 96 e0 ff ff       	call   800bff <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802b69:	89 1c 24             	mov    %ebx,(%esp)
+  802b6c:	e8 ab e4 ff ff       	call   80101c <fd2data>
+  802b71:	83 c4 08             	add    $0x8,%esp
+  802b74:	50                   	push   %eax
+  802b75:	6a 00                	push   $0x0
+  802b77:	e8 83 e0 ff ff       	call   800bff <sys_page_unmap>
+}
+  802b7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b7f:	c9                   	leave
+  802b80:	c3                   	ret
+
+00802b81 <_pipeisclosed>:
+{
+  802b81:	55                   	push   %ebp
+  802b82:	89 e5                	mov    %esp,%ebp
+  802b84:	57                   	push   %edi
+  802b85:	56                   	push   %esi
+  802b86:	53                   	push   %ebx
+  802b87:	83 ec 1c             	sub    $0x1c,%esp
+  802b8a:	89 c7                	mov    %eax,%edi
+  802b8c:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802b8e:	a1 00 50 80 00       	mov    0x805000,%eax
+  802b93:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802b96:	83 ec 0c             	sub    $0xc,%esp
+  802b99:	57                   	push   %edi
+  802b9a:	e8 66 09 00 00       	call   803505 <pageref>
+  802b9f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ba2:	89 34 24             	mov    %esi,(%esp)
+  802ba5:	e8 5b 09 00 00       	call   803505 <pageref>
+		nn = thisenv->env_runs;
+  802baa:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802bb0:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802bb3:	83 c4 10             	add    $0x10,%esp
+  802bb6:	39 cb                	cmp    %ecx,%ebx
+  802bb8:	74 1b                	je     802bd5 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802bba:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802bbd:	75 cf                	jne    802b8e <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802bbf:	8b 42 58             	mov    0x58(%edx),%eax
+  802bc2:	6a 01                	push   $0x1
+  802bc4:	50                   	push   %eax
+  802bc5:	53                   	push   %ebx
+  802bc6:	68 bd 3c 80 00       	push   $0x803cbd
+  802bcb:	e8 a8 d5 ff ff       	call   800178 <cprintf>
+  802bd0:	83 c4 10             	add    $0x10,%esp
+  802bd3:	eb b9                	jmp    802b8e <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802bd5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802bd8:	0f 94 c0             	sete   %al
+  802bdb:	0f b6 c0             	movzbl %al,%eax
+}
+  802bde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802be1:	5b                   	pop    %ebx
+  802be2:	5e                   	pop    %esi
+  802be3:	5f                   	pop    %edi
+  802be4:	5d                   	pop    %ebp
+  802be5:	c3                   	ret
+
+00802be6 <devpipe_write>:
+{
+  802be6:	55                   	push   %ebp
+  802be7:	89 e5                	mov    %esp,%ebp
+  802be9:	57                   	push   %edi
+  802bea:	56                   	push   %esi
+  802beb:	53                   	push   %ebx
+  802bec:	83 ec 28             	sub    $0x28,%esp
+  802bef:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802bf2:	56                   	push   %esi
+  802bf3:	e8 24 e4 ff ff       	call   80101c <fd2data>
+  802bf8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802bfa:	83 c4 10             	add    $0x10,%esp
+  802bfd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c02:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802c05:	75 09                	jne    802c10 <devpipe_write+0x2a>
+	return i;
+  802c07:	89 f8                	mov    %edi,%eax
+  802c09:	eb 23                	jmp    802c2e <devpipe_write+0x48>
+			sys_yield();
+  802c0b:	e8 43 df ff ff       	call   800b53 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802c10:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c13:	8b 0b                	mov    (%ebx),%ecx
+  802c15:	8d 51 20             	lea    0x20(%ecx),%edx
+  802c18:	39 d0                	cmp    %edx,%eax
+  802c1a:	72 1a                	jb     802c36 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802c1c:	89 da                	mov    %ebx,%edx
+  802c1e:	89 f0                	mov    %esi,%eax
+  802c20:	e8 5c ff ff ff       	call   802b81 <_pipeisclosed>
+  802c25:	85 c0                	test   %eax,%eax
+  802c27:	74 e2                	je     802c0b <devpipe_write+0x25>
+				return 0;
+  802c29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c31:	5b                   	pop    %ebx
+  802c32:	5e                   	pop    %esi
+  802c33:	5f                   	pop    %edi
+  802c34:	5d                   	pop    %ebp
+  802c35:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802c36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c39:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802c3d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802c40:	89 c2                	mov    %eax,%edx
+  802c42:	c1 fa 1f             	sar    $0x1f,%edx
+  802c45:	89 d1                	mov    %edx,%ecx
+  802c47:	c1 e9 1b             	shr    $0x1b,%ecx
+  802c4a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802c4d:	83 e2 1f             	and    $0x1f,%edx
+  802c50:	29 ca                	sub    %ecx,%edx
+  802c52:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802c56:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802c5a:	83 c0 01             	add    $0x1,%eax
+  802c5d:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802c60:	83 c7 01             	add    $0x1,%edi
+  802c63:	eb 9d                	jmp    802c02 <devpipe_write+0x1c>
+
+00802c65 <devpipe_read>:
+{
+  802c65:	55                   	push   %ebp
+  802c66:	89 e5                	mov    %esp,%ebp
+  802c68:	57                   	push   %edi
+  802c69:	56                   	push   %esi
+  802c6a:	53                   	push   %ebx
+  802c6b:	83 ec 18             	sub    $0x18,%esp
+  802c6e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802c71:	57                   	push   %edi
+  802c72:	e8 a5 e3 ff ff       	call   80101c <fd2data>
+  802c77:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802c79:	83 c4 10             	add    $0x10,%esp
+  802c7c:	be 00 00 00 00       	mov    $0x0,%esi
+  802c81:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c84:	75 13                	jne    802c99 <devpipe_read+0x34>
+	return i;
+  802c86:	89 f0                	mov    %esi,%eax
+  802c88:	eb 02                	jmp    802c8c <devpipe_read+0x27>
+				return i;
+  802c8a:	89 f0                	mov    %esi,%eax
+}
+  802c8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c8f:	5b                   	pop    %ebx
+  802c90:	5e                   	pop    %esi
+  802c91:	5f                   	pop    %edi
+  802c92:	5d                   	pop    %ebp
+  802c93:	c3                   	ret
+			sys_yield();
+  802c94:	e8 ba de ff ff       	call   800b53 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802c99:	8b 03                	mov    (%ebx),%eax
+  802c9b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802c9e:	75 18                	jne    802cb8 <devpipe_read+0x53>
+			if (i > 0)
+  802ca0:	85 f6                	test   %esi,%esi
+  802ca2:	75 e6                	jne    802c8a <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802ca4:	89 da                	mov    %ebx,%edx
+  802ca6:	89 f8                	mov    %edi,%eax
+  802ca8:	e8 d4 fe ff ff       	call   802b81 <_pipeisclosed>
+  802cad:	85 c0                	test   %eax,%eax
+  802caf:	74 e3                	je     802c94 <devpipe_read+0x2f>
+				return 0;
+  802cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb6:	eb d4                	jmp    802c8c <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802cb8:	99                   	cltd
+  802cb9:	c1 ea 1b             	shr    $0x1b,%edx
+  802cbc:	01 d0                	add    %edx,%eax
+  802cbe:	83 e0 1f             	and    $0x1f,%eax
+  802cc1:	29 d0                	sub    %edx,%eax
+  802cc3:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802cc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ccb:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802cce:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802cd1:	83 c6 01             	add    $0x1,%esi
+  802cd4:	eb ab                	jmp    802c81 <devpipe_read+0x1c>
+
+00802cd6 <pipe>:
+{
+  802cd6:	55                   	push   %ebp
+  802cd7:	89 e5                	mov    %esp,%ebp
+  802cd9:	56                   	push   %esi
+  802cda:	53                   	push   %ebx
+  802cdb:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802cde:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ce1:	50                   	push   %eax
+  802ce2:	e8 4c e3 ff ff       	call   801033 <fd_alloc>
+  802ce7:	89 c3                	mov    %eax,%ebx
+  802ce9:	83 c4 10             	add    $0x10,%esp
+  802cec:	85 c0                	test   %eax,%eax
+  802cee:	0f 88 23 01 00 00    	js     802e17 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cf4:	83 ec 04             	sub    $0x4,%esp
+  802cf7:	68 07 04 00 00       	push   $0x407
+  802cfc:	ff 75 f4             	push   -0xc(%ebp)
+  802cff:	6a 00                	push   $0x0
+  802d01:	e8 6c de ff ff       	call   800b72 <sys_page_alloc>
+  802d06:	89 c3                	mov    %eax,%ebx
+  802d08:	83 c4 10             	add    $0x10,%esp
+  802d0b:	85 c0                	test   %eax,%eax
+  802d0d:	0f 88 04 01 00 00    	js     802e17 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802d13:	83 ec 0c             	sub    $0xc,%esp
+  802d16:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802d19:	50                   	push   %eax
+  802d1a:	e8 14 e3 ff ff       	call   801033 <fd_alloc>
+  802d1f:	89 c3                	mov    %eax,%ebx
+  802d21:	83 c4 10             	add    $0x10,%esp
+  802d24:	85 c0                	test   %eax,%eax
+  802d26:	0f 88 db 00 00 00    	js     802e07 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d2c:	83 ec 04             	sub    $0x4,%esp
+  802d2f:	68 07 04 00 00       	push   $0x407
+  802d34:	ff 75 f0             	push   -0x10(%ebp)
+  802d37:	6a 00                	push   $0x0
+  802d39:	e8 34 de ff ff       	call   800b72 <sys_page_alloc>
+  802d3e:	89 c3                	mov    %eax,%ebx
+  802d40:	83 c4 10             	add    $0x10,%esp
+  802d43:	85 c0                	test   %eax,%eax
+  802d45:	0f 88 bc 00 00 00    	js     802e07 <pipe+0x131>
+	va = fd2data(fd0);
+  802d4b:	83 ec 0c             	sub    $0xc,%esp
+  802d4e:	ff 75 f4             	push   -0xc(%ebp)
+  802d51:	e8 c6 e2 ff ff       	call   80101c <fd2data>
+  802d56:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d58:	83 c4 0c             	add    $0xc,%esp
+  802d5b:	68 07 04 00 00       	push   $0x407
+  802d60:	50                   	push   %eax
+  802d61:	6a 00                	push   $0x0
+  802d63:	e8 0a de ff ff       	call   800b72 <sys_page_alloc>
+  802d68:	89 c3                	mov    %eax,%ebx
+  802d6a:	83 c4 10             	add    $0x10,%esp
+  802d6d:	85 c0                	test   %eax,%eax
+  802d6f:	0f 88 82 00 00 00    	js     802df7 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d75:	83 ec 0c             	sub    $0xc,%esp
+  802d78:	ff 75 f0             	push   -0x10(%ebp)
+  802d7b:	e8 9c e2 ff ff       	call   80101c <fd2data>
+  802d80:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802d87:	50                   	push   %eax
+  802d88:	6a 00                	push   $0x0
+  802d8a:	56                   	push   %esi
+  802d8b:	6a 00                	push   $0x0
+  802d8d:	e8 2b de ff ff       	call   800bbd <sys_page_map>
+  802d92:	89 c3                	mov    %eax,%ebx
+  802d94:	83 c4 20             	add    $0x20,%esp
+  802d97:	85 c0                	test   %eax,%eax
+  802d99:	78 4e                	js     802de9 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802d9b:	a1 60 40 80 00       	mov    0x804060,%eax
+  802da0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802da3:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802da5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802da8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802daf:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802db2:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802db4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802db7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802dbe:	83 ec 0c             	sub    $0xc,%esp
+  802dc1:	ff 75 f4             	push   -0xc(%ebp)
+  802dc4:	e8 43 e2 ff ff       	call   80100c <fd2num>
+  802dc9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802dcc:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802dce:	83 c4 04             	add    $0x4,%esp
+  802dd1:	ff 75 f0             	push   -0x10(%ebp)
+  802dd4:	e8 33 e2 ff ff       	call   80100c <fd2num>
+  802dd9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ddc:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802ddf:	83 c4 10             	add    $0x10,%esp
+  802de2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802de7:	eb 2e                	jmp    802e17 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802de9:	83 ec 08             	sub    $0x8,%esp
+  802dec:	56                   	push   %esi
+  802ded:	6a 00                	push   $0x0
+  802def:	e8 0b de ff ff       	call   800bff <sys_page_unmap>
+  802df4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802df7:	83 ec 08             	sub    $0x8,%esp
+  802dfa:	ff 75 f0             	push   -0x10(%ebp)
+  802dfd:	6a 00                	push   $0x0
+  802dff:	e8 fb dd ff ff       	call   800bff <sys_page_unmap>
+  802e04:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802e07:	83 ec 08             	sub    $0x8,%esp
+  802e0a:	ff 75 f4             	push   -0xc(%ebp)
+  802e0d:	6a 00                	push   $0x0
+  802e0f:	e8 eb dd ff ff       	call   800bff <sys_page_unmap>
+  802e14:	83 c4 10             	add    $0x10,%esp
+}
+  802e17:	89 d8                	mov    %ebx,%eax
+  802e19:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e1c:	5b                   	pop    %ebx
+  802e1d:	5e                   	pop    %esi
+  802e1e:	5d                   	pop    %ebp
+  802e1f:	c3                   	ret
+
+00802e20 <pipeisclosed>:
+{
+  802e20:	55                   	push   %ebp
+  802e21:	89 e5                	mov    %esp,%ebp
+  802e23:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e29:	50                   	push   %eax
+  802e2a:	ff 75 08             	push   0x8(%ebp)
+  802e2d:	e8 57 e2 ff ff       	call   801089 <fd_lookup>
+  802e32:	83 c4 10             	add    $0x10,%esp
+  802e35:	85 c0                	test   %eax,%eax
+  802e37:	78 18                	js     802e51 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802e39:	83 ec 0c             	sub    $0xc,%esp
+  802e3c:	ff 75 f4             	push   -0xc(%ebp)
+  802e3f:	e8 d8 e1 ff ff       	call   80101c <fd2data>
+  802e44:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802e46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e49:	e8 33 fd ff ff       	call   802b81 <_pipeisclosed>
+  802e4e:	83 c4 10             	add    $0x10,%esp
+}
+  802e51:	c9                   	leave
+  802e52:	c3                   	ret
+
+00802e53 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802e53:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e58:	c3                   	ret
+
+00802e59 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e59:	55                   	push   %ebp
+  802e5a:	89 e5                	mov    %esp,%ebp
+  802e5c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802e5f:	68 d5 3c 80 00       	push   $0x803cd5
+  802e64:	ff 75 0c             	push   0xc(%ebp)
+  802e67:	e8 fa d8 ff ff       	call   800766 <strcpy>
+	return 0;
+}
+  802e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e71:	c9                   	leave
+  802e72:	c3                   	ret
+
+00802e73 <devcons_write>:
+{
+  802e73:	55                   	push   %ebp
+  802e74:	89 e5                	mov    %esp,%ebp
+  802e76:	57                   	push   %edi
+  802e77:	56                   	push   %esi
+  802e78:	53                   	push   %ebx
+  802e79:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802e7f:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802e84:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802e8a:	eb 2e                	jmp    802eba <devcons_write+0x47>
+		m = n - tot;
+  802e8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e8f:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802e91:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802e96:	39 c3                	cmp    %eax,%ebx
+  802e98:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802e9b:	83 ec 04             	sub    $0x4,%esp
+  802e9e:	53                   	push   %ebx
+  802e9f:	89 f0                	mov    %esi,%eax
+  802ea1:	03 45 0c             	add    0xc(%ebp),%eax
+  802ea4:	50                   	push   %eax
+  802ea5:	57                   	push   %edi
+  802ea6:	e8 41 da ff ff       	call   8008ec <memmove>
+		sys_cputs(buf, m);
+  802eab:	83 c4 08             	add    $0x8,%esp
+  802eae:	53                   	push   %ebx
+  802eaf:	57                   	push   %edi
+  802eb0:	e8 e1 db ff ff       	call   800a96 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802eb5:	01 de                	add    %ebx,%esi
+  802eb7:	83 c4 10             	add    $0x10,%esp
+  802eba:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ebd:	72 cd                	jb     802e8c <devcons_write+0x19>
+}
+  802ebf:	89 f0                	mov    %esi,%eax
+  802ec1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ec4:	5b                   	pop    %ebx
+  802ec5:	5e                   	pop    %esi
+  802ec6:	5f                   	pop    %edi
+  802ec7:	5d                   	pop    %ebp
+  802ec8:	c3                   	ret
+
+00802ec9 <devcons_read>:
+{
+  802ec9:	55                   	push   %ebp
+  802eca:	89 e5                	mov    %esp,%ebp
+  802ecc:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ed8:	75 07                	jne    802ee1 <devcons_read+0x18>
+  802eda:	eb 1f                	jmp    802efb <devcons_read+0x32>
+		sys_yield();
+  802edc:	e8 72 dc ff ff       	call   800b53 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802ee1:	e8 d6 db ff ff       	call   800abc <sys_cgetc>
+  802ee6:	85 c0                	test   %eax,%eax
+  802ee8:	74 f2                	je     802edc <devcons_read+0x13>
+	if (c < 0)
+  802eea:	78 0f                	js     802efb <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802eec:	83 f8 04             	cmp    $0x4,%eax
+  802eef:	74 0c                	je     802efd <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802ef1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ef4:	88 02                	mov    %al,(%edx)
+	return 1;
+  802ef6:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802efb:	c9                   	leave
+  802efc:	c3                   	ret
+		return 0;
+  802efd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f02:	eb f7                	jmp    802efb <devcons_read+0x32>
+
+00802f04 <cputchar>:
+{
+  802f04:	55                   	push   %ebp
+  802f05:	89 e5                	mov    %esp,%ebp
+  802f07:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802f0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f0d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802f10:	6a 01                	push   $0x1
+  802f12:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802f15:	50                   	push   %eax
+  802f16:	e8 7b db ff ff       	call   800a96 <sys_cputs>
+}
+  802f1b:	83 c4 10             	add    $0x10,%esp
+  802f1e:	c9                   	leave
+  802f1f:	c3                   	ret
+
+00802f20 <getchar>:
+{
+  802f20:	55                   	push   %ebp
+  802f21:	89 e5                	mov    %esp,%ebp
+  802f23:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802f26:	6a 01                	push   $0x1
+  802f28:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802f2b:	50                   	push   %eax
+  802f2c:	6a 00                	push   $0x0
+  802f2e:	e8 bc e3 ff ff       	call   8012ef <read>
+	if (r < 0)
+  802f33:	83 c4 10             	add    $0x10,%esp
+  802f36:	85 c0                	test   %eax,%eax
+  802f38:	78 06                	js     802f40 <getchar+0x20>
+	if (r < 1)
+  802f3a:	74 06                	je     802f42 <getchar+0x22>
+	return c;
+  802f3c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802f40:	c9                   	leave
+  802f41:	c3                   	ret
+		return -E_EOF;
+  802f42:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802f47:	eb f7                	jmp    802f40 <getchar+0x20>
+
+00802f49 <iscons>:
+{
+  802f49:	55                   	push   %ebp
+  802f4a:	89 e5                	mov    %esp,%ebp
+  802f4c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f4f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f52:	50                   	push   %eax
+  802f53:	ff 75 08             	push   0x8(%ebp)
+  802f56:	e8 2e e1 ff ff       	call   801089 <fd_lookup>
+  802f5b:	83 c4 10             	add    $0x10,%esp
+  802f5e:	85 c0                	test   %eax,%eax
+  802f60:	78 11                	js     802f73 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802f62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f65:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802f6b:	39 10                	cmp    %edx,(%eax)
+  802f6d:	0f 94 c0             	sete   %al
+  802f70:	0f b6 c0             	movzbl %al,%eax
+}
+  802f73:	c9                   	leave
+  802f74:	c3                   	ret
+
+00802f75 <opencons>:
+{
+  802f75:	55                   	push   %ebp
+  802f76:	89 e5                	mov    %esp,%ebp
+  802f78:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802f7b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f7e:	50                   	push   %eax
+  802f7f:	e8 af e0 ff ff       	call   801033 <fd_alloc>
+  802f84:	83 c4 10             	add    $0x10,%esp
+  802f87:	85 c0                	test   %eax,%eax
+  802f89:	78 3a                	js     802fc5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802f8b:	83 ec 04             	sub    $0x4,%esp
+  802f8e:	68 07 04 00 00       	push   $0x407
+  802f93:	ff 75 f4             	push   -0xc(%ebp)
+  802f96:	6a 00                	push   $0x0
+  802f98:	e8 d5 db ff ff       	call   800b72 <sys_page_alloc>
+  802f9d:	83 c4 10             	add    $0x10,%esp
+  802fa0:	85 c0                	test   %eax,%eax
+  802fa2:	78 21                	js     802fc5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802fa4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fa7:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802fad:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802faf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fb2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802fb9:	83 ec 0c             	sub    $0xc,%esp
+  802fbc:	50                   	push   %eax
+  802fbd:	e8 4a e0 ff ff       	call   80100c <fd2num>
+  802fc2:	83 c4 10             	add    $0x10,%esp
+}
+  802fc5:	c9                   	leave
+  802fc6:	c3                   	ret
+
+00802fc7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802fc7:	55                   	push   %ebp
+  802fc8:	89 e5                	mov    %esp,%ebp
+  802fca:	56                   	push   %esi
+  802fcb:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802fcc:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802fcf:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802fd5:	e8 52 db ff ff       	call   800b2c <sys_getenvid>
+  802fda:	83 ec 0c             	sub    $0xc,%esp
+  802fdd:	ff 75 0c             	push   0xc(%ebp)
+  802fe0:	ff 75 08             	push   0x8(%ebp)
+  802fe3:	56                   	push   %esi
+  802fe4:	50                   	push   %eax
+  802fe5:	68 e4 3c 80 00       	push   $0x803ce4
+  802fea:	e8 89 d1 ff ff       	call   800178 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802fef:	83 c4 18             	add    $0x18,%esp
+  802ff2:	53                   	push   %ebx
+  802ff3:	ff 75 10             	push   0x10(%ebp)
+  802ff6:	e8 2c d1 ff ff       	call   800127 <vcprintf>
+	cprintf("\n");
+  802ffb:	c7 04 24 ce 3c 80 00 	movl   $0x803cce,(%esp)
+  803002:	e8 71 d1 ff ff       	call   800178 <cprintf>
+  803007:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80300a:	cc                   	int3
+	while (1)
+  80300b:	eb fd                	jmp    80300a <_panic+0x43>
+
+0080300d <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  80300d:	55                   	push   %ebp
+  80300e:	89 e5                	mov    %esp,%ebp
+  803010:	57                   	push   %edi
+  803011:	56                   	push   %esi
+  803012:	53                   	push   %ebx
+  803013:	83 ec 20             	sub    $0x20,%esp
+  803016:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803019:	89 d7                	mov    %edx,%edi
+  80301b:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  80301d:	51                   	push   %ecx
+  80301e:	68 00 f0 7f 00       	push   $0x7ff000
+  803023:	6a 00                	push   $0x0
+  803025:	e8 48 db ff ff       	call   800b72 <sys_page_alloc>
+  80302a:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80302c:	83 c4 10             	add    $0x10,%esp
+  80302f:	85 c0                	test   %eax,%eax
+  803031:	78 45                	js     803078 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  803033:	83 ec 04             	sub    $0x4,%esp
+  803036:	68 00 10 00 00       	push   $0x1000
+  80303b:	57                   	push   %edi
+  80303c:	68 00 f0 7f 00       	push   $0x7ff000
+  803041:	e8 a6 d8 ff ff       	call   8008ec <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  803046:	89 34 24             	mov    %esi,(%esp)
+  803049:	57                   	push   %edi
+  80304a:	ff 75 e4             	push   -0x1c(%ebp)
+  80304d:	68 00 f0 7f 00       	push   $0x7ff000
+  803052:	6a 00                	push   $0x0
+  803054:	e8 64 db ff ff       	call   800bbd <sys_page_map>
+  803059:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80305b:	83 c4 20             	add    $0x20,%esp
+  80305e:	85 c0                	test   %eax,%eax
+  803060:	78 16                	js     803078 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803062:	83 ec 08             	sub    $0x8,%esp
+  803065:	68 00 f0 7f 00       	push   $0x7ff000
+  80306a:	6a 00                	push   $0x0
+  80306c:	e8 8e db ff ff       	call   800bff <sys_page_unmap>
+  803071:	83 c4 10             	add    $0x10,%esp
+  803074:	85 c0                	test   %eax,%eax
+  803076:	75 0a                	jne    803082 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  803078:	89 d8                	mov    %ebx,%eax
+  80307a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80307d:	5b                   	pop    %ebx
+  80307e:	5e                   	pop    %esi
+  80307f:	5f                   	pop    %edi
+  803080:	5d                   	pop    %ebp
+  803081:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803082:	68 08 3d 80 00       	push   $0x803d08
+  803087:	68 6c 3b 80 00       	push   $0x803b6c
+  80308c:	6a 1b                	push   $0x1b
+  80308e:	68 80 3d 80 00       	push   $0x803d80
+  803093:	e8 2f ff ff ff       	call   802fc7 <_panic>
+
+00803098 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803098:	55                   	push   %ebp
+  803099:	89 e5                	mov    %esp,%ebp
+  80309b:	53                   	push   %ebx
+  80309c:	83 ec 04             	sub    $0x4,%esp
+  80309f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8030a2:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8030a4:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  8030a8:	74 21                	je     8030cb <pgfault+0x33>
+  8030aa:	89 d0                	mov    %edx,%eax
+  8030ac:	c1 e8 16             	shr    $0x16,%eax
+  8030af:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8030b6:	a8 01                	test   $0x1,%al
+  8030b8:	74 11                	je     8030cb <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  8030ba:	89 d0                	mov    %edx,%eax
+  8030bc:	c1 e8 0c             	shr    $0xc,%eax
+  8030bf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8030c6:	f6 c4 08             	test   $0x8,%ah
+  8030c9:	75 17                	jne    8030e2 <pgfault+0x4a>
+		if (pgfault_next) {
+  8030cb:	a1 04 90 80 00       	mov    0x809004,%eax
+  8030d0:	85 c0                	test   %eax,%eax
+  8030d2:	74 27                	je     8030fb <pgfault+0x63>
+			pgfault_next(utf);
+  8030d4:	83 ec 0c             	sub    $0xc,%esp
+  8030d7:	53                   	push   %ebx
+  8030d8:	ff d0                	call   *%eax
+			return;
+  8030da:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8030dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030e0:	c9                   	leave
+  8030e1:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8030e2:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8030e8:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8030ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f2:	e8 16 ff ff ff       	call   80300d <copy_page_to>
+  8030f7:	85 c0                	test   %eax,%eax
+  8030f9:	79 e2                	jns    8030dd <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8030fb:	a1 00 50 80 00       	mov    0x805000,%eax
+  803100:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803103:	ff 73 28             	push   0x28(%ebx)
+  803106:	ff 33                	push   (%ebx)
+  803108:	50                   	push   %eax
+  803109:	68 2c 3d 80 00       	push   $0x803d2c
+  80310e:	e8 65 d0 ff ff       	call   800178 <cprintf>
+	sys_env_destroy(0);
+  803113:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80311a:	e8 c4 d9 ff ff       	call   800ae3 <sys_env_destroy>
+  80311f:	83 c4 10             	add    $0x10,%esp
+  803122:	eb b9                	jmp    8030dd <pgfault+0x45>
+
+00803124 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803124:	55                   	push   %ebp
+  803125:	89 e5                	mov    %esp,%ebp
+  803127:	53                   	push   %ebx
+  803128:	83 ec 04             	sub    $0x4,%esp
+  80312b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80312e:	a1 04 50 80 00       	mov    0x805004,%eax
+  803133:	3d 98 30 80 00       	cmp    $0x803098,%eax
+  803138:	74 15                	je     80314f <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80313a:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  80313f:	83 ec 0c             	sub    $0xc,%esp
+  803142:	68 98 30 80 00       	push   $0x803098
+  803147:	e8 27 de ff ff       	call   800f73 <set_pgfault_handler>
+  80314c:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80314f:	83 ec 0c             	sub    $0xc,%esp
+  803152:	68 05 08 00 00       	push   $0x805
+  803157:	53                   	push   %ebx
+  803158:	6a 00                	push   $0x0
+  80315a:	53                   	push   %ebx
+  80315b:	6a 00                	push   $0x0
+  80315d:	e8 5b da ff ff       	call   800bbd <sys_page_map>
+}
+  803162:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803165:	c9                   	leave
+  803166:	c3                   	ret
+
+00803167 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803167:	55                   	push   %ebp
+  803168:	89 e5                	mov    %esp,%ebp
+  80316a:	57                   	push   %edi
+  80316b:	56                   	push   %esi
+  80316c:	53                   	push   %ebx
+  80316d:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  803170:	68 98 30 80 00       	push   $0x803098
+  803175:	e8 f9 dd ff ff       	call   800f73 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80317a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80317f:	cd 30                	int    $0x30
+  803181:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803184:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  803187:	83 c4 10             	add    $0x10,%esp
+  80318a:	85 c0                	test   %eax,%eax
+  80318c:	0f 88 6b 01 00 00    	js     8032fd <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803192:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803197:	75 37                	jne    8031d0 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803199:	e8 8e d9 ff ff       	call   800b2c <sys_getenvid>
+  80319e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031a3:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8031a9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8031ae:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8031b3:	e9 45 01 00 00       	jmp    8032fd <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8031b8:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8031be:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8031c4:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8031ca:	0f 87 ba 00 00 00    	ja     80328a <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8031d0:	89 d8                	mov    %ebx,%eax
+  8031d2:	c1 e8 16             	shr    $0x16,%eax
+  8031d5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8031dc:	a8 01                	test   $0x1,%al
+  8031de:	74 d8                	je     8031b8 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8031e0:	89 d8                	mov    %ebx,%eax
+  8031e2:	c1 e8 0c             	shr    $0xc,%eax
+  8031e5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031ec:	f6 c2 01             	test   $0x1,%dl
+  8031ef:	74 cd                	je     8031be <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8031f1:	89 da                	mov    %ebx,%edx
+  8031f3:	80 e6 df             	and    $0xdf,%dh
+  8031f6:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8031fc:	74 c0                	je     8031be <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8031fe:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803200:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803207:	f6 c6 04             	test   $0x4,%dh
+  80320a:	75 53                	jne    80325f <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80320c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803213:	f6 c6 08             	test   $0x8,%dh
+  803216:	75 0c                	jne    803224 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803218:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80321f:	f6 c2 02             	test   $0x2,%dl
+  803222:	74 3b                	je     80325f <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803224:	83 ec 0c             	sub    $0xc,%esp
+  803227:	68 05 08 00 00       	push   $0x805
+  80322c:	57                   	push   %edi
+  80322d:	ff 75 e4             	push   -0x1c(%ebp)
+  803230:	57                   	push   %edi
+  803231:	6a 00                	push   $0x0
+  803233:	e8 85 d9 ff ff       	call   800bbd <sys_page_map>
+  803238:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80323a:	83 c4 20             	add    $0x20,%esp
+  80323d:	85 c0                	test   %eax,%eax
+  80323f:	0f 88 a7 00 00 00    	js     8032ec <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803245:	83 ec 0c             	sub    $0xc,%esp
+  803248:	68 05 08 00 00       	push   $0x805
+  80324d:	57                   	push   %edi
+  80324e:	6a 00                	push   $0x0
+  803250:	57                   	push   %edi
+  803251:	6a 00                	push   $0x0
+  803253:	e8 65 d9 ff ff       	call   800bbd <sys_page_map>
+  803258:	89 c6                	mov    %eax,%esi
+	return r;
+  80325a:	83 c4 20             	add    $0x20,%esp
+  80325d:	eb 21                	jmp    803280 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  80325f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803266:	83 ec 0c             	sub    $0xc,%esp
+  803269:	25 07 0e 00 00       	and    $0xe07,%eax
+  80326e:	50                   	push   %eax
+  80326f:	57                   	push   %edi
+  803270:	ff 75 e4             	push   -0x1c(%ebp)
+  803273:	57                   	push   %edi
+  803274:	6a 00                	push   $0x0
+  803276:	e8 42 d9 ff ff       	call   800bbd <sys_page_map>
+  80327b:	89 c6                	mov    %eax,%esi
+  80327d:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  803280:	85 f6                	test   %esi,%esi
+  803282:	0f 89 36 ff ff ff    	jns    8031be <fork+0x57>
+  803288:	eb 62                	jmp    8032ec <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80328a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80328f:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  803294:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803297:	89 f8                	mov    %edi,%eax
+  803299:	e8 6f fd ff ff       	call   80300d <copy_page_to>
+  80329e:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032a0:	85 c0                	test   %eax,%eax
+  8032a2:	78 48                	js     8032ec <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8032a4:	83 ec 04             	sub    $0x4,%esp
+  8032a7:	6a 07                	push   $0x7
+  8032a9:	68 00 f0 bf ee       	push   $0xeebff000
+  8032ae:	57                   	push   %edi
+  8032af:	e8 be d8 ff ff       	call   800b72 <sys_page_alloc>
+  8032b4:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032b6:	83 c4 10             	add    $0x10,%esp
+  8032b9:	85 c0                	test   %eax,%eax
+  8032bb:	78 2f                	js     8032ec <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8032bd:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032c2:	8b 40 64             	mov    0x64(%eax),%eax
+  8032c5:	83 ec 08             	sub    $0x8,%esp
+  8032c8:	50                   	push   %eax
+  8032c9:	57                   	push   %edi
+  8032ca:	e8 0e da ff ff       	call   800cdd <sys_env_set_pgfault_upcall>
+  8032cf:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032d1:	83 c4 10             	add    $0x10,%esp
+  8032d4:	85 c0                	test   %eax,%eax
+  8032d6:	78 14                	js     8032ec <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8032d8:	83 ec 08             	sub    $0x8,%esp
+  8032db:	6a 02                	push   $0x2
+  8032dd:	57                   	push   %edi
+  8032de:	e8 66 d9 ff ff       	call   800c49 <sys_env_set_status>
+  8032e3:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032e5:	83 c4 10             	add    $0x10,%esp
+  8032e8:	85 c0                	test   %eax,%eax
+  8032ea:	79 11                	jns    8032fd <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8032ec:	83 ec 0c             	sub    $0xc,%esp
+  8032ef:	ff 75 e0             	push   -0x20(%ebp)
+  8032f2:	e8 ec d7 ff ff       	call   800ae3 <sys_env_destroy>
+	return r;
+  8032f7:	83 c4 10             	add    $0x10,%esp
+  8032fa:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8032fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803300:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803303:	5b                   	pop    %ebx
+  803304:	5e                   	pop    %esi
+  803305:	5f                   	pop    %edi
+  803306:	5d                   	pop    %ebp
+  803307:	c3                   	ret
+
+00803308 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803308:	55                   	push   %ebp
+  803309:	89 e5                	mov    %esp,%ebp
+  80330b:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80330e:	68 8b 3d 80 00       	push   $0x803d8b
+  803313:	68 bf 00 00 00       	push   $0xbf
+  803318:	68 80 3d 80 00       	push   $0x803d80
+  80331d:	e8 a5 fc ff ff       	call   802fc7 <_panic>
+
+00803322 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803322:	55                   	push   %ebp
+  803323:	89 e5                	mov    %esp,%ebp
+  803325:	56                   	push   %esi
+  803326:	53                   	push   %ebx
+  803327:	8b 75 08             	mov    0x8(%ebp),%esi
+  80332a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80332d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803330:	85 c0                	test   %eax,%eax
+  803332:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803337:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80333a:	83 ec 0c             	sub    $0xc,%esp
+  80333d:	50                   	push   %eax
+  80333e:	e8 77 da ff ff       	call   800dba <sys_ipc_recv>
+	if (from_env_store)
+  803343:	83 c4 10             	add    $0x10,%esp
+  803346:	85 f6                	test   %esi,%esi
+  803348:	74 14                	je     80335e <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80334a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80334f:	85 c0                	test   %eax,%eax
+  803351:	75 09                	jne    80335c <ipc_recv+0x3a>
+  803353:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803359:	8b 52 74             	mov    0x74(%edx),%edx
+  80335c:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  80335e:	85 db                	test   %ebx,%ebx
+  803360:	74 25                	je     803387 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803362:	85 c0                	test   %eax,%eax
+  803364:	74 0d                	je     803373 <ipc_recv+0x51>
+  803366:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  80336c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80336f:	5b                   	pop    %ebx
+  803370:	5e                   	pop    %esi
+  803371:	5d                   	pop    %ebp
+  803372:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803373:	a1 00 50 80 00       	mov    0x805000,%eax
+  803378:	8b 40 78             	mov    0x78(%eax),%eax
+  80337b:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  80337d:	a1 00 50 80 00       	mov    0x805000,%eax
+  803382:	8b 40 70             	mov    0x70(%eax),%eax
+  803385:	eb e5                	jmp    80336c <ipc_recv+0x4a>
+  803387:	85 c0                	test   %eax,%eax
+  803389:	75 e1                	jne    80336c <ipc_recv+0x4a>
+  80338b:	eb f0                	jmp    80337d <ipc_recv+0x5b>
+
+0080338d <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80338d:	55                   	push   %ebp
+  80338e:	89 e5                	mov    %esp,%ebp
+  803390:	57                   	push   %edi
+  803391:	56                   	push   %esi
+  803392:	53                   	push   %ebx
+  803393:	83 ec 0c             	sub    $0xc,%esp
+  803396:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803399:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80339c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80339f:	85 db                	test   %ebx,%ebx
+  8033a1:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8033a6:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8033a9:	ff 75 14             	push   0x14(%ebp)
+  8033ac:	53                   	push   %ebx
+  8033ad:	56                   	push   %esi
+  8033ae:	57                   	push   %edi
+  8033af:	e8 73 d9 ff ff       	call   800d27 <sys_ipc_try_send>
+  8033b4:	83 c4 10             	add    $0x10,%esp
+  8033b7:	85 c0                	test   %eax,%eax
+  8033b9:	74 22                	je     8033dd <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8033bb:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033be:	75 07                	jne    8033c7 <ipc_send+0x3a>
+		sys_yield();
+  8033c0:	e8 8e d7 ff ff       	call   800b53 <sys_yield>
+  8033c5:	eb e2                	jmp    8033a9 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8033c7:	68 a1 3d 80 00       	push   $0x803da1
+  8033cc:	68 6c 3b 80 00       	push   $0x803b6c
+  8033d1:	6a 39                	push   $0x39
+  8033d3:	68 b6 3d 80 00       	push   $0x803db6
+  8033d8:	e8 ea fb ff ff       	call   802fc7 <_panic>
+	}
+}
+  8033dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033e0:	5b                   	pop    %ebx
+  8033e1:	5e                   	pop    %esi
+  8033e2:	5f                   	pop    %edi
+  8033e3:	5d                   	pop    %ebp
+  8033e4:	c3                   	ret
+
+008033e5 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  8033e5:	55                   	push   %ebp
+  8033e6:	89 e5                	mov    %esp,%ebp
+  8033e8:	57                   	push   %edi
+  8033e9:	56                   	push   %esi
+  8033ea:	53                   	push   %ebx
+  8033eb:	83 ec 10             	sub    $0x10,%esp
+  8033ee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033f7:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8033fa:	85 c0                	test   %eax,%eax
+  8033fc:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803401:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803404:	6a 00                	push   $0x0
+  803406:	ff 33                	push   (%ebx)
+  803408:	50                   	push   %eax
+  803409:	e8 69 d9 ff ff       	call   800d77 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80340e:	83 c4 10             	add    $0x10,%esp
+  803411:	85 c0                	test   %eax,%eax
+  803413:	75 3c                	jne    803451 <ipc_recvv+0x6c>
+  803415:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80341b:	8b 52 7c             	mov    0x7c(%edx),%edx
+  80341e:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803420:	85 ff                	test   %edi,%edi
+  803422:	74 4e                	je     803472 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803424:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80342a:	8b 52 74             	mov    0x74(%edx),%edx
+  80342d:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  80342f:	85 f6                	test   %esi,%esi
+  803431:	74 18                	je     80344b <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803433:	85 c0                	test   %eax,%eax
+  803435:	75 2d                	jne    803464 <ipc_recvv+0x7f>
+  803437:	a1 00 50 80 00       	mov    0x805000,%eax
+  80343c:	8b 40 78             	mov    0x78(%eax),%eax
+  80343f:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803441:	a1 00 50 80 00       	mov    0x805000,%eax
+  803446:	8b 40 70             	mov    0x70(%eax),%eax
+  803449:	eb 1f                	jmp    80346a <ipc_recvv+0x85>
+  80344b:	85 c0                	test   %eax,%eax
+  80344d:	75 1b                	jne    80346a <ipc_recvv+0x85>
+  80344f:	eb f0                	jmp    803441 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803451:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803457:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  80345c:	85 ff                	test   %edi,%edi
+  80345e:	75 cd                	jne    80342d <ipc_recvv+0x48>
+	if (perm_store)
+  803460:	85 f6                	test   %esi,%esi
+  803462:	74 e7                	je     80344b <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803464:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80346a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80346d:	5b                   	pop    %ebx
+  80346e:	5e                   	pop    %esi
+  80346f:	5f                   	pop    %edi
+  803470:	5d                   	pop    %ebp
+  803471:	c3                   	ret
+	if (perm_store)
+  803472:	85 f6                	test   %esi,%esi
+  803474:	75 bd                	jne    803433 <ipc_recvv+0x4e>
+  803476:	eb c9                	jmp    803441 <ipc_recvv+0x5c>
+
+00803478 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803478:	55                   	push   %ebp
+  803479:	89 e5                	mov    %esp,%ebp
+  80347b:	57                   	push   %edi
+  80347c:	56                   	push   %esi
+  80347d:	53                   	push   %ebx
+  80347e:	83 ec 0c             	sub    $0xc,%esp
+  803481:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803484:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803487:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  80348a:	ff 75 14             	push   0x14(%ebp)
+  80348d:	53                   	push   %ebx
+  80348e:	56                   	push   %esi
+  80348f:	57                   	push   %edi
+  803490:	e8 ba d8 ff ff       	call   800d4f <sys_ipc_try_sendv>
+  803495:	83 c4 10             	add    $0x10,%esp
+  803498:	85 c0                	test   %eax,%eax
+  80349a:	74 22                	je     8034be <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  80349c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80349f:	75 07                	jne    8034a8 <ipc_sendv+0x30>
+		sys_yield();
+  8034a1:	e8 ad d6 ff ff       	call   800b53 <sys_yield>
+  8034a6:	eb e2                	jmp    80348a <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8034a8:	68 a1 3d 80 00       	push   $0x803da1
+  8034ad:	68 6c 3b 80 00       	push   $0x803b6c
+  8034b2:	6a 5c                	push   $0x5c
+  8034b4:	68 b6 3d 80 00       	push   $0x803db6
+  8034b9:	e8 09 fb ff ff       	call   802fc7 <_panic>
+	}
+}
+  8034be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034c1:	5b                   	pop    %ebx
+  8034c2:	5e                   	pop    %esi
+  8034c3:	5f                   	pop    %edi
+  8034c4:	5d                   	pop    %ebp
+  8034c5:	c3                   	ret
+
+008034c6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8034c6:	55                   	push   %ebp
+  8034c7:	89 e5                	mov    %esp,%ebp
+  8034c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8034cc:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8034d1:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8034d7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8034dd:	8b 52 50             	mov    0x50(%edx),%edx
+  8034e0:	39 ca                	cmp    %ecx,%edx
+  8034e2:	74 11                	je     8034f5 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8034e4:	83 c0 01             	add    $0x1,%eax
+  8034e7:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8034ec:	75 e3                	jne    8034d1 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8034ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f3:	eb 0e                	jmp    803503 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8034f5:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8034fb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803500:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803503:	5d                   	pop    %ebp
+  803504:	c3                   	ret
+
+00803505 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803505:	55                   	push   %ebp
+  803506:	89 e5                	mov    %esp,%ebp
+  803508:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80350b:	89 c2                	mov    %eax,%edx
+  80350d:	c1 ea 16             	shr    $0x16,%edx
+  803510:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803517:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80351c:	f6 c1 01             	test   $0x1,%cl
+  80351f:	74 22                	je     803543 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803521:	c1 e8 0c             	shr    $0xc,%eax
+  803524:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80352b:	a8 01                	test   $0x1,%al
+  80352d:	74 14                	je     803543 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80352f:	c1 e8 0c             	shr    $0xc,%eax
+  803532:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803535:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80353c:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803540:	0f b7 d2             	movzwl %dx,%edx
+}
+  803543:	89 d0                	mov    %edx,%eax
+  803545:	5d                   	pop    %ebp
+  803546:	c3                   	ret
+
+00803547 <dm>:
+  803547:	55                   	push   %ebp
+  803548:	57                   	push   %edi
+  803549:	56                   	push   %esi
+  80354a:	53                   	push   %ebx
+  80354b:	83 ec 24             	sub    $0x24,%esp
+  80354e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803552:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803556:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80355a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80355e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803562:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803566:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80356a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80356f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803574:	ba 00 00 00 00       	mov    $0x0,%edx
+  803579:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803580:	00 
+  803581:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803588:	00 
+  803589:	89 fb                	mov    %edi,%ebx
+  80358b:	eb 08                	jmp    803595 <dm+0x4e>
+  80358d:	83 e9 01             	sub    $0x1,%ecx
+  803590:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803593:	74 68                	je     8035fd <dm+0xb6>
+  803595:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803599:	01 c0                	add    %eax,%eax
+  80359b:	89 c6                	mov    %eax,%esi
+  80359d:	89 d7                	mov    %edx,%edi
+  80359f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8035a3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8035a7:	0f ad d0             	shrd   %cl,%edx,%eax
+  8035aa:	d3 ea                	shr    %cl,%edx
+  8035ac:	f6 c1 20             	test   $0x20,%cl
+  8035af:	74 04                	je     8035b5 <dm+0x6e>
+  8035b1:	89 d0                	mov    %edx,%eax
+  8035b3:	31 d2                	xor    %edx,%edx
+  8035b5:	83 e0 01             	and    $0x1,%eax
+  8035b8:	89 04 24             	mov    %eax,(%esp)
+  8035bb:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8035c2:	00 
+  8035c3:	8b 04 24             	mov    (%esp),%eax
+  8035c6:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8035ca:	09 f0                	or     %esi,%eax
+  8035cc:	09 fa                	or     %edi,%edx
+  8035ce:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8035d2:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8035d6:	39 f0                	cmp    %esi,%eax
+  8035d8:	89 d5                	mov    %edx,%ebp
+  8035da:	19 fd                	sbb    %edi,%ebp
+  8035dc:	72 af                	jb     80358d <dm+0x46>
+  8035de:	29 f0                	sub    %esi,%eax
+  8035e0:	19 fa                	sbb    %edi,%edx
+  8035e2:	89 cf                	mov    %ecx,%edi
+  8035e4:	c1 ef 05             	shr    $0x5,%edi
+  8035e7:	83 e7 01             	and    $0x1,%edi
+  8035ea:	89 fe                	mov    %edi,%esi
+  8035ec:	83 f6 01             	xor    $0x1,%esi
+  8035ef:	d3 e6                	shl    %cl,%esi
+  8035f1:	d3 e7                	shl    %cl,%edi
+  8035f3:	09 74 24 18          	or     %esi,0x18(%esp)
+  8035f7:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8035fb:	eb 90                	jmp    80358d <dm+0x46>
+  8035fd:	85 db                	test   %ebx,%ebx
+  8035ff:	74 05                	je     803606 <dm+0xbf>
+  803601:	89 03                	mov    %eax,(%ebx)
+  803603:	89 53 04             	mov    %edx,0x4(%ebx)
+  803606:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80360a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80360e:	83 c4 24             	add    $0x24,%esp
+  803611:	5b                   	pop    %ebx
+  803612:	5e                   	pop    %esi
+  803613:	5f                   	pop    %edi
+  803614:	5d                   	pop    %ebp
+  803615:	c3                   	ret
+
+00803616 <__udivdi3>:
+  803616:	83 ec 08             	sub    $0x8,%esp
+  803619:	6a 00                	push   $0x0
+  80361b:	ff 74 24 1c          	push   0x1c(%esp)
+  80361f:	ff 74 24 1c          	push   0x1c(%esp)
+  803623:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803627:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80362b:	e8 17 ff ff ff       	call   803547 <dm>
+  803630:	83 c4 14             	add    $0x14,%esp
+  803633:	c3                   	ret
+
+00803634 <__umoddi3>:
+  803634:	83 ec 18             	sub    $0x18,%esp
+  803637:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80363b:	50                   	push   %eax
+  80363c:	ff 74 24 2c          	push   0x2c(%esp)
+  803640:	ff 74 24 2c          	push   0x2c(%esp)
+  803644:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803648:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80364c:	e8 f6 fe ff ff       	call   803547 <dm>
+  803651:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803655:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803659:	83 c4 24             	add    $0x24,%esp
+  80365c:	c3                   	ret
+
+0080365d <__divdi3>:
+  80365d:	53                   	push   %ebx
+  80365e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803662:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803666:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80366a:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80366e:	85 d2                	test   %edx,%edx
+  803670:	78 15                	js     803687 <__divdi3+0x2a>
+  803672:	85 db                	test   %ebx,%ebx
+  803674:	78 34                	js     8036aa <__divdi3+0x4d>
+  803676:	83 ec 04             	sub    $0x4,%esp
+  803679:	6a 00                	push   $0x0
+  80367b:	53                   	push   %ebx
+  80367c:	51                   	push   %ecx
+  80367d:	e8 c5 fe ff ff       	call   803547 <dm>
+  803682:	83 c4 10             	add    $0x10,%esp
+  803685:	eb 21                	jmp    8036a8 <__divdi3+0x4b>
+  803687:	f7 d8                	neg    %eax
+  803689:	83 d2 00             	adc    $0x0,%edx
+  80368c:	f7 da                	neg    %edx
+  80368e:	85 db                	test   %ebx,%ebx
+  803690:	78 30                	js     8036c2 <__divdi3+0x65>
+  803692:	83 ec 04             	sub    $0x4,%esp
+  803695:	6a 00                	push   $0x0
+  803697:	53                   	push   %ebx
+  803698:	51                   	push   %ecx
+  803699:	e8 a9 fe ff ff       	call   803547 <dm>
+  80369e:	83 c4 10             	add    $0x10,%esp
+  8036a1:	f7 d8                	neg    %eax
+  8036a3:	83 d2 00             	adc    $0x0,%edx
+  8036a6:	f7 da                	neg    %edx
+  8036a8:	5b                   	pop    %ebx
+  8036a9:	c3                   	ret
+  8036aa:	83 ec 04             	sub    $0x4,%esp
+  8036ad:	6a 00                	push   $0x0
+  8036af:	f7 d9                	neg    %ecx
+  8036b1:	83 d3 00             	adc    $0x0,%ebx
+  8036b4:	f7 db                	neg    %ebx
+  8036b6:	53                   	push   %ebx
+  8036b7:	51                   	push   %ecx
+  8036b8:	e8 8a fe ff ff       	call   803547 <dm>
+  8036bd:	83 c4 10             	add    $0x10,%esp
+  8036c0:	eb df                	jmp    8036a1 <__divdi3+0x44>
+  8036c2:	83 ec 04             	sub    $0x4,%esp
+  8036c5:	6a 00                	push   $0x0
+  8036c7:	f7 d9                	neg    %ecx
+  8036c9:	83 d3 00             	adc    $0x0,%ebx
+  8036cc:	f7 db                	neg    %ebx
+  8036ce:	53                   	push   %ebx
+  8036cf:	51                   	push   %ecx
+  8036d0:	e8 72 fe ff ff       	call   803547 <dm>
+  8036d5:	83 c4 10             	add    $0x10,%esp
+  8036d8:	eb ce                	jmp    8036a8 <__divdi3+0x4b>
+
+008036da <__moddi3>:
+  8036da:	55                   	push   %ebp
+  8036db:	57                   	push   %edi
+  8036dc:	56                   	push   %esi
+  8036dd:	53                   	push   %ebx
+  8036de:	83 ec 24             	sub    $0x24,%esp
+  8036e1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036e5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036e9:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036ed:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036f1:	85 d2                	test   %edx,%edx
+  8036f3:	78 3b                	js     803730 <__moddi3+0x56>
+  8036f5:	83 ec 04             	sub    $0x4,%esp
+  8036f8:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036fc:	56                   	push   %esi
+  8036fd:	89 ce                	mov    %ecx,%esi
+  8036ff:	f7 de                	neg    %esi
+  803701:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803705:	89 de                	mov    %ebx,%esi
+  803707:	83 d6 00             	adc    $0x0,%esi
+  80370a:	f7 de                	neg    %esi
+  80370c:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803710:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803714:	0f 48 f1             	cmovs  %ecx,%esi
+  803717:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80371c:	53                   	push   %ebx
+  80371d:	56                   	push   %esi
+  80371e:	e8 24 fe ff ff       	call   803547 <dm>
+  803723:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803727:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80372b:	83 c4 10             	add    $0x10,%esp
+  80372e:	eb 47                	jmp    803777 <__moddi3+0x9d>
+  803730:	f7 d8                	neg    %eax
+  803732:	83 d2 00             	adc    $0x0,%edx
+  803735:	f7 da                	neg    %edx
+  803737:	83 ec 04             	sub    $0x4,%esp
+  80373a:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80373e:	56                   	push   %esi
+  80373f:	89 cf                	mov    %ecx,%edi
+  803741:	f7 df                	neg    %edi
+  803743:	89 de                	mov    %ebx,%esi
+  803745:	83 d6 00             	adc    $0x0,%esi
+  803748:	f7 de                	neg    %esi
+  80374a:	0f 49 cf             	cmovns %edi,%ecx
+  80374d:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803751:	0f 49 de             	cmovns %esi,%ebx
+  803754:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803758:	ff 74 24 0c          	push   0xc(%esp)
+  80375c:	ff 74 24 0c          	push   0xc(%esp)
+  803760:	e8 e2 fd ff ff       	call   803547 <dm>
+  803765:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803769:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80376d:	f7 d8                	neg    %eax
+  80376f:	83 d2 00             	adc    $0x0,%edx
+  803772:	f7 da                	neg    %edx
+  803774:	83 c4 10             	add    $0x10,%esp
+  803777:	83 c4 24             	add    $0x24,%esp
+  80377a:	5b                   	pop    %ebx
+  80377b:	5e                   	pop    %esi
+  80377c:	5f                   	pop    %edi
+  80377d:	5d                   	pop    %ebp
+  80377e:	c3                   	ret
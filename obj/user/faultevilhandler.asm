@@ -0,0 +1,7637 @@
+
+obj/user/faultevilhandler.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 34 00 00 00       	call   800065 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+	sys_page_alloc(0, (void*) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W);
+  800039:	6a 07                	push   $0x7
+  80003b:	68 00 f0 bf ee       	push   $0xeebff000
+  800040:	6a 00                	push   $0x0
+  800042:	e8 5d 01 00 00       	call   8001a4 <sys_page_alloc>
+	sys_env_set_pgfault_upcall(0, (void*) 0xF0100020);
+  800047:	83 c4 08             	add    $0x8,%esp
+  80004a:	68 20 00 10 f0       	push   $0xf0100020
+  80004f:	6a 00                	push   $0x0
+  800051:	e8 b9 02 00 00       	call   80030f <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800056:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80005d:	00 00 00 
+}
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	c9                   	leave
+  800064:	c3                   	ret
+
+00800065 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800065:	55                   	push   %ebp
+  800066:	89 e5                	mov    %esp,%ebp
+  800068:	56                   	push   %esi
+  800069:	53                   	push   %ebx
+  80006a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80006d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800070:	e8 e9 00 00 00       	call   80015e <sys_getenvid>
+  800075:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007a:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800080:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800085:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80008a:	85 db                	test   %ebx,%ebx
+  80008c:	7e 07                	jle    800095 <libmain+0x30>
+		binaryname = argv[0];
+  80008e:	8b 06                	mov    (%esi),%eax
+  800090:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800095:	83 ec 08             	sub    $0x8,%esp
+  800098:	56                   	push   %esi
+  800099:	53                   	push   %ebx
+  80009a:	e8 94 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80009f:	e8 0a 00 00 00       	call   8000ae <exit>
+}
+  8000a4:	83 c4 10             	add    $0x10,%esp
+  8000a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000aa:	5b                   	pop    %ebx
+  8000ab:	5e                   	pop    %esi
+  8000ac:	5d                   	pop    %ebp
+  8000ad:	c3                   	ret
+
+008000ae <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000ae:	55                   	push   %ebp
+  8000af:	89 e5                	mov    %esp,%ebp
+  8000b1:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000b4:	e8 c0 06 00 00       	call   800779 <close_all>
+	sys_env_destroy(0);
+  8000b9:	83 ec 0c             	sub    $0xc,%esp
+  8000bc:	6a 00                	push   $0x0
+  8000be:	e8 52 00 00 00       	call   800115 <sys_env_destroy>
+}
+  8000c3:	83 c4 10             	add    $0x10,%esp
+  8000c6:	c9                   	leave
+  8000c7:	c3                   	ret
+
+008000c8 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000c8:	55                   	push   %ebp
+  8000c9:	89 e5                	mov    %esp,%ebp
+  8000cb:	57                   	push   %edi
+  8000cc:	56                   	push   %esi
+  8000cd:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000d9:	89 c3                	mov    %eax,%ebx
+  8000db:	89 c7                	mov    %eax,%edi
+  8000dd:	55                   	push   %ebp
+  8000de:	89 e5                	mov    %esp,%ebp
+  8000e0:	8d 35 e8 00 80 00    	lea    0x8000e8,%esi
+  8000e6:	0f 34                	sysenter
+  8000e8:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  8000e9:	5b                   	pop    %ebx
+  8000ea:	5e                   	pop    %esi
+  8000eb:	5f                   	pop    %edi
+  8000ec:	5d                   	pop    %ebp
+  8000ed:	c3                   	ret
+
+008000ee <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000ee:	55                   	push   %ebp
+  8000ef:	89 e5                	mov    %esp,%ebp
+  8000f1:	57                   	push   %edi
+  8000f2:	56                   	push   %esi
+  8000f3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000fe:	89 d1                	mov    %edx,%ecx
+  800100:	89 d3                	mov    %edx,%ebx
+  800102:	89 d7                	mov    %edx,%edi
+  800104:	55                   	push   %ebp
+  800105:	89 e5                	mov    %esp,%ebp
+  800107:	8d 35 0f 01 80 00    	lea    0x80010f,%esi
+  80010d:	0f 34                	sysenter
+  80010f:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800110:	5b                   	pop    %ebx
+  800111:	5e                   	pop    %esi
+  800112:	5f                   	pop    %edi
+  800113:	5d                   	pop    %ebp
+  800114:	c3                   	ret
+
+00800115 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800115:	55                   	push   %ebp
+  800116:	89 e5                	mov    %esp,%ebp
+  800118:	57                   	push   %edi
+  800119:	56                   	push   %esi
+  80011a:	53                   	push   %ebx
+  80011b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80011e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800123:	8b 55 08             	mov    0x8(%ebp),%edx
+  800126:	b8 03 00 00 00       	mov    $0x3,%eax
+  80012b:	89 cb                	mov    %ecx,%ebx
+  80012d:	89 cf                	mov    %ecx,%edi
+  80012f:	55                   	push   %ebp
+  800130:	89 e5                	mov    %esp,%ebp
+  800132:	8d 35 3a 01 80 00    	lea    0x80013a,%esi
+  800138:	0f 34                	sysenter
+  80013a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80013b:	85 c0                	test   %eax,%eax
+  80013d:	7f 08                	jg     800147 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  80013f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800142:	5b                   	pop    %ebx
+  800143:	5e                   	pop    %esi
+  800144:	5f                   	pop    %edi
+  800145:	5d                   	pop    %ebp
+  800146:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800147:	83 ec 0c             	sub    $0xc,%esp
+  80014a:	50                   	push   %eax
+  80014b:	6a 03                	push   $0x3
+  80014d:	68 8a 37 80 00       	push   $0x80378a
+  800152:	6a 3d                	push   $0x3d
+  800154:	68 a7 37 80 00       	push   $0x8037a7
+  800159:	e8 02 24 00 00       	call   802560 <_panic>
+
+0080015e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80015e:	55                   	push   %ebp
+  80015f:	89 e5                	mov    %esp,%ebp
+  800161:	57                   	push   %edi
+  800162:	56                   	push   %esi
+  800163:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800164:	ba 00 00 00 00       	mov    $0x0,%edx
+  800169:	b8 02 00 00 00       	mov    $0x2,%eax
+  80016e:	89 d1                	mov    %edx,%ecx
+  800170:	89 d3                	mov    %edx,%ebx
+  800172:	89 d7                	mov    %edx,%edi
+  800174:	55                   	push   %ebp
+  800175:	89 e5                	mov    %esp,%ebp
+  800177:	8d 35 7f 01 80 00    	lea    0x80017f,%esi
+  80017d:	0f 34                	sysenter
+  80017f:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800180:	5b                   	pop    %ebx
+  800181:	5e                   	pop    %esi
+  800182:	5f                   	pop    %edi
+  800183:	5d                   	pop    %ebp
+  800184:	c3                   	ret
+
+00800185 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800185:	55                   	push   %ebp
+  800186:	89 e5                	mov    %esp,%ebp
+  800188:	57                   	push   %edi
+  800189:	56                   	push   %esi
+  80018a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80018b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800190:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800195:	89 d1                	mov    %edx,%ecx
+  800197:	89 d3                	mov    %edx,%ebx
+  800199:	89 d7                	mov    %edx,%edi
+  80019b:	89 d6                	mov    %edx,%esi
+  80019d:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80019f:	5b                   	pop    %ebx
+  8001a0:	5e                   	pop    %esi
+  8001a1:	5f                   	pop    %edi
+  8001a2:	5d                   	pop    %ebp
+  8001a3:	c3                   	ret
+
+008001a4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001a4:	55                   	push   %ebp
+  8001a5:	89 e5                	mov    %esp,%ebp
+  8001a7:	57                   	push   %edi
+  8001a8:	56                   	push   %esi
+  8001a9:	53                   	push   %ebx
+  8001aa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8001ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001b3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001c0:	55                   	push   %ebp
+  8001c1:	89 e5                	mov    %esp,%ebp
+  8001c3:	8d 35 cb 01 80 00    	lea    0x8001cb,%esi
+  8001c9:	0f 34                	sysenter
+  8001cb:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8001cc:	85 c0                	test   %eax,%eax
+  8001ce:	7f 08                	jg     8001d8 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  8001d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d3:	5b                   	pop    %ebx
+  8001d4:	5e                   	pop    %esi
+  8001d5:	5f                   	pop    %edi
+  8001d6:	5d                   	pop    %ebp
+  8001d7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001d8:	83 ec 0c             	sub    $0xc,%esp
+  8001db:	50                   	push   %eax
+  8001dc:	6a 04                	push   $0x4
+  8001de:	68 8a 37 80 00       	push   $0x80378a
+  8001e3:	6a 3d                	push   $0x3d
+  8001e5:	68 a7 37 80 00       	push   $0x8037a7
+  8001ea:	e8 71 23 00 00       	call   802560 <_panic>
+
+008001ef <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001ef:	55                   	push   %ebp
+  8001f0:	89 e5                	mov    %esp,%ebp
+  8001f2:	57                   	push   %edi
+  8001f3:	56                   	push   %esi
+  8001f4:	53                   	push   %ebx
+  8001f5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001fe:	b8 05 00 00 00       	mov    $0x5,%eax
+  800203:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800206:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800209:	8b 75 18             	mov    0x18(%ebp),%esi
+  80020c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80020e:	85 c0                	test   %eax,%eax
+  800210:	7f 08                	jg     80021a <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800212:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800215:	5b                   	pop    %ebx
+  800216:	5e                   	pop    %esi
+  800217:	5f                   	pop    %edi
+  800218:	5d                   	pop    %ebp
+  800219:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80021a:	83 ec 0c             	sub    $0xc,%esp
+  80021d:	50                   	push   %eax
+  80021e:	6a 05                	push   $0x5
+  800220:	68 8a 37 80 00       	push   $0x80378a
+  800225:	6a 23                	push   $0x23
+  800227:	68 a7 37 80 00       	push   $0x8037a7
+  80022c:	e8 2f 23 00 00       	call   802560 <_panic>
+
+00800231 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800231:	55                   	push   %ebp
+  800232:	89 e5                	mov    %esp,%ebp
+  800234:	57                   	push   %edi
+  800235:	56                   	push   %esi
+  800236:	53                   	push   %ebx
+  800237:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80023a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80023f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800242:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800245:	b8 06 00 00 00       	mov    $0x6,%eax
+  80024a:	89 df                	mov    %ebx,%edi
+  80024c:	55                   	push   %ebp
+  80024d:	89 e5                	mov    %esp,%ebp
+  80024f:	8d 35 57 02 80 00    	lea    0x800257,%esi
+  800255:	0f 34                	sysenter
+  800257:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800258:	85 c0                	test   %eax,%eax
+  80025a:	7f 08                	jg     800264 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  80025c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80025f:	5b                   	pop    %ebx
+  800260:	5e                   	pop    %esi
+  800261:	5f                   	pop    %edi
+  800262:	5d                   	pop    %ebp
+  800263:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800264:	83 ec 0c             	sub    $0xc,%esp
+  800267:	50                   	push   %eax
+  800268:	6a 06                	push   $0x6
+  80026a:	68 8a 37 80 00       	push   $0x80378a
+  80026f:	6a 3d                	push   $0x3d
+  800271:	68 a7 37 80 00       	push   $0x8037a7
+  800276:	e8 e5 22 00 00       	call   802560 <_panic>
+
+0080027b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80027b:	55                   	push   %ebp
+  80027c:	89 e5                	mov    %esp,%ebp
+  80027e:	57                   	push   %edi
+  80027f:	56                   	push   %esi
+  800280:	53                   	push   %ebx
+  800281:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800284:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800289:	8b 55 08             	mov    0x8(%ebp),%edx
+  80028c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80028f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800294:	89 df                	mov    %ebx,%edi
+  800296:	55                   	push   %ebp
+  800297:	89 e5                	mov    %esp,%ebp
+  800299:	8d 35 a1 02 80 00    	lea    0x8002a1,%esi
+  80029f:	0f 34                	sysenter
+  8002a1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8002a2:	85 c0                	test   %eax,%eax
+  8002a4:	7f 08                	jg     8002ae <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  8002a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a9:	5b                   	pop    %ebx
+  8002aa:	5e                   	pop    %esi
+  8002ab:	5f                   	pop    %edi
+  8002ac:	5d                   	pop    %ebp
+  8002ad:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002ae:	83 ec 0c             	sub    $0xc,%esp
+  8002b1:	50                   	push   %eax
+  8002b2:	6a 08                	push   $0x8
+  8002b4:	68 8a 37 80 00       	push   $0x80378a
+  8002b9:	6a 3d                	push   $0x3d
+  8002bb:	68 a7 37 80 00       	push   $0x8037a7
+  8002c0:	e8 9b 22 00 00       	call   802560 <_panic>
+
+008002c5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	57                   	push   %edi
+  8002c9:	56                   	push   %esi
+  8002ca:	53                   	push   %ebx
+  8002cb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8002ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002d9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002de:	89 df                	mov    %ebx,%edi
+  8002e0:	55                   	push   %ebp
+  8002e1:	89 e5                	mov    %esp,%ebp
+  8002e3:	8d 35 eb 02 80 00    	lea    0x8002eb,%esi
+  8002e9:	0f 34                	sysenter
+  8002eb:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8002ec:	85 c0                	test   %eax,%eax
+  8002ee:	7f 08                	jg     8002f8 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  8002f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f3:	5b                   	pop    %ebx
+  8002f4:	5e                   	pop    %esi
+  8002f5:	5f                   	pop    %edi
+  8002f6:	5d                   	pop    %ebp
+  8002f7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002f8:	83 ec 0c             	sub    $0xc,%esp
+  8002fb:	50                   	push   %eax
+  8002fc:	6a 09                	push   $0x9
+  8002fe:	68 8a 37 80 00       	push   $0x80378a
+  800303:	6a 3d                	push   $0x3d
+  800305:	68 a7 37 80 00       	push   $0x8037a7
+  80030a:	e8 51 22 00 00       	call   802560 <_panic>
+
+0080030f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80030f:	55                   	push   %ebp
+  800310:	89 e5                	mov    %esp,%ebp
+  800312:	57                   	push   %edi
+  800313:	56                   	push   %esi
+  800314:	53                   	push   %ebx
+  800315:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800318:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80031d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800320:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800323:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800328:	89 df                	mov    %ebx,%edi
+  80032a:	55                   	push   %ebp
+  80032b:	89 e5                	mov    %esp,%ebp
+  80032d:	8d 35 35 03 80 00    	lea    0x800335,%esi
+  800333:	0f 34                	sysenter
+  800335:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800336:	85 c0                	test   %eax,%eax
+  800338:	7f 08                	jg     800342 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  80033a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033d:	5b                   	pop    %ebx
+  80033e:	5e                   	pop    %esi
+  80033f:	5f                   	pop    %edi
+  800340:	5d                   	pop    %ebp
+  800341:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800342:	83 ec 0c             	sub    $0xc,%esp
+  800345:	50                   	push   %eax
+  800346:	6a 0a                	push   $0xa
+  800348:	68 8a 37 80 00       	push   $0x80378a
+  80034d:	6a 3d                	push   $0x3d
+  80034f:	68 a7 37 80 00       	push   $0x8037a7
+  800354:	e8 07 22 00 00       	call   802560 <_panic>
+
+00800359 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800359:	55                   	push   %ebp
+  80035a:	89 e5                	mov    %esp,%ebp
+  80035c:	57                   	push   %edi
+  80035d:	56                   	push   %esi
+  80035e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80035f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800362:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800365:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80036a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80036d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800370:	55                   	push   %ebp
+  800371:	89 e5                	mov    %esp,%ebp
+  800373:	8d 35 7b 03 80 00    	lea    0x80037b,%esi
+  800379:	0f 34                	sysenter
+  80037b:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  80037c:	5b                   	pop    %ebx
+  80037d:	5e                   	pop    %esi
+  80037e:	5f                   	pop    %edi
+  80037f:	5d                   	pop    %ebp
+  800380:	c3                   	ret
+
+00800381 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800381:	55                   	push   %ebp
+  800382:	89 e5                	mov    %esp,%ebp
+  800384:	57                   	push   %edi
+  800385:	56                   	push   %esi
+  800386:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800387:	8b 55 08             	mov    0x8(%ebp),%edx
+  80038a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80038d:	b8 17 00 00 00       	mov    $0x17,%eax
+  800392:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800395:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800398:	55                   	push   %ebp
+  800399:	89 e5                	mov    %esp,%ebp
+  80039b:	8d 35 a3 03 80 00    	lea    0x8003a3,%esi
+  8003a1:	0f 34                	sysenter
+  8003a3:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  8003a4:	5b                   	pop    %ebx
+  8003a5:	5e                   	pop    %esi
+  8003a6:	5f                   	pop    %edi
+  8003a7:	5d                   	pop    %ebp
+  8003a8:	c3                   	ret
+
+008003a9 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  8003a9:	55                   	push   %ebp
+  8003aa:	89 e5                	mov    %esp,%ebp
+  8003ac:	57                   	push   %edi
+  8003ad:	56                   	push   %esi
+  8003ae:	53                   	push   %ebx
+  8003af:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8003b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003bd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003c5:	89 f7                	mov    %esi,%edi
+  8003c7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003c9:	85 c0                	test   %eax,%eax
+  8003cb:	7f 08                	jg     8003d5 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8003cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d0:	5b                   	pop    %ebx
+  8003d1:	5e                   	pop    %esi
+  8003d2:	5f                   	pop    %edi
+  8003d3:	5d                   	pop    %ebp
+  8003d4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003d5:	83 ec 0c             	sub    $0xc,%esp
+  8003d8:	50                   	push   %eax
+  8003d9:	6a 0d                	push   $0xd
+  8003db:	68 8a 37 80 00       	push   $0x80378a
+  8003e0:	6a 23                	push   $0x23
+  8003e2:	68 a7 37 80 00       	push   $0x8037a7
+  8003e7:	e8 74 21 00 00       	call   802560 <_panic>
+
+008003ec <sys_ipc_recv>:
+{
+  8003ec:	55                   	push   %ebp
+  8003ed:	89 e5                	mov    %esp,%ebp
+  8003ef:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  8003f2:	6a 00                	push   $0x0
+  8003f4:	6a 01                	push   $0x1
+  8003f6:	ff 75 08             	push   0x8(%ebp)
+  8003f9:	e8 ab ff ff ff       	call   8003a9 <sys_ipc_recvv>
+}
+  8003fe:	c9                   	leave
+  8003ff:	c3                   	ret
+
+00800400 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800400:	55                   	push   %ebp
+  800401:	89 e5                	mov    %esp,%ebp
+  800403:	57                   	push   %edi
+  800404:	56                   	push   %esi
+  800405:	53                   	push   %ebx
+  800406:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800409:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80040e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800411:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800414:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800419:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80041c:	89 de                	mov    %ebx,%esi
+  80041e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800420:	85 c0                	test   %eax,%eax
+  800422:	7f 08                	jg     80042c <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800424:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800427:	5b                   	pop    %ebx
+  800428:	5e                   	pop    %esi
+  800429:	5f                   	pop    %edi
+  80042a:	5d                   	pop    %ebp
+  80042b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80042c:	83 ec 0c             	sub    $0xc,%esp
+  80042f:	50                   	push   %eax
+  800430:	6a 0d                	push   $0xd
+  800432:	68 8a 37 80 00       	push   $0x80378a
+  800437:	6a 23                	push   $0x23
+  800439:	68 a7 37 80 00       	push   $0x8037a7
+  80043e:	e8 1d 21 00 00       	call   802560 <_panic>
+
+00800443 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800443:	55                   	push   %ebp
+  800444:	89 e5                	mov    %esp,%ebp
+  800446:	57                   	push   %edi
+  800447:	56                   	push   %esi
+  800448:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800449:	ba 00 00 00 00       	mov    $0x0,%edx
+  80044e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800453:	89 d1                	mov    %edx,%ecx
+  800455:	89 d3                	mov    %edx,%ebx
+  800457:	89 d7                	mov    %edx,%edi
+  800459:	55                   	push   %ebp
+  80045a:	89 e5                	mov    %esp,%ebp
+  80045c:	8d 35 64 04 80 00    	lea    0x800464,%esi
+  800462:	0f 34                	sysenter
+  800464:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800465:	5b                   	pop    %ebx
+  800466:	5e                   	pop    %esi
+  800467:	5f                   	pop    %edi
+  800468:	5d                   	pop    %ebp
+  800469:	c3                   	ret
+
+0080046a <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  80046a:	55                   	push   %ebp
+  80046b:	89 e5                	mov    %esp,%ebp
+  80046d:	57                   	push   %edi
+  80046e:	56                   	push   %esi
+  80046f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800470:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800475:	8b 55 08             	mov    0x8(%ebp),%edx
+  800478:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80047b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800480:	89 df                	mov    %ebx,%edi
+  800482:	55                   	push   %ebp
+  800483:	89 e5                	mov    %esp,%ebp
+  800485:	8d 35 8d 04 80 00    	lea    0x80048d,%esi
+  80048b:	0f 34                	sysenter
+  80048d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  80048e:	5b                   	pop    %ebx
+  80048f:	5e                   	pop    %esi
+  800490:	5f                   	pop    %edi
+  800491:	5d                   	pop    %ebp
+  800492:	c3                   	ret
+
+00800493 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800493:	55                   	push   %ebp
+  800494:	89 e5                	mov    %esp,%ebp
+  800496:	57                   	push   %edi
+  800497:	56                   	push   %esi
+  800498:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800499:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80049e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8004a6:	89 cb                	mov    %ecx,%ebx
+  8004a8:	89 cf                	mov    %ecx,%edi
+  8004aa:	55                   	push   %ebp
+  8004ab:	89 e5                	mov    %esp,%ebp
+  8004ad:	8d 35 b5 04 80 00    	lea    0x8004b5,%esi
+  8004b3:	0f 34                	sysenter
+  8004b5:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  8004b6:	5b                   	pop    %ebx
+  8004b7:	5e                   	pop    %esi
+  8004b8:	5f                   	pop    %edi
+  8004b9:	5d                   	pop    %ebp
+  8004ba:	c3                   	ret
+
+008004bb <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  8004bb:	55                   	push   %ebp
+  8004bc:	89 e5                	mov    %esp,%ebp
+  8004be:	57                   	push   %edi
+  8004bf:	56                   	push   %esi
+  8004c0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004cc:	b8 12 00 00 00       	mov    $0x12,%eax
+  8004d1:	89 df                	mov    %ebx,%edi
+  8004d3:	55                   	push   %ebp
+  8004d4:	89 e5                	mov    %esp,%ebp
+  8004d6:	8d 35 de 04 80 00    	lea    0x8004de,%esi
+  8004dc:	0f 34                	sysenter
+  8004de:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8004df:	5b                   	pop    %ebx
+  8004e0:	5e                   	pop    %esi
+  8004e1:	5f                   	pop    %edi
+  8004e2:	5d                   	pop    %ebp
+  8004e3:	c3                   	ret
+
+008004e4 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8004e4:	55                   	push   %ebp
+  8004e5:	89 e5                	mov    %esp,%ebp
+  8004e7:	57                   	push   %edi
+  8004e8:	56                   	push   %esi
+  8004e9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004f5:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004fa:	89 df                	mov    %ebx,%edi
+  8004fc:	55                   	push   %ebp
+  8004fd:	89 e5                	mov    %esp,%ebp
+  8004ff:	8d 35 07 05 80 00    	lea    0x800507,%esi
+  800505:	0f 34                	sysenter
+  800507:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800508:	5b                   	pop    %ebx
+  800509:	5e                   	pop    %esi
+  80050a:	5f                   	pop    %edi
+  80050b:	5d                   	pop    %ebp
+  80050c:	c3                   	ret
+
+0080050d <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  80050d:	55                   	push   %ebp
+  80050e:	89 e5                	mov    %esp,%ebp
+  800510:	57                   	push   %edi
+  800511:	56                   	push   %esi
+  800512:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800513:	8b 55 08             	mov    0x8(%ebp),%edx
+  800516:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800519:	b8 13 00 00 00       	mov    $0x13,%eax
+  80051e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800521:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800524:	55                   	push   %ebp
+  800525:	89 e5                	mov    %esp,%ebp
+  800527:	8d 35 2f 05 80 00    	lea    0x80052f,%esi
+  80052d:	0f 34                	sysenter
+  80052f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800530:	5b                   	pop    %ebx
+  800531:	5e                   	pop    %esi
+  800532:	5f                   	pop    %edi
+  800533:	5d                   	pop    %ebp
+  800534:	c3                   	ret
+
+00800535 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800535:	55                   	push   %ebp
+  800536:	89 e5                	mov    %esp,%ebp
+  800538:	57                   	push   %edi
+  800539:	56                   	push   %esi
+  80053a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80053b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800540:	8b 55 08             	mov    0x8(%ebp),%edx
+  800543:	b8 11 00 00 00       	mov    $0x11,%eax
+  800548:	89 cb                	mov    %ecx,%ebx
+  80054a:	89 cf                	mov    %ecx,%edi
+  80054c:	89 ce                	mov    %ecx,%esi
+  80054e:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800550:	5b                   	pop    %ebx
+  800551:	5e                   	pop    %esi
+  800552:	5f                   	pop    %edi
+  800553:	5d                   	pop    %ebp
+  800554:	c3                   	ret
+
+00800555 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800555:	55                   	push   %ebp
+  800556:	89 e5                	mov    %esp,%ebp
+  800558:	57                   	push   %edi
+  800559:	56                   	push   %esi
+  80055a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80055b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800560:	8b 55 08             	mov    0x8(%ebp),%edx
+  800563:	b8 15 00 00 00       	mov    $0x15,%eax
+  800568:	89 cb                	mov    %ecx,%ebx
+  80056a:	89 cf                	mov    %ecx,%edi
+  80056c:	55                   	push   %ebp
+  80056d:	89 e5                	mov    %esp,%ebp
+  80056f:	8d 35 77 05 80 00    	lea    0x800577,%esi
+  800575:	0f 34                	sysenter
+  800577:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800578:	5b                   	pop    %ebx
+  800579:	5e                   	pop    %esi
+  80057a:	5f                   	pop    %edi
+  80057b:	5d                   	pop    %ebp
+  80057c:	c3                   	ret
+
+0080057d <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  80057d:	55                   	push   %ebp
+  80057e:	89 e5                	mov    %esp,%ebp
+  800580:	57                   	push   %edi
+  800581:	56                   	push   %esi
+  800582:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800583:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800588:	8b 55 08             	mov    0x8(%ebp),%edx
+  80058b:	b8 16 00 00 00       	mov    $0x16,%eax
+  800590:	89 cb                	mov    %ecx,%ebx
+  800592:	89 cf                	mov    %ecx,%edi
+  800594:	55                   	push   %ebp
+  800595:	89 e5                	mov    %esp,%ebp
+  800597:	8d 35 9f 05 80 00    	lea    0x80059f,%esi
+  80059d:	0f 34                	sysenter
+  80059f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8005a0:	5b                   	pop    %ebx
+  8005a1:	5e                   	pop    %esi
+  8005a2:	5f                   	pop    %edi
+  8005a3:	5d                   	pop    %ebp
+  8005a4:	c3                   	ret
+
+008005a5 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8005a5:	55                   	push   %ebp
+  8005a6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8005a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005ab:	05 00 00 00 30       	add    $0x30000000,%eax
+  8005b0:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8005b3:	5d                   	pop    %ebp
+  8005b4:	c3                   	ret
+
+008005b5 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8005b5:	55                   	push   %ebp
+  8005b6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8005b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005bb:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8005c0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8005c5:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8005ca:	5d                   	pop    %ebp
+  8005cb:	c3                   	ret
+
+008005cc <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8005cc:	55                   	push   %ebp
+  8005cd:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8005cf:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8005d4:	eb 02                	jmp    8005d8 <fd_alloc+0xc>
+  8005d6:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8005d8:	89 c2                	mov    %eax,%edx
+  8005da:	c1 ea 16             	shr    $0x16,%edx
+  8005dd:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8005e4:	f6 c2 01             	test   $0x1,%dl
+  8005e7:	74 2b                	je     800614 <fd_alloc+0x48>
+  8005e9:	89 c2                	mov    %eax,%edx
+  8005eb:	c1 ea 0c             	shr    $0xc,%edx
+  8005ee:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8005f5:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8005fb:	f6 c1 01             	test   $0x1,%cl
+  8005fe:	74 14                	je     800614 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800600:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800606:	75 ce                	jne    8005d6 <fd_alloc+0xa>
+  800608:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80060d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800612:	eb 05                	jmp    800619 <fd_alloc+0x4d>
+			return 0;
+  800614:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800619:	8b 55 08             	mov    0x8(%ebp),%edx
+  80061c:	89 02                	mov    %eax,(%edx)
+}
+  80061e:	89 c8                	mov    %ecx,%eax
+  800620:	5d                   	pop    %ebp
+  800621:	c3                   	ret
+
+00800622 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800622:	55                   	push   %ebp
+  800623:	89 e5                	mov    %esp,%ebp
+  800625:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800628:	83 f8 1f             	cmp    $0x1f,%eax
+  80062b:	77 30                	ja     80065d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80062d:	c1 e0 0c             	shl    $0xc,%eax
+  800630:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800635:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80063b:	f6 c2 01             	test   $0x1,%dl
+  80063e:	74 24                	je     800664 <fd_lookup+0x42>
+  800640:	89 c2                	mov    %eax,%edx
+  800642:	c1 ea 0c             	shr    $0xc,%edx
+  800645:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80064c:	f6 c2 01             	test   $0x1,%dl
+  80064f:	74 1a                	je     80066b <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800651:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800654:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800656:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80065b:	5d                   	pop    %ebp
+  80065c:	c3                   	ret
+		return -E_INVAL;
+  80065d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800662:	eb f7                	jmp    80065b <fd_lookup+0x39>
+		return -E_INVAL;
+  800664:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800669:	eb f0                	jmp    80065b <fd_lookup+0x39>
+  80066b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800670:	eb e9                	jmp    80065b <fd_lookup+0x39>
+
+00800672 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800672:	55                   	push   %ebp
+  800673:	89 e5                	mov    %esp,%ebp
+  800675:	53                   	push   %ebx
+  800676:	83 ec 04             	sub    $0x4,%esp
+  800679:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80067c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800681:	eb 03                	jmp    800686 <dev_lookup+0x14>
+  800683:	83 c0 01             	add    $0x1,%eax
+  800686:	8b 1c 85 34 38 80 00 	mov    0x803834(,%eax,4),%ebx
+  80068d:	85 db                	test   %ebx,%ebx
+  80068f:	74 0b                	je     80069c <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800691:	39 13                	cmp    %edx,(%ebx)
+  800693:	75 ee                	jne    800683 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800695:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069a:	eb 1f                	jmp    8006bb <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80069c:	a1 00 50 80 00       	mov    0x805000,%eax
+  8006a1:	8b 40 48             	mov    0x48(%eax),%eax
+  8006a4:	83 ec 04             	sub    $0x4,%esp
+  8006a7:	52                   	push   %edx
+  8006a8:	50                   	push   %eax
+  8006a9:	68 b8 37 80 00       	push   $0x8037b8
+  8006ae:	e8 88 1f 00 00       	call   80263b <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8006b3:	83 c4 10             	add    $0x10,%esp
+  8006b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8006bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006be:	89 1a                	mov    %ebx,(%edx)
+}
+  8006c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006c3:	c9                   	leave
+  8006c4:	c3                   	ret
+
+008006c5 <fd_close>:
+{
+  8006c5:	55                   	push   %ebp
+  8006c6:	89 e5                	mov    %esp,%ebp
+  8006c8:	57                   	push   %edi
+  8006c9:	56                   	push   %esi
+  8006ca:	53                   	push   %ebx
+  8006cb:	83 ec 24             	sub    $0x24,%esp
+  8006ce:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006d1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006d4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8006d7:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8006d8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8006de:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006e1:	50                   	push   %eax
+  8006e2:	e8 3b ff ff ff       	call   800622 <fd_lookup>
+  8006e7:	89 c3                	mov    %eax,%ebx
+  8006e9:	83 c4 10             	add    $0x10,%esp
+  8006ec:	85 c0                	test   %eax,%eax
+  8006ee:	78 05                	js     8006f5 <fd_close+0x30>
+	    || fd != fd2)
+  8006f0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8006f3:	74 16                	je     80070b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8006f5:	89 f8                	mov    %edi,%eax
+  8006f7:	84 c0                	test   %al,%al
+  8006f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006fe:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800701:	89 d8                	mov    %ebx,%eax
+  800703:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800706:	5b                   	pop    %ebx
+  800707:	5e                   	pop    %esi
+  800708:	5f                   	pop    %edi
+  800709:	5d                   	pop    %ebp
+  80070a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80070b:	83 ec 08             	sub    $0x8,%esp
+  80070e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800711:	50                   	push   %eax
+  800712:	ff 36                	push   (%esi)
+  800714:	e8 59 ff ff ff       	call   800672 <dev_lookup>
+  800719:	89 c3                	mov    %eax,%ebx
+  80071b:	83 c4 10             	add    $0x10,%esp
+  80071e:	85 c0                	test   %eax,%eax
+  800720:	78 1a                	js     80073c <fd_close+0x77>
+		if (dev->dev_close)
+  800722:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800725:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800728:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80072d:	85 c0                	test   %eax,%eax
+  80072f:	74 0b                	je     80073c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800731:	83 ec 0c             	sub    $0xc,%esp
+  800734:	56                   	push   %esi
+  800735:	ff d0                	call   *%eax
+  800737:	89 c3                	mov    %eax,%ebx
+  800739:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80073c:	83 ec 08             	sub    $0x8,%esp
+  80073f:	56                   	push   %esi
+  800740:	6a 00                	push   $0x0
+  800742:	e8 ea fa ff ff       	call   800231 <sys_page_unmap>
+	return r;
+  800747:	83 c4 10             	add    $0x10,%esp
+  80074a:	eb b5                	jmp    800701 <fd_close+0x3c>
+
+0080074c <close>:
+
+int
+close(int fdnum)
+{
+  80074c:	55                   	push   %ebp
+  80074d:	89 e5                	mov    %esp,%ebp
+  80074f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800752:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800755:	50                   	push   %eax
+  800756:	ff 75 08             	push   0x8(%ebp)
+  800759:	e8 c4 fe ff ff       	call   800622 <fd_lookup>
+  80075e:	83 c4 10             	add    $0x10,%esp
+  800761:	85 c0                	test   %eax,%eax
+  800763:	79 02                	jns    800767 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800765:	c9                   	leave
+  800766:	c3                   	ret
+		return fd_close(fd, 1);
+  800767:	83 ec 08             	sub    $0x8,%esp
+  80076a:	6a 01                	push   $0x1
+  80076c:	ff 75 f4             	push   -0xc(%ebp)
+  80076f:	e8 51 ff ff ff       	call   8006c5 <fd_close>
+  800774:	83 c4 10             	add    $0x10,%esp
+  800777:	eb ec                	jmp    800765 <close+0x19>
+
+00800779 <close_all>:
+
+void
+close_all(void)
+{
+  800779:	55                   	push   %ebp
+  80077a:	89 e5                	mov    %esp,%ebp
+  80077c:	53                   	push   %ebx
+  80077d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800780:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800785:	83 ec 0c             	sub    $0xc,%esp
+  800788:	53                   	push   %ebx
+  800789:	e8 be ff ff ff       	call   80074c <close>
+	for (i = 0; i < MAXFD; i++)
+  80078e:	83 c3 01             	add    $0x1,%ebx
+  800791:	83 c4 10             	add    $0x10,%esp
+  800794:	83 fb 20             	cmp    $0x20,%ebx
+  800797:	75 ec                	jne    800785 <close_all+0xc>
+}
+  800799:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80079c:	c9                   	leave
+  80079d:	c3                   	ret
+
+0080079e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80079e:	55                   	push   %ebp
+  80079f:	89 e5                	mov    %esp,%ebp
+  8007a1:	57                   	push   %edi
+  8007a2:	56                   	push   %esi
+  8007a3:	53                   	push   %ebx
+  8007a4:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8007a7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8007aa:	50                   	push   %eax
+  8007ab:	ff 75 08             	push   0x8(%ebp)
+  8007ae:	e8 6f fe ff ff       	call   800622 <fd_lookup>
+  8007b3:	89 c3                	mov    %eax,%ebx
+  8007b5:	83 c4 10             	add    $0x10,%esp
+  8007b8:	85 c0                	test   %eax,%eax
+  8007ba:	78 7f                	js     80083b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8007bc:	83 ec 0c             	sub    $0xc,%esp
+  8007bf:	ff 75 0c             	push   0xc(%ebp)
+  8007c2:	e8 85 ff ff ff       	call   80074c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8007c7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8007ca:	c1 e6 0c             	shl    $0xc,%esi
+  8007cd:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8007d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8007d6:	89 3c 24             	mov    %edi,(%esp)
+  8007d9:	e8 d7 fd ff ff       	call   8005b5 <fd2data>
+  8007de:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8007e0:	89 34 24             	mov    %esi,(%esp)
+  8007e3:	e8 cd fd ff ff       	call   8005b5 <fd2data>
+  8007e8:	83 c4 10             	add    $0x10,%esp
+  8007eb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8007ee:	89 d8                	mov    %ebx,%eax
+  8007f0:	c1 e8 16             	shr    $0x16,%eax
+  8007f3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8007fa:	a8 01                	test   $0x1,%al
+  8007fc:	74 11                	je     80080f <dup+0x71>
+  8007fe:	89 d8                	mov    %ebx,%eax
+  800800:	c1 e8 0c             	shr    $0xc,%eax
+  800803:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80080a:	f6 c2 01             	test   $0x1,%dl
+  80080d:	75 36                	jne    800845 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80080f:	89 f8                	mov    %edi,%eax
+  800811:	c1 e8 0c             	shr    $0xc,%eax
+  800814:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80081b:	83 ec 0c             	sub    $0xc,%esp
+  80081e:	25 07 0e 00 00       	and    $0xe07,%eax
+  800823:	50                   	push   %eax
+  800824:	56                   	push   %esi
+  800825:	6a 00                	push   $0x0
+  800827:	57                   	push   %edi
+  800828:	6a 00                	push   $0x0
+  80082a:	e8 c0 f9 ff ff       	call   8001ef <sys_page_map>
+  80082f:	89 c3                	mov    %eax,%ebx
+  800831:	83 c4 20             	add    $0x20,%esp
+  800834:	85 c0                	test   %eax,%eax
+  800836:	78 33                	js     80086b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800838:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80083b:	89 d8                	mov    %ebx,%eax
+  80083d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800840:	5b                   	pop    %ebx
+  800841:	5e                   	pop    %esi
+  800842:	5f                   	pop    %edi
+  800843:	5d                   	pop    %ebp
+  800844:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800845:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80084c:	83 ec 0c             	sub    $0xc,%esp
+  80084f:	25 07 0e 00 00       	and    $0xe07,%eax
+  800854:	50                   	push   %eax
+  800855:	ff 75 d4             	push   -0x2c(%ebp)
+  800858:	6a 00                	push   $0x0
+  80085a:	53                   	push   %ebx
+  80085b:	6a 00                	push   $0x0
+  80085d:	e8 8d f9 ff ff       	call   8001ef <sys_page_map>
+  800862:	89 c3                	mov    %eax,%ebx
+  800864:	83 c4 20             	add    $0x20,%esp
+  800867:	85 c0                	test   %eax,%eax
+  800869:	79 a4                	jns    80080f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80086b:	83 ec 08             	sub    $0x8,%esp
+  80086e:	56                   	push   %esi
+  80086f:	6a 00                	push   $0x0
+  800871:	e8 bb f9 ff ff       	call   800231 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800876:	83 c4 08             	add    $0x8,%esp
+  800879:	ff 75 d4             	push   -0x2c(%ebp)
+  80087c:	6a 00                	push   $0x0
+  80087e:	e8 ae f9 ff ff       	call   800231 <sys_page_unmap>
+	return r;
+  800883:	83 c4 10             	add    $0x10,%esp
+  800886:	eb b3                	jmp    80083b <dup+0x9d>
+
+00800888 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800888:	55                   	push   %ebp
+  800889:	89 e5                	mov    %esp,%ebp
+  80088b:	56                   	push   %esi
+  80088c:	53                   	push   %ebx
+  80088d:	83 ec 18             	sub    $0x18,%esp
+  800890:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800893:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800896:	50                   	push   %eax
+  800897:	56                   	push   %esi
+  800898:	e8 85 fd ff ff       	call   800622 <fd_lookup>
+  80089d:	83 c4 10             	add    $0x10,%esp
+  8008a0:	85 c0                	test   %eax,%eax
+  8008a2:	78 3c                	js     8008e0 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8008a4:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8008a7:	83 ec 08             	sub    $0x8,%esp
+  8008aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008ad:	50                   	push   %eax
+  8008ae:	ff 33                	push   (%ebx)
+  8008b0:	e8 bd fd ff ff       	call   800672 <dev_lookup>
+  8008b5:	83 c4 10             	add    $0x10,%esp
+  8008b8:	85 c0                	test   %eax,%eax
+  8008ba:	78 24                	js     8008e0 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8008bc:	8b 43 08             	mov    0x8(%ebx),%eax
+  8008bf:	83 e0 03             	and    $0x3,%eax
+  8008c2:	83 f8 01             	cmp    $0x1,%eax
+  8008c5:	74 20                	je     8008e7 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8008c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008ca:	8b 40 08             	mov    0x8(%eax),%eax
+  8008cd:	85 c0                	test   %eax,%eax
+  8008cf:	74 37                	je     800908 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8008d1:	83 ec 04             	sub    $0x4,%esp
+  8008d4:	ff 75 10             	push   0x10(%ebp)
+  8008d7:	ff 75 0c             	push   0xc(%ebp)
+  8008da:	53                   	push   %ebx
+  8008db:	ff d0                	call   *%eax
+  8008dd:	83 c4 10             	add    $0x10,%esp
+}
+  8008e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008e3:	5b                   	pop    %ebx
+  8008e4:	5e                   	pop    %esi
+  8008e5:	5d                   	pop    %ebp
+  8008e6:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8008e7:	a1 00 50 80 00       	mov    0x805000,%eax
+  8008ec:	8b 40 48             	mov    0x48(%eax),%eax
+  8008ef:	83 ec 04             	sub    $0x4,%esp
+  8008f2:	56                   	push   %esi
+  8008f3:	50                   	push   %eax
+  8008f4:	68 f9 37 80 00       	push   $0x8037f9
+  8008f9:	e8 3d 1d 00 00       	call   80263b <cprintf>
+		return -E_INVAL;
+  8008fe:	83 c4 10             	add    $0x10,%esp
+  800901:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800906:	eb d8                	jmp    8008e0 <read+0x58>
+		return -E_NOT_SUPP;
+  800908:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80090d:	eb d1                	jmp    8008e0 <read+0x58>
+
+0080090f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80090f:	55                   	push   %ebp
+  800910:	89 e5                	mov    %esp,%ebp
+  800912:	57                   	push   %edi
+  800913:	56                   	push   %esi
+  800914:	53                   	push   %ebx
+  800915:	83 ec 0c             	sub    $0xc,%esp
+  800918:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80091b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80091e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800923:	eb 02                	jmp    800927 <readn+0x18>
+  800925:	01 c3                	add    %eax,%ebx
+  800927:	39 f3                	cmp    %esi,%ebx
+  800929:	73 21                	jae    80094c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80092b:	83 ec 04             	sub    $0x4,%esp
+  80092e:	89 f0                	mov    %esi,%eax
+  800930:	29 d8                	sub    %ebx,%eax
+  800932:	50                   	push   %eax
+  800933:	89 d8                	mov    %ebx,%eax
+  800935:	03 45 0c             	add    0xc(%ebp),%eax
+  800938:	50                   	push   %eax
+  800939:	57                   	push   %edi
+  80093a:	e8 49 ff ff ff       	call   800888 <read>
+		if (m < 0)
+  80093f:	83 c4 10             	add    $0x10,%esp
+  800942:	85 c0                	test   %eax,%eax
+  800944:	78 04                	js     80094a <readn+0x3b>
+			return m;
+		if (m == 0)
+  800946:	75 dd                	jne    800925 <readn+0x16>
+  800948:	eb 02                	jmp    80094c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80094a:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80094c:	89 d8                	mov    %ebx,%eax
+  80094e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800951:	5b                   	pop    %ebx
+  800952:	5e                   	pop    %esi
+  800953:	5f                   	pop    %edi
+  800954:	5d                   	pop    %ebp
+  800955:	c3                   	ret
+
+00800956 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800956:	55                   	push   %ebp
+  800957:	89 e5                	mov    %esp,%ebp
+  800959:	56                   	push   %esi
+  80095a:	53                   	push   %ebx
+  80095b:	83 ec 18             	sub    $0x18,%esp
+  80095e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800961:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800964:	50                   	push   %eax
+  800965:	53                   	push   %ebx
+  800966:	e8 b7 fc ff ff       	call   800622 <fd_lookup>
+  80096b:	83 c4 10             	add    $0x10,%esp
+  80096e:	85 c0                	test   %eax,%eax
+  800970:	78 37                	js     8009a9 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800972:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800975:	83 ec 08             	sub    $0x8,%esp
+  800978:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80097b:	50                   	push   %eax
+  80097c:	ff 36                	push   (%esi)
+  80097e:	e8 ef fc ff ff       	call   800672 <dev_lookup>
+  800983:	83 c4 10             	add    $0x10,%esp
+  800986:	85 c0                	test   %eax,%eax
+  800988:	78 1f                	js     8009a9 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80098a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80098e:	74 20                	je     8009b0 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800990:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800993:	8b 40 0c             	mov    0xc(%eax),%eax
+  800996:	85 c0                	test   %eax,%eax
+  800998:	74 37                	je     8009d1 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80099a:	83 ec 04             	sub    $0x4,%esp
+  80099d:	ff 75 10             	push   0x10(%ebp)
+  8009a0:	ff 75 0c             	push   0xc(%ebp)
+  8009a3:	56                   	push   %esi
+  8009a4:	ff d0                	call   *%eax
+  8009a6:	83 c4 10             	add    $0x10,%esp
+}
+  8009a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009ac:	5b                   	pop    %ebx
+  8009ad:	5e                   	pop    %esi
+  8009ae:	5d                   	pop    %ebp
+  8009af:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8009b0:	a1 00 50 80 00       	mov    0x805000,%eax
+  8009b5:	8b 40 48             	mov    0x48(%eax),%eax
+  8009b8:	83 ec 04             	sub    $0x4,%esp
+  8009bb:	53                   	push   %ebx
+  8009bc:	50                   	push   %eax
+  8009bd:	68 15 38 80 00       	push   $0x803815
+  8009c2:	e8 74 1c 00 00       	call   80263b <cprintf>
+		return -E_INVAL;
+  8009c7:	83 c4 10             	add    $0x10,%esp
+  8009ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009cf:	eb d8                	jmp    8009a9 <write+0x53>
+		return -E_NOT_SUPP;
+  8009d1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009d6:	eb d1                	jmp    8009a9 <write+0x53>
+
+008009d8 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8009d8:	55                   	push   %ebp
+  8009d9:	89 e5                	mov    %esp,%ebp
+  8009db:	53                   	push   %ebx
+  8009dc:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009df:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009e2:	50                   	push   %eax
+  8009e3:	ff 75 08             	push   0x8(%ebp)
+  8009e6:	e8 37 fc ff ff       	call   800622 <fd_lookup>
+  8009eb:	83 c4 10             	add    $0x10,%esp
+  8009ee:	85 c0                	test   %eax,%eax
+  8009f0:	78 3a                	js     800a2c <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009f2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8009f5:	83 ec 08             	sub    $0x8,%esp
+  8009f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009fb:	50                   	push   %eax
+  8009fc:	ff 33                	push   (%ebx)
+  8009fe:	e8 6f fc ff ff       	call   800672 <dev_lookup>
+  800a03:	83 c4 10             	add    $0x10,%esp
+  800a06:	85 c0                	test   %eax,%eax
+  800a08:	78 22                	js     800a2c <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  800a0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a0d:	8b 40 1c             	mov    0x1c(%eax),%eax
+  800a10:	85 c0                	test   %eax,%eax
+  800a12:	74 0d                	je     800a21 <seek+0x49>
+  800a14:	83 ec 0c             	sub    $0xc,%esp
+  800a17:	53                   	push   %ebx
+  800a18:	ff d0                	call   *%eax
+  800a1a:	83 c4 10             	add    $0x10,%esp
+  800a1d:	85 c0                	test   %eax,%eax
+  800a1f:	78 0b                	js     800a2c <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  800a21:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a24:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  800a27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a2f:	c9                   	leave
+  800a30:	c3                   	ret
+
+00800a31 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  800a31:	55                   	push   %ebp
+  800a32:	89 e5                	mov    %esp,%ebp
+  800a34:	53                   	push   %ebx
+  800a35:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a38:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a3b:	50                   	push   %eax
+  800a3c:	ff 75 08             	push   0x8(%ebp)
+  800a3f:	e8 de fb ff ff       	call   800622 <fd_lookup>
+  800a44:	83 c4 10             	add    $0x10,%esp
+  800a47:	85 c0                	test   %eax,%eax
+  800a49:	78 2b                	js     800a76 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a4b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a4e:	83 ec 08             	sub    $0x8,%esp
+  800a51:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a54:	50                   	push   %eax
+  800a55:	ff 33                	push   (%ebx)
+  800a57:	e8 16 fc ff ff       	call   800672 <dev_lookup>
+  800a5c:	83 c4 10             	add    $0x10,%esp
+  800a5f:	85 c0                	test   %eax,%eax
+  800a61:	78 13                	js     800a76 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  800a63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a66:	8b 40 1c             	mov    0x1c(%eax),%eax
+  800a69:	85 c0                	test   %eax,%eax
+  800a6b:	74 0e                	je     800a7b <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  800a6d:	83 ec 0c             	sub    $0xc,%esp
+  800a70:	53                   	push   %ebx
+  800a71:	ff d0                	call   *%eax
+  800a73:	83 c4 10             	add    $0x10,%esp
+}
+  800a76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a79:	c9                   	leave
+  800a7a:	c3                   	ret
+		return 0;
+  800a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a80:	eb f4                	jmp    800a76 <fsync+0x45>
+
+00800a82 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a82:	55                   	push   %ebp
+  800a83:	89 e5                	mov    %esp,%ebp
+  800a85:	56                   	push   %esi
+  800a86:	53                   	push   %ebx
+  800a87:	83 ec 18             	sub    $0x18,%esp
+  800a8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a8d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a90:	50                   	push   %eax
+  800a91:	53                   	push   %ebx
+  800a92:	e8 8b fb ff ff       	call   800622 <fd_lookup>
+  800a97:	83 c4 10             	add    $0x10,%esp
+  800a9a:	85 c0                	test   %eax,%eax
+  800a9c:	78 34                	js     800ad2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a9e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800aa1:	83 ec 08             	sub    $0x8,%esp
+  800aa4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800aa7:	50                   	push   %eax
+  800aa8:	ff 36                	push   (%esi)
+  800aaa:	e8 c3 fb ff ff       	call   800672 <dev_lookup>
+  800aaf:	83 c4 10             	add    $0x10,%esp
+  800ab2:	85 c0                	test   %eax,%eax
+  800ab4:	78 1c                	js     800ad2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800ab6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800aba:	74 1d                	je     800ad9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800abc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800abf:	8b 40 18             	mov    0x18(%eax),%eax
+  800ac2:	85 c0                	test   %eax,%eax
+  800ac4:	74 34                	je     800afa <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800ac6:	83 ec 08             	sub    $0x8,%esp
+  800ac9:	ff 75 0c             	push   0xc(%ebp)
+  800acc:	56                   	push   %esi
+  800acd:	ff d0                	call   *%eax
+  800acf:	83 c4 10             	add    $0x10,%esp
+}
+  800ad2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ad5:	5b                   	pop    %ebx
+  800ad6:	5e                   	pop    %esi
+  800ad7:	5d                   	pop    %ebp
+  800ad8:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800ad9:	a1 00 50 80 00       	mov    0x805000,%eax
+  800ade:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ae1:	83 ec 04             	sub    $0x4,%esp
+  800ae4:	53                   	push   %ebx
+  800ae5:	50                   	push   %eax
+  800ae6:	68 d8 37 80 00       	push   $0x8037d8
+  800aeb:	e8 4b 1b 00 00       	call   80263b <cprintf>
+		return -E_INVAL;
+  800af0:	83 c4 10             	add    $0x10,%esp
+  800af3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800af8:	eb d8                	jmp    800ad2 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800afa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800aff:	eb d1                	jmp    800ad2 <ftruncate+0x50>
+
+00800b01 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800b01:	55                   	push   %ebp
+  800b02:	89 e5                	mov    %esp,%ebp
+  800b04:	56                   	push   %esi
+  800b05:	53                   	push   %ebx
+  800b06:	83 ec 18             	sub    $0x18,%esp
+  800b09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b0c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b0f:	50                   	push   %eax
+  800b10:	ff 75 08             	push   0x8(%ebp)
+  800b13:	e8 0a fb ff ff       	call   800622 <fd_lookup>
+  800b18:	83 c4 10             	add    $0x10,%esp
+  800b1b:	85 c0                	test   %eax,%eax
+  800b1d:	78 49                	js     800b68 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b1f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b22:	83 ec 08             	sub    $0x8,%esp
+  800b25:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b28:	50                   	push   %eax
+  800b29:	ff 36                	push   (%esi)
+  800b2b:	e8 42 fb ff ff       	call   800672 <dev_lookup>
+  800b30:	83 c4 10             	add    $0x10,%esp
+  800b33:	85 c0                	test   %eax,%eax
+  800b35:	78 31                	js     800b68 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b3a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b3e:	74 2f                	je     800b6f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b40:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b43:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b4a:	00 00 00 
+	stat->st_isdir = 0;
+  800b4d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b54:	00 00 00 
+	stat->st_dev = dev;
+  800b57:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b5d:	83 ec 08             	sub    $0x8,%esp
+  800b60:	53                   	push   %ebx
+  800b61:	56                   	push   %esi
+  800b62:	ff 50 14             	call   *0x14(%eax)
+  800b65:	83 c4 10             	add    $0x10,%esp
+}
+  800b68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b6b:	5b                   	pop    %ebx
+  800b6c:	5e                   	pop    %esi
+  800b6d:	5d                   	pop    %ebp
+  800b6e:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b6f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b74:	eb f2                	jmp    800b68 <fstat+0x67>
+
+00800b76 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b76:	55                   	push   %ebp
+  800b77:	89 e5                	mov    %esp,%ebp
+  800b79:	56                   	push   %esi
+  800b7a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  800b7b:	83 ec 08             	sub    $0x8,%esp
+  800b7e:	68 00 10 00 00       	push   $0x1000
+  800b83:	ff 75 08             	push   0x8(%ebp)
+  800b86:	e8 b3 07 00 00       	call   80133e <open>
+  800b8b:	89 c3                	mov    %eax,%ebx
+  800b8d:	83 c4 10             	add    $0x10,%esp
+  800b90:	85 c0                	test   %eax,%eax
+  800b92:	78 1b                	js     800baf <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  800b94:	83 ec 08             	sub    $0x8,%esp
+  800b97:	ff 75 0c             	push   0xc(%ebp)
+  800b9a:	50                   	push   %eax
+  800b9b:	e8 61 ff ff ff       	call   800b01 <fstat>
+  800ba0:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800ba2:	89 1c 24             	mov    %ebx,(%esp)
+  800ba5:	e8 a2 fb ff ff       	call   80074c <close>
+	return r;
+  800baa:	83 c4 10             	add    $0x10,%esp
+  800bad:	89 f3                	mov    %esi,%ebx
+}
+  800baf:	89 d8                	mov    %ebx,%eax
+  800bb1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bb4:	5b                   	pop    %ebx
+  800bb5:	5e                   	pop    %esi
+  800bb6:	5d                   	pop    %ebp
+  800bb7:	c3                   	ret
+
+00800bb8 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  800bb8:	55                   	push   %ebp
+  800bb9:	89 e5                	mov    %esp,%ebp
+  800bbb:	57                   	push   %edi
+  800bbc:	56                   	push   %esi
+  800bbd:	53                   	push   %ebx
+  800bbe:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  800bc4:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  800bca:	89 d6                	mov    %edx,%esi
+  800bcc:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  800bd2:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  800bd5:	89 d3                	mov    %edx,%ebx
+  800bd7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  800bdd:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800be4:	74 1d                	je     800c03 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  800be6:	b8 00 60 80 00       	mov    $0x806000,%eax
+  800beb:	83 c8 07             	or     $0x7,%eax
+  800bee:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  800bf4:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800bf9:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  800bff:	01 ce                	add    %ecx,%esi
+  800c01:	eb 28                	jmp    800c2b <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800c03:	83 ec 0c             	sub    $0xc,%esp
+  800c06:	6a 01                	push   $0x1
+  800c08:	e8 05 28 00 00       	call   803412 <ipc_find_env>
+  800c0d:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800c12:	83 c4 10             	add    $0x10,%esp
+  800c15:	eb cf                	jmp    800be6 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  800c17:	83 c0 01             	add    $0x1,%eax
+  800c1a:	89 fa                	mov    %edi,%edx
+  800c1c:	09 da                	or     %ebx,%edx
+  800c1e:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800c25:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800c2b:	39 f3                	cmp    %esi,%ebx
+  800c2d:	72 e8                	jb     800c17 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  800c2f:	83 f8 41             	cmp    $0x41,%eax
+  800c32:	77 2f                	ja     800c63 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  800c34:	50                   	push   %eax
+  800c35:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  800c3b:	50                   	push   %eax
+  800c3c:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  800c42:	ff 35 c8 70 80 00    	push   0x8070c8
+  800c48:	e8 77 27 00 00       	call   8033c4 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  800c4d:	83 c4 0c             	add    $0xc,%esp
+  800c50:	6a 00                	push   $0x0
+  800c52:	6a 00                	push   $0x0
+  800c54:	6a 00                	push   $0x0
+  800c56:	e8 13 26 00 00       	call   80326e <ipc_recv>
+}
+  800c5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c5e:	5b                   	pop    %ebx
+  800c5f:	5e                   	pop    %esi
+  800c60:	5f                   	pop    %edi
+  800c61:	5d                   	pop    %ebp
+  800c62:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  800c63:	68 48 38 80 00       	push   $0x803848
+  800c68:	68 64 38 80 00       	push   $0x803864
+  800c6d:	6a 40                	push   $0x40
+  800c6f:	68 79 38 80 00       	push   $0x803879
+  800c74:	e8 e7 18 00 00       	call   802560 <_panic>
+
+00800c79 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  800c79:	55                   	push   %ebp
+  800c7a:	89 e5                	mov    %esp,%ebp
+  800c7c:	57                   	push   %edi
+  800c7d:	56                   	push   %esi
+  800c7e:	53                   	push   %ebx
+  800c7f:	83 ec 1c             	sub    $0x1c,%esp
+  800c82:	89 c3                	mov    %eax,%ebx
+  800c84:	89 d6                	mov    %edx,%esi
+  800c86:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  800c89:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  800c8f:	89 ca                	mov    %ecx,%edx
+  800c91:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  800c94:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  800c9b:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  800c9e:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  800ca5:	8b 76 0c             	mov    0xc(%esi),%esi
+  800ca8:	89 fb                	mov    %edi,%ebx
+  800caa:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  800cb1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800cb4:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  800cbb:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cbe:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  800cc5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cc8:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  800ccf:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  800cd2:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  800cd9:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  800cde:	39 c8                	cmp    %ecx,%eax
+  800ce0:	74 0d                	je     800cef <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  800ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cea:	5b                   	pop    %ebx
+  800ceb:	5e                   	pop    %esi
+  800cec:	5f                   	pop    %edi
+  800ced:	5d                   	pop    %ebp
+  800cee:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cef:	6a 07                	push   $0x7
+  800cf1:	68 00 60 80 00       	push   $0x806000
+  800cf6:	6a 0d                	push   $0xd
+  800cf8:	ff 35 c8 70 80 00    	push   0x8070c8
+  800cfe:	e8 d6 25 00 00       	call   8032d9 <ipc_send>
+  800d03:	83 c4 10             	add    $0x10,%esp
+  800d06:	eb da                	jmp    800ce2 <fsring_post+0x69>
+
+00800d08 <fsipcv>:
+{
+  800d08:	55                   	push   %ebp
+  800d09:	89 e5                	mov    %esp,%ebp
+  800d0b:	57                   	push   %edi
+  800d0c:	56                   	push   %esi
+  800d0d:	53                   	push   %ebx
+  800d0e:	83 ec 0c             	sub    $0xc,%esp
+  800d11:	89 c7                	mov    %eax,%edi
+  800d13:	89 d3                	mov    %edx,%ebx
+  800d15:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  800d17:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800d1e:	74 26                	je     800d46 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800d20:	6a 07                	push   $0x7
+  800d22:	68 00 60 80 00       	push   $0x806000
+  800d27:	57                   	push   %edi
+  800d28:	ff 35 c8 70 80 00    	push   0x8070c8
+  800d2e:	e8 a6 25 00 00       	call   8032d9 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  800d33:	6a 00                	push   $0x0
+  800d35:	56                   	push   %esi
+  800d36:	53                   	push   %ebx
+  800d37:	6a 00                	push   $0x0
+  800d39:	e8 f3 25 00 00       	call   803331 <ipc_recvv>
+}
+  800d3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d41:	5b                   	pop    %ebx
+  800d42:	5e                   	pop    %esi
+  800d43:	5f                   	pop    %edi
+  800d44:	5d                   	pop    %ebp
+  800d45:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d46:	83 ec 0c             	sub    $0xc,%esp
+  800d49:	6a 01                	push   $0x1
+  800d4b:	e8 c2 26 00 00       	call   803412 <ipc_find_env>
+  800d50:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800d55:	83 c4 10             	add    $0x10,%esp
+  800d58:	eb c6                	jmp    800d20 <fsipcv+0x18>
+
+00800d5a <fsipc>:
+{
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  800d60:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  800d67:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800d6a:	e8 99 ff ff ff       	call   800d08 <fsipcv>
+}
+  800d6f:	c9                   	leave
+  800d70:	c3                   	ret
+
+00800d71 <file_write_direct>:
+{
+  800d71:	55                   	push   %ebp
+  800d72:	89 e5                	mov    %esp,%ebp
+  800d74:	56                   	push   %esi
+  800d75:	53                   	push   %ebx
+  800d76:	89 c3                	mov    %eax,%ebx
+  800d78:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800d7a:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  800d80:	77 40                	ja     800dc2 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800d82:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  800d87:	39 c8                	cmp    %ecx,%eax
+  800d89:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d8c:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  800d8f:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  800d95:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800d9a:	83 ec 04             	sub    $0x4,%esp
+  800d9d:	50                   	push   %eax
+  800d9e:	52                   	push   %edx
+  800d9f:	68 08 60 80 00       	push   $0x806008
+  800da4:	e8 06 20 00 00       	call   802daf <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800da9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dae:	b8 04 00 00 00       	mov    $0x4,%eax
+  800db3:	e8 a2 ff ff ff       	call   800d5a <fsipc>
+  800db8:	83 c4 10             	add    $0x10,%esp
+}
+  800dbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dbe:	5b                   	pop    %ebx
+  800dbf:	5e                   	pop    %esi
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  800dc2:	89 d6                	mov    %edx,%esi
+  800dc4:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  800dca:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  800dcf:	29 f1                	sub    %esi,%ecx
+  800dd1:	39 c1                	cmp    %eax,%ecx
+  800dd3:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  800dd6:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800dd9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  800dde:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  800de4:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  800dea:	83 ec 0c             	sub    $0xc,%esp
+  800ded:	6a 05                	push   $0x5
+  800def:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800df4:	e8 bf fd ff ff       	call   800bb8 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  800df9:	83 c4 10             	add    $0x10,%esp
+  800dfc:	eb bd                	jmp    800dbb <file_write_direct+0x4a>
+
+00800dfe <devfile_sync>:
+{
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	57                   	push   %edi
+  800e02:	56                   	push   %esi
+  800e03:	53                   	push   %ebx
+  800e04:	83 ec 28             	sub    $0x28,%esp
+  800e07:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  800e0a:	56                   	push   %esi
+  800e0b:	e8 a5 f7 ff ff       	call   8005b5 <fd2data>
+  800e10:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  800e12:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  800e15:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  800e1c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  800e24:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  800e28:	74 45                	je     800e6f <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  800e2a:	8b 46 14             	mov    0x14(%esi),%eax
+  800e2d:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e3d:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  800e40:	39 cb                	cmp    %ecx,%ebx
+  800e42:	73 14                	jae    800e58 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  800e44:	29 d9                	sub    %ebx,%ecx
+  800e46:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800e49:	89 f0                	mov    %esi,%eax
+  800e4b:	e8 21 ff ff ff       	call   800d71 <file_write_direct>
+  800e50:	85 c0                	test   %eax,%eax
+  800e52:	7e 04                	jle    800e58 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e54:	01 c3                	add    %eax,%ebx
+  800e56:	eb e5                	jmp    800e3d <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  800e58:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e5b:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  800e62:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  800e65:	85 c0                	test   %eax,%eax
+  800e67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  800e6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e72:	5b                   	pop    %ebx
+  800e73:	5e                   	pop    %esi
+  800e74:	5f                   	pop    %edi
+  800e75:	5d                   	pop    %ebp
+  800e76:	c3                   	ret
+
+00800e77 <devfile_write>:
+{
+  800e77:	55                   	push   %ebp
+  800e78:	89 e5                	mov    %esp,%ebp
+  800e7a:	57                   	push   %edi
+  800e7b:	56                   	push   %esi
+  800e7c:	53                   	push   %ebx
+  800e7d:	83 ec 28             	sub    $0x28,%esp
+  800e80:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e83:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  800e86:	53                   	push   %ebx
+  800e87:	e8 29 f7 ff ff       	call   8005b5 <fd2data>
+  800e8c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  800e8f:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  800e92:	83 c4 10             	add    $0x10,%esp
+  800e95:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  800e99:	74 43                	je     800ede <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  800e9b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  800ea2:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800ea5:	85 c0                	test   %eax,%eax
+  800ea7:	74 43                	je     800eec <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  800ea9:	89 c2                	mov    %eax,%edx
+  800eab:	03 53 14             	add    0x14(%ebx),%edx
+  800eae:	39 fa                	cmp    %edi,%edx
+  800eb0:	75 0b                	jne    800ebd <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  800eb2:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  800eb5:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  800ebb:	76 66                	jbe    800f23 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  800ebd:	83 ec 0c             	sub    $0xc,%esp
+  800ec0:	53                   	push   %ebx
+  800ec1:	e8 38 ff ff ff       	call   800dfe <devfile_sync>
+  800ec6:	83 c4 10             	add    $0x10,%esp
+  800ec9:	85 c0                	test   %eax,%eax
+  800ecb:	78 4e                	js     800f1b <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800ecd:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800ed3:	77 56                	ja     800f2b <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  800ed5:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800ed8:	85 c0                	test   %eax,%eax
+  800eda:	75 20                	jne    800efc <devfile_write+0x85>
+  800edc:	eb 16                	jmp    800ef4 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  800ede:	89 f1                	mov    %esi,%ecx
+  800ee0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ee3:	89 d8                	mov    %ebx,%eax
+  800ee5:	e8 87 fe ff ff       	call   800d71 <file_write_direct>
+  800eea:	eb 2f                	jmp    800f1b <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800eec:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800ef2:	77 37                	ja     800f2b <devfile_write+0xb4>
+		ff->buf_base = pos;
+  800ef4:	89 7b 14             	mov    %edi,0x14(%ebx)
+  800ef7:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  800efc:	83 ec 04             	sub    $0x4,%esp
+  800eff:	56                   	push   %esi
+  800f00:	ff 75 0c             	push   0xc(%ebp)
+  800f03:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800f06:	01 c1                	add    %eax,%ecx
+  800f08:	51                   	push   %ecx
+  800f09:	e8 a1 1e 00 00       	call   802daf <memmove>
+	ff->buf_wlen += n;
+  800f0e:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  800f11:	01 f7                	add    %esi,%edi
+  800f13:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  800f16:	89 f0                	mov    %esi,%eax
+  800f18:	83 c4 10             	add    $0x10,%esp
+}
+  800f1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1e:	5b                   	pop    %ebx
+  800f1f:	5e                   	pop    %esi
+  800f20:	5f                   	pop    %edi
+  800f21:	5d                   	pop    %ebp
+  800f22:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  800f23:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800f29:	76 d1                	jbe    800efc <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  800f2b:	89 f1                	mov    %esi,%ecx
+  800f2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f30:	89 d8                	mov    %ebx,%eax
+  800f32:	e8 3a fe ff ff       	call   800d71 <file_write_direct>
+  800f37:	eb e2                	jmp    800f1b <devfile_write+0xa4>
+
+00800f39 <devfile_trunc>:
+{
+  800f39:	55                   	push   %ebp
+  800f3a:	89 e5                	mov    %esp,%ebp
+  800f3c:	53                   	push   %ebx
+  800f3d:	83 ec 10             	sub    $0x10,%esp
+  800f40:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  800f43:	53                   	push   %ebx
+  800f44:	e8 b5 fe ff ff       	call   800dfe <devfile_sync>
+  800f49:	83 c4 10             	add    $0x10,%esp
+  800f4c:	85 c0                	test   %eax,%eax
+  800f4e:	78 1f                	js     800f6f <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800f50:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f53:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800f58:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f5b:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800f60:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f65:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f6a:	e8 eb fd ff ff       	call   800d5a <fsipc>
+}
+  800f6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f72:	c9                   	leave
+  800f73:	c3                   	ret
+
+00800f74 <devfile_stat>:
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	56                   	push   %esi
+  800f78:	53                   	push   %ebx
+  800f79:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800f7c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  800f7f:	83 ec 0c             	sub    $0xc,%esp
+  800f82:	53                   	push   %ebx
+  800f83:	e8 76 fe ff ff       	call   800dfe <devfile_sync>
+  800f88:	83 c4 10             	add    $0x10,%esp
+  800f8b:	85 c0                	test   %eax,%eax
+  800f8d:	78 47                	js     800fd6 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800f8f:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f92:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800f97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f9c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fa1:	e8 b4 fd ff ff       	call   800d5a <fsipc>
+  800fa6:	85 c0                	test   %eax,%eax
+  800fa8:	78 2c                	js     800fd6 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800faa:	83 ec 08             	sub    $0x8,%esp
+  800fad:	68 00 60 80 00       	push   $0x806000
+  800fb2:	56                   	push   %esi
+  800fb3:	e8 71 1c 00 00       	call   802c29 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800fb8:	a1 80 60 80 00       	mov    0x806080,%eax
+  800fbd:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800fc3:	a1 84 60 80 00       	mov    0x806084,%eax
+  800fc8:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  800fce:	83 c4 10             	add    $0x10,%esp
+  800fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fd9:	5b                   	pop    %ebx
+  800fda:	5e                   	pop    %esi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	c3                   	ret
+
+00800fdd <devfile_flush>:
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	56                   	push   %esi
+  800fe1:	53                   	push   %ebx
+  800fe2:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  800fe5:	83 ec 0c             	sub    $0xc,%esp
+  800fe8:	56                   	push   %esi
+  800fe9:	e8 10 fe ff ff       	call   800dfe <devfile_sync>
+  800fee:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  800ff0:	83 c4 10             	add    $0x10,%esp
+  800ff3:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  800ff7:	75 25                	jne    80101e <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800ff9:	8b 46 0c             	mov    0xc(%esi),%eax
+  800ffc:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801001:	ba 00 00 00 00       	mov    $0x0,%edx
+  801006:	b8 06 00 00 00       	mov    $0x6,%eax
+  80100b:	e8 4a fd ff ff       	call   800d5a <fsipc>
+  801010:	85 c0                	test   %eax,%eax
+  801012:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801015:	89 d8                	mov    %ebx,%eax
+  801017:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80101a:	5b                   	pop    %ebx
+  80101b:	5e                   	pop    %esi
+  80101c:	5d                   	pop    %ebp
+  80101d:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  80101e:	83 ec 0c             	sub    $0xc,%esp
+  801021:	56                   	push   %esi
+  801022:	e8 8e f5 ff ff       	call   8005b5 <fd2data>
+  801027:	83 c4 08             	add    $0x8,%esp
+  80102a:	50                   	push   %eax
+  80102b:	6a 00                	push   $0x0
+  80102d:	e8 ff f1 ff ff       	call   800231 <sys_page_unmap>
+  801032:	83 c4 10             	add    $0x10,%esp
+  801035:	eb c2                	jmp    800ff9 <devfile_flush+0x1c>
+
+00801037 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	57                   	push   %edi
+  80103b:	56                   	push   %esi
+  80103c:	53                   	push   %ebx
+  80103d:	83 ec 64             	sub    $0x64,%esp
+  801040:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801042:	52                   	push   %edx
+  801043:	50                   	push   %eax
+  801044:	e8 d9 f5 ff ff       	call   800622 <fd_lookup>
+  801049:	89 c1                	mov    %eax,%ecx
+  80104b:	83 c4 10             	add    $0x10,%esp
+  80104e:	85 c0                	test   %eax,%eax
+  801050:	0f 88 f2 00 00 00    	js     801148 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801056:	8b 07                	mov    (%edi),%eax
+  801058:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80105e:	39 10                	cmp    %edx,(%eax)
+  801060:	0f 85 03 01 00 00    	jne    801169 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801066:	a1 00 50 80 00       	mov    0x805000,%eax
+  80106b:	8b 40 48             	mov    0x48(%eax),%eax
+  80106e:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801074:	0f 84 96 00 00 00    	je     801110 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  80107a:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801081:	0f 84 cb 00 00 00    	je     801152 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801087:	b8 00 60 80 00       	mov    $0x806000,%eax
+  80108c:	83 c8 07             	or     $0x7,%eax
+  80108f:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801092:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801095:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  80109a:	83 ec 04             	sub    $0x4,%esp
+  80109d:	68 07 04 00 00       	push   $0x407
+  8010a2:	53                   	push   %ebx
+  8010a3:	6a 00                	push   $0x0
+  8010a5:	e8 fa f0 ff ff       	call   8001a4 <sys_page_alloc>
+  8010aa:	89 c1                	mov    %eax,%ecx
+  8010ac:	83 c4 10             	add    $0x10,%esp
+  8010af:	85 c0                	test   %eax,%eax
+  8010b1:	0f 88 91 00 00 00    	js     801148 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  8010b7:	89 d8                	mov    %ebx,%eax
+  8010b9:	83 c8 07             	or     $0x7,%eax
+  8010bc:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8010be:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8010c4:	83 c6 04             	add    $0x4,%esi
+  8010c7:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8010cd:	75 cb                	jne    80109a <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8010cf:	6a 12                	push   $0x12
+  8010d1:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8010d4:	50                   	push   %eax
+  8010d5:	6a 0c                	push   $0xc
+  8010d7:	ff 35 c8 70 80 00    	push   0x8070c8
+  8010dd:	e8 e2 22 00 00       	call   8033c4 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8010e2:	83 c4 0c             	add    $0xc,%esp
+  8010e5:	6a 00                	push   $0x0
+  8010e7:	6a 00                	push   $0x0
+  8010e9:	6a 00                	push   $0x0
+  8010eb:	e8 7e 21 00 00       	call   80326e <ipc_recv>
+  8010f0:	89 c1                	mov    %eax,%ecx
+  8010f2:	83 c4 10             	add    $0x10,%esp
+  8010f5:	85 c0                	test   %eax,%eax
+  8010f7:	78 4f                	js     801148 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  8010f9:	a1 00 50 80 00       	mov    0x805000,%eax
+  8010fe:	8b 40 48             	mov    0x48(%eax),%eax
+  801101:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801106:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  80110d:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801110:	83 ec 0c             	sub    $0xc,%esp
+  801113:	ff 37                	push   (%edi)
+  801115:	e8 e4 fc ff ff       	call   800dfe <devfile_sync>
+  80111a:	89 c1                	mov    %eax,%ecx
+  80111c:	83 c4 10             	add    $0x10,%esp
+  80111f:	85 c0                	test   %eax,%eax
+  801121:	78 25                	js     801148 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801123:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801129:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  80112e:	ba 01 00 00 00       	mov    $0x1,%edx
+  801133:	89 d0                	mov    %edx,%eax
+  801135:	d3 e0                	shl    %cl,%eax
+  801137:	85 d8                	test   %ebx,%eax
+  801139:	74 0d                	je     801148 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  80113b:	83 c1 01             	add    $0x1,%ecx
+  80113e:	83 f9 10             	cmp    $0x10,%ecx
+  801141:	75 f0                	jne    801133 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801143:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801148:	89 c8                	mov    %ecx,%eax
+  80114a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114d:	5b                   	pop    %ebx
+  80114e:	5e                   	pop    %esi
+  80114f:	5f                   	pop    %edi
+  801150:	5d                   	pop    %ebp
+  801151:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801152:	83 ec 0c             	sub    $0xc,%esp
+  801155:	6a 01                	push   $0x1
+  801157:	e8 b6 22 00 00       	call   803412 <ipc_find_env>
+  80115c:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801161:	83 c4 10             	add    $0x10,%esp
+  801164:	e9 1e ff ff ff       	jmp    801087 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801169:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  80116e:	eb d8                	jmp    801148 <fsring_slot+0x111>
+
+00801170 <file_read_direct>:
+{
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	57                   	push   %edi
+  801174:	56                   	push   %esi
+  801175:	53                   	push   %ebx
+  801176:	83 ec 1c             	sub    $0x1c,%esp
+  801179:	89 c7                	mov    %eax,%edi
+  80117b:	89 d6                	mov    %edx,%esi
+  80117d:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  80117f:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801185:	77 52                	ja     8011d9 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801187:	8b 40 0c             	mov    0xc(%eax),%eax
+  80118a:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  80118f:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801195:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80119f:	e8 b6 fb ff ff       	call   800d5a <fsipc>
+  8011a4:	89 c7                	mov    %eax,%edi
+  8011a6:	85 c0                	test   %eax,%eax
+  8011a8:	78 25                	js     8011cf <file_read_direct+0x5f>
+	assert(r <= n);
+  8011aa:	39 c3                	cmp    %eax,%ebx
+  8011ac:	0f 82 87 00 00 00    	jb     801239 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  8011b2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8011b7:	0f 8f 95 00 00 00    	jg     801252 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8011bd:	83 ec 04             	sub    $0x4,%esp
+  8011c0:	50                   	push   %eax
+  8011c1:	68 00 60 80 00       	push   $0x806000
+  8011c6:	56                   	push   %esi
+  8011c7:	e8 e3 1b 00 00       	call   802daf <memmove>
+	return r;
+  8011cc:	83 c4 10             	add    $0x10,%esp
+}
+  8011cf:	89 f8                	mov    %edi,%eax
+  8011d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d4:	5b                   	pop    %ebx
+  8011d5:	5e                   	pop    %esi
+  8011d6:	5f                   	pop    %edi
+  8011d7:	5d                   	pop    %ebp
+  8011d8:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8011d9:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8011df:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8011e4:	29 d1                	sub    %edx,%ecx
+  8011e6:	39 d9                	cmp    %ebx,%ecx
+  8011e8:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011eb:	89 f0                	mov    %esi,%eax
+  8011ed:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8011f0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8011f3:	eb 0f                	jmp    801204 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8011f5:	0f b6 10             	movzbl (%eax),%edx
+  8011f8:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011fa:	05 00 10 00 00       	add    $0x1000,%eax
+  8011ff:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801204:	39 c8                	cmp    %ecx,%eax
+  801206:	72 ed                	jb     8011f5 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801208:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80120b:	8b 47 0c             	mov    0xc(%edi),%eax
+  80120e:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801213:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801219:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  80121f:	83 ec 0c             	sub    $0xc,%esp
+  801222:	6a 07                	push   $0x7
+  801224:	89 d9                	mov    %ebx,%ecx
+  801226:	89 f2                	mov    %esi,%edx
+  801228:	b8 09 00 00 00       	mov    $0x9,%eax
+  80122d:	e8 86 f9 ff ff       	call   800bb8 <fsipc_pages>
+  801232:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801234:	83 c4 10             	add    $0x10,%esp
+  801237:	eb 96                	jmp    8011cf <file_read_direct+0x5f>
+	assert(r <= n);
+  801239:	68 84 38 80 00       	push   $0x803884
+  80123e:	68 64 38 80 00       	push   $0x803864
+  801243:	68 dc 00 00 00       	push   $0xdc
+  801248:	68 79 38 80 00       	push   $0x803879
+  80124d:	e8 0e 13 00 00       	call   802560 <_panic>
+	assert(r <= PGSIZE);
+  801252:	68 95 38 80 00       	push   $0x803895
+  801257:	68 64 38 80 00       	push   $0x803864
+  80125c:	68 dd 00 00 00       	push   $0xdd
+  801261:	68 79 38 80 00       	push   $0x803879
+  801266:	e8 f5 12 00 00       	call   802560 <_panic>
+
+0080126b <devfile_read>:
+{
+  80126b:	55                   	push   %ebp
+  80126c:	89 e5                	mov    %esp,%ebp
+  80126e:	57                   	push   %edi
+  80126f:	56                   	push   %esi
+  801270:	53                   	push   %ebx
+  801271:	83 ec 28             	sub    $0x28,%esp
+  801274:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801277:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80127a:	53                   	push   %ebx
+  80127b:	e8 35 f3 ff ff       	call   8005b5 <fd2data>
+  801280:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801283:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801286:	83 c4 10             	add    $0x10,%esp
+  801289:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  80128d:	74 7d                	je     80130c <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80128f:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801293:	0f 85 81 00 00 00    	jne    80131a <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801299:	8b 43 18             	mov    0x18(%ebx),%eax
+  80129c:	85 c0                	test   %eax,%eax
+  80129e:	74 0d                	je     8012ad <devfile_read+0x42>
+  8012a0:	8b 53 14             	mov    0x14(%ebx),%edx
+  8012a3:	39 fa                	cmp    %edi,%edx
+  8012a5:	7f 06                	jg     8012ad <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8012a7:	01 c2                	add    %eax,%edx
+  8012a9:	39 d7                	cmp    %edx,%edi
+  8012ab:	72 28                	jb     8012d5 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8012ad:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8012b4:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8012ba:	77 74                	ja     801330 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8012bc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8012c4:	89 d8                	mov    %ebx,%eax
+  8012c6:	e8 a5 fe ff ff       	call   801170 <file_read_direct>
+  8012cb:	85 c0                	test   %eax,%eax
+  8012cd:	7e 35                	jle    801304 <devfile_read+0x99>
+		ff->buf_base = pos;
+  8012cf:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8012d2:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8012d5:	8b 53 14             	mov    0x14(%ebx),%edx
+  8012d8:	89 d0                	mov    %edx,%eax
+  8012da:	03 43 18             	add    0x18(%ebx),%eax
+  8012dd:	29 f8                	sub    %edi,%eax
+  8012df:	39 f0                	cmp    %esi,%eax
+  8012e1:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8012e4:	83 ec 04             	sub    $0x4,%esp
+  8012e7:	56                   	push   %esi
+  8012e8:	89 f8                	mov    %edi,%eax
+  8012ea:	29 d0                	sub    %edx,%eax
+  8012ec:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8012ef:	01 c1                	add    %eax,%ecx
+  8012f1:	51                   	push   %ecx
+  8012f2:	ff 75 0c             	push   0xc(%ebp)
+  8012f5:	e8 b5 1a 00 00       	call   802daf <memmove>
+	fd->fd_offset = pos + n;
+  8012fa:	01 f7                	add    %esi,%edi
+  8012fc:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8012ff:	89 f0                	mov    %esi,%eax
+  801301:	83 c4 10             	add    $0x10,%esp
+}
+  801304:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801307:	5b                   	pop    %ebx
+  801308:	5e                   	pop    %esi
+  801309:	5f                   	pop    %edi
+  80130a:	5d                   	pop    %ebp
+  80130b:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  80130c:	89 f1                	mov    %esi,%ecx
+  80130e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801311:	89 d8                	mov    %ebx,%eax
+  801313:	e8 58 fe ff ff       	call   801170 <file_read_direct>
+  801318:	eb ea                	jmp    801304 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80131a:	83 ec 0c             	sub    $0xc,%esp
+  80131d:	53                   	push   %ebx
+  80131e:	e8 db fa ff ff       	call   800dfe <devfile_sync>
+  801323:	83 c4 10             	add    $0x10,%esp
+  801326:	85 c0                	test   %eax,%eax
+  801328:	0f 89 6b ff ff ff    	jns    801299 <devfile_read+0x2e>
+  80132e:	eb d4                	jmp    801304 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801330:	89 f1                	mov    %esi,%ecx
+  801332:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801335:	89 d8                	mov    %ebx,%eax
+  801337:	e8 34 fe ff ff       	call   801170 <file_read_direct>
+  80133c:	eb c6                	jmp    801304 <devfile_read+0x99>
+
+0080133e <open>:
+{
+  80133e:	55                   	push   %ebp
+  80133f:	89 e5                	mov    %esp,%ebp
+  801341:	56                   	push   %esi
+  801342:	53                   	push   %ebx
+  801343:	83 ec 1c             	sub    $0x1c,%esp
+  801346:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801349:	56                   	push   %esi
+  80134a:	e8 9f 18 00 00       	call   802bee <strlen>
+  80134f:	83 c4 10             	add    $0x10,%esp
+  801352:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801357:	0f 8f a0 00 00 00    	jg     8013fd <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  80135d:	83 ec 0c             	sub    $0xc,%esp
+  801360:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801363:	50                   	push   %eax
+  801364:	e8 63 f2 ff ff       	call   8005cc <fd_alloc>
+  801369:	89 c3                	mov    %eax,%ebx
+  80136b:	83 c4 10             	add    $0x10,%esp
+  80136e:	85 c0                	test   %eax,%eax
+  801370:	78 45                	js     8013b7 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801372:	83 ec 08             	sub    $0x8,%esp
+  801375:	56                   	push   %esi
+  801376:	68 00 60 80 00       	push   $0x806000
+  80137b:	e8 a9 18 00 00       	call   802c29 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801380:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801383:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801388:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80138b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801390:	e8 c5 f9 ff ff       	call   800d5a <fsipc>
+  801395:	89 c3                	mov    %eax,%ebx
+  801397:	83 c4 10             	add    $0x10,%esp
+  80139a:	85 c0                	test   %eax,%eax
+  80139c:	78 22                	js     8013c0 <open+0x82>
+	if (!(mode & O_NOBUF)
+  80139e:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8013a5:	74 2b                	je     8013d2 <open+0x94>
+	return fd2num(fd);
+  8013a7:	83 ec 0c             	sub    $0xc,%esp
+  8013aa:	ff 75 f4             	push   -0xc(%ebp)
+  8013ad:	e8 f3 f1 ff ff       	call   8005a5 <fd2num>
+  8013b2:	89 c3                	mov    %eax,%ebx
+  8013b4:	83 c4 10             	add    $0x10,%esp
+}
+  8013b7:	89 d8                	mov    %ebx,%eax
+  8013b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013bc:	5b                   	pop    %ebx
+  8013bd:	5e                   	pop    %esi
+  8013be:	5d                   	pop    %ebp
+  8013bf:	c3                   	ret
+		fd_close(fd, 0);
+  8013c0:	83 ec 08             	sub    $0x8,%esp
+  8013c3:	6a 00                	push   $0x0
+  8013c5:	ff 75 f4             	push   -0xc(%ebp)
+  8013c8:	e8 f8 f2 ff ff       	call   8006c5 <fd_close>
+		return r;
+  8013cd:	83 c4 10             	add    $0x10,%esp
+  8013d0:	eb e5                	jmp    8013b7 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8013d2:	83 ec 0c             	sub    $0xc,%esp
+  8013d5:	ff 75 f4             	push   -0xc(%ebp)
+  8013d8:	e8 d8 f1 ff ff       	call   8005b5 <fd2data>
+  8013dd:	83 c4 0c             	add    $0xc,%esp
+  8013e0:	68 07 04 00 00       	push   $0x407
+  8013e5:	50                   	push   %eax
+  8013e6:	6a 00                	push   $0x0
+  8013e8:	e8 b7 ed ff ff       	call   8001a4 <sys_page_alloc>
+  8013ed:	83 c4 10             	add    $0x10,%esp
+  8013f0:	85 c0                	test   %eax,%eax
+  8013f2:	75 b3                	jne    8013a7 <open+0x69>
+		fd->fd_file.buffered = 1;
+  8013f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013f7:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8013fb:	eb aa                	jmp    8013a7 <open+0x69>
+		return -E_BAD_PATH;
+  8013fd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801402:	eb b3                	jmp    8013b7 <open+0x79>
+
+00801404 <readdir>:
+{
+  801404:	55                   	push   %ebp
+  801405:	89 e5                	mov    %esp,%ebp
+  801407:	53                   	push   %ebx
+  801408:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80140b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80140e:	50                   	push   %eax
+  80140f:	ff 75 08             	push   0x8(%ebp)
+  801412:	e8 0b f2 ff ff       	call   800622 <fd_lookup>
+  801417:	89 c3                	mov    %eax,%ebx
+  801419:	83 c4 10             	add    $0x10,%esp
+  80141c:	85 c0                	test   %eax,%eax
+  80141e:	78 73                	js     801493 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801423:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801429:	39 08                	cmp    %ecx,(%eax)
+  80142b:	0f 85 82 00 00 00    	jne    8014b3 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801431:	83 ec 0c             	sub    $0xc,%esp
+  801434:	50                   	push   %eax
+  801435:	e8 c4 f9 ff ff       	call   800dfe <devfile_sync>
+  80143a:	89 c3                	mov    %eax,%ebx
+  80143c:	83 c4 10             	add    $0x10,%esp
+  80143f:	85 c0                	test   %eax,%eax
+  801441:	78 50                	js     801493 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801443:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801446:	8b 40 0c             	mov    0xc(%eax),%eax
+  801449:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  80144e:	8b 45 10             	mov    0x10(%ebp),%eax
+  801451:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801456:	8b 45 14             	mov    0x14(%ebp),%eax
+  801459:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  80145e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801463:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801468:	e8 ed f8 ff ff       	call   800d5a <fsipc>
+  80146d:	89 c3                	mov    %eax,%ebx
+  80146f:	85 c0                	test   %eax,%eax
+  801471:	7e 20                	jle    801493 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801473:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801476:	72 22                	jb     80149a <readdir+0x96>
+  801478:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80147d:	7f 1b                	jg     80149a <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80147f:	83 ec 04             	sub    $0x4,%esp
+  801482:	50                   	push   %eax
+  801483:	68 00 60 80 00       	push   $0x806000
+  801488:	ff 75 0c             	push   0xc(%ebp)
+  80148b:	e8 1f 19 00 00       	call   802daf <memmove>
+	return r;
+  801490:	83 c4 10             	add    $0x10,%esp
+}
+  801493:	89 d8                	mov    %ebx,%eax
+  801495:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801498:	c9                   	leave
+  801499:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  80149a:	68 8b 38 80 00       	push   $0x80388b
+  80149f:	68 64 38 80 00       	push   $0x803864
+  8014a4:	68 86 01 00 00       	push   $0x186
+  8014a9:	68 79 38 80 00       	push   $0x803879
+  8014ae:	e8 ad 10 00 00       	call   802560 <_panic>
+		return -E_NOT_SUPP;
+  8014b3:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8014b8:	eb d9                	jmp    801493 <readdir+0x8f>
+
+008014ba <munmap>:
+{
+  8014ba:	55                   	push   %ebp
+  8014bb:	89 e5                	mov    %esp,%ebp
+  8014bd:	56                   	push   %esi
+  8014be:	53                   	push   %ebx
+  8014bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8014c5:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8014cb:	75 41                	jne    80150e <munmap+0x54>
+  8014cd:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8014d3:	77 39                	ja     80150e <munmap+0x54>
+  8014d5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8014da:	29 f0                	sub    %esi,%eax
+  8014dc:	39 d0                	cmp    %edx,%eax
+  8014de:	72 35                	jb     801515 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014e0:	89 f3                	mov    %esi,%ebx
+  8014e2:	01 d6                	add    %edx,%esi
+  8014e4:	39 f3                	cmp    %esi,%ebx
+  8014e6:	73 1a                	jae    801502 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8014e8:	83 ec 08             	sub    $0x8,%esp
+  8014eb:	53                   	push   %ebx
+  8014ec:	6a 00                	push   $0x0
+  8014ee:	e8 3e ed ff ff       	call   800231 <sys_page_unmap>
+  8014f3:	83 c4 10             	add    $0x10,%esp
+  8014f6:	85 c0                	test   %eax,%eax
+  8014f8:	78 0d                	js     801507 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014fa:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801500:	eb e2                	jmp    8014e4 <munmap+0x2a>
+	return 0;
+  801502:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801507:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80150a:	5b                   	pop    %ebx
+  80150b:	5e                   	pop    %esi
+  80150c:	5d                   	pop    %ebp
+  80150d:	c3                   	ret
+		return -E_INVAL;
+  80150e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801513:	eb f2                	jmp    801507 <munmap+0x4d>
+  801515:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80151a:	eb eb                	jmp    801507 <munmap+0x4d>
+
+0080151c <mmap>:
+{
+  80151c:	55                   	push   %ebp
+  80151d:	89 e5                	mov    %esp,%ebp
+  80151f:	57                   	push   %edi
+  801520:	56                   	push   %esi
+  801521:	53                   	push   %ebx
+  801522:	83 ec 34             	sub    $0x34,%esp
+  801525:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801528:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80152b:	50                   	push   %eax
+  80152c:	ff 75 18             	push   0x18(%ebp)
+  80152f:	e8 ee f0 ff ff       	call   800622 <fd_lookup>
+  801534:	89 c3                	mov    %eax,%ebx
+  801536:	83 c4 10             	add    $0x10,%esp
+  801539:	85 c0                	test   %eax,%eax
+  80153b:	0f 88 0e 01 00 00    	js     80164f <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801541:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801544:	a1 20 40 80 00       	mov    0x804020,%eax
+  801549:	39 02                	cmp    %eax,(%edx)
+  80154b:	0f 85 50 01 00 00    	jne    8016a1 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801551:	8b 45 10             	mov    0x10(%ebp),%eax
+  801554:	83 e0 02             	and    $0x2,%eax
+  801557:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80155a:	74 0a                	je     801566 <mmap+0x4a>
+  80155c:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801560:	0f 84 42 01 00 00    	je     8016a8 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801566:	8b 42 08             	mov    0x8(%edx),%eax
+  801569:	83 e0 03             	and    $0x3,%eax
+  80156c:	83 f8 01             	cmp    $0x1,%eax
+  80156f:	0f 84 3a 01 00 00    	je     8016af <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  801575:	8b 45 08             	mov    0x8(%ebp),%eax
+  801578:	0b 45 1c             	or     0x1c(%ebp),%eax
+  80157b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801580:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801583:	0f 85 2d 01 00 00    	jne    8016b6 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801589:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80158d:	0f 88 2a 01 00 00    	js     8016bd <mmap+0x1a1>
+  801593:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80159a:	0f 87 1d 01 00 00    	ja     8016bd <mmap+0x1a1>
+  8015a0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8015a5:	2b 45 08             	sub    0x8(%ebp),%eax
+  8015a8:	39 f8                	cmp    %edi,%eax
+  8015aa:	0f 82 14 01 00 00    	jb     8016c4 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8015b0:	83 ec 0c             	sub    $0xc,%esp
+  8015b3:	52                   	push   %edx
+  8015b4:	e8 45 f8 ff ff       	call   800dfe <devfile_sync>
+  8015b9:	89 c3                	mov    %eax,%ebx
+  8015bb:	83 c4 10             	add    $0x10,%esp
+  8015be:	85 c0                	test   %eax,%eax
+  8015c0:	0f 88 89 00 00 00    	js     80164f <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8015c6:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8015cc:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8015d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d7:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8015da:	39 fe                	cmp    %edi,%esi
+  8015dc:	73 7b                	jae    801659 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8015de:	89 f8                	mov    %edi,%eax
+  8015e0:	29 f0                	sub    %esi,%eax
+  8015e2:	c1 e8 0c             	shr    $0xc,%eax
+  8015e5:	ba 40 00 00 00       	mov    $0x40,%edx
+  8015ea:	39 d0                	cmp    %edx,%eax
+  8015ec:	0f 47 c2             	cmova  %edx,%eax
+  8015ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8015f2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015f5:	8b 52 0c             	mov    0xc(%edx),%edx
+  8015f8:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  8015fe:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  801601:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  801607:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  80160c:	89 f2                	mov    %esi,%edx
+  80160e:	03 55 08             	add    0x8(%ebp),%edx
+  801611:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  801614:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801619:	e8 ea f6 ff ff       	call   800d08 <fsipcv>
+  80161e:	85 c0                	test   %eax,%eax
+  801620:	7e 12                	jle    801634 <mmap+0x118>
+  801622:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801625:	85 c0                	test   %eax,%eax
+  801627:	0f 84 9e 00 00 00    	je     8016cb <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80162d:	c1 e0 0c             	shl    $0xc,%eax
+  801630:	01 c6                	add    %eax,%esi
+  801632:	eb a6                	jmp    8015da <mmap+0xbe>
+			munmap(addr, done);
+  801634:	89 c3                	mov    %eax,%ebx
+  801636:	83 ec 08             	sub    $0x8,%esp
+  801639:	56                   	push   %esi
+  80163a:	ff 75 08             	push   0x8(%ebp)
+  80163d:	e8 78 fe ff ff       	call   8014ba <munmap>
+			return r < 0 ? r : -E_INVAL;
+  801642:	83 c4 10             	add    $0x10,%esp
+  801645:	85 db                	test   %ebx,%ebx
+  801647:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80164c:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80164f:	89 d8                	mov    %ebx,%eax
+  801651:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801654:	5b                   	pop    %ebx
+  801655:	5e                   	pop    %esi
+  801656:	5f                   	pop    %edi
+  801657:	5d                   	pop    %ebp
+  801658:	c3                   	ret
+	if (prot & PROT_WRITE)
+  801659:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80165c:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80165e:	85 c0                	test   %eax,%eax
+  801660:	74 ed                	je     80164f <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  801662:	be 00 00 00 00       	mov    $0x0,%esi
+  801667:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80166a:	39 fe                	cmp    %edi,%esi
+  80166c:	73 2e                	jae    80169c <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80166e:	83 ec 0c             	sub    $0xc,%esp
+  801671:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  801674:	50                   	push   %eax
+  801675:	e8 f6 19 00 00       	call   803070 <cowpage>
+  80167a:	83 c4 10             	add    $0x10,%esp
+  80167d:	85 c0                	test   %eax,%eax
+  80167f:	78 08                	js     801689 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  801681:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801687:	eb e1                	jmp    80166a <mmap+0x14e>
+				munmap(addr, len);
+  801689:	89 c3                	mov    %eax,%ebx
+  80168b:	83 ec 08             	sub    $0x8,%esp
+  80168e:	57                   	push   %edi
+  80168f:	ff 75 08             	push   0x8(%ebp)
+  801692:	e8 23 fe ff ff       	call   8014ba <munmap>
+				return r;
+  801697:	83 c4 10             	add    $0x10,%esp
+  80169a:	eb b3                	jmp    80164f <mmap+0x133>
+	return 0;
+  80169c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80169f:	eb ae                	jmp    80164f <mmap+0x133>
+		return -E_NOT_SUPP;
+  8016a1:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8016a6:	eb a7                	jmp    80164f <mmap+0x133>
+		return -E_NOT_SUPP;
+  8016a8:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8016ad:	eb a0                	jmp    80164f <mmap+0x133>
+		return -E_INVAL;
+  8016af:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016b4:	eb 99                	jmp    80164f <mmap+0x133>
+  8016b6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016bb:	eb 92                	jmp    80164f <mmap+0x133>
+  8016bd:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016c2:	eb 8b                	jmp    80164f <mmap+0x133>
+  8016c4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016c9:	eb 84                	jmp    80164f <mmap+0x133>
+			munmap(addr, done);
+  8016cb:	83 ec 08             	sub    $0x8,%esp
+  8016ce:	56                   	push   %esi
+  8016cf:	ff 75 08             	push   0x8(%ebp)
+  8016d2:	e8 e3 fd ff ff       	call   8014ba <munmap>
+  8016d7:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8016da:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016df:	e9 6b ff ff ff       	jmp    80164f <mmap+0x133>
+
+008016e4 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8016e4:	55                   	push   %ebp
+  8016e5:	89 e5                	mov    %esp,%ebp
+  8016e7:	56                   	push   %esi
+  8016e8:	53                   	push   %ebx
+  8016e9:	83 ec 10             	sub    $0x10,%esp
+  8016ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8016ef:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016f5:	e8 3d f9 ff ff       	call   801037 <fsring_slot>
+  8016fa:	85 c0                	test   %eax,%eax
+  8016fc:	78 60                	js     80175e <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8016fe:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  801701:	8b 56 08             	mov    0x8(%esi),%edx
+  801704:	83 e2 03             	and    $0x3,%edx
+  801707:	83 fa 01             	cmp    $0x1,%edx
+  80170a:	74 59                	je     801765 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  80170c:	ba 01 00 00 00       	mov    $0x1,%edx
+  801711:	89 c1                	mov    %eax,%ecx
+  801713:	d3 e2                	shl    %cl,%edx
+  801715:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  80171b:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80171e:	c1 e2 02             	shl    $0x2,%edx
+  801721:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  801727:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  80172e:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  801731:	8b 55 18             	mov    0x18(%ebp),%edx
+  801734:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  801737:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80173a:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80173d:	83 ec 08             	sub    $0x8,%esp
+  801740:	50                   	push   %eax
+  801741:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801746:	39 c3                	cmp    %eax,%ebx
+  801748:	0f 47 d8             	cmova  %eax,%ebx
+  80174b:	53                   	push   %ebx
+  80174c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80174f:	89 f2                	mov    %esi,%edx
+  801751:	b8 03 00 00 00       	mov    $0x3,%eax
+  801756:	e8 1e f5 ff ff       	call   800c79 <fsring_post>
+  80175b:	83 c4 10             	add    $0x10,%esp
+}
+  80175e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801761:	5b                   	pop    %ebx
+  801762:	5e                   	pop    %esi
+  801763:	5d                   	pop    %ebp
+  801764:	c3                   	ret
+		return -E_INVAL;
+  801765:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80176a:	eb f2                	jmp    80175e <fsring_read+0x7a>
+
+0080176c <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80176c:	55                   	push   %ebp
+  80176d:	89 e5                	mov    %esp,%ebp
+  80176f:	56                   	push   %esi
+  801770:	53                   	push   %ebx
+  801771:	83 ec 10             	sub    $0x10,%esp
+  801774:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  801777:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80177a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80177d:	e8 b5 f8 ff ff       	call   801037 <fsring_slot>
+  801782:	89 c3                	mov    %eax,%ebx
+  801784:	85 c0                	test   %eax,%eax
+  801786:	78 77                	js     8017ff <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801788:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80178b:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80178f:	74 77                	je     801808 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  801791:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801796:	39 c6                	cmp    %eax,%esi
+  801798:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80179b:	83 ec 04             	sub    $0x4,%esp
+  80179e:	56                   	push   %esi
+  80179f:	ff 75 0c             	push   0xc(%ebp)
+  8017a2:	89 d8                	mov    %ebx,%eax
+  8017a4:	c1 e0 0c             	shl    $0xc,%eax
+  8017a7:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8017ad:	50                   	push   %eax
+  8017ae:	e8 fc 15 00 00       	call   802daf <memmove>
+	fsring_busy |= 1 << slot;
+  8017b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017b8:	89 d9                	mov    %ebx,%ecx
+  8017ba:	d3 e0                	shl    %cl,%eax
+  8017bc:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8017c2:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8017c5:	c1 e0 02             	shl    $0x2,%eax
+  8017c8:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8017ce:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8017d5:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8017d8:	8b 45 18             	mov    0x18(%ebp),%eax
+  8017db:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8017de:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8017e5:	83 c4 08             	add    $0x8,%esp
+  8017e8:	53                   	push   %ebx
+  8017e9:	56                   	push   %esi
+  8017ea:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8017ed:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8017f0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017f5:	e8 7f f4 ff ff       	call   800c79 <fsring_post>
+  8017fa:	89 c3                	mov    %eax,%ebx
+  8017fc:	83 c4 10             	add    $0x10,%esp
+}
+  8017ff:	89 d8                	mov    %ebx,%eax
+  801801:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801804:	5b                   	pop    %ebx
+  801805:	5e                   	pop    %esi
+  801806:	5d                   	pop    %ebp
+  801807:	c3                   	ret
+		return -E_INVAL;
+  801808:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80180d:	eb f0                	jmp    8017ff <fsring_write+0x93>
+
+0080180f <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80180f:	55                   	push   %ebp
+  801810:	89 e5                	mov    %esp,%ebp
+  801812:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  801815:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801818:	8b 45 08             	mov    0x8(%ebp),%eax
+  80181b:	e8 17 f8 ff ff       	call   801037 <fsring_slot>
+  801820:	85 c0                	test   %eax,%eax
+  801822:	78 4c                	js     801870 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  801824:	ba 01 00 00 00       	mov    $0x1,%edx
+  801829:	89 c1                	mov    %eax,%ecx
+  80182b:	d3 e2                	shl    %cl,%edx
+  80182d:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  801833:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  801836:	c1 e2 02             	shl    $0x2,%edx
+  801839:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  80183f:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  801846:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  801849:	8b 55 10             	mov    0x10(%ebp),%edx
+  80184c:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80184f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801852:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  801855:	83 ec 08             	sub    $0x8,%esp
+  801858:	50                   	push   %eax
+  801859:	6a 00                	push   $0x0
+  80185b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801860:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801863:	b8 05 00 00 00       	mov    $0x5,%eax
+  801868:	e8 0c f4 ff ff       	call   800c79 <fsring_post>
+  80186d:	83 c4 10             	add    $0x10,%esp
+}
+  801870:	c9                   	leave
+  801871:	c3                   	ret
+
+00801872 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  801872:	55                   	push   %ebp
+  801873:	89 e5                	mov    %esp,%ebp
+  801875:	57                   	push   %edi
+  801876:	56                   	push   %esi
+  801877:	53                   	push   %ebx
+  801878:	83 ec 1c             	sub    $0x1c,%esp
+  80187b:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80187f:	a1 00 50 80 00       	mov    0x805000,%eax
+  801884:	8b 40 48             	mov    0x48(%eax),%eax
+  801887:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  80188d:	74 12                	je     8018a1 <fsring_reap+0x2f>
+		return 0;
+  80188f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  801894:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801897:	5b                   	pop    %ebx
+  801898:	5e                   	pop    %esi
+  801899:	5f                   	pop    %edi
+  80189a:	5d                   	pop    %ebp
+  80189b:	c3                   	ret
+		sys_yield();
+  80189c:	e8 e4 e8 ff ff       	call   800185 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8018a1:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8018a7:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8018ac:	39 c2                	cmp    %eax,%edx
+  8018ae:	75 18                	jne    8018c8 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8018b0:	84 db                	test   %bl,%bl
+  8018b2:	0f 84 21 01 00 00    	je     8019d9 <fsring_reap+0x167>
+  8018b8:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  8018bf:	75 db                	jne    80189c <fsring_reap+0x2a>
+			return 0;
+  8018c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c6:	eb cc                	jmp    801894 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8018c8:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018cd:	83 e0 0f             	and    $0xf,%eax
+  8018d0:	83 c0 2a             	add    $0x2a,%eax
+  8018d3:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8018da:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8018e1:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018e6:	83 c0 01             	add    $0x1,%eax
+  8018e9:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8018ee:	83 fb 0f             	cmp    $0xf,%ebx
+  8018f1:	77 5b                	ja     80194e <fsring_reap+0xdc>
+  8018f3:	be 01 00 00 00       	mov    $0x1,%esi
+  8018f8:	89 d9                	mov    %ebx,%ecx
+  8018fa:	d3 e6                	shl    %cl,%esi
+  8018fc:	89 f0                	mov    %esi,%eax
+  8018fe:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  801904:	74 48                	je     80194e <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  801906:	89 d8                	mov    %ebx,%eax
+  801908:	c1 e0 0c             	shl    $0xc,%eax
+  80190b:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  801911:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  801914:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801917:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  80191e:	83 f8 03             	cmp    $0x3,%eax
+  801921:	74 40                	je     801963 <fsring_reap+0xf1>
+  801923:	83 f8 05             	cmp    $0x5,%eax
+  801926:	74 64                	je     80198c <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  801928:	f7 d6                	not    %esi
+  80192a:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  801930:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801933:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  80193a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80193d:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  80193f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801942:	89 38                	mov    %edi,(%eax)
+	return 1;
+  801944:	b8 01 00 00 00       	mov    $0x1,%eax
+  801949:	e9 46 ff ff ff       	jmp    801894 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80194e:	53                   	push   %ebx
+  80194f:	68 a1 38 80 00       	push   $0x8038a1
+  801954:	68 8f 02 00 00       	push   $0x28f
+  801959:	68 79 38 80 00       	push   $0x803879
+  80195e:	e8 fd 0b 00 00       	call   802560 <_panic>
+		if (cqe.cqe_result > 0)
+  801963:	85 ff                	test   %edi,%edi
+  801965:	7e c1                	jle    801928 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801967:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80196a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80196f:	39 c7                	cmp    %eax,%edi
+  801971:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801974:	50                   	push   %eax
+  801975:	ff 75 e4             	push   -0x1c(%ebp)
+  801978:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80197b:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  801982:	e8 28 14 00 00       	call   802daf <memmove>
+  801987:	83 c4 10             	add    $0x10,%esp
+  80198a:	eb 9c                	jmp    801928 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80198c:	85 ff                	test   %edi,%edi
+  80198e:	75 98                	jne    801928 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  801990:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801993:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80199a:	83 ec 08             	sub    $0x8,%esp
+  80199d:	ff 75 e4             	push   -0x1c(%ebp)
+  8019a0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8019a3:	51                   	push   %ecx
+  8019a4:	e8 80 12 00 00       	call   802c29 <strcpy>
+			st->st_size = ret->ret_size;
+  8019a9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8019ac:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8019b2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8019b5:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8019bb:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8019c1:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8019c7:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8019ce:	40 80 00 
+  8019d1:	83 c4 10             	add    $0x10,%esp
+  8019d4:	e9 4f ff ff ff       	jmp    801928 <fsring_reap+0xb6>
+			return 0;
+  8019d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019de:	e9 b1 fe ff ff       	jmp    801894 <fsring_reap+0x22>
+
+008019e3 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8019e3:	55                   	push   %ebp
+  8019e4:	89 e5                	mov    %esp,%ebp
+  8019e6:	57                   	push   %edi
+  8019e7:	56                   	push   %esi
+  8019e8:	53                   	push   %ebx
+  8019e9:	83 ec 28             	sub    $0x28,%esp
+  8019ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019ef:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8019f2:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8019f5:	53                   	push   %ebx
+  8019f6:	e8 f3 11 00 00       	call   802bee <strlen>
+  8019fb:	83 c4 10             	add    $0x10,%esp
+  8019fe:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a03:	0f 8f 02 01 00 00    	jg     801b0b <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  801a09:	83 ec 08             	sub    $0x8,%esp
+  801a0c:	53                   	push   %ebx
+  801a0d:	68 00 60 80 00       	push   $0x806000
+  801a12:	e8 12 12 00 00       	call   802c29 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  801a17:	83 c4 10             	add    $0x10,%esp
+  801a1a:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  801a20:	76 69                	jbe    801a8b <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801a22:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a25:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801a2b:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801a30:	29 d1                	sub    %edx,%ecx
+  801a32:	39 f9                	cmp    %edi,%ecx
+  801a34:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a3a:	89 f9                	mov    %edi,%ecx
+  801a3c:	01 c1                	add    %eax,%ecx
+  801a3e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a41:	eb 0f                	jmp    801a52 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  801a43:	0f b6 10             	movzbl (%eax),%edx
+  801a46:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a48:	05 00 10 00 00       	add    $0x1000,%eax
+  801a4d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a52:	39 c8                	cmp    %ecx,%eax
+  801a54:	72 ed                	jb     801a43 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  801a56:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a59:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  801a5f:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  801a65:	83 ec 0c             	sub    $0xc,%esp
+  801a68:	6a 07                	push   $0x7
+  801a6a:	89 f9                	mov    %edi,%ecx
+  801a6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a6f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a74:	e8 3f f1 ff ff       	call   800bb8 <fsipc_pages>
+  801a79:	89 c7                	mov    %eax,%edi
+  801a7b:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  801a7e:	85 f6                	test   %esi,%esi
+  801a80:	74 7f                	je     801b01 <file_slurp+0x11e>
+  801a82:	8d 43 01             	lea    0x1(%ebx),%eax
+  801a85:	85 ff                	test   %edi,%edi
+  801a87:	79 3c                	jns    801ac5 <file_slurp+0xe2>
+  801a89:	eb 76                	jmp    801b01 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  801a8b:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  801a91:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a96:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a9b:	e8 ba f2 ff ff       	call   800d5a <fsipc>
+  801aa0:	89 c7                	mov    %eax,%edi
+  801aa2:	85 c0                	test   %eax,%eax
+  801aa4:	7e d8                	jle    801a7e <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  801aa6:	83 ec 04             	sub    $0x4,%esp
+  801aa9:	50                   	push   %eax
+  801aaa:	68 08 60 80 00       	push   $0x806008
+  801aaf:	ff 75 0c             	push   0xc(%ebp)
+  801ab2:	e8 f8 12 00 00       	call   802daf <memmove>
+  801ab7:	83 c4 10             	add    $0x10,%esp
+  801aba:	eb c2                	jmp    801a7e <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  801abc:	80 fa 2f             	cmp    $0x2f,%dl
+  801abf:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  801ac2:	83 c0 01             	add    $0x1,%eax
+  801ac5:	89 c1                	mov    %eax,%ecx
+  801ac7:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  801acb:	84 d2                	test   %dl,%dl
+  801acd:	75 ed                	jne    801abc <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  801acf:	83 ec 04             	sub    $0x4,%esp
+  801ad2:	68 80 00 00 00       	push   $0x80
+  801ad7:	53                   	push   %ebx
+  801ad8:	56                   	push   %esi
+  801ad9:	e8 c1 11 00 00       	call   802c9f <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  801ade:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ae3:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  801ae9:	a1 04 60 80 00       	mov    0x806004,%eax
+  801aee:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  801af4:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  801afb:	40 80 00 
+  801afe:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801b01:	89 f8                	mov    %edi,%eax
+  801b03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b06:	5b                   	pop    %ebx
+  801b07:	5e                   	pop    %esi
+  801b08:	5f                   	pop    %edi
+  801b09:	5d                   	pop    %ebp
+  801b0a:	c3                   	ret
+		return -E_BAD_PATH;
+  801b0b:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  801b10:	eb ef                	jmp    801b01 <file_slurp+0x11e>
+
+00801b12 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801b12:	55                   	push   %ebp
+  801b13:	89 e5                	mov    %esp,%ebp
+  801b15:	53                   	push   %ebx
+  801b16:	83 ec 10             	sub    $0x10,%esp
+  801b19:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b1c:	53                   	push   %ebx
+  801b1d:	e8 cc 10 00 00       	call   802bee <strlen>
+  801b22:	83 c4 10             	add    $0x10,%esp
+  801b25:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b2a:	7f 25                	jg     801b51 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b2c:	83 ec 08             	sub    $0x8,%esp
+  801b2f:	53                   	push   %ebx
+  801b30:	68 00 60 80 00       	push   $0x806000
+  801b35:	e8 ef 10 00 00       	call   802c29 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b44:	e8 11 f2 ff ff       	call   800d5a <fsipc>
+  801b49:	83 c4 10             	add    $0x10,%esp
+}
+  801b4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b4f:	c9                   	leave
+  801b50:	c3                   	ret
+		return -E_BAD_PATH;
+  801b51:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b56:	eb f4                	jmp    801b4c <remove+0x3a>
+
+00801b58 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b58:	55                   	push   %ebp
+  801b59:	89 e5                	mov    %esp,%ebp
+  801b5b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b63:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b68:	e8 ed f1 ff ff       	call   800d5a <fsipc>
+}
+  801b6d:	c9                   	leave
+  801b6e:	c3                   	ret
+
+00801b6f <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  801b6f:	55                   	push   %ebp
+  801b70:	89 e5                	mov    %esp,%ebp
+  801b72:	57                   	push   %edi
+  801b73:	56                   	push   %esi
+  801b74:	53                   	push   %ebx
+  801b75:	83 ec 18             	sub    $0x18,%esp
+  801b78:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b7b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801b81:	57                   	push   %edi
+  801b82:	e8 67 10 00 00       	call   802bee <strlen>
+  801b87:	83 c4 10             	add    $0x10,%esp
+  801b8a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b8f:	7f 4c                	jg     801bdd <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  801b91:	83 ec 08             	sub    $0x8,%esp
+  801b94:	57                   	push   %edi
+  801b95:	68 00 60 80 00       	push   $0x806000
+  801b9a:	e8 8a 10 00 00       	call   802c29 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  801b9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba4:	b8 10 00 00 00       	mov    $0x10,%eax
+  801ba9:	e8 ac f1 ff ff       	call   800d5a <fsipc>
+  801bae:	83 c4 10             	add    $0x10,%esp
+  801bb1:	85 c0                	test   %eax,%eax
+  801bb3:	78 20                	js     801bd5 <defrag+0x66>
+		return r;
+	if (before)
+  801bb5:	85 f6                	test   %esi,%esi
+  801bb7:	74 07                	je     801bc0 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  801bb9:	a1 00 60 80 00       	mov    0x806000,%eax
+  801bbe:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  801bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  801bc5:	85 db                	test   %ebx,%ebx
+  801bc7:	74 0c                	je     801bd5 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  801bc9:	a1 04 60 80 00       	mov    0x806004,%eax
+  801bce:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  801bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd8:	5b                   	pop    %ebx
+  801bd9:	5e                   	pop    %esi
+  801bda:	5f                   	pop    %edi
+  801bdb:	5d                   	pop    %ebp
+  801bdc:	c3                   	ret
+		return -E_BAD_PATH;
+  801bdd:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801be2:	eb f1                	jmp    801bd5 <defrag+0x66>
+
+00801be4 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  801be4:	55                   	push   %ebp
+  801be5:	89 e5                	mov    %esp,%ebp
+  801be7:	53                   	push   %ebx
+  801be8:	83 ec 04             	sub    $0x4,%esp
+  801beb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  801bee:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf3:	b8 11 00 00 00       	mov    $0x11,%eax
+  801bf8:	e8 5d f1 ff ff       	call   800d5a <fsipc>
+  801bfd:	85 c0                	test   %eax,%eax
+  801bff:	78 34                	js     801c35 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  801c01:	a1 00 60 80 00       	mov    0x806000,%eax
+  801c06:	89 03                	mov    %eax,(%ebx)
+  801c08:	a1 04 60 80 00       	mov    0x806004,%eax
+  801c0d:	89 43 04             	mov    %eax,0x4(%ebx)
+  801c10:	a1 08 60 80 00       	mov    0x806008,%eax
+  801c15:	89 43 08             	mov    %eax,0x8(%ebx)
+  801c18:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  801c1d:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801c20:	a1 10 60 80 00       	mov    0x806010,%eax
+  801c25:	89 43 10             	mov    %eax,0x10(%ebx)
+  801c28:	a1 14 60 80 00       	mov    0x806014,%eax
+  801c2d:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  801c30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c38:	c9                   	leave
+  801c39:	c3                   	ret
+
+00801c3a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c3a:	55                   	push   %ebp
+  801c3b:	89 e5                	mov    %esp,%ebp
+  801c3d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c40:	68 ba 38 80 00       	push   $0x8038ba
+  801c45:	ff 75 0c             	push   0xc(%ebp)
+  801c48:	e8 dc 0f 00 00       	call   802c29 <strcpy>
+	return 0;
+}
+  801c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c52:	c9                   	leave
+  801c53:	c3                   	ret
+
+00801c54 <devsock_close>:
+{
+  801c54:	55                   	push   %ebp
+  801c55:	89 e5                	mov    %esp,%ebp
+  801c57:	53                   	push   %ebx
+  801c58:	83 ec 10             	sub    $0x10,%esp
+  801c5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c5e:	53                   	push   %ebx
+  801c5f:	e8 ed 17 00 00       	call   803451 <pageref>
+  801c64:	89 c2                	mov    %eax,%edx
+  801c66:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c69:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c6e:	83 fa 01             	cmp    $0x1,%edx
+  801c71:	74 05                	je     801c78 <devsock_close+0x24>
+}
+  801c73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c76:	c9                   	leave
+  801c77:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c78:	83 ec 0c             	sub    $0xc,%esp
+  801c7b:	ff 73 0c             	push   0xc(%ebx)
+  801c7e:	e8 b7 02 00 00       	call   801f3a <nsipc_close>
+  801c83:	83 c4 10             	add    $0x10,%esp
+  801c86:	eb eb                	jmp    801c73 <devsock_close+0x1f>
+
+00801c88 <devsock_write>:
+{
+  801c88:	55                   	push   %ebp
+  801c89:	89 e5                	mov    %esp,%ebp
+  801c8b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c8e:	6a 00                	push   $0x0
+  801c90:	ff 75 10             	push   0x10(%ebp)
+  801c93:	ff 75 0c             	push   0xc(%ebp)
+  801c96:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c99:	ff 70 0c             	push   0xc(%eax)
+  801c9c:	e8 79 03 00 00       	call   80201a <nsipc_send>
+}
+  801ca1:	c9                   	leave
+  801ca2:	c3                   	ret
+
+00801ca3 <devsock_read>:
+{
+  801ca3:	55                   	push   %ebp
+  801ca4:	89 e5                	mov    %esp,%ebp
+  801ca6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801ca9:	6a 00                	push   $0x0
+  801cab:	ff 75 10             	push   0x10(%ebp)
+  801cae:	ff 75 0c             	push   0xc(%ebp)
+  801cb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cb4:	ff 70 0c             	push   0xc(%eax)
+  801cb7:	e8 ef 02 00 00       	call   801fab <nsipc_recv>
+}
+  801cbc:	c9                   	leave
+  801cbd:	c3                   	ret
+
+00801cbe <fd2sockid>:
+{
+  801cbe:	55                   	push   %ebp
+  801cbf:	89 e5                	mov    %esp,%ebp
+  801cc1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801cc4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801cc7:	52                   	push   %edx
+  801cc8:	50                   	push   %eax
+  801cc9:	e8 54 e9 ff ff       	call   800622 <fd_lookup>
+  801cce:	83 c4 10             	add    $0x10,%esp
+  801cd1:	85 c0                	test   %eax,%eax
+  801cd3:	78 10                	js     801ce5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801cd5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cd8:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801cde:	39 08                	cmp    %ecx,(%eax)
+  801ce0:	75 05                	jne    801ce7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801ce2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801ce5:	c9                   	leave
+  801ce6:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ce7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cec:	eb f7                	jmp    801ce5 <fd2sockid+0x27>
+
+00801cee <alloc_sockfd>:
+{
+  801cee:	55                   	push   %ebp
+  801cef:	89 e5                	mov    %esp,%ebp
+  801cf1:	56                   	push   %esi
+  801cf2:	53                   	push   %ebx
+  801cf3:	83 ec 1c             	sub    $0x1c,%esp
+  801cf6:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801cf8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cfb:	50                   	push   %eax
+  801cfc:	e8 cb e8 ff ff       	call   8005cc <fd_alloc>
+  801d01:	89 c3                	mov    %eax,%ebx
+  801d03:	83 c4 10             	add    $0x10,%esp
+  801d06:	85 c0                	test   %eax,%eax
+  801d08:	78 43                	js     801d4d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d0a:	83 ec 04             	sub    $0x4,%esp
+  801d0d:	68 07 04 00 00       	push   $0x407
+  801d12:	ff 75 f4             	push   -0xc(%ebp)
+  801d15:	6a 00                	push   $0x0
+  801d17:	e8 88 e4 ff ff       	call   8001a4 <sys_page_alloc>
+  801d1c:	89 c3                	mov    %eax,%ebx
+  801d1e:	83 c4 10             	add    $0x10,%esp
+  801d21:	85 c0                	test   %eax,%eax
+  801d23:	78 28                	js     801d4d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d28:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801d2e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d33:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d3a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d3d:	83 ec 0c             	sub    $0xc,%esp
+  801d40:	50                   	push   %eax
+  801d41:	e8 5f e8 ff ff       	call   8005a5 <fd2num>
+  801d46:	89 c3                	mov    %eax,%ebx
+  801d48:	83 c4 10             	add    $0x10,%esp
+  801d4b:	eb 0c                	jmp    801d59 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d4d:	83 ec 0c             	sub    $0xc,%esp
+  801d50:	56                   	push   %esi
+  801d51:	e8 e4 01 00 00       	call   801f3a <nsipc_close>
+		return r;
+  801d56:	83 c4 10             	add    $0x10,%esp
+}
+  801d59:	89 d8                	mov    %ebx,%eax
+  801d5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d5e:	5b                   	pop    %ebx
+  801d5f:	5e                   	pop    %esi
+  801d60:	5d                   	pop    %ebp
+  801d61:	c3                   	ret
+
+00801d62 <accept>:
+{
+  801d62:	55                   	push   %ebp
+  801d63:	89 e5                	mov    %esp,%ebp
+  801d65:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d68:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d6b:	e8 4e ff ff ff       	call   801cbe <fd2sockid>
+  801d70:	85 c0                	test   %eax,%eax
+  801d72:	78 1b                	js     801d8f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d74:	83 ec 04             	sub    $0x4,%esp
+  801d77:	ff 75 10             	push   0x10(%ebp)
+  801d7a:	ff 75 0c             	push   0xc(%ebp)
+  801d7d:	50                   	push   %eax
+  801d7e:	e8 0e 01 00 00       	call   801e91 <nsipc_accept>
+  801d83:	83 c4 10             	add    $0x10,%esp
+  801d86:	85 c0                	test   %eax,%eax
+  801d88:	78 05                	js     801d8f <accept+0x2d>
+	return alloc_sockfd(r);
+  801d8a:	e8 5f ff ff ff       	call   801cee <alloc_sockfd>
+}
+  801d8f:	c9                   	leave
+  801d90:	c3                   	ret
+
+00801d91 <bind>:
+{
+  801d91:	55                   	push   %ebp
+  801d92:	89 e5                	mov    %esp,%ebp
+  801d94:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d97:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d9a:	e8 1f ff ff ff       	call   801cbe <fd2sockid>
+  801d9f:	85 c0                	test   %eax,%eax
+  801da1:	78 12                	js     801db5 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801da3:	83 ec 04             	sub    $0x4,%esp
+  801da6:	ff 75 10             	push   0x10(%ebp)
+  801da9:	ff 75 0c             	push   0xc(%ebp)
+  801dac:	50                   	push   %eax
+  801dad:	e8 31 01 00 00       	call   801ee3 <nsipc_bind>
+  801db2:	83 c4 10             	add    $0x10,%esp
+}
+  801db5:	c9                   	leave
+  801db6:	c3                   	ret
+
+00801db7 <shutdown>:
+{
+  801db7:	55                   	push   %ebp
+  801db8:	89 e5                	mov    %esp,%ebp
+  801dba:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc0:	e8 f9 fe ff ff       	call   801cbe <fd2sockid>
+  801dc5:	85 c0                	test   %eax,%eax
+  801dc7:	78 0f                	js     801dd8 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801dc9:	83 ec 08             	sub    $0x8,%esp
+  801dcc:	ff 75 0c             	push   0xc(%ebp)
+  801dcf:	50                   	push   %eax
+  801dd0:	e8 43 01 00 00       	call   801f18 <nsipc_shutdown>
+  801dd5:	83 c4 10             	add    $0x10,%esp
+}
+  801dd8:	c9                   	leave
+  801dd9:	c3                   	ret
+
+00801dda <connect>:
+{
+  801dda:	55                   	push   %ebp
+  801ddb:	89 e5                	mov    %esp,%ebp
+  801ddd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801de0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801de3:	e8 d6 fe ff ff       	call   801cbe <fd2sockid>
+  801de8:	85 c0                	test   %eax,%eax
+  801dea:	78 12                	js     801dfe <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801dec:	83 ec 04             	sub    $0x4,%esp
+  801def:	ff 75 10             	push   0x10(%ebp)
+  801df2:	ff 75 0c             	push   0xc(%ebp)
+  801df5:	50                   	push   %eax
+  801df6:	e8 59 01 00 00       	call   801f54 <nsipc_connect>
+  801dfb:	83 c4 10             	add    $0x10,%esp
+}
+  801dfe:	c9                   	leave
+  801dff:	c3                   	ret
+
+00801e00 <listen>:
+{
+  801e00:	55                   	push   %ebp
+  801e01:	89 e5                	mov    %esp,%ebp
+  801e03:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e06:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e09:	e8 b0 fe ff ff       	call   801cbe <fd2sockid>
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	78 0f                	js     801e21 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e12:	83 ec 08             	sub    $0x8,%esp
+  801e15:	ff 75 0c             	push   0xc(%ebp)
+  801e18:	50                   	push   %eax
+  801e19:	e8 6b 01 00 00       	call   801f89 <nsipc_listen>
+  801e1e:	83 c4 10             	add    $0x10,%esp
+}
+  801e21:	c9                   	leave
+  801e22:	c3                   	ret
+
+00801e23 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e23:	55                   	push   %ebp
+  801e24:	89 e5                	mov    %esp,%ebp
+  801e26:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e29:	ff 75 10             	push   0x10(%ebp)
+  801e2c:	ff 75 0c             	push   0xc(%ebp)
+  801e2f:	ff 75 08             	push   0x8(%ebp)
+  801e32:	e8 41 02 00 00       	call   802078 <nsipc_socket>
+  801e37:	83 c4 10             	add    $0x10,%esp
+  801e3a:	85 c0                	test   %eax,%eax
+  801e3c:	78 05                	js     801e43 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e3e:	e8 ab fe ff ff       	call   801cee <alloc_sockfd>
+}
+  801e43:	c9                   	leave
+  801e44:	c3                   	ret
+
+00801e45 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e45:	55                   	push   %ebp
+  801e46:	89 e5                	mov    %esp,%ebp
+  801e48:	53                   	push   %ebx
+  801e49:	83 ec 04             	sub    $0x4,%esp
+  801e4c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e4e:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  801e55:	74 26                	je     801e7d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e57:	6a 07                	push   $0x7
+  801e59:	68 00 80 80 00       	push   $0x808000
+  801e5e:	53                   	push   %ebx
+  801e5f:	ff 35 00 90 80 00    	push   0x809000
+  801e65:	e8 6f 14 00 00       	call   8032d9 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e6a:	83 c4 0c             	add    $0xc,%esp
+  801e6d:	6a 00                	push   $0x0
+  801e6f:	6a 00                	push   $0x0
+  801e71:	6a 00                	push   $0x0
+  801e73:	e8 f6 13 00 00       	call   80326e <ipc_recv>
+}
+  801e78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e7b:	c9                   	leave
+  801e7c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e7d:	83 ec 0c             	sub    $0xc,%esp
+  801e80:	6a 02                	push   $0x2
+  801e82:	e8 8b 15 00 00       	call   803412 <ipc_find_env>
+  801e87:	a3 00 90 80 00       	mov    %eax,0x809000
+  801e8c:	83 c4 10             	add    $0x10,%esp
+  801e8f:	eb c6                	jmp    801e57 <nsipc+0x12>
+
+00801e91 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e91:	55                   	push   %ebp
+  801e92:	89 e5                	mov    %esp,%ebp
+  801e94:	56                   	push   %esi
+  801e95:	53                   	push   %ebx
+  801e96:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e99:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e9c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801ea1:	8b 06                	mov    (%esi),%eax
+  801ea3:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ea8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ead:	e8 93 ff ff ff       	call   801e45 <nsipc>
+  801eb2:	89 c3                	mov    %eax,%ebx
+  801eb4:	85 c0                	test   %eax,%eax
+  801eb6:	79 09                	jns    801ec1 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801eb8:	89 d8                	mov    %ebx,%eax
+  801eba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ebd:	5b                   	pop    %ebx
+  801ebe:	5e                   	pop    %esi
+  801ebf:	5d                   	pop    %ebp
+  801ec0:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801ec1:	83 ec 04             	sub    $0x4,%esp
+  801ec4:	ff 35 10 80 80 00    	push   0x808010
+  801eca:	68 00 80 80 00       	push   $0x808000
+  801ecf:	ff 75 0c             	push   0xc(%ebp)
+  801ed2:	e8 d8 0e 00 00       	call   802daf <memmove>
+		*addrlen = ret->ret_addrlen;
+  801ed7:	a1 10 80 80 00       	mov    0x808010,%eax
+  801edc:	89 06                	mov    %eax,(%esi)
+  801ede:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801ee1:	eb d5                	jmp    801eb8 <nsipc_accept+0x27>
+
+00801ee3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801ee3:	55                   	push   %ebp
+  801ee4:	89 e5                	mov    %esp,%ebp
+  801ee6:	53                   	push   %ebx
+  801ee7:	83 ec 08             	sub    $0x8,%esp
+  801eea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801eed:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef0:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ef5:	53                   	push   %ebx
+  801ef6:	ff 75 0c             	push   0xc(%ebp)
+  801ef9:	68 04 80 80 00       	push   $0x808004
+  801efe:	e8 ac 0e 00 00       	call   802daf <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f03:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801f09:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f0e:	e8 32 ff ff ff       	call   801e45 <nsipc>
+}
+  801f13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f16:	c9                   	leave
+  801f17:	c3                   	ret
+
+00801f18 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f18:	55                   	push   %ebp
+  801f19:	89 e5                	mov    %esp,%ebp
+  801f1b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f21:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801f26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f29:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f2e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f33:	e8 0d ff ff ff       	call   801e45 <nsipc>
+}
+  801f38:	c9                   	leave
+  801f39:	c3                   	ret
+
+00801f3a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f3a:	55                   	push   %ebp
+  801f3b:	89 e5                	mov    %esp,%ebp
+  801f3d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f40:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f43:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f48:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f4d:	e8 f3 fe ff ff       	call   801e45 <nsipc>
+}
+  801f52:	c9                   	leave
+  801f53:	c3                   	ret
+
+00801f54 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f54:	55                   	push   %ebp
+  801f55:	89 e5                	mov    %esp,%ebp
+  801f57:	53                   	push   %ebx
+  801f58:	83 ec 08             	sub    $0x8,%esp
+  801f5b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f61:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f66:	53                   	push   %ebx
+  801f67:	ff 75 0c             	push   0xc(%ebp)
+  801f6a:	68 04 80 80 00       	push   $0x808004
+  801f6f:	e8 3b 0e 00 00       	call   802daf <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f74:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801f7a:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f7f:	e8 c1 fe ff ff       	call   801e45 <nsipc>
+}
+  801f84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f87:	c9                   	leave
+  801f88:	c3                   	ret
+
+00801f89 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f89:	55                   	push   %ebp
+  801f8a:	89 e5                	mov    %esp,%ebp
+  801f8c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f92:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f9a:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801f9f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fa4:	e8 9c fe ff ff       	call   801e45 <nsipc>
+}
+  801fa9:	c9                   	leave
+  801faa:	c3                   	ret
+
+00801fab <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801fab:	55                   	push   %ebp
+  801fac:	89 e5                	mov    %esp,%ebp
+  801fae:	56                   	push   %esi
+  801faf:	53                   	push   %ebx
+  801fb0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801fb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb6:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801fbb:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801fc1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fc4:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801fc9:	b8 07 00 00 00       	mov    $0x7,%eax
+  801fce:	e8 72 fe ff ff       	call   801e45 <nsipc>
+  801fd3:	89 c3                	mov    %eax,%ebx
+  801fd5:	85 c0                	test   %eax,%eax
+  801fd7:	78 22                	js     801ffb <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801fd9:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801fde:	39 c6                	cmp    %eax,%esi
+  801fe0:	0f 4e c6             	cmovle %esi,%eax
+  801fe3:	39 c3                	cmp    %eax,%ebx
+  801fe5:	7f 1d                	jg     802004 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801fe7:	83 ec 04             	sub    $0x4,%esp
+  801fea:	53                   	push   %ebx
+  801feb:	68 00 80 80 00       	push   $0x808000
+  801ff0:	ff 75 0c             	push   0xc(%ebp)
+  801ff3:	e8 b7 0d 00 00       	call   802daf <memmove>
+  801ff8:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801ffb:	89 d8                	mov    %ebx,%eax
+  801ffd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802000:	5b                   	pop    %ebx
+  802001:	5e                   	pop    %esi
+  802002:	5d                   	pop    %ebp
+  802003:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802004:	68 c6 38 80 00       	push   $0x8038c6
+  802009:	68 64 38 80 00       	push   $0x803864
+  80200e:	6a 62                	push   $0x62
+  802010:	68 db 38 80 00       	push   $0x8038db
+  802015:	e8 46 05 00 00       	call   802560 <_panic>
+
+0080201a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80201a:	55                   	push   %ebp
+  80201b:	89 e5                	mov    %esp,%ebp
+  80201d:	53                   	push   %ebx
+  80201e:	83 ec 04             	sub    $0x4,%esp
+  802021:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802024:	8b 45 08             	mov    0x8(%ebp),%eax
+  802027:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80202c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802032:	7f 2e                	jg     802062 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802034:	83 ec 04             	sub    $0x4,%esp
+  802037:	53                   	push   %ebx
+  802038:	ff 75 0c             	push   0xc(%ebp)
+  80203b:	68 0c 80 80 00       	push   $0x80800c
+  802040:	e8 6a 0d 00 00       	call   802daf <memmove>
+	nsipcbuf.send.req_size = size;
+  802045:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  80204b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80204e:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802053:	b8 08 00 00 00       	mov    $0x8,%eax
+  802058:	e8 e8 fd ff ff       	call   801e45 <nsipc>
+}
+  80205d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802060:	c9                   	leave
+  802061:	c3                   	ret
+	assert(size < 1600);
+  802062:	68 e7 38 80 00       	push   $0x8038e7
+  802067:	68 64 38 80 00       	push   $0x803864
+  80206c:	6a 6d                	push   $0x6d
+  80206e:	68 db 38 80 00       	push   $0x8038db
+  802073:	e8 e8 04 00 00       	call   802560 <_panic>
+
+00802078 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802078:	55                   	push   %ebp
+  802079:	89 e5                	mov    %esp,%ebp
+  80207b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80207e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802081:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802086:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802089:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  80208e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802091:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802096:	b8 09 00 00 00       	mov    $0x9,%eax
+  80209b:	e8 a5 fd ff ff       	call   801e45 <nsipc>
+}
+  8020a0:	c9                   	leave
+  8020a1:	c3                   	ret
+
+008020a2 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020a2:	55                   	push   %ebp
+  8020a3:	89 e5                	mov    %esp,%ebp
+  8020a5:	56                   	push   %esi
+  8020a6:	53                   	push   %ebx
+  8020a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8020aa:	83 ec 0c             	sub    $0xc,%esp
+  8020ad:	ff 75 08             	push   0x8(%ebp)
+  8020b0:	e8 00 e5 ff ff       	call   8005b5 <fd2data>
+  8020b5:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8020b7:	83 c4 08             	add    $0x8,%esp
+  8020ba:	68 f3 38 80 00       	push   $0x8038f3
+  8020bf:	53                   	push   %ebx
+  8020c0:	e8 64 0b 00 00       	call   802c29 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8020c5:	8b 46 04             	mov    0x4(%esi),%eax
+  8020c8:	2b 06                	sub    (%esi),%eax
+  8020ca:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8020d0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020d7:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020da:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  8020e1:	40 80 00 
+	return 0;
+}
+  8020e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020ec:	5b                   	pop    %ebx
+  8020ed:	5e                   	pop    %esi
+  8020ee:	5d                   	pop    %ebp
+  8020ef:	c3                   	ret
+
+008020f0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020f0:	55                   	push   %ebp
+  8020f1:	89 e5                	mov    %esp,%ebp
+  8020f3:	53                   	push   %ebx
+  8020f4:	83 ec 0c             	sub    $0xc,%esp
+  8020f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020fa:	53                   	push   %ebx
+  8020fb:	6a 00                	push   $0x0
+  8020fd:	e8 2f e1 ff ff       	call   800231 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802102:	89 1c 24             	mov    %ebx,(%esp)
+  802105:	e8 ab e4 ff ff       	call   8005b5 <fd2data>
+  80210a:	83 c4 08             	add    $0x8,%esp
+  80210d:	50                   	push   %eax
+  80210e:	6a 00                	push   $0x0
+  802110:	e8 1c e1 ff ff       	call   800231 <sys_page_unmap>
+}
+  802115:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802118:	c9                   	leave
+  802119:	c3                   	ret
+
+0080211a <_pipeisclosed>:
+{
+  80211a:	55                   	push   %ebp
+  80211b:	89 e5                	mov    %esp,%ebp
+  80211d:	57                   	push   %edi
+  80211e:	56                   	push   %esi
+  80211f:	53                   	push   %ebx
+  802120:	83 ec 1c             	sub    $0x1c,%esp
+  802123:	89 c7                	mov    %eax,%edi
+  802125:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802127:	a1 00 50 80 00       	mov    0x805000,%eax
+  80212c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80212f:	83 ec 0c             	sub    $0xc,%esp
+  802132:	57                   	push   %edi
+  802133:	e8 19 13 00 00       	call   803451 <pageref>
+  802138:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80213b:	89 34 24             	mov    %esi,(%esp)
+  80213e:	e8 0e 13 00 00       	call   803451 <pageref>
+		nn = thisenv->env_runs;
+  802143:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802149:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80214c:	83 c4 10             	add    $0x10,%esp
+  80214f:	39 cb                	cmp    %ecx,%ebx
+  802151:	74 1b                	je     80216e <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802153:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802156:	75 cf                	jne    802127 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802158:	8b 42 58             	mov    0x58(%edx),%eax
+  80215b:	6a 01                	push   $0x1
+  80215d:	50                   	push   %eax
+  80215e:	53                   	push   %ebx
+  80215f:	68 fa 38 80 00       	push   $0x8038fa
+  802164:	e8 d2 04 00 00       	call   80263b <cprintf>
+  802169:	83 c4 10             	add    $0x10,%esp
+  80216c:	eb b9                	jmp    802127 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80216e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802171:	0f 94 c0             	sete   %al
+  802174:	0f b6 c0             	movzbl %al,%eax
+}
+  802177:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80217a:	5b                   	pop    %ebx
+  80217b:	5e                   	pop    %esi
+  80217c:	5f                   	pop    %edi
+  80217d:	5d                   	pop    %ebp
+  80217e:	c3                   	ret
+
+0080217f <devpipe_write>:
+{
+  80217f:	55                   	push   %ebp
+  802180:	89 e5                	mov    %esp,%ebp
+  802182:	57                   	push   %edi
+  802183:	56                   	push   %esi
+  802184:	53                   	push   %ebx
+  802185:	83 ec 28             	sub    $0x28,%esp
+  802188:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80218b:	56                   	push   %esi
+  80218c:	e8 24 e4 ff ff       	call   8005b5 <fd2data>
+  802191:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802193:	83 c4 10             	add    $0x10,%esp
+  802196:	bf 00 00 00 00       	mov    $0x0,%edi
+  80219b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80219e:	75 09                	jne    8021a9 <devpipe_write+0x2a>
+	return i;
+  8021a0:	89 f8                	mov    %edi,%eax
+  8021a2:	eb 23                	jmp    8021c7 <devpipe_write+0x48>
+			sys_yield();
+  8021a4:	e8 dc df ff ff       	call   800185 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8021a9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8021ac:	8b 0b                	mov    (%ebx),%ecx
+  8021ae:	8d 51 20             	lea    0x20(%ecx),%edx
+  8021b1:	39 d0                	cmp    %edx,%eax
+  8021b3:	72 1a                	jb     8021cf <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8021b5:	89 da                	mov    %ebx,%edx
+  8021b7:	89 f0                	mov    %esi,%eax
+  8021b9:	e8 5c ff ff ff       	call   80211a <_pipeisclosed>
+  8021be:	85 c0                	test   %eax,%eax
+  8021c0:	74 e2                	je     8021a4 <devpipe_write+0x25>
+				return 0;
+  8021c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ca:	5b                   	pop    %ebx
+  8021cb:	5e                   	pop    %esi
+  8021cc:	5f                   	pop    %edi
+  8021cd:	5d                   	pop    %ebp
+  8021ce:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021d2:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021d6:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021d9:	89 c2                	mov    %eax,%edx
+  8021db:	c1 fa 1f             	sar    $0x1f,%edx
+  8021de:	89 d1                	mov    %edx,%ecx
+  8021e0:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021e3:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021e6:	83 e2 1f             	and    $0x1f,%edx
+  8021e9:	29 ca                	sub    %ecx,%edx
+  8021eb:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8021ef:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021f3:	83 c0 01             	add    $0x1,%eax
+  8021f6:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8021f9:	83 c7 01             	add    $0x1,%edi
+  8021fc:	eb 9d                	jmp    80219b <devpipe_write+0x1c>
+
+008021fe <devpipe_read>:
+{
+  8021fe:	55                   	push   %ebp
+  8021ff:	89 e5                	mov    %esp,%ebp
+  802201:	57                   	push   %edi
+  802202:	56                   	push   %esi
+  802203:	53                   	push   %ebx
+  802204:	83 ec 18             	sub    $0x18,%esp
+  802207:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80220a:	57                   	push   %edi
+  80220b:	e8 a5 e3 ff ff       	call   8005b5 <fd2data>
+  802210:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802212:	83 c4 10             	add    $0x10,%esp
+  802215:	be 00 00 00 00       	mov    $0x0,%esi
+  80221a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80221d:	75 13                	jne    802232 <devpipe_read+0x34>
+	return i;
+  80221f:	89 f0                	mov    %esi,%eax
+  802221:	eb 02                	jmp    802225 <devpipe_read+0x27>
+				return i;
+  802223:	89 f0                	mov    %esi,%eax
+}
+  802225:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802228:	5b                   	pop    %ebx
+  802229:	5e                   	pop    %esi
+  80222a:	5f                   	pop    %edi
+  80222b:	5d                   	pop    %ebp
+  80222c:	c3                   	ret
+			sys_yield();
+  80222d:	e8 53 df ff ff       	call   800185 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802232:	8b 03                	mov    (%ebx),%eax
+  802234:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802237:	75 18                	jne    802251 <devpipe_read+0x53>
+			if (i > 0)
+  802239:	85 f6                	test   %esi,%esi
+  80223b:	75 e6                	jne    802223 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80223d:	89 da                	mov    %ebx,%edx
+  80223f:	89 f8                	mov    %edi,%eax
+  802241:	e8 d4 fe ff ff       	call   80211a <_pipeisclosed>
+  802246:	85 c0                	test   %eax,%eax
+  802248:	74 e3                	je     80222d <devpipe_read+0x2f>
+				return 0;
+  80224a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224f:	eb d4                	jmp    802225 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802251:	99                   	cltd
+  802252:	c1 ea 1b             	shr    $0x1b,%edx
+  802255:	01 d0                	add    %edx,%eax
+  802257:	83 e0 1f             	and    $0x1f,%eax
+  80225a:	29 d0                	sub    %edx,%eax
+  80225c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802261:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802264:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802267:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80226a:	83 c6 01             	add    $0x1,%esi
+  80226d:	eb ab                	jmp    80221a <devpipe_read+0x1c>
+
+0080226f <pipe>:
+{
+  80226f:	55                   	push   %ebp
+  802270:	89 e5                	mov    %esp,%ebp
+  802272:	56                   	push   %esi
+  802273:	53                   	push   %ebx
+  802274:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802277:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80227a:	50                   	push   %eax
+  80227b:	e8 4c e3 ff ff       	call   8005cc <fd_alloc>
+  802280:	89 c3                	mov    %eax,%ebx
+  802282:	83 c4 10             	add    $0x10,%esp
+  802285:	85 c0                	test   %eax,%eax
+  802287:	0f 88 23 01 00 00    	js     8023b0 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80228d:	83 ec 04             	sub    $0x4,%esp
+  802290:	68 07 04 00 00       	push   $0x407
+  802295:	ff 75 f4             	push   -0xc(%ebp)
+  802298:	6a 00                	push   $0x0
+  80229a:	e8 05 df ff ff       	call   8001a4 <sys_page_alloc>
+  80229f:	89 c3                	mov    %eax,%ebx
+  8022a1:	83 c4 10             	add    $0x10,%esp
+  8022a4:	85 c0                	test   %eax,%eax
+  8022a6:	0f 88 04 01 00 00    	js     8023b0 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8022ac:	83 ec 0c             	sub    $0xc,%esp
+  8022af:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022b2:	50                   	push   %eax
+  8022b3:	e8 14 e3 ff ff       	call   8005cc <fd_alloc>
+  8022b8:	89 c3                	mov    %eax,%ebx
+  8022ba:	83 c4 10             	add    $0x10,%esp
+  8022bd:	85 c0                	test   %eax,%eax
+  8022bf:	0f 88 db 00 00 00    	js     8023a0 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022c5:	83 ec 04             	sub    $0x4,%esp
+  8022c8:	68 07 04 00 00       	push   $0x407
+  8022cd:	ff 75 f0             	push   -0x10(%ebp)
+  8022d0:	6a 00                	push   $0x0
+  8022d2:	e8 cd de ff ff       	call   8001a4 <sys_page_alloc>
+  8022d7:	89 c3                	mov    %eax,%ebx
+  8022d9:	83 c4 10             	add    $0x10,%esp
+  8022dc:	85 c0                	test   %eax,%eax
+  8022de:	0f 88 bc 00 00 00    	js     8023a0 <pipe+0x131>
+	va = fd2data(fd0);
+  8022e4:	83 ec 0c             	sub    $0xc,%esp
+  8022e7:	ff 75 f4             	push   -0xc(%ebp)
+  8022ea:	e8 c6 e2 ff ff       	call   8005b5 <fd2data>
+  8022ef:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022f1:	83 c4 0c             	add    $0xc,%esp
+  8022f4:	68 07 04 00 00       	push   $0x407
+  8022f9:	50                   	push   %eax
+  8022fa:	6a 00                	push   $0x0
+  8022fc:	e8 a3 de ff ff       	call   8001a4 <sys_page_alloc>
+  802301:	89 c3                	mov    %eax,%ebx
+  802303:	83 c4 10             	add    $0x10,%esp
+  802306:	85 c0                	test   %eax,%eax
+  802308:	0f 88 82 00 00 00    	js     802390 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80230e:	83 ec 0c             	sub    $0xc,%esp
+  802311:	ff 75 f0             	push   -0x10(%ebp)
+  802314:	e8 9c e2 ff ff       	call   8005b5 <fd2data>
+  802319:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802320:	50                   	push   %eax
+  802321:	6a 00                	push   $0x0
+  802323:	56                   	push   %esi
+  802324:	6a 00                	push   $0x0
+  802326:	e8 c4 de ff ff       	call   8001ef <sys_page_map>
+  80232b:	89 c3                	mov    %eax,%ebx
+  80232d:	83 c4 20             	add    $0x20,%esp
+  802330:	85 c0                	test   %eax,%eax
+  802332:	78 4e                	js     802382 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802334:	a1 60 40 80 00       	mov    0x804060,%eax
+  802339:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80233c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80233e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802341:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802348:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80234b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80234d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802350:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802357:	83 ec 0c             	sub    $0xc,%esp
+  80235a:	ff 75 f4             	push   -0xc(%ebp)
+  80235d:	e8 43 e2 ff ff       	call   8005a5 <fd2num>
+  802362:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802365:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802367:	83 c4 04             	add    $0x4,%esp
+  80236a:	ff 75 f0             	push   -0x10(%ebp)
+  80236d:	e8 33 e2 ff ff       	call   8005a5 <fd2num>
+  802372:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802375:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802378:	83 c4 10             	add    $0x10,%esp
+  80237b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802380:	eb 2e                	jmp    8023b0 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802382:	83 ec 08             	sub    $0x8,%esp
+  802385:	56                   	push   %esi
+  802386:	6a 00                	push   $0x0
+  802388:	e8 a4 de ff ff       	call   800231 <sys_page_unmap>
+  80238d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802390:	83 ec 08             	sub    $0x8,%esp
+  802393:	ff 75 f0             	push   -0x10(%ebp)
+  802396:	6a 00                	push   $0x0
+  802398:	e8 94 de ff ff       	call   800231 <sys_page_unmap>
+  80239d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8023a0:	83 ec 08             	sub    $0x8,%esp
+  8023a3:	ff 75 f4             	push   -0xc(%ebp)
+  8023a6:	6a 00                	push   $0x0
+  8023a8:	e8 84 de ff ff       	call   800231 <sys_page_unmap>
+  8023ad:	83 c4 10             	add    $0x10,%esp
+}
+  8023b0:	89 d8                	mov    %ebx,%eax
+  8023b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023b5:	5b                   	pop    %ebx
+  8023b6:	5e                   	pop    %esi
+  8023b7:	5d                   	pop    %ebp
+  8023b8:	c3                   	ret
+
+008023b9 <pipeisclosed>:
+{
+  8023b9:	55                   	push   %ebp
+  8023ba:	89 e5                	mov    %esp,%ebp
+  8023bc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023c2:	50                   	push   %eax
+  8023c3:	ff 75 08             	push   0x8(%ebp)
+  8023c6:	e8 57 e2 ff ff       	call   800622 <fd_lookup>
+  8023cb:	83 c4 10             	add    $0x10,%esp
+  8023ce:	85 c0                	test   %eax,%eax
+  8023d0:	78 18                	js     8023ea <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8023d2:	83 ec 0c             	sub    $0xc,%esp
+  8023d5:	ff 75 f4             	push   -0xc(%ebp)
+  8023d8:	e8 d8 e1 ff ff       	call   8005b5 <fd2data>
+  8023dd:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8023df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023e2:	e8 33 fd ff ff       	call   80211a <_pipeisclosed>
+  8023e7:	83 c4 10             	add    $0x10,%esp
+}
+  8023ea:	c9                   	leave
+  8023eb:	c3                   	ret
+
+008023ec <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8023ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f1:	c3                   	ret
+
+008023f2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023f2:	55                   	push   %ebp
+  8023f3:	89 e5                	mov    %esp,%ebp
+  8023f5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8023f8:	68 12 39 80 00       	push   $0x803912
+  8023fd:	ff 75 0c             	push   0xc(%ebp)
+  802400:	e8 24 08 00 00       	call   802c29 <strcpy>
+	return 0;
+}
+  802405:	b8 00 00 00 00       	mov    $0x0,%eax
+  80240a:	c9                   	leave
+  80240b:	c3                   	ret
+
+0080240c <devcons_write>:
+{
+  80240c:	55                   	push   %ebp
+  80240d:	89 e5                	mov    %esp,%ebp
+  80240f:	57                   	push   %edi
+  802410:	56                   	push   %esi
+  802411:	53                   	push   %ebx
+  802412:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802418:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80241d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802423:	eb 2e                	jmp    802453 <devcons_write+0x47>
+		m = n - tot;
+  802425:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802428:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80242a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80242f:	39 c3                	cmp    %eax,%ebx
+  802431:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802434:	83 ec 04             	sub    $0x4,%esp
+  802437:	53                   	push   %ebx
+  802438:	89 f0                	mov    %esi,%eax
+  80243a:	03 45 0c             	add    0xc(%ebp),%eax
+  80243d:	50                   	push   %eax
+  80243e:	57                   	push   %edi
+  80243f:	e8 6b 09 00 00       	call   802daf <memmove>
+		sys_cputs(buf, m);
+  802444:	83 c4 08             	add    $0x8,%esp
+  802447:	53                   	push   %ebx
+  802448:	57                   	push   %edi
+  802449:	e8 7a dc ff ff       	call   8000c8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80244e:	01 de                	add    %ebx,%esi
+  802450:	83 c4 10             	add    $0x10,%esp
+  802453:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802456:	72 cd                	jb     802425 <devcons_write+0x19>
+}
+  802458:	89 f0                	mov    %esi,%eax
+  80245a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80245d:	5b                   	pop    %ebx
+  80245e:	5e                   	pop    %esi
+  80245f:	5f                   	pop    %edi
+  802460:	5d                   	pop    %ebp
+  802461:	c3                   	ret
+
+00802462 <devcons_read>:
+{
+  802462:	55                   	push   %ebp
+  802463:	89 e5                	mov    %esp,%ebp
+  802465:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802471:	75 07                	jne    80247a <devcons_read+0x18>
+  802473:	eb 1f                	jmp    802494 <devcons_read+0x32>
+		sys_yield();
+  802475:	e8 0b dd ff ff       	call   800185 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80247a:	e8 6f dc ff ff       	call   8000ee <sys_cgetc>
+  80247f:	85 c0                	test   %eax,%eax
+  802481:	74 f2                	je     802475 <devcons_read+0x13>
+	if (c < 0)
+  802483:	78 0f                	js     802494 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802485:	83 f8 04             	cmp    $0x4,%eax
+  802488:	74 0c                	je     802496 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80248a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80248d:	88 02                	mov    %al,(%edx)
+	return 1;
+  80248f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802494:	c9                   	leave
+  802495:	c3                   	ret
+		return 0;
+  802496:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249b:	eb f7                	jmp    802494 <devcons_read+0x32>
+
+0080249d <cputchar>:
+{
+  80249d:	55                   	push   %ebp
+  80249e:	89 e5                	mov    %esp,%ebp
+  8024a0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8024a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024a6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8024a9:	6a 01                	push   $0x1
+  8024ab:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024ae:	50                   	push   %eax
+  8024af:	e8 14 dc ff ff       	call   8000c8 <sys_cputs>
+}
+  8024b4:	83 c4 10             	add    $0x10,%esp
+  8024b7:	c9                   	leave
+  8024b8:	c3                   	ret
+
+008024b9 <getchar>:
+{
+  8024b9:	55                   	push   %ebp
+  8024ba:	89 e5                	mov    %esp,%ebp
+  8024bc:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8024bf:	6a 01                	push   $0x1
+  8024c1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024c4:	50                   	push   %eax
+  8024c5:	6a 00                	push   $0x0
+  8024c7:	e8 bc e3 ff ff       	call   800888 <read>
+	if (r < 0)
+  8024cc:	83 c4 10             	add    $0x10,%esp
+  8024cf:	85 c0                	test   %eax,%eax
+  8024d1:	78 06                	js     8024d9 <getchar+0x20>
+	if (r < 1)
+  8024d3:	74 06                	je     8024db <getchar+0x22>
+	return c;
+  8024d5:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8024d9:	c9                   	leave
+  8024da:	c3                   	ret
+		return -E_EOF;
+  8024db:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8024e0:	eb f7                	jmp    8024d9 <getchar+0x20>
+
+008024e2 <iscons>:
+{
+  8024e2:	55                   	push   %ebp
+  8024e3:	89 e5                	mov    %esp,%ebp
+  8024e5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024eb:	50                   	push   %eax
+  8024ec:	ff 75 08             	push   0x8(%ebp)
+  8024ef:	e8 2e e1 ff ff       	call   800622 <fd_lookup>
+  8024f4:	83 c4 10             	add    $0x10,%esp
+  8024f7:	85 c0                	test   %eax,%eax
+  8024f9:	78 11                	js     80250c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8024fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024fe:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802504:	39 10                	cmp    %edx,(%eax)
+  802506:	0f 94 c0             	sete   %al
+  802509:	0f b6 c0             	movzbl %al,%eax
+}
+  80250c:	c9                   	leave
+  80250d:	c3                   	ret
+
+0080250e <opencons>:
+{
+  80250e:	55                   	push   %ebp
+  80250f:	89 e5                	mov    %esp,%ebp
+  802511:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802514:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802517:	50                   	push   %eax
+  802518:	e8 af e0 ff ff       	call   8005cc <fd_alloc>
+  80251d:	83 c4 10             	add    $0x10,%esp
+  802520:	85 c0                	test   %eax,%eax
+  802522:	78 3a                	js     80255e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802524:	83 ec 04             	sub    $0x4,%esp
+  802527:	68 07 04 00 00       	push   $0x407
+  80252c:	ff 75 f4             	push   -0xc(%ebp)
+  80252f:	6a 00                	push   $0x0
+  802531:	e8 6e dc ff ff       	call   8001a4 <sys_page_alloc>
+  802536:	83 c4 10             	add    $0x10,%esp
+  802539:	85 c0                	test   %eax,%eax
+  80253b:	78 21                	js     80255e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80253d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802540:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802546:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802548:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80254b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802552:	83 ec 0c             	sub    $0xc,%esp
+  802555:	50                   	push   %eax
+  802556:	e8 4a e0 ff ff       	call   8005a5 <fd2num>
+  80255b:	83 c4 10             	add    $0x10,%esp
+}
+  80255e:	c9                   	leave
+  80255f:	c3                   	ret
+
+00802560 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802560:	55                   	push   %ebp
+  802561:	89 e5                	mov    %esp,%ebp
+  802563:	56                   	push   %esi
+  802564:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802565:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802568:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80256e:	e8 eb db ff ff       	call   80015e <sys_getenvid>
+  802573:	83 ec 0c             	sub    $0xc,%esp
+  802576:	ff 75 0c             	push   0xc(%ebp)
+  802579:	ff 75 08             	push   0x8(%ebp)
+  80257c:	56                   	push   %esi
+  80257d:	50                   	push   %eax
+  80257e:	68 20 39 80 00       	push   $0x803920
+  802583:	e8 b3 00 00 00       	call   80263b <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802588:	83 c4 18             	add    $0x18,%esp
+  80258b:	53                   	push   %ebx
+  80258c:	ff 75 10             	push   0x10(%ebp)
+  80258f:	e8 56 00 00 00       	call   8025ea <vcprintf>
+	cprintf("\n");
+  802594:	c7 04 24 0b 39 80 00 	movl   $0x80390b,(%esp)
+  80259b:	e8 9b 00 00 00       	call   80263b <cprintf>
+  8025a0:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8025a3:	cc                   	int3
+	while (1)
+  8025a4:	eb fd                	jmp    8025a3 <_panic+0x43>
+
+008025a6 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8025a6:	55                   	push   %ebp
+  8025a7:	89 e5                	mov    %esp,%ebp
+  8025a9:	53                   	push   %ebx
+  8025aa:	83 ec 04             	sub    $0x4,%esp
+  8025ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8025b0:	8b 13                	mov    (%ebx),%edx
+  8025b2:	8d 42 01             	lea    0x1(%edx),%eax
+  8025b5:	89 03                	mov    %eax,(%ebx)
+  8025b7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025ba:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8025be:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8025c3:	74 09                	je     8025ce <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8025c5:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8025c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025cc:	c9                   	leave
+  8025cd:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8025ce:	83 ec 08             	sub    $0x8,%esp
+  8025d1:	68 ff 00 00 00       	push   $0xff
+  8025d6:	8d 43 08             	lea    0x8(%ebx),%eax
+  8025d9:	50                   	push   %eax
+  8025da:	e8 e9 da ff ff       	call   8000c8 <sys_cputs>
+		b->idx = 0;
+  8025df:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8025e5:	83 c4 10             	add    $0x10,%esp
+  8025e8:	eb db                	jmp    8025c5 <putch+0x1f>
+
+008025ea <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8025ea:	55                   	push   %ebp
+  8025eb:	89 e5                	mov    %esp,%ebp
+  8025ed:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8025f3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8025fa:	00 00 00 
+	b.cnt = 0;
+  8025fd:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802604:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  802607:	ff 75 0c             	push   0xc(%ebp)
+  80260a:	ff 75 08             	push   0x8(%ebp)
+  80260d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802613:	50                   	push   %eax
+  802614:	68 a6 25 80 00       	push   $0x8025a6
+  802619:	e8 14 01 00 00       	call   802732 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80261e:	83 c4 08             	add    $0x8,%esp
+  802621:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802627:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80262d:	50                   	push   %eax
+  80262e:	e8 95 da ff ff       	call   8000c8 <sys_cputs>
+
+	return b.cnt;
+}
+  802633:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802639:	c9                   	leave
+  80263a:	c3                   	ret
+
+0080263b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80263b:	55                   	push   %ebp
+  80263c:	89 e5                	mov    %esp,%ebp
+  80263e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802641:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802644:	50                   	push   %eax
+  802645:	ff 75 08             	push   0x8(%ebp)
+  802648:	e8 9d ff ff ff       	call   8025ea <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80264d:	c9                   	leave
+  80264e:	c3                   	ret
+
+0080264f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80264f:	55                   	push   %ebp
+  802650:	89 e5                	mov    %esp,%ebp
+  802652:	57                   	push   %edi
+  802653:	56                   	push   %esi
+  802654:	53                   	push   %ebx
+  802655:	83 ec 1c             	sub    $0x1c,%esp
+  802658:	89 c7                	mov    %eax,%edi
+  80265a:	89 d6                	mov    %edx,%esi
+  80265c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80265f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802662:	89 d1                	mov    %edx,%ecx
+  802664:	89 c2                	mov    %eax,%edx
+  802666:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802669:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80266c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80266f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802672:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802675:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80267c:	39 c2                	cmp    %eax,%edx
+  80267e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802681:	72 3e                	jb     8026c1 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802683:	83 ec 0c             	sub    $0xc,%esp
+  802686:	ff 75 18             	push   0x18(%ebp)
+  802689:	83 eb 01             	sub    $0x1,%ebx
+  80268c:	53                   	push   %ebx
+  80268d:	50                   	push   %eax
+  80268e:	83 ec 08             	sub    $0x8,%esp
+  802691:	ff 75 e4             	push   -0x1c(%ebp)
+  802694:	ff 75 e0             	push   -0x20(%ebp)
+  802697:	ff 75 dc             	push   -0x24(%ebp)
+  80269a:	ff 75 d8             	push   -0x28(%ebp)
+  80269d:	e8 59 0f 00 00       	call   8035fb <__udivdi3>
+  8026a2:	83 c4 18             	add    $0x18,%esp
+  8026a5:	52                   	push   %edx
+  8026a6:	50                   	push   %eax
+  8026a7:	89 f2                	mov    %esi,%edx
+  8026a9:	89 f8                	mov    %edi,%eax
+  8026ab:	e8 9f ff ff ff       	call   80264f <printnum>
+  8026b0:	83 c4 20             	add    $0x20,%esp
+  8026b3:	eb 13                	jmp    8026c8 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8026b5:	83 ec 08             	sub    $0x8,%esp
+  8026b8:	56                   	push   %esi
+  8026b9:	ff 75 18             	push   0x18(%ebp)
+  8026bc:	ff d7                	call   *%edi
+  8026be:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8026c1:	83 eb 01             	sub    $0x1,%ebx
+  8026c4:	85 db                	test   %ebx,%ebx
+  8026c6:	7f ed                	jg     8026b5 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8026c8:	83 ec 08             	sub    $0x8,%esp
+  8026cb:	56                   	push   %esi
+  8026cc:	83 ec 04             	sub    $0x4,%esp
+  8026cf:	ff 75 e4             	push   -0x1c(%ebp)
+  8026d2:	ff 75 e0             	push   -0x20(%ebp)
+  8026d5:	ff 75 dc             	push   -0x24(%ebp)
+  8026d8:	ff 75 d8             	push   -0x28(%ebp)
+  8026db:	e8 39 0f 00 00       	call   803619 <__umoddi3>
+  8026e0:	83 c4 14             	add    $0x14,%esp
+  8026e3:	0f be 80 43 39 80 00 	movsbl 0x803943(%eax),%eax
+  8026ea:	50                   	push   %eax
+  8026eb:	ff d7                	call   *%edi
+}
+  8026ed:	83 c4 10             	add    $0x10,%esp
+  8026f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026f3:	5b                   	pop    %ebx
+  8026f4:	5e                   	pop    %esi
+  8026f5:	5f                   	pop    %edi
+  8026f6:	5d                   	pop    %ebp
+  8026f7:	c3                   	ret
+
+008026f8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8026f8:	55                   	push   %ebp
+  8026f9:	89 e5                	mov    %esp,%ebp
+  8026fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8026fe:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  802702:	8b 10                	mov    (%eax),%edx
+  802704:	3b 50 04             	cmp    0x4(%eax),%edx
+  802707:	73 0a                	jae    802713 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  802709:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80270c:	89 08                	mov    %ecx,(%eax)
+  80270e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802711:	88 02                	mov    %al,(%edx)
+}
+  802713:	5d                   	pop    %ebp
+  802714:	c3                   	ret
+
+00802715 <printfmt>:
+{
+  802715:	55                   	push   %ebp
+  802716:	89 e5                	mov    %esp,%ebp
+  802718:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80271b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80271e:	50                   	push   %eax
+  80271f:	ff 75 10             	push   0x10(%ebp)
+  802722:	ff 75 0c             	push   0xc(%ebp)
+  802725:	ff 75 08             	push   0x8(%ebp)
+  802728:	e8 05 00 00 00       	call   802732 <vprintfmt>
+}
+  80272d:	83 c4 10             	add    $0x10,%esp
+  802730:	c9                   	leave
+  802731:	c3                   	ret
+
+00802732 <vprintfmt>:
+{
+  802732:	55                   	push   %ebp
+  802733:	89 e5                	mov    %esp,%ebp
+  802735:	57                   	push   %edi
+  802736:	56                   	push   %esi
+  802737:	53                   	push   %ebx
+  802738:	83 ec 2c             	sub    $0x2c,%esp
+  80273b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80273e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802741:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802744:	eb 0a                	jmp    802750 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  802746:	83 ec 08             	sub    $0x8,%esp
+  802749:	53                   	push   %ebx
+  80274a:	50                   	push   %eax
+  80274b:	ff d6                	call   *%esi
+  80274d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802750:	83 c7 01             	add    $0x1,%edi
+  802753:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  802757:	83 f8 25             	cmp    $0x25,%eax
+  80275a:	74 0c                	je     802768 <vprintfmt+0x36>
+			if (ch == '\0')
+  80275c:	85 c0                	test   %eax,%eax
+  80275e:	75 e6                	jne    802746 <vprintfmt+0x14>
+}
+  802760:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802763:	5b                   	pop    %ebx
+  802764:	5e                   	pop    %esi
+  802765:	5f                   	pop    %edi
+  802766:	5d                   	pop    %ebp
+  802767:	c3                   	ret
+		padc = ' ';
+  802768:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80276c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802773:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80277a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  802781:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  802786:	8d 47 01             	lea    0x1(%edi),%eax
+  802789:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80278c:	0f b6 17             	movzbl (%edi),%edx
+  80278f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  802792:	3c 55                	cmp    $0x55,%al
+  802794:	0f 87 cf 03 00 00    	ja     802b69 <vprintfmt+0x437>
+  80279a:	0f b6 c0             	movzbl %al,%eax
+  80279d:	ff 24 85 a0 3a 80 00 	jmp    *0x803aa0(,%eax,4)
+  8027a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8027a7:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8027ab:	eb d9                	jmp    802786 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8027ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8027b0:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8027b4:	eb d0                	jmp    802786 <vprintfmt+0x54>
+  8027b6:	0f b6 d2             	movzbl %dl,%edx
+  8027b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8027bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c1:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8027c4:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8027c7:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8027cb:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8027ce:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8027d1:	83 f9 09             	cmp    $0x9,%ecx
+  8027d4:	77 55                	ja     80282b <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8027d6:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8027d9:	eb e9                	jmp    8027c4 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8027db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027de:	8b 00                	mov    (%eax),%eax
+  8027e0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8027e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8027e9:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8027ef:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8027f3:	79 91                	jns    802786 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8027f5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8027f8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8027fb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  802802:	eb 82                	jmp    802786 <vprintfmt+0x54>
+			if (width < 0)
+  802804:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802807:	85 d2                	test   %edx,%edx
+  802809:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280e:	0f 49 c2             	cmovns %edx,%eax
+  802811:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802814:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  802817:	e9 6a ff ff ff       	jmp    802786 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80281c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80281f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  802826:	e9 5b ff ff ff       	jmp    802786 <vprintfmt+0x54>
+  80282b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80282e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802831:	eb bc                	jmp    8027ef <vprintfmt+0xbd>
+			lflag++;
+  802833:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  802836:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  802839:	e9 48 ff ff ff       	jmp    802786 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80283e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802841:	8d 78 04             	lea    0x4(%eax),%edi
+  802844:	83 ec 08             	sub    $0x8,%esp
+  802847:	53                   	push   %ebx
+  802848:	ff 30                	push   (%eax)
+  80284a:	ff d6                	call   *%esi
+			break;
+  80284c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80284f:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  802852:	e9 b1 02 00 00       	jmp    802b08 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  802857:	8b 45 14             	mov    0x14(%ebp),%eax
+  80285a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80285d:	8b 10                	mov    (%eax),%edx
+  80285f:	89 d0                	mov    %edx,%eax
+  802861:	f7 d8                	neg    %eax
+  802863:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802866:	83 f8 11             	cmp    $0x11,%eax
+  802869:	7f 23                	jg     80288e <vprintfmt+0x15c>
+  80286b:	8b 14 85 00 3c 80 00 	mov    0x803c00(,%eax,4),%edx
+  802872:	85 d2                	test   %edx,%edx
+  802874:	74 18                	je     80288e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  802876:	52                   	push   %edx
+  802877:	68 76 38 80 00       	push   $0x803876
+  80287c:	53                   	push   %ebx
+  80287d:	56                   	push   %esi
+  80287e:	e8 92 fe ff ff       	call   802715 <printfmt>
+  802883:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802886:	89 7d 14             	mov    %edi,0x14(%ebp)
+  802889:	e9 7a 02 00 00       	jmp    802b08 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80288e:	50                   	push   %eax
+  80288f:	68 5b 39 80 00       	push   $0x80395b
+  802894:	53                   	push   %ebx
+  802895:	56                   	push   %esi
+  802896:	e8 7a fe ff ff       	call   802715 <printfmt>
+  80289b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80289e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8028a1:	e9 62 02 00 00       	jmp    802b08 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8028a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028a9:	83 c0 04             	add    $0x4,%eax
+  8028ac:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8028af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028b2:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8028b4:	85 c9                	test   %ecx,%ecx
+  8028b6:	b8 54 39 80 00       	mov    $0x803954,%eax
+  8028bb:	0f 45 c1             	cmovne %ecx,%eax
+  8028be:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8028c1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8028c5:	7e 06                	jle    8028cd <vprintfmt+0x19b>
+  8028c7:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8028cb:	75 0b                	jne    8028d8 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028cd:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8028d0:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8028d3:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028d6:	eb 5c                	jmp    802934 <vprintfmt+0x202>
+  8028d8:	83 ec 08             	sub    $0x8,%esp
+  8028db:	ff 75 d0             	push   -0x30(%ebp)
+  8028de:	ff 75 cc             	push   -0x34(%ebp)
+  8028e1:	e8 20 03 00 00       	call   802c06 <strnlen>
+  8028e6:	89 c2                	mov    %eax,%edx
+  8028e8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028eb:	29 d0                	sub    %edx,%eax
+  8028ed:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8028f0:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8028f4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028f7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028fa:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028fc:	eb 0e                	jmp    80290c <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8028fe:	83 ec 08             	sub    $0x8,%esp
+  802901:	53                   	push   %ebx
+  802902:	57                   	push   %edi
+  802903:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802906:	83 ee 01             	sub    $0x1,%esi
+  802909:	83 c4 10             	add    $0x10,%esp
+  80290c:	85 f6                	test   %esi,%esi
+  80290e:	7f ee                	jg     8028fe <vprintfmt+0x1cc>
+  802910:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802913:	8b 75 08             	mov    0x8(%ebp),%esi
+  802916:	85 c0                	test   %eax,%eax
+  802918:	ba 00 00 00 00       	mov    $0x0,%edx
+  80291d:	0f 49 d0             	cmovns %eax,%edx
+  802920:	29 d0                	sub    %edx,%eax
+  802922:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802925:	eb a6                	jmp    8028cd <vprintfmt+0x19b>
+					putch(ch, putdat);
+  802927:	83 ec 08             	sub    $0x8,%esp
+  80292a:	53                   	push   %ebx
+  80292b:	52                   	push   %edx
+  80292c:	ff 55 08             	call   *0x8(%ebp)
+  80292f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802932:	89 f1                	mov    %esi,%ecx
+  802934:	8d 71 01             	lea    0x1(%ecx),%esi
+  802937:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80293b:	0f be d0             	movsbl %al,%edx
+  80293e:	85 d2                	test   %edx,%edx
+  802940:	74 28                	je     80296a <vprintfmt+0x238>
+  802942:	85 ff                	test   %edi,%edi
+  802944:	78 05                	js     80294b <vprintfmt+0x219>
+  802946:	83 ef 01             	sub    $0x1,%edi
+  802949:	78 30                	js     80297b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80294b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80294f:	74 d6                	je     802927 <vprintfmt+0x1f5>
+  802951:	0f be c0             	movsbl %al,%eax
+  802954:	83 e8 20             	sub    $0x20,%eax
+  802957:	83 f8 5e             	cmp    $0x5e,%eax
+  80295a:	76 cb                	jbe    802927 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80295c:	83 ec 08             	sub    $0x8,%esp
+  80295f:	53                   	push   %ebx
+  802960:	6a 3f                	push   $0x3f
+  802962:	ff 55 08             	call   *0x8(%ebp)
+  802965:	83 c4 10             	add    $0x10,%esp
+  802968:	eb c8                	jmp    802932 <vprintfmt+0x200>
+  80296a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80296d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802970:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802973:	01 d0                	add    %edx,%eax
+  802975:	29 c8                	sub    %ecx,%eax
+  802977:	89 c7                	mov    %eax,%edi
+  802979:	eb 13                	jmp    80298e <vprintfmt+0x25c>
+  80297b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80297e:	eb ed                	jmp    80296d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  802980:	83 ec 08             	sub    $0x8,%esp
+  802983:	53                   	push   %ebx
+  802984:	6a 20                	push   $0x20
+  802986:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  802988:	83 ef 01             	sub    $0x1,%edi
+  80298b:	83 c4 10             	add    $0x10,%esp
+  80298e:	85 ff                	test   %edi,%edi
+  802990:	7f ee                	jg     802980 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802992:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  802995:	89 45 14             	mov    %eax,0x14(%ebp)
+  802998:	e9 6b 01 00 00       	jmp    802b08 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80299d:	83 f9 01             	cmp    $0x1,%ecx
+  8029a0:	7f 1f                	jg     8029c1 <vprintfmt+0x28f>
+	else if (lflag)
+  8029a2:	85 c9                	test   %ecx,%ecx
+  8029a4:	74 67                	je     802a0d <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8029a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029a9:	8b 00                	mov    (%eax),%eax
+  8029ab:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029ae:	89 c1                	mov    %eax,%ecx
+  8029b0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8029b3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8029b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8029bc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8029bf:	eb 17                	jmp    8029d8 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8029c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029c4:	8b 50 04             	mov    0x4(%eax),%edx
+  8029c7:	8b 00                	mov    (%eax),%eax
+  8029c9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029cc:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8029cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029d2:	8d 40 08             	lea    0x8(%eax),%eax
+  8029d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8029d8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029db:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8029de:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8029e3:	85 c9                	test   %ecx,%ecx
+  8029e5:	0f 89 03 01 00 00    	jns    802aee <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8029eb:	83 ec 08             	sub    $0x8,%esp
+  8029ee:	53                   	push   %ebx
+  8029ef:	6a 2d                	push   $0x2d
+  8029f1:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8029f3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029f6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8029f9:	f7 da                	neg    %edx
+  8029fb:	83 d1 00             	adc    $0x0,%ecx
+  8029fe:	f7 d9                	neg    %ecx
+  802a00:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802a03:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802a08:	e9 e1 00 00 00       	jmp    802aee <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  802a0d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a10:	8b 00                	mov    (%eax),%eax
+  802a12:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802a15:	89 c1                	mov    %eax,%ecx
+  802a17:	c1 f9 1f             	sar    $0x1f,%ecx
+  802a1a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802a1d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a20:	8d 40 04             	lea    0x4(%eax),%eax
+  802a23:	89 45 14             	mov    %eax,0x14(%ebp)
+  802a26:	eb b0                	jmp    8029d8 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  802a28:	83 f9 01             	cmp    $0x1,%ecx
+  802a2b:	7f 1e                	jg     802a4b <vprintfmt+0x319>
+	else if (lflag)
+  802a2d:	85 c9                	test   %ecx,%ecx
+  802a2f:	74 32                	je     802a63 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802a31:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a34:	8b 10                	mov    (%eax),%edx
+  802a36:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a3b:	8d 40 04             	lea    0x4(%eax),%eax
+  802a3e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a41:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  802a46:	e9 a3 00 00 00       	jmp    802aee <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a4b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a4e:	8b 10                	mov    (%eax),%edx
+  802a50:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a53:	8d 40 08             	lea    0x8(%eax),%eax
+  802a56:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a59:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  802a5e:	e9 8b 00 00 00       	jmp    802aee <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a63:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a66:	8b 10                	mov    (%eax),%edx
+  802a68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a6d:	8d 40 04             	lea    0x4(%eax),%eax
+  802a70:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a73:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  802a78:	eb 74                	jmp    802aee <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  802a7a:	83 f9 01             	cmp    $0x1,%ecx
+  802a7d:	7f 1b                	jg     802a9a <vprintfmt+0x368>
+	else if (lflag)
+  802a7f:	85 c9                	test   %ecx,%ecx
+  802a81:	74 2c                	je     802aaf <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  802a83:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a86:	8b 10                	mov    (%eax),%edx
+  802a88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a8d:	8d 40 04             	lea    0x4(%eax),%eax
+  802a90:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a93:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  802a98:	eb 54                	jmp    802aee <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a9d:	8b 10                	mov    (%eax),%edx
+  802a9f:	8b 48 04             	mov    0x4(%eax),%ecx
+  802aa2:	8d 40 08             	lea    0x8(%eax),%eax
+  802aa5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802aa8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  802aad:	eb 3f                	jmp    802aee <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802aaf:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ab2:	8b 10                	mov    (%eax),%edx
+  802ab4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ab9:	8d 40 04             	lea    0x4(%eax),%eax
+  802abc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802abf:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802ac4:	eb 28                	jmp    802aee <vprintfmt+0x3bc>
+			putch('0', putdat);
+  802ac6:	83 ec 08             	sub    $0x8,%esp
+  802ac9:	53                   	push   %ebx
+  802aca:	6a 30                	push   $0x30
+  802acc:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802ace:	83 c4 08             	add    $0x8,%esp
+  802ad1:	53                   	push   %ebx
+  802ad2:	6a 78                	push   $0x78
+  802ad4:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802ad6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ad9:	8b 10                	mov    (%eax),%edx
+  802adb:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802ae0:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802ae3:	8d 40 04             	lea    0x4(%eax),%eax
+  802ae6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802ae9:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802aee:	83 ec 0c             	sub    $0xc,%esp
+  802af1:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802af5:	50                   	push   %eax
+  802af6:	ff 75 e0             	push   -0x20(%ebp)
+  802af9:	57                   	push   %edi
+  802afa:	51                   	push   %ecx
+  802afb:	52                   	push   %edx
+  802afc:	89 da                	mov    %ebx,%edx
+  802afe:	89 f0                	mov    %esi,%eax
+  802b00:	e8 4a fb ff ff       	call   80264f <printnum>
+			break;
+  802b05:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802b08:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802b0b:	e9 40 fc ff ff       	jmp    802750 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802b10:	83 f9 01             	cmp    $0x1,%ecx
+  802b13:	7f 1b                	jg     802b30 <vprintfmt+0x3fe>
+	else if (lflag)
+  802b15:	85 c9                	test   %ecx,%ecx
+  802b17:	74 2c                	je     802b45 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802b19:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b1c:	8b 10                	mov    (%eax),%edx
+  802b1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b23:	8d 40 04             	lea    0x4(%eax),%eax
+  802b26:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b29:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802b2e:	eb be                	jmp    802aee <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802b30:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b33:	8b 10                	mov    (%eax),%edx
+  802b35:	8b 48 04             	mov    0x4(%eax),%ecx
+  802b38:	8d 40 08             	lea    0x8(%eax),%eax
+  802b3b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b3e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802b43:	eb a9                	jmp    802aee <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802b45:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b48:	8b 10                	mov    (%eax),%edx
+  802b4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b4f:	8d 40 04             	lea    0x4(%eax),%eax
+  802b52:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b55:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  802b5a:	eb 92                	jmp    802aee <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  802b5c:	83 ec 08             	sub    $0x8,%esp
+  802b5f:	53                   	push   %ebx
+  802b60:	6a 25                	push   $0x25
+  802b62:	ff d6                	call   *%esi
+			break;
+  802b64:	83 c4 10             	add    $0x10,%esp
+  802b67:	eb 9f                	jmp    802b08 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  802b69:	83 ec 08             	sub    $0x8,%esp
+  802b6c:	53                   	push   %ebx
+  802b6d:	6a 25                	push   $0x25
+  802b6f:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802b71:	83 c4 10             	add    $0x10,%esp
+  802b74:	89 f8                	mov    %edi,%eax
+  802b76:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802b7a:	74 05                	je     802b81 <vprintfmt+0x44f>
+  802b7c:	83 e8 01             	sub    $0x1,%eax
+  802b7f:	eb f5                	jmp    802b76 <vprintfmt+0x444>
+  802b81:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b84:	eb 82                	jmp    802b08 <vprintfmt+0x3d6>
+
+00802b86 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802b86:	55                   	push   %ebp
+  802b87:	89 e5                	mov    %esp,%ebp
+  802b89:	83 ec 18             	sub    $0x18,%esp
+  802b8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  802b92:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802b95:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802b99:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802b9c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802ba3:	85 c0                	test   %eax,%eax
+  802ba5:	74 26                	je     802bcd <vsnprintf+0x47>
+  802ba7:	85 d2                	test   %edx,%edx
+  802ba9:	7e 22                	jle    802bcd <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  802bab:	ff 75 14             	push   0x14(%ebp)
+  802bae:	ff 75 10             	push   0x10(%ebp)
+  802bb1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802bb4:	50                   	push   %eax
+  802bb5:	68 f8 26 80 00       	push   $0x8026f8
+  802bba:	e8 73 fb ff ff       	call   802732 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802bbf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802bc2:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802bc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bc8:	83 c4 10             	add    $0x10,%esp
+}
+  802bcb:	c9                   	leave
+  802bcc:	c3                   	ret
+		return -E_INVAL;
+  802bcd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bd2:	eb f7                	jmp    802bcb <vsnprintf+0x45>
+
+00802bd4 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802bd4:	55                   	push   %ebp
+  802bd5:	89 e5                	mov    %esp,%ebp
+  802bd7:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  802bda:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802bdd:	50                   	push   %eax
+  802bde:	ff 75 10             	push   0x10(%ebp)
+  802be1:	ff 75 0c             	push   0xc(%ebp)
+  802be4:	ff 75 08             	push   0x8(%ebp)
+  802be7:	e8 9a ff ff ff       	call   802b86 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802bec:	c9                   	leave
+  802bed:	c3                   	ret
+
+00802bee <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802bee:	55                   	push   %ebp
+  802bef:	89 e5                	mov    %esp,%ebp
+  802bf1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf9:	eb 03                	jmp    802bfe <strlen+0x10>
+		n++;
+  802bfb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802bfe:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802c02:	75 f7                	jne    802bfb <strlen+0xd>
+	return n;
+}
+  802c04:	5d                   	pop    %ebp
+  802c05:	c3                   	ret
+
+00802c06 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802c06:	55                   	push   %ebp
+  802c07:	89 e5                	mov    %esp,%ebp
+  802c09:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802c0c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c14:	eb 03                	jmp    802c19 <strnlen+0x13>
+		n++;
+  802c16:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802c19:	39 d0                	cmp    %edx,%eax
+  802c1b:	74 08                	je     802c25 <strnlen+0x1f>
+  802c1d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802c21:	75 f3                	jne    802c16 <strnlen+0x10>
+  802c23:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802c25:	89 d0                	mov    %edx,%eax
+  802c27:	5d                   	pop    %ebp
+  802c28:	c3                   	ret
+
+00802c29 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802c29:	55                   	push   %ebp
+  802c2a:	89 e5                	mov    %esp,%ebp
+  802c2c:	53                   	push   %ebx
+  802c2d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c30:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802c33:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c38:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802c3c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802c3f:	83 c0 01             	add    $0x1,%eax
+  802c42:	84 d2                	test   %dl,%dl
+  802c44:	75 f2                	jne    802c38 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  802c46:	89 c8                	mov    %ecx,%eax
+  802c48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c4b:	c9                   	leave
+  802c4c:	c3                   	ret
+
+00802c4d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802c4d:	55                   	push   %ebp
+  802c4e:	89 e5                	mov    %esp,%ebp
+  802c50:	53                   	push   %ebx
+  802c51:	83 ec 10             	sub    $0x10,%esp
+  802c54:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  802c57:	53                   	push   %ebx
+  802c58:	e8 91 ff ff ff       	call   802bee <strlen>
+  802c5d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  802c60:	ff 75 0c             	push   0xc(%ebp)
+  802c63:	01 d8                	add    %ebx,%eax
+  802c65:	50                   	push   %eax
+  802c66:	e8 be ff ff ff       	call   802c29 <strcpy>
+	return dst;
+}
+  802c6b:	89 d8                	mov    %ebx,%eax
+  802c6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c70:	c9                   	leave
+  802c71:	c3                   	ret
+
+00802c72 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802c72:	55                   	push   %ebp
+  802c73:	89 e5                	mov    %esp,%ebp
+  802c75:	56                   	push   %esi
+  802c76:	53                   	push   %ebx
+  802c77:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c7a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  802c7d:	89 f3                	mov    %esi,%ebx
+  802c7f:	03 5d 10             	add    0x10(%ebp),%ebx
+  802c82:	89 f0                	mov    %esi,%eax
+  802c84:	eb 0f                	jmp    802c95 <strncpy+0x23>
+		*dst++ = *src;
+  802c86:	83 c0 01             	add    $0x1,%eax
+  802c89:	0f b6 0a             	movzbl (%edx),%ecx
+  802c8c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  802c8f:	80 f9 01             	cmp    $0x1,%cl
+  802c92:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  802c95:	39 d8                	cmp    %ebx,%eax
+  802c97:	75 ed                	jne    802c86 <strncpy+0x14>
+	}
+	return ret;
+}
+  802c99:	89 f0                	mov    %esi,%eax
+  802c9b:	5b                   	pop    %ebx
+  802c9c:	5e                   	pop    %esi
+  802c9d:	5d                   	pop    %ebp
+  802c9e:	c3                   	ret
+
+00802c9f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802c9f:	55                   	push   %ebp
+  802ca0:	89 e5                	mov    %esp,%ebp
+  802ca2:	56                   	push   %esi
+  802ca3:	53                   	push   %ebx
+  802ca4:	8b 75 08             	mov    0x8(%ebp),%esi
+  802ca7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802caa:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  802cad:	89 f0                	mov    %esi,%eax
+  802caf:	85 d2                	test   %edx,%edx
+  802cb1:	74 21                	je     802cd4 <strlcpy+0x35>
+  802cb3:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  802cb7:	89 f2                	mov    %esi,%edx
+  802cb9:	eb 09                	jmp    802cc4 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  802cbb:	83 c1 01             	add    $0x1,%ecx
+  802cbe:	83 c2 01             	add    $0x1,%edx
+  802cc1:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  802cc4:	39 c2                	cmp    %eax,%edx
+  802cc6:	74 09                	je     802cd1 <strlcpy+0x32>
+  802cc8:	0f b6 19             	movzbl (%ecx),%ebx
+  802ccb:	84 db                	test   %bl,%bl
+  802ccd:	75 ec                	jne    802cbb <strlcpy+0x1c>
+  802ccf:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802cd1:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802cd4:	29 f0                	sub    %esi,%eax
+}
+  802cd6:	5b                   	pop    %ebx
+  802cd7:	5e                   	pop    %esi
+  802cd8:	5d                   	pop    %ebp
+  802cd9:	c3                   	ret
+
+00802cda <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802cda:	55                   	push   %ebp
+  802cdb:	89 e5                	mov    %esp,%ebp
+  802cdd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ce0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802ce3:	eb 06                	jmp    802ceb <strcmp+0x11>
+		p++, q++;
+  802ce5:	83 c1 01             	add    $0x1,%ecx
+  802ce8:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802ceb:	0f b6 01             	movzbl (%ecx),%eax
+  802cee:	84 c0                	test   %al,%al
+  802cf0:	74 04                	je     802cf6 <strcmp+0x1c>
+  802cf2:	3a 02                	cmp    (%edx),%al
+  802cf4:	74 ef                	je     802ce5 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802cf6:	0f b6 c0             	movzbl %al,%eax
+  802cf9:	0f b6 12             	movzbl (%edx),%edx
+  802cfc:	29 d0                	sub    %edx,%eax
+}
+  802cfe:	5d                   	pop    %ebp
+  802cff:	c3                   	ret
+
+00802d00 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802d00:	55                   	push   %ebp
+  802d01:	89 e5                	mov    %esp,%ebp
+  802d03:	53                   	push   %ebx
+  802d04:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d0a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802d0d:	eb 09                	jmp    802d18 <strncmp+0x18>
+		n--, p++, q++;
+  802d0f:	83 ea 01             	sub    $0x1,%edx
+  802d12:	83 c0 01             	add    $0x1,%eax
+  802d15:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802d18:	85 d2                	test   %edx,%edx
+  802d1a:	74 18                	je     802d34 <strncmp+0x34>
+  802d1c:	0f b6 18             	movzbl (%eax),%ebx
+  802d1f:	84 db                	test   %bl,%bl
+  802d21:	74 04                	je     802d27 <strncmp+0x27>
+  802d23:	3a 19                	cmp    (%ecx),%bl
+  802d25:	74 e8                	je     802d0f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802d27:	0f b6 00             	movzbl (%eax),%eax
+  802d2a:	0f b6 11             	movzbl (%ecx),%edx
+  802d2d:	29 d0                	sub    %edx,%eax
+}
+  802d2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d32:	c9                   	leave
+  802d33:	c3                   	ret
+		return 0;
+  802d34:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d39:	eb f4                	jmp    802d2f <strncmp+0x2f>
+
+00802d3b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802d3b:	55                   	push   %ebp
+  802d3c:	89 e5                	mov    %esp,%ebp
+  802d3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d41:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d45:	eb 03                	jmp    802d4a <strchr+0xf>
+  802d47:	83 c0 01             	add    $0x1,%eax
+  802d4a:	0f b6 10             	movzbl (%eax),%edx
+  802d4d:	84 d2                	test   %dl,%dl
+  802d4f:	74 06                	je     802d57 <strchr+0x1c>
+		if (*s == c)
+  802d51:	38 ca                	cmp    %cl,%dl
+  802d53:	75 f2                	jne    802d47 <strchr+0xc>
+  802d55:	eb 05                	jmp    802d5c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  802d57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d5c:	5d                   	pop    %ebp
+  802d5d:	c3                   	ret
+
+00802d5e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802d5e:	55                   	push   %ebp
+  802d5f:	89 e5                	mov    %esp,%ebp
+  802d61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d64:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d68:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  802d6b:	38 ca                	cmp    %cl,%dl
+  802d6d:	74 09                	je     802d78 <strfind+0x1a>
+  802d6f:	84 d2                	test   %dl,%dl
+  802d71:	74 05                	je     802d78 <strfind+0x1a>
+	for (; *s; s++)
+  802d73:	83 c0 01             	add    $0x1,%eax
+  802d76:	eb f0                	jmp    802d68 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  802d78:	5d                   	pop    %ebp
+  802d79:	c3                   	ret
+
+00802d7a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802d7a:	55                   	push   %ebp
+  802d7b:	89 e5                	mov    %esp,%ebp
+  802d7d:	57                   	push   %edi
+  802d7e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d81:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  802d84:	85 c9                	test   %ecx,%ecx
+  802d86:	74 20                	je     802da8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  802d88:	89 f8                	mov    %edi,%eax
+  802d8a:	09 c8                	or     %ecx,%eax
+  802d8c:	a8 03                	test   $0x3,%al
+  802d8e:	75 12                	jne    802da2 <memset+0x28>
+		c &= 0xFF;
+  802d90:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802d94:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  802d9a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  802d9d:	fc                   	cld
+  802d9e:	f3 ab                	rep stos %eax,%es:(%edi)
+  802da0:	eb 06                	jmp    802da8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  802da2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802da5:	fc                   	cld
+  802da6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  802da8:	89 f8                	mov    %edi,%eax
+  802daa:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802dad:	c9                   	leave
+  802dae:	c3                   	ret
+
+00802daf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  802daf:	55                   	push   %ebp
+  802db0:	89 e5                	mov    %esp,%ebp
+  802db2:	57                   	push   %edi
+  802db3:	56                   	push   %esi
+  802db4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802db7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802dba:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  802dbd:	39 c6                	cmp    %eax,%esi
+  802dbf:	73 32                	jae    802df3 <memmove+0x44>
+  802dc1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802dc4:	39 d0                	cmp    %edx,%eax
+  802dc6:	73 2b                	jae    802df3 <memmove+0x44>
+		s += n;
+		d += n;
+  802dc8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802dcb:	89 d6                	mov    %edx,%esi
+  802dcd:	09 fe                	or     %edi,%esi
+  802dcf:	09 ce                	or     %ecx,%esi
+  802dd1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802dd7:	75 0e                	jne    802de7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802dd9:	83 ef 04             	sub    $0x4,%edi
+  802ddc:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802ddf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802de2:	fd                   	std
+  802de3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802de5:	eb 09                	jmp    802df0 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802de7:	83 ef 01             	sub    $0x1,%edi
+  802dea:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802ded:	fd                   	std
+  802dee:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802df0:	fc                   	cld
+  802df1:	eb 1a                	jmp    802e0d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802df3:	89 f2                	mov    %esi,%edx
+  802df5:	09 c2                	or     %eax,%edx
+  802df7:	09 ca                	or     %ecx,%edx
+  802df9:	f6 c2 03             	test   $0x3,%dl
+  802dfc:	75 0a                	jne    802e08 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802dfe:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802e01:	89 c7                	mov    %eax,%edi
+  802e03:	fc                   	cld
+  802e04:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802e06:	eb 05                	jmp    802e0d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802e08:	89 c7                	mov    %eax,%edi
+  802e0a:	fc                   	cld
+  802e0b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802e0d:	5e                   	pop    %esi
+  802e0e:	5f                   	pop    %edi
+  802e0f:	5d                   	pop    %ebp
+  802e10:	c3                   	ret
+
+00802e11 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802e11:	55                   	push   %ebp
+  802e12:	89 e5                	mov    %esp,%ebp
+  802e14:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802e17:	ff 75 10             	push   0x10(%ebp)
+  802e1a:	ff 75 0c             	push   0xc(%ebp)
+  802e1d:	ff 75 08             	push   0x8(%ebp)
+  802e20:	e8 8a ff ff ff       	call   802daf <memmove>
+}
+  802e25:	c9                   	leave
+  802e26:	c3                   	ret
+
+00802e27 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802e27:	55                   	push   %ebp
+  802e28:	89 e5                	mov    %esp,%ebp
+  802e2a:	56                   	push   %esi
+  802e2b:	53                   	push   %ebx
+  802e2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e2f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802e32:	89 c6                	mov    %eax,%esi
+  802e34:	03 75 10             	add    0x10(%ebp),%esi
+  802e37:	eb 06                	jmp    802e3f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802e39:	83 c0 01             	add    $0x1,%eax
+  802e3c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802e3f:	39 f0                	cmp    %esi,%eax
+  802e41:	74 14                	je     802e57 <memcmp+0x30>
+		if (*s1 != *s2)
+  802e43:	0f b6 08             	movzbl (%eax),%ecx
+  802e46:	0f b6 1a             	movzbl (%edx),%ebx
+  802e49:	38 d9                	cmp    %bl,%cl
+  802e4b:	74 ec                	je     802e39 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802e4d:	0f b6 c1             	movzbl %cl,%eax
+  802e50:	0f b6 db             	movzbl %bl,%ebx
+  802e53:	29 d8                	sub    %ebx,%eax
+  802e55:	eb 05                	jmp    802e5c <memcmp+0x35>
+	}
+
+	return 0;
+  802e57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e5c:	5b                   	pop    %ebx
+  802e5d:	5e                   	pop    %esi
+  802e5e:	5d                   	pop    %ebp
+  802e5f:	c3                   	ret
+
+00802e60 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802e60:	55                   	push   %ebp
+  802e61:	89 e5                	mov    %esp,%ebp
+  802e63:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802e69:	89 c2                	mov    %eax,%edx
+  802e6b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802e6e:	eb 03                	jmp    802e73 <memfind+0x13>
+  802e70:	83 c0 01             	add    $0x1,%eax
+  802e73:	39 d0                	cmp    %edx,%eax
+  802e75:	73 04                	jae    802e7b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802e77:	38 08                	cmp    %cl,(%eax)
+  802e79:	75 f5                	jne    802e70 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802e7b:	5d                   	pop    %ebp
+  802e7c:	c3                   	ret
+
+00802e7d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802e7d:	55                   	push   %ebp
+  802e7e:	89 e5                	mov    %esp,%ebp
+  802e80:	57                   	push   %edi
+  802e81:	56                   	push   %esi
+  802e82:	53                   	push   %ebx
+  802e83:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802e89:	eb 03                	jmp    802e8e <strtol+0x11>
+		s++;
+  802e8b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802e8e:	0f b6 02             	movzbl (%edx),%eax
+  802e91:	3c 20                	cmp    $0x20,%al
+  802e93:	74 f6                	je     802e8b <strtol+0xe>
+  802e95:	3c 09                	cmp    $0x9,%al
+  802e97:	74 f2                	je     802e8b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802e99:	3c 2b                	cmp    $0x2b,%al
+  802e9b:	74 2a                	je     802ec7 <strtol+0x4a>
+	int neg = 0;
+  802e9d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802ea2:	3c 2d                	cmp    $0x2d,%al
+  802ea4:	74 2b                	je     802ed1 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802ea6:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802eac:	75 0f                	jne    802ebd <strtol+0x40>
+  802eae:	80 3a 30             	cmpb   $0x30,(%edx)
+  802eb1:	74 28                	je     802edb <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802eb3:	85 db                	test   %ebx,%ebx
+  802eb5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802eba:	0f 44 d8             	cmove  %eax,%ebx
+  802ebd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ec2:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802ec5:	eb 46                	jmp    802f0d <strtol+0x90>
+		s++;
+  802ec7:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802eca:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ecf:	eb d5                	jmp    802ea6 <strtol+0x29>
+		s++, neg = 1;
+  802ed1:	83 c2 01             	add    $0x1,%edx
+  802ed4:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ed9:	eb cb                	jmp    802ea6 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802edb:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802edf:	74 0e                	je     802eef <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802ee1:	85 db                	test   %ebx,%ebx
+  802ee3:	75 d8                	jne    802ebd <strtol+0x40>
+		s++, base = 8;
+  802ee5:	83 c2 01             	add    $0x1,%edx
+  802ee8:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802eed:	eb ce                	jmp    802ebd <strtol+0x40>
+		s += 2, base = 16;
+  802eef:	83 c2 02             	add    $0x2,%edx
+  802ef2:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802ef7:	eb c4                	jmp    802ebd <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802ef9:	0f be c0             	movsbl %al,%eax
+  802efc:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802eff:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802f02:	7d 3a                	jge    802f3e <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802f04:	83 c2 01             	add    $0x1,%edx
+  802f07:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802f0b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802f0d:	0f b6 02             	movzbl (%edx),%eax
+  802f10:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802f13:	89 f3                	mov    %esi,%ebx
+  802f15:	80 fb 09             	cmp    $0x9,%bl
+  802f18:	76 df                	jbe    802ef9 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  802f1a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802f1d:	89 f3                	mov    %esi,%ebx
+  802f1f:	80 fb 19             	cmp    $0x19,%bl
+  802f22:	77 08                	ja     802f2c <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802f24:	0f be c0             	movsbl %al,%eax
+  802f27:	83 e8 57             	sub    $0x57,%eax
+  802f2a:	eb d3                	jmp    802eff <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802f2c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802f2f:	89 f3                	mov    %esi,%ebx
+  802f31:	80 fb 19             	cmp    $0x19,%bl
+  802f34:	77 08                	ja     802f3e <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802f36:	0f be c0             	movsbl %al,%eax
+  802f39:	83 e8 37             	sub    $0x37,%eax
+  802f3c:	eb c1                	jmp    802eff <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802f3e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802f42:	74 05                	je     802f49 <strtol+0xcc>
+		*endptr = (char *) s;
+  802f44:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f47:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802f49:	89 c8                	mov    %ecx,%eax
+  802f4b:	f7 d8                	neg    %eax
+  802f4d:	85 ff                	test   %edi,%edi
+  802f4f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802f52:	89 c8                	mov    %ecx,%eax
+  802f54:	5b                   	pop    %ebx
+  802f55:	5e                   	pop    %esi
+  802f56:	5f                   	pop    %edi
+  802f57:	5d                   	pop    %ebp
+  802f58:	c3                   	ret
+
+00802f59 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802f59:	55                   	push   %ebp
+  802f5a:	89 e5                	mov    %esp,%ebp
+  802f5c:	57                   	push   %edi
+  802f5d:	56                   	push   %esi
+  802f5e:	53                   	push   %ebx
+  802f5f:	83 ec 20             	sub    $0x20,%esp
+  802f62:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f65:	89 d7                	mov    %edx,%edi
+  802f67:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802f69:	51                   	push   %ecx
+  802f6a:	68 00 f0 7f 00       	push   $0x7ff000
+  802f6f:	6a 00                	push   $0x0
+  802f71:	e8 2e d2 ff ff       	call   8001a4 <sys_page_alloc>
+  802f76:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f78:	83 c4 10             	add    $0x10,%esp
+  802f7b:	85 c0                	test   %eax,%eax
+  802f7d:	78 45                	js     802fc4 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802f7f:	83 ec 04             	sub    $0x4,%esp
+  802f82:	68 00 10 00 00       	push   $0x1000
+  802f87:	57                   	push   %edi
+  802f88:	68 00 f0 7f 00       	push   $0x7ff000
+  802f8d:	e8 1d fe ff ff       	call   802daf <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  802f92:	89 34 24             	mov    %esi,(%esp)
+  802f95:	57                   	push   %edi
+  802f96:	ff 75 e4             	push   -0x1c(%ebp)
+  802f99:	68 00 f0 7f 00       	push   $0x7ff000
+  802f9e:	6a 00                	push   $0x0
+  802fa0:	e8 4a d2 ff ff       	call   8001ef <sys_page_map>
+  802fa5:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802fa7:	83 c4 20             	add    $0x20,%esp
+  802faa:	85 c0                	test   %eax,%eax
+  802fac:	78 16                	js     802fc4 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802fae:	83 ec 08             	sub    $0x8,%esp
+  802fb1:	68 00 f0 7f 00       	push   $0x7ff000
+  802fb6:	6a 00                	push   $0x0
+  802fb8:	e8 74 d2 ff ff       	call   800231 <sys_page_unmap>
+  802fbd:	83 c4 10             	add    $0x10,%esp
+  802fc0:	85 c0                	test   %eax,%eax
+  802fc2:	75 0a                	jne    802fce <copy_page_to+0x75>
+exit:
+	return r;
+}
+  802fc4:	89 d8                	mov    %ebx,%eax
+  802fc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fc9:	5b                   	pop    %ebx
+  802fca:	5e                   	pop    %esi
+  802fcb:	5f                   	pop    %edi
+  802fcc:	5d                   	pop    %ebp
+  802fcd:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802fce:	68 68 3c 80 00       	push   $0x803c68
+  802fd3:	68 64 38 80 00       	push   $0x803864
+  802fd8:	6a 1b                	push   $0x1b
+  802fda:	68 e0 3c 80 00       	push   $0x803ce0
+  802fdf:	e8 7c f5 ff ff       	call   802560 <_panic>
+
+00802fe4 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802fe4:	55                   	push   %ebp
+  802fe5:	89 e5                	mov    %esp,%ebp
+  802fe7:	53                   	push   %ebx
+  802fe8:	83 ec 04             	sub    $0x4,%esp
+  802feb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  802fee:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802ff0:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  802ff4:	74 21                	je     803017 <pgfault+0x33>
+  802ff6:	89 d0                	mov    %edx,%eax
+  802ff8:	c1 e8 16             	shr    $0x16,%eax
+  802ffb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803002:	a8 01                	test   $0x1,%al
+  803004:	74 11                	je     803017 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803006:	89 d0                	mov    %edx,%eax
+  803008:	c1 e8 0c             	shr    $0xc,%eax
+  80300b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803012:	f6 c4 08             	test   $0x8,%ah
+  803015:	75 17                	jne    80302e <pgfault+0x4a>
+		if (pgfault_next) {
+  803017:	a1 04 90 80 00       	mov    0x809004,%eax
+  80301c:	85 c0                	test   %eax,%eax
+  80301e:	74 27                	je     803047 <pgfault+0x63>
+			pgfault_next(utf);
+  803020:	83 ec 0c             	sub    $0xc,%esp
+  803023:	53                   	push   %ebx
+  803024:	ff d0                	call   *%eax
+			return;
+  803026:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803029:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80302c:	c9                   	leave
+  80302d:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  80302e:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803034:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803039:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303e:	e8 16 ff ff ff       	call   802f59 <copy_page_to>
+  803043:	85 c0                	test   %eax,%eax
+  803045:	79 e2                	jns    803029 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803047:	a1 00 50 80 00       	mov    0x805000,%eax
+  80304c:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  80304f:	ff 73 28             	push   0x28(%ebx)
+  803052:	ff 33                	push   (%ebx)
+  803054:	50                   	push   %eax
+  803055:	68 8c 3c 80 00       	push   $0x803c8c
+  80305a:	e8 dc f5 ff ff       	call   80263b <cprintf>
+	sys_env_destroy(0);
+  80305f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803066:	e8 aa d0 ff ff       	call   800115 <sys_env_destroy>
+  80306b:	83 c4 10             	add    $0x10,%esp
+  80306e:	eb b9                	jmp    803029 <pgfault+0x45>
+
+00803070 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803070:	55                   	push   %ebp
+  803071:	89 e5                	mov    %esp,%ebp
+  803073:	53                   	push   %ebx
+  803074:	83 ec 04             	sub    $0x4,%esp
+  803077:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80307a:	a1 08 90 80 00       	mov    0x809008,%eax
+  80307f:	3d e4 2f 80 00       	cmp    $0x802fe4,%eax
+  803084:	74 15                	je     80309b <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803086:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  80308b:	83 ec 0c             	sub    $0xc,%esp
+  80308e:	68 e4 2f 80 00       	push   $0x802fe4
+  803093:	e8 fb 03 00 00       	call   803493 <set_pgfault_handler>
+  803098:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80309b:	83 ec 0c             	sub    $0xc,%esp
+  80309e:	68 05 08 00 00       	push   $0x805
+  8030a3:	53                   	push   %ebx
+  8030a4:	6a 00                	push   $0x0
+  8030a6:	53                   	push   %ebx
+  8030a7:	6a 00                	push   $0x0
+  8030a9:	e8 41 d1 ff ff       	call   8001ef <sys_page_map>
+}
+  8030ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030b1:	c9                   	leave
+  8030b2:	c3                   	ret
+
+008030b3 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8030b3:	55                   	push   %ebp
+  8030b4:	89 e5                	mov    %esp,%ebp
+  8030b6:	57                   	push   %edi
+  8030b7:	56                   	push   %esi
+  8030b8:	53                   	push   %ebx
+  8030b9:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8030bc:	68 e4 2f 80 00       	push   $0x802fe4
+  8030c1:	e8 cd 03 00 00       	call   803493 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8030c6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030cb:	cd 30                	int    $0x30
+  8030cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030d0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8030d3:	83 c4 10             	add    $0x10,%esp
+  8030d6:	85 c0                	test   %eax,%eax
+  8030d8:	0f 88 6b 01 00 00    	js     803249 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030de:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8030e3:	75 37                	jne    80311c <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8030e5:	e8 74 d0 ff ff       	call   80015e <sys_getenvid>
+  8030ea:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030ef:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8030f5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8030fa:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8030ff:	e9 45 01 00 00       	jmp    803249 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803104:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80310a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803110:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803116:	0f 87 ba 00 00 00    	ja     8031d6 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  80311c:	89 d8                	mov    %ebx,%eax
+  80311e:	c1 e8 16             	shr    $0x16,%eax
+  803121:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803128:	a8 01                	test   $0x1,%al
+  80312a:	74 d8                	je     803104 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  80312c:	89 d8                	mov    %ebx,%eax
+  80312e:	c1 e8 0c             	shr    $0xc,%eax
+  803131:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803138:	f6 c2 01             	test   $0x1,%dl
+  80313b:	74 cd                	je     80310a <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  80313d:	89 da                	mov    %ebx,%edx
+  80313f:	80 e6 df             	and    $0xdf,%dh
+  803142:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803148:	74 c0                	je     80310a <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  80314a:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80314c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803153:	f6 c6 04             	test   $0x4,%dh
+  803156:	75 53                	jne    8031ab <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803158:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80315f:	f6 c6 08             	test   $0x8,%dh
+  803162:	75 0c                	jne    803170 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803164:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80316b:	f6 c2 02             	test   $0x2,%dl
+  80316e:	74 3b                	je     8031ab <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803170:	83 ec 0c             	sub    $0xc,%esp
+  803173:	68 05 08 00 00       	push   $0x805
+  803178:	57                   	push   %edi
+  803179:	ff 75 e4             	push   -0x1c(%ebp)
+  80317c:	57                   	push   %edi
+  80317d:	6a 00                	push   $0x0
+  80317f:	e8 6b d0 ff ff       	call   8001ef <sys_page_map>
+  803184:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803186:	83 c4 20             	add    $0x20,%esp
+  803189:	85 c0                	test   %eax,%eax
+  80318b:	0f 88 a7 00 00 00    	js     803238 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803191:	83 ec 0c             	sub    $0xc,%esp
+  803194:	68 05 08 00 00       	push   $0x805
+  803199:	57                   	push   %edi
+  80319a:	6a 00                	push   $0x0
+  80319c:	57                   	push   %edi
+  80319d:	6a 00                	push   $0x0
+  80319f:	e8 4b d0 ff ff       	call   8001ef <sys_page_map>
+  8031a4:	89 c6                	mov    %eax,%esi
+	return r;
+  8031a6:	83 c4 20             	add    $0x20,%esp
+  8031a9:	eb 21                	jmp    8031cc <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8031ab:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8031b2:	83 ec 0c             	sub    $0xc,%esp
+  8031b5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8031ba:	50                   	push   %eax
+  8031bb:	57                   	push   %edi
+  8031bc:	ff 75 e4             	push   -0x1c(%ebp)
+  8031bf:	57                   	push   %edi
+  8031c0:	6a 00                	push   $0x0
+  8031c2:	e8 28 d0 ff ff       	call   8001ef <sys_page_map>
+  8031c7:	89 c6                	mov    %eax,%esi
+  8031c9:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8031cc:	85 f6                	test   %esi,%esi
+  8031ce:	0f 89 36 ff ff ff    	jns    80310a <fork+0x57>
+  8031d4:	eb 62                	jmp    803238 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031d6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031db:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8031e0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8031e3:	89 f8                	mov    %edi,%eax
+  8031e5:	e8 6f fd ff ff       	call   802f59 <copy_page_to>
+  8031ea:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031ec:	85 c0                	test   %eax,%eax
+  8031ee:	78 48                	js     803238 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031f0:	83 ec 04             	sub    $0x4,%esp
+  8031f3:	6a 07                	push   $0x7
+  8031f5:	68 00 f0 bf ee       	push   $0xeebff000
+  8031fa:	57                   	push   %edi
+  8031fb:	e8 a4 cf ff ff       	call   8001a4 <sys_page_alloc>
+  803200:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803202:	83 c4 10             	add    $0x10,%esp
+  803205:	85 c0                	test   %eax,%eax
+  803207:	78 2f                	js     803238 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803209:	a1 00 50 80 00       	mov    0x805000,%eax
+  80320e:	8b 40 64             	mov    0x64(%eax),%eax
+  803211:	83 ec 08             	sub    $0x8,%esp
+  803214:	50                   	push   %eax
+  803215:	57                   	push   %edi
+  803216:	e8 f4 d0 ff ff       	call   80030f <sys_env_set_pgfault_upcall>
+  80321b:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80321d:	83 c4 10             	add    $0x10,%esp
+  803220:	85 c0                	test   %eax,%eax
+  803222:	78 14                	js     803238 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803224:	83 ec 08             	sub    $0x8,%esp
+  803227:	6a 02                	push   $0x2
+  803229:	57                   	push   %edi
+  80322a:	e8 4c d0 ff ff       	call   80027b <sys_env_set_status>
+  80322f:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803231:	83 c4 10             	add    $0x10,%esp
+  803234:	85 c0                	test   %eax,%eax
+  803236:	79 11                	jns    803249 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803238:	83 ec 0c             	sub    $0xc,%esp
+  80323b:	ff 75 e0             	push   -0x20(%ebp)
+  80323e:	e8 d2 ce ff ff       	call   800115 <sys_env_destroy>
+	return r;
+  803243:	83 c4 10             	add    $0x10,%esp
+  803246:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803249:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80324c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80324f:	5b                   	pop    %ebx
+  803250:	5e                   	pop    %esi
+  803251:	5f                   	pop    %edi
+  803252:	5d                   	pop    %ebp
+  803253:	c3                   	ret
+
+00803254 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803254:	55                   	push   %ebp
+  803255:	89 e5                	mov    %esp,%ebp
+  803257:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80325a:	68 eb 3c 80 00       	push   $0x803ceb
+  80325f:	68 bf 00 00 00       	push   $0xbf
+  803264:	68 e0 3c 80 00       	push   $0x803ce0
+  803269:	e8 f2 f2 ff ff       	call   802560 <_panic>
+
+0080326e <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80326e:	55                   	push   %ebp
+  80326f:	89 e5                	mov    %esp,%ebp
+  803271:	56                   	push   %esi
+  803272:	53                   	push   %ebx
+  803273:	8b 75 08             	mov    0x8(%ebp),%esi
+  803276:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803279:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80327c:	85 c0                	test   %eax,%eax
+  80327e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803283:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803286:	83 ec 0c             	sub    $0xc,%esp
+  803289:	50                   	push   %eax
+  80328a:	e8 5d d1 ff ff       	call   8003ec <sys_ipc_recv>
+	if (from_env_store)
+  80328f:	83 c4 10             	add    $0x10,%esp
+  803292:	85 f6                	test   %esi,%esi
+  803294:	74 14                	je     8032aa <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803296:	ba 00 00 00 00       	mov    $0x0,%edx
+  80329b:	85 c0                	test   %eax,%eax
+  80329d:	75 09                	jne    8032a8 <ipc_recv+0x3a>
+  80329f:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8032a5:	8b 52 74             	mov    0x74(%edx),%edx
+  8032a8:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8032aa:	85 db                	test   %ebx,%ebx
+  8032ac:	74 25                	je     8032d3 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8032ae:	85 c0                	test   %eax,%eax
+  8032b0:	74 0d                	je     8032bf <ipc_recv+0x51>
+  8032b2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8032b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032bb:	5b                   	pop    %ebx
+  8032bc:	5e                   	pop    %esi
+  8032bd:	5d                   	pop    %ebp
+  8032be:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8032bf:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032c4:	8b 40 78             	mov    0x78(%eax),%eax
+  8032c7:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8032c9:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032ce:	8b 40 70             	mov    0x70(%eax),%eax
+  8032d1:	eb e5                	jmp    8032b8 <ipc_recv+0x4a>
+  8032d3:	85 c0                	test   %eax,%eax
+  8032d5:	75 e1                	jne    8032b8 <ipc_recv+0x4a>
+  8032d7:	eb f0                	jmp    8032c9 <ipc_recv+0x5b>
+
+008032d9 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8032d9:	55                   	push   %ebp
+  8032da:	89 e5                	mov    %esp,%ebp
+  8032dc:	57                   	push   %edi
+  8032dd:	56                   	push   %esi
+  8032de:	53                   	push   %ebx
+  8032df:	83 ec 0c             	sub    $0xc,%esp
+  8032e2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032e5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032eb:	85 db                	test   %ebx,%ebx
+  8032ed:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032f2:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8032f5:	ff 75 14             	push   0x14(%ebp)
+  8032f8:	53                   	push   %ebx
+  8032f9:	56                   	push   %esi
+  8032fa:	57                   	push   %edi
+  8032fb:	e8 59 d0 ff ff       	call   800359 <sys_ipc_try_send>
+  803300:	83 c4 10             	add    $0x10,%esp
+  803303:	85 c0                	test   %eax,%eax
+  803305:	74 22                	je     803329 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803307:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80330a:	75 07                	jne    803313 <ipc_send+0x3a>
+		sys_yield();
+  80330c:	e8 74 ce ff ff       	call   800185 <sys_yield>
+  803311:	eb e2                	jmp    8032f5 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803313:	68 01 3d 80 00       	push   $0x803d01
+  803318:	68 64 38 80 00       	push   $0x803864
+  80331d:	6a 39                	push   $0x39
+  80331f:	68 16 3d 80 00       	push   $0x803d16
+  803324:	e8 37 f2 ff ff       	call   802560 <_panic>
+	}
+}
+  803329:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80332c:	5b                   	pop    %ebx
+  80332d:	5e                   	pop    %esi
+  80332e:	5f                   	pop    %edi
+  80332f:	5d                   	pop    %ebp
+  803330:	c3                   	ret
+
+00803331 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803331:	55                   	push   %ebp
+  803332:	89 e5                	mov    %esp,%ebp
+  803334:	57                   	push   %edi
+  803335:	56                   	push   %esi
+  803336:	53                   	push   %ebx
+  803337:	83 ec 10             	sub    $0x10,%esp
+  80333a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80333d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803340:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803343:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803346:	85 c0                	test   %eax,%eax
+  803348:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80334d:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803350:	6a 00                	push   $0x0
+  803352:	ff 33                	push   (%ebx)
+  803354:	50                   	push   %eax
+  803355:	e8 4f d0 ff ff       	call   8003a9 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80335a:	83 c4 10             	add    $0x10,%esp
+  80335d:	85 c0                	test   %eax,%eax
+  80335f:	75 3c                	jne    80339d <ipc_recvv+0x6c>
+  803361:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803367:	8b 52 7c             	mov    0x7c(%edx),%edx
+  80336a:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  80336c:	85 ff                	test   %edi,%edi
+  80336e:	74 4e                	je     8033be <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803370:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803376:	8b 52 74             	mov    0x74(%edx),%edx
+  803379:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  80337b:	85 f6                	test   %esi,%esi
+  80337d:	74 18                	je     803397 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80337f:	85 c0                	test   %eax,%eax
+  803381:	75 2d                	jne    8033b0 <ipc_recvv+0x7f>
+  803383:	a1 00 50 80 00       	mov    0x805000,%eax
+  803388:	8b 40 78             	mov    0x78(%eax),%eax
+  80338b:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  80338d:	a1 00 50 80 00       	mov    0x805000,%eax
+  803392:	8b 40 70             	mov    0x70(%eax),%eax
+  803395:	eb 1f                	jmp    8033b6 <ipc_recvv+0x85>
+  803397:	85 c0                	test   %eax,%eax
+  803399:	75 1b                	jne    8033b6 <ipc_recvv+0x85>
+  80339b:	eb f0                	jmp    80338d <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80339d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8033a3:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8033a8:	85 ff                	test   %edi,%edi
+  8033aa:	75 cd                	jne    803379 <ipc_recvv+0x48>
+	if (perm_store)
+  8033ac:	85 f6                	test   %esi,%esi
+  8033ae:	74 e7                	je     803397 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033b0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8033b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033b9:	5b                   	pop    %ebx
+  8033ba:	5e                   	pop    %esi
+  8033bb:	5f                   	pop    %edi
+  8033bc:	5d                   	pop    %ebp
+  8033bd:	c3                   	ret
+	if (perm_store)
+  8033be:	85 f6                	test   %esi,%esi
+  8033c0:	75 bd                	jne    80337f <ipc_recvv+0x4e>
+  8033c2:	eb c9                	jmp    80338d <ipc_recvv+0x5c>
+
+008033c4 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8033c4:	55                   	push   %ebp
+  8033c5:	89 e5                	mov    %esp,%ebp
+  8033c7:	57                   	push   %edi
+  8033c8:	56                   	push   %esi
+  8033c9:	53                   	push   %ebx
+  8033ca:	83 ec 0c             	sub    $0xc,%esp
+  8033cd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033d0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8033d6:	ff 75 14             	push   0x14(%ebp)
+  8033d9:	53                   	push   %ebx
+  8033da:	56                   	push   %esi
+  8033db:	57                   	push   %edi
+  8033dc:	e8 a0 cf ff ff       	call   800381 <sys_ipc_try_sendv>
+  8033e1:	83 c4 10             	add    $0x10,%esp
+  8033e4:	85 c0                	test   %eax,%eax
+  8033e6:	74 22                	je     80340a <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8033e8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033eb:	75 07                	jne    8033f4 <ipc_sendv+0x30>
+		sys_yield();
+  8033ed:	e8 93 cd ff ff       	call   800185 <sys_yield>
+  8033f2:	eb e2                	jmp    8033d6 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8033f4:	68 01 3d 80 00       	push   $0x803d01
+  8033f9:	68 64 38 80 00       	push   $0x803864
+  8033fe:	6a 5c                	push   $0x5c
+  803400:	68 16 3d 80 00       	push   $0x803d16
+  803405:	e8 56 f1 ff ff       	call   802560 <_panic>
+	}
+}
+  80340a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80340d:	5b                   	pop    %ebx
+  80340e:	5e                   	pop    %esi
+  80340f:	5f                   	pop    %edi
+  803410:	5d                   	pop    %ebp
+  803411:	c3                   	ret
+
+00803412 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803412:	55                   	push   %ebp
+  803413:	89 e5                	mov    %esp,%ebp
+  803415:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803418:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80341d:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803423:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803429:	8b 52 50             	mov    0x50(%edx),%edx
+  80342c:	39 ca                	cmp    %ecx,%edx
+  80342e:	74 11                	je     803441 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803430:	83 c0 01             	add    $0x1,%eax
+  803433:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803438:	75 e3                	jne    80341d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80343a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80343f:	eb 0e                	jmp    80344f <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803441:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803447:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80344c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80344f:	5d                   	pop    %ebp
+  803450:	c3                   	ret
+
+00803451 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803451:	55                   	push   %ebp
+  803452:	89 e5                	mov    %esp,%ebp
+  803454:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803457:	89 c2                	mov    %eax,%edx
+  803459:	c1 ea 16             	shr    $0x16,%edx
+  80345c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803463:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803468:	f6 c1 01             	test   $0x1,%cl
+  80346b:	74 22                	je     80348f <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80346d:	c1 e8 0c             	shr    $0xc,%eax
+  803470:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803477:	a8 01                	test   $0x1,%al
+  803479:	74 14                	je     80348f <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80347b:	c1 e8 0c             	shr    $0xc,%eax
+  80347e:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803481:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803488:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  80348c:	0f b7 d2             	movzwl %dx,%edx
+}
+  80348f:	89 d0                	mov    %edx,%eax
+  803491:	5d                   	pop    %ebp
+  803492:	c3                   	ret
+
+00803493 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803493:	55                   	push   %ebp
+  803494:	89 e5                	mov    %esp,%ebp
+  803496:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803499:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  8034a0:	74 0a                	je     8034ac <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8034a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034a5:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  8034aa:	c9                   	leave
+  8034ab:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034ac:	83 ec 04             	sub    $0x4,%esp
+  8034af:	6a 07                	push   $0x7
+  8034b1:	68 00 f0 bf ee       	push   $0xeebff000
+  8034b6:	6a 00                	push   $0x0
+  8034b8:	e8 e7 cc ff ff       	call   8001a4 <sys_page_alloc>
+  8034bd:	83 c4 10             	add    $0x10,%esp
+  8034c0:	85 c0                	test   %eax,%eax
+  8034c2:	75 2c                	jne    8034f0 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8034c4:	83 ec 08             	sub    $0x8,%esp
+  8034c7:	68 06 35 80 00       	push   $0x803506
+  8034cc:	6a 00                	push   $0x0
+  8034ce:	e8 3c ce ff ff       	call   80030f <sys_env_set_pgfault_upcall>
+  8034d3:	83 c4 10             	add    $0x10,%esp
+  8034d6:	85 c0                	test   %eax,%eax
+  8034d8:	74 c8                	je     8034a2 <set_pgfault_handler+0xf>
+  8034da:	68 68 3d 80 00       	push   $0x803d68
+  8034df:	68 64 38 80 00       	push   $0x803864
+  8034e4:	6a 20                	push   $0x20
+  8034e6:	68 98 3d 80 00       	push   $0x803d98
+  8034eb:	e8 70 f0 ff ff       	call   802560 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034f0:	68 20 3d 80 00       	push   $0x803d20
+  8034f5:	68 64 38 80 00       	push   $0x803864
+  8034fa:	6a 1e                	push   $0x1e
+  8034fc:	68 98 3d 80 00       	push   $0x803d98
+  803501:	e8 5a f0 ff ff       	call   802560 <_panic>
+
+00803506 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803506:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803507:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  80350c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80350e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803511:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803516:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  80351b:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  80351f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803522:	83 c4 08             	add    $0x8,%esp
+	popal
+  803525:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803526:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803529:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  80352a:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80352b:	c3                   	ret
+
+0080352c <dm>:
+  80352c:	55                   	push   %ebp
+  80352d:	57                   	push   %edi
+  80352e:	56                   	push   %esi
+  80352f:	53                   	push   %ebx
+  803530:	83 ec 24             	sub    $0x24,%esp
+  803533:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803537:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80353b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80353f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803543:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803547:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80354b:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80354f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803554:	b8 00 00 00 00       	mov    $0x0,%eax
+  803559:	ba 00 00 00 00       	mov    $0x0,%edx
+  80355e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803565:	00 
+  803566:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80356d:	00 
+  80356e:	89 fb                	mov    %edi,%ebx
+  803570:	eb 08                	jmp    80357a <dm+0x4e>
+  803572:	83 e9 01             	sub    $0x1,%ecx
+  803575:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803578:	74 68                	je     8035e2 <dm+0xb6>
+  80357a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80357e:	01 c0                	add    %eax,%eax
+  803580:	89 c6                	mov    %eax,%esi
+  803582:	89 d7                	mov    %edx,%edi
+  803584:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803588:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80358c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80358f:	d3 ea                	shr    %cl,%edx
+  803591:	f6 c1 20             	test   $0x20,%cl
+  803594:	74 04                	je     80359a <dm+0x6e>
+  803596:	89 d0                	mov    %edx,%eax
+  803598:	31 d2                	xor    %edx,%edx
+  80359a:	83 e0 01             	and    $0x1,%eax
+  80359d:	89 04 24             	mov    %eax,(%esp)
+  8035a0:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8035a7:	00 
+  8035a8:	8b 04 24             	mov    (%esp),%eax
+  8035ab:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8035af:	09 f0                	or     %esi,%eax
+  8035b1:	09 fa                	or     %edi,%edx
+  8035b3:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8035b7:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8035bb:	39 f0                	cmp    %esi,%eax
+  8035bd:	89 d5                	mov    %edx,%ebp
+  8035bf:	19 fd                	sbb    %edi,%ebp
+  8035c1:	72 af                	jb     803572 <dm+0x46>
+  8035c3:	29 f0                	sub    %esi,%eax
+  8035c5:	19 fa                	sbb    %edi,%edx
+  8035c7:	89 cf                	mov    %ecx,%edi
+  8035c9:	c1 ef 05             	shr    $0x5,%edi
+  8035cc:	83 e7 01             	and    $0x1,%edi
+  8035cf:	89 fe                	mov    %edi,%esi
+  8035d1:	83 f6 01             	xor    $0x1,%esi
+  8035d4:	d3 e6                	shl    %cl,%esi
+  8035d6:	d3 e7                	shl    %cl,%edi
+  8035d8:	09 74 24 18          	or     %esi,0x18(%esp)
+  8035dc:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8035e0:	eb 90                	jmp    803572 <dm+0x46>
+  8035e2:	85 db                	test   %ebx,%ebx
+  8035e4:	74 05                	je     8035eb <dm+0xbf>
+  8035e6:	89 03                	mov    %eax,(%ebx)
+  8035e8:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035eb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035ef:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035f3:	83 c4 24             	add    $0x24,%esp
+  8035f6:	5b                   	pop    %ebx
+  8035f7:	5e                   	pop    %esi
+  8035f8:	5f                   	pop    %edi
+  8035f9:	5d                   	pop    %ebp
+  8035fa:	c3                   	ret
+
+008035fb <__udivdi3>:
+  8035fb:	83 ec 08             	sub    $0x8,%esp
+  8035fe:	6a 00                	push   $0x0
+  803600:	ff 74 24 1c          	push   0x1c(%esp)
+  803604:	ff 74 24 1c          	push   0x1c(%esp)
+  803608:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80360c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803610:	e8 17 ff ff ff       	call   80352c <dm>
+  803615:	83 c4 14             	add    $0x14,%esp
+  803618:	c3                   	ret
+
+00803619 <__umoddi3>:
+  803619:	83 ec 18             	sub    $0x18,%esp
+  80361c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803620:	50                   	push   %eax
+  803621:	ff 74 24 2c          	push   0x2c(%esp)
+  803625:	ff 74 24 2c          	push   0x2c(%esp)
+  803629:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80362d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803631:	e8 f6 fe ff ff       	call   80352c <dm>
+  803636:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80363a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80363e:	83 c4 24             	add    $0x24,%esp
+  803641:	c3                   	ret
+
+00803642 <__divdi3>:
+  803642:	53                   	push   %ebx
+  803643:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803647:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80364b:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80364f:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803653:	85 d2                	test   %edx,%edx
+  803655:	78 15                	js     80366c <__divdi3+0x2a>
+  803657:	85 db                	test   %ebx,%ebx
+  803659:	78 34                	js     80368f <__divdi3+0x4d>
+  80365b:	83 ec 04             	sub    $0x4,%esp
+  80365e:	6a 00                	push   $0x0
+  803660:	53                   	push   %ebx
+  803661:	51                   	push   %ecx
+  803662:	e8 c5 fe ff ff       	call   80352c <dm>
+  803667:	83 c4 10             	add    $0x10,%esp
+  80366a:	eb 21                	jmp    80368d <__divdi3+0x4b>
+  80366c:	f7 d8                	neg    %eax
+  80366e:	83 d2 00             	adc    $0x0,%edx
+  803671:	f7 da                	neg    %edx
+  803673:	85 db                	test   %ebx,%ebx
+  803675:	78 30                	js     8036a7 <__divdi3+0x65>
+  803677:	83 ec 04             	sub    $0x4,%esp
+  80367a:	6a 00                	push   $0x0
+  80367c:	53                   	push   %ebx
+  80367d:	51                   	push   %ecx
+  80367e:	e8 a9 fe ff ff       	call   80352c <dm>
+  803683:	83 c4 10             	add    $0x10,%esp
+  803686:	f7 d8                	neg    %eax
+  803688:	83 d2 00             	adc    $0x0,%edx
+  80368b:	f7 da                	neg    %edx
+  80368d:	5b                   	pop    %ebx
+  80368e:	c3                   	ret
+  80368f:	83 ec 04             	sub    $0x4,%esp
+  803692:	6a 00                	push   $0x0
+  803694:	f7 d9                	neg    %ecx
+  803696:	83 d3 00             	adc    $0x0,%ebx
+  803699:	f7 db                	neg    %ebx
+  80369b:	53                   	push   %ebx
+  80369c:	51                   	push   %ecx
+  80369d:	e8 8a fe ff ff       	call   80352c <dm>
+  8036a2:	83 c4 10             	add    $0x10,%esp
+  8036a5:	eb df                	jmp    803686 <__divdi3+0x44>
+  8036a7:	83 ec 04             	sub    $0x4,%esp
+  8036aa:	6a 00                	push   $0x0
+  8036ac:	f7 d9                	neg    %ecx
+  8036ae:	83 d3 00             	adc    $0x0,%ebx
+  8036b1:	f7 db                	neg    %ebx
+  8036b3:	53                   	push   %ebx
+  8036b4:	51                   	push   %ecx
+  8036b5:	e8 72 fe ff ff       	call   80352c <dm>
+  8036ba:	83 c4 10             	add    $0x10,%esp
+  8036bd:	eb ce                	jmp    80368d <__divdi3+0x4b>
+
+008036bf <__moddi3>:
+  8036bf:	55                   	push   %ebp
+  8036c0:	57                   	push   %edi
+  8036c1:	56                   	push   %esi
+  8036c2:	53                   	push   %ebx
+  8036c3:	83 ec 24             	sub    $0x24,%esp
+  8036c6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036ca:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036ce:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036d2:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036d6:	85 d2                	test   %edx,%edx
+  8036d8:	78 3b                	js     803715 <__moddi3+0x56>
+  8036da:	83 ec 04             	sub    $0x4,%esp
+  8036dd:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036e1:	56                   	push   %esi
+  8036e2:	89 ce                	mov    %ecx,%esi
+  8036e4:	f7 de                	neg    %esi
+  8036e6:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8036ea:	89 de                	mov    %ebx,%esi
+  8036ec:	83 d6 00             	adc    $0x0,%esi
+  8036ef:	f7 de                	neg    %esi
+  8036f1:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8036f5:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8036f9:	0f 48 f1             	cmovs  %ecx,%esi
+  8036fc:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803701:	53                   	push   %ebx
+  803702:	56                   	push   %esi
+  803703:	e8 24 fe ff ff       	call   80352c <dm>
+  803708:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80370c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803710:	83 c4 10             	add    $0x10,%esp
+  803713:	eb 47                	jmp    80375c <__moddi3+0x9d>
+  803715:	f7 d8                	neg    %eax
+  803717:	83 d2 00             	adc    $0x0,%edx
+  80371a:	f7 da                	neg    %edx
+  80371c:	83 ec 04             	sub    $0x4,%esp
+  80371f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803723:	56                   	push   %esi
+  803724:	89 cf                	mov    %ecx,%edi
+  803726:	f7 df                	neg    %edi
+  803728:	89 de                	mov    %ebx,%esi
+  80372a:	83 d6 00             	adc    $0x0,%esi
+  80372d:	f7 de                	neg    %esi
+  80372f:	0f 49 cf             	cmovns %edi,%ecx
+  803732:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803736:	0f 49 de             	cmovns %esi,%ebx
+  803739:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80373d:	ff 74 24 0c          	push   0xc(%esp)
+  803741:	ff 74 24 0c          	push   0xc(%esp)
+  803745:	e8 e2 fd ff ff       	call   80352c <dm>
+  80374a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80374e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803752:	f7 d8                	neg    %eax
+  803754:	83 d2 00             	adc    $0x0,%edx
+  803757:	f7 da                	neg    %edx
+  803759:	83 c4 10             	add    $0x10,%esp
+  80375c:	83 c4 24             	add    $0x24,%esp
+  80375f:	5b                   	pop    %ebx
+  803760:	5e                   	pop    %esi
+  803761:	5f                   	pop    %edi
+  803762:	5d                   	pop    %ebp
+  803763:	c3                   	ret
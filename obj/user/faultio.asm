@@ -0,0 +1,7659 @@
+
+obj/user/faultio.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 3e 00 00 00       	call   80006f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+
+static inline uint32_t
+read_eflags(void)
+{
+	uint32_t eflags;
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+  800039:	9c                   	pushf
+  80003a:	58                   	pop    %eax
+        int x, r;
+	int nsecs = 1;
+	int secno = 0;
+	int diskno = 1;
+
+	if (read_eflags() & FL_IOPL_3)
+  80003b:	f6 c4 30             	test   $0x30,%ah
+  80003e:	75 1d                	jne    80005d <umain+0x2a>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800040:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  800045:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  80004a:	ee                   	out    %al,(%dx)
+
+	// this outb to select disk 1 should result in a general protection
+	// fault, because user-level code shouldn't be able to use the io space.
+	outb(0x1F6, 0xE0 | (1<<4));
+
+        cprintf("%s: made it here --- bug\n");
+  80004b:	83 ec 0c             	sub    $0xc,%esp
+  80004e:	68 8e 37 80 00       	push   $0x80378e
+  800053:	e8 0f 01 00 00       	call   800167 <cprintf>
+}
+  800058:	83 c4 10             	add    $0x10,%esp
+  80005b:	c9                   	leave
+  80005c:	c3                   	ret
+		cprintf("eflags wrong\n");
+  80005d:	83 ec 0c             	sub    $0xc,%esp
+  800060:	68 80 37 80 00       	push   $0x803780
+  800065:	e8 fd 00 00 00       	call   800167 <cprintf>
+  80006a:	83 c4 10             	add    $0x10,%esp
+  80006d:	eb d1                	jmp    800040 <umain+0xd>
+
+0080006f <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80006f:	55                   	push   %ebp
+  800070:	89 e5                	mov    %esp,%ebp
+  800072:	56                   	push   %esi
+  800073:	53                   	push   %ebx
+  800074:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800077:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80007a:	e8 9c 0a 00 00       	call   800b1b <sys_getenvid>
+  80007f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800084:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80008a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80008f:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800094:	85 db                	test   %ebx,%ebx
+  800096:	7e 07                	jle    80009f <libmain+0x30>
+		binaryname = argv[0];
+  800098:	8b 06                	mov    (%esi),%eax
+  80009a:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80009f:	83 ec 08             	sub    $0x8,%esp
+  8000a2:	56                   	push   %esi
+  8000a3:	53                   	push   %ebx
+  8000a4:	e8 8a ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000a9:	e8 0a 00 00 00       	call   8000b8 <exit>
+}
+  8000ae:	83 c4 10             	add    $0x10,%esp
+  8000b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000b4:	5b                   	pop    %ebx
+  8000b5:	5e                   	pop    %esi
+  8000b6:	5d                   	pop    %ebp
+  8000b7:	c3                   	ret
+
+008000b8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000b8:	55                   	push   %ebp
+  8000b9:	89 e5                	mov    %esp,%ebp
+  8000bb:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000be:	e8 73 10 00 00       	call   801136 <close_all>
+	sys_env_destroy(0);
+  8000c3:	83 ec 0c             	sub    $0xc,%esp
+  8000c6:	6a 00                	push   $0x0
+  8000c8:	e8 05 0a 00 00       	call   800ad2 <sys_env_destroy>
+}
+  8000cd:	83 c4 10             	add    $0x10,%esp
+  8000d0:	c9                   	leave
+  8000d1:	c3                   	ret
+
+008000d2 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000d2:	55                   	push   %ebp
+  8000d3:	89 e5                	mov    %esp,%ebp
+  8000d5:	53                   	push   %ebx
+  8000d6:	83 ec 04             	sub    $0x4,%esp
+  8000d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000dc:	8b 13                	mov    (%ebx),%edx
+  8000de:	8d 42 01             	lea    0x1(%edx),%eax
+  8000e1:	89 03                	mov    %eax,(%ebx)
+  8000e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000e6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000ea:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000ef:	74 09                	je     8000fa <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000f1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000f8:	c9                   	leave
+  8000f9:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000fa:	83 ec 08             	sub    $0x8,%esp
+  8000fd:	68 ff 00 00 00       	push   $0xff
+  800102:	8d 43 08             	lea    0x8(%ebx),%eax
+  800105:	50                   	push   %eax
+  800106:	e8 7a 09 00 00       	call   800a85 <sys_cputs>
+		b->idx = 0;
+  80010b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800111:	83 c4 10             	add    $0x10,%esp
+  800114:	eb db                	jmp    8000f1 <putch+0x1f>
+
+00800116 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800116:	55                   	push   %ebp
+  800117:	89 e5                	mov    %esp,%ebp
+  800119:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80011f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800126:	00 00 00 
+	b.cnt = 0;
+  800129:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800130:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800133:	ff 75 0c             	push   0xc(%ebp)
+  800136:	ff 75 08             	push   0x8(%ebp)
+  800139:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80013f:	50                   	push   %eax
+  800140:	68 d2 00 80 00       	push   $0x8000d2
+  800145:	e8 14 01 00 00       	call   80025e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80014a:	83 c4 08             	add    $0x8,%esp
+  80014d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800153:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800159:	50                   	push   %eax
+  80015a:	e8 26 09 00 00       	call   800a85 <sys_cputs>
+
+	return b.cnt;
+}
+  80015f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800165:	c9                   	leave
+  800166:	c3                   	ret
+
+00800167 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800167:	55                   	push   %ebp
+  800168:	89 e5                	mov    %esp,%ebp
+  80016a:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80016d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800170:	50                   	push   %eax
+  800171:	ff 75 08             	push   0x8(%ebp)
+  800174:	e8 9d ff ff ff       	call   800116 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800179:	c9                   	leave
+  80017a:	c3                   	ret
+
+0080017b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80017b:	55                   	push   %ebp
+  80017c:	89 e5                	mov    %esp,%ebp
+  80017e:	57                   	push   %edi
+  80017f:	56                   	push   %esi
+  800180:	53                   	push   %ebx
+  800181:	83 ec 1c             	sub    $0x1c,%esp
+  800184:	89 c7                	mov    %eax,%edi
+  800186:	89 d6                	mov    %edx,%esi
+  800188:	8b 45 08             	mov    0x8(%ebp),%eax
+  80018b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80018e:	89 d1                	mov    %edx,%ecx
+  800190:	89 c2                	mov    %eax,%edx
+  800192:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800195:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800198:	8b 45 10             	mov    0x10(%ebp),%eax
+  80019b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80019e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001a1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001a8:	39 c2                	cmp    %eax,%edx
+  8001aa:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001ad:	72 3e                	jb     8001ed <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001af:	83 ec 0c             	sub    $0xc,%esp
+  8001b2:	ff 75 18             	push   0x18(%ebp)
+  8001b5:	83 eb 01             	sub    $0x1,%ebx
+  8001b8:	53                   	push   %ebx
+  8001b9:	50                   	push   %eax
+  8001ba:	83 ec 08             	sub    $0x8,%esp
+  8001bd:	ff 75 e4             	push   -0x1c(%ebp)
+  8001c0:	ff 75 e0             	push   -0x20(%ebp)
+  8001c3:	ff 75 dc             	push   -0x24(%ebp)
+  8001c6:	ff 75 d8             	push   -0x28(%ebp)
+  8001c9:	e8 37 34 00 00       	call   803605 <__udivdi3>
+  8001ce:	83 c4 18             	add    $0x18,%esp
+  8001d1:	52                   	push   %edx
+  8001d2:	50                   	push   %eax
+  8001d3:	89 f2                	mov    %esi,%edx
+  8001d5:	89 f8                	mov    %edi,%eax
+  8001d7:	e8 9f ff ff ff       	call   80017b <printnum>
+  8001dc:	83 c4 20             	add    $0x20,%esp
+  8001df:	eb 13                	jmp    8001f4 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001e1:	83 ec 08             	sub    $0x8,%esp
+  8001e4:	56                   	push   %esi
+  8001e5:	ff 75 18             	push   0x18(%ebp)
+  8001e8:	ff d7                	call   *%edi
+  8001ea:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001ed:	83 eb 01             	sub    $0x1,%ebx
+  8001f0:	85 db                	test   %ebx,%ebx
+  8001f2:	7f ed                	jg     8001e1 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001f4:	83 ec 08             	sub    $0x8,%esp
+  8001f7:	56                   	push   %esi
+  8001f8:	83 ec 04             	sub    $0x4,%esp
+  8001fb:	ff 75 e4             	push   -0x1c(%ebp)
+  8001fe:	ff 75 e0             	push   -0x20(%ebp)
+  800201:	ff 75 dc             	push   -0x24(%ebp)
+  800204:	ff 75 d8             	push   -0x28(%ebp)
+  800207:	e8 17 34 00 00       	call   803623 <__umoddi3>
+  80020c:	83 c4 14             	add    $0x14,%esp
+  80020f:	0f be 80 b2 37 80 00 	movsbl 0x8037b2(%eax),%eax
+  800216:	50                   	push   %eax
+  800217:	ff d7                	call   *%edi
+}
+  800219:	83 c4 10             	add    $0x10,%esp
+  80021c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80021f:	5b                   	pop    %ebx
+  800220:	5e                   	pop    %esi
+  800221:	5f                   	pop    %edi
+  800222:	5d                   	pop    %ebp
+  800223:	c3                   	ret
+
+00800224 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800224:	55                   	push   %ebp
+  800225:	89 e5                	mov    %esp,%ebp
+  800227:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80022a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80022e:	8b 10                	mov    (%eax),%edx
+  800230:	3b 50 04             	cmp    0x4(%eax),%edx
+  800233:	73 0a                	jae    80023f <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800235:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800238:	89 08                	mov    %ecx,(%eax)
+  80023a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80023d:	88 02                	mov    %al,(%edx)
+}
+  80023f:	5d                   	pop    %ebp
+  800240:	c3                   	ret
+
+00800241 <printfmt>:
+{
+  800241:	55                   	push   %ebp
+  800242:	89 e5                	mov    %esp,%ebp
+  800244:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800247:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80024a:	50                   	push   %eax
+  80024b:	ff 75 10             	push   0x10(%ebp)
+  80024e:	ff 75 0c             	push   0xc(%ebp)
+  800251:	ff 75 08             	push   0x8(%ebp)
+  800254:	e8 05 00 00 00       	call   80025e <vprintfmt>
+}
+  800259:	83 c4 10             	add    $0x10,%esp
+  80025c:	c9                   	leave
+  80025d:	c3                   	ret
+
+0080025e <vprintfmt>:
+{
+  80025e:	55                   	push   %ebp
+  80025f:	89 e5                	mov    %esp,%ebp
+  800261:	57                   	push   %edi
+  800262:	56                   	push   %esi
+  800263:	53                   	push   %ebx
+  800264:	83 ec 2c             	sub    $0x2c,%esp
+  800267:	8b 75 08             	mov    0x8(%ebp),%esi
+  80026a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80026d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800270:	eb 0a                	jmp    80027c <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800272:	83 ec 08             	sub    $0x8,%esp
+  800275:	53                   	push   %ebx
+  800276:	50                   	push   %eax
+  800277:	ff d6                	call   *%esi
+  800279:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80027c:	83 c7 01             	add    $0x1,%edi
+  80027f:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800283:	83 f8 25             	cmp    $0x25,%eax
+  800286:	74 0c                	je     800294 <vprintfmt+0x36>
+			if (ch == '\0')
+  800288:	85 c0                	test   %eax,%eax
+  80028a:	75 e6                	jne    800272 <vprintfmt+0x14>
+}
+  80028c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028f:	5b                   	pop    %ebx
+  800290:	5e                   	pop    %esi
+  800291:	5f                   	pop    %edi
+  800292:	5d                   	pop    %ebp
+  800293:	c3                   	ret
+		padc = ' ';
+  800294:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800298:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80029f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002a6:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002b2:	8d 47 01             	lea    0x1(%edi),%eax
+  8002b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002b8:	0f b6 17             	movzbl (%edi),%edx
+  8002bb:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002be:	3c 55                	cmp    $0x55,%al
+  8002c0:	0f 87 cf 03 00 00    	ja     800695 <vprintfmt+0x437>
+  8002c6:	0f b6 c0             	movzbl %al,%eax
+  8002c9:	ff 24 85 20 39 80 00 	jmp    *0x803920(,%eax,4)
+  8002d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002d3:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002d7:	eb d9                	jmp    8002b2 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002dc:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002e0:	eb d0                	jmp    8002b2 <vprintfmt+0x54>
+  8002e2:	0f b6 d2             	movzbl %dl,%edx
+  8002e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ed:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002f0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002f3:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002f7:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002fa:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002fd:	83 f9 09             	cmp    $0x9,%ecx
+  800300:	77 55                	ja     800357 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800302:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800305:	eb e9                	jmp    8002f0 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800307:	8b 45 14             	mov    0x14(%ebp),%eax
+  80030a:	8b 00                	mov    (%eax),%eax
+  80030c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80030f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800312:	8d 40 04             	lea    0x4(%eax),%eax
+  800315:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800318:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80031b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80031f:	79 91                	jns    8002b2 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800321:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800324:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800327:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80032e:	eb 82                	jmp    8002b2 <vprintfmt+0x54>
+			if (width < 0)
+  800330:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800333:	85 d2                	test   %edx,%edx
+  800335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033a:	0f 49 c2             	cmovns %edx,%eax
+  80033d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800340:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800343:	e9 6a ff ff ff       	jmp    8002b2 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800348:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80034b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800352:	e9 5b ff ff ff       	jmp    8002b2 <vprintfmt+0x54>
+  800357:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80035a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80035d:	eb bc                	jmp    80031b <vprintfmt+0xbd>
+			lflag++;
+  80035f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800362:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800365:	e9 48 ff ff ff       	jmp    8002b2 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80036a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036d:	8d 78 04             	lea    0x4(%eax),%edi
+  800370:	83 ec 08             	sub    $0x8,%esp
+  800373:	53                   	push   %ebx
+  800374:	ff 30                	push   (%eax)
+  800376:	ff d6                	call   *%esi
+			break;
+  800378:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80037b:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80037e:	e9 b1 02 00 00       	jmp    800634 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800383:	8b 45 14             	mov    0x14(%ebp),%eax
+  800386:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800389:	8b 10                	mov    (%eax),%edx
+  80038b:	89 d0                	mov    %edx,%eax
+  80038d:	f7 d8                	neg    %eax
+  80038f:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800392:	83 f8 11             	cmp    $0x11,%eax
+  800395:	7f 23                	jg     8003ba <vprintfmt+0x15c>
+  800397:	8b 14 85 80 3a 80 00 	mov    0x803a80(,%eax,4),%edx
+  80039e:	85 d2                	test   %edx,%edx
+  8003a0:	74 18                	je     8003ba <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003a2:	52                   	push   %edx
+  8003a3:	68 d2 3b 80 00       	push   $0x803bd2
+  8003a8:	53                   	push   %ebx
+  8003a9:	56                   	push   %esi
+  8003aa:	e8 92 fe ff ff       	call   800241 <printfmt>
+  8003af:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003b2:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003b5:	e9 7a 02 00 00       	jmp    800634 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003ba:	50                   	push   %eax
+  8003bb:	68 ca 37 80 00       	push   $0x8037ca
+  8003c0:	53                   	push   %ebx
+  8003c1:	56                   	push   %esi
+  8003c2:	e8 7a fe ff ff       	call   800241 <printfmt>
+  8003c7:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003ca:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003cd:	e9 62 02 00 00       	jmp    800634 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d5:	83 c0 04             	add    $0x4,%eax
+  8003d8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003de:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003e0:	85 c9                	test   %ecx,%ecx
+  8003e2:	b8 c3 37 80 00       	mov    $0x8037c3,%eax
+  8003e7:	0f 45 c1             	cmovne %ecx,%eax
+  8003ea:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003ed:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003f1:	7e 06                	jle    8003f9 <vprintfmt+0x19b>
+  8003f3:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003f7:	75 0b                	jne    800404 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003f9:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003fc:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003ff:	89 75 08             	mov    %esi,0x8(%ebp)
+  800402:	eb 5c                	jmp    800460 <vprintfmt+0x202>
+  800404:	83 ec 08             	sub    $0x8,%esp
+  800407:	ff 75 d0             	push   -0x30(%ebp)
+  80040a:	ff 75 cc             	push   -0x34(%ebp)
+  80040d:	e8 20 03 00 00       	call   800732 <strnlen>
+  800412:	89 c2                	mov    %eax,%edx
+  800414:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800417:	29 d0                	sub    %edx,%eax
+  800419:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80041c:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800420:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800423:	89 75 08             	mov    %esi,0x8(%ebp)
+  800426:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800428:	eb 0e                	jmp    800438 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80042a:	83 ec 08             	sub    $0x8,%esp
+  80042d:	53                   	push   %ebx
+  80042e:	57                   	push   %edi
+  80042f:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800432:	83 ee 01             	sub    $0x1,%esi
+  800435:	83 c4 10             	add    $0x10,%esp
+  800438:	85 f6                	test   %esi,%esi
+  80043a:	7f ee                	jg     80042a <vprintfmt+0x1cc>
+  80043c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80043f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800442:	85 c0                	test   %eax,%eax
+  800444:	ba 00 00 00 00       	mov    $0x0,%edx
+  800449:	0f 49 d0             	cmovns %eax,%edx
+  80044c:	29 d0                	sub    %edx,%eax
+  80044e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800451:	eb a6                	jmp    8003f9 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800453:	83 ec 08             	sub    $0x8,%esp
+  800456:	53                   	push   %ebx
+  800457:	52                   	push   %edx
+  800458:	ff 55 08             	call   *0x8(%ebp)
+  80045b:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80045e:	89 f1                	mov    %esi,%ecx
+  800460:	8d 71 01             	lea    0x1(%ecx),%esi
+  800463:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800467:	0f be d0             	movsbl %al,%edx
+  80046a:	85 d2                	test   %edx,%edx
+  80046c:	74 28                	je     800496 <vprintfmt+0x238>
+  80046e:	85 ff                	test   %edi,%edi
+  800470:	78 05                	js     800477 <vprintfmt+0x219>
+  800472:	83 ef 01             	sub    $0x1,%edi
+  800475:	78 30                	js     8004a7 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800477:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80047b:	74 d6                	je     800453 <vprintfmt+0x1f5>
+  80047d:	0f be c0             	movsbl %al,%eax
+  800480:	83 e8 20             	sub    $0x20,%eax
+  800483:	83 f8 5e             	cmp    $0x5e,%eax
+  800486:	76 cb                	jbe    800453 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800488:	83 ec 08             	sub    $0x8,%esp
+  80048b:	53                   	push   %ebx
+  80048c:	6a 3f                	push   $0x3f
+  80048e:	ff 55 08             	call   *0x8(%ebp)
+  800491:	83 c4 10             	add    $0x10,%esp
+  800494:	eb c8                	jmp    80045e <vprintfmt+0x200>
+  800496:	8b 75 08             	mov    0x8(%ebp),%esi
+  800499:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80049c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80049f:	01 d0                	add    %edx,%eax
+  8004a1:	29 c8                	sub    %ecx,%eax
+  8004a3:	89 c7                	mov    %eax,%edi
+  8004a5:	eb 13                	jmp    8004ba <vprintfmt+0x25c>
+  8004a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004aa:	eb ed                	jmp    800499 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004ac:	83 ec 08             	sub    $0x8,%esp
+  8004af:	53                   	push   %ebx
+  8004b0:	6a 20                	push   $0x20
+  8004b2:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004b4:	83 ef 01             	sub    $0x1,%edi
+  8004b7:	83 c4 10             	add    $0x10,%esp
+  8004ba:	85 ff                	test   %edi,%edi
+  8004bc:	7f ee                	jg     8004ac <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004be:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004c1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004c4:	e9 6b 01 00 00       	jmp    800634 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004c9:	83 f9 01             	cmp    $0x1,%ecx
+  8004cc:	7f 1f                	jg     8004ed <vprintfmt+0x28f>
+	else if (lflag)
+  8004ce:	85 c9                	test   %ecx,%ecx
+  8004d0:	74 67                	je     800539 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d5:	8b 00                	mov    (%eax),%eax
+  8004d7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004da:	89 c1                	mov    %eax,%ecx
+  8004dc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004df:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8004e8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004eb:	eb 17                	jmp    800504 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f0:	8b 50 04             	mov    0x4(%eax),%edx
+  8004f3:	8b 00                	mov    (%eax),%eax
+  8004f5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004f8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fe:	8d 40 08             	lea    0x8(%eax),%eax
+  800501:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800504:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800507:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80050a:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80050f:	85 c9                	test   %ecx,%ecx
+  800511:	0f 89 03 01 00 00    	jns    80061a <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800517:	83 ec 08             	sub    $0x8,%esp
+  80051a:	53                   	push   %ebx
+  80051b:	6a 2d                	push   $0x2d
+  80051d:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80051f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800522:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800525:	f7 da                	neg    %edx
+  800527:	83 d1 00             	adc    $0x0,%ecx
+  80052a:	f7 d9                	neg    %ecx
+  80052c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80052f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800534:	e9 e1 00 00 00       	jmp    80061a <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800539:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053c:	8b 00                	mov    (%eax),%eax
+  80053e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800541:	89 c1                	mov    %eax,%ecx
+  800543:	c1 f9 1f             	sar    $0x1f,%ecx
+  800546:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800549:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054c:	8d 40 04             	lea    0x4(%eax),%eax
+  80054f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800552:	eb b0                	jmp    800504 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800554:	83 f9 01             	cmp    $0x1,%ecx
+  800557:	7f 1e                	jg     800577 <vprintfmt+0x319>
+	else if (lflag)
+  800559:	85 c9                	test   %ecx,%ecx
+  80055b:	74 32                	je     80058f <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80055d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800560:	8b 10                	mov    (%eax),%edx
+  800562:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800567:	8d 40 04             	lea    0x4(%eax),%eax
+  80056a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80056d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800572:	e9 a3 00 00 00       	jmp    80061a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800577:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057a:	8b 10                	mov    (%eax),%edx
+  80057c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80057f:	8d 40 08             	lea    0x8(%eax),%eax
+  800582:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800585:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80058a:	e9 8b 00 00 00       	jmp    80061a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8b 10                	mov    (%eax),%edx
+  800594:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800599:	8d 40 04             	lea    0x4(%eax),%eax
+  80059c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80059f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005a4:	eb 74                	jmp    80061a <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005a6:	83 f9 01             	cmp    $0x1,%ecx
+  8005a9:	7f 1b                	jg     8005c6 <vprintfmt+0x368>
+	else if (lflag)
+  8005ab:	85 c9                	test   %ecx,%ecx
+  8005ad:	74 2c                	je     8005db <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b2:	8b 10                	mov    (%eax),%edx
+  8005b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005bf:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005c4:	eb 54                	jmp    80061a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c9:	8b 10                	mov    (%eax),%edx
+  8005cb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005ce:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005d4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005d9:	eb 3f                	jmp    80061a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005de:	8b 10                	mov    (%eax),%edx
+  8005e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005eb:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8005f0:	eb 28                	jmp    80061a <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8005f2:	83 ec 08             	sub    $0x8,%esp
+  8005f5:	53                   	push   %ebx
+  8005f6:	6a 30                	push   $0x30
+  8005f8:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005fa:	83 c4 08             	add    $0x8,%esp
+  8005fd:	53                   	push   %ebx
+  8005fe:	6a 78                	push   $0x78
+  800600:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800602:	8b 45 14             	mov    0x14(%ebp),%eax
+  800605:	8b 10                	mov    (%eax),%edx
+  800607:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80060c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80060f:	8d 40 04             	lea    0x4(%eax),%eax
+  800612:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800615:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80061a:	83 ec 0c             	sub    $0xc,%esp
+  80061d:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800621:	50                   	push   %eax
+  800622:	ff 75 e0             	push   -0x20(%ebp)
+  800625:	57                   	push   %edi
+  800626:	51                   	push   %ecx
+  800627:	52                   	push   %edx
+  800628:	89 da                	mov    %ebx,%edx
+  80062a:	89 f0                	mov    %esi,%eax
+  80062c:	e8 4a fb ff ff       	call   80017b <printnum>
+			break;
+  800631:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800634:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800637:	e9 40 fc ff ff       	jmp    80027c <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80063c:	83 f9 01             	cmp    $0x1,%ecx
+  80063f:	7f 1b                	jg     80065c <vprintfmt+0x3fe>
+	else if (lflag)
+  800641:	85 c9                	test   %ecx,%ecx
+  800643:	74 2c                	je     800671 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800645:	8b 45 14             	mov    0x14(%ebp),%eax
+  800648:	8b 10                	mov    (%eax),%edx
+  80064a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064f:	8d 40 04             	lea    0x4(%eax),%eax
+  800652:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800655:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80065a:	eb be                	jmp    80061a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80065c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065f:	8b 10                	mov    (%eax),%edx
+  800661:	8b 48 04             	mov    0x4(%eax),%ecx
+  800664:	8d 40 08             	lea    0x8(%eax),%eax
+  800667:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80066a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80066f:	eb a9                	jmp    80061a <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800671:	8b 45 14             	mov    0x14(%ebp),%eax
+  800674:	8b 10                	mov    (%eax),%edx
+  800676:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067b:	8d 40 04             	lea    0x4(%eax),%eax
+  80067e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800681:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800686:	eb 92                	jmp    80061a <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800688:	83 ec 08             	sub    $0x8,%esp
+  80068b:	53                   	push   %ebx
+  80068c:	6a 25                	push   $0x25
+  80068e:	ff d6                	call   *%esi
+			break;
+  800690:	83 c4 10             	add    $0x10,%esp
+  800693:	eb 9f                	jmp    800634 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800695:	83 ec 08             	sub    $0x8,%esp
+  800698:	53                   	push   %ebx
+  800699:	6a 25                	push   $0x25
+  80069b:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80069d:	83 c4 10             	add    $0x10,%esp
+  8006a0:	89 f8                	mov    %edi,%eax
+  8006a2:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006a6:	74 05                	je     8006ad <vprintfmt+0x44f>
+  8006a8:	83 e8 01             	sub    $0x1,%eax
+  8006ab:	eb f5                	jmp    8006a2 <vprintfmt+0x444>
+  8006ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006b0:	eb 82                	jmp    800634 <vprintfmt+0x3d6>
+
+008006b2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006b2:	55                   	push   %ebp
+  8006b3:	89 e5                	mov    %esp,%ebp
+  8006b5:	83 ec 18             	sub    $0x18,%esp
+  8006b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006be:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006c1:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006c5:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006c8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006cf:	85 c0                	test   %eax,%eax
+  8006d1:	74 26                	je     8006f9 <vsnprintf+0x47>
+  8006d3:	85 d2                	test   %edx,%edx
+  8006d5:	7e 22                	jle    8006f9 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006d7:	ff 75 14             	push   0x14(%ebp)
+  8006da:	ff 75 10             	push   0x10(%ebp)
+  8006dd:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006e0:	50                   	push   %eax
+  8006e1:	68 24 02 80 00       	push   $0x800224
+  8006e6:	e8 73 fb ff ff       	call   80025e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006eb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006ee:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006f4:	83 c4 10             	add    $0x10,%esp
+}
+  8006f7:	c9                   	leave
+  8006f8:	c3                   	ret
+		return -E_INVAL;
+  8006f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006fe:	eb f7                	jmp    8006f7 <vsnprintf+0x45>
+
+00800700 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800700:	55                   	push   %ebp
+  800701:	89 e5                	mov    %esp,%ebp
+  800703:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800706:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800709:	50                   	push   %eax
+  80070a:	ff 75 10             	push   0x10(%ebp)
+  80070d:	ff 75 0c             	push   0xc(%ebp)
+  800710:	ff 75 08             	push   0x8(%ebp)
+  800713:	e8 9a ff ff ff       	call   8006b2 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800718:	c9                   	leave
+  800719:	c3                   	ret
+
+0080071a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80071a:	55                   	push   %ebp
+  80071b:	89 e5                	mov    %esp,%ebp
+  80071d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800720:	b8 00 00 00 00       	mov    $0x0,%eax
+  800725:	eb 03                	jmp    80072a <strlen+0x10>
+		n++;
+  800727:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80072a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80072e:	75 f7                	jne    800727 <strlen+0xd>
+	return n;
+}
+  800730:	5d                   	pop    %ebp
+  800731:	c3                   	ret
+
+00800732 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800732:	55                   	push   %ebp
+  800733:	89 e5                	mov    %esp,%ebp
+  800735:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800738:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80073b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800740:	eb 03                	jmp    800745 <strnlen+0x13>
+		n++;
+  800742:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800745:	39 d0                	cmp    %edx,%eax
+  800747:	74 08                	je     800751 <strnlen+0x1f>
+  800749:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80074d:	75 f3                	jne    800742 <strnlen+0x10>
+  80074f:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800751:	89 d0                	mov    %edx,%eax
+  800753:	5d                   	pop    %ebp
+  800754:	c3                   	ret
+
+00800755 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800755:	55                   	push   %ebp
+  800756:	89 e5                	mov    %esp,%ebp
+  800758:	53                   	push   %ebx
+  800759:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80075c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80075f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800764:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800768:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80076b:	83 c0 01             	add    $0x1,%eax
+  80076e:	84 d2                	test   %dl,%dl
+  800770:	75 f2                	jne    800764 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800772:	89 c8                	mov    %ecx,%eax
+  800774:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800777:	c9                   	leave
+  800778:	c3                   	ret
+
+00800779 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800779:	55                   	push   %ebp
+  80077a:	89 e5                	mov    %esp,%ebp
+  80077c:	53                   	push   %ebx
+  80077d:	83 ec 10             	sub    $0x10,%esp
+  800780:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800783:	53                   	push   %ebx
+  800784:	e8 91 ff ff ff       	call   80071a <strlen>
+  800789:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80078c:	ff 75 0c             	push   0xc(%ebp)
+  80078f:	01 d8                	add    %ebx,%eax
+  800791:	50                   	push   %eax
+  800792:	e8 be ff ff ff       	call   800755 <strcpy>
+	return dst;
+}
+  800797:	89 d8                	mov    %ebx,%eax
+  800799:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80079c:	c9                   	leave
+  80079d:	c3                   	ret
+
+0080079e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80079e:	55                   	push   %ebp
+  80079f:	89 e5                	mov    %esp,%ebp
+  8007a1:	56                   	push   %esi
+  8007a2:	53                   	push   %ebx
+  8007a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007a9:	89 f3                	mov    %esi,%ebx
+  8007ab:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007ae:	89 f0                	mov    %esi,%eax
+  8007b0:	eb 0f                	jmp    8007c1 <strncpy+0x23>
+		*dst++ = *src;
+  8007b2:	83 c0 01             	add    $0x1,%eax
+  8007b5:	0f b6 0a             	movzbl (%edx),%ecx
+  8007b8:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007bb:	80 f9 01             	cmp    $0x1,%cl
+  8007be:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007c1:	39 d8                	cmp    %ebx,%eax
+  8007c3:	75 ed                	jne    8007b2 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007c5:	89 f0                	mov    %esi,%eax
+  8007c7:	5b                   	pop    %ebx
+  8007c8:	5e                   	pop    %esi
+  8007c9:	5d                   	pop    %ebp
+  8007ca:	c3                   	ret
+
+008007cb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007cb:	55                   	push   %ebp
+  8007cc:	89 e5                	mov    %esp,%ebp
+  8007ce:	56                   	push   %esi
+  8007cf:	53                   	push   %ebx
+  8007d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007d6:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007d9:	89 f0                	mov    %esi,%eax
+  8007db:	85 d2                	test   %edx,%edx
+  8007dd:	74 21                	je     800800 <strlcpy+0x35>
+  8007df:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007e3:	89 f2                	mov    %esi,%edx
+  8007e5:	eb 09                	jmp    8007f0 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007e7:	83 c1 01             	add    $0x1,%ecx
+  8007ea:	83 c2 01             	add    $0x1,%edx
+  8007ed:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007f0:	39 c2                	cmp    %eax,%edx
+  8007f2:	74 09                	je     8007fd <strlcpy+0x32>
+  8007f4:	0f b6 19             	movzbl (%ecx),%ebx
+  8007f7:	84 db                	test   %bl,%bl
+  8007f9:	75 ec                	jne    8007e7 <strlcpy+0x1c>
+  8007fb:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007fd:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800800:	29 f0                	sub    %esi,%eax
+}
+  800802:	5b                   	pop    %ebx
+  800803:	5e                   	pop    %esi
+  800804:	5d                   	pop    %ebp
+  800805:	c3                   	ret
+
+00800806 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800806:	55                   	push   %ebp
+  800807:	89 e5                	mov    %esp,%ebp
+  800809:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80080c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80080f:	eb 06                	jmp    800817 <strcmp+0x11>
+		p++, q++;
+  800811:	83 c1 01             	add    $0x1,%ecx
+  800814:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800817:	0f b6 01             	movzbl (%ecx),%eax
+  80081a:	84 c0                	test   %al,%al
+  80081c:	74 04                	je     800822 <strcmp+0x1c>
+  80081e:	3a 02                	cmp    (%edx),%al
+  800820:	74 ef                	je     800811 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800822:	0f b6 c0             	movzbl %al,%eax
+  800825:	0f b6 12             	movzbl (%edx),%edx
+  800828:	29 d0                	sub    %edx,%eax
+}
+  80082a:	5d                   	pop    %ebp
+  80082b:	c3                   	ret
+
+0080082c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80082c:	55                   	push   %ebp
+  80082d:	89 e5                	mov    %esp,%ebp
+  80082f:	53                   	push   %ebx
+  800830:	8b 45 08             	mov    0x8(%ebp),%eax
+  800833:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800836:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800839:	eb 09                	jmp    800844 <strncmp+0x18>
+		n--, p++, q++;
+  80083b:	83 ea 01             	sub    $0x1,%edx
+  80083e:	83 c0 01             	add    $0x1,%eax
+  800841:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800844:	85 d2                	test   %edx,%edx
+  800846:	74 18                	je     800860 <strncmp+0x34>
+  800848:	0f b6 18             	movzbl (%eax),%ebx
+  80084b:	84 db                	test   %bl,%bl
+  80084d:	74 04                	je     800853 <strncmp+0x27>
+  80084f:	3a 19                	cmp    (%ecx),%bl
+  800851:	74 e8                	je     80083b <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800853:	0f b6 00             	movzbl (%eax),%eax
+  800856:	0f b6 11             	movzbl (%ecx),%edx
+  800859:	29 d0                	sub    %edx,%eax
+}
+  80085b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80085e:	c9                   	leave
+  80085f:	c3                   	ret
+		return 0;
+  800860:	b8 00 00 00 00       	mov    $0x0,%eax
+  800865:	eb f4                	jmp    80085b <strncmp+0x2f>
+
+00800867 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800867:	55                   	push   %ebp
+  800868:	89 e5                	mov    %esp,%ebp
+  80086a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80086d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800871:	eb 03                	jmp    800876 <strchr+0xf>
+  800873:	83 c0 01             	add    $0x1,%eax
+  800876:	0f b6 10             	movzbl (%eax),%edx
+  800879:	84 d2                	test   %dl,%dl
+  80087b:	74 06                	je     800883 <strchr+0x1c>
+		if (*s == c)
+  80087d:	38 ca                	cmp    %cl,%dl
+  80087f:	75 f2                	jne    800873 <strchr+0xc>
+  800881:	eb 05                	jmp    800888 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800883:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800888:	5d                   	pop    %ebp
+  800889:	c3                   	ret
+
+0080088a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80088a:	55                   	push   %ebp
+  80088b:	89 e5                	mov    %esp,%ebp
+  80088d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800890:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800894:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800897:	38 ca                	cmp    %cl,%dl
+  800899:	74 09                	je     8008a4 <strfind+0x1a>
+  80089b:	84 d2                	test   %dl,%dl
+  80089d:	74 05                	je     8008a4 <strfind+0x1a>
+	for (; *s; s++)
+  80089f:	83 c0 01             	add    $0x1,%eax
+  8008a2:	eb f0                	jmp    800894 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008a4:	5d                   	pop    %ebp
+  8008a5:	c3                   	ret
+
+008008a6 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008a6:	55                   	push   %ebp
+  8008a7:	89 e5                	mov    %esp,%ebp
+  8008a9:	57                   	push   %edi
+  8008aa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008ad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008b0:	85 c9                	test   %ecx,%ecx
+  8008b2:	74 20                	je     8008d4 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008b4:	89 f8                	mov    %edi,%eax
+  8008b6:	09 c8                	or     %ecx,%eax
+  8008b8:	a8 03                	test   $0x3,%al
+  8008ba:	75 12                	jne    8008ce <memset+0x28>
+		c &= 0xFF;
+  8008bc:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008c0:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008c6:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008c9:	fc                   	cld
+  8008ca:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008cc:	eb 06                	jmp    8008d4 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008d1:	fc                   	cld
+  8008d2:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008d4:	89 f8                	mov    %edi,%eax
+  8008d6:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008d9:	c9                   	leave
+  8008da:	c3                   	ret
+
+008008db <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008db:	55                   	push   %ebp
+  8008dc:	89 e5                	mov    %esp,%ebp
+  8008de:	57                   	push   %edi
+  8008df:	56                   	push   %esi
+  8008e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008e6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008e9:	39 c6                	cmp    %eax,%esi
+  8008eb:	73 32                	jae    80091f <memmove+0x44>
+  8008ed:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008f0:	39 d0                	cmp    %edx,%eax
+  8008f2:	73 2b                	jae    80091f <memmove+0x44>
+		s += n;
+		d += n;
+  8008f4:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008f7:	89 d6                	mov    %edx,%esi
+  8008f9:	09 fe                	or     %edi,%esi
+  8008fb:	09 ce                	or     %ecx,%esi
+  8008fd:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800903:	75 0e                	jne    800913 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800905:	83 ef 04             	sub    $0x4,%edi
+  800908:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80090b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80090e:	fd                   	std
+  80090f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800911:	eb 09                	jmp    80091c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800913:	83 ef 01             	sub    $0x1,%edi
+  800916:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800919:	fd                   	std
+  80091a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80091c:	fc                   	cld
+  80091d:	eb 1a                	jmp    800939 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80091f:	89 f2                	mov    %esi,%edx
+  800921:	09 c2                	or     %eax,%edx
+  800923:	09 ca                	or     %ecx,%edx
+  800925:	f6 c2 03             	test   $0x3,%dl
+  800928:	75 0a                	jne    800934 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80092a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80092d:	89 c7                	mov    %eax,%edi
+  80092f:	fc                   	cld
+  800930:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800932:	eb 05                	jmp    800939 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800934:	89 c7                	mov    %eax,%edi
+  800936:	fc                   	cld
+  800937:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800939:	5e                   	pop    %esi
+  80093a:	5f                   	pop    %edi
+  80093b:	5d                   	pop    %ebp
+  80093c:	c3                   	ret
+
+0080093d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80093d:	55                   	push   %ebp
+  80093e:	89 e5                	mov    %esp,%ebp
+  800940:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800943:	ff 75 10             	push   0x10(%ebp)
+  800946:	ff 75 0c             	push   0xc(%ebp)
+  800949:	ff 75 08             	push   0x8(%ebp)
+  80094c:	e8 8a ff ff ff       	call   8008db <memmove>
+}
+  800951:	c9                   	leave
+  800952:	c3                   	ret
+
+00800953 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800953:	55                   	push   %ebp
+  800954:	89 e5                	mov    %esp,%ebp
+  800956:	56                   	push   %esi
+  800957:	53                   	push   %ebx
+  800958:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80095e:	89 c6                	mov    %eax,%esi
+  800960:	03 75 10             	add    0x10(%ebp),%esi
+  800963:	eb 06                	jmp    80096b <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800965:	83 c0 01             	add    $0x1,%eax
+  800968:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80096b:	39 f0                	cmp    %esi,%eax
+  80096d:	74 14                	je     800983 <memcmp+0x30>
+		if (*s1 != *s2)
+  80096f:	0f b6 08             	movzbl (%eax),%ecx
+  800972:	0f b6 1a             	movzbl (%edx),%ebx
+  800975:	38 d9                	cmp    %bl,%cl
+  800977:	74 ec                	je     800965 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800979:	0f b6 c1             	movzbl %cl,%eax
+  80097c:	0f b6 db             	movzbl %bl,%ebx
+  80097f:	29 d8                	sub    %ebx,%eax
+  800981:	eb 05                	jmp    800988 <memcmp+0x35>
+	}
+
+	return 0;
+  800983:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800988:	5b                   	pop    %ebx
+  800989:	5e                   	pop    %esi
+  80098a:	5d                   	pop    %ebp
+  80098b:	c3                   	ret
+
+0080098c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80098c:	55                   	push   %ebp
+  80098d:	89 e5                	mov    %esp,%ebp
+  80098f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800992:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800995:	89 c2                	mov    %eax,%edx
+  800997:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80099a:	eb 03                	jmp    80099f <memfind+0x13>
+  80099c:	83 c0 01             	add    $0x1,%eax
+  80099f:	39 d0                	cmp    %edx,%eax
+  8009a1:	73 04                	jae    8009a7 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009a3:	38 08                	cmp    %cl,(%eax)
+  8009a5:	75 f5                	jne    80099c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009a7:	5d                   	pop    %ebp
+  8009a8:	c3                   	ret
+
+008009a9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	57                   	push   %edi
+  8009ad:	56                   	push   %esi
+  8009ae:	53                   	push   %ebx
+  8009af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009b5:	eb 03                	jmp    8009ba <strtol+0x11>
+		s++;
+  8009b7:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009ba:	0f b6 02             	movzbl (%edx),%eax
+  8009bd:	3c 20                	cmp    $0x20,%al
+  8009bf:	74 f6                	je     8009b7 <strtol+0xe>
+  8009c1:	3c 09                	cmp    $0x9,%al
+  8009c3:	74 f2                	je     8009b7 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009c5:	3c 2b                	cmp    $0x2b,%al
+  8009c7:	74 2a                	je     8009f3 <strtol+0x4a>
+	int neg = 0;
+  8009c9:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009ce:	3c 2d                	cmp    $0x2d,%al
+  8009d0:	74 2b                	je     8009fd <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009d2:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009d8:	75 0f                	jne    8009e9 <strtol+0x40>
+  8009da:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009dd:	74 28                	je     800a07 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009df:	85 db                	test   %ebx,%ebx
+  8009e1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009e6:	0f 44 d8             	cmove  %eax,%ebx
+  8009e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ee:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009f1:	eb 46                	jmp    800a39 <strtol+0x90>
+		s++;
+  8009f3:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009fb:	eb d5                	jmp    8009d2 <strtol+0x29>
+		s++, neg = 1;
+  8009fd:	83 c2 01             	add    $0x1,%edx
+  800a00:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a05:	eb cb                	jmp    8009d2 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a07:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a0b:	74 0e                	je     800a1b <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a0d:	85 db                	test   %ebx,%ebx
+  800a0f:	75 d8                	jne    8009e9 <strtol+0x40>
+		s++, base = 8;
+  800a11:	83 c2 01             	add    $0x1,%edx
+  800a14:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a19:	eb ce                	jmp    8009e9 <strtol+0x40>
+		s += 2, base = 16;
+  800a1b:	83 c2 02             	add    $0x2,%edx
+  800a1e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a23:	eb c4                	jmp    8009e9 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a25:	0f be c0             	movsbl %al,%eax
+  800a28:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a2b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a2e:	7d 3a                	jge    800a6a <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a30:	83 c2 01             	add    $0x1,%edx
+  800a33:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a37:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a39:	0f b6 02             	movzbl (%edx),%eax
+  800a3c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a3f:	89 f3                	mov    %esi,%ebx
+  800a41:	80 fb 09             	cmp    $0x9,%bl
+  800a44:	76 df                	jbe    800a25 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a46:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a49:	89 f3                	mov    %esi,%ebx
+  800a4b:	80 fb 19             	cmp    $0x19,%bl
+  800a4e:	77 08                	ja     800a58 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a50:	0f be c0             	movsbl %al,%eax
+  800a53:	83 e8 57             	sub    $0x57,%eax
+  800a56:	eb d3                	jmp    800a2b <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a58:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a5b:	89 f3                	mov    %esi,%ebx
+  800a5d:	80 fb 19             	cmp    $0x19,%bl
+  800a60:	77 08                	ja     800a6a <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a62:	0f be c0             	movsbl %al,%eax
+  800a65:	83 e8 37             	sub    $0x37,%eax
+  800a68:	eb c1                	jmp    800a2b <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a6a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a6e:	74 05                	je     800a75 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a73:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a75:	89 c8                	mov    %ecx,%eax
+  800a77:	f7 d8                	neg    %eax
+  800a79:	85 ff                	test   %edi,%edi
+  800a7b:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a7e:	89 c8                	mov    %ecx,%eax
+  800a80:	5b                   	pop    %ebx
+  800a81:	5e                   	pop    %esi
+  800a82:	5f                   	pop    %edi
+  800a83:	5d                   	pop    %ebp
+  800a84:	c3                   	ret
+
+00800a85 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800a85:	55                   	push   %ebp
+  800a86:	89 e5                	mov    %esp,%ebp
+  800a88:	57                   	push   %edi
+  800a89:	56                   	push   %esi
+  800a8a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800a8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a96:	89 c3                	mov    %eax,%ebx
+  800a98:	89 c7                	mov    %eax,%edi
+  800a9a:	55                   	push   %ebp
+  800a9b:	89 e5                	mov    %esp,%ebp
+  800a9d:	8d 35 a5 0a 80 00    	lea    0x800aa5,%esi
+  800aa3:	0f 34                	sysenter
+  800aa5:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800aa6:	5b                   	pop    %ebx
+  800aa7:	5e                   	pop    %esi
+  800aa8:	5f                   	pop    %edi
+  800aa9:	5d                   	pop    %ebp
+  800aaa:	c3                   	ret
+
+00800aab <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800aab:	55                   	push   %ebp
+  800aac:	89 e5                	mov    %esp,%ebp
+  800aae:	57                   	push   %edi
+  800aaf:	56                   	push   %esi
+  800ab0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ab1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ab6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800abb:	89 d1                	mov    %edx,%ecx
+  800abd:	89 d3                	mov    %edx,%ebx
+  800abf:	89 d7                	mov    %edx,%edi
+  800ac1:	55                   	push   %ebp
+  800ac2:	89 e5                	mov    %esp,%ebp
+  800ac4:	8d 35 cc 0a 80 00    	lea    0x800acc,%esi
+  800aca:	0f 34                	sysenter
+  800acc:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800acd:	5b                   	pop    %ebx
+  800ace:	5e                   	pop    %esi
+  800acf:	5f                   	pop    %edi
+  800ad0:	5d                   	pop    %ebp
+  800ad1:	c3                   	ret
+
+00800ad2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ad2:	55                   	push   %ebp
+  800ad3:	89 e5                	mov    %esp,%ebp
+  800ad5:	57                   	push   %edi
+  800ad6:	56                   	push   %esi
+  800ad7:	53                   	push   %ebx
+  800ad8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800adb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ae0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae3:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ae8:	89 cb                	mov    %ecx,%ebx
+  800aea:	89 cf                	mov    %ecx,%edi
+  800aec:	55                   	push   %ebp
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	8d 35 f7 0a 80 00    	lea    0x800af7,%esi
+  800af5:	0f 34                	sysenter
+  800af7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800af8:	85 c0                	test   %eax,%eax
+  800afa:	7f 08                	jg     800b04 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800afc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aff:	5b                   	pop    %ebx
+  800b00:	5e                   	pop    %esi
+  800b01:	5f                   	pop    %edi
+  800b02:	5d                   	pop    %ebp
+  800b03:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b04:	83 ec 0c             	sub    $0xc,%esp
+  800b07:	50                   	push   %eax
+  800b08:	6a 03                	push   $0x3
+  800b0a:	68 e7 3a 80 00       	push   $0x803ae7
+  800b0f:	6a 3d                	push   $0x3d
+  800b11:	68 04 3b 80 00       	push   $0x803b04
+  800b16:	e8 02 24 00 00       	call   802f1d <_panic>
+
+00800b1b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b1b:	55                   	push   %ebp
+  800b1c:	89 e5                	mov    %esp,%ebp
+  800b1e:	57                   	push   %edi
+  800b1f:	56                   	push   %esi
+  800b20:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b26:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b2b:	89 d1                	mov    %edx,%ecx
+  800b2d:	89 d3                	mov    %edx,%ebx
+  800b2f:	89 d7                	mov    %edx,%edi
+  800b31:	55                   	push   %ebp
+  800b32:	89 e5                	mov    %esp,%ebp
+  800b34:	8d 35 3c 0b 80 00    	lea    0x800b3c,%esi
+  800b3a:	0f 34                	sysenter
+  800b3c:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800b3d:	5b                   	pop    %ebx
+  800b3e:	5e                   	pop    %esi
+  800b3f:	5f                   	pop    %edi
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+
+00800b42 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	57                   	push   %edi
+  800b46:	56                   	push   %esi
+  800b47:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b48:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b52:	89 d1                	mov    %edx,%ecx
+  800b54:	89 d3                	mov    %edx,%ebx
+  800b56:	89 d7                	mov    %edx,%edi
+  800b58:	89 d6                	mov    %edx,%esi
+  800b5a:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b5c:	5b                   	pop    %ebx
+  800b5d:	5e                   	pop    %esi
+  800b5e:	5f                   	pop    %edi
+  800b5f:	5d                   	pop    %ebp
+  800b60:	c3                   	ret
+
+00800b61 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800b61:	55                   	push   %ebp
+  800b62:	89 e5                	mov    %esp,%ebp
+  800b64:	57                   	push   %edi
+  800b65:	56                   	push   %esi
+  800b66:	53                   	push   %ebx
+  800b67:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b70:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b75:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b7d:	55                   	push   %ebp
+  800b7e:	89 e5                	mov    %esp,%ebp
+  800b80:	8d 35 88 0b 80 00    	lea    0x800b88,%esi
+  800b86:	0f 34                	sysenter
+  800b88:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b89:	85 c0                	test   %eax,%eax
+  800b8b:	7f 08                	jg     800b95 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800b8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b90:	5b                   	pop    %ebx
+  800b91:	5e                   	pop    %esi
+  800b92:	5f                   	pop    %edi
+  800b93:	5d                   	pop    %ebp
+  800b94:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b95:	83 ec 0c             	sub    $0xc,%esp
+  800b98:	50                   	push   %eax
+  800b99:	6a 04                	push   $0x4
+  800b9b:	68 e7 3a 80 00       	push   $0x803ae7
+  800ba0:	6a 3d                	push   $0x3d
+  800ba2:	68 04 3b 80 00       	push   $0x803b04
+  800ba7:	e8 71 23 00 00       	call   802f1d <_panic>
+
+00800bac <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800bac:	55                   	push   %ebp
+  800bad:	89 e5                	mov    %esp,%ebp
+  800baf:	57                   	push   %edi
+  800bb0:	56                   	push   %esi
+  800bb1:	53                   	push   %ebx
+  800bb2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bbb:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bc0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bc3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bc6:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bc9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bcb:	85 c0                	test   %eax,%eax
+  800bcd:	7f 08                	jg     800bd7 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800bcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd2:	5b                   	pop    %ebx
+  800bd3:	5e                   	pop    %esi
+  800bd4:	5f                   	pop    %edi
+  800bd5:	5d                   	pop    %ebp
+  800bd6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bd7:	83 ec 0c             	sub    $0xc,%esp
+  800bda:	50                   	push   %eax
+  800bdb:	6a 05                	push   $0x5
+  800bdd:	68 e7 3a 80 00       	push   $0x803ae7
+  800be2:	6a 23                	push   $0x23
+  800be4:	68 04 3b 80 00       	push   $0x803b04
+  800be9:	e8 2f 23 00 00       	call   802f1d <_panic>
+
+00800bee <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800bee:	55                   	push   %ebp
+  800bef:	89 e5                	mov    %esp,%ebp
+  800bf1:	57                   	push   %edi
+  800bf2:	56                   	push   %esi
+  800bf3:	53                   	push   %ebx
+  800bf4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800bf7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c02:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c07:	89 df                	mov    %ebx,%edi
+  800c09:	55                   	push   %ebp
+  800c0a:	89 e5                	mov    %esp,%ebp
+  800c0c:	8d 35 14 0c 80 00    	lea    0x800c14,%esi
+  800c12:	0f 34                	sysenter
+  800c14:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c15:	85 c0                	test   %eax,%eax
+  800c17:	7f 08                	jg     800c21 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800c19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c1c:	5b                   	pop    %ebx
+  800c1d:	5e                   	pop    %esi
+  800c1e:	5f                   	pop    %edi
+  800c1f:	5d                   	pop    %ebp
+  800c20:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c21:	83 ec 0c             	sub    $0xc,%esp
+  800c24:	50                   	push   %eax
+  800c25:	6a 06                	push   $0x6
+  800c27:	68 e7 3a 80 00       	push   $0x803ae7
+  800c2c:	6a 3d                	push   $0x3d
+  800c2e:	68 04 3b 80 00       	push   $0x803b04
+  800c33:	e8 e5 22 00 00       	call   802f1d <_panic>
+
+00800c38 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800c38:	55                   	push   %ebp
+  800c39:	89 e5                	mov    %esp,%ebp
+  800c3b:	57                   	push   %edi
+  800c3c:	56                   	push   %esi
+  800c3d:	53                   	push   %ebx
+  800c3e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c4c:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c51:	89 df                	mov    %ebx,%edi
+  800c53:	55                   	push   %ebp
+  800c54:	89 e5                	mov    %esp,%ebp
+  800c56:	8d 35 5e 0c 80 00    	lea    0x800c5e,%esi
+  800c5c:	0f 34                	sysenter
+  800c5e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c5f:	85 c0                	test   %eax,%eax
+  800c61:	7f 08                	jg     800c6b <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800c63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c66:	5b                   	pop    %ebx
+  800c67:	5e                   	pop    %esi
+  800c68:	5f                   	pop    %edi
+  800c69:	5d                   	pop    %ebp
+  800c6a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c6b:	83 ec 0c             	sub    $0xc,%esp
+  800c6e:	50                   	push   %eax
+  800c6f:	6a 08                	push   $0x8
+  800c71:	68 e7 3a 80 00       	push   $0x803ae7
+  800c76:	6a 3d                	push   $0x3d
+  800c78:	68 04 3b 80 00       	push   $0x803b04
+  800c7d:	e8 9b 22 00 00       	call   802f1d <_panic>
+
+00800c82 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800c82:	55                   	push   %ebp
+  800c83:	89 e5                	mov    %esp,%ebp
+  800c85:	57                   	push   %edi
+  800c86:	56                   	push   %esi
+  800c87:	53                   	push   %ebx
+  800c88:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c96:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c9b:	89 df                	mov    %ebx,%edi
+  800c9d:	55                   	push   %ebp
+  800c9e:	89 e5                	mov    %esp,%ebp
+  800ca0:	8d 35 a8 0c 80 00    	lea    0x800ca8,%esi
+  800ca6:	0f 34                	sysenter
+  800ca8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ca9:	85 c0                	test   %eax,%eax
+  800cab:	7f 08                	jg     800cb5 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800cad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb0:	5b                   	pop    %ebx
+  800cb1:	5e                   	pop    %esi
+  800cb2:	5f                   	pop    %edi
+  800cb3:	5d                   	pop    %ebp
+  800cb4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb5:	83 ec 0c             	sub    $0xc,%esp
+  800cb8:	50                   	push   %eax
+  800cb9:	6a 09                	push   $0x9
+  800cbb:	68 e7 3a 80 00       	push   $0x803ae7
+  800cc0:	6a 3d                	push   $0x3d
+  800cc2:	68 04 3b 80 00       	push   $0x803b04
+  800cc7:	e8 51 22 00 00       	call   802f1d <_panic>
+
+00800ccc <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ccc:	55                   	push   %ebp
+  800ccd:	89 e5                	mov    %esp,%ebp
+  800ccf:	57                   	push   %edi
+  800cd0:	56                   	push   %esi
+  800cd1:	53                   	push   %ebx
+  800cd2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ce5:	89 df                	mov    %ebx,%edi
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	8d 35 f2 0c 80 00    	lea    0x800cf2,%esi
+  800cf0:	0f 34                	sysenter
+  800cf2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cf3:	85 c0                	test   %eax,%eax
+  800cf5:	7f 08                	jg     800cff <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800cf7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfa:	5b                   	pop    %ebx
+  800cfb:	5e                   	pop    %esi
+  800cfc:	5f                   	pop    %edi
+  800cfd:	5d                   	pop    %ebp
+  800cfe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cff:	83 ec 0c             	sub    $0xc,%esp
+  800d02:	50                   	push   %eax
+  800d03:	6a 0a                	push   $0xa
+  800d05:	68 e7 3a 80 00       	push   $0x803ae7
+  800d0a:	6a 3d                	push   $0x3d
+  800d0c:	68 04 3b 80 00       	push   $0x803b04
+  800d11:	e8 07 22 00 00       	call   802f1d <_panic>
+
+00800d16 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800d16:	55                   	push   %ebp
+  800d17:	89 e5                	mov    %esp,%ebp
+  800d19:	57                   	push   %edi
+  800d1a:	56                   	push   %esi
+  800d1b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d22:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d2a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	8d 35 38 0d 80 00    	lea    0x800d38,%esi
+  800d36:	0f 34                	sysenter
+  800d38:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800d39:	5b                   	pop    %ebx
+  800d3a:	5e                   	pop    %esi
+  800d3b:	5f                   	pop    %edi
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	c3                   	ret
+
+00800d3e <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	57                   	push   %edi
+  800d42:	56                   	push   %esi
+  800d43:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4a:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d52:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d55:	55                   	push   %ebp
+  800d56:	89 e5                	mov    %esp,%ebp
+  800d58:	8d 35 60 0d 80 00    	lea    0x800d60,%esi
+  800d5e:	0f 34                	sysenter
+  800d60:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800d61:	5b                   	pop    %ebx
+  800d62:	5e                   	pop    %esi
+  800d63:	5f                   	pop    %edi
+  800d64:	5d                   	pop    %ebp
+  800d65:	c3                   	ret
+
+00800d66 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800d66:	55                   	push   %ebp
+  800d67:	89 e5                	mov    %esp,%ebp
+  800d69:	57                   	push   %edi
+  800d6a:	56                   	push   %esi
+  800d6b:	53                   	push   %ebx
+  800d6c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d6f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d82:	89 f7                	mov    %esi,%edi
+  800d84:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d86:	85 c0                	test   %eax,%eax
+  800d88:	7f 08                	jg     800d92 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800d8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8d:	5b                   	pop    %ebx
+  800d8e:	5e                   	pop    %esi
+  800d8f:	5f                   	pop    %edi
+  800d90:	5d                   	pop    %ebp
+  800d91:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d92:	83 ec 0c             	sub    $0xc,%esp
+  800d95:	50                   	push   %eax
+  800d96:	6a 0d                	push   $0xd
+  800d98:	68 e7 3a 80 00       	push   $0x803ae7
+  800d9d:	6a 23                	push   $0x23
+  800d9f:	68 04 3b 80 00       	push   $0x803b04
+  800da4:	e8 74 21 00 00       	call   802f1d <_panic>
+
+00800da9 <sys_ipc_recv>:
+{
+  800da9:	55                   	push   %ebp
+  800daa:	89 e5                	mov    %esp,%ebp
+  800dac:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800daf:	6a 00                	push   $0x0
+  800db1:	6a 01                	push   $0x1
+  800db3:	ff 75 08             	push   0x8(%ebp)
+  800db6:	e8 ab ff ff ff       	call   800d66 <sys_ipc_recvv>
+}
+  800dbb:	c9                   	leave
+  800dbc:	c3                   	ret
+
+00800dbd <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800dbd:	55                   	push   %ebp
+  800dbe:	89 e5                	mov    %esp,%ebp
+  800dc0:	57                   	push   %edi
+  800dc1:	56                   	push   %esi
+  800dc2:	53                   	push   %ebx
+  800dc3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dcb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800dd6:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800dd9:	89 de                	mov    %ebx,%esi
+  800ddb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ddd:	85 c0                	test   %eax,%eax
+  800ddf:	7f 08                	jg     800de9 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800de1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de4:	5b                   	pop    %ebx
+  800de5:	5e                   	pop    %esi
+  800de6:	5f                   	pop    %edi
+  800de7:	5d                   	pop    %ebp
+  800de8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de9:	83 ec 0c             	sub    $0xc,%esp
+  800dec:	50                   	push   %eax
+  800ded:	6a 0d                	push   $0xd
+  800def:	68 e7 3a 80 00       	push   $0x803ae7
+  800df4:	6a 23                	push   $0x23
+  800df6:	68 04 3b 80 00       	push   $0x803b04
+  800dfb:	e8 1d 21 00 00       	call   802f1d <_panic>
+
+00800e00 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e00:	55                   	push   %ebp
+  800e01:	89 e5                	mov    %esp,%ebp
+  800e03:	57                   	push   %edi
+  800e04:	56                   	push   %esi
+  800e05:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e0b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e10:	89 d1                	mov    %edx,%ecx
+  800e12:	89 d3                	mov    %edx,%ebx
+  800e14:	89 d7                	mov    %edx,%edi
+  800e16:	55                   	push   %ebp
+  800e17:	89 e5                	mov    %esp,%ebp
+  800e19:	8d 35 21 0e 80 00    	lea    0x800e21,%esi
+  800e1f:	0f 34                	sysenter
+  800e21:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800e22:	5b                   	pop    %ebx
+  800e23:	5e                   	pop    %esi
+  800e24:	5f                   	pop    %edi
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+
+00800e27 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	56                   	push   %esi
+  800e2c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e38:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e3d:	89 df                	mov    %ebx,%edi
+  800e3f:	55                   	push   %ebp
+  800e40:	89 e5                	mov    %esp,%ebp
+  800e42:	8d 35 4a 0e 80 00    	lea    0x800e4a,%esi
+  800e48:	0f 34                	sysenter
+  800e4a:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800e4b:	5b                   	pop    %ebx
+  800e4c:	5e                   	pop    %esi
+  800e4d:	5f                   	pop    %edi
+  800e4e:	5d                   	pop    %ebp
+  800e4f:	c3                   	ret
+
+00800e50 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800e50:	55                   	push   %ebp
+  800e51:	89 e5                	mov    %esp,%ebp
+  800e53:	57                   	push   %edi
+  800e54:	56                   	push   %esi
+  800e55:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e63:	89 cb                	mov    %ecx,%ebx
+  800e65:	89 cf                	mov    %ecx,%edi
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	8d 35 72 0e 80 00    	lea    0x800e72,%esi
+  800e70:	0f 34                	sysenter
+  800e72:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800e73:	5b                   	pop    %ebx
+  800e74:	5e                   	pop    %esi
+  800e75:	5f                   	pop    %edi
+  800e76:	5d                   	pop    %ebp
+  800e77:	c3                   	ret
+
+00800e78 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800e78:	55                   	push   %ebp
+  800e79:	89 e5                	mov    %esp,%ebp
+  800e7b:	57                   	push   %edi
+  800e7c:	56                   	push   %esi
+  800e7d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e89:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e8e:	89 df                	mov    %ebx,%edi
+  800e90:	55                   	push   %ebp
+  800e91:	89 e5                	mov    %esp,%ebp
+  800e93:	8d 35 9b 0e 80 00    	lea    0x800e9b,%esi
+  800e99:	0f 34                	sysenter
+  800e9b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800e9c:	5b                   	pop    %ebx
+  800e9d:	5e                   	pop    %esi
+  800e9e:	5f                   	pop    %edi
+  800e9f:	5d                   	pop    %ebp
+  800ea0:	c3                   	ret
+
+00800ea1 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800ea1:	55                   	push   %ebp
+  800ea2:	89 e5                	mov    %esp,%ebp
+  800ea4:	57                   	push   %edi
+  800ea5:	56                   	push   %esi
+  800ea6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ea7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eaf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb2:	b8 14 00 00 00       	mov    $0x14,%eax
+  800eb7:	89 df                	mov    %ebx,%edi
+  800eb9:	55                   	push   %ebp
+  800eba:	89 e5                	mov    %esp,%ebp
+  800ebc:	8d 35 c4 0e 80 00    	lea    0x800ec4,%esi
+  800ec2:	0f 34                	sysenter
+  800ec4:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+
+00800eca <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	57                   	push   %edi
+  800ece:	56                   	push   %esi
+  800ecf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ed0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed6:	b8 13 00 00 00       	mov    $0x13,%eax
+  800edb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ede:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	8d 35 ec 0e 80 00    	lea    0x800eec,%esi
+  800eea:	0f 34                	sysenter
+  800eec:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800eed:	5b                   	pop    %ebx
+  800eee:	5e                   	pop    %esi
+  800eef:	5f                   	pop    %edi
+  800ef0:	5d                   	pop    %ebp
+  800ef1:	c3                   	ret
+
+00800ef2 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800ef2:	55                   	push   %ebp
+  800ef3:	89 e5                	mov    %esp,%ebp
+  800ef5:	57                   	push   %edi
+  800ef6:	56                   	push   %esi
+  800ef7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800efd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f00:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f05:	89 cb                	mov    %ecx,%ebx
+  800f07:	89 cf                	mov    %ecx,%edi
+  800f09:	89 ce                	mov    %ecx,%esi
+  800f0b:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800f0d:	5b                   	pop    %ebx
+  800f0e:	5e                   	pop    %esi
+  800f0f:	5f                   	pop    %edi
+  800f10:	5d                   	pop    %ebp
+  800f11:	c3                   	ret
+
+00800f12 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800f12:	55                   	push   %ebp
+  800f13:	89 e5                	mov    %esp,%ebp
+  800f15:	57                   	push   %edi
+  800f16:	56                   	push   %esi
+  800f17:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f20:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f25:	89 cb                	mov    %ecx,%ebx
+  800f27:	89 cf                	mov    %ecx,%edi
+  800f29:	55                   	push   %ebp
+  800f2a:	89 e5                	mov    %esp,%ebp
+  800f2c:	8d 35 34 0f 80 00    	lea    0x800f34,%esi
+  800f32:	0f 34                	sysenter
+  800f34:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800f35:	5b                   	pop    %ebx
+  800f36:	5e                   	pop    %esi
+  800f37:	5f                   	pop    %edi
+  800f38:	5d                   	pop    %ebp
+  800f39:	c3                   	ret
+
+00800f3a <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800f3a:	55                   	push   %ebp
+  800f3b:	89 e5                	mov    %esp,%ebp
+  800f3d:	57                   	push   %edi
+  800f3e:	56                   	push   %esi
+  800f3f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f48:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f4d:	89 cb                	mov    %ecx,%ebx
+  800f4f:	89 cf                	mov    %ecx,%edi
+  800f51:	55                   	push   %ebp
+  800f52:	89 e5                	mov    %esp,%ebp
+  800f54:	8d 35 5c 0f 80 00    	lea    0x800f5c,%esi
+  800f5a:	0f 34                	sysenter
+  800f5c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800f5d:	5b                   	pop    %ebx
+  800f5e:	5e                   	pop    %esi
+  800f5f:	5f                   	pop    %edi
+  800f60:	5d                   	pop    %ebp
+  800f61:	c3                   	ret
+
+00800f62 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f68:	05 00 00 00 30       	add    $0x30000000,%eax
+  800f6d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800f70:	5d                   	pop    %ebp
+  800f71:	c3                   	ret
+
+00800f72 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800f72:	55                   	push   %ebp
+  800f73:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f78:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800f7d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800f82:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800f87:	5d                   	pop    %ebp
+  800f88:	c3                   	ret
+
+00800f89 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800f89:	55                   	push   %ebp
+  800f8a:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800f8c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800f91:	eb 02                	jmp    800f95 <fd_alloc+0xc>
+  800f93:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800f95:	89 c2                	mov    %eax,%edx
+  800f97:	c1 ea 16             	shr    $0x16,%edx
+  800f9a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800fa1:	f6 c2 01             	test   $0x1,%dl
+  800fa4:	74 2b                	je     800fd1 <fd_alloc+0x48>
+  800fa6:	89 c2                	mov    %eax,%edx
+  800fa8:	c1 ea 0c             	shr    $0xc,%edx
+  800fab:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800fb2:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800fb8:	f6 c1 01             	test   $0x1,%cl
+  800fbb:	74 14                	je     800fd1 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800fbd:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800fc3:	75 ce                	jne    800f93 <fd_alloc+0xa>
+  800fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800fca:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800fcf:	eb 05                	jmp    800fd6 <fd_alloc+0x4d>
+			return 0;
+  800fd1:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800fd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd9:	89 02                	mov    %eax,(%edx)
+}
+  800fdb:	89 c8                	mov    %ecx,%eax
+  800fdd:	5d                   	pop    %ebp
+  800fde:	c3                   	ret
+
+00800fdf <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800fdf:	55                   	push   %ebp
+  800fe0:	89 e5                	mov    %esp,%ebp
+  800fe2:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800fe5:	83 f8 1f             	cmp    $0x1f,%eax
+  800fe8:	77 30                	ja     80101a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800fea:	c1 e0 0c             	shl    $0xc,%eax
+  800fed:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800ff2:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800ff8:	f6 c2 01             	test   $0x1,%dl
+  800ffb:	74 24                	je     801021 <fd_lookup+0x42>
+  800ffd:	89 c2                	mov    %eax,%edx
+  800fff:	c1 ea 0c             	shr    $0xc,%edx
+  801002:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801009:	f6 c2 01             	test   $0x1,%dl
+  80100c:	74 1a                	je     801028 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80100e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801011:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801013:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801018:	5d                   	pop    %ebp
+  801019:	c3                   	ret
+		return -E_INVAL;
+  80101a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80101f:	eb f7                	jmp    801018 <fd_lookup+0x39>
+		return -E_INVAL;
+  801021:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801026:	eb f0                	jmp    801018 <fd_lookup+0x39>
+  801028:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80102d:	eb e9                	jmp    801018 <fd_lookup+0x39>
+
+0080102f <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80102f:	55                   	push   %ebp
+  801030:	89 e5                	mov    %esp,%ebp
+  801032:	53                   	push   %ebx
+  801033:	83 ec 04             	sub    $0x4,%esp
+  801036:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801039:	b8 00 00 00 00       	mov    $0x0,%eax
+  80103e:	eb 03                	jmp    801043 <dev_lookup+0x14>
+  801040:	83 c0 01             	add    $0x1,%eax
+  801043:	8b 1c 85 90 3b 80 00 	mov    0x803b90(,%eax,4),%ebx
+  80104a:	85 db                	test   %ebx,%ebx
+  80104c:	74 0b                	je     801059 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80104e:	39 13                	cmp    %edx,(%ebx)
+  801050:	75 ee                	jne    801040 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801052:	b8 00 00 00 00       	mov    $0x0,%eax
+  801057:	eb 1f                	jmp    801078 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801059:	a1 00 50 80 00       	mov    0x805000,%eax
+  80105e:	8b 40 48             	mov    0x48(%eax),%eax
+  801061:	83 ec 04             	sub    $0x4,%esp
+  801064:	52                   	push   %edx
+  801065:	50                   	push   %eax
+  801066:	68 14 3b 80 00       	push   $0x803b14
+  80106b:	e8 f7 f0 ff ff       	call   800167 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801070:	83 c4 10             	add    $0x10,%esp
+  801073:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801078:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80107b:	89 1a                	mov    %ebx,(%edx)
+}
+  80107d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801080:	c9                   	leave
+  801081:	c3                   	ret
+
+00801082 <fd_close>:
+{
+  801082:	55                   	push   %ebp
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	57                   	push   %edi
+  801086:	56                   	push   %esi
+  801087:	53                   	push   %ebx
+  801088:	83 ec 24             	sub    $0x24,%esp
+  80108b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80108e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801091:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801094:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801095:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80109b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80109e:	50                   	push   %eax
+  80109f:	e8 3b ff ff ff       	call   800fdf <fd_lookup>
+  8010a4:	89 c3                	mov    %eax,%ebx
+  8010a6:	83 c4 10             	add    $0x10,%esp
+  8010a9:	85 c0                	test   %eax,%eax
+  8010ab:	78 05                	js     8010b2 <fd_close+0x30>
+	    || fd != fd2)
+  8010ad:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8010b0:	74 16                	je     8010c8 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8010b2:	89 f8                	mov    %edi,%eax
+  8010b4:	84 c0                	test   %al,%al
+  8010b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010bb:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8010be:	89 d8                	mov    %ebx,%eax
+  8010c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c3:	5b                   	pop    %ebx
+  8010c4:	5e                   	pop    %esi
+  8010c5:	5f                   	pop    %edi
+  8010c6:	5d                   	pop    %ebp
+  8010c7:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8010c8:	83 ec 08             	sub    $0x8,%esp
+  8010cb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8010ce:	50                   	push   %eax
+  8010cf:	ff 36                	push   (%esi)
+  8010d1:	e8 59 ff ff ff       	call   80102f <dev_lookup>
+  8010d6:	89 c3                	mov    %eax,%ebx
+  8010d8:	83 c4 10             	add    $0x10,%esp
+  8010db:	85 c0                	test   %eax,%eax
+  8010dd:	78 1a                	js     8010f9 <fd_close+0x77>
+		if (dev->dev_close)
+  8010df:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8010e2:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8010e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8010ea:	85 c0                	test   %eax,%eax
+  8010ec:	74 0b                	je     8010f9 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8010ee:	83 ec 0c             	sub    $0xc,%esp
+  8010f1:	56                   	push   %esi
+  8010f2:	ff d0                	call   *%eax
+  8010f4:	89 c3                	mov    %eax,%ebx
+  8010f6:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8010f9:	83 ec 08             	sub    $0x8,%esp
+  8010fc:	56                   	push   %esi
+  8010fd:	6a 00                	push   $0x0
+  8010ff:	e8 ea fa ff ff       	call   800bee <sys_page_unmap>
+	return r;
+  801104:	83 c4 10             	add    $0x10,%esp
+  801107:	eb b5                	jmp    8010be <fd_close+0x3c>
+
+00801109 <close>:
+
+int
+close(int fdnum)
+{
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80110f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801112:	50                   	push   %eax
+  801113:	ff 75 08             	push   0x8(%ebp)
+  801116:	e8 c4 fe ff ff       	call   800fdf <fd_lookup>
+  80111b:	83 c4 10             	add    $0x10,%esp
+  80111e:	85 c0                	test   %eax,%eax
+  801120:	79 02                	jns    801124 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801122:	c9                   	leave
+  801123:	c3                   	ret
+		return fd_close(fd, 1);
+  801124:	83 ec 08             	sub    $0x8,%esp
+  801127:	6a 01                	push   $0x1
+  801129:	ff 75 f4             	push   -0xc(%ebp)
+  80112c:	e8 51 ff ff ff       	call   801082 <fd_close>
+  801131:	83 c4 10             	add    $0x10,%esp
+  801134:	eb ec                	jmp    801122 <close+0x19>
+
+00801136 <close_all>:
+
+void
+close_all(void)
+{
+  801136:	55                   	push   %ebp
+  801137:	89 e5                	mov    %esp,%ebp
+  801139:	53                   	push   %ebx
+  80113a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80113d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801142:	83 ec 0c             	sub    $0xc,%esp
+  801145:	53                   	push   %ebx
+  801146:	e8 be ff ff ff       	call   801109 <close>
+	for (i = 0; i < MAXFD; i++)
+  80114b:	83 c3 01             	add    $0x1,%ebx
+  80114e:	83 c4 10             	add    $0x10,%esp
+  801151:	83 fb 20             	cmp    $0x20,%ebx
+  801154:	75 ec                	jne    801142 <close_all+0xc>
+}
+  801156:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801159:	c9                   	leave
+  80115a:	c3                   	ret
+
+0080115b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80115b:	55                   	push   %ebp
+  80115c:	89 e5                	mov    %esp,%ebp
+  80115e:	57                   	push   %edi
+  80115f:	56                   	push   %esi
+  801160:	53                   	push   %ebx
+  801161:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801164:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801167:	50                   	push   %eax
+  801168:	ff 75 08             	push   0x8(%ebp)
+  80116b:	e8 6f fe ff ff       	call   800fdf <fd_lookup>
+  801170:	89 c3                	mov    %eax,%ebx
+  801172:	83 c4 10             	add    $0x10,%esp
+  801175:	85 c0                	test   %eax,%eax
+  801177:	78 7f                	js     8011f8 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801179:	83 ec 0c             	sub    $0xc,%esp
+  80117c:	ff 75 0c             	push   0xc(%ebp)
+  80117f:	e8 85 ff ff ff       	call   801109 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801184:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801187:	c1 e6 0c             	shl    $0xc,%esi
+  80118a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801190:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801193:	89 3c 24             	mov    %edi,(%esp)
+  801196:	e8 d7 fd ff ff       	call   800f72 <fd2data>
+  80119b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80119d:	89 34 24             	mov    %esi,(%esp)
+  8011a0:	e8 cd fd ff ff       	call   800f72 <fd2data>
+  8011a5:	83 c4 10             	add    $0x10,%esp
+  8011a8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8011ab:	89 d8                	mov    %ebx,%eax
+  8011ad:	c1 e8 16             	shr    $0x16,%eax
+  8011b0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8011b7:	a8 01                	test   $0x1,%al
+  8011b9:	74 11                	je     8011cc <dup+0x71>
+  8011bb:	89 d8                	mov    %ebx,%eax
+  8011bd:	c1 e8 0c             	shr    $0xc,%eax
+  8011c0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011c7:	f6 c2 01             	test   $0x1,%dl
+  8011ca:	75 36                	jne    801202 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8011cc:	89 f8                	mov    %edi,%eax
+  8011ce:	c1 e8 0c             	shr    $0xc,%eax
+  8011d1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011d8:	83 ec 0c             	sub    $0xc,%esp
+  8011db:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011e0:	50                   	push   %eax
+  8011e1:	56                   	push   %esi
+  8011e2:	6a 00                	push   $0x0
+  8011e4:	57                   	push   %edi
+  8011e5:	6a 00                	push   $0x0
+  8011e7:	e8 c0 f9 ff ff       	call   800bac <sys_page_map>
+  8011ec:	89 c3                	mov    %eax,%ebx
+  8011ee:	83 c4 20             	add    $0x20,%esp
+  8011f1:	85 c0                	test   %eax,%eax
+  8011f3:	78 33                	js     801228 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8011f5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8011f8:	89 d8                	mov    %ebx,%eax
+  8011fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011fd:	5b                   	pop    %ebx
+  8011fe:	5e                   	pop    %esi
+  8011ff:	5f                   	pop    %edi
+  801200:	5d                   	pop    %ebp
+  801201:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801202:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801209:	83 ec 0c             	sub    $0xc,%esp
+  80120c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801211:	50                   	push   %eax
+  801212:	ff 75 d4             	push   -0x2c(%ebp)
+  801215:	6a 00                	push   $0x0
+  801217:	53                   	push   %ebx
+  801218:	6a 00                	push   $0x0
+  80121a:	e8 8d f9 ff ff       	call   800bac <sys_page_map>
+  80121f:	89 c3                	mov    %eax,%ebx
+  801221:	83 c4 20             	add    $0x20,%esp
+  801224:	85 c0                	test   %eax,%eax
+  801226:	79 a4                	jns    8011cc <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801228:	83 ec 08             	sub    $0x8,%esp
+  80122b:	56                   	push   %esi
+  80122c:	6a 00                	push   $0x0
+  80122e:	e8 bb f9 ff ff       	call   800bee <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801233:	83 c4 08             	add    $0x8,%esp
+  801236:	ff 75 d4             	push   -0x2c(%ebp)
+  801239:	6a 00                	push   $0x0
+  80123b:	e8 ae f9 ff ff       	call   800bee <sys_page_unmap>
+	return r;
+  801240:	83 c4 10             	add    $0x10,%esp
+  801243:	eb b3                	jmp    8011f8 <dup+0x9d>
+
+00801245 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801245:	55                   	push   %ebp
+  801246:	89 e5                	mov    %esp,%ebp
+  801248:	56                   	push   %esi
+  801249:	53                   	push   %ebx
+  80124a:	83 ec 18             	sub    $0x18,%esp
+  80124d:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801250:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801253:	50                   	push   %eax
+  801254:	56                   	push   %esi
+  801255:	e8 85 fd ff ff       	call   800fdf <fd_lookup>
+  80125a:	83 c4 10             	add    $0x10,%esp
+  80125d:	85 c0                	test   %eax,%eax
+  80125f:	78 3c                	js     80129d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801261:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801264:	83 ec 08             	sub    $0x8,%esp
+  801267:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80126a:	50                   	push   %eax
+  80126b:	ff 33                	push   (%ebx)
+  80126d:	e8 bd fd ff ff       	call   80102f <dev_lookup>
+  801272:	83 c4 10             	add    $0x10,%esp
+  801275:	85 c0                	test   %eax,%eax
+  801277:	78 24                	js     80129d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801279:	8b 43 08             	mov    0x8(%ebx),%eax
+  80127c:	83 e0 03             	and    $0x3,%eax
+  80127f:	83 f8 01             	cmp    $0x1,%eax
+  801282:	74 20                	je     8012a4 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801284:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801287:	8b 40 08             	mov    0x8(%eax),%eax
+  80128a:	85 c0                	test   %eax,%eax
+  80128c:	74 37                	je     8012c5 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80128e:	83 ec 04             	sub    $0x4,%esp
+  801291:	ff 75 10             	push   0x10(%ebp)
+  801294:	ff 75 0c             	push   0xc(%ebp)
+  801297:	53                   	push   %ebx
+  801298:	ff d0                	call   *%eax
+  80129a:	83 c4 10             	add    $0x10,%esp
+}
+  80129d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012a0:	5b                   	pop    %ebx
+  8012a1:	5e                   	pop    %esi
+  8012a2:	5d                   	pop    %ebp
+  8012a3:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8012a4:	a1 00 50 80 00       	mov    0x805000,%eax
+  8012a9:	8b 40 48             	mov    0x48(%eax),%eax
+  8012ac:	83 ec 04             	sub    $0x4,%esp
+  8012af:	56                   	push   %esi
+  8012b0:	50                   	push   %eax
+  8012b1:	68 55 3b 80 00       	push   $0x803b55
+  8012b6:	e8 ac ee ff ff       	call   800167 <cprintf>
+		return -E_INVAL;
+  8012bb:	83 c4 10             	add    $0x10,%esp
+  8012be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012c3:	eb d8                	jmp    80129d <read+0x58>
+		return -E_NOT_SUPP;
+  8012c5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012ca:	eb d1                	jmp    80129d <read+0x58>
+
+008012cc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8012cc:	55                   	push   %ebp
+  8012cd:	89 e5                	mov    %esp,%ebp
+  8012cf:	57                   	push   %edi
+  8012d0:	56                   	push   %esi
+  8012d1:	53                   	push   %ebx
+  8012d2:	83 ec 0c             	sub    $0xc,%esp
+  8012d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8012d8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8012db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e0:	eb 02                	jmp    8012e4 <readn+0x18>
+  8012e2:	01 c3                	add    %eax,%ebx
+  8012e4:	39 f3                	cmp    %esi,%ebx
+  8012e6:	73 21                	jae    801309 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8012e8:	83 ec 04             	sub    $0x4,%esp
+  8012eb:	89 f0                	mov    %esi,%eax
+  8012ed:	29 d8                	sub    %ebx,%eax
+  8012ef:	50                   	push   %eax
+  8012f0:	89 d8                	mov    %ebx,%eax
+  8012f2:	03 45 0c             	add    0xc(%ebp),%eax
+  8012f5:	50                   	push   %eax
+  8012f6:	57                   	push   %edi
+  8012f7:	e8 49 ff ff ff       	call   801245 <read>
+		if (m < 0)
+  8012fc:	83 c4 10             	add    $0x10,%esp
+  8012ff:	85 c0                	test   %eax,%eax
+  801301:	78 04                	js     801307 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801303:	75 dd                	jne    8012e2 <readn+0x16>
+  801305:	eb 02                	jmp    801309 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801307:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801309:	89 d8                	mov    %ebx,%eax
+  80130b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80130e:	5b                   	pop    %ebx
+  80130f:	5e                   	pop    %esi
+  801310:	5f                   	pop    %edi
+  801311:	5d                   	pop    %ebp
+  801312:	c3                   	ret
+
+00801313 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801313:	55                   	push   %ebp
+  801314:	89 e5                	mov    %esp,%ebp
+  801316:	56                   	push   %esi
+  801317:	53                   	push   %ebx
+  801318:	83 ec 18             	sub    $0x18,%esp
+  80131b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80131e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801321:	50                   	push   %eax
+  801322:	53                   	push   %ebx
+  801323:	e8 b7 fc ff ff       	call   800fdf <fd_lookup>
+  801328:	83 c4 10             	add    $0x10,%esp
+  80132b:	85 c0                	test   %eax,%eax
+  80132d:	78 37                	js     801366 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80132f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801332:	83 ec 08             	sub    $0x8,%esp
+  801335:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801338:	50                   	push   %eax
+  801339:	ff 36                	push   (%esi)
+  80133b:	e8 ef fc ff ff       	call   80102f <dev_lookup>
+  801340:	83 c4 10             	add    $0x10,%esp
+  801343:	85 c0                	test   %eax,%eax
+  801345:	78 1f                	js     801366 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801347:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80134b:	74 20                	je     80136d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80134d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801350:	8b 40 0c             	mov    0xc(%eax),%eax
+  801353:	85 c0                	test   %eax,%eax
+  801355:	74 37                	je     80138e <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801357:	83 ec 04             	sub    $0x4,%esp
+  80135a:	ff 75 10             	push   0x10(%ebp)
+  80135d:	ff 75 0c             	push   0xc(%ebp)
+  801360:	56                   	push   %esi
+  801361:	ff d0                	call   *%eax
+  801363:	83 c4 10             	add    $0x10,%esp
+}
+  801366:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801369:	5b                   	pop    %ebx
+  80136a:	5e                   	pop    %esi
+  80136b:	5d                   	pop    %ebp
+  80136c:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80136d:	a1 00 50 80 00       	mov    0x805000,%eax
+  801372:	8b 40 48             	mov    0x48(%eax),%eax
+  801375:	83 ec 04             	sub    $0x4,%esp
+  801378:	53                   	push   %ebx
+  801379:	50                   	push   %eax
+  80137a:	68 71 3b 80 00       	push   $0x803b71
+  80137f:	e8 e3 ed ff ff       	call   800167 <cprintf>
+		return -E_INVAL;
+  801384:	83 c4 10             	add    $0x10,%esp
+  801387:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80138c:	eb d8                	jmp    801366 <write+0x53>
+		return -E_NOT_SUPP;
+  80138e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801393:	eb d1                	jmp    801366 <write+0x53>
+
+00801395 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801395:	55                   	push   %ebp
+  801396:	89 e5                	mov    %esp,%ebp
+  801398:	53                   	push   %ebx
+  801399:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80139c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80139f:	50                   	push   %eax
+  8013a0:	ff 75 08             	push   0x8(%ebp)
+  8013a3:	e8 37 fc ff ff       	call   800fdf <fd_lookup>
+  8013a8:	83 c4 10             	add    $0x10,%esp
+  8013ab:	85 c0                	test   %eax,%eax
+  8013ad:	78 3a                	js     8013e9 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013af:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8013b2:	83 ec 08             	sub    $0x8,%esp
+  8013b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013b8:	50                   	push   %eax
+  8013b9:	ff 33                	push   (%ebx)
+  8013bb:	e8 6f fc ff ff       	call   80102f <dev_lookup>
+  8013c0:	83 c4 10             	add    $0x10,%esp
+  8013c3:	85 c0                	test   %eax,%eax
+  8013c5:	78 22                	js     8013e9 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8013c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013ca:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8013cd:	85 c0                	test   %eax,%eax
+  8013cf:	74 0d                	je     8013de <seek+0x49>
+  8013d1:	83 ec 0c             	sub    $0xc,%esp
+  8013d4:	53                   	push   %ebx
+  8013d5:	ff d0                	call   *%eax
+  8013d7:	83 c4 10             	add    $0x10,%esp
+  8013da:	85 c0                	test   %eax,%eax
+  8013dc:	78 0b                	js     8013e9 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8013de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013e1:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8013e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013ec:	c9                   	leave
+  8013ed:	c3                   	ret
+
+008013ee <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8013ee:	55                   	push   %ebp
+  8013ef:	89 e5                	mov    %esp,%ebp
+  8013f1:	53                   	push   %ebx
+  8013f2:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013f5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013f8:	50                   	push   %eax
+  8013f9:	ff 75 08             	push   0x8(%ebp)
+  8013fc:	e8 de fb ff ff       	call   800fdf <fd_lookup>
+  801401:	83 c4 10             	add    $0x10,%esp
+  801404:	85 c0                	test   %eax,%eax
+  801406:	78 2b                	js     801433 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801408:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80140b:	83 ec 08             	sub    $0x8,%esp
+  80140e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801411:	50                   	push   %eax
+  801412:	ff 33                	push   (%ebx)
+  801414:	e8 16 fc ff ff       	call   80102f <dev_lookup>
+  801419:	83 c4 10             	add    $0x10,%esp
+  80141c:	85 c0                	test   %eax,%eax
+  80141e:	78 13                	js     801433 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801423:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801426:	85 c0                	test   %eax,%eax
+  801428:	74 0e                	je     801438 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  80142a:	83 ec 0c             	sub    $0xc,%esp
+  80142d:	53                   	push   %ebx
+  80142e:	ff d0                	call   *%eax
+  801430:	83 c4 10             	add    $0x10,%esp
+}
+  801433:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801436:	c9                   	leave
+  801437:	c3                   	ret
+		return 0;
+  801438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143d:	eb f4                	jmp    801433 <fsync+0x45>
+
+0080143f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80143f:	55                   	push   %ebp
+  801440:	89 e5                	mov    %esp,%ebp
+  801442:	56                   	push   %esi
+  801443:	53                   	push   %ebx
+  801444:	83 ec 18             	sub    $0x18,%esp
+  801447:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80144a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80144d:	50                   	push   %eax
+  80144e:	53                   	push   %ebx
+  80144f:	e8 8b fb ff ff       	call   800fdf <fd_lookup>
+  801454:	83 c4 10             	add    $0x10,%esp
+  801457:	85 c0                	test   %eax,%eax
+  801459:	78 34                	js     80148f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80145b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80145e:	83 ec 08             	sub    $0x8,%esp
+  801461:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801464:	50                   	push   %eax
+  801465:	ff 36                	push   (%esi)
+  801467:	e8 c3 fb ff ff       	call   80102f <dev_lookup>
+  80146c:	83 c4 10             	add    $0x10,%esp
+  80146f:	85 c0                	test   %eax,%eax
+  801471:	78 1c                	js     80148f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801473:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801477:	74 1d                	je     801496 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801479:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80147c:	8b 40 18             	mov    0x18(%eax),%eax
+  80147f:	85 c0                	test   %eax,%eax
+  801481:	74 34                	je     8014b7 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801483:	83 ec 08             	sub    $0x8,%esp
+  801486:	ff 75 0c             	push   0xc(%ebp)
+  801489:	56                   	push   %esi
+  80148a:	ff d0                	call   *%eax
+  80148c:	83 c4 10             	add    $0x10,%esp
+}
+  80148f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801492:	5b                   	pop    %ebx
+  801493:	5e                   	pop    %esi
+  801494:	5d                   	pop    %ebp
+  801495:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801496:	a1 00 50 80 00       	mov    0x805000,%eax
+  80149b:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80149e:	83 ec 04             	sub    $0x4,%esp
+  8014a1:	53                   	push   %ebx
+  8014a2:	50                   	push   %eax
+  8014a3:	68 34 3b 80 00       	push   $0x803b34
+  8014a8:	e8 ba ec ff ff       	call   800167 <cprintf>
+		return -E_INVAL;
+  8014ad:	83 c4 10             	add    $0x10,%esp
+  8014b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014b5:	eb d8                	jmp    80148f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8014b7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014bc:	eb d1                	jmp    80148f <ftruncate+0x50>
+
+008014be <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8014be:	55                   	push   %ebp
+  8014bf:	89 e5                	mov    %esp,%ebp
+  8014c1:	56                   	push   %esi
+  8014c2:	53                   	push   %ebx
+  8014c3:	83 ec 18             	sub    $0x18,%esp
+  8014c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014c9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014cc:	50                   	push   %eax
+  8014cd:	ff 75 08             	push   0x8(%ebp)
+  8014d0:	e8 0a fb ff ff       	call   800fdf <fd_lookup>
+  8014d5:	83 c4 10             	add    $0x10,%esp
+  8014d8:	85 c0                	test   %eax,%eax
+  8014da:	78 49                	js     801525 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014dc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014df:	83 ec 08             	sub    $0x8,%esp
+  8014e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014e5:	50                   	push   %eax
+  8014e6:	ff 36                	push   (%esi)
+  8014e8:	e8 42 fb ff ff       	call   80102f <dev_lookup>
+  8014ed:	83 c4 10             	add    $0x10,%esp
+  8014f0:	85 c0                	test   %eax,%eax
+  8014f2:	78 31                	js     801525 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8014f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014f7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8014fb:	74 2f                	je     80152c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8014fd:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801500:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801507:	00 00 00 
+	stat->st_isdir = 0;
+  80150a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801511:	00 00 00 
+	stat->st_dev = dev;
+  801514:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80151a:	83 ec 08             	sub    $0x8,%esp
+  80151d:	53                   	push   %ebx
+  80151e:	56                   	push   %esi
+  80151f:	ff 50 14             	call   *0x14(%eax)
+  801522:	83 c4 10             	add    $0x10,%esp
+}
+  801525:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801528:	5b                   	pop    %ebx
+  801529:	5e                   	pop    %esi
+  80152a:	5d                   	pop    %ebp
+  80152b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80152c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801531:	eb f2                	jmp    801525 <fstat+0x67>
+
+00801533 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801533:	55                   	push   %ebp
+  801534:	89 e5                	mov    %esp,%ebp
+  801536:	56                   	push   %esi
+  801537:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801538:	83 ec 08             	sub    $0x8,%esp
+  80153b:	68 00 10 00 00       	push   $0x1000
+  801540:	ff 75 08             	push   0x8(%ebp)
+  801543:	e8 b3 07 00 00       	call   801cfb <open>
+  801548:	89 c3                	mov    %eax,%ebx
+  80154a:	83 c4 10             	add    $0x10,%esp
+  80154d:	85 c0                	test   %eax,%eax
+  80154f:	78 1b                	js     80156c <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801551:	83 ec 08             	sub    $0x8,%esp
+  801554:	ff 75 0c             	push   0xc(%ebp)
+  801557:	50                   	push   %eax
+  801558:	e8 61 ff ff ff       	call   8014be <fstat>
+  80155d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80155f:	89 1c 24             	mov    %ebx,(%esp)
+  801562:	e8 a2 fb ff ff       	call   801109 <close>
+	return r;
+  801567:	83 c4 10             	add    $0x10,%esp
+  80156a:	89 f3                	mov    %esi,%ebx
+}
+  80156c:	89 d8                	mov    %ebx,%eax
+  80156e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801571:	5b                   	pop    %ebx
+  801572:	5e                   	pop    %esi
+  801573:	5d                   	pop    %ebp
+  801574:	c3                   	ret
+
+00801575 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801575:	55                   	push   %ebp
+  801576:	89 e5                	mov    %esp,%ebp
+  801578:	57                   	push   %edi
+  801579:	56                   	push   %esi
+  80157a:	53                   	push   %ebx
+  80157b:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801581:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801587:	89 d6                	mov    %edx,%esi
+  801589:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  80158f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801592:	89 d3                	mov    %edx,%ebx
+  801594:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  80159a:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  8015a1:	74 1d                	je     8015c0 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8015a3:	b8 00 60 80 00       	mov    $0x806000,%eax
+  8015a8:	83 c8 07             	or     $0x7,%eax
+  8015ab:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  8015b1:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8015b6:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  8015bc:	01 ce                	add    %ecx,%esi
+  8015be:	eb 28                	jmp    8015e8 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8015c0:	83 ec 0c             	sub    $0xc,%esp
+  8015c3:	6a 01                	push   $0x1
+  8015c5:	e8 52 1e 00 00       	call   80341c <ipc_find_env>
+  8015ca:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8015cf:	83 c4 10             	add    $0x10,%esp
+  8015d2:	eb cf                	jmp    8015a3 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  8015d4:	83 c0 01             	add    $0x1,%eax
+  8015d7:	89 fa                	mov    %edi,%edx
+  8015d9:	09 da                	or     %ebx,%edx
+  8015db:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8015e2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8015e8:	39 f3                	cmp    %esi,%ebx
+  8015ea:	72 e8                	jb     8015d4 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  8015ec:	83 f8 41             	cmp    $0x41,%eax
+  8015ef:	77 2f                	ja     801620 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  8015f1:	50                   	push   %eax
+  8015f2:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  8015f8:	50                   	push   %eax
+  8015f9:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  8015ff:	ff 35 c8 70 80 00    	push   0x8070c8
+  801605:	e8 c4 1d 00 00       	call   8033ce <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  80160a:	83 c4 0c             	add    $0xc,%esp
+  80160d:	6a 00                	push   $0x0
+  80160f:	6a 00                	push   $0x0
+  801611:	6a 00                	push   $0x0
+  801613:	e8 60 1c 00 00       	call   803278 <ipc_recv>
+}
+  801618:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80161b:	5b                   	pop    %ebx
+  80161c:	5e                   	pop    %esi
+  80161d:	5f                   	pop    %edi
+  80161e:	5d                   	pop    %ebp
+  80161f:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801620:	68 a4 3b 80 00       	push   $0x803ba4
+  801625:	68 c0 3b 80 00       	push   $0x803bc0
+  80162a:	6a 40                	push   $0x40
+  80162c:	68 d5 3b 80 00       	push   $0x803bd5
+  801631:	e8 e7 18 00 00       	call   802f1d <_panic>
+
+00801636 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801636:	55                   	push   %ebp
+  801637:	89 e5                	mov    %esp,%ebp
+  801639:	57                   	push   %edi
+  80163a:	56                   	push   %esi
+  80163b:	53                   	push   %ebx
+  80163c:	83 ec 1c             	sub    $0x1c,%esp
+  80163f:	89 c3                	mov    %eax,%ebx
+  801641:	89 d6                	mov    %edx,%esi
+  801643:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801646:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  80164c:	89 ca                	mov    %ecx,%edx
+  80164e:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801651:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801658:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80165b:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801662:	8b 76 0c             	mov    0xc(%esi),%esi
+  801665:	89 fb                	mov    %edi,%ebx
+  801667:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  80166e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801671:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801678:	8b 75 08             	mov    0x8(%ebp),%esi
+  80167b:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801682:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801685:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  80168c:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  80168f:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801696:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  80169b:	39 c8                	cmp    %ecx,%eax
+  80169d:	74 0d                	je     8016ac <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  80169f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016a7:	5b                   	pop    %ebx
+  8016a8:	5e                   	pop    %esi
+  8016a9:	5f                   	pop    %edi
+  8016aa:	5d                   	pop    %ebp
+  8016ab:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016ac:	6a 07                	push   $0x7
+  8016ae:	68 00 60 80 00       	push   $0x806000
+  8016b3:	6a 0d                	push   $0xd
+  8016b5:	ff 35 c8 70 80 00    	push   0x8070c8
+  8016bb:	e8 23 1c 00 00       	call   8032e3 <ipc_send>
+  8016c0:	83 c4 10             	add    $0x10,%esp
+  8016c3:	eb da                	jmp    80169f <fsring_post+0x69>
+
+008016c5 <fsipcv>:
+{
+  8016c5:	55                   	push   %ebp
+  8016c6:	89 e5                	mov    %esp,%ebp
+  8016c8:	57                   	push   %edi
+  8016c9:	56                   	push   %esi
+  8016ca:	53                   	push   %ebx
+  8016cb:	83 ec 0c             	sub    $0xc,%esp
+  8016ce:	89 c7                	mov    %eax,%edi
+  8016d0:	89 d3                	mov    %edx,%ebx
+  8016d2:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  8016d4:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  8016db:	74 26                	je     801703 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016dd:	6a 07                	push   $0x7
+  8016df:	68 00 60 80 00       	push   $0x806000
+  8016e4:	57                   	push   %edi
+  8016e5:	ff 35 c8 70 80 00    	push   0x8070c8
+  8016eb:	e8 f3 1b 00 00       	call   8032e3 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  8016f0:	6a 00                	push   $0x0
+  8016f2:	56                   	push   %esi
+  8016f3:	53                   	push   %ebx
+  8016f4:	6a 00                	push   $0x0
+  8016f6:	e8 40 1c 00 00       	call   80333b <ipc_recvv>
+}
+  8016fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016fe:	5b                   	pop    %ebx
+  8016ff:	5e                   	pop    %esi
+  801700:	5f                   	pop    %edi
+  801701:	5d                   	pop    %ebp
+  801702:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801703:	83 ec 0c             	sub    $0xc,%esp
+  801706:	6a 01                	push   $0x1
+  801708:	e8 0f 1d 00 00       	call   80341c <ipc_find_env>
+  80170d:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801712:	83 c4 10             	add    $0x10,%esp
+  801715:	eb c6                	jmp    8016dd <fsipcv+0x18>
+
+00801717 <fsipc>:
+{
+  801717:	55                   	push   %ebp
+  801718:	89 e5                	mov    %esp,%ebp
+  80171a:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  80171d:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801724:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801727:	e8 99 ff ff ff       	call   8016c5 <fsipcv>
+}
+  80172c:	c9                   	leave
+  80172d:	c3                   	ret
+
+0080172e <file_write_direct>:
+{
+  80172e:	55                   	push   %ebp
+  80172f:	89 e5                	mov    %esp,%ebp
+  801731:	56                   	push   %esi
+  801732:	53                   	push   %ebx
+  801733:	89 c3                	mov    %eax,%ebx
+  801735:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801737:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  80173d:	77 40                	ja     80177f <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80173f:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801744:	39 c8                	cmp    %ecx,%eax
+  801746:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801749:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  80174c:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  801752:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801757:	83 ec 04             	sub    $0x4,%esp
+  80175a:	50                   	push   %eax
+  80175b:	52                   	push   %edx
+  80175c:	68 08 60 80 00       	push   $0x806008
+  801761:	e8 75 f1 ff ff       	call   8008db <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801766:	ba 00 00 00 00       	mov    $0x0,%edx
+  80176b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801770:	e8 a2 ff ff ff       	call   801717 <fsipc>
+  801775:	83 c4 10             	add    $0x10,%esp
+}
+  801778:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80177b:	5b                   	pop    %ebx
+  80177c:	5e                   	pop    %esi
+  80177d:	5d                   	pop    %ebp
+  80177e:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80177f:	89 d6                	mov    %edx,%esi
+  801781:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801787:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80178c:	29 f1                	sub    %esi,%ecx
+  80178e:	39 c1                	cmp    %eax,%ecx
+  801790:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801793:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801796:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  80179b:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8017a1:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  8017a7:	83 ec 0c             	sub    $0xc,%esp
+  8017aa:	6a 05                	push   $0x5
+  8017ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8017b1:	e8 bf fd ff ff       	call   801575 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  8017b6:	83 c4 10             	add    $0x10,%esp
+  8017b9:	eb bd                	jmp    801778 <file_write_direct+0x4a>
+
+008017bb <devfile_sync>:
+{
+  8017bb:	55                   	push   %ebp
+  8017bc:	89 e5                	mov    %esp,%ebp
+  8017be:	57                   	push   %edi
+  8017bf:	56                   	push   %esi
+  8017c0:	53                   	push   %ebx
+  8017c1:	83 ec 28             	sub    $0x28,%esp
+  8017c4:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  8017c7:	56                   	push   %esi
+  8017c8:	e8 a5 f7 ff ff       	call   800f72 <fd2data>
+  8017cd:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  8017cf:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  8017d2:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  8017d9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8017dc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  8017e1:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8017e5:	74 45                	je     80182c <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  8017e7:	8b 46 14             	mov    0x14(%esi),%eax
+  8017ea:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8017ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8017fa:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  8017fd:	39 cb                	cmp    %ecx,%ebx
+  8017ff:	73 14                	jae    801815 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801801:	29 d9                	sub    %ebx,%ecx
+  801803:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801806:	89 f0                	mov    %esi,%eax
+  801808:	e8 21 ff ff ff       	call   80172e <file_write_direct>
+  80180d:	85 c0                	test   %eax,%eax
+  80180f:	7e 04                	jle    801815 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801811:	01 c3                	add    %eax,%ebx
+  801813:	eb e5                	jmp    8017fa <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801815:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801818:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  80181f:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801822:	85 c0                	test   %eax,%eax
+  801824:	ba 00 00 00 00       	mov    $0x0,%edx
+  801829:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80182c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80182f:	5b                   	pop    %ebx
+  801830:	5e                   	pop    %esi
+  801831:	5f                   	pop    %edi
+  801832:	5d                   	pop    %ebp
+  801833:	c3                   	ret
+
+00801834 <devfile_write>:
+{
+  801834:	55                   	push   %ebp
+  801835:	89 e5                	mov    %esp,%ebp
+  801837:	57                   	push   %edi
+  801838:	56                   	push   %esi
+  801839:	53                   	push   %ebx
+  80183a:	83 ec 28             	sub    $0x28,%esp
+  80183d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801840:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801843:	53                   	push   %ebx
+  801844:	e8 29 f7 ff ff       	call   800f72 <fd2data>
+  801849:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  80184c:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80184f:	83 c4 10             	add    $0x10,%esp
+  801852:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801856:	74 43                	je     80189b <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801858:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  80185f:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801862:	85 c0                	test   %eax,%eax
+  801864:	74 43                	je     8018a9 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801866:	89 c2                	mov    %eax,%edx
+  801868:	03 53 14             	add    0x14(%ebx),%edx
+  80186b:	39 fa                	cmp    %edi,%edx
+  80186d:	75 0b                	jne    80187a <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  80186f:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801872:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801878:	76 66                	jbe    8018e0 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  80187a:	83 ec 0c             	sub    $0xc,%esp
+  80187d:	53                   	push   %ebx
+  80187e:	e8 38 ff ff ff       	call   8017bb <devfile_sync>
+  801883:	83 c4 10             	add    $0x10,%esp
+  801886:	85 c0                	test   %eax,%eax
+  801888:	78 4e                	js     8018d8 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  80188a:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801890:	77 56                	ja     8018e8 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801892:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801895:	85 c0                	test   %eax,%eax
+  801897:	75 20                	jne    8018b9 <devfile_write+0x85>
+  801899:	eb 16                	jmp    8018b1 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  80189b:	89 f1                	mov    %esi,%ecx
+  80189d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018a0:	89 d8                	mov    %ebx,%eax
+  8018a2:	e8 87 fe ff ff       	call   80172e <file_write_direct>
+  8018a7:	eb 2f                	jmp    8018d8 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8018a9:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8018af:	77 37                	ja     8018e8 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  8018b1:	89 7b 14             	mov    %edi,0x14(%ebx)
+  8018b4:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  8018b9:	83 ec 04             	sub    $0x4,%esp
+  8018bc:	56                   	push   %esi
+  8018bd:	ff 75 0c             	push   0xc(%ebp)
+  8018c0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8018c3:	01 c1                	add    %eax,%ecx
+  8018c5:	51                   	push   %ecx
+  8018c6:	e8 10 f0 ff ff       	call   8008db <memmove>
+	ff->buf_wlen += n;
+  8018cb:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  8018ce:	01 f7                	add    %esi,%edi
+  8018d0:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8018d3:	89 f0                	mov    %esi,%eax
+  8018d5:	83 c4 10             	add    $0x10,%esp
+}
+  8018d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018db:	5b                   	pop    %ebx
+  8018dc:	5e                   	pop    %esi
+  8018dd:	5f                   	pop    %edi
+  8018de:	5d                   	pop    %ebp
+  8018df:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  8018e0:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8018e6:	76 d1                	jbe    8018b9 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  8018e8:	89 f1                	mov    %esi,%ecx
+  8018ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018ed:	89 d8                	mov    %ebx,%eax
+  8018ef:	e8 3a fe ff ff       	call   80172e <file_write_direct>
+  8018f4:	eb e2                	jmp    8018d8 <devfile_write+0xa4>
+
+008018f6 <devfile_trunc>:
+{
+  8018f6:	55                   	push   %ebp
+  8018f7:	89 e5                	mov    %esp,%ebp
+  8018f9:	53                   	push   %ebx
+  8018fa:	83 ec 10             	sub    $0x10,%esp
+  8018fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801900:	53                   	push   %ebx
+  801901:	e8 b5 fe ff ff       	call   8017bb <devfile_sync>
+  801906:	83 c4 10             	add    $0x10,%esp
+  801909:	85 c0                	test   %eax,%eax
+  80190b:	78 1f                	js     80192c <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80190d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801910:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801915:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801918:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80191d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801922:	b8 02 00 00 00       	mov    $0x2,%eax
+  801927:	e8 eb fd ff ff       	call   801717 <fsipc>
+}
+  80192c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80192f:	c9                   	leave
+  801930:	c3                   	ret
+
+00801931 <devfile_stat>:
+{
+  801931:	55                   	push   %ebp
+  801932:	89 e5                	mov    %esp,%ebp
+  801934:	56                   	push   %esi
+  801935:	53                   	push   %ebx
+  801936:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801939:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  80193c:	83 ec 0c             	sub    $0xc,%esp
+  80193f:	53                   	push   %ebx
+  801940:	e8 76 fe ff ff       	call   8017bb <devfile_sync>
+  801945:	83 c4 10             	add    $0x10,%esp
+  801948:	85 c0                	test   %eax,%eax
+  80194a:	78 47                	js     801993 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80194c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80194f:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801954:	ba 00 00 00 00       	mov    $0x0,%edx
+  801959:	b8 05 00 00 00       	mov    $0x5,%eax
+  80195e:	e8 b4 fd ff ff       	call   801717 <fsipc>
+  801963:	85 c0                	test   %eax,%eax
+  801965:	78 2c                	js     801993 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801967:	83 ec 08             	sub    $0x8,%esp
+  80196a:	68 00 60 80 00       	push   $0x806000
+  80196f:	56                   	push   %esi
+  801970:	e8 e0 ed ff ff       	call   800755 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801975:	a1 80 60 80 00       	mov    0x806080,%eax
+  80197a:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801980:	a1 84 60 80 00       	mov    0x806084,%eax
+  801985:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  80198b:	83 c4 10             	add    $0x10,%esp
+  80198e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801993:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801996:	5b                   	pop    %ebx
+  801997:	5e                   	pop    %esi
+  801998:	5d                   	pop    %ebp
+  801999:	c3                   	ret
+
+0080199a <devfile_flush>:
+{
+  80199a:	55                   	push   %ebp
+  80199b:	89 e5                	mov    %esp,%ebp
+  80199d:	56                   	push   %esi
+  80199e:	53                   	push   %ebx
+  80199f:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  8019a2:	83 ec 0c             	sub    $0xc,%esp
+  8019a5:	56                   	push   %esi
+  8019a6:	e8 10 fe ff ff       	call   8017bb <devfile_sync>
+  8019ab:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  8019ad:	83 c4 10             	add    $0x10,%esp
+  8019b0:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  8019b4:	75 25                	jne    8019db <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019b6:	8b 46 0c             	mov    0xc(%esi),%eax
+  8019b9:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  8019be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019c3:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019c8:	e8 4a fd ff ff       	call   801717 <fsipc>
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8019d2:	89 d8                	mov    %ebx,%eax
+  8019d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019d7:	5b                   	pop    %ebx
+  8019d8:	5e                   	pop    %esi
+  8019d9:	5d                   	pop    %ebp
+  8019da:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  8019db:	83 ec 0c             	sub    $0xc,%esp
+  8019de:	56                   	push   %esi
+  8019df:	e8 8e f5 ff ff       	call   800f72 <fd2data>
+  8019e4:	83 c4 08             	add    $0x8,%esp
+  8019e7:	50                   	push   %eax
+  8019e8:	6a 00                	push   $0x0
+  8019ea:	e8 ff f1 ff ff       	call   800bee <sys_page_unmap>
+  8019ef:	83 c4 10             	add    $0x10,%esp
+  8019f2:	eb c2                	jmp    8019b6 <devfile_flush+0x1c>
+
+008019f4 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  8019f4:	55                   	push   %ebp
+  8019f5:	89 e5                	mov    %esp,%ebp
+  8019f7:	57                   	push   %edi
+  8019f8:	56                   	push   %esi
+  8019f9:	53                   	push   %ebx
+  8019fa:	83 ec 64             	sub    $0x64,%esp
+  8019fd:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  8019ff:	52                   	push   %edx
+  801a00:	50                   	push   %eax
+  801a01:	e8 d9 f5 ff ff       	call   800fdf <fd_lookup>
+  801a06:	89 c1                	mov    %eax,%ecx
+  801a08:	83 c4 10             	add    $0x10,%esp
+  801a0b:	85 c0                	test   %eax,%eax
+  801a0d:	0f 88 f2 00 00 00    	js     801b05 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801a13:	8b 07                	mov    (%edi),%eax
+  801a15:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801a1b:	39 10                	cmp    %edx,(%eax)
+  801a1d:	0f 85 03 01 00 00    	jne    801b26 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801a23:	a1 00 50 80 00       	mov    0x805000,%eax
+  801a28:	8b 40 48             	mov    0x48(%eax),%eax
+  801a2b:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801a31:	0f 84 96 00 00 00    	je     801acd <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801a37:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801a3e:	0f 84 cb 00 00 00    	je     801b0f <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a44:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801a49:	83 c8 07             	or     $0x7,%eax
+  801a4c:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801a4f:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a52:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801a57:	83 ec 04             	sub    $0x4,%esp
+  801a5a:	68 07 04 00 00       	push   $0x407
+  801a5f:	53                   	push   %ebx
+  801a60:	6a 00                	push   $0x0
+  801a62:	e8 fa f0 ff ff       	call   800b61 <sys_page_alloc>
+  801a67:	89 c1                	mov    %eax,%ecx
+  801a69:	83 c4 10             	add    $0x10,%esp
+  801a6c:	85 c0                	test   %eax,%eax
+  801a6e:	0f 88 91 00 00 00    	js     801b05 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801a74:	89 d8                	mov    %ebx,%eax
+  801a76:	83 c8 07             	or     $0x7,%eax
+  801a79:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801a7b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a81:	83 c6 04             	add    $0x4,%esi
+  801a84:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801a8a:	75 cb                	jne    801a57 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801a8c:	6a 12                	push   $0x12
+  801a8e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801a91:	50                   	push   %eax
+  801a92:	6a 0c                	push   $0xc
+  801a94:	ff 35 c8 70 80 00    	push   0x8070c8
+  801a9a:	e8 2f 19 00 00       	call   8033ce <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a9f:	83 c4 0c             	add    $0xc,%esp
+  801aa2:	6a 00                	push   $0x0
+  801aa4:	6a 00                	push   $0x0
+  801aa6:	6a 00                	push   $0x0
+  801aa8:	e8 cb 17 00 00       	call   803278 <ipc_recv>
+  801aad:	89 c1                	mov    %eax,%ecx
+  801aaf:	83 c4 10             	add    $0x10,%esp
+  801ab2:	85 c0                	test   %eax,%eax
+  801ab4:	78 4f                	js     801b05 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801ab6:	a1 00 50 80 00       	mov    0x805000,%eax
+  801abb:	8b 40 48             	mov    0x48(%eax),%eax
+  801abe:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801ac3:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801aca:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801acd:	83 ec 0c             	sub    $0xc,%esp
+  801ad0:	ff 37                	push   (%edi)
+  801ad2:	e8 e4 fc ff ff       	call   8017bb <devfile_sync>
+  801ad7:	89 c1                	mov    %eax,%ecx
+  801ad9:	83 c4 10             	add    $0x10,%esp
+  801adc:	85 c0                	test   %eax,%eax
+  801ade:	78 25                	js     801b05 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801ae0:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801ae6:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801aeb:	ba 01 00 00 00       	mov    $0x1,%edx
+  801af0:	89 d0                	mov    %edx,%eax
+  801af2:	d3 e0                	shl    %cl,%eax
+  801af4:	85 d8                	test   %ebx,%eax
+  801af6:	74 0d                	je     801b05 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801af8:	83 c1 01             	add    $0x1,%ecx
+  801afb:	83 f9 10             	cmp    $0x10,%ecx
+  801afe:	75 f0                	jne    801af0 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801b00:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801b05:	89 c8                	mov    %ecx,%eax
+  801b07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b0a:	5b                   	pop    %ebx
+  801b0b:	5e                   	pop    %esi
+  801b0c:	5f                   	pop    %edi
+  801b0d:	5d                   	pop    %ebp
+  801b0e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b0f:	83 ec 0c             	sub    $0xc,%esp
+  801b12:	6a 01                	push   $0x1
+  801b14:	e8 03 19 00 00       	call   80341c <ipc_find_env>
+  801b19:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801b1e:	83 c4 10             	add    $0x10,%esp
+  801b21:	e9 1e ff ff ff       	jmp    801a44 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801b26:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801b2b:	eb d8                	jmp    801b05 <fsring_slot+0x111>
+
+00801b2d <file_read_direct>:
+{
+  801b2d:	55                   	push   %ebp
+  801b2e:	89 e5                	mov    %esp,%ebp
+  801b30:	57                   	push   %edi
+  801b31:	56                   	push   %esi
+  801b32:	53                   	push   %ebx
+  801b33:	83 ec 1c             	sub    $0x1c,%esp
+  801b36:	89 c7                	mov    %eax,%edi
+  801b38:	89 d6                	mov    %edx,%esi
+  801b3a:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801b3c:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801b42:	77 52                	ja     801b96 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b44:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b47:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801b4c:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b52:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b57:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b5c:	e8 b6 fb ff ff       	call   801717 <fsipc>
+  801b61:	89 c7                	mov    %eax,%edi
+  801b63:	85 c0                	test   %eax,%eax
+  801b65:	78 25                	js     801b8c <file_read_direct+0x5f>
+	assert(r <= n);
+  801b67:	39 c3                	cmp    %eax,%ebx
+  801b69:	0f 82 87 00 00 00    	jb     801bf6 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801b6f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b74:	0f 8f 95 00 00 00    	jg     801c0f <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b7a:	83 ec 04             	sub    $0x4,%esp
+  801b7d:	50                   	push   %eax
+  801b7e:	68 00 60 80 00       	push   $0x806000
+  801b83:	56                   	push   %esi
+  801b84:	e8 52 ed ff ff       	call   8008db <memmove>
+	return r;
+  801b89:	83 c4 10             	add    $0x10,%esp
+}
+  801b8c:	89 f8                	mov    %edi,%eax
+  801b8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b91:	5b                   	pop    %ebx
+  801b92:	5e                   	pop    %esi
+  801b93:	5f                   	pop    %edi
+  801b94:	5d                   	pop    %ebp
+  801b95:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801b96:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801b9c:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801ba1:	29 d1                	sub    %edx,%ecx
+  801ba3:	39 d9                	cmp    %ebx,%ecx
+  801ba5:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801ba8:	89 f0                	mov    %esi,%eax
+  801baa:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801bad:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801bb0:	eb 0f                	jmp    801bc1 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801bb2:	0f b6 10             	movzbl (%eax),%edx
+  801bb5:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801bb7:	05 00 10 00 00       	add    $0x1000,%eax
+  801bbc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801bc1:	39 c8                	cmp    %ecx,%eax
+  801bc3:	72 ed                	jb     801bb2 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801bc5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801bc8:	8b 47 0c             	mov    0xc(%edi),%eax
+  801bcb:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801bd0:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801bd6:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801bdc:	83 ec 0c             	sub    $0xc,%esp
+  801bdf:	6a 07                	push   $0x7
+  801be1:	89 d9                	mov    %ebx,%ecx
+  801be3:	89 f2                	mov    %esi,%edx
+  801be5:	b8 09 00 00 00       	mov    $0x9,%eax
+  801bea:	e8 86 f9 ff ff       	call   801575 <fsipc_pages>
+  801bef:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801bf1:	83 c4 10             	add    $0x10,%esp
+  801bf4:	eb 96                	jmp    801b8c <file_read_direct+0x5f>
+	assert(r <= n);
+  801bf6:	68 e0 3b 80 00       	push   $0x803be0
+  801bfb:	68 c0 3b 80 00       	push   $0x803bc0
+  801c00:	68 dc 00 00 00       	push   $0xdc
+  801c05:	68 d5 3b 80 00       	push   $0x803bd5
+  801c0a:	e8 0e 13 00 00       	call   802f1d <_panic>
+	assert(r <= PGSIZE);
+  801c0f:	68 f1 3b 80 00       	push   $0x803bf1
+  801c14:	68 c0 3b 80 00       	push   $0x803bc0
+  801c19:	68 dd 00 00 00       	push   $0xdd
+  801c1e:	68 d5 3b 80 00       	push   $0x803bd5
+  801c23:	e8 f5 12 00 00       	call   802f1d <_panic>
+
+00801c28 <devfile_read>:
+{
+  801c28:	55                   	push   %ebp
+  801c29:	89 e5                	mov    %esp,%ebp
+  801c2b:	57                   	push   %edi
+  801c2c:	56                   	push   %esi
+  801c2d:	53                   	push   %ebx
+  801c2e:	83 ec 28             	sub    $0x28,%esp
+  801c31:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c34:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801c37:	53                   	push   %ebx
+  801c38:	e8 35 f3 ff ff       	call   800f72 <fd2data>
+  801c3d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801c40:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801c43:	83 c4 10             	add    $0x10,%esp
+  801c46:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801c4a:	74 7d                	je     801cc9 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801c4c:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801c50:	0f 85 81 00 00 00    	jne    801cd7 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801c56:	8b 43 18             	mov    0x18(%ebx),%eax
+  801c59:	85 c0                	test   %eax,%eax
+  801c5b:	74 0d                	je     801c6a <devfile_read+0x42>
+  801c5d:	8b 53 14             	mov    0x14(%ebx),%edx
+  801c60:	39 fa                	cmp    %edi,%edx
+  801c62:	7f 06                	jg     801c6a <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801c64:	01 c2                	add    %eax,%edx
+  801c66:	39 d7                	cmp    %edx,%edi
+  801c68:	72 28                	jb     801c92 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801c6a:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801c71:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801c77:	77 74                	ja     801ced <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801c79:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801c7e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c81:	89 d8                	mov    %ebx,%eax
+  801c83:	e8 a5 fe ff ff       	call   801b2d <file_read_direct>
+  801c88:	85 c0                	test   %eax,%eax
+  801c8a:	7e 35                	jle    801cc1 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801c8c:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801c8f:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801c92:	8b 53 14             	mov    0x14(%ebx),%edx
+  801c95:	89 d0                	mov    %edx,%eax
+  801c97:	03 43 18             	add    0x18(%ebx),%eax
+  801c9a:	29 f8                	sub    %edi,%eax
+  801c9c:	39 f0                	cmp    %esi,%eax
+  801c9e:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801ca1:	83 ec 04             	sub    $0x4,%esp
+  801ca4:	56                   	push   %esi
+  801ca5:	89 f8                	mov    %edi,%eax
+  801ca7:	29 d0                	sub    %edx,%eax
+  801ca9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801cac:	01 c1                	add    %eax,%ecx
+  801cae:	51                   	push   %ecx
+  801caf:	ff 75 0c             	push   0xc(%ebp)
+  801cb2:	e8 24 ec ff ff       	call   8008db <memmove>
+	fd->fd_offset = pos + n;
+  801cb7:	01 f7                	add    %esi,%edi
+  801cb9:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801cbc:	89 f0                	mov    %esi,%eax
+  801cbe:	83 c4 10             	add    $0x10,%esp
+}
+  801cc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cc4:	5b                   	pop    %ebx
+  801cc5:	5e                   	pop    %esi
+  801cc6:	5f                   	pop    %edi
+  801cc7:	5d                   	pop    %ebp
+  801cc8:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801cc9:	89 f1                	mov    %esi,%ecx
+  801ccb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cce:	89 d8                	mov    %ebx,%eax
+  801cd0:	e8 58 fe ff ff       	call   801b2d <file_read_direct>
+  801cd5:	eb ea                	jmp    801cc1 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801cd7:	83 ec 0c             	sub    $0xc,%esp
+  801cda:	53                   	push   %ebx
+  801cdb:	e8 db fa ff ff       	call   8017bb <devfile_sync>
+  801ce0:	83 c4 10             	add    $0x10,%esp
+  801ce3:	85 c0                	test   %eax,%eax
+  801ce5:	0f 89 6b ff ff ff    	jns    801c56 <devfile_read+0x2e>
+  801ceb:	eb d4                	jmp    801cc1 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801ced:	89 f1                	mov    %esi,%ecx
+  801cef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cf2:	89 d8                	mov    %ebx,%eax
+  801cf4:	e8 34 fe ff ff       	call   801b2d <file_read_direct>
+  801cf9:	eb c6                	jmp    801cc1 <devfile_read+0x99>
+
+00801cfb <open>:
+{
+  801cfb:	55                   	push   %ebp
+  801cfc:	89 e5                	mov    %esp,%ebp
+  801cfe:	56                   	push   %esi
+  801cff:	53                   	push   %ebx
+  801d00:	83 ec 1c             	sub    $0x1c,%esp
+  801d03:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801d06:	56                   	push   %esi
+  801d07:	e8 0e ea ff ff       	call   80071a <strlen>
+  801d0c:	83 c4 10             	add    $0x10,%esp
+  801d0f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d14:	0f 8f a0 00 00 00    	jg     801dba <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801d1a:	83 ec 0c             	sub    $0xc,%esp
+  801d1d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d20:	50                   	push   %eax
+  801d21:	e8 63 f2 ff ff       	call   800f89 <fd_alloc>
+  801d26:	89 c3                	mov    %eax,%ebx
+  801d28:	83 c4 10             	add    $0x10,%esp
+  801d2b:	85 c0                	test   %eax,%eax
+  801d2d:	78 45                	js     801d74 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801d2f:	83 ec 08             	sub    $0x8,%esp
+  801d32:	56                   	push   %esi
+  801d33:	68 00 60 80 00       	push   $0x806000
+  801d38:	e8 18 ea ff ff       	call   800755 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d3d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d40:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d45:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d48:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d4d:	e8 c5 f9 ff ff       	call   801717 <fsipc>
+  801d52:	89 c3                	mov    %eax,%ebx
+  801d54:	83 c4 10             	add    $0x10,%esp
+  801d57:	85 c0                	test   %eax,%eax
+  801d59:	78 22                	js     801d7d <open+0x82>
+	if (!(mode & O_NOBUF)
+  801d5b:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801d62:	74 2b                	je     801d8f <open+0x94>
+	return fd2num(fd);
+  801d64:	83 ec 0c             	sub    $0xc,%esp
+  801d67:	ff 75 f4             	push   -0xc(%ebp)
+  801d6a:	e8 f3 f1 ff ff       	call   800f62 <fd2num>
+  801d6f:	89 c3                	mov    %eax,%ebx
+  801d71:	83 c4 10             	add    $0x10,%esp
+}
+  801d74:	89 d8                	mov    %ebx,%eax
+  801d76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d79:	5b                   	pop    %ebx
+  801d7a:	5e                   	pop    %esi
+  801d7b:	5d                   	pop    %ebp
+  801d7c:	c3                   	ret
+		fd_close(fd, 0);
+  801d7d:	83 ec 08             	sub    $0x8,%esp
+  801d80:	6a 00                	push   $0x0
+  801d82:	ff 75 f4             	push   -0xc(%ebp)
+  801d85:	e8 f8 f2 ff ff       	call   801082 <fd_close>
+		return r;
+  801d8a:	83 c4 10             	add    $0x10,%esp
+  801d8d:	eb e5                	jmp    801d74 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801d8f:	83 ec 0c             	sub    $0xc,%esp
+  801d92:	ff 75 f4             	push   -0xc(%ebp)
+  801d95:	e8 d8 f1 ff ff       	call   800f72 <fd2data>
+  801d9a:	83 c4 0c             	add    $0xc,%esp
+  801d9d:	68 07 04 00 00       	push   $0x407
+  801da2:	50                   	push   %eax
+  801da3:	6a 00                	push   $0x0
+  801da5:	e8 b7 ed ff ff       	call   800b61 <sys_page_alloc>
+  801daa:	83 c4 10             	add    $0x10,%esp
+  801dad:	85 c0                	test   %eax,%eax
+  801daf:	75 b3                	jne    801d64 <open+0x69>
+		fd->fd_file.buffered = 1;
+  801db1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801db4:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801db8:	eb aa                	jmp    801d64 <open+0x69>
+		return -E_BAD_PATH;
+  801dba:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801dbf:	eb b3                	jmp    801d74 <open+0x79>
+
+00801dc1 <readdir>:
+{
+  801dc1:	55                   	push   %ebp
+  801dc2:	89 e5                	mov    %esp,%ebp
+  801dc4:	53                   	push   %ebx
+  801dc5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801dc8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dcb:	50                   	push   %eax
+  801dcc:	ff 75 08             	push   0x8(%ebp)
+  801dcf:	e8 0b f2 ff ff       	call   800fdf <fd_lookup>
+  801dd4:	89 c3                	mov    %eax,%ebx
+  801dd6:	83 c4 10             	add    $0x10,%esp
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	78 73                	js     801e50 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801ddd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801de0:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801de6:	39 08                	cmp    %ecx,(%eax)
+  801de8:	0f 85 82 00 00 00    	jne    801e70 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801dee:	83 ec 0c             	sub    $0xc,%esp
+  801df1:	50                   	push   %eax
+  801df2:	e8 c4 f9 ff ff       	call   8017bb <devfile_sync>
+  801df7:	89 c3                	mov    %eax,%ebx
+  801df9:	83 c4 10             	add    $0x10,%esp
+  801dfc:	85 c0                	test   %eax,%eax
+  801dfe:	78 50                	js     801e50 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801e00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e03:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e06:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801e0b:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e0e:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801e13:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e16:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801e1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e20:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e25:	e8 ed f8 ff ff       	call   801717 <fsipc>
+  801e2a:	89 c3                	mov    %eax,%ebx
+  801e2c:	85 c0                	test   %eax,%eax
+  801e2e:	7e 20                	jle    801e50 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801e30:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801e33:	72 22                	jb     801e57 <readdir+0x96>
+  801e35:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e3a:	7f 1b                	jg     801e57 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e3c:	83 ec 04             	sub    $0x4,%esp
+  801e3f:	50                   	push   %eax
+  801e40:	68 00 60 80 00       	push   $0x806000
+  801e45:	ff 75 0c             	push   0xc(%ebp)
+  801e48:	e8 8e ea ff ff       	call   8008db <memmove>
+	return r;
+  801e4d:	83 c4 10             	add    $0x10,%esp
+}
+  801e50:	89 d8                	mov    %ebx,%eax
+  801e52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e55:	c9                   	leave
+  801e56:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801e57:	68 e7 3b 80 00       	push   $0x803be7
+  801e5c:	68 c0 3b 80 00       	push   $0x803bc0
+  801e61:	68 86 01 00 00       	push   $0x186
+  801e66:	68 d5 3b 80 00       	push   $0x803bd5
+  801e6b:	e8 ad 10 00 00       	call   802f1d <_panic>
+		return -E_NOT_SUPP;
+  801e70:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801e75:	eb d9                	jmp    801e50 <readdir+0x8f>
+
+00801e77 <munmap>:
+{
+  801e77:	55                   	push   %ebp
+  801e78:	89 e5                	mov    %esp,%ebp
+  801e7a:	56                   	push   %esi
+  801e7b:	53                   	push   %ebx
+  801e7c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e7f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801e82:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801e88:	75 41                	jne    801ecb <munmap+0x54>
+  801e8a:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801e90:	77 39                	ja     801ecb <munmap+0x54>
+  801e92:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801e97:	29 f0                	sub    %esi,%eax
+  801e99:	39 d0                	cmp    %edx,%eax
+  801e9b:	72 35                	jb     801ed2 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801e9d:	89 f3                	mov    %esi,%ebx
+  801e9f:	01 d6                	add    %edx,%esi
+  801ea1:	39 f3                	cmp    %esi,%ebx
+  801ea3:	73 1a                	jae    801ebf <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801ea5:	83 ec 08             	sub    $0x8,%esp
+  801ea8:	53                   	push   %ebx
+  801ea9:	6a 00                	push   $0x0
+  801eab:	e8 3e ed ff ff       	call   800bee <sys_page_unmap>
+  801eb0:	83 c4 10             	add    $0x10,%esp
+  801eb3:	85 c0                	test   %eax,%eax
+  801eb5:	78 0d                	js     801ec4 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801eb7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ebd:	eb e2                	jmp    801ea1 <munmap+0x2a>
+	return 0;
+  801ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ec4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ec7:	5b                   	pop    %ebx
+  801ec8:	5e                   	pop    %esi
+  801ec9:	5d                   	pop    %ebp
+  801eca:	c3                   	ret
+		return -E_INVAL;
+  801ecb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ed0:	eb f2                	jmp    801ec4 <munmap+0x4d>
+  801ed2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ed7:	eb eb                	jmp    801ec4 <munmap+0x4d>
+
+00801ed9 <mmap>:
+{
+  801ed9:	55                   	push   %ebp
+  801eda:	89 e5                	mov    %esp,%ebp
+  801edc:	57                   	push   %edi
+  801edd:	56                   	push   %esi
+  801ede:	53                   	push   %ebx
+  801edf:	83 ec 34             	sub    $0x34,%esp
+  801ee2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ee5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ee8:	50                   	push   %eax
+  801ee9:	ff 75 18             	push   0x18(%ebp)
+  801eec:	e8 ee f0 ff ff       	call   800fdf <fd_lookup>
+  801ef1:	89 c3                	mov    %eax,%ebx
+  801ef3:	83 c4 10             	add    $0x10,%esp
+  801ef6:	85 c0                	test   %eax,%eax
+  801ef8:	0f 88 0e 01 00 00    	js     80200c <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801efe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f01:	a1 20 40 80 00       	mov    0x804020,%eax
+  801f06:	39 02                	cmp    %eax,(%edx)
+  801f08:	0f 85 50 01 00 00    	jne    80205e <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801f0e:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f11:	83 e0 02             	and    $0x2,%eax
+  801f14:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f17:	74 0a                	je     801f23 <mmap+0x4a>
+  801f19:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801f1d:	0f 84 42 01 00 00    	je     802065 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801f23:	8b 42 08             	mov    0x8(%edx),%eax
+  801f26:	83 e0 03             	and    $0x3,%eax
+  801f29:	83 f8 01             	cmp    $0x1,%eax
+  801f2c:	0f 84 3a 01 00 00    	je     80206c <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  801f32:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f35:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801f38:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f3d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801f40:	0f 85 2d 01 00 00    	jne    802073 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801f46:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801f4a:	0f 88 2a 01 00 00    	js     80207a <mmap+0x1a1>
+  801f50:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  801f57:	0f 87 1d 01 00 00    	ja     80207a <mmap+0x1a1>
+  801f5d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f62:	2b 45 08             	sub    0x8(%ebp),%eax
+  801f65:	39 f8                	cmp    %edi,%eax
+  801f67:	0f 82 14 01 00 00    	jb     802081 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  801f6d:	83 ec 0c             	sub    $0xc,%esp
+  801f70:	52                   	push   %edx
+  801f71:	e8 45 f8 ff ff       	call   8017bb <devfile_sync>
+  801f76:	89 c3                	mov    %eax,%ebx
+  801f78:	83 c4 10             	add    $0x10,%esp
+  801f7b:	85 c0                	test   %eax,%eax
+  801f7d:	0f 88 89 00 00 00    	js     80200c <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  801f83:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  801f89:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801f8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801f94:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  801f97:	39 fe                	cmp    %edi,%esi
+  801f99:	73 7b                	jae    802016 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  801f9b:	89 f8                	mov    %edi,%eax
+  801f9d:	29 f0                	sub    %esi,%eax
+  801f9f:	c1 e8 0c             	shr    $0xc,%eax
+  801fa2:	ba 40 00 00 00       	mov    $0x40,%edx
+  801fa7:	39 d0                	cmp    %edx,%eax
+  801fa9:	0f 47 c2             	cmova  %edx,%eax
+  801fac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801faf:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fb2:	8b 52 0c             	mov    0xc(%edx),%edx
+  801fb5:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  801fbb:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  801fbe:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  801fc4:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  801fc9:	89 f2                	mov    %esi,%edx
+  801fcb:	03 55 08             	add    0x8(%ebp),%edx
+  801fce:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  801fd1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801fd6:	e8 ea f6 ff ff       	call   8016c5 <fsipcv>
+  801fdb:	85 c0                	test   %eax,%eax
+  801fdd:	7e 12                	jle    801ff1 <mmap+0x118>
+  801fdf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801fe2:	85 c0                	test   %eax,%eax
+  801fe4:	0f 84 9e 00 00 00    	je     802088 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801fea:	c1 e0 0c             	shl    $0xc,%eax
+  801fed:	01 c6                	add    %eax,%esi
+  801fef:	eb a6                	jmp    801f97 <mmap+0xbe>
+			munmap(addr, done);
+  801ff1:	89 c3                	mov    %eax,%ebx
+  801ff3:	83 ec 08             	sub    $0x8,%esp
+  801ff6:	56                   	push   %esi
+  801ff7:	ff 75 08             	push   0x8(%ebp)
+  801ffa:	e8 78 fe ff ff       	call   801e77 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  801fff:	83 c4 10             	add    $0x10,%esp
+  802002:	85 db                	test   %ebx,%ebx
+  802004:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802009:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80200c:	89 d8                	mov    %ebx,%eax
+  80200e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802011:	5b                   	pop    %ebx
+  802012:	5e                   	pop    %esi
+  802013:	5f                   	pop    %edi
+  802014:	5d                   	pop    %ebp
+  802015:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802016:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802019:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80201b:	85 c0                	test   %eax,%eax
+  80201d:	74 ed                	je     80200c <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80201f:	be 00 00 00 00       	mov    $0x0,%esi
+  802024:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802027:	39 fe                	cmp    %edi,%esi
+  802029:	73 2e                	jae    802059 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80202b:	83 ec 0c             	sub    $0xc,%esp
+  80202e:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802031:	50                   	push   %eax
+  802032:	e8 43 10 00 00       	call   80307a <cowpage>
+  802037:	83 c4 10             	add    $0x10,%esp
+  80203a:	85 c0                	test   %eax,%eax
+  80203c:	78 08                	js     802046 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  80203e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802044:	eb e1                	jmp    802027 <mmap+0x14e>
+				munmap(addr, len);
+  802046:	89 c3                	mov    %eax,%ebx
+  802048:	83 ec 08             	sub    $0x8,%esp
+  80204b:	57                   	push   %edi
+  80204c:	ff 75 08             	push   0x8(%ebp)
+  80204f:	e8 23 fe ff ff       	call   801e77 <munmap>
+				return r;
+  802054:	83 c4 10             	add    $0x10,%esp
+  802057:	eb b3                	jmp    80200c <mmap+0x133>
+	return 0;
+  802059:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80205c:	eb ae                	jmp    80200c <mmap+0x133>
+		return -E_NOT_SUPP;
+  80205e:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802063:	eb a7                	jmp    80200c <mmap+0x133>
+		return -E_NOT_SUPP;
+  802065:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80206a:	eb a0                	jmp    80200c <mmap+0x133>
+		return -E_INVAL;
+  80206c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802071:	eb 99                	jmp    80200c <mmap+0x133>
+  802073:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802078:	eb 92                	jmp    80200c <mmap+0x133>
+  80207a:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80207f:	eb 8b                	jmp    80200c <mmap+0x133>
+  802081:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802086:	eb 84                	jmp    80200c <mmap+0x133>
+			munmap(addr, done);
+  802088:	83 ec 08             	sub    $0x8,%esp
+  80208b:	56                   	push   %esi
+  80208c:	ff 75 08             	push   0x8(%ebp)
+  80208f:	e8 e3 fd ff ff       	call   801e77 <munmap>
+  802094:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802097:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80209c:	e9 6b ff ff ff       	jmp    80200c <mmap+0x133>
+
+008020a1 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8020a1:	55                   	push   %ebp
+  8020a2:	89 e5                	mov    %esp,%ebp
+  8020a4:	56                   	push   %esi
+  8020a5:	53                   	push   %ebx
+  8020a6:	83 ec 10             	sub    $0x10,%esp
+  8020a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8020ac:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8020af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020b2:	e8 3d f9 ff ff       	call   8019f4 <fsring_slot>
+  8020b7:	85 c0                	test   %eax,%eax
+  8020b9:	78 60                	js     80211b <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8020bb:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8020be:	8b 56 08             	mov    0x8(%esi),%edx
+  8020c1:	83 e2 03             	and    $0x3,%edx
+  8020c4:	83 fa 01             	cmp    $0x1,%edx
+  8020c7:	74 59                	je     802122 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8020c9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8020ce:	89 c1                	mov    %eax,%ecx
+  8020d0:	d3 e2                	shl    %cl,%edx
+  8020d2:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8020d8:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8020db:	c1 e2 02             	shl    $0x2,%edx
+  8020de:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8020e4:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  8020eb:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8020ee:	8b 55 18             	mov    0x18(%ebp),%edx
+  8020f1:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8020f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020f7:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8020fa:	83 ec 08             	sub    $0x8,%esp
+  8020fd:	50                   	push   %eax
+  8020fe:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802103:	39 c3                	cmp    %eax,%ebx
+  802105:	0f 47 d8             	cmova  %eax,%ebx
+  802108:	53                   	push   %ebx
+  802109:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80210c:	89 f2                	mov    %esi,%edx
+  80210e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802113:	e8 1e f5 ff ff       	call   801636 <fsring_post>
+  802118:	83 c4 10             	add    $0x10,%esp
+}
+  80211b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80211e:	5b                   	pop    %ebx
+  80211f:	5e                   	pop    %esi
+  802120:	5d                   	pop    %ebp
+  802121:	c3                   	ret
+		return -E_INVAL;
+  802122:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802127:	eb f2                	jmp    80211b <fsring_read+0x7a>
+
+00802129 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802129:	55                   	push   %ebp
+  80212a:	89 e5                	mov    %esp,%ebp
+  80212c:	56                   	push   %esi
+  80212d:	53                   	push   %ebx
+  80212e:	83 ec 10             	sub    $0x10,%esp
+  802131:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802134:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802137:	8b 45 08             	mov    0x8(%ebp),%eax
+  80213a:	e8 b5 f8 ff ff       	call   8019f4 <fsring_slot>
+  80213f:	89 c3                	mov    %eax,%ebx
+  802141:	85 c0                	test   %eax,%eax
+  802143:	78 77                	js     8021bc <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802145:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802148:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80214c:	74 77                	je     8021c5 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80214e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802153:	39 c6                	cmp    %eax,%esi
+  802155:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802158:	83 ec 04             	sub    $0x4,%esp
+  80215b:	56                   	push   %esi
+  80215c:	ff 75 0c             	push   0xc(%ebp)
+  80215f:	89 d8                	mov    %ebx,%eax
+  802161:	c1 e0 0c             	shl    $0xc,%eax
+  802164:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80216a:	50                   	push   %eax
+  80216b:	e8 6b e7 ff ff       	call   8008db <memmove>
+	fsring_busy |= 1 << slot;
+  802170:	b8 01 00 00 00       	mov    $0x1,%eax
+  802175:	89 d9                	mov    %ebx,%ecx
+  802177:	d3 e0                	shl    %cl,%eax
+  802179:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  80217f:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802182:	c1 e0 02             	shl    $0x2,%eax
+  802185:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  80218b:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  802192:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802195:	8b 45 18             	mov    0x18(%ebp),%eax
+  802198:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80219b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8021a2:	83 c4 08             	add    $0x8,%esp
+  8021a5:	53                   	push   %ebx
+  8021a6:	56                   	push   %esi
+  8021a7:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8021aa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021ad:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021b2:	e8 7f f4 ff ff       	call   801636 <fsring_post>
+  8021b7:	89 c3                	mov    %eax,%ebx
+  8021b9:	83 c4 10             	add    $0x10,%esp
+}
+  8021bc:	89 d8                	mov    %ebx,%eax
+  8021be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021c1:	5b                   	pop    %ebx
+  8021c2:	5e                   	pop    %esi
+  8021c3:	5d                   	pop    %ebp
+  8021c4:	c3                   	ret
+		return -E_INVAL;
+  8021c5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021ca:	eb f0                	jmp    8021bc <fsring_write+0x93>
+
+008021cc <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8021cc:	55                   	push   %ebp
+  8021cd:	89 e5                	mov    %esp,%ebp
+  8021cf:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8021d2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d8:	e8 17 f8 ff ff       	call   8019f4 <fsring_slot>
+  8021dd:	85 c0                	test   %eax,%eax
+  8021df:	78 4c                	js     80222d <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8021e1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8021e6:	89 c1                	mov    %eax,%ecx
+  8021e8:	d3 e2                	shl    %cl,%edx
+  8021ea:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8021f0:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8021f3:	c1 e2 02             	shl    $0x2,%edx
+  8021f6:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8021fc:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  802203:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802206:	8b 55 10             	mov    0x10(%ebp),%edx
+  802209:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80220c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80220f:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802212:	83 ec 08             	sub    $0x8,%esp
+  802215:	50                   	push   %eax
+  802216:	6a 00                	push   $0x0
+  802218:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80221d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802220:	b8 05 00 00 00       	mov    $0x5,%eax
+  802225:	e8 0c f4 ff ff       	call   801636 <fsring_post>
+  80222a:	83 c4 10             	add    $0x10,%esp
+}
+  80222d:	c9                   	leave
+  80222e:	c3                   	ret
+
+0080222f <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  80222f:	55                   	push   %ebp
+  802230:	89 e5                	mov    %esp,%ebp
+  802232:	57                   	push   %edi
+  802233:	56                   	push   %esi
+  802234:	53                   	push   %ebx
+  802235:	83 ec 1c             	sub    $0x1c,%esp
+  802238:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80223c:	a1 00 50 80 00       	mov    0x805000,%eax
+  802241:	8b 40 48             	mov    0x48(%eax),%eax
+  802244:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  80224a:	74 12                	je     80225e <fsring_reap+0x2f>
+		return 0;
+  80224c:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802251:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802254:	5b                   	pop    %ebx
+  802255:	5e                   	pop    %esi
+  802256:	5f                   	pop    %edi
+  802257:	5d                   	pop    %ebp
+  802258:	c3                   	ret
+		sys_yield();
+  802259:	e8 e4 e8 ff ff       	call   800b42 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  80225e:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802264:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802269:	39 c2                	cmp    %eax,%edx
+  80226b:	75 18                	jne    802285 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  80226d:	84 db                	test   %bl,%bl
+  80226f:	0f 84 21 01 00 00    	je     802396 <fsring_reap+0x167>
+  802275:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  80227c:	75 db                	jne    802259 <fsring_reap+0x2a>
+			return 0;
+  80227e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802283:	eb cc                	jmp    802251 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802285:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80228a:	83 e0 0f             	and    $0xf,%eax
+  80228d:	83 c0 2a             	add    $0x2a,%eax
+  802290:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802297:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  80229e:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8022a3:	83 c0 01             	add    $0x1,%eax
+  8022a6:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8022ab:	83 fb 0f             	cmp    $0xf,%ebx
+  8022ae:	77 5b                	ja     80230b <fsring_reap+0xdc>
+  8022b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8022b5:	89 d9                	mov    %ebx,%ecx
+  8022b7:	d3 e6                	shl    %cl,%esi
+  8022b9:	89 f0                	mov    %esi,%eax
+  8022bb:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8022c1:	74 48                	je     80230b <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8022c3:	89 d8                	mov    %ebx,%eax
+  8022c5:	c1 e0 0c             	shl    $0xc,%eax
+  8022c8:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8022ce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8022d1:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8022d4:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  8022db:	83 f8 03             	cmp    $0x3,%eax
+  8022de:	74 40                	je     802320 <fsring_reap+0xf1>
+  8022e0:	83 f8 05             	cmp    $0x5,%eax
+  8022e3:	74 64                	je     802349 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8022e5:	f7 d6                	not    %esi
+  8022e7:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8022ed:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8022f0:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  8022f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022fa:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8022fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022ff:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802301:	b8 01 00 00 00       	mov    $0x1,%eax
+  802306:	e9 46 ff ff ff       	jmp    802251 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80230b:	53                   	push   %ebx
+  80230c:	68 fd 3b 80 00       	push   $0x803bfd
+  802311:	68 8f 02 00 00       	push   $0x28f
+  802316:	68 d5 3b 80 00       	push   $0x803bd5
+  80231b:	e8 fd 0b 00 00       	call   802f1d <_panic>
+		if (cqe.cqe_result > 0)
+  802320:	85 ff                	test   %edi,%edi
+  802322:	7e c1                	jle    8022e5 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802324:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802327:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80232c:	39 c7                	cmp    %eax,%edi
+  80232e:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802331:	50                   	push   %eax
+  802332:	ff 75 e4             	push   -0x1c(%ebp)
+  802335:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802338:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  80233f:	e8 97 e5 ff ff       	call   8008db <memmove>
+  802344:	83 c4 10             	add    $0x10,%esp
+  802347:	eb 9c                	jmp    8022e5 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802349:	85 ff                	test   %edi,%edi
+  80234b:	75 98                	jne    8022e5 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80234d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802350:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802357:	83 ec 08             	sub    $0x8,%esp
+  80235a:	ff 75 e4             	push   -0x1c(%ebp)
+  80235d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802360:	51                   	push   %ecx
+  802361:	e8 ef e3 ff ff       	call   800755 <strcpy>
+			st->st_size = ret->ret_size;
+  802366:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802369:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  80236f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802372:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802378:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  80237e:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802384:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  80238b:	40 80 00 
+  80238e:	83 c4 10             	add    $0x10,%esp
+  802391:	e9 4f ff ff ff       	jmp    8022e5 <fsring_reap+0xb6>
+			return 0;
+  802396:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239b:	e9 b1 fe ff ff       	jmp    802251 <fsring_reap+0x22>
+
+008023a0 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8023a0:	55                   	push   %ebp
+  8023a1:	89 e5                	mov    %esp,%ebp
+  8023a3:	57                   	push   %edi
+  8023a4:	56                   	push   %esi
+  8023a5:	53                   	push   %ebx
+  8023a6:	83 ec 28             	sub    $0x28,%esp
+  8023a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8023ac:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8023af:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8023b2:	53                   	push   %ebx
+  8023b3:	e8 62 e3 ff ff       	call   80071a <strlen>
+  8023b8:	83 c4 10             	add    $0x10,%esp
+  8023bb:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8023c0:	0f 8f 02 01 00 00    	jg     8024c8 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8023c6:	83 ec 08             	sub    $0x8,%esp
+  8023c9:	53                   	push   %ebx
+  8023ca:	68 00 60 80 00       	push   $0x806000
+  8023cf:	e8 81 e3 ff ff       	call   800755 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8023d4:	83 c4 10             	add    $0x10,%esp
+  8023d7:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8023dd:	76 69                	jbe    802448 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8023df:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023e2:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8023e8:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8023ed:	29 d1                	sub    %edx,%ecx
+  8023ef:	39 f9                	cmp    %edi,%ecx
+  8023f1:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8023f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023f7:	89 f9                	mov    %edi,%ecx
+  8023f9:	01 c1                	add    %eax,%ecx
+  8023fb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8023fe:	eb 0f                	jmp    80240f <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802400:	0f b6 10             	movzbl (%eax),%edx
+  802403:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802405:	05 00 10 00 00       	add    $0x1000,%eax
+  80240a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80240f:	39 c8                	cmp    %ecx,%eax
+  802411:	72 ed                	jb     802400 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802413:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802416:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  80241c:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802422:	83 ec 0c             	sub    $0xc,%esp
+  802425:	6a 07                	push   $0x7
+  802427:	89 f9                	mov    %edi,%ecx
+  802429:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80242c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802431:	e8 3f f1 ff ff       	call   801575 <fsipc_pages>
+  802436:	89 c7                	mov    %eax,%edi
+  802438:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  80243b:	85 f6                	test   %esi,%esi
+  80243d:	74 7f                	je     8024be <file_slurp+0x11e>
+  80243f:	8d 43 01             	lea    0x1(%ebx),%eax
+  802442:	85 ff                	test   %edi,%edi
+  802444:	79 3c                	jns    802482 <file_slurp+0xe2>
+  802446:	eb 76                	jmp    8024be <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802448:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  80244e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802453:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802458:	e8 ba f2 ff ff       	call   801717 <fsipc>
+  80245d:	89 c7                	mov    %eax,%edi
+  80245f:	85 c0                	test   %eax,%eax
+  802461:	7e d8                	jle    80243b <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802463:	83 ec 04             	sub    $0x4,%esp
+  802466:	50                   	push   %eax
+  802467:	68 08 60 80 00       	push   $0x806008
+  80246c:	ff 75 0c             	push   0xc(%ebp)
+  80246f:	e8 67 e4 ff ff       	call   8008db <memmove>
+  802474:	83 c4 10             	add    $0x10,%esp
+  802477:	eb c2                	jmp    80243b <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802479:	80 fa 2f             	cmp    $0x2f,%dl
+  80247c:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  80247f:	83 c0 01             	add    $0x1,%eax
+  802482:	89 c1                	mov    %eax,%ecx
+  802484:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802488:	84 d2                	test   %dl,%dl
+  80248a:	75 ed                	jne    802479 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  80248c:	83 ec 04             	sub    $0x4,%esp
+  80248f:	68 80 00 00 00       	push   $0x80
+  802494:	53                   	push   %ebx
+  802495:	56                   	push   %esi
+  802496:	e8 30 e3 ff ff       	call   8007cb <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  80249b:	a1 00 60 80 00       	mov    0x806000,%eax
+  8024a0:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8024a6:	a1 04 60 80 00       	mov    0x806004,%eax
+  8024ab:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8024b1:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  8024b8:	40 80 00 
+  8024bb:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8024be:	89 f8                	mov    %edi,%eax
+  8024c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024c3:	5b                   	pop    %ebx
+  8024c4:	5e                   	pop    %esi
+  8024c5:	5f                   	pop    %edi
+  8024c6:	5d                   	pop    %ebp
+  8024c7:	c3                   	ret
+		return -E_BAD_PATH;
+  8024c8:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8024cd:	eb ef                	jmp    8024be <file_slurp+0x11e>
+
+008024cf <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8024cf:	55                   	push   %ebp
+  8024d0:	89 e5                	mov    %esp,%ebp
+  8024d2:	53                   	push   %ebx
+  8024d3:	83 ec 10             	sub    $0x10,%esp
+  8024d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8024d9:	53                   	push   %ebx
+  8024da:	e8 3b e2 ff ff       	call   80071a <strlen>
+  8024df:	83 c4 10             	add    $0x10,%esp
+  8024e2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024e7:	7f 25                	jg     80250e <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8024e9:	83 ec 08             	sub    $0x8,%esp
+  8024ec:	53                   	push   %ebx
+  8024ed:	68 00 60 80 00       	push   $0x806000
+  8024f2:	e8 5e e2 ff ff       	call   800755 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8024f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024fc:	b8 07 00 00 00       	mov    $0x7,%eax
+  802501:	e8 11 f2 ff ff       	call   801717 <fsipc>
+  802506:	83 c4 10             	add    $0x10,%esp
+}
+  802509:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80250c:	c9                   	leave
+  80250d:	c3                   	ret
+		return -E_BAD_PATH;
+  80250e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802513:	eb f4                	jmp    802509 <remove+0x3a>
+
+00802515 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802515:	55                   	push   %ebp
+  802516:	89 e5                	mov    %esp,%ebp
+  802518:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80251b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802520:	b8 08 00 00 00       	mov    $0x8,%eax
+  802525:	e8 ed f1 ff ff       	call   801717 <fsipc>
+}
+  80252a:	c9                   	leave
+  80252b:	c3                   	ret
+
+0080252c <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  80252c:	55                   	push   %ebp
+  80252d:	89 e5                	mov    %esp,%ebp
+  80252f:	57                   	push   %edi
+  802530:	56                   	push   %esi
+  802531:	53                   	push   %ebx
+  802532:	83 ec 18             	sub    $0x18,%esp
+  802535:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802538:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80253b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80253e:	57                   	push   %edi
+  80253f:	e8 d6 e1 ff ff       	call   80071a <strlen>
+  802544:	83 c4 10             	add    $0x10,%esp
+  802547:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80254c:	7f 4c                	jg     80259a <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  80254e:	83 ec 08             	sub    $0x8,%esp
+  802551:	57                   	push   %edi
+  802552:	68 00 60 80 00       	push   $0x806000
+  802557:	e8 f9 e1 ff ff       	call   800755 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  80255c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802561:	b8 10 00 00 00       	mov    $0x10,%eax
+  802566:	e8 ac f1 ff ff       	call   801717 <fsipc>
+  80256b:	83 c4 10             	add    $0x10,%esp
+  80256e:	85 c0                	test   %eax,%eax
+  802570:	78 20                	js     802592 <defrag+0x66>
+		return r;
+	if (before)
+  802572:	85 f6                	test   %esi,%esi
+  802574:	74 07                	je     80257d <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802576:	a1 00 60 80 00       	mov    0x806000,%eax
+  80257b:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  80257d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802582:	85 db                	test   %ebx,%ebx
+  802584:	74 0c                	je     802592 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802586:	a1 04 60 80 00       	mov    0x806004,%eax
+  80258b:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  80258d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802592:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802595:	5b                   	pop    %ebx
+  802596:	5e                   	pop    %esi
+  802597:	5f                   	pop    %edi
+  802598:	5d                   	pop    %ebp
+  802599:	c3                   	ret
+		return -E_BAD_PATH;
+  80259a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80259f:	eb f1                	jmp    802592 <defrag+0x66>
+
+008025a1 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  8025a1:	55                   	push   %ebp
+  8025a2:	89 e5                	mov    %esp,%ebp
+  8025a4:	53                   	push   %ebx
+  8025a5:	83 ec 04             	sub    $0x4,%esp
+  8025a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  8025ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025b0:	b8 11 00 00 00       	mov    $0x11,%eax
+  8025b5:	e8 5d f1 ff ff       	call   801717 <fsipc>
+  8025ba:	85 c0                	test   %eax,%eax
+  8025bc:	78 34                	js     8025f2 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  8025be:	a1 00 60 80 00       	mov    0x806000,%eax
+  8025c3:	89 03                	mov    %eax,(%ebx)
+  8025c5:	a1 04 60 80 00       	mov    0x806004,%eax
+  8025ca:	89 43 04             	mov    %eax,0x4(%ebx)
+  8025cd:	a1 08 60 80 00       	mov    0x806008,%eax
+  8025d2:	89 43 08             	mov    %eax,0x8(%ebx)
+  8025d5:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  8025da:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8025dd:	a1 10 60 80 00       	mov    0x806010,%eax
+  8025e2:	89 43 10             	mov    %eax,0x10(%ebx)
+  8025e5:	a1 14 60 80 00       	mov    0x806014,%eax
+  8025ea:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  8025ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025f5:	c9                   	leave
+  8025f6:	c3                   	ret
+
+008025f7 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8025f7:	55                   	push   %ebp
+  8025f8:	89 e5                	mov    %esp,%ebp
+  8025fa:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8025fd:	68 16 3c 80 00       	push   $0x803c16
+  802602:	ff 75 0c             	push   0xc(%ebp)
+  802605:	e8 4b e1 ff ff       	call   800755 <strcpy>
+	return 0;
+}
+  80260a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80260f:	c9                   	leave
+  802610:	c3                   	ret
+
+00802611 <devsock_close>:
+{
+  802611:	55                   	push   %ebp
+  802612:	89 e5                	mov    %esp,%ebp
+  802614:	53                   	push   %ebx
+  802615:	83 ec 10             	sub    $0x10,%esp
+  802618:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80261b:	53                   	push   %ebx
+  80261c:	e8 3a 0e 00 00       	call   80345b <pageref>
+  802621:	89 c2                	mov    %eax,%edx
+  802623:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802626:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80262b:	83 fa 01             	cmp    $0x1,%edx
+  80262e:	74 05                	je     802635 <devsock_close+0x24>
+}
+  802630:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802633:	c9                   	leave
+  802634:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802635:	83 ec 0c             	sub    $0xc,%esp
+  802638:	ff 73 0c             	push   0xc(%ebx)
+  80263b:	e8 b7 02 00 00       	call   8028f7 <nsipc_close>
+  802640:	83 c4 10             	add    $0x10,%esp
+  802643:	eb eb                	jmp    802630 <devsock_close+0x1f>
+
+00802645 <devsock_write>:
+{
+  802645:	55                   	push   %ebp
+  802646:	89 e5                	mov    %esp,%ebp
+  802648:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80264b:	6a 00                	push   $0x0
+  80264d:	ff 75 10             	push   0x10(%ebp)
+  802650:	ff 75 0c             	push   0xc(%ebp)
+  802653:	8b 45 08             	mov    0x8(%ebp),%eax
+  802656:	ff 70 0c             	push   0xc(%eax)
+  802659:	e8 79 03 00 00       	call   8029d7 <nsipc_send>
+}
+  80265e:	c9                   	leave
+  80265f:	c3                   	ret
+
+00802660 <devsock_read>:
+{
+  802660:	55                   	push   %ebp
+  802661:	89 e5                	mov    %esp,%ebp
+  802663:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802666:	6a 00                	push   $0x0
+  802668:	ff 75 10             	push   0x10(%ebp)
+  80266b:	ff 75 0c             	push   0xc(%ebp)
+  80266e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802671:	ff 70 0c             	push   0xc(%eax)
+  802674:	e8 ef 02 00 00       	call   802968 <nsipc_recv>
+}
+  802679:	c9                   	leave
+  80267a:	c3                   	ret
+
+0080267b <fd2sockid>:
+{
+  80267b:	55                   	push   %ebp
+  80267c:	89 e5                	mov    %esp,%ebp
+  80267e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802681:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802684:	52                   	push   %edx
+  802685:	50                   	push   %eax
+  802686:	e8 54 e9 ff ff       	call   800fdf <fd_lookup>
+  80268b:	83 c4 10             	add    $0x10,%esp
+  80268e:	85 c0                	test   %eax,%eax
+  802690:	78 10                	js     8026a2 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802692:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802695:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  80269b:	39 08                	cmp    %ecx,(%eax)
+  80269d:	75 05                	jne    8026a4 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80269f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8026a2:	c9                   	leave
+  8026a3:	c3                   	ret
+		return -E_NOT_SUPP;
+  8026a4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026a9:	eb f7                	jmp    8026a2 <fd2sockid+0x27>
+
+008026ab <alloc_sockfd>:
+{
+  8026ab:	55                   	push   %ebp
+  8026ac:	89 e5                	mov    %esp,%ebp
+  8026ae:	56                   	push   %esi
+  8026af:	53                   	push   %ebx
+  8026b0:	83 ec 1c             	sub    $0x1c,%esp
+  8026b3:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8026b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026b8:	50                   	push   %eax
+  8026b9:	e8 cb e8 ff ff       	call   800f89 <fd_alloc>
+  8026be:	89 c3                	mov    %eax,%ebx
+  8026c0:	83 c4 10             	add    $0x10,%esp
+  8026c3:	85 c0                	test   %eax,%eax
+  8026c5:	78 43                	js     80270a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8026c7:	83 ec 04             	sub    $0x4,%esp
+  8026ca:	68 07 04 00 00       	push   $0x407
+  8026cf:	ff 75 f4             	push   -0xc(%ebp)
+  8026d2:	6a 00                	push   $0x0
+  8026d4:	e8 88 e4 ff ff       	call   800b61 <sys_page_alloc>
+  8026d9:	89 c3                	mov    %eax,%ebx
+  8026db:	83 c4 10             	add    $0x10,%esp
+  8026de:	85 c0                	test   %eax,%eax
+  8026e0:	78 28                	js     80270a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8026e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026e5:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  8026eb:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8026ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026f0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8026f7:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8026fa:	83 ec 0c             	sub    $0xc,%esp
+  8026fd:	50                   	push   %eax
+  8026fe:	e8 5f e8 ff ff       	call   800f62 <fd2num>
+  802703:	89 c3                	mov    %eax,%ebx
+  802705:	83 c4 10             	add    $0x10,%esp
+  802708:	eb 0c                	jmp    802716 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80270a:	83 ec 0c             	sub    $0xc,%esp
+  80270d:	56                   	push   %esi
+  80270e:	e8 e4 01 00 00       	call   8028f7 <nsipc_close>
+		return r;
+  802713:	83 c4 10             	add    $0x10,%esp
+}
+  802716:	89 d8                	mov    %ebx,%eax
+  802718:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80271b:	5b                   	pop    %ebx
+  80271c:	5e                   	pop    %esi
+  80271d:	5d                   	pop    %ebp
+  80271e:	c3                   	ret
+
+0080271f <accept>:
+{
+  80271f:	55                   	push   %ebp
+  802720:	89 e5                	mov    %esp,%ebp
+  802722:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802725:	8b 45 08             	mov    0x8(%ebp),%eax
+  802728:	e8 4e ff ff ff       	call   80267b <fd2sockid>
+  80272d:	85 c0                	test   %eax,%eax
+  80272f:	78 1b                	js     80274c <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802731:	83 ec 04             	sub    $0x4,%esp
+  802734:	ff 75 10             	push   0x10(%ebp)
+  802737:	ff 75 0c             	push   0xc(%ebp)
+  80273a:	50                   	push   %eax
+  80273b:	e8 0e 01 00 00       	call   80284e <nsipc_accept>
+  802740:	83 c4 10             	add    $0x10,%esp
+  802743:	85 c0                	test   %eax,%eax
+  802745:	78 05                	js     80274c <accept+0x2d>
+	return alloc_sockfd(r);
+  802747:	e8 5f ff ff ff       	call   8026ab <alloc_sockfd>
+}
+  80274c:	c9                   	leave
+  80274d:	c3                   	ret
+
+0080274e <bind>:
+{
+  80274e:	55                   	push   %ebp
+  80274f:	89 e5                	mov    %esp,%ebp
+  802751:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802754:	8b 45 08             	mov    0x8(%ebp),%eax
+  802757:	e8 1f ff ff ff       	call   80267b <fd2sockid>
+  80275c:	85 c0                	test   %eax,%eax
+  80275e:	78 12                	js     802772 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802760:	83 ec 04             	sub    $0x4,%esp
+  802763:	ff 75 10             	push   0x10(%ebp)
+  802766:	ff 75 0c             	push   0xc(%ebp)
+  802769:	50                   	push   %eax
+  80276a:	e8 31 01 00 00       	call   8028a0 <nsipc_bind>
+  80276f:	83 c4 10             	add    $0x10,%esp
+}
+  802772:	c9                   	leave
+  802773:	c3                   	ret
+
+00802774 <shutdown>:
+{
+  802774:	55                   	push   %ebp
+  802775:	89 e5                	mov    %esp,%ebp
+  802777:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80277a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277d:	e8 f9 fe ff ff       	call   80267b <fd2sockid>
+  802782:	85 c0                	test   %eax,%eax
+  802784:	78 0f                	js     802795 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802786:	83 ec 08             	sub    $0x8,%esp
+  802789:	ff 75 0c             	push   0xc(%ebp)
+  80278c:	50                   	push   %eax
+  80278d:	e8 43 01 00 00       	call   8028d5 <nsipc_shutdown>
+  802792:	83 c4 10             	add    $0x10,%esp
+}
+  802795:	c9                   	leave
+  802796:	c3                   	ret
+
+00802797 <connect>:
+{
+  802797:	55                   	push   %ebp
+  802798:	89 e5                	mov    %esp,%ebp
+  80279a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80279d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027a0:	e8 d6 fe ff ff       	call   80267b <fd2sockid>
+  8027a5:	85 c0                	test   %eax,%eax
+  8027a7:	78 12                	js     8027bb <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8027a9:	83 ec 04             	sub    $0x4,%esp
+  8027ac:	ff 75 10             	push   0x10(%ebp)
+  8027af:	ff 75 0c             	push   0xc(%ebp)
+  8027b2:	50                   	push   %eax
+  8027b3:	e8 59 01 00 00       	call   802911 <nsipc_connect>
+  8027b8:	83 c4 10             	add    $0x10,%esp
+}
+  8027bb:	c9                   	leave
+  8027bc:	c3                   	ret
+
+008027bd <listen>:
+{
+  8027bd:	55                   	push   %ebp
+  8027be:	89 e5                	mov    %esp,%ebp
+  8027c0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027c6:	e8 b0 fe ff ff       	call   80267b <fd2sockid>
+  8027cb:	85 c0                	test   %eax,%eax
+  8027cd:	78 0f                	js     8027de <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8027cf:	83 ec 08             	sub    $0x8,%esp
+  8027d2:	ff 75 0c             	push   0xc(%ebp)
+  8027d5:	50                   	push   %eax
+  8027d6:	e8 6b 01 00 00       	call   802946 <nsipc_listen>
+  8027db:	83 c4 10             	add    $0x10,%esp
+}
+  8027de:	c9                   	leave
+  8027df:	c3                   	ret
+
+008027e0 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8027e0:	55                   	push   %ebp
+  8027e1:	89 e5                	mov    %esp,%ebp
+  8027e3:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8027e6:	ff 75 10             	push   0x10(%ebp)
+  8027e9:	ff 75 0c             	push   0xc(%ebp)
+  8027ec:	ff 75 08             	push   0x8(%ebp)
+  8027ef:	e8 41 02 00 00       	call   802a35 <nsipc_socket>
+  8027f4:	83 c4 10             	add    $0x10,%esp
+  8027f7:	85 c0                	test   %eax,%eax
+  8027f9:	78 05                	js     802800 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8027fb:	e8 ab fe ff ff       	call   8026ab <alloc_sockfd>
+}
+  802800:	c9                   	leave
+  802801:	c3                   	ret
+
+00802802 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802802:	55                   	push   %ebp
+  802803:	89 e5                	mov    %esp,%ebp
+  802805:	53                   	push   %ebx
+  802806:	83 ec 04             	sub    $0x4,%esp
+  802809:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80280b:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802812:	74 26                	je     80283a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802814:	6a 07                	push   $0x7
+  802816:	68 00 80 80 00       	push   $0x808000
+  80281b:	53                   	push   %ebx
+  80281c:	ff 35 00 90 80 00    	push   0x809000
+  802822:	e8 bc 0a 00 00       	call   8032e3 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802827:	83 c4 0c             	add    $0xc,%esp
+  80282a:	6a 00                	push   $0x0
+  80282c:	6a 00                	push   $0x0
+  80282e:	6a 00                	push   $0x0
+  802830:	e8 43 0a 00 00       	call   803278 <ipc_recv>
+}
+  802835:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802838:	c9                   	leave
+  802839:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80283a:	83 ec 0c             	sub    $0xc,%esp
+  80283d:	6a 02                	push   $0x2
+  80283f:	e8 d8 0b 00 00       	call   80341c <ipc_find_env>
+  802844:	a3 00 90 80 00       	mov    %eax,0x809000
+  802849:	83 c4 10             	add    $0x10,%esp
+  80284c:	eb c6                	jmp    802814 <nsipc+0x12>
+
+0080284e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80284e:	55                   	push   %ebp
+  80284f:	89 e5                	mov    %esp,%ebp
+  802851:	56                   	push   %esi
+  802852:	53                   	push   %ebx
+  802853:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802856:	8b 45 08             	mov    0x8(%ebp),%eax
+  802859:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80285e:	8b 06                	mov    (%esi),%eax
+  802860:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802865:	b8 01 00 00 00       	mov    $0x1,%eax
+  80286a:	e8 93 ff ff ff       	call   802802 <nsipc>
+  80286f:	89 c3                	mov    %eax,%ebx
+  802871:	85 c0                	test   %eax,%eax
+  802873:	79 09                	jns    80287e <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802875:	89 d8                	mov    %ebx,%eax
+  802877:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80287a:	5b                   	pop    %ebx
+  80287b:	5e                   	pop    %esi
+  80287c:	5d                   	pop    %ebp
+  80287d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80287e:	83 ec 04             	sub    $0x4,%esp
+  802881:	ff 35 10 80 80 00    	push   0x808010
+  802887:	68 00 80 80 00       	push   $0x808000
+  80288c:	ff 75 0c             	push   0xc(%ebp)
+  80288f:	e8 47 e0 ff ff       	call   8008db <memmove>
+		*addrlen = ret->ret_addrlen;
+  802894:	a1 10 80 80 00       	mov    0x808010,%eax
+  802899:	89 06                	mov    %eax,(%esi)
+  80289b:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80289e:	eb d5                	jmp    802875 <nsipc_accept+0x27>
+
+008028a0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8028a0:	55                   	push   %ebp
+  8028a1:	89 e5                	mov    %esp,%ebp
+  8028a3:	53                   	push   %ebx
+  8028a4:	83 ec 08             	sub    $0x8,%esp
+  8028a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8028aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ad:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8028b2:	53                   	push   %ebx
+  8028b3:	ff 75 0c             	push   0xc(%ebp)
+  8028b6:	68 04 80 80 00       	push   $0x808004
+  8028bb:	e8 1b e0 ff ff       	call   8008db <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8028c0:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8028c6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8028cb:	e8 32 ff ff ff       	call   802802 <nsipc>
+}
+  8028d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028d3:	c9                   	leave
+  8028d4:	c3                   	ret
+
+008028d5 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8028d5:	55                   	push   %ebp
+  8028d6:	89 e5                	mov    %esp,%ebp
+  8028d8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8028db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028de:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  8028e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028e6:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  8028eb:	b8 03 00 00 00       	mov    $0x3,%eax
+  8028f0:	e8 0d ff ff ff       	call   802802 <nsipc>
+}
+  8028f5:	c9                   	leave
+  8028f6:	c3                   	ret
+
+008028f7 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8028f7:	55                   	push   %ebp
+  8028f8:	89 e5                	mov    %esp,%ebp
+  8028fa:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8028fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802900:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802905:	b8 04 00 00 00       	mov    $0x4,%eax
+  80290a:	e8 f3 fe ff ff       	call   802802 <nsipc>
+}
+  80290f:	c9                   	leave
+  802910:	c3                   	ret
+
+00802911 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802911:	55                   	push   %ebp
+  802912:	89 e5                	mov    %esp,%ebp
+  802914:	53                   	push   %ebx
+  802915:	83 ec 08             	sub    $0x8,%esp
+  802918:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80291b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80291e:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802923:	53                   	push   %ebx
+  802924:	ff 75 0c             	push   0xc(%ebp)
+  802927:	68 04 80 80 00       	push   $0x808004
+  80292c:	e8 aa df ff ff       	call   8008db <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802931:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802937:	b8 05 00 00 00       	mov    $0x5,%eax
+  80293c:	e8 c1 fe ff ff       	call   802802 <nsipc>
+}
+  802941:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802944:	c9                   	leave
+  802945:	c3                   	ret
+
+00802946 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802946:	55                   	push   %ebp
+  802947:	89 e5                	mov    %esp,%ebp
+  802949:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80294c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80294f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802954:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802957:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  80295c:	b8 06 00 00 00       	mov    $0x6,%eax
+  802961:	e8 9c fe ff ff       	call   802802 <nsipc>
+}
+  802966:	c9                   	leave
+  802967:	c3                   	ret
+
+00802968 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802968:	55                   	push   %ebp
+  802969:	89 e5                	mov    %esp,%ebp
+  80296b:	56                   	push   %esi
+  80296c:	53                   	push   %ebx
+  80296d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802970:	8b 45 08             	mov    0x8(%ebp),%eax
+  802973:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802978:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  80297e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802981:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802986:	b8 07 00 00 00       	mov    $0x7,%eax
+  80298b:	e8 72 fe ff ff       	call   802802 <nsipc>
+  802990:	89 c3                	mov    %eax,%ebx
+  802992:	85 c0                	test   %eax,%eax
+  802994:	78 22                	js     8029b8 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802996:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80299b:	39 c6                	cmp    %eax,%esi
+  80299d:	0f 4e c6             	cmovle %esi,%eax
+  8029a0:	39 c3                	cmp    %eax,%ebx
+  8029a2:	7f 1d                	jg     8029c1 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8029a4:	83 ec 04             	sub    $0x4,%esp
+  8029a7:	53                   	push   %ebx
+  8029a8:	68 00 80 80 00       	push   $0x808000
+  8029ad:	ff 75 0c             	push   0xc(%ebp)
+  8029b0:	e8 26 df ff ff       	call   8008db <memmove>
+  8029b5:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8029b8:	89 d8                	mov    %ebx,%eax
+  8029ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029bd:	5b                   	pop    %ebx
+  8029be:	5e                   	pop    %esi
+  8029bf:	5d                   	pop    %ebp
+  8029c0:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8029c1:	68 22 3c 80 00       	push   $0x803c22
+  8029c6:	68 c0 3b 80 00       	push   $0x803bc0
+  8029cb:	6a 62                	push   $0x62
+  8029cd:	68 37 3c 80 00       	push   $0x803c37
+  8029d2:	e8 46 05 00 00       	call   802f1d <_panic>
+
+008029d7 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8029d7:	55                   	push   %ebp
+  8029d8:	89 e5                	mov    %esp,%ebp
+  8029da:	53                   	push   %ebx
+  8029db:	83 ec 04             	sub    $0x4,%esp
+  8029de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8029e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029e4:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  8029e9:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8029ef:	7f 2e                	jg     802a1f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8029f1:	83 ec 04             	sub    $0x4,%esp
+  8029f4:	53                   	push   %ebx
+  8029f5:	ff 75 0c             	push   0xc(%ebp)
+  8029f8:	68 0c 80 80 00       	push   $0x80800c
+  8029fd:	e8 d9 de ff ff       	call   8008db <memmove>
+	nsipcbuf.send.req_size = size;
+  802a02:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802a08:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a0b:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802a10:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a15:	e8 e8 fd ff ff       	call   802802 <nsipc>
+}
+  802a1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a1d:	c9                   	leave
+  802a1e:	c3                   	ret
+	assert(size < 1600);
+  802a1f:	68 43 3c 80 00       	push   $0x803c43
+  802a24:	68 c0 3b 80 00       	push   $0x803bc0
+  802a29:	6a 6d                	push   $0x6d
+  802a2b:	68 37 3c 80 00       	push   $0x803c37
+  802a30:	e8 e8 04 00 00       	call   802f1d <_panic>
+
+00802a35 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802a35:	55                   	push   %ebp
+  802a36:	89 e5                	mov    %esp,%ebp
+  802a38:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802a3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a3e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802a43:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a46:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802a4b:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a4e:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802a53:	b8 09 00 00 00       	mov    $0x9,%eax
+  802a58:	e8 a5 fd ff ff       	call   802802 <nsipc>
+}
+  802a5d:	c9                   	leave
+  802a5e:	c3                   	ret
+
+00802a5f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a5f:	55                   	push   %ebp
+  802a60:	89 e5                	mov    %esp,%ebp
+  802a62:	56                   	push   %esi
+  802a63:	53                   	push   %ebx
+  802a64:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802a67:	83 ec 0c             	sub    $0xc,%esp
+  802a6a:	ff 75 08             	push   0x8(%ebp)
+  802a6d:	e8 00 e5 ff ff       	call   800f72 <fd2data>
+  802a72:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802a74:	83 c4 08             	add    $0x8,%esp
+  802a77:	68 4f 3c 80 00       	push   $0x803c4f
+  802a7c:	53                   	push   %ebx
+  802a7d:	e8 d3 dc ff ff       	call   800755 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802a82:	8b 46 04             	mov    0x4(%esi),%eax
+  802a85:	2b 06                	sub    (%esi),%eax
+  802a87:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802a8d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802a94:	00 00 00 
+	stat->st_dev = &devpipe;
+  802a97:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802a9e:	40 80 00 
+	return 0;
+}
+  802aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802aa9:	5b                   	pop    %ebx
+  802aaa:	5e                   	pop    %esi
+  802aab:	5d                   	pop    %ebp
+  802aac:	c3                   	ret
+
+00802aad <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802aad:	55                   	push   %ebp
+  802aae:	89 e5                	mov    %esp,%ebp
+  802ab0:	53                   	push   %ebx
+  802ab1:	83 ec 0c             	sub    $0xc,%esp
+  802ab4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802ab7:	53                   	push   %ebx
+  802ab8:	6a 00                	push   $0x0
+  802aba:	e8 2f e1 ff ff       	call   800bee <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802abf:	89 1c 24             	mov    %ebx,(%esp)
+  802ac2:	e8 ab e4 ff ff       	call   800f72 <fd2data>
+  802ac7:	83 c4 08             	add    $0x8,%esp
+  802aca:	50                   	push   %eax
+  802acb:	6a 00                	push   $0x0
+  802acd:	e8 1c e1 ff ff       	call   800bee <sys_page_unmap>
+}
+  802ad2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ad5:	c9                   	leave
+  802ad6:	c3                   	ret
+
+00802ad7 <_pipeisclosed>:
+{
+  802ad7:	55                   	push   %ebp
+  802ad8:	89 e5                	mov    %esp,%ebp
+  802ada:	57                   	push   %edi
+  802adb:	56                   	push   %esi
+  802adc:	53                   	push   %ebx
+  802add:	83 ec 1c             	sub    $0x1c,%esp
+  802ae0:	89 c7                	mov    %eax,%edi
+  802ae2:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802ae4:	a1 00 50 80 00       	mov    0x805000,%eax
+  802ae9:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802aec:	83 ec 0c             	sub    $0xc,%esp
+  802aef:	57                   	push   %edi
+  802af0:	e8 66 09 00 00       	call   80345b <pageref>
+  802af5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802af8:	89 34 24             	mov    %esi,(%esp)
+  802afb:	e8 5b 09 00 00       	call   80345b <pageref>
+		nn = thisenv->env_runs;
+  802b00:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802b06:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802b09:	83 c4 10             	add    $0x10,%esp
+  802b0c:	39 cb                	cmp    %ecx,%ebx
+  802b0e:	74 1b                	je     802b2b <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802b10:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802b13:	75 cf                	jne    802ae4 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802b15:	8b 42 58             	mov    0x58(%edx),%eax
+  802b18:	6a 01                	push   $0x1
+  802b1a:	50                   	push   %eax
+  802b1b:	53                   	push   %ebx
+  802b1c:	68 56 3c 80 00       	push   $0x803c56
+  802b21:	e8 41 d6 ff ff       	call   800167 <cprintf>
+  802b26:	83 c4 10             	add    $0x10,%esp
+  802b29:	eb b9                	jmp    802ae4 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802b2b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802b2e:	0f 94 c0             	sete   %al
+  802b31:	0f b6 c0             	movzbl %al,%eax
+}
+  802b34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b37:	5b                   	pop    %ebx
+  802b38:	5e                   	pop    %esi
+  802b39:	5f                   	pop    %edi
+  802b3a:	5d                   	pop    %ebp
+  802b3b:	c3                   	ret
+
+00802b3c <devpipe_write>:
+{
+  802b3c:	55                   	push   %ebp
+  802b3d:	89 e5                	mov    %esp,%ebp
+  802b3f:	57                   	push   %edi
+  802b40:	56                   	push   %esi
+  802b41:	53                   	push   %ebx
+  802b42:	83 ec 28             	sub    $0x28,%esp
+  802b45:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802b48:	56                   	push   %esi
+  802b49:	e8 24 e4 ff ff       	call   800f72 <fd2data>
+  802b4e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802b50:	83 c4 10             	add    $0x10,%esp
+  802b53:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b58:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802b5b:	75 09                	jne    802b66 <devpipe_write+0x2a>
+	return i;
+  802b5d:	89 f8                	mov    %edi,%eax
+  802b5f:	eb 23                	jmp    802b84 <devpipe_write+0x48>
+			sys_yield();
+  802b61:	e8 dc df ff ff       	call   800b42 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802b66:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b69:	8b 0b                	mov    (%ebx),%ecx
+  802b6b:	8d 51 20             	lea    0x20(%ecx),%edx
+  802b6e:	39 d0                	cmp    %edx,%eax
+  802b70:	72 1a                	jb     802b8c <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802b72:	89 da                	mov    %ebx,%edx
+  802b74:	89 f0                	mov    %esi,%eax
+  802b76:	e8 5c ff ff ff       	call   802ad7 <_pipeisclosed>
+  802b7b:	85 c0                	test   %eax,%eax
+  802b7d:	74 e2                	je     802b61 <devpipe_write+0x25>
+				return 0;
+  802b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b87:	5b                   	pop    %ebx
+  802b88:	5e                   	pop    %esi
+  802b89:	5f                   	pop    %edi
+  802b8a:	5d                   	pop    %ebp
+  802b8b:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802b8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b8f:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802b93:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802b96:	89 c2                	mov    %eax,%edx
+  802b98:	c1 fa 1f             	sar    $0x1f,%edx
+  802b9b:	89 d1                	mov    %edx,%ecx
+  802b9d:	c1 e9 1b             	shr    $0x1b,%ecx
+  802ba0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802ba3:	83 e2 1f             	and    $0x1f,%edx
+  802ba6:	29 ca                	sub    %ecx,%edx
+  802ba8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802bac:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802bb0:	83 c0 01             	add    $0x1,%eax
+  802bb3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802bb6:	83 c7 01             	add    $0x1,%edi
+  802bb9:	eb 9d                	jmp    802b58 <devpipe_write+0x1c>
+
+00802bbb <devpipe_read>:
+{
+  802bbb:	55                   	push   %ebp
+  802bbc:	89 e5                	mov    %esp,%ebp
+  802bbe:	57                   	push   %edi
+  802bbf:	56                   	push   %esi
+  802bc0:	53                   	push   %ebx
+  802bc1:	83 ec 18             	sub    $0x18,%esp
+  802bc4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802bc7:	57                   	push   %edi
+  802bc8:	e8 a5 e3 ff ff       	call   800f72 <fd2data>
+  802bcd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802bcf:	83 c4 10             	add    $0x10,%esp
+  802bd2:	be 00 00 00 00       	mov    $0x0,%esi
+  802bd7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802bda:	75 13                	jne    802bef <devpipe_read+0x34>
+	return i;
+  802bdc:	89 f0                	mov    %esi,%eax
+  802bde:	eb 02                	jmp    802be2 <devpipe_read+0x27>
+				return i;
+  802be0:	89 f0                	mov    %esi,%eax
+}
+  802be2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802be5:	5b                   	pop    %ebx
+  802be6:	5e                   	pop    %esi
+  802be7:	5f                   	pop    %edi
+  802be8:	5d                   	pop    %ebp
+  802be9:	c3                   	ret
+			sys_yield();
+  802bea:	e8 53 df ff ff       	call   800b42 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802bef:	8b 03                	mov    (%ebx),%eax
+  802bf1:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802bf4:	75 18                	jne    802c0e <devpipe_read+0x53>
+			if (i > 0)
+  802bf6:	85 f6                	test   %esi,%esi
+  802bf8:	75 e6                	jne    802be0 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802bfa:	89 da                	mov    %ebx,%edx
+  802bfc:	89 f8                	mov    %edi,%eax
+  802bfe:	e8 d4 fe ff ff       	call   802ad7 <_pipeisclosed>
+  802c03:	85 c0                	test   %eax,%eax
+  802c05:	74 e3                	je     802bea <devpipe_read+0x2f>
+				return 0;
+  802c07:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0c:	eb d4                	jmp    802be2 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802c0e:	99                   	cltd
+  802c0f:	c1 ea 1b             	shr    $0x1b,%edx
+  802c12:	01 d0                	add    %edx,%eax
+  802c14:	83 e0 1f             	and    $0x1f,%eax
+  802c17:	29 d0                	sub    %edx,%eax
+  802c19:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802c1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c21:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802c24:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802c27:	83 c6 01             	add    $0x1,%esi
+  802c2a:	eb ab                	jmp    802bd7 <devpipe_read+0x1c>
+
+00802c2c <pipe>:
+{
+  802c2c:	55                   	push   %ebp
+  802c2d:	89 e5                	mov    %esp,%ebp
+  802c2f:	56                   	push   %esi
+  802c30:	53                   	push   %ebx
+  802c31:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802c34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c37:	50                   	push   %eax
+  802c38:	e8 4c e3 ff ff       	call   800f89 <fd_alloc>
+  802c3d:	89 c3                	mov    %eax,%ebx
+  802c3f:	83 c4 10             	add    $0x10,%esp
+  802c42:	85 c0                	test   %eax,%eax
+  802c44:	0f 88 23 01 00 00    	js     802d6d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c4a:	83 ec 04             	sub    $0x4,%esp
+  802c4d:	68 07 04 00 00       	push   $0x407
+  802c52:	ff 75 f4             	push   -0xc(%ebp)
+  802c55:	6a 00                	push   $0x0
+  802c57:	e8 05 df ff ff       	call   800b61 <sys_page_alloc>
+  802c5c:	89 c3                	mov    %eax,%ebx
+  802c5e:	83 c4 10             	add    $0x10,%esp
+  802c61:	85 c0                	test   %eax,%eax
+  802c63:	0f 88 04 01 00 00    	js     802d6d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802c69:	83 ec 0c             	sub    $0xc,%esp
+  802c6c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802c6f:	50                   	push   %eax
+  802c70:	e8 14 e3 ff ff       	call   800f89 <fd_alloc>
+  802c75:	89 c3                	mov    %eax,%ebx
+  802c77:	83 c4 10             	add    $0x10,%esp
+  802c7a:	85 c0                	test   %eax,%eax
+  802c7c:	0f 88 db 00 00 00    	js     802d5d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c82:	83 ec 04             	sub    $0x4,%esp
+  802c85:	68 07 04 00 00       	push   $0x407
+  802c8a:	ff 75 f0             	push   -0x10(%ebp)
+  802c8d:	6a 00                	push   $0x0
+  802c8f:	e8 cd de ff ff       	call   800b61 <sys_page_alloc>
+  802c94:	89 c3                	mov    %eax,%ebx
+  802c96:	83 c4 10             	add    $0x10,%esp
+  802c99:	85 c0                	test   %eax,%eax
+  802c9b:	0f 88 bc 00 00 00    	js     802d5d <pipe+0x131>
+	va = fd2data(fd0);
+  802ca1:	83 ec 0c             	sub    $0xc,%esp
+  802ca4:	ff 75 f4             	push   -0xc(%ebp)
+  802ca7:	e8 c6 e2 ff ff       	call   800f72 <fd2data>
+  802cac:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cae:	83 c4 0c             	add    $0xc,%esp
+  802cb1:	68 07 04 00 00       	push   $0x407
+  802cb6:	50                   	push   %eax
+  802cb7:	6a 00                	push   $0x0
+  802cb9:	e8 a3 de ff ff       	call   800b61 <sys_page_alloc>
+  802cbe:	89 c3                	mov    %eax,%ebx
+  802cc0:	83 c4 10             	add    $0x10,%esp
+  802cc3:	85 c0                	test   %eax,%eax
+  802cc5:	0f 88 82 00 00 00    	js     802d4d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ccb:	83 ec 0c             	sub    $0xc,%esp
+  802cce:	ff 75 f0             	push   -0x10(%ebp)
+  802cd1:	e8 9c e2 ff ff       	call   800f72 <fd2data>
+  802cd6:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802cdd:	50                   	push   %eax
+  802cde:	6a 00                	push   $0x0
+  802ce0:	56                   	push   %esi
+  802ce1:	6a 00                	push   $0x0
+  802ce3:	e8 c4 de ff ff       	call   800bac <sys_page_map>
+  802ce8:	89 c3                	mov    %eax,%ebx
+  802cea:	83 c4 20             	add    $0x20,%esp
+  802ced:	85 c0                	test   %eax,%eax
+  802cef:	78 4e                	js     802d3f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802cf1:	a1 60 40 80 00       	mov    0x804060,%eax
+  802cf6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802cf9:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802cfb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802cfe:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802d05:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802d08:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802d0a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802d0d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802d14:	83 ec 0c             	sub    $0xc,%esp
+  802d17:	ff 75 f4             	push   -0xc(%ebp)
+  802d1a:	e8 43 e2 ff ff       	call   800f62 <fd2num>
+  802d1f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d22:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802d24:	83 c4 04             	add    $0x4,%esp
+  802d27:	ff 75 f0             	push   -0x10(%ebp)
+  802d2a:	e8 33 e2 ff ff       	call   800f62 <fd2num>
+  802d2f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d32:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802d35:	83 c4 10             	add    $0x10,%esp
+  802d38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d3d:	eb 2e                	jmp    802d6d <pipe+0x141>
+	sys_page_unmap(0, va);
+  802d3f:	83 ec 08             	sub    $0x8,%esp
+  802d42:	56                   	push   %esi
+  802d43:	6a 00                	push   $0x0
+  802d45:	e8 a4 de ff ff       	call   800bee <sys_page_unmap>
+  802d4a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802d4d:	83 ec 08             	sub    $0x8,%esp
+  802d50:	ff 75 f0             	push   -0x10(%ebp)
+  802d53:	6a 00                	push   $0x0
+  802d55:	e8 94 de ff ff       	call   800bee <sys_page_unmap>
+  802d5a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802d5d:	83 ec 08             	sub    $0x8,%esp
+  802d60:	ff 75 f4             	push   -0xc(%ebp)
+  802d63:	6a 00                	push   $0x0
+  802d65:	e8 84 de ff ff       	call   800bee <sys_page_unmap>
+  802d6a:	83 c4 10             	add    $0x10,%esp
+}
+  802d6d:	89 d8                	mov    %ebx,%eax
+  802d6f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d72:	5b                   	pop    %ebx
+  802d73:	5e                   	pop    %esi
+  802d74:	5d                   	pop    %ebp
+  802d75:	c3                   	ret
+
+00802d76 <pipeisclosed>:
+{
+  802d76:	55                   	push   %ebp
+  802d77:	89 e5                	mov    %esp,%ebp
+  802d79:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d7c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d7f:	50                   	push   %eax
+  802d80:	ff 75 08             	push   0x8(%ebp)
+  802d83:	e8 57 e2 ff ff       	call   800fdf <fd_lookup>
+  802d88:	83 c4 10             	add    $0x10,%esp
+  802d8b:	85 c0                	test   %eax,%eax
+  802d8d:	78 18                	js     802da7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802d8f:	83 ec 0c             	sub    $0xc,%esp
+  802d92:	ff 75 f4             	push   -0xc(%ebp)
+  802d95:	e8 d8 e1 ff ff       	call   800f72 <fd2data>
+  802d9a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802d9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d9f:	e8 33 fd ff ff       	call   802ad7 <_pipeisclosed>
+  802da4:	83 c4 10             	add    $0x10,%esp
+}
+  802da7:	c9                   	leave
+  802da8:	c3                   	ret
+
+00802da9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802da9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dae:	c3                   	ret
+
+00802daf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802daf:	55                   	push   %ebp
+  802db0:	89 e5                	mov    %esp,%ebp
+  802db2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802db5:	68 6e 3c 80 00       	push   $0x803c6e
+  802dba:	ff 75 0c             	push   0xc(%ebp)
+  802dbd:	e8 93 d9 ff ff       	call   800755 <strcpy>
+	return 0;
+}
+  802dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc7:	c9                   	leave
+  802dc8:	c3                   	ret
+
+00802dc9 <devcons_write>:
+{
+  802dc9:	55                   	push   %ebp
+  802dca:	89 e5                	mov    %esp,%ebp
+  802dcc:	57                   	push   %edi
+  802dcd:	56                   	push   %esi
+  802dce:	53                   	push   %ebx
+  802dcf:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802dd5:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802dda:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802de0:	eb 2e                	jmp    802e10 <devcons_write+0x47>
+		m = n - tot;
+  802de2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802de5:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802de7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802dec:	39 c3                	cmp    %eax,%ebx
+  802dee:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802df1:	83 ec 04             	sub    $0x4,%esp
+  802df4:	53                   	push   %ebx
+  802df5:	89 f0                	mov    %esi,%eax
+  802df7:	03 45 0c             	add    0xc(%ebp),%eax
+  802dfa:	50                   	push   %eax
+  802dfb:	57                   	push   %edi
+  802dfc:	e8 da da ff ff       	call   8008db <memmove>
+		sys_cputs(buf, m);
+  802e01:	83 c4 08             	add    $0x8,%esp
+  802e04:	53                   	push   %ebx
+  802e05:	57                   	push   %edi
+  802e06:	e8 7a dc ff ff       	call   800a85 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802e0b:	01 de                	add    %ebx,%esi
+  802e0d:	83 c4 10             	add    $0x10,%esp
+  802e10:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802e13:	72 cd                	jb     802de2 <devcons_write+0x19>
+}
+  802e15:	89 f0                	mov    %esi,%eax
+  802e17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e1a:	5b                   	pop    %ebx
+  802e1b:	5e                   	pop    %esi
+  802e1c:	5f                   	pop    %edi
+  802e1d:	5d                   	pop    %ebp
+  802e1e:	c3                   	ret
+
+00802e1f <devcons_read>:
+{
+  802e1f:	55                   	push   %ebp
+  802e20:	89 e5                	mov    %esp,%ebp
+  802e22:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e2a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e2e:	75 07                	jne    802e37 <devcons_read+0x18>
+  802e30:	eb 1f                	jmp    802e51 <devcons_read+0x32>
+		sys_yield();
+  802e32:	e8 0b dd ff ff       	call   800b42 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802e37:	e8 6f dc ff ff       	call   800aab <sys_cgetc>
+  802e3c:	85 c0                	test   %eax,%eax
+  802e3e:	74 f2                	je     802e32 <devcons_read+0x13>
+	if (c < 0)
+  802e40:	78 0f                	js     802e51 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802e42:	83 f8 04             	cmp    $0x4,%eax
+  802e45:	74 0c                	je     802e53 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802e47:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802e4a:	88 02                	mov    %al,(%edx)
+	return 1;
+  802e4c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802e51:	c9                   	leave
+  802e52:	c3                   	ret
+		return 0;
+  802e53:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e58:	eb f7                	jmp    802e51 <devcons_read+0x32>
+
+00802e5a <cputchar>:
+{
+  802e5a:	55                   	push   %ebp
+  802e5b:	89 e5                	mov    %esp,%ebp
+  802e5d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802e60:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e63:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802e66:	6a 01                	push   $0x1
+  802e68:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e6b:	50                   	push   %eax
+  802e6c:	e8 14 dc ff ff       	call   800a85 <sys_cputs>
+}
+  802e71:	83 c4 10             	add    $0x10,%esp
+  802e74:	c9                   	leave
+  802e75:	c3                   	ret
+
+00802e76 <getchar>:
+{
+  802e76:	55                   	push   %ebp
+  802e77:	89 e5                	mov    %esp,%ebp
+  802e79:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802e7c:	6a 01                	push   $0x1
+  802e7e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e81:	50                   	push   %eax
+  802e82:	6a 00                	push   $0x0
+  802e84:	e8 bc e3 ff ff       	call   801245 <read>
+	if (r < 0)
+  802e89:	83 c4 10             	add    $0x10,%esp
+  802e8c:	85 c0                	test   %eax,%eax
+  802e8e:	78 06                	js     802e96 <getchar+0x20>
+	if (r < 1)
+  802e90:	74 06                	je     802e98 <getchar+0x22>
+	return c;
+  802e92:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802e96:	c9                   	leave
+  802e97:	c3                   	ret
+		return -E_EOF;
+  802e98:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802e9d:	eb f7                	jmp    802e96 <getchar+0x20>
+
+00802e9f <iscons>:
+{
+  802e9f:	55                   	push   %ebp
+  802ea0:	89 e5                	mov    %esp,%ebp
+  802ea2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ea5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ea8:	50                   	push   %eax
+  802ea9:	ff 75 08             	push   0x8(%ebp)
+  802eac:	e8 2e e1 ff ff       	call   800fdf <fd_lookup>
+  802eb1:	83 c4 10             	add    $0x10,%esp
+  802eb4:	85 c0                	test   %eax,%eax
+  802eb6:	78 11                	js     802ec9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802eb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ebb:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802ec1:	39 10                	cmp    %edx,(%eax)
+  802ec3:	0f 94 c0             	sete   %al
+  802ec6:	0f b6 c0             	movzbl %al,%eax
+}
+  802ec9:	c9                   	leave
+  802eca:	c3                   	ret
+
+00802ecb <opencons>:
+{
+  802ecb:	55                   	push   %ebp
+  802ecc:	89 e5                	mov    %esp,%ebp
+  802ece:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802ed1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ed4:	50                   	push   %eax
+  802ed5:	e8 af e0 ff ff       	call   800f89 <fd_alloc>
+  802eda:	83 c4 10             	add    $0x10,%esp
+  802edd:	85 c0                	test   %eax,%eax
+  802edf:	78 3a                	js     802f1b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802ee1:	83 ec 04             	sub    $0x4,%esp
+  802ee4:	68 07 04 00 00       	push   $0x407
+  802ee9:	ff 75 f4             	push   -0xc(%ebp)
+  802eec:	6a 00                	push   $0x0
+  802eee:	e8 6e dc ff ff       	call   800b61 <sys_page_alloc>
+  802ef3:	83 c4 10             	add    $0x10,%esp
+  802ef6:	85 c0                	test   %eax,%eax
+  802ef8:	78 21                	js     802f1b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802efa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802efd:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802f03:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802f05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f08:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802f0f:	83 ec 0c             	sub    $0xc,%esp
+  802f12:	50                   	push   %eax
+  802f13:	e8 4a e0 ff ff       	call   800f62 <fd2num>
+  802f18:	83 c4 10             	add    $0x10,%esp
+}
+  802f1b:	c9                   	leave
+  802f1c:	c3                   	ret
+
+00802f1d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802f1d:	55                   	push   %ebp
+  802f1e:	89 e5                	mov    %esp,%ebp
+  802f20:	56                   	push   %esi
+  802f21:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802f22:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802f25:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802f2b:	e8 eb db ff ff       	call   800b1b <sys_getenvid>
+  802f30:	83 ec 0c             	sub    $0xc,%esp
+  802f33:	ff 75 0c             	push   0xc(%ebp)
+  802f36:	ff 75 08             	push   0x8(%ebp)
+  802f39:	56                   	push   %esi
+  802f3a:	50                   	push   %eax
+  802f3b:	68 7c 3c 80 00       	push   $0x803c7c
+  802f40:	e8 22 d2 ff ff       	call   800167 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802f45:	83 c4 18             	add    $0x18,%esp
+  802f48:	53                   	push   %ebx
+  802f49:	ff 75 10             	push   0x10(%ebp)
+  802f4c:	e8 c5 d1 ff ff       	call   800116 <vcprintf>
+	cprintf("\n");
+  802f51:	c7 04 24 67 3c 80 00 	movl   $0x803c67,(%esp)
+  802f58:	e8 0a d2 ff ff       	call   800167 <cprintf>
+  802f5d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802f60:	cc                   	int3
+	while (1)
+  802f61:	eb fd                	jmp    802f60 <_panic+0x43>
+
+00802f63 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802f63:	55                   	push   %ebp
+  802f64:	89 e5                	mov    %esp,%ebp
+  802f66:	57                   	push   %edi
+  802f67:	56                   	push   %esi
+  802f68:	53                   	push   %ebx
+  802f69:	83 ec 20             	sub    $0x20,%esp
+  802f6c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f6f:	89 d7                	mov    %edx,%edi
+  802f71:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802f73:	51                   	push   %ecx
+  802f74:	68 00 f0 7f 00       	push   $0x7ff000
+  802f79:	6a 00                	push   $0x0
+  802f7b:	e8 e1 db ff ff       	call   800b61 <sys_page_alloc>
+  802f80:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f82:	83 c4 10             	add    $0x10,%esp
+  802f85:	85 c0                	test   %eax,%eax
+  802f87:	78 45                	js     802fce <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802f89:	83 ec 04             	sub    $0x4,%esp
+  802f8c:	68 00 10 00 00       	push   $0x1000
+  802f91:	57                   	push   %edi
+  802f92:	68 00 f0 7f 00       	push   $0x7ff000
+  802f97:	e8 3f d9 ff ff       	call   8008db <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  802f9c:	89 34 24             	mov    %esi,(%esp)
+  802f9f:	57                   	push   %edi
+  802fa0:	ff 75 e4             	push   -0x1c(%ebp)
+  802fa3:	68 00 f0 7f 00       	push   $0x7ff000
+  802fa8:	6a 00                	push   $0x0
+  802faa:	e8 fd db ff ff       	call   800bac <sys_page_map>
+  802faf:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802fb1:	83 c4 20             	add    $0x20,%esp
+  802fb4:	85 c0                	test   %eax,%eax
+  802fb6:	78 16                	js     802fce <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802fb8:	83 ec 08             	sub    $0x8,%esp
+  802fbb:	68 00 f0 7f 00       	push   $0x7ff000
+  802fc0:	6a 00                	push   $0x0
+  802fc2:	e8 27 dc ff ff       	call   800bee <sys_page_unmap>
+  802fc7:	83 c4 10             	add    $0x10,%esp
+  802fca:	85 c0                	test   %eax,%eax
+  802fcc:	75 0a                	jne    802fd8 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  802fce:	89 d8                	mov    %ebx,%eax
+  802fd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fd3:	5b                   	pop    %ebx
+  802fd4:	5e                   	pop    %esi
+  802fd5:	5f                   	pop    %edi
+  802fd6:	5d                   	pop    %ebp
+  802fd7:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802fd8:	68 a0 3c 80 00       	push   $0x803ca0
+  802fdd:	68 c0 3b 80 00       	push   $0x803bc0
+  802fe2:	6a 1b                	push   $0x1b
+  802fe4:	68 18 3d 80 00       	push   $0x803d18
+  802fe9:	e8 2f ff ff ff       	call   802f1d <_panic>
+
+00802fee <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802fee:	55                   	push   %ebp
+  802fef:	89 e5                	mov    %esp,%ebp
+  802ff1:	53                   	push   %ebx
+  802ff2:	83 ec 04             	sub    $0x4,%esp
+  802ff5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  802ff8:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802ffa:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  802ffe:	74 21                	je     803021 <pgfault+0x33>
+  803000:	89 d0                	mov    %edx,%eax
+  803002:	c1 e8 16             	shr    $0x16,%eax
+  803005:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80300c:	a8 01                	test   $0x1,%al
+  80300e:	74 11                	je     803021 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803010:	89 d0                	mov    %edx,%eax
+  803012:	c1 e8 0c             	shr    $0xc,%eax
+  803015:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80301c:	f6 c4 08             	test   $0x8,%ah
+  80301f:	75 17                	jne    803038 <pgfault+0x4a>
+		if (pgfault_next) {
+  803021:	a1 04 90 80 00       	mov    0x809004,%eax
+  803026:	85 c0                	test   %eax,%eax
+  803028:	74 27                	je     803051 <pgfault+0x63>
+			pgfault_next(utf);
+  80302a:	83 ec 0c             	sub    $0xc,%esp
+  80302d:	53                   	push   %ebx
+  80302e:	ff d0                	call   *%eax
+			return;
+  803030:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803033:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803036:	c9                   	leave
+  803037:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803038:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80303e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803043:	b8 00 00 00 00       	mov    $0x0,%eax
+  803048:	e8 16 ff ff ff       	call   802f63 <copy_page_to>
+  80304d:	85 c0                	test   %eax,%eax
+  80304f:	79 e2                	jns    803033 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803051:	a1 00 50 80 00       	mov    0x805000,%eax
+  803056:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803059:	ff 73 28             	push   0x28(%ebx)
+  80305c:	ff 33                	push   (%ebx)
+  80305e:	50                   	push   %eax
+  80305f:	68 c4 3c 80 00       	push   $0x803cc4
+  803064:	e8 fe d0 ff ff       	call   800167 <cprintf>
+	sys_env_destroy(0);
+  803069:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803070:	e8 5d da ff ff       	call   800ad2 <sys_env_destroy>
+  803075:	83 c4 10             	add    $0x10,%esp
+  803078:	eb b9                	jmp    803033 <pgfault+0x45>
+
+0080307a <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  80307a:	55                   	push   %ebp
+  80307b:	89 e5                	mov    %esp,%ebp
+  80307d:	53                   	push   %ebx
+  80307e:	83 ec 04             	sub    $0x4,%esp
+  803081:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803084:	a1 08 90 80 00       	mov    0x809008,%eax
+  803089:	3d ee 2f 80 00       	cmp    $0x802fee,%eax
+  80308e:	74 15                	je     8030a5 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803090:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  803095:	83 ec 0c             	sub    $0xc,%esp
+  803098:	68 ee 2f 80 00       	push   $0x802fee
+  80309d:	e8 fb 03 00 00       	call   80349d <set_pgfault_handler>
+  8030a2:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8030a5:	83 ec 0c             	sub    $0xc,%esp
+  8030a8:	68 05 08 00 00       	push   $0x805
+  8030ad:	53                   	push   %ebx
+  8030ae:	6a 00                	push   $0x0
+  8030b0:	53                   	push   %ebx
+  8030b1:	6a 00                	push   $0x0
+  8030b3:	e8 f4 da ff ff       	call   800bac <sys_page_map>
+}
+  8030b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030bb:	c9                   	leave
+  8030bc:	c3                   	ret
+
+008030bd <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8030bd:	55                   	push   %ebp
+  8030be:	89 e5                	mov    %esp,%ebp
+  8030c0:	57                   	push   %edi
+  8030c1:	56                   	push   %esi
+  8030c2:	53                   	push   %ebx
+  8030c3:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8030c6:	68 ee 2f 80 00       	push   $0x802fee
+  8030cb:	e8 cd 03 00 00       	call   80349d <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8030d0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030d5:	cd 30                	int    $0x30
+  8030d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030da:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8030dd:	83 c4 10             	add    $0x10,%esp
+  8030e0:	85 c0                	test   %eax,%eax
+  8030e2:	0f 88 6b 01 00 00    	js     803253 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8030ed:	75 37                	jne    803126 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8030ef:	e8 27 da ff ff       	call   800b1b <sys_getenvid>
+  8030f4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030f9:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8030ff:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803104:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  803109:	e9 45 01 00 00       	jmp    803253 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  80310e:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803114:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80311a:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803120:	0f 87 ba 00 00 00    	ja     8031e0 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803126:	89 d8                	mov    %ebx,%eax
+  803128:	c1 e8 16             	shr    $0x16,%eax
+  80312b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803132:	a8 01                	test   $0x1,%al
+  803134:	74 d8                	je     80310e <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803136:	89 d8                	mov    %ebx,%eax
+  803138:	c1 e8 0c             	shr    $0xc,%eax
+  80313b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803142:	f6 c2 01             	test   $0x1,%dl
+  803145:	74 cd                	je     803114 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803147:	89 da                	mov    %ebx,%edx
+  803149:	80 e6 df             	and    $0xdf,%dh
+  80314c:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803152:	74 c0                	je     803114 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803154:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803156:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80315d:	f6 c6 04             	test   $0x4,%dh
+  803160:	75 53                	jne    8031b5 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803162:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803169:	f6 c6 08             	test   $0x8,%dh
+  80316c:	75 0c                	jne    80317a <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80316e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803175:	f6 c2 02             	test   $0x2,%dl
+  803178:	74 3b                	je     8031b5 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80317a:	83 ec 0c             	sub    $0xc,%esp
+  80317d:	68 05 08 00 00       	push   $0x805
+  803182:	57                   	push   %edi
+  803183:	ff 75 e4             	push   -0x1c(%ebp)
+  803186:	57                   	push   %edi
+  803187:	6a 00                	push   $0x0
+  803189:	e8 1e da ff ff       	call   800bac <sys_page_map>
+  80318e:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803190:	83 c4 20             	add    $0x20,%esp
+  803193:	85 c0                	test   %eax,%eax
+  803195:	0f 88 a7 00 00 00    	js     803242 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80319b:	83 ec 0c             	sub    $0xc,%esp
+  80319e:	68 05 08 00 00       	push   $0x805
+  8031a3:	57                   	push   %edi
+  8031a4:	6a 00                	push   $0x0
+  8031a6:	57                   	push   %edi
+  8031a7:	6a 00                	push   $0x0
+  8031a9:	e8 fe d9 ff ff       	call   800bac <sys_page_map>
+  8031ae:	89 c6                	mov    %eax,%esi
+	return r;
+  8031b0:	83 c4 20             	add    $0x20,%esp
+  8031b3:	eb 21                	jmp    8031d6 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8031b5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8031bc:	83 ec 0c             	sub    $0xc,%esp
+  8031bf:	25 07 0e 00 00       	and    $0xe07,%eax
+  8031c4:	50                   	push   %eax
+  8031c5:	57                   	push   %edi
+  8031c6:	ff 75 e4             	push   -0x1c(%ebp)
+  8031c9:	57                   	push   %edi
+  8031ca:	6a 00                	push   $0x0
+  8031cc:	e8 db d9 ff ff       	call   800bac <sys_page_map>
+  8031d1:	89 c6                	mov    %eax,%esi
+  8031d3:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8031d6:	85 f6                	test   %esi,%esi
+  8031d8:	0f 89 36 ff ff ff    	jns    803114 <fork+0x57>
+  8031de:	eb 62                	jmp    803242 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031e0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031e5:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8031ea:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8031ed:	89 f8                	mov    %edi,%eax
+  8031ef:	e8 6f fd ff ff       	call   802f63 <copy_page_to>
+  8031f4:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031f6:	85 c0                	test   %eax,%eax
+  8031f8:	78 48                	js     803242 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031fa:	83 ec 04             	sub    $0x4,%esp
+  8031fd:	6a 07                	push   $0x7
+  8031ff:	68 00 f0 bf ee       	push   $0xeebff000
+  803204:	57                   	push   %edi
+  803205:	e8 57 d9 ff ff       	call   800b61 <sys_page_alloc>
+  80320a:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80320c:	83 c4 10             	add    $0x10,%esp
+  80320f:	85 c0                	test   %eax,%eax
+  803211:	78 2f                	js     803242 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803213:	a1 00 50 80 00       	mov    0x805000,%eax
+  803218:	8b 40 64             	mov    0x64(%eax),%eax
+  80321b:	83 ec 08             	sub    $0x8,%esp
+  80321e:	50                   	push   %eax
+  80321f:	57                   	push   %edi
+  803220:	e8 a7 da ff ff       	call   800ccc <sys_env_set_pgfault_upcall>
+  803225:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803227:	83 c4 10             	add    $0x10,%esp
+  80322a:	85 c0                	test   %eax,%eax
+  80322c:	78 14                	js     803242 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80322e:	83 ec 08             	sub    $0x8,%esp
+  803231:	6a 02                	push   $0x2
+  803233:	57                   	push   %edi
+  803234:	e8 ff d9 ff ff       	call   800c38 <sys_env_set_status>
+  803239:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80323b:	83 c4 10             	add    $0x10,%esp
+  80323e:	85 c0                	test   %eax,%eax
+  803240:	79 11                	jns    803253 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803242:	83 ec 0c             	sub    $0xc,%esp
+  803245:	ff 75 e0             	push   -0x20(%ebp)
+  803248:	e8 85 d8 ff ff       	call   800ad2 <sys_env_destroy>
+	return r;
+  80324d:	83 c4 10             	add    $0x10,%esp
+  803250:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803253:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803256:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803259:	5b                   	pop    %ebx
+  80325a:	5e                   	pop    %esi
+  80325b:	5f                   	pop    %edi
+  80325c:	5d                   	pop    %ebp
+  80325d:	c3                   	ret
+
+0080325e <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80325e:	55                   	push   %ebp
+  80325f:	89 e5                	mov    %esp,%ebp
+  803261:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803264:	68 23 3d 80 00       	push   $0x803d23
+  803269:	68 bf 00 00 00       	push   $0xbf
+  80326e:	68 18 3d 80 00       	push   $0x803d18
+  803273:	e8 a5 fc ff ff       	call   802f1d <_panic>
+
+00803278 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803278:	55                   	push   %ebp
+  803279:	89 e5                	mov    %esp,%ebp
+  80327b:	56                   	push   %esi
+  80327c:	53                   	push   %ebx
+  80327d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803280:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803283:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803286:	85 c0                	test   %eax,%eax
+  803288:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80328d:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803290:	83 ec 0c             	sub    $0xc,%esp
+  803293:	50                   	push   %eax
+  803294:	e8 10 db ff ff       	call   800da9 <sys_ipc_recv>
+	if (from_env_store)
+  803299:	83 c4 10             	add    $0x10,%esp
+  80329c:	85 f6                	test   %esi,%esi
+  80329e:	74 14                	je     8032b4 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8032a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032a5:	85 c0                	test   %eax,%eax
+  8032a7:	75 09                	jne    8032b2 <ipc_recv+0x3a>
+  8032a9:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8032af:	8b 52 74             	mov    0x74(%edx),%edx
+  8032b2:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8032b4:	85 db                	test   %ebx,%ebx
+  8032b6:	74 25                	je     8032dd <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8032b8:	85 c0                	test   %eax,%eax
+  8032ba:	74 0d                	je     8032c9 <ipc_recv+0x51>
+  8032bc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8032c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032c5:	5b                   	pop    %ebx
+  8032c6:	5e                   	pop    %esi
+  8032c7:	5d                   	pop    %ebp
+  8032c8:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8032c9:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032ce:	8b 40 78             	mov    0x78(%eax),%eax
+  8032d1:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8032d3:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032d8:	8b 40 70             	mov    0x70(%eax),%eax
+  8032db:	eb e5                	jmp    8032c2 <ipc_recv+0x4a>
+  8032dd:	85 c0                	test   %eax,%eax
+  8032df:	75 e1                	jne    8032c2 <ipc_recv+0x4a>
+  8032e1:	eb f0                	jmp    8032d3 <ipc_recv+0x5b>
+
+008032e3 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8032e3:	55                   	push   %ebp
+  8032e4:	89 e5                	mov    %esp,%ebp
+  8032e6:	57                   	push   %edi
+  8032e7:	56                   	push   %esi
+  8032e8:	53                   	push   %ebx
+  8032e9:	83 ec 0c             	sub    $0xc,%esp
+  8032ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032ef:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032f5:	85 db                	test   %ebx,%ebx
+  8032f7:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032fc:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8032ff:	ff 75 14             	push   0x14(%ebp)
+  803302:	53                   	push   %ebx
+  803303:	56                   	push   %esi
+  803304:	57                   	push   %edi
+  803305:	e8 0c da ff ff       	call   800d16 <sys_ipc_try_send>
+  80330a:	83 c4 10             	add    $0x10,%esp
+  80330d:	85 c0                	test   %eax,%eax
+  80330f:	74 22                	je     803333 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803311:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803314:	75 07                	jne    80331d <ipc_send+0x3a>
+		sys_yield();
+  803316:	e8 27 d8 ff ff       	call   800b42 <sys_yield>
+  80331b:	eb e2                	jmp    8032ff <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80331d:	68 39 3d 80 00       	push   $0x803d39
+  803322:	68 c0 3b 80 00       	push   $0x803bc0
+  803327:	6a 39                	push   $0x39
+  803329:	68 4e 3d 80 00       	push   $0x803d4e
+  80332e:	e8 ea fb ff ff       	call   802f1d <_panic>
+	}
+}
+  803333:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803336:	5b                   	pop    %ebx
+  803337:	5e                   	pop    %esi
+  803338:	5f                   	pop    %edi
+  803339:	5d                   	pop    %ebp
+  80333a:	c3                   	ret
+
+0080333b <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80333b:	55                   	push   %ebp
+  80333c:	89 e5                	mov    %esp,%ebp
+  80333e:	57                   	push   %edi
+  80333f:	56                   	push   %esi
+  803340:	53                   	push   %ebx
+  803341:	83 ec 10             	sub    $0x10,%esp
+  803344:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803347:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80334a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80334d:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803350:	85 c0                	test   %eax,%eax
+  803352:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803357:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  80335a:	6a 00                	push   $0x0
+  80335c:	ff 33                	push   (%ebx)
+  80335e:	50                   	push   %eax
+  80335f:	e8 02 da ff ff       	call   800d66 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803364:	83 c4 10             	add    $0x10,%esp
+  803367:	85 c0                	test   %eax,%eax
+  803369:	75 3c                	jne    8033a7 <ipc_recvv+0x6c>
+  80336b:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803371:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803374:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803376:	85 ff                	test   %edi,%edi
+  803378:	74 4e                	je     8033c8 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80337a:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803380:	8b 52 74             	mov    0x74(%edx),%edx
+  803383:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803385:	85 f6                	test   %esi,%esi
+  803387:	74 18                	je     8033a1 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803389:	85 c0                	test   %eax,%eax
+  80338b:	75 2d                	jne    8033ba <ipc_recvv+0x7f>
+  80338d:	a1 00 50 80 00       	mov    0x805000,%eax
+  803392:	8b 40 78             	mov    0x78(%eax),%eax
+  803395:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803397:	a1 00 50 80 00       	mov    0x805000,%eax
+  80339c:	8b 40 70             	mov    0x70(%eax),%eax
+  80339f:	eb 1f                	jmp    8033c0 <ipc_recvv+0x85>
+  8033a1:	85 c0                	test   %eax,%eax
+  8033a3:	75 1b                	jne    8033c0 <ipc_recvv+0x85>
+  8033a5:	eb f0                	jmp    803397 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8033a7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8033ad:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8033b2:	85 ff                	test   %edi,%edi
+  8033b4:	75 cd                	jne    803383 <ipc_recvv+0x48>
+	if (perm_store)
+  8033b6:	85 f6                	test   %esi,%esi
+  8033b8:	74 e7                	je     8033a1 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033ba:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8033c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033c3:	5b                   	pop    %ebx
+  8033c4:	5e                   	pop    %esi
+  8033c5:	5f                   	pop    %edi
+  8033c6:	5d                   	pop    %ebp
+  8033c7:	c3                   	ret
+	if (perm_store)
+  8033c8:	85 f6                	test   %esi,%esi
+  8033ca:	75 bd                	jne    803389 <ipc_recvv+0x4e>
+  8033cc:	eb c9                	jmp    803397 <ipc_recvv+0x5c>
+
+008033ce <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8033ce:	55                   	push   %ebp
+  8033cf:	89 e5                	mov    %esp,%ebp
+  8033d1:	57                   	push   %edi
+  8033d2:	56                   	push   %esi
+  8033d3:	53                   	push   %ebx
+  8033d4:	83 ec 0c             	sub    $0xc,%esp
+  8033d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033da:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8033e0:	ff 75 14             	push   0x14(%ebp)
+  8033e3:	53                   	push   %ebx
+  8033e4:	56                   	push   %esi
+  8033e5:	57                   	push   %edi
+  8033e6:	e8 53 d9 ff ff       	call   800d3e <sys_ipc_try_sendv>
+  8033eb:	83 c4 10             	add    $0x10,%esp
+  8033ee:	85 c0                	test   %eax,%eax
+  8033f0:	74 22                	je     803414 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8033f2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033f5:	75 07                	jne    8033fe <ipc_sendv+0x30>
+		sys_yield();
+  8033f7:	e8 46 d7 ff ff       	call   800b42 <sys_yield>
+  8033fc:	eb e2                	jmp    8033e0 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8033fe:	68 39 3d 80 00       	push   $0x803d39
+  803403:	68 c0 3b 80 00       	push   $0x803bc0
+  803408:	6a 5c                	push   $0x5c
+  80340a:	68 4e 3d 80 00       	push   $0x803d4e
+  80340f:	e8 09 fb ff ff       	call   802f1d <_panic>
+	}
+}
+  803414:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803417:	5b                   	pop    %ebx
+  803418:	5e                   	pop    %esi
+  803419:	5f                   	pop    %edi
+  80341a:	5d                   	pop    %ebp
+  80341b:	c3                   	ret
+
+0080341c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80341c:	55                   	push   %ebp
+  80341d:	89 e5                	mov    %esp,%ebp
+  80341f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803422:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803427:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80342d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803433:	8b 52 50             	mov    0x50(%edx),%edx
+  803436:	39 ca                	cmp    %ecx,%edx
+  803438:	74 11                	je     80344b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80343a:	83 c0 01             	add    $0x1,%eax
+  80343d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803442:	75 e3                	jne    803427 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803444:	b8 00 00 00 00       	mov    $0x0,%eax
+  803449:	eb 0e                	jmp    803459 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80344b:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803451:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803456:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803459:	5d                   	pop    %ebp
+  80345a:	c3                   	ret
+
+0080345b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80345b:	55                   	push   %ebp
+  80345c:	89 e5                	mov    %esp,%ebp
+  80345e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803461:	89 c2                	mov    %eax,%edx
+  803463:	c1 ea 16             	shr    $0x16,%edx
+  803466:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80346d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803472:	f6 c1 01             	test   $0x1,%cl
+  803475:	74 22                	je     803499 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803477:	c1 e8 0c             	shr    $0xc,%eax
+  80347a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803481:	a8 01                	test   $0x1,%al
+  803483:	74 14                	je     803499 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803485:	c1 e8 0c             	shr    $0xc,%eax
+  803488:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80348b:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803492:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803496:	0f b7 d2             	movzwl %dx,%edx
+}
+  803499:	89 d0                	mov    %edx,%eax
+  80349b:	5d                   	pop    %ebp
+  80349c:	c3                   	ret
+
+0080349d <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80349d:	55                   	push   %ebp
+  80349e:	89 e5                	mov    %esp,%ebp
+  8034a0:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8034a3:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  8034aa:	74 0a                	je     8034b6 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8034ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034af:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  8034b4:	c9                   	leave
+  8034b5:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034b6:	83 ec 04             	sub    $0x4,%esp
+  8034b9:	6a 07                	push   $0x7
+  8034bb:	68 00 f0 bf ee       	push   $0xeebff000
+  8034c0:	6a 00                	push   $0x0
+  8034c2:	e8 9a d6 ff ff       	call   800b61 <sys_page_alloc>
+  8034c7:	83 c4 10             	add    $0x10,%esp
+  8034ca:	85 c0                	test   %eax,%eax
+  8034cc:	75 2c                	jne    8034fa <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8034ce:	83 ec 08             	sub    $0x8,%esp
+  8034d1:	68 10 35 80 00       	push   $0x803510
+  8034d6:	6a 00                	push   $0x0
+  8034d8:	e8 ef d7 ff ff       	call   800ccc <sys_env_set_pgfault_upcall>
+  8034dd:	83 c4 10             	add    $0x10,%esp
+  8034e0:	85 c0                	test   %eax,%eax
+  8034e2:	74 c8                	je     8034ac <set_pgfault_handler+0xf>
+  8034e4:	68 a0 3d 80 00       	push   $0x803da0
+  8034e9:	68 c0 3b 80 00       	push   $0x803bc0
+  8034ee:	6a 20                	push   $0x20
+  8034f0:	68 d0 3d 80 00       	push   $0x803dd0
+  8034f5:	e8 23 fa ff ff       	call   802f1d <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034fa:	68 58 3d 80 00       	push   $0x803d58
+  8034ff:	68 c0 3b 80 00       	push   $0x803bc0
+  803504:	6a 1e                	push   $0x1e
+  803506:	68 d0 3d 80 00       	push   $0x803dd0
+  80350b:	e8 0d fa ff ff       	call   802f1d <_panic>
+
+00803510 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803510:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803511:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  803516:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803518:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80351b:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803520:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803525:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803529:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80352c:	83 c4 08             	add    $0x8,%esp
+	popal
+  80352f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803530:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803533:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803534:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803535:	c3                   	ret
+
+00803536 <dm>:
+  803536:	55                   	push   %ebp
+  803537:	57                   	push   %edi
+  803538:	56                   	push   %esi
+  803539:	53                   	push   %ebx
+  80353a:	83 ec 24             	sub    $0x24,%esp
+  80353d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803541:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803545:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803549:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80354d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803551:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803555:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803559:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80355e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803563:	ba 00 00 00 00       	mov    $0x0,%edx
+  803568:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80356f:	00 
+  803570:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803577:	00 
+  803578:	89 fb                	mov    %edi,%ebx
+  80357a:	eb 08                	jmp    803584 <dm+0x4e>
+  80357c:	83 e9 01             	sub    $0x1,%ecx
+  80357f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803582:	74 68                	je     8035ec <dm+0xb6>
+  803584:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803588:	01 c0                	add    %eax,%eax
+  80358a:	89 c6                	mov    %eax,%esi
+  80358c:	89 d7                	mov    %edx,%edi
+  80358e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803592:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803596:	0f ad d0             	shrd   %cl,%edx,%eax
+  803599:	d3 ea                	shr    %cl,%edx
+  80359b:	f6 c1 20             	test   $0x20,%cl
+  80359e:	74 04                	je     8035a4 <dm+0x6e>
+  8035a0:	89 d0                	mov    %edx,%eax
+  8035a2:	31 d2                	xor    %edx,%edx
+  8035a4:	83 e0 01             	and    $0x1,%eax
+  8035a7:	89 04 24             	mov    %eax,(%esp)
+  8035aa:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8035b1:	00 
+  8035b2:	8b 04 24             	mov    (%esp),%eax
+  8035b5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8035b9:	09 f0                	or     %esi,%eax
+  8035bb:	09 fa                	or     %edi,%edx
+  8035bd:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8035c1:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8035c5:	39 f0                	cmp    %esi,%eax
+  8035c7:	89 d5                	mov    %edx,%ebp
+  8035c9:	19 fd                	sbb    %edi,%ebp
+  8035cb:	72 af                	jb     80357c <dm+0x46>
+  8035cd:	29 f0                	sub    %esi,%eax
+  8035cf:	19 fa                	sbb    %edi,%edx
+  8035d1:	89 cf                	mov    %ecx,%edi
+  8035d3:	c1 ef 05             	shr    $0x5,%edi
+  8035d6:	83 e7 01             	and    $0x1,%edi
+  8035d9:	89 fe                	mov    %edi,%esi
+  8035db:	83 f6 01             	xor    $0x1,%esi
+  8035de:	d3 e6                	shl    %cl,%esi
+  8035e0:	d3 e7                	shl    %cl,%edi
+  8035e2:	09 74 24 18          	or     %esi,0x18(%esp)
+  8035e6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8035ea:	eb 90                	jmp    80357c <dm+0x46>
+  8035ec:	85 db                	test   %ebx,%ebx
+  8035ee:	74 05                	je     8035f5 <dm+0xbf>
+  8035f0:	89 03                	mov    %eax,(%ebx)
+  8035f2:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035f5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035f9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035fd:	83 c4 24             	add    $0x24,%esp
+  803600:	5b                   	pop    %ebx
+  803601:	5e                   	pop    %esi
+  803602:	5f                   	pop    %edi
+  803603:	5d                   	pop    %ebp
+  803604:	c3                   	ret
+
+00803605 <__udivdi3>:
+  803605:	83 ec 08             	sub    $0x8,%esp
+  803608:	6a 00                	push   $0x0
+  80360a:	ff 74 24 1c          	push   0x1c(%esp)
+  80360e:	ff 74 24 1c          	push   0x1c(%esp)
+  803612:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803616:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80361a:	e8 17 ff ff ff       	call   803536 <dm>
+  80361f:	83 c4 14             	add    $0x14,%esp
+  803622:	c3                   	ret
+
+00803623 <__umoddi3>:
+  803623:	83 ec 18             	sub    $0x18,%esp
+  803626:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80362a:	50                   	push   %eax
+  80362b:	ff 74 24 2c          	push   0x2c(%esp)
+  80362f:	ff 74 24 2c          	push   0x2c(%esp)
+  803633:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803637:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80363b:	e8 f6 fe ff ff       	call   803536 <dm>
+  803640:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803644:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803648:	83 c4 24             	add    $0x24,%esp
+  80364b:	c3                   	ret
+
+0080364c <__divdi3>:
+  80364c:	53                   	push   %ebx
+  80364d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803651:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803655:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803659:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80365d:	85 d2                	test   %edx,%edx
+  80365f:	78 15                	js     803676 <__divdi3+0x2a>
+  803661:	85 db                	test   %ebx,%ebx
+  803663:	78 34                	js     803699 <__divdi3+0x4d>
+  803665:	83 ec 04             	sub    $0x4,%esp
+  803668:	6a 00                	push   $0x0
+  80366a:	53                   	push   %ebx
+  80366b:	51                   	push   %ecx
+  80366c:	e8 c5 fe ff ff       	call   803536 <dm>
+  803671:	83 c4 10             	add    $0x10,%esp
+  803674:	eb 21                	jmp    803697 <__divdi3+0x4b>
+  803676:	f7 d8                	neg    %eax
+  803678:	83 d2 00             	adc    $0x0,%edx
+  80367b:	f7 da                	neg    %edx
+  80367d:	85 db                	test   %ebx,%ebx
+  80367f:	78 30                	js     8036b1 <__divdi3+0x65>
+  803681:	83 ec 04             	sub    $0x4,%esp
+  803684:	6a 00                	push   $0x0
+  803686:	53                   	push   %ebx
+  803687:	51                   	push   %ecx
+  803688:	e8 a9 fe ff ff       	call   803536 <dm>
+  80368d:	83 c4 10             	add    $0x10,%esp
+  803690:	f7 d8                	neg    %eax
+  803692:	83 d2 00             	adc    $0x0,%edx
+  803695:	f7 da                	neg    %edx
+  803697:	5b                   	pop    %ebx
+  803698:	c3                   	ret
+  803699:	83 ec 04             	sub    $0x4,%esp
+  80369c:	6a 00                	push   $0x0
+  80369e:	f7 d9                	neg    %ecx
+  8036a0:	83 d3 00             	adc    $0x0,%ebx
+  8036a3:	f7 db                	neg    %ebx
+  8036a5:	53                   	push   %ebx
+  8036a6:	51                   	push   %ecx
+  8036a7:	e8 8a fe ff ff       	call   803536 <dm>
+  8036ac:	83 c4 10             	add    $0x10,%esp
+  8036af:	eb df                	jmp    803690 <__divdi3+0x44>
+  8036b1:	83 ec 04             	sub    $0x4,%esp
+  8036b4:	6a 00                	push   $0x0
+  8036b6:	f7 d9                	neg    %ecx
+  8036b8:	83 d3 00             	adc    $0x0,%ebx
+  8036bb:	f7 db                	neg    %ebx
+  8036bd:	53                   	push   %ebx
+  8036be:	51                   	push   %ecx
+  8036bf:	e8 72 fe ff ff       	call   803536 <dm>
+  8036c4:	83 c4 10             	add    $0x10,%esp
+  8036c7:	eb ce                	jmp    803697 <__divdi3+0x4b>
+
+008036c9 <__moddi3>:
+  8036c9:	55                   	push   %ebp
+  8036ca:	57                   	push   %edi
+  8036cb:	56                   	push   %esi
+  8036cc:	53                   	push   %ebx
+  8036cd:	83 ec 24             	sub    $0x24,%esp
+  8036d0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036d4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036d8:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036dc:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036e0:	85 d2                	test   %edx,%edx
+  8036e2:	78 3b                	js     80371f <__moddi3+0x56>
+  8036e4:	83 ec 04             	sub    $0x4,%esp
+  8036e7:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036eb:	56                   	push   %esi
+  8036ec:	89 ce                	mov    %ecx,%esi
+  8036ee:	f7 de                	neg    %esi
+  8036f0:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8036f4:	89 de                	mov    %ebx,%esi
+  8036f6:	83 d6 00             	adc    $0x0,%esi
+  8036f9:	f7 de                	neg    %esi
+  8036fb:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8036ff:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803703:	0f 48 f1             	cmovs  %ecx,%esi
+  803706:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80370b:	53                   	push   %ebx
+  80370c:	56                   	push   %esi
+  80370d:	e8 24 fe ff ff       	call   803536 <dm>
+  803712:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803716:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80371a:	83 c4 10             	add    $0x10,%esp
+  80371d:	eb 47                	jmp    803766 <__moddi3+0x9d>
+  80371f:	f7 d8                	neg    %eax
+  803721:	83 d2 00             	adc    $0x0,%edx
+  803724:	f7 da                	neg    %edx
+  803726:	83 ec 04             	sub    $0x4,%esp
+  803729:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80372d:	56                   	push   %esi
+  80372e:	89 cf                	mov    %ecx,%edi
+  803730:	f7 df                	neg    %edi
+  803732:	89 de                	mov    %ebx,%esi
+  803734:	83 d6 00             	adc    $0x0,%esi
+  803737:	f7 de                	neg    %esi
+  803739:	0f 49 cf             	cmovns %edi,%ecx
+  80373c:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803740:	0f 49 de             	cmovns %esi,%ebx
+  803743:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803747:	ff 74 24 0c          	push   0xc(%esp)
+  80374b:	ff 74 24 0c          	push   0xc(%esp)
+  80374f:	e8 e2 fd ff ff       	call   803536 <dm>
+  803754:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803758:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80375c:	f7 d8                	neg    %eax
+  80375e:	83 d2 00             	adc    $0x0,%edx
+  803761:	f7 da                	neg    %edx
+  803763:	83 c4 10             	add    $0x10,%esp
+  803766:	83 c4 24             	add    $0x24,%esp
+  803769:	5b                   	pop    %ebx
+  80376a:	5e                   	pop    %esi
+  80376b:	5f                   	pop    %edi
+  80376c:	5d                   	pop    %ebp
+  80376d:	c3                   	ret
@@ -0,0 +1,7631 @@
+
+obj/user/faultnostack.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_env_set_pgfault_upcall(0, (void*) _pgfault_upcall);
+  800039:	68 94 05 80 00       	push   $0x800594
+  80003e:	6a 00                	push   $0x0
+  800040:	e8 b9 02 00 00       	call   8002fe <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800045:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80004c:	00 00 00 
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80005f:	e8 e9 00 00 00       	call   80014d <sys_getenvid>
+  800064:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800069:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80006f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800074:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800079:	85 db                	test   %ebx,%ebx
+  80007b:	7e 07                	jle    800084 <libmain+0x30>
+		binaryname = argv[0];
+  80007d:	8b 06                	mov    (%esi),%eax
+  80007f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	56                   	push   %esi
+  800088:	53                   	push   %ebx
+  800089:	e8 a5 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80008e:	e8 0a 00 00 00       	call   80009d <exit>
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+
+0080009d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000a3:	e8 e6 06 00 00       	call   80078e <close_all>
+	sys_env_destroy(0);
+  8000a8:	83 ec 0c             	sub    $0xc,%esp
+  8000ab:	6a 00                	push   $0x0
+  8000ad:	e8 52 00 00 00       	call   800104 <sys_env_destroy>
+}
+  8000b2:	83 c4 10             	add    $0x10,%esp
+  8000b5:	c9                   	leave
+  8000b6:	c3                   	ret
+
+008000b7 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000b7:	55                   	push   %ebp
+  8000b8:	89 e5                	mov    %esp,%ebp
+  8000ba:	57                   	push   %edi
+  8000bb:	56                   	push   %esi
+  8000bc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000c8:	89 c3                	mov    %eax,%ebx
+  8000ca:	89 c7                	mov    %eax,%edi
+  8000cc:	55                   	push   %ebp
+  8000cd:	89 e5                	mov    %esp,%ebp
+  8000cf:	8d 35 d7 00 80 00    	lea    0x8000d7,%esi
+  8000d5:	0f 34                	sysenter
+  8000d7:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  8000d8:	5b                   	pop    %ebx
+  8000d9:	5e                   	pop    %esi
+  8000da:	5f                   	pop    %edi
+  8000db:	5d                   	pop    %ebp
+  8000dc:	c3                   	ret
+
+008000dd <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000dd:	55                   	push   %ebp
+  8000de:	89 e5                	mov    %esp,%ebp
+  8000e0:	57                   	push   %edi
+  8000e1:	56                   	push   %esi
+  8000e2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000ed:	89 d1                	mov    %edx,%ecx
+  8000ef:	89 d3                	mov    %edx,%ebx
+  8000f1:	89 d7                	mov    %edx,%edi
+  8000f3:	55                   	push   %ebp
+  8000f4:	89 e5                	mov    %esp,%ebp
+  8000f6:	8d 35 fe 00 80 00    	lea    0x8000fe,%esi
+  8000fc:	0f 34                	sysenter
+  8000fe:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  8000ff:	5b                   	pop    %ebx
+  800100:	5e                   	pop    %esi
+  800101:	5f                   	pop    %edi
+  800102:	5d                   	pop    %ebp
+  800103:	c3                   	ret
+
+00800104 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800104:	55                   	push   %ebp
+  800105:	89 e5                	mov    %esp,%ebp
+  800107:	57                   	push   %edi
+  800108:	56                   	push   %esi
+  800109:	53                   	push   %ebx
+  80010a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80010d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800112:	8b 55 08             	mov    0x8(%ebp),%edx
+  800115:	b8 03 00 00 00       	mov    $0x3,%eax
+  80011a:	89 cb                	mov    %ecx,%ebx
+  80011c:	89 cf                	mov    %ecx,%edi
+  80011e:	55                   	push   %ebp
+  80011f:	89 e5                	mov    %esp,%ebp
+  800121:	8d 35 29 01 80 00    	lea    0x800129,%esi
+  800127:	0f 34                	sysenter
+  800129:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80012a:	85 c0                	test   %eax,%eax
+  80012c:	7f 08                	jg     800136 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  80012e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800131:	5b                   	pop    %ebx
+  800132:	5e                   	pop    %esi
+  800133:	5f                   	pop    %edi
+  800134:	5d                   	pop    %ebp
+  800135:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800136:	83 ec 0c             	sub    $0xc,%esp
+  800139:	50                   	push   %eax
+  80013a:	6a 03                	push   $0x3
+  80013c:	68 6a 37 80 00       	push   $0x80376a
+  800141:	6a 3d                	push   $0x3d
+  800143:	68 87 37 80 00       	push   $0x803787
+  800148:	e8 28 24 00 00       	call   802575 <_panic>
+
+0080014d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80014d:	55                   	push   %ebp
+  80014e:	89 e5                	mov    %esp,%ebp
+  800150:	57                   	push   %edi
+  800151:	56                   	push   %esi
+  800152:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800153:	ba 00 00 00 00       	mov    $0x0,%edx
+  800158:	b8 02 00 00 00       	mov    $0x2,%eax
+  80015d:	89 d1                	mov    %edx,%ecx
+  80015f:	89 d3                	mov    %edx,%ebx
+  800161:	89 d7                	mov    %edx,%edi
+  800163:	55                   	push   %ebp
+  800164:	89 e5                	mov    %esp,%ebp
+  800166:	8d 35 6e 01 80 00    	lea    0x80016e,%esi
+  80016c:	0f 34                	sysenter
+  80016e:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  80016f:	5b                   	pop    %ebx
+  800170:	5e                   	pop    %esi
+  800171:	5f                   	pop    %edi
+  800172:	5d                   	pop    %ebp
+  800173:	c3                   	ret
+
+00800174 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800174:	55                   	push   %ebp
+  800175:	89 e5                	mov    %esp,%ebp
+  800177:	57                   	push   %edi
+  800178:	56                   	push   %esi
+  800179:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80017a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80017f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800184:	89 d1                	mov    %edx,%ecx
+  800186:	89 d3                	mov    %edx,%ebx
+  800188:	89 d7                	mov    %edx,%edi
+  80018a:	89 d6                	mov    %edx,%esi
+  80018c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80018e:	5b                   	pop    %ebx
+  80018f:	5e                   	pop    %esi
+  800190:	5f                   	pop    %edi
+  800191:	5d                   	pop    %ebp
+  800192:	c3                   	ret
+
+00800193 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800193:	55                   	push   %ebp
+  800194:	89 e5                	mov    %esp,%ebp
+  800196:	57                   	push   %edi
+  800197:	56                   	push   %esi
+  800198:	53                   	push   %ebx
+  800199:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80019c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80019f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001a2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001af:	55                   	push   %ebp
+  8001b0:	89 e5                	mov    %esp,%ebp
+  8001b2:	8d 35 ba 01 80 00    	lea    0x8001ba,%esi
+  8001b8:	0f 34                	sysenter
+  8001ba:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8001bb:	85 c0                	test   %eax,%eax
+  8001bd:	7f 08                	jg     8001c7 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  8001bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c2:	5b                   	pop    %ebx
+  8001c3:	5e                   	pop    %esi
+  8001c4:	5f                   	pop    %edi
+  8001c5:	5d                   	pop    %ebp
+  8001c6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001c7:	83 ec 0c             	sub    $0xc,%esp
+  8001ca:	50                   	push   %eax
+  8001cb:	6a 04                	push   $0x4
+  8001cd:	68 6a 37 80 00       	push   $0x80376a
+  8001d2:	6a 3d                	push   $0x3d
+  8001d4:	68 87 37 80 00       	push   $0x803787
+  8001d9:	e8 97 23 00 00       	call   802575 <_panic>
+
+008001de <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001de:	55                   	push   %ebp
+  8001df:	89 e5                	mov    %esp,%ebp
+  8001e1:	57                   	push   %edi
+  8001e2:	56                   	push   %esi
+  8001e3:	53                   	push   %ebx
+  8001e4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ed:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001f8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001fb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001fd:	85 c0                	test   %eax,%eax
+  8001ff:	7f 08                	jg     800209 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800201:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800204:	5b                   	pop    %ebx
+  800205:	5e                   	pop    %esi
+  800206:	5f                   	pop    %edi
+  800207:	5d                   	pop    %ebp
+  800208:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800209:	83 ec 0c             	sub    $0xc,%esp
+  80020c:	50                   	push   %eax
+  80020d:	6a 05                	push   $0x5
+  80020f:	68 6a 37 80 00       	push   $0x80376a
+  800214:	6a 23                	push   $0x23
+  800216:	68 87 37 80 00       	push   $0x803787
+  80021b:	e8 55 23 00 00       	call   802575 <_panic>
+
+00800220 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800220:	55                   	push   %ebp
+  800221:	89 e5                	mov    %esp,%ebp
+  800223:	57                   	push   %edi
+  800224:	56                   	push   %esi
+  800225:	53                   	push   %ebx
+  800226:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800229:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80022e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800231:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800234:	b8 06 00 00 00       	mov    $0x6,%eax
+  800239:	89 df                	mov    %ebx,%edi
+  80023b:	55                   	push   %ebp
+  80023c:	89 e5                	mov    %esp,%ebp
+  80023e:	8d 35 46 02 80 00    	lea    0x800246,%esi
+  800244:	0f 34                	sysenter
+  800246:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800247:	85 c0                	test   %eax,%eax
+  800249:	7f 08                	jg     800253 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  80024b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024e:	5b                   	pop    %ebx
+  80024f:	5e                   	pop    %esi
+  800250:	5f                   	pop    %edi
+  800251:	5d                   	pop    %ebp
+  800252:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800253:	83 ec 0c             	sub    $0xc,%esp
+  800256:	50                   	push   %eax
+  800257:	6a 06                	push   $0x6
+  800259:	68 6a 37 80 00       	push   $0x80376a
+  80025e:	6a 3d                	push   $0x3d
+  800260:	68 87 37 80 00       	push   $0x803787
+  800265:	e8 0b 23 00 00       	call   802575 <_panic>
+
+0080026a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80026a:	55                   	push   %ebp
+  80026b:	89 e5                	mov    %esp,%ebp
+  80026d:	57                   	push   %edi
+  80026e:	56                   	push   %esi
+  80026f:	53                   	push   %ebx
+  800270:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800273:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800278:	8b 55 08             	mov    0x8(%ebp),%edx
+  80027b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80027e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800283:	89 df                	mov    %ebx,%edi
+  800285:	55                   	push   %ebp
+  800286:	89 e5                	mov    %esp,%ebp
+  800288:	8d 35 90 02 80 00    	lea    0x800290,%esi
+  80028e:	0f 34                	sysenter
+  800290:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800291:	85 c0                	test   %eax,%eax
+  800293:	7f 08                	jg     80029d <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800295:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800298:	5b                   	pop    %ebx
+  800299:	5e                   	pop    %esi
+  80029a:	5f                   	pop    %edi
+  80029b:	5d                   	pop    %ebp
+  80029c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80029d:	83 ec 0c             	sub    $0xc,%esp
+  8002a0:	50                   	push   %eax
+  8002a1:	6a 08                	push   $0x8
+  8002a3:	68 6a 37 80 00       	push   $0x80376a
+  8002a8:	6a 3d                	push   $0x3d
+  8002aa:	68 87 37 80 00       	push   $0x803787
+  8002af:	e8 c1 22 00 00       	call   802575 <_panic>
+
+008002b4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8002b4:	55                   	push   %ebp
+  8002b5:	89 e5                	mov    %esp,%ebp
+  8002b7:	57                   	push   %edi
+  8002b8:	56                   	push   %esi
+  8002b9:	53                   	push   %ebx
+  8002ba:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8002bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002cd:	89 df                	mov    %ebx,%edi
+  8002cf:	55                   	push   %ebp
+  8002d0:	89 e5                	mov    %esp,%ebp
+  8002d2:	8d 35 da 02 80 00    	lea    0x8002da,%esi
+  8002d8:	0f 34                	sysenter
+  8002da:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8002db:	85 c0                	test   %eax,%eax
+  8002dd:	7f 08                	jg     8002e7 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  8002df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e2:	5b                   	pop    %ebx
+  8002e3:	5e                   	pop    %esi
+  8002e4:	5f                   	pop    %edi
+  8002e5:	5d                   	pop    %ebp
+  8002e6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002e7:	83 ec 0c             	sub    $0xc,%esp
+  8002ea:	50                   	push   %eax
+  8002eb:	6a 09                	push   $0x9
+  8002ed:	68 6a 37 80 00       	push   $0x80376a
+  8002f2:	6a 3d                	push   $0x3d
+  8002f4:	68 87 37 80 00       	push   $0x803787
+  8002f9:	e8 77 22 00 00       	call   802575 <_panic>
+
+008002fe <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002fe:	55                   	push   %ebp
+  8002ff:	89 e5                	mov    %esp,%ebp
+  800301:	57                   	push   %edi
+  800302:	56                   	push   %esi
+  800303:	53                   	push   %ebx
+  800304:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800307:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80030c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80030f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800312:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800317:	89 df                	mov    %ebx,%edi
+  800319:	55                   	push   %ebp
+  80031a:	89 e5                	mov    %esp,%ebp
+  80031c:	8d 35 24 03 80 00    	lea    0x800324,%esi
+  800322:	0f 34                	sysenter
+  800324:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800325:	85 c0                	test   %eax,%eax
+  800327:	7f 08                	jg     800331 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800329:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032c:	5b                   	pop    %ebx
+  80032d:	5e                   	pop    %esi
+  80032e:	5f                   	pop    %edi
+  80032f:	5d                   	pop    %ebp
+  800330:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800331:	83 ec 0c             	sub    $0xc,%esp
+  800334:	50                   	push   %eax
+  800335:	6a 0a                	push   $0xa
+  800337:	68 6a 37 80 00       	push   $0x80376a
+  80033c:	6a 3d                	push   $0x3d
+  80033e:	68 87 37 80 00       	push   $0x803787
+  800343:	e8 2d 22 00 00       	call   802575 <_panic>
+
+00800348 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800348:	55                   	push   %ebp
+  800349:	89 e5                	mov    %esp,%ebp
+  80034b:	57                   	push   %edi
+  80034c:	56                   	push   %esi
+  80034d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80034e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800351:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800354:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800359:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80035c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80035f:	55                   	push   %ebp
+  800360:	89 e5                	mov    %esp,%ebp
+  800362:	8d 35 6a 03 80 00    	lea    0x80036a,%esi
+  800368:	0f 34                	sysenter
+  80036a:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  80036b:	5b                   	pop    %ebx
+  80036c:	5e                   	pop    %esi
+  80036d:	5f                   	pop    %edi
+  80036e:	5d                   	pop    %ebp
+  80036f:	c3                   	ret
+
+00800370 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800370:	55                   	push   %ebp
+  800371:	89 e5                	mov    %esp,%ebp
+  800373:	57                   	push   %edi
+  800374:	56                   	push   %esi
+  800375:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800376:	8b 55 08             	mov    0x8(%ebp),%edx
+  800379:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80037c:	b8 17 00 00 00       	mov    $0x17,%eax
+  800381:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800384:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800387:	55                   	push   %ebp
+  800388:	89 e5                	mov    %esp,%ebp
+  80038a:	8d 35 92 03 80 00    	lea    0x800392,%esi
+  800390:	0f 34                	sysenter
+  800392:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800393:	5b                   	pop    %ebx
+  800394:	5e                   	pop    %esi
+  800395:	5f                   	pop    %edi
+  800396:	5d                   	pop    %ebp
+  800397:	c3                   	ret
+
+00800398 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800398:	55                   	push   %ebp
+  800399:	89 e5                	mov    %esp,%ebp
+  80039b:	57                   	push   %edi
+  80039c:	56                   	push   %esi
+  80039d:	53                   	push   %ebx
+  80039e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8003a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003ac:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003b4:	89 f7                	mov    %esi,%edi
+  8003b6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003b8:	85 c0                	test   %eax,%eax
+  8003ba:	7f 08                	jg     8003c4 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8003bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003bf:	5b                   	pop    %ebx
+  8003c0:	5e                   	pop    %esi
+  8003c1:	5f                   	pop    %edi
+  8003c2:	5d                   	pop    %ebp
+  8003c3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003c4:	83 ec 0c             	sub    $0xc,%esp
+  8003c7:	50                   	push   %eax
+  8003c8:	6a 0d                	push   $0xd
+  8003ca:	68 6a 37 80 00       	push   $0x80376a
+  8003cf:	6a 23                	push   $0x23
+  8003d1:	68 87 37 80 00       	push   $0x803787
+  8003d6:	e8 9a 21 00 00       	call   802575 <_panic>
+
+008003db <sys_ipc_recv>:
+{
+  8003db:	55                   	push   %ebp
+  8003dc:	89 e5                	mov    %esp,%ebp
+  8003de:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  8003e1:	6a 00                	push   $0x0
+  8003e3:	6a 01                	push   $0x1
+  8003e5:	ff 75 08             	push   0x8(%ebp)
+  8003e8:	e8 ab ff ff ff       	call   800398 <sys_ipc_recvv>
+}
+  8003ed:	c9                   	leave
+  8003ee:	c3                   	ret
+
+008003ef <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  8003ef:	55                   	push   %ebp
+  8003f0:	89 e5                	mov    %esp,%ebp
+  8003f2:	57                   	push   %edi
+  8003f3:	56                   	push   %esi
+  8003f4:	53                   	push   %ebx
+  8003f5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800400:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800403:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800408:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80040b:	89 de                	mov    %ebx,%esi
+  80040d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80040f:	85 c0                	test   %eax,%eax
+  800411:	7f 08                	jg     80041b <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800413:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800416:	5b                   	pop    %ebx
+  800417:	5e                   	pop    %esi
+  800418:	5f                   	pop    %edi
+  800419:	5d                   	pop    %ebp
+  80041a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80041b:	83 ec 0c             	sub    $0xc,%esp
+  80041e:	50                   	push   %eax
+  80041f:	6a 0d                	push   $0xd
+  800421:	68 6a 37 80 00       	push   $0x80376a
+  800426:	6a 23                	push   $0x23
+  800428:	68 87 37 80 00       	push   $0x803787
+  80042d:	e8 43 21 00 00       	call   802575 <_panic>
+
+00800432 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800432:	55                   	push   %ebp
+  800433:	89 e5                	mov    %esp,%ebp
+  800435:	57                   	push   %edi
+  800436:	56                   	push   %esi
+  800437:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800438:	ba 00 00 00 00       	mov    $0x0,%edx
+  80043d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800442:	89 d1                	mov    %edx,%ecx
+  800444:	89 d3                	mov    %edx,%ebx
+  800446:	89 d7                	mov    %edx,%edi
+  800448:	55                   	push   %ebp
+  800449:	89 e5                	mov    %esp,%ebp
+  80044b:	8d 35 53 04 80 00    	lea    0x800453,%esi
+  800451:	0f 34                	sysenter
+  800453:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800454:	5b                   	pop    %ebx
+  800455:	5e                   	pop    %esi
+  800456:	5f                   	pop    %edi
+  800457:	5d                   	pop    %ebp
+  800458:	c3                   	ret
+
+00800459 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800459:	55                   	push   %ebp
+  80045a:	89 e5                	mov    %esp,%ebp
+  80045c:	57                   	push   %edi
+  80045d:	56                   	push   %esi
+  80045e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80045f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800464:	8b 55 08             	mov    0x8(%ebp),%edx
+  800467:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80046a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80046f:	89 df                	mov    %ebx,%edi
+  800471:	55                   	push   %ebp
+  800472:	89 e5                	mov    %esp,%ebp
+  800474:	8d 35 7c 04 80 00    	lea    0x80047c,%esi
+  80047a:	0f 34                	sysenter
+  80047c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  80047d:	5b                   	pop    %ebx
+  80047e:	5e                   	pop    %esi
+  80047f:	5f                   	pop    %edi
+  800480:	5d                   	pop    %ebp
+  800481:	c3                   	ret
+
+00800482 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800482:	55                   	push   %ebp
+  800483:	89 e5                	mov    %esp,%ebp
+  800485:	57                   	push   %edi
+  800486:	56                   	push   %esi
+  800487:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800488:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80048d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800490:	b8 10 00 00 00       	mov    $0x10,%eax
+  800495:	89 cb                	mov    %ecx,%ebx
+  800497:	89 cf                	mov    %ecx,%edi
+  800499:	55                   	push   %ebp
+  80049a:	89 e5                	mov    %esp,%ebp
+  80049c:	8d 35 a4 04 80 00    	lea    0x8004a4,%esi
+  8004a2:	0f 34                	sysenter
+  8004a4:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  8004a5:	5b                   	pop    %ebx
+  8004a6:	5e                   	pop    %esi
+  8004a7:	5f                   	pop    %edi
+  8004a8:	5d                   	pop    %ebp
+  8004a9:	c3                   	ret
+
+008004aa <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  8004aa:	55                   	push   %ebp
+  8004ab:	89 e5                	mov    %esp,%ebp
+  8004ad:	57                   	push   %edi
+  8004ae:	56                   	push   %esi
+  8004af:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004bb:	b8 12 00 00 00       	mov    $0x12,%eax
+  8004c0:	89 df                	mov    %ebx,%edi
+  8004c2:	55                   	push   %ebp
+  8004c3:	89 e5                	mov    %esp,%ebp
+  8004c5:	8d 35 cd 04 80 00    	lea    0x8004cd,%esi
+  8004cb:	0f 34                	sysenter
+  8004cd:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8004ce:	5b                   	pop    %ebx
+  8004cf:	5e                   	pop    %esi
+  8004d0:	5f                   	pop    %edi
+  8004d1:	5d                   	pop    %ebp
+  8004d2:	c3                   	ret
+
+008004d3 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8004d3:	55                   	push   %ebp
+  8004d4:	89 e5                	mov    %esp,%ebp
+  8004d6:	57                   	push   %edi
+  8004d7:	56                   	push   %esi
+  8004d8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e4:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004e9:	89 df                	mov    %ebx,%edi
+  8004eb:	55                   	push   %ebp
+  8004ec:	89 e5                	mov    %esp,%ebp
+  8004ee:	8d 35 f6 04 80 00    	lea    0x8004f6,%esi
+  8004f4:	0f 34                	sysenter
+  8004f6:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  8004f7:	5b                   	pop    %ebx
+  8004f8:	5e                   	pop    %esi
+  8004f9:	5f                   	pop    %edi
+  8004fa:	5d                   	pop    %ebp
+  8004fb:	c3                   	ret
+
+008004fc <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  8004fc:	55                   	push   %ebp
+  8004fd:	89 e5                	mov    %esp,%ebp
+  8004ff:	57                   	push   %edi
+  800500:	56                   	push   %esi
+  800501:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800502:	8b 55 08             	mov    0x8(%ebp),%edx
+  800505:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800508:	b8 13 00 00 00       	mov    $0x13,%eax
+  80050d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800510:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800513:	55                   	push   %ebp
+  800514:	89 e5                	mov    %esp,%ebp
+  800516:	8d 35 1e 05 80 00    	lea    0x80051e,%esi
+  80051c:	0f 34                	sysenter
+  80051e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  80051f:	5b                   	pop    %ebx
+  800520:	5e                   	pop    %esi
+  800521:	5f                   	pop    %edi
+  800522:	5d                   	pop    %ebp
+  800523:	c3                   	ret
+
+00800524 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800524:	55                   	push   %ebp
+  800525:	89 e5                	mov    %esp,%ebp
+  800527:	57                   	push   %edi
+  800528:	56                   	push   %esi
+  800529:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80052a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80052f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800532:	b8 11 00 00 00       	mov    $0x11,%eax
+  800537:	89 cb                	mov    %ecx,%ebx
+  800539:	89 cf                	mov    %ecx,%edi
+  80053b:	89 ce                	mov    %ecx,%esi
+  80053d:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  80053f:	5b                   	pop    %ebx
+  800540:	5e                   	pop    %esi
+  800541:	5f                   	pop    %edi
+  800542:	5d                   	pop    %ebp
+  800543:	c3                   	ret
+
+00800544 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800544:	55                   	push   %ebp
+  800545:	89 e5                	mov    %esp,%ebp
+  800547:	57                   	push   %edi
+  800548:	56                   	push   %esi
+  800549:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80054a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80054f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800552:	b8 15 00 00 00       	mov    $0x15,%eax
+  800557:	89 cb                	mov    %ecx,%ebx
+  800559:	89 cf                	mov    %ecx,%edi
+  80055b:	55                   	push   %ebp
+  80055c:	89 e5                	mov    %esp,%ebp
+  80055e:	8d 35 66 05 80 00    	lea    0x800566,%esi
+  800564:	0f 34                	sysenter
+  800566:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800567:	5b                   	pop    %ebx
+  800568:	5e                   	pop    %esi
+  800569:	5f                   	pop    %edi
+  80056a:	5d                   	pop    %ebp
+  80056b:	c3                   	ret
+
+0080056c <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  80056c:	55                   	push   %ebp
+  80056d:	89 e5                	mov    %esp,%ebp
+  80056f:	57                   	push   %edi
+  800570:	56                   	push   %esi
+  800571:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800572:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800577:	8b 55 08             	mov    0x8(%ebp),%edx
+  80057a:	b8 16 00 00 00       	mov    $0x16,%eax
+  80057f:	89 cb                	mov    %ecx,%ebx
+  800581:	89 cf                	mov    %ecx,%edi
+  800583:	55                   	push   %ebp
+  800584:	89 e5                	mov    %esp,%ebp
+  800586:	8d 35 8e 05 80 00    	lea    0x80058e,%esi
+  80058c:	0f 34                	sysenter
+  80058e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  80058f:	5b                   	pop    %ebx
+  800590:	5e                   	pop    %esi
+  800591:	5f                   	pop    %edi
+  800592:	5d                   	pop    %ebp
+  800593:	c3                   	ret
+
+00800594 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  800594:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  800595:	a1 04 90 80 00       	mov    0x809004,%eax
+	call *%eax
+  80059a:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80059c:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80059f:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8005a4:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8005a9:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8005ad:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8005b0:	83 c4 08             	add    $0x8,%esp
+	popal
+  8005b3:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8005b4:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8005b7:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8005b8:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8005b9:	c3                   	ret
+
+008005ba <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8005ba:	55                   	push   %ebp
+  8005bb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8005bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005c0:	05 00 00 00 30       	add    $0x30000000,%eax
+  8005c5:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8005c8:	5d                   	pop    %ebp
+  8005c9:	c3                   	ret
+
+008005ca <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8005ca:	55                   	push   %ebp
+  8005cb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8005cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005d0:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8005d5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8005da:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8005df:	5d                   	pop    %ebp
+  8005e0:	c3                   	ret
+
+008005e1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8005e1:	55                   	push   %ebp
+  8005e2:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8005e4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8005e9:	eb 02                	jmp    8005ed <fd_alloc+0xc>
+  8005eb:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8005ed:	89 c2                	mov    %eax,%edx
+  8005ef:	c1 ea 16             	shr    $0x16,%edx
+  8005f2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8005f9:	f6 c2 01             	test   $0x1,%dl
+  8005fc:	74 2b                	je     800629 <fd_alloc+0x48>
+  8005fe:	89 c2                	mov    %eax,%edx
+  800600:	c1 ea 0c             	shr    $0xc,%edx
+  800603:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80060a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800610:	f6 c1 01             	test   $0x1,%cl
+  800613:	74 14                	je     800629 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800615:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80061b:	75 ce                	jne    8005eb <fd_alloc+0xa>
+  80061d:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800622:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800627:	eb 05                	jmp    80062e <fd_alloc+0x4d>
+			return 0;
+  800629:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80062e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800631:	89 02                	mov    %eax,(%edx)
+}
+  800633:	89 c8                	mov    %ecx,%eax
+  800635:	5d                   	pop    %ebp
+  800636:	c3                   	ret
+
+00800637 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800637:	55                   	push   %ebp
+  800638:	89 e5                	mov    %esp,%ebp
+  80063a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80063d:	83 f8 1f             	cmp    $0x1f,%eax
+  800640:	77 30                	ja     800672 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800642:	c1 e0 0c             	shl    $0xc,%eax
+  800645:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80064a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800650:	f6 c2 01             	test   $0x1,%dl
+  800653:	74 24                	je     800679 <fd_lookup+0x42>
+  800655:	89 c2                	mov    %eax,%edx
+  800657:	c1 ea 0c             	shr    $0xc,%edx
+  80065a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800661:	f6 c2 01             	test   $0x1,%dl
+  800664:	74 1a                	je     800680 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800666:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800669:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80066b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800670:	5d                   	pop    %ebp
+  800671:	c3                   	ret
+		return -E_INVAL;
+  800672:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800677:	eb f7                	jmp    800670 <fd_lookup+0x39>
+		return -E_INVAL;
+  800679:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80067e:	eb f0                	jmp    800670 <fd_lookup+0x39>
+  800680:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800685:	eb e9                	jmp    800670 <fd_lookup+0x39>
+
+00800687 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800687:	55                   	push   %ebp
+  800688:	89 e5                	mov    %esp,%ebp
+  80068a:	53                   	push   %ebx
+  80068b:	83 ec 04             	sub    $0x4,%esp
+  80068e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800691:	b8 00 00 00 00       	mov    $0x0,%eax
+  800696:	eb 03                	jmp    80069b <dev_lookup+0x14>
+  800698:	83 c0 01             	add    $0x1,%eax
+  80069b:	8b 1c 85 14 38 80 00 	mov    0x803814(,%eax,4),%ebx
+  8006a2:	85 db                	test   %ebx,%ebx
+  8006a4:	74 0b                	je     8006b1 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8006a6:	39 13                	cmp    %edx,(%ebx)
+  8006a8:	75 ee                	jne    800698 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8006aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006af:	eb 1f                	jmp    8006d0 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8006b1:	a1 00 50 80 00       	mov    0x805000,%eax
+  8006b6:	8b 40 48             	mov    0x48(%eax),%eax
+  8006b9:	83 ec 04             	sub    $0x4,%esp
+  8006bc:	52                   	push   %edx
+  8006bd:	50                   	push   %eax
+  8006be:	68 98 37 80 00       	push   $0x803798
+  8006c3:	e8 88 1f 00 00       	call   802650 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8006c8:	83 c4 10             	add    $0x10,%esp
+  8006cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8006d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006d3:	89 1a                	mov    %ebx,(%edx)
+}
+  8006d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006d8:	c9                   	leave
+  8006d9:	c3                   	ret
+
+008006da <fd_close>:
+{
+  8006da:	55                   	push   %ebp
+  8006db:	89 e5                	mov    %esp,%ebp
+  8006dd:	57                   	push   %edi
+  8006de:	56                   	push   %esi
+  8006df:	53                   	push   %ebx
+  8006e0:	83 ec 24             	sub    $0x24,%esp
+  8006e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006e6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006e9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8006ec:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8006ed:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8006f3:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006f6:	50                   	push   %eax
+  8006f7:	e8 3b ff ff ff       	call   800637 <fd_lookup>
+  8006fc:	89 c3                	mov    %eax,%ebx
+  8006fe:	83 c4 10             	add    $0x10,%esp
+  800701:	85 c0                	test   %eax,%eax
+  800703:	78 05                	js     80070a <fd_close+0x30>
+	    || fd != fd2)
+  800705:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800708:	74 16                	je     800720 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80070a:	89 f8                	mov    %edi,%eax
+  80070c:	84 c0                	test   %al,%al
+  80070e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800713:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800716:	89 d8                	mov    %ebx,%eax
+  800718:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80071b:	5b                   	pop    %ebx
+  80071c:	5e                   	pop    %esi
+  80071d:	5f                   	pop    %edi
+  80071e:	5d                   	pop    %ebp
+  80071f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800720:	83 ec 08             	sub    $0x8,%esp
+  800723:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800726:	50                   	push   %eax
+  800727:	ff 36                	push   (%esi)
+  800729:	e8 59 ff ff ff       	call   800687 <dev_lookup>
+  80072e:	89 c3                	mov    %eax,%ebx
+  800730:	83 c4 10             	add    $0x10,%esp
+  800733:	85 c0                	test   %eax,%eax
+  800735:	78 1a                	js     800751 <fd_close+0x77>
+		if (dev->dev_close)
+  800737:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80073a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80073d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800742:	85 c0                	test   %eax,%eax
+  800744:	74 0b                	je     800751 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800746:	83 ec 0c             	sub    $0xc,%esp
+  800749:	56                   	push   %esi
+  80074a:	ff d0                	call   *%eax
+  80074c:	89 c3                	mov    %eax,%ebx
+  80074e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800751:	83 ec 08             	sub    $0x8,%esp
+  800754:	56                   	push   %esi
+  800755:	6a 00                	push   $0x0
+  800757:	e8 c4 fa ff ff       	call   800220 <sys_page_unmap>
+	return r;
+  80075c:	83 c4 10             	add    $0x10,%esp
+  80075f:	eb b5                	jmp    800716 <fd_close+0x3c>
+
+00800761 <close>:
+
+int
+close(int fdnum)
+{
+  800761:	55                   	push   %ebp
+  800762:	89 e5                	mov    %esp,%ebp
+  800764:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800767:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80076a:	50                   	push   %eax
+  80076b:	ff 75 08             	push   0x8(%ebp)
+  80076e:	e8 c4 fe ff ff       	call   800637 <fd_lookup>
+  800773:	83 c4 10             	add    $0x10,%esp
+  800776:	85 c0                	test   %eax,%eax
+  800778:	79 02                	jns    80077c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80077a:	c9                   	leave
+  80077b:	c3                   	ret
+		return fd_close(fd, 1);
+  80077c:	83 ec 08             	sub    $0x8,%esp
+  80077f:	6a 01                	push   $0x1
+  800781:	ff 75 f4             	push   -0xc(%ebp)
+  800784:	e8 51 ff ff ff       	call   8006da <fd_close>
+  800789:	83 c4 10             	add    $0x10,%esp
+  80078c:	eb ec                	jmp    80077a <close+0x19>
+
+0080078e <close_all>:
+
+void
+close_all(void)
+{
+  80078e:	55                   	push   %ebp
+  80078f:	89 e5                	mov    %esp,%ebp
+  800791:	53                   	push   %ebx
+  800792:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800795:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80079a:	83 ec 0c             	sub    $0xc,%esp
+  80079d:	53                   	push   %ebx
+  80079e:	e8 be ff ff ff       	call   800761 <close>
+	for (i = 0; i < MAXFD; i++)
+  8007a3:	83 c3 01             	add    $0x1,%ebx
+  8007a6:	83 c4 10             	add    $0x10,%esp
+  8007a9:	83 fb 20             	cmp    $0x20,%ebx
+  8007ac:	75 ec                	jne    80079a <close_all+0xc>
+}
+  8007ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007b1:	c9                   	leave
+  8007b2:	c3                   	ret
+
+008007b3 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8007b3:	55                   	push   %ebp
+  8007b4:	89 e5                	mov    %esp,%ebp
+  8007b6:	57                   	push   %edi
+  8007b7:	56                   	push   %esi
+  8007b8:	53                   	push   %ebx
+  8007b9:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8007bc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8007bf:	50                   	push   %eax
+  8007c0:	ff 75 08             	push   0x8(%ebp)
+  8007c3:	e8 6f fe ff ff       	call   800637 <fd_lookup>
+  8007c8:	89 c3                	mov    %eax,%ebx
+  8007ca:	83 c4 10             	add    $0x10,%esp
+  8007cd:	85 c0                	test   %eax,%eax
+  8007cf:	78 7f                	js     800850 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8007d1:	83 ec 0c             	sub    $0xc,%esp
+  8007d4:	ff 75 0c             	push   0xc(%ebp)
+  8007d7:	e8 85 ff ff ff       	call   800761 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8007dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8007df:	c1 e6 0c             	shl    $0xc,%esi
+  8007e2:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8007e8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8007eb:	89 3c 24             	mov    %edi,(%esp)
+  8007ee:	e8 d7 fd ff ff       	call   8005ca <fd2data>
+  8007f3:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8007f5:	89 34 24             	mov    %esi,(%esp)
+  8007f8:	e8 cd fd ff ff       	call   8005ca <fd2data>
+  8007fd:	83 c4 10             	add    $0x10,%esp
+  800800:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  800803:	89 d8                	mov    %ebx,%eax
+  800805:	c1 e8 16             	shr    $0x16,%eax
+  800808:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80080f:	a8 01                	test   $0x1,%al
+  800811:	74 11                	je     800824 <dup+0x71>
+  800813:	89 d8                	mov    %ebx,%eax
+  800815:	c1 e8 0c             	shr    $0xc,%eax
+  800818:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80081f:	f6 c2 01             	test   $0x1,%dl
+  800822:	75 36                	jne    80085a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800824:	89 f8                	mov    %edi,%eax
+  800826:	c1 e8 0c             	shr    $0xc,%eax
+  800829:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800830:	83 ec 0c             	sub    $0xc,%esp
+  800833:	25 07 0e 00 00       	and    $0xe07,%eax
+  800838:	50                   	push   %eax
+  800839:	56                   	push   %esi
+  80083a:	6a 00                	push   $0x0
+  80083c:	57                   	push   %edi
+  80083d:	6a 00                	push   $0x0
+  80083f:	e8 9a f9 ff ff       	call   8001de <sys_page_map>
+  800844:	89 c3                	mov    %eax,%ebx
+  800846:	83 c4 20             	add    $0x20,%esp
+  800849:	85 c0                	test   %eax,%eax
+  80084b:	78 33                	js     800880 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80084d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800850:	89 d8                	mov    %ebx,%eax
+  800852:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800855:	5b                   	pop    %ebx
+  800856:	5e                   	pop    %esi
+  800857:	5f                   	pop    %edi
+  800858:	5d                   	pop    %ebp
+  800859:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80085a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800861:	83 ec 0c             	sub    $0xc,%esp
+  800864:	25 07 0e 00 00       	and    $0xe07,%eax
+  800869:	50                   	push   %eax
+  80086a:	ff 75 d4             	push   -0x2c(%ebp)
+  80086d:	6a 00                	push   $0x0
+  80086f:	53                   	push   %ebx
+  800870:	6a 00                	push   $0x0
+  800872:	e8 67 f9 ff ff       	call   8001de <sys_page_map>
+  800877:	89 c3                	mov    %eax,%ebx
+  800879:	83 c4 20             	add    $0x20,%esp
+  80087c:	85 c0                	test   %eax,%eax
+  80087e:	79 a4                	jns    800824 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800880:	83 ec 08             	sub    $0x8,%esp
+  800883:	56                   	push   %esi
+  800884:	6a 00                	push   $0x0
+  800886:	e8 95 f9 ff ff       	call   800220 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80088b:	83 c4 08             	add    $0x8,%esp
+  80088e:	ff 75 d4             	push   -0x2c(%ebp)
+  800891:	6a 00                	push   $0x0
+  800893:	e8 88 f9 ff ff       	call   800220 <sys_page_unmap>
+	return r;
+  800898:	83 c4 10             	add    $0x10,%esp
+  80089b:	eb b3                	jmp    800850 <dup+0x9d>
+
+0080089d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80089d:	55                   	push   %ebp
+  80089e:	89 e5                	mov    %esp,%ebp
+  8008a0:	56                   	push   %esi
+  8008a1:	53                   	push   %ebx
+  8008a2:	83 ec 18             	sub    $0x18,%esp
+  8008a5:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8008a8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8008ab:	50                   	push   %eax
+  8008ac:	56                   	push   %esi
+  8008ad:	e8 85 fd ff ff       	call   800637 <fd_lookup>
+  8008b2:	83 c4 10             	add    $0x10,%esp
+  8008b5:	85 c0                	test   %eax,%eax
+  8008b7:	78 3c                	js     8008f5 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8008b9:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8008bc:	83 ec 08             	sub    $0x8,%esp
+  8008bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008c2:	50                   	push   %eax
+  8008c3:	ff 33                	push   (%ebx)
+  8008c5:	e8 bd fd ff ff       	call   800687 <dev_lookup>
+  8008ca:	83 c4 10             	add    $0x10,%esp
+  8008cd:	85 c0                	test   %eax,%eax
+  8008cf:	78 24                	js     8008f5 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8008d1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8008d4:	83 e0 03             	and    $0x3,%eax
+  8008d7:	83 f8 01             	cmp    $0x1,%eax
+  8008da:	74 20                	je     8008fc <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8008dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008df:	8b 40 08             	mov    0x8(%eax),%eax
+  8008e2:	85 c0                	test   %eax,%eax
+  8008e4:	74 37                	je     80091d <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8008e6:	83 ec 04             	sub    $0x4,%esp
+  8008e9:	ff 75 10             	push   0x10(%ebp)
+  8008ec:	ff 75 0c             	push   0xc(%ebp)
+  8008ef:	53                   	push   %ebx
+  8008f0:	ff d0                	call   *%eax
+  8008f2:	83 c4 10             	add    $0x10,%esp
+}
+  8008f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008f8:	5b                   	pop    %ebx
+  8008f9:	5e                   	pop    %esi
+  8008fa:	5d                   	pop    %ebp
+  8008fb:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8008fc:	a1 00 50 80 00       	mov    0x805000,%eax
+  800901:	8b 40 48             	mov    0x48(%eax),%eax
+  800904:	83 ec 04             	sub    $0x4,%esp
+  800907:	56                   	push   %esi
+  800908:	50                   	push   %eax
+  800909:	68 d9 37 80 00       	push   $0x8037d9
+  80090e:	e8 3d 1d 00 00       	call   802650 <cprintf>
+		return -E_INVAL;
+  800913:	83 c4 10             	add    $0x10,%esp
+  800916:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80091b:	eb d8                	jmp    8008f5 <read+0x58>
+		return -E_NOT_SUPP;
+  80091d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800922:	eb d1                	jmp    8008f5 <read+0x58>
+
+00800924 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	57                   	push   %edi
+  800928:	56                   	push   %esi
+  800929:	53                   	push   %ebx
+  80092a:	83 ec 0c             	sub    $0xc,%esp
+  80092d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800930:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800933:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800938:	eb 02                	jmp    80093c <readn+0x18>
+  80093a:	01 c3                	add    %eax,%ebx
+  80093c:	39 f3                	cmp    %esi,%ebx
+  80093e:	73 21                	jae    800961 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800940:	83 ec 04             	sub    $0x4,%esp
+  800943:	89 f0                	mov    %esi,%eax
+  800945:	29 d8                	sub    %ebx,%eax
+  800947:	50                   	push   %eax
+  800948:	89 d8                	mov    %ebx,%eax
+  80094a:	03 45 0c             	add    0xc(%ebp),%eax
+  80094d:	50                   	push   %eax
+  80094e:	57                   	push   %edi
+  80094f:	e8 49 ff ff ff       	call   80089d <read>
+		if (m < 0)
+  800954:	83 c4 10             	add    $0x10,%esp
+  800957:	85 c0                	test   %eax,%eax
+  800959:	78 04                	js     80095f <readn+0x3b>
+			return m;
+		if (m == 0)
+  80095b:	75 dd                	jne    80093a <readn+0x16>
+  80095d:	eb 02                	jmp    800961 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80095f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800961:	89 d8                	mov    %ebx,%eax
+  800963:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800966:	5b                   	pop    %ebx
+  800967:	5e                   	pop    %esi
+  800968:	5f                   	pop    %edi
+  800969:	5d                   	pop    %ebp
+  80096a:	c3                   	ret
+
+0080096b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80096b:	55                   	push   %ebp
+  80096c:	89 e5                	mov    %esp,%ebp
+  80096e:	56                   	push   %esi
+  80096f:	53                   	push   %ebx
+  800970:	83 ec 18             	sub    $0x18,%esp
+  800973:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800976:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800979:	50                   	push   %eax
+  80097a:	53                   	push   %ebx
+  80097b:	e8 b7 fc ff ff       	call   800637 <fd_lookup>
+  800980:	83 c4 10             	add    $0x10,%esp
+  800983:	85 c0                	test   %eax,%eax
+  800985:	78 37                	js     8009be <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800987:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80098a:	83 ec 08             	sub    $0x8,%esp
+  80098d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800990:	50                   	push   %eax
+  800991:	ff 36                	push   (%esi)
+  800993:	e8 ef fc ff ff       	call   800687 <dev_lookup>
+  800998:	83 c4 10             	add    $0x10,%esp
+  80099b:	85 c0                	test   %eax,%eax
+  80099d:	78 1f                	js     8009be <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80099f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8009a3:	74 20                	je     8009c5 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8009a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009a8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8009ab:	85 c0                	test   %eax,%eax
+  8009ad:	74 37                	je     8009e6 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8009af:	83 ec 04             	sub    $0x4,%esp
+  8009b2:	ff 75 10             	push   0x10(%ebp)
+  8009b5:	ff 75 0c             	push   0xc(%ebp)
+  8009b8:	56                   	push   %esi
+  8009b9:	ff d0                	call   *%eax
+  8009bb:	83 c4 10             	add    $0x10,%esp
+}
+  8009be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009c1:	5b                   	pop    %ebx
+  8009c2:	5e                   	pop    %esi
+  8009c3:	5d                   	pop    %ebp
+  8009c4:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8009c5:	a1 00 50 80 00       	mov    0x805000,%eax
+  8009ca:	8b 40 48             	mov    0x48(%eax),%eax
+  8009cd:	83 ec 04             	sub    $0x4,%esp
+  8009d0:	53                   	push   %ebx
+  8009d1:	50                   	push   %eax
+  8009d2:	68 f5 37 80 00       	push   $0x8037f5
+  8009d7:	e8 74 1c 00 00       	call   802650 <cprintf>
+		return -E_INVAL;
+  8009dc:	83 c4 10             	add    $0x10,%esp
+  8009df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009e4:	eb d8                	jmp    8009be <write+0x53>
+		return -E_NOT_SUPP;
+  8009e6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009eb:	eb d1                	jmp    8009be <write+0x53>
+
+008009ed <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8009ed:	55                   	push   %ebp
+  8009ee:	89 e5                	mov    %esp,%ebp
+  8009f0:	53                   	push   %ebx
+  8009f1:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009f4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009f7:	50                   	push   %eax
+  8009f8:	ff 75 08             	push   0x8(%ebp)
+  8009fb:	e8 37 fc ff ff       	call   800637 <fd_lookup>
+  800a00:	83 c4 10             	add    $0x10,%esp
+  800a03:	85 c0                	test   %eax,%eax
+  800a05:	78 3a                	js     800a41 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a07:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a0a:	83 ec 08             	sub    $0x8,%esp
+  800a0d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a10:	50                   	push   %eax
+  800a11:	ff 33                	push   (%ebx)
+  800a13:	e8 6f fc ff ff       	call   800687 <dev_lookup>
+  800a18:	83 c4 10             	add    $0x10,%esp
+  800a1b:	85 c0                	test   %eax,%eax
+  800a1d:	78 22                	js     800a41 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  800a1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a22:	8b 40 1c             	mov    0x1c(%eax),%eax
+  800a25:	85 c0                	test   %eax,%eax
+  800a27:	74 0d                	je     800a36 <seek+0x49>
+  800a29:	83 ec 0c             	sub    $0xc,%esp
+  800a2c:	53                   	push   %ebx
+  800a2d:	ff d0                	call   *%eax
+  800a2f:	83 c4 10             	add    $0x10,%esp
+  800a32:	85 c0                	test   %eax,%eax
+  800a34:	78 0b                	js     800a41 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  800a36:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a39:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  800a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a44:	c9                   	leave
+  800a45:	c3                   	ret
+
+00800a46 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  800a46:	55                   	push   %ebp
+  800a47:	89 e5                	mov    %esp,%ebp
+  800a49:	53                   	push   %ebx
+  800a4a:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a4d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a50:	50                   	push   %eax
+  800a51:	ff 75 08             	push   0x8(%ebp)
+  800a54:	e8 de fb ff ff       	call   800637 <fd_lookup>
+  800a59:	83 c4 10             	add    $0x10,%esp
+  800a5c:	85 c0                	test   %eax,%eax
+  800a5e:	78 2b                	js     800a8b <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a60:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a63:	83 ec 08             	sub    $0x8,%esp
+  800a66:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a69:	50                   	push   %eax
+  800a6a:	ff 33                	push   (%ebx)
+  800a6c:	e8 16 fc ff ff       	call   800687 <dev_lookup>
+  800a71:	83 c4 10             	add    $0x10,%esp
+  800a74:	85 c0                	test   %eax,%eax
+  800a76:	78 13                	js     800a8b <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  800a78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a7b:	8b 40 1c             	mov    0x1c(%eax),%eax
+  800a7e:	85 c0                	test   %eax,%eax
+  800a80:	74 0e                	je     800a90 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  800a82:	83 ec 0c             	sub    $0xc,%esp
+  800a85:	53                   	push   %ebx
+  800a86:	ff d0                	call   *%eax
+  800a88:	83 c4 10             	add    $0x10,%esp
+}
+  800a8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a8e:	c9                   	leave
+  800a8f:	c3                   	ret
+		return 0;
+  800a90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a95:	eb f4                	jmp    800a8b <fsync+0x45>
+
+00800a97 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a97:	55                   	push   %ebp
+  800a98:	89 e5                	mov    %esp,%ebp
+  800a9a:	56                   	push   %esi
+  800a9b:	53                   	push   %ebx
+  800a9c:	83 ec 18             	sub    $0x18,%esp
+  800a9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800aa2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800aa5:	50                   	push   %eax
+  800aa6:	53                   	push   %ebx
+  800aa7:	e8 8b fb ff ff       	call   800637 <fd_lookup>
+  800aac:	83 c4 10             	add    $0x10,%esp
+  800aaf:	85 c0                	test   %eax,%eax
+  800ab1:	78 34                	js     800ae7 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800ab3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800ab6:	83 ec 08             	sub    $0x8,%esp
+  800ab9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800abc:	50                   	push   %eax
+  800abd:	ff 36                	push   (%esi)
+  800abf:	e8 c3 fb ff ff       	call   800687 <dev_lookup>
+  800ac4:	83 c4 10             	add    $0x10,%esp
+  800ac7:	85 c0                	test   %eax,%eax
+  800ac9:	78 1c                	js     800ae7 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800acb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800acf:	74 1d                	je     800aee <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800ad1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ad4:	8b 40 18             	mov    0x18(%eax),%eax
+  800ad7:	85 c0                	test   %eax,%eax
+  800ad9:	74 34                	je     800b0f <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800adb:	83 ec 08             	sub    $0x8,%esp
+  800ade:	ff 75 0c             	push   0xc(%ebp)
+  800ae1:	56                   	push   %esi
+  800ae2:	ff d0                	call   *%eax
+  800ae4:	83 c4 10             	add    $0x10,%esp
+}
+  800ae7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aea:	5b                   	pop    %ebx
+  800aeb:	5e                   	pop    %esi
+  800aec:	5d                   	pop    %ebp
+  800aed:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800aee:	a1 00 50 80 00       	mov    0x805000,%eax
+  800af3:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800af6:	83 ec 04             	sub    $0x4,%esp
+  800af9:	53                   	push   %ebx
+  800afa:	50                   	push   %eax
+  800afb:	68 b8 37 80 00       	push   $0x8037b8
+  800b00:	e8 4b 1b 00 00       	call   802650 <cprintf>
+		return -E_INVAL;
+  800b05:	83 c4 10             	add    $0x10,%esp
+  800b08:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b0d:	eb d8                	jmp    800ae7 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800b0f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b14:	eb d1                	jmp    800ae7 <ftruncate+0x50>
+
+00800b16 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800b16:	55                   	push   %ebp
+  800b17:	89 e5                	mov    %esp,%ebp
+  800b19:	56                   	push   %esi
+  800b1a:	53                   	push   %ebx
+  800b1b:	83 ec 18             	sub    $0x18,%esp
+  800b1e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b21:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b24:	50                   	push   %eax
+  800b25:	ff 75 08             	push   0x8(%ebp)
+  800b28:	e8 0a fb ff ff       	call   800637 <fd_lookup>
+  800b2d:	83 c4 10             	add    $0x10,%esp
+  800b30:	85 c0                	test   %eax,%eax
+  800b32:	78 49                	js     800b7d <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b34:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b37:	83 ec 08             	sub    $0x8,%esp
+  800b3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b3d:	50                   	push   %eax
+  800b3e:	ff 36                	push   (%esi)
+  800b40:	e8 42 fb ff ff       	call   800687 <dev_lookup>
+  800b45:	83 c4 10             	add    $0x10,%esp
+  800b48:	85 c0                	test   %eax,%eax
+  800b4a:	78 31                	js     800b7d <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b4f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b53:	74 2f                	je     800b84 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b55:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b58:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b5f:	00 00 00 
+	stat->st_isdir = 0;
+  800b62:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b69:	00 00 00 
+	stat->st_dev = dev;
+  800b6c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b72:	83 ec 08             	sub    $0x8,%esp
+  800b75:	53                   	push   %ebx
+  800b76:	56                   	push   %esi
+  800b77:	ff 50 14             	call   *0x14(%eax)
+  800b7a:	83 c4 10             	add    $0x10,%esp
+}
+  800b7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b80:	5b                   	pop    %ebx
+  800b81:	5e                   	pop    %esi
+  800b82:	5d                   	pop    %ebp
+  800b83:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b84:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b89:	eb f2                	jmp    800b7d <fstat+0x67>
+
+00800b8b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b8b:	55                   	push   %ebp
+  800b8c:	89 e5                	mov    %esp,%ebp
+  800b8e:	56                   	push   %esi
+  800b8f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  800b90:	83 ec 08             	sub    $0x8,%esp
+  800b93:	68 00 10 00 00       	push   $0x1000
+  800b98:	ff 75 08             	push   0x8(%ebp)
+  800b9b:	e8 b3 07 00 00       	call   801353 <open>
+  800ba0:	89 c3                	mov    %eax,%ebx
+  800ba2:	83 c4 10             	add    $0x10,%esp
+  800ba5:	85 c0                	test   %eax,%eax
+  800ba7:	78 1b                	js     800bc4 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  800ba9:	83 ec 08             	sub    $0x8,%esp
+  800bac:	ff 75 0c             	push   0xc(%ebp)
+  800baf:	50                   	push   %eax
+  800bb0:	e8 61 ff ff ff       	call   800b16 <fstat>
+  800bb5:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800bb7:	89 1c 24             	mov    %ebx,(%esp)
+  800bba:	e8 a2 fb ff ff       	call   800761 <close>
+	return r;
+  800bbf:	83 c4 10             	add    $0x10,%esp
+  800bc2:	89 f3                	mov    %esi,%ebx
+}
+  800bc4:	89 d8                	mov    %ebx,%eax
+  800bc6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bc9:	5b                   	pop    %ebx
+  800bca:	5e                   	pop    %esi
+  800bcb:	5d                   	pop    %ebp
+  800bcc:	c3                   	ret
+
+00800bcd <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  800bcd:	55                   	push   %ebp
+  800bce:	89 e5                	mov    %esp,%ebp
+  800bd0:	57                   	push   %edi
+  800bd1:	56                   	push   %esi
+  800bd2:	53                   	push   %ebx
+  800bd3:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  800bd9:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  800bdf:	89 d6                	mov    %edx,%esi
+  800be1:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  800be7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  800bea:	89 d3                	mov    %edx,%ebx
+  800bec:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  800bf2:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800bf9:	74 1d                	je     800c18 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  800bfb:	b8 00 60 80 00       	mov    $0x806000,%eax
+  800c00:	83 c8 07             	or     $0x7,%eax
+  800c03:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  800c09:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800c0e:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  800c14:	01 ce                	add    %ecx,%esi
+  800c16:	eb 28                	jmp    800c40 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800c18:	83 ec 0c             	sub    $0xc,%esp
+  800c1b:	6a 01                	push   $0x1
+  800c1d:	e8 78 28 00 00       	call   80349a <ipc_find_env>
+  800c22:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800c27:	83 c4 10             	add    $0x10,%esp
+  800c2a:	eb cf                	jmp    800bfb <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  800c2c:	83 c0 01             	add    $0x1,%eax
+  800c2f:	89 fa                	mov    %edi,%edx
+  800c31:	09 da                	or     %ebx,%edx
+  800c33:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800c3a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800c40:	39 f3                	cmp    %esi,%ebx
+  800c42:	72 e8                	jb     800c2c <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  800c44:	83 f8 41             	cmp    $0x41,%eax
+  800c47:	77 2f                	ja     800c78 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  800c49:	50                   	push   %eax
+  800c4a:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  800c50:	50                   	push   %eax
+  800c51:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  800c57:	ff 35 c8 70 80 00    	push   0x8070c8
+  800c5d:	e8 ea 27 00 00       	call   80344c <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  800c62:	83 c4 0c             	add    $0xc,%esp
+  800c65:	6a 00                	push   $0x0
+  800c67:	6a 00                	push   $0x0
+  800c69:	6a 00                	push   $0x0
+  800c6b:	e8 86 26 00 00       	call   8032f6 <ipc_recv>
+}
+  800c70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c73:	5b                   	pop    %ebx
+  800c74:	5e                   	pop    %esi
+  800c75:	5f                   	pop    %edi
+  800c76:	5d                   	pop    %ebp
+  800c77:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  800c78:	68 28 38 80 00       	push   $0x803828
+  800c7d:	68 44 38 80 00       	push   $0x803844
+  800c82:	6a 40                	push   $0x40
+  800c84:	68 59 38 80 00       	push   $0x803859
+  800c89:	e8 e7 18 00 00       	call   802575 <_panic>
+
+00800c8e <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  800c8e:	55                   	push   %ebp
+  800c8f:	89 e5                	mov    %esp,%ebp
+  800c91:	57                   	push   %edi
+  800c92:	56                   	push   %esi
+  800c93:	53                   	push   %ebx
+  800c94:	83 ec 1c             	sub    $0x1c,%esp
+  800c97:	89 c3                	mov    %eax,%ebx
+  800c99:	89 d6                	mov    %edx,%esi
+  800c9b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  800c9e:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  800ca4:	89 ca                	mov    %ecx,%edx
+  800ca6:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  800ca9:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  800cb0:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  800cb3:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  800cba:	8b 76 0c             	mov    0xc(%esi),%esi
+  800cbd:	89 fb                	mov    %edi,%ebx
+  800cbf:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  800cc6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800cc9:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  800cd0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cd3:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  800cda:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cdd:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  800ce4:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  800ce7:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  800cee:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  800cf3:	39 c8                	cmp    %ecx,%eax
+  800cf5:	74 0d                	je     800d04 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  800cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cff:	5b                   	pop    %ebx
+  800d00:	5e                   	pop    %esi
+  800d01:	5f                   	pop    %edi
+  800d02:	5d                   	pop    %ebp
+  800d03:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800d04:	6a 07                	push   $0x7
+  800d06:	68 00 60 80 00       	push   $0x806000
+  800d0b:	6a 0d                	push   $0xd
+  800d0d:	ff 35 c8 70 80 00    	push   0x8070c8
+  800d13:	e8 49 26 00 00       	call   803361 <ipc_send>
+  800d18:	83 c4 10             	add    $0x10,%esp
+  800d1b:	eb da                	jmp    800cf7 <fsring_post+0x69>
+
+00800d1d <fsipcv>:
+{
+  800d1d:	55                   	push   %ebp
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	57                   	push   %edi
+  800d21:	56                   	push   %esi
+  800d22:	53                   	push   %ebx
+  800d23:	83 ec 0c             	sub    $0xc,%esp
+  800d26:	89 c7                	mov    %eax,%edi
+  800d28:	89 d3                	mov    %edx,%ebx
+  800d2a:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  800d2c:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800d33:	74 26                	je     800d5b <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800d35:	6a 07                	push   $0x7
+  800d37:	68 00 60 80 00       	push   $0x806000
+  800d3c:	57                   	push   %edi
+  800d3d:	ff 35 c8 70 80 00    	push   0x8070c8
+  800d43:	e8 19 26 00 00       	call   803361 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  800d48:	6a 00                	push   $0x0
+  800d4a:	56                   	push   %esi
+  800d4b:	53                   	push   %ebx
+  800d4c:	6a 00                	push   $0x0
+  800d4e:	e8 66 26 00 00       	call   8033b9 <ipc_recvv>
+}
+  800d53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d56:	5b                   	pop    %ebx
+  800d57:	5e                   	pop    %esi
+  800d58:	5f                   	pop    %edi
+  800d59:	5d                   	pop    %ebp
+  800d5a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d5b:	83 ec 0c             	sub    $0xc,%esp
+  800d5e:	6a 01                	push   $0x1
+  800d60:	e8 35 27 00 00       	call   80349a <ipc_find_env>
+  800d65:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800d6a:	83 c4 10             	add    $0x10,%esp
+  800d6d:	eb c6                	jmp    800d35 <fsipcv+0x18>
+
+00800d6f <fsipc>:
+{
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  800d75:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  800d7c:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800d7f:	e8 99 ff ff ff       	call   800d1d <fsipcv>
+}
+  800d84:	c9                   	leave
+  800d85:	c3                   	ret
+
+00800d86 <file_write_direct>:
+{
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	56                   	push   %esi
+  800d8a:	53                   	push   %ebx
+  800d8b:	89 c3                	mov    %eax,%ebx
+  800d8d:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800d8f:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  800d95:	77 40                	ja     800dd7 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800d97:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  800d9c:	39 c8                	cmp    %ecx,%eax
+  800d9e:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800da1:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  800da4:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  800daa:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800daf:	83 ec 04             	sub    $0x4,%esp
+  800db2:	50                   	push   %eax
+  800db3:	52                   	push   %edx
+  800db4:	68 08 60 80 00       	push   $0x806008
+  800db9:	e8 06 20 00 00       	call   802dc4 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800dbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc3:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dc8:	e8 a2 ff ff ff       	call   800d6f <fsipc>
+  800dcd:	83 c4 10             	add    $0x10,%esp
+}
+  800dd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dd3:	5b                   	pop    %ebx
+  800dd4:	5e                   	pop    %esi
+  800dd5:	5d                   	pop    %ebp
+  800dd6:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  800dd7:	89 d6                	mov    %edx,%esi
+  800dd9:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  800ddf:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  800de4:	29 f1                	sub    %esi,%ecx
+  800de6:	39 c1                	cmp    %eax,%ecx
+  800de8:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  800deb:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800dee:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  800df3:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  800df9:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  800dff:	83 ec 0c             	sub    $0xc,%esp
+  800e02:	6a 05                	push   $0x5
+  800e04:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e09:	e8 bf fd ff ff       	call   800bcd <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  800e0e:	83 c4 10             	add    $0x10,%esp
+  800e11:	eb bd                	jmp    800dd0 <file_write_direct+0x4a>
+
+00800e13 <devfile_sync>:
+{
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+  800e19:	83 ec 28             	sub    $0x28,%esp
+  800e1c:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  800e1f:	56                   	push   %esi
+  800e20:	e8 a5 f7 ff ff       	call   8005ca <fd2data>
+  800e25:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  800e27:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  800e2a:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  800e31:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800e34:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  800e39:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  800e3d:	74 45                	je     800e84 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  800e3f:	8b 46 14             	mov    0x14(%esi),%eax
+  800e42:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e4f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e52:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  800e55:	39 cb                	cmp    %ecx,%ebx
+  800e57:	73 14                	jae    800e6d <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  800e59:	29 d9                	sub    %ebx,%ecx
+  800e5b:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800e5e:	89 f0                	mov    %esi,%eax
+  800e60:	e8 21 ff ff ff       	call   800d86 <file_write_direct>
+  800e65:	85 c0                	test   %eax,%eax
+  800e67:	7e 04                	jle    800e6d <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e69:	01 c3                	add    %eax,%ebx
+  800e6b:	eb e5                	jmp    800e52 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  800e6d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e70:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  800e77:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  800e7a:	85 c0                	test   %eax,%eax
+  800e7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e81:	0f 4f c2             	cmovg  %edx,%eax
+}
+  800e84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e87:	5b                   	pop    %ebx
+  800e88:	5e                   	pop    %esi
+  800e89:	5f                   	pop    %edi
+  800e8a:	5d                   	pop    %ebp
+  800e8b:	c3                   	ret
+
+00800e8c <devfile_write>:
+{
+  800e8c:	55                   	push   %ebp
+  800e8d:	89 e5                	mov    %esp,%ebp
+  800e8f:	57                   	push   %edi
+  800e90:	56                   	push   %esi
+  800e91:	53                   	push   %ebx
+  800e92:	83 ec 28             	sub    $0x28,%esp
+  800e95:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e98:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  800e9b:	53                   	push   %ebx
+  800e9c:	e8 29 f7 ff ff       	call   8005ca <fd2data>
+  800ea1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  800ea4:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  800ea7:	83 c4 10             	add    $0x10,%esp
+  800eaa:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  800eae:	74 43                	je     800ef3 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  800eb0:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  800eb7:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800eba:	85 c0                	test   %eax,%eax
+  800ebc:	74 43                	je     800f01 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  800ebe:	89 c2                	mov    %eax,%edx
+  800ec0:	03 53 14             	add    0x14(%ebx),%edx
+  800ec3:	39 fa                	cmp    %edi,%edx
+  800ec5:	75 0b                	jne    800ed2 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  800ec7:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  800eca:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  800ed0:	76 66                	jbe    800f38 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  800ed2:	83 ec 0c             	sub    $0xc,%esp
+  800ed5:	53                   	push   %ebx
+  800ed6:	e8 38 ff ff ff       	call   800e13 <devfile_sync>
+  800edb:	83 c4 10             	add    $0x10,%esp
+  800ede:	85 c0                	test   %eax,%eax
+  800ee0:	78 4e                	js     800f30 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800ee2:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800ee8:	77 56                	ja     800f40 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  800eea:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800eed:	85 c0                	test   %eax,%eax
+  800eef:	75 20                	jne    800f11 <devfile_write+0x85>
+  800ef1:	eb 16                	jmp    800f09 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  800ef3:	89 f1                	mov    %esi,%ecx
+  800ef5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ef8:	89 d8                	mov    %ebx,%eax
+  800efa:	e8 87 fe ff ff       	call   800d86 <file_write_direct>
+  800eff:	eb 2f                	jmp    800f30 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800f01:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800f07:	77 37                	ja     800f40 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  800f09:	89 7b 14             	mov    %edi,0x14(%ebx)
+  800f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  800f11:	83 ec 04             	sub    $0x4,%esp
+  800f14:	56                   	push   %esi
+  800f15:	ff 75 0c             	push   0xc(%ebp)
+  800f18:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800f1b:	01 c1                	add    %eax,%ecx
+  800f1d:	51                   	push   %ecx
+  800f1e:	e8 a1 1e 00 00       	call   802dc4 <memmove>
+	ff->buf_wlen += n;
+  800f23:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  800f26:	01 f7                	add    %esi,%edi
+  800f28:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  800f2b:	89 f0                	mov    %esi,%eax
+  800f2d:	83 c4 10             	add    $0x10,%esp
+}
+  800f30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f33:	5b                   	pop    %ebx
+  800f34:	5e                   	pop    %esi
+  800f35:	5f                   	pop    %edi
+  800f36:	5d                   	pop    %ebp
+  800f37:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  800f38:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800f3e:	76 d1                	jbe    800f11 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  800f40:	89 f1                	mov    %esi,%ecx
+  800f42:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f45:	89 d8                	mov    %ebx,%eax
+  800f47:	e8 3a fe ff ff       	call   800d86 <file_write_direct>
+  800f4c:	eb e2                	jmp    800f30 <devfile_write+0xa4>
+
+00800f4e <devfile_trunc>:
+{
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	53                   	push   %ebx
+  800f52:	83 ec 10             	sub    $0x10,%esp
+  800f55:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  800f58:	53                   	push   %ebx
+  800f59:	e8 b5 fe ff ff       	call   800e13 <devfile_sync>
+  800f5e:	83 c4 10             	add    $0x10,%esp
+  800f61:	85 c0                	test   %eax,%eax
+  800f63:	78 1f                	js     800f84 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800f65:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f68:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800f6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f70:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800f75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f7f:	e8 eb fd ff ff       	call   800d6f <fsipc>
+}
+  800f84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f87:	c9                   	leave
+  800f88:	c3                   	ret
+
+00800f89 <devfile_stat>:
+{
+  800f89:	55                   	push   %ebp
+  800f8a:	89 e5                	mov    %esp,%ebp
+  800f8c:	56                   	push   %esi
+  800f8d:	53                   	push   %ebx
+  800f8e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800f91:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  800f94:	83 ec 0c             	sub    $0xc,%esp
+  800f97:	53                   	push   %ebx
+  800f98:	e8 76 fe ff ff       	call   800e13 <devfile_sync>
+  800f9d:	83 c4 10             	add    $0x10,%esp
+  800fa0:	85 c0                	test   %eax,%eax
+  800fa2:	78 47                	js     800feb <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800fa4:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800fa7:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800fac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb1:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fb6:	e8 b4 fd ff ff       	call   800d6f <fsipc>
+  800fbb:	85 c0                	test   %eax,%eax
+  800fbd:	78 2c                	js     800feb <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800fbf:	83 ec 08             	sub    $0x8,%esp
+  800fc2:	68 00 60 80 00       	push   $0x806000
+  800fc7:	56                   	push   %esi
+  800fc8:	e8 71 1c 00 00       	call   802c3e <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800fcd:	a1 80 60 80 00       	mov    0x806080,%eax
+  800fd2:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800fd8:	a1 84 60 80 00       	mov    0x806084,%eax
+  800fdd:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  800fe3:	83 c4 10             	add    $0x10,%esp
+  800fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800feb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fee:	5b                   	pop    %ebx
+  800fef:	5e                   	pop    %esi
+  800ff0:	5d                   	pop    %ebp
+  800ff1:	c3                   	ret
+
+00800ff2 <devfile_flush>:
+{
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	56                   	push   %esi
+  800ff6:	53                   	push   %ebx
+  800ff7:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  800ffa:	83 ec 0c             	sub    $0xc,%esp
+  800ffd:	56                   	push   %esi
+  800ffe:	e8 10 fe ff ff       	call   800e13 <devfile_sync>
+  801003:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801005:	83 c4 10             	add    $0x10,%esp
+  801008:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  80100c:	75 25                	jne    801033 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80100e:	8b 46 0c             	mov    0xc(%esi),%eax
+  801011:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801016:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801020:	e8 4a fd ff ff       	call   800d6f <fsipc>
+  801025:	85 c0                	test   %eax,%eax
+  801027:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80102a:	89 d8                	mov    %ebx,%eax
+  80102c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80102f:	5b                   	pop    %ebx
+  801030:	5e                   	pop    %esi
+  801031:	5d                   	pop    %ebp
+  801032:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801033:	83 ec 0c             	sub    $0xc,%esp
+  801036:	56                   	push   %esi
+  801037:	e8 8e f5 ff ff       	call   8005ca <fd2data>
+  80103c:	83 c4 08             	add    $0x8,%esp
+  80103f:	50                   	push   %eax
+  801040:	6a 00                	push   $0x0
+  801042:	e8 d9 f1 ff ff       	call   800220 <sys_page_unmap>
+  801047:	83 c4 10             	add    $0x10,%esp
+  80104a:	eb c2                	jmp    80100e <devfile_flush+0x1c>
+
+0080104c <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  80104c:	55                   	push   %ebp
+  80104d:	89 e5                	mov    %esp,%ebp
+  80104f:	57                   	push   %edi
+  801050:	56                   	push   %esi
+  801051:	53                   	push   %ebx
+  801052:	83 ec 64             	sub    $0x64,%esp
+  801055:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801057:	52                   	push   %edx
+  801058:	50                   	push   %eax
+  801059:	e8 d9 f5 ff ff       	call   800637 <fd_lookup>
+  80105e:	89 c1                	mov    %eax,%ecx
+  801060:	83 c4 10             	add    $0x10,%esp
+  801063:	85 c0                	test   %eax,%eax
+  801065:	0f 88 f2 00 00 00    	js     80115d <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  80106b:	8b 07                	mov    (%edi),%eax
+  80106d:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801073:	39 10                	cmp    %edx,(%eax)
+  801075:	0f 85 03 01 00 00    	jne    80117e <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  80107b:	a1 00 50 80 00       	mov    0x805000,%eax
+  801080:	8b 40 48             	mov    0x48(%eax),%eax
+  801083:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801089:	0f 84 96 00 00 00    	je     801125 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  80108f:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801096:	0f 84 cb 00 00 00    	je     801167 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80109c:	b8 00 60 80 00       	mov    $0x806000,%eax
+  8010a1:	83 c8 07             	or     $0x7,%eax
+  8010a4:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8010a7:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8010aa:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  8010af:	83 ec 04             	sub    $0x4,%esp
+  8010b2:	68 07 04 00 00       	push   $0x407
+  8010b7:	53                   	push   %ebx
+  8010b8:	6a 00                	push   $0x0
+  8010ba:	e8 d4 f0 ff ff       	call   800193 <sys_page_alloc>
+  8010bf:	89 c1                	mov    %eax,%ecx
+  8010c1:	83 c4 10             	add    $0x10,%esp
+  8010c4:	85 c0                	test   %eax,%eax
+  8010c6:	0f 88 91 00 00 00    	js     80115d <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  8010cc:	89 d8                	mov    %ebx,%eax
+  8010ce:	83 c8 07             	or     $0x7,%eax
+  8010d1:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8010d3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8010d9:	83 c6 04             	add    $0x4,%esi
+  8010dc:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8010e2:	75 cb                	jne    8010af <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8010e4:	6a 12                	push   $0x12
+  8010e6:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8010e9:	50                   	push   %eax
+  8010ea:	6a 0c                	push   $0xc
+  8010ec:	ff 35 c8 70 80 00    	push   0x8070c8
+  8010f2:	e8 55 23 00 00       	call   80344c <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8010f7:	83 c4 0c             	add    $0xc,%esp
+  8010fa:	6a 00                	push   $0x0
+  8010fc:	6a 00                	push   $0x0
+  8010fe:	6a 00                	push   $0x0
+  801100:	e8 f1 21 00 00       	call   8032f6 <ipc_recv>
+  801105:	89 c1                	mov    %eax,%ecx
+  801107:	83 c4 10             	add    $0x10,%esp
+  80110a:	85 c0                	test   %eax,%eax
+  80110c:	78 4f                	js     80115d <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  80110e:	a1 00 50 80 00       	mov    0x805000,%eax
+  801113:	8b 40 48             	mov    0x48(%eax),%eax
+  801116:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  80111b:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801122:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801125:	83 ec 0c             	sub    $0xc,%esp
+  801128:	ff 37                	push   (%edi)
+  80112a:	e8 e4 fc ff ff       	call   800e13 <devfile_sync>
+  80112f:	89 c1                	mov    %eax,%ecx
+  801131:	83 c4 10             	add    $0x10,%esp
+  801134:	85 c0                	test   %eax,%eax
+  801136:	78 25                	js     80115d <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801138:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  80113e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801143:	ba 01 00 00 00       	mov    $0x1,%edx
+  801148:	89 d0                	mov    %edx,%eax
+  80114a:	d3 e0                	shl    %cl,%eax
+  80114c:	85 d8                	test   %ebx,%eax
+  80114e:	74 0d                	je     80115d <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801150:	83 c1 01             	add    $0x1,%ecx
+  801153:	83 f9 10             	cmp    $0x10,%ecx
+  801156:	75 f0                	jne    801148 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801158:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  80115d:	89 c8                	mov    %ecx,%eax
+  80115f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801162:	5b                   	pop    %ebx
+  801163:	5e                   	pop    %esi
+  801164:	5f                   	pop    %edi
+  801165:	5d                   	pop    %ebp
+  801166:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801167:	83 ec 0c             	sub    $0xc,%esp
+  80116a:	6a 01                	push   $0x1
+  80116c:	e8 29 23 00 00       	call   80349a <ipc_find_env>
+  801171:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801176:	83 c4 10             	add    $0x10,%esp
+  801179:	e9 1e ff ff ff       	jmp    80109c <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  80117e:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801183:	eb d8                	jmp    80115d <fsring_slot+0x111>
+
+00801185 <file_read_direct>:
+{
+  801185:	55                   	push   %ebp
+  801186:	89 e5                	mov    %esp,%ebp
+  801188:	57                   	push   %edi
+  801189:	56                   	push   %esi
+  80118a:	53                   	push   %ebx
+  80118b:	83 ec 1c             	sub    $0x1c,%esp
+  80118e:	89 c7                	mov    %eax,%edi
+  801190:	89 d6                	mov    %edx,%esi
+  801192:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801194:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  80119a:	77 52                	ja     8011ee <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80119c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80119f:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8011a4:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8011aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011af:	b8 03 00 00 00       	mov    $0x3,%eax
+  8011b4:	e8 b6 fb ff ff       	call   800d6f <fsipc>
+  8011b9:	89 c7                	mov    %eax,%edi
+  8011bb:	85 c0                	test   %eax,%eax
+  8011bd:	78 25                	js     8011e4 <file_read_direct+0x5f>
+	assert(r <= n);
+  8011bf:	39 c3                	cmp    %eax,%ebx
+  8011c1:	0f 82 87 00 00 00    	jb     80124e <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  8011c7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8011cc:	0f 8f 95 00 00 00    	jg     801267 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8011d2:	83 ec 04             	sub    $0x4,%esp
+  8011d5:	50                   	push   %eax
+  8011d6:	68 00 60 80 00       	push   $0x806000
+  8011db:	56                   	push   %esi
+  8011dc:	e8 e3 1b 00 00       	call   802dc4 <memmove>
+	return r;
+  8011e1:	83 c4 10             	add    $0x10,%esp
+}
+  8011e4:	89 f8                	mov    %edi,%eax
+  8011e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e9:	5b                   	pop    %ebx
+  8011ea:	5e                   	pop    %esi
+  8011eb:	5f                   	pop    %edi
+  8011ec:	5d                   	pop    %ebp
+  8011ed:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8011ee:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8011f4:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8011f9:	29 d1                	sub    %edx,%ecx
+  8011fb:	39 d9                	cmp    %ebx,%ecx
+  8011fd:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801200:	89 f0                	mov    %esi,%eax
+  801202:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801205:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801208:	eb 0f                	jmp    801219 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  80120a:	0f b6 10             	movzbl (%eax),%edx
+  80120d:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80120f:	05 00 10 00 00       	add    $0x1000,%eax
+  801214:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801219:	39 c8                	cmp    %ecx,%eax
+  80121b:	72 ed                	jb     80120a <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  80121d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801220:	8b 47 0c             	mov    0xc(%edi),%eax
+  801223:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801228:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  80122e:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801234:	83 ec 0c             	sub    $0xc,%esp
+  801237:	6a 07                	push   $0x7
+  801239:	89 d9                	mov    %ebx,%ecx
+  80123b:	89 f2                	mov    %esi,%edx
+  80123d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801242:	e8 86 f9 ff ff       	call   800bcd <fsipc_pages>
+  801247:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801249:	83 c4 10             	add    $0x10,%esp
+  80124c:	eb 96                	jmp    8011e4 <file_read_direct+0x5f>
+	assert(r <= n);
+  80124e:	68 64 38 80 00       	push   $0x803864
+  801253:	68 44 38 80 00       	push   $0x803844
+  801258:	68 dc 00 00 00       	push   $0xdc
+  80125d:	68 59 38 80 00       	push   $0x803859
+  801262:	e8 0e 13 00 00       	call   802575 <_panic>
+	assert(r <= PGSIZE);
+  801267:	68 75 38 80 00       	push   $0x803875
+  80126c:	68 44 38 80 00       	push   $0x803844
+  801271:	68 dd 00 00 00       	push   $0xdd
+  801276:	68 59 38 80 00       	push   $0x803859
+  80127b:	e8 f5 12 00 00       	call   802575 <_panic>
+
+00801280 <devfile_read>:
+{
+  801280:	55                   	push   %ebp
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	57                   	push   %edi
+  801284:	56                   	push   %esi
+  801285:	53                   	push   %ebx
+  801286:	83 ec 28             	sub    $0x28,%esp
+  801289:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80128c:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80128f:	53                   	push   %ebx
+  801290:	e8 35 f3 ff ff       	call   8005ca <fd2data>
+  801295:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801298:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80129b:	83 c4 10             	add    $0x10,%esp
+  80129e:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8012a2:	74 7d                	je     801321 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8012a4:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8012a8:	0f 85 81 00 00 00    	jne    80132f <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  8012ae:	8b 43 18             	mov    0x18(%ebx),%eax
+  8012b1:	85 c0                	test   %eax,%eax
+  8012b3:	74 0d                	je     8012c2 <devfile_read+0x42>
+  8012b5:	8b 53 14             	mov    0x14(%ebx),%edx
+  8012b8:	39 fa                	cmp    %edi,%edx
+  8012ba:	7f 06                	jg     8012c2 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8012bc:	01 c2                	add    %eax,%edx
+  8012be:	39 d7                	cmp    %edx,%edi
+  8012c0:	72 28                	jb     8012ea <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8012c2:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8012c9:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8012cf:	77 74                	ja     801345 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8012d1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012d6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8012d9:	89 d8                	mov    %ebx,%eax
+  8012db:	e8 a5 fe ff ff       	call   801185 <file_read_direct>
+  8012e0:	85 c0                	test   %eax,%eax
+  8012e2:	7e 35                	jle    801319 <devfile_read+0x99>
+		ff->buf_base = pos;
+  8012e4:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8012e7:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8012ea:	8b 53 14             	mov    0x14(%ebx),%edx
+  8012ed:	89 d0                	mov    %edx,%eax
+  8012ef:	03 43 18             	add    0x18(%ebx),%eax
+  8012f2:	29 f8                	sub    %edi,%eax
+  8012f4:	39 f0                	cmp    %esi,%eax
+  8012f6:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8012f9:	83 ec 04             	sub    $0x4,%esp
+  8012fc:	56                   	push   %esi
+  8012fd:	89 f8                	mov    %edi,%eax
+  8012ff:	29 d0                	sub    %edx,%eax
+  801301:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801304:	01 c1                	add    %eax,%ecx
+  801306:	51                   	push   %ecx
+  801307:	ff 75 0c             	push   0xc(%ebp)
+  80130a:	e8 b5 1a 00 00       	call   802dc4 <memmove>
+	fd->fd_offset = pos + n;
+  80130f:	01 f7                	add    %esi,%edi
+  801311:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801314:	89 f0                	mov    %esi,%eax
+  801316:	83 c4 10             	add    $0x10,%esp
+}
+  801319:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80131c:	5b                   	pop    %ebx
+  80131d:	5e                   	pop    %esi
+  80131e:	5f                   	pop    %edi
+  80131f:	5d                   	pop    %ebp
+  801320:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801321:	89 f1                	mov    %esi,%ecx
+  801323:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801326:	89 d8                	mov    %ebx,%eax
+  801328:	e8 58 fe ff ff       	call   801185 <file_read_direct>
+  80132d:	eb ea                	jmp    801319 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80132f:	83 ec 0c             	sub    $0xc,%esp
+  801332:	53                   	push   %ebx
+  801333:	e8 db fa ff ff       	call   800e13 <devfile_sync>
+  801338:	83 c4 10             	add    $0x10,%esp
+  80133b:	85 c0                	test   %eax,%eax
+  80133d:	0f 89 6b ff ff ff    	jns    8012ae <devfile_read+0x2e>
+  801343:	eb d4                	jmp    801319 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801345:	89 f1                	mov    %esi,%ecx
+  801347:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80134a:	89 d8                	mov    %ebx,%eax
+  80134c:	e8 34 fe ff ff       	call   801185 <file_read_direct>
+  801351:	eb c6                	jmp    801319 <devfile_read+0x99>
+
+00801353 <open>:
+{
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	56                   	push   %esi
+  801357:	53                   	push   %ebx
+  801358:	83 ec 1c             	sub    $0x1c,%esp
+  80135b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80135e:	56                   	push   %esi
+  80135f:	e8 9f 18 00 00       	call   802c03 <strlen>
+  801364:	83 c4 10             	add    $0x10,%esp
+  801367:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80136c:	0f 8f a0 00 00 00    	jg     801412 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801372:	83 ec 0c             	sub    $0xc,%esp
+  801375:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801378:	50                   	push   %eax
+  801379:	e8 63 f2 ff ff       	call   8005e1 <fd_alloc>
+  80137e:	89 c3                	mov    %eax,%ebx
+  801380:	83 c4 10             	add    $0x10,%esp
+  801383:	85 c0                	test   %eax,%eax
+  801385:	78 45                	js     8013cc <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801387:	83 ec 08             	sub    $0x8,%esp
+  80138a:	56                   	push   %esi
+  80138b:	68 00 60 80 00       	push   $0x806000
+  801390:	e8 a9 18 00 00       	call   802c3e <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801395:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801398:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80139d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8013a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013a5:	e8 c5 f9 ff ff       	call   800d6f <fsipc>
+  8013aa:	89 c3                	mov    %eax,%ebx
+  8013ac:	83 c4 10             	add    $0x10,%esp
+  8013af:	85 c0                	test   %eax,%eax
+  8013b1:	78 22                	js     8013d5 <open+0x82>
+	if (!(mode & O_NOBUF)
+  8013b3:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8013ba:	74 2b                	je     8013e7 <open+0x94>
+	return fd2num(fd);
+  8013bc:	83 ec 0c             	sub    $0xc,%esp
+  8013bf:	ff 75 f4             	push   -0xc(%ebp)
+  8013c2:	e8 f3 f1 ff ff       	call   8005ba <fd2num>
+  8013c7:	89 c3                	mov    %eax,%ebx
+  8013c9:	83 c4 10             	add    $0x10,%esp
+}
+  8013cc:	89 d8                	mov    %ebx,%eax
+  8013ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013d1:	5b                   	pop    %ebx
+  8013d2:	5e                   	pop    %esi
+  8013d3:	5d                   	pop    %ebp
+  8013d4:	c3                   	ret
+		fd_close(fd, 0);
+  8013d5:	83 ec 08             	sub    $0x8,%esp
+  8013d8:	6a 00                	push   $0x0
+  8013da:	ff 75 f4             	push   -0xc(%ebp)
+  8013dd:	e8 f8 f2 ff ff       	call   8006da <fd_close>
+		return r;
+  8013e2:	83 c4 10             	add    $0x10,%esp
+  8013e5:	eb e5                	jmp    8013cc <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8013e7:	83 ec 0c             	sub    $0xc,%esp
+  8013ea:	ff 75 f4             	push   -0xc(%ebp)
+  8013ed:	e8 d8 f1 ff ff       	call   8005ca <fd2data>
+  8013f2:	83 c4 0c             	add    $0xc,%esp
+  8013f5:	68 07 04 00 00       	push   $0x407
+  8013fa:	50                   	push   %eax
+  8013fb:	6a 00                	push   $0x0
+  8013fd:	e8 91 ed ff ff       	call   800193 <sys_page_alloc>
+  801402:	83 c4 10             	add    $0x10,%esp
+  801405:	85 c0                	test   %eax,%eax
+  801407:	75 b3                	jne    8013bc <open+0x69>
+		fd->fd_file.buffered = 1;
+  801409:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80140c:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801410:	eb aa                	jmp    8013bc <open+0x69>
+		return -E_BAD_PATH;
+  801412:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801417:	eb b3                	jmp    8013cc <open+0x79>
+
+00801419 <readdir>:
+{
+  801419:	55                   	push   %ebp
+  80141a:	89 e5                	mov    %esp,%ebp
+  80141c:	53                   	push   %ebx
+  80141d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801420:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801423:	50                   	push   %eax
+  801424:	ff 75 08             	push   0x8(%ebp)
+  801427:	e8 0b f2 ff ff       	call   800637 <fd_lookup>
+  80142c:	89 c3                	mov    %eax,%ebx
+  80142e:	83 c4 10             	add    $0x10,%esp
+  801431:	85 c0                	test   %eax,%eax
+  801433:	78 73                	js     8014a8 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801435:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801438:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80143e:	39 08                	cmp    %ecx,(%eax)
+  801440:	0f 85 82 00 00 00    	jne    8014c8 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801446:	83 ec 0c             	sub    $0xc,%esp
+  801449:	50                   	push   %eax
+  80144a:	e8 c4 f9 ff ff       	call   800e13 <devfile_sync>
+  80144f:	89 c3                	mov    %eax,%ebx
+  801451:	83 c4 10             	add    $0x10,%esp
+  801454:	85 c0                	test   %eax,%eax
+  801456:	78 50                	js     8014a8 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801458:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80145b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80145e:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801463:	8b 45 10             	mov    0x10(%ebp),%eax
+  801466:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  80146b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80146e:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801473:	ba 00 00 00 00       	mov    $0x0,%edx
+  801478:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80147d:	e8 ed f8 ff ff       	call   800d6f <fsipc>
+  801482:	89 c3                	mov    %eax,%ebx
+  801484:	85 c0                	test   %eax,%eax
+  801486:	7e 20                	jle    8014a8 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801488:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80148b:	72 22                	jb     8014af <readdir+0x96>
+  80148d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801492:	7f 1b                	jg     8014af <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801494:	83 ec 04             	sub    $0x4,%esp
+  801497:	50                   	push   %eax
+  801498:	68 00 60 80 00       	push   $0x806000
+  80149d:	ff 75 0c             	push   0xc(%ebp)
+  8014a0:	e8 1f 19 00 00       	call   802dc4 <memmove>
+	return r;
+  8014a5:	83 c4 10             	add    $0x10,%esp
+}
+  8014a8:	89 d8                	mov    %ebx,%eax
+  8014aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014ad:	c9                   	leave
+  8014ae:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8014af:	68 6b 38 80 00       	push   $0x80386b
+  8014b4:	68 44 38 80 00       	push   $0x803844
+  8014b9:	68 86 01 00 00       	push   $0x186
+  8014be:	68 59 38 80 00       	push   $0x803859
+  8014c3:	e8 ad 10 00 00       	call   802575 <_panic>
+		return -E_NOT_SUPP;
+  8014c8:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8014cd:	eb d9                	jmp    8014a8 <readdir+0x8f>
+
+008014cf <munmap>:
+{
+  8014cf:	55                   	push   %ebp
+  8014d0:	89 e5                	mov    %esp,%ebp
+  8014d2:	56                   	push   %esi
+  8014d3:	53                   	push   %ebx
+  8014d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8014da:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8014e0:	75 41                	jne    801523 <munmap+0x54>
+  8014e2:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8014e8:	77 39                	ja     801523 <munmap+0x54>
+  8014ea:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8014ef:	29 f0                	sub    %esi,%eax
+  8014f1:	39 d0                	cmp    %edx,%eax
+  8014f3:	72 35                	jb     80152a <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014f5:	89 f3                	mov    %esi,%ebx
+  8014f7:	01 d6                	add    %edx,%esi
+  8014f9:	39 f3                	cmp    %esi,%ebx
+  8014fb:	73 1a                	jae    801517 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8014fd:	83 ec 08             	sub    $0x8,%esp
+  801500:	53                   	push   %ebx
+  801501:	6a 00                	push   $0x0
+  801503:	e8 18 ed ff ff       	call   800220 <sys_page_unmap>
+  801508:	83 c4 10             	add    $0x10,%esp
+  80150b:	85 c0                	test   %eax,%eax
+  80150d:	78 0d                	js     80151c <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80150f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801515:	eb e2                	jmp    8014f9 <munmap+0x2a>
+	return 0;
+  801517:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80151c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80151f:	5b                   	pop    %ebx
+  801520:	5e                   	pop    %esi
+  801521:	5d                   	pop    %ebp
+  801522:	c3                   	ret
+		return -E_INVAL;
+  801523:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801528:	eb f2                	jmp    80151c <munmap+0x4d>
+  80152a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80152f:	eb eb                	jmp    80151c <munmap+0x4d>
+
+00801531 <mmap>:
+{
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	57                   	push   %edi
+  801535:	56                   	push   %esi
+  801536:	53                   	push   %ebx
+  801537:	83 ec 34             	sub    $0x34,%esp
+  80153a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80153d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801540:	50                   	push   %eax
+  801541:	ff 75 18             	push   0x18(%ebp)
+  801544:	e8 ee f0 ff ff       	call   800637 <fd_lookup>
+  801549:	89 c3                	mov    %eax,%ebx
+  80154b:	83 c4 10             	add    $0x10,%esp
+  80154e:	85 c0                	test   %eax,%eax
+  801550:	0f 88 0e 01 00 00    	js     801664 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801556:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801559:	a1 20 40 80 00       	mov    0x804020,%eax
+  80155e:	39 02                	cmp    %eax,(%edx)
+  801560:	0f 85 50 01 00 00    	jne    8016b6 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801566:	8b 45 10             	mov    0x10(%ebp),%eax
+  801569:	83 e0 02             	and    $0x2,%eax
+  80156c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80156f:	74 0a                	je     80157b <mmap+0x4a>
+  801571:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801575:	0f 84 42 01 00 00    	je     8016bd <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  80157b:	8b 42 08             	mov    0x8(%edx),%eax
+  80157e:	83 e0 03             	and    $0x3,%eax
+  801581:	83 f8 01             	cmp    $0x1,%eax
+  801584:	0f 84 3a 01 00 00    	je     8016c4 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  80158a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80158d:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801590:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801595:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801598:	0f 85 2d 01 00 00    	jne    8016cb <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80159e:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8015a2:	0f 88 2a 01 00 00    	js     8016d2 <mmap+0x1a1>
+  8015a8:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8015af:	0f 87 1d 01 00 00    	ja     8016d2 <mmap+0x1a1>
+  8015b5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8015ba:	2b 45 08             	sub    0x8(%ebp),%eax
+  8015bd:	39 f8                	cmp    %edi,%eax
+  8015bf:	0f 82 14 01 00 00    	jb     8016d9 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8015c5:	83 ec 0c             	sub    $0xc,%esp
+  8015c8:	52                   	push   %edx
+  8015c9:	e8 45 f8 ff ff       	call   800e13 <devfile_sync>
+  8015ce:	89 c3                	mov    %eax,%ebx
+  8015d0:	83 c4 10             	add    $0x10,%esp
+  8015d3:	85 c0                	test   %eax,%eax
+  8015d5:	0f 88 89 00 00 00    	js     801664 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8015db:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8015e1:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8015e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ec:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8015ef:	39 fe                	cmp    %edi,%esi
+  8015f1:	73 7b                	jae    80166e <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8015f3:	89 f8                	mov    %edi,%eax
+  8015f5:	29 f0                	sub    %esi,%eax
+  8015f7:	c1 e8 0c             	shr    $0xc,%eax
+  8015fa:	ba 40 00 00 00       	mov    $0x40,%edx
+  8015ff:	39 d0                	cmp    %edx,%eax
+  801601:	0f 47 c2             	cmova  %edx,%eax
+  801604:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801607:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80160a:	8b 52 0c             	mov    0xc(%edx),%edx
+  80160d:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  801613:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  801616:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  80161c:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  801621:	89 f2                	mov    %esi,%edx
+  801623:	03 55 08             	add    0x8(%ebp),%edx
+  801626:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  801629:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80162e:	e8 ea f6 ff ff       	call   800d1d <fsipcv>
+  801633:	85 c0                	test   %eax,%eax
+  801635:	7e 12                	jle    801649 <mmap+0x118>
+  801637:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80163a:	85 c0                	test   %eax,%eax
+  80163c:	0f 84 9e 00 00 00    	je     8016e0 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801642:	c1 e0 0c             	shl    $0xc,%eax
+  801645:	01 c6                	add    %eax,%esi
+  801647:	eb a6                	jmp    8015ef <mmap+0xbe>
+			munmap(addr, done);
+  801649:	89 c3                	mov    %eax,%ebx
+  80164b:	83 ec 08             	sub    $0x8,%esp
+  80164e:	56                   	push   %esi
+  80164f:	ff 75 08             	push   0x8(%ebp)
+  801652:	e8 78 fe ff ff       	call   8014cf <munmap>
+			return r < 0 ? r : -E_INVAL;
+  801657:	83 c4 10             	add    $0x10,%esp
+  80165a:	85 db                	test   %ebx,%ebx
+  80165c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801661:	0f 49 d8             	cmovns %eax,%ebx
+}
+  801664:	89 d8                	mov    %ebx,%eax
+  801666:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801669:	5b                   	pop    %ebx
+  80166a:	5e                   	pop    %esi
+  80166b:	5f                   	pop    %edi
+  80166c:	5d                   	pop    %ebp
+  80166d:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80166e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  801671:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  801673:	85 c0                	test   %eax,%eax
+  801675:	74 ed                	je     801664 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  801677:	be 00 00 00 00       	mov    $0x0,%esi
+  80167c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80167f:	39 fe                	cmp    %edi,%esi
+  801681:	73 2e                	jae    8016b1 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  801683:	83 ec 0c             	sub    $0xc,%esp
+  801686:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  801689:	50                   	push   %eax
+  80168a:	e8 69 1a 00 00       	call   8030f8 <cowpage>
+  80168f:	83 c4 10             	add    $0x10,%esp
+  801692:	85 c0                	test   %eax,%eax
+  801694:	78 08                	js     80169e <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  801696:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80169c:	eb e1                	jmp    80167f <mmap+0x14e>
+				munmap(addr, len);
+  80169e:	89 c3                	mov    %eax,%ebx
+  8016a0:	83 ec 08             	sub    $0x8,%esp
+  8016a3:	57                   	push   %edi
+  8016a4:	ff 75 08             	push   0x8(%ebp)
+  8016a7:	e8 23 fe ff ff       	call   8014cf <munmap>
+				return r;
+  8016ac:	83 c4 10             	add    $0x10,%esp
+  8016af:	eb b3                	jmp    801664 <mmap+0x133>
+	return 0;
+  8016b1:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8016b4:	eb ae                	jmp    801664 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8016b6:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8016bb:	eb a7                	jmp    801664 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8016bd:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8016c2:	eb a0                	jmp    801664 <mmap+0x133>
+		return -E_INVAL;
+  8016c4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016c9:	eb 99                	jmp    801664 <mmap+0x133>
+  8016cb:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016d0:	eb 92                	jmp    801664 <mmap+0x133>
+  8016d2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016d7:	eb 8b                	jmp    801664 <mmap+0x133>
+  8016d9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016de:	eb 84                	jmp    801664 <mmap+0x133>
+			munmap(addr, done);
+  8016e0:	83 ec 08             	sub    $0x8,%esp
+  8016e3:	56                   	push   %esi
+  8016e4:	ff 75 08             	push   0x8(%ebp)
+  8016e7:	e8 e3 fd ff ff       	call   8014cf <munmap>
+  8016ec:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8016ef:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016f4:	e9 6b ff ff ff       	jmp    801664 <mmap+0x133>
+
+008016f9 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8016f9:	55                   	push   %ebp
+  8016fa:	89 e5                	mov    %esp,%ebp
+  8016fc:	56                   	push   %esi
+  8016fd:	53                   	push   %ebx
+  8016fe:	83 ec 10             	sub    $0x10,%esp
+  801701:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  801704:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801707:	8b 45 08             	mov    0x8(%ebp),%eax
+  80170a:	e8 3d f9 ff ff       	call   80104c <fsring_slot>
+  80170f:	85 c0                	test   %eax,%eax
+  801711:	78 60                	js     801773 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  801713:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  801716:	8b 56 08             	mov    0x8(%esi),%edx
+  801719:	83 e2 03             	and    $0x3,%edx
+  80171c:	83 fa 01             	cmp    $0x1,%edx
+  80171f:	74 59                	je     80177a <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  801721:	ba 01 00 00 00       	mov    $0x1,%edx
+  801726:	89 c1                	mov    %eax,%ecx
+  801728:	d3 e2                	shl    %cl,%edx
+  80172a:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  801730:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  801733:	c1 e2 02             	shl    $0x2,%edx
+  801736:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  80173c:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  801743:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  801746:	8b 55 18             	mov    0x18(%ebp),%edx
+  801749:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80174c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80174f:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  801752:	83 ec 08             	sub    $0x8,%esp
+  801755:	50                   	push   %eax
+  801756:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80175b:	39 c3                	cmp    %eax,%ebx
+  80175d:	0f 47 d8             	cmova  %eax,%ebx
+  801760:	53                   	push   %ebx
+  801761:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801764:	89 f2                	mov    %esi,%edx
+  801766:	b8 03 00 00 00       	mov    $0x3,%eax
+  80176b:	e8 1e f5 ff ff       	call   800c8e <fsring_post>
+  801770:	83 c4 10             	add    $0x10,%esp
+}
+  801773:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801776:	5b                   	pop    %ebx
+  801777:	5e                   	pop    %esi
+  801778:	5d                   	pop    %ebp
+  801779:	c3                   	ret
+		return -E_INVAL;
+  80177a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80177f:	eb f2                	jmp    801773 <fsring_read+0x7a>
+
+00801781 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  801781:	55                   	push   %ebp
+  801782:	89 e5                	mov    %esp,%ebp
+  801784:	56                   	push   %esi
+  801785:	53                   	push   %ebx
+  801786:	83 ec 10             	sub    $0x10,%esp
+  801789:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80178c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80178f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801792:	e8 b5 f8 ff ff       	call   80104c <fsring_slot>
+  801797:	89 c3                	mov    %eax,%ebx
+  801799:	85 c0                	test   %eax,%eax
+  80179b:	78 77                	js     801814 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80179d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017a0:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8017a4:	74 77                	je     80181d <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8017a6:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8017ab:	39 c6                	cmp    %eax,%esi
+  8017ad:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8017b0:	83 ec 04             	sub    $0x4,%esp
+  8017b3:	56                   	push   %esi
+  8017b4:	ff 75 0c             	push   0xc(%ebp)
+  8017b7:	89 d8                	mov    %ebx,%eax
+  8017b9:	c1 e0 0c             	shl    $0xc,%eax
+  8017bc:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8017c2:	50                   	push   %eax
+  8017c3:	e8 fc 15 00 00       	call   802dc4 <memmove>
+	fsring_busy |= 1 << slot;
+  8017c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8017cd:	89 d9                	mov    %ebx,%ecx
+  8017cf:	d3 e0                	shl    %cl,%eax
+  8017d1:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8017d7:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8017da:	c1 e0 02             	shl    $0x2,%eax
+  8017dd:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8017e3:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8017ea:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8017ed:	8b 45 18             	mov    0x18(%ebp),%eax
+  8017f0:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8017f3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8017fa:	83 c4 08             	add    $0x8,%esp
+  8017fd:	53                   	push   %ebx
+  8017fe:	56                   	push   %esi
+  8017ff:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801802:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801805:	b8 04 00 00 00       	mov    $0x4,%eax
+  80180a:	e8 7f f4 ff ff       	call   800c8e <fsring_post>
+  80180f:	89 c3                	mov    %eax,%ebx
+  801811:	83 c4 10             	add    $0x10,%esp
+}
+  801814:	89 d8                	mov    %ebx,%eax
+  801816:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801819:	5b                   	pop    %ebx
+  80181a:	5e                   	pop    %esi
+  80181b:	5d                   	pop    %ebp
+  80181c:	c3                   	ret
+		return -E_INVAL;
+  80181d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801822:	eb f0                	jmp    801814 <fsring_write+0x93>
+
+00801824 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  801824:	55                   	push   %ebp
+  801825:	89 e5                	mov    %esp,%ebp
+  801827:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80182a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80182d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801830:	e8 17 f8 ff ff       	call   80104c <fsring_slot>
+  801835:	85 c0                	test   %eax,%eax
+  801837:	78 4c                	js     801885 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  801839:	ba 01 00 00 00       	mov    $0x1,%edx
+  80183e:	89 c1                	mov    %eax,%ecx
+  801840:	d3 e2                	shl    %cl,%edx
+  801842:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  801848:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80184b:	c1 e2 02             	shl    $0x2,%edx
+  80184e:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  801854:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  80185b:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80185e:	8b 55 10             	mov    0x10(%ebp),%edx
+  801861:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  801864:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801867:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80186a:	83 ec 08             	sub    $0x8,%esp
+  80186d:	50                   	push   %eax
+  80186e:	6a 00                	push   $0x0
+  801870:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801875:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801878:	b8 05 00 00 00       	mov    $0x5,%eax
+  80187d:	e8 0c f4 ff ff       	call   800c8e <fsring_post>
+  801882:	83 c4 10             	add    $0x10,%esp
+}
+  801885:	c9                   	leave
+  801886:	c3                   	ret
+
+00801887 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  801887:	55                   	push   %ebp
+  801888:	89 e5                	mov    %esp,%ebp
+  80188a:	57                   	push   %edi
+  80188b:	56                   	push   %esi
+  80188c:	53                   	push   %ebx
+  80188d:	83 ec 1c             	sub    $0x1c,%esp
+  801890:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  801894:	a1 00 50 80 00       	mov    0x805000,%eax
+  801899:	8b 40 48             	mov    0x48(%eax),%eax
+  80189c:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  8018a2:	74 12                	je     8018b6 <fsring_reap+0x2f>
+		return 0;
+  8018a4:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8018a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ac:	5b                   	pop    %ebx
+  8018ad:	5e                   	pop    %esi
+  8018ae:	5f                   	pop    %edi
+  8018af:	5d                   	pop    %ebp
+  8018b0:	c3                   	ret
+		sys_yield();
+  8018b1:	e8 be e8 ff ff       	call   800174 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8018b6:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8018bc:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8018c1:	39 c2                	cmp    %eax,%edx
+  8018c3:	75 18                	jne    8018dd <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8018c5:	84 db                	test   %bl,%bl
+  8018c7:	0f 84 21 01 00 00    	je     8019ee <fsring_reap+0x167>
+  8018cd:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  8018d4:	75 db                	jne    8018b1 <fsring_reap+0x2a>
+			return 0;
+  8018d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018db:	eb cc                	jmp    8018a9 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8018dd:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018e2:	83 e0 0f             	and    $0xf,%eax
+  8018e5:	83 c0 2a             	add    $0x2a,%eax
+  8018e8:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8018ef:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8018f6:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018fb:	83 c0 01             	add    $0x1,%eax
+  8018fe:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  801903:	83 fb 0f             	cmp    $0xf,%ebx
+  801906:	77 5b                	ja     801963 <fsring_reap+0xdc>
+  801908:	be 01 00 00 00       	mov    $0x1,%esi
+  80190d:	89 d9                	mov    %ebx,%ecx
+  80190f:	d3 e6                	shl    %cl,%esi
+  801911:	89 f0                	mov    %esi,%eax
+  801913:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  801919:	74 48                	je     801963 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  80191b:	89 d8                	mov    %ebx,%eax
+  80191d:	c1 e0 0c             	shl    $0xc,%eax
+  801920:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  801926:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  801929:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80192c:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  801933:	83 f8 03             	cmp    $0x3,%eax
+  801936:	74 40                	je     801978 <fsring_reap+0xf1>
+  801938:	83 f8 05             	cmp    $0x5,%eax
+  80193b:	74 64                	je     8019a1 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  80193d:	f7 d6                	not    %esi
+  80193f:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  801945:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801948:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  80194f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801952:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  801954:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801957:	89 38                	mov    %edi,(%eax)
+	return 1;
+  801959:	b8 01 00 00 00       	mov    $0x1,%eax
+  80195e:	e9 46 ff ff ff       	jmp    8018a9 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  801963:	53                   	push   %ebx
+  801964:	68 81 38 80 00       	push   $0x803881
+  801969:	68 8f 02 00 00       	push   $0x28f
+  80196e:	68 59 38 80 00       	push   $0x803859
+  801973:	e8 fd 0b 00 00       	call   802575 <_panic>
+		if (cqe.cqe_result > 0)
+  801978:	85 ff                	test   %edi,%edi
+  80197a:	7e c1                	jle    80193d <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80197c:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80197f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801984:	39 c7                	cmp    %eax,%edi
+  801986:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801989:	50                   	push   %eax
+  80198a:	ff 75 e4             	push   -0x1c(%ebp)
+  80198d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801990:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  801997:	e8 28 14 00 00       	call   802dc4 <memmove>
+  80199c:	83 c4 10             	add    $0x10,%esp
+  80199f:	eb 9c                	jmp    80193d <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8019a1:	85 ff                	test   %edi,%edi
+  8019a3:	75 98                	jne    80193d <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  8019a5:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8019a8:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8019af:	83 ec 08             	sub    $0x8,%esp
+  8019b2:	ff 75 e4             	push   -0x1c(%ebp)
+  8019b5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8019b8:	51                   	push   %ecx
+  8019b9:	e8 80 12 00 00       	call   802c3e <strcpy>
+			st->st_size = ret->ret_size;
+  8019be:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8019c1:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8019c7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8019ca:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8019d0:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8019d6:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8019dc:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8019e3:	40 80 00 
+  8019e6:	83 c4 10             	add    $0x10,%esp
+  8019e9:	e9 4f ff ff ff       	jmp    80193d <fsring_reap+0xb6>
+			return 0;
+  8019ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f3:	e9 b1 fe ff ff       	jmp    8018a9 <fsring_reap+0x22>
+
+008019f8 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8019f8:	55                   	push   %ebp
+  8019f9:	89 e5                	mov    %esp,%ebp
+  8019fb:	57                   	push   %edi
+  8019fc:	56                   	push   %esi
+  8019fd:	53                   	push   %ebx
+  8019fe:	83 ec 28             	sub    $0x28,%esp
+  801a01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a04:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801a07:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801a0a:	53                   	push   %ebx
+  801a0b:	e8 f3 11 00 00       	call   802c03 <strlen>
+  801a10:	83 c4 10             	add    $0x10,%esp
+  801a13:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a18:	0f 8f 02 01 00 00    	jg     801b20 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  801a1e:	83 ec 08             	sub    $0x8,%esp
+  801a21:	53                   	push   %ebx
+  801a22:	68 00 60 80 00       	push   $0x806000
+  801a27:	e8 12 12 00 00       	call   802c3e <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  801a2c:	83 c4 10             	add    $0x10,%esp
+  801a2f:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  801a35:	76 69                	jbe    801aa0 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801a37:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a3a:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801a40:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801a45:	29 d1                	sub    %edx,%ecx
+  801a47:	39 f9                	cmp    %edi,%ecx
+  801a49:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a4f:	89 f9                	mov    %edi,%ecx
+  801a51:	01 c1                	add    %eax,%ecx
+  801a53:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a56:	eb 0f                	jmp    801a67 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  801a58:	0f b6 10             	movzbl (%eax),%edx
+  801a5b:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a5d:	05 00 10 00 00       	add    $0x1000,%eax
+  801a62:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a67:	39 c8                	cmp    %ecx,%eax
+  801a69:	72 ed                	jb     801a58 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  801a6b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a6e:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  801a74:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  801a7a:	83 ec 0c             	sub    $0xc,%esp
+  801a7d:	6a 07                	push   $0x7
+  801a7f:	89 f9                	mov    %edi,%ecx
+  801a81:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a84:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a89:	e8 3f f1 ff ff       	call   800bcd <fsipc_pages>
+  801a8e:	89 c7                	mov    %eax,%edi
+  801a90:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  801a93:	85 f6                	test   %esi,%esi
+  801a95:	74 7f                	je     801b16 <file_slurp+0x11e>
+  801a97:	8d 43 01             	lea    0x1(%ebx),%eax
+  801a9a:	85 ff                	test   %edi,%edi
+  801a9c:	79 3c                	jns    801ada <file_slurp+0xe2>
+  801a9e:	eb 76                	jmp    801b16 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  801aa0:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  801aa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aab:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801ab0:	e8 ba f2 ff ff       	call   800d6f <fsipc>
+  801ab5:	89 c7                	mov    %eax,%edi
+  801ab7:	85 c0                	test   %eax,%eax
+  801ab9:	7e d8                	jle    801a93 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  801abb:	83 ec 04             	sub    $0x4,%esp
+  801abe:	50                   	push   %eax
+  801abf:	68 08 60 80 00       	push   $0x806008
+  801ac4:	ff 75 0c             	push   0xc(%ebp)
+  801ac7:	e8 f8 12 00 00       	call   802dc4 <memmove>
+  801acc:	83 c4 10             	add    $0x10,%esp
+  801acf:	eb c2                	jmp    801a93 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  801ad1:	80 fa 2f             	cmp    $0x2f,%dl
+  801ad4:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  801ad7:	83 c0 01             	add    $0x1,%eax
+  801ada:	89 c1                	mov    %eax,%ecx
+  801adc:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  801ae0:	84 d2                	test   %dl,%dl
+  801ae2:	75 ed                	jne    801ad1 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  801ae4:	83 ec 04             	sub    $0x4,%esp
+  801ae7:	68 80 00 00 00       	push   $0x80
+  801aec:	53                   	push   %ebx
+  801aed:	56                   	push   %esi
+  801aee:	e8 c1 11 00 00       	call   802cb4 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  801af3:	a1 00 60 80 00       	mov    0x806000,%eax
+  801af8:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  801afe:	a1 04 60 80 00       	mov    0x806004,%eax
+  801b03:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  801b09:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  801b10:	40 80 00 
+  801b13:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801b16:	89 f8                	mov    %edi,%eax
+  801b18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b1b:	5b                   	pop    %ebx
+  801b1c:	5e                   	pop    %esi
+  801b1d:	5f                   	pop    %edi
+  801b1e:	5d                   	pop    %ebp
+  801b1f:	c3                   	ret
+		return -E_BAD_PATH;
+  801b20:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  801b25:	eb ef                	jmp    801b16 <file_slurp+0x11e>
+
+00801b27 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801b27:	55                   	push   %ebp
+  801b28:	89 e5                	mov    %esp,%ebp
+  801b2a:	53                   	push   %ebx
+  801b2b:	83 ec 10             	sub    $0x10,%esp
+  801b2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b31:	53                   	push   %ebx
+  801b32:	e8 cc 10 00 00       	call   802c03 <strlen>
+  801b37:	83 c4 10             	add    $0x10,%esp
+  801b3a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b3f:	7f 25                	jg     801b66 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b41:	83 ec 08             	sub    $0x8,%esp
+  801b44:	53                   	push   %ebx
+  801b45:	68 00 60 80 00       	push   $0x806000
+  801b4a:	e8 ef 10 00 00       	call   802c3e <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b54:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b59:	e8 11 f2 ff ff       	call   800d6f <fsipc>
+  801b5e:	83 c4 10             	add    $0x10,%esp
+}
+  801b61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b64:	c9                   	leave
+  801b65:	c3                   	ret
+		return -E_BAD_PATH;
+  801b66:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b6b:	eb f4                	jmp    801b61 <remove+0x3a>
+
+00801b6d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b6d:	55                   	push   %ebp
+  801b6e:	89 e5                	mov    %esp,%ebp
+  801b70:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b73:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b78:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b7d:	e8 ed f1 ff ff       	call   800d6f <fsipc>
+}
+  801b82:	c9                   	leave
+  801b83:	c3                   	ret
+
+00801b84 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  801b84:	55                   	push   %ebp
+  801b85:	89 e5                	mov    %esp,%ebp
+  801b87:	57                   	push   %edi
+  801b88:	56                   	push   %esi
+  801b89:	53                   	push   %ebx
+  801b8a:	83 ec 18             	sub    $0x18,%esp
+  801b8d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b90:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b93:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801b96:	57                   	push   %edi
+  801b97:	e8 67 10 00 00       	call   802c03 <strlen>
+  801b9c:	83 c4 10             	add    $0x10,%esp
+  801b9f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ba4:	7f 4c                	jg     801bf2 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  801ba6:	83 ec 08             	sub    $0x8,%esp
+  801ba9:	57                   	push   %edi
+  801baa:	68 00 60 80 00       	push   $0x806000
+  801baf:	e8 8a 10 00 00       	call   802c3e <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  801bb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb9:	b8 10 00 00 00       	mov    $0x10,%eax
+  801bbe:	e8 ac f1 ff ff       	call   800d6f <fsipc>
+  801bc3:	83 c4 10             	add    $0x10,%esp
+  801bc6:	85 c0                	test   %eax,%eax
+  801bc8:	78 20                	js     801bea <defrag+0x66>
+		return r;
+	if (before)
+  801bca:	85 f6                	test   %esi,%esi
+  801bcc:	74 07                	je     801bd5 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  801bce:	a1 00 60 80 00       	mov    0x806000,%eax
+  801bd3:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  801bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  801bda:	85 db                	test   %ebx,%ebx
+  801bdc:	74 0c                	je     801bea <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  801bde:	a1 04 60 80 00       	mov    0x806004,%eax
+  801be3:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  801be5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bed:	5b                   	pop    %ebx
+  801bee:	5e                   	pop    %esi
+  801bef:	5f                   	pop    %edi
+  801bf0:	5d                   	pop    %ebp
+  801bf1:	c3                   	ret
+		return -E_BAD_PATH;
+  801bf2:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801bf7:	eb f1                	jmp    801bea <defrag+0x66>
+
+00801bf9 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  801bf9:	55                   	push   %ebp
+  801bfa:	89 e5                	mov    %esp,%ebp
+  801bfc:	53                   	push   %ebx
+  801bfd:	83 ec 04             	sub    $0x4,%esp
+  801c00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  801c03:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c08:	b8 11 00 00 00       	mov    $0x11,%eax
+  801c0d:	e8 5d f1 ff ff       	call   800d6f <fsipc>
+  801c12:	85 c0                	test   %eax,%eax
+  801c14:	78 34                	js     801c4a <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  801c16:	a1 00 60 80 00       	mov    0x806000,%eax
+  801c1b:	89 03                	mov    %eax,(%ebx)
+  801c1d:	a1 04 60 80 00       	mov    0x806004,%eax
+  801c22:	89 43 04             	mov    %eax,0x4(%ebx)
+  801c25:	a1 08 60 80 00       	mov    0x806008,%eax
+  801c2a:	89 43 08             	mov    %eax,0x8(%ebx)
+  801c2d:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  801c32:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801c35:	a1 10 60 80 00       	mov    0x806010,%eax
+  801c3a:	89 43 10             	mov    %eax,0x10(%ebx)
+  801c3d:	a1 14 60 80 00       	mov    0x806014,%eax
+  801c42:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  801c45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c4d:	c9                   	leave
+  801c4e:	c3                   	ret
+
+00801c4f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c4f:	55                   	push   %ebp
+  801c50:	89 e5                	mov    %esp,%ebp
+  801c52:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c55:	68 9a 38 80 00       	push   $0x80389a
+  801c5a:	ff 75 0c             	push   0xc(%ebp)
+  801c5d:	e8 dc 0f 00 00       	call   802c3e <strcpy>
+	return 0;
+}
+  801c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c67:	c9                   	leave
+  801c68:	c3                   	ret
+
+00801c69 <devsock_close>:
+{
+  801c69:	55                   	push   %ebp
+  801c6a:	89 e5                	mov    %esp,%ebp
+  801c6c:	53                   	push   %ebx
+  801c6d:	83 ec 10             	sub    $0x10,%esp
+  801c70:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c73:	53                   	push   %ebx
+  801c74:	e8 60 18 00 00       	call   8034d9 <pageref>
+  801c79:	89 c2                	mov    %eax,%edx
+  801c7b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c83:	83 fa 01             	cmp    $0x1,%edx
+  801c86:	74 05                	je     801c8d <devsock_close+0x24>
+}
+  801c88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c8b:	c9                   	leave
+  801c8c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c8d:	83 ec 0c             	sub    $0xc,%esp
+  801c90:	ff 73 0c             	push   0xc(%ebx)
+  801c93:	e8 b7 02 00 00       	call   801f4f <nsipc_close>
+  801c98:	83 c4 10             	add    $0x10,%esp
+  801c9b:	eb eb                	jmp    801c88 <devsock_close+0x1f>
+
+00801c9d <devsock_write>:
+{
+  801c9d:	55                   	push   %ebp
+  801c9e:	89 e5                	mov    %esp,%ebp
+  801ca0:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801ca3:	6a 00                	push   $0x0
+  801ca5:	ff 75 10             	push   0x10(%ebp)
+  801ca8:	ff 75 0c             	push   0xc(%ebp)
+  801cab:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cae:	ff 70 0c             	push   0xc(%eax)
+  801cb1:	e8 79 03 00 00       	call   80202f <nsipc_send>
+}
+  801cb6:	c9                   	leave
+  801cb7:	c3                   	ret
+
+00801cb8 <devsock_read>:
+{
+  801cb8:	55                   	push   %ebp
+  801cb9:	89 e5                	mov    %esp,%ebp
+  801cbb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801cbe:	6a 00                	push   $0x0
+  801cc0:	ff 75 10             	push   0x10(%ebp)
+  801cc3:	ff 75 0c             	push   0xc(%ebp)
+  801cc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cc9:	ff 70 0c             	push   0xc(%eax)
+  801ccc:	e8 ef 02 00 00       	call   801fc0 <nsipc_recv>
+}
+  801cd1:	c9                   	leave
+  801cd2:	c3                   	ret
+
+00801cd3 <fd2sockid>:
+{
+  801cd3:	55                   	push   %ebp
+  801cd4:	89 e5                	mov    %esp,%ebp
+  801cd6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801cd9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801cdc:	52                   	push   %edx
+  801cdd:	50                   	push   %eax
+  801cde:	e8 54 e9 ff ff       	call   800637 <fd_lookup>
+  801ce3:	83 c4 10             	add    $0x10,%esp
+  801ce6:	85 c0                	test   %eax,%eax
+  801ce8:	78 10                	js     801cfa <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801cea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ced:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801cf3:	39 08                	cmp    %ecx,(%eax)
+  801cf5:	75 05                	jne    801cfc <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801cf7:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801cfa:	c9                   	leave
+  801cfb:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cfc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d01:	eb f7                	jmp    801cfa <fd2sockid+0x27>
+
+00801d03 <alloc_sockfd>:
+{
+  801d03:	55                   	push   %ebp
+  801d04:	89 e5                	mov    %esp,%ebp
+  801d06:	56                   	push   %esi
+  801d07:	53                   	push   %ebx
+  801d08:	83 ec 1c             	sub    $0x1c,%esp
+  801d0b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801d0d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d10:	50                   	push   %eax
+  801d11:	e8 cb e8 ff ff       	call   8005e1 <fd_alloc>
+  801d16:	89 c3                	mov    %eax,%ebx
+  801d18:	83 c4 10             	add    $0x10,%esp
+  801d1b:	85 c0                	test   %eax,%eax
+  801d1d:	78 43                	js     801d62 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801d1f:	83 ec 04             	sub    $0x4,%esp
+  801d22:	68 07 04 00 00       	push   $0x407
+  801d27:	ff 75 f4             	push   -0xc(%ebp)
+  801d2a:	6a 00                	push   $0x0
+  801d2c:	e8 62 e4 ff ff       	call   800193 <sys_page_alloc>
+  801d31:	89 c3                	mov    %eax,%ebx
+  801d33:	83 c4 10             	add    $0x10,%esp
+  801d36:	85 c0                	test   %eax,%eax
+  801d38:	78 28                	js     801d62 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d3d:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801d43:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d48:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d4f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d52:	83 ec 0c             	sub    $0xc,%esp
+  801d55:	50                   	push   %eax
+  801d56:	e8 5f e8 ff ff       	call   8005ba <fd2num>
+  801d5b:	89 c3                	mov    %eax,%ebx
+  801d5d:	83 c4 10             	add    $0x10,%esp
+  801d60:	eb 0c                	jmp    801d6e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d62:	83 ec 0c             	sub    $0xc,%esp
+  801d65:	56                   	push   %esi
+  801d66:	e8 e4 01 00 00       	call   801f4f <nsipc_close>
+		return r;
+  801d6b:	83 c4 10             	add    $0x10,%esp
+}
+  801d6e:	89 d8                	mov    %ebx,%eax
+  801d70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d73:	5b                   	pop    %ebx
+  801d74:	5e                   	pop    %esi
+  801d75:	5d                   	pop    %ebp
+  801d76:	c3                   	ret
+
+00801d77 <accept>:
+{
+  801d77:	55                   	push   %ebp
+  801d78:	89 e5                	mov    %esp,%ebp
+  801d7a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d80:	e8 4e ff ff ff       	call   801cd3 <fd2sockid>
+  801d85:	85 c0                	test   %eax,%eax
+  801d87:	78 1b                	js     801da4 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d89:	83 ec 04             	sub    $0x4,%esp
+  801d8c:	ff 75 10             	push   0x10(%ebp)
+  801d8f:	ff 75 0c             	push   0xc(%ebp)
+  801d92:	50                   	push   %eax
+  801d93:	e8 0e 01 00 00       	call   801ea6 <nsipc_accept>
+  801d98:	83 c4 10             	add    $0x10,%esp
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	78 05                	js     801da4 <accept+0x2d>
+	return alloc_sockfd(r);
+  801d9f:	e8 5f ff ff ff       	call   801d03 <alloc_sockfd>
+}
+  801da4:	c9                   	leave
+  801da5:	c3                   	ret
+
+00801da6 <bind>:
+{
+  801da6:	55                   	push   %ebp
+  801da7:	89 e5                	mov    %esp,%ebp
+  801da9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dac:	8b 45 08             	mov    0x8(%ebp),%eax
+  801daf:	e8 1f ff ff ff       	call   801cd3 <fd2sockid>
+  801db4:	85 c0                	test   %eax,%eax
+  801db6:	78 12                	js     801dca <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801db8:	83 ec 04             	sub    $0x4,%esp
+  801dbb:	ff 75 10             	push   0x10(%ebp)
+  801dbe:	ff 75 0c             	push   0xc(%ebp)
+  801dc1:	50                   	push   %eax
+  801dc2:	e8 31 01 00 00       	call   801ef8 <nsipc_bind>
+  801dc7:	83 c4 10             	add    $0x10,%esp
+}
+  801dca:	c9                   	leave
+  801dcb:	c3                   	ret
+
+00801dcc <shutdown>:
+{
+  801dcc:	55                   	push   %ebp
+  801dcd:	89 e5                	mov    %esp,%ebp
+  801dcf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd5:	e8 f9 fe ff ff       	call   801cd3 <fd2sockid>
+  801dda:	85 c0                	test   %eax,%eax
+  801ddc:	78 0f                	js     801ded <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801dde:	83 ec 08             	sub    $0x8,%esp
+  801de1:	ff 75 0c             	push   0xc(%ebp)
+  801de4:	50                   	push   %eax
+  801de5:	e8 43 01 00 00       	call   801f2d <nsipc_shutdown>
+  801dea:	83 c4 10             	add    $0x10,%esp
+}
+  801ded:	c9                   	leave
+  801dee:	c3                   	ret
+
+00801def <connect>:
+{
+  801def:	55                   	push   %ebp
+  801df0:	89 e5                	mov    %esp,%ebp
+  801df2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801df5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df8:	e8 d6 fe ff ff       	call   801cd3 <fd2sockid>
+  801dfd:	85 c0                	test   %eax,%eax
+  801dff:	78 12                	js     801e13 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801e01:	83 ec 04             	sub    $0x4,%esp
+  801e04:	ff 75 10             	push   0x10(%ebp)
+  801e07:	ff 75 0c             	push   0xc(%ebp)
+  801e0a:	50                   	push   %eax
+  801e0b:	e8 59 01 00 00       	call   801f69 <nsipc_connect>
+  801e10:	83 c4 10             	add    $0x10,%esp
+}
+  801e13:	c9                   	leave
+  801e14:	c3                   	ret
+
+00801e15 <listen>:
+{
+  801e15:	55                   	push   %ebp
+  801e16:	89 e5                	mov    %esp,%ebp
+  801e18:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e1e:	e8 b0 fe ff ff       	call   801cd3 <fd2sockid>
+  801e23:	85 c0                	test   %eax,%eax
+  801e25:	78 0f                	js     801e36 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801e27:	83 ec 08             	sub    $0x8,%esp
+  801e2a:	ff 75 0c             	push   0xc(%ebp)
+  801e2d:	50                   	push   %eax
+  801e2e:	e8 6b 01 00 00       	call   801f9e <nsipc_listen>
+  801e33:	83 c4 10             	add    $0x10,%esp
+}
+  801e36:	c9                   	leave
+  801e37:	c3                   	ret
+
+00801e38 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e38:	55                   	push   %ebp
+  801e39:	89 e5                	mov    %esp,%ebp
+  801e3b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e3e:	ff 75 10             	push   0x10(%ebp)
+  801e41:	ff 75 0c             	push   0xc(%ebp)
+  801e44:	ff 75 08             	push   0x8(%ebp)
+  801e47:	e8 41 02 00 00       	call   80208d <nsipc_socket>
+  801e4c:	83 c4 10             	add    $0x10,%esp
+  801e4f:	85 c0                	test   %eax,%eax
+  801e51:	78 05                	js     801e58 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e53:	e8 ab fe ff ff       	call   801d03 <alloc_sockfd>
+}
+  801e58:	c9                   	leave
+  801e59:	c3                   	ret
+
+00801e5a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e5a:	55                   	push   %ebp
+  801e5b:	89 e5                	mov    %esp,%ebp
+  801e5d:	53                   	push   %ebx
+  801e5e:	83 ec 04             	sub    $0x4,%esp
+  801e61:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e63:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  801e6a:	74 26                	je     801e92 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e6c:	6a 07                	push   $0x7
+  801e6e:	68 00 80 80 00       	push   $0x808000
+  801e73:	53                   	push   %ebx
+  801e74:	ff 35 00 90 80 00    	push   0x809000
+  801e7a:	e8 e2 14 00 00       	call   803361 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e7f:	83 c4 0c             	add    $0xc,%esp
+  801e82:	6a 00                	push   $0x0
+  801e84:	6a 00                	push   $0x0
+  801e86:	6a 00                	push   $0x0
+  801e88:	e8 69 14 00 00       	call   8032f6 <ipc_recv>
+}
+  801e8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e90:	c9                   	leave
+  801e91:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e92:	83 ec 0c             	sub    $0xc,%esp
+  801e95:	6a 02                	push   $0x2
+  801e97:	e8 fe 15 00 00       	call   80349a <ipc_find_env>
+  801e9c:	a3 00 90 80 00       	mov    %eax,0x809000
+  801ea1:	83 c4 10             	add    $0x10,%esp
+  801ea4:	eb c6                	jmp    801e6c <nsipc+0x12>
+
+00801ea6 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801ea6:	55                   	push   %ebp
+  801ea7:	89 e5                	mov    %esp,%ebp
+  801ea9:	56                   	push   %esi
+  801eaa:	53                   	push   %ebx
+  801eab:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801eae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb1:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801eb6:	8b 06                	mov    (%esi),%eax
+  801eb8:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801ebd:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ec2:	e8 93 ff ff ff       	call   801e5a <nsipc>
+  801ec7:	89 c3                	mov    %eax,%ebx
+  801ec9:	85 c0                	test   %eax,%eax
+  801ecb:	79 09                	jns    801ed6 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801ecd:	89 d8                	mov    %ebx,%eax
+  801ecf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ed2:	5b                   	pop    %ebx
+  801ed3:	5e                   	pop    %esi
+  801ed4:	5d                   	pop    %ebp
+  801ed5:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801ed6:	83 ec 04             	sub    $0x4,%esp
+  801ed9:	ff 35 10 80 80 00    	push   0x808010
+  801edf:	68 00 80 80 00       	push   $0x808000
+  801ee4:	ff 75 0c             	push   0xc(%ebp)
+  801ee7:	e8 d8 0e 00 00       	call   802dc4 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801eec:	a1 10 80 80 00       	mov    0x808010,%eax
+  801ef1:	89 06                	mov    %eax,(%esi)
+  801ef3:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801ef6:	eb d5                	jmp    801ecd <nsipc_accept+0x27>
+
+00801ef8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801ef8:	55                   	push   %ebp
+  801ef9:	89 e5                	mov    %esp,%ebp
+  801efb:	53                   	push   %ebx
+  801efc:	83 ec 08             	sub    $0x8,%esp
+  801eff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801f02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f05:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801f0a:	53                   	push   %ebx
+  801f0b:	ff 75 0c             	push   0xc(%ebp)
+  801f0e:	68 04 80 80 00       	push   $0x808004
+  801f13:	e8 ac 0e 00 00       	call   802dc4 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801f18:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801f1e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f23:	e8 32 ff ff ff       	call   801e5a <nsipc>
+}
+  801f28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f2b:	c9                   	leave
+  801f2c:	c3                   	ret
+
+00801f2d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801f2d:	55                   	push   %ebp
+  801f2e:	89 e5                	mov    %esp,%ebp
+  801f30:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f33:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f36:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801f3b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f3e:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f43:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f48:	e8 0d ff ff ff       	call   801e5a <nsipc>
+}
+  801f4d:	c9                   	leave
+  801f4e:	c3                   	ret
+
+00801f4f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f4f:	55                   	push   %ebp
+  801f50:	89 e5                	mov    %esp,%ebp
+  801f52:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f58:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f5d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f62:	e8 f3 fe ff ff       	call   801e5a <nsipc>
+}
+  801f67:	c9                   	leave
+  801f68:	c3                   	ret
+
+00801f69 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f69:	55                   	push   %ebp
+  801f6a:	89 e5                	mov    %esp,%ebp
+  801f6c:	53                   	push   %ebx
+  801f6d:	83 ec 08             	sub    $0x8,%esp
+  801f70:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f73:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f76:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f7b:	53                   	push   %ebx
+  801f7c:	ff 75 0c             	push   0xc(%ebp)
+  801f7f:	68 04 80 80 00       	push   $0x808004
+  801f84:	e8 3b 0e 00 00       	call   802dc4 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f89:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801f8f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f94:	e8 c1 fe ff ff       	call   801e5a <nsipc>
+}
+  801f99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f9c:	c9                   	leave
+  801f9d:	c3                   	ret
+
+00801f9e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f9e:	55                   	push   %ebp
+  801f9f:	89 e5                	mov    %esp,%ebp
+  801fa1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801fa4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801fac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801faf:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801fb4:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fb9:	e8 9c fe ff ff       	call   801e5a <nsipc>
+}
+  801fbe:	c9                   	leave
+  801fbf:	c3                   	ret
+
+00801fc0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801fc0:	55                   	push   %ebp
+  801fc1:	89 e5                	mov    %esp,%ebp
+  801fc3:	56                   	push   %esi
+  801fc4:	53                   	push   %ebx
+  801fc5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801fc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fcb:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801fd0:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801fd6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fd9:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801fde:	b8 07 00 00 00       	mov    $0x7,%eax
+  801fe3:	e8 72 fe ff ff       	call   801e5a <nsipc>
+  801fe8:	89 c3                	mov    %eax,%ebx
+  801fea:	85 c0                	test   %eax,%eax
+  801fec:	78 22                	js     802010 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801fee:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801ff3:	39 c6                	cmp    %eax,%esi
+  801ff5:	0f 4e c6             	cmovle %esi,%eax
+  801ff8:	39 c3                	cmp    %eax,%ebx
+  801ffa:	7f 1d                	jg     802019 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801ffc:	83 ec 04             	sub    $0x4,%esp
+  801fff:	53                   	push   %ebx
+  802000:	68 00 80 80 00       	push   $0x808000
+  802005:	ff 75 0c             	push   0xc(%ebp)
+  802008:	e8 b7 0d 00 00       	call   802dc4 <memmove>
+  80200d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802010:	89 d8                	mov    %ebx,%eax
+  802012:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802015:	5b                   	pop    %ebx
+  802016:	5e                   	pop    %esi
+  802017:	5d                   	pop    %ebp
+  802018:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802019:	68 a6 38 80 00       	push   $0x8038a6
+  80201e:	68 44 38 80 00       	push   $0x803844
+  802023:	6a 62                	push   $0x62
+  802025:	68 bb 38 80 00       	push   $0x8038bb
+  80202a:	e8 46 05 00 00       	call   802575 <_panic>
+
+0080202f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80202f:	55                   	push   %ebp
+  802030:	89 e5                	mov    %esp,%ebp
+  802032:	53                   	push   %ebx
+  802033:	83 ec 04             	sub    $0x4,%esp
+  802036:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802039:	8b 45 08             	mov    0x8(%ebp),%eax
+  80203c:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802041:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802047:	7f 2e                	jg     802077 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802049:	83 ec 04             	sub    $0x4,%esp
+  80204c:	53                   	push   %ebx
+  80204d:	ff 75 0c             	push   0xc(%ebp)
+  802050:	68 0c 80 80 00       	push   $0x80800c
+  802055:	e8 6a 0d 00 00       	call   802dc4 <memmove>
+	nsipcbuf.send.req_size = size;
+  80205a:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802060:	8b 45 14             	mov    0x14(%ebp),%eax
+  802063:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802068:	b8 08 00 00 00       	mov    $0x8,%eax
+  80206d:	e8 e8 fd ff ff       	call   801e5a <nsipc>
+}
+  802072:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802075:	c9                   	leave
+  802076:	c3                   	ret
+	assert(size < 1600);
+  802077:	68 c7 38 80 00       	push   $0x8038c7
+  80207c:	68 44 38 80 00       	push   $0x803844
+  802081:	6a 6d                	push   $0x6d
+  802083:	68 bb 38 80 00       	push   $0x8038bb
+  802088:	e8 e8 04 00 00       	call   802575 <_panic>
+
+0080208d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80208d:	55                   	push   %ebp
+  80208e:	89 e5                	mov    %esp,%ebp
+  802090:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802093:	8b 45 08             	mov    0x8(%ebp),%eax
+  802096:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  80209b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80209e:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8020a3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020a6:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8020ab:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020b0:	e8 a5 fd ff ff       	call   801e5a <nsipc>
+}
+  8020b5:	c9                   	leave
+  8020b6:	c3                   	ret
+
+008020b7 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020b7:	55                   	push   %ebp
+  8020b8:	89 e5                	mov    %esp,%ebp
+  8020ba:	56                   	push   %esi
+  8020bb:	53                   	push   %ebx
+  8020bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8020bf:	83 ec 0c             	sub    $0xc,%esp
+  8020c2:	ff 75 08             	push   0x8(%ebp)
+  8020c5:	e8 00 e5 ff ff       	call   8005ca <fd2data>
+  8020ca:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8020cc:	83 c4 08             	add    $0x8,%esp
+  8020cf:	68 d3 38 80 00       	push   $0x8038d3
+  8020d4:	53                   	push   %ebx
+  8020d5:	e8 64 0b 00 00       	call   802c3e <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8020da:	8b 46 04             	mov    0x4(%esi),%eax
+  8020dd:	2b 06                	sub    (%esi),%eax
+  8020df:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8020e5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020ec:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020ef:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  8020f6:	40 80 00 
+	return 0;
+}
+  8020f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802101:	5b                   	pop    %ebx
+  802102:	5e                   	pop    %esi
+  802103:	5d                   	pop    %ebp
+  802104:	c3                   	ret
+
+00802105 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802105:	55                   	push   %ebp
+  802106:	89 e5                	mov    %esp,%ebp
+  802108:	53                   	push   %ebx
+  802109:	83 ec 0c             	sub    $0xc,%esp
+  80210c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80210f:	53                   	push   %ebx
+  802110:	6a 00                	push   $0x0
+  802112:	e8 09 e1 ff ff       	call   800220 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802117:	89 1c 24             	mov    %ebx,(%esp)
+  80211a:	e8 ab e4 ff ff       	call   8005ca <fd2data>
+  80211f:	83 c4 08             	add    $0x8,%esp
+  802122:	50                   	push   %eax
+  802123:	6a 00                	push   $0x0
+  802125:	e8 f6 e0 ff ff       	call   800220 <sys_page_unmap>
+}
+  80212a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80212d:	c9                   	leave
+  80212e:	c3                   	ret
+
+0080212f <_pipeisclosed>:
+{
+  80212f:	55                   	push   %ebp
+  802130:	89 e5                	mov    %esp,%ebp
+  802132:	57                   	push   %edi
+  802133:	56                   	push   %esi
+  802134:	53                   	push   %ebx
+  802135:	83 ec 1c             	sub    $0x1c,%esp
+  802138:	89 c7                	mov    %eax,%edi
+  80213a:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80213c:	a1 00 50 80 00       	mov    0x805000,%eax
+  802141:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802144:	83 ec 0c             	sub    $0xc,%esp
+  802147:	57                   	push   %edi
+  802148:	e8 8c 13 00 00       	call   8034d9 <pageref>
+  80214d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802150:	89 34 24             	mov    %esi,(%esp)
+  802153:	e8 81 13 00 00       	call   8034d9 <pageref>
+		nn = thisenv->env_runs;
+  802158:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80215e:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802161:	83 c4 10             	add    $0x10,%esp
+  802164:	39 cb                	cmp    %ecx,%ebx
+  802166:	74 1b                	je     802183 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802168:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80216b:	75 cf                	jne    80213c <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80216d:	8b 42 58             	mov    0x58(%edx),%eax
+  802170:	6a 01                	push   $0x1
+  802172:	50                   	push   %eax
+  802173:	53                   	push   %ebx
+  802174:	68 da 38 80 00       	push   $0x8038da
+  802179:	e8 d2 04 00 00       	call   802650 <cprintf>
+  80217e:	83 c4 10             	add    $0x10,%esp
+  802181:	eb b9                	jmp    80213c <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802183:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802186:	0f 94 c0             	sete   %al
+  802189:	0f b6 c0             	movzbl %al,%eax
+}
+  80218c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80218f:	5b                   	pop    %ebx
+  802190:	5e                   	pop    %esi
+  802191:	5f                   	pop    %edi
+  802192:	5d                   	pop    %ebp
+  802193:	c3                   	ret
+
+00802194 <devpipe_write>:
+{
+  802194:	55                   	push   %ebp
+  802195:	89 e5                	mov    %esp,%ebp
+  802197:	57                   	push   %edi
+  802198:	56                   	push   %esi
+  802199:	53                   	push   %ebx
+  80219a:	83 ec 28             	sub    $0x28,%esp
+  80219d:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8021a0:	56                   	push   %esi
+  8021a1:	e8 24 e4 ff ff       	call   8005ca <fd2data>
+  8021a6:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021b0:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8021b3:	75 09                	jne    8021be <devpipe_write+0x2a>
+	return i;
+  8021b5:	89 f8                	mov    %edi,%eax
+  8021b7:	eb 23                	jmp    8021dc <devpipe_write+0x48>
+			sys_yield();
+  8021b9:	e8 b6 df ff ff       	call   800174 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8021be:	8b 43 04             	mov    0x4(%ebx),%eax
+  8021c1:	8b 0b                	mov    (%ebx),%ecx
+  8021c3:	8d 51 20             	lea    0x20(%ecx),%edx
+  8021c6:	39 d0                	cmp    %edx,%eax
+  8021c8:	72 1a                	jb     8021e4 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8021ca:	89 da                	mov    %ebx,%edx
+  8021cc:	89 f0                	mov    %esi,%eax
+  8021ce:	e8 5c ff ff ff       	call   80212f <_pipeisclosed>
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	74 e2                	je     8021b9 <devpipe_write+0x25>
+				return 0;
+  8021d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021df:	5b                   	pop    %ebx
+  8021e0:	5e                   	pop    %esi
+  8021e1:	5f                   	pop    %edi
+  8021e2:	5d                   	pop    %ebp
+  8021e3:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021e7:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021eb:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021ee:	89 c2                	mov    %eax,%edx
+  8021f0:	c1 fa 1f             	sar    $0x1f,%edx
+  8021f3:	89 d1                	mov    %edx,%ecx
+  8021f5:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021f8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021fb:	83 e2 1f             	and    $0x1f,%edx
+  8021fe:	29 ca                	sub    %ecx,%edx
+  802200:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802204:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802208:	83 c0 01             	add    $0x1,%eax
+  80220b:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80220e:	83 c7 01             	add    $0x1,%edi
+  802211:	eb 9d                	jmp    8021b0 <devpipe_write+0x1c>
+
+00802213 <devpipe_read>:
+{
+  802213:	55                   	push   %ebp
+  802214:	89 e5                	mov    %esp,%ebp
+  802216:	57                   	push   %edi
+  802217:	56                   	push   %esi
+  802218:	53                   	push   %ebx
+  802219:	83 ec 18             	sub    $0x18,%esp
+  80221c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80221f:	57                   	push   %edi
+  802220:	e8 a5 e3 ff ff       	call   8005ca <fd2data>
+  802225:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802227:	83 c4 10             	add    $0x10,%esp
+  80222a:	be 00 00 00 00       	mov    $0x0,%esi
+  80222f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802232:	75 13                	jne    802247 <devpipe_read+0x34>
+	return i;
+  802234:	89 f0                	mov    %esi,%eax
+  802236:	eb 02                	jmp    80223a <devpipe_read+0x27>
+				return i;
+  802238:	89 f0                	mov    %esi,%eax
+}
+  80223a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80223d:	5b                   	pop    %ebx
+  80223e:	5e                   	pop    %esi
+  80223f:	5f                   	pop    %edi
+  802240:	5d                   	pop    %ebp
+  802241:	c3                   	ret
+			sys_yield();
+  802242:	e8 2d df ff ff       	call   800174 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802247:	8b 03                	mov    (%ebx),%eax
+  802249:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80224c:	75 18                	jne    802266 <devpipe_read+0x53>
+			if (i > 0)
+  80224e:	85 f6                	test   %esi,%esi
+  802250:	75 e6                	jne    802238 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802252:	89 da                	mov    %ebx,%edx
+  802254:	89 f8                	mov    %edi,%eax
+  802256:	e8 d4 fe ff ff       	call   80212f <_pipeisclosed>
+  80225b:	85 c0                	test   %eax,%eax
+  80225d:	74 e3                	je     802242 <devpipe_read+0x2f>
+				return 0;
+  80225f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802264:	eb d4                	jmp    80223a <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802266:	99                   	cltd
+  802267:	c1 ea 1b             	shr    $0x1b,%edx
+  80226a:	01 d0                	add    %edx,%eax
+  80226c:	83 e0 1f             	and    $0x1f,%eax
+  80226f:	29 d0                	sub    %edx,%eax
+  802271:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802276:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802279:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80227c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80227f:	83 c6 01             	add    $0x1,%esi
+  802282:	eb ab                	jmp    80222f <devpipe_read+0x1c>
+
+00802284 <pipe>:
+{
+  802284:	55                   	push   %ebp
+  802285:	89 e5                	mov    %esp,%ebp
+  802287:	56                   	push   %esi
+  802288:	53                   	push   %ebx
+  802289:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80228c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80228f:	50                   	push   %eax
+  802290:	e8 4c e3 ff ff       	call   8005e1 <fd_alloc>
+  802295:	89 c3                	mov    %eax,%ebx
+  802297:	83 c4 10             	add    $0x10,%esp
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	0f 88 23 01 00 00    	js     8023c5 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022a2:	83 ec 04             	sub    $0x4,%esp
+  8022a5:	68 07 04 00 00       	push   $0x407
+  8022aa:	ff 75 f4             	push   -0xc(%ebp)
+  8022ad:	6a 00                	push   $0x0
+  8022af:	e8 df de ff ff       	call   800193 <sys_page_alloc>
+  8022b4:	89 c3                	mov    %eax,%ebx
+  8022b6:	83 c4 10             	add    $0x10,%esp
+  8022b9:	85 c0                	test   %eax,%eax
+  8022bb:	0f 88 04 01 00 00    	js     8023c5 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8022c1:	83 ec 0c             	sub    $0xc,%esp
+  8022c4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022c7:	50                   	push   %eax
+  8022c8:	e8 14 e3 ff ff       	call   8005e1 <fd_alloc>
+  8022cd:	89 c3                	mov    %eax,%ebx
+  8022cf:	83 c4 10             	add    $0x10,%esp
+  8022d2:	85 c0                	test   %eax,%eax
+  8022d4:	0f 88 db 00 00 00    	js     8023b5 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022da:	83 ec 04             	sub    $0x4,%esp
+  8022dd:	68 07 04 00 00       	push   $0x407
+  8022e2:	ff 75 f0             	push   -0x10(%ebp)
+  8022e5:	6a 00                	push   $0x0
+  8022e7:	e8 a7 de ff ff       	call   800193 <sys_page_alloc>
+  8022ec:	89 c3                	mov    %eax,%ebx
+  8022ee:	83 c4 10             	add    $0x10,%esp
+  8022f1:	85 c0                	test   %eax,%eax
+  8022f3:	0f 88 bc 00 00 00    	js     8023b5 <pipe+0x131>
+	va = fd2data(fd0);
+  8022f9:	83 ec 0c             	sub    $0xc,%esp
+  8022fc:	ff 75 f4             	push   -0xc(%ebp)
+  8022ff:	e8 c6 e2 ff ff       	call   8005ca <fd2data>
+  802304:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802306:	83 c4 0c             	add    $0xc,%esp
+  802309:	68 07 04 00 00       	push   $0x407
+  80230e:	50                   	push   %eax
+  80230f:	6a 00                	push   $0x0
+  802311:	e8 7d de ff ff       	call   800193 <sys_page_alloc>
+  802316:	89 c3                	mov    %eax,%ebx
+  802318:	83 c4 10             	add    $0x10,%esp
+  80231b:	85 c0                	test   %eax,%eax
+  80231d:	0f 88 82 00 00 00    	js     8023a5 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802323:	83 ec 0c             	sub    $0xc,%esp
+  802326:	ff 75 f0             	push   -0x10(%ebp)
+  802329:	e8 9c e2 ff ff       	call   8005ca <fd2data>
+  80232e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802335:	50                   	push   %eax
+  802336:	6a 00                	push   $0x0
+  802338:	56                   	push   %esi
+  802339:	6a 00                	push   $0x0
+  80233b:	e8 9e de ff ff       	call   8001de <sys_page_map>
+  802340:	89 c3                	mov    %eax,%ebx
+  802342:	83 c4 20             	add    $0x20,%esp
+  802345:	85 c0                	test   %eax,%eax
+  802347:	78 4e                	js     802397 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802349:	a1 60 40 80 00       	mov    0x804060,%eax
+  80234e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802351:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802353:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802356:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80235d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802360:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802362:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802365:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80236c:	83 ec 0c             	sub    $0xc,%esp
+  80236f:	ff 75 f4             	push   -0xc(%ebp)
+  802372:	e8 43 e2 ff ff       	call   8005ba <fd2num>
+  802377:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80237a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80237c:	83 c4 04             	add    $0x4,%esp
+  80237f:	ff 75 f0             	push   -0x10(%ebp)
+  802382:	e8 33 e2 ff ff       	call   8005ba <fd2num>
+  802387:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80238a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80238d:	83 c4 10             	add    $0x10,%esp
+  802390:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802395:	eb 2e                	jmp    8023c5 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802397:	83 ec 08             	sub    $0x8,%esp
+  80239a:	56                   	push   %esi
+  80239b:	6a 00                	push   $0x0
+  80239d:	e8 7e de ff ff       	call   800220 <sys_page_unmap>
+  8023a2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8023a5:	83 ec 08             	sub    $0x8,%esp
+  8023a8:	ff 75 f0             	push   -0x10(%ebp)
+  8023ab:	6a 00                	push   $0x0
+  8023ad:	e8 6e de ff ff       	call   800220 <sys_page_unmap>
+  8023b2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8023b5:	83 ec 08             	sub    $0x8,%esp
+  8023b8:	ff 75 f4             	push   -0xc(%ebp)
+  8023bb:	6a 00                	push   $0x0
+  8023bd:	e8 5e de ff ff       	call   800220 <sys_page_unmap>
+  8023c2:	83 c4 10             	add    $0x10,%esp
+}
+  8023c5:	89 d8                	mov    %ebx,%eax
+  8023c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023ca:	5b                   	pop    %ebx
+  8023cb:	5e                   	pop    %esi
+  8023cc:	5d                   	pop    %ebp
+  8023cd:	c3                   	ret
+
+008023ce <pipeisclosed>:
+{
+  8023ce:	55                   	push   %ebp
+  8023cf:	89 e5                	mov    %esp,%ebp
+  8023d1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023d7:	50                   	push   %eax
+  8023d8:	ff 75 08             	push   0x8(%ebp)
+  8023db:	e8 57 e2 ff ff       	call   800637 <fd_lookup>
+  8023e0:	83 c4 10             	add    $0x10,%esp
+  8023e3:	85 c0                	test   %eax,%eax
+  8023e5:	78 18                	js     8023ff <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8023e7:	83 ec 0c             	sub    $0xc,%esp
+  8023ea:	ff 75 f4             	push   -0xc(%ebp)
+  8023ed:	e8 d8 e1 ff ff       	call   8005ca <fd2data>
+  8023f2:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8023f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023f7:	e8 33 fd ff ff       	call   80212f <_pipeisclosed>
+  8023fc:	83 c4 10             	add    $0x10,%esp
+}
+  8023ff:	c9                   	leave
+  802400:	c3                   	ret
+
+00802401 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802401:	b8 00 00 00 00       	mov    $0x0,%eax
+  802406:	c3                   	ret
+
+00802407 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802407:	55                   	push   %ebp
+  802408:	89 e5                	mov    %esp,%ebp
+  80240a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80240d:	68 f2 38 80 00       	push   $0x8038f2
+  802412:	ff 75 0c             	push   0xc(%ebp)
+  802415:	e8 24 08 00 00       	call   802c3e <strcpy>
+	return 0;
+}
+  80241a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241f:	c9                   	leave
+  802420:	c3                   	ret
+
+00802421 <devcons_write>:
+{
+  802421:	55                   	push   %ebp
+  802422:	89 e5                	mov    %esp,%ebp
+  802424:	57                   	push   %edi
+  802425:	56                   	push   %esi
+  802426:	53                   	push   %ebx
+  802427:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80242d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802432:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802438:	eb 2e                	jmp    802468 <devcons_write+0x47>
+		m = n - tot;
+  80243a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80243d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80243f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802444:	39 c3                	cmp    %eax,%ebx
+  802446:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802449:	83 ec 04             	sub    $0x4,%esp
+  80244c:	53                   	push   %ebx
+  80244d:	89 f0                	mov    %esi,%eax
+  80244f:	03 45 0c             	add    0xc(%ebp),%eax
+  802452:	50                   	push   %eax
+  802453:	57                   	push   %edi
+  802454:	e8 6b 09 00 00       	call   802dc4 <memmove>
+		sys_cputs(buf, m);
+  802459:	83 c4 08             	add    $0x8,%esp
+  80245c:	53                   	push   %ebx
+  80245d:	57                   	push   %edi
+  80245e:	e8 54 dc ff ff       	call   8000b7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802463:	01 de                	add    %ebx,%esi
+  802465:	83 c4 10             	add    $0x10,%esp
+  802468:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80246b:	72 cd                	jb     80243a <devcons_write+0x19>
+}
+  80246d:	89 f0                	mov    %esi,%eax
+  80246f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802472:	5b                   	pop    %ebx
+  802473:	5e                   	pop    %esi
+  802474:	5f                   	pop    %edi
+  802475:	5d                   	pop    %ebp
+  802476:	c3                   	ret
+
+00802477 <devcons_read>:
+{
+  802477:	55                   	push   %ebp
+  802478:	89 e5                	mov    %esp,%ebp
+  80247a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80247d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802482:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802486:	75 07                	jne    80248f <devcons_read+0x18>
+  802488:	eb 1f                	jmp    8024a9 <devcons_read+0x32>
+		sys_yield();
+  80248a:	e8 e5 dc ff ff       	call   800174 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80248f:	e8 49 dc ff ff       	call   8000dd <sys_cgetc>
+  802494:	85 c0                	test   %eax,%eax
+  802496:	74 f2                	je     80248a <devcons_read+0x13>
+	if (c < 0)
+  802498:	78 0f                	js     8024a9 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80249a:	83 f8 04             	cmp    $0x4,%eax
+  80249d:	74 0c                	je     8024ab <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80249f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024a2:	88 02                	mov    %al,(%edx)
+	return 1;
+  8024a4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8024a9:	c9                   	leave
+  8024aa:	c3                   	ret
+		return 0;
+  8024ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b0:	eb f7                	jmp    8024a9 <devcons_read+0x32>
+
+008024b2 <cputchar>:
+{
+  8024b2:	55                   	push   %ebp
+  8024b3:	89 e5                	mov    %esp,%ebp
+  8024b5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8024b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024bb:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8024be:	6a 01                	push   $0x1
+  8024c0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024c3:	50                   	push   %eax
+  8024c4:	e8 ee db ff ff       	call   8000b7 <sys_cputs>
+}
+  8024c9:	83 c4 10             	add    $0x10,%esp
+  8024cc:	c9                   	leave
+  8024cd:	c3                   	ret
+
+008024ce <getchar>:
+{
+  8024ce:	55                   	push   %ebp
+  8024cf:	89 e5                	mov    %esp,%ebp
+  8024d1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8024d4:	6a 01                	push   $0x1
+  8024d6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024d9:	50                   	push   %eax
+  8024da:	6a 00                	push   $0x0
+  8024dc:	e8 bc e3 ff ff       	call   80089d <read>
+	if (r < 0)
+  8024e1:	83 c4 10             	add    $0x10,%esp
+  8024e4:	85 c0                	test   %eax,%eax
+  8024e6:	78 06                	js     8024ee <getchar+0x20>
+	if (r < 1)
+  8024e8:	74 06                	je     8024f0 <getchar+0x22>
+	return c;
+  8024ea:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8024ee:	c9                   	leave
+  8024ef:	c3                   	ret
+		return -E_EOF;
+  8024f0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8024f5:	eb f7                	jmp    8024ee <getchar+0x20>
+
+008024f7 <iscons>:
+{
+  8024f7:	55                   	push   %ebp
+  8024f8:	89 e5                	mov    %esp,%ebp
+  8024fa:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802500:	50                   	push   %eax
+  802501:	ff 75 08             	push   0x8(%ebp)
+  802504:	e8 2e e1 ff ff       	call   800637 <fd_lookup>
+  802509:	83 c4 10             	add    $0x10,%esp
+  80250c:	85 c0                	test   %eax,%eax
+  80250e:	78 11                	js     802521 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802510:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802513:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802519:	39 10                	cmp    %edx,(%eax)
+  80251b:	0f 94 c0             	sete   %al
+  80251e:	0f b6 c0             	movzbl %al,%eax
+}
+  802521:	c9                   	leave
+  802522:	c3                   	ret
+
+00802523 <opencons>:
+{
+  802523:	55                   	push   %ebp
+  802524:	89 e5                	mov    %esp,%ebp
+  802526:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802529:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80252c:	50                   	push   %eax
+  80252d:	e8 af e0 ff ff       	call   8005e1 <fd_alloc>
+  802532:	83 c4 10             	add    $0x10,%esp
+  802535:	85 c0                	test   %eax,%eax
+  802537:	78 3a                	js     802573 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802539:	83 ec 04             	sub    $0x4,%esp
+  80253c:	68 07 04 00 00       	push   $0x407
+  802541:	ff 75 f4             	push   -0xc(%ebp)
+  802544:	6a 00                	push   $0x0
+  802546:	e8 48 dc ff ff       	call   800193 <sys_page_alloc>
+  80254b:	83 c4 10             	add    $0x10,%esp
+  80254e:	85 c0                	test   %eax,%eax
+  802550:	78 21                	js     802573 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802552:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802555:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80255b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80255d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802560:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802567:	83 ec 0c             	sub    $0xc,%esp
+  80256a:	50                   	push   %eax
+  80256b:	e8 4a e0 ff ff       	call   8005ba <fd2num>
+  802570:	83 c4 10             	add    $0x10,%esp
+}
+  802573:	c9                   	leave
+  802574:	c3                   	ret
+
+00802575 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802575:	55                   	push   %ebp
+  802576:	89 e5                	mov    %esp,%ebp
+  802578:	56                   	push   %esi
+  802579:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80257a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80257d:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802583:	e8 c5 db ff ff       	call   80014d <sys_getenvid>
+  802588:	83 ec 0c             	sub    $0xc,%esp
+  80258b:	ff 75 0c             	push   0xc(%ebp)
+  80258e:	ff 75 08             	push   0x8(%ebp)
+  802591:	56                   	push   %esi
+  802592:	50                   	push   %eax
+  802593:	68 00 39 80 00       	push   $0x803900
+  802598:	e8 b3 00 00 00       	call   802650 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80259d:	83 c4 18             	add    $0x18,%esp
+  8025a0:	53                   	push   %ebx
+  8025a1:	ff 75 10             	push   0x10(%ebp)
+  8025a4:	e8 56 00 00 00       	call   8025ff <vcprintf>
+	cprintf("\n");
+  8025a9:	c7 04 24 eb 38 80 00 	movl   $0x8038eb,(%esp)
+  8025b0:	e8 9b 00 00 00       	call   802650 <cprintf>
+  8025b5:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8025b8:	cc                   	int3
+	while (1)
+  8025b9:	eb fd                	jmp    8025b8 <_panic+0x43>
+
+008025bb <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8025bb:	55                   	push   %ebp
+  8025bc:	89 e5                	mov    %esp,%ebp
+  8025be:	53                   	push   %ebx
+  8025bf:	83 ec 04             	sub    $0x4,%esp
+  8025c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8025c5:	8b 13                	mov    (%ebx),%edx
+  8025c7:	8d 42 01             	lea    0x1(%edx),%eax
+  8025ca:	89 03                	mov    %eax,(%ebx)
+  8025cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025cf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8025d3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8025d8:	74 09                	je     8025e3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8025da:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8025de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025e1:	c9                   	leave
+  8025e2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8025e3:	83 ec 08             	sub    $0x8,%esp
+  8025e6:	68 ff 00 00 00       	push   $0xff
+  8025eb:	8d 43 08             	lea    0x8(%ebx),%eax
+  8025ee:	50                   	push   %eax
+  8025ef:	e8 c3 da ff ff       	call   8000b7 <sys_cputs>
+		b->idx = 0;
+  8025f4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8025fa:	83 c4 10             	add    $0x10,%esp
+  8025fd:	eb db                	jmp    8025da <putch+0x1f>
+
+008025ff <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8025ff:	55                   	push   %ebp
+  802600:	89 e5                	mov    %esp,%ebp
+  802602:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  802608:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80260f:	00 00 00 
+	b.cnt = 0;
+  802612:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802619:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80261c:	ff 75 0c             	push   0xc(%ebp)
+  80261f:	ff 75 08             	push   0x8(%ebp)
+  802622:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802628:	50                   	push   %eax
+  802629:	68 bb 25 80 00       	push   $0x8025bb
+  80262e:	e8 14 01 00 00       	call   802747 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802633:	83 c4 08             	add    $0x8,%esp
+  802636:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80263c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802642:	50                   	push   %eax
+  802643:	e8 6f da ff ff       	call   8000b7 <sys_cputs>
+
+	return b.cnt;
+}
+  802648:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80264e:	c9                   	leave
+  80264f:	c3                   	ret
+
+00802650 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802650:	55                   	push   %ebp
+  802651:	89 e5                	mov    %esp,%ebp
+  802653:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802656:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802659:	50                   	push   %eax
+  80265a:	ff 75 08             	push   0x8(%ebp)
+  80265d:	e8 9d ff ff ff       	call   8025ff <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802662:	c9                   	leave
+  802663:	c3                   	ret
+
+00802664 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802664:	55                   	push   %ebp
+  802665:	89 e5                	mov    %esp,%ebp
+  802667:	57                   	push   %edi
+  802668:	56                   	push   %esi
+  802669:	53                   	push   %ebx
+  80266a:	83 ec 1c             	sub    $0x1c,%esp
+  80266d:	89 c7                	mov    %eax,%edi
+  80266f:	89 d6                	mov    %edx,%esi
+  802671:	8b 45 08             	mov    0x8(%ebp),%eax
+  802674:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802677:	89 d1                	mov    %edx,%ecx
+  802679:	89 c2                	mov    %eax,%edx
+  80267b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80267e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802681:	8b 45 10             	mov    0x10(%ebp),%eax
+  802684:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802687:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80268a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802691:	39 c2                	cmp    %eax,%edx
+  802693:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802696:	72 3e                	jb     8026d6 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802698:	83 ec 0c             	sub    $0xc,%esp
+  80269b:	ff 75 18             	push   0x18(%ebp)
+  80269e:	83 eb 01             	sub    $0x1,%ebx
+  8026a1:	53                   	push   %ebx
+  8026a2:	50                   	push   %eax
+  8026a3:	83 ec 08             	sub    $0x8,%esp
+  8026a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8026a9:	ff 75 e0             	push   -0x20(%ebp)
+  8026ac:	ff 75 dc             	push   -0x24(%ebp)
+  8026af:	ff 75 d8             	push   -0x28(%ebp)
+  8026b2:	e8 33 0f 00 00       	call   8035ea <__udivdi3>
+  8026b7:	83 c4 18             	add    $0x18,%esp
+  8026ba:	52                   	push   %edx
+  8026bb:	50                   	push   %eax
+  8026bc:	89 f2                	mov    %esi,%edx
+  8026be:	89 f8                	mov    %edi,%eax
+  8026c0:	e8 9f ff ff ff       	call   802664 <printnum>
+  8026c5:	83 c4 20             	add    $0x20,%esp
+  8026c8:	eb 13                	jmp    8026dd <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8026ca:	83 ec 08             	sub    $0x8,%esp
+  8026cd:	56                   	push   %esi
+  8026ce:	ff 75 18             	push   0x18(%ebp)
+  8026d1:	ff d7                	call   *%edi
+  8026d3:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8026d6:	83 eb 01             	sub    $0x1,%ebx
+  8026d9:	85 db                	test   %ebx,%ebx
+  8026db:	7f ed                	jg     8026ca <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8026dd:	83 ec 08             	sub    $0x8,%esp
+  8026e0:	56                   	push   %esi
+  8026e1:	83 ec 04             	sub    $0x4,%esp
+  8026e4:	ff 75 e4             	push   -0x1c(%ebp)
+  8026e7:	ff 75 e0             	push   -0x20(%ebp)
+  8026ea:	ff 75 dc             	push   -0x24(%ebp)
+  8026ed:	ff 75 d8             	push   -0x28(%ebp)
+  8026f0:	e8 13 0f 00 00       	call   803608 <__umoddi3>
+  8026f5:	83 c4 14             	add    $0x14,%esp
+  8026f8:	0f be 80 23 39 80 00 	movsbl 0x803923(%eax),%eax
+  8026ff:	50                   	push   %eax
+  802700:	ff d7                	call   *%edi
+}
+  802702:	83 c4 10             	add    $0x10,%esp
+  802705:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802708:	5b                   	pop    %ebx
+  802709:	5e                   	pop    %esi
+  80270a:	5f                   	pop    %edi
+  80270b:	5d                   	pop    %ebp
+  80270c:	c3                   	ret
+
+0080270d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80270d:	55                   	push   %ebp
+  80270e:	89 e5                	mov    %esp,%ebp
+  802710:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  802713:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  802717:	8b 10                	mov    (%eax),%edx
+  802719:	3b 50 04             	cmp    0x4(%eax),%edx
+  80271c:	73 0a                	jae    802728 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80271e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802721:	89 08                	mov    %ecx,(%eax)
+  802723:	8b 45 08             	mov    0x8(%ebp),%eax
+  802726:	88 02                	mov    %al,(%edx)
+}
+  802728:	5d                   	pop    %ebp
+  802729:	c3                   	ret
+
+0080272a <printfmt>:
+{
+  80272a:	55                   	push   %ebp
+  80272b:	89 e5                	mov    %esp,%ebp
+  80272d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  802730:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  802733:	50                   	push   %eax
+  802734:	ff 75 10             	push   0x10(%ebp)
+  802737:	ff 75 0c             	push   0xc(%ebp)
+  80273a:	ff 75 08             	push   0x8(%ebp)
+  80273d:	e8 05 00 00 00       	call   802747 <vprintfmt>
+}
+  802742:	83 c4 10             	add    $0x10,%esp
+  802745:	c9                   	leave
+  802746:	c3                   	ret
+
+00802747 <vprintfmt>:
+{
+  802747:	55                   	push   %ebp
+  802748:	89 e5                	mov    %esp,%ebp
+  80274a:	57                   	push   %edi
+  80274b:	56                   	push   %esi
+  80274c:	53                   	push   %ebx
+  80274d:	83 ec 2c             	sub    $0x2c,%esp
+  802750:	8b 75 08             	mov    0x8(%ebp),%esi
+  802753:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802756:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802759:	eb 0a                	jmp    802765 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80275b:	83 ec 08             	sub    $0x8,%esp
+  80275e:	53                   	push   %ebx
+  80275f:	50                   	push   %eax
+  802760:	ff d6                	call   *%esi
+  802762:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802765:	83 c7 01             	add    $0x1,%edi
+  802768:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80276c:	83 f8 25             	cmp    $0x25,%eax
+  80276f:	74 0c                	je     80277d <vprintfmt+0x36>
+			if (ch == '\0')
+  802771:	85 c0                	test   %eax,%eax
+  802773:	75 e6                	jne    80275b <vprintfmt+0x14>
+}
+  802775:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802778:	5b                   	pop    %ebx
+  802779:	5e                   	pop    %esi
+  80277a:	5f                   	pop    %edi
+  80277b:	5d                   	pop    %ebp
+  80277c:	c3                   	ret
+		padc = ' ';
+  80277d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  802781:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802788:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80278f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  802796:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80279b:	8d 47 01             	lea    0x1(%edi),%eax
+  80279e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027a1:	0f b6 17             	movzbl (%edi),%edx
+  8027a4:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8027a7:	3c 55                	cmp    $0x55,%al
+  8027a9:	0f 87 cf 03 00 00    	ja     802b7e <vprintfmt+0x437>
+  8027af:	0f b6 c0             	movzbl %al,%eax
+  8027b2:	ff 24 85 80 3a 80 00 	jmp    *0x803a80(,%eax,4)
+  8027b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8027bc:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8027c0:	eb d9                	jmp    80279b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8027c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8027c5:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8027c9:	eb d0                	jmp    80279b <vprintfmt+0x54>
+  8027cb:	0f b6 d2             	movzbl %dl,%edx
+  8027ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8027d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8027d9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8027dc:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8027e0:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8027e3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8027e6:	83 f9 09             	cmp    $0x9,%ecx
+  8027e9:	77 55                	ja     802840 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8027eb:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8027ee:	eb e9                	jmp    8027d9 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8027f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027f3:	8b 00                	mov    (%eax),%eax
+  8027f5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8027f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8027fe:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802801:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  802804:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  802808:	79 91                	jns    80279b <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80280a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80280d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802810:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  802817:	eb 82                	jmp    80279b <vprintfmt+0x54>
+			if (width < 0)
+  802819:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80281c:	85 d2                	test   %edx,%edx
+  80281e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802823:	0f 49 c2             	cmovns %edx,%eax
+  802826:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802829:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80282c:	e9 6a ff ff ff       	jmp    80279b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  802831:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  802834:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80283b:	e9 5b ff ff ff       	jmp    80279b <vprintfmt+0x54>
+  802840:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802843:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802846:	eb bc                	jmp    802804 <vprintfmt+0xbd>
+			lflag++;
+  802848:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80284b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80284e:	e9 48 ff ff ff       	jmp    80279b <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  802853:	8b 45 14             	mov    0x14(%ebp),%eax
+  802856:	8d 78 04             	lea    0x4(%eax),%edi
+  802859:	83 ec 08             	sub    $0x8,%esp
+  80285c:	53                   	push   %ebx
+  80285d:	ff 30                	push   (%eax)
+  80285f:	ff d6                	call   *%esi
+			break;
+  802861:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802864:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  802867:	e9 b1 02 00 00       	jmp    802b1d <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80286c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80286f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  802872:	8b 10                	mov    (%eax),%edx
+  802874:	89 d0                	mov    %edx,%eax
+  802876:	f7 d8                	neg    %eax
+  802878:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80287b:	83 f8 11             	cmp    $0x11,%eax
+  80287e:	7f 23                	jg     8028a3 <vprintfmt+0x15c>
+  802880:	8b 14 85 e0 3b 80 00 	mov    0x803be0(,%eax,4),%edx
+  802887:	85 d2                	test   %edx,%edx
+  802889:	74 18                	je     8028a3 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80288b:	52                   	push   %edx
+  80288c:	68 56 38 80 00       	push   $0x803856
+  802891:	53                   	push   %ebx
+  802892:	56                   	push   %esi
+  802893:	e8 92 fe ff ff       	call   80272a <printfmt>
+  802898:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80289b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80289e:	e9 7a 02 00 00       	jmp    802b1d <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8028a3:	50                   	push   %eax
+  8028a4:	68 3b 39 80 00       	push   $0x80393b
+  8028a9:	53                   	push   %ebx
+  8028aa:	56                   	push   %esi
+  8028ab:	e8 7a fe ff ff       	call   80272a <printfmt>
+  8028b0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8028b3:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8028b6:	e9 62 02 00 00       	jmp    802b1d <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8028bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028be:	83 c0 04             	add    $0x4,%eax
+  8028c1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8028c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028c7:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8028c9:	85 c9                	test   %ecx,%ecx
+  8028cb:	b8 34 39 80 00       	mov    $0x803934,%eax
+  8028d0:	0f 45 c1             	cmovne %ecx,%eax
+  8028d3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8028d6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8028da:	7e 06                	jle    8028e2 <vprintfmt+0x19b>
+  8028dc:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8028e0:	75 0b                	jne    8028ed <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028e2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8028e5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8028e8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028eb:	eb 5c                	jmp    802949 <vprintfmt+0x202>
+  8028ed:	83 ec 08             	sub    $0x8,%esp
+  8028f0:	ff 75 d0             	push   -0x30(%ebp)
+  8028f3:	ff 75 cc             	push   -0x34(%ebp)
+  8028f6:	e8 20 03 00 00       	call   802c1b <strnlen>
+  8028fb:	89 c2                	mov    %eax,%edx
+  8028fd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802900:	29 d0                	sub    %edx,%eax
+  802902:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  802905:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  802909:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80290c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80290f:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802911:	eb 0e                	jmp    802921 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  802913:	83 ec 08             	sub    $0x8,%esp
+  802916:	53                   	push   %ebx
+  802917:	57                   	push   %edi
+  802918:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80291b:	83 ee 01             	sub    $0x1,%esi
+  80291e:	83 c4 10             	add    $0x10,%esp
+  802921:	85 f6                	test   %esi,%esi
+  802923:	7f ee                	jg     802913 <vprintfmt+0x1cc>
+  802925:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802928:	8b 75 08             	mov    0x8(%ebp),%esi
+  80292b:	85 c0                	test   %eax,%eax
+  80292d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802932:	0f 49 d0             	cmovns %eax,%edx
+  802935:	29 d0                	sub    %edx,%eax
+  802937:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80293a:	eb a6                	jmp    8028e2 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80293c:	83 ec 08             	sub    $0x8,%esp
+  80293f:	53                   	push   %ebx
+  802940:	52                   	push   %edx
+  802941:	ff 55 08             	call   *0x8(%ebp)
+  802944:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802947:	89 f1                	mov    %esi,%ecx
+  802949:	8d 71 01             	lea    0x1(%ecx),%esi
+  80294c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802950:	0f be d0             	movsbl %al,%edx
+  802953:	85 d2                	test   %edx,%edx
+  802955:	74 28                	je     80297f <vprintfmt+0x238>
+  802957:	85 ff                	test   %edi,%edi
+  802959:	78 05                	js     802960 <vprintfmt+0x219>
+  80295b:	83 ef 01             	sub    $0x1,%edi
+  80295e:	78 30                	js     802990 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802960:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802964:	74 d6                	je     80293c <vprintfmt+0x1f5>
+  802966:	0f be c0             	movsbl %al,%eax
+  802969:	83 e8 20             	sub    $0x20,%eax
+  80296c:	83 f8 5e             	cmp    $0x5e,%eax
+  80296f:	76 cb                	jbe    80293c <vprintfmt+0x1f5>
+					putch('?', putdat);
+  802971:	83 ec 08             	sub    $0x8,%esp
+  802974:	53                   	push   %ebx
+  802975:	6a 3f                	push   $0x3f
+  802977:	ff 55 08             	call   *0x8(%ebp)
+  80297a:	83 c4 10             	add    $0x10,%esp
+  80297d:	eb c8                	jmp    802947 <vprintfmt+0x200>
+  80297f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802982:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802985:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802988:	01 d0                	add    %edx,%eax
+  80298a:	29 c8                	sub    %ecx,%eax
+  80298c:	89 c7                	mov    %eax,%edi
+  80298e:	eb 13                	jmp    8029a3 <vprintfmt+0x25c>
+  802990:	8b 75 08             	mov    0x8(%ebp),%esi
+  802993:	eb ed                	jmp    802982 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  802995:	83 ec 08             	sub    $0x8,%esp
+  802998:	53                   	push   %ebx
+  802999:	6a 20                	push   $0x20
+  80299b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80299d:	83 ef 01             	sub    $0x1,%edi
+  8029a0:	83 c4 10             	add    $0x10,%esp
+  8029a3:	85 ff                	test   %edi,%edi
+  8029a5:	7f ee                	jg     802995 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8029a7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8029aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8029ad:	e9 6b 01 00 00       	jmp    802b1d <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8029b2:	83 f9 01             	cmp    $0x1,%ecx
+  8029b5:	7f 1f                	jg     8029d6 <vprintfmt+0x28f>
+	else if (lflag)
+  8029b7:	85 c9                	test   %ecx,%ecx
+  8029b9:	74 67                	je     802a22 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8029bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029be:	8b 00                	mov    (%eax),%eax
+  8029c0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029c3:	89 c1                	mov    %eax,%ecx
+  8029c5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8029c8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8029cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8029d1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8029d4:	eb 17                	jmp    8029ed <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8029d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029d9:	8b 50 04             	mov    0x4(%eax),%edx
+  8029dc:	8b 00                	mov    (%eax),%eax
+  8029de:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029e1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8029e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029e7:	8d 40 08             	lea    0x8(%eax),%eax
+  8029ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8029ed:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029f0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8029f3:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8029f8:	85 c9                	test   %ecx,%ecx
+  8029fa:	0f 89 03 01 00 00    	jns    802b03 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  802a00:	83 ec 08             	sub    $0x8,%esp
+  802a03:	53                   	push   %ebx
+  802a04:	6a 2d                	push   $0x2d
+  802a06:	ff d6                	call   *%esi
+				num = -(long long) num;
+  802a08:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802a0b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802a0e:	f7 da                	neg    %edx
+  802a10:	83 d1 00             	adc    $0x0,%ecx
+  802a13:	f7 d9                	neg    %ecx
+  802a15:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802a18:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802a1d:	e9 e1 00 00 00       	jmp    802b03 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  802a22:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a25:	8b 00                	mov    (%eax),%eax
+  802a27:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802a2a:	89 c1                	mov    %eax,%ecx
+  802a2c:	c1 f9 1f             	sar    $0x1f,%ecx
+  802a2f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802a32:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a35:	8d 40 04             	lea    0x4(%eax),%eax
+  802a38:	89 45 14             	mov    %eax,0x14(%ebp)
+  802a3b:	eb b0                	jmp    8029ed <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  802a3d:	83 f9 01             	cmp    $0x1,%ecx
+  802a40:	7f 1e                	jg     802a60 <vprintfmt+0x319>
+	else if (lflag)
+  802a42:	85 c9                	test   %ecx,%ecx
+  802a44:	74 32                	je     802a78 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802a46:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a49:	8b 10                	mov    (%eax),%edx
+  802a4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a50:	8d 40 04             	lea    0x4(%eax),%eax
+  802a53:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a56:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  802a5b:	e9 a3 00 00 00       	jmp    802b03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a60:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a63:	8b 10                	mov    (%eax),%edx
+  802a65:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a68:	8d 40 08             	lea    0x8(%eax),%eax
+  802a6b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a6e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  802a73:	e9 8b 00 00 00       	jmp    802b03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a78:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a7b:	8b 10                	mov    (%eax),%edx
+  802a7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a82:	8d 40 04             	lea    0x4(%eax),%eax
+  802a85:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a88:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  802a8d:	eb 74                	jmp    802b03 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  802a8f:	83 f9 01             	cmp    $0x1,%ecx
+  802a92:	7f 1b                	jg     802aaf <vprintfmt+0x368>
+	else if (lflag)
+  802a94:	85 c9                	test   %ecx,%ecx
+  802a96:	74 2c                	je     802ac4 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  802a98:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a9b:	8b 10                	mov    (%eax),%edx
+  802a9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802aa2:	8d 40 04             	lea    0x4(%eax),%eax
+  802aa5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802aa8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  802aad:	eb 54                	jmp    802b03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802aaf:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ab2:	8b 10                	mov    (%eax),%edx
+  802ab4:	8b 48 04             	mov    0x4(%eax),%ecx
+  802ab7:	8d 40 08             	lea    0x8(%eax),%eax
+  802aba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802abd:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  802ac2:	eb 3f                	jmp    802b03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802ac4:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ac7:	8b 10                	mov    (%eax),%edx
+  802ac9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ace:	8d 40 04             	lea    0x4(%eax),%eax
+  802ad1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802ad4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802ad9:	eb 28                	jmp    802b03 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  802adb:	83 ec 08             	sub    $0x8,%esp
+  802ade:	53                   	push   %ebx
+  802adf:	6a 30                	push   $0x30
+  802ae1:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802ae3:	83 c4 08             	add    $0x8,%esp
+  802ae6:	53                   	push   %ebx
+  802ae7:	6a 78                	push   $0x78
+  802ae9:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802aeb:	8b 45 14             	mov    0x14(%ebp),%eax
+  802aee:	8b 10                	mov    (%eax),%edx
+  802af0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802af5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802af8:	8d 40 04             	lea    0x4(%eax),%eax
+  802afb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802afe:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802b03:	83 ec 0c             	sub    $0xc,%esp
+  802b06:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802b0a:	50                   	push   %eax
+  802b0b:	ff 75 e0             	push   -0x20(%ebp)
+  802b0e:	57                   	push   %edi
+  802b0f:	51                   	push   %ecx
+  802b10:	52                   	push   %edx
+  802b11:	89 da                	mov    %ebx,%edx
+  802b13:	89 f0                	mov    %esi,%eax
+  802b15:	e8 4a fb ff ff       	call   802664 <printnum>
+			break;
+  802b1a:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802b1d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802b20:	e9 40 fc ff ff       	jmp    802765 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802b25:	83 f9 01             	cmp    $0x1,%ecx
+  802b28:	7f 1b                	jg     802b45 <vprintfmt+0x3fe>
+	else if (lflag)
+  802b2a:	85 c9                	test   %ecx,%ecx
+  802b2c:	74 2c                	je     802b5a <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802b2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b31:	8b 10                	mov    (%eax),%edx
+  802b33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b38:	8d 40 04             	lea    0x4(%eax),%eax
+  802b3b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b3e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802b43:	eb be                	jmp    802b03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802b45:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b48:	8b 10                	mov    (%eax),%edx
+  802b4a:	8b 48 04             	mov    0x4(%eax),%ecx
+  802b4d:	8d 40 08             	lea    0x8(%eax),%eax
+  802b50:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b53:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802b58:	eb a9                	jmp    802b03 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802b5a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b5d:	8b 10                	mov    (%eax),%edx
+  802b5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b64:	8d 40 04             	lea    0x4(%eax),%eax
+  802b67:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b6a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  802b6f:	eb 92                	jmp    802b03 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  802b71:	83 ec 08             	sub    $0x8,%esp
+  802b74:	53                   	push   %ebx
+  802b75:	6a 25                	push   $0x25
+  802b77:	ff d6                	call   *%esi
+			break;
+  802b79:	83 c4 10             	add    $0x10,%esp
+  802b7c:	eb 9f                	jmp    802b1d <vprintfmt+0x3d6>
+			putch('%', putdat);
+  802b7e:	83 ec 08             	sub    $0x8,%esp
+  802b81:	53                   	push   %ebx
+  802b82:	6a 25                	push   $0x25
+  802b84:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802b86:	83 c4 10             	add    $0x10,%esp
+  802b89:	89 f8                	mov    %edi,%eax
+  802b8b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802b8f:	74 05                	je     802b96 <vprintfmt+0x44f>
+  802b91:	83 e8 01             	sub    $0x1,%eax
+  802b94:	eb f5                	jmp    802b8b <vprintfmt+0x444>
+  802b96:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b99:	eb 82                	jmp    802b1d <vprintfmt+0x3d6>
+
+00802b9b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802b9b:	55                   	push   %ebp
+  802b9c:	89 e5                	mov    %esp,%ebp
+  802b9e:	83 ec 18             	sub    $0x18,%esp
+  802ba1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  802ba7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802baa:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802bae:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802bb1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802bb8:	85 c0                	test   %eax,%eax
+  802bba:	74 26                	je     802be2 <vsnprintf+0x47>
+  802bbc:	85 d2                	test   %edx,%edx
+  802bbe:	7e 22                	jle    802be2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  802bc0:	ff 75 14             	push   0x14(%ebp)
+  802bc3:	ff 75 10             	push   0x10(%ebp)
+  802bc6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802bc9:	50                   	push   %eax
+  802bca:	68 0d 27 80 00       	push   $0x80270d
+  802bcf:	e8 73 fb ff ff       	call   802747 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802bd4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802bd7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802bda:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bdd:	83 c4 10             	add    $0x10,%esp
+}
+  802be0:	c9                   	leave
+  802be1:	c3                   	ret
+		return -E_INVAL;
+  802be2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802be7:	eb f7                	jmp    802be0 <vsnprintf+0x45>
+
+00802be9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802be9:	55                   	push   %ebp
+  802bea:	89 e5                	mov    %esp,%ebp
+  802bec:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  802bef:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802bf2:	50                   	push   %eax
+  802bf3:	ff 75 10             	push   0x10(%ebp)
+  802bf6:	ff 75 0c             	push   0xc(%ebp)
+  802bf9:	ff 75 08             	push   0x8(%ebp)
+  802bfc:	e8 9a ff ff ff       	call   802b9b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802c01:	c9                   	leave
+  802c02:	c3                   	ret
+
+00802c03 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802c03:	55                   	push   %ebp
+  802c04:	89 e5                	mov    %esp,%ebp
+  802c06:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802c09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0e:	eb 03                	jmp    802c13 <strlen+0x10>
+		n++;
+  802c10:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802c13:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802c17:	75 f7                	jne    802c10 <strlen+0xd>
+	return n;
+}
+  802c19:	5d                   	pop    %ebp
+  802c1a:	c3                   	ret
+
+00802c1b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802c1b:	55                   	push   %ebp
+  802c1c:	89 e5                	mov    %esp,%ebp
+  802c1e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802c21:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c29:	eb 03                	jmp    802c2e <strnlen+0x13>
+		n++;
+  802c2b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802c2e:	39 d0                	cmp    %edx,%eax
+  802c30:	74 08                	je     802c3a <strnlen+0x1f>
+  802c32:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802c36:	75 f3                	jne    802c2b <strnlen+0x10>
+  802c38:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802c3a:	89 d0                	mov    %edx,%eax
+  802c3c:	5d                   	pop    %ebp
+  802c3d:	c3                   	ret
+
+00802c3e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802c3e:	55                   	push   %ebp
+  802c3f:	89 e5                	mov    %esp,%ebp
+  802c41:	53                   	push   %ebx
+  802c42:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c45:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802c48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802c51:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802c54:	83 c0 01             	add    $0x1,%eax
+  802c57:	84 d2                	test   %dl,%dl
+  802c59:	75 f2                	jne    802c4d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  802c5b:	89 c8                	mov    %ecx,%eax
+  802c5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c60:	c9                   	leave
+  802c61:	c3                   	ret
+
+00802c62 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802c62:	55                   	push   %ebp
+  802c63:	89 e5                	mov    %esp,%ebp
+  802c65:	53                   	push   %ebx
+  802c66:	83 ec 10             	sub    $0x10,%esp
+  802c69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  802c6c:	53                   	push   %ebx
+  802c6d:	e8 91 ff ff ff       	call   802c03 <strlen>
+  802c72:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  802c75:	ff 75 0c             	push   0xc(%ebp)
+  802c78:	01 d8                	add    %ebx,%eax
+  802c7a:	50                   	push   %eax
+  802c7b:	e8 be ff ff ff       	call   802c3e <strcpy>
+	return dst;
+}
+  802c80:	89 d8                	mov    %ebx,%eax
+  802c82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c85:	c9                   	leave
+  802c86:	c3                   	ret
+
+00802c87 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802c87:	55                   	push   %ebp
+  802c88:	89 e5                	mov    %esp,%ebp
+  802c8a:	56                   	push   %esi
+  802c8b:	53                   	push   %ebx
+  802c8c:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  802c92:	89 f3                	mov    %esi,%ebx
+  802c94:	03 5d 10             	add    0x10(%ebp),%ebx
+  802c97:	89 f0                	mov    %esi,%eax
+  802c99:	eb 0f                	jmp    802caa <strncpy+0x23>
+		*dst++ = *src;
+  802c9b:	83 c0 01             	add    $0x1,%eax
+  802c9e:	0f b6 0a             	movzbl (%edx),%ecx
+  802ca1:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  802ca4:	80 f9 01             	cmp    $0x1,%cl
+  802ca7:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  802caa:	39 d8                	cmp    %ebx,%eax
+  802cac:	75 ed                	jne    802c9b <strncpy+0x14>
+	}
+	return ret;
+}
+  802cae:	89 f0                	mov    %esi,%eax
+  802cb0:	5b                   	pop    %ebx
+  802cb1:	5e                   	pop    %esi
+  802cb2:	5d                   	pop    %ebp
+  802cb3:	c3                   	ret
+
+00802cb4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802cb4:	55                   	push   %ebp
+  802cb5:	89 e5                	mov    %esp,%ebp
+  802cb7:	56                   	push   %esi
+  802cb8:	53                   	push   %ebx
+  802cb9:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cbf:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  802cc2:	89 f0                	mov    %esi,%eax
+  802cc4:	85 d2                	test   %edx,%edx
+  802cc6:	74 21                	je     802ce9 <strlcpy+0x35>
+  802cc8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  802ccc:	89 f2                	mov    %esi,%edx
+  802cce:	eb 09                	jmp    802cd9 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  802cd0:	83 c1 01             	add    $0x1,%ecx
+  802cd3:	83 c2 01             	add    $0x1,%edx
+  802cd6:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  802cd9:	39 c2                	cmp    %eax,%edx
+  802cdb:	74 09                	je     802ce6 <strlcpy+0x32>
+  802cdd:	0f b6 19             	movzbl (%ecx),%ebx
+  802ce0:	84 db                	test   %bl,%bl
+  802ce2:	75 ec                	jne    802cd0 <strlcpy+0x1c>
+  802ce4:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802ce6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802ce9:	29 f0                	sub    %esi,%eax
+}
+  802ceb:	5b                   	pop    %ebx
+  802cec:	5e                   	pop    %esi
+  802ced:	5d                   	pop    %ebp
+  802cee:	c3                   	ret
+
+00802cef <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802cef:	55                   	push   %ebp
+  802cf0:	89 e5                	mov    %esp,%ebp
+  802cf2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802cf5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802cf8:	eb 06                	jmp    802d00 <strcmp+0x11>
+		p++, q++;
+  802cfa:	83 c1 01             	add    $0x1,%ecx
+  802cfd:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802d00:	0f b6 01             	movzbl (%ecx),%eax
+  802d03:	84 c0                	test   %al,%al
+  802d05:	74 04                	je     802d0b <strcmp+0x1c>
+  802d07:	3a 02                	cmp    (%edx),%al
+  802d09:	74 ef                	je     802cfa <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802d0b:	0f b6 c0             	movzbl %al,%eax
+  802d0e:	0f b6 12             	movzbl (%edx),%edx
+  802d11:	29 d0                	sub    %edx,%eax
+}
+  802d13:	5d                   	pop    %ebp
+  802d14:	c3                   	ret
+
+00802d15 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802d15:	55                   	push   %ebp
+  802d16:	89 e5                	mov    %esp,%ebp
+  802d18:	53                   	push   %ebx
+  802d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d1f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802d22:	eb 09                	jmp    802d2d <strncmp+0x18>
+		n--, p++, q++;
+  802d24:	83 ea 01             	sub    $0x1,%edx
+  802d27:	83 c0 01             	add    $0x1,%eax
+  802d2a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802d2d:	85 d2                	test   %edx,%edx
+  802d2f:	74 18                	je     802d49 <strncmp+0x34>
+  802d31:	0f b6 18             	movzbl (%eax),%ebx
+  802d34:	84 db                	test   %bl,%bl
+  802d36:	74 04                	je     802d3c <strncmp+0x27>
+  802d38:	3a 19                	cmp    (%ecx),%bl
+  802d3a:	74 e8                	je     802d24 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802d3c:	0f b6 00             	movzbl (%eax),%eax
+  802d3f:	0f b6 11             	movzbl (%ecx),%edx
+  802d42:	29 d0                	sub    %edx,%eax
+}
+  802d44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d47:	c9                   	leave
+  802d48:	c3                   	ret
+		return 0;
+  802d49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4e:	eb f4                	jmp    802d44 <strncmp+0x2f>
+
+00802d50 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802d50:	55                   	push   %ebp
+  802d51:	89 e5                	mov    %esp,%ebp
+  802d53:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d56:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d5a:	eb 03                	jmp    802d5f <strchr+0xf>
+  802d5c:	83 c0 01             	add    $0x1,%eax
+  802d5f:	0f b6 10             	movzbl (%eax),%edx
+  802d62:	84 d2                	test   %dl,%dl
+  802d64:	74 06                	je     802d6c <strchr+0x1c>
+		if (*s == c)
+  802d66:	38 ca                	cmp    %cl,%dl
+  802d68:	75 f2                	jne    802d5c <strchr+0xc>
+  802d6a:	eb 05                	jmp    802d71 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  802d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d71:	5d                   	pop    %ebp
+  802d72:	c3                   	ret
+
+00802d73 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802d73:	55                   	push   %ebp
+  802d74:	89 e5                	mov    %esp,%ebp
+  802d76:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d79:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d7d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  802d80:	38 ca                	cmp    %cl,%dl
+  802d82:	74 09                	je     802d8d <strfind+0x1a>
+  802d84:	84 d2                	test   %dl,%dl
+  802d86:	74 05                	je     802d8d <strfind+0x1a>
+	for (; *s; s++)
+  802d88:	83 c0 01             	add    $0x1,%eax
+  802d8b:	eb f0                	jmp    802d7d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  802d8d:	5d                   	pop    %ebp
+  802d8e:	c3                   	ret
+
+00802d8f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802d8f:	55                   	push   %ebp
+  802d90:	89 e5                	mov    %esp,%ebp
+  802d92:	57                   	push   %edi
+  802d93:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d96:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  802d99:	85 c9                	test   %ecx,%ecx
+  802d9b:	74 20                	je     802dbd <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  802d9d:	89 f8                	mov    %edi,%eax
+  802d9f:	09 c8                	or     %ecx,%eax
+  802da1:	a8 03                	test   $0x3,%al
+  802da3:	75 12                	jne    802db7 <memset+0x28>
+		c &= 0xFF;
+  802da5:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802da9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  802daf:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  802db2:	fc                   	cld
+  802db3:	f3 ab                	rep stos %eax,%es:(%edi)
+  802db5:	eb 06                	jmp    802dbd <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  802db7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dba:	fc                   	cld
+  802dbb:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  802dbd:	89 f8                	mov    %edi,%eax
+  802dbf:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802dc2:	c9                   	leave
+  802dc3:	c3                   	ret
+
+00802dc4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  802dc4:	55                   	push   %ebp
+  802dc5:	89 e5                	mov    %esp,%ebp
+  802dc7:	57                   	push   %edi
+  802dc8:	56                   	push   %esi
+  802dc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dcc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802dcf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  802dd2:	39 c6                	cmp    %eax,%esi
+  802dd4:	73 32                	jae    802e08 <memmove+0x44>
+  802dd6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802dd9:	39 d0                	cmp    %edx,%eax
+  802ddb:	73 2b                	jae    802e08 <memmove+0x44>
+		s += n;
+		d += n;
+  802ddd:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802de0:	89 d6                	mov    %edx,%esi
+  802de2:	09 fe                	or     %edi,%esi
+  802de4:	09 ce                	or     %ecx,%esi
+  802de6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802dec:	75 0e                	jne    802dfc <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802dee:	83 ef 04             	sub    $0x4,%edi
+  802df1:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802df4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802df7:	fd                   	std
+  802df8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802dfa:	eb 09                	jmp    802e05 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802dfc:	83 ef 01             	sub    $0x1,%edi
+  802dff:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802e02:	fd                   	std
+  802e03:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802e05:	fc                   	cld
+  802e06:	eb 1a                	jmp    802e22 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802e08:	89 f2                	mov    %esi,%edx
+  802e0a:	09 c2                	or     %eax,%edx
+  802e0c:	09 ca                	or     %ecx,%edx
+  802e0e:	f6 c2 03             	test   $0x3,%dl
+  802e11:	75 0a                	jne    802e1d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802e13:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802e16:	89 c7                	mov    %eax,%edi
+  802e18:	fc                   	cld
+  802e19:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802e1b:	eb 05                	jmp    802e22 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802e1d:	89 c7                	mov    %eax,%edi
+  802e1f:	fc                   	cld
+  802e20:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802e22:	5e                   	pop    %esi
+  802e23:	5f                   	pop    %edi
+  802e24:	5d                   	pop    %ebp
+  802e25:	c3                   	ret
+
+00802e26 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802e26:	55                   	push   %ebp
+  802e27:	89 e5                	mov    %esp,%ebp
+  802e29:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802e2c:	ff 75 10             	push   0x10(%ebp)
+  802e2f:	ff 75 0c             	push   0xc(%ebp)
+  802e32:	ff 75 08             	push   0x8(%ebp)
+  802e35:	e8 8a ff ff ff       	call   802dc4 <memmove>
+}
+  802e3a:	c9                   	leave
+  802e3b:	c3                   	ret
+
+00802e3c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802e3c:	55                   	push   %ebp
+  802e3d:	89 e5                	mov    %esp,%ebp
+  802e3f:	56                   	push   %esi
+  802e40:	53                   	push   %ebx
+  802e41:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e44:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802e47:	89 c6                	mov    %eax,%esi
+  802e49:	03 75 10             	add    0x10(%ebp),%esi
+  802e4c:	eb 06                	jmp    802e54 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802e4e:	83 c0 01             	add    $0x1,%eax
+  802e51:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802e54:	39 f0                	cmp    %esi,%eax
+  802e56:	74 14                	je     802e6c <memcmp+0x30>
+		if (*s1 != *s2)
+  802e58:	0f b6 08             	movzbl (%eax),%ecx
+  802e5b:	0f b6 1a             	movzbl (%edx),%ebx
+  802e5e:	38 d9                	cmp    %bl,%cl
+  802e60:	74 ec                	je     802e4e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802e62:	0f b6 c1             	movzbl %cl,%eax
+  802e65:	0f b6 db             	movzbl %bl,%ebx
+  802e68:	29 d8                	sub    %ebx,%eax
+  802e6a:	eb 05                	jmp    802e71 <memcmp+0x35>
+	}
+
+	return 0;
+  802e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e71:	5b                   	pop    %ebx
+  802e72:	5e                   	pop    %esi
+  802e73:	5d                   	pop    %ebp
+  802e74:	c3                   	ret
+
+00802e75 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802e75:	55                   	push   %ebp
+  802e76:	89 e5                	mov    %esp,%ebp
+  802e78:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802e7e:	89 c2                	mov    %eax,%edx
+  802e80:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802e83:	eb 03                	jmp    802e88 <memfind+0x13>
+  802e85:	83 c0 01             	add    $0x1,%eax
+  802e88:	39 d0                	cmp    %edx,%eax
+  802e8a:	73 04                	jae    802e90 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802e8c:	38 08                	cmp    %cl,(%eax)
+  802e8e:	75 f5                	jne    802e85 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802e90:	5d                   	pop    %ebp
+  802e91:	c3                   	ret
+
+00802e92 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802e92:	55                   	push   %ebp
+  802e93:	89 e5                	mov    %esp,%ebp
+  802e95:	57                   	push   %edi
+  802e96:	56                   	push   %esi
+  802e97:	53                   	push   %ebx
+  802e98:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e9b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802e9e:	eb 03                	jmp    802ea3 <strtol+0x11>
+		s++;
+  802ea0:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802ea3:	0f b6 02             	movzbl (%edx),%eax
+  802ea6:	3c 20                	cmp    $0x20,%al
+  802ea8:	74 f6                	je     802ea0 <strtol+0xe>
+  802eaa:	3c 09                	cmp    $0x9,%al
+  802eac:	74 f2                	je     802ea0 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802eae:	3c 2b                	cmp    $0x2b,%al
+  802eb0:	74 2a                	je     802edc <strtol+0x4a>
+	int neg = 0;
+  802eb2:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802eb7:	3c 2d                	cmp    $0x2d,%al
+  802eb9:	74 2b                	je     802ee6 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802ebb:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802ec1:	75 0f                	jne    802ed2 <strtol+0x40>
+  802ec3:	80 3a 30             	cmpb   $0x30,(%edx)
+  802ec6:	74 28                	je     802ef0 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802ec8:	85 db                	test   %ebx,%ebx
+  802eca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802ecf:	0f 44 d8             	cmove  %eax,%ebx
+  802ed2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ed7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802eda:	eb 46                	jmp    802f22 <strtol+0x90>
+		s++;
+  802edc:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802edf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ee4:	eb d5                	jmp    802ebb <strtol+0x29>
+		s++, neg = 1;
+  802ee6:	83 c2 01             	add    $0x1,%edx
+  802ee9:	bf 01 00 00 00       	mov    $0x1,%edi
+  802eee:	eb cb                	jmp    802ebb <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802ef0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802ef4:	74 0e                	je     802f04 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802ef6:	85 db                	test   %ebx,%ebx
+  802ef8:	75 d8                	jne    802ed2 <strtol+0x40>
+		s++, base = 8;
+  802efa:	83 c2 01             	add    $0x1,%edx
+  802efd:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802f02:	eb ce                	jmp    802ed2 <strtol+0x40>
+		s += 2, base = 16;
+  802f04:	83 c2 02             	add    $0x2,%edx
+  802f07:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802f0c:	eb c4                	jmp    802ed2 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802f0e:	0f be c0             	movsbl %al,%eax
+  802f11:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802f14:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802f17:	7d 3a                	jge    802f53 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802f19:	83 c2 01             	add    $0x1,%edx
+  802f1c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802f20:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802f22:	0f b6 02             	movzbl (%edx),%eax
+  802f25:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802f28:	89 f3                	mov    %esi,%ebx
+  802f2a:	80 fb 09             	cmp    $0x9,%bl
+  802f2d:	76 df                	jbe    802f0e <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  802f2f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802f32:	89 f3                	mov    %esi,%ebx
+  802f34:	80 fb 19             	cmp    $0x19,%bl
+  802f37:	77 08                	ja     802f41 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802f39:	0f be c0             	movsbl %al,%eax
+  802f3c:	83 e8 57             	sub    $0x57,%eax
+  802f3f:	eb d3                	jmp    802f14 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802f41:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802f44:	89 f3                	mov    %esi,%ebx
+  802f46:	80 fb 19             	cmp    $0x19,%bl
+  802f49:	77 08                	ja     802f53 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802f4b:	0f be c0             	movsbl %al,%eax
+  802f4e:	83 e8 37             	sub    $0x37,%eax
+  802f51:	eb c1                	jmp    802f14 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802f53:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802f57:	74 05                	je     802f5e <strtol+0xcc>
+		*endptr = (char *) s;
+  802f59:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f5c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802f5e:	89 c8                	mov    %ecx,%eax
+  802f60:	f7 d8                	neg    %eax
+  802f62:	85 ff                	test   %edi,%edi
+  802f64:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802f67:	89 c8                	mov    %ecx,%eax
+  802f69:	5b                   	pop    %ebx
+  802f6a:	5e                   	pop    %esi
+  802f6b:	5f                   	pop    %edi
+  802f6c:	5d                   	pop    %ebp
+  802f6d:	c3                   	ret
+
+00802f6e <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802f6e:	55                   	push   %ebp
+  802f6f:	89 e5                	mov    %esp,%ebp
+  802f71:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  802f74:	83 3d 04 90 80 00 00 	cmpl   $0x0,0x809004
+  802f7b:	74 0a                	je     802f87 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802f7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f80:	a3 04 90 80 00       	mov    %eax,0x809004
+}
+  802f85:	c9                   	leave
+  802f86:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  802f87:	83 ec 04             	sub    $0x4,%esp
+  802f8a:	6a 07                	push   $0x7
+  802f8c:	68 00 f0 bf ee       	push   $0xeebff000
+  802f91:	6a 00                	push   $0x0
+  802f93:	e8 fb d1 ff ff       	call   800193 <sys_page_alloc>
+  802f98:	83 c4 10             	add    $0x10,%esp
+  802f9b:	85 c0                	test   %eax,%eax
+  802f9d:	75 2c                	jne    802fcb <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  802f9f:	83 ec 08             	sub    $0x8,%esp
+  802fa2:	68 94 05 80 00       	push   $0x800594
+  802fa7:	6a 00                	push   $0x0
+  802fa9:	e8 50 d3 ff ff       	call   8002fe <sys_env_set_pgfault_upcall>
+  802fae:	83 c4 10             	add    $0x10,%esp
+  802fb1:	85 c0                	test   %eax,%eax
+  802fb3:	74 c8                	je     802f7d <set_pgfault_handler+0xf>
+  802fb5:	68 90 3c 80 00       	push   $0x803c90
+  802fba:	68 44 38 80 00       	push   $0x803844
+  802fbf:	6a 20                	push   $0x20
+  802fc1:	68 c0 3c 80 00       	push   $0x803cc0
+  802fc6:	e8 aa f5 ff ff       	call   802575 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  802fcb:	68 48 3c 80 00       	push   $0x803c48
+  802fd0:	68 44 38 80 00       	push   $0x803844
+  802fd5:	6a 1e                	push   $0x1e
+  802fd7:	68 c0 3c 80 00       	push   $0x803cc0
+  802fdc:	e8 94 f5 ff ff       	call   802575 <_panic>
+
+00802fe1 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802fe1:	55                   	push   %ebp
+  802fe2:	89 e5                	mov    %esp,%ebp
+  802fe4:	57                   	push   %edi
+  802fe5:	56                   	push   %esi
+  802fe6:	53                   	push   %ebx
+  802fe7:	83 ec 20             	sub    $0x20,%esp
+  802fea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802fed:	89 d7                	mov    %edx,%edi
+  802fef:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802ff1:	51                   	push   %ecx
+  802ff2:	68 00 f0 7f 00       	push   $0x7ff000
+  802ff7:	6a 00                	push   $0x0
+  802ff9:	e8 95 d1 ff ff       	call   800193 <sys_page_alloc>
+  802ffe:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803000:	83 c4 10             	add    $0x10,%esp
+  803003:	85 c0                	test   %eax,%eax
+  803005:	78 45                	js     80304c <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  803007:	83 ec 04             	sub    $0x4,%esp
+  80300a:	68 00 10 00 00       	push   $0x1000
+  80300f:	57                   	push   %edi
+  803010:	68 00 f0 7f 00       	push   $0x7ff000
+  803015:	e8 aa fd ff ff       	call   802dc4 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  80301a:	89 34 24             	mov    %esi,(%esp)
+  80301d:	57                   	push   %edi
+  80301e:	ff 75 e4             	push   -0x1c(%ebp)
+  803021:	68 00 f0 7f 00       	push   $0x7ff000
+  803026:	6a 00                	push   $0x0
+  803028:	e8 b1 d1 ff ff       	call   8001de <sys_page_map>
+  80302d:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80302f:	83 c4 20             	add    $0x20,%esp
+  803032:	85 c0                	test   %eax,%eax
+  803034:	78 16                	js     80304c <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803036:	83 ec 08             	sub    $0x8,%esp
+  803039:	68 00 f0 7f 00       	push   $0x7ff000
+  80303e:	6a 00                	push   $0x0
+  803040:	e8 db d1 ff ff       	call   800220 <sys_page_unmap>
+  803045:	83 c4 10             	add    $0x10,%esp
+  803048:	85 c0                	test   %eax,%eax
+  80304a:	75 0a                	jne    803056 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  80304c:	89 d8                	mov    %ebx,%eax
+  80304e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803051:	5b                   	pop    %ebx
+  803052:	5e                   	pop    %esi
+  803053:	5f                   	pop    %edi
+  803054:	5d                   	pop    %ebp
+  803055:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803056:	68 d0 3c 80 00       	push   $0x803cd0
+  80305b:	68 44 38 80 00       	push   $0x803844
+  803060:	6a 1b                	push   $0x1b
+  803062:	68 48 3d 80 00       	push   $0x803d48
+  803067:	e8 09 f5 ff ff       	call   802575 <_panic>
+
+0080306c <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80306c:	55                   	push   %ebp
+  80306d:	89 e5                	mov    %esp,%ebp
+  80306f:	53                   	push   %ebx
+  803070:	83 ec 04             	sub    $0x4,%esp
+  803073:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803076:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803078:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  80307c:	74 21                	je     80309f <pgfault+0x33>
+  80307e:	89 d0                	mov    %edx,%eax
+  803080:	c1 e8 16             	shr    $0x16,%eax
+  803083:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80308a:	a8 01                	test   $0x1,%al
+  80308c:	74 11                	je     80309f <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  80308e:	89 d0                	mov    %edx,%eax
+  803090:	c1 e8 0c             	shr    $0xc,%eax
+  803093:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80309a:	f6 c4 08             	test   $0x8,%ah
+  80309d:	75 17                	jne    8030b6 <pgfault+0x4a>
+		if (pgfault_next) {
+  80309f:	a1 08 90 80 00       	mov    0x809008,%eax
+  8030a4:	85 c0                	test   %eax,%eax
+  8030a6:	74 27                	je     8030cf <pgfault+0x63>
+			pgfault_next(utf);
+  8030a8:	83 ec 0c             	sub    $0xc,%esp
+  8030ab:	53                   	push   %ebx
+  8030ac:	ff d0                	call   *%eax
+			return;
+  8030ae:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8030b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030b4:	c9                   	leave
+  8030b5:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8030b6:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8030bc:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8030c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c6:	e8 16 ff ff ff       	call   802fe1 <copy_page_to>
+  8030cb:	85 c0                	test   %eax,%eax
+  8030cd:	79 e2                	jns    8030b1 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8030cf:	a1 00 50 80 00       	mov    0x805000,%eax
+  8030d4:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8030d7:	ff 73 28             	push   0x28(%ebx)
+  8030da:	ff 33                	push   (%ebx)
+  8030dc:	50                   	push   %eax
+  8030dd:	68 f4 3c 80 00       	push   $0x803cf4
+  8030e2:	e8 69 f5 ff ff       	call   802650 <cprintf>
+	sys_env_destroy(0);
+  8030e7:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8030ee:	e8 11 d0 ff ff       	call   800104 <sys_env_destroy>
+  8030f3:	83 c4 10             	add    $0x10,%esp
+  8030f6:	eb b9                	jmp    8030b1 <pgfault+0x45>
+
+008030f8 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8030f8:	55                   	push   %ebp
+  8030f9:	89 e5                	mov    %esp,%ebp
+  8030fb:	53                   	push   %ebx
+  8030fc:	83 ec 04             	sub    $0x4,%esp
+  8030ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803102:	a1 04 90 80 00       	mov    0x809004,%eax
+  803107:	3d 6c 30 80 00       	cmp    $0x80306c,%eax
+  80310c:	74 15                	je     803123 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80310e:	a3 08 90 80 00       	mov    %eax,0x809008
+		set_pgfault_handler(pgfault);
+  803113:	83 ec 0c             	sub    $0xc,%esp
+  803116:	68 6c 30 80 00       	push   $0x80306c
+  80311b:	e8 4e fe ff ff       	call   802f6e <set_pgfault_handler>
+  803120:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803123:	83 ec 0c             	sub    $0xc,%esp
+  803126:	68 05 08 00 00       	push   $0x805
+  80312b:	53                   	push   %ebx
+  80312c:	6a 00                	push   $0x0
+  80312e:	53                   	push   %ebx
+  80312f:	6a 00                	push   $0x0
+  803131:	e8 a8 d0 ff ff       	call   8001de <sys_page_map>
+}
+  803136:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803139:	c9                   	leave
+  80313a:	c3                   	ret
+
+0080313b <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80313b:	55                   	push   %ebp
+  80313c:	89 e5                	mov    %esp,%ebp
+  80313e:	57                   	push   %edi
+  80313f:	56                   	push   %esi
+  803140:	53                   	push   %ebx
+  803141:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  803144:	68 6c 30 80 00       	push   $0x80306c
+  803149:	e8 20 fe ff ff       	call   802f6e <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80314e:	b8 07 00 00 00       	mov    $0x7,%eax
+  803153:	cd 30                	int    $0x30
+  803155:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803158:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  80315b:	83 c4 10             	add    $0x10,%esp
+  80315e:	85 c0                	test   %eax,%eax
+  803160:	0f 88 6b 01 00 00    	js     8032d1 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803166:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  80316b:	75 37                	jne    8031a4 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80316d:	e8 db cf ff ff       	call   80014d <sys_getenvid>
+  803172:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803177:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80317d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803182:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  803187:	e9 45 01 00 00       	jmp    8032d1 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  80318c:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803192:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803198:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80319e:	0f 87 ba 00 00 00    	ja     80325e <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8031a4:	89 d8                	mov    %ebx,%eax
+  8031a6:	c1 e8 16             	shr    $0x16,%eax
+  8031a9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8031b0:	a8 01                	test   $0x1,%al
+  8031b2:	74 d8                	je     80318c <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8031b4:	89 d8                	mov    %ebx,%eax
+  8031b6:	c1 e8 0c             	shr    $0xc,%eax
+  8031b9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031c0:	f6 c2 01             	test   $0x1,%dl
+  8031c3:	74 cd                	je     803192 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8031c5:	89 da                	mov    %ebx,%edx
+  8031c7:	80 e6 df             	and    $0xdf,%dh
+  8031ca:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8031d0:	74 c0                	je     803192 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8031d2:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8031d4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031db:	f6 c6 04             	test   $0x4,%dh
+  8031de:	75 53                	jne    803233 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8031e0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8031e7:	f6 c6 08             	test   $0x8,%dh
+  8031ea:	75 0c                	jne    8031f8 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8031ec:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031f3:	f6 c2 02             	test   $0x2,%dl
+  8031f6:	74 3b                	je     803233 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8031f8:	83 ec 0c             	sub    $0xc,%esp
+  8031fb:	68 05 08 00 00       	push   $0x805
+  803200:	57                   	push   %edi
+  803201:	ff 75 e4             	push   -0x1c(%ebp)
+  803204:	57                   	push   %edi
+  803205:	6a 00                	push   $0x0
+  803207:	e8 d2 cf ff ff       	call   8001de <sys_page_map>
+  80320c:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80320e:	83 c4 20             	add    $0x20,%esp
+  803211:	85 c0                	test   %eax,%eax
+  803213:	0f 88 a7 00 00 00    	js     8032c0 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803219:	83 ec 0c             	sub    $0xc,%esp
+  80321c:	68 05 08 00 00       	push   $0x805
+  803221:	57                   	push   %edi
+  803222:	6a 00                	push   $0x0
+  803224:	57                   	push   %edi
+  803225:	6a 00                	push   $0x0
+  803227:	e8 b2 cf ff ff       	call   8001de <sys_page_map>
+  80322c:	89 c6                	mov    %eax,%esi
+	return r;
+  80322e:	83 c4 20             	add    $0x20,%esp
+  803231:	eb 21                	jmp    803254 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803233:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80323a:	83 ec 0c             	sub    $0xc,%esp
+  80323d:	25 07 0e 00 00       	and    $0xe07,%eax
+  803242:	50                   	push   %eax
+  803243:	57                   	push   %edi
+  803244:	ff 75 e4             	push   -0x1c(%ebp)
+  803247:	57                   	push   %edi
+  803248:	6a 00                	push   $0x0
+  80324a:	e8 8f cf ff ff       	call   8001de <sys_page_map>
+  80324f:	89 c6                	mov    %eax,%esi
+  803251:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  803254:	85 f6                	test   %esi,%esi
+  803256:	0f 89 36 ff ff ff    	jns    803192 <fork+0x57>
+  80325c:	eb 62                	jmp    8032c0 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80325e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803263:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  803268:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80326b:	89 f8                	mov    %edi,%eax
+  80326d:	e8 6f fd ff ff       	call   802fe1 <copy_page_to>
+  803272:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803274:	85 c0                	test   %eax,%eax
+  803276:	78 48                	js     8032c0 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803278:	83 ec 04             	sub    $0x4,%esp
+  80327b:	6a 07                	push   $0x7
+  80327d:	68 00 f0 bf ee       	push   $0xeebff000
+  803282:	57                   	push   %edi
+  803283:	e8 0b cf ff ff       	call   800193 <sys_page_alloc>
+  803288:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80328a:	83 c4 10             	add    $0x10,%esp
+  80328d:	85 c0                	test   %eax,%eax
+  80328f:	78 2f                	js     8032c0 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803291:	a1 00 50 80 00       	mov    0x805000,%eax
+  803296:	8b 40 64             	mov    0x64(%eax),%eax
+  803299:	83 ec 08             	sub    $0x8,%esp
+  80329c:	50                   	push   %eax
+  80329d:	57                   	push   %edi
+  80329e:	e8 5b d0 ff ff       	call   8002fe <sys_env_set_pgfault_upcall>
+  8032a3:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032a5:	83 c4 10             	add    $0x10,%esp
+  8032a8:	85 c0                	test   %eax,%eax
+  8032aa:	78 14                	js     8032c0 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8032ac:	83 ec 08             	sub    $0x8,%esp
+  8032af:	6a 02                	push   $0x2
+  8032b1:	57                   	push   %edi
+  8032b2:	e8 b3 cf ff ff       	call   80026a <sys_env_set_status>
+  8032b7:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032b9:	83 c4 10             	add    $0x10,%esp
+  8032bc:	85 c0                	test   %eax,%eax
+  8032be:	79 11                	jns    8032d1 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8032c0:	83 ec 0c             	sub    $0xc,%esp
+  8032c3:	ff 75 e0             	push   -0x20(%ebp)
+  8032c6:	e8 39 ce ff ff       	call   800104 <sys_env_destroy>
+	return r;
+  8032cb:	83 c4 10             	add    $0x10,%esp
+  8032ce:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8032d1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032d7:	5b                   	pop    %ebx
+  8032d8:	5e                   	pop    %esi
+  8032d9:	5f                   	pop    %edi
+  8032da:	5d                   	pop    %ebp
+  8032db:	c3                   	ret
+
+008032dc <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8032dc:	55                   	push   %ebp
+  8032dd:	89 e5                	mov    %esp,%ebp
+  8032df:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8032e2:	68 53 3d 80 00       	push   $0x803d53
+  8032e7:	68 bf 00 00 00       	push   $0xbf
+  8032ec:	68 48 3d 80 00       	push   $0x803d48
+  8032f1:	e8 7f f2 ff ff       	call   802575 <_panic>
+
+008032f6 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8032f6:	55                   	push   %ebp
+  8032f7:	89 e5                	mov    %esp,%ebp
+  8032f9:	56                   	push   %esi
+  8032fa:	53                   	push   %ebx
+  8032fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803301:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803304:	85 c0                	test   %eax,%eax
+  803306:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80330b:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80330e:	83 ec 0c             	sub    $0xc,%esp
+  803311:	50                   	push   %eax
+  803312:	e8 c4 d0 ff ff       	call   8003db <sys_ipc_recv>
+	if (from_env_store)
+  803317:	83 c4 10             	add    $0x10,%esp
+  80331a:	85 f6                	test   %esi,%esi
+  80331c:	74 14                	je     803332 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80331e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803323:	85 c0                	test   %eax,%eax
+  803325:	75 09                	jne    803330 <ipc_recv+0x3a>
+  803327:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80332d:	8b 52 74             	mov    0x74(%edx),%edx
+  803330:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803332:	85 db                	test   %ebx,%ebx
+  803334:	74 25                	je     80335b <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803336:	85 c0                	test   %eax,%eax
+  803338:	74 0d                	je     803347 <ipc_recv+0x51>
+  80333a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803340:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803343:	5b                   	pop    %ebx
+  803344:	5e                   	pop    %esi
+  803345:	5d                   	pop    %ebp
+  803346:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803347:	a1 00 50 80 00       	mov    0x805000,%eax
+  80334c:	8b 40 78             	mov    0x78(%eax),%eax
+  80334f:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803351:	a1 00 50 80 00       	mov    0x805000,%eax
+  803356:	8b 40 70             	mov    0x70(%eax),%eax
+  803359:	eb e5                	jmp    803340 <ipc_recv+0x4a>
+  80335b:	85 c0                	test   %eax,%eax
+  80335d:	75 e1                	jne    803340 <ipc_recv+0x4a>
+  80335f:	eb f0                	jmp    803351 <ipc_recv+0x5b>
+
+00803361 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803361:	55                   	push   %ebp
+  803362:	89 e5                	mov    %esp,%ebp
+  803364:	57                   	push   %edi
+  803365:	56                   	push   %esi
+  803366:	53                   	push   %ebx
+  803367:	83 ec 0c             	sub    $0xc,%esp
+  80336a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80336d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803370:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803373:	85 db                	test   %ebx,%ebx
+  803375:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80337a:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80337d:	ff 75 14             	push   0x14(%ebp)
+  803380:	53                   	push   %ebx
+  803381:	56                   	push   %esi
+  803382:	57                   	push   %edi
+  803383:	e8 c0 cf ff ff       	call   800348 <sys_ipc_try_send>
+  803388:	83 c4 10             	add    $0x10,%esp
+  80338b:	85 c0                	test   %eax,%eax
+  80338d:	74 22                	je     8033b1 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  80338f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803392:	75 07                	jne    80339b <ipc_send+0x3a>
+		sys_yield();
+  803394:	e8 db cd ff ff       	call   800174 <sys_yield>
+  803399:	eb e2                	jmp    80337d <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80339b:	68 69 3d 80 00       	push   $0x803d69
+  8033a0:	68 44 38 80 00       	push   $0x803844
+  8033a5:	6a 39                	push   $0x39
+  8033a7:	68 7e 3d 80 00       	push   $0x803d7e
+  8033ac:	e8 c4 f1 ff ff       	call   802575 <_panic>
+	}
+}
+  8033b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033b4:	5b                   	pop    %ebx
+  8033b5:	5e                   	pop    %esi
+  8033b6:	5f                   	pop    %edi
+  8033b7:	5d                   	pop    %ebp
+  8033b8:	c3                   	ret
+
+008033b9 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  8033b9:	55                   	push   %ebp
+  8033ba:	89 e5                	mov    %esp,%ebp
+  8033bc:	57                   	push   %edi
+  8033bd:	56                   	push   %esi
+  8033be:	53                   	push   %ebx
+  8033bf:	83 ec 10             	sub    $0x10,%esp
+  8033c2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033cb:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8033ce:	85 c0                	test   %eax,%eax
+  8033d0:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8033d5:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8033d8:	6a 00                	push   $0x0
+  8033da:	ff 33                	push   (%ebx)
+  8033dc:	50                   	push   %eax
+  8033dd:	e8 b6 cf ff ff       	call   800398 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8033e2:	83 c4 10             	add    $0x10,%esp
+  8033e5:	85 c0                	test   %eax,%eax
+  8033e7:	75 3c                	jne    803425 <ipc_recvv+0x6c>
+  8033e9:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8033ef:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8033f2:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8033f4:	85 ff                	test   %edi,%edi
+  8033f6:	74 4e                	je     803446 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8033f8:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8033fe:	8b 52 74             	mov    0x74(%edx),%edx
+  803401:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803403:	85 f6                	test   %esi,%esi
+  803405:	74 18                	je     80341f <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803407:	85 c0                	test   %eax,%eax
+  803409:	75 2d                	jne    803438 <ipc_recvv+0x7f>
+  80340b:	a1 00 50 80 00       	mov    0x805000,%eax
+  803410:	8b 40 78             	mov    0x78(%eax),%eax
+  803413:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803415:	a1 00 50 80 00       	mov    0x805000,%eax
+  80341a:	8b 40 70             	mov    0x70(%eax),%eax
+  80341d:	eb 1f                	jmp    80343e <ipc_recvv+0x85>
+  80341f:	85 c0                	test   %eax,%eax
+  803421:	75 1b                	jne    80343e <ipc_recvv+0x85>
+  803423:	eb f0                	jmp    803415 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803425:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80342b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803430:	85 ff                	test   %edi,%edi
+  803432:	75 cd                	jne    803401 <ipc_recvv+0x48>
+	if (perm_store)
+  803434:	85 f6                	test   %esi,%esi
+  803436:	74 e7                	je     80341f <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803438:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80343e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803441:	5b                   	pop    %ebx
+  803442:	5e                   	pop    %esi
+  803443:	5f                   	pop    %edi
+  803444:	5d                   	pop    %ebp
+  803445:	c3                   	ret
+	if (perm_store)
+  803446:	85 f6                	test   %esi,%esi
+  803448:	75 bd                	jne    803407 <ipc_recvv+0x4e>
+  80344a:	eb c9                	jmp    803415 <ipc_recvv+0x5c>
+
+0080344c <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  80344c:	55                   	push   %ebp
+  80344d:	89 e5                	mov    %esp,%ebp
+  80344f:	57                   	push   %edi
+  803450:	56                   	push   %esi
+  803451:	53                   	push   %ebx
+  803452:	83 ec 0c             	sub    $0xc,%esp
+  803455:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803458:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80345b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  80345e:	ff 75 14             	push   0x14(%ebp)
+  803461:	53                   	push   %ebx
+  803462:	56                   	push   %esi
+  803463:	57                   	push   %edi
+  803464:	e8 07 cf ff ff       	call   800370 <sys_ipc_try_sendv>
+  803469:	83 c4 10             	add    $0x10,%esp
+  80346c:	85 c0                	test   %eax,%eax
+  80346e:	74 22                	je     803492 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803470:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803473:	75 07                	jne    80347c <ipc_sendv+0x30>
+		sys_yield();
+  803475:	e8 fa cc ff ff       	call   800174 <sys_yield>
+  80347a:	eb e2                	jmp    80345e <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80347c:	68 69 3d 80 00       	push   $0x803d69
+  803481:	68 44 38 80 00       	push   $0x803844
+  803486:	6a 5c                	push   $0x5c
+  803488:	68 7e 3d 80 00       	push   $0x803d7e
+  80348d:	e8 e3 f0 ff ff       	call   802575 <_panic>
+	}
+}
+  803492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803495:	5b                   	pop    %ebx
+  803496:	5e                   	pop    %esi
+  803497:	5f                   	pop    %edi
+  803498:	5d                   	pop    %ebp
+  803499:	c3                   	ret
+
+0080349a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80349a:	55                   	push   %ebp
+  80349b:	89 e5                	mov    %esp,%ebp
+  80349d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8034a0:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8034a5:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8034ab:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8034b1:	8b 52 50             	mov    0x50(%edx),%edx
+  8034b4:	39 ca                	cmp    %ecx,%edx
+  8034b6:	74 11                	je     8034c9 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8034b8:	83 c0 01             	add    $0x1,%eax
+  8034bb:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8034c0:	75 e3                	jne    8034a5 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8034c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034c7:	eb 0e                	jmp    8034d7 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8034c9:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8034cf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8034d4:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8034d7:	5d                   	pop    %ebp
+  8034d8:	c3                   	ret
+
+008034d9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8034d9:	55                   	push   %ebp
+  8034da:	89 e5                	mov    %esp,%ebp
+  8034dc:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8034df:	89 c2                	mov    %eax,%edx
+  8034e1:	c1 ea 16             	shr    $0x16,%edx
+  8034e4:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8034eb:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8034f0:	f6 c1 01             	test   $0x1,%cl
+  8034f3:	74 22                	je     803517 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8034f5:	c1 e8 0c             	shr    $0xc,%eax
+  8034f8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8034ff:	a8 01                	test   $0x1,%al
+  803501:	74 14                	je     803517 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803503:	c1 e8 0c             	shr    $0xc,%eax
+  803506:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803509:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803510:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803514:	0f b7 d2             	movzwl %dx,%edx
+}
+  803517:	89 d0                	mov    %edx,%eax
+  803519:	5d                   	pop    %ebp
+  80351a:	c3                   	ret
+
+0080351b <dm>:
+  80351b:	55                   	push   %ebp
+  80351c:	57                   	push   %edi
+  80351d:	56                   	push   %esi
+  80351e:	53                   	push   %ebx
+  80351f:	83 ec 24             	sub    $0x24,%esp
+  803522:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803526:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80352a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80352e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803532:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803536:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80353a:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80353e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803543:	b8 00 00 00 00       	mov    $0x0,%eax
+  803548:	ba 00 00 00 00       	mov    $0x0,%edx
+  80354d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803554:	00 
+  803555:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80355c:	00 
+  80355d:	89 fb                	mov    %edi,%ebx
+  80355f:	eb 08                	jmp    803569 <dm+0x4e>
+  803561:	83 e9 01             	sub    $0x1,%ecx
+  803564:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803567:	74 68                	je     8035d1 <dm+0xb6>
+  803569:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80356d:	01 c0                	add    %eax,%eax
+  80356f:	89 c6                	mov    %eax,%esi
+  803571:	89 d7                	mov    %edx,%edi
+  803573:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803577:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80357b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80357e:	d3 ea                	shr    %cl,%edx
+  803580:	f6 c1 20             	test   $0x20,%cl
+  803583:	74 04                	je     803589 <dm+0x6e>
+  803585:	89 d0                	mov    %edx,%eax
+  803587:	31 d2                	xor    %edx,%edx
+  803589:	83 e0 01             	and    $0x1,%eax
+  80358c:	89 04 24             	mov    %eax,(%esp)
+  80358f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803596:	00 
+  803597:	8b 04 24             	mov    (%esp),%eax
+  80359a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80359e:	09 f0                	or     %esi,%eax
+  8035a0:	09 fa                	or     %edi,%edx
+  8035a2:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8035a6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8035aa:	39 f0                	cmp    %esi,%eax
+  8035ac:	89 d5                	mov    %edx,%ebp
+  8035ae:	19 fd                	sbb    %edi,%ebp
+  8035b0:	72 af                	jb     803561 <dm+0x46>
+  8035b2:	29 f0                	sub    %esi,%eax
+  8035b4:	19 fa                	sbb    %edi,%edx
+  8035b6:	89 cf                	mov    %ecx,%edi
+  8035b8:	c1 ef 05             	shr    $0x5,%edi
+  8035bb:	83 e7 01             	and    $0x1,%edi
+  8035be:	89 fe                	mov    %edi,%esi
+  8035c0:	83 f6 01             	xor    $0x1,%esi
+  8035c3:	d3 e6                	shl    %cl,%esi
+  8035c5:	d3 e7                	shl    %cl,%edi
+  8035c7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8035cb:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8035cf:	eb 90                	jmp    803561 <dm+0x46>
+  8035d1:	85 db                	test   %ebx,%ebx
+  8035d3:	74 05                	je     8035da <dm+0xbf>
+  8035d5:	89 03                	mov    %eax,(%ebx)
+  8035d7:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035da:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035de:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035e2:	83 c4 24             	add    $0x24,%esp
+  8035e5:	5b                   	pop    %ebx
+  8035e6:	5e                   	pop    %esi
+  8035e7:	5f                   	pop    %edi
+  8035e8:	5d                   	pop    %ebp
+  8035e9:	c3                   	ret
+
+008035ea <__udivdi3>:
+  8035ea:	83 ec 08             	sub    $0x8,%esp
+  8035ed:	6a 00                	push   $0x0
+  8035ef:	ff 74 24 1c          	push   0x1c(%esp)
+  8035f3:	ff 74 24 1c          	push   0x1c(%esp)
+  8035f7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035fb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035ff:	e8 17 ff ff ff       	call   80351b <dm>
+  803604:	83 c4 14             	add    $0x14,%esp
+  803607:	c3                   	ret
+
+00803608 <__umoddi3>:
+  803608:	83 ec 18             	sub    $0x18,%esp
+  80360b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80360f:	50                   	push   %eax
+  803610:	ff 74 24 2c          	push   0x2c(%esp)
+  803614:	ff 74 24 2c          	push   0x2c(%esp)
+  803618:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80361c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803620:	e8 f6 fe ff ff       	call   80351b <dm>
+  803625:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803629:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80362d:	83 c4 24             	add    $0x24,%esp
+  803630:	c3                   	ret
+
+00803631 <__divdi3>:
+  803631:	53                   	push   %ebx
+  803632:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803636:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80363a:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80363e:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803642:	85 d2                	test   %edx,%edx
+  803644:	78 15                	js     80365b <__divdi3+0x2a>
+  803646:	85 db                	test   %ebx,%ebx
+  803648:	78 34                	js     80367e <__divdi3+0x4d>
+  80364a:	83 ec 04             	sub    $0x4,%esp
+  80364d:	6a 00                	push   $0x0
+  80364f:	53                   	push   %ebx
+  803650:	51                   	push   %ecx
+  803651:	e8 c5 fe ff ff       	call   80351b <dm>
+  803656:	83 c4 10             	add    $0x10,%esp
+  803659:	eb 21                	jmp    80367c <__divdi3+0x4b>
+  80365b:	f7 d8                	neg    %eax
+  80365d:	83 d2 00             	adc    $0x0,%edx
+  803660:	f7 da                	neg    %edx
+  803662:	85 db                	test   %ebx,%ebx
+  803664:	78 30                	js     803696 <__divdi3+0x65>
+  803666:	83 ec 04             	sub    $0x4,%esp
+  803669:	6a 00                	push   $0x0
+  80366b:	53                   	push   %ebx
+  80366c:	51                   	push   %ecx
+  80366d:	e8 a9 fe ff ff       	call   80351b <dm>
+  803672:	83 c4 10             	add    $0x10,%esp
+  803675:	f7 d8                	neg    %eax
+  803677:	83 d2 00             	adc    $0x0,%edx
+  80367a:	f7 da                	neg    %edx
+  80367c:	5b                   	pop    %ebx
+  80367d:	c3                   	ret
+  80367e:	83 ec 04             	sub    $0x4,%esp
+  803681:	6a 00                	push   $0x0
+  803683:	f7 d9                	neg    %ecx
+  803685:	83 d3 00             	adc    $0x0,%ebx
+  803688:	f7 db                	neg    %ebx
+  80368a:	53                   	push   %ebx
+  80368b:	51                   	push   %ecx
+  80368c:	e8 8a fe ff ff       	call   80351b <dm>
+  803691:	83 c4 10             	add    $0x10,%esp
+  803694:	eb df                	jmp    803675 <__divdi3+0x44>
+  803696:	83 ec 04             	sub    $0x4,%esp
+  803699:	6a 00                	push   $0x0
+  80369b:	f7 d9                	neg    %ecx
+  80369d:	83 d3 00             	adc    $0x0,%ebx
+  8036a0:	f7 db                	neg    %ebx
+  8036a2:	53                   	push   %ebx
+  8036a3:	51                   	push   %ecx
+  8036a4:	e8 72 fe ff ff       	call   80351b <dm>
+  8036a9:	83 c4 10             	add    $0x10,%esp
+  8036ac:	eb ce                	jmp    80367c <__divdi3+0x4b>
+
+008036ae <__moddi3>:
+  8036ae:	55                   	push   %ebp
+  8036af:	57                   	push   %edi
+  8036b0:	56                   	push   %esi
+  8036b1:	53                   	push   %ebx
+  8036b2:	83 ec 24             	sub    $0x24,%esp
+  8036b5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036b9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036bd:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036c1:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036c5:	85 d2                	test   %edx,%edx
+  8036c7:	78 3b                	js     803704 <__moddi3+0x56>
+  8036c9:	83 ec 04             	sub    $0x4,%esp
+  8036cc:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036d0:	56                   	push   %esi
+  8036d1:	89 ce                	mov    %ecx,%esi
+  8036d3:	f7 de                	neg    %esi
+  8036d5:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8036d9:	89 de                	mov    %ebx,%esi
+  8036db:	83 d6 00             	adc    $0x0,%esi
+  8036de:	f7 de                	neg    %esi
+  8036e0:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8036e4:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8036e8:	0f 48 f1             	cmovs  %ecx,%esi
+  8036eb:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8036f0:	53                   	push   %ebx
+  8036f1:	56                   	push   %esi
+  8036f2:	e8 24 fe ff ff       	call   80351b <dm>
+  8036f7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036fb:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036ff:	83 c4 10             	add    $0x10,%esp
+  803702:	eb 47                	jmp    80374b <__moddi3+0x9d>
+  803704:	f7 d8                	neg    %eax
+  803706:	83 d2 00             	adc    $0x0,%edx
+  803709:	f7 da                	neg    %edx
+  80370b:	83 ec 04             	sub    $0x4,%esp
+  80370e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803712:	56                   	push   %esi
+  803713:	89 cf                	mov    %ecx,%edi
+  803715:	f7 df                	neg    %edi
+  803717:	89 de                	mov    %ebx,%esi
+  803719:	83 d6 00             	adc    $0x0,%esi
+  80371c:	f7 de                	neg    %esi
+  80371e:	0f 49 cf             	cmovns %edi,%ecx
+  803721:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803725:	0f 49 de             	cmovns %esi,%ebx
+  803728:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80372c:	ff 74 24 0c          	push   0xc(%esp)
+  803730:	ff 74 24 0c          	push   0xc(%esp)
+  803734:	e8 e2 fd ff ff       	call   80351b <dm>
+  803739:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80373d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803741:	f7 d8                	neg    %eax
+  803743:	83 d2 00             	adc    $0x0,%edx
+  803746:	f7 da                	neg    %edx
+  803748:	83 c4 10             	add    $0x10,%esp
+  80374b:	83 c4 24             	add    $0x24,%esp
+  80374e:	5b                   	pop    %ebx
+  80374f:	5e                   	pop    %esi
+  803750:	5f                   	pop    %edi
+  803751:	5d                   	pop    %ebp
+  803752:	c3                   	ret
@@ -0,0 +1,7628 @@
+
+obj/user/faultreadkernel.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("I read %08x from location 0xf0100000!\n", *(unsigned*)0xf0100000);
+  800039:	ff 35 00 00 10 f0    	push   0xf0100000
+  80003f:	68 60 37 80 00       	push   $0x803760
+  800044:	e8 fd 00 00 00       	call   800146 <cprintf>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800059:	e8 9c 0a 00 00       	call   800afa <sys_getenvid>
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800069:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006e:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800073:	85 db                	test   %ebx,%ebx
+  800075:	7e 07                	jle    80007e <libmain+0x30>
+		binaryname = argv[0];
+  800077:	8b 06                	mov    (%esi),%eax
+  800079:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80007e:	83 ec 08             	sub    $0x8,%esp
+  800081:	56                   	push   %esi
+  800082:	53                   	push   %ebx
+  800083:	e8 ab ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800088:	e8 0a 00 00 00       	call   800097 <exit>
+}
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800093:	5b                   	pop    %ebx
+  800094:	5e                   	pop    %esi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+
+00800097 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800097:	55                   	push   %ebp
+  800098:	89 e5                	mov    %esp,%ebp
+  80009a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80009d:	e8 73 10 00 00       	call   801115 <close_all>
+	sys_env_destroy(0);
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	6a 00                	push   $0x0
+  8000a7:	e8 05 0a 00 00       	call   800ab1 <sys_env_destroy>
+}
+  8000ac:	83 c4 10             	add    $0x10,%esp
+  8000af:	c9                   	leave
+  8000b0:	c3                   	ret
+
+008000b1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000b1:	55                   	push   %ebp
+  8000b2:	89 e5                	mov    %esp,%ebp
+  8000b4:	53                   	push   %ebx
+  8000b5:	83 ec 04             	sub    $0x4,%esp
+  8000b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000bb:	8b 13                	mov    (%ebx),%edx
+  8000bd:	8d 42 01             	lea    0x1(%edx),%eax
+  8000c0:	89 03                	mov    %eax,(%ebx)
+  8000c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000c5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000c9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000ce:	74 09                	je     8000d9 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000d0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000d7:	c9                   	leave
+  8000d8:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000d9:	83 ec 08             	sub    $0x8,%esp
+  8000dc:	68 ff 00 00 00       	push   $0xff
+  8000e1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000e4:	50                   	push   %eax
+  8000e5:	e8 7a 09 00 00       	call   800a64 <sys_cputs>
+		b->idx = 0;
+  8000ea:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000f0:	83 c4 10             	add    $0x10,%esp
+  8000f3:	eb db                	jmp    8000d0 <putch+0x1f>
+
+008000f5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000f5:	55                   	push   %ebp
+  8000f6:	89 e5                	mov    %esp,%ebp
+  8000f8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8000fe:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800105:	00 00 00 
+	b.cnt = 0;
+  800108:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80010f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800112:	ff 75 0c             	push   0xc(%ebp)
+  800115:	ff 75 08             	push   0x8(%ebp)
+  800118:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80011e:	50                   	push   %eax
+  80011f:	68 b1 00 80 00       	push   $0x8000b1
+  800124:	e8 14 01 00 00       	call   80023d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800129:	83 c4 08             	add    $0x8,%esp
+  80012c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800132:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800138:	50                   	push   %eax
+  800139:	e8 26 09 00 00       	call   800a64 <sys_cputs>
+
+	return b.cnt;
+}
+  80013e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800144:	c9                   	leave
+  800145:	c3                   	ret
+
+00800146 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800146:	55                   	push   %ebp
+  800147:	89 e5                	mov    %esp,%ebp
+  800149:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80014c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80014f:	50                   	push   %eax
+  800150:	ff 75 08             	push   0x8(%ebp)
+  800153:	e8 9d ff ff ff       	call   8000f5 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800158:	c9                   	leave
+  800159:	c3                   	ret
+
+0080015a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80015a:	55                   	push   %ebp
+  80015b:	89 e5                	mov    %esp,%ebp
+  80015d:	57                   	push   %edi
+  80015e:	56                   	push   %esi
+  80015f:	53                   	push   %ebx
+  800160:	83 ec 1c             	sub    $0x1c,%esp
+  800163:	89 c7                	mov    %eax,%edi
+  800165:	89 d6                	mov    %edx,%esi
+  800167:	8b 45 08             	mov    0x8(%ebp),%eax
+  80016a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80016d:	89 d1                	mov    %edx,%ecx
+  80016f:	89 c2                	mov    %eax,%edx
+  800171:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800174:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800177:	8b 45 10             	mov    0x10(%ebp),%eax
+  80017a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80017d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800180:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800187:	39 c2                	cmp    %eax,%edx
+  800189:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80018c:	72 3e                	jb     8001cc <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80018e:	83 ec 0c             	sub    $0xc,%esp
+  800191:	ff 75 18             	push   0x18(%ebp)
+  800194:	83 eb 01             	sub    $0x1,%ebx
+  800197:	53                   	push   %ebx
+  800198:	50                   	push   %eax
+  800199:	83 ec 08             	sub    $0x8,%esp
+  80019c:	ff 75 e4             	push   -0x1c(%ebp)
+  80019f:	ff 75 e0             	push   -0x20(%ebp)
+  8001a2:	ff 75 dc             	push   -0x24(%ebp)
+  8001a5:	ff 75 d8             	push   -0x28(%ebp)
+  8001a8:	e8 37 34 00 00       	call   8035e4 <__udivdi3>
+  8001ad:	83 c4 18             	add    $0x18,%esp
+  8001b0:	52                   	push   %edx
+  8001b1:	50                   	push   %eax
+  8001b2:	89 f2                	mov    %esi,%edx
+  8001b4:	89 f8                	mov    %edi,%eax
+  8001b6:	e8 9f ff ff ff       	call   80015a <printnum>
+  8001bb:	83 c4 20             	add    $0x20,%esp
+  8001be:	eb 13                	jmp    8001d3 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001c0:	83 ec 08             	sub    $0x8,%esp
+  8001c3:	56                   	push   %esi
+  8001c4:	ff 75 18             	push   0x18(%ebp)
+  8001c7:	ff d7                	call   *%edi
+  8001c9:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001cc:	83 eb 01             	sub    $0x1,%ebx
+  8001cf:	85 db                	test   %ebx,%ebx
+  8001d1:	7f ed                	jg     8001c0 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001d3:	83 ec 08             	sub    $0x8,%esp
+  8001d6:	56                   	push   %esi
+  8001d7:	83 ec 04             	sub    $0x4,%esp
+  8001da:	ff 75 e4             	push   -0x1c(%ebp)
+  8001dd:	ff 75 e0             	push   -0x20(%ebp)
+  8001e0:	ff 75 dc             	push   -0x24(%ebp)
+  8001e3:	ff 75 d8             	push   -0x28(%ebp)
+  8001e6:	e8 17 34 00 00       	call   803602 <__umoddi3>
+  8001eb:	83 c4 14             	add    $0x14,%esp
+  8001ee:	0f be 80 91 37 80 00 	movsbl 0x803791(%eax),%eax
+  8001f5:	50                   	push   %eax
+  8001f6:	ff d7                	call   *%edi
+}
+  8001f8:	83 c4 10             	add    $0x10,%esp
+  8001fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fe:	5b                   	pop    %ebx
+  8001ff:	5e                   	pop    %esi
+  800200:	5f                   	pop    %edi
+  800201:	5d                   	pop    %ebp
+  800202:	c3                   	ret
+
+00800203 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800203:	55                   	push   %ebp
+  800204:	89 e5                	mov    %esp,%ebp
+  800206:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800209:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80020d:	8b 10                	mov    (%eax),%edx
+  80020f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800212:	73 0a                	jae    80021e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800214:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800217:	89 08                	mov    %ecx,(%eax)
+  800219:	8b 45 08             	mov    0x8(%ebp),%eax
+  80021c:	88 02                	mov    %al,(%edx)
+}
+  80021e:	5d                   	pop    %ebp
+  80021f:	c3                   	ret
+
+00800220 <printfmt>:
+{
+  800220:	55                   	push   %ebp
+  800221:	89 e5                	mov    %esp,%ebp
+  800223:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800226:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800229:	50                   	push   %eax
+  80022a:	ff 75 10             	push   0x10(%ebp)
+  80022d:	ff 75 0c             	push   0xc(%ebp)
+  800230:	ff 75 08             	push   0x8(%ebp)
+  800233:	e8 05 00 00 00       	call   80023d <vprintfmt>
+}
+  800238:	83 c4 10             	add    $0x10,%esp
+  80023b:	c9                   	leave
+  80023c:	c3                   	ret
+
+0080023d <vprintfmt>:
+{
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	57                   	push   %edi
+  800241:	56                   	push   %esi
+  800242:	53                   	push   %ebx
+  800243:	83 ec 2c             	sub    $0x2c,%esp
+  800246:	8b 75 08             	mov    0x8(%ebp),%esi
+  800249:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80024c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80024f:	eb 0a                	jmp    80025b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800251:	83 ec 08             	sub    $0x8,%esp
+  800254:	53                   	push   %ebx
+  800255:	50                   	push   %eax
+  800256:	ff d6                	call   *%esi
+  800258:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80025b:	83 c7 01             	add    $0x1,%edi
+  80025e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800262:	83 f8 25             	cmp    $0x25,%eax
+  800265:	74 0c                	je     800273 <vprintfmt+0x36>
+			if (ch == '\0')
+  800267:	85 c0                	test   %eax,%eax
+  800269:	75 e6                	jne    800251 <vprintfmt+0x14>
+}
+  80026b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80026e:	5b                   	pop    %ebx
+  80026f:	5e                   	pop    %esi
+  800270:	5f                   	pop    %edi
+  800271:	5d                   	pop    %ebp
+  800272:	c3                   	ret
+		padc = ' ';
+  800273:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800277:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80027e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800285:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80028c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800291:	8d 47 01             	lea    0x1(%edi),%eax
+  800294:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800297:	0f b6 17             	movzbl (%edi),%edx
+  80029a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80029d:	3c 55                	cmp    $0x55,%al
+  80029f:	0f 87 cf 03 00 00    	ja     800674 <vprintfmt+0x437>
+  8002a5:	0f b6 c0             	movzbl %al,%eax
+  8002a8:	ff 24 85 00 39 80 00 	jmp    *0x803900(,%eax,4)
+  8002af:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002b2:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002b6:	eb d9                	jmp    800291 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002b8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002bb:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002bf:	eb d0                	jmp    800291 <vprintfmt+0x54>
+  8002c1:	0f b6 d2             	movzbl %dl,%edx
+  8002c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002cf:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002d2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002d6:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002d9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002dc:	83 f9 09             	cmp    $0x9,%ecx
+  8002df:	77 55                	ja     800336 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002e1:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002e4:	eb e9                	jmp    8002cf <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002e9:	8b 00                	mov    (%eax),%eax
+  8002eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8002f4:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8002f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8002fa:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8002fe:	79 91                	jns    800291 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800300:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800303:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800306:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80030d:	eb 82                	jmp    800291 <vprintfmt+0x54>
+			if (width < 0)
+  80030f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800312:	85 d2                	test   %edx,%edx
+  800314:	b8 00 00 00 00       	mov    $0x0,%eax
+  800319:	0f 49 c2             	cmovns %edx,%eax
+  80031c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80031f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800322:	e9 6a ff ff ff       	jmp    800291 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800327:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80032a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800331:	e9 5b ff ff ff       	jmp    800291 <vprintfmt+0x54>
+  800336:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800339:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80033c:	eb bc                	jmp    8002fa <vprintfmt+0xbd>
+			lflag++;
+  80033e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800341:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800344:	e9 48 ff ff ff       	jmp    800291 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800349:	8b 45 14             	mov    0x14(%ebp),%eax
+  80034c:	8d 78 04             	lea    0x4(%eax),%edi
+  80034f:	83 ec 08             	sub    $0x8,%esp
+  800352:	53                   	push   %ebx
+  800353:	ff 30                	push   (%eax)
+  800355:	ff d6                	call   *%esi
+			break;
+  800357:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80035a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80035d:	e9 b1 02 00 00       	jmp    800613 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800362:	8b 45 14             	mov    0x14(%ebp),%eax
+  800365:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800368:	8b 10                	mov    (%eax),%edx
+  80036a:	89 d0                	mov    %edx,%eax
+  80036c:	f7 d8                	neg    %eax
+  80036e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800371:	83 f8 11             	cmp    $0x11,%eax
+  800374:	7f 23                	jg     800399 <vprintfmt+0x15c>
+  800376:	8b 14 85 60 3a 80 00 	mov    0x803a60(,%eax,4),%edx
+  80037d:	85 d2                	test   %edx,%edx
+  80037f:	74 18                	je     800399 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800381:	52                   	push   %edx
+  800382:	68 b2 3b 80 00       	push   $0x803bb2
+  800387:	53                   	push   %ebx
+  800388:	56                   	push   %esi
+  800389:	e8 92 fe ff ff       	call   800220 <printfmt>
+  80038e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800391:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800394:	e9 7a 02 00 00       	jmp    800613 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800399:	50                   	push   %eax
+  80039a:	68 a9 37 80 00       	push   $0x8037a9
+  80039f:	53                   	push   %ebx
+  8003a0:	56                   	push   %esi
+  8003a1:	e8 7a fe ff ff       	call   800220 <printfmt>
+  8003a6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003a9:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003ac:	e9 62 02 00 00       	jmp    800613 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b4:	83 c0 04             	add    $0x4,%eax
+  8003b7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bd:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003bf:	85 c9                	test   %ecx,%ecx
+  8003c1:	b8 a2 37 80 00       	mov    $0x8037a2,%eax
+  8003c6:	0f 45 c1             	cmovne %ecx,%eax
+  8003c9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003cc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d0:	7e 06                	jle    8003d8 <vprintfmt+0x19b>
+  8003d2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003d6:	75 0b                	jne    8003e3 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003d8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003db:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003de:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003e1:	eb 5c                	jmp    80043f <vprintfmt+0x202>
+  8003e3:	83 ec 08             	sub    $0x8,%esp
+  8003e6:	ff 75 d0             	push   -0x30(%ebp)
+  8003e9:	ff 75 cc             	push   -0x34(%ebp)
+  8003ec:	e8 20 03 00 00       	call   800711 <strnlen>
+  8003f1:	89 c2                	mov    %eax,%edx
+  8003f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003f6:	29 d0                	sub    %edx,%eax
+  8003f8:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8003fb:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8003ff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800402:	89 75 08             	mov    %esi,0x8(%ebp)
+  800405:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800407:	eb 0e                	jmp    800417 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800409:	83 ec 08             	sub    $0x8,%esp
+  80040c:	53                   	push   %ebx
+  80040d:	57                   	push   %edi
+  80040e:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800411:	83 ee 01             	sub    $0x1,%esi
+  800414:	83 c4 10             	add    $0x10,%esp
+  800417:	85 f6                	test   %esi,%esi
+  800419:	7f ee                	jg     800409 <vprintfmt+0x1cc>
+  80041b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80041e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800421:	85 c0                	test   %eax,%eax
+  800423:	ba 00 00 00 00       	mov    $0x0,%edx
+  800428:	0f 49 d0             	cmovns %eax,%edx
+  80042b:	29 d0                	sub    %edx,%eax
+  80042d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800430:	eb a6                	jmp    8003d8 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800432:	83 ec 08             	sub    $0x8,%esp
+  800435:	53                   	push   %ebx
+  800436:	52                   	push   %edx
+  800437:	ff 55 08             	call   *0x8(%ebp)
+  80043a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80043d:	89 f1                	mov    %esi,%ecx
+  80043f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800442:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800446:	0f be d0             	movsbl %al,%edx
+  800449:	85 d2                	test   %edx,%edx
+  80044b:	74 28                	je     800475 <vprintfmt+0x238>
+  80044d:	85 ff                	test   %edi,%edi
+  80044f:	78 05                	js     800456 <vprintfmt+0x219>
+  800451:	83 ef 01             	sub    $0x1,%edi
+  800454:	78 30                	js     800486 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800456:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80045a:	74 d6                	je     800432 <vprintfmt+0x1f5>
+  80045c:	0f be c0             	movsbl %al,%eax
+  80045f:	83 e8 20             	sub    $0x20,%eax
+  800462:	83 f8 5e             	cmp    $0x5e,%eax
+  800465:	76 cb                	jbe    800432 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800467:	83 ec 08             	sub    $0x8,%esp
+  80046a:	53                   	push   %ebx
+  80046b:	6a 3f                	push   $0x3f
+  80046d:	ff 55 08             	call   *0x8(%ebp)
+  800470:	83 c4 10             	add    $0x10,%esp
+  800473:	eb c8                	jmp    80043d <vprintfmt+0x200>
+  800475:	8b 75 08             	mov    0x8(%ebp),%esi
+  800478:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80047b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80047e:	01 d0                	add    %edx,%eax
+  800480:	29 c8                	sub    %ecx,%eax
+  800482:	89 c7                	mov    %eax,%edi
+  800484:	eb 13                	jmp    800499 <vprintfmt+0x25c>
+  800486:	8b 75 08             	mov    0x8(%ebp),%esi
+  800489:	eb ed                	jmp    800478 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80048b:	83 ec 08             	sub    $0x8,%esp
+  80048e:	53                   	push   %ebx
+  80048f:	6a 20                	push   $0x20
+  800491:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800493:	83 ef 01             	sub    $0x1,%edi
+  800496:	83 c4 10             	add    $0x10,%esp
+  800499:	85 ff                	test   %edi,%edi
+  80049b:	7f ee                	jg     80048b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80049d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004a3:	e9 6b 01 00 00       	jmp    800613 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004a8:	83 f9 01             	cmp    $0x1,%ecx
+  8004ab:	7f 1f                	jg     8004cc <vprintfmt+0x28f>
+	else if (lflag)
+  8004ad:	85 c9                	test   %ecx,%ecx
+  8004af:	74 67                	je     800518 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b4:	8b 00                	mov    (%eax),%eax
+  8004b6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004b9:	89 c1                	mov    %eax,%ecx
+  8004bb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004be:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8004c7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004ca:	eb 17                	jmp    8004e3 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cf:	8b 50 04             	mov    0x4(%eax),%edx
+  8004d2:	8b 00                	mov    (%eax),%eax
+  8004d4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004d7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dd:	8d 40 08             	lea    0x8(%eax),%eax
+  8004e0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004e3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004e6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004e9:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004ee:	85 c9                	test   %ecx,%ecx
+  8004f0:	0f 89 03 01 00 00    	jns    8005f9 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8004f6:	83 ec 08             	sub    $0x8,%esp
+  8004f9:	53                   	push   %ebx
+  8004fa:	6a 2d                	push   $0x2d
+  8004fc:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8004fe:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800501:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800504:	f7 da                	neg    %edx
+  800506:	83 d1 00             	adc    $0x0,%ecx
+  800509:	f7 d9                	neg    %ecx
+  80050b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80050e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800513:	e9 e1 00 00 00       	jmp    8005f9 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051b:	8b 00                	mov    (%eax),%eax
+  80051d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800520:	89 c1                	mov    %eax,%ecx
+  800522:	c1 f9 1f             	sar    $0x1f,%ecx
+  800525:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8d 40 04             	lea    0x4(%eax),%eax
+  80052e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800531:	eb b0                	jmp    8004e3 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800533:	83 f9 01             	cmp    $0x1,%ecx
+  800536:	7f 1e                	jg     800556 <vprintfmt+0x319>
+	else if (lflag)
+  800538:	85 c9                	test   %ecx,%ecx
+  80053a:	74 32                	je     80056e <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80053c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053f:	8b 10                	mov    (%eax),%edx
+  800541:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800546:	8d 40 04             	lea    0x4(%eax),%eax
+  800549:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80054c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800551:	e9 a3 00 00 00       	jmp    8005f9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800556:	8b 45 14             	mov    0x14(%ebp),%eax
+  800559:	8b 10                	mov    (%eax),%edx
+  80055b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80055e:	8d 40 08             	lea    0x8(%eax),%eax
+  800561:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800564:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800569:	e9 8b 00 00 00       	jmp    8005f9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80056e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800571:	8b 10                	mov    (%eax),%edx
+  800573:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800578:	8d 40 04             	lea    0x4(%eax),%eax
+  80057b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80057e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800583:	eb 74                	jmp    8005f9 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800585:	83 f9 01             	cmp    $0x1,%ecx
+  800588:	7f 1b                	jg     8005a5 <vprintfmt+0x368>
+	else if (lflag)
+  80058a:	85 c9                	test   %ecx,%ecx
+  80058c:	74 2c                	je     8005ba <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80058e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800591:	8b 10                	mov    (%eax),%edx
+  800593:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800598:	8d 40 04             	lea    0x4(%eax),%eax
+  80059b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80059e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005a3:	eb 54                	jmp    8005f9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a8:	8b 10                	mov    (%eax),%edx
+  8005aa:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005ad:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005b3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005b8:	eb 3f                	jmp    8005f9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	8b 10                	mov    (%eax),%edx
+  8005bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005ca:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8005cf:	eb 28                	jmp    8005f9 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8005d1:	83 ec 08             	sub    $0x8,%esp
+  8005d4:	53                   	push   %ebx
+  8005d5:	6a 30                	push   $0x30
+  8005d7:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005d9:	83 c4 08             	add    $0x8,%esp
+  8005dc:	53                   	push   %ebx
+  8005dd:	6a 78                	push   $0x78
+  8005df:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e4:	8b 10                	mov    (%eax),%edx
+  8005e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005eb:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8005f4:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005f9:	83 ec 0c             	sub    $0xc,%esp
+  8005fc:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800600:	50                   	push   %eax
+  800601:	ff 75 e0             	push   -0x20(%ebp)
+  800604:	57                   	push   %edi
+  800605:	51                   	push   %ecx
+  800606:	52                   	push   %edx
+  800607:	89 da                	mov    %ebx,%edx
+  800609:	89 f0                	mov    %esi,%eax
+  80060b:	e8 4a fb ff ff       	call   80015a <printnum>
+			break;
+  800610:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800613:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800616:	e9 40 fc ff ff       	jmp    80025b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80061b:	83 f9 01             	cmp    $0x1,%ecx
+  80061e:	7f 1b                	jg     80063b <vprintfmt+0x3fe>
+	else if (lflag)
+  800620:	85 c9                	test   %ecx,%ecx
+  800622:	74 2c                	je     800650 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800624:	8b 45 14             	mov    0x14(%ebp),%eax
+  800627:	8b 10                	mov    (%eax),%edx
+  800629:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062e:	8d 40 04             	lea    0x4(%eax),%eax
+  800631:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800634:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800639:	eb be                	jmp    8005f9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80063b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063e:	8b 10                	mov    (%eax),%edx
+  800640:	8b 48 04             	mov    0x4(%eax),%ecx
+  800643:	8d 40 08             	lea    0x8(%eax),%eax
+  800646:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800649:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80064e:	eb a9                	jmp    8005f9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800650:	8b 45 14             	mov    0x14(%ebp),%eax
+  800653:	8b 10                	mov    (%eax),%edx
+  800655:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065a:	8d 40 04             	lea    0x4(%eax),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800660:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800665:	eb 92                	jmp    8005f9 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800667:	83 ec 08             	sub    $0x8,%esp
+  80066a:	53                   	push   %ebx
+  80066b:	6a 25                	push   $0x25
+  80066d:	ff d6                	call   *%esi
+			break;
+  80066f:	83 c4 10             	add    $0x10,%esp
+  800672:	eb 9f                	jmp    800613 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800674:	83 ec 08             	sub    $0x8,%esp
+  800677:	53                   	push   %ebx
+  800678:	6a 25                	push   $0x25
+  80067a:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80067c:	83 c4 10             	add    $0x10,%esp
+  80067f:	89 f8                	mov    %edi,%eax
+  800681:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800685:	74 05                	je     80068c <vprintfmt+0x44f>
+  800687:	83 e8 01             	sub    $0x1,%eax
+  80068a:	eb f5                	jmp    800681 <vprintfmt+0x444>
+  80068c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80068f:	eb 82                	jmp    800613 <vprintfmt+0x3d6>
+
+00800691 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800691:	55                   	push   %ebp
+  800692:	89 e5                	mov    %esp,%ebp
+  800694:	83 ec 18             	sub    $0x18,%esp
+  800697:	8b 45 08             	mov    0x8(%ebp),%eax
+  80069a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80069d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006a0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006a4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006ae:	85 c0                	test   %eax,%eax
+  8006b0:	74 26                	je     8006d8 <vsnprintf+0x47>
+  8006b2:	85 d2                	test   %edx,%edx
+  8006b4:	7e 22                	jle    8006d8 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006b6:	ff 75 14             	push   0x14(%ebp)
+  8006b9:	ff 75 10             	push   0x10(%ebp)
+  8006bc:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006bf:	50                   	push   %eax
+  8006c0:	68 03 02 80 00       	push   $0x800203
+  8006c5:	e8 73 fb ff ff       	call   80023d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006ca:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006cd:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006d3:	83 c4 10             	add    $0x10,%esp
+}
+  8006d6:	c9                   	leave
+  8006d7:	c3                   	ret
+		return -E_INVAL;
+  8006d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006dd:	eb f7                	jmp    8006d6 <vsnprintf+0x45>
+
+008006df <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006df:	55                   	push   %ebp
+  8006e0:	89 e5                	mov    %esp,%ebp
+  8006e2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006e5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006e8:	50                   	push   %eax
+  8006e9:	ff 75 10             	push   0x10(%ebp)
+  8006ec:	ff 75 0c             	push   0xc(%ebp)
+  8006ef:	ff 75 08             	push   0x8(%ebp)
+  8006f2:	e8 9a ff ff ff       	call   800691 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8006f7:	c9                   	leave
+  8006f8:	c3                   	ret
+
+008006f9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8006f9:	55                   	push   %ebp
+  8006fa:	89 e5                	mov    %esp,%ebp
+  8006fc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8006ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800704:	eb 03                	jmp    800709 <strlen+0x10>
+		n++;
+  800706:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800709:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80070d:	75 f7                	jne    800706 <strlen+0xd>
+	return n;
+}
+  80070f:	5d                   	pop    %ebp
+  800710:	c3                   	ret
+
+00800711 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800711:	55                   	push   %ebp
+  800712:	89 e5                	mov    %esp,%ebp
+  800714:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800717:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80071a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071f:	eb 03                	jmp    800724 <strnlen+0x13>
+		n++;
+  800721:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800724:	39 d0                	cmp    %edx,%eax
+  800726:	74 08                	je     800730 <strnlen+0x1f>
+  800728:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80072c:	75 f3                	jne    800721 <strnlen+0x10>
+  80072e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800730:	89 d0                	mov    %edx,%eax
+  800732:	5d                   	pop    %ebp
+  800733:	c3                   	ret
+
+00800734 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800734:	55                   	push   %ebp
+  800735:	89 e5                	mov    %esp,%ebp
+  800737:	53                   	push   %ebx
+  800738:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80073b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80073e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800743:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800747:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80074a:	83 c0 01             	add    $0x1,%eax
+  80074d:	84 d2                	test   %dl,%dl
+  80074f:	75 f2                	jne    800743 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800751:	89 c8                	mov    %ecx,%eax
+  800753:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800756:	c9                   	leave
+  800757:	c3                   	ret
+
+00800758 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800758:	55                   	push   %ebp
+  800759:	89 e5                	mov    %esp,%ebp
+  80075b:	53                   	push   %ebx
+  80075c:	83 ec 10             	sub    $0x10,%esp
+  80075f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800762:	53                   	push   %ebx
+  800763:	e8 91 ff ff ff       	call   8006f9 <strlen>
+  800768:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80076b:	ff 75 0c             	push   0xc(%ebp)
+  80076e:	01 d8                	add    %ebx,%eax
+  800770:	50                   	push   %eax
+  800771:	e8 be ff ff ff       	call   800734 <strcpy>
+	return dst;
+}
+  800776:	89 d8                	mov    %ebx,%eax
+  800778:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80077b:	c9                   	leave
+  80077c:	c3                   	ret
+
+0080077d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80077d:	55                   	push   %ebp
+  80077e:	89 e5                	mov    %esp,%ebp
+  800780:	56                   	push   %esi
+  800781:	53                   	push   %ebx
+  800782:	8b 75 08             	mov    0x8(%ebp),%esi
+  800785:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800788:	89 f3                	mov    %esi,%ebx
+  80078a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80078d:	89 f0                	mov    %esi,%eax
+  80078f:	eb 0f                	jmp    8007a0 <strncpy+0x23>
+		*dst++ = *src;
+  800791:	83 c0 01             	add    $0x1,%eax
+  800794:	0f b6 0a             	movzbl (%edx),%ecx
+  800797:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80079a:	80 f9 01             	cmp    $0x1,%cl
+  80079d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007a0:	39 d8                	cmp    %ebx,%eax
+  8007a2:	75 ed                	jne    800791 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007a4:	89 f0                	mov    %esi,%eax
+  8007a6:	5b                   	pop    %ebx
+  8007a7:	5e                   	pop    %esi
+  8007a8:	5d                   	pop    %ebp
+  8007a9:	c3                   	ret
+
+008007aa <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007aa:	55                   	push   %ebp
+  8007ab:	89 e5                	mov    %esp,%ebp
+  8007ad:	56                   	push   %esi
+  8007ae:	53                   	push   %ebx
+  8007af:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007b5:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007b8:	89 f0                	mov    %esi,%eax
+  8007ba:	85 d2                	test   %edx,%edx
+  8007bc:	74 21                	je     8007df <strlcpy+0x35>
+  8007be:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007c2:	89 f2                	mov    %esi,%edx
+  8007c4:	eb 09                	jmp    8007cf <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007c6:	83 c1 01             	add    $0x1,%ecx
+  8007c9:	83 c2 01             	add    $0x1,%edx
+  8007cc:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007cf:	39 c2                	cmp    %eax,%edx
+  8007d1:	74 09                	je     8007dc <strlcpy+0x32>
+  8007d3:	0f b6 19             	movzbl (%ecx),%ebx
+  8007d6:	84 db                	test   %bl,%bl
+  8007d8:	75 ec                	jne    8007c6 <strlcpy+0x1c>
+  8007da:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007dc:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007df:	29 f0                	sub    %esi,%eax
+}
+  8007e1:	5b                   	pop    %ebx
+  8007e2:	5e                   	pop    %esi
+  8007e3:	5d                   	pop    %ebp
+  8007e4:	c3                   	ret
+
+008007e5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007e5:	55                   	push   %ebp
+  8007e6:	89 e5                	mov    %esp,%ebp
+  8007e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007ee:	eb 06                	jmp    8007f6 <strcmp+0x11>
+		p++, q++;
+  8007f0:	83 c1 01             	add    $0x1,%ecx
+  8007f3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8007f6:	0f b6 01             	movzbl (%ecx),%eax
+  8007f9:	84 c0                	test   %al,%al
+  8007fb:	74 04                	je     800801 <strcmp+0x1c>
+  8007fd:	3a 02                	cmp    (%edx),%al
+  8007ff:	74 ef                	je     8007f0 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800801:	0f b6 c0             	movzbl %al,%eax
+  800804:	0f b6 12             	movzbl (%edx),%edx
+  800807:	29 d0                	sub    %edx,%eax
+}
+  800809:	5d                   	pop    %ebp
+  80080a:	c3                   	ret
+
+0080080b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80080b:	55                   	push   %ebp
+  80080c:	89 e5                	mov    %esp,%ebp
+  80080e:	53                   	push   %ebx
+  80080f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800812:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800815:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800818:	eb 09                	jmp    800823 <strncmp+0x18>
+		n--, p++, q++;
+  80081a:	83 ea 01             	sub    $0x1,%edx
+  80081d:	83 c0 01             	add    $0x1,%eax
+  800820:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800823:	85 d2                	test   %edx,%edx
+  800825:	74 18                	je     80083f <strncmp+0x34>
+  800827:	0f b6 18             	movzbl (%eax),%ebx
+  80082a:	84 db                	test   %bl,%bl
+  80082c:	74 04                	je     800832 <strncmp+0x27>
+  80082e:	3a 19                	cmp    (%ecx),%bl
+  800830:	74 e8                	je     80081a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800832:	0f b6 00             	movzbl (%eax),%eax
+  800835:	0f b6 11             	movzbl (%ecx),%edx
+  800838:	29 d0                	sub    %edx,%eax
+}
+  80083a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083d:	c9                   	leave
+  80083e:	c3                   	ret
+		return 0;
+  80083f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800844:	eb f4                	jmp    80083a <strncmp+0x2f>
+
+00800846 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800846:	55                   	push   %ebp
+  800847:	89 e5                	mov    %esp,%ebp
+  800849:	8b 45 08             	mov    0x8(%ebp),%eax
+  80084c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800850:	eb 03                	jmp    800855 <strchr+0xf>
+  800852:	83 c0 01             	add    $0x1,%eax
+  800855:	0f b6 10             	movzbl (%eax),%edx
+  800858:	84 d2                	test   %dl,%dl
+  80085a:	74 06                	je     800862 <strchr+0x1c>
+		if (*s == c)
+  80085c:	38 ca                	cmp    %cl,%dl
+  80085e:	75 f2                	jne    800852 <strchr+0xc>
+  800860:	eb 05                	jmp    800867 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800862:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800867:	5d                   	pop    %ebp
+  800868:	c3                   	ret
+
+00800869 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800869:	55                   	push   %ebp
+  80086a:	89 e5                	mov    %esp,%ebp
+  80086c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80086f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800873:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800876:	38 ca                	cmp    %cl,%dl
+  800878:	74 09                	je     800883 <strfind+0x1a>
+  80087a:	84 d2                	test   %dl,%dl
+  80087c:	74 05                	je     800883 <strfind+0x1a>
+	for (; *s; s++)
+  80087e:	83 c0 01             	add    $0x1,%eax
+  800881:	eb f0                	jmp    800873 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800883:	5d                   	pop    %ebp
+  800884:	c3                   	ret
+
+00800885 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800885:	55                   	push   %ebp
+  800886:	89 e5                	mov    %esp,%ebp
+  800888:	57                   	push   %edi
+  800889:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80088c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80088f:	85 c9                	test   %ecx,%ecx
+  800891:	74 20                	je     8008b3 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800893:	89 f8                	mov    %edi,%eax
+  800895:	09 c8                	or     %ecx,%eax
+  800897:	a8 03                	test   $0x3,%al
+  800899:	75 12                	jne    8008ad <memset+0x28>
+		c &= 0xFF;
+  80089b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80089f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008a5:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008a8:	fc                   	cld
+  8008a9:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008ab:	eb 06                	jmp    8008b3 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008b0:	fc                   	cld
+  8008b1:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008b3:	89 f8                	mov    %edi,%eax
+  8008b5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008b8:	c9                   	leave
+  8008b9:	c3                   	ret
+
+008008ba <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008ba:	55                   	push   %ebp
+  8008bb:	89 e5                	mov    %esp,%ebp
+  8008bd:	57                   	push   %edi
+  8008be:	56                   	push   %esi
+  8008bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008c5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008c8:	39 c6                	cmp    %eax,%esi
+  8008ca:	73 32                	jae    8008fe <memmove+0x44>
+  8008cc:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008cf:	39 d0                	cmp    %edx,%eax
+  8008d1:	73 2b                	jae    8008fe <memmove+0x44>
+		s += n;
+		d += n;
+  8008d3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008d6:	89 d6                	mov    %edx,%esi
+  8008d8:	09 fe                	or     %edi,%esi
+  8008da:	09 ce                	or     %ecx,%esi
+  8008dc:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008e2:	75 0e                	jne    8008f2 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008e4:	83 ef 04             	sub    $0x4,%edi
+  8008e7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008ea:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008ed:	fd                   	std
+  8008ee:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008f0:	eb 09                	jmp    8008fb <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008f2:	83 ef 01             	sub    $0x1,%edi
+  8008f5:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8008f8:	fd                   	std
+  8008f9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8008fb:	fc                   	cld
+  8008fc:	eb 1a                	jmp    800918 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008fe:	89 f2                	mov    %esi,%edx
+  800900:	09 c2                	or     %eax,%edx
+  800902:	09 ca                	or     %ecx,%edx
+  800904:	f6 c2 03             	test   $0x3,%dl
+  800907:	75 0a                	jne    800913 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800909:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80090c:	89 c7                	mov    %eax,%edi
+  80090e:	fc                   	cld
+  80090f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800911:	eb 05                	jmp    800918 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800913:	89 c7                	mov    %eax,%edi
+  800915:	fc                   	cld
+  800916:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800918:	5e                   	pop    %esi
+  800919:	5f                   	pop    %edi
+  80091a:	5d                   	pop    %ebp
+  80091b:	c3                   	ret
+
+0080091c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80091c:	55                   	push   %ebp
+  80091d:	89 e5                	mov    %esp,%ebp
+  80091f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800922:	ff 75 10             	push   0x10(%ebp)
+  800925:	ff 75 0c             	push   0xc(%ebp)
+  800928:	ff 75 08             	push   0x8(%ebp)
+  80092b:	e8 8a ff ff ff       	call   8008ba <memmove>
+}
+  800930:	c9                   	leave
+  800931:	c3                   	ret
+
+00800932 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800932:	55                   	push   %ebp
+  800933:	89 e5                	mov    %esp,%ebp
+  800935:	56                   	push   %esi
+  800936:	53                   	push   %ebx
+  800937:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80093d:	89 c6                	mov    %eax,%esi
+  80093f:	03 75 10             	add    0x10(%ebp),%esi
+  800942:	eb 06                	jmp    80094a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800944:	83 c0 01             	add    $0x1,%eax
+  800947:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80094a:	39 f0                	cmp    %esi,%eax
+  80094c:	74 14                	je     800962 <memcmp+0x30>
+		if (*s1 != *s2)
+  80094e:	0f b6 08             	movzbl (%eax),%ecx
+  800951:	0f b6 1a             	movzbl (%edx),%ebx
+  800954:	38 d9                	cmp    %bl,%cl
+  800956:	74 ec                	je     800944 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800958:	0f b6 c1             	movzbl %cl,%eax
+  80095b:	0f b6 db             	movzbl %bl,%ebx
+  80095e:	29 d8                	sub    %ebx,%eax
+  800960:	eb 05                	jmp    800967 <memcmp+0x35>
+	}
+
+	return 0;
+  800962:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800967:	5b                   	pop    %ebx
+  800968:	5e                   	pop    %esi
+  800969:	5d                   	pop    %ebp
+  80096a:	c3                   	ret
+
+0080096b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80096b:	55                   	push   %ebp
+  80096c:	89 e5                	mov    %esp,%ebp
+  80096e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800971:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800974:	89 c2                	mov    %eax,%edx
+  800976:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800979:	eb 03                	jmp    80097e <memfind+0x13>
+  80097b:	83 c0 01             	add    $0x1,%eax
+  80097e:	39 d0                	cmp    %edx,%eax
+  800980:	73 04                	jae    800986 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800982:	38 08                	cmp    %cl,(%eax)
+  800984:	75 f5                	jne    80097b <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800986:	5d                   	pop    %ebp
+  800987:	c3                   	ret
+
+00800988 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800988:	55                   	push   %ebp
+  800989:	89 e5                	mov    %esp,%ebp
+  80098b:	57                   	push   %edi
+  80098c:	56                   	push   %esi
+  80098d:	53                   	push   %ebx
+  80098e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800991:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800994:	eb 03                	jmp    800999 <strtol+0x11>
+		s++;
+  800996:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800999:	0f b6 02             	movzbl (%edx),%eax
+  80099c:	3c 20                	cmp    $0x20,%al
+  80099e:	74 f6                	je     800996 <strtol+0xe>
+  8009a0:	3c 09                	cmp    $0x9,%al
+  8009a2:	74 f2                	je     800996 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009a4:	3c 2b                	cmp    $0x2b,%al
+  8009a6:	74 2a                	je     8009d2 <strtol+0x4a>
+	int neg = 0;
+  8009a8:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009ad:	3c 2d                	cmp    $0x2d,%al
+  8009af:	74 2b                	je     8009dc <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009b1:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009b7:	75 0f                	jne    8009c8 <strtol+0x40>
+  8009b9:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009bc:	74 28                	je     8009e6 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009be:	85 db                	test   %ebx,%ebx
+  8009c0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009c5:	0f 44 d8             	cmove  %eax,%ebx
+  8009c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009cd:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009d0:	eb 46                	jmp    800a18 <strtol+0x90>
+		s++;
+  8009d2:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009da:	eb d5                	jmp    8009b1 <strtol+0x29>
+		s++, neg = 1;
+  8009dc:	83 c2 01             	add    $0x1,%edx
+  8009df:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009e4:	eb cb                	jmp    8009b1 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009e6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009ea:	74 0e                	je     8009fa <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009ec:	85 db                	test   %ebx,%ebx
+  8009ee:	75 d8                	jne    8009c8 <strtol+0x40>
+		s++, base = 8;
+  8009f0:	83 c2 01             	add    $0x1,%edx
+  8009f3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8009f8:	eb ce                	jmp    8009c8 <strtol+0x40>
+		s += 2, base = 16;
+  8009fa:	83 c2 02             	add    $0x2,%edx
+  8009fd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a02:	eb c4                	jmp    8009c8 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a04:	0f be c0             	movsbl %al,%eax
+  800a07:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a0a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a0d:	7d 3a                	jge    800a49 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a0f:	83 c2 01             	add    $0x1,%edx
+  800a12:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a16:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a18:	0f b6 02             	movzbl (%edx),%eax
+  800a1b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a1e:	89 f3                	mov    %esi,%ebx
+  800a20:	80 fb 09             	cmp    $0x9,%bl
+  800a23:	76 df                	jbe    800a04 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a25:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a28:	89 f3                	mov    %esi,%ebx
+  800a2a:	80 fb 19             	cmp    $0x19,%bl
+  800a2d:	77 08                	ja     800a37 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a2f:	0f be c0             	movsbl %al,%eax
+  800a32:	83 e8 57             	sub    $0x57,%eax
+  800a35:	eb d3                	jmp    800a0a <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a37:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a3a:	89 f3                	mov    %esi,%ebx
+  800a3c:	80 fb 19             	cmp    $0x19,%bl
+  800a3f:	77 08                	ja     800a49 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a41:	0f be c0             	movsbl %al,%eax
+  800a44:	83 e8 37             	sub    $0x37,%eax
+  800a47:	eb c1                	jmp    800a0a <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a49:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a4d:	74 05                	je     800a54 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a4f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a52:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a54:	89 c8                	mov    %ecx,%eax
+  800a56:	f7 d8                	neg    %eax
+  800a58:	85 ff                	test   %edi,%edi
+  800a5a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a5d:	89 c8                	mov    %ecx,%eax
+  800a5f:	5b                   	pop    %ebx
+  800a60:	5e                   	pop    %esi
+  800a61:	5f                   	pop    %edi
+  800a62:	5d                   	pop    %ebp
+  800a63:	c3                   	ret
+
+00800a64 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800a64:	55                   	push   %ebp
+  800a65:	89 e5                	mov    %esp,%ebp
+  800a67:	57                   	push   %edi
+  800a68:	56                   	push   %esi
+  800a69:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a75:	89 c3                	mov    %eax,%ebx
+  800a77:	89 c7                	mov    %eax,%edi
+  800a79:	55                   	push   %ebp
+  800a7a:	89 e5                	mov    %esp,%ebp
+  800a7c:	8d 35 84 0a 80 00    	lea    0x800a84,%esi
+  800a82:	0f 34                	sysenter
+  800a84:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800a85:	5b                   	pop    %ebx
+  800a86:	5e                   	pop    %esi
+  800a87:	5f                   	pop    %edi
+  800a88:	5d                   	pop    %ebp
+  800a89:	c3                   	ret
+
+00800a8a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800a8a:	55                   	push   %ebp
+  800a8b:	89 e5                	mov    %esp,%ebp
+  800a8d:	57                   	push   %edi
+  800a8e:	56                   	push   %esi
+  800a8f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800a90:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a95:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a9a:	89 d1                	mov    %edx,%ecx
+  800a9c:	89 d3                	mov    %edx,%ebx
+  800a9e:	89 d7                	mov    %edx,%edi
+  800aa0:	55                   	push   %ebp
+  800aa1:	89 e5                	mov    %esp,%ebp
+  800aa3:	8d 35 ab 0a 80 00    	lea    0x800aab,%esi
+  800aa9:	0f 34                	sysenter
+  800aab:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800aac:	5b                   	pop    %ebx
+  800aad:	5e                   	pop    %esi
+  800aae:	5f                   	pop    %edi
+  800aaf:	5d                   	pop    %ebp
+  800ab0:	c3                   	ret
+
+00800ab1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ab1:	55                   	push   %ebp
+  800ab2:	89 e5                	mov    %esp,%ebp
+  800ab4:	57                   	push   %edi
+  800ab5:	56                   	push   %esi
+  800ab6:	53                   	push   %ebx
+  800ab7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800aba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800abf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ac2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ac7:	89 cb                	mov    %ecx,%ebx
+  800ac9:	89 cf                	mov    %ecx,%edi
+  800acb:	55                   	push   %ebp
+  800acc:	89 e5                	mov    %esp,%ebp
+  800ace:	8d 35 d6 0a 80 00    	lea    0x800ad6,%esi
+  800ad4:	0f 34                	sysenter
+  800ad6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ad7:	85 c0                	test   %eax,%eax
+  800ad9:	7f 08                	jg     800ae3 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800adb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ade:	5b                   	pop    %ebx
+  800adf:	5e                   	pop    %esi
+  800ae0:	5f                   	pop    %edi
+  800ae1:	5d                   	pop    %ebp
+  800ae2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ae3:	83 ec 0c             	sub    $0xc,%esp
+  800ae6:	50                   	push   %eax
+  800ae7:	6a 03                	push   $0x3
+  800ae9:	68 c7 3a 80 00       	push   $0x803ac7
+  800aee:	6a 3d                	push   $0x3d
+  800af0:	68 e4 3a 80 00       	push   $0x803ae4
+  800af5:	e8 02 24 00 00       	call   802efc <_panic>
+
+00800afa <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800afa:	55                   	push   %ebp
+  800afb:	89 e5                	mov    %esp,%ebp
+  800afd:	57                   	push   %edi
+  800afe:	56                   	push   %esi
+  800aff:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b00:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b05:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b0a:	89 d1                	mov    %edx,%ecx
+  800b0c:	89 d3                	mov    %edx,%ebx
+  800b0e:	89 d7                	mov    %edx,%edi
+  800b10:	55                   	push   %ebp
+  800b11:	89 e5                	mov    %esp,%ebp
+  800b13:	8d 35 1b 0b 80 00    	lea    0x800b1b,%esi
+  800b19:	0f 34                	sysenter
+  800b1b:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800b1c:	5b                   	pop    %ebx
+  800b1d:	5e                   	pop    %esi
+  800b1e:	5f                   	pop    %edi
+  800b1f:	5d                   	pop    %ebp
+  800b20:	c3                   	ret
+
+00800b21 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b21:	55                   	push   %ebp
+  800b22:	89 e5                	mov    %esp,%ebp
+  800b24:	57                   	push   %edi
+  800b25:	56                   	push   %esi
+  800b26:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b27:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b2c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b31:	89 d1                	mov    %edx,%ecx
+  800b33:	89 d3                	mov    %edx,%ebx
+  800b35:	89 d7                	mov    %edx,%edi
+  800b37:	89 d6                	mov    %edx,%esi
+  800b39:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b3b:	5b                   	pop    %ebx
+  800b3c:	5e                   	pop    %esi
+  800b3d:	5f                   	pop    %edi
+  800b3e:	5d                   	pop    %ebp
+  800b3f:	c3                   	ret
+
+00800b40 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800b40:	55                   	push   %ebp
+  800b41:	89 e5                	mov    %esp,%ebp
+  800b43:	57                   	push   %edi
+  800b44:	56                   	push   %esi
+  800b45:	53                   	push   %ebx
+  800b46:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b4f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b54:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b5c:	55                   	push   %ebp
+  800b5d:	89 e5                	mov    %esp,%ebp
+  800b5f:	8d 35 67 0b 80 00    	lea    0x800b67,%esi
+  800b65:	0f 34                	sysenter
+  800b67:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b68:	85 c0                	test   %eax,%eax
+  800b6a:	7f 08                	jg     800b74 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800b6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b6f:	5b                   	pop    %ebx
+  800b70:	5e                   	pop    %esi
+  800b71:	5f                   	pop    %edi
+  800b72:	5d                   	pop    %ebp
+  800b73:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b74:	83 ec 0c             	sub    $0xc,%esp
+  800b77:	50                   	push   %eax
+  800b78:	6a 04                	push   $0x4
+  800b7a:	68 c7 3a 80 00       	push   $0x803ac7
+  800b7f:	6a 3d                	push   $0x3d
+  800b81:	68 e4 3a 80 00       	push   $0x803ae4
+  800b86:	e8 71 23 00 00       	call   802efc <_panic>
+
+00800b8b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800b8b:	55                   	push   %ebp
+  800b8c:	89 e5                	mov    %esp,%ebp
+  800b8e:	57                   	push   %edi
+  800b8f:	56                   	push   %esi
+  800b90:	53                   	push   %ebx
+  800b91:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800b94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b9a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800b9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ba2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ba5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ba8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800baa:	85 c0                	test   %eax,%eax
+  800bac:	7f 08                	jg     800bb6 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800bae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bb1:	5b                   	pop    %ebx
+  800bb2:	5e                   	pop    %esi
+  800bb3:	5f                   	pop    %edi
+  800bb4:	5d                   	pop    %ebp
+  800bb5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bb6:	83 ec 0c             	sub    $0xc,%esp
+  800bb9:	50                   	push   %eax
+  800bba:	6a 05                	push   $0x5
+  800bbc:	68 c7 3a 80 00       	push   $0x803ac7
+  800bc1:	6a 23                	push   $0x23
+  800bc3:	68 e4 3a 80 00       	push   $0x803ae4
+  800bc8:	e8 2f 23 00 00       	call   802efc <_panic>
+
+00800bcd <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800bcd:	55                   	push   %ebp
+  800bce:	89 e5                	mov    %esp,%ebp
+  800bd0:	57                   	push   %edi
+  800bd1:	56                   	push   %esi
+  800bd2:	53                   	push   %ebx
+  800bd3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800bd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be1:	b8 06 00 00 00       	mov    $0x6,%eax
+  800be6:	89 df                	mov    %ebx,%edi
+  800be8:	55                   	push   %ebp
+  800be9:	89 e5                	mov    %esp,%ebp
+  800beb:	8d 35 f3 0b 80 00    	lea    0x800bf3,%esi
+  800bf1:	0f 34                	sysenter
+  800bf3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bf4:	85 c0                	test   %eax,%eax
+  800bf6:	7f 08                	jg     800c00 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800bf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bfb:	5b                   	pop    %ebx
+  800bfc:	5e                   	pop    %esi
+  800bfd:	5f                   	pop    %edi
+  800bfe:	5d                   	pop    %ebp
+  800bff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c00:	83 ec 0c             	sub    $0xc,%esp
+  800c03:	50                   	push   %eax
+  800c04:	6a 06                	push   $0x6
+  800c06:	68 c7 3a 80 00       	push   $0x803ac7
+  800c0b:	6a 3d                	push   $0x3d
+  800c0d:	68 e4 3a 80 00       	push   $0x803ae4
+  800c12:	e8 e5 22 00 00       	call   802efc <_panic>
+
+00800c17 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	57                   	push   %edi
+  800c1b:	56                   	push   %esi
+  800c1c:	53                   	push   %ebx
+  800c1d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2b:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c30:	89 df                	mov    %ebx,%edi
+  800c32:	55                   	push   %ebp
+  800c33:	89 e5                	mov    %esp,%ebp
+  800c35:	8d 35 3d 0c 80 00    	lea    0x800c3d,%esi
+  800c3b:	0f 34                	sysenter
+  800c3d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c3e:	85 c0                	test   %eax,%eax
+  800c40:	7f 08                	jg     800c4a <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800c42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c45:	5b                   	pop    %ebx
+  800c46:	5e                   	pop    %esi
+  800c47:	5f                   	pop    %edi
+  800c48:	5d                   	pop    %ebp
+  800c49:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c4a:	83 ec 0c             	sub    $0xc,%esp
+  800c4d:	50                   	push   %eax
+  800c4e:	6a 08                	push   $0x8
+  800c50:	68 c7 3a 80 00       	push   $0x803ac7
+  800c55:	6a 3d                	push   $0x3d
+  800c57:	68 e4 3a 80 00       	push   $0x803ae4
+  800c5c:	e8 9b 22 00 00       	call   802efc <_panic>
+
+00800c61 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800c61:	55                   	push   %ebp
+  800c62:	89 e5                	mov    %esp,%ebp
+  800c64:	57                   	push   %edi
+  800c65:	56                   	push   %esi
+  800c66:	53                   	push   %ebx
+  800c67:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c75:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c7a:	89 df                	mov    %ebx,%edi
+  800c7c:	55                   	push   %ebp
+  800c7d:	89 e5                	mov    %esp,%ebp
+  800c7f:	8d 35 87 0c 80 00    	lea    0x800c87,%esi
+  800c85:	0f 34                	sysenter
+  800c87:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c88:	85 c0                	test   %eax,%eax
+  800c8a:	7f 08                	jg     800c94 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800c8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c8f:	5b                   	pop    %ebx
+  800c90:	5e                   	pop    %esi
+  800c91:	5f                   	pop    %edi
+  800c92:	5d                   	pop    %ebp
+  800c93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c94:	83 ec 0c             	sub    $0xc,%esp
+  800c97:	50                   	push   %eax
+  800c98:	6a 09                	push   $0x9
+  800c9a:	68 c7 3a 80 00       	push   $0x803ac7
+  800c9f:	6a 3d                	push   $0x3d
+  800ca1:	68 e4 3a 80 00       	push   $0x803ae4
+  800ca6:	e8 51 22 00 00       	call   802efc <_panic>
+
+00800cab <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	57                   	push   %edi
+  800caf:	56                   	push   %esi
+  800cb0:	53                   	push   %ebx
+  800cb1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cc4:	89 df                	mov    %ebx,%edi
+  800cc6:	55                   	push   %ebp
+  800cc7:	89 e5                	mov    %esp,%ebp
+  800cc9:	8d 35 d1 0c 80 00    	lea    0x800cd1,%esi
+  800ccf:	0f 34                	sysenter
+  800cd1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cd2:	85 c0                	test   %eax,%eax
+  800cd4:	7f 08                	jg     800cde <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800cd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd9:	5b                   	pop    %ebx
+  800cda:	5e                   	pop    %esi
+  800cdb:	5f                   	pop    %edi
+  800cdc:	5d                   	pop    %ebp
+  800cdd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cde:	83 ec 0c             	sub    $0xc,%esp
+  800ce1:	50                   	push   %eax
+  800ce2:	6a 0a                	push   $0xa
+  800ce4:	68 c7 3a 80 00       	push   $0x803ac7
+  800ce9:	6a 3d                	push   $0x3d
+  800ceb:	68 e4 3a 80 00       	push   $0x803ae4
+  800cf0:	e8 07 22 00 00       	call   802efc <_panic>
+
+00800cf5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800cf5:	55                   	push   %ebp
+  800cf6:	89 e5                	mov    %esp,%ebp
+  800cf8:	57                   	push   %edi
+  800cf9:	56                   	push   %esi
+  800cfa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800cfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d01:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d06:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d09:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d0c:	55                   	push   %ebp
+  800d0d:	89 e5                	mov    %esp,%ebp
+  800d0f:	8d 35 17 0d 80 00    	lea    0x800d17,%esi
+  800d15:	0f 34                	sysenter
+  800d17:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800d18:	5b                   	pop    %ebx
+  800d19:	5e                   	pop    %esi
+  800d1a:	5f                   	pop    %edi
+  800d1b:	5d                   	pop    %ebp
+  800d1c:	c3                   	ret
+
+00800d1d <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800d1d:	55                   	push   %ebp
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	57                   	push   %edi
+  800d21:	56                   	push   %esi
+  800d22:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d29:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d31:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d34:	55                   	push   %ebp
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	8d 35 3f 0d 80 00    	lea    0x800d3f,%esi
+  800d3d:	0f 34                	sysenter
+  800d3f:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800d40:	5b                   	pop    %ebx
+  800d41:	5e                   	pop    %esi
+  800d42:	5f                   	pop    %edi
+  800d43:	5d                   	pop    %ebp
+  800d44:	c3                   	ret
+
+00800d45 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800d45:	55                   	push   %ebp
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	57                   	push   %edi
+  800d49:	56                   	push   %esi
+  800d4a:	53                   	push   %ebx
+  800d4b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d4e:	be 00 00 00 00       	mov    $0x0,%esi
+  800d53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d59:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d61:	89 f7                	mov    %esi,%edi
+  800d63:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d65:	85 c0                	test   %eax,%eax
+  800d67:	7f 08                	jg     800d71 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800d69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6c:	5b                   	pop    %ebx
+  800d6d:	5e                   	pop    %esi
+  800d6e:	5f                   	pop    %edi
+  800d6f:	5d                   	pop    %ebp
+  800d70:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d71:	83 ec 0c             	sub    $0xc,%esp
+  800d74:	50                   	push   %eax
+  800d75:	6a 0d                	push   $0xd
+  800d77:	68 c7 3a 80 00       	push   $0x803ac7
+  800d7c:	6a 23                	push   $0x23
+  800d7e:	68 e4 3a 80 00       	push   $0x803ae4
+  800d83:	e8 74 21 00 00       	call   802efc <_panic>
+
+00800d88 <sys_ipc_recv>:
+{
+  800d88:	55                   	push   %ebp
+  800d89:	89 e5                	mov    %esp,%ebp
+  800d8b:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800d8e:	6a 00                	push   $0x0
+  800d90:	6a 01                	push   $0x1
+  800d92:	ff 75 08             	push   0x8(%ebp)
+  800d95:	e8 ab ff ff ff       	call   800d45 <sys_ipc_recvv>
+}
+  800d9a:	c9                   	leave
+  800d9b:	c3                   	ret
+
+00800d9c <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800d9c:	55                   	push   %ebp
+  800d9d:	89 e5                	mov    %esp,%ebp
+  800d9f:	57                   	push   %edi
+  800da0:	56                   	push   %esi
+  800da1:	53                   	push   %ebx
+  800da2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800da5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800daa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800db5:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800db8:	89 de                	mov    %ebx,%esi
+  800dba:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dbc:	85 c0                	test   %eax,%eax
+  800dbe:	7f 08                	jg     800dc8 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800dc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc3:	5b                   	pop    %ebx
+  800dc4:	5e                   	pop    %esi
+  800dc5:	5f                   	pop    %edi
+  800dc6:	5d                   	pop    %ebp
+  800dc7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dc8:	83 ec 0c             	sub    $0xc,%esp
+  800dcb:	50                   	push   %eax
+  800dcc:	6a 0d                	push   $0xd
+  800dce:	68 c7 3a 80 00       	push   $0x803ac7
+  800dd3:	6a 23                	push   $0x23
+  800dd5:	68 e4 3a 80 00       	push   $0x803ae4
+  800dda:	e8 1d 21 00 00       	call   802efc <_panic>
+
+00800ddf <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ddf:	55                   	push   %ebp
+  800de0:	89 e5                	mov    %esp,%ebp
+  800de2:	57                   	push   %edi
+  800de3:	56                   	push   %esi
+  800de4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800de5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dea:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800def:	89 d1                	mov    %edx,%ecx
+  800df1:	89 d3                	mov    %edx,%ebx
+  800df3:	89 d7                	mov    %edx,%edi
+  800df5:	55                   	push   %ebp
+  800df6:	89 e5                	mov    %esp,%ebp
+  800df8:	8d 35 00 0e 80 00    	lea    0x800e00,%esi
+  800dfe:	0f 34                	sysenter
+  800e00:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800e01:	5b                   	pop    %ebx
+  800e02:	5e                   	pop    %esi
+  800e03:	5f                   	pop    %edi
+  800e04:	5d                   	pop    %ebp
+  800e05:	c3                   	ret
+
+00800e06 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800e06:	55                   	push   %ebp
+  800e07:	89 e5                	mov    %esp,%ebp
+  800e09:	57                   	push   %edi
+  800e0a:	56                   	push   %esi
+  800e0b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e11:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e17:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e1c:	89 df                	mov    %ebx,%edi
+  800e1e:	55                   	push   %ebp
+  800e1f:	89 e5                	mov    %esp,%ebp
+  800e21:	8d 35 29 0e 80 00    	lea    0x800e29,%esi
+  800e27:	0f 34                	sysenter
+  800e29:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800e2a:	5b                   	pop    %ebx
+  800e2b:	5e                   	pop    %esi
+  800e2c:	5f                   	pop    %edi
+  800e2d:	5d                   	pop    %ebp
+  800e2e:	c3                   	ret
+
+00800e2f <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800e2f:	55                   	push   %ebp
+  800e30:	89 e5                	mov    %esp,%ebp
+  800e32:	57                   	push   %edi
+  800e33:	56                   	push   %esi
+  800e34:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e42:	89 cb                	mov    %ecx,%ebx
+  800e44:	89 cf                	mov    %ecx,%edi
+  800e46:	55                   	push   %ebp
+  800e47:	89 e5                	mov    %esp,%ebp
+  800e49:	8d 35 51 0e 80 00    	lea    0x800e51,%esi
+  800e4f:	0f 34                	sysenter
+  800e51:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800e52:	5b                   	pop    %ebx
+  800e53:	5e                   	pop    %esi
+  800e54:	5f                   	pop    %edi
+  800e55:	5d                   	pop    %ebp
+  800e56:	c3                   	ret
+
+00800e57 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800e57:	55                   	push   %ebp
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	57                   	push   %edi
+  800e5b:	56                   	push   %esi
+  800e5c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e68:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e6d:	89 df                	mov    %ebx,%edi
+  800e6f:	55                   	push   %ebp
+  800e70:	89 e5                	mov    %esp,%ebp
+  800e72:	8d 35 7a 0e 80 00    	lea    0x800e7a,%esi
+  800e78:	0f 34                	sysenter
+  800e7a:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800e7b:	5b                   	pop    %ebx
+  800e7c:	5e                   	pop    %esi
+  800e7d:	5f                   	pop    %edi
+  800e7e:	5d                   	pop    %ebp
+  800e7f:	c3                   	ret
+
+00800e80 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800e80:	55                   	push   %ebp
+  800e81:	89 e5                	mov    %esp,%ebp
+  800e83:	57                   	push   %edi
+  800e84:	56                   	push   %esi
+  800e85:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e91:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e96:	89 df                	mov    %ebx,%edi
+  800e98:	55                   	push   %ebp
+  800e99:	89 e5                	mov    %esp,%ebp
+  800e9b:	8d 35 a3 0e 80 00    	lea    0x800ea3,%esi
+  800ea1:	0f 34                	sysenter
+  800ea3:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800ea4:	5b                   	pop    %ebx
+  800ea5:	5e                   	pop    %esi
+  800ea6:	5f                   	pop    %edi
+  800ea7:	5d                   	pop    %ebp
+  800ea8:	c3                   	ret
+
+00800ea9 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800ea9:	55                   	push   %ebp
+  800eaa:	89 e5                	mov    %esp,%ebp
+  800eac:	57                   	push   %edi
+  800ead:	56                   	push   %esi
+  800eae:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eaf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb5:	b8 13 00 00 00       	mov    $0x13,%eax
+  800eba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ebd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec0:	55                   	push   %ebp
+  800ec1:	89 e5                	mov    %esp,%ebp
+  800ec3:	8d 35 cb 0e 80 00    	lea    0x800ecb,%esi
+  800ec9:	0f 34                	sysenter
+  800ecb:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800ecc:	5b                   	pop    %ebx
+  800ecd:	5e                   	pop    %esi
+  800ece:	5f                   	pop    %edi
+  800ecf:	5d                   	pop    %ebp
+  800ed0:	c3                   	ret
+
+00800ed1 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800ed1:	55                   	push   %ebp
+  800ed2:	89 e5                	mov    %esp,%ebp
+  800ed4:	57                   	push   %edi
+  800ed5:	56                   	push   %esi
+  800ed6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ed7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800edc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edf:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ee4:	89 cb                	mov    %ecx,%ebx
+  800ee6:	89 cf                	mov    %ecx,%edi
+  800ee8:	89 ce                	mov    %ecx,%esi
+  800eea:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800eec:	5b                   	pop    %ebx
+  800eed:	5e                   	pop    %esi
+  800eee:	5f                   	pop    %edi
+  800eef:	5d                   	pop    %ebp
+  800ef0:	c3                   	ret
+
+00800ef1 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800ef1:	55                   	push   %ebp
+  800ef2:	89 e5                	mov    %esp,%ebp
+  800ef4:	57                   	push   %edi
+  800ef5:	56                   	push   %esi
+  800ef6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ef7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800efc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eff:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f04:	89 cb                	mov    %ecx,%ebx
+  800f06:	89 cf                	mov    %ecx,%edi
+  800f08:	55                   	push   %ebp
+  800f09:	89 e5                	mov    %esp,%ebp
+  800f0b:	8d 35 13 0f 80 00    	lea    0x800f13,%esi
+  800f11:	0f 34                	sysenter
+  800f13:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800f14:	5b                   	pop    %ebx
+  800f15:	5e                   	pop    %esi
+  800f16:	5f                   	pop    %edi
+  800f17:	5d                   	pop    %ebp
+  800f18:	c3                   	ret
+
+00800f19 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	57                   	push   %edi
+  800f1d:	56                   	push   %esi
+  800f1e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f24:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f27:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f2c:	89 cb                	mov    %ecx,%ebx
+  800f2e:	89 cf                	mov    %ecx,%edi
+  800f30:	55                   	push   %ebp
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	8d 35 3b 0f 80 00    	lea    0x800f3b,%esi
+  800f39:	0f 34                	sysenter
+  800f3b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800f3c:	5b                   	pop    %ebx
+  800f3d:	5e                   	pop    %esi
+  800f3e:	5f                   	pop    %edi
+  800f3f:	5d                   	pop    %ebp
+  800f40:	c3                   	ret
+
+00800f41 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800f41:	55                   	push   %ebp
+  800f42:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f44:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f47:	05 00 00 00 30       	add    $0x30000000,%eax
+  800f4c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800f4f:	5d                   	pop    %ebp
+  800f50:	c3                   	ret
+
+00800f51 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800f51:	55                   	push   %ebp
+  800f52:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f54:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f57:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800f5c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800f61:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800f66:	5d                   	pop    %ebp
+  800f67:	c3                   	ret
+
+00800f68 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800f68:	55                   	push   %ebp
+  800f69:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800f6b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800f70:	eb 02                	jmp    800f74 <fd_alloc+0xc>
+  800f72:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800f74:	89 c2                	mov    %eax,%edx
+  800f76:	c1 ea 16             	shr    $0x16,%edx
+  800f79:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800f80:	f6 c2 01             	test   $0x1,%dl
+  800f83:	74 2b                	je     800fb0 <fd_alloc+0x48>
+  800f85:	89 c2                	mov    %eax,%edx
+  800f87:	c1 ea 0c             	shr    $0xc,%edx
+  800f8a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800f91:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800f97:	f6 c1 01             	test   $0x1,%cl
+  800f9a:	74 14                	je     800fb0 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800f9c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800fa2:	75 ce                	jne    800f72 <fd_alloc+0xa>
+  800fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800fa9:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800fae:	eb 05                	jmp    800fb5 <fd_alloc+0x4d>
+			return 0;
+  800fb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800fb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb8:	89 02                	mov    %eax,(%edx)
+}
+  800fba:	89 c8                	mov    %ecx,%eax
+  800fbc:	5d                   	pop    %ebp
+  800fbd:	c3                   	ret
+
+00800fbe <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800fbe:	55                   	push   %ebp
+  800fbf:	89 e5                	mov    %esp,%ebp
+  800fc1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800fc4:	83 f8 1f             	cmp    $0x1f,%eax
+  800fc7:	77 30                	ja     800ff9 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800fc9:	c1 e0 0c             	shl    $0xc,%eax
+  800fcc:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800fd1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800fd7:	f6 c2 01             	test   $0x1,%dl
+  800fda:	74 24                	je     801000 <fd_lookup+0x42>
+  800fdc:	89 c2                	mov    %eax,%edx
+  800fde:	c1 ea 0c             	shr    $0xc,%edx
+  800fe1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800fe8:	f6 c2 01             	test   $0x1,%dl
+  800feb:	74 1a                	je     801007 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800fed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ff0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800ff2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ff7:	5d                   	pop    %ebp
+  800ff8:	c3                   	ret
+		return -E_INVAL;
+  800ff9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ffe:	eb f7                	jmp    800ff7 <fd_lookup+0x39>
+		return -E_INVAL;
+  801000:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801005:	eb f0                	jmp    800ff7 <fd_lookup+0x39>
+  801007:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80100c:	eb e9                	jmp    800ff7 <fd_lookup+0x39>
+
+0080100e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80100e:	55                   	push   %ebp
+  80100f:	89 e5                	mov    %esp,%ebp
+  801011:	53                   	push   %ebx
+  801012:	83 ec 04             	sub    $0x4,%esp
+  801015:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801018:	b8 00 00 00 00       	mov    $0x0,%eax
+  80101d:	eb 03                	jmp    801022 <dev_lookup+0x14>
+  80101f:	83 c0 01             	add    $0x1,%eax
+  801022:	8b 1c 85 70 3b 80 00 	mov    0x803b70(,%eax,4),%ebx
+  801029:	85 db                	test   %ebx,%ebx
+  80102b:	74 0b                	je     801038 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80102d:	39 13                	cmp    %edx,(%ebx)
+  80102f:	75 ee                	jne    80101f <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801031:	b8 00 00 00 00       	mov    $0x0,%eax
+  801036:	eb 1f                	jmp    801057 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801038:	a1 00 50 80 00       	mov    0x805000,%eax
+  80103d:	8b 40 48             	mov    0x48(%eax),%eax
+  801040:	83 ec 04             	sub    $0x4,%esp
+  801043:	52                   	push   %edx
+  801044:	50                   	push   %eax
+  801045:	68 f4 3a 80 00       	push   $0x803af4
+  80104a:	e8 f7 f0 ff ff       	call   800146 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80104f:	83 c4 10             	add    $0x10,%esp
+  801052:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801057:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80105a:	89 1a                	mov    %ebx,(%edx)
+}
+  80105c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80105f:	c9                   	leave
+  801060:	c3                   	ret
+
+00801061 <fd_close>:
+{
+  801061:	55                   	push   %ebp
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	57                   	push   %edi
+  801065:	56                   	push   %esi
+  801066:	53                   	push   %ebx
+  801067:	83 ec 24             	sub    $0x24,%esp
+  80106a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80106d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801070:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801073:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801074:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80107a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80107d:	50                   	push   %eax
+  80107e:	e8 3b ff ff ff       	call   800fbe <fd_lookup>
+  801083:	89 c3                	mov    %eax,%ebx
+  801085:	83 c4 10             	add    $0x10,%esp
+  801088:	85 c0                	test   %eax,%eax
+  80108a:	78 05                	js     801091 <fd_close+0x30>
+	    || fd != fd2)
+  80108c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80108f:	74 16                	je     8010a7 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801091:	89 f8                	mov    %edi,%eax
+  801093:	84 c0                	test   %al,%al
+  801095:	b8 00 00 00 00       	mov    $0x0,%eax
+  80109a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80109d:	89 d8                	mov    %ebx,%eax
+  80109f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a2:	5b                   	pop    %ebx
+  8010a3:	5e                   	pop    %esi
+  8010a4:	5f                   	pop    %edi
+  8010a5:	5d                   	pop    %ebp
+  8010a6:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8010a7:	83 ec 08             	sub    $0x8,%esp
+  8010aa:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8010ad:	50                   	push   %eax
+  8010ae:	ff 36                	push   (%esi)
+  8010b0:	e8 59 ff ff ff       	call   80100e <dev_lookup>
+  8010b5:	89 c3                	mov    %eax,%ebx
+  8010b7:	83 c4 10             	add    $0x10,%esp
+  8010ba:	85 c0                	test   %eax,%eax
+  8010bc:	78 1a                	js     8010d8 <fd_close+0x77>
+		if (dev->dev_close)
+  8010be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8010c1:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8010c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8010c9:	85 c0                	test   %eax,%eax
+  8010cb:	74 0b                	je     8010d8 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8010cd:	83 ec 0c             	sub    $0xc,%esp
+  8010d0:	56                   	push   %esi
+  8010d1:	ff d0                	call   *%eax
+  8010d3:	89 c3                	mov    %eax,%ebx
+  8010d5:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8010d8:	83 ec 08             	sub    $0x8,%esp
+  8010db:	56                   	push   %esi
+  8010dc:	6a 00                	push   $0x0
+  8010de:	e8 ea fa ff ff       	call   800bcd <sys_page_unmap>
+	return r;
+  8010e3:	83 c4 10             	add    $0x10,%esp
+  8010e6:	eb b5                	jmp    80109d <fd_close+0x3c>
+
+008010e8 <close>:
+
+int
+close(int fdnum)
+{
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8010ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010f1:	50                   	push   %eax
+  8010f2:	ff 75 08             	push   0x8(%ebp)
+  8010f5:	e8 c4 fe ff ff       	call   800fbe <fd_lookup>
+  8010fa:	83 c4 10             	add    $0x10,%esp
+  8010fd:	85 c0                	test   %eax,%eax
+  8010ff:	79 02                	jns    801103 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801101:	c9                   	leave
+  801102:	c3                   	ret
+		return fd_close(fd, 1);
+  801103:	83 ec 08             	sub    $0x8,%esp
+  801106:	6a 01                	push   $0x1
+  801108:	ff 75 f4             	push   -0xc(%ebp)
+  80110b:	e8 51 ff ff ff       	call   801061 <fd_close>
+  801110:	83 c4 10             	add    $0x10,%esp
+  801113:	eb ec                	jmp    801101 <close+0x19>
+
+00801115 <close_all>:
+
+void
+close_all(void)
+{
+  801115:	55                   	push   %ebp
+  801116:	89 e5                	mov    %esp,%ebp
+  801118:	53                   	push   %ebx
+  801119:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80111c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801121:	83 ec 0c             	sub    $0xc,%esp
+  801124:	53                   	push   %ebx
+  801125:	e8 be ff ff ff       	call   8010e8 <close>
+	for (i = 0; i < MAXFD; i++)
+  80112a:	83 c3 01             	add    $0x1,%ebx
+  80112d:	83 c4 10             	add    $0x10,%esp
+  801130:	83 fb 20             	cmp    $0x20,%ebx
+  801133:	75 ec                	jne    801121 <close_all+0xc>
+}
+  801135:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801138:	c9                   	leave
+  801139:	c3                   	ret
+
+0080113a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80113a:	55                   	push   %ebp
+  80113b:	89 e5                	mov    %esp,%ebp
+  80113d:	57                   	push   %edi
+  80113e:	56                   	push   %esi
+  80113f:	53                   	push   %ebx
+  801140:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801143:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801146:	50                   	push   %eax
+  801147:	ff 75 08             	push   0x8(%ebp)
+  80114a:	e8 6f fe ff ff       	call   800fbe <fd_lookup>
+  80114f:	89 c3                	mov    %eax,%ebx
+  801151:	83 c4 10             	add    $0x10,%esp
+  801154:	85 c0                	test   %eax,%eax
+  801156:	78 7f                	js     8011d7 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801158:	83 ec 0c             	sub    $0xc,%esp
+  80115b:	ff 75 0c             	push   0xc(%ebp)
+  80115e:	e8 85 ff ff ff       	call   8010e8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801163:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801166:	c1 e6 0c             	shl    $0xc,%esi
+  801169:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80116f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801172:	89 3c 24             	mov    %edi,(%esp)
+  801175:	e8 d7 fd ff ff       	call   800f51 <fd2data>
+  80117a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80117c:	89 34 24             	mov    %esi,(%esp)
+  80117f:	e8 cd fd ff ff       	call   800f51 <fd2data>
+  801184:	83 c4 10             	add    $0x10,%esp
+  801187:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80118a:	89 d8                	mov    %ebx,%eax
+  80118c:	c1 e8 16             	shr    $0x16,%eax
+  80118f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801196:	a8 01                	test   $0x1,%al
+  801198:	74 11                	je     8011ab <dup+0x71>
+  80119a:	89 d8                	mov    %ebx,%eax
+  80119c:	c1 e8 0c             	shr    $0xc,%eax
+  80119f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011a6:	f6 c2 01             	test   $0x1,%dl
+  8011a9:	75 36                	jne    8011e1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8011ab:	89 f8                	mov    %edi,%eax
+  8011ad:	c1 e8 0c             	shr    $0xc,%eax
+  8011b0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011b7:	83 ec 0c             	sub    $0xc,%esp
+  8011ba:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011bf:	50                   	push   %eax
+  8011c0:	56                   	push   %esi
+  8011c1:	6a 00                	push   $0x0
+  8011c3:	57                   	push   %edi
+  8011c4:	6a 00                	push   $0x0
+  8011c6:	e8 c0 f9 ff ff       	call   800b8b <sys_page_map>
+  8011cb:	89 c3                	mov    %eax,%ebx
+  8011cd:	83 c4 20             	add    $0x20,%esp
+  8011d0:	85 c0                	test   %eax,%eax
+  8011d2:	78 33                	js     801207 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8011d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8011d7:	89 d8                	mov    %ebx,%eax
+  8011d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011dc:	5b                   	pop    %ebx
+  8011dd:	5e                   	pop    %esi
+  8011de:	5f                   	pop    %edi
+  8011df:	5d                   	pop    %ebp
+  8011e0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8011e1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011e8:	83 ec 0c             	sub    $0xc,%esp
+  8011eb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011f0:	50                   	push   %eax
+  8011f1:	ff 75 d4             	push   -0x2c(%ebp)
+  8011f4:	6a 00                	push   $0x0
+  8011f6:	53                   	push   %ebx
+  8011f7:	6a 00                	push   $0x0
+  8011f9:	e8 8d f9 ff ff       	call   800b8b <sys_page_map>
+  8011fe:	89 c3                	mov    %eax,%ebx
+  801200:	83 c4 20             	add    $0x20,%esp
+  801203:	85 c0                	test   %eax,%eax
+  801205:	79 a4                	jns    8011ab <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801207:	83 ec 08             	sub    $0x8,%esp
+  80120a:	56                   	push   %esi
+  80120b:	6a 00                	push   $0x0
+  80120d:	e8 bb f9 ff ff       	call   800bcd <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801212:	83 c4 08             	add    $0x8,%esp
+  801215:	ff 75 d4             	push   -0x2c(%ebp)
+  801218:	6a 00                	push   $0x0
+  80121a:	e8 ae f9 ff ff       	call   800bcd <sys_page_unmap>
+	return r;
+  80121f:	83 c4 10             	add    $0x10,%esp
+  801222:	eb b3                	jmp    8011d7 <dup+0x9d>
+
+00801224 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801224:	55                   	push   %ebp
+  801225:	89 e5                	mov    %esp,%ebp
+  801227:	56                   	push   %esi
+  801228:	53                   	push   %ebx
+  801229:	83 ec 18             	sub    $0x18,%esp
+  80122c:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80122f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801232:	50                   	push   %eax
+  801233:	56                   	push   %esi
+  801234:	e8 85 fd ff ff       	call   800fbe <fd_lookup>
+  801239:	83 c4 10             	add    $0x10,%esp
+  80123c:	85 c0                	test   %eax,%eax
+  80123e:	78 3c                	js     80127c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801240:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801243:	83 ec 08             	sub    $0x8,%esp
+  801246:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801249:	50                   	push   %eax
+  80124a:	ff 33                	push   (%ebx)
+  80124c:	e8 bd fd ff ff       	call   80100e <dev_lookup>
+  801251:	83 c4 10             	add    $0x10,%esp
+  801254:	85 c0                	test   %eax,%eax
+  801256:	78 24                	js     80127c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801258:	8b 43 08             	mov    0x8(%ebx),%eax
+  80125b:	83 e0 03             	and    $0x3,%eax
+  80125e:	83 f8 01             	cmp    $0x1,%eax
+  801261:	74 20                	je     801283 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801263:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801266:	8b 40 08             	mov    0x8(%eax),%eax
+  801269:	85 c0                	test   %eax,%eax
+  80126b:	74 37                	je     8012a4 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80126d:	83 ec 04             	sub    $0x4,%esp
+  801270:	ff 75 10             	push   0x10(%ebp)
+  801273:	ff 75 0c             	push   0xc(%ebp)
+  801276:	53                   	push   %ebx
+  801277:	ff d0                	call   *%eax
+  801279:	83 c4 10             	add    $0x10,%esp
+}
+  80127c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80127f:	5b                   	pop    %ebx
+  801280:	5e                   	pop    %esi
+  801281:	5d                   	pop    %ebp
+  801282:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801283:	a1 00 50 80 00       	mov    0x805000,%eax
+  801288:	8b 40 48             	mov    0x48(%eax),%eax
+  80128b:	83 ec 04             	sub    $0x4,%esp
+  80128e:	56                   	push   %esi
+  80128f:	50                   	push   %eax
+  801290:	68 35 3b 80 00       	push   $0x803b35
+  801295:	e8 ac ee ff ff       	call   800146 <cprintf>
+		return -E_INVAL;
+  80129a:	83 c4 10             	add    $0x10,%esp
+  80129d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012a2:	eb d8                	jmp    80127c <read+0x58>
+		return -E_NOT_SUPP;
+  8012a4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012a9:	eb d1                	jmp    80127c <read+0x58>
+
+008012ab <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8012ab:	55                   	push   %ebp
+  8012ac:	89 e5                	mov    %esp,%ebp
+  8012ae:	57                   	push   %edi
+  8012af:	56                   	push   %esi
+  8012b0:	53                   	push   %ebx
+  8012b1:	83 ec 0c             	sub    $0xc,%esp
+  8012b4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8012b7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8012ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bf:	eb 02                	jmp    8012c3 <readn+0x18>
+  8012c1:	01 c3                	add    %eax,%ebx
+  8012c3:	39 f3                	cmp    %esi,%ebx
+  8012c5:	73 21                	jae    8012e8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8012c7:	83 ec 04             	sub    $0x4,%esp
+  8012ca:	89 f0                	mov    %esi,%eax
+  8012cc:	29 d8                	sub    %ebx,%eax
+  8012ce:	50                   	push   %eax
+  8012cf:	89 d8                	mov    %ebx,%eax
+  8012d1:	03 45 0c             	add    0xc(%ebp),%eax
+  8012d4:	50                   	push   %eax
+  8012d5:	57                   	push   %edi
+  8012d6:	e8 49 ff ff ff       	call   801224 <read>
+		if (m < 0)
+  8012db:	83 c4 10             	add    $0x10,%esp
+  8012de:	85 c0                	test   %eax,%eax
+  8012e0:	78 04                	js     8012e6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8012e2:	75 dd                	jne    8012c1 <readn+0x16>
+  8012e4:	eb 02                	jmp    8012e8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8012e6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8012e8:	89 d8                	mov    %ebx,%eax
+  8012ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ed:	5b                   	pop    %ebx
+  8012ee:	5e                   	pop    %esi
+  8012ef:	5f                   	pop    %edi
+  8012f0:	5d                   	pop    %ebp
+  8012f1:	c3                   	ret
+
+008012f2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8012f2:	55                   	push   %ebp
+  8012f3:	89 e5                	mov    %esp,%ebp
+  8012f5:	56                   	push   %esi
+  8012f6:	53                   	push   %ebx
+  8012f7:	83 ec 18             	sub    $0x18,%esp
+  8012fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012fd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801300:	50                   	push   %eax
+  801301:	53                   	push   %ebx
+  801302:	e8 b7 fc ff ff       	call   800fbe <fd_lookup>
+  801307:	83 c4 10             	add    $0x10,%esp
+  80130a:	85 c0                	test   %eax,%eax
+  80130c:	78 37                	js     801345 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80130e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801311:	83 ec 08             	sub    $0x8,%esp
+  801314:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801317:	50                   	push   %eax
+  801318:	ff 36                	push   (%esi)
+  80131a:	e8 ef fc ff ff       	call   80100e <dev_lookup>
+  80131f:	83 c4 10             	add    $0x10,%esp
+  801322:	85 c0                	test   %eax,%eax
+  801324:	78 1f                	js     801345 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801326:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80132a:	74 20                	je     80134c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80132c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80132f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801332:	85 c0                	test   %eax,%eax
+  801334:	74 37                	je     80136d <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801336:	83 ec 04             	sub    $0x4,%esp
+  801339:	ff 75 10             	push   0x10(%ebp)
+  80133c:	ff 75 0c             	push   0xc(%ebp)
+  80133f:	56                   	push   %esi
+  801340:	ff d0                	call   *%eax
+  801342:	83 c4 10             	add    $0x10,%esp
+}
+  801345:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801348:	5b                   	pop    %ebx
+  801349:	5e                   	pop    %esi
+  80134a:	5d                   	pop    %ebp
+  80134b:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80134c:	a1 00 50 80 00       	mov    0x805000,%eax
+  801351:	8b 40 48             	mov    0x48(%eax),%eax
+  801354:	83 ec 04             	sub    $0x4,%esp
+  801357:	53                   	push   %ebx
+  801358:	50                   	push   %eax
+  801359:	68 51 3b 80 00       	push   $0x803b51
+  80135e:	e8 e3 ed ff ff       	call   800146 <cprintf>
+		return -E_INVAL;
+  801363:	83 c4 10             	add    $0x10,%esp
+  801366:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80136b:	eb d8                	jmp    801345 <write+0x53>
+		return -E_NOT_SUPP;
+  80136d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801372:	eb d1                	jmp    801345 <write+0x53>
+
+00801374 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801374:	55                   	push   %ebp
+  801375:	89 e5                	mov    %esp,%ebp
+  801377:	53                   	push   %ebx
+  801378:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80137b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80137e:	50                   	push   %eax
+  80137f:	ff 75 08             	push   0x8(%ebp)
+  801382:	e8 37 fc ff ff       	call   800fbe <fd_lookup>
+  801387:	83 c4 10             	add    $0x10,%esp
+  80138a:	85 c0                	test   %eax,%eax
+  80138c:	78 3a                	js     8013c8 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80138e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801391:	83 ec 08             	sub    $0x8,%esp
+  801394:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801397:	50                   	push   %eax
+  801398:	ff 33                	push   (%ebx)
+  80139a:	e8 6f fc ff ff       	call   80100e <dev_lookup>
+  80139f:	83 c4 10             	add    $0x10,%esp
+  8013a2:	85 c0                	test   %eax,%eax
+  8013a4:	78 22                	js     8013c8 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8013a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013a9:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8013ac:	85 c0                	test   %eax,%eax
+  8013ae:	74 0d                	je     8013bd <seek+0x49>
+  8013b0:	83 ec 0c             	sub    $0xc,%esp
+  8013b3:	53                   	push   %ebx
+  8013b4:	ff d0                	call   *%eax
+  8013b6:	83 c4 10             	add    $0x10,%esp
+  8013b9:	85 c0                	test   %eax,%eax
+  8013bb:	78 0b                	js     8013c8 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8013bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013c0:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8013c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013cb:	c9                   	leave
+  8013cc:	c3                   	ret
+
+008013cd <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8013cd:	55                   	push   %ebp
+  8013ce:	89 e5                	mov    %esp,%ebp
+  8013d0:	53                   	push   %ebx
+  8013d1:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013d4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013d7:	50                   	push   %eax
+  8013d8:	ff 75 08             	push   0x8(%ebp)
+  8013db:	e8 de fb ff ff       	call   800fbe <fd_lookup>
+  8013e0:	83 c4 10             	add    $0x10,%esp
+  8013e3:	85 c0                	test   %eax,%eax
+  8013e5:	78 2b                	js     801412 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013e7:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8013ea:	83 ec 08             	sub    $0x8,%esp
+  8013ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013f0:	50                   	push   %eax
+  8013f1:	ff 33                	push   (%ebx)
+  8013f3:	e8 16 fc ff ff       	call   80100e <dev_lookup>
+  8013f8:	83 c4 10             	add    $0x10,%esp
+  8013fb:	85 c0                	test   %eax,%eax
+  8013fd:	78 13                	js     801412 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8013ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801402:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801405:	85 c0                	test   %eax,%eax
+  801407:	74 0e                	je     801417 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801409:	83 ec 0c             	sub    $0xc,%esp
+  80140c:	53                   	push   %ebx
+  80140d:	ff d0                	call   *%eax
+  80140f:	83 c4 10             	add    $0x10,%esp
+}
+  801412:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801415:	c9                   	leave
+  801416:	c3                   	ret
+		return 0;
+  801417:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141c:	eb f4                	jmp    801412 <fsync+0x45>
+
+0080141e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80141e:	55                   	push   %ebp
+  80141f:	89 e5                	mov    %esp,%ebp
+  801421:	56                   	push   %esi
+  801422:	53                   	push   %ebx
+  801423:	83 ec 18             	sub    $0x18,%esp
+  801426:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801429:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80142c:	50                   	push   %eax
+  80142d:	53                   	push   %ebx
+  80142e:	e8 8b fb ff ff       	call   800fbe <fd_lookup>
+  801433:	83 c4 10             	add    $0x10,%esp
+  801436:	85 c0                	test   %eax,%eax
+  801438:	78 34                	js     80146e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80143a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80143d:	83 ec 08             	sub    $0x8,%esp
+  801440:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801443:	50                   	push   %eax
+  801444:	ff 36                	push   (%esi)
+  801446:	e8 c3 fb ff ff       	call   80100e <dev_lookup>
+  80144b:	83 c4 10             	add    $0x10,%esp
+  80144e:	85 c0                	test   %eax,%eax
+  801450:	78 1c                	js     80146e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801452:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801456:	74 1d                	je     801475 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801458:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80145b:	8b 40 18             	mov    0x18(%eax),%eax
+  80145e:	85 c0                	test   %eax,%eax
+  801460:	74 34                	je     801496 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801462:	83 ec 08             	sub    $0x8,%esp
+  801465:	ff 75 0c             	push   0xc(%ebp)
+  801468:	56                   	push   %esi
+  801469:	ff d0                	call   *%eax
+  80146b:	83 c4 10             	add    $0x10,%esp
+}
+  80146e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801471:	5b                   	pop    %ebx
+  801472:	5e                   	pop    %esi
+  801473:	5d                   	pop    %ebp
+  801474:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801475:	a1 00 50 80 00       	mov    0x805000,%eax
+  80147a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80147d:	83 ec 04             	sub    $0x4,%esp
+  801480:	53                   	push   %ebx
+  801481:	50                   	push   %eax
+  801482:	68 14 3b 80 00       	push   $0x803b14
+  801487:	e8 ba ec ff ff       	call   800146 <cprintf>
+		return -E_INVAL;
+  80148c:	83 c4 10             	add    $0x10,%esp
+  80148f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801494:	eb d8                	jmp    80146e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801496:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80149b:	eb d1                	jmp    80146e <ftruncate+0x50>
+
+0080149d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80149d:	55                   	push   %ebp
+  80149e:	89 e5                	mov    %esp,%ebp
+  8014a0:	56                   	push   %esi
+  8014a1:	53                   	push   %ebx
+  8014a2:	83 ec 18             	sub    $0x18,%esp
+  8014a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014a8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014ab:	50                   	push   %eax
+  8014ac:	ff 75 08             	push   0x8(%ebp)
+  8014af:	e8 0a fb ff ff       	call   800fbe <fd_lookup>
+  8014b4:	83 c4 10             	add    $0x10,%esp
+  8014b7:	85 c0                	test   %eax,%eax
+  8014b9:	78 49                	js     801504 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014bb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014be:	83 ec 08             	sub    $0x8,%esp
+  8014c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c4:	50                   	push   %eax
+  8014c5:	ff 36                	push   (%esi)
+  8014c7:	e8 42 fb ff ff       	call   80100e <dev_lookup>
+  8014cc:	83 c4 10             	add    $0x10,%esp
+  8014cf:	85 c0                	test   %eax,%eax
+  8014d1:	78 31                	js     801504 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8014d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014d6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8014da:	74 2f                	je     80150b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8014dc:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8014df:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8014e6:	00 00 00 
+	stat->st_isdir = 0;
+  8014e9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8014f0:	00 00 00 
+	stat->st_dev = dev;
+  8014f3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8014f9:	83 ec 08             	sub    $0x8,%esp
+  8014fc:	53                   	push   %ebx
+  8014fd:	56                   	push   %esi
+  8014fe:	ff 50 14             	call   *0x14(%eax)
+  801501:	83 c4 10             	add    $0x10,%esp
+}
+  801504:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801507:	5b                   	pop    %ebx
+  801508:	5e                   	pop    %esi
+  801509:	5d                   	pop    %ebp
+  80150a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80150b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801510:	eb f2                	jmp    801504 <fstat+0x67>
+
+00801512 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801512:	55                   	push   %ebp
+  801513:	89 e5                	mov    %esp,%ebp
+  801515:	56                   	push   %esi
+  801516:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801517:	83 ec 08             	sub    $0x8,%esp
+  80151a:	68 00 10 00 00       	push   $0x1000
+  80151f:	ff 75 08             	push   0x8(%ebp)
+  801522:	e8 b3 07 00 00       	call   801cda <open>
+  801527:	89 c3                	mov    %eax,%ebx
+  801529:	83 c4 10             	add    $0x10,%esp
+  80152c:	85 c0                	test   %eax,%eax
+  80152e:	78 1b                	js     80154b <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801530:	83 ec 08             	sub    $0x8,%esp
+  801533:	ff 75 0c             	push   0xc(%ebp)
+  801536:	50                   	push   %eax
+  801537:	e8 61 ff ff ff       	call   80149d <fstat>
+  80153c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80153e:	89 1c 24             	mov    %ebx,(%esp)
+  801541:	e8 a2 fb ff ff       	call   8010e8 <close>
+	return r;
+  801546:	83 c4 10             	add    $0x10,%esp
+  801549:	89 f3                	mov    %esi,%ebx
+}
+  80154b:	89 d8                	mov    %ebx,%eax
+  80154d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801550:	5b                   	pop    %ebx
+  801551:	5e                   	pop    %esi
+  801552:	5d                   	pop    %ebp
+  801553:	c3                   	ret
+
+00801554 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801554:	55                   	push   %ebp
+  801555:	89 e5                	mov    %esp,%ebp
+  801557:	57                   	push   %edi
+  801558:	56                   	push   %esi
+  801559:	53                   	push   %ebx
+  80155a:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801560:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801566:	89 d6                	mov    %edx,%esi
+  801568:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  80156e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801571:	89 d3                	mov    %edx,%ebx
+  801573:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801579:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801580:	74 1d                	je     80159f <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801582:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801587:	83 c8 07             	or     $0x7,%eax
+  80158a:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801590:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801595:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  80159b:	01 ce                	add    %ecx,%esi
+  80159d:	eb 28                	jmp    8015c7 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80159f:	83 ec 0c             	sub    $0xc,%esp
+  8015a2:	6a 01                	push   $0x1
+  8015a4:	e8 52 1e 00 00       	call   8033fb <ipc_find_env>
+  8015a9:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8015ae:	83 c4 10             	add    $0x10,%esp
+  8015b1:	eb cf                	jmp    801582 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  8015b3:	83 c0 01             	add    $0x1,%eax
+  8015b6:	89 fa                	mov    %edi,%edx
+  8015b8:	09 da                	or     %ebx,%edx
+  8015ba:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8015c1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8015c7:	39 f3                	cmp    %esi,%ebx
+  8015c9:	72 e8                	jb     8015b3 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  8015cb:	83 f8 41             	cmp    $0x41,%eax
+  8015ce:	77 2f                	ja     8015ff <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  8015d0:	50                   	push   %eax
+  8015d1:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  8015d7:	50                   	push   %eax
+  8015d8:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  8015de:	ff 35 c8 70 80 00    	push   0x8070c8
+  8015e4:	e8 c4 1d 00 00       	call   8033ad <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  8015e9:	83 c4 0c             	add    $0xc,%esp
+  8015ec:	6a 00                	push   $0x0
+  8015ee:	6a 00                	push   $0x0
+  8015f0:	6a 00                	push   $0x0
+  8015f2:	e8 60 1c 00 00       	call   803257 <ipc_recv>
+}
+  8015f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015fa:	5b                   	pop    %ebx
+  8015fb:	5e                   	pop    %esi
+  8015fc:	5f                   	pop    %edi
+  8015fd:	5d                   	pop    %ebp
+  8015fe:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  8015ff:	68 84 3b 80 00       	push   $0x803b84
+  801604:	68 a0 3b 80 00       	push   $0x803ba0
+  801609:	6a 40                	push   $0x40
+  80160b:	68 b5 3b 80 00       	push   $0x803bb5
+  801610:	e8 e7 18 00 00       	call   802efc <_panic>
+
+00801615 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801615:	55                   	push   %ebp
+  801616:	89 e5                	mov    %esp,%ebp
+  801618:	57                   	push   %edi
+  801619:	56                   	push   %esi
+  80161a:	53                   	push   %ebx
+  80161b:	83 ec 1c             	sub    $0x1c,%esp
+  80161e:	89 c3                	mov    %eax,%ebx
+  801620:	89 d6                	mov    %edx,%esi
+  801622:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801625:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  80162b:	89 ca                	mov    %ecx,%edx
+  80162d:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801630:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801637:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80163a:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801641:	8b 76 0c             	mov    0xc(%esi),%esi
+  801644:	89 fb                	mov    %edi,%ebx
+  801646:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  80164d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801650:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801657:	8b 75 08             	mov    0x8(%ebp),%esi
+  80165a:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801661:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801664:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  80166b:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  80166e:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801675:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  80167a:	39 c8                	cmp    %ecx,%eax
+  80167c:	74 0d                	je     80168b <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  80167e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801683:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801686:	5b                   	pop    %ebx
+  801687:	5e                   	pop    %esi
+  801688:	5f                   	pop    %edi
+  801689:	5d                   	pop    %ebp
+  80168a:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80168b:	6a 07                	push   $0x7
+  80168d:	68 00 60 80 00       	push   $0x806000
+  801692:	6a 0d                	push   $0xd
+  801694:	ff 35 c8 70 80 00    	push   0x8070c8
+  80169a:	e8 23 1c 00 00       	call   8032c2 <ipc_send>
+  80169f:	83 c4 10             	add    $0x10,%esp
+  8016a2:	eb da                	jmp    80167e <fsring_post+0x69>
+
+008016a4 <fsipcv>:
+{
+  8016a4:	55                   	push   %ebp
+  8016a5:	89 e5                	mov    %esp,%ebp
+  8016a7:	57                   	push   %edi
+  8016a8:	56                   	push   %esi
+  8016a9:	53                   	push   %ebx
+  8016aa:	83 ec 0c             	sub    $0xc,%esp
+  8016ad:	89 c7                	mov    %eax,%edi
+  8016af:	89 d3                	mov    %edx,%ebx
+  8016b1:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  8016b3:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  8016ba:	74 26                	je     8016e2 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016bc:	6a 07                	push   $0x7
+  8016be:	68 00 60 80 00       	push   $0x806000
+  8016c3:	57                   	push   %edi
+  8016c4:	ff 35 c8 70 80 00    	push   0x8070c8
+  8016ca:	e8 f3 1b 00 00       	call   8032c2 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  8016cf:	6a 00                	push   $0x0
+  8016d1:	56                   	push   %esi
+  8016d2:	53                   	push   %ebx
+  8016d3:	6a 00                	push   $0x0
+  8016d5:	e8 40 1c 00 00       	call   80331a <ipc_recvv>
+}
+  8016da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016dd:	5b                   	pop    %ebx
+  8016de:	5e                   	pop    %esi
+  8016df:	5f                   	pop    %edi
+  8016e0:	5d                   	pop    %ebp
+  8016e1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016e2:	83 ec 0c             	sub    $0xc,%esp
+  8016e5:	6a 01                	push   $0x1
+  8016e7:	e8 0f 1d 00 00       	call   8033fb <ipc_find_env>
+  8016ec:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8016f1:	83 c4 10             	add    $0x10,%esp
+  8016f4:	eb c6                	jmp    8016bc <fsipcv+0x18>
+
+008016f6 <fsipc>:
+{
+  8016f6:	55                   	push   %ebp
+  8016f7:	89 e5                	mov    %esp,%ebp
+  8016f9:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  8016fc:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801703:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801706:	e8 99 ff ff ff       	call   8016a4 <fsipcv>
+}
+  80170b:	c9                   	leave
+  80170c:	c3                   	ret
+
+0080170d <file_write_direct>:
+{
+  80170d:	55                   	push   %ebp
+  80170e:	89 e5                	mov    %esp,%ebp
+  801710:	56                   	push   %esi
+  801711:	53                   	push   %ebx
+  801712:	89 c3                	mov    %eax,%ebx
+  801714:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801716:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  80171c:	77 40                	ja     80175e <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80171e:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801723:	39 c8                	cmp    %ecx,%eax
+  801725:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801728:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  80172b:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  801731:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801736:	83 ec 04             	sub    $0x4,%esp
+  801739:	50                   	push   %eax
+  80173a:	52                   	push   %edx
+  80173b:	68 08 60 80 00       	push   $0x806008
+  801740:	e8 75 f1 ff ff       	call   8008ba <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801745:	ba 00 00 00 00       	mov    $0x0,%edx
+  80174a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80174f:	e8 a2 ff ff ff       	call   8016f6 <fsipc>
+  801754:	83 c4 10             	add    $0x10,%esp
+}
+  801757:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80175a:	5b                   	pop    %ebx
+  80175b:	5e                   	pop    %esi
+  80175c:	5d                   	pop    %ebp
+  80175d:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80175e:	89 d6                	mov    %edx,%esi
+  801760:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801766:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80176b:	29 f1                	sub    %esi,%ecx
+  80176d:	39 c1                	cmp    %eax,%ecx
+  80176f:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801772:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801775:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  80177a:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801780:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801786:	83 ec 0c             	sub    $0xc,%esp
+  801789:	6a 05                	push   $0x5
+  80178b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801790:	e8 bf fd ff ff       	call   801554 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801795:	83 c4 10             	add    $0x10,%esp
+  801798:	eb bd                	jmp    801757 <file_write_direct+0x4a>
+
+0080179a <devfile_sync>:
+{
+  80179a:	55                   	push   %ebp
+  80179b:	89 e5                	mov    %esp,%ebp
+  80179d:	57                   	push   %edi
+  80179e:	56                   	push   %esi
+  80179f:	53                   	push   %ebx
+  8017a0:	83 ec 28             	sub    $0x28,%esp
+  8017a3:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  8017a6:	56                   	push   %esi
+  8017a7:	e8 a5 f7 ff ff       	call   800f51 <fd2data>
+  8017ac:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  8017ae:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  8017b1:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  8017b8:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8017bb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  8017c0:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8017c4:	74 45                	je     80180b <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  8017c6:	8b 46 14             	mov    0x14(%esi),%eax
+  8017c9:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8017cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8017d9:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  8017dc:	39 cb                	cmp    %ecx,%ebx
+  8017de:	73 14                	jae    8017f4 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  8017e0:	29 d9                	sub    %ebx,%ecx
+  8017e2:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8017e5:	89 f0                	mov    %esi,%eax
+  8017e7:	e8 21 ff ff ff       	call   80170d <file_write_direct>
+  8017ec:	85 c0                	test   %eax,%eax
+  8017ee:	7e 04                	jle    8017f4 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8017f0:	01 c3                	add    %eax,%ebx
+  8017f2:	eb e5                	jmp    8017d9 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  8017f4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8017f7:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  8017fe:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801801:	85 c0                	test   %eax,%eax
+  801803:	ba 00 00 00 00       	mov    $0x0,%edx
+  801808:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80180b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80180e:	5b                   	pop    %ebx
+  80180f:	5e                   	pop    %esi
+  801810:	5f                   	pop    %edi
+  801811:	5d                   	pop    %ebp
+  801812:	c3                   	ret
+
+00801813 <devfile_write>:
+{
+  801813:	55                   	push   %ebp
+  801814:	89 e5                	mov    %esp,%ebp
+  801816:	57                   	push   %edi
+  801817:	56                   	push   %esi
+  801818:	53                   	push   %ebx
+  801819:	83 ec 28             	sub    $0x28,%esp
+  80181c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80181f:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801822:	53                   	push   %ebx
+  801823:	e8 29 f7 ff ff       	call   800f51 <fd2data>
+  801828:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  80182b:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80182e:	83 c4 10             	add    $0x10,%esp
+  801831:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801835:	74 43                	je     80187a <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801837:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  80183e:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801841:	85 c0                	test   %eax,%eax
+  801843:	74 43                	je     801888 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801845:	89 c2                	mov    %eax,%edx
+  801847:	03 53 14             	add    0x14(%ebx),%edx
+  80184a:	39 fa                	cmp    %edi,%edx
+  80184c:	75 0b                	jne    801859 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  80184e:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801851:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801857:	76 66                	jbe    8018bf <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801859:	83 ec 0c             	sub    $0xc,%esp
+  80185c:	53                   	push   %ebx
+  80185d:	e8 38 ff ff ff       	call   80179a <devfile_sync>
+  801862:	83 c4 10             	add    $0x10,%esp
+  801865:	85 c0                	test   %eax,%eax
+  801867:	78 4e                	js     8018b7 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801869:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80186f:	77 56                	ja     8018c7 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801871:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801874:	85 c0                	test   %eax,%eax
+  801876:	75 20                	jne    801898 <devfile_write+0x85>
+  801878:	eb 16                	jmp    801890 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  80187a:	89 f1                	mov    %esi,%ecx
+  80187c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80187f:	89 d8                	mov    %ebx,%eax
+  801881:	e8 87 fe ff ff       	call   80170d <file_write_direct>
+  801886:	eb 2f                	jmp    8018b7 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801888:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80188e:	77 37                	ja     8018c7 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801890:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801893:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801898:	83 ec 04             	sub    $0x4,%esp
+  80189b:	56                   	push   %esi
+  80189c:	ff 75 0c             	push   0xc(%ebp)
+  80189f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8018a2:	01 c1                	add    %eax,%ecx
+  8018a4:	51                   	push   %ecx
+  8018a5:	e8 10 f0 ff ff       	call   8008ba <memmove>
+	ff->buf_wlen += n;
+  8018aa:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  8018ad:	01 f7                	add    %esi,%edi
+  8018af:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8018b2:	89 f0                	mov    %esi,%eax
+  8018b4:	83 c4 10             	add    $0x10,%esp
+}
+  8018b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ba:	5b                   	pop    %ebx
+  8018bb:	5e                   	pop    %esi
+  8018bc:	5f                   	pop    %edi
+  8018bd:	5d                   	pop    %ebp
+  8018be:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  8018bf:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8018c5:	76 d1                	jbe    801898 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  8018c7:	89 f1                	mov    %esi,%ecx
+  8018c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018cc:	89 d8                	mov    %ebx,%eax
+  8018ce:	e8 3a fe ff ff       	call   80170d <file_write_direct>
+  8018d3:	eb e2                	jmp    8018b7 <devfile_write+0xa4>
+
+008018d5 <devfile_trunc>:
+{
+  8018d5:	55                   	push   %ebp
+  8018d6:	89 e5                	mov    %esp,%ebp
+  8018d8:	53                   	push   %ebx
+  8018d9:	83 ec 10             	sub    $0x10,%esp
+  8018dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  8018df:	53                   	push   %ebx
+  8018e0:	e8 b5 fe ff ff       	call   80179a <devfile_sync>
+  8018e5:	83 c4 10             	add    $0x10,%esp
+  8018e8:	85 c0                	test   %eax,%eax
+  8018ea:	78 1f                	js     80190b <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018ec:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8018ef:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8018f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018f7:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8018fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801901:	b8 02 00 00 00       	mov    $0x2,%eax
+  801906:	e8 eb fd ff ff       	call   8016f6 <fsipc>
+}
+  80190b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80190e:	c9                   	leave
+  80190f:	c3                   	ret
+
+00801910 <devfile_stat>:
+{
+  801910:	55                   	push   %ebp
+  801911:	89 e5                	mov    %esp,%ebp
+  801913:	56                   	push   %esi
+  801914:	53                   	push   %ebx
+  801915:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801918:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  80191b:	83 ec 0c             	sub    $0xc,%esp
+  80191e:	53                   	push   %ebx
+  80191f:	e8 76 fe ff ff       	call   80179a <devfile_sync>
+  801924:	83 c4 10             	add    $0x10,%esp
+  801927:	85 c0                	test   %eax,%eax
+  801929:	78 47                	js     801972 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80192b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80192e:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801933:	ba 00 00 00 00       	mov    $0x0,%edx
+  801938:	b8 05 00 00 00       	mov    $0x5,%eax
+  80193d:	e8 b4 fd ff ff       	call   8016f6 <fsipc>
+  801942:	85 c0                	test   %eax,%eax
+  801944:	78 2c                	js     801972 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801946:	83 ec 08             	sub    $0x8,%esp
+  801949:	68 00 60 80 00       	push   $0x806000
+  80194e:	56                   	push   %esi
+  80194f:	e8 e0 ed ff ff       	call   800734 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801954:	a1 80 60 80 00       	mov    0x806080,%eax
+  801959:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80195f:	a1 84 60 80 00       	mov    0x806084,%eax
+  801964:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  80196a:	83 c4 10             	add    $0x10,%esp
+  80196d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801972:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801975:	5b                   	pop    %ebx
+  801976:	5e                   	pop    %esi
+  801977:	5d                   	pop    %ebp
+  801978:	c3                   	ret
+
+00801979 <devfile_flush>:
+{
+  801979:	55                   	push   %ebp
+  80197a:	89 e5                	mov    %esp,%ebp
+  80197c:	56                   	push   %esi
+  80197d:	53                   	push   %ebx
+  80197e:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801981:	83 ec 0c             	sub    $0xc,%esp
+  801984:	56                   	push   %esi
+  801985:	e8 10 fe ff ff       	call   80179a <devfile_sync>
+  80198a:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  80198c:	83 c4 10             	add    $0x10,%esp
+  80198f:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801993:	75 25                	jne    8019ba <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801995:	8b 46 0c             	mov    0xc(%esi),%eax
+  801998:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  80199d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019a7:	e8 4a fd ff ff       	call   8016f6 <fsipc>
+  8019ac:	85 c0                	test   %eax,%eax
+  8019ae:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8019b1:	89 d8                	mov    %ebx,%eax
+  8019b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019b6:	5b                   	pop    %ebx
+  8019b7:	5e                   	pop    %esi
+  8019b8:	5d                   	pop    %ebp
+  8019b9:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  8019ba:	83 ec 0c             	sub    $0xc,%esp
+  8019bd:	56                   	push   %esi
+  8019be:	e8 8e f5 ff ff       	call   800f51 <fd2data>
+  8019c3:	83 c4 08             	add    $0x8,%esp
+  8019c6:	50                   	push   %eax
+  8019c7:	6a 00                	push   $0x0
+  8019c9:	e8 ff f1 ff ff       	call   800bcd <sys_page_unmap>
+  8019ce:	83 c4 10             	add    $0x10,%esp
+  8019d1:	eb c2                	jmp    801995 <devfile_flush+0x1c>
+
+008019d3 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  8019d3:	55                   	push   %ebp
+  8019d4:	89 e5                	mov    %esp,%ebp
+  8019d6:	57                   	push   %edi
+  8019d7:	56                   	push   %esi
+  8019d8:	53                   	push   %ebx
+  8019d9:	83 ec 64             	sub    $0x64,%esp
+  8019dc:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  8019de:	52                   	push   %edx
+  8019df:	50                   	push   %eax
+  8019e0:	e8 d9 f5 ff ff       	call   800fbe <fd_lookup>
+  8019e5:	89 c1                	mov    %eax,%ecx
+  8019e7:	83 c4 10             	add    $0x10,%esp
+  8019ea:	85 c0                	test   %eax,%eax
+  8019ec:	0f 88 f2 00 00 00    	js     801ae4 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  8019f2:	8b 07                	mov    (%edi),%eax
+  8019f4:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8019fa:	39 10                	cmp    %edx,(%eax)
+  8019fc:	0f 85 03 01 00 00    	jne    801b05 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801a02:	a1 00 50 80 00       	mov    0x805000,%eax
+  801a07:	8b 40 48             	mov    0x48(%eax),%eax
+  801a0a:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801a10:	0f 84 96 00 00 00    	je     801aac <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801a16:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801a1d:	0f 84 cb 00 00 00    	je     801aee <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a23:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801a28:	83 c8 07             	or     $0x7,%eax
+  801a2b:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801a2e:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a31:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801a36:	83 ec 04             	sub    $0x4,%esp
+  801a39:	68 07 04 00 00       	push   $0x407
+  801a3e:	53                   	push   %ebx
+  801a3f:	6a 00                	push   $0x0
+  801a41:	e8 fa f0 ff ff       	call   800b40 <sys_page_alloc>
+  801a46:	89 c1                	mov    %eax,%ecx
+  801a48:	83 c4 10             	add    $0x10,%esp
+  801a4b:	85 c0                	test   %eax,%eax
+  801a4d:	0f 88 91 00 00 00    	js     801ae4 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801a53:	89 d8                	mov    %ebx,%eax
+  801a55:	83 c8 07             	or     $0x7,%eax
+  801a58:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801a5a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a60:	83 c6 04             	add    $0x4,%esi
+  801a63:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801a69:	75 cb                	jne    801a36 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801a6b:	6a 12                	push   $0x12
+  801a6d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801a70:	50                   	push   %eax
+  801a71:	6a 0c                	push   $0xc
+  801a73:	ff 35 c8 70 80 00    	push   0x8070c8
+  801a79:	e8 2f 19 00 00       	call   8033ad <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a7e:	83 c4 0c             	add    $0xc,%esp
+  801a81:	6a 00                	push   $0x0
+  801a83:	6a 00                	push   $0x0
+  801a85:	6a 00                	push   $0x0
+  801a87:	e8 cb 17 00 00       	call   803257 <ipc_recv>
+  801a8c:	89 c1                	mov    %eax,%ecx
+  801a8e:	83 c4 10             	add    $0x10,%esp
+  801a91:	85 c0                	test   %eax,%eax
+  801a93:	78 4f                	js     801ae4 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801a95:	a1 00 50 80 00       	mov    0x805000,%eax
+  801a9a:	8b 40 48             	mov    0x48(%eax),%eax
+  801a9d:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801aa2:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801aa9:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801aac:	83 ec 0c             	sub    $0xc,%esp
+  801aaf:	ff 37                	push   (%edi)
+  801ab1:	e8 e4 fc ff ff       	call   80179a <devfile_sync>
+  801ab6:	89 c1                	mov    %eax,%ecx
+  801ab8:	83 c4 10             	add    $0x10,%esp
+  801abb:	85 c0                	test   %eax,%eax
+  801abd:	78 25                	js     801ae4 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801abf:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801ac5:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801aca:	ba 01 00 00 00       	mov    $0x1,%edx
+  801acf:	89 d0                	mov    %edx,%eax
+  801ad1:	d3 e0                	shl    %cl,%eax
+  801ad3:	85 d8                	test   %ebx,%eax
+  801ad5:	74 0d                	je     801ae4 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801ad7:	83 c1 01             	add    $0x1,%ecx
+  801ada:	83 f9 10             	cmp    $0x10,%ecx
+  801add:	75 f0                	jne    801acf <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801adf:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801ae4:	89 c8                	mov    %ecx,%eax
+  801ae6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ae9:	5b                   	pop    %ebx
+  801aea:	5e                   	pop    %esi
+  801aeb:	5f                   	pop    %edi
+  801aec:	5d                   	pop    %ebp
+  801aed:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801aee:	83 ec 0c             	sub    $0xc,%esp
+  801af1:	6a 01                	push   $0x1
+  801af3:	e8 03 19 00 00       	call   8033fb <ipc_find_env>
+  801af8:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801afd:	83 c4 10             	add    $0x10,%esp
+  801b00:	e9 1e ff ff ff       	jmp    801a23 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801b05:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801b0a:	eb d8                	jmp    801ae4 <fsring_slot+0x111>
+
+00801b0c <file_read_direct>:
+{
+  801b0c:	55                   	push   %ebp
+  801b0d:	89 e5                	mov    %esp,%ebp
+  801b0f:	57                   	push   %edi
+  801b10:	56                   	push   %esi
+  801b11:	53                   	push   %ebx
+  801b12:	83 ec 1c             	sub    $0x1c,%esp
+  801b15:	89 c7                	mov    %eax,%edi
+  801b17:	89 d6                	mov    %edx,%esi
+  801b19:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801b1b:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801b21:	77 52                	ja     801b75 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b23:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b26:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801b2b:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b31:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b36:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b3b:	e8 b6 fb ff ff       	call   8016f6 <fsipc>
+  801b40:	89 c7                	mov    %eax,%edi
+  801b42:	85 c0                	test   %eax,%eax
+  801b44:	78 25                	js     801b6b <file_read_direct+0x5f>
+	assert(r <= n);
+  801b46:	39 c3                	cmp    %eax,%ebx
+  801b48:	0f 82 87 00 00 00    	jb     801bd5 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801b4e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b53:	0f 8f 95 00 00 00    	jg     801bee <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b59:	83 ec 04             	sub    $0x4,%esp
+  801b5c:	50                   	push   %eax
+  801b5d:	68 00 60 80 00       	push   $0x806000
+  801b62:	56                   	push   %esi
+  801b63:	e8 52 ed ff ff       	call   8008ba <memmove>
+	return r;
+  801b68:	83 c4 10             	add    $0x10,%esp
+}
+  801b6b:	89 f8                	mov    %edi,%eax
+  801b6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b70:	5b                   	pop    %ebx
+  801b71:	5e                   	pop    %esi
+  801b72:	5f                   	pop    %edi
+  801b73:	5d                   	pop    %ebp
+  801b74:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801b75:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801b7b:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b80:	29 d1                	sub    %edx,%ecx
+  801b82:	39 d9                	cmp    %ebx,%ecx
+  801b84:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801b87:	89 f0                	mov    %esi,%eax
+  801b89:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801b8c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b8f:	eb 0f                	jmp    801ba0 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801b91:	0f b6 10             	movzbl (%eax),%edx
+  801b94:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801b96:	05 00 10 00 00       	add    $0x1000,%eax
+  801b9b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ba0:	39 c8                	cmp    %ecx,%eax
+  801ba2:	72 ed                	jb     801b91 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801ba4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ba7:	8b 47 0c             	mov    0xc(%edi),%eax
+  801baa:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801baf:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801bb5:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801bbb:	83 ec 0c             	sub    $0xc,%esp
+  801bbe:	6a 07                	push   $0x7
+  801bc0:	89 d9                	mov    %ebx,%ecx
+  801bc2:	89 f2                	mov    %esi,%edx
+  801bc4:	b8 09 00 00 00       	mov    $0x9,%eax
+  801bc9:	e8 86 f9 ff ff       	call   801554 <fsipc_pages>
+  801bce:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801bd0:	83 c4 10             	add    $0x10,%esp
+  801bd3:	eb 96                	jmp    801b6b <file_read_direct+0x5f>
+	assert(r <= n);
+  801bd5:	68 c0 3b 80 00       	push   $0x803bc0
+  801bda:	68 a0 3b 80 00       	push   $0x803ba0
+  801bdf:	68 dc 00 00 00       	push   $0xdc
+  801be4:	68 b5 3b 80 00       	push   $0x803bb5
+  801be9:	e8 0e 13 00 00       	call   802efc <_panic>
+	assert(r <= PGSIZE);
+  801bee:	68 d1 3b 80 00       	push   $0x803bd1
+  801bf3:	68 a0 3b 80 00       	push   $0x803ba0
+  801bf8:	68 dd 00 00 00       	push   $0xdd
+  801bfd:	68 b5 3b 80 00       	push   $0x803bb5
+  801c02:	e8 f5 12 00 00       	call   802efc <_panic>
+
+00801c07 <devfile_read>:
+{
+  801c07:	55                   	push   %ebp
+  801c08:	89 e5                	mov    %esp,%ebp
+  801c0a:	57                   	push   %edi
+  801c0b:	56                   	push   %esi
+  801c0c:	53                   	push   %ebx
+  801c0d:	83 ec 28             	sub    $0x28,%esp
+  801c10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c13:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801c16:	53                   	push   %ebx
+  801c17:	e8 35 f3 ff ff       	call   800f51 <fd2data>
+  801c1c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801c1f:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801c22:	83 c4 10             	add    $0x10,%esp
+  801c25:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801c29:	74 7d                	je     801ca8 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801c2b:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801c2f:	0f 85 81 00 00 00    	jne    801cb6 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801c35:	8b 43 18             	mov    0x18(%ebx),%eax
+  801c38:	85 c0                	test   %eax,%eax
+  801c3a:	74 0d                	je     801c49 <devfile_read+0x42>
+  801c3c:	8b 53 14             	mov    0x14(%ebx),%edx
+  801c3f:	39 fa                	cmp    %edi,%edx
+  801c41:	7f 06                	jg     801c49 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801c43:	01 c2                	add    %eax,%edx
+  801c45:	39 d7                	cmp    %edx,%edi
+  801c47:	72 28                	jb     801c71 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801c49:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801c50:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801c56:	77 74                	ja     801ccc <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801c58:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801c5d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c60:	89 d8                	mov    %ebx,%eax
+  801c62:	e8 a5 fe ff ff       	call   801b0c <file_read_direct>
+  801c67:	85 c0                	test   %eax,%eax
+  801c69:	7e 35                	jle    801ca0 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801c6b:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801c6e:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801c71:	8b 53 14             	mov    0x14(%ebx),%edx
+  801c74:	89 d0                	mov    %edx,%eax
+  801c76:	03 43 18             	add    0x18(%ebx),%eax
+  801c79:	29 f8                	sub    %edi,%eax
+  801c7b:	39 f0                	cmp    %esi,%eax
+  801c7d:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801c80:	83 ec 04             	sub    $0x4,%esp
+  801c83:	56                   	push   %esi
+  801c84:	89 f8                	mov    %edi,%eax
+  801c86:	29 d0                	sub    %edx,%eax
+  801c88:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801c8b:	01 c1                	add    %eax,%ecx
+  801c8d:	51                   	push   %ecx
+  801c8e:	ff 75 0c             	push   0xc(%ebp)
+  801c91:	e8 24 ec ff ff       	call   8008ba <memmove>
+	fd->fd_offset = pos + n;
+  801c96:	01 f7                	add    %esi,%edi
+  801c98:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801c9b:	89 f0                	mov    %esi,%eax
+  801c9d:	83 c4 10             	add    $0x10,%esp
+}
+  801ca0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ca3:	5b                   	pop    %ebx
+  801ca4:	5e                   	pop    %esi
+  801ca5:	5f                   	pop    %edi
+  801ca6:	5d                   	pop    %ebp
+  801ca7:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801ca8:	89 f1                	mov    %esi,%ecx
+  801caa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cad:	89 d8                	mov    %ebx,%eax
+  801caf:	e8 58 fe ff ff       	call   801b0c <file_read_direct>
+  801cb4:	eb ea                	jmp    801ca0 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801cb6:	83 ec 0c             	sub    $0xc,%esp
+  801cb9:	53                   	push   %ebx
+  801cba:	e8 db fa ff ff       	call   80179a <devfile_sync>
+  801cbf:	83 c4 10             	add    $0x10,%esp
+  801cc2:	85 c0                	test   %eax,%eax
+  801cc4:	0f 89 6b ff ff ff    	jns    801c35 <devfile_read+0x2e>
+  801cca:	eb d4                	jmp    801ca0 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801ccc:	89 f1                	mov    %esi,%ecx
+  801cce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cd1:	89 d8                	mov    %ebx,%eax
+  801cd3:	e8 34 fe ff ff       	call   801b0c <file_read_direct>
+  801cd8:	eb c6                	jmp    801ca0 <devfile_read+0x99>
+
+00801cda <open>:
+{
+  801cda:	55                   	push   %ebp
+  801cdb:	89 e5                	mov    %esp,%ebp
+  801cdd:	56                   	push   %esi
+  801cde:	53                   	push   %ebx
+  801cdf:	83 ec 1c             	sub    $0x1c,%esp
+  801ce2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ce5:	56                   	push   %esi
+  801ce6:	e8 0e ea ff ff       	call   8006f9 <strlen>
+  801ceb:	83 c4 10             	add    $0x10,%esp
+  801cee:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cf3:	0f 8f a0 00 00 00    	jg     801d99 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801cf9:	83 ec 0c             	sub    $0xc,%esp
+  801cfc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cff:	50                   	push   %eax
+  801d00:	e8 63 f2 ff ff       	call   800f68 <fd_alloc>
+  801d05:	89 c3                	mov    %eax,%ebx
+  801d07:	83 c4 10             	add    $0x10,%esp
+  801d0a:	85 c0                	test   %eax,%eax
+  801d0c:	78 45                	js     801d53 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801d0e:	83 ec 08             	sub    $0x8,%esp
+  801d11:	56                   	push   %esi
+  801d12:	68 00 60 80 00       	push   $0x806000
+  801d17:	e8 18 ea ff ff       	call   800734 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d1f:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d24:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d27:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d2c:	e8 c5 f9 ff ff       	call   8016f6 <fsipc>
+  801d31:	89 c3                	mov    %eax,%ebx
+  801d33:	83 c4 10             	add    $0x10,%esp
+  801d36:	85 c0                	test   %eax,%eax
+  801d38:	78 22                	js     801d5c <open+0x82>
+	if (!(mode & O_NOBUF)
+  801d3a:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801d41:	74 2b                	je     801d6e <open+0x94>
+	return fd2num(fd);
+  801d43:	83 ec 0c             	sub    $0xc,%esp
+  801d46:	ff 75 f4             	push   -0xc(%ebp)
+  801d49:	e8 f3 f1 ff ff       	call   800f41 <fd2num>
+  801d4e:	89 c3                	mov    %eax,%ebx
+  801d50:	83 c4 10             	add    $0x10,%esp
+}
+  801d53:	89 d8                	mov    %ebx,%eax
+  801d55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d58:	5b                   	pop    %ebx
+  801d59:	5e                   	pop    %esi
+  801d5a:	5d                   	pop    %ebp
+  801d5b:	c3                   	ret
+		fd_close(fd, 0);
+  801d5c:	83 ec 08             	sub    $0x8,%esp
+  801d5f:	6a 00                	push   $0x0
+  801d61:	ff 75 f4             	push   -0xc(%ebp)
+  801d64:	e8 f8 f2 ff ff       	call   801061 <fd_close>
+		return r;
+  801d69:	83 c4 10             	add    $0x10,%esp
+  801d6c:	eb e5                	jmp    801d53 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801d6e:	83 ec 0c             	sub    $0xc,%esp
+  801d71:	ff 75 f4             	push   -0xc(%ebp)
+  801d74:	e8 d8 f1 ff ff       	call   800f51 <fd2data>
+  801d79:	83 c4 0c             	add    $0xc,%esp
+  801d7c:	68 07 04 00 00       	push   $0x407
+  801d81:	50                   	push   %eax
+  801d82:	6a 00                	push   $0x0
+  801d84:	e8 b7 ed ff ff       	call   800b40 <sys_page_alloc>
+  801d89:	83 c4 10             	add    $0x10,%esp
+  801d8c:	85 c0                	test   %eax,%eax
+  801d8e:	75 b3                	jne    801d43 <open+0x69>
+		fd->fd_file.buffered = 1;
+  801d90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d93:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801d97:	eb aa                	jmp    801d43 <open+0x69>
+		return -E_BAD_PATH;
+  801d99:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d9e:	eb b3                	jmp    801d53 <open+0x79>
+
+00801da0 <readdir>:
+{
+  801da0:	55                   	push   %ebp
+  801da1:	89 e5                	mov    %esp,%ebp
+  801da3:	53                   	push   %ebx
+  801da4:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801da7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801daa:	50                   	push   %eax
+  801dab:	ff 75 08             	push   0x8(%ebp)
+  801dae:	e8 0b f2 ff ff       	call   800fbe <fd_lookup>
+  801db3:	89 c3                	mov    %eax,%ebx
+  801db5:	83 c4 10             	add    $0x10,%esp
+  801db8:	85 c0                	test   %eax,%eax
+  801dba:	78 73                	js     801e2f <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801dbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dbf:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801dc5:	39 08                	cmp    %ecx,(%eax)
+  801dc7:	0f 85 82 00 00 00    	jne    801e4f <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801dcd:	83 ec 0c             	sub    $0xc,%esp
+  801dd0:	50                   	push   %eax
+  801dd1:	e8 c4 f9 ff ff       	call   80179a <devfile_sync>
+  801dd6:	89 c3                	mov    %eax,%ebx
+  801dd8:	83 c4 10             	add    $0x10,%esp
+  801ddb:	85 c0                	test   %eax,%eax
+  801ddd:	78 50                	js     801e2f <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801ddf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801de2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801de5:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801dea:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ded:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801df2:	8b 45 14             	mov    0x14(%ebp),%eax
+  801df5:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801dfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dff:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e04:	e8 ed f8 ff ff       	call   8016f6 <fsipc>
+  801e09:	89 c3                	mov    %eax,%ebx
+  801e0b:	85 c0                	test   %eax,%eax
+  801e0d:	7e 20                	jle    801e2f <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801e0f:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801e12:	72 22                	jb     801e36 <readdir+0x96>
+  801e14:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e19:	7f 1b                	jg     801e36 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e1b:	83 ec 04             	sub    $0x4,%esp
+  801e1e:	50                   	push   %eax
+  801e1f:	68 00 60 80 00       	push   $0x806000
+  801e24:	ff 75 0c             	push   0xc(%ebp)
+  801e27:	e8 8e ea ff ff       	call   8008ba <memmove>
+	return r;
+  801e2c:	83 c4 10             	add    $0x10,%esp
+}
+  801e2f:	89 d8                	mov    %ebx,%eax
+  801e31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e34:	c9                   	leave
+  801e35:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801e36:	68 c7 3b 80 00       	push   $0x803bc7
+  801e3b:	68 a0 3b 80 00       	push   $0x803ba0
+  801e40:	68 86 01 00 00       	push   $0x186
+  801e45:	68 b5 3b 80 00       	push   $0x803bb5
+  801e4a:	e8 ad 10 00 00       	call   802efc <_panic>
+		return -E_NOT_SUPP;
+  801e4f:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801e54:	eb d9                	jmp    801e2f <readdir+0x8f>
+
+00801e56 <munmap>:
+{
+  801e56:	55                   	push   %ebp
+  801e57:	89 e5                	mov    %esp,%ebp
+  801e59:	56                   	push   %esi
+  801e5a:	53                   	push   %ebx
+  801e5b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801e61:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801e67:	75 41                	jne    801eaa <munmap+0x54>
+  801e69:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801e6f:	77 39                	ja     801eaa <munmap+0x54>
+  801e71:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801e76:	29 f0                	sub    %esi,%eax
+  801e78:	39 d0                	cmp    %edx,%eax
+  801e7a:	72 35                	jb     801eb1 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801e7c:	89 f3                	mov    %esi,%ebx
+  801e7e:	01 d6                	add    %edx,%esi
+  801e80:	39 f3                	cmp    %esi,%ebx
+  801e82:	73 1a                	jae    801e9e <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801e84:	83 ec 08             	sub    $0x8,%esp
+  801e87:	53                   	push   %ebx
+  801e88:	6a 00                	push   $0x0
+  801e8a:	e8 3e ed ff ff       	call   800bcd <sys_page_unmap>
+  801e8f:	83 c4 10             	add    $0x10,%esp
+  801e92:	85 c0                	test   %eax,%eax
+  801e94:	78 0d                	js     801ea3 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801e96:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e9c:	eb e2                	jmp    801e80 <munmap+0x2a>
+	return 0;
+  801e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ea3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ea6:	5b                   	pop    %ebx
+  801ea7:	5e                   	pop    %esi
+  801ea8:	5d                   	pop    %ebp
+  801ea9:	c3                   	ret
+		return -E_INVAL;
+  801eaa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eaf:	eb f2                	jmp    801ea3 <munmap+0x4d>
+  801eb1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eb6:	eb eb                	jmp    801ea3 <munmap+0x4d>
+
+00801eb8 <mmap>:
+{
+  801eb8:	55                   	push   %ebp
+  801eb9:	89 e5                	mov    %esp,%ebp
+  801ebb:	57                   	push   %edi
+  801ebc:	56                   	push   %esi
+  801ebd:	53                   	push   %ebx
+  801ebe:	83 ec 34             	sub    $0x34,%esp
+  801ec1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ec4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ec7:	50                   	push   %eax
+  801ec8:	ff 75 18             	push   0x18(%ebp)
+  801ecb:	e8 ee f0 ff ff       	call   800fbe <fd_lookup>
+  801ed0:	89 c3                	mov    %eax,%ebx
+  801ed2:	83 c4 10             	add    $0x10,%esp
+  801ed5:	85 c0                	test   %eax,%eax
+  801ed7:	0f 88 0e 01 00 00    	js     801feb <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801edd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ee0:	a1 20 40 80 00       	mov    0x804020,%eax
+  801ee5:	39 02                	cmp    %eax,(%edx)
+  801ee7:	0f 85 50 01 00 00    	jne    80203d <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801eed:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ef0:	83 e0 02             	and    $0x2,%eax
+  801ef3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801ef6:	74 0a                	je     801f02 <mmap+0x4a>
+  801ef8:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801efc:	0f 84 42 01 00 00    	je     802044 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801f02:	8b 42 08             	mov    0x8(%edx),%eax
+  801f05:	83 e0 03             	and    $0x3,%eax
+  801f08:	83 f8 01             	cmp    $0x1,%eax
+  801f0b:	0f 84 3a 01 00 00    	je     80204b <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  801f11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f14:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801f17:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f1c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801f1f:	0f 85 2d 01 00 00    	jne    802052 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801f25:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801f29:	0f 88 2a 01 00 00    	js     802059 <mmap+0x1a1>
+  801f2f:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  801f36:	0f 87 1d 01 00 00    	ja     802059 <mmap+0x1a1>
+  801f3c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f41:	2b 45 08             	sub    0x8(%ebp),%eax
+  801f44:	39 f8                	cmp    %edi,%eax
+  801f46:	0f 82 14 01 00 00    	jb     802060 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  801f4c:	83 ec 0c             	sub    $0xc,%esp
+  801f4f:	52                   	push   %edx
+  801f50:	e8 45 f8 ff ff       	call   80179a <devfile_sync>
+  801f55:	89 c3                	mov    %eax,%ebx
+  801f57:	83 c4 10             	add    $0x10,%esp
+  801f5a:	85 c0                	test   %eax,%eax
+  801f5c:	0f 88 89 00 00 00    	js     801feb <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  801f62:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  801f68:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801f6e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f73:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  801f76:	39 fe                	cmp    %edi,%esi
+  801f78:	73 7b                	jae    801ff5 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  801f7a:	89 f8                	mov    %edi,%eax
+  801f7c:	29 f0                	sub    %esi,%eax
+  801f7e:	c1 e8 0c             	shr    $0xc,%eax
+  801f81:	ba 40 00 00 00       	mov    $0x40,%edx
+  801f86:	39 d0                	cmp    %edx,%eax
+  801f88:	0f 47 c2             	cmova  %edx,%eax
+  801f8b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801f8e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f91:	8b 52 0c             	mov    0xc(%edx),%edx
+  801f94:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  801f9a:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  801f9d:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  801fa3:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  801fa8:	89 f2                	mov    %esi,%edx
+  801faa:	03 55 08             	add    0x8(%ebp),%edx
+  801fad:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  801fb0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801fb5:	e8 ea f6 ff ff       	call   8016a4 <fsipcv>
+  801fba:	85 c0                	test   %eax,%eax
+  801fbc:	7e 12                	jle    801fd0 <mmap+0x118>
+  801fbe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801fc1:	85 c0                	test   %eax,%eax
+  801fc3:	0f 84 9e 00 00 00    	je     802067 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801fc9:	c1 e0 0c             	shl    $0xc,%eax
+  801fcc:	01 c6                	add    %eax,%esi
+  801fce:	eb a6                	jmp    801f76 <mmap+0xbe>
+			munmap(addr, done);
+  801fd0:	89 c3                	mov    %eax,%ebx
+  801fd2:	83 ec 08             	sub    $0x8,%esp
+  801fd5:	56                   	push   %esi
+  801fd6:	ff 75 08             	push   0x8(%ebp)
+  801fd9:	e8 78 fe ff ff       	call   801e56 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  801fde:	83 c4 10             	add    $0x10,%esp
+  801fe1:	85 db                	test   %ebx,%ebx
+  801fe3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fe8:	0f 49 d8             	cmovns %eax,%ebx
+}
+  801feb:	89 d8                	mov    %ebx,%eax
+  801fed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff0:	5b                   	pop    %ebx
+  801ff1:	5e                   	pop    %esi
+  801ff2:	5f                   	pop    %edi
+  801ff3:	5d                   	pop    %ebp
+  801ff4:	c3                   	ret
+	if (prot & PROT_WRITE)
+  801ff5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  801ff8:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  801ffa:	85 c0                	test   %eax,%eax
+  801ffc:	74 ed                	je     801feb <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  801ffe:	be 00 00 00 00       	mov    $0x0,%esi
+  802003:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802006:	39 fe                	cmp    %edi,%esi
+  802008:	73 2e                	jae    802038 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80200a:	83 ec 0c             	sub    $0xc,%esp
+  80200d:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802010:	50                   	push   %eax
+  802011:	e8 43 10 00 00       	call   803059 <cowpage>
+  802016:	83 c4 10             	add    $0x10,%esp
+  802019:	85 c0                	test   %eax,%eax
+  80201b:	78 08                	js     802025 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  80201d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802023:	eb e1                	jmp    802006 <mmap+0x14e>
+				munmap(addr, len);
+  802025:	89 c3                	mov    %eax,%ebx
+  802027:	83 ec 08             	sub    $0x8,%esp
+  80202a:	57                   	push   %edi
+  80202b:	ff 75 08             	push   0x8(%ebp)
+  80202e:	e8 23 fe ff ff       	call   801e56 <munmap>
+				return r;
+  802033:	83 c4 10             	add    $0x10,%esp
+  802036:	eb b3                	jmp    801feb <mmap+0x133>
+	return 0;
+  802038:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80203b:	eb ae                	jmp    801feb <mmap+0x133>
+		return -E_NOT_SUPP;
+  80203d:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802042:	eb a7                	jmp    801feb <mmap+0x133>
+		return -E_NOT_SUPP;
+  802044:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802049:	eb a0                	jmp    801feb <mmap+0x133>
+		return -E_INVAL;
+  80204b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802050:	eb 99                	jmp    801feb <mmap+0x133>
+  802052:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802057:	eb 92                	jmp    801feb <mmap+0x133>
+  802059:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80205e:	eb 8b                	jmp    801feb <mmap+0x133>
+  802060:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802065:	eb 84                	jmp    801feb <mmap+0x133>
+			munmap(addr, done);
+  802067:	83 ec 08             	sub    $0x8,%esp
+  80206a:	56                   	push   %esi
+  80206b:	ff 75 08             	push   0x8(%ebp)
+  80206e:	e8 e3 fd ff ff       	call   801e56 <munmap>
+  802073:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802076:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80207b:	e9 6b ff ff ff       	jmp    801feb <mmap+0x133>
+
+00802080 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802080:	55                   	push   %ebp
+  802081:	89 e5                	mov    %esp,%ebp
+  802083:	56                   	push   %esi
+  802084:	53                   	push   %ebx
+  802085:	83 ec 10             	sub    $0x10,%esp
+  802088:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80208b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80208e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802091:	e8 3d f9 ff ff       	call   8019d3 <fsring_slot>
+  802096:	85 c0                	test   %eax,%eax
+  802098:	78 60                	js     8020fa <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80209a:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80209d:	8b 56 08             	mov    0x8(%esi),%edx
+  8020a0:	83 e2 03             	and    $0x3,%edx
+  8020a3:	83 fa 01             	cmp    $0x1,%edx
+  8020a6:	74 59                	je     802101 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8020a8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8020ad:	89 c1                	mov    %eax,%ecx
+  8020af:	d3 e2                	shl    %cl,%edx
+  8020b1:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8020b7:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8020ba:	c1 e2 02             	shl    $0x2,%edx
+  8020bd:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8020c3:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  8020ca:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8020cd:	8b 55 18             	mov    0x18(%ebp),%edx
+  8020d0:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8020d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020d6:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8020d9:	83 ec 08             	sub    $0x8,%esp
+  8020dc:	50                   	push   %eax
+  8020dd:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8020e2:	39 c3                	cmp    %eax,%ebx
+  8020e4:	0f 47 d8             	cmova  %eax,%ebx
+  8020e7:	53                   	push   %ebx
+  8020e8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8020eb:	89 f2                	mov    %esi,%edx
+  8020ed:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020f2:	e8 1e f5 ff ff       	call   801615 <fsring_post>
+  8020f7:	83 c4 10             	add    $0x10,%esp
+}
+  8020fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020fd:	5b                   	pop    %ebx
+  8020fe:	5e                   	pop    %esi
+  8020ff:	5d                   	pop    %ebp
+  802100:	c3                   	ret
+		return -E_INVAL;
+  802101:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802106:	eb f2                	jmp    8020fa <fsring_read+0x7a>
+
+00802108 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802108:	55                   	push   %ebp
+  802109:	89 e5                	mov    %esp,%ebp
+  80210b:	56                   	push   %esi
+  80210c:	53                   	push   %ebx
+  80210d:	83 ec 10             	sub    $0x10,%esp
+  802110:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802113:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802116:	8b 45 08             	mov    0x8(%ebp),%eax
+  802119:	e8 b5 f8 ff ff       	call   8019d3 <fsring_slot>
+  80211e:	89 c3                	mov    %eax,%ebx
+  802120:	85 c0                	test   %eax,%eax
+  802122:	78 77                	js     80219b <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802124:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802127:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80212b:	74 77                	je     8021a4 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80212d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802132:	39 c6                	cmp    %eax,%esi
+  802134:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802137:	83 ec 04             	sub    $0x4,%esp
+  80213a:	56                   	push   %esi
+  80213b:	ff 75 0c             	push   0xc(%ebp)
+  80213e:	89 d8                	mov    %ebx,%eax
+  802140:	c1 e0 0c             	shl    $0xc,%eax
+  802143:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802149:	50                   	push   %eax
+  80214a:	e8 6b e7 ff ff       	call   8008ba <memmove>
+	fsring_busy |= 1 << slot;
+  80214f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802154:	89 d9                	mov    %ebx,%ecx
+  802156:	d3 e0                	shl    %cl,%eax
+  802158:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  80215e:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802161:	c1 e0 02             	shl    $0x2,%eax
+  802164:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  80216a:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  802171:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802174:	8b 45 18             	mov    0x18(%ebp),%eax
+  802177:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80217a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802181:	83 c4 08             	add    $0x8,%esp
+  802184:	53                   	push   %ebx
+  802185:	56                   	push   %esi
+  802186:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802189:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80218c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802191:	e8 7f f4 ff ff       	call   801615 <fsring_post>
+  802196:	89 c3                	mov    %eax,%ebx
+  802198:	83 c4 10             	add    $0x10,%esp
+}
+  80219b:	89 d8                	mov    %ebx,%eax
+  80219d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021a0:	5b                   	pop    %ebx
+  8021a1:	5e                   	pop    %esi
+  8021a2:	5d                   	pop    %ebp
+  8021a3:	c3                   	ret
+		return -E_INVAL;
+  8021a4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021a9:	eb f0                	jmp    80219b <fsring_write+0x93>
+
+008021ab <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8021ab:	55                   	push   %ebp
+  8021ac:	89 e5                	mov    %esp,%ebp
+  8021ae:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8021b1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b7:	e8 17 f8 ff ff       	call   8019d3 <fsring_slot>
+  8021bc:	85 c0                	test   %eax,%eax
+  8021be:	78 4c                	js     80220c <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8021c0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8021c5:	89 c1                	mov    %eax,%ecx
+  8021c7:	d3 e2                	shl    %cl,%edx
+  8021c9:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8021cf:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8021d2:	c1 e2 02             	shl    $0x2,%edx
+  8021d5:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8021db:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  8021e2:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8021e5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021e8:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8021eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021ee:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  8021f1:	83 ec 08             	sub    $0x8,%esp
+  8021f4:	50                   	push   %eax
+  8021f5:	6a 00                	push   $0x0
+  8021f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021fc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021ff:	b8 05 00 00 00       	mov    $0x5,%eax
+  802204:	e8 0c f4 ff ff       	call   801615 <fsring_post>
+  802209:	83 c4 10             	add    $0x10,%esp
+}
+  80220c:	c9                   	leave
+  80220d:	c3                   	ret
+
+0080220e <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  80220e:	55                   	push   %ebp
+  80220f:	89 e5                	mov    %esp,%ebp
+  802211:	57                   	push   %edi
+  802212:	56                   	push   %esi
+  802213:	53                   	push   %ebx
+  802214:	83 ec 1c             	sub    $0x1c,%esp
+  802217:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80221b:	a1 00 50 80 00       	mov    0x805000,%eax
+  802220:	8b 40 48             	mov    0x48(%eax),%eax
+  802223:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  802229:	74 12                	je     80223d <fsring_reap+0x2f>
+		return 0;
+  80222b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802230:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802233:	5b                   	pop    %ebx
+  802234:	5e                   	pop    %esi
+  802235:	5f                   	pop    %edi
+  802236:	5d                   	pop    %ebp
+  802237:	c3                   	ret
+		sys_yield();
+  802238:	e8 e4 e8 ff ff       	call   800b21 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  80223d:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802243:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802248:	39 c2                	cmp    %eax,%edx
+  80224a:	75 18                	jne    802264 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  80224c:	84 db                	test   %bl,%bl
+  80224e:	0f 84 21 01 00 00    	je     802375 <fsring_reap+0x167>
+  802254:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  80225b:	75 db                	jne    802238 <fsring_reap+0x2a>
+			return 0;
+  80225d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802262:	eb cc                	jmp    802230 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802264:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802269:	83 e0 0f             	and    $0xf,%eax
+  80226c:	83 c0 2a             	add    $0x2a,%eax
+  80226f:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802276:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  80227d:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802282:	83 c0 01             	add    $0x1,%eax
+  802285:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  80228a:	83 fb 0f             	cmp    $0xf,%ebx
+  80228d:	77 5b                	ja     8022ea <fsring_reap+0xdc>
+  80228f:	be 01 00 00 00       	mov    $0x1,%esi
+  802294:	89 d9                	mov    %ebx,%ecx
+  802296:	d3 e6                	shl    %cl,%esi
+  802298:	89 f0                	mov    %esi,%eax
+  80229a:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8022a0:	74 48                	je     8022ea <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8022a2:	89 d8                	mov    %ebx,%eax
+  8022a4:	c1 e0 0c             	shl    $0xc,%eax
+  8022a7:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8022ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8022b0:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8022b3:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  8022ba:	83 f8 03             	cmp    $0x3,%eax
+  8022bd:	74 40                	je     8022ff <fsring_reap+0xf1>
+  8022bf:	83 f8 05             	cmp    $0x5,%eax
+  8022c2:	74 64                	je     802328 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8022c4:	f7 d6                	not    %esi
+  8022c6:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8022cc:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8022cf:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  8022d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d9:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8022db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022de:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8022e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022e5:	e9 46 ff ff ff       	jmp    802230 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8022ea:	53                   	push   %ebx
+  8022eb:	68 dd 3b 80 00       	push   $0x803bdd
+  8022f0:	68 8f 02 00 00       	push   $0x28f
+  8022f5:	68 b5 3b 80 00       	push   $0x803bb5
+  8022fa:	e8 fd 0b 00 00       	call   802efc <_panic>
+		if (cqe.cqe_result > 0)
+  8022ff:	85 ff                	test   %edi,%edi
+  802301:	7e c1                	jle    8022c4 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802303:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802306:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80230b:	39 c7                	cmp    %eax,%edi
+  80230d:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802310:	50                   	push   %eax
+  802311:	ff 75 e4             	push   -0x1c(%ebp)
+  802314:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802317:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  80231e:	e8 97 e5 ff ff       	call   8008ba <memmove>
+  802323:	83 c4 10             	add    $0x10,%esp
+  802326:	eb 9c                	jmp    8022c4 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802328:	85 ff                	test   %edi,%edi
+  80232a:	75 98                	jne    8022c4 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80232c:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80232f:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802336:	83 ec 08             	sub    $0x8,%esp
+  802339:	ff 75 e4             	push   -0x1c(%ebp)
+  80233c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80233f:	51                   	push   %ecx
+  802340:	e8 ef e3 ff ff       	call   800734 <strcpy>
+			st->st_size = ret->ret_size;
+  802345:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802348:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  80234e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802351:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802357:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  80235d:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802363:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  80236a:	40 80 00 
+  80236d:	83 c4 10             	add    $0x10,%esp
+  802370:	e9 4f ff ff ff       	jmp    8022c4 <fsring_reap+0xb6>
+			return 0;
+  802375:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237a:	e9 b1 fe ff ff       	jmp    802230 <fsring_reap+0x22>
+
+0080237f <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  80237f:	55                   	push   %ebp
+  802380:	89 e5                	mov    %esp,%ebp
+  802382:	57                   	push   %edi
+  802383:	56                   	push   %esi
+  802384:	53                   	push   %ebx
+  802385:	83 ec 28             	sub    $0x28,%esp
+  802388:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80238b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80238e:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802391:	53                   	push   %ebx
+  802392:	e8 62 e3 ff ff       	call   8006f9 <strlen>
+  802397:	83 c4 10             	add    $0x10,%esp
+  80239a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80239f:	0f 8f 02 01 00 00    	jg     8024a7 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8023a5:	83 ec 08             	sub    $0x8,%esp
+  8023a8:	53                   	push   %ebx
+  8023a9:	68 00 60 80 00       	push   $0x806000
+  8023ae:	e8 81 e3 ff ff       	call   800734 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8023b3:	83 c4 10             	add    $0x10,%esp
+  8023b6:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8023bc:	76 69                	jbe    802427 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8023be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023c1:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8023c7:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8023cc:	29 d1                	sub    %edx,%ecx
+  8023ce:	39 f9                	cmp    %edi,%ecx
+  8023d0:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8023d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023d6:	89 f9                	mov    %edi,%ecx
+  8023d8:	01 c1                	add    %eax,%ecx
+  8023da:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8023dd:	eb 0f                	jmp    8023ee <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  8023df:	0f b6 10             	movzbl (%eax),%edx
+  8023e2:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8023e4:	05 00 10 00 00       	add    $0x1000,%eax
+  8023e9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8023ee:	39 c8                	cmp    %ecx,%eax
+  8023f0:	72 ed                	jb     8023df <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  8023f2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8023f5:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  8023fb:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802401:	83 ec 0c             	sub    $0xc,%esp
+  802404:	6a 07                	push   $0x7
+  802406:	89 f9                	mov    %edi,%ecx
+  802408:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80240b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802410:	e8 3f f1 ff ff       	call   801554 <fsipc_pages>
+  802415:	89 c7                	mov    %eax,%edi
+  802417:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  80241a:	85 f6                	test   %esi,%esi
+  80241c:	74 7f                	je     80249d <file_slurp+0x11e>
+  80241e:	8d 43 01             	lea    0x1(%ebx),%eax
+  802421:	85 ff                	test   %edi,%edi
+  802423:	79 3c                	jns    802461 <file_slurp+0xe2>
+  802425:	eb 76                	jmp    80249d <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802427:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  80242d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802432:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802437:	e8 ba f2 ff ff       	call   8016f6 <fsipc>
+  80243c:	89 c7                	mov    %eax,%edi
+  80243e:	85 c0                	test   %eax,%eax
+  802440:	7e d8                	jle    80241a <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802442:	83 ec 04             	sub    $0x4,%esp
+  802445:	50                   	push   %eax
+  802446:	68 08 60 80 00       	push   $0x806008
+  80244b:	ff 75 0c             	push   0xc(%ebp)
+  80244e:	e8 67 e4 ff ff       	call   8008ba <memmove>
+  802453:	83 c4 10             	add    $0x10,%esp
+  802456:	eb c2                	jmp    80241a <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802458:	80 fa 2f             	cmp    $0x2f,%dl
+  80245b:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  80245e:	83 c0 01             	add    $0x1,%eax
+  802461:	89 c1                	mov    %eax,%ecx
+  802463:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802467:	84 d2                	test   %dl,%dl
+  802469:	75 ed                	jne    802458 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  80246b:	83 ec 04             	sub    $0x4,%esp
+  80246e:	68 80 00 00 00       	push   $0x80
+  802473:	53                   	push   %ebx
+  802474:	56                   	push   %esi
+  802475:	e8 30 e3 ff ff       	call   8007aa <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  80247a:	a1 00 60 80 00       	mov    0x806000,%eax
+  80247f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802485:	a1 04 60 80 00       	mov    0x806004,%eax
+  80248a:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802490:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  802497:	40 80 00 
+  80249a:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80249d:	89 f8                	mov    %edi,%eax
+  80249f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024a2:	5b                   	pop    %ebx
+  8024a3:	5e                   	pop    %esi
+  8024a4:	5f                   	pop    %edi
+  8024a5:	5d                   	pop    %ebp
+  8024a6:	c3                   	ret
+		return -E_BAD_PATH;
+  8024a7:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8024ac:	eb ef                	jmp    80249d <file_slurp+0x11e>
+
+008024ae <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8024ae:	55                   	push   %ebp
+  8024af:	89 e5                	mov    %esp,%ebp
+  8024b1:	53                   	push   %ebx
+  8024b2:	83 ec 10             	sub    $0x10,%esp
+  8024b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8024b8:	53                   	push   %ebx
+  8024b9:	e8 3b e2 ff ff       	call   8006f9 <strlen>
+  8024be:	83 c4 10             	add    $0x10,%esp
+  8024c1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024c6:	7f 25                	jg     8024ed <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8024c8:	83 ec 08             	sub    $0x8,%esp
+  8024cb:	53                   	push   %ebx
+  8024cc:	68 00 60 80 00       	push   $0x806000
+  8024d1:	e8 5e e2 ff ff       	call   800734 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8024d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024db:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024e0:	e8 11 f2 ff ff       	call   8016f6 <fsipc>
+  8024e5:	83 c4 10             	add    $0x10,%esp
+}
+  8024e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024eb:	c9                   	leave
+  8024ec:	c3                   	ret
+		return -E_BAD_PATH;
+  8024ed:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8024f2:	eb f4                	jmp    8024e8 <remove+0x3a>
+
+008024f4 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8024f4:	55                   	push   %ebp
+  8024f5:	89 e5                	mov    %esp,%ebp
+  8024f7:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8024fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ff:	b8 08 00 00 00       	mov    $0x8,%eax
+  802504:	e8 ed f1 ff ff       	call   8016f6 <fsipc>
+}
+  802509:	c9                   	leave
+  80250a:	c3                   	ret
+
+0080250b <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  80250b:	55                   	push   %ebp
+  80250c:	89 e5                	mov    %esp,%ebp
+  80250e:	57                   	push   %edi
+  80250f:	56                   	push   %esi
+  802510:	53                   	push   %ebx
+  802511:	83 ec 18             	sub    $0x18,%esp
+  802514:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802517:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80251a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80251d:	57                   	push   %edi
+  80251e:	e8 d6 e1 ff ff       	call   8006f9 <strlen>
+  802523:	83 c4 10             	add    $0x10,%esp
+  802526:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80252b:	7f 4c                	jg     802579 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  80252d:	83 ec 08             	sub    $0x8,%esp
+  802530:	57                   	push   %edi
+  802531:	68 00 60 80 00       	push   $0x806000
+  802536:	e8 f9 e1 ff ff       	call   800734 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  80253b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802540:	b8 10 00 00 00       	mov    $0x10,%eax
+  802545:	e8 ac f1 ff ff       	call   8016f6 <fsipc>
+  80254a:	83 c4 10             	add    $0x10,%esp
+  80254d:	85 c0                	test   %eax,%eax
+  80254f:	78 20                	js     802571 <defrag+0x66>
+		return r;
+	if (before)
+  802551:	85 f6                	test   %esi,%esi
+  802553:	74 07                	je     80255c <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802555:	a1 00 60 80 00       	mov    0x806000,%eax
+  80255a:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  80255c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802561:	85 db                	test   %ebx,%ebx
+  802563:	74 0c                	je     802571 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802565:	a1 04 60 80 00       	mov    0x806004,%eax
+  80256a:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  80256c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802571:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802574:	5b                   	pop    %ebx
+  802575:	5e                   	pop    %esi
+  802576:	5f                   	pop    %edi
+  802577:	5d                   	pop    %ebp
+  802578:	c3                   	ret
+		return -E_BAD_PATH;
+  802579:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80257e:	eb f1                	jmp    802571 <defrag+0x66>
+
+00802580 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802580:	55                   	push   %ebp
+  802581:	89 e5                	mov    %esp,%ebp
+  802583:	53                   	push   %ebx
+  802584:	83 ec 04             	sub    $0x4,%esp
+  802587:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  80258a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80258f:	b8 11 00 00 00       	mov    $0x11,%eax
+  802594:	e8 5d f1 ff ff       	call   8016f6 <fsipc>
+  802599:	85 c0                	test   %eax,%eax
+  80259b:	78 34                	js     8025d1 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  80259d:	a1 00 60 80 00       	mov    0x806000,%eax
+  8025a2:	89 03                	mov    %eax,(%ebx)
+  8025a4:	a1 04 60 80 00       	mov    0x806004,%eax
+  8025a9:	89 43 04             	mov    %eax,0x4(%ebx)
+  8025ac:	a1 08 60 80 00       	mov    0x806008,%eax
+  8025b1:	89 43 08             	mov    %eax,0x8(%ebx)
+  8025b4:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  8025b9:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8025bc:	a1 10 60 80 00       	mov    0x806010,%eax
+  8025c1:	89 43 10             	mov    %eax,0x10(%ebx)
+  8025c4:	a1 14 60 80 00       	mov    0x806014,%eax
+  8025c9:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  8025cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025d4:	c9                   	leave
+  8025d5:	c3                   	ret
+
+008025d6 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8025d6:	55                   	push   %ebp
+  8025d7:	89 e5                	mov    %esp,%ebp
+  8025d9:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8025dc:	68 f6 3b 80 00       	push   $0x803bf6
+  8025e1:	ff 75 0c             	push   0xc(%ebp)
+  8025e4:	e8 4b e1 ff ff       	call   800734 <strcpy>
+	return 0;
+}
+  8025e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ee:	c9                   	leave
+  8025ef:	c3                   	ret
+
+008025f0 <devsock_close>:
+{
+  8025f0:	55                   	push   %ebp
+  8025f1:	89 e5                	mov    %esp,%ebp
+  8025f3:	53                   	push   %ebx
+  8025f4:	83 ec 10             	sub    $0x10,%esp
+  8025f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8025fa:	53                   	push   %ebx
+  8025fb:	e8 3a 0e 00 00       	call   80343a <pageref>
+  802600:	89 c2                	mov    %eax,%edx
+  802602:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802605:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80260a:	83 fa 01             	cmp    $0x1,%edx
+  80260d:	74 05                	je     802614 <devsock_close+0x24>
+}
+  80260f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802612:	c9                   	leave
+  802613:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802614:	83 ec 0c             	sub    $0xc,%esp
+  802617:	ff 73 0c             	push   0xc(%ebx)
+  80261a:	e8 b7 02 00 00       	call   8028d6 <nsipc_close>
+  80261f:	83 c4 10             	add    $0x10,%esp
+  802622:	eb eb                	jmp    80260f <devsock_close+0x1f>
+
+00802624 <devsock_write>:
+{
+  802624:	55                   	push   %ebp
+  802625:	89 e5                	mov    %esp,%ebp
+  802627:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80262a:	6a 00                	push   $0x0
+  80262c:	ff 75 10             	push   0x10(%ebp)
+  80262f:	ff 75 0c             	push   0xc(%ebp)
+  802632:	8b 45 08             	mov    0x8(%ebp),%eax
+  802635:	ff 70 0c             	push   0xc(%eax)
+  802638:	e8 79 03 00 00       	call   8029b6 <nsipc_send>
+}
+  80263d:	c9                   	leave
+  80263e:	c3                   	ret
+
+0080263f <devsock_read>:
+{
+  80263f:	55                   	push   %ebp
+  802640:	89 e5                	mov    %esp,%ebp
+  802642:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802645:	6a 00                	push   $0x0
+  802647:	ff 75 10             	push   0x10(%ebp)
+  80264a:	ff 75 0c             	push   0xc(%ebp)
+  80264d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802650:	ff 70 0c             	push   0xc(%eax)
+  802653:	e8 ef 02 00 00       	call   802947 <nsipc_recv>
+}
+  802658:	c9                   	leave
+  802659:	c3                   	ret
+
+0080265a <fd2sockid>:
+{
+  80265a:	55                   	push   %ebp
+  80265b:	89 e5                	mov    %esp,%ebp
+  80265d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802660:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802663:	52                   	push   %edx
+  802664:	50                   	push   %eax
+  802665:	e8 54 e9 ff ff       	call   800fbe <fd_lookup>
+  80266a:	83 c4 10             	add    $0x10,%esp
+  80266d:	85 c0                	test   %eax,%eax
+  80266f:	78 10                	js     802681 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802671:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802674:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  80267a:	39 08                	cmp    %ecx,(%eax)
+  80267c:	75 05                	jne    802683 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80267e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802681:	c9                   	leave
+  802682:	c3                   	ret
+		return -E_NOT_SUPP;
+  802683:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802688:	eb f7                	jmp    802681 <fd2sockid+0x27>
+
+0080268a <alloc_sockfd>:
+{
+  80268a:	55                   	push   %ebp
+  80268b:	89 e5                	mov    %esp,%ebp
+  80268d:	56                   	push   %esi
+  80268e:	53                   	push   %ebx
+  80268f:	83 ec 1c             	sub    $0x1c,%esp
+  802692:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802694:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802697:	50                   	push   %eax
+  802698:	e8 cb e8 ff ff       	call   800f68 <fd_alloc>
+  80269d:	89 c3                	mov    %eax,%ebx
+  80269f:	83 c4 10             	add    $0x10,%esp
+  8026a2:	85 c0                	test   %eax,%eax
+  8026a4:	78 43                	js     8026e9 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8026a6:	83 ec 04             	sub    $0x4,%esp
+  8026a9:	68 07 04 00 00       	push   $0x407
+  8026ae:	ff 75 f4             	push   -0xc(%ebp)
+  8026b1:	6a 00                	push   $0x0
+  8026b3:	e8 88 e4 ff ff       	call   800b40 <sys_page_alloc>
+  8026b8:	89 c3                	mov    %eax,%ebx
+  8026ba:	83 c4 10             	add    $0x10,%esp
+  8026bd:	85 c0                	test   %eax,%eax
+  8026bf:	78 28                	js     8026e9 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8026c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026c4:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  8026ca:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8026cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026cf:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8026d6:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8026d9:	83 ec 0c             	sub    $0xc,%esp
+  8026dc:	50                   	push   %eax
+  8026dd:	e8 5f e8 ff ff       	call   800f41 <fd2num>
+  8026e2:	89 c3                	mov    %eax,%ebx
+  8026e4:	83 c4 10             	add    $0x10,%esp
+  8026e7:	eb 0c                	jmp    8026f5 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8026e9:	83 ec 0c             	sub    $0xc,%esp
+  8026ec:	56                   	push   %esi
+  8026ed:	e8 e4 01 00 00       	call   8028d6 <nsipc_close>
+		return r;
+  8026f2:	83 c4 10             	add    $0x10,%esp
+}
+  8026f5:	89 d8                	mov    %ebx,%eax
+  8026f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026fa:	5b                   	pop    %ebx
+  8026fb:	5e                   	pop    %esi
+  8026fc:	5d                   	pop    %ebp
+  8026fd:	c3                   	ret
+
+008026fe <accept>:
+{
+  8026fe:	55                   	push   %ebp
+  8026ff:	89 e5                	mov    %esp,%ebp
+  802701:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802704:	8b 45 08             	mov    0x8(%ebp),%eax
+  802707:	e8 4e ff ff ff       	call   80265a <fd2sockid>
+  80270c:	85 c0                	test   %eax,%eax
+  80270e:	78 1b                	js     80272b <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802710:	83 ec 04             	sub    $0x4,%esp
+  802713:	ff 75 10             	push   0x10(%ebp)
+  802716:	ff 75 0c             	push   0xc(%ebp)
+  802719:	50                   	push   %eax
+  80271a:	e8 0e 01 00 00       	call   80282d <nsipc_accept>
+  80271f:	83 c4 10             	add    $0x10,%esp
+  802722:	85 c0                	test   %eax,%eax
+  802724:	78 05                	js     80272b <accept+0x2d>
+	return alloc_sockfd(r);
+  802726:	e8 5f ff ff ff       	call   80268a <alloc_sockfd>
+}
+  80272b:	c9                   	leave
+  80272c:	c3                   	ret
+
+0080272d <bind>:
+{
+  80272d:	55                   	push   %ebp
+  80272e:	89 e5                	mov    %esp,%ebp
+  802730:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802733:	8b 45 08             	mov    0x8(%ebp),%eax
+  802736:	e8 1f ff ff ff       	call   80265a <fd2sockid>
+  80273b:	85 c0                	test   %eax,%eax
+  80273d:	78 12                	js     802751 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80273f:	83 ec 04             	sub    $0x4,%esp
+  802742:	ff 75 10             	push   0x10(%ebp)
+  802745:	ff 75 0c             	push   0xc(%ebp)
+  802748:	50                   	push   %eax
+  802749:	e8 31 01 00 00       	call   80287f <nsipc_bind>
+  80274e:	83 c4 10             	add    $0x10,%esp
+}
+  802751:	c9                   	leave
+  802752:	c3                   	ret
+
+00802753 <shutdown>:
+{
+  802753:	55                   	push   %ebp
+  802754:	89 e5                	mov    %esp,%ebp
+  802756:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802759:	8b 45 08             	mov    0x8(%ebp),%eax
+  80275c:	e8 f9 fe ff ff       	call   80265a <fd2sockid>
+  802761:	85 c0                	test   %eax,%eax
+  802763:	78 0f                	js     802774 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802765:	83 ec 08             	sub    $0x8,%esp
+  802768:	ff 75 0c             	push   0xc(%ebp)
+  80276b:	50                   	push   %eax
+  80276c:	e8 43 01 00 00       	call   8028b4 <nsipc_shutdown>
+  802771:	83 c4 10             	add    $0x10,%esp
+}
+  802774:	c9                   	leave
+  802775:	c3                   	ret
+
+00802776 <connect>:
+{
+  802776:	55                   	push   %ebp
+  802777:	89 e5                	mov    %esp,%ebp
+  802779:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80277c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277f:	e8 d6 fe ff ff       	call   80265a <fd2sockid>
+  802784:	85 c0                	test   %eax,%eax
+  802786:	78 12                	js     80279a <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802788:	83 ec 04             	sub    $0x4,%esp
+  80278b:	ff 75 10             	push   0x10(%ebp)
+  80278e:	ff 75 0c             	push   0xc(%ebp)
+  802791:	50                   	push   %eax
+  802792:	e8 59 01 00 00       	call   8028f0 <nsipc_connect>
+  802797:	83 c4 10             	add    $0x10,%esp
+}
+  80279a:	c9                   	leave
+  80279b:	c3                   	ret
+
+0080279c <listen>:
+{
+  80279c:	55                   	push   %ebp
+  80279d:	89 e5                	mov    %esp,%ebp
+  80279f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027a5:	e8 b0 fe ff ff       	call   80265a <fd2sockid>
+  8027aa:	85 c0                	test   %eax,%eax
+  8027ac:	78 0f                	js     8027bd <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8027ae:	83 ec 08             	sub    $0x8,%esp
+  8027b1:	ff 75 0c             	push   0xc(%ebp)
+  8027b4:	50                   	push   %eax
+  8027b5:	e8 6b 01 00 00       	call   802925 <nsipc_listen>
+  8027ba:	83 c4 10             	add    $0x10,%esp
+}
+  8027bd:	c9                   	leave
+  8027be:	c3                   	ret
+
+008027bf <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8027bf:	55                   	push   %ebp
+  8027c0:	89 e5                	mov    %esp,%ebp
+  8027c2:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8027c5:	ff 75 10             	push   0x10(%ebp)
+  8027c8:	ff 75 0c             	push   0xc(%ebp)
+  8027cb:	ff 75 08             	push   0x8(%ebp)
+  8027ce:	e8 41 02 00 00       	call   802a14 <nsipc_socket>
+  8027d3:	83 c4 10             	add    $0x10,%esp
+  8027d6:	85 c0                	test   %eax,%eax
+  8027d8:	78 05                	js     8027df <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8027da:	e8 ab fe ff ff       	call   80268a <alloc_sockfd>
+}
+  8027df:	c9                   	leave
+  8027e0:	c3                   	ret
+
+008027e1 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8027e1:	55                   	push   %ebp
+  8027e2:	89 e5                	mov    %esp,%ebp
+  8027e4:	53                   	push   %ebx
+  8027e5:	83 ec 04             	sub    $0x4,%esp
+  8027e8:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8027ea:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8027f1:	74 26                	je     802819 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8027f3:	6a 07                	push   $0x7
+  8027f5:	68 00 80 80 00       	push   $0x808000
+  8027fa:	53                   	push   %ebx
+  8027fb:	ff 35 00 90 80 00    	push   0x809000
+  802801:	e8 bc 0a 00 00       	call   8032c2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802806:	83 c4 0c             	add    $0xc,%esp
+  802809:	6a 00                	push   $0x0
+  80280b:	6a 00                	push   $0x0
+  80280d:	6a 00                	push   $0x0
+  80280f:	e8 43 0a 00 00       	call   803257 <ipc_recv>
+}
+  802814:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802817:	c9                   	leave
+  802818:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802819:	83 ec 0c             	sub    $0xc,%esp
+  80281c:	6a 02                	push   $0x2
+  80281e:	e8 d8 0b 00 00       	call   8033fb <ipc_find_env>
+  802823:	a3 00 90 80 00       	mov    %eax,0x809000
+  802828:	83 c4 10             	add    $0x10,%esp
+  80282b:	eb c6                	jmp    8027f3 <nsipc+0x12>
+
+0080282d <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80282d:	55                   	push   %ebp
+  80282e:	89 e5                	mov    %esp,%ebp
+  802830:	56                   	push   %esi
+  802831:	53                   	push   %ebx
+  802832:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802835:	8b 45 08             	mov    0x8(%ebp),%eax
+  802838:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80283d:	8b 06                	mov    (%esi),%eax
+  80283f:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802844:	b8 01 00 00 00       	mov    $0x1,%eax
+  802849:	e8 93 ff ff ff       	call   8027e1 <nsipc>
+  80284e:	89 c3                	mov    %eax,%ebx
+  802850:	85 c0                	test   %eax,%eax
+  802852:	79 09                	jns    80285d <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802854:	89 d8                	mov    %ebx,%eax
+  802856:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802859:	5b                   	pop    %ebx
+  80285a:	5e                   	pop    %esi
+  80285b:	5d                   	pop    %ebp
+  80285c:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80285d:	83 ec 04             	sub    $0x4,%esp
+  802860:	ff 35 10 80 80 00    	push   0x808010
+  802866:	68 00 80 80 00       	push   $0x808000
+  80286b:	ff 75 0c             	push   0xc(%ebp)
+  80286e:	e8 47 e0 ff ff       	call   8008ba <memmove>
+		*addrlen = ret->ret_addrlen;
+  802873:	a1 10 80 80 00       	mov    0x808010,%eax
+  802878:	89 06                	mov    %eax,(%esi)
+  80287a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80287d:	eb d5                	jmp    802854 <nsipc_accept+0x27>
+
+0080287f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80287f:	55                   	push   %ebp
+  802880:	89 e5                	mov    %esp,%ebp
+  802882:	53                   	push   %ebx
+  802883:	83 ec 08             	sub    $0x8,%esp
+  802886:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802889:	8b 45 08             	mov    0x8(%ebp),%eax
+  80288c:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802891:	53                   	push   %ebx
+  802892:	ff 75 0c             	push   0xc(%ebp)
+  802895:	68 04 80 80 00       	push   $0x808004
+  80289a:	e8 1b e0 ff ff       	call   8008ba <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80289f:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8028a5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8028aa:	e8 32 ff ff ff       	call   8027e1 <nsipc>
+}
+  8028af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028b2:	c9                   	leave
+  8028b3:	c3                   	ret
+
+008028b4 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8028b4:	55                   	push   %ebp
+  8028b5:	89 e5                	mov    %esp,%ebp
+  8028b7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8028ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028bd:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  8028c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028c5:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  8028ca:	b8 03 00 00 00       	mov    $0x3,%eax
+  8028cf:	e8 0d ff ff ff       	call   8027e1 <nsipc>
+}
+  8028d4:	c9                   	leave
+  8028d5:	c3                   	ret
+
+008028d6 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8028d6:	55                   	push   %ebp
+  8028d7:	89 e5                	mov    %esp,%ebp
+  8028d9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8028dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028df:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8028e4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8028e9:	e8 f3 fe ff ff       	call   8027e1 <nsipc>
+}
+  8028ee:	c9                   	leave
+  8028ef:	c3                   	ret
+
+008028f0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8028f0:	55                   	push   %ebp
+  8028f1:	89 e5                	mov    %esp,%ebp
+  8028f3:	53                   	push   %ebx
+  8028f4:	83 ec 08             	sub    $0x8,%esp
+  8028f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8028fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028fd:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802902:	53                   	push   %ebx
+  802903:	ff 75 0c             	push   0xc(%ebp)
+  802906:	68 04 80 80 00       	push   $0x808004
+  80290b:	e8 aa df ff ff       	call   8008ba <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802910:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802916:	b8 05 00 00 00       	mov    $0x5,%eax
+  80291b:	e8 c1 fe ff ff       	call   8027e1 <nsipc>
+}
+  802920:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802923:	c9                   	leave
+  802924:	c3                   	ret
+
+00802925 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802925:	55                   	push   %ebp
+  802926:	89 e5                	mov    %esp,%ebp
+  802928:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80292b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80292e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802933:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802936:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  80293b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802940:	e8 9c fe ff ff       	call   8027e1 <nsipc>
+}
+  802945:	c9                   	leave
+  802946:	c3                   	ret
+
+00802947 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802947:	55                   	push   %ebp
+  802948:	89 e5                	mov    %esp,%ebp
+  80294a:	56                   	push   %esi
+  80294b:	53                   	push   %ebx
+  80294c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80294f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802952:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802957:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  80295d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802960:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802965:	b8 07 00 00 00       	mov    $0x7,%eax
+  80296a:	e8 72 fe ff ff       	call   8027e1 <nsipc>
+  80296f:	89 c3                	mov    %eax,%ebx
+  802971:	85 c0                	test   %eax,%eax
+  802973:	78 22                	js     802997 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802975:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80297a:	39 c6                	cmp    %eax,%esi
+  80297c:	0f 4e c6             	cmovle %esi,%eax
+  80297f:	39 c3                	cmp    %eax,%ebx
+  802981:	7f 1d                	jg     8029a0 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802983:	83 ec 04             	sub    $0x4,%esp
+  802986:	53                   	push   %ebx
+  802987:	68 00 80 80 00       	push   $0x808000
+  80298c:	ff 75 0c             	push   0xc(%ebp)
+  80298f:	e8 26 df ff ff       	call   8008ba <memmove>
+  802994:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802997:	89 d8                	mov    %ebx,%eax
+  802999:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80299c:	5b                   	pop    %ebx
+  80299d:	5e                   	pop    %esi
+  80299e:	5d                   	pop    %ebp
+  80299f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8029a0:	68 02 3c 80 00       	push   $0x803c02
+  8029a5:	68 a0 3b 80 00       	push   $0x803ba0
+  8029aa:	6a 62                	push   $0x62
+  8029ac:	68 17 3c 80 00       	push   $0x803c17
+  8029b1:	e8 46 05 00 00       	call   802efc <_panic>
+
+008029b6 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8029b6:	55                   	push   %ebp
+  8029b7:	89 e5                	mov    %esp,%ebp
+  8029b9:	53                   	push   %ebx
+  8029ba:	83 ec 04             	sub    $0x4,%esp
+  8029bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8029c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c3:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  8029c8:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8029ce:	7f 2e                	jg     8029fe <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8029d0:	83 ec 04             	sub    $0x4,%esp
+  8029d3:	53                   	push   %ebx
+  8029d4:	ff 75 0c             	push   0xc(%ebp)
+  8029d7:	68 0c 80 80 00       	push   $0x80800c
+  8029dc:	e8 d9 de ff ff       	call   8008ba <memmove>
+	nsipcbuf.send.req_size = size;
+  8029e1:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8029e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029ea:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8029ef:	b8 08 00 00 00       	mov    $0x8,%eax
+  8029f4:	e8 e8 fd ff ff       	call   8027e1 <nsipc>
+}
+  8029f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029fc:	c9                   	leave
+  8029fd:	c3                   	ret
+	assert(size < 1600);
+  8029fe:	68 23 3c 80 00       	push   $0x803c23
+  802a03:	68 a0 3b 80 00       	push   $0x803ba0
+  802a08:	6a 6d                	push   $0x6d
+  802a0a:	68 17 3c 80 00       	push   $0x803c17
+  802a0f:	e8 e8 04 00 00       	call   802efc <_panic>
+
+00802a14 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802a14:	55                   	push   %ebp
+  802a15:	89 e5                	mov    %esp,%ebp
+  802a17:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802a1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a1d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802a22:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a25:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802a2a:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a2d:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802a32:	b8 09 00 00 00       	mov    $0x9,%eax
+  802a37:	e8 a5 fd ff ff       	call   8027e1 <nsipc>
+}
+  802a3c:	c9                   	leave
+  802a3d:	c3                   	ret
+
+00802a3e <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a3e:	55                   	push   %ebp
+  802a3f:	89 e5                	mov    %esp,%ebp
+  802a41:	56                   	push   %esi
+  802a42:	53                   	push   %ebx
+  802a43:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802a46:	83 ec 0c             	sub    $0xc,%esp
+  802a49:	ff 75 08             	push   0x8(%ebp)
+  802a4c:	e8 00 e5 ff ff       	call   800f51 <fd2data>
+  802a51:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802a53:	83 c4 08             	add    $0x8,%esp
+  802a56:	68 2f 3c 80 00       	push   $0x803c2f
+  802a5b:	53                   	push   %ebx
+  802a5c:	e8 d3 dc ff ff       	call   800734 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802a61:	8b 46 04             	mov    0x4(%esi),%eax
+  802a64:	2b 06                	sub    (%esi),%eax
+  802a66:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802a6c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802a73:	00 00 00 
+	stat->st_dev = &devpipe;
+  802a76:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802a7d:	40 80 00 
+	return 0;
+}
+  802a80:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a85:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a88:	5b                   	pop    %ebx
+  802a89:	5e                   	pop    %esi
+  802a8a:	5d                   	pop    %ebp
+  802a8b:	c3                   	ret
+
+00802a8c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802a8c:	55                   	push   %ebp
+  802a8d:	89 e5                	mov    %esp,%ebp
+  802a8f:	53                   	push   %ebx
+  802a90:	83 ec 0c             	sub    $0xc,%esp
+  802a93:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802a96:	53                   	push   %ebx
+  802a97:	6a 00                	push   $0x0
+  802a99:	e8 2f e1 ff ff       	call   800bcd <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802a9e:	89 1c 24             	mov    %ebx,(%esp)
+  802aa1:	e8 ab e4 ff ff       	call   800f51 <fd2data>
+  802aa6:	83 c4 08             	add    $0x8,%esp
+  802aa9:	50                   	push   %eax
+  802aaa:	6a 00                	push   $0x0
+  802aac:	e8 1c e1 ff ff       	call   800bcd <sys_page_unmap>
+}
+  802ab1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ab4:	c9                   	leave
+  802ab5:	c3                   	ret
+
+00802ab6 <_pipeisclosed>:
+{
+  802ab6:	55                   	push   %ebp
+  802ab7:	89 e5                	mov    %esp,%ebp
+  802ab9:	57                   	push   %edi
+  802aba:	56                   	push   %esi
+  802abb:	53                   	push   %ebx
+  802abc:	83 ec 1c             	sub    $0x1c,%esp
+  802abf:	89 c7                	mov    %eax,%edi
+  802ac1:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802ac3:	a1 00 50 80 00       	mov    0x805000,%eax
+  802ac8:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802acb:	83 ec 0c             	sub    $0xc,%esp
+  802ace:	57                   	push   %edi
+  802acf:	e8 66 09 00 00       	call   80343a <pageref>
+  802ad4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ad7:	89 34 24             	mov    %esi,(%esp)
+  802ada:	e8 5b 09 00 00       	call   80343a <pageref>
+		nn = thisenv->env_runs;
+  802adf:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802ae5:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802ae8:	83 c4 10             	add    $0x10,%esp
+  802aeb:	39 cb                	cmp    %ecx,%ebx
+  802aed:	74 1b                	je     802b0a <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802aef:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802af2:	75 cf                	jne    802ac3 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802af4:	8b 42 58             	mov    0x58(%edx),%eax
+  802af7:	6a 01                	push   $0x1
+  802af9:	50                   	push   %eax
+  802afa:	53                   	push   %ebx
+  802afb:	68 36 3c 80 00       	push   $0x803c36
+  802b00:	e8 41 d6 ff ff       	call   800146 <cprintf>
+  802b05:	83 c4 10             	add    $0x10,%esp
+  802b08:	eb b9                	jmp    802ac3 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802b0a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802b0d:	0f 94 c0             	sete   %al
+  802b10:	0f b6 c0             	movzbl %al,%eax
+}
+  802b13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b16:	5b                   	pop    %ebx
+  802b17:	5e                   	pop    %esi
+  802b18:	5f                   	pop    %edi
+  802b19:	5d                   	pop    %ebp
+  802b1a:	c3                   	ret
+
+00802b1b <devpipe_write>:
+{
+  802b1b:	55                   	push   %ebp
+  802b1c:	89 e5                	mov    %esp,%ebp
+  802b1e:	57                   	push   %edi
+  802b1f:	56                   	push   %esi
+  802b20:	53                   	push   %ebx
+  802b21:	83 ec 28             	sub    $0x28,%esp
+  802b24:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802b27:	56                   	push   %esi
+  802b28:	e8 24 e4 ff ff       	call   800f51 <fd2data>
+  802b2d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802b2f:	83 c4 10             	add    $0x10,%esp
+  802b32:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b37:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802b3a:	75 09                	jne    802b45 <devpipe_write+0x2a>
+	return i;
+  802b3c:	89 f8                	mov    %edi,%eax
+  802b3e:	eb 23                	jmp    802b63 <devpipe_write+0x48>
+			sys_yield();
+  802b40:	e8 dc df ff ff       	call   800b21 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802b45:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b48:	8b 0b                	mov    (%ebx),%ecx
+  802b4a:	8d 51 20             	lea    0x20(%ecx),%edx
+  802b4d:	39 d0                	cmp    %edx,%eax
+  802b4f:	72 1a                	jb     802b6b <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802b51:	89 da                	mov    %ebx,%edx
+  802b53:	89 f0                	mov    %esi,%eax
+  802b55:	e8 5c ff ff ff       	call   802ab6 <_pipeisclosed>
+  802b5a:	85 c0                	test   %eax,%eax
+  802b5c:	74 e2                	je     802b40 <devpipe_write+0x25>
+				return 0;
+  802b5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b66:	5b                   	pop    %ebx
+  802b67:	5e                   	pop    %esi
+  802b68:	5f                   	pop    %edi
+  802b69:	5d                   	pop    %ebp
+  802b6a:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802b6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b6e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802b72:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802b75:	89 c2                	mov    %eax,%edx
+  802b77:	c1 fa 1f             	sar    $0x1f,%edx
+  802b7a:	89 d1                	mov    %edx,%ecx
+  802b7c:	c1 e9 1b             	shr    $0x1b,%ecx
+  802b7f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802b82:	83 e2 1f             	and    $0x1f,%edx
+  802b85:	29 ca                	sub    %ecx,%edx
+  802b87:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802b8b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802b8f:	83 c0 01             	add    $0x1,%eax
+  802b92:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802b95:	83 c7 01             	add    $0x1,%edi
+  802b98:	eb 9d                	jmp    802b37 <devpipe_write+0x1c>
+
+00802b9a <devpipe_read>:
+{
+  802b9a:	55                   	push   %ebp
+  802b9b:	89 e5                	mov    %esp,%ebp
+  802b9d:	57                   	push   %edi
+  802b9e:	56                   	push   %esi
+  802b9f:	53                   	push   %ebx
+  802ba0:	83 ec 18             	sub    $0x18,%esp
+  802ba3:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802ba6:	57                   	push   %edi
+  802ba7:	e8 a5 e3 ff ff       	call   800f51 <fd2data>
+  802bac:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802bae:	83 c4 10             	add    $0x10,%esp
+  802bb1:	be 00 00 00 00       	mov    $0x0,%esi
+  802bb6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802bb9:	75 13                	jne    802bce <devpipe_read+0x34>
+	return i;
+  802bbb:	89 f0                	mov    %esi,%eax
+  802bbd:	eb 02                	jmp    802bc1 <devpipe_read+0x27>
+				return i;
+  802bbf:	89 f0                	mov    %esi,%eax
+}
+  802bc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bc4:	5b                   	pop    %ebx
+  802bc5:	5e                   	pop    %esi
+  802bc6:	5f                   	pop    %edi
+  802bc7:	5d                   	pop    %ebp
+  802bc8:	c3                   	ret
+			sys_yield();
+  802bc9:	e8 53 df ff ff       	call   800b21 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802bce:	8b 03                	mov    (%ebx),%eax
+  802bd0:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802bd3:	75 18                	jne    802bed <devpipe_read+0x53>
+			if (i > 0)
+  802bd5:	85 f6                	test   %esi,%esi
+  802bd7:	75 e6                	jne    802bbf <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802bd9:	89 da                	mov    %ebx,%edx
+  802bdb:	89 f8                	mov    %edi,%eax
+  802bdd:	e8 d4 fe ff ff       	call   802ab6 <_pipeisclosed>
+  802be2:	85 c0                	test   %eax,%eax
+  802be4:	74 e3                	je     802bc9 <devpipe_read+0x2f>
+				return 0;
+  802be6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802beb:	eb d4                	jmp    802bc1 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802bed:	99                   	cltd
+  802bee:	c1 ea 1b             	shr    $0x1b,%edx
+  802bf1:	01 d0                	add    %edx,%eax
+  802bf3:	83 e0 1f             	and    $0x1f,%eax
+  802bf6:	29 d0                	sub    %edx,%eax
+  802bf8:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802bfd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c00:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802c03:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802c06:	83 c6 01             	add    $0x1,%esi
+  802c09:	eb ab                	jmp    802bb6 <devpipe_read+0x1c>
+
+00802c0b <pipe>:
+{
+  802c0b:	55                   	push   %ebp
+  802c0c:	89 e5                	mov    %esp,%ebp
+  802c0e:	56                   	push   %esi
+  802c0f:	53                   	push   %ebx
+  802c10:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802c13:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c16:	50                   	push   %eax
+  802c17:	e8 4c e3 ff ff       	call   800f68 <fd_alloc>
+  802c1c:	89 c3                	mov    %eax,%ebx
+  802c1e:	83 c4 10             	add    $0x10,%esp
+  802c21:	85 c0                	test   %eax,%eax
+  802c23:	0f 88 23 01 00 00    	js     802d4c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c29:	83 ec 04             	sub    $0x4,%esp
+  802c2c:	68 07 04 00 00       	push   $0x407
+  802c31:	ff 75 f4             	push   -0xc(%ebp)
+  802c34:	6a 00                	push   $0x0
+  802c36:	e8 05 df ff ff       	call   800b40 <sys_page_alloc>
+  802c3b:	89 c3                	mov    %eax,%ebx
+  802c3d:	83 c4 10             	add    $0x10,%esp
+  802c40:	85 c0                	test   %eax,%eax
+  802c42:	0f 88 04 01 00 00    	js     802d4c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802c48:	83 ec 0c             	sub    $0xc,%esp
+  802c4b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802c4e:	50                   	push   %eax
+  802c4f:	e8 14 e3 ff ff       	call   800f68 <fd_alloc>
+  802c54:	89 c3                	mov    %eax,%ebx
+  802c56:	83 c4 10             	add    $0x10,%esp
+  802c59:	85 c0                	test   %eax,%eax
+  802c5b:	0f 88 db 00 00 00    	js     802d3c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c61:	83 ec 04             	sub    $0x4,%esp
+  802c64:	68 07 04 00 00       	push   $0x407
+  802c69:	ff 75 f0             	push   -0x10(%ebp)
+  802c6c:	6a 00                	push   $0x0
+  802c6e:	e8 cd de ff ff       	call   800b40 <sys_page_alloc>
+  802c73:	89 c3                	mov    %eax,%ebx
+  802c75:	83 c4 10             	add    $0x10,%esp
+  802c78:	85 c0                	test   %eax,%eax
+  802c7a:	0f 88 bc 00 00 00    	js     802d3c <pipe+0x131>
+	va = fd2data(fd0);
+  802c80:	83 ec 0c             	sub    $0xc,%esp
+  802c83:	ff 75 f4             	push   -0xc(%ebp)
+  802c86:	e8 c6 e2 ff ff       	call   800f51 <fd2data>
+  802c8b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c8d:	83 c4 0c             	add    $0xc,%esp
+  802c90:	68 07 04 00 00       	push   $0x407
+  802c95:	50                   	push   %eax
+  802c96:	6a 00                	push   $0x0
+  802c98:	e8 a3 de ff ff       	call   800b40 <sys_page_alloc>
+  802c9d:	89 c3                	mov    %eax,%ebx
+  802c9f:	83 c4 10             	add    $0x10,%esp
+  802ca2:	85 c0                	test   %eax,%eax
+  802ca4:	0f 88 82 00 00 00    	js     802d2c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802caa:	83 ec 0c             	sub    $0xc,%esp
+  802cad:	ff 75 f0             	push   -0x10(%ebp)
+  802cb0:	e8 9c e2 ff ff       	call   800f51 <fd2data>
+  802cb5:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802cbc:	50                   	push   %eax
+  802cbd:	6a 00                	push   $0x0
+  802cbf:	56                   	push   %esi
+  802cc0:	6a 00                	push   $0x0
+  802cc2:	e8 c4 de ff ff       	call   800b8b <sys_page_map>
+  802cc7:	89 c3                	mov    %eax,%ebx
+  802cc9:	83 c4 20             	add    $0x20,%esp
+  802ccc:	85 c0                	test   %eax,%eax
+  802cce:	78 4e                	js     802d1e <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802cd0:	a1 60 40 80 00       	mov    0x804060,%eax
+  802cd5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802cd8:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802cda:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802cdd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802ce4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802ce7:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802ce9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802cec:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802cf3:	83 ec 0c             	sub    $0xc,%esp
+  802cf6:	ff 75 f4             	push   -0xc(%ebp)
+  802cf9:	e8 43 e2 ff ff       	call   800f41 <fd2num>
+  802cfe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d01:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802d03:	83 c4 04             	add    $0x4,%esp
+  802d06:	ff 75 f0             	push   -0x10(%ebp)
+  802d09:	e8 33 e2 ff ff       	call   800f41 <fd2num>
+  802d0e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d11:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802d14:	83 c4 10             	add    $0x10,%esp
+  802d17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d1c:	eb 2e                	jmp    802d4c <pipe+0x141>
+	sys_page_unmap(0, va);
+  802d1e:	83 ec 08             	sub    $0x8,%esp
+  802d21:	56                   	push   %esi
+  802d22:	6a 00                	push   $0x0
+  802d24:	e8 a4 de ff ff       	call   800bcd <sys_page_unmap>
+  802d29:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802d2c:	83 ec 08             	sub    $0x8,%esp
+  802d2f:	ff 75 f0             	push   -0x10(%ebp)
+  802d32:	6a 00                	push   $0x0
+  802d34:	e8 94 de ff ff       	call   800bcd <sys_page_unmap>
+  802d39:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802d3c:	83 ec 08             	sub    $0x8,%esp
+  802d3f:	ff 75 f4             	push   -0xc(%ebp)
+  802d42:	6a 00                	push   $0x0
+  802d44:	e8 84 de ff ff       	call   800bcd <sys_page_unmap>
+  802d49:	83 c4 10             	add    $0x10,%esp
+}
+  802d4c:	89 d8                	mov    %ebx,%eax
+  802d4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d51:	5b                   	pop    %ebx
+  802d52:	5e                   	pop    %esi
+  802d53:	5d                   	pop    %ebp
+  802d54:	c3                   	ret
+
+00802d55 <pipeisclosed>:
+{
+  802d55:	55                   	push   %ebp
+  802d56:	89 e5                	mov    %esp,%ebp
+  802d58:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d5b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d5e:	50                   	push   %eax
+  802d5f:	ff 75 08             	push   0x8(%ebp)
+  802d62:	e8 57 e2 ff ff       	call   800fbe <fd_lookup>
+  802d67:	83 c4 10             	add    $0x10,%esp
+  802d6a:	85 c0                	test   %eax,%eax
+  802d6c:	78 18                	js     802d86 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802d6e:	83 ec 0c             	sub    $0xc,%esp
+  802d71:	ff 75 f4             	push   -0xc(%ebp)
+  802d74:	e8 d8 e1 ff ff       	call   800f51 <fd2data>
+  802d79:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802d7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d7e:	e8 33 fd ff ff       	call   802ab6 <_pipeisclosed>
+  802d83:	83 c4 10             	add    $0x10,%esp
+}
+  802d86:	c9                   	leave
+  802d87:	c3                   	ret
+
+00802d88 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802d88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d8d:	c3                   	ret
+
+00802d8e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d8e:	55                   	push   %ebp
+  802d8f:	89 e5                	mov    %esp,%ebp
+  802d91:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802d94:	68 4e 3c 80 00       	push   $0x803c4e
+  802d99:	ff 75 0c             	push   0xc(%ebp)
+  802d9c:	e8 93 d9 ff ff       	call   800734 <strcpy>
+	return 0;
+}
+  802da1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da6:	c9                   	leave
+  802da7:	c3                   	ret
+
+00802da8 <devcons_write>:
+{
+  802da8:	55                   	push   %ebp
+  802da9:	89 e5                	mov    %esp,%ebp
+  802dab:	57                   	push   %edi
+  802dac:	56                   	push   %esi
+  802dad:	53                   	push   %ebx
+  802dae:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802db4:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802db9:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802dbf:	eb 2e                	jmp    802def <devcons_write+0x47>
+		m = n - tot;
+  802dc1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dc4:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802dc6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802dcb:	39 c3                	cmp    %eax,%ebx
+  802dcd:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802dd0:	83 ec 04             	sub    $0x4,%esp
+  802dd3:	53                   	push   %ebx
+  802dd4:	89 f0                	mov    %esi,%eax
+  802dd6:	03 45 0c             	add    0xc(%ebp),%eax
+  802dd9:	50                   	push   %eax
+  802dda:	57                   	push   %edi
+  802ddb:	e8 da da ff ff       	call   8008ba <memmove>
+		sys_cputs(buf, m);
+  802de0:	83 c4 08             	add    $0x8,%esp
+  802de3:	53                   	push   %ebx
+  802de4:	57                   	push   %edi
+  802de5:	e8 7a dc ff ff       	call   800a64 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802dea:	01 de                	add    %ebx,%esi
+  802dec:	83 c4 10             	add    $0x10,%esp
+  802def:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802df2:	72 cd                	jb     802dc1 <devcons_write+0x19>
+}
+  802df4:	89 f0                	mov    %esi,%eax
+  802df6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802df9:	5b                   	pop    %ebx
+  802dfa:	5e                   	pop    %esi
+  802dfb:	5f                   	pop    %edi
+  802dfc:	5d                   	pop    %ebp
+  802dfd:	c3                   	ret
+
+00802dfe <devcons_read>:
+{
+  802dfe:	55                   	push   %ebp
+  802dff:	89 e5                	mov    %esp,%ebp
+  802e01:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802e04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e09:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e0d:	75 07                	jne    802e16 <devcons_read+0x18>
+  802e0f:	eb 1f                	jmp    802e30 <devcons_read+0x32>
+		sys_yield();
+  802e11:	e8 0b dd ff ff       	call   800b21 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802e16:	e8 6f dc ff ff       	call   800a8a <sys_cgetc>
+  802e1b:	85 c0                	test   %eax,%eax
+  802e1d:	74 f2                	je     802e11 <devcons_read+0x13>
+	if (c < 0)
+  802e1f:	78 0f                	js     802e30 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802e21:	83 f8 04             	cmp    $0x4,%eax
+  802e24:	74 0c                	je     802e32 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802e26:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802e29:	88 02                	mov    %al,(%edx)
+	return 1;
+  802e2b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802e30:	c9                   	leave
+  802e31:	c3                   	ret
+		return 0;
+  802e32:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e37:	eb f7                	jmp    802e30 <devcons_read+0x32>
+
+00802e39 <cputchar>:
+{
+  802e39:	55                   	push   %ebp
+  802e3a:	89 e5                	mov    %esp,%ebp
+  802e3c:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802e3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e42:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802e45:	6a 01                	push   $0x1
+  802e47:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e4a:	50                   	push   %eax
+  802e4b:	e8 14 dc ff ff       	call   800a64 <sys_cputs>
+}
+  802e50:	83 c4 10             	add    $0x10,%esp
+  802e53:	c9                   	leave
+  802e54:	c3                   	ret
+
+00802e55 <getchar>:
+{
+  802e55:	55                   	push   %ebp
+  802e56:	89 e5                	mov    %esp,%ebp
+  802e58:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802e5b:	6a 01                	push   $0x1
+  802e5d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e60:	50                   	push   %eax
+  802e61:	6a 00                	push   $0x0
+  802e63:	e8 bc e3 ff ff       	call   801224 <read>
+	if (r < 0)
+  802e68:	83 c4 10             	add    $0x10,%esp
+  802e6b:	85 c0                	test   %eax,%eax
+  802e6d:	78 06                	js     802e75 <getchar+0x20>
+	if (r < 1)
+  802e6f:	74 06                	je     802e77 <getchar+0x22>
+	return c;
+  802e71:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802e75:	c9                   	leave
+  802e76:	c3                   	ret
+		return -E_EOF;
+  802e77:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802e7c:	eb f7                	jmp    802e75 <getchar+0x20>
+
+00802e7e <iscons>:
+{
+  802e7e:	55                   	push   %ebp
+  802e7f:	89 e5                	mov    %esp,%ebp
+  802e81:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e84:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e87:	50                   	push   %eax
+  802e88:	ff 75 08             	push   0x8(%ebp)
+  802e8b:	e8 2e e1 ff ff       	call   800fbe <fd_lookup>
+  802e90:	83 c4 10             	add    $0x10,%esp
+  802e93:	85 c0                	test   %eax,%eax
+  802e95:	78 11                	js     802ea8 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802e97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e9a:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802ea0:	39 10                	cmp    %edx,(%eax)
+  802ea2:	0f 94 c0             	sete   %al
+  802ea5:	0f b6 c0             	movzbl %al,%eax
+}
+  802ea8:	c9                   	leave
+  802ea9:	c3                   	ret
+
+00802eaa <opencons>:
+{
+  802eaa:	55                   	push   %ebp
+  802eab:	89 e5                	mov    %esp,%ebp
+  802ead:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802eb0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802eb3:	50                   	push   %eax
+  802eb4:	e8 af e0 ff ff       	call   800f68 <fd_alloc>
+  802eb9:	83 c4 10             	add    $0x10,%esp
+  802ebc:	85 c0                	test   %eax,%eax
+  802ebe:	78 3a                	js     802efa <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802ec0:	83 ec 04             	sub    $0x4,%esp
+  802ec3:	68 07 04 00 00       	push   $0x407
+  802ec8:	ff 75 f4             	push   -0xc(%ebp)
+  802ecb:	6a 00                	push   $0x0
+  802ecd:	e8 6e dc ff ff       	call   800b40 <sys_page_alloc>
+  802ed2:	83 c4 10             	add    $0x10,%esp
+  802ed5:	85 c0                	test   %eax,%eax
+  802ed7:	78 21                	js     802efa <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802ed9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802edc:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802ee2:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802ee4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ee7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802eee:	83 ec 0c             	sub    $0xc,%esp
+  802ef1:	50                   	push   %eax
+  802ef2:	e8 4a e0 ff ff       	call   800f41 <fd2num>
+  802ef7:	83 c4 10             	add    $0x10,%esp
+}
+  802efa:	c9                   	leave
+  802efb:	c3                   	ret
+
+00802efc <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802efc:	55                   	push   %ebp
+  802efd:	89 e5                	mov    %esp,%ebp
+  802eff:	56                   	push   %esi
+  802f00:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802f01:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802f04:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802f0a:	e8 eb db ff ff       	call   800afa <sys_getenvid>
+  802f0f:	83 ec 0c             	sub    $0xc,%esp
+  802f12:	ff 75 0c             	push   0xc(%ebp)
+  802f15:	ff 75 08             	push   0x8(%ebp)
+  802f18:	56                   	push   %esi
+  802f19:	50                   	push   %eax
+  802f1a:	68 5c 3c 80 00       	push   $0x803c5c
+  802f1f:	e8 22 d2 ff ff       	call   800146 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802f24:	83 c4 18             	add    $0x18,%esp
+  802f27:	53                   	push   %ebx
+  802f28:	ff 75 10             	push   0x10(%ebp)
+  802f2b:	e8 c5 d1 ff ff       	call   8000f5 <vcprintf>
+	cprintf("\n");
+  802f30:	c7 04 24 47 3c 80 00 	movl   $0x803c47,(%esp)
+  802f37:	e8 0a d2 ff ff       	call   800146 <cprintf>
+  802f3c:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802f3f:	cc                   	int3
+	while (1)
+  802f40:	eb fd                	jmp    802f3f <_panic+0x43>
+
+00802f42 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802f42:	55                   	push   %ebp
+  802f43:	89 e5                	mov    %esp,%ebp
+  802f45:	57                   	push   %edi
+  802f46:	56                   	push   %esi
+  802f47:	53                   	push   %ebx
+  802f48:	83 ec 20             	sub    $0x20,%esp
+  802f4b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f4e:	89 d7                	mov    %edx,%edi
+  802f50:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802f52:	51                   	push   %ecx
+  802f53:	68 00 f0 7f 00       	push   $0x7ff000
+  802f58:	6a 00                	push   $0x0
+  802f5a:	e8 e1 db ff ff       	call   800b40 <sys_page_alloc>
+  802f5f:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f61:	83 c4 10             	add    $0x10,%esp
+  802f64:	85 c0                	test   %eax,%eax
+  802f66:	78 45                	js     802fad <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802f68:	83 ec 04             	sub    $0x4,%esp
+  802f6b:	68 00 10 00 00       	push   $0x1000
+  802f70:	57                   	push   %edi
+  802f71:	68 00 f0 7f 00       	push   $0x7ff000
+  802f76:	e8 3f d9 ff ff       	call   8008ba <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  802f7b:	89 34 24             	mov    %esi,(%esp)
+  802f7e:	57                   	push   %edi
+  802f7f:	ff 75 e4             	push   -0x1c(%ebp)
+  802f82:	68 00 f0 7f 00       	push   $0x7ff000
+  802f87:	6a 00                	push   $0x0
+  802f89:	e8 fd db ff ff       	call   800b8b <sys_page_map>
+  802f8e:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f90:	83 c4 20             	add    $0x20,%esp
+  802f93:	85 c0                	test   %eax,%eax
+  802f95:	78 16                	js     802fad <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802f97:	83 ec 08             	sub    $0x8,%esp
+  802f9a:	68 00 f0 7f 00       	push   $0x7ff000
+  802f9f:	6a 00                	push   $0x0
+  802fa1:	e8 27 dc ff ff       	call   800bcd <sys_page_unmap>
+  802fa6:	83 c4 10             	add    $0x10,%esp
+  802fa9:	85 c0                	test   %eax,%eax
+  802fab:	75 0a                	jne    802fb7 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  802fad:	89 d8                	mov    %ebx,%eax
+  802faf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fb2:	5b                   	pop    %ebx
+  802fb3:	5e                   	pop    %esi
+  802fb4:	5f                   	pop    %edi
+  802fb5:	5d                   	pop    %ebp
+  802fb6:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802fb7:	68 80 3c 80 00       	push   $0x803c80
+  802fbc:	68 a0 3b 80 00       	push   $0x803ba0
+  802fc1:	6a 1b                	push   $0x1b
+  802fc3:	68 f8 3c 80 00       	push   $0x803cf8
+  802fc8:	e8 2f ff ff ff       	call   802efc <_panic>
+
+00802fcd <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802fcd:	55                   	push   %ebp
+  802fce:	89 e5                	mov    %esp,%ebp
+  802fd0:	53                   	push   %ebx
+  802fd1:	83 ec 04             	sub    $0x4,%esp
+  802fd4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  802fd7:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802fd9:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  802fdd:	74 21                	je     803000 <pgfault+0x33>
+  802fdf:	89 d0                	mov    %edx,%eax
+  802fe1:	c1 e8 16             	shr    $0x16,%eax
+  802fe4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802feb:	a8 01                	test   $0x1,%al
+  802fed:	74 11                	je     803000 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  802fef:	89 d0                	mov    %edx,%eax
+  802ff1:	c1 e8 0c             	shr    $0xc,%eax
+  802ff4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802ffb:	f6 c4 08             	test   $0x8,%ah
+  802ffe:	75 17                	jne    803017 <pgfault+0x4a>
+		if (pgfault_next) {
+  803000:	a1 04 90 80 00       	mov    0x809004,%eax
+  803005:	85 c0                	test   %eax,%eax
+  803007:	74 27                	je     803030 <pgfault+0x63>
+			pgfault_next(utf);
+  803009:	83 ec 0c             	sub    $0xc,%esp
+  80300c:	53                   	push   %ebx
+  80300d:	ff d0                	call   *%eax
+			return;
+  80300f:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803012:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803015:	c9                   	leave
+  803016:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803017:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80301d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803022:	b8 00 00 00 00       	mov    $0x0,%eax
+  803027:	e8 16 ff ff ff       	call   802f42 <copy_page_to>
+  80302c:	85 c0                	test   %eax,%eax
+  80302e:	79 e2                	jns    803012 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803030:	a1 00 50 80 00       	mov    0x805000,%eax
+  803035:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803038:	ff 73 28             	push   0x28(%ebx)
+  80303b:	ff 33                	push   (%ebx)
+  80303d:	50                   	push   %eax
+  80303e:	68 a4 3c 80 00       	push   $0x803ca4
+  803043:	e8 fe d0 ff ff       	call   800146 <cprintf>
+	sys_env_destroy(0);
+  803048:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80304f:	e8 5d da ff ff       	call   800ab1 <sys_env_destroy>
+  803054:	83 c4 10             	add    $0x10,%esp
+  803057:	eb b9                	jmp    803012 <pgfault+0x45>
+
+00803059 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803059:	55                   	push   %ebp
+  80305a:	89 e5                	mov    %esp,%ebp
+  80305c:	53                   	push   %ebx
+  80305d:	83 ec 04             	sub    $0x4,%esp
+  803060:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803063:	a1 08 90 80 00       	mov    0x809008,%eax
+  803068:	3d cd 2f 80 00       	cmp    $0x802fcd,%eax
+  80306d:	74 15                	je     803084 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80306f:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  803074:	83 ec 0c             	sub    $0xc,%esp
+  803077:	68 cd 2f 80 00       	push   $0x802fcd
+  80307c:	e8 fb 03 00 00       	call   80347c <set_pgfault_handler>
+  803081:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803084:	83 ec 0c             	sub    $0xc,%esp
+  803087:	68 05 08 00 00       	push   $0x805
+  80308c:	53                   	push   %ebx
+  80308d:	6a 00                	push   $0x0
+  80308f:	53                   	push   %ebx
+  803090:	6a 00                	push   $0x0
+  803092:	e8 f4 da ff ff       	call   800b8b <sys_page_map>
+}
+  803097:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80309a:	c9                   	leave
+  80309b:	c3                   	ret
+
+0080309c <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80309c:	55                   	push   %ebp
+  80309d:	89 e5                	mov    %esp,%ebp
+  80309f:	57                   	push   %edi
+  8030a0:	56                   	push   %esi
+  8030a1:	53                   	push   %ebx
+  8030a2:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8030a5:	68 cd 2f 80 00       	push   $0x802fcd
+  8030aa:	e8 cd 03 00 00       	call   80347c <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8030af:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030b4:	cd 30                	int    $0x30
+  8030b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030b9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8030bc:	83 c4 10             	add    $0x10,%esp
+  8030bf:	85 c0                	test   %eax,%eax
+  8030c1:	0f 88 6b 01 00 00    	js     803232 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8030cc:	75 37                	jne    803105 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8030ce:	e8 27 da ff ff       	call   800afa <sys_getenvid>
+  8030d3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030d8:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8030de:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8030e3:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8030e8:	e9 45 01 00 00       	jmp    803232 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8030ed:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030f3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8030f9:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8030ff:	0f 87 ba 00 00 00    	ja     8031bf <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803105:	89 d8                	mov    %ebx,%eax
+  803107:	c1 e8 16             	shr    $0x16,%eax
+  80310a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803111:	a8 01                	test   $0x1,%al
+  803113:	74 d8                	je     8030ed <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803115:	89 d8                	mov    %ebx,%eax
+  803117:	c1 e8 0c             	shr    $0xc,%eax
+  80311a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803121:	f6 c2 01             	test   $0x1,%dl
+  803124:	74 cd                	je     8030f3 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803126:	89 da                	mov    %ebx,%edx
+  803128:	80 e6 df             	and    $0xdf,%dh
+  80312b:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803131:	74 c0                	je     8030f3 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803133:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803135:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80313c:	f6 c6 04             	test   $0x4,%dh
+  80313f:	75 53                	jne    803194 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803141:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803148:	f6 c6 08             	test   $0x8,%dh
+  80314b:	75 0c                	jne    803159 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80314d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803154:	f6 c2 02             	test   $0x2,%dl
+  803157:	74 3b                	je     803194 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803159:	83 ec 0c             	sub    $0xc,%esp
+  80315c:	68 05 08 00 00       	push   $0x805
+  803161:	57                   	push   %edi
+  803162:	ff 75 e4             	push   -0x1c(%ebp)
+  803165:	57                   	push   %edi
+  803166:	6a 00                	push   $0x0
+  803168:	e8 1e da ff ff       	call   800b8b <sys_page_map>
+  80316d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80316f:	83 c4 20             	add    $0x20,%esp
+  803172:	85 c0                	test   %eax,%eax
+  803174:	0f 88 a7 00 00 00    	js     803221 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80317a:	83 ec 0c             	sub    $0xc,%esp
+  80317d:	68 05 08 00 00       	push   $0x805
+  803182:	57                   	push   %edi
+  803183:	6a 00                	push   $0x0
+  803185:	57                   	push   %edi
+  803186:	6a 00                	push   $0x0
+  803188:	e8 fe d9 ff ff       	call   800b8b <sys_page_map>
+  80318d:	89 c6                	mov    %eax,%esi
+	return r;
+  80318f:	83 c4 20             	add    $0x20,%esp
+  803192:	eb 21                	jmp    8031b5 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803194:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80319b:	83 ec 0c             	sub    $0xc,%esp
+  80319e:	25 07 0e 00 00       	and    $0xe07,%eax
+  8031a3:	50                   	push   %eax
+  8031a4:	57                   	push   %edi
+  8031a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8031a8:	57                   	push   %edi
+  8031a9:	6a 00                	push   $0x0
+  8031ab:	e8 db d9 ff ff       	call   800b8b <sys_page_map>
+  8031b0:	89 c6                	mov    %eax,%esi
+  8031b2:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8031b5:	85 f6                	test   %esi,%esi
+  8031b7:	0f 89 36 ff ff ff    	jns    8030f3 <fork+0x57>
+  8031bd:	eb 62                	jmp    803221 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031bf:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031c4:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8031c9:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8031cc:	89 f8                	mov    %edi,%eax
+  8031ce:	e8 6f fd ff ff       	call   802f42 <copy_page_to>
+  8031d3:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031d5:	85 c0                	test   %eax,%eax
+  8031d7:	78 48                	js     803221 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031d9:	83 ec 04             	sub    $0x4,%esp
+  8031dc:	6a 07                	push   $0x7
+  8031de:	68 00 f0 bf ee       	push   $0xeebff000
+  8031e3:	57                   	push   %edi
+  8031e4:	e8 57 d9 ff ff       	call   800b40 <sys_page_alloc>
+  8031e9:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031eb:	83 c4 10             	add    $0x10,%esp
+  8031ee:	85 c0                	test   %eax,%eax
+  8031f0:	78 2f                	js     803221 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8031f2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8031f7:	8b 40 64             	mov    0x64(%eax),%eax
+  8031fa:	83 ec 08             	sub    $0x8,%esp
+  8031fd:	50                   	push   %eax
+  8031fe:	57                   	push   %edi
+  8031ff:	e8 a7 da ff ff       	call   800cab <sys_env_set_pgfault_upcall>
+  803204:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803206:	83 c4 10             	add    $0x10,%esp
+  803209:	85 c0                	test   %eax,%eax
+  80320b:	78 14                	js     803221 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80320d:	83 ec 08             	sub    $0x8,%esp
+  803210:	6a 02                	push   $0x2
+  803212:	57                   	push   %edi
+  803213:	e8 ff d9 ff ff       	call   800c17 <sys_env_set_status>
+  803218:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80321a:	83 c4 10             	add    $0x10,%esp
+  80321d:	85 c0                	test   %eax,%eax
+  80321f:	79 11                	jns    803232 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803221:	83 ec 0c             	sub    $0xc,%esp
+  803224:	ff 75 e0             	push   -0x20(%ebp)
+  803227:	e8 85 d8 ff ff       	call   800ab1 <sys_env_destroy>
+	return r;
+  80322c:	83 c4 10             	add    $0x10,%esp
+  80322f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803232:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803235:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803238:	5b                   	pop    %ebx
+  803239:	5e                   	pop    %esi
+  80323a:	5f                   	pop    %edi
+  80323b:	5d                   	pop    %ebp
+  80323c:	c3                   	ret
+
+0080323d <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80323d:	55                   	push   %ebp
+  80323e:	89 e5                	mov    %esp,%ebp
+  803240:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803243:	68 03 3d 80 00       	push   $0x803d03
+  803248:	68 bf 00 00 00       	push   $0xbf
+  80324d:	68 f8 3c 80 00       	push   $0x803cf8
+  803252:	e8 a5 fc ff ff       	call   802efc <_panic>
+
+00803257 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803257:	55                   	push   %ebp
+  803258:	89 e5                	mov    %esp,%ebp
+  80325a:	56                   	push   %esi
+  80325b:	53                   	push   %ebx
+  80325c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80325f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803262:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803265:	85 c0                	test   %eax,%eax
+  803267:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80326c:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80326f:	83 ec 0c             	sub    $0xc,%esp
+  803272:	50                   	push   %eax
+  803273:	e8 10 db ff ff       	call   800d88 <sys_ipc_recv>
+	if (from_env_store)
+  803278:	83 c4 10             	add    $0x10,%esp
+  80327b:	85 f6                	test   %esi,%esi
+  80327d:	74 14                	je     803293 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80327f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803284:	85 c0                	test   %eax,%eax
+  803286:	75 09                	jne    803291 <ipc_recv+0x3a>
+  803288:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80328e:	8b 52 74             	mov    0x74(%edx),%edx
+  803291:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803293:	85 db                	test   %ebx,%ebx
+  803295:	74 25                	je     8032bc <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803297:	85 c0                	test   %eax,%eax
+  803299:	74 0d                	je     8032a8 <ipc_recv+0x51>
+  80329b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8032a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032a4:	5b                   	pop    %ebx
+  8032a5:	5e                   	pop    %esi
+  8032a6:	5d                   	pop    %ebp
+  8032a7:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8032a8:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032ad:	8b 40 78             	mov    0x78(%eax),%eax
+  8032b0:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8032b2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032b7:	8b 40 70             	mov    0x70(%eax),%eax
+  8032ba:	eb e5                	jmp    8032a1 <ipc_recv+0x4a>
+  8032bc:	85 c0                	test   %eax,%eax
+  8032be:	75 e1                	jne    8032a1 <ipc_recv+0x4a>
+  8032c0:	eb f0                	jmp    8032b2 <ipc_recv+0x5b>
+
+008032c2 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8032c2:	55                   	push   %ebp
+  8032c3:	89 e5                	mov    %esp,%ebp
+  8032c5:	57                   	push   %edi
+  8032c6:	56                   	push   %esi
+  8032c7:	53                   	push   %ebx
+  8032c8:	83 ec 0c             	sub    $0xc,%esp
+  8032cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032ce:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032d4:	85 db                	test   %ebx,%ebx
+  8032d6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032db:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8032de:	ff 75 14             	push   0x14(%ebp)
+  8032e1:	53                   	push   %ebx
+  8032e2:	56                   	push   %esi
+  8032e3:	57                   	push   %edi
+  8032e4:	e8 0c da ff ff       	call   800cf5 <sys_ipc_try_send>
+  8032e9:	83 c4 10             	add    $0x10,%esp
+  8032ec:	85 c0                	test   %eax,%eax
+  8032ee:	74 22                	je     803312 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8032f0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032f3:	75 07                	jne    8032fc <ipc_send+0x3a>
+		sys_yield();
+  8032f5:	e8 27 d8 ff ff       	call   800b21 <sys_yield>
+  8032fa:	eb e2                	jmp    8032de <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8032fc:	68 19 3d 80 00       	push   $0x803d19
+  803301:	68 a0 3b 80 00       	push   $0x803ba0
+  803306:	6a 39                	push   $0x39
+  803308:	68 2e 3d 80 00       	push   $0x803d2e
+  80330d:	e8 ea fb ff ff       	call   802efc <_panic>
+	}
+}
+  803312:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803315:	5b                   	pop    %ebx
+  803316:	5e                   	pop    %esi
+  803317:	5f                   	pop    %edi
+  803318:	5d                   	pop    %ebp
+  803319:	c3                   	ret
+
+0080331a <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80331a:	55                   	push   %ebp
+  80331b:	89 e5                	mov    %esp,%ebp
+  80331d:	57                   	push   %edi
+  80331e:	56                   	push   %esi
+  80331f:	53                   	push   %ebx
+  803320:	83 ec 10             	sub    $0x10,%esp
+  803323:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803326:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803329:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80332c:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80332f:	85 c0                	test   %eax,%eax
+  803331:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803336:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803339:	6a 00                	push   $0x0
+  80333b:	ff 33                	push   (%ebx)
+  80333d:	50                   	push   %eax
+  80333e:	e8 02 da ff ff       	call   800d45 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803343:	83 c4 10             	add    $0x10,%esp
+  803346:	85 c0                	test   %eax,%eax
+  803348:	75 3c                	jne    803386 <ipc_recvv+0x6c>
+  80334a:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803350:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803353:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803355:	85 ff                	test   %edi,%edi
+  803357:	74 4e                	je     8033a7 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803359:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80335f:	8b 52 74             	mov    0x74(%edx),%edx
+  803362:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803364:	85 f6                	test   %esi,%esi
+  803366:	74 18                	je     803380 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803368:	85 c0                	test   %eax,%eax
+  80336a:	75 2d                	jne    803399 <ipc_recvv+0x7f>
+  80336c:	a1 00 50 80 00       	mov    0x805000,%eax
+  803371:	8b 40 78             	mov    0x78(%eax),%eax
+  803374:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803376:	a1 00 50 80 00       	mov    0x805000,%eax
+  80337b:	8b 40 70             	mov    0x70(%eax),%eax
+  80337e:	eb 1f                	jmp    80339f <ipc_recvv+0x85>
+  803380:	85 c0                	test   %eax,%eax
+  803382:	75 1b                	jne    80339f <ipc_recvv+0x85>
+  803384:	eb f0                	jmp    803376 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803386:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80338c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803391:	85 ff                	test   %edi,%edi
+  803393:	75 cd                	jne    803362 <ipc_recvv+0x48>
+	if (perm_store)
+  803395:	85 f6                	test   %esi,%esi
+  803397:	74 e7                	je     803380 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803399:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80339f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033a2:	5b                   	pop    %ebx
+  8033a3:	5e                   	pop    %esi
+  8033a4:	5f                   	pop    %edi
+  8033a5:	5d                   	pop    %ebp
+  8033a6:	c3                   	ret
+	if (perm_store)
+  8033a7:	85 f6                	test   %esi,%esi
+  8033a9:	75 bd                	jne    803368 <ipc_recvv+0x4e>
+  8033ab:	eb c9                	jmp    803376 <ipc_recvv+0x5c>
+
+008033ad <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8033ad:	55                   	push   %ebp
+  8033ae:	89 e5                	mov    %esp,%ebp
+  8033b0:	57                   	push   %edi
+  8033b1:	56                   	push   %esi
+  8033b2:	53                   	push   %ebx
+  8033b3:	83 ec 0c             	sub    $0xc,%esp
+  8033b6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8033bf:	ff 75 14             	push   0x14(%ebp)
+  8033c2:	53                   	push   %ebx
+  8033c3:	56                   	push   %esi
+  8033c4:	57                   	push   %edi
+  8033c5:	e8 53 d9 ff ff       	call   800d1d <sys_ipc_try_sendv>
+  8033ca:	83 c4 10             	add    $0x10,%esp
+  8033cd:	85 c0                	test   %eax,%eax
+  8033cf:	74 22                	je     8033f3 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8033d1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033d4:	75 07                	jne    8033dd <ipc_sendv+0x30>
+		sys_yield();
+  8033d6:	e8 46 d7 ff ff       	call   800b21 <sys_yield>
+  8033db:	eb e2                	jmp    8033bf <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8033dd:	68 19 3d 80 00       	push   $0x803d19
+  8033e2:	68 a0 3b 80 00       	push   $0x803ba0
+  8033e7:	6a 5c                	push   $0x5c
+  8033e9:	68 2e 3d 80 00       	push   $0x803d2e
+  8033ee:	e8 09 fb ff ff       	call   802efc <_panic>
+	}
+}
+  8033f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033f6:	5b                   	pop    %ebx
+  8033f7:	5e                   	pop    %esi
+  8033f8:	5f                   	pop    %edi
+  8033f9:	5d                   	pop    %ebp
+  8033fa:	c3                   	ret
+
+008033fb <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8033fb:	55                   	push   %ebp
+  8033fc:	89 e5                	mov    %esp,%ebp
+  8033fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803401:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803406:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80340c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803412:	8b 52 50             	mov    0x50(%edx),%edx
+  803415:	39 ca                	cmp    %ecx,%edx
+  803417:	74 11                	je     80342a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803419:	83 c0 01             	add    $0x1,%eax
+  80341c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803421:	75 e3                	jne    803406 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803423:	b8 00 00 00 00       	mov    $0x0,%eax
+  803428:	eb 0e                	jmp    803438 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80342a:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803430:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803435:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803438:	5d                   	pop    %ebp
+  803439:	c3                   	ret
+
+0080343a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80343a:	55                   	push   %ebp
+  80343b:	89 e5                	mov    %esp,%ebp
+  80343d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803440:	89 c2                	mov    %eax,%edx
+  803442:	c1 ea 16             	shr    $0x16,%edx
+  803445:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80344c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803451:	f6 c1 01             	test   $0x1,%cl
+  803454:	74 22                	je     803478 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803456:	c1 e8 0c             	shr    $0xc,%eax
+  803459:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803460:	a8 01                	test   $0x1,%al
+  803462:	74 14                	je     803478 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803464:	c1 e8 0c             	shr    $0xc,%eax
+  803467:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80346a:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803471:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803475:	0f b7 d2             	movzwl %dx,%edx
+}
+  803478:	89 d0                	mov    %edx,%eax
+  80347a:	5d                   	pop    %ebp
+  80347b:	c3                   	ret
+
+0080347c <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80347c:	55                   	push   %ebp
+  80347d:	89 e5                	mov    %esp,%ebp
+  80347f:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803482:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  803489:	74 0a                	je     803495 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80348b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80348e:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  803493:	c9                   	leave
+  803494:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803495:	83 ec 04             	sub    $0x4,%esp
+  803498:	6a 07                	push   $0x7
+  80349a:	68 00 f0 bf ee       	push   $0xeebff000
+  80349f:	6a 00                	push   $0x0
+  8034a1:	e8 9a d6 ff ff       	call   800b40 <sys_page_alloc>
+  8034a6:	83 c4 10             	add    $0x10,%esp
+  8034a9:	85 c0                	test   %eax,%eax
+  8034ab:	75 2c                	jne    8034d9 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8034ad:	83 ec 08             	sub    $0x8,%esp
+  8034b0:	68 ef 34 80 00       	push   $0x8034ef
+  8034b5:	6a 00                	push   $0x0
+  8034b7:	e8 ef d7 ff ff       	call   800cab <sys_env_set_pgfault_upcall>
+  8034bc:	83 c4 10             	add    $0x10,%esp
+  8034bf:	85 c0                	test   %eax,%eax
+  8034c1:	74 c8                	je     80348b <set_pgfault_handler+0xf>
+  8034c3:	68 80 3d 80 00       	push   $0x803d80
+  8034c8:	68 a0 3b 80 00       	push   $0x803ba0
+  8034cd:	6a 20                	push   $0x20
+  8034cf:	68 b0 3d 80 00       	push   $0x803db0
+  8034d4:	e8 23 fa ff ff       	call   802efc <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034d9:	68 38 3d 80 00       	push   $0x803d38
+  8034de:	68 a0 3b 80 00       	push   $0x803ba0
+  8034e3:	6a 1e                	push   $0x1e
+  8034e5:	68 b0 3d 80 00       	push   $0x803db0
+  8034ea:	e8 0d fa ff ff       	call   802efc <_panic>
+
+008034ef <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8034ef:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8034f0:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  8034f5:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8034f7:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8034fa:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8034ff:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803504:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803508:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80350b:	83 c4 08             	add    $0x8,%esp
+	popal
+  80350e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  80350f:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803512:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803513:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803514:	c3                   	ret
+
+00803515 <dm>:
+  803515:	55                   	push   %ebp
+  803516:	57                   	push   %edi
+  803517:	56                   	push   %esi
+  803518:	53                   	push   %ebx
+  803519:	83 ec 24             	sub    $0x24,%esp
+  80351c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803520:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803524:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803528:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80352c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803530:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803534:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803538:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80353d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803542:	ba 00 00 00 00       	mov    $0x0,%edx
+  803547:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80354e:	00 
+  80354f:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803556:	00 
+  803557:	89 fb                	mov    %edi,%ebx
+  803559:	eb 08                	jmp    803563 <dm+0x4e>
+  80355b:	83 e9 01             	sub    $0x1,%ecx
+  80355e:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803561:	74 68                	je     8035cb <dm+0xb6>
+  803563:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803567:	01 c0                	add    %eax,%eax
+  803569:	89 c6                	mov    %eax,%esi
+  80356b:	89 d7                	mov    %edx,%edi
+  80356d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803571:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803575:	0f ad d0             	shrd   %cl,%edx,%eax
+  803578:	d3 ea                	shr    %cl,%edx
+  80357a:	f6 c1 20             	test   $0x20,%cl
+  80357d:	74 04                	je     803583 <dm+0x6e>
+  80357f:	89 d0                	mov    %edx,%eax
+  803581:	31 d2                	xor    %edx,%edx
+  803583:	83 e0 01             	and    $0x1,%eax
+  803586:	89 04 24             	mov    %eax,(%esp)
+  803589:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803590:	00 
+  803591:	8b 04 24             	mov    (%esp),%eax
+  803594:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803598:	09 f0                	or     %esi,%eax
+  80359a:	09 fa                	or     %edi,%edx
+  80359c:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8035a0:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8035a4:	39 f0                	cmp    %esi,%eax
+  8035a6:	89 d5                	mov    %edx,%ebp
+  8035a8:	19 fd                	sbb    %edi,%ebp
+  8035aa:	72 af                	jb     80355b <dm+0x46>
+  8035ac:	29 f0                	sub    %esi,%eax
+  8035ae:	19 fa                	sbb    %edi,%edx
+  8035b0:	89 cf                	mov    %ecx,%edi
+  8035b2:	c1 ef 05             	shr    $0x5,%edi
+  8035b5:	83 e7 01             	and    $0x1,%edi
+  8035b8:	89 fe                	mov    %edi,%esi
+  8035ba:	83 f6 01             	xor    $0x1,%esi
+  8035bd:	d3 e6                	shl    %cl,%esi
+  8035bf:	d3 e7                	shl    %cl,%edi
+  8035c1:	09 74 24 18          	or     %esi,0x18(%esp)
+  8035c5:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8035c9:	eb 90                	jmp    80355b <dm+0x46>
+  8035cb:	85 db                	test   %ebx,%ebx
+  8035cd:	74 05                	je     8035d4 <dm+0xbf>
+  8035cf:	89 03                	mov    %eax,(%ebx)
+  8035d1:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035d4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035d8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035dc:	83 c4 24             	add    $0x24,%esp
+  8035df:	5b                   	pop    %ebx
+  8035e0:	5e                   	pop    %esi
+  8035e1:	5f                   	pop    %edi
+  8035e2:	5d                   	pop    %ebp
+  8035e3:	c3                   	ret
+
+008035e4 <__udivdi3>:
+  8035e4:	83 ec 08             	sub    $0x8,%esp
+  8035e7:	6a 00                	push   $0x0
+  8035e9:	ff 74 24 1c          	push   0x1c(%esp)
+  8035ed:	ff 74 24 1c          	push   0x1c(%esp)
+  8035f1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035f5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035f9:	e8 17 ff ff ff       	call   803515 <dm>
+  8035fe:	83 c4 14             	add    $0x14,%esp
+  803601:	c3                   	ret
+
+00803602 <__umoddi3>:
+  803602:	83 ec 18             	sub    $0x18,%esp
+  803605:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803609:	50                   	push   %eax
+  80360a:	ff 74 24 2c          	push   0x2c(%esp)
+  80360e:	ff 74 24 2c          	push   0x2c(%esp)
+  803612:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803616:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80361a:	e8 f6 fe ff ff       	call   803515 <dm>
+  80361f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803623:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803627:	83 c4 24             	add    $0x24,%esp
+  80362a:	c3                   	ret
+
+0080362b <__divdi3>:
+  80362b:	53                   	push   %ebx
+  80362c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803630:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803634:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803638:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80363c:	85 d2                	test   %edx,%edx
+  80363e:	78 15                	js     803655 <__divdi3+0x2a>
+  803640:	85 db                	test   %ebx,%ebx
+  803642:	78 34                	js     803678 <__divdi3+0x4d>
+  803644:	83 ec 04             	sub    $0x4,%esp
+  803647:	6a 00                	push   $0x0
+  803649:	53                   	push   %ebx
+  80364a:	51                   	push   %ecx
+  80364b:	e8 c5 fe ff ff       	call   803515 <dm>
+  803650:	83 c4 10             	add    $0x10,%esp
+  803653:	eb 21                	jmp    803676 <__divdi3+0x4b>
+  803655:	f7 d8                	neg    %eax
+  803657:	83 d2 00             	adc    $0x0,%edx
+  80365a:	f7 da                	neg    %edx
+  80365c:	85 db                	test   %ebx,%ebx
+  80365e:	78 30                	js     803690 <__divdi3+0x65>
+  803660:	83 ec 04             	sub    $0x4,%esp
+  803663:	6a 00                	push   $0x0
+  803665:	53                   	push   %ebx
+  803666:	51                   	push   %ecx
+  803667:	e8 a9 fe ff ff       	call   803515 <dm>
+  80366c:	83 c4 10             	add    $0x10,%esp
+  80366f:	f7 d8                	neg    %eax
+  803671:	83 d2 00             	adc    $0x0,%edx
+  803674:	f7 da                	neg    %edx
+  803676:	5b                   	pop    %ebx
+  803677:	c3                   	ret
+  803678:	83 ec 04             	sub    $0x4,%esp
+  80367b:	6a 00                	push   $0x0
+  80367d:	f7 d9                	neg    %ecx
+  80367f:	83 d3 00             	adc    $0x0,%ebx
+  803682:	f7 db                	neg    %ebx
+  803684:	53                   	push   %ebx
+  803685:	51                   	push   %ecx
+  803686:	e8 8a fe ff ff       	call   803515 <dm>
+  80368b:	83 c4 10             	add    $0x10,%esp
+  80368e:	eb df                	jmp    80366f <__divdi3+0x44>
+  803690:	83 ec 04             	sub    $0x4,%esp
+  803693:	6a 00                	push   $0x0
+  803695:	f7 d9                	neg    %ecx
+  803697:	83 d3 00             	adc    $0x0,%ebx
+  80369a:	f7 db                	neg    %ebx
+  80369c:	53                   	push   %ebx
+  80369d:	51                   	push   %ecx
+  80369e:	e8 72 fe ff ff       	call   803515 <dm>
+  8036a3:	83 c4 10             	add    $0x10,%esp
+  8036a6:	eb ce                	jmp    803676 <__divdi3+0x4b>
+
+008036a8 <__moddi3>:
+  8036a8:	55                   	push   %ebp
+  8036a9:	57                   	push   %edi
+  8036aa:	56                   	push   %esi
+  8036ab:	53                   	push   %ebx
+  8036ac:	83 ec 24             	sub    $0x24,%esp
+  8036af:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036b3:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036b7:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036bb:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036bf:	85 d2                	test   %edx,%edx
+  8036c1:	78 3b                	js     8036fe <__moddi3+0x56>
+  8036c3:	83 ec 04             	sub    $0x4,%esp
+  8036c6:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036ca:	56                   	push   %esi
+  8036cb:	89 ce                	mov    %ecx,%esi
+  8036cd:	f7 de                	neg    %esi
+  8036cf:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8036d3:	89 de                	mov    %ebx,%esi
+  8036d5:	83 d6 00             	adc    $0x0,%esi
+  8036d8:	f7 de                	neg    %esi
+  8036da:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8036de:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8036e2:	0f 48 f1             	cmovs  %ecx,%esi
+  8036e5:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8036ea:	53                   	push   %ebx
+  8036eb:	56                   	push   %esi
+  8036ec:	e8 24 fe ff ff       	call   803515 <dm>
+  8036f1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036f5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036f9:	83 c4 10             	add    $0x10,%esp
+  8036fc:	eb 47                	jmp    803745 <__moddi3+0x9d>
+  8036fe:	f7 d8                	neg    %eax
+  803700:	83 d2 00             	adc    $0x0,%edx
+  803703:	f7 da                	neg    %edx
+  803705:	83 ec 04             	sub    $0x4,%esp
+  803708:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80370c:	56                   	push   %esi
+  80370d:	89 cf                	mov    %ecx,%edi
+  80370f:	f7 df                	neg    %edi
+  803711:	89 de                	mov    %ebx,%esi
+  803713:	83 d6 00             	adc    $0x0,%esi
+  803716:	f7 de                	neg    %esi
+  803718:	0f 49 cf             	cmovns %edi,%ecx
+  80371b:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80371f:	0f 49 de             	cmovns %esi,%ebx
+  803722:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803726:	ff 74 24 0c          	push   0xc(%esp)
+  80372a:	ff 74 24 0c          	push   0xc(%esp)
+  80372e:	e8 e2 fd ff ff       	call   803515 <dm>
+  803733:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803737:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80373b:	f7 d8                	neg    %eax
+  80373d:	83 d2 00             	adc    $0x0,%edx
+  803740:	f7 da                	neg    %edx
+  803742:	83 c4 10             	add    $0x10,%esp
+  803745:	83 c4 24             	add    $0x24,%esp
+  803748:	5b                   	pop    %ebx
+  803749:	5e                   	pop    %esi
+  80374a:	5f                   	pop    %edi
+  80374b:	5d                   	pop    %ebp
+  80374c:	c3                   	ret
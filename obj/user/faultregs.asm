@@ -0,0 +1,8073 @@
+
+obj/user/faultregs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b0 05 00 00       	call   8005e1 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <check_regs>:
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs* a, const char *an, struct regs* b, const char *bn,
+	   const char *testname)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	89 c6                	mov    %eax,%esi
+  80003e:	89 cb                	mov    %ecx,%ebx
+	int mismatch = 0;
+
+	cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  800040:	ff 75 08             	push   0x8(%ebp)
+  800043:	52                   	push   %edx
+  800044:	68 11 3d 80 00       	push   $0x803d11
+  800049:	68 e0 3c 80 00       	push   $0x803ce0
+  80004e:	e8 cc 06 00 00       	call   80071f <cprintf>
+			cprintf("MISMATCH\n");				\
+			mismatch = 1;					\
+		}							\
+	} while (0)
+
+	CHECK(edi, regs.reg_edi);
+  800053:	ff 33                	push   (%ebx)
+  800055:	ff 36                	push   (%esi)
+  800057:	68 f0 3c 80 00       	push   $0x803cf0
+  80005c:	68 f4 3c 80 00       	push   $0x803cf4
+  800061:	e8 b9 06 00 00       	call   80071f <cprintf>
+  800066:	83 c4 20             	add    $0x20,%esp
+  800069:	8b 03                	mov    (%ebx),%eax
+  80006b:	39 06                	cmp    %eax,(%esi)
+  80006d:	0f 84 2e 02 00 00    	je     8002a1 <check_regs+0x26e>
+  800073:	83 ec 0c             	sub    $0xc,%esp
+  800076:	68 08 3d 80 00       	push   $0x803d08
+  80007b:	e8 9f 06 00 00       	call   80071f <cprintf>
+  800080:	83 c4 10             	add    $0x10,%esp
+  800083:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(esi, regs.reg_esi);
+  800088:	ff 73 04             	push   0x4(%ebx)
+  80008b:	ff 76 04             	push   0x4(%esi)
+  80008e:	68 12 3d 80 00       	push   $0x803d12
+  800093:	68 f4 3c 80 00       	push   $0x803cf4
+  800098:	e8 82 06 00 00       	call   80071f <cprintf>
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8000a3:	39 46 04             	cmp    %eax,0x4(%esi)
+  8000a6:	0f 84 0f 02 00 00    	je     8002bb <check_regs+0x288>
+  8000ac:	83 ec 0c             	sub    $0xc,%esp
+  8000af:	68 08 3d 80 00       	push   $0x803d08
+  8000b4:	e8 66 06 00 00       	call   80071f <cprintf>
+  8000b9:	83 c4 10             	add    $0x10,%esp
+  8000bc:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebp, regs.reg_ebp);
+  8000c1:	ff 73 08             	push   0x8(%ebx)
+  8000c4:	ff 76 08             	push   0x8(%esi)
+  8000c7:	68 16 3d 80 00       	push   $0x803d16
+  8000cc:	68 f4 3c 80 00       	push   $0x803cf4
+  8000d1:	e8 49 06 00 00       	call   80071f <cprintf>
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8000dc:	39 46 08             	cmp    %eax,0x8(%esi)
+  8000df:	0f 84 eb 01 00 00    	je     8002d0 <check_regs+0x29d>
+  8000e5:	83 ec 0c             	sub    $0xc,%esp
+  8000e8:	68 08 3d 80 00       	push   $0x803d08
+  8000ed:	e8 2d 06 00 00       	call   80071f <cprintf>
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebx, regs.reg_ebx);
+  8000fa:	ff 73 10             	push   0x10(%ebx)
+  8000fd:	ff 76 10             	push   0x10(%esi)
+  800100:	68 1a 3d 80 00       	push   $0x803d1a
+  800105:	68 f4 3c 80 00       	push   $0x803cf4
+  80010a:	e8 10 06 00 00       	call   80071f <cprintf>
+  80010f:	83 c4 10             	add    $0x10,%esp
+  800112:	8b 43 10             	mov    0x10(%ebx),%eax
+  800115:	39 46 10             	cmp    %eax,0x10(%esi)
+  800118:	0f 84 c7 01 00 00    	je     8002e5 <check_regs+0x2b2>
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	68 08 3d 80 00       	push   $0x803d08
+  800126:	e8 f4 05 00 00       	call   80071f <cprintf>
+  80012b:	83 c4 10             	add    $0x10,%esp
+  80012e:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(edx, regs.reg_edx);
+  800133:	ff 73 14             	push   0x14(%ebx)
+  800136:	ff 76 14             	push   0x14(%esi)
+  800139:	68 1e 3d 80 00       	push   $0x803d1e
+  80013e:	68 f4 3c 80 00       	push   $0x803cf4
+  800143:	e8 d7 05 00 00       	call   80071f <cprintf>
+  800148:	83 c4 10             	add    $0x10,%esp
+  80014b:	8b 43 14             	mov    0x14(%ebx),%eax
+  80014e:	39 46 14             	cmp    %eax,0x14(%esi)
+  800151:	0f 84 a3 01 00 00    	je     8002fa <check_regs+0x2c7>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	68 08 3d 80 00       	push   $0x803d08
+  80015f:	e8 bb 05 00 00       	call   80071f <cprintf>
+  800164:	83 c4 10             	add    $0x10,%esp
+  800167:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ecx, regs.reg_ecx);
+  80016c:	ff 73 18             	push   0x18(%ebx)
+  80016f:	ff 76 18             	push   0x18(%esi)
+  800172:	68 22 3d 80 00       	push   $0x803d22
+  800177:	68 f4 3c 80 00       	push   $0x803cf4
+  80017c:	e8 9e 05 00 00       	call   80071f <cprintf>
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	8b 43 18             	mov    0x18(%ebx),%eax
+  800187:	39 46 18             	cmp    %eax,0x18(%esi)
+  80018a:	0f 84 7f 01 00 00    	je     80030f <check_regs+0x2dc>
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	68 08 3d 80 00       	push   $0x803d08
+  800198:	e8 82 05 00 00       	call   80071f <cprintf>
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eax, regs.reg_eax);
+  8001a5:	ff 73 1c             	push   0x1c(%ebx)
+  8001a8:	ff 76 1c             	push   0x1c(%esi)
+  8001ab:	68 26 3d 80 00       	push   $0x803d26
+  8001b0:	68 f4 3c 80 00       	push   $0x803cf4
+  8001b5:	e8 65 05 00 00       	call   80071f <cprintf>
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8001c0:	39 46 1c             	cmp    %eax,0x1c(%esi)
+  8001c3:	0f 84 5b 01 00 00    	je     800324 <check_regs+0x2f1>
+  8001c9:	83 ec 0c             	sub    $0xc,%esp
+  8001cc:	68 08 3d 80 00       	push   $0x803d08
+  8001d1:	e8 49 05 00 00       	call   80071f <cprintf>
+  8001d6:	83 c4 10             	add    $0x10,%esp
+  8001d9:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eip, eip);
+  8001de:	ff 73 20             	push   0x20(%ebx)
+  8001e1:	ff 76 20             	push   0x20(%esi)
+  8001e4:	68 2a 3d 80 00       	push   $0x803d2a
+  8001e9:	68 f4 3c 80 00       	push   $0x803cf4
+  8001ee:	e8 2c 05 00 00       	call   80071f <cprintf>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+  8001f6:	8b 43 20             	mov    0x20(%ebx),%eax
+  8001f9:	39 46 20             	cmp    %eax,0x20(%esi)
+  8001fc:	0f 84 37 01 00 00    	je     800339 <check_regs+0x306>
+  800202:	83 ec 0c             	sub    $0xc,%esp
+  800205:	68 08 3d 80 00       	push   $0x803d08
+  80020a:	e8 10 05 00 00       	call   80071f <cprintf>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eflags, eflags);
+  800217:	ff 73 24             	push   0x24(%ebx)
+  80021a:	ff 76 24             	push   0x24(%esi)
+  80021d:	68 2e 3d 80 00       	push   $0x803d2e
+  800222:	68 f4 3c 80 00       	push   $0x803cf4
+  800227:	e8 f3 04 00 00       	call   80071f <cprintf>
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	8b 43 24             	mov    0x24(%ebx),%eax
+  800232:	39 46 24             	cmp    %eax,0x24(%esi)
+  800235:	0f 84 13 01 00 00    	je     80034e <check_regs+0x31b>
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	68 08 3d 80 00       	push   $0x803d08
+  800243:	e8 d7 04 00 00       	call   80071f <cprintf>
+	CHECK(esp, esp);
+  800248:	ff 73 28             	push   0x28(%ebx)
+  80024b:	ff 76 28             	push   0x28(%esi)
+  80024e:	68 35 3d 80 00       	push   $0x803d35
+  800253:	68 f4 3c 80 00       	push   $0x803cf4
+  800258:	e8 c2 04 00 00       	call   80071f <cprintf>
+  80025d:	83 c4 20             	add    $0x20,%esp
+  800260:	8b 43 28             	mov    0x28(%ebx),%eax
+  800263:	39 46 28             	cmp    %eax,0x28(%esi)
+  800266:	0f 84 53 01 00 00    	je     8003bf <check_regs+0x38c>
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+  80026f:	68 08 3d 80 00       	push   $0x803d08
+  800274:	e8 a6 04 00 00       	call   80071f <cprintf>
+
+#undef CHECK
+
+	cprintf("Registers %s ", testname);
+  800279:	83 c4 08             	add    $0x8,%esp
+  80027c:	ff 75 0c             	push   0xc(%ebp)
+  80027f:	68 39 3d 80 00       	push   $0x803d39
+  800284:	e8 96 04 00 00       	call   80071f <cprintf>
+  800289:	83 c4 10             	add    $0x10,%esp
+	if (!mismatch)
+		cprintf("OK\n");
+	else
+		cprintf("MISMATCH\n");
+  80028c:	83 ec 0c             	sub    $0xc,%esp
+  80028f:	68 08 3d 80 00       	push   $0x803d08
+  800294:	e8 86 04 00 00       	call   80071f <cprintf>
+  800299:	83 c4 10             	add    $0x10,%esp
+}
+  80029c:	e9 16 01 00 00       	jmp    8003b7 <check_regs+0x384>
+	CHECK(edi, regs.reg_edi);
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	68 04 3d 80 00       	push   $0x803d04
+  8002a9:	e8 71 04 00 00       	call   80071f <cprintf>
+  8002ae:	83 c4 10             	add    $0x10,%esp
+	int mismatch = 0;
+  8002b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b6:	e9 cd fd ff ff       	jmp    800088 <check_regs+0x55>
+	CHECK(esi, regs.reg_esi);
+  8002bb:	83 ec 0c             	sub    $0xc,%esp
+  8002be:	68 04 3d 80 00       	push   $0x803d04
+  8002c3:	e8 57 04 00 00       	call   80071f <cprintf>
+  8002c8:	83 c4 10             	add    $0x10,%esp
+  8002cb:	e9 f1 fd ff ff       	jmp    8000c1 <check_regs+0x8e>
+	CHECK(ebp, regs.reg_ebp);
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+  8002d3:	68 04 3d 80 00       	push   $0x803d04
+  8002d8:	e8 42 04 00 00       	call   80071f <cprintf>
+  8002dd:	83 c4 10             	add    $0x10,%esp
+  8002e0:	e9 15 fe ff ff       	jmp    8000fa <check_regs+0xc7>
+	CHECK(ebx, regs.reg_ebx);
+  8002e5:	83 ec 0c             	sub    $0xc,%esp
+  8002e8:	68 04 3d 80 00       	push   $0x803d04
+  8002ed:	e8 2d 04 00 00       	call   80071f <cprintf>
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	e9 39 fe ff ff       	jmp    800133 <check_regs+0x100>
+	CHECK(edx, regs.reg_edx);
+  8002fa:	83 ec 0c             	sub    $0xc,%esp
+  8002fd:	68 04 3d 80 00       	push   $0x803d04
+  800302:	e8 18 04 00 00       	call   80071f <cprintf>
+  800307:	83 c4 10             	add    $0x10,%esp
+  80030a:	e9 5d fe ff ff       	jmp    80016c <check_regs+0x139>
+	CHECK(ecx, regs.reg_ecx);
+  80030f:	83 ec 0c             	sub    $0xc,%esp
+  800312:	68 04 3d 80 00       	push   $0x803d04
+  800317:	e8 03 04 00 00       	call   80071f <cprintf>
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	e9 81 fe ff ff       	jmp    8001a5 <check_regs+0x172>
+	CHECK(eax, regs.reg_eax);
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	68 04 3d 80 00       	push   $0x803d04
+  80032c:	e8 ee 03 00 00       	call   80071f <cprintf>
+  800331:	83 c4 10             	add    $0x10,%esp
+  800334:	e9 a5 fe ff ff       	jmp    8001de <check_regs+0x1ab>
+	CHECK(eip, eip);
+  800339:	83 ec 0c             	sub    $0xc,%esp
+  80033c:	68 04 3d 80 00       	push   $0x803d04
+  800341:	e8 d9 03 00 00       	call   80071f <cprintf>
+  800346:	83 c4 10             	add    $0x10,%esp
+  800349:	e9 c9 fe ff ff       	jmp    800217 <check_regs+0x1e4>
+	CHECK(eflags, eflags);
+  80034e:	83 ec 0c             	sub    $0xc,%esp
+  800351:	68 04 3d 80 00       	push   $0x803d04
+  800356:	e8 c4 03 00 00       	call   80071f <cprintf>
+	CHECK(esp, esp);
+  80035b:	ff 73 28             	push   0x28(%ebx)
+  80035e:	ff 76 28             	push   0x28(%esi)
+  800361:	68 35 3d 80 00       	push   $0x803d35
+  800366:	68 f4 3c 80 00       	push   $0x803cf4
+  80036b:	e8 af 03 00 00       	call   80071f <cprintf>
+  800370:	83 c4 20             	add    $0x20,%esp
+  800373:	8b 43 28             	mov    0x28(%ebx),%eax
+  800376:	39 46 28             	cmp    %eax,0x28(%esi)
+  800379:	0f 85 ed fe ff ff    	jne    80026c <check_regs+0x239>
+  80037f:	83 ec 0c             	sub    $0xc,%esp
+  800382:	68 04 3d 80 00       	push   $0x803d04
+  800387:	e8 93 03 00 00       	call   80071f <cprintf>
+	cprintf("Registers %s ", testname);
+  80038c:	83 c4 08             	add    $0x8,%esp
+  80038f:	ff 75 0c             	push   0xc(%ebp)
+  800392:	68 39 3d 80 00       	push   $0x803d39
+  800397:	e8 83 03 00 00       	call   80071f <cprintf>
+	if (!mismatch)
+  80039c:	83 c4 10             	add    $0x10,%esp
+  80039f:	85 ff                	test   %edi,%edi
+  8003a1:	0f 85 e5 fe ff ff    	jne    80028c <check_regs+0x259>
+		cprintf("OK\n");
+  8003a7:	83 ec 0c             	sub    $0xc,%esp
+  8003aa:	68 04 3d 80 00       	push   $0x803d04
+  8003af:	e8 6b 03 00 00       	call   80071f <cprintf>
+  8003b4:	83 c4 10             	add    $0x10,%esp
+}
+  8003b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ba:	5b                   	pop    %ebx
+  8003bb:	5e                   	pop    %esi
+  8003bc:	5f                   	pop    %edi
+  8003bd:	5d                   	pop    %ebp
+  8003be:	c3                   	ret
+	CHECK(esp, esp);
+  8003bf:	83 ec 0c             	sub    $0xc,%esp
+  8003c2:	68 04 3d 80 00       	push   $0x803d04
+  8003c7:	e8 53 03 00 00       	call   80071f <cprintf>
+	cprintf("Registers %s ", testname);
+  8003cc:	83 c4 08             	add    $0x8,%esp
+  8003cf:	ff 75 0c             	push   0xc(%ebp)
+  8003d2:	68 39 3d 80 00       	push   $0x803d39
+  8003d7:	e8 43 03 00 00       	call   80071f <cprintf>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	e9 a8 fe ff ff       	jmp    80028c <check_regs+0x259>
+
+008003e4 <pgfault>:
+
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8003e4:	55                   	push   %ebp
+  8003e5:	89 e5                	mov    %esp,%ebp
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	8b 45 08             	mov    0x8(%ebp),%eax
+	int r;
+
+	if (utf->utf_fault_va != (uint32_t)UTEMP)
+  8003ed:	8b 10                	mov    (%eax),%edx
+  8003ef:	81 fa 00 00 40 00    	cmp    $0x400000,%edx
+  8003f5:	0f 85 a3 00 00 00    	jne    80049e <pgfault+0xba>
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+		      utf->utf_fault_va, utf->utf_eip);
+
+	// Check registers in UTrapframe
+	during.regs = utf->utf_regs;
+  8003fb:	8b 50 08             	mov    0x8(%eax),%edx
+  8003fe:	89 15 40 60 80 00    	mov    %edx,0x806040
+  800404:	8b 50 0c             	mov    0xc(%eax),%edx
+  800407:	89 15 44 60 80 00    	mov    %edx,0x806044
+  80040d:	8b 50 10             	mov    0x10(%eax),%edx
+  800410:	89 15 48 60 80 00    	mov    %edx,0x806048
+  800416:	8b 50 14             	mov    0x14(%eax),%edx
+  800419:	89 15 4c 60 80 00    	mov    %edx,0x80604c
+  80041f:	8b 50 18             	mov    0x18(%eax),%edx
+  800422:	89 15 50 60 80 00    	mov    %edx,0x806050
+  800428:	8b 50 1c             	mov    0x1c(%eax),%edx
+  80042b:	89 15 54 60 80 00    	mov    %edx,0x806054
+  800431:	8b 50 20             	mov    0x20(%eax),%edx
+  800434:	89 15 58 60 80 00    	mov    %edx,0x806058
+  80043a:	8b 50 24             	mov    0x24(%eax),%edx
+  80043d:	89 15 5c 60 80 00    	mov    %edx,0x80605c
+	during.eip = utf->utf_eip;
+  800443:	8b 50 28             	mov    0x28(%eax),%edx
+  800446:	89 15 60 60 80 00    	mov    %edx,0x806060
+	during.eflags = utf->utf_eflags & ~FL_RF;
+  80044c:	8b 50 2c             	mov    0x2c(%eax),%edx
+  80044f:	81 e2 ff ff fe ff    	and    $0xfffeffff,%edx
+  800455:	89 15 64 60 80 00    	mov    %edx,0x806064
+	during.esp = utf->utf_esp;
+  80045b:	8b 40 30             	mov    0x30(%eax),%eax
+  80045e:	a3 68 60 80 00       	mov    %eax,0x806068
+	check_regs(&before, "before", &during, "during", "in UTrapframe");
+  800463:	83 ec 08             	sub    $0x8,%esp
+  800466:	68 5f 3d 80 00       	push   $0x803d5f
+  80046b:	68 6d 3d 80 00       	push   $0x803d6d
+  800470:	b9 40 60 80 00       	mov    $0x806040,%ecx
+  800475:	ba 58 3d 80 00       	mov    $0x803d58,%edx
+  80047a:	b8 80 60 80 00       	mov    $0x806080,%eax
+  80047f:	e8 af fb ff ff       	call   800033 <check_regs>
+
+	// Map UTEMP so the write succeeds
+	if ((r = sys_page_alloc(0, UTEMP, PTE_U|PTE_P|PTE_W)) < 0)
+  800484:	83 c4 0c             	add    $0xc,%esp
+  800487:	6a 07                	push   $0x7
+  800489:	68 00 00 40 00       	push   $0x400000
+  80048e:	6a 00                	push   $0x0
+  800490:	e8 84 0c 00 00       	call   801119 <sys_page_alloc>
+  800495:	83 c4 10             	add    $0x10,%esp
+  800498:	85 c0                	test   %eax,%eax
+  80049a:	78 1a                	js     8004b6 <pgfault+0xd2>
+		panic("sys_page_alloc: %e", r);
+}
+  80049c:	c9                   	leave
+  80049d:	c3                   	ret
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+  80049e:	83 ec 0c             	sub    $0xc,%esp
+  8004a1:	ff 70 28             	push   0x28(%eax)
+  8004a4:	52                   	push   %edx
+  8004a5:	68 a0 3d 80 00       	push   $0x803da0
+  8004aa:	6a 50                	push   $0x50
+  8004ac:	68 47 3d 80 00       	push   $0x803d47
+  8004b1:	e8 8e 01 00 00       	call   800644 <_panic>
+		panic("sys_page_alloc: %e", r);
+  8004b6:	50                   	push   %eax
+  8004b7:	68 74 3d 80 00       	push   $0x803d74
+  8004bc:	6a 5c                	push   $0x5c
+  8004be:	68 47 3d 80 00       	push   $0x803d47
+  8004c3:	e8 7c 01 00 00       	call   800644 <_panic>
+
+008004c8 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8004c8:	55                   	push   %ebp
+  8004c9:	89 e5                	mov    %esp,%ebp
+  8004cb:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8004ce:	68 e4 03 80 00       	push   $0x8003e4
+  8004d3:	e8 42 10 00 00       	call   80151a <set_pgfault_handler>
+
+	asm volatile(
+  8004d8:	50                   	push   %eax
+  8004d9:	9c                   	pushf
+  8004da:	58                   	pop    %eax
+  8004db:	0d d5 08 00 00       	or     $0x8d5,%eax
+  8004e0:	50                   	push   %eax
+  8004e1:	9d                   	popf
+  8004e2:	a3 a4 60 80 00       	mov    %eax,0x8060a4
+  8004e7:	8d 05 22 05 80 00    	lea    0x800522,%eax
+  8004ed:	a3 a0 60 80 00       	mov    %eax,0x8060a0
+  8004f2:	58                   	pop    %eax
+  8004f3:	89 3d 80 60 80 00    	mov    %edi,0x806080
+  8004f9:	89 35 84 60 80 00    	mov    %esi,0x806084
+  8004ff:	89 2d 88 60 80 00    	mov    %ebp,0x806088
+  800505:	89 1d 90 60 80 00    	mov    %ebx,0x806090
+  80050b:	89 15 94 60 80 00    	mov    %edx,0x806094
+  800511:	89 0d 98 60 80 00    	mov    %ecx,0x806098
+  800517:	a3 9c 60 80 00       	mov    %eax,0x80609c
+  80051c:	89 25 a8 60 80 00    	mov    %esp,0x8060a8
+  800522:	c7 05 00 00 40 00 2a 	movl   $0x2a,0x400000
+  800529:	00 00 00 
+  80052c:	89 3d 00 60 80 00    	mov    %edi,0x806000
+  800532:	89 35 04 60 80 00    	mov    %esi,0x806004
+  800538:	89 2d 08 60 80 00    	mov    %ebp,0x806008
+  80053e:	89 1d 10 60 80 00    	mov    %ebx,0x806010
+  800544:	89 15 14 60 80 00    	mov    %edx,0x806014
+  80054a:	89 0d 18 60 80 00    	mov    %ecx,0x806018
+  800550:	a3 1c 60 80 00       	mov    %eax,0x80601c
+  800555:	89 25 28 60 80 00    	mov    %esp,0x806028
+  80055b:	8b 3d 80 60 80 00    	mov    0x806080,%edi
+  800561:	8b 35 84 60 80 00    	mov    0x806084,%esi
+  800567:	8b 2d 88 60 80 00    	mov    0x806088,%ebp
+  80056d:	8b 1d 90 60 80 00    	mov    0x806090,%ebx
+  800573:	8b 15 94 60 80 00    	mov    0x806094,%edx
+  800579:	8b 0d 98 60 80 00    	mov    0x806098,%ecx
+  80057f:	a1 9c 60 80 00       	mov    0x80609c,%eax
+  800584:	8b 25 a8 60 80 00    	mov    0x8060a8,%esp
+  80058a:	50                   	push   %eax
+  80058b:	9c                   	pushf
+  80058c:	58                   	pop    %eax
+  80058d:	a3 24 60 80 00       	mov    %eax,0x806024
+  800592:	58                   	pop    %eax
+		: : "m" (before), "m" (after) : "memory", "cc");
+
+	// Check UTEMP to roughly determine that EIP was restored
+	// correctly (of course, we probably wouldn't get this far if
+	// it weren't)
+	if (*(int*)UTEMP != 42)
+  800593:	83 c4 10             	add    $0x10,%esp
+  800596:	83 3d 00 00 40 00 2a 	cmpl   $0x2a,0x400000
+  80059d:	75 30                	jne    8005cf <umain+0x107>
+		cprintf("EIP after page-fault MISMATCH\n");
+	after.eip = before.eip;
+  80059f:	a1 a0 60 80 00       	mov    0x8060a0,%eax
+  8005a4:	a3 20 60 80 00       	mov    %eax,0x806020
+
+	check_regs(&before, "before", &after, "after", "after page-fault");
+  8005a9:	83 ec 08             	sub    $0x8,%esp
+  8005ac:	68 87 3d 80 00       	push   $0x803d87
+  8005b1:	68 98 3d 80 00       	push   $0x803d98
+  8005b6:	b9 00 60 80 00       	mov    $0x806000,%ecx
+  8005bb:	ba 58 3d 80 00       	mov    $0x803d58,%edx
+  8005c0:	b8 80 60 80 00       	mov    $0x806080,%eax
+  8005c5:	e8 69 fa ff ff       	call   800033 <check_regs>
+}
+  8005ca:	83 c4 10             	add    $0x10,%esp
+  8005cd:	c9                   	leave
+  8005ce:	c3                   	ret
+		cprintf("EIP after page-fault MISMATCH\n");
+  8005cf:	83 ec 0c             	sub    $0xc,%esp
+  8005d2:	68 d4 3d 80 00       	push   $0x803dd4
+  8005d7:	e8 43 01 00 00       	call   80071f <cprintf>
+  8005dc:	83 c4 10             	add    $0x10,%esp
+  8005df:	eb be                	jmp    80059f <umain+0xd7>
+
+008005e1 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8005e1:	55                   	push   %ebp
+  8005e2:	89 e5                	mov    %esp,%ebp
+  8005e4:	56                   	push   %esi
+  8005e5:	53                   	push   %ebx
+  8005e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8005ec:	e8 e2 0a 00 00       	call   8010d3 <sys_getenvid>
+  8005f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005f6:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8005fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800601:	a3 ac 60 80 00       	mov    %eax,0x8060ac
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800606:	85 db                	test   %ebx,%ebx
+  800608:	7e 07                	jle    800611 <libmain+0x30>
+		binaryname = argv[0];
+  80060a:	8b 06                	mov    (%esi),%eax
+  80060c:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800611:	83 ec 08             	sub    $0x8,%esp
+  800614:	56                   	push   %esi
+  800615:	53                   	push   %ebx
+  800616:	e8 ad fe ff ff       	call   8004c8 <umain>
+
+	// exit gracefully
+	exit();
+  80061b:	e8 0a 00 00 00       	call   80062a <exit>
+}
+  800620:	83 c4 10             	add    $0x10,%esp
+  800623:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800626:	5b                   	pop    %ebx
+  800627:	5e                   	pop    %esi
+  800628:	5d                   	pop    %ebp
+  800629:	c3                   	ret
+
+0080062a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80062a:	55                   	push   %ebp
+  80062b:	89 e5                	mov    %esp,%ebp
+  80062d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800630:	e8 52 11 00 00       	call   801787 <close_all>
+	sys_env_destroy(0);
+  800635:	83 ec 0c             	sub    $0xc,%esp
+  800638:	6a 00                	push   $0x0
+  80063a:	e8 4b 0a 00 00       	call   80108a <sys_env_destroy>
+}
+  80063f:	83 c4 10             	add    $0x10,%esp
+  800642:	c9                   	leave
+  800643:	c3                   	ret
+
+00800644 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800644:	55                   	push   %ebp
+  800645:	89 e5                	mov    %esp,%ebp
+  800647:	56                   	push   %esi
+  800648:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800649:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80064c:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800652:	e8 7c 0a 00 00       	call   8010d3 <sys_getenvid>
+  800657:	83 ec 0c             	sub    $0xc,%esp
+  80065a:	ff 75 0c             	push   0xc(%ebp)
+  80065d:	ff 75 08             	push   0x8(%ebp)
+  800660:	56                   	push   %esi
+  800661:	50                   	push   %eax
+  800662:	68 00 3e 80 00       	push   $0x803e00
+  800667:	e8 b3 00 00 00       	call   80071f <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80066c:	83 c4 18             	add    $0x18,%esp
+  80066f:	53                   	push   %ebx
+  800670:	ff 75 10             	push   0x10(%ebp)
+  800673:	e8 56 00 00 00       	call   8006ce <vcprintf>
+	cprintf("\n");
+  800678:	c7 04 24 10 3d 80 00 	movl   $0x803d10,(%esp)
+  80067f:	e8 9b 00 00 00       	call   80071f <cprintf>
+  800684:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800687:	cc                   	int3
+	while (1)
+  800688:	eb fd                	jmp    800687 <_panic+0x43>
+
+0080068a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80068a:	55                   	push   %ebp
+  80068b:	89 e5                	mov    %esp,%ebp
+  80068d:	53                   	push   %ebx
+  80068e:	83 ec 04             	sub    $0x4,%esp
+  800691:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800694:	8b 13                	mov    (%ebx),%edx
+  800696:	8d 42 01             	lea    0x1(%edx),%eax
+  800699:	89 03                	mov    %eax,(%ebx)
+  80069b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80069e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8006a2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8006a7:	74 09                	je     8006b2 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8006a9:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8006ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006b0:	c9                   	leave
+  8006b1:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8006b2:	83 ec 08             	sub    $0x8,%esp
+  8006b5:	68 ff 00 00 00       	push   $0xff
+  8006ba:	8d 43 08             	lea    0x8(%ebx),%eax
+  8006bd:	50                   	push   %eax
+  8006be:	e8 7a 09 00 00       	call   80103d <sys_cputs>
+		b->idx = 0;
+  8006c3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8006c9:	83 c4 10             	add    $0x10,%esp
+  8006cc:	eb db                	jmp    8006a9 <putch+0x1f>
+
+008006ce <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8006ce:	55                   	push   %ebp
+  8006cf:	89 e5                	mov    %esp,%ebp
+  8006d1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8006d7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8006de:	00 00 00 
+	b.cnt = 0;
+  8006e1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8006e8:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8006eb:	ff 75 0c             	push   0xc(%ebp)
+  8006ee:	ff 75 08             	push   0x8(%ebp)
+  8006f1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8006f7:	50                   	push   %eax
+  8006f8:	68 8a 06 80 00       	push   $0x80068a
+  8006fd:	e8 14 01 00 00       	call   800816 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800702:	83 c4 08             	add    $0x8,%esp
+  800705:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80070b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800711:	50                   	push   %eax
+  800712:	e8 26 09 00 00       	call   80103d <sys_cputs>
+
+	return b.cnt;
+}
+  800717:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80071d:	c9                   	leave
+  80071e:	c3                   	ret
+
+0080071f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80071f:	55                   	push   %ebp
+  800720:	89 e5                	mov    %esp,%ebp
+  800722:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800725:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800728:	50                   	push   %eax
+  800729:	ff 75 08             	push   0x8(%ebp)
+  80072c:	e8 9d ff ff ff       	call   8006ce <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800731:	c9                   	leave
+  800732:	c3                   	ret
+
+00800733 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800733:	55                   	push   %ebp
+  800734:	89 e5                	mov    %esp,%ebp
+  800736:	57                   	push   %edi
+  800737:	56                   	push   %esi
+  800738:	53                   	push   %ebx
+  800739:	83 ec 1c             	sub    $0x1c,%esp
+  80073c:	89 c7                	mov    %eax,%edi
+  80073e:	89 d6                	mov    %edx,%esi
+  800740:	8b 45 08             	mov    0x8(%ebp),%eax
+  800743:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800746:	89 d1                	mov    %edx,%ecx
+  800748:	89 c2                	mov    %eax,%edx
+  80074a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80074d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800750:	8b 45 10             	mov    0x10(%ebp),%eax
+  800753:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800756:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800759:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800760:	39 c2                	cmp    %eax,%edx
+  800762:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800765:	72 3e                	jb     8007a5 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800767:	83 ec 0c             	sub    $0xc,%esp
+  80076a:	ff 75 18             	push   0x18(%ebp)
+  80076d:	83 eb 01             	sub    $0x1,%ebx
+  800770:	53                   	push   %ebx
+  800771:	50                   	push   %eax
+  800772:	83 ec 08             	sub    $0x8,%esp
+  800775:	ff 75 e4             	push   -0x1c(%ebp)
+  800778:	ff 75 e0             	push   -0x20(%ebp)
+  80077b:	ff 75 dc             	push   -0x24(%ebp)
+  80077e:	ff 75 d8             	push   -0x28(%ebp)
+  800781:	e8 f1 33 00 00       	call   803b77 <__udivdi3>
+  800786:	83 c4 18             	add    $0x18,%esp
+  800789:	52                   	push   %edx
+  80078a:	50                   	push   %eax
+  80078b:	89 f2                	mov    %esi,%edx
+  80078d:	89 f8                	mov    %edi,%eax
+  80078f:	e8 9f ff ff ff       	call   800733 <printnum>
+  800794:	83 c4 20             	add    $0x20,%esp
+  800797:	eb 13                	jmp    8007ac <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800799:	83 ec 08             	sub    $0x8,%esp
+  80079c:	56                   	push   %esi
+  80079d:	ff 75 18             	push   0x18(%ebp)
+  8007a0:	ff d7                	call   *%edi
+  8007a2:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8007a5:	83 eb 01             	sub    $0x1,%ebx
+  8007a8:	85 db                	test   %ebx,%ebx
+  8007aa:	7f ed                	jg     800799 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007ac:	83 ec 08             	sub    $0x8,%esp
+  8007af:	56                   	push   %esi
+  8007b0:	83 ec 04             	sub    $0x4,%esp
+  8007b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8007b6:	ff 75 e0             	push   -0x20(%ebp)
+  8007b9:	ff 75 dc             	push   -0x24(%ebp)
+  8007bc:	ff 75 d8             	push   -0x28(%ebp)
+  8007bf:	e8 d1 33 00 00       	call   803b95 <__umoddi3>
+  8007c4:	83 c4 14             	add    $0x14,%esp
+  8007c7:	0f be 80 23 3e 80 00 	movsbl 0x803e23(%eax),%eax
+  8007ce:	50                   	push   %eax
+  8007cf:	ff d7                	call   *%edi
+}
+  8007d1:	83 c4 10             	add    $0x10,%esp
+  8007d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007d7:	5b                   	pop    %ebx
+  8007d8:	5e                   	pop    %esi
+  8007d9:	5f                   	pop    %edi
+  8007da:	5d                   	pop    %ebp
+  8007db:	c3                   	ret
+
+008007dc <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8007dc:	55                   	push   %ebp
+  8007dd:	89 e5                	mov    %esp,%ebp
+  8007df:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8007e2:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8007e6:	8b 10                	mov    (%eax),%edx
+  8007e8:	3b 50 04             	cmp    0x4(%eax),%edx
+  8007eb:	73 0a                	jae    8007f7 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8007ed:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8007f0:	89 08                	mov    %ecx,(%eax)
+  8007f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007f5:	88 02                	mov    %al,(%edx)
+}
+  8007f7:	5d                   	pop    %ebp
+  8007f8:	c3                   	ret
+
+008007f9 <printfmt>:
+{
+  8007f9:	55                   	push   %ebp
+  8007fa:	89 e5                	mov    %esp,%ebp
+  8007fc:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8007ff:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800802:	50                   	push   %eax
+  800803:	ff 75 10             	push   0x10(%ebp)
+  800806:	ff 75 0c             	push   0xc(%ebp)
+  800809:	ff 75 08             	push   0x8(%ebp)
+  80080c:	e8 05 00 00 00       	call   800816 <vprintfmt>
+}
+  800811:	83 c4 10             	add    $0x10,%esp
+  800814:	c9                   	leave
+  800815:	c3                   	ret
+
+00800816 <vprintfmt>:
+{
+  800816:	55                   	push   %ebp
+  800817:	89 e5                	mov    %esp,%ebp
+  800819:	57                   	push   %edi
+  80081a:	56                   	push   %esi
+  80081b:	53                   	push   %ebx
+  80081c:	83 ec 2c             	sub    $0x2c,%esp
+  80081f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800822:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800825:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800828:	eb 0a                	jmp    800834 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80082a:	83 ec 08             	sub    $0x8,%esp
+  80082d:	53                   	push   %ebx
+  80082e:	50                   	push   %eax
+  80082f:	ff d6                	call   *%esi
+  800831:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800834:	83 c7 01             	add    $0x1,%edi
+  800837:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80083b:	83 f8 25             	cmp    $0x25,%eax
+  80083e:	74 0c                	je     80084c <vprintfmt+0x36>
+			if (ch == '\0')
+  800840:	85 c0                	test   %eax,%eax
+  800842:	75 e6                	jne    80082a <vprintfmt+0x14>
+}
+  800844:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800847:	5b                   	pop    %ebx
+  800848:	5e                   	pop    %esi
+  800849:	5f                   	pop    %edi
+  80084a:	5d                   	pop    %ebp
+  80084b:	c3                   	ret
+		padc = ' ';
+  80084c:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800850:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800857:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80085e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800865:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80086a:	8d 47 01             	lea    0x1(%edi),%eax
+  80086d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800870:	0f b6 17             	movzbl (%edi),%edx
+  800873:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800876:	3c 55                	cmp    $0x55,%al
+  800878:	0f 87 cf 03 00 00    	ja     800c4d <vprintfmt+0x437>
+  80087e:	0f b6 c0             	movzbl %al,%eax
+  800881:	ff 24 85 80 3f 80 00 	jmp    *0x803f80(,%eax,4)
+  800888:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80088b:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80088f:	eb d9                	jmp    80086a <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800891:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800894:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800898:	eb d0                	jmp    80086a <vprintfmt+0x54>
+  80089a:	0f b6 d2             	movzbl %dl,%edx
+  80089d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8008a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8008a8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8008ab:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8008af:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8008b2:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8008b5:	83 f9 09             	cmp    $0x9,%ecx
+  8008b8:	77 55                	ja     80090f <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8008ba:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8008bd:	eb e9                	jmp    8008a8 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8008bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c2:	8b 00                	mov    (%eax),%eax
+  8008c4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8008cd:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8008d3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8008d7:	79 91                	jns    80086a <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8008d9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008df:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8008e6:	eb 82                	jmp    80086a <vprintfmt+0x54>
+			if (width < 0)
+  8008e8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008eb:	85 d2                	test   %edx,%edx
+  8008ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f2:	0f 49 c2             	cmovns %edx,%eax
+  8008f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8008fb:	e9 6a ff ff ff       	jmp    80086a <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800900:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800903:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80090a:	e9 5b ff ff ff       	jmp    80086a <vprintfmt+0x54>
+  80090f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800912:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800915:	eb bc                	jmp    8008d3 <vprintfmt+0xbd>
+			lflag++;
+  800917:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80091a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80091d:	e9 48 ff ff ff       	jmp    80086a <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800922:	8b 45 14             	mov    0x14(%ebp),%eax
+  800925:	8d 78 04             	lea    0x4(%eax),%edi
+  800928:	83 ec 08             	sub    $0x8,%esp
+  80092b:	53                   	push   %ebx
+  80092c:	ff 30                	push   (%eax)
+  80092e:	ff d6                	call   *%esi
+			break;
+  800930:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800933:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800936:	e9 b1 02 00 00       	jmp    800bec <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80093b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093e:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800941:	8b 10                	mov    (%eax),%edx
+  800943:	89 d0                	mov    %edx,%eax
+  800945:	f7 d8                	neg    %eax
+  800947:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80094a:	83 f8 11             	cmp    $0x11,%eax
+  80094d:	7f 23                	jg     800972 <vprintfmt+0x15c>
+  80094f:	8b 14 85 e0 40 80 00 	mov    0x8040e0(,%eax,4),%edx
+  800956:	85 d2                	test   %edx,%edx
+  800958:	74 18                	je     800972 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80095a:	52                   	push   %edx
+  80095b:	68 fe 41 80 00       	push   $0x8041fe
+  800960:	53                   	push   %ebx
+  800961:	56                   	push   %esi
+  800962:	e8 92 fe ff ff       	call   8007f9 <printfmt>
+  800967:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80096a:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80096d:	e9 7a 02 00 00       	jmp    800bec <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800972:	50                   	push   %eax
+  800973:	68 3b 3e 80 00       	push   $0x803e3b
+  800978:	53                   	push   %ebx
+  800979:	56                   	push   %esi
+  80097a:	e8 7a fe ff ff       	call   8007f9 <printfmt>
+  80097f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800982:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800985:	e9 62 02 00 00       	jmp    800bec <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80098a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098d:	83 c0 04             	add    $0x4,%eax
+  800990:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800993:	8b 45 14             	mov    0x14(%ebp),%eax
+  800996:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800998:	85 c9                	test   %ecx,%ecx
+  80099a:	b8 34 3e 80 00       	mov    $0x803e34,%eax
+  80099f:	0f 45 c1             	cmovne %ecx,%eax
+  8009a2:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8009a5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8009a9:	7e 06                	jle    8009b1 <vprintfmt+0x19b>
+  8009ab:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8009af:	75 0b                	jne    8009bc <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009b1:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8009b4:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8009b7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009ba:	eb 5c                	jmp    800a18 <vprintfmt+0x202>
+  8009bc:	83 ec 08             	sub    $0x8,%esp
+  8009bf:	ff 75 d0             	push   -0x30(%ebp)
+  8009c2:	ff 75 cc             	push   -0x34(%ebp)
+  8009c5:	e8 20 03 00 00       	call   800cea <strnlen>
+  8009ca:	89 c2                	mov    %eax,%edx
+  8009cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009cf:	29 d0                	sub    %edx,%eax
+  8009d1:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8009d4:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8009d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009db:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009de:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009e0:	eb 0e                	jmp    8009f0 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8009e2:	83 ec 08             	sub    $0x8,%esp
+  8009e5:	53                   	push   %ebx
+  8009e6:	57                   	push   %edi
+  8009e7:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009ea:	83 ee 01             	sub    $0x1,%esi
+  8009ed:	83 c4 10             	add    $0x10,%esp
+  8009f0:	85 f6                	test   %esi,%esi
+  8009f2:	7f ee                	jg     8009e2 <vprintfmt+0x1cc>
+  8009f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009f7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009fa:	85 c0                	test   %eax,%eax
+  8009fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a01:	0f 49 d0             	cmovns %eax,%edx
+  800a04:	29 d0                	sub    %edx,%eax
+  800a06:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a09:	eb a6                	jmp    8009b1 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800a0b:	83 ec 08             	sub    $0x8,%esp
+  800a0e:	53                   	push   %ebx
+  800a0f:	52                   	push   %edx
+  800a10:	ff 55 08             	call   *0x8(%ebp)
+  800a13:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a16:	89 f1                	mov    %esi,%ecx
+  800a18:	8d 71 01             	lea    0x1(%ecx),%esi
+  800a1b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800a1f:	0f be d0             	movsbl %al,%edx
+  800a22:	85 d2                	test   %edx,%edx
+  800a24:	74 28                	je     800a4e <vprintfmt+0x238>
+  800a26:	85 ff                	test   %edi,%edi
+  800a28:	78 05                	js     800a2f <vprintfmt+0x219>
+  800a2a:	83 ef 01             	sub    $0x1,%edi
+  800a2d:	78 30                	js     800a5f <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800a2f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800a33:	74 d6                	je     800a0b <vprintfmt+0x1f5>
+  800a35:	0f be c0             	movsbl %al,%eax
+  800a38:	83 e8 20             	sub    $0x20,%eax
+  800a3b:	83 f8 5e             	cmp    $0x5e,%eax
+  800a3e:	76 cb                	jbe    800a0b <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800a40:	83 ec 08             	sub    $0x8,%esp
+  800a43:	53                   	push   %ebx
+  800a44:	6a 3f                	push   $0x3f
+  800a46:	ff 55 08             	call   *0x8(%ebp)
+  800a49:	83 c4 10             	add    $0x10,%esp
+  800a4c:	eb c8                	jmp    800a16 <vprintfmt+0x200>
+  800a4e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a51:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a54:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800a57:	01 d0                	add    %edx,%eax
+  800a59:	29 c8                	sub    %ecx,%eax
+  800a5b:	89 c7                	mov    %eax,%edi
+  800a5d:	eb 13                	jmp    800a72 <vprintfmt+0x25c>
+  800a5f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a62:	eb ed                	jmp    800a51 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800a64:	83 ec 08             	sub    $0x8,%esp
+  800a67:	53                   	push   %ebx
+  800a68:	6a 20                	push   $0x20
+  800a6a:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800a6c:	83 ef 01             	sub    $0x1,%edi
+  800a6f:	83 c4 10             	add    $0x10,%esp
+  800a72:	85 ff                	test   %edi,%edi
+  800a74:	7f ee                	jg     800a64 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a76:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800a79:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a7c:	e9 6b 01 00 00       	jmp    800bec <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800a81:	83 f9 01             	cmp    $0x1,%ecx
+  800a84:	7f 1f                	jg     800aa5 <vprintfmt+0x28f>
+	else if (lflag)
+  800a86:	85 c9                	test   %ecx,%ecx
+  800a88:	74 67                	je     800af1 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800a8a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a8d:	8b 00                	mov    (%eax),%eax
+  800a8f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a92:	89 c1                	mov    %eax,%ecx
+  800a94:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a97:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a9d:	8d 40 04             	lea    0x4(%eax),%eax
+  800aa0:	89 45 14             	mov    %eax,0x14(%ebp)
+  800aa3:	eb 17                	jmp    800abc <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800aa5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa8:	8b 50 04             	mov    0x4(%eax),%edx
+  800aab:	8b 00                	mov    (%eax),%eax
+  800aad:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ab0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ab3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ab6:	8d 40 08             	lea    0x8(%eax),%eax
+  800ab9:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800abc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800abf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800ac2:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800ac7:	85 c9                	test   %ecx,%ecx
+  800ac9:	0f 89 03 01 00 00    	jns    800bd2 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800acf:	83 ec 08             	sub    $0x8,%esp
+  800ad2:	53                   	push   %ebx
+  800ad3:	6a 2d                	push   $0x2d
+  800ad5:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800ad7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800ada:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800add:	f7 da                	neg    %edx
+  800adf:	83 d1 00             	adc    $0x0,%ecx
+  800ae2:	f7 d9                	neg    %ecx
+  800ae4:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800ae7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800aec:	e9 e1 00 00 00       	jmp    800bd2 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800af1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af4:	8b 00                	mov    (%eax),%eax
+  800af6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800af9:	89 c1                	mov    %eax,%ecx
+  800afb:	c1 f9 1f             	sar    $0x1f,%ecx
+  800afe:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b01:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b04:	8d 40 04             	lea    0x4(%eax),%eax
+  800b07:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b0a:	eb b0                	jmp    800abc <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800b0c:	83 f9 01             	cmp    $0x1,%ecx
+  800b0f:	7f 1e                	jg     800b2f <vprintfmt+0x319>
+	else if (lflag)
+  800b11:	85 c9                	test   %ecx,%ecx
+  800b13:	74 32                	je     800b47 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800b15:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b18:	8b 10                	mov    (%eax),%edx
+  800b1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b1f:	8d 40 04             	lea    0x4(%eax),%eax
+  800b22:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b25:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800b2a:	e9 a3 00 00 00       	jmp    800bd2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800b2f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b32:	8b 10                	mov    (%eax),%edx
+  800b34:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b37:	8d 40 08             	lea    0x8(%eax),%eax
+  800b3a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b3d:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800b42:	e9 8b 00 00 00       	jmp    800bd2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800b47:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b4a:	8b 10                	mov    (%eax),%edx
+  800b4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b51:	8d 40 04             	lea    0x4(%eax),%eax
+  800b54:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b57:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800b5c:	eb 74                	jmp    800bd2 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800b5e:	83 f9 01             	cmp    $0x1,%ecx
+  800b61:	7f 1b                	jg     800b7e <vprintfmt+0x368>
+	else if (lflag)
+  800b63:	85 c9                	test   %ecx,%ecx
+  800b65:	74 2c                	je     800b93 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800b67:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b6a:	8b 10                	mov    (%eax),%edx
+  800b6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b71:	8d 40 04             	lea    0x4(%eax),%eax
+  800b74:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b77:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800b7c:	eb 54                	jmp    800bd2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800b7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b81:	8b 10                	mov    (%eax),%edx
+  800b83:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b86:	8d 40 08             	lea    0x8(%eax),%eax
+  800b89:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b8c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800b91:	eb 3f                	jmp    800bd2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800b93:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b96:	8b 10                	mov    (%eax),%edx
+  800b98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b9d:	8d 40 04             	lea    0x4(%eax),%eax
+  800ba0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800ba3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800ba8:	eb 28                	jmp    800bd2 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800baa:	83 ec 08             	sub    $0x8,%esp
+  800bad:	53                   	push   %ebx
+  800bae:	6a 30                	push   $0x30
+  800bb0:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800bb2:	83 c4 08             	add    $0x8,%esp
+  800bb5:	53                   	push   %ebx
+  800bb6:	6a 78                	push   $0x78
+  800bb8:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800bba:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bbd:	8b 10                	mov    (%eax),%edx
+  800bbf:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800bc4:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800bc7:	8d 40 04             	lea    0x4(%eax),%eax
+  800bca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bcd:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800bd2:	83 ec 0c             	sub    $0xc,%esp
+  800bd5:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800bd9:	50                   	push   %eax
+  800bda:	ff 75 e0             	push   -0x20(%ebp)
+  800bdd:	57                   	push   %edi
+  800bde:	51                   	push   %ecx
+  800bdf:	52                   	push   %edx
+  800be0:	89 da                	mov    %ebx,%edx
+  800be2:	89 f0                	mov    %esi,%eax
+  800be4:	e8 4a fb ff ff       	call   800733 <printnum>
+			break;
+  800be9:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800bec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800bef:	e9 40 fc ff ff       	jmp    800834 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800bf4:	83 f9 01             	cmp    $0x1,%ecx
+  800bf7:	7f 1b                	jg     800c14 <vprintfmt+0x3fe>
+	else if (lflag)
+  800bf9:	85 c9                	test   %ecx,%ecx
+  800bfb:	74 2c                	je     800c29 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800bfd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c00:	8b 10                	mov    (%eax),%edx
+  800c02:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c07:	8d 40 04             	lea    0x4(%eax),%eax
+  800c0a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c0d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800c12:	eb be                	jmp    800bd2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800c14:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c17:	8b 10                	mov    (%eax),%edx
+  800c19:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c1c:	8d 40 08             	lea    0x8(%eax),%eax
+  800c1f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c22:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800c27:	eb a9                	jmp    800bd2 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800c29:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c2c:	8b 10                	mov    (%eax),%edx
+  800c2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c33:	8d 40 04             	lea    0x4(%eax),%eax
+  800c36:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c39:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800c3e:	eb 92                	jmp    800bd2 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800c40:	83 ec 08             	sub    $0x8,%esp
+  800c43:	53                   	push   %ebx
+  800c44:	6a 25                	push   $0x25
+  800c46:	ff d6                	call   *%esi
+			break;
+  800c48:	83 c4 10             	add    $0x10,%esp
+  800c4b:	eb 9f                	jmp    800bec <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800c4d:	83 ec 08             	sub    $0x8,%esp
+  800c50:	53                   	push   %ebx
+  800c51:	6a 25                	push   $0x25
+  800c53:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c55:	83 c4 10             	add    $0x10,%esp
+  800c58:	89 f8                	mov    %edi,%eax
+  800c5a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c5e:	74 05                	je     800c65 <vprintfmt+0x44f>
+  800c60:	83 e8 01             	sub    $0x1,%eax
+  800c63:	eb f5                	jmp    800c5a <vprintfmt+0x444>
+  800c65:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800c68:	eb 82                	jmp    800bec <vprintfmt+0x3d6>
+
+00800c6a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c6a:	55                   	push   %ebp
+  800c6b:	89 e5                	mov    %esp,%ebp
+  800c6d:	83 ec 18             	sub    $0x18,%esp
+  800c70:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c73:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800c76:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c79:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c7d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c80:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800c87:	85 c0                	test   %eax,%eax
+  800c89:	74 26                	je     800cb1 <vsnprintf+0x47>
+  800c8b:	85 d2                	test   %edx,%edx
+  800c8d:	7e 22                	jle    800cb1 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c8f:	ff 75 14             	push   0x14(%ebp)
+  800c92:	ff 75 10             	push   0x10(%ebp)
+  800c95:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c98:	50                   	push   %eax
+  800c99:	68 dc 07 80 00       	push   $0x8007dc
+  800c9e:	e8 73 fb ff ff       	call   800816 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ca3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ca6:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ca9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cac:	83 c4 10             	add    $0x10,%esp
+}
+  800caf:	c9                   	leave
+  800cb0:	c3                   	ret
+		return -E_INVAL;
+  800cb1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cb6:	eb f7                	jmp    800caf <vsnprintf+0x45>
+
+00800cb8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800cb8:	55                   	push   %ebp
+  800cb9:	89 e5                	mov    %esp,%ebp
+  800cbb:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800cbe:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800cc1:	50                   	push   %eax
+  800cc2:	ff 75 10             	push   0x10(%ebp)
+  800cc5:	ff 75 0c             	push   0xc(%ebp)
+  800cc8:	ff 75 08             	push   0x8(%ebp)
+  800ccb:	e8 9a ff ff ff       	call   800c6a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800cd0:	c9                   	leave
+  800cd1:	c3                   	ret
+
+00800cd2 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800cd2:	55                   	push   %ebp
+  800cd3:	89 e5                	mov    %esp,%ebp
+  800cd5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cdd:	eb 03                	jmp    800ce2 <strlen+0x10>
+		n++;
+  800cdf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800ce2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800ce6:	75 f7                	jne    800cdf <strlen+0xd>
+	return n;
+}
+  800ce8:	5d                   	pop    %ebp
+  800ce9:	c3                   	ret
+
+00800cea <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800cea:	55                   	push   %ebp
+  800ceb:	89 e5                	mov    %esp,%ebp
+  800ced:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cf0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf8:	eb 03                	jmp    800cfd <strnlen+0x13>
+		n++;
+  800cfa:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cfd:	39 d0                	cmp    %edx,%eax
+  800cff:	74 08                	je     800d09 <strnlen+0x1f>
+  800d01:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800d05:	75 f3                	jne    800cfa <strnlen+0x10>
+  800d07:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800d09:	89 d0                	mov    %edx,%eax
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+
+00800d0d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	53                   	push   %ebx
+  800d11:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d14:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d20:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d23:	83 c0 01             	add    $0x1,%eax
+  800d26:	84 d2                	test   %dl,%dl
+  800d28:	75 f2                	jne    800d1c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800d2a:	89 c8                	mov    %ecx,%eax
+  800d2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d2f:	c9                   	leave
+  800d30:	c3                   	ret
+
+00800d31 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800d31:	55                   	push   %ebp
+  800d32:	89 e5                	mov    %esp,%ebp
+  800d34:	53                   	push   %ebx
+  800d35:	83 ec 10             	sub    $0x10,%esp
+  800d38:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800d3b:	53                   	push   %ebx
+  800d3c:	e8 91 ff ff ff       	call   800cd2 <strlen>
+  800d41:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800d44:	ff 75 0c             	push   0xc(%ebp)
+  800d47:	01 d8                	add    %ebx,%eax
+  800d49:	50                   	push   %eax
+  800d4a:	e8 be ff ff ff       	call   800d0d <strcpy>
+	return dst;
+}
+  800d4f:	89 d8                	mov    %ebx,%eax
+  800d51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d54:	c9                   	leave
+  800d55:	c3                   	ret
+
+00800d56 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d56:	55                   	push   %ebp
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	56                   	push   %esi
+  800d5a:	53                   	push   %ebx
+  800d5b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d61:	89 f3                	mov    %esi,%ebx
+  800d63:	03 5d 10             	add    0x10(%ebp),%ebx
+  800d66:	89 f0                	mov    %esi,%eax
+  800d68:	eb 0f                	jmp    800d79 <strncpy+0x23>
+		*dst++ = *src;
+  800d6a:	83 c0 01             	add    $0x1,%eax
+  800d6d:	0f b6 0a             	movzbl (%edx),%ecx
+  800d70:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800d73:	80 f9 01             	cmp    $0x1,%cl
+  800d76:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800d79:	39 d8                	cmp    %ebx,%eax
+  800d7b:	75 ed                	jne    800d6a <strncpy+0x14>
+	}
+	return ret;
+}
+  800d7d:	89 f0                	mov    %esi,%eax
+  800d7f:	5b                   	pop    %ebx
+  800d80:	5e                   	pop    %esi
+  800d81:	5d                   	pop    %ebp
+  800d82:	c3                   	ret
+
+00800d83 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800d83:	55                   	push   %ebp
+  800d84:	89 e5                	mov    %esp,%ebp
+  800d86:	56                   	push   %esi
+  800d87:	53                   	push   %ebx
+  800d88:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800d91:	89 f0                	mov    %esi,%eax
+  800d93:	85 d2                	test   %edx,%edx
+  800d95:	74 21                	je     800db8 <strlcpy+0x35>
+  800d97:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800d9b:	89 f2                	mov    %esi,%edx
+  800d9d:	eb 09                	jmp    800da8 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800d9f:	83 c1 01             	add    $0x1,%ecx
+  800da2:	83 c2 01             	add    $0x1,%edx
+  800da5:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800da8:	39 c2                	cmp    %eax,%edx
+  800daa:	74 09                	je     800db5 <strlcpy+0x32>
+  800dac:	0f b6 19             	movzbl (%ecx),%ebx
+  800daf:	84 db                	test   %bl,%bl
+  800db1:	75 ec                	jne    800d9f <strlcpy+0x1c>
+  800db3:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800db5:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800db8:	29 f0                	sub    %esi,%eax
+}
+  800dba:	5b                   	pop    %ebx
+  800dbb:	5e                   	pop    %esi
+  800dbc:	5d                   	pop    %ebp
+  800dbd:	c3                   	ret
+
+00800dbe <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800dbe:	55                   	push   %ebp
+  800dbf:	89 e5                	mov    %esp,%ebp
+  800dc1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dc4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800dc7:	eb 06                	jmp    800dcf <strcmp+0x11>
+		p++, q++;
+  800dc9:	83 c1 01             	add    $0x1,%ecx
+  800dcc:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800dcf:	0f b6 01             	movzbl (%ecx),%eax
+  800dd2:	84 c0                	test   %al,%al
+  800dd4:	74 04                	je     800dda <strcmp+0x1c>
+  800dd6:	3a 02                	cmp    (%edx),%al
+  800dd8:	74 ef                	je     800dc9 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800dda:	0f b6 c0             	movzbl %al,%eax
+  800ddd:	0f b6 12             	movzbl (%edx),%edx
+  800de0:	29 d0                	sub    %edx,%eax
+}
+  800de2:	5d                   	pop    %ebp
+  800de3:	c3                   	ret
+
+00800de4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800de4:	55                   	push   %ebp
+  800de5:	89 e5                	mov    %esp,%ebp
+  800de7:	53                   	push   %ebx
+  800de8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800deb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dee:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800df1:	eb 09                	jmp    800dfc <strncmp+0x18>
+		n--, p++, q++;
+  800df3:	83 ea 01             	sub    $0x1,%edx
+  800df6:	83 c0 01             	add    $0x1,%eax
+  800df9:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800dfc:	85 d2                	test   %edx,%edx
+  800dfe:	74 18                	je     800e18 <strncmp+0x34>
+  800e00:	0f b6 18             	movzbl (%eax),%ebx
+  800e03:	84 db                	test   %bl,%bl
+  800e05:	74 04                	je     800e0b <strncmp+0x27>
+  800e07:	3a 19                	cmp    (%ecx),%bl
+  800e09:	74 e8                	je     800df3 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e0b:	0f b6 00             	movzbl (%eax),%eax
+  800e0e:	0f b6 11             	movzbl (%ecx),%edx
+  800e11:	29 d0                	sub    %edx,%eax
+}
+  800e13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e16:	c9                   	leave
+  800e17:	c3                   	ret
+		return 0;
+  800e18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1d:	eb f4                	jmp    800e13 <strncmp+0x2f>
+
+00800e1f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800e1f:	55                   	push   %ebp
+  800e20:	89 e5                	mov    %esp,%ebp
+  800e22:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e25:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e29:	eb 03                	jmp    800e2e <strchr+0xf>
+  800e2b:	83 c0 01             	add    $0x1,%eax
+  800e2e:	0f b6 10             	movzbl (%eax),%edx
+  800e31:	84 d2                	test   %dl,%dl
+  800e33:	74 06                	je     800e3b <strchr+0x1c>
+		if (*s == c)
+  800e35:	38 ca                	cmp    %cl,%dl
+  800e37:	75 f2                	jne    800e2b <strchr+0xc>
+  800e39:	eb 05                	jmp    800e40 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e40:	5d                   	pop    %ebp
+  800e41:	c3                   	ret
+
+00800e42 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e48:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e4c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800e4f:	38 ca                	cmp    %cl,%dl
+  800e51:	74 09                	je     800e5c <strfind+0x1a>
+  800e53:	84 d2                	test   %dl,%dl
+  800e55:	74 05                	je     800e5c <strfind+0x1a>
+	for (; *s; s++)
+  800e57:	83 c0 01             	add    $0x1,%eax
+  800e5a:	eb f0                	jmp    800e4c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800e5c:	5d                   	pop    %ebp
+  800e5d:	c3                   	ret
+
+00800e5e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e5e:	55                   	push   %ebp
+  800e5f:	89 e5                	mov    %esp,%ebp
+  800e61:	57                   	push   %edi
+  800e62:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e65:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800e68:	85 c9                	test   %ecx,%ecx
+  800e6a:	74 20                	je     800e8c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800e6c:	89 f8                	mov    %edi,%eax
+  800e6e:	09 c8                	or     %ecx,%eax
+  800e70:	a8 03                	test   $0x3,%al
+  800e72:	75 12                	jne    800e86 <memset+0x28>
+		c &= 0xFF;
+  800e74:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800e78:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800e7e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800e81:	fc                   	cld
+  800e82:	f3 ab                	rep stos %eax,%es:(%edi)
+  800e84:	eb 06                	jmp    800e8c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800e86:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e89:	fc                   	cld
+  800e8a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800e8c:	89 f8                	mov    %edi,%eax
+  800e8e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800e91:	c9                   	leave
+  800e92:	c3                   	ret
+
+00800e93 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800e93:	55                   	push   %ebp
+  800e94:	89 e5                	mov    %esp,%ebp
+  800e96:	57                   	push   %edi
+  800e97:	56                   	push   %esi
+  800e98:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e9b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e9e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ea1:	39 c6                	cmp    %eax,%esi
+  800ea3:	73 32                	jae    800ed7 <memmove+0x44>
+  800ea5:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ea8:	39 d0                	cmp    %edx,%eax
+  800eaa:	73 2b                	jae    800ed7 <memmove+0x44>
+		s += n;
+		d += n;
+  800eac:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800eaf:	89 d6                	mov    %edx,%esi
+  800eb1:	09 fe                	or     %edi,%esi
+  800eb3:	09 ce                	or     %ecx,%esi
+  800eb5:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ebb:	75 0e                	jne    800ecb <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ebd:	83 ef 04             	sub    $0x4,%edi
+  800ec0:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ec3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ec6:	fd                   	std
+  800ec7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ec9:	eb 09                	jmp    800ed4 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ecb:	83 ef 01             	sub    $0x1,%edi
+  800ece:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ed1:	fd                   	std
+  800ed2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ed4:	fc                   	cld
+  800ed5:	eb 1a                	jmp    800ef1 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ed7:	89 f2                	mov    %esi,%edx
+  800ed9:	09 c2                	or     %eax,%edx
+  800edb:	09 ca                	or     %ecx,%edx
+  800edd:	f6 c2 03             	test   $0x3,%dl
+  800ee0:	75 0a                	jne    800eec <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ee2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ee5:	89 c7                	mov    %eax,%edi
+  800ee7:	fc                   	cld
+  800ee8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800eea:	eb 05                	jmp    800ef1 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800eec:	89 c7                	mov    %eax,%edi
+  800eee:	fc                   	cld
+  800eef:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ef1:	5e                   	pop    %esi
+  800ef2:	5f                   	pop    %edi
+  800ef3:	5d                   	pop    %ebp
+  800ef4:	c3                   	ret
+
+00800ef5 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800efb:	ff 75 10             	push   0x10(%ebp)
+  800efe:	ff 75 0c             	push   0xc(%ebp)
+  800f01:	ff 75 08             	push   0x8(%ebp)
+  800f04:	e8 8a ff ff ff       	call   800e93 <memmove>
+}
+  800f09:	c9                   	leave
+  800f0a:	c3                   	ret
+
+00800f0b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800f0b:	55                   	push   %ebp
+  800f0c:	89 e5                	mov    %esp,%ebp
+  800f0e:	56                   	push   %esi
+  800f0f:	53                   	push   %ebx
+  800f10:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f13:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800f16:	89 c6                	mov    %eax,%esi
+  800f18:	03 75 10             	add    0x10(%ebp),%esi
+  800f1b:	eb 06                	jmp    800f23 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800f1d:	83 c0 01             	add    $0x1,%eax
+  800f20:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800f23:	39 f0                	cmp    %esi,%eax
+  800f25:	74 14                	je     800f3b <memcmp+0x30>
+		if (*s1 != *s2)
+  800f27:	0f b6 08             	movzbl (%eax),%ecx
+  800f2a:	0f b6 1a             	movzbl (%edx),%ebx
+  800f2d:	38 d9                	cmp    %bl,%cl
+  800f2f:	74 ec                	je     800f1d <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800f31:	0f b6 c1             	movzbl %cl,%eax
+  800f34:	0f b6 db             	movzbl %bl,%ebx
+  800f37:	29 d8                	sub    %ebx,%eax
+  800f39:	eb 05                	jmp    800f40 <memcmp+0x35>
+	}
+
+	return 0;
+  800f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f40:	5b                   	pop    %ebx
+  800f41:	5e                   	pop    %esi
+  800f42:	5d                   	pop    %ebp
+  800f43:	c3                   	ret
+
+00800f44 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800f4d:	89 c2                	mov    %eax,%edx
+  800f4f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800f52:	eb 03                	jmp    800f57 <memfind+0x13>
+  800f54:	83 c0 01             	add    $0x1,%eax
+  800f57:	39 d0                	cmp    %edx,%eax
+  800f59:	73 04                	jae    800f5f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f5b:	38 08                	cmp    %cl,(%eax)
+  800f5d:	75 f5                	jne    800f54 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800f5f:	5d                   	pop    %ebp
+  800f60:	c3                   	ret
+
+00800f61 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800f61:	55                   	push   %ebp
+  800f62:	89 e5                	mov    %esp,%ebp
+  800f64:	57                   	push   %edi
+  800f65:	56                   	push   %esi
+  800f66:	53                   	push   %ebx
+  800f67:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800f6d:	eb 03                	jmp    800f72 <strtol+0x11>
+		s++;
+  800f6f:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800f72:	0f b6 02             	movzbl (%edx),%eax
+  800f75:	3c 20                	cmp    $0x20,%al
+  800f77:	74 f6                	je     800f6f <strtol+0xe>
+  800f79:	3c 09                	cmp    $0x9,%al
+  800f7b:	74 f2                	je     800f6f <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800f7d:	3c 2b                	cmp    $0x2b,%al
+  800f7f:	74 2a                	je     800fab <strtol+0x4a>
+	int neg = 0;
+  800f81:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800f86:	3c 2d                	cmp    $0x2d,%al
+  800f88:	74 2b                	je     800fb5 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f8a:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800f90:	75 0f                	jne    800fa1 <strtol+0x40>
+  800f92:	80 3a 30             	cmpb   $0x30,(%edx)
+  800f95:	74 28                	je     800fbf <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800f97:	85 db                	test   %ebx,%ebx
+  800f99:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f9e:	0f 44 d8             	cmove  %eax,%ebx
+  800fa1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800fa9:	eb 46                	jmp    800ff1 <strtol+0x90>
+		s++;
+  800fab:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800fae:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fb3:	eb d5                	jmp    800f8a <strtol+0x29>
+		s++, neg = 1;
+  800fb5:	83 c2 01             	add    $0x1,%edx
+  800fb8:	bf 01 00 00 00       	mov    $0x1,%edi
+  800fbd:	eb cb                	jmp    800f8a <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800fbf:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800fc3:	74 0e                	je     800fd3 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800fc5:	85 db                	test   %ebx,%ebx
+  800fc7:	75 d8                	jne    800fa1 <strtol+0x40>
+		s++, base = 8;
+  800fc9:	83 c2 01             	add    $0x1,%edx
+  800fcc:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800fd1:	eb ce                	jmp    800fa1 <strtol+0x40>
+		s += 2, base = 16;
+  800fd3:	83 c2 02             	add    $0x2,%edx
+  800fd6:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800fdb:	eb c4                	jmp    800fa1 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800fdd:	0f be c0             	movsbl %al,%eax
+  800fe0:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800fe3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800fe6:	7d 3a                	jge    801022 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800fe8:	83 c2 01             	add    $0x1,%edx
+  800feb:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800fef:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ff1:	0f b6 02             	movzbl (%edx),%eax
+  800ff4:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ff7:	89 f3                	mov    %esi,%ebx
+  800ff9:	80 fb 09             	cmp    $0x9,%bl
+  800ffc:	76 df                	jbe    800fdd <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ffe:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801001:	89 f3                	mov    %esi,%ebx
+  801003:	80 fb 19             	cmp    $0x19,%bl
+  801006:	77 08                	ja     801010 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801008:	0f be c0             	movsbl %al,%eax
+  80100b:	83 e8 57             	sub    $0x57,%eax
+  80100e:	eb d3                	jmp    800fe3 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801010:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801013:	89 f3                	mov    %esi,%ebx
+  801015:	80 fb 19             	cmp    $0x19,%bl
+  801018:	77 08                	ja     801022 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80101a:	0f be c0             	movsbl %al,%eax
+  80101d:	83 e8 37             	sub    $0x37,%eax
+  801020:	eb c1                	jmp    800fe3 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801022:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801026:	74 05                	je     80102d <strtol+0xcc>
+		*endptr = (char *) s;
+  801028:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80102b:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80102d:	89 c8                	mov    %ecx,%eax
+  80102f:	f7 d8                	neg    %eax
+  801031:	85 ff                	test   %edi,%edi
+  801033:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801036:	89 c8                	mov    %ecx,%eax
+  801038:	5b                   	pop    %ebx
+  801039:	5e                   	pop    %esi
+  80103a:	5f                   	pop    %edi
+  80103b:	5d                   	pop    %ebp
+  80103c:	c3                   	ret
+
+0080103d <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80103d:	55                   	push   %ebp
+  80103e:	89 e5                	mov    %esp,%ebp
+  801040:	57                   	push   %edi
+  801041:	56                   	push   %esi
+  801042:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801043:	b8 00 00 00 00       	mov    $0x0,%eax
+  801048:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104e:	89 c3                	mov    %eax,%ebx
+  801050:	89 c7                	mov    %eax,%edi
+  801052:	55                   	push   %ebp
+  801053:	89 e5                	mov    %esp,%ebp
+  801055:	8d 35 5d 10 80 00    	lea    0x80105d,%esi
+  80105b:	0f 34                	sysenter
+  80105d:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  80105e:	5b                   	pop    %ebx
+  80105f:	5e                   	pop    %esi
+  801060:	5f                   	pop    %edi
+  801061:	5d                   	pop    %ebp
+  801062:	c3                   	ret
+
+00801063 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801063:	55                   	push   %ebp
+  801064:	89 e5                	mov    %esp,%ebp
+  801066:	57                   	push   %edi
+  801067:	56                   	push   %esi
+  801068:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801069:	ba 00 00 00 00       	mov    $0x0,%edx
+  80106e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801073:	89 d1                	mov    %edx,%ecx
+  801075:	89 d3                	mov    %edx,%ebx
+  801077:	89 d7                	mov    %edx,%edi
+  801079:	55                   	push   %ebp
+  80107a:	89 e5                	mov    %esp,%ebp
+  80107c:	8d 35 84 10 80 00    	lea    0x801084,%esi
+  801082:	0f 34                	sysenter
+  801084:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  801085:	5b                   	pop    %ebx
+  801086:	5e                   	pop    %esi
+  801087:	5f                   	pop    %edi
+  801088:	5d                   	pop    %ebp
+  801089:	c3                   	ret
+
+0080108a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80108a:	55                   	push   %ebp
+  80108b:	89 e5                	mov    %esp,%ebp
+  80108d:	57                   	push   %edi
+  80108e:	56                   	push   %esi
+  80108f:	53                   	push   %ebx
+  801090:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801093:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801098:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109b:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010a0:	89 cb                	mov    %ecx,%ebx
+  8010a2:	89 cf                	mov    %ecx,%edi
+  8010a4:	55                   	push   %ebp
+  8010a5:	89 e5                	mov    %esp,%ebp
+  8010a7:	8d 35 af 10 80 00    	lea    0x8010af,%esi
+  8010ad:	0f 34                	sysenter
+  8010af:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010b0:	85 c0                	test   %eax,%eax
+  8010b2:	7f 08                	jg     8010bc <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  8010b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b7:	5b                   	pop    %ebx
+  8010b8:	5e                   	pop    %esi
+  8010b9:	5f                   	pop    %edi
+  8010ba:	5d                   	pop    %ebp
+  8010bb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010bc:	83 ec 0c             	sub    $0xc,%esp
+  8010bf:	50                   	push   %eax
+  8010c0:	6a 03                	push   $0x3
+  8010c2:	68 47 41 80 00       	push   $0x804147
+  8010c7:	6a 3d                	push   $0x3d
+  8010c9:	68 64 41 80 00       	push   $0x804164
+  8010ce:	e8 71 f5 ff ff       	call   800644 <_panic>
+
+008010d3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8010d3:	55                   	push   %ebp
+  8010d4:	89 e5                	mov    %esp,%ebp
+  8010d6:	57                   	push   %edi
+  8010d7:	56                   	push   %esi
+  8010d8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010de:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010e3:	89 d1                	mov    %edx,%ecx
+  8010e5:	89 d3                	mov    %edx,%ebx
+  8010e7:	89 d7                	mov    %edx,%edi
+  8010e9:	55                   	push   %ebp
+  8010ea:	89 e5                	mov    %esp,%ebp
+  8010ec:	8d 35 f4 10 80 00    	lea    0x8010f4,%esi
+  8010f2:	0f 34                	sysenter
+  8010f4:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  8010f5:	5b                   	pop    %ebx
+  8010f6:	5e                   	pop    %esi
+  8010f7:	5f                   	pop    %edi
+  8010f8:	5d                   	pop    %ebp
+  8010f9:	c3                   	ret
+
+008010fa <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8010fa:	55                   	push   %ebp
+  8010fb:	89 e5                	mov    %esp,%ebp
+  8010fd:	57                   	push   %edi
+  8010fe:	56                   	push   %esi
+  8010ff:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801100:	ba 00 00 00 00       	mov    $0x0,%edx
+  801105:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80110a:	89 d1                	mov    %edx,%ecx
+  80110c:	89 d3                	mov    %edx,%ebx
+  80110e:	89 d7                	mov    %edx,%edi
+  801110:	89 d6                	mov    %edx,%esi
+  801112:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801114:	5b                   	pop    %ebx
+  801115:	5e                   	pop    %esi
+  801116:	5f                   	pop    %edi
+  801117:	5d                   	pop    %ebp
+  801118:	c3                   	ret
+
+00801119 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801119:	55                   	push   %ebp
+  80111a:	89 e5                	mov    %esp,%ebp
+  80111c:	57                   	push   %edi
+  80111d:	56                   	push   %esi
+  80111e:	53                   	push   %ebx
+  80111f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801122:	8b 55 08             	mov    0x8(%ebp),%edx
+  801125:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801128:	b8 04 00 00 00       	mov    $0x4,%eax
+  80112d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801132:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801135:	55                   	push   %ebp
+  801136:	89 e5                	mov    %esp,%ebp
+  801138:	8d 35 40 11 80 00    	lea    0x801140,%esi
+  80113e:	0f 34                	sysenter
+  801140:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801141:	85 c0                	test   %eax,%eax
+  801143:	7f 08                	jg     80114d <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  801145:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801148:	5b                   	pop    %ebx
+  801149:	5e                   	pop    %esi
+  80114a:	5f                   	pop    %edi
+  80114b:	5d                   	pop    %ebp
+  80114c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114d:	83 ec 0c             	sub    $0xc,%esp
+  801150:	50                   	push   %eax
+  801151:	6a 04                	push   $0x4
+  801153:	68 47 41 80 00       	push   $0x804147
+  801158:	6a 3d                	push   $0x3d
+  80115a:	68 64 41 80 00       	push   $0x804164
+  80115f:	e8 e0 f4 ff ff       	call   800644 <_panic>
+
+00801164 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+  80116a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80116d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801170:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801173:	b8 05 00 00 00       	mov    $0x5,%eax
+  801178:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80117b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80117e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801181:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801183:	85 c0                	test   %eax,%eax
+  801185:	7f 08                	jg     80118f <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801187:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80118a:	5b                   	pop    %ebx
+  80118b:	5e                   	pop    %esi
+  80118c:	5f                   	pop    %edi
+  80118d:	5d                   	pop    %ebp
+  80118e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118f:	83 ec 0c             	sub    $0xc,%esp
+  801192:	50                   	push   %eax
+  801193:	6a 05                	push   $0x5
+  801195:	68 47 41 80 00       	push   $0x804147
+  80119a:	6a 23                	push   $0x23
+  80119c:	68 64 41 80 00       	push   $0x804164
+  8011a1:	e8 9e f4 ff ff       	call   800644 <_panic>
+
+008011a6 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	57                   	push   %edi
+  8011aa:	56                   	push   %esi
+  8011ab:	53                   	push   %ebx
+  8011ac:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8011af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ba:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011bf:	89 df                	mov    %ebx,%edi
+  8011c1:	55                   	push   %ebp
+  8011c2:	89 e5                	mov    %esp,%ebp
+  8011c4:	8d 35 cc 11 80 00    	lea    0x8011cc,%esi
+  8011ca:	0f 34                	sysenter
+  8011cc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011cd:	85 c0                	test   %eax,%eax
+  8011cf:	7f 08                	jg     8011d9 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  8011d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d4:	5b                   	pop    %ebx
+  8011d5:	5e                   	pop    %esi
+  8011d6:	5f                   	pop    %edi
+  8011d7:	5d                   	pop    %ebp
+  8011d8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011d9:	83 ec 0c             	sub    $0xc,%esp
+  8011dc:	50                   	push   %eax
+  8011dd:	6a 06                	push   $0x6
+  8011df:	68 47 41 80 00       	push   $0x804147
+  8011e4:	6a 3d                	push   $0x3d
+  8011e6:	68 64 41 80 00       	push   $0x804164
+  8011eb:	e8 54 f4 ff ff       	call   800644 <_panic>
+
+008011f0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8011f0:	55                   	push   %ebp
+  8011f1:	89 e5                	mov    %esp,%ebp
+  8011f3:	57                   	push   %edi
+  8011f4:	56                   	push   %esi
+  8011f5:	53                   	push   %ebx
+  8011f6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8011f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801201:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801204:	b8 08 00 00 00       	mov    $0x8,%eax
+  801209:	89 df                	mov    %ebx,%edi
+  80120b:	55                   	push   %ebp
+  80120c:	89 e5                	mov    %esp,%ebp
+  80120e:	8d 35 16 12 80 00    	lea    0x801216,%esi
+  801214:	0f 34                	sysenter
+  801216:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801217:	85 c0                	test   %eax,%eax
+  801219:	7f 08                	jg     801223 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  80121b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80121e:	5b                   	pop    %ebx
+  80121f:	5e                   	pop    %esi
+  801220:	5f                   	pop    %edi
+  801221:	5d                   	pop    %ebp
+  801222:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801223:	83 ec 0c             	sub    $0xc,%esp
+  801226:	50                   	push   %eax
+  801227:	6a 08                	push   $0x8
+  801229:	68 47 41 80 00       	push   $0x804147
+  80122e:	6a 3d                	push   $0x3d
+  801230:	68 64 41 80 00       	push   $0x804164
+  801235:	e8 0a f4 ff ff       	call   800644 <_panic>
+
+0080123a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80123a:	55                   	push   %ebp
+  80123b:	89 e5                	mov    %esp,%ebp
+  80123d:	57                   	push   %edi
+  80123e:	56                   	push   %esi
+  80123f:	53                   	push   %ebx
+  801240:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801243:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801248:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801253:	89 df                	mov    %ebx,%edi
+  801255:	55                   	push   %ebp
+  801256:	89 e5                	mov    %esp,%ebp
+  801258:	8d 35 60 12 80 00    	lea    0x801260,%esi
+  80125e:	0f 34                	sysenter
+  801260:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801261:	85 c0                	test   %eax,%eax
+  801263:	7f 08                	jg     80126d <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  801265:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801268:	5b                   	pop    %ebx
+  801269:	5e                   	pop    %esi
+  80126a:	5f                   	pop    %edi
+  80126b:	5d                   	pop    %ebp
+  80126c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80126d:	83 ec 0c             	sub    $0xc,%esp
+  801270:	50                   	push   %eax
+  801271:	6a 09                	push   $0x9
+  801273:	68 47 41 80 00       	push   $0x804147
+  801278:	6a 3d                	push   $0x3d
+  80127a:	68 64 41 80 00       	push   $0x804164
+  80127f:	e8 c0 f3 ff ff       	call   800644 <_panic>
+
+00801284 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801284:	55                   	push   %ebp
+  801285:	89 e5                	mov    %esp,%ebp
+  801287:	57                   	push   %edi
+  801288:	56                   	push   %esi
+  801289:	53                   	push   %ebx
+  80128a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80128d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801292:	8b 55 08             	mov    0x8(%ebp),%edx
+  801295:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801298:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80129d:	89 df                	mov    %ebx,%edi
+  80129f:	55                   	push   %ebp
+  8012a0:	89 e5                	mov    %esp,%ebp
+  8012a2:	8d 35 aa 12 80 00    	lea    0x8012aa,%esi
+  8012a8:	0f 34                	sysenter
+  8012aa:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012ab:	85 c0                	test   %eax,%eax
+  8012ad:	7f 08                	jg     8012b7 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  8012af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b2:	5b                   	pop    %ebx
+  8012b3:	5e                   	pop    %esi
+  8012b4:	5f                   	pop    %edi
+  8012b5:	5d                   	pop    %ebp
+  8012b6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012b7:	83 ec 0c             	sub    $0xc,%esp
+  8012ba:	50                   	push   %eax
+  8012bb:	6a 0a                	push   $0xa
+  8012bd:	68 47 41 80 00       	push   $0x804147
+  8012c2:	6a 3d                	push   $0x3d
+  8012c4:	68 64 41 80 00       	push   $0x804164
+  8012c9:	e8 76 f3 ff ff       	call   800644 <_panic>
+
+008012ce <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8012ce:	55                   	push   %ebp
+  8012cf:	89 e5                	mov    %esp,%ebp
+  8012d1:	57                   	push   %edi
+  8012d2:	56                   	push   %esi
+  8012d3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012da:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012e2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012e5:	55                   	push   %ebp
+  8012e6:	89 e5                	mov    %esp,%ebp
+  8012e8:	8d 35 f0 12 80 00    	lea    0x8012f0,%esi
+  8012ee:	0f 34                	sysenter
+  8012f0:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  8012f1:	5b                   	pop    %ebx
+  8012f2:	5e                   	pop    %esi
+  8012f3:	5f                   	pop    %edi
+  8012f4:	5d                   	pop    %ebp
+  8012f5:	c3                   	ret
+
+008012f6 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  8012f6:	55                   	push   %ebp
+  8012f7:	89 e5                	mov    %esp,%ebp
+  8012f9:	57                   	push   %edi
+  8012fa:	56                   	push   %esi
+  8012fb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801302:	b8 17 00 00 00       	mov    $0x17,%eax
+  801307:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80130a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80130d:	55                   	push   %ebp
+  80130e:	89 e5                	mov    %esp,%ebp
+  801310:	8d 35 18 13 80 00    	lea    0x801318,%esi
+  801316:	0f 34                	sysenter
+  801318:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  801319:	5b                   	pop    %ebx
+  80131a:	5e                   	pop    %esi
+  80131b:	5f                   	pop    %edi
+  80131c:	5d                   	pop    %ebp
+  80131d:	c3                   	ret
+
+0080131e <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  80131e:	55                   	push   %ebp
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	57                   	push   %edi
+  801322:	56                   	push   %esi
+  801323:	53                   	push   %ebx
+  801324:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801327:	be 00 00 00 00       	mov    $0x0,%esi
+  80132c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801332:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801337:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80133a:	89 f7                	mov    %esi,%edi
+  80133c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80133e:	85 c0                	test   %eax,%eax
+  801340:	7f 08                	jg     80134a <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  801342:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801345:	5b                   	pop    %ebx
+  801346:	5e                   	pop    %esi
+  801347:	5f                   	pop    %edi
+  801348:	5d                   	pop    %ebp
+  801349:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80134a:	83 ec 0c             	sub    $0xc,%esp
+  80134d:	50                   	push   %eax
+  80134e:	6a 0d                	push   $0xd
+  801350:	68 47 41 80 00       	push   $0x804147
+  801355:	6a 23                	push   $0x23
+  801357:	68 64 41 80 00       	push   $0x804164
+  80135c:	e8 e3 f2 ff ff       	call   800644 <_panic>
+
+00801361 <sys_ipc_recv>:
+{
+  801361:	55                   	push   %ebp
+  801362:	89 e5                	mov    %esp,%ebp
+  801364:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  801367:	6a 00                	push   $0x0
+  801369:	6a 01                	push   $0x1
+  80136b:	ff 75 08             	push   0x8(%ebp)
+  80136e:	e8 ab ff ff ff       	call   80131e <sys_ipc_recvv>
+}
+  801373:	c9                   	leave
+  801374:	c3                   	ret
+
+00801375 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  801375:	55                   	push   %ebp
+  801376:	89 e5                	mov    %esp,%ebp
+  801378:	57                   	push   %edi
+  801379:	56                   	push   %esi
+  80137a:	53                   	push   %ebx
+  80137b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80137e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801383:	8b 55 08             	mov    0x8(%ebp),%edx
+  801386:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801389:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80138e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801391:	89 de                	mov    %ebx,%esi
+  801393:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801395:	85 c0                	test   %eax,%eax
+  801397:	7f 08                	jg     8013a1 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  801399:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80139c:	5b                   	pop    %ebx
+  80139d:	5e                   	pop    %esi
+  80139e:	5f                   	pop    %edi
+  80139f:	5d                   	pop    %ebp
+  8013a0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013a1:	83 ec 0c             	sub    $0xc,%esp
+  8013a4:	50                   	push   %eax
+  8013a5:	6a 0d                	push   $0xd
+  8013a7:	68 47 41 80 00       	push   $0x804147
+  8013ac:	6a 23                	push   $0x23
+  8013ae:	68 64 41 80 00       	push   $0x804164
+  8013b3:	e8 8c f2 ff ff       	call   800644 <_panic>
+
+008013b8 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8013b8:	55                   	push   %ebp
+  8013b9:	89 e5                	mov    %esp,%ebp
+  8013bb:	57                   	push   %edi
+  8013bc:	56                   	push   %esi
+  8013bd:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8013be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013c8:	89 d1                	mov    %edx,%ecx
+  8013ca:	89 d3                	mov    %edx,%ebx
+  8013cc:	89 d7                	mov    %edx,%edi
+  8013ce:	55                   	push   %ebp
+  8013cf:	89 e5                	mov    %esp,%ebp
+  8013d1:	8d 35 d9 13 80 00    	lea    0x8013d9,%esi
+  8013d7:	0f 34                	sysenter
+  8013d9:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  8013da:	5b                   	pop    %ebx
+  8013db:	5e                   	pop    %esi
+  8013dc:	5f                   	pop    %edi
+  8013dd:	5d                   	pop    %ebp
+  8013de:	c3                   	ret
+
+008013df <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  8013df:	55                   	push   %ebp
+  8013e0:	89 e5                	mov    %esp,%ebp
+  8013e2:	57                   	push   %edi
+  8013e3:	56                   	push   %esi
+  8013e4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8013e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8013f5:	89 df                	mov    %ebx,%edi
+  8013f7:	55                   	push   %ebp
+  8013f8:	89 e5                	mov    %esp,%ebp
+  8013fa:	8d 35 02 14 80 00    	lea    0x801402,%esi
+  801400:	0f 34                	sysenter
+  801402:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  801403:	5b                   	pop    %ebx
+  801404:	5e                   	pop    %esi
+  801405:	5f                   	pop    %edi
+  801406:	5d                   	pop    %ebp
+  801407:	c3                   	ret
+
+00801408 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  801408:	55                   	push   %ebp
+  801409:	89 e5                	mov    %esp,%ebp
+  80140b:	57                   	push   %edi
+  80140c:	56                   	push   %esi
+  80140d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80140e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801413:	8b 55 08             	mov    0x8(%ebp),%edx
+  801416:	b8 10 00 00 00       	mov    $0x10,%eax
+  80141b:	89 cb                	mov    %ecx,%ebx
+  80141d:	89 cf                	mov    %ecx,%edi
+  80141f:	55                   	push   %ebp
+  801420:	89 e5                	mov    %esp,%ebp
+  801422:	8d 35 2a 14 80 00    	lea    0x80142a,%esi
+  801428:	0f 34                	sysenter
+  80142a:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  80142b:	5b                   	pop    %ebx
+  80142c:	5e                   	pop    %esi
+  80142d:	5f                   	pop    %edi
+  80142e:	5d                   	pop    %ebp
+  80142f:	c3                   	ret
+
+00801430 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  801430:	55                   	push   %ebp
+  801431:	89 e5                	mov    %esp,%ebp
+  801433:	57                   	push   %edi
+  801434:	56                   	push   %esi
+  801435:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801436:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801441:	b8 12 00 00 00       	mov    $0x12,%eax
+  801446:	89 df                	mov    %ebx,%edi
+  801448:	55                   	push   %ebp
+  801449:	89 e5                	mov    %esp,%ebp
+  80144b:	8d 35 53 14 80 00    	lea    0x801453,%esi
+  801451:	0f 34                	sysenter
+  801453:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  801454:	5b                   	pop    %ebx
+  801455:	5e                   	pop    %esi
+  801456:	5f                   	pop    %edi
+  801457:	5d                   	pop    %ebp
+  801458:	c3                   	ret
+
+00801459 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  801459:	55                   	push   %ebp
+  80145a:	89 e5                	mov    %esp,%ebp
+  80145c:	57                   	push   %edi
+  80145d:	56                   	push   %esi
+  80145e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80145f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801464:	8b 55 08             	mov    0x8(%ebp),%edx
+  801467:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80146f:	89 df                	mov    %ebx,%edi
+  801471:	55                   	push   %ebp
+  801472:	89 e5                	mov    %esp,%ebp
+  801474:	8d 35 7c 14 80 00    	lea    0x80147c,%esi
+  80147a:	0f 34                	sysenter
+  80147c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  80147d:	5b                   	pop    %ebx
+  80147e:	5e                   	pop    %esi
+  80147f:	5f                   	pop    %edi
+  801480:	5d                   	pop    %ebp
+  801481:	c3                   	ret
+
+00801482 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  801482:	55                   	push   %ebp
+  801483:	89 e5                	mov    %esp,%ebp
+  801485:	57                   	push   %edi
+  801486:	56                   	push   %esi
+  801487:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801488:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801493:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801496:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801499:	55                   	push   %ebp
+  80149a:	89 e5                	mov    %esp,%ebp
+  80149c:	8d 35 a4 14 80 00    	lea    0x8014a4,%esi
+  8014a2:	0f 34                	sysenter
+  8014a4:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  8014a5:	5b                   	pop    %ebx
+  8014a6:	5e                   	pop    %esi
+  8014a7:	5f                   	pop    %edi
+  8014a8:	5d                   	pop    %ebp
+  8014a9:	c3                   	ret
+
+008014aa <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  8014aa:	55                   	push   %ebp
+  8014ab:	89 e5                	mov    %esp,%ebp
+  8014ad:	57                   	push   %edi
+  8014ae:	56                   	push   %esi
+  8014af:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b8:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014bd:	89 cb                	mov    %ecx,%ebx
+  8014bf:	89 cf                	mov    %ecx,%edi
+  8014c1:	89 ce                	mov    %ecx,%esi
+  8014c3:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  8014c5:	5b                   	pop    %ebx
+  8014c6:	5e                   	pop    %esi
+  8014c7:	5f                   	pop    %edi
+  8014c8:	5d                   	pop    %ebp
+  8014c9:	c3                   	ret
+
+008014ca <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  8014ca:	55                   	push   %ebp
+  8014cb:	89 e5                	mov    %esp,%ebp
+  8014cd:	57                   	push   %edi
+  8014ce:	56                   	push   %esi
+  8014cf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8014d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8014dd:	89 cb                	mov    %ecx,%ebx
+  8014df:	89 cf                	mov    %ecx,%edi
+  8014e1:	55                   	push   %ebp
+  8014e2:	89 e5                	mov    %esp,%ebp
+  8014e4:	8d 35 ec 14 80 00    	lea    0x8014ec,%esi
+  8014ea:	0f 34                	sysenter
+  8014ec:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8014ed:	5b                   	pop    %ebx
+  8014ee:	5e                   	pop    %esi
+  8014ef:	5f                   	pop    %edi
+  8014f0:	5d                   	pop    %ebp
+  8014f1:	c3                   	ret
+
+008014f2 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8014f2:	55                   	push   %ebp
+  8014f3:	89 e5                	mov    %esp,%ebp
+  8014f5:	57                   	push   %edi
+  8014f6:	56                   	push   %esi
+  8014f7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8014f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801500:	b8 16 00 00 00       	mov    $0x16,%eax
+  801505:	89 cb                	mov    %ecx,%ebx
+  801507:	89 cf                	mov    %ecx,%edi
+  801509:	55                   	push   %ebp
+  80150a:	89 e5                	mov    %esp,%ebp
+  80150c:	8d 35 14 15 80 00    	lea    0x801514,%esi
+  801512:	0f 34                	sysenter
+  801514:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  801515:	5b                   	pop    %ebx
+  801516:	5e                   	pop    %esi
+  801517:	5f                   	pop    %edi
+  801518:	5d                   	pop    %ebp
+  801519:	c3                   	ret
+
+0080151a <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80151a:	55                   	push   %ebp
+  80151b:	89 e5                	mov    %esp,%ebp
+  80151d:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  801520:	83 3d b0 60 80 00 00 	cmpl   $0x0,0x8060b0
+  801527:	74 0a                	je     801533 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801529:	8b 45 08             	mov    0x8(%ebp),%eax
+  80152c:	a3 b0 60 80 00       	mov    %eax,0x8060b0
+}
+  801531:	c9                   	leave
+  801532:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  801533:	83 ec 04             	sub    $0x4,%esp
+  801536:	6a 07                	push   $0x7
+  801538:	68 00 f0 bf ee       	push   $0xeebff000
+  80153d:	6a 00                	push   $0x0
+  80153f:	e8 d5 fb ff ff       	call   801119 <sys_page_alloc>
+  801544:	83 c4 10             	add    $0x10,%esp
+  801547:	85 c0                	test   %eax,%eax
+  801549:	75 2c                	jne    801577 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80154b:	83 ec 08             	sub    $0x8,%esp
+  80154e:	68 8d 15 80 00       	push   $0x80158d
+  801553:	6a 00                	push   $0x0
+  801555:	e8 2a fd ff ff       	call   801284 <sys_env_set_pgfault_upcall>
+  80155a:	83 c4 10             	add    $0x10,%esp
+  80155d:	85 c0                	test   %eax,%eax
+  80155f:	74 c8                	je     801529 <set_pgfault_handler+0xf>
+  801561:	68 bc 41 80 00       	push   $0x8041bc
+  801566:	68 ec 41 80 00       	push   $0x8041ec
+  80156b:	6a 20                	push   $0x20
+  80156d:	68 01 42 80 00       	push   $0x804201
+  801572:	e8 cd f0 ff ff       	call   800644 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  801577:	68 74 41 80 00       	push   $0x804174
+  80157c:	68 ec 41 80 00       	push   $0x8041ec
+  801581:	6a 1e                	push   $0x1e
+  801583:	68 01 42 80 00       	push   $0x804201
+  801588:	e8 b7 f0 ff ff       	call   800644 <_panic>
+
+0080158d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80158d:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80158e:	a1 b0 60 80 00       	mov    0x8060b0,%eax
+	call *%eax
+  801593:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801595:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  801598:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  80159d:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8015a2:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8015a6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8015a9:	83 c4 08             	add    $0x8,%esp
+	popal
+  8015ac:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8015ad:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8015b0:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8015b1:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8015b2:	c3                   	ret
+
+008015b3 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8015b3:	55                   	push   %ebp
+  8015b4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015b9:	05 00 00 00 30       	add    $0x30000000,%eax
+  8015be:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8015c1:	5d                   	pop    %ebp
+  8015c2:	c3                   	ret
+
+008015c3 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8015c3:	55                   	push   %ebp
+  8015c4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015c9:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8015ce:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8015d3:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8015d8:	5d                   	pop    %ebp
+  8015d9:	c3                   	ret
+
+008015da <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8015da:	55                   	push   %ebp
+  8015db:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8015dd:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8015e2:	eb 02                	jmp    8015e6 <fd_alloc+0xc>
+  8015e4:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8015e6:	89 c2                	mov    %eax,%edx
+  8015e8:	c1 ea 16             	shr    $0x16,%edx
+  8015eb:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8015f2:	f6 c2 01             	test   $0x1,%dl
+  8015f5:	74 2b                	je     801622 <fd_alloc+0x48>
+  8015f7:	89 c2                	mov    %eax,%edx
+  8015f9:	c1 ea 0c             	shr    $0xc,%edx
+  8015fc:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801603:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801609:	f6 c1 01             	test   $0x1,%cl
+  80160c:	74 14                	je     801622 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80160e:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801614:	75 ce                	jne    8015e4 <fd_alloc+0xa>
+  801616:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80161b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801620:	eb 05                	jmp    801627 <fd_alloc+0x4d>
+			return 0;
+  801622:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801627:	8b 55 08             	mov    0x8(%ebp),%edx
+  80162a:	89 02                	mov    %eax,(%edx)
+}
+  80162c:	89 c8                	mov    %ecx,%eax
+  80162e:	5d                   	pop    %ebp
+  80162f:	c3                   	ret
+
+00801630 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801630:	55                   	push   %ebp
+  801631:	89 e5                	mov    %esp,%ebp
+  801633:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801636:	83 f8 1f             	cmp    $0x1f,%eax
+  801639:	77 30                	ja     80166b <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80163b:	c1 e0 0c             	shl    $0xc,%eax
+  80163e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801643:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801649:	f6 c2 01             	test   $0x1,%dl
+  80164c:	74 24                	je     801672 <fd_lookup+0x42>
+  80164e:	89 c2                	mov    %eax,%edx
+  801650:	c1 ea 0c             	shr    $0xc,%edx
+  801653:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80165a:	f6 c2 01             	test   $0x1,%dl
+  80165d:	74 1a                	je     801679 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80165f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801662:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801664:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801669:	5d                   	pop    %ebp
+  80166a:	c3                   	ret
+		return -E_INVAL;
+  80166b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801670:	eb f7                	jmp    801669 <fd_lookup+0x39>
+		return -E_INVAL;
+  801672:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801677:	eb f0                	jmp    801669 <fd_lookup+0x39>
+  801679:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80167e:	eb e9                	jmp    801669 <fd_lookup+0x39>
+
+00801680 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801680:	55                   	push   %ebp
+  801681:	89 e5                	mov    %esp,%ebp
+  801683:	53                   	push   %ebx
+  801684:	83 ec 04             	sub    $0x4,%esp
+  801687:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80168a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80168f:	eb 03                	jmp    801694 <dev_lookup+0x14>
+  801691:	83 c0 01             	add    $0x1,%eax
+  801694:	8b 1c 85 8c 42 80 00 	mov    0x80428c(,%eax,4),%ebx
+  80169b:	85 db                	test   %ebx,%ebx
+  80169d:	74 0b                	je     8016aa <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80169f:	39 13                	cmp    %edx,(%ebx)
+  8016a1:	75 ee                	jne    801691 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8016a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a8:	eb 1f                	jmp    8016c9 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8016aa:	a1 ac 60 80 00       	mov    0x8060ac,%eax
+  8016af:	8b 40 48             	mov    0x48(%eax),%eax
+  8016b2:	83 ec 04             	sub    $0x4,%esp
+  8016b5:	52                   	push   %edx
+  8016b6:	50                   	push   %eax
+  8016b7:	68 10 42 80 00       	push   $0x804210
+  8016bc:	e8 5e f0 ff ff       	call   80071f <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8016c1:	83 c4 10             	add    $0x10,%esp
+  8016c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8016c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016cc:	89 1a                	mov    %ebx,(%edx)
+}
+  8016ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016d1:	c9                   	leave
+  8016d2:	c3                   	ret
+
+008016d3 <fd_close>:
+{
+  8016d3:	55                   	push   %ebp
+  8016d4:	89 e5                	mov    %esp,%ebp
+  8016d6:	57                   	push   %edi
+  8016d7:	56                   	push   %esi
+  8016d8:	53                   	push   %ebx
+  8016d9:	83 ec 24             	sub    $0x24,%esp
+  8016dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8016df:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8016e2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016e5:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8016e6:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8016ec:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8016ef:	50                   	push   %eax
+  8016f0:	e8 3b ff ff ff       	call   801630 <fd_lookup>
+  8016f5:	89 c3                	mov    %eax,%ebx
+  8016f7:	83 c4 10             	add    $0x10,%esp
+  8016fa:	85 c0                	test   %eax,%eax
+  8016fc:	78 05                	js     801703 <fd_close+0x30>
+	    || fd != fd2)
+  8016fe:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801701:	74 16                	je     801719 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801703:	89 f8                	mov    %edi,%eax
+  801705:	84 c0                	test   %al,%al
+  801707:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80170f:	89 d8                	mov    %ebx,%eax
+  801711:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801714:	5b                   	pop    %ebx
+  801715:	5e                   	pop    %esi
+  801716:	5f                   	pop    %edi
+  801717:	5d                   	pop    %ebp
+  801718:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801719:	83 ec 08             	sub    $0x8,%esp
+  80171c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80171f:	50                   	push   %eax
+  801720:	ff 36                	push   (%esi)
+  801722:	e8 59 ff ff ff       	call   801680 <dev_lookup>
+  801727:	89 c3                	mov    %eax,%ebx
+  801729:	83 c4 10             	add    $0x10,%esp
+  80172c:	85 c0                	test   %eax,%eax
+  80172e:	78 1a                	js     80174a <fd_close+0x77>
+		if (dev->dev_close)
+  801730:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801733:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801736:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80173b:	85 c0                	test   %eax,%eax
+  80173d:	74 0b                	je     80174a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80173f:	83 ec 0c             	sub    $0xc,%esp
+  801742:	56                   	push   %esi
+  801743:	ff d0                	call   *%eax
+  801745:	89 c3                	mov    %eax,%ebx
+  801747:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80174a:	83 ec 08             	sub    $0x8,%esp
+  80174d:	56                   	push   %esi
+  80174e:	6a 00                	push   $0x0
+  801750:	e8 51 fa ff ff       	call   8011a6 <sys_page_unmap>
+	return r;
+  801755:	83 c4 10             	add    $0x10,%esp
+  801758:	eb b5                	jmp    80170f <fd_close+0x3c>
+
+0080175a <close>:
+
+int
+close(int fdnum)
+{
+  80175a:	55                   	push   %ebp
+  80175b:	89 e5                	mov    %esp,%ebp
+  80175d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801760:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801763:	50                   	push   %eax
+  801764:	ff 75 08             	push   0x8(%ebp)
+  801767:	e8 c4 fe ff ff       	call   801630 <fd_lookup>
+  80176c:	83 c4 10             	add    $0x10,%esp
+  80176f:	85 c0                	test   %eax,%eax
+  801771:	79 02                	jns    801775 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801773:	c9                   	leave
+  801774:	c3                   	ret
+		return fd_close(fd, 1);
+  801775:	83 ec 08             	sub    $0x8,%esp
+  801778:	6a 01                	push   $0x1
+  80177a:	ff 75 f4             	push   -0xc(%ebp)
+  80177d:	e8 51 ff ff ff       	call   8016d3 <fd_close>
+  801782:	83 c4 10             	add    $0x10,%esp
+  801785:	eb ec                	jmp    801773 <close+0x19>
+
+00801787 <close_all>:
+
+void
+close_all(void)
+{
+  801787:	55                   	push   %ebp
+  801788:	89 e5                	mov    %esp,%ebp
+  80178a:	53                   	push   %ebx
+  80178b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80178e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801793:	83 ec 0c             	sub    $0xc,%esp
+  801796:	53                   	push   %ebx
+  801797:	e8 be ff ff ff       	call   80175a <close>
+	for (i = 0; i < MAXFD; i++)
+  80179c:	83 c3 01             	add    $0x1,%ebx
+  80179f:	83 c4 10             	add    $0x10,%esp
+  8017a2:	83 fb 20             	cmp    $0x20,%ebx
+  8017a5:	75 ec                	jne    801793 <close_all+0xc>
+}
+  8017a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017aa:	c9                   	leave
+  8017ab:	c3                   	ret
+
+008017ac <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8017ac:	55                   	push   %ebp
+  8017ad:	89 e5                	mov    %esp,%ebp
+  8017af:	57                   	push   %edi
+  8017b0:	56                   	push   %esi
+  8017b1:	53                   	push   %ebx
+  8017b2:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8017b5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017b8:	50                   	push   %eax
+  8017b9:	ff 75 08             	push   0x8(%ebp)
+  8017bc:	e8 6f fe ff ff       	call   801630 <fd_lookup>
+  8017c1:	89 c3                	mov    %eax,%ebx
+  8017c3:	83 c4 10             	add    $0x10,%esp
+  8017c6:	85 c0                	test   %eax,%eax
+  8017c8:	78 7f                	js     801849 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8017ca:	83 ec 0c             	sub    $0xc,%esp
+  8017cd:	ff 75 0c             	push   0xc(%ebp)
+  8017d0:	e8 85 ff ff ff       	call   80175a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8017d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8017d8:	c1 e6 0c             	shl    $0xc,%esi
+  8017db:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8017e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8017e4:	89 3c 24             	mov    %edi,(%esp)
+  8017e7:	e8 d7 fd ff ff       	call   8015c3 <fd2data>
+  8017ec:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8017ee:	89 34 24             	mov    %esi,(%esp)
+  8017f1:	e8 cd fd ff ff       	call   8015c3 <fd2data>
+  8017f6:	83 c4 10             	add    $0x10,%esp
+  8017f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8017fc:	89 d8                	mov    %ebx,%eax
+  8017fe:	c1 e8 16             	shr    $0x16,%eax
+  801801:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801808:	a8 01                	test   $0x1,%al
+  80180a:	74 11                	je     80181d <dup+0x71>
+  80180c:	89 d8                	mov    %ebx,%eax
+  80180e:	c1 e8 0c             	shr    $0xc,%eax
+  801811:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801818:	f6 c2 01             	test   $0x1,%dl
+  80181b:	75 36                	jne    801853 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80181d:	89 f8                	mov    %edi,%eax
+  80181f:	c1 e8 0c             	shr    $0xc,%eax
+  801822:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801829:	83 ec 0c             	sub    $0xc,%esp
+  80182c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801831:	50                   	push   %eax
+  801832:	56                   	push   %esi
+  801833:	6a 00                	push   $0x0
+  801835:	57                   	push   %edi
+  801836:	6a 00                	push   $0x0
+  801838:	e8 27 f9 ff ff       	call   801164 <sys_page_map>
+  80183d:	89 c3                	mov    %eax,%ebx
+  80183f:	83 c4 20             	add    $0x20,%esp
+  801842:	85 c0                	test   %eax,%eax
+  801844:	78 33                	js     801879 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801846:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801849:	89 d8                	mov    %ebx,%eax
+  80184b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80184e:	5b                   	pop    %ebx
+  80184f:	5e                   	pop    %esi
+  801850:	5f                   	pop    %edi
+  801851:	5d                   	pop    %ebp
+  801852:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801853:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80185a:	83 ec 0c             	sub    $0xc,%esp
+  80185d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801862:	50                   	push   %eax
+  801863:	ff 75 d4             	push   -0x2c(%ebp)
+  801866:	6a 00                	push   $0x0
+  801868:	53                   	push   %ebx
+  801869:	6a 00                	push   $0x0
+  80186b:	e8 f4 f8 ff ff       	call   801164 <sys_page_map>
+  801870:	89 c3                	mov    %eax,%ebx
+  801872:	83 c4 20             	add    $0x20,%esp
+  801875:	85 c0                	test   %eax,%eax
+  801877:	79 a4                	jns    80181d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801879:	83 ec 08             	sub    $0x8,%esp
+  80187c:	56                   	push   %esi
+  80187d:	6a 00                	push   $0x0
+  80187f:	e8 22 f9 ff ff       	call   8011a6 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801884:	83 c4 08             	add    $0x8,%esp
+  801887:	ff 75 d4             	push   -0x2c(%ebp)
+  80188a:	6a 00                	push   $0x0
+  80188c:	e8 15 f9 ff ff       	call   8011a6 <sys_page_unmap>
+	return r;
+  801891:	83 c4 10             	add    $0x10,%esp
+  801894:	eb b3                	jmp    801849 <dup+0x9d>
+
+00801896 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801896:	55                   	push   %ebp
+  801897:	89 e5                	mov    %esp,%ebp
+  801899:	56                   	push   %esi
+  80189a:	53                   	push   %ebx
+  80189b:	83 ec 18             	sub    $0x18,%esp
+  80189e:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018a1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018a4:	50                   	push   %eax
+  8018a5:	56                   	push   %esi
+  8018a6:	e8 85 fd ff ff       	call   801630 <fd_lookup>
+  8018ab:	83 c4 10             	add    $0x10,%esp
+  8018ae:	85 c0                	test   %eax,%eax
+  8018b0:	78 3c                	js     8018ee <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018b2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8018b5:	83 ec 08             	sub    $0x8,%esp
+  8018b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018bb:	50                   	push   %eax
+  8018bc:	ff 33                	push   (%ebx)
+  8018be:	e8 bd fd ff ff       	call   801680 <dev_lookup>
+  8018c3:	83 c4 10             	add    $0x10,%esp
+  8018c6:	85 c0                	test   %eax,%eax
+  8018c8:	78 24                	js     8018ee <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8018ca:	8b 43 08             	mov    0x8(%ebx),%eax
+  8018cd:	83 e0 03             	and    $0x3,%eax
+  8018d0:	83 f8 01             	cmp    $0x1,%eax
+  8018d3:	74 20                	je     8018f5 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8018d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018d8:	8b 40 08             	mov    0x8(%eax),%eax
+  8018db:	85 c0                	test   %eax,%eax
+  8018dd:	74 37                	je     801916 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8018df:	83 ec 04             	sub    $0x4,%esp
+  8018e2:	ff 75 10             	push   0x10(%ebp)
+  8018e5:	ff 75 0c             	push   0xc(%ebp)
+  8018e8:	53                   	push   %ebx
+  8018e9:	ff d0                	call   *%eax
+  8018eb:	83 c4 10             	add    $0x10,%esp
+}
+  8018ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018f1:	5b                   	pop    %ebx
+  8018f2:	5e                   	pop    %esi
+  8018f3:	5d                   	pop    %ebp
+  8018f4:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018f5:	a1 ac 60 80 00       	mov    0x8060ac,%eax
+  8018fa:	8b 40 48             	mov    0x48(%eax),%eax
+  8018fd:	83 ec 04             	sub    $0x4,%esp
+  801900:	56                   	push   %esi
+  801901:	50                   	push   %eax
+  801902:	68 51 42 80 00       	push   $0x804251
+  801907:	e8 13 ee ff ff       	call   80071f <cprintf>
+		return -E_INVAL;
+  80190c:	83 c4 10             	add    $0x10,%esp
+  80190f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801914:	eb d8                	jmp    8018ee <read+0x58>
+		return -E_NOT_SUPP;
+  801916:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80191b:	eb d1                	jmp    8018ee <read+0x58>
+
+0080191d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80191d:	55                   	push   %ebp
+  80191e:	89 e5                	mov    %esp,%ebp
+  801920:	57                   	push   %edi
+  801921:	56                   	push   %esi
+  801922:	53                   	push   %ebx
+  801923:	83 ec 0c             	sub    $0xc,%esp
+  801926:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801929:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80192c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801931:	eb 02                	jmp    801935 <readn+0x18>
+  801933:	01 c3                	add    %eax,%ebx
+  801935:	39 f3                	cmp    %esi,%ebx
+  801937:	73 21                	jae    80195a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801939:	83 ec 04             	sub    $0x4,%esp
+  80193c:	89 f0                	mov    %esi,%eax
+  80193e:	29 d8                	sub    %ebx,%eax
+  801940:	50                   	push   %eax
+  801941:	89 d8                	mov    %ebx,%eax
+  801943:	03 45 0c             	add    0xc(%ebp),%eax
+  801946:	50                   	push   %eax
+  801947:	57                   	push   %edi
+  801948:	e8 49 ff ff ff       	call   801896 <read>
+		if (m < 0)
+  80194d:	83 c4 10             	add    $0x10,%esp
+  801950:	85 c0                	test   %eax,%eax
+  801952:	78 04                	js     801958 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801954:	75 dd                	jne    801933 <readn+0x16>
+  801956:	eb 02                	jmp    80195a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801958:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80195a:	89 d8                	mov    %ebx,%eax
+  80195c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80195f:	5b                   	pop    %ebx
+  801960:	5e                   	pop    %esi
+  801961:	5f                   	pop    %edi
+  801962:	5d                   	pop    %ebp
+  801963:	c3                   	ret
+
+00801964 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801964:	55                   	push   %ebp
+  801965:	89 e5                	mov    %esp,%ebp
+  801967:	56                   	push   %esi
+  801968:	53                   	push   %ebx
+  801969:	83 ec 18             	sub    $0x18,%esp
+  80196c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80196f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801972:	50                   	push   %eax
+  801973:	53                   	push   %ebx
+  801974:	e8 b7 fc ff ff       	call   801630 <fd_lookup>
+  801979:	83 c4 10             	add    $0x10,%esp
+  80197c:	85 c0                	test   %eax,%eax
+  80197e:	78 37                	js     8019b7 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801980:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801983:	83 ec 08             	sub    $0x8,%esp
+  801986:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801989:	50                   	push   %eax
+  80198a:	ff 36                	push   (%esi)
+  80198c:	e8 ef fc ff ff       	call   801680 <dev_lookup>
+  801991:	83 c4 10             	add    $0x10,%esp
+  801994:	85 c0                	test   %eax,%eax
+  801996:	78 1f                	js     8019b7 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801998:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80199c:	74 20                	je     8019be <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80199e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019a1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019a4:	85 c0                	test   %eax,%eax
+  8019a6:	74 37                	je     8019df <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8019a8:	83 ec 04             	sub    $0x4,%esp
+  8019ab:	ff 75 10             	push   0x10(%ebp)
+  8019ae:	ff 75 0c             	push   0xc(%ebp)
+  8019b1:	56                   	push   %esi
+  8019b2:	ff d0                	call   *%eax
+  8019b4:	83 c4 10             	add    $0x10,%esp
+}
+  8019b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ba:	5b                   	pop    %ebx
+  8019bb:	5e                   	pop    %esi
+  8019bc:	5d                   	pop    %ebp
+  8019bd:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019be:	a1 ac 60 80 00       	mov    0x8060ac,%eax
+  8019c3:	8b 40 48             	mov    0x48(%eax),%eax
+  8019c6:	83 ec 04             	sub    $0x4,%esp
+  8019c9:	53                   	push   %ebx
+  8019ca:	50                   	push   %eax
+  8019cb:	68 6d 42 80 00       	push   $0x80426d
+  8019d0:	e8 4a ed ff ff       	call   80071f <cprintf>
+		return -E_INVAL;
+  8019d5:	83 c4 10             	add    $0x10,%esp
+  8019d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019dd:	eb d8                	jmp    8019b7 <write+0x53>
+		return -E_NOT_SUPP;
+  8019df:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019e4:	eb d1                	jmp    8019b7 <write+0x53>
+
+008019e6 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8019e6:	55                   	push   %ebp
+  8019e7:	89 e5                	mov    %esp,%ebp
+  8019e9:	53                   	push   %ebx
+  8019ea:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019ed:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019f0:	50                   	push   %eax
+  8019f1:	ff 75 08             	push   0x8(%ebp)
+  8019f4:	e8 37 fc ff ff       	call   801630 <fd_lookup>
+  8019f9:	83 c4 10             	add    $0x10,%esp
+  8019fc:	85 c0                	test   %eax,%eax
+  8019fe:	78 3a                	js     801a3a <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a00:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801a03:	83 ec 08             	sub    $0x8,%esp
+  801a06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a09:	50                   	push   %eax
+  801a0a:	ff 33                	push   (%ebx)
+  801a0c:	e8 6f fc ff ff       	call   801680 <dev_lookup>
+  801a11:	83 c4 10             	add    $0x10,%esp
+  801a14:	85 c0                	test   %eax,%eax
+  801a16:	78 22                	js     801a3a <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801a18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a1b:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801a1e:	85 c0                	test   %eax,%eax
+  801a20:	74 0d                	je     801a2f <seek+0x49>
+  801a22:	83 ec 0c             	sub    $0xc,%esp
+  801a25:	53                   	push   %ebx
+  801a26:	ff d0                	call   *%eax
+  801a28:	83 c4 10             	add    $0x10,%esp
+  801a2b:	85 c0                	test   %eax,%eax
+  801a2d:	78 0b                	js     801a3a <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801a2f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a32:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801a35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a3d:	c9                   	leave
+  801a3e:	c3                   	ret
+
+00801a3f <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801a3f:	55                   	push   %ebp
+  801a40:	89 e5                	mov    %esp,%ebp
+  801a42:	53                   	push   %ebx
+  801a43:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a46:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a49:	50                   	push   %eax
+  801a4a:	ff 75 08             	push   0x8(%ebp)
+  801a4d:	e8 de fb ff ff       	call   801630 <fd_lookup>
+  801a52:	83 c4 10             	add    $0x10,%esp
+  801a55:	85 c0                	test   %eax,%eax
+  801a57:	78 2b                	js     801a84 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a59:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801a5c:	83 ec 08             	sub    $0x8,%esp
+  801a5f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a62:	50                   	push   %eax
+  801a63:	ff 33                	push   (%ebx)
+  801a65:	e8 16 fc ff ff       	call   801680 <dev_lookup>
+  801a6a:	83 c4 10             	add    $0x10,%esp
+  801a6d:	85 c0                	test   %eax,%eax
+  801a6f:	78 13                	js     801a84 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801a71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a74:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801a77:	85 c0                	test   %eax,%eax
+  801a79:	74 0e                	je     801a89 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801a7b:	83 ec 0c             	sub    $0xc,%esp
+  801a7e:	53                   	push   %ebx
+  801a7f:	ff d0                	call   *%eax
+  801a81:	83 c4 10             	add    $0x10,%esp
+}
+  801a84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a87:	c9                   	leave
+  801a88:	c3                   	ret
+		return 0;
+  801a89:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a8e:	eb f4                	jmp    801a84 <fsync+0x45>
+
+00801a90 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801a90:	55                   	push   %ebp
+  801a91:	89 e5                	mov    %esp,%ebp
+  801a93:	56                   	push   %esi
+  801a94:	53                   	push   %ebx
+  801a95:	83 ec 18             	sub    $0x18,%esp
+  801a98:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a9b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a9e:	50                   	push   %eax
+  801a9f:	53                   	push   %ebx
+  801aa0:	e8 8b fb ff ff       	call   801630 <fd_lookup>
+  801aa5:	83 c4 10             	add    $0x10,%esp
+  801aa8:	85 c0                	test   %eax,%eax
+  801aaa:	78 34                	js     801ae0 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801aac:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801aaf:	83 ec 08             	sub    $0x8,%esp
+  801ab2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ab5:	50                   	push   %eax
+  801ab6:	ff 36                	push   (%esi)
+  801ab8:	e8 c3 fb ff ff       	call   801680 <dev_lookup>
+  801abd:	83 c4 10             	add    $0x10,%esp
+  801ac0:	85 c0                	test   %eax,%eax
+  801ac2:	78 1c                	js     801ae0 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ac4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ac8:	74 1d                	je     801ae7 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801aca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801acd:	8b 40 18             	mov    0x18(%eax),%eax
+  801ad0:	85 c0                	test   %eax,%eax
+  801ad2:	74 34                	je     801b08 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801ad4:	83 ec 08             	sub    $0x8,%esp
+  801ad7:	ff 75 0c             	push   0xc(%ebp)
+  801ada:	56                   	push   %esi
+  801adb:	ff d0                	call   *%eax
+  801add:	83 c4 10             	add    $0x10,%esp
+}
+  801ae0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae3:	5b                   	pop    %ebx
+  801ae4:	5e                   	pop    %esi
+  801ae5:	5d                   	pop    %ebp
+  801ae6:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801ae7:	a1 ac 60 80 00       	mov    0x8060ac,%eax
+  801aec:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801aef:	83 ec 04             	sub    $0x4,%esp
+  801af2:	53                   	push   %ebx
+  801af3:	50                   	push   %eax
+  801af4:	68 30 42 80 00       	push   $0x804230
+  801af9:	e8 21 ec ff ff       	call   80071f <cprintf>
+		return -E_INVAL;
+  801afe:	83 c4 10             	add    $0x10,%esp
+  801b01:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b06:	eb d8                	jmp    801ae0 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801b08:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b0d:	eb d1                	jmp    801ae0 <ftruncate+0x50>
+
+00801b0f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801b0f:	55                   	push   %ebp
+  801b10:	89 e5                	mov    %esp,%ebp
+  801b12:	56                   	push   %esi
+  801b13:	53                   	push   %ebx
+  801b14:	83 ec 18             	sub    $0x18,%esp
+  801b17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b1a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b1d:	50                   	push   %eax
+  801b1e:	ff 75 08             	push   0x8(%ebp)
+  801b21:	e8 0a fb ff ff       	call   801630 <fd_lookup>
+  801b26:	83 c4 10             	add    $0x10,%esp
+  801b29:	85 c0                	test   %eax,%eax
+  801b2b:	78 49                	js     801b76 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b2d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b30:	83 ec 08             	sub    $0x8,%esp
+  801b33:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b36:	50                   	push   %eax
+  801b37:	ff 36                	push   (%esi)
+  801b39:	e8 42 fb ff ff       	call   801680 <dev_lookup>
+  801b3e:	83 c4 10             	add    $0x10,%esp
+  801b41:	85 c0                	test   %eax,%eax
+  801b43:	78 31                	js     801b76 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801b45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b48:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b4c:	74 2f                	je     801b7d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801b4e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801b51:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b58:	00 00 00 
+	stat->st_isdir = 0;
+  801b5b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b62:	00 00 00 
+	stat->st_dev = dev;
+  801b65:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801b6b:	83 ec 08             	sub    $0x8,%esp
+  801b6e:	53                   	push   %ebx
+  801b6f:	56                   	push   %esi
+  801b70:	ff 50 14             	call   *0x14(%eax)
+  801b73:	83 c4 10             	add    $0x10,%esp
+}
+  801b76:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b79:	5b                   	pop    %ebx
+  801b7a:	5e                   	pop    %esi
+  801b7b:	5d                   	pop    %ebp
+  801b7c:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b7d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b82:	eb f2                	jmp    801b76 <fstat+0x67>
+
+00801b84 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801b84:	55                   	push   %ebp
+  801b85:	89 e5                	mov    %esp,%ebp
+  801b87:	56                   	push   %esi
+  801b88:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801b89:	83 ec 08             	sub    $0x8,%esp
+  801b8c:	68 00 10 00 00       	push   $0x1000
+  801b91:	ff 75 08             	push   0x8(%ebp)
+  801b94:	e8 b3 07 00 00       	call   80234c <open>
+  801b99:	89 c3                	mov    %eax,%ebx
+  801b9b:	83 c4 10             	add    $0x10,%esp
+  801b9e:	85 c0                	test   %eax,%eax
+  801ba0:	78 1b                	js     801bbd <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801ba2:	83 ec 08             	sub    $0x8,%esp
+  801ba5:	ff 75 0c             	push   0xc(%ebp)
+  801ba8:	50                   	push   %eax
+  801ba9:	e8 61 ff ff ff       	call   801b0f <fstat>
+  801bae:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801bb0:	89 1c 24             	mov    %ebx,(%esp)
+  801bb3:	e8 a2 fb ff ff       	call   80175a <close>
+	return r;
+  801bb8:	83 c4 10             	add    $0x10,%esp
+  801bbb:	89 f3                	mov    %esi,%ebx
+}
+  801bbd:	89 d8                	mov    %ebx,%eax
+  801bbf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bc2:	5b                   	pop    %ebx
+  801bc3:	5e                   	pop    %esi
+  801bc4:	5d                   	pop    %ebp
+  801bc5:	c3                   	ret
+
+00801bc6 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801bc6:	55                   	push   %ebp
+  801bc7:	89 e5                	mov    %esp,%ebp
+  801bc9:	57                   	push   %edi
+  801bca:	56                   	push   %esi
+  801bcb:	53                   	push   %ebx
+  801bcc:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801bd2:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801bd8:	89 d6                	mov    %edx,%esi
+  801bda:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801be0:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801be3:	89 d3                	mov    %edx,%ebx
+  801be5:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801beb:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801bf2:	74 1d                	je     801c11 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801bf4:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801bf9:	83 c8 07             	or     $0x7,%eax
+  801bfc:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801c02:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801c07:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801c0d:	01 ce                	add    %ecx,%esi
+  801c0f:	eb 28                	jmp    801c39 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c11:	83 ec 0c             	sub    $0xc,%esp
+  801c14:	6a 01                	push   $0x1
+  801c16:	e8 0c 1e 00 00       	call   803a27 <ipc_find_env>
+  801c1b:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801c20:	83 c4 10             	add    $0x10,%esp
+  801c23:	eb cf                	jmp    801bf4 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801c25:	83 c0 01             	add    $0x1,%eax
+  801c28:	89 fa                	mov    %edi,%edx
+  801c2a:	09 da                	or     %ebx,%edx
+  801c2c:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801c33:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c39:	39 f3                	cmp    %esi,%ebx
+  801c3b:	72 e8                	jb     801c25 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801c3d:	83 f8 41             	cmp    $0x41,%eax
+  801c40:	77 2f                	ja     801c71 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801c42:	50                   	push   %eax
+  801c43:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801c49:	50                   	push   %eax
+  801c4a:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801c50:	ff 35 c8 80 80 00    	push   0x8080c8
+  801c56:	e8 7e 1d 00 00       	call   8039d9 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801c5b:	83 c4 0c             	add    $0xc,%esp
+  801c5e:	6a 00                	push   $0x0
+  801c60:	6a 00                	push   $0x0
+  801c62:	6a 00                	push   $0x0
+  801c64:	e8 1a 1c 00 00       	call   803883 <ipc_recv>
+}
+  801c69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c6c:	5b                   	pop    %ebx
+  801c6d:	5e                   	pop    %esi
+  801c6e:	5f                   	pop    %edi
+  801c6f:	5d                   	pop    %ebp
+  801c70:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801c71:	68 a0 42 80 00       	push   $0x8042a0
+  801c76:	68 ec 41 80 00       	push   $0x8041ec
+  801c7b:	6a 40                	push   $0x40
+  801c7d:	68 bc 42 80 00       	push   $0x8042bc
+  801c82:	e8 bd e9 ff ff       	call   800644 <_panic>
+
+00801c87 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801c87:	55                   	push   %ebp
+  801c88:	89 e5                	mov    %esp,%ebp
+  801c8a:	57                   	push   %edi
+  801c8b:	56                   	push   %esi
+  801c8c:	53                   	push   %ebx
+  801c8d:	83 ec 1c             	sub    $0x1c,%esp
+  801c90:	89 c3                	mov    %eax,%ebx
+  801c92:	89 d6                	mov    %edx,%esi
+  801c94:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801c97:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801c9d:	89 ca                	mov    %ecx,%edx
+  801c9f:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801ca2:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801ca9:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801cac:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801cb3:	8b 76 0c             	mov    0xc(%esi),%esi
+  801cb6:	89 fb                	mov    %edi,%ebx
+  801cb8:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801cbf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801cc2:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801cc9:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ccc:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801cd3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cd6:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801cdd:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801ce0:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801ce7:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801cec:	39 c8                	cmp    %ecx,%eax
+  801cee:	74 0d                	je     801cfd <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf8:	5b                   	pop    %ebx
+  801cf9:	5e                   	pop    %esi
+  801cfa:	5f                   	pop    %edi
+  801cfb:	5d                   	pop    %ebp
+  801cfc:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801cfd:	6a 07                	push   $0x7
+  801cff:	68 00 70 80 00       	push   $0x807000
+  801d04:	6a 0d                	push   $0xd
+  801d06:	ff 35 c8 80 80 00    	push   0x8080c8
+  801d0c:	e8 dd 1b 00 00       	call   8038ee <ipc_send>
+  801d11:	83 c4 10             	add    $0x10,%esp
+  801d14:	eb da                	jmp    801cf0 <fsring_post+0x69>
+
+00801d16 <fsipcv>:
+{
+  801d16:	55                   	push   %ebp
+  801d17:	89 e5                	mov    %esp,%ebp
+  801d19:	57                   	push   %edi
+  801d1a:	56                   	push   %esi
+  801d1b:	53                   	push   %ebx
+  801d1c:	83 ec 0c             	sub    $0xc,%esp
+  801d1f:	89 c7                	mov    %eax,%edi
+  801d21:	89 d3                	mov    %edx,%ebx
+  801d23:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801d25:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801d2c:	74 26                	je     801d54 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801d2e:	6a 07                	push   $0x7
+  801d30:	68 00 70 80 00       	push   $0x807000
+  801d35:	57                   	push   %edi
+  801d36:	ff 35 c8 80 80 00    	push   0x8080c8
+  801d3c:	e8 ad 1b 00 00       	call   8038ee <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801d41:	6a 00                	push   $0x0
+  801d43:	56                   	push   %esi
+  801d44:	53                   	push   %ebx
+  801d45:	6a 00                	push   $0x0
+  801d47:	e8 fa 1b 00 00       	call   803946 <ipc_recvv>
+}
+  801d4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d4f:	5b                   	pop    %ebx
+  801d50:	5e                   	pop    %esi
+  801d51:	5f                   	pop    %edi
+  801d52:	5d                   	pop    %ebp
+  801d53:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d54:	83 ec 0c             	sub    $0xc,%esp
+  801d57:	6a 01                	push   $0x1
+  801d59:	e8 c9 1c 00 00       	call   803a27 <ipc_find_env>
+  801d5e:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801d63:	83 c4 10             	add    $0x10,%esp
+  801d66:	eb c6                	jmp    801d2e <fsipcv+0x18>
+
+00801d68 <fsipc>:
+{
+  801d68:	55                   	push   %ebp
+  801d69:	89 e5                	mov    %esp,%ebp
+  801d6b:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801d6e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801d75:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801d78:	e8 99 ff ff ff       	call   801d16 <fsipcv>
+}
+  801d7d:	c9                   	leave
+  801d7e:	c3                   	ret
+
+00801d7f <file_write_direct>:
+{
+  801d7f:	55                   	push   %ebp
+  801d80:	89 e5                	mov    %esp,%ebp
+  801d82:	56                   	push   %esi
+  801d83:	53                   	push   %ebx
+  801d84:	89 c3                	mov    %eax,%ebx
+  801d86:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801d88:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801d8e:	77 40                	ja     801dd0 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801d90:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801d95:	39 c8                	cmp    %ecx,%eax
+  801d97:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d9a:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801d9d:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  801da3:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801da8:	83 ec 04             	sub    $0x4,%esp
+  801dab:	50                   	push   %eax
+  801dac:	52                   	push   %edx
+  801dad:	68 08 70 80 00       	push   $0x807008
+  801db2:	e8 dc f0 ff ff       	call   800e93 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801db7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dbc:	b8 04 00 00 00       	mov    $0x4,%eax
+  801dc1:	e8 a2 ff ff ff       	call   801d68 <fsipc>
+  801dc6:	83 c4 10             	add    $0x10,%esp
+}
+  801dc9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dcc:	5b                   	pop    %ebx
+  801dcd:	5e                   	pop    %esi
+  801dce:	5d                   	pop    %ebp
+  801dcf:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801dd0:	89 d6                	mov    %edx,%esi
+  801dd2:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801dd8:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801ddd:	29 f1                	sub    %esi,%ecx
+  801ddf:	39 c1                	cmp    %eax,%ecx
+  801de1:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801de4:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801de7:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801dec:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801df2:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801df8:	83 ec 0c             	sub    $0xc,%esp
+  801dfb:	6a 05                	push   $0x5
+  801dfd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e02:	e8 bf fd ff ff       	call   801bc6 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801e07:	83 c4 10             	add    $0x10,%esp
+  801e0a:	eb bd                	jmp    801dc9 <file_write_direct+0x4a>
+
+00801e0c <devfile_sync>:
+{
+  801e0c:	55                   	push   %ebp
+  801e0d:	89 e5                	mov    %esp,%ebp
+  801e0f:	57                   	push   %edi
+  801e10:	56                   	push   %esi
+  801e11:	53                   	push   %ebx
+  801e12:	83 ec 28             	sub    $0x28,%esp
+  801e15:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801e18:	56                   	push   %esi
+  801e19:	e8 a5 f7 ff ff       	call   8015c3 <fd2data>
+  801e1e:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801e20:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801e23:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801e2a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801e32:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801e36:	74 45                	je     801e7d <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801e38:	8b 46 14             	mov    0x14(%esi),%eax
+  801e3b:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e48:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801e4b:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801e4e:	39 cb                	cmp    %ecx,%ebx
+  801e50:	73 14                	jae    801e66 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801e52:	29 d9                	sub    %ebx,%ecx
+  801e54:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801e57:	89 f0                	mov    %esi,%eax
+  801e59:	e8 21 ff ff ff       	call   801d7f <file_write_direct>
+  801e5e:	85 c0                	test   %eax,%eax
+  801e60:	7e 04                	jle    801e66 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801e62:	01 c3                	add    %eax,%ebx
+  801e64:	eb e5                	jmp    801e4b <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801e66:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e69:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801e70:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801e73:	85 c0                	test   %eax,%eax
+  801e75:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e7a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801e7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e80:	5b                   	pop    %ebx
+  801e81:	5e                   	pop    %esi
+  801e82:	5f                   	pop    %edi
+  801e83:	5d                   	pop    %ebp
+  801e84:	c3                   	ret
+
+00801e85 <devfile_write>:
+{
+  801e85:	55                   	push   %ebp
+  801e86:	89 e5                	mov    %esp,%ebp
+  801e88:	57                   	push   %edi
+  801e89:	56                   	push   %esi
+  801e8a:	53                   	push   %ebx
+  801e8b:	83 ec 28             	sub    $0x28,%esp
+  801e8e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e91:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801e94:	53                   	push   %ebx
+  801e95:	e8 29 f7 ff ff       	call   8015c3 <fd2data>
+  801e9a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801e9d:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801ea0:	83 c4 10             	add    $0x10,%esp
+  801ea3:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801ea7:	74 43                	je     801eec <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801ea9:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801eb0:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801eb3:	85 c0                	test   %eax,%eax
+  801eb5:	74 43                	je     801efa <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801eb7:	89 c2                	mov    %eax,%edx
+  801eb9:	03 53 14             	add    0x14(%ebx),%edx
+  801ebc:	39 fa                	cmp    %edi,%edx
+  801ebe:	75 0b                	jne    801ecb <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801ec0:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801ec3:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801ec9:	76 66                	jbe    801f31 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801ecb:	83 ec 0c             	sub    $0xc,%esp
+  801ece:	53                   	push   %ebx
+  801ecf:	e8 38 ff ff ff       	call   801e0c <devfile_sync>
+  801ed4:	83 c4 10             	add    $0x10,%esp
+  801ed7:	85 c0                	test   %eax,%eax
+  801ed9:	78 4e                	js     801f29 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801edb:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801ee1:	77 56                	ja     801f39 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801ee3:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801ee6:	85 c0                	test   %eax,%eax
+  801ee8:	75 20                	jne    801f0a <devfile_write+0x85>
+  801eea:	eb 16                	jmp    801f02 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801eec:	89 f1                	mov    %esi,%ecx
+  801eee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ef1:	89 d8                	mov    %ebx,%eax
+  801ef3:	e8 87 fe ff ff       	call   801d7f <file_write_direct>
+  801ef8:	eb 2f                	jmp    801f29 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801efa:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801f00:	77 37                	ja     801f39 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801f02:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801f05:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801f0a:	83 ec 04             	sub    $0x4,%esp
+  801f0d:	56                   	push   %esi
+  801f0e:	ff 75 0c             	push   0xc(%ebp)
+  801f11:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801f14:	01 c1                	add    %eax,%ecx
+  801f16:	51                   	push   %ecx
+  801f17:	e8 77 ef ff ff       	call   800e93 <memmove>
+	ff->buf_wlen += n;
+  801f1c:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801f1f:	01 f7                	add    %esi,%edi
+  801f21:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801f24:	89 f0                	mov    %esi,%eax
+  801f26:	83 c4 10             	add    $0x10,%esp
+}
+  801f29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f2c:	5b                   	pop    %ebx
+  801f2d:	5e                   	pop    %esi
+  801f2e:	5f                   	pop    %edi
+  801f2f:	5d                   	pop    %ebp
+  801f30:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801f31:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801f37:	76 d1                	jbe    801f0a <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801f39:	89 f1                	mov    %esi,%ecx
+  801f3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f3e:	89 d8                	mov    %ebx,%eax
+  801f40:	e8 3a fe ff ff       	call   801d7f <file_write_direct>
+  801f45:	eb e2                	jmp    801f29 <devfile_write+0xa4>
+
+00801f47 <devfile_trunc>:
+{
+  801f47:	55                   	push   %ebp
+  801f48:	89 e5                	mov    %esp,%ebp
+  801f4a:	53                   	push   %ebx
+  801f4b:	83 ec 10             	sub    $0x10,%esp
+  801f4e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801f51:	53                   	push   %ebx
+  801f52:	e8 b5 fe ff ff       	call   801e0c <devfile_sync>
+  801f57:	83 c4 10             	add    $0x10,%esp
+  801f5a:	85 c0                	test   %eax,%eax
+  801f5c:	78 1f                	js     801f7d <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f5e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801f61:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801f66:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f69:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801f6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f73:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f78:	e8 eb fd ff ff       	call   801d68 <fsipc>
+}
+  801f7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f80:	c9                   	leave
+  801f81:	c3                   	ret
+
+00801f82 <devfile_stat>:
+{
+  801f82:	55                   	push   %ebp
+  801f83:	89 e5                	mov    %esp,%ebp
+  801f85:	56                   	push   %esi
+  801f86:	53                   	push   %ebx
+  801f87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f8a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801f8d:	83 ec 0c             	sub    $0xc,%esp
+  801f90:	53                   	push   %ebx
+  801f91:	e8 76 fe ff ff       	call   801e0c <devfile_sync>
+  801f96:	83 c4 10             	add    $0x10,%esp
+  801f99:	85 c0                	test   %eax,%eax
+  801f9b:	78 47                	js     801fe4 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f9d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801fa0:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801fa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801faa:	b8 05 00 00 00       	mov    $0x5,%eax
+  801faf:	e8 b4 fd ff ff       	call   801d68 <fsipc>
+  801fb4:	85 c0                	test   %eax,%eax
+  801fb6:	78 2c                	js     801fe4 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801fb8:	83 ec 08             	sub    $0x8,%esp
+  801fbb:	68 00 70 80 00       	push   $0x807000
+  801fc0:	56                   	push   %esi
+  801fc1:	e8 47 ed ff ff       	call   800d0d <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801fc6:	a1 80 70 80 00       	mov    0x807080,%eax
+  801fcb:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801fd1:	a1 84 70 80 00       	mov    0x807084,%eax
+  801fd6:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801fdc:	83 c4 10             	add    $0x10,%esp
+  801fdf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fe4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe7:	5b                   	pop    %ebx
+  801fe8:	5e                   	pop    %esi
+  801fe9:	5d                   	pop    %ebp
+  801fea:	c3                   	ret
+
+00801feb <devfile_flush>:
+{
+  801feb:	55                   	push   %ebp
+  801fec:	89 e5                	mov    %esp,%ebp
+  801fee:	56                   	push   %esi
+  801fef:	53                   	push   %ebx
+  801ff0:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801ff3:	83 ec 0c             	sub    $0xc,%esp
+  801ff6:	56                   	push   %esi
+  801ff7:	e8 10 fe ff ff       	call   801e0c <devfile_sync>
+  801ffc:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801ffe:	83 c4 10             	add    $0x10,%esp
+  802001:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  802005:	75 25                	jne    80202c <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802007:	8b 46 0c             	mov    0xc(%esi),%eax
+  80200a:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  80200f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802014:	b8 06 00 00 00       	mov    $0x6,%eax
+  802019:	e8 4a fd ff ff       	call   801d68 <fsipc>
+  80201e:	85 c0                	test   %eax,%eax
+  802020:	0f 45 d8             	cmovne %eax,%ebx
+}
+  802023:	89 d8                	mov    %ebx,%eax
+  802025:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802028:	5b                   	pop    %ebx
+  802029:	5e                   	pop    %esi
+  80202a:	5d                   	pop    %ebp
+  80202b:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  80202c:	83 ec 0c             	sub    $0xc,%esp
+  80202f:	56                   	push   %esi
+  802030:	e8 8e f5 ff ff       	call   8015c3 <fd2data>
+  802035:	83 c4 08             	add    $0x8,%esp
+  802038:	50                   	push   %eax
+  802039:	6a 00                	push   $0x0
+  80203b:	e8 66 f1 ff ff       	call   8011a6 <sys_page_unmap>
+  802040:	83 c4 10             	add    $0x10,%esp
+  802043:	eb c2                	jmp    802007 <devfile_flush+0x1c>
+
+00802045 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  802045:	55                   	push   %ebp
+  802046:	89 e5                	mov    %esp,%ebp
+  802048:	57                   	push   %edi
+  802049:	56                   	push   %esi
+  80204a:	53                   	push   %ebx
+  80204b:	83 ec 64             	sub    $0x64,%esp
+  80204e:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  802050:	52                   	push   %edx
+  802051:	50                   	push   %eax
+  802052:	e8 d9 f5 ff ff       	call   801630 <fd_lookup>
+  802057:	89 c1                	mov    %eax,%ecx
+  802059:	83 c4 10             	add    $0x10,%esp
+  80205c:	85 c0                	test   %eax,%eax
+  80205e:	0f 88 f2 00 00 00    	js     802156 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  802064:	8b 07                	mov    (%edi),%eax
+  802066:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  80206c:	39 10                	cmp    %edx,(%eax)
+  80206e:	0f 85 03 01 00 00    	jne    802177 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  802074:	a1 ac 60 80 00       	mov    0x8060ac,%eax
+  802079:	8b 40 48             	mov    0x48(%eax),%eax
+  80207c:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  802082:	0f 84 96 00 00 00    	je     80211e <fsring_slot+0xd9>
+	if (fsenv == 0)
+  802088:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  80208f:	0f 84 cb 00 00 00    	je     802160 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  802095:	b8 00 70 80 00       	mov    $0x807000,%eax
+  80209a:	83 c8 07             	or     $0x7,%eax
+  80209d:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8020a0:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8020a3:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  8020a8:	83 ec 04             	sub    $0x4,%esp
+  8020ab:	68 07 04 00 00       	push   $0x407
+  8020b0:	53                   	push   %ebx
+  8020b1:	6a 00                	push   $0x0
+  8020b3:	e8 61 f0 ff ff       	call   801119 <sys_page_alloc>
+  8020b8:	89 c1                	mov    %eax,%ecx
+  8020ba:	83 c4 10             	add    $0x10,%esp
+  8020bd:	85 c0                	test   %eax,%eax
+  8020bf:	0f 88 91 00 00 00    	js     802156 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  8020c5:	89 d8                	mov    %ebx,%eax
+  8020c7:	83 c8 07             	or     $0x7,%eax
+  8020ca:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8020cc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8020d2:	83 c6 04             	add    $0x4,%esi
+  8020d5:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8020db:	75 cb                	jne    8020a8 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8020dd:	6a 12                	push   $0x12
+  8020df:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8020e2:	50                   	push   %eax
+  8020e3:	6a 0c                	push   $0xc
+  8020e5:	ff 35 c8 80 80 00    	push   0x8080c8
+  8020eb:	e8 e9 18 00 00       	call   8039d9 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8020f0:	83 c4 0c             	add    $0xc,%esp
+  8020f3:	6a 00                	push   $0x0
+  8020f5:	6a 00                	push   $0x0
+  8020f7:	6a 00                	push   $0x0
+  8020f9:	e8 85 17 00 00       	call   803883 <ipc_recv>
+  8020fe:	89 c1                	mov    %eax,%ecx
+  802100:	83 c4 10             	add    $0x10,%esp
+  802103:	85 c0                	test   %eax,%eax
+  802105:	78 4f                	js     802156 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  802107:	a1 ac 60 80 00       	mov    0x8060ac,%eax
+  80210c:	8b 40 48             	mov    0x48(%eax),%eax
+  80210f:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  802114:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  80211b:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  80211e:	83 ec 0c             	sub    $0xc,%esp
+  802121:	ff 37                	push   (%edi)
+  802123:	e8 e4 fc ff ff       	call   801e0c <devfile_sync>
+  802128:	89 c1                	mov    %eax,%ecx
+  80212a:	83 c4 10             	add    $0x10,%esp
+  80212d:	85 c0                	test   %eax,%eax
+  80212f:	78 25                	js     802156 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  802131:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802137:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  80213c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802141:	89 d0                	mov    %edx,%eax
+  802143:	d3 e0                	shl    %cl,%eax
+  802145:	85 d8                	test   %ebx,%eax
+  802147:	74 0d                	je     802156 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802149:	83 c1 01             	add    $0x1,%ecx
+  80214c:	83 f9 10             	cmp    $0x10,%ecx
+  80214f:	75 f0                	jne    802141 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  802151:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  802156:	89 c8                	mov    %ecx,%eax
+  802158:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80215b:	5b                   	pop    %ebx
+  80215c:	5e                   	pop    %esi
+  80215d:	5f                   	pop    %edi
+  80215e:	5d                   	pop    %ebp
+  80215f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802160:	83 ec 0c             	sub    $0xc,%esp
+  802163:	6a 01                	push   $0x1
+  802165:	e8 bd 18 00 00       	call   803a27 <ipc_find_env>
+  80216a:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  80216f:	83 c4 10             	add    $0x10,%esp
+  802172:	e9 1e ff ff ff       	jmp    802095 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  802177:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  80217c:	eb d8                	jmp    802156 <fsring_slot+0x111>
+
+0080217e <file_read_direct>:
+{
+  80217e:	55                   	push   %ebp
+  80217f:	89 e5                	mov    %esp,%ebp
+  802181:	57                   	push   %edi
+  802182:	56                   	push   %esi
+  802183:	53                   	push   %ebx
+  802184:	83 ec 1c             	sub    $0x1c,%esp
+  802187:	89 c7                	mov    %eax,%edi
+  802189:	89 d6                	mov    %edx,%esi
+  80218b:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  80218d:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  802193:	77 52                	ja     8021e7 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802195:	8b 40 0c             	mov    0xc(%eax),%eax
+  802198:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  80219d:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8021a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021ad:	e8 b6 fb ff ff       	call   801d68 <fsipc>
+  8021b2:	89 c7                	mov    %eax,%edi
+  8021b4:	85 c0                	test   %eax,%eax
+  8021b6:	78 25                	js     8021dd <file_read_direct+0x5f>
+	assert(r <= n);
+  8021b8:	39 c3                	cmp    %eax,%ebx
+  8021ba:	0f 82 87 00 00 00    	jb     802247 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  8021c0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8021c5:	0f 8f 95 00 00 00    	jg     802260 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8021cb:	83 ec 04             	sub    $0x4,%esp
+  8021ce:	50                   	push   %eax
+  8021cf:	68 00 70 80 00       	push   $0x807000
+  8021d4:	56                   	push   %esi
+  8021d5:	e8 b9 ec ff ff       	call   800e93 <memmove>
+	return r;
+  8021da:	83 c4 10             	add    $0x10,%esp
+}
+  8021dd:	89 f8                	mov    %edi,%eax
+  8021df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021e2:	5b                   	pop    %ebx
+  8021e3:	5e                   	pop    %esi
+  8021e4:	5f                   	pop    %edi
+  8021e5:	5d                   	pop    %ebp
+  8021e6:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8021e7:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8021ed:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8021f2:	29 d1                	sub    %edx,%ecx
+  8021f4:	39 d9                	cmp    %ebx,%ecx
+  8021f6:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8021f9:	89 f0                	mov    %esi,%eax
+  8021fb:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8021fe:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802201:	eb 0f                	jmp    802212 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  802203:	0f b6 10             	movzbl (%eax),%edx
+  802206:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802208:	05 00 10 00 00       	add    $0x1000,%eax
+  80220d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802212:	39 c8                	cmp    %ecx,%eax
+  802214:	72 ed                	jb     802203 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802216:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802219:	8b 47 0c             	mov    0xc(%edi),%eax
+  80221c:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  802221:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802227:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  80222d:	83 ec 0c             	sub    $0xc,%esp
+  802230:	6a 07                	push   $0x7
+  802232:	89 d9                	mov    %ebx,%ecx
+  802234:	89 f2                	mov    %esi,%edx
+  802236:	b8 09 00 00 00       	mov    $0x9,%eax
+  80223b:	e8 86 f9 ff ff       	call   801bc6 <fsipc_pages>
+  802240:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  802242:	83 c4 10             	add    $0x10,%esp
+  802245:	eb 96                	jmp    8021dd <file_read_direct+0x5f>
+	assert(r <= n);
+  802247:	68 c7 42 80 00       	push   $0x8042c7
+  80224c:	68 ec 41 80 00       	push   $0x8041ec
+  802251:	68 dc 00 00 00       	push   $0xdc
+  802256:	68 bc 42 80 00       	push   $0x8042bc
+  80225b:	e8 e4 e3 ff ff       	call   800644 <_panic>
+	assert(r <= PGSIZE);
+  802260:	68 d8 42 80 00       	push   $0x8042d8
+  802265:	68 ec 41 80 00       	push   $0x8041ec
+  80226a:	68 dd 00 00 00       	push   $0xdd
+  80226f:	68 bc 42 80 00       	push   $0x8042bc
+  802274:	e8 cb e3 ff ff       	call   800644 <_panic>
+
+00802279 <devfile_read>:
+{
+  802279:	55                   	push   %ebp
+  80227a:	89 e5                	mov    %esp,%ebp
+  80227c:	57                   	push   %edi
+  80227d:	56                   	push   %esi
+  80227e:	53                   	push   %ebx
+  80227f:	83 ec 28             	sub    $0x28,%esp
+  802282:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802285:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  802288:	53                   	push   %ebx
+  802289:	e8 35 f3 ff ff       	call   8015c3 <fd2data>
+  80228e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  802291:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  802294:	83 c4 10             	add    $0x10,%esp
+  802297:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  80229b:	74 7d                	je     80231a <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80229d:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8022a1:	0f 85 81 00 00 00    	jne    802328 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  8022a7:	8b 43 18             	mov    0x18(%ebx),%eax
+  8022aa:	85 c0                	test   %eax,%eax
+  8022ac:	74 0d                	je     8022bb <devfile_read+0x42>
+  8022ae:	8b 53 14             	mov    0x14(%ebx),%edx
+  8022b1:	39 fa                	cmp    %edi,%edx
+  8022b3:	7f 06                	jg     8022bb <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8022b5:	01 c2                	add    %eax,%edx
+  8022b7:	39 d7                	cmp    %edx,%edi
+  8022b9:	72 28                	jb     8022e3 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8022bb:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8022c2:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8022c8:	77 74                	ja     80233e <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8022ca:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022cf:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8022d2:	89 d8                	mov    %ebx,%eax
+  8022d4:	e8 a5 fe ff ff       	call   80217e <file_read_direct>
+  8022d9:	85 c0                	test   %eax,%eax
+  8022db:	7e 35                	jle    802312 <devfile_read+0x99>
+		ff->buf_base = pos;
+  8022dd:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8022e0:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8022e3:	8b 53 14             	mov    0x14(%ebx),%edx
+  8022e6:	89 d0                	mov    %edx,%eax
+  8022e8:	03 43 18             	add    0x18(%ebx),%eax
+  8022eb:	29 f8                	sub    %edi,%eax
+  8022ed:	39 f0                	cmp    %esi,%eax
+  8022ef:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8022f2:	83 ec 04             	sub    $0x4,%esp
+  8022f5:	56                   	push   %esi
+  8022f6:	89 f8                	mov    %edi,%eax
+  8022f8:	29 d0                	sub    %edx,%eax
+  8022fa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8022fd:	01 c1                	add    %eax,%ecx
+  8022ff:	51                   	push   %ecx
+  802300:	ff 75 0c             	push   0xc(%ebp)
+  802303:	e8 8b eb ff ff       	call   800e93 <memmove>
+	fd->fd_offset = pos + n;
+  802308:	01 f7                	add    %esi,%edi
+  80230a:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80230d:	89 f0                	mov    %esi,%eax
+  80230f:	83 c4 10             	add    $0x10,%esp
+}
+  802312:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802315:	5b                   	pop    %ebx
+  802316:	5e                   	pop    %esi
+  802317:	5f                   	pop    %edi
+  802318:	5d                   	pop    %ebp
+  802319:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  80231a:	89 f1                	mov    %esi,%ecx
+  80231c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80231f:	89 d8                	mov    %ebx,%eax
+  802321:	e8 58 fe ff ff       	call   80217e <file_read_direct>
+  802326:	eb ea                	jmp    802312 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802328:	83 ec 0c             	sub    $0xc,%esp
+  80232b:	53                   	push   %ebx
+  80232c:	e8 db fa ff ff       	call   801e0c <devfile_sync>
+  802331:	83 c4 10             	add    $0x10,%esp
+  802334:	85 c0                	test   %eax,%eax
+  802336:	0f 89 6b ff ff ff    	jns    8022a7 <devfile_read+0x2e>
+  80233c:	eb d4                	jmp    802312 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  80233e:	89 f1                	mov    %esi,%ecx
+  802340:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802343:	89 d8                	mov    %ebx,%eax
+  802345:	e8 34 fe ff ff       	call   80217e <file_read_direct>
+  80234a:	eb c6                	jmp    802312 <devfile_read+0x99>
+
+0080234c <open>:
+{
+  80234c:	55                   	push   %ebp
+  80234d:	89 e5                	mov    %esp,%ebp
+  80234f:	56                   	push   %esi
+  802350:	53                   	push   %ebx
+  802351:	83 ec 1c             	sub    $0x1c,%esp
+  802354:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802357:	56                   	push   %esi
+  802358:	e8 75 e9 ff ff       	call   800cd2 <strlen>
+  80235d:	83 c4 10             	add    $0x10,%esp
+  802360:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802365:	0f 8f a0 00 00 00    	jg     80240b <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  80236b:	83 ec 0c             	sub    $0xc,%esp
+  80236e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802371:	50                   	push   %eax
+  802372:	e8 63 f2 ff ff       	call   8015da <fd_alloc>
+  802377:	89 c3                	mov    %eax,%ebx
+  802379:	83 c4 10             	add    $0x10,%esp
+  80237c:	85 c0                	test   %eax,%eax
+  80237e:	78 45                	js     8023c5 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  802380:	83 ec 08             	sub    $0x8,%esp
+  802383:	56                   	push   %esi
+  802384:	68 00 70 80 00       	push   $0x807000
+  802389:	e8 7f e9 ff ff       	call   800d0d <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80238e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802391:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802396:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802399:	b8 01 00 00 00       	mov    $0x1,%eax
+  80239e:	e8 c5 f9 ff ff       	call   801d68 <fsipc>
+  8023a3:	89 c3                	mov    %eax,%ebx
+  8023a5:	83 c4 10             	add    $0x10,%esp
+  8023a8:	85 c0                	test   %eax,%eax
+  8023aa:	78 22                	js     8023ce <open+0x82>
+	if (!(mode & O_NOBUF)
+  8023ac:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8023b3:	74 2b                	je     8023e0 <open+0x94>
+	return fd2num(fd);
+  8023b5:	83 ec 0c             	sub    $0xc,%esp
+  8023b8:	ff 75 f4             	push   -0xc(%ebp)
+  8023bb:	e8 f3 f1 ff ff       	call   8015b3 <fd2num>
+  8023c0:	89 c3                	mov    %eax,%ebx
+  8023c2:	83 c4 10             	add    $0x10,%esp
+}
+  8023c5:	89 d8                	mov    %ebx,%eax
+  8023c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023ca:	5b                   	pop    %ebx
+  8023cb:	5e                   	pop    %esi
+  8023cc:	5d                   	pop    %ebp
+  8023cd:	c3                   	ret
+		fd_close(fd, 0);
+  8023ce:	83 ec 08             	sub    $0x8,%esp
+  8023d1:	6a 00                	push   $0x0
+  8023d3:	ff 75 f4             	push   -0xc(%ebp)
+  8023d6:	e8 f8 f2 ff ff       	call   8016d3 <fd_close>
+		return r;
+  8023db:	83 c4 10             	add    $0x10,%esp
+  8023de:	eb e5                	jmp    8023c5 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8023e0:	83 ec 0c             	sub    $0xc,%esp
+  8023e3:	ff 75 f4             	push   -0xc(%ebp)
+  8023e6:	e8 d8 f1 ff ff       	call   8015c3 <fd2data>
+  8023eb:	83 c4 0c             	add    $0xc,%esp
+  8023ee:	68 07 04 00 00       	push   $0x407
+  8023f3:	50                   	push   %eax
+  8023f4:	6a 00                	push   $0x0
+  8023f6:	e8 1e ed ff ff       	call   801119 <sys_page_alloc>
+  8023fb:	83 c4 10             	add    $0x10,%esp
+  8023fe:	85 c0                	test   %eax,%eax
+  802400:	75 b3                	jne    8023b5 <open+0x69>
+		fd->fd_file.buffered = 1;
+  802402:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802405:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802409:	eb aa                	jmp    8023b5 <open+0x69>
+		return -E_BAD_PATH;
+  80240b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802410:	eb b3                	jmp    8023c5 <open+0x79>
+
+00802412 <readdir>:
+{
+  802412:	55                   	push   %ebp
+  802413:	89 e5                	mov    %esp,%ebp
+  802415:	53                   	push   %ebx
+  802416:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802419:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80241c:	50                   	push   %eax
+  80241d:	ff 75 08             	push   0x8(%ebp)
+  802420:	e8 0b f2 ff ff       	call   801630 <fd_lookup>
+  802425:	89 c3                	mov    %eax,%ebx
+  802427:	83 c4 10             	add    $0x10,%esp
+  80242a:	85 c0                	test   %eax,%eax
+  80242c:	78 73                	js     8024a1 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80242e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802431:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802437:	39 08                	cmp    %ecx,(%eax)
+  802439:	0f 85 82 00 00 00    	jne    8024c1 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  80243f:	83 ec 0c             	sub    $0xc,%esp
+  802442:	50                   	push   %eax
+  802443:	e8 c4 f9 ff ff       	call   801e0c <devfile_sync>
+  802448:	89 c3                	mov    %eax,%ebx
+  80244a:	83 c4 10             	add    $0x10,%esp
+  80244d:	85 c0                	test   %eax,%eax
+  80244f:	78 50                	js     8024a1 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802451:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802454:	8b 40 0c             	mov    0xc(%eax),%eax
+  802457:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  80245c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80245f:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  802464:	8b 45 14             	mov    0x14(%ebp),%eax
+  802467:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  80246c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802471:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802476:	e8 ed f8 ff ff       	call   801d68 <fsipc>
+  80247b:	89 c3                	mov    %eax,%ebx
+  80247d:	85 c0                	test   %eax,%eax
+  80247f:	7e 20                	jle    8024a1 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  802481:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802484:	72 22                	jb     8024a8 <readdir+0x96>
+  802486:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80248b:	7f 1b                	jg     8024a8 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80248d:	83 ec 04             	sub    $0x4,%esp
+  802490:	50                   	push   %eax
+  802491:	68 00 70 80 00       	push   $0x807000
+  802496:	ff 75 0c             	push   0xc(%ebp)
+  802499:	e8 f5 e9 ff ff       	call   800e93 <memmove>
+	return r;
+  80249e:	83 c4 10             	add    $0x10,%esp
+}
+  8024a1:	89 d8                	mov    %ebx,%eax
+  8024a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024a6:	c9                   	leave
+  8024a7:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8024a8:	68 ce 42 80 00       	push   $0x8042ce
+  8024ad:	68 ec 41 80 00       	push   $0x8041ec
+  8024b2:	68 86 01 00 00       	push   $0x186
+  8024b7:	68 bc 42 80 00       	push   $0x8042bc
+  8024bc:	e8 83 e1 ff ff       	call   800644 <_panic>
+		return -E_NOT_SUPP;
+  8024c1:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8024c6:	eb d9                	jmp    8024a1 <readdir+0x8f>
+
+008024c8 <munmap>:
+{
+  8024c8:	55                   	push   %ebp
+  8024c9:	89 e5                	mov    %esp,%ebp
+  8024cb:	56                   	push   %esi
+  8024cc:	53                   	push   %ebx
+  8024cd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8024d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8024d3:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8024d9:	75 41                	jne    80251c <munmap+0x54>
+  8024db:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8024e1:	77 39                	ja     80251c <munmap+0x54>
+  8024e3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8024e8:	29 f0                	sub    %esi,%eax
+  8024ea:	39 d0                	cmp    %edx,%eax
+  8024ec:	72 35                	jb     802523 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8024ee:	89 f3                	mov    %esi,%ebx
+  8024f0:	01 d6                	add    %edx,%esi
+  8024f2:	39 f3                	cmp    %esi,%ebx
+  8024f4:	73 1a                	jae    802510 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8024f6:	83 ec 08             	sub    $0x8,%esp
+  8024f9:	53                   	push   %ebx
+  8024fa:	6a 00                	push   $0x0
+  8024fc:	e8 a5 ec ff ff       	call   8011a6 <sys_page_unmap>
+  802501:	83 c4 10             	add    $0x10,%esp
+  802504:	85 c0                	test   %eax,%eax
+  802506:	78 0d                	js     802515 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802508:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80250e:	eb e2                	jmp    8024f2 <munmap+0x2a>
+	return 0;
+  802510:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802515:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802518:	5b                   	pop    %ebx
+  802519:	5e                   	pop    %esi
+  80251a:	5d                   	pop    %ebp
+  80251b:	c3                   	ret
+		return -E_INVAL;
+  80251c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802521:	eb f2                	jmp    802515 <munmap+0x4d>
+  802523:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802528:	eb eb                	jmp    802515 <munmap+0x4d>
+
+0080252a <mmap>:
+{
+  80252a:	55                   	push   %ebp
+  80252b:	89 e5                	mov    %esp,%ebp
+  80252d:	57                   	push   %edi
+  80252e:	56                   	push   %esi
+  80252f:	53                   	push   %ebx
+  802530:	83 ec 34             	sub    $0x34,%esp
+  802533:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802536:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802539:	50                   	push   %eax
+  80253a:	ff 75 18             	push   0x18(%ebp)
+  80253d:	e8 ee f0 ff ff       	call   801630 <fd_lookup>
+  802542:	89 c3                	mov    %eax,%ebx
+  802544:	83 c4 10             	add    $0x10,%esp
+  802547:	85 c0                	test   %eax,%eax
+  802549:	0f 88 0e 01 00 00    	js     80265d <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80254f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802552:	a1 20 50 80 00       	mov    0x805020,%eax
+  802557:	39 02                	cmp    %eax,(%edx)
+  802559:	0f 85 50 01 00 00    	jne    8026af <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  80255f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802562:	83 e0 02             	and    $0x2,%eax
+  802565:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802568:	74 0a                	je     802574 <mmap+0x4a>
+  80256a:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80256e:	0f 84 42 01 00 00    	je     8026b6 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802574:	8b 42 08             	mov    0x8(%edx),%eax
+  802577:	83 e0 03             	and    $0x3,%eax
+  80257a:	83 f8 01             	cmp    $0x1,%eax
+  80257d:	0f 84 3a 01 00 00    	je     8026bd <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802583:	8b 45 08             	mov    0x8(%ebp),%eax
+  802586:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802589:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80258e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802591:	0f 85 2d 01 00 00    	jne    8026c4 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802597:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80259b:	0f 88 2a 01 00 00    	js     8026cb <mmap+0x1a1>
+  8025a1:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8025a8:	0f 87 1d 01 00 00    	ja     8026cb <mmap+0x1a1>
+  8025ae:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8025b3:	2b 45 08             	sub    0x8(%ebp),%eax
+  8025b6:	39 f8                	cmp    %edi,%eax
+  8025b8:	0f 82 14 01 00 00    	jb     8026d2 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8025be:	83 ec 0c             	sub    $0xc,%esp
+  8025c1:	52                   	push   %edx
+  8025c2:	e8 45 f8 ff ff       	call   801e0c <devfile_sync>
+  8025c7:	89 c3                	mov    %eax,%ebx
+  8025c9:	83 c4 10             	add    $0x10,%esp
+  8025cc:	85 c0                	test   %eax,%eax
+  8025ce:	0f 88 89 00 00 00    	js     80265d <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8025d4:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8025da:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8025e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e5:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8025e8:	39 fe                	cmp    %edi,%esi
+  8025ea:	73 7b                	jae    802667 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8025ec:	89 f8                	mov    %edi,%eax
+  8025ee:	29 f0                	sub    %esi,%eax
+  8025f0:	c1 e8 0c             	shr    $0xc,%eax
+  8025f3:	ba 40 00 00 00       	mov    $0x40,%edx
+  8025f8:	39 d0                	cmp    %edx,%eax
+  8025fa:	0f 47 c2             	cmova  %edx,%eax
+  8025fd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802600:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802603:	8b 52 0c             	mov    0xc(%edx),%edx
+  802606:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  80260c:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  80260f:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  802615:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  80261a:	89 f2                	mov    %esi,%edx
+  80261c:	03 55 08             	add    0x8(%ebp),%edx
+  80261f:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802622:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802627:	e8 ea f6 ff ff       	call   801d16 <fsipcv>
+  80262c:	85 c0                	test   %eax,%eax
+  80262e:	7e 12                	jle    802642 <mmap+0x118>
+  802630:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802633:	85 c0                	test   %eax,%eax
+  802635:	0f 84 9e 00 00 00    	je     8026d9 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80263b:	c1 e0 0c             	shl    $0xc,%eax
+  80263e:	01 c6                	add    %eax,%esi
+  802640:	eb a6                	jmp    8025e8 <mmap+0xbe>
+			munmap(addr, done);
+  802642:	89 c3                	mov    %eax,%ebx
+  802644:	83 ec 08             	sub    $0x8,%esp
+  802647:	56                   	push   %esi
+  802648:	ff 75 08             	push   0x8(%ebp)
+  80264b:	e8 78 fe ff ff       	call   8024c8 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802650:	83 c4 10             	add    $0x10,%esp
+  802653:	85 db                	test   %ebx,%ebx
+  802655:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80265a:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80265d:	89 d8                	mov    %ebx,%eax
+  80265f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802662:	5b                   	pop    %ebx
+  802663:	5e                   	pop    %esi
+  802664:	5f                   	pop    %edi
+  802665:	5d                   	pop    %ebp
+  802666:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802667:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80266a:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80266c:	85 c0                	test   %eax,%eax
+  80266e:	74 ed                	je     80265d <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802670:	be 00 00 00 00       	mov    $0x0,%esi
+  802675:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802678:	39 fe                	cmp    %edi,%esi
+  80267a:	73 2e                	jae    8026aa <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80267c:	83 ec 0c             	sub    $0xc,%esp
+  80267f:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802682:	50                   	push   %eax
+  802683:	e8 fd 0f 00 00       	call   803685 <cowpage>
+  802688:	83 c4 10             	add    $0x10,%esp
+  80268b:	85 c0                	test   %eax,%eax
+  80268d:	78 08                	js     802697 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  80268f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802695:	eb e1                	jmp    802678 <mmap+0x14e>
+				munmap(addr, len);
+  802697:	89 c3                	mov    %eax,%ebx
+  802699:	83 ec 08             	sub    $0x8,%esp
+  80269c:	57                   	push   %edi
+  80269d:	ff 75 08             	push   0x8(%ebp)
+  8026a0:	e8 23 fe ff ff       	call   8024c8 <munmap>
+				return r;
+  8026a5:	83 c4 10             	add    $0x10,%esp
+  8026a8:	eb b3                	jmp    80265d <mmap+0x133>
+	return 0;
+  8026aa:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8026ad:	eb ae                	jmp    80265d <mmap+0x133>
+		return -E_NOT_SUPP;
+  8026af:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8026b4:	eb a7                	jmp    80265d <mmap+0x133>
+		return -E_NOT_SUPP;
+  8026b6:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8026bb:	eb a0                	jmp    80265d <mmap+0x133>
+		return -E_INVAL;
+  8026bd:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8026c2:	eb 99                	jmp    80265d <mmap+0x133>
+  8026c4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8026c9:	eb 92                	jmp    80265d <mmap+0x133>
+  8026cb:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8026d0:	eb 8b                	jmp    80265d <mmap+0x133>
+  8026d2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8026d7:	eb 84                	jmp    80265d <mmap+0x133>
+			munmap(addr, done);
+  8026d9:	83 ec 08             	sub    $0x8,%esp
+  8026dc:	56                   	push   %esi
+  8026dd:	ff 75 08             	push   0x8(%ebp)
+  8026e0:	e8 e3 fd ff ff       	call   8024c8 <munmap>
+  8026e5:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8026e8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8026ed:	e9 6b ff ff ff       	jmp    80265d <mmap+0x133>
+
+008026f2 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8026f2:	55                   	push   %ebp
+  8026f3:	89 e5                	mov    %esp,%ebp
+  8026f5:	56                   	push   %esi
+  8026f6:	53                   	push   %ebx
+  8026f7:	83 ec 10             	sub    $0x10,%esp
+  8026fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8026fd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802700:	8b 45 08             	mov    0x8(%ebp),%eax
+  802703:	e8 3d f9 ff ff       	call   802045 <fsring_slot>
+  802708:	85 c0                	test   %eax,%eax
+  80270a:	78 60                	js     80276c <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80270c:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80270f:	8b 56 08             	mov    0x8(%esi),%edx
+  802712:	83 e2 03             	and    $0x3,%edx
+  802715:	83 fa 01             	cmp    $0x1,%edx
+  802718:	74 59                	je     802773 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  80271a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80271f:	89 c1                	mov    %eax,%ecx
+  802721:	d3 e2                	shl    %cl,%edx
+  802723:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802729:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80272c:	c1 e2 02             	shl    $0x2,%edx
+  80272f:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  802735:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  80273c:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80273f:	8b 55 18             	mov    0x18(%ebp),%edx
+  802742:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802745:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802748:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80274b:	83 ec 08             	sub    $0x8,%esp
+  80274e:	50                   	push   %eax
+  80274f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802754:	39 c3                	cmp    %eax,%ebx
+  802756:	0f 47 d8             	cmova  %eax,%ebx
+  802759:	53                   	push   %ebx
+  80275a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80275d:	89 f2                	mov    %esi,%edx
+  80275f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802764:	e8 1e f5 ff ff       	call   801c87 <fsring_post>
+  802769:	83 c4 10             	add    $0x10,%esp
+}
+  80276c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80276f:	5b                   	pop    %ebx
+  802770:	5e                   	pop    %esi
+  802771:	5d                   	pop    %ebp
+  802772:	c3                   	ret
+		return -E_INVAL;
+  802773:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802778:	eb f2                	jmp    80276c <fsring_read+0x7a>
+
+0080277a <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80277a:	55                   	push   %ebp
+  80277b:	89 e5                	mov    %esp,%ebp
+  80277d:	56                   	push   %esi
+  80277e:	53                   	push   %ebx
+  80277f:	83 ec 10             	sub    $0x10,%esp
+  802782:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802785:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802788:	8b 45 08             	mov    0x8(%ebp),%eax
+  80278b:	e8 b5 f8 ff ff       	call   802045 <fsring_slot>
+  802790:	89 c3                	mov    %eax,%ebx
+  802792:	85 c0                	test   %eax,%eax
+  802794:	78 77                	js     80280d <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802796:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802799:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80279d:	74 77                	je     802816 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80279f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8027a4:	39 c6                	cmp    %eax,%esi
+  8027a6:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8027a9:	83 ec 04             	sub    $0x4,%esp
+  8027ac:	56                   	push   %esi
+  8027ad:	ff 75 0c             	push   0xc(%ebp)
+  8027b0:	89 d8                	mov    %ebx,%eax
+  8027b2:	c1 e0 0c             	shl    $0xc,%eax
+  8027b5:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8027bb:	50                   	push   %eax
+  8027bc:	e8 d2 e6 ff ff       	call   800e93 <memmove>
+	fsring_busy |= 1 << slot;
+  8027c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027c6:	89 d9                	mov    %ebx,%ecx
+  8027c8:	d3 e0                	shl    %cl,%eax
+  8027ca:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8027d0:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8027d3:	c1 e0 02             	shl    $0x2,%eax
+  8027d6:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  8027dc:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  8027e3:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8027e6:	8b 45 18             	mov    0x18(%ebp),%eax
+  8027e9:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8027ec:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8027f3:	83 c4 08             	add    $0x8,%esp
+  8027f6:	53                   	push   %ebx
+  8027f7:	56                   	push   %esi
+  8027f8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8027fb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027fe:	b8 04 00 00 00       	mov    $0x4,%eax
+  802803:	e8 7f f4 ff ff       	call   801c87 <fsring_post>
+  802808:	89 c3                	mov    %eax,%ebx
+  80280a:	83 c4 10             	add    $0x10,%esp
+}
+  80280d:	89 d8                	mov    %ebx,%eax
+  80280f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802812:	5b                   	pop    %ebx
+  802813:	5e                   	pop    %esi
+  802814:	5d                   	pop    %ebp
+  802815:	c3                   	ret
+		return -E_INVAL;
+  802816:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80281b:	eb f0                	jmp    80280d <fsring_write+0x93>
+
+0080281d <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80281d:	55                   	push   %ebp
+  80281e:	89 e5                	mov    %esp,%ebp
+  802820:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802823:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802826:	8b 45 08             	mov    0x8(%ebp),%eax
+  802829:	e8 17 f8 ff ff       	call   802045 <fsring_slot>
+  80282e:	85 c0                	test   %eax,%eax
+  802830:	78 4c                	js     80287e <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802832:	ba 01 00 00 00       	mov    $0x1,%edx
+  802837:	89 c1                	mov    %eax,%ecx
+  802839:	d3 e2                	shl    %cl,%edx
+  80283b:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802841:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802844:	c1 e2 02             	shl    $0x2,%edx
+  802847:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  80284d:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  802854:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802857:	8b 55 10             	mov    0x10(%ebp),%edx
+  80285a:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80285d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802860:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802863:	83 ec 08             	sub    $0x8,%esp
+  802866:	50                   	push   %eax
+  802867:	6a 00                	push   $0x0
+  802869:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80286e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802871:	b8 05 00 00 00       	mov    $0x5,%eax
+  802876:	e8 0c f4 ff ff       	call   801c87 <fsring_post>
+  80287b:	83 c4 10             	add    $0x10,%esp
+}
+  80287e:	c9                   	leave
+  80287f:	c3                   	ret
+
+00802880 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802880:	55                   	push   %ebp
+  802881:	89 e5                	mov    %esp,%ebp
+  802883:	57                   	push   %edi
+  802884:	56                   	push   %esi
+  802885:	53                   	push   %ebx
+  802886:	83 ec 1c             	sub    $0x1c,%esp
+  802889:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80288d:	a1 ac 60 80 00       	mov    0x8060ac,%eax
+  802892:	8b 40 48             	mov    0x48(%eax),%eax
+  802895:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  80289b:	74 12                	je     8028af <fsring_reap+0x2f>
+		return 0;
+  80289d:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8028a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028a5:	5b                   	pop    %ebx
+  8028a6:	5e                   	pop    %esi
+  8028a7:	5f                   	pop    %edi
+  8028a8:	5d                   	pop    %ebp
+  8028a9:	c3                   	ret
+		sys_yield();
+  8028aa:	e8 4b e8 ff ff       	call   8010fa <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8028af:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8028b5:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8028ba:	39 c2                	cmp    %eax,%edx
+  8028bc:	75 18                	jne    8028d6 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8028be:	84 db                	test   %bl,%bl
+  8028c0:	0f 84 21 01 00 00    	je     8029e7 <fsring_reap+0x167>
+  8028c6:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  8028cd:	75 db                	jne    8028aa <fsring_reap+0x2a>
+			return 0;
+  8028cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d4:	eb cc                	jmp    8028a2 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8028d6:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8028db:	83 e0 0f             	and    $0xf,%eax
+  8028de:	83 c0 2a             	add    $0x2a,%eax
+  8028e1:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8028e8:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8028ef:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8028f4:	83 c0 01             	add    $0x1,%eax
+  8028f7:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8028fc:	83 fb 0f             	cmp    $0xf,%ebx
+  8028ff:	77 5b                	ja     80295c <fsring_reap+0xdc>
+  802901:	be 01 00 00 00       	mov    $0x1,%esi
+  802906:	89 d9                	mov    %ebx,%ecx
+  802908:	d3 e6                	shl    %cl,%esi
+  80290a:	89 f0                	mov    %esi,%eax
+  80290c:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  802912:	74 48                	je     80295c <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802914:	89 d8                	mov    %ebx,%eax
+  802916:	c1 e0 0c             	shl    $0xc,%eax
+  802919:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80291f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802922:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802925:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  80292c:	83 f8 03             	cmp    $0x3,%eax
+  80292f:	74 40                	je     802971 <fsring_reap+0xf1>
+  802931:	83 f8 05             	cmp    $0x5,%eax
+  802934:	74 64                	je     80299a <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802936:	f7 d6                	not    %esi
+  802938:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  80293e:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802941:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  802948:	8b 45 08             	mov    0x8(%ebp),%eax
+  80294b:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  80294d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802950:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802952:	b8 01 00 00 00       	mov    $0x1,%eax
+  802957:	e9 46 ff ff ff       	jmp    8028a2 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80295c:	53                   	push   %ebx
+  80295d:	68 e4 42 80 00       	push   $0x8042e4
+  802962:	68 8f 02 00 00       	push   $0x28f
+  802967:	68 bc 42 80 00       	push   $0x8042bc
+  80296c:	e8 d3 dc ff ff       	call   800644 <_panic>
+		if (cqe.cqe_result > 0)
+  802971:	85 ff                	test   %edi,%edi
+  802973:	7e c1                	jle    802936 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802975:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802978:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80297d:	39 c7                	cmp    %eax,%edi
+  80297f:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802982:	50                   	push   %eax
+  802983:	ff 75 e4             	push   -0x1c(%ebp)
+  802986:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802989:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  802990:	e8 fe e4 ff ff       	call   800e93 <memmove>
+  802995:	83 c4 10             	add    $0x10,%esp
+  802998:	eb 9c                	jmp    802936 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80299a:	85 ff                	test   %edi,%edi
+  80299c:	75 98                	jne    802936 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80299e:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8029a1:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8029a8:	83 ec 08             	sub    $0x8,%esp
+  8029ab:	ff 75 e4             	push   -0x1c(%ebp)
+  8029ae:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8029b1:	51                   	push   %ecx
+  8029b2:	e8 56 e3 ff ff       	call   800d0d <strcpy>
+			st->st_size = ret->ret_size;
+  8029b7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8029ba:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8029c0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8029c3:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8029c9:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8029cf:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8029d5:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  8029dc:	50 80 00 
+  8029df:	83 c4 10             	add    $0x10,%esp
+  8029e2:	e9 4f ff ff ff       	jmp    802936 <fsring_reap+0xb6>
+			return 0;
+  8029e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ec:	e9 b1 fe ff ff       	jmp    8028a2 <fsring_reap+0x22>
+
+008029f1 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8029f1:	55                   	push   %ebp
+  8029f2:	89 e5                	mov    %esp,%ebp
+  8029f4:	57                   	push   %edi
+  8029f5:	56                   	push   %esi
+  8029f6:	53                   	push   %ebx
+  8029f7:	83 ec 28             	sub    $0x28,%esp
+  8029fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029fd:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802a00:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802a03:	53                   	push   %ebx
+  802a04:	e8 c9 e2 ff ff       	call   800cd2 <strlen>
+  802a09:	83 c4 10             	add    $0x10,%esp
+  802a0c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a11:	0f 8f 02 01 00 00    	jg     802b19 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802a17:	83 ec 08             	sub    $0x8,%esp
+  802a1a:	53                   	push   %ebx
+  802a1b:	68 00 70 80 00       	push   $0x807000
+  802a20:	e8 e8 e2 ff ff       	call   800d0d <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802a25:	83 c4 10             	add    $0x10,%esp
+  802a28:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802a2e:	76 69                	jbe    802a99 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802a30:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a33:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802a39:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802a3e:	29 d1                	sub    %edx,%ecx
+  802a40:	39 f9                	cmp    %edi,%ecx
+  802a42:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802a45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a48:	89 f9                	mov    %edi,%ecx
+  802a4a:	01 c1                	add    %eax,%ecx
+  802a4c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802a4f:	eb 0f                	jmp    802a60 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802a51:	0f b6 10             	movzbl (%eax),%edx
+  802a54:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802a56:	05 00 10 00 00       	add    $0x1000,%eax
+  802a5b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802a60:	39 c8                	cmp    %ecx,%eax
+  802a62:	72 ed                	jb     802a51 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802a64:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a67:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802a6d:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802a73:	83 ec 0c             	sub    $0xc,%esp
+  802a76:	6a 07                	push   $0x7
+  802a78:	89 f9                	mov    %edi,%ecx
+  802a7a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a7d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802a82:	e8 3f f1 ff ff       	call   801bc6 <fsipc_pages>
+  802a87:	89 c7                	mov    %eax,%edi
+  802a89:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802a8c:	85 f6                	test   %esi,%esi
+  802a8e:	74 7f                	je     802b0f <file_slurp+0x11e>
+  802a90:	8d 43 01             	lea    0x1(%ebx),%eax
+  802a93:	85 ff                	test   %edi,%edi
+  802a95:	79 3c                	jns    802ad3 <file_slurp+0xe2>
+  802a97:	eb 76                	jmp    802b0f <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802a99:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802a9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aa4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802aa9:	e8 ba f2 ff ff       	call   801d68 <fsipc>
+  802aae:	89 c7                	mov    %eax,%edi
+  802ab0:	85 c0                	test   %eax,%eax
+  802ab2:	7e d8                	jle    802a8c <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802ab4:	83 ec 04             	sub    $0x4,%esp
+  802ab7:	50                   	push   %eax
+  802ab8:	68 08 70 80 00       	push   $0x807008
+  802abd:	ff 75 0c             	push   0xc(%ebp)
+  802ac0:	e8 ce e3 ff ff       	call   800e93 <memmove>
+  802ac5:	83 c4 10             	add    $0x10,%esp
+  802ac8:	eb c2                	jmp    802a8c <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802aca:	80 fa 2f             	cmp    $0x2f,%dl
+  802acd:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802ad0:	83 c0 01             	add    $0x1,%eax
+  802ad3:	89 c1                	mov    %eax,%ecx
+  802ad5:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802ad9:	84 d2                	test   %dl,%dl
+  802adb:	75 ed                	jne    802aca <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802add:	83 ec 04             	sub    $0x4,%esp
+  802ae0:	68 80 00 00 00       	push   $0x80
+  802ae5:	53                   	push   %ebx
+  802ae6:	56                   	push   %esi
+  802ae7:	e8 97 e2 ff ff       	call   800d83 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802aec:	a1 00 70 80 00       	mov    0x807000,%eax
+  802af1:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802af7:	a1 04 70 80 00       	mov    0x807004,%eax
+  802afc:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802b02:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  802b09:	50 80 00 
+  802b0c:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802b0f:	89 f8                	mov    %edi,%eax
+  802b11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b14:	5b                   	pop    %ebx
+  802b15:	5e                   	pop    %esi
+  802b16:	5f                   	pop    %edi
+  802b17:	5d                   	pop    %ebp
+  802b18:	c3                   	ret
+		return -E_BAD_PATH;
+  802b19:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802b1e:	eb ef                	jmp    802b0f <file_slurp+0x11e>
+
+00802b20 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802b20:	55                   	push   %ebp
+  802b21:	89 e5                	mov    %esp,%ebp
+  802b23:	53                   	push   %ebx
+  802b24:	83 ec 10             	sub    $0x10,%esp
+  802b27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802b2a:	53                   	push   %ebx
+  802b2b:	e8 a2 e1 ff ff       	call   800cd2 <strlen>
+  802b30:	83 c4 10             	add    $0x10,%esp
+  802b33:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802b38:	7f 25                	jg     802b5f <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802b3a:	83 ec 08             	sub    $0x8,%esp
+  802b3d:	53                   	push   %ebx
+  802b3e:	68 00 70 80 00       	push   $0x807000
+  802b43:	e8 c5 e1 ff ff       	call   800d0d <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802b48:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b4d:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b52:	e8 11 f2 ff ff       	call   801d68 <fsipc>
+  802b57:	83 c4 10             	add    $0x10,%esp
+}
+  802b5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b5d:	c9                   	leave
+  802b5e:	c3                   	ret
+		return -E_BAD_PATH;
+  802b5f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802b64:	eb f4                	jmp    802b5a <remove+0x3a>
+
+00802b66 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802b66:	55                   	push   %ebp
+  802b67:	89 e5                	mov    %esp,%ebp
+  802b69:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802b6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b71:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b76:	e8 ed f1 ff ff       	call   801d68 <fsipc>
+}
+  802b7b:	c9                   	leave
+  802b7c:	c3                   	ret
+
+00802b7d <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802b7d:	55                   	push   %ebp
+  802b7e:	89 e5                	mov    %esp,%ebp
+  802b80:	57                   	push   %edi
+  802b81:	56                   	push   %esi
+  802b82:	53                   	push   %ebx
+  802b83:	83 ec 18             	sub    $0x18,%esp
+  802b86:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b89:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802b8f:	57                   	push   %edi
+  802b90:	e8 3d e1 ff ff       	call   800cd2 <strlen>
+  802b95:	83 c4 10             	add    $0x10,%esp
+  802b98:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802b9d:	7f 4c                	jg     802beb <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802b9f:	83 ec 08             	sub    $0x8,%esp
+  802ba2:	57                   	push   %edi
+  802ba3:	68 00 70 80 00       	push   $0x807000
+  802ba8:	e8 60 e1 ff ff       	call   800d0d <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802bad:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bb2:	b8 10 00 00 00       	mov    $0x10,%eax
+  802bb7:	e8 ac f1 ff ff       	call   801d68 <fsipc>
+  802bbc:	83 c4 10             	add    $0x10,%esp
+  802bbf:	85 c0                	test   %eax,%eax
+  802bc1:	78 20                	js     802be3 <defrag+0x66>
+		return r;
+	if (before)
+  802bc3:	85 f6                	test   %esi,%esi
+  802bc5:	74 07                	je     802bce <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802bc7:	a1 00 70 80 00       	mov    0x807000,%eax
+  802bcc:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802bce:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802bd3:	85 db                	test   %ebx,%ebx
+  802bd5:	74 0c                	je     802be3 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802bd7:	a1 04 70 80 00       	mov    0x807004,%eax
+  802bdc:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802bde:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802be3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802be6:	5b                   	pop    %ebx
+  802be7:	5e                   	pop    %esi
+  802be8:	5f                   	pop    %edi
+  802be9:	5d                   	pop    %ebp
+  802bea:	c3                   	ret
+		return -E_BAD_PATH;
+  802beb:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802bf0:	eb f1                	jmp    802be3 <defrag+0x66>
+
+00802bf2 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802bf2:	55                   	push   %ebp
+  802bf3:	89 e5                	mov    %esp,%ebp
+  802bf5:	53                   	push   %ebx
+  802bf6:	83 ec 04             	sub    $0x4,%esp
+  802bf9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802bfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c01:	b8 11 00 00 00       	mov    $0x11,%eax
+  802c06:	e8 5d f1 ff ff       	call   801d68 <fsipc>
+  802c0b:	85 c0                	test   %eax,%eax
+  802c0d:	78 34                	js     802c43 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802c0f:	a1 00 70 80 00       	mov    0x807000,%eax
+  802c14:	89 03                	mov    %eax,(%ebx)
+  802c16:	a1 04 70 80 00       	mov    0x807004,%eax
+  802c1b:	89 43 04             	mov    %eax,0x4(%ebx)
+  802c1e:	a1 08 70 80 00       	mov    0x807008,%eax
+  802c23:	89 43 08             	mov    %eax,0x8(%ebx)
+  802c26:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  802c2b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802c2e:	a1 10 70 80 00       	mov    0x807010,%eax
+  802c33:	89 43 10             	mov    %eax,0x10(%ebx)
+  802c36:	a1 14 70 80 00       	mov    0x807014,%eax
+  802c3b:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c46:	c9                   	leave
+  802c47:	c3                   	ret
+
+00802c48 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c48:	55                   	push   %ebp
+  802c49:	89 e5                	mov    %esp,%ebp
+  802c4b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802c4e:	68 fd 42 80 00       	push   $0x8042fd
+  802c53:	ff 75 0c             	push   0xc(%ebp)
+  802c56:	e8 b2 e0 ff ff       	call   800d0d <strcpy>
+	return 0;
+}
+  802c5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c60:	c9                   	leave
+  802c61:	c3                   	ret
+
+00802c62 <devsock_close>:
+{
+  802c62:	55                   	push   %ebp
+  802c63:	89 e5                	mov    %esp,%ebp
+  802c65:	53                   	push   %ebx
+  802c66:	83 ec 10             	sub    $0x10,%esp
+  802c69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802c6c:	53                   	push   %ebx
+  802c6d:	e8 f4 0d 00 00       	call   803a66 <pageref>
+  802c72:	89 c2                	mov    %eax,%edx
+  802c74:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802c77:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802c7c:	83 fa 01             	cmp    $0x1,%edx
+  802c7f:	74 05                	je     802c86 <devsock_close+0x24>
+}
+  802c81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c84:	c9                   	leave
+  802c85:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802c86:	83 ec 0c             	sub    $0xc,%esp
+  802c89:	ff 73 0c             	push   0xc(%ebx)
+  802c8c:	e8 b7 02 00 00       	call   802f48 <nsipc_close>
+  802c91:	83 c4 10             	add    $0x10,%esp
+  802c94:	eb eb                	jmp    802c81 <devsock_close+0x1f>
+
+00802c96 <devsock_write>:
+{
+  802c96:	55                   	push   %ebp
+  802c97:	89 e5                	mov    %esp,%ebp
+  802c99:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802c9c:	6a 00                	push   $0x0
+  802c9e:	ff 75 10             	push   0x10(%ebp)
+  802ca1:	ff 75 0c             	push   0xc(%ebp)
+  802ca4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca7:	ff 70 0c             	push   0xc(%eax)
+  802caa:	e8 79 03 00 00       	call   803028 <nsipc_send>
+}
+  802caf:	c9                   	leave
+  802cb0:	c3                   	ret
+
+00802cb1 <devsock_read>:
+{
+  802cb1:	55                   	push   %ebp
+  802cb2:	89 e5                	mov    %esp,%ebp
+  802cb4:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802cb7:	6a 00                	push   $0x0
+  802cb9:	ff 75 10             	push   0x10(%ebp)
+  802cbc:	ff 75 0c             	push   0xc(%ebp)
+  802cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc2:	ff 70 0c             	push   0xc(%eax)
+  802cc5:	e8 ef 02 00 00       	call   802fb9 <nsipc_recv>
+}
+  802cca:	c9                   	leave
+  802ccb:	c3                   	ret
+
+00802ccc <fd2sockid>:
+{
+  802ccc:	55                   	push   %ebp
+  802ccd:	89 e5                	mov    %esp,%ebp
+  802ccf:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802cd2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802cd5:	52                   	push   %edx
+  802cd6:	50                   	push   %eax
+  802cd7:	e8 54 e9 ff ff       	call   801630 <fd_lookup>
+  802cdc:	83 c4 10             	add    $0x10,%esp
+  802cdf:	85 c0                	test   %eax,%eax
+  802ce1:	78 10                	js     802cf3 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802ce3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ce6:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802cec:	39 08                	cmp    %ecx,(%eax)
+  802cee:	75 05                	jne    802cf5 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802cf0:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802cf3:	c9                   	leave
+  802cf4:	c3                   	ret
+		return -E_NOT_SUPP;
+  802cf5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802cfa:	eb f7                	jmp    802cf3 <fd2sockid+0x27>
+
+00802cfc <alloc_sockfd>:
+{
+  802cfc:	55                   	push   %ebp
+  802cfd:	89 e5                	mov    %esp,%ebp
+  802cff:	56                   	push   %esi
+  802d00:	53                   	push   %ebx
+  802d01:	83 ec 1c             	sub    $0x1c,%esp
+  802d04:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802d06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d09:	50                   	push   %eax
+  802d0a:	e8 cb e8 ff ff       	call   8015da <fd_alloc>
+  802d0f:	89 c3                	mov    %eax,%ebx
+  802d11:	83 c4 10             	add    $0x10,%esp
+  802d14:	85 c0                	test   %eax,%eax
+  802d16:	78 43                	js     802d5b <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802d18:	83 ec 04             	sub    $0x4,%esp
+  802d1b:	68 07 04 00 00       	push   $0x407
+  802d20:	ff 75 f4             	push   -0xc(%ebp)
+  802d23:	6a 00                	push   $0x0
+  802d25:	e8 ef e3 ff ff       	call   801119 <sys_page_alloc>
+  802d2a:	89 c3                	mov    %eax,%ebx
+  802d2c:	83 c4 10             	add    $0x10,%esp
+  802d2f:	85 c0                	test   %eax,%eax
+  802d31:	78 28                	js     802d5b <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802d33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d36:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802d3c:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802d3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d41:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802d48:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802d4b:	83 ec 0c             	sub    $0xc,%esp
+  802d4e:	50                   	push   %eax
+  802d4f:	e8 5f e8 ff ff       	call   8015b3 <fd2num>
+  802d54:	89 c3                	mov    %eax,%ebx
+  802d56:	83 c4 10             	add    $0x10,%esp
+  802d59:	eb 0c                	jmp    802d67 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802d5b:	83 ec 0c             	sub    $0xc,%esp
+  802d5e:	56                   	push   %esi
+  802d5f:	e8 e4 01 00 00       	call   802f48 <nsipc_close>
+		return r;
+  802d64:	83 c4 10             	add    $0x10,%esp
+}
+  802d67:	89 d8                	mov    %ebx,%eax
+  802d69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d6c:	5b                   	pop    %ebx
+  802d6d:	5e                   	pop    %esi
+  802d6e:	5d                   	pop    %ebp
+  802d6f:	c3                   	ret
+
+00802d70 <accept>:
+{
+  802d70:	55                   	push   %ebp
+  802d71:	89 e5                	mov    %esp,%ebp
+  802d73:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d76:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d79:	e8 4e ff ff ff       	call   802ccc <fd2sockid>
+  802d7e:	85 c0                	test   %eax,%eax
+  802d80:	78 1b                	js     802d9d <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802d82:	83 ec 04             	sub    $0x4,%esp
+  802d85:	ff 75 10             	push   0x10(%ebp)
+  802d88:	ff 75 0c             	push   0xc(%ebp)
+  802d8b:	50                   	push   %eax
+  802d8c:	e8 0e 01 00 00       	call   802e9f <nsipc_accept>
+  802d91:	83 c4 10             	add    $0x10,%esp
+  802d94:	85 c0                	test   %eax,%eax
+  802d96:	78 05                	js     802d9d <accept+0x2d>
+	return alloc_sockfd(r);
+  802d98:	e8 5f ff ff ff       	call   802cfc <alloc_sockfd>
+}
+  802d9d:	c9                   	leave
+  802d9e:	c3                   	ret
+
+00802d9f <bind>:
+{
+  802d9f:	55                   	push   %ebp
+  802da0:	89 e5                	mov    %esp,%ebp
+  802da2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802da5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da8:	e8 1f ff ff ff       	call   802ccc <fd2sockid>
+  802dad:	85 c0                	test   %eax,%eax
+  802daf:	78 12                	js     802dc3 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802db1:	83 ec 04             	sub    $0x4,%esp
+  802db4:	ff 75 10             	push   0x10(%ebp)
+  802db7:	ff 75 0c             	push   0xc(%ebp)
+  802dba:	50                   	push   %eax
+  802dbb:	e8 31 01 00 00       	call   802ef1 <nsipc_bind>
+  802dc0:	83 c4 10             	add    $0x10,%esp
+}
+  802dc3:	c9                   	leave
+  802dc4:	c3                   	ret
+
+00802dc5 <shutdown>:
+{
+  802dc5:	55                   	push   %ebp
+  802dc6:	89 e5                	mov    %esp,%ebp
+  802dc8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802dcb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dce:	e8 f9 fe ff ff       	call   802ccc <fd2sockid>
+  802dd3:	85 c0                	test   %eax,%eax
+  802dd5:	78 0f                	js     802de6 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802dd7:	83 ec 08             	sub    $0x8,%esp
+  802dda:	ff 75 0c             	push   0xc(%ebp)
+  802ddd:	50                   	push   %eax
+  802dde:	e8 43 01 00 00       	call   802f26 <nsipc_shutdown>
+  802de3:	83 c4 10             	add    $0x10,%esp
+}
+  802de6:	c9                   	leave
+  802de7:	c3                   	ret
+
+00802de8 <connect>:
+{
+  802de8:	55                   	push   %ebp
+  802de9:	89 e5                	mov    %esp,%ebp
+  802deb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802dee:	8b 45 08             	mov    0x8(%ebp),%eax
+  802df1:	e8 d6 fe ff ff       	call   802ccc <fd2sockid>
+  802df6:	85 c0                	test   %eax,%eax
+  802df8:	78 12                	js     802e0c <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802dfa:	83 ec 04             	sub    $0x4,%esp
+  802dfd:	ff 75 10             	push   0x10(%ebp)
+  802e00:	ff 75 0c             	push   0xc(%ebp)
+  802e03:	50                   	push   %eax
+  802e04:	e8 59 01 00 00       	call   802f62 <nsipc_connect>
+  802e09:	83 c4 10             	add    $0x10,%esp
+}
+  802e0c:	c9                   	leave
+  802e0d:	c3                   	ret
+
+00802e0e <listen>:
+{
+  802e0e:	55                   	push   %ebp
+  802e0f:	89 e5                	mov    %esp,%ebp
+  802e11:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e14:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e17:	e8 b0 fe ff ff       	call   802ccc <fd2sockid>
+  802e1c:	85 c0                	test   %eax,%eax
+  802e1e:	78 0f                	js     802e2f <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802e20:	83 ec 08             	sub    $0x8,%esp
+  802e23:	ff 75 0c             	push   0xc(%ebp)
+  802e26:	50                   	push   %eax
+  802e27:	e8 6b 01 00 00       	call   802f97 <nsipc_listen>
+  802e2c:	83 c4 10             	add    $0x10,%esp
+}
+  802e2f:	c9                   	leave
+  802e30:	c3                   	ret
+
+00802e31 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802e31:	55                   	push   %ebp
+  802e32:	89 e5                	mov    %esp,%ebp
+  802e34:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802e37:	ff 75 10             	push   0x10(%ebp)
+  802e3a:	ff 75 0c             	push   0xc(%ebp)
+  802e3d:	ff 75 08             	push   0x8(%ebp)
+  802e40:	e8 41 02 00 00       	call   803086 <nsipc_socket>
+  802e45:	83 c4 10             	add    $0x10,%esp
+  802e48:	85 c0                	test   %eax,%eax
+  802e4a:	78 05                	js     802e51 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802e4c:	e8 ab fe ff ff       	call   802cfc <alloc_sockfd>
+}
+  802e51:	c9                   	leave
+  802e52:	c3                   	ret
+
+00802e53 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802e53:	55                   	push   %ebp
+  802e54:	89 e5                	mov    %esp,%ebp
+  802e56:	53                   	push   %ebx
+  802e57:	83 ec 04             	sub    $0x4,%esp
+  802e5a:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802e5c:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802e63:	74 26                	je     802e8b <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802e65:	6a 07                	push   $0x7
+  802e67:	68 00 90 80 00       	push   $0x809000
+  802e6c:	53                   	push   %ebx
+  802e6d:	ff 35 00 a0 80 00    	push   0x80a000
+  802e73:	e8 76 0a 00 00       	call   8038ee <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802e78:	83 c4 0c             	add    $0xc,%esp
+  802e7b:	6a 00                	push   $0x0
+  802e7d:	6a 00                	push   $0x0
+  802e7f:	6a 00                	push   $0x0
+  802e81:	e8 fd 09 00 00       	call   803883 <ipc_recv>
+}
+  802e86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e89:	c9                   	leave
+  802e8a:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802e8b:	83 ec 0c             	sub    $0xc,%esp
+  802e8e:	6a 02                	push   $0x2
+  802e90:	e8 92 0b 00 00       	call   803a27 <ipc_find_env>
+  802e95:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  802e9a:	83 c4 10             	add    $0x10,%esp
+  802e9d:	eb c6                	jmp    802e65 <nsipc+0x12>
+
+00802e9f <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802e9f:	55                   	push   %ebp
+  802ea0:	89 e5                	mov    %esp,%ebp
+  802ea2:	56                   	push   %esi
+  802ea3:	53                   	push   %ebx
+  802ea4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802ea7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eaa:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802eaf:	8b 06                	mov    (%esi),%eax
+  802eb1:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802eb6:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ebb:	e8 93 ff ff ff       	call   802e53 <nsipc>
+  802ec0:	89 c3                	mov    %eax,%ebx
+  802ec2:	85 c0                	test   %eax,%eax
+  802ec4:	79 09                	jns    802ecf <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802ec6:	89 d8                	mov    %ebx,%eax
+  802ec8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ecb:	5b                   	pop    %ebx
+  802ecc:	5e                   	pop    %esi
+  802ecd:	5d                   	pop    %ebp
+  802ece:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802ecf:	83 ec 04             	sub    $0x4,%esp
+  802ed2:	ff 35 10 90 80 00    	push   0x809010
+  802ed8:	68 00 90 80 00       	push   $0x809000
+  802edd:	ff 75 0c             	push   0xc(%ebp)
+  802ee0:	e8 ae df ff ff       	call   800e93 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802ee5:	a1 10 90 80 00       	mov    0x809010,%eax
+  802eea:	89 06                	mov    %eax,(%esi)
+  802eec:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802eef:	eb d5                	jmp    802ec6 <nsipc_accept+0x27>
+
+00802ef1 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802ef1:	55                   	push   %ebp
+  802ef2:	89 e5                	mov    %esp,%ebp
+  802ef4:	53                   	push   %ebx
+  802ef5:	83 ec 08             	sub    $0x8,%esp
+  802ef8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802efb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802efe:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802f03:	53                   	push   %ebx
+  802f04:	ff 75 0c             	push   0xc(%ebp)
+  802f07:	68 04 90 80 00       	push   $0x809004
+  802f0c:	e8 82 df ff ff       	call   800e93 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802f11:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802f17:	b8 02 00 00 00       	mov    $0x2,%eax
+  802f1c:	e8 32 ff ff ff       	call   802e53 <nsipc>
+}
+  802f21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f24:	c9                   	leave
+  802f25:	c3                   	ret
+
+00802f26 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802f26:	55                   	push   %ebp
+  802f27:	89 e5                	mov    %esp,%ebp
+  802f29:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802f2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f2f:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802f34:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f37:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802f3c:	b8 03 00 00 00       	mov    $0x3,%eax
+  802f41:	e8 0d ff ff ff       	call   802e53 <nsipc>
+}
+  802f46:	c9                   	leave
+  802f47:	c3                   	ret
+
+00802f48 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802f48:	55                   	push   %ebp
+  802f49:	89 e5                	mov    %esp,%ebp
+  802f4b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802f4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f51:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802f56:	b8 04 00 00 00       	mov    $0x4,%eax
+  802f5b:	e8 f3 fe ff ff       	call   802e53 <nsipc>
+}
+  802f60:	c9                   	leave
+  802f61:	c3                   	ret
+
+00802f62 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802f62:	55                   	push   %ebp
+  802f63:	89 e5                	mov    %esp,%ebp
+  802f65:	53                   	push   %ebx
+  802f66:	83 ec 08             	sub    $0x8,%esp
+  802f69:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802f6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f6f:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802f74:	53                   	push   %ebx
+  802f75:	ff 75 0c             	push   0xc(%ebp)
+  802f78:	68 04 90 80 00       	push   $0x809004
+  802f7d:	e8 11 df ff ff       	call   800e93 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802f82:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802f88:	b8 05 00 00 00       	mov    $0x5,%eax
+  802f8d:	e8 c1 fe ff ff       	call   802e53 <nsipc>
+}
+  802f92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f95:	c9                   	leave
+  802f96:	c3                   	ret
+
+00802f97 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802f97:	55                   	push   %ebp
+  802f98:	89 e5                	mov    %esp,%ebp
+  802f9a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802f9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fa0:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802fa5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fa8:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802fad:	b8 06 00 00 00       	mov    $0x6,%eax
+  802fb2:	e8 9c fe ff ff       	call   802e53 <nsipc>
+}
+  802fb7:	c9                   	leave
+  802fb8:	c3                   	ret
+
+00802fb9 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802fb9:	55                   	push   %ebp
+  802fba:	89 e5                	mov    %esp,%ebp
+  802fbc:	56                   	push   %esi
+  802fbd:	53                   	push   %ebx
+  802fbe:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802fc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fc4:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802fc9:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802fcf:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fd2:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802fd7:	b8 07 00 00 00       	mov    $0x7,%eax
+  802fdc:	e8 72 fe ff ff       	call   802e53 <nsipc>
+  802fe1:	89 c3                	mov    %eax,%ebx
+  802fe3:	85 c0                	test   %eax,%eax
+  802fe5:	78 22                	js     803009 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802fe7:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802fec:	39 c6                	cmp    %eax,%esi
+  802fee:	0f 4e c6             	cmovle %esi,%eax
+  802ff1:	39 c3                	cmp    %eax,%ebx
+  802ff3:	7f 1d                	jg     803012 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ff5:	83 ec 04             	sub    $0x4,%esp
+  802ff8:	53                   	push   %ebx
+  802ff9:	68 00 90 80 00       	push   $0x809000
+  802ffe:	ff 75 0c             	push   0xc(%ebp)
+  803001:	e8 8d de ff ff       	call   800e93 <memmove>
+  803006:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803009:	89 d8                	mov    %ebx,%eax
+  80300b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80300e:	5b                   	pop    %ebx
+  80300f:	5e                   	pop    %esi
+  803010:	5d                   	pop    %ebp
+  803011:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803012:	68 09 43 80 00       	push   $0x804309
+  803017:	68 ec 41 80 00       	push   $0x8041ec
+  80301c:	6a 62                	push   $0x62
+  80301e:	68 1e 43 80 00       	push   $0x80431e
+  803023:	e8 1c d6 ff ff       	call   800644 <_panic>
+
+00803028 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803028:	55                   	push   %ebp
+  803029:	89 e5                	mov    %esp,%ebp
+  80302b:	53                   	push   %ebx
+  80302c:	83 ec 04             	sub    $0x4,%esp
+  80302f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803032:	8b 45 08             	mov    0x8(%ebp),%eax
+  803035:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  80303a:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803040:	7f 2e                	jg     803070 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803042:	83 ec 04             	sub    $0x4,%esp
+  803045:	53                   	push   %ebx
+  803046:	ff 75 0c             	push   0xc(%ebp)
+  803049:	68 0c 90 80 00       	push   $0x80900c
+  80304e:	e8 40 de ff ff       	call   800e93 <memmove>
+	nsipcbuf.send.req_size = size;
+  803053:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803059:	8b 45 14             	mov    0x14(%ebp),%eax
+  80305c:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803061:	b8 08 00 00 00       	mov    $0x8,%eax
+  803066:	e8 e8 fd ff ff       	call   802e53 <nsipc>
+}
+  80306b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80306e:	c9                   	leave
+  80306f:	c3                   	ret
+	assert(size < 1600);
+  803070:	68 2a 43 80 00       	push   $0x80432a
+  803075:	68 ec 41 80 00       	push   $0x8041ec
+  80307a:	6a 6d                	push   $0x6d
+  80307c:	68 1e 43 80 00       	push   $0x80431e
+  803081:	e8 be d5 ff ff       	call   800644 <_panic>
+
+00803086 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803086:	55                   	push   %ebp
+  803087:	89 e5                	mov    %esp,%ebp
+  803089:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80308c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80308f:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  803094:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803097:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  80309c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80309f:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8030a4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8030a9:	e8 a5 fd ff ff       	call   802e53 <nsipc>
+}
+  8030ae:	c9                   	leave
+  8030af:	c3                   	ret
+
+008030b0 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8030b0:	55                   	push   %ebp
+  8030b1:	89 e5                	mov    %esp,%ebp
+  8030b3:	56                   	push   %esi
+  8030b4:	53                   	push   %ebx
+  8030b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8030b8:	83 ec 0c             	sub    $0xc,%esp
+  8030bb:	ff 75 08             	push   0x8(%ebp)
+  8030be:	e8 00 e5 ff ff       	call   8015c3 <fd2data>
+  8030c3:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8030c5:	83 c4 08             	add    $0x8,%esp
+  8030c8:	68 36 43 80 00       	push   $0x804336
+  8030cd:	53                   	push   %ebx
+  8030ce:	e8 3a dc ff ff       	call   800d0d <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8030d3:	8b 46 04             	mov    0x4(%esi),%eax
+  8030d6:	2b 06                	sub    (%esi),%eax
+  8030d8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8030de:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8030e5:	00 00 00 
+	stat->st_dev = &devpipe;
+  8030e8:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  8030ef:	50 80 00 
+	return 0;
+}
+  8030f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030fa:	5b                   	pop    %ebx
+  8030fb:	5e                   	pop    %esi
+  8030fc:	5d                   	pop    %ebp
+  8030fd:	c3                   	ret
+
+008030fe <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8030fe:	55                   	push   %ebp
+  8030ff:	89 e5                	mov    %esp,%ebp
+  803101:	53                   	push   %ebx
+  803102:	83 ec 0c             	sub    $0xc,%esp
+  803105:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803108:	53                   	push   %ebx
+  803109:	6a 00                	push   $0x0
+  80310b:	e8 96 e0 ff ff       	call   8011a6 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803110:	89 1c 24             	mov    %ebx,(%esp)
+  803113:	e8 ab e4 ff ff       	call   8015c3 <fd2data>
+  803118:	83 c4 08             	add    $0x8,%esp
+  80311b:	50                   	push   %eax
+  80311c:	6a 00                	push   $0x0
+  80311e:	e8 83 e0 ff ff       	call   8011a6 <sys_page_unmap>
+}
+  803123:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803126:	c9                   	leave
+  803127:	c3                   	ret
+
+00803128 <_pipeisclosed>:
+{
+  803128:	55                   	push   %ebp
+  803129:	89 e5                	mov    %esp,%ebp
+  80312b:	57                   	push   %edi
+  80312c:	56                   	push   %esi
+  80312d:	53                   	push   %ebx
+  80312e:	83 ec 1c             	sub    $0x1c,%esp
+  803131:	89 c7                	mov    %eax,%edi
+  803133:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  803135:	a1 ac 60 80 00       	mov    0x8060ac,%eax
+  80313a:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80313d:	83 ec 0c             	sub    $0xc,%esp
+  803140:	57                   	push   %edi
+  803141:	e8 20 09 00 00       	call   803a66 <pageref>
+  803146:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803149:	89 34 24             	mov    %esi,(%esp)
+  80314c:	e8 15 09 00 00       	call   803a66 <pageref>
+		nn = thisenv->env_runs;
+  803151:	8b 15 ac 60 80 00    	mov    0x8060ac,%edx
+  803157:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80315a:	83 c4 10             	add    $0x10,%esp
+  80315d:	39 cb                	cmp    %ecx,%ebx
+  80315f:	74 1b                	je     80317c <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  803161:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803164:	75 cf                	jne    803135 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803166:	8b 42 58             	mov    0x58(%edx),%eax
+  803169:	6a 01                	push   $0x1
+  80316b:	50                   	push   %eax
+  80316c:	53                   	push   %ebx
+  80316d:	68 3d 43 80 00       	push   $0x80433d
+  803172:	e8 a8 d5 ff ff       	call   80071f <cprintf>
+  803177:	83 c4 10             	add    $0x10,%esp
+  80317a:	eb b9                	jmp    803135 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80317c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80317f:	0f 94 c0             	sete   %al
+  803182:	0f b6 c0             	movzbl %al,%eax
+}
+  803185:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803188:	5b                   	pop    %ebx
+  803189:	5e                   	pop    %esi
+  80318a:	5f                   	pop    %edi
+  80318b:	5d                   	pop    %ebp
+  80318c:	c3                   	ret
+
+0080318d <devpipe_write>:
+{
+  80318d:	55                   	push   %ebp
+  80318e:	89 e5                	mov    %esp,%ebp
+  803190:	57                   	push   %edi
+  803191:	56                   	push   %esi
+  803192:	53                   	push   %ebx
+  803193:	83 ec 28             	sub    $0x28,%esp
+  803196:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  803199:	56                   	push   %esi
+  80319a:	e8 24 e4 ff ff       	call   8015c3 <fd2data>
+  80319f:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8031a1:	83 c4 10             	add    $0x10,%esp
+  8031a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031a9:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8031ac:	75 09                	jne    8031b7 <devpipe_write+0x2a>
+	return i;
+  8031ae:	89 f8                	mov    %edi,%eax
+  8031b0:	eb 23                	jmp    8031d5 <devpipe_write+0x48>
+			sys_yield();
+  8031b2:	e8 43 df ff ff       	call   8010fa <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8031b7:	8b 43 04             	mov    0x4(%ebx),%eax
+  8031ba:	8b 0b                	mov    (%ebx),%ecx
+  8031bc:	8d 51 20             	lea    0x20(%ecx),%edx
+  8031bf:	39 d0                	cmp    %edx,%eax
+  8031c1:	72 1a                	jb     8031dd <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8031c3:	89 da                	mov    %ebx,%edx
+  8031c5:	89 f0                	mov    %esi,%eax
+  8031c7:	e8 5c ff ff ff       	call   803128 <_pipeisclosed>
+  8031cc:	85 c0                	test   %eax,%eax
+  8031ce:	74 e2                	je     8031b2 <devpipe_write+0x25>
+				return 0;
+  8031d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031d8:	5b                   	pop    %ebx
+  8031d9:	5e                   	pop    %esi
+  8031da:	5f                   	pop    %edi
+  8031db:	5d                   	pop    %ebp
+  8031dc:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8031dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031e0:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8031e4:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8031e7:	89 c2                	mov    %eax,%edx
+  8031e9:	c1 fa 1f             	sar    $0x1f,%edx
+  8031ec:	89 d1                	mov    %edx,%ecx
+  8031ee:	c1 e9 1b             	shr    $0x1b,%ecx
+  8031f1:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8031f4:	83 e2 1f             	and    $0x1f,%edx
+  8031f7:	29 ca                	sub    %ecx,%edx
+  8031f9:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8031fd:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803201:	83 c0 01             	add    $0x1,%eax
+  803204:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803207:	83 c7 01             	add    $0x1,%edi
+  80320a:	eb 9d                	jmp    8031a9 <devpipe_write+0x1c>
+
+0080320c <devpipe_read>:
+{
+  80320c:	55                   	push   %ebp
+  80320d:	89 e5                	mov    %esp,%ebp
+  80320f:	57                   	push   %edi
+  803210:	56                   	push   %esi
+  803211:	53                   	push   %ebx
+  803212:	83 ec 18             	sub    $0x18,%esp
+  803215:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803218:	57                   	push   %edi
+  803219:	e8 a5 e3 ff ff       	call   8015c3 <fd2data>
+  80321e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803220:	83 c4 10             	add    $0x10,%esp
+  803223:	be 00 00 00 00       	mov    $0x0,%esi
+  803228:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80322b:	75 13                	jne    803240 <devpipe_read+0x34>
+	return i;
+  80322d:	89 f0                	mov    %esi,%eax
+  80322f:	eb 02                	jmp    803233 <devpipe_read+0x27>
+				return i;
+  803231:	89 f0                	mov    %esi,%eax
+}
+  803233:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803236:	5b                   	pop    %ebx
+  803237:	5e                   	pop    %esi
+  803238:	5f                   	pop    %edi
+  803239:	5d                   	pop    %ebp
+  80323a:	c3                   	ret
+			sys_yield();
+  80323b:	e8 ba de ff ff       	call   8010fa <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803240:	8b 03                	mov    (%ebx),%eax
+  803242:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803245:	75 18                	jne    80325f <devpipe_read+0x53>
+			if (i > 0)
+  803247:	85 f6                	test   %esi,%esi
+  803249:	75 e6                	jne    803231 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80324b:	89 da                	mov    %ebx,%edx
+  80324d:	89 f8                	mov    %edi,%eax
+  80324f:	e8 d4 fe ff ff       	call   803128 <_pipeisclosed>
+  803254:	85 c0                	test   %eax,%eax
+  803256:	74 e3                	je     80323b <devpipe_read+0x2f>
+				return 0;
+  803258:	b8 00 00 00 00       	mov    $0x0,%eax
+  80325d:	eb d4                	jmp    803233 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80325f:	99                   	cltd
+  803260:	c1 ea 1b             	shr    $0x1b,%edx
+  803263:	01 d0                	add    %edx,%eax
+  803265:	83 e0 1f             	and    $0x1f,%eax
+  803268:	29 d0                	sub    %edx,%eax
+  80326a:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80326f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803272:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803275:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803278:	83 c6 01             	add    $0x1,%esi
+  80327b:	eb ab                	jmp    803228 <devpipe_read+0x1c>
+
+0080327d <pipe>:
+{
+  80327d:	55                   	push   %ebp
+  80327e:	89 e5                	mov    %esp,%ebp
+  803280:	56                   	push   %esi
+  803281:	53                   	push   %ebx
+  803282:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803285:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803288:	50                   	push   %eax
+  803289:	e8 4c e3 ff ff       	call   8015da <fd_alloc>
+  80328e:	89 c3                	mov    %eax,%ebx
+  803290:	83 c4 10             	add    $0x10,%esp
+  803293:	85 c0                	test   %eax,%eax
+  803295:	0f 88 23 01 00 00    	js     8033be <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80329b:	83 ec 04             	sub    $0x4,%esp
+  80329e:	68 07 04 00 00       	push   $0x407
+  8032a3:	ff 75 f4             	push   -0xc(%ebp)
+  8032a6:	6a 00                	push   $0x0
+  8032a8:	e8 6c de ff ff       	call   801119 <sys_page_alloc>
+  8032ad:	89 c3                	mov    %eax,%ebx
+  8032af:	83 c4 10             	add    $0x10,%esp
+  8032b2:	85 c0                	test   %eax,%eax
+  8032b4:	0f 88 04 01 00 00    	js     8033be <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8032ba:	83 ec 0c             	sub    $0xc,%esp
+  8032bd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8032c0:	50                   	push   %eax
+  8032c1:	e8 14 e3 ff ff       	call   8015da <fd_alloc>
+  8032c6:	89 c3                	mov    %eax,%ebx
+  8032c8:	83 c4 10             	add    $0x10,%esp
+  8032cb:	85 c0                	test   %eax,%eax
+  8032cd:	0f 88 db 00 00 00    	js     8033ae <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032d3:	83 ec 04             	sub    $0x4,%esp
+  8032d6:	68 07 04 00 00       	push   $0x407
+  8032db:	ff 75 f0             	push   -0x10(%ebp)
+  8032de:	6a 00                	push   $0x0
+  8032e0:	e8 34 de ff ff       	call   801119 <sys_page_alloc>
+  8032e5:	89 c3                	mov    %eax,%ebx
+  8032e7:	83 c4 10             	add    $0x10,%esp
+  8032ea:	85 c0                	test   %eax,%eax
+  8032ec:	0f 88 bc 00 00 00    	js     8033ae <pipe+0x131>
+	va = fd2data(fd0);
+  8032f2:	83 ec 0c             	sub    $0xc,%esp
+  8032f5:	ff 75 f4             	push   -0xc(%ebp)
+  8032f8:	e8 c6 e2 ff ff       	call   8015c3 <fd2data>
+  8032fd:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032ff:	83 c4 0c             	add    $0xc,%esp
+  803302:	68 07 04 00 00       	push   $0x407
+  803307:	50                   	push   %eax
+  803308:	6a 00                	push   $0x0
+  80330a:	e8 0a de ff ff       	call   801119 <sys_page_alloc>
+  80330f:	89 c3                	mov    %eax,%ebx
+  803311:	83 c4 10             	add    $0x10,%esp
+  803314:	85 c0                	test   %eax,%eax
+  803316:	0f 88 82 00 00 00    	js     80339e <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80331c:	83 ec 0c             	sub    $0xc,%esp
+  80331f:	ff 75 f0             	push   -0x10(%ebp)
+  803322:	e8 9c e2 ff ff       	call   8015c3 <fd2data>
+  803327:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80332e:	50                   	push   %eax
+  80332f:	6a 00                	push   $0x0
+  803331:	56                   	push   %esi
+  803332:	6a 00                	push   $0x0
+  803334:	e8 2b de ff ff       	call   801164 <sys_page_map>
+  803339:	89 c3                	mov    %eax,%ebx
+  80333b:	83 c4 20             	add    $0x20,%esp
+  80333e:	85 c0                	test   %eax,%eax
+  803340:	78 4e                	js     803390 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803342:	a1 60 50 80 00       	mov    0x805060,%eax
+  803347:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80334a:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80334c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80334f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803356:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803359:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80335b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80335e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803365:	83 ec 0c             	sub    $0xc,%esp
+  803368:	ff 75 f4             	push   -0xc(%ebp)
+  80336b:	e8 43 e2 ff ff       	call   8015b3 <fd2num>
+  803370:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803373:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803375:	83 c4 04             	add    $0x4,%esp
+  803378:	ff 75 f0             	push   -0x10(%ebp)
+  80337b:	e8 33 e2 ff ff       	call   8015b3 <fd2num>
+  803380:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803383:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803386:	83 c4 10             	add    $0x10,%esp
+  803389:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80338e:	eb 2e                	jmp    8033be <pipe+0x141>
+	sys_page_unmap(0, va);
+  803390:	83 ec 08             	sub    $0x8,%esp
+  803393:	56                   	push   %esi
+  803394:	6a 00                	push   $0x0
+  803396:	e8 0b de ff ff       	call   8011a6 <sys_page_unmap>
+  80339b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80339e:	83 ec 08             	sub    $0x8,%esp
+  8033a1:	ff 75 f0             	push   -0x10(%ebp)
+  8033a4:	6a 00                	push   $0x0
+  8033a6:	e8 fb dd ff ff       	call   8011a6 <sys_page_unmap>
+  8033ab:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8033ae:	83 ec 08             	sub    $0x8,%esp
+  8033b1:	ff 75 f4             	push   -0xc(%ebp)
+  8033b4:	6a 00                	push   $0x0
+  8033b6:	e8 eb dd ff ff       	call   8011a6 <sys_page_unmap>
+  8033bb:	83 c4 10             	add    $0x10,%esp
+}
+  8033be:	89 d8                	mov    %ebx,%eax
+  8033c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033c3:	5b                   	pop    %ebx
+  8033c4:	5e                   	pop    %esi
+  8033c5:	5d                   	pop    %ebp
+  8033c6:	c3                   	ret
+
+008033c7 <pipeisclosed>:
+{
+  8033c7:	55                   	push   %ebp
+  8033c8:	89 e5                	mov    %esp,%ebp
+  8033ca:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033d0:	50                   	push   %eax
+  8033d1:	ff 75 08             	push   0x8(%ebp)
+  8033d4:	e8 57 e2 ff ff       	call   801630 <fd_lookup>
+  8033d9:	83 c4 10             	add    $0x10,%esp
+  8033dc:	85 c0                	test   %eax,%eax
+  8033de:	78 18                	js     8033f8 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8033e0:	83 ec 0c             	sub    $0xc,%esp
+  8033e3:	ff 75 f4             	push   -0xc(%ebp)
+  8033e6:	e8 d8 e1 ff ff       	call   8015c3 <fd2data>
+  8033eb:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8033ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033f0:	e8 33 fd ff ff       	call   803128 <_pipeisclosed>
+  8033f5:	83 c4 10             	add    $0x10,%esp
+}
+  8033f8:	c9                   	leave
+  8033f9:	c3                   	ret
+
+008033fa <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8033fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ff:	c3                   	ret
+
+00803400 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803400:	55                   	push   %ebp
+  803401:	89 e5                	mov    %esp,%ebp
+  803403:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803406:	68 55 43 80 00       	push   $0x804355
+  80340b:	ff 75 0c             	push   0xc(%ebp)
+  80340e:	e8 fa d8 ff ff       	call   800d0d <strcpy>
+	return 0;
+}
+  803413:	b8 00 00 00 00       	mov    $0x0,%eax
+  803418:	c9                   	leave
+  803419:	c3                   	ret
+
+0080341a <devcons_write>:
+{
+  80341a:	55                   	push   %ebp
+  80341b:	89 e5                	mov    %esp,%ebp
+  80341d:	57                   	push   %edi
+  80341e:	56                   	push   %esi
+  80341f:	53                   	push   %ebx
+  803420:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803426:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80342b:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803431:	eb 2e                	jmp    803461 <devcons_write+0x47>
+		m = n - tot;
+  803433:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803436:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803438:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80343d:	39 c3                	cmp    %eax,%ebx
+  80343f:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803442:	83 ec 04             	sub    $0x4,%esp
+  803445:	53                   	push   %ebx
+  803446:	89 f0                	mov    %esi,%eax
+  803448:	03 45 0c             	add    0xc(%ebp),%eax
+  80344b:	50                   	push   %eax
+  80344c:	57                   	push   %edi
+  80344d:	e8 41 da ff ff       	call   800e93 <memmove>
+		sys_cputs(buf, m);
+  803452:	83 c4 08             	add    $0x8,%esp
+  803455:	53                   	push   %ebx
+  803456:	57                   	push   %edi
+  803457:	e8 e1 db ff ff       	call   80103d <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80345c:	01 de                	add    %ebx,%esi
+  80345e:	83 c4 10             	add    $0x10,%esp
+  803461:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803464:	72 cd                	jb     803433 <devcons_write+0x19>
+}
+  803466:	89 f0                	mov    %esi,%eax
+  803468:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80346b:	5b                   	pop    %ebx
+  80346c:	5e                   	pop    %esi
+  80346d:	5f                   	pop    %edi
+  80346e:	5d                   	pop    %ebp
+  80346f:	c3                   	ret
+
+00803470 <devcons_read>:
+{
+  803470:	55                   	push   %ebp
+  803471:	89 e5                	mov    %esp,%ebp
+  803473:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803476:	b8 00 00 00 00       	mov    $0x0,%eax
+  80347b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80347f:	75 07                	jne    803488 <devcons_read+0x18>
+  803481:	eb 1f                	jmp    8034a2 <devcons_read+0x32>
+		sys_yield();
+  803483:	e8 72 dc ff ff       	call   8010fa <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803488:	e8 d6 db ff ff       	call   801063 <sys_cgetc>
+  80348d:	85 c0                	test   %eax,%eax
+  80348f:	74 f2                	je     803483 <devcons_read+0x13>
+	if (c < 0)
+  803491:	78 0f                	js     8034a2 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803493:	83 f8 04             	cmp    $0x4,%eax
+  803496:	74 0c                	je     8034a4 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803498:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80349b:	88 02                	mov    %al,(%edx)
+	return 1;
+  80349d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8034a2:	c9                   	leave
+  8034a3:	c3                   	ret
+		return 0;
+  8034a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034a9:	eb f7                	jmp    8034a2 <devcons_read+0x32>
+
+008034ab <cputchar>:
+{
+  8034ab:	55                   	push   %ebp
+  8034ac:	89 e5                	mov    %esp,%ebp
+  8034ae:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8034b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034b4:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8034b7:	6a 01                	push   $0x1
+  8034b9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034bc:	50                   	push   %eax
+  8034bd:	e8 7b db ff ff       	call   80103d <sys_cputs>
+}
+  8034c2:	83 c4 10             	add    $0x10,%esp
+  8034c5:	c9                   	leave
+  8034c6:	c3                   	ret
+
+008034c7 <getchar>:
+{
+  8034c7:	55                   	push   %ebp
+  8034c8:	89 e5                	mov    %esp,%ebp
+  8034ca:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8034cd:	6a 01                	push   $0x1
+  8034cf:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034d2:	50                   	push   %eax
+  8034d3:	6a 00                	push   $0x0
+  8034d5:	e8 bc e3 ff ff       	call   801896 <read>
+	if (r < 0)
+  8034da:	83 c4 10             	add    $0x10,%esp
+  8034dd:	85 c0                	test   %eax,%eax
+  8034df:	78 06                	js     8034e7 <getchar+0x20>
+	if (r < 1)
+  8034e1:	74 06                	je     8034e9 <getchar+0x22>
+	return c;
+  8034e3:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8034e7:	c9                   	leave
+  8034e8:	c3                   	ret
+		return -E_EOF;
+  8034e9:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8034ee:	eb f7                	jmp    8034e7 <getchar+0x20>
+
+008034f0 <iscons>:
+{
+  8034f0:	55                   	push   %ebp
+  8034f1:	89 e5                	mov    %esp,%ebp
+  8034f3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8034f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034f9:	50                   	push   %eax
+  8034fa:	ff 75 08             	push   0x8(%ebp)
+  8034fd:	e8 2e e1 ff ff       	call   801630 <fd_lookup>
+  803502:	83 c4 10             	add    $0x10,%esp
+  803505:	85 c0                	test   %eax,%eax
+  803507:	78 11                	js     80351a <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803509:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80350c:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803512:	39 10                	cmp    %edx,(%eax)
+  803514:	0f 94 c0             	sete   %al
+  803517:	0f b6 c0             	movzbl %al,%eax
+}
+  80351a:	c9                   	leave
+  80351b:	c3                   	ret
+
+0080351c <opencons>:
+{
+  80351c:	55                   	push   %ebp
+  80351d:	89 e5                	mov    %esp,%ebp
+  80351f:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803522:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803525:	50                   	push   %eax
+  803526:	e8 af e0 ff ff       	call   8015da <fd_alloc>
+  80352b:	83 c4 10             	add    $0x10,%esp
+  80352e:	85 c0                	test   %eax,%eax
+  803530:	78 3a                	js     80356c <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803532:	83 ec 04             	sub    $0x4,%esp
+  803535:	68 07 04 00 00       	push   $0x407
+  80353a:	ff 75 f4             	push   -0xc(%ebp)
+  80353d:	6a 00                	push   $0x0
+  80353f:	e8 d5 db ff ff       	call   801119 <sys_page_alloc>
+  803544:	83 c4 10             	add    $0x10,%esp
+  803547:	85 c0                	test   %eax,%eax
+  803549:	78 21                	js     80356c <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80354b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80354e:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803554:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803556:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803559:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803560:	83 ec 0c             	sub    $0xc,%esp
+  803563:	50                   	push   %eax
+  803564:	e8 4a e0 ff ff       	call   8015b3 <fd2num>
+  803569:	83 c4 10             	add    $0x10,%esp
+}
+  80356c:	c9                   	leave
+  80356d:	c3                   	ret
+
+0080356e <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  80356e:	55                   	push   %ebp
+  80356f:	89 e5                	mov    %esp,%ebp
+  803571:	57                   	push   %edi
+  803572:	56                   	push   %esi
+  803573:	53                   	push   %ebx
+  803574:	83 ec 20             	sub    $0x20,%esp
+  803577:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80357a:	89 d7                	mov    %edx,%edi
+  80357c:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  80357e:	51                   	push   %ecx
+  80357f:	68 00 f0 7f 00       	push   $0x7ff000
+  803584:	6a 00                	push   $0x0
+  803586:	e8 8e db ff ff       	call   801119 <sys_page_alloc>
+  80358b:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80358d:	83 c4 10             	add    $0x10,%esp
+  803590:	85 c0                	test   %eax,%eax
+  803592:	78 45                	js     8035d9 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  803594:	83 ec 04             	sub    $0x4,%esp
+  803597:	68 00 10 00 00       	push   $0x1000
+  80359c:	57                   	push   %edi
+  80359d:	68 00 f0 7f 00       	push   $0x7ff000
+  8035a2:	e8 ec d8 ff ff       	call   800e93 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8035a7:	89 34 24             	mov    %esi,(%esp)
+  8035aa:	57                   	push   %edi
+  8035ab:	ff 75 e4             	push   -0x1c(%ebp)
+  8035ae:	68 00 f0 7f 00       	push   $0x7ff000
+  8035b3:	6a 00                	push   $0x0
+  8035b5:	e8 aa db ff ff       	call   801164 <sys_page_map>
+  8035ba:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8035bc:	83 c4 20             	add    $0x20,%esp
+  8035bf:	85 c0                	test   %eax,%eax
+  8035c1:	78 16                	js     8035d9 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8035c3:	83 ec 08             	sub    $0x8,%esp
+  8035c6:	68 00 f0 7f 00       	push   $0x7ff000
+  8035cb:	6a 00                	push   $0x0
+  8035cd:	e8 d4 db ff ff       	call   8011a6 <sys_page_unmap>
+  8035d2:	83 c4 10             	add    $0x10,%esp
+  8035d5:	85 c0                	test   %eax,%eax
+  8035d7:	75 0a                	jne    8035e3 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8035d9:	89 d8                	mov    %ebx,%eax
+  8035db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035de:	5b                   	pop    %ebx
+  8035df:	5e                   	pop    %esi
+  8035e0:	5f                   	pop    %edi
+  8035e1:	5d                   	pop    %ebp
+  8035e2:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8035e3:	68 64 43 80 00       	push   $0x804364
+  8035e8:	68 ec 41 80 00       	push   $0x8041ec
+  8035ed:	6a 1b                	push   $0x1b
+  8035ef:	68 dc 43 80 00       	push   $0x8043dc
+  8035f4:	e8 4b d0 ff ff       	call   800644 <_panic>
+
+008035f9 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8035f9:	55                   	push   %ebp
+  8035fa:	89 e5                	mov    %esp,%ebp
+  8035fc:	53                   	push   %ebx
+  8035fd:	83 ec 04             	sub    $0x4,%esp
+  803600:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803603:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803605:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  803609:	74 21                	je     80362c <pgfault+0x33>
+  80360b:	89 d0                	mov    %edx,%eax
+  80360d:	c1 e8 16             	shr    $0x16,%eax
+  803610:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803617:	a8 01                	test   $0x1,%al
+  803619:	74 11                	je     80362c <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  80361b:	89 d0                	mov    %edx,%eax
+  80361d:	c1 e8 0c             	shr    $0xc,%eax
+  803620:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803627:	f6 c4 08             	test   $0x8,%ah
+  80362a:	75 17                	jne    803643 <pgfault+0x4a>
+		if (pgfault_next) {
+  80362c:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  803631:	85 c0                	test   %eax,%eax
+  803633:	74 27                	je     80365c <pgfault+0x63>
+			pgfault_next(utf);
+  803635:	83 ec 0c             	sub    $0xc,%esp
+  803638:	53                   	push   %ebx
+  803639:	ff d0                	call   *%eax
+			return;
+  80363b:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  80363e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803641:	c9                   	leave
+  803642:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803643:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803649:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80364e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803653:	e8 16 ff ff ff       	call   80356e <copy_page_to>
+  803658:	85 c0                	test   %eax,%eax
+  80365a:	79 e2                	jns    80363e <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  80365c:	a1 ac 60 80 00       	mov    0x8060ac,%eax
+  803661:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803664:	ff 73 28             	push   0x28(%ebx)
+  803667:	ff 33                	push   (%ebx)
+  803669:	50                   	push   %eax
+  80366a:	68 88 43 80 00       	push   $0x804388
+  80366f:	e8 ab d0 ff ff       	call   80071f <cprintf>
+	sys_env_destroy(0);
+  803674:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80367b:	e8 0a da ff ff       	call   80108a <sys_env_destroy>
+  803680:	83 c4 10             	add    $0x10,%esp
+  803683:	eb b9                	jmp    80363e <pgfault+0x45>
+
+00803685 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803685:	55                   	push   %ebp
+  803686:	89 e5                	mov    %esp,%ebp
+  803688:	53                   	push   %ebx
+  803689:	83 ec 04             	sub    $0x4,%esp
+  80368c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80368f:	a1 b0 60 80 00       	mov    0x8060b0,%eax
+  803694:	3d f9 35 80 00       	cmp    $0x8035f9,%eax
+  803699:	74 15                	je     8036b0 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80369b:	a3 04 a0 80 00       	mov    %eax,0x80a004
+		set_pgfault_handler(pgfault);
+  8036a0:	83 ec 0c             	sub    $0xc,%esp
+  8036a3:	68 f9 35 80 00       	push   $0x8035f9
+  8036a8:	e8 6d de ff ff       	call   80151a <set_pgfault_handler>
+  8036ad:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8036b0:	83 ec 0c             	sub    $0xc,%esp
+  8036b3:	68 05 08 00 00       	push   $0x805
+  8036b8:	53                   	push   %ebx
+  8036b9:	6a 00                	push   $0x0
+  8036bb:	53                   	push   %ebx
+  8036bc:	6a 00                	push   $0x0
+  8036be:	e8 a1 da ff ff       	call   801164 <sys_page_map>
+}
+  8036c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036c6:	c9                   	leave
+  8036c7:	c3                   	ret
+
+008036c8 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8036c8:	55                   	push   %ebp
+  8036c9:	89 e5                	mov    %esp,%ebp
+  8036cb:	57                   	push   %edi
+  8036cc:	56                   	push   %esi
+  8036cd:	53                   	push   %ebx
+  8036ce:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8036d1:	68 f9 35 80 00       	push   $0x8035f9
+  8036d6:	e8 3f de ff ff       	call   80151a <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8036db:	b8 07 00 00 00       	mov    $0x7,%eax
+  8036e0:	cd 30                	int    $0x30
+  8036e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8036e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8036e8:	83 c4 10             	add    $0x10,%esp
+  8036eb:	85 c0                	test   %eax,%eax
+  8036ed:	0f 88 6b 01 00 00    	js     80385e <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8036f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8036f8:	75 37                	jne    803731 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8036fa:	e8 d4 d9 ff ff       	call   8010d3 <sys_getenvid>
+  8036ff:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803704:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80370a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80370f:	a3 ac 60 80 00       	mov    %eax,0x8060ac
+		return 0;
+  803714:	e9 45 01 00 00       	jmp    80385e <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803719:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80371f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803725:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80372b:	0f 87 ba 00 00 00    	ja     8037eb <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803731:	89 d8                	mov    %ebx,%eax
+  803733:	c1 e8 16             	shr    $0x16,%eax
+  803736:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80373d:	a8 01                	test   $0x1,%al
+  80373f:	74 d8                	je     803719 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803741:	89 d8                	mov    %ebx,%eax
+  803743:	c1 e8 0c             	shr    $0xc,%eax
+  803746:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80374d:	f6 c2 01             	test   $0x1,%dl
+  803750:	74 cd                	je     80371f <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803752:	89 da                	mov    %ebx,%edx
+  803754:	80 e6 df             	and    $0xdf,%dh
+  803757:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  80375d:	74 c0                	je     80371f <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  80375f:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803761:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803768:	f6 c6 04             	test   $0x4,%dh
+  80376b:	75 53                	jne    8037c0 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80376d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803774:	f6 c6 08             	test   $0x8,%dh
+  803777:	75 0c                	jne    803785 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803779:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803780:	f6 c2 02             	test   $0x2,%dl
+  803783:	74 3b                	je     8037c0 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803785:	83 ec 0c             	sub    $0xc,%esp
+  803788:	68 05 08 00 00       	push   $0x805
+  80378d:	57                   	push   %edi
+  80378e:	ff 75 e4             	push   -0x1c(%ebp)
+  803791:	57                   	push   %edi
+  803792:	6a 00                	push   $0x0
+  803794:	e8 cb d9 ff ff       	call   801164 <sys_page_map>
+  803799:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80379b:	83 c4 20             	add    $0x20,%esp
+  80379e:	85 c0                	test   %eax,%eax
+  8037a0:	0f 88 a7 00 00 00    	js     80384d <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8037a6:	83 ec 0c             	sub    $0xc,%esp
+  8037a9:	68 05 08 00 00       	push   $0x805
+  8037ae:	57                   	push   %edi
+  8037af:	6a 00                	push   $0x0
+  8037b1:	57                   	push   %edi
+  8037b2:	6a 00                	push   $0x0
+  8037b4:	e8 ab d9 ff ff       	call   801164 <sys_page_map>
+  8037b9:	89 c6                	mov    %eax,%esi
+	return r;
+  8037bb:	83 c4 20             	add    $0x20,%esp
+  8037be:	eb 21                	jmp    8037e1 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8037c0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8037c7:	83 ec 0c             	sub    $0xc,%esp
+  8037ca:	25 07 0e 00 00       	and    $0xe07,%eax
+  8037cf:	50                   	push   %eax
+  8037d0:	57                   	push   %edi
+  8037d1:	ff 75 e4             	push   -0x1c(%ebp)
+  8037d4:	57                   	push   %edi
+  8037d5:	6a 00                	push   $0x0
+  8037d7:	e8 88 d9 ff ff       	call   801164 <sys_page_map>
+  8037dc:	89 c6                	mov    %eax,%esi
+  8037de:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8037e1:	85 f6                	test   %esi,%esi
+  8037e3:	0f 89 36 ff ff ff    	jns    80371f <fork+0x57>
+  8037e9:	eb 62                	jmp    80384d <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8037eb:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8037f0:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8037f5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8037f8:	89 f8                	mov    %edi,%eax
+  8037fa:	e8 6f fd ff ff       	call   80356e <copy_page_to>
+  8037ff:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803801:	85 c0                	test   %eax,%eax
+  803803:	78 48                	js     80384d <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803805:	83 ec 04             	sub    $0x4,%esp
+  803808:	6a 07                	push   $0x7
+  80380a:	68 00 f0 bf ee       	push   $0xeebff000
+  80380f:	57                   	push   %edi
+  803810:	e8 04 d9 ff ff       	call   801119 <sys_page_alloc>
+  803815:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803817:	83 c4 10             	add    $0x10,%esp
+  80381a:	85 c0                	test   %eax,%eax
+  80381c:	78 2f                	js     80384d <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  80381e:	a1 ac 60 80 00       	mov    0x8060ac,%eax
+  803823:	8b 40 64             	mov    0x64(%eax),%eax
+  803826:	83 ec 08             	sub    $0x8,%esp
+  803829:	50                   	push   %eax
+  80382a:	57                   	push   %edi
+  80382b:	e8 54 da ff ff       	call   801284 <sys_env_set_pgfault_upcall>
+  803830:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803832:	83 c4 10             	add    $0x10,%esp
+  803835:	85 c0                	test   %eax,%eax
+  803837:	78 14                	js     80384d <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803839:	83 ec 08             	sub    $0x8,%esp
+  80383c:	6a 02                	push   $0x2
+  80383e:	57                   	push   %edi
+  80383f:	e8 ac d9 ff ff       	call   8011f0 <sys_env_set_status>
+  803844:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803846:	83 c4 10             	add    $0x10,%esp
+  803849:	85 c0                	test   %eax,%eax
+  80384b:	79 11                	jns    80385e <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  80384d:	83 ec 0c             	sub    $0xc,%esp
+  803850:	ff 75 e0             	push   -0x20(%ebp)
+  803853:	e8 32 d8 ff ff       	call   80108a <sys_env_destroy>
+	return r;
+  803858:	83 c4 10             	add    $0x10,%esp
+  80385b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  80385e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803861:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803864:	5b                   	pop    %ebx
+  803865:	5e                   	pop    %esi
+  803866:	5f                   	pop    %edi
+  803867:	5d                   	pop    %ebp
+  803868:	c3                   	ret
+
+00803869 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803869:	55                   	push   %ebp
+  80386a:	89 e5                	mov    %esp,%ebp
+  80386c:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80386f:	68 e7 43 80 00       	push   $0x8043e7
+  803874:	68 bf 00 00 00       	push   $0xbf
+  803879:	68 dc 43 80 00       	push   $0x8043dc
+  80387e:	e8 c1 cd ff ff       	call   800644 <_panic>
+
+00803883 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803883:	55                   	push   %ebp
+  803884:	89 e5                	mov    %esp,%ebp
+  803886:	56                   	push   %esi
+  803887:	53                   	push   %ebx
+  803888:	8b 75 08             	mov    0x8(%ebp),%esi
+  80388b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80388e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803891:	85 c0                	test   %eax,%eax
+  803893:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803898:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80389b:	83 ec 0c             	sub    $0xc,%esp
+  80389e:	50                   	push   %eax
+  80389f:	e8 bd da ff ff       	call   801361 <sys_ipc_recv>
+	if (from_env_store)
+  8038a4:	83 c4 10             	add    $0x10,%esp
+  8038a7:	85 f6                	test   %esi,%esi
+  8038a9:	74 14                	je     8038bf <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8038ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038b0:	85 c0                	test   %eax,%eax
+  8038b2:	75 09                	jne    8038bd <ipc_recv+0x3a>
+  8038b4:	8b 15 ac 60 80 00    	mov    0x8060ac,%edx
+  8038ba:	8b 52 74             	mov    0x74(%edx),%edx
+  8038bd:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8038bf:	85 db                	test   %ebx,%ebx
+  8038c1:	74 25                	je     8038e8 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8038c3:	85 c0                	test   %eax,%eax
+  8038c5:	74 0d                	je     8038d4 <ipc_recv+0x51>
+  8038c7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8038cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8038d0:	5b                   	pop    %ebx
+  8038d1:	5e                   	pop    %esi
+  8038d2:	5d                   	pop    %ebp
+  8038d3:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8038d4:	a1 ac 60 80 00       	mov    0x8060ac,%eax
+  8038d9:	8b 40 78             	mov    0x78(%eax),%eax
+  8038dc:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8038de:	a1 ac 60 80 00       	mov    0x8060ac,%eax
+  8038e3:	8b 40 70             	mov    0x70(%eax),%eax
+  8038e6:	eb e5                	jmp    8038cd <ipc_recv+0x4a>
+  8038e8:	85 c0                	test   %eax,%eax
+  8038ea:	75 e1                	jne    8038cd <ipc_recv+0x4a>
+  8038ec:	eb f0                	jmp    8038de <ipc_recv+0x5b>
+
+008038ee <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8038ee:	55                   	push   %ebp
+  8038ef:	89 e5                	mov    %esp,%ebp
+  8038f1:	57                   	push   %edi
+  8038f2:	56                   	push   %esi
+  8038f3:	53                   	push   %ebx
+  8038f4:	83 ec 0c             	sub    $0xc,%esp
+  8038f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8038fa:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8038fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803900:	85 db                	test   %ebx,%ebx
+  803902:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803907:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80390a:	ff 75 14             	push   0x14(%ebp)
+  80390d:	53                   	push   %ebx
+  80390e:	56                   	push   %esi
+  80390f:	57                   	push   %edi
+  803910:	e8 b9 d9 ff ff       	call   8012ce <sys_ipc_try_send>
+  803915:	83 c4 10             	add    $0x10,%esp
+  803918:	85 c0                	test   %eax,%eax
+  80391a:	74 22                	je     80393e <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  80391c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80391f:	75 07                	jne    803928 <ipc_send+0x3a>
+		sys_yield();
+  803921:	e8 d4 d7 ff ff       	call   8010fa <sys_yield>
+  803926:	eb e2                	jmp    80390a <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803928:	68 fd 43 80 00       	push   $0x8043fd
+  80392d:	68 ec 41 80 00       	push   $0x8041ec
+  803932:	6a 39                	push   $0x39
+  803934:	68 12 44 80 00       	push   $0x804412
+  803939:	e8 06 cd ff ff       	call   800644 <_panic>
+	}
+}
+  80393e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803941:	5b                   	pop    %ebx
+  803942:	5e                   	pop    %esi
+  803943:	5f                   	pop    %edi
+  803944:	5d                   	pop    %ebp
+  803945:	c3                   	ret
+
+00803946 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803946:	55                   	push   %ebp
+  803947:	89 e5                	mov    %esp,%ebp
+  803949:	57                   	push   %edi
+  80394a:	56                   	push   %esi
+  80394b:	53                   	push   %ebx
+  80394c:	83 ec 10             	sub    $0x10,%esp
+  80394f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803952:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803955:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803958:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80395b:	85 c0                	test   %eax,%eax
+  80395d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803962:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803965:	6a 00                	push   $0x0
+  803967:	ff 33                	push   (%ebx)
+  803969:	50                   	push   %eax
+  80396a:	e8 af d9 ff ff       	call   80131e <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80396f:	83 c4 10             	add    $0x10,%esp
+  803972:	85 c0                	test   %eax,%eax
+  803974:	75 3c                	jne    8039b2 <ipc_recvv+0x6c>
+  803976:	8b 15 ac 60 80 00    	mov    0x8060ac,%edx
+  80397c:	8b 52 7c             	mov    0x7c(%edx),%edx
+  80397f:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803981:	85 ff                	test   %edi,%edi
+  803983:	74 4e                	je     8039d3 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803985:	8b 15 ac 60 80 00    	mov    0x8060ac,%edx
+  80398b:	8b 52 74             	mov    0x74(%edx),%edx
+  80398e:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803990:	85 f6                	test   %esi,%esi
+  803992:	74 18                	je     8039ac <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803994:	85 c0                	test   %eax,%eax
+  803996:	75 2d                	jne    8039c5 <ipc_recvv+0x7f>
+  803998:	a1 ac 60 80 00       	mov    0x8060ac,%eax
+  80399d:	8b 40 78             	mov    0x78(%eax),%eax
+  8039a0:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8039a2:	a1 ac 60 80 00       	mov    0x8060ac,%eax
+  8039a7:	8b 40 70             	mov    0x70(%eax),%eax
+  8039aa:	eb 1f                	jmp    8039cb <ipc_recvv+0x85>
+  8039ac:	85 c0                	test   %eax,%eax
+  8039ae:	75 1b                	jne    8039cb <ipc_recvv+0x85>
+  8039b0:	eb f0                	jmp    8039a2 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8039b2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8039b8:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8039bd:	85 ff                	test   %edi,%edi
+  8039bf:	75 cd                	jne    80398e <ipc_recvv+0x48>
+	if (perm_store)
+  8039c1:	85 f6                	test   %esi,%esi
+  8039c3:	74 e7                	je     8039ac <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8039c5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8039cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039ce:	5b                   	pop    %ebx
+  8039cf:	5e                   	pop    %esi
+  8039d0:	5f                   	pop    %edi
+  8039d1:	5d                   	pop    %ebp
+  8039d2:	c3                   	ret
+	if (perm_store)
+  8039d3:	85 f6                	test   %esi,%esi
+  8039d5:	75 bd                	jne    803994 <ipc_recvv+0x4e>
+  8039d7:	eb c9                	jmp    8039a2 <ipc_recvv+0x5c>
+
+008039d9 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8039d9:	55                   	push   %ebp
+  8039da:	89 e5                	mov    %esp,%ebp
+  8039dc:	57                   	push   %edi
+  8039dd:	56                   	push   %esi
+  8039de:	53                   	push   %ebx
+  8039df:	83 ec 0c             	sub    $0xc,%esp
+  8039e2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8039e5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8039e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8039eb:	ff 75 14             	push   0x14(%ebp)
+  8039ee:	53                   	push   %ebx
+  8039ef:	56                   	push   %esi
+  8039f0:	57                   	push   %edi
+  8039f1:	e8 00 d9 ff ff       	call   8012f6 <sys_ipc_try_sendv>
+  8039f6:	83 c4 10             	add    $0x10,%esp
+  8039f9:	85 c0                	test   %eax,%eax
+  8039fb:	74 22                	je     803a1f <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8039fd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803a00:	75 07                	jne    803a09 <ipc_sendv+0x30>
+		sys_yield();
+  803a02:	e8 f3 d6 ff ff       	call   8010fa <sys_yield>
+  803a07:	eb e2                	jmp    8039eb <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803a09:	68 fd 43 80 00       	push   $0x8043fd
+  803a0e:	68 ec 41 80 00       	push   $0x8041ec
+  803a13:	6a 5c                	push   $0x5c
+  803a15:	68 12 44 80 00       	push   $0x804412
+  803a1a:	e8 25 cc ff ff       	call   800644 <_panic>
+	}
+}
+  803a1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a22:	5b                   	pop    %ebx
+  803a23:	5e                   	pop    %esi
+  803a24:	5f                   	pop    %edi
+  803a25:	5d                   	pop    %ebp
+  803a26:	c3                   	ret
+
+00803a27 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803a27:	55                   	push   %ebp
+  803a28:	89 e5                	mov    %esp,%ebp
+  803a2a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803a32:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803a38:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803a3e:	8b 52 50             	mov    0x50(%edx),%edx
+  803a41:	39 ca                	cmp    %ecx,%edx
+  803a43:	74 11                	je     803a56 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803a45:	83 c0 01             	add    $0x1,%eax
+  803a48:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803a4d:	75 e3                	jne    803a32 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a54:	eb 0e                	jmp    803a64 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803a56:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803a5c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a61:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803a64:	5d                   	pop    %ebp
+  803a65:	c3                   	ret
+
+00803a66 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803a66:	55                   	push   %ebp
+  803a67:	89 e5                	mov    %esp,%ebp
+  803a69:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803a6c:	89 c2                	mov    %eax,%edx
+  803a6e:	c1 ea 16             	shr    $0x16,%edx
+  803a71:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803a78:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803a7d:	f6 c1 01             	test   $0x1,%cl
+  803a80:	74 22                	je     803aa4 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803a82:	c1 e8 0c             	shr    $0xc,%eax
+  803a85:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803a8c:	a8 01                	test   $0x1,%al
+  803a8e:	74 14                	je     803aa4 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803a90:	c1 e8 0c             	shr    $0xc,%eax
+  803a93:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803a96:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803a9d:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803aa1:	0f b7 d2             	movzwl %dx,%edx
+}
+  803aa4:	89 d0                	mov    %edx,%eax
+  803aa6:	5d                   	pop    %ebp
+  803aa7:	c3                   	ret
+
+00803aa8 <dm>:
+  803aa8:	55                   	push   %ebp
+  803aa9:	57                   	push   %edi
+  803aaa:	56                   	push   %esi
+  803aab:	53                   	push   %ebx
+  803aac:	83 ec 24             	sub    $0x24,%esp
+  803aaf:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803ab3:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803ab7:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803abb:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803abf:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803ac3:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803ac7:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803acb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad5:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ada:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803ae1:	00 
+  803ae2:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803ae9:	00 
+  803aea:	89 fb                	mov    %edi,%ebx
+  803aec:	eb 08                	jmp    803af6 <dm+0x4e>
+  803aee:	83 e9 01             	sub    $0x1,%ecx
+  803af1:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803af4:	74 68                	je     803b5e <dm+0xb6>
+  803af6:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803afa:	01 c0                	add    %eax,%eax
+  803afc:	89 c6                	mov    %eax,%esi
+  803afe:	89 d7                	mov    %edx,%edi
+  803b00:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803b04:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803b08:	0f ad d0             	shrd   %cl,%edx,%eax
+  803b0b:	d3 ea                	shr    %cl,%edx
+  803b0d:	f6 c1 20             	test   $0x20,%cl
+  803b10:	74 04                	je     803b16 <dm+0x6e>
+  803b12:	89 d0                	mov    %edx,%eax
+  803b14:	31 d2                	xor    %edx,%edx
+  803b16:	83 e0 01             	and    $0x1,%eax
+  803b19:	89 04 24             	mov    %eax,(%esp)
+  803b1c:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803b23:	00 
+  803b24:	8b 04 24             	mov    (%esp),%eax
+  803b27:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803b2b:	09 f0                	or     %esi,%eax
+  803b2d:	09 fa                	or     %edi,%edx
+  803b2f:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803b33:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803b37:	39 f0                	cmp    %esi,%eax
+  803b39:	89 d5                	mov    %edx,%ebp
+  803b3b:	19 fd                	sbb    %edi,%ebp
+  803b3d:	72 af                	jb     803aee <dm+0x46>
+  803b3f:	29 f0                	sub    %esi,%eax
+  803b41:	19 fa                	sbb    %edi,%edx
+  803b43:	89 cf                	mov    %ecx,%edi
+  803b45:	c1 ef 05             	shr    $0x5,%edi
+  803b48:	83 e7 01             	and    $0x1,%edi
+  803b4b:	89 fe                	mov    %edi,%esi
+  803b4d:	83 f6 01             	xor    $0x1,%esi
+  803b50:	d3 e6                	shl    %cl,%esi
+  803b52:	d3 e7                	shl    %cl,%edi
+  803b54:	09 74 24 18          	or     %esi,0x18(%esp)
+  803b58:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803b5c:	eb 90                	jmp    803aee <dm+0x46>
+  803b5e:	85 db                	test   %ebx,%ebx
+  803b60:	74 05                	je     803b67 <dm+0xbf>
+  803b62:	89 03                	mov    %eax,(%ebx)
+  803b64:	89 53 04             	mov    %edx,0x4(%ebx)
+  803b67:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b6b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b6f:	83 c4 24             	add    $0x24,%esp
+  803b72:	5b                   	pop    %ebx
+  803b73:	5e                   	pop    %esi
+  803b74:	5f                   	pop    %edi
+  803b75:	5d                   	pop    %ebp
+  803b76:	c3                   	ret
+
+00803b77 <__udivdi3>:
+  803b77:	83 ec 08             	sub    $0x8,%esp
+  803b7a:	6a 00                	push   $0x0
+  803b7c:	ff 74 24 1c          	push   0x1c(%esp)
+  803b80:	ff 74 24 1c          	push   0x1c(%esp)
+  803b84:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b88:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b8c:	e8 17 ff ff ff       	call   803aa8 <dm>
+  803b91:	83 c4 14             	add    $0x14,%esp
+  803b94:	c3                   	ret
+
+00803b95 <__umoddi3>:
+  803b95:	83 ec 18             	sub    $0x18,%esp
+  803b98:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803b9c:	50                   	push   %eax
+  803b9d:	ff 74 24 2c          	push   0x2c(%esp)
+  803ba1:	ff 74 24 2c          	push   0x2c(%esp)
+  803ba5:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803ba9:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803bad:	e8 f6 fe ff ff       	call   803aa8 <dm>
+  803bb2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803bb6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803bba:	83 c4 24             	add    $0x24,%esp
+  803bbd:	c3                   	ret
+
+00803bbe <__divdi3>:
+  803bbe:	53                   	push   %ebx
+  803bbf:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803bc3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803bc7:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803bcb:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803bcf:	85 d2                	test   %edx,%edx
+  803bd1:	78 15                	js     803be8 <__divdi3+0x2a>
+  803bd3:	85 db                	test   %ebx,%ebx
+  803bd5:	78 34                	js     803c0b <__divdi3+0x4d>
+  803bd7:	83 ec 04             	sub    $0x4,%esp
+  803bda:	6a 00                	push   $0x0
+  803bdc:	53                   	push   %ebx
+  803bdd:	51                   	push   %ecx
+  803bde:	e8 c5 fe ff ff       	call   803aa8 <dm>
+  803be3:	83 c4 10             	add    $0x10,%esp
+  803be6:	eb 21                	jmp    803c09 <__divdi3+0x4b>
+  803be8:	f7 d8                	neg    %eax
+  803bea:	83 d2 00             	adc    $0x0,%edx
+  803bed:	f7 da                	neg    %edx
+  803bef:	85 db                	test   %ebx,%ebx
+  803bf1:	78 30                	js     803c23 <__divdi3+0x65>
+  803bf3:	83 ec 04             	sub    $0x4,%esp
+  803bf6:	6a 00                	push   $0x0
+  803bf8:	53                   	push   %ebx
+  803bf9:	51                   	push   %ecx
+  803bfa:	e8 a9 fe ff ff       	call   803aa8 <dm>
+  803bff:	83 c4 10             	add    $0x10,%esp
+  803c02:	f7 d8                	neg    %eax
+  803c04:	83 d2 00             	adc    $0x0,%edx
+  803c07:	f7 da                	neg    %edx
+  803c09:	5b                   	pop    %ebx
+  803c0a:	c3                   	ret
+  803c0b:	83 ec 04             	sub    $0x4,%esp
+  803c0e:	6a 00                	push   $0x0
+  803c10:	f7 d9                	neg    %ecx
+  803c12:	83 d3 00             	adc    $0x0,%ebx
+  803c15:	f7 db                	neg    %ebx
+  803c17:	53                   	push   %ebx
+  803c18:	51                   	push   %ecx
+  803c19:	e8 8a fe ff ff       	call   803aa8 <dm>
+  803c1e:	83 c4 10             	add    $0x10,%esp
+  803c21:	eb df                	jmp    803c02 <__divdi3+0x44>
+  803c23:	83 ec 04             	sub    $0x4,%esp
+  803c26:	6a 00                	push   $0x0
+  803c28:	f7 d9                	neg    %ecx
+  803c2a:	83 d3 00             	adc    $0x0,%ebx
+  803c2d:	f7 db                	neg    %ebx
+  803c2f:	53                   	push   %ebx
+  803c30:	51                   	push   %ecx
+  803c31:	e8 72 fe ff ff       	call   803aa8 <dm>
+  803c36:	83 c4 10             	add    $0x10,%esp
+  803c39:	eb ce                	jmp    803c09 <__divdi3+0x4b>
+
+00803c3b <__moddi3>:
+  803c3b:	55                   	push   %ebp
+  803c3c:	57                   	push   %edi
+  803c3d:	56                   	push   %esi
+  803c3e:	53                   	push   %ebx
+  803c3f:	83 ec 24             	sub    $0x24,%esp
+  803c42:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803c46:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803c4a:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803c4e:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803c52:	85 d2                	test   %edx,%edx
+  803c54:	78 3b                	js     803c91 <__moddi3+0x56>
+  803c56:	83 ec 04             	sub    $0x4,%esp
+  803c59:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803c5d:	56                   	push   %esi
+  803c5e:	89 ce                	mov    %ecx,%esi
+  803c60:	f7 de                	neg    %esi
+  803c62:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803c66:	89 de                	mov    %ebx,%esi
+  803c68:	83 d6 00             	adc    $0x0,%esi
+  803c6b:	f7 de                	neg    %esi
+  803c6d:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803c71:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803c75:	0f 48 f1             	cmovs  %ecx,%esi
+  803c78:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803c7d:	53                   	push   %ebx
+  803c7e:	56                   	push   %esi
+  803c7f:	e8 24 fe ff ff       	call   803aa8 <dm>
+  803c84:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803c88:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803c8c:	83 c4 10             	add    $0x10,%esp
+  803c8f:	eb 47                	jmp    803cd8 <__moddi3+0x9d>
+  803c91:	f7 d8                	neg    %eax
+  803c93:	83 d2 00             	adc    $0x0,%edx
+  803c96:	f7 da                	neg    %edx
+  803c98:	83 ec 04             	sub    $0x4,%esp
+  803c9b:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803c9f:	56                   	push   %esi
+  803ca0:	89 cf                	mov    %ecx,%edi
+  803ca2:	f7 df                	neg    %edi
+  803ca4:	89 de                	mov    %ebx,%esi
+  803ca6:	83 d6 00             	adc    $0x0,%esi
+  803ca9:	f7 de                	neg    %esi
+  803cab:	0f 49 cf             	cmovns %edi,%ecx
+  803cae:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803cb2:	0f 49 de             	cmovns %esi,%ebx
+  803cb5:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803cb9:	ff 74 24 0c          	push   0xc(%esp)
+  803cbd:	ff 74 24 0c          	push   0xc(%esp)
+  803cc1:	e8 e2 fd ff ff       	call   803aa8 <dm>
+  803cc6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803cca:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803cce:	f7 d8                	neg    %eax
+  803cd0:	83 d2 00             	adc    $0x0,%edx
+  803cd3:	f7 da                	neg    %edx
+  803cd5:	83 c4 10             	add    $0x10,%esp
+  803cd8:	83 c4 24             	add    $0x24,%esp
+  803cdb:	5b                   	pop    %ebx
+  803cdc:	5e                   	pop    %esi
+  803cdd:	5f                   	pop    %edi
+  803cde:	5d                   	pop    %ebp
+  803cdf:	c3                   	ret
@@ -0,0 +1,7621 @@
+
+obj/user/faultwritekernel.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0d 00 00 00       	call   80003e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	*(unsigned*)0xf0100000 = 0;
+  800033:	c7 05 00 00 10 f0 00 	movl   $0x0,0xf0100000
+  80003a:	00 00 00 
+}
+  80003d:	c3                   	ret
+
+0080003e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003e:	55                   	push   %ebp
+  80003f:	89 e5                	mov    %esp,%ebp
+  800041:	56                   	push   %esi
+  800042:	53                   	push   %ebx
+  800043:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800046:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800049:	e8 e9 00 00 00       	call   800137 <sys_getenvid>
+  80004e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800053:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800059:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80005e:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800063:	85 db                	test   %ebx,%ebx
+  800065:	7e 07                	jle    80006e <libmain+0x30>
+		binaryname = argv[0];
+  800067:	8b 06                	mov    (%esi),%eax
+  800069:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80006e:	83 ec 08             	sub    $0x8,%esp
+  800071:	56                   	push   %esi
+  800072:	53                   	push   %ebx
+  800073:	e8 bb ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800078:	e8 0a 00 00 00       	call   800087 <exit>
+}
+  80007d:	83 c4 10             	add    $0x10,%esp
+  800080:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800083:	5b                   	pop    %ebx
+  800084:	5e                   	pop    %esi
+  800085:	5d                   	pop    %ebp
+  800086:	c3                   	ret
+
+00800087 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800087:	55                   	push   %ebp
+  800088:	89 e5                	mov    %esp,%ebp
+  80008a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80008d:	e8 c0 06 00 00       	call   800752 <close_all>
+	sys_env_destroy(0);
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	6a 00                	push   $0x0
+  800097:	e8 52 00 00 00       	call   8000ee <sys_env_destroy>
+}
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	c9                   	leave
+  8000a0:	c3                   	ret
+
+008000a1 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000a1:	55                   	push   %ebp
+  8000a2:	89 e5                	mov    %esp,%ebp
+  8000a4:	57                   	push   %edi
+  8000a5:	56                   	push   %esi
+  8000a6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000b2:	89 c3                	mov    %eax,%ebx
+  8000b4:	89 c7                	mov    %eax,%edi
+  8000b6:	55                   	push   %ebp
+  8000b7:	89 e5                	mov    %esp,%ebp
+  8000b9:	8d 35 c1 00 80 00    	lea    0x8000c1,%esi
+  8000bf:	0f 34                	sysenter
+  8000c1:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  8000c2:	5b                   	pop    %ebx
+  8000c3:	5e                   	pop    %esi
+  8000c4:	5f                   	pop    %edi
+  8000c5:	5d                   	pop    %ebp
+  8000c6:	c3                   	ret
+
+008000c7 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000c7:	55                   	push   %ebp
+  8000c8:	89 e5                	mov    %esp,%ebp
+  8000ca:	57                   	push   %edi
+  8000cb:	56                   	push   %esi
+  8000cc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d7:	89 d1                	mov    %edx,%ecx
+  8000d9:	89 d3                	mov    %edx,%ebx
+  8000db:	89 d7                	mov    %edx,%edi
+  8000dd:	55                   	push   %ebp
+  8000de:	89 e5                	mov    %esp,%ebp
+  8000e0:	8d 35 e8 00 80 00    	lea    0x8000e8,%esi
+  8000e6:	0f 34                	sysenter
+  8000e8:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  8000e9:	5b                   	pop    %ebx
+  8000ea:	5e                   	pop    %esi
+  8000eb:	5f                   	pop    %edi
+  8000ec:	5d                   	pop    %ebp
+  8000ed:	c3                   	ret
+
+008000ee <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000ee:	55                   	push   %ebp
+  8000ef:	89 e5                	mov    %esp,%ebp
+  8000f1:	57                   	push   %edi
+  8000f2:	56                   	push   %esi
+  8000f3:	53                   	push   %ebx
+  8000f4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8000f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ff:	b8 03 00 00 00       	mov    $0x3,%eax
+  800104:	89 cb                	mov    %ecx,%ebx
+  800106:	89 cf                	mov    %ecx,%edi
+  800108:	55                   	push   %ebp
+  800109:	89 e5                	mov    %esp,%ebp
+  80010b:	8d 35 13 01 80 00    	lea    0x800113,%esi
+  800111:	0f 34                	sysenter
+  800113:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800114:	85 c0                	test   %eax,%eax
+  800116:	7f 08                	jg     800120 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800118:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80011b:	5b                   	pop    %ebx
+  80011c:	5e                   	pop    %esi
+  80011d:	5f                   	pop    %edi
+  80011e:	5d                   	pop    %ebp
+  80011f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800120:	83 ec 0c             	sub    $0xc,%esp
+  800123:	50                   	push   %eax
+  800124:	6a 03                	push   $0x3
+  800126:	68 4a 37 80 00       	push   $0x80374a
+  80012b:	6a 3d                	push   $0x3d
+  80012d:	68 67 37 80 00       	push   $0x803767
+  800132:	e8 02 24 00 00       	call   802539 <_panic>
+
+00800137 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800137:	55                   	push   %ebp
+  800138:	89 e5                	mov    %esp,%ebp
+  80013a:	57                   	push   %edi
+  80013b:	56                   	push   %esi
+  80013c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80013d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800142:	b8 02 00 00 00       	mov    $0x2,%eax
+  800147:	89 d1                	mov    %edx,%ecx
+  800149:	89 d3                	mov    %edx,%ebx
+  80014b:	89 d7                	mov    %edx,%edi
+  80014d:	55                   	push   %ebp
+  80014e:	89 e5                	mov    %esp,%ebp
+  800150:	8d 35 58 01 80 00    	lea    0x800158,%esi
+  800156:	0f 34                	sysenter
+  800158:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800159:	5b                   	pop    %ebx
+  80015a:	5e                   	pop    %esi
+  80015b:	5f                   	pop    %edi
+  80015c:	5d                   	pop    %ebp
+  80015d:	c3                   	ret
+
+0080015e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80015e:	55                   	push   %ebp
+  80015f:	89 e5                	mov    %esp,%ebp
+  800161:	57                   	push   %edi
+  800162:	56                   	push   %esi
+  800163:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800164:	ba 00 00 00 00       	mov    $0x0,%edx
+  800169:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80016e:	89 d1                	mov    %edx,%ecx
+  800170:	89 d3                	mov    %edx,%ebx
+  800172:	89 d7                	mov    %edx,%edi
+  800174:	89 d6                	mov    %edx,%esi
+  800176:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800178:	5b                   	pop    %ebx
+  800179:	5e                   	pop    %esi
+  80017a:	5f                   	pop    %edi
+  80017b:	5d                   	pop    %ebp
+  80017c:	c3                   	ret
+
+0080017d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80017d:	55                   	push   %ebp
+  80017e:	89 e5                	mov    %esp,%ebp
+  800180:	57                   	push   %edi
+  800181:	56                   	push   %esi
+  800182:	53                   	push   %ebx
+  800183:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800186:	8b 55 08             	mov    0x8(%ebp),%edx
+  800189:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80018c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800191:	bf 00 00 00 00       	mov    $0x0,%edi
+  800196:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800199:	55                   	push   %ebp
+  80019a:	89 e5                	mov    %esp,%ebp
+  80019c:	8d 35 a4 01 80 00    	lea    0x8001a4,%esi
+  8001a2:	0f 34                	sysenter
+  8001a4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8001a5:	85 c0                	test   %eax,%eax
+  8001a7:	7f 08                	jg     8001b1 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  8001a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001ac:	5b                   	pop    %ebx
+  8001ad:	5e                   	pop    %esi
+  8001ae:	5f                   	pop    %edi
+  8001af:	5d                   	pop    %ebp
+  8001b0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001b1:	83 ec 0c             	sub    $0xc,%esp
+  8001b4:	50                   	push   %eax
+  8001b5:	6a 04                	push   $0x4
+  8001b7:	68 4a 37 80 00       	push   $0x80374a
+  8001bc:	6a 3d                	push   $0x3d
+  8001be:	68 67 37 80 00       	push   $0x803767
+  8001c3:	e8 71 23 00 00       	call   802539 <_panic>
+
+008001c8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001c8:	55                   	push   %ebp
+  8001c9:	89 e5                	mov    %esp,%ebp
+  8001cb:	57                   	push   %edi
+  8001cc:	56                   	push   %esi
+  8001cd:	53                   	push   %ebx
+  8001ce:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001d7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001df:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001e2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001e5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001e7:	85 c0                	test   %eax,%eax
+  8001e9:	7f 08                	jg     8001f3 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001ee:	5b                   	pop    %ebx
+  8001ef:	5e                   	pop    %esi
+  8001f0:	5f                   	pop    %edi
+  8001f1:	5d                   	pop    %ebp
+  8001f2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001f3:	83 ec 0c             	sub    $0xc,%esp
+  8001f6:	50                   	push   %eax
+  8001f7:	6a 05                	push   $0x5
+  8001f9:	68 4a 37 80 00       	push   $0x80374a
+  8001fe:	6a 23                	push   $0x23
+  800200:	68 67 37 80 00       	push   $0x803767
+  800205:	e8 2f 23 00 00       	call   802539 <_panic>
+
+0080020a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80020a:	55                   	push   %ebp
+  80020b:	89 e5                	mov    %esp,%ebp
+  80020d:	57                   	push   %edi
+  80020e:	56                   	push   %esi
+  80020f:	53                   	push   %ebx
+  800210:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800213:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800218:	8b 55 08             	mov    0x8(%ebp),%edx
+  80021b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80021e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800223:	89 df                	mov    %ebx,%edi
+  800225:	55                   	push   %ebp
+  800226:	89 e5                	mov    %esp,%ebp
+  800228:	8d 35 30 02 80 00    	lea    0x800230,%esi
+  80022e:	0f 34                	sysenter
+  800230:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800231:	85 c0                	test   %eax,%eax
+  800233:	7f 08                	jg     80023d <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800235:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800238:	5b                   	pop    %ebx
+  800239:	5e                   	pop    %esi
+  80023a:	5f                   	pop    %edi
+  80023b:	5d                   	pop    %ebp
+  80023c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80023d:	83 ec 0c             	sub    $0xc,%esp
+  800240:	50                   	push   %eax
+  800241:	6a 06                	push   $0x6
+  800243:	68 4a 37 80 00       	push   $0x80374a
+  800248:	6a 3d                	push   $0x3d
+  80024a:	68 67 37 80 00       	push   $0x803767
+  80024f:	e8 e5 22 00 00       	call   802539 <_panic>
+
+00800254 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800254:	55                   	push   %ebp
+  800255:	89 e5                	mov    %esp,%ebp
+  800257:	57                   	push   %edi
+  800258:	56                   	push   %esi
+  800259:	53                   	push   %ebx
+  80025a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80025d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800262:	8b 55 08             	mov    0x8(%ebp),%edx
+  800265:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800268:	b8 08 00 00 00       	mov    $0x8,%eax
+  80026d:	89 df                	mov    %ebx,%edi
+  80026f:	55                   	push   %ebp
+  800270:	89 e5                	mov    %esp,%ebp
+  800272:	8d 35 7a 02 80 00    	lea    0x80027a,%esi
+  800278:	0f 34                	sysenter
+  80027a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80027b:	85 c0                	test   %eax,%eax
+  80027d:	7f 08                	jg     800287 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  80027f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800282:	5b                   	pop    %ebx
+  800283:	5e                   	pop    %esi
+  800284:	5f                   	pop    %edi
+  800285:	5d                   	pop    %ebp
+  800286:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800287:	83 ec 0c             	sub    $0xc,%esp
+  80028a:	50                   	push   %eax
+  80028b:	6a 08                	push   $0x8
+  80028d:	68 4a 37 80 00       	push   $0x80374a
+  800292:	6a 3d                	push   $0x3d
+  800294:	68 67 37 80 00       	push   $0x803767
+  800299:	e8 9b 22 00 00       	call   802539 <_panic>
+
+0080029e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80029e:	55                   	push   %ebp
+  80029f:	89 e5                	mov    %esp,%ebp
+  8002a1:	57                   	push   %edi
+  8002a2:	56                   	push   %esi
+  8002a3:	53                   	push   %ebx
+  8002a4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8002a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002b2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002b7:	89 df                	mov    %ebx,%edi
+  8002b9:	55                   	push   %ebp
+  8002ba:	89 e5                	mov    %esp,%ebp
+  8002bc:	8d 35 c4 02 80 00    	lea    0x8002c4,%esi
+  8002c2:	0f 34                	sysenter
+  8002c4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8002c5:	85 c0                	test   %eax,%eax
+  8002c7:	7f 08                	jg     8002d1 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  8002c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002cc:	5b                   	pop    %ebx
+  8002cd:	5e                   	pop    %esi
+  8002ce:	5f                   	pop    %edi
+  8002cf:	5d                   	pop    %ebp
+  8002d0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002d1:	83 ec 0c             	sub    $0xc,%esp
+  8002d4:	50                   	push   %eax
+  8002d5:	6a 09                	push   $0x9
+  8002d7:	68 4a 37 80 00       	push   $0x80374a
+  8002dc:	6a 3d                	push   $0x3d
+  8002de:	68 67 37 80 00       	push   $0x803767
+  8002e3:	e8 51 22 00 00       	call   802539 <_panic>
+
+008002e8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002e8:	55                   	push   %ebp
+  8002e9:	89 e5                	mov    %esp,%ebp
+  8002eb:	57                   	push   %edi
+  8002ec:	56                   	push   %esi
+  8002ed:	53                   	push   %ebx
+  8002ee:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8002f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002fc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800301:	89 df                	mov    %ebx,%edi
+  800303:	55                   	push   %ebp
+  800304:	89 e5                	mov    %esp,%ebp
+  800306:	8d 35 0e 03 80 00    	lea    0x80030e,%esi
+  80030c:	0f 34                	sysenter
+  80030e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80030f:	85 c0                	test   %eax,%eax
+  800311:	7f 08                	jg     80031b <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800313:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800316:	5b                   	pop    %ebx
+  800317:	5e                   	pop    %esi
+  800318:	5f                   	pop    %edi
+  800319:	5d                   	pop    %ebp
+  80031a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80031b:	83 ec 0c             	sub    $0xc,%esp
+  80031e:	50                   	push   %eax
+  80031f:	6a 0a                	push   $0xa
+  800321:	68 4a 37 80 00       	push   $0x80374a
+  800326:	6a 3d                	push   $0x3d
+  800328:	68 67 37 80 00       	push   $0x803767
+  80032d:	e8 07 22 00 00       	call   802539 <_panic>
+
+00800332 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800332:	55                   	push   %ebp
+  800333:	89 e5                	mov    %esp,%ebp
+  800335:	57                   	push   %edi
+  800336:	56                   	push   %esi
+  800337:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800338:	8b 55 08             	mov    0x8(%ebp),%edx
+  80033b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80033e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800343:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800346:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800349:	55                   	push   %ebp
+  80034a:	89 e5                	mov    %esp,%ebp
+  80034c:	8d 35 54 03 80 00    	lea    0x800354,%esi
+  800352:	0f 34                	sysenter
+  800354:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800355:	5b                   	pop    %ebx
+  800356:	5e                   	pop    %esi
+  800357:	5f                   	pop    %edi
+  800358:	5d                   	pop    %ebp
+  800359:	c3                   	ret
+
+0080035a <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  80035a:	55                   	push   %ebp
+  80035b:	89 e5                	mov    %esp,%ebp
+  80035d:	57                   	push   %edi
+  80035e:	56                   	push   %esi
+  80035f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800360:	8b 55 08             	mov    0x8(%ebp),%edx
+  800363:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800366:	b8 17 00 00 00       	mov    $0x17,%eax
+  80036b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80036e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800371:	55                   	push   %ebp
+  800372:	89 e5                	mov    %esp,%ebp
+  800374:	8d 35 7c 03 80 00    	lea    0x80037c,%esi
+  80037a:	0f 34                	sysenter
+  80037c:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  80037d:	5b                   	pop    %ebx
+  80037e:	5e                   	pop    %esi
+  80037f:	5f                   	pop    %edi
+  800380:	5d                   	pop    %ebp
+  800381:	c3                   	ret
+
+00800382 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800382:	55                   	push   %ebp
+  800383:	89 e5                	mov    %esp,%ebp
+  800385:	57                   	push   %edi
+  800386:	56                   	push   %esi
+  800387:	53                   	push   %ebx
+  800388:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80038b:	be 00 00 00 00       	mov    $0x0,%esi
+  800390:	8b 55 08             	mov    0x8(%ebp),%edx
+  800393:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800396:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80039b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80039e:	89 f7                	mov    %esi,%edi
+  8003a0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003a2:	85 c0                	test   %eax,%eax
+  8003a4:	7f 08                	jg     8003ae <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8003a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a9:	5b                   	pop    %ebx
+  8003aa:	5e                   	pop    %esi
+  8003ab:	5f                   	pop    %edi
+  8003ac:	5d                   	pop    %ebp
+  8003ad:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003ae:	83 ec 0c             	sub    $0xc,%esp
+  8003b1:	50                   	push   %eax
+  8003b2:	6a 0d                	push   $0xd
+  8003b4:	68 4a 37 80 00       	push   $0x80374a
+  8003b9:	6a 23                	push   $0x23
+  8003bb:	68 67 37 80 00       	push   $0x803767
+  8003c0:	e8 74 21 00 00       	call   802539 <_panic>
+
+008003c5 <sys_ipc_recv>:
+{
+  8003c5:	55                   	push   %ebp
+  8003c6:	89 e5                	mov    %esp,%ebp
+  8003c8:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  8003cb:	6a 00                	push   $0x0
+  8003cd:	6a 01                	push   $0x1
+  8003cf:	ff 75 08             	push   0x8(%ebp)
+  8003d2:	e8 ab ff ff ff       	call   800382 <sys_ipc_recvv>
+}
+  8003d7:	c9                   	leave
+  8003d8:	c3                   	ret
+
+008003d9 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  8003d9:	55                   	push   %ebp
+  8003da:	89 e5                	mov    %esp,%ebp
+  8003dc:	57                   	push   %edi
+  8003dd:	56                   	push   %esi
+  8003de:	53                   	push   %ebx
+  8003df:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003ed:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003f2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003f5:	89 de                	mov    %ebx,%esi
+  8003f7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003f9:	85 c0                	test   %eax,%eax
+  8003fb:	7f 08                	jg     800405 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  8003fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800400:	5b                   	pop    %ebx
+  800401:	5e                   	pop    %esi
+  800402:	5f                   	pop    %edi
+  800403:	5d                   	pop    %ebp
+  800404:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800405:	83 ec 0c             	sub    $0xc,%esp
+  800408:	50                   	push   %eax
+  800409:	6a 0d                	push   $0xd
+  80040b:	68 4a 37 80 00       	push   $0x80374a
+  800410:	6a 23                	push   $0x23
+  800412:	68 67 37 80 00       	push   $0x803767
+  800417:	e8 1d 21 00 00       	call   802539 <_panic>
+
+0080041c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80041c:	55                   	push   %ebp
+  80041d:	89 e5                	mov    %esp,%ebp
+  80041f:	57                   	push   %edi
+  800420:	56                   	push   %esi
+  800421:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800422:	ba 00 00 00 00       	mov    $0x0,%edx
+  800427:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80042c:	89 d1                	mov    %edx,%ecx
+  80042e:	89 d3                	mov    %edx,%ebx
+  800430:	89 d7                	mov    %edx,%edi
+  800432:	55                   	push   %ebp
+  800433:	89 e5                	mov    %esp,%ebp
+  800435:	8d 35 3d 04 80 00    	lea    0x80043d,%esi
+  80043b:	0f 34                	sysenter
+  80043d:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  80043e:	5b                   	pop    %ebx
+  80043f:	5e                   	pop    %esi
+  800440:	5f                   	pop    %edi
+  800441:	5d                   	pop    %ebp
+  800442:	c3                   	ret
+
+00800443 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800443:	55                   	push   %ebp
+  800444:	89 e5                	mov    %esp,%ebp
+  800446:	57                   	push   %edi
+  800447:	56                   	push   %esi
+  800448:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800449:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80044e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800451:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800454:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800459:	89 df                	mov    %ebx,%edi
+  80045b:	55                   	push   %ebp
+  80045c:	89 e5                	mov    %esp,%ebp
+  80045e:	8d 35 66 04 80 00    	lea    0x800466,%esi
+  800464:	0f 34                	sysenter
+  800466:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800467:	5b                   	pop    %ebx
+  800468:	5e                   	pop    %esi
+  800469:	5f                   	pop    %edi
+  80046a:	5d                   	pop    %ebp
+  80046b:	c3                   	ret
+
+0080046c <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  80046c:	55                   	push   %ebp
+  80046d:	89 e5                	mov    %esp,%ebp
+  80046f:	57                   	push   %edi
+  800470:	56                   	push   %esi
+  800471:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800472:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800477:	8b 55 08             	mov    0x8(%ebp),%edx
+  80047a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80047f:	89 cb                	mov    %ecx,%ebx
+  800481:	89 cf                	mov    %ecx,%edi
+  800483:	55                   	push   %ebp
+  800484:	89 e5                	mov    %esp,%ebp
+  800486:	8d 35 8e 04 80 00    	lea    0x80048e,%esi
+  80048c:	0f 34                	sysenter
+  80048e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  80048f:	5b                   	pop    %ebx
+  800490:	5e                   	pop    %esi
+  800491:	5f                   	pop    %edi
+  800492:	5d                   	pop    %ebp
+  800493:	c3                   	ret
+
+00800494 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800494:	55                   	push   %ebp
+  800495:	89 e5                	mov    %esp,%ebp
+  800497:	57                   	push   %edi
+  800498:	56                   	push   %esi
+  800499:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80049a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80049f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004a5:	b8 12 00 00 00       	mov    $0x12,%eax
+  8004aa:	89 df                	mov    %ebx,%edi
+  8004ac:	55                   	push   %ebp
+  8004ad:	89 e5                	mov    %esp,%ebp
+  8004af:	8d 35 b7 04 80 00    	lea    0x8004b7,%esi
+  8004b5:	0f 34                	sysenter
+  8004b7:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8004b8:	5b                   	pop    %ebx
+  8004b9:	5e                   	pop    %esi
+  8004ba:	5f                   	pop    %edi
+  8004bb:	5d                   	pop    %ebp
+  8004bc:	c3                   	ret
+
+008004bd <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8004bd:	55                   	push   %ebp
+  8004be:	89 e5                	mov    %esp,%ebp
+  8004c0:	57                   	push   %edi
+  8004c1:	56                   	push   %esi
+  8004c2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ce:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004d3:	89 df                	mov    %ebx,%edi
+  8004d5:	55                   	push   %ebp
+  8004d6:	89 e5                	mov    %esp,%ebp
+  8004d8:	8d 35 e0 04 80 00    	lea    0x8004e0,%esi
+  8004de:	0f 34                	sysenter
+  8004e0:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  8004e1:	5b                   	pop    %ebx
+  8004e2:	5e                   	pop    %esi
+  8004e3:	5f                   	pop    %edi
+  8004e4:	5d                   	pop    %ebp
+  8004e5:	c3                   	ret
+
+008004e6 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  8004e6:	55                   	push   %ebp
+  8004e7:	89 e5                	mov    %esp,%ebp
+  8004e9:	57                   	push   %edi
+  8004ea:	56                   	push   %esi
+  8004eb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004f2:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004fd:	55                   	push   %ebp
+  8004fe:	89 e5                	mov    %esp,%ebp
+  800500:	8d 35 08 05 80 00    	lea    0x800508,%esi
+  800506:	0f 34                	sysenter
+  800508:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800509:	5b                   	pop    %ebx
+  80050a:	5e                   	pop    %esi
+  80050b:	5f                   	pop    %edi
+  80050c:	5d                   	pop    %ebp
+  80050d:	c3                   	ret
+
+0080050e <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  80050e:	55                   	push   %ebp
+  80050f:	89 e5                	mov    %esp,%ebp
+  800511:	57                   	push   %edi
+  800512:	56                   	push   %esi
+  800513:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800514:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800519:	8b 55 08             	mov    0x8(%ebp),%edx
+  80051c:	b8 11 00 00 00       	mov    $0x11,%eax
+  800521:	89 cb                	mov    %ecx,%ebx
+  800523:	89 cf                	mov    %ecx,%edi
+  800525:	89 ce                	mov    %ecx,%esi
+  800527:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800529:	5b                   	pop    %ebx
+  80052a:	5e                   	pop    %esi
+  80052b:	5f                   	pop    %edi
+  80052c:	5d                   	pop    %ebp
+  80052d:	c3                   	ret
+
+0080052e <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  80052e:	55                   	push   %ebp
+  80052f:	89 e5                	mov    %esp,%ebp
+  800531:	57                   	push   %edi
+  800532:	56                   	push   %esi
+  800533:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800534:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800539:	8b 55 08             	mov    0x8(%ebp),%edx
+  80053c:	b8 15 00 00 00       	mov    $0x15,%eax
+  800541:	89 cb                	mov    %ecx,%ebx
+  800543:	89 cf                	mov    %ecx,%edi
+  800545:	55                   	push   %ebp
+  800546:	89 e5                	mov    %esp,%ebp
+  800548:	8d 35 50 05 80 00    	lea    0x800550,%esi
+  80054e:	0f 34                	sysenter
+  800550:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800551:	5b                   	pop    %ebx
+  800552:	5e                   	pop    %esi
+  800553:	5f                   	pop    %edi
+  800554:	5d                   	pop    %ebp
+  800555:	c3                   	ret
+
+00800556 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800556:	55                   	push   %ebp
+  800557:	89 e5                	mov    %esp,%ebp
+  800559:	57                   	push   %edi
+  80055a:	56                   	push   %esi
+  80055b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80055c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800561:	8b 55 08             	mov    0x8(%ebp),%edx
+  800564:	b8 16 00 00 00       	mov    $0x16,%eax
+  800569:	89 cb                	mov    %ecx,%ebx
+  80056b:	89 cf                	mov    %ecx,%edi
+  80056d:	55                   	push   %ebp
+  80056e:	89 e5                	mov    %esp,%ebp
+  800570:	8d 35 78 05 80 00    	lea    0x800578,%esi
+  800576:	0f 34                	sysenter
+  800578:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800579:	5b                   	pop    %ebx
+  80057a:	5e                   	pop    %esi
+  80057b:	5f                   	pop    %edi
+  80057c:	5d                   	pop    %ebp
+  80057d:	c3                   	ret
+
+0080057e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80057e:	55                   	push   %ebp
+  80057f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800581:	8b 45 08             	mov    0x8(%ebp),%eax
+  800584:	05 00 00 00 30       	add    $0x30000000,%eax
+  800589:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80058c:	5d                   	pop    %ebp
+  80058d:	c3                   	ret
+
+0080058e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80058e:	55                   	push   %ebp
+  80058f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800591:	8b 45 08             	mov    0x8(%ebp),%eax
+  800594:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800599:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80059e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8005a3:	5d                   	pop    %ebp
+  8005a4:	c3                   	ret
+
+008005a5 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8005a5:	55                   	push   %ebp
+  8005a6:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8005a8:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8005ad:	eb 02                	jmp    8005b1 <fd_alloc+0xc>
+  8005af:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8005b1:	89 c2                	mov    %eax,%edx
+  8005b3:	c1 ea 16             	shr    $0x16,%edx
+  8005b6:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8005bd:	f6 c2 01             	test   $0x1,%dl
+  8005c0:	74 2b                	je     8005ed <fd_alloc+0x48>
+  8005c2:	89 c2                	mov    %eax,%edx
+  8005c4:	c1 ea 0c             	shr    $0xc,%edx
+  8005c7:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8005ce:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8005d4:	f6 c1 01             	test   $0x1,%cl
+  8005d7:	74 14                	je     8005ed <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8005d9:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8005df:	75 ce                	jne    8005af <fd_alloc+0xa>
+  8005e1:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8005e6:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8005eb:	eb 05                	jmp    8005f2 <fd_alloc+0x4d>
+			return 0;
+  8005ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8005f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005f5:	89 02                	mov    %eax,(%edx)
+}
+  8005f7:	89 c8                	mov    %ecx,%eax
+  8005f9:	5d                   	pop    %ebp
+  8005fa:	c3                   	ret
+
+008005fb <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8005fb:	55                   	push   %ebp
+  8005fc:	89 e5                	mov    %esp,%ebp
+  8005fe:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800601:	83 f8 1f             	cmp    $0x1f,%eax
+  800604:	77 30                	ja     800636 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800606:	c1 e0 0c             	shl    $0xc,%eax
+  800609:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80060e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800614:	f6 c2 01             	test   $0x1,%dl
+  800617:	74 24                	je     80063d <fd_lookup+0x42>
+  800619:	89 c2                	mov    %eax,%edx
+  80061b:	c1 ea 0c             	shr    $0xc,%edx
+  80061e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800625:	f6 c2 01             	test   $0x1,%dl
+  800628:	74 1a                	je     800644 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80062a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80062d:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80062f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800634:	5d                   	pop    %ebp
+  800635:	c3                   	ret
+		return -E_INVAL;
+  800636:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80063b:	eb f7                	jmp    800634 <fd_lookup+0x39>
+		return -E_INVAL;
+  80063d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800642:	eb f0                	jmp    800634 <fd_lookup+0x39>
+  800644:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800649:	eb e9                	jmp    800634 <fd_lookup+0x39>
+
+0080064b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80064b:	55                   	push   %ebp
+  80064c:	89 e5                	mov    %esp,%ebp
+  80064e:	53                   	push   %ebx
+  80064f:	83 ec 04             	sub    $0x4,%esp
+  800652:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065a:	eb 03                	jmp    80065f <dev_lookup+0x14>
+  80065c:	83 c0 01             	add    $0x1,%eax
+  80065f:	8b 1c 85 f4 37 80 00 	mov    0x8037f4(,%eax,4),%ebx
+  800666:	85 db                	test   %ebx,%ebx
+  800668:	74 0b                	je     800675 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80066a:	39 13                	cmp    %edx,(%ebx)
+  80066c:	75 ee                	jne    80065c <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80066e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800673:	eb 1f                	jmp    800694 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800675:	a1 00 50 80 00       	mov    0x805000,%eax
+  80067a:	8b 40 48             	mov    0x48(%eax),%eax
+  80067d:	83 ec 04             	sub    $0x4,%esp
+  800680:	52                   	push   %edx
+  800681:	50                   	push   %eax
+  800682:	68 78 37 80 00       	push   $0x803778
+  800687:	e8 88 1f 00 00       	call   802614 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80068c:	83 c4 10             	add    $0x10,%esp
+  80068f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800694:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800697:	89 1a                	mov    %ebx,(%edx)
+}
+  800699:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80069c:	c9                   	leave
+  80069d:	c3                   	ret
+
+0080069e <fd_close>:
+{
+  80069e:	55                   	push   %ebp
+  80069f:	89 e5                	mov    %esp,%ebp
+  8006a1:	57                   	push   %edi
+  8006a2:	56                   	push   %esi
+  8006a3:	53                   	push   %ebx
+  8006a4:	83 ec 24             	sub    $0x24,%esp
+  8006a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006aa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006ad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8006b0:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8006b1:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8006b7:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006ba:	50                   	push   %eax
+  8006bb:	e8 3b ff ff ff       	call   8005fb <fd_lookup>
+  8006c0:	89 c3                	mov    %eax,%ebx
+  8006c2:	83 c4 10             	add    $0x10,%esp
+  8006c5:	85 c0                	test   %eax,%eax
+  8006c7:	78 05                	js     8006ce <fd_close+0x30>
+	    || fd != fd2)
+  8006c9:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8006cc:	74 16                	je     8006e4 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8006ce:	89 f8                	mov    %edi,%eax
+  8006d0:	84 c0                	test   %al,%al
+  8006d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d7:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8006da:	89 d8                	mov    %ebx,%eax
+  8006dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006df:	5b                   	pop    %ebx
+  8006e0:	5e                   	pop    %esi
+  8006e1:	5f                   	pop    %edi
+  8006e2:	5d                   	pop    %ebp
+  8006e3:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8006e4:	83 ec 08             	sub    $0x8,%esp
+  8006e7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8006ea:	50                   	push   %eax
+  8006eb:	ff 36                	push   (%esi)
+  8006ed:	e8 59 ff ff ff       	call   80064b <dev_lookup>
+  8006f2:	89 c3                	mov    %eax,%ebx
+  8006f4:	83 c4 10             	add    $0x10,%esp
+  8006f7:	85 c0                	test   %eax,%eax
+  8006f9:	78 1a                	js     800715 <fd_close+0x77>
+		if (dev->dev_close)
+  8006fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006fe:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800701:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800706:	85 c0                	test   %eax,%eax
+  800708:	74 0b                	je     800715 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80070a:	83 ec 0c             	sub    $0xc,%esp
+  80070d:	56                   	push   %esi
+  80070e:	ff d0                	call   *%eax
+  800710:	89 c3                	mov    %eax,%ebx
+  800712:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800715:	83 ec 08             	sub    $0x8,%esp
+  800718:	56                   	push   %esi
+  800719:	6a 00                	push   $0x0
+  80071b:	e8 ea fa ff ff       	call   80020a <sys_page_unmap>
+	return r;
+  800720:	83 c4 10             	add    $0x10,%esp
+  800723:	eb b5                	jmp    8006da <fd_close+0x3c>
+
+00800725 <close>:
+
+int
+close(int fdnum)
+{
+  800725:	55                   	push   %ebp
+  800726:	89 e5                	mov    %esp,%ebp
+  800728:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80072b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80072e:	50                   	push   %eax
+  80072f:	ff 75 08             	push   0x8(%ebp)
+  800732:	e8 c4 fe ff ff       	call   8005fb <fd_lookup>
+  800737:	83 c4 10             	add    $0x10,%esp
+  80073a:	85 c0                	test   %eax,%eax
+  80073c:	79 02                	jns    800740 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80073e:	c9                   	leave
+  80073f:	c3                   	ret
+		return fd_close(fd, 1);
+  800740:	83 ec 08             	sub    $0x8,%esp
+  800743:	6a 01                	push   $0x1
+  800745:	ff 75 f4             	push   -0xc(%ebp)
+  800748:	e8 51 ff ff ff       	call   80069e <fd_close>
+  80074d:	83 c4 10             	add    $0x10,%esp
+  800750:	eb ec                	jmp    80073e <close+0x19>
+
+00800752 <close_all>:
+
+void
+close_all(void)
+{
+  800752:	55                   	push   %ebp
+  800753:	89 e5                	mov    %esp,%ebp
+  800755:	53                   	push   %ebx
+  800756:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800759:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80075e:	83 ec 0c             	sub    $0xc,%esp
+  800761:	53                   	push   %ebx
+  800762:	e8 be ff ff ff       	call   800725 <close>
+	for (i = 0; i < MAXFD; i++)
+  800767:	83 c3 01             	add    $0x1,%ebx
+  80076a:	83 c4 10             	add    $0x10,%esp
+  80076d:	83 fb 20             	cmp    $0x20,%ebx
+  800770:	75 ec                	jne    80075e <close_all+0xc>
+}
+  800772:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800775:	c9                   	leave
+  800776:	c3                   	ret
+
+00800777 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800777:	55                   	push   %ebp
+  800778:	89 e5                	mov    %esp,%ebp
+  80077a:	57                   	push   %edi
+  80077b:	56                   	push   %esi
+  80077c:	53                   	push   %ebx
+  80077d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800780:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800783:	50                   	push   %eax
+  800784:	ff 75 08             	push   0x8(%ebp)
+  800787:	e8 6f fe ff ff       	call   8005fb <fd_lookup>
+  80078c:	89 c3                	mov    %eax,%ebx
+  80078e:	83 c4 10             	add    $0x10,%esp
+  800791:	85 c0                	test   %eax,%eax
+  800793:	78 7f                	js     800814 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800795:	83 ec 0c             	sub    $0xc,%esp
+  800798:	ff 75 0c             	push   0xc(%ebp)
+  80079b:	e8 85 ff ff ff       	call   800725 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8007a0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8007a3:	c1 e6 0c             	shl    $0xc,%esi
+  8007a6:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8007ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8007af:	89 3c 24             	mov    %edi,(%esp)
+  8007b2:	e8 d7 fd ff ff       	call   80058e <fd2data>
+  8007b7:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8007b9:	89 34 24             	mov    %esi,(%esp)
+  8007bc:	e8 cd fd ff ff       	call   80058e <fd2data>
+  8007c1:	83 c4 10             	add    $0x10,%esp
+  8007c4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8007c7:	89 d8                	mov    %ebx,%eax
+  8007c9:	c1 e8 16             	shr    $0x16,%eax
+  8007cc:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8007d3:	a8 01                	test   $0x1,%al
+  8007d5:	74 11                	je     8007e8 <dup+0x71>
+  8007d7:	89 d8                	mov    %ebx,%eax
+  8007d9:	c1 e8 0c             	shr    $0xc,%eax
+  8007dc:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8007e3:	f6 c2 01             	test   $0x1,%dl
+  8007e6:	75 36                	jne    80081e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8007e8:	89 f8                	mov    %edi,%eax
+  8007ea:	c1 e8 0c             	shr    $0xc,%eax
+  8007ed:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8007f4:	83 ec 0c             	sub    $0xc,%esp
+  8007f7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8007fc:	50                   	push   %eax
+  8007fd:	56                   	push   %esi
+  8007fe:	6a 00                	push   $0x0
+  800800:	57                   	push   %edi
+  800801:	6a 00                	push   $0x0
+  800803:	e8 c0 f9 ff ff       	call   8001c8 <sys_page_map>
+  800808:	89 c3                	mov    %eax,%ebx
+  80080a:	83 c4 20             	add    $0x20,%esp
+  80080d:	85 c0                	test   %eax,%eax
+  80080f:	78 33                	js     800844 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800811:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800814:	89 d8                	mov    %ebx,%eax
+  800816:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800819:	5b                   	pop    %ebx
+  80081a:	5e                   	pop    %esi
+  80081b:	5f                   	pop    %edi
+  80081c:	5d                   	pop    %ebp
+  80081d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80081e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800825:	83 ec 0c             	sub    $0xc,%esp
+  800828:	25 07 0e 00 00       	and    $0xe07,%eax
+  80082d:	50                   	push   %eax
+  80082e:	ff 75 d4             	push   -0x2c(%ebp)
+  800831:	6a 00                	push   $0x0
+  800833:	53                   	push   %ebx
+  800834:	6a 00                	push   $0x0
+  800836:	e8 8d f9 ff ff       	call   8001c8 <sys_page_map>
+  80083b:	89 c3                	mov    %eax,%ebx
+  80083d:	83 c4 20             	add    $0x20,%esp
+  800840:	85 c0                	test   %eax,%eax
+  800842:	79 a4                	jns    8007e8 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800844:	83 ec 08             	sub    $0x8,%esp
+  800847:	56                   	push   %esi
+  800848:	6a 00                	push   $0x0
+  80084a:	e8 bb f9 ff ff       	call   80020a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80084f:	83 c4 08             	add    $0x8,%esp
+  800852:	ff 75 d4             	push   -0x2c(%ebp)
+  800855:	6a 00                	push   $0x0
+  800857:	e8 ae f9 ff ff       	call   80020a <sys_page_unmap>
+	return r;
+  80085c:	83 c4 10             	add    $0x10,%esp
+  80085f:	eb b3                	jmp    800814 <dup+0x9d>
+
+00800861 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800861:	55                   	push   %ebp
+  800862:	89 e5                	mov    %esp,%ebp
+  800864:	56                   	push   %esi
+  800865:	53                   	push   %ebx
+  800866:	83 ec 18             	sub    $0x18,%esp
+  800869:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80086c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80086f:	50                   	push   %eax
+  800870:	56                   	push   %esi
+  800871:	e8 85 fd ff ff       	call   8005fb <fd_lookup>
+  800876:	83 c4 10             	add    $0x10,%esp
+  800879:	85 c0                	test   %eax,%eax
+  80087b:	78 3c                	js     8008b9 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80087d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800880:	83 ec 08             	sub    $0x8,%esp
+  800883:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800886:	50                   	push   %eax
+  800887:	ff 33                	push   (%ebx)
+  800889:	e8 bd fd ff ff       	call   80064b <dev_lookup>
+  80088e:	83 c4 10             	add    $0x10,%esp
+  800891:	85 c0                	test   %eax,%eax
+  800893:	78 24                	js     8008b9 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800895:	8b 43 08             	mov    0x8(%ebx),%eax
+  800898:	83 e0 03             	and    $0x3,%eax
+  80089b:	83 f8 01             	cmp    $0x1,%eax
+  80089e:	74 20                	je     8008c0 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8008a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008a3:	8b 40 08             	mov    0x8(%eax),%eax
+  8008a6:	85 c0                	test   %eax,%eax
+  8008a8:	74 37                	je     8008e1 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8008aa:	83 ec 04             	sub    $0x4,%esp
+  8008ad:	ff 75 10             	push   0x10(%ebp)
+  8008b0:	ff 75 0c             	push   0xc(%ebp)
+  8008b3:	53                   	push   %ebx
+  8008b4:	ff d0                	call   *%eax
+  8008b6:	83 c4 10             	add    $0x10,%esp
+}
+  8008b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008bc:	5b                   	pop    %ebx
+  8008bd:	5e                   	pop    %esi
+  8008be:	5d                   	pop    %ebp
+  8008bf:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8008c0:	a1 00 50 80 00       	mov    0x805000,%eax
+  8008c5:	8b 40 48             	mov    0x48(%eax),%eax
+  8008c8:	83 ec 04             	sub    $0x4,%esp
+  8008cb:	56                   	push   %esi
+  8008cc:	50                   	push   %eax
+  8008cd:	68 b9 37 80 00       	push   $0x8037b9
+  8008d2:	e8 3d 1d 00 00       	call   802614 <cprintf>
+		return -E_INVAL;
+  8008d7:	83 c4 10             	add    $0x10,%esp
+  8008da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008df:	eb d8                	jmp    8008b9 <read+0x58>
+		return -E_NOT_SUPP;
+  8008e1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8008e6:	eb d1                	jmp    8008b9 <read+0x58>
+
+008008e8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8008e8:	55                   	push   %ebp
+  8008e9:	89 e5                	mov    %esp,%ebp
+  8008eb:	57                   	push   %edi
+  8008ec:	56                   	push   %esi
+  8008ed:	53                   	push   %ebx
+  8008ee:	83 ec 0c             	sub    $0xc,%esp
+  8008f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008f4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8008f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008fc:	eb 02                	jmp    800900 <readn+0x18>
+  8008fe:	01 c3                	add    %eax,%ebx
+  800900:	39 f3                	cmp    %esi,%ebx
+  800902:	73 21                	jae    800925 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800904:	83 ec 04             	sub    $0x4,%esp
+  800907:	89 f0                	mov    %esi,%eax
+  800909:	29 d8                	sub    %ebx,%eax
+  80090b:	50                   	push   %eax
+  80090c:	89 d8                	mov    %ebx,%eax
+  80090e:	03 45 0c             	add    0xc(%ebp),%eax
+  800911:	50                   	push   %eax
+  800912:	57                   	push   %edi
+  800913:	e8 49 ff ff ff       	call   800861 <read>
+		if (m < 0)
+  800918:	83 c4 10             	add    $0x10,%esp
+  80091b:	85 c0                	test   %eax,%eax
+  80091d:	78 04                	js     800923 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80091f:	75 dd                	jne    8008fe <readn+0x16>
+  800921:	eb 02                	jmp    800925 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800923:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800925:	89 d8                	mov    %ebx,%eax
+  800927:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80092a:	5b                   	pop    %ebx
+  80092b:	5e                   	pop    %esi
+  80092c:	5f                   	pop    %edi
+  80092d:	5d                   	pop    %ebp
+  80092e:	c3                   	ret
+
+0080092f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80092f:	55                   	push   %ebp
+  800930:	89 e5                	mov    %esp,%ebp
+  800932:	56                   	push   %esi
+  800933:	53                   	push   %ebx
+  800934:	83 ec 18             	sub    $0x18,%esp
+  800937:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80093a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80093d:	50                   	push   %eax
+  80093e:	53                   	push   %ebx
+  80093f:	e8 b7 fc ff ff       	call   8005fb <fd_lookup>
+  800944:	83 c4 10             	add    $0x10,%esp
+  800947:	85 c0                	test   %eax,%eax
+  800949:	78 37                	js     800982 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80094b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80094e:	83 ec 08             	sub    $0x8,%esp
+  800951:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800954:	50                   	push   %eax
+  800955:	ff 36                	push   (%esi)
+  800957:	e8 ef fc ff ff       	call   80064b <dev_lookup>
+  80095c:	83 c4 10             	add    $0x10,%esp
+  80095f:	85 c0                	test   %eax,%eax
+  800961:	78 1f                	js     800982 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800963:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800967:	74 20                	je     800989 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800969:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80096c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80096f:	85 c0                	test   %eax,%eax
+  800971:	74 37                	je     8009aa <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800973:	83 ec 04             	sub    $0x4,%esp
+  800976:	ff 75 10             	push   0x10(%ebp)
+  800979:	ff 75 0c             	push   0xc(%ebp)
+  80097c:	56                   	push   %esi
+  80097d:	ff d0                	call   *%eax
+  80097f:	83 c4 10             	add    $0x10,%esp
+}
+  800982:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800985:	5b                   	pop    %ebx
+  800986:	5e                   	pop    %esi
+  800987:	5d                   	pop    %ebp
+  800988:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800989:	a1 00 50 80 00       	mov    0x805000,%eax
+  80098e:	8b 40 48             	mov    0x48(%eax),%eax
+  800991:	83 ec 04             	sub    $0x4,%esp
+  800994:	53                   	push   %ebx
+  800995:	50                   	push   %eax
+  800996:	68 d5 37 80 00       	push   $0x8037d5
+  80099b:	e8 74 1c 00 00       	call   802614 <cprintf>
+		return -E_INVAL;
+  8009a0:	83 c4 10             	add    $0x10,%esp
+  8009a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009a8:	eb d8                	jmp    800982 <write+0x53>
+		return -E_NOT_SUPP;
+  8009aa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009af:	eb d1                	jmp    800982 <write+0x53>
+
+008009b1 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8009b1:	55                   	push   %ebp
+  8009b2:	89 e5                	mov    %esp,%ebp
+  8009b4:	53                   	push   %ebx
+  8009b5:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009b8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009bb:	50                   	push   %eax
+  8009bc:	ff 75 08             	push   0x8(%ebp)
+  8009bf:	e8 37 fc ff ff       	call   8005fb <fd_lookup>
+  8009c4:	83 c4 10             	add    $0x10,%esp
+  8009c7:	85 c0                	test   %eax,%eax
+  8009c9:	78 3a                	js     800a05 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009cb:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8009ce:	83 ec 08             	sub    $0x8,%esp
+  8009d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009d4:	50                   	push   %eax
+  8009d5:	ff 33                	push   (%ebx)
+  8009d7:	e8 6f fc ff ff       	call   80064b <dev_lookup>
+  8009dc:	83 c4 10             	add    $0x10,%esp
+  8009df:	85 c0                	test   %eax,%eax
+  8009e1:	78 22                	js     800a05 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8009e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009e6:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8009e9:	85 c0                	test   %eax,%eax
+  8009eb:	74 0d                	je     8009fa <seek+0x49>
+  8009ed:	83 ec 0c             	sub    $0xc,%esp
+  8009f0:	53                   	push   %ebx
+  8009f1:	ff d0                	call   *%eax
+  8009f3:	83 c4 10             	add    $0x10,%esp
+  8009f6:	85 c0                	test   %eax,%eax
+  8009f8:	78 0b                	js     800a05 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8009fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009fd:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  800a00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a08:	c9                   	leave
+  800a09:	c3                   	ret
+
+00800a0a <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  800a0a:	55                   	push   %ebp
+  800a0b:	89 e5                	mov    %esp,%ebp
+  800a0d:	53                   	push   %ebx
+  800a0e:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a11:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a14:	50                   	push   %eax
+  800a15:	ff 75 08             	push   0x8(%ebp)
+  800a18:	e8 de fb ff ff       	call   8005fb <fd_lookup>
+  800a1d:	83 c4 10             	add    $0x10,%esp
+  800a20:	85 c0                	test   %eax,%eax
+  800a22:	78 2b                	js     800a4f <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a24:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a27:	83 ec 08             	sub    $0x8,%esp
+  800a2a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a2d:	50                   	push   %eax
+  800a2e:	ff 33                	push   (%ebx)
+  800a30:	e8 16 fc ff ff       	call   80064b <dev_lookup>
+  800a35:	83 c4 10             	add    $0x10,%esp
+  800a38:	85 c0                	test   %eax,%eax
+  800a3a:	78 13                	js     800a4f <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  800a3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a3f:	8b 40 1c             	mov    0x1c(%eax),%eax
+  800a42:	85 c0                	test   %eax,%eax
+  800a44:	74 0e                	je     800a54 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  800a46:	83 ec 0c             	sub    $0xc,%esp
+  800a49:	53                   	push   %ebx
+  800a4a:	ff d0                	call   *%eax
+  800a4c:	83 c4 10             	add    $0x10,%esp
+}
+  800a4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a52:	c9                   	leave
+  800a53:	c3                   	ret
+		return 0;
+  800a54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a59:	eb f4                	jmp    800a4f <fsync+0x45>
+
+00800a5b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a5b:	55                   	push   %ebp
+  800a5c:	89 e5                	mov    %esp,%ebp
+  800a5e:	56                   	push   %esi
+  800a5f:	53                   	push   %ebx
+  800a60:	83 ec 18             	sub    $0x18,%esp
+  800a63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a66:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a69:	50                   	push   %eax
+  800a6a:	53                   	push   %ebx
+  800a6b:	e8 8b fb ff ff       	call   8005fb <fd_lookup>
+  800a70:	83 c4 10             	add    $0x10,%esp
+  800a73:	85 c0                	test   %eax,%eax
+  800a75:	78 34                	js     800aab <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a77:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a7a:	83 ec 08             	sub    $0x8,%esp
+  800a7d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a80:	50                   	push   %eax
+  800a81:	ff 36                	push   (%esi)
+  800a83:	e8 c3 fb ff ff       	call   80064b <dev_lookup>
+  800a88:	83 c4 10             	add    $0x10,%esp
+  800a8b:	85 c0                	test   %eax,%eax
+  800a8d:	78 1c                	js     800aab <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a8f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a93:	74 1d                	je     800ab2 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800a95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a98:	8b 40 18             	mov    0x18(%eax),%eax
+  800a9b:	85 c0                	test   %eax,%eax
+  800a9d:	74 34                	je     800ad3 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800a9f:	83 ec 08             	sub    $0x8,%esp
+  800aa2:	ff 75 0c             	push   0xc(%ebp)
+  800aa5:	56                   	push   %esi
+  800aa6:	ff d0                	call   *%eax
+  800aa8:	83 c4 10             	add    $0x10,%esp
+}
+  800aab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aae:	5b                   	pop    %ebx
+  800aaf:	5e                   	pop    %esi
+  800ab0:	5d                   	pop    %ebp
+  800ab1:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800ab2:	a1 00 50 80 00       	mov    0x805000,%eax
+  800ab7:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800aba:	83 ec 04             	sub    $0x4,%esp
+  800abd:	53                   	push   %ebx
+  800abe:	50                   	push   %eax
+  800abf:	68 98 37 80 00       	push   $0x803798
+  800ac4:	e8 4b 1b 00 00       	call   802614 <cprintf>
+		return -E_INVAL;
+  800ac9:	83 c4 10             	add    $0x10,%esp
+  800acc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad1:	eb d8                	jmp    800aab <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800ad3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ad8:	eb d1                	jmp    800aab <ftruncate+0x50>
+
+00800ada <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800ada:	55                   	push   %ebp
+  800adb:	89 e5                	mov    %esp,%ebp
+  800add:	56                   	push   %esi
+  800ade:	53                   	push   %ebx
+  800adf:	83 ec 18             	sub    $0x18,%esp
+  800ae2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ae5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ae8:	50                   	push   %eax
+  800ae9:	ff 75 08             	push   0x8(%ebp)
+  800aec:	e8 0a fb ff ff       	call   8005fb <fd_lookup>
+  800af1:	83 c4 10             	add    $0x10,%esp
+  800af4:	85 c0                	test   %eax,%eax
+  800af6:	78 49                	js     800b41 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800af8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800afb:	83 ec 08             	sub    $0x8,%esp
+  800afe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b01:	50                   	push   %eax
+  800b02:	ff 36                	push   (%esi)
+  800b04:	e8 42 fb ff ff       	call   80064b <dev_lookup>
+  800b09:	83 c4 10             	add    $0x10,%esp
+  800b0c:	85 c0                	test   %eax,%eax
+  800b0e:	78 31                	js     800b41 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b13:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b17:	74 2f                	je     800b48 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b19:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b1c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b23:	00 00 00 
+	stat->st_isdir = 0;
+  800b26:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b2d:	00 00 00 
+	stat->st_dev = dev;
+  800b30:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b36:	83 ec 08             	sub    $0x8,%esp
+  800b39:	53                   	push   %ebx
+  800b3a:	56                   	push   %esi
+  800b3b:	ff 50 14             	call   *0x14(%eax)
+  800b3e:	83 c4 10             	add    $0x10,%esp
+}
+  800b41:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b44:	5b                   	pop    %ebx
+  800b45:	5e                   	pop    %esi
+  800b46:	5d                   	pop    %ebp
+  800b47:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b48:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b4d:	eb f2                	jmp    800b41 <fstat+0x67>
+
+00800b4f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b4f:	55                   	push   %ebp
+  800b50:	89 e5                	mov    %esp,%ebp
+  800b52:	56                   	push   %esi
+  800b53:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  800b54:	83 ec 08             	sub    $0x8,%esp
+  800b57:	68 00 10 00 00       	push   $0x1000
+  800b5c:	ff 75 08             	push   0x8(%ebp)
+  800b5f:	e8 b3 07 00 00       	call   801317 <open>
+  800b64:	89 c3                	mov    %eax,%ebx
+  800b66:	83 c4 10             	add    $0x10,%esp
+  800b69:	85 c0                	test   %eax,%eax
+  800b6b:	78 1b                	js     800b88 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  800b6d:	83 ec 08             	sub    $0x8,%esp
+  800b70:	ff 75 0c             	push   0xc(%ebp)
+  800b73:	50                   	push   %eax
+  800b74:	e8 61 ff ff ff       	call   800ada <fstat>
+  800b79:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800b7b:	89 1c 24             	mov    %ebx,(%esp)
+  800b7e:	e8 a2 fb ff ff       	call   800725 <close>
+	return r;
+  800b83:	83 c4 10             	add    $0x10,%esp
+  800b86:	89 f3                	mov    %esi,%ebx
+}
+  800b88:	89 d8                	mov    %ebx,%eax
+  800b8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b8d:	5b                   	pop    %ebx
+  800b8e:	5e                   	pop    %esi
+  800b8f:	5d                   	pop    %ebp
+  800b90:	c3                   	ret
+
+00800b91 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  800b91:	55                   	push   %ebp
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	57                   	push   %edi
+  800b95:	56                   	push   %esi
+  800b96:	53                   	push   %ebx
+  800b97:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  800b9d:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  800ba3:	89 d6                	mov    %edx,%esi
+  800ba5:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  800bab:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  800bae:	89 d3                	mov    %edx,%ebx
+  800bb0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  800bb6:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800bbd:	74 1d                	je     800bdc <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  800bbf:	b8 00 60 80 00       	mov    $0x806000,%eax
+  800bc4:	83 c8 07             	or     $0x7,%eax
+  800bc7:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  800bcd:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800bd2:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  800bd8:	01 ce                	add    %ecx,%esi
+  800bda:	eb 28                	jmp    800c04 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800bdc:	83 ec 0c             	sub    $0xc,%esp
+  800bdf:	6a 01                	push   $0x1
+  800be1:	e8 05 28 00 00       	call   8033eb <ipc_find_env>
+  800be6:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800beb:	83 c4 10             	add    $0x10,%esp
+  800bee:	eb cf                	jmp    800bbf <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  800bf0:	83 c0 01             	add    $0x1,%eax
+  800bf3:	89 fa                	mov    %edi,%edx
+  800bf5:	09 da                	or     %ebx,%edx
+  800bf7:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800bfe:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800c04:	39 f3                	cmp    %esi,%ebx
+  800c06:	72 e8                	jb     800bf0 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  800c08:	83 f8 41             	cmp    $0x41,%eax
+  800c0b:	77 2f                	ja     800c3c <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  800c0d:	50                   	push   %eax
+  800c0e:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  800c14:	50                   	push   %eax
+  800c15:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  800c1b:	ff 35 c8 70 80 00    	push   0x8070c8
+  800c21:	e8 77 27 00 00       	call   80339d <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  800c26:	83 c4 0c             	add    $0xc,%esp
+  800c29:	6a 00                	push   $0x0
+  800c2b:	6a 00                	push   $0x0
+  800c2d:	6a 00                	push   $0x0
+  800c2f:	e8 13 26 00 00       	call   803247 <ipc_recv>
+}
+  800c34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c37:	5b                   	pop    %ebx
+  800c38:	5e                   	pop    %esi
+  800c39:	5f                   	pop    %edi
+  800c3a:	5d                   	pop    %ebp
+  800c3b:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  800c3c:	68 08 38 80 00       	push   $0x803808
+  800c41:	68 24 38 80 00       	push   $0x803824
+  800c46:	6a 40                	push   $0x40
+  800c48:	68 39 38 80 00       	push   $0x803839
+  800c4d:	e8 e7 18 00 00       	call   802539 <_panic>
+
+00800c52 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  800c52:	55                   	push   %ebp
+  800c53:	89 e5                	mov    %esp,%ebp
+  800c55:	57                   	push   %edi
+  800c56:	56                   	push   %esi
+  800c57:	53                   	push   %ebx
+  800c58:	83 ec 1c             	sub    $0x1c,%esp
+  800c5b:	89 c3                	mov    %eax,%ebx
+  800c5d:	89 d6                	mov    %edx,%esi
+  800c5f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  800c62:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  800c68:	89 ca                	mov    %ecx,%edx
+  800c6a:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  800c6d:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  800c74:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  800c77:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  800c7e:	8b 76 0c             	mov    0xc(%esi),%esi
+  800c81:	89 fb                	mov    %edi,%ebx
+  800c83:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  800c8a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c8d:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  800c94:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c97:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  800c9e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ca1:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  800ca8:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  800cab:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  800cb2:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  800cb7:	39 c8                	cmp    %ecx,%eax
+  800cb9:	74 0d                	je     800cc8 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  800cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc3:	5b                   	pop    %ebx
+  800cc4:	5e                   	pop    %esi
+  800cc5:	5f                   	pop    %edi
+  800cc6:	5d                   	pop    %ebp
+  800cc7:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cc8:	6a 07                	push   $0x7
+  800cca:	68 00 60 80 00       	push   $0x806000
+  800ccf:	6a 0d                	push   $0xd
+  800cd1:	ff 35 c8 70 80 00    	push   0x8070c8
+  800cd7:	e8 d6 25 00 00       	call   8032b2 <ipc_send>
+  800cdc:	83 c4 10             	add    $0x10,%esp
+  800cdf:	eb da                	jmp    800cbb <fsring_post+0x69>
+
+00800ce1 <fsipcv>:
+{
+  800ce1:	55                   	push   %ebp
+  800ce2:	89 e5                	mov    %esp,%ebp
+  800ce4:	57                   	push   %edi
+  800ce5:	56                   	push   %esi
+  800ce6:	53                   	push   %ebx
+  800ce7:	83 ec 0c             	sub    $0xc,%esp
+  800cea:	89 c7                	mov    %eax,%edi
+  800cec:	89 d3                	mov    %edx,%ebx
+  800cee:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  800cf0:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800cf7:	74 26                	je     800d1f <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cf9:	6a 07                	push   $0x7
+  800cfb:	68 00 60 80 00       	push   $0x806000
+  800d00:	57                   	push   %edi
+  800d01:	ff 35 c8 70 80 00    	push   0x8070c8
+  800d07:	e8 a6 25 00 00       	call   8032b2 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  800d0c:	6a 00                	push   $0x0
+  800d0e:	56                   	push   %esi
+  800d0f:	53                   	push   %ebx
+  800d10:	6a 00                	push   $0x0
+  800d12:	e8 f3 25 00 00       	call   80330a <ipc_recvv>
+}
+  800d17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1a:	5b                   	pop    %ebx
+  800d1b:	5e                   	pop    %esi
+  800d1c:	5f                   	pop    %edi
+  800d1d:	5d                   	pop    %ebp
+  800d1e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d1f:	83 ec 0c             	sub    $0xc,%esp
+  800d22:	6a 01                	push   $0x1
+  800d24:	e8 c2 26 00 00       	call   8033eb <ipc_find_env>
+  800d29:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800d2e:	83 c4 10             	add    $0x10,%esp
+  800d31:	eb c6                	jmp    800cf9 <fsipcv+0x18>
+
+00800d33 <fsipc>:
+{
+  800d33:	55                   	push   %ebp
+  800d34:	89 e5                	mov    %esp,%ebp
+  800d36:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  800d39:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  800d40:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800d43:	e8 99 ff ff ff       	call   800ce1 <fsipcv>
+}
+  800d48:	c9                   	leave
+  800d49:	c3                   	ret
+
+00800d4a <file_write_direct>:
+{
+  800d4a:	55                   	push   %ebp
+  800d4b:	89 e5                	mov    %esp,%ebp
+  800d4d:	56                   	push   %esi
+  800d4e:	53                   	push   %ebx
+  800d4f:	89 c3                	mov    %eax,%ebx
+  800d51:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800d53:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  800d59:	77 40                	ja     800d9b <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800d5b:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  800d60:	39 c8                	cmp    %ecx,%eax
+  800d62:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d65:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  800d68:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  800d6e:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800d73:	83 ec 04             	sub    $0x4,%esp
+  800d76:	50                   	push   %eax
+  800d77:	52                   	push   %edx
+  800d78:	68 08 60 80 00       	push   $0x806008
+  800d7d:	e8 06 20 00 00       	call   802d88 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800d82:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d87:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d8c:	e8 a2 ff ff ff       	call   800d33 <fsipc>
+  800d91:	83 c4 10             	add    $0x10,%esp
+}
+  800d94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d97:	5b                   	pop    %ebx
+  800d98:	5e                   	pop    %esi
+  800d99:	5d                   	pop    %ebp
+  800d9a:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  800d9b:	89 d6                	mov    %edx,%esi
+  800d9d:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  800da3:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  800da8:	29 f1                	sub    %esi,%ecx
+  800daa:	39 c1                	cmp    %eax,%ecx
+  800dac:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  800daf:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800db2:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  800db7:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  800dbd:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  800dc3:	83 ec 0c             	sub    $0xc,%esp
+  800dc6:	6a 05                	push   $0x5
+  800dc8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dcd:	e8 bf fd ff ff       	call   800b91 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  800dd2:	83 c4 10             	add    $0x10,%esp
+  800dd5:	eb bd                	jmp    800d94 <file_write_direct+0x4a>
+
+00800dd7 <devfile_sync>:
+{
+  800dd7:	55                   	push   %ebp
+  800dd8:	89 e5                	mov    %esp,%ebp
+  800dda:	57                   	push   %edi
+  800ddb:	56                   	push   %esi
+  800ddc:	53                   	push   %ebx
+  800ddd:	83 ec 28             	sub    $0x28,%esp
+  800de0:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  800de3:	56                   	push   %esi
+  800de4:	e8 a5 f7 ff ff       	call   80058e <fd2data>
+  800de9:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  800deb:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  800dee:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  800df5:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800df8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  800dfd:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  800e01:	74 45                	je     800e48 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  800e03:	8b 46 14             	mov    0x14(%esi),%eax
+  800e06:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e13:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e16:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  800e19:	39 cb                	cmp    %ecx,%ebx
+  800e1b:	73 14                	jae    800e31 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  800e1d:	29 d9                	sub    %ebx,%ecx
+  800e1f:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800e22:	89 f0                	mov    %esi,%eax
+  800e24:	e8 21 ff ff ff       	call   800d4a <file_write_direct>
+  800e29:	85 c0                	test   %eax,%eax
+  800e2b:	7e 04                	jle    800e31 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e2d:	01 c3                	add    %eax,%ebx
+  800e2f:	eb e5                	jmp    800e16 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  800e31:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e34:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  800e3b:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  800e3e:	85 c0                	test   %eax,%eax
+  800e40:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e45:	0f 4f c2             	cmovg  %edx,%eax
+}
+  800e48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4b:	5b                   	pop    %ebx
+  800e4c:	5e                   	pop    %esi
+  800e4d:	5f                   	pop    %edi
+  800e4e:	5d                   	pop    %ebp
+  800e4f:	c3                   	ret
+
+00800e50 <devfile_write>:
+{
+  800e50:	55                   	push   %ebp
+  800e51:	89 e5                	mov    %esp,%ebp
+  800e53:	57                   	push   %edi
+  800e54:	56                   	push   %esi
+  800e55:	53                   	push   %ebx
+  800e56:	83 ec 28             	sub    $0x28,%esp
+  800e59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e5c:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  800e5f:	53                   	push   %ebx
+  800e60:	e8 29 f7 ff ff       	call   80058e <fd2data>
+  800e65:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  800e68:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  800e6b:	83 c4 10             	add    $0x10,%esp
+  800e6e:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  800e72:	74 43                	je     800eb7 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  800e74:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  800e7b:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800e7e:	85 c0                	test   %eax,%eax
+  800e80:	74 43                	je     800ec5 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  800e82:	89 c2                	mov    %eax,%edx
+  800e84:	03 53 14             	add    0x14(%ebx),%edx
+  800e87:	39 fa                	cmp    %edi,%edx
+  800e89:	75 0b                	jne    800e96 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  800e8b:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  800e8e:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  800e94:	76 66                	jbe    800efc <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  800e96:	83 ec 0c             	sub    $0xc,%esp
+  800e99:	53                   	push   %ebx
+  800e9a:	e8 38 ff ff ff       	call   800dd7 <devfile_sync>
+  800e9f:	83 c4 10             	add    $0x10,%esp
+  800ea2:	85 c0                	test   %eax,%eax
+  800ea4:	78 4e                	js     800ef4 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800ea6:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800eac:	77 56                	ja     800f04 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  800eae:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800eb1:	85 c0                	test   %eax,%eax
+  800eb3:	75 20                	jne    800ed5 <devfile_write+0x85>
+  800eb5:	eb 16                	jmp    800ecd <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  800eb7:	89 f1                	mov    %esi,%ecx
+  800eb9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ebc:	89 d8                	mov    %ebx,%eax
+  800ebe:	e8 87 fe ff ff       	call   800d4a <file_write_direct>
+  800ec3:	eb 2f                	jmp    800ef4 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800ec5:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800ecb:	77 37                	ja     800f04 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  800ecd:	89 7b 14             	mov    %edi,0x14(%ebx)
+  800ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  800ed5:	83 ec 04             	sub    $0x4,%esp
+  800ed8:	56                   	push   %esi
+  800ed9:	ff 75 0c             	push   0xc(%ebp)
+  800edc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800edf:	01 c1                	add    %eax,%ecx
+  800ee1:	51                   	push   %ecx
+  800ee2:	e8 a1 1e 00 00       	call   802d88 <memmove>
+	ff->buf_wlen += n;
+  800ee7:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  800eea:	01 f7                	add    %esi,%edi
+  800eec:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  800eef:	89 f0                	mov    %esi,%eax
+  800ef1:	83 c4 10             	add    $0x10,%esp
+}
+  800ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  800efc:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800f02:	76 d1                	jbe    800ed5 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  800f04:	89 f1                	mov    %esi,%ecx
+  800f06:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f09:	89 d8                	mov    %ebx,%eax
+  800f0b:	e8 3a fe ff ff       	call   800d4a <file_write_direct>
+  800f10:	eb e2                	jmp    800ef4 <devfile_write+0xa4>
+
+00800f12 <devfile_trunc>:
+{
+  800f12:	55                   	push   %ebp
+  800f13:	89 e5                	mov    %esp,%ebp
+  800f15:	53                   	push   %ebx
+  800f16:	83 ec 10             	sub    $0x10,%esp
+  800f19:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  800f1c:	53                   	push   %ebx
+  800f1d:	e8 b5 fe ff ff       	call   800dd7 <devfile_sync>
+  800f22:	83 c4 10             	add    $0x10,%esp
+  800f25:	85 c0                	test   %eax,%eax
+  800f27:	78 1f                	js     800f48 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800f29:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f2c:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800f31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f34:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800f39:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f3e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f43:	e8 eb fd ff ff       	call   800d33 <fsipc>
+}
+  800f48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f4b:	c9                   	leave
+  800f4c:	c3                   	ret
+
+00800f4d <devfile_stat>:
+{
+  800f4d:	55                   	push   %ebp
+  800f4e:	89 e5                	mov    %esp,%ebp
+  800f50:	56                   	push   %esi
+  800f51:	53                   	push   %ebx
+  800f52:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800f55:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  800f58:	83 ec 0c             	sub    $0xc,%esp
+  800f5b:	53                   	push   %ebx
+  800f5c:	e8 76 fe ff ff       	call   800dd7 <devfile_sync>
+  800f61:	83 c4 10             	add    $0x10,%esp
+  800f64:	85 c0                	test   %eax,%eax
+  800f66:	78 47                	js     800faf <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800f68:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f6b:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800f70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f75:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f7a:	e8 b4 fd ff ff       	call   800d33 <fsipc>
+  800f7f:	85 c0                	test   %eax,%eax
+  800f81:	78 2c                	js     800faf <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f83:	83 ec 08             	sub    $0x8,%esp
+  800f86:	68 00 60 80 00       	push   $0x806000
+  800f8b:	56                   	push   %esi
+  800f8c:	e8 71 1c 00 00       	call   802c02 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800f91:	a1 80 60 80 00       	mov    0x806080,%eax
+  800f96:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800f9c:	a1 84 60 80 00       	mov    0x806084,%eax
+  800fa1:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  800fa7:	83 c4 10             	add    $0x10,%esp
+  800faa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800faf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fb2:	5b                   	pop    %ebx
+  800fb3:	5e                   	pop    %esi
+  800fb4:	5d                   	pop    %ebp
+  800fb5:	c3                   	ret
+
+00800fb6 <devfile_flush>:
+{
+  800fb6:	55                   	push   %ebp
+  800fb7:	89 e5                	mov    %esp,%ebp
+  800fb9:	56                   	push   %esi
+  800fba:	53                   	push   %ebx
+  800fbb:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  800fbe:	83 ec 0c             	sub    $0xc,%esp
+  800fc1:	56                   	push   %esi
+  800fc2:	e8 10 fe ff ff       	call   800dd7 <devfile_sync>
+  800fc7:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  800fc9:	83 c4 10             	add    $0x10,%esp
+  800fcc:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  800fd0:	75 25                	jne    800ff7 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800fd2:	8b 46 0c             	mov    0xc(%esi),%eax
+  800fd5:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  800fda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fdf:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fe4:	e8 4a fd ff ff       	call   800d33 <fsipc>
+  800fe9:	85 c0                	test   %eax,%eax
+  800feb:	0f 45 d8             	cmovne %eax,%ebx
+}
+  800fee:	89 d8                	mov    %ebx,%eax
+  800ff0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ff3:	5b                   	pop    %ebx
+  800ff4:	5e                   	pop    %esi
+  800ff5:	5d                   	pop    %ebp
+  800ff6:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  800ff7:	83 ec 0c             	sub    $0xc,%esp
+  800ffa:	56                   	push   %esi
+  800ffb:	e8 8e f5 ff ff       	call   80058e <fd2data>
+  801000:	83 c4 08             	add    $0x8,%esp
+  801003:	50                   	push   %eax
+  801004:	6a 00                	push   $0x0
+  801006:	e8 ff f1 ff ff       	call   80020a <sys_page_unmap>
+  80100b:	83 c4 10             	add    $0x10,%esp
+  80100e:	eb c2                	jmp    800fd2 <devfile_flush+0x1c>
+
+00801010 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801010:	55                   	push   %ebp
+  801011:	89 e5                	mov    %esp,%ebp
+  801013:	57                   	push   %edi
+  801014:	56                   	push   %esi
+  801015:	53                   	push   %ebx
+  801016:	83 ec 64             	sub    $0x64,%esp
+  801019:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  80101b:	52                   	push   %edx
+  80101c:	50                   	push   %eax
+  80101d:	e8 d9 f5 ff ff       	call   8005fb <fd_lookup>
+  801022:	89 c1                	mov    %eax,%ecx
+  801024:	83 c4 10             	add    $0x10,%esp
+  801027:	85 c0                	test   %eax,%eax
+  801029:	0f 88 f2 00 00 00    	js     801121 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  80102f:	8b 07                	mov    (%edi),%eax
+  801031:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801037:	39 10                	cmp    %edx,(%eax)
+  801039:	0f 85 03 01 00 00    	jne    801142 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  80103f:	a1 00 50 80 00       	mov    0x805000,%eax
+  801044:	8b 40 48             	mov    0x48(%eax),%eax
+  801047:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  80104d:	0f 84 96 00 00 00    	je     8010e9 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801053:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  80105a:	0f 84 cb 00 00 00    	je     80112b <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801060:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801065:	83 c8 07             	or     $0x7,%eax
+  801068:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  80106b:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80106e:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801073:	83 ec 04             	sub    $0x4,%esp
+  801076:	68 07 04 00 00       	push   $0x407
+  80107b:	53                   	push   %ebx
+  80107c:	6a 00                	push   $0x0
+  80107e:	e8 fa f0 ff ff       	call   80017d <sys_page_alloc>
+  801083:	89 c1                	mov    %eax,%ecx
+  801085:	83 c4 10             	add    $0x10,%esp
+  801088:	85 c0                	test   %eax,%eax
+  80108a:	0f 88 91 00 00 00    	js     801121 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801090:	89 d8                	mov    %ebx,%eax
+  801092:	83 c8 07             	or     $0x7,%eax
+  801095:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801097:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80109d:	83 c6 04             	add    $0x4,%esi
+  8010a0:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8010a6:	75 cb                	jne    801073 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8010a8:	6a 12                	push   $0x12
+  8010aa:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8010ad:	50                   	push   %eax
+  8010ae:	6a 0c                	push   $0xc
+  8010b0:	ff 35 c8 70 80 00    	push   0x8070c8
+  8010b6:	e8 e2 22 00 00       	call   80339d <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8010bb:	83 c4 0c             	add    $0xc,%esp
+  8010be:	6a 00                	push   $0x0
+  8010c0:	6a 00                	push   $0x0
+  8010c2:	6a 00                	push   $0x0
+  8010c4:	e8 7e 21 00 00       	call   803247 <ipc_recv>
+  8010c9:	89 c1                	mov    %eax,%ecx
+  8010cb:	83 c4 10             	add    $0x10,%esp
+  8010ce:	85 c0                	test   %eax,%eax
+  8010d0:	78 4f                	js     801121 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  8010d2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8010d7:	8b 40 48             	mov    0x48(%eax),%eax
+  8010da:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  8010df:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  8010e6:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  8010e9:	83 ec 0c             	sub    $0xc,%esp
+  8010ec:	ff 37                	push   (%edi)
+  8010ee:	e8 e4 fc ff ff       	call   800dd7 <devfile_sync>
+  8010f3:	89 c1                	mov    %eax,%ecx
+  8010f5:	83 c4 10             	add    $0x10,%esp
+  8010f8:	85 c0                	test   %eax,%eax
+  8010fa:	78 25                	js     801121 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  8010fc:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801102:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801107:	ba 01 00 00 00       	mov    $0x1,%edx
+  80110c:	89 d0                	mov    %edx,%eax
+  80110e:	d3 e0                	shl    %cl,%eax
+  801110:	85 d8                	test   %ebx,%eax
+  801112:	74 0d                	je     801121 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801114:	83 c1 01             	add    $0x1,%ecx
+  801117:	83 f9 10             	cmp    $0x10,%ecx
+  80111a:	75 f0                	jne    80110c <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  80111c:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801121:	89 c8                	mov    %ecx,%eax
+  801123:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801126:	5b                   	pop    %ebx
+  801127:	5e                   	pop    %esi
+  801128:	5f                   	pop    %edi
+  801129:	5d                   	pop    %ebp
+  80112a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80112b:	83 ec 0c             	sub    $0xc,%esp
+  80112e:	6a 01                	push   $0x1
+  801130:	e8 b6 22 00 00       	call   8033eb <ipc_find_env>
+  801135:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  80113a:	83 c4 10             	add    $0x10,%esp
+  80113d:	e9 1e ff ff ff       	jmp    801060 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801142:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801147:	eb d8                	jmp    801121 <fsring_slot+0x111>
+
+00801149 <file_read_direct>:
+{
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	57                   	push   %edi
+  80114d:	56                   	push   %esi
+  80114e:	53                   	push   %ebx
+  80114f:	83 ec 1c             	sub    $0x1c,%esp
+  801152:	89 c7                	mov    %eax,%edi
+  801154:	89 d6                	mov    %edx,%esi
+  801156:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801158:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  80115e:	77 52                	ja     8011b2 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801160:	8b 40 0c             	mov    0xc(%eax),%eax
+  801163:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801168:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80116e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801173:	b8 03 00 00 00       	mov    $0x3,%eax
+  801178:	e8 b6 fb ff ff       	call   800d33 <fsipc>
+  80117d:	89 c7                	mov    %eax,%edi
+  80117f:	85 c0                	test   %eax,%eax
+  801181:	78 25                	js     8011a8 <file_read_direct+0x5f>
+	assert(r <= n);
+  801183:	39 c3                	cmp    %eax,%ebx
+  801185:	0f 82 87 00 00 00    	jb     801212 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  80118b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801190:	0f 8f 95 00 00 00    	jg     80122b <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801196:	83 ec 04             	sub    $0x4,%esp
+  801199:	50                   	push   %eax
+  80119a:	68 00 60 80 00       	push   $0x806000
+  80119f:	56                   	push   %esi
+  8011a0:	e8 e3 1b 00 00       	call   802d88 <memmove>
+	return r;
+  8011a5:	83 c4 10             	add    $0x10,%esp
+}
+  8011a8:	89 f8                	mov    %edi,%eax
+  8011aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ad:	5b                   	pop    %ebx
+  8011ae:	5e                   	pop    %esi
+  8011af:	5f                   	pop    %edi
+  8011b0:	5d                   	pop    %ebp
+  8011b1:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8011b2:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8011b8:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8011bd:	29 d1                	sub    %edx,%ecx
+  8011bf:	39 d9                	cmp    %ebx,%ecx
+  8011c1:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011c4:	89 f0                	mov    %esi,%eax
+  8011c6:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8011c9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8011cc:	eb 0f                	jmp    8011dd <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8011ce:	0f b6 10             	movzbl (%eax),%edx
+  8011d1:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011d3:	05 00 10 00 00       	add    $0x1000,%eax
+  8011d8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011dd:	39 c8                	cmp    %ecx,%eax
+  8011df:	72 ed                	jb     8011ce <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  8011e1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8011e4:	8b 47 0c             	mov    0xc(%edi),%eax
+  8011e7:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  8011ec:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8011f2:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  8011f8:	83 ec 0c             	sub    $0xc,%esp
+  8011fb:	6a 07                	push   $0x7
+  8011fd:	89 d9                	mov    %ebx,%ecx
+  8011ff:	89 f2                	mov    %esi,%edx
+  801201:	b8 09 00 00 00       	mov    $0x9,%eax
+  801206:	e8 86 f9 ff ff       	call   800b91 <fsipc_pages>
+  80120b:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  80120d:	83 c4 10             	add    $0x10,%esp
+  801210:	eb 96                	jmp    8011a8 <file_read_direct+0x5f>
+	assert(r <= n);
+  801212:	68 44 38 80 00       	push   $0x803844
+  801217:	68 24 38 80 00       	push   $0x803824
+  80121c:	68 dc 00 00 00       	push   $0xdc
+  801221:	68 39 38 80 00       	push   $0x803839
+  801226:	e8 0e 13 00 00       	call   802539 <_panic>
+	assert(r <= PGSIZE);
+  80122b:	68 55 38 80 00       	push   $0x803855
+  801230:	68 24 38 80 00       	push   $0x803824
+  801235:	68 dd 00 00 00       	push   $0xdd
+  80123a:	68 39 38 80 00       	push   $0x803839
+  80123f:	e8 f5 12 00 00       	call   802539 <_panic>
+
+00801244 <devfile_read>:
+{
+  801244:	55                   	push   %ebp
+  801245:	89 e5                	mov    %esp,%ebp
+  801247:	57                   	push   %edi
+  801248:	56                   	push   %esi
+  801249:	53                   	push   %ebx
+  80124a:	83 ec 28             	sub    $0x28,%esp
+  80124d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801250:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801253:	53                   	push   %ebx
+  801254:	e8 35 f3 ff ff       	call   80058e <fd2data>
+  801259:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  80125c:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80125f:	83 c4 10             	add    $0x10,%esp
+  801262:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801266:	74 7d                	je     8012e5 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801268:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80126c:	0f 85 81 00 00 00    	jne    8012f3 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801272:	8b 43 18             	mov    0x18(%ebx),%eax
+  801275:	85 c0                	test   %eax,%eax
+  801277:	74 0d                	je     801286 <devfile_read+0x42>
+  801279:	8b 53 14             	mov    0x14(%ebx),%edx
+  80127c:	39 fa                	cmp    %edi,%edx
+  80127e:	7f 06                	jg     801286 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801280:	01 c2                	add    %eax,%edx
+  801282:	39 d7                	cmp    %edx,%edi
+  801284:	72 28                	jb     8012ae <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801286:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  80128d:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801293:	77 74                	ja     801309 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801295:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80129a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80129d:	89 d8                	mov    %ebx,%eax
+  80129f:	e8 a5 fe ff ff       	call   801149 <file_read_direct>
+  8012a4:	85 c0                	test   %eax,%eax
+  8012a6:	7e 35                	jle    8012dd <devfile_read+0x99>
+		ff->buf_base = pos;
+  8012a8:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8012ab:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8012ae:	8b 53 14             	mov    0x14(%ebx),%edx
+  8012b1:	89 d0                	mov    %edx,%eax
+  8012b3:	03 43 18             	add    0x18(%ebx),%eax
+  8012b6:	29 f8                	sub    %edi,%eax
+  8012b8:	39 f0                	cmp    %esi,%eax
+  8012ba:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8012bd:	83 ec 04             	sub    $0x4,%esp
+  8012c0:	56                   	push   %esi
+  8012c1:	89 f8                	mov    %edi,%eax
+  8012c3:	29 d0                	sub    %edx,%eax
+  8012c5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8012c8:	01 c1                	add    %eax,%ecx
+  8012ca:	51                   	push   %ecx
+  8012cb:	ff 75 0c             	push   0xc(%ebp)
+  8012ce:	e8 b5 1a 00 00       	call   802d88 <memmove>
+	fd->fd_offset = pos + n;
+  8012d3:	01 f7                	add    %esi,%edi
+  8012d5:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8012d8:	89 f0                	mov    %esi,%eax
+  8012da:	83 c4 10             	add    $0x10,%esp
+}
+  8012dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e0:	5b                   	pop    %ebx
+  8012e1:	5e                   	pop    %esi
+  8012e2:	5f                   	pop    %edi
+  8012e3:	5d                   	pop    %ebp
+  8012e4:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  8012e5:	89 f1                	mov    %esi,%ecx
+  8012e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012ea:	89 d8                	mov    %ebx,%eax
+  8012ec:	e8 58 fe ff ff       	call   801149 <file_read_direct>
+  8012f1:	eb ea                	jmp    8012dd <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8012f3:	83 ec 0c             	sub    $0xc,%esp
+  8012f6:	53                   	push   %ebx
+  8012f7:	e8 db fa ff ff       	call   800dd7 <devfile_sync>
+  8012fc:	83 c4 10             	add    $0x10,%esp
+  8012ff:	85 c0                	test   %eax,%eax
+  801301:	0f 89 6b ff ff ff    	jns    801272 <devfile_read+0x2e>
+  801307:	eb d4                	jmp    8012dd <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801309:	89 f1                	mov    %esi,%ecx
+  80130b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80130e:	89 d8                	mov    %ebx,%eax
+  801310:	e8 34 fe ff ff       	call   801149 <file_read_direct>
+  801315:	eb c6                	jmp    8012dd <devfile_read+0x99>
+
+00801317 <open>:
+{
+  801317:	55                   	push   %ebp
+  801318:	89 e5                	mov    %esp,%ebp
+  80131a:	56                   	push   %esi
+  80131b:	53                   	push   %ebx
+  80131c:	83 ec 1c             	sub    $0x1c,%esp
+  80131f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801322:	56                   	push   %esi
+  801323:	e8 9f 18 00 00       	call   802bc7 <strlen>
+  801328:	83 c4 10             	add    $0x10,%esp
+  80132b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801330:	0f 8f a0 00 00 00    	jg     8013d6 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801336:	83 ec 0c             	sub    $0xc,%esp
+  801339:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80133c:	50                   	push   %eax
+  80133d:	e8 63 f2 ff ff       	call   8005a5 <fd_alloc>
+  801342:	89 c3                	mov    %eax,%ebx
+  801344:	83 c4 10             	add    $0x10,%esp
+  801347:	85 c0                	test   %eax,%eax
+  801349:	78 45                	js     801390 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  80134b:	83 ec 08             	sub    $0x8,%esp
+  80134e:	56                   	push   %esi
+  80134f:	68 00 60 80 00       	push   $0x806000
+  801354:	e8 a9 18 00 00       	call   802c02 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801359:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80135c:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801361:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801364:	b8 01 00 00 00       	mov    $0x1,%eax
+  801369:	e8 c5 f9 ff ff       	call   800d33 <fsipc>
+  80136e:	89 c3                	mov    %eax,%ebx
+  801370:	83 c4 10             	add    $0x10,%esp
+  801373:	85 c0                	test   %eax,%eax
+  801375:	78 22                	js     801399 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801377:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  80137e:	74 2b                	je     8013ab <open+0x94>
+	return fd2num(fd);
+  801380:	83 ec 0c             	sub    $0xc,%esp
+  801383:	ff 75 f4             	push   -0xc(%ebp)
+  801386:	e8 f3 f1 ff ff       	call   80057e <fd2num>
+  80138b:	89 c3                	mov    %eax,%ebx
+  80138d:	83 c4 10             	add    $0x10,%esp
+}
+  801390:	89 d8                	mov    %ebx,%eax
+  801392:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801395:	5b                   	pop    %ebx
+  801396:	5e                   	pop    %esi
+  801397:	5d                   	pop    %ebp
+  801398:	c3                   	ret
+		fd_close(fd, 0);
+  801399:	83 ec 08             	sub    $0x8,%esp
+  80139c:	6a 00                	push   $0x0
+  80139e:	ff 75 f4             	push   -0xc(%ebp)
+  8013a1:	e8 f8 f2 ff ff       	call   80069e <fd_close>
+		return r;
+  8013a6:	83 c4 10             	add    $0x10,%esp
+  8013a9:	eb e5                	jmp    801390 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8013ab:	83 ec 0c             	sub    $0xc,%esp
+  8013ae:	ff 75 f4             	push   -0xc(%ebp)
+  8013b1:	e8 d8 f1 ff ff       	call   80058e <fd2data>
+  8013b6:	83 c4 0c             	add    $0xc,%esp
+  8013b9:	68 07 04 00 00       	push   $0x407
+  8013be:	50                   	push   %eax
+  8013bf:	6a 00                	push   $0x0
+  8013c1:	e8 b7 ed ff ff       	call   80017d <sys_page_alloc>
+  8013c6:	83 c4 10             	add    $0x10,%esp
+  8013c9:	85 c0                	test   %eax,%eax
+  8013cb:	75 b3                	jne    801380 <open+0x69>
+		fd->fd_file.buffered = 1;
+  8013cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013d0:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8013d4:	eb aa                	jmp    801380 <open+0x69>
+		return -E_BAD_PATH;
+  8013d6:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8013db:	eb b3                	jmp    801390 <open+0x79>
+
+008013dd <readdir>:
+{
+  8013dd:	55                   	push   %ebp
+  8013de:	89 e5                	mov    %esp,%ebp
+  8013e0:	53                   	push   %ebx
+  8013e1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013e7:	50                   	push   %eax
+  8013e8:	ff 75 08             	push   0x8(%ebp)
+  8013eb:	e8 0b f2 ff ff       	call   8005fb <fd_lookup>
+  8013f0:	89 c3                	mov    %eax,%ebx
+  8013f2:	83 c4 10             	add    $0x10,%esp
+  8013f5:	85 c0                	test   %eax,%eax
+  8013f7:	78 73                	js     80146c <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8013f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013fc:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801402:	39 08                	cmp    %ecx,(%eax)
+  801404:	0f 85 82 00 00 00    	jne    80148c <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  80140a:	83 ec 0c             	sub    $0xc,%esp
+  80140d:	50                   	push   %eax
+  80140e:	e8 c4 f9 ff ff       	call   800dd7 <devfile_sync>
+  801413:	89 c3                	mov    %eax,%ebx
+  801415:	83 c4 10             	add    $0x10,%esp
+  801418:	85 c0                	test   %eax,%eax
+  80141a:	78 50                	js     80146c <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  80141c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80141f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801422:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801427:	8b 45 10             	mov    0x10(%ebp),%eax
+  80142a:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  80142f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801432:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801437:	ba 00 00 00 00       	mov    $0x0,%edx
+  80143c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801441:	e8 ed f8 ff ff       	call   800d33 <fsipc>
+  801446:	89 c3                	mov    %eax,%ebx
+  801448:	85 c0                	test   %eax,%eax
+  80144a:	7e 20                	jle    80146c <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  80144c:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80144f:	72 22                	jb     801473 <readdir+0x96>
+  801451:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801456:	7f 1b                	jg     801473 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801458:	83 ec 04             	sub    $0x4,%esp
+  80145b:	50                   	push   %eax
+  80145c:	68 00 60 80 00       	push   $0x806000
+  801461:	ff 75 0c             	push   0xc(%ebp)
+  801464:	e8 1f 19 00 00       	call   802d88 <memmove>
+	return r;
+  801469:	83 c4 10             	add    $0x10,%esp
+}
+  80146c:	89 d8                	mov    %ebx,%eax
+  80146e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801471:	c9                   	leave
+  801472:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801473:	68 4b 38 80 00       	push   $0x80384b
+  801478:	68 24 38 80 00       	push   $0x803824
+  80147d:	68 86 01 00 00       	push   $0x186
+  801482:	68 39 38 80 00       	push   $0x803839
+  801487:	e8 ad 10 00 00       	call   802539 <_panic>
+		return -E_NOT_SUPP;
+  80148c:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801491:	eb d9                	jmp    80146c <readdir+0x8f>
+
+00801493 <munmap>:
+{
+  801493:	55                   	push   %ebp
+  801494:	89 e5                	mov    %esp,%ebp
+  801496:	56                   	push   %esi
+  801497:	53                   	push   %ebx
+  801498:	8b 75 08             	mov    0x8(%ebp),%esi
+  80149b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80149e:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8014a4:	75 41                	jne    8014e7 <munmap+0x54>
+  8014a6:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8014ac:	77 39                	ja     8014e7 <munmap+0x54>
+  8014ae:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8014b3:	29 f0                	sub    %esi,%eax
+  8014b5:	39 d0                	cmp    %edx,%eax
+  8014b7:	72 35                	jb     8014ee <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014b9:	89 f3                	mov    %esi,%ebx
+  8014bb:	01 d6                	add    %edx,%esi
+  8014bd:	39 f3                	cmp    %esi,%ebx
+  8014bf:	73 1a                	jae    8014db <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8014c1:	83 ec 08             	sub    $0x8,%esp
+  8014c4:	53                   	push   %ebx
+  8014c5:	6a 00                	push   $0x0
+  8014c7:	e8 3e ed ff ff       	call   80020a <sys_page_unmap>
+  8014cc:	83 c4 10             	add    $0x10,%esp
+  8014cf:	85 c0                	test   %eax,%eax
+  8014d1:	78 0d                	js     8014e0 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014d3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8014d9:	eb e2                	jmp    8014bd <munmap+0x2a>
+	return 0;
+  8014db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014e3:	5b                   	pop    %ebx
+  8014e4:	5e                   	pop    %esi
+  8014e5:	5d                   	pop    %ebp
+  8014e6:	c3                   	ret
+		return -E_INVAL;
+  8014e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014ec:	eb f2                	jmp    8014e0 <munmap+0x4d>
+  8014ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014f3:	eb eb                	jmp    8014e0 <munmap+0x4d>
+
+008014f5 <mmap>:
+{
+  8014f5:	55                   	push   %ebp
+  8014f6:	89 e5                	mov    %esp,%ebp
+  8014f8:	57                   	push   %edi
+  8014f9:	56                   	push   %esi
+  8014fa:	53                   	push   %ebx
+  8014fb:	83 ec 34             	sub    $0x34,%esp
+  8014fe:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801501:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801504:	50                   	push   %eax
+  801505:	ff 75 18             	push   0x18(%ebp)
+  801508:	e8 ee f0 ff ff       	call   8005fb <fd_lookup>
+  80150d:	89 c3                	mov    %eax,%ebx
+  80150f:	83 c4 10             	add    $0x10,%esp
+  801512:	85 c0                	test   %eax,%eax
+  801514:	0f 88 0e 01 00 00    	js     801628 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80151a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80151d:	a1 20 40 80 00       	mov    0x804020,%eax
+  801522:	39 02                	cmp    %eax,(%edx)
+  801524:	0f 85 50 01 00 00    	jne    80167a <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  80152a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80152d:	83 e0 02             	and    $0x2,%eax
+  801530:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801533:	74 0a                	je     80153f <mmap+0x4a>
+  801535:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801539:	0f 84 42 01 00 00    	je     801681 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  80153f:	8b 42 08             	mov    0x8(%edx),%eax
+  801542:	83 e0 03             	and    $0x3,%eax
+  801545:	83 f8 01             	cmp    $0x1,%eax
+  801548:	0f 84 3a 01 00 00    	je     801688 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  80154e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801551:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801554:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801559:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80155c:	0f 85 2d 01 00 00    	jne    80168f <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801562:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801566:	0f 88 2a 01 00 00    	js     801696 <mmap+0x1a1>
+  80156c:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  801573:	0f 87 1d 01 00 00    	ja     801696 <mmap+0x1a1>
+  801579:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80157e:	2b 45 08             	sub    0x8(%ebp),%eax
+  801581:	39 f8                	cmp    %edi,%eax
+  801583:	0f 82 14 01 00 00    	jb     80169d <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  801589:	83 ec 0c             	sub    $0xc,%esp
+  80158c:	52                   	push   %edx
+  80158d:	e8 45 f8 ff ff       	call   800dd7 <devfile_sync>
+  801592:	89 c3                	mov    %eax,%ebx
+  801594:	83 c4 10             	add    $0x10,%esp
+  801597:	85 c0                	test   %eax,%eax
+  801599:	0f 88 89 00 00 00    	js     801628 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  80159f:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8015a5:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8015ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b0:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8015b3:	39 fe                	cmp    %edi,%esi
+  8015b5:	73 7b                	jae    801632 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8015b7:	89 f8                	mov    %edi,%eax
+  8015b9:	29 f0                	sub    %esi,%eax
+  8015bb:	c1 e8 0c             	shr    $0xc,%eax
+  8015be:	ba 40 00 00 00       	mov    $0x40,%edx
+  8015c3:	39 d0                	cmp    %edx,%eax
+  8015c5:	0f 47 c2             	cmova  %edx,%eax
+  8015c8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8015cb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015ce:	8b 52 0c             	mov    0xc(%edx),%edx
+  8015d1:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  8015d7:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8015da:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  8015e0:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8015e5:	89 f2                	mov    %esi,%edx
+  8015e7:	03 55 08             	add    0x8(%ebp),%edx
+  8015ea:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8015ed:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015f2:	e8 ea f6 ff ff       	call   800ce1 <fsipcv>
+  8015f7:	85 c0                	test   %eax,%eax
+  8015f9:	7e 12                	jle    80160d <mmap+0x118>
+  8015fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015fe:	85 c0                	test   %eax,%eax
+  801600:	0f 84 9e 00 00 00    	je     8016a4 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801606:	c1 e0 0c             	shl    $0xc,%eax
+  801609:	01 c6                	add    %eax,%esi
+  80160b:	eb a6                	jmp    8015b3 <mmap+0xbe>
+			munmap(addr, done);
+  80160d:	89 c3                	mov    %eax,%ebx
+  80160f:	83 ec 08             	sub    $0x8,%esp
+  801612:	56                   	push   %esi
+  801613:	ff 75 08             	push   0x8(%ebp)
+  801616:	e8 78 fe ff ff       	call   801493 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80161b:	83 c4 10             	add    $0x10,%esp
+  80161e:	85 db                	test   %ebx,%ebx
+  801620:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801625:	0f 49 d8             	cmovns %eax,%ebx
+}
+  801628:	89 d8                	mov    %ebx,%eax
+  80162a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80162d:	5b                   	pop    %ebx
+  80162e:	5e                   	pop    %esi
+  80162f:	5f                   	pop    %edi
+  801630:	5d                   	pop    %ebp
+  801631:	c3                   	ret
+	if (prot & PROT_WRITE)
+  801632:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  801635:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  801637:	85 c0                	test   %eax,%eax
+  801639:	74 ed                	je     801628 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80163b:	be 00 00 00 00       	mov    $0x0,%esi
+  801640:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801643:	39 fe                	cmp    %edi,%esi
+  801645:	73 2e                	jae    801675 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  801647:	83 ec 0c             	sub    $0xc,%esp
+  80164a:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  80164d:	50                   	push   %eax
+  80164e:	e8 f6 19 00 00       	call   803049 <cowpage>
+  801653:	83 c4 10             	add    $0x10,%esp
+  801656:	85 c0                	test   %eax,%eax
+  801658:	78 08                	js     801662 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  80165a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801660:	eb e1                	jmp    801643 <mmap+0x14e>
+				munmap(addr, len);
+  801662:	89 c3                	mov    %eax,%ebx
+  801664:	83 ec 08             	sub    $0x8,%esp
+  801667:	57                   	push   %edi
+  801668:	ff 75 08             	push   0x8(%ebp)
+  80166b:	e8 23 fe ff ff       	call   801493 <munmap>
+				return r;
+  801670:	83 c4 10             	add    $0x10,%esp
+  801673:	eb b3                	jmp    801628 <mmap+0x133>
+	return 0;
+  801675:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801678:	eb ae                	jmp    801628 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80167a:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80167f:	eb a7                	jmp    801628 <mmap+0x133>
+		return -E_NOT_SUPP;
+  801681:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801686:	eb a0                	jmp    801628 <mmap+0x133>
+		return -E_INVAL;
+  801688:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80168d:	eb 99                	jmp    801628 <mmap+0x133>
+  80168f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801694:	eb 92                	jmp    801628 <mmap+0x133>
+  801696:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80169b:	eb 8b                	jmp    801628 <mmap+0x133>
+  80169d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016a2:	eb 84                	jmp    801628 <mmap+0x133>
+			munmap(addr, done);
+  8016a4:	83 ec 08             	sub    $0x8,%esp
+  8016a7:	56                   	push   %esi
+  8016a8:	ff 75 08             	push   0x8(%ebp)
+  8016ab:	e8 e3 fd ff ff       	call   801493 <munmap>
+  8016b0:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8016b3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016b8:	e9 6b ff ff ff       	jmp    801628 <mmap+0x133>
+
+008016bd <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8016bd:	55                   	push   %ebp
+  8016be:	89 e5                	mov    %esp,%ebp
+  8016c0:	56                   	push   %esi
+  8016c1:	53                   	push   %ebx
+  8016c2:	83 ec 10             	sub    $0x10,%esp
+  8016c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8016c8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016ce:	e8 3d f9 ff ff       	call   801010 <fsring_slot>
+  8016d3:	85 c0                	test   %eax,%eax
+  8016d5:	78 60                	js     801737 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8016d7:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8016da:	8b 56 08             	mov    0x8(%esi),%edx
+  8016dd:	83 e2 03             	and    $0x3,%edx
+  8016e0:	83 fa 01             	cmp    $0x1,%edx
+  8016e3:	74 59                	je     80173e <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8016e5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8016ea:	89 c1                	mov    %eax,%ecx
+  8016ec:	d3 e2                	shl    %cl,%edx
+  8016ee:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8016f4:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8016f7:	c1 e2 02             	shl    $0x2,%edx
+  8016fa:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  801700:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  801707:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80170a:	8b 55 18             	mov    0x18(%ebp),%edx
+  80170d:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  801710:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801713:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  801716:	83 ec 08             	sub    $0x8,%esp
+  801719:	50                   	push   %eax
+  80171a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80171f:	39 c3                	cmp    %eax,%ebx
+  801721:	0f 47 d8             	cmova  %eax,%ebx
+  801724:	53                   	push   %ebx
+  801725:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801728:	89 f2                	mov    %esi,%edx
+  80172a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80172f:	e8 1e f5 ff ff       	call   800c52 <fsring_post>
+  801734:	83 c4 10             	add    $0x10,%esp
+}
+  801737:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80173a:	5b                   	pop    %ebx
+  80173b:	5e                   	pop    %esi
+  80173c:	5d                   	pop    %ebp
+  80173d:	c3                   	ret
+		return -E_INVAL;
+  80173e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801743:	eb f2                	jmp    801737 <fsring_read+0x7a>
+
+00801745 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  801745:	55                   	push   %ebp
+  801746:	89 e5                	mov    %esp,%ebp
+  801748:	56                   	push   %esi
+  801749:	53                   	push   %ebx
+  80174a:	83 ec 10             	sub    $0x10,%esp
+  80174d:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  801750:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801753:	8b 45 08             	mov    0x8(%ebp),%eax
+  801756:	e8 b5 f8 ff ff       	call   801010 <fsring_slot>
+  80175b:	89 c3                	mov    %eax,%ebx
+  80175d:	85 c0                	test   %eax,%eax
+  80175f:	78 77                	js     8017d8 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801761:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801764:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801768:	74 77                	je     8017e1 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80176a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80176f:	39 c6                	cmp    %eax,%esi
+  801771:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  801774:	83 ec 04             	sub    $0x4,%esp
+  801777:	56                   	push   %esi
+  801778:	ff 75 0c             	push   0xc(%ebp)
+  80177b:	89 d8                	mov    %ebx,%eax
+  80177d:	c1 e0 0c             	shl    $0xc,%eax
+  801780:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  801786:	50                   	push   %eax
+  801787:	e8 fc 15 00 00       	call   802d88 <memmove>
+	fsring_busy |= 1 << slot;
+  80178c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801791:	89 d9                	mov    %ebx,%ecx
+  801793:	d3 e0                	shl    %cl,%eax
+  801795:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  80179b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80179e:	c1 e0 02             	shl    $0x2,%eax
+  8017a1:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8017a7:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8017ae:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8017b1:	8b 45 18             	mov    0x18(%ebp),%eax
+  8017b4:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8017b7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8017be:	83 c4 08             	add    $0x8,%esp
+  8017c1:	53                   	push   %ebx
+  8017c2:	56                   	push   %esi
+  8017c3:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8017c6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8017c9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017ce:	e8 7f f4 ff ff       	call   800c52 <fsring_post>
+  8017d3:	89 c3                	mov    %eax,%ebx
+  8017d5:	83 c4 10             	add    $0x10,%esp
+}
+  8017d8:	89 d8                	mov    %ebx,%eax
+  8017da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017dd:	5b                   	pop    %ebx
+  8017de:	5e                   	pop    %esi
+  8017df:	5d                   	pop    %ebp
+  8017e0:	c3                   	ret
+		return -E_INVAL;
+  8017e1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8017e6:	eb f0                	jmp    8017d8 <fsring_write+0x93>
+
+008017e8 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8017e8:	55                   	push   %ebp
+  8017e9:	89 e5                	mov    %esp,%ebp
+  8017eb:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8017ee:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8017f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017f4:	e8 17 f8 ff ff       	call   801010 <fsring_slot>
+  8017f9:	85 c0                	test   %eax,%eax
+  8017fb:	78 4c                	js     801849 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8017fd:	ba 01 00 00 00       	mov    $0x1,%edx
+  801802:	89 c1                	mov    %eax,%ecx
+  801804:	d3 e2                	shl    %cl,%edx
+  801806:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  80180c:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80180f:	c1 e2 02             	shl    $0x2,%edx
+  801812:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  801818:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  80181f:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  801822:	8b 55 10             	mov    0x10(%ebp),%edx
+  801825:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  801828:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80182b:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80182e:	83 ec 08             	sub    $0x8,%esp
+  801831:	50                   	push   %eax
+  801832:	6a 00                	push   $0x0
+  801834:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801839:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80183c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801841:	e8 0c f4 ff ff       	call   800c52 <fsring_post>
+  801846:	83 c4 10             	add    $0x10,%esp
+}
+  801849:	c9                   	leave
+  80184a:	c3                   	ret
+
+0080184b <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  80184b:	55                   	push   %ebp
+  80184c:	89 e5                	mov    %esp,%ebp
+  80184e:	57                   	push   %edi
+  80184f:	56                   	push   %esi
+  801850:	53                   	push   %ebx
+  801851:	83 ec 1c             	sub    $0x1c,%esp
+  801854:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  801858:	a1 00 50 80 00       	mov    0x805000,%eax
+  80185d:	8b 40 48             	mov    0x48(%eax),%eax
+  801860:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801866:	74 12                	je     80187a <fsring_reap+0x2f>
+		return 0;
+  801868:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  80186d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801870:	5b                   	pop    %ebx
+  801871:	5e                   	pop    %esi
+  801872:	5f                   	pop    %edi
+  801873:	5d                   	pop    %ebp
+  801874:	c3                   	ret
+		sys_yield();
+  801875:	e8 e4 e8 ff ff       	call   80015e <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  80187a:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  801880:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  801885:	39 c2                	cmp    %eax,%edx
+  801887:	75 18                	jne    8018a1 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  801889:	84 db                	test   %bl,%bl
+  80188b:	0f 84 21 01 00 00    	je     8019b2 <fsring_reap+0x167>
+  801891:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  801898:	75 db                	jne    801875 <fsring_reap+0x2a>
+			return 0;
+  80189a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189f:	eb cc                	jmp    80186d <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8018a1:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018a6:	83 e0 0f             	and    $0xf,%eax
+  8018a9:	83 c0 2a             	add    $0x2a,%eax
+  8018ac:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8018b3:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8018ba:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018bf:	83 c0 01             	add    $0x1,%eax
+  8018c2:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8018c7:	83 fb 0f             	cmp    $0xf,%ebx
+  8018ca:	77 5b                	ja     801927 <fsring_reap+0xdc>
+  8018cc:	be 01 00 00 00       	mov    $0x1,%esi
+  8018d1:	89 d9                	mov    %ebx,%ecx
+  8018d3:	d3 e6                	shl    %cl,%esi
+  8018d5:	89 f0                	mov    %esi,%eax
+  8018d7:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8018dd:	74 48                	je     801927 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8018df:	89 d8                	mov    %ebx,%eax
+  8018e1:	c1 e0 0c             	shl    $0xc,%eax
+  8018e4:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8018ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8018ed:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8018f0:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  8018f7:	83 f8 03             	cmp    $0x3,%eax
+  8018fa:	74 40                	je     80193c <fsring_reap+0xf1>
+  8018fc:	83 f8 05             	cmp    $0x5,%eax
+  8018ff:	74 64                	je     801965 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  801901:	f7 d6                	not    %esi
+  801903:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  801909:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80190c:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  801913:	8b 45 08             	mov    0x8(%ebp),%eax
+  801916:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  801918:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80191b:	89 38                	mov    %edi,(%eax)
+	return 1;
+  80191d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801922:	e9 46 ff ff ff       	jmp    80186d <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  801927:	53                   	push   %ebx
+  801928:	68 61 38 80 00       	push   $0x803861
+  80192d:	68 8f 02 00 00       	push   $0x28f
+  801932:	68 39 38 80 00       	push   $0x803839
+  801937:	e8 fd 0b 00 00       	call   802539 <_panic>
+		if (cqe.cqe_result > 0)
+  80193c:	85 ff                	test   %edi,%edi
+  80193e:	7e c1                	jle    801901 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801940:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  801943:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801948:	39 c7                	cmp    %eax,%edi
+  80194a:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80194d:	50                   	push   %eax
+  80194e:	ff 75 e4             	push   -0x1c(%ebp)
+  801951:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801954:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  80195b:	e8 28 14 00 00       	call   802d88 <memmove>
+  801960:	83 c4 10             	add    $0x10,%esp
+  801963:	eb 9c                	jmp    801901 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  801965:	85 ff                	test   %edi,%edi
+  801967:	75 98                	jne    801901 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  801969:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80196c:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  801973:	83 ec 08             	sub    $0x8,%esp
+  801976:	ff 75 e4             	push   -0x1c(%ebp)
+  801979:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80197c:	51                   	push   %ecx
+  80197d:	e8 80 12 00 00       	call   802c02 <strcpy>
+			st->st_size = ret->ret_size;
+  801982:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801985:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  80198b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80198e:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  801994:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  80199a:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8019a0:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8019a7:	40 80 00 
+  8019aa:	83 c4 10             	add    $0x10,%esp
+  8019ad:	e9 4f ff ff ff       	jmp    801901 <fsring_reap+0xb6>
+			return 0;
+  8019b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b7:	e9 b1 fe ff ff       	jmp    80186d <fsring_reap+0x22>
+
+008019bc <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8019bc:	55                   	push   %ebp
+  8019bd:	89 e5                	mov    %esp,%ebp
+  8019bf:	57                   	push   %edi
+  8019c0:	56                   	push   %esi
+  8019c1:	53                   	push   %ebx
+  8019c2:	83 ec 28             	sub    $0x28,%esp
+  8019c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019c8:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8019cb:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8019ce:	53                   	push   %ebx
+  8019cf:	e8 f3 11 00 00       	call   802bc7 <strlen>
+  8019d4:	83 c4 10             	add    $0x10,%esp
+  8019d7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019dc:	0f 8f 02 01 00 00    	jg     801ae4 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8019e2:	83 ec 08             	sub    $0x8,%esp
+  8019e5:	53                   	push   %ebx
+  8019e6:	68 00 60 80 00       	push   $0x806000
+  8019eb:	e8 12 12 00 00       	call   802c02 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8019f0:	83 c4 10             	add    $0x10,%esp
+  8019f3:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8019f9:	76 69                	jbe    801a64 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8019fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019fe:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801a04:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801a09:	29 d1                	sub    %edx,%ecx
+  801a0b:	39 f9                	cmp    %edi,%ecx
+  801a0d:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a10:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a13:	89 f9                	mov    %edi,%ecx
+  801a15:	01 c1                	add    %eax,%ecx
+  801a17:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a1a:	eb 0f                	jmp    801a2b <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  801a1c:	0f b6 10             	movzbl (%eax),%edx
+  801a1f:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a21:	05 00 10 00 00       	add    $0x1000,%eax
+  801a26:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a2b:	39 c8                	cmp    %ecx,%eax
+  801a2d:	72 ed                	jb     801a1c <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  801a2f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a32:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  801a38:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  801a3e:	83 ec 0c             	sub    $0xc,%esp
+  801a41:	6a 07                	push   $0x7
+  801a43:	89 f9                	mov    %edi,%ecx
+  801a45:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a48:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a4d:	e8 3f f1 ff ff       	call   800b91 <fsipc_pages>
+  801a52:	89 c7                	mov    %eax,%edi
+  801a54:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  801a57:	85 f6                	test   %esi,%esi
+  801a59:	74 7f                	je     801ada <file_slurp+0x11e>
+  801a5b:	8d 43 01             	lea    0x1(%ebx),%eax
+  801a5e:	85 ff                	test   %edi,%edi
+  801a60:	79 3c                	jns    801a9e <file_slurp+0xe2>
+  801a62:	eb 76                	jmp    801ada <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  801a64:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  801a6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a74:	e8 ba f2 ff ff       	call   800d33 <fsipc>
+  801a79:	89 c7                	mov    %eax,%edi
+  801a7b:	85 c0                	test   %eax,%eax
+  801a7d:	7e d8                	jle    801a57 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  801a7f:	83 ec 04             	sub    $0x4,%esp
+  801a82:	50                   	push   %eax
+  801a83:	68 08 60 80 00       	push   $0x806008
+  801a88:	ff 75 0c             	push   0xc(%ebp)
+  801a8b:	e8 f8 12 00 00       	call   802d88 <memmove>
+  801a90:	83 c4 10             	add    $0x10,%esp
+  801a93:	eb c2                	jmp    801a57 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  801a95:	80 fa 2f             	cmp    $0x2f,%dl
+  801a98:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  801a9b:	83 c0 01             	add    $0x1,%eax
+  801a9e:	89 c1                	mov    %eax,%ecx
+  801aa0:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  801aa4:	84 d2                	test   %dl,%dl
+  801aa6:	75 ed                	jne    801a95 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  801aa8:	83 ec 04             	sub    $0x4,%esp
+  801aab:	68 80 00 00 00       	push   $0x80
+  801ab0:	53                   	push   %ebx
+  801ab1:	56                   	push   %esi
+  801ab2:	e8 c1 11 00 00       	call   802c78 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  801ab7:	a1 00 60 80 00       	mov    0x806000,%eax
+  801abc:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  801ac2:	a1 04 60 80 00       	mov    0x806004,%eax
+  801ac7:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  801acd:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  801ad4:	40 80 00 
+  801ad7:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801ada:	89 f8                	mov    %edi,%eax
+  801adc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801adf:	5b                   	pop    %ebx
+  801ae0:	5e                   	pop    %esi
+  801ae1:	5f                   	pop    %edi
+  801ae2:	5d                   	pop    %ebp
+  801ae3:	c3                   	ret
+		return -E_BAD_PATH;
+  801ae4:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  801ae9:	eb ef                	jmp    801ada <file_slurp+0x11e>
+
+00801aeb <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801aeb:	55                   	push   %ebp
+  801aec:	89 e5                	mov    %esp,%ebp
+  801aee:	53                   	push   %ebx
+  801aef:	83 ec 10             	sub    $0x10,%esp
+  801af2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801af5:	53                   	push   %ebx
+  801af6:	e8 cc 10 00 00       	call   802bc7 <strlen>
+  801afb:	83 c4 10             	add    $0x10,%esp
+  801afe:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b03:	7f 25                	jg     801b2a <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b05:	83 ec 08             	sub    $0x8,%esp
+  801b08:	53                   	push   %ebx
+  801b09:	68 00 60 80 00       	push   $0x806000
+  801b0e:	e8 ef 10 00 00       	call   802c02 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b13:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b18:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b1d:	e8 11 f2 ff ff       	call   800d33 <fsipc>
+  801b22:	83 c4 10             	add    $0x10,%esp
+}
+  801b25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b28:	c9                   	leave
+  801b29:	c3                   	ret
+		return -E_BAD_PATH;
+  801b2a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b2f:	eb f4                	jmp    801b25 <remove+0x3a>
+
+00801b31 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b31:	55                   	push   %ebp
+  801b32:	89 e5                	mov    %esp,%ebp
+  801b34:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b37:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b41:	e8 ed f1 ff ff       	call   800d33 <fsipc>
+}
+  801b46:	c9                   	leave
+  801b47:	c3                   	ret
+
+00801b48 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  801b48:	55                   	push   %ebp
+  801b49:	89 e5                	mov    %esp,%ebp
+  801b4b:	57                   	push   %edi
+  801b4c:	56                   	push   %esi
+  801b4d:	53                   	push   %ebx
+  801b4e:	83 ec 18             	sub    $0x18,%esp
+  801b51:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b54:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801b5a:	57                   	push   %edi
+  801b5b:	e8 67 10 00 00       	call   802bc7 <strlen>
+  801b60:	83 c4 10             	add    $0x10,%esp
+  801b63:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b68:	7f 4c                	jg     801bb6 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  801b6a:	83 ec 08             	sub    $0x8,%esp
+  801b6d:	57                   	push   %edi
+  801b6e:	68 00 60 80 00       	push   $0x806000
+  801b73:	e8 8a 10 00 00       	call   802c02 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  801b78:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801b82:	e8 ac f1 ff ff       	call   800d33 <fsipc>
+  801b87:	83 c4 10             	add    $0x10,%esp
+  801b8a:	85 c0                	test   %eax,%eax
+  801b8c:	78 20                	js     801bae <defrag+0x66>
+		return r;
+	if (before)
+  801b8e:	85 f6                	test   %esi,%esi
+  801b90:	74 07                	je     801b99 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  801b92:	a1 00 60 80 00       	mov    0x806000,%eax
+  801b97:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  801b99:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  801b9e:	85 db                	test   %ebx,%ebx
+  801ba0:	74 0c                	je     801bae <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  801ba2:	a1 04 60 80 00       	mov    0x806004,%eax
+  801ba7:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  801ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bb1:	5b                   	pop    %ebx
+  801bb2:	5e                   	pop    %esi
+  801bb3:	5f                   	pop    %edi
+  801bb4:	5d                   	pop    %ebp
+  801bb5:	c3                   	ret
+		return -E_BAD_PATH;
+  801bb6:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801bbb:	eb f1                	jmp    801bae <defrag+0x66>
+
+00801bbd <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  801bbd:	55                   	push   %ebp
+  801bbe:	89 e5                	mov    %esp,%ebp
+  801bc0:	53                   	push   %ebx
+  801bc1:	83 ec 04             	sub    $0x4,%esp
+  801bc4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  801bc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bcc:	b8 11 00 00 00       	mov    $0x11,%eax
+  801bd1:	e8 5d f1 ff ff       	call   800d33 <fsipc>
+  801bd6:	85 c0                	test   %eax,%eax
+  801bd8:	78 34                	js     801c0e <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  801bda:	a1 00 60 80 00       	mov    0x806000,%eax
+  801bdf:	89 03                	mov    %eax,(%ebx)
+  801be1:	a1 04 60 80 00       	mov    0x806004,%eax
+  801be6:	89 43 04             	mov    %eax,0x4(%ebx)
+  801be9:	a1 08 60 80 00       	mov    0x806008,%eax
+  801bee:	89 43 08             	mov    %eax,0x8(%ebx)
+  801bf1:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  801bf6:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801bf9:	a1 10 60 80 00       	mov    0x806010,%eax
+  801bfe:	89 43 10             	mov    %eax,0x10(%ebx)
+  801c01:	a1 14 60 80 00       	mov    0x806014,%eax
+  801c06:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  801c09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c11:	c9                   	leave
+  801c12:	c3                   	ret
+
+00801c13 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c13:	55                   	push   %ebp
+  801c14:	89 e5                	mov    %esp,%ebp
+  801c16:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c19:	68 7a 38 80 00       	push   $0x80387a
+  801c1e:	ff 75 0c             	push   0xc(%ebp)
+  801c21:	e8 dc 0f 00 00       	call   802c02 <strcpy>
+	return 0;
+}
+  801c26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2b:	c9                   	leave
+  801c2c:	c3                   	ret
+
+00801c2d <devsock_close>:
+{
+  801c2d:	55                   	push   %ebp
+  801c2e:	89 e5                	mov    %esp,%ebp
+  801c30:	53                   	push   %ebx
+  801c31:	83 ec 10             	sub    $0x10,%esp
+  801c34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c37:	53                   	push   %ebx
+  801c38:	e8 ed 17 00 00       	call   80342a <pageref>
+  801c3d:	89 c2                	mov    %eax,%edx
+  801c3f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c42:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c47:	83 fa 01             	cmp    $0x1,%edx
+  801c4a:	74 05                	je     801c51 <devsock_close+0x24>
+}
+  801c4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c4f:	c9                   	leave
+  801c50:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c51:	83 ec 0c             	sub    $0xc,%esp
+  801c54:	ff 73 0c             	push   0xc(%ebx)
+  801c57:	e8 b7 02 00 00       	call   801f13 <nsipc_close>
+  801c5c:	83 c4 10             	add    $0x10,%esp
+  801c5f:	eb eb                	jmp    801c4c <devsock_close+0x1f>
+
+00801c61 <devsock_write>:
+{
+  801c61:	55                   	push   %ebp
+  801c62:	89 e5                	mov    %esp,%ebp
+  801c64:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c67:	6a 00                	push   $0x0
+  801c69:	ff 75 10             	push   0x10(%ebp)
+  801c6c:	ff 75 0c             	push   0xc(%ebp)
+  801c6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c72:	ff 70 0c             	push   0xc(%eax)
+  801c75:	e8 79 03 00 00       	call   801ff3 <nsipc_send>
+}
+  801c7a:	c9                   	leave
+  801c7b:	c3                   	ret
+
+00801c7c <devsock_read>:
+{
+  801c7c:	55                   	push   %ebp
+  801c7d:	89 e5                	mov    %esp,%ebp
+  801c7f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801c82:	6a 00                	push   $0x0
+  801c84:	ff 75 10             	push   0x10(%ebp)
+  801c87:	ff 75 0c             	push   0xc(%ebp)
+  801c8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c8d:	ff 70 0c             	push   0xc(%eax)
+  801c90:	e8 ef 02 00 00       	call   801f84 <nsipc_recv>
+}
+  801c95:	c9                   	leave
+  801c96:	c3                   	ret
+
+00801c97 <fd2sockid>:
+{
+  801c97:	55                   	push   %ebp
+  801c98:	89 e5                	mov    %esp,%ebp
+  801c9a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c9d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801ca0:	52                   	push   %edx
+  801ca1:	50                   	push   %eax
+  801ca2:	e8 54 e9 ff ff       	call   8005fb <fd_lookup>
+  801ca7:	83 c4 10             	add    $0x10,%esp
+  801caa:	85 c0                	test   %eax,%eax
+  801cac:	78 10                	js     801cbe <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801cae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cb1:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801cb7:	39 08                	cmp    %ecx,(%eax)
+  801cb9:	75 05                	jne    801cc0 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801cbb:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801cbe:	c9                   	leave
+  801cbf:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cc0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cc5:	eb f7                	jmp    801cbe <fd2sockid+0x27>
+
+00801cc7 <alloc_sockfd>:
+{
+  801cc7:	55                   	push   %ebp
+  801cc8:	89 e5                	mov    %esp,%ebp
+  801cca:	56                   	push   %esi
+  801ccb:	53                   	push   %ebx
+  801ccc:	83 ec 1c             	sub    $0x1c,%esp
+  801ccf:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801cd1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cd4:	50                   	push   %eax
+  801cd5:	e8 cb e8 ff ff       	call   8005a5 <fd_alloc>
+  801cda:	89 c3                	mov    %eax,%ebx
+  801cdc:	83 c4 10             	add    $0x10,%esp
+  801cdf:	85 c0                	test   %eax,%eax
+  801ce1:	78 43                	js     801d26 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ce3:	83 ec 04             	sub    $0x4,%esp
+  801ce6:	68 07 04 00 00       	push   $0x407
+  801ceb:	ff 75 f4             	push   -0xc(%ebp)
+  801cee:	6a 00                	push   $0x0
+  801cf0:	e8 88 e4 ff ff       	call   80017d <sys_page_alloc>
+  801cf5:	89 c3                	mov    %eax,%ebx
+  801cf7:	83 c4 10             	add    $0x10,%esp
+  801cfa:	85 c0                	test   %eax,%eax
+  801cfc:	78 28                	js     801d26 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801cfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d01:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801d07:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d0c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d13:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d16:	83 ec 0c             	sub    $0xc,%esp
+  801d19:	50                   	push   %eax
+  801d1a:	e8 5f e8 ff ff       	call   80057e <fd2num>
+  801d1f:	89 c3                	mov    %eax,%ebx
+  801d21:	83 c4 10             	add    $0x10,%esp
+  801d24:	eb 0c                	jmp    801d32 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d26:	83 ec 0c             	sub    $0xc,%esp
+  801d29:	56                   	push   %esi
+  801d2a:	e8 e4 01 00 00       	call   801f13 <nsipc_close>
+		return r;
+  801d2f:	83 c4 10             	add    $0x10,%esp
+}
+  801d32:	89 d8                	mov    %ebx,%eax
+  801d34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d37:	5b                   	pop    %ebx
+  801d38:	5e                   	pop    %esi
+  801d39:	5d                   	pop    %ebp
+  801d3a:	c3                   	ret
+
+00801d3b <accept>:
+{
+  801d3b:	55                   	push   %ebp
+  801d3c:	89 e5                	mov    %esp,%ebp
+  801d3e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d41:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d44:	e8 4e ff ff ff       	call   801c97 <fd2sockid>
+  801d49:	85 c0                	test   %eax,%eax
+  801d4b:	78 1b                	js     801d68 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d4d:	83 ec 04             	sub    $0x4,%esp
+  801d50:	ff 75 10             	push   0x10(%ebp)
+  801d53:	ff 75 0c             	push   0xc(%ebp)
+  801d56:	50                   	push   %eax
+  801d57:	e8 0e 01 00 00       	call   801e6a <nsipc_accept>
+  801d5c:	83 c4 10             	add    $0x10,%esp
+  801d5f:	85 c0                	test   %eax,%eax
+  801d61:	78 05                	js     801d68 <accept+0x2d>
+	return alloc_sockfd(r);
+  801d63:	e8 5f ff ff ff       	call   801cc7 <alloc_sockfd>
+}
+  801d68:	c9                   	leave
+  801d69:	c3                   	ret
+
+00801d6a <bind>:
+{
+  801d6a:	55                   	push   %ebp
+  801d6b:	89 e5                	mov    %esp,%ebp
+  801d6d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d70:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d73:	e8 1f ff ff ff       	call   801c97 <fd2sockid>
+  801d78:	85 c0                	test   %eax,%eax
+  801d7a:	78 12                	js     801d8e <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d7c:	83 ec 04             	sub    $0x4,%esp
+  801d7f:	ff 75 10             	push   0x10(%ebp)
+  801d82:	ff 75 0c             	push   0xc(%ebp)
+  801d85:	50                   	push   %eax
+  801d86:	e8 31 01 00 00       	call   801ebc <nsipc_bind>
+  801d8b:	83 c4 10             	add    $0x10,%esp
+}
+  801d8e:	c9                   	leave
+  801d8f:	c3                   	ret
+
+00801d90 <shutdown>:
+{
+  801d90:	55                   	push   %ebp
+  801d91:	89 e5                	mov    %esp,%ebp
+  801d93:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d96:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d99:	e8 f9 fe ff ff       	call   801c97 <fd2sockid>
+  801d9e:	85 c0                	test   %eax,%eax
+  801da0:	78 0f                	js     801db1 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801da2:	83 ec 08             	sub    $0x8,%esp
+  801da5:	ff 75 0c             	push   0xc(%ebp)
+  801da8:	50                   	push   %eax
+  801da9:	e8 43 01 00 00       	call   801ef1 <nsipc_shutdown>
+  801dae:	83 c4 10             	add    $0x10,%esp
+}
+  801db1:	c9                   	leave
+  801db2:	c3                   	ret
+
+00801db3 <connect>:
+{
+  801db3:	55                   	push   %ebp
+  801db4:	89 e5                	mov    %esp,%ebp
+  801db6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801db9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dbc:	e8 d6 fe ff ff       	call   801c97 <fd2sockid>
+  801dc1:	85 c0                	test   %eax,%eax
+  801dc3:	78 12                	js     801dd7 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801dc5:	83 ec 04             	sub    $0x4,%esp
+  801dc8:	ff 75 10             	push   0x10(%ebp)
+  801dcb:	ff 75 0c             	push   0xc(%ebp)
+  801dce:	50                   	push   %eax
+  801dcf:	e8 59 01 00 00       	call   801f2d <nsipc_connect>
+  801dd4:	83 c4 10             	add    $0x10,%esp
+}
+  801dd7:	c9                   	leave
+  801dd8:	c3                   	ret
+
+00801dd9 <listen>:
+{
+  801dd9:	55                   	push   %ebp
+  801dda:	89 e5                	mov    %esp,%ebp
+  801ddc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ddf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801de2:	e8 b0 fe ff ff       	call   801c97 <fd2sockid>
+  801de7:	85 c0                	test   %eax,%eax
+  801de9:	78 0f                	js     801dfa <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801deb:	83 ec 08             	sub    $0x8,%esp
+  801dee:	ff 75 0c             	push   0xc(%ebp)
+  801df1:	50                   	push   %eax
+  801df2:	e8 6b 01 00 00       	call   801f62 <nsipc_listen>
+  801df7:	83 c4 10             	add    $0x10,%esp
+}
+  801dfa:	c9                   	leave
+  801dfb:	c3                   	ret
+
+00801dfc <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801dfc:	55                   	push   %ebp
+  801dfd:	89 e5                	mov    %esp,%ebp
+  801dff:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e02:	ff 75 10             	push   0x10(%ebp)
+  801e05:	ff 75 0c             	push   0xc(%ebp)
+  801e08:	ff 75 08             	push   0x8(%ebp)
+  801e0b:	e8 41 02 00 00       	call   802051 <nsipc_socket>
+  801e10:	83 c4 10             	add    $0x10,%esp
+  801e13:	85 c0                	test   %eax,%eax
+  801e15:	78 05                	js     801e1c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e17:	e8 ab fe ff ff       	call   801cc7 <alloc_sockfd>
+}
+  801e1c:	c9                   	leave
+  801e1d:	c3                   	ret
+
+00801e1e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e1e:	55                   	push   %ebp
+  801e1f:	89 e5                	mov    %esp,%ebp
+  801e21:	53                   	push   %ebx
+  801e22:	83 ec 04             	sub    $0x4,%esp
+  801e25:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e27:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  801e2e:	74 26                	je     801e56 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e30:	6a 07                	push   $0x7
+  801e32:	68 00 80 80 00       	push   $0x808000
+  801e37:	53                   	push   %ebx
+  801e38:	ff 35 00 90 80 00    	push   0x809000
+  801e3e:	e8 6f 14 00 00       	call   8032b2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e43:	83 c4 0c             	add    $0xc,%esp
+  801e46:	6a 00                	push   $0x0
+  801e48:	6a 00                	push   $0x0
+  801e4a:	6a 00                	push   $0x0
+  801e4c:	e8 f6 13 00 00       	call   803247 <ipc_recv>
+}
+  801e51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e54:	c9                   	leave
+  801e55:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e56:	83 ec 0c             	sub    $0xc,%esp
+  801e59:	6a 02                	push   $0x2
+  801e5b:	e8 8b 15 00 00       	call   8033eb <ipc_find_env>
+  801e60:	a3 00 90 80 00       	mov    %eax,0x809000
+  801e65:	83 c4 10             	add    $0x10,%esp
+  801e68:	eb c6                	jmp    801e30 <nsipc+0x12>
+
+00801e6a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e6a:	55                   	push   %ebp
+  801e6b:	89 e5                	mov    %esp,%ebp
+  801e6d:	56                   	push   %esi
+  801e6e:	53                   	push   %ebx
+  801e6f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e72:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e75:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801e7a:	8b 06                	mov    (%esi),%eax
+  801e7c:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801e81:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e86:	e8 93 ff ff ff       	call   801e1e <nsipc>
+  801e8b:	89 c3                	mov    %eax,%ebx
+  801e8d:	85 c0                	test   %eax,%eax
+  801e8f:	79 09                	jns    801e9a <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801e91:	89 d8                	mov    %ebx,%eax
+  801e93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e96:	5b                   	pop    %ebx
+  801e97:	5e                   	pop    %esi
+  801e98:	5d                   	pop    %ebp
+  801e99:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801e9a:	83 ec 04             	sub    $0x4,%esp
+  801e9d:	ff 35 10 80 80 00    	push   0x808010
+  801ea3:	68 00 80 80 00       	push   $0x808000
+  801ea8:	ff 75 0c             	push   0xc(%ebp)
+  801eab:	e8 d8 0e 00 00       	call   802d88 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801eb0:	a1 10 80 80 00       	mov    0x808010,%eax
+  801eb5:	89 06                	mov    %eax,(%esi)
+  801eb7:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801eba:	eb d5                	jmp    801e91 <nsipc_accept+0x27>
+
+00801ebc <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801ebc:	55                   	push   %ebp
+  801ebd:	89 e5                	mov    %esp,%ebp
+  801ebf:	53                   	push   %ebx
+  801ec0:	83 ec 08             	sub    $0x8,%esp
+  801ec3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ec6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec9:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ece:	53                   	push   %ebx
+  801ecf:	ff 75 0c             	push   0xc(%ebp)
+  801ed2:	68 04 80 80 00       	push   $0x808004
+  801ed7:	e8 ac 0e 00 00       	call   802d88 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801edc:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801ee2:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ee7:	e8 32 ff ff ff       	call   801e1e <nsipc>
+}
+  801eec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eef:	c9                   	leave
+  801ef0:	c3                   	ret
+
+00801ef1 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801ef1:	55                   	push   %ebp
+  801ef2:	89 e5                	mov    %esp,%ebp
+  801ef4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801ef7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801efa:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801eff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f02:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f07:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f0c:	e8 0d ff ff ff       	call   801e1e <nsipc>
+}
+  801f11:	c9                   	leave
+  801f12:	c3                   	ret
+
+00801f13 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f13:	55                   	push   %ebp
+  801f14:	89 e5                	mov    %esp,%ebp
+  801f16:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f19:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1c:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f21:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f26:	e8 f3 fe ff ff       	call   801e1e <nsipc>
+}
+  801f2b:	c9                   	leave
+  801f2c:	c3                   	ret
+
+00801f2d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f2d:	55                   	push   %ebp
+  801f2e:	89 e5                	mov    %esp,%ebp
+  801f30:	53                   	push   %ebx
+  801f31:	83 ec 08             	sub    $0x8,%esp
+  801f34:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f3a:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f3f:	53                   	push   %ebx
+  801f40:	ff 75 0c             	push   0xc(%ebp)
+  801f43:	68 04 80 80 00       	push   $0x808004
+  801f48:	e8 3b 0e 00 00       	call   802d88 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f4d:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801f53:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f58:	e8 c1 fe ff ff       	call   801e1e <nsipc>
+}
+  801f5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f60:	c9                   	leave
+  801f61:	c3                   	ret
+
+00801f62 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f62:	55                   	push   %ebp
+  801f63:	89 e5                	mov    %esp,%ebp
+  801f65:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f68:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f73:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801f78:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f7d:	e8 9c fe ff ff       	call   801e1e <nsipc>
+}
+  801f82:	c9                   	leave
+  801f83:	c3                   	ret
+
+00801f84 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801f84:	55                   	push   %ebp
+  801f85:	89 e5                	mov    %esp,%ebp
+  801f87:	56                   	push   %esi
+  801f88:	53                   	push   %ebx
+  801f89:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801f8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801f94:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801f9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f9d:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801fa2:	b8 07 00 00 00       	mov    $0x7,%eax
+  801fa7:	e8 72 fe ff ff       	call   801e1e <nsipc>
+  801fac:	89 c3                	mov    %eax,%ebx
+  801fae:	85 c0                	test   %eax,%eax
+  801fb0:	78 22                	js     801fd4 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801fb2:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801fb7:	39 c6                	cmp    %eax,%esi
+  801fb9:	0f 4e c6             	cmovle %esi,%eax
+  801fbc:	39 c3                	cmp    %eax,%ebx
+  801fbe:	7f 1d                	jg     801fdd <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801fc0:	83 ec 04             	sub    $0x4,%esp
+  801fc3:	53                   	push   %ebx
+  801fc4:	68 00 80 80 00       	push   $0x808000
+  801fc9:	ff 75 0c             	push   0xc(%ebp)
+  801fcc:	e8 b7 0d 00 00       	call   802d88 <memmove>
+  801fd1:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801fd4:	89 d8                	mov    %ebx,%eax
+  801fd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd9:	5b                   	pop    %ebx
+  801fda:	5e                   	pop    %esi
+  801fdb:	5d                   	pop    %ebp
+  801fdc:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801fdd:	68 86 38 80 00       	push   $0x803886
+  801fe2:	68 24 38 80 00       	push   $0x803824
+  801fe7:	6a 62                	push   $0x62
+  801fe9:	68 9b 38 80 00       	push   $0x80389b
+  801fee:	e8 46 05 00 00       	call   802539 <_panic>
+
+00801ff3 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801ff3:	55                   	push   %ebp
+  801ff4:	89 e5                	mov    %esp,%ebp
+  801ff6:	53                   	push   %ebx
+  801ff7:	83 ec 04             	sub    $0x4,%esp
+  801ffa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801ffd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802000:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802005:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80200b:	7f 2e                	jg     80203b <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80200d:	83 ec 04             	sub    $0x4,%esp
+  802010:	53                   	push   %ebx
+  802011:	ff 75 0c             	push   0xc(%ebp)
+  802014:	68 0c 80 80 00       	push   $0x80800c
+  802019:	e8 6a 0d 00 00       	call   802d88 <memmove>
+	nsipcbuf.send.req_size = size;
+  80201e:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802024:	8b 45 14             	mov    0x14(%ebp),%eax
+  802027:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  80202c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802031:	e8 e8 fd ff ff       	call   801e1e <nsipc>
+}
+  802036:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802039:	c9                   	leave
+  80203a:	c3                   	ret
+	assert(size < 1600);
+  80203b:	68 a7 38 80 00       	push   $0x8038a7
+  802040:	68 24 38 80 00       	push   $0x803824
+  802045:	6a 6d                	push   $0x6d
+  802047:	68 9b 38 80 00       	push   $0x80389b
+  80204c:	e8 e8 04 00 00       	call   802539 <_panic>
+
+00802051 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802051:	55                   	push   %ebp
+  802052:	89 e5                	mov    %esp,%ebp
+  802054:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802057:	8b 45 08             	mov    0x8(%ebp),%eax
+  80205a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  80205f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802062:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802067:	8b 45 10             	mov    0x10(%ebp),%eax
+  80206a:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  80206f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802074:	e8 a5 fd ff ff       	call   801e1e <nsipc>
+}
+  802079:	c9                   	leave
+  80207a:	c3                   	ret
+
+0080207b <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80207b:	55                   	push   %ebp
+  80207c:	89 e5                	mov    %esp,%ebp
+  80207e:	56                   	push   %esi
+  80207f:	53                   	push   %ebx
+  802080:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802083:	83 ec 0c             	sub    $0xc,%esp
+  802086:	ff 75 08             	push   0x8(%ebp)
+  802089:	e8 00 e5 ff ff       	call   80058e <fd2data>
+  80208e:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802090:	83 c4 08             	add    $0x8,%esp
+  802093:	68 b3 38 80 00       	push   $0x8038b3
+  802098:	53                   	push   %ebx
+  802099:	e8 64 0b 00 00       	call   802c02 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80209e:	8b 46 04             	mov    0x4(%esi),%eax
+  8020a1:	2b 06                	sub    (%esi),%eax
+  8020a3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8020a9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020b0:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020b3:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  8020ba:	40 80 00 
+	return 0;
+}
+  8020bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020c5:	5b                   	pop    %ebx
+  8020c6:	5e                   	pop    %esi
+  8020c7:	5d                   	pop    %ebp
+  8020c8:	c3                   	ret
+
+008020c9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020c9:	55                   	push   %ebp
+  8020ca:	89 e5                	mov    %esp,%ebp
+  8020cc:	53                   	push   %ebx
+  8020cd:	83 ec 0c             	sub    $0xc,%esp
+  8020d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020d3:	53                   	push   %ebx
+  8020d4:	6a 00                	push   $0x0
+  8020d6:	e8 2f e1 ff ff       	call   80020a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8020db:	89 1c 24             	mov    %ebx,(%esp)
+  8020de:	e8 ab e4 ff ff       	call   80058e <fd2data>
+  8020e3:	83 c4 08             	add    $0x8,%esp
+  8020e6:	50                   	push   %eax
+  8020e7:	6a 00                	push   $0x0
+  8020e9:	e8 1c e1 ff ff       	call   80020a <sys_page_unmap>
+}
+  8020ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020f1:	c9                   	leave
+  8020f2:	c3                   	ret
+
+008020f3 <_pipeisclosed>:
+{
+  8020f3:	55                   	push   %ebp
+  8020f4:	89 e5                	mov    %esp,%ebp
+  8020f6:	57                   	push   %edi
+  8020f7:	56                   	push   %esi
+  8020f8:	53                   	push   %ebx
+  8020f9:	83 ec 1c             	sub    $0x1c,%esp
+  8020fc:	89 c7                	mov    %eax,%edi
+  8020fe:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802100:	a1 00 50 80 00       	mov    0x805000,%eax
+  802105:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802108:	83 ec 0c             	sub    $0xc,%esp
+  80210b:	57                   	push   %edi
+  80210c:	e8 19 13 00 00       	call   80342a <pageref>
+  802111:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802114:	89 34 24             	mov    %esi,(%esp)
+  802117:	e8 0e 13 00 00       	call   80342a <pageref>
+		nn = thisenv->env_runs;
+  80211c:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802122:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802125:	83 c4 10             	add    $0x10,%esp
+  802128:	39 cb                	cmp    %ecx,%ebx
+  80212a:	74 1b                	je     802147 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80212c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80212f:	75 cf                	jne    802100 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802131:	8b 42 58             	mov    0x58(%edx),%eax
+  802134:	6a 01                	push   $0x1
+  802136:	50                   	push   %eax
+  802137:	53                   	push   %ebx
+  802138:	68 ba 38 80 00       	push   $0x8038ba
+  80213d:	e8 d2 04 00 00       	call   802614 <cprintf>
+  802142:	83 c4 10             	add    $0x10,%esp
+  802145:	eb b9                	jmp    802100 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802147:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80214a:	0f 94 c0             	sete   %al
+  80214d:	0f b6 c0             	movzbl %al,%eax
+}
+  802150:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802153:	5b                   	pop    %ebx
+  802154:	5e                   	pop    %esi
+  802155:	5f                   	pop    %edi
+  802156:	5d                   	pop    %ebp
+  802157:	c3                   	ret
+
+00802158 <devpipe_write>:
+{
+  802158:	55                   	push   %ebp
+  802159:	89 e5                	mov    %esp,%ebp
+  80215b:	57                   	push   %edi
+  80215c:	56                   	push   %esi
+  80215d:	53                   	push   %ebx
+  80215e:	83 ec 28             	sub    $0x28,%esp
+  802161:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802164:	56                   	push   %esi
+  802165:	e8 24 e4 ff ff       	call   80058e <fd2data>
+  80216a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80216c:	83 c4 10             	add    $0x10,%esp
+  80216f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802174:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802177:	75 09                	jne    802182 <devpipe_write+0x2a>
+	return i;
+  802179:	89 f8                	mov    %edi,%eax
+  80217b:	eb 23                	jmp    8021a0 <devpipe_write+0x48>
+			sys_yield();
+  80217d:	e8 dc df ff ff       	call   80015e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802182:	8b 43 04             	mov    0x4(%ebx),%eax
+  802185:	8b 0b                	mov    (%ebx),%ecx
+  802187:	8d 51 20             	lea    0x20(%ecx),%edx
+  80218a:	39 d0                	cmp    %edx,%eax
+  80218c:	72 1a                	jb     8021a8 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80218e:	89 da                	mov    %ebx,%edx
+  802190:	89 f0                	mov    %esi,%eax
+  802192:	e8 5c ff ff ff       	call   8020f3 <_pipeisclosed>
+  802197:	85 c0                	test   %eax,%eax
+  802199:	74 e2                	je     80217d <devpipe_write+0x25>
+				return 0;
+  80219b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021a3:	5b                   	pop    %ebx
+  8021a4:	5e                   	pop    %esi
+  8021a5:	5f                   	pop    %edi
+  8021a6:	5d                   	pop    %ebp
+  8021a7:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021ab:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021af:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021b2:	89 c2                	mov    %eax,%edx
+  8021b4:	c1 fa 1f             	sar    $0x1f,%edx
+  8021b7:	89 d1                	mov    %edx,%ecx
+  8021b9:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021bc:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021bf:	83 e2 1f             	and    $0x1f,%edx
+  8021c2:	29 ca                	sub    %ecx,%edx
+  8021c4:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8021c8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021cc:	83 c0 01             	add    $0x1,%eax
+  8021cf:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8021d2:	83 c7 01             	add    $0x1,%edi
+  8021d5:	eb 9d                	jmp    802174 <devpipe_write+0x1c>
+
+008021d7 <devpipe_read>:
+{
+  8021d7:	55                   	push   %ebp
+  8021d8:	89 e5                	mov    %esp,%ebp
+  8021da:	57                   	push   %edi
+  8021db:	56                   	push   %esi
+  8021dc:	53                   	push   %ebx
+  8021dd:	83 ec 18             	sub    $0x18,%esp
+  8021e0:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8021e3:	57                   	push   %edi
+  8021e4:	e8 a5 e3 ff ff       	call   80058e <fd2data>
+  8021e9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021eb:	83 c4 10             	add    $0x10,%esp
+  8021ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021f6:	75 13                	jne    80220b <devpipe_read+0x34>
+	return i;
+  8021f8:	89 f0                	mov    %esi,%eax
+  8021fa:	eb 02                	jmp    8021fe <devpipe_read+0x27>
+				return i;
+  8021fc:	89 f0                	mov    %esi,%eax
+}
+  8021fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802201:	5b                   	pop    %ebx
+  802202:	5e                   	pop    %esi
+  802203:	5f                   	pop    %edi
+  802204:	5d                   	pop    %ebp
+  802205:	c3                   	ret
+			sys_yield();
+  802206:	e8 53 df ff ff       	call   80015e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80220b:	8b 03                	mov    (%ebx),%eax
+  80220d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802210:	75 18                	jne    80222a <devpipe_read+0x53>
+			if (i > 0)
+  802212:	85 f6                	test   %esi,%esi
+  802214:	75 e6                	jne    8021fc <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802216:	89 da                	mov    %ebx,%edx
+  802218:	89 f8                	mov    %edi,%eax
+  80221a:	e8 d4 fe ff ff       	call   8020f3 <_pipeisclosed>
+  80221f:	85 c0                	test   %eax,%eax
+  802221:	74 e3                	je     802206 <devpipe_read+0x2f>
+				return 0;
+  802223:	b8 00 00 00 00       	mov    $0x0,%eax
+  802228:	eb d4                	jmp    8021fe <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80222a:	99                   	cltd
+  80222b:	c1 ea 1b             	shr    $0x1b,%edx
+  80222e:	01 d0                	add    %edx,%eax
+  802230:	83 e0 1f             	and    $0x1f,%eax
+  802233:	29 d0                	sub    %edx,%eax
+  802235:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80223a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80223d:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802240:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802243:	83 c6 01             	add    $0x1,%esi
+  802246:	eb ab                	jmp    8021f3 <devpipe_read+0x1c>
+
+00802248 <pipe>:
+{
+  802248:	55                   	push   %ebp
+  802249:	89 e5                	mov    %esp,%ebp
+  80224b:	56                   	push   %esi
+  80224c:	53                   	push   %ebx
+  80224d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802250:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802253:	50                   	push   %eax
+  802254:	e8 4c e3 ff ff       	call   8005a5 <fd_alloc>
+  802259:	89 c3                	mov    %eax,%ebx
+  80225b:	83 c4 10             	add    $0x10,%esp
+  80225e:	85 c0                	test   %eax,%eax
+  802260:	0f 88 23 01 00 00    	js     802389 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802266:	83 ec 04             	sub    $0x4,%esp
+  802269:	68 07 04 00 00       	push   $0x407
+  80226e:	ff 75 f4             	push   -0xc(%ebp)
+  802271:	6a 00                	push   $0x0
+  802273:	e8 05 df ff ff       	call   80017d <sys_page_alloc>
+  802278:	89 c3                	mov    %eax,%ebx
+  80227a:	83 c4 10             	add    $0x10,%esp
+  80227d:	85 c0                	test   %eax,%eax
+  80227f:	0f 88 04 01 00 00    	js     802389 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802285:	83 ec 0c             	sub    $0xc,%esp
+  802288:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80228b:	50                   	push   %eax
+  80228c:	e8 14 e3 ff ff       	call   8005a5 <fd_alloc>
+  802291:	89 c3                	mov    %eax,%ebx
+  802293:	83 c4 10             	add    $0x10,%esp
+  802296:	85 c0                	test   %eax,%eax
+  802298:	0f 88 db 00 00 00    	js     802379 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80229e:	83 ec 04             	sub    $0x4,%esp
+  8022a1:	68 07 04 00 00       	push   $0x407
+  8022a6:	ff 75 f0             	push   -0x10(%ebp)
+  8022a9:	6a 00                	push   $0x0
+  8022ab:	e8 cd de ff ff       	call   80017d <sys_page_alloc>
+  8022b0:	89 c3                	mov    %eax,%ebx
+  8022b2:	83 c4 10             	add    $0x10,%esp
+  8022b5:	85 c0                	test   %eax,%eax
+  8022b7:	0f 88 bc 00 00 00    	js     802379 <pipe+0x131>
+	va = fd2data(fd0);
+  8022bd:	83 ec 0c             	sub    $0xc,%esp
+  8022c0:	ff 75 f4             	push   -0xc(%ebp)
+  8022c3:	e8 c6 e2 ff ff       	call   80058e <fd2data>
+  8022c8:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022ca:	83 c4 0c             	add    $0xc,%esp
+  8022cd:	68 07 04 00 00       	push   $0x407
+  8022d2:	50                   	push   %eax
+  8022d3:	6a 00                	push   $0x0
+  8022d5:	e8 a3 de ff ff       	call   80017d <sys_page_alloc>
+  8022da:	89 c3                	mov    %eax,%ebx
+  8022dc:	83 c4 10             	add    $0x10,%esp
+  8022df:	85 c0                	test   %eax,%eax
+  8022e1:	0f 88 82 00 00 00    	js     802369 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022e7:	83 ec 0c             	sub    $0xc,%esp
+  8022ea:	ff 75 f0             	push   -0x10(%ebp)
+  8022ed:	e8 9c e2 ff ff       	call   80058e <fd2data>
+  8022f2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8022f9:	50                   	push   %eax
+  8022fa:	6a 00                	push   $0x0
+  8022fc:	56                   	push   %esi
+  8022fd:	6a 00                	push   $0x0
+  8022ff:	e8 c4 de ff ff       	call   8001c8 <sys_page_map>
+  802304:	89 c3                	mov    %eax,%ebx
+  802306:	83 c4 20             	add    $0x20,%esp
+  802309:	85 c0                	test   %eax,%eax
+  80230b:	78 4e                	js     80235b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80230d:	a1 60 40 80 00       	mov    0x804060,%eax
+  802312:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802315:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802317:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80231a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802321:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802324:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802326:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802329:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802330:	83 ec 0c             	sub    $0xc,%esp
+  802333:	ff 75 f4             	push   -0xc(%ebp)
+  802336:	e8 43 e2 ff ff       	call   80057e <fd2num>
+  80233b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80233e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802340:	83 c4 04             	add    $0x4,%esp
+  802343:	ff 75 f0             	push   -0x10(%ebp)
+  802346:	e8 33 e2 ff ff       	call   80057e <fd2num>
+  80234b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80234e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802351:	83 c4 10             	add    $0x10,%esp
+  802354:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802359:	eb 2e                	jmp    802389 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80235b:	83 ec 08             	sub    $0x8,%esp
+  80235e:	56                   	push   %esi
+  80235f:	6a 00                	push   $0x0
+  802361:	e8 a4 de ff ff       	call   80020a <sys_page_unmap>
+  802366:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802369:	83 ec 08             	sub    $0x8,%esp
+  80236c:	ff 75 f0             	push   -0x10(%ebp)
+  80236f:	6a 00                	push   $0x0
+  802371:	e8 94 de ff ff       	call   80020a <sys_page_unmap>
+  802376:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802379:	83 ec 08             	sub    $0x8,%esp
+  80237c:	ff 75 f4             	push   -0xc(%ebp)
+  80237f:	6a 00                	push   $0x0
+  802381:	e8 84 de ff ff       	call   80020a <sys_page_unmap>
+  802386:	83 c4 10             	add    $0x10,%esp
+}
+  802389:	89 d8                	mov    %ebx,%eax
+  80238b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80238e:	5b                   	pop    %ebx
+  80238f:	5e                   	pop    %esi
+  802390:	5d                   	pop    %ebp
+  802391:	c3                   	ret
+
+00802392 <pipeisclosed>:
+{
+  802392:	55                   	push   %ebp
+  802393:	89 e5                	mov    %esp,%ebp
+  802395:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802398:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80239b:	50                   	push   %eax
+  80239c:	ff 75 08             	push   0x8(%ebp)
+  80239f:	e8 57 e2 ff ff       	call   8005fb <fd_lookup>
+  8023a4:	83 c4 10             	add    $0x10,%esp
+  8023a7:	85 c0                	test   %eax,%eax
+  8023a9:	78 18                	js     8023c3 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8023ab:	83 ec 0c             	sub    $0xc,%esp
+  8023ae:	ff 75 f4             	push   -0xc(%ebp)
+  8023b1:	e8 d8 e1 ff ff       	call   80058e <fd2data>
+  8023b6:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8023b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023bb:	e8 33 fd ff ff       	call   8020f3 <_pipeisclosed>
+  8023c0:	83 c4 10             	add    $0x10,%esp
+}
+  8023c3:	c9                   	leave
+  8023c4:	c3                   	ret
+
+008023c5 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8023c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ca:	c3                   	ret
+
+008023cb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023cb:	55                   	push   %ebp
+  8023cc:	89 e5                	mov    %esp,%ebp
+  8023ce:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8023d1:	68 d2 38 80 00       	push   $0x8038d2
+  8023d6:	ff 75 0c             	push   0xc(%ebp)
+  8023d9:	e8 24 08 00 00       	call   802c02 <strcpy>
+	return 0;
+}
+  8023de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e3:	c9                   	leave
+  8023e4:	c3                   	ret
+
+008023e5 <devcons_write>:
+{
+  8023e5:	55                   	push   %ebp
+  8023e6:	89 e5                	mov    %esp,%ebp
+  8023e8:	57                   	push   %edi
+  8023e9:	56                   	push   %esi
+  8023ea:	53                   	push   %ebx
+  8023eb:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8023f1:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8023f6:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8023fc:	eb 2e                	jmp    80242c <devcons_write+0x47>
+		m = n - tot;
+  8023fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802401:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802403:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802408:	39 c3                	cmp    %eax,%ebx
+  80240a:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80240d:	83 ec 04             	sub    $0x4,%esp
+  802410:	53                   	push   %ebx
+  802411:	89 f0                	mov    %esi,%eax
+  802413:	03 45 0c             	add    0xc(%ebp),%eax
+  802416:	50                   	push   %eax
+  802417:	57                   	push   %edi
+  802418:	e8 6b 09 00 00       	call   802d88 <memmove>
+		sys_cputs(buf, m);
+  80241d:	83 c4 08             	add    $0x8,%esp
+  802420:	53                   	push   %ebx
+  802421:	57                   	push   %edi
+  802422:	e8 7a dc ff ff       	call   8000a1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802427:	01 de                	add    %ebx,%esi
+  802429:	83 c4 10             	add    $0x10,%esp
+  80242c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80242f:	72 cd                	jb     8023fe <devcons_write+0x19>
+}
+  802431:	89 f0                	mov    %esi,%eax
+  802433:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802436:	5b                   	pop    %ebx
+  802437:	5e                   	pop    %esi
+  802438:	5f                   	pop    %edi
+  802439:	5d                   	pop    %ebp
+  80243a:	c3                   	ret
+
+0080243b <devcons_read>:
+{
+  80243b:	55                   	push   %ebp
+  80243c:	89 e5                	mov    %esp,%ebp
+  80243e:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802441:	b8 00 00 00 00       	mov    $0x0,%eax
+  802446:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80244a:	75 07                	jne    802453 <devcons_read+0x18>
+  80244c:	eb 1f                	jmp    80246d <devcons_read+0x32>
+		sys_yield();
+  80244e:	e8 0b dd ff ff       	call   80015e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802453:	e8 6f dc ff ff       	call   8000c7 <sys_cgetc>
+  802458:	85 c0                	test   %eax,%eax
+  80245a:	74 f2                	je     80244e <devcons_read+0x13>
+	if (c < 0)
+  80245c:	78 0f                	js     80246d <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80245e:	83 f8 04             	cmp    $0x4,%eax
+  802461:	74 0c                	je     80246f <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802463:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802466:	88 02                	mov    %al,(%edx)
+	return 1;
+  802468:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80246d:	c9                   	leave
+  80246e:	c3                   	ret
+		return 0;
+  80246f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802474:	eb f7                	jmp    80246d <devcons_read+0x32>
+
+00802476 <cputchar>:
+{
+  802476:	55                   	push   %ebp
+  802477:	89 e5                	mov    %esp,%ebp
+  802479:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80247c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80247f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802482:	6a 01                	push   $0x1
+  802484:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802487:	50                   	push   %eax
+  802488:	e8 14 dc ff ff       	call   8000a1 <sys_cputs>
+}
+  80248d:	83 c4 10             	add    $0x10,%esp
+  802490:	c9                   	leave
+  802491:	c3                   	ret
+
+00802492 <getchar>:
+{
+  802492:	55                   	push   %ebp
+  802493:	89 e5                	mov    %esp,%ebp
+  802495:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802498:	6a 01                	push   $0x1
+  80249a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80249d:	50                   	push   %eax
+  80249e:	6a 00                	push   $0x0
+  8024a0:	e8 bc e3 ff ff       	call   800861 <read>
+	if (r < 0)
+  8024a5:	83 c4 10             	add    $0x10,%esp
+  8024a8:	85 c0                	test   %eax,%eax
+  8024aa:	78 06                	js     8024b2 <getchar+0x20>
+	if (r < 1)
+  8024ac:	74 06                	je     8024b4 <getchar+0x22>
+	return c;
+  8024ae:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8024b2:	c9                   	leave
+  8024b3:	c3                   	ret
+		return -E_EOF;
+  8024b4:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8024b9:	eb f7                	jmp    8024b2 <getchar+0x20>
+
+008024bb <iscons>:
+{
+  8024bb:	55                   	push   %ebp
+  8024bc:	89 e5                	mov    %esp,%ebp
+  8024be:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024c4:	50                   	push   %eax
+  8024c5:	ff 75 08             	push   0x8(%ebp)
+  8024c8:	e8 2e e1 ff ff       	call   8005fb <fd_lookup>
+  8024cd:	83 c4 10             	add    $0x10,%esp
+  8024d0:	85 c0                	test   %eax,%eax
+  8024d2:	78 11                	js     8024e5 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8024d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024d7:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8024dd:	39 10                	cmp    %edx,(%eax)
+  8024df:	0f 94 c0             	sete   %al
+  8024e2:	0f b6 c0             	movzbl %al,%eax
+}
+  8024e5:	c9                   	leave
+  8024e6:	c3                   	ret
+
+008024e7 <opencons>:
+{
+  8024e7:	55                   	push   %ebp
+  8024e8:	89 e5                	mov    %esp,%ebp
+  8024ea:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8024ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024f0:	50                   	push   %eax
+  8024f1:	e8 af e0 ff ff       	call   8005a5 <fd_alloc>
+  8024f6:	83 c4 10             	add    $0x10,%esp
+  8024f9:	85 c0                	test   %eax,%eax
+  8024fb:	78 3a                	js     802537 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8024fd:	83 ec 04             	sub    $0x4,%esp
+  802500:	68 07 04 00 00       	push   $0x407
+  802505:	ff 75 f4             	push   -0xc(%ebp)
+  802508:	6a 00                	push   $0x0
+  80250a:	e8 6e dc ff ff       	call   80017d <sys_page_alloc>
+  80250f:	83 c4 10             	add    $0x10,%esp
+  802512:	85 c0                	test   %eax,%eax
+  802514:	78 21                	js     802537 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802516:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802519:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80251f:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802521:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802524:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80252b:	83 ec 0c             	sub    $0xc,%esp
+  80252e:	50                   	push   %eax
+  80252f:	e8 4a e0 ff ff       	call   80057e <fd2num>
+  802534:	83 c4 10             	add    $0x10,%esp
+}
+  802537:	c9                   	leave
+  802538:	c3                   	ret
+
+00802539 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802539:	55                   	push   %ebp
+  80253a:	89 e5                	mov    %esp,%ebp
+  80253c:	56                   	push   %esi
+  80253d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80253e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802541:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802547:	e8 eb db ff ff       	call   800137 <sys_getenvid>
+  80254c:	83 ec 0c             	sub    $0xc,%esp
+  80254f:	ff 75 0c             	push   0xc(%ebp)
+  802552:	ff 75 08             	push   0x8(%ebp)
+  802555:	56                   	push   %esi
+  802556:	50                   	push   %eax
+  802557:	68 e0 38 80 00       	push   $0x8038e0
+  80255c:	e8 b3 00 00 00       	call   802614 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802561:	83 c4 18             	add    $0x18,%esp
+  802564:	53                   	push   %ebx
+  802565:	ff 75 10             	push   0x10(%ebp)
+  802568:	e8 56 00 00 00       	call   8025c3 <vcprintf>
+	cprintf("\n");
+  80256d:	c7 04 24 cb 38 80 00 	movl   $0x8038cb,(%esp)
+  802574:	e8 9b 00 00 00       	call   802614 <cprintf>
+  802579:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80257c:	cc                   	int3
+	while (1)
+  80257d:	eb fd                	jmp    80257c <_panic+0x43>
+
+0080257f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80257f:	55                   	push   %ebp
+  802580:	89 e5                	mov    %esp,%ebp
+  802582:	53                   	push   %ebx
+  802583:	83 ec 04             	sub    $0x4,%esp
+  802586:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802589:	8b 13                	mov    (%ebx),%edx
+  80258b:	8d 42 01             	lea    0x1(%edx),%eax
+  80258e:	89 03                	mov    %eax,(%ebx)
+  802590:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802593:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  802597:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80259c:	74 09                	je     8025a7 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80259e:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8025a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025a5:	c9                   	leave
+  8025a6:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8025a7:	83 ec 08             	sub    $0x8,%esp
+  8025aa:	68 ff 00 00 00       	push   $0xff
+  8025af:	8d 43 08             	lea    0x8(%ebx),%eax
+  8025b2:	50                   	push   %eax
+  8025b3:	e8 e9 da ff ff       	call   8000a1 <sys_cputs>
+		b->idx = 0;
+  8025b8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8025be:	83 c4 10             	add    $0x10,%esp
+  8025c1:	eb db                	jmp    80259e <putch+0x1f>
+
+008025c3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8025c3:	55                   	push   %ebp
+  8025c4:	89 e5                	mov    %esp,%ebp
+  8025c6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8025cc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8025d3:	00 00 00 
+	b.cnt = 0;
+  8025d6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8025dd:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8025e0:	ff 75 0c             	push   0xc(%ebp)
+  8025e3:	ff 75 08             	push   0x8(%ebp)
+  8025e6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8025ec:	50                   	push   %eax
+  8025ed:	68 7f 25 80 00       	push   $0x80257f
+  8025f2:	e8 14 01 00 00       	call   80270b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8025f7:	83 c4 08             	add    $0x8,%esp
+  8025fa:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802600:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802606:	50                   	push   %eax
+  802607:	e8 95 da ff ff       	call   8000a1 <sys_cputs>
+
+	return b.cnt;
+}
+  80260c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802612:	c9                   	leave
+  802613:	c3                   	ret
+
+00802614 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802614:	55                   	push   %ebp
+  802615:	89 e5                	mov    %esp,%ebp
+  802617:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80261a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80261d:	50                   	push   %eax
+  80261e:	ff 75 08             	push   0x8(%ebp)
+  802621:	e8 9d ff ff ff       	call   8025c3 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802626:	c9                   	leave
+  802627:	c3                   	ret
+
+00802628 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802628:	55                   	push   %ebp
+  802629:	89 e5                	mov    %esp,%ebp
+  80262b:	57                   	push   %edi
+  80262c:	56                   	push   %esi
+  80262d:	53                   	push   %ebx
+  80262e:	83 ec 1c             	sub    $0x1c,%esp
+  802631:	89 c7                	mov    %eax,%edi
+  802633:	89 d6                	mov    %edx,%esi
+  802635:	8b 45 08             	mov    0x8(%ebp),%eax
+  802638:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80263b:	89 d1                	mov    %edx,%ecx
+  80263d:	89 c2                	mov    %eax,%edx
+  80263f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802642:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802645:	8b 45 10             	mov    0x10(%ebp),%eax
+  802648:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80264b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80264e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802655:	39 c2                	cmp    %eax,%edx
+  802657:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80265a:	72 3e                	jb     80269a <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80265c:	83 ec 0c             	sub    $0xc,%esp
+  80265f:	ff 75 18             	push   0x18(%ebp)
+  802662:	83 eb 01             	sub    $0x1,%ebx
+  802665:	53                   	push   %ebx
+  802666:	50                   	push   %eax
+  802667:	83 ec 08             	sub    $0x8,%esp
+  80266a:	ff 75 e4             	push   -0x1c(%ebp)
+  80266d:	ff 75 e0             	push   -0x20(%ebp)
+  802670:	ff 75 dc             	push   -0x24(%ebp)
+  802673:	ff 75 d8             	push   -0x28(%ebp)
+  802676:	e8 59 0f 00 00       	call   8035d4 <__udivdi3>
+  80267b:	83 c4 18             	add    $0x18,%esp
+  80267e:	52                   	push   %edx
+  80267f:	50                   	push   %eax
+  802680:	89 f2                	mov    %esi,%edx
+  802682:	89 f8                	mov    %edi,%eax
+  802684:	e8 9f ff ff ff       	call   802628 <printnum>
+  802689:	83 c4 20             	add    $0x20,%esp
+  80268c:	eb 13                	jmp    8026a1 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80268e:	83 ec 08             	sub    $0x8,%esp
+  802691:	56                   	push   %esi
+  802692:	ff 75 18             	push   0x18(%ebp)
+  802695:	ff d7                	call   *%edi
+  802697:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80269a:	83 eb 01             	sub    $0x1,%ebx
+  80269d:	85 db                	test   %ebx,%ebx
+  80269f:	7f ed                	jg     80268e <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8026a1:	83 ec 08             	sub    $0x8,%esp
+  8026a4:	56                   	push   %esi
+  8026a5:	83 ec 04             	sub    $0x4,%esp
+  8026a8:	ff 75 e4             	push   -0x1c(%ebp)
+  8026ab:	ff 75 e0             	push   -0x20(%ebp)
+  8026ae:	ff 75 dc             	push   -0x24(%ebp)
+  8026b1:	ff 75 d8             	push   -0x28(%ebp)
+  8026b4:	e8 39 0f 00 00       	call   8035f2 <__umoddi3>
+  8026b9:	83 c4 14             	add    $0x14,%esp
+  8026bc:	0f be 80 03 39 80 00 	movsbl 0x803903(%eax),%eax
+  8026c3:	50                   	push   %eax
+  8026c4:	ff d7                	call   *%edi
+}
+  8026c6:	83 c4 10             	add    $0x10,%esp
+  8026c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026cc:	5b                   	pop    %ebx
+  8026cd:	5e                   	pop    %esi
+  8026ce:	5f                   	pop    %edi
+  8026cf:	5d                   	pop    %ebp
+  8026d0:	c3                   	ret
+
+008026d1 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8026d1:	55                   	push   %ebp
+  8026d2:	89 e5                	mov    %esp,%ebp
+  8026d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8026d7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8026db:	8b 10                	mov    (%eax),%edx
+  8026dd:	3b 50 04             	cmp    0x4(%eax),%edx
+  8026e0:	73 0a                	jae    8026ec <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8026e2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8026e5:	89 08                	mov    %ecx,(%eax)
+  8026e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ea:	88 02                	mov    %al,(%edx)
+}
+  8026ec:	5d                   	pop    %ebp
+  8026ed:	c3                   	ret
+
+008026ee <printfmt>:
+{
+  8026ee:	55                   	push   %ebp
+  8026ef:	89 e5                	mov    %esp,%ebp
+  8026f1:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8026f4:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8026f7:	50                   	push   %eax
+  8026f8:	ff 75 10             	push   0x10(%ebp)
+  8026fb:	ff 75 0c             	push   0xc(%ebp)
+  8026fe:	ff 75 08             	push   0x8(%ebp)
+  802701:	e8 05 00 00 00       	call   80270b <vprintfmt>
+}
+  802706:	83 c4 10             	add    $0x10,%esp
+  802709:	c9                   	leave
+  80270a:	c3                   	ret
+
+0080270b <vprintfmt>:
+{
+  80270b:	55                   	push   %ebp
+  80270c:	89 e5                	mov    %esp,%ebp
+  80270e:	57                   	push   %edi
+  80270f:	56                   	push   %esi
+  802710:	53                   	push   %ebx
+  802711:	83 ec 2c             	sub    $0x2c,%esp
+  802714:	8b 75 08             	mov    0x8(%ebp),%esi
+  802717:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80271a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80271d:	eb 0a                	jmp    802729 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80271f:	83 ec 08             	sub    $0x8,%esp
+  802722:	53                   	push   %ebx
+  802723:	50                   	push   %eax
+  802724:	ff d6                	call   *%esi
+  802726:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802729:	83 c7 01             	add    $0x1,%edi
+  80272c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  802730:	83 f8 25             	cmp    $0x25,%eax
+  802733:	74 0c                	je     802741 <vprintfmt+0x36>
+			if (ch == '\0')
+  802735:	85 c0                	test   %eax,%eax
+  802737:	75 e6                	jne    80271f <vprintfmt+0x14>
+}
+  802739:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80273c:	5b                   	pop    %ebx
+  80273d:	5e                   	pop    %esi
+  80273e:	5f                   	pop    %edi
+  80273f:	5d                   	pop    %ebp
+  802740:	c3                   	ret
+		padc = ' ';
+  802741:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  802745:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80274c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  802753:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80275a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80275f:	8d 47 01             	lea    0x1(%edi),%eax
+  802762:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802765:	0f b6 17             	movzbl (%edi),%edx
+  802768:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80276b:	3c 55                	cmp    $0x55,%al
+  80276d:	0f 87 cf 03 00 00    	ja     802b42 <vprintfmt+0x437>
+  802773:	0f b6 c0             	movzbl %al,%eax
+  802776:	ff 24 85 60 3a 80 00 	jmp    *0x803a60(,%eax,4)
+  80277d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  802780:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  802784:	eb d9                	jmp    80275f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  802786:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802789:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80278d:	eb d0                	jmp    80275f <vprintfmt+0x54>
+  80278f:	0f b6 d2             	movzbl %dl,%edx
+  802792:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  802795:	b8 00 00 00 00       	mov    $0x0,%eax
+  80279a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80279d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8027a0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8027a4:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8027a7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8027aa:	83 f9 09             	cmp    $0x9,%ecx
+  8027ad:	77 55                	ja     802804 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8027af:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8027b2:	eb e9                	jmp    80279d <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8027b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027b7:	8b 00                	mov    (%eax),%eax
+  8027b9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8027bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8027c2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8027c8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8027cc:	79 91                	jns    80275f <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8027ce:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8027d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8027d4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8027db:	eb 82                	jmp    80275f <vprintfmt+0x54>
+			if (width < 0)
+  8027dd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8027e0:	85 d2                	test   %edx,%edx
+  8027e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e7:	0f 49 c2             	cmovns %edx,%eax
+  8027ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8027f0:	e9 6a ff ff ff       	jmp    80275f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8027f5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8027f8:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8027ff:	e9 5b ff ff ff       	jmp    80275f <vprintfmt+0x54>
+  802804:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802807:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80280a:	eb bc                	jmp    8027c8 <vprintfmt+0xbd>
+			lflag++;
+  80280c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80280f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  802812:	e9 48 ff ff ff       	jmp    80275f <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  802817:	8b 45 14             	mov    0x14(%ebp),%eax
+  80281a:	8d 78 04             	lea    0x4(%eax),%edi
+  80281d:	83 ec 08             	sub    $0x8,%esp
+  802820:	53                   	push   %ebx
+  802821:	ff 30                	push   (%eax)
+  802823:	ff d6                	call   *%esi
+			break;
+  802825:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802828:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80282b:	e9 b1 02 00 00       	jmp    802ae1 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  802830:	8b 45 14             	mov    0x14(%ebp),%eax
+  802833:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  802836:	8b 10                	mov    (%eax),%edx
+  802838:	89 d0                	mov    %edx,%eax
+  80283a:	f7 d8                	neg    %eax
+  80283c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80283f:	83 f8 11             	cmp    $0x11,%eax
+  802842:	7f 23                	jg     802867 <vprintfmt+0x15c>
+  802844:	8b 14 85 c0 3b 80 00 	mov    0x803bc0(,%eax,4),%edx
+  80284b:	85 d2                	test   %edx,%edx
+  80284d:	74 18                	je     802867 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80284f:	52                   	push   %edx
+  802850:	68 36 38 80 00       	push   $0x803836
+  802855:	53                   	push   %ebx
+  802856:	56                   	push   %esi
+  802857:	e8 92 fe ff ff       	call   8026ee <printfmt>
+  80285c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80285f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  802862:	e9 7a 02 00 00       	jmp    802ae1 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  802867:	50                   	push   %eax
+  802868:	68 1b 39 80 00       	push   $0x80391b
+  80286d:	53                   	push   %ebx
+  80286e:	56                   	push   %esi
+  80286f:	e8 7a fe ff ff       	call   8026ee <printfmt>
+  802874:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802877:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80287a:	e9 62 02 00 00       	jmp    802ae1 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80287f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802882:	83 c0 04             	add    $0x4,%eax
+  802885:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  802888:	8b 45 14             	mov    0x14(%ebp),%eax
+  80288b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80288d:	85 c9                	test   %ecx,%ecx
+  80288f:	b8 14 39 80 00       	mov    $0x803914,%eax
+  802894:	0f 45 c1             	cmovne %ecx,%eax
+  802897:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80289a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80289e:	7e 06                	jle    8028a6 <vprintfmt+0x19b>
+  8028a0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8028a4:	75 0b                	jne    8028b1 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028a6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8028a9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8028ac:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028af:	eb 5c                	jmp    80290d <vprintfmt+0x202>
+  8028b1:	83 ec 08             	sub    $0x8,%esp
+  8028b4:	ff 75 d0             	push   -0x30(%ebp)
+  8028b7:	ff 75 cc             	push   -0x34(%ebp)
+  8028ba:	e8 20 03 00 00       	call   802bdf <strnlen>
+  8028bf:	89 c2                	mov    %eax,%edx
+  8028c1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028c4:	29 d0                	sub    %edx,%eax
+  8028c6:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8028c9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8028cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028d0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028d3:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028d5:	eb 0e                	jmp    8028e5 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8028d7:	83 ec 08             	sub    $0x8,%esp
+  8028da:	53                   	push   %ebx
+  8028db:	57                   	push   %edi
+  8028dc:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028df:	83 ee 01             	sub    $0x1,%esi
+  8028e2:	83 c4 10             	add    $0x10,%esp
+  8028e5:	85 f6                	test   %esi,%esi
+  8028e7:	7f ee                	jg     8028d7 <vprintfmt+0x1cc>
+  8028e9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028ef:	85 c0                	test   %eax,%eax
+  8028f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028f6:	0f 49 d0             	cmovns %eax,%edx
+  8028f9:	29 d0                	sub    %edx,%eax
+  8028fb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028fe:	eb a6                	jmp    8028a6 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  802900:	83 ec 08             	sub    $0x8,%esp
+  802903:	53                   	push   %ebx
+  802904:	52                   	push   %edx
+  802905:	ff 55 08             	call   *0x8(%ebp)
+  802908:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80290b:	89 f1                	mov    %esi,%ecx
+  80290d:	8d 71 01             	lea    0x1(%ecx),%esi
+  802910:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802914:	0f be d0             	movsbl %al,%edx
+  802917:	85 d2                	test   %edx,%edx
+  802919:	74 28                	je     802943 <vprintfmt+0x238>
+  80291b:	85 ff                	test   %edi,%edi
+  80291d:	78 05                	js     802924 <vprintfmt+0x219>
+  80291f:	83 ef 01             	sub    $0x1,%edi
+  802922:	78 30                	js     802954 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802924:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802928:	74 d6                	je     802900 <vprintfmt+0x1f5>
+  80292a:	0f be c0             	movsbl %al,%eax
+  80292d:	83 e8 20             	sub    $0x20,%eax
+  802930:	83 f8 5e             	cmp    $0x5e,%eax
+  802933:	76 cb                	jbe    802900 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  802935:	83 ec 08             	sub    $0x8,%esp
+  802938:	53                   	push   %ebx
+  802939:	6a 3f                	push   $0x3f
+  80293b:	ff 55 08             	call   *0x8(%ebp)
+  80293e:	83 c4 10             	add    $0x10,%esp
+  802941:	eb c8                	jmp    80290b <vprintfmt+0x200>
+  802943:	8b 75 08             	mov    0x8(%ebp),%esi
+  802946:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802949:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80294c:	01 d0                	add    %edx,%eax
+  80294e:	29 c8                	sub    %ecx,%eax
+  802950:	89 c7                	mov    %eax,%edi
+  802952:	eb 13                	jmp    802967 <vprintfmt+0x25c>
+  802954:	8b 75 08             	mov    0x8(%ebp),%esi
+  802957:	eb ed                	jmp    802946 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  802959:	83 ec 08             	sub    $0x8,%esp
+  80295c:	53                   	push   %ebx
+  80295d:	6a 20                	push   $0x20
+  80295f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  802961:	83 ef 01             	sub    $0x1,%edi
+  802964:	83 c4 10             	add    $0x10,%esp
+  802967:	85 ff                	test   %edi,%edi
+  802969:	7f ee                	jg     802959 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80296b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80296e:	89 45 14             	mov    %eax,0x14(%ebp)
+  802971:	e9 6b 01 00 00       	jmp    802ae1 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  802976:	83 f9 01             	cmp    $0x1,%ecx
+  802979:	7f 1f                	jg     80299a <vprintfmt+0x28f>
+	else if (lflag)
+  80297b:	85 c9                	test   %ecx,%ecx
+  80297d:	74 67                	je     8029e6 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80297f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802982:	8b 00                	mov    (%eax),%eax
+  802984:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802987:	89 c1                	mov    %eax,%ecx
+  802989:	c1 f9 1f             	sar    $0x1f,%ecx
+  80298c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80298f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802992:	8d 40 04             	lea    0x4(%eax),%eax
+  802995:	89 45 14             	mov    %eax,0x14(%ebp)
+  802998:	eb 17                	jmp    8029b1 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80299a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80299d:	8b 50 04             	mov    0x4(%eax),%edx
+  8029a0:	8b 00                	mov    (%eax),%eax
+  8029a2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029a5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8029a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029ab:	8d 40 08             	lea    0x8(%eax),%eax
+  8029ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8029b1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029b4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8029b7:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8029bc:	85 c9                	test   %ecx,%ecx
+  8029be:	0f 89 03 01 00 00    	jns    802ac7 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8029c4:	83 ec 08             	sub    $0x8,%esp
+  8029c7:	53                   	push   %ebx
+  8029c8:	6a 2d                	push   $0x2d
+  8029ca:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8029cc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029cf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8029d2:	f7 da                	neg    %edx
+  8029d4:	83 d1 00             	adc    $0x0,%ecx
+  8029d7:	f7 d9                	neg    %ecx
+  8029d9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8029dc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029e1:	e9 e1 00 00 00       	jmp    802ac7 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8029e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029e9:	8b 00                	mov    (%eax),%eax
+  8029eb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029ee:	89 c1                	mov    %eax,%ecx
+  8029f0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8029f3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8029f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8029fc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8029ff:	eb b0                	jmp    8029b1 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  802a01:	83 f9 01             	cmp    $0x1,%ecx
+  802a04:	7f 1e                	jg     802a24 <vprintfmt+0x319>
+	else if (lflag)
+  802a06:	85 c9                	test   %ecx,%ecx
+  802a08:	74 32                	je     802a3c <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802a0a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a0d:	8b 10                	mov    (%eax),%edx
+  802a0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a14:	8d 40 04             	lea    0x4(%eax),%eax
+  802a17:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a1a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  802a1f:	e9 a3 00 00 00       	jmp    802ac7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a24:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a27:	8b 10                	mov    (%eax),%edx
+  802a29:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a2c:	8d 40 08             	lea    0x8(%eax),%eax
+  802a2f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a32:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  802a37:	e9 8b 00 00 00       	jmp    802ac7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a3c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a3f:	8b 10                	mov    (%eax),%edx
+  802a41:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a46:	8d 40 04             	lea    0x4(%eax),%eax
+  802a49:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a4c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  802a51:	eb 74                	jmp    802ac7 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  802a53:	83 f9 01             	cmp    $0x1,%ecx
+  802a56:	7f 1b                	jg     802a73 <vprintfmt+0x368>
+	else if (lflag)
+  802a58:	85 c9                	test   %ecx,%ecx
+  802a5a:	74 2c                	je     802a88 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  802a5c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a5f:	8b 10                	mov    (%eax),%edx
+  802a61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a66:	8d 40 04             	lea    0x4(%eax),%eax
+  802a69:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a6c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  802a71:	eb 54                	jmp    802ac7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a73:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a76:	8b 10                	mov    (%eax),%edx
+  802a78:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a7b:	8d 40 08             	lea    0x8(%eax),%eax
+  802a7e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a81:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  802a86:	eb 3f                	jmp    802ac7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a88:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a8b:	8b 10                	mov    (%eax),%edx
+  802a8d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a92:	8d 40 04             	lea    0x4(%eax),%eax
+  802a95:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a98:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802a9d:	eb 28                	jmp    802ac7 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  802a9f:	83 ec 08             	sub    $0x8,%esp
+  802aa2:	53                   	push   %ebx
+  802aa3:	6a 30                	push   $0x30
+  802aa5:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802aa7:	83 c4 08             	add    $0x8,%esp
+  802aaa:	53                   	push   %ebx
+  802aab:	6a 78                	push   $0x78
+  802aad:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802aaf:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ab2:	8b 10                	mov    (%eax),%edx
+  802ab4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802ab9:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802abc:	8d 40 04             	lea    0x4(%eax),%eax
+  802abf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802ac2:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802ac7:	83 ec 0c             	sub    $0xc,%esp
+  802aca:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802ace:	50                   	push   %eax
+  802acf:	ff 75 e0             	push   -0x20(%ebp)
+  802ad2:	57                   	push   %edi
+  802ad3:	51                   	push   %ecx
+  802ad4:	52                   	push   %edx
+  802ad5:	89 da                	mov    %ebx,%edx
+  802ad7:	89 f0                	mov    %esi,%eax
+  802ad9:	e8 4a fb ff ff       	call   802628 <printnum>
+			break;
+  802ade:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802ae1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802ae4:	e9 40 fc ff ff       	jmp    802729 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802ae9:	83 f9 01             	cmp    $0x1,%ecx
+  802aec:	7f 1b                	jg     802b09 <vprintfmt+0x3fe>
+	else if (lflag)
+  802aee:	85 c9                	test   %ecx,%ecx
+  802af0:	74 2c                	je     802b1e <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802af2:	8b 45 14             	mov    0x14(%ebp),%eax
+  802af5:	8b 10                	mov    (%eax),%edx
+  802af7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802afc:	8d 40 04             	lea    0x4(%eax),%eax
+  802aff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b02:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802b07:	eb be                	jmp    802ac7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802b09:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b0c:	8b 10                	mov    (%eax),%edx
+  802b0e:	8b 48 04             	mov    0x4(%eax),%ecx
+  802b11:	8d 40 08             	lea    0x8(%eax),%eax
+  802b14:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b17:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802b1c:	eb a9                	jmp    802ac7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802b1e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b21:	8b 10                	mov    (%eax),%edx
+  802b23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b28:	8d 40 04             	lea    0x4(%eax),%eax
+  802b2b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b2e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  802b33:	eb 92                	jmp    802ac7 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  802b35:	83 ec 08             	sub    $0x8,%esp
+  802b38:	53                   	push   %ebx
+  802b39:	6a 25                	push   $0x25
+  802b3b:	ff d6                	call   *%esi
+			break;
+  802b3d:	83 c4 10             	add    $0x10,%esp
+  802b40:	eb 9f                	jmp    802ae1 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  802b42:	83 ec 08             	sub    $0x8,%esp
+  802b45:	53                   	push   %ebx
+  802b46:	6a 25                	push   $0x25
+  802b48:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802b4a:	83 c4 10             	add    $0x10,%esp
+  802b4d:	89 f8                	mov    %edi,%eax
+  802b4f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802b53:	74 05                	je     802b5a <vprintfmt+0x44f>
+  802b55:	83 e8 01             	sub    $0x1,%eax
+  802b58:	eb f5                	jmp    802b4f <vprintfmt+0x444>
+  802b5a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b5d:	eb 82                	jmp    802ae1 <vprintfmt+0x3d6>
+
+00802b5f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802b5f:	55                   	push   %ebp
+  802b60:	89 e5                	mov    %esp,%ebp
+  802b62:	83 ec 18             	sub    $0x18,%esp
+  802b65:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b68:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  802b6b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802b6e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802b72:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802b75:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802b7c:	85 c0                	test   %eax,%eax
+  802b7e:	74 26                	je     802ba6 <vsnprintf+0x47>
+  802b80:	85 d2                	test   %edx,%edx
+  802b82:	7e 22                	jle    802ba6 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  802b84:	ff 75 14             	push   0x14(%ebp)
+  802b87:	ff 75 10             	push   0x10(%ebp)
+  802b8a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802b8d:	50                   	push   %eax
+  802b8e:	68 d1 26 80 00       	push   $0x8026d1
+  802b93:	e8 73 fb ff ff       	call   80270b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802b98:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802b9b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802b9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ba1:	83 c4 10             	add    $0x10,%esp
+}
+  802ba4:	c9                   	leave
+  802ba5:	c3                   	ret
+		return -E_INVAL;
+  802ba6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bab:	eb f7                	jmp    802ba4 <vsnprintf+0x45>
+
+00802bad <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802bad:	55                   	push   %ebp
+  802bae:	89 e5                	mov    %esp,%ebp
+  802bb0:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  802bb3:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802bb6:	50                   	push   %eax
+  802bb7:	ff 75 10             	push   0x10(%ebp)
+  802bba:	ff 75 0c             	push   0xc(%ebp)
+  802bbd:	ff 75 08             	push   0x8(%ebp)
+  802bc0:	e8 9a ff ff ff       	call   802b5f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802bc5:	c9                   	leave
+  802bc6:	c3                   	ret
+
+00802bc7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802bc7:	55                   	push   %ebp
+  802bc8:	89 e5                	mov    %esp,%ebp
+  802bca:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd2:	eb 03                	jmp    802bd7 <strlen+0x10>
+		n++;
+  802bd4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802bd7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802bdb:	75 f7                	jne    802bd4 <strlen+0xd>
+	return n;
+}
+  802bdd:	5d                   	pop    %ebp
+  802bde:	c3                   	ret
+
+00802bdf <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802bdf:	55                   	push   %ebp
+  802be0:	89 e5                	mov    %esp,%ebp
+  802be2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802be5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bed:	eb 03                	jmp    802bf2 <strnlen+0x13>
+		n++;
+  802bef:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802bf2:	39 d0                	cmp    %edx,%eax
+  802bf4:	74 08                	je     802bfe <strnlen+0x1f>
+  802bf6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802bfa:	75 f3                	jne    802bef <strnlen+0x10>
+  802bfc:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802bfe:	89 d0                	mov    %edx,%eax
+  802c00:	5d                   	pop    %ebp
+  802c01:	c3                   	ret
+
+00802c02 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802c02:	55                   	push   %ebp
+  802c03:	89 e5                	mov    %esp,%ebp
+  802c05:	53                   	push   %ebx
+  802c06:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c11:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802c15:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802c18:	83 c0 01             	add    $0x1,%eax
+  802c1b:	84 d2                	test   %dl,%dl
+  802c1d:	75 f2                	jne    802c11 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  802c1f:	89 c8                	mov    %ecx,%eax
+  802c21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c24:	c9                   	leave
+  802c25:	c3                   	ret
+
+00802c26 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802c26:	55                   	push   %ebp
+  802c27:	89 e5                	mov    %esp,%ebp
+  802c29:	53                   	push   %ebx
+  802c2a:	83 ec 10             	sub    $0x10,%esp
+  802c2d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  802c30:	53                   	push   %ebx
+  802c31:	e8 91 ff ff ff       	call   802bc7 <strlen>
+  802c36:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  802c39:	ff 75 0c             	push   0xc(%ebp)
+  802c3c:	01 d8                	add    %ebx,%eax
+  802c3e:	50                   	push   %eax
+  802c3f:	e8 be ff ff ff       	call   802c02 <strcpy>
+	return dst;
+}
+  802c44:	89 d8                	mov    %ebx,%eax
+  802c46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c49:	c9                   	leave
+  802c4a:	c3                   	ret
+
+00802c4b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802c4b:	55                   	push   %ebp
+  802c4c:	89 e5                	mov    %esp,%ebp
+  802c4e:	56                   	push   %esi
+  802c4f:	53                   	push   %ebx
+  802c50:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c53:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  802c56:	89 f3                	mov    %esi,%ebx
+  802c58:	03 5d 10             	add    0x10(%ebp),%ebx
+  802c5b:	89 f0                	mov    %esi,%eax
+  802c5d:	eb 0f                	jmp    802c6e <strncpy+0x23>
+		*dst++ = *src;
+  802c5f:	83 c0 01             	add    $0x1,%eax
+  802c62:	0f b6 0a             	movzbl (%edx),%ecx
+  802c65:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  802c68:	80 f9 01             	cmp    $0x1,%cl
+  802c6b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  802c6e:	39 d8                	cmp    %ebx,%eax
+  802c70:	75 ed                	jne    802c5f <strncpy+0x14>
+	}
+	return ret;
+}
+  802c72:	89 f0                	mov    %esi,%eax
+  802c74:	5b                   	pop    %ebx
+  802c75:	5e                   	pop    %esi
+  802c76:	5d                   	pop    %ebp
+  802c77:	c3                   	ret
+
+00802c78 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802c78:	55                   	push   %ebp
+  802c79:	89 e5                	mov    %esp,%ebp
+  802c7b:	56                   	push   %esi
+  802c7c:	53                   	push   %ebx
+  802c7d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c83:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  802c86:	89 f0                	mov    %esi,%eax
+  802c88:	85 d2                	test   %edx,%edx
+  802c8a:	74 21                	je     802cad <strlcpy+0x35>
+  802c8c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  802c90:	89 f2                	mov    %esi,%edx
+  802c92:	eb 09                	jmp    802c9d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  802c94:	83 c1 01             	add    $0x1,%ecx
+  802c97:	83 c2 01             	add    $0x1,%edx
+  802c9a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  802c9d:	39 c2                	cmp    %eax,%edx
+  802c9f:	74 09                	je     802caa <strlcpy+0x32>
+  802ca1:	0f b6 19             	movzbl (%ecx),%ebx
+  802ca4:	84 db                	test   %bl,%bl
+  802ca6:	75 ec                	jne    802c94 <strlcpy+0x1c>
+  802ca8:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802caa:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802cad:	29 f0                	sub    %esi,%eax
+}
+  802caf:	5b                   	pop    %ebx
+  802cb0:	5e                   	pop    %esi
+  802cb1:	5d                   	pop    %ebp
+  802cb2:	c3                   	ret
+
+00802cb3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802cb3:	55                   	push   %ebp
+  802cb4:	89 e5                	mov    %esp,%ebp
+  802cb6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802cb9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802cbc:	eb 06                	jmp    802cc4 <strcmp+0x11>
+		p++, q++;
+  802cbe:	83 c1 01             	add    $0x1,%ecx
+  802cc1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802cc4:	0f b6 01             	movzbl (%ecx),%eax
+  802cc7:	84 c0                	test   %al,%al
+  802cc9:	74 04                	je     802ccf <strcmp+0x1c>
+  802ccb:	3a 02                	cmp    (%edx),%al
+  802ccd:	74 ef                	je     802cbe <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802ccf:	0f b6 c0             	movzbl %al,%eax
+  802cd2:	0f b6 12             	movzbl (%edx),%edx
+  802cd5:	29 d0                	sub    %edx,%eax
+}
+  802cd7:	5d                   	pop    %ebp
+  802cd8:	c3                   	ret
+
+00802cd9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802cd9:	55                   	push   %ebp
+  802cda:	89 e5                	mov    %esp,%ebp
+  802cdc:	53                   	push   %ebx
+  802cdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ce3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802ce6:	eb 09                	jmp    802cf1 <strncmp+0x18>
+		n--, p++, q++;
+  802ce8:	83 ea 01             	sub    $0x1,%edx
+  802ceb:	83 c0 01             	add    $0x1,%eax
+  802cee:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802cf1:	85 d2                	test   %edx,%edx
+  802cf3:	74 18                	je     802d0d <strncmp+0x34>
+  802cf5:	0f b6 18             	movzbl (%eax),%ebx
+  802cf8:	84 db                	test   %bl,%bl
+  802cfa:	74 04                	je     802d00 <strncmp+0x27>
+  802cfc:	3a 19                	cmp    (%ecx),%bl
+  802cfe:	74 e8                	je     802ce8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802d00:	0f b6 00             	movzbl (%eax),%eax
+  802d03:	0f b6 11             	movzbl (%ecx),%edx
+  802d06:	29 d0                	sub    %edx,%eax
+}
+  802d08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d0b:	c9                   	leave
+  802d0c:	c3                   	ret
+		return 0;
+  802d0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d12:	eb f4                	jmp    802d08 <strncmp+0x2f>
+
+00802d14 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802d14:	55                   	push   %ebp
+  802d15:	89 e5                	mov    %esp,%ebp
+  802d17:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d1a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d1e:	eb 03                	jmp    802d23 <strchr+0xf>
+  802d20:	83 c0 01             	add    $0x1,%eax
+  802d23:	0f b6 10             	movzbl (%eax),%edx
+  802d26:	84 d2                	test   %dl,%dl
+  802d28:	74 06                	je     802d30 <strchr+0x1c>
+		if (*s == c)
+  802d2a:	38 ca                	cmp    %cl,%dl
+  802d2c:	75 f2                	jne    802d20 <strchr+0xc>
+  802d2e:	eb 05                	jmp    802d35 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  802d30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d35:	5d                   	pop    %ebp
+  802d36:	c3                   	ret
+
+00802d37 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802d37:	55                   	push   %ebp
+  802d38:	89 e5                	mov    %esp,%ebp
+  802d3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d3d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d41:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  802d44:	38 ca                	cmp    %cl,%dl
+  802d46:	74 09                	je     802d51 <strfind+0x1a>
+  802d48:	84 d2                	test   %dl,%dl
+  802d4a:	74 05                	je     802d51 <strfind+0x1a>
+	for (; *s; s++)
+  802d4c:	83 c0 01             	add    $0x1,%eax
+  802d4f:	eb f0                	jmp    802d41 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  802d51:	5d                   	pop    %ebp
+  802d52:	c3                   	ret
+
+00802d53 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802d53:	55                   	push   %ebp
+  802d54:	89 e5                	mov    %esp,%ebp
+  802d56:	57                   	push   %edi
+  802d57:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d5a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  802d5d:	85 c9                	test   %ecx,%ecx
+  802d5f:	74 20                	je     802d81 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  802d61:	89 f8                	mov    %edi,%eax
+  802d63:	09 c8                	or     %ecx,%eax
+  802d65:	a8 03                	test   $0x3,%al
+  802d67:	75 12                	jne    802d7b <memset+0x28>
+		c &= 0xFF;
+  802d69:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802d6d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  802d73:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  802d76:	fc                   	cld
+  802d77:	f3 ab                	rep stos %eax,%es:(%edi)
+  802d79:	eb 06                	jmp    802d81 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  802d7b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d7e:	fc                   	cld
+  802d7f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  802d81:	89 f8                	mov    %edi,%eax
+  802d83:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802d86:	c9                   	leave
+  802d87:	c3                   	ret
+
+00802d88 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  802d88:	55                   	push   %ebp
+  802d89:	89 e5                	mov    %esp,%ebp
+  802d8b:	57                   	push   %edi
+  802d8c:	56                   	push   %esi
+  802d8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d90:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d93:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  802d96:	39 c6                	cmp    %eax,%esi
+  802d98:	73 32                	jae    802dcc <memmove+0x44>
+  802d9a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802d9d:	39 d0                	cmp    %edx,%eax
+  802d9f:	73 2b                	jae    802dcc <memmove+0x44>
+		s += n;
+		d += n;
+  802da1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802da4:	89 d6                	mov    %edx,%esi
+  802da6:	09 fe                	or     %edi,%esi
+  802da8:	09 ce                	or     %ecx,%esi
+  802daa:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802db0:	75 0e                	jne    802dc0 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802db2:	83 ef 04             	sub    $0x4,%edi
+  802db5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802db8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802dbb:	fd                   	std
+  802dbc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802dbe:	eb 09                	jmp    802dc9 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802dc0:	83 ef 01             	sub    $0x1,%edi
+  802dc3:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802dc6:	fd                   	std
+  802dc7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802dc9:	fc                   	cld
+  802dca:	eb 1a                	jmp    802de6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802dcc:	89 f2                	mov    %esi,%edx
+  802dce:	09 c2                	or     %eax,%edx
+  802dd0:	09 ca                	or     %ecx,%edx
+  802dd2:	f6 c2 03             	test   $0x3,%dl
+  802dd5:	75 0a                	jne    802de1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802dd7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802dda:	89 c7                	mov    %eax,%edi
+  802ddc:	fc                   	cld
+  802ddd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802ddf:	eb 05                	jmp    802de6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802de1:	89 c7                	mov    %eax,%edi
+  802de3:	fc                   	cld
+  802de4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802de6:	5e                   	pop    %esi
+  802de7:	5f                   	pop    %edi
+  802de8:	5d                   	pop    %ebp
+  802de9:	c3                   	ret
+
+00802dea <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802dea:	55                   	push   %ebp
+  802deb:	89 e5                	mov    %esp,%ebp
+  802ded:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802df0:	ff 75 10             	push   0x10(%ebp)
+  802df3:	ff 75 0c             	push   0xc(%ebp)
+  802df6:	ff 75 08             	push   0x8(%ebp)
+  802df9:	e8 8a ff ff ff       	call   802d88 <memmove>
+}
+  802dfe:	c9                   	leave
+  802dff:	c3                   	ret
+
+00802e00 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802e00:	55                   	push   %ebp
+  802e01:	89 e5                	mov    %esp,%ebp
+  802e03:	56                   	push   %esi
+  802e04:	53                   	push   %ebx
+  802e05:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e08:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802e0b:	89 c6                	mov    %eax,%esi
+  802e0d:	03 75 10             	add    0x10(%ebp),%esi
+  802e10:	eb 06                	jmp    802e18 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802e12:	83 c0 01             	add    $0x1,%eax
+  802e15:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802e18:	39 f0                	cmp    %esi,%eax
+  802e1a:	74 14                	je     802e30 <memcmp+0x30>
+		if (*s1 != *s2)
+  802e1c:	0f b6 08             	movzbl (%eax),%ecx
+  802e1f:	0f b6 1a             	movzbl (%edx),%ebx
+  802e22:	38 d9                	cmp    %bl,%cl
+  802e24:	74 ec                	je     802e12 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802e26:	0f b6 c1             	movzbl %cl,%eax
+  802e29:	0f b6 db             	movzbl %bl,%ebx
+  802e2c:	29 d8                	sub    %ebx,%eax
+  802e2e:	eb 05                	jmp    802e35 <memcmp+0x35>
+	}
+
+	return 0;
+  802e30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e35:	5b                   	pop    %ebx
+  802e36:	5e                   	pop    %esi
+  802e37:	5d                   	pop    %ebp
+  802e38:	c3                   	ret
+
+00802e39 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802e39:	55                   	push   %ebp
+  802e3a:	89 e5                	mov    %esp,%ebp
+  802e3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802e42:	89 c2                	mov    %eax,%edx
+  802e44:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802e47:	eb 03                	jmp    802e4c <memfind+0x13>
+  802e49:	83 c0 01             	add    $0x1,%eax
+  802e4c:	39 d0                	cmp    %edx,%eax
+  802e4e:	73 04                	jae    802e54 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802e50:	38 08                	cmp    %cl,(%eax)
+  802e52:	75 f5                	jne    802e49 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802e54:	5d                   	pop    %ebp
+  802e55:	c3                   	ret
+
+00802e56 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802e56:	55                   	push   %ebp
+  802e57:	89 e5                	mov    %esp,%ebp
+  802e59:	57                   	push   %edi
+  802e5a:	56                   	push   %esi
+  802e5b:	53                   	push   %ebx
+  802e5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802e62:	eb 03                	jmp    802e67 <strtol+0x11>
+		s++;
+  802e64:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802e67:	0f b6 02             	movzbl (%edx),%eax
+  802e6a:	3c 20                	cmp    $0x20,%al
+  802e6c:	74 f6                	je     802e64 <strtol+0xe>
+  802e6e:	3c 09                	cmp    $0x9,%al
+  802e70:	74 f2                	je     802e64 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802e72:	3c 2b                	cmp    $0x2b,%al
+  802e74:	74 2a                	je     802ea0 <strtol+0x4a>
+	int neg = 0;
+  802e76:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802e7b:	3c 2d                	cmp    $0x2d,%al
+  802e7d:	74 2b                	je     802eaa <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802e7f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802e85:	75 0f                	jne    802e96 <strtol+0x40>
+  802e87:	80 3a 30             	cmpb   $0x30,(%edx)
+  802e8a:	74 28                	je     802eb4 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802e8c:	85 db                	test   %ebx,%ebx
+  802e8e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802e93:	0f 44 d8             	cmove  %eax,%ebx
+  802e96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e9b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802e9e:	eb 46                	jmp    802ee6 <strtol+0x90>
+		s++;
+  802ea0:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802ea3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ea8:	eb d5                	jmp    802e7f <strtol+0x29>
+		s++, neg = 1;
+  802eaa:	83 c2 01             	add    $0x1,%edx
+  802ead:	bf 01 00 00 00       	mov    $0x1,%edi
+  802eb2:	eb cb                	jmp    802e7f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802eb4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802eb8:	74 0e                	je     802ec8 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802eba:	85 db                	test   %ebx,%ebx
+  802ebc:	75 d8                	jne    802e96 <strtol+0x40>
+		s++, base = 8;
+  802ebe:	83 c2 01             	add    $0x1,%edx
+  802ec1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802ec6:	eb ce                	jmp    802e96 <strtol+0x40>
+		s += 2, base = 16;
+  802ec8:	83 c2 02             	add    $0x2,%edx
+  802ecb:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802ed0:	eb c4                	jmp    802e96 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802ed2:	0f be c0             	movsbl %al,%eax
+  802ed5:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802ed8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802edb:	7d 3a                	jge    802f17 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802edd:	83 c2 01             	add    $0x1,%edx
+  802ee0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802ee4:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802ee6:	0f b6 02             	movzbl (%edx),%eax
+  802ee9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802eec:	89 f3                	mov    %esi,%ebx
+  802eee:	80 fb 09             	cmp    $0x9,%bl
+  802ef1:	76 df                	jbe    802ed2 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  802ef3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802ef6:	89 f3                	mov    %esi,%ebx
+  802ef8:	80 fb 19             	cmp    $0x19,%bl
+  802efb:	77 08                	ja     802f05 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802efd:	0f be c0             	movsbl %al,%eax
+  802f00:	83 e8 57             	sub    $0x57,%eax
+  802f03:	eb d3                	jmp    802ed8 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802f05:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802f08:	89 f3                	mov    %esi,%ebx
+  802f0a:	80 fb 19             	cmp    $0x19,%bl
+  802f0d:	77 08                	ja     802f17 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802f0f:	0f be c0             	movsbl %al,%eax
+  802f12:	83 e8 37             	sub    $0x37,%eax
+  802f15:	eb c1                	jmp    802ed8 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802f17:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802f1b:	74 05                	je     802f22 <strtol+0xcc>
+		*endptr = (char *) s;
+  802f1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f20:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802f22:	89 c8                	mov    %ecx,%eax
+  802f24:	f7 d8                	neg    %eax
+  802f26:	85 ff                	test   %edi,%edi
+  802f28:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802f2b:	89 c8                	mov    %ecx,%eax
+  802f2d:	5b                   	pop    %ebx
+  802f2e:	5e                   	pop    %esi
+  802f2f:	5f                   	pop    %edi
+  802f30:	5d                   	pop    %ebp
+  802f31:	c3                   	ret
+
+00802f32 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802f32:	55                   	push   %ebp
+  802f33:	89 e5                	mov    %esp,%ebp
+  802f35:	57                   	push   %edi
+  802f36:	56                   	push   %esi
+  802f37:	53                   	push   %ebx
+  802f38:	83 ec 20             	sub    $0x20,%esp
+  802f3b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f3e:	89 d7                	mov    %edx,%edi
+  802f40:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802f42:	51                   	push   %ecx
+  802f43:	68 00 f0 7f 00       	push   $0x7ff000
+  802f48:	6a 00                	push   $0x0
+  802f4a:	e8 2e d2 ff ff       	call   80017d <sys_page_alloc>
+  802f4f:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f51:	83 c4 10             	add    $0x10,%esp
+  802f54:	85 c0                	test   %eax,%eax
+  802f56:	78 45                	js     802f9d <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802f58:	83 ec 04             	sub    $0x4,%esp
+  802f5b:	68 00 10 00 00       	push   $0x1000
+  802f60:	57                   	push   %edi
+  802f61:	68 00 f0 7f 00       	push   $0x7ff000
+  802f66:	e8 1d fe ff ff       	call   802d88 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  802f6b:	89 34 24             	mov    %esi,(%esp)
+  802f6e:	57                   	push   %edi
+  802f6f:	ff 75 e4             	push   -0x1c(%ebp)
+  802f72:	68 00 f0 7f 00       	push   $0x7ff000
+  802f77:	6a 00                	push   $0x0
+  802f79:	e8 4a d2 ff ff       	call   8001c8 <sys_page_map>
+  802f7e:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f80:	83 c4 20             	add    $0x20,%esp
+  802f83:	85 c0                	test   %eax,%eax
+  802f85:	78 16                	js     802f9d <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802f87:	83 ec 08             	sub    $0x8,%esp
+  802f8a:	68 00 f0 7f 00       	push   $0x7ff000
+  802f8f:	6a 00                	push   $0x0
+  802f91:	e8 74 d2 ff ff       	call   80020a <sys_page_unmap>
+  802f96:	83 c4 10             	add    $0x10,%esp
+  802f99:	85 c0                	test   %eax,%eax
+  802f9b:	75 0a                	jne    802fa7 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  802f9d:	89 d8                	mov    %ebx,%eax
+  802f9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fa2:	5b                   	pop    %ebx
+  802fa3:	5e                   	pop    %esi
+  802fa4:	5f                   	pop    %edi
+  802fa5:	5d                   	pop    %ebp
+  802fa6:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802fa7:	68 28 3c 80 00       	push   $0x803c28
+  802fac:	68 24 38 80 00       	push   $0x803824
+  802fb1:	6a 1b                	push   $0x1b
+  802fb3:	68 a0 3c 80 00       	push   $0x803ca0
+  802fb8:	e8 7c f5 ff ff       	call   802539 <_panic>
+
+00802fbd <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802fbd:	55                   	push   %ebp
+  802fbe:	89 e5                	mov    %esp,%ebp
+  802fc0:	53                   	push   %ebx
+  802fc1:	83 ec 04             	sub    $0x4,%esp
+  802fc4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  802fc7:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802fc9:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  802fcd:	74 21                	je     802ff0 <pgfault+0x33>
+  802fcf:	89 d0                	mov    %edx,%eax
+  802fd1:	c1 e8 16             	shr    $0x16,%eax
+  802fd4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802fdb:	a8 01                	test   $0x1,%al
+  802fdd:	74 11                	je     802ff0 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  802fdf:	89 d0                	mov    %edx,%eax
+  802fe1:	c1 e8 0c             	shr    $0xc,%eax
+  802fe4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802feb:	f6 c4 08             	test   $0x8,%ah
+  802fee:	75 17                	jne    803007 <pgfault+0x4a>
+		if (pgfault_next) {
+  802ff0:	a1 04 90 80 00       	mov    0x809004,%eax
+  802ff5:	85 c0                	test   %eax,%eax
+  802ff7:	74 27                	je     803020 <pgfault+0x63>
+			pgfault_next(utf);
+  802ff9:	83 ec 0c             	sub    $0xc,%esp
+  802ffc:	53                   	push   %ebx
+  802ffd:	ff d0                	call   *%eax
+			return;
+  802fff:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803002:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803005:	c9                   	leave
+  803006:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803007:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80300d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803012:	b8 00 00 00 00       	mov    $0x0,%eax
+  803017:	e8 16 ff ff ff       	call   802f32 <copy_page_to>
+  80301c:	85 c0                	test   %eax,%eax
+  80301e:	79 e2                	jns    803002 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803020:	a1 00 50 80 00       	mov    0x805000,%eax
+  803025:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803028:	ff 73 28             	push   0x28(%ebx)
+  80302b:	ff 33                	push   (%ebx)
+  80302d:	50                   	push   %eax
+  80302e:	68 4c 3c 80 00       	push   $0x803c4c
+  803033:	e8 dc f5 ff ff       	call   802614 <cprintf>
+	sys_env_destroy(0);
+  803038:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80303f:	e8 aa d0 ff ff       	call   8000ee <sys_env_destroy>
+  803044:	83 c4 10             	add    $0x10,%esp
+  803047:	eb b9                	jmp    803002 <pgfault+0x45>
+
+00803049 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803049:	55                   	push   %ebp
+  80304a:	89 e5                	mov    %esp,%ebp
+  80304c:	53                   	push   %ebx
+  80304d:	83 ec 04             	sub    $0x4,%esp
+  803050:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803053:	a1 08 90 80 00       	mov    0x809008,%eax
+  803058:	3d bd 2f 80 00       	cmp    $0x802fbd,%eax
+  80305d:	74 15                	je     803074 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80305f:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  803064:	83 ec 0c             	sub    $0xc,%esp
+  803067:	68 bd 2f 80 00       	push   $0x802fbd
+  80306c:	e8 fb 03 00 00       	call   80346c <set_pgfault_handler>
+  803071:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803074:	83 ec 0c             	sub    $0xc,%esp
+  803077:	68 05 08 00 00       	push   $0x805
+  80307c:	53                   	push   %ebx
+  80307d:	6a 00                	push   $0x0
+  80307f:	53                   	push   %ebx
+  803080:	6a 00                	push   $0x0
+  803082:	e8 41 d1 ff ff       	call   8001c8 <sys_page_map>
+}
+  803087:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80308a:	c9                   	leave
+  80308b:	c3                   	ret
+
+0080308c <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80308c:	55                   	push   %ebp
+  80308d:	89 e5                	mov    %esp,%ebp
+  80308f:	57                   	push   %edi
+  803090:	56                   	push   %esi
+  803091:	53                   	push   %ebx
+  803092:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  803095:	68 bd 2f 80 00       	push   $0x802fbd
+  80309a:	e8 cd 03 00 00       	call   80346c <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80309f:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030a4:	cd 30                	int    $0x30
+  8030a6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030a9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8030ac:	83 c4 10             	add    $0x10,%esp
+  8030af:	85 c0                	test   %eax,%eax
+  8030b1:	0f 88 6b 01 00 00    	js     803222 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8030bc:	75 37                	jne    8030f5 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8030be:	e8 74 d0 ff ff       	call   800137 <sys_getenvid>
+  8030c3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030c8:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8030ce:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8030d3:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8030d8:	e9 45 01 00 00       	jmp    803222 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8030dd:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030e3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8030e9:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8030ef:	0f 87 ba 00 00 00    	ja     8031af <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8030f5:	89 d8                	mov    %ebx,%eax
+  8030f7:	c1 e8 16             	shr    $0x16,%eax
+  8030fa:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803101:	a8 01                	test   $0x1,%al
+  803103:	74 d8                	je     8030dd <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803105:	89 d8                	mov    %ebx,%eax
+  803107:	c1 e8 0c             	shr    $0xc,%eax
+  80310a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803111:	f6 c2 01             	test   $0x1,%dl
+  803114:	74 cd                	je     8030e3 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803116:	89 da                	mov    %ebx,%edx
+  803118:	80 e6 df             	and    $0xdf,%dh
+  80311b:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803121:	74 c0                	je     8030e3 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803123:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803125:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80312c:	f6 c6 04             	test   $0x4,%dh
+  80312f:	75 53                	jne    803184 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803131:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803138:	f6 c6 08             	test   $0x8,%dh
+  80313b:	75 0c                	jne    803149 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80313d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803144:	f6 c2 02             	test   $0x2,%dl
+  803147:	74 3b                	je     803184 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803149:	83 ec 0c             	sub    $0xc,%esp
+  80314c:	68 05 08 00 00       	push   $0x805
+  803151:	57                   	push   %edi
+  803152:	ff 75 e4             	push   -0x1c(%ebp)
+  803155:	57                   	push   %edi
+  803156:	6a 00                	push   $0x0
+  803158:	e8 6b d0 ff ff       	call   8001c8 <sys_page_map>
+  80315d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80315f:	83 c4 20             	add    $0x20,%esp
+  803162:	85 c0                	test   %eax,%eax
+  803164:	0f 88 a7 00 00 00    	js     803211 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80316a:	83 ec 0c             	sub    $0xc,%esp
+  80316d:	68 05 08 00 00       	push   $0x805
+  803172:	57                   	push   %edi
+  803173:	6a 00                	push   $0x0
+  803175:	57                   	push   %edi
+  803176:	6a 00                	push   $0x0
+  803178:	e8 4b d0 ff ff       	call   8001c8 <sys_page_map>
+  80317d:	89 c6                	mov    %eax,%esi
+	return r;
+  80317f:	83 c4 20             	add    $0x20,%esp
+  803182:	eb 21                	jmp    8031a5 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803184:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80318b:	83 ec 0c             	sub    $0xc,%esp
+  80318e:	25 07 0e 00 00       	and    $0xe07,%eax
+  803193:	50                   	push   %eax
+  803194:	57                   	push   %edi
+  803195:	ff 75 e4             	push   -0x1c(%ebp)
+  803198:	57                   	push   %edi
+  803199:	6a 00                	push   $0x0
+  80319b:	e8 28 d0 ff ff       	call   8001c8 <sys_page_map>
+  8031a0:	89 c6                	mov    %eax,%esi
+  8031a2:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8031a5:	85 f6                	test   %esi,%esi
+  8031a7:	0f 89 36 ff ff ff    	jns    8030e3 <fork+0x57>
+  8031ad:	eb 62                	jmp    803211 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031af:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031b4:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8031b9:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8031bc:	89 f8                	mov    %edi,%eax
+  8031be:	e8 6f fd ff ff       	call   802f32 <copy_page_to>
+  8031c3:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031c5:	85 c0                	test   %eax,%eax
+  8031c7:	78 48                	js     803211 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031c9:	83 ec 04             	sub    $0x4,%esp
+  8031cc:	6a 07                	push   $0x7
+  8031ce:	68 00 f0 bf ee       	push   $0xeebff000
+  8031d3:	57                   	push   %edi
+  8031d4:	e8 a4 cf ff ff       	call   80017d <sys_page_alloc>
+  8031d9:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031db:	83 c4 10             	add    $0x10,%esp
+  8031de:	85 c0                	test   %eax,%eax
+  8031e0:	78 2f                	js     803211 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8031e2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8031e7:	8b 40 64             	mov    0x64(%eax),%eax
+  8031ea:	83 ec 08             	sub    $0x8,%esp
+  8031ed:	50                   	push   %eax
+  8031ee:	57                   	push   %edi
+  8031ef:	e8 f4 d0 ff ff       	call   8002e8 <sys_env_set_pgfault_upcall>
+  8031f4:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031f6:	83 c4 10             	add    $0x10,%esp
+  8031f9:	85 c0                	test   %eax,%eax
+  8031fb:	78 14                	js     803211 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8031fd:	83 ec 08             	sub    $0x8,%esp
+  803200:	6a 02                	push   $0x2
+  803202:	57                   	push   %edi
+  803203:	e8 4c d0 ff ff       	call   800254 <sys_env_set_status>
+  803208:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80320a:	83 c4 10             	add    $0x10,%esp
+  80320d:	85 c0                	test   %eax,%eax
+  80320f:	79 11                	jns    803222 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803211:	83 ec 0c             	sub    $0xc,%esp
+  803214:	ff 75 e0             	push   -0x20(%ebp)
+  803217:	e8 d2 ce ff ff       	call   8000ee <sys_env_destroy>
+	return r;
+  80321c:	83 c4 10             	add    $0x10,%esp
+  80321f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803222:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803225:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803228:	5b                   	pop    %ebx
+  803229:	5e                   	pop    %esi
+  80322a:	5f                   	pop    %edi
+  80322b:	5d                   	pop    %ebp
+  80322c:	c3                   	ret
+
+0080322d <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80322d:	55                   	push   %ebp
+  80322e:	89 e5                	mov    %esp,%ebp
+  803230:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803233:	68 ab 3c 80 00       	push   $0x803cab
+  803238:	68 bf 00 00 00       	push   $0xbf
+  80323d:	68 a0 3c 80 00       	push   $0x803ca0
+  803242:	e8 f2 f2 ff ff       	call   802539 <_panic>
+
+00803247 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803247:	55                   	push   %ebp
+  803248:	89 e5                	mov    %esp,%ebp
+  80324a:	56                   	push   %esi
+  80324b:	53                   	push   %ebx
+  80324c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80324f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803252:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803255:	85 c0                	test   %eax,%eax
+  803257:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80325c:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80325f:	83 ec 0c             	sub    $0xc,%esp
+  803262:	50                   	push   %eax
+  803263:	e8 5d d1 ff ff       	call   8003c5 <sys_ipc_recv>
+	if (from_env_store)
+  803268:	83 c4 10             	add    $0x10,%esp
+  80326b:	85 f6                	test   %esi,%esi
+  80326d:	74 14                	je     803283 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80326f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803274:	85 c0                	test   %eax,%eax
+  803276:	75 09                	jne    803281 <ipc_recv+0x3a>
+  803278:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80327e:	8b 52 74             	mov    0x74(%edx),%edx
+  803281:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803283:	85 db                	test   %ebx,%ebx
+  803285:	74 25                	je     8032ac <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803287:	85 c0                	test   %eax,%eax
+  803289:	74 0d                	je     803298 <ipc_recv+0x51>
+  80328b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803291:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803294:	5b                   	pop    %ebx
+  803295:	5e                   	pop    %esi
+  803296:	5d                   	pop    %ebp
+  803297:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803298:	a1 00 50 80 00       	mov    0x805000,%eax
+  80329d:	8b 40 78             	mov    0x78(%eax),%eax
+  8032a0:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8032a2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032a7:	8b 40 70             	mov    0x70(%eax),%eax
+  8032aa:	eb e5                	jmp    803291 <ipc_recv+0x4a>
+  8032ac:	85 c0                	test   %eax,%eax
+  8032ae:	75 e1                	jne    803291 <ipc_recv+0x4a>
+  8032b0:	eb f0                	jmp    8032a2 <ipc_recv+0x5b>
+
+008032b2 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8032b2:	55                   	push   %ebp
+  8032b3:	89 e5                	mov    %esp,%ebp
+  8032b5:	57                   	push   %edi
+  8032b6:	56                   	push   %esi
+  8032b7:	53                   	push   %ebx
+  8032b8:	83 ec 0c             	sub    $0xc,%esp
+  8032bb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032be:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032c4:	85 db                	test   %ebx,%ebx
+  8032c6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032cb:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8032ce:	ff 75 14             	push   0x14(%ebp)
+  8032d1:	53                   	push   %ebx
+  8032d2:	56                   	push   %esi
+  8032d3:	57                   	push   %edi
+  8032d4:	e8 59 d0 ff ff       	call   800332 <sys_ipc_try_send>
+  8032d9:	83 c4 10             	add    $0x10,%esp
+  8032dc:	85 c0                	test   %eax,%eax
+  8032de:	74 22                	je     803302 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8032e0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032e3:	75 07                	jne    8032ec <ipc_send+0x3a>
+		sys_yield();
+  8032e5:	e8 74 ce ff ff       	call   80015e <sys_yield>
+  8032ea:	eb e2                	jmp    8032ce <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8032ec:	68 c1 3c 80 00       	push   $0x803cc1
+  8032f1:	68 24 38 80 00       	push   $0x803824
+  8032f6:	6a 39                	push   $0x39
+  8032f8:	68 d6 3c 80 00       	push   $0x803cd6
+  8032fd:	e8 37 f2 ff ff       	call   802539 <_panic>
+	}
+}
+  803302:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803305:	5b                   	pop    %ebx
+  803306:	5e                   	pop    %esi
+  803307:	5f                   	pop    %edi
+  803308:	5d                   	pop    %ebp
+  803309:	c3                   	ret
+
+0080330a <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80330a:	55                   	push   %ebp
+  80330b:	89 e5                	mov    %esp,%ebp
+  80330d:	57                   	push   %edi
+  80330e:	56                   	push   %esi
+  80330f:	53                   	push   %ebx
+  803310:	83 ec 10             	sub    $0x10,%esp
+  803313:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803316:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803319:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80331c:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80331f:	85 c0                	test   %eax,%eax
+  803321:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803326:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803329:	6a 00                	push   $0x0
+  80332b:	ff 33                	push   (%ebx)
+  80332d:	50                   	push   %eax
+  80332e:	e8 4f d0 ff ff       	call   800382 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803333:	83 c4 10             	add    $0x10,%esp
+  803336:	85 c0                	test   %eax,%eax
+  803338:	75 3c                	jne    803376 <ipc_recvv+0x6c>
+  80333a:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803340:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803343:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803345:	85 ff                	test   %edi,%edi
+  803347:	74 4e                	je     803397 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803349:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80334f:	8b 52 74             	mov    0x74(%edx),%edx
+  803352:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803354:	85 f6                	test   %esi,%esi
+  803356:	74 18                	je     803370 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803358:	85 c0                	test   %eax,%eax
+  80335a:	75 2d                	jne    803389 <ipc_recvv+0x7f>
+  80335c:	a1 00 50 80 00       	mov    0x805000,%eax
+  803361:	8b 40 78             	mov    0x78(%eax),%eax
+  803364:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803366:	a1 00 50 80 00       	mov    0x805000,%eax
+  80336b:	8b 40 70             	mov    0x70(%eax),%eax
+  80336e:	eb 1f                	jmp    80338f <ipc_recvv+0x85>
+  803370:	85 c0                	test   %eax,%eax
+  803372:	75 1b                	jne    80338f <ipc_recvv+0x85>
+  803374:	eb f0                	jmp    803366 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803376:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80337c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803381:	85 ff                	test   %edi,%edi
+  803383:	75 cd                	jne    803352 <ipc_recvv+0x48>
+	if (perm_store)
+  803385:	85 f6                	test   %esi,%esi
+  803387:	74 e7                	je     803370 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803389:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80338f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803392:	5b                   	pop    %ebx
+  803393:	5e                   	pop    %esi
+  803394:	5f                   	pop    %edi
+  803395:	5d                   	pop    %ebp
+  803396:	c3                   	ret
+	if (perm_store)
+  803397:	85 f6                	test   %esi,%esi
+  803399:	75 bd                	jne    803358 <ipc_recvv+0x4e>
+  80339b:	eb c9                	jmp    803366 <ipc_recvv+0x5c>
+
+0080339d <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  80339d:	55                   	push   %ebp
+  80339e:	89 e5                	mov    %esp,%ebp
+  8033a0:	57                   	push   %edi
+  8033a1:	56                   	push   %esi
+  8033a2:	53                   	push   %ebx
+  8033a3:	83 ec 0c             	sub    $0xc,%esp
+  8033a6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8033af:	ff 75 14             	push   0x14(%ebp)
+  8033b2:	53                   	push   %ebx
+  8033b3:	56                   	push   %esi
+  8033b4:	57                   	push   %edi
+  8033b5:	e8 a0 cf ff ff       	call   80035a <sys_ipc_try_sendv>
+  8033ba:	83 c4 10             	add    $0x10,%esp
+  8033bd:	85 c0                	test   %eax,%eax
+  8033bf:	74 22                	je     8033e3 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8033c1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033c4:	75 07                	jne    8033cd <ipc_sendv+0x30>
+		sys_yield();
+  8033c6:	e8 93 cd ff ff       	call   80015e <sys_yield>
+  8033cb:	eb e2                	jmp    8033af <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8033cd:	68 c1 3c 80 00       	push   $0x803cc1
+  8033d2:	68 24 38 80 00       	push   $0x803824
+  8033d7:	6a 5c                	push   $0x5c
+  8033d9:	68 d6 3c 80 00       	push   $0x803cd6
+  8033de:	e8 56 f1 ff ff       	call   802539 <_panic>
+	}
+}
+  8033e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033e6:	5b                   	pop    %ebx
+  8033e7:	5e                   	pop    %esi
+  8033e8:	5f                   	pop    %edi
+  8033e9:	5d                   	pop    %ebp
+  8033ea:	c3                   	ret
+
+008033eb <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8033eb:	55                   	push   %ebp
+  8033ec:	89 e5                	mov    %esp,%ebp
+  8033ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8033f1:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8033f6:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8033fc:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803402:	8b 52 50             	mov    0x50(%edx),%edx
+  803405:	39 ca                	cmp    %ecx,%edx
+  803407:	74 11                	je     80341a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803409:	83 c0 01             	add    $0x1,%eax
+  80340c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803411:	75 e3                	jne    8033f6 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803413:	b8 00 00 00 00       	mov    $0x0,%eax
+  803418:	eb 0e                	jmp    803428 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80341a:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803420:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803425:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803428:	5d                   	pop    %ebp
+  803429:	c3                   	ret
+
+0080342a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80342a:	55                   	push   %ebp
+  80342b:	89 e5                	mov    %esp,%ebp
+  80342d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803430:	89 c2                	mov    %eax,%edx
+  803432:	c1 ea 16             	shr    $0x16,%edx
+  803435:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80343c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803441:	f6 c1 01             	test   $0x1,%cl
+  803444:	74 22                	je     803468 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803446:	c1 e8 0c             	shr    $0xc,%eax
+  803449:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803450:	a8 01                	test   $0x1,%al
+  803452:	74 14                	je     803468 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803454:	c1 e8 0c             	shr    $0xc,%eax
+  803457:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80345a:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803461:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803465:	0f b7 d2             	movzwl %dx,%edx
+}
+  803468:	89 d0                	mov    %edx,%eax
+  80346a:	5d                   	pop    %ebp
+  80346b:	c3                   	ret
+
+0080346c <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80346c:	55                   	push   %ebp
+  80346d:	89 e5                	mov    %esp,%ebp
+  80346f:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803472:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  803479:	74 0a                	je     803485 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80347b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80347e:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  803483:	c9                   	leave
+  803484:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803485:	83 ec 04             	sub    $0x4,%esp
+  803488:	6a 07                	push   $0x7
+  80348a:	68 00 f0 bf ee       	push   $0xeebff000
+  80348f:	6a 00                	push   $0x0
+  803491:	e8 e7 cc ff ff       	call   80017d <sys_page_alloc>
+  803496:	83 c4 10             	add    $0x10,%esp
+  803499:	85 c0                	test   %eax,%eax
+  80349b:	75 2c                	jne    8034c9 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80349d:	83 ec 08             	sub    $0x8,%esp
+  8034a0:	68 df 34 80 00       	push   $0x8034df
+  8034a5:	6a 00                	push   $0x0
+  8034a7:	e8 3c ce ff ff       	call   8002e8 <sys_env_set_pgfault_upcall>
+  8034ac:	83 c4 10             	add    $0x10,%esp
+  8034af:	85 c0                	test   %eax,%eax
+  8034b1:	74 c8                	je     80347b <set_pgfault_handler+0xf>
+  8034b3:	68 28 3d 80 00       	push   $0x803d28
+  8034b8:	68 24 38 80 00       	push   $0x803824
+  8034bd:	6a 20                	push   $0x20
+  8034bf:	68 58 3d 80 00       	push   $0x803d58
+  8034c4:	e8 70 f0 ff ff       	call   802539 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034c9:	68 e0 3c 80 00       	push   $0x803ce0
+  8034ce:	68 24 38 80 00       	push   $0x803824
+  8034d3:	6a 1e                	push   $0x1e
+  8034d5:	68 58 3d 80 00       	push   $0x803d58
+  8034da:	e8 5a f0 ff ff       	call   802539 <_panic>
+
+008034df <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8034df:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8034e0:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  8034e5:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8034e7:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8034ea:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8034ef:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8034f4:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8034f8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8034fb:	83 c4 08             	add    $0x8,%esp
+	popal
+  8034fe:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8034ff:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803502:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803503:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803504:	c3                   	ret
+
+00803505 <dm>:
+  803505:	55                   	push   %ebp
+  803506:	57                   	push   %edi
+  803507:	56                   	push   %esi
+  803508:	53                   	push   %ebx
+  803509:	83 ec 24             	sub    $0x24,%esp
+  80350c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803510:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803514:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803518:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80351c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803520:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803524:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803528:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80352d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803532:	ba 00 00 00 00       	mov    $0x0,%edx
+  803537:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80353e:	00 
+  80353f:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803546:	00 
+  803547:	89 fb                	mov    %edi,%ebx
+  803549:	eb 08                	jmp    803553 <dm+0x4e>
+  80354b:	83 e9 01             	sub    $0x1,%ecx
+  80354e:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803551:	74 68                	je     8035bb <dm+0xb6>
+  803553:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803557:	01 c0                	add    %eax,%eax
+  803559:	89 c6                	mov    %eax,%esi
+  80355b:	89 d7                	mov    %edx,%edi
+  80355d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803561:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803565:	0f ad d0             	shrd   %cl,%edx,%eax
+  803568:	d3 ea                	shr    %cl,%edx
+  80356a:	f6 c1 20             	test   $0x20,%cl
+  80356d:	74 04                	je     803573 <dm+0x6e>
+  80356f:	89 d0                	mov    %edx,%eax
+  803571:	31 d2                	xor    %edx,%edx
+  803573:	83 e0 01             	and    $0x1,%eax
+  803576:	89 04 24             	mov    %eax,(%esp)
+  803579:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803580:	00 
+  803581:	8b 04 24             	mov    (%esp),%eax
+  803584:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803588:	09 f0                	or     %esi,%eax
+  80358a:	09 fa                	or     %edi,%edx
+  80358c:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803590:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803594:	39 f0                	cmp    %esi,%eax
+  803596:	89 d5                	mov    %edx,%ebp
+  803598:	19 fd                	sbb    %edi,%ebp
+  80359a:	72 af                	jb     80354b <dm+0x46>
+  80359c:	29 f0                	sub    %esi,%eax
+  80359e:	19 fa                	sbb    %edi,%edx
+  8035a0:	89 cf                	mov    %ecx,%edi
+  8035a2:	c1 ef 05             	shr    $0x5,%edi
+  8035a5:	83 e7 01             	and    $0x1,%edi
+  8035a8:	89 fe                	mov    %edi,%esi
+  8035aa:	83 f6 01             	xor    $0x1,%esi
+  8035ad:	d3 e6                	shl    %cl,%esi
+  8035af:	d3 e7                	shl    %cl,%edi
+  8035b1:	09 74 24 18          	or     %esi,0x18(%esp)
+  8035b5:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8035b9:	eb 90                	jmp    80354b <dm+0x46>
+  8035bb:	85 db                	test   %ebx,%ebx
+  8035bd:	74 05                	je     8035c4 <dm+0xbf>
+  8035bf:	89 03                	mov    %eax,(%ebx)
+  8035c1:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035c4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035c8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035cc:	83 c4 24             	add    $0x24,%esp
+  8035cf:	5b                   	pop    %ebx
+  8035d0:	5e                   	pop    %esi
+  8035d1:	5f                   	pop    %edi
+  8035d2:	5d                   	pop    %ebp
+  8035d3:	c3                   	ret
+
+008035d4 <__udivdi3>:
+  8035d4:	83 ec 08             	sub    $0x8,%esp
+  8035d7:	6a 00                	push   $0x0
+  8035d9:	ff 74 24 1c          	push   0x1c(%esp)
+  8035dd:	ff 74 24 1c          	push   0x1c(%esp)
+  8035e1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035e5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035e9:	e8 17 ff ff ff       	call   803505 <dm>
+  8035ee:	83 c4 14             	add    $0x14,%esp
+  8035f1:	c3                   	ret
+
+008035f2 <__umoddi3>:
+  8035f2:	83 ec 18             	sub    $0x18,%esp
+  8035f5:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8035f9:	50                   	push   %eax
+  8035fa:	ff 74 24 2c          	push   0x2c(%esp)
+  8035fe:	ff 74 24 2c          	push   0x2c(%esp)
+  803602:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803606:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80360a:	e8 f6 fe ff ff       	call   803505 <dm>
+  80360f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803613:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803617:	83 c4 24             	add    $0x24,%esp
+  80361a:	c3                   	ret
+
+0080361b <__divdi3>:
+  80361b:	53                   	push   %ebx
+  80361c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803620:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803624:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803628:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80362c:	85 d2                	test   %edx,%edx
+  80362e:	78 15                	js     803645 <__divdi3+0x2a>
+  803630:	85 db                	test   %ebx,%ebx
+  803632:	78 34                	js     803668 <__divdi3+0x4d>
+  803634:	83 ec 04             	sub    $0x4,%esp
+  803637:	6a 00                	push   $0x0
+  803639:	53                   	push   %ebx
+  80363a:	51                   	push   %ecx
+  80363b:	e8 c5 fe ff ff       	call   803505 <dm>
+  803640:	83 c4 10             	add    $0x10,%esp
+  803643:	eb 21                	jmp    803666 <__divdi3+0x4b>
+  803645:	f7 d8                	neg    %eax
+  803647:	83 d2 00             	adc    $0x0,%edx
+  80364a:	f7 da                	neg    %edx
+  80364c:	85 db                	test   %ebx,%ebx
+  80364e:	78 30                	js     803680 <__divdi3+0x65>
+  803650:	83 ec 04             	sub    $0x4,%esp
+  803653:	6a 00                	push   $0x0
+  803655:	53                   	push   %ebx
+  803656:	51                   	push   %ecx
+  803657:	e8 a9 fe ff ff       	call   803505 <dm>
+  80365c:	83 c4 10             	add    $0x10,%esp
+  80365f:	f7 d8                	neg    %eax
+  803661:	83 d2 00             	adc    $0x0,%edx
+  803664:	f7 da                	neg    %edx
+  803666:	5b                   	pop    %ebx
+  803667:	c3                   	ret
+  803668:	83 ec 04             	sub    $0x4,%esp
+  80366b:	6a 00                	push   $0x0
+  80366d:	f7 d9                	neg    %ecx
+  80366f:	83 d3 00             	adc    $0x0,%ebx
+  803672:	f7 db                	neg    %ebx
+  803674:	53                   	push   %ebx
+  803675:	51                   	push   %ecx
+  803676:	e8 8a fe ff ff       	call   803505 <dm>
+  80367b:	83 c4 10             	add    $0x10,%esp
+  80367e:	eb df                	jmp    80365f <__divdi3+0x44>
+  803680:	83 ec 04             	sub    $0x4,%esp
+  803683:	6a 00                	push   $0x0
+  803685:	f7 d9                	neg    %ecx
+  803687:	83 d3 00             	adc    $0x0,%ebx
+  80368a:	f7 db                	neg    %ebx
+  80368c:	53                   	push   %ebx
+  80368d:	51                   	push   %ecx
+  80368e:	e8 72 fe ff ff       	call   803505 <dm>
+  803693:	83 c4 10             	add    $0x10,%esp
+  803696:	eb ce                	jmp    803666 <__divdi3+0x4b>
+
+00803698 <__moddi3>:
+  803698:	55                   	push   %ebp
+  803699:	57                   	push   %edi
+  80369a:	56                   	push   %esi
+  80369b:	53                   	push   %ebx
+  80369c:	83 ec 24             	sub    $0x24,%esp
+  80369f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036a3:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036a7:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036ab:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036af:	85 d2                	test   %edx,%edx
+  8036b1:	78 3b                	js     8036ee <__moddi3+0x56>
+  8036b3:	83 ec 04             	sub    $0x4,%esp
+  8036b6:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036ba:	56                   	push   %esi
+  8036bb:	89 ce                	mov    %ecx,%esi
+  8036bd:	f7 de                	neg    %esi
+  8036bf:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8036c3:	89 de                	mov    %ebx,%esi
+  8036c5:	83 d6 00             	adc    $0x0,%esi
+  8036c8:	f7 de                	neg    %esi
+  8036ca:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8036ce:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8036d2:	0f 48 f1             	cmovs  %ecx,%esi
+  8036d5:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8036da:	53                   	push   %ebx
+  8036db:	56                   	push   %esi
+  8036dc:	e8 24 fe ff ff       	call   803505 <dm>
+  8036e1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036e5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036e9:	83 c4 10             	add    $0x10,%esp
+  8036ec:	eb 47                	jmp    803735 <__moddi3+0x9d>
+  8036ee:	f7 d8                	neg    %eax
+  8036f0:	83 d2 00             	adc    $0x0,%edx
+  8036f3:	f7 da                	neg    %edx
+  8036f5:	83 ec 04             	sub    $0x4,%esp
+  8036f8:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036fc:	56                   	push   %esi
+  8036fd:	89 cf                	mov    %ecx,%edi
+  8036ff:	f7 df                	neg    %edi
+  803701:	89 de                	mov    %ebx,%esi
+  803703:	83 d6 00             	adc    $0x0,%esi
+  803706:	f7 de                	neg    %esi
+  803708:	0f 49 cf             	cmovns %edi,%ecx
+  80370b:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80370f:	0f 49 de             	cmovns %esi,%ebx
+  803712:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803716:	ff 74 24 0c          	push   0xc(%esp)
+  80371a:	ff 74 24 0c          	push   0xc(%esp)
+  80371e:	e8 e2 fd ff ff       	call   803505 <dm>
+  803723:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803727:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80372b:	f7 d8                	neg    %eax
+  80372d:	83 d2 00             	adc    $0x0,%edx
+  803730:	f7 da                	neg    %edx
+  803732:	83 c4 10             	add    $0x10,%esp
+  803735:	83 c4 24             	add    $0x24,%esp
+  803738:	5b                   	pop    %ebx
+  803739:	5e                   	pop    %esi
+  80373a:	5f                   	pop    %edi
+  80373b:	5d                   	pop    %ebp
+  80373c:	c3                   	ret
@@ -0,0 +1,7708 @@
+
+obj/user/forktree.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b2 00 00 00       	call   8000e3 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <forktree>:
+	}
+}
+
+void
+forktree(const char *cur)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80003d:	e8 4d 0b 00 00       	call   800b8f <sys_getenvid>
+  800042:	83 ec 04             	sub    $0x4,%esp
+  800045:	53                   	push   %ebx
+  800046:	50                   	push   %eax
+  800047:	68 00 38 80 00       	push   $0x803800
+  80004c:	e8 8a 01 00 00       	call   8001db <cprintf>
+
+	forkchild(cur, '0');
+  800051:	83 c4 08             	add    $0x8,%esp
+  800054:	6a 30                	push   $0x30
+  800056:	53                   	push   %ebx
+  800057:	e8 13 00 00 00       	call   80006f <forkchild>
+	forkchild(cur, '1');
+  80005c:	83 c4 08             	add    $0x8,%esp
+  80005f:	6a 31                	push   $0x31
+  800061:	53                   	push   %ebx
+  800062:	e8 08 00 00 00       	call   80006f <forkchild>
+}
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80006d:	c9                   	leave
+  80006e:	c3                   	ret
+
+0080006f <forkchild>:
+{
+  80006f:	55                   	push   %ebp
+  800070:	89 e5                	mov    %esp,%ebp
+  800072:	56                   	push   %esi
+  800073:	53                   	push   %ebx
+  800074:	83 ec 1c             	sub    $0x1c,%esp
+  800077:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80007a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (strlen(cur) >= DEPTH)
+  80007d:	53                   	push   %ebx
+  80007e:	e8 0b 07 00 00       	call   80078e <strlen>
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	83 f8 02             	cmp    $0x2,%eax
+  800089:	7e 07                	jle    800092 <forkchild+0x23>
+}
+  80008b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008e:	5b                   	pop    %ebx
+  80008f:	5e                   	pop    %esi
+  800090:	5d                   	pop    %ebp
+  800091:	c3                   	ret
+	snprintf(nxt, DEPTH+1, "%s%c", cur, branch);
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	89 f0                	mov    %esi,%eax
+  800097:	0f be f0             	movsbl %al,%esi
+  80009a:	56                   	push   %esi
+  80009b:	53                   	push   %ebx
+  80009c:	68 11 38 80 00       	push   $0x803811
+  8000a1:	6a 04                	push   $0x4
+  8000a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a6:	50                   	push   %eax
+  8000a7:	e8 c8 06 00 00       	call   800774 <snprintf>
+	if (fork() == 0) {
+  8000ac:	83 c4 20             	add    $0x20,%esp
+  8000af:	e8 7c 10 00 00       	call   801130 <fork>
+  8000b4:	85 c0                	test   %eax,%eax
+  8000b6:	75 d3                	jne    80008b <forkchild+0x1c>
+		forktree(nxt);
+  8000b8:	83 ec 0c             	sub    $0xc,%esp
+  8000bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000be:	50                   	push   %eax
+  8000bf:	e8 6f ff ff ff       	call   800033 <forktree>
+		exit();
+  8000c4:	e8 63 00 00 00       	call   80012c <exit>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+  8000cc:	eb bd                	jmp    80008b <forkchild+0x1c>
+
+008000ce <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000ce:	55                   	push   %ebp
+  8000cf:	89 e5                	mov    %esp,%ebp
+  8000d1:	83 ec 14             	sub    $0x14,%esp
+	forktree("");
+  8000d4:	68 10 38 80 00       	push   $0x803810
+  8000d9:	e8 55 ff ff ff       	call   800033 <forktree>
+}
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+
+008000e3 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	56                   	push   %esi
+  8000e7:	53                   	push   %ebx
+  8000e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000ee:	e8 9c 0a 00 00       	call   800b8f <sys_getenvid>
+  8000f3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f8:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8000fe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800103:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800108:	85 db                	test   %ebx,%ebx
+  80010a:	7e 07                	jle    800113 <libmain+0x30>
+		binaryname = argv[0];
+  80010c:	8b 06                	mov    (%esi),%eax
+  80010e:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800113:	83 ec 08             	sub    $0x8,%esp
+  800116:	56                   	push   %esi
+  800117:	53                   	push   %ebx
+  800118:	e8 b1 ff ff ff       	call   8000ce <umain>
+
+	// exit gracefully
+	exit();
+  80011d:	e8 0a 00 00 00       	call   80012c <exit>
+}
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800128:	5b                   	pop    %ebx
+  800129:	5e                   	pop    %esi
+  80012a:	5d                   	pop    %ebp
+  80012b:	c3                   	ret
+
+0080012c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80012c:	55                   	push   %ebp
+  80012d:	89 e5                	mov    %esp,%ebp
+  80012f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800132:	e8 88 13 00 00       	call   8014bf <close_all>
+	sys_env_destroy(0);
+  800137:	83 ec 0c             	sub    $0xc,%esp
+  80013a:	6a 00                	push   $0x0
+  80013c:	e8 05 0a 00 00       	call   800b46 <sys_env_destroy>
+}
+  800141:	83 c4 10             	add    $0x10,%esp
+  800144:	c9                   	leave
+  800145:	c3                   	ret
+
+00800146 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800146:	55                   	push   %ebp
+  800147:	89 e5                	mov    %esp,%ebp
+  800149:	53                   	push   %ebx
+  80014a:	83 ec 04             	sub    $0x4,%esp
+  80014d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800150:	8b 13                	mov    (%ebx),%edx
+  800152:	8d 42 01             	lea    0x1(%edx),%eax
+  800155:	89 03                	mov    %eax,(%ebx)
+  800157:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80015a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80015e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800163:	74 09                	je     80016e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800165:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800169:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80016c:	c9                   	leave
+  80016d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80016e:	83 ec 08             	sub    $0x8,%esp
+  800171:	68 ff 00 00 00       	push   $0xff
+  800176:	8d 43 08             	lea    0x8(%ebx),%eax
+  800179:	50                   	push   %eax
+  80017a:	e8 7a 09 00 00       	call   800af9 <sys_cputs>
+		b->idx = 0;
+  80017f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800185:	83 c4 10             	add    $0x10,%esp
+  800188:	eb db                	jmp    800165 <putch+0x1f>
+
+0080018a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80018a:	55                   	push   %ebp
+  80018b:	89 e5                	mov    %esp,%ebp
+  80018d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800193:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80019a:	00 00 00 
+	b.cnt = 0;
+  80019d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001a4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001a7:	ff 75 0c             	push   0xc(%ebp)
+  8001aa:	ff 75 08             	push   0x8(%ebp)
+  8001ad:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001b3:	50                   	push   %eax
+  8001b4:	68 46 01 80 00       	push   $0x800146
+  8001b9:	e8 14 01 00 00       	call   8002d2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001be:	83 c4 08             	add    $0x8,%esp
+  8001c1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001c7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001cd:	50                   	push   %eax
+  8001ce:	e8 26 09 00 00       	call   800af9 <sys_cputs>
+
+	return b.cnt;
+}
+  8001d3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001d9:	c9                   	leave
+  8001da:	c3                   	ret
+
+008001db <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001db:	55                   	push   %ebp
+  8001dc:	89 e5                	mov    %esp,%ebp
+  8001de:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001e1:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001e4:	50                   	push   %eax
+  8001e5:	ff 75 08             	push   0x8(%ebp)
+  8001e8:	e8 9d ff ff ff       	call   80018a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001ed:	c9                   	leave
+  8001ee:	c3                   	ret
+
+008001ef <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001ef:	55                   	push   %ebp
+  8001f0:	89 e5                	mov    %esp,%ebp
+  8001f2:	57                   	push   %edi
+  8001f3:	56                   	push   %esi
+  8001f4:	53                   	push   %ebx
+  8001f5:	83 ec 1c             	sub    $0x1c,%esp
+  8001f8:	89 c7                	mov    %eax,%edi
+  8001fa:	89 d6                	mov    %edx,%esi
+  8001fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800202:	89 d1                	mov    %edx,%ecx
+  800204:	89 c2                	mov    %eax,%edx
+  800206:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800209:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80020c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80020f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800212:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800215:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80021c:	39 c2                	cmp    %eax,%edx
+  80021e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800221:	72 3e                	jb     800261 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800223:	83 ec 0c             	sub    $0xc,%esp
+  800226:	ff 75 18             	push   0x18(%ebp)
+  800229:	83 eb 01             	sub    $0x1,%ebx
+  80022c:	53                   	push   %ebx
+  80022d:	50                   	push   %eax
+  80022e:	83 ec 08             	sub    $0x8,%esp
+  800231:	ff 75 e4             	push   -0x1c(%ebp)
+  800234:	ff 75 e0             	push   -0x20(%ebp)
+  800237:	ff 75 dc             	push   -0x24(%ebp)
+  80023a:	ff 75 d8             	push   -0x28(%ebp)
+  80023d:	e8 37 34 00 00       	call   803679 <__udivdi3>
+  800242:	83 c4 18             	add    $0x18,%esp
+  800245:	52                   	push   %edx
+  800246:	50                   	push   %eax
+  800247:	89 f2                	mov    %esi,%edx
+  800249:	89 f8                	mov    %edi,%eax
+  80024b:	e8 9f ff ff ff       	call   8001ef <printnum>
+  800250:	83 c4 20             	add    $0x20,%esp
+  800253:	eb 13                	jmp    800268 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800255:	83 ec 08             	sub    $0x8,%esp
+  800258:	56                   	push   %esi
+  800259:	ff 75 18             	push   0x18(%ebp)
+  80025c:	ff d7                	call   *%edi
+  80025e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800261:	83 eb 01             	sub    $0x1,%ebx
+  800264:	85 db                	test   %ebx,%ebx
+  800266:	7f ed                	jg     800255 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800268:	83 ec 08             	sub    $0x8,%esp
+  80026b:	56                   	push   %esi
+  80026c:	83 ec 04             	sub    $0x4,%esp
+  80026f:	ff 75 e4             	push   -0x1c(%ebp)
+  800272:	ff 75 e0             	push   -0x20(%ebp)
+  800275:	ff 75 dc             	push   -0x24(%ebp)
+  800278:	ff 75 d8             	push   -0x28(%ebp)
+  80027b:	e8 17 34 00 00       	call   803697 <__umoddi3>
+  800280:	83 c4 14             	add    $0x14,%esp
+  800283:	0f be 80 20 38 80 00 	movsbl 0x803820(%eax),%eax
+  80028a:	50                   	push   %eax
+  80028b:	ff d7                	call   *%edi
+}
+  80028d:	83 c4 10             	add    $0x10,%esp
+  800290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800293:	5b                   	pop    %ebx
+  800294:	5e                   	pop    %esi
+  800295:	5f                   	pop    %edi
+  800296:	5d                   	pop    %ebp
+  800297:	c3                   	ret
+
+00800298 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800298:	55                   	push   %ebp
+  800299:	89 e5                	mov    %esp,%ebp
+  80029b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80029e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002a2:	8b 10                	mov    (%eax),%edx
+  8002a4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002a7:	73 0a                	jae    8002b3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002a9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002ac:	89 08                	mov    %ecx,(%eax)
+  8002ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002b1:	88 02                	mov    %al,(%edx)
+}
+  8002b3:	5d                   	pop    %ebp
+  8002b4:	c3                   	ret
+
+008002b5 <printfmt>:
+{
+  8002b5:	55                   	push   %ebp
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002bb:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002be:	50                   	push   %eax
+  8002bf:	ff 75 10             	push   0x10(%ebp)
+  8002c2:	ff 75 0c             	push   0xc(%ebp)
+  8002c5:	ff 75 08             	push   0x8(%ebp)
+  8002c8:	e8 05 00 00 00       	call   8002d2 <vprintfmt>
+}
+  8002cd:	83 c4 10             	add    $0x10,%esp
+  8002d0:	c9                   	leave
+  8002d1:	c3                   	ret
+
+008002d2 <vprintfmt>:
+{
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	57                   	push   %edi
+  8002d6:	56                   	push   %esi
+  8002d7:	53                   	push   %ebx
+  8002d8:	83 ec 2c             	sub    $0x2c,%esp
+  8002db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002e1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002e4:	eb 0a                	jmp    8002f0 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002e6:	83 ec 08             	sub    $0x8,%esp
+  8002e9:	53                   	push   %ebx
+  8002ea:	50                   	push   %eax
+  8002eb:	ff d6                	call   *%esi
+  8002ed:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002f0:	83 c7 01             	add    $0x1,%edi
+  8002f3:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002f7:	83 f8 25             	cmp    $0x25,%eax
+  8002fa:	74 0c                	je     800308 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002fc:	85 c0                	test   %eax,%eax
+  8002fe:	75 e6                	jne    8002e6 <vprintfmt+0x14>
+}
+  800300:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800303:	5b                   	pop    %ebx
+  800304:	5e                   	pop    %esi
+  800305:	5f                   	pop    %edi
+  800306:	5d                   	pop    %ebp
+  800307:	c3                   	ret
+		padc = ' ';
+  800308:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80030c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800313:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80031a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800321:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800326:	8d 47 01             	lea    0x1(%edi),%eax
+  800329:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80032c:	0f b6 17             	movzbl (%edi),%edx
+  80032f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800332:	3c 55                	cmp    $0x55,%al
+  800334:	0f 87 cf 03 00 00    	ja     800709 <vprintfmt+0x437>
+  80033a:	0f b6 c0             	movzbl %al,%eax
+  80033d:	ff 24 85 80 39 80 00 	jmp    *0x803980(,%eax,4)
+  800344:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800347:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80034b:	eb d9                	jmp    800326 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80034d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800350:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800354:	eb d0                	jmp    800326 <vprintfmt+0x54>
+  800356:	0f b6 d2             	movzbl %dl,%edx
+  800359:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80035c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800361:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800364:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800367:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80036b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80036e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800371:	83 f9 09             	cmp    $0x9,%ecx
+  800374:	77 55                	ja     8003cb <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800376:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800379:	eb e9                	jmp    800364 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80037b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037e:	8b 00                	mov    (%eax),%eax
+  800380:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800383:	8b 45 14             	mov    0x14(%ebp),%eax
+  800386:	8d 40 04             	lea    0x4(%eax),%eax
+  800389:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80038c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80038f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800393:	79 91                	jns    800326 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800395:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800398:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80039b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003a2:	eb 82                	jmp    800326 <vprintfmt+0x54>
+			if (width < 0)
+  8003a4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003a7:	85 d2                	test   %edx,%edx
+  8003a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ae:	0f 49 c2             	cmovns %edx,%eax
+  8003b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003b7:	e9 6a ff ff ff       	jmp    800326 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003bf:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003c6:	e9 5b ff ff ff       	jmp    800326 <vprintfmt+0x54>
+  8003cb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ce:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003d1:	eb bc                	jmp    80038f <vprintfmt+0xbd>
+			lflag++;
+  8003d3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003d9:	e9 48 ff ff ff       	jmp    800326 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e1:	8d 78 04             	lea    0x4(%eax),%edi
+  8003e4:	83 ec 08             	sub    $0x8,%esp
+  8003e7:	53                   	push   %ebx
+  8003e8:	ff 30                	push   (%eax)
+  8003ea:	ff d6                	call   *%esi
+			break;
+  8003ec:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003ef:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003f2:	e9 b1 02 00 00       	jmp    8006a8 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fa:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003fd:	8b 10                	mov    (%eax),%edx
+  8003ff:	89 d0                	mov    %edx,%eax
+  800401:	f7 d8                	neg    %eax
+  800403:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800406:	83 f8 11             	cmp    $0x11,%eax
+  800409:	7f 23                	jg     80042e <vprintfmt+0x15c>
+  80040b:	8b 14 85 e0 3a 80 00 	mov    0x803ae0(,%eax,4),%edx
+  800412:	85 d2                	test   %edx,%edx
+  800414:	74 18                	je     80042e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800416:	52                   	push   %edx
+  800417:	68 fe 3b 80 00       	push   $0x803bfe
+  80041c:	53                   	push   %ebx
+  80041d:	56                   	push   %esi
+  80041e:	e8 92 fe ff ff       	call   8002b5 <printfmt>
+  800423:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800426:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800429:	e9 7a 02 00 00       	jmp    8006a8 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80042e:	50                   	push   %eax
+  80042f:	68 38 38 80 00       	push   $0x803838
+  800434:	53                   	push   %ebx
+  800435:	56                   	push   %esi
+  800436:	e8 7a fe ff ff       	call   8002b5 <printfmt>
+  80043b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80043e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800441:	e9 62 02 00 00       	jmp    8006a8 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800446:	8b 45 14             	mov    0x14(%ebp),%eax
+  800449:	83 c0 04             	add    $0x4,%eax
+  80044c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80044f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800452:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800454:	85 c9                	test   %ecx,%ecx
+  800456:	b8 31 38 80 00       	mov    $0x803831,%eax
+  80045b:	0f 45 c1             	cmovne %ecx,%eax
+  80045e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800461:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800465:	7e 06                	jle    80046d <vprintfmt+0x19b>
+  800467:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80046b:	75 0b                	jne    800478 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80046d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800470:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800473:	89 75 08             	mov    %esi,0x8(%ebp)
+  800476:	eb 5c                	jmp    8004d4 <vprintfmt+0x202>
+  800478:	83 ec 08             	sub    $0x8,%esp
+  80047b:	ff 75 d0             	push   -0x30(%ebp)
+  80047e:	ff 75 cc             	push   -0x34(%ebp)
+  800481:	e8 20 03 00 00       	call   8007a6 <strnlen>
+  800486:	89 c2                	mov    %eax,%edx
+  800488:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80048b:	29 d0                	sub    %edx,%eax
+  80048d:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800490:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800494:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800497:	89 75 08             	mov    %esi,0x8(%ebp)
+  80049a:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80049c:	eb 0e                	jmp    8004ac <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80049e:	83 ec 08             	sub    $0x8,%esp
+  8004a1:	53                   	push   %ebx
+  8004a2:	57                   	push   %edi
+  8004a3:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004a6:	83 ee 01             	sub    $0x1,%esi
+  8004a9:	83 c4 10             	add    $0x10,%esp
+  8004ac:	85 f6                	test   %esi,%esi
+  8004ae:	7f ee                	jg     80049e <vprintfmt+0x1cc>
+  8004b0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004b6:	85 c0                	test   %eax,%eax
+  8004b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004bd:	0f 49 d0             	cmovns %eax,%edx
+  8004c0:	29 d0                	sub    %edx,%eax
+  8004c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c5:	eb a6                	jmp    80046d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004c7:	83 ec 08             	sub    $0x8,%esp
+  8004ca:	53                   	push   %ebx
+  8004cb:	52                   	push   %edx
+  8004cc:	ff 55 08             	call   *0x8(%ebp)
+  8004cf:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004d2:	89 f1                	mov    %esi,%ecx
+  8004d4:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004d7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004db:	0f be d0             	movsbl %al,%edx
+  8004de:	85 d2                	test   %edx,%edx
+  8004e0:	74 28                	je     80050a <vprintfmt+0x238>
+  8004e2:	85 ff                	test   %edi,%edi
+  8004e4:	78 05                	js     8004eb <vprintfmt+0x219>
+  8004e6:	83 ef 01             	sub    $0x1,%edi
+  8004e9:	78 30                	js     80051b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004eb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004ef:	74 d6                	je     8004c7 <vprintfmt+0x1f5>
+  8004f1:	0f be c0             	movsbl %al,%eax
+  8004f4:	83 e8 20             	sub    $0x20,%eax
+  8004f7:	83 f8 5e             	cmp    $0x5e,%eax
+  8004fa:	76 cb                	jbe    8004c7 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004fc:	83 ec 08             	sub    $0x8,%esp
+  8004ff:	53                   	push   %ebx
+  800500:	6a 3f                	push   $0x3f
+  800502:	ff 55 08             	call   *0x8(%ebp)
+  800505:	83 c4 10             	add    $0x10,%esp
+  800508:	eb c8                	jmp    8004d2 <vprintfmt+0x200>
+  80050a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800510:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800513:	01 d0                	add    %edx,%eax
+  800515:	29 c8                	sub    %ecx,%eax
+  800517:	89 c7                	mov    %eax,%edi
+  800519:	eb 13                	jmp    80052e <vprintfmt+0x25c>
+  80051b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80051e:	eb ed                	jmp    80050d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800520:	83 ec 08             	sub    $0x8,%esp
+  800523:	53                   	push   %ebx
+  800524:	6a 20                	push   $0x20
+  800526:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800528:	83 ef 01             	sub    $0x1,%edi
+  80052b:	83 c4 10             	add    $0x10,%esp
+  80052e:	85 ff                	test   %edi,%edi
+  800530:	7f ee                	jg     800520 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800532:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800535:	89 45 14             	mov    %eax,0x14(%ebp)
+  800538:	e9 6b 01 00 00       	jmp    8006a8 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80053d:	83 f9 01             	cmp    $0x1,%ecx
+  800540:	7f 1f                	jg     800561 <vprintfmt+0x28f>
+	else if (lflag)
+  800542:	85 c9                	test   %ecx,%ecx
+  800544:	74 67                	je     8005ad <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800546:	8b 45 14             	mov    0x14(%ebp),%eax
+  800549:	8b 00                	mov    (%eax),%eax
+  80054b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80054e:	89 c1                	mov    %eax,%ecx
+  800550:	c1 f9 1f             	sar    $0x1f,%ecx
+  800553:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800556:	8b 45 14             	mov    0x14(%ebp),%eax
+  800559:	8d 40 04             	lea    0x4(%eax),%eax
+  80055c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80055f:	eb 17                	jmp    800578 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800561:	8b 45 14             	mov    0x14(%ebp),%eax
+  800564:	8b 50 04             	mov    0x4(%eax),%edx
+  800567:	8b 00                	mov    (%eax),%eax
+  800569:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80056f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800572:	8d 40 08             	lea    0x8(%eax),%eax
+  800575:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800578:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80057b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80057e:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800583:	85 c9                	test   %ecx,%ecx
+  800585:	0f 89 03 01 00 00    	jns    80068e <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80058b:	83 ec 08             	sub    $0x8,%esp
+  80058e:	53                   	push   %ebx
+  80058f:	6a 2d                	push   $0x2d
+  800591:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800593:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800596:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800599:	f7 da                	neg    %edx
+  80059b:	83 d1 00             	adc    $0x0,%ecx
+  80059e:	f7 d9                	neg    %ecx
+  8005a0:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005a3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005a8:	e9 e1 00 00 00       	jmp    80068e <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b0:	8b 00                	mov    (%eax),%eax
+  8005b2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b5:	89 c1                	mov    %eax,%ecx
+  8005b7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005ba:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c6:	eb b0                	jmp    800578 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005c8:	83 f9 01             	cmp    $0x1,%ecx
+  8005cb:	7f 1e                	jg     8005eb <vprintfmt+0x319>
+	else if (lflag)
+  8005cd:	85 c9                	test   %ecx,%ecx
+  8005cf:	74 32                	je     800603 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d4:	8b 10                	mov    (%eax),%edx
+  8005d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005db:	8d 40 04             	lea    0x4(%eax),%eax
+  8005de:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005e1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005e6:	e9 a3 00 00 00       	jmp    80068e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ee:	8b 10                	mov    (%eax),%edx
+  8005f0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005f3:	8d 40 08             	lea    0x8(%eax),%eax
+  8005f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005fe:	e9 8b 00 00 00       	jmp    80068e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800603:	8b 45 14             	mov    0x14(%ebp),%eax
+  800606:	8b 10                	mov    (%eax),%edx
+  800608:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80060d:	8d 40 04             	lea    0x4(%eax),%eax
+  800610:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800613:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800618:	eb 74                	jmp    80068e <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80061a:	83 f9 01             	cmp    $0x1,%ecx
+  80061d:	7f 1b                	jg     80063a <vprintfmt+0x368>
+	else if (lflag)
+  80061f:	85 c9                	test   %ecx,%ecx
+  800621:	74 2c                	je     80064f <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800623:	8b 45 14             	mov    0x14(%ebp),%eax
+  800626:	8b 10                	mov    (%eax),%edx
+  800628:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062d:	8d 40 04             	lea    0x4(%eax),%eax
+  800630:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800633:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800638:	eb 54                	jmp    80068e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80063a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063d:	8b 10                	mov    (%eax),%edx
+  80063f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800642:	8d 40 08             	lea    0x8(%eax),%eax
+  800645:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800648:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80064d:	eb 3f                	jmp    80068e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80064f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800652:	8b 10                	mov    (%eax),%edx
+  800654:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800659:	8d 40 04             	lea    0x4(%eax),%eax
+  80065c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80065f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800664:	eb 28                	jmp    80068e <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800666:	83 ec 08             	sub    $0x8,%esp
+  800669:	53                   	push   %ebx
+  80066a:	6a 30                	push   $0x30
+  80066c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80066e:	83 c4 08             	add    $0x8,%esp
+  800671:	53                   	push   %ebx
+  800672:	6a 78                	push   $0x78
+  800674:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800676:	8b 45 14             	mov    0x14(%ebp),%eax
+  800679:	8b 10                	mov    (%eax),%edx
+  80067b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800680:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800683:	8d 40 04             	lea    0x4(%eax),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800689:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80068e:	83 ec 0c             	sub    $0xc,%esp
+  800691:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800695:	50                   	push   %eax
+  800696:	ff 75 e0             	push   -0x20(%ebp)
+  800699:	57                   	push   %edi
+  80069a:	51                   	push   %ecx
+  80069b:	52                   	push   %edx
+  80069c:	89 da                	mov    %ebx,%edx
+  80069e:	89 f0                	mov    %esi,%eax
+  8006a0:	e8 4a fb ff ff       	call   8001ef <printnum>
+			break;
+  8006a5:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006ab:	e9 40 fc ff ff       	jmp    8002f0 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006b0:	83 f9 01             	cmp    $0x1,%ecx
+  8006b3:	7f 1b                	jg     8006d0 <vprintfmt+0x3fe>
+	else if (lflag)
+  8006b5:	85 c9                	test   %ecx,%ecx
+  8006b7:	74 2c                	je     8006e5 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bc:	8b 10                	mov    (%eax),%edx
+  8006be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006ce:	eb be                	jmp    80068e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d3:	8b 10                	mov    (%eax),%edx
+  8006d5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d8:	8d 40 08             	lea    0x8(%eax),%eax
+  8006db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006de:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006e3:	eb a9                	jmp    80068e <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e8:	8b 10                	mov    (%eax),%edx
+  8006ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006fa:	eb 92                	jmp    80068e <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006fc:	83 ec 08             	sub    $0x8,%esp
+  8006ff:	53                   	push   %ebx
+  800700:	6a 25                	push   $0x25
+  800702:	ff d6                	call   *%esi
+			break;
+  800704:	83 c4 10             	add    $0x10,%esp
+  800707:	eb 9f                	jmp    8006a8 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800709:	83 ec 08             	sub    $0x8,%esp
+  80070c:	53                   	push   %ebx
+  80070d:	6a 25                	push   $0x25
+  80070f:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800711:	83 c4 10             	add    $0x10,%esp
+  800714:	89 f8                	mov    %edi,%eax
+  800716:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80071a:	74 05                	je     800721 <vprintfmt+0x44f>
+  80071c:	83 e8 01             	sub    $0x1,%eax
+  80071f:	eb f5                	jmp    800716 <vprintfmt+0x444>
+  800721:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800724:	eb 82                	jmp    8006a8 <vprintfmt+0x3d6>
+
+00800726 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800726:	55                   	push   %ebp
+  800727:	89 e5                	mov    %esp,%ebp
+  800729:	83 ec 18             	sub    $0x18,%esp
+  80072c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80072f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800732:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800735:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800739:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80073c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800743:	85 c0                	test   %eax,%eax
+  800745:	74 26                	je     80076d <vsnprintf+0x47>
+  800747:	85 d2                	test   %edx,%edx
+  800749:	7e 22                	jle    80076d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80074b:	ff 75 14             	push   0x14(%ebp)
+  80074e:	ff 75 10             	push   0x10(%ebp)
+  800751:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800754:	50                   	push   %eax
+  800755:	68 98 02 80 00       	push   $0x800298
+  80075a:	e8 73 fb ff ff       	call   8002d2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80075f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800762:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800765:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800768:	83 c4 10             	add    $0x10,%esp
+}
+  80076b:	c9                   	leave
+  80076c:	c3                   	ret
+		return -E_INVAL;
+  80076d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800772:	eb f7                	jmp    80076b <vsnprintf+0x45>
+
+00800774 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800774:	55                   	push   %ebp
+  800775:	89 e5                	mov    %esp,%ebp
+  800777:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80077a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80077d:	50                   	push   %eax
+  80077e:	ff 75 10             	push   0x10(%ebp)
+  800781:	ff 75 0c             	push   0xc(%ebp)
+  800784:	ff 75 08             	push   0x8(%ebp)
+  800787:	e8 9a ff ff ff       	call   800726 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80078c:	c9                   	leave
+  80078d:	c3                   	ret
+
+0080078e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80078e:	55                   	push   %ebp
+  80078f:	89 e5                	mov    %esp,%ebp
+  800791:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800794:	b8 00 00 00 00       	mov    $0x0,%eax
+  800799:	eb 03                	jmp    80079e <strlen+0x10>
+		n++;
+  80079b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80079e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007a2:	75 f7                	jne    80079b <strlen+0xd>
+	return n;
+}
+  8007a4:	5d                   	pop    %ebp
+  8007a5:	c3                   	ret
+
+008007a6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007a6:	55                   	push   %ebp
+  8007a7:	89 e5                	mov    %esp,%ebp
+  8007a9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b4:	eb 03                	jmp    8007b9 <strnlen+0x13>
+		n++;
+  8007b6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007b9:	39 d0                	cmp    %edx,%eax
+  8007bb:	74 08                	je     8007c5 <strnlen+0x1f>
+  8007bd:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007c1:	75 f3                	jne    8007b6 <strnlen+0x10>
+  8007c3:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007c5:	89 d0                	mov    %edx,%eax
+  8007c7:	5d                   	pop    %ebp
+  8007c8:	c3                   	ret
+
+008007c9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007c9:	55                   	push   %ebp
+  8007ca:	89 e5                	mov    %esp,%ebp
+  8007cc:	53                   	push   %ebx
+  8007cd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007d0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007dc:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007df:	83 c0 01             	add    $0x1,%eax
+  8007e2:	84 d2                	test   %dl,%dl
+  8007e4:	75 f2                	jne    8007d8 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007e6:	89 c8                	mov    %ecx,%eax
+  8007e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007eb:	c9                   	leave
+  8007ec:	c3                   	ret
+
+008007ed <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007ed:	55                   	push   %ebp
+  8007ee:	89 e5                	mov    %esp,%ebp
+  8007f0:	53                   	push   %ebx
+  8007f1:	83 ec 10             	sub    $0x10,%esp
+  8007f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007f7:	53                   	push   %ebx
+  8007f8:	e8 91 ff ff ff       	call   80078e <strlen>
+  8007fd:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800800:	ff 75 0c             	push   0xc(%ebp)
+  800803:	01 d8                	add    %ebx,%eax
+  800805:	50                   	push   %eax
+  800806:	e8 be ff ff ff       	call   8007c9 <strcpy>
+	return dst;
+}
+  80080b:	89 d8                	mov    %ebx,%eax
+  80080d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800810:	c9                   	leave
+  800811:	c3                   	ret
+
+00800812 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800812:	55                   	push   %ebp
+  800813:	89 e5                	mov    %esp,%ebp
+  800815:	56                   	push   %esi
+  800816:	53                   	push   %ebx
+  800817:	8b 75 08             	mov    0x8(%ebp),%esi
+  80081a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80081d:	89 f3                	mov    %esi,%ebx
+  80081f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800822:	89 f0                	mov    %esi,%eax
+  800824:	eb 0f                	jmp    800835 <strncpy+0x23>
+		*dst++ = *src;
+  800826:	83 c0 01             	add    $0x1,%eax
+  800829:	0f b6 0a             	movzbl (%edx),%ecx
+  80082c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80082f:	80 f9 01             	cmp    $0x1,%cl
+  800832:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800835:	39 d8                	cmp    %ebx,%eax
+  800837:	75 ed                	jne    800826 <strncpy+0x14>
+	}
+	return ret;
+}
+  800839:	89 f0                	mov    %esi,%eax
+  80083b:	5b                   	pop    %ebx
+  80083c:	5e                   	pop    %esi
+  80083d:	5d                   	pop    %ebp
+  80083e:	c3                   	ret
+
+0080083f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80083f:	55                   	push   %ebp
+  800840:	89 e5                	mov    %esp,%ebp
+  800842:	56                   	push   %esi
+  800843:	53                   	push   %ebx
+  800844:	8b 75 08             	mov    0x8(%ebp),%esi
+  800847:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80084a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80084d:	89 f0                	mov    %esi,%eax
+  80084f:	85 d2                	test   %edx,%edx
+  800851:	74 21                	je     800874 <strlcpy+0x35>
+  800853:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800857:	89 f2                	mov    %esi,%edx
+  800859:	eb 09                	jmp    800864 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80085b:	83 c1 01             	add    $0x1,%ecx
+  80085e:	83 c2 01             	add    $0x1,%edx
+  800861:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800864:	39 c2                	cmp    %eax,%edx
+  800866:	74 09                	je     800871 <strlcpy+0x32>
+  800868:	0f b6 19             	movzbl (%ecx),%ebx
+  80086b:	84 db                	test   %bl,%bl
+  80086d:	75 ec                	jne    80085b <strlcpy+0x1c>
+  80086f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800871:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800874:	29 f0                	sub    %esi,%eax
+}
+  800876:	5b                   	pop    %ebx
+  800877:	5e                   	pop    %esi
+  800878:	5d                   	pop    %ebp
+  800879:	c3                   	ret
+
+0080087a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80087a:	55                   	push   %ebp
+  80087b:	89 e5                	mov    %esp,%ebp
+  80087d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800880:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800883:	eb 06                	jmp    80088b <strcmp+0x11>
+		p++, q++;
+  800885:	83 c1 01             	add    $0x1,%ecx
+  800888:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80088b:	0f b6 01             	movzbl (%ecx),%eax
+  80088e:	84 c0                	test   %al,%al
+  800890:	74 04                	je     800896 <strcmp+0x1c>
+  800892:	3a 02                	cmp    (%edx),%al
+  800894:	74 ef                	je     800885 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800896:	0f b6 c0             	movzbl %al,%eax
+  800899:	0f b6 12             	movzbl (%edx),%edx
+  80089c:	29 d0                	sub    %edx,%eax
+}
+  80089e:	5d                   	pop    %ebp
+  80089f:	c3                   	ret
+
+008008a0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008a0:	55                   	push   %ebp
+  8008a1:	89 e5                	mov    %esp,%ebp
+  8008a3:	53                   	push   %ebx
+  8008a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008aa:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008ad:	eb 09                	jmp    8008b8 <strncmp+0x18>
+		n--, p++, q++;
+  8008af:	83 ea 01             	sub    $0x1,%edx
+  8008b2:	83 c0 01             	add    $0x1,%eax
+  8008b5:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008b8:	85 d2                	test   %edx,%edx
+  8008ba:	74 18                	je     8008d4 <strncmp+0x34>
+  8008bc:	0f b6 18             	movzbl (%eax),%ebx
+  8008bf:	84 db                	test   %bl,%bl
+  8008c1:	74 04                	je     8008c7 <strncmp+0x27>
+  8008c3:	3a 19                	cmp    (%ecx),%bl
+  8008c5:	74 e8                	je     8008af <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008c7:	0f b6 00             	movzbl (%eax),%eax
+  8008ca:	0f b6 11             	movzbl (%ecx),%edx
+  8008cd:	29 d0                	sub    %edx,%eax
+}
+  8008cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d2:	c9                   	leave
+  8008d3:	c3                   	ret
+		return 0;
+  8008d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d9:	eb f4                	jmp    8008cf <strncmp+0x2f>
+
+008008db <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008db:	55                   	push   %ebp
+  8008dc:	89 e5                	mov    %esp,%ebp
+  8008de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008e5:	eb 03                	jmp    8008ea <strchr+0xf>
+  8008e7:	83 c0 01             	add    $0x1,%eax
+  8008ea:	0f b6 10             	movzbl (%eax),%edx
+  8008ed:	84 d2                	test   %dl,%dl
+  8008ef:	74 06                	je     8008f7 <strchr+0x1c>
+		if (*s == c)
+  8008f1:	38 ca                	cmp    %cl,%dl
+  8008f3:	75 f2                	jne    8008e7 <strchr+0xc>
+  8008f5:	eb 05                	jmp    8008fc <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008fc:	5d                   	pop    %ebp
+  8008fd:	c3                   	ret
+
+008008fe <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008fe:	55                   	push   %ebp
+  8008ff:	89 e5                	mov    %esp,%ebp
+  800901:	8b 45 08             	mov    0x8(%ebp),%eax
+  800904:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800908:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80090b:	38 ca                	cmp    %cl,%dl
+  80090d:	74 09                	je     800918 <strfind+0x1a>
+  80090f:	84 d2                	test   %dl,%dl
+  800911:	74 05                	je     800918 <strfind+0x1a>
+	for (; *s; s++)
+  800913:	83 c0 01             	add    $0x1,%eax
+  800916:	eb f0                	jmp    800908 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800918:	5d                   	pop    %ebp
+  800919:	c3                   	ret
+
+0080091a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80091a:	55                   	push   %ebp
+  80091b:	89 e5                	mov    %esp,%ebp
+  80091d:	57                   	push   %edi
+  80091e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800921:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800924:	85 c9                	test   %ecx,%ecx
+  800926:	74 20                	je     800948 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800928:	89 f8                	mov    %edi,%eax
+  80092a:	09 c8                	or     %ecx,%eax
+  80092c:	a8 03                	test   $0x3,%al
+  80092e:	75 12                	jne    800942 <memset+0x28>
+		c &= 0xFF;
+  800930:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800934:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80093a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80093d:	fc                   	cld
+  80093e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800940:	eb 06                	jmp    800948 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800942:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800945:	fc                   	cld
+  800946:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800948:	89 f8                	mov    %edi,%eax
+  80094a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80094d:	c9                   	leave
+  80094e:	c3                   	ret
+
+0080094f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80094f:	55                   	push   %ebp
+  800950:	89 e5                	mov    %esp,%ebp
+  800952:	57                   	push   %edi
+  800953:	56                   	push   %esi
+  800954:	8b 45 08             	mov    0x8(%ebp),%eax
+  800957:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80095a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80095d:	39 c6                	cmp    %eax,%esi
+  80095f:	73 32                	jae    800993 <memmove+0x44>
+  800961:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800964:	39 d0                	cmp    %edx,%eax
+  800966:	73 2b                	jae    800993 <memmove+0x44>
+		s += n;
+		d += n;
+  800968:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80096b:	89 d6                	mov    %edx,%esi
+  80096d:	09 fe                	or     %edi,%esi
+  80096f:	09 ce                	or     %ecx,%esi
+  800971:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800977:	75 0e                	jne    800987 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800979:	83 ef 04             	sub    $0x4,%edi
+  80097c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80097f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800982:	fd                   	std
+  800983:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800985:	eb 09                	jmp    800990 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800987:	83 ef 01             	sub    $0x1,%edi
+  80098a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80098d:	fd                   	std
+  80098e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800990:	fc                   	cld
+  800991:	eb 1a                	jmp    8009ad <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800993:	89 f2                	mov    %esi,%edx
+  800995:	09 c2                	or     %eax,%edx
+  800997:	09 ca                	or     %ecx,%edx
+  800999:	f6 c2 03             	test   $0x3,%dl
+  80099c:	75 0a                	jne    8009a8 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80099e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009a1:	89 c7                	mov    %eax,%edi
+  8009a3:	fc                   	cld
+  8009a4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009a6:	eb 05                	jmp    8009ad <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009a8:	89 c7                	mov    %eax,%edi
+  8009aa:	fc                   	cld
+  8009ab:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009ad:	5e                   	pop    %esi
+  8009ae:	5f                   	pop    %edi
+  8009af:	5d                   	pop    %ebp
+  8009b0:	c3                   	ret
+
+008009b1 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009b1:	55                   	push   %ebp
+  8009b2:	89 e5                	mov    %esp,%ebp
+  8009b4:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009b7:	ff 75 10             	push   0x10(%ebp)
+  8009ba:	ff 75 0c             	push   0xc(%ebp)
+  8009bd:	ff 75 08             	push   0x8(%ebp)
+  8009c0:	e8 8a ff ff ff       	call   80094f <memmove>
+}
+  8009c5:	c9                   	leave
+  8009c6:	c3                   	ret
+
+008009c7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009c7:	55                   	push   %ebp
+  8009c8:	89 e5                	mov    %esp,%ebp
+  8009ca:	56                   	push   %esi
+  8009cb:	53                   	push   %ebx
+  8009cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009d2:	89 c6                	mov    %eax,%esi
+  8009d4:	03 75 10             	add    0x10(%ebp),%esi
+  8009d7:	eb 06                	jmp    8009df <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009d9:	83 c0 01             	add    $0x1,%eax
+  8009dc:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009df:	39 f0                	cmp    %esi,%eax
+  8009e1:	74 14                	je     8009f7 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009e3:	0f b6 08             	movzbl (%eax),%ecx
+  8009e6:	0f b6 1a             	movzbl (%edx),%ebx
+  8009e9:	38 d9                	cmp    %bl,%cl
+  8009eb:	74 ec                	je     8009d9 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009ed:	0f b6 c1             	movzbl %cl,%eax
+  8009f0:	0f b6 db             	movzbl %bl,%ebx
+  8009f3:	29 d8                	sub    %ebx,%eax
+  8009f5:	eb 05                	jmp    8009fc <memcmp+0x35>
+	}
+
+	return 0;
+  8009f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009fc:	5b                   	pop    %ebx
+  8009fd:	5e                   	pop    %esi
+  8009fe:	5d                   	pop    %ebp
+  8009ff:	c3                   	ret
+
+00800a00 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a00:	55                   	push   %ebp
+  800a01:	89 e5                	mov    %esp,%ebp
+  800a03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a09:	89 c2                	mov    %eax,%edx
+  800a0b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a0e:	eb 03                	jmp    800a13 <memfind+0x13>
+  800a10:	83 c0 01             	add    $0x1,%eax
+  800a13:	39 d0                	cmp    %edx,%eax
+  800a15:	73 04                	jae    800a1b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a17:	38 08                	cmp    %cl,(%eax)
+  800a19:	75 f5                	jne    800a10 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a1b:	5d                   	pop    %ebp
+  800a1c:	c3                   	ret
+
+00800a1d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a1d:	55                   	push   %ebp
+  800a1e:	89 e5                	mov    %esp,%ebp
+  800a20:	57                   	push   %edi
+  800a21:	56                   	push   %esi
+  800a22:	53                   	push   %ebx
+  800a23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a29:	eb 03                	jmp    800a2e <strtol+0x11>
+		s++;
+  800a2b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a2e:	0f b6 02             	movzbl (%edx),%eax
+  800a31:	3c 20                	cmp    $0x20,%al
+  800a33:	74 f6                	je     800a2b <strtol+0xe>
+  800a35:	3c 09                	cmp    $0x9,%al
+  800a37:	74 f2                	je     800a2b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a39:	3c 2b                	cmp    $0x2b,%al
+  800a3b:	74 2a                	je     800a67 <strtol+0x4a>
+	int neg = 0;
+  800a3d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a42:	3c 2d                	cmp    $0x2d,%al
+  800a44:	74 2b                	je     800a71 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a46:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a4c:	75 0f                	jne    800a5d <strtol+0x40>
+  800a4e:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a51:	74 28                	je     800a7b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a53:	85 db                	test   %ebx,%ebx
+  800a55:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a5a:	0f 44 d8             	cmove  %eax,%ebx
+  800a5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a62:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a65:	eb 46                	jmp    800aad <strtol+0x90>
+		s++;
+  800a67:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a6f:	eb d5                	jmp    800a46 <strtol+0x29>
+		s++, neg = 1;
+  800a71:	83 c2 01             	add    $0x1,%edx
+  800a74:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a79:	eb cb                	jmp    800a46 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a7b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a7f:	74 0e                	je     800a8f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a81:	85 db                	test   %ebx,%ebx
+  800a83:	75 d8                	jne    800a5d <strtol+0x40>
+		s++, base = 8;
+  800a85:	83 c2 01             	add    $0x1,%edx
+  800a88:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a8d:	eb ce                	jmp    800a5d <strtol+0x40>
+		s += 2, base = 16;
+  800a8f:	83 c2 02             	add    $0x2,%edx
+  800a92:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a97:	eb c4                	jmp    800a5d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a99:	0f be c0             	movsbl %al,%eax
+  800a9c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a9f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800aa2:	7d 3a                	jge    800ade <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800aa4:	83 c2 01             	add    $0x1,%edx
+  800aa7:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800aab:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800aad:	0f b6 02             	movzbl (%edx),%eax
+  800ab0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ab3:	89 f3                	mov    %esi,%ebx
+  800ab5:	80 fb 09             	cmp    $0x9,%bl
+  800ab8:	76 df                	jbe    800a99 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800aba:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800abd:	89 f3                	mov    %esi,%ebx
+  800abf:	80 fb 19             	cmp    $0x19,%bl
+  800ac2:	77 08                	ja     800acc <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ac4:	0f be c0             	movsbl %al,%eax
+  800ac7:	83 e8 57             	sub    $0x57,%eax
+  800aca:	eb d3                	jmp    800a9f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800acc:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800acf:	89 f3                	mov    %esi,%ebx
+  800ad1:	80 fb 19             	cmp    $0x19,%bl
+  800ad4:	77 08                	ja     800ade <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ad6:	0f be c0             	movsbl %al,%eax
+  800ad9:	83 e8 37             	sub    $0x37,%eax
+  800adc:	eb c1                	jmp    800a9f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ade:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ae2:	74 05                	je     800ae9 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ae4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ae7:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ae9:	89 c8                	mov    %ecx,%eax
+  800aeb:	f7 d8                	neg    %eax
+  800aed:	85 ff                	test   %edi,%edi
+  800aef:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800af2:	89 c8                	mov    %ecx,%eax
+  800af4:	5b                   	pop    %ebx
+  800af5:	5e                   	pop    %esi
+  800af6:	5f                   	pop    %edi
+  800af7:	5d                   	pop    %ebp
+  800af8:	c3                   	ret
+
+00800af9 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800af9:	55                   	push   %ebp
+  800afa:	89 e5                	mov    %esp,%ebp
+  800afc:	57                   	push   %edi
+  800afd:	56                   	push   %esi
+  800afe:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800aff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b0a:	89 c3                	mov    %eax,%ebx
+  800b0c:	89 c7                	mov    %eax,%edi
+  800b0e:	55                   	push   %ebp
+  800b0f:	89 e5                	mov    %esp,%ebp
+  800b11:	8d 35 19 0b 80 00    	lea    0x800b19,%esi
+  800b17:	0f 34                	sysenter
+  800b19:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800b1a:	5b                   	pop    %ebx
+  800b1b:	5e                   	pop    %esi
+  800b1c:	5f                   	pop    %edi
+  800b1d:	5d                   	pop    %ebp
+  800b1e:	c3                   	ret
+
+00800b1f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b1f:	55                   	push   %ebp
+  800b20:	89 e5                	mov    %esp,%ebp
+  800b22:	57                   	push   %edi
+  800b23:	56                   	push   %esi
+  800b24:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b25:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b2a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b2f:	89 d1                	mov    %edx,%ecx
+  800b31:	89 d3                	mov    %edx,%ebx
+  800b33:	89 d7                	mov    %edx,%edi
+  800b35:	55                   	push   %ebp
+  800b36:	89 e5                	mov    %esp,%ebp
+  800b38:	8d 35 40 0b 80 00    	lea    0x800b40,%esi
+  800b3e:	0f 34                	sysenter
+  800b40:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800b41:	5b                   	pop    %ebx
+  800b42:	5e                   	pop    %esi
+  800b43:	5f                   	pop    %edi
+  800b44:	5d                   	pop    %ebp
+  800b45:	c3                   	ret
+
+00800b46 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b46:	55                   	push   %ebp
+  800b47:	89 e5                	mov    %esp,%ebp
+  800b49:	57                   	push   %edi
+  800b4a:	56                   	push   %esi
+  800b4b:	53                   	push   %ebx
+  800b4c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b57:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b5c:	89 cb                	mov    %ecx,%ebx
+  800b5e:	89 cf                	mov    %ecx,%edi
+  800b60:	55                   	push   %ebp
+  800b61:	89 e5                	mov    %esp,%ebp
+  800b63:	8d 35 6b 0b 80 00    	lea    0x800b6b,%esi
+  800b69:	0f 34                	sysenter
+  800b6b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b6c:	85 c0                	test   %eax,%eax
+  800b6e:	7f 08                	jg     800b78 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800b70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b73:	5b                   	pop    %ebx
+  800b74:	5e                   	pop    %esi
+  800b75:	5f                   	pop    %edi
+  800b76:	5d                   	pop    %ebp
+  800b77:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b78:	83 ec 0c             	sub    $0xc,%esp
+  800b7b:	50                   	push   %eax
+  800b7c:	6a 03                	push   $0x3
+  800b7e:	68 47 3b 80 00       	push   $0x803b47
+  800b83:	6a 3d                	push   $0x3d
+  800b85:	68 64 3b 80 00       	push   $0x803b64
+  800b8a:	e8 17 27 00 00       	call   8032a6 <_panic>
+
+00800b8f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b8f:	55                   	push   %ebp
+  800b90:	89 e5                	mov    %esp,%ebp
+  800b92:	57                   	push   %edi
+  800b93:	56                   	push   %esi
+  800b94:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b95:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b9a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b9f:	89 d1                	mov    %edx,%ecx
+  800ba1:	89 d3                	mov    %edx,%ebx
+  800ba3:	89 d7                	mov    %edx,%edi
+  800ba5:	55                   	push   %ebp
+  800ba6:	89 e5                	mov    %esp,%ebp
+  800ba8:	8d 35 b0 0b 80 00    	lea    0x800bb0,%esi
+  800bae:	0f 34                	sysenter
+  800bb0:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800bb1:	5b                   	pop    %ebx
+  800bb2:	5e                   	pop    %esi
+  800bb3:	5f                   	pop    %edi
+  800bb4:	5d                   	pop    %ebp
+  800bb5:	c3                   	ret
+
+00800bb6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bb6:	55                   	push   %ebp
+  800bb7:	89 e5                	mov    %esp,%ebp
+  800bb9:	57                   	push   %edi
+  800bba:	56                   	push   %esi
+  800bbb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bc1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bc6:	89 d1                	mov    %edx,%ecx
+  800bc8:	89 d3                	mov    %edx,%ebx
+  800bca:	89 d7                	mov    %edx,%edi
+  800bcc:	89 d6                	mov    %edx,%esi
+  800bce:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bd0:	5b                   	pop    %ebx
+  800bd1:	5e                   	pop    %esi
+  800bd2:	5f                   	pop    %edi
+  800bd3:	5d                   	pop    %ebp
+  800bd4:	c3                   	ret
+
+00800bd5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bd5:	55                   	push   %ebp
+  800bd6:	89 e5                	mov    %esp,%ebp
+  800bd8:	57                   	push   %edi
+  800bd9:	56                   	push   %esi
+  800bda:	53                   	push   %ebx
+  800bdb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800bde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800be9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bf1:	55                   	push   %ebp
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	8d 35 fc 0b 80 00    	lea    0x800bfc,%esi
+  800bfa:	0f 34                	sysenter
+  800bfc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bfd:	85 c0                	test   %eax,%eax
+  800bff:	7f 08                	jg     800c09 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800c01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c04:	5b                   	pop    %ebx
+  800c05:	5e                   	pop    %esi
+  800c06:	5f                   	pop    %edi
+  800c07:	5d                   	pop    %ebp
+  800c08:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c09:	83 ec 0c             	sub    $0xc,%esp
+  800c0c:	50                   	push   %eax
+  800c0d:	6a 04                	push   $0x4
+  800c0f:	68 47 3b 80 00       	push   $0x803b47
+  800c14:	6a 3d                	push   $0x3d
+  800c16:	68 64 3b 80 00       	push   $0x803b64
+  800c1b:	e8 86 26 00 00       	call   8032a6 <_panic>
+
+00800c20 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c20:	55                   	push   %ebp
+  800c21:	89 e5                	mov    %esp,%ebp
+  800c23:	57                   	push   %edi
+  800c24:	56                   	push   %esi
+  800c25:	53                   	push   %ebx
+  800c26:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c34:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c37:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c3a:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c3d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c3f:	85 c0                	test   %eax,%eax
+  800c41:	7f 08                	jg     800c4b <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c46:	5b                   	pop    %ebx
+  800c47:	5e                   	pop    %esi
+  800c48:	5f                   	pop    %edi
+  800c49:	5d                   	pop    %ebp
+  800c4a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c4b:	83 ec 0c             	sub    $0xc,%esp
+  800c4e:	50                   	push   %eax
+  800c4f:	6a 05                	push   $0x5
+  800c51:	68 47 3b 80 00       	push   $0x803b47
+  800c56:	6a 23                	push   $0x23
+  800c58:	68 64 3b 80 00       	push   $0x803b64
+  800c5d:	e8 44 26 00 00       	call   8032a6 <_panic>
+
+00800c62 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c62:	55                   	push   %ebp
+  800c63:	89 e5                	mov    %esp,%ebp
+  800c65:	57                   	push   %edi
+  800c66:	56                   	push   %esi
+  800c67:	53                   	push   %ebx
+  800c68:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c76:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c7b:	89 df                	mov    %ebx,%edi
+  800c7d:	55                   	push   %ebp
+  800c7e:	89 e5                	mov    %esp,%ebp
+  800c80:	8d 35 88 0c 80 00    	lea    0x800c88,%esi
+  800c86:	0f 34                	sysenter
+  800c88:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c89:	85 c0                	test   %eax,%eax
+  800c8b:	7f 08                	jg     800c95 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800c8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c90:	5b                   	pop    %ebx
+  800c91:	5e                   	pop    %esi
+  800c92:	5f                   	pop    %edi
+  800c93:	5d                   	pop    %ebp
+  800c94:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c95:	83 ec 0c             	sub    $0xc,%esp
+  800c98:	50                   	push   %eax
+  800c99:	6a 06                	push   $0x6
+  800c9b:	68 47 3b 80 00       	push   $0x803b47
+  800ca0:	6a 3d                	push   $0x3d
+  800ca2:	68 64 3b 80 00       	push   $0x803b64
+  800ca7:	e8 fa 25 00 00       	call   8032a6 <_panic>
+
+00800cac <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800cac:	55                   	push   %ebp
+  800cad:	89 e5                	mov    %esp,%ebp
+  800caf:	57                   	push   %edi
+  800cb0:	56                   	push   %esi
+  800cb1:	53                   	push   %ebx
+  800cb2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc0:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cc5:	89 df                	mov    %ebx,%edi
+  800cc7:	55                   	push   %ebp
+  800cc8:	89 e5                	mov    %esp,%ebp
+  800cca:	8d 35 d2 0c 80 00    	lea    0x800cd2,%esi
+  800cd0:	0f 34                	sysenter
+  800cd2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cd3:	85 c0                	test   %eax,%eax
+  800cd5:	7f 08                	jg     800cdf <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800cd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cda:	5b                   	pop    %ebx
+  800cdb:	5e                   	pop    %esi
+  800cdc:	5f                   	pop    %edi
+  800cdd:	5d                   	pop    %ebp
+  800cde:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cdf:	83 ec 0c             	sub    $0xc,%esp
+  800ce2:	50                   	push   %eax
+  800ce3:	6a 08                	push   $0x8
+  800ce5:	68 47 3b 80 00       	push   $0x803b47
+  800cea:	6a 3d                	push   $0x3d
+  800cec:	68 64 3b 80 00       	push   $0x803b64
+  800cf1:	e8 b0 25 00 00       	call   8032a6 <_panic>
+
+00800cf6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800cf6:	55                   	push   %ebp
+  800cf7:	89 e5                	mov    %esp,%ebp
+  800cf9:	57                   	push   %edi
+  800cfa:	56                   	push   %esi
+  800cfb:	53                   	push   %ebx
+  800cfc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0a:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d0f:	89 df                	mov    %ebx,%edi
+  800d11:	55                   	push   %ebp
+  800d12:	89 e5                	mov    %esp,%ebp
+  800d14:	8d 35 1c 0d 80 00    	lea    0x800d1c,%esi
+  800d1a:	0f 34                	sysenter
+  800d1c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d1d:	85 c0                	test   %eax,%eax
+  800d1f:	7f 08                	jg     800d29 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800d21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d24:	5b                   	pop    %ebx
+  800d25:	5e                   	pop    %esi
+  800d26:	5f                   	pop    %edi
+  800d27:	5d                   	pop    %ebp
+  800d28:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d29:	83 ec 0c             	sub    $0xc,%esp
+  800d2c:	50                   	push   %eax
+  800d2d:	6a 09                	push   $0x9
+  800d2f:	68 47 3b 80 00       	push   $0x803b47
+  800d34:	6a 3d                	push   $0x3d
+  800d36:	68 64 3b 80 00       	push   $0x803b64
+  800d3b:	e8 66 25 00 00       	call   8032a6 <_panic>
+
+00800d40 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d40:	55                   	push   %ebp
+  800d41:	89 e5                	mov    %esp,%ebp
+  800d43:	57                   	push   %edi
+  800d44:	56                   	push   %esi
+  800d45:	53                   	push   %ebx
+  800d46:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d54:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d59:	89 df                	mov    %ebx,%edi
+  800d5b:	55                   	push   %ebp
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	8d 35 66 0d 80 00    	lea    0x800d66,%esi
+  800d64:	0f 34                	sysenter
+  800d66:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d67:	85 c0                	test   %eax,%eax
+  800d69:	7f 08                	jg     800d73 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800d6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6e:	5b                   	pop    %ebx
+  800d6f:	5e                   	pop    %esi
+  800d70:	5f                   	pop    %edi
+  800d71:	5d                   	pop    %ebp
+  800d72:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d73:	83 ec 0c             	sub    $0xc,%esp
+  800d76:	50                   	push   %eax
+  800d77:	6a 0a                	push   $0xa
+  800d79:	68 47 3b 80 00       	push   $0x803b47
+  800d7e:	6a 3d                	push   $0x3d
+  800d80:	68 64 3b 80 00       	push   $0x803b64
+  800d85:	e8 1c 25 00 00       	call   8032a6 <_panic>
+
+00800d8a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800d8a:	55                   	push   %ebp
+  800d8b:	89 e5                	mov    %esp,%ebp
+  800d8d:	57                   	push   %edi
+  800d8e:	56                   	push   %esi
+  800d8f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d96:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d9b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d9e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800da1:	55                   	push   %ebp
+  800da2:	89 e5                	mov    %esp,%ebp
+  800da4:	8d 35 ac 0d 80 00    	lea    0x800dac,%esi
+  800daa:	0f 34                	sysenter
+  800dac:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800dad:	5b                   	pop    %ebx
+  800dae:	5e                   	pop    %esi
+  800daf:	5f                   	pop    %edi
+  800db0:	5d                   	pop    %ebp
+  800db1:	c3                   	ret
+
+00800db2 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800db2:	55                   	push   %ebp
+  800db3:	89 e5                	mov    %esp,%ebp
+  800db5:	57                   	push   %edi
+  800db6:	56                   	push   %esi
+  800db7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800db8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbe:	b8 17 00 00 00       	mov    $0x17,%eax
+  800dc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc9:	55                   	push   %ebp
+  800dca:	89 e5                	mov    %esp,%ebp
+  800dcc:	8d 35 d4 0d 80 00    	lea    0x800dd4,%esi
+  800dd2:	0f 34                	sysenter
+  800dd4:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800dd5:	5b                   	pop    %ebx
+  800dd6:	5e                   	pop    %esi
+  800dd7:	5f                   	pop    %edi
+  800dd8:	5d                   	pop    %ebp
+  800dd9:	c3                   	ret
+
+00800dda <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800dda:	55                   	push   %ebp
+  800ddb:	89 e5                	mov    %esp,%ebp
+  800ddd:	57                   	push   %edi
+  800dde:	56                   	push   %esi
+  800ddf:	53                   	push   %ebx
+  800de0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800de3:	be 00 00 00 00       	mov    $0x0,%esi
+  800de8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800deb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dee:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800df3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df6:	89 f7                	mov    %esi,%edi
+  800df8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dfa:	85 c0                	test   %eax,%eax
+  800dfc:	7f 08                	jg     800e06 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800dfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e01:	5b                   	pop    %ebx
+  800e02:	5e                   	pop    %esi
+  800e03:	5f                   	pop    %edi
+  800e04:	5d                   	pop    %ebp
+  800e05:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e06:	83 ec 0c             	sub    $0xc,%esp
+  800e09:	50                   	push   %eax
+  800e0a:	6a 0d                	push   $0xd
+  800e0c:	68 47 3b 80 00       	push   $0x803b47
+  800e11:	6a 23                	push   $0x23
+  800e13:	68 64 3b 80 00       	push   $0x803b64
+  800e18:	e8 89 24 00 00       	call   8032a6 <_panic>
+
+00800e1d <sys_ipc_recv>:
+{
+  800e1d:	55                   	push   %ebp
+  800e1e:	89 e5                	mov    %esp,%ebp
+  800e20:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800e23:	6a 00                	push   $0x0
+  800e25:	6a 01                	push   $0x1
+  800e27:	ff 75 08             	push   0x8(%ebp)
+  800e2a:	e8 ab ff ff ff       	call   800dda <sys_ipc_recvv>
+}
+  800e2f:	c9                   	leave
+  800e30:	c3                   	ret
+
+00800e31 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	57                   	push   %edi
+  800e35:	56                   	push   %esi
+  800e36:	53                   	push   %ebx
+  800e37:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e42:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e45:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e4a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e4d:	89 de                	mov    %ebx,%esi
+  800e4f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e51:	85 c0                	test   %eax,%eax
+  800e53:	7f 08                	jg     800e5d <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800e55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5f                   	pop    %edi
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5d:	83 ec 0c             	sub    $0xc,%esp
+  800e60:	50                   	push   %eax
+  800e61:	6a 0d                	push   $0xd
+  800e63:	68 47 3b 80 00       	push   $0x803b47
+  800e68:	6a 23                	push   $0x23
+  800e6a:	68 64 3b 80 00       	push   $0x803b64
+  800e6f:	e8 32 24 00 00       	call   8032a6 <_panic>
+
+00800e74 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e74:	55                   	push   %ebp
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	57                   	push   %edi
+  800e78:	56                   	push   %esi
+  800e79:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e84:	89 d1                	mov    %edx,%ecx
+  800e86:	89 d3                	mov    %edx,%ebx
+  800e88:	89 d7                	mov    %edx,%edi
+  800e8a:	55                   	push   %ebp
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	8d 35 95 0e 80 00    	lea    0x800e95,%esi
+  800e93:	0f 34                	sysenter
+  800e95:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800e96:	5b                   	pop    %ebx
+  800e97:	5e                   	pop    %esi
+  800e98:	5f                   	pop    %edi
+  800e99:	5d                   	pop    %ebp
+  800e9a:	c3                   	ret
+
+00800e9b <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800e9b:	55                   	push   %ebp
+  800e9c:	89 e5                	mov    %esp,%ebp
+  800e9e:	57                   	push   %edi
+  800e9f:	56                   	push   %esi
+  800ea0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ea1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eac:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800eb1:	89 df                	mov    %ebx,%edi
+  800eb3:	55                   	push   %ebp
+  800eb4:	89 e5                	mov    %esp,%ebp
+  800eb6:	8d 35 be 0e 80 00    	lea    0x800ebe,%esi
+  800ebc:	0f 34                	sysenter
+  800ebe:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800ebf:	5b                   	pop    %ebx
+  800ec0:	5e                   	pop    %esi
+  800ec1:	5f                   	pop    %edi
+  800ec2:	5d                   	pop    %ebp
+  800ec3:	c3                   	ret
+
+00800ec4 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800ec4:	55                   	push   %ebp
+  800ec5:	89 e5                	mov    %esp,%ebp
+  800ec7:	57                   	push   %edi
+  800ec8:	56                   	push   %esi
+  800ec9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ecf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed2:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ed7:	89 cb                	mov    %ecx,%ebx
+  800ed9:	89 cf                	mov    %ecx,%edi
+  800edb:	55                   	push   %ebp
+  800edc:	89 e5                	mov    %esp,%ebp
+  800ede:	8d 35 e6 0e 80 00    	lea    0x800ee6,%esi
+  800ee4:	0f 34                	sysenter
+  800ee6:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800ee7:	5b                   	pop    %ebx
+  800ee8:	5e                   	pop    %esi
+  800ee9:	5f                   	pop    %edi
+  800eea:	5d                   	pop    %ebp
+  800eeb:	c3                   	ret
+
+00800eec <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800eec:	55                   	push   %ebp
+  800eed:	89 e5                	mov    %esp,%ebp
+  800eef:	57                   	push   %edi
+  800ef0:	56                   	push   %esi
+  800ef1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ef2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efd:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f02:	89 df                	mov    %ebx,%edi
+  800f04:	55                   	push   %ebp
+  800f05:	89 e5                	mov    %esp,%ebp
+  800f07:	8d 35 0f 0f 80 00    	lea    0x800f0f,%esi
+  800f0d:	0f 34                	sysenter
+  800f0f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800f10:	5b                   	pop    %ebx
+  800f11:	5e                   	pop    %esi
+  800f12:	5f                   	pop    %edi
+  800f13:	5d                   	pop    %ebp
+  800f14:	c3                   	ret
+
+00800f15 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800f15:	55                   	push   %ebp
+  800f16:	89 e5                	mov    %esp,%ebp
+  800f18:	57                   	push   %edi
+  800f19:	56                   	push   %esi
+  800f1a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f26:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f2b:	89 df                	mov    %ebx,%edi
+  800f2d:	55                   	push   %ebp
+  800f2e:	89 e5                	mov    %esp,%ebp
+  800f30:	8d 35 38 0f 80 00    	lea    0x800f38,%esi
+  800f36:	0f 34                	sysenter
+  800f38:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800f39:	5b                   	pop    %ebx
+  800f3a:	5e                   	pop    %esi
+  800f3b:	5f                   	pop    %edi
+  800f3c:	5d                   	pop    %ebp
+  800f3d:	c3                   	ret
+
+00800f3e <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800f3e:	55                   	push   %ebp
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	57                   	push   %edi
+  800f42:	56                   	push   %esi
+  800f43:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4a:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f52:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f55:	55                   	push   %ebp
+  800f56:	89 e5                	mov    %esp,%ebp
+  800f58:	8d 35 60 0f 80 00    	lea    0x800f60,%esi
+  800f5e:	0f 34                	sysenter
+  800f60:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800f61:	5b                   	pop    %ebx
+  800f62:	5e                   	pop    %esi
+  800f63:	5f                   	pop    %edi
+  800f64:	5d                   	pop    %ebp
+  800f65:	c3                   	ret
+
+00800f66 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800f66:	55                   	push   %ebp
+  800f67:	89 e5                	mov    %esp,%ebp
+  800f69:	57                   	push   %edi
+  800f6a:	56                   	push   %esi
+  800f6b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f74:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f79:	89 cb                	mov    %ecx,%ebx
+  800f7b:	89 cf                	mov    %ecx,%edi
+  800f7d:	89 ce                	mov    %ecx,%esi
+  800f7f:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800f81:	5b                   	pop    %ebx
+  800f82:	5e                   	pop    %esi
+  800f83:	5f                   	pop    %edi
+  800f84:	5d                   	pop    %ebp
+  800f85:	c3                   	ret
+
+00800f86 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800f86:	55                   	push   %ebp
+  800f87:	89 e5                	mov    %esp,%ebp
+  800f89:	57                   	push   %edi
+  800f8a:	56                   	push   %esi
+  800f8b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f94:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f99:	89 cb                	mov    %ecx,%ebx
+  800f9b:	89 cf                	mov    %ecx,%edi
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	8d 35 a8 0f 80 00    	lea    0x800fa8,%esi
+  800fa6:	0f 34                	sysenter
+  800fa8:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800fa9:	5b                   	pop    %ebx
+  800faa:	5e                   	pop    %esi
+  800fab:	5f                   	pop    %edi
+  800fac:	5d                   	pop    %ebp
+  800fad:	c3                   	ret
+
+00800fae <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  800fb1:	57                   	push   %edi
+  800fb2:	56                   	push   %esi
+  800fb3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fb4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbc:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fc1:	89 cb                	mov    %ecx,%ebx
+  800fc3:	89 cf                	mov    %ecx,%edi
+  800fc5:	55                   	push   %ebp
+  800fc6:	89 e5                	mov    %esp,%ebp
+  800fc8:	8d 35 d0 0f 80 00    	lea    0x800fd0,%esi
+  800fce:	0f 34                	sysenter
+  800fd0:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800fd1:	5b                   	pop    %ebx
+  800fd2:	5e                   	pop    %esi
+  800fd3:	5f                   	pop    %edi
+  800fd4:	5d                   	pop    %ebp
+  800fd5:	c3                   	ret
+
+00800fd6 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  800fd6:	55                   	push   %ebp
+  800fd7:	89 e5                	mov    %esp,%ebp
+  800fd9:	57                   	push   %edi
+  800fda:	56                   	push   %esi
+  800fdb:	53                   	push   %ebx
+  800fdc:	83 ec 20             	sub    $0x20,%esp
+  800fdf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800fe2:	89 d7                	mov    %edx,%edi
+  800fe4:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  800fe6:	51                   	push   %ecx
+  800fe7:	68 00 f0 7f 00       	push   $0x7ff000
+  800fec:	6a 00                	push   $0x0
+  800fee:	e8 e2 fb ff ff       	call   800bd5 <sys_page_alloc>
+  800ff3:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  800ff5:	83 c4 10             	add    $0x10,%esp
+  800ff8:	85 c0                	test   %eax,%eax
+  800ffa:	78 45                	js     801041 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  800ffc:	83 ec 04             	sub    $0x4,%esp
+  800fff:	68 00 10 00 00       	push   $0x1000
+  801004:	57                   	push   %edi
+  801005:	68 00 f0 7f 00       	push   $0x7ff000
+  80100a:	e8 40 f9 ff ff       	call   80094f <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  80100f:	89 34 24             	mov    %esi,(%esp)
+  801012:	57                   	push   %edi
+  801013:	ff 75 e4             	push   -0x1c(%ebp)
+  801016:	68 00 f0 7f 00       	push   $0x7ff000
+  80101b:	6a 00                	push   $0x0
+  80101d:	e8 fe fb ff ff       	call   800c20 <sys_page_map>
+  801022:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801024:	83 c4 20             	add    $0x20,%esp
+  801027:	85 c0                	test   %eax,%eax
+  801029:	78 16                	js     801041 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80102b:	83 ec 08             	sub    $0x8,%esp
+  80102e:	68 00 f0 7f 00       	push   $0x7ff000
+  801033:	6a 00                	push   $0x0
+  801035:	e8 28 fc ff ff       	call   800c62 <sys_page_unmap>
+  80103a:	83 c4 10             	add    $0x10,%esp
+  80103d:	85 c0                	test   %eax,%eax
+  80103f:	75 0a                	jne    80104b <copy_page_to+0x75>
+exit:
+	return r;
+}
+  801041:	89 d8                	mov    %ebx,%eax
+  801043:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801046:	5b                   	pop    %ebx
+  801047:	5e                   	pop    %esi
+  801048:	5f                   	pop    %edi
+  801049:	5d                   	pop    %ebp
+  80104a:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80104b:	68 74 3b 80 00       	push   $0x803b74
+  801050:	68 ec 3b 80 00       	push   $0x803bec
+  801055:	6a 1b                	push   $0x1b
+  801057:	68 01 3c 80 00       	push   $0x803c01
+  80105c:	e8 45 22 00 00       	call   8032a6 <_panic>
+
+00801061 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801061:	55                   	push   %ebp
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	53                   	push   %ebx
+  801065:	83 ec 04             	sub    $0x4,%esp
+  801068:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  80106b:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80106d:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  801071:	74 21                	je     801094 <pgfault+0x33>
+  801073:	89 d0                	mov    %edx,%eax
+  801075:	c1 e8 16             	shr    $0x16,%eax
+  801078:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80107f:	a8 01                	test   $0x1,%al
+  801081:	74 11                	je     801094 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  801083:	89 d0                	mov    %edx,%eax
+  801085:	c1 e8 0c             	shr    $0xc,%eax
+  801088:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80108f:	f6 c4 08             	test   $0x8,%ah
+  801092:	75 17                	jne    8010ab <pgfault+0x4a>
+		if (pgfault_next) {
+  801094:	a1 04 50 80 00       	mov    0x805004,%eax
+  801099:	85 c0                	test   %eax,%eax
+  80109b:	74 27                	je     8010c4 <pgfault+0x63>
+			pgfault_next(utf);
+  80109d:	83 ec 0c             	sub    $0xc,%esp
+  8010a0:	53                   	push   %ebx
+  8010a1:	ff d0                	call   *%eax
+			return;
+  8010a3:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8010a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010a9:	c9                   	leave
+  8010aa:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8010ab:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8010b1:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8010b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010bb:	e8 16 ff ff ff       	call   800fd6 <copy_page_to>
+  8010c0:	85 c0                	test   %eax,%eax
+  8010c2:	79 e2                	jns    8010a6 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8010c4:	a1 00 50 80 00       	mov    0x805000,%eax
+  8010c9:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8010cc:	ff 73 28             	push   0x28(%ebx)
+  8010cf:	ff 33                	push   (%ebx)
+  8010d1:	50                   	push   %eax
+  8010d2:	68 98 3b 80 00       	push   $0x803b98
+  8010d7:	e8 ff f0 ff ff       	call   8001db <cprintf>
+	sys_env_destroy(0);
+  8010dc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8010e3:	e8 5e fa ff ff       	call   800b46 <sys_env_destroy>
+  8010e8:	83 c4 10             	add    $0x10,%esp
+  8010eb:	eb b9                	jmp    8010a6 <pgfault+0x45>
+
+008010ed <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8010ed:	55                   	push   %ebp
+  8010ee:	89 e5                	mov    %esp,%ebp
+  8010f0:	53                   	push   %ebx
+  8010f1:	83 ec 04             	sub    $0x4,%esp
+  8010f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8010f7:	a1 04 90 80 00       	mov    0x809004,%eax
+  8010fc:	3d 61 10 80 00       	cmp    $0x801061,%eax
+  801101:	74 15                	je     801118 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  801103:	a3 04 50 80 00       	mov    %eax,0x805004
+		set_pgfault_handler(pgfault);
+  801108:	83 ec 0c             	sub    $0xc,%esp
+  80110b:	68 61 10 80 00       	push   $0x801061
+  801110:	e8 d7 21 00 00       	call   8032ec <set_pgfault_handler>
+  801115:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801118:	83 ec 0c             	sub    $0xc,%esp
+  80111b:	68 05 08 00 00       	push   $0x805
+  801120:	53                   	push   %ebx
+  801121:	6a 00                	push   $0x0
+  801123:	53                   	push   %ebx
+  801124:	6a 00                	push   $0x0
+  801126:	e8 f5 fa ff ff       	call   800c20 <sys_page_map>
+}
+  80112b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80112e:	c9                   	leave
+  80112f:	c3                   	ret
+
+00801130 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801130:	55                   	push   %ebp
+  801131:	89 e5                	mov    %esp,%ebp
+  801133:	57                   	push   %edi
+  801134:	56                   	push   %esi
+  801135:	53                   	push   %ebx
+  801136:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801139:	68 61 10 80 00       	push   $0x801061
+  80113e:	e8 a9 21 00 00       	call   8032ec <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801143:	b8 07 00 00 00       	mov    $0x7,%eax
+  801148:	cd 30                	int    $0x30
+  80114a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80114d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  801150:	83 c4 10             	add    $0x10,%esp
+  801153:	85 c0                	test   %eax,%eax
+  801155:	0f 88 6b 01 00 00    	js     8012c6 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80115b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  801160:	75 37                	jne    801199 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801162:	e8 28 fa ff ff       	call   800b8f <sys_getenvid>
+  801167:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80116c:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  801172:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801177:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  80117c:	e9 45 01 00 00       	jmp    8012c6 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  801181:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801187:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80118d:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801193:	0f 87 ba 00 00 00    	ja     801253 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  801199:	89 d8                	mov    %ebx,%eax
+  80119b:	c1 e8 16             	shr    $0x16,%eax
+  80119e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8011a5:	a8 01                	test   $0x1,%al
+  8011a7:	74 d8                	je     801181 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8011a9:	89 d8                	mov    %ebx,%eax
+  8011ab:	c1 e8 0c             	shr    $0xc,%eax
+  8011ae:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011b5:	f6 c2 01             	test   $0x1,%dl
+  8011b8:	74 cd                	je     801187 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8011ba:	89 da                	mov    %ebx,%edx
+  8011bc:	80 e6 df             	and    $0xdf,%dh
+  8011bf:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8011c5:	74 c0                	je     801187 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8011c7:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8011c9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011d0:	f6 c6 04             	test   $0x4,%dh
+  8011d3:	75 53                	jne    801228 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8011d5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8011dc:	f6 c6 08             	test   $0x8,%dh
+  8011df:	75 0c                	jne    8011ed <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8011e1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011e8:	f6 c2 02             	test   $0x2,%dl
+  8011eb:	74 3b                	je     801228 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8011ed:	83 ec 0c             	sub    $0xc,%esp
+  8011f0:	68 05 08 00 00       	push   $0x805
+  8011f5:	57                   	push   %edi
+  8011f6:	ff 75 e4             	push   -0x1c(%ebp)
+  8011f9:	57                   	push   %edi
+  8011fa:	6a 00                	push   $0x0
+  8011fc:	e8 1f fa ff ff       	call   800c20 <sys_page_map>
+  801201:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801203:	83 c4 20             	add    $0x20,%esp
+  801206:	85 c0                	test   %eax,%eax
+  801208:	0f 88 a7 00 00 00    	js     8012b5 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80120e:	83 ec 0c             	sub    $0xc,%esp
+  801211:	68 05 08 00 00       	push   $0x805
+  801216:	57                   	push   %edi
+  801217:	6a 00                	push   $0x0
+  801219:	57                   	push   %edi
+  80121a:	6a 00                	push   $0x0
+  80121c:	e8 ff f9 ff ff       	call   800c20 <sys_page_map>
+  801221:	89 c6                	mov    %eax,%esi
+	return r;
+  801223:	83 c4 20             	add    $0x20,%esp
+  801226:	eb 21                	jmp    801249 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  801228:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80122f:	83 ec 0c             	sub    $0xc,%esp
+  801232:	25 07 0e 00 00       	and    $0xe07,%eax
+  801237:	50                   	push   %eax
+  801238:	57                   	push   %edi
+  801239:	ff 75 e4             	push   -0x1c(%ebp)
+  80123c:	57                   	push   %edi
+  80123d:	6a 00                	push   $0x0
+  80123f:	e8 dc f9 ff ff       	call   800c20 <sys_page_map>
+  801244:	89 c6                	mov    %eax,%esi
+  801246:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  801249:	85 f6                	test   %esi,%esi
+  80124b:	0f 89 36 ff ff ff    	jns    801187 <fork+0x57>
+  801251:	eb 62                	jmp    8012b5 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801253:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801258:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  80125d:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801260:	89 f8                	mov    %edi,%eax
+  801262:	e8 6f fd ff ff       	call   800fd6 <copy_page_to>
+  801267:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801269:	85 c0                	test   %eax,%eax
+  80126b:	78 48                	js     8012b5 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80126d:	83 ec 04             	sub    $0x4,%esp
+  801270:	6a 07                	push   $0x7
+  801272:	68 00 f0 bf ee       	push   $0xeebff000
+  801277:	57                   	push   %edi
+  801278:	e8 58 f9 ff ff       	call   800bd5 <sys_page_alloc>
+  80127d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80127f:	83 c4 10             	add    $0x10,%esp
+  801282:	85 c0                	test   %eax,%eax
+  801284:	78 2f                	js     8012b5 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801286:	a1 00 50 80 00       	mov    0x805000,%eax
+  80128b:	8b 40 64             	mov    0x64(%eax),%eax
+  80128e:	83 ec 08             	sub    $0x8,%esp
+  801291:	50                   	push   %eax
+  801292:	57                   	push   %edi
+  801293:	e8 a8 fa ff ff       	call   800d40 <sys_env_set_pgfault_upcall>
+  801298:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80129a:	83 c4 10             	add    $0x10,%esp
+  80129d:	85 c0                	test   %eax,%eax
+  80129f:	78 14                	js     8012b5 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8012a1:	83 ec 08             	sub    $0x8,%esp
+  8012a4:	6a 02                	push   $0x2
+  8012a6:	57                   	push   %edi
+  8012a7:	e8 00 fa ff ff       	call   800cac <sys_env_set_status>
+  8012ac:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8012ae:	83 c4 10             	add    $0x10,%esp
+  8012b1:	85 c0                	test   %eax,%eax
+  8012b3:	79 11                	jns    8012c6 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8012b5:	83 ec 0c             	sub    $0xc,%esp
+  8012b8:	ff 75 e0             	push   -0x20(%ebp)
+  8012bb:	e8 86 f8 ff ff       	call   800b46 <sys_env_destroy>
+	return r;
+  8012c0:	83 c4 10             	add    $0x10,%esp
+  8012c3:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8012c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012cc:	5b                   	pop    %ebx
+  8012cd:	5e                   	pop    %esi
+  8012ce:	5f                   	pop    %edi
+  8012cf:	5d                   	pop    %ebp
+  8012d0:	c3                   	ret
+
+008012d1 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8012d1:	55                   	push   %ebp
+  8012d2:	89 e5                	mov    %esp,%ebp
+  8012d4:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8012d7:	68 0c 3c 80 00       	push   $0x803c0c
+  8012dc:	68 bf 00 00 00       	push   $0xbf
+  8012e1:	68 01 3c 80 00       	push   $0x803c01
+  8012e6:	e8 bb 1f 00 00       	call   8032a6 <_panic>
+
+008012eb <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012eb:	55                   	push   %ebp
+  8012ec:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012f1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012f6:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012f9:	5d                   	pop    %ebp
+  8012fa:	c3                   	ret
+
+008012fb <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012fb:	55                   	push   %ebp
+  8012fc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801301:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801306:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80130b:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801310:	5d                   	pop    %ebp
+  801311:	c3                   	ret
+
+00801312 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801312:	55                   	push   %ebp
+  801313:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801315:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80131a:	eb 02                	jmp    80131e <fd_alloc+0xc>
+  80131c:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80131e:	89 c2                	mov    %eax,%edx
+  801320:	c1 ea 16             	shr    $0x16,%edx
+  801323:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80132a:	f6 c2 01             	test   $0x1,%dl
+  80132d:	74 2b                	je     80135a <fd_alloc+0x48>
+  80132f:	89 c2                	mov    %eax,%edx
+  801331:	c1 ea 0c             	shr    $0xc,%edx
+  801334:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80133b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801341:	f6 c1 01             	test   $0x1,%cl
+  801344:	74 14                	je     80135a <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801346:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80134c:	75 ce                	jne    80131c <fd_alloc+0xa>
+  80134e:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801353:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801358:	eb 05                	jmp    80135f <fd_alloc+0x4d>
+			return 0;
+  80135a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80135f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801362:	89 02                	mov    %eax,(%edx)
+}
+  801364:	89 c8                	mov    %ecx,%eax
+  801366:	5d                   	pop    %ebp
+  801367:	c3                   	ret
+
+00801368 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801368:	55                   	push   %ebp
+  801369:	89 e5                	mov    %esp,%ebp
+  80136b:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80136e:	83 f8 1f             	cmp    $0x1f,%eax
+  801371:	77 30                	ja     8013a3 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801373:	c1 e0 0c             	shl    $0xc,%eax
+  801376:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80137b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801381:	f6 c2 01             	test   $0x1,%dl
+  801384:	74 24                	je     8013aa <fd_lookup+0x42>
+  801386:	89 c2                	mov    %eax,%edx
+  801388:	c1 ea 0c             	shr    $0xc,%edx
+  80138b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801392:	f6 c2 01             	test   $0x1,%dl
+  801395:	74 1a                	je     8013b1 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801397:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80139a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80139c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013a1:	5d                   	pop    %ebp
+  8013a2:	c3                   	ret
+		return -E_INVAL;
+  8013a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013a8:	eb f7                	jmp    8013a1 <fd_lookup+0x39>
+		return -E_INVAL;
+  8013aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013af:	eb f0                	jmp    8013a1 <fd_lookup+0x39>
+  8013b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013b6:	eb e9                	jmp    8013a1 <fd_lookup+0x39>
+
+008013b8 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013b8:	55                   	push   %ebp
+  8013b9:	89 e5                	mov    %esp,%ebp
+  8013bb:	53                   	push   %ebx
+  8013bc:	83 ec 04             	sub    $0x4,%esp
+  8013bf:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c7:	eb 03                	jmp    8013cc <dev_lookup+0x14>
+  8013c9:	83 c0 01             	add    $0x1,%eax
+  8013cc:	8b 1c 85 a0 3c 80 00 	mov    0x803ca0(,%eax,4),%ebx
+  8013d3:	85 db                	test   %ebx,%ebx
+  8013d5:	74 0b                	je     8013e2 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8013d7:	39 13                	cmp    %edx,(%ebx)
+  8013d9:	75 ee                	jne    8013c9 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8013db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e0:	eb 1f                	jmp    801401 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013e2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8013e7:	8b 40 48             	mov    0x48(%eax),%eax
+  8013ea:	83 ec 04             	sub    $0x4,%esp
+  8013ed:	52                   	push   %edx
+  8013ee:	50                   	push   %eax
+  8013ef:	68 24 3c 80 00       	push   $0x803c24
+  8013f4:	e8 e2 ed ff ff       	call   8001db <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8013f9:	83 c4 10             	add    $0x10,%esp
+  8013fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801401:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801404:	89 1a                	mov    %ebx,(%edx)
+}
+  801406:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801409:	c9                   	leave
+  80140a:	c3                   	ret
+
+0080140b <fd_close>:
+{
+  80140b:	55                   	push   %ebp
+  80140c:	89 e5                	mov    %esp,%ebp
+  80140e:	57                   	push   %edi
+  80140f:	56                   	push   %esi
+  801410:	53                   	push   %ebx
+  801411:	83 ec 24             	sub    $0x24,%esp
+  801414:	8b 75 08             	mov    0x8(%ebp),%esi
+  801417:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80141a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80141d:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80141e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801424:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801427:	50                   	push   %eax
+  801428:	e8 3b ff ff ff       	call   801368 <fd_lookup>
+  80142d:	89 c3                	mov    %eax,%ebx
+  80142f:	83 c4 10             	add    $0x10,%esp
+  801432:	85 c0                	test   %eax,%eax
+  801434:	78 05                	js     80143b <fd_close+0x30>
+	    || fd != fd2)
+  801436:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801439:	74 16                	je     801451 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80143b:	89 f8                	mov    %edi,%eax
+  80143d:	84 c0                	test   %al,%al
+  80143f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801444:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801447:	89 d8                	mov    %ebx,%eax
+  801449:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144c:	5b                   	pop    %ebx
+  80144d:	5e                   	pop    %esi
+  80144e:	5f                   	pop    %edi
+  80144f:	5d                   	pop    %ebp
+  801450:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801451:	83 ec 08             	sub    $0x8,%esp
+  801454:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801457:	50                   	push   %eax
+  801458:	ff 36                	push   (%esi)
+  80145a:	e8 59 ff ff ff       	call   8013b8 <dev_lookup>
+  80145f:	89 c3                	mov    %eax,%ebx
+  801461:	83 c4 10             	add    $0x10,%esp
+  801464:	85 c0                	test   %eax,%eax
+  801466:	78 1a                	js     801482 <fd_close+0x77>
+		if (dev->dev_close)
+  801468:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80146b:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80146e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801473:	85 c0                	test   %eax,%eax
+  801475:	74 0b                	je     801482 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801477:	83 ec 0c             	sub    $0xc,%esp
+  80147a:	56                   	push   %esi
+  80147b:	ff d0                	call   *%eax
+  80147d:	89 c3                	mov    %eax,%ebx
+  80147f:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801482:	83 ec 08             	sub    $0x8,%esp
+  801485:	56                   	push   %esi
+  801486:	6a 00                	push   $0x0
+  801488:	e8 d5 f7 ff ff       	call   800c62 <sys_page_unmap>
+	return r;
+  80148d:	83 c4 10             	add    $0x10,%esp
+  801490:	eb b5                	jmp    801447 <fd_close+0x3c>
+
+00801492 <close>:
+
+int
+close(int fdnum)
+{
+  801492:	55                   	push   %ebp
+  801493:	89 e5                	mov    %esp,%ebp
+  801495:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801498:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80149b:	50                   	push   %eax
+  80149c:	ff 75 08             	push   0x8(%ebp)
+  80149f:	e8 c4 fe ff ff       	call   801368 <fd_lookup>
+  8014a4:	83 c4 10             	add    $0x10,%esp
+  8014a7:	85 c0                	test   %eax,%eax
+  8014a9:	79 02                	jns    8014ad <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8014ab:	c9                   	leave
+  8014ac:	c3                   	ret
+		return fd_close(fd, 1);
+  8014ad:	83 ec 08             	sub    $0x8,%esp
+  8014b0:	6a 01                	push   $0x1
+  8014b2:	ff 75 f4             	push   -0xc(%ebp)
+  8014b5:	e8 51 ff ff ff       	call   80140b <fd_close>
+  8014ba:	83 c4 10             	add    $0x10,%esp
+  8014bd:	eb ec                	jmp    8014ab <close+0x19>
+
+008014bf <close_all>:
+
+void
+close_all(void)
+{
+  8014bf:	55                   	push   %ebp
+  8014c0:	89 e5                	mov    %esp,%ebp
+  8014c2:	53                   	push   %ebx
+  8014c3:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8014c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8014cb:	83 ec 0c             	sub    $0xc,%esp
+  8014ce:	53                   	push   %ebx
+  8014cf:	e8 be ff ff ff       	call   801492 <close>
+	for (i = 0; i < MAXFD; i++)
+  8014d4:	83 c3 01             	add    $0x1,%ebx
+  8014d7:	83 c4 10             	add    $0x10,%esp
+  8014da:	83 fb 20             	cmp    $0x20,%ebx
+  8014dd:	75 ec                	jne    8014cb <close_all+0xc>
+}
+  8014df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014e2:	c9                   	leave
+  8014e3:	c3                   	ret
+
+008014e4 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014e4:	55                   	push   %ebp
+  8014e5:	89 e5                	mov    %esp,%ebp
+  8014e7:	57                   	push   %edi
+  8014e8:	56                   	push   %esi
+  8014e9:	53                   	push   %ebx
+  8014ea:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014ed:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014f0:	50                   	push   %eax
+  8014f1:	ff 75 08             	push   0x8(%ebp)
+  8014f4:	e8 6f fe ff ff       	call   801368 <fd_lookup>
+  8014f9:	89 c3                	mov    %eax,%ebx
+  8014fb:	83 c4 10             	add    $0x10,%esp
+  8014fe:	85 c0                	test   %eax,%eax
+  801500:	78 7f                	js     801581 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801502:	83 ec 0c             	sub    $0xc,%esp
+  801505:	ff 75 0c             	push   0xc(%ebp)
+  801508:	e8 85 ff ff ff       	call   801492 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80150d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801510:	c1 e6 0c             	shl    $0xc,%esi
+  801513:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801519:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80151c:	89 3c 24             	mov    %edi,(%esp)
+  80151f:	e8 d7 fd ff ff       	call   8012fb <fd2data>
+  801524:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801526:	89 34 24             	mov    %esi,(%esp)
+  801529:	e8 cd fd ff ff       	call   8012fb <fd2data>
+  80152e:	83 c4 10             	add    $0x10,%esp
+  801531:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801534:	89 d8                	mov    %ebx,%eax
+  801536:	c1 e8 16             	shr    $0x16,%eax
+  801539:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801540:	a8 01                	test   $0x1,%al
+  801542:	74 11                	je     801555 <dup+0x71>
+  801544:	89 d8                	mov    %ebx,%eax
+  801546:	c1 e8 0c             	shr    $0xc,%eax
+  801549:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801550:	f6 c2 01             	test   $0x1,%dl
+  801553:	75 36                	jne    80158b <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801555:	89 f8                	mov    %edi,%eax
+  801557:	c1 e8 0c             	shr    $0xc,%eax
+  80155a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801561:	83 ec 0c             	sub    $0xc,%esp
+  801564:	25 07 0e 00 00       	and    $0xe07,%eax
+  801569:	50                   	push   %eax
+  80156a:	56                   	push   %esi
+  80156b:	6a 00                	push   $0x0
+  80156d:	57                   	push   %edi
+  80156e:	6a 00                	push   $0x0
+  801570:	e8 ab f6 ff ff       	call   800c20 <sys_page_map>
+  801575:	89 c3                	mov    %eax,%ebx
+  801577:	83 c4 20             	add    $0x20,%esp
+  80157a:	85 c0                	test   %eax,%eax
+  80157c:	78 33                	js     8015b1 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80157e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801581:	89 d8                	mov    %ebx,%eax
+  801583:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801586:	5b                   	pop    %ebx
+  801587:	5e                   	pop    %esi
+  801588:	5f                   	pop    %edi
+  801589:	5d                   	pop    %ebp
+  80158a:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80158b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801592:	83 ec 0c             	sub    $0xc,%esp
+  801595:	25 07 0e 00 00       	and    $0xe07,%eax
+  80159a:	50                   	push   %eax
+  80159b:	ff 75 d4             	push   -0x2c(%ebp)
+  80159e:	6a 00                	push   $0x0
+  8015a0:	53                   	push   %ebx
+  8015a1:	6a 00                	push   $0x0
+  8015a3:	e8 78 f6 ff ff       	call   800c20 <sys_page_map>
+  8015a8:	89 c3                	mov    %eax,%ebx
+  8015aa:	83 c4 20             	add    $0x20,%esp
+  8015ad:	85 c0                	test   %eax,%eax
+  8015af:	79 a4                	jns    801555 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8015b1:	83 ec 08             	sub    $0x8,%esp
+  8015b4:	56                   	push   %esi
+  8015b5:	6a 00                	push   $0x0
+  8015b7:	e8 a6 f6 ff ff       	call   800c62 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8015bc:	83 c4 08             	add    $0x8,%esp
+  8015bf:	ff 75 d4             	push   -0x2c(%ebp)
+  8015c2:	6a 00                	push   $0x0
+  8015c4:	e8 99 f6 ff ff       	call   800c62 <sys_page_unmap>
+	return r;
+  8015c9:	83 c4 10             	add    $0x10,%esp
+  8015cc:	eb b3                	jmp    801581 <dup+0x9d>
+
+008015ce <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015ce:	55                   	push   %ebp
+  8015cf:	89 e5                	mov    %esp,%ebp
+  8015d1:	56                   	push   %esi
+  8015d2:	53                   	push   %ebx
+  8015d3:	83 ec 18             	sub    $0x18,%esp
+  8015d6:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015d9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015dc:	50                   	push   %eax
+  8015dd:	56                   	push   %esi
+  8015de:	e8 85 fd ff ff       	call   801368 <fd_lookup>
+  8015e3:	83 c4 10             	add    $0x10,%esp
+  8015e6:	85 c0                	test   %eax,%eax
+  8015e8:	78 3c                	js     801626 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015ea:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8015ed:	83 ec 08             	sub    $0x8,%esp
+  8015f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015f3:	50                   	push   %eax
+  8015f4:	ff 33                	push   (%ebx)
+  8015f6:	e8 bd fd ff ff       	call   8013b8 <dev_lookup>
+  8015fb:	83 c4 10             	add    $0x10,%esp
+  8015fe:	85 c0                	test   %eax,%eax
+  801600:	78 24                	js     801626 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801602:	8b 43 08             	mov    0x8(%ebx),%eax
+  801605:	83 e0 03             	and    $0x3,%eax
+  801608:	83 f8 01             	cmp    $0x1,%eax
+  80160b:	74 20                	je     80162d <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80160d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801610:	8b 40 08             	mov    0x8(%eax),%eax
+  801613:	85 c0                	test   %eax,%eax
+  801615:	74 37                	je     80164e <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801617:	83 ec 04             	sub    $0x4,%esp
+  80161a:	ff 75 10             	push   0x10(%ebp)
+  80161d:	ff 75 0c             	push   0xc(%ebp)
+  801620:	53                   	push   %ebx
+  801621:	ff d0                	call   *%eax
+  801623:	83 c4 10             	add    $0x10,%esp
+}
+  801626:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801629:	5b                   	pop    %ebx
+  80162a:	5e                   	pop    %esi
+  80162b:	5d                   	pop    %ebp
+  80162c:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80162d:	a1 00 50 80 00       	mov    0x805000,%eax
+  801632:	8b 40 48             	mov    0x48(%eax),%eax
+  801635:	83 ec 04             	sub    $0x4,%esp
+  801638:	56                   	push   %esi
+  801639:	50                   	push   %eax
+  80163a:	68 65 3c 80 00       	push   $0x803c65
+  80163f:	e8 97 eb ff ff       	call   8001db <cprintf>
+		return -E_INVAL;
+  801644:	83 c4 10             	add    $0x10,%esp
+  801647:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80164c:	eb d8                	jmp    801626 <read+0x58>
+		return -E_NOT_SUPP;
+  80164e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801653:	eb d1                	jmp    801626 <read+0x58>
+
+00801655 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801655:	55                   	push   %ebp
+  801656:	89 e5                	mov    %esp,%ebp
+  801658:	57                   	push   %edi
+  801659:	56                   	push   %esi
+  80165a:	53                   	push   %ebx
+  80165b:	83 ec 0c             	sub    $0xc,%esp
+  80165e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801661:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801664:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801669:	eb 02                	jmp    80166d <readn+0x18>
+  80166b:	01 c3                	add    %eax,%ebx
+  80166d:	39 f3                	cmp    %esi,%ebx
+  80166f:	73 21                	jae    801692 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801671:	83 ec 04             	sub    $0x4,%esp
+  801674:	89 f0                	mov    %esi,%eax
+  801676:	29 d8                	sub    %ebx,%eax
+  801678:	50                   	push   %eax
+  801679:	89 d8                	mov    %ebx,%eax
+  80167b:	03 45 0c             	add    0xc(%ebp),%eax
+  80167e:	50                   	push   %eax
+  80167f:	57                   	push   %edi
+  801680:	e8 49 ff ff ff       	call   8015ce <read>
+		if (m < 0)
+  801685:	83 c4 10             	add    $0x10,%esp
+  801688:	85 c0                	test   %eax,%eax
+  80168a:	78 04                	js     801690 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80168c:	75 dd                	jne    80166b <readn+0x16>
+  80168e:	eb 02                	jmp    801692 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801690:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801692:	89 d8                	mov    %ebx,%eax
+  801694:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801697:	5b                   	pop    %ebx
+  801698:	5e                   	pop    %esi
+  801699:	5f                   	pop    %edi
+  80169a:	5d                   	pop    %ebp
+  80169b:	c3                   	ret
+
+0080169c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80169c:	55                   	push   %ebp
+  80169d:	89 e5                	mov    %esp,%ebp
+  80169f:	56                   	push   %esi
+  8016a0:	53                   	push   %ebx
+  8016a1:	83 ec 18             	sub    $0x18,%esp
+  8016a4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016a7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016aa:	50                   	push   %eax
+  8016ab:	53                   	push   %ebx
+  8016ac:	e8 b7 fc ff ff       	call   801368 <fd_lookup>
+  8016b1:	83 c4 10             	add    $0x10,%esp
+  8016b4:	85 c0                	test   %eax,%eax
+  8016b6:	78 37                	js     8016ef <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016b8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016bb:	83 ec 08             	sub    $0x8,%esp
+  8016be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016c1:	50                   	push   %eax
+  8016c2:	ff 36                	push   (%esi)
+  8016c4:	e8 ef fc ff ff       	call   8013b8 <dev_lookup>
+  8016c9:	83 c4 10             	add    $0x10,%esp
+  8016cc:	85 c0                	test   %eax,%eax
+  8016ce:	78 1f                	js     8016ef <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016d0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016d4:	74 20                	je     8016f6 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016d9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016dc:	85 c0                	test   %eax,%eax
+  8016de:	74 37                	je     801717 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016e0:	83 ec 04             	sub    $0x4,%esp
+  8016e3:	ff 75 10             	push   0x10(%ebp)
+  8016e6:	ff 75 0c             	push   0xc(%ebp)
+  8016e9:	56                   	push   %esi
+  8016ea:	ff d0                	call   *%eax
+  8016ec:	83 c4 10             	add    $0x10,%esp
+}
+  8016ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016f2:	5b                   	pop    %ebx
+  8016f3:	5e                   	pop    %esi
+  8016f4:	5d                   	pop    %ebp
+  8016f5:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016f6:	a1 00 50 80 00       	mov    0x805000,%eax
+  8016fb:	8b 40 48             	mov    0x48(%eax),%eax
+  8016fe:	83 ec 04             	sub    $0x4,%esp
+  801701:	53                   	push   %ebx
+  801702:	50                   	push   %eax
+  801703:	68 81 3c 80 00       	push   $0x803c81
+  801708:	e8 ce ea ff ff       	call   8001db <cprintf>
+		return -E_INVAL;
+  80170d:	83 c4 10             	add    $0x10,%esp
+  801710:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801715:	eb d8                	jmp    8016ef <write+0x53>
+		return -E_NOT_SUPP;
+  801717:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80171c:	eb d1                	jmp    8016ef <write+0x53>
+
+0080171e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80171e:	55                   	push   %ebp
+  80171f:	89 e5                	mov    %esp,%ebp
+  801721:	53                   	push   %ebx
+  801722:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801725:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801728:	50                   	push   %eax
+  801729:	ff 75 08             	push   0x8(%ebp)
+  80172c:	e8 37 fc ff ff       	call   801368 <fd_lookup>
+  801731:	83 c4 10             	add    $0x10,%esp
+  801734:	85 c0                	test   %eax,%eax
+  801736:	78 3a                	js     801772 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801738:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80173b:	83 ec 08             	sub    $0x8,%esp
+  80173e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801741:	50                   	push   %eax
+  801742:	ff 33                	push   (%ebx)
+  801744:	e8 6f fc ff ff       	call   8013b8 <dev_lookup>
+  801749:	83 c4 10             	add    $0x10,%esp
+  80174c:	85 c0                	test   %eax,%eax
+  80174e:	78 22                	js     801772 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801750:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801753:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801756:	85 c0                	test   %eax,%eax
+  801758:	74 0d                	je     801767 <seek+0x49>
+  80175a:	83 ec 0c             	sub    $0xc,%esp
+  80175d:	53                   	push   %ebx
+  80175e:	ff d0                	call   *%eax
+  801760:	83 c4 10             	add    $0x10,%esp
+  801763:	85 c0                	test   %eax,%eax
+  801765:	78 0b                	js     801772 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801767:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80176a:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  80176d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801772:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801775:	c9                   	leave
+  801776:	c3                   	ret
+
+00801777 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801777:	55                   	push   %ebp
+  801778:	89 e5                	mov    %esp,%ebp
+  80177a:	53                   	push   %ebx
+  80177b:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80177e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801781:	50                   	push   %eax
+  801782:	ff 75 08             	push   0x8(%ebp)
+  801785:	e8 de fb ff ff       	call   801368 <fd_lookup>
+  80178a:	83 c4 10             	add    $0x10,%esp
+  80178d:	85 c0                	test   %eax,%eax
+  80178f:	78 2b                	js     8017bc <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801791:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801794:	83 ec 08             	sub    $0x8,%esp
+  801797:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80179a:	50                   	push   %eax
+  80179b:	ff 33                	push   (%ebx)
+  80179d:	e8 16 fc ff ff       	call   8013b8 <dev_lookup>
+  8017a2:	83 c4 10             	add    $0x10,%esp
+  8017a5:	85 c0                	test   %eax,%eax
+  8017a7:	78 13                	js     8017bc <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8017a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017ac:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	74 0e                	je     8017c1 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8017b3:	83 ec 0c             	sub    $0xc,%esp
+  8017b6:	53                   	push   %ebx
+  8017b7:	ff d0                	call   *%eax
+  8017b9:	83 c4 10             	add    $0x10,%esp
+}
+  8017bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017bf:	c9                   	leave
+  8017c0:	c3                   	ret
+		return 0;
+  8017c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c6:	eb f4                	jmp    8017bc <fsync+0x45>
+
+008017c8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017c8:	55                   	push   %ebp
+  8017c9:	89 e5                	mov    %esp,%ebp
+  8017cb:	56                   	push   %esi
+  8017cc:	53                   	push   %ebx
+  8017cd:	83 ec 18             	sub    $0x18,%esp
+  8017d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017d3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017d6:	50                   	push   %eax
+  8017d7:	53                   	push   %ebx
+  8017d8:	e8 8b fb ff ff       	call   801368 <fd_lookup>
+  8017dd:	83 c4 10             	add    $0x10,%esp
+  8017e0:	85 c0                	test   %eax,%eax
+  8017e2:	78 34                	js     801818 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017e4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017e7:	83 ec 08             	sub    $0x8,%esp
+  8017ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017ed:	50                   	push   %eax
+  8017ee:	ff 36                	push   (%esi)
+  8017f0:	e8 c3 fb ff ff       	call   8013b8 <dev_lookup>
+  8017f5:	83 c4 10             	add    $0x10,%esp
+  8017f8:	85 c0                	test   %eax,%eax
+  8017fa:	78 1c                	js     801818 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017fc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801800:	74 1d                	je     80181f <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801802:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801805:	8b 40 18             	mov    0x18(%eax),%eax
+  801808:	85 c0                	test   %eax,%eax
+  80180a:	74 34                	je     801840 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80180c:	83 ec 08             	sub    $0x8,%esp
+  80180f:	ff 75 0c             	push   0xc(%ebp)
+  801812:	56                   	push   %esi
+  801813:	ff d0                	call   *%eax
+  801815:	83 c4 10             	add    $0x10,%esp
+}
+  801818:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80181b:	5b                   	pop    %ebx
+  80181c:	5e                   	pop    %esi
+  80181d:	5d                   	pop    %ebp
+  80181e:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80181f:	a1 00 50 80 00       	mov    0x805000,%eax
+  801824:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801827:	83 ec 04             	sub    $0x4,%esp
+  80182a:	53                   	push   %ebx
+  80182b:	50                   	push   %eax
+  80182c:	68 44 3c 80 00       	push   $0x803c44
+  801831:	e8 a5 e9 ff ff       	call   8001db <cprintf>
+		return -E_INVAL;
+  801836:	83 c4 10             	add    $0x10,%esp
+  801839:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80183e:	eb d8                	jmp    801818 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801840:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801845:	eb d1                	jmp    801818 <ftruncate+0x50>
+
+00801847 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801847:	55                   	push   %ebp
+  801848:	89 e5                	mov    %esp,%ebp
+  80184a:	56                   	push   %esi
+  80184b:	53                   	push   %ebx
+  80184c:	83 ec 18             	sub    $0x18,%esp
+  80184f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801852:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801855:	50                   	push   %eax
+  801856:	ff 75 08             	push   0x8(%ebp)
+  801859:	e8 0a fb ff ff       	call   801368 <fd_lookup>
+  80185e:	83 c4 10             	add    $0x10,%esp
+  801861:	85 c0                	test   %eax,%eax
+  801863:	78 49                	js     8018ae <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801865:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801868:	83 ec 08             	sub    $0x8,%esp
+  80186b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80186e:	50                   	push   %eax
+  80186f:	ff 36                	push   (%esi)
+  801871:	e8 42 fb ff ff       	call   8013b8 <dev_lookup>
+  801876:	83 c4 10             	add    $0x10,%esp
+  801879:	85 c0                	test   %eax,%eax
+  80187b:	78 31                	js     8018ae <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80187d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801880:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801884:	74 2f                	je     8018b5 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801886:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801889:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801890:	00 00 00 
+	stat->st_isdir = 0;
+  801893:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80189a:	00 00 00 
+	stat->st_dev = dev;
+  80189d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018a3:	83 ec 08             	sub    $0x8,%esp
+  8018a6:	53                   	push   %ebx
+  8018a7:	56                   	push   %esi
+  8018a8:	ff 50 14             	call   *0x14(%eax)
+  8018ab:	83 c4 10             	add    $0x10,%esp
+}
+  8018ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b1:	5b                   	pop    %ebx
+  8018b2:	5e                   	pop    %esi
+  8018b3:	5d                   	pop    %ebp
+  8018b4:	c3                   	ret
+		return -E_NOT_SUPP;
+  8018b5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018ba:	eb f2                	jmp    8018ae <fstat+0x67>
+
+008018bc <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018bc:	55                   	push   %ebp
+  8018bd:	89 e5                	mov    %esp,%ebp
+  8018bf:	56                   	push   %esi
+  8018c0:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  8018c1:	83 ec 08             	sub    $0x8,%esp
+  8018c4:	68 00 10 00 00       	push   $0x1000
+  8018c9:	ff 75 08             	push   0x8(%ebp)
+  8018cc:	e8 b3 07 00 00       	call   802084 <open>
+  8018d1:	89 c3                	mov    %eax,%ebx
+  8018d3:	83 c4 10             	add    $0x10,%esp
+  8018d6:	85 c0                	test   %eax,%eax
+  8018d8:	78 1b                	js     8018f5 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  8018da:	83 ec 08             	sub    $0x8,%esp
+  8018dd:	ff 75 0c             	push   0xc(%ebp)
+  8018e0:	50                   	push   %eax
+  8018e1:	e8 61 ff ff ff       	call   801847 <fstat>
+  8018e6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8018e8:	89 1c 24             	mov    %ebx,(%esp)
+  8018eb:	e8 a2 fb ff ff       	call   801492 <close>
+	return r;
+  8018f0:	83 c4 10             	add    $0x10,%esp
+  8018f3:	89 f3                	mov    %esi,%ebx
+}
+  8018f5:	89 d8                	mov    %ebx,%eax
+  8018f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018fa:	5b                   	pop    %ebx
+  8018fb:	5e                   	pop    %esi
+  8018fc:	5d                   	pop    %ebp
+  8018fd:	c3                   	ret
+
+008018fe <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  8018fe:	55                   	push   %ebp
+  8018ff:	89 e5                	mov    %esp,%ebp
+  801901:	57                   	push   %edi
+  801902:	56                   	push   %esi
+  801903:	53                   	push   %ebx
+  801904:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  80190a:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801910:	89 d6                	mov    %edx,%esi
+  801912:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801918:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  80191b:	89 d3                	mov    %edx,%ebx
+  80191d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801923:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  80192a:	74 1d                	je     801949 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80192c:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801931:	83 c8 07             	or     $0x7,%eax
+  801934:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  80193a:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  80193f:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801945:	01 ce                	add    %ecx,%esi
+  801947:	eb 28                	jmp    801971 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801949:	83 ec 0c             	sub    $0xc,%esp
+  80194c:	6a 01                	push   $0x1
+  80194e:	e8 d6 1b 00 00       	call   803529 <ipc_find_env>
+  801953:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801958:	83 c4 10             	add    $0x10,%esp
+  80195b:	eb cf                	jmp    80192c <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  80195d:	83 c0 01             	add    $0x1,%eax
+  801960:	89 fa                	mov    %edi,%edx
+  801962:	09 da                	or     %ebx,%edx
+  801964:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  80196b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801971:	39 f3                	cmp    %esi,%ebx
+  801973:	72 e8                	jb     80195d <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801975:	83 f8 41             	cmp    $0x41,%eax
+  801978:	77 2f                	ja     8019a9 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  80197a:	50                   	push   %eax
+  80197b:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801981:	50                   	push   %eax
+  801982:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801988:	ff 35 c8 70 80 00    	push   0x8070c8
+  80198e:	e8 48 1b 00 00       	call   8034db <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801993:	83 c4 0c             	add    $0xc,%esp
+  801996:	6a 00                	push   $0x0
+  801998:	6a 00                	push   $0x0
+  80199a:	6a 00                	push   $0x0
+  80199c:	e8 e4 19 00 00       	call   803385 <ipc_recv>
+}
+  8019a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019a4:	5b                   	pop    %ebx
+  8019a5:	5e                   	pop    %esi
+  8019a6:	5f                   	pop    %edi
+  8019a7:	5d                   	pop    %ebp
+  8019a8:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  8019a9:	68 b4 3c 80 00       	push   $0x803cb4
+  8019ae:	68 ec 3b 80 00       	push   $0x803bec
+  8019b3:	6a 40                	push   $0x40
+  8019b5:	68 d0 3c 80 00       	push   $0x803cd0
+  8019ba:	e8 e7 18 00 00       	call   8032a6 <_panic>
+
+008019bf <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  8019bf:	55                   	push   %ebp
+  8019c0:	89 e5                	mov    %esp,%ebp
+  8019c2:	57                   	push   %edi
+  8019c3:	56                   	push   %esi
+  8019c4:	53                   	push   %ebx
+  8019c5:	83 ec 1c             	sub    $0x1c,%esp
+  8019c8:	89 c3                	mov    %eax,%ebx
+  8019ca:	89 d6                	mov    %edx,%esi
+  8019cc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  8019cf:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  8019d5:	89 ca                	mov    %ecx,%edx
+  8019d7:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  8019da:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  8019e1:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8019e4:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  8019eb:	8b 76 0c             	mov    0xc(%esi),%esi
+  8019ee:	89 fb                	mov    %edi,%ebx
+  8019f0:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  8019f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019fa:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801a01:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a04:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801a0b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a0e:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801a15:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801a18:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801a1f:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801a24:	39 c8                	cmp    %ecx,%eax
+  801a26:	74 0d                	je     801a35 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801a28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a30:	5b                   	pop    %ebx
+  801a31:	5e                   	pop    %esi
+  801a32:	5f                   	pop    %edi
+  801a33:	5d                   	pop    %ebp
+  801a34:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a35:	6a 07                	push   $0x7
+  801a37:	68 00 60 80 00       	push   $0x806000
+  801a3c:	6a 0d                	push   $0xd
+  801a3e:	ff 35 c8 70 80 00    	push   0x8070c8
+  801a44:	e8 a7 19 00 00       	call   8033f0 <ipc_send>
+  801a49:	83 c4 10             	add    $0x10,%esp
+  801a4c:	eb da                	jmp    801a28 <fsring_post+0x69>
+
+00801a4e <fsipcv>:
+{
+  801a4e:	55                   	push   %ebp
+  801a4f:	89 e5                	mov    %esp,%ebp
+  801a51:	57                   	push   %edi
+  801a52:	56                   	push   %esi
+  801a53:	53                   	push   %ebx
+  801a54:	83 ec 0c             	sub    $0xc,%esp
+  801a57:	89 c7                	mov    %eax,%edi
+  801a59:	89 d3                	mov    %edx,%ebx
+  801a5b:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801a5d:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801a64:	74 26                	je     801a8c <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a66:	6a 07                	push   $0x7
+  801a68:	68 00 60 80 00       	push   $0x806000
+  801a6d:	57                   	push   %edi
+  801a6e:	ff 35 c8 70 80 00    	push   0x8070c8
+  801a74:	e8 77 19 00 00       	call   8033f0 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801a79:	6a 00                	push   $0x0
+  801a7b:	56                   	push   %esi
+  801a7c:	53                   	push   %ebx
+  801a7d:	6a 00                	push   $0x0
+  801a7f:	e8 c4 19 00 00       	call   803448 <ipc_recvv>
+}
+  801a84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a87:	5b                   	pop    %ebx
+  801a88:	5e                   	pop    %esi
+  801a89:	5f                   	pop    %edi
+  801a8a:	5d                   	pop    %ebp
+  801a8b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a8c:	83 ec 0c             	sub    $0xc,%esp
+  801a8f:	6a 01                	push   $0x1
+  801a91:	e8 93 1a 00 00       	call   803529 <ipc_find_env>
+  801a96:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801a9b:	83 c4 10             	add    $0x10,%esp
+  801a9e:	eb c6                	jmp    801a66 <fsipcv+0x18>
+
+00801aa0 <fsipc>:
+{
+  801aa0:	55                   	push   %ebp
+  801aa1:	89 e5                	mov    %esp,%ebp
+  801aa3:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801aa6:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801aad:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801ab0:	e8 99 ff ff ff       	call   801a4e <fsipcv>
+}
+  801ab5:	c9                   	leave
+  801ab6:	c3                   	ret
+
+00801ab7 <file_write_direct>:
+{
+  801ab7:	55                   	push   %ebp
+  801ab8:	89 e5                	mov    %esp,%ebp
+  801aba:	56                   	push   %esi
+  801abb:	53                   	push   %ebx
+  801abc:	89 c3                	mov    %eax,%ebx
+  801abe:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801ac0:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801ac6:	77 40                	ja     801b08 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801ac8:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801acd:	39 c8                	cmp    %ecx,%eax
+  801acf:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ad2:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801ad5:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  801adb:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801ae0:	83 ec 04             	sub    $0x4,%esp
+  801ae3:	50                   	push   %eax
+  801ae4:	52                   	push   %edx
+  801ae5:	68 08 60 80 00       	push   $0x806008
+  801aea:	e8 60 ee ff ff       	call   80094f <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801aef:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af4:	b8 04 00 00 00       	mov    $0x4,%eax
+  801af9:	e8 a2 ff ff ff       	call   801aa0 <fsipc>
+  801afe:	83 c4 10             	add    $0x10,%esp
+}
+  801b01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b04:	5b                   	pop    %ebx
+  801b05:	5e                   	pop    %esi
+  801b06:	5d                   	pop    %ebp
+  801b07:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801b08:	89 d6                	mov    %edx,%esi
+  801b0a:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801b10:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b15:	29 f1                	sub    %esi,%ecx
+  801b17:	39 c1                	cmp    %eax,%ecx
+  801b19:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801b1c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b1f:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801b24:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801b2a:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801b30:	83 ec 0c             	sub    $0xc,%esp
+  801b33:	6a 05                	push   $0x5
+  801b35:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801b3a:	e8 bf fd ff ff       	call   8018fe <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801b3f:	83 c4 10             	add    $0x10,%esp
+  801b42:	eb bd                	jmp    801b01 <file_write_direct+0x4a>
+
+00801b44 <devfile_sync>:
+{
+  801b44:	55                   	push   %ebp
+  801b45:	89 e5                	mov    %esp,%ebp
+  801b47:	57                   	push   %edi
+  801b48:	56                   	push   %esi
+  801b49:	53                   	push   %ebx
+  801b4a:	83 ec 28             	sub    $0x28,%esp
+  801b4d:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801b50:	56                   	push   %esi
+  801b51:	e8 a5 f7 ff ff       	call   8012fb <fd2data>
+  801b56:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801b58:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801b5b:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801b62:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801b65:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801b6a:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801b6e:	74 45                	je     801bb5 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801b70:	8b 46 14             	mov    0x14(%esi),%eax
+  801b73:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801b76:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b80:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801b83:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801b86:	39 cb                	cmp    %ecx,%ebx
+  801b88:	73 14                	jae    801b9e <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801b8a:	29 d9                	sub    %ebx,%ecx
+  801b8c:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801b8f:	89 f0                	mov    %esi,%eax
+  801b91:	e8 21 ff ff ff       	call   801ab7 <file_write_direct>
+  801b96:	85 c0                	test   %eax,%eax
+  801b98:	7e 04                	jle    801b9e <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801b9a:	01 c3                	add    %eax,%ebx
+  801b9c:	eb e5                	jmp    801b83 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801b9e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801ba1:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801ba8:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801bab:	85 c0                	test   %eax,%eax
+  801bad:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb2:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801bb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bb8:	5b                   	pop    %ebx
+  801bb9:	5e                   	pop    %esi
+  801bba:	5f                   	pop    %edi
+  801bbb:	5d                   	pop    %ebp
+  801bbc:	c3                   	ret
+
+00801bbd <devfile_write>:
+{
+  801bbd:	55                   	push   %ebp
+  801bbe:	89 e5                	mov    %esp,%ebp
+  801bc0:	57                   	push   %edi
+  801bc1:	56                   	push   %esi
+  801bc2:	53                   	push   %ebx
+  801bc3:	83 ec 28             	sub    $0x28,%esp
+  801bc6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801bc9:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801bcc:	53                   	push   %ebx
+  801bcd:	e8 29 f7 ff ff       	call   8012fb <fd2data>
+  801bd2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801bd5:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801bd8:	83 c4 10             	add    $0x10,%esp
+  801bdb:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801bdf:	74 43                	je     801c24 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801be1:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801be8:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801beb:	85 c0                	test   %eax,%eax
+  801bed:	74 43                	je     801c32 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801bef:	89 c2                	mov    %eax,%edx
+  801bf1:	03 53 14             	add    0x14(%ebx),%edx
+  801bf4:	39 fa                	cmp    %edi,%edx
+  801bf6:	75 0b                	jne    801c03 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801bf8:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801bfb:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801c01:	76 66                	jbe    801c69 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801c03:	83 ec 0c             	sub    $0xc,%esp
+  801c06:	53                   	push   %ebx
+  801c07:	e8 38 ff ff ff       	call   801b44 <devfile_sync>
+  801c0c:	83 c4 10             	add    $0x10,%esp
+  801c0f:	85 c0                	test   %eax,%eax
+  801c11:	78 4e                	js     801c61 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801c13:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801c19:	77 56                	ja     801c71 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801c1b:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801c1e:	85 c0                	test   %eax,%eax
+  801c20:	75 20                	jne    801c42 <devfile_write+0x85>
+  801c22:	eb 16                	jmp    801c3a <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801c24:	89 f1                	mov    %esi,%ecx
+  801c26:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c29:	89 d8                	mov    %ebx,%eax
+  801c2b:	e8 87 fe ff ff       	call   801ab7 <file_write_direct>
+  801c30:	eb 2f                	jmp    801c61 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801c32:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801c38:	77 37                	ja     801c71 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801c3a:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801c42:	83 ec 04             	sub    $0x4,%esp
+  801c45:	56                   	push   %esi
+  801c46:	ff 75 0c             	push   0xc(%ebp)
+  801c49:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801c4c:	01 c1                	add    %eax,%ecx
+  801c4e:	51                   	push   %ecx
+  801c4f:	e8 fb ec ff ff       	call   80094f <memmove>
+	ff->buf_wlen += n;
+  801c54:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801c57:	01 f7                	add    %esi,%edi
+  801c59:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801c5c:	89 f0                	mov    %esi,%eax
+  801c5e:	83 c4 10             	add    $0x10,%esp
+}
+  801c61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c64:	5b                   	pop    %ebx
+  801c65:	5e                   	pop    %esi
+  801c66:	5f                   	pop    %edi
+  801c67:	5d                   	pop    %ebp
+  801c68:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801c69:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801c6f:	76 d1                	jbe    801c42 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801c71:	89 f1                	mov    %esi,%ecx
+  801c73:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c76:	89 d8                	mov    %ebx,%eax
+  801c78:	e8 3a fe ff ff       	call   801ab7 <file_write_direct>
+  801c7d:	eb e2                	jmp    801c61 <devfile_write+0xa4>
+
+00801c7f <devfile_trunc>:
+{
+  801c7f:	55                   	push   %ebp
+  801c80:	89 e5                	mov    %esp,%ebp
+  801c82:	53                   	push   %ebx
+  801c83:	83 ec 10             	sub    $0x10,%esp
+  801c86:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801c89:	53                   	push   %ebx
+  801c8a:	e8 b5 fe ff ff       	call   801b44 <devfile_sync>
+  801c8f:	83 c4 10             	add    $0x10,%esp
+  801c92:	85 c0                	test   %eax,%eax
+  801c94:	78 1f                	js     801cb5 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801c96:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c99:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801c9e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ca1:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ca6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cab:	b8 02 00 00 00       	mov    $0x2,%eax
+  801cb0:	e8 eb fd ff ff       	call   801aa0 <fsipc>
+}
+  801cb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cb8:	c9                   	leave
+  801cb9:	c3                   	ret
+
+00801cba <devfile_stat>:
+{
+  801cba:	55                   	push   %ebp
+  801cbb:	89 e5                	mov    %esp,%ebp
+  801cbd:	56                   	push   %esi
+  801cbe:	53                   	push   %ebx
+  801cbf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801cc2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801cc5:	83 ec 0c             	sub    $0xc,%esp
+  801cc8:	53                   	push   %ebx
+  801cc9:	e8 76 fe ff ff       	call   801b44 <devfile_sync>
+  801cce:	83 c4 10             	add    $0x10,%esp
+  801cd1:	85 c0                	test   %eax,%eax
+  801cd3:	78 47                	js     801d1c <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801cd5:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801cd8:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801cdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce2:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ce7:	e8 b4 fd ff ff       	call   801aa0 <fsipc>
+  801cec:	85 c0                	test   %eax,%eax
+  801cee:	78 2c                	js     801d1c <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801cf0:	83 ec 08             	sub    $0x8,%esp
+  801cf3:	68 00 60 80 00       	push   $0x806000
+  801cf8:	56                   	push   %esi
+  801cf9:	e8 cb ea ff ff       	call   8007c9 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801cfe:	a1 80 60 80 00       	mov    0x806080,%eax
+  801d03:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d09:	a1 84 60 80 00       	mov    0x806084,%eax
+  801d0e:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801d14:	83 c4 10             	add    $0x10,%esp
+  801d17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d1f:	5b                   	pop    %ebx
+  801d20:	5e                   	pop    %esi
+  801d21:	5d                   	pop    %ebp
+  801d22:	c3                   	ret
+
+00801d23 <devfile_flush>:
+{
+  801d23:	55                   	push   %ebp
+  801d24:	89 e5                	mov    %esp,%ebp
+  801d26:	56                   	push   %esi
+  801d27:	53                   	push   %ebx
+  801d28:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801d2b:	83 ec 0c             	sub    $0xc,%esp
+  801d2e:	56                   	push   %esi
+  801d2f:	e8 10 fe ff ff       	call   801b44 <devfile_sync>
+  801d34:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801d36:	83 c4 10             	add    $0x10,%esp
+  801d39:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801d3d:	75 25                	jne    801d64 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d3f:	8b 46 0c             	mov    0xc(%esi),%eax
+  801d42:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801d47:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d4c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d51:	e8 4a fd ff ff       	call   801aa0 <fsipc>
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801d5b:	89 d8                	mov    %ebx,%eax
+  801d5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d60:	5b                   	pop    %ebx
+  801d61:	5e                   	pop    %esi
+  801d62:	5d                   	pop    %ebp
+  801d63:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801d64:	83 ec 0c             	sub    $0xc,%esp
+  801d67:	56                   	push   %esi
+  801d68:	e8 8e f5 ff ff       	call   8012fb <fd2data>
+  801d6d:	83 c4 08             	add    $0x8,%esp
+  801d70:	50                   	push   %eax
+  801d71:	6a 00                	push   $0x0
+  801d73:	e8 ea ee ff ff       	call   800c62 <sys_page_unmap>
+  801d78:	83 c4 10             	add    $0x10,%esp
+  801d7b:	eb c2                	jmp    801d3f <devfile_flush+0x1c>
+
+00801d7d <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801d7d:	55                   	push   %ebp
+  801d7e:	89 e5                	mov    %esp,%ebp
+  801d80:	57                   	push   %edi
+  801d81:	56                   	push   %esi
+  801d82:	53                   	push   %ebx
+  801d83:	83 ec 64             	sub    $0x64,%esp
+  801d86:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801d88:	52                   	push   %edx
+  801d89:	50                   	push   %eax
+  801d8a:	e8 d9 f5 ff ff       	call   801368 <fd_lookup>
+  801d8f:	89 c1                	mov    %eax,%ecx
+  801d91:	83 c4 10             	add    $0x10,%esp
+  801d94:	85 c0                	test   %eax,%eax
+  801d96:	0f 88 f2 00 00 00    	js     801e8e <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801d9c:	8b 07                	mov    (%edi),%eax
+  801d9e:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801da4:	39 10                	cmp    %edx,(%eax)
+  801da6:	0f 85 03 01 00 00    	jne    801eaf <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801dac:	a1 00 50 80 00       	mov    0x805000,%eax
+  801db1:	8b 40 48             	mov    0x48(%eax),%eax
+  801db4:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801dba:	0f 84 96 00 00 00    	je     801e56 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801dc0:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801dc7:	0f 84 cb 00 00 00    	je     801e98 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801dcd:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801dd2:	83 c8 07             	or     $0x7,%eax
+  801dd5:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801dd8:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801ddb:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801de0:	83 ec 04             	sub    $0x4,%esp
+  801de3:	68 07 04 00 00       	push   $0x407
+  801de8:	53                   	push   %ebx
+  801de9:	6a 00                	push   $0x0
+  801deb:	e8 e5 ed ff ff       	call   800bd5 <sys_page_alloc>
+  801df0:	89 c1                	mov    %eax,%ecx
+  801df2:	83 c4 10             	add    $0x10,%esp
+  801df5:	85 c0                	test   %eax,%eax
+  801df7:	0f 88 91 00 00 00    	js     801e8e <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801dfd:	89 d8                	mov    %ebx,%eax
+  801dff:	83 c8 07             	or     $0x7,%eax
+  801e02:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801e04:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e0a:	83 c6 04             	add    $0x4,%esi
+  801e0d:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801e13:	75 cb                	jne    801de0 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801e15:	6a 12                	push   $0x12
+  801e17:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801e1a:	50                   	push   %eax
+  801e1b:	6a 0c                	push   $0xc
+  801e1d:	ff 35 c8 70 80 00    	push   0x8070c8
+  801e23:	e8 b3 16 00 00       	call   8034db <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801e28:	83 c4 0c             	add    $0xc,%esp
+  801e2b:	6a 00                	push   $0x0
+  801e2d:	6a 00                	push   $0x0
+  801e2f:	6a 00                	push   $0x0
+  801e31:	e8 4f 15 00 00       	call   803385 <ipc_recv>
+  801e36:	89 c1                	mov    %eax,%ecx
+  801e38:	83 c4 10             	add    $0x10,%esp
+  801e3b:	85 c0                	test   %eax,%eax
+  801e3d:	78 4f                	js     801e8e <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801e3f:	a1 00 50 80 00       	mov    0x805000,%eax
+  801e44:	8b 40 48             	mov    0x48(%eax),%eax
+  801e47:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801e4c:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801e53:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801e56:	83 ec 0c             	sub    $0xc,%esp
+  801e59:	ff 37                	push   (%edi)
+  801e5b:	e8 e4 fc ff ff       	call   801b44 <devfile_sync>
+  801e60:	89 c1                	mov    %eax,%ecx
+  801e62:	83 c4 10             	add    $0x10,%esp
+  801e65:	85 c0                	test   %eax,%eax
+  801e67:	78 25                	js     801e8e <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801e69:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801e6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801e74:	ba 01 00 00 00       	mov    $0x1,%edx
+  801e79:	89 d0                	mov    %edx,%eax
+  801e7b:	d3 e0                	shl    %cl,%eax
+  801e7d:	85 d8                	test   %ebx,%eax
+  801e7f:	74 0d                	je     801e8e <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801e81:	83 c1 01             	add    $0x1,%ecx
+  801e84:	83 f9 10             	cmp    $0x10,%ecx
+  801e87:	75 f0                	jne    801e79 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801e89:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801e8e:	89 c8                	mov    %ecx,%eax
+  801e90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e93:	5b                   	pop    %ebx
+  801e94:	5e                   	pop    %esi
+  801e95:	5f                   	pop    %edi
+  801e96:	5d                   	pop    %ebp
+  801e97:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e98:	83 ec 0c             	sub    $0xc,%esp
+  801e9b:	6a 01                	push   $0x1
+  801e9d:	e8 87 16 00 00       	call   803529 <ipc_find_env>
+  801ea2:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801ea7:	83 c4 10             	add    $0x10,%esp
+  801eaa:	e9 1e ff ff ff       	jmp    801dcd <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801eaf:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801eb4:	eb d8                	jmp    801e8e <fsring_slot+0x111>
+
+00801eb6 <file_read_direct>:
+{
+  801eb6:	55                   	push   %ebp
+  801eb7:	89 e5                	mov    %esp,%ebp
+  801eb9:	57                   	push   %edi
+  801eba:	56                   	push   %esi
+  801ebb:	53                   	push   %ebx
+  801ebc:	83 ec 1c             	sub    $0x1c,%esp
+  801ebf:	89 c7                	mov    %eax,%edi
+  801ec1:	89 d6                	mov    %edx,%esi
+  801ec3:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801ec5:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801ecb:	77 52                	ja     801f1f <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ecd:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ed0:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801ed5:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801edb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee0:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ee5:	e8 b6 fb ff ff       	call   801aa0 <fsipc>
+  801eea:	89 c7                	mov    %eax,%edi
+  801eec:	85 c0                	test   %eax,%eax
+  801eee:	78 25                	js     801f15 <file_read_direct+0x5f>
+	assert(r <= n);
+  801ef0:	39 c3                	cmp    %eax,%ebx
+  801ef2:	0f 82 87 00 00 00    	jb     801f7f <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801ef8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801efd:	0f 8f 95 00 00 00    	jg     801f98 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f03:	83 ec 04             	sub    $0x4,%esp
+  801f06:	50                   	push   %eax
+  801f07:	68 00 60 80 00       	push   $0x806000
+  801f0c:	56                   	push   %esi
+  801f0d:	e8 3d ea ff ff       	call   80094f <memmove>
+	return r;
+  801f12:	83 c4 10             	add    $0x10,%esp
+}
+  801f15:	89 f8                	mov    %edi,%eax
+  801f17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f1a:	5b                   	pop    %ebx
+  801f1b:	5e                   	pop    %esi
+  801f1c:	5f                   	pop    %edi
+  801f1d:	5d                   	pop    %ebp
+  801f1e:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801f1f:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801f25:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801f2a:	29 d1                	sub    %edx,%ecx
+  801f2c:	39 d9                	cmp    %ebx,%ecx
+  801f2e:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801f31:	89 f0                	mov    %esi,%eax
+  801f33:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801f36:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801f39:	eb 0f                	jmp    801f4a <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801f3b:	0f b6 10             	movzbl (%eax),%edx
+  801f3e:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801f40:	05 00 10 00 00       	add    $0x1000,%eax
+  801f45:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f4a:	39 c8                	cmp    %ecx,%eax
+  801f4c:	72 ed                	jb     801f3b <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801f4e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f51:	8b 47 0c             	mov    0xc(%edi),%eax
+  801f54:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801f59:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801f5f:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801f65:	83 ec 0c             	sub    $0xc,%esp
+  801f68:	6a 07                	push   $0x7
+  801f6a:	89 d9                	mov    %ebx,%ecx
+  801f6c:	89 f2                	mov    %esi,%edx
+  801f6e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f73:	e8 86 f9 ff ff       	call   8018fe <fsipc_pages>
+  801f78:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801f7a:	83 c4 10             	add    $0x10,%esp
+  801f7d:	eb 96                	jmp    801f15 <file_read_direct+0x5f>
+	assert(r <= n);
+  801f7f:	68 db 3c 80 00       	push   $0x803cdb
+  801f84:	68 ec 3b 80 00       	push   $0x803bec
+  801f89:	68 dc 00 00 00       	push   $0xdc
+  801f8e:	68 d0 3c 80 00       	push   $0x803cd0
+  801f93:	e8 0e 13 00 00       	call   8032a6 <_panic>
+	assert(r <= PGSIZE);
+  801f98:	68 ec 3c 80 00       	push   $0x803cec
+  801f9d:	68 ec 3b 80 00       	push   $0x803bec
+  801fa2:	68 dd 00 00 00       	push   $0xdd
+  801fa7:	68 d0 3c 80 00       	push   $0x803cd0
+  801fac:	e8 f5 12 00 00       	call   8032a6 <_panic>
+
+00801fb1 <devfile_read>:
+{
+  801fb1:	55                   	push   %ebp
+  801fb2:	89 e5                	mov    %esp,%ebp
+  801fb4:	57                   	push   %edi
+  801fb5:	56                   	push   %esi
+  801fb6:	53                   	push   %ebx
+  801fb7:	83 ec 28             	sub    $0x28,%esp
+  801fba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801fbd:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801fc0:	53                   	push   %ebx
+  801fc1:	e8 35 f3 ff ff       	call   8012fb <fd2data>
+  801fc6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801fc9:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801fcc:	83 c4 10             	add    $0x10,%esp
+  801fcf:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801fd3:	74 7d                	je     802052 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801fd5:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801fd9:	0f 85 81 00 00 00    	jne    802060 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801fdf:	8b 43 18             	mov    0x18(%ebx),%eax
+  801fe2:	85 c0                	test   %eax,%eax
+  801fe4:	74 0d                	je     801ff3 <devfile_read+0x42>
+  801fe6:	8b 53 14             	mov    0x14(%ebx),%edx
+  801fe9:	39 fa                	cmp    %edi,%edx
+  801feb:	7f 06                	jg     801ff3 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801fed:	01 c2                	add    %eax,%edx
+  801fef:	39 d7                	cmp    %edx,%edi
+  801ff1:	72 28                	jb     80201b <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801ff3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801ffa:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802000:	77 74                	ja     802076 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  802002:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802007:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80200a:	89 d8                	mov    %ebx,%eax
+  80200c:	e8 a5 fe ff ff       	call   801eb6 <file_read_direct>
+  802011:	85 c0                	test   %eax,%eax
+  802013:	7e 35                	jle    80204a <devfile_read+0x99>
+		ff->buf_base = pos;
+  802015:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  802018:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  80201b:	8b 53 14             	mov    0x14(%ebx),%edx
+  80201e:	89 d0                	mov    %edx,%eax
+  802020:	03 43 18             	add    0x18(%ebx),%eax
+  802023:	29 f8                	sub    %edi,%eax
+  802025:	39 f0                	cmp    %esi,%eax
+  802027:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  80202a:	83 ec 04             	sub    $0x4,%esp
+  80202d:	56                   	push   %esi
+  80202e:	89 f8                	mov    %edi,%eax
+  802030:	29 d0                	sub    %edx,%eax
+  802032:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802035:	01 c1                	add    %eax,%ecx
+  802037:	51                   	push   %ecx
+  802038:	ff 75 0c             	push   0xc(%ebp)
+  80203b:	e8 0f e9 ff ff       	call   80094f <memmove>
+	fd->fd_offset = pos + n;
+  802040:	01 f7                	add    %esi,%edi
+  802042:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802045:	89 f0                	mov    %esi,%eax
+  802047:	83 c4 10             	add    $0x10,%esp
+}
+  80204a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80204d:	5b                   	pop    %ebx
+  80204e:	5e                   	pop    %esi
+  80204f:	5f                   	pop    %edi
+  802050:	5d                   	pop    %ebp
+  802051:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802052:	89 f1                	mov    %esi,%ecx
+  802054:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802057:	89 d8                	mov    %ebx,%eax
+  802059:	e8 58 fe ff ff       	call   801eb6 <file_read_direct>
+  80205e:	eb ea                	jmp    80204a <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802060:	83 ec 0c             	sub    $0xc,%esp
+  802063:	53                   	push   %ebx
+  802064:	e8 db fa ff ff       	call   801b44 <devfile_sync>
+  802069:	83 c4 10             	add    $0x10,%esp
+  80206c:	85 c0                	test   %eax,%eax
+  80206e:	0f 89 6b ff ff ff    	jns    801fdf <devfile_read+0x2e>
+  802074:	eb d4                	jmp    80204a <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  802076:	89 f1                	mov    %esi,%ecx
+  802078:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80207b:	89 d8                	mov    %ebx,%eax
+  80207d:	e8 34 fe ff ff       	call   801eb6 <file_read_direct>
+  802082:	eb c6                	jmp    80204a <devfile_read+0x99>
+
+00802084 <open>:
+{
+  802084:	55                   	push   %ebp
+  802085:	89 e5                	mov    %esp,%ebp
+  802087:	56                   	push   %esi
+  802088:	53                   	push   %ebx
+  802089:	83 ec 1c             	sub    $0x1c,%esp
+  80208c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80208f:	56                   	push   %esi
+  802090:	e8 f9 e6 ff ff       	call   80078e <strlen>
+  802095:	83 c4 10             	add    $0x10,%esp
+  802098:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80209d:	0f 8f a0 00 00 00    	jg     802143 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  8020a3:	83 ec 0c             	sub    $0xc,%esp
+  8020a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020a9:	50                   	push   %eax
+  8020aa:	e8 63 f2 ff ff       	call   801312 <fd_alloc>
+  8020af:	89 c3                	mov    %eax,%ebx
+  8020b1:	83 c4 10             	add    $0x10,%esp
+  8020b4:	85 c0                	test   %eax,%eax
+  8020b6:	78 45                	js     8020fd <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  8020b8:	83 ec 08             	sub    $0x8,%esp
+  8020bb:	56                   	push   %esi
+  8020bc:	68 00 60 80 00       	push   $0x806000
+  8020c1:	e8 03 e7 ff ff       	call   8007c9 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8020c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020c9:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020ce:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020d6:	e8 c5 f9 ff ff       	call   801aa0 <fsipc>
+  8020db:	89 c3                	mov    %eax,%ebx
+  8020dd:	83 c4 10             	add    $0x10,%esp
+  8020e0:	85 c0                	test   %eax,%eax
+  8020e2:	78 22                	js     802106 <open+0x82>
+	if (!(mode & O_NOBUF)
+  8020e4:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8020eb:	74 2b                	je     802118 <open+0x94>
+	return fd2num(fd);
+  8020ed:	83 ec 0c             	sub    $0xc,%esp
+  8020f0:	ff 75 f4             	push   -0xc(%ebp)
+  8020f3:	e8 f3 f1 ff ff       	call   8012eb <fd2num>
+  8020f8:	89 c3                	mov    %eax,%ebx
+  8020fa:	83 c4 10             	add    $0x10,%esp
+}
+  8020fd:	89 d8                	mov    %ebx,%eax
+  8020ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802102:	5b                   	pop    %ebx
+  802103:	5e                   	pop    %esi
+  802104:	5d                   	pop    %ebp
+  802105:	c3                   	ret
+		fd_close(fd, 0);
+  802106:	83 ec 08             	sub    $0x8,%esp
+  802109:	6a 00                	push   $0x0
+  80210b:	ff 75 f4             	push   -0xc(%ebp)
+  80210e:	e8 f8 f2 ff ff       	call   80140b <fd_close>
+		return r;
+  802113:	83 c4 10             	add    $0x10,%esp
+  802116:	eb e5                	jmp    8020fd <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  802118:	83 ec 0c             	sub    $0xc,%esp
+  80211b:	ff 75 f4             	push   -0xc(%ebp)
+  80211e:	e8 d8 f1 ff ff       	call   8012fb <fd2data>
+  802123:	83 c4 0c             	add    $0xc,%esp
+  802126:	68 07 04 00 00       	push   $0x407
+  80212b:	50                   	push   %eax
+  80212c:	6a 00                	push   $0x0
+  80212e:	e8 a2 ea ff ff       	call   800bd5 <sys_page_alloc>
+  802133:	83 c4 10             	add    $0x10,%esp
+  802136:	85 c0                	test   %eax,%eax
+  802138:	75 b3                	jne    8020ed <open+0x69>
+		fd->fd_file.buffered = 1;
+  80213a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80213d:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802141:	eb aa                	jmp    8020ed <open+0x69>
+		return -E_BAD_PATH;
+  802143:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802148:	eb b3                	jmp    8020fd <open+0x79>
+
+0080214a <readdir>:
+{
+  80214a:	55                   	push   %ebp
+  80214b:	89 e5                	mov    %esp,%ebp
+  80214d:	53                   	push   %ebx
+  80214e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802151:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802154:	50                   	push   %eax
+  802155:	ff 75 08             	push   0x8(%ebp)
+  802158:	e8 0b f2 ff ff       	call   801368 <fd_lookup>
+  80215d:	89 c3                	mov    %eax,%ebx
+  80215f:	83 c4 10             	add    $0x10,%esp
+  802162:	85 c0                	test   %eax,%eax
+  802164:	78 73                	js     8021d9 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802166:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802169:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80216f:	39 08                	cmp    %ecx,(%eax)
+  802171:	0f 85 82 00 00 00    	jne    8021f9 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802177:	83 ec 0c             	sub    $0xc,%esp
+  80217a:	50                   	push   %eax
+  80217b:	e8 c4 f9 ff ff       	call   801b44 <devfile_sync>
+  802180:	89 c3                	mov    %eax,%ebx
+  802182:	83 c4 10             	add    $0x10,%esp
+  802185:	85 c0                	test   %eax,%eax
+  802187:	78 50                	js     8021d9 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802189:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80218c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80218f:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  802194:	8b 45 10             	mov    0x10(%ebp),%eax
+  802197:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  80219c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80219f:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  8021a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8021ae:	e8 ed f8 ff ff       	call   801aa0 <fsipc>
+  8021b3:	89 c3                	mov    %eax,%ebx
+  8021b5:	85 c0                	test   %eax,%eax
+  8021b7:	7e 20                	jle    8021d9 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  8021b9:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8021bc:	72 22                	jb     8021e0 <readdir+0x96>
+  8021be:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8021c3:	7f 1b                	jg     8021e0 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8021c5:	83 ec 04             	sub    $0x4,%esp
+  8021c8:	50                   	push   %eax
+  8021c9:	68 00 60 80 00       	push   $0x806000
+  8021ce:	ff 75 0c             	push   0xc(%ebp)
+  8021d1:	e8 79 e7 ff ff       	call   80094f <memmove>
+	return r;
+  8021d6:	83 c4 10             	add    $0x10,%esp
+}
+  8021d9:	89 d8                	mov    %ebx,%eax
+  8021db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021de:	c9                   	leave
+  8021df:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8021e0:	68 e2 3c 80 00       	push   $0x803ce2
+  8021e5:	68 ec 3b 80 00       	push   $0x803bec
+  8021ea:	68 86 01 00 00       	push   $0x186
+  8021ef:	68 d0 3c 80 00       	push   $0x803cd0
+  8021f4:	e8 ad 10 00 00       	call   8032a6 <_panic>
+		return -E_NOT_SUPP;
+  8021f9:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8021fe:	eb d9                	jmp    8021d9 <readdir+0x8f>
+
+00802200 <munmap>:
+{
+  802200:	55                   	push   %ebp
+  802201:	89 e5                	mov    %esp,%ebp
+  802203:	56                   	push   %esi
+  802204:	53                   	push   %ebx
+  802205:	8b 75 08             	mov    0x8(%ebp),%esi
+  802208:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80220b:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  802211:	75 41                	jne    802254 <munmap+0x54>
+  802213:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  802219:	77 39                	ja     802254 <munmap+0x54>
+  80221b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802220:	29 f0                	sub    %esi,%eax
+  802222:	39 d0                	cmp    %edx,%eax
+  802224:	72 35                	jb     80225b <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802226:	89 f3                	mov    %esi,%ebx
+  802228:	01 d6                	add    %edx,%esi
+  80222a:	39 f3                	cmp    %esi,%ebx
+  80222c:	73 1a                	jae    802248 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  80222e:	83 ec 08             	sub    $0x8,%esp
+  802231:	53                   	push   %ebx
+  802232:	6a 00                	push   $0x0
+  802234:	e8 29 ea ff ff       	call   800c62 <sys_page_unmap>
+  802239:	83 c4 10             	add    $0x10,%esp
+  80223c:	85 c0                	test   %eax,%eax
+  80223e:	78 0d                	js     80224d <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802240:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802246:	eb e2                	jmp    80222a <munmap+0x2a>
+	return 0;
+  802248:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80224d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802250:	5b                   	pop    %ebx
+  802251:	5e                   	pop    %esi
+  802252:	5d                   	pop    %ebp
+  802253:	c3                   	ret
+		return -E_INVAL;
+  802254:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802259:	eb f2                	jmp    80224d <munmap+0x4d>
+  80225b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802260:	eb eb                	jmp    80224d <munmap+0x4d>
+
+00802262 <mmap>:
+{
+  802262:	55                   	push   %ebp
+  802263:	89 e5                	mov    %esp,%ebp
+  802265:	57                   	push   %edi
+  802266:	56                   	push   %esi
+  802267:	53                   	push   %ebx
+  802268:	83 ec 34             	sub    $0x34,%esp
+  80226b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80226e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802271:	50                   	push   %eax
+  802272:	ff 75 18             	push   0x18(%ebp)
+  802275:	e8 ee f0 ff ff       	call   801368 <fd_lookup>
+  80227a:	89 c3                	mov    %eax,%ebx
+  80227c:	83 c4 10             	add    $0x10,%esp
+  80227f:	85 c0                	test   %eax,%eax
+  802281:	0f 88 0e 01 00 00    	js     802395 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802287:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80228a:	a1 20 40 80 00       	mov    0x804020,%eax
+  80228f:	39 02                	cmp    %eax,(%edx)
+  802291:	0f 85 50 01 00 00    	jne    8023e7 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802297:	8b 45 10             	mov    0x10(%ebp),%eax
+  80229a:	83 e0 02             	and    $0x2,%eax
+  80229d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8022a0:	74 0a                	je     8022ac <mmap+0x4a>
+  8022a2:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8022a6:	0f 84 42 01 00 00    	je     8023ee <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  8022ac:	8b 42 08             	mov    0x8(%edx),%eax
+  8022af:	83 e0 03             	and    $0x3,%eax
+  8022b2:	83 f8 01             	cmp    $0x1,%eax
+  8022b5:	0f 84 3a 01 00 00    	je     8023f5 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8022bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022be:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8022c1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8022c6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8022c9:	0f 85 2d 01 00 00    	jne    8023fc <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8022cf:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8022d3:	0f 88 2a 01 00 00    	js     802403 <mmap+0x1a1>
+  8022d9:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8022e0:	0f 87 1d 01 00 00    	ja     802403 <mmap+0x1a1>
+  8022e6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8022eb:	2b 45 08             	sub    0x8(%ebp),%eax
+  8022ee:	39 f8                	cmp    %edi,%eax
+  8022f0:	0f 82 14 01 00 00    	jb     80240a <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8022f6:	83 ec 0c             	sub    $0xc,%esp
+  8022f9:	52                   	push   %edx
+  8022fa:	e8 45 f8 ff ff       	call   801b44 <devfile_sync>
+  8022ff:	89 c3                	mov    %eax,%ebx
+  802301:	83 c4 10             	add    $0x10,%esp
+  802304:	85 c0                	test   %eax,%eax
+  802306:	0f 88 89 00 00 00    	js     802395 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  80230c:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802312:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802318:	be 00 00 00 00       	mov    $0x0,%esi
+  80231d:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802320:	39 fe                	cmp    %edi,%esi
+  802322:	73 7b                	jae    80239f <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  802324:	89 f8                	mov    %edi,%eax
+  802326:	29 f0                	sub    %esi,%eax
+  802328:	c1 e8 0c             	shr    $0xc,%eax
+  80232b:	ba 40 00 00 00       	mov    $0x40,%edx
+  802330:	39 d0                	cmp    %edx,%eax
+  802332:	0f 47 c2             	cmova  %edx,%eax
+  802335:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802338:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80233b:	8b 52 0c             	mov    0xc(%edx),%edx
+  80233e:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  802344:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802347:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  80234d:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802352:	89 f2                	mov    %esi,%edx
+  802354:	03 55 08             	add    0x8(%ebp),%edx
+  802357:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80235a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80235f:	e8 ea f6 ff ff       	call   801a4e <fsipcv>
+  802364:	85 c0                	test   %eax,%eax
+  802366:	7e 12                	jle    80237a <mmap+0x118>
+  802368:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80236b:	85 c0                	test   %eax,%eax
+  80236d:	0f 84 9e 00 00 00    	je     802411 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802373:	c1 e0 0c             	shl    $0xc,%eax
+  802376:	01 c6                	add    %eax,%esi
+  802378:	eb a6                	jmp    802320 <mmap+0xbe>
+			munmap(addr, done);
+  80237a:	89 c3                	mov    %eax,%ebx
+  80237c:	83 ec 08             	sub    $0x8,%esp
+  80237f:	56                   	push   %esi
+  802380:	ff 75 08             	push   0x8(%ebp)
+  802383:	e8 78 fe ff ff       	call   802200 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802388:	83 c4 10             	add    $0x10,%esp
+  80238b:	85 db                	test   %ebx,%ebx
+  80238d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802392:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802395:	89 d8                	mov    %ebx,%eax
+  802397:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80239a:	5b                   	pop    %ebx
+  80239b:	5e                   	pop    %esi
+  80239c:	5f                   	pop    %edi
+  80239d:	5d                   	pop    %ebp
+  80239e:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80239f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8023a2:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8023a4:	85 c0                	test   %eax,%eax
+  8023a6:	74 ed                	je     802395 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8023a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8023b0:	39 fe                	cmp    %edi,%esi
+  8023b2:	73 2e                	jae    8023e2 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8023b4:	83 ec 0c             	sub    $0xc,%esp
+  8023b7:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8023ba:	50                   	push   %eax
+  8023bb:	e8 2d ed ff ff       	call   8010ed <cowpage>
+  8023c0:	83 c4 10             	add    $0x10,%esp
+  8023c3:	85 c0                	test   %eax,%eax
+  8023c5:	78 08                	js     8023cf <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8023c7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8023cd:	eb e1                	jmp    8023b0 <mmap+0x14e>
+				munmap(addr, len);
+  8023cf:	89 c3                	mov    %eax,%ebx
+  8023d1:	83 ec 08             	sub    $0x8,%esp
+  8023d4:	57                   	push   %edi
+  8023d5:	ff 75 08             	push   0x8(%ebp)
+  8023d8:	e8 23 fe ff ff       	call   802200 <munmap>
+				return r;
+  8023dd:	83 c4 10             	add    $0x10,%esp
+  8023e0:	eb b3                	jmp    802395 <mmap+0x133>
+	return 0;
+  8023e2:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8023e5:	eb ae                	jmp    802395 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8023e7:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8023ec:	eb a7                	jmp    802395 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8023ee:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8023f3:	eb a0                	jmp    802395 <mmap+0x133>
+		return -E_INVAL;
+  8023f5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023fa:	eb 99                	jmp    802395 <mmap+0x133>
+  8023fc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802401:	eb 92                	jmp    802395 <mmap+0x133>
+  802403:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802408:	eb 8b                	jmp    802395 <mmap+0x133>
+  80240a:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80240f:	eb 84                	jmp    802395 <mmap+0x133>
+			munmap(addr, done);
+  802411:	83 ec 08             	sub    $0x8,%esp
+  802414:	56                   	push   %esi
+  802415:	ff 75 08             	push   0x8(%ebp)
+  802418:	e8 e3 fd ff ff       	call   802200 <munmap>
+  80241d:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802420:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802425:	e9 6b ff ff ff       	jmp    802395 <mmap+0x133>
+
+0080242a <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80242a:	55                   	push   %ebp
+  80242b:	89 e5                	mov    %esp,%ebp
+  80242d:	56                   	push   %esi
+  80242e:	53                   	push   %ebx
+  80242f:	83 ec 10             	sub    $0x10,%esp
+  802432:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802435:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802438:	8b 45 08             	mov    0x8(%ebp),%eax
+  80243b:	e8 3d f9 ff ff       	call   801d7d <fsring_slot>
+  802440:	85 c0                	test   %eax,%eax
+  802442:	78 60                	js     8024a4 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802444:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802447:	8b 56 08             	mov    0x8(%esi),%edx
+  80244a:	83 e2 03             	and    $0x3,%edx
+  80244d:	83 fa 01             	cmp    $0x1,%edx
+  802450:	74 59                	je     8024ab <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802452:	ba 01 00 00 00       	mov    $0x1,%edx
+  802457:	89 c1                	mov    %eax,%ecx
+  802459:	d3 e2                	shl    %cl,%edx
+  80245b:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802461:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802464:	c1 e2 02             	shl    $0x2,%edx
+  802467:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  80246d:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  802474:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802477:	8b 55 18             	mov    0x18(%ebp),%edx
+  80247a:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80247d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802480:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802483:	83 ec 08             	sub    $0x8,%esp
+  802486:	50                   	push   %eax
+  802487:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80248c:	39 c3                	cmp    %eax,%ebx
+  80248e:	0f 47 d8             	cmova  %eax,%ebx
+  802491:	53                   	push   %ebx
+  802492:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802495:	89 f2                	mov    %esi,%edx
+  802497:	b8 03 00 00 00       	mov    $0x3,%eax
+  80249c:	e8 1e f5 ff ff       	call   8019bf <fsring_post>
+  8024a1:	83 c4 10             	add    $0x10,%esp
+}
+  8024a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024a7:	5b                   	pop    %ebx
+  8024a8:	5e                   	pop    %esi
+  8024a9:	5d                   	pop    %ebp
+  8024aa:	c3                   	ret
+		return -E_INVAL;
+  8024ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024b0:	eb f2                	jmp    8024a4 <fsring_read+0x7a>
+
+008024b2 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8024b2:	55                   	push   %ebp
+  8024b3:	89 e5                	mov    %esp,%ebp
+  8024b5:	56                   	push   %esi
+  8024b6:	53                   	push   %ebx
+  8024b7:	83 ec 10             	sub    $0x10,%esp
+  8024ba:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8024bd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8024c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024c3:	e8 b5 f8 ff ff       	call   801d7d <fsring_slot>
+  8024c8:	89 c3                	mov    %eax,%ebx
+  8024ca:	85 c0                	test   %eax,%eax
+  8024cc:	78 77                	js     802545 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8024ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024d1:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8024d5:	74 77                	je     80254e <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8024d7:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8024dc:	39 c6                	cmp    %eax,%esi
+  8024de:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8024e1:	83 ec 04             	sub    $0x4,%esp
+  8024e4:	56                   	push   %esi
+  8024e5:	ff 75 0c             	push   0xc(%ebp)
+  8024e8:	89 d8                	mov    %ebx,%eax
+  8024ea:	c1 e0 0c             	shl    $0xc,%eax
+  8024ed:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8024f3:	50                   	push   %eax
+  8024f4:	e8 56 e4 ff ff       	call   80094f <memmove>
+	fsring_busy |= 1 << slot;
+  8024f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024fe:	89 d9                	mov    %ebx,%ecx
+  802500:	d3 e0                	shl    %cl,%eax
+  802502:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802508:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80250b:	c1 e0 02             	shl    $0x2,%eax
+  80250e:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  802514:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  80251b:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80251e:	8b 45 18             	mov    0x18(%ebp),%eax
+  802521:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  802524:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  80252b:	83 c4 08             	add    $0x8,%esp
+  80252e:	53                   	push   %ebx
+  80252f:	56                   	push   %esi
+  802530:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802533:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802536:	b8 04 00 00 00       	mov    $0x4,%eax
+  80253b:	e8 7f f4 ff ff       	call   8019bf <fsring_post>
+  802540:	89 c3                	mov    %eax,%ebx
+  802542:	83 c4 10             	add    $0x10,%esp
+}
+  802545:	89 d8                	mov    %ebx,%eax
+  802547:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80254a:	5b                   	pop    %ebx
+  80254b:	5e                   	pop    %esi
+  80254c:	5d                   	pop    %ebp
+  80254d:	c3                   	ret
+		return -E_INVAL;
+  80254e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802553:	eb f0                	jmp    802545 <fsring_write+0x93>
+
+00802555 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802555:	55                   	push   %ebp
+  802556:	89 e5                	mov    %esp,%ebp
+  802558:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80255b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80255e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802561:	e8 17 f8 ff ff       	call   801d7d <fsring_slot>
+  802566:	85 c0                	test   %eax,%eax
+  802568:	78 4c                	js     8025b6 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  80256a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80256f:	89 c1                	mov    %eax,%ecx
+  802571:	d3 e2                	shl    %cl,%edx
+  802573:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802579:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80257c:	c1 e2 02             	shl    $0x2,%edx
+  80257f:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  802585:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  80258c:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80258f:	8b 55 10             	mov    0x10(%ebp),%edx
+  802592:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802595:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802598:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80259b:	83 ec 08             	sub    $0x8,%esp
+  80259e:	50                   	push   %eax
+  80259f:	6a 00                	push   $0x0
+  8025a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025a6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025a9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8025ae:	e8 0c f4 ff ff       	call   8019bf <fsring_post>
+  8025b3:	83 c4 10             	add    $0x10,%esp
+}
+  8025b6:	c9                   	leave
+  8025b7:	c3                   	ret
+
+008025b8 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8025b8:	55                   	push   %ebp
+  8025b9:	89 e5                	mov    %esp,%ebp
+  8025bb:	57                   	push   %edi
+  8025bc:	56                   	push   %esi
+  8025bd:	53                   	push   %ebx
+  8025be:	83 ec 1c             	sub    $0x1c,%esp
+  8025c1:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8025c5:	a1 00 50 80 00       	mov    0x805000,%eax
+  8025ca:	8b 40 48             	mov    0x48(%eax),%eax
+  8025cd:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  8025d3:	74 12                	je     8025e7 <fsring_reap+0x2f>
+		return 0;
+  8025d5:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8025da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025dd:	5b                   	pop    %ebx
+  8025de:	5e                   	pop    %esi
+  8025df:	5f                   	pop    %edi
+  8025e0:	5d                   	pop    %ebp
+  8025e1:	c3                   	ret
+		sys_yield();
+  8025e2:	e8 cf e5 ff ff       	call   800bb6 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8025e7:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8025ed:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8025f2:	39 c2                	cmp    %eax,%edx
+  8025f4:	75 18                	jne    80260e <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8025f6:	84 db                	test   %bl,%bl
+  8025f8:	0f 84 21 01 00 00    	je     80271f <fsring_reap+0x167>
+  8025fe:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  802605:	75 db                	jne    8025e2 <fsring_reap+0x2a>
+			return 0;
+  802607:	b8 00 00 00 00       	mov    $0x0,%eax
+  80260c:	eb cc                	jmp    8025da <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  80260e:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802613:	83 e0 0f             	and    $0xf,%eax
+  802616:	83 c0 2a             	add    $0x2a,%eax
+  802619:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802620:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802627:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80262c:	83 c0 01             	add    $0x1,%eax
+  80262f:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802634:	83 fb 0f             	cmp    $0xf,%ebx
+  802637:	77 5b                	ja     802694 <fsring_reap+0xdc>
+  802639:	be 01 00 00 00       	mov    $0x1,%esi
+  80263e:	89 d9                	mov    %ebx,%ecx
+  802640:	d3 e6                	shl    %cl,%esi
+  802642:	89 f0                	mov    %esi,%eax
+  802644:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  80264a:	74 48                	je     802694 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  80264c:	89 d8                	mov    %ebx,%eax
+  80264e:	c1 e0 0c             	shl    $0xc,%eax
+  802651:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802657:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  80265a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80265d:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  802664:	83 f8 03             	cmp    $0x3,%eax
+  802667:	74 40                	je     8026a9 <fsring_reap+0xf1>
+  802669:	83 f8 05             	cmp    $0x5,%eax
+  80266c:	74 64                	je     8026d2 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  80266e:	f7 d6                	not    %esi
+  802670:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802676:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802679:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  802680:	8b 45 08             	mov    0x8(%ebp),%eax
+  802683:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802685:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802688:	89 38                	mov    %edi,(%eax)
+	return 1;
+  80268a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80268f:	e9 46 ff ff ff       	jmp    8025da <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802694:	53                   	push   %ebx
+  802695:	68 f8 3c 80 00       	push   $0x803cf8
+  80269a:	68 8f 02 00 00       	push   $0x28f
+  80269f:	68 d0 3c 80 00       	push   $0x803cd0
+  8026a4:	e8 fd 0b 00 00       	call   8032a6 <_panic>
+		if (cqe.cqe_result > 0)
+  8026a9:	85 ff                	test   %edi,%edi
+  8026ab:	7e c1                	jle    80266e <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8026ad:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8026b0:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8026b5:	39 c7                	cmp    %eax,%edi
+  8026b7:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8026ba:	50                   	push   %eax
+  8026bb:	ff 75 e4             	push   -0x1c(%ebp)
+  8026be:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8026c1:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  8026c8:	e8 82 e2 ff ff       	call   80094f <memmove>
+  8026cd:	83 c4 10             	add    $0x10,%esp
+  8026d0:	eb 9c                	jmp    80266e <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8026d2:	85 ff                	test   %edi,%edi
+  8026d4:	75 98                	jne    80266e <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  8026d6:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8026d9:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8026e0:	83 ec 08             	sub    $0x8,%esp
+  8026e3:	ff 75 e4             	push   -0x1c(%ebp)
+  8026e6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8026e9:	51                   	push   %ecx
+  8026ea:	e8 da e0 ff ff       	call   8007c9 <strcpy>
+			st->st_size = ret->ret_size;
+  8026ef:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8026f2:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8026f8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8026fb:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802701:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802707:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  80270d:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  802714:	40 80 00 
+  802717:	83 c4 10             	add    $0x10,%esp
+  80271a:	e9 4f ff ff ff       	jmp    80266e <fsring_reap+0xb6>
+			return 0;
+  80271f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802724:	e9 b1 fe ff ff       	jmp    8025da <fsring_reap+0x22>
+
+00802729 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802729:	55                   	push   %ebp
+  80272a:	89 e5                	mov    %esp,%ebp
+  80272c:	57                   	push   %edi
+  80272d:	56                   	push   %esi
+  80272e:	53                   	push   %ebx
+  80272f:	83 ec 28             	sub    $0x28,%esp
+  802732:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802735:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802738:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80273b:	53                   	push   %ebx
+  80273c:	e8 4d e0 ff ff       	call   80078e <strlen>
+  802741:	83 c4 10             	add    $0x10,%esp
+  802744:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802749:	0f 8f 02 01 00 00    	jg     802851 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  80274f:	83 ec 08             	sub    $0x8,%esp
+  802752:	53                   	push   %ebx
+  802753:	68 00 60 80 00       	push   $0x806000
+  802758:	e8 6c e0 ff ff       	call   8007c9 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  80275d:	83 c4 10             	add    $0x10,%esp
+  802760:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802766:	76 69                	jbe    8027d1 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802768:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80276b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802771:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802776:	29 d1                	sub    %edx,%ecx
+  802778:	39 f9                	cmp    %edi,%ecx
+  80277a:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80277d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802780:	89 f9                	mov    %edi,%ecx
+  802782:	01 c1                	add    %eax,%ecx
+  802784:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802787:	eb 0f                	jmp    802798 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802789:	0f b6 10             	movzbl (%eax),%edx
+  80278c:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80278e:	05 00 10 00 00       	add    $0x1000,%eax
+  802793:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802798:	39 c8                	cmp    %ecx,%eax
+  80279a:	72 ed                	jb     802789 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  80279c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80279f:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  8027a5:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8027ab:	83 ec 0c             	sub    $0xc,%esp
+  8027ae:	6a 07                	push   $0x7
+  8027b0:	89 f9                	mov    %edi,%ecx
+  8027b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027b5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8027ba:	e8 3f f1 ff ff       	call   8018fe <fsipc_pages>
+  8027bf:	89 c7                	mov    %eax,%edi
+  8027c1:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8027c4:	85 f6                	test   %esi,%esi
+  8027c6:	74 7f                	je     802847 <file_slurp+0x11e>
+  8027c8:	8d 43 01             	lea    0x1(%ebx),%eax
+  8027cb:	85 ff                	test   %edi,%edi
+  8027cd:	79 3c                	jns    80280b <file_slurp+0xe2>
+  8027cf:	eb 76                	jmp    802847 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8027d1:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8027d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027dc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8027e1:	e8 ba f2 ff ff       	call   801aa0 <fsipc>
+  8027e6:	89 c7                	mov    %eax,%edi
+  8027e8:	85 c0                	test   %eax,%eax
+  8027ea:	7e d8                	jle    8027c4 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8027ec:	83 ec 04             	sub    $0x4,%esp
+  8027ef:	50                   	push   %eax
+  8027f0:	68 08 60 80 00       	push   $0x806008
+  8027f5:	ff 75 0c             	push   0xc(%ebp)
+  8027f8:	e8 52 e1 ff ff       	call   80094f <memmove>
+  8027fd:	83 c4 10             	add    $0x10,%esp
+  802800:	eb c2                	jmp    8027c4 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802802:	80 fa 2f             	cmp    $0x2f,%dl
+  802805:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802808:	83 c0 01             	add    $0x1,%eax
+  80280b:	89 c1                	mov    %eax,%ecx
+  80280d:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802811:	84 d2                	test   %dl,%dl
+  802813:	75 ed                	jne    802802 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802815:	83 ec 04             	sub    $0x4,%esp
+  802818:	68 80 00 00 00       	push   $0x80
+  80281d:	53                   	push   %ebx
+  80281e:	56                   	push   %esi
+  80281f:	e8 1b e0 ff ff       	call   80083f <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802824:	a1 00 60 80 00       	mov    0x806000,%eax
+  802829:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  80282f:	a1 04 60 80 00       	mov    0x806004,%eax
+  802834:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  80283a:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  802841:	40 80 00 
+  802844:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802847:	89 f8                	mov    %edi,%eax
+  802849:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80284c:	5b                   	pop    %ebx
+  80284d:	5e                   	pop    %esi
+  80284e:	5f                   	pop    %edi
+  80284f:	5d                   	pop    %ebp
+  802850:	c3                   	ret
+		return -E_BAD_PATH;
+  802851:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802856:	eb ef                	jmp    802847 <file_slurp+0x11e>
+
+00802858 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802858:	55                   	push   %ebp
+  802859:	89 e5                	mov    %esp,%ebp
+  80285b:	53                   	push   %ebx
+  80285c:	83 ec 10             	sub    $0x10,%esp
+  80285f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802862:	53                   	push   %ebx
+  802863:	e8 26 df ff ff       	call   80078e <strlen>
+  802868:	83 c4 10             	add    $0x10,%esp
+  80286b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802870:	7f 25                	jg     802897 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802872:	83 ec 08             	sub    $0x8,%esp
+  802875:	53                   	push   %ebx
+  802876:	68 00 60 80 00       	push   $0x806000
+  80287b:	e8 49 df ff ff       	call   8007c9 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802880:	ba 00 00 00 00       	mov    $0x0,%edx
+  802885:	b8 07 00 00 00       	mov    $0x7,%eax
+  80288a:	e8 11 f2 ff ff       	call   801aa0 <fsipc>
+  80288f:	83 c4 10             	add    $0x10,%esp
+}
+  802892:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802895:	c9                   	leave
+  802896:	c3                   	ret
+		return -E_BAD_PATH;
+  802897:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80289c:	eb f4                	jmp    802892 <remove+0x3a>
+
+0080289e <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80289e:	55                   	push   %ebp
+  80289f:	89 e5                	mov    %esp,%ebp
+  8028a1:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8028a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028a9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8028ae:	e8 ed f1 ff ff       	call   801aa0 <fsipc>
+}
+  8028b3:	c9                   	leave
+  8028b4:	c3                   	ret
+
+008028b5 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  8028b5:	55                   	push   %ebp
+  8028b6:	89 e5                	mov    %esp,%ebp
+  8028b8:	57                   	push   %edi
+  8028b9:	56                   	push   %esi
+  8028ba:	53                   	push   %ebx
+  8028bb:	83 ec 18             	sub    $0x18,%esp
+  8028be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8028c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8028c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8028c7:	57                   	push   %edi
+  8028c8:	e8 c1 de ff ff       	call   80078e <strlen>
+  8028cd:	83 c4 10             	add    $0x10,%esp
+  8028d0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8028d5:	7f 4c                	jg     802923 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  8028d7:	83 ec 08             	sub    $0x8,%esp
+  8028da:	57                   	push   %edi
+  8028db:	68 00 60 80 00       	push   $0x806000
+  8028e0:	e8 e4 de ff ff       	call   8007c9 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  8028e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ea:	b8 10 00 00 00       	mov    $0x10,%eax
+  8028ef:	e8 ac f1 ff ff       	call   801aa0 <fsipc>
+  8028f4:	83 c4 10             	add    $0x10,%esp
+  8028f7:	85 c0                	test   %eax,%eax
+  8028f9:	78 20                	js     80291b <defrag+0x66>
+		return r;
+	if (before)
+  8028fb:	85 f6                	test   %esi,%esi
+  8028fd:	74 07                	je     802906 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  8028ff:	a1 00 60 80 00       	mov    0x806000,%eax
+  802904:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802906:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  80290b:	85 db                	test   %ebx,%ebx
+  80290d:	74 0c                	je     80291b <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  80290f:	a1 04 60 80 00       	mov    0x806004,%eax
+  802914:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802916:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80291b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80291e:	5b                   	pop    %ebx
+  80291f:	5e                   	pop    %esi
+  802920:	5f                   	pop    %edi
+  802921:	5d                   	pop    %ebp
+  802922:	c3                   	ret
+		return -E_BAD_PATH;
+  802923:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802928:	eb f1                	jmp    80291b <defrag+0x66>
+
+0080292a <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  80292a:	55                   	push   %ebp
+  80292b:	89 e5                	mov    %esp,%ebp
+  80292d:	53                   	push   %ebx
+  80292e:	83 ec 04             	sub    $0x4,%esp
+  802931:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802934:	ba 00 00 00 00       	mov    $0x0,%edx
+  802939:	b8 11 00 00 00       	mov    $0x11,%eax
+  80293e:	e8 5d f1 ff ff       	call   801aa0 <fsipc>
+  802943:	85 c0                	test   %eax,%eax
+  802945:	78 34                	js     80297b <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802947:	a1 00 60 80 00       	mov    0x806000,%eax
+  80294c:	89 03                	mov    %eax,(%ebx)
+  80294e:	a1 04 60 80 00       	mov    0x806004,%eax
+  802953:	89 43 04             	mov    %eax,0x4(%ebx)
+  802956:	a1 08 60 80 00       	mov    0x806008,%eax
+  80295b:	89 43 08             	mov    %eax,0x8(%ebx)
+  80295e:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  802963:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802966:	a1 10 60 80 00       	mov    0x806010,%eax
+  80296b:	89 43 10             	mov    %eax,0x10(%ebx)
+  80296e:	a1 14 60 80 00       	mov    0x806014,%eax
+  802973:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802976:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80297b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80297e:	c9                   	leave
+  80297f:	c3                   	ret
+
+00802980 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802980:	55                   	push   %ebp
+  802981:	89 e5                	mov    %esp,%ebp
+  802983:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802986:	68 11 3d 80 00       	push   $0x803d11
+  80298b:	ff 75 0c             	push   0xc(%ebp)
+  80298e:	e8 36 de ff ff       	call   8007c9 <strcpy>
+	return 0;
+}
+  802993:	b8 00 00 00 00       	mov    $0x0,%eax
+  802998:	c9                   	leave
+  802999:	c3                   	ret
+
+0080299a <devsock_close>:
+{
+  80299a:	55                   	push   %ebp
+  80299b:	89 e5                	mov    %esp,%ebp
+  80299d:	53                   	push   %ebx
+  80299e:	83 ec 10             	sub    $0x10,%esp
+  8029a1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8029a4:	53                   	push   %ebx
+  8029a5:	e8 be 0b 00 00       	call   803568 <pageref>
+  8029aa:	89 c2                	mov    %eax,%edx
+  8029ac:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8029af:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8029b4:	83 fa 01             	cmp    $0x1,%edx
+  8029b7:	74 05                	je     8029be <devsock_close+0x24>
+}
+  8029b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029bc:	c9                   	leave
+  8029bd:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8029be:	83 ec 0c             	sub    $0xc,%esp
+  8029c1:	ff 73 0c             	push   0xc(%ebx)
+  8029c4:	e8 b7 02 00 00       	call   802c80 <nsipc_close>
+  8029c9:	83 c4 10             	add    $0x10,%esp
+  8029cc:	eb eb                	jmp    8029b9 <devsock_close+0x1f>
+
+008029ce <devsock_write>:
+{
+  8029ce:	55                   	push   %ebp
+  8029cf:	89 e5                	mov    %esp,%ebp
+  8029d1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8029d4:	6a 00                	push   $0x0
+  8029d6:	ff 75 10             	push   0x10(%ebp)
+  8029d9:	ff 75 0c             	push   0xc(%ebp)
+  8029dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029df:	ff 70 0c             	push   0xc(%eax)
+  8029e2:	e8 79 03 00 00       	call   802d60 <nsipc_send>
+}
+  8029e7:	c9                   	leave
+  8029e8:	c3                   	ret
+
+008029e9 <devsock_read>:
+{
+  8029e9:	55                   	push   %ebp
+  8029ea:	89 e5                	mov    %esp,%ebp
+  8029ec:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8029ef:	6a 00                	push   $0x0
+  8029f1:	ff 75 10             	push   0x10(%ebp)
+  8029f4:	ff 75 0c             	push   0xc(%ebp)
+  8029f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029fa:	ff 70 0c             	push   0xc(%eax)
+  8029fd:	e8 ef 02 00 00       	call   802cf1 <nsipc_recv>
+}
+  802a02:	c9                   	leave
+  802a03:	c3                   	ret
+
+00802a04 <fd2sockid>:
+{
+  802a04:	55                   	push   %ebp
+  802a05:	89 e5                	mov    %esp,%ebp
+  802a07:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802a0a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a0d:	52                   	push   %edx
+  802a0e:	50                   	push   %eax
+  802a0f:	e8 54 e9 ff ff       	call   801368 <fd_lookup>
+  802a14:	83 c4 10             	add    $0x10,%esp
+  802a17:	85 c0                	test   %eax,%eax
+  802a19:	78 10                	js     802a2b <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802a1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a1e:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  802a24:	39 08                	cmp    %ecx,(%eax)
+  802a26:	75 05                	jne    802a2d <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802a28:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802a2b:	c9                   	leave
+  802a2c:	c3                   	ret
+		return -E_NOT_SUPP;
+  802a2d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a32:	eb f7                	jmp    802a2b <fd2sockid+0x27>
+
+00802a34 <alloc_sockfd>:
+{
+  802a34:	55                   	push   %ebp
+  802a35:	89 e5                	mov    %esp,%ebp
+  802a37:	56                   	push   %esi
+  802a38:	53                   	push   %ebx
+  802a39:	83 ec 1c             	sub    $0x1c,%esp
+  802a3c:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802a3e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a41:	50                   	push   %eax
+  802a42:	e8 cb e8 ff ff       	call   801312 <fd_alloc>
+  802a47:	89 c3                	mov    %eax,%ebx
+  802a49:	83 c4 10             	add    $0x10,%esp
+  802a4c:	85 c0                	test   %eax,%eax
+  802a4e:	78 43                	js     802a93 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802a50:	83 ec 04             	sub    $0x4,%esp
+  802a53:	68 07 04 00 00       	push   $0x407
+  802a58:	ff 75 f4             	push   -0xc(%ebp)
+  802a5b:	6a 00                	push   $0x0
+  802a5d:	e8 73 e1 ff ff       	call   800bd5 <sys_page_alloc>
+  802a62:	89 c3                	mov    %eax,%ebx
+  802a64:	83 c4 10             	add    $0x10,%esp
+  802a67:	85 c0                	test   %eax,%eax
+  802a69:	78 28                	js     802a93 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802a6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a6e:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802a74:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802a76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a79:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802a80:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802a83:	83 ec 0c             	sub    $0xc,%esp
+  802a86:	50                   	push   %eax
+  802a87:	e8 5f e8 ff ff       	call   8012eb <fd2num>
+  802a8c:	89 c3                	mov    %eax,%ebx
+  802a8e:	83 c4 10             	add    $0x10,%esp
+  802a91:	eb 0c                	jmp    802a9f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802a93:	83 ec 0c             	sub    $0xc,%esp
+  802a96:	56                   	push   %esi
+  802a97:	e8 e4 01 00 00       	call   802c80 <nsipc_close>
+		return r;
+  802a9c:	83 c4 10             	add    $0x10,%esp
+}
+  802a9f:	89 d8                	mov    %ebx,%eax
+  802aa1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802aa4:	5b                   	pop    %ebx
+  802aa5:	5e                   	pop    %esi
+  802aa6:	5d                   	pop    %ebp
+  802aa7:	c3                   	ret
+
+00802aa8 <accept>:
+{
+  802aa8:	55                   	push   %ebp
+  802aa9:	89 e5                	mov    %esp,%ebp
+  802aab:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802aae:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ab1:	e8 4e ff ff ff       	call   802a04 <fd2sockid>
+  802ab6:	85 c0                	test   %eax,%eax
+  802ab8:	78 1b                	js     802ad5 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802aba:	83 ec 04             	sub    $0x4,%esp
+  802abd:	ff 75 10             	push   0x10(%ebp)
+  802ac0:	ff 75 0c             	push   0xc(%ebp)
+  802ac3:	50                   	push   %eax
+  802ac4:	e8 0e 01 00 00       	call   802bd7 <nsipc_accept>
+  802ac9:	83 c4 10             	add    $0x10,%esp
+  802acc:	85 c0                	test   %eax,%eax
+  802ace:	78 05                	js     802ad5 <accept+0x2d>
+	return alloc_sockfd(r);
+  802ad0:	e8 5f ff ff ff       	call   802a34 <alloc_sockfd>
+}
+  802ad5:	c9                   	leave
+  802ad6:	c3                   	ret
+
+00802ad7 <bind>:
+{
+  802ad7:	55                   	push   %ebp
+  802ad8:	89 e5                	mov    %esp,%ebp
+  802ada:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802add:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae0:	e8 1f ff ff ff       	call   802a04 <fd2sockid>
+  802ae5:	85 c0                	test   %eax,%eax
+  802ae7:	78 12                	js     802afb <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802ae9:	83 ec 04             	sub    $0x4,%esp
+  802aec:	ff 75 10             	push   0x10(%ebp)
+  802aef:	ff 75 0c             	push   0xc(%ebp)
+  802af2:	50                   	push   %eax
+  802af3:	e8 31 01 00 00       	call   802c29 <nsipc_bind>
+  802af8:	83 c4 10             	add    $0x10,%esp
+}
+  802afb:	c9                   	leave
+  802afc:	c3                   	ret
+
+00802afd <shutdown>:
+{
+  802afd:	55                   	push   %ebp
+  802afe:	89 e5                	mov    %esp,%ebp
+  802b00:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b03:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b06:	e8 f9 fe ff ff       	call   802a04 <fd2sockid>
+  802b0b:	85 c0                	test   %eax,%eax
+  802b0d:	78 0f                	js     802b1e <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802b0f:	83 ec 08             	sub    $0x8,%esp
+  802b12:	ff 75 0c             	push   0xc(%ebp)
+  802b15:	50                   	push   %eax
+  802b16:	e8 43 01 00 00       	call   802c5e <nsipc_shutdown>
+  802b1b:	83 c4 10             	add    $0x10,%esp
+}
+  802b1e:	c9                   	leave
+  802b1f:	c3                   	ret
+
+00802b20 <connect>:
+{
+  802b20:	55                   	push   %ebp
+  802b21:	89 e5                	mov    %esp,%ebp
+  802b23:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b26:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b29:	e8 d6 fe ff ff       	call   802a04 <fd2sockid>
+  802b2e:	85 c0                	test   %eax,%eax
+  802b30:	78 12                	js     802b44 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802b32:	83 ec 04             	sub    $0x4,%esp
+  802b35:	ff 75 10             	push   0x10(%ebp)
+  802b38:	ff 75 0c             	push   0xc(%ebp)
+  802b3b:	50                   	push   %eax
+  802b3c:	e8 59 01 00 00       	call   802c9a <nsipc_connect>
+  802b41:	83 c4 10             	add    $0x10,%esp
+}
+  802b44:	c9                   	leave
+  802b45:	c3                   	ret
+
+00802b46 <listen>:
+{
+  802b46:	55                   	push   %ebp
+  802b47:	89 e5                	mov    %esp,%ebp
+  802b49:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b4f:	e8 b0 fe ff ff       	call   802a04 <fd2sockid>
+  802b54:	85 c0                	test   %eax,%eax
+  802b56:	78 0f                	js     802b67 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802b58:	83 ec 08             	sub    $0x8,%esp
+  802b5b:	ff 75 0c             	push   0xc(%ebp)
+  802b5e:	50                   	push   %eax
+  802b5f:	e8 6b 01 00 00       	call   802ccf <nsipc_listen>
+  802b64:	83 c4 10             	add    $0x10,%esp
+}
+  802b67:	c9                   	leave
+  802b68:	c3                   	ret
+
+00802b69 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802b69:	55                   	push   %ebp
+  802b6a:	89 e5                	mov    %esp,%ebp
+  802b6c:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802b6f:	ff 75 10             	push   0x10(%ebp)
+  802b72:	ff 75 0c             	push   0xc(%ebp)
+  802b75:	ff 75 08             	push   0x8(%ebp)
+  802b78:	e8 41 02 00 00       	call   802dbe <nsipc_socket>
+  802b7d:	83 c4 10             	add    $0x10,%esp
+  802b80:	85 c0                	test   %eax,%eax
+  802b82:	78 05                	js     802b89 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802b84:	e8 ab fe ff ff       	call   802a34 <alloc_sockfd>
+}
+  802b89:	c9                   	leave
+  802b8a:	c3                   	ret
+
+00802b8b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802b8b:	55                   	push   %ebp
+  802b8c:	89 e5                	mov    %esp,%ebp
+  802b8e:	53                   	push   %ebx
+  802b8f:	83 ec 04             	sub    $0x4,%esp
+  802b92:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802b94:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802b9b:	74 26                	je     802bc3 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802b9d:	6a 07                	push   $0x7
+  802b9f:	68 00 80 80 00       	push   $0x808000
+  802ba4:	53                   	push   %ebx
+  802ba5:	ff 35 00 90 80 00    	push   0x809000
+  802bab:	e8 40 08 00 00       	call   8033f0 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802bb0:	83 c4 0c             	add    $0xc,%esp
+  802bb3:	6a 00                	push   $0x0
+  802bb5:	6a 00                	push   $0x0
+  802bb7:	6a 00                	push   $0x0
+  802bb9:	e8 c7 07 00 00       	call   803385 <ipc_recv>
+}
+  802bbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bc1:	c9                   	leave
+  802bc2:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802bc3:	83 ec 0c             	sub    $0xc,%esp
+  802bc6:	6a 02                	push   $0x2
+  802bc8:	e8 5c 09 00 00       	call   803529 <ipc_find_env>
+  802bcd:	a3 00 90 80 00       	mov    %eax,0x809000
+  802bd2:	83 c4 10             	add    $0x10,%esp
+  802bd5:	eb c6                	jmp    802b9d <nsipc+0x12>
+
+00802bd7 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802bd7:	55                   	push   %ebp
+  802bd8:	89 e5                	mov    %esp,%ebp
+  802bda:	56                   	push   %esi
+  802bdb:	53                   	push   %ebx
+  802bdc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802bdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802be7:	8b 06                	mov    (%esi),%eax
+  802be9:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802bee:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bf3:	e8 93 ff ff ff       	call   802b8b <nsipc>
+  802bf8:	89 c3                	mov    %eax,%ebx
+  802bfa:	85 c0                	test   %eax,%eax
+  802bfc:	79 09                	jns    802c07 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802bfe:	89 d8                	mov    %ebx,%eax
+  802c00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c03:	5b                   	pop    %ebx
+  802c04:	5e                   	pop    %esi
+  802c05:	5d                   	pop    %ebp
+  802c06:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802c07:	83 ec 04             	sub    $0x4,%esp
+  802c0a:	ff 35 10 80 80 00    	push   0x808010
+  802c10:	68 00 80 80 00       	push   $0x808000
+  802c15:	ff 75 0c             	push   0xc(%ebp)
+  802c18:	e8 32 dd ff ff       	call   80094f <memmove>
+		*addrlen = ret->ret_addrlen;
+  802c1d:	a1 10 80 80 00       	mov    0x808010,%eax
+  802c22:	89 06                	mov    %eax,(%esi)
+  802c24:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802c27:	eb d5                	jmp    802bfe <nsipc_accept+0x27>
+
+00802c29 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802c29:	55                   	push   %ebp
+  802c2a:	89 e5                	mov    %esp,%ebp
+  802c2c:	53                   	push   %ebx
+  802c2d:	83 ec 08             	sub    $0x8,%esp
+  802c30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802c33:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c36:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802c3b:	53                   	push   %ebx
+  802c3c:	ff 75 0c             	push   0xc(%ebp)
+  802c3f:	68 04 80 80 00       	push   $0x808004
+  802c44:	e8 06 dd ff ff       	call   80094f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802c49:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802c4f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c54:	e8 32 ff ff ff       	call   802b8b <nsipc>
+}
+  802c59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c5c:	c9                   	leave
+  802c5d:	c3                   	ret
+
+00802c5e <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802c5e:	55                   	push   %ebp
+  802c5f:	89 e5                	mov    %esp,%ebp
+  802c61:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802c64:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c67:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802c6c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c6f:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802c74:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c79:	e8 0d ff ff ff       	call   802b8b <nsipc>
+}
+  802c7e:	c9                   	leave
+  802c7f:	c3                   	ret
+
+00802c80 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802c80:	55                   	push   %ebp
+  802c81:	89 e5                	mov    %esp,%ebp
+  802c83:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802c86:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c89:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802c8e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c93:	e8 f3 fe ff ff       	call   802b8b <nsipc>
+}
+  802c98:	c9                   	leave
+  802c99:	c3                   	ret
+
+00802c9a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802c9a:	55                   	push   %ebp
+  802c9b:	89 e5                	mov    %esp,%ebp
+  802c9d:	53                   	push   %ebx
+  802c9e:	83 ec 08             	sub    $0x8,%esp
+  802ca1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802ca4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca7:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802cac:	53                   	push   %ebx
+  802cad:	ff 75 0c             	push   0xc(%ebp)
+  802cb0:	68 04 80 80 00       	push   $0x808004
+  802cb5:	e8 95 dc ff ff       	call   80094f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802cba:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802cc0:	b8 05 00 00 00       	mov    $0x5,%eax
+  802cc5:	e8 c1 fe ff ff       	call   802b8b <nsipc>
+}
+  802cca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ccd:	c9                   	leave
+  802cce:	c3                   	ret
+
+00802ccf <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802ccf:	55                   	push   %ebp
+  802cd0:	89 e5                	mov    %esp,%ebp
+  802cd2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802cd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd8:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802cdd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ce0:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802ce5:	b8 06 00 00 00       	mov    $0x6,%eax
+  802cea:	e8 9c fe ff ff       	call   802b8b <nsipc>
+}
+  802cef:	c9                   	leave
+  802cf0:	c3                   	ret
+
+00802cf1 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802cf1:	55                   	push   %ebp
+  802cf2:	89 e5                	mov    %esp,%ebp
+  802cf4:	56                   	push   %esi
+  802cf5:	53                   	push   %ebx
+  802cf6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802cf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cfc:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802d01:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802d07:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d0a:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802d0f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d14:	e8 72 fe ff ff       	call   802b8b <nsipc>
+  802d19:	89 c3                	mov    %eax,%ebx
+  802d1b:	85 c0                	test   %eax,%eax
+  802d1d:	78 22                	js     802d41 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802d1f:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d24:	39 c6                	cmp    %eax,%esi
+  802d26:	0f 4e c6             	cmovle %esi,%eax
+  802d29:	39 c3                	cmp    %eax,%ebx
+  802d2b:	7f 1d                	jg     802d4a <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802d2d:	83 ec 04             	sub    $0x4,%esp
+  802d30:	53                   	push   %ebx
+  802d31:	68 00 80 80 00       	push   $0x808000
+  802d36:	ff 75 0c             	push   0xc(%ebp)
+  802d39:	e8 11 dc ff ff       	call   80094f <memmove>
+  802d3e:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802d41:	89 d8                	mov    %ebx,%eax
+  802d43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d46:	5b                   	pop    %ebx
+  802d47:	5e                   	pop    %esi
+  802d48:	5d                   	pop    %ebp
+  802d49:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802d4a:	68 1d 3d 80 00       	push   $0x803d1d
+  802d4f:	68 ec 3b 80 00       	push   $0x803bec
+  802d54:	6a 62                	push   $0x62
+  802d56:	68 32 3d 80 00       	push   $0x803d32
+  802d5b:	e8 46 05 00 00       	call   8032a6 <_panic>
+
+00802d60 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802d60:	55                   	push   %ebp
+  802d61:	89 e5                	mov    %esp,%ebp
+  802d63:	53                   	push   %ebx
+  802d64:	83 ec 04             	sub    $0x4,%esp
+  802d67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802d6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d6d:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802d72:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d78:	7f 2e                	jg     802da8 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802d7a:	83 ec 04             	sub    $0x4,%esp
+  802d7d:	53                   	push   %ebx
+  802d7e:	ff 75 0c             	push   0xc(%ebp)
+  802d81:	68 0c 80 80 00       	push   $0x80800c
+  802d86:	e8 c4 db ff ff       	call   80094f <memmove>
+	nsipcbuf.send.req_size = size;
+  802d8b:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802d91:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d94:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802d99:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d9e:	e8 e8 fd ff ff       	call   802b8b <nsipc>
+}
+  802da3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802da6:	c9                   	leave
+  802da7:	c3                   	ret
+	assert(size < 1600);
+  802da8:	68 3e 3d 80 00       	push   $0x803d3e
+  802dad:	68 ec 3b 80 00       	push   $0x803bec
+  802db2:	6a 6d                	push   $0x6d
+  802db4:	68 32 3d 80 00       	push   $0x803d32
+  802db9:	e8 e8 04 00 00       	call   8032a6 <_panic>
+
+00802dbe <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802dbe:	55                   	push   %ebp
+  802dbf:	89 e5                	mov    %esp,%ebp
+  802dc1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802dc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802dcc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dcf:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802dd4:	8b 45 10             	mov    0x10(%ebp),%eax
+  802dd7:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802ddc:	b8 09 00 00 00       	mov    $0x9,%eax
+  802de1:	e8 a5 fd ff ff       	call   802b8b <nsipc>
+}
+  802de6:	c9                   	leave
+  802de7:	c3                   	ret
+
+00802de8 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802de8:	55                   	push   %ebp
+  802de9:	89 e5                	mov    %esp,%ebp
+  802deb:	56                   	push   %esi
+  802dec:	53                   	push   %ebx
+  802ded:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802df0:	83 ec 0c             	sub    $0xc,%esp
+  802df3:	ff 75 08             	push   0x8(%ebp)
+  802df6:	e8 00 e5 ff ff       	call   8012fb <fd2data>
+  802dfb:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802dfd:	83 c4 08             	add    $0x8,%esp
+  802e00:	68 4a 3d 80 00       	push   $0x803d4a
+  802e05:	53                   	push   %ebx
+  802e06:	e8 be d9 ff ff       	call   8007c9 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802e0b:	8b 46 04             	mov    0x4(%esi),%eax
+  802e0e:	2b 06                	sub    (%esi),%eax
+  802e10:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802e16:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e1d:	00 00 00 
+	stat->st_dev = &devpipe;
+  802e20:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802e27:	40 80 00 
+	return 0;
+}
+  802e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e32:	5b                   	pop    %ebx
+  802e33:	5e                   	pop    %esi
+  802e34:	5d                   	pop    %ebp
+  802e35:	c3                   	ret
+
+00802e36 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e36:	55                   	push   %ebp
+  802e37:	89 e5                	mov    %esp,%ebp
+  802e39:	53                   	push   %ebx
+  802e3a:	83 ec 0c             	sub    $0xc,%esp
+  802e3d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802e40:	53                   	push   %ebx
+  802e41:	6a 00                	push   $0x0
+  802e43:	e8 1a de ff ff       	call   800c62 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802e48:	89 1c 24             	mov    %ebx,(%esp)
+  802e4b:	e8 ab e4 ff ff       	call   8012fb <fd2data>
+  802e50:	83 c4 08             	add    $0x8,%esp
+  802e53:	50                   	push   %eax
+  802e54:	6a 00                	push   $0x0
+  802e56:	e8 07 de ff ff       	call   800c62 <sys_page_unmap>
+}
+  802e5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e5e:	c9                   	leave
+  802e5f:	c3                   	ret
+
+00802e60 <_pipeisclosed>:
+{
+  802e60:	55                   	push   %ebp
+  802e61:	89 e5                	mov    %esp,%ebp
+  802e63:	57                   	push   %edi
+  802e64:	56                   	push   %esi
+  802e65:	53                   	push   %ebx
+  802e66:	83 ec 1c             	sub    $0x1c,%esp
+  802e69:	89 c7                	mov    %eax,%edi
+  802e6b:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802e6d:	a1 00 50 80 00       	mov    0x805000,%eax
+  802e72:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802e75:	83 ec 0c             	sub    $0xc,%esp
+  802e78:	57                   	push   %edi
+  802e79:	e8 ea 06 00 00       	call   803568 <pageref>
+  802e7e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e81:	89 34 24             	mov    %esi,(%esp)
+  802e84:	e8 df 06 00 00       	call   803568 <pageref>
+		nn = thisenv->env_runs;
+  802e89:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802e8f:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802e92:	83 c4 10             	add    $0x10,%esp
+  802e95:	39 cb                	cmp    %ecx,%ebx
+  802e97:	74 1b                	je     802eb4 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802e99:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e9c:	75 cf                	jne    802e6d <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802e9e:	8b 42 58             	mov    0x58(%edx),%eax
+  802ea1:	6a 01                	push   $0x1
+  802ea3:	50                   	push   %eax
+  802ea4:	53                   	push   %ebx
+  802ea5:	68 51 3d 80 00       	push   $0x803d51
+  802eaa:	e8 2c d3 ff ff       	call   8001db <cprintf>
+  802eaf:	83 c4 10             	add    $0x10,%esp
+  802eb2:	eb b9                	jmp    802e6d <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802eb4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802eb7:	0f 94 c0             	sete   %al
+  802eba:	0f b6 c0             	movzbl %al,%eax
+}
+  802ebd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ec0:	5b                   	pop    %ebx
+  802ec1:	5e                   	pop    %esi
+  802ec2:	5f                   	pop    %edi
+  802ec3:	5d                   	pop    %ebp
+  802ec4:	c3                   	ret
+
+00802ec5 <devpipe_write>:
+{
+  802ec5:	55                   	push   %ebp
+  802ec6:	89 e5                	mov    %esp,%ebp
+  802ec8:	57                   	push   %edi
+  802ec9:	56                   	push   %esi
+  802eca:	53                   	push   %ebx
+  802ecb:	83 ec 28             	sub    $0x28,%esp
+  802ece:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802ed1:	56                   	push   %esi
+  802ed2:	e8 24 e4 ff ff       	call   8012fb <fd2data>
+  802ed7:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802ed9:	83 c4 10             	add    $0x10,%esp
+  802edc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ee1:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802ee4:	75 09                	jne    802eef <devpipe_write+0x2a>
+	return i;
+  802ee6:	89 f8                	mov    %edi,%eax
+  802ee8:	eb 23                	jmp    802f0d <devpipe_write+0x48>
+			sys_yield();
+  802eea:	e8 c7 dc ff ff       	call   800bb6 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802eef:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ef2:	8b 0b                	mov    (%ebx),%ecx
+  802ef4:	8d 51 20             	lea    0x20(%ecx),%edx
+  802ef7:	39 d0                	cmp    %edx,%eax
+  802ef9:	72 1a                	jb     802f15 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802efb:	89 da                	mov    %ebx,%edx
+  802efd:	89 f0                	mov    %esi,%eax
+  802eff:	e8 5c ff ff ff       	call   802e60 <_pipeisclosed>
+  802f04:	85 c0                	test   %eax,%eax
+  802f06:	74 e2                	je     802eea <devpipe_write+0x25>
+				return 0;
+  802f08:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f10:	5b                   	pop    %ebx
+  802f11:	5e                   	pop    %esi
+  802f12:	5f                   	pop    %edi
+  802f13:	5d                   	pop    %ebp
+  802f14:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802f15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f18:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802f1c:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802f1f:	89 c2                	mov    %eax,%edx
+  802f21:	c1 fa 1f             	sar    $0x1f,%edx
+  802f24:	89 d1                	mov    %edx,%ecx
+  802f26:	c1 e9 1b             	shr    $0x1b,%ecx
+  802f29:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802f2c:	83 e2 1f             	and    $0x1f,%edx
+  802f2f:	29 ca                	sub    %ecx,%edx
+  802f31:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802f35:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802f39:	83 c0 01             	add    $0x1,%eax
+  802f3c:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802f3f:	83 c7 01             	add    $0x1,%edi
+  802f42:	eb 9d                	jmp    802ee1 <devpipe_write+0x1c>
+
+00802f44 <devpipe_read>:
+{
+  802f44:	55                   	push   %ebp
+  802f45:	89 e5                	mov    %esp,%ebp
+  802f47:	57                   	push   %edi
+  802f48:	56                   	push   %esi
+  802f49:	53                   	push   %ebx
+  802f4a:	83 ec 18             	sub    $0x18,%esp
+  802f4d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802f50:	57                   	push   %edi
+  802f51:	e8 a5 e3 ff ff       	call   8012fb <fd2data>
+  802f56:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f58:	83 c4 10             	add    $0x10,%esp
+  802f5b:	be 00 00 00 00       	mov    $0x0,%esi
+  802f60:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802f63:	75 13                	jne    802f78 <devpipe_read+0x34>
+	return i;
+  802f65:	89 f0                	mov    %esi,%eax
+  802f67:	eb 02                	jmp    802f6b <devpipe_read+0x27>
+				return i;
+  802f69:	89 f0                	mov    %esi,%eax
+}
+  802f6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f6e:	5b                   	pop    %ebx
+  802f6f:	5e                   	pop    %esi
+  802f70:	5f                   	pop    %edi
+  802f71:	5d                   	pop    %ebp
+  802f72:	c3                   	ret
+			sys_yield();
+  802f73:	e8 3e dc ff ff       	call   800bb6 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802f78:	8b 03                	mov    (%ebx),%eax
+  802f7a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f7d:	75 18                	jne    802f97 <devpipe_read+0x53>
+			if (i > 0)
+  802f7f:	85 f6                	test   %esi,%esi
+  802f81:	75 e6                	jne    802f69 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802f83:	89 da                	mov    %ebx,%edx
+  802f85:	89 f8                	mov    %edi,%eax
+  802f87:	e8 d4 fe ff ff       	call   802e60 <_pipeisclosed>
+  802f8c:	85 c0                	test   %eax,%eax
+  802f8e:	74 e3                	je     802f73 <devpipe_read+0x2f>
+				return 0;
+  802f90:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f95:	eb d4                	jmp    802f6b <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802f97:	99                   	cltd
+  802f98:	c1 ea 1b             	shr    $0x1b,%edx
+  802f9b:	01 d0                	add    %edx,%eax
+  802f9d:	83 e0 1f             	and    $0x1f,%eax
+  802fa0:	29 d0                	sub    %edx,%eax
+  802fa2:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802fa7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802faa:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802fad:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802fb0:	83 c6 01             	add    $0x1,%esi
+  802fb3:	eb ab                	jmp    802f60 <devpipe_read+0x1c>
+
+00802fb5 <pipe>:
+{
+  802fb5:	55                   	push   %ebp
+  802fb6:	89 e5                	mov    %esp,%ebp
+  802fb8:	56                   	push   %esi
+  802fb9:	53                   	push   %ebx
+  802fba:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802fbd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fc0:	50                   	push   %eax
+  802fc1:	e8 4c e3 ff ff       	call   801312 <fd_alloc>
+  802fc6:	89 c3                	mov    %eax,%ebx
+  802fc8:	83 c4 10             	add    $0x10,%esp
+  802fcb:	85 c0                	test   %eax,%eax
+  802fcd:	0f 88 23 01 00 00    	js     8030f6 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802fd3:	83 ec 04             	sub    $0x4,%esp
+  802fd6:	68 07 04 00 00       	push   $0x407
+  802fdb:	ff 75 f4             	push   -0xc(%ebp)
+  802fde:	6a 00                	push   $0x0
+  802fe0:	e8 f0 db ff ff       	call   800bd5 <sys_page_alloc>
+  802fe5:	89 c3                	mov    %eax,%ebx
+  802fe7:	83 c4 10             	add    $0x10,%esp
+  802fea:	85 c0                	test   %eax,%eax
+  802fec:	0f 88 04 01 00 00    	js     8030f6 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802ff2:	83 ec 0c             	sub    $0xc,%esp
+  802ff5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802ff8:	50                   	push   %eax
+  802ff9:	e8 14 e3 ff ff       	call   801312 <fd_alloc>
+  802ffe:	89 c3                	mov    %eax,%ebx
+  803000:	83 c4 10             	add    $0x10,%esp
+  803003:	85 c0                	test   %eax,%eax
+  803005:	0f 88 db 00 00 00    	js     8030e6 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80300b:	83 ec 04             	sub    $0x4,%esp
+  80300e:	68 07 04 00 00       	push   $0x407
+  803013:	ff 75 f0             	push   -0x10(%ebp)
+  803016:	6a 00                	push   $0x0
+  803018:	e8 b8 db ff ff       	call   800bd5 <sys_page_alloc>
+  80301d:	89 c3                	mov    %eax,%ebx
+  80301f:	83 c4 10             	add    $0x10,%esp
+  803022:	85 c0                	test   %eax,%eax
+  803024:	0f 88 bc 00 00 00    	js     8030e6 <pipe+0x131>
+	va = fd2data(fd0);
+  80302a:	83 ec 0c             	sub    $0xc,%esp
+  80302d:	ff 75 f4             	push   -0xc(%ebp)
+  803030:	e8 c6 e2 ff ff       	call   8012fb <fd2data>
+  803035:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803037:	83 c4 0c             	add    $0xc,%esp
+  80303a:	68 07 04 00 00       	push   $0x407
+  80303f:	50                   	push   %eax
+  803040:	6a 00                	push   $0x0
+  803042:	e8 8e db ff ff       	call   800bd5 <sys_page_alloc>
+  803047:	89 c3                	mov    %eax,%ebx
+  803049:	83 c4 10             	add    $0x10,%esp
+  80304c:	85 c0                	test   %eax,%eax
+  80304e:	0f 88 82 00 00 00    	js     8030d6 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803054:	83 ec 0c             	sub    $0xc,%esp
+  803057:	ff 75 f0             	push   -0x10(%ebp)
+  80305a:	e8 9c e2 ff ff       	call   8012fb <fd2data>
+  80305f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803066:	50                   	push   %eax
+  803067:	6a 00                	push   $0x0
+  803069:	56                   	push   %esi
+  80306a:	6a 00                	push   $0x0
+  80306c:	e8 af db ff ff       	call   800c20 <sys_page_map>
+  803071:	89 c3                	mov    %eax,%ebx
+  803073:	83 c4 20             	add    $0x20,%esp
+  803076:	85 c0                	test   %eax,%eax
+  803078:	78 4e                	js     8030c8 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80307a:	a1 60 40 80 00       	mov    0x804060,%eax
+  80307f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803082:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803084:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803087:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80308e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803091:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803093:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803096:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80309d:	83 ec 0c             	sub    $0xc,%esp
+  8030a0:	ff 75 f4             	push   -0xc(%ebp)
+  8030a3:	e8 43 e2 ff ff       	call   8012eb <fd2num>
+  8030a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030ab:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8030ad:	83 c4 04             	add    $0x4,%esp
+  8030b0:	ff 75 f0             	push   -0x10(%ebp)
+  8030b3:	e8 33 e2 ff ff       	call   8012eb <fd2num>
+  8030b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030bb:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8030be:	83 c4 10             	add    $0x10,%esp
+  8030c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030c6:	eb 2e                	jmp    8030f6 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8030c8:	83 ec 08             	sub    $0x8,%esp
+  8030cb:	56                   	push   %esi
+  8030cc:	6a 00                	push   $0x0
+  8030ce:	e8 8f db ff ff       	call   800c62 <sys_page_unmap>
+  8030d3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8030d6:	83 ec 08             	sub    $0x8,%esp
+  8030d9:	ff 75 f0             	push   -0x10(%ebp)
+  8030dc:	6a 00                	push   $0x0
+  8030de:	e8 7f db ff ff       	call   800c62 <sys_page_unmap>
+  8030e3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8030e6:	83 ec 08             	sub    $0x8,%esp
+  8030e9:	ff 75 f4             	push   -0xc(%ebp)
+  8030ec:	6a 00                	push   $0x0
+  8030ee:	e8 6f db ff ff       	call   800c62 <sys_page_unmap>
+  8030f3:	83 c4 10             	add    $0x10,%esp
+}
+  8030f6:	89 d8                	mov    %ebx,%eax
+  8030f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030fb:	5b                   	pop    %ebx
+  8030fc:	5e                   	pop    %esi
+  8030fd:	5d                   	pop    %ebp
+  8030fe:	c3                   	ret
+
+008030ff <pipeisclosed>:
+{
+  8030ff:	55                   	push   %ebp
+  803100:	89 e5                	mov    %esp,%ebp
+  803102:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803105:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803108:	50                   	push   %eax
+  803109:	ff 75 08             	push   0x8(%ebp)
+  80310c:	e8 57 e2 ff ff       	call   801368 <fd_lookup>
+  803111:	83 c4 10             	add    $0x10,%esp
+  803114:	85 c0                	test   %eax,%eax
+  803116:	78 18                	js     803130 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803118:	83 ec 0c             	sub    $0xc,%esp
+  80311b:	ff 75 f4             	push   -0xc(%ebp)
+  80311e:	e8 d8 e1 ff ff       	call   8012fb <fd2data>
+  803123:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803125:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803128:	e8 33 fd ff ff       	call   802e60 <_pipeisclosed>
+  80312d:	83 c4 10             	add    $0x10,%esp
+}
+  803130:	c9                   	leave
+  803131:	c3                   	ret
+
+00803132 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803132:	b8 00 00 00 00       	mov    $0x0,%eax
+  803137:	c3                   	ret
+
+00803138 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803138:	55                   	push   %ebp
+  803139:	89 e5                	mov    %esp,%ebp
+  80313b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80313e:	68 69 3d 80 00       	push   $0x803d69
+  803143:	ff 75 0c             	push   0xc(%ebp)
+  803146:	e8 7e d6 ff ff       	call   8007c9 <strcpy>
+	return 0;
+}
+  80314b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803150:	c9                   	leave
+  803151:	c3                   	ret
+
+00803152 <devcons_write>:
+{
+  803152:	55                   	push   %ebp
+  803153:	89 e5                	mov    %esp,%ebp
+  803155:	57                   	push   %edi
+  803156:	56                   	push   %esi
+  803157:	53                   	push   %ebx
+  803158:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80315e:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803163:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803169:	eb 2e                	jmp    803199 <devcons_write+0x47>
+		m = n - tot;
+  80316b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80316e:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803170:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803175:	39 c3                	cmp    %eax,%ebx
+  803177:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80317a:	83 ec 04             	sub    $0x4,%esp
+  80317d:	53                   	push   %ebx
+  80317e:	89 f0                	mov    %esi,%eax
+  803180:	03 45 0c             	add    0xc(%ebp),%eax
+  803183:	50                   	push   %eax
+  803184:	57                   	push   %edi
+  803185:	e8 c5 d7 ff ff       	call   80094f <memmove>
+		sys_cputs(buf, m);
+  80318a:	83 c4 08             	add    $0x8,%esp
+  80318d:	53                   	push   %ebx
+  80318e:	57                   	push   %edi
+  80318f:	e8 65 d9 ff ff       	call   800af9 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803194:	01 de                	add    %ebx,%esi
+  803196:	83 c4 10             	add    $0x10,%esp
+  803199:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80319c:	72 cd                	jb     80316b <devcons_write+0x19>
+}
+  80319e:	89 f0                	mov    %esi,%eax
+  8031a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031a3:	5b                   	pop    %ebx
+  8031a4:	5e                   	pop    %esi
+  8031a5:	5f                   	pop    %edi
+  8031a6:	5d                   	pop    %ebp
+  8031a7:	c3                   	ret
+
+008031a8 <devcons_read>:
+{
+  8031a8:	55                   	push   %ebp
+  8031a9:	89 e5                	mov    %esp,%ebp
+  8031ab:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8031ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8031b7:	75 07                	jne    8031c0 <devcons_read+0x18>
+  8031b9:	eb 1f                	jmp    8031da <devcons_read+0x32>
+		sys_yield();
+  8031bb:	e8 f6 d9 ff ff       	call   800bb6 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8031c0:	e8 5a d9 ff ff       	call   800b1f <sys_cgetc>
+  8031c5:	85 c0                	test   %eax,%eax
+  8031c7:	74 f2                	je     8031bb <devcons_read+0x13>
+	if (c < 0)
+  8031c9:	78 0f                	js     8031da <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8031cb:	83 f8 04             	cmp    $0x4,%eax
+  8031ce:	74 0c                	je     8031dc <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8031d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8031d3:	88 02                	mov    %al,(%edx)
+	return 1;
+  8031d5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8031da:	c9                   	leave
+  8031db:	c3                   	ret
+		return 0;
+  8031dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e1:	eb f7                	jmp    8031da <devcons_read+0x32>
+
+008031e3 <cputchar>:
+{
+  8031e3:	55                   	push   %ebp
+  8031e4:	89 e5                	mov    %esp,%ebp
+  8031e6:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8031e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031ec:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8031ef:	6a 01                	push   $0x1
+  8031f1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8031f4:	50                   	push   %eax
+  8031f5:	e8 ff d8 ff ff       	call   800af9 <sys_cputs>
+}
+  8031fa:	83 c4 10             	add    $0x10,%esp
+  8031fd:	c9                   	leave
+  8031fe:	c3                   	ret
+
+008031ff <getchar>:
+{
+  8031ff:	55                   	push   %ebp
+  803200:	89 e5                	mov    %esp,%ebp
+  803202:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803205:	6a 01                	push   $0x1
+  803207:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80320a:	50                   	push   %eax
+  80320b:	6a 00                	push   $0x0
+  80320d:	e8 bc e3 ff ff       	call   8015ce <read>
+	if (r < 0)
+  803212:	83 c4 10             	add    $0x10,%esp
+  803215:	85 c0                	test   %eax,%eax
+  803217:	78 06                	js     80321f <getchar+0x20>
+	if (r < 1)
+  803219:	74 06                	je     803221 <getchar+0x22>
+	return c;
+  80321b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80321f:	c9                   	leave
+  803220:	c3                   	ret
+		return -E_EOF;
+  803221:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803226:	eb f7                	jmp    80321f <getchar+0x20>
+
+00803228 <iscons>:
+{
+  803228:	55                   	push   %ebp
+  803229:	89 e5                	mov    %esp,%ebp
+  80322b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80322e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803231:	50                   	push   %eax
+  803232:	ff 75 08             	push   0x8(%ebp)
+  803235:	e8 2e e1 ff ff       	call   801368 <fd_lookup>
+  80323a:	83 c4 10             	add    $0x10,%esp
+  80323d:	85 c0                	test   %eax,%eax
+  80323f:	78 11                	js     803252 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803241:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803244:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80324a:	39 10                	cmp    %edx,(%eax)
+  80324c:	0f 94 c0             	sete   %al
+  80324f:	0f b6 c0             	movzbl %al,%eax
+}
+  803252:	c9                   	leave
+  803253:	c3                   	ret
+
+00803254 <opencons>:
+{
+  803254:	55                   	push   %ebp
+  803255:	89 e5                	mov    %esp,%ebp
+  803257:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80325a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80325d:	50                   	push   %eax
+  80325e:	e8 af e0 ff ff       	call   801312 <fd_alloc>
+  803263:	83 c4 10             	add    $0x10,%esp
+  803266:	85 c0                	test   %eax,%eax
+  803268:	78 3a                	js     8032a4 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80326a:	83 ec 04             	sub    $0x4,%esp
+  80326d:	68 07 04 00 00       	push   $0x407
+  803272:	ff 75 f4             	push   -0xc(%ebp)
+  803275:	6a 00                	push   $0x0
+  803277:	e8 59 d9 ff ff       	call   800bd5 <sys_page_alloc>
+  80327c:	83 c4 10             	add    $0x10,%esp
+  80327f:	85 c0                	test   %eax,%eax
+  803281:	78 21                	js     8032a4 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803283:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803286:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80328c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80328e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803291:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803298:	83 ec 0c             	sub    $0xc,%esp
+  80329b:	50                   	push   %eax
+  80329c:	e8 4a e0 ff ff       	call   8012eb <fd2num>
+  8032a1:	83 c4 10             	add    $0x10,%esp
+}
+  8032a4:	c9                   	leave
+  8032a5:	c3                   	ret
+
+008032a6 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8032a6:	55                   	push   %ebp
+  8032a7:	89 e5                	mov    %esp,%ebp
+  8032a9:	56                   	push   %esi
+  8032aa:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8032ab:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8032ae:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8032b4:	e8 d6 d8 ff ff       	call   800b8f <sys_getenvid>
+  8032b9:	83 ec 0c             	sub    $0xc,%esp
+  8032bc:	ff 75 0c             	push   0xc(%ebp)
+  8032bf:	ff 75 08             	push   0x8(%ebp)
+  8032c2:	56                   	push   %esi
+  8032c3:	50                   	push   %eax
+  8032c4:	68 78 3d 80 00       	push   $0x803d78
+  8032c9:	e8 0d cf ff ff       	call   8001db <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8032ce:	83 c4 18             	add    $0x18,%esp
+  8032d1:	53                   	push   %ebx
+  8032d2:	ff 75 10             	push   0x10(%ebp)
+  8032d5:	e8 b0 ce ff ff       	call   80018a <vcprintf>
+	cprintf("\n");
+  8032da:	c7 04 24 0f 38 80 00 	movl   $0x80380f,(%esp)
+  8032e1:	e8 f5 ce ff ff       	call   8001db <cprintf>
+  8032e6:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8032e9:	cc                   	int3
+	while (1)
+  8032ea:	eb fd                	jmp    8032e9 <_panic+0x43>
+
+008032ec <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8032ec:	55                   	push   %ebp
+  8032ed:	89 e5                	mov    %esp,%ebp
+  8032ef:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8032f2:	83 3d 04 90 80 00 00 	cmpl   $0x0,0x809004
+  8032f9:	74 0a                	je     803305 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8032fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032fe:	a3 04 90 80 00       	mov    %eax,0x809004
+}
+  803303:	c9                   	leave
+  803304:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803305:	83 ec 04             	sub    $0x4,%esp
+  803308:	6a 07                	push   $0x7
+  80330a:	68 00 f0 bf ee       	push   $0xeebff000
+  80330f:	6a 00                	push   $0x0
+  803311:	e8 bf d8 ff ff       	call   800bd5 <sys_page_alloc>
+  803316:	83 c4 10             	add    $0x10,%esp
+  803319:	85 c0                	test   %eax,%eax
+  80331b:	75 2c                	jne    803349 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80331d:	83 ec 08             	sub    $0x8,%esp
+  803320:	68 5f 33 80 00       	push   $0x80335f
+  803325:	6a 00                	push   $0x0
+  803327:	e8 14 da ff ff       	call   800d40 <sys_env_set_pgfault_upcall>
+  80332c:	83 c4 10             	add    $0x10,%esp
+  80332f:	85 c0                	test   %eax,%eax
+  803331:	74 c8                	je     8032fb <set_pgfault_handler+0xf>
+  803333:	68 e4 3d 80 00       	push   $0x803de4
+  803338:	68 ec 3b 80 00       	push   $0x803bec
+  80333d:	6a 20                	push   $0x20
+  80333f:	68 14 3e 80 00       	push   $0x803e14
+  803344:	e8 5d ff ff ff       	call   8032a6 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803349:	68 9c 3d 80 00       	push   $0x803d9c
+  80334e:	68 ec 3b 80 00       	push   $0x803bec
+  803353:	6a 1e                	push   $0x1e
+  803355:	68 14 3e 80 00       	push   $0x803e14
+  80335a:	e8 47 ff ff ff       	call   8032a6 <_panic>
+
+0080335f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80335f:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803360:	a1 04 90 80 00       	mov    0x809004,%eax
+	call *%eax
+  803365:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803367:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80336a:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  80336f:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803374:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803378:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80337b:	83 c4 08             	add    $0x8,%esp
+	popal
+  80337e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  80337f:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803382:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803383:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803384:	c3                   	ret
+
+00803385 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803385:	55                   	push   %ebp
+  803386:	89 e5                	mov    %esp,%ebp
+  803388:	56                   	push   %esi
+  803389:	53                   	push   %ebx
+  80338a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80338d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803390:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803393:	85 c0                	test   %eax,%eax
+  803395:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80339a:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80339d:	83 ec 0c             	sub    $0xc,%esp
+  8033a0:	50                   	push   %eax
+  8033a1:	e8 77 da ff ff       	call   800e1d <sys_ipc_recv>
+	if (from_env_store)
+  8033a6:	83 c4 10             	add    $0x10,%esp
+  8033a9:	85 f6                	test   %esi,%esi
+  8033ab:	74 14                	je     8033c1 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8033ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033b2:	85 c0                	test   %eax,%eax
+  8033b4:	75 09                	jne    8033bf <ipc_recv+0x3a>
+  8033b6:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8033bc:	8b 52 74             	mov    0x74(%edx),%edx
+  8033bf:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8033c1:	85 db                	test   %ebx,%ebx
+  8033c3:	74 25                	je     8033ea <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033c5:	85 c0                	test   %eax,%eax
+  8033c7:	74 0d                	je     8033d6 <ipc_recv+0x51>
+  8033c9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8033cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033d2:	5b                   	pop    %ebx
+  8033d3:	5e                   	pop    %esi
+  8033d4:	5d                   	pop    %ebp
+  8033d5:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033d6:	a1 00 50 80 00       	mov    0x805000,%eax
+  8033db:	8b 40 78             	mov    0x78(%eax),%eax
+  8033de:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8033e0:	a1 00 50 80 00       	mov    0x805000,%eax
+  8033e5:	8b 40 70             	mov    0x70(%eax),%eax
+  8033e8:	eb e5                	jmp    8033cf <ipc_recv+0x4a>
+  8033ea:	85 c0                	test   %eax,%eax
+  8033ec:	75 e1                	jne    8033cf <ipc_recv+0x4a>
+  8033ee:	eb f0                	jmp    8033e0 <ipc_recv+0x5b>
+
+008033f0 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8033f0:	55                   	push   %ebp
+  8033f1:	89 e5                	mov    %esp,%ebp
+  8033f3:	57                   	push   %edi
+  8033f4:	56                   	push   %esi
+  8033f5:	53                   	push   %ebx
+  8033f6:	83 ec 0c             	sub    $0xc,%esp
+  8033f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803402:	85 db                	test   %ebx,%ebx
+  803404:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803409:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80340c:	ff 75 14             	push   0x14(%ebp)
+  80340f:	53                   	push   %ebx
+  803410:	56                   	push   %esi
+  803411:	57                   	push   %edi
+  803412:	e8 73 d9 ff ff       	call   800d8a <sys_ipc_try_send>
+  803417:	83 c4 10             	add    $0x10,%esp
+  80341a:	85 c0                	test   %eax,%eax
+  80341c:	74 22                	je     803440 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  80341e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803421:	75 07                	jne    80342a <ipc_send+0x3a>
+		sys_yield();
+  803423:	e8 8e d7 ff ff       	call   800bb6 <sys_yield>
+  803428:	eb e2                	jmp    80340c <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80342a:	68 22 3e 80 00       	push   $0x803e22
+  80342f:	68 ec 3b 80 00       	push   $0x803bec
+  803434:	6a 39                	push   $0x39
+  803436:	68 37 3e 80 00       	push   $0x803e37
+  80343b:	e8 66 fe ff ff       	call   8032a6 <_panic>
+	}
+}
+  803440:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803443:	5b                   	pop    %ebx
+  803444:	5e                   	pop    %esi
+  803445:	5f                   	pop    %edi
+  803446:	5d                   	pop    %ebp
+  803447:	c3                   	ret
+
+00803448 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803448:	55                   	push   %ebp
+  803449:	89 e5                	mov    %esp,%ebp
+  80344b:	57                   	push   %edi
+  80344c:	56                   	push   %esi
+  80344d:	53                   	push   %ebx
+  80344e:	83 ec 10             	sub    $0x10,%esp
+  803451:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803454:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803457:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80345a:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80345d:	85 c0                	test   %eax,%eax
+  80345f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803464:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803467:	6a 00                	push   $0x0
+  803469:	ff 33                	push   (%ebx)
+  80346b:	50                   	push   %eax
+  80346c:	e8 69 d9 ff ff       	call   800dda <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803471:	83 c4 10             	add    $0x10,%esp
+  803474:	85 c0                	test   %eax,%eax
+  803476:	75 3c                	jne    8034b4 <ipc_recvv+0x6c>
+  803478:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80347e:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803481:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803483:	85 ff                	test   %edi,%edi
+  803485:	74 4e                	je     8034d5 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803487:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80348d:	8b 52 74             	mov    0x74(%edx),%edx
+  803490:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803492:	85 f6                	test   %esi,%esi
+  803494:	74 18                	je     8034ae <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803496:	85 c0                	test   %eax,%eax
+  803498:	75 2d                	jne    8034c7 <ipc_recvv+0x7f>
+  80349a:	a1 00 50 80 00       	mov    0x805000,%eax
+  80349f:	8b 40 78             	mov    0x78(%eax),%eax
+  8034a2:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8034a4:	a1 00 50 80 00       	mov    0x805000,%eax
+  8034a9:	8b 40 70             	mov    0x70(%eax),%eax
+  8034ac:	eb 1f                	jmp    8034cd <ipc_recvv+0x85>
+  8034ae:	85 c0                	test   %eax,%eax
+  8034b0:	75 1b                	jne    8034cd <ipc_recvv+0x85>
+  8034b2:	eb f0                	jmp    8034a4 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8034b4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8034ba:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8034bf:	85 ff                	test   %edi,%edi
+  8034c1:	75 cd                	jne    803490 <ipc_recvv+0x48>
+	if (perm_store)
+  8034c3:	85 f6                	test   %esi,%esi
+  8034c5:	74 e7                	je     8034ae <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8034c7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8034cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034d0:	5b                   	pop    %ebx
+  8034d1:	5e                   	pop    %esi
+  8034d2:	5f                   	pop    %edi
+  8034d3:	5d                   	pop    %ebp
+  8034d4:	c3                   	ret
+	if (perm_store)
+  8034d5:	85 f6                	test   %esi,%esi
+  8034d7:	75 bd                	jne    803496 <ipc_recvv+0x4e>
+  8034d9:	eb c9                	jmp    8034a4 <ipc_recvv+0x5c>
+
+008034db <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8034db:	55                   	push   %ebp
+  8034dc:	89 e5                	mov    %esp,%ebp
+  8034de:	57                   	push   %edi
+  8034df:	56                   	push   %esi
+  8034e0:	53                   	push   %ebx
+  8034e1:	83 ec 0c             	sub    $0xc,%esp
+  8034e4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8034e7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8034ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8034ed:	ff 75 14             	push   0x14(%ebp)
+  8034f0:	53                   	push   %ebx
+  8034f1:	56                   	push   %esi
+  8034f2:	57                   	push   %edi
+  8034f3:	e8 ba d8 ff ff       	call   800db2 <sys_ipc_try_sendv>
+  8034f8:	83 c4 10             	add    $0x10,%esp
+  8034fb:	85 c0                	test   %eax,%eax
+  8034fd:	74 22                	je     803521 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8034ff:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803502:	75 07                	jne    80350b <ipc_sendv+0x30>
+		sys_yield();
+  803504:	e8 ad d6 ff ff       	call   800bb6 <sys_yield>
+  803509:	eb e2                	jmp    8034ed <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80350b:	68 22 3e 80 00       	push   $0x803e22
+  803510:	68 ec 3b 80 00       	push   $0x803bec
+  803515:	6a 5c                	push   $0x5c
+  803517:	68 37 3e 80 00       	push   $0x803e37
+  80351c:	e8 85 fd ff ff       	call   8032a6 <_panic>
+	}
+}
+  803521:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803524:	5b                   	pop    %ebx
+  803525:	5e                   	pop    %esi
+  803526:	5f                   	pop    %edi
+  803527:	5d                   	pop    %ebp
+  803528:	c3                   	ret
+
+00803529 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803529:	55                   	push   %ebp
+  80352a:	89 e5                	mov    %esp,%ebp
+  80352c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80352f:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803534:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80353a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803540:	8b 52 50             	mov    0x50(%edx),%edx
+  803543:	39 ca                	cmp    %ecx,%edx
+  803545:	74 11                	je     803558 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803547:	83 c0 01             	add    $0x1,%eax
+  80354a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80354f:	75 e3                	jne    803534 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803551:	b8 00 00 00 00       	mov    $0x0,%eax
+  803556:	eb 0e                	jmp    803566 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803558:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80355e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803563:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803566:	5d                   	pop    %ebp
+  803567:	c3                   	ret
+
+00803568 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803568:	55                   	push   %ebp
+  803569:	89 e5                	mov    %esp,%ebp
+  80356b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80356e:	89 c2                	mov    %eax,%edx
+  803570:	c1 ea 16             	shr    $0x16,%edx
+  803573:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80357a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80357f:	f6 c1 01             	test   $0x1,%cl
+  803582:	74 22                	je     8035a6 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803584:	c1 e8 0c             	shr    $0xc,%eax
+  803587:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80358e:	a8 01                	test   $0x1,%al
+  803590:	74 14                	je     8035a6 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803592:	c1 e8 0c             	shr    $0xc,%eax
+  803595:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803598:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80359f:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8035a3:	0f b7 d2             	movzwl %dx,%edx
+}
+  8035a6:	89 d0                	mov    %edx,%eax
+  8035a8:	5d                   	pop    %ebp
+  8035a9:	c3                   	ret
+
+008035aa <dm>:
+  8035aa:	55                   	push   %ebp
+  8035ab:	57                   	push   %edi
+  8035ac:	56                   	push   %esi
+  8035ad:	53                   	push   %ebx
+  8035ae:	83 ec 24             	sub    $0x24,%esp
+  8035b1:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8035b5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035b9:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035bd:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035c1:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035c5:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035c9:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8035cd:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035dc:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035e3:	00 
+  8035e4:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035eb:	00 
+  8035ec:	89 fb                	mov    %edi,%ebx
+  8035ee:	eb 08                	jmp    8035f8 <dm+0x4e>
+  8035f0:	83 e9 01             	sub    $0x1,%ecx
+  8035f3:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8035f6:	74 68                	je     803660 <dm+0xb6>
+  8035f8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8035fc:	01 c0                	add    %eax,%eax
+  8035fe:	89 c6                	mov    %eax,%esi
+  803600:	89 d7                	mov    %edx,%edi
+  803602:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803606:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80360a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80360d:	d3 ea                	shr    %cl,%edx
+  80360f:	f6 c1 20             	test   $0x20,%cl
+  803612:	74 04                	je     803618 <dm+0x6e>
+  803614:	89 d0                	mov    %edx,%eax
+  803616:	31 d2                	xor    %edx,%edx
+  803618:	83 e0 01             	and    $0x1,%eax
+  80361b:	89 04 24             	mov    %eax,(%esp)
+  80361e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803625:	00 
+  803626:	8b 04 24             	mov    (%esp),%eax
+  803629:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80362d:	09 f0                	or     %esi,%eax
+  80362f:	09 fa                	or     %edi,%edx
+  803631:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803635:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803639:	39 f0                	cmp    %esi,%eax
+  80363b:	89 d5                	mov    %edx,%ebp
+  80363d:	19 fd                	sbb    %edi,%ebp
+  80363f:	72 af                	jb     8035f0 <dm+0x46>
+  803641:	29 f0                	sub    %esi,%eax
+  803643:	19 fa                	sbb    %edi,%edx
+  803645:	89 cf                	mov    %ecx,%edi
+  803647:	c1 ef 05             	shr    $0x5,%edi
+  80364a:	83 e7 01             	and    $0x1,%edi
+  80364d:	89 fe                	mov    %edi,%esi
+  80364f:	83 f6 01             	xor    $0x1,%esi
+  803652:	d3 e6                	shl    %cl,%esi
+  803654:	d3 e7                	shl    %cl,%edi
+  803656:	09 74 24 18          	or     %esi,0x18(%esp)
+  80365a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80365e:	eb 90                	jmp    8035f0 <dm+0x46>
+  803660:	85 db                	test   %ebx,%ebx
+  803662:	74 05                	je     803669 <dm+0xbf>
+  803664:	89 03                	mov    %eax,(%ebx)
+  803666:	89 53 04             	mov    %edx,0x4(%ebx)
+  803669:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80366d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803671:	83 c4 24             	add    $0x24,%esp
+  803674:	5b                   	pop    %ebx
+  803675:	5e                   	pop    %esi
+  803676:	5f                   	pop    %edi
+  803677:	5d                   	pop    %ebp
+  803678:	c3                   	ret
+
+00803679 <__udivdi3>:
+  803679:	83 ec 08             	sub    $0x8,%esp
+  80367c:	6a 00                	push   $0x0
+  80367e:	ff 74 24 1c          	push   0x1c(%esp)
+  803682:	ff 74 24 1c          	push   0x1c(%esp)
+  803686:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80368a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80368e:	e8 17 ff ff ff       	call   8035aa <dm>
+  803693:	83 c4 14             	add    $0x14,%esp
+  803696:	c3                   	ret
+
+00803697 <__umoddi3>:
+  803697:	83 ec 18             	sub    $0x18,%esp
+  80369a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80369e:	50                   	push   %eax
+  80369f:	ff 74 24 2c          	push   0x2c(%esp)
+  8036a3:	ff 74 24 2c          	push   0x2c(%esp)
+  8036a7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036ab:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036af:	e8 f6 fe ff ff       	call   8035aa <dm>
+  8036b4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036b8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036bc:	83 c4 24             	add    $0x24,%esp
+  8036bf:	c3                   	ret
+
+008036c0 <__divdi3>:
+  8036c0:	53                   	push   %ebx
+  8036c1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036c5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036c9:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8036cd:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036d1:	85 d2                	test   %edx,%edx
+  8036d3:	78 15                	js     8036ea <__divdi3+0x2a>
+  8036d5:	85 db                	test   %ebx,%ebx
+  8036d7:	78 34                	js     80370d <__divdi3+0x4d>
+  8036d9:	83 ec 04             	sub    $0x4,%esp
+  8036dc:	6a 00                	push   $0x0
+  8036de:	53                   	push   %ebx
+  8036df:	51                   	push   %ecx
+  8036e0:	e8 c5 fe ff ff       	call   8035aa <dm>
+  8036e5:	83 c4 10             	add    $0x10,%esp
+  8036e8:	eb 21                	jmp    80370b <__divdi3+0x4b>
+  8036ea:	f7 d8                	neg    %eax
+  8036ec:	83 d2 00             	adc    $0x0,%edx
+  8036ef:	f7 da                	neg    %edx
+  8036f1:	85 db                	test   %ebx,%ebx
+  8036f3:	78 30                	js     803725 <__divdi3+0x65>
+  8036f5:	83 ec 04             	sub    $0x4,%esp
+  8036f8:	6a 00                	push   $0x0
+  8036fa:	53                   	push   %ebx
+  8036fb:	51                   	push   %ecx
+  8036fc:	e8 a9 fe ff ff       	call   8035aa <dm>
+  803701:	83 c4 10             	add    $0x10,%esp
+  803704:	f7 d8                	neg    %eax
+  803706:	83 d2 00             	adc    $0x0,%edx
+  803709:	f7 da                	neg    %edx
+  80370b:	5b                   	pop    %ebx
+  80370c:	c3                   	ret
+  80370d:	83 ec 04             	sub    $0x4,%esp
+  803710:	6a 00                	push   $0x0
+  803712:	f7 d9                	neg    %ecx
+  803714:	83 d3 00             	adc    $0x0,%ebx
+  803717:	f7 db                	neg    %ebx
+  803719:	53                   	push   %ebx
+  80371a:	51                   	push   %ecx
+  80371b:	e8 8a fe ff ff       	call   8035aa <dm>
+  803720:	83 c4 10             	add    $0x10,%esp
+  803723:	eb df                	jmp    803704 <__divdi3+0x44>
+  803725:	83 ec 04             	sub    $0x4,%esp
+  803728:	6a 00                	push   $0x0
+  80372a:	f7 d9                	neg    %ecx
+  80372c:	83 d3 00             	adc    $0x0,%ebx
+  80372f:	f7 db                	neg    %ebx
+  803731:	53                   	push   %ebx
+  803732:	51                   	push   %ecx
+  803733:	e8 72 fe ff ff       	call   8035aa <dm>
+  803738:	83 c4 10             	add    $0x10,%esp
+  80373b:	eb ce                	jmp    80370b <__divdi3+0x4b>
+
+0080373d <__moddi3>:
+  80373d:	55                   	push   %ebp
+  80373e:	57                   	push   %edi
+  80373f:	56                   	push   %esi
+  803740:	53                   	push   %ebx
+  803741:	83 ec 24             	sub    $0x24,%esp
+  803744:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803748:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80374c:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803750:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803754:	85 d2                	test   %edx,%edx
+  803756:	78 3b                	js     803793 <__moddi3+0x56>
+  803758:	83 ec 04             	sub    $0x4,%esp
+  80375b:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80375f:	56                   	push   %esi
+  803760:	89 ce                	mov    %ecx,%esi
+  803762:	f7 de                	neg    %esi
+  803764:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803768:	89 de                	mov    %ebx,%esi
+  80376a:	83 d6 00             	adc    $0x0,%esi
+  80376d:	f7 de                	neg    %esi
+  80376f:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803773:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803777:	0f 48 f1             	cmovs  %ecx,%esi
+  80377a:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80377f:	53                   	push   %ebx
+  803780:	56                   	push   %esi
+  803781:	e8 24 fe ff ff       	call   8035aa <dm>
+  803786:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80378a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80378e:	83 c4 10             	add    $0x10,%esp
+  803791:	eb 47                	jmp    8037da <__moddi3+0x9d>
+  803793:	f7 d8                	neg    %eax
+  803795:	83 d2 00             	adc    $0x0,%edx
+  803798:	f7 da                	neg    %edx
+  80379a:	83 ec 04             	sub    $0x4,%esp
+  80379d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8037a1:	56                   	push   %esi
+  8037a2:	89 cf                	mov    %ecx,%edi
+  8037a4:	f7 df                	neg    %edi
+  8037a6:	89 de                	mov    %ebx,%esi
+  8037a8:	83 d6 00             	adc    $0x0,%esi
+  8037ab:	f7 de                	neg    %esi
+  8037ad:	0f 49 cf             	cmovns %edi,%ecx
+  8037b0:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8037b4:	0f 49 de             	cmovns %esi,%ebx
+  8037b7:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8037bb:	ff 74 24 0c          	push   0xc(%esp)
+  8037bf:	ff 74 24 0c          	push   0xc(%esp)
+  8037c3:	e8 e2 fd ff ff       	call   8035aa <dm>
+  8037c8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037cc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037d0:	f7 d8                	neg    %eax
+  8037d2:	83 d2 00             	adc    $0x0,%edx
+  8037d5:	f7 da                	neg    %edx
+  8037d7:	83 c4 10             	add    $0x10,%esp
+  8037da:	83 c4 24             	add    $0x24,%esp
+  8037dd:	5b                   	pop    %ebx
+  8037de:	5e                   	pop    %esi
+  8037df:	5f                   	pop    %edi
+  8037e0:	5d                   	pop    %ebp
+  8037e1:	c3                   	ret
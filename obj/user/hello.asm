@@ -0,0 +1,7634 @@
+
+obj/user/hello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2d 00 00 00       	call   80005e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+// hello, world
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	cprintf("hello, world\n");
+  800039:	68 60 37 80 00       	push   $0x803760
+  80003e:	e8 13 01 00 00       	call   800156 <cprintf>
+	cprintf("i am environment %08x\n", thisenv->env_id);
+  800043:	a1 00 50 80 00       	mov    0x805000,%eax
+  800048:	8b 40 48             	mov    0x48(%eax),%eax
+  80004b:	83 c4 08             	add    $0x8,%esp
+  80004e:	50                   	push   %eax
+  80004f:	68 6e 37 80 00       	push   $0x80376e
+  800054:	e8 fd 00 00 00       	call   800156 <cprintf>
+}
+  800059:	83 c4 10             	add    $0x10,%esp
+  80005c:	c9                   	leave
+  80005d:	c3                   	ret
+
+0080005e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80005e:	55                   	push   %ebp
+  80005f:	89 e5                	mov    %esp,%ebp
+  800061:	56                   	push   %esi
+  800062:	53                   	push   %ebx
+  800063:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800066:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800069:	e8 9c 0a 00 00       	call   800b0a <sys_getenvid>
+  80006e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800073:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800079:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80007e:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800083:	85 db                	test   %ebx,%ebx
+  800085:	7e 07                	jle    80008e <libmain+0x30>
+		binaryname = argv[0];
+  800087:	8b 06                	mov    (%esi),%eax
+  800089:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80008e:	83 ec 08             	sub    $0x8,%esp
+  800091:	56                   	push   %esi
+  800092:	53                   	push   %ebx
+  800093:	e8 9b ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800098:	e8 0a 00 00 00       	call   8000a7 <exit>
+}
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000a3:	5b                   	pop    %ebx
+  8000a4:	5e                   	pop    %esi
+  8000a5:	5d                   	pop    %ebp
+  8000a6:	c3                   	ret
+
+008000a7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000ad:	e8 73 10 00 00       	call   801125 <close_all>
+	sys_env_destroy(0);
+  8000b2:	83 ec 0c             	sub    $0xc,%esp
+  8000b5:	6a 00                	push   $0x0
+  8000b7:	e8 05 0a 00 00       	call   800ac1 <sys_env_destroy>
+}
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	c9                   	leave
+  8000c0:	c3                   	ret
+
+008000c1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000c1:	55                   	push   %ebp
+  8000c2:	89 e5                	mov    %esp,%ebp
+  8000c4:	53                   	push   %ebx
+  8000c5:	83 ec 04             	sub    $0x4,%esp
+  8000c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8000cb:	8b 13                	mov    (%ebx),%edx
+  8000cd:	8d 42 01             	lea    0x1(%edx),%eax
+  8000d0:	89 03                	mov    %eax,(%ebx)
+  8000d2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000d5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8000d9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000de:	74 09                	je     8000e9 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8000e0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000e7:	c9                   	leave
+  8000e8:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8000e9:	83 ec 08             	sub    $0x8,%esp
+  8000ec:	68 ff 00 00 00       	push   $0xff
+  8000f1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000f4:	50                   	push   %eax
+  8000f5:	e8 7a 09 00 00       	call   800a74 <sys_cputs>
+		b->idx = 0;
+  8000fa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800100:	83 c4 10             	add    $0x10,%esp
+  800103:	eb db                	jmp    8000e0 <putch+0x1f>
+
+00800105 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800105:	55                   	push   %ebp
+  800106:	89 e5                	mov    %esp,%ebp
+  800108:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80010e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800115:	00 00 00 
+	b.cnt = 0;
+  800118:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80011f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800122:	ff 75 0c             	push   0xc(%ebp)
+  800125:	ff 75 08             	push   0x8(%ebp)
+  800128:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80012e:	50                   	push   %eax
+  80012f:	68 c1 00 80 00       	push   $0x8000c1
+  800134:	e8 14 01 00 00       	call   80024d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800139:	83 c4 08             	add    $0x8,%esp
+  80013c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800142:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800148:	50                   	push   %eax
+  800149:	e8 26 09 00 00       	call   800a74 <sys_cputs>
+
+	return b.cnt;
+}
+  80014e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+
+00800156 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800156:	55                   	push   %ebp
+  800157:	89 e5                	mov    %esp,%ebp
+  800159:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80015c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80015f:	50                   	push   %eax
+  800160:	ff 75 08             	push   0x8(%ebp)
+  800163:	e8 9d ff ff ff       	call   800105 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800168:	c9                   	leave
+  800169:	c3                   	ret
+
+0080016a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80016a:	55                   	push   %ebp
+  80016b:	89 e5                	mov    %esp,%ebp
+  80016d:	57                   	push   %edi
+  80016e:	56                   	push   %esi
+  80016f:	53                   	push   %ebx
+  800170:	83 ec 1c             	sub    $0x1c,%esp
+  800173:	89 c7                	mov    %eax,%edi
+  800175:	89 d6                	mov    %edx,%esi
+  800177:	8b 45 08             	mov    0x8(%ebp),%eax
+  80017a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80017d:	89 d1                	mov    %edx,%ecx
+  80017f:	89 c2                	mov    %eax,%edx
+  800181:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800184:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800187:	8b 45 10             	mov    0x10(%ebp),%eax
+  80018a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80018d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800190:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800197:	39 c2                	cmp    %eax,%edx
+  800199:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80019c:	72 3e                	jb     8001dc <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80019e:	83 ec 0c             	sub    $0xc,%esp
+  8001a1:	ff 75 18             	push   0x18(%ebp)
+  8001a4:	83 eb 01             	sub    $0x1,%ebx
+  8001a7:	53                   	push   %ebx
+  8001a8:	50                   	push   %eax
+  8001a9:	83 ec 08             	sub    $0x8,%esp
+  8001ac:	ff 75 e4             	push   -0x1c(%ebp)
+  8001af:	ff 75 e0             	push   -0x20(%ebp)
+  8001b2:	ff 75 dc             	push   -0x24(%ebp)
+  8001b5:	ff 75 d8             	push   -0x28(%ebp)
+  8001b8:	e8 37 34 00 00       	call   8035f4 <__udivdi3>
+  8001bd:	83 c4 18             	add    $0x18,%esp
+  8001c0:	52                   	push   %edx
+  8001c1:	50                   	push   %eax
+  8001c2:	89 f2                	mov    %esi,%edx
+  8001c4:	89 f8                	mov    %edi,%eax
+  8001c6:	e8 9f ff ff ff       	call   80016a <printnum>
+  8001cb:	83 c4 20             	add    $0x20,%esp
+  8001ce:	eb 13                	jmp    8001e3 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8001d0:	83 ec 08             	sub    $0x8,%esp
+  8001d3:	56                   	push   %esi
+  8001d4:	ff 75 18             	push   0x18(%ebp)
+  8001d7:	ff d7                	call   *%edi
+  8001d9:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8001dc:	83 eb 01             	sub    $0x1,%ebx
+  8001df:	85 db                	test   %ebx,%ebx
+  8001e1:	7f ed                	jg     8001d0 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8001e3:	83 ec 08             	sub    $0x8,%esp
+  8001e6:	56                   	push   %esi
+  8001e7:	83 ec 04             	sub    $0x4,%esp
+  8001ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8001ed:	ff 75 e0             	push   -0x20(%ebp)
+  8001f0:	ff 75 dc             	push   -0x24(%ebp)
+  8001f3:	ff 75 d8             	push   -0x28(%ebp)
+  8001f6:	e8 17 34 00 00       	call   803612 <__umoddi3>
+  8001fb:	83 c4 14             	add    $0x14,%esp
+  8001fe:	0f be 80 8f 37 80 00 	movsbl 0x80378f(%eax),%eax
+  800205:	50                   	push   %eax
+  800206:	ff d7                	call   *%edi
+}
+  800208:	83 c4 10             	add    $0x10,%esp
+  80020b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020e:	5b                   	pop    %ebx
+  80020f:	5e                   	pop    %esi
+  800210:	5f                   	pop    %edi
+  800211:	5d                   	pop    %ebp
+  800212:	c3                   	ret
+
+00800213 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800213:	55                   	push   %ebp
+  800214:	89 e5                	mov    %esp,%ebp
+  800216:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800219:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80021d:	8b 10                	mov    (%eax),%edx
+  80021f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800222:	73 0a                	jae    80022e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800224:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800227:	89 08                	mov    %ecx,(%eax)
+  800229:	8b 45 08             	mov    0x8(%ebp),%eax
+  80022c:	88 02                	mov    %al,(%edx)
+}
+  80022e:	5d                   	pop    %ebp
+  80022f:	c3                   	ret
+
+00800230 <printfmt>:
+{
+  800230:	55                   	push   %ebp
+  800231:	89 e5                	mov    %esp,%ebp
+  800233:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800236:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800239:	50                   	push   %eax
+  80023a:	ff 75 10             	push   0x10(%ebp)
+  80023d:	ff 75 0c             	push   0xc(%ebp)
+  800240:	ff 75 08             	push   0x8(%ebp)
+  800243:	e8 05 00 00 00       	call   80024d <vprintfmt>
+}
+  800248:	83 c4 10             	add    $0x10,%esp
+  80024b:	c9                   	leave
+  80024c:	c3                   	ret
+
+0080024d <vprintfmt>:
+{
+  80024d:	55                   	push   %ebp
+  80024e:	89 e5                	mov    %esp,%ebp
+  800250:	57                   	push   %edi
+  800251:	56                   	push   %esi
+  800252:	53                   	push   %ebx
+  800253:	83 ec 2c             	sub    $0x2c,%esp
+  800256:	8b 75 08             	mov    0x8(%ebp),%esi
+  800259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80025c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80025f:	eb 0a                	jmp    80026b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800261:	83 ec 08             	sub    $0x8,%esp
+  800264:	53                   	push   %ebx
+  800265:	50                   	push   %eax
+  800266:	ff d6                	call   *%esi
+  800268:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80026b:	83 c7 01             	add    $0x1,%edi
+  80026e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800272:	83 f8 25             	cmp    $0x25,%eax
+  800275:	74 0c                	je     800283 <vprintfmt+0x36>
+			if (ch == '\0')
+  800277:	85 c0                	test   %eax,%eax
+  800279:	75 e6                	jne    800261 <vprintfmt+0x14>
+}
+  80027b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027e:	5b                   	pop    %ebx
+  80027f:	5e                   	pop    %esi
+  800280:	5f                   	pop    %edi
+  800281:	5d                   	pop    %ebp
+  800282:	c3                   	ret
+		padc = ' ';
+  800283:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800287:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80028e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800295:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80029c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002a1:	8d 47 01             	lea    0x1(%edi),%eax
+  8002a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002a7:	0f b6 17             	movzbl (%edi),%edx
+  8002aa:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002ad:	3c 55                	cmp    $0x55,%al
+  8002af:	0f 87 cf 03 00 00    	ja     800684 <vprintfmt+0x437>
+  8002b5:	0f b6 c0             	movzbl %al,%eax
+  8002b8:	ff 24 85 e0 38 80 00 	jmp    *0x8038e0(,%eax,4)
+  8002bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002c2:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002c6:	eb d9                	jmp    8002a1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8002c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002cb:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002cf:	eb d0                	jmp    8002a1 <vprintfmt+0x54>
+  8002d1:	0f b6 d2             	movzbl %dl,%edx
+  8002d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8002d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002dc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8002df:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002e2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8002e6:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8002e9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002ec:	83 f9 09             	cmp    $0x9,%ecx
+  8002ef:	77 55                	ja     800346 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8002f1:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8002f4:	eb e9                	jmp    8002df <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8002f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f9:	8b 00                	mov    (%eax),%eax
+  8002fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800301:	8d 40 04             	lea    0x4(%eax),%eax
+  800304:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800307:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80030a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80030e:	79 91                	jns    8002a1 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800310:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800313:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800316:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80031d:	eb 82                	jmp    8002a1 <vprintfmt+0x54>
+			if (width < 0)
+  80031f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800322:	85 d2                	test   %edx,%edx
+  800324:	b8 00 00 00 00       	mov    $0x0,%eax
+  800329:	0f 49 c2             	cmovns %edx,%eax
+  80032c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80032f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800332:	e9 6a ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800337:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80033a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800341:	e9 5b ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+  800346:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800349:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80034c:	eb bc                	jmp    80030a <vprintfmt+0xbd>
+			lflag++;
+  80034e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800351:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800354:	e9 48 ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800359:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035c:	8d 78 04             	lea    0x4(%eax),%edi
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	53                   	push   %ebx
+  800363:	ff 30                	push   (%eax)
+  800365:	ff d6                	call   *%esi
+			break;
+  800367:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80036a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80036d:	e9 b1 02 00 00       	jmp    800623 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800372:	8b 45 14             	mov    0x14(%ebp),%eax
+  800375:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800378:	8b 10                	mov    (%eax),%edx
+  80037a:	89 d0                	mov    %edx,%eax
+  80037c:	f7 d8                	neg    %eax
+  80037e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800381:	83 f8 11             	cmp    $0x11,%eax
+  800384:	7f 23                	jg     8003a9 <vprintfmt+0x15c>
+  800386:	8b 14 85 40 3a 80 00 	mov    0x803a40(,%eax,4),%edx
+  80038d:	85 d2                	test   %edx,%edx
+  80038f:	74 18                	je     8003a9 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800391:	52                   	push   %edx
+  800392:	68 92 3b 80 00       	push   $0x803b92
+  800397:	53                   	push   %ebx
+  800398:	56                   	push   %esi
+  800399:	e8 92 fe ff ff       	call   800230 <printfmt>
+  80039e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003a1:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003a4:	e9 7a 02 00 00       	jmp    800623 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003a9:	50                   	push   %eax
+  8003aa:	68 a7 37 80 00       	push   $0x8037a7
+  8003af:	53                   	push   %ebx
+  8003b0:	56                   	push   %esi
+  8003b1:	e8 7a fe ff ff       	call   800230 <printfmt>
+  8003b6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003b9:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003bc:	e9 62 02 00 00       	jmp    800623 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c4:	83 c0 04             	add    $0x4,%eax
+  8003c7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cd:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8003cf:	85 c9                	test   %ecx,%ecx
+  8003d1:	b8 a0 37 80 00       	mov    $0x8037a0,%eax
+  8003d6:	0f 45 c1             	cmovne %ecx,%eax
+  8003d9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8003dc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003e0:	7e 06                	jle    8003e8 <vprintfmt+0x19b>
+  8003e2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003e6:	75 0b                	jne    8003f3 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8003e8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003eb:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003ee:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003f1:	eb 5c                	jmp    80044f <vprintfmt+0x202>
+  8003f3:	83 ec 08             	sub    $0x8,%esp
+  8003f6:	ff 75 d0             	push   -0x30(%ebp)
+  8003f9:	ff 75 cc             	push   -0x34(%ebp)
+  8003fc:	e8 20 03 00 00       	call   800721 <strnlen>
+  800401:	89 c2                	mov    %eax,%edx
+  800403:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800406:	29 d0                	sub    %edx,%eax
+  800408:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80040b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80040f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800412:	89 75 08             	mov    %esi,0x8(%ebp)
+  800415:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800417:	eb 0e                	jmp    800427 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800419:	83 ec 08             	sub    $0x8,%esp
+  80041c:	53                   	push   %ebx
+  80041d:	57                   	push   %edi
+  80041e:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800421:	83 ee 01             	sub    $0x1,%esi
+  800424:	83 c4 10             	add    $0x10,%esp
+  800427:	85 f6                	test   %esi,%esi
+  800429:	7f ee                	jg     800419 <vprintfmt+0x1cc>
+  80042b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80042e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800431:	85 c0                	test   %eax,%eax
+  800433:	ba 00 00 00 00       	mov    $0x0,%edx
+  800438:	0f 49 d0             	cmovns %eax,%edx
+  80043b:	29 d0                	sub    %edx,%eax
+  80043d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800440:	eb a6                	jmp    8003e8 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800442:	83 ec 08             	sub    $0x8,%esp
+  800445:	53                   	push   %ebx
+  800446:	52                   	push   %edx
+  800447:	ff 55 08             	call   *0x8(%ebp)
+  80044a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80044d:	89 f1                	mov    %esi,%ecx
+  80044f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800452:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800456:	0f be d0             	movsbl %al,%edx
+  800459:	85 d2                	test   %edx,%edx
+  80045b:	74 28                	je     800485 <vprintfmt+0x238>
+  80045d:	85 ff                	test   %edi,%edi
+  80045f:	78 05                	js     800466 <vprintfmt+0x219>
+  800461:	83 ef 01             	sub    $0x1,%edi
+  800464:	78 30                	js     800496 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800466:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80046a:	74 d6                	je     800442 <vprintfmt+0x1f5>
+  80046c:	0f be c0             	movsbl %al,%eax
+  80046f:	83 e8 20             	sub    $0x20,%eax
+  800472:	83 f8 5e             	cmp    $0x5e,%eax
+  800475:	76 cb                	jbe    800442 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800477:	83 ec 08             	sub    $0x8,%esp
+  80047a:	53                   	push   %ebx
+  80047b:	6a 3f                	push   $0x3f
+  80047d:	ff 55 08             	call   *0x8(%ebp)
+  800480:	83 c4 10             	add    $0x10,%esp
+  800483:	eb c8                	jmp    80044d <vprintfmt+0x200>
+  800485:	8b 75 08             	mov    0x8(%ebp),%esi
+  800488:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80048b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80048e:	01 d0                	add    %edx,%eax
+  800490:	29 c8                	sub    %ecx,%eax
+  800492:	89 c7                	mov    %eax,%edi
+  800494:	eb 13                	jmp    8004a9 <vprintfmt+0x25c>
+  800496:	8b 75 08             	mov    0x8(%ebp),%esi
+  800499:	eb ed                	jmp    800488 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80049b:	83 ec 08             	sub    $0x8,%esp
+  80049e:	53                   	push   %ebx
+  80049f:	6a 20                	push   $0x20
+  8004a1:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004a3:	83 ef 01             	sub    $0x1,%edi
+  8004a6:	83 c4 10             	add    $0x10,%esp
+  8004a9:	85 ff                	test   %edi,%edi
+  8004ab:	7f ee                	jg     80049b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004ad:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004b3:	e9 6b 01 00 00       	jmp    800623 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004b8:	83 f9 01             	cmp    $0x1,%ecx
+  8004bb:	7f 1f                	jg     8004dc <vprintfmt+0x28f>
+	else if (lflag)
+  8004bd:	85 c9                	test   %ecx,%ecx
+  8004bf:	74 67                	je     800528 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c4:	8b 00                	mov    (%eax),%eax
+  8004c6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004c9:	89 c1                	mov    %eax,%ecx
+  8004cb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004ce:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8004d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004da:	eb 17                	jmp    8004f3 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8004dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004df:	8b 50 04             	mov    0x4(%eax),%edx
+  8004e2:	8b 00                	mov    (%eax),%eax
+  8004e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004e7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ed:	8d 40 08             	lea    0x8(%eax),%eax
+  8004f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8004f3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004f6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8004f9:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8004fe:	85 c9                	test   %ecx,%ecx
+  800500:	0f 89 03 01 00 00    	jns    800609 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800506:	83 ec 08             	sub    $0x8,%esp
+  800509:	53                   	push   %ebx
+  80050a:	6a 2d                	push   $0x2d
+  80050c:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80050e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800511:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800514:	f7 da                	neg    %edx
+  800516:	83 d1 00             	adc    $0x0,%ecx
+  800519:	f7 d9                	neg    %ecx
+  80051b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80051e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800523:	e9 e1 00 00 00       	jmp    800609 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8b 00                	mov    (%eax),%eax
+  80052d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800530:	89 c1                	mov    %eax,%ecx
+  800532:	c1 f9 1f             	sar    $0x1f,%ecx
+  800535:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800538:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053b:	8d 40 04             	lea    0x4(%eax),%eax
+  80053e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800541:	eb b0                	jmp    8004f3 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800543:	83 f9 01             	cmp    $0x1,%ecx
+  800546:	7f 1e                	jg     800566 <vprintfmt+0x319>
+	else if (lflag)
+  800548:	85 c9                	test   %ecx,%ecx
+  80054a:	74 32                	je     80057e <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80054c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054f:	8b 10                	mov    (%eax),%edx
+  800551:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800556:	8d 40 04             	lea    0x4(%eax),%eax
+  800559:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80055c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800561:	e9 a3 00 00 00       	jmp    800609 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800566:	8b 45 14             	mov    0x14(%ebp),%eax
+  800569:	8b 10                	mov    (%eax),%edx
+  80056b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80056e:	8d 40 08             	lea    0x8(%eax),%eax
+  800571:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800574:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800579:	e9 8b 00 00 00       	jmp    800609 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80057e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800581:	8b 10                	mov    (%eax),%edx
+  800583:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800588:	8d 40 04             	lea    0x4(%eax),%eax
+  80058b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80058e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800593:	eb 74                	jmp    800609 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800595:	83 f9 01             	cmp    $0x1,%ecx
+  800598:	7f 1b                	jg     8005b5 <vprintfmt+0x368>
+	else if (lflag)
+  80059a:	85 c9                	test   %ecx,%ecx
+  80059c:	74 2c                	je     8005ca <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80059e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a1:	8b 10                	mov    (%eax),%edx
+  8005a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005ae:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005b3:	eb 54                	jmp    800609 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8b 10                	mov    (%eax),%edx
+  8005ba:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005bd:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005c3:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8005c8:	eb 3f                	jmp    800609 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cd:	8b 10                	mov    (%eax),%edx
+  8005cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005da:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8005df:	eb 28                	jmp    800609 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8005e1:	83 ec 08             	sub    $0x8,%esp
+  8005e4:	53                   	push   %ebx
+  8005e5:	6a 30                	push   $0x30
+  8005e7:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8005e9:	83 c4 08             	add    $0x8,%esp
+  8005ec:	53                   	push   %ebx
+  8005ed:	6a 78                	push   $0x78
+  8005ef:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8b 10                	mov    (%eax),%edx
+  8005f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8005fb:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8005fe:	8d 40 04             	lea    0x4(%eax),%eax
+  800601:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800604:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800609:	83 ec 0c             	sub    $0xc,%esp
+  80060c:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800610:	50                   	push   %eax
+  800611:	ff 75 e0             	push   -0x20(%ebp)
+  800614:	57                   	push   %edi
+  800615:	51                   	push   %ecx
+  800616:	52                   	push   %edx
+  800617:	89 da                	mov    %ebx,%edx
+  800619:	89 f0                	mov    %esi,%eax
+  80061b:	e8 4a fb ff ff       	call   80016a <printnum>
+			break;
+  800620:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800623:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800626:	e9 40 fc ff ff       	jmp    80026b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80062b:	83 f9 01             	cmp    $0x1,%ecx
+  80062e:	7f 1b                	jg     80064b <vprintfmt+0x3fe>
+	else if (lflag)
+  800630:	85 c9                	test   %ecx,%ecx
+  800632:	74 2c                	je     800660 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800634:	8b 45 14             	mov    0x14(%ebp),%eax
+  800637:	8b 10                	mov    (%eax),%edx
+  800639:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80063e:	8d 40 04             	lea    0x4(%eax),%eax
+  800641:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800644:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800649:	eb be                	jmp    800609 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80064b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064e:	8b 10                	mov    (%eax),%edx
+  800650:	8b 48 04             	mov    0x4(%eax),%ecx
+  800653:	8d 40 08             	lea    0x8(%eax),%eax
+  800656:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800659:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80065e:	eb a9                	jmp    800609 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800660:	8b 45 14             	mov    0x14(%ebp),%eax
+  800663:	8b 10                	mov    (%eax),%edx
+  800665:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066a:	8d 40 04             	lea    0x4(%eax),%eax
+  80066d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800670:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800675:	eb 92                	jmp    800609 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800677:	83 ec 08             	sub    $0x8,%esp
+  80067a:	53                   	push   %ebx
+  80067b:	6a 25                	push   $0x25
+  80067d:	ff d6                	call   *%esi
+			break;
+  80067f:	83 c4 10             	add    $0x10,%esp
+  800682:	eb 9f                	jmp    800623 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800684:	83 ec 08             	sub    $0x8,%esp
+  800687:	53                   	push   %ebx
+  800688:	6a 25                	push   $0x25
+  80068a:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80068c:	83 c4 10             	add    $0x10,%esp
+  80068f:	89 f8                	mov    %edi,%eax
+  800691:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800695:	74 05                	je     80069c <vprintfmt+0x44f>
+  800697:	83 e8 01             	sub    $0x1,%eax
+  80069a:	eb f5                	jmp    800691 <vprintfmt+0x444>
+  80069c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80069f:	eb 82                	jmp    800623 <vprintfmt+0x3d6>
+
+008006a1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006a1:	55                   	push   %ebp
+  8006a2:	89 e5                	mov    %esp,%ebp
+  8006a4:	83 ec 18             	sub    $0x18,%esp
+  8006a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006ad:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006b0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006b4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006b7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006be:	85 c0                	test   %eax,%eax
+  8006c0:	74 26                	je     8006e8 <vsnprintf+0x47>
+  8006c2:	85 d2                	test   %edx,%edx
+  8006c4:	7e 22                	jle    8006e8 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006c6:	ff 75 14             	push   0x14(%ebp)
+  8006c9:	ff 75 10             	push   0x10(%ebp)
+  8006cc:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006cf:	50                   	push   %eax
+  8006d0:	68 13 02 80 00       	push   $0x800213
+  8006d5:	e8 73 fb ff ff       	call   80024d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8006da:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006dd:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8006e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006e3:	83 c4 10             	add    $0x10,%esp
+}
+  8006e6:	c9                   	leave
+  8006e7:	c3                   	ret
+		return -E_INVAL;
+  8006e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006ed:	eb f7                	jmp    8006e6 <vsnprintf+0x45>
+
+008006ef <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006ef:	55                   	push   %ebp
+  8006f0:	89 e5                	mov    %esp,%ebp
+  8006f2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8006f5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8006f8:	50                   	push   %eax
+  8006f9:	ff 75 10             	push   0x10(%ebp)
+  8006fc:	ff 75 0c             	push   0xc(%ebp)
+  8006ff:	ff 75 08             	push   0x8(%ebp)
+  800702:	e8 9a ff ff ff       	call   8006a1 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800707:	c9                   	leave
+  800708:	c3                   	ret
+
+00800709 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800709:	55                   	push   %ebp
+  80070a:	89 e5                	mov    %esp,%ebp
+  80070c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80070f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800714:	eb 03                	jmp    800719 <strlen+0x10>
+		n++;
+  800716:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800719:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80071d:	75 f7                	jne    800716 <strlen+0xd>
+	return n;
+}
+  80071f:	5d                   	pop    %ebp
+  800720:	c3                   	ret
+
+00800721 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800721:	55                   	push   %ebp
+  800722:	89 e5                	mov    %esp,%ebp
+  800724:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800727:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80072a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80072f:	eb 03                	jmp    800734 <strnlen+0x13>
+		n++;
+  800731:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800734:	39 d0                	cmp    %edx,%eax
+  800736:	74 08                	je     800740 <strnlen+0x1f>
+  800738:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80073c:	75 f3                	jne    800731 <strnlen+0x10>
+  80073e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800740:	89 d0                	mov    %edx,%eax
+  800742:	5d                   	pop    %ebp
+  800743:	c3                   	ret
+
+00800744 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800744:	55                   	push   %ebp
+  800745:	89 e5                	mov    %esp,%ebp
+  800747:	53                   	push   %ebx
+  800748:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80074b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80074e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800753:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800757:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80075a:	83 c0 01             	add    $0x1,%eax
+  80075d:	84 d2                	test   %dl,%dl
+  80075f:	75 f2                	jne    800753 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800761:	89 c8                	mov    %ecx,%eax
+  800763:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800766:	c9                   	leave
+  800767:	c3                   	ret
+
+00800768 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800768:	55                   	push   %ebp
+  800769:	89 e5                	mov    %esp,%ebp
+  80076b:	53                   	push   %ebx
+  80076c:	83 ec 10             	sub    $0x10,%esp
+  80076f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800772:	53                   	push   %ebx
+  800773:	e8 91 ff ff ff       	call   800709 <strlen>
+  800778:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80077b:	ff 75 0c             	push   0xc(%ebp)
+  80077e:	01 d8                	add    %ebx,%eax
+  800780:	50                   	push   %eax
+  800781:	e8 be ff ff ff       	call   800744 <strcpy>
+	return dst;
+}
+  800786:	89 d8                	mov    %ebx,%eax
+  800788:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80078b:	c9                   	leave
+  80078c:	c3                   	ret
+
+0080078d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80078d:	55                   	push   %ebp
+  80078e:	89 e5                	mov    %esp,%ebp
+  800790:	56                   	push   %esi
+  800791:	53                   	push   %ebx
+  800792:	8b 75 08             	mov    0x8(%ebp),%esi
+  800795:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800798:	89 f3                	mov    %esi,%ebx
+  80079a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80079d:	89 f0                	mov    %esi,%eax
+  80079f:	eb 0f                	jmp    8007b0 <strncpy+0x23>
+		*dst++ = *src;
+  8007a1:	83 c0 01             	add    $0x1,%eax
+  8007a4:	0f b6 0a             	movzbl (%edx),%ecx
+  8007a7:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007aa:	80 f9 01             	cmp    $0x1,%cl
+  8007ad:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007b0:	39 d8                	cmp    %ebx,%eax
+  8007b2:	75 ed                	jne    8007a1 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007b4:	89 f0                	mov    %esi,%eax
+  8007b6:	5b                   	pop    %ebx
+  8007b7:	5e                   	pop    %esi
+  8007b8:	5d                   	pop    %ebp
+  8007b9:	c3                   	ret
+
+008007ba <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007ba:	55                   	push   %ebp
+  8007bb:	89 e5                	mov    %esp,%ebp
+  8007bd:	56                   	push   %esi
+  8007be:	53                   	push   %ebx
+  8007bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007c5:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007c8:	89 f0                	mov    %esi,%eax
+  8007ca:	85 d2                	test   %edx,%edx
+  8007cc:	74 21                	je     8007ef <strlcpy+0x35>
+  8007ce:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007d2:	89 f2                	mov    %esi,%edx
+  8007d4:	eb 09                	jmp    8007df <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8007d6:	83 c1 01             	add    $0x1,%ecx
+  8007d9:	83 c2 01             	add    $0x1,%edx
+  8007dc:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8007df:	39 c2                	cmp    %eax,%edx
+  8007e1:	74 09                	je     8007ec <strlcpy+0x32>
+  8007e3:	0f b6 19             	movzbl (%ecx),%ebx
+  8007e6:	84 db                	test   %bl,%bl
+  8007e8:	75 ec                	jne    8007d6 <strlcpy+0x1c>
+  8007ea:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8007ec:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8007ef:	29 f0                	sub    %esi,%eax
+}
+  8007f1:	5b                   	pop    %ebx
+  8007f2:	5e                   	pop    %esi
+  8007f3:	5d                   	pop    %ebp
+  8007f4:	c3                   	ret
+
+008007f5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007f5:	55                   	push   %ebp
+  8007f6:	89 e5                	mov    %esp,%ebp
+  8007f8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8007fe:	eb 06                	jmp    800806 <strcmp+0x11>
+		p++, q++;
+  800800:	83 c1 01             	add    $0x1,%ecx
+  800803:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800806:	0f b6 01             	movzbl (%ecx),%eax
+  800809:	84 c0                	test   %al,%al
+  80080b:	74 04                	je     800811 <strcmp+0x1c>
+  80080d:	3a 02                	cmp    (%edx),%al
+  80080f:	74 ef                	je     800800 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800811:	0f b6 c0             	movzbl %al,%eax
+  800814:	0f b6 12             	movzbl (%edx),%edx
+  800817:	29 d0                	sub    %edx,%eax
+}
+  800819:	5d                   	pop    %ebp
+  80081a:	c3                   	ret
+
+0080081b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80081b:	55                   	push   %ebp
+  80081c:	89 e5                	mov    %esp,%ebp
+  80081e:	53                   	push   %ebx
+  80081f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800822:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800825:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800828:	eb 09                	jmp    800833 <strncmp+0x18>
+		n--, p++, q++;
+  80082a:	83 ea 01             	sub    $0x1,%edx
+  80082d:	83 c0 01             	add    $0x1,%eax
+  800830:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800833:	85 d2                	test   %edx,%edx
+  800835:	74 18                	je     80084f <strncmp+0x34>
+  800837:	0f b6 18             	movzbl (%eax),%ebx
+  80083a:	84 db                	test   %bl,%bl
+  80083c:	74 04                	je     800842 <strncmp+0x27>
+  80083e:	3a 19                	cmp    (%ecx),%bl
+  800840:	74 e8                	je     80082a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800842:	0f b6 00             	movzbl (%eax),%eax
+  800845:	0f b6 11             	movzbl (%ecx),%edx
+  800848:	29 d0                	sub    %edx,%eax
+}
+  80084a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80084d:	c9                   	leave
+  80084e:	c3                   	ret
+		return 0;
+  80084f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800854:	eb f4                	jmp    80084a <strncmp+0x2f>
+
+00800856 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800856:	55                   	push   %ebp
+  800857:	89 e5                	mov    %esp,%ebp
+  800859:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800860:	eb 03                	jmp    800865 <strchr+0xf>
+  800862:	83 c0 01             	add    $0x1,%eax
+  800865:	0f b6 10             	movzbl (%eax),%edx
+  800868:	84 d2                	test   %dl,%dl
+  80086a:	74 06                	je     800872 <strchr+0x1c>
+		if (*s == c)
+  80086c:	38 ca                	cmp    %cl,%dl
+  80086e:	75 f2                	jne    800862 <strchr+0xc>
+  800870:	eb 05                	jmp    800877 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800872:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800877:	5d                   	pop    %ebp
+  800878:	c3                   	ret
+
+00800879 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800879:	55                   	push   %ebp
+  80087a:	89 e5                	mov    %esp,%ebp
+  80087c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800883:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800886:	38 ca                	cmp    %cl,%dl
+  800888:	74 09                	je     800893 <strfind+0x1a>
+  80088a:	84 d2                	test   %dl,%dl
+  80088c:	74 05                	je     800893 <strfind+0x1a>
+	for (; *s; s++)
+  80088e:	83 c0 01             	add    $0x1,%eax
+  800891:	eb f0                	jmp    800883 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800893:	5d                   	pop    %ebp
+  800894:	c3                   	ret
+
+00800895 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800895:	55                   	push   %ebp
+  800896:	89 e5                	mov    %esp,%ebp
+  800898:	57                   	push   %edi
+  800899:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80089c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80089f:	85 c9                	test   %ecx,%ecx
+  8008a1:	74 20                	je     8008c3 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008a3:	89 f8                	mov    %edi,%eax
+  8008a5:	09 c8                	or     %ecx,%eax
+  8008a7:	a8 03                	test   $0x3,%al
+  8008a9:	75 12                	jne    8008bd <memset+0x28>
+		c &= 0xFF;
+  8008ab:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008af:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008b5:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008b8:	fc                   	cld
+  8008b9:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008bb:	eb 06                	jmp    8008c3 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008c0:	fc                   	cld
+  8008c1:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008c3:	89 f8                	mov    %edi,%eax
+  8008c5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008c8:	c9                   	leave
+  8008c9:	c3                   	ret
+
+008008ca <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008ca:	55                   	push   %ebp
+  8008cb:	89 e5                	mov    %esp,%ebp
+  8008cd:	57                   	push   %edi
+  8008ce:	56                   	push   %esi
+  8008cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008d5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8008d8:	39 c6                	cmp    %eax,%esi
+  8008da:	73 32                	jae    80090e <memmove+0x44>
+  8008dc:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008df:	39 d0                	cmp    %edx,%eax
+  8008e1:	73 2b                	jae    80090e <memmove+0x44>
+		s += n;
+		d += n;
+  8008e3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008e6:	89 d6                	mov    %edx,%esi
+  8008e8:	09 fe                	or     %edi,%esi
+  8008ea:	09 ce                	or     %ecx,%esi
+  8008ec:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008f2:	75 0e                	jne    800902 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008f4:	83 ef 04             	sub    $0x4,%edi
+  8008f7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008fa:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8008fd:	fd                   	std
+  8008fe:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800900:	eb 09                	jmp    80090b <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800902:	83 ef 01             	sub    $0x1,%edi
+  800905:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800908:	fd                   	std
+  800909:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80090b:	fc                   	cld
+  80090c:	eb 1a                	jmp    800928 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80090e:	89 f2                	mov    %esi,%edx
+  800910:	09 c2                	or     %eax,%edx
+  800912:	09 ca                	or     %ecx,%edx
+  800914:	f6 c2 03             	test   $0x3,%dl
+  800917:	75 0a                	jne    800923 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800919:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80091c:	89 c7                	mov    %eax,%edi
+  80091e:	fc                   	cld
+  80091f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800921:	eb 05                	jmp    800928 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800923:	89 c7                	mov    %eax,%edi
+  800925:	fc                   	cld
+  800926:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800928:	5e                   	pop    %esi
+  800929:	5f                   	pop    %edi
+  80092a:	5d                   	pop    %ebp
+  80092b:	c3                   	ret
+
+0080092c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80092c:	55                   	push   %ebp
+  80092d:	89 e5                	mov    %esp,%ebp
+  80092f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800932:	ff 75 10             	push   0x10(%ebp)
+  800935:	ff 75 0c             	push   0xc(%ebp)
+  800938:	ff 75 08             	push   0x8(%ebp)
+  80093b:	e8 8a ff ff ff       	call   8008ca <memmove>
+}
+  800940:	c9                   	leave
+  800941:	c3                   	ret
+
+00800942 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800942:	55                   	push   %ebp
+  800943:	89 e5                	mov    %esp,%ebp
+  800945:	56                   	push   %esi
+  800946:	53                   	push   %ebx
+  800947:	8b 45 08             	mov    0x8(%ebp),%eax
+  80094a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80094d:	89 c6                	mov    %eax,%esi
+  80094f:	03 75 10             	add    0x10(%ebp),%esi
+  800952:	eb 06                	jmp    80095a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800954:	83 c0 01             	add    $0x1,%eax
+  800957:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80095a:	39 f0                	cmp    %esi,%eax
+  80095c:	74 14                	je     800972 <memcmp+0x30>
+		if (*s1 != *s2)
+  80095e:	0f b6 08             	movzbl (%eax),%ecx
+  800961:	0f b6 1a             	movzbl (%edx),%ebx
+  800964:	38 d9                	cmp    %bl,%cl
+  800966:	74 ec                	je     800954 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800968:	0f b6 c1             	movzbl %cl,%eax
+  80096b:	0f b6 db             	movzbl %bl,%ebx
+  80096e:	29 d8                	sub    %ebx,%eax
+  800970:	eb 05                	jmp    800977 <memcmp+0x35>
+	}
+
+	return 0;
+  800972:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800977:	5b                   	pop    %ebx
+  800978:	5e                   	pop    %esi
+  800979:	5d                   	pop    %ebp
+  80097a:	c3                   	ret
+
+0080097b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80097b:	55                   	push   %ebp
+  80097c:	89 e5                	mov    %esp,%ebp
+  80097e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800981:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800984:	89 c2                	mov    %eax,%edx
+  800986:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800989:	eb 03                	jmp    80098e <memfind+0x13>
+  80098b:	83 c0 01             	add    $0x1,%eax
+  80098e:	39 d0                	cmp    %edx,%eax
+  800990:	73 04                	jae    800996 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800992:	38 08                	cmp    %cl,(%eax)
+  800994:	75 f5                	jne    80098b <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800996:	5d                   	pop    %ebp
+  800997:	c3                   	ret
+
+00800998 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800998:	55                   	push   %ebp
+  800999:	89 e5                	mov    %esp,%ebp
+  80099b:	57                   	push   %edi
+  80099c:	56                   	push   %esi
+  80099d:	53                   	push   %ebx
+  80099e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009a4:	eb 03                	jmp    8009a9 <strtol+0x11>
+		s++;
+  8009a6:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009a9:	0f b6 02             	movzbl (%edx),%eax
+  8009ac:	3c 20                	cmp    $0x20,%al
+  8009ae:	74 f6                	je     8009a6 <strtol+0xe>
+  8009b0:	3c 09                	cmp    $0x9,%al
+  8009b2:	74 f2                	je     8009a6 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009b4:	3c 2b                	cmp    $0x2b,%al
+  8009b6:	74 2a                	je     8009e2 <strtol+0x4a>
+	int neg = 0;
+  8009b8:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009bd:	3c 2d                	cmp    $0x2d,%al
+  8009bf:	74 2b                	je     8009ec <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009c1:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009c7:	75 0f                	jne    8009d8 <strtol+0x40>
+  8009c9:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009cc:	74 28                	je     8009f6 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8009ce:	85 db                	test   %ebx,%ebx
+  8009d0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009d5:	0f 44 d8             	cmove  %eax,%ebx
+  8009d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009dd:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009e0:	eb 46                	jmp    800a28 <strtol+0x90>
+		s++;
+  8009e2:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8009e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009ea:	eb d5                	jmp    8009c1 <strtol+0x29>
+		s++, neg = 1;
+  8009ec:	83 c2 01             	add    $0x1,%edx
+  8009ef:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009f4:	eb cb                	jmp    8009c1 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009f6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009fa:	74 0e                	je     800a0a <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8009fc:	85 db                	test   %ebx,%ebx
+  8009fe:	75 d8                	jne    8009d8 <strtol+0x40>
+		s++, base = 8;
+  800a00:	83 c2 01             	add    $0x1,%edx
+  800a03:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a08:	eb ce                	jmp    8009d8 <strtol+0x40>
+		s += 2, base = 16;
+  800a0a:	83 c2 02             	add    $0x2,%edx
+  800a0d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a12:	eb c4                	jmp    8009d8 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a14:	0f be c0             	movsbl %al,%eax
+  800a17:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a1a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a1d:	7d 3a                	jge    800a59 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a1f:	83 c2 01             	add    $0x1,%edx
+  800a22:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a26:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a28:	0f b6 02             	movzbl (%edx),%eax
+  800a2b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a2e:	89 f3                	mov    %esi,%ebx
+  800a30:	80 fb 09             	cmp    $0x9,%bl
+  800a33:	76 df                	jbe    800a14 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a35:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a38:	89 f3                	mov    %esi,%ebx
+  800a3a:	80 fb 19             	cmp    $0x19,%bl
+  800a3d:	77 08                	ja     800a47 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a3f:	0f be c0             	movsbl %al,%eax
+  800a42:	83 e8 57             	sub    $0x57,%eax
+  800a45:	eb d3                	jmp    800a1a <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a47:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a4a:	89 f3                	mov    %esi,%ebx
+  800a4c:	80 fb 19             	cmp    $0x19,%bl
+  800a4f:	77 08                	ja     800a59 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a51:	0f be c0             	movsbl %al,%eax
+  800a54:	83 e8 37             	sub    $0x37,%eax
+  800a57:	eb c1                	jmp    800a1a <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a59:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a5d:	74 05                	je     800a64 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a62:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a64:	89 c8                	mov    %ecx,%eax
+  800a66:	f7 d8                	neg    %eax
+  800a68:	85 ff                	test   %edi,%edi
+  800a6a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a6d:	89 c8                	mov    %ecx,%eax
+  800a6f:	5b                   	pop    %ebx
+  800a70:	5e                   	pop    %esi
+  800a71:	5f                   	pop    %edi
+  800a72:	5d                   	pop    %ebp
+  800a73:	c3                   	ret
+
+00800a74 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800a74:	55                   	push   %ebp
+  800a75:	89 e5                	mov    %esp,%ebp
+  800a77:	57                   	push   %edi
+  800a78:	56                   	push   %esi
+  800a79:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800a7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a85:	89 c3                	mov    %eax,%ebx
+  800a87:	89 c7                	mov    %eax,%edi
+  800a89:	55                   	push   %ebp
+  800a8a:	89 e5                	mov    %esp,%ebp
+  800a8c:	8d 35 94 0a 80 00    	lea    0x800a94,%esi
+  800a92:	0f 34                	sysenter
+  800a94:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800a95:	5b                   	pop    %ebx
+  800a96:	5e                   	pop    %esi
+  800a97:	5f                   	pop    %edi
+  800a98:	5d                   	pop    %ebp
+  800a99:	c3                   	ret
+
+00800a9a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800a9a:	55                   	push   %ebp
+  800a9b:	89 e5                	mov    %esp,%ebp
+  800a9d:	57                   	push   %edi
+  800a9e:	56                   	push   %esi
+  800a9f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800aa0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800aa5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800aaa:	89 d1                	mov    %edx,%ecx
+  800aac:	89 d3                	mov    %edx,%ebx
+  800aae:	89 d7                	mov    %edx,%edi
+  800ab0:	55                   	push   %ebp
+  800ab1:	89 e5                	mov    %esp,%ebp
+  800ab3:	8d 35 bb 0a 80 00    	lea    0x800abb,%esi
+  800ab9:	0f 34                	sysenter
+  800abb:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800abc:	5b                   	pop    %ebx
+  800abd:	5e                   	pop    %esi
+  800abe:	5f                   	pop    %edi
+  800abf:	5d                   	pop    %ebp
+  800ac0:	c3                   	ret
+
+00800ac1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ac1:	55                   	push   %ebp
+  800ac2:	89 e5                	mov    %esp,%ebp
+  800ac4:	57                   	push   %edi
+  800ac5:	56                   	push   %esi
+  800ac6:	53                   	push   %ebx
+  800ac7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800aca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800acf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ad2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ad7:	89 cb                	mov    %ecx,%ebx
+  800ad9:	89 cf                	mov    %ecx,%edi
+  800adb:	55                   	push   %ebp
+  800adc:	89 e5                	mov    %esp,%ebp
+  800ade:	8d 35 e6 0a 80 00    	lea    0x800ae6,%esi
+  800ae4:	0f 34                	sysenter
+  800ae6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ae7:	85 c0                	test   %eax,%eax
+  800ae9:	7f 08                	jg     800af3 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800aeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aee:	5b                   	pop    %ebx
+  800aef:	5e                   	pop    %esi
+  800af0:	5f                   	pop    %edi
+  800af1:	5d                   	pop    %ebp
+  800af2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800af3:	83 ec 0c             	sub    $0xc,%esp
+  800af6:	50                   	push   %eax
+  800af7:	6a 03                	push   $0x3
+  800af9:	68 a7 3a 80 00       	push   $0x803aa7
+  800afe:	6a 3d                	push   $0x3d
+  800b00:	68 c4 3a 80 00       	push   $0x803ac4
+  800b05:	e8 02 24 00 00       	call   802f0c <_panic>
+
+00800b0a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b0a:	55                   	push   %ebp
+  800b0b:	89 e5                	mov    %esp,%ebp
+  800b0d:	57                   	push   %edi
+  800b0e:	56                   	push   %esi
+  800b0f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b10:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b15:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b1a:	89 d1                	mov    %edx,%ecx
+  800b1c:	89 d3                	mov    %edx,%ebx
+  800b1e:	89 d7                	mov    %edx,%edi
+  800b20:	55                   	push   %ebp
+  800b21:	89 e5                	mov    %esp,%ebp
+  800b23:	8d 35 2b 0b 80 00    	lea    0x800b2b,%esi
+  800b29:	0f 34                	sysenter
+  800b2b:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800b2c:	5b                   	pop    %ebx
+  800b2d:	5e                   	pop    %esi
+  800b2e:	5f                   	pop    %edi
+  800b2f:	5d                   	pop    %ebp
+  800b30:	c3                   	ret
+
+00800b31 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b31:	55                   	push   %ebp
+  800b32:	89 e5                	mov    %esp,%ebp
+  800b34:	57                   	push   %edi
+  800b35:	56                   	push   %esi
+  800b36:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b37:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b3c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b41:	89 d1                	mov    %edx,%ecx
+  800b43:	89 d3                	mov    %edx,%ebx
+  800b45:	89 d7                	mov    %edx,%edi
+  800b47:	89 d6                	mov    %edx,%esi
+  800b49:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b4b:	5b                   	pop    %ebx
+  800b4c:	5e                   	pop    %esi
+  800b4d:	5f                   	pop    %edi
+  800b4e:	5d                   	pop    %ebp
+  800b4f:	c3                   	ret
+
+00800b50 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800b50:	55                   	push   %ebp
+  800b51:	89 e5                	mov    %esp,%ebp
+  800b53:	57                   	push   %edi
+  800b54:	56                   	push   %esi
+  800b55:	53                   	push   %ebx
+  800b56:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b5f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b64:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b69:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b6c:	55                   	push   %ebp
+  800b6d:	89 e5                	mov    %esp,%ebp
+  800b6f:	8d 35 77 0b 80 00    	lea    0x800b77,%esi
+  800b75:	0f 34                	sysenter
+  800b77:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b78:	85 c0                	test   %eax,%eax
+  800b7a:	7f 08                	jg     800b84 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800b7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b7f:	5b                   	pop    %ebx
+  800b80:	5e                   	pop    %esi
+  800b81:	5f                   	pop    %edi
+  800b82:	5d                   	pop    %ebp
+  800b83:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b84:	83 ec 0c             	sub    $0xc,%esp
+  800b87:	50                   	push   %eax
+  800b88:	6a 04                	push   $0x4
+  800b8a:	68 a7 3a 80 00       	push   $0x803aa7
+  800b8f:	6a 3d                	push   $0x3d
+  800b91:	68 c4 3a 80 00       	push   $0x803ac4
+  800b96:	e8 71 23 00 00       	call   802f0c <_panic>
+
+00800b9b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800b9b:	55                   	push   %ebp
+  800b9c:	89 e5                	mov    %esp,%ebp
+  800b9e:	57                   	push   %edi
+  800b9f:	56                   	push   %esi
+  800ba0:	53                   	push   %ebx
+  800ba1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ba4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800baa:	b8 05 00 00 00       	mov    $0x5,%eax
+  800baf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bb2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bb5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bb8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bba:	85 c0                	test   %eax,%eax
+  800bbc:	7f 08                	jg     800bc6 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800bbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc1:	5b                   	pop    %ebx
+  800bc2:	5e                   	pop    %esi
+  800bc3:	5f                   	pop    %edi
+  800bc4:	5d                   	pop    %ebp
+  800bc5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bc6:	83 ec 0c             	sub    $0xc,%esp
+  800bc9:	50                   	push   %eax
+  800bca:	6a 05                	push   $0x5
+  800bcc:	68 a7 3a 80 00       	push   $0x803aa7
+  800bd1:	6a 23                	push   $0x23
+  800bd3:	68 c4 3a 80 00       	push   $0x803ac4
+  800bd8:	e8 2f 23 00 00       	call   802f0c <_panic>
+
+00800bdd <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800bdd:	55                   	push   %ebp
+  800bde:	89 e5                	mov    %esp,%ebp
+  800be0:	57                   	push   %edi
+  800be1:	56                   	push   %esi
+  800be2:	53                   	push   %ebx
+  800be3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800be6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800beb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf1:	b8 06 00 00 00       	mov    $0x6,%eax
+  800bf6:	89 df                	mov    %ebx,%edi
+  800bf8:	55                   	push   %ebp
+  800bf9:	89 e5                	mov    %esp,%ebp
+  800bfb:	8d 35 03 0c 80 00    	lea    0x800c03,%esi
+  800c01:	0f 34                	sysenter
+  800c03:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c04:	85 c0                	test   %eax,%eax
+  800c06:	7f 08                	jg     800c10 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800c08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c0b:	5b                   	pop    %ebx
+  800c0c:	5e                   	pop    %esi
+  800c0d:	5f                   	pop    %edi
+  800c0e:	5d                   	pop    %ebp
+  800c0f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c10:	83 ec 0c             	sub    $0xc,%esp
+  800c13:	50                   	push   %eax
+  800c14:	6a 06                	push   $0x6
+  800c16:	68 a7 3a 80 00       	push   $0x803aa7
+  800c1b:	6a 3d                	push   $0x3d
+  800c1d:	68 c4 3a 80 00       	push   $0x803ac4
+  800c22:	e8 e5 22 00 00       	call   802f0c <_panic>
+
+00800c27 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800c27:	55                   	push   %ebp
+  800c28:	89 e5                	mov    %esp,%ebp
+  800c2a:	57                   	push   %edi
+  800c2b:	56                   	push   %esi
+  800c2c:	53                   	push   %ebx
+  800c2d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3b:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c40:	89 df                	mov    %ebx,%edi
+  800c42:	55                   	push   %ebp
+  800c43:	89 e5                	mov    %esp,%ebp
+  800c45:	8d 35 4d 0c 80 00    	lea    0x800c4d,%esi
+  800c4b:	0f 34                	sysenter
+  800c4d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c4e:	85 c0                	test   %eax,%eax
+  800c50:	7f 08                	jg     800c5a <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800c52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c55:	5b                   	pop    %ebx
+  800c56:	5e                   	pop    %esi
+  800c57:	5f                   	pop    %edi
+  800c58:	5d                   	pop    %ebp
+  800c59:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c5a:	83 ec 0c             	sub    $0xc,%esp
+  800c5d:	50                   	push   %eax
+  800c5e:	6a 08                	push   $0x8
+  800c60:	68 a7 3a 80 00       	push   $0x803aa7
+  800c65:	6a 3d                	push   $0x3d
+  800c67:	68 c4 3a 80 00       	push   $0x803ac4
+  800c6c:	e8 9b 22 00 00       	call   802f0c <_panic>
+
+00800c71 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800c71:	55                   	push   %ebp
+  800c72:	89 e5                	mov    %esp,%ebp
+  800c74:	57                   	push   %edi
+  800c75:	56                   	push   %esi
+  800c76:	53                   	push   %ebx
+  800c77:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c85:	b8 09 00 00 00       	mov    $0x9,%eax
+  800c8a:	89 df                	mov    %ebx,%edi
+  800c8c:	55                   	push   %ebp
+  800c8d:	89 e5                	mov    %esp,%ebp
+  800c8f:	8d 35 97 0c 80 00    	lea    0x800c97,%esi
+  800c95:	0f 34                	sysenter
+  800c97:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c98:	85 c0                	test   %eax,%eax
+  800c9a:	7f 08                	jg     800ca4 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800c9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9f:	5b                   	pop    %ebx
+  800ca0:	5e                   	pop    %esi
+  800ca1:	5f                   	pop    %edi
+  800ca2:	5d                   	pop    %ebp
+  800ca3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca4:	83 ec 0c             	sub    $0xc,%esp
+  800ca7:	50                   	push   %eax
+  800ca8:	6a 09                	push   $0x9
+  800caa:	68 a7 3a 80 00       	push   $0x803aa7
+  800caf:	6a 3d                	push   $0x3d
+  800cb1:	68 c4 3a 80 00       	push   $0x803ac4
+  800cb6:	e8 51 22 00 00       	call   802f0c <_panic>
+
+00800cbb <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800cbb:	55                   	push   %ebp
+  800cbc:	89 e5                	mov    %esp,%ebp
+  800cbe:	57                   	push   %edi
+  800cbf:	56                   	push   %esi
+  800cc0:	53                   	push   %ebx
+  800cc1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ccc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ccf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cd4:	89 df                	mov    %ebx,%edi
+  800cd6:	55                   	push   %ebp
+  800cd7:	89 e5                	mov    %esp,%ebp
+  800cd9:	8d 35 e1 0c 80 00    	lea    0x800ce1,%esi
+  800cdf:	0f 34                	sysenter
+  800ce1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ce2:	85 c0                	test   %eax,%eax
+  800ce4:	7f 08                	jg     800cee <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800ce6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce9:	5b                   	pop    %ebx
+  800cea:	5e                   	pop    %esi
+  800ceb:	5f                   	pop    %edi
+  800cec:	5d                   	pop    %ebp
+  800ced:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cee:	83 ec 0c             	sub    $0xc,%esp
+  800cf1:	50                   	push   %eax
+  800cf2:	6a 0a                	push   $0xa
+  800cf4:	68 a7 3a 80 00       	push   $0x803aa7
+  800cf9:	6a 3d                	push   $0x3d
+  800cfb:	68 c4 3a 80 00       	push   $0x803ac4
+  800d00:	e8 07 22 00 00       	call   802f0c <_panic>
+
+00800d05 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800d05:	55                   	push   %ebp
+  800d06:	89 e5                	mov    %esp,%ebp
+  800d08:	57                   	push   %edi
+  800d09:	56                   	push   %esi
+  800d0a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d11:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d19:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d1c:	55                   	push   %ebp
+  800d1d:	89 e5                	mov    %esp,%ebp
+  800d1f:	8d 35 27 0d 80 00    	lea    0x800d27,%esi
+  800d25:	0f 34                	sysenter
+  800d27:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800d28:	5b                   	pop    %ebx
+  800d29:	5e                   	pop    %esi
+  800d2a:	5f                   	pop    %edi
+  800d2b:	5d                   	pop    %ebp
+  800d2c:	c3                   	ret
+
+00800d2d <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	57                   	push   %edi
+  800d31:	56                   	push   %esi
+  800d32:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d39:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d41:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d44:	55                   	push   %ebp
+  800d45:	89 e5                	mov    %esp,%ebp
+  800d47:	8d 35 4f 0d 80 00    	lea    0x800d4f,%esi
+  800d4d:	0f 34                	sysenter
+  800d4f:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800d50:	5b                   	pop    %ebx
+  800d51:	5e                   	pop    %esi
+  800d52:	5f                   	pop    %edi
+  800d53:	5d                   	pop    %ebp
+  800d54:	c3                   	ret
+
+00800d55 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800d55:	55                   	push   %ebp
+  800d56:	89 e5                	mov    %esp,%ebp
+  800d58:	57                   	push   %edi
+  800d59:	56                   	push   %esi
+  800d5a:	53                   	push   %ebx
+  800d5b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d5e:	be 00 00 00 00       	mov    $0x0,%esi
+  800d63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d69:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800d6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d71:	89 f7                	mov    %esi,%edi
+  800d73:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d75:	85 c0                	test   %eax,%eax
+  800d77:	7f 08                	jg     800d81 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800d79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d7c:	5b                   	pop    %ebx
+  800d7d:	5e                   	pop    %esi
+  800d7e:	5f                   	pop    %edi
+  800d7f:	5d                   	pop    %ebp
+  800d80:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d81:	83 ec 0c             	sub    $0xc,%esp
+  800d84:	50                   	push   %eax
+  800d85:	6a 0d                	push   $0xd
+  800d87:	68 a7 3a 80 00       	push   $0x803aa7
+  800d8c:	6a 23                	push   $0x23
+  800d8e:	68 c4 3a 80 00       	push   $0x803ac4
+  800d93:	e8 74 21 00 00       	call   802f0c <_panic>
+
+00800d98 <sys_ipc_recv>:
+{
+  800d98:	55                   	push   %ebp
+  800d99:	89 e5                	mov    %esp,%ebp
+  800d9b:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800d9e:	6a 00                	push   $0x0
+  800da0:	6a 01                	push   $0x1
+  800da2:	ff 75 08             	push   0x8(%ebp)
+  800da5:	e8 ab ff ff ff       	call   800d55 <sys_ipc_recvv>
+}
+  800daa:	c9                   	leave
+  800dab:	c3                   	ret
+
+00800dac <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800dac:	55                   	push   %ebp
+  800dad:	89 e5                	mov    %esp,%ebp
+  800daf:	57                   	push   %edi
+  800db0:	56                   	push   %esi
+  800db1:	53                   	push   %ebx
+  800db2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800db5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800dc5:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800dc8:	89 de                	mov    %ebx,%esi
+  800dca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dcc:	85 c0                	test   %eax,%eax
+  800dce:	7f 08                	jg     800dd8 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd3:	5b                   	pop    %ebx
+  800dd4:	5e                   	pop    %esi
+  800dd5:	5f                   	pop    %edi
+  800dd6:	5d                   	pop    %ebp
+  800dd7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd8:	83 ec 0c             	sub    $0xc,%esp
+  800ddb:	50                   	push   %eax
+  800ddc:	6a 0d                	push   $0xd
+  800dde:	68 a7 3a 80 00       	push   $0x803aa7
+  800de3:	6a 23                	push   $0x23
+  800de5:	68 c4 3a 80 00       	push   $0x803ac4
+  800dea:	e8 1d 21 00 00       	call   802f0c <_panic>
+
+00800def <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800def:	55                   	push   %ebp
+  800df0:	89 e5                	mov    %esp,%ebp
+  800df2:	57                   	push   %edi
+  800df3:	56                   	push   %esi
+  800df4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800df5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dfa:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800dff:	89 d1                	mov    %edx,%ecx
+  800e01:	89 d3                	mov    %edx,%ebx
+  800e03:	89 d7                	mov    %edx,%edi
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	8d 35 10 0e 80 00    	lea    0x800e10,%esi
+  800e0e:	0f 34                	sysenter
+  800e10:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800e11:	5b                   	pop    %ebx
+  800e12:	5e                   	pop    %esi
+  800e13:	5f                   	pop    %edi
+  800e14:	5d                   	pop    %ebp
+  800e15:	c3                   	ret
+
+00800e16 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800e16:	55                   	push   %ebp
+  800e17:	89 e5                	mov    %esp,%ebp
+  800e19:	57                   	push   %edi
+  800e1a:	56                   	push   %esi
+  800e1b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e27:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e2c:	89 df                	mov    %ebx,%edi
+  800e2e:	55                   	push   %ebp
+  800e2f:	89 e5                	mov    %esp,%ebp
+  800e31:	8d 35 39 0e 80 00    	lea    0x800e39,%esi
+  800e37:	0f 34                	sysenter
+  800e39:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800e3a:	5b                   	pop    %ebx
+  800e3b:	5e                   	pop    %esi
+  800e3c:	5f                   	pop    %edi
+  800e3d:	5d                   	pop    %ebp
+  800e3e:	c3                   	ret
+
+00800e3f <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800e3f:	55                   	push   %ebp
+  800e40:	89 e5                	mov    %esp,%ebp
+  800e42:	57                   	push   %edi
+  800e43:	56                   	push   %esi
+  800e44:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e45:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e52:	89 cb                	mov    %ecx,%ebx
+  800e54:	89 cf                	mov    %ecx,%edi
+  800e56:	55                   	push   %ebp
+  800e57:	89 e5                	mov    %esp,%ebp
+  800e59:	8d 35 61 0e 80 00    	lea    0x800e61,%esi
+  800e5f:	0f 34                	sysenter
+  800e61:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800e62:	5b                   	pop    %ebx
+  800e63:	5e                   	pop    %esi
+  800e64:	5f                   	pop    %edi
+  800e65:	5d                   	pop    %ebp
+  800e66:	c3                   	ret
+
+00800e67 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	57                   	push   %edi
+  800e6b:	56                   	push   %esi
+  800e6c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e78:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e7d:	89 df                	mov    %ebx,%edi
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	8d 35 8a 0e 80 00    	lea    0x800e8a,%esi
+  800e88:	0f 34                	sysenter
+  800e8a:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800e8b:	5b                   	pop    %ebx
+  800e8c:	5e                   	pop    %esi
+  800e8d:	5f                   	pop    %edi
+  800e8e:	5d                   	pop    %ebp
+  800e8f:	c3                   	ret
+
+00800e90 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800e90:	55                   	push   %ebp
+  800e91:	89 e5                	mov    %esp,%ebp
+  800e93:	57                   	push   %edi
+  800e94:	56                   	push   %esi
+  800e95:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea1:	b8 14 00 00 00       	mov    $0x14,%eax
+  800ea6:	89 df                	mov    %ebx,%edi
+  800ea8:	55                   	push   %ebp
+  800ea9:	89 e5                	mov    %esp,%ebp
+  800eab:	8d 35 b3 0e 80 00    	lea    0x800eb3,%esi
+  800eb1:	0f 34                	sysenter
+  800eb3:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800eb4:	5b                   	pop    %ebx
+  800eb5:	5e                   	pop    %esi
+  800eb6:	5f                   	pop    %edi
+  800eb7:	5d                   	pop    %ebp
+  800eb8:	c3                   	ret
+
+00800eb9 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800eb9:	55                   	push   %ebp
+  800eba:	89 e5                	mov    %esp,%ebp
+  800ebc:	57                   	push   %edi
+  800ebd:	56                   	push   %esi
+  800ebe:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ebf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec5:	b8 13 00 00 00       	mov    $0x13,%eax
+  800eca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ed0:	55                   	push   %ebp
+  800ed1:	89 e5                	mov    %esp,%ebp
+  800ed3:	8d 35 db 0e 80 00    	lea    0x800edb,%esi
+  800ed9:	0f 34                	sysenter
+  800edb:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800edc:	5b                   	pop    %ebx
+  800edd:	5e                   	pop    %esi
+  800ede:	5f                   	pop    %edi
+  800edf:	5d                   	pop    %ebp
+  800ee0:	c3                   	ret
+
+00800ee1 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	57                   	push   %edi
+  800ee5:	56                   	push   %esi
+  800ee6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ee7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eef:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ef4:	89 cb                	mov    %ecx,%ebx
+  800ef6:	89 cf                	mov    %ecx,%edi
+  800ef8:	89 ce                	mov    %ecx,%esi
+  800efa:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800efc:	5b                   	pop    %ebx
+  800efd:	5e                   	pop    %esi
+  800efe:	5f                   	pop    %edi
+  800eff:	5d                   	pop    %ebp
+  800f00:	c3                   	ret
+
+00800f01 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800f01:	55                   	push   %ebp
+  800f02:	89 e5                	mov    %esp,%ebp
+  800f04:	57                   	push   %edi
+  800f05:	56                   	push   %esi
+  800f06:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0f:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f14:	89 cb                	mov    %ecx,%ebx
+  800f16:	89 cf                	mov    %ecx,%edi
+  800f18:	55                   	push   %ebp
+  800f19:	89 e5                	mov    %esp,%ebp
+  800f1b:	8d 35 23 0f 80 00    	lea    0x800f23,%esi
+  800f21:	0f 34                	sysenter
+  800f23:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800f24:	5b                   	pop    %ebx
+  800f25:	5e                   	pop    %esi
+  800f26:	5f                   	pop    %edi
+  800f27:	5d                   	pop    %ebp
+  800f28:	c3                   	ret
+
+00800f29 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800f29:	55                   	push   %ebp
+  800f2a:	89 e5                	mov    %esp,%ebp
+  800f2c:	57                   	push   %edi
+  800f2d:	56                   	push   %esi
+  800f2e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f37:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f3c:	89 cb                	mov    %ecx,%ebx
+  800f3e:	89 cf                	mov    %ecx,%edi
+  800f40:	55                   	push   %ebp
+  800f41:	89 e5                	mov    %esp,%ebp
+  800f43:	8d 35 4b 0f 80 00    	lea    0x800f4b,%esi
+  800f49:	0f 34                	sysenter
+  800f4b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800f4c:	5b                   	pop    %ebx
+  800f4d:	5e                   	pop    %esi
+  800f4e:	5f                   	pop    %edi
+  800f4f:	5d                   	pop    %ebp
+  800f50:	c3                   	ret
+
+00800f51 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800f51:	55                   	push   %ebp
+  800f52:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f54:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f57:	05 00 00 00 30       	add    $0x30000000,%eax
+  800f5c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800f5f:	5d                   	pop    %ebp
+  800f60:	c3                   	ret
+
+00800f61 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800f61:	55                   	push   %ebp
+  800f62:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f64:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f67:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800f6c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800f71:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800f76:	5d                   	pop    %ebp
+  800f77:	c3                   	ret
+
+00800f78 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800f78:	55                   	push   %ebp
+  800f79:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800f7b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800f80:	eb 02                	jmp    800f84 <fd_alloc+0xc>
+  800f82:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800f84:	89 c2                	mov    %eax,%edx
+  800f86:	c1 ea 16             	shr    $0x16,%edx
+  800f89:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800f90:	f6 c2 01             	test   $0x1,%dl
+  800f93:	74 2b                	je     800fc0 <fd_alloc+0x48>
+  800f95:	89 c2                	mov    %eax,%edx
+  800f97:	c1 ea 0c             	shr    $0xc,%edx
+  800f9a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800fa1:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800fa7:	f6 c1 01             	test   $0x1,%cl
+  800faa:	74 14                	je     800fc0 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800fac:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800fb2:	75 ce                	jne    800f82 <fd_alloc+0xa>
+  800fb4:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800fb9:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800fbe:	eb 05                	jmp    800fc5 <fd_alloc+0x4d>
+			return 0;
+  800fc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800fc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc8:	89 02                	mov    %eax,(%edx)
+}
+  800fca:	89 c8                	mov    %ecx,%eax
+  800fcc:	5d                   	pop    %ebp
+  800fcd:	c3                   	ret
+
+00800fce <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800fd4:	83 f8 1f             	cmp    $0x1f,%eax
+  800fd7:	77 30                	ja     801009 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800fd9:	c1 e0 0c             	shl    $0xc,%eax
+  800fdc:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800fe1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800fe7:	f6 c2 01             	test   $0x1,%dl
+  800fea:	74 24                	je     801010 <fd_lookup+0x42>
+  800fec:	89 c2                	mov    %eax,%edx
+  800fee:	c1 ea 0c             	shr    $0xc,%edx
+  800ff1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800ff8:	f6 c2 01             	test   $0x1,%dl
+  800ffb:	74 1a                	je     801017 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800ffd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801000:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801002:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801007:	5d                   	pop    %ebp
+  801008:	c3                   	ret
+		return -E_INVAL;
+  801009:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80100e:	eb f7                	jmp    801007 <fd_lookup+0x39>
+		return -E_INVAL;
+  801010:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801015:	eb f0                	jmp    801007 <fd_lookup+0x39>
+  801017:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80101c:	eb e9                	jmp    801007 <fd_lookup+0x39>
+
+0080101e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80101e:	55                   	push   %ebp
+  80101f:	89 e5                	mov    %esp,%ebp
+  801021:	53                   	push   %ebx
+  801022:	83 ec 04             	sub    $0x4,%esp
+  801025:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801028:	b8 00 00 00 00       	mov    $0x0,%eax
+  80102d:	eb 03                	jmp    801032 <dev_lookup+0x14>
+  80102f:	83 c0 01             	add    $0x1,%eax
+  801032:	8b 1c 85 50 3b 80 00 	mov    0x803b50(,%eax,4),%ebx
+  801039:	85 db                	test   %ebx,%ebx
+  80103b:	74 0b                	je     801048 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80103d:	39 13                	cmp    %edx,(%ebx)
+  80103f:	75 ee                	jne    80102f <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801041:	b8 00 00 00 00       	mov    $0x0,%eax
+  801046:	eb 1f                	jmp    801067 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801048:	a1 00 50 80 00       	mov    0x805000,%eax
+  80104d:	8b 40 48             	mov    0x48(%eax),%eax
+  801050:	83 ec 04             	sub    $0x4,%esp
+  801053:	52                   	push   %edx
+  801054:	50                   	push   %eax
+  801055:	68 d4 3a 80 00       	push   $0x803ad4
+  80105a:	e8 f7 f0 ff ff       	call   800156 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80105f:	83 c4 10             	add    $0x10,%esp
+  801062:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801067:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80106a:	89 1a                	mov    %ebx,(%edx)
+}
+  80106c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80106f:	c9                   	leave
+  801070:	c3                   	ret
+
+00801071 <fd_close>:
+{
+  801071:	55                   	push   %ebp
+  801072:	89 e5                	mov    %esp,%ebp
+  801074:	57                   	push   %edi
+  801075:	56                   	push   %esi
+  801076:	53                   	push   %ebx
+  801077:	83 ec 24             	sub    $0x24,%esp
+  80107a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80107d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801080:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801083:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801084:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80108a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80108d:	50                   	push   %eax
+  80108e:	e8 3b ff ff ff       	call   800fce <fd_lookup>
+  801093:	89 c3                	mov    %eax,%ebx
+  801095:	83 c4 10             	add    $0x10,%esp
+  801098:	85 c0                	test   %eax,%eax
+  80109a:	78 05                	js     8010a1 <fd_close+0x30>
+	    || fd != fd2)
+  80109c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80109f:	74 16                	je     8010b7 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8010a1:	89 f8                	mov    %edi,%eax
+  8010a3:	84 c0                	test   %al,%al
+  8010a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010aa:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8010ad:	89 d8                	mov    %ebx,%eax
+  8010af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b2:	5b                   	pop    %ebx
+  8010b3:	5e                   	pop    %esi
+  8010b4:	5f                   	pop    %edi
+  8010b5:	5d                   	pop    %ebp
+  8010b6:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8010b7:	83 ec 08             	sub    $0x8,%esp
+  8010ba:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8010bd:	50                   	push   %eax
+  8010be:	ff 36                	push   (%esi)
+  8010c0:	e8 59 ff ff ff       	call   80101e <dev_lookup>
+  8010c5:	89 c3                	mov    %eax,%ebx
+  8010c7:	83 c4 10             	add    $0x10,%esp
+  8010ca:	85 c0                	test   %eax,%eax
+  8010cc:	78 1a                	js     8010e8 <fd_close+0x77>
+		if (dev->dev_close)
+  8010ce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8010d1:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8010d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8010d9:	85 c0                	test   %eax,%eax
+  8010db:	74 0b                	je     8010e8 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8010dd:	83 ec 0c             	sub    $0xc,%esp
+  8010e0:	56                   	push   %esi
+  8010e1:	ff d0                	call   *%eax
+  8010e3:	89 c3                	mov    %eax,%ebx
+  8010e5:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8010e8:	83 ec 08             	sub    $0x8,%esp
+  8010eb:	56                   	push   %esi
+  8010ec:	6a 00                	push   $0x0
+  8010ee:	e8 ea fa ff ff       	call   800bdd <sys_page_unmap>
+	return r;
+  8010f3:	83 c4 10             	add    $0x10,%esp
+  8010f6:	eb b5                	jmp    8010ad <fd_close+0x3c>
+
+008010f8 <close>:
+
+int
+close(int fdnum)
+{
+  8010f8:	55                   	push   %ebp
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8010fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801101:	50                   	push   %eax
+  801102:	ff 75 08             	push   0x8(%ebp)
+  801105:	e8 c4 fe ff ff       	call   800fce <fd_lookup>
+  80110a:	83 c4 10             	add    $0x10,%esp
+  80110d:	85 c0                	test   %eax,%eax
+  80110f:	79 02                	jns    801113 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801111:	c9                   	leave
+  801112:	c3                   	ret
+		return fd_close(fd, 1);
+  801113:	83 ec 08             	sub    $0x8,%esp
+  801116:	6a 01                	push   $0x1
+  801118:	ff 75 f4             	push   -0xc(%ebp)
+  80111b:	e8 51 ff ff ff       	call   801071 <fd_close>
+  801120:	83 c4 10             	add    $0x10,%esp
+  801123:	eb ec                	jmp    801111 <close+0x19>
+
+00801125 <close_all>:
+
+void
+close_all(void)
+{
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	53                   	push   %ebx
+  801129:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80112c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801131:	83 ec 0c             	sub    $0xc,%esp
+  801134:	53                   	push   %ebx
+  801135:	e8 be ff ff ff       	call   8010f8 <close>
+	for (i = 0; i < MAXFD; i++)
+  80113a:	83 c3 01             	add    $0x1,%ebx
+  80113d:	83 c4 10             	add    $0x10,%esp
+  801140:	83 fb 20             	cmp    $0x20,%ebx
+  801143:	75 ec                	jne    801131 <close_all+0xc>
+}
+  801145:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801148:	c9                   	leave
+  801149:	c3                   	ret
+
+0080114a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80114a:	55                   	push   %ebp
+  80114b:	89 e5                	mov    %esp,%ebp
+  80114d:	57                   	push   %edi
+  80114e:	56                   	push   %esi
+  80114f:	53                   	push   %ebx
+  801150:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801153:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801156:	50                   	push   %eax
+  801157:	ff 75 08             	push   0x8(%ebp)
+  80115a:	e8 6f fe ff ff       	call   800fce <fd_lookup>
+  80115f:	89 c3                	mov    %eax,%ebx
+  801161:	83 c4 10             	add    $0x10,%esp
+  801164:	85 c0                	test   %eax,%eax
+  801166:	78 7f                	js     8011e7 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801168:	83 ec 0c             	sub    $0xc,%esp
+  80116b:	ff 75 0c             	push   0xc(%ebp)
+  80116e:	e8 85 ff ff ff       	call   8010f8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801173:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801176:	c1 e6 0c             	shl    $0xc,%esi
+  801179:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80117f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801182:	89 3c 24             	mov    %edi,(%esp)
+  801185:	e8 d7 fd ff ff       	call   800f61 <fd2data>
+  80118a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80118c:	89 34 24             	mov    %esi,(%esp)
+  80118f:	e8 cd fd ff ff       	call   800f61 <fd2data>
+  801194:	83 c4 10             	add    $0x10,%esp
+  801197:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80119a:	89 d8                	mov    %ebx,%eax
+  80119c:	c1 e8 16             	shr    $0x16,%eax
+  80119f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8011a6:	a8 01                	test   $0x1,%al
+  8011a8:	74 11                	je     8011bb <dup+0x71>
+  8011aa:	89 d8                	mov    %ebx,%eax
+  8011ac:	c1 e8 0c             	shr    $0xc,%eax
+  8011af:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011b6:	f6 c2 01             	test   $0x1,%dl
+  8011b9:	75 36                	jne    8011f1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8011bb:	89 f8                	mov    %edi,%eax
+  8011bd:	c1 e8 0c             	shr    $0xc,%eax
+  8011c0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011c7:	83 ec 0c             	sub    $0xc,%esp
+  8011ca:	25 07 0e 00 00       	and    $0xe07,%eax
+  8011cf:	50                   	push   %eax
+  8011d0:	56                   	push   %esi
+  8011d1:	6a 00                	push   $0x0
+  8011d3:	57                   	push   %edi
+  8011d4:	6a 00                	push   $0x0
+  8011d6:	e8 c0 f9 ff ff       	call   800b9b <sys_page_map>
+  8011db:	89 c3                	mov    %eax,%ebx
+  8011dd:	83 c4 20             	add    $0x20,%esp
+  8011e0:	85 c0                	test   %eax,%eax
+  8011e2:	78 33                	js     801217 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8011e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8011e7:	89 d8                	mov    %ebx,%eax
+  8011e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ec:	5b                   	pop    %ebx
+  8011ed:	5e                   	pop    %esi
+  8011ee:	5f                   	pop    %edi
+  8011ef:	5d                   	pop    %ebp
+  8011f0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8011f1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011f8:	83 ec 0c             	sub    $0xc,%esp
+  8011fb:	25 07 0e 00 00       	and    $0xe07,%eax
+  801200:	50                   	push   %eax
+  801201:	ff 75 d4             	push   -0x2c(%ebp)
+  801204:	6a 00                	push   $0x0
+  801206:	53                   	push   %ebx
+  801207:	6a 00                	push   $0x0
+  801209:	e8 8d f9 ff ff       	call   800b9b <sys_page_map>
+  80120e:	89 c3                	mov    %eax,%ebx
+  801210:	83 c4 20             	add    $0x20,%esp
+  801213:	85 c0                	test   %eax,%eax
+  801215:	79 a4                	jns    8011bb <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801217:	83 ec 08             	sub    $0x8,%esp
+  80121a:	56                   	push   %esi
+  80121b:	6a 00                	push   $0x0
+  80121d:	e8 bb f9 ff ff       	call   800bdd <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801222:	83 c4 08             	add    $0x8,%esp
+  801225:	ff 75 d4             	push   -0x2c(%ebp)
+  801228:	6a 00                	push   $0x0
+  80122a:	e8 ae f9 ff ff       	call   800bdd <sys_page_unmap>
+	return r;
+  80122f:	83 c4 10             	add    $0x10,%esp
+  801232:	eb b3                	jmp    8011e7 <dup+0x9d>
+
+00801234 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801234:	55                   	push   %ebp
+  801235:	89 e5                	mov    %esp,%ebp
+  801237:	56                   	push   %esi
+  801238:	53                   	push   %ebx
+  801239:	83 ec 18             	sub    $0x18,%esp
+  80123c:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80123f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801242:	50                   	push   %eax
+  801243:	56                   	push   %esi
+  801244:	e8 85 fd ff ff       	call   800fce <fd_lookup>
+  801249:	83 c4 10             	add    $0x10,%esp
+  80124c:	85 c0                	test   %eax,%eax
+  80124e:	78 3c                	js     80128c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801250:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801253:	83 ec 08             	sub    $0x8,%esp
+  801256:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801259:	50                   	push   %eax
+  80125a:	ff 33                	push   (%ebx)
+  80125c:	e8 bd fd ff ff       	call   80101e <dev_lookup>
+  801261:	83 c4 10             	add    $0x10,%esp
+  801264:	85 c0                	test   %eax,%eax
+  801266:	78 24                	js     80128c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801268:	8b 43 08             	mov    0x8(%ebx),%eax
+  80126b:	83 e0 03             	and    $0x3,%eax
+  80126e:	83 f8 01             	cmp    $0x1,%eax
+  801271:	74 20                	je     801293 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801273:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801276:	8b 40 08             	mov    0x8(%eax),%eax
+  801279:	85 c0                	test   %eax,%eax
+  80127b:	74 37                	je     8012b4 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80127d:	83 ec 04             	sub    $0x4,%esp
+  801280:	ff 75 10             	push   0x10(%ebp)
+  801283:	ff 75 0c             	push   0xc(%ebp)
+  801286:	53                   	push   %ebx
+  801287:	ff d0                	call   *%eax
+  801289:	83 c4 10             	add    $0x10,%esp
+}
+  80128c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80128f:	5b                   	pop    %ebx
+  801290:	5e                   	pop    %esi
+  801291:	5d                   	pop    %ebp
+  801292:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801293:	a1 00 50 80 00       	mov    0x805000,%eax
+  801298:	8b 40 48             	mov    0x48(%eax),%eax
+  80129b:	83 ec 04             	sub    $0x4,%esp
+  80129e:	56                   	push   %esi
+  80129f:	50                   	push   %eax
+  8012a0:	68 15 3b 80 00       	push   $0x803b15
+  8012a5:	e8 ac ee ff ff       	call   800156 <cprintf>
+		return -E_INVAL;
+  8012aa:	83 c4 10             	add    $0x10,%esp
+  8012ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012b2:	eb d8                	jmp    80128c <read+0x58>
+		return -E_NOT_SUPP;
+  8012b4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012b9:	eb d1                	jmp    80128c <read+0x58>
+
+008012bb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8012bb:	55                   	push   %ebp
+  8012bc:	89 e5                	mov    %esp,%ebp
+  8012be:	57                   	push   %edi
+  8012bf:	56                   	push   %esi
+  8012c0:	53                   	push   %ebx
+  8012c1:	83 ec 0c             	sub    $0xc,%esp
+  8012c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8012c7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8012ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cf:	eb 02                	jmp    8012d3 <readn+0x18>
+  8012d1:	01 c3                	add    %eax,%ebx
+  8012d3:	39 f3                	cmp    %esi,%ebx
+  8012d5:	73 21                	jae    8012f8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8012d7:	83 ec 04             	sub    $0x4,%esp
+  8012da:	89 f0                	mov    %esi,%eax
+  8012dc:	29 d8                	sub    %ebx,%eax
+  8012de:	50                   	push   %eax
+  8012df:	89 d8                	mov    %ebx,%eax
+  8012e1:	03 45 0c             	add    0xc(%ebp),%eax
+  8012e4:	50                   	push   %eax
+  8012e5:	57                   	push   %edi
+  8012e6:	e8 49 ff ff ff       	call   801234 <read>
+		if (m < 0)
+  8012eb:	83 c4 10             	add    $0x10,%esp
+  8012ee:	85 c0                	test   %eax,%eax
+  8012f0:	78 04                	js     8012f6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8012f2:	75 dd                	jne    8012d1 <readn+0x16>
+  8012f4:	eb 02                	jmp    8012f8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8012f6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8012f8:	89 d8                	mov    %ebx,%eax
+  8012fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fd:	5b                   	pop    %ebx
+  8012fe:	5e                   	pop    %esi
+  8012ff:	5f                   	pop    %edi
+  801300:	5d                   	pop    %ebp
+  801301:	c3                   	ret
+
+00801302 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801302:	55                   	push   %ebp
+  801303:	89 e5                	mov    %esp,%ebp
+  801305:	56                   	push   %esi
+  801306:	53                   	push   %ebx
+  801307:	83 ec 18             	sub    $0x18,%esp
+  80130a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80130d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801310:	50                   	push   %eax
+  801311:	53                   	push   %ebx
+  801312:	e8 b7 fc ff ff       	call   800fce <fd_lookup>
+  801317:	83 c4 10             	add    $0x10,%esp
+  80131a:	85 c0                	test   %eax,%eax
+  80131c:	78 37                	js     801355 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80131e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801321:	83 ec 08             	sub    $0x8,%esp
+  801324:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801327:	50                   	push   %eax
+  801328:	ff 36                	push   (%esi)
+  80132a:	e8 ef fc ff ff       	call   80101e <dev_lookup>
+  80132f:	83 c4 10             	add    $0x10,%esp
+  801332:	85 c0                	test   %eax,%eax
+  801334:	78 1f                	js     801355 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801336:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80133a:	74 20                	je     80135c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80133c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80133f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801342:	85 c0                	test   %eax,%eax
+  801344:	74 37                	je     80137d <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801346:	83 ec 04             	sub    $0x4,%esp
+  801349:	ff 75 10             	push   0x10(%ebp)
+  80134c:	ff 75 0c             	push   0xc(%ebp)
+  80134f:	56                   	push   %esi
+  801350:	ff d0                	call   *%eax
+  801352:	83 c4 10             	add    $0x10,%esp
+}
+  801355:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801358:	5b                   	pop    %ebx
+  801359:	5e                   	pop    %esi
+  80135a:	5d                   	pop    %ebp
+  80135b:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80135c:	a1 00 50 80 00       	mov    0x805000,%eax
+  801361:	8b 40 48             	mov    0x48(%eax),%eax
+  801364:	83 ec 04             	sub    $0x4,%esp
+  801367:	53                   	push   %ebx
+  801368:	50                   	push   %eax
+  801369:	68 31 3b 80 00       	push   $0x803b31
+  80136e:	e8 e3 ed ff ff       	call   800156 <cprintf>
+		return -E_INVAL;
+  801373:	83 c4 10             	add    $0x10,%esp
+  801376:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80137b:	eb d8                	jmp    801355 <write+0x53>
+		return -E_NOT_SUPP;
+  80137d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801382:	eb d1                	jmp    801355 <write+0x53>
+
+00801384 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801384:	55                   	push   %ebp
+  801385:	89 e5                	mov    %esp,%ebp
+  801387:	53                   	push   %ebx
+  801388:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80138b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80138e:	50                   	push   %eax
+  80138f:	ff 75 08             	push   0x8(%ebp)
+  801392:	e8 37 fc ff ff       	call   800fce <fd_lookup>
+  801397:	83 c4 10             	add    $0x10,%esp
+  80139a:	85 c0                	test   %eax,%eax
+  80139c:	78 3a                	js     8013d8 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80139e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8013a1:	83 ec 08             	sub    $0x8,%esp
+  8013a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013a7:	50                   	push   %eax
+  8013a8:	ff 33                	push   (%ebx)
+  8013aa:	e8 6f fc ff ff       	call   80101e <dev_lookup>
+  8013af:	83 c4 10             	add    $0x10,%esp
+  8013b2:	85 c0                	test   %eax,%eax
+  8013b4:	78 22                	js     8013d8 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8013b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013b9:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8013bc:	85 c0                	test   %eax,%eax
+  8013be:	74 0d                	je     8013cd <seek+0x49>
+  8013c0:	83 ec 0c             	sub    $0xc,%esp
+  8013c3:	53                   	push   %ebx
+  8013c4:	ff d0                	call   *%eax
+  8013c6:	83 c4 10             	add    $0x10,%esp
+  8013c9:	85 c0                	test   %eax,%eax
+  8013cb:	78 0b                	js     8013d8 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8013cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013d0:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8013d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013db:	c9                   	leave
+  8013dc:	c3                   	ret
+
+008013dd <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8013dd:	55                   	push   %ebp
+  8013de:	89 e5                	mov    %esp,%ebp
+  8013e0:	53                   	push   %ebx
+  8013e1:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013e4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013e7:	50                   	push   %eax
+  8013e8:	ff 75 08             	push   0x8(%ebp)
+  8013eb:	e8 de fb ff ff       	call   800fce <fd_lookup>
+  8013f0:	83 c4 10             	add    $0x10,%esp
+  8013f3:	85 c0                	test   %eax,%eax
+  8013f5:	78 2b                	js     801422 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013f7:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8013fa:	83 ec 08             	sub    $0x8,%esp
+  8013fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801400:	50                   	push   %eax
+  801401:	ff 33                	push   (%ebx)
+  801403:	e8 16 fc ff ff       	call   80101e <dev_lookup>
+  801408:	83 c4 10             	add    $0x10,%esp
+  80140b:	85 c0                	test   %eax,%eax
+  80140d:	78 13                	js     801422 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  80140f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801412:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801415:	85 c0                	test   %eax,%eax
+  801417:	74 0e                	je     801427 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801419:	83 ec 0c             	sub    $0xc,%esp
+  80141c:	53                   	push   %ebx
+  80141d:	ff d0                	call   *%eax
+  80141f:	83 c4 10             	add    $0x10,%esp
+}
+  801422:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801425:	c9                   	leave
+  801426:	c3                   	ret
+		return 0;
+  801427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142c:	eb f4                	jmp    801422 <fsync+0x45>
+
+0080142e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80142e:	55                   	push   %ebp
+  80142f:	89 e5                	mov    %esp,%ebp
+  801431:	56                   	push   %esi
+  801432:	53                   	push   %ebx
+  801433:	83 ec 18             	sub    $0x18,%esp
+  801436:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801439:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80143c:	50                   	push   %eax
+  80143d:	53                   	push   %ebx
+  80143e:	e8 8b fb ff ff       	call   800fce <fd_lookup>
+  801443:	83 c4 10             	add    $0x10,%esp
+  801446:	85 c0                	test   %eax,%eax
+  801448:	78 34                	js     80147e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80144a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80144d:	83 ec 08             	sub    $0x8,%esp
+  801450:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801453:	50                   	push   %eax
+  801454:	ff 36                	push   (%esi)
+  801456:	e8 c3 fb ff ff       	call   80101e <dev_lookup>
+  80145b:	83 c4 10             	add    $0x10,%esp
+  80145e:	85 c0                	test   %eax,%eax
+  801460:	78 1c                	js     80147e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801462:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801466:	74 1d                	je     801485 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801468:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80146b:	8b 40 18             	mov    0x18(%eax),%eax
+  80146e:	85 c0                	test   %eax,%eax
+  801470:	74 34                	je     8014a6 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801472:	83 ec 08             	sub    $0x8,%esp
+  801475:	ff 75 0c             	push   0xc(%ebp)
+  801478:	56                   	push   %esi
+  801479:	ff d0                	call   *%eax
+  80147b:	83 c4 10             	add    $0x10,%esp
+}
+  80147e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801481:	5b                   	pop    %ebx
+  801482:	5e                   	pop    %esi
+  801483:	5d                   	pop    %ebp
+  801484:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801485:	a1 00 50 80 00       	mov    0x805000,%eax
+  80148a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80148d:	83 ec 04             	sub    $0x4,%esp
+  801490:	53                   	push   %ebx
+  801491:	50                   	push   %eax
+  801492:	68 f4 3a 80 00       	push   $0x803af4
+  801497:	e8 ba ec ff ff       	call   800156 <cprintf>
+		return -E_INVAL;
+  80149c:	83 c4 10             	add    $0x10,%esp
+  80149f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014a4:	eb d8                	jmp    80147e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8014a6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014ab:	eb d1                	jmp    80147e <ftruncate+0x50>
+
+008014ad <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8014ad:	55                   	push   %ebp
+  8014ae:	89 e5                	mov    %esp,%ebp
+  8014b0:	56                   	push   %esi
+  8014b1:	53                   	push   %ebx
+  8014b2:	83 ec 18             	sub    $0x18,%esp
+  8014b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014b8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014bb:	50                   	push   %eax
+  8014bc:	ff 75 08             	push   0x8(%ebp)
+  8014bf:	e8 0a fb ff ff       	call   800fce <fd_lookup>
+  8014c4:	83 c4 10             	add    $0x10,%esp
+  8014c7:	85 c0                	test   %eax,%eax
+  8014c9:	78 49                	js     801514 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014cb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014ce:	83 ec 08             	sub    $0x8,%esp
+  8014d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d4:	50                   	push   %eax
+  8014d5:	ff 36                	push   (%esi)
+  8014d7:	e8 42 fb ff ff       	call   80101e <dev_lookup>
+  8014dc:	83 c4 10             	add    $0x10,%esp
+  8014df:	85 c0                	test   %eax,%eax
+  8014e1:	78 31                	js     801514 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8014e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014e6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8014ea:	74 2f                	je     80151b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8014ec:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8014ef:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8014f6:	00 00 00 
+	stat->st_isdir = 0;
+  8014f9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801500:	00 00 00 
+	stat->st_dev = dev;
+  801503:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801509:	83 ec 08             	sub    $0x8,%esp
+  80150c:	53                   	push   %ebx
+  80150d:	56                   	push   %esi
+  80150e:	ff 50 14             	call   *0x14(%eax)
+  801511:	83 c4 10             	add    $0x10,%esp
+}
+  801514:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801517:	5b                   	pop    %ebx
+  801518:	5e                   	pop    %esi
+  801519:	5d                   	pop    %ebp
+  80151a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80151b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801520:	eb f2                	jmp    801514 <fstat+0x67>
+
+00801522 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801522:	55                   	push   %ebp
+  801523:	89 e5                	mov    %esp,%ebp
+  801525:	56                   	push   %esi
+  801526:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801527:	83 ec 08             	sub    $0x8,%esp
+  80152a:	68 00 10 00 00       	push   $0x1000
+  80152f:	ff 75 08             	push   0x8(%ebp)
+  801532:	e8 b3 07 00 00       	call   801cea <open>
+  801537:	89 c3                	mov    %eax,%ebx
+  801539:	83 c4 10             	add    $0x10,%esp
+  80153c:	85 c0                	test   %eax,%eax
+  80153e:	78 1b                	js     80155b <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801540:	83 ec 08             	sub    $0x8,%esp
+  801543:	ff 75 0c             	push   0xc(%ebp)
+  801546:	50                   	push   %eax
+  801547:	e8 61 ff ff ff       	call   8014ad <fstat>
+  80154c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80154e:	89 1c 24             	mov    %ebx,(%esp)
+  801551:	e8 a2 fb ff ff       	call   8010f8 <close>
+	return r;
+  801556:	83 c4 10             	add    $0x10,%esp
+  801559:	89 f3                	mov    %esi,%ebx
+}
+  80155b:	89 d8                	mov    %ebx,%eax
+  80155d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801560:	5b                   	pop    %ebx
+  801561:	5e                   	pop    %esi
+  801562:	5d                   	pop    %ebp
+  801563:	c3                   	ret
+
+00801564 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801564:	55                   	push   %ebp
+  801565:	89 e5                	mov    %esp,%ebp
+  801567:	57                   	push   %edi
+  801568:	56                   	push   %esi
+  801569:	53                   	push   %ebx
+  80156a:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801570:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801576:	89 d6                	mov    %edx,%esi
+  801578:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  80157e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801581:	89 d3                	mov    %edx,%ebx
+  801583:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801589:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801590:	74 1d                	je     8015af <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801592:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801597:	83 c8 07             	or     $0x7,%eax
+  80159a:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  8015a0:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8015a5:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  8015ab:	01 ce                	add    %ecx,%esi
+  8015ad:	eb 28                	jmp    8015d7 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8015af:	83 ec 0c             	sub    $0xc,%esp
+  8015b2:	6a 01                	push   $0x1
+  8015b4:	e8 52 1e 00 00       	call   80340b <ipc_find_env>
+  8015b9:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8015be:	83 c4 10             	add    $0x10,%esp
+  8015c1:	eb cf                	jmp    801592 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  8015c3:	83 c0 01             	add    $0x1,%eax
+  8015c6:	89 fa                	mov    %edi,%edx
+  8015c8:	09 da                	or     %ebx,%edx
+  8015ca:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8015d1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8015d7:	39 f3                	cmp    %esi,%ebx
+  8015d9:	72 e8                	jb     8015c3 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  8015db:	83 f8 41             	cmp    $0x41,%eax
+  8015de:	77 2f                	ja     80160f <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  8015e0:	50                   	push   %eax
+  8015e1:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  8015e7:	50                   	push   %eax
+  8015e8:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  8015ee:	ff 35 c8 70 80 00    	push   0x8070c8
+  8015f4:	e8 c4 1d 00 00       	call   8033bd <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  8015f9:	83 c4 0c             	add    $0xc,%esp
+  8015fc:	6a 00                	push   $0x0
+  8015fe:	6a 00                	push   $0x0
+  801600:	6a 00                	push   $0x0
+  801602:	e8 60 1c 00 00       	call   803267 <ipc_recv>
+}
+  801607:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160a:	5b                   	pop    %ebx
+  80160b:	5e                   	pop    %esi
+  80160c:	5f                   	pop    %edi
+  80160d:	5d                   	pop    %ebp
+  80160e:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  80160f:	68 64 3b 80 00       	push   $0x803b64
+  801614:	68 80 3b 80 00       	push   $0x803b80
+  801619:	6a 40                	push   $0x40
+  80161b:	68 95 3b 80 00       	push   $0x803b95
+  801620:	e8 e7 18 00 00       	call   802f0c <_panic>
+
+00801625 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801625:	55                   	push   %ebp
+  801626:	89 e5                	mov    %esp,%ebp
+  801628:	57                   	push   %edi
+  801629:	56                   	push   %esi
+  80162a:	53                   	push   %ebx
+  80162b:	83 ec 1c             	sub    $0x1c,%esp
+  80162e:	89 c3                	mov    %eax,%ebx
+  801630:	89 d6                	mov    %edx,%esi
+  801632:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801635:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  80163b:	89 ca                	mov    %ecx,%edx
+  80163d:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801640:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801647:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80164a:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801651:	8b 76 0c             	mov    0xc(%esi),%esi
+  801654:	89 fb                	mov    %edi,%ebx
+  801656:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  80165d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801660:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801667:	8b 75 08             	mov    0x8(%ebp),%esi
+  80166a:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801671:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801674:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  80167b:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  80167e:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801685:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  80168a:	39 c8                	cmp    %ecx,%eax
+  80168c:	74 0d                	je     80169b <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  80168e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801693:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801696:	5b                   	pop    %ebx
+  801697:	5e                   	pop    %esi
+  801698:	5f                   	pop    %edi
+  801699:	5d                   	pop    %ebp
+  80169a:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80169b:	6a 07                	push   $0x7
+  80169d:	68 00 60 80 00       	push   $0x806000
+  8016a2:	6a 0d                	push   $0xd
+  8016a4:	ff 35 c8 70 80 00    	push   0x8070c8
+  8016aa:	e8 23 1c 00 00       	call   8032d2 <ipc_send>
+  8016af:	83 c4 10             	add    $0x10,%esp
+  8016b2:	eb da                	jmp    80168e <fsring_post+0x69>
+
+008016b4 <fsipcv>:
+{
+  8016b4:	55                   	push   %ebp
+  8016b5:	89 e5                	mov    %esp,%ebp
+  8016b7:	57                   	push   %edi
+  8016b8:	56                   	push   %esi
+  8016b9:	53                   	push   %ebx
+  8016ba:	83 ec 0c             	sub    $0xc,%esp
+  8016bd:	89 c7                	mov    %eax,%edi
+  8016bf:	89 d3                	mov    %edx,%ebx
+  8016c1:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  8016c3:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  8016ca:	74 26                	je     8016f2 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016cc:	6a 07                	push   $0x7
+  8016ce:	68 00 60 80 00       	push   $0x806000
+  8016d3:	57                   	push   %edi
+  8016d4:	ff 35 c8 70 80 00    	push   0x8070c8
+  8016da:	e8 f3 1b 00 00       	call   8032d2 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  8016df:	6a 00                	push   $0x0
+  8016e1:	56                   	push   %esi
+  8016e2:	53                   	push   %ebx
+  8016e3:	6a 00                	push   $0x0
+  8016e5:	e8 40 1c 00 00       	call   80332a <ipc_recvv>
+}
+  8016ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ed:	5b                   	pop    %ebx
+  8016ee:	5e                   	pop    %esi
+  8016ef:	5f                   	pop    %edi
+  8016f0:	5d                   	pop    %ebp
+  8016f1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016f2:	83 ec 0c             	sub    $0xc,%esp
+  8016f5:	6a 01                	push   $0x1
+  8016f7:	e8 0f 1d 00 00       	call   80340b <ipc_find_env>
+  8016fc:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801701:	83 c4 10             	add    $0x10,%esp
+  801704:	eb c6                	jmp    8016cc <fsipcv+0x18>
+
+00801706 <fsipc>:
+{
+  801706:	55                   	push   %ebp
+  801707:	89 e5                	mov    %esp,%ebp
+  801709:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  80170c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801713:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801716:	e8 99 ff ff ff       	call   8016b4 <fsipcv>
+}
+  80171b:	c9                   	leave
+  80171c:	c3                   	ret
+
+0080171d <file_write_direct>:
+{
+  80171d:	55                   	push   %ebp
+  80171e:	89 e5                	mov    %esp,%ebp
+  801720:	56                   	push   %esi
+  801721:	53                   	push   %ebx
+  801722:	89 c3                	mov    %eax,%ebx
+  801724:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801726:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  80172c:	77 40                	ja     80176e <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80172e:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801733:	39 c8                	cmp    %ecx,%eax
+  801735:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801738:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  80173b:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  801741:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801746:	83 ec 04             	sub    $0x4,%esp
+  801749:	50                   	push   %eax
+  80174a:	52                   	push   %edx
+  80174b:	68 08 60 80 00       	push   $0x806008
+  801750:	e8 75 f1 ff ff       	call   8008ca <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801755:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80175f:	e8 a2 ff ff ff       	call   801706 <fsipc>
+  801764:	83 c4 10             	add    $0x10,%esp
+}
+  801767:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80176a:	5b                   	pop    %ebx
+  80176b:	5e                   	pop    %esi
+  80176c:	5d                   	pop    %ebp
+  80176d:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80176e:	89 d6                	mov    %edx,%esi
+  801770:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801776:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80177b:	29 f1                	sub    %esi,%ecx
+  80177d:	39 c1                	cmp    %eax,%ecx
+  80177f:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801782:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801785:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  80178a:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801790:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801796:	83 ec 0c             	sub    $0xc,%esp
+  801799:	6a 05                	push   $0x5
+  80179b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8017a0:	e8 bf fd ff ff       	call   801564 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  8017a5:	83 c4 10             	add    $0x10,%esp
+  8017a8:	eb bd                	jmp    801767 <file_write_direct+0x4a>
+
+008017aa <devfile_sync>:
+{
+  8017aa:	55                   	push   %ebp
+  8017ab:	89 e5                	mov    %esp,%ebp
+  8017ad:	57                   	push   %edi
+  8017ae:	56                   	push   %esi
+  8017af:	53                   	push   %ebx
+  8017b0:	83 ec 28             	sub    $0x28,%esp
+  8017b3:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  8017b6:	56                   	push   %esi
+  8017b7:	e8 a5 f7 ff ff       	call   800f61 <fd2data>
+  8017bc:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  8017be:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  8017c1:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  8017c8:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8017cb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  8017d0:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8017d4:	74 45                	je     80181b <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  8017d6:	8b 46 14             	mov    0x14(%esi),%eax
+  8017d9:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8017dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8017e9:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  8017ec:	39 cb                	cmp    %ecx,%ebx
+  8017ee:	73 14                	jae    801804 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  8017f0:	29 d9                	sub    %ebx,%ecx
+  8017f2:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8017f5:	89 f0                	mov    %esi,%eax
+  8017f7:	e8 21 ff ff ff       	call   80171d <file_write_direct>
+  8017fc:	85 c0                	test   %eax,%eax
+  8017fe:	7e 04                	jle    801804 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801800:	01 c3                	add    %eax,%ebx
+  801802:	eb e5                	jmp    8017e9 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801804:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801807:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  80180e:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801811:	85 c0                	test   %eax,%eax
+  801813:	ba 00 00 00 00       	mov    $0x0,%edx
+  801818:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80181b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80181e:	5b                   	pop    %ebx
+  80181f:	5e                   	pop    %esi
+  801820:	5f                   	pop    %edi
+  801821:	5d                   	pop    %ebp
+  801822:	c3                   	ret
+
+00801823 <devfile_write>:
+{
+  801823:	55                   	push   %ebp
+  801824:	89 e5                	mov    %esp,%ebp
+  801826:	57                   	push   %edi
+  801827:	56                   	push   %esi
+  801828:	53                   	push   %ebx
+  801829:	83 ec 28             	sub    $0x28,%esp
+  80182c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80182f:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801832:	53                   	push   %ebx
+  801833:	e8 29 f7 ff ff       	call   800f61 <fd2data>
+  801838:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  80183b:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80183e:	83 c4 10             	add    $0x10,%esp
+  801841:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801845:	74 43                	je     80188a <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801847:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  80184e:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801851:	85 c0                	test   %eax,%eax
+  801853:	74 43                	je     801898 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801855:	89 c2                	mov    %eax,%edx
+  801857:	03 53 14             	add    0x14(%ebx),%edx
+  80185a:	39 fa                	cmp    %edi,%edx
+  80185c:	75 0b                	jne    801869 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  80185e:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801861:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801867:	76 66                	jbe    8018cf <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801869:	83 ec 0c             	sub    $0xc,%esp
+  80186c:	53                   	push   %ebx
+  80186d:	e8 38 ff ff ff       	call   8017aa <devfile_sync>
+  801872:	83 c4 10             	add    $0x10,%esp
+  801875:	85 c0                	test   %eax,%eax
+  801877:	78 4e                	js     8018c7 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801879:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80187f:	77 56                	ja     8018d7 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801881:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801884:	85 c0                	test   %eax,%eax
+  801886:	75 20                	jne    8018a8 <devfile_write+0x85>
+  801888:	eb 16                	jmp    8018a0 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  80188a:	89 f1                	mov    %esi,%ecx
+  80188c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80188f:	89 d8                	mov    %ebx,%eax
+  801891:	e8 87 fe ff ff       	call   80171d <file_write_direct>
+  801896:	eb 2f                	jmp    8018c7 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801898:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80189e:	77 37                	ja     8018d7 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  8018a0:	89 7b 14             	mov    %edi,0x14(%ebx)
+  8018a3:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  8018a8:	83 ec 04             	sub    $0x4,%esp
+  8018ab:	56                   	push   %esi
+  8018ac:	ff 75 0c             	push   0xc(%ebp)
+  8018af:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8018b2:	01 c1                	add    %eax,%ecx
+  8018b4:	51                   	push   %ecx
+  8018b5:	e8 10 f0 ff ff       	call   8008ca <memmove>
+	ff->buf_wlen += n;
+  8018ba:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  8018bd:	01 f7                	add    %esi,%edi
+  8018bf:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8018c2:	89 f0                	mov    %esi,%eax
+  8018c4:	83 c4 10             	add    $0x10,%esp
+}
+  8018c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ca:	5b                   	pop    %ebx
+  8018cb:	5e                   	pop    %esi
+  8018cc:	5f                   	pop    %edi
+  8018cd:	5d                   	pop    %ebp
+  8018ce:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  8018cf:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8018d5:	76 d1                	jbe    8018a8 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  8018d7:	89 f1                	mov    %esi,%ecx
+  8018d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018dc:	89 d8                	mov    %ebx,%eax
+  8018de:	e8 3a fe ff ff       	call   80171d <file_write_direct>
+  8018e3:	eb e2                	jmp    8018c7 <devfile_write+0xa4>
+
+008018e5 <devfile_trunc>:
+{
+  8018e5:	55                   	push   %ebp
+  8018e6:	89 e5                	mov    %esp,%ebp
+  8018e8:	53                   	push   %ebx
+  8018e9:	83 ec 10             	sub    $0x10,%esp
+  8018ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  8018ef:	53                   	push   %ebx
+  8018f0:	e8 b5 fe ff ff       	call   8017aa <devfile_sync>
+  8018f5:	83 c4 10             	add    $0x10,%esp
+  8018f8:	85 c0                	test   %eax,%eax
+  8018fa:	78 1f                	js     80191b <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018fc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8018ff:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801904:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801907:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80190c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801911:	b8 02 00 00 00       	mov    $0x2,%eax
+  801916:	e8 eb fd ff ff       	call   801706 <fsipc>
+}
+  80191b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80191e:	c9                   	leave
+  80191f:	c3                   	ret
+
+00801920 <devfile_stat>:
+{
+  801920:	55                   	push   %ebp
+  801921:	89 e5                	mov    %esp,%ebp
+  801923:	56                   	push   %esi
+  801924:	53                   	push   %ebx
+  801925:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801928:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  80192b:	83 ec 0c             	sub    $0xc,%esp
+  80192e:	53                   	push   %ebx
+  80192f:	e8 76 fe ff ff       	call   8017aa <devfile_sync>
+  801934:	83 c4 10             	add    $0x10,%esp
+  801937:	85 c0                	test   %eax,%eax
+  801939:	78 47                	js     801982 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80193b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80193e:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801943:	ba 00 00 00 00       	mov    $0x0,%edx
+  801948:	b8 05 00 00 00       	mov    $0x5,%eax
+  80194d:	e8 b4 fd ff ff       	call   801706 <fsipc>
+  801952:	85 c0                	test   %eax,%eax
+  801954:	78 2c                	js     801982 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801956:	83 ec 08             	sub    $0x8,%esp
+  801959:	68 00 60 80 00       	push   $0x806000
+  80195e:	56                   	push   %esi
+  80195f:	e8 e0 ed ff ff       	call   800744 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801964:	a1 80 60 80 00       	mov    0x806080,%eax
+  801969:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80196f:	a1 84 60 80 00       	mov    0x806084,%eax
+  801974:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  80197a:	83 c4 10             	add    $0x10,%esp
+  80197d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801982:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801985:	5b                   	pop    %ebx
+  801986:	5e                   	pop    %esi
+  801987:	5d                   	pop    %ebp
+  801988:	c3                   	ret
+
+00801989 <devfile_flush>:
+{
+  801989:	55                   	push   %ebp
+  80198a:	89 e5                	mov    %esp,%ebp
+  80198c:	56                   	push   %esi
+  80198d:	53                   	push   %ebx
+  80198e:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801991:	83 ec 0c             	sub    $0xc,%esp
+  801994:	56                   	push   %esi
+  801995:	e8 10 fe ff ff       	call   8017aa <devfile_sync>
+  80199a:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  80199c:	83 c4 10             	add    $0x10,%esp
+  80199f:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  8019a3:	75 25                	jne    8019ca <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019a5:	8b 46 0c             	mov    0xc(%esi),%eax
+  8019a8:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  8019ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019b7:	e8 4a fd ff ff       	call   801706 <fsipc>
+  8019bc:	85 c0                	test   %eax,%eax
+  8019be:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8019c1:	89 d8                	mov    %ebx,%eax
+  8019c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019c6:	5b                   	pop    %ebx
+  8019c7:	5e                   	pop    %esi
+  8019c8:	5d                   	pop    %ebp
+  8019c9:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  8019ca:	83 ec 0c             	sub    $0xc,%esp
+  8019cd:	56                   	push   %esi
+  8019ce:	e8 8e f5 ff ff       	call   800f61 <fd2data>
+  8019d3:	83 c4 08             	add    $0x8,%esp
+  8019d6:	50                   	push   %eax
+  8019d7:	6a 00                	push   $0x0
+  8019d9:	e8 ff f1 ff ff       	call   800bdd <sys_page_unmap>
+  8019de:	83 c4 10             	add    $0x10,%esp
+  8019e1:	eb c2                	jmp    8019a5 <devfile_flush+0x1c>
+
+008019e3 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  8019e3:	55                   	push   %ebp
+  8019e4:	89 e5                	mov    %esp,%ebp
+  8019e6:	57                   	push   %edi
+  8019e7:	56                   	push   %esi
+  8019e8:	53                   	push   %ebx
+  8019e9:	83 ec 64             	sub    $0x64,%esp
+  8019ec:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  8019ee:	52                   	push   %edx
+  8019ef:	50                   	push   %eax
+  8019f0:	e8 d9 f5 ff ff       	call   800fce <fd_lookup>
+  8019f5:	89 c1                	mov    %eax,%ecx
+  8019f7:	83 c4 10             	add    $0x10,%esp
+  8019fa:	85 c0                	test   %eax,%eax
+  8019fc:	0f 88 f2 00 00 00    	js     801af4 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801a02:	8b 07                	mov    (%edi),%eax
+  801a04:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801a0a:	39 10                	cmp    %edx,(%eax)
+  801a0c:	0f 85 03 01 00 00    	jne    801b15 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801a12:	a1 00 50 80 00       	mov    0x805000,%eax
+  801a17:	8b 40 48             	mov    0x48(%eax),%eax
+  801a1a:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801a20:	0f 84 96 00 00 00    	je     801abc <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801a26:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801a2d:	0f 84 cb 00 00 00    	je     801afe <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a33:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801a38:	83 c8 07             	or     $0x7,%eax
+  801a3b:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801a3e:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a41:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801a46:	83 ec 04             	sub    $0x4,%esp
+  801a49:	68 07 04 00 00       	push   $0x407
+  801a4e:	53                   	push   %ebx
+  801a4f:	6a 00                	push   $0x0
+  801a51:	e8 fa f0 ff ff       	call   800b50 <sys_page_alloc>
+  801a56:	89 c1                	mov    %eax,%ecx
+  801a58:	83 c4 10             	add    $0x10,%esp
+  801a5b:	85 c0                	test   %eax,%eax
+  801a5d:	0f 88 91 00 00 00    	js     801af4 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801a63:	89 d8                	mov    %ebx,%eax
+  801a65:	83 c8 07             	or     $0x7,%eax
+  801a68:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801a6a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a70:	83 c6 04             	add    $0x4,%esi
+  801a73:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801a79:	75 cb                	jne    801a46 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801a7b:	6a 12                	push   $0x12
+  801a7d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801a80:	50                   	push   %eax
+  801a81:	6a 0c                	push   $0xc
+  801a83:	ff 35 c8 70 80 00    	push   0x8070c8
+  801a89:	e8 2f 19 00 00       	call   8033bd <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a8e:	83 c4 0c             	add    $0xc,%esp
+  801a91:	6a 00                	push   $0x0
+  801a93:	6a 00                	push   $0x0
+  801a95:	6a 00                	push   $0x0
+  801a97:	e8 cb 17 00 00       	call   803267 <ipc_recv>
+  801a9c:	89 c1                	mov    %eax,%ecx
+  801a9e:	83 c4 10             	add    $0x10,%esp
+  801aa1:	85 c0                	test   %eax,%eax
+  801aa3:	78 4f                	js     801af4 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801aa5:	a1 00 50 80 00       	mov    0x805000,%eax
+  801aaa:	8b 40 48             	mov    0x48(%eax),%eax
+  801aad:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801ab2:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801ab9:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801abc:	83 ec 0c             	sub    $0xc,%esp
+  801abf:	ff 37                	push   (%edi)
+  801ac1:	e8 e4 fc ff ff       	call   8017aa <devfile_sync>
+  801ac6:	89 c1                	mov    %eax,%ecx
+  801ac8:	83 c4 10             	add    $0x10,%esp
+  801acb:	85 c0                	test   %eax,%eax
+  801acd:	78 25                	js     801af4 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801acf:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801ad5:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801ada:	ba 01 00 00 00       	mov    $0x1,%edx
+  801adf:	89 d0                	mov    %edx,%eax
+  801ae1:	d3 e0                	shl    %cl,%eax
+  801ae3:	85 d8                	test   %ebx,%eax
+  801ae5:	74 0d                	je     801af4 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801ae7:	83 c1 01             	add    $0x1,%ecx
+  801aea:	83 f9 10             	cmp    $0x10,%ecx
+  801aed:	75 f0                	jne    801adf <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801aef:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801af4:	89 c8                	mov    %ecx,%eax
+  801af6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801af9:	5b                   	pop    %ebx
+  801afa:	5e                   	pop    %esi
+  801afb:	5f                   	pop    %edi
+  801afc:	5d                   	pop    %ebp
+  801afd:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801afe:	83 ec 0c             	sub    $0xc,%esp
+  801b01:	6a 01                	push   $0x1
+  801b03:	e8 03 19 00 00       	call   80340b <ipc_find_env>
+  801b08:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801b0d:	83 c4 10             	add    $0x10,%esp
+  801b10:	e9 1e ff ff ff       	jmp    801a33 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801b15:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801b1a:	eb d8                	jmp    801af4 <fsring_slot+0x111>
+
+00801b1c <file_read_direct>:
+{
+  801b1c:	55                   	push   %ebp
+  801b1d:	89 e5                	mov    %esp,%ebp
+  801b1f:	57                   	push   %edi
+  801b20:	56                   	push   %esi
+  801b21:	53                   	push   %ebx
+  801b22:	83 ec 1c             	sub    $0x1c,%esp
+  801b25:	89 c7                	mov    %eax,%edi
+  801b27:	89 d6                	mov    %edx,%esi
+  801b29:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801b2b:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801b31:	77 52                	ja     801b85 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b33:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b36:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801b3b:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b41:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b46:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b4b:	e8 b6 fb ff ff       	call   801706 <fsipc>
+  801b50:	89 c7                	mov    %eax,%edi
+  801b52:	85 c0                	test   %eax,%eax
+  801b54:	78 25                	js     801b7b <file_read_direct+0x5f>
+	assert(r <= n);
+  801b56:	39 c3                	cmp    %eax,%ebx
+  801b58:	0f 82 87 00 00 00    	jb     801be5 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801b5e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b63:	0f 8f 95 00 00 00    	jg     801bfe <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b69:	83 ec 04             	sub    $0x4,%esp
+  801b6c:	50                   	push   %eax
+  801b6d:	68 00 60 80 00       	push   $0x806000
+  801b72:	56                   	push   %esi
+  801b73:	e8 52 ed ff ff       	call   8008ca <memmove>
+	return r;
+  801b78:	83 c4 10             	add    $0x10,%esp
+}
+  801b7b:	89 f8                	mov    %edi,%eax
+  801b7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b80:	5b                   	pop    %ebx
+  801b81:	5e                   	pop    %esi
+  801b82:	5f                   	pop    %edi
+  801b83:	5d                   	pop    %ebp
+  801b84:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801b85:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801b8b:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b90:	29 d1                	sub    %edx,%ecx
+  801b92:	39 d9                	cmp    %ebx,%ecx
+  801b94:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801b97:	89 f0                	mov    %esi,%eax
+  801b99:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801b9c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b9f:	eb 0f                	jmp    801bb0 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801ba1:	0f b6 10             	movzbl (%eax),%edx
+  801ba4:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801ba6:	05 00 10 00 00       	add    $0x1000,%eax
+  801bab:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801bb0:	39 c8                	cmp    %ecx,%eax
+  801bb2:	72 ed                	jb     801ba1 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801bb4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801bb7:	8b 47 0c             	mov    0xc(%edi),%eax
+  801bba:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801bbf:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801bc5:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801bcb:	83 ec 0c             	sub    $0xc,%esp
+  801bce:	6a 07                	push   $0x7
+  801bd0:	89 d9                	mov    %ebx,%ecx
+  801bd2:	89 f2                	mov    %esi,%edx
+  801bd4:	b8 09 00 00 00       	mov    $0x9,%eax
+  801bd9:	e8 86 f9 ff ff       	call   801564 <fsipc_pages>
+  801bde:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801be0:	83 c4 10             	add    $0x10,%esp
+  801be3:	eb 96                	jmp    801b7b <file_read_direct+0x5f>
+	assert(r <= n);
+  801be5:	68 a0 3b 80 00       	push   $0x803ba0
+  801bea:	68 80 3b 80 00       	push   $0x803b80
+  801bef:	68 dc 00 00 00       	push   $0xdc
+  801bf4:	68 95 3b 80 00       	push   $0x803b95
+  801bf9:	e8 0e 13 00 00       	call   802f0c <_panic>
+	assert(r <= PGSIZE);
+  801bfe:	68 b1 3b 80 00       	push   $0x803bb1
+  801c03:	68 80 3b 80 00       	push   $0x803b80
+  801c08:	68 dd 00 00 00       	push   $0xdd
+  801c0d:	68 95 3b 80 00       	push   $0x803b95
+  801c12:	e8 f5 12 00 00       	call   802f0c <_panic>
+
+00801c17 <devfile_read>:
+{
+  801c17:	55                   	push   %ebp
+  801c18:	89 e5                	mov    %esp,%ebp
+  801c1a:	57                   	push   %edi
+  801c1b:	56                   	push   %esi
+  801c1c:	53                   	push   %ebx
+  801c1d:	83 ec 28             	sub    $0x28,%esp
+  801c20:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c23:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801c26:	53                   	push   %ebx
+  801c27:	e8 35 f3 ff ff       	call   800f61 <fd2data>
+  801c2c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801c2f:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801c32:	83 c4 10             	add    $0x10,%esp
+  801c35:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801c39:	74 7d                	je     801cb8 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801c3b:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801c3f:	0f 85 81 00 00 00    	jne    801cc6 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801c45:	8b 43 18             	mov    0x18(%ebx),%eax
+  801c48:	85 c0                	test   %eax,%eax
+  801c4a:	74 0d                	je     801c59 <devfile_read+0x42>
+  801c4c:	8b 53 14             	mov    0x14(%ebx),%edx
+  801c4f:	39 fa                	cmp    %edi,%edx
+  801c51:	7f 06                	jg     801c59 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801c53:	01 c2                	add    %eax,%edx
+  801c55:	39 d7                	cmp    %edx,%edi
+  801c57:	72 28                	jb     801c81 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801c59:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801c60:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801c66:	77 74                	ja     801cdc <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801c68:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801c6d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c70:	89 d8                	mov    %ebx,%eax
+  801c72:	e8 a5 fe ff ff       	call   801b1c <file_read_direct>
+  801c77:	85 c0                	test   %eax,%eax
+  801c79:	7e 35                	jle    801cb0 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801c7b:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801c7e:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801c81:	8b 53 14             	mov    0x14(%ebx),%edx
+  801c84:	89 d0                	mov    %edx,%eax
+  801c86:	03 43 18             	add    0x18(%ebx),%eax
+  801c89:	29 f8                	sub    %edi,%eax
+  801c8b:	39 f0                	cmp    %esi,%eax
+  801c8d:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801c90:	83 ec 04             	sub    $0x4,%esp
+  801c93:	56                   	push   %esi
+  801c94:	89 f8                	mov    %edi,%eax
+  801c96:	29 d0                	sub    %edx,%eax
+  801c98:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801c9b:	01 c1                	add    %eax,%ecx
+  801c9d:	51                   	push   %ecx
+  801c9e:	ff 75 0c             	push   0xc(%ebp)
+  801ca1:	e8 24 ec ff ff       	call   8008ca <memmove>
+	fd->fd_offset = pos + n;
+  801ca6:	01 f7                	add    %esi,%edi
+  801ca8:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801cab:	89 f0                	mov    %esi,%eax
+  801cad:	83 c4 10             	add    $0x10,%esp
+}
+  801cb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cb3:	5b                   	pop    %ebx
+  801cb4:	5e                   	pop    %esi
+  801cb5:	5f                   	pop    %edi
+  801cb6:	5d                   	pop    %ebp
+  801cb7:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801cb8:	89 f1                	mov    %esi,%ecx
+  801cba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cbd:	89 d8                	mov    %ebx,%eax
+  801cbf:	e8 58 fe ff ff       	call   801b1c <file_read_direct>
+  801cc4:	eb ea                	jmp    801cb0 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801cc6:	83 ec 0c             	sub    $0xc,%esp
+  801cc9:	53                   	push   %ebx
+  801cca:	e8 db fa ff ff       	call   8017aa <devfile_sync>
+  801ccf:	83 c4 10             	add    $0x10,%esp
+  801cd2:	85 c0                	test   %eax,%eax
+  801cd4:	0f 89 6b ff ff ff    	jns    801c45 <devfile_read+0x2e>
+  801cda:	eb d4                	jmp    801cb0 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801cdc:	89 f1                	mov    %esi,%ecx
+  801cde:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ce1:	89 d8                	mov    %ebx,%eax
+  801ce3:	e8 34 fe ff ff       	call   801b1c <file_read_direct>
+  801ce8:	eb c6                	jmp    801cb0 <devfile_read+0x99>
+
+00801cea <open>:
+{
+  801cea:	55                   	push   %ebp
+  801ceb:	89 e5                	mov    %esp,%ebp
+  801ced:	56                   	push   %esi
+  801cee:	53                   	push   %ebx
+  801cef:	83 ec 1c             	sub    $0x1c,%esp
+  801cf2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801cf5:	56                   	push   %esi
+  801cf6:	e8 0e ea ff ff       	call   800709 <strlen>
+  801cfb:	83 c4 10             	add    $0x10,%esp
+  801cfe:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d03:	0f 8f a0 00 00 00    	jg     801da9 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801d09:	83 ec 0c             	sub    $0xc,%esp
+  801d0c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d0f:	50                   	push   %eax
+  801d10:	e8 63 f2 ff ff       	call   800f78 <fd_alloc>
+  801d15:	89 c3                	mov    %eax,%ebx
+  801d17:	83 c4 10             	add    $0x10,%esp
+  801d1a:	85 c0                	test   %eax,%eax
+  801d1c:	78 45                	js     801d63 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801d1e:	83 ec 08             	sub    $0x8,%esp
+  801d21:	56                   	push   %esi
+  801d22:	68 00 60 80 00       	push   $0x806000
+  801d27:	e8 18 ea ff ff       	call   800744 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d2f:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d34:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d37:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d3c:	e8 c5 f9 ff ff       	call   801706 <fsipc>
+  801d41:	89 c3                	mov    %eax,%ebx
+  801d43:	83 c4 10             	add    $0x10,%esp
+  801d46:	85 c0                	test   %eax,%eax
+  801d48:	78 22                	js     801d6c <open+0x82>
+	if (!(mode & O_NOBUF)
+  801d4a:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801d51:	74 2b                	je     801d7e <open+0x94>
+	return fd2num(fd);
+  801d53:	83 ec 0c             	sub    $0xc,%esp
+  801d56:	ff 75 f4             	push   -0xc(%ebp)
+  801d59:	e8 f3 f1 ff ff       	call   800f51 <fd2num>
+  801d5e:	89 c3                	mov    %eax,%ebx
+  801d60:	83 c4 10             	add    $0x10,%esp
+}
+  801d63:	89 d8                	mov    %ebx,%eax
+  801d65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d68:	5b                   	pop    %ebx
+  801d69:	5e                   	pop    %esi
+  801d6a:	5d                   	pop    %ebp
+  801d6b:	c3                   	ret
+		fd_close(fd, 0);
+  801d6c:	83 ec 08             	sub    $0x8,%esp
+  801d6f:	6a 00                	push   $0x0
+  801d71:	ff 75 f4             	push   -0xc(%ebp)
+  801d74:	e8 f8 f2 ff ff       	call   801071 <fd_close>
+		return r;
+  801d79:	83 c4 10             	add    $0x10,%esp
+  801d7c:	eb e5                	jmp    801d63 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801d7e:	83 ec 0c             	sub    $0xc,%esp
+  801d81:	ff 75 f4             	push   -0xc(%ebp)
+  801d84:	e8 d8 f1 ff ff       	call   800f61 <fd2data>
+  801d89:	83 c4 0c             	add    $0xc,%esp
+  801d8c:	68 07 04 00 00       	push   $0x407
+  801d91:	50                   	push   %eax
+  801d92:	6a 00                	push   $0x0
+  801d94:	e8 b7 ed ff ff       	call   800b50 <sys_page_alloc>
+  801d99:	83 c4 10             	add    $0x10,%esp
+  801d9c:	85 c0                	test   %eax,%eax
+  801d9e:	75 b3                	jne    801d53 <open+0x69>
+		fd->fd_file.buffered = 1;
+  801da0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801da3:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801da7:	eb aa                	jmp    801d53 <open+0x69>
+		return -E_BAD_PATH;
+  801da9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801dae:	eb b3                	jmp    801d63 <open+0x79>
+
+00801db0 <readdir>:
+{
+  801db0:	55                   	push   %ebp
+  801db1:	89 e5                	mov    %esp,%ebp
+  801db3:	53                   	push   %ebx
+  801db4:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801db7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dba:	50                   	push   %eax
+  801dbb:	ff 75 08             	push   0x8(%ebp)
+  801dbe:	e8 0b f2 ff ff       	call   800fce <fd_lookup>
+  801dc3:	89 c3                	mov    %eax,%ebx
+  801dc5:	83 c4 10             	add    $0x10,%esp
+  801dc8:	85 c0                	test   %eax,%eax
+  801dca:	78 73                	js     801e3f <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801dcc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dcf:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801dd5:	39 08                	cmp    %ecx,(%eax)
+  801dd7:	0f 85 82 00 00 00    	jne    801e5f <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801ddd:	83 ec 0c             	sub    $0xc,%esp
+  801de0:	50                   	push   %eax
+  801de1:	e8 c4 f9 ff ff       	call   8017aa <devfile_sync>
+  801de6:	89 c3                	mov    %eax,%ebx
+  801de8:	83 c4 10             	add    $0x10,%esp
+  801deb:	85 c0                	test   %eax,%eax
+  801ded:	78 50                	js     801e3f <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801def:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801df2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801df5:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801dfa:	8b 45 10             	mov    0x10(%ebp),%eax
+  801dfd:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801e02:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e05:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801e0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e0f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e14:	e8 ed f8 ff ff       	call   801706 <fsipc>
+  801e19:	89 c3                	mov    %eax,%ebx
+  801e1b:	85 c0                	test   %eax,%eax
+  801e1d:	7e 20                	jle    801e3f <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801e1f:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801e22:	72 22                	jb     801e46 <readdir+0x96>
+  801e24:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e29:	7f 1b                	jg     801e46 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e2b:	83 ec 04             	sub    $0x4,%esp
+  801e2e:	50                   	push   %eax
+  801e2f:	68 00 60 80 00       	push   $0x806000
+  801e34:	ff 75 0c             	push   0xc(%ebp)
+  801e37:	e8 8e ea ff ff       	call   8008ca <memmove>
+	return r;
+  801e3c:	83 c4 10             	add    $0x10,%esp
+}
+  801e3f:	89 d8                	mov    %ebx,%eax
+  801e41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e44:	c9                   	leave
+  801e45:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801e46:	68 a7 3b 80 00       	push   $0x803ba7
+  801e4b:	68 80 3b 80 00       	push   $0x803b80
+  801e50:	68 86 01 00 00       	push   $0x186
+  801e55:	68 95 3b 80 00       	push   $0x803b95
+  801e5a:	e8 ad 10 00 00       	call   802f0c <_panic>
+		return -E_NOT_SUPP;
+  801e5f:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801e64:	eb d9                	jmp    801e3f <readdir+0x8f>
+
+00801e66 <munmap>:
+{
+  801e66:	55                   	push   %ebp
+  801e67:	89 e5                	mov    %esp,%ebp
+  801e69:	56                   	push   %esi
+  801e6a:	53                   	push   %ebx
+  801e6b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801e71:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801e77:	75 41                	jne    801eba <munmap+0x54>
+  801e79:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801e7f:	77 39                	ja     801eba <munmap+0x54>
+  801e81:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801e86:	29 f0                	sub    %esi,%eax
+  801e88:	39 d0                	cmp    %edx,%eax
+  801e8a:	72 35                	jb     801ec1 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801e8c:	89 f3                	mov    %esi,%ebx
+  801e8e:	01 d6                	add    %edx,%esi
+  801e90:	39 f3                	cmp    %esi,%ebx
+  801e92:	73 1a                	jae    801eae <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801e94:	83 ec 08             	sub    $0x8,%esp
+  801e97:	53                   	push   %ebx
+  801e98:	6a 00                	push   $0x0
+  801e9a:	e8 3e ed ff ff       	call   800bdd <sys_page_unmap>
+  801e9f:	83 c4 10             	add    $0x10,%esp
+  801ea2:	85 c0                	test   %eax,%eax
+  801ea4:	78 0d                	js     801eb3 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801ea6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801eac:	eb e2                	jmp    801e90 <munmap+0x2a>
+	return 0;
+  801eae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eb3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb6:	5b                   	pop    %ebx
+  801eb7:	5e                   	pop    %esi
+  801eb8:	5d                   	pop    %ebp
+  801eb9:	c3                   	ret
+		return -E_INVAL;
+  801eba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ebf:	eb f2                	jmp    801eb3 <munmap+0x4d>
+  801ec1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ec6:	eb eb                	jmp    801eb3 <munmap+0x4d>
+
+00801ec8 <mmap>:
+{
+  801ec8:	55                   	push   %ebp
+  801ec9:	89 e5                	mov    %esp,%ebp
+  801ecb:	57                   	push   %edi
+  801ecc:	56                   	push   %esi
+  801ecd:	53                   	push   %ebx
+  801ece:	83 ec 34             	sub    $0x34,%esp
+  801ed1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ed4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ed7:	50                   	push   %eax
+  801ed8:	ff 75 18             	push   0x18(%ebp)
+  801edb:	e8 ee f0 ff ff       	call   800fce <fd_lookup>
+  801ee0:	89 c3                	mov    %eax,%ebx
+  801ee2:	83 c4 10             	add    $0x10,%esp
+  801ee5:	85 c0                	test   %eax,%eax
+  801ee7:	0f 88 0e 01 00 00    	js     801ffb <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801eed:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ef0:	a1 20 40 80 00       	mov    0x804020,%eax
+  801ef5:	39 02                	cmp    %eax,(%edx)
+  801ef7:	0f 85 50 01 00 00    	jne    80204d <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801efd:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f00:	83 e0 02             	and    $0x2,%eax
+  801f03:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f06:	74 0a                	je     801f12 <mmap+0x4a>
+  801f08:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801f0c:	0f 84 42 01 00 00    	je     802054 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801f12:	8b 42 08             	mov    0x8(%edx),%eax
+  801f15:	83 e0 03             	and    $0x3,%eax
+  801f18:	83 f8 01             	cmp    $0x1,%eax
+  801f1b:	0f 84 3a 01 00 00    	je     80205b <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  801f21:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f24:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801f27:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f2c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801f2f:	0f 85 2d 01 00 00    	jne    802062 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801f35:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801f39:	0f 88 2a 01 00 00    	js     802069 <mmap+0x1a1>
+  801f3f:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  801f46:	0f 87 1d 01 00 00    	ja     802069 <mmap+0x1a1>
+  801f4c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f51:	2b 45 08             	sub    0x8(%ebp),%eax
+  801f54:	39 f8                	cmp    %edi,%eax
+  801f56:	0f 82 14 01 00 00    	jb     802070 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  801f5c:	83 ec 0c             	sub    $0xc,%esp
+  801f5f:	52                   	push   %edx
+  801f60:	e8 45 f8 ff ff       	call   8017aa <devfile_sync>
+  801f65:	89 c3                	mov    %eax,%ebx
+  801f67:	83 c4 10             	add    $0x10,%esp
+  801f6a:	85 c0                	test   %eax,%eax
+  801f6c:	0f 88 89 00 00 00    	js     801ffb <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  801f72:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  801f78:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801f7e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f83:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  801f86:	39 fe                	cmp    %edi,%esi
+  801f88:	73 7b                	jae    802005 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  801f8a:	89 f8                	mov    %edi,%eax
+  801f8c:	29 f0                	sub    %esi,%eax
+  801f8e:	c1 e8 0c             	shr    $0xc,%eax
+  801f91:	ba 40 00 00 00       	mov    $0x40,%edx
+  801f96:	39 d0                	cmp    %edx,%eax
+  801f98:	0f 47 c2             	cmova  %edx,%eax
+  801f9b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801f9e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fa1:	8b 52 0c             	mov    0xc(%edx),%edx
+  801fa4:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  801faa:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  801fad:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  801fb3:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  801fb8:	89 f2                	mov    %esi,%edx
+  801fba:	03 55 08             	add    0x8(%ebp),%edx
+  801fbd:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  801fc0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801fc5:	e8 ea f6 ff ff       	call   8016b4 <fsipcv>
+  801fca:	85 c0                	test   %eax,%eax
+  801fcc:	7e 12                	jle    801fe0 <mmap+0x118>
+  801fce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	0f 84 9e 00 00 00    	je     802077 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801fd9:	c1 e0 0c             	shl    $0xc,%eax
+  801fdc:	01 c6                	add    %eax,%esi
+  801fde:	eb a6                	jmp    801f86 <mmap+0xbe>
+			munmap(addr, done);
+  801fe0:	89 c3                	mov    %eax,%ebx
+  801fe2:	83 ec 08             	sub    $0x8,%esp
+  801fe5:	56                   	push   %esi
+  801fe6:	ff 75 08             	push   0x8(%ebp)
+  801fe9:	e8 78 fe ff ff       	call   801e66 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  801fee:	83 c4 10             	add    $0x10,%esp
+  801ff1:	85 db                	test   %ebx,%ebx
+  801ff3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ff8:	0f 49 d8             	cmovns %eax,%ebx
+}
+  801ffb:	89 d8                	mov    %ebx,%eax
+  801ffd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802000:	5b                   	pop    %ebx
+  802001:	5e                   	pop    %esi
+  802002:	5f                   	pop    %edi
+  802003:	5d                   	pop    %ebp
+  802004:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802005:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802008:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80200a:	85 c0                	test   %eax,%eax
+  80200c:	74 ed                	je     801ffb <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80200e:	be 00 00 00 00       	mov    $0x0,%esi
+  802013:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802016:	39 fe                	cmp    %edi,%esi
+  802018:	73 2e                	jae    802048 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80201a:	83 ec 0c             	sub    $0xc,%esp
+  80201d:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802020:	50                   	push   %eax
+  802021:	e8 43 10 00 00       	call   803069 <cowpage>
+  802026:	83 c4 10             	add    $0x10,%esp
+  802029:	85 c0                	test   %eax,%eax
+  80202b:	78 08                	js     802035 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  80202d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802033:	eb e1                	jmp    802016 <mmap+0x14e>
+				munmap(addr, len);
+  802035:	89 c3                	mov    %eax,%ebx
+  802037:	83 ec 08             	sub    $0x8,%esp
+  80203a:	57                   	push   %edi
+  80203b:	ff 75 08             	push   0x8(%ebp)
+  80203e:	e8 23 fe ff ff       	call   801e66 <munmap>
+				return r;
+  802043:	83 c4 10             	add    $0x10,%esp
+  802046:	eb b3                	jmp    801ffb <mmap+0x133>
+	return 0;
+  802048:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80204b:	eb ae                	jmp    801ffb <mmap+0x133>
+		return -E_NOT_SUPP;
+  80204d:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802052:	eb a7                	jmp    801ffb <mmap+0x133>
+		return -E_NOT_SUPP;
+  802054:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802059:	eb a0                	jmp    801ffb <mmap+0x133>
+		return -E_INVAL;
+  80205b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802060:	eb 99                	jmp    801ffb <mmap+0x133>
+  802062:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802067:	eb 92                	jmp    801ffb <mmap+0x133>
+  802069:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80206e:	eb 8b                	jmp    801ffb <mmap+0x133>
+  802070:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802075:	eb 84                	jmp    801ffb <mmap+0x133>
+			munmap(addr, done);
+  802077:	83 ec 08             	sub    $0x8,%esp
+  80207a:	56                   	push   %esi
+  80207b:	ff 75 08             	push   0x8(%ebp)
+  80207e:	e8 e3 fd ff ff       	call   801e66 <munmap>
+  802083:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802086:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80208b:	e9 6b ff ff ff       	jmp    801ffb <mmap+0x133>
+
+00802090 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802090:	55                   	push   %ebp
+  802091:	89 e5                	mov    %esp,%ebp
+  802093:	56                   	push   %esi
+  802094:	53                   	push   %ebx
+  802095:	83 ec 10             	sub    $0x10,%esp
+  802098:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80209b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80209e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020a1:	e8 3d f9 ff ff       	call   8019e3 <fsring_slot>
+  8020a6:	85 c0                	test   %eax,%eax
+  8020a8:	78 60                	js     80210a <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8020aa:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8020ad:	8b 56 08             	mov    0x8(%esi),%edx
+  8020b0:	83 e2 03             	and    $0x3,%edx
+  8020b3:	83 fa 01             	cmp    $0x1,%edx
+  8020b6:	74 59                	je     802111 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8020b8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8020bd:	89 c1                	mov    %eax,%ecx
+  8020bf:	d3 e2                	shl    %cl,%edx
+  8020c1:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8020c7:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8020ca:	c1 e2 02             	shl    $0x2,%edx
+  8020cd:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8020d3:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  8020da:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8020dd:	8b 55 18             	mov    0x18(%ebp),%edx
+  8020e0:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8020e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020e6:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8020e9:	83 ec 08             	sub    $0x8,%esp
+  8020ec:	50                   	push   %eax
+  8020ed:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8020f2:	39 c3                	cmp    %eax,%ebx
+  8020f4:	0f 47 d8             	cmova  %eax,%ebx
+  8020f7:	53                   	push   %ebx
+  8020f8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8020fb:	89 f2                	mov    %esi,%edx
+  8020fd:	b8 03 00 00 00       	mov    $0x3,%eax
+  802102:	e8 1e f5 ff ff       	call   801625 <fsring_post>
+  802107:	83 c4 10             	add    $0x10,%esp
+}
+  80210a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80210d:	5b                   	pop    %ebx
+  80210e:	5e                   	pop    %esi
+  80210f:	5d                   	pop    %ebp
+  802110:	c3                   	ret
+		return -E_INVAL;
+  802111:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802116:	eb f2                	jmp    80210a <fsring_read+0x7a>
+
+00802118 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802118:	55                   	push   %ebp
+  802119:	89 e5                	mov    %esp,%ebp
+  80211b:	56                   	push   %esi
+  80211c:	53                   	push   %ebx
+  80211d:	83 ec 10             	sub    $0x10,%esp
+  802120:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802123:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802126:	8b 45 08             	mov    0x8(%ebp),%eax
+  802129:	e8 b5 f8 ff ff       	call   8019e3 <fsring_slot>
+  80212e:	89 c3                	mov    %eax,%ebx
+  802130:	85 c0                	test   %eax,%eax
+  802132:	78 77                	js     8021ab <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802134:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802137:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80213b:	74 77                	je     8021b4 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80213d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802142:	39 c6                	cmp    %eax,%esi
+  802144:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802147:	83 ec 04             	sub    $0x4,%esp
+  80214a:	56                   	push   %esi
+  80214b:	ff 75 0c             	push   0xc(%ebp)
+  80214e:	89 d8                	mov    %ebx,%eax
+  802150:	c1 e0 0c             	shl    $0xc,%eax
+  802153:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802159:	50                   	push   %eax
+  80215a:	e8 6b e7 ff ff       	call   8008ca <memmove>
+	fsring_busy |= 1 << slot;
+  80215f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802164:	89 d9                	mov    %ebx,%ecx
+  802166:	d3 e0                	shl    %cl,%eax
+  802168:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  80216e:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802171:	c1 e0 02             	shl    $0x2,%eax
+  802174:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  80217a:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  802181:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802184:	8b 45 18             	mov    0x18(%ebp),%eax
+  802187:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80218a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802191:	83 c4 08             	add    $0x8,%esp
+  802194:	53                   	push   %ebx
+  802195:	56                   	push   %esi
+  802196:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802199:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80219c:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021a1:	e8 7f f4 ff ff       	call   801625 <fsring_post>
+  8021a6:	89 c3                	mov    %eax,%ebx
+  8021a8:	83 c4 10             	add    $0x10,%esp
+}
+  8021ab:	89 d8                	mov    %ebx,%eax
+  8021ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b0:	5b                   	pop    %ebx
+  8021b1:	5e                   	pop    %esi
+  8021b2:	5d                   	pop    %ebp
+  8021b3:	c3                   	ret
+		return -E_INVAL;
+  8021b4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021b9:	eb f0                	jmp    8021ab <fsring_write+0x93>
+
+008021bb <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8021bb:	55                   	push   %ebp
+  8021bc:	89 e5                	mov    %esp,%ebp
+  8021be:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8021c1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c7:	e8 17 f8 ff ff       	call   8019e3 <fsring_slot>
+  8021cc:	85 c0                	test   %eax,%eax
+  8021ce:	78 4c                	js     80221c <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8021d0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8021d5:	89 c1                	mov    %eax,%ecx
+  8021d7:	d3 e2                	shl    %cl,%edx
+  8021d9:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8021df:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8021e2:	c1 e2 02             	shl    $0x2,%edx
+  8021e5:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8021eb:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  8021f2:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8021f5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021f8:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8021fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021fe:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802201:	83 ec 08             	sub    $0x8,%esp
+  802204:	50                   	push   %eax
+  802205:	6a 00                	push   $0x0
+  802207:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80220c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80220f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802214:	e8 0c f4 ff ff       	call   801625 <fsring_post>
+  802219:	83 c4 10             	add    $0x10,%esp
+}
+  80221c:	c9                   	leave
+  80221d:	c3                   	ret
+
+0080221e <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  80221e:	55                   	push   %ebp
+  80221f:	89 e5                	mov    %esp,%ebp
+  802221:	57                   	push   %edi
+  802222:	56                   	push   %esi
+  802223:	53                   	push   %ebx
+  802224:	83 ec 1c             	sub    $0x1c,%esp
+  802227:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80222b:	a1 00 50 80 00       	mov    0x805000,%eax
+  802230:	8b 40 48             	mov    0x48(%eax),%eax
+  802233:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  802239:	74 12                	je     80224d <fsring_reap+0x2f>
+		return 0;
+  80223b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802240:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802243:	5b                   	pop    %ebx
+  802244:	5e                   	pop    %esi
+  802245:	5f                   	pop    %edi
+  802246:	5d                   	pop    %ebp
+  802247:	c3                   	ret
+		sys_yield();
+  802248:	e8 e4 e8 ff ff       	call   800b31 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  80224d:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802253:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802258:	39 c2                	cmp    %eax,%edx
+  80225a:	75 18                	jne    802274 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  80225c:	84 db                	test   %bl,%bl
+  80225e:	0f 84 21 01 00 00    	je     802385 <fsring_reap+0x167>
+  802264:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  80226b:	75 db                	jne    802248 <fsring_reap+0x2a>
+			return 0;
+  80226d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802272:	eb cc                	jmp    802240 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802274:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802279:	83 e0 0f             	and    $0xf,%eax
+  80227c:	83 c0 2a             	add    $0x2a,%eax
+  80227f:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802286:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  80228d:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802292:	83 c0 01             	add    $0x1,%eax
+  802295:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  80229a:	83 fb 0f             	cmp    $0xf,%ebx
+  80229d:	77 5b                	ja     8022fa <fsring_reap+0xdc>
+  80229f:	be 01 00 00 00       	mov    $0x1,%esi
+  8022a4:	89 d9                	mov    %ebx,%ecx
+  8022a6:	d3 e6                	shl    %cl,%esi
+  8022a8:	89 f0                	mov    %esi,%eax
+  8022aa:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8022b0:	74 48                	je     8022fa <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8022b2:	89 d8                	mov    %ebx,%eax
+  8022b4:	c1 e0 0c             	shl    $0xc,%eax
+  8022b7:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8022bd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8022c0:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8022c3:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  8022ca:	83 f8 03             	cmp    $0x3,%eax
+  8022cd:	74 40                	je     80230f <fsring_reap+0xf1>
+  8022cf:	83 f8 05             	cmp    $0x5,%eax
+  8022d2:	74 64                	je     802338 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8022d4:	f7 d6                	not    %esi
+  8022d6:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8022dc:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8022df:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  8022e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022e9:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8022eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022ee:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8022f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022f5:	e9 46 ff ff ff       	jmp    802240 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8022fa:	53                   	push   %ebx
+  8022fb:	68 bd 3b 80 00       	push   $0x803bbd
+  802300:	68 8f 02 00 00       	push   $0x28f
+  802305:	68 95 3b 80 00       	push   $0x803b95
+  80230a:	e8 fd 0b 00 00       	call   802f0c <_panic>
+		if (cqe.cqe_result > 0)
+  80230f:	85 ff                	test   %edi,%edi
+  802311:	7e c1                	jle    8022d4 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802313:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802316:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80231b:	39 c7                	cmp    %eax,%edi
+  80231d:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802320:	50                   	push   %eax
+  802321:	ff 75 e4             	push   -0x1c(%ebp)
+  802324:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802327:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  80232e:	e8 97 e5 ff ff       	call   8008ca <memmove>
+  802333:	83 c4 10             	add    $0x10,%esp
+  802336:	eb 9c                	jmp    8022d4 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802338:	85 ff                	test   %edi,%edi
+  80233a:	75 98                	jne    8022d4 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80233c:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80233f:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802346:	83 ec 08             	sub    $0x8,%esp
+  802349:	ff 75 e4             	push   -0x1c(%ebp)
+  80234c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80234f:	51                   	push   %ecx
+  802350:	e8 ef e3 ff ff       	call   800744 <strcpy>
+			st->st_size = ret->ret_size;
+  802355:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802358:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  80235e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802361:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802367:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  80236d:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802373:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  80237a:	40 80 00 
+  80237d:	83 c4 10             	add    $0x10,%esp
+  802380:	e9 4f ff ff ff       	jmp    8022d4 <fsring_reap+0xb6>
+			return 0;
+  802385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80238a:	e9 b1 fe ff ff       	jmp    802240 <fsring_reap+0x22>
+
+0080238f <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  80238f:	55                   	push   %ebp
+  802390:	89 e5                	mov    %esp,%ebp
+  802392:	57                   	push   %edi
+  802393:	56                   	push   %esi
+  802394:	53                   	push   %ebx
+  802395:	83 ec 28             	sub    $0x28,%esp
+  802398:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80239b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80239e:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8023a1:	53                   	push   %ebx
+  8023a2:	e8 62 e3 ff ff       	call   800709 <strlen>
+  8023a7:	83 c4 10             	add    $0x10,%esp
+  8023aa:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8023af:	0f 8f 02 01 00 00    	jg     8024b7 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8023b5:	83 ec 08             	sub    $0x8,%esp
+  8023b8:	53                   	push   %ebx
+  8023b9:	68 00 60 80 00       	push   $0x806000
+  8023be:	e8 81 e3 ff ff       	call   800744 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8023c3:	83 c4 10             	add    $0x10,%esp
+  8023c6:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8023cc:	76 69                	jbe    802437 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8023ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023d1:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8023d7:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8023dc:	29 d1                	sub    %edx,%ecx
+  8023de:	39 f9                	cmp    %edi,%ecx
+  8023e0:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8023e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023e6:	89 f9                	mov    %edi,%ecx
+  8023e8:	01 c1                	add    %eax,%ecx
+  8023ea:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8023ed:	eb 0f                	jmp    8023fe <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  8023ef:	0f b6 10             	movzbl (%eax),%edx
+  8023f2:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8023f4:	05 00 10 00 00       	add    $0x1000,%eax
+  8023f9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8023fe:	39 c8                	cmp    %ecx,%eax
+  802400:	72 ed                	jb     8023ef <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802402:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802405:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  80240b:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802411:	83 ec 0c             	sub    $0xc,%esp
+  802414:	6a 07                	push   $0x7
+  802416:	89 f9                	mov    %edi,%ecx
+  802418:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80241b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802420:	e8 3f f1 ff ff       	call   801564 <fsipc_pages>
+  802425:	89 c7                	mov    %eax,%edi
+  802427:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  80242a:	85 f6                	test   %esi,%esi
+  80242c:	74 7f                	je     8024ad <file_slurp+0x11e>
+  80242e:	8d 43 01             	lea    0x1(%ebx),%eax
+  802431:	85 ff                	test   %edi,%edi
+  802433:	79 3c                	jns    802471 <file_slurp+0xe2>
+  802435:	eb 76                	jmp    8024ad <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802437:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  80243d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802442:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802447:	e8 ba f2 ff ff       	call   801706 <fsipc>
+  80244c:	89 c7                	mov    %eax,%edi
+  80244e:	85 c0                	test   %eax,%eax
+  802450:	7e d8                	jle    80242a <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802452:	83 ec 04             	sub    $0x4,%esp
+  802455:	50                   	push   %eax
+  802456:	68 08 60 80 00       	push   $0x806008
+  80245b:	ff 75 0c             	push   0xc(%ebp)
+  80245e:	e8 67 e4 ff ff       	call   8008ca <memmove>
+  802463:	83 c4 10             	add    $0x10,%esp
+  802466:	eb c2                	jmp    80242a <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802468:	80 fa 2f             	cmp    $0x2f,%dl
+  80246b:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  80246e:	83 c0 01             	add    $0x1,%eax
+  802471:	89 c1                	mov    %eax,%ecx
+  802473:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802477:	84 d2                	test   %dl,%dl
+  802479:	75 ed                	jne    802468 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  80247b:	83 ec 04             	sub    $0x4,%esp
+  80247e:	68 80 00 00 00       	push   $0x80
+  802483:	53                   	push   %ebx
+  802484:	56                   	push   %esi
+  802485:	e8 30 e3 ff ff       	call   8007ba <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  80248a:	a1 00 60 80 00       	mov    0x806000,%eax
+  80248f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802495:	a1 04 60 80 00       	mov    0x806004,%eax
+  80249a:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8024a0:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  8024a7:	40 80 00 
+  8024aa:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8024ad:	89 f8                	mov    %edi,%eax
+  8024af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024b2:	5b                   	pop    %ebx
+  8024b3:	5e                   	pop    %esi
+  8024b4:	5f                   	pop    %edi
+  8024b5:	5d                   	pop    %ebp
+  8024b6:	c3                   	ret
+		return -E_BAD_PATH;
+  8024b7:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8024bc:	eb ef                	jmp    8024ad <file_slurp+0x11e>
+
+008024be <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8024be:	55                   	push   %ebp
+  8024bf:	89 e5                	mov    %esp,%ebp
+  8024c1:	53                   	push   %ebx
+  8024c2:	83 ec 10             	sub    $0x10,%esp
+  8024c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8024c8:	53                   	push   %ebx
+  8024c9:	e8 3b e2 ff ff       	call   800709 <strlen>
+  8024ce:	83 c4 10             	add    $0x10,%esp
+  8024d1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024d6:	7f 25                	jg     8024fd <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8024d8:	83 ec 08             	sub    $0x8,%esp
+  8024db:	53                   	push   %ebx
+  8024dc:	68 00 60 80 00       	push   $0x806000
+  8024e1:	e8 5e e2 ff ff       	call   800744 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8024e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024eb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024f0:	e8 11 f2 ff ff       	call   801706 <fsipc>
+  8024f5:	83 c4 10             	add    $0x10,%esp
+}
+  8024f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024fb:	c9                   	leave
+  8024fc:	c3                   	ret
+		return -E_BAD_PATH;
+  8024fd:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802502:	eb f4                	jmp    8024f8 <remove+0x3a>
+
+00802504 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802504:	55                   	push   %ebp
+  802505:	89 e5                	mov    %esp,%ebp
+  802507:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80250a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80250f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802514:	e8 ed f1 ff ff       	call   801706 <fsipc>
+}
+  802519:	c9                   	leave
+  80251a:	c3                   	ret
+
+0080251b <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  80251b:	55                   	push   %ebp
+  80251c:	89 e5                	mov    %esp,%ebp
+  80251e:	57                   	push   %edi
+  80251f:	56                   	push   %esi
+  802520:	53                   	push   %ebx
+  802521:	83 ec 18             	sub    $0x18,%esp
+  802524:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802527:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80252a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80252d:	57                   	push   %edi
+  80252e:	e8 d6 e1 ff ff       	call   800709 <strlen>
+  802533:	83 c4 10             	add    $0x10,%esp
+  802536:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80253b:	7f 4c                	jg     802589 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  80253d:	83 ec 08             	sub    $0x8,%esp
+  802540:	57                   	push   %edi
+  802541:	68 00 60 80 00       	push   $0x806000
+  802546:	e8 f9 e1 ff ff       	call   800744 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  80254b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802550:	b8 10 00 00 00       	mov    $0x10,%eax
+  802555:	e8 ac f1 ff ff       	call   801706 <fsipc>
+  80255a:	83 c4 10             	add    $0x10,%esp
+  80255d:	85 c0                	test   %eax,%eax
+  80255f:	78 20                	js     802581 <defrag+0x66>
+		return r;
+	if (before)
+  802561:	85 f6                	test   %esi,%esi
+  802563:	74 07                	je     80256c <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802565:	a1 00 60 80 00       	mov    0x806000,%eax
+  80256a:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  80256c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802571:	85 db                	test   %ebx,%ebx
+  802573:	74 0c                	je     802581 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802575:	a1 04 60 80 00       	mov    0x806004,%eax
+  80257a:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  80257c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802581:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802584:	5b                   	pop    %ebx
+  802585:	5e                   	pop    %esi
+  802586:	5f                   	pop    %edi
+  802587:	5d                   	pop    %ebp
+  802588:	c3                   	ret
+		return -E_BAD_PATH;
+  802589:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80258e:	eb f1                	jmp    802581 <defrag+0x66>
+
+00802590 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802590:	55                   	push   %ebp
+  802591:	89 e5                	mov    %esp,%ebp
+  802593:	53                   	push   %ebx
+  802594:	83 ec 04             	sub    $0x4,%esp
+  802597:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  80259a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80259f:	b8 11 00 00 00       	mov    $0x11,%eax
+  8025a4:	e8 5d f1 ff ff       	call   801706 <fsipc>
+  8025a9:	85 c0                	test   %eax,%eax
+  8025ab:	78 34                	js     8025e1 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  8025ad:	a1 00 60 80 00       	mov    0x806000,%eax
+  8025b2:	89 03                	mov    %eax,(%ebx)
+  8025b4:	a1 04 60 80 00       	mov    0x806004,%eax
+  8025b9:	89 43 04             	mov    %eax,0x4(%ebx)
+  8025bc:	a1 08 60 80 00       	mov    0x806008,%eax
+  8025c1:	89 43 08             	mov    %eax,0x8(%ebx)
+  8025c4:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  8025c9:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8025cc:	a1 10 60 80 00       	mov    0x806010,%eax
+  8025d1:	89 43 10             	mov    %eax,0x10(%ebx)
+  8025d4:	a1 14 60 80 00       	mov    0x806014,%eax
+  8025d9:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  8025dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025e4:	c9                   	leave
+  8025e5:	c3                   	ret
+
+008025e6 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8025e6:	55                   	push   %ebp
+  8025e7:	89 e5                	mov    %esp,%ebp
+  8025e9:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8025ec:	68 d6 3b 80 00       	push   $0x803bd6
+  8025f1:	ff 75 0c             	push   0xc(%ebp)
+  8025f4:	e8 4b e1 ff ff       	call   800744 <strcpy>
+	return 0;
+}
+  8025f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fe:	c9                   	leave
+  8025ff:	c3                   	ret
+
+00802600 <devsock_close>:
+{
+  802600:	55                   	push   %ebp
+  802601:	89 e5                	mov    %esp,%ebp
+  802603:	53                   	push   %ebx
+  802604:	83 ec 10             	sub    $0x10,%esp
+  802607:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80260a:	53                   	push   %ebx
+  80260b:	e8 3a 0e 00 00       	call   80344a <pageref>
+  802610:	89 c2                	mov    %eax,%edx
+  802612:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802615:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80261a:	83 fa 01             	cmp    $0x1,%edx
+  80261d:	74 05                	je     802624 <devsock_close+0x24>
+}
+  80261f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802622:	c9                   	leave
+  802623:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802624:	83 ec 0c             	sub    $0xc,%esp
+  802627:	ff 73 0c             	push   0xc(%ebx)
+  80262a:	e8 b7 02 00 00       	call   8028e6 <nsipc_close>
+  80262f:	83 c4 10             	add    $0x10,%esp
+  802632:	eb eb                	jmp    80261f <devsock_close+0x1f>
+
+00802634 <devsock_write>:
+{
+  802634:	55                   	push   %ebp
+  802635:	89 e5                	mov    %esp,%ebp
+  802637:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80263a:	6a 00                	push   $0x0
+  80263c:	ff 75 10             	push   0x10(%ebp)
+  80263f:	ff 75 0c             	push   0xc(%ebp)
+  802642:	8b 45 08             	mov    0x8(%ebp),%eax
+  802645:	ff 70 0c             	push   0xc(%eax)
+  802648:	e8 79 03 00 00       	call   8029c6 <nsipc_send>
+}
+  80264d:	c9                   	leave
+  80264e:	c3                   	ret
+
+0080264f <devsock_read>:
+{
+  80264f:	55                   	push   %ebp
+  802650:	89 e5                	mov    %esp,%ebp
+  802652:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802655:	6a 00                	push   $0x0
+  802657:	ff 75 10             	push   0x10(%ebp)
+  80265a:	ff 75 0c             	push   0xc(%ebp)
+  80265d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802660:	ff 70 0c             	push   0xc(%eax)
+  802663:	e8 ef 02 00 00       	call   802957 <nsipc_recv>
+}
+  802668:	c9                   	leave
+  802669:	c3                   	ret
+
+0080266a <fd2sockid>:
+{
+  80266a:	55                   	push   %ebp
+  80266b:	89 e5                	mov    %esp,%ebp
+  80266d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802670:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802673:	52                   	push   %edx
+  802674:	50                   	push   %eax
+  802675:	e8 54 e9 ff ff       	call   800fce <fd_lookup>
+  80267a:	83 c4 10             	add    $0x10,%esp
+  80267d:	85 c0                	test   %eax,%eax
+  80267f:	78 10                	js     802691 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802681:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802684:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  80268a:	39 08                	cmp    %ecx,(%eax)
+  80268c:	75 05                	jne    802693 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80268e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802691:	c9                   	leave
+  802692:	c3                   	ret
+		return -E_NOT_SUPP;
+  802693:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802698:	eb f7                	jmp    802691 <fd2sockid+0x27>
+
+0080269a <alloc_sockfd>:
+{
+  80269a:	55                   	push   %ebp
+  80269b:	89 e5                	mov    %esp,%ebp
+  80269d:	56                   	push   %esi
+  80269e:	53                   	push   %ebx
+  80269f:	83 ec 1c             	sub    $0x1c,%esp
+  8026a2:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8026a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026a7:	50                   	push   %eax
+  8026a8:	e8 cb e8 ff ff       	call   800f78 <fd_alloc>
+  8026ad:	89 c3                	mov    %eax,%ebx
+  8026af:	83 c4 10             	add    $0x10,%esp
+  8026b2:	85 c0                	test   %eax,%eax
+  8026b4:	78 43                	js     8026f9 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8026b6:	83 ec 04             	sub    $0x4,%esp
+  8026b9:	68 07 04 00 00       	push   $0x407
+  8026be:	ff 75 f4             	push   -0xc(%ebp)
+  8026c1:	6a 00                	push   $0x0
+  8026c3:	e8 88 e4 ff ff       	call   800b50 <sys_page_alloc>
+  8026c8:	89 c3                	mov    %eax,%ebx
+  8026ca:	83 c4 10             	add    $0x10,%esp
+  8026cd:	85 c0                	test   %eax,%eax
+  8026cf:	78 28                	js     8026f9 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8026d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026d4:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  8026da:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8026dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026df:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8026e6:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8026e9:	83 ec 0c             	sub    $0xc,%esp
+  8026ec:	50                   	push   %eax
+  8026ed:	e8 5f e8 ff ff       	call   800f51 <fd2num>
+  8026f2:	89 c3                	mov    %eax,%ebx
+  8026f4:	83 c4 10             	add    $0x10,%esp
+  8026f7:	eb 0c                	jmp    802705 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8026f9:	83 ec 0c             	sub    $0xc,%esp
+  8026fc:	56                   	push   %esi
+  8026fd:	e8 e4 01 00 00       	call   8028e6 <nsipc_close>
+		return r;
+  802702:	83 c4 10             	add    $0x10,%esp
+}
+  802705:	89 d8                	mov    %ebx,%eax
+  802707:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80270a:	5b                   	pop    %ebx
+  80270b:	5e                   	pop    %esi
+  80270c:	5d                   	pop    %ebp
+  80270d:	c3                   	ret
+
+0080270e <accept>:
+{
+  80270e:	55                   	push   %ebp
+  80270f:	89 e5                	mov    %esp,%ebp
+  802711:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802714:	8b 45 08             	mov    0x8(%ebp),%eax
+  802717:	e8 4e ff ff ff       	call   80266a <fd2sockid>
+  80271c:	85 c0                	test   %eax,%eax
+  80271e:	78 1b                	js     80273b <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802720:	83 ec 04             	sub    $0x4,%esp
+  802723:	ff 75 10             	push   0x10(%ebp)
+  802726:	ff 75 0c             	push   0xc(%ebp)
+  802729:	50                   	push   %eax
+  80272a:	e8 0e 01 00 00       	call   80283d <nsipc_accept>
+  80272f:	83 c4 10             	add    $0x10,%esp
+  802732:	85 c0                	test   %eax,%eax
+  802734:	78 05                	js     80273b <accept+0x2d>
+	return alloc_sockfd(r);
+  802736:	e8 5f ff ff ff       	call   80269a <alloc_sockfd>
+}
+  80273b:	c9                   	leave
+  80273c:	c3                   	ret
+
+0080273d <bind>:
+{
+  80273d:	55                   	push   %ebp
+  80273e:	89 e5                	mov    %esp,%ebp
+  802740:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802743:	8b 45 08             	mov    0x8(%ebp),%eax
+  802746:	e8 1f ff ff ff       	call   80266a <fd2sockid>
+  80274b:	85 c0                	test   %eax,%eax
+  80274d:	78 12                	js     802761 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80274f:	83 ec 04             	sub    $0x4,%esp
+  802752:	ff 75 10             	push   0x10(%ebp)
+  802755:	ff 75 0c             	push   0xc(%ebp)
+  802758:	50                   	push   %eax
+  802759:	e8 31 01 00 00       	call   80288f <nsipc_bind>
+  80275e:	83 c4 10             	add    $0x10,%esp
+}
+  802761:	c9                   	leave
+  802762:	c3                   	ret
+
+00802763 <shutdown>:
+{
+  802763:	55                   	push   %ebp
+  802764:	89 e5                	mov    %esp,%ebp
+  802766:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802769:	8b 45 08             	mov    0x8(%ebp),%eax
+  80276c:	e8 f9 fe ff ff       	call   80266a <fd2sockid>
+  802771:	85 c0                	test   %eax,%eax
+  802773:	78 0f                	js     802784 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802775:	83 ec 08             	sub    $0x8,%esp
+  802778:	ff 75 0c             	push   0xc(%ebp)
+  80277b:	50                   	push   %eax
+  80277c:	e8 43 01 00 00       	call   8028c4 <nsipc_shutdown>
+  802781:	83 c4 10             	add    $0x10,%esp
+}
+  802784:	c9                   	leave
+  802785:	c3                   	ret
+
+00802786 <connect>:
+{
+  802786:	55                   	push   %ebp
+  802787:	89 e5                	mov    %esp,%ebp
+  802789:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80278c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80278f:	e8 d6 fe ff ff       	call   80266a <fd2sockid>
+  802794:	85 c0                	test   %eax,%eax
+  802796:	78 12                	js     8027aa <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802798:	83 ec 04             	sub    $0x4,%esp
+  80279b:	ff 75 10             	push   0x10(%ebp)
+  80279e:	ff 75 0c             	push   0xc(%ebp)
+  8027a1:	50                   	push   %eax
+  8027a2:	e8 59 01 00 00       	call   802900 <nsipc_connect>
+  8027a7:	83 c4 10             	add    $0x10,%esp
+}
+  8027aa:	c9                   	leave
+  8027ab:	c3                   	ret
+
+008027ac <listen>:
+{
+  8027ac:	55                   	push   %ebp
+  8027ad:	89 e5                	mov    %esp,%ebp
+  8027af:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027b5:	e8 b0 fe ff ff       	call   80266a <fd2sockid>
+  8027ba:	85 c0                	test   %eax,%eax
+  8027bc:	78 0f                	js     8027cd <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8027be:	83 ec 08             	sub    $0x8,%esp
+  8027c1:	ff 75 0c             	push   0xc(%ebp)
+  8027c4:	50                   	push   %eax
+  8027c5:	e8 6b 01 00 00       	call   802935 <nsipc_listen>
+  8027ca:	83 c4 10             	add    $0x10,%esp
+}
+  8027cd:	c9                   	leave
+  8027ce:	c3                   	ret
+
+008027cf <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8027cf:	55                   	push   %ebp
+  8027d0:	89 e5                	mov    %esp,%ebp
+  8027d2:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8027d5:	ff 75 10             	push   0x10(%ebp)
+  8027d8:	ff 75 0c             	push   0xc(%ebp)
+  8027db:	ff 75 08             	push   0x8(%ebp)
+  8027de:	e8 41 02 00 00       	call   802a24 <nsipc_socket>
+  8027e3:	83 c4 10             	add    $0x10,%esp
+  8027e6:	85 c0                	test   %eax,%eax
+  8027e8:	78 05                	js     8027ef <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8027ea:	e8 ab fe ff ff       	call   80269a <alloc_sockfd>
+}
+  8027ef:	c9                   	leave
+  8027f0:	c3                   	ret
+
+008027f1 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8027f1:	55                   	push   %ebp
+  8027f2:	89 e5                	mov    %esp,%ebp
+  8027f4:	53                   	push   %ebx
+  8027f5:	83 ec 04             	sub    $0x4,%esp
+  8027f8:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8027fa:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802801:	74 26                	je     802829 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802803:	6a 07                	push   $0x7
+  802805:	68 00 80 80 00       	push   $0x808000
+  80280a:	53                   	push   %ebx
+  80280b:	ff 35 00 90 80 00    	push   0x809000
+  802811:	e8 bc 0a 00 00       	call   8032d2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802816:	83 c4 0c             	add    $0xc,%esp
+  802819:	6a 00                	push   $0x0
+  80281b:	6a 00                	push   $0x0
+  80281d:	6a 00                	push   $0x0
+  80281f:	e8 43 0a 00 00       	call   803267 <ipc_recv>
+}
+  802824:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802827:	c9                   	leave
+  802828:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802829:	83 ec 0c             	sub    $0xc,%esp
+  80282c:	6a 02                	push   $0x2
+  80282e:	e8 d8 0b 00 00       	call   80340b <ipc_find_env>
+  802833:	a3 00 90 80 00       	mov    %eax,0x809000
+  802838:	83 c4 10             	add    $0x10,%esp
+  80283b:	eb c6                	jmp    802803 <nsipc+0x12>
+
+0080283d <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80283d:	55                   	push   %ebp
+  80283e:	89 e5                	mov    %esp,%ebp
+  802840:	56                   	push   %esi
+  802841:	53                   	push   %ebx
+  802842:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802845:	8b 45 08             	mov    0x8(%ebp),%eax
+  802848:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80284d:	8b 06                	mov    (%esi),%eax
+  80284f:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802854:	b8 01 00 00 00       	mov    $0x1,%eax
+  802859:	e8 93 ff ff ff       	call   8027f1 <nsipc>
+  80285e:	89 c3                	mov    %eax,%ebx
+  802860:	85 c0                	test   %eax,%eax
+  802862:	79 09                	jns    80286d <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802864:	89 d8                	mov    %ebx,%eax
+  802866:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802869:	5b                   	pop    %ebx
+  80286a:	5e                   	pop    %esi
+  80286b:	5d                   	pop    %ebp
+  80286c:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80286d:	83 ec 04             	sub    $0x4,%esp
+  802870:	ff 35 10 80 80 00    	push   0x808010
+  802876:	68 00 80 80 00       	push   $0x808000
+  80287b:	ff 75 0c             	push   0xc(%ebp)
+  80287e:	e8 47 e0 ff ff       	call   8008ca <memmove>
+		*addrlen = ret->ret_addrlen;
+  802883:	a1 10 80 80 00       	mov    0x808010,%eax
+  802888:	89 06                	mov    %eax,(%esi)
+  80288a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80288d:	eb d5                	jmp    802864 <nsipc_accept+0x27>
+
+0080288f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80288f:	55                   	push   %ebp
+  802890:	89 e5                	mov    %esp,%ebp
+  802892:	53                   	push   %ebx
+  802893:	83 ec 08             	sub    $0x8,%esp
+  802896:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802899:	8b 45 08             	mov    0x8(%ebp),%eax
+  80289c:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8028a1:	53                   	push   %ebx
+  8028a2:	ff 75 0c             	push   0xc(%ebp)
+  8028a5:	68 04 80 80 00       	push   $0x808004
+  8028aa:	e8 1b e0 ff ff       	call   8008ca <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8028af:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8028b5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8028ba:	e8 32 ff ff ff       	call   8027f1 <nsipc>
+}
+  8028bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028c2:	c9                   	leave
+  8028c3:	c3                   	ret
+
+008028c4 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8028c4:	55                   	push   %ebp
+  8028c5:	89 e5                	mov    %esp,%ebp
+  8028c7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8028ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028cd:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  8028d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028d5:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  8028da:	b8 03 00 00 00       	mov    $0x3,%eax
+  8028df:	e8 0d ff ff ff       	call   8027f1 <nsipc>
+}
+  8028e4:	c9                   	leave
+  8028e5:	c3                   	ret
+
+008028e6 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8028e6:	55                   	push   %ebp
+  8028e7:	89 e5                	mov    %esp,%ebp
+  8028e9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8028ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ef:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8028f4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8028f9:	e8 f3 fe ff ff       	call   8027f1 <nsipc>
+}
+  8028fe:	c9                   	leave
+  8028ff:	c3                   	ret
+
+00802900 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802900:	55                   	push   %ebp
+  802901:	89 e5                	mov    %esp,%ebp
+  802903:	53                   	push   %ebx
+  802904:	83 ec 08             	sub    $0x8,%esp
+  802907:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80290a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80290d:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802912:	53                   	push   %ebx
+  802913:	ff 75 0c             	push   0xc(%ebp)
+  802916:	68 04 80 80 00       	push   $0x808004
+  80291b:	e8 aa df ff ff       	call   8008ca <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802920:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802926:	b8 05 00 00 00       	mov    $0x5,%eax
+  80292b:	e8 c1 fe ff ff       	call   8027f1 <nsipc>
+}
+  802930:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802933:	c9                   	leave
+  802934:	c3                   	ret
+
+00802935 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802935:	55                   	push   %ebp
+  802936:	89 e5                	mov    %esp,%ebp
+  802938:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80293b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80293e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802943:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802946:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  80294b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802950:	e8 9c fe ff ff       	call   8027f1 <nsipc>
+}
+  802955:	c9                   	leave
+  802956:	c3                   	ret
+
+00802957 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802957:	55                   	push   %ebp
+  802958:	89 e5                	mov    %esp,%ebp
+  80295a:	56                   	push   %esi
+  80295b:	53                   	push   %ebx
+  80295c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80295f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802962:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802967:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  80296d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802970:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802975:	b8 07 00 00 00       	mov    $0x7,%eax
+  80297a:	e8 72 fe ff ff       	call   8027f1 <nsipc>
+  80297f:	89 c3                	mov    %eax,%ebx
+  802981:	85 c0                	test   %eax,%eax
+  802983:	78 22                	js     8029a7 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802985:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80298a:	39 c6                	cmp    %eax,%esi
+  80298c:	0f 4e c6             	cmovle %esi,%eax
+  80298f:	39 c3                	cmp    %eax,%ebx
+  802991:	7f 1d                	jg     8029b0 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802993:	83 ec 04             	sub    $0x4,%esp
+  802996:	53                   	push   %ebx
+  802997:	68 00 80 80 00       	push   $0x808000
+  80299c:	ff 75 0c             	push   0xc(%ebp)
+  80299f:	e8 26 df ff ff       	call   8008ca <memmove>
+  8029a4:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8029a7:	89 d8                	mov    %ebx,%eax
+  8029a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029ac:	5b                   	pop    %ebx
+  8029ad:	5e                   	pop    %esi
+  8029ae:	5d                   	pop    %ebp
+  8029af:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8029b0:	68 e2 3b 80 00       	push   $0x803be2
+  8029b5:	68 80 3b 80 00       	push   $0x803b80
+  8029ba:	6a 62                	push   $0x62
+  8029bc:	68 f7 3b 80 00       	push   $0x803bf7
+  8029c1:	e8 46 05 00 00       	call   802f0c <_panic>
+
+008029c6 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8029c6:	55                   	push   %ebp
+  8029c7:	89 e5                	mov    %esp,%ebp
+  8029c9:	53                   	push   %ebx
+  8029ca:	83 ec 04             	sub    $0x4,%esp
+  8029cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8029d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029d3:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  8029d8:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8029de:	7f 2e                	jg     802a0e <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8029e0:	83 ec 04             	sub    $0x4,%esp
+  8029e3:	53                   	push   %ebx
+  8029e4:	ff 75 0c             	push   0xc(%ebp)
+  8029e7:	68 0c 80 80 00       	push   $0x80800c
+  8029ec:	e8 d9 de ff ff       	call   8008ca <memmove>
+	nsipcbuf.send.req_size = size;
+  8029f1:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8029f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029fa:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8029ff:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a04:	e8 e8 fd ff ff       	call   8027f1 <nsipc>
+}
+  802a09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a0c:	c9                   	leave
+  802a0d:	c3                   	ret
+	assert(size < 1600);
+  802a0e:	68 03 3c 80 00       	push   $0x803c03
+  802a13:	68 80 3b 80 00       	push   $0x803b80
+  802a18:	6a 6d                	push   $0x6d
+  802a1a:	68 f7 3b 80 00       	push   $0x803bf7
+  802a1f:	e8 e8 04 00 00       	call   802f0c <_panic>
+
+00802a24 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802a24:	55                   	push   %ebp
+  802a25:	89 e5                	mov    %esp,%ebp
+  802a27:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802a2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a2d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802a32:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a35:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802a3a:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a3d:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802a42:	b8 09 00 00 00       	mov    $0x9,%eax
+  802a47:	e8 a5 fd ff ff       	call   8027f1 <nsipc>
+}
+  802a4c:	c9                   	leave
+  802a4d:	c3                   	ret
+
+00802a4e <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a4e:	55                   	push   %ebp
+  802a4f:	89 e5                	mov    %esp,%ebp
+  802a51:	56                   	push   %esi
+  802a52:	53                   	push   %ebx
+  802a53:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802a56:	83 ec 0c             	sub    $0xc,%esp
+  802a59:	ff 75 08             	push   0x8(%ebp)
+  802a5c:	e8 00 e5 ff ff       	call   800f61 <fd2data>
+  802a61:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802a63:	83 c4 08             	add    $0x8,%esp
+  802a66:	68 0f 3c 80 00       	push   $0x803c0f
+  802a6b:	53                   	push   %ebx
+  802a6c:	e8 d3 dc ff ff       	call   800744 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802a71:	8b 46 04             	mov    0x4(%esi),%eax
+  802a74:	2b 06                	sub    (%esi),%eax
+  802a76:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802a7c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802a83:	00 00 00 
+	stat->st_dev = &devpipe;
+  802a86:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802a8d:	40 80 00 
+	return 0;
+}
+  802a90:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a98:	5b                   	pop    %ebx
+  802a99:	5e                   	pop    %esi
+  802a9a:	5d                   	pop    %ebp
+  802a9b:	c3                   	ret
+
+00802a9c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802a9c:	55                   	push   %ebp
+  802a9d:	89 e5                	mov    %esp,%ebp
+  802a9f:	53                   	push   %ebx
+  802aa0:	83 ec 0c             	sub    $0xc,%esp
+  802aa3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802aa6:	53                   	push   %ebx
+  802aa7:	6a 00                	push   $0x0
+  802aa9:	e8 2f e1 ff ff       	call   800bdd <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802aae:	89 1c 24             	mov    %ebx,(%esp)
+  802ab1:	e8 ab e4 ff ff       	call   800f61 <fd2data>
+  802ab6:	83 c4 08             	add    $0x8,%esp
+  802ab9:	50                   	push   %eax
+  802aba:	6a 00                	push   $0x0
+  802abc:	e8 1c e1 ff ff       	call   800bdd <sys_page_unmap>
+}
+  802ac1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ac4:	c9                   	leave
+  802ac5:	c3                   	ret
+
+00802ac6 <_pipeisclosed>:
+{
+  802ac6:	55                   	push   %ebp
+  802ac7:	89 e5                	mov    %esp,%ebp
+  802ac9:	57                   	push   %edi
+  802aca:	56                   	push   %esi
+  802acb:	53                   	push   %ebx
+  802acc:	83 ec 1c             	sub    $0x1c,%esp
+  802acf:	89 c7                	mov    %eax,%edi
+  802ad1:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802ad3:	a1 00 50 80 00       	mov    0x805000,%eax
+  802ad8:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802adb:	83 ec 0c             	sub    $0xc,%esp
+  802ade:	57                   	push   %edi
+  802adf:	e8 66 09 00 00       	call   80344a <pageref>
+  802ae4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ae7:	89 34 24             	mov    %esi,(%esp)
+  802aea:	e8 5b 09 00 00       	call   80344a <pageref>
+		nn = thisenv->env_runs;
+  802aef:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802af5:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802af8:	83 c4 10             	add    $0x10,%esp
+  802afb:	39 cb                	cmp    %ecx,%ebx
+  802afd:	74 1b                	je     802b1a <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802aff:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802b02:	75 cf                	jne    802ad3 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802b04:	8b 42 58             	mov    0x58(%edx),%eax
+  802b07:	6a 01                	push   $0x1
+  802b09:	50                   	push   %eax
+  802b0a:	53                   	push   %ebx
+  802b0b:	68 16 3c 80 00       	push   $0x803c16
+  802b10:	e8 41 d6 ff ff       	call   800156 <cprintf>
+  802b15:	83 c4 10             	add    $0x10,%esp
+  802b18:	eb b9                	jmp    802ad3 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802b1a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802b1d:	0f 94 c0             	sete   %al
+  802b20:	0f b6 c0             	movzbl %al,%eax
+}
+  802b23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b26:	5b                   	pop    %ebx
+  802b27:	5e                   	pop    %esi
+  802b28:	5f                   	pop    %edi
+  802b29:	5d                   	pop    %ebp
+  802b2a:	c3                   	ret
+
+00802b2b <devpipe_write>:
+{
+  802b2b:	55                   	push   %ebp
+  802b2c:	89 e5                	mov    %esp,%ebp
+  802b2e:	57                   	push   %edi
+  802b2f:	56                   	push   %esi
+  802b30:	53                   	push   %ebx
+  802b31:	83 ec 28             	sub    $0x28,%esp
+  802b34:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802b37:	56                   	push   %esi
+  802b38:	e8 24 e4 ff ff       	call   800f61 <fd2data>
+  802b3d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802b3f:	83 c4 10             	add    $0x10,%esp
+  802b42:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b47:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802b4a:	75 09                	jne    802b55 <devpipe_write+0x2a>
+	return i;
+  802b4c:	89 f8                	mov    %edi,%eax
+  802b4e:	eb 23                	jmp    802b73 <devpipe_write+0x48>
+			sys_yield();
+  802b50:	e8 dc df ff ff       	call   800b31 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802b55:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b58:	8b 0b                	mov    (%ebx),%ecx
+  802b5a:	8d 51 20             	lea    0x20(%ecx),%edx
+  802b5d:	39 d0                	cmp    %edx,%eax
+  802b5f:	72 1a                	jb     802b7b <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802b61:	89 da                	mov    %ebx,%edx
+  802b63:	89 f0                	mov    %esi,%eax
+  802b65:	e8 5c ff ff ff       	call   802ac6 <_pipeisclosed>
+  802b6a:	85 c0                	test   %eax,%eax
+  802b6c:	74 e2                	je     802b50 <devpipe_write+0x25>
+				return 0;
+  802b6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b76:	5b                   	pop    %ebx
+  802b77:	5e                   	pop    %esi
+  802b78:	5f                   	pop    %edi
+  802b79:	5d                   	pop    %ebp
+  802b7a:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802b7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b7e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802b82:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802b85:	89 c2                	mov    %eax,%edx
+  802b87:	c1 fa 1f             	sar    $0x1f,%edx
+  802b8a:	89 d1                	mov    %edx,%ecx
+  802b8c:	c1 e9 1b             	shr    $0x1b,%ecx
+  802b8f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802b92:	83 e2 1f             	and    $0x1f,%edx
+  802b95:	29 ca                	sub    %ecx,%edx
+  802b97:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802b9b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802b9f:	83 c0 01             	add    $0x1,%eax
+  802ba2:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802ba5:	83 c7 01             	add    $0x1,%edi
+  802ba8:	eb 9d                	jmp    802b47 <devpipe_write+0x1c>
+
+00802baa <devpipe_read>:
+{
+  802baa:	55                   	push   %ebp
+  802bab:	89 e5                	mov    %esp,%ebp
+  802bad:	57                   	push   %edi
+  802bae:	56                   	push   %esi
+  802baf:	53                   	push   %ebx
+  802bb0:	83 ec 18             	sub    $0x18,%esp
+  802bb3:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802bb6:	57                   	push   %edi
+  802bb7:	e8 a5 e3 ff ff       	call   800f61 <fd2data>
+  802bbc:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802bbe:	83 c4 10             	add    $0x10,%esp
+  802bc1:	be 00 00 00 00       	mov    $0x0,%esi
+  802bc6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802bc9:	75 13                	jne    802bde <devpipe_read+0x34>
+	return i;
+  802bcb:	89 f0                	mov    %esi,%eax
+  802bcd:	eb 02                	jmp    802bd1 <devpipe_read+0x27>
+				return i;
+  802bcf:	89 f0                	mov    %esi,%eax
+}
+  802bd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bd4:	5b                   	pop    %ebx
+  802bd5:	5e                   	pop    %esi
+  802bd6:	5f                   	pop    %edi
+  802bd7:	5d                   	pop    %ebp
+  802bd8:	c3                   	ret
+			sys_yield();
+  802bd9:	e8 53 df ff ff       	call   800b31 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802bde:	8b 03                	mov    (%ebx),%eax
+  802be0:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802be3:	75 18                	jne    802bfd <devpipe_read+0x53>
+			if (i > 0)
+  802be5:	85 f6                	test   %esi,%esi
+  802be7:	75 e6                	jne    802bcf <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802be9:	89 da                	mov    %ebx,%edx
+  802beb:	89 f8                	mov    %edi,%eax
+  802bed:	e8 d4 fe ff ff       	call   802ac6 <_pipeisclosed>
+  802bf2:	85 c0                	test   %eax,%eax
+  802bf4:	74 e3                	je     802bd9 <devpipe_read+0x2f>
+				return 0;
+  802bf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bfb:	eb d4                	jmp    802bd1 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802bfd:	99                   	cltd
+  802bfe:	c1 ea 1b             	shr    $0x1b,%edx
+  802c01:	01 d0                	add    %edx,%eax
+  802c03:	83 e0 1f             	and    $0x1f,%eax
+  802c06:	29 d0                	sub    %edx,%eax
+  802c08:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802c0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c10:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802c13:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802c16:	83 c6 01             	add    $0x1,%esi
+  802c19:	eb ab                	jmp    802bc6 <devpipe_read+0x1c>
+
+00802c1b <pipe>:
+{
+  802c1b:	55                   	push   %ebp
+  802c1c:	89 e5                	mov    %esp,%ebp
+  802c1e:	56                   	push   %esi
+  802c1f:	53                   	push   %ebx
+  802c20:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802c23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c26:	50                   	push   %eax
+  802c27:	e8 4c e3 ff ff       	call   800f78 <fd_alloc>
+  802c2c:	89 c3                	mov    %eax,%ebx
+  802c2e:	83 c4 10             	add    $0x10,%esp
+  802c31:	85 c0                	test   %eax,%eax
+  802c33:	0f 88 23 01 00 00    	js     802d5c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c39:	83 ec 04             	sub    $0x4,%esp
+  802c3c:	68 07 04 00 00       	push   $0x407
+  802c41:	ff 75 f4             	push   -0xc(%ebp)
+  802c44:	6a 00                	push   $0x0
+  802c46:	e8 05 df ff ff       	call   800b50 <sys_page_alloc>
+  802c4b:	89 c3                	mov    %eax,%ebx
+  802c4d:	83 c4 10             	add    $0x10,%esp
+  802c50:	85 c0                	test   %eax,%eax
+  802c52:	0f 88 04 01 00 00    	js     802d5c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802c58:	83 ec 0c             	sub    $0xc,%esp
+  802c5b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802c5e:	50                   	push   %eax
+  802c5f:	e8 14 e3 ff ff       	call   800f78 <fd_alloc>
+  802c64:	89 c3                	mov    %eax,%ebx
+  802c66:	83 c4 10             	add    $0x10,%esp
+  802c69:	85 c0                	test   %eax,%eax
+  802c6b:	0f 88 db 00 00 00    	js     802d4c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c71:	83 ec 04             	sub    $0x4,%esp
+  802c74:	68 07 04 00 00       	push   $0x407
+  802c79:	ff 75 f0             	push   -0x10(%ebp)
+  802c7c:	6a 00                	push   $0x0
+  802c7e:	e8 cd de ff ff       	call   800b50 <sys_page_alloc>
+  802c83:	89 c3                	mov    %eax,%ebx
+  802c85:	83 c4 10             	add    $0x10,%esp
+  802c88:	85 c0                	test   %eax,%eax
+  802c8a:	0f 88 bc 00 00 00    	js     802d4c <pipe+0x131>
+	va = fd2data(fd0);
+  802c90:	83 ec 0c             	sub    $0xc,%esp
+  802c93:	ff 75 f4             	push   -0xc(%ebp)
+  802c96:	e8 c6 e2 ff ff       	call   800f61 <fd2data>
+  802c9b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c9d:	83 c4 0c             	add    $0xc,%esp
+  802ca0:	68 07 04 00 00       	push   $0x407
+  802ca5:	50                   	push   %eax
+  802ca6:	6a 00                	push   $0x0
+  802ca8:	e8 a3 de ff ff       	call   800b50 <sys_page_alloc>
+  802cad:	89 c3                	mov    %eax,%ebx
+  802caf:	83 c4 10             	add    $0x10,%esp
+  802cb2:	85 c0                	test   %eax,%eax
+  802cb4:	0f 88 82 00 00 00    	js     802d3c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cba:	83 ec 0c             	sub    $0xc,%esp
+  802cbd:	ff 75 f0             	push   -0x10(%ebp)
+  802cc0:	e8 9c e2 ff ff       	call   800f61 <fd2data>
+  802cc5:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802ccc:	50                   	push   %eax
+  802ccd:	6a 00                	push   $0x0
+  802ccf:	56                   	push   %esi
+  802cd0:	6a 00                	push   $0x0
+  802cd2:	e8 c4 de ff ff       	call   800b9b <sys_page_map>
+  802cd7:	89 c3                	mov    %eax,%ebx
+  802cd9:	83 c4 20             	add    $0x20,%esp
+  802cdc:	85 c0                	test   %eax,%eax
+  802cde:	78 4e                	js     802d2e <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802ce0:	a1 60 40 80 00       	mov    0x804060,%eax
+  802ce5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802ce8:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802cea:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802ced:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802cf4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802cf7:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802cf9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802cfc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802d03:	83 ec 0c             	sub    $0xc,%esp
+  802d06:	ff 75 f4             	push   -0xc(%ebp)
+  802d09:	e8 43 e2 ff ff       	call   800f51 <fd2num>
+  802d0e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d11:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802d13:	83 c4 04             	add    $0x4,%esp
+  802d16:	ff 75 f0             	push   -0x10(%ebp)
+  802d19:	e8 33 e2 ff ff       	call   800f51 <fd2num>
+  802d1e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d21:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802d24:	83 c4 10             	add    $0x10,%esp
+  802d27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d2c:	eb 2e                	jmp    802d5c <pipe+0x141>
+	sys_page_unmap(0, va);
+  802d2e:	83 ec 08             	sub    $0x8,%esp
+  802d31:	56                   	push   %esi
+  802d32:	6a 00                	push   $0x0
+  802d34:	e8 a4 de ff ff       	call   800bdd <sys_page_unmap>
+  802d39:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802d3c:	83 ec 08             	sub    $0x8,%esp
+  802d3f:	ff 75 f0             	push   -0x10(%ebp)
+  802d42:	6a 00                	push   $0x0
+  802d44:	e8 94 de ff ff       	call   800bdd <sys_page_unmap>
+  802d49:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802d4c:	83 ec 08             	sub    $0x8,%esp
+  802d4f:	ff 75 f4             	push   -0xc(%ebp)
+  802d52:	6a 00                	push   $0x0
+  802d54:	e8 84 de ff ff       	call   800bdd <sys_page_unmap>
+  802d59:	83 c4 10             	add    $0x10,%esp
+}
+  802d5c:	89 d8                	mov    %ebx,%eax
+  802d5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d61:	5b                   	pop    %ebx
+  802d62:	5e                   	pop    %esi
+  802d63:	5d                   	pop    %ebp
+  802d64:	c3                   	ret
+
+00802d65 <pipeisclosed>:
+{
+  802d65:	55                   	push   %ebp
+  802d66:	89 e5                	mov    %esp,%ebp
+  802d68:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d6b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d6e:	50                   	push   %eax
+  802d6f:	ff 75 08             	push   0x8(%ebp)
+  802d72:	e8 57 e2 ff ff       	call   800fce <fd_lookup>
+  802d77:	83 c4 10             	add    $0x10,%esp
+  802d7a:	85 c0                	test   %eax,%eax
+  802d7c:	78 18                	js     802d96 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802d7e:	83 ec 0c             	sub    $0xc,%esp
+  802d81:	ff 75 f4             	push   -0xc(%ebp)
+  802d84:	e8 d8 e1 ff ff       	call   800f61 <fd2data>
+  802d89:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802d8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d8e:	e8 33 fd ff ff       	call   802ac6 <_pipeisclosed>
+  802d93:	83 c4 10             	add    $0x10,%esp
+}
+  802d96:	c9                   	leave
+  802d97:	c3                   	ret
+
+00802d98 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9d:	c3                   	ret
+
+00802d9e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d9e:	55                   	push   %ebp
+  802d9f:	89 e5                	mov    %esp,%ebp
+  802da1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802da4:	68 2e 3c 80 00       	push   $0x803c2e
+  802da9:	ff 75 0c             	push   0xc(%ebp)
+  802dac:	e8 93 d9 ff ff       	call   800744 <strcpy>
+	return 0;
+}
+  802db1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db6:	c9                   	leave
+  802db7:	c3                   	ret
+
+00802db8 <devcons_write>:
+{
+  802db8:	55                   	push   %ebp
+  802db9:	89 e5                	mov    %esp,%ebp
+  802dbb:	57                   	push   %edi
+  802dbc:	56                   	push   %esi
+  802dbd:	53                   	push   %ebx
+  802dbe:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802dc4:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802dc9:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802dcf:	eb 2e                	jmp    802dff <devcons_write+0x47>
+		m = n - tot;
+  802dd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dd4:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802dd6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802ddb:	39 c3                	cmp    %eax,%ebx
+  802ddd:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802de0:	83 ec 04             	sub    $0x4,%esp
+  802de3:	53                   	push   %ebx
+  802de4:	89 f0                	mov    %esi,%eax
+  802de6:	03 45 0c             	add    0xc(%ebp),%eax
+  802de9:	50                   	push   %eax
+  802dea:	57                   	push   %edi
+  802deb:	e8 da da ff ff       	call   8008ca <memmove>
+		sys_cputs(buf, m);
+  802df0:	83 c4 08             	add    $0x8,%esp
+  802df3:	53                   	push   %ebx
+  802df4:	57                   	push   %edi
+  802df5:	e8 7a dc ff ff       	call   800a74 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802dfa:	01 de                	add    %ebx,%esi
+  802dfc:	83 c4 10             	add    $0x10,%esp
+  802dff:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802e02:	72 cd                	jb     802dd1 <devcons_write+0x19>
+}
+  802e04:	89 f0                	mov    %esi,%eax
+  802e06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e09:	5b                   	pop    %ebx
+  802e0a:	5e                   	pop    %esi
+  802e0b:	5f                   	pop    %edi
+  802e0c:	5d                   	pop    %ebp
+  802e0d:	c3                   	ret
+
+00802e0e <devcons_read>:
+{
+  802e0e:	55                   	push   %ebp
+  802e0f:	89 e5                	mov    %esp,%ebp
+  802e11:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802e14:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e19:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e1d:	75 07                	jne    802e26 <devcons_read+0x18>
+  802e1f:	eb 1f                	jmp    802e40 <devcons_read+0x32>
+		sys_yield();
+  802e21:	e8 0b dd ff ff       	call   800b31 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802e26:	e8 6f dc ff ff       	call   800a9a <sys_cgetc>
+  802e2b:	85 c0                	test   %eax,%eax
+  802e2d:	74 f2                	je     802e21 <devcons_read+0x13>
+	if (c < 0)
+  802e2f:	78 0f                	js     802e40 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802e31:	83 f8 04             	cmp    $0x4,%eax
+  802e34:	74 0c                	je     802e42 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802e36:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802e39:	88 02                	mov    %al,(%edx)
+	return 1;
+  802e3b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802e40:	c9                   	leave
+  802e41:	c3                   	ret
+		return 0;
+  802e42:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e47:	eb f7                	jmp    802e40 <devcons_read+0x32>
+
+00802e49 <cputchar>:
+{
+  802e49:	55                   	push   %ebp
+  802e4a:	89 e5                	mov    %esp,%ebp
+  802e4c:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802e4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e52:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802e55:	6a 01                	push   $0x1
+  802e57:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e5a:	50                   	push   %eax
+  802e5b:	e8 14 dc ff ff       	call   800a74 <sys_cputs>
+}
+  802e60:	83 c4 10             	add    $0x10,%esp
+  802e63:	c9                   	leave
+  802e64:	c3                   	ret
+
+00802e65 <getchar>:
+{
+  802e65:	55                   	push   %ebp
+  802e66:	89 e5                	mov    %esp,%ebp
+  802e68:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802e6b:	6a 01                	push   $0x1
+  802e6d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e70:	50                   	push   %eax
+  802e71:	6a 00                	push   $0x0
+  802e73:	e8 bc e3 ff ff       	call   801234 <read>
+	if (r < 0)
+  802e78:	83 c4 10             	add    $0x10,%esp
+  802e7b:	85 c0                	test   %eax,%eax
+  802e7d:	78 06                	js     802e85 <getchar+0x20>
+	if (r < 1)
+  802e7f:	74 06                	je     802e87 <getchar+0x22>
+	return c;
+  802e81:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802e85:	c9                   	leave
+  802e86:	c3                   	ret
+		return -E_EOF;
+  802e87:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802e8c:	eb f7                	jmp    802e85 <getchar+0x20>
+
+00802e8e <iscons>:
+{
+  802e8e:	55                   	push   %ebp
+  802e8f:	89 e5                	mov    %esp,%ebp
+  802e91:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e97:	50                   	push   %eax
+  802e98:	ff 75 08             	push   0x8(%ebp)
+  802e9b:	e8 2e e1 ff ff       	call   800fce <fd_lookup>
+  802ea0:	83 c4 10             	add    $0x10,%esp
+  802ea3:	85 c0                	test   %eax,%eax
+  802ea5:	78 11                	js     802eb8 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802ea7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802eaa:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802eb0:	39 10                	cmp    %edx,(%eax)
+  802eb2:	0f 94 c0             	sete   %al
+  802eb5:	0f b6 c0             	movzbl %al,%eax
+}
+  802eb8:	c9                   	leave
+  802eb9:	c3                   	ret
+
+00802eba <opencons>:
+{
+  802eba:	55                   	push   %ebp
+  802ebb:	89 e5                	mov    %esp,%ebp
+  802ebd:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802ec0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ec3:	50                   	push   %eax
+  802ec4:	e8 af e0 ff ff       	call   800f78 <fd_alloc>
+  802ec9:	83 c4 10             	add    $0x10,%esp
+  802ecc:	85 c0                	test   %eax,%eax
+  802ece:	78 3a                	js     802f0a <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802ed0:	83 ec 04             	sub    $0x4,%esp
+  802ed3:	68 07 04 00 00       	push   $0x407
+  802ed8:	ff 75 f4             	push   -0xc(%ebp)
+  802edb:	6a 00                	push   $0x0
+  802edd:	e8 6e dc ff ff       	call   800b50 <sys_page_alloc>
+  802ee2:	83 c4 10             	add    $0x10,%esp
+  802ee5:	85 c0                	test   %eax,%eax
+  802ee7:	78 21                	js     802f0a <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802ee9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802eec:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802ef2:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802ef4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ef7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802efe:	83 ec 0c             	sub    $0xc,%esp
+  802f01:	50                   	push   %eax
+  802f02:	e8 4a e0 ff ff       	call   800f51 <fd2num>
+  802f07:	83 c4 10             	add    $0x10,%esp
+}
+  802f0a:	c9                   	leave
+  802f0b:	c3                   	ret
+
+00802f0c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802f0c:	55                   	push   %ebp
+  802f0d:	89 e5                	mov    %esp,%ebp
+  802f0f:	56                   	push   %esi
+  802f10:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802f11:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802f14:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802f1a:	e8 eb db ff ff       	call   800b0a <sys_getenvid>
+  802f1f:	83 ec 0c             	sub    $0xc,%esp
+  802f22:	ff 75 0c             	push   0xc(%ebp)
+  802f25:	ff 75 08             	push   0x8(%ebp)
+  802f28:	56                   	push   %esi
+  802f29:	50                   	push   %eax
+  802f2a:	68 3c 3c 80 00       	push   $0x803c3c
+  802f2f:	e8 22 d2 ff ff       	call   800156 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802f34:	83 c4 18             	add    $0x18,%esp
+  802f37:	53                   	push   %ebx
+  802f38:	ff 75 10             	push   0x10(%ebp)
+  802f3b:	e8 c5 d1 ff ff       	call   800105 <vcprintf>
+	cprintf("\n");
+  802f40:	c7 04 24 27 3c 80 00 	movl   $0x803c27,(%esp)
+  802f47:	e8 0a d2 ff ff       	call   800156 <cprintf>
+  802f4c:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802f4f:	cc                   	int3
+	while (1)
+  802f50:	eb fd                	jmp    802f4f <_panic+0x43>
+
+00802f52 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802f52:	55                   	push   %ebp
+  802f53:	89 e5                	mov    %esp,%ebp
+  802f55:	57                   	push   %edi
+  802f56:	56                   	push   %esi
+  802f57:	53                   	push   %ebx
+  802f58:	83 ec 20             	sub    $0x20,%esp
+  802f5b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f5e:	89 d7                	mov    %edx,%edi
+  802f60:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802f62:	51                   	push   %ecx
+  802f63:	68 00 f0 7f 00       	push   $0x7ff000
+  802f68:	6a 00                	push   $0x0
+  802f6a:	e8 e1 db ff ff       	call   800b50 <sys_page_alloc>
+  802f6f:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f71:	83 c4 10             	add    $0x10,%esp
+  802f74:	85 c0                	test   %eax,%eax
+  802f76:	78 45                	js     802fbd <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802f78:	83 ec 04             	sub    $0x4,%esp
+  802f7b:	68 00 10 00 00       	push   $0x1000
+  802f80:	57                   	push   %edi
+  802f81:	68 00 f0 7f 00       	push   $0x7ff000
+  802f86:	e8 3f d9 ff ff       	call   8008ca <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  802f8b:	89 34 24             	mov    %esi,(%esp)
+  802f8e:	57                   	push   %edi
+  802f8f:	ff 75 e4             	push   -0x1c(%ebp)
+  802f92:	68 00 f0 7f 00       	push   $0x7ff000
+  802f97:	6a 00                	push   $0x0
+  802f99:	e8 fd db ff ff       	call   800b9b <sys_page_map>
+  802f9e:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802fa0:	83 c4 20             	add    $0x20,%esp
+  802fa3:	85 c0                	test   %eax,%eax
+  802fa5:	78 16                	js     802fbd <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802fa7:	83 ec 08             	sub    $0x8,%esp
+  802faa:	68 00 f0 7f 00       	push   $0x7ff000
+  802faf:	6a 00                	push   $0x0
+  802fb1:	e8 27 dc ff ff       	call   800bdd <sys_page_unmap>
+  802fb6:	83 c4 10             	add    $0x10,%esp
+  802fb9:	85 c0                	test   %eax,%eax
+  802fbb:	75 0a                	jne    802fc7 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  802fbd:	89 d8                	mov    %ebx,%eax
+  802fbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fc2:	5b                   	pop    %ebx
+  802fc3:	5e                   	pop    %esi
+  802fc4:	5f                   	pop    %edi
+  802fc5:	5d                   	pop    %ebp
+  802fc6:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802fc7:	68 60 3c 80 00       	push   $0x803c60
+  802fcc:	68 80 3b 80 00       	push   $0x803b80
+  802fd1:	6a 1b                	push   $0x1b
+  802fd3:	68 d8 3c 80 00       	push   $0x803cd8
+  802fd8:	e8 2f ff ff ff       	call   802f0c <_panic>
+
+00802fdd <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802fdd:	55                   	push   %ebp
+  802fde:	89 e5                	mov    %esp,%ebp
+  802fe0:	53                   	push   %ebx
+  802fe1:	83 ec 04             	sub    $0x4,%esp
+  802fe4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  802fe7:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802fe9:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  802fed:	74 21                	je     803010 <pgfault+0x33>
+  802fef:	89 d0                	mov    %edx,%eax
+  802ff1:	c1 e8 16             	shr    $0x16,%eax
+  802ff4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802ffb:	a8 01                	test   $0x1,%al
+  802ffd:	74 11                	je     803010 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  802fff:	89 d0                	mov    %edx,%eax
+  803001:	c1 e8 0c             	shr    $0xc,%eax
+  803004:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80300b:	f6 c4 08             	test   $0x8,%ah
+  80300e:	75 17                	jne    803027 <pgfault+0x4a>
+		if (pgfault_next) {
+  803010:	a1 04 90 80 00       	mov    0x809004,%eax
+  803015:	85 c0                	test   %eax,%eax
+  803017:	74 27                	je     803040 <pgfault+0x63>
+			pgfault_next(utf);
+  803019:	83 ec 0c             	sub    $0xc,%esp
+  80301c:	53                   	push   %ebx
+  80301d:	ff d0                	call   *%eax
+			return;
+  80301f:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803022:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803025:	c9                   	leave
+  803026:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803027:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80302d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803032:	b8 00 00 00 00       	mov    $0x0,%eax
+  803037:	e8 16 ff ff ff       	call   802f52 <copy_page_to>
+  80303c:	85 c0                	test   %eax,%eax
+  80303e:	79 e2                	jns    803022 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803040:	a1 00 50 80 00       	mov    0x805000,%eax
+  803045:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803048:	ff 73 28             	push   0x28(%ebx)
+  80304b:	ff 33                	push   (%ebx)
+  80304d:	50                   	push   %eax
+  80304e:	68 84 3c 80 00       	push   $0x803c84
+  803053:	e8 fe d0 ff ff       	call   800156 <cprintf>
+	sys_env_destroy(0);
+  803058:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80305f:	e8 5d da ff ff       	call   800ac1 <sys_env_destroy>
+  803064:	83 c4 10             	add    $0x10,%esp
+  803067:	eb b9                	jmp    803022 <pgfault+0x45>
+
+00803069 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803069:	55                   	push   %ebp
+  80306a:	89 e5                	mov    %esp,%ebp
+  80306c:	53                   	push   %ebx
+  80306d:	83 ec 04             	sub    $0x4,%esp
+  803070:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803073:	a1 08 90 80 00       	mov    0x809008,%eax
+  803078:	3d dd 2f 80 00       	cmp    $0x802fdd,%eax
+  80307d:	74 15                	je     803094 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80307f:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  803084:	83 ec 0c             	sub    $0xc,%esp
+  803087:	68 dd 2f 80 00       	push   $0x802fdd
+  80308c:	e8 fb 03 00 00       	call   80348c <set_pgfault_handler>
+  803091:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803094:	83 ec 0c             	sub    $0xc,%esp
+  803097:	68 05 08 00 00       	push   $0x805
+  80309c:	53                   	push   %ebx
+  80309d:	6a 00                	push   $0x0
+  80309f:	53                   	push   %ebx
+  8030a0:	6a 00                	push   $0x0
+  8030a2:	e8 f4 da ff ff       	call   800b9b <sys_page_map>
+}
+  8030a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030aa:	c9                   	leave
+  8030ab:	c3                   	ret
+
+008030ac <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8030ac:	55                   	push   %ebp
+  8030ad:	89 e5                	mov    %esp,%ebp
+  8030af:	57                   	push   %edi
+  8030b0:	56                   	push   %esi
+  8030b1:	53                   	push   %ebx
+  8030b2:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8030b5:	68 dd 2f 80 00       	push   $0x802fdd
+  8030ba:	e8 cd 03 00 00       	call   80348c <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8030bf:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030c4:	cd 30                	int    $0x30
+  8030c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030c9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8030cc:	83 c4 10             	add    $0x10,%esp
+  8030cf:	85 c0                	test   %eax,%eax
+  8030d1:	0f 88 6b 01 00 00    	js     803242 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8030dc:	75 37                	jne    803115 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8030de:	e8 27 da ff ff       	call   800b0a <sys_getenvid>
+  8030e3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030e8:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8030ee:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8030f3:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8030f8:	e9 45 01 00 00       	jmp    803242 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8030fd:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803103:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803109:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80310f:	0f 87 ba 00 00 00    	ja     8031cf <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803115:	89 d8                	mov    %ebx,%eax
+  803117:	c1 e8 16             	shr    $0x16,%eax
+  80311a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803121:	a8 01                	test   $0x1,%al
+  803123:	74 d8                	je     8030fd <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803125:	89 d8                	mov    %ebx,%eax
+  803127:	c1 e8 0c             	shr    $0xc,%eax
+  80312a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803131:	f6 c2 01             	test   $0x1,%dl
+  803134:	74 cd                	je     803103 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803136:	89 da                	mov    %ebx,%edx
+  803138:	80 e6 df             	and    $0xdf,%dh
+  80313b:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803141:	74 c0                	je     803103 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803143:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803145:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80314c:	f6 c6 04             	test   $0x4,%dh
+  80314f:	75 53                	jne    8031a4 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803151:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803158:	f6 c6 08             	test   $0x8,%dh
+  80315b:	75 0c                	jne    803169 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80315d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803164:	f6 c2 02             	test   $0x2,%dl
+  803167:	74 3b                	je     8031a4 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803169:	83 ec 0c             	sub    $0xc,%esp
+  80316c:	68 05 08 00 00       	push   $0x805
+  803171:	57                   	push   %edi
+  803172:	ff 75 e4             	push   -0x1c(%ebp)
+  803175:	57                   	push   %edi
+  803176:	6a 00                	push   $0x0
+  803178:	e8 1e da ff ff       	call   800b9b <sys_page_map>
+  80317d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80317f:	83 c4 20             	add    $0x20,%esp
+  803182:	85 c0                	test   %eax,%eax
+  803184:	0f 88 a7 00 00 00    	js     803231 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80318a:	83 ec 0c             	sub    $0xc,%esp
+  80318d:	68 05 08 00 00       	push   $0x805
+  803192:	57                   	push   %edi
+  803193:	6a 00                	push   $0x0
+  803195:	57                   	push   %edi
+  803196:	6a 00                	push   $0x0
+  803198:	e8 fe d9 ff ff       	call   800b9b <sys_page_map>
+  80319d:	89 c6                	mov    %eax,%esi
+	return r;
+  80319f:	83 c4 20             	add    $0x20,%esp
+  8031a2:	eb 21                	jmp    8031c5 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8031a4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8031ab:	83 ec 0c             	sub    $0xc,%esp
+  8031ae:	25 07 0e 00 00       	and    $0xe07,%eax
+  8031b3:	50                   	push   %eax
+  8031b4:	57                   	push   %edi
+  8031b5:	ff 75 e4             	push   -0x1c(%ebp)
+  8031b8:	57                   	push   %edi
+  8031b9:	6a 00                	push   $0x0
+  8031bb:	e8 db d9 ff ff       	call   800b9b <sys_page_map>
+  8031c0:	89 c6                	mov    %eax,%esi
+  8031c2:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8031c5:	85 f6                	test   %esi,%esi
+  8031c7:	0f 89 36 ff ff ff    	jns    803103 <fork+0x57>
+  8031cd:	eb 62                	jmp    803231 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031cf:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031d4:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8031d9:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8031dc:	89 f8                	mov    %edi,%eax
+  8031de:	e8 6f fd ff ff       	call   802f52 <copy_page_to>
+  8031e3:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031e5:	85 c0                	test   %eax,%eax
+  8031e7:	78 48                	js     803231 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031e9:	83 ec 04             	sub    $0x4,%esp
+  8031ec:	6a 07                	push   $0x7
+  8031ee:	68 00 f0 bf ee       	push   $0xeebff000
+  8031f3:	57                   	push   %edi
+  8031f4:	e8 57 d9 ff ff       	call   800b50 <sys_page_alloc>
+  8031f9:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031fb:	83 c4 10             	add    $0x10,%esp
+  8031fe:	85 c0                	test   %eax,%eax
+  803200:	78 2f                	js     803231 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803202:	a1 00 50 80 00       	mov    0x805000,%eax
+  803207:	8b 40 64             	mov    0x64(%eax),%eax
+  80320a:	83 ec 08             	sub    $0x8,%esp
+  80320d:	50                   	push   %eax
+  80320e:	57                   	push   %edi
+  80320f:	e8 a7 da ff ff       	call   800cbb <sys_env_set_pgfault_upcall>
+  803214:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803216:	83 c4 10             	add    $0x10,%esp
+  803219:	85 c0                	test   %eax,%eax
+  80321b:	78 14                	js     803231 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80321d:	83 ec 08             	sub    $0x8,%esp
+  803220:	6a 02                	push   $0x2
+  803222:	57                   	push   %edi
+  803223:	e8 ff d9 ff ff       	call   800c27 <sys_env_set_status>
+  803228:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80322a:	83 c4 10             	add    $0x10,%esp
+  80322d:	85 c0                	test   %eax,%eax
+  80322f:	79 11                	jns    803242 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803231:	83 ec 0c             	sub    $0xc,%esp
+  803234:	ff 75 e0             	push   -0x20(%ebp)
+  803237:	e8 85 d8 ff ff       	call   800ac1 <sys_env_destroy>
+	return r;
+  80323c:	83 c4 10             	add    $0x10,%esp
+  80323f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803242:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803245:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803248:	5b                   	pop    %ebx
+  803249:	5e                   	pop    %esi
+  80324a:	5f                   	pop    %edi
+  80324b:	5d                   	pop    %ebp
+  80324c:	c3                   	ret
+
+0080324d <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80324d:	55                   	push   %ebp
+  80324e:	89 e5                	mov    %esp,%ebp
+  803250:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803253:	68 e3 3c 80 00       	push   $0x803ce3
+  803258:	68 bf 00 00 00       	push   $0xbf
+  80325d:	68 d8 3c 80 00       	push   $0x803cd8
+  803262:	e8 a5 fc ff ff       	call   802f0c <_panic>
+
+00803267 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803267:	55                   	push   %ebp
+  803268:	89 e5                	mov    %esp,%ebp
+  80326a:	56                   	push   %esi
+  80326b:	53                   	push   %ebx
+  80326c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80326f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803272:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803275:	85 c0                	test   %eax,%eax
+  803277:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80327c:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80327f:	83 ec 0c             	sub    $0xc,%esp
+  803282:	50                   	push   %eax
+  803283:	e8 10 db ff ff       	call   800d98 <sys_ipc_recv>
+	if (from_env_store)
+  803288:	83 c4 10             	add    $0x10,%esp
+  80328b:	85 f6                	test   %esi,%esi
+  80328d:	74 14                	je     8032a3 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80328f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803294:	85 c0                	test   %eax,%eax
+  803296:	75 09                	jne    8032a1 <ipc_recv+0x3a>
+  803298:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80329e:	8b 52 74             	mov    0x74(%edx),%edx
+  8032a1:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8032a3:	85 db                	test   %ebx,%ebx
+  8032a5:	74 25                	je     8032cc <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8032a7:	85 c0                	test   %eax,%eax
+  8032a9:	74 0d                	je     8032b8 <ipc_recv+0x51>
+  8032ab:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8032b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032b4:	5b                   	pop    %ebx
+  8032b5:	5e                   	pop    %esi
+  8032b6:	5d                   	pop    %ebp
+  8032b7:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8032b8:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032bd:	8b 40 78             	mov    0x78(%eax),%eax
+  8032c0:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8032c2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032c7:	8b 40 70             	mov    0x70(%eax),%eax
+  8032ca:	eb e5                	jmp    8032b1 <ipc_recv+0x4a>
+  8032cc:	85 c0                	test   %eax,%eax
+  8032ce:	75 e1                	jne    8032b1 <ipc_recv+0x4a>
+  8032d0:	eb f0                	jmp    8032c2 <ipc_recv+0x5b>
+
+008032d2 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8032d2:	55                   	push   %ebp
+  8032d3:	89 e5                	mov    %esp,%ebp
+  8032d5:	57                   	push   %edi
+  8032d6:	56                   	push   %esi
+  8032d7:	53                   	push   %ebx
+  8032d8:	83 ec 0c             	sub    $0xc,%esp
+  8032db:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032de:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032e4:	85 db                	test   %ebx,%ebx
+  8032e6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032eb:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8032ee:	ff 75 14             	push   0x14(%ebp)
+  8032f1:	53                   	push   %ebx
+  8032f2:	56                   	push   %esi
+  8032f3:	57                   	push   %edi
+  8032f4:	e8 0c da ff ff       	call   800d05 <sys_ipc_try_send>
+  8032f9:	83 c4 10             	add    $0x10,%esp
+  8032fc:	85 c0                	test   %eax,%eax
+  8032fe:	74 22                	je     803322 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803300:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803303:	75 07                	jne    80330c <ipc_send+0x3a>
+		sys_yield();
+  803305:	e8 27 d8 ff ff       	call   800b31 <sys_yield>
+  80330a:	eb e2                	jmp    8032ee <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80330c:	68 f9 3c 80 00       	push   $0x803cf9
+  803311:	68 80 3b 80 00       	push   $0x803b80
+  803316:	6a 39                	push   $0x39
+  803318:	68 0e 3d 80 00       	push   $0x803d0e
+  80331d:	e8 ea fb ff ff       	call   802f0c <_panic>
+	}
+}
+  803322:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803325:	5b                   	pop    %ebx
+  803326:	5e                   	pop    %esi
+  803327:	5f                   	pop    %edi
+  803328:	5d                   	pop    %ebp
+  803329:	c3                   	ret
+
+0080332a <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80332a:	55                   	push   %ebp
+  80332b:	89 e5                	mov    %esp,%ebp
+  80332d:	57                   	push   %edi
+  80332e:	56                   	push   %esi
+  80332f:	53                   	push   %ebx
+  803330:	83 ec 10             	sub    $0x10,%esp
+  803333:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803336:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803339:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80333c:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80333f:	85 c0                	test   %eax,%eax
+  803341:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803346:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803349:	6a 00                	push   $0x0
+  80334b:	ff 33                	push   (%ebx)
+  80334d:	50                   	push   %eax
+  80334e:	e8 02 da ff ff       	call   800d55 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803353:	83 c4 10             	add    $0x10,%esp
+  803356:	85 c0                	test   %eax,%eax
+  803358:	75 3c                	jne    803396 <ipc_recvv+0x6c>
+  80335a:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803360:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803363:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803365:	85 ff                	test   %edi,%edi
+  803367:	74 4e                	je     8033b7 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803369:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80336f:	8b 52 74             	mov    0x74(%edx),%edx
+  803372:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803374:	85 f6                	test   %esi,%esi
+  803376:	74 18                	je     803390 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803378:	85 c0                	test   %eax,%eax
+  80337a:	75 2d                	jne    8033a9 <ipc_recvv+0x7f>
+  80337c:	a1 00 50 80 00       	mov    0x805000,%eax
+  803381:	8b 40 78             	mov    0x78(%eax),%eax
+  803384:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803386:	a1 00 50 80 00       	mov    0x805000,%eax
+  80338b:	8b 40 70             	mov    0x70(%eax),%eax
+  80338e:	eb 1f                	jmp    8033af <ipc_recvv+0x85>
+  803390:	85 c0                	test   %eax,%eax
+  803392:	75 1b                	jne    8033af <ipc_recvv+0x85>
+  803394:	eb f0                	jmp    803386 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803396:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80339c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8033a1:	85 ff                	test   %edi,%edi
+  8033a3:	75 cd                	jne    803372 <ipc_recvv+0x48>
+	if (perm_store)
+  8033a5:	85 f6                	test   %esi,%esi
+  8033a7:	74 e7                	je     803390 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033a9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8033af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033b2:	5b                   	pop    %ebx
+  8033b3:	5e                   	pop    %esi
+  8033b4:	5f                   	pop    %edi
+  8033b5:	5d                   	pop    %ebp
+  8033b6:	c3                   	ret
+	if (perm_store)
+  8033b7:	85 f6                	test   %esi,%esi
+  8033b9:	75 bd                	jne    803378 <ipc_recvv+0x4e>
+  8033bb:	eb c9                	jmp    803386 <ipc_recvv+0x5c>
+
+008033bd <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8033bd:	55                   	push   %ebp
+  8033be:	89 e5                	mov    %esp,%ebp
+  8033c0:	57                   	push   %edi
+  8033c1:	56                   	push   %esi
+  8033c2:	53                   	push   %ebx
+  8033c3:	83 ec 0c             	sub    $0xc,%esp
+  8033c6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8033cf:	ff 75 14             	push   0x14(%ebp)
+  8033d2:	53                   	push   %ebx
+  8033d3:	56                   	push   %esi
+  8033d4:	57                   	push   %edi
+  8033d5:	e8 53 d9 ff ff       	call   800d2d <sys_ipc_try_sendv>
+  8033da:	83 c4 10             	add    $0x10,%esp
+  8033dd:	85 c0                	test   %eax,%eax
+  8033df:	74 22                	je     803403 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8033e1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033e4:	75 07                	jne    8033ed <ipc_sendv+0x30>
+		sys_yield();
+  8033e6:	e8 46 d7 ff ff       	call   800b31 <sys_yield>
+  8033eb:	eb e2                	jmp    8033cf <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8033ed:	68 f9 3c 80 00       	push   $0x803cf9
+  8033f2:	68 80 3b 80 00       	push   $0x803b80
+  8033f7:	6a 5c                	push   $0x5c
+  8033f9:	68 0e 3d 80 00       	push   $0x803d0e
+  8033fe:	e8 09 fb ff ff       	call   802f0c <_panic>
+	}
+}
+  803403:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803406:	5b                   	pop    %ebx
+  803407:	5e                   	pop    %esi
+  803408:	5f                   	pop    %edi
+  803409:	5d                   	pop    %ebp
+  80340a:	c3                   	ret
+
+0080340b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80340b:	55                   	push   %ebp
+  80340c:	89 e5                	mov    %esp,%ebp
+  80340e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803411:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803416:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80341c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803422:	8b 52 50             	mov    0x50(%edx),%edx
+  803425:	39 ca                	cmp    %ecx,%edx
+  803427:	74 11                	je     80343a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803429:	83 c0 01             	add    $0x1,%eax
+  80342c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803431:	75 e3                	jne    803416 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803433:	b8 00 00 00 00       	mov    $0x0,%eax
+  803438:	eb 0e                	jmp    803448 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80343a:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803440:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803445:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803448:	5d                   	pop    %ebp
+  803449:	c3                   	ret
+
+0080344a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80344a:	55                   	push   %ebp
+  80344b:	89 e5                	mov    %esp,%ebp
+  80344d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803450:	89 c2                	mov    %eax,%edx
+  803452:	c1 ea 16             	shr    $0x16,%edx
+  803455:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80345c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803461:	f6 c1 01             	test   $0x1,%cl
+  803464:	74 22                	je     803488 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803466:	c1 e8 0c             	shr    $0xc,%eax
+  803469:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803470:	a8 01                	test   $0x1,%al
+  803472:	74 14                	je     803488 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803474:	c1 e8 0c             	shr    $0xc,%eax
+  803477:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80347a:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803481:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803485:	0f b7 d2             	movzwl %dx,%edx
+}
+  803488:	89 d0                	mov    %edx,%eax
+  80348a:	5d                   	pop    %ebp
+  80348b:	c3                   	ret
+
+0080348c <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80348c:	55                   	push   %ebp
+  80348d:	89 e5                	mov    %esp,%ebp
+  80348f:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803492:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  803499:	74 0a                	je     8034a5 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80349b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80349e:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  8034a3:	c9                   	leave
+  8034a4:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034a5:	83 ec 04             	sub    $0x4,%esp
+  8034a8:	6a 07                	push   $0x7
+  8034aa:	68 00 f0 bf ee       	push   $0xeebff000
+  8034af:	6a 00                	push   $0x0
+  8034b1:	e8 9a d6 ff ff       	call   800b50 <sys_page_alloc>
+  8034b6:	83 c4 10             	add    $0x10,%esp
+  8034b9:	85 c0                	test   %eax,%eax
+  8034bb:	75 2c                	jne    8034e9 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8034bd:	83 ec 08             	sub    $0x8,%esp
+  8034c0:	68 ff 34 80 00       	push   $0x8034ff
+  8034c5:	6a 00                	push   $0x0
+  8034c7:	e8 ef d7 ff ff       	call   800cbb <sys_env_set_pgfault_upcall>
+  8034cc:	83 c4 10             	add    $0x10,%esp
+  8034cf:	85 c0                	test   %eax,%eax
+  8034d1:	74 c8                	je     80349b <set_pgfault_handler+0xf>
+  8034d3:	68 60 3d 80 00       	push   $0x803d60
+  8034d8:	68 80 3b 80 00       	push   $0x803b80
+  8034dd:	6a 20                	push   $0x20
+  8034df:	68 90 3d 80 00       	push   $0x803d90
+  8034e4:	e8 23 fa ff ff       	call   802f0c <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034e9:	68 18 3d 80 00       	push   $0x803d18
+  8034ee:	68 80 3b 80 00       	push   $0x803b80
+  8034f3:	6a 1e                	push   $0x1e
+  8034f5:	68 90 3d 80 00       	push   $0x803d90
+  8034fa:	e8 0d fa ff ff       	call   802f0c <_panic>
+
+008034ff <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8034ff:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803500:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  803505:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803507:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80350a:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  80350f:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803514:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803518:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80351b:	83 c4 08             	add    $0x8,%esp
+	popal
+  80351e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  80351f:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803522:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803523:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803524:	c3                   	ret
+
+00803525 <dm>:
+  803525:	55                   	push   %ebp
+  803526:	57                   	push   %edi
+  803527:	56                   	push   %esi
+  803528:	53                   	push   %ebx
+  803529:	83 ec 24             	sub    $0x24,%esp
+  80352c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803530:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803534:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803538:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80353c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803540:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803544:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803548:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80354d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803552:	ba 00 00 00 00       	mov    $0x0,%edx
+  803557:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80355e:	00 
+  80355f:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803566:	00 
+  803567:	89 fb                	mov    %edi,%ebx
+  803569:	eb 08                	jmp    803573 <dm+0x4e>
+  80356b:	83 e9 01             	sub    $0x1,%ecx
+  80356e:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803571:	74 68                	je     8035db <dm+0xb6>
+  803573:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803577:	01 c0                	add    %eax,%eax
+  803579:	89 c6                	mov    %eax,%esi
+  80357b:	89 d7                	mov    %edx,%edi
+  80357d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803581:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803585:	0f ad d0             	shrd   %cl,%edx,%eax
+  803588:	d3 ea                	shr    %cl,%edx
+  80358a:	f6 c1 20             	test   $0x20,%cl
+  80358d:	74 04                	je     803593 <dm+0x6e>
+  80358f:	89 d0                	mov    %edx,%eax
+  803591:	31 d2                	xor    %edx,%edx
+  803593:	83 e0 01             	and    $0x1,%eax
+  803596:	89 04 24             	mov    %eax,(%esp)
+  803599:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8035a0:	00 
+  8035a1:	8b 04 24             	mov    (%esp),%eax
+  8035a4:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8035a8:	09 f0                	or     %esi,%eax
+  8035aa:	09 fa                	or     %edi,%edx
+  8035ac:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8035b0:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8035b4:	39 f0                	cmp    %esi,%eax
+  8035b6:	89 d5                	mov    %edx,%ebp
+  8035b8:	19 fd                	sbb    %edi,%ebp
+  8035ba:	72 af                	jb     80356b <dm+0x46>
+  8035bc:	29 f0                	sub    %esi,%eax
+  8035be:	19 fa                	sbb    %edi,%edx
+  8035c0:	89 cf                	mov    %ecx,%edi
+  8035c2:	c1 ef 05             	shr    $0x5,%edi
+  8035c5:	83 e7 01             	and    $0x1,%edi
+  8035c8:	89 fe                	mov    %edi,%esi
+  8035ca:	83 f6 01             	xor    $0x1,%esi
+  8035cd:	d3 e6                	shl    %cl,%esi
+  8035cf:	d3 e7                	shl    %cl,%edi
+  8035d1:	09 74 24 18          	or     %esi,0x18(%esp)
+  8035d5:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8035d9:	eb 90                	jmp    80356b <dm+0x46>
+  8035db:	85 db                	test   %ebx,%ebx
+  8035dd:	74 05                	je     8035e4 <dm+0xbf>
+  8035df:	89 03                	mov    %eax,(%ebx)
+  8035e1:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035e4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035e8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035ec:	83 c4 24             	add    $0x24,%esp
+  8035ef:	5b                   	pop    %ebx
+  8035f0:	5e                   	pop    %esi
+  8035f1:	5f                   	pop    %edi
+  8035f2:	5d                   	pop    %ebp
+  8035f3:	c3                   	ret
+
+008035f4 <__udivdi3>:
+  8035f4:	83 ec 08             	sub    $0x8,%esp
+  8035f7:	6a 00                	push   $0x0
+  8035f9:	ff 74 24 1c          	push   0x1c(%esp)
+  8035fd:	ff 74 24 1c          	push   0x1c(%esp)
+  803601:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803605:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803609:	e8 17 ff ff ff       	call   803525 <dm>
+  80360e:	83 c4 14             	add    $0x14,%esp
+  803611:	c3                   	ret
+
+00803612 <__umoddi3>:
+  803612:	83 ec 18             	sub    $0x18,%esp
+  803615:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803619:	50                   	push   %eax
+  80361a:	ff 74 24 2c          	push   0x2c(%esp)
+  80361e:	ff 74 24 2c          	push   0x2c(%esp)
+  803622:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803626:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80362a:	e8 f6 fe ff ff       	call   803525 <dm>
+  80362f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803633:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803637:	83 c4 24             	add    $0x24,%esp
+  80363a:	c3                   	ret
+
+0080363b <__divdi3>:
+  80363b:	53                   	push   %ebx
+  80363c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803640:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803644:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803648:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80364c:	85 d2                	test   %edx,%edx
+  80364e:	78 15                	js     803665 <__divdi3+0x2a>
+  803650:	85 db                	test   %ebx,%ebx
+  803652:	78 34                	js     803688 <__divdi3+0x4d>
+  803654:	83 ec 04             	sub    $0x4,%esp
+  803657:	6a 00                	push   $0x0
+  803659:	53                   	push   %ebx
+  80365a:	51                   	push   %ecx
+  80365b:	e8 c5 fe ff ff       	call   803525 <dm>
+  803660:	83 c4 10             	add    $0x10,%esp
+  803663:	eb 21                	jmp    803686 <__divdi3+0x4b>
+  803665:	f7 d8                	neg    %eax
+  803667:	83 d2 00             	adc    $0x0,%edx
+  80366a:	f7 da                	neg    %edx
+  80366c:	85 db                	test   %ebx,%ebx
+  80366e:	78 30                	js     8036a0 <__divdi3+0x65>
+  803670:	83 ec 04             	sub    $0x4,%esp
+  803673:	6a 00                	push   $0x0
+  803675:	53                   	push   %ebx
+  803676:	51                   	push   %ecx
+  803677:	e8 a9 fe ff ff       	call   803525 <dm>
+  80367c:	83 c4 10             	add    $0x10,%esp
+  80367f:	f7 d8                	neg    %eax
+  803681:	83 d2 00             	adc    $0x0,%edx
+  803684:	f7 da                	neg    %edx
+  803686:	5b                   	pop    %ebx
+  803687:	c3                   	ret
+  803688:	83 ec 04             	sub    $0x4,%esp
+  80368b:	6a 00                	push   $0x0
+  80368d:	f7 d9                	neg    %ecx
+  80368f:	83 d3 00             	adc    $0x0,%ebx
+  803692:	f7 db                	neg    %ebx
+  803694:	53                   	push   %ebx
+  803695:	51                   	push   %ecx
+  803696:	e8 8a fe ff ff       	call   803525 <dm>
+  80369b:	83 c4 10             	add    $0x10,%esp
+  80369e:	eb df                	jmp    80367f <__divdi3+0x44>
+  8036a0:	83 ec 04             	sub    $0x4,%esp
+  8036a3:	6a 00                	push   $0x0
+  8036a5:	f7 d9                	neg    %ecx
+  8036a7:	83 d3 00             	adc    $0x0,%ebx
+  8036aa:	f7 db                	neg    %ebx
+  8036ac:	53                   	push   %ebx
+  8036ad:	51                   	push   %ecx
+  8036ae:	e8 72 fe ff ff       	call   803525 <dm>
+  8036b3:	83 c4 10             	add    $0x10,%esp
+  8036b6:	eb ce                	jmp    803686 <__divdi3+0x4b>
+
+008036b8 <__moddi3>:
+  8036b8:	55                   	push   %ebp
+  8036b9:	57                   	push   %edi
+  8036ba:	56                   	push   %esi
+  8036bb:	53                   	push   %ebx
+  8036bc:	83 ec 24             	sub    $0x24,%esp
+  8036bf:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036c3:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036c7:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036cb:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036cf:	85 d2                	test   %edx,%edx
+  8036d1:	78 3b                	js     80370e <__moddi3+0x56>
+  8036d3:	83 ec 04             	sub    $0x4,%esp
+  8036d6:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036da:	56                   	push   %esi
+  8036db:	89 ce                	mov    %ecx,%esi
+  8036dd:	f7 de                	neg    %esi
+  8036df:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8036e3:	89 de                	mov    %ebx,%esi
+  8036e5:	83 d6 00             	adc    $0x0,%esi
+  8036e8:	f7 de                	neg    %esi
+  8036ea:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8036ee:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8036f2:	0f 48 f1             	cmovs  %ecx,%esi
+  8036f5:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8036fa:	53                   	push   %ebx
+  8036fb:	56                   	push   %esi
+  8036fc:	e8 24 fe ff ff       	call   803525 <dm>
+  803701:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803705:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803709:	83 c4 10             	add    $0x10,%esp
+  80370c:	eb 47                	jmp    803755 <__moddi3+0x9d>
+  80370e:	f7 d8                	neg    %eax
+  803710:	83 d2 00             	adc    $0x0,%edx
+  803713:	f7 da                	neg    %edx
+  803715:	83 ec 04             	sub    $0x4,%esp
+  803718:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80371c:	56                   	push   %esi
+  80371d:	89 cf                	mov    %ecx,%edi
+  80371f:	f7 df                	neg    %edi
+  803721:	89 de                	mov    %ebx,%esi
+  803723:	83 d6 00             	adc    $0x0,%esi
+  803726:	f7 de                	neg    %esi
+  803728:	0f 49 cf             	cmovns %edi,%ecx
+  80372b:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80372f:	0f 49 de             	cmovns %esi,%ebx
+  803732:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803736:	ff 74 24 0c          	push   0xc(%esp)
+  80373a:	ff 74 24 0c          	push   0xc(%esp)
+  80373e:	e8 e2 fd ff ff       	call   803525 <dm>
+  803743:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803747:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80374b:	f7 d8                	neg    %eax
+  80374d:	83 d2 00             	adc    $0x0,%edx
+  803750:	f7 da                	neg    %edx
+  803752:	83 c4 10             	add    $0x10,%esp
+  803755:	83 c4 24             	add    $0x24,%esp
+  803758:	5b                   	pop    %ebx
+  803759:	5e                   	pop    %esi
+  80375a:	5f                   	pop    %edi
+  80375b:	5d                   	pop    %ebp
+  80375c:	c3                   	ret
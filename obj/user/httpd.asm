@@ -0,0 +1,8865 @@
+
+obj/user/httpd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 08 00 00       	call   800854 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+	{404, "Not Found"},
+};
+
+static void
+die(char *m)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 e0 41 80 00       	push   $0x8041e0
+  80003f:	e8 4e 09 00 00       	call   800992 <cprintf>
+	exit();
+  800044:	e8 54 08 00 00       	call   80089d <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <send_error>:
+	return 0;
+}
+
+static int
+send_error(struct http_request *req, int code)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	81 ec 0c 02 00 00    	sub    $0x20c,%esp
+  80005a:	89 c3                	mov    %eax,%ebx
+	char buf[512];
+	int r;
+
+	struct error_messages *e = errors;
+  80005c:	b8 00 50 80 00       	mov    $0x805000,%eax
+	while (e->code != 0 && e->msg != 0) {
+  800061:	8b 08                	mov    (%eax),%ecx
+  800063:	85 c9                	test   %ecx,%ecx
+  800065:	74 0f                	je     800076 <send_error+0x28>
+		if (e->code == code)
+  800067:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+  80006b:	74 10                	je     80007d <send_error+0x2f>
+  80006d:	39 d1                	cmp    %edx,%ecx
+  80006f:	74 0c                	je     80007d <send_error+0x2f>
+			break;
+		e++;
+  800071:	83 c0 08             	add    $0x8,%eax
+  800074:	eb eb                	jmp    800061 <send_error+0x13>
+	}
+
+	if (e->code == 0)
+		return -1;
+  800076:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80007b:	eb 3b                	jmp    8000b8 <send_error+0x6a>
+
+	r = snprintf(buf, 512, "HTTP/" HTTP_VERSION" %d %s\r\n"
+  80007d:	8b 40 04             	mov    0x4(%eax),%eax
+  800080:	83 ec 04             	sub    $0x4,%esp
+  800083:	50                   	push   %eax
+  800084:	51                   	push   %ecx
+  800085:	50                   	push   %eax
+  800086:	51                   	push   %ecx
+  800087:	68 9c 42 80 00       	push   $0x80429c
+  80008c:	68 00 02 00 00       	push   $0x200
+  800091:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+  800097:	57                   	push   %edi
+  800098:	e8 8e 0e 00 00       	call   800f2b <snprintf>
+  80009d:	89 c6                	mov    %eax,%esi
+			       "Content-type: text/html\r\n"
+			       "\r\n"
+			       "<html><body><p>%d - %s</p></body></html>\r\n",
+			       e->code, e->msg, e->code, e->msg);
+
+	if (write(req->sock, buf, r) != r)
+  80009f:	83 c4 1c             	add    $0x1c,%esp
+  8000a2:	50                   	push   %eax
+  8000a3:	57                   	push   %edi
+  8000a4:	ff 33                	push   (%ebx)
+  8000a6:	e8 93 1a 00 00       	call   801b3e <write>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	39 f0                	cmp    %esi,%eax
+  8000b0:	0f 95 c0             	setne  %al
+  8000b3:	0f b6 c0             	movzbl %al,%eax
+  8000b6:	f7 d8                	neg    %eax
+		return -1;
+
+	return 0;
+}
+  8000b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000bb:	5b                   	pop    %ebx
+  8000bc:	5e                   	pop    %esi
+  8000bd:	5f                   	pop    %edi
+  8000be:	5d                   	pop    %ebp
+  8000bf:	c3                   	ret
+
+008000c0 <handle_client>:
+	return r;
+}
+
+static void
+handle_client(int sock)
+{
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	57                   	push   %edi
+  8000c4:	56                   	push   %esi
+  8000c5:	53                   	push   %ebx
+  8000c6:	81 ec c0 06 00 00    	sub    $0x6c0,%esp
+  8000cc:	89 c6                	mov    %eax,%esi
+	struct http_request *req = &con_d;
+
+	while (1)
+	{
+		// Receive message
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  8000ce:	68 00 02 00 00       	push   $0x200
+  8000d3:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+  8000d9:	50                   	push   %eax
+  8000da:	56                   	push   %esi
+  8000db:	e8 90 19 00 00       	call   801a70 <read>
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	85 c0                	test   %eax,%eax
+  8000e5:	78 3c                	js     800123 <handle_client+0x63>
+			panic("failed to read");
+
+		memset(req, 0, sizeof(*req));
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	6a 0c                	push   $0xc
+  8000ec:	6a 00                	push   $0x0
+  8000ee:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8000f1:	50                   	push   %eax
+  8000f2:	e8 da 0f 00 00       	call   8010d1 <memset>
+
+		req->sock = sock;
+  8000f7:	89 75 dc             	mov    %esi,-0x24(%ebp)
+	if (strncmp(request, "GET ", 4) != 0)
+  8000fa:	83 c4 0c             	add    $0xc,%esp
+  8000fd:	6a 04                	push   $0x4
+  8000ff:	68 00 42 80 00       	push   $0x804200
+  800104:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+  80010a:	50                   	push   %eax
+  80010b:	e8 47 0f 00 00       	call   801057 <strncmp>
+  800110:	83 c4 10             	add    $0x10,%esp
+  800113:	85 c0                	test   %eax,%eax
+  800115:	0f 85 d4 01 00 00    	jne    8002ef <handle_client+0x22f>
+	request += 4;
+  80011b:	8d 9d e0 fd ff ff    	lea    -0x220(%ebp),%ebx
+  800121:	eb 1a                	jmp    80013d <handle_client+0x7d>
+			panic("failed to read");
+  800123:	83 ec 04             	sub    $0x4,%esp
+  800126:	68 e4 41 80 00       	push   $0x8041e4
+  80012b:	68 24 01 00 00       	push   $0x124
+  800130:	68 f3 41 80 00       	push   $0x8041f3
+  800135:	e8 7d 07 00 00       	call   8008b7 <_panic>
+		request++;
+  80013a:	83 c3 01             	add    $0x1,%ebx
+	while (*request && *request != ' ')
+  80013d:	f6 03 df             	testb  $0xdf,(%ebx)
+  800140:	75 f8                	jne    80013a <handle_client+0x7a>
+	url_len = request - url;
+  800142:	89 df                	mov    %ebx,%edi
+  800144:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+  80014a:	29 c7                	sub    %eax,%edi
+	req->url = malloc(url_len + 1);
+  80014c:	83 ec 0c             	sub    $0xc,%esp
+  80014f:	8d 47 01             	lea    0x1(%edi),%eax
+  800152:	50                   	push   %eax
+  800153:	e8 de 31 00 00       	call   803336 <malloc>
+  800158:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	memmove(req->url, url, url_len);
+  80015b:	83 c4 0c             	add    $0xc,%esp
+  80015e:	57                   	push   %edi
+  80015f:	8d 8d e0 fd ff ff    	lea    -0x220(%ebp),%ecx
+  800165:	51                   	push   %ecx
+  800166:	50                   	push   %eax
+  800167:	e8 9a 0f 00 00       	call   801106 <memmove>
+	req->url[url_len] = '\0';
+  80016c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80016f:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	request++;
+  800173:	83 c3 01             	add    $0x1,%ebx
+	while (*request && *request != '\n')
+  800176:	83 c4 10             	add    $0x10,%esp
+	request++;
+  800179:	89 d8                	mov    %ebx,%eax
+	while (*request && *request != '\n')
+  80017b:	eb 03                	jmp    800180 <handle_client+0xc0>
+		request++;
+  80017d:	83 c0 01             	add    $0x1,%eax
+	while (*request && *request != '\n')
+  800180:	0f b6 10             	movzbl (%eax),%edx
+  800183:	84 d2                	test   %dl,%dl
+  800185:	74 05                	je     80018c <handle_client+0xcc>
+  800187:	80 fa 0a             	cmp    $0xa,%dl
+  80018a:	75 f1                	jne    80017d <handle_client+0xbd>
+	version_len = request - version;
+  80018c:	29 d8                	sub    %ebx,%eax
+  80018e:	89 c7                	mov    %eax,%edi
+	req->version = malloc(version_len + 1);
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	8d 40 01             	lea    0x1(%eax),%eax
+  800196:	50                   	push   %eax
+  800197:	e8 9a 31 00 00       	call   803336 <malloc>
+  80019c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	memmove(req->version, version, version_len);
+  80019f:	83 c4 0c             	add    $0xc,%esp
+  8001a2:	57                   	push   %edi
+  8001a3:	53                   	push   %ebx
+  8001a4:	50                   	push   %eax
+  8001a5:	e8 5c 0f 00 00       	call   801106 <memmove>
+	req->version[version_len] = '\0';
+  8001aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8001ad:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	struct Stat stat = {};
+  8001b1:	8d bd 50 f9 ff ff    	lea    -0x6b0(%ebp),%edi
+  8001b7:	b9 23 00 00 00       	mov    $0x23,%ecx
+  8001bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c1:	f3 ab                	rep stos %eax,%es:(%edi)
+	if ((n = file_slurp(req->url, slurpbuf, SLURPSIZE, &stat)) < 0) {
+  8001c3:	8d 85 50 f9 ff ff    	lea    -0x6b0(%ebp),%eax
+  8001c9:	50                   	push   %eax
+  8001ca:	68 00 20 00 00       	push   $0x2000
+  8001cf:	68 00 60 80 00       	push   $0x806000
+  8001d4:	ff 75 e0             	push   -0x20(%ebp)
+  8001d7:	e8 ef 29 00 00       	call   802bcb <file_slurp>
+  8001dc:	89 c7                	mov    %eax,%edi
+  8001de:	83 c4 20             	add    $0x20,%esp
+  8001e1:	85 c0                	test   %eax,%eax
+  8001e3:	78 32                	js     800217 <handle_client+0x157>
+	if (stat.st_isdir) {
+  8001e5:	83 bd d4 f9 ff ff 00 	cmpl   $0x0,-0x62c(%ebp)
+  8001ec:	75 3b                	jne    800229 <handle_client+0x169>
+	struct responce_header *h = headers;
+  8001ee:	bb 10 50 80 00       	mov    $0x805010,%ebx
+	while (h->code != 0 && h->header!= 0) {
+  8001f3:	8b 03                	mov    (%ebx),%eax
+  8001f5:	85 c0                	test   %eax,%eax
+  8001f7:	0f 84 ff 00 00 00    	je     8002fc <handle_client+0x23c>
+		if (h->code == code)
+  8001fd:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+  800201:	0f 84 1b 01 00 00    	je     800322 <handle_client+0x262>
+  800207:	3d c8 00 00 00       	cmp    $0xc8,%eax
+  80020c:	0f 84 10 01 00 00    	je     800322 <handle_client+0x262>
+		h++;
+  800212:	83 c3 08             	add    $0x8,%ebx
+  800215:	eb dc                	jmp    8001f3 <handle_client+0x133>
+		send_error(req, 404);
+  800217:	ba 94 01 00 00       	mov    $0x194,%edx
+  80021c:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80021f:	e8 2a fe ff ff       	call   80004e <send_error>
+		return n;
+  800224:	e9 d3 00 00 00       	jmp    8002fc <handle_client+0x23c>
+		send_error(req, 404);
+  800229:	ba 94 01 00 00       	mov    $0x194,%edx
+  80022e:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800231:	e8 18 fe ff ff       	call   80004e <send_error>
+		return -1;
+  800236:	e9 c1 00 00 00       	jmp    8002fc <handle_client+0x23c>
+		die("Failed to send bytes to client");
+  80023b:	b8 18 43 80 00       	mov    $0x804318,%eax
+  800240:	e8 ee fd ff ff       	call   800033 <die>
+  800245:	e9 07 01 00 00       	jmp    800351 <handle_client+0x291>
+		panic("buffer too small!");
+  80024a:	83 ec 04             	sub    $0x4,%esp
+  80024d:	68 05 42 80 00       	push   $0x804205
+  800252:	6a 69                	push   $0x69
+  800254:	68 f3 41 80 00       	push   $0x8041f3
+  800259:	e8 59 06 00 00       	call   8008b7 <_panic>
+		panic("buffer too small!");
+  80025e:	83 ec 04             	sub    $0x4,%esp
+  800261:	68 05 42 80 00       	push   $0x804205
+  800266:	68 85 00 00 00       	push   $0x85
+  80026b:	68 f3 41 80 00       	push   $0x8041f3
+  800270:	e8 42 06 00 00       	call   8008b7 <_panic>
+	if (n > 0 && write(req->sock, slurpbuf, n) != n)
+  800275:	83 ec 04             	sub    $0x4,%esp
+  800278:	57                   	push   %edi
+  800279:	68 00 60 80 00       	push   $0x806000
+  80027e:	ff 75 dc             	push   -0x24(%ebp)
+  800281:	e8 b8 18 00 00       	call   801b3e <write>
+  800286:	83 c4 10             	add    $0x10,%esp
+  800289:	39 c7                	cmp    %eax,%edi
+  80028b:	0f 84 7f 01 00 00    	je     800410 <handle_client+0x350>
+		die("Failed to send bytes to client");
+  800291:	b8 18 43 80 00       	mov    $0x804318,%eax
+  800296:	e8 98 fd ff ff       	call   800033 <die>
+  80029b:	e9 70 01 00 00       	jmp    800410 <handle_client+0x350>
+		if (n != write(req->sock, buffer, n))
+  8002a0:	83 ec 04             	sub    $0x4,%esp
+  8002a3:	53                   	push   %ebx
+  8002a4:	57                   	push   %edi
+  8002a5:	ff 75 dc             	push   -0x24(%ebp)
+  8002a8:	e8 91 18 00 00       	call   801b3e <write>
+  8002ad:	83 c4 10             	add    $0x10,%esp
+  8002b0:	39 c3                	cmp    %eax,%ebx
+  8002b2:	75 2f                	jne    8002e3 <handle_client+0x223>
+	while ((n = read(fd, buffer, sizeof(buffer))) != 0) {
+  8002b4:	83 ec 04             	sub    $0x4,%esp
+  8002b7:	68 00 04 00 00       	push   $0x400
+  8002bc:	57                   	push   %edi
+  8002bd:	ff b5 44 f9 ff ff    	push   -0x6bc(%ebp)
+  8002c3:	e8 a8 17 00 00       	call   801a70 <read>
+  8002c8:	89 c3                	mov    %eax,%ebx
+  8002ca:	83 c4 10             	add    $0x10,%esp
+  8002cd:	85 c0                	test   %eax,%eax
+  8002cf:	0f 84 80 01 00 00    	je     800455 <handle_client+0x395>
+		if (n < 0)
+  8002d5:	79 c9                	jns    8002a0 <handle_client+0x1e0>
+			die("Failed to read requested url");
+  8002d7:	b8 34 42 80 00       	mov    $0x804234,%eax
+  8002dc:	e8 52 fd ff ff       	call   800033 <die>
+  8002e1:	eb bd                	jmp    8002a0 <handle_client+0x1e0>
+			die("Failed to send bytes to client");
+  8002e3:	b8 18 43 80 00       	mov    $0x804318,%eax
+  8002e8:	e8 46 fd ff ff       	call   800033 <die>
+  8002ed:	eb c5                	jmp    8002b4 <handle_client+0x1f4>
+
+		r = http_request_parse(req, buffer);
+		if (r == -E_BAD_REQ)
+			send_error(req, 400);
+  8002ef:	ba 90 01 00 00       	mov    $0x190,%edx
+  8002f4:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8002f7:	e8 52 fd ff ff       	call   80004e <send_error>
+	free(req->url);
+  8002fc:	83 ec 0c             	sub    $0xc,%esp
+  8002ff:	ff 75 e0             	push   -0x20(%ebp)
+  800302:	e8 83 2f 00 00       	call   80328a <free>
+	free(req->version);
+  800307:	83 c4 04             	add    $0x4,%esp
+  80030a:	ff 75 e4             	push   -0x1c(%ebp)
+  80030d:	e8 78 2f 00 00       	call   80328a <free>
+
+		// no keep alive
+		break;
+	}
+
+	close(sock);
+  800312:	89 34 24             	mov    %esi,(%esp)
+  800315:	e8 1a 16 00 00       	call   801934 <close>
+}
+  80031a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031d:	5b                   	pop    %ebx
+  80031e:	5e                   	pop    %esi
+  80031f:	5f                   	pop    %edi
+  800320:	5d                   	pop    %ebp
+  800321:	c3                   	ret
+	int len = strlen(h->header);
+  800322:	83 ec 0c             	sub    $0xc,%esp
+  800325:	ff 73 04             	push   0x4(%ebx)
+  800328:	e8 18 0c 00 00       	call   800f45 <strlen>
+	if (write(req->sock, h->header, len) != len) {
+  80032d:	83 c4 0c             	add    $0xc,%esp
+  800330:	89 85 44 f9 ff ff    	mov    %eax,-0x6bc(%ebp)
+  800336:	50                   	push   %eax
+  800337:	ff 73 04             	push   0x4(%ebx)
+  80033a:	ff 75 dc             	push   -0x24(%ebp)
+  80033d:	e8 fc 17 00 00       	call   801b3e <write>
+  800342:	83 c4 10             	add    $0x10,%esp
+  800345:	39 85 44 f9 ff ff    	cmp    %eax,-0x6bc(%ebp)
+  80034b:	0f 85 ea fe ff ff    	jne    80023b <handle_client+0x17b>
+	r = snprintf(buf, 64, "Content-Length: %ld\r\n", (long)size);
+  800351:	ff b5 d0 f9 ff ff    	push   -0x630(%ebp)
+  800357:	68 51 42 80 00       	push   $0x804251
+  80035c:	6a 40                	push   $0x40
+  80035e:	8d 85 dc f9 ff ff    	lea    -0x624(%ebp),%eax
+  800364:	50                   	push   %eax
+  800365:	e8 c1 0b 00 00       	call   800f2b <snprintf>
+  80036a:	89 c3                	mov    %eax,%ebx
+	if (r > 63)
+  80036c:	83 c4 10             	add    $0x10,%esp
+  80036f:	83 f8 3f             	cmp    $0x3f,%eax
+  800372:	0f 8f d2 fe ff ff    	jg     80024a <handle_client+0x18a>
+	if (write(req->sock, buf, r) != r)
+  800378:	83 ec 04             	sub    $0x4,%esp
+  80037b:	53                   	push   %ebx
+  80037c:	8d 85 dc f9 ff ff    	lea    -0x624(%ebp),%eax
+  800382:	50                   	push   %eax
+  800383:	ff 75 dc             	push   -0x24(%ebp)
+  800386:	e8 b3 17 00 00       	call   801b3e <write>
+	if ((r = send_size(req, stat.st_size)) < 0)
+  80038b:	83 c4 10             	add    $0x10,%esp
+  80038e:	39 c3                	cmp    %eax,%ebx
+  800390:	0f 85 66 ff ff ff    	jne    8002fc <handle_client+0x23c>
+	r = snprintf(buf, 128, "Content-Type: %s\r\n", type);
+  800396:	68 17 42 80 00       	push   $0x804217
+  80039b:	68 21 42 80 00       	push   $0x804221
+  8003a0:	68 80 00 00 00       	push   $0x80
+  8003a5:	8d 85 dc f9 ff ff    	lea    -0x624(%ebp),%eax
+  8003ab:	50                   	push   %eax
+  8003ac:	e8 7a 0b 00 00       	call   800f2b <snprintf>
+  8003b1:	89 c3                	mov    %eax,%ebx
+	if (r > 127)
+  8003b3:	83 c4 10             	add    $0x10,%esp
+  8003b6:	83 f8 7f             	cmp    $0x7f,%eax
+  8003b9:	0f 8f 9f fe ff ff    	jg     80025e <handle_client+0x19e>
+	if (write(req->sock, buf, r) != r)
+  8003bf:	83 ec 04             	sub    $0x4,%esp
+  8003c2:	50                   	push   %eax
+  8003c3:	8d 85 dc f9 ff ff    	lea    -0x624(%ebp),%eax
+  8003c9:	50                   	push   %eax
+  8003ca:	ff 75 dc             	push   -0x24(%ebp)
+  8003cd:	e8 6c 17 00 00       	call   801b3e <write>
+	if ((r = send_content_type(req)) < 0)
+  8003d2:	83 c4 10             	add    $0x10,%esp
+  8003d5:	39 c3                	cmp    %eax,%ebx
+  8003d7:	0f 85 1f ff ff ff    	jne    8002fc <handle_client+0x23c>
+	int fin_len = strlen(fin);
+  8003dd:	83 ec 0c             	sub    $0xc,%esp
+  8003e0:	68 64 42 80 00       	push   $0x804264
+  8003e5:	e8 5b 0b 00 00       	call   800f45 <strlen>
+  8003ea:	89 c3                	mov    %eax,%ebx
+	if (write(req->sock, fin, fin_len) != fin_len)
+  8003ec:	83 c4 0c             	add    $0xc,%esp
+  8003ef:	50                   	push   %eax
+  8003f0:	68 64 42 80 00       	push   $0x804264
+  8003f5:	ff 75 dc             	push   -0x24(%ebp)
+  8003f8:	e8 41 17 00 00       	call   801b3e <write>
+	if ((r = send_header_fin(req)) < 0)
+  8003fd:	83 c4 10             	add    $0x10,%esp
+  800400:	39 c3                	cmp    %eax,%ebx
+  800402:	0f 85 f4 fe ff ff    	jne    8002fc <handle_client+0x23c>
+	if (n > 0 && write(req->sock, slurpbuf, n) != n)
+  800408:	85 ff                	test   %edi,%edi
+  80040a:	0f 8f 65 fe ff ff    	jg     800275 <handle_client+0x1b5>
+	if (stat.st_size <= n)
+  800410:	3b bd d0 f9 ff ff    	cmp    -0x630(%ebp),%edi
+  800416:	0f 8d e0 fe ff ff    	jge    8002fc <handle_client+0x23c>
+	if ((fd = open(req->url, O_RDONLY)) < 0)
+  80041c:	83 ec 08             	sub    $0x8,%esp
+  80041f:	6a 00                	push   $0x0
+  800421:	ff 75 e0             	push   -0x20(%ebp)
+  800424:	e8 fd 20 00 00       	call   802526 <open>
+  800429:	89 85 44 f9 ff ff    	mov    %eax,-0x6bc(%ebp)
+  80042f:	83 c4 10             	add    $0x10,%esp
+  800432:	85 c0                	test   %eax,%eax
+  800434:	0f 88 c2 fe ff ff    	js     8002fc <handle_client+0x23c>
+	if ((r = seek(fd, n)) >= 0)
+  80043a:	83 ec 08             	sub    $0x8,%esp
+  80043d:	57                   	push   %edi
+  80043e:	50                   	push   %eax
+  80043f:	e8 7c 17 00 00       	call   801bc0 <seek>
+  800444:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(fd, buffer, sizeof(buffer))) != 0) {
+  800447:	8d bd dc f9 ff ff    	lea    -0x624(%ebp),%edi
+	if ((r = seek(fd, n)) >= 0)
+  80044d:	85 c0                	test   %eax,%eax
+  80044f:	0f 89 5f fe ff ff    	jns    8002b4 <handle_client+0x1f4>
+	close(fd);
+  800455:	83 ec 0c             	sub    $0xc,%esp
+  800458:	ff b5 44 f9 ff ff    	push   -0x6bc(%ebp)
+  80045e:	e8 d1 14 00 00       	call   801934 <close>
+	return r;
+  800463:	83 c4 10             	add    $0x10,%esp
+  800466:	e9 91 fe ff ff       	jmp    8002fc <handle_client+0x23c>
+
+0080046b <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80046b:	55                   	push   %ebp
+  80046c:	89 e5                	mov    %esp,%ebp
+  80046e:	57                   	push   %edi
+  80046f:	56                   	push   %esi
+  800470:	53                   	push   %ebx
+  800471:	83 ec 40             	sub    $0x40,%esp
+	int serversock, clientsock;
+	struct sockaddr_in server, client;
+
+	binaryname = "jhttpd";
+  800474:	c7 05 20 50 80 00 67 	movl   $0x804267,0x805020
+  80047b:	42 80 00 
+
+	// Create the TCP socket
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  80047e:	6a 06                	push   $0x6
+  800480:	6a 01                	push   $0x1
+  800482:	6a 02                	push   $0x2
+  800484:	e8 82 2b 00 00       	call   80300b <socket>
+  800489:	89 c6                	mov    %eax,%esi
+  80048b:	83 c4 10             	add    $0x10,%esp
+  80048e:	85 c0                	test   %eax,%eax
+  800490:	78 6d                	js     8004ff <umain+0x94>
+		die("Failed to create socket");
+
+	// Construct the server sockaddr_in structure
+	memset(&server, 0, sizeof(server));		// Clear struct
+  800492:	83 ec 04             	sub    $0x4,%esp
+  800495:	6a 10                	push   $0x10
+  800497:	6a 00                	push   $0x0
+  800499:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  80049c:	53                   	push   %ebx
+  80049d:	e8 2f 0c 00 00       	call   8010d1 <memset>
+	server.sin_family = AF_INET;			// Internet/IP
+  8004a2:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	server.sin_addr.s_addr = htonl(INADDR_ANY);	// IP address
+  8004a6:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8004ad:	e8 64 01 00 00       	call   800616 <htonl>
+  8004b2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	server.sin_port = htons(PORT);			// server port
+  8004b5:	c7 04 24 50 00 00 00 	movl   $0x50,(%esp)
+  8004bc:	e8 3b 01 00 00       	call   8005fc <htons>
+  8004c1:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	// Bind the server socket
+	if (bind(serversock, (struct sockaddr *) &server,
+  8004c5:	83 c4 0c             	add    $0xc,%esp
+  8004c8:	6a 10                	push   $0x10
+  8004ca:	53                   	push   %ebx
+  8004cb:	56                   	push   %esi
+  8004cc:	e8 a8 2a 00 00       	call   802f79 <bind>
+  8004d1:	83 c4 10             	add    $0x10,%esp
+  8004d4:	85 c0                	test   %eax,%eax
+  8004d6:	78 33                	js     80050b <umain+0xa0>
+	{
+		die("Failed to bind the server socket");
+	}
+
+	// Listen on the server socket
+	if (listen(serversock, MAXPENDING) < 0)
+  8004d8:	83 ec 08             	sub    $0x8,%esp
+  8004db:	6a 05                	push   $0x5
+  8004dd:	56                   	push   %esi
+  8004de:	e8 05 2b 00 00       	call   802fe8 <listen>
+  8004e3:	83 c4 10             	add    $0x10,%esp
+  8004e6:	85 c0                	test   %eax,%eax
+  8004e8:	78 2d                	js     800517 <umain+0xac>
+		die("Failed to listen on server socket");
+
+	cprintf("Waiting for http connections...\n");
+  8004ea:	83 ec 0c             	sub    $0xc,%esp
+  8004ed:	68 80 43 80 00       	push   $0x804380
+  8004f2:	e8 9b 04 00 00       	call   800992 <cprintf>
+  8004f7:	83 c4 10             	add    $0x10,%esp
+
+	while (1) {
+		unsigned int clientlen = sizeof(client);
+		// Wait for client connection
+		if ((clientsock = accept(serversock,
+  8004fa:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+  8004fd:	eb 35                	jmp    800534 <umain+0xc9>
+		die("Failed to create socket");
+  8004ff:	b8 6e 42 80 00       	mov    $0x80426e,%eax
+  800504:	e8 2a fb ff ff       	call   800033 <die>
+  800509:	eb 87                	jmp    800492 <umain+0x27>
+		die("Failed to bind the server socket");
+  80050b:	b8 38 43 80 00       	mov    $0x804338,%eax
+  800510:	e8 1e fb ff ff       	call   800033 <die>
+  800515:	eb c1                	jmp    8004d8 <umain+0x6d>
+		die("Failed to listen on server socket");
+  800517:	b8 5c 43 80 00       	mov    $0x80435c,%eax
+  80051c:	e8 12 fb ff ff       	call   800033 <die>
+  800521:	eb c7                	jmp    8004ea <umain+0x7f>
+					 (struct sockaddr *) &client,
+					 &clientlen)) < 0)
+		{
+			die("Failed to accept client connection");
+  800523:	b8 a4 43 80 00       	mov    $0x8043a4,%eax
+  800528:	e8 06 fb ff ff       	call   800033 <die>
+		}
+		handle_client(clientsock);
+  80052d:	89 d8                	mov    %ebx,%eax
+  80052f:	e8 8c fb ff ff       	call   8000c0 <handle_client>
+		unsigned int clientlen = sizeof(client);
+  800534:	c7 45 c4 10 00 00 00 	movl   $0x10,-0x3c(%ebp)
+		if ((clientsock = accept(serversock,
+  80053b:	83 ec 04             	sub    $0x4,%esp
+  80053e:	57                   	push   %edi
+  80053f:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  800542:	50                   	push   %eax
+  800543:	56                   	push   %esi
+  800544:	e8 01 2a 00 00       	call   802f4a <accept>
+  800549:	89 c3                	mov    %eax,%ebx
+  80054b:	83 c4 10             	add    $0x10,%esp
+  80054e:	85 c0                	test   %eax,%eax
+  800550:	78 d1                	js     800523 <umain+0xb8>
+  800552:	eb d9                	jmp    80052d <umain+0xc2>
+
+00800554 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  800554:	55                   	push   %ebp
+  800555:	89 e5                	mov    %esp,%ebp
+  800557:	57                   	push   %edi
+  800558:	56                   	push   %esi
+  800559:	53                   	push   %ebx
+  80055a:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  80055d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800560:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  800563:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  800566:	b9 00 80 80 00       	mov    $0x808000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  80056b:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  800570:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800573:	eb 31                	jmp    8005a6 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  800575:	0f b6 c8             	movzbl %al,%ecx
+  800578:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  80057d:	88 0a                	mov    %cl,(%edx)
+  80057f:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  800582:	83 e8 01             	sub    $0x1,%eax
+  800585:	3c ff                	cmp    $0xff,%al
+  800587:	75 ec                	jne    800575 <inet_ntoa+0x21>
+  800589:	0f b6 db             	movzbl %bl,%ebx
+  80058c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80058f:	01 d8                	add    %ebx,%eax
+  800591:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  800593:	8d 40 01             	lea    0x1(%eax),%eax
+  800596:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800599:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  80059c:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  80059f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8005a2:	39 c7                	cmp    %eax,%edi
+  8005a4:	74 46                	je     8005ec <inet_ntoa+0x98>
+  8005a6:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  8005a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ae:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  8005b1:	89 f0                	mov    %esi,%eax
+  8005b3:	f6 e2                	mul    %dl
+  8005b5:	66 c1 e8 0b          	shr    $0xb,%ax
+  8005b9:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  8005bc:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  8005bf:	01 c9                	add    %ecx,%ecx
+  8005c1:	89 d0                	mov    %edx,%eax
+  8005c3:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  8005c5:	89 d7                	mov    %edx,%edi
+  8005c7:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  8005cb:	89 d9                	mov    %ebx,%ecx
+  8005cd:	83 c3 01             	add    $0x1,%ebx
+  8005d0:	0f b6 c9             	movzbl %cl,%ecx
+  8005d3:	83 c0 30             	add    $0x30,%eax
+  8005d6:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  8005da:	89 f8                	mov    %edi,%eax
+  8005dc:	3c 09                	cmp    $0x9,%al
+  8005de:	77 d1                	ja     8005b1 <inet_ntoa+0x5d>
+  8005e0:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8005e3:	88 17                	mov    %dl,(%edi)
+  8005e5:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  8005e8:	89 d8                	mov    %ebx,%eax
+  8005ea:	eb 96                	jmp    800582 <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  8005ec:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  8005ef:	b8 00 80 80 00       	mov    $0x808000,%eax
+  8005f4:	83 c4 1c             	add    $0x1c,%esp
+  8005f7:	5b                   	pop    %ebx
+  8005f8:	5e                   	pop    %esi
+  8005f9:	5f                   	pop    %edi
+  8005fa:	5d                   	pop    %ebp
+  8005fb:	c3                   	ret
+
+008005fc <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  8005fc:	55                   	push   %ebp
+  8005fd:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8005ff:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800603:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  800607:	5d                   	pop    %ebp
+  800608:	c3                   	ret
+
+00800609 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  800609:	55                   	push   %ebp
+  80060a:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80060c:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800610:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  800614:	5d                   	pop    %ebp
+  800615:	c3                   	ret
+
+00800616 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  800616:	55                   	push   %ebp
+  800617:	89 e5                	mov    %esp,%ebp
+  800619:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  80061c:	89 d0                	mov    %edx,%eax
+  80061e:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  800621:	89 d1                	mov    %edx,%ecx
+  800623:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  800626:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  800628:	89 d1                	mov    %edx,%ecx
+  80062a:	c1 e1 08             	shl    $0x8,%ecx
+  80062d:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  800633:	09 c8                	or     %ecx,%eax
+  800635:	c1 ea 08             	shr    $0x8,%edx
+  800638:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  80063e:	09 d0                	or     %edx,%eax
+}
+  800640:	5d                   	pop    %ebp
+  800641:	c3                   	ret
+
+00800642 <inet_aton>:
+{
+  800642:	55                   	push   %ebp
+  800643:	89 e5                	mov    %esp,%ebp
+  800645:	57                   	push   %edi
+  800646:	56                   	push   %esi
+  800647:	53                   	push   %ebx
+  800648:	83 ec 2c             	sub    $0x2c,%esp
+  80064b:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  80064e:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  800651:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  800654:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  800657:	e9 9b 00 00 00       	jmp    8006f7 <inet_aton+0xb5>
+      c = *++cp;
+  80065c:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  800660:	89 c1                	mov    %eax,%ecx
+  800662:	83 e1 df             	and    $0xffffffdf,%ecx
+  800665:	80 f9 58             	cmp    $0x58,%cl
+  800668:	74 10                	je     80067a <inet_aton+0x38>
+      c = *++cp;
+  80066a:	83 c2 01             	add    $0x1,%edx
+  80066d:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  800670:	bf 08 00 00 00       	mov    $0x8,%edi
+  800675:	e9 97 00 00 00       	jmp    800711 <inet_aton+0xcf>
+        c = *++cp;
+  80067a:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  80067e:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  800681:	bf 10 00 00 00       	mov    $0x10,%edi
+  800686:	e9 86 00 00 00       	jmp    800711 <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  80068b:	0f af d7             	imul   %edi,%edx
+  80068e:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  800692:	0f be 01             	movsbl (%ecx),%eax
+  800695:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  800698:	88 45 d7             	mov    %al,-0x29(%ebp)
+  80069b:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  80069e:	80 fb 09             	cmp    $0x9,%bl
+  8006a1:	76 e8                	jbe    80068b <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  8006a3:	83 ff 10             	cmp    $0x10,%edi
+  8006a6:	75 2e                	jne    8006d6 <inet_aton+0x94>
+  8006a8:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  8006ac:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  8006af:	83 e3 df             	and    $0xffffffdf,%ebx
+  8006b2:	83 eb 41             	sub    $0x41,%ebx
+  8006b5:	80 fb 05             	cmp    $0x5,%bl
+  8006b8:	77 1c                	ja     8006d6 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  8006ba:	c1 e2 04             	shl    $0x4,%edx
+  8006bd:	83 c0 0a             	add    $0xa,%eax
+  8006c0:	89 f3                	mov    %esi,%ebx
+  8006c2:	80 fb 1a             	cmp    $0x1a,%bl
+  8006c5:	19 db                	sbb    %ebx,%ebx
+  8006c7:	83 e3 20             	and    $0x20,%ebx
+  8006ca:	83 c3 41             	add    $0x41,%ebx
+  8006cd:	29 d8                	sub    %ebx,%eax
+  8006cf:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  8006d1:	0f be 01             	movsbl (%ecx),%eax
+  8006d4:	eb bf                	jmp    800695 <inet_aton+0x53>
+    if (c == '.') {
+  8006d6:	83 f8 2e             	cmp    $0x2e,%eax
+  8006d9:	75 43                	jne    80071e <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  8006db:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006de:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8006e1:	39 f0                	cmp    %esi,%eax
+  8006e3:	0f 84 22 01 00 00    	je     80080b <inet_aton+0x1c9>
+      *pp++ = val;
+  8006e9:	83 c0 04             	add    $0x4,%eax
+  8006ec:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006ef:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  8006f2:	89 ca                	mov    %ecx,%edx
+  8006f4:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  8006f7:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8006fa:	80 f9 09             	cmp    $0x9,%cl
+  8006fd:	0f 87 01 01 00 00    	ja     800804 <inet_aton+0x1c2>
+    base = 10;
+  800703:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  800708:	83 f8 30             	cmp    $0x30,%eax
+  80070b:	0f 84 4b ff ff ff    	je     80065c <inet_aton+0x1a>
+  800711:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  800714:	ba 00 00 00 00       	mov    $0x0,%edx
+  800719:	e9 7a ff ff ff       	jmp    800698 <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  80071e:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  800722:	89 d6                	mov    %edx,%esi
+  800724:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  800727:	85 c0                	test   %eax,%eax
+  800729:	74 2e                	je     800759 <inet_aton+0x117>
+    return (0);
+  80072b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  800730:	89 fa                	mov    %edi,%edx
+  800732:	80 fa 1f             	cmp    $0x1f,%dl
+  800735:	0f 86 d5 00 00 00    	jbe    800810 <inet_aton+0x1ce>
+  80073b:	84 c0                	test   %al,%al
+  80073d:	0f 88 cd 00 00 00    	js     800810 <inet_aton+0x1ce>
+  800743:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  800746:	83 f9 04             	cmp    $0x4,%ecx
+  800749:	76 0e                	jbe    800759 <inet_aton+0x117>
+    return (0);
+  80074b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  800750:	83 f8 20             	cmp    $0x20,%eax
+  800753:	0f 85 b7 00 00 00    	jne    800810 <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  800759:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  80075c:	89 d8                	mov    %ebx,%eax
+  80075e:	29 c8                	sub    %ecx,%eax
+  800760:	c1 f8 02             	sar    $0x2,%eax
+  800763:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  800766:	83 f8 02             	cmp    $0x2,%eax
+  800769:	74 7a                	je     8007e5 <inet_aton+0x1a3>
+  80076b:	83 f9 03             	cmp    $0x3,%ecx
+  80076e:	7f 49                	jg     8007b9 <inet_aton+0x177>
+  800770:	85 c9                	test   %ecx,%ecx
+  800772:	0f 84 98 00 00 00    	je     800810 <inet_aton+0x1ce>
+  800778:	83 f9 02             	cmp    $0x2,%ecx
+  80077b:	75 19                	jne    800796 <inet_aton+0x154>
+      return (0);
+  80077d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  800782:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  800788:	0f 87 82 00 00 00    	ja     800810 <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  80078e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800791:	c1 e0 18             	shl    $0x18,%eax
+  800794:	09 c6                	or     %eax,%esi
+  return (1);
+  800796:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  80079b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80079f:	74 6f                	je     800810 <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  8007a1:	83 ec 0c             	sub    $0xc,%esp
+  8007a4:	56                   	push   %esi
+  8007a5:	e8 6c fe ff ff       	call   800616 <htonl>
+  8007aa:	83 c4 10             	add    $0x10,%esp
+  8007ad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8007b0:	89 06                	mov    %eax,(%esi)
+  return (1);
+  8007b2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8007b7:	eb 57                	jmp    800810 <inet_aton+0x1ce>
+  switch (n) {
+  8007b9:	83 f9 04             	cmp    $0x4,%ecx
+  8007bc:	75 d8                	jne    800796 <inet_aton+0x154>
+      return (0);
+  8007be:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  8007c3:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  8007c9:	77 45                	ja     800810 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  8007cb:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8007ce:	c1 e0 18             	shl    $0x18,%eax
+  8007d1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007d4:	c1 e1 10             	shl    $0x10,%ecx
+  8007d7:	09 c8                	or     %ecx,%eax
+  8007d9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8007dc:	c1 e1 08             	shl    $0x8,%ecx
+  8007df:	09 c8                	or     %ecx,%eax
+  8007e1:	09 c6                	or     %eax,%esi
+    break;
+  8007e3:	eb b1                	jmp    800796 <inet_aton+0x154>
+      return (0);
+  8007e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  8007ea:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  8007f0:	77 1e                	ja     800810 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  8007f2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8007f5:	c1 e0 18             	shl    $0x18,%eax
+  8007f8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007fb:	c1 e1 10             	shl    $0x10,%ecx
+  8007fe:	09 c8                	or     %ecx,%eax
+  800800:	09 c6                	or     %eax,%esi
+    break;
+  800802:	eb 92                	jmp    800796 <inet_aton+0x154>
+      return (0);
+  800804:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800809:	eb 05                	jmp    800810 <inet_aton+0x1ce>
+        return (0);
+  80080b:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  800810:	89 c8                	mov    %ecx,%eax
+  800812:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800815:	5b                   	pop    %ebx
+  800816:	5e                   	pop    %esi
+  800817:	5f                   	pop    %edi
+  800818:	5d                   	pop    %ebp
+  800819:	c3                   	ret
+
+0080081a <inet_addr>:
+{
+  80081a:	55                   	push   %ebp
+  80081b:	89 e5                	mov    %esp,%ebp
+  80081d:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  800820:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800823:	50                   	push   %eax
+  800824:	ff 75 08             	push   0x8(%ebp)
+  800827:	e8 16 fe ff ff       	call   800642 <inet_aton>
+  80082c:	89 c2                	mov    %eax,%edx
+  80082e:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  800831:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  800836:	85 d2                	test   %edx,%edx
+  800838:	75 02                	jne    80083c <inet_addr+0x22>
+}
+  80083a:	c9                   	leave
+  80083b:	c3                   	ret
+    return (val.s_addr);
+  80083c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80083f:	eb f9                	jmp    80083a <inet_addr+0x20>
+
+00800841 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  800841:	55                   	push   %ebp
+  800842:	89 e5                	mov    %esp,%ebp
+  800844:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  800847:	ff 75 08             	push   0x8(%ebp)
+  80084a:	e8 c7 fd ff ff       	call   800616 <htonl>
+  80084f:	83 c4 10             	add    $0x10,%esp
+}
+  800852:	c9                   	leave
+  800853:	c3                   	ret
+
+00800854 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	56                   	push   %esi
+  800858:	53                   	push   %ebx
+  800859:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80085c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80085f:	e8 e2 0a 00 00       	call   801346 <sys_getenvid>
+  800864:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800869:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80086f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800874:	a3 10 80 80 00       	mov    %eax,0x808010
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800879:	85 db                	test   %ebx,%ebx
+  80087b:	7e 07                	jle    800884 <libmain+0x30>
+		binaryname = argv[0];
+  80087d:	8b 06                	mov    (%esi),%eax
+  80087f:	a3 20 50 80 00       	mov    %eax,0x805020
+
+	// call user main routine
+	umain(argc, argv);
+  800884:	83 ec 08             	sub    $0x8,%esp
+  800887:	56                   	push   %esi
+  800888:	53                   	push   %ebx
+  800889:	e8 dd fb ff ff       	call   80046b <umain>
+
+	// exit gracefully
+	exit();
+  80088e:	e8 0a 00 00 00       	call   80089d <exit>
+}
+  800893:	83 c4 10             	add    $0x10,%esp
+  800896:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800899:	5b                   	pop    %ebx
+  80089a:	5e                   	pop    %esi
+  80089b:	5d                   	pop    %ebp
+  80089c:	c3                   	ret
+
+0080089d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80089d:	55                   	push   %ebp
+  80089e:	89 e5                	mov    %esp,%ebp
+  8008a0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8008a3:	e8 b9 10 00 00       	call   801961 <close_all>
+	sys_env_destroy(0);
+  8008a8:	83 ec 0c             	sub    $0xc,%esp
+  8008ab:	6a 00                	push   $0x0
+  8008ad:	e8 4b 0a 00 00       	call   8012fd <sys_env_destroy>
+}
+  8008b2:	83 c4 10             	add    $0x10,%esp
+  8008b5:	c9                   	leave
+  8008b6:	c3                   	ret
+
+008008b7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8008b7:	55                   	push   %ebp
+  8008b8:	89 e5                	mov    %esp,%ebp
+  8008ba:	56                   	push   %esi
+  8008bb:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8008bc:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8008bf:	8b 35 20 50 80 00    	mov    0x805020,%esi
+  8008c5:	e8 7c 0a 00 00       	call   801346 <sys_getenvid>
+  8008ca:	83 ec 0c             	sub    $0xc,%esp
+  8008cd:	ff 75 0c             	push   0xc(%ebp)
+  8008d0:	ff 75 08             	push   0x8(%ebp)
+  8008d3:	56                   	push   %esi
+  8008d4:	50                   	push   %eax
+  8008d5:	68 f8 43 80 00       	push   $0x8043f8
+  8008da:	e8 b3 00 00 00       	call   800992 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8008df:	83 c4 18             	add    $0x18,%esp
+  8008e2:	53                   	push   %ebx
+  8008e3:	ff 75 10             	push   0x10(%ebp)
+  8008e6:	e8 56 00 00 00       	call   800941 <vcprintf>
+	cprintf("\n");
+  8008eb:	c7 04 24 65 42 80 00 	movl   $0x804265,(%esp)
+  8008f2:	e8 9b 00 00 00       	call   800992 <cprintf>
+  8008f7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8008fa:	cc                   	int3
+	while (1)
+  8008fb:	eb fd                	jmp    8008fa <_panic+0x43>
+
+008008fd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8008fd:	55                   	push   %ebp
+  8008fe:	89 e5                	mov    %esp,%ebp
+  800900:	53                   	push   %ebx
+  800901:	83 ec 04             	sub    $0x4,%esp
+  800904:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800907:	8b 13                	mov    (%ebx),%edx
+  800909:	8d 42 01             	lea    0x1(%edx),%eax
+  80090c:	89 03                	mov    %eax,(%ebx)
+  80090e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800911:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800915:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80091a:	74 09                	je     800925 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80091c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800920:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800923:	c9                   	leave
+  800924:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800925:	83 ec 08             	sub    $0x8,%esp
+  800928:	68 ff 00 00 00       	push   $0xff
+  80092d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800930:	50                   	push   %eax
+  800931:	e8 7a 09 00 00       	call   8012b0 <sys_cputs>
+		b->idx = 0;
+  800936:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80093c:	83 c4 10             	add    $0x10,%esp
+  80093f:	eb db                	jmp    80091c <putch+0x1f>
+
+00800941 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800941:	55                   	push   %ebp
+  800942:	89 e5                	mov    %esp,%ebp
+  800944:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80094a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800951:	00 00 00 
+	b.cnt = 0;
+  800954:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80095b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80095e:	ff 75 0c             	push   0xc(%ebp)
+  800961:	ff 75 08             	push   0x8(%ebp)
+  800964:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80096a:	50                   	push   %eax
+  80096b:	68 fd 08 80 00       	push   $0x8008fd
+  800970:	e8 14 01 00 00       	call   800a89 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800975:	83 c4 08             	add    $0x8,%esp
+  800978:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80097e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800984:	50                   	push   %eax
+  800985:	e8 26 09 00 00       	call   8012b0 <sys_cputs>
+
+	return b.cnt;
+}
+  80098a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800990:	c9                   	leave
+  800991:	c3                   	ret
+
+00800992 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800992:	55                   	push   %ebp
+  800993:	89 e5                	mov    %esp,%ebp
+  800995:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800998:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80099b:	50                   	push   %eax
+  80099c:	ff 75 08             	push   0x8(%ebp)
+  80099f:	e8 9d ff ff ff       	call   800941 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8009a4:	c9                   	leave
+  8009a5:	c3                   	ret
+
+008009a6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8009a6:	55                   	push   %ebp
+  8009a7:	89 e5                	mov    %esp,%ebp
+  8009a9:	57                   	push   %edi
+  8009aa:	56                   	push   %esi
+  8009ab:	53                   	push   %ebx
+  8009ac:	83 ec 1c             	sub    $0x1c,%esp
+  8009af:	89 c7                	mov    %eax,%edi
+  8009b1:	89 d6                	mov    %edx,%esi
+  8009b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009b9:	89 d1                	mov    %edx,%ecx
+  8009bb:	89 c2                	mov    %eax,%edx
+  8009bd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009c0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009c3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8009c6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8009c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009cc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8009d3:	39 c2                	cmp    %eax,%edx
+  8009d5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8009d8:	72 3e                	jb     800a18 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8009da:	83 ec 0c             	sub    $0xc,%esp
+  8009dd:	ff 75 18             	push   0x18(%ebp)
+  8009e0:	83 eb 01             	sub    $0x1,%ebx
+  8009e3:	53                   	push   %ebx
+  8009e4:	50                   	push   %eax
+  8009e5:	83 ec 08             	sub    $0x8,%esp
+  8009e8:	ff 75 e4             	push   -0x1c(%ebp)
+  8009eb:	ff 75 e0             	push   -0x20(%ebp)
+  8009ee:	ff 75 dc             	push   -0x24(%ebp)
+  8009f1:	ff 75 d8             	push   -0x28(%ebp)
+  8009f4:	e8 6d 36 00 00       	call   804066 <__udivdi3>
+  8009f9:	83 c4 18             	add    $0x18,%esp
+  8009fc:	52                   	push   %edx
+  8009fd:	50                   	push   %eax
+  8009fe:	89 f2                	mov    %esi,%edx
+  800a00:	89 f8                	mov    %edi,%eax
+  800a02:	e8 9f ff ff ff       	call   8009a6 <printnum>
+  800a07:	83 c4 20             	add    $0x20,%esp
+  800a0a:	eb 13                	jmp    800a1f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800a0c:	83 ec 08             	sub    $0x8,%esp
+  800a0f:	56                   	push   %esi
+  800a10:	ff 75 18             	push   0x18(%ebp)
+  800a13:	ff d7                	call   *%edi
+  800a15:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800a18:	83 eb 01             	sub    $0x1,%ebx
+  800a1b:	85 db                	test   %ebx,%ebx
+  800a1d:	7f ed                	jg     800a0c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800a1f:	83 ec 08             	sub    $0x8,%esp
+  800a22:	56                   	push   %esi
+  800a23:	83 ec 04             	sub    $0x4,%esp
+  800a26:	ff 75 e4             	push   -0x1c(%ebp)
+  800a29:	ff 75 e0             	push   -0x20(%ebp)
+  800a2c:	ff 75 dc             	push   -0x24(%ebp)
+  800a2f:	ff 75 d8             	push   -0x28(%ebp)
+  800a32:	e8 4d 36 00 00       	call   804084 <__umoddi3>
+  800a37:	83 c4 14             	add    $0x14,%esp
+  800a3a:	0f be 80 1b 44 80 00 	movsbl 0x80441b(%eax),%eax
+  800a41:	50                   	push   %eax
+  800a42:	ff d7                	call   *%edi
+}
+  800a44:	83 c4 10             	add    $0x10,%esp
+  800a47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a4a:	5b                   	pop    %ebx
+  800a4b:	5e                   	pop    %esi
+  800a4c:	5f                   	pop    %edi
+  800a4d:	5d                   	pop    %ebp
+  800a4e:	c3                   	ret
+
+00800a4f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800a4f:	55                   	push   %ebp
+  800a50:	89 e5                	mov    %esp,%ebp
+  800a52:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800a55:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800a59:	8b 10                	mov    (%eax),%edx
+  800a5b:	3b 50 04             	cmp    0x4(%eax),%edx
+  800a5e:	73 0a                	jae    800a6a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800a60:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800a63:	89 08                	mov    %ecx,(%eax)
+  800a65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a68:	88 02                	mov    %al,(%edx)
+}
+  800a6a:	5d                   	pop    %ebp
+  800a6b:	c3                   	ret
+
+00800a6c <printfmt>:
+{
+  800a6c:	55                   	push   %ebp
+  800a6d:	89 e5                	mov    %esp,%ebp
+  800a6f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800a72:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800a75:	50                   	push   %eax
+  800a76:	ff 75 10             	push   0x10(%ebp)
+  800a79:	ff 75 0c             	push   0xc(%ebp)
+  800a7c:	ff 75 08             	push   0x8(%ebp)
+  800a7f:	e8 05 00 00 00       	call   800a89 <vprintfmt>
+}
+  800a84:	83 c4 10             	add    $0x10,%esp
+  800a87:	c9                   	leave
+  800a88:	c3                   	ret
+
+00800a89 <vprintfmt>:
+{
+  800a89:	55                   	push   %ebp
+  800a8a:	89 e5                	mov    %esp,%ebp
+  800a8c:	57                   	push   %edi
+  800a8d:	56                   	push   %esi
+  800a8e:	53                   	push   %ebx
+  800a8f:	83 ec 2c             	sub    $0x2c,%esp
+  800a92:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a95:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a98:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800a9b:	eb 0a                	jmp    800aa7 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800a9d:	83 ec 08             	sub    $0x8,%esp
+  800aa0:	53                   	push   %ebx
+  800aa1:	50                   	push   %eax
+  800aa2:	ff d6                	call   *%esi
+  800aa4:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800aa7:	83 c7 01             	add    $0x1,%edi
+  800aaa:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800aae:	83 f8 25             	cmp    $0x25,%eax
+  800ab1:	74 0c                	je     800abf <vprintfmt+0x36>
+			if (ch == '\0')
+  800ab3:	85 c0                	test   %eax,%eax
+  800ab5:	75 e6                	jne    800a9d <vprintfmt+0x14>
+}
+  800ab7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aba:	5b                   	pop    %ebx
+  800abb:	5e                   	pop    %esi
+  800abc:	5f                   	pop    %edi
+  800abd:	5d                   	pop    %ebp
+  800abe:	c3                   	ret
+		padc = ' ';
+  800abf:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800ac3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800aca:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800ad1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800ad8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800add:	8d 47 01             	lea    0x1(%edi),%eax
+  800ae0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800ae3:	0f b6 17             	movzbl (%edi),%edx
+  800ae6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800ae9:	3c 55                	cmp    $0x55,%al
+  800aeb:	0f 87 cf 03 00 00    	ja     800ec0 <vprintfmt+0x437>
+  800af1:	0f b6 c0             	movzbl %al,%eax
+  800af4:	ff 24 85 80 45 80 00 	jmp    *0x804580(,%eax,4)
+  800afb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800afe:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800b02:	eb d9                	jmp    800add <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800b04:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800b07:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800b0b:	eb d0                	jmp    800add <vprintfmt+0x54>
+  800b0d:	0f b6 d2             	movzbl %dl,%edx
+  800b10:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800b13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b18:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800b1b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800b1e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800b22:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800b25:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800b28:	83 f9 09             	cmp    $0x9,%ecx
+  800b2b:	77 55                	ja     800b82 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800b2d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800b30:	eb e9                	jmp    800b1b <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800b32:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b35:	8b 00                	mov    (%eax),%eax
+  800b37:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800b3a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b3d:	8d 40 04             	lea    0x4(%eax),%eax
+  800b40:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800b43:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800b46:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800b4a:	79 91                	jns    800add <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800b4c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800b4f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b52:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800b59:	eb 82                	jmp    800add <vprintfmt+0x54>
+			if (width < 0)
+  800b5b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800b5e:	85 d2                	test   %edx,%edx
+  800b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b65:	0f 49 c2             	cmovns %edx,%eax
+  800b68:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800b6b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800b6e:	e9 6a ff ff ff       	jmp    800add <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800b73:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800b76:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800b7d:	e9 5b ff ff ff       	jmp    800add <vprintfmt+0x54>
+  800b82:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800b85:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800b88:	eb bc                	jmp    800b46 <vprintfmt+0xbd>
+			lflag++;
+  800b8a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800b8d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800b90:	e9 48 ff ff ff       	jmp    800add <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800b95:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b98:	8d 78 04             	lea    0x4(%eax),%edi
+  800b9b:	83 ec 08             	sub    $0x8,%esp
+  800b9e:	53                   	push   %ebx
+  800b9f:	ff 30                	push   (%eax)
+  800ba1:	ff d6                	call   *%esi
+			break;
+  800ba3:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800ba6:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800ba9:	e9 b1 02 00 00       	jmp    800e5f <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800bae:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb1:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800bb4:	8b 10                	mov    (%eax),%edx
+  800bb6:	89 d0                	mov    %edx,%eax
+  800bb8:	f7 d8                	neg    %eax
+  800bba:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800bbd:	83 f8 11             	cmp    $0x11,%eax
+  800bc0:	7f 23                	jg     800be5 <vprintfmt+0x15c>
+  800bc2:	8b 14 85 e0 46 80 00 	mov    0x8046e0(,%eax,4),%edx
+  800bc9:	85 d2                	test   %edx,%edx
+  800bcb:	74 18                	je     800be5 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800bcd:	52                   	push   %edx
+  800bce:	68 32 48 80 00       	push   $0x804832
+  800bd3:	53                   	push   %ebx
+  800bd4:	56                   	push   %esi
+  800bd5:	e8 92 fe ff ff       	call   800a6c <printfmt>
+  800bda:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800bdd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800be0:	e9 7a 02 00 00       	jmp    800e5f <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800be5:	50                   	push   %eax
+  800be6:	68 33 44 80 00       	push   $0x804433
+  800beb:	53                   	push   %ebx
+  800bec:	56                   	push   %esi
+  800bed:	e8 7a fe ff ff       	call   800a6c <printfmt>
+  800bf2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800bf5:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800bf8:	e9 62 02 00 00       	jmp    800e5f <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800bfd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c00:	83 c0 04             	add    $0x4,%eax
+  800c03:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800c06:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c09:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800c0b:	85 c9                	test   %ecx,%ecx
+  800c0d:	b8 2c 44 80 00       	mov    $0x80442c,%eax
+  800c12:	0f 45 c1             	cmovne %ecx,%eax
+  800c15:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800c18:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800c1c:	7e 06                	jle    800c24 <vprintfmt+0x19b>
+  800c1e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800c22:	75 0b                	jne    800c2f <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c24:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800c27:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800c2a:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c2d:	eb 5c                	jmp    800c8b <vprintfmt+0x202>
+  800c2f:	83 ec 08             	sub    $0x8,%esp
+  800c32:	ff 75 d0             	push   -0x30(%ebp)
+  800c35:	ff 75 cc             	push   -0x34(%ebp)
+  800c38:	e8 20 03 00 00       	call   800f5d <strnlen>
+  800c3d:	89 c2                	mov    %eax,%edx
+  800c3f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c42:	29 d0                	sub    %edx,%eax
+  800c44:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800c47:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800c4b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c4e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c51:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c53:	eb 0e                	jmp    800c63 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800c55:	83 ec 08             	sub    $0x8,%esp
+  800c58:	53                   	push   %ebx
+  800c59:	57                   	push   %edi
+  800c5a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c5d:	83 ee 01             	sub    $0x1,%esi
+  800c60:	83 c4 10             	add    $0x10,%esp
+  800c63:	85 f6                	test   %esi,%esi
+  800c65:	7f ee                	jg     800c55 <vprintfmt+0x1cc>
+  800c67:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c6a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c6d:	85 c0                	test   %eax,%eax
+  800c6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c74:	0f 49 d0             	cmovns %eax,%edx
+  800c77:	29 d0                	sub    %edx,%eax
+  800c79:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c7c:	eb a6                	jmp    800c24 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800c7e:	83 ec 08             	sub    $0x8,%esp
+  800c81:	53                   	push   %ebx
+  800c82:	52                   	push   %edx
+  800c83:	ff 55 08             	call   *0x8(%ebp)
+  800c86:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c89:	89 f1                	mov    %esi,%ecx
+  800c8b:	8d 71 01             	lea    0x1(%ecx),%esi
+  800c8e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800c92:	0f be d0             	movsbl %al,%edx
+  800c95:	85 d2                	test   %edx,%edx
+  800c97:	74 28                	je     800cc1 <vprintfmt+0x238>
+  800c99:	85 ff                	test   %edi,%edi
+  800c9b:	78 05                	js     800ca2 <vprintfmt+0x219>
+  800c9d:	83 ef 01             	sub    $0x1,%edi
+  800ca0:	78 30                	js     800cd2 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800ca2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800ca6:	74 d6                	je     800c7e <vprintfmt+0x1f5>
+  800ca8:	0f be c0             	movsbl %al,%eax
+  800cab:	83 e8 20             	sub    $0x20,%eax
+  800cae:	83 f8 5e             	cmp    $0x5e,%eax
+  800cb1:	76 cb                	jbe    800c7e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800cb3:	83 ec 08             	sub    $0x8,%esp
+  800cb6:	53                   	push   %ebx
+  800cb7:	6a 3f                	push   $0x3f
+  800cb9:	ff 55 08             	call   *0x8(%ebp)
+  800cbc:	83 c4 10             	add    $0x10,%esp
+  800cbf:	eb c8                	jmp    800c89 <vprintfmt+0x200>
+  800cc1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cc4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800cc7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800cca:	01 d0                	add    %edx,%eax
+  800ccc:	29 c8                	sub    %ecx,%eax
+  800cce:	89 c7                	mov    %eax,%edi
+  800cd0:	eb 13                	jmp    800ce5 <vprintfmt+0x25c>
+  800cd2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cd5:	eb ed                	jmp    800cc4 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800cd7:	83 ec 08             	sub    $0x8,%esp
+  800cda:	53                   	push   %ebx
+  800cdb:	6a 20                	push   $0x20
+  800cdd:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800cdf:	83 ef 01             	sub    $0x1,%edi
+  800ce2:	83 c4 10             	add    $0x10,%esp
+  800ce5:	85 ff                	test   %edi,%edi
+  800ce7:	7f ee                	jg     800cd7 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800ce9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800cec:	89 45 14             	mov    %eax,0x14(%ebp)
+  800cef:	e9 6b 01 00 00       	jmp    800e5f <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800cf4:	83 f9 01             	cmp    $0x1,%ecx
+  800cf7:	7f 1f                	jg     800d18 <vprintfmt+0x28f>
+	else if (lflag)
+  800cf9:	85 c9                	test   %ecx,%ecx
+  800cfb:	74 67                	je     800d64 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800cfd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d00:	8b 00                	mov    (%eax),%eax
+  800d02:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800d05:	89 c1                	mov    %eax,%ecx
+  800d07:	c1 f9 1f             	sar    $0x1f,%ecx
+  800d0a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800d0d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d10:	8d 40 04             	lea    0x4(%eax),%eax
+  800d13:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d16:	eb 17                	jmp    800d2f <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800d18:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d1b:	8b 50 04             	mov    0x4(%eax),%edx
+  800d1e:	8b 00                	mov    (%eax),%eax
+  800d20:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800d23:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800d26:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d29:	8d 40 08             	lea    0x8(%eax),%eax
+  800d2c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800d2f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800d32:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800d35:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800d3a:	85 c9                	test   %ecx,%ecx
+  800d3c:	0f 89 03 01 00 00    	jns    800e45 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800d42:	83 ec 08             	sub    $0x8,%esp
+  800d45:	53                   	push   %ebx
+  800d46:	6a 2d                	push   $0x2d
+  800d48:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800d4a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800d4d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800d50:	f7 da                	neg    %edx
+  800d52:	83 d1 00             	adc    $0x0,%ecx
+  800d55:	f7 d9                	neg    %ecx
+  800d57:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800d5a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800d5f:	e9 e1 00 00 00       	jmp    800e45 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800d64:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d67:	8b 00                	mov    (%eax),%eax
+  800d69:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800d6c:	89 c1                	mov    %eax,%ecx
+  800d6e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800d71:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800d74:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d77:	8d 40 04             	lea    0x4(%eax),%eax
+  800d7a:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d7d:	eb b0                	jmp    800d2f <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800d7f:	83 f9 01             	cmp    $0x1,%ecx
+  800d82:	7f 1e                	jg     800da2 <vprintfmt+0x319>
+	else if (lflag)
+  800d84:	85 c9                	test   %ecx,%ecx
+  800d86:	74 32                	je     800dba <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800d88:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d8b:	8b 10                	mov    (%eax),%edx
+  800d8d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d92:	8d 40 04             	lea    0x4(%eax),%eax
+  800d95:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800d98:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800d9d:	e9 a3 00 00 00       	jmp    800e45 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800da2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800da5:	8b 10                	mov    (%eax),%edx
+  800da7:	8b 48 04             	mov    0x4(%eax),%ecx
+  800daa:	8d 40 08             	lea    0x8(%eax),%eax
+  800dad:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800db0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800db5:	e9 8b 00 00 00       	jmp    800e45 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800dba:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dbd:	8b 10                	mov    (%eax),%edx
+  800dbf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dc4:	8d 40 04             	lea    0x4(%eax),%eax
+  800dc7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800dca:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800dcf:	eb 74                	jmp    800e45 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800dd1:	83 f9 01             	cmp    $0x1,%ecx
+  800dd4:	7f 1b                	jg     800df1 <vprintfmt+0x368>
+	else if (lflag)
+  800dd6:	85 c9                	test   %ecx,%ecx
+  800dd8:	74 2c                	je     800e06 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800dda:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ddd:	8b 10                	mov    (%eax),%edx
+  800ddf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800de4:	8d 40 04             	lea    0x4(%eax),%eax
+  800de7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800dea:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800def:	eb 54                	jmp    800e45 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800df1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800df4:	8b 10                	mov    (%eax),%edx
+  800df6:	8b 48 04             	mov    0x4(%eax),%ecx
+  800df9:	8d 40 08             	lea    0x8(%eax),%eax
+  800dfc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800dff:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800e04:	eb 3f                	jmp    800e45 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800e06:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e09:	8b 10                	mov    (%eax),%edx
+  800e0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e10:	8d 40 04             	lea    0x4(%eax),%eax
+  800e13:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800e16:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800e1b:	eb 28                	jmp    800e45 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800e1d:	83 ec 08             	sub    $0x8,%esp
+  800e20:	53                   	push   %ebx
+  800e21:	6a 30                	push   $0x30
+  800e23:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800e25:	83 c4 08             	add    $0x8,%esp
+  800e28:	53                   	push   %ebx
+  800e29:	6a 78                	push   $0x78
+  800e2b:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800e2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e30:	8b 10                	mov    (%eax),%edx
+  800e32:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800e37:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800e3a:	8d 40 04             	lea    0x4(%eax),%eax
+  800e3d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e40:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800e45:	83 ec 0c             	sub    $0xc,%esp
+  800e48:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800e4c:	50                   	push   %eax
+  800e4d:	ff 75 e0             	push   -0x20(%ebp)
+  800e50:	57                   	push   %edi
+  800e51:	51                   	push   %ecx
+  800e52:	52                   	push   %edx
+  800e53:	89 da                	mov    %ebx,%edx
+  800e55:	89 f0                	mov    %esi,%eax
+  800e57:	e8 4a fb ff ff       	call   8009a6 <printnum>
+			break;
+  800e5c:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800e5f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800e62:	e9 40 fc ff ff       	jmp    800aa7 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800e67:	83 f9 01             	cmp    $0x1,%ecx
+  800e6a:	7f 1b                	jg     800e87 <vprintfmt+0x3fe>
+	else if (lflag)
+  800e6c:	85 c9                	test   %ecx,%ecx
+  800e6e:	74 2c                	je     800e9c <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800e70:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e73:	8b 10                	mov    (%eax),%edx
+  800e75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e7a:	8d 40 04             	lea    0x4(%eax),%eax
+  800e7d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e80:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800e85:	eb be                	jmp    800e45 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800e87:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e8a:	8b 10                	mov    (%eax),%edx
+  800e8c:	8b 48 04             	mov    0x4(%eax),%ecx
+  800e8f:	8d 40 08             	lea    0x8(%eax),%eax
+  800e92:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e95:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800e9a:	eb a9                	jmp    800e45 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800e9c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e9f:	8b 10                	mov    (%eax),%edx
+  800ea1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ea6:	8d 40 04             	lea    0x4(%eax),%eax
+  800ea9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800eac:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800eb1:	eb 92                	jmp    800e45 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800eb3:	83 ec 08             	sub    $0x8,%esp
+  800eb6:	53                   	push   %ebx
+  800eb7:	6a 25                	push   $0x25
+  800eb9:	ff d6                	call   *%esi
+			break;
+  800ebb:	83 c4 10             	add    $0x10,%esp
+  800ebe:	eb 9f                	jmp    800e5f <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800ec0:	83 ec 08             	sub    $0x8,%esp
+  800ec3:	53                   	push   %ebx
+  800ec4:	6a 25                	push   $0x25
+  800ec6:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800ec8:	83 c4 10             	add    $0x10,%esp
+  800ecb:	89 f8                	mov    %edi,%eax
+  800ecd:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800ed1:	74 05                	je     800ed8 <vprintfmt+0x44f>
+  800ed3:	83 e8 01             	sub    $0x1,%eax
+  800ed6:	eb f5                	jmp    800ecd <vprintfmt+0x444>
+  800ed8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800edb:	eb 82                	jmp    800e5f <vprintfmt+0x3d6>
+
+00800edd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800edd:	55                   	push   %ebp
+  800ede:	89 e5                	mov    %esp,%ebp
+  800ee0:	83 ec 18             	sub    $0x18,%esp
+  800ee3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ee6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800ee9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800eec:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800ef0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800ef3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800efa:	85 c0                	test   %eax,%eax
+  800efc:	74 26                	je     800f24 <vsnprintf+0x47>
+  800efe:	85 d2                	test   %edx,%edx
+  800f00:	7e 22                	jle    800f24 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800f02:	ff 75 14             	push   0x14(%ebp)
+  800f05:	ff 75 10             	push   0x10(%ebp)
+  800f08:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800f0b:	50                   	push   %eax
+  800f0c:	68 4f 0a 80 00       	push   $0x800a4f
+  800f11:	e8 73 fb ff ff       	call   800a89 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800f16:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f19:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800f1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f1f:	83 c4 10             	add    $0x10,%esp
+}
+  800f22:	c9                   	leave
+  800f23:	c3                   	ret
+		return -E_INVAL;
+  800f24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f29:	eb f7                	jmp    800f22 <vsnprintf+0x45>
+
+00800f2b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800f31:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800f34:	50                   	push   %eax
+  800f35:	ff 75 10             	push   0x10(%ebp)
+  800f38:	ff 75 0c             	push   0xc(%ebp)
+  800f3b:	ff 75 08             	push   0x8(%ebp)
+  800f3e:	e8 9a ff ff ff       	call   800edd <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800f43:	c9                   	leave
+  800f44:	c3                   	ret
+
+00800f45 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800f45:	55                   	push   %ebp
+  800f46:	89 e5                	mov    %esp,%ebp
+  800f48:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f50:	eb 03                	jmp    800f55 <strlen+0x10>
+		n++;
+  800f52:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800f55:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800f59:	75 f7                	jne    800f52 <strlen+0xd>
+	return n;
+}
+  800f5b:	5d                   	pop    %ebp
+  800f5c:	c3                   	ret
+
+00800f5d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800f5d:	55                   	push   %ebp
+  800f5e:	89 e5                	mov    %esp,%ebp
+  800f60:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f63:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6b:	eb 03                	jmp    800f70 <strnlen+0x13>
+		n++;
+  800f6d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f70:	39 d0                	cmp    %edx,%eax
+  800f72:	74 08                	je     800f7c <strnlen+0x1f>
+  800f74:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800f78:	75 f3                	jne    800f6d <strnlen+0x10>
+  800f7a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800f7c:	89 d0                	mov    %edx,%eax
+  800f7e:	5d                   	pop    %ebp
+  800f7f:	c3                   	ret
+
+00800f80 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800f80:	55                   	push   %ebp
+  800f81:	89 e5                	mov    %esp,%ebp
+  800f83:	53                   	push   %ebx
+  800f84:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800f93:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800f96:	83 c0 01             	add    $0x1,%eax
+  800f99:	84 d2                	test   %dl,%dl
+  800f9b:	75 f2                	jne    800f8f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800f9d:	89 c8                	mov    %ecx,%eax
+  800f9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fa2:	c9                   	leave
+  800fa3:	c3                   	ret
+
+00800fa4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800fa4:	55                   	push   %ebp
+  800fa5:	89 e5                	mov    %esp,%ebp
+  800fa7:	53                   	push   %ebx
+  800fa8:	83 ec 10             	sub    $0x10,%esp
+  800fab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800fae:	53                   	push   %ebx
+  800faf:	e8 91 ff ff ff       	call   800f45 <strlen>
+  800fb4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800fb7:	ff 75 0c             	push   0xc(%ebp)
+  800fba:	01 d8                	add    %ebx,%eax
+  800fbc:	50                   	push   %eax
+  800fbd:	e8 be ff ff ff       	call   800f80 <strcpy>
+	return dst;
+}
+  800fc2:	89 d8                	mov    %ebx,%eax
+  800fc4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fc7:	c9                   	leave
+  800fc8:	c3                   	ret
+
+00800fc9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800fc9:	55                   	push   %ebp
+  800fca:	89 e5                	mov    %esp,%ebp
+  800fcc:	56                   	push   %esi
+  800fcd:	53                   	push   %ebx
+  800fce:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fd1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800fd4:	89 f3                	mov    %esi,%ebx
+  800fd6:	03 5d 10             	add    0x10(%ebp),%ebx
+  800fd9:	89 f0                	mov    %esi,%eax
+  800fdb:	eb 0f                	jmp    800fec <strncpy+0x23>
+		*dst++ = *src;
+  800fdd:	83 c0 01             	add    $0x1,%eax
+  800fe0:	0f b6 0a             	movzbl (%edx),%ecx
+  800fe3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800fe6:	80 f9 01             	cmp    $0x1,%cl
+  800fe9:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800fec:	39 d8                	cmp    %ebx,%eax
+  800fee:	75 ed                	jne    800fdd <strncpy+0x14>
+	}
+	return ret;
+}
+  800ff0:	89 f0                	mov    %esi,%eax
+  800ff2:	5b                   	pop    %ebx
+  800ff3:	5e                   	pop    %esi
+  800ff4:	5d                   	pop    %ebp
+  800ff5:	c3                   	ret
+
+00800ff6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	56                   	push   %esi
+  800ffa:	53                   	push   %ebx
+  800ffb:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ffe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801001:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801004:	89 f0                	mov    %esi,%eax
+  801006:	85 d2                	test   %edx,%edx
+  801008:	74 21                	je     80102b <strlcpy+0x35>
+  80100a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80100e:	89 f2                	mov    %esi,%edx
+  801010:	eb 09                	jmp    80101b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801012:	83 c1 01             	add    $0x1,%ecx
+  801015:	83 c2 01             	add    $0x1,%edx
+  801018:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80101b:	39 c2                	cmp    %eax,%edx
+  80101d:	74 09                	je     801028 <strlcpy+0x32>
+  80101f:	0f b6 19             	movzbl (%ecx),%ebx
+  801022:	84 db                	test   %bl,%bl
+  801024:	75 ec                	jne    801012 <strlcpy+0x1c>
+  801026:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801028:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80102b:	29 f0                	sub    %esi,%eax
+}
+  80102d:	5b                   	pop    %ebx
+  80102e:	5e                   	pop    %esi
+  80102f:	5d                   	pop    %ebp
+  801030:	c3                   	ret
+
+00801031 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801031:	55                   	push   %ebp
+  801032:	89 e5                	mov    %esp,%ebp
+  801034:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801037:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80103a:	eb 06                	jmp    801042 <strcmp+0x11>
+		p++, q++;
+  80103c:	83 c1 01             	add    $0x1,%ecx
+  80103f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801042:	0f b6 01             	movzbl (%ecx),%eax
+  801045:	84 c0                	test   %al,%al
+  801047:	74 04                	je     80104d <strcmp+0x1c>
+  801049:	3a 02                	cmp    (%edx),%al
+  80104b:	74 ef                	je     80103c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80104d:	0f b6 c0             	movzbl %al,%eax
+  801050:	0f b6 12             	movzbl (%edx),%edx
+  801053:	29 d0                	sub    %edx,%eax
+}
+  801055:	5d                   	pop    %ebp
+  801056:	c3                   	ret
+
+00801057 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801057:	55                   	push   %ebp
+  801058:	89 e5                	mov    %esp,%ebp
+  80105a:	53                   	push   %ebx
+  80105b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80105e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801061:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801064:	eb 09                	jmp    80106f <strncmp+0x18>
+		n--, p++, q++;
+  801066:	83 ea 01             	sub    $0x1,%edx
+  801069:	83 c0 01             	add    $0x1,%eax
+  80106c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80106f:	85 d2                	test   %edx,%edx
+  801071:	74 18                	je     80108b <strncmp+0x34>
+  801073:	0f b6 18             	movzbl (%eax),%ebx
+  801076:	84 db                	test   %bl,%bl
+  801078:	74 04                	je     80107e <strncmp+0x27>
+  80107a:	3a 19                	cmp    (%ecx),%bl
+  80107c:	74 e8                	je     801066 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80107e:	0f b6 00             	movzbl (%eax),%eax
+  801081:	0f b6 11             	movzbl (%ecx),%edx
+  801084:	29 d0                	sub    %edx,%eax
+}
+  801086:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801089:	c9                   	leave
+  80108a:	c3                   	ret
+		return 0;
+  80108b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801090:	eb f4                	jmp    801086 <strncmp+0x2f>
+
+00801092 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801092:	55                   	push   %ebp
+  801093:	89 e5                	mov    %esp,%ebp
+  801095:	8b 45 08             	mov    0x8(%ebp),%eax
+  801098:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80109c:	eb 03                	jmp    8010a1 <strchr+0xf>
+  80109e:	83 c0 01             	add    $0x1,%eax
+  8010a1:	0f b6 10             	movzbl (%eax),%edx
+  8010a4:	84 d2                	test   %dl,%dl
+  8010a6:	74 06                	je     8010ae <strchr+0x1c>
+		if (*s == c)
+  8010a8:	38 ca                	cmp    %cl,%dl
+  8010aa:	75 f2                	jne    80109e <strchr+0xc>
+  8010ac:	eb 05                	jmp    8010b3 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8010ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010b3:	5d                   	pop    %ebp
+  8010b4:	c3                   	ret
+
+008010b5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010bb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8010bf:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8010c2:	38 ca                	cmp    %cl,%dl
+  8010c4:	74 09                	je     8010cf <strfind+0x1a>
+  8010c6:	84 d2                	test   %dl,%dl
+  8010c8:	74 05                	je     8010cf <strfind+0x1a>
+	for (; *s; s++)
+  8010ca:	83 c0 01             	add    $0x1,%eax
+  8010cd:	eb f0                	jmp    8010bf <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8010cf:	5d                   	pop    %ebp
+  8010d0:	c3                   	ret
+
+008010d1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8010d1:	55                   	push   %ebp
+  8010d2:	89 e5                	mov    %esp,%ebp
+  8010d4:	57                   	push   %edi
+  8010d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8010d8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8010db:	85 c9                	test   %ecx,%ecx
+  8010dd:	74 20                	je     8010ff <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8010df:	89 f8                	mov    %edi,%eax
+  8010e1:	09 c8                	or     %ecx,%eax
+  8010e3:	a8 03                	test   $0x3,%al
+  8010e5:	75 12                	jne    8010f9 <memset+0x28>
+		c &= 0xFF;
+  8010e7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8010eb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8010f1:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8010f4:	fc                   	cld
+  8010f5:	f3 ab                	rep stos %eax,%es:(%edi)
+  8010f7:	eb 06                	jmp    8010ff <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8010f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010fc:	fc                   	cld
+  8010fd:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8010ff:	89 f8                	mov    %edi,%eax
+  801101:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801104:	c9                   	leave
+  801105:	c3                   	ret
+
+00801106 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801106:	55                   	push   %ebp
+  801107:	89 e5                	mov    %esp,%ebp
+  801109:	57                   	push   %edi
+  80110a:	56                   	push   %esi
+  80110b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80110e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801111:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801114:	39 c6                	cmp    %eax,%esi
+  801116:	73 32                	jae    80114a <memmove+0x44>
+  801118:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80111b:	39 d0                	cmp    %edx,%eax
+  80111d:	73 2b                	jae    80114a <memmove+0x44>
+		s += n;
+		d += n;
+  80111f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801122:	89 d6                	mov    %edx,%esi
+  801124:	09 fe                	or     %edi,%esi
+  801126:	09 ce                	or     %ecx,%esi
+  801128:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80112e:	75 0e                	jne    80113e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801130:	83 ef 04             	sub    $0x4,%edi
+  801133:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801136:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801139:	fd                   	std
+  80113a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80113c:	eb 09                	jmp    801147 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80113e:	83 ef 01             	sub    $0x1,%edi
+  801141:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801144:	fd                   	std
+  801145:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801147:	fc                   	cld
+  801148:	eb 1a                	jmp    801164 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80114a:	89 f2                	mov    %esi,%edx
+  80114c:	09 c2                	or     %eax,%edx
+  80114e:	09 ca                	or     %ecx,%edx
+  801150:	f6 c2 03             	test   $0x3,%dl
+  801153:	75 0a                	jne    80115f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801155:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801158:	89 c7                	mov    %eax,%edi
+  80115a:	fc                   	cld
+  80115b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80115d:	eb 05                	jmp    801164 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80115f:	89 c7                	mov    %eax,%edi
+  801161:	fc                   	cld
+  801162:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801164:	5e                   	pop    %esi
+  801165:	5f                   	pop    %edi
+  801166:	5d                   	pop    %ebp
+  801167:	c3                   	ret
+
+00801168 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801168:	55                   	push   %ebp
+  801169:	89 e5                	mov    %esp,%ebp
+  80116b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80116e:	ff 75 10             	push   0x10(%ebp)
+  801171:	ff 75 0c             	push   0xc(%ebp)
+  801174:	ff 75 08             	push   0x8(%ebp)
+  801177:	e8 8a ff ff ff       	call   801106 <memmove>
+}
+  80117c:	c9                   	leave
+  80117d:	c3                   	ret
+
+0080117e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80117e:	55                   	push   %ebp
+  80117f:	89 e5                	mov    %esp,%ebp
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+  801183:	8b 45 08             	mov    0x8(%ebp),%eax
+  801186:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801189:	89 c6                	mov    %eax,%esi
+  80118b:	03 75 10             	add    0x10(%ebp),%esi
+  80118e:	eb 06                	jmp    801196 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801190:	83 c0 01             	add    $0x1,%eax
+  801193:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801196:	39 f0                	cmp    %esi,%eax
+  801198:	74 14                	je     8011ae <memcmp+0x30>
+		if (*s1 != *s2)
+  80119a:	0f b6 08             	movzbl (%eax),%ecx
+  80119d:	0f b6 1a             	movzbl (%edx),%ebx
+  8011a0:	38 d9                	cmp    %bl,%cl
+  8011a2:	74 ec                	je     801190 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8011a4:	0f b6 c1             	movzbl %cl,%eax
+  8011a7:	0f b6 db             	movzbl %bl,%ebx
+  8011aa:	29 d8                	sub    %ebx,%eax
+  8011ac:	eb 05                	jmp    8011b3 <memcmp+0x35>
+	}
+
+	return 0;
+  8011ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011b3:	5b                   	pop    %ebx
+  8011b4:	5e                   	pop    %esi
+  8011b5:	5d                   	pop    %ebp
+  8011b6:	c3                   	ret
+
+008011b7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8011b7:	55                   	push   %ebp
+  8011b8:	89 e5                	mov    %esp,%ebp
+  8011ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8011c0:	89 c2                	mov    %eax,%edx
+  8011c2:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8011c5:	eb 03                	jmp    8011ca <memfind+0x13>
+  8011c7:	83 c0 01             	add    $0x1,%eax
+  8011ca:	39 d0                	cmp    %edx,%eax
+  8011cc:	73 04                	jae    8011d2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8011ce:	38 08                	cmp    %cl,(%eax)
+  8011d0:	75 f5                	jne    8011c7 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8011d2:	5d                   	pop    %ebp
+  8011d3:	c3                   	ret
+
+008011d4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8011d4:	55                   	push   %ebp
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	57                   	push   %edi
+  8011d8:	56                   	push   %esi
+  8011d9:	53                   	push   %ebx
+  8011da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8011e0:	eb 03                	jmp    8011e5 <strtol+0x11>
+		s++;
+  8011e2:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8011e5:	0f b6 02             	movzbl (%edx),%eax
+  8011e8:	3c 20                	cmp    $0x20,%al
+  8011ea:	74 f6                	je     8011e2 <strtol+0xe>
+  8011ec:	3c 09                	cmp    $0x9,%al
+  8011ee:	74 f2                	je     8011e2 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8011f0:	3c 2b                	cmp    $0x2b,%al
+  8011f2:	74 2a                	je     80121e <strtol+0x4a>
+	int neg = 0;
+  8011f4:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8011f9:	3c 2d                	cmp    $0x2d,%al
+  8011fb:	74 2b                	je     801228 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011fd:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801203:	75 0f                	jne    801214 <strtol+0x40>
+  801205:	80 3a 30             	cmpb   $0x30,(%edx)
+  801208:	74 28                	je     801232 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80120a:	85 db                	test   %ebx,%ebx
+  80120c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801211:	0f 44 d8             	cmove  %eax,%ebx
+  801214:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801219:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80121c:	eb 46                	jmp    801264 <strtol+0x90>
+		s++;
+  80121e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801221:	bf 00 00 00 00       	mov    $0x0,%edi
+  801226:	eb d5                	jmp    8011fd <strtol+0x29>
+		s++, neg = 1;
+  801228:	83 c2 01             	add    $0x1,%edx
+  80122b:	bf 01 00 00 00       	mov    $0x1,%edi
+  801230:	eb cb                	jmp    8011fd <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801232:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801236:	74 0e                	je     801246 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801238:	85 db                	test   %ebx,%ebx
+  80123a:	75 d8                	jne    801214 <strtol+0x40>
+		s++, base = 8;
+  80123c:	83 c2 01             	add    $0x1,%edx
+  80123f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801244:	eb ce                	jmp    801214 <strtol+0x40>
+		s += 2, base = 16;
+  801246:	83 c2 02             	add    $0x2,%edx
+  801249:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80124e:	eb c4                	jmp    801214 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801250:	0f be c0             	movsbl %al,%eax
+  801253:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801256:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801259:	7d 3a                	jge    801295 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  80125b:	83 c2 01             	add    $0x1,%edx
+  80125e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801262:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801264:	0f b6 02             	movzbl (%edx),%eax
+  801267:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80126a:	89 f3                	mov    %esi,%ebx
+  80126c:	80 fb 09             	cmp    $0x9,%bl
+  80126f:	76 df                	jbe    801250 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801271:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801274:	89 f3                	mov    %esi,%ebx
+  801276:	80 fb 19             	cmp    $0x19,%bl
+  801279:	77 08                	ja     801283 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  80127b:	0f be c0             	movsbl %al,%eax
+  80127e:	83 e8 57             	sub    $0x57,%eax
+  801281:	eb d3                	jmp    801256 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801283:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801286:	89 f3                	mov    %esi,%ebx
+  801288:	80 fb 19             	cmp    $0x19,%bl
+  80128b:	77 08                	ja     801295 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80128d:	0f be c0             	movsbl %al,%eax
+  801290:	83 e8 37             	sub    $0x37,%eax
+  801293:	eb c1                	jmp    801256 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801295:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801299:	74 05                	je     8012a0 <strtol+0xcc>
+		*endptr = (char *) s;
+  80129b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80129e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8012a0:	89 c8                	mov    %ecx,%eax
+  8012a2:	f7 d8                	neg    %eax
+  8012a4:	85 ff                	test   %edi,%edi
+  8012a6:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8012a9:	89 c8                	mov    %ecx,%eax
+  8012ab:	5b                   	pop    %ebx
+  8012ac:	5e                   	pop    %esi
+  8012ad:	5f                   	pop    %edi
+  8012ae:	5d                   	pop    %ebp
+  8012af:	c3                   	ret
+
+008012b0 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8012b0:	55                   	push   %ebp
+  8012b1:	89 e5                	mov    %esp,%ebp
+  8012b3:	57                   	push   %edi
+  8012b4:	56                   	push   %esi
+  8012b5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c1:	89 c3                	mov    %eax,%ebx
+  8012c3:	89 c7                	mov    %eax,%edi
+  8012c5:	55                   	push   %ebp
+  8012c6:	89 e5                	mov    %esp,%ebp
+  8012c8:	8d 35 d0 12 80 00    	lea    0x8012d0,%esi
+  8012ce:	0f 34                	sysenter
+  8012d0:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  8012d1:	5b                   	pop    %ebx
+  8012d2:	5e                   	pop    %esi
+  8012d3:	5f                   	pop    %edi
+  8012d4:	5d                   	pop    %ebp
+  8012d5:	c3                   	ret
+
+008012d6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8012d6:	55                   	push   %ebp
+  8012d7:	89 e5                	mov    %esp,%ebp
+  8012d9:	57                   	push   %edi
+  8012da:	56                   	push   %esi
+  8012db:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012e6:	89 d1                	mov    %edx,%ecx
+  8012e8:	89 d3                	mov    %edx,%ebx
+  8012ea:	89 d7                	mov    %edx,%edi
+  8012ec:	55                   	push   %ebp
+  8012ed:	89 e5                	mov    %esp,%ebp
+  8012ef:	8d 35 f7 12 80 00    	lea    0x8012f7,%esi
+  8012f5:	0f 34                	sysenter
+  8012f7:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  8012f8:	5b                   	pop    %ebx
+  8012f9:	5e                   	pop    %esi
+  8012fa:	5f                   	pop    %edi
+  8012fb:	5d                   	pop    %ebp
+  8012fc:	c3                   	ret
+
+008012fd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8012fd:	55                   	push   %ebp
+  8012fe:	89 e5                	mov    %esp,%ebp
+  801300:	57                   	push   %edi
+  801301:	56                   	push   %esi
+  801302:	53                   	push   %ebx
+  801303:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801306:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80130b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801313:	89 cb                	mov    %ecx,%ebx
+  801315:	89 cf                	mov    %ecx,%edi
+  801317:	55                   	push   %ebp
+  801318:	89 e5                	mov    %esp,%ebp
+  80131a:	8d 35 22 13 80 00    	lea    0x801322,%esi
+  801320:	0f 34                	sysenter
+  801322:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801323:	85 c0                	test   %eax,%eax
+  801325:	7f 08                	jg     80132f <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  801327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132a:	5b                   	pop    %ebx
+  80132b:	5e                   	pop    %esi
+  80132c:	5f                   	pop    %edi
+  80132d:	5d                   	pop    %ebp
+  80132e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80132f:	83 ec 0c             	sub    $0xc,%esp
+  801332:	50                   	push   %eax
+  801333:	6a 03                	push   $0x3
+  801335:	68 47 47 80 00       	push   $0x804747
+  80133a:	6a 3d                	push   $0x3d
+  80133c:	68 64 47 80 00       	push   $0x804764
+  801341:	e8 71 f5 ff ff       	call   8008b7 <_panic>
+
+00801346 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801346:	55                   	push   %ebp
+  801347:	89 e5                	mov    %esp,%ebp
+  801349:	57                   	push   %edi
+  80134a:	56                   	push   %esi
+  80134b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80134c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801351:	b8 02 00 00 00       	mov    $0x2,%eax
+  801356:	89 d1                	mov    %edx,%ecx
+  801358:	89 d3                	mov    %edx,%ebx
+  80135a:	89 d7                	mov    %edx,%edi
+  80135c:	55                   	push   %ebp
+  80135d:	89 e5                	mov    %esp,%ebp
+  80135f:	8d 35 67 13 80 00    	lea    0x801367,%esi
+  801365:	0f 34                	sysenter
+  801367:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  801368:	5b                   	pop    %ebx
+  801369:	5e                   	pop    %esi
+  80136a:	5f                   	pop    %edi
+  80136b:	5d                   	pop    %ebp
+  80136c:	c3                   	ret
+
+0080136d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80136d:	55                   	push   %ebp
+  80136e:	89 e5                	mov    %esp,%ebp
+  801370:	57                   	push   %edi
+  801371:	56                   	push   %esi
+  801372:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801373:	ba 00 00 00 00       	mov    $0x0,%edx
+  801378:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80137d:	89 d1                	mov    %edx,%ecx
+  80137f:	89 d3                	mov    %edx,%ebx
+  801381:	89 d7                	mov    %edx,%edi
+  801383:	89 d6                	mov    %edx,%esi
+  801385:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801387:	5b                   	pop    %ebx
+  801388:	5e                   	pop    %esi
+  801389:	5f                   	pop    %edi
+  80138a:	5d                   	pop    %ebp
+  80138b:	c3                   	ret
+
+0080138c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80138c:	55                   	push   %ebp
+  80138d:	89 e5                	mov    %esp,%ebp
+  80138f:	57                   	push   %edi
+  801390:	56                   	push   %esi
+  801391:	53                   	push   %ebx
+  801392:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801395:	8b 55 08             	mov    0x8(%ebp),%edx
+  801398:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139b:	b8 04 00 00 00       	mov    $0x4,%eax
+  8013a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a8:	55                   	push   %ebp
+  8013a9:	89 e5                	mov    %esp,%ebp
+  8013ab:	8d 35 b3 13 80 00    	lea    0x8013b3,%esi
+  8013b1:	0f 34                	sysenter
+  8013b3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8013b4:	85 c0                	test   %eax,%eax
+  8013b6:	7f 08                	jg     8013c0 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  8013b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013bb:	5b                   	pop    %ebx
+  8013bc:	5e                   	pop    %esi
+  8013bd:	5f                   	pop    %edi
+  8013be:	5d                   	pop    %ebp
+  8013bf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013c0:	83 ec 0c             	sub    $0xc,%esp
+  8013c3:	50                   	push   %eax
+  8013c4:	6a 04                	push   $0x4
+  8013c6:	68 47 47 80 00       	push   $0x804747
+  8013cb:	6a 3d                	push   $0x3d
+  8013cd:	68 64 47 80 00       	push   $0x804764
+  8013d2:	e8 e0 f4 ff ff       	call   8008b7 <_panic>
+
+008013d7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8013d7:	55                   	push   %ebp
+  8013d8:	89 e5                	mov    %esp,%ebp
+  8013da:	57                   	push   %edi
+  8013db:	56                   	push   %esi
+  8013dc:	53                   	push   %ebx
+  8013dd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8013eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013f1:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013f4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013f6:	85 c0                	test   %eax,%eax
+  8013f8:	7f 08                	jg     801402 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8013fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013fd:	5b                   	pop    %ebx
+  8013fe:	5e                   	pop    %esi
+  8013ff:	5f                   	pop    %edi
+  801400:	5d                   	pop    %ebp
+  801401:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801402:	83 ec 0c             	sub    $0xc,%esp
+  801405:	50                   	push   %eax
+  801406:	6a 05                	push   $0x5
+  801408:	68 47 47 80 00       	push   $0x804747
+  80140d:	6a 23                	push   $0x23
+  80140f:	68 64 47 80 00       	push   $0x804764
+  801414:	e8 9e f4 ff ff       	call   8008b7 <_panic>
+
+00801419 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801419:	55                   	push   %ebp
+  80141a:	89 e5                	mov    %esp,%ebp
+  80141c:	57                   	push   %edi
+  80141d:	56                   	push   %esi
+  80141e:	53                   	push   %ebx
+  80141f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801422:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801427:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801432:	89 df                	mov    %ebx,%edi
+  801434:	55                   	push   %ebp
+  801435:	89 e5                	mov    %esp,%ebp
+  801437:	8d 35 3f 14 80 00    	lea    0x80143f,%esi
+  80143d:	0f 34                	sysenter
+  80143f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801440:	85 c0                	test   %eax,%eax
+  801442:	7f 08                	jg     80144c <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  801444:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801447:	5b                   	pop    %ebx
+  801448:	5e                   	pop    %esi
+  801449:	5f                   	pop    %edi
+  80144a:	5d                   	pop    %ebp
+  80144b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80144c:	83 ec 0c             	sub    $0xc,%esp
+  80144f:	50                   	push   %eax
+  801450:	6a 06                	push   $0x6
+  801452:	68 47 47 80 00       	push   $0x804747
+  801457:	6a 3d                	push   $0x3d
+  801459:	68 64 47 80 00       	push   $0x804764
+  80145e:	e8 54 f4 ff ff       	call   8008b7 <_panic>
+
+00801463 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801463:	55                   	push   %ebp
+  801464:	89 e5                	mov    %esp,%ebp
+  801466:	57                   	push   %edi
+  801467:	56                   	push   %esi
+  801468:	53                   	push   %ebx
+  801469:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80146c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801471:	8b 55 08             	mov    0x8(%ebp),%edx
+  801474:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801477:	b8 08 00 00 00       	mov    $0x8,%eax
+  80147c:	89 df                	mov    %ebx,%edi
+  80147e:	55                   	push   %ebp
+  80147f:	89 e5                	mov    %esp,%ebp
+  801481:	8d 35 89 14 80 00    	lea    0x801489,%esi
+  801487:	0f 34                	sysenter
+  801489:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80148a:	85 c0                	test   %eax,%eax
+  80148c:	7f 08                	jg     801496 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  80148e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801491:	5b                   	pop    %ebx
+  801492:	5e                   	pop    %esi
+  801493:	5f                   	pop    %edi
+  801494:	5d                   	pop    %ebp
+  801495:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801496:	83 ec 0c             	sub    $0xc,%esp
+  801499:	50                   	push   %eax
+  80149a:	6a 08                	push   $0x8
+  80149c:	68 47 47 80 00       	push   $0x804747
+  8014a1:	6a 3d                	push   $0x3d
+  8014a3:	68 64 47 80 00       	push   $0x804764
+  8014a8:	e8 0a f4 ff ff       	call   8008b7 <_panic>
+
+008014ad <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8014ad:	55                   	push   %ebp
+  8014ae:	89 e5                	mov    %esp,%ebp
+  8014b0:	57                   	push   %edi
+  8014b1:	56                   	push   %esi
+  8014b2:	53                   	push   %ebx
+  8014b3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8014b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014c6:	89 df                	mov    %ebx,%edi
+  8014c8:	55                   	push   %ebp
+  8014c9:	89 e5                	mov    %esp,%ebp
+  8014cb:	8d 35 d3 14 80 00    	lea    0x8014d3,%esi
+  8014d1:	0f 34                	sysenter
+  8014d3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8014d4:	85 c0                	test   %eax,%eax
+  8014d6:	7f 08                	jg     8014e0 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  8014d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014db:	5b                   	pop    %ebx
+  8014dc:	5e                   	pop    %esi
+  8014dd:	5f                   	pop    %edi
+  8014de:	5d                   	pop    %ebp
+  8014df:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014e0:	83 ec 0c             	sub    $0xc,%esp
+  8014e3:	50                   	push   %eax
+  8014e4:	6a 09                	push   $0x9
+  8014e6:	68 47 47 80 00       	push   $0x804747
+  8014eb:	6a 3d                	push   $0x3d
+  8014ed:	68 64 47 80 00       	push   $0x804764
+  8014f2:	e8 c0 f3 ff ff       	call   8008b7 <_panic>
+
+008014f7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8014f7:	55                   	push   %ebp
+  8014f8:	89 e5                	mov    %esp,%ebp
+  8014fa:	57                   	push   %edi
+  8014fb:	56                   	push   %esi
+  8014fc:	53                   	push   %ebx
+  8014fd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801500:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801505:	8b 55 08             	mov    0x8(%ebp),%edx
+  801508:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801510:	89 df                	mov    %ebx,%edi
+  801512:	55                   	push   %ebp
+  801513:	89 e5                	mov    %esp,%ebp
+  801515:	8d 35 1d 15 80 00    	lea    0x80151d,%esi
+  80151b:	0f 34                	sysenter
+  80151d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80151e:	85 c0                	test   %eax,%eax
+  801520:	7f 08                	jg     80152a <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  801522:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801525:	5b                   	pop    %ebx
+  801526:	5e                   	pop    %esi
+  801527:	5f                   	pop    %edi
+  801528:	5d                   	pop    %ebp
+  801529:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80152a:	83 ec 0c             	sub    $0xc,%esp
+  80152d:	50                   	push   %eax
+  80152e:	6a 0a                	push   $0xa
+  801530:	68 47 47 80 00       	push   $0x804747
+  801535:	6a 3d                	push   $0x3d
+  801537:	68 64 47 80 00       	push   $0x804764
+  80153c:	e8 76 f3 ff ff       	call   8008b7 <_panic>
+
+00801541 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801541:	55                   	push   %ebp
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	57                   	push   %edi
+  801545:	56                   	push   %esi
+  801546:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801547:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801552:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801555:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801558:	55                   	push   %ebp
+  801559:	89 e5                	mov    %esp,%ebp
+  80155b:	8d 35 63 15 80 00    	lea    0x801563,%esi
+  801561:	0f 34                	sysenter
+  801563:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  801564:	5b                   	pop    %ebx
+  801565:	5e                   	pop    %esi
+  801566:	5f                   	pop    %edi
+  801567:	5d                   	pop    %ebp
+  801568:	c3                   	ret
+
+00801569 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  801569:	55                   	push   %ebp
+  80156a:	89 e5                	mov    %esp,%ebp
+  80156c:	57                   	push   %edi
+  80156d:	56                   	push   %esi
+  80156e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80156f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801572:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801575:	b8 17 00 00 00       	mov    $0x17,%eax
+  80157a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80157d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801580:	55                   	push   %ebp
+  801581:	89 e5                	mov    %esp,%ebp
+  801583:	8d 35 8b 15 80 00    	lea    0x80158b,%esi
+  801589:	0f 34                	sysenter
+  80158b:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  80158c:	5b                   	pop    %ebx
+  80158d:	5e                   	pop    %esi
+  80158e:	5f                   	pop    %edi
+  80158f:	5d                   	pop    %ebp
+  801590:	c3                   	ret
+
+00801591 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  801591:	55                   	push   %ebp
+  801592:	89 e5                	mov    %esp,%ebp
+  801594:	57                   	push   %edi
+  801595:	56                   	push   %esi
+  801596:	53                   	push   %ebx
+  801597:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80159a:	be 00 00 00 00       	mov    $0x0,%esi
+  80159f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8015aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ad:	89 f7                	mov    %esi,%edi
+  8015af:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015b1:	85 c0                	test   %eax,%eax
+  8015b3:	7f 08                	jg     8015bd <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8015b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b8:	5b                   	pop    %ebx
+  8015b9:	5e                   	pop    %esi
+  8015ba:	5f                   	pop    %edi
+  8015bb:	5d                   	pop    %ebp
+  8015bc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015bd:	83 ec 0c             	sub    $0xc,%esp
+  8015c0:	50                   	push   %eax
+  8015c1:	6a 0d                	push   $0xd
+  8015c3:	68 47 47 80 00       	push   $0x804747
+  8015c8:	6a 23                	push   $0x23
+  8015ca:	68 64 47 80 00       	push   $0x804764
+  8015cf:	e8 e3 f2 ff ff       	call   8008b7 <_panic>
+
+008015d4 <sys_ipc_recv>:
+{
+  8015d4:	55                   	push   %ebp
+  8015d5:	89 e5                	mov    %esp,%ebp
+  8015d7:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  8015da:	6a 00                	push   $0x0
+  8015dc:	6a 01                	push   $0x1
+  8015de:	ff 75 08             	push   0x8(%ebp)
+  8015e1:	e8 ab ff ff ff       	call   801591 <sys_ipc_recvv>
+}
+  8015e6:	c9                   	leave
+  8015e7:	c3                   	ret
+
+008015e8 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  8015e8:	55                   	push   %ebp
+  8015e9:	89 e5                	mov    %esp,%ebp
+  8015eb:	57                   	push   %edi
+  8015ec:	56                   	push   %esi
+  8015ed:	53                   	push   %ebx
+  8015ee:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8015f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015fc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801601:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801604:	89 de                	mov    %ebx,%esi
+  801606:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801608:	85 c0                	test   %eax,%eax
+  80160a:	7f 08                	jg     801614 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  80160c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160f:	5b                   	pop    %ebx
+  801610:	5e                   	pop    %esi
+  801611:	5f                   	pop    %edi
+  801612:	5d                   	pop    %ebp
+  801613:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801614:	83 ec 0c             	sub    $0xc,%esp
+  801617:	50                   	push   %eax
+  801618:	6a 0d                	push   $0xd
+  80161a:	68 47 47 80 00       	push   $0x804747
+  80161f:	6a 23                	push   $0x23
+  801621:	68 64 47 80 00       	push   $0x804764
+  801626:	e8 8c f2 ff ff       	call   8008b7 <_panic>
+
+0080162b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80162b:	55                   	push   %ebp
+  80162c:	89 e5                	mov    %esp,%ebp
+  80162e:	57                   	push   %edi
+  80162f:	56                   	push   %esi
+  801630:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801631:	ba 00 00 00 00       	mov    $0x0,%edx
+  801636:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80163b:	89 d1                	mov    %edx,%ecx
+  80163d:	89 d3                	mov    %edx,%ebx
+  80163f:	89 d7                	mov    %edx,%edi
+  801641:	55                   	push   %ebp
+  801642:	89 e5                	mov    %esp,%ebp
+  801644:	8d 35 4c 16 80 00    	lea    0x80164c,%esi
+  80164a:	0f 34                	sysenter
+  80164c:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  80164d:	5b                   	pop    %ebx
+  80164e:	5e                   	pop    %esi
+  80164f:	5f                   	pop    %edi
+  801650:	5d                   	pop    %ebp
+  801651:	c3                   	ret
+
+00801652 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  801652:	55                   	push   %ebp
+  801653:	89 e5                	mov    %esp,%ebp
+  801655:	57                   	push   %edi
+  801656:	56                   	push   %esi
+  801657:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801658:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801660:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801663:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801668:	89 df                	mov    %ebx,%edi
+  80166a:	55                   	push   %ebp
+  80166b:	89 e5                	mov    %esp,%ebp
+  80166d:	8d 35 75 16 80 00    	lea    0x801675,%esi
+  801673:	0f 34                	sysenter
+  801675:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  801676:	5b                   	pop    %ebx
+  801677:	5e                   	pop    %esi
+  801678:	5f                   	pop    %edi
+  801679:	5d                   	pop    %ebp
+  80167a:	c3                   	ret
+
+0080167b <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  80167b:	55                   	push   %ebp
+  80167c:	89 e5                	mov    %esp,%ebp
+  80167e:	57                   	push   %edi
+  80167f:	56                   	push   %esi
+  801680:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801681:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801686:	8b 55 08             	mov    0x8(%ebp),%edx
+  801689:	b8 10 00 00 00       	mov    $0x10,%eax
+  80168e:	89 cb                	mov    %ecx,%ebx
+  801690:	89 cf                	mov    %ecx,%edi
+  801692:	55                   	push   %ebp
+  801693:	89 e5                	mov    %esp,%ebp
+  801695:	8d 35 9d 16 80 00    	lea    0x80169d,%esi
+  80169b:	0f 34                	sysenter
+  80169d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  80169e:	5b                   	pop    %ebx
+  80169f:	5e                   	pop    %esi
+  8016a0:	5f                   	pop    %edi
+  8016a1:	5d                   	pop    %ebp
+  8016a2:	c3                   	ret
+
+008016a3 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  8016a3:	55                   	push   %ebp
+  8016a4:	89 e5                	mov    %esp,%ebp
+  8016a6:	57                   	push   %edi
+  8016a7:	56                   	push   %esi
+  8016a8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8016a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b4:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016b9:	89 df                	mov    %ebx,%edi
+  8016bb:	55                   	push   %ebp
+  8016bc:	89 e5                	mov    %esp,%ebp
+  8016be:	8d 35 c6 16 80 00    	lea    0x8016c6,%esi
+  8016c4:	0f 34                	sysenter
+  8016c6:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8016c7:	5b                   	pop    %ebx
+  8016c8:	5e                   	pop    %esi
+  8016c9:	5f                   	pop    %edi
+  8016ca:	5d                   	pop    %ebp
+  8016cb:	c3                   	ret
+
+008016cc <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8016cc:	55                   	push   %ebp
+  8016cd:	89 e5                	mov    %esp,%ebp
+  8016cf:	57                   	push   %edi
+  8016d0:	56                   	push   %esi
+  8016d1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8016d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016dd:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016e2:	89 df                	mov    %ebx,%edi
+  8016e4:	55                   	push   %ebp
+  8016e5:	89 e5                	mov    %esp,%ebp
+  8016e7:	8d 35 ef 16 80 00    	lea    0x8016ef,%esi
+  8016ed:	0f 34                	sysenter
+  8016ef:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  8016f0:	5b                   	pop    %ebx
+  8016f1:	5e                   	pop    %esi
+  8016f2:	5f                   	pop    %edi
+  8016f3:	5d                   	pop    %ebp
+  8016f4:	c3                   	ret
+
+008016f5 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  8016f5:	55                   	push   %ebp
+  8016f6:	89 e5                	mov    %esp,%ebp
+  8016f8:	57                   	push   %edi
+  8016f9:	56                   	push   %esi
+  8016fa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8016fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801701:	b8 13 00 00 00       	mov    $0x13,%eax
+  801706:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801709:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80170c:	55                   	push   %ebp
+  80170d:	89 e5                	mov    %esp,%ebp
+  80170f:	8d 35 17 17 80 00    	lea    0x801717,%esi
+  801715:	0f 34                	sysenter
+  801717:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  801718:	5b                   	pop    %ebx
+  801719:	5e                   	pop    %esi
+  80171a:	5f                   	pop    %edi
+  80171b:	5d                   	pop    %ebp
+  80171c:	c3                   	ret
+
+0080171d <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  80171d:	55                   	push   %ebp
+  80171e:	89 e5                	mov    %esp,%ebp
+  801720:	57                   	push   %edi
+  801721:	56                   	push   %esi
+  801722:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801723:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801728:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801730:	89 cb                	mov    %ecx,%ebx
+  801732:	89 cf                	mov    %ecx,%edi
+  801734:	89 ce                	mov    %ecx,%esi
+  801736:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  801738:	5b                   	pop    %ebx
+  801739:	5e                   	pop    %esi
+  80173a:	5f                   	pop    %edi
+  80173b:	5d                   	pop    %ebp
+  80173c:	c3                   	ret
+
+0080173d <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  80173d:	55                   	push   %ebp
+  80173e:	89 e5                	mov    %esp,%ebp
+  801740:	57                   	push   %edi
+  801741:	56                   	push   %esi
+  801742:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801743:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801748:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801750:	89 cb                	mov    %ecx,%ebx
+  801752:	89 cf                	mov    %ecx,%edi
+  801754:	55                   	push   %ebp
+  801755:	89 e5                	mov    %esp,%ebp
+  801757:	8d 35 5f 17 80 00    	lea    0x80175f,%esi
+  80175d:	0f 34                	sysenter
+  80175f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  801760:	5b                   	pop    %ebx
+  801761:	5e                   	pop    %esi
+  801762:	5f                   	pop    %edi
+  801763:	5d                   	pop    %ebp
+  801764:	c3                   	ret
+
+00801765 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  801765:	55                   	push   %ebp
+  801766:	89 e5                	mov    %esp,%ebp
+  801768:	57                   	push   %edi
+  801769:	56                   	push   %esi
+  80176a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80176b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801770:	8b 55 08             	mov    0x8(%ebp),%edx
+  801773:	b8 16 00 00 00       	mov    $0x16,%eax
+  801778:	89 cb                	mov    %ecx,%ebx
+  80177a:	89 cf                	mov    %ecx,%edi
+  80177c:	55                   	push   %ebp
+  80177d:	89 e5                	mov    %esp,%ebp
+  80177f:	8d 35 87 17 80 00    	lea    0x801787,%esi
+  801785:	0f 34                	sysenter
+  801787:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  801788:	5b                   	pop    %ebx
+  801789:	5e                   	pop    %esi
+  80178a:	5f                   	pop    %edi
+  80178b:	5d                   	pop    %ebp
+  80178c:	c3                   	ret
+
+0080178d <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80178d:	55                   	push   %ebp
+  80178e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801790:	8b 45 08             	mov    0x8(%ebp),%eax
+  801793:	05 00 00 00 30       	add    $0x30000000,%eax
+  801798:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80179b:	5d                   	pop    %ebp
+  80179c:	c3                   	ret
+
+0080179d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80179d:	55                   	push   %ebp
+  80179e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017a3:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017a8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017ad:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017b2:	5d                   	pop    %ebp
+  8017b3:	c3                   	ret
+
+008017b4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017b4:	55                   	push   %ebp
+  8017b5:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8017b7:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8017bc:	eb 02                	jmp    8017c0 <fd_alloc+0xc>
+  8017be:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8017c0:	89 c2                	mov    %eax,%edx
+  8017c2:	c1 ea 16             	shr    $0x16,%edx
+  8017c5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017cc:	f6 c2 01             	test   $0x1,%dl
+  8017cf:	74 2b                	je     8017fc <fd_alloc+0x48>
+  8017d1:	89 c2                	mov    %eax,%edx
+  8017d3:	c1 ea 0c             	shr    $0xc,%edx
+  8017d6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8017dd:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017e3:	f6 c1 01             	test   $0x1,%cl
+  8017e6:	74 14                	je     8017fc <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8017e8:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8017ee:	75 ce                	jne    8017be <fd_alloc+0xa>
+  8017f0:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8017f5:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8017fa:	eb 05                	jmp    801801 <fd_alloc+0x4d>
+			return 0;
+  8017fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801801:	8b 55 08             	mov    0x8(%ebp),%edx
+  801804:	89 02                	mov    %eax,(%edx)
+}
+  801806:	89 c8                	mov    %ecx,%eax
+  801808:	5d                   	pop    %ebp
+  801809:	c3                   	ret
+
+0080180a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80180a:	55                   	push   %ebp
+  80180b:	89 e5                	mov    %esp,%ebp
+  80180d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801810:	83 f8 1f             	cmp    $0x1f,%eax
+  801813:	77 30                	ja     801845 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801815:	c1 e0 0c             	shl    $0xc,%eax
+  801818:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80181d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801823:	f6 c2 01             	test   $0x1,%dl
+  801826:	74 24                	je     80184c <fd_lookup+0x42>
+  801828:	89 c2                	mov    %eax,%edx
+  80182a:	c1 ea 0c             	shr    $0xc,%edx
+  80182d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801834:	f6 c2 01             	test   $0x1,%dl
+  801837:	74 1a                	je     801853 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801839:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80183c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80183e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801843:	5d                   	pop    %ebp
+  801844:	c3                   	ret
+		return -E_INVAL;
+  801845:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80184a:	eb f7                	jmp    801843 <fd_lookup+0x39>
+		return -E_INVAL;
+  80184c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801851:	eb f0                	jmp    801843 <fd_lookup+0x39>
+  801853:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801858:	eb e9                	jmp    801843 <fd_lookup+0x39>
+
+0080185a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80185a:	55                   	push   %ebp
+  80185b:	89 e5                	mov    %esp,%ebp
+  80185d:	53                   	push   %ebx
+  80185e:	83 ec 04             	sub    $0x4,%esp
+  801861:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801864:	b8 00 00 00 00       	mov    $0x0,%eax
+  801869:	eb 03                	jmp    80186e <dev_lookup+0x14>
+  80186b:	83 c0 01             	add    $0x1,%eax
+  80186e:	8b 1c 85 f0 47 80 00 	mov    0x8047f0(,%eax,4),%ebx
+  801875:	85 db                	test   %ebx,%ebx
+  801877:	74 0b                	je     801884 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801879:	39 13                	cmp    %edx,(%ebx)
+  80187b:	75 ee                	jne    80186b <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80187d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801882:	eb 1f                	jmp    8018a3 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801884:	a1 10 80 80 00       	mov    0x808010,%eax
+  801889:	8b 40 48             	mov    0x48(%eax),%eax
+  80188c:	83 ec 04             	sub    $0x4,%esp
+  80188f:	52                   	push   %edx
+  801890:	50                   	push   %eax
+  801891:	68 74 47 80 00       	push   $0x804774
+  801896:	e8 f7 f0 ff ff       	call   800992 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80189b:	83 c4 10             	add    $0x10,%esp
+  80189e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018a6:	89 1a                	mov    %ebx,(%edx)
+}
+  8018a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ab:	c9                   	leave
+  8018ac:	c3                   	ret
+
+008018ad <fd_close>:
+{
+  8018ad:	55                   	push   %ebp
+  8018ae:	89 e5                	mov    %esp,%ebp
+  8018b0:	57                   	push   %edi
+  8018b1:	56                   	push   %esi
+  8018b2:	53                   	push   %ebx
+  8018b3:	83 ec 24             	sub    $0x24,%esp
+  8018b6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018b9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018bc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018bf:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018c0:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018c6:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018c9:	50                   	push   %eax
+  8018ca:	e8 3b ff ff ff       	call   80180a <fd_lookup>
+  8018cf:	89 c3                	mov    %eax,%ebx
+  8018d1:	83 c4 10             	add    $0x10,%esp
+  8018d4:	85 c0                	test   %eax,%eax
+  8018d6:	78 05                	js     8018dd <fd_close+0x30>
+	    || fd != fd2)
+  8018d8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8018db:	74 16                	je     8018f3 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8018dd:	89 f8                	mov    %edi,%eax
+  8018df:	84 c0                	test   %al,%al
+  8018e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e6:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8018e9:	89 d8                	mov    %ebx,%eax
+  8018eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ee:	5b                   	pop    %ebx
+  8018ef:	5e                   	pop    %esi
+  8018f0:	5f                   	pop    %edi
+  8018f1:	5d                   	pop    %ebp
+  8018f2:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018f3:	83 ec 08             	sub    $0x8,%esp
+  8018f6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8018f9:	50                   	push   %eax
+  8018fa:	ff 36                	push   (%esi)
+  8018fc:	e8 59 ff ff ff       	call   80185a <dev_lookup>
+  801901:	89 c3                	mov    %eax,%ebx
+  801903:	83 c4 10             	add    $0x10,%esp
+  801906:	85 c0                	test   %eax,%eax
+  801908:	78 1a                	js     801924 <fd_close+0x77>
+		if (dev->dev_close)
+  80190a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80190d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801910:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801915:	85 c0                	test   %eax,%eax
+  801917:	74 0b                	je     801924 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801919:	83 ec 0c             	sub    $0xc,%esp
+  80191c:	56                   	push   %esi
+  80191d:	ff d0                	call   *%eax
+  80191f:	89 c3                	mov    %eax,%ebx
+  801921:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801924:	83 ec 08             	sub    $0x8,%esp
+  801927:	56                   	push   %esi
+  801928:	6a 00                	push   $0x0
+  80192a:	e8 ea fa ff ff       	call   801419 <sys_page_unmap>
+	return r;
+  80192f:	83 c4 10             	add    $0x10,%esp
+  801932:	eb b5                	jmp    8018e9 <fd_close+0x3c>
+
+00801934 <close>:
+
+int
+close(int fdnum)
+{
+  801934:	55                   	push   %ebp
+  801935:	89 e5                	mov    %esp,%ebp
+  801937:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80193a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80193d:	50                   	push   %eax
+  80193e:	ff 75 08             	push   0x8(%ebp)
+  801941:	e8 c4 fe ff ff       	call   80180a <fd_lookup>
+  801946:	83 c4 10             	add    $0x10,%esp
+  801949:	85 c0                	test   %eax,%eax
+  80194b:	79 02                	jns    80194f <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80194d:	c9                   	leave
+  80194e:	c3                   	ret
+		return fd_close(fd, 1);
+  80194f:	83 ec 08             	sub    $0x8,%esp
+  801952:	6a 01                	push   $0x1
+  801954:	ff 75 f4             	push   -0xc(%ebp)
+  801957:	e8 51 ff ff ff       	call   8018ad <fd_close>
+  80195c:	83 c4 10             	add    $0x10,%esp
+  80195f:	eb ec                	jmp    80194d <close+0x19>
+
+00801961 <close_all>:
+
+void
+close_all(void)
+{
+  801961:	55                   	push   %ebp
+  801962:	89 e5                	mov    %esp,%ebp
+  801964:	53                   	push   %ebx
+  801965:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801968:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80196d:	83 ec 0c             	sub    $0xc,%esp
+  801970:	53                   	push   %ebx
+  801971:	e8 be ff ff ff       	call   801934 <close>
+	for (i = 0; i < MAXFD; i++)
+  801976:	83 c3 01             	add    $0x1,%ebx
+  801979:	83 c4 10             	add    $0x10,%esp
+  80197c:	83 fb 20             	cmp    $0x20,%ebx
+  80197f:	75 ec                	jne    80196d <close_all+0xc>
+}
+  801981:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801984:	c9                   	leave
+  801985:	c3                   	ret
+
+00801986 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801986:	55                   	push   %ebp
+  801987:	89 e5                	mov    %esp,%ebp
+  801989:	57                   	push   %edi
+  80198a:	56                   	push   %esi
+  80198b:	53                   	push   %ebx
+  80198c:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80198f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801992:	50                   	push   %eax
+  801993:	ff 75 08             	push   0x8(%ebp)
+  801996:	e8 6f fe ff ff       	call   80180a <fd_lookup>
+  80199b:	89 c3                	mov    %eax,%ebx
+  80199d:	83 c4 10             	add    $0x10,%esp
+  8019a0:	85 c0                	test   %eax,%eax
+  8019a2:	78 7f                	js     801a23 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8019a4:	83 ec 0c             	sub    $0xc,%esp
+  8019a7:	ff 75 0c             	push   0xc(%ebp)
+  8019aa:	e8 85 ff ff ff       	call   801934 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019af:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019b2:	c1 e6 0c             	shl    $0xc,%esi
+  8019b5:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8019bb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019be:	89 3c 24             	mov    %edi,(%esp)
+  8019c1:	e8 d7 fd ff ff       	call   80179d <fd2data>
+  8019c6:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8019c8:	89 34 24             	mov    %esi,(%esp)
+  8019cb:	e8 cd fd ff ff       	call   80179d <fd2data>
+  8019d0:	83 c4 10             	add    $0x10,%esp
+  8019d3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8019d6:	89 d8                	mov    %ebx,%eax
+  8019d8:	c1 e8 16             	shr    $0x16,%eax
+  8019db:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8019e2:	a8 01                	test   $0x1,%al
+  8019e4:	74 11                	je     8019f7 <dup+0x71>
+  8019e6:	89 d8                	mov    %ebx,%eax
+  8019e8:	c1 e8 0c             	shr    $0xc,%eax
+  8019eb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8019f2:	f6 c2 01             	test   $0x1,%dl
+  8019f5:	75 36                	jne    801a2d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8019f7:	89 f8                	mov    %edi,%eax
+  8019f9:	c1 e8 0c             	shr    $0xc,%eax
+  8019fc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a03:	83 ec 0c             	sub    $0xc,%esp
+  801a06:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a0b:	50                   	push   %eax
+  801a0c:	56                   	push   %esi
+  801a0d:	6a 00                	push   $0x0
+  801a0f:	57                   	push   %edi
+  801a10:	6a 00                	push   $0x0
+  801a12:	e8 c0 f9 ff ff       	call   8013d7 <sys_page_map>
+  801a17:	89 c3                	mov    %eax,%ebx
+  801a19:	83 c4 20             	add    $0x20,%esp
+  801a1c:	85 c0                	test   %eax,%eax
+  801a1e:	78 33                	js     801a53 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a20:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a23:	89 d8                	mov    %ebx,%eax
+  801a25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a28:	5b                   	pop    %ebx
+  801a29:	5e                   	pop    %esi
+  801a2a:	5f                   	pop    %edi
+  801a2b:	5d                   	pop    %ebp
+  801a2c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a2d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a34:	83 ec 0c             	sub    $0xc,%esp
+  801a37:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a3c:	50                   	push   %eax
+  801a3d:	ff 75 d4             	push   -0x2c(%ebp)
+  801a40:	6a 00                	push   $0x0
+  801a42:	53                   	push   %ebx
+  801a43:	6a 00                	push   $0x0
+  801a45:	e8 8d f9 ff ff       	call   8013d7 <sys_page_map>
+  801a4a:	89 c3                	mov    %eax,%ebx
+  801a4c:	83 c4 20             	add    $0x20,%esp
+  801a4f:	85 c0                	test   %eax,%eax
+  801a51:	79 a4                	jns    8019f7 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a53:	83 ec 08             	sub    $0x8,%esp
+  801a56:	56                   	push   %esi
+  801a57:	6a 00                	push   $0x0
+  801a59:	e8 bb f9 ff ff       	call   801419 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a5e:	83 c4 08             	add    $0x8,%esp
+  801a61:	ff 75 d4             	push   -0x2c(%ebp)
+  801a64:	6a 00                	push   $0x0
+  801a66:	e8 ae f9 ff ff       	call   801419 <sys_page_unmap>
+	return r;
+  801a6b:	83 c4 10             	add    $0x10,%esp
+  801a6e:	eb b3                	jmp    801a23 <dup+0x9d>
+
+00801a70 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a70:	55                   	push   %ebp
+  801a71:	89 e5                	mov    %esp,%ebp
+  801a73:	56                   	push   %esi
+  801a74:	53                   	push   %ebx
+  801a75:	83 ec 18             	sub    $0x18,%esp
+  801a78:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a7b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a7e:	50                   	push   %eax
+  801a7f:	56                   	push   %esi
+  801a80:	e8 85 fd ff ff       	call   80180a <fd_lookup>
+  801a85:	83 c4 10             	add    $0x10,%esp
+  801a88:	85 c0                	test   %eax,%eax
+  801a8a:	78 3c                	js     801ac8 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a8c:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801a8f:	83 ec 08             	sub    $0x8,%esp
+  801a92:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a95:	50                   	push   %eax
+  801a96:	ff 33                	push   (%ebx)
+  801a98:	e8 bd fd ff ff       	call   80185a <dev_lookup>
+  801a9d:	83 c4 10             	add    $0x10,%esp
+  801aa0:	85 c0                	test   %eax,%eax
+  801aa2:	78 24                	js     801ac8 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801aa4:	8b 43 08             	mov    0x8(%ebx),%eax
+  801aa7:	83 e0 03             	and    $0x3,%eax
+  801aaa:	83 f8 01             	cmp    $0x1,%eax
+  801aad:	74 20                	je     801acf <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801aaf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ab2:	8b 40 08             	mov    0x8(%eax),%eax
+  801ab5:	85 c0                	test   %eax,%eax
+  801ab7:	74 37                	je     801af0 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801ab9:	83 ec 04             	sub    $0x4,%esp
+  801abc:	ff 75 10             	push   0x10(%ebp)
+  801abf:	ff 75 0c             	push   0xc(%ebp)
+  801ac2:	53                   	push   %ebx
+  801ac3:	ff d0                	call   *%eax
+  801ac5:	83 c4 10             	add    $0x10,%esp
+}
+  801ac8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801acb:	5b                   	pop    %ebx
+  801acc:	5e                   	pop    %esi
+  801acd:	5d                   	pop    %ebp
+  801ace:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801acf:	a1 10 80 80 00       	mov    0x808010,%eax
+  801ad4:	8b 40 48             	mov    0x48(%eax),%eax
+  801ad7:	83 ec 04             	sub    $0x4,%esp
+  801ada:	56                   	push   %esi
+  801adb:	50                   	push   %eax
+  801adc:	68 b5 47 80 00       	push   $0x8047b5
+  801ae1:	e8 ac ee ff ff       	call   800992 <cprintf>
+		return -E_INVAL;
+  801ae6:	83 c4 10             	add    $0x10,%esp
+  801ae9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aee:	eb d8                	jmp    801ac8 <read+0x58>
+		return -E_NOT_SUPP;
+  801af0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801af5:	eb d1                	jmp    801ac8 <read+0x58>
+
+00801af7 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801af7:	55                   	push   %ebp
+  801af8:	89 e5                	mov    %esp,%ebp
+  801afa:	57                   	push   %edi
+  801afb:	56                   	push   %esi
+  801afc:	53                   	push   %ebx
+  801afd:	83 ec 0c             	sub    $0xc,%esp
+  801b00:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b03:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b0b:	eb 02                	jmp    801b0f <readn+0x18>
+  801b0d:	01 c3                	add    %eax,%ebx
+  801b0f:	39 f3                	cmp    %esi,%ebx
+  801b11:	73 21                	jae    801b34 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b13:	83 ec 04             	sub    $0x4,%esp
+  801b16:	89 f0                	mov    %esi,%eax
+  801b18:	29 d8                	sub    %ebx,%eax
+  801b1a:	50                   	push   %eax
+  801b1b:	89 d8                	mov    %ebx,%eax
+  801b1d:	03 45 0c             	add    0xc(%ebp),%eax
+  801b20:	50                   	push   %eax
+  801b21:	57                   	push   %edi
+  801b22:	e8 49 ff ff ff       	call   801a70 <read>
+		if (m < 0)
+  801b27:	83 c4 10             	add    $0x10,%esp
+  801b2a:	85 c0                	test   %eax,%eax
+  801b2c:	78 04                	js     801b32 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b2e:	75 dd                	jne    801b0d <readn+0x16>
+  801b30:	eb 02                	jmp    801b34 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b32:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b34:	89 d8                	mov    %ebx,%eax
+  801b36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b39:	5b                   	pop    %ebx
+  801b3a:	5e                   	pop    %esi
+  801b3b:	5f                   	pop    %edi
+  801b3c:	5d                   	pop    %ebp
+  801b3d:	c3                   	ret
+
+00801b3e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b3e:	55                   	push   %ebp
+  801b3f:	89 e5                	mov    %esp,%ebp
+  801b41:	56                   	push   %esi
+  801b42:	53                   	push   %ebx
+  801b43:	83 ec 18             	sub    $0x18,%esp
+  801b46:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b49:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b4c:	50                   	push   %eax
+  801b4d:	53                   	push   %ebx
+  801b4e:	e8 b7 fc ff ff       	call   80180a <fd_lookup>
+  801b53:	83 c4 10             	add    $0x10,%esp
+  801b56:	85 c0                	test   %eax,%eax
+  801b58:	78 37                	js     801b91 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b5a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b5d:	83 ec 08             	sub    $0x8,%esp
+  801b60:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b63:	50                   	push   %eax
+  801b64:	ff 36                	push   (%esi)
+  801b66:	e8 ef fc ff ff       	call   80185a <dev_lookup>
+  801b6b:	83 c4 10             	add    $0x10,%esp
+  801b6e:	85 c0                	test   %eax,%eax
+  801b70:	78 1f                	js     801b91 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b72:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b76:	74 20                	je     801b98 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801b78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b7b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b7e:	85 c0                	test   %eax,%eax
+  801b80:	74 37                	je     801bb9 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801b82:	83 ec 04             	sub    $0x4,%esp
+  801b85:	ff 75 10             	push   0x10(%ebp)
+  801b88:	ff 75 0c             	push   0xc(%ebp)
+  801b8b:	56                   	push   %esi
+  801b8c:	ff d0                	call   *%eax
+  801b8e:	83 c4 10             	add    $0x10,%esp
+}
+  801b91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b94:	5b                   	pop    %ebx
+  801b95:	5e                   	pop    %esi
+  801b96:	5d                   	pop    %ebp
+  801b97:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b98:	a1 10 80 80 00       	mov    0x808010,%eax
+  801b9d:	8b 40 48             	mov    0x48(%eax),%eax
+  801ba0:	83 ec 04             	sub    $0x4,%esp
+  801ba3:	53                   	push   %ebx
+  801ba4:	50                   	push   %eax
+  801ba5:	68 d1 47 80 00       	push   $0x8047d1
+  801baa:	e8 e3 ed ff ff       	call   800992 <cprintf>
+		return -E_INVAL;
+  801baf:	83 c4 10             	add    $0x10,%esp
+  801bb2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bb7:	eb d8                	jmp    801b91 <write+0x53>
+		return -E_NOT_SUPP;
+  801bb9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bbe:	eb d1                	jmp    801b91 <write+0x53>
+
+00801bc0 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801bc0:	55                   	push   %ebp
+  801bc1:	89 e5                	mov    %esp,%ebp
+  801bc3:	53                   	push   %ebx
+  801bc4:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bc7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bca:	50                   	push   %eax
+  801bcb:	ff 75 08             	push   0x8(%ebp)
+  801bce:	e8 37 fc ff ff       	call   80180a <fd_lookup>
+  801bd3:	83 c4 10             	add    $0x10,%esp
+  801bd6:	85 c0                	test   %eax,%eax
+  801bd8:	78 3a                	js     801c14 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bda:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801bdd:	83 ec 08             	sub    $0x8,%esp
+  801be0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801be3:	50                   	push   %eax
+  801be4:	ff 33                	push   (%ebx)
+  801be6:	e8 6f fc ff ff       	call   80185a <dev_lookup>
+  801beb:	83 c4 10             	add    $0x10,%esp
+  801bee:	85 c0                	test   %eax,%eax
+  801bf0:	78 22                	js     801c14 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801bf2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bf5:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801bf8:	85 c0                	test   %eax,%eax
+  801bfa:	74 0d                	je     801c09 <seek+0x49>
+  801bfc:	83 ec 0c             	sub    $0xc,%esp
+  801bff:	53                   	push   %ebx
+  801c00:	ff d0                	call   *%eax
+  801c02:	83 c4 10             	add    $0x10,%esp
+  801c05:	85 c0                	test   %eax,%eax
+  801c07:	78 0b                	js     801c14 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801c09:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c0c:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c17:	c9                   	leave
+  801c18:	c3                   	ret
+
+00801c19 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801c19:	55                   	push   %ebp
+  801c1a:	89 e5                	mov    %esp,%ebp
+  801c1c:	53                   	push   %ebx
+  801c1d:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c20:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c23:	50                   	push   %eax
+  801c24:	ff 75 08             	push   0x8(%ebp)
+  801c27:	e8 de fb ff ff       	call   80180a <fd_lookup>
+  801c2c:	83 c4 10             	add    $0x10,%esp
+  801c2f:	85 c0                	test   %eax,%eax
+  801c31:	78 2b                	js     801c5e <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c33:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801c36:	83 ec 08             	sub    $0x8,%esp
+  801c39:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c3c:	50                   	push   %eax
+  801c3d:	ff 33                	push   (%ebx)
+  801c3f:	e8 16 fc ff ff       	call   80185a <dev_lookup>
+  801c44:	83 c4 10             	add    $0x10,%esp
+  801c47:	85 c0                	test   %eax,%eax
+  801c49:	78 13                	js     801c5e <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801c4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c4e:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801c51:	85 c0                	test   %eax,%eax
+  801c53:	74 0e                	je     801c63 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801c55:	83 ec 0c             	sub    $0xc,%esp
+  801c58:	53                   	push   %ebx
+  801c59:	ff d0                	call   *%eax
+  801c5b:	83 c4 10             	add    $0x10,%esp
+}
+  801c5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c61:	c9                   	leave
+  801c62:	c3                   	ret
+		return 0;
+  801c63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c68:	eb f4                	jmp    801c5e <fsync+0x45>
+
+00801c6a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c6a:	55                   	push   %ebp
+  801c6b:	89 e5                	mov    %esp,%ebp
+  801c6d:	56                   	push   %esi
+  801c6e:	53                   	push   %ebx
+  801c6f:	83 ec 18             	sub    $0x18,%esp
+  801c72:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c75:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c78:	50                   	push   %eax
+  801c79:	53                   	push   %ebx
+  801c7a:	e8 8b fb ff ff       	call   80180a <fd_lookup>
+  801c7f:	83 c4 10             	add    $0x10,%esp
+  801c82:	85 c0                	test   %eax,%eax
+  801c84:	78 34                	js     801cba <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c86:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c89:	83 ec 08             	sub    $0x8,%esp
+  801c8c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c8f:	50                   	push   %eax
+  801c90:	ff 36                	push   (%esi)
+  801c92:	e8 c3 fb ff ff       	call   80185a <dev_lookup>
+  801c97:	83 c4 10             	add    $0x10,%esp
+  801c9a:	85 c0                	test   %eax,%eax
+  801c9c:	78 1c                	js     801cba <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c9e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ca2:	74 1d                	je     801cc1 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801ca4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ca7:	8b 40 18             	mov    0x18(%eax),%eax
+  801caa:	85 c0                	test   %eax,%eax
+  801cac:	74 34                	je     801ce2 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801cae:	83 ec 08             	sub    $0x8,%esp
+  801cb1:	ff 75 0c             	push   0xc(%ebp)
+  801cb4:	56                   	push   %esi
+  801cb5:	ff d0                	call   *%eax
+  801cb7:	83 c4 10             	add    $0x10,%esp
+}
+  801cba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cbd:	5b                   	pop    %ebx
+  801cbe:	5e                   	pop    %esi
+  801cbf:	5d                   	pop    %ebp
+  801cc0:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801cc1:	a1 10 80 80 00       	mov    0x808010,%eax
+  801cc6:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cc9:	83 ec 04             	sub    $0x4,%esp
+  801ccc:	53                   	push   %ebx
+  801ccd:	50                   	push   %eax
+  801cce:	68 94 47 80 00       	push   $0x804794
+  801cd3:	e8 ba ec ff ff       	call   800992 <cprintf>
+		return -E_INVAL;
+  801cd8:	83 c4 10             	add    $0x10,%esp
+  801cdb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ce0:	eb d8                	jmp    801cba <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801ce2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ce7:	eb d1                	jmp    801cba <ftruncate+0x50>
+
+00801ce9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ce9:	55                   	push   %ebp
+  801cea:	89 e5                	mov    %esp,%ebp
+  801cec:	56                   	push   %esi
+  801ced:	53                   	push   %ebx
+  801cee:	83 ec 18             	sub    $0x18,%esp
+  801cf1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cf4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cf7:	50                   	push   %eax
+  801cf8:	ff 75 08             	push   0x8(%ebp)
+  801cfb:	e8 0a fb ff ff       	call   80180a <fd_lookup>
+  801d00:	83 c4 10             	add    $0x10,%esp
+  801d03:	85 c0                	test   %eax,%eax
+  801d05:	78 49                	js     801d50 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d07:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d0a:	83 ec 08             	sub    $0x8,%esp
+  801d0d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d10:	50                   	push   %eax
+  801d11:	ff 36                	push   (%esi)
+  801d13:	e8 42 fb ff ff       	call   80185a <dev_lookup>
+  801d18:	83 c4 10             	add    $0x10,%esp
+  801d1b:	85 c0                	test   %eax,%eax
+  801d1d:	78 31                	js     801d50 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d22:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d26:	74 2f                	je     801d57 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d28:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d2b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d32:	00 00 00 
+	stat->st_isdir = 0;
+  801d35:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d3c:	00 00 00 
+	stat->st_dev = dev;
+  801d3f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d45:	83 ec 08             	sub    $0x8,%esp
+  801d48:	53                   	push   %ebx
+  801d49:	56                   	push   %esi
+  801d4a:	ff 50 14             	call   *0x14(%eax)
+  801d4d:	83 c4 10             	add    $0x10,%esp
+}
+  801d50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d53:	5b                   	pop    %ebx
+  801d54:	5e                   	pop    %esi
+  801d55:	5d                   	pop    %ebp
+  801d56:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d57:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d5c:	eb f2                	jmp    801d50 <fstat+0x67>
+
+00801d5e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d5e:	55                   	push   %ebp
+  801d5f:	89 e5                	mov    %esp,%ebp
+  801d61:	56                   	push   %esi
+  801d62:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801d63:	83 ec 08             	sub    $0x8,%esp
+  801d66:	68 00 10 00 00       	push   $0x1000
+  801d6b:	ff 75 08             	push   0x8(%ebp)
+  801d6e:	e8 b3 07 00 00       	call   802526 <open>
+  801d73:	89 c3                	mov    %eax,%ebx
+  801d75:	83 c4 10             	add    $0x10,%esp
+  801d78:	85 c0                	test   %eax,%eax
+  801d7a:	78 1b                	js     801d97 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801d7c:	83 ec 08             	sub    $0x8,%esp
+  801d7f:	ff 75 0c             	push   0xc(%ebp)
+  801d82:	50                   	push   %eax
+  801d83:	e8 61 ff ff ff       	call   801ce9 <fstat>
+  801d88:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801d8a:	89 1c 24             	mov    %ebx,(%esp)
+  801d8d:	e8 a2 fb ff ff       	call   801934 <close>
+	return r;
+  801d92:	83 c4 10             	add    $0x10,%esp
+  801d95:	89 f3                	mov    %esi,%ebx
+}
+  801d97:	89 d8                	mov    %ebx,%eax
+  801d99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d9c:	5b                   	pop    %ebx
+  801d9d:	5e                   	pop    %esi
+  801d9e:	5d                   	pop    %ebp
+  801d9f:	c3                   	ret
+
+00801da0 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801da0:	55                   	push   %ebp
+  801da1:	89 e5                	mov    %esp,%ebp
+  801da3:	57                   	push   %edi
+  801da4:	56                   	push   %esi
+  801da5:	53                   	push   %ebx
+  801da6:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801dac:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801db2:	89 d6                	mov    %edx,%esi
+  801db4:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801dba:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801dbd:	89 d3                	mov    %edx,%ebx
+  801dbf:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801dc5:	83 3d c8 a0 80 00 00 	cmpl   $0x0,0x80a0c8
+  801dcc:	74 1d                	je     801deb <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801dce:	b8 00 90 80 00       	mov    $0x809000,%eax
+  801dd3:	83 c8 07             	or     $0x7,%eax
+  801dd6:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801ddc:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801de1:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801de7:	01 ce                	add    %ecx,%esi
+  801de9:	eb 28                	jmp    801e13 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801deb:	83 ec 0c             	sub    $0xc,%esp
+  801dee:	6a 01                	push   $0x1
+  801df0:	e8 88 20 00 00       	call   803e7d <ipc_find_env>
+  801df5:	a3 c8 a0 80 00       	mov    %eax,0x80a0c8
+  801dfa:	83 c4 10             	add    $0x10,%esp
+  801dfd:	eb cf                	jmp    801dce <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801dff:	83 c0 01             	add    $0x1,%eax
+  801e02:	89 fa                	mov    %edi,%edx
+  801e04:	09 da                	or     %ebx,%edx
+  801e06:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801e0d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e13:	39 f3                	cmp    %esi,%ebx
+  801e15:	72 e8                	jb     801dff <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801e17:	83 f8 41             	cmp    $0x41,%eax
+  801e1a:	77 2f                	ja     801e4b <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801e1c:	50                   	push   %eax
+  801e1d:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801e23:	50                   	push   %eax
+  801e24:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801e2a:	ff 35 c8 a0 80 00    	push   0x80a0c8
+  801e30:	e8 fa 1f 00 00       	call   803e2f <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801e35:	83 c4 0c             	add    $0xc,%esp
+  801e38:	6a 00                	push   $0x0
+  801e3a:	6a 00                	push   $0x0
+  801e3c:	6a 00                	push   $0x0
+  801e3e:	e8 96 1e 00 00       	call   803cd9 <ipc_recv>
+}
+  801e43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e46:	5b                   	pop    %ebx
+  801e47:	5e                   	pop    %esi
+  801e48:	5f                   	pop    %edi
+  801e49:	5d                   	pop    %ebp
+  801e4a:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801e4b:	68 04 48 80 00       	push   $0x804804
+  801e50:	68 20 48 80 00       	push   $0x804820
+  801e55:	6a 40                	push   $0x40
+  801e57:	68 35 48 80 00       	push   $0x804835
+  801e5c:	e8 56 ea ff ff       	call   8008b7 <_panic>
+
+00801e61 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801e61:	55                   	push   %ebp
+  801e62:	89 e5                	mov    %esp,%ebp
+  801e64:	57                   	push   %edi
+  801e65:	56                   	push   %esi
+  801e66:	53                   	push   %ebx
+  801e67:	83 ec 1c             	sub    $0x1c,%esp
+  801e6a:	89 c3                	mov    %eax,%ebx
+  801e6c:	89 d6                	mov    %edx,%esi
+  801e6e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801e71:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801e77:	89 ca                	mov    %ecx,%edx
+  801e79:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801e7c:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801e83:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801e86:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801e8d:	8b 76 0c             	mov    0xc(%esi),%esi
+  801e90:	89 fb                	mov    %edi,%ebx
+  801e92:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801e99:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e9c:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801ea3:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ea6:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801ead:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801eb0:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801eb7:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801eba:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801ec1:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801ec6:	39 c8                	cmp    %ecx,%eax
+  801ec8:	74 0d                	je     801ed7 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801eca:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ecf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ed2:	5b                   	pop    %ebx
+  801ed3:	5e                   	pop    %esi
+  801ed4:	5f                   	pop    %edi
+  801ed5:	5d                   	pop    %ebp
+  801ed6:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ed7:	6a 07                	push   $0x7
+  801ed9:	68 00 90 80 00       	push   $0x809000
+  801ede:	6a 0d                	push   $0xd
+  801ee0:	ff 35 c8 a0 80 00    	push   0x80a0c8
+  801ee6:	e8 59 1e 00 00       	call   803d44 <ipc_send>
+  801eeb:	83 c4 10             	add    $0x10,%esp
+  801eee:	eb da                	jmp    801eca <fsring_post+0x69>
+
+00801ef0 <fsipcv>:
+{
+  801ef0:	55                   	push   %ebp
+  801ef1:	89 e5                	mov    %esp,%ebp
+  801ef3:	57                   	push   %edi
+  801ef4:	56                   	push   %esi
+  801ef5:	53                   	push   %ebx
+  801ef6:	83 ec 0c             	sub    $0xc,%esp
+  801ef9:	89 c7                	mov    %eax,%edi
+  801efb:	89 d3                	mov    %edx,%ebx
+  801efd:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801eff:	83 3d c8 a0 80 00 00 	cmpl   $0x0,0x80a0c8
+  801f06:	74 26                	je     801f2e <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f08:	6a 07                	push   $0x7
+  801f0a:	68 00 90 80 00       	push   $0x809000
+  801f0f:	57                   	push   %edi
+  801f10:	ff 35 c8 a0 80 00    	push   0x80a0c8
+  801f16:	e8 29 1e 00 00       	call   803d44 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801f1b:	6a 00                	push   $0x0
+  801f1d:	56                   	push   %esi
+  801f1e:	53                   	push   %ebx
+  801f1f:	6a 00                	push   $0x0
+  801f21:	e8 76 1e 00 00       	call   803d9c <ipc_recvv>
+}
+  801f26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f29:	5b                   	pop    %ebx
+  801f2a:	5e                   	pop    %esi
+  801f2b:	5f                   	pop    %edi
+  801f2c:	5d                   	pop    %ebp
+  801f2d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f2e:	83 ec 0c             	sub    $0xc,%esp
+  801f31:	6a 01                	push   $0x1
+  801f33:	e8 45 1f 00 00       	call   803e7d <ipc_find_env>
+  801f38:	a3 c8 a0 80 00       	mov    %eax,0x80a0c8
+  801f3d:	83 c4 10             	add    $0x10,%esp
+  801f40:	eb c6                	jmp    801f08 <fsipcv+0x18>
+
+00801f42 <fsipc>:
+{
+  801f42:	55                   	push   %ebp
+  801f43:	89 e5                	mov    %esp,%ebp
+  801f45:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801f48:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801f4f:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801f52:	e8 99 ff ff ff       	call   801ef0 <fsipcv>
+}
+  801f57:	c9                   	leave
+  801f58:	c3                   	ret
+
+00801f59 <file_write_direct>:
+{
+  801f59:	55                   	push   %ebp
+  801f5a:	89 e5                	mov    %esp,%ebp
+  801f5c:	56                   	push   %esi
+  801f5d:	53                   	push   %ebx
+  801f5e:	89 c3                	mov    %eax,%ebx
+  801f60:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801f62:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801f68:	77 40                	ja     801faa <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801f6a:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801f6f:	39 c8                	cmp    %ecx,%eax
+  801f71:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f74:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801f77:	89 0d 00 90 80 00    	mov    %ecx,0x809000
+	fsipcbuf.write.req_n = n;
+  801f7d:	a3 04 90 80 00       	mov    %eax,0x809004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801f82:	83 ec 04             	sub    $0x4,%esp
+  801f85:	50                   	push   %eax
+  801f86:	52                   	push   %edx
+  801f87:	68 08 90 80 00       	push   $0x809008
+  801f8c:	e8 75 f1 ff ff       	call   801106 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801f91:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f96:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f9b:	e8 a2 ff ff ff       	call   801f42 <fsipc>
+  801fa0:	83 c4 10             	add    $0x10,%esp
+}
+  801fa3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fa6:	5b                   	pop    %ebx
+  801fa7:	5e                   	pop    %esi
+  801fa8:	5d                   	pop    %ebp
+  801fa9:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801faa:	89 d6                	mov    %edx,%esi
+  801fac:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801fb2:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801fb7:	29 f1                	sub    %esi,%ecx
+  801fb9:	39 c1                	cmp    %eax,%ecx
+  801fbb:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801fbe:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801fc1:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.bulk.req_n = n;
+  801fc6:	89 0d 04 90 80 00    	mov    %ecx,0x809004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801fcc:	89 35 08 90 80 00    	mov    %esi,0x809008
+	return fsipc_pages(type, buf, n, perm);
+  801fd2:	83 ec 0c             	sub    $0xc,%esp
+  801fd5:	6a 05                	push   $0x5
+  801fd7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801fdc:	e8 bf fd ff ff       	call   801da0 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801fe1:	83 c4 10             	add    $0x10,%esp
+  801fe4:	eb bd                	jmp    801fa3 <file_write_direct+0x4a>
+
+00801fe6 <devfile_sync>:
+{
+  801fe6:	55                   	push   %ebp
+  801fe7:	89 e5                	mov    %esp,%ebp
+  801fe9:	57                   	push   %edi
+  801fea:	56                   	push   %esi
+  801feb:	53                   	push   %ebx
+  801fec:	83 ec 28             	sub    $0x28,%esp
+  801fef:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801ff2:	56                   	push   %esi
+  801ff3:	e8 a5 f7 ff ff       	call   80179d <fd2data>
+  801ff8:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801ffa:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801ffd:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  802004:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802007:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  80200c:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802010:	74 45                	je     802057 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  802012:	8b 46 14             	mov    0x14(%esi),%eax
+  802015:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  802018:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802022:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  802025:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  802028:	39 cb                	cmp    %ecx,%ebx
+  80202a:	73 14                	jae    802040 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  80202c:	29 d9                	sub    %ebx,%ecx
+  80202e:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802031:	89 f0                	mov    %esi,%eax
+  802033:	e8 21 ff ff ff       	call   801f59 <file_write_direct>
+  802038:	85 c0                	test   %eax,%eax
+  80203a:	7e 04                	jle    802040 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80203c:	01 c3                	add    %eax,%ebx
+  80203e:	eb e5                	jmp    802025 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  802040:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802043:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  80204a:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  80204d:	85 c0                	test   %eax,%eax
+  80204f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802054:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802057:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80205a:	5b                   	pop    %ebx
+  80205b:	5e                   	pop    %esi
+  80205c:	5f                   	pop    %edi
+  80205d:	5d                   	pop    %ebp
+  80205e:	c3                   	ret
+
+0080205f <devfile_write>:
+{
+  80205f:	55                   	push   %ebp
+  802060:	89 e5                	mov    %esp,%ebp
+  802062:	57                   	push   %edi
+  802063:	56                   	push   %esi
+  802064:	53                   	push   %ebx
+  802065:	83 ec 28             	sub    $0x28,%esp
+  802068:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80206b:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80206e:	53                   	push   %ebx
+  80206f:	e8 29 f7 ff ff       	call   80179d <fd2data>
+  802074:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  802077:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80207a:	83 c4 10             	add    $0x10,%esp
+  80207d:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  802081:	74 43                	je     8020c6 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  802083:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  80208a:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80208d:	85 c0                	test   %eax,%eax
+  80208f:	74 43                	je     8020d4 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  802091:	89 c2                	mov    %eax,%edx
+  802093:	03 53 14             	add    0x14(%ebx),%edx
+  802096:	39 fa                	cmp    %edi,%edx
+  802098:	75 0b                	jne    8020a5 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  80209a:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  80209d:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  8020a3:	76 66                	jbe    80210b <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  8020a5:	83 ec 0c             	sub    $0xc,%esp
+  8020a8:	53                   	push   %ebx
+  8020a9:	e8 38 ff ff ff       	call   801fe6 <devfile_sync>
+  8020ae:	83 c4 10             	add    $0x10,%esp
+  8020b1:	85 c0                	test   %eax,%eax
+  8020b3:	78 4e                	js     802103 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8020b5:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8020bb:	77 56                	ja     802113 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  8020bd:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8020c0:	85 c0                	test   %eax,%eax
+  8020c2:	75 20                	jne    8020e4 <devfile_write+0x85>
+  8020c4:	eb 16                	jmp    8020dc <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  8020c6:	89 f1                	mov    %esi,%ecx
+  8020c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020cb:	89 d8                	mov    %ebx,%eax
+  8020cd:	e8 87 fe ff ff       	call   801f59 <file_write_direct>
+  8020d2:	eb 2f                	jmp    802103 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8020d4:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8020da:	77 37                	ja     802113 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  8020dc:	89 7b 14             	mov    %edi,0x14(%ebx)
+  8020df:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  8020e4:	83 ec 04             	sub    $0x4,%esp
+  8020e7:	56                   	push   %esi
+  8020e8:	ff 75 0c             	push   0xc(%ebp)
+  8020eb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8020ee:	01 c1                	add    %eax,%ecx
+  8020f0:	51                   	push   %ecx
+  8020f1:	e8 10 f0 ff ff       	call   801106 <memmove>
+	ff->buf_wlen += n;
+  8020f6:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  8020f9:	01 f7                	add    %esi,%edi
+  8020fb:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8020fe:	89 f0                	mov    %esi,%eax
+  802100:	83 c4 10             	add    $0x10,%esp
+}
+  802103:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802106:	5b                   	pop    %ebx
+  802107:	5e                   	pop    %esi
+  802108:	5f                   	pop    %edi
+  802109:	5d                   	pop    %ebp
+  80210a:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  80210b:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802111:	76 d1                	jbe    8020e4 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  802113:	89 f1                	mov    %esi,%ecx
+  802115:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802118:	89 d8                	mov    %ebx,%eax
+  80211a:	e8 3a fe ff ff       	call   801f59 <file_write_direct>
+  80211f:	eb e2                	jmp    802103 <devfile_write+0xa4>
+
+00802121 <devfile_trunc>:
+{
+  802121:	55                   	push   %ebp
+  802122:	89 e5                	mov    %esp,%ebp
+  802124:	53                   	push   %ebx
+  802125:	83 ec 10             	sub    $0x10,%esp
+  802128:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  80212b:	53                   	push   %ebx
+  80212c:	e8 b5 fe ff ff       	call   801fe6 <devfile_sync>
+  802131:	83 c4 10             	add    $0x10,%esp
+  802134:	85 c0                	test   %eax,%eax
+  802136:	78 1f                	js     802157 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802138:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80213b:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.set_size.req_size = newsize;
+  802140:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802143:	a3 04 90 80 00       	mov    %eax,0x809004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802148:	ba 00 00 00 00       	mov    $0x0,%edx
+  80214d:	b8 02 00 00 00       	mov    $0x2,%eax
+  802152:	e8 eb fd ff ff       	call   801f42 <fsipc>
+}
+  802157:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80215a:	c9                   	leave
+  80215b:	c3                   	ret
+
+0080215c <devfile_stat>:
+{
+  80215c:	55                   	push   %ebp
+  80215d:	89 e5                	mov    %esp,%ebp
+  80215f:	56                   	push   %esi
+  802160:	53                   	push   %ebx
+  802161:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802164:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  802167:	83 ec 0c             	sub    $0xc,%esp
+  80216a:	53                   	push   %ebx
+  80216b:	e8 76 fe ff ff       	call   801fe6 <devfile_sync>
+  802170:	83 c4 10             	add    $0x10,%esp
+  802173:	85 c0                	test   %eax,%eax
+  802175:	78 47                	js     8021be <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802177:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80217a:	a3 00 90 80 00       	mov    %eax,0x809000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80217f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802184:	b8 05 00 00 00       	mov    $0x5,%eax
+  802189:	e8 b4 fd ff ff       	call   801f42 <fsipc>
+  80218e:	85 c0                	test   %eax,%eax
+  802190:	78 2c                	js     8021be <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802192:	83 ec 08             	sub    $0x8,%esp
+  802195:	68 00 90 80 00       	push   $0x809000
+  80219a:	56                   	push   %esi
+  80219b:	e8 e0 ed ff ff       	call   800f80 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8021a0:	a1 80 90 80 00       	mov    0x809080,%eax
+  8021a5:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021ab:	a1 84 90 80 00       	mov    0x809084,%eax
+  8021b0:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  8021b6:	83 c4 10             	add    $0x10,%esp
+  8021b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021c1:	5b                   	pop    %ebx
+  8021c2:	5e                   	pop    %esi
+  8021c3:	5d                   	pop    %ebp
+  8021c4:	c3                   	ret
+
+008021c5 <devfile_flush>:
+{
+  8021c5:	55                   	push   %ebp
+  8021c6:	89 e5                	mov    %esp,%ebp
+  8021c8:	56                   	push   %esi
+  8021c9:	53                   	push   %ebx
+  8021ca:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  8021cd:	83 ec 0c             	sub    $0xc,%esp
+  8021d0:	56                   	push   %esi
+  8021d1:	e8 10 fe ff ff       	call   801fe6 <devfile_sync>
+  8021d6:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  8021d8:	83 c4 10             	add    $0x10,%esp
+  8021db:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  8021df:	75 25                	jne    802206 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8021e1:	8b 46 0c             	mov    0xc(%esi),%eax
+  8021e4:	a3 00 90 80 00       	mov    %eax,0x809000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  8021e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ee:	b8 06 00 00 00       	mov    $0x6,%eax
+  8021f3:	e8 4a fd ff ff       	call   801f42 <fsipc>
+  8021f8:	85 c0                	test   %eax,%eax
+  8021fa:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8021fd:	89 d8                	mov    %ebx,%eax
+  8021ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802202:	5b                   	pop    %ebx
+  802203:	5e                   	pop    %esi
+  802204:	5d                   	pop    %ebp
+  802205:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  802206:	83 ec 0c             	sub    $0xc,%esp
+  802209:	56                   	push   %esi
+  80220a:	e8 8e f5 ff ff       	call   80179d <fd2data>
+  80220f:	83 c4 08             	add    $0x8,%esp
+  802212:	50                   	push   %eax
+  802213:	6a 00                	push   $0x0
+  802215:	e8 ff f1 ff ff       	call   801419 <sys_page_unmap>
+  80221a:	83 c4 10             	add    $0x10,%esp
+  80221d:	eb c2                	jmp    8021e1 <devfile_flush+0x1c>
+
+0080221f <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  80221f:	55                   	push   %ebp
+  802220:	89 e5                	mov    %esp,%ebp
+  802222:	57                   	push   %edi
+  802223:	56                   	push   %esi
+  802224:	53                   	push   %ebx
+  802225:	83 ec 64             	sub    $0x64,%esp
+  802228:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  80222a:	52                   	push   %edx
+  80222b:	50                   	push   %eax
+  80222c:	e8 d9 f5 ff ff       	call   80180a <fd_lookup>
+  802231:	89 c1                	mov    %eax,%ecx
+  802233:	83 c4 10             	add    $0x10,%esp
+  802236:	85 c0                	test   %eax,%eax
+  802238:	0f 88 f2 00 00 00    	js     802330 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  80223e:	8b 07                	mov    (%edi),%eax
+  802240:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802246:	39 10                	cmp    %edx,(%eax)
+  802248:	0f 85 03 01 00 00    	jne    802351 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  80224e:	a1 10 80 80 00       	mov    0x808010,%eax
+  802253:	8b 40 48             	mov    0x48(%eax),%eax
+  802256:	3b 05 c4 a0 80 00    	cmp    0x80a0c4,%eax
+  80225c:	0f 84 96 00 00 00    	je     8022f8 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  802262:	83 3d c8 a0 80 00 00 	cmpl   $0x0,0x80a0c8
+  802269:	0f 84 cb 00 00 00    	je     80233a <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80226f:	b8 00 90 80 00       	mov    $0x809000,%eax
+  802274:	83 c8 07             	or     $0x7,%eax
+  802277:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  80227a:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80227d:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  802282:	83 ec 04             	sub    $0x4,%esp
+  802285:	68 07 04 00 00       	push   $0x407
+  80228a:	53                   	push   %ebx
+  80228b:	6a 00                	push   $0x0
+  80228d:	e8 fa f0 ff ff       	call   80138c <sys_page_alloc>
+  802292:	89 c1                	mov    %eax,%ecx
+  802294:	83 c4 10             	add    $0x10,%esp
+  802297:	85 c0                	test   %eax,%eax
+  802299:	0f 88 91 00 00 00    	js     802330 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  80229f:	89 d8                	mov    %ebx,%eax
+  8022a1:	83 c8 07             	or     $0x7,%eax
+  8022a4:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8022a6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022ac:	83 c6 04             	add    $0x4,%esi
+  8022af:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8022b5:	75 cb                	jne    802282 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8022b7:	6a 12                	push   $0x12
+  8022b9:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8022bc:	50                   	push   %eax
+  8022bd:	6a 0c                	push   $0xc
+  8022bf:	ff 35 c8 a0 80 00    	push   0x80a0c8
+  8022c5:	e8 65 1b 00 00       	call   803e2f <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8022ca:	83 c4 0c             	add    $0xc,%esp
+  8022cd:	6a 00                	push   $0x0
+  8022cf:	6a 00                	push   $0x0
+  8022d1:	6a 00                	push   $0x0
+  8022d3:	e8 01 1a 00 00       	call   803cd9 <ipc_recv>
+  8022d8:	89 c1                	mov    %eax,%ecx
+  8022da:	83 c4 10             	add    $0x10,%esp
+  8022dd:	85 c0                	test   %eax,%eax
+  8022df:	78 4f                	js     802330 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  8022e1:	a1 10 80 80 00       	mov    0x808010,%eax
+  8022e6:	8b 40 48             	mov    0x48(%eax),%eax
+  8022e9:	a3 c4 a0 80 00       	mov    %eax,0x80a0c4
+	fsring_busy = 0;
+  8022ee:	c7 05 c0 a0 80 00 00 	movl   $0x0,0x80a0c0
+  8022f5:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  8022f8:	83 ec 0c             	sub    $0xc,%esp
+  8022fb:	ff 37                	push   (%edi)
+  8022fd:	e8 e4 fc ff ff       	call   801fe6 <devfile_sync>
+  802302:	89 c1                	mov    %eax,%ecx
+  802304:	83 c4 10             	add    $0x10,%esp
+  802307:	85 c0                	test   %eax,%eax
+  802309:	78 25                	js     802330 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  80230b:	8b 1d c0 a0 80 00    	mov    0x80a0c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802311:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  802316:	ba 01 00 00 00       	mov    $0x1,%edx
+  80231b:	89 d0                	mov    %edx,%eax
+  80231d:	d3 e0                	shl    %cl,%eax
+  80231f:	85 d8                	test   %ebx,%eax
+  802321:	74 0d                	je     802330 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802323:	83 c1 01             	add    $0x1,%ecx
+  802326:	83 f9 10             	cmp    $0x10,%ecx
+  802329:	75 f0                	jne    80231b <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  80232b:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  802330:	89 c8                	mov    %ecx,%eax
+  802332:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802335:	5b                   	pop    %ebx
+  802336:	5e                   	pop    %esi
+  802337:	5f                   	pop    %edi
+  802338:	5d                   	pop    %ebp
+  802339:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80233a:	83 ec 0c             	sub    $0xc,%esp
+  80233d:	6a 01                	push   $0x1
+  80233f:	e8 39 1b 00 00       	call   803e7d <ipc_find_env>
+  802344:	a3 c8 a0 80 00       	mov    %eax,0x80a0c8
+  802349:	83 c4 10             	add    $0x10,%esp
+  80234c:	e9 1e ff ff ff       	jmp    80226f <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  802351:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  802356:	eb d8                	jmp    802330 <fsring_slot+0x111>
+
+00802358 <file_read_direct>:
+{
+  802358:	55                   	push   %ebp
+  802359:	89 e5                	mov    %esp,%ebp
+  80235b:	57                   	push   %edi
+  80235c:	56                   	push   %esi
+  80235d:	53                   	push   %ebx
+  80235e:	83 ec 1c             	sub    $0x1c,%esp
+  802361:	89 c7                	mov    %eax,%edi
+  802363:	89 d6                	mov    %edx,%esi
+  802365:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  802367:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  80236d:	77 52                	ja     8023c1 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80236f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802372:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.read.req_n = n;
+  802377:	89 0d 04 90 80 00    	mov    %ecx,0x809004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80237d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802382:	b8 03 00 00 00       	mov    $0x3,%eax
+  802387:	e8 b6 fb ff ff       	call   801f42 <fsipc>
+  80238c:	89 c7                	mov    %eax,%edi
+  80238e:	85 c0                	test   %eax,%eax
+  802390:	78 25                	js     8023b7 <file_read_direct+0x5f>
+	assert(r <= n);
+  802392:	39 c3                	cmp    %eax,%ebx
+  802394:	0f 82 87 00 00 00    	jb     802421 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  80239a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80239f:	0f 8f 95 00 00 00    	jg     80243a <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8023a5:	83 ec 04             	sub    $0x4,%esp
+  8023a8:	50                   	push   %eax
+  8023a9:	68 00 90 80 00       	push   $0x809000
+  8023ae:	56                   	push   %esi
+  8023af:	e8 52 ed ff ff       	call   801106 <memmove>
+	return r;
+  8023b4:	83 c4 10             	add    $0x10,%esp
+}
+  8023b7:	89 f8                	mov    %edi,%eax
+  8023b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023bc:	5b                   	pop    %ebx
+  8023bd:	5e                   	pop    %esi
+  8023be:	5f                   	pop    %edi
+  8023bf:	5d                   	pop    %ebp
+  8023c0:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8023c1:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8023c7:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8023cc:	29 d1                	sub    %edx,%ecx
+  8023ce:	39 d9                	cmp    %ebx,%ecx
+  8023d0:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8023d3:	89 f0                	mov    %esi,%eax
+  8023d5:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8023d8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8023db:	eb 0f                	jmp    8023ec <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8023dd:	0f b6 10             	movzbl (%eax),%edx
+  8023e0:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8023e2:	05 00 10 00 00       	add    $0x1000,%eax
+  8023e7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8023ec:	39 c8                	cmp    %ecx,%eax
+  8023ee:	72 ed                	jb     8023dd <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  8023f0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8023f3:	8b 47 0c             	mov    0xc(%edi),%eax
+  8023f6:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.bulk.req_n = n;
+  8023fb:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802401:	89 15 08 90 80 00    	mov    %edx,0x809008
+	return fsipc_pages(type, buf, n, perm);
+  802407:	83 ec 0c             	sub    $0xc,%esp
+  80240a:	6a 07                	push   $0x7
+  80240c:	89 d9                	mov    %ebx,%ecx
+  80240e:	89 f2                	mov    %esi,%edx
+  802410:	b8 09 00 00 00       	mov    $0x9,%eax
+  802415:	e8 86 f9 ff ff       	call   801da0 <fsipc_pages>
+  80241a:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  80241c:	83 c4 10             	add    $0x10,%esp
+  80241f:	eb 96                	jmp    8023b7 <file_read_direct+0x5f>
+	assert(r <= n);
+  802421:	68 40 48 80 00       	push   $0x804840
+  802426:	68 20 48 80 00       	push   $0x804820
+  80242b:	68 dc 00 00 00       	push   $0xdc
+  802430:	68 35 48 80 00       	push   $0x804835
+  802435:	e8 7d e4 ff ff       	call   8008b7 <_panic>
+	assert(r <= PGSIZE);
+  80243a:	68 51 48 80 00       	push   $0x804851
+  80243f:	68 20 48 80 00       	push   $0x804820
+  802444:	68 dd 00 00 00       	push   $0xdd
+  802449:	68 35 48 80 00       	push   $0x804835
+  80244e:	e8 64 e4 ff ff       	call   8008b7 <_panic>
+
+00802453 <devfile_read>:
+{
+  802453:	55                   	push   %ebp
+  802454:	89 e5                	mov    %esp,%ebp
+  802456:	57                   	push   %edi
+  802457:	56                   	push   %esi
+  802458:	53                   	push   %ebx
+  802459:	83 ec 28             	sub    $0x28,%esp
+  80245c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80245f:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  802462:	53                   	push   %ebx
+  802463:	e8 35 f3 ff ff       	call   80179d <fd2data>
+  802468:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  80246b:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80246e:	83 c4 10             	add    $0x10,%esp
+  802471:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  802475:	74 7d                	je     8024f4 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802477:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80247b:	0f 85 81 00 00 00    	jne    802502 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  802481:	8b 43 18             	mov    0x18(%ebx),%eax
+  802484:	85 c0                	test   %eax,%eax
+  802486:	74 0d                	je     802495 <devfile_read+0x42>
+  802488:	8b 53 14             	mov    0x14(%ebx),%edx
+  80248b:	39 fa                	cmp    %edi,%edx
+  80248d:	7f 06                	jg     802495 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  80248f:	01 c2                	add    %eax,%edx
+  802491:	39 d7                	cmp    %edx,%edi
+  802493:	72 28                	jb     8024bd <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  802495:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  80249c:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8024a2:	77 74                	ja     802518 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8024a4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024a9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024ac:	89 d8                	mov    %ebx,%eax
+  8024ae:	e8 a5 fe ff ff       	call   802358 <file_read_direct>
+  8024b3:	85 c0                	test   %eax,%eax
+  8024b5:	7e 35                	jle    8024ec <devfile_read+0x99>
+		ff->buf_base = pos;
+  8024b7:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8024ba:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8024bd:	8b 53 14             	mov    0x14(%ebx),%edx
+  8024c0:	89 d0                	mov    %edx,%eax
+  8024c2:	03 43 18             	add    0x18(%ebx),%eax
+  8024c5:	29 f8                	sub    %edi,%eax
+  8024c7:	39 f0                	cmp    %esi,%eax
+  8024c9:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8024cc:	83 ec 04             	sub    $0x4,%esp
+  8024cf:	56                   	push   %esi
+  8024d0:	89 f8                	mov    %edi,%eax
+  8024d2:	29 d0                	sub    %edx,%eax
+  8024d4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8024d7:	01 c1                	add    %eax,%ecx
+  8024d9:	51                   	push   %ecx
+  8024da:	ff 75 0c             	push   0xc(%ebp)
+  8024dd:	e8 24 ec ff ff       	call   801106 <memmove>
+	fd->fd_offset = pos + n;
+  8024e2:	01 f7                	add    %esi,%edi
+  8024e4:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8024e7:	89 f0                	mov    %esi,%eax
+  8024e9:	83 c4 10             	add    $0x10,%esp
+}
+  8024ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024ef:	5b                   	pop    %ebx
+  8024f0:	5e                   	pop    %esi
+  8024f1:	5f                   	pop    %edi
+  8024f2:	5d                   	pop    %ebp
+  8024f3:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  8024f4:	89 f1                	mov    %esi,%ecx
+  8024f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024f9:	89 d8                	mov    %ebx,%eax
+  8024fb:	e8 58 fe ff ff       	call   802358 <file_read_direct>
+  802500:	eb ea                	jmp    8024ec <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802502:	83 ec 0c             	sub    $0xc,%esp
+  802505:	53                   	push   %ebx
+  802506:	e8 db fa ff ff       	call   801fe6 <devfile_sync>
+  80250b:	83 c4 10             	add    $0x10,%esp
+  80250e:	85 c0                	test   %eax,%eax
+  802510:	0f 89 6b ff ff ff    	jns    802481 <devfile_read+0x2e>
+  802516:	eb d4                	jmp    8024ec <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  802518:	89 f1                	mov    %esi,%ecx
+  80251a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80251d:	89 d8                	mov    %ebx,%eax
+  80251f:	e8 34 fe ff ff       	call   802358 <file_read_direct>
+  802524:	eb c6                	jmp    8024ec <devfile_read+0x99>
+
+00802526 <open>:
+{
+  802526:	55                   	push   %ebp
+  802527:	89 e5                	mov    %esp,%ebp
+  802529:	56                   	push   %esi
+  80252a:	53                   	push   %ebx
+  80252b:	83 ec 1c             	sub    $0x1c,%esp
+  80252e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802531:	56                   	push   %esi
+  802532:	e8 0e ea ff ff       	call   800f45 <strlen>
+  802537:	83 c4 10             	add    $0x10,%esp
+  80253a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80253f:	0f 8f a0 00 00 00    	jg     8025e5 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  802545:	83 ec 0c             	sub    $0xc,%esp
+  802548:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80254b:	50                   	push   %eax
+  80254c:	e8 63 f2 ff ff       	call   8017b4 <fd_alloc>
+  802551:	89 c3                	mov    %eax,%ebx
+  802553:	83 c4 10             	add    $0x10,%esp
+  802556:	85 c0                	test   %eax,%eax
+  802558:	78 45                	js     80259f <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  80255a:	83 ec 08             	sub    $0x8,%esp
+  80255d:	56                   	push   %esi
+  80255e:	68 00 90 80 00       	push   $0x809000
+  802563:	e8 18 ea ff ff       	call   800f80 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802568:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80256b:	a3 00 94 80 00       	mov    %eax,0x809400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802570:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802573:	b8 01 00 00 00       	mov    $0x1,%eax
+  802578:	e8 c5 f9 ff ff       	call   801f42 <fsipc>
+  80257d:	89 c3                	mov    %eax,%ebx
+  80257f:	83 c4 10             	add    $0x10,%esp
+  802582:	85 c0                	test   %eax,%eax
+  802584:	78 22                	js     8025a8 <open+0x82>
+	if (!(mode & O_NOBUF)
+  802586:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  80258d:	74 2b                	je     8025ba <open+0x94>
+	return fd2num(fd);
+  80258f:	83 ec 0c             	sub    $0xc,%esp
+  802592:	ff 75 f4             	push   -0xc(%ebp)
+  802595:	e8 f3 f1 ff ff       	call   80178d <fd2num>
+  80259a:	89 c3                	mov    %eax,%ebx
+  80259c:	83 c4 10             	add    $0x10,%esp
+}
+  80259f:	89 d8                	mov    %ebx,%eax
+  8025a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025a4:	5b                   	pop    %ebx
+  8025a5:	5e                   	pop    %esi
+  8025a6:	5d                   	pop    %ebp
+  8025a7:	c3                   	ret
+		fd_close(fd, 0);
+  8025a8:	83 ec 08             	sub    $0x8,%esp
+  8025ab:	6a 00                	push   $0x0
+  8025ad:	ff 75 f4             	push   -0xc(%ebp)
+  8025b0:	e8 f8 f2 ff ff       	call   8018ad <fd_close>
+		return r;
+  8025b5:	83 c4 10             	add    $0x10,%esp
+  8025b8:	eb e5                	jmp    80259f <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8025ba:	83 ec 0c             	sub    $0xc,%esp
+  8025bd:	ff 75 f4             	push   -0xc(%ebp)
+  8025c0:	e8 d8 f1 ff ff       	call   80179d <fd2data>
+  8025c5:	83 c4 0c             	add    $0xc,%esp
+  8025c8:	68 07 04 00 00       	push   $0x407
+  8025cd:	50                   	push   %eax
+  8025ce:	6a 00                	push   $0x0
+  8025d0:	e8 b7 ed ff ff       	call   80138c <sys_page_alloc>
+  8025d5:	83 c4 10             	add    $0x10,%esp
+  8025d8:	85 c0                	test   %eax,%eax
+  8025da:	75 b3                	jne    80258f <open+0x69>
+		fd->fd_file.buffered = 1;
+  8025dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025df:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8025e3:	eb aa                	jmp    80258f <open+0x69>
+		return -E_BAD_PATH;
+  8025e5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8025ea:	eb b3                	jmp    80259f <open+0x79>
+
+008025ec <readdir>:
+{
+  8025ec:	55                   	push   %ebp
+  8025ed:	89 e5                	mov    %esp,%ebp
+  8025ef:	53                   	push   %ebx
+  8025f0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025f6:	50                   	push   %eax
+  8025f7:	ff 75 08             	push   0x8(%ebp)
+  8025fa:	e8 0b f2 ff ff       	call   80180a <fd_lookup>
+  8025ff:	89 c3                	mov    %eax,%ebx
+  802601:	83 c4 10             	add    $0x10,%esp
+  802604:	85 c0                	test   %eax,%eax
+  802606:	78 73                	js     80267b <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802608:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80260b:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802611:	39 08                	cmp    %ecx,(%eax)
+  802613:	0f 85 82 00 00 00    	jne    80269b <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802619:	83 ec 0c             	sub    $0xc,%esp
+  80261c:	50                   	push   %eax
+  80261d:	e8 c4 f9 ff ff       	call   801fe6 <devfile_sync>
+  802622:	89 c3                	mov    %eax,%ebx
+  802624:	83 c4 10             	add    $0x10,%esp
+  802627:	85 c0                	test   %eax,%eax
+  802629:	78 50                	js     80267b <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  80262b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80262e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802631:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.readdir.req_n = n;
+  802636:	8b 45 10             	mov    0x10(%ebp),%eax
+  802639:	a3 04 90 80 00       	mov    %eax,0x809004
+	fsipcbuf.readdir.req_flags = flags;
+  80263e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802641:	a3 08 90 80 00       	mov    %eax,0x809008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  802646:	ba 00 00 00 00       	mov    $0x0,%edx
+  80264b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802650:	e8 ed f8 ff ff       	call   801f42 <fsipc>
+  802655:	89 c3                	mov    %eax,%ebx
+  802657:	85 c0                	test   %eax,%eax
+  802659:	7e 20                	jle    80267b <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  80265b:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80265e:	72 22                	jb     802682 <readdir+0x96>
+  802660:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802665:	7f 1b                	jg     802682 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802667:	83 ec 04             	sub    $0x4,%esp
+  80266a:	50                   	push   %eax
+  80266b:	68 00 90 80 00       	push   $0x809000
+  802670:	ff 75 0c             	push   0xc(%ebp)
+  802673:	e8 8e ea ff ff       	call   801106 <memmove>
+	return r;
+  802678:	83 c4 10             	add    $0x10,%esp
+}
+  80267b:	89 d8                	mov    %ebx,%eax
+  80267d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802680:	c9                   	leave
+  802681:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  802682:	68 47 48 80 00       	push   $0x804847
+  802687:	68 20 48 80 00       	push   $0x804820
+  80268c:	68 86 01 00 00       	push   $0x186
+  802691:	68 35 48 80 00       	push   $0x804835
+  802696:	e8 1c e2 ff ff       	call   8008b7 <_panic>
+		return -E_NOT_SUPP;
+  80269b:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8026a0:	eb d9                	jmp    80267b <readdir+0x8f>
+
+008026a2 <munmap>:
+{
+  8026a2:	55                   	push   %ebp
+  8026a3:	89 e5                	mov    %esp,%ebp
+  8026a5:	56                   	push   %esi
+  8026a6:	53                   	push   %ebx
+  8026a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8026aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8026ad:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8026b3:	75 41                	jne    8026f6 <munmap+0x54>
+  8026b5:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8026bb:	77 39                	ja     8026f6 <munmap+0x54>
+  8026bd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8026c2:	29 f0                	sub    %esi,%eax
+  8026c4:	39 d0                	cmp    %edx,%eax
+  8026c6:	72 35                	jb     8026fd <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8026c8:	89 f3                	mov    %esi,%ebx
+  8026ca:	01 d6                	add    %edx,%esi
+  8026cc:	39 f3                	cmp    %esi,%ebx
+  8026ce:	73 1a                	jae    8026ea <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8026d0:	83 ec 08             	sub    $0x8,%esp
+  8026d3:	53                   	push   %ebx
+  8026d4:	6a 00                	push   $0x0
+  8026d6:	e8 3e ed ff ff       	call   801419 <sys_page_unmap>
+  8026db:	83 c4 10             	add    $0x10,%esp
+  8026de:	85 c0                	test   %eax,%eax
+  8026e0:	78 0d                	js     8026ef <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8026e2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8026e8:	eb e2                	jmp    8026cc <munmap+0x2a>
+	return 0;
+  8026ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026f2:	5b                   	pop    %ebx
+  8026f3:	5e                   	pop    %esi
+  8026f4:	5d                   	pop    %ebp
+  8026f5:	c3                   	ret
+		return -E_INVAL;
+  8026f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026fb:	eb f2                	jmp    8026ef <munmap+0x4d>
+  8026fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802702:	eb eb                	jmp    8026ef <munmap+0x4d>
+
+00802704 <mmap>:
+{
+  802704:	55                   	push   %ebp
+  802705:	89 e5                	mov    %esp,%ebp
+  802707:	57                   	push   %edi
+  802708:	56                   	push   %esi
+  802709:	53                   	push   %ebx
+  80270a:	83 ec 34             	sub    $0x34,%esp
+  80270d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802710:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802713:	50                   	push   %eax
+  802714:	ff 75 18             	push   0x18(%ebp)
+  802717:	e8 ee f0 ff ff       	call   80180a <fd_lookup>
+  80271c:	89 c3                	mov    %eax,%ebx
+  80271e:	83 c4 10             	add    $0x10,%esp
+  802721:	85 c0                	test   %eax,%eax
+  802723:	0f 88 0e 01 00 00    	js     802837 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802729:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80272c:	a1 40 50 80 00       	mov    0x805040,%eax
+  802731:	39 02                	cmp    %eax,(%edx)
+  802733:	0f 85 50 01 00 00    	jne    802889 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802739:	8b 45 10             	mov    0x10(%ebp),%eax
+  80273c:	83 e0 02             	and    $0x2,%eax
+  80273f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802742:	74 0a                	je     80274e <mmap+0x4a>
+  802744:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802748:	0f 84 42 01 00 00    	je     802890 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  80274e:	8b 42 08             	mov    0x8(%edx),%eax
+  802751:	83 e0 03             	and    $0x3,%eax
+  802754:	83 f8 01             	cmp    $0x1,%eax
+  802757:	0f 84 3a 01 00 00    	je     802897 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  80275d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802760:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802763:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802768:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80276b:	0f 85 2d 01 00 00    	jne    80289e <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802771:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802775:	0f 88 2a 01 00 00    	js     8028a5 <mmap+0x1a1>
+  80277b:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  802782:	0f 87 1d 01 00 00    	ja     8028a5 <mmap+0x1a1>
+  802788:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80278d:	2b 45 08             	sub    0x8(%ebp),%eax
+  802790:	39 f8                	cmp    %edi,%eax
+  802792:	0f 82 14 01 00 00    	jb     8028ac <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802798:	83 ec 0c             	sub    $0xc,%esp
+  80279b:	52                   	push   %edx
+  80279c:	e8 45 f8 ff ff       	call   801fe6 <devfile_sync>
+  8027a1:	89 c3                	mov    %eax,%ebx
+  8027a3:	83 c4 10             	add    $0x10,%esp
+  8027a6:	85 c0                	test   %eax,%eax
+  8027a8:	0f 88 89 00 00 00    	js     802837 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8027ae:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8027b4:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8027ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8027bf:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8027c2:	39 fe                	cmp    %edi,%esi
+  8027c4:	73 7b                	jae    802841 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8027c6:	89 f8                	mov    %edi,%eax
+  8027c8:	29 f0                	sub    %esi,%eax
+  8027ca:	c1 e8 0c             	shr    $0xc,%eax
+  8027cd:	ba 40 00 00 00       	mov    $0x40,%edx
+  8027d2:	39 d0                	cmp    %edx,%eax
+  8027d4:	0f 47 c2             	cmova  %edx,%eax
+  8027d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8027da:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8027dd:	8b 52 0c             	mov    0xc(%edx),%edx
+  8027e0:	89 15 00 90 80 00    	mov    %edx,0x809000
+		fsipcbuf.map.req_offset = offset + done;
+  8027e6:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8027e9:	89 15 04 90 80 00    	mov    %edx,0x809004
+		fsipcbuf.map.req_npages = n;
+  8027ef:	a3 08 90 80 00       	mov    %eax,0x809008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8027f4:	89 f2                	mov    %esi,%edx
+  8027f6:	03 55 08             	add    0x8(%ebp),%edx
+  8027f9:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8027fc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802801:	e8 ea f6 ff ff       	call   801ef0 <fsipcv>
+  802806:	85 c0                	test   %eax,%eax
+  802808:	7e 12                	jle    80281c <mmap+0x118>
+  80280a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80280d:	85 c0                	test   %eax,%eax
+  80280f:	0f 84 9e 00 00 00    	je     8028b3 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802815:	c1 e0 0c             	shl    $0xc,%eax
+  802818:	01 c6                	add    %eax,%esi
+  80281a:	eb a6                	jmp    8027c2 <mmap+0xbe>
+			munmap(addr, done);
+  80281c:	89 c3                	mov    %eax,%ebx
+  80281e:	83 ec 08             	sub    $0x8,%esp
+  802821:	56                   	push   %esi
+  802822:	ff 75 08             	push   0x8(%ebp)
+  802825:	e8 78 fe ff ff       	call   8026a2 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80282a:	83 c4 10             	add    $0x10,%esp
+  80282d:	85 db                	test   %ebx,%ebx
+  80282f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802834:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802837:	89 d8                	mov    %ebx,%eax
+  802839:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80283c:	5b                   	pop    %ebx
+  80283d:	5e                   	pop    %esi
+  80283e:	5f                   	pop    %edi
+  80283f:	5d                   	pop    %ebp
+  802840:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802841:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802844:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802846:	85 c0                	test   %eax,%eax
+  802848:	74 ed                	je     802837 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80284a:	be 00 00 00 00       	mov    $0x0,%esi
+  80284f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802852:	39 fe                	cmp    %edi,%esi
+  802854:	73 2e                	jae    802884 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802856:	83 ec 0c             	sub    $0xc,%esp
+  802859:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  80285c:	50                   	push   %eax
+  80285d:	e8 79 12 00 00       	call   803adb <cowpage>
+  802862:	83 c4 10             	add    $0x10,%esp
+  802865:	85 c0                	test   %eax,%eax
+  802867:	78 08                	js     802871 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802869:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80286f:	eb e1                	jmp    802852 <mmap+0x14e>
+				munmap(addr, len);
+  802871:	89 c3                	mov    %eax,%ebx
+  802873:	83 ec 08             	sub    $0x8,%esp
+  802876:	57                   	push   %edi
+  802877:	ff 75 08             	push   0x8(%ebp)
+  80287a:	e8 23 fe ff ff       	call   8026a2 <munmap>
+				return r;
+  80287f:	83 c4 10             	add    $0x10,%esp
+  802882:	eb b3                	jmp    802837 <mmap+0x133>
+	return 0;
+  802884:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802887:	eb ae                	jmp    802837 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802889:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80288e:	eb a7                	jmp    802837 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802890:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802895:	eb a0                	jmp    802837 <mmap+0x133>
+		return -E_INVAL;
+  802897:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80289c:	eb 99                	jmp    802837 <mmap+0x133>
+  80289e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8028a3:	eb 92                	jmp    802837 <mmap+0x133>
+  8028a5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8028aa:	eb 8b                	jmp    802837 <mmap+0x133>
+  8028ac:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8028b1:	eb 84                	jmp    802837 <mmap+0x133>
+			munmap(addr, done);
+  8028b3:	83 ec 08             	sub    $0x8,%esp
+  8028b6:	56                   	push   %esi
+  8028b7:	ff 75 08             	push   0x8(%ebp)
+  8028ba:	e8 e3 fd ff ff       	call   8026a2 <munmap>
+  8028bf:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8028c2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8028c7:	e9 6b ff ff ff       	jmp    802837 <mmap+0x133>
+
+008028cc <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8028cc:	55                   	push   %ebp
+  8028cd:	89 e5                	mov    %esp,%ebp
+  8028cf:	56                   	push   %esi
+  8028d0:	53                   	push   %ebx
+  8028d1:	83 ec 10             	sub    $0x10,%esp
+  8028d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8028d7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8028da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028dd:	e8 3d f9 ff ff       	call   80221f <fsring_slot>
+  8028e2:	85 c0                	test   %eax,%eax
+  8028e4:	78 60                	js     802946 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8028e6:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8028e9:	8b 56 08             	mov    0x8(%esi),%edx
+  8028ec:	83 e2 03             	and    $0x3,%edx
+  8028ef:	83 fa 01             	cmp    $0x1,%edx
+  8028f2:	74 59                	je     80294d <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8028f4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8028f9:	89 c1                	mov    %eax,%ecx
+  8028fb:	d3 e2                	shl    %cl,%edx
+  8028fd:	09 15 c0 a0 80 00    	or     %edx,0x80a0c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802903:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802906:	c1 e2 02             	shl    $0x2,%edx
+  802909:	8d 8a 00 a0 80 00    	lea    0x80a000(%edx),%ecx
+  80290f:	c7 82 00 a0 80 00 03 	movl   $0x3,0x80a000(%edx)
+  802916:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802919:	8b 55 18             	mov    0x18(%ebp),%edx
+  80291c:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80291f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802922:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802925:	83 ec 08             	sub    $0x8,%esp
+  802928:	50                   	push   %eax
+  802929:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80292e:	39 c3                	cmp    %eax,%ebx
+  802930:	0f 47 d8             	cmova  %eax,%ebx
+  802933:	53                   	push   %ebx
+  802934:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802937:	89 f2                	mov    %esi,%edx
+  802939:	b8 03 00 00 00       	mov    $0x3,%eax
+  80293e:	e8 1e f5 ff ff       	call   801e61 <fsring_post>
+  802943:	83 c4 10             	add    $0x10,%esp
+}
+  802946:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802949:	5b                   	pop    %ebx
+  80294a:	5e                   	pop    %esi
+  80294b:	5d                   	pop    %ebp
+  80294c:	c3                   	ret
+		return -E_INVAL;
+  80294d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802952:	eb f2                	jmp    802946 <fsring_read+0x7a>
+
+00802954 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802954:	55                   	push   %ebp
+  802955:	89 e5                	mov    %esp,%ebp
+  802957:	56                   	push   %esi
+  802958:	53                   	push   %ebx
+  802959:	83 ec 10             	sub    $0x10,%esp
+  80295c:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80295f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802962:	8b 45 08             	mov    0x8(%ebp),%eax
+  802965:	e8 b5 f8 ff ff       	call   80221f <fsring_slot>
+  80296a:	89 c3                	mov    %eax,%ebx
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	78 77                	js     8029e7 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802970:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802973:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802977:	74 77                	je     8029f0 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802979:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80297e:	39 c6                	cmp    %eax,%esi
+  802980:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802983:	83 ec 04             	sub    $0x4,%esp
+  802986:	56                   	push   %esi
+  802987:	ff 75 0c             	push   0xc(%ebp)
+  80298a:	89 d8                	mov    %ebx,%eax
+  80298c:	c1 e0 0c             	shl    $0xc,%eax
+  80298f:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802995:	50                   	push   %eax
+  802996:	e8 6b e7 ff ff       	call   801106 <memmove>
+	fsring_busy |= 1 << slot;
+  80299b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029a0:	89 d9                	mov    %ebx,%ecx
+  8029a2:	d3 e0                	shl    %cl,%eax
+  8029a4:	09 05 c0 a0 80 00    	or     %eax,0x80a0c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8029aa:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8029ad:	c1 e0 02             	shl    $0x2,%eax
+  8029b0:	8d 90 00 a0 80 00    	lea    0x80a000(%eax),%edx
+  8029b6:	c7 80 00 a0 80 00 04 	movl   $0x4,0x80a000(%eax)
+  8029bd:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8029c0:	8b 45 18             	mov    0x18(%ebp),%eax
+  8029c3:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8029c6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8029cd:	83 c4 08             	add    $0x8,%esp
+  8029d0:	53                   	push   %ebx
+  8029d1:	56                   	push   %esi
+  8029d2:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8029d5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029d8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8029dd:	e8 7f f4 ff ff       	call   801e61 <fsring_post>
+  8029e2:	89 c3                	mov    %eax,%ebx
+  8029e4:	83 c4 10             	add    $0x10,%esp
+}
+  8029e7:	89 d8                	mov    %ebx,%eax
+  8029e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029ec:	5b                   	pop    %ebx
+  8029ed:	5e                   	pop    %esi
+  8029ee:	5d                   	pop    %ebp
+  8029ef:	c3                   	ret
+		return -E_INVAL;
+  8029f0:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8029f5:	eb f0                	jmp    8029e7 <fsring_write+0x93>
+
+008029f7 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8029f7:	55                   	push   %ebp
+  8029f8:	89 e5                	mov    %esp,%ebp
+  8029fa:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8029fd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a00:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a03:	e8 17 f8 ff ff       	call   80221f <fsring_slot>
+  802a08:	85 c0                	test   %eax,%eax
+  802a0a:	78 4c                	js     802a58 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802a0c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a11:	89 c1                	mov    %eax,%ecx
+  802a13:	d3 e2                	shl    %cl,%edx
+  802a15:	09 15 c0 a0 80 00    	or     %edx,0x80a0c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802a1b:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802a1e:	c1 e2 02             	shl    $0x2,%edx
+  802a21:	8d 8a 00 a0 80 00    	lea    0x80a000(%edx),%ecx
+  802a27:	c7 82 00 a0 80 00 05 	movl   $0x5,0x80a000(%edx)
+  802a2e:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802a31:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a34:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802a37:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a3a:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802a3d:	83 ec 08             	sub    $0x8,%esp
+  802a40:	50                   	push   %eax
+  802a41:	6a 00                	push   $0x0
+  802a43:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a48:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a4b:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a50:	e8 0c f4 ff ff       	call   801e61 <fsring_post>
+  802a55:	83 c4 10             	add    $0x10,%esp
+}
+  802a58:	c9                   	leave
+  802a59:	c3                   	ret
+
+00802a5a <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802a5a:	55                   	push   %ebp
+  802a5b:	89 e5                	mov    %esp,%ebp
+  802a5d:	57                   	push   %edi
+  802a5e:	56                   	push   %esi
+  802a5f:	53                   	push   %ebx
+  802a60:	83 ec 1c             	sub    $0x1c,%esp
+  802a63:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802a67:	a1 10 80 80 00       	mov    0x808010,%eax
+  802a6c:	8b 40 48             	mov    0x48(%eax),%eax
+  802a6f:	3b 05 c4 a0 80 00    	cmp    0x80a0c4,%eax
+  802a75:	74 12                	je     802a89 <fsring_reap+0x2f>
+		return 0;
+  802a77:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802a7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a7f:	5b                   	pop    %ebx
+  802a80:	5e                   	pop    %esi
+  802a81:	5f                   	pop    %edi
+  802a82:	5d                   	pop    %ebp
+  802a83:	c3                   	ret
+		sys_yield();
+  802a84:	e8 e4 e8 ff ff       	call   80136d <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802a89:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802a8f:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802a94:	39 c2                	cmp    %eax,%edx
+  802a96:	75 18                	jne    802ab0 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802a98:	84 db                	test   %bl,%bl
+  802a9a:	0f 84 21 01 00 00    	je     802bc1 <fsring_reap+0x167>
+  802aa0:	83 3d c0 a0 80 00 00 	cmpl   $0x0,0x80a0c0
+  802aa7:	75 db                	jne    802a84 <fsring_reap+0x2a>
+			return 0;
+  802aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aae:	eb cc                	jmp    802a7c <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802ab0:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802ab5:	83 e0 0f             	and    $0xf,%eax
+  802ab8:	83 c0 2a             	add    $0x2a,%eax
+  802abb:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802ac2:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802ac9:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802ace:	83 c0 01             	add    $0x1,%eax
+  802ad1:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802ad6:	83 fb 0f             	cmp    $0xf,%ebx
+  802ad9:	77 5b                	ja     802b36 <fsring_reap+0xdc>
+  802adb:	be 01 00 00 00       	mov    $0x1,%esi
+  802ae0:	89 d9                	mov    %ebx,%ecx
+  802ae2:	d3 e6                	shl    %cl,%esi
+  802ae4:	89 f0                	mov    %esi,%eax
+  802ae6:	23 05 c0 a0 80 00    	and    0x80a0c0,%eax
+  802aec:	74 48                	je     802b36 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802aee:	89 d8                	mov    %ebx,%eax
+  802af0:	c1 e0 0c             	shl    $0xc,%eax
+  802af3:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802af9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802afc:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802aff:	8b 04 85 00 a0 80 00 	mov    0x80a000(,%eax,4),%eax
+  802b06:	83 f8 03             	cmp    $0x3,%eax
+  802b09:	74 40                	je     802b4b <fsring_reap+0xf1>
+  802b0b:	83 f8 05             	cmp    $0x5,%eax
+  802b0e:	74 64                	je     802b74 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802b10:	f7 d6                	not    %esi
+  802b12:	21 35 c0 a0 80 00    	and    %esi,0x80a0c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802b18:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802b1b:	8b 14 85 04 a0 80 00 	mov    0x80a004(,%eax,4),%edx
+  802b22:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b25:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802b27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b2a:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802b2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b31:	e9 46 ff ff ff       	jmp    802a7c <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802b36:	53                   	push   %ebx
+  802b37:	68 5d 48 80 00       	push   $0x80485d
+  802b3c:	68 8f 02 00 00       	push   $0x28f
+  802b41:	68 35 48 80 00       	push   $0x804835
+  802b46:	e8 6c dd ff ff       	call   8008b7 <_panic>
+		if (cqe.cqe_result > 0)
+  802b4b:	85 ff                	test   %edi,%edi
+  802b4d:	7e c1                	jle    802b10 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802b4f:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802b52:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802b57:	39 c7                	cmp    %eax,%edi
+  802b59:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802b5c:	50                   	push   %eax
+  802b5d:	ff 75 e4             	push   -0x1c(%ebp)
+  802b60:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802b63:	ff 34 85 08 a0 80 00 	push   0x80a008(,%eax,4)
+  802b6a:	e8 97 e5 ff ff       	call   801106 <memmove>
+  802b6f:	83 c4 10             	add    $0x10,%esp
+  802b72:	eb 9c                	jmp    802b10 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802b74:	85 ff                	test   %edi,%edi
+  802b76:	75 98                	jne    802b10 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802b78:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802b7b:	8b 0c 85 08 a0 80 00 	mov    0x80a008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802b82:	83 ec 08             	sub    $0x8,%esp
+  802b85:	ff 75 e4             	push   -0x1c(%ebp)
+  802b88:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802b8b:	51                   	push   %ecx
+  802b8c:	e8 ef e3 ff ff       	call   800f80 <strcpy>
+			st->st_size = ret->ret_size;
+  802b91:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802b94:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802b9a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b9d:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802ba3:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802ba9:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802baf:	c7 81 88 00 00 00 40 	movl   $0x805040,0x88(%ecx)
+  802bb6:	50 80 00 
+  802bb9:	83 c4 10             	add    $0x10,%esp
+  802bbc:	e9 4f ff ff ff       	jmp    802b10 <fsring_reap+0xb6>
+			return 0;
+  802bc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc6:	e9 b1 fe ff ff       	jmp    802a7c <fsring_reap+0x22>
+
+00802bcb <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802bcb:	55                   	push   %ebp
+  802bcc:	89 e5                	mov    %esp,%ebp
+  802bce:	57                   	push   %edi
+  802bcf:	56                   	push   %esi
+  802bd0:	53                   	push   %ebx
+  802bd1:	83 ec 28             	sub    $0x28,%esp
+  802bd4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802bd7:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802bda:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802bdd:	53                   	push   %ebx
+  802bde:	e8 62 e3 ff ff       	call   800f45 <strlen>
+  802be3:	83 c4 10             	add    $0x10,%esp
+  802be6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802beb:	0f 8f 02 01 00 00    	jg     802cf3 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802bf1:	83 ec 08             	sub    $0x8,%esp
+  802bf4:	53                   	push   %ebx
+  802bf5:	68 00 90 80 00       	push   $0x809000
+  802bfa:	e8 81 e3 ff ff       	call   800f80 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802bff:	83 c4 10             	add    $0x10,%esp
+  802c02:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802c08:	76 69                	jbe    802c73 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802c0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c0d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802c13:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802c18:	29 d1                	sub    %edx,%ecx
+  802c1a:	39 f9                	cmp    %edi,%ecx
+  802c1c:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802c1f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c22:	89 f9                	mov    %edi,%ecx
+  802c24:	01 c1                	add    %eax,%ecx
+  802c26:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802c29:	eb 0f                	jmp    802c3a <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802c2b:	0f b6 10             	movzbl (%eax),%edx
+  802c2e:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802c30:	05 00 10 00 00       	add    $0x1000,%eax
+  802c35:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802c3a:	39 c8                	cmp    %ecx,%eax
+  802c3c:	72 ed                	jb     802c2b <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802c3e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802c41:	89 3d 00 94 80 00    	mov    %edi,0x809400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802c47:	89 15 04 94 80 00    	mov    %edx,0x809404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802c4d:	83 ec 0c             	sub    $0xc,%esp
+  802c50:	6a 07                	push   $0x7
+  802c52:	89 f9                	mov    %edi,%ecx
+  802c54:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c57:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802c5c:	e8 3f f1 ff ff       	call   801da0 <fsipc_pages>
+  802c61:	89 c7                	mov    %eax,%edi
+  802c63:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802c66:	85 f6                	test   %esi,%esi
+  802c68:	74 7f                	je     802ce9 <file_slurp+0x11e>
+  802c6a:	8d 43 01             	lea    0x1(%ebx),%eax
+  802c6d:	85 ff                	test   %edi,%edi
+  802c6f:	79 3c                	jns    802cad <file_slurp+0xe2>
+  802c71:	eb 76                	jmp    802ce9 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802c73:	89 3d 00 94 80 00    	mov    %edi,0x809400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802c79:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c7e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802c83:	e8 ba f2 ff ff       	call   801f42 <fsipc>
+  802c88:	89 c7                	mov    %eax,%edi
+  802c8a:	85 c0                	test   %eax,%eax
+  802c8c:	7e d8                	jle    802c66 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802c8e:	83 ec 04             	sub    $0x4,%esp
+  802c91:	50                   	push   %eax
+  802c92:	68 08 90 80 00       	push   $0x809008
+  802c97:	ff 75 0c             	push   0xc(%ebp)
+  802c9a:	e8 67 e4 ff ff       	call   801106 <memmove>
+  802c9f:	83 c4 10             	add    $0x10,%esp
+  802ca2:	eb c2                	jmp    802c66 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802ca4:	80 fa 2f             	cmp    $0x2f,%dl
+  802ca7:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802caa:	83 c0 01             	add    $0x1,%eax
+  802cad:	89 c1                	mov    %eax,%ecx
+  802caf:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802cb3:	84 d2                	test   %dl,%dl
+  802cb5:	75 ed                	jne    802ca4 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802cb7:	83 ec 04             	sub    $0x4,%esp
+  802cba:	68 80 00 00 00       	push   $0x80
+  802cbf:	53                   	push   %ebx
+  802cc0:	56                   	push   %esi
+  802cc1:	e8 30 e3 ff ff       	call   800ff6 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802cc6:	a1 00 90 80 00       	mov    0x809000,%eax
+  802ccb:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802cd1:	a1 04 90 80 00       	mov    0x809004,%eax
+  802cd6:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802cdc:	c7 86 88 00 00 00 40 	movl   $0x805040,0x88(%esi)
+  802ce3:	50 80 00 
+  802ce6:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802ce9:	89 f8                	mov    %edi,%eax
+  802ceb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cee:	5b                   	pop    %ebx
+  802cef:	5e                   	pop    %esi
+  802cf0:	5f                   	pop    %edi
+  802cf1:	5d                   	pop    %ebp
+  802cf2:	c3                   	ret
+		return -E_BAD_PATH;
+  802cf3:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802cf8:	eb ef                	jmp    802ce9 <file_slurp+0x11e>
+
+00802cfa <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802cfa:	55                   	push   %ebp
+  802cfb:	89 e5                	mov    %esp,%ebp
+  802cfd:	53                   	push   %ebx
+  802cfe:	83 ec 10             	sub    $0x10,%esp
+  802d01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802d04:	53                   	push   %ebx
+  802d05:	e8 3b e2 ff ff       	call   800f45 <strlen>
+  802d0a:	83 c4 10             	add    $0x10,%esp
+  802d0d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802d12:	7f 25                	jg     802d39 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802d14:	83 ec 08             	sub    $0x8,%esp
+  802d17:	53                   	push   %ebx
+  802d18:	68 00 90 80 00       	push   $0x809000
+  802d1d:	e8 5e e2 ff ff       	call   800f80 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802d22:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d27:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d2c:	e8 11 f2 ff ff       	call   801f42 <fsipc>
+  802d31:	83 c4 10             	add    $0x10,%esp
+}
+  802d34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d37:	c9                   	leave
+  802d38:	c3                   	ret
+		return -E_BAD_PATH;
+  802d39:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802d3e:	eb f4                	jmp    802d34 <remove+0x3a>
+
+00802d40 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802d40:	55                   	push   %ebp
+  802d41:	89 e5                	mov    %esp,%ebp
+  802d43:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802d46:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d4b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d50:	e8 ed f1 ff ff       	call   801f42 <fsipc>
+}
+  802d55:	c9                   	leave
+  802d56:	c3                   	ret
+
+00802d57 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802d57:	55                   	push   %ebp
+  802d58:	89 e5                	mov    %esp,%ebp
+  802d5a:	57                   	push   %edi
+  802d5b:	56                   	push   %esi
+  802d5c:	53                   	push   %ebx
+  802d5d:	83 ec 18             	sub    $0x18,%esp
+  802d60:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d63:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802d69:	57                   	push   %edi
+  802d6a:	e8 d6 e1 ff ff       	call   800f45 <strlen>
+  802d6f:	83 c4 10             	add    $0x10,%esp
+  802d72:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802d77:	7f 4c                	jg     802dc5 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802d79:	83 ec 08             	sub    $0x8,%esp
+  802d7c:	57                   	push   %edi
+  802d7d:	68 00 90 80 00       	push   $0x809000
+  802d82:	e8 f9 e1 ff ff       	call   800f80 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802d87:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d8c:	b8 10 00 00 00       	mov    $0x10,%eax
+  802d91:	e8 ac f1 ff ff       	call   801f42 <fsipc>
+  802d96:	83 c4 10             	add    $0x10,%esp
+  802d99:	85 c0                	test   %eax,%eax
+  802d9b:	78 20                	js     802dbd <defrag+0x66>
+		return r;
+	if (before)
+  802d9d:	85 f6                	test   %esi,%esi
+  802d9f:	74 07                	je     802da8 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802da1:	a1 00 90 80 00       	mov    0x809000,%eax
+  802da6:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802da8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802dad:	85 db                	test   %ebx,%ebx
+  802daf:	74 0c                	je     802dbd <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802db1:	a1 04 90 80 00       	mov    0x809004,%eax
+  802db6:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802db8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802dbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dc0:	5b                   	pop    %ebx
+  802dc1:	5e                   	pop    %esi
+  802dc2:	5f                   	pop    %edi
+  802dc3:	5d                   	pop    %ebp
+  802dc4:	c3                   	ret
+		return -E_BAD_PATH;
+  802dc5:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802dca:	eb f1                	jmp    802dbd <defrag+0x66>
+
+00802dcc <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802dcc:	55                   	push   %ebp
+  802dcd:	89 e5                	mov    %esp,%ebp
+  802dcf:	53                   	push   %ebx
+  802dd0:	83 ec 04             	sub    $0x4,%esp
+  802dd3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802dd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ddb:	b8 11 00 00 00       	mov    $0x11,%eax
+  802de0:	e8 5d f1 ff ff       	call   801f42 <fsipc>
+  802de5:	85 c0                	test   %eax,%eax
+  802de7:	78 34                	js     802e1d <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802de9:	a1 00 90 80 00       	mov    0x809000,%eax
+  802dee:	89 03                	mov    %eax,(%ebx)
+  802df0:	a1 04 90 80 00       	mov    0x809004,%eax
+  802df5:	89 43 04             	mov    %eax,0x4(%ebx)
+  802df8:	a1 08 90 80 00       	mov    0x809008,%eax
+  802dfd:	89 43 08             	mov    %eax,0x8(%ebx)
+  802e00:	a1 0c 90 80 00       	mov    0x80900c,%eax
+  802e05:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802e08:	a1 10 90 80 00       	mov    0x809010,%eax
+  802e0d:	89 43 10             	mov    %eax,0x10(%ebx)
+  802e10:	a1 14 90 80 00       	mov    0x809014,%eax
+  802e15:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802e18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e20:	c9                   	leave
+  802e21:	c3                   	ret
+
+00802e22 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e22:	55                   	push   %ebp
+  802e23:	89 e5                	mov    %esp,%ebp
+  802e25:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802e28:	68 76 48 80 00       	push   $0x804876
+  802e2d:	ff 75 0c             	push   0xc(%ebp)
+  802e30:	e8 4b e1 ff ff       	call   800f80 <strcpy>
+	return 0;
+}
+  802e35:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3a:	c9                   	leave
+  802e3b:	c3                   	ret
+
+00802e3c <devsock_close>:
+{
+  802e3c:	55                   	push   %ebp
+  802e3d:	89 e5                	mov    %esp,%ebp
+  802e3f:	53                   	push   %ebx
+  802e40:	83 ec 10             	sub    $0x10,%esp
+  802e43:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802e46:	53                   	push   %ebx
+  802e47:	e8 70 10 00 00       	call   803ebc <pageref>
+  802e4c:	89 c2                	mov    %eax,%edx
+  802e4e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802e51:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802e56:	83 fa 01             	cmp    $0x1,%edx
+  802e59:	74 05                	je     802e60 <devsock_close+0x24>
+}
+  802e5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e5e:	c9                   	leave
+  802e5f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802e60:	83 ec 0c             	sub    $0xc,%esp
+  802e63:	ff 73 0c             	push   0xc(%ebx)
+  802e66:	e8 b7 02 00 00       	call   803122 <nsipc_close>
+  802e6b:	83 c4 10             	add    $0x10,%esp
+  802e6e:	eb eb                	jmp    802e5b <devsock_close+0x1f>
+
+00802e70 <devsock_write>:
+{
+  802e70:	55                   	push   %ebp
+  802e71:	89 e5                	mov    %esp,%ebp
+  802e73:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802e76:	6a 00                	push   $0x0
+  802e78:	ff 75 10             	push   0x10(%ebp)
+  802e7b:	ff 75 0c             	push   0xc(%ebp)
+  802e7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e81:	ff 70 0c             	push   0xc(%eax)
+  802e84:	e8 79 03 00 00       	call   803202 <nsipc_send>
+}
+  802e89:	c9                   	leave
+  802e8a:	c3                   	ret
+
+00802e8b <devsock_read>:
+{
+  802e8b:	55                   	push   %ebp
+  802e8c:	89 e5                	mov    %esp,%ebp
+  802e8e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802e91:	6a 00                	push   $0x0
+  802e93:	ff 75 10             	push   0x10(%ebp)
+  802e96:	ff 75 0c             	push   0xc(%ebp)
+  802e99:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e9c:	ff 70 0c             	push   0xc(%eax)
+  802e9f:	e8 ef 02 00 00       	call   803193 <nsipc_recv>
+}
+  802ea4:	c9                   	leave
+  802ea5:	c3                   	ret
+
+00802ea6 <fd2sockid>:
+{
+  802ea6:	55                   	push   %ebp
+  802ea7:	89 e5                	mov    %esp,%ebp
+  802ea9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802eac:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802eaf:	52                   	push   %edx
+  802eb0:	50                   	push   %eax
+  802eb1:	e8 54 e9 ff ff       	call   80180a <fd_lookup>
+  802eb6:	83 c4 10             	add    $0x10,%esp
+  802eb9:	85 c0                	test   %eax,%eax
+  802ebb:	78 10                	js     802ecd <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802ebd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ec0:	8b 0d 60 50 80 00    	mov    0x805060,%ecx
+  802ec6:	39 08                	cmp    %ecx,(%eax)
+  802ec8:	75 05                	jne    802ecf <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802eca:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802ecd:	c9                   	leave
+  802ece:	c3                   	ret
+		return -E_NOT_SUPP;
+  802ecf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ed4:	eb f7                	jmp    802ecd <fd2sockid+0x27>
+
+00802ed6 <alloc_sockfd>:
+{
+  802ed6:	55                   	push   %ebp
+  802ed7:	89 e5                	mov    %esp,%ebp
+  802ed9:	56                   	push   %esi
+  802eda:	53                   	push   %ebx
+  802edb:	83 ec 1c             	sub    $0x1c,%esp
+  802ede:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802ee0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ee3:	50                   	push   %eax
+  802ee4:	e8 cb e8 ff ff       	call   8017b4 <fd_alloc>
+  802ee9:	89 c3                	mov    %eax,%ebx
+  802eeb:	83 c4 10             	add    $0x10,%esp
+  802eee:	85 c0                	test   %eax,%eax
+  802ef0:	78 43                	js     802f35 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802ef2:	83 ec 04             	sub    $0x4,%esp
+  802ef5:	68 07 04 00 00       	push   $0x407
+  802efa:	ff 75 f4             	push   -0xc(%ebp)
+  802efd:	6a 00                	push   $0x0
+  802eff:	e8 88 e4 ff ff       	call   80138c <sys_page_alloc>
+  802f04:	89 c3                	mov    %eax,%ebx
+  802f06:	83 c4 10             	add    $0x10,%esp
+  802f09:	85 c0                	test   %eax,%eax
+  802f0b:	78 28                	js     802f35 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802f0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f10:	8b 15 60 50 80 00    	mov    0x805060,%edx
+  802f16:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802f18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f1b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802f22:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802f25:	83 ec 0c             	sub    $0xc,%esp
+  802f28:	50                   	push   %eax
+  802f29:	e8 5f e8 ff ff       	call   80178d <fd2num>
+  802f2e:	89 c3                	mov    %eax,%ebx
+  802f30:	83 c4 10             	add    $0x10,%esp
+  802f33:	eb 0c                	jmp    802f41 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802f35:	83 ec 0c             	sub    $0xc,%esp
+  802f38:	56                   	push   %esi
+  802f39:	e8 e4 01 00 00       	call   803122 <nsipc_close>
+		return r;
+  802f3e:	83 c4 10             	add    $0x10,%esp
+}
+  802f41:	89 d8                	mov    %ebx,%eax
+  802f43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f46:	5b                   	pop    %ebx
+  802f47:	5e                   	pop    %esi
+  802f48:	5d                   	pop    %ebp
+  802f49:	c3                   	ret
+
+00802f4a <accept>:
+{
+  802f4a:	55                   	push   %ebp
+  802f4b:	89 e5                	mov    %esp,%ebp
+  802f4d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f50:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f53:	e8 4e ff ff ff       	call   802ea6 <fd2sockid>
+  802f58:	85 c0                	test   %eax,%eax
+  802f5a:	78 1b                	js     802f77 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802f5c:	83 ec 04             	sub    $0x4,%esp
+  802f5f:	ff 75 10             	push   0x10(%ebp)
+  802f62:	ff 75 0c             	push   0xc(%ebp)
+  802f65:	50                   	push   %eax
+  802f66:	e8 0e 01 00 00       	call   803079 <nsipc_accept>
+  802f6b:	83 c4 10             	add    $0x10,%esp
+  802f6e:	85 c0                	test   %eax,%eax
+  802f70:	78 05                	js     802f77 <accept+0x2d>
+	return alloc_sockfd(r);
+  802f72:	e8 5f ff ff ff       	call   802ed6 <alloc_sockfd>
+}
+  802f77:	c9                   	leave
+  802f78:	c3                   	ret
+
+00802f79 <bind>:
+{
+  802f79:	55                   	push   %ebp
+  802f7a:	89 e5                	mov    %esp,%ebp
+  802f7c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f82:	e8 1f ff ff ff       	call   802ea6 <fd2sockid>
+  802f87:	85 c0                	test   %eax,%eax
+  802f89:	78 12                	js     802f9d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802f8b:	83 ec 04             	sub    $0x4,%esp
+  802f8e:	ff 75 10             	push   0x10(%ebp)
+  802f91:	ff 75 0c             	push   0xc(%ebp)
+  802f94:	50                   	push   %eax
+  802f95:	e8 31 01 00 00       	call   8030cb <nsipc_bind>
+  802f9a:	83 c4 10             	add    $0x10,%esp
+}
+  802f9d:	c9                   	leave
+  802f9e:	c3                   	ret
+
+00802f9f <shutdown>:
+{
+  802f9f:	55                   	push   %ebp
+  802fa0:	89 e5                	mov    %esp,%ebp
+  802fa2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fa5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fa8:	e8 f9 fe ff ff       	call   802ea6 <fd2sockid>
+  802fad:	85 c0                	test   %eax,%eax
+  802faf:	78 0f                	js     802fc0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802fb1:	83 ec 08             	sub    $0x8,%esp
+  802fb4:	ff 75 0c             	push   0xc(%ebp)
+  802fb7:	50                   	push   %eax
+  802fb8:	e8 43 01 00 00       	call   803100 <nsipc_shutdown>
+  802fbd:	83 c4 10             	add    $0x10,%esp
+}
+  802fc0:	c9                   	leave
+  802fc1:	c3                   	ret
+
+00802fc2 <connect>:
+{
+  802fc2:	55                   	push   %ebp
+  802fc3:	89 e5                	mov    %esp,%ebp
+  802fc5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fcb:	e8 d6 fe ff ff       	call   802ea6 <fd2sockid>
+  802fd0:	85 c0                	test   %eax,%eax
+  802fd2:	78 12                	js     802fe6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802fd4:	83 ec 04             	sub    $0x4,%esp
+  802fd7:	ff 75 10             	push   0x10(%ebp)
+  802fda:	ff 75 0c             	push   0xc(%ebp)
+  802fdd:	50                   	push   %eax
+  802fde:	e8 59 01 00 00       	call   80313c <nsipc_connect>
+  802fe3:	83 c4 10             	add    $0x10,%esp
+}
+  802fe6:	c9                   	leave
+  802fe7:	c3                   	ret
+
+00802fe8 <listen>:
+{
+  802fe8:	55                   	push   %ebp
+  802fe9:	89 e5                	mov    %esp,%ebp
+  802feb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fee:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ff1:	e8 b0 fe ff ff       	call   802ea6 <fd2sockid>
+  802ff6:	85 c0                	test   %eax,%eax
+  802ff8:	78 0f                	js     803009 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802ffa:	83 ec 08             	sub    $0x8,%esp
+  802ffd:	ff 75 0c             	push   0xc(%ebp)
+  803000:	50                   	push   %eax
+  803001:	e8 6b 01 00 00       	call   803171 <nsipc_listen>
+  803006:	83 c4 10             	add    $0x10,%esp
+}
+  803009:	c9                   	leave
+  80300a:	c3                   	ret
+
+0080300b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80300b:	55                   	push   %ebp
+  80300c:	89 e5                	mov    %esp,%ebp
+  80300e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803011:	ff 75 10             	push   0x10(%ebp)
+  803014:	ff 75 0c             	push   0xc(%ebp)
+  803017:	ff 75 08             	push   0x8(%ebp)
+  80301a:	e8 41 02 00 00       	call   803260 <nsipc_socket>
+  80301f:	83 c4 10             	add    $0x10,%esp
+  803022:	85 c0                	test   %eax,%eax
+  803024:	78 05                	js     80302b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803026:	e8 ab fe ff ff       	call   802ed6 <alloc_sockfd>
+}
+  80302b:	c9                   	leave
+  80302c:	c3                   	ret
+
+0080302d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80302d:	55                   	push   %ebp
+  80302e:	89 e5                	mov    %esp,%ebp
+  803030:	53                   	push   %ebx
+  803031:	83 ec 04             	sub    $0x4,%esp
+  803034:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803036:	83 3d 00 c0 80 00 00 	cmpl   $0x0,0x80c000
+  80303d:	74 26                	je     803065 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80303f:	6a 07                	push   $0x7
+  803041:	68 00 b0 80 00       	push   $0x80b000
+  803046:	53                   	push   %ebx
+  803047:	ff 35 00 c0 80 00    	push   0x80c000
+  80304d:	e8 f2 0c 00 00       	call   803d44 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803052:	83 c4 0c             	add    $0xc,%esp
+  803055:	6a 00                	push   $0x0
+  803057:	6a 00                	push   $0x0
+  803059:	6a 00                	push   $0x0
+  80305b:	e8 79 0c 00 00       	call   803cd9 <ipc_recv>
+}
+  803060:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803063:	c9                   	leave
+  803064:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803065:	83 ec 0c             	sub    $0xc,%esp
+  803068:	6a 02                	push   $0x2
+  80306a:	e8 0e 0e 00 00       	call   803e7d <ipc_find_env>
+  80306f:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  803074:	83 c4 10             	add    $0x10,%esp
+  803077:	eb c6                	jmp    80303f <nsipc+0x12>
+
+00803079 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803079:	55                   	push   %ebp
+  80307a:	89 e5                	mov    %esp,%ebp
+  80307c:	56                   	push   %esi
+  80307d:	53                   	push   %ebx
+  80307e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803081:	8b 45 08             	mov    0x8(%ebp),%eax
+  803084:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  803089:	8b 06                	mov    (%esi),%eax
+  80308b:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803090:	b8 01 00 00 00       	mov    $0x1,%eax
+  803095:	e8 93 ff ff ff       	call   80302d <nsipc>
+  80309a:	89 c3                	mov    %eax,%ebx
+  80309c:	85 c0                	test   %eax,%eax
+  80309e:	79 09                	jns    8030a9 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8030a0:	89 d8                	mov    %ebx,%eax
+  8030a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030a5:	5b                   	pop    %ebx
+  8030a6:	5e                   	pop    %esi
+  8030a7:	5d                   	pop    %ebp
+  8030a8:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8030a9:	83 ec 04             	sub    $0x4,%esp
+  8030ac:	ff 35 10 b0 80 00    	push   0x80b010
+  8030b2:	68 00 b0 80 00       	push   $0x80b000
+  8030b7:	ff 75 0c             	push   0xc(%ebp)
+  8030ba:	e8 47 e0 ff ff       	call   801106 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8030bf:	a1 10 b0 80 00       	mov    0x80b010,%eax
+  8030c4:	89 06                	mov    %eax,(%esi)
+  8030c6:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8030c9:	eb d5                	jmp    8030a0 <nsipc_accept+0x27>
+
+008030cb <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8030cb:	55                   	push   %ebp
+  8030cc:	89 e5                	mov    %esp,%ebp
+  8030ce:	53                   	push   %ebx
+  8030cf:	83 ec 08             	sub    $0x8,%esp
+  8030d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8030d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030d8:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8030dd:	53                   	push   %ebx
+  8030de:	ff 75 0c             	push   0xc(%ebp)
+  8030e1:	68 04 b0 80 00       	push   $0x80b004
+  8030e6:	e8 1b e0 ff ff       	call   801106 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8030eb:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_BIND);
+  8030f1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8030f6:	e8 32 ff ff ff       	call   80302d <nsipc>
+}
+  8030fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030fe:	c9                   	leave
+  8030ff:	c3                   	ret
+
+00803100 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803100:	55                   	push   %ebp
+  803101:	89 e5                	mov    %esp,%ebp
+  803103:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803106:	8b 45 08             	mov    0x8(%ebp),%eax
+  803109:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.shutdown.req_how = how;
+  80310e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803111:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_SHUTDOWN);
+  803116:	b8 03 00 00 00       	mov    $0x3,%eax
+  80311b:	e8 0d ff ff ff       	call   80302d <nsipc>
+}
+  803120:	c9                   	leave
+  803121:	c3                   	ret
+
+00803122 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803122:	55                   	push   %ebp
+  803123:	89 e5                	mov    %esp,%ebp
+  803125:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803128:	8b 45 08             	mov    0x8(%ebp),%eax
+  80312b:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return nsipc(NSREQ_CLOSE);
+  803130:	b8 04 00 00 00       	mov    $0x4,%eax
+  803135:	e8 f3 fe ff ff       	call   80302d <nsipc>
+}
+  80313a:	c9                   	leave
+  80313b:	c3                   	ret
+
+0080313c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80313c:	55                   	push   %ebp
+  80313d:	89 e5                	mov    %esp,%ebp
+  80313f:	53                   	push   %ebx
+  803140:	83 ec 08             	sub    $0x8,%esp
+  803143:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803146:	8b 45 08             	mov    0x8(%ebp),%eax
+  803149:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80314e:	53                   	push   %ebx
+  80314f:	ff 75 0c             	push   0xc(%ebp)
+  803152:	68 04 b0 80 00       	push   $0x80b004
+  803157:	e8 aa df ff ff       	call   801106 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80315c:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_CONNECT);
+  803162:	b8 05 00 00 00       	mov    $0x5,%eax
+  803167:	e8 c1 fe ff ff       	call   80302d <nsipc>
+}
+  80316c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80316f:	c9                   	leave
+  803170:	c3                   	ret
+
+00803171 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803171:	55                   	push   %ebp
+  803172:	89 e5                	mov    %esp,%ebp
+  803174:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803177:	8b 45 08             	mov    0x8(%ebp),%eax
+  80317a:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.listen.req_backlog = backlog;
+  80317f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803182:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_LISTEN);
+  803187:	b8 06 00 00 00       	mov    $0x6,%eax
+  80318c:	e8 9c fe ff ff       	call   80302d <nsipc>
+}
+  803191:	c9                   	leave
+  803192:	c3                   	ret
+
+00803193 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803193:	55                   	push   %ebp
+  803194:	89 e5                	mov    %esp,%ebp
+  803196:	56                   	push   %esi
+  803197:	53                   	push   %ebx
+  803198:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80319b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80319e:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.recv.req_len = len;
+  8031a3:	89 35 04 b0 80 00    	mov    %esi,0x80b004
+	nsipcbuf.recv.req_flags = flags;
+  8031a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031ac:	a3 08 b0 80 00       	mov    %eax,0x80b008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8031b1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8031b6:	e8 72 fe ff ff       	call   80302d <nsipc>
+  8031bb:	89 c3                	mov    %eax,%ebx
+  8031bd:	85 c0                	test   %eax,%eax
+  8031bf:	78 22                	js     8031e3 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8031c1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8031c6:	39 c6                	cmp    %eax,%esi
+  8031c8:	0f 4e c6             	cmovle %esi,%eax
+  8031cb:	39 c3                	cmp    %eax,%ebx
+  8031cd:	7f 1d                	jg     8031ec <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8031cf:	83 ec 04             	sub    $0x4,%esp
+  8031d2:	53                   	push   %ebx
+  8031d3:	68 00 b0 80 00       	push   $0x80b000
+  8031d8:	ff 75 0c             	push   0xc(%ebp)
+  8031db:	e8 26 df ff ff       	call   801106 <memmove>
+  8031e0:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8031e3:	89 d8                	mov    %ebx,%eax
+  8031e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031e8:	5b                   	pop    %ebx
+  8031e9:	5e                   	pop    %esi
+  8031ea:	5d                   	pop    %ebp
+  8031eb:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8031ec:	68 82 48 80 00       	push   $0x804882
+  8031f1:	68 20 48 80 00       	push   $0x804820
+  8031f6:	6a 62                	push   $0x62
+  8031f8:	68 97 48 80 00       	push   $0x804897
+  8031fd:	e8 b5 d6 ff ff       	call   8008b7 <_panic>
+
+00803202 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803202:	55                   	push   %ebp
+  803203:	89 e5                	mov    %esp,%ebp
+  803205:	53                   	push   %ebx
+  803206:	83 ec 04             	sub    $0x4,%esp
+  803209:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80320c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80320f:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	assert(size < 1600);
+  803214:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80321a:	7f 2e                	jg     80324a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80321c:	83 ec 04             	sub    $0x4,%esp
+  80321f:	53                   	push   %ebx
+  803220:	ff 75 0c             	push   0xc(%ebp)
+  803223:	68 0c b0 80 00       	push   $0x80b00c
+  803228:	e8 d9 de ff ff       	call   801106 <memmove>
+	nsipcbuf.send.req_size = size;
+  80322d:	89 1d 04 b0 80 00    	mov    %ebx,0x80b004
+	nsipcbuf.send.req_flags = flags;
+  803233:	8b 45 14             	mov    0x14(%ebp),%eax
+  803236:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SEND);
+  80323b:	b8 08 00 00 00       	mov    $0x8,%eax
+  803240:	e8 e8 fd ff ff       	call   80302d <nsipc>
+}
+  803245:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803248:	c9                   	leave
+  803249:	c3                   	ret
+	assert(size < 1600);
+  80324a:	68 a3 48 80 00       	push   $0x8048a3
+  80324f:	68 20 48 80 00       	push   $0x804820
+  803254:	6a 6d                	push   $0x6d
+  803256:	68 97 48 80 00       	push   $0x804897
+  80325b:	e8 57 d6 ff ff       	call   8008b7 <_panic>
+
+00803260 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803260:	55                   	push   %ebp
+  803261:	89 e5                	mov    %esp,%ebp
+  803263:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803266:	8b 45 08             	mov    0x8(%ebp),%eax
+  803269:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.socket.req_type = type;
+  80326e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803271:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	nsipcbuf.socket.req_protocol = protocol;
+  803276:	8b 45 10             	mov    0x10(%ebp),%eax
+  803279:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SOCKET);
+  80327e:	b8 09 00 00 00       	mov    $0x9,%eax
+  803283:	e8 a5 fd ff ff       	call   80302d <nsipc>
+}
+  803288:	c9                   	leave
+  803289:	c3                   	ret
+
+0080328a <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  80328a:	55                   	push   %ebp
+  80328b:	89 e5                	mov    %esp,%ebp
+  80328d:	53                   	push   %ebx
+  80328e:	83 ec 04             	sub    $0x4,%esp
+  803291:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint8_t *c;
+	uint32_t *ref;
+
+	if (v == 0)
+  803294:	85 db                	test   %ebx,%ebx
+  803296:	0f 84 85 00 00 00    	je     803321 <free+0x97>
+		return;
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  80329c:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8032a2:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8032a7:	77 51                	ja     8032fa <free+0x70>
+
+	c = ROUNDDOWN(v, PGSIZE);
+  8032a9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  8032af:	89 d8                	mov    %ebx,%eax
+  8032b1:	c1 e8 0c             	shr    $0xc,%eax
+  8032b4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8032bb:	f6 c4 02             	test   $0x2,%ah
+  8032be:	74 50                	je     803310 <free+0x86>
+		sys_page_unmap(0, c);
+  8032c0:	83 ec 08             	sub    $0x8,%esp
+  8032c3:	53                   	push   %ebx
+  8032c4:	6a 00                	push   $0x0
+  8032c6:	e8 4e e1 ff ff       	call   801419 <sys_page_unmap>
+		c += PGSIZE;
+  8032cb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  8032d1:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8032d7:	83 c4 10             	add    $0x10,%esp
+  8032da:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  8032df:	76 ce                	jbe    8032af <free+0x25>
+  8032e1:	68 eb 48 80 00       	push   $0x8048eb
+  8032e6:	68 20 48 80 00       	push   $0x804820
+  8032eb:	68 81 00 00 00       	push   $0x81
+  8032f0:	68 de 48 80 00       	push   $0x8048de
+  8032f5:	e8 bd d5 ff ff       	call   8008b7 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  8032fa:	68 b0 48 80 00       	push   $0x8048b0
+  8032ff:	68 20 48 80 00       	push   $0x804820
+  803304:	6a 7a                	push   $0x7a
+  803306:	68 de 48 80 00       	push   $0x8048de
+  80330b:	e8 a7 d5 ff ff       	call   8008b7 <_panic>
+	/*
+	 * c is just a piece of this page, so dec the ref count
+	 * and maybe free the page.
+	 */
+	ref = (uint32_t*) (c + PGSIZE - 4);
+	if (--(*ref) == 0)
+  803310:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  803316:	83 e8 01             	sub    $0x1,%eax
+  803319:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  80331f:	74 05                	je     803326 <free+0x9c>
+		sys_page_unmap(0, c);
+}
+  803321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803324:	c9                   	leave
+  803325:	c3                   	ret
+		sys_page_unmap(0, c);
+  803326:	83 ec 08             	sub    $0x8,%esp
+  803329:	53                   	push   %ebx
+  80332a:	6a 00                	push   $0x0
+  80332c:	e8 e8 e0 ff ff       	call   801419 <sys_page_unmap>
+  803331:	83 c4 10             	add    $0x10,%esp
+  803334:	eb eb                	jmp    803321 <free+0x97>
+
+00803336 <malloc>:
+{
+  803336:	55                   	push   %ebp
+  803337:	89 e5                	mov    %esp,%ebp
+  803339:	57                   	push   %edi
+  80333a:	56                   	push   %esi
+  80333b:	53                   	push   %ebx
+  80333c:	83 ec 1c             	sub    $0x1c,%esp
+	if (mptr == 0)
+  80333f:	a1 04 c0 80 00       	mov    0x80c004,%eax
+  803344:	85 c0                	test   %eax,%eax
+  803346:	74 6c                	je     8033b4 <malloc+0x7e>
+	n = ROUNDUP(n, 4);
+  803348:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80334b:	8d 57 03             	lea    0x3(%edi),%edx
+  80334e:	89 d6                	mov    %edx,%esi
+  803350:	83 e6 fc             	and    $0xfffffffc,%esi
+	if (n >= MAXMALLOC)
+  803353:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  803359:	0f 87 55 01 00 00    	ja     8034b4 <malloc+0x17e>
+	if ((uintptr_t) mptr % PGSIZE){
+  80335f:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  803364:	74 30                	je     803396 <malloc+0x60>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  803366:	89 c3                	mov    %eax,%ebx
+  803368:	c1 eb 0c             	shr    $0xc,%ebx
+  80336b:	8d 54 30 03          	lea    0x3(%eax,%esi,1),%edx
+  80336f:	c1 ea 0c             	shr    $0xc,%edx
+  803372:	39 d3                	cmp    %edx,%ebx
+  803374:	74 60                	je     8033d6 <malloc+0xa0>
+		free(mptr);	/* drop reference to this page */
+  803376:	83 ec 0c             	sub    $0xc,%esp
+  803379:	50                   	push   %eax
+  80337a:	e8 0b ff ff ff       	call   80328a <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  80337f:	a1 04 c0 80 00       	mov    0x80c004,%eax
+  803384:	05 00 10 00 00       	add    $0x1000,%eax
+  803389:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80338e:	a3 04 c0 80 00       	mov    %eax,0x80c004
+  803393:	83 c4 10             	add    $0x10,%esp
+  803396:	8b 0d 04 c0 80 00    	mov    0x80c004,%ecx
+{
+  80339c:	ba 02 00 00 00       	mov    $0x2,%edx
+  8033a1:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  8033a5:	8d 7e 04             	lea    0x4(%esi),%edi
+  8033a8:	89 cb                	mov    %ecx,%ebx
+  8033aa:	01 f9                	add    %edi,%ecx
+  8033ac:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8033af:	e9 8e 00 00 00       	jmp    803442 <malloc+0x10c>
+		mptr = mbegin;
+  8033b4:	c7 05 04 c0 80 00 00 	movl   $0x8000000,0x80c004
+  8033bb:	00 00 08 
+	n = ROUNDUP(n, 4);
+  8033be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033c1:	8d 57 03             	lea    0x3(%edi),%edx
+  8033c4:	89 d6                	mov    %edx,%esi
+  8033c6:	83 e6 fc             	and    $0xfffffffc,%esi
+	if (n >= MAXMALLOC)
+  8033c9:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8033cf:	76 c5                	jbe    803396 <malloc+0x60>
+  8033d1:	e9 d6 00 00 00       	jmp    8034ac <malloc+0x176>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  8033d6:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  8033dc:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+			(*ref)++;
+  8033e2:	83 42 fc 01          	addl   $0x1,-0x4(%edx)
+			mptr += n;
+  8033e6:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  8033e9:	89 15 04 c0 80 00    	mov    %edx,0x80c004
+			return v;
+  8033ef:	e9 b8 00 00 00       	jmp    8034ac <malloc+0x176>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  8033f4:	05 00 10 00 00       	add    $0x1000,%eax
+  8033f9:	39 c8                	cmp    %ecx,%eax
+  8033fb:	0f 83 ba 00 00 00    	jae    8034bb <malloc+0x185>
+		if (va >= (uintptr_t) mend
+  803401:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  803406:	77 22                	ja     80342a <malloc+0xf4>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  803408:	89 c2                	mov    %eax,%edx
+  80340a:	c1 ea 16             	shr    $0x16,%edx
+  80340d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803414:	f6 c2 01             	test   $0x1,%dl
+  803417:	74 db                	je     8033f4 <malloc+0xbe>
+  803419:	89 c2                	mov    %eax,%edx
+  80341b:	c1 ea 0c             	shr    $0xc,%edx
+  80341e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803425:	f6 c2 01             	test   $0x1,%dl
+  803428:	74 ca                	je     8033f4 <malloc+0xbe>
+		if (mptr == mend) {
+  80342a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803430:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  803436:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  80343a:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  803440:	74 04                	je     803446 <malloc+0x110>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  803442:	89 d8                	mov    %ebx,%eax
+  803444:	eb b3                	jmp    8033f9 <malloc+0xc3>
+  803446:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  803449:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  80344e:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  803452:	83 ea 01             	sub    $0x1,%edx
+  803455:	0f 85 4d ff ff ff    	jne    8033a8 <malloc+0x72>
+  80345b:	c7 05 04 c0 80 00 00 	movl   $0x8000000,0x80c004
+  803462:	00 00 08 
+				return 0;	/* out of address space */
+  803465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346a:	eb 40                	jmp    8034ac <malloc+0x176>
+				sys_page_unmap(0, mptr + i);
+  80346c:	83 ec 08             	sub    $0x8,%esp
+  80346f:	89 d8                	mov    %ebx,%eax
+  803471:	03 05 04 c0 80 00    	add    0x80c004,%eax
+  803477:	50                   	push   %eax
+  803478:	6a 00                	push   $0x0
+  80347a:	e8 9a df ff ff       	call   801419 <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  80347f:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  803485:	83 c4 10             	add    $0x10,%esp
+  803488:	85 db                	test   %ebx,%ebx
+  80348a:	79 e0                	jns    80346c <malloc+0x136>
+			return 0;	/* out of physical memory */
+  80348c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803491:	eb 19                	jmp    8034ac <malloc+0x176>
+	ref = (uint32_t*) (mptr + i - 4);
+  803493:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803496:	a1 04 c0 80 00       	mov    0x80c004,%eax
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  80349b:	c7 44 18 fc 02 00 00 	movl   $0x2,-0x4(%eax,%ebx,1)
+  8034a2:	00 
+	mptr += n;
+  8034a3:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  8034a6:	89 15 04 c0 80 00    	mov    %edx,0x80c004
+}
+  8034ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034af:	5b                   	pop    %ebx
+  8034b0:	5e                   	pop    %esi
+  8034b1:	5f                   	pop    %edi
+  8034b2:	5d                   	pop    %ebp
+  8034b3:	c3                   	ret
+		return 0;
+  8034b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b9:	eb f1                	jmp    8034ac <malloc+0x176>
+  8034bb:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  8034bf:	74 06                	je     8034c7 <malloc+0x191>
+  8034c1:	89 1d 04 c0 80 00    	mov    %ebx,0x80c004
+	for (i = 0; i < n + 4; i += PGSIZE){
+  8034c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034cc:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8034cf:	39 fb                	cmp    %edi,%ebx
+  8034d1:	73 c0                	jae    803493 <malloc+0x15d>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8034d3:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8034d9:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  8034dc:	39 fe                	cmp    %edi,%esi
+  8034de:	0f 92 c0             	setb   %al
+  8034e1:	0f b6 c0             	movzbl %al,%eax
+  8034e4:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  8034e7:	83 c8 07             	or     $0x7,%eax
+  8034ea:	50                   	push   %eax
+  8034eb:	89 d8                	mov    %ebx,%eax
+  8034ed:	03 05 04 c0 80 00    	add    0x80c004,%eax
+  8034f3:	50                   	push   %eax
+  8034f4:	6a 00                	push   $0x0
+  8034f6:	e8 91 de ff ff       	call   80138c <sys_page_alloc>
+  8034fb:	83 c4 10             	add    $0x10,%esp
+  8034fe:	85 c0                	test   %eax,%eax
+  803500:	78 86                	js     803488 <malloc+0x152>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  803502:	89 f3                	mov    %esi,%ebx
+  803504:	eb c9                	jmp    8034cf <malloc+0x199>
+
+00803506 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803506:	55                   	push   %ebp
+  803507:	89 e5                	mov    %esp,%ebp
+  803509:	56                   	push   %esi
+  80350a:	53                   	push   %ebx
+  80350b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80350e:	83 ec 0c             	sub    $0xc,%esp
+  803511:	ff 75 08             	push   0x8(%ebp)
+  803514:	e8 84 e2 ff ff       	call   80179d <fd2data>
+  803519:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80351b:	83 c4 08             	add    $0x8,%esp
+  80351e:	68 03 49 80 00       	push   $0x804903
+  803523:	53                   	push   %ebx
+  803524:	e8 57 da ff ff       	call   800f80 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803529:	8b 46 04             	mov    0x4(%esi),%eax
+  80352c:	2b 06                	sub    (%esi),%eax
+  80352e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803534:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80353b:	00 00 00 
+	stat->st_dev = &devpipe;
+  80353e:	c7 83 88 00 00 00 80 	movl   $0x805080,0x88(%ebx)
+  803545:	50 80 00 
+	return 0;
+}
+  803548:	b8 00 00 00 00       	mov    $0x0,%eax
+  80354d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803550:	5b                   	pop    %ebx
+  803551:	5e                   	pop    %esi
+  803552:	5d                   	pop    %ebp
+  803553:	c3                   	ret
+
+00803554 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803554:	55                   	push   %ebp
+  803555:	89 e5                	mov    %esp,%ebp
+  803557:	53                   	push   %ebx
+  803558:	83 ec 0c             	sub    $0xc,%esp
+  80355b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80355e:	53                   	push   %ebx
+  80355f:	6a 00                	push   $0x0
+  803561:	e8 b3 de ff ff       	call   801419 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803566:	89 1c 24             	mov    %ebx,(%esp)
+  803569:	e8 2f e2 ff ff       	call   80179d <fd2data>
+  80356e:	83 c4 08             	add    $0x8,%esp
+  803571:	50                   	push   %eax
+  803572:	6a 00                	push   $0x0
+  803574:	e8 a0 de ff ff       	call   801419 <sys_page_unmap>
+}
+  803579:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80357c:	c9                   	leave
+  80357d:	c3                   	ret
+
+0080357e <_pipeisclosed>:
+{
+  80357e:	55                   	push   %ebp
+  80357f:	89 e5                	mov    %esp,%ebp
+  803581:	57                   	push   %edi
+  803582:	56                   	push   %esi
+  803583:	53                   	push   %ebx
+  803584:	83 ec 1c             	sub    $0x1c,%esp
+  803587:	89 c7                	mov    %eax,%edi
+  803589:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80358b:	a1 10 80 80 00       	mov    0x808010,%eax
+  803590:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803593:	83 ec 0c             	sub    $0xc,%esp
+  803596:	57                   	push   %edi
+  803597:	e8 20 09 00 00       	call   803ebc <pageref>
+  80359c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80359f:	89 34 24             	mov    %esi,(%esp)
+  8035a2:	e8 15 09 00 00       	call   803ebc <pageref>
+		nn = thisenv->env_runs;
+  8035a7:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8035ad:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8035b0:	83 c4 10             	add    $0x10,%esp
+  8035b3:	39 cb                	cmp    %ecx,%ebx
+  8035b5:	74 1b                	je     8035d2 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8035b7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8035ba:	75 cf                	jne    80358b <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8035bc:	8b 42 58             	mov    0x58(%edx),%eax
+  8035bf:	6a 01                	push   $0x1
+  8035c1:	50                   	push   %eax
+  8035c2:	53                   	push   %ebx
+  8035c3:	68 0a 49 80 00       	push   $0x80490a
+  8035c8:	e8 c5 d3 ff ff       	call   800992 <cprintf>
+  8035cd:	83 c4 10             	add    $0x10,%esp
+  8035d0:	eb b9                	jmp    80358b <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8035d2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8035d5:	0f 94 c0             	sete   %al
+  8035d8:	0f b6 c0             	movzbl %al,%eax
+}
+  8035db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035de:	5b                   	pop    %ebx
+  8035df:	5e                   	pop    %esi
+  8035e0:	5f                   	pop    %edi
+  8035e1:	5d                   	pop    %ebp
+  8035e2:	c3                   	ret
+
+008035e3 <devpipe_write>:
+{
+  8035e3:	55                   	push   %ebp
+  8035e4:	89 e5                	mov    %esp,%ebp
+  8035e6:	57                   	push   %edi
+  8035e7:	56                   	push   %esi
+  8035e8:	53                   	push   %ebx
+  8035e9:	83 ec 28             	sub    $0x28,%esp
+  8035ec:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8035ef:	56                   	push   %esi
+  8035f0:	e8 a8 e1 ff ff       	call   80179d <fd2data>
+  8035f5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8035f7:	83 c4 10             	add    $0x10,%esp
+  8035fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035ff:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803602:	75 09                	jne    80360d <devpipe_write+0x2a>
+	return i;
+  803604:	89 f8                	mov    %edi,%eax
+  803606:	eb 23                	jmp    80362b <devpipe_write+0x48>
+			sys_yield();
+  803608:	e8 60 dd ff ff       	call   80136d <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80360d:	8b 43 04             	mov    0x4(%ebx),%eax
+  803610:	8b 0b                	mov    (%ebx),%ecx
+  803612:	8d 51 20             	lea    0x20(%ecx),%edx
+  803615:	39 d0                	cmp    %edx,%eax
+  803617:	72 1a                	jb     803633 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803619:	89 da                	mov    %ebx,%edx
+  80361b:	89 f0                	mov    %esi,%eax
+  80361d:	e8 5c ff ff ff       	call   80357e <_pipeisclosed>
+  803622:	85 c0                	test   %eax,%eax
+  803624:	74 e2                	je     803608 <devpipe_write+0x25>
+				return 0;
+  803626:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80362b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80362e:	5b                   	pop    %ebx
+  80362f:	5e                   	pop    %esi
+  803630:	5f                   	pop    %edi
+  803631:	5d                   	pop    %ebp
+  803632:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803633:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803636:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80363a:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80363d:	89 c2                	mov    %eax,%edx
+  80363f:	c1 fa 1f             	sar    $0x1f,%edx
+  803642:	89 d1                	mov    %edx,%ecx
+  803644:	c1 e9 1b             	shr    $0x1b,%ecx
+  803647:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80364a:	83 e2 1f             	and    $0x1f,%edx
+  80364d:	29 ca                	sub    %ecx,%edx
+  80364f:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803653:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803657:	83 c0 01             	add    $0x1,%eax
+  80365a:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80365d:	83 c7 01             	add    $0x1,%edi
+  803660:	eb 9d                	jmp    8035ff <devpipe_write+0x1c>
+
+00803662 <devpipe_read>:
+{
+  803662:	55                   	push   %ebp
+  803663:	89 e5                	mov    %esp,%ebp
+  803665:	57                   	push   %edi
+  803666:	56                   	push   %esi
+  803667:	53                   	push   %ebx
+  803668:	83 ec 18             	sub    $0x18,%esp
+  80366b:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80366e:	57                   	push   %edi
+  80366f:	e8 29 e1 ff ff       	call   80179d <fd2data>
+  803674:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803676:	83 c4 10             	add    $0x10,%esp
+  803679:	be 00 00 00 00       	mov    $0x0,%esi
+  80367e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803681:	75 13                	jne    803696 <devpipe_read+0x34>
+	return i;
+  803683:	89 f0                	mov    %esi,%eax
+  803685:	eb 02                	jmp    803689 <devpipe_read+0x27>
+				return i;
+  803687:	89 f0                	mov    %esi,%eax
+}
+  803689:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80368c:	5b                   	pop    %ebx
+  80368d:	5e                   	pop    %esi
+  80368e:	5f                   	pop    %edi
+  80368f:	5d                   	pop    %ebp
+  803690:	c3                   	ret
+			sys_yield();
+  803691:	e8 d7 dc ff ff       	call   80136d <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803696:	8b 03                	mov    (%ebx),%eax
+  803698:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80369b:	75 18                	jne    8036b5 <devpipe_read+0x53>
+			if (i > 0)
+  80369d:	85 f6                	test   %esi,%esi
+  80369f:	75 e6                	jne    803687 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8036a1:	89 da                	mov    %ebx,%edx
+  8036a3:	89 f8                	mov    %edi,%eax
+  8036a5:	e8 d4 fe ff ff       	call   80357e <_pipeisclosed>
+  8036aa:	85 c0                	test   %eax,%eax
+  8036ac:	74 e3                	je     803691 <devpipe_read+0x2f>
+				return 0;
+  8036ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b3:	eb d4                	jmp    803689 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8036b5:	99                   	cltd
+  8036b6:	c1 ea 1b             	shr    $0x1b,%edx
+  8036b9:	01 d0                	add    %edx,%eax
+  8036bb:	83 e0 1f             	and    $0x1f,%eax
+  8036be:	29 d0                	sub    %edx,%eax
+  8036c0:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8036c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8036c8:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8036cb:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8036ce:	83 c6 01             	add    $0x1,%esi
+  8036d1:	eb ab                	jmp    80367e <devpipe_read+0x1c>
+
+008036d3 <pipe>:
+{
+  8036d3:	55                   	push   %ebp
+  8036d4:	89 e5                	mov    %esp,%ebp
+  8036d6:	56                   	push   %esi
+  8036d7:	53                   	push   %ebx
+  8036d8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8036db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8036de:	50                   	push   %eax
+  8036df:	e8 d0 e0 ff ff       	call   8017b4 <fd_alloc>
+  8036e4:	89 c3                	mov    %eax,%ebx
+  8036e6:	83 c4 10             	add    $0x10,%esp
+  8036e9:	85 c0                	test   %eax,%eax
+  8036eb:	0f 88 23 01 00 00    	js     803814 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8036f1:	83 ec 04             	sub    $0x4,%esp
+  8036f4:	68 07 04 00 00       	push   $0x407
+  8036f9:	ff 75 f4             	push   -0xc(%ebp)
+  8036fc:	6a 00                	push   $0x0
+  8036fe:	e8 89 dc ff ff       	call   80138c <sys_page_alloc>
+  803703:	89 c3                	mov    %eax,%ebx
+  803705:	83 c4 10             	add    $0x10,%esp
+  803708:	85 c0                	test   %eax,%eax
+  80370a:	0f 88 04 01 00 00    	js     803814 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803710:	83 ec 0c             	sub    $0xc,%esp
+  803713:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803716:	50                   	push   %eax
+  803717:	e8 98 e0 ff ff       	call   8017b4 <fd_alloc>
+  80371c:	89 c3                	mov    %eax,%ebx
+  80371e:	83 c4 10             	add    $0x10,%esp
+  803721:	85 c0                	test   %eax,%eax
+  803723:	0f 88 db 00 00 00    	js     803804 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803729:	83 ec 04             	sub    $0x4,%esp
+  80372c:	68 07 04 00 00       	push   $0x407
+  803731:	ff 75 f0             	push   -0x10(%ebp)
+  803734:	6a 00                	push   $0x0
+  803736:	e8 51 dc ff ff       	call   80138c <sys_page_alloc>
+  80373b:	89 c3                	mov    %eax,%ebx
+  80373d:	83 c4 10             	add    $0x10,%esp
+  803740:	85 c0                	test   %eax,%eax
+  803742:	0f 88 bc 00 00 00    	js     803804 <pipe+0x131>
+	va = fd2data(fd0);
+  803748:	83 ec 0c             	sub    $0xc,%esp
+  80374b:	ff 75 f4             	push   -0xc(%ebp)
+  80374e:	e8 4a e0 ff ff       	call   80179d <fd2data>
+  803753:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803755:	83 c4 0c             	add    $0xc,%esp
+  803758:	68 07 04 00 00       	push   $0x407
+  80375d:	50                   	push   %eax
+  80375e:	6a 00                	push   $0x0
+  803760:	e8 27 dc ff ff       	call   80138c <sys_page_alloc>
+  803765:	89 c3                	mov    %eax,%ebx
+  803767:	83 c4 10             	add    $0x10,%esp
+  80376a:	85 c0                	test   %eax,%eax
+  80376c:	0f 88 82 00 00 00    	js     8037f4 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803772:	83 ec 0c             	sub    $0xc,%esp
+  803775:	ff 75 f0             	push   -0x10(%ebp)
+  803778:	e8 20 e0 ff ff       	call   80179d <fd2data>
+  80377d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803784:	50                   	push   %eax
+  803785:	6a 00                	push   $0x0
+  803787:	56                   	push   %esi
+  803788:	6a 00                	push   $0x0
+  80378a:	e8 48 dc ff ff       	call   8013d7 <sys_page_map>
+  80378f:	89 c3                	mov    %eax,%ebx
+  803791:	83 c4 20             	add    $0x20,%esp
+  803794:	85 c0                	test   %eax,%eax
+  803796:	78 4e                	js     8037e6 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803798:	a1 80 50 80 00       	mov    0x805080,%eax
+  80379d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8037a0:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8037a2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8037a5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8037ac:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8037af:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8037b1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8037b4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8037bb:	83 ec 0c             	sub    $0xc,%esp
+  8037be:	ff 75 f4             	push   -0xc(%ebp)
+  8037c1:	e8 c7 df ff ff       	call   80178d <fd2num>
+  8037c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8037c9:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8037cb:	83 c4 04             	add    $0x4,%esp
+  8037ce:	ff 75 f0             	push   -0x10(%ebp)
+  8037d1:	e8 b7 df ff ff       	call   80178d <fd2num>
+  8037d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8037d9:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8037dc:	83 c4 10             	add    $0x10,%esp
+  8037df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037e4:	eb 2e                	jmp    803814 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8037e6:	83 ec 08             	sub    $0x8,%esp
+  8037e9:	56                   	push   %esi
+  8037ea:	6a 00                	push   $0x0
+  8037ec:	e8 28 dc ff ff       	call   801419 <sys_page_unmap>
+  8037f1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8037f4:	83 ec 08             	sub    $0x8,%esp
+  8037f7:	ff 75 f0             	push   -0x10(%ebp)
+  8037fa:	6a 00                	push   $0x0
+  8037fc:	e8 18 dc ff ff       	call   801419 <sys_page_unmap>
+  803801:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803804:	83 ec 08             	sub    $0x8,%esp
+  803807:	ff 75 f4             	push   -0xc(%ebp)
+  80380a:	6a 00                	push   $0x0
+  80380c:	e8 08 dc ff ff       	call   801419 <sys_page_unmap>
+  803811:	83 c4 10             	add    $0x10,%esp
+}
+  803814:	89 d8                	mov    %ebx,%eax
+  803816:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803819:	5b                   	pop    %ebx
+  80381a:	5e                   	pop    %esi
+  80381b:	5d                   	pop    %ebp
+  80381c:	c3                   	ret
+
+0080381d <pipeisclosed>:
+{
+  80381d:	55                   	push   %ebp
+  80381e:	89 e5                	mov    %esp,%ebp
+  803820:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803823:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803826:	50                   	push   %eax
+  803827:	ff 75 08             	push   0x8(%ebp)
+  80382a:	e8 db df ff ff       	call   80180a <fd_lookup>
+  80382f:	83 c4 10             	add    $0x10,%esp
+  803832:	85 c0                	test   %eax,%eax
+  803834:	78 18                	js     80384e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803836:	83 ec 0c             	sub    $0xc,%esp
+  803839:	ff 75 f4             	push   -0xc(%ebp)
+  80383c:	e8 5c df ff ff       	call   80179d <fd2data>
+  803841:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803843:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803846:	e8 33 fd ff ff       	call   80357e <_pipeisclosed>
+  80384b:	83 c4 10             	add    $0x10,%esp
+}
+  80384e:	c9                   	leave
+  80384f:	c3                   	ret
+
+00803850 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803850:	b8 00 00 00 00       	mov    $0x0,%eax
+  803855:	c3                   	ret
+
+00803856 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803856:	55                   	push   %ebp
+  803857:	89 e5                	mov    %esp,%ebp
+  803859:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80385c:	68 22 49 80 00       	push   $0x804922
+  803861:	ff 75 0c             	push   0xc(%ebp)
+  803864:	e8 17 d7 ff ff       	call   800f80 <strcpy>
+	return 0;
+}
+  803869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80386e:	c9                   	leave
+  80386f:	c3                   	ret
+
+00803870 <devcons_write>:
+{
+  803870:	55                   	push   %ebp
+  803871:	89 e5                	mov    %esp,%ebp
+  803873:	57                   	push   %edi
+  803874:	56                   	push   %esi
+  803875:	53                   	push   %ebx
+  803876:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80387c:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803881:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803887:	eb 2e                	jmp    8038b7 <devcons_write+0x47>
+		m = n - tot;
+  803889:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80388c:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80388e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803893:	39 c3                	cmp    %eax,%ebx
+  803895:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803898:	83 ec 04             	sub    $0x4,%esp
+  80389b:	53                   	push   %ebx
+  80389c:	89 f0                	mov    %esi,%eax
+  80389e:	03 45 0c             	add    0xc(%ebp),%eax
+  8038a1:	50                   	push   %eax
+  8038a2:	57                   	push   %edi
+  8038a3:	e8 5e d8 ff ff       	call   801106 <memmove>
+		sys_cputs(buf, m);
+  8038a8:	83 c4 08             	add    $0x8,%esp
+  8038ab:	53                   	push   %ebx
+  8038ac:	57                   	push   %edi
+  8038ad:	e8 fe d9 ff ff       	call   8012b0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8038b2:	01 de                	add    %ebx,%esi
+  8038b4:	83 c4 10             	add    $0x10,%esp
+  8038b7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8038ba:	72 cd                	jb     803889 <devcons_write+0x19>
+}
+  8038bc:	89 f0                	mov    %esi,%eax
+  8038be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038c1:	5b                   	pop    %ebx
+  8038c2:	5e                   	pop    %esi
+  8038c3:	5f                   	pop    %edi
+  8038c4:	5d                   	pop    %ebp
+  8038c5:	c3                   	ret
+
+008038c6 <devcons_read>:
+{
+  8038c6:	55                   	push   %ebp
+  8038c7:	89 e5                	mov    %esp,%ebp
+  8038c9:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8038cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8038d5:	75 07                	jne    8038de <devcons_read+0x18>
+  8038d7:	eb 1f                	jmp    8038f8 <devcons_read+0x32>
+		sys_yield();
+  8038d9:	e8 8f da ff ff       	call   80136d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8038de:	e8 f3 d9 ff ff       	call   8012d6 <sys_cgetc>
+  8038e3:	85 c0                	test   %eax,%eax
+  8038e5:	74 f2                	je     8038d9 <devcons_read+0x13>
+	if (c < 0)
+  8038e7:	78 0f                	js     8038f8 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8038e9:	83 f8 04             	cmp    $0x4,%eax
+  8038ec:	74 0c                	je     8038fa <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8038ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8038f1:	88 02                	mov    %al,(%edx)
+	return 1;
+  8038f3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8038f8:	c9                   	leave
+  8038f9:	c3                   	ret
+		return 0;
+  8038fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ff:	eb f7                	jmp    8038f8 <devcons_read+0x32>
+
+00803901 <cputchar>:
+{
+  803901:	55                   	push   %ebp
+  803902:	89 e5                	mov    %esp,%ebp
+  803904:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803907:	8b 45 08             	mov    0x8(%ebp),%eax
+  80390a:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80390d:	6a 01                	push   $0x1
+  80390f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803912:	50                   	push   %eax
+  803913:	e8 98 d9 ff ff       	call   8012b0 <sys_cputs>
+}
+  803918:	83 c4 10             	add    $0x10,%esp
+  80391b:	c9                   	leave
+  80391c:	c3                   	ret
+
+0080391d <getchar>:
+{
+  80391d:	55                   	push   %ebp
+  80391e:	89 e5                	mov    %esp,%ebp
+  803920:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803923:	6a 01                	push   $0x1
+  803925:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803928:	50                   	push   %eax
+  803929:	6a 00                	push   $0x0
+  80392b:	e8 40 e1 ff ff       	call   801a70 <read>
+	if (r < 0)
+  803930:	83 c4 10             	add    $0x10,%esp
+  803933:	85 c0                	test   %eax,%eax
+  803935:	78 06                	js     80393d <getchar+0x20>
+	if (r < 1)
+  803937:	74 06                	je     80393f <getchar+0x22>
+	return c;
+  803939:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80393d:	c9                   	leave
+  80393e:	c3                   	ret
+		return -E_EOF;
+  80393f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803944:	eb f7                	jmp    80393d <getchar+0x20>
+
+00803946 <iscons>:
+{
+  803946:	55                   	push   %ebp
+  803947:	89 e5                	mov    %esp,%ebp
+  803949:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80394c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80394f:	50                   	push   %eax
+  803950:	ff 75 08             	push   0x8(%ebp)
+  803953:	e8 b2 de ff ff       	call   80180a <fd_lookup>
+  803958:	83 c4 10             	add    $0x10,%esp
+  80395b:	85 c0                	test   %eax,%eax
+  80395d:	78 11                	js     803970 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80395f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803962:	8b 15 a0 50 80 00    	mov    0x8050a0,%edx
+  803968:	39 10                	cmp    %edx,(%eax)
+  80396a:	0f 94 c0             	sete   %al
+  80396d:	0f b6 c0             	movzbl %al,%eax
+}
+  803970:	c9                   	leave
+  803971:	c3                   	ret
+
+00803972 <opencons>:
+{
+  803972:	55                   	push   %ebp
+  803973:	89 e5                	mov    %esp,%ebp
+  803975:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803978:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80397b:	50                   	push   %eax
+  80397c:	e8 33 de ff ff       	call   8017b4 <fd_alloc>
+  803981:	83 c4 10             	add    $0x10,%esp
+  803984:	85 c0                	test   %eax,%eax
+  803986:	78 3a                	js     8039c2 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803988:	83 ec 04             	sub    $0x4,%esp
+  80398b:	68 07 04 00 00       	push   $0x407
+  803990:	ff 75 f4             	push   -0xc(%ebp)
+  803993:	6a 00                	push   $0x0
+  803995:	e8 f2 d9 ff ff       	call   80138c <sys_page_alloc>
+  80399a:	83 c4 10             	add    $0x10,%esp
+  80399d:	85 c0                	test   %eax,%eax
+  80399f:	78 21                	js     8039c2 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8039a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039a4:	8b 15 a0 50 80 00    	mov    0x8050a0,%edx
+  8039aa:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8039ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039af:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8039b6:	83 ec 0c             	sub    $0xc,%esp
+  8039b9:	50                   	push   %eax
+  8039ba:	e8 ce dd ff ff       	call   80178d <fd2num>
+  8039bf:	83 c4 10             	add    $0x10,%esp
+}
+  8039c2:	c9                   	leave
+  8039c3:	c3                   	ret
+
+008039c4 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  8039c4:	55                   	push   %ebp
+  8039c5:	89 e5                	mov    %esp,%ebp
+  8039c7:	57                   	push   %edi
+  8039c8:	56                   	push   %esi
+  8039c9:	53                   	push   %ebx
+  8039ca:	83 ec 20             	sub    $0x20,%esp
+  8039cd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8039d0:	89 d7                	mov    %edx,%edi
+  8039d2:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  8039d4:	51                   	push   %ecx
+  8039d5:	68 00 f0 7f 00       	push   $0x7ff000
+  8039da:	6a 00                	push   $0x0
+  8039dc:	e8 ab d9 ff ff       	call   80138c <sys_page_alloc>
+  8039e1:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8039e3:	83 c4 10             	add    $0x10,%esp
+  8039e6:	85 c0                	test   %eax,%eax
+  8039e8:	78 45                	js     803a2f <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  8039ea:	83 ec 04             	sub    $0x4,%esp
+  8039ed:	68 00 10 00 00       	push   $0x1000
+  8039f2:	57                   	push   %edi
+  8039f3:	68 00 f0 7f 00       	push   $0x7ff000
+  8039f8:	e8 09 d7 ff ff       	call   801106 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8039fd:	89 34 24             	mov    %esi,(%esp)
+  803a00:	57                   	push   %edi
+  803a01:	ff 75 e4             	push   -0x1c(%ebp)
+  803a04:	68 00 f0 7f 00       	push   $0x7ff000
+  803a09:	6a 00                	push   $0x0
+  803a0b:	e8 c7 d9 ff ff       	call   8013d7 <sys_page_map>
+  803a10:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803a12:	83 c4 20             	add    $0x20,%esp
+  803a15:	85 c0                	test   %eax,%eax
+  803a17:	78 16                	js     803a2f <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803a19:	83 ec 08             	sub    $0x8,%esp
+  803a1c:	68 00 f0 7f 00       	push   $0x7ff000
+  803a21:	6a 00                	push   $0x0
+  803a23:	e8 f1 d9 ff ff       	call   801419 <sys_page_unmap>
+  803a28:	83 c4 10             	add    $0x10,%esp
+  803a2b:	85 c0                	test   %eax,%eax
+  803a2d:	75 0a                	jne    803a39 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  803a2f:	89 d8                	mov    %ebx,%eax
+  803a31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a34:	5b                   	pop    %ebx
+  803a35:	5e                   	pop    %esi
+  803a36:	5f                   	pop    %edi
+  803a37:	5d                   	pop    %ebp
+  803a38:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803a39:	68 30 49 80 00       	push   $0x804930
+  803a3e:	68 20 48 80 00       	push   $0x804820
+  803a43:	6a 1b                	push   $0x1b
+  803a45:	68 a8 49 80 00       	push   $0x8049a8
+  803a4a:	e8 68 ce ff ff       	call   8008b7 <_panic>
+
+00803a4f <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803a4f:	55                   	push   %ebp
+  803a50:	89 e5                	mov    %esp,%ebp
+  803a52:	53                   	push   %ebx
+  803a53:	83 ec 04             	sub    $0x4,%esp
+  803a56:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803a59:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803a5b:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  803a5f:	74 21                	je     803a82 <pgfault+0x33>
+  803a61:	89 d0                	mov    %edx,%eax
+  803a63:	c1 e8 16             	shr    $0x16,%eax
+  803a66:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803a6d:	a8 01                	test   $0x1,%al
+  803a6f:	74 11                	je     803a82 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803a71:	89 d0                	mov    %edx,%eax
+  803a73:	c1 e8 0c             	shr    $0xc,%eax
+  803a76:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803a7d:	f6 c4 08             	test   $0x8,%ah
+  803a80:	75 17                	jne    803a99 <pgfault+0x4a>
+		if (pgfault_next) {
+  803a82:	a1 08 c0 80 00       	mov    0x80c008,%eax
+  803a87:	85 c0                	test   %eax,%eax
+  803a89:	74 27                	je     803ab2 <pgfault+0x63>
+			pgfault_next(utf);
+  803a8b:	83 ec 0c             	sub    $0xc,%esp
+  803a8e:	53                   	push   %ebx
+  803a8f:	ff d0                	call   *%eax
+			return;
+  803a91:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803a94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a97:	c9                   	leave
+  803a98:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803a99:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803a9f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803aa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aa9:	e8 16 ff ff ff       	call   8039c4 <copy_page_to>
+  803aae:	85 c0                	test   %eax,%eax
+  803ab0:	79 e2                	jns    803a94 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803ab2:	a1 10 80 80 00       	mov    0x808010,%eax
+  803ab7:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803aba:	ff 73 28             	push   0x28(%ebx)
+  803abd:	ff 33                	push   (%ebx)
+  803abf:	50                   	push   %eax
+  803ac0:	68 54 49 80 00       	push   $0x804954
+  803ac5:	e8 c8 ce ff ff       	call   800992 <cprintf>
+	sys_env_destroy(0);
+  803aca:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803ad1:	e8 27 d8 ff ff       	call   8012fd <sys_env_destroy>
+  803ad6:	83 c4 10             	add    $0x10,%esp
+  803ad9:	eb b9                	jmp    803a94 <pgfault+0x45>
+
+00803adb <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803adb:	55                   	push   %ebp
+  803adc:	89 e5                	mov    %esp,%ebp
+  803ade:	53                   	push   %ebx
+  803adf:	83 ec 04             	sub    $0x4,%esp
+  803ae2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803ae5:	a1 0c c0 80 00       	mov    0x80c00c,%eax
+  803aea:	3d 4f 3a 80 00       	cmp    $0x803a4f,%eax
+  803aef:	74 15                	je     803b06 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803af1:	a3 08 c0 80 00       	mov    %eax,0x80c008
+		set_pgfault_handler(pgfault);
+  803af6:	83 ec 0c             	sub    $0xc,%esp
+  803af9:	68 4f 3a 80 00       	push   $0x803a4f
+  803afe:	e8 fb 03 00 00       	call   803efe <set_pgfault_handler>
+  803b03:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803b06:	83 ec 0c             	sub    $0xc,%esp
+  803b09:	68 05 08 00 00       	push   $0x805
+  803b0e:	53                   	push   %ebx
+  803b0f:	6a 00                	push   $0x0
+  803b11:	53                   	push   %ebx
+  803b12:	6a 00                	push   $0x0
+  803b14:	e8 be d8 ff ff       	call   8013d7 <sys_page_map>
+}
+  803b19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b1c:	c9                   	leave
+  803b1d:	c3                   	ret
+
+00803b1e <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803b1e:	55                   	push   %ebp
+  803b1f:	89 e5                	mov    %esp,%ebp
+  803b21:	57                   	push   %edi
+  803b22:	56                   	push   %esi
+  803b23:	53                   	push   %ebx
+  803b24:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  803b27:	68 4f 3a 80 00       	push   $0x803a4f
+  803b2c:	e8 cd 03 00 00       	call   803efe <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803b31:	b8 07 00 00 00       	mov    $0x7,%eax
+  803b36:	cd 30                	int    $0x30
+  803b38:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803b3b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  803b3e:	83 c4 10             	add    $0x10,%esp
+  803b41:	85 c0                	test   %eax,%eax
+  803b43:	0f 88 6b 01 00 00    	js     803cb4 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803b49:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803b4e:	75 37                	jne    803b87 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803b50:	e8 f1 d7 ff ff       	call   801346 <sys_getenvid>
+  803b55:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803b5a:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803b60:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b65:	a3 10 80 80 00       	mov    %eax,0x808010
+		return 0;
+  803b6a:	e9 45 01 00 00       	jmp    803cb4 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803b6f:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803b75:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803b7b:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803b81:	0f 87 ba 00 00 00    	ja     803c41 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803b87:	89 d8                	mov    %ebx,%eax
+  803b89:	c1 e8 16             	shr    $0x16,%eax
+  803b8c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803b93:	a8 01                	test   $0x1,%al
+  803b95:	74 d8                	je     803b6f <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803b97:	89 d8                	mov    %ebx,%eax
+  803b99:	c1 e8 0c             	shr    $0xc,%eax
+  803b9c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803ba3:	f6 c2 01             	test   $0x1,%dl
+  803ba6:	74 cd                	je     803b75 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803ba8:	89 da                	mov    %ebx,%edx
+  803baa:	80 e6 df             	and    $0xdf,%dh
+  803bad:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803bb3:	74 c0                	je     803b75 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803bb5:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803bb7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803bbe:	f6 c6 04             	test   $0x4,%dh
+  803bc1:	75 53                	jne    803c16 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803bc3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803bca:	f6 c6 08             	test   $0x8,%dh
+  803bcd:	75 0c                	jne    803bdb <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803bcf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803bd6:	f6 c2 02             	test   $0x2,%dl
+  803bd9:	74 3b                	je     803c16 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803bdb:	83 ec 0c             	sub    $0xc,%esp
+  803bde:	68 05 08 00 00       	push   $0x805
+  803be3:	57                   	push   %edi
+  803be4:	ff 75 e4             	push   -0x1c(%ebp)
+  803be7:	57                   	push   %edi
+  803be8:	6a 00                	push   $0x0
+  803bea:	e8 e8 d7 ff ff       	call   8013d7 <sys_page_map>
+  803bef:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803bf1:	83 c4 20             	add    $0x20,%esp
+  803bf4:	85 c0                	test   %eax,%eax
+  803bf6:	0f 88 a7 00 00 00    	js     803ca3 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803bfc:	83 ec 0c             	sub    $0xc,%esp
+  803bff:	68 05 08 00 00       	push   $0x805
+  803c04:	57                   	push   %edi
+  803c05:	6a 00                	push   $0x0
+  803c07:	57                   	push   %edi
+  803c08:	6a 00                	push   $0x0
+  803c0a:	e8 c8 d7 ff ff       	call   8013d7 <sys_page_map>
+  803c0f:	89 c6                	mov    %eax,%esi
+	return r;
+  803c11:	83 c4 20             	add    $0x20,%esp
+  803c14:	eb 21                	jmp    803c37 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803c16:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803c1d:	83 ec 0c             	sub    $0xc,%esp
+  803c20:	25 07 0e 00 00       	and    $0xe07,%eax
+  803c25:	50                   	push   %eax
+  803c26:	57                   	push   %edi
+  803c27:	ff 75 e4             	push   -0x1c(%ebp)
+  803c2a:	57                   	push   %edi
+  803c2b:	6a 00                	push   $0x0
+  803c2d:	e8 a5 d7 ff ff       	call   8013d7 <sys_page_map>
+  803c32:	89 c6                	mov    %eax,%esi
+  803c34:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  803c37:	85 f6                	test   %esi,%esi
+  803c39:	0f 89 36 ff ff ff    	jns    803b75 <fork+0x57>
+  803c3f:	eb 62                	jmp    803ca3 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803c41:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803c46:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  803c4b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803c4e:	89 f8                	mov    %edi,%eax
+  803c50:	e8 6f fd ff ff       	call   8039c4 <copy_page_to>
+  803c55:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803c57:	85 c0                	test   %eax,%eax
+  803c59:	78 48                	js     803ca3 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803c5b:	83 ec 04             	sub    $0x4,%esp
+  803c5e:	6a 07                	push   $0x7
+  803c60:	68 00 f0 bf ee       	push   $0xeebff000
+  803c65:	57                   	push   %edi
+  803c66:	e8 21 d7 ff ff       	call   80138c <sys_page_alloc>
+  803c6b:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803c6d:	83 c4 10             	add    $0x10,%esp
+  803c70:	85 c0                	test   %eax,%eax
+  803c72:	78 2f                	js     803ca3 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803c74:	a1 10 80 80 00       	mov    0x808010,%eax
+  803c79:	8b 40 64             	mov    0x64(%eax),%eax
+  803c7c:	83 ec 08             	sub    $0x8,%esp
+  803c7f:	50                   	push   %eax
+  803c80:	57                   	push   %edi
+  803c81:	e8 71 d8 ff ff       	call   8014f7 <sys_env_set_pgfault_upcall>
+  803c86:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803c88:	83 c4 10             	add    $0x10,%esp
+  803c8b:	85 c0                	test   %eax,%eax
+  803c8d:	78 14                	js     803ca3 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803c8f:	83 ec 08             	sub    $0x8,%esp
+  803c92:	6a 02                	push   $0x2
+  803c94:	57                   	push   %edi
+  803c95:	e8 c9 d7 ff ff       	call   801463 <sys_env_set_status>
+  803c9a:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803c9c:	83 c4 10             	add    $0x10,%esp
+  803c9f:	85 c0                	test   %eax,%eax
+  803ca1:	79 11                	jns    803cb4 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803ca3:	83 ec 0c             	sub    $0xc,%esp
+  803ca6:	ff 75 e0             	push   -0x20(%ebp)
+  803ca9:	e8 4f d6 ff ff       	call   8012fd <sys_env_destroy>
+	return r;
+  803cae:	83 c4 10             	add    $0x10,%esp
+  803cb1:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803cb4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803cb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cba:	5b                   	pop    %ebx
+  803cbb:	5e                   	pop    %esi
+  803cbc:	5f                   	pop    %edi
+  803cbd:	5d                   	pop    %ebp
+  803cbe:	c3                   	ret
+
+00803cbf <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803cbf:	55                   	push   %ebp
+  803cc0:	89 e5                	mov    %esp,%ebp
+  803cc2:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803cc5:	68 b3 49 80 00       	push   $0x8049b3
+  803cca:	68 bf 00 00 00       	push   $0xbf
+  803ccf:	68 a8 49 80 00       	push   $0x8049a8
+  803cd4:	e8 de cb ff ff       	call   8008b7 <_panic>
+
+00803cd9 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803cd9:	55                   	push   %ebp
+  803cda:	89 e5                	mov    %esp,%ebp
+  803cdc:	56                   	push   %esi
+  803cdd:	53                   	push   %ebx
+  803cde:	8b 75 08             	mov    0x8(%ebp),%esi
+  803ce1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803ce4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803ce7:	85 c0                	test   %eax,%eax
+  803ce9:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803cee:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803cf1:	83 ec 0c             	sub    $0xc,%esp
+  803cf4:	50                   	push   %eax
+  803cf5:	e8 da d8 ff ff       	call   8015d4 <sys_ipc_recv>
+	if (from_env_store)
+  803cfa:	83 c4 10             	add    $0x10,%esp
+  803cfd:	85 f6                	test   %esi,%esi
+  803cff:	74 14                	je     803d15 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803d01:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d06:	85 c0                	test   %eax,%eax
+  803d08:	75 09                	jne    803d13 <ipc_recv+0x3a>
+  803d0a:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803d10:	8b 52 74             	mov    0x74(%edx),%edx
+  803d13:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803d15:	85 db                	test   %ebx,%ebx
+  803d17:	74 25                	je     803d3e <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803d19:	85 c0                	test   %eax,%eax
+  803d1b:	74 0d                	je     803d2a <ipc_recv+0x51>
+  803d1d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803d23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d26:	5b                   	pop    %ebx
+  803d27:	5e                   	pop    %esi
+  803d28:	5d                   	pop    %ebp
+  803d29:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803d2a:	a1 10 80 80 00       	mov    0x808010,%eax
+  803d2f:	8b 40 78             	mov    0x78(%eax),%eax
+  803d32:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803d34:	a1 10 80 80 00       	mov    0x808010,%eax
+  803d39:	8b 40 70             	mov    0x70(%eax),%eax
+  803d3c:	eb e5                	jmp    803d23 <ipc_recv+0x4a>
+  803d3e:	85 c0                	test   %eax,%eax
+  803d40:	75 e1                	jne    803d23 <ipc_recv+0x4a>
+  803d42:	eb f0                	jmp    803d34 <ipc_recv+0x5b>
+
+00803d44 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803d44:	55                   	push   %ebp
+  803d45:	89 e5                	mov    %esp,%ebp
+  803d47:	57                   	push   %edi
+  803d48:	56                   	push   %esi
+  803d49:	53                   	push   %ebx
+  803d4a:	83 ec 0c             	sub    $0xc,%esp
+  803d4d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803d50:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803d53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803d56:	85 db                	test   %ebx,%ebx
+  803d58:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803d5d:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803d60:	ff 75 14             	push   0x14(%ebp)
+  803d63:	53                   	push   %ebx
+  803d64:	56                   	push   %esi
+  803d65:	57                   	push   %edi
+  803d66:	e8 d6 d7 ff ff       	call   801541 <sys_ipc_try_send>
+  803d6b:	83 c4 10             	add    $0x10,%esp
+  803d6e:	85 c0                	test   %eax,%eax
+  803d70:	74 22                	je     803d94 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803d72:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803d75:	75 07                	jne    803d7e <ipc_send+0x3a>
+		sys_yield();
+  803d77:	e8 f1 d5 ff ff       	call   80136d <sys_yield>
+  803d7c:	eb e2                	jmp    803d60 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803d7e:	68 c9 49 80 00       	push   $0x8049c9
+  803d83:	68 20 48 80 00       	push   $0x804820
+  803d88:	6a 39                	push   $0x39
+  803d8a:	68 de 49 80 00       	push   $0x8049de
+  803d8f:	e8 23 cb ff ff       	call   8008b7 <_panic>
+	}
+}
+  803d94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d97:	5b                   	pop    %ebx
+  803d98:	5e                   	pop    %esi
+  803d99:	5f                   	pop    %edi
+  803d9a:	5d                   	pop    %ebp
+  803d9b:	c3                   	ret
+
+00803d9c <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803d9c:	55                   	push   %ebp
+  803d9d:	89 e5                	mov    %esp,%ebp
+  803d9f:	57                   	push   %edi
+  803da0:	56                   	push   %esi
+  803da1:	53                   	push   %ebx
+  803da2:	83 ec 10             	sub    $0x10,%esp
+  803da5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803da8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803dab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803dae:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803db1:	85 c0                	test   %eax,%eax
+  803db3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803db8:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803dbb:	6a 00                	push   $0x0
+  803dbd:	ff 33                	push   (%ebx)
+  803dbf:	50                   	push   %eax
+  803dc0:	e8 cc d7 ff ff       	call   801591 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803dc5:	83 c4 10             	add    $0x10,%esp
+  803dc8:	85 c0                	test   %eax,%eax
+  803dca:	75 3c                	jne    803e08 <ipc_recvv+0x6c>
+  803dcc:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803dd2:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803dd5:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803dd7:	85 ff                	test   %edi,%edi
+  803dd9:	74 4e                	je     803e29 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803ddb:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803de1:	8b 52 74             	mov    0x74(%edx),%edx
+  803de4:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803de6:	85 f6                	test   %esi,%esi
+  803de8:	74 18                	je     803e02 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803dea:	85 c0                	test   %eax,%eax
+  803dec:	75 2d                	jne    803e1b <ipc_recvv+0x7f>
+  803dee:	a1 10 80 80 00       	mov    0x808010,%eax
+  803df3:	8b 40 78             	mov    0x78(%eax),%eax
+  803df6:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803df8:	a1 10 80 80 00       	mov    0x808010,%eax
+  803dfd:	8b 40 70             	mov    0x70(%eax),%eax
+  803e00:	eb 1f                	jmp    803e21 <ipc_recvv+0x85>
+  803e02:	85 c0                	test   %eax,%eax
+  803e04:	75 1b                	jne    803e21 <ipc_recvv+0x85>
+  803e06:	eb f0                	jmp    803df8 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803e08:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803e13:	85 ff                	test   %edi,%edi
+  803e15:	75 cd                	jne    803de4 <ipc_recvv+0x48>
+	if (perm_store)
+  803e17:	85 f6                	test   %esi,%esi
+  803e19:	74 e7                	je     803e02 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803e1b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803e21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e24:	5b                   	pop    %ebx
+  803e25:	5e                   	pop    %esi
+  803e26:	5f                   	pop    %edi
+  803e27:	5d                   	pop    %ebp
+  803e28:	c3                   	ret
+	if (perm_store)
+  803e29:	85 f6                	test   %esi,%esi
+  803e2b:	75 bd                	jne    803dea <ipc_recvv+0x4e>
+  803e2d:	eb c9                	jmp    803df8 <ipc_recvv+0x5c>
+
+00803e2f <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803e2f:	55                   	push   %ebp
+  803e30:	89 e5                	mov    %esp,%ebp
+  803e32:	57                   	push   %edi
+  803e33:	56                   	push   %esi
+  803e34:	53                   	push   %ebx
+  803e35:	83 ec 0c             	sub    $0xc,%esp
+  803e38:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803e3b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803e3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  803e41:	ff 75 14             	push   0x14(%ebp)
+  803e44:	53                   	push   %ebx
+  803e45:	56                   	push   %esi
+  803e46:	57                   	push   %edi
+  803e47:	e8 1d d7 ff ff       	call   801569 <sys_ipc_try_sendv>
+  803e4c:	83 c4 10             	add    $0x10,%esp
+  803e4f:	85 c0                	test   %eax,%eax
+  803e51:	74 22                	je     803e75 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803e53:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803e56:	75 07                	jne    803e5f <ipc_sendv+0x30>
+		sys_yield();
+  803e58:	e8 10 d5 ff ff       	call   80136d <sys_yield>
+  803e5d:	eb e2                	jmp    803e41 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803e5f:	68 c9 49 80 00       	push   $0x8049c9
+  803e64:	68 20 48 80 00       	push   $0x804820
+  803e69:	6a 5c                	push   $0x5c
+  803e6b:	68 de 49 80 00       	push   $0x8049de
+  803e70:	e8 42 ca ff ff       	call   8008b7 <_panic>
+	}
+}
+  803e75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e78:	5b                   	pop    %ebx
+  803e79:	5e                   	pop    %esi
+  803e7a:	5f                   	pop    %edi
+  803e7b:	5d                   	pop    %ebp
+  803e7c:	c3                   	ret
+
+00803e7d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803e7d:	55                   	push   %ebp
+  803e7e:	89 e5                	mov    %esp,%ebp
+  803e80:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803e83:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803e88:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803e8e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803e94:	8b 52 50             	mov    0x50(%edx),%edx
+  803e97:	39 ca                	cmp    %ecx,%edx
+  803e99:	74 11                	je     803eac <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803e9b:	83 c0 01             	add    $0x1,%eax
+  803e9e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803ea3:	75 e3                	jne    803e88 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eaa:	eb 0e                	jmp    803eba <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803eac:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803eb2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803eb7:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803eba:	5d                   	pop    %ebp
+  803ebb:	c3                   	ret
+
+00803ebc <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803ebc:	55                   	push   %ebp
+  803ebd:	89 e5                	mov    %esp,%ebp
+  803ebf:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803ec2:	89 c2                	mov    %eax,%edx
+  803ec4:	c1 ea 16             	shr    $0x16,%edx
+  803ec7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803ece:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803ed3:	f6 c1 01             	test   $0x1,%cl
+  803ed6:	74 22                	je     803efa <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803ed8:	c1 e8 0c             	shr    $0xc,%eax
+  803edb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803ee2:	a8 01                	test   $0x1,%al
+  803ee4:	74 14                	je     803efa <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803ee6:	c1 e8 0c             	shr    $0xc,%eax
+  803ee9:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803eec:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803ef3:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803ef7:	0f b7 d2             	movzwl %dx,%edx
+}
+  803efa:	89 d0                	mov    %edx,%eax
+  803efc:	5d                   	pop    %ebp
+  803efd:	c3                   	ret
+
+00803efe <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803efe:	55                   	push   %ebp
+  803eff:	89 e5                	mov    %esp,%ebp
+  803f01:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803f04:	83 3d 0c c0 80 00 00 	cmpl   $0x0,0x80c00c
+  803f0b:	74 0a                	je     803f17 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803f0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f10:	a3 0c c0 80 00       	mov    %eax,0x80c00c
+}
+  803f15:	c9                   	leave
+  803f16:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803f17:	83 ec 04             	sub    $0x4,%esp
+  803f1a:	6a 07                	push   $0x7
+  803f1c:	68 00 f0 bf ee       	push   $0xeebff000
+  803f21:	6a 00                	push   $0x0
+  803f23:	e8 64 d4 ff ff       	call   80138c <sys_page_alloc>
+  803f28:	83 c4 10             	add    $0x10,%esp
+  803f2b:	85 c0                	test   %eax,%eax
+  803f2d:	75 2c                	jne    803f5b <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803f2f:	83 ec 08             	sub    $0x8,%esp
+  803f32:	68 71 3f 80 00       	push   $0x803f71
+  803f37:	6a 00                	push   $0x0
+  803f39:	e8 b9 d5 ff ff       	call   8014f7 <sys_env_set_pgfault_upcall>
+  803f3e:	83 c4 10             	add    $0x10,%esp
+  803f41:	85 c0                	test   %eax,%eax
+  803f43:	74 c8                	je     803f0d <set_pgfault_handler+0xf>
+  803f45:	68 30 4a 80 00       	push   $0x804a30
+  803f4a:	68 20 48 80 00       	push   $0x804820
+  803f4f:	6a 20                	push   $0x20
+  803f51:	68 60 4a 80 00       	push   $0x804a60
+  803f56:	e8 5c c9 ff ff       	call   8008b7 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803f5b:	68 e8 49 80 00       	push   $0x8049e8
+  803f60:	68 20 48 80 00       	push   $0x804820
+  803f65:	6a 1e                	push   $0x1e
+  803f67:	68 60 4a 80 00       	push   $0x804a60
+  803f6c:	e8 46 c9 ff ff       	call   8008b7 <_panic>
+
+00803f71 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803f71:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803f72:	a1 0c c0 80 00       	mov    0x80c00c,%eax
+	call *%eax
+  803f77:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803f79:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803f7c:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803f81:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803f86:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803f8a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803f8d:	83 c4 08             	add    $0x8,%esp
+	popal
+  803f90:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803f91:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803f94:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803f95:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803f96:	c3                   	ret
+
+00803f97 <dm>:
+  803f97:	55                   	push   %ebp
+  803f98:	57                   	push   %edi
+  803f99:	56                   	push   %esi
+  803f9a:	53                   	push   %ebx
+  803f9b:	83 ec 24             	sub    $0x24,%esp
+  803f9e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803fa2:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803fa6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803faa:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803fae:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803fb2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803fb6:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803fba:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fc9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803fd0:	00 
+  803fd1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803fd8:	00 
+  803fd9:	89 fb                	mov    %edi,%ebx
+  803fdb:	eb 08                	jmp    803fe5 <dm+0x4e>
+  803fdd:	83 e9 01             	sub    $0x1,%ecx
+  803fe0:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803fe3:	74 68                	je     80404d <dm+0xb6>
+  803fe5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803fe9:	01 c0                	add    %eax,%eax
+  803feb:	89 c6                	mov    %eax,%esi
+  803fed:	89 d7                	mov    %edx,%edi
+  803fef:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803ff3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803ff7:	0f ad d0             	shrd   %cl,%edx,%eax
+  803ffa:	d3 ea                	shr    %cl,%edx
+  803ffc:	f6 c1 20             	test   $0x20,%cl
+  803fff:	74 04                	je     804005 <dm+0x6e>
+  804001:	89 d0                	mov    %edx,%eax
+  804003:	31 d2                	xor    %edx,%edx
+  804005:	83 e0 01             	and    $0x1,%eax
+  804008:	89 04 24             	mov    %eax,(%esp)
+  80400b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804012:	00 
+  804013:	8b 04 24             	mov    (%esp),%eax
+  804016:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80401a:	09 f0                	or     %esi,%eax
+  80401c:	09 fa                	or     %edi,%edx
+  80401e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804022:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804026:	39 f0                	cmp    %esi,%eax
+  804028:	89 d5                	mov    %edx,%ebp
+  80402a:	19 fd                	sbb    %edi,%ebp
+  80402c:	72 af                	jb     803fdd <dm+0x46>
+  80402e:	29 f0                	sub    %esi,%eax
+  804030:	19 fa                	sbb    %edi,%edx
+  804032:	89 cf                	mov    %ecx,%edi
+  804034:	c1 ef 05             	shr    $0x5,%edi
+  804037:	83 e7 01             	and    $0x1,%edi
+  80403a:	89 fe                	mov    %edi,%esi
+  80403c:	83 f6 01             	xor    $0x1,%esi
+  80403f:	d3 e6                	shl    %cl,%esi
+  804041:	d3 e7                	shl    %cl,%edi
+  804043:	09 74 24 18          	or     %esi,0x18(%esp)
+  804047:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80404b:	eb 90                	jmp    803fdd <dm+0x46>
+  80404d:	85 db                	test   %ebx,%ebx
+  80404f:	74 05                	je     804056 <dm+0xbf>
+  804051:	89 03                	mov    %eax,(%ebx)
+  804053:	89 53 04             	mov    %edx,0x4(%ebx)
+  804056:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80405a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80405e:	83 c4 24             	add    $0x24,%esp
+  804061:	5b                   	pop    %ebx
+  804062:	5e                   	pop    %esi
+  804063:	5f                   	pop    %edi
+  804064:	5d                   	pop    %ebp
+  804065:	c3                   	ret
+
+00804066 <__udivdi3>:
+  804066:	83 ec 08             	sub    $0x8,%esp
+  804069:	6a 00                	push   $0x0
+  80406b:	ff 74 24 1c          	push   0x1c(%esp)
+  80406f:	ff 74 24 1c          	push   0x1c(%esp)
+  804073:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804077:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80407b:	e8 17 ff ff ff       	call   803f97 <dm>
+  804080:	83 c4 14             	add    $0x14,%esp
+  804083:	c3                   	ret
+
+00804084 <__umoddi3>:
+  804084:	83 ec 18             	sub    $0x18,%esp
+  804087:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80408b:	50                   	push   %eax
+  80408c:	ff 74 24 2c          	push   0x2c(%esp)
+  804090:	ff 74 24 2c          	push   0x2c(%esp)
+  804094:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804098:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80409c:	e8 f6 fe ff ff       	call   803f97 <dm>
+  8040a1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8040a5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8040a9:	83 c4 24             	add    $0x24,%esp
+  8040ac:	c3                   	ret
+
+008040ad <__divdi3>:
+  8040ad:	53                   	push   %ebx
+  8040ae:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8040b2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8040b6:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8040ba:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8040be:	85 d2                	test   %edx,%edx
+  8040c0:	78 15                	js     8040d7 <__divdi3+0x2a>
+  8040c2:	85 db                	test   %ebx,%ebx
+  8040c4:	78 34                	js     8040fa <__divdi3+0x4d>
+  8040c6:	83 ec 04             	sub    $0x4,%esp
+  8040c9:	6a 00                	push   $0x0
+  8040cb:	53                   	push   %ebx
+  8040cc:	51                   	push   %ecx
+  8040cd:	e8 c5 fe ff ff       	call   803f97 <dm>
+  8040d2:	83 c4 10             	add    $0x10,%esp
+  8040d5:	eb 21                	jmp    8040f8 <__divdi3+0x4b>
+  8040d7:	f7 d8                	neg    %eax
+  8040d9:	83 d2 00             	adc    $0x0,%edx
+  8040dc:	f7 da                	neg    %edx
+  8040de:	85 db                	test   %ebx,%ebx
+  8040e0:	78 30                	js     804112 <__divdi3+0x65>
+  8040e2:	83 ec 04             	sub    $0x4,%esp
+  8040e5:	6a 00                	push   $0x0
+  8040e7:	53                   	push   %ebx
+  8040e8:	51                   	push   %ecx
+  8040e9:	e8 a9 fe ff ff       	call   803f97 <dm>
+  8040ee:	83 c4 10             	add    $0x10,%esp
+  8040f1:	f7 d8                	neg    %eax
+  8040f3:	83 d2 00             	adc    $0x0,%edx
+  8040f6:	f7 da                	neg    %edx
+  8040f8:	5b                   	pop    %ebx
+  8040f9:	c3                   	ret
+  8040fa:	83 ec 04             	sub    $0x4,%esp
+  8040fd:	6a 00                	push   $0x0
+  8040ff:	f7 d9                	neg    %ecx
+  804101:	83 d3 00             	adc    $0x0,%ebx
+  804104:	f7 db                	neg    %ebx
+  804106:	53                   	push   %ebx
+  804107:	51                   	push   %ecx
+  804108:	e8 8a fe ff ff       	call   803f97 <dm>
+  80410d:	83 c4 10             	add    $0x10,%esp
+  804110:	eb df                	jmp    8040f1 <__divdi3+0x44>
+  804112:	83 ec 04             	sub    $0x4,%esp
+  804115:	6a 00                	push   $0x0
+  804117:	f7 d9                	neg    %ecx
+  804119:	83 d3 00             	adc    $0x0,%ebx
+  80411c:	f7 db                	neg    %ebx
+  80411e:	53                   	push   %ebx
+  80411f:	51                   	push   %ecx
+  804120:	e8 72 fe ff ff       	call   803f97 <dm>
+  804125:	83 c4 10             	add    $0x10,%esp
+  804128:	eb ce                	jmp    8040f8 <__divdi3+0x4b>
+
+0080412a <__moddi3>:
+  80412a:	55                   	push   %ebp
+  80412b:	57                   	push   %edi
+  80412c:	56                   	push   %esi
+  80412d:	53                   	push   %ebx
+  80412e:	83 ec 24             	sub    $0x24,%esp
+  804131:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804135:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804139:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80413d:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804141:	85 d2                	test   %edx,%edx
+  804143:	78 3b                	js     804180 <__moddi3+0x56>
+  804145:	83 ec 04             	sub    $0x4,%esp
+  804148:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80414c:	56                   	push   %esi
+  80414d:	89 ce                	mov    %ecx,%esi
+  80414f:	f7 de                	neg    %esi
+  804151:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804155:	89 de                	mov    %ebx,%esi
+  804157:	83 d6 00             	adc    $0x0,%esi
+  80415a:	f7 de                	neg    %esi
+  80415c:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804160:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804164:	0f 48 f1             	cmovs  %ecx,%esi
+  804167:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80416c:	53                   	push   %ebx
+  80416d:	56                   	push   %esi
+  80416e:	e8 24 fe ff ff       	call   803f97 <dm>
+  804173:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804177:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80417b:	83 c4 10             	add    $0x10,%esp
+  80417e:	eb 47                	jmp    8041c7 <__moddi3+0x9d>
+  804180:	f7 d8                	neg    %eax
+  804182:	83 d2 00             	adc    $0x0,%edx
+  804185:	f7 da                	neg    %edx
+  804187:	83 ec 04             	sub    $0x4,%esp
+  80418a:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80418e:	56                   	push   %esi
+  80418f:	89 cf                	mov    %ecx,%edi
+  804191:	f7 df                	neg    %edi
+  804193:	89 de                	mov    %ebx,%esi
+  804195:	83 d6 00             	adc    $0x0,%esi
+  804198:	f7 de                	neg    %esi
+  80419a:	0f 49 cf             	cmovns %edi,%ecx
+  80419d:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8041a1:	0f 49 de             	cmovns %esi,%ebx
+  8041a4:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8041a8:	ff 74 24 0c          	push   0xc(%esp)
+  8041ac:	ff 74 24 0c          	push   0xc(%esp)
+  8041b0:	e8 e2 fd ff ff       	call   803f97 <dm>
+  8041b5:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8041b9:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8041bd:	f7 d8                	neg    %eax
+  8041bf:	83 d2 00             	adc    $0x0,%edx
+  8041c2:	f7 da                	neg    %edx
+  8041c4:	83 c4 10             	add    $0x10,%esp
+  8041c7:	83 c4 24             	add    $0x24,%esp
+  8041ca:	5b                   	pop    %ebx
+  8041cb:	5e                   	pop    %esi
+  8041cc:	5f                   	pop    %edi
+  8041cd:	5d                   	pop    %ebp
+  8041ce:	c3                   	ret
@@ -0,0 +1,8398 @@
+
+obj/user/icode.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 03 01 00 00       	call   800134 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	81 ec 1c 02 00 00    	sub    $0x21c,%esp
+	int fd, n, r;
+	char buf[512+1];
+
+	binaryname = "icode";
+  80003e:	c7 05 00 50 80 00 60 	movl   $0x803f60,0x805000
+  800045:	3f 80 00 
+
+	cprintf("icode startup\n");
+  800048:	68 66 3f 80 00       	push   $0x803f66
+  80004d:	e8 20 02 00 00       	call   800272 <cprintf>
+
+	cprintf("icode: open /motd\n");
+  800052:	c7 04 24 75 3f 80 00 	movl   $0x803f75,(%esp)
+  800059:	e8 14 02 00 00       	call   800272 <cprintf>
+	if ((fd = open("/motd", O_RDONLY)) < 0)
+  80005e:	83 c4 08             	add    $0x8,%esp
+  800061:	6a 00                	push   $0x0
+  800063:	68 88 3f 80 00       	push   $0x803f88
+  800068:	e8 99 1d 00 00       	call   801e06 <open>
+  80006d:	89 c6                	mov    %eax,%esi
+  80006f:	83 c4 10             	add    $0x10,%esp
+  800072:	85 c0                	test   %eax,%eax
+  800074:	78 18                	js     80008e <umain+0x5b>
+		panic("icode: open /motd: %e", fd);
+
+	cprintf("icode: read /motd\n");
+  800076:	83 ec 0c             	sub    $0xc,%esp
+  800079:	68 b1 3f 80 00       	push   $0x803fb1
+  80007e:	e8 ef 01 00 00       	call   800272 <cprintf>
+	while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	8d 9d f7 fd ff ff    	lea    -0x209(%ebp),%ebx
+  80008c:	eb 1f                	jmp    8000ad <umain+0x7a>
+		panic("icode: open /motd: %e", fd);
+  80008e:	50                   	push   %eax
+  80008f:	68 8e 3f 80 00       	push   $0x803f8e
+  800094:	6a 0f                	push   $0xf
+  800096:	68 a4 3f 80 00       	push   $0x803fa4
+  80009b:	e8 f7 00 00 00       	call   800197 <_panic>
+		sys_cputs(buf, n);
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+  8000a3:	50                   	push   %eax
+  8000a4:	53                   	push   %ebx
+  8000a5:	e8 e6 0a 00 00       	call   800b90 <sys_cputs>
+  8000aa:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  8000ad:	83 ec 04             	sub    $0x4,%esp
+  8000b0:	68 00 02 00 00       	push   $0x200
+  8000b5:	53                   	push   %ebx
+  8000b6:	56                   	push   %esi
+  8000b7:	e8 94 12 00 00       	call   801350 <read>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	7f dd                	jg     8000a0 <umain+0x6d>
+
+	cprintf("icode: close /motd\n");
+  8000c3:	83 ec 0c             	sub    $0xc,%esp
+  8000c6:	68 c4 3f 80 00       	push   $0x803fc4
+  8000cb:	e8 a2 01 00 00       	call   800272 <cprintf>
+	close(fd);
+  8000d0:	89 34 24             	mov    %esi,(%esp)
+  8000d3:	e8 3c 11 00 00       	call   801214 <close>
+
+	cprintf("icode: spawn /init\n");
+  8000d8:	c7 04 24 d8 3f 80 00 	movl   $0x803fd8,(%esp)
+  8000df:	e8 8e 01 00 00       	call   800272 <cprintf>
+	if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char*)0)) < 0)
+  8000e4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000eb:	68 ec 3f 80 00       	push   $0x803fec
+  8000f0:	68 f5 3f 80 00       	push   $0x803ff5
+  8000f5:	68 ff 3f 80 00       	push   $0x803fff
+  8000fa:	68 fe 3f 80 00       	push   $0x803ffe
+  8000ff:	e8 a1 2c 00 00       	call   802da5 <spawnl>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	85 c0                	test   %eax,%eax
+  800109:	78 17                	js     800122 <umain+0xef>
+		panic("icode: spawn /init: %e", r);
+
+	cprintf("icode: exiting\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 1b 40 80 00       	push   $0x80401b
+  800113:	e8 5a 01 00 00       	call   800272 <cprintf>
+}
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011e:	5b                   	pop    %ebx
+  80011f:	5e                   	pop    %esi
+  800120:	5d                   	pop    %ebp
+  800121:	c3                   	ret
+		panic("icode: spawn /init: %e", r);
+  800122:	50                   	push   %eax
+  800123:	68 04 40 80 00       	push   $0x804004
+  800128:	6a 1a                	push   $0x1a
+  80012a:	68 a4 3f 80 00       	push   $0x803fa4
+  80012f:	e8 63 00 00 00       	call   800197 <_panic>
+
+00800134 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800134:	55                   	push   %ebp
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	56                   	push   %esi
+  800138:	53                   	push   %ebx
+  800139:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80013c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80013f:	e8 e2 0a 00 00       	call   800c26 <sys_getenvid>
+  800144:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800149:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80014f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800154:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800159:	85 db                	test   %ebx,%ebx
+  80015b:	7e 07                	jle    800164 <libmain+0x30>
+		binaryname = argv[0];
+  80015d:	8b 06                	mov    (%esi),%eax
+  80015f:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800164:	83 ec 08             	sub    $0x8,%esp
+  800167:	56                   	push   %esi
+  800168:	53                   	push   %ebx
+  800169:	e8 c5 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80016e:	e8 0a 00 00 00       	call   80017d <exit>
+}
+  800173:	83 c4 10             	add    $0x10,%esp
+  800176:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800179:	5b                   	pop    %ebx
+  80017a:	5e                   	pop    %esi
+  80017b:	5d                   	pop    %ebp
+  80017c:	c3                   	ret
+
+0080017d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80017d:	55                   	push   %ebp
+  80017e:	89 e5                	mov    %esp,%ebp
+  800180:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800183:	e8 b9 10 00 00       	call   801241 <close_all>
+	sys_env_destroy(0);
+  800188:	83 ec 0c             	sub    $0xc,%esp
+  80018b:	6a 00                	push   $0x0
+  80018d:	e8 4b 0a 00 00       	call   800bdd <sys_env_destroy>
+}
+  800192:	83 c4 10             	add    $0x10,%esp
+  800195:	c9                   	leave
+  800196:	c3                   	ret
+
+00800197 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800197:	55                   	push   %ebp
+  800198:	89 e5                	mov    %esp,%ebp
+  80019a:	56                   	push   %esi
+  80019b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80019c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80019f:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8001a5:	e8 7c 0a 00 00       	call   800c26 <sys_getenvid>
+  8001aa:	83 ec 0c             	sub    $0xc,%esp
+  8001ad:	ff 75 0c             	push   0xc(%ebp)
+  8001b0:	ff 75 08             	push   0x8(%ebp)
+  8001b3:	56                   	push   %esi
+  8001b4:	50                   	push   %eax
+  8001b5:	68 38 40 80 00       	push   $0x804038
+  8001ba:	e8 b3 00 00 00       	call   800272 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001bf:	83 c4 18             	add    $0x18,%esp
+  8001c2:	53                   	push   %ebx
+  8001c3:	ff 75 10             	push   0x10(%ebp)
+  8001c6:	e8 56 00 00 00       	call   800221 <vcprintf>
+	cprintf("\n");
+  8001cb:	c7 04 24 b7 45 80 00 	movl   $0x8045b7,(%esp)
+  8001d2:	e8 9b 00 00 00       	call   800272 <cprintf>
+  8001d7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001da:	cc                   	int3
+	while (1)
+  8001db:	eb fd                	jmp    8001da <_panic+0x43>
+
+008001dd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	53                   	push   %ebx
+  8001e1:	83 ec 04             	sub    $0x4,%esp
+  8001e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001e7:	8b 13                	mov    (%ebx),%edx
+  8001e9:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ec:	89 03                	mov    %eax,(%ebx)
+  8001ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001f1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001f5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001fa:	74 09                	je     800205 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001fc:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800200:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800203:	c9                   	leave
+  800204:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800205:	83 ec 08             	sub    $0x8,%esp
+  800208:	68 ff 00 00 00       	push   $0xff
+  80020d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800210:	50                   	push   %eax
+  800211:	e8 7a 09 00 00       	call   800b90 <sys_cputs>
+		b->idx = 0;
+  800216:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80021c:	83 c4 10             	add    $0x10,%esp
+  80021f:	eb db                	jmp    8001fc <putch+0x1f>
+
+00800221 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800221:	55                   	push   %ebp
+  800222:	89 e5                	mov    %esp,%ebp
+  800224:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80022a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800231:	00 00 00 
+	b.cnt = 0;
+  800234:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80023b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80023e:	ff 75 0c             	push   0xc(%ebp)
+  800241:	ff 75 08             	push   0x8(%ebp)
+  800244:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80024a:	50                   	push   %eax
+  80024b:	68 dd 01 80 00       	push   $0x8001dd
+  800250:	e8 14 01 00 00       	call   800369 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800255:	83 c4 08             	add    $0x8,%esp
+  800258:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80025e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800264:	50                   	push   %eax
+  800265:	e8 26 09 00 00       	call   800b90 <sys_cputs>
+
+	return b.cnt;
+}
+  80026a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800270:	c9                   	leave
+  800271:	c3                   	ret
+
+00800272 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800272:	55                   	push   %ebp
+  800273:	89 e5                	mov    %esp,%ebp
+  800275:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800278:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80027b:	50                   	push   %eax
+  80027c:	ff 75 08             	push   0x8(%ebp)
+  80027f:	e8 9d ff ff ff       	call   800221 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800284:	c9                   	leave
+  800285:	c3                   	ret
+
+00800286 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800286:	55                   	push   %ebp
+  800287:	89 e5                	mov    %esp,%ebp
+  800289:	57                   	push   %edi
+  80028a:	56                   	push   %esi
+  80028b:	53                   	push   %ebx
+  80028c:	83 ec 1c             	sub    $0x1c,%esp
+  80028f:	89 c7                	mov    %eax,%edi
+  800291:	89 d6                	mov    %edx,%esi
+  800293:	8b 45 08             	mov    0x8(%ebp),%eax
+  800296:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800299:	89 d1                	mov    %edx,%ecx
+  80029b:	89 c2                	mov    %eax,%edx
+  80029d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002a0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002a3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002a6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002ac:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002b3:	39 c2                	cmp    %eax,%edx
+  8002b5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002b8:	72 3e                	jb     8002f8 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002ba:	83 ec 0c             	sub    $0xc,%esp
+  8002bd:	ff 75 18             	push   0x18(%ebp)
+  8002c0:	83 eb 01             	sub    $0x1,%ebx
+  8002c3:	53                   	push   %ebx
+  8002c4:	50                   	push   %eax
+  8002c5:	83 ec 08             	sub    $0x8,%esp
+  8002c8:	ff 75 e4             	push   -0x1c(%ebp)
+  8002cb:	ff 75 e0             	push   -0x20(%ebp)
+  8002ce:	ff 75 dc             	push   -0x24(%ebp)
+  8002d1:	ff 75 d8             	push   -0x28(%ebp)
+  8002d4:	e8 08 3b 00 00       	call   803de1 <__udivdi3>
+  8002d9:	83 c4 18             	add    $0x18,%esp
+  8002dc:	52                   	push   %edx
+  8002dd:	50                   	push   %eax
+  8002de:	89 f2                	mov    %esi,%edx
+  8002e0:	89 f8                	mov    %edi,%eax
+  8002e2:	e8 9f ff ff ff       	call   800286 <printnum>
+  8002e7:	83 c4 20             	add    $0x20,%esp
+  8002ea:	eb 13                	jmp    8002ff <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002ec:	83 ec 08             	sub    $0x8,%esp
+  8002ef:	56                   	push   %esi
+  8002f0:	ff 75 18             	push   0x18(%ebp)
+  8002f3:	ff d7                	call   *%edi
+  8002f5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002f8:	83 eb 01             	sub    $0x1,%ebx
+  8002fb:	85 db                	test   %ebx,%ebx
+  8002fd:	7f ed                	jg     8002ec <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002ff:	83 ec 08             	sub    $0x8,%esp
+  800302:	56                   	push   %esi
+  800303:	83 ec 04             	sub    $0x4,%esp
+  800306:	ff 75 e4             	push   -0x1c(%ebp)
+  800309:	ff 75 e0             	push   -0x20(%ebp)
+  80030c:	ff 75 dc             	push   -0x24(%ebp)
+  80030f:	ff 75 d8             	push   -0x28(%ebp)
+  800312:	e8 e8 3a 00 00       	call   803dff <__umoddi3>
+  800317:	83 c4 14             	add    $0x14,%esp
+  80031a:	0f be 80 5b 40 80 00 	movsbl 0x80405b(%eax),%eax
+  800321:	50                   	push   %eax
+  800322:	ff d7                	call   *%edi
+}
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032a:	5b                   	pop    %ebx
+  80032b:	5e                   	pop    %esi
+  80032c:	5f                   	pop    %edi
+  80032d:	5d                   	pop    %ebp
+  80032e:	c3                   	ret
+
+0080032f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80032f:	55                   	push   %ebp
+  800330:	89 e5                	mov    %esp,%ebp
+  800332:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800335:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800339:	8b 10                	mov    (%eax),%edx
+  80033b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80033e:	73 0a                	jae    80034a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800340:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800343:	89 08                	mov    %ecx,(%eax)
+  800345:	8b 45 08             	mov    0x8(%ebp),%eax
+  800348:	88 02                	mov    %al,(%edx)
+}
+  80034a:	5d                   	pop    %ebp
+  80034b:	c3                   	ret
+
+0080034c <printfmt>:
+{
+  80034c:	55                   	push   %ebp
+  80034d:	89 e5                	mov    %esp,%ebp
+  80034f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800352:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800355:	50                   	push   %eax
+  800356:	ff 75 10             	push   0x10(%ebp)
+  800359:	ff 75 0c             	push   0xc(%ebp)
+  80035c:	ff 75 08             	push   0x8(%ebp)
+  80035f:	e8 05 00 00 00       	call   800369 <vprintfmt>
+}
+  800364:	83 c4 10             	add    $0x10,%esp
+  800367:	c9                   	leave
+  800368:	c3                   	ret
+
+00800369 <vprintfmt>:
+{
+  800369:	55                   	push   %ebp
+  80036a:	89 e5                	mov    %esp,%ebp
+  80036c:	57                   	push   %edi
+  80036d:	56                   	push   %esi
+  80036e:	53                   	push   %ebx
+  80036f:	83 ec 2c             	sub    $0x2c,%esp
+  800372:	8b 75 08             	mov    0x8(%ebp),%esi
+  800375:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800378:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80037b:	eb 0a                	jmp    800387 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80037d:	83 ec 08             	sub    $0x8,%esp
+  800380:	53                   	push   %ebx
+  800381:	50                   	push   %eax
+  800382:	ff d6                	call   *%esi
+  800384:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800387:	83 c7 01             	add    $0x1,%edi
+  80038a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80038e:	83 f8 25             	cmp    $0x25,%eax
+  800391:	74 0c                	je     80039f <vprintfmt+0x36>
+			if (ch == '\0')
+  800393:	85 c0                	test   %eax,%eax
+  800395:	75 e6                	jne    80037d <vprintfmt+0x14>
+}
+  800397:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80039a:	5b                   	pop    %ebx
+  80039b:	5e                   	pop    %esi
+  80039c:	5f                   	pop    %edi
+  80039d:	5d                   	pop    %ebp
+  80039e:	c3                   	ret
+		padc = ' ';
+  80039f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003a3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003aa:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003b1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bd:	8d 47 01             	lea    0x1(%edi),%eax
+  8003c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003c3:	0f b6 17             	movzbl (%edi),%edx
+  8003c6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003c9:	3c 55                	cmp    $0x55,%al
+  8003cb:	0f 87 cf 03 00 00    	ja     8007a0 <vprintfmt+0x437>
+  8003d1:	0f b6 c0             	movzbl %al,%eax
+  8003d4:	ff 24 85 c0 41 80 00 	jmp    *0x8041c0(,%eax,4)
+  8003db:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003de:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003e2:	eb d9                	jmp    8003bd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003e7:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003eb:	eb d0                	jmp    8003bd <vprintfmt+0x54>
+  8003ed:	0f b6 d2             	movzbl %dl,%edx
+  8003f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003fb:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003fe:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800402:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800405:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800408:	83 f9 09             	cmp    $0x9,%ecx
+  80040b:	77 55                	ja     800462 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80040d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800410:	eb e9                	jmp    8003fb <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800412:	8b 45 14             	mov    0x14(%ebp),%eax
+  800415:	8b 00                	mov    (%eax),%eax
+  800417:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80041a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041d:	8d 40 04             	lea    0x4(%eax),%eax
+  800420:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800423:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800426:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80042a:	79 91                	jns    8003bd <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80042c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80042f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800432:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800439:	eb 82                	jmp    8003bd <vprintfmt+0x54>
+			if (width < 0)
+  80043b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80043e:	85 d2                	test   %edx,%edx
+  800440:	b8 00 00 00 00       	mov    $0x0,%eax
+  800445:	0f 49 c2             	cmovns %edx,%eax
+  800448:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80044b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80044e:	e9 6a ff ff ff       	jmp    8003bd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800453:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800456:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80045d:	e9 5b ff ff ff       	jmp    8003bd <vprintfmt+0x54>
+  800462:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800465:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800468:	eb bc                	jmp    800426 <vprintfmt+0xbd>
+			lflag++;
+  80046a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80046d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800470:	e9 48 ff ff ff       	jmp    8003bd <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800475:	8b 45 14             	mov    0x14(%ebp),%eax
+  800478:	8d 78 04             	lea    0x4(%eax),%edi
+  80047b:	83 ec 08             	sub    $0x8,%esp
+  80047e:	53                   	push   %ebx
+  80047f:	ff 30                	push   (%eax)
+  800481:	ff d6                	call   *%esi
+			break;
+  800483:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800486:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800489:	e9 b1 02 00 00       	jmp    80073f <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80048e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800491:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800494:	8b 10                	mov    (%eax),%edx
+  800496:	89 d0                	mov    %edx,%eax
+  800498:	f7 d8                	neg    %eax
+  80049a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80049d:	83 f8 11             	cmp    $0x11,%eax
+  8004a0:	7f 23                	jg     8004c5 <vprintfmt+0x15c>
+  8004a2:	8b 14 85 20 43 80 00 	mov    0x804320(,%eax,4),%edx
+  8004a9:	85 d2                	test   %edx,%edx
+  8004ab:	74 18                	je     8004c5 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004ad:	52                   	push   %edx
+  8004ae:	68 72 44 80 00       	push   $0x804472
+  8004b3:	53                   	push   %ebx
+  8004b4:	56                   	push   %esi
+  8004b5:	e8 92 fe ff ff       	call   80034c <printfmt>
+  8004ba:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004bd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004c0:	e9 7a 02 00 00       	jmp    80073f <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8004c5:	50                   	push   %eax
+  8004c6:	68 73 40 80 00       	push   $0x804073
+  8004cb:	53                   	push   %ebx
+  8004cc:	56                   	push   %esi
+  8004cd:	e8 7a fe ff ff       	call   80034c <printfmt>
+  8004d2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004d5:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004d8:	e9 62 02 00 00       	jmp    80073f <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e0:	83 c0 04             	add    $0x4,%eax
+  8004e3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004eb:	85 c9                	test   %ecx,%ecx
+  8004ed:	b8 6c 40 80 00       	mov    $0x80406c,%eax
+  8004f2:	0f 45 c1             	cmovne %ecx,%eax
+  8004f5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004f8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004fc:	7e 06                	jle    800504 <vprintfmt+0x19b>
+  8004fe:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800502:	75 0b                	jne    80050f <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800504:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800507:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80050a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80050d:	eb 5c                	jmp    80056b <vprintfmt+0x202>
+  80050f:	83 ec 08             	sub    $0x8,%esp
+  800512:	ff 75 d0             	push   -0x30(%ebp)
+  800515:	ff 75 cc             	push   -0x34(%ebp)
+  800518:	e8 20 03 00 00       	call   80083d <strnlen>
+  80051d:	89 c2                	mov    %eax,%edx
+  80051f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800522:	29 d0                	sub    %edx,%eax
+  800524:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800527:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80052b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80052e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800531:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800533:	eb 0e                	jmp    800543 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800535:	83 ec 08             	sub    $0x8,%esp
+  800538:	53                   	push   %ebx
+  800539:	57                   	push   %edi
+  80053a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80053d:	83 ee 01             	sub    $0x1,%esi
+  800540:	83 c4 10             	add    $0x10,%esp
+  800543:	85 f6                	test   %esi,%esi
+  800545:	7f ee                	jg     800535 <vprintfmt+0x1cc>
+  800547:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80054a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054d:	85 c0                	test   %eax,%eax
+  80054f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800554:	0f 49 d0             	cmovns %eax,%edx
+  800557:	29 d0                	sub    %edx,%eax
+  800559:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80055c:	eb a6                	jmp    800504 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80055e:	83 ec 08             	sub    $0x8,%esp
+  800561:	53                   	push   %ebx
+  800562:	52                   	push   %edx
+  800563:	ff 55 08             	call   *0x8(%ebp)
+  800566:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800569:	89 f1                	mov    %esi,%ecx
+  80056b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80056e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800572:	0f be d0             	movsbl %al,%edx
+  800575:	85 d2                	test   %edx,%edx
+  800577:	74 28                	je     8005a1 <vprintfmt+0x238>
+  800579:	85 ff                	test   %edi,%edi
+  80057b:	78 05                	js     800582 <vprintfmt+0x219>
+  80057d:	83 ef 01             	sub    $0x1,%edi
+  800580:	78 30                	js     8005b2 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800582:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800586:	74 d6                	je     80055e <vprintfmt+0x1f5>
+  800588:	0f be c0             	movsbl %al,%eax
+  80058b:	83 e8 20             	sub    $0x20,%eax
+  80058e:	83 f8 5e             	cmp    $0x5e,%eax
+  800591:	76 cb                	jbe    80055e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800593:	83 ec 08             	sub    $0x8,%esp
+  800596:	53                   	push   %ebx
+  800597:	6a 3f                	push   $0x3f
+  800599:	ff 55 08             	call   *0x8(%ebp)
+  80059c:	83 c4 10             	add    $0x10,%esp
+  80059f:	eb c8                	jmp    800569 <vprintfmt+0x200>
+  8005a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005a4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005a7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005aa:	01 d0                	add    %edx,%eax
+  8005ac:	29 c8                	sub    %ecx,%eax
+  8005ae:	89 c7                	mov    %eax,%edi
+  8005b0:	eb 13                	jmp    8005c5 <vprintfmt+0x25c>
+  8005b2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005b5:	eb ed                	jmp    8005a4 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005b7:	83 ec 08             	sub    $0x8,%esp
+  8005ba:	53                   	push   %ebx
+  8005bb:	6a 20                	push   $0x20
+  8005bd:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005bf:	83 ef 01             	sub    $0x1,%edi
+  8005c2:	83 c4 10             	add    $0x10,%esp
+  8005c5:	85 ff                	test   %edi,%edi
+  8005c7:	7f ee                	jg     8005b7 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005c9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005cc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005cf:	e9 6b 01 00 00       	jmp    80073f <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8005d4:	83 f9 01             	cmp    $0x1,%ecx
+  8005d7:	7f 1f                	jg     8005f8 <vprintfmt+0x28f>
+	else if (lflag)
+  8005d9:	85 c9                	test   %ecx,%ecx
+  8005db:	74 67                	je     800644 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8005dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e0:	8b 00                	mov    (%eax),%eax
+  8005e2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e5:	89 c1                	mov    %eax,%ecx
+  8005e7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005ea:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f6:	eb 17                	jmp    80060f <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fb:	8b 50 04             	mov    0x4(%eax),%edx
+  8005fe:	8b 00                	mov    (%eax),%eax
+  800600:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800603:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800606:	8b 45 14             	mov    0x14(%ebp),%eax
+  800609:	8d 40 08             	lea    0x8(%eax),%eax
+  80060c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80060f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800612:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800615:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80061a:	85 c9                	test   %ecx,%ecx
+  80061c:	0f 89 03 01 00 00    	jns    800725 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800622:	83 ec 08             	sub    $0x8,%esp
+  800625:	53                   	push   %ebx
+  800626:	6a 2d                	push   $0x2d
+  800628:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80062a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80062d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800630:	f7 da                	neg    %edx
+  800632:	83 d1 00             	adc    $0x0,%ecx
+  800635:	f7 d9                	neg    %ecx
+  800637:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80063a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80063f:	e9 e1 00 00 00       	jmp    800725 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800644:	8b 45 14             	mov    0x14(%ebp),%eax
+  800647:	8b 00                	mov    (%eax),%eax
+  800649:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80064c:	89 c1                	mov    %eax,%ecx
+  80064e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800651:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8d 40 04             	lea    0x4(%eax),%eax
+  80065a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80065d:	eb b0                	jmp    80060f <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80065f:	83 f9 01             	cmp    $0x1,%ecx
+  800662:	7f 1e                	jg     800682 <vprintfmt+0x319>
+	else if (lflag)
+  800664:	85 c9                	test   %ecx,%ecx
+  800666:	74 32                	je     80069a <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800668:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066b:	8b 10                	mov    (%eax),%edx
+  80066d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800672:	8d 40 04             	lea    0x4(%eax),%eax
+  800675:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800678:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80067d:	e9 a3 00 00 00       	jmp    800725 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800682:	8b 45 14             	mov    0x14(%ebp),%eax
+  800685:	8b 10                	mov    (%eax),%edx
+  800687:	8b 48 04             	mov    0x4(%eax),%ecx
+  80068a:	8d 40 08             	lea    0x8(%eax),%eax
+  80068d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800690:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800695:	e9 8b 00 00 00       	jmp    800725 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80069a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069d:	8b 10                	mov    (%eax),%edx
+  80069f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006aa:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006af:	eb 74                	jmp    800725 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8006b1:	83 f9 01             	cmp    $0x1,%ecx
+  8006b4:	7f 1b                	jg     8006d1 <vprintfmt+0x368>
+	else if (lflag)
+  8006b6:	85 c9                	test   %ecx,%ecx
+  8006b8:	74 2c                	je     8006e6 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8006ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bd:	8b 10                	mov    (%eax),%edx
+  8006bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ca:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006cf:	eb 54                	jmp    800725 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	8b 10                	mov    (%eax),%edx
+  8006d6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d9:	8d 40 08             	lea    0x8(%eax),%eax
+  8006dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006df:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006e4:	eb 3f                	jmp    800725 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e9:	8b 10                	mov    (%eax),%edx
+  8006eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006f6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006fb:	eb 28                	jmp    800725 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006fd:	83 ec 08             	sub    $0x8,%esp
+  800700:	53                   	push   %ebx
+  800701:	6a 30                	push   $0x30
+  800703:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800705:	83 c4 08             	add    $0x8,%esp
+  800708:	53                   	push   %ebx
+  800709:	6a 78                	push   $0x78
+  80070b:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80070d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800710:	8b 10                	mov    (%eax),%edx
+  800712:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800717:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80071a:	8d 40 04             	lea    0x4(%eax),%eax
+  80071d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800720:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800725:	83 ec 0c             	sub    $0xc,%esp
+  800728:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80072c:	50                   	push   %eax
+  80072d:	ff 75 e0             	push   -0x20(%ebp)
+  800730:	57                   	push   %edi
+  800731:	51                   	push   %ecx
+  800732:	52                   	push   %edx
+  800733:	89 da                	mov    %ebx,%edx
+  800735:	89 f0                	mov    %esi,%eax
+  800737:	e8 4a fb ff ff       	call   800286 <printnum>
+			break;
+  80073c:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80073f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800742:	e9 40 fc ff ff       	jmp    800387 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800747:	83 f9 01             	cmp    $0x1,%ecx
+  80074a:	7f 1b                	jg     800767 <vprintfmt+0x3fe>
+	else if (lflag)
+  80074c:	85 c9                	test   %ecx,%ecx
+  80074e:	74 2c                	je     80077c <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800750:	8b 45 14             	mov    0x14(%ebp),%eax
+  800753:	8b 10                	mov    (%eax),%edx
+  800755:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075a:	8d 40 04             	lea    0x4(%eax),%eax
+  80075d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800760:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800765:	eb be                	jmp    800725 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800767:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076a:	8b 10                	mov    (%eax),%edx
+  80076c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80076f:	8d 40 08             	lea    0x8(%eax),%eax
+  800772:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800775:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80077a:	eb a9                	jmp    800725 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80077c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077f:	8b 10                	mov    (%eax),%edx
+  800781:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800786:	8d 40 04             	lea    0x4(%eax),%eax
+  800789:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80078c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800791:	eb 92                	jmp    800725 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800793:	83 ec 08             	sub    $0x8,%esp
+  800796:	53                   	push   %ebx
+  800797:	6a 25                	push   $0x25
+  800799:	ff d6                	call   *%esi
+			break;
+  80079b:	83 c4 10             	add    $0x10,%esp
+  80079e:	eb 9f                	jmp    80073f <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8007a0:	83 ec 08             	sub    $0x8,%esp
+  8007a3:	53                   	push   %ebx
+  8007a4:	6a 25                	push   $0x25
+  8007a6:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007a8:	83 c4 10             	add    $0x10,%esp
+  8007ab:	89 f8                	mov    %edi,%eax
+  8007ad:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007b1:	74 05                	je     8007b8 <vprintfmt+0x44f>
+  8007b3:	83 e8 01             	sub    $0x1,%eax
+  8007b6:	eb f5                	jmp    8007ad <vprintfmt+0x444>
+  8007b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007bb:	eb 82                	jmp    80073f <vprintfmt+0x3d6>
+
+008007bd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007bd:	55                   	push   %ebp
+  8007be:	89 e5                	mov    %esp,%ebp
+  8007c0:	83 ec 18             	sub    $0x18,%esp
+  8007c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007c9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007cc:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007d0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007d3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007da:	85 c0                	test   %eax,%eax
+  8007dc:	74 26                	je     800804 <vsnprintf+0x47>
+  8007de:	85 d2                	test   %edx,%edx
+  8007e0:	7e 22                	jle    800804 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007e2:	ff 75 14             	push   0x14(%ebp)
+  8007e5:	ff 75 10             	push   0x10(%ebp)
+  8007e8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007eb:	50                   	push   %eax
+  8007ec:	68 2f 03 80 00       	push   $0x80032f
+  8007f1:	e8 73 fb ff ff       	call   800369 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007f6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007f9:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007ff:	83 c4 10             	add    $0x10,%esp
+}
+  800802:	c9                   	leave
+  800803:	c3                   	ret
+		return -E_INVAL;
+  800804:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800809:	eb f7                	jmp    800802 <vsnprintf+0x45>
+
+0080080b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80080b:	55                   	push   %ebp
+  80080c:	89 e5                	mov    %esp,%ebp
+  80080e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800811:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800814:	50                   	push   %eax
+  800815:	ff 75 10             	push   0x10(%ebp)
+  800818:	ff 75 0c             	push   0xc(%ebp)
+  80081b:	ff 75 08             	push   0x8(%ebp)
+  80081e:	e8 9a ff ff ff       	call   8007bd <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800823:	c9                   	leave
+  800824:	c3                   	ret
+
+00800825 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800825:	55                   	push   %ebp
+  800826:	89 e5                	mov    %esp,%ebp
+  800828:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80082b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800830:	eb 03                	jmp    800835 <strlen+0x10>
+		n++;
+  800832:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800835:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800839:	75 f7                	jne    800832 <strlen+0xd>
+	return n;
+}
+  80083b:	5d                   	pop    %ebp
+  80083c:	c3                   	ret
+
+0080083d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80083d:	55                   	push   %ebp
+  80083e:	89 e5                	mov    %esp,%ebp
+  800840:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800843:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800846:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084b:	eb 03                	jmp    800850 <strnlen+0x13>
+		n++;
+  80084d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800850:	39 d0                	cmp    %edx,%eax
+  800852:	74 08                	je     80085c <strnlen+0x1f>
+  800854:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800858:	75 f3                	jne    80084d <strnlen+0x10>
+  80085a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80085c:	89 d0                	mov    %edx,%eax
+  80085e:	5d                   	pop    %ebp
+  80085f:	c3                   	ret
+
+00800860 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800860:	55                   	push   %ebp
+  800861:	89 e5                	mov    %esp,%ebp
+  800863:	53                   	push   %ebx
+  800864:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800867:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80086a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800873:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800876:	83 c0 01             	add    $0x1,%eax
+  800879:	84 d2                	test   %dl,%dl
+  80087b:	75 f2                	jne    80086f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80087d:	89 c8                	mov    %ecx,%eax
+  80087f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800882:	c9                   	leave
+  800883:	c3                   	ret
+
+00800884 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	53                   	push   %ebx
+  800888:	83 ec 10             	sub    $0x10,%esp
+  80088b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80088e:	53                   	push   %ebx
+  80088f:	e8 91 ff ff ff       	call   800825 <strlen>
+  800894:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800897:	ff 75 0c             	push   0xc(%ebp)
+  80089a:	01 d8                	add    %ebx,%eax
+  80089c:	50                   	push   %eax
+  80089d:	e8 be ff ff ff       	call   800860 <strcpy>
+	return dst;
+}
+  8008a2:	89 d8                	mov    %ebx,%eax
+  8008a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a7:	c9                   	leave
+  8008a8:	c3                   	ret
+
+008008a9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008a9:	55                   	push   %ebp
+  8008aa:	89 e5                	mov    %esp,%ebp
+  8008ac:	56                   	push   %esi
+  8008ad:	53                   	push   %ebx
+  8008ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008b4:	89 f3                	mov    %esi,%ebx
+  8008b6:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008b9:	89 f0                	mov    %esi,%eax
+  8008bb:	eb 0f                	jmp    8008cc <strncpy+0x23>
+		*dst++ = *src;
+  8008bd:	83 c0 01             	add    $0x1,%eax
+  8008c0:	0f b6 0a             	movzbl (%edx),%ecx
+  8008c3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008c6:	80 f9 01             	cmp    $0x1,%cl
+  8008c9:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008cc:	39 d8                	cmp    %ebx,%eax
+  8008ce:	75 ed                	jne    8008bd <strncpy+0x14>
+	}
+	return ret;
+}
+  8008d0:	89 f0                	mov    %esi,%eax
+  8008d2:	5b                   	pop    %ebx
+  8008d3:	5e                   	pop    %esi
+  8008d4:	5d                   	pop    %ebp
+  8008d5:	c3                   	ret
+
+008008d6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008d6:	55                   	push   %ebp
+  8008d7:	89 e5                	mov    %esp,%ebp
+  8008d9:	56                   	push   %esi
+  8008da:	53                   	push   %ebx
+  8008db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008e1:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008e4:	89 f0                	mov    %esi,%eax
+  8008e6:	85 d2                	test   %edx,%edx
+  8008e8:	74 21                	je     80090b <strlcpy+0x35>
+  8008ea:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008ee:	89 f2                	mov    %esi,%edx
+  8008f0:	eb 09                	jmp    8008fb <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008f2:	83 c1 01             	add    $0x1,%ecx
+  8008f5:	83 c2 01             	add    $0x1,%edx
+  8008f8:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008fb:	39 c2                	cmp    %eax,%edx
+  8008fd:	74 09                	je     800908 <strlcpy+0x32>
+  8008ff:	0f b6 19             	movzbl (%ecx),%ebx
+  800902:	84 db                	test   %bl,%bl
+  800904:	75 ec                	jne    8008f2 <strlcpy+0x1c>
+  800906:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800908:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80090b:	29 f0                	sub    %esi,%eax
+}
+  80090d:	5b                   	pop    %ebx
+  80090e:	5e                   	pop    %esi
+  80090f:	5d                   	pop    %ebp
+  800910:	c3                   	ret
+
+00800911 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800911:	55                   	push   %ebp
+  800912:	89 e5                	mov    %esp,%ebp
+  800914:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800917:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80091a:	eb 06                	jmp    800922 <strcmp+0x11>
+		p++, q++;
+  80091c:	83 c1 01             	add    $0x1,%ecx
+  80091f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800922:	0f b6 01             	movzbl (%ecx),%eax
+  800925:	84 c0                	test   %al,%al
+  800927:	74 04                	je     80092d <strcmp+0x1c>
+  800929:	3a 02                	cmp    (%edx),%al
+  80092b:	74 ef                	je     80091c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80092d:	0f b6 c0             	movzbl %al,%eax
+  800930:	0f b6 12             	movzbl (%edx),%edx
+  800933:	29 d0                	sub    %edx,%eax
+}
+  800935:	5d                   	pop    %ebp
+  800936:	c3                   	ret
+
+00800937 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800937:	55                   	push   %ebp
+  800938:	89 e5                	mov    %esp,%ebp
+  80093a:	53                   	push   %ebx
+  80093b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800941:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800944:	eb 09                	jmp    80094f <strncmp+0x18>
+		n--, p++, q++;
+  800946:	83 ea 01             	sub    $0x1,%edx
+  800949:	83 c0 01             	add    $0x1,%eax
+  80094c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80094f:	85 d2                	test   %edx,%edx
+  800951:	74 18                	je     80096b <strncmp+0x34>
+  800953:	0f b6 18             	movzbl (%eax),%ebx
+  800956:	84 db                	test   %bl,%bl
+  800958:	74 04                	je     80095e <strncmp+0x27>
+  80095a:	3a 19                	cmp    (%ecx),%bl
+  80095c:	74 e8                	je     800946 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80095e:	0f b6 00             	movzbl (%eax),%eax
+  800961:	0f b6 11             	movzbl (%ecx),%edx
+  800964:	29 d0                	sub    %edx,%eax
+}
+  800966:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800969:	c9                   	leave
+  80096a:	c3                   	ret
+		return 0;
+  80096b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800970:	eb f4                	jmp    800966 <strncmp+0x2f>
+
+00800972 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800972:	55                   	push   %ebp
+  800973:	89 e5                	mov    %esp,%ebp
+  800975:	8b 45 08             	mov    0x8(%ebp),%eax
+  800978:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80097c:	eb 03                	jmp    800981 <strchr+0xf>
+  80097e:	83 c0 01             	add    $0x1,%eax
+  800981:	0f b6 10             	movzbl (%eax),%edx
+  800984:	84 d2                	test   %dl,%dl
+  800986:	74 06                	je     80098e <strchr+0x1c>
+		if (*s == c)
+  800988:	38 ca                	cmp    %cl,%dl
+  80098a:	75 f2                	jne    80097e <strchr+0xc>
+  80098c:	eb 05                	jmp    800993 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80098e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800993:	5d                   	pop    %ebp
+  800994:	c3                   	ret
+
+00800995 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800995:	55                   	push   %ebp
+  800996:	89 e5                	mov    %esp,%ebp
+  800998:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80099f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009a2:	38 ca                	cmp    %cl,%dl
+  8009a4:	74 09                	je     8009af <strfind+0x1a>
+  8009a6:	84 d2                	test   %dl,%dl
+  8009a8:	74 05                	je     8009af <strfind+0x1a>
+	for (; *s; s++)
+  8009aa:	83 c0 01             	add    $0x1,%eax
+  8009ad:	eb f0                	jmp    80099f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009af:	5d                   	pop    %ebp
+  8009b0:	c3                   	ret
+
+008009b1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009b1:	55                   	push   %ebp
+  8009b2:	89 e5                	mov    %esp,%ebp
+  8009b4:	57                   	push   %edi
+  8009b5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009b8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009bb:	85 c9                	test   %ecx,%ecx
+  8009bd:	74 20                	je     8009df <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009bf:	89 f8                	mov    %edi,%eax
+  8009c1:	09 c8                	or     %ecx,%eax
+  8009c3:	a8 03                	test   $0x3,%al
+  8009c5:	75 12                	jne    8009d9 <memset+0x28>
+		c &= 0xFF;
+  8009c7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009cb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009d1:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009d4:	fc                   	cld
+  8009d5:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009d7:	eb 06                	jmp    8009df <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009dc:	fc                   	cld
+  8009dd:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009df:	89 f8                	mov    %edi,%eax
+  8009e1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009e4:	c9                   	leave
+  8009e5:	c3                   	ret
+
+008009e6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009e6:	55                   	push   %ebp
+  8009e7:	89 e5                	mov    %esp,%ebp
+  8009e9:	57                   	push   %edi
+  8009ea:	56                   	push   %esi
+  8009eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ee:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009f1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009f4:	39 c6                	cmp    %eax,%esi
+  8009f6:	73 32                	jae    800a2a <memmove+0x44>
+  8009f8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009fb:	39 d0                	cmp    %edx,%eax
+  8009fd:	73 2b                	jae    800a2a <memmove+0x44>
+		s += n;
+		d += n;
+  8009ff:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a02:	89 d6                	mov    %edx,%esi
+  800a04:	09 fe                	or     %edi,%esi
+  800a06:	09 ce                	or     %ecx,%esi
+  800a08:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a0e:	75 0e                	jne    800a1e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a10:	83 ef 04             	sub    $0x4,%edi
+  800a13:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a16:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a19:	fd                   	std
+  800a1a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a1c:	eb 09                	jmp    800a27 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a1e:	83 ef 01             	sub    $0x1,%edi
+  800a21:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a24:	fd                   	std
+  800a25:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a27:	fc                   	cld
+  800a28:	eb 1a                	jmp    800a44 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a2a:	89 f2                	mov    %esi,%edx
+  800a2c:	09 c2                	or     %eax,%edx
+  800a2e:	09 ca                	or     %ecx,%edx
+  800a30:	f6 c2 03             	test   $0x3,%dl
+  800a33:	75 0a                	jne    800a3f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a35:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a38:	89 c7                	mov    %eax,%edi
+  800a3a:	fc                   	cld
+  800a3b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a3d:	eb 05                	jmp    800a44 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a3f:	89 c7                	mov    %eax,%edi
+  800a41:	fc                   	cld
+  800a42:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a44:	5e                   	pop    %esi
+  800a45:	5f                   	pop    %edi
+  800a46:	5d                   	pop    %ebp
+  800a47:	c3                   	ret
+
+00800a48 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a48:	55                   	push   %ebp
+  800a49:	89 e5                	mov    %esp,%ebp
+  800a4b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a4e:	ff 75 10             	push   0x10(%ebp)
+  800a51:	ff 75 0c             	push   0xc(%ebp)
+  800a54:	ff 75 08             	push   0x8(%ebp)
+  800a57:	e8 8a ff ff ff       	call   8009e6 <memmove>
+}
+  800a5c:	c9                   	leave
+  800a5d:	c3                   	ret
+
+00800a5e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a5e:	55                   	push   %ebp
+  800a5f:	89 e5                	mov    %esp,%ebp
+  800a61:	56                   	push   %esi
+  800a62:	53                   	push   %ebx
+  800a63:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a66:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a69:	89 c6                	mov    %eax,%esi
+  800a6b:	03 75 10             	add    0x10(%ebp),%esi
+  800a6e:	eb 06                	jmp    800a76 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a70:	83 c0 01             	add    $0x1,%eax
+  800a73:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a76:	39 f0                	cmp    %esi,%eax
+  800a78:	74 14                	je     800a8e <memcmp+0x30>
+		if (*s1 != *s2)
+  800a7a:	0f b6 08             	movzbl (%eax),%ecx
+  800a7d:	0f b6 1a             	movzbl (%edx),%ebx
+  800a80:	38 d9                	cmp    %bl,%cl
+  800a82:	74 ec                	je     800a70 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a84:	0f b6 c1             	movzbl %cl,%eax
+  800a87:	0f b6 db             	movzbl %bl,%ebx
+  800a8a:	29 d8                	sub    %ebx,%eax
+  800a8c:	eb 05                	jmp    800a93 <memcmp+0x35>
+	}
+
+	return 0;
+  800a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a93:	5b                   	pop    %ebx
+  800a94:	5e                   	pop    %esi
+  800a95:	5d                   	pop    %ebp
+  800a96:	c3                   	ret
+
+00800a97 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a97:	55                   	push   %ebp
+  800a98:	89 e5                	mov    %esp,%ebp
+  800a9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800aa0:	89 c2                	mov    %eax,%edx
+  800aa2:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800aa5:	eb 03                	jmp    800aaa <memfind+0x13>
+  800aa7:	83 c0 01             	add    $0x1,%eax
+  800aaa:	39 d0                	cmp    %edx,%eax
+  800aac:	73 04                	jae    800ab2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800aae:	38 08                	cmp    %cl,(%eax)
+  800ab0:	75 f5                	jne    800aa7 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ab2:	5d                   	pop    %ebp
+  800ab3:	c3                   	ret
+
+00800ab4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ab4:	55                   	push   %ebp
+  800ab5:	89 e5                	mov    %esp,%ebp
+  800ab7:	57                   	push   %edi
+  800ab8:	56                   	push   %esi
+  800ab9:	53                   	push   %ebx
+  800aba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800abd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ac0:	eb 03                	jmp    800ac5 <strtol+0x11>
+		s++;
+  800ac2:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ac5:	0f b6 02             	movzbl (%edx),%eax
+  800ac8:	3c 20                	cmp    $0x20,%al
+  800aca:	74 f6                	je     800ac2 <strtol+0xe>
+  800acc:	3c 09                	cmp    $0x9,%al
+  800ace:	74 f2                	je     800ac2 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ad0:	3c 2b                	cmp    $0x2b,%al
+  800ad2:	74 2a                	je     800afe <strtol+0x4a>
+	int neg = 0;
+  800ad4:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ad9:	3c 2d                	cmp    $0x2d,%al
+  800adb:	74 2b                	je     800b08 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800add:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ae3:	75 0f                	jne    800af4 <strtol+0x40>
+  800ae5:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ae8:	74 28                	je     800b12 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800aea:	85 db                	test   %ebx,%ebx
+  800aec:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800af1:	0f 44 d8             	cmove  %eax,%ebx
+  800af4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800afc:	eb 46                	jmp    800b44 <strtol+0x90>
+		s++;
+  800afe:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b01:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b06:	eb d5                	jmp    800add <strtol+0x29>
+		s++, neg = 1;
+  800b08:	83 c2 01             	add    $0x1,%edx
+  800b0b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b10:	eb cb                	jmp    800add <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b12:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b16:	74 0e                	je     800b26 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b18:	85 db                	test   %ebx,%ebx
+  800b1a:	75 d8                	jne    800af4 <strtol+0x40>
+		s++, base = 8;
+  800b1c:	83 c2 01             	add    $0x1,%edx
+  800b1f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b24:	eb ce                	jmp    800af4 <strtol+0x40>
+		s += 2, base = 16;
+  800b26:	83 c2 02             	add    $0x2,%edx
+  800b29:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b2e:	eb c4                	jmp    800af4 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b30:	0f be c0             	movsbl %al,%eax
+  800b33:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b36:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b39:	7d 3a                	jge    800b75 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b3b:	83 c2 01             	add    $0x1,%edx
+  800b3e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b42:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b44:	0f b6 02             	movzbl (%edx),%eax
+  800b47:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b4a:	89 f3                	mov    %esi,%ebx
+  800b4c:	80 fb 09             	cmp    $0x9,%bl
+  800b4f:	76 df                	jbe    800b30 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b51:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b54:	89 f3                	mov    %esi,%ebx
+  800b56:	80 fb 19             	cmp    $0x19,%bl
+  800b59:	77 08                	ja     800b63 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b5b:	0f be c0             	movsbl %al,%eax
+  800b5e:	83 e8 57             	sub    $0x57,%eax
+  800b61:	eb d3                	jmp    800b36 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b63:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b66:	89 f3                	mov    %esi,%ebx
+  800b68:	80 fb 19             	cmp    $0x19,%bl
+  800b6b:	77 08                	ja     800b75 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b6d:	0f be c0             	movsbl %al,%eax
+  800b70:	83 e8 37             	sub    $0x37,%eax
+  800b73:	eb c1                	jmp    800b36 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b75:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b79:	74 05                	je     800b80 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b7b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b7e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b80:	89 c8                	mov    %ecx,%eax
+  800b82:	f7 d8                	neg    %eax
+  800b84:	85 ff                	test   %edi,%edi
+  800b86:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b89:	89 c8                	mov    %ecx,%eax
+  800b8b:	5b                   	pop    %ebx
+  800b8c:	5e                   	pop    %esi
+  800b8d:	5f                   	pop    %edi
+  800b8e:	5d                   	pop    %ebp
+  800b8f:	c3                   	ret
+
+00800b90 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b90:	55                   	push   %ebp
+  800b91:	89 e5                	mov    %esp,%ebp
+  800b93:	57                   	push   %edi
+  800b94:	56                   	push   %esi
+  800b95:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba1:	89 c3                	mov    %eax,%ebx
+  800ba3:	89 c7                	mov    %eax,%edi
+  800ba5:	55                   	push   %ebp
+  800ba6:	89 e5                	mov    %esp,%ebp
+  800ba8:	8d 35 b0 0b 80 00    	lea    0x800bb0,%esi
+  800bae:	0f 34                	sysenter
+  800bb0:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800bb1:	5b                   	pop    %ebx
+  800bb2:	5e                   	pop    %esi
+  800bb3:	5f                   	pop    %edi
+  800bb4:	5d                   	pop    %ebp
+  800bb5:	c3                   	ret
+
+00800bb6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bb6:	55                   	push   %ebp
+  800bb7:	89 e5                	mov    %esp,%ebp
+  800bb9:	57                   	push   %edi
+  800bba:	56                   	push   %esi
+  800bbb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800bbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bc1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bc6:	89 d1                	mov    %edx,%ecx
+  800bc8:	89 d3                	mov    %edx,%ebx
+  800bca:	89 d7                	mov    %edx,%edi
+  800bcc:	55                   	push   %ebp
+  800bcd:	89 e5                	mov    %esp,%ebp
+  800bcf:	8d 35 d7 0b 80 00    	lea    0x800bd7,%esi
+  800bd5:	0f 34                	sysenter
+  800bd7:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800bd8:	5b                   	pop    %ebx
+  800bd9:	5e                   	pop    %esi
+  800bda:	5f                   	pop    %edi
+  800bdb:	5d                   	pop    %ebp
+  800bdc:	c3                   	ret
+
+00800bdd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bdd:	55                   	push   %ebp
+  800bde:	89 e5                	mov    %esp,%ebp
+  800be0:	57                   	push   %edi
+  800be1:	56                   	push   %esi
+  800be2:	53                   	push   %ebx
+  800be3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800be6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800beb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bee:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bf3:	89 cb                	mov    %ecx,%ebx
+  800bf5:	89 cf                	mov    %ecx,%edi
+  800bf7:	55                   	push   %ebp
+  800bf8:	89 e5                	mov    %esp,%ebp
+  800bfa:	8d 35 02 0c 80 00    	lea    0x800c02,%esi
+  800c00:	0f 34                	sysenter
+  800c02:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c03:	85 c0                	test   %eax,%eax
+  800c05:	7f 08                	jg     800c0f <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800c07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c0a:	5b                   	pop    %ebx
+  800c0b:	5e                   	pop    %esi
+  800c0c:	5f                   	pop    %edi
+  800c0d:	5d                   	pop    %ebp
+  800c0e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c0f:	83 ec 0c             	sub    $0xc,%esp
+  800c12:	50                   	push   %eax
+  800c13:	6a 03                	push   $0x3
+  800c15:	68 87 43 80 00       	push   $0x804387
+  800c1a:	6a 3d                	push   $0x3d
+  800c1c:	68 a4 43 80 00       	push   $0x8043a4
+  800c21:	e8 71 f5 ff ff       	call   800197 <_panic>
+
+00800c26 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c26:	55                   	push   %ebp
+  800c27:	89 e5                	mov    %esp,%ebp
+  800c29:	57                   	push   %edi
+  800c2a:	56                   	push   %esi
+  800c2b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c31:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c36:	89 d1                	mov    %edx,%ecx
+  800c38:	89 d3                	mov    %edx,%ebx
+  800c3a:	89 d7                	mov    %edx,%edi
+  800c3c:	55                   	push   %ebp
+  800c3d:	89 e5                	mov    %esp,%ebp
+  800c3f:	8d 35 47 0c 80 00    	lea    0x800c47,%esi
+  800c45:	0f 34                	sysenter
+  800c47:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800c48:	5b                   	pop    %ebx
+  800c49:	5e                   	pop    %esi
+  800c4a:	5f                   	pop    %edi
+  800c4b:	5d                   	pop    %ebp
+  800c4c:	c3                   	ret
+
+00800c4d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c4d:	55                   	push   %ebp
+  800c4e:	89 e5                	mov    %esp,%ebp
+  800c50:	57                   	push   %edi
+  800c51:	56                   	push   %esi
+  800c52:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c58:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c5d:	89 d1                	mov    %edx,%ecx
+  800c5f:	89 d3                	mov    %edx,%ebx
+  800c61:	89 d7                	mov    %edx,%edi
+  800c63:	89 d6                	mov    %edx,%esi
+  800c65:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c67:	5b                   	pop    %ebx
+  800c68:	5e                   	pop    %esi
+  800c69:	5f                   	pop    %edi
+  800c6a:	5d                   	pop    %ebp
+  800c6b:	c3                   	ret
+
+00800c6c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c6c:	55                   	push   %ebp
+  800c6d:	89 e5                	mov    %esp,%ebp
+  800c6f:	57                   	push   %edi
+  800c70:	56                   	push   %esi
+  800c71:	53                   	push   %ebx
+  800c72:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c80:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c88:	55                   	push   %ebp
+  800c89:	89 e5                	mov    %esp,%ebp
+  800c8b:	8d 35 93 0c 80 00    	lea    0x800c93,%esi
+  800c91:	0f 34                	sysenter
+  800c93:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c94:	85 c0                	test   %eax,%eax
+  800c96:	7f 08                	jg     800ca0 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800c98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9b:	5b                   	pop    %ebx
+  800c9c:	5e                   	pop    %esi
+  800c9d:	5f                   	pop    %edi
+  800c9e:	5d                   	pop    %ebp
+  800c9f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca0:	83 ec 0c             	sub    $0xc,%esp
+  800ca3:	50                   	push   %eax
+  800ca4:	6a 04                	push   $0x4
+  800ca6:	68 87 43 80 00       	push   $0x804387
+  800cab:	6a 3d                	push   $0x3d
+  800cad:	68 a4 43 80 00       	push   $0x8043a4
+  800cb2:	e8 e0 f4 ff ff       	call   800197 <_panic>
+
+00800cb7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cb7:	55                   	push   %ebp
+  800cb8:	89 e5                	mov    %esp,%ebp
+  800cba:	57                   	push   %edi
+  800cbb:	56                   	push   %esi
+  800cbc:	53                   	push   %ebx
+  800cbd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ccb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cce:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cd1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cd4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cd6:	85 c0                	test   %eax,%eax
+  800cd8:	7f 08                	jg     800ce2 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdd:	5b                   	pop    %ebx
+  800cde:	5e                   	pop    %esi
+  800cdf:	5f                   	pop    %edi
+  800ce0:	5d                   	pop    %ebp
+  800ce1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce2:	83 ec 0c             	sub    $0xc,%esp
+  800ce5:	50                   	push   %eax
+  800ce6:	6a 05                	push   $0x5
+  800ce8:	68 87 43 80 00       	push   $0x804387
+  800ced:	6a 23                	push   $0x23
+  800cef:	68 a4 43 80 00       	push   $0x8043a4
+  800cf4:	e8 9e f4 ff ff       	call   800197 <_panic>
+
+00800cf9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cf9:	55                   	push   %ebp
+  800cfa:	89 e5                	mov    %esp,%ebp
+  800cfc:	57                   	push   %edi
+  800cfd:	56                   	push   %esi
+  800cfe:	53                   	push   %ebx
+  800cff:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d12:	89 df                	mov    %ebx,%edi
+  800d14:	55                   	push   %ebp
+  800d15:	89 e5                	mov    %esp,%ebp
+  800d17:	8d 35 1f 0d 80 00    	lea    0x800d1f,%esi
+  800d1d:	0f 34                	sysenter
+  800d1f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d20:	85 c0                	test   %eax,%eax
+  800d22:	7f 08                	jg     800d2c <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800d24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d27:	5b                   	pop    %ebx
+  800d28:	5e                   	pop    %esi
+  800d29:	5f                   	pop    %edi
+  800d2a:	5d                   	pop    %ebp
+  800d2b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d2c:	83 ec 0c             	sub    $0xc,%esp
+  800d2f:	50                   	push   %eax
+  800d30:	6a 06                	push   $0x6
+  800d32:	68 87 43 80 00       	push   $0x804387
+  800d37:	6a 3d                	push   $0x3d
+  800d39:	68 a4 43 80 00       	push   $0x8043a4
+  800d3e:	e8 54 f4 ff ff       	call   800197 <_panic>
+
+00800d43 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d43:	55                   	push   %ebp
+  800d44:	89 e5                	mov    %esp,%ebp
+  800d46:	57                   	push   %edi
+  800d47:	56                   	push   %esi
+  800d48:	53                   	push   %ebx
+  800d49:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d57:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d5c:	89 df                	mov    %ebx,%edi
+  800d5e:	55                   	push   %ebp
+  800d5f:	89 e5                	mov    %esp,%ebp
+  800d61:	8d 35 69 0d 80 00    	lea    0x800d69,%esi
+  800d67:	0f 34                	sysenter
+  800d69:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d6a:	85 c0                	test   %eax,%eax
+  800d6c:	7f 08                	jg     800d76 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800d6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d71:	5b                   	pop    %ebx
+  800d72:	5e                   	pop    %esi
+  800d73:	5f                   	pop    %edi
+  800d74:	5d                   	pop    %ebp
+  800d75:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d76:	83 ec 0c             	sub    $0xc,%esp
+  800d79:	50                   	push   %eax
+  800d7a:	6a 08                	push   $0x8
+  800d7c:	68 87 43 80 00       	push   $0x804387
+  800d81:	6a 3d                	push   $0x3d
+  800d83:	68 a4 43 80 00       	push   $0x8043a4
+  800d88:	e8 0a f4 ff ff       	call   800197 <_panic>
+
+00800d8d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d8d:	55                   	push   %ebp
+  800d8e:	89 e5                	mov    %esp,%ebp
+  800d90:	57                   	push   %edi
+  800d91:	56                   	push   %esi
+  800d92:	53                   	push   %ebx
+  800d93:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da1:	b8 09 00 00 00       	mov    $0x9,%eax
+  800da6:	89 df                	mov    %ebx,%edi
+  800da8:	55                   	push   %ebp
+  800da9:	89 e5                	mov    %esp,%ebp
+  800dab:	8d 35 b3 0d 80 00    	lea    0x800db3,%esi
+  800db1:	0f 34                	sysenter
+  800db3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800db4:	85 c0                	test   %eax,%eax
+  800db6:	7f 08                	jg     800dc0 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800db8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dbb:	5b                   	pop    %ebx
+  800dbc:	5e                   	pop    %esi
+  800dbd:	5f                   	pop    %edi
+  800dbe:	5d                   	pop    %ebp
+  800dbf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dc0:	83 ec 0c             	sub    $0xc,%esp
+  800dc3:	50                   	push   %eax
+  800dc4:	6a 09                	push   $0x9
+  800dc6:	68 87 43 80 00       	push   $0x804387
+  800dcb:	6a 3d                	push   $0x3d
+  800dcd:	68 a4 43 80 00       	push   $0x8043a4
+  800dd2:	e8 c0 f3 ff ff       	call   800197 <_panic>
+
+00800dd7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800dd7:	55                   	push   %ebp
+  800dd8:	89 e5                	mov    %esp,%ebp
+  800dda:	57                   	push   %edi
+  800ddb:	56                   	push   %esi
+  800ddc:	53                   	push   %ebx
+  800ddd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800de0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800de5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800deb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800df0:	89 df                	mov    %ebx,%edi
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	8d 35 fd 0d 80 00    	lea    0x800dfd,%esi
+  800dfb:	0f 34                	sysenter
+  800dfd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800dfe:	85 c0                	test   %eax,%eax
+  800e00:	7f 08                	jg     800e0a <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800e02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e05:	5b                   	pop    %ebx
+  800e06:	5e                   	pop    %esi
+  800e07:	5f                   	pop    %edi
+  800e08:	5d                   	pop    %ebp
+  800e09:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e0a:	83 ec 0c             	sub    $0xc,%esp
+  800e0d:	50                   	push   %eax
+  800e0e:	6a 0a                	push   $0xa
+  800e10:	68 87 43 80 00       	push   $0x804387
+  800e15:	6a 3d                	push   $0x3d
+  800e17:	68 a4 43 80 00       	push   $0x8043a4
+  800e1c:	e8 76 f3 ff ff       	call   800197 <_panic>
+
+00800e21 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e21:	55                   	push   %ebp
+  800e22:	89 e5                	mov    %esp,%ebp
+  800e24:	57                   	push   %edi
+  800e25:	56                   	push   %esi
+  800e26:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e35:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e38:	55                   	push   %ebp
+  800e39:	89 e5                	mov    %esp,%ebp
+  800e3b:	8d 35 43 0e 80 00    	lea    0x800e43,%esi
+  800e41:	0f 34                	sysenter
+  800e43:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800e44:	5b                   	pop    %ebx
+  800e45:	5e                   	pop    %esi
+  800e46:	5f                   	pop    %edi
+  800e47:	5d                   	pop    %ebp
+  800e48:	c3                   	ret
+
+00800e49 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800e49:	55                   	push   %ebp
+  800e4a:	89 e5                	mov    %esp,%ebp
+  800e4c:	57                   	push   %edi
+  800e4d:	56                   	push   %esi
+  800e4e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e55:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e60:	55                   	push   %ebp
+  800e61:	89 e5                	mov    %esp,%ebp
+  800e63:	8d 35 6b 0e 80 00    	lea    0x800e6b,%esi
+  800e69:	0f 34                	sysenter
+  800e6b:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800e6c:	5b                   	pop    %ebx
+  800e6d:	5e                   	pop    %esi
+  800e6e:	5f                   	pop    %edi
+  800e6f:	5d                   	pop    %ebp
+  800e70:	c3                   	ret
+
+00800e71 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800e71:	55                   	push   %ebp
+  800e72:	89 e5                	mov    %esp,%ebp
+  800e74:	57                   	push   %edi
+  800e75:	56                   	push   %esi
+  800e76:	53                   	push   %ebx
+  800e77:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e7a:	be 00 00 00 00       	mov    $0x0,%esi
+  800e7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e85:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e8a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8d:	89 f7                	mov    %esi,%edi
+  800e8f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e91:	85 c0                	test   %eax,%eax
+  800e93:	7f 08                	jg     800e9d <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800e95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e98:	5b                   	pop    %ebx
+  800e99:	5e                   	pop    %esi
+  800e9a:	5f                   	pop    %edi
+  800e9b:	5d                   	pop    %ebp
+  800e9c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9d:	83 ec 0c             	sub    $0xc,%esp
+  800ea0:	50                   	push   %eax
+  800ea1:	6a 0d                	push   $0xd
+  800ea3:	68 87 43 80 00       	push   $0x804387
+  800ea8:	6a 23                	push   $0x23
+  800eaa:	68 a4 43 80 00       	push   $0x8043a4
+  800eaf:	e8 e3 f2 ff ff       	call   800197 <_panic>
+
+00800eb4 <sys_ipc_recv>:
+{
+  800eb4:	55                   	push   %ebp
+  800eb5:	89 e5                	mov    %esp,%ebp
+  800eb7:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800eba:	6a 00                	push   $0x0
+  800ebc:	6a 01                	push   $0x1
+  800ebe:	ff 75 08             	push   0x8(%ebp)
+  800ec1:	e8 ab ff ff ff       	call   800e71 <sys_ipc_recvv>
+}
+  800ec6:	c9                   	leave
+  800ec7:	c3                   	ret
+
+00800ec8 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800ec8:	55                   	push   %ebp
+  800ec9:	89 e5                	mov    %esp,%ebp
+  800ecb:	57                   	push   %edi
+  800ecc:	56                   	push   %esi
+  800ecd:	53                   	push   %ebx
+  800ece:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ee1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800ee4:	89 de                	mov    %ebx,%esi
+  800ee6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee8:	85 c0                	test   %eax,%eax
+  800eea:	7f 08                	jg     800ef4 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800eec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eef:	5b                   	pop    %ebx
+  800ef0:	5e                   	pop    %esi
+  800ef1:	5f                   	pop    %edi
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef4:	83 ec 0c             	sub    $0xc,%esp
+  800ef7:	50                   	push   %eax
+  800ef8:	6a 0d                	push   $0xd
+  800efa:	68 87 43 80 00       	push   $0x804387
+  800eff:	6a 23                	push   $0x23
+  800f01:	68 a4 43 80 00       	push   $0x8043a4
+  800f06:	e8 8c f2 ff ff       	call   800197 <_panic>
+
+00800f0b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f0b:	55                   	push   %ebp
+  800f0c:	89 e5                	mov    %esp,%ebp
+  800f0e:	57                   	push   %edi
+  800f0f:	56                   	push   %esi
+  800f10:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f11:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f16:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f1b:	89 d1                	mov    %edx,%ecx
+  800f1d:	89 d3                	mov    %edx,%ebx
+  800f1f:	89 d7                	mov    %edx,%edi
+  800f21:	55                   	push   %ebp
+  800f22:	89 e5                	mov    %esp,%ebp
+  800f24:	8d 35 2c 0f 80 00    	lea    0x800f2c,%esi
+  800f2a:	0f 34                	sysenter
+  800f2c:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800f2d:	5b                   	pop    %ebx
+  800f2e:	5e                   	pop    %esi
+  800f2f:	5f                   	pop    %edi
+  800f30:	5d                   	pop    %ebp
+  800f31:	c3                   	ret
+
+00800f32 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800f32:	55                   	push   %ebp
+  800f33:	89 e5                	mov    %esp,%ebp
+  800f35:	57                   	push   %edi
+  800f36:	56                   	push   %esi
+  800f37:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f43:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f48:	89 df                	mov    %ebx,%edi
+  800f4a:	55                   	push   %ebp
+  800f4b:	89 e5                	mov    %esp,%ebp
+  800f4d:	8d 35 55 0f 80 00    	lea    0x800f55,%esi
+  800f53:	0f 34                	sysenter
+  800f55:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800f56:	5b                   	pop    %ebx
+  800f57:	5e                   	pop    %esi
+  800f58:	5f                   	pop    %edi
+  800f59:	5d                   	pop    %ebp
+  800f5a:	c3                   	ret
+
+00800f5b <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800f5b:	55                   	push   %ebp
+  800f5c:	89 e5                	mov    %esp,%ebp
+  800f5e:	57                   	push   %edi
+  800f5f:	56                   	push   %esi
+  800f60:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f69:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f6e:	89 cb                	mov    %ecx,%ebx
+  800f70:	89 cf                	mov    %ecx,%edi
+  800f72:	55                   	push   %ebp
+  800f73:	89 e5                	mov    %esp,%ebp
+  800f75:	8d 35 7d 0f 80 00    	lea    0x800f7d,%esi
+  800f7b:	0f 34                	sysenter
+  800f7d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800f7e:	5b                   	pop    %ebx
+  800f7f:	5e                   	pop    %esi
+  800f80:	5f                   	pop    %edi
+  800f81:	5d                   	pop    %ebp
+  800f82:	c3                   	ret
+
+00800f83 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	57                   	push   %edi
+  800f87:	56                   	push   %esi
+  800f88:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f94:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f99:	89 df                	mov    %ebx,%edi
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	8d 35 a6 0f 80 00    	lea    0x800fa6,%esi
+  800fa4:	0f 34                	sysenter
+  800fa6:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800fa7:	5b                   	pop    %ebx
+  800fa8:	5e                   	pop    %esi
+  800fa9:	5f                   	pop    %edi
+  800faa:	5d                   	pop    %ebp
+  800fab:	c3                   	ret
+
+00800fac <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800fac:	55                   	push   %ebp
+  800fad:	89 e5                	mov    %esp,%ebp
+  800faf:	57                   	push   %edi
+  800fb0:	56                   	push   %esi
+  800fb1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbd:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fc2:	89 df                	mov    %ebx,%edi
+  800fc4:	55                   	push   %ebp
+  800fc5:	89 e5                	mov    %esp,%ebp
+  800fc7:	8d 35 cf 0f 80 00    	lea    0x800fcf,%esi
+  800fcd:	0f 34                	sysenter
+  800fcf:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800fd0:	5b                   	pop    %ebx
+  800fd1:	5e                   	pop    %esi
+  800fd2:	5f                   	pop    %edi
+  800fd3:	5d                   	pop    %ebp
+  800fd4:	c3                   	ret
+
+00800fd5 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800fd5:	55                   	push   %ebp
+  800fd6:	89 e5                	mov    %esp,%ebp
+  800fd8:	57                   	push   %edi
+  800fd9:	56                   	push   %esi
+  800fda:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe1:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fe6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fec:	55                   	push   %ebp
+  800fed:	89 e5                	mov    %esp,%ebp
+  800fef:	8d 35 f7 0f 80 00    	lea    0x800ff7,%esi
+  800ff5:	0f 34                	sysenter
+  800ff7:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800ff8:	5b                   	pop    %ebx
+  800ff9:	5e                   	pop    %esi
+  800ffa:	5f                   	pop    %edi
+  800ffb:	5d                   	pop    %ebp
+  800ffc:	c3                   	ret
+
+00800ffd <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800ffd:	55                   	push   %ebp
+  800ffe:	89 e5                	mov    %esp,%ebp
+  801000:	57                   	push   %edi
+  801001:	56                   	push   %esi
+  801002:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801003:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801008:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801010:	89 cb                	mov    %ecx,%ebx
+  801012:	89 cf                	mov    %ecx,%edi
+  801014:	89 ce                	mov    %ecx,%esi
+  801016:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  801018:	5b                   	pop    %ebx
+  801019:	5e                   	pop    %esi
+  80101a:	5f                   	pop    %edi
+  80101b:	5d                   	pop    %ebp
+  80101c:	c3                   	ret
+
+0080101d <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  80101d:	55                   	push   %ebp
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	57                   	push   %edi
+  801021:	56                   	push   %esi
+  801022:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801023:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801028:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801030:	89 cb                	mov    %ecx,%ebx
+  801032:	89 cf                	mov    %ecx,%edi
+  801034:	55                   	push   %ebp
+  801035:	89 e5                	mov    %esp,%ebp
+  801037:	8d 35 3f 10 80 00    	lea    0x80103f,%esi
+  80103d:	0f 34                	sysenter
+  80103f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  801040:	5b                   	pop    %ebx
+  801041:	5e                   	pop    %esi
+  801042:	5f                   	pop    %edi
+  801043:	5d                   	pop    %ebp
+  801044:	c3                   	ret
+
+00801045 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  801045:	55                   	push   %ebp
+  801046:	89 e5                	mov    %esp,%ebp
+  801048:	57                   	push   %edi
+  801049:	56                   	push   %esi
+  80104a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80104b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801050:	8b 55 08             	mov    0x8(%ebp),%edx
+  801053:	b8 16 00 00 00       	mov    $0x16,%eax
+  801058:	89 cb                	mov    %ecx,%ebx
+  80105a:	89 cf                	mov    %ecx,%edi
+  80105c:	55                   	push   %ebp
+  80105d:	89 e5                	mov    %esp,%ebp
+  80105f:	8d 35 67 10 80 00    	lea    0x801067,%esi
+  801065:	0f 34                	sysenter
+  801067:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  801068:	5b                   	pop    %ebx
+  801069:	5e                   	pop    %esi
+  80106a:	5f                   	pop    %edi
+  80106b:	5d                   	pop    %ebp
+  80106c:	c3                   	ret
+
+0080106d <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80106d:	55                   	push   %ebp
+  80106e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801070:	8b 45 08             	mov    0x8(%ebp),%eax
+  801073:	05 00 00 00 30       	add    $0x30000000,%eax
+  801078:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80107b:	5d                   	pop    %ebp
+  80107c:	c3                   	ret
+
+0080107d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801080:	8b 45 08             	mov    0x8(%ebp),%eax
+  801083:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801088:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80108d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801092:	5d                   	pop    %ebp
+  801093:	c3                   	ret
+
+00801094 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801094:	55                   	push   %ebp
+  801095:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801097:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80109c:	eb 02                	jmp    8010a0 <fd_alloc+0xc>
+  80109e:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8010a0:	89 c2                	mov    %eax,%edx
+  8010a2:	c1 ea 16             	shr    $0x16,%edx
+  8010a5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8010ac:	f6 c2 01             	test   $0x1,%dl
+  8010af:	74 2b                	je     8010dc <fd_alloc+0x48>
+  8010b1:	89 c2                	mov    %eax,%edx
+  8010b3:	c1 ea 0c             	shr    $0xc,%edx
+  8010b6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8010bd:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8010c3:	f6 c1 01             	test   $0x1,%cl
+  8010c6:	74 14                	je     8010dc <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8010c8:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8010ce:	75 ce                	jne    80109e <fd_alloc+0xa>
+  8010d0:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8010d5:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8010da:	eb 05                	jmp    8010e1 <fd_alloc+0x4d>
+			return 0;
+  8010dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8010e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e4:	89 02                	mov    %eax,(%edx)
+}
+  8010e6:	89 c8                	mov    %ecx,%eax
+  8010e8:	5d                   	pop    %ebp
+  8010e9:	c3                   	ret
+
+008010ea <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8010ea:	55                   	push   %ebp
+  8010eb:	89 e5                	mov    %esp,%ebp
+  8010ed:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8010f0:	83 f8 1f             	cmp    $0x1f,%eax
+  8010f3:	77 30                	ja     801125 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8010f5:	c1 e0 0c             	shl    $0xc,%eax
+  8010f8:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8010fd:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801103:	f6 c2 01             	test   $0x1,%dl
+  801106:	74 24                	je     80112c <fd_lookup+0x42>
+  801108:	89 c2                	mov    %eax,%edx
+  80110a:	c1 ea 0c             	shr    $0xc,%edx
+  80110d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801114:	f6 c2 01             	test   $0x1,%dl
+  801117:	74 1a                	je     801133 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801119:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80111c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80111e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801123:	5d                   	pop    %ebp
+  801124:	c3                   	ret
+		return -E_INVAL;
+  801125:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80112a:	eb f7                	jmp    801123 <fd_lookup+0x39>
+		return -E_INVAL;
+  80112c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801131:	eb f0                	jmp    801123 <fd_lookup+0x39>
+  801133:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801138:	eb e9                	jmp    801123 <fd_lookup+0x39>
+
+0080113a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80113a:	55                   	push   %ebp
+  80113b:	89 e5                	mov    %esp,%ebp
+  80113d:	53                   	push   %ebx
+  80113e:	83 ec 04             	sub    $0x4,%esp
+  801141:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801144:	b8 00 00 00 00       	mov    $0x0,%eax
+  801149:	eb 03                	jmp    80114e <dev_lookup+0x14>
+  80114b:	83 c0 01             	add    $0x1,%eax
+  80114e:	8b 1c 85 30 44 80 00 	mov    0x804430(,%eax,4),%ebx
+  801155:	85 db                	test   %ebx,%ebx
+  801157:	74 0b                	je     801164 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801159:	39 13                	cmp    %edx,(%ebx)
+  80115b:	75 ee                	jne    80114b <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80115d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801162:	eb 1f                	jmp    801183 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801164:	a1 00 60 80 00       	mov    0x806000,%eax
+  801169:	8b 40 48             	mov    0x48(%eax),%eax
+  80116c:	83 ec 04             	sub    $0x4,%esp
+  80116f:	52                   	push   %edx
+  801170:	50                   	push   %eax
+  801171:	68 b4 43 80 00       	push   $0x8043b4
+  801176:	e8 f7 f0 ff ff       	call   800272 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80117b:	83 c4 10             	add    $0x10,%esp
+  80117e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801183:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801186:	89 1a                	mov    %ebx,(%edx)
+}
+  801188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80118b:	c9                   	leave
+  80118c:	c3                   	ret
+
+0080118d <fd_close>:
+{
+  80118d:	55                   	push   %ebp
+  80118e:	89 e5                	mov    %esp,%ebp
+  801190:	57                   	push   %edi
+  801191:	56                   	push   %esi
+  801192:	53                   	push   %ebx
+  801193:	83 ec 24             	sub    $0x24,%esp
+  801196:	8b 75 08             	mov    0x8(%ebp),%esi
+  801199:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80119c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80119f:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011a0:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8011a6:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011a9:	50                   	push   %eax
+  8011aa:	e8 3b ff ff ff       	call   8010ea <fd_lookup>
+  8011af:	89 c3                	mov    %eax,%ebx
+  8011b1:	83 c4 10             	add    $0x10,%esp
+  8011b4:	85 c0                	test   %eax,%eax
+  8011b6:	78 05                	js     8011bd <fd_close+0x30>
+	    || fd != fd2)
+  8011b8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011bb:	74 16                	je     8011d3 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8011bd:	89 f8                	mov    %edi,%eax
+  8011bf:	84 c0                	test   %al,%al
+  8011c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c6:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8011c9:	89 d8                	mov    %ebx,%eax
+  8011cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ce:	5b                   	pop    %ebx
+  8011cf:	5e                   	pop    %esi
+  8011d0:	5f                   	pop    %edi
+  8011d1:	5d                   	pop    %ebp
+  8011d2:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8011d3:	83 ec 08             	sub    $0x8,%esp
+  8011d6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8011d9:	50                   	push   %eax
+  8011da:	ff 36                	push   (%esi)
+  8011dc:	e8 59 ff ff ff       	call   80113a <dev_lookup>
+  8011e1:	89 c3                	mov    %eax,%ebx
+  8011e3:	83 c4 10             	add    $0x10,%esp
+  8011e6:	85 c0                	test   %eax,%eax
+  8011e8:	78 1a                	js     801204 <fd_close+0x77>
+		if (dev->dev_close)
+  8011ea:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8011ed:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8011f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8011f5:	85 c0                	test   %eax,%eax
+  8011f7:	74 0b                	je     801204 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8011f9:	83 ec 0c             	sub    $0xc,%esp
+  8011fc:	56                   	push   %esi
+  8011fd:	ff d0                	call   *%eax
+  8011ff:	89 c3                	mov    %eax,%ebx
+  801201:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801204:	83 ec 08             	sub    $0x8,%esp
+  801207:	56                   	push   %esi
+  801208:	6a 00                	push   $0x0
+  80120a:	e8 ea fa ff ff       	call   800cf9 <sys_page_unmap>
+	return r;
+  80120f:	83 c4 10             	add    $0x10,%esp
+  801212:	eb b5                	jmp    8011c9 <fd_close+0x3c>
+
+00801214 <close>:
+
+int
+close(int fdnum)
+{
+  801214:	55                   	push   %ebp
+  801215:	89 e5                	mov    %esp,%ebp
+  801217:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80121a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80121d:	50                   	push   %eax
+  80121e:	ff 75 08             	push   0x8(%ebp)
+  801221:	e8 c4 fe ff ff       	call   8010ea <fd_lookup>
+  801226:	83 c4 10             	add    $0x10,%esp
+  801229:	85 c0                	test   %eax,%eax
+  80122b:	79 02                	jns    80122f <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80122d:	c9                   	leave
+  80122e:	c3                   	ret
+		return fd_close(fd, 1);
+  80122f:	83 ec 08             	sub    $0x8,%esp
+  801232:	6a 01                	push   $0x1
+  801234:	ff 75 f4             	push   -0xc(%ebp)
+  801237:	e8 51 ff ff ff       	call   80118d <fd_close>
+  80123c:	83 c4 10             	add    $0x10,%esp
+  80123f:	eb ec                	jmp    80122d <close+0x19>
+
+00801241 <close_all>:
+
+void
+close_all(void)
+{
+  801241:	55                   	push   %ebp
+  801242:	89 e5                	mov    %esp,%ebp
+  801244:	53                   	push   %ebx
+  801245:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801248:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80124d:	83 ec 0c             	sub    $0xc,%esp
+  801250:	53                   	push   %ebx
+  801251:	e8 be ff ff ff       	call   801214 <close>
+	for (i = 0; i < MAXFD; i++)
+  801256:	83 c3 01             	add    $0x1,%ebx
+  801259:	83 c4 10             	add    $0x10,%esp
+  80125c:	83 fb 20             	cmp    $0x20,%ebx
+  80125f:	75 ec                	jne    80124d <close_all+0xc>
+}
+  801261:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801264:	c9                   	leave
+  801265:	c3                   	ret
+
+00801266 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	57                   	push   %edi
+  80126a:	56                   	push   %esi
+  80126b:	53                   	push   %ebx
+  80126c:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80126f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801272:	50                   	push   %eax
+  801273:	ff 75 08             	push   0x8(%ebp)
+  801276:	e8 6f fe ff ff       	call   8010ea <fd_lookup>
+  80127b:	89 c3                	mov    %eax,%ebx
+  80127d:	83 c4 10             	add    $0x10,%esp
+  801280:	85 c0                	test   %eax,%eax
+  801282:	78 7f                	js     801303 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801284:	83 ec 0c             	sub    $0xc,%esp
+  801287:	ff 75 0c             	push   0xc(%ebp)
+  80128a:	e8 85 ff ff ff       	call   801214 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80128f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801292:	c1 e6 0c             	shl    $0xc,%esi
+  801295:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80129b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80129e:	89 3c 24             	mov    %edi,(%esp)
+  8012a1:	e8 d7 fd ff ff       	call   80107d <fd2data>
+  8012a6:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8012a8:	89 34 24             	mov    %esi,(%esp)
+  8012ab:	e8 cd fd ff ff       	call   80107d <fd2data>
+  8012b0:	83 c4 10             	add    $0x10,%esp
+  8012b3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8012b6:	89 d8                	mov    %ebx,%eax
+  8012b8:	c1 e8 16             	shr    $0x16,%eax
+  8012bb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012c2:	a8 01                	test   $0x1,%al
+  8012c4:	74 11                	je     8012d7 <dup+0x71>
+  8012c6:	89 d8                	mov    %ebx,%eax
+  8012c8:	c1 e8 0c             	shr    $0xc,%eax
+  8012cb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012d2:	f6 c2 01             	test   $0x1,%dl
+  8012d5:	75 36                	jne    80130d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8012d7:	89 f8                	mov    %edi,%eax
+  8012d9:	c1 e8 0c             	shr    $0xc,%eax
+  8012dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012e3:	83 ec 0c             	sub    $0xc,%esp
+  8012e6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012eb:	50                   	push   %eax
+  8012ec:	56                   	push   %esi
+  8012ed:	6a 00                	push   $0x0
+  8012ef:	57                   	push   %edi
+  8012f0:	6a 00                	push   $0x0
+  8012f2:	e8 c0 f9 ff ff       	call   800cb7 <sys_page_map>
+  8012f7:	89 c3                	mov    %eax,%ebx
+  8012f9:	83 c4 20             	add    $0x20,%esp
+  8012fc:	85 c0                	test   %eax,%eax
+  8012fe:	78 33                	js     801333 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801300:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801303:	89 d8                	mov    %ebx,%eax
+  801305:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801308:	5b                   	pop    %ebx
+  801309:	5e                   	pop    %esi
+  80130a:	5f                   	pop    %edi
+  80130b:	5d                   	pop    %ebp
+  80130c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80130d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801314:	83 ec 0c             	sub    $0xc,%esp
+  801317:	25 07 0e 00 00       	and    $0xe07,%eax
+  80131c:	50                   	push   %eax
+  80131d:	ff 75 d4             	push   -0x2c(%ebp)
+  801320:	6a 00                	push   $0x0
+  801322:	53                   	push   %ebx
+  801323:	6a 00                	push   $0x0
+  801325:	e8 8d f9 ff ff       	call   800cb7 <sys_page_map>
+  80132a:	89 c3                	mov    %eax,%ebx
+  80132c:	83 c4 20             	add    $0x20,%esp
+  80132f:	85 c0                	test   %eax,%eax
+  801331:	79 a4                	jns    8012d7 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801333:	83 ec 08             	sub    $0x8,%esp
+  801336:	56                   	push   %esi
+  801337:	6a 00                	push   $0x0
+  801339:	e8 bb f9 ff ff       	call   800cf9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80133e:	83 c4 08             	add    $0x8,%esp
+  801341:	ff 75 d4             	push   -0x2c(%ebp)
+  801344:	6a 00                	push   $0x0
+  801346:	e8 ae f9 ff ff       	call   800cf9 <sys_page_unmap>
+	return r;
+  80134b:	83 c4 10             	add    $0x10,%esp
+  80134e:	eb b3                	jmp    801303 <dup+0x9d>
+
+00801350 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801350:	55                   	push   %ebp
+  801351:	89 e5                	mov    %esp,%ebp
+  801353:	56                   	push   %esi
+  801354:	53                   	push   %ebx
+  801355:	83 ec 18             	sub    $0x18,%esp
+  801358:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80135b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80135e:	50                   	push   %eax
+  80135f:	56                   	push   %esi
+  801360:	e8 85 fd ff ff       	call   8010ea <fd_lookup>
+  801365:	83 c4 10             	add    $0x10,%esp
+  801368:	85 c0                	test   %eax,%eax
+  80136a:	78 3c                	js     8013a8 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80136c:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80136f:	83 ec 08             	sub    $0x8,%esp
+  801372:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801375:	50                   	push   %eax
+  801376:	ff 33                	push   (%ebx)
+  801378:	e8 bd fd ff ff       	call   80113a <dev_lookup>
+  80137d:	83 c4 10             	add    $0x10,%esp
+  801380:	85 c0                	test   %eax,%eax
+  801382:	78 24                	js     8013a8 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801384:	8b 43 08             	mov    0x8(%ebx),%eax
+  801387:	83 e0 03             	and    $0x3,%eax
+  80138a:	83 f8 01             	cmp    $0x1,%eax
+  80138d:	74 20                	je     8013af <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80138f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801392:	8b 40 08             	mov    0x8(%eax),%eax
+  801395:	85 c0                	test   %eax,%eax
+  801397:	74 37                	je     8013d0 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801399:	83 ec 04             	sub    $0x4,%esp
+  80139c:	ff 75 10             	push   0x10(%ebp)
+  80139f:	ff 75 0c             	push   0xc(%ebp)
+  8013a2:	53                   	push   %ebx
+  8013a3:	ff d0                	call   *%eax
+  8013a5:	83 c4 10             	add    $0x10,%esp
+}
+  8013a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013ab:	5b                   	pop    %ebx
+  8013ac:	5e                   	pop    %esi
+  8013ad:	5d                   	pop    %ebp
+  8013ae:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013af:	a1 00 60 80 00       	mov    0x806000,%eax
+  8013b4:	8b 40 48             	mov    0x48(%eax),%eax
+  8013b7:	83 ec 04             	sub    $0x4,%esp
+  8013ba:	56                   	push   %esi
+  8013bb:	50                   	push   %eax
+  8013bc:	68 f5 43 80 00       	push   $0x8043f5
+  8013c1:	e8 ac ee ff ff       	call   800272 <cprintf>
+		return -E_INVAL;
+  8013c6:	83 c4 10             	add    $0x10,%esp
+  8013c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013ce:	eb d8                	jmp    8013a8 <read+0x58>
+		return -E_NOT_SUPP;
+  8013d0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013d5:	eb d1                	jmp    8013a8 <read+0x58>
+
+008013d7 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8013d7:	55                   	push   %ebp
+  8013d8:	89 e5                	mov    %esp,%ebp
+  8013da:	57                   	push   %edi
+  8013db:	56                   	push   %esi
+  8013dc:	53                   	push   %ebx
+  8013dd:	83 ec 0c             	sub    $0xc,%esp
+  8013e0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013e3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8013e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013eb:	eb 02                	jmp    8013ef <readn+0x18>
+  8013ed:	01 c3                	add    %eax,%ebx
+  8013ef:	39 f3                	cmp    %esi,%ebx
+  8013f1:	73 21                	jae    801414 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8013f3:	83 ec 04             	sub    $0x4,%esp
+  8013f6:	89 f0                	mov    %esi,%eax
+  8013f8:	29 d8                	sub    %ebx,%eax
+  8013fa:	50                   	push   %eax
+  8013fb:	89 d8                	mov    %ebx,%eax
+  8013fd:	03 45 0c             	add    0xc(%ebp),%eax
+  801400:	50                   	push   %eax
+  801401:	57                   	push   %edi
+  801402:	e8 49 ff ff ff       	call   801350 <read>
+		if (m < 0)
+  801407:	83 c4 10             	add    $0x10,%esp
+  80140a:	85 c0                	test   %eax,%eax
+  80140c:	78 04                	js     801412 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80140e:	75 dd                	jne    8013ed <readn+0x16>
+  801410:	eb 02                	jmp    801414 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801412:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801414:	89 d8                	mov    %ebx,%eax
+  801416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801419:	5b                   	pop    %ebx
+  80141a:	5e                   	pop    %esi
+  80141b:	5f                   	pop    %edi
+  80141c:	5d                   	pop    %ebp
+  80141d:	c3                   	ret
+
+0080141e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80141e:	55                   	push   %ebp
+  80141f:	89 e5                	mov    %esp,%ebp
+  801421:	56                   	push   %esi
+  801422:	53                   	push   %ebx
+  801423:	83 ec 18             	sub    $0x18,%esp
+  801426:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801429:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80142c:	50                   	push   %eax
+  80142d:	53                   	push   %ebx
+  80142e:	e8 b7 fc ff ff       	call   8010ea <fd_lookup>
+  801433:	83 c4 10             	add    $0x10,%esp
+  801436:	85 c0                	test   %eax,%eax
+  801438:	78 37                	js     801471 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80143a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80143d:	83 ec 08             	sub    $0x8,%esp
+  801440:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801443:	50                   	push   %eax
+  801444:	ff 36                	push   (%esi)
+  801446:	e8 ef fc ff ff       	call   80113a <dev_lookup>
+  80144b:	83 c4 10             	add    $0x10,%esp
+  80144e:	85 c0                	test   %eax,%eax
+  801450:	78 1f                	js     801471 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801452:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801456:	74 20                	je     801478 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801458:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80145b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80145e:	85 c0                	test   %eax,%eax
+  801460:	74 37                	je     801499 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801462:	83 ec 04             	sub    $0x4,%esp
+  801465:	ff 75 10             	push   0x10(%ebp)
+  801468:	ff 75 0c             	push   0xc(%ebp)
+  80146b:	56                   	push   %esi
+  80146c:	ff d0                	call   *%eax
+  80146e:	83 c4 10             	add    $0x10,%esp
+}
+  801471:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801474:	5b                   	pop    %ebx
+  801475:	5e                   	pop    %esi
+  801476:	5d                   	pop    %ebp
+  801477:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801478:	a1 00 60 80 00       	mov    0x806000,%eax
+  80147d:	8b 40 48             	mov    0x48(%eax),%eax
+  801480:	83 ec 04             	sub    $0x4,%esp
+  801483:	53                   	push   %ebx
+  801484:	50                   	push   %eax
+  801485:	68 11 44 80 00       	push   $0x804411
+  80148a:	e8 e3 ed ff ff       	call   800272 <cprintf>
+		return -E_INVAL;
+  80148f:	83 c4 10             	add    $0x10,%esp
+  801492:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801497:	eb d8                	jmp    801471 <write+0x53>
+		return -E_NOT_SUPP;
+  801499:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80149e:	eb d1                	jmp    801471 <write+0x53>
+
+008014a0 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8014a0:	55                   	push   %ebp
+  8014a1:	89 e5                	mov    %esp,%ebp
+  8014a3:	53                   	push   %ebx
+  8014a4:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014a7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014aa:	50                   	push   %eax
+  8014ab:	ff 75 08             	push   0x8(%ebp)
+  8014ae:	e8 37 fc ff ff       	call   8010ea <fd_lookup>
+  8014b3:	83 c4 10             	add    $0x10,%esp
+  8014b6:	85 c0                	test   %eax,%eax
+  8014b8:	78 3a                	js     8014f4 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014ba:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014bd:	83 ec 08             	sub    $0x8,%esp
+  8014c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c3:	50                   	push   %eax
+  8014c4:	ff 33                	push   (%ebx)
+  8014c6:	e8 6f fc ff ff       	call   80113a <dev_lookup>
+  8014cb:	83 c4 10             	add    $0x10,%esp
+  8014ce:	85 c0                	test   %eax,%eax
+  8014d0:	78 22                	js     8014f4 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8014d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014d5:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8014d8:	85 c0                	test   %eax,%eax
+  8014da:	74 0d                	je     8014e9 <seek+0x49>
+  8014dc:	83 ec 0c             	sub    $0xc,%esp
+  8014df:	53                   	push   %ebx
+  8014e0:	ff d0                	call   *%eax
+  8014e2:	83 c4 10             	add    $0x10,%esp
+  8014e5:	85 c0                	test   %eax,%eax
+  8014e7:	78 0b                	js     8014f4 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8014e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014ec:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8014ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014f7:	c9                   	leave
+  8014f8:	c3                   	ret
+
+008014f9 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8014f9:	55                   	push   %ebp
+  8014fa:	89 e5                	mov    %esp,%ebp
+  8014fc:	53                   	push   %ebx
+  8014fd:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801500:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801503:	50                   	push   %eax
+  801504:	ff 75 08             	push   0x8(%ebp)
+  801507:	e8 de fb ff ff       	call   8010ea <fd_lookup>
+  80150c:	83 c4 10             	add    $0x10,%esp
+  80150f:	85 c0                	test   %eax,%eax
+  801511:	78 2b                	js     80153e <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801513:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801516:	83 ec 08             	sub    $0x8,%esp
+  801519:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80151c:	50                   	push   %eax
+  80151d:	ff 33                	push   (%ebx)
+  80151f:	e8 16 fc ff ff       	call   80113a <dev_lookup>
+  801524:	83 c4 10             	add    $0x10,%esp
+  801527:	85 c0                	test   %eax,%eax
+  801529:	78 13                	js     80153e <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  80152b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80152e:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801531:	85 c0                	test   %eax,%eax
+  801533:	74 0e                	je     801543 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801535:	83 ec 0c             	sub    $0xc,%esp
+  801538:	53                   	push   %ebx
+  801539:	ff d0                	call   *%eax
+  80153b:	83 c4 10             	add    $0x10,%esp
+}
+  80153e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801541:	c9                   	leave
+  801542:	c3                   	ret
+		return 0;
+  801543:	b8 00 00 00 00       	mov    $0x0,%eax
+  801548:	eb f4                	jmp    80153e <fsync+0x45>
+
+0080154a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80154a:	55                   	push   %ebp
+  80154b:	89 e5                	mov    %esp,%ebp
+  80154d:	56                   	push   %esi
+  80154e:	53                   	push   %ebx
+  80154f:	83 ec 18             	sub    $0x18,%esp
+  801552:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801555:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801558:	50                   	push   %eax
+  801559:	53                   	push   %ebx
+  80155a:	e8 8b fb ff ff       	call   8010ea <fd_lookup>
+  80155f:	83 c4 10             	add    $0x10,%esp
+  801562:	85 c0                	test   %eax,%eax
+  801564:	78 34                	js     80159a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801566:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801569:	83 ec 08             	sub    $0x8,%esp
+  80156c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80156f:	50                   	push   %eax
+  801570:	ff 36                	push   (%esi)
+  801572:	e8 c3 fb ff ff       	call   80113a <dev_lookup>
+  801577:	83 c4 10             	add    $0x10,%esp
+  80157a:	85 c0                	test   %eax,%eax
+  80157c:	78 1c                	js     80159a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80157e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801582:	74 1d                	je     8015a1 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801584:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801587:	8b 40 18             	mov    0x18(%eax),%eax
+  80158a:	85 c0                	test   %eax,%eax
+  80158c:	74 34                	je     8015c2 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80158e:	83 ec 08             	sub    $0x8,%esp
+  801591:	ff 75 0c             	push   0xc(%ebp)
+  801594:	56                   	push   %esi
+  801595:	ff d0                	call   *%eax
+  801597:	83 c4 10             	add    $0x10,%esp
+}
+  80159a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80159d:	5b                   	pop    %ebx
+  80159e:	5e                   	pop    %esi
+  80159f:	5d                   	pop    %ebp
+  8015a0:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8015a1:	a1 00 60 80 00       	mov    0x806000,%eax
+  8015a6:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015a9:	83 ec 04             	sub    $0x4,%esp
+  8015ac:	53                   	push   %ebx
+  8015ad:	50                   	push   %eax
+  8015ae:	68 d4 43 80 00       	push   $0x8043d4
+  8015b3:	e8 ba ec ff ff       	call   800272 <cprintf>
+		return -E_INVAL;
+  8015b8:	83 c4 10             	add    $0x10,%esp
+  8015bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c0:	eb d8                	jmp    80159a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8015c2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015c7:	eb d1                	jmp    80159a <ftruncate+0x50>
+
+008015c9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	56                   	push   %esi
+  8015cd:	53                   	push   %ebx
+  8015ce:	83 ec 18             	sub    $0x18,%esp
+  8015d1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015d4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015d7:	50                   	push   %eax
+  8015d8:	ff 75 08             	push   0x8(%ebp)
+  8015db:	e8 0a fb ff ff       	call   8010ea <fd_lookup>
+  8015e0:	83 c4 10             	add    $0x10,%esp
+  8015e3:	85 c0                	test   %eax,%eax
+  8015e5:	78 49                	js     801630 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015e7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015ea:	83 ec 08             	sub    $0x8,%esp
+  8015ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015f0:	50                   	push   %eax
+  8015f1:	ff 36                	push   (%esi)
+  8015f3:	e8 42 fb ff ff       	call   80113a <dev_lookup>
+  8015f8:	83 c4 10             	add    $0x10,%esp
+  8015fb:	85 c0                	test   %eax,%eax
+  8015fd:	78 31                	js     801630 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8015ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801602:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801606:	74 2f                	je     801637 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801608:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80160b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801612:	00 00 00 
+	stat->st_isdir = 0;
+  801615:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80161c:	00 00 00 
+	stat->st_dev = dev;
+  80161f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801625:	83 ec 08             	sub    $0x8,%esp
+  801628:	53                   	push   %ebx
+  801629:	56                   	push   %esi
+  80162a:	ff 50 14             	call   *0x14(%eax)
+  80162d:	83 c4 10             	add    $0x10,%esp
+}
+  801630:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801633:	5b                   	pop    %ebx
+  801634:	5e                   	pop    %esi
+  801635:	5d                   	pop    %ebp
+  801636:	c3                   	ret
+		return -E_NOT_SUPP;
+  801637:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80163c:	eb f2                	jmp    801630 <fstat+0x67>
+
+0080163e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80163e:	55                   	push   %ebp
+  80163f:	89 e5                	mov    %esp,%ebp
+  801641:	56                   	push   %esi
+  801642:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801643:	83 ec 08             	sub    $0x8,%esp
+  801646:	68 00 10 00 00       	push   $0x1000
+  80164b:	ff 75 08             	push   0x8(%ebp)
+  80164e:	e8 b3 07 00 00       	call   801e06 <open>
+  801653:	89 c3                	mov    %eax,%ebx
+  801655:	83 c4 10             	add    $0x10,%esp
+  801658:	85 c0                	test   %eax,%eax
+  80165a:	78 1b                	js     801677 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  80165c:	83 ec 08             	sub    $0x8,%esp
+  80165f:	ff 75 0c             	push   0xc(%ebp)
+  801662:	50                   	push   %eax
+  801663:	e8 61 ff ff ff       	call   8015c9 <fstat>
+  801668:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80166a:	89 1c 24             	mov    %ebx,(%esp)
+  80166d:	e8 a2 fb ff ff       	call   801214 <close>
+	return r;
+  801672:	83 c4 10             	add    $0x10,%esp
+  801675:	89 f3                	mov    %esi,%ebx
+}
+  801677:	89 d8                	mov    %ebx,%eax
+  801679:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80167c:	5b                   	pop    %ebx
+  80167d:	5e                   	pop    %esi
+  80167e:	5d                   	pop    %ebp
+  80167f:	c3                   	ret
+
+00801680 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801680:	55                   	push   %ebp
+  801681:	89 e5                	mov    %esp,%ebp
+  801683:	57                   	push   %edi
+  801684:	56                   	push   %esi
+  801685:	53                   	push   %ebx
+  801686:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  80168c:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801692:	89 d6                	mov    %edx,%esi
+  801694:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  80169a:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  80169d:	89 d3                	mov    %edx,%ebx
+  80169f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  8016a5:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  8016ac:	74 1d                	je     8016cb <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8016ae:	b8 00 70 80 00       	mov    $0x807000,%eax
+  8016b3:	83 c8 07             	or     $0x7,%eax
+  8016b6:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  8016bc:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8016c1:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  8016c7:	01 ce                	add    %ecx,%esi
+  8016c9:	eb 28                	jmp    8016f3 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8016cb:	83 ec 0c             	sub    $0xc,%esp
+  8016ce:	6a 01                	push   $0x1
+  8016d0:	e8 23 25 00 00       	call   803bf8 <ipc_find_env>
+  8016d5:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  8016da:	83 c4 10             	add    $0x10,%esp
+  8016dd:	eb cf                	jmp    8016ae <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  8016df:	83 c0 01             	add    $0x1,%eax
+  8016e2:	89 fa                	mov    %edi,%edx
+  8016e4:	09 da                	or     %ebx,%edx
+  8016e6:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8016ed:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8016f3:	39 f3                	cmp    %esi,%ebx
+  8016f5:	72 e8                	jb     8016df <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  8016f7:	83 f8 41             	cmp    $0x41,%eax
+  8016fa:	77 2f                	ja     80172b <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  8016fc:	50                   	push   %eax
+  8016fd:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801703:	50                   	push   %eax
+  801704:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  80170a:	ff 35 c8 80 80 00    	push   0x8080c8
+  801710:	e8 95 24 00 00       	call   803baa <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801715:	83 c4 0c             	add    $0xc,%esp
+  801718:	6a 00                	push   $0x0
+  80171a:	6a 00                	push   $0x0
+  80171c:	6a 00                	push   $0x0
+  80171e:	e8 31 23 00 00       	call   803a54 <ipc_recv>
+}
+  801723:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801726:	5b                   	pop    %ebx
+  801727:	5e                   	pop    %esi
+  801728:	5f                   	pop    %edi
+  801729:	5d                   	pop    %ebp
+  80172a:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  80172b:	68 44 44 80 00       	push   $0x804444
+  801730:	68 60 44 80 00       	push   $0x804460
+  801735:	6a 40                	push   $0x40
+  801737:	68 75 44 80 00       	push   $0x804475
+  80173c:	e8 56 ea ff ff       	call   800197 <_panic>
+
+00801741 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801741:	55                   	push   %ebp
+  801742:	89 e5                	mov    %esp,%ebp
+  801744:	57                   	push   %edi
+  801745:	56                   	push   %esi
+  801746:	53                   	push   %ebx
+  801747:	83 ec 1c             	sub    $0x1c,%esp
+  80174a:	89 c3                	mov    %eax,%ebx
+  80174c:	89 d6                	mov    %edx,%esi
+  80174e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801751:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801757:	89 ca                	mov    %ecx,%edx
+  801759:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  80175c:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801763:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801766:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  80176d:	8b 76 0c             	mov    0xc(%esi),%esi
+  801770:	89 fb                	mov    %edi,%ebx
+  801772:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801779:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80177c:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801783:	8b 75 08             	mov    0x8(%ebp),%esi
+  801786:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  80178d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801790:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801797:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  80179a:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  8017a1:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  8017a6:	39 c8                	cmp    %ecx,%eax
+  8017a8:	74 0d                	je     8017b7 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  8017aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017b2:	5b                   	pop    %ebx
+  8017b3:	5e                   	pop    %esi
+  8017b4:	5f                   	pop    %edi
+  8017b5:	5d                   	pop    %ebp
+  8017b6:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017b7:	6a 07                	push   $0x7
+  8017b9:	68 00 70 80 00       	push   $0x807000
+  8017be:	6a 0d                	push   $0xd
+  8017c0:	ff 35 c8 80 80 00    	push   0x8080c8
+  8017c6:	e8 f4 22 00 00       	call   803abf <ipc_send>
+  8017cb:	83 c4 10             	add    $0x10,%esp
+  8017ce:	eb da                	jmp    8017aa <fsring_post+0x69>
+
+008017d0 <fsipcv>:
+{
+  8017d0:	55                   	push   %ebp
+  8017d1:	89 e5                	mov    %esp,%ebp
+  8017d3:	57                   	push   %edi
+  8017d4:	56                   	push   %esi
+  8017d5:	53                   	push   %ebx
+  8017d6:	83 ec 0c             	sub    $0xc,%esp
+  8017d9:	89 c7                	mov    %eax,%edi
+  8017db:	89 d3                	mov    %edx,%ebx
+  8017dd:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  8017df:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  8017e6:	74 26                	je     80180e <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017e8:	6a 07                	push   $0x7
+  8017ea:	68 00 70 80 00       	push   $0x807000
+  8017ef:	57                   	push   %edi
+  8017f0:	ff 35 c8 80 80 00    	push   0x8080c8
+  8017f6:	e8 c4 22 00 00       	call   803abf <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  8017fb:	6a 00                	push   $0x0
+  8017fd:	56                   	push   %esi
+  8017fe:	53                   	push   %ebx
+  8017ff:	6a 00                	push   $0x0
+  801801:	e8 11 23 00 00       	call   803b17 <ipc_recvv>
+}
+  801806:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801809:	5b                   	pop    %ebx
+  80180a:	5e                   	pop    %esi
+  80180b:	5f                   	pop    %edi
+  80180c:	5d                   	pop    %ebp
+  80180d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80180e:	83 ec 0c             	sub    $0xc,%esp
+  801811:	6a 01                	push   $0x1
+  801813:	e8 e0 23 00 00       	call   803bf8 <ipc_find_env>
+  801818:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  80181d:	83 c4 10             	add    $0x10,%esp
+  801820:	eb c6                	jmp    8017e8 <fsipcv+0x18>
+
+00801822 <fsipc>:
+{
+  801822:	55                   	push   %ebp
+  801823:	89 e5                	mov    %esp,%ebp
+  801825:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801828:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  80182f:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801832:	e8 99 ff ff ff       	call   8017d0 <fsipcv>
+}
+  801837:	c9                   	leave
+  801838:	c3                   	ret
+
+00801839 <file_write_direct>:
+{
+  801839:	55                   	push   %ebp
+  80183a:	89 e5                	mov    %esp,%ebp
+  80183c:	56                   	push   %esi
+  80183d:	53                   	push   %ebx
+  80183e:	89 c3                	mov    %eax,%ebx
+  801840:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801842:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801848:	77 40                	ja     80188a <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80184a:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  80184f:	39 c8                	cmp    %ecx,%eax
+  801851:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801854:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801857:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  80185d:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801862:	83 ec 04             	sub    $0x4,%esp
+  801865:	50                   	push   %eax
+  801866:	52                   	push   %edx
+  801867:	68 08 70 80 00       	push   $0x807008
+  80186c:	e8 75 f1 ff ff       	call   8009e6 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801871:	ba 00 00 00 00       	mov    $0x0,%edx
+  801876:	b8 04 00 00 00       	mov    $0x4,%eax
+  80187b:	e8 a2 ff ff ff       	call   801822 <fsipc>
+  801880:	83 c4 10             	add    $0x10,%esp
+}
+  801883:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801886:	5b                   	pop    %ebx
+  801887:	5e                   	pop    %esi
+  801888:	5d                   	pop    %ebp
+  801889:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80188a:	89 d6                	mov    %edx,%esi
+  80188c:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801892:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801897:	29 f1                	sub    %esi,%ecx
+  801899:	39 c1                	cmp    %eax,%ecx
+  80189b:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  80189e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8018a1:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  8018a6:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8018ac:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  8018b2:	83 ec 0c             	sub    $0xc,%esp
+  8018b5:	6a 05                	push   $0x5
+  8018b7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8018bc:	e8 bf fd ff ff       	call   801680 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  8018c1:	83 c4 10             	add    $0x10,%esp
+  8018c4:	eb bd                	jmp    801883 <file_write_direct+0x4a>
+
+008018c6 <devfile_sync>:
+{
+  8018c6:	55                   	push   %ebp
+  8018c7:	89 e5                	mov    %esp,%ebp
+  8018c9:	57                   	push   %edi
+  8018ca:	56                   	push   %esi
+  8018cb:	53                   	push   %ebx
+  8018cc:	83 ec 28             	sub    $0x28,%esp
+  8018cf:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  8018d2:	56                   	push   %esi
+  8018d3:	e8 a5 f7 ff ff       	call   80107d <fd2data>
+  8018d8:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  8018da:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  8018dd:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  8018e4:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8018e7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  8018ec:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8018f0:	74 45                	je     801937 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  8018f2:	8b 46 14             	mov    0x14(%esi),%eax
+  8018f5:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8018f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801902:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801905:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801908:	39 cb                	cmp    %ecx,%ebx
+  80190a:	73 14                	jae    801920 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  80190c:	29 d9                	sub    %ebx,%ecx
+  80190e:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801911:	89 f0                	mov    %esi,%eax
+  801913:	e8 21 ff ff ff       	call   801839 <file_write_direct>
+  801918:	85 c0                	test   %eax,%eax
+  80191a:	7e 04                	jle    801920 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80191c:	01 c3                	add    %eax,%ebx
+  80191e:	eb e5                	jmp    801905 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801920:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801923:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  80192a:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  80192d:	85 c0                	test   %eax,%eax
+  80192f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801934:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801937:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80193a:	5b                   	pop    %ebx
+  80193b:	5e                   	pop    %esi
+  80193c:	5f                   	pop    %edi
+  80193d:	5d                   	pop    %ebp
+  80193e:	c3                   	ret
+
+0080193f <devfile_write>:
+{
+  80193f:	55                   	push   %ebp
+  801940:	89 e5                	mov    %esp,%ebp
+  801942:	57                   	push   %edi
+  801943:	56                   	push   %esi
+  801944:	53                   	push   %ebx
+  801945:	83 ec 28             	sub    $0x28,%esp
+  801948:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80194b:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80194e:	53                   	push   %ebx
+  80194f:	e8 29 f7 ff ff       	call   80107d <fd2data>
+  801954:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801957:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80195a:	83 c4 10             	add    $0x10,%esp
+  80195d:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801961:	74 43                	je     8019a6 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801963:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  80196a:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80196d:	85 c0                	test   %eax,%eax
+  80196f:	74 43                	je     8019b4 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801971:	89 c2                	mov    %eax,%edx
+  801973:	03 53 14             	add    0x14(%ebx),%edx
+  801976:	39 fa                	cmp    %edi,%edx
+  801978:	75 0b                	jne    801985 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  80197a:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  80197d:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801983:	76 66                	jbe    8019eb <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801985:	83 ec 0c             	sub    $0xc,%esp
+  801988:	53                   	push   %ebx
+  801989:	e8 38 ff ff ff       	call   8018c6 <devfile_sync>
+  80198e:	83 c4 10             	add    $0x10,%esp
+  801991:	85 c0                	test   %eax,%eax
+  801993:	78 4e                	js     8019e3 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801995:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80199b:	77 56                	ja     8019f3 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  80199d:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8019a0:	85 c0                	test   %eax,%eax
+  8019a2:	75 20                	jne    8019c4 <devfile_write+0x85>
+  8019a4:	eb 16                	jmp    8019bc <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  8019a6:	89 f1                	mov    %esi,%ecx
+  8019a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019ab:	89 d8                	mov    %ebx,%eax
+  8019ad:	e8 87 fe ff ff       	call   801839 <file_write_direct>
+  8019b2:	eb 2f                	jmp    8019e3 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8019b4:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8019ba:	77 37                	ja     8019f3 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  8019bc:	89 7b 14             	mov    %edi,0x14(%ebx)
+  8019bf:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  8019c4:	83 ec 04             	sub    $0x4,%esp
+  8019c7:	56                   	push   %esi
+  8019c8:	ff 75 0c             	push   0xc(%ebp)
+  8019cb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8019ce:	01 c1                	add    %eax,%ecx
+  8019d0:	51                   	push   %ecx
+  8019d1:	e8 10 f0 ff ff       	call   8009e6 <memmove>
+	ff->buf_wlen += n;
+  8019d6:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  8019d9:	01 f7                	add    %esi,%edi
+  8019db:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8019de:	89 f0                	mov    %esi,%eax
+  8019e0:	83 c4 10             	add    $0x10,%esp
+}
+  8019e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019e6:	5b                   	pop    %ebx
+  8019e7:	5e                   	pop    %esi
+  8019e8:	5f                   	pop    %edi
+  8019e9:	5d                   	pop    %ebp
+  8019ea:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  8019eb:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8019f1:	76 d1                	jbe    8019c4 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  8019f3:	89 f1                	mov    %esi,%ecx
+  8019f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019f8:	89 d8                	mov    %ebx,%eax
+  8019fa:	e8 3a fe ff ff       	call   801839 <file_write_direct>
+  8019ff:	eb e2                	jmp    8019e3 <devfile_write+0xa4>
+
+00801a01 <devfile_trunc>:
+{
+  801a01:	55                   	push   %ebp
+  801a02:	89 e5                	mov    %esp,%ebp
+  801a04:	53                   	push   %ebx
+  801a05:	83 ec 10             	sub    $0x10,%esp
+  801a08:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801a0b:	53                   	push   %ebx
+  801a0c:	e8 b5 fe ff ff       	call   8018c6 <devfile_sync>
+  801a11:	83 c4 10             	add    $0x10,%esp
+  801a14:	85 c0                	test   %eax,%eax
+  801a16:	78 1f                	js     801a37 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a18:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a1b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801a20:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a23:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801a28:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a2d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a32:	e8 eb fd ff ff       	call   801822 <fsipc>
+}
+  801a37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a3a:	c9                   	leave
+  801a3b:	c3                   	ret
+
+00801a3c <devfile_stat>:
+{
+  801a3c:	55                   	push   %ebp
+  801a3d:	89 e5                	mov    %esp,%ebp
+  801a3f:	56                   	push   %esi
+  801a40:	53                   	push   %ebx
+  801a41:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a44:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801a47:	83 ec 0c             	sub    $0xc,%esp
+  801a4a:	53                   	push   %ebx
+  801a4b:	e8 76 fe ff ff       	call   8018c6 <devfile_sync>
+  801a50:	83 c4 10             	add    $0x10,%esp
+  801a53:	85 c0                	test   %eax,%eax
+  801a55:	78 47                	js     801a9e <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a57:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a5a:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a64:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a69:	e8 b4 fd ff ff       	call   801822 <fsipc>
+  801a6e:	85 c0                	test   %eax,%eax
+  801a70:	78 2c                	js     801a9e <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a72:	83 ec 08             	sub    $0x8,%esp
+  801a75:	68 00 70 80 00       	push   $0x807000
+  801a7a:	56                   	push   %esi
+  801a7b:	e8 e0 ed ff ff       	call   800860 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a80:	a1 80 70 80 00       	mov    0x807080,%eax
+  801a85:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a8b:	a1 84 70 80 00       	mov    0x807084,%eax
+  801a90:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801a96:	83 c4 10             	add    $0x10,%esp
+  801a99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aa1:	5b                   	pop    %ebx
+  801aa2:	5e                   	pop    %esi
+  801aa3:	5d                   	pop    %ebp
+  801aa4:	c3                   	ret
+
+00801aa5 <devfile_flush>:
+{
+  801aa5:	55                   	push   %ebp
+  801aa6:	89 e5                	mov    %esp,%ebp
+  801aa8:	56                   	push   %esi
+  801aa9:	53                   	push   %ebx
+  801aaa:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801aad:	83 ec 0c             	sub    $0xc,%esp
+  801ab0:	56                   	push   %esi
+  801ab1:	e8 10 fe ff ff       	call   8018c6 <devfile_sync>
+  801ab6:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801ab8:	83 c4 10             	add    $0x10,%esp
+  801abb:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801abf:	75 25                	jne    801ae6 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ac1:	8b 46 0c             	mov    0xc(%esi),%eax
+  801ac4:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801ac9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ace:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ad3:	e8 4a fd ff ff       	call   801822 <fsipc>
+  801ad8:	85 c0                	test   %eax,%eax
+  801ada:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801add:	89 d8                	mov    %ebx,%eax
+  801adf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae2:	5b                   	pop    %ebx
+  801ae3:	5e                   	pop    %esi
+  801ae4:	5d                   	pop    %ebp
+  801ae5:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801ae6:	83 ec 0c             	sub    $0xc,%esp
+  801ae9:	56                   	push   %esi
+  801aea:	e8 8e f5 ff ff       	call   80107d <fd2data>
+  801aef:	83 c4 08             	add    $0x8,%esp
+  801af2:	50                   	push   %eax
+  801af3:	6a 00                	push   $0x0
+  801af5:	e8 ff f1 ff ff       	call   800cf9 <sys_page_unmap>
+  801afa:	83 c4 10             	add    $0x10,%esp
+  801afd:	eb c2                	jmp    801ac1 <devfile_flush+0x1c>
+
+00801aff <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801aff:	55                   	push   %ebp
+  801b00:	89 e5                	mov    %esp,%ebp
+  801b02:	57                   	push   %edi
+  801b03:	56                   	push   %esi
+  801b04:	53                   	push   %ebx
+  801b05:	83 ec 64             	sub    $0x64,%esp
+  801b08:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801b0a:	52                   	push   %edx
+  801b0b:	50                   	push   %eax
+  801b0c:	e8 d9 f5 ff ff       	call   8010ea <fd_lookup>
+  801b11:	89 c1                	mov    %eax,%ecx
+  801b13:	83 c4 10             	add    $0x10,%esp
+  801b16:	85 c0                	test   %eax,%eax
+  801b18:	0f 88 f2 00 00 00    	js     801c10 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801b1e:	8b 07                	mov    (%edi),%eax
+  801b20:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801b26:	39 10                	cmp    %edx,(%eax)
+  801b28:	0f 85 03 01 00 00    	jne    801c31 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801b2e:	a1 00 60 80 00       	mov    0x806000,%eax
+  801b33:	8b 40 48             	mov    0x48(%eax),%eax
+  801b36:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  801b3c:	0f 84 96 00 00 00    	je     801bd8 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801b42:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801b49:	0f 84 cb 00 00 00    	je     801c1a <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b4f:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801b54:	83 c8 07             	or     $0x7,%eax
+  801b57:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801b5a:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b5d:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801b62:	83 ec 04             	sub    $0x4,%esp
+  801b65:	68 07 04 00 00       	push   $0x407
+  801b6a:	53                   	push   %ebx
+  801b6b:	6a 00                	push   $0x0
+  801b6d:	e8 fa f0 ff ff       	call   800c6c <sys_page_alloc>
+  801b72:	89 c1                	mov    %eax,%ecx
+  801b74:	83 c4 10             	add    $0x10,%esp
+  801b77:	85 c0                	test   %eax,%eax
+  801b79:	0f 88 91 00 00 00    	js     801c10 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801b7f:	89 d8                	mov    %ebx,%eax
+  801b81:	83 c8 07             	or     $0x7,%eax
+  801b84:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801b86:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b8c:	83 c6 04             	add    $0x4,%esi
+  801b8f:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801b95:	75 cb                	jne    801b62 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801b97:	6a 12                	push   $0x12
+  801b99:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801b9c:	50                   	push   %eax
+  801b9d:	6a 0c                	push   $0xc
+  801b9f:	ff 35 c8 80 80 00    	push   0x8080c8
+  801ba5:	e8 00 20 00 00       	call   803baa <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801baa:	83 c4 0c             	add    $0xc,%esp
+  801bad:	6a 00                	push   $0x0
+  801baf:	6a 00                	push   $0x0
+  801bb1:	6a 00                	push   $0x0
+  801bb3:	e8 9c 1e 00 00       	call   803a54 <ipc_recv>
+  801bb8:	89 c1                	mov    %eax,%ecx
+  801bba:	83 c4 10             	add    $0x10,%esp
+  801bbd:	85 c0                	test   %eax,%eax
+  801bbf:	78 4f                	js     801c10 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801bc1:	a1 00 60 80 00       	mov    0x806000,%eax
+  801bc6:	8b 40 48             	mov    0x48(%eax),%eax
+  801bc9:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  801bce:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  801bd5:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801bd8:	83 ec 0c             	sub    $0xc,%esp
+  801bdb:	ff 37                	push   (%edi)
+  801bdd:	e8 e4 fc ff ff       	call   8018c6 <devfile_sync>
+  801be2:	89 c1                	mov    %eax,%ecx
+  801be4:	83 c4 10             	add    $0x10,%esp
+  801be7:	85 c0                	test   %eax,%eax
+  801be9:	78 25                	js     801c10 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801beb:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801bf1:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801bf6:	ba 01 00 00 00       	mov    $0x1,%edx
+  801bfb:	89 d0                	mov    %edx,%eax
+  801bfd:	d3 e0                	shl    %cl,%eax
+  801bff:	85 d8                	test   %ebx,%eax
+  801c01:	74 0d                	je     801c10 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801c03:	83 c1 01             	add    $0x1,%ecx
+  801c06:	83 f9 10             	cmp    $0x10,%ecx
+  801c09:	75 f0                	jne    801bfb <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801c0b:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801c10:	89 c8                	mov    %ecx,%eax
+  801c12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c15:	5b                   	pop    %ebx
+  801c16:	5e                   	pop    %esi
+  801c17:	5f                   	pop    %edi
+  801c18:	5d                   	pop    %ebp
+  801c19:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c1a:	83 ec 0c             	sub    $0xc,%esp
+  801c1d:	6a 01                	push   $0x1
+  801c1f:	e8 d4 1f 00 00       	call   803bf8 <ipc_find_env>
+  801c24:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801c29:	83 c4 10             	add    $0x10,%esp
+  801c2c:	e9 1e ff ff ff       	jmp    801b4f <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801c31:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801c36:	eb d8                	jmp    801c10 <fsring_slot+0x111>
+
+00801c38 <file_read_direct>:
+{
+  801c38:	55                   	push   %ebp
+  801c39:	89 e5                	mov    %esp,%ebp
+  801c3b:	57                   	push   %edi
+  801c3c:	56                   	push   %esi
+  801c3d:	53                   	push   %ebx
+  801c3e:	83 ec 1c             	sub    $0x1c,%esp
+  801c41:	89 c7                	mov    %eax,%edi
+  801c43:	89 d6                	mov    %edx,%esi
+  801c45:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801c47:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801c4d:	77 52                	ja     801ca1 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c4f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c52:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801c57:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c62:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c67:	e8 b6 fb ff ff       	call   801822 <fsipc>
+  801c6c:	89 c7                	mov    %eax,%edi
+  801c6e:	85 c0                	test   %eax,%eax
+  801c70:	78 25                	js     801c97 <file_read_direct+0x5f>
+	assert(r <= n);
+  801c72:	39 c3                	cmp    %eax,%ebx
+  801c74:	0f 82 87 00 00 00    	jb     801d01 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801c7a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c7f:	0f 8f 95 00 00 00    	jg     801d1a <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801c85:	83 ec 04             	sub    $0x4,%esp
+  801c88:	50                   	push   %eax
+  801c89:	68 00 70 80 00       	push   $0x807000
+  801c8e:	56                   	push   %esi
+  801c8f:	e8 52 ed ff ff       	call   8009e6 <memmove>
+	return r;
+  801c94:	83 c4 10             	add    $0x10,%esp
+}
+  801c97:	89 f8                	mov    %edi,%eax
+  801c99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c9c:	5b                   	pop    %ebx
+  801c9d:	5e                   	pop    %esi
+  801c9e:	5f                   	pop    %edi
+  801c9f:	5d                   	pop    %ebp
+  801ca0:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801ca1:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801ca7:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801cac:	29 d1                	sub    %edx,%ecx
+  801cae:	39 d9                	cmp    %ebx,%ecx
+  801cb0:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801cb3:	89 f0                	mov    %esi,%eax
+  801cb5:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801cb8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801cbb:	eb 0f                	jmp    801ccc <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801cbd:	0f b6 10             	movzbl (%eax),%edx
+  801cc0:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801cc2:	05 00 10 00 00       	add    $0x1000,%eax
+  801cc7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ccc:	39 c8                	cmp    %ecx,%eax
+  801cce:	72 ed                	jb     801cbd <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801cd0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801cd3:	8b 47 0c             	mov    0xc(%edi),%eax
+  801cd6:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801cdb:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801ce1:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801ce7:	83 ec 0c             	sub    $0xc,%esp
+  801cea:	6a 07                	push   $0x7
+  801cec:	89 d9                	mov    %ebx,%ecx
+  801cee:	89 f2                	mov    %esi,%edx
+  801cf0:	b8 09 00 00 00       	mov    $0x9,%eax
+  801cf5:	e8 86 f9 ff ff       	call   801680 <fsipc_pages>
+  801cfa:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801cfc:	83 c4 10             	add    $0x10,%esp
+  801cff:	eb 96                	jmp    801c97 <file_read_direct+0x5f>
+	assert(r <= n);
+  801d01:	68 80 44 80 00       	push   $0x804480
+  801d06:	68 60 44 80 00       	push   $0x804460
+  801d0b:	68 dc 00 00 00       	push   $0xdc
+  801d10:	68 75 44 80 00       	push   $0x804475
+  801d15:	e8 7d e4 ff ff       	call   800197 <_panic>
+	assert(r <= PGSIZE);
+  801d1a:	68 91 44 80 00       	push   $0x804491
+  801d1f:	68 60 44 80 00       	push   $0x804460
+  801d24:	68 dd 00 00 00       	push   $0xdd
+  801d29:	68 75 44 80 00       	push   $0x804475
+  801d2e:	e8 64 e4 ff ff       	call   800197 <_panic>
+
+00801d33 <devfile_read>:
+{
+  801d33:	55                   	push   %ebp
+  801d34:	89 e5                	mov    %esp,%ebp
+  801d36:	57                   	push   %edi
+  801d37:	56                   	push   %esi
+  801d38:	53                   	push   %ebx
+  801d39:	83 ec 28             	sub    $0x28,%esp
+  801d3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d3f:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801d42:	53                   	push   %ebx
+  801d43:	e8 35 f3 ff ff       	call   80107d <fd2data>
+  801d48:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801d4b:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801d4e:	83 c4 10             	add    $0x10,%esp
+  801d51:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801d55:	74 7d                	je     801dd4 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801d57:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801d5b:	0f 85 81 00 00 00    	jne    801de2 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801d61:	8b 43 18             	mov    0x18(%ebx),%eax
+  801d64:	85 c0                	test   %eax,%eax
+  801d66:	74 0d                	je     801d75 <devfile_read+0x42>
+  801d68:	8b 53 14             	mov    0x14(%ebx),%edx
+  801d6b:	39 fa                	cmp    %edi,%edx
+  801d6d:	7f 06                	jg     801d75 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801d6f:	01 c2                	add    %eax,%edx
+  801d71:	39 d7                	cmp    %edx,%edi
+  801d73:	72 28                	jb     801d9d <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801d75:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801d7c:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d82:	77 74                	ja     801df8 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801d84:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d89:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d8c:	89 d8                	mov    %ebx,%eax
+  801d8e:	e8 a5 fe ff ff       	call   801c38 <file_read_direct>
+  801d93:	85 c0                	test   %eax,%eax
+  801d95:	7e 35                	jle    801dcc <devfile_read+0x99>
+		ff->buf_base = pos;
+  801d97:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801d9a:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801d9d:	8b 53 14             	mov    0x14(%ebx),%edx
+  801da0:	89 d0                	mov    %edx,%eax
+  801da2:	03 43 18             	add    0x18(%ebx),%eax
+  801da5:	29 f8                	sub    %edi,%eax
+  801da7:	39 f0                	cmp    %esi,%eax
+  801da9:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801dac:	83 ec 04             	sub    $0x4,%esp
+  801daf:	56                   	push   %esi
+  801db0:	89 f8                	mov    %edi,%eax
+  801db2:	29 d0                	sub    %edx,%eax
+  801db4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801db7:	01 c1                	add    %eax,%ecx
+  801db9:	51                   	push   %ecx
+  801dba:	ff 75 0c             	push   0xc(%ebp)
+  801dbd:	e8 24 ec ff ff       	call   8009e6 <memmove>
+	fd->fd_offset = pos + n;
+  801dc2:	01 f7                	add    %esi,%edi
+  801dc4:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801dc7:	89 f0                	mov    %esi,%eax
+  801dc9:	83 c4 10             	add    $0x10,%esp
+}
+  801dcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dcf:	5b                   	pop    %ebx
+  801dd0:	5e                   	pop    %esi
+  801dd1:	5f                   	pop    %edi
+  801dd2:	5d                   	pop    %ebp
+  801dd3:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801dd4:	89 f1                	mov    %esi,%ecx
+  801dd6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dd9:	89 d8                	mov    %ebx,%eax
+  801ddb:	e8 58 fe ff ff       	call   801c38 <file_read_direct>
+  801de0:	eb ea                	jmp    801dcc <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801de2:	83 ec 0c             	sub    $0xc,%esp
+  801de5:	53                   	push   %ebx
+  801de6:	e8 db fa ff ff       	call   8018c6 <devfile_sync>
+  801deb:	83 c4 10             	add    $0x10,%esp
+  801dee:	85 c0                	test   %eax,%eax
+  801df0:	0f 89 6b ff ff ff    	jns    801d61 <devfile_read+0x2e>
+  801df6:	eb d4                	jmp    801dcc <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801df8:	89 f1                	mov    %esi,%ecx
+  801dfa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dfd:	89 d8                	mov    %ebx,%eax
+  801dff:	e8 34 fe ff ff       	call   801c38 <file_read_direct>
+  801e04:	eb c6                	jmp    801dcc <devfile_read+0x99>
+
+00801e06 <open>:
+{
+  801e06:	55                   	push   %ebp
+  801e07:	89 e5                	mov    %esp,%ebp
+  801e09:	56                   	push   %esi
+  801e0a:	53                   	push   %ebx
+  801e0b:	83 ec 1c             	sub    $0x1c,%esp
+  801e0e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801e11:	56                   	push   %esi
+  801e12:	e8 0e ea ff ff       	call   800825 <strlen>
+  801e17:	83 c4 10             	add    $0x10,%esp
+  801e1a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e1f:	0f 8f a0 00 00 00    	jg     801ec5 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801e25:	83 ec 0c             	sub    $0xc,%esp
+  801e28:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e2b:	50                   	push   %eax
+  801e2c:	e8 63 f2 ff ff       	call   801094 <fd_alloc>
+  801e31:	89 c3                	mov    %eax,%ebx
+  801e33:	83 c4 10             	add    $0x10,%esp
+  801e36:	85 c0                	test   %eax,%eax
+  801e38:	78 45                	js     801e7f <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801e3a:	83 ec 08             	sub    $0x8,%esp
+  801e3d:	56                   	push   %esi
+  801e3e:	68 00 70 80 00       	push   $0x807000
+  801e43:	e8 18 ea ff ff       	call   800860 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801e48:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e4b:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801e50:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e53:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e58:	e8 c5 f9 ff ff       	call   801822 <fsipc>
+  801e5d:	89 c3                	mov    %eax,%ebx
+  801e5f:	83 c4 10             	add    $0x10,%esp
+  801e62:	85 c0                	test   %eax,%eax
+  801e64:	78 22                	js     801e88 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801e66:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801e6d:	74 2b                	je     801e9a <open+0x94>
+	return fd2num(fd);
+  801e6f:	83 ec 0c             	sub    $0xc,%esp
+  801e72:	ff 75 f4             	push   -0xc(%ebp)
+  801e75:	e8 f3 f1 ff ff       	call   80106d <fd2num>
+  801e7a:	89 c3                	mov    %eax,%ebx
+  801e7c:	83 c4 10             	add    $0x10,%esp
+}
+  801e7f:	89 d8                	mov    %ebx,%eax
+  801e81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e84:	5b                   	pop    %ebx
+  801e85:	5e                   	pop    %esi
+  801e86:	5d                   	pop    %ebp
+  801e87:	c3                   	ret
+		fd_close(fd, 0);
+  801e88:	83 ec 08             	sub    $0x8,%esp
+  801e8b:	6a 00                	push   $0x0
+  801e8d:	ff 75 f4             	push   -0xc(%ebp)
+  801e90:	e8 f8 f2 ff ff       	call   80118d <fd_close>
+		return r;
+  801e95:	83 c4 10             	add    $0x10,%esp
+  801e98:	eb e5                	jmp    801e7f <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801e9a:	83 ec 0c             	sub    $0xc,%esp
+  801e9d:	ff 75 f4             	push   -0xc(%ebp)
+  801ea0:	e8 d8 f1 ff ff       	call   80107d <fd2data>
+  801ea5:	83 c4 0c             	add    $0xc,%esp
+  801ea8:	68 07 04 00 00       	push   $0x407
+  801ead:	50                   	push   %eax
+  801eae:	6a 00                	push   $0x0
+  801eb0:	e8 b7 ed ff ff       	call   800c6c <sys_page_alloc>
+  801eb5:	83 c4 10             	add    $0x10,%esp
+  801eb8:	85 c0                	test   %eax,%eax
+  801eba:	75 b3                	jne    801e6f <open+0x69>
+		fd->fd_file.buffered = 1;
+  801ebc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ebf:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801ec3:	eb aa                	jmp    801e6f <open+0x69>
+		return -E_BAD_PATH;
+  801ec5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801eca:	eb b3                	jmp    801e7f <open+0x79>
+
+00801ecc <readdir>:
+{
+  801ecc:	55                   	push   %ebp
+  801ecd:	89 e5                	mov    %esp,%ebp
+  801ecf:	53                   	push   %ebx
+  801ed0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ed3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ed6:	50                   	push   %eax
+  801ed7:	ff 75 08             	push   0x8(%ebp)
+  801eda:	e8 0b f2 ff ff       	call   8010ea <fd_lookup>
+  801edf:	89 c3                	mov    %eax,%ebx
+  801ee1:	83 c4 10             	add    $0x10,%esp
+  801ee4:	85 c0                	test   %eax,%eax
+  801ee6:	78 73                	js     801f5b <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801ee8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eeb:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  801ef1:	39 08                	cmp    %ecx,(%eax)
+  801ef3:	0f 85 82 00 00 00    	jne    801f7b <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801ef9:	83 ec 0c             	sub    $0xc,%esp
+  801efc:	50                   	push   %eax
+  801efd:	e8 c4 f9 ff ff       	call   8018c6 <devfile_sync>
+  801f02:	89 c3                	mov    %eax,%ebx
+  801f04:	83 c4 10             	add    $0x10,%esp
+  801f07:	85 c0                	test   %eax,%eax
+  801f09:	78 50                	js     801f5b <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801f0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f0e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f11:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  801f16:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f19:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  801f1e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f21:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801f26:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f2b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f30:	e8 ed f8 ff ff       	call   801822 <fsipc>
+  801f35:	89 c3                	mov    %eax,%ebx
+  801f37:	85 c0                	test   %eax,%eax
+  801f39:	7e 20                	jle    801f5b <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801f3b:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801f3e:	72 22                	jb     801f62 <readdir+0x96>
+  801f40:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f45:	7f 1b                	jg     801f62 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f47:	83 ec 04             	sub    $0x4,%esp
+  801f4a:	50                   	push   %eax
+  801f4b:	68 00 70 80 00       	push   $0x807000
+  801f50:	ff 75 0c             	push   0xc(%ebp)
+  801f53:	e8 8e ea ff ff       	call   8009e6 <memmove>
+	return r;
+  801f58:	83 c4 10             	add    $0x10,%esp
+}
+  801f5b:	89 d8                	mov    %ebx,%eax
+  801f5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f60:	c9                   	leave
+  801f61:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801f62:	68 87 44 80 00       	push   $0x804487
+  801f67:	68 60 44 80 00       	push   $0x804460
+  801f6c:	68 86 01 00 00       	push   $0x186
+  801f71:	68 75 44 80 00       	push   $0x804475
+  801f76:	e8 1c e2 ff ff       	call   800197 <_panic>
+		return -E_NOT_SUPP;
+  801f7b:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801f80:	eb d9                	jmp    801f5b <readdir+0x8f>
+
+00801f82 <munmap>:
+{
+  801f82:	55                   	push   %ebp
+  801f83:	89 e5                	mov    %esp,%ebp
+  801f85:	56                   	push   %esi
+  801f86:	53                   	push   %ebx
+  801f87:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f8a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801f8d:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801f93:	75 41                	jne    801fd6 <munmap+0x54>
+  801f95:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801f9b:	77 39                	ja     801fd6 <munmap+0x54>
+  801f9d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801fa2:	29 f0                	sub    %esi,%eax
+  801fa4:	39 d0                	cmp    %edx,%eax
+  801fa6:	72 35                	jb     801fdd <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801fa8:	89 f3                	mov    %esi,%ebx
+  801faa:	01 d6                	add    %edx,%esi
+  801fac:	39 f3                	cmp    %esi,%ebx
+  801fae:	73 1a                	jae    801fca <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801fb0:	83 ec 08             	sub    $0x8,%esp
+  801fb3:	53                   	push   %ebx
+  801fb4:	6a 00                	push   $0x0
+  801fb6:	e8 3e ed ff ff       	call   800cf9 <sys_page_unmap>
+  801fbb:	83 c4 10             	add    $0x10,%esp
+  801fbe:	85 c0                	test   %eax,%eax
+  801fc0:	78 0d                	js     801fcf <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801fc2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801fc8:	eb e2                	jmp    801fac <munmap+0x2a>
+	return 0;
+  801fca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fcf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd2:	5b                   	pop    %ebx
+  801fd3:	5e                   	pop    %esi
+  801fd4:	5d                   	pop    %ebp
+  801fd5:	c3                   	ret
+		return -E_INVAL;
+  801fd6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fdb:	eb f2                	jmp    801fcf <munmap+0x4d>
+  801fdd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fe2:	eb eb                	jmp    801fcf <munmap+0x4d>
+
+00801fe4 <mmap>:
+{
+  801fe4:	55                   	push   %ebp
+  801fe5:	89 e5                	mov    %esp,%ebp
+  801fe7:	57                   	push   %edi
+  801fe8:	56                   	push   %esi
+  801fe9:	53                   	push   %ebx
+  801fea:	83 ec 34             	sub    $0x34,%esp
+  801fed:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ff0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ff3:	50                   	push   %eax
+  801ff4:	ff 75 18             	push   0x18(%ebp)
+  801ff7:	e8 ee f0 ff ff       	call   8010ea <fd_lookup>
+  801ffc:	89 c3                	mov    %eax,%ebx
+  801ffe:	83 c4 10             	add    $0x10,%esp
+  802001:	85 c0                	test   %eax,%eax
+  802003:	0f 88 0e 01 00 00    	js     802117 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802009:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80200c:	a1 20 50 80 00       	mov    0x805020,%eax
+  802011:	39 02                	cmp    %eax,(%edx)
+  802013:	0f 85 50 01 00 00    	jne    802169 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802019:	8b 45 10             	mov    0x10(%ebp),%eax
+  80201c:	83 e0 02             	and    $0x2,%eax
+  80201f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802022:	74 0a                	je     80202e <mmap+0x4a>
+  802024:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802028:	0f 84 42 01 00 00    	je     802170 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  80202e:	8b 42 08             	mov    0x8(%edx),%eax
+  802031:	83 e0 03             	and    $0x3,%eax
+  802034:	83 f8 01             	cmp    $0x1,%eax
+  802037:	0f 84 3a 01 00 00    	je     802177 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  80203d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802040:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802043:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802048:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80204b:	0f 85 2d 01 00 00    	jne    80217e <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802051:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802055:	0f 88 2a 01 00 00    	js     802185 <mmap+0x1a1>
+  80205b:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  802062:	0f 87 1d 01 00 00    	ja     802185 <mmap+0x1a1>
+  802068:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80206d:	2b 45 08             	sub    0x8(%ebp),%eax
+  802070:	39 f8                	cmp    %edi,%eax
+  802072:	0f 82 14 01 00 00    	jb     80218c <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802078:	83 ec 0c             	sub    $0xc,%esp
+  80207b:	52                   	push   %edx
+  80207c:	e8 45 f8 ff ff       	call   8018c6 <devfile_sync>
+  802081:	89 c3                	mov    %eax,%ebx
+  802083:	83 c4 10             	add    $0x10,%esp
+  802086:	85 c0                	test   %eax,%eax
+  802088:	0f 88 89 00 00 00    	js     802117 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  80208e:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802094:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80209a:	be 00 00 00 00       	mov    $0x0,%esi
+  80209f:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8020a2:	39 fe                	cmp    %edi,%esi
+  8020a4:	73 7b                	jae    802121 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8020a6:	89 f8                	mov    %edi,%eax
+  8020a8:	29 f0                	sub    %esi,%eax
+  8020aa:	c1 e8 0c             	shr    $0xc,%eax
+  8020ad:	ba 40 00 00 00       	mov    $0x40,%edx
+  8020b2:	39 d0                	cmp    %edx,%eax
+  8020b4:	0f 47 c2             	cmova  %edx,%eax
+  8020b7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8020ba:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8020bd:	8b 52 0c             	mov    0xc(%edx),%edx
+  8020c0:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  8020c6:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8020c9:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  8020cf:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8020d4:	89 f2                	mov    %esi,%edx
+  8020d6:	03 55 08             	add    0x8(%ebp),%edx
+  8020d9:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8020dc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8020e1:	e8 ea f6 ff ff       	call   8017d0 <fsipcv>
+  8020e6:	85 c0                	test   %eax,%eax
+  8020e8:	7e 12                	jle    8020fc <mmap+0x118>
+  8020ea:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8020ed:	85 c0                	test   %eax,%eax
+  8020ef:	0f 84 9e 00 00 00    	je     802193 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8020f5:	c1 e0 0c             	shl    $0xc,%eax
+  8020f8:	01 c6                	add    %eax,%esi
+  8020fa:	eb a6                	jmp    8020a2 <mmap+0xbe>
+			munmap(addr, done);
+  8020fc:	89 c3                	mov    %eax,%ebx
+  8020fe:	83 ec 08             	sub    $0x8,%esp
+  802101:	56                   	push   %esi
+  802102:	ff 75 08             	push   0x8(%ebp)
+  802105:	e8 78 fe ff ff       	call   801f82 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80210a:	83 c4 10             	add    $0x10,%esp
+  80210d:	85 db                	test   %ebx,%ebx
+  80210f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802114:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802117:	89 d8                	mov    %ebx,%eax
+  802119:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80211c:	5b                   	pop    %ebx
+  80211d:	5e                   	pop    %esi
+  80211e:	5f                   	pop    %edi
+  80211f:	5d                   	pop    %ebp
+  802120:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802121:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802124:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802126:	85 c0                	test   %eax,%eax
+  802128:	74 ed                	je     802117 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80212a:	be 00 00 00 00       	mov    $0x0,%esi
+  80212f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802132:	39 fe                	cmp    %edi,%esi
+  802134:	73 2e                	jae    802164 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802136:	83 ec 0c             	sub    $0xc,%esp
+  802139:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  80213c:	50                   	push   %eax
+  80213d:	e8 14 17 00 00       	call   803856 <cowpage>
+  802142:	83 c4 10             	add    $0x10,%esp
+  802145:	85 c0                	test   %eax,%eax
+  802147:	78 08                	js     802151 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802149:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80214f:	eb e1                	jmp    802132 <mmap+0x14e>
+				munmap(addr, len);
+  802151:	89 c3                	mov    %eax,%ebx
+  802153:	83 ec 08             	sub    $0x8,%esp
+  802156:	57                   	push   %edi
+  802157:	ff 75 08             	push   0x8(%ebp)
+  80215a:	e8 23 fe ff ff       	call   801f82 <munmap>
+				return r;
+  80215f:	83 c4 10             	add    $0x10,%esp
+  802162:	eb b3                	jmp    802117 <mmap+0x133>
+	return 0;
+  802164:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802167:	eb ae                	jmp    802117 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802169:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80216e:	eb a7                	jmp    802117 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802170:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802175:	eb a0                	jmp    802117 <mmap+0x133>
+		return -E_INVAL;
+  802177:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80217c:	eb 99                	jmp    802117 <mmap+0x133>
+  80217e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802183:	eb 92                	jmp    802117 <mmap+0x133>
+  802185:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80218a:	eb 8b                	jmp    802117 <mmap+0x133>
+  80218c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802191:	eb 84                	jmp    802117 <mmap+0x133>
+			munmap(addr, done);
+  802193:	83 ec 08             	sub    $0x8,%esp
+  802196:	56                   	push   %esi
+  802197:	ff 75 08             	push   0x8(%ebp)
+  80219a:	e8 e3 fd ff ff       	call   801f82 <munmap>
+  80219f:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8021a2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021a7:	e9 6b ff ff ff       	jmp    802117 <mmap+0x133>
+
+008021ac <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8021ac:	55                   	push   %ebp
+  8021ad:	89 e5                	mov    %esp,%ebp
+  8021af:	56                   	push   %esi
+  8021b0:	53                   	push   %ebx
+  8021b1:	83 ec 10             	sub    $0x10,%esp
+  8021b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8021b7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021bd:	e8 3d f9 ff ff       	call   801aff <fsring_slot>
+  8021c2:	85 c0                	test   %eax,%eax
+  8021c4:	78 60                	js     802226 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8021c6:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8021c9:	8b 56 08             	mov    0x8(%esi),%edx
+  8021cc:	83 e2 03             	and    $0x3,%edx
+  8021cf:	83 fa 01             	cmp    $0x1,%edx
+  8021d2:	74 59                	je     80222d <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8021d4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8021d9:	89 c1                	mov    %eax,%ecx
+  8021db:	d3 e2                	shl    %cl,%edx
+  8021dd:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8021e3:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8021e6:	c1 e2 02             	shl    $0x2,%edx
+  8021e9:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  8021ef:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  8021f6:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8021f9:	8b 55 18             	mov    0x18(%ebp),%edx
+  8021fc:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8021ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802202:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802205:	83 ec 08             	sub    $0x8,%esp
+  802208:	50                   	push   %eax
+  802209:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80220e:	39 c3                	cmp    %eax,%ebx
+  802210:	0f 47 d8             	cmova  %eax,%ebx
+  802213:	53                   	push   %ebx
+  802214:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802217:	89 f2                	mov    %esi,%edx
+  802219:	b8 03 00 00 00       	mov    $0x3,%eax
+  80221e:	e8 1e f5 ff ff       	call   801741 <fsring_post>
+  802223:	83 c4 10             	add    $0x10,%esp
+}
+  802226:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802229:	5b                   	pop    %ebx
+  80222a:	5e                   	pop    %esi
+  80222b:	5d                   	pop    %ebp
+  80222c:	c3                   	ret
+		return -E_INVAL;
+  80222d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802232:	eb f2                	jmp    802226 <fsring_read+0x7a>
+
+00802234 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802234:	55                   	push   %ebp
+  802235:	89 e5                	mov    %esp,%ebp
+  802237:	56                   	push   %esi
+  802238:	53                   	push   %ebx
+  802239:	83 ec 10             	sub    $0x10,%esp
+  80223c:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80223f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802242:	8b 45 08             	mov    0x8(%ebp),%eax
+  802245:	e8 b5 f8 ff ff       	call   801aff <fsring_slot>
+  80224a:	89 c3                	mov    %eax,%ebx
+  80224c:	85 c0                	test   %eax,%eax
+  80224e:	78 77                	js     8022c7 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802250:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802253:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802257:	74 77                	je     8022d0 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802259:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80225e:	39 c6                	cmp    %eax,%esi
+  802260:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802263:	83 ec 04             	sub    $0x4,%esp
+  802266:	56                   	push   %esi
+  802267:	ff 75 0c             	push   0xc(%ebp)
+  80226a:	89 d8                	mov    %ebx,%eax
+  80226c:	c1 e0 0c             	shl    $0xc,%eax
+  80226f:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802275:	50                   	push   %eax
+  802276:	e8 6b e7 ff ff       	call   8009e6 <memmove>
+	fsring_busy |= 1 << slot;
+  80227b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802280:	89 d9                	mov    %ebx,%ecx
+  802282:	d3 e0                	shl    %cl,%eax
+  802284:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  80228a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80228d:	c1 e0 02             	shl    $0x2,%eax
+  802290:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  802296:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  80229d:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8022a0:	8b 45 18             	mov    0x18(%ebp),%eax
+  8022a3:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8022a6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8022ad:	83 c4 08             	add    $0x8,%esp
+  8022b0:	53                   	push   %ebx
+  8022b1:	56                   	push   %esi
+  8022b2:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8022b5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022b8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022bd:	e8 7f f4 ff ff       	call   801741 <fsring_post>
+  8022c2:	89 c3                	mov    %eax,%ebx
+  8022c4:	83 c4 10             	add    $0x10,%esp
+}
+  8022c7:	89 d8                	mov    %ebx,%eax
+  8022c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022cc:	5b                   	pop    %ebx
+  8022cd:	5e                   	pop    %esi
+  8022ce:	5d                   	pop    %ebp
+  8022cf:	c3                   	ret
+		return -E_INVAL;
+  8022d0:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8022d5:	eb f0                	jmp    8022c7 <fsring_write+0x93>
+
+008022d7 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8022d7:	55                   	push   %ebp
+  8022d8:	89 e5                	mov    %esp,%ebp
+  8022da:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8022dd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8022e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022e3:	e8 17 f8 ff ff       	call   801aff <fsring_slot>
+  8022e8:	85 c0                	test   %eax,%eax
+  8022ea:	78 4c                	js     802338 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8022ec:	ba 01 00 00 00       	mov    $0x1,%edx
+  8022f1:	89 c1                	mov    %eax,%ecx
+  8022f3:	d3 e2                	shl    %cl,%edx
+  8022f5:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8022fb:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8022fe:	c1 e2 02             	shl    $0x2,%edx
+  802301:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  802307:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  80230e:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802311:	8b 55 10             	mov    0x10(%ebp),%edx
+  802314:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802317:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80231a:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80231d:	83 ec 08             	sub    $0x8,%esp
+  802320:	50                   	push   %eax
+  802321:	6a 00                	push   $0x0
+  802323:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802328:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80232b:	b8 05 00 00 00       	mov    $0x5,%eax
+  802330:	e8 0c f4 ff ff       	call   801741 <fsring_post>
+  802335:	83 c4 10             	add    $0x10,%esp
+}
+  802338:	c9                   	leave
+  802339:	c3                   	ret
+
+0080233a <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  80233a:	55                   	push   %ebp
+  80233b:	89 e5                	mov    %esp,%ebp
+  80233d:	57                   	push   %edi
+  80233e:	56                   	push   %esi
+  80233f:	53                   	push   %ebx
+  802340:	83 ec 1c             	sub    $0x1c,%esp
+  802343:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802347:	a1 00 60 80 00       	mov    0x806000,%eax
+  80234c:	8b 40 48             	mov    0x48(%eax),%eax
+  80234f:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  802355:	74 12                	je     802369 <fsring_reap+0x2f>
+		return 0;
+  802357:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  80235c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80235f:	5b                   	pop    %ebx
+  802360:	5e                   	pop    %esi
+  802361:	5f                   	pop    %edi
+  802362:	5d                   	pop    %ebp
+  802363:	c3                   	ret
+		sys_yield();
+  802364:	e8 e4 e8 ff ff       	call   800c4d <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802369:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  80236f:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802374:	39 c2                	cmp    %eax,%edx
+  802376:	75 18                	jne    802390 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802378:	84 db                	test   %bl,%bl
+  80237a:	0f 84 21 01 00 00    	je     8024a1 <fsring_reap+0x167>
+  802380:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  802387:	75 db                	jne    802364 <fsring_reap+0x2a>
+			return 0;
+  802389:	b8 00 00 00 00       	mov    $0x0,%eax
+  80238e:	eb cc                	jmp    80235c <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802390:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802395:	83 e0 0f             	and    $0xf,%eax
+  802398:	83 c0 2a             	add    $0x2a,%eax
+  80239b:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8023a2:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8023a9:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8023ae:	83 c0 01             	add    $0x1,%eax
+  8023b1:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8023b6:	83 fb 0f             	cmp    $0xf,%ebx
+  8023b9:	77 5b                	ja     802416 <fsring_reap+0xdc>
+  8023bb:	be 01 00 00 00       	mov    $0x1,%esi
+  8023c0:	89 d9                	mov    %ebx,%ecx
+  8023c2:	d3 e6                	shl    %cl,%esi
+  8023c4:	89 f0                	mov    %esi,%eax
+  8023c6:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  8023cc:	74 48                	je     802416 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8023ce:	89 d8                	mov    %ebx,%eax
+  8023d0:	c1 e0 0c             	shl    $0xc,%eax
+  8023d3:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8023d9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8023dc:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8023df:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  8023e6:	83 f8 03             	cmp    $0x3,%eax
+  8023e9:	74 40                	je     80242b <fsring_reap+0xf1>
+  8023eb:	83 f8 05             	cmp    $0x5,%eax
+  8023ee:	74 64                	je     802454 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8023f0:	f7 d6                	not    %esi
+  8023f2:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8023f8:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8023fb:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  802402:	8b 45 08             	mov    0x8(%ebp),%eax
+  802405:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802407:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80240a:	89 38                	mov    %edi,(%eax)
+	return 1;
+  80240c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802411:	e9 46 ff ff ff       	jmp    80235c <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802416:	53                   	push   %ebx
+  802417:	68 9d 44 80 00       	push   $0x80449d
+  80241c:	68 8f 02 00 00       	push   $0x28f
+  802421:	68 75 44 80 00       	push   $0x804475
+  802426:	e8 6c dd ff ff       	call   800197 <_panic>
+		if (cqe.cqe_result > 0)
+  80242b:	85 ff                	test   %edi,%edi
+  80242d:	7e c1                	jle    8023f0 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80242f:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802432:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802437:	39 c7                	cmp    %eax,%edi
+  802439:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80243c:	50                   	push   %eax
+  80243d:	ff 75 e4             	push   -0x1c(%ebp)
+  802440:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802443:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  80244a:	e8 97 e5 ff ff       	call   8009e6 <memmove>
+  80244f:	83 c4 10             	add    $0x10,%esp
+  802452:	eb 9c                	jmp    8023f0 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802454:	85 ff                	test   %edi,%edi
+  802456:	75 98                	jne    8023f0 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802458:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80245b:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802462:	83 ec 08             	sub    $0x8,%esp
+  802465:	ff 75 e4             	push   -0x1c(%ebp)
+  802468:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80246b:	51                   	push   %ecx
+  80246c:	e8 ef e3 ff ff       	call   800860 <strcpy>
+			st->st_size = ret->ret_size;
+  802471:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802474:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  80247a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80247d:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802483:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802489:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  80248f:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  802496:	50 80 00 
+  802499:	83 c4 10             	add    $0x10,%esp
+  80249c:	e9 4f ff ff ff       	jmp    8023f0 <fsring_reap+0xb6>
+			return 0;
+  8024a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a6:	e9 b1 fe ff ff       	jmp    80235c <fsring_reap+0x22>
+
+008024ab <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8024ab:	55                   	push   %ebp
+  8024ac:	89 e5                	mov    %esp,%ebp
+  8024ae:	57                   	push   %edi
+  8024af:	56                   	push   %esi
+  8024b0:	53                   	push   %ebx
+  8024b1:	83 ec 28             	sub    $0x28,%esp
+  8024b4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8024b7:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8024ba:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8024bd:	53                   	push   %ebx
+  8024be:	e8 62 e3 ff ff       	call   800825 <strlen>
+  8024c3:	83 c4 10             	add    $0x10,%esp
+  8024c6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024cb:	0f 8f 02 01 00 00    	jg     8025d3 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8024d1:	83 ec 08             	sub    $0x8,%esp
+  8024d4:	53                   	push   %ebx
+  8024d5:	68 00 70 80 00       	push   $0x807000
+  8024da:	e8 81 e3 ff ff       	call   800860 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8024df:	83 c4 10             	add    $0x10,%esp
+  8024e2:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8024e8:	76 69                	jbe    802553 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8024ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024ed:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8024f3:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8024f8:	29 d1                	sub    %edx,%ecx
+  8024fa:	39 f9                	cmp    %edi,%ecx
+  8024fc:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8024ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802502:	89 f9                	mov    %edi,%ecx
+  802504:	01 c1                	add    %eax,%ecx
+  802506:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802509:	eb 0f                	jmp    80251a <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  80250b:	0f b6 10             	movzbl (%eax),%edx
+  80250e:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802510:	05 00 10 00 00       	add    $0x1000,%eax
+  802515:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80251a:	39 c8                	cmp    %ecx,%eax
+  80251c:	72 ed                	jb     80250b <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  80251e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802521:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802527:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  80252d:	83 ec 0c             	sub    $0xc,%esp
+  802530:	6a 07                	push   $0x7
+  802532:	89 f9                	mov    %edi,%ecx
+  802534:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802537:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80253c:	e8 3f f1 ff ff       	call   801680 <fsipc_pages>
+  802541:	89 c7                	mov    %eax,%edi
+  802543:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802546:	85 f6                	test   %esi,%esi
+  802548:	74 7f                	je     8025c9 <file_slurp+0x11e>
+  80254a:	8d 43 01             	lea    0x1(%ebx),%eax
+  80254d:	85 ff                	test   %edi,%edi
+  80254f:	79 3c                	jns    80258d <file_slurp+0xe2>
+  802551:	eb 76                	jmp    8025c9 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802553:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802559:	ba 00 00 00 00       	mov    $0x0,%edx
+  80255e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802563:	e8 ba f2 ff ff       	call   801822 <fsipc>
+  802568:	89 c7                	mov    %eax,%edi
+  80256a:	85 c0                	test   %eax,%eax
+  80256c:	7e d8                	jle    802546 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  80256e:	83 ec 04             	sub    $0x4,%esp
+  802571:	50                   	push   %eax
+  802572:	68 08 70 80 00       	push   $0x807008
+  802577:	ff 75 0c             	push   0xc(%ebp)
+  80257a:	e8 67 e4 ff ff       	call   8009e6 <memmove>
+  80257f:	83 c4 10             	add    $0x10,%esp
+  802582:	eb c2                	jmp    802546 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802584:	80 fa 2f             	cmp    $0x2f,%dl
+  802587:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  80258a:	83 c0 01             	add    $0x1,%eax
+  80258d:	89 c1                	mov    %eax,%ecx
+  80258f:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802593:	84 d2                	test   %dl,%dl
+  802595:	75 ed                	jne    802584 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802597:	83 ec 04             	sub    $0x4,%esp
+  80259a:	68 80 00 00 00       	push   $0x80
+  80259f:	53                   	push   %ebx
+  8025a0:	56                   	push   %esi
+  8025a1:	e8 30 e3 ff ff       	call   8008d6 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8025a6:	a1 00 70 80 00       	mov    0x807000,%eax
+  8025ab:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8025b1:	a1 04 70 80 00       	mov    0x807004,%eax
+  8025b6:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8025bc:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  8025c3:	50 80 00 
+  8025c6:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8025c9:	89 f8                	mov    %edi,%eax
+  8025cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025ce:	5b                   	pop    %ebx
+  8025cf:	5e                   	pop    %esi
+  8025d0:	5f                   	pop    %edi
+  8025d1:	5d                   	pop    %ebp
+  8025d2:	c3                   	ret
+		return -E_BAD_PATH;
+  8025d3:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8025d8:	eb ef                	jmp    8025c9 <file_slurp+0x11e>
+
+008025da <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8025da:	55                   	push   %ebp
+  8025db:	89 e5                	mov    %esp,%ebp
+  8025dd:	53                   	push   %ebx
+  8025de:	83 ec 10             	sub    $0x10,%esp
+  8025e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8025e4:	53                   	push   %ebx
+  8025e5:	e8 3b e2 ff ff       	call   800825 <strlen>
+  8025ea:	83 c4 10             	add    $0x10,%esp
+  8025ed:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025f2:	7f 25                	jg     802619 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8025f4:	83 ec 08             	sub    $0x8,%esp
+  8025f7:	53                   	push   %ebx
+  8025f8:	68 00 70 80 00       	push   $0x807000
+  8025fd:	e8 5e e2 ff ff       	call   800860 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802602:	ba 00 00 00 00       	mov    $0x0,%edx
+  802607:	b8 07 00 00 00       	mov    $0x7,%eax
+  80260c:	e8 11 f2 ff ff       	call   801822 <fsipc>
+  802611:	83 c4 10             	add    $0x10,%esp
+}
+  802614:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802617:	c9                   	leave
+  802618:	c3                   	ret
+		return -E_BAD_PATH;
+  802619:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80261e:	eb f4                	jmp    802614 <remove+0x3a>
+
+00802620 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802620:	55                   	push   %ebp
+  802621:	89 e5                	mov    %esp,%ebp
+  802623:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802626:	ba 00 00 00 00       	mov    $0x0,%edx
+  80262b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802630:	e8 ed f1 ff ff       	call   801822 <fsipc>
+}
+  802635:	c9                   	leave
+  802636:	c3                   	ret
+
+00802637 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802637:	55                   	push   %ebp
+  802638:	89 e5                	mov    %esp,%ebp
+  80263a:	57                   	push   %edi
+  80263b:	56                   	push   %esi
+  80263c:	53                   	push   %ebx
+  80263d:	83 ec 18             	sub    $0x18,%esp
+  802640:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802643:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802646:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802649:	57                   	push   %edi
+  80264a:	e8 d6 e1 ff ff       	call   800825 <strlen>
+  80264f:	83 c4 10             	add    $0x10,%esp
+  802652:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802657:	7f 4c                	jg     8026a5 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802659:	83 ec 08             	sub    $0x8,%esp
+  80265c:	57                   	push   %edi
+  80265d:	68 00 70 80 00       	push   $0x807000
+  802662:	e8 f9 e1 ff ff       	call   800860 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802667:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266c:	b8 10 00 00 00       	mov    $0x10,%eax
+  802671:	e8 ac f1 ff ff       	call   801822 <fsipc>
+  802676:	83 c4 10             	add    $0x10,%esp
+  802679:	85 c0                	test   %eax,%eax
+  80267b:	78 20                	js     80269d <defrag+0x66>
+		return r;
+	if (before)
+  80267d:	85 f6                	test   %esi,%esi
+  80267f:	74 07                	je     802688 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802681:	a1 00 70 80 00       	mov    0x807000,%eax
+  802686:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802688:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  80268d:	85 db                	test   %ebx,%ebx
+  80268f:	74 0c                	je     80269d <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802691:	a1 04 70 80 00       	mov    0x807004,%eax
+  802696:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802698:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80269d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026a0:	5b                   	pop    %ebx
+  8026a1:	5e                   	pop    %esi
+  8026a2:	5f                   	pop    %edi
+  8026a3:	5d                   	pop    %ebp
+  8026a4:	c3                   	ret
+		return -E_BAD_PATH;
+  8026a5:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8026aa:	eb f1                	jmp    80269d <defrag+0x66>
+
+008026ac <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  8026ac:	55                   	push   %ebp
+  8026ad:	89 e5                	mov    %esp,%ebp
+  8026af:	53                   	push   %ebx
+  8026b0:	83 ec 04             	sub    $0x4,%esp
+  8026b3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  8026b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026bb:	b8 11 00 00 00       	mov    $0x11,%eax
+  8026c0:	e8 5d f1 ff ff       	call   801822 <fsipc>
+  8026c5:	85 c0                	test   %eax,%eax
+  8026c7:	78 34                	js     8026fd <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  8026c9:	a1 00 70 80 00       	mov    0x807000,%eax
+  8026ce:	89 03                	mov    %eax,(%ebx)
+  8026d0:	a1 04 70 80 00       	mov    0x807004,%eax
+  8026d5:	89 43 04             	mov    %eax,0x4(%ebx)
+  8026d8:	a1 08 70 80 00       	mov    0x807008,%eax
+  8026dd:	89 43 08             	mov    %eax,0x8(%ebx)
+  8026e0:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  8026e5:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8026e8:	a1 10 70 80 00       	mov    0x807010,%eax
+  8026ed:	89 43 10             	mov    %eax,0x10(%ebx)
+  8026f0:	a1 14 70 80 00       	mov    0x807014,%eax
+  8026f5:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  8026f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802700:	c9                   	leave
+  802701:	c3                   	ret
+
+00802702 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802702:	55                   	push   %ebp
+  802703:	89 e5                	mov    %esp,%ebp
+  802705:	57                   	push   %edi
+  802706:	56                   	push   %esi
+  802707:	53                   	push   %ebx
+  802708:	81 ec a4 02 00 00    	sub    $0x2a4,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  80270e:	6a 00                	push   $0x0
+  802710:	ff 75 08             	push   0x8(%ebp)
+  802713:	e8 ee f6 ff ff       	call   801e06 <open>
+  802718:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  80271e:	83 c4 10             	add    $0x10,%esp
+  802721:	85 c0                	test   %eax,%eax
+  802723:	0f 88 39 06 00 00    	js     802d62 <spawn+0x660>
+  802729:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  80272b:	83 ec 04             	sub    $0x4,%esp
+  80272e:	68 00 02 00 00       	push   $0x200
+  802733:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802739:	50                   	push   %eax
+  80273a:	51                   	push   %ecx
+  80273b:	e8 97 ec ff ff       	call   8013d7 <readn>
+  802740:	83 c4 10             	add    $0x10,%esp
+  802743:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802748:	75 5a                	jne    8027a4 <spawn+0xa2>
+	    || elf->e_magic != ELF_MAGIC) {
+  80274a:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802751:	45 4c 46 
+  802754:	75 4e                	jne    8027a4 <spawn+0xa2>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  802756:	b8 07 00 00 00       	mov    $0x7,%eax
+  80275b:	cd 30                	int    $0x30
+  80275d:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  802763:	85 c0                	test   %eax,%eax
+  802765:	0f 88 eb 05 00 00    	js     802d56 <spawn+0x654>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  80276b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802770:	69 f0 8c 00 00 00    	imul   $0x8c,%eax,%esi
+  802776:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80277c:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802782:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802787:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802789:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  80278f:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  802795:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  80279a:	be 00 00 00 00       	mov    $0x0,%esi
+  80279f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8027a2:	eb 4b                	jmp    8027ef <spawn+0xed>
+		close(fd);
+  8027a4:	83 ec 0c             	sub    $0xc,%esp
+  8027a7:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  8027ad:	e8 62 ea ff ff       	call   801214 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8027b2:	83 c4 0c             	add    $0xc,%esp
+  8027b5:	68 7f 45 4c 46       	push   $0x464c457f
+  8027ba:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8027c0:	68 b6 44 80 00       	push   $0x8044b6
+  8027c5:	e8 a8 da ff ff       	call   800272 <cprintf>
+		return -E_NOT_EXEC;
+  8027ca:	83 c4 10             	add    $0x10,%esp
+  8027cd:	c7 85 7c fd ff ff f2 	movl   $0xfffffff2,-0x284(%ebp)
+  8027d4:	ff ff ff 
+  8027d7:	e9 86 05 00 00       	jmp    802d62 <spawn+0x660>
+		string_size += strlen(argv[argc]) + 1;
+  8027dc:	83 ec 0c             	sub    $0xc,%esp
+  8027df:	50                   	push   %eax
+  8027e0:	e8 40 e0 ff ff       	call   800825 <strlen>
+  8027e5:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8027e9:	83 c3 01             	add    $0x1,%ebx
+  8027ec:	83 c4 10             	add    $0x10,%esp
+  8027ef:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  8027f2:	85 c0                	test   %eax,%eax
+  8027f4:	75 e6                	jne    8027dc <spawn+0xda>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  8027f6:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  8027fc:	bf 00 10 40 00       	mov    $0x401000,%edi
+  802801:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802803:	89 fa                	mov    %edi,%edx
+  802805:	83 e2 fc             	and    $0xfffffffc,%edx
+  802808:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  80280f:	29 c2                	sub    %eax,%edx
+  802811:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802817:	8d 42 f8             	lea    -0x8(%edx),%eax
+  80281a:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  80281f:	0f 86 59 05 00 00    	jbe    802d7e <spawn+0x67c>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802825:	83 ec 04             	sub    $0x4,%esp
+  802828:	6a 07                	push   $0x7
+  80282a:	68 00 00 40 00       	push   $0x400000
+  80282f:	6a 00                	push   $0x0
+  802831:	e8 36 e4 ff ff       	call   800c6c <sys_page_alloc>
+  802836:	83 c4 10             	add    $0x10,%esp
+  802839:	85 c0                	test   %eax,%eax
+  80283b:	0f 88 42 05 00 00    	js     802d83 <spawn+0x681>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  802841:	be 00 00 00 00       	mov    $0x0,%esi
+  802846:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  80284c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80284f:	eb 30                	jmp    802881 <spawn+0x17f>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  802851:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802857:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+  80285d:	89 04 b2             	mov    %eax,(%edx,%esi,4)
+		strcpy(string_store, argv[i]);
+  802860:	83 ec 08             	sub    $0x8,%esp
+  802863:	ff 34 b3             	push   (%ebx,%esi,4)
+  802866:	57                   	push   %edi
+  802867:	e8 f4 df ff ff       	call   800860 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  80286c:	83 c4 04             	add    $0x4,%esp
+  80286f:	ff 34 b3             	push   (%ebx,%esi,4)
+  802872:	e8 ae df ff ff       	call   800825 <strlen>
+  802877:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  80287b:	83 c6 01             	add    $0x1,%esi
+  80287e:	83 c4 10             	add    $0x10,%esp
+  802881:	39 b5 90 fd ff ff    	cmp    %esi,-0x270(%ebp)
+  802887:	7f c8                	jg     802851 <spawn+0x14f>
+	}
+	argv_store[argc] = 0;
+  802889:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  80288f:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802895:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  80289c:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  8028a2:	0f 85 83 00 00 00    	jne    80292b <spawn+0x229>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  8028a8:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+  8028ae:	8d 82 00 d0 7f ee    	lea    -0x11803000(%edx),%eax
+  8028b4:	89 42 fc             	mov    %eax,-0x4(%edx)
+	argv_store[-2] = argc;
+  8028b7:	89 d0                	mov    %edx,%eax
+  8028b9:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  8028bf:	89 4a f8             	mov    %ecx,-0x8(%edx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8028c2:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  8028c7:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8028cd:	83 ec 0c             	sub    $0xc,%esp
+  8028d0:	6a 07                	push   $0x7
+  8028d2:	68 00 d0 bf ee       	push   $0xeebfd000
+  8028d7:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  8028dd:	68 00 00 40 00       	push   $0x400000
+  8028e2:	6a 00                	push   $0x0
+  8028e4:	e8 ce e3 ff ff       	call   800cb7 <sys_page_map>
+  8028e9:	89 c3                	mov    %eax,%ebx
+  8028eb:	83 c4 20             	add    $0x20,%esp
+  8028ee:	85 c0                	test   %eax,%eax
+  8028f0:	0f 88 95 04 00 00    	js     802d8b <spawn+0x689>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  8028f6:	83 ec 08             	sub    $0x8,%esp
+  8028f9:	68 00 00 40 00       	push   $0x400000
+  8028fe:	6a 00                	push   $0x0
+  802900:	e8 f4 e3 ff ff       	call   800cf9 <sys_page_unmap>
+  802905:	89 c3                	mov    %eax,%ebx
+  802907:	83 c4 10             	add    $0x10,%esp
+  80290a:	85 c0                	test   %eax,%eax
+  80290c:	0f 88 79 04 00 00    	js     802d8b <spawn+0x689>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802912:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802918:	8d b4 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80291f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802924:	89 df                	mov    %ebx,%edi
+  802926:	e9 7f 02 00 00       	jmp    802baa <spawn+0x4a8>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  80292b:	68 40 45 80 00       	push   $0x804540
+  802930:	68 60 44 80 00       	push   $0x804460
+  802935:	68 f0 00 00 00       	push   $0xf0
+  80293a:	68 d0 44 80 00       	push   $0x8044d0
+  80293f:	e8 53 d8 ff ff       	call   800197 <_panic>
+
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+		if (i >= filesz) {
+			// allocate a blank page
+			n = 1;
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  802944:	83 ec 04             	sub    $0x4,%esp
+  802947:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  80294d:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802953:	01 f8                	add    %edi,%eax
+  802955:	50                   	push   %eax
+  802956:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  80295c:	e8 0b e3 ff ff       	call   800c6c <sys_page_alloc>
+  802961:	83 c4 10             	add    $0x10,%esp
+  802964:	85 c0                	test   %eax,%eax
+  802966:	0f 88 04 04 00 00    	js     802d70 <spawn+0x66e>
+			n = 1;
+  80296c:	be 01 00 00 00       	mov    $0x1,%esi
+  802971:	e9 99 01 00 00       	jmp    802b0f <spawn+0x40d>
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+			// read-only and all from file: map the file server's
+			// cached pages, so that every instance of the program
+			// shares one copy of its text
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  802976:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  80297c:	8b 8d 80 fd ff ff    	mov    -0x280(%ebp),%ecx
+  802982:	39 c8                	cmp    %ecx,%eax
+  802984:	72 70                	jb     8029f6 <spawn+0x2f4>
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+  802986:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80298b:	29 f8                	sub    %edi,%eax
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  80298d:	c1 e8 0c             	shr    $0xc,%eax
+			n = MIN(n, FSBULK_MAXPAGES);
+  802990:	ba 40 00 00 00       	mov    $0x40,%edx
+  802995:	39 d0                	cmp    %edx,%eax
+  802997:	0f 4e d0             	cmovle %eax,%edx
+  80299a:	89 d6                	mov    %edx,%esi
+			if ((r = mmap(UTEMP, n * PGSIZE, PROT_READ, MAP_SHARED,
+  80299c:	83 ec 08             	sub    $0x8,%esp
+  80299f:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  8029a5:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  8029ab:	01 d0                	add    %edx,%eax
+  8029ad:	50                   	push   %eax
+  8029ae:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  8029b4:	6a 01                	push   $0x1
+  8029b6:	6a 01                	push   $0x1
+  8029b8:	89 f0                	mov    %esi,%eax
+  8029ba:	c1 e0 0c             	shl    $0xc,%eax
+  8029bd:	50                   	push   %eax
+  8029be:	68 00 00 40 00       	push   $0x400000
+  8029c3:	e8 1c f6 ff ff       	call   801fe4 <mmap>
+  8029c8:	83 c4 20             	add    $0x20,%esp
+  8029cb:	85 c0                	test   %eax,%eax
+  8029cd:	78 34                	js     802a03 <spawn+0x301>
+			if ((r = seek(fd, fileoffset + i)) < 0)
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
+				return r;
+		}
+		for (j = 0; j < n; j++) {
+  8029cf:	8d 86 00 04 00 00    	lea    0x400(%esi),%eax
+  8029d5:	c1 e0 0c             	shl    $0xc,%eax
+  8029d8:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  8029de:	bb 00 00 40 00       	mov    $0x400000,%ebx
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  8029e3:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  8029e9:	01 c7                	add    %eax,%edi
+  8029eb:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+		for (j = 0; j < n; j++) {
+  8029f1:	e9 ca 00 00 00       	jmp    802ac0 <spawn+0x3be>
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  8029f6:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  8029fc:	29 f8                	sub    %edi,%eax
+  8029fe:	c1 e8 0c             	shr    $0xc,%eax
+  802a01:	eb 8d                	jmp    802990 <spawn+0x28e>
+  802a03:	89 c7                	mov    %eax,%edi
+  802a05:	eb 27                	jmp    802a2e <spawn+0x32c>
+			for (j = 0; j < n; j++)
+  802a07:	83 c3 01             	add    $0x1,%ebx
+  802a0a:	39 de                	cmp    %ebx,%esi
+  802a0c:	7e 4a                	jle    802a58 <spawn+0x356>
+				if ((r = sys_page_alloc(0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  802a0e:	83 ec 04             	sub    $0x4,%esp
+  802a11:	6a 07                	push   $0x7
+  802a13:	89 d8                	mov    %ebx,%eax
+  802a15:	c1 e0 0c             	shl    $0xc,%eax
+  802a18:	05 00 00 40 00       	add    $0x400000,%eax
+  802a1d:	50                   	push   %eax
+  802a1e:	6a 00                	push   $0x0
+  802a20:	e8 47 e2 ff ff       	call   800c6c <sys_page_alloc>
+  802a25:	83 c4 10             	add    $0x10,%esp
+  802a28:	85 c0                	test   %eax,%eax
+  802a2a:	79 db                	jns    802a07 <spawn+0x305>
+  802a2c:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  802a2e:	83 ec 0c             	sub    $0xc,%esp
+  802a31:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802a37:	e8 a1 e1 ff ff       	call   800bdd <sys_env_destroy>
+	close(fd);
+  802a3c:	83 c4 04             	add    $0x4,%esp
+  802a3f:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  802a45:	e8 ca e7 ff ff       	call   801214 <close>
+	return r;
+  802a4a:	83 c4 10             	add    $0x10,%esp
+  802a4d:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+  802a53:	e9 0a 03 00 00       	jmp    802d62 <spawn+0x660>
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  802a58:	83 ec 08             	sub    $0x8,%esp
+  802a5b:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802a61:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  802a67:	01 d0                	add    %edx,%eax
+  802a69:	50                   	push   %eax
+  802a6a:	8b 9d 7c fd ff ff    	mov    -0x284(%ebp),%ebx
+  802a70:	53                   	push   %ebx
+  802a71:	e8 2a ea ff ff       	call   8014a0 <seek>
+  802a76:	83 c4 10             	add    $0x10,%esp
+  802a79:	85 c0                	test   %eax,%eax
+  802a7b:	0f 88 f6 02 00 00    	js     802d77 <spawn+0x675>
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
+  802a81:	83 ec 04             	sub    $0x4,%esp
+  802a84:	89 f0                	mov    %esi,%eax
+  802a86:	c1 e0 0c             	shl    $0xc,%eax
+  802a89:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  802a8f:	39 c8                	cmp    %ecx,%eax
+  802a91:	0f 47 c1             	cmova  %ecx,%eax
+  802a94:	50                   	push   %eax
+  802a95:	68 00 00 40 00       	push   $0x400000
+  802a9a:	53                   	push   %ebx
+  802a9b:	e8 37 e9 ff ff       	call   8013d7 <readn>
+  802aa0:	83 c4 10             	add    $0x10,%esp
+  802aa3:	85 c0                	test   %eax,%eax
+  802aa5:	0f 89 24 ff ff ff    	jns    8029cf <spawn+0x2cd>
+  802aab:	89 c7                	mov    %eax,%edi
+  802aad:	e9 7c ff ff ff       	jmp    802a2e <spawn+0x32c>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP + j * PGSIZE);
+  802ab2:	83 ec 08             	sub    $0x8,%esp
+  802ab5:	56                   	push   %esi
+  802ab6:	6a 00                	push   $0x0
+  802ab8:	e8 3c e2 ff ff       	call   800cf9 <sys_page_unmap>
+  802abd:	83 c4 10             	add    $0x10,%esp
+		for (j = 0; j < n; j++) {
+  802ac0:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802ac6:	39 c3                	cmp    %eax,%ebx
+  802ac8:	74 3f                	je     802b09 <spawn+0x407>
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  802aca:	89 de                	mov    %ebx,%esi
+  802acc:	83 ec 0c             	sub    $0xc,%esp
+  802acf:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802ad5:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  802ad8:	50                   	push   %eax
+  802ad9:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802adf:	53                   	push   %ebx
+  802ae0:	6a 00                	push   $0x0
+  802ae2:	e8 d0 e1 ff ff       	call   800cb7 <sys_page_map>
+  802ae7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802aed:	83 c4 20             	add    $0x20,%esp
+  802af0:	85 c0                	test   %eax,%eax
+  802af2:	79 be                	jns    802ab2 <spawn+0x3b0>
+				panic("spawn: sys_page_map data: %e", r);
+  802af4:	50                   	push   %eax
+  802af5:	68 dc 44 80 00       	push   $0x8044dc
+  802afa:	68 36 01 00 00       	push   $0x136
+  802aff:	68 d0 44 80 00       	push   $0x8044d0
+  802b04:	e8 8e d6 ff ff       	call   800197 <_panic>
+  802b09:	8b b5 74 fd ff ff    	mov    -0x28c(%ebp),%esi
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  802b0f:	c1 e6 0c             	shl    $0xc,%esi
+  802b12:	01 b5 88 fd ff ff    	add    %esi,-0x278(%ebp)
+  802b18:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802b1e:	89 c7                	mov    %eax,%edi
+  802b20:	8b 8d 80 fd ff ff    	mov    -0x280(%ebp),%ecx
+  802b26:	39 c8                	cmp    %ecx,%eax
+  802b28:	73 6e                	jae    802b98 <spawn+0x496>
+		if (i >= filesz) {
+  802b2a:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802b30:	39 8d 88 fd ff ff    	cmp    %ecx,-0x278(%ebp)
+  802b36:	0f 83 08 fe ff ff    	jae    802944 <spawn+0x242>
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+  802b3c:	f6 85 94 fd ff ff 02 	testb  $0x2,-0x26c(%ebp)
+  802b43:	75 27                	jne    802b6c <spawn+0x46a>
+  802b45:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802b4b:	05 00 10 00 00       	add    $0x1000,%eax
+  802b50:	8b 95 84 fd ff ff    	mov    -0x27c(%ebp),%edx
+  802b56:	39 c2                	cmp    %eax,%edx
+  802b58:	0f 83 18 fe ff ff    	jae    802976 <spawn+0x274>
+  802b5e:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802b64:	39 c2                	cmp    %eax,%edx
+  802b66:	0f 83 0a fe ff ff    	jae    802976 <spawn+0x274>
+			n = MIN(FSBULK_MAXPAGES, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  802b6c:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802b72:	29 f8                	sub    %edi,%eax
+  802b74:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  802b7a:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802b7f:	c1 e8 0c             	shr    $0xc,%eax
+  802b82:	89 c6                	mov    %eax,%esi
+  802b84:	b8 40 00 00 00       	mov    $0x40,%eax
+  802b89:	39 c6                	cmp    %eax,%esi
+  802b8b:	0f 47 f0             	cmova  %eax,%esi
+			for (j = 0; j < n; j++)
+  802b8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b93:	e9 72 fe ff ff       	jmp    802a0a <spawn+0x308>
+  802b98:	8b bd 68 fd ff ff    	mov    -0x298(%ebp),%edi
+  802b9e:	8b b5 64 fd ff ff    	mov    -0x29c(%ebp),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802ba4:	83 c7 01             	add    $0x1,%edi
+  802ba7:	83 c6 20             	add    $0x20,%esi
+  802baa:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802bb1:	39 f8                	cmp    %edi,%eax
+  802bb3:	0f 8e 88 00 00 00    	jle    802c41 <spawn+0x53f>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802bb9:	83 3e 01             	cmpl   $0x1,(%esi)
+  802bbc:	75 e6                	jne    802ba4 <spawn+0x4a2>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802bbe:	8b 46 18             	mov    0x18(%esi),%eax
+  802bc1:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802bc4:	83 f8 01             	cmp    $0x1,%eax
+  802bc7:	19 c0                	sbb    %eax,%eax
+  802bc9:	83 e0 fe             	and    $0xfffffffe,%eax
+  802bcc:	83 c0 07             	add    $0x7,%eax
+  802bcf:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802bd5:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802bd8:	89 8d 78 fd ff ff    	mov    %ecx,-0x288(%ebp)
+  802bde:	8b 5e 10             	mov    0x10(%esi),%ebx
+  802be1:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  802be7:	8b 46 14             	mov    0x14(%esi),%eax
+  802bea:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  802bf0:	8b 56 08             	mov    0x8(%esi),%edx
+	if ((i = PGOFF(va))) {
+  802bf3:	89 d0                	mov    %edx,%eax
+  802bf5:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802bfa:	74 18                	je     802c14 <spawn+0x512>
+		va -= i;
+  802bfc:	29 c2                	sub    %eax,%edx
+		memsz += i;
+  802bfe:	01 85 80 fd ff ff    	add    %eax,-0x280(%ebp)
+		filesz += i;
+  802c04:	01 c3                	add    %eax,%ebx
+  802c06:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+		fileoffset -= i;
+  802c0c:	29 c1                	sub    %eax,%ecx
+  802c0e:	89 8d 78 fd ff ff    	mov    %ecx,-0x288(%ebp)
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  802c14:	c7 85 88 fd ff ff 00 	movl   $0x0,-0x278(%ebp)
+  802c1b:	00 00 00 
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  802c1e:	8d 82 00 00 c0 ff    	lea    -0x400000(%edx),%eax
+  802c24:	89 85 70 fd ff ff    	mov    %eax,-0x290(%ebp)
+  802c2a:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+  802c30:	89 bd 68 fd ff ff    	mov    %edi,-0x298(%ebp)
+  802c36:	89 b5 64 fd ff ff    	mov    %esi,-0x29c(%ebp)
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  802c3c:	e9 d7 fe ff ff       	jmp    802b18 <spawn+0x416>
+	close(fd);
+  802c41:	83 ec 0c             	sub    $0xc,%esp
+  802c44:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  802c4a:	e8 c5 e5 ff ff       	call   801214 <close>
+  802c4f:	83 c4 10             	add    $0x10,%esp
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+	// LAB 5: Your code here.
+	int r = 0;
+  802c52:	ba 00 00 00 00       	mov    $0x0,%edx
+
+	for (uintptr_t va = 0; va < UTOP; va += PGSIZE) {
+  802c57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c5c:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  802c62:	eb 14                	jmp    802c78 <spawn+0x576>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+			va += PTSIZE - PGSIZE;
+  802c64:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t va = 0; va < UTOP; va += PGSIZE) {
+  802c6a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802c70:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802c76:	77 65                	ja     802cdd <spawn+0x5db>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  802c78:	89 d8                	mov    %ebx,%eax
+  802c7a:	c1 e8 16             	shr    $0x16,%eax
+  802c7d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802c84:	a8 01                	test   $0x1,%al
+  802c86:	74 dc                	je     802c64 <spawn+0x562>
+			continue;
+		}
+		if (!(uvpt[PGNUM(va)] & PTE_P) || !(uvpt[PGNUM(va)] & PTE_SHARE))
+  802c88:	89 d8                	mov    %ebx,%eax
+  802c8a:	c1 e8 0c             	shr    $0xc,%eax
+  802c8d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802c94:	f6 c1 01             	test   $0x1,%cl
+  802c97:	74 d1                	je     802c6a <spawn+0x568>
+  802c99:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802ca0:	f6 c5 04             	test   $0x4,%ch
+  802ca3:	74 c5                	je     802c6a <spawn+0x568>
+			continue;
+		r = sys_page_map(0, (void *) va, child, (void *) va,
+				 uvpt[PGNUM(va)] & PTE_SYSCALL);
+  802ca5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+		r = sys_page_map(0, (void *) va, child, (void *) va,
+  802cac:	83 ec 0c             	sub    $0xc,%esp
+  802caf:	25 07 0e 00 00       	and    $0xe07,%eax
+  802cb4:	50                   	push   %eax
+  802cb5:	53                   	push   %ebx
+  802cb6:	56                   	push   %esi
+  802cb7:	53                   	push   %ebx
+  802cb8:	6a 00                	push   $0x0
+  802cba:	e8 f8 df ff ff       	call   800cb7 <sys_page_map>
+  802cbf:	89 c2                	mov    %eax,%edx
+		if (r < 0)
+  802cc1:	83 c4 20             	add    $0x20,%esp
+  802cc4:	85 c0                	test   %eax,%eax
+  802cc6:	79 a2                	jns    802c6a <spawn+0x568>
+		panic("copy_shared_pages: %e", r);
+  802cc8:	52                   	push   %edx
+  802cc9:	68 f9 44 80 00       	push   $0x8044f9
+  802cce:	68 80 00 00 00       	push   $0x80
+  802cd3:	68 d0 44 80 00       	push   $0x8044d0
+  802cd8:	e8 ba d4 ff ff       	call   800197 <_panic>
+	if ((r = copy_shared_pages(child)) < 0)
+  802cdd:	85 d2                	test   %edx,%edx
+  802cdf:	78 e7                	js     802cc8 <spawn+0x5c6>
+	child_tf.tf_eflags |= FL_IOPL_3;   // devious: see user/faultio.c
+  802ce1:	81 8d dc fd ff ff 00 	orl    $0x3000,-0x224(%ebp)
+  802ce8:	30 00 00 
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802ceb:	83 ec 08             	sub    $0x8,%esp
+  802cee:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802cf4:	50                   	push   %eax
+  802cf5:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802cfb:	e8 8d e0 ff ff       	call   800d8d <sys_env_set_trapframe>
+  802d00:	83 c4 10             	add    $0x10,%esp
+  802d03:	85 c0                	test   %eax,%eax
+  802d05:	78 25                	js     802d2c <spawn+0x62a>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802d07:	83 ec 08             	sub    $0x8,%esp
+  802d0a:	6a 02                	push   $0x2
+  802d0c:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802d12:	e8 2c e0 ff ff       	call   800d43 <sys_env_set_status>
+  802d17:	83 c4 10             	add    $0x10,%esp
+  802d1a:	85 c0                	test   %eax,%eax
+  802d1c:	78 23                	js     802d41 <spawn+0x63f>
+	return child;
+  802d1e:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802d24:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802d2a:	eb 36                	jmp    802d62 <spawn+0x660>
+		panic("sys_env_set_trapframe: %e", r);
+  802d2c:	50                   	push   %eax
+  802d2d:	68 0f 45 80 00       	push   $0x80450f
+  802d32:	68 84 00 00 00       	push   $0x84
+  802d37:	68 d0 44 80 00       	push   $0x8044d0
+  802d3c:	e8 56 d4 ff ff       	call   800197 <_panic>
+		panic("sys_env_set_status: %e", r);
+  802d41:	50                   	push   %eax
+  802d42:	68 29 45 80 00       	push   $0x804529
+  802d47:	68 87 00 00 00       	push   $0x87
+  802d4c:	68 d0 44 80 00       	push   $0x8044d0
+  802d51:	e8 41 d4 ff ff       	call   800197 <_panic>
+		return r;
+  802d56:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802d5c:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+}
+  802d62:	8b 85 7c fd ff ff    	mov    -0x284(%ebp),%eax
+  802d68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d6b:	5b                   	pop    %ebx
+  802d6c:	5e                   	pop    %esi
+  802d6d:	5f                   	pop    %edi
+  802d6e:	5d                   	pop    %ebp
+  802d6f:	c3                   	ret
+  802d70:	89 c7                	mov    %eax,%edi
+  802d72:	e9 b7 fc ff ff       	jmp    802a2e <spawn+0x32c>
+  802d77:	89 c7                	mov    %eax,%edi
+  802d79:	e9 b0 fc ff ff       	jmp    802a2e <spawn+0x32c>
+		return -E_NO_MEM;
+  802d7e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802d83:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802d89:	eb d7                	jmp    802d62 <spawn+0x660>
+	sys_page_unmap(0, UTEMP);
+  802d8b:	83 ec 08             	sub    $0x8,%esp
+  802d8e:	68 00 00 40 00       	push   $0x400000
+  802d93:	6a 00                	push   $0x0
+  802d95:	e8 5f df ff ff       	call   800cf9 <sys_page_unmap>
+  802d9a:	83 c4 10             	add    $0x10,%esp
+  802d9d:	89 9d 7c fd ff ff    	mov    %ebx,-0x284(%ebp)
+  802da3:	eb bd                	jmp    802d62 <spawn+0x660>
+
+00802da5 <spawnl>:
+{
+  802da5:	55                   	push   %ebp
+  802da6:	89 e5                	mov    %esp,%ebp
+  802da8:	56                   	push   %esi
+  802da9:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802daa:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  802dad:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  802db2:	eb 05                	jmp    802db9 <spawnl+0x14>
+		argc++;
+  802db4:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  802db7:	89 ca                	mov    %ecx,%edx
+  802db9:	8d 4a 04             	lea    0x4(%edx),%ecx
+  802dbc:	83 3a 00             	cmpl   $0x0,(%edx)
+  802dbf:	75 f3                	jne    802db4 <spawnl+0xf>
+	const char *argv[argc+2];
+  802dc1:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  802dc8:	83 e2 f0             	and    $0xfffffff0,%edx
+  802dcb:	29 d4                	sub    %edx,%esp
+  802dcd:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802dd1:	89 da                	mov    %ebx,%edx
+  802dd3:	c1 ea 02             	shr    $0x2,%edx
+  802dd6:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802dd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ddc:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802de3:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  802dea:	00 
+	va_start(vl, arg0);
+  802deb:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  802dee:	89 c2                	mov    %eax,%edx
+  802df0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802df5:	eb 0b                	jmp    802e02 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  802df7:	83 c0 01             	add    $0x1,%eax
+  802dfa:	8b 31                	mov    (%ecx),%esi
+  802dfc:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802dff:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802e02:	39 d0                	cmp    %edx,%eax
+  802e04:	75 f1                	jne    802df7 <spawnl+0x52>
+	return spawn(prog, argv);
+  802e06:	83 ec 08             	sub    $0x8,%esp
+  802e09:	53                   	push   %ebx
+  802e0a:	ff 75 08             	push   0x8(%ebp)
+  802e0d:	e8 f0 f8 ff ff       	call   802702 <spawn>
+}
+  802e12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e15:	5b                   	pop    %ebx
+  802e16:	5e                   	pop    %esi
+  802e17:	5d                   	pop    %ebp
+  802e18:	c3                   	ret
+
+00802e19 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e19:	55                   	push   %ebp
+  802e1a:	89 e5                	mov    %esp,%ebp
+  802e1c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802e1f:	68 66 45 80 00       	push   $0x804566
+  802e24:	ff 75 0c             	push   0xc(%ebp)
+  802e27:	e8 34 da ff ff       	call   800860 <strcpy>
+	return 0;
+}
+  802e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e31:	c9                   	leave
+  802e32:	c3                   	ret
+
+00802e33 <devsock_close>:
+{
+  802e33:	55                   	push   %ebp
+  802e34:	89 e5                	mov    %esp,%ebp
+  802e36:	53                   	push   %ebx
+  802e37:	83 ec 10             	sub    $0x10,%esp
+  802e3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802e3d:	53                   	push   %ebx
+  802e3e:	e8 f4 0d 00 00       	call   803c37 <pageref>
+  802e43:	89 c2                	mov    %eax,%edx
+  802e45:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802e48:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802e4d:	83 fa 01             	cmp    $0x1,%edx
+  802e50:	74 05                	je     802e57 <devsock_close+0x24>
+}
+  802e52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e55:	c9                   	leave
+  802e56:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802e57:	83 ec 0c             	sub    $0xc,%esp
+  802e5a:	ff 73 0c             	push   0xc(%ebx)
+  802e5d:	e8 b7 02 00 00       	call   803119 <nsipc_close>
+  802e62:	83 c4 10             	add    $0x10,%esp
+  802e65:	eb eb                	jmp    802e52 <devsock_close+0x1f>
+
+00802e67 <devsock_write>:
+{
+  802e67:	55                   	push   %ebp
+  802e68:	89 e5                	mov    %esp,%ebp
+  802e6a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802e6d:	6a 00                	push   $0x0
+  802e6f:	ff 75 10             	push   0x10(%ebp)
+  802e72:	ff 75 0c             	push   0xc(%ebp)
+  802e75:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e78:	ff 70 0c             	push   0xc(%eax)
+  802e7b:	e8 79 03 00 00       	call   8031f9 <nsipc_send>
+}
+  802e80:	c9                   	leave
+  802e81:	c3                   	ret
+
+00802e82 <devsock_read>:
+{
+  802e82:	55                   	push   %ebp
+  802e83:	89 e5                	mov    %esp,%ebp
+  802e85:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802e88:	6a 00                	push   $0x0
+  802e8a:	ff 75 10             	push   0x10(%ebp)
+  802e8d:	ff 75 0c             	push   0xc(%ebp)
+  802e90:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e93:	ff 70 0c             	push   0xc(%eax)
+  802e96:	e8 ef 02 00 00       	call   80318a <nsipc_recv>
+}
+  802e9b:	c9                   	leave
+  802e9c:	c3                   	ret
+
+00802e9d <fd2sockid>:
+{
+  802e9d:	55                   	push   %ebp
+  802e9e:	89 e5                	mov    %esp,%ebp
+  802ea0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802ea3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802ea6:	52                   	push   %edx
+  802ea7:	50                   	push   %eax
+  802ea8:	e8 3d e2 ff ff       	call   8010ea <fd_lookup>
+  802ead:	83 c4 10             	add    $0x10,%esp
+  802eb0:	85 c0                	test   %eax,%eax
+  802eb2:	78 10                	js     802ec4 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802eb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802eb7:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802ebd:	39 08                	cmp    %ecx,(%eax)
+  802ebf:	75 05                	jne    802ec6 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802ec1:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802ec4:	c9                   	leave
+  802ec5:	c3                   	ret
+		return -E_NOT_SUPP;
+  802ec6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ecb:	eb f7                	jmp    802ec4 <fd2sockid+0x27>
+
+00802ecd <alloc_sockfd>:
+{
+  802ecd:	55                   	push   %ebp
+  802ece:	89 e5                	mov    %esp,%ebp
+  802ed0:	56                   	push   %esi
+  802ed1:	53                   	push   %ebx
+  802ed2:	83 ec 1c             	sub    $0x1c,%esp
+  802ed5:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802ed7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802eda:	50                   	push   %eax
+  802edb:	e8 b4 e1 ff ff       	call   801094 <fd_alloc>
+  802ee0:	89 c3                	mov    %eax,%ebx
+  802ee2:	83 c4 10             	add    $0x10,%esp
+  802ee5:	85 c0                	test   %eax,%eax
+  802ee7:	78 43                	js     802f2c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802ee9:	83 ec 04             	sub    $0x4,%esp
+  802eec:	68 07 04 00 00       	push   $0x407
+  802ef1:	ff 75 f4             	push   -0xc(%ebp)
+  802ef4:	6a 00                	push   $0x0
+  802ef6:	e8 71 dd ff ff       	call   800c6c <sys_page_alloc>
+  802efb:	89 c3                	mov    %eax,%ebx
+  802efd:	83 c4 10             	add    $0x10,%esp
+  802f00:	85 c0                	test   %eax,%eax
+  802f02:	78 28                	js     802f2c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802f04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f07:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802f0d:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802f0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f12:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802f19:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802f1c:	83 ec 0c             	sub    $0xc,%esp
+  802f1f:	50                   	push   %eax
+  802f20:	e8 48 e1 ff ff       	call   80106d <fd2num>
+  802f25:	89 c3                	mov    %eax,%ebx
+  802f27:	83 c4 10             	add    $0x10,%esp
+  802f2a:	eb 0c                	jmp    802f38 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802f2c:	83 ec 0c             	sub    $0xc,%esp
+  802f2f:	56                   	push   %esi
+  802f30:	e8 e4 01 00 00       	call   803119 <nsipc_close>
+		return r;
+  802f35:	83 c4 10             	add    $0x10,%esp
+}
+  802f38:	89 d8                	mov    %ebx,%eax
+  802f3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f3d:	5b                   	pop    %ebx
+  802f3e:	5e                   	pop    %esi
+  802f3f:	5d                   	pop    %ebp
+  802f40:	c3                   	ret
+
+00802f41 <accept>:
+{
+  802f41:	55                   	push   %ebp
+  802f42:	89 e5                	mov    %esp,%ebp
+  802f44:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f47:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f4a:	e8 4e ff ff ff       	call   802e9d <fd2sockid>
+  802f4f:	85 c0                	test   %eax,%eax
+  802f51:	78 1b                	js     802f6e <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802f53:	83 ec 04             	sub    $0x4,%esp
+  802f56:	ff 75 10             	push   0x10(%ebp)
+  802f59:	ff 75 0c             	push   0xc(%ebp)
+  802f5c:	50                   	push   %eax
+  802f5d:	e8 0e 01 00 00       	call   803070 <nsipc_accept>
+  802f62:	83 c4 10             	add    $0x10,%esp
+  802f65:	85 c0                	test   %eax,%eax
+  802f67:	78 05                	js     802f6e <accept+0x2d>
+	return alloc_sockfd(r);
+  802f69:	e8 5f ff ff ff       	call   802ecd <alloc_sockfd>
+}
+  802f6e:	c9                   	leave
+  802f6f:	c3                   	ret
+
+00802f70 <bind>:
+{
+  802f70:	55                   	push   %ebp
+  802f71:	89 e5                	mov    %esp,%ebp
+  802f73:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f76:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f79:	e8 1f ff ff ff       	call   802e9d <fd2sockid>
+  802f7e:	85 c0                	test   %eax,%eax
+  802f80:	78 12                	js     802f94 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802f82:	83 ec 04             	sub    $0x4,%esp
+  802f85:	ff 75 10             	push   0x10(%ebp)
+  802f88:	ff 75 0c             	push   0xc(%ebp)
+  802f8b:	50                   	push   %eax
+  802f8c:	e8 31 01 00 00       	call   8030c2 <nsipc_bind>
+  802f91:	83 c4 10             	add    $0x10,%esp
+}
+  802f94:	c9                   	leave
+  802f95:	c3                   	ret
+
+00802f96 <shutdown>:
+{
+  802f96:	55                   	push   %ebp
+  802f97:	89 e5                	mov    %esp,%ebp
+  802f99:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f9f:	e8 f9 fe ff ff       	call   802e9d <fd2sockid>
+  802fa4:	85 c0                	test   %eax,%eax
+  802fa6:	78 0f                	js     802fb7 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802fa8:	83 ec 08             	sub    $0x8,%esp
+  802fab:	ff 75 0c             	push   0xc(%ebp)
+  802fae:	50                   	push   %eax
+  802faf:	e8 43 01 00 00       	call   8030f7 <nsipc_shutdown>
+  802fb4:	83 c4 10             	add    $0x10,%esp
+}
+  802fb7:	c9                   	leave
+  802fb8:	c3                   	ret
+
+00802fb9 <connect>:
+{
+  802fb9:	55                   	push   %ebp
+  802fba:	89 e5                	mov    %esp,%ebp
+  802fbc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fc2:	e8 d6 fe ff ff       	call   802e9d <fd2sockid>
+  802fc7:	85 c0                	test   %eax,%eax
+  802fc9:	78 12                	js     802fdd <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802fcb:	83 ec 04             	sub    $0x4,%esp
+  802fce:	ff 75 10             	push   0x10(%ebp)
+  802fd1:	ff 75 0c             	push   0xc(%ebp)
+  802fd4:	50                   	push   %eax
+  802fd5:	e8 59 01 00 00       	call   803133 <nsipc_connect>
+  802fda:	83 c4 10             	add    $0x10,%esp
+}
+  802fdd:	c9                   	leave
+  802fde:	c3                   	ret
+
+00802fdf <listen>:
+{
+  802fdf:	55                   	push   %ebp
+  802fe0:	89 e5                	mov    %esp,%ebp
+  802fe2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fe5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fe8:	e8 b0 fe ff ff       	call   802e9d <fd2sockid>
+  802fed:	85 c0                	test   %eax,%eax
+  802fef:	78 0f                	js     803000 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802ff1:	83 ec 08             	sub    $0x8,%esp
+  802ff4:	ff 75 0c             	push   0xc(%ebp)
+  802ff7:	50                   	push   %eax
+  802ff8:	e8 6b 01 00 00       	call   803168 <nsipc_listen>
+  802ffd:	83 c4 10             	add    $0x10,%esp
+}
+  803000:	c9                   	leave
+  803001:	c3                   	ret
+
+00803002 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803002:	55                   	push   %ebp
+  803003:	89 e5                	mov    %esp,%ebp
+  803005:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803008:	ff 75 10             	push   0x10(%ebp)
+  80300b:	ff 75 0c             	push   0xc(%ebp)
+  80300e:	ff 75 08             	push   0x8(%ebp)
+  803011:	e8 41 02 00 00       	call   803257 <nsipc_socket>
+  803016:	83 c4 10             	add    $0x10,%esp
+  803019:	85 c0                	test   %eax,%eax
+  80301b:	78 05                	js     803022 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80301d:	e8 ab fe ff ff       	call   802ecd <alloc_sockfd>
+}
+  803022:	c9                   	leave
+  803023:	c3                   	ret
+
+00803024 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803024:	55                   	push   %ebp
+  803025:	89 e5                	mov    %esp,%ebp
+  803027:	53                   	push   %ebx
+  803028:	83 ec 04             	sub    $0x4,%esp
+  80302b:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80302d:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  803034:	74 26                	je     80305c <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803036:	6a 07                	push   $0x7
+  803038:	68 00 90 80 00       	push   $0x809000
+  80303d:	53                   	push   %ebx
+  80303e:	ff 35 00 a0 80 00    	push   0x80a000
+  803044:	e8 76 0a 00 00       	call   803abf <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803049:	83 c4 0c             	add    $0xc,%esp
+  80304c:	6a 00                	push   $0x0
+  80304e:	6a 00                	push   $0x0
+  803050:	6a 00                	push   $0x0
+  803052:	e8 fd 09 00 00       	call   803a54 <ipc_recv>
+}
+  803057:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80305a:	c9                   	leave
+  80305b:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80305c:	83 ec 0c             	sub    $0xc,%esp
+  80305f:	6a 02                	push   $0x2
+  803061:	e8 92 0b 00 00       	call   803bf8 <ipc_find_env>
+  803066:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  80306b:	83 c4 10             	add    $0x10,%esp
+  80306e:	eb c6                	jmp    803036 <nsipc+0x12>
+
+00803070 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803070:	55                   	push   %ebp
+  803071:	89 e5                	mov    %esp,%ebp
+  803073:	56                   	push   %esi
+  803074:	53                   	push   %ebx
+  803075:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803078:	8b 45 08             	mov    0x8(%ebp),%eax
+  80307b:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  803080:	8b 06                	mov    (%esi),%eax
+  803082:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803087:	b8 01 00 00 00       	mov    $0x1,%eax
+  80308c:	e8 93 ff ff ff       	call   803024 <nsipc>
+  803091:	89 c3                	mov    %eax,%ebx
+  803093:	85 c0                	test   %eax,%eax
+  803095:	79 09                	jns    8030a0 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803097:	89 d8                	mov    %ebx,%eax
+  803099:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80309c:	5b                   	pop    %ebx
+  80309d:	5e                   	pop    %esi
+  80309e:	5d                   	pop    %ebp
+  80309f:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8030a0:	83 ec 04             	sub    $0x4,%esp
+  8030a3:	ff 35 10 90 80 00    	push   0x809010
+  8030a9:	68 00 90 80 00       	push   $0x809000
+  8030ae:	ff 75 0c             	push   0xc(%ebp)
+  8030b1:	e8 30 d9 ff ff       	call   8009e6 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8030b6:	a1 10 90 80 00       	mov    0x809010,%eax
+  8030bb:	89 06                	mov    %eax,(%esi)
+  8030bd:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8030c0:	eb d5                	jmp    803097 <nsipc_accept+0x27>
+
+008030c2 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8030c2:	55                   	push   %ebp
+  8030c3:	89 e5                	mov    %esp,%ebp
+  8030c5:	53                   	push   %ebx
+  8030c6:	83 ec 08             	sub    $0x8,%esp
+  8030c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8030cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030cf:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8030d4:	53                   	push   %ebx
+  8030d5:	ff 75 0c             	push   0xc(%ebp)
+  8030d8:	68 04 90 80 00       	push   $0x809004
+  8030dd:	e8 04 d9 ff ff       	call   8009e6 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8030e2:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  8030e8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8030ed:	e8 32 ff ff ff       	call   803024 <nsipc>
+}
+  8030f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030f5:	c9                   	leave
+  8030f6:	c3                   	ret
+
+008030f7 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8030f7:	55                   	push   %ebp
+  8030f8:	89 e5                	mov    %esp,%ebp
+  8030fa:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8030fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803100:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  803105:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803108:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  80310d:	b8 03 00 00 00       	mov    $0x3,%eax
+  803112:	e8 0d ff ff ff       	call   803024 <nsipc>
+}
+  803117:	c9                   	leave
+  803118:	c3                   	ret
+
+00803119 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803119:	55                   	push   %ebp
+  80311a:	89 e5                	mov    %esp,%ebp
+  80311c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80311f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803122:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  803127:	b8 04 00 00 00       	mov    $0x4,%eax
+  80312c:	e8 f3 fe ff ff       	call   803024 <nsipc>
+}
+  803131:	c9                   	leave
+  803132:	c3                   	ret
+
+00803133 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803133:	55                   	push   %ebp
+  803134:	89 e5                	mov    %esp,%ebp
+  803136:	53                   	push   %ebx
+  803137:	83 ec 08             	sub    $0x8,%esp
+  80313a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80313d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803140:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803145:	53                   	push   %ebx
+  803146:	ff 75 0c             	push   0xc(%ebp)
+  803149:	68 04 90 80 00       	push   $0x809004
+  80314e:	e8 93 d8 ff ff       	call   8009e6 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803153:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  803159:	b8 05 00 00 00       	mov    $0x5,%eax
+  80315e:	e8 c1 fe ff ff       	call   803024 <nsipc>
+}
+  803163:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803166:	c9                   	leave
+  803167:	c3                   	ret
+
+00803168 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803168:	55                   	push   %ebp
+  803169:	89 e5                	mov    %esp,%ebp
+  80316b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80316e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803171:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  803176:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803179:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  80317e:	b8 06 00 00 00       	mov    $0x6,%eax
+  803183:	e8 9c fe ff ff       	call   803024 <nsipc>
+}
+  803188:	c9                   	leave
+  803189:	c3                   	ret
+
+0080318a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80318a:	55                   	push   %ebp
+  80318b:	89 e5                	mov    %esp,%ebp
+  80318d:	56                   	push   %esi
+  80318e:	53                   	push   %ebx
+  80318f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803192:	8b 45 08             	mov    0x8(%ebp),%eax
+  803195:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  80319a:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  8031a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031a3:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8031a8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8031ad:	e8 72 fe ff ff       	call   803024 <nsipc>
+  8031b2:	89 c3                	mov    %eax,%ebx
+  8031b4:	85 c0                	test   %eax,%eax
+  8031b6:	78 22                	js     8031da <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8031b8:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8031bd:	39 c6                	cmp    %eax,%esi
+  8031bf:	0f 4e c6             	cmovle %esi,%eax
+  8031c2:	39 c3                	cmp    %eax,%ebx
+  8031c4:	7f 1d                	jg     8031e3 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8031c6:	83 ec 04             	sub    $0x4,%esp
+  8031c9:	53                   	push   %ebx
+  8031ca:	68 00 90 80 00       	push   $0x809000
+  8031cf:	ff 75 0c             	push   0xc(%ebp)
+  8031d2:	e8 0f d8 ff ff       	call   8009e6 <memmove>
+  8031d7:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8031da:	89 d8                	mov    %ebx,%eax
+  8031dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031df:	5b                   	pop    %ebx
+  8031e0:	5e                   	pop    %esi
+  8031e1:	5d                   	pop    %ebp
+  8031e2:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8031e3:	68 72 45 80 00       	push   $0x804572
+  8031e8:	68 60 44 80 00       	push   $0x804460
+  8031ed:	6a 62                	push   $0x62
+  8031ef:	68 87 45 80 00       	push   $0x804587
+  8031f4:	e8 9e cf ff ff       	call   800197 <_panic>
+
+008031f9 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8031f9:	55                   	push   %ebp
+  8031fa:	89 e5                	mov    %esp,%ebp
+  8031fc:	53                   	push   %ebx
+  8031fd:	83 ec 04             	sub    $0x4,%esp
+  803200:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803203:	8b 45 08             	mov    0x8(%ebp),%eax
+  803206:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  80320b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803211:	7f 2e                	jg     803241 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803213:	83 ec 04             	sub    $0x4,%esp
+  803216:	53                   	push   %ebx
+  803217:	ff 75 0c             	push   0xc(%ebp)
+  80321a:	68 0c 90 80 00       	push   $0x80900c
+  80321f:	e8 c2 d7 ff ff       	call   8009e6 <memmove>
+	nsipcbuf.send.req_size = size;
+  803224:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  80322a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80322d:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803232:	b8 08 00 00 00       	mov    $0x8,%eax
+  803237:	e8 e8 fd ff ff       	call   803024 <nsipc>
+}
+  80323c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80323f:	c9                   	leave
+  803240:	c3                   	ret
+	assert(size < 1600);
+  803241:	68 93 45 80 00       	push   $0x804593
+  803246:	68 60 44 80 00       	push   $0x804460
+  80324b:	6a 6d                	push   $0x6d
+  80324d:	68 87 45 80 00       	push   $0x804587
+  803252:	e8 40 cf ff ff       	call   800197 <_panic>
+
+00803257 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803257:	55                   	push   %ebp
+  803258:	89 e5                	mov    %esp,%ebp
+  80325a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80325d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803260:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  803265:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803268:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  80326d:	8b 45 10             	mov    0x10(%ebp),%eax
+  803270:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  803275:	b8 09 00 00 00       	mov    $0x9,%eax
+  80327a:	e8 a5 fd ff ff       	call   803024 <nsipc>
+}
+  80327f:	c9                   	leave
+  803280:	c3                   	ret
+
+00803281 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803281:	55                   	push   %ebp
+  803282:	89 e5                	mov    %esp,%ebp
+  803284:	56                   	push   %esi
+  803285:	53                   	push   %ebx
+  803286:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803289:	83 ec 0c             	sub    $0xc,%esp
+  80328c:	ff 75 08             	push   0x8(%ebp)
+  80328f:	e8 e9 dd ff ff       	call   80107d <fd2data>
+  803294:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803296:	83 c4 08             	add    $0x8,%esp
+  803299:	68 9f 45 80 00       	push   $0x80459f
+  80329e:	53                   	push   %ebx
+  80329f:	e8 bc d5 ff ff       	call   800860 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8032a4:	8b 46 04             	mov    0x4(%esi),%eax
+  8032a7:	2b 06                	sub    (%esi),%eax
+  8032a9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8032af:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8032b6:	00 00 00 
+	stat->st_dev = &devpipe;
+  8032b9:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  8032c0:	50 80 00 
+	return 0;
+}
+  8032c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032cb:	5b                   	pop    %ebx
+  8032cc:	5e                   	pop    %esi
+  8032cd:	5d                   	pop    %ebp
+  8032ce:	c3                   	ret
+
+008032cf <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8032cf:	55                   	push   %ebp
+  8032d0:	89 e5                	mov    %esp,%ebp
+  8032d2:	53                   	push   %ebx
+  8032d3:	83 ec 0c             	sub    $0xc,%esp
+  8032d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8032d9:	53                   	push   %ebx
+  8032da:	6a 00                	push   $0x0
+  8032dc:	e8 18 da ff ff       	call   800cf9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8032e1:	89 1c 24             	mov    %ebx,(%esp)
+  8032e4:	e8 94 dd ff ff       	call   80107d <fd2data>
+  8032e9:	83 c4 08             	add    $0x8,%esp
+  8032ec:	50                   	push   %eax
+  8032ed:	6a 00                	push   $0x0
+  8032ef:	e8 05 da ff ff       	call   800cf9 <sys_page_unmap>
+}
+  8032f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032f7:	c9                   	leave
+  8032f8:	c3                   	ret
+
+008032f9 <_pipeisclosed>:
+{
+  8032f9:	55                   	push   %ebp
+  8032fa:	89 e5                	mov    %esp,%ebp
+  8032fc:	57                   	push   %edi
+  8032fd:	56                   	push   %esi
+  8032fe:	53                   	push   %ebx
+  8032ff:	83 ec 1c             	sub    $0x1c,%esp
+  803302:	89 c7                	mov    %eax,%edi
+  803304:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  803306:	a1 00 60 80 00       	mov    0x806000,%eax
+  80330b:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80330e:	83 ec 0c             	sub    $0xc,%esp
+  803311:	57                   	push   %edi
+  803312:	e8 20 09 00 00       	call   803c37 <pageref>
+  803317:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80331a:	89 34 24             	mov    %esi,(%esp)
+  80331d:	e8 15 09 00 00       	call   803c37 <pageref>
+		nn = thisenv->env_runs;
+  803322:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803328:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80332b:	83 c4 10             	add    $0x10,%esp
+  80332e:	39 cb                	cmp    %ecx,%ebx
+  803330:	74 1b                	je     80334d <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  803332:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803335:	75 cf                	jne    803306 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803337:	8b 42 58             	mov    0x58(%edx),%eax
+  80333a:	6a 01                	push   $0x1
+  80333c:	50                   	push   %eax
+  80333d:	53                   	push   %ebx
+  80333e:	68 a6 45 80 00       	push   $0x8045a6
+  803343:	e8 2a cf ff ff       	call   800272 <cprintf>
+  803348:	83 c4 10             	add    $0x10,%esp
+  80334b:	eb b9                	jmp    803306 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80334d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803350:	0f 94 c0             	sete   %al
+  803353:	0f b6 c0             	movzbl %al,%eax
+}
+  803356:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803359:	5b                   	pop    %ebx
+  80335a:	5e                   	pop    %esi
+  80335b:	5f                   	pop    %edi
+  80335c:	5d                   	pop    %ebp
+  80335d:	c3                   	ret
+
+0080335e <devpipe_write>:
+{
+  80335e:	55                   	push   %ebp
+  80335f:	89 e5                	mov    %esp,%ebp
+  803361:	57                   	push   %edi
+  803362:	56                   	push   %esi
+  803363:	53                   	push   %ebx
+  803364:	83 ec 28             	sub    $0x28,%esp
+  803367:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80336a:	56                   	push   %esi
+  80336b:	e8 0d dd ff ff       	call   80107d <fd2data>
+  803370:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803372:	83 c4 10             	add    $0x10,%esp
+  803375:	bf 00 00 00 00       	mov    $0x0,%edi
+  80337a:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80337d:	75 09                	jne    803388 <devpipe_write+0x2a>
+	return i;
+  80337f:	89 f8                	mov    %edi,%eax
+  803381:	eb 23                	jmp    8033a6 <devpipe_write+0x48>
+			sys_yield();
+  803383:	e8 c5 d8 ff ff       	call   800c4d <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803388:	8b 43 04             	mov    0x4(%ebx),%eax
+  80338b:	8b 0b                	mov    (%ebx),%ecx
+  80338d:	8d 51 20             	lea    0x20(%ecx),%edx
+  803390:	39 d0                	cmp    %edx,%eax
+  803392:	72 1a                	jb     8033ae <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803394:	89 da                	mov    %ebx,%edx
+  803396:	89 f0                	mov    %esi,%eax
+  803398:	e8 5c ff ff ff       	call   8032f9 <_pipeisclosed>
+  80339d:	85 c0                	test   %eax,%eax
+  80339f:	74 e2                	je     803383 <devpipe_write+0x25>
+				return 0;
+  8033a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033a9:	5b                   	pop    %ebx
+  8033aa:	5e                   	pop    %esi
+  8033ab:	5f                   	pop    %edi
+  8033ac:	5d                   	pop    %ebp
+  8033ad:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8033ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8033b1:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8033b5:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8033b8:	89 c2                	mov    %eax,%edx
+  8033ba:	c1 fa 1f             	sar    $0x1f,%edx
+  8033bd:	89 d1                	mov    %edx,%ecx
+  8033bf:	c1 e9 1b             	shr    $0x1b,%ecx
+  8033c2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8033c5:	83 e2 1f             	and    $0x1f,%edx
+  8033c8:	29 ca                	sub    %ecx,%edx
+  8033ca:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8033ce:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8033d2:	83 c0 01             	add    $0x1,%eax
+  8033d5:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8033d8:	83 c7 01             	add    $0x1,%edi
+  8033db:	eb 9d                	jmp    80337a <devpipe_write+0x1c>
+
+008033dd <devpipe_read>:
+{
+  8033dd:	55                   	push   %ebp
+  8033de:	89 e5                	mov    %esp,%ebp
+  8033e0:	57                   	push   %edi
+  8033e1:	56                   	push   %esi
+  8033e2:	53                   	push   %ebx
+  8033e3:	83 ec 18             	sub    $0x18,%esp
+  8033e6:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8033e9:	57                   	push   %edi
+  8033ea:	e8 8e dc ff ff       	call   80107d <fd2data>
+  8033ef:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8033f1:	83 c4 10             	add    $0x10,%esp
+  8033f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8033f9:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8033fc:	75 13                	jne    803411 <devpipe_read+0x34>
+	return i;
+  8033fe:	89 f0                	mov    %esi,%eax
+  803400:	eb 02                	jmp    803404 <devpipe_read+0x27>
+				return i;
+  803402:	89 f0                	mov    %esi,%eax
+}
+  803404:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803407:	5b                   	pop    %ebx
+  803408:	5e                   	pop    %esi
+  803409:	5f                   	pop    %edi
+  80340a:	5d                   	pop    %ebp
+  80340b:	c3                   	ret
+			sys_yield();
+  80340c:	e8 3c d8 ff ff       	call   800c4d <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803411:	8b 03                	mov    (%ebx),%eax
+  803413:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803416:	75 18                	jne    803430 <devpipe_read+0x53>
+			if (i > 0)
+  803418:	85 f6                	test   %esi,%esi
+  80341a:	75 e6                	jne    803402 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80341c:	89 da                	mov    %ebx,%edx
+  80341e:	89 f8                	mov    %edi,%eax
+  803420:	e8 d4 fe ff ff       	call   8032f9 <_pipeisclosed>
+  803425:	85 c0                	test   %eax,%eax
+  803427:	74 e3                	je     80340c <devpipe_read+0x2f>
+				return 0;
+  803429:	b8 00 00 00 00       	mov    $0x0,%eax
+  80342e:	eb d4                	jmp    803404 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803430:	99                   	cltd
+  803431:	c1 ea 1b             	shr    $0x1b,%edx
+  803434:	01 d0                	add    %edx,%eax
+  803436:	83 e0 1f             	and    $0x1f,%eax
+  803439:	29 d0                	sub    %edx,%eax
+  80343b:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803440:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803443:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803446:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803449:	83 c6 01             	add    $0x1,%esi
+  80344c:	eb ab                	jmp    8033f9 <devpipe_read+0x1c>
+
+0080344e <pipe>:
+{
+  80344e:	55                   	push   %ebp
+  80344f:	89 e5                	mov    %esp,%ebp
+  803451:	56                   	push   %esi
+  803452:	53                   	push   %ebx
+  803453:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803456:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803459:	50                   	push   %eax
+  80345a:	e8 35 dc ff ff       	call   801094 <fd_alloc>
+  80345f:	89 c3                	mov    %eax,%ebx
+  803461:	83 c4 10             	add    $0x10,%esp
+  803464:	85 c0                	test   %eax,%eax
+  803466:	0f 88 23 01 00 00    	js     80358f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80346c:	83 ec 04             	sub    $0x4,%esp
+  80346f:	68 07 04 00 00       	push   $0x407
+  803474:	ff 75 f4             	push   -0xc(%ebp)
+  803477:	6a 00                	push   $0x0
+  803479:	e8 ee d7 ff ff       	call   800c6c <sys_page_alloc>
+  80347e:	89 c3                	mov    %eax,%ebx
+  803480:	83 c4 10             	add    $0x10,%esp
+  803483:	85 c0                	test   %eax,%eax
+  803485:	0f 88 04 01 00 00    	js     80358f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80348b:	83 ec 0c             	sub    $0xc,%esp
+  80348e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803491:	50                   	push   %eax
+  803492:	e8 fd db ff ff       	call   801094 <fd_alloc>
+  803497:	89 c3                	mov    %eax,%ebx
+  803499:	83 c4 10             	add    $0x10,%esp
+  80349c:	85 c0                	test   %eax,%eax
+  80349e:	0f 88 db 00 00 00    	js     80357f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8034a4:	83 ec 04             	sub    $0x4,%esp
+  8034a7:	68 07 04 00 00       	push   $0x407
+  8034ac:	ff 75 f0             	push   -0x10(%ebp)
+  8034af:	6a 00                	push   $0x0
+  8034b1:	e8 b6 d7 ff ff       	call   800c6c <sys_page_alloc>
+  8034b6:	89 c3                	mov    %eax,%ebx
+  8034b8:	83 c4 10             	add    $0x10,%esp
+  8034bb:	85 c0                	test   %eax,%eax
+  8034bd:	0f 88 bc 00 00 00    	js     80357f <pipe+0x131>
+	va = fd2data(fd0);
+  8034c3:	83 ec 0c             	sub    $0xc,%esp
+  8034c6:	ff 75 f4             	push   -0xc(%ebp)
+  8034c9:	e8 af db ff ff       	call   80107d <fd2data>
+  8034ce:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8034d0:	83 c4 0c             	add    $0xc,%esp
+  8034d3:	68 07 04 00 00       	push   $0x407
+  8034d8:	50                   	push   %eax
+  8034d9:	6a 00                	push   $0x0
+  8034db:	e8 8c d7 ff ff       	call   800c6c <sys_page_alloc>
+  8034e0:	89 c3                	mov    %eax,%ebx
+  8034e2:	83 c4 10             	add    $0x10,%esp
+  8034e5:	85 c0                	test   %eax,%eax
+  8034e7:	0f 88 82 00 00 00    	js     80356f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8034ed:	83 ec 0c             	sub    $0xc,%esp
+  8034f0:	ff 75 f0             	push   -0x10(%ebp)
+  8034f3:	e8 85 db ff ff       	call   80107d <fd2data>
+  8034f8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8034ff:	50                   	push   %eax
+  803500:	6a 00                	push   $0x0
+  803502:	56                   	push   %esi
+  803503:	6a 00                	push   $0x0
+  803505:	e8 ad d7 ff ff       	call   800cb7 <sys_page_map>
+  80350a:	89 c3                	mov    %eax,%ebx
+  80350c:	83 c4 20             	add    $0x20,%esp
+  80350f:	85 c0                	test   %eax,%eax
+  803511:	78 4e                	js     803561 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803513:	a1 60 50 80 00       	mov    0x805060,%eax
+  803518:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80351b:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80351d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803520:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803527:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80352a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80352c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80352f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803536:	83 ec 0c             	sub    $0xc,%esp
+  803539:	ff 75 f4             	push   -0xc(%ebp)
+  80353c:	e8 2c db ff ff       	call   80106d <fd2num>
+  803541:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803544:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803546:	83 c4 04             	add    $0x4,%esp
+  803549:	ff 75 f0             	push   -0x10(%ebp)
+  80354c:	e8 1c db ff ff       	call   80106d <fd2num>
+  803551:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803554:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803557:	83 c4 10             	add    $0x10,%esp
+  80355a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80355f:	eb 2e                	jmp    80358f <pipe+0x141>
+	sys_page_unmap(0, va);
+  803561:	83 ec 08             	sub    $0x8,%esp
+  803564:	56                   	push   %esi
+  803565:	6a 00                	push   $0x0
+  803567:	e8 8d d7 ff ff       	call   800cf9 <sys_page_unmap>
+  80356c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80356f:	83 ec 08             	sub    $0x8,%esp
+  803572:	ff 75 f0             	push   -0x10(%ebp)
+  803575:	6a 00                	push   $0x0
+  803577:	e8 7d d7 ff ff       	call   800cf9 <sys_page_unmap>
+  80357c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80357f:	83 ec 08             	sub    $0x8,%esp
+  803582:	ff 75 f4             	push   -0xc(%ebp)
+  803585:	6a 00                	push   $0x0
+  803587:	e8 6d d7 ff ff       	call   800cf9 <sys_page_unmap>
+  80358c:	83 c4 10             	add    $0x10,%esp
+}
+  80358f:	89 d8                	mov    %ebx,%eax
+  803591:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803594:	5b                   	pop    %ebx
+  803595:	5e                   	pop    %esi
+  803596:	5d                   	pop    %ebp
+  803597:	c3                   	ret
+
+00803598 <pipeisclosed>:
+{
+  803598:	55                   	push   %ebp
+  803599:	89 e5                	mov    %esp,%ebp
+  80359b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80359e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035a1:	50                   	push   %eax
+  8035a2:	ff 75 08             	push   0x8(%ebp)
+  8035a5:	e8 40 db ff ff       	call   8010ea <fd_lookup>
+  8035aa:	83 c4 10             	add    $0x10,%esp
+  8035ad:	85 c0                	test   %eax,%eax
+  8035af:	78 18                	js     8035c9 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8035b1:	83 ec 0c             	sub    $0xc,%esp
+  8035b4:	ff 75 f4             	push   -0xc(%ebp)
+  8035b7:	e8 c1 da ff ff       	call   80107d <fd2data>
+  8035bc:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8035be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035c1:	e8 33 fd ff ff       	call   8032f9 <_pipeisclosed>
+  8035c6:	83 c4 10             	add    $0x10,%esp
+}
+  8035c9:	c9                   	leave
+  8035ca:	c3                   	ret
+
+008035cb <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8035cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d0:	c3                   	ret
+
+008035d1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8035d1:	55                   	push   %ebp
+  8035d2:	89 e5                	mov    %esp,%ebp
+  8035d4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8035d7:	68 be 45 80 00       	push   $0x8045be
+  8035dc:	ff 75 0c             	push   0xc(%ebp)
+  8035df:	e8 7c d2 ff ff       	call   800860 <strcpy>
+	return 0;
+}
+  8035e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e9:	c9                   	leave
+  8035ea:	c3                   	ret
+
+008035eb <devcons_write>:
+{
+  8035eb:	55                   	push   %ebp
+  8035ec:	89 e5                	mov    %esp,%ebp
+  8035ee:	57                   	push   %edi
+  8035ef:	56                   	push   %esi
+  8035f0:	53                   	push   %ebx
+  8035f1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8035f7:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8035fc:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803602:	eb 2e                	jmp    803632 <devcons_write+0x47>
+		m = n - tot;
+  803604:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803607:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803609:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80360e:	39 c3                	cmp    %eax,%ebx
+  803610:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803613:	83 ec 04             	sub    $0x4,%esp
+  803616:	53                   	push   %ebx
+  803617:	89 f0                	mov    %esi,%eax
+  803619:	03 45 0c             	add    0xc(%ebp),%eax
+  80361c:	50                   	push   %eax
+  80361d:	57                   	push   %edi
+  80361e:	e8 c3 d3 ff ff       	call   8009e6 <memmove>
+		sys_cputs(buf, m);
+  803623:	83 c4 08             	add    $0x8,%esp
+  803626:	53                   	push   %ebx
+  803627:	57                   	push   %edi
+  803628:	e8 63 d5 ff ff       	call   800b90 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80362d:	01 de                	add    %ebx,%esi
+  80362f:	83 c4 10             	add    $0x10,%esp
+  803632:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803635:	72 cd                	jb     803604 <devcons_write+0x19>
+}
+  803637:	89 f0                	mov    %esi,%eax
+  803639:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80363c:	5b                   	pop    %ebx
+  80363d:	5e                   	pop    %esi
+  80363e:	5f                   	pop    %edi
+  80363f:	5d                   	pop    %ebp
+  803640:	c3                   	ret
+
+00803641 <devcons_read>:
+{
+  803641:	55                   	push   %ebp
+  803642:	89 e5                	mov    %esp,%ebp
+  803644:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803647:	b8 00 00 00 00       	mov    $0x0,%eax
+  80364c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803650:	75 07                	jne    803659 <devcons_read+0x18>
+  803652:	eb 1f                	jmp    803673 <devcons_read+0x32>
+		sys_yield();
+  803654:	e8 f4 d5 ff ff       	call   800c4d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803659:	e8 58 d5 ff ff       	call   800bb6 <sys_cgetc>
+  80365e:	85 c0                	test   %eax,%eax
+  803660:	74 f2                	je     803654 <devcons_read+0x13>
+	if (c < 0)
+  803662:	78 0f                	js     803673 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803664:	83 f8 04             	cmp    $0x4,%eax
+  803667:	74 0c                	je     803675 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803669:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80366c:	88 02                	mov    %al,(%edx)
+	return 1;
+  80366e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803673:	c9                   	leave
+  803674:	c3                   	ret
+		return 0;
+  803675:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367a:	eb f7                	jmp    803673 <devcons_read+0x32>
+
+0080367c <cputchar>:
+{
+  80367c:	55                   	push   %ebp
+  80367d:	89 e5                	mov    %esp,%ebp
+  80367f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803682:	8b 45 08             	mov    0x8(%ebp),%eax
+  803685:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803688:	6a 01                	push   $0x1
+  80368a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80368d:	50                   	push   %eax
+  80368e:	e8 fd d4 ff ff       	call   800b90 <sys_cputs>
+}
+  803693:	83 c4 10             	add    $0x10,%esp
+  803696:	c9                   	leave
+  803697:	c3                   	ret
+
+00803698 <getchar>:
+{
+  803698:	55                   	push   %ebp
+  803699:	89 e5                	mov    %esp,%ebp
+  80369b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80369e:	6a 01                	push   $0x1
+  8036a0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8036a3:	50                   	push   %eax
+  8036a4:	6a 00                	push   $0x0
+  8036a6:	e8 a5 dc ff ff       	call   801350 <read>
+	if (r < 0)
+  8036ab:	83 c4 10             	add    $0x10,%esp
+  8036ae:	85 c0                	test   %eax,%eax
+  8036b0:	78 06                	js     8036b8 <getchar+0x20>
+	if (r < 1)
+  8036b2:	74 06                	je     8036ba <getchar+0x22>
+	return c;
+  8036b4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8036b8:	c9                   	leave
+  8036b9:	c3                   	ret
+		return -E_EOF;
+  8036ba:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8036bf:	eb f7                	jmp    8036b8 <getchar+0x20>
+
+008036c1 <iscons>:
+{
+  8036c1:	55                   	push   %ebp
+  8036c2:	89 e5                	mov    %esp,%ebp
+  8036c4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8036c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8036ca:	50                   	push   %eax
+  8036cb:	ff 75 08             	push   0x8(%ebp)
+  8036ce:	e8 17 da ff ff       	call   8010ea <fd_lookup>
+  8036d3:	83 c4 10             	add    $0x10,%esp
+  8036d6:	85 c0                	test   %eax,%eax
+  8036d8:	78 11                	js     8036eb <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8036da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036dd:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8036e3:	39 10                	cmp    %edx,(%eax)
+  8036e5:	0f 94 c0             	sete   %al
+  8036e8:	0f b6 c0             	movzbl %al,%eax
+}
+  8036eb:	c9                   	leave
+  8036ec:	c3                   	ret
+
+008036ed <opencons>:
+{
+  8036ed:	55                   	push   %ebp
+  8036ee:	89 e5                	mov    %esp,%ebp
+  8036f0:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8036f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8036f6:	50                   	push   %eax
+  8036f7:	e8 98 d9 ff ff       	call   801094 <fd_alloc>
+  8036fc:	83 c4 10             	add    $0x10,%esp
+  8036ff:	85 c0                	test   %eax,%eax
+  803701:	78 3a                	js     80373d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803703:	83 ec 04             	sub    $0x4,%esp
+  803706:	68 07 04 00 00       	push   $0x407
+  80370b:	ff 75 f4             	push   -0xc(%ebp)
+  80370e:	6a 00                	push   $0x0
+  803710:	e8 57 d5 ff ff       	call   800c6c <sys_page_alloc>
+  803715:	83 c4 10             	add    $0x10,%esp
+  803718:	85 c0                	test   %eax,%eax
+  80371a:	78 21                	js     80373d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80371c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80371f:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803725:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803727:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80372a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803731:	83 ec 0c             	sub    $0xc,%esp
+  803734:	50                   	push   %eax
+  803735:	e8 33 d9 ff ff       	call   80106d <fd2num>
+  80373a:	83 c4 10             	add    $0x10,%esp
+}
+  80373d:	c9                   	leave
+  80373e:	c3                   	ret
+
+0080373f <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  80373f:	55                   	push   %ebp
+  803740:	89 e5                	mov    %esp,%ebp
+  803742:	57                   	push   %edi
+  803743:	56                   	push   %esi
+  803744:	53                   	push   %ebx
+  803745:	83 ec 20             	sub    $0x20,%esp
+  803748:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80374b:	89 d7                	mov    %edx,%edi
+  80374d:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  80374f:	51                   	push   %ecx
+  803750:	68 00 f0 7f 00       	push   $0x7ff000
+  803755:	6a 00                	push   $0x0
+  803757:	e8 10 d5 ff ff       	call   800c6c <sys_page_alloc>
+  80375c:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80375e:	83 c4 10             	add    $0x10,%esp
+  803761:	85 c0                	test   %eax,%eax
+  803763:	78 45                	js     8037aa <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  803765:	83 ec 04             	sub    $0x4,%esp
+  803768:	68 00 10 00 00       	push   $0x1000
+  80376d:	57                   	push   %edi
+  80376e:	68 00 f0 7f 00       	push   $0x7ff000
+  803773:	e8 6e d2 ff ff       	call   8009e6 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  803778:	89 34 24             	mov    %esi,(%esp)
+  80377b:	57                   	push   %edi
+  80377c:	ff 75 e4             	push   -0x1c(%ebp)
+  80377f:	68 00 f0 7f 00       	push   $0x7ff000
+  803784:	6a 00                	push   $0x0
+  803786:	e8 2c d5 ff ff       	call   800cb7 <sys_page_map>
+  80378b:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80378d:	83 c4 20             	add    $0x20,%esp
+  803790:	85 c0                	test   %eax,%eax
+  803792:	78 16                	js     8037aa <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803794:	83 ec 08             	sub    $0x8,%esp
+  803797:	68 00 f0 7f 00       	push   $0x7ff000
+  80379c:	6a 00                	push   $0x0
+  80379e:	e8 56 d5 ff ff       	call   800cf9 <sys_page_unmap>
+  8037a3:	83 c4 10             	add    $0x10,%esp
+  8037a6:	85 c0                	test   %eax,%eax
+  8037a8:	75 0a                	jne    8037b4 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8037aa:	89 d8                	mov    %ebx,%eax
+  8037ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037af:	5b                   	pop    %ebx
+  8037b0:	5e                   	pop    %esi
+  8037b1:	5f                   	pop    %edi
+  8037b2:	5d                   	pop    %ebp
+  8037b3:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8037b4:	68 cc 45 80 00       	push   $0x8045cc
+  8037b9:	68 60 44 80 00       	push   $0x804460
+  8037be:	6a 1b                	push   $0x1b
+  8037c0:	68 44 46 80 00       	push   $0x804644
+  8037c5:	e8 cd c9 ff ff       	call   800197 <_panic>
+
+008037ca <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8037ca:	55                   	push   %ebp
+  8037cb:	89 e5                	mov    %esp,%ebp
+  8037cd:	53                   	push   %ebx
+  8037ce:	83 ec 04             	sub    $0x4,%esp
+  8037d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8037d4:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8037d6:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  8037da:	74 21                	je     8037fd <pgfault+0x33>
+  8037dc:	89 d0                	mov    %edx,%eax
+  8037de:	c1 e8 16             	shr    $0x16,%eax
+  8037e1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8037e8:	a8 01                	test   $0x1,%al
+  8037ea:	74 11                	je     8037fd <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  8037ec:	89 d0                	mov    %edx,%eax
+  8037ee:	c1 e8 0c             	shr    $0xc,%eax
+  8037f1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8037f8:	f6 c4 08             	test   $0x8,%ah
+  8037fb:	75 17                	jne    803814 <pgfault+0x4a>
+		if (pgfault_next) {
+  8037fd:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  803802:	85 c0                	test   %eax,%eax
+  803804:	74 27                	je     80382d <pgfault+0x63>
+			pgfault_next(utf);
+  803806:	83 ec 0c             	sub    $0xc,%esp
+  803809:	53                   	push   %ebx
+  80380a:	ff d0                	call   *%eax
+			return;
+  80380c:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  80380f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803812:	c9                   	leave
+  803813:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803814:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80381a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80381f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803824:	e8 16 ff ff ff       	call   80373f <copy_page_to>
+  803829:	85 c0                	test   %eax,%eax
+  80382b:	79 e2                	jns    80380f <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  80382d:	a1 00 60 80 00       	mov    0x806000,%eax
+  803832:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803835:	ff 73 28             	push   0x28(%ebx)
+  803838:	ff 33                	push   (%ebx)
+  80383a:	50                   	push   %eax
+  80383b:	68 f0 45 80 00       	push   $0x8045f0
+  803840:	e8 2d ca ff ff       	call   800272 <cprintf>
+	sys_env_destroy(0);
+  803845:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80384c:	e8 8c d3 ff ff       	call   800bdd <sys_env_destroy>
+  803851:	83 c4 10             	add    $0x10,%esp
+  803854:	eb b9                	jmp    80380f <pgfault+0x45>
+
+00803856 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803856:	55                   	push   %ebp
+  803857:	89 e5                	mov    %esp,%ebp
+  803859:	53                   	push   %ebx
+  80385a:	83 ec 04             	sub    $0x4,%esp
+  80385d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803860:	a1 08 a0 80 00       	mov    0x80a008,%eax
+  803865:	3d ca 37 80 00       	cmp    $0x8037ca,%eax
+  80386a:	74 15                	je     803881 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80386c:	a3 04 a0 80 00       	mov    %eax,0x80a004
+		set_pgfault_handler(pgfault);
+  803871:	83 ec 0c             	sub    $0xc,%esp
+  803874:	68 ca 37 80 00       	push   $0x8037ca
+  803879:	e8 fb 03 00 00       	call   803c79 <set_pgfault_handler>
+  80387e:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803881:	83 ec 0c             	sub    $0xc,%esp
+  803884:	68 05 08 00 00       	push   $0x805
+  803889:	53                   	push   %ebx
+  80388a:	6a 00                	push   $0x0
+  80388c:	53                   	push   %ebx
+  80388d:	6a 00                	push   $0x0
+  80388f:	e8 23 d4 ff ff       	call   800cb7 <sys_page_map>
+}
+  803894:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803897:	c9                   	leave
+  803898:	c3                   	ret
+
+00803899 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803899:	55                   	push   %ebp
+  80389a:	89 e5                	mov    %esp,%ebp
+  80389c:	57                   	push   %edi
+  80389d:	56                   	push   %esi
+  80389e:	53                   	push   %ebx
+  80389f:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8038a2:	68 ca 37 80 00       	push   $0x8037ca
+  8038a7:	e8 cd 03 00 00       	call   803c79 <set_pgfault_handler>
+  8038ac:	b8 07 00 00 00       	mov    $0x7,%eax
+  8038b1:	cd 30                	int    $0x30
+  8038b3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8038b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8038b9:	83 c4 10             	add    $0x10,%esp
+  8038bc:	85 c0                	test   %eax,%eax
+  8038be:	0f 88 6b 01 00 00    	js     803a2f <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8038c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8038c9:	75 37                	jne    803902 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8038cb:	e8 56 d3 ff ff       	call   800c26 <sys_getenvid>
+  8038d0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8038d5:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8038db:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038e0:	a3 00 60 80 00       	mov    %eax,0x806000
+		return 0;
+  8038e5:	e9 45 01 00 00       	jmp    803a2f <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8038ea:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8038f0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8038f6:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8038fc:	0f 87 ba 00 00 00    	ja     8039bc <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803902:	89 d8                	mov    %ebx,%eax
+  803904:	c1 e8 16             	shr    $0x16,%eax
+  803907:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80390e:	a8 01                	test   $0x1,%al
+  803910:	74 d8                	je     8038ea <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803912:	89 d8                	mov    %ebx,%eax
+  803914:	c1 e8 0c             	shr    $0xc,%eax
+  803917:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80391e:	f6 c2 01             	test   $0x1,%dl
+  803921:	74 cd                	je     8038f0 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803923:	89 da                	mov    %ebx,%edx
+  803925:	80 e6 df             	and    $0xdf,%dh
+  803928:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  80392e:	74 c0                	je     8038f0 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803930:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803932:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803939:	f6 c6 04             	test   $0x4,%dh
+  80393c:	75 53                	jne    803991 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80393e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803945:	f6 c6 08             	test   $0x8,%dh
+  803948:	75 0c                	jne    803956 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80394a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803951:	f6 c2 02             	test   $0x2,%dl
+  803954:	74 3b                	je     803991 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803956:	83 ec 0c             	sub    $0xc,%esp
+  803959:	68 05 08 00 00       	push   $0x805
+  80395e:	57                   	push   %edi
+  80395f:	ff 75 e4             	push   -0x1c(%ebp)
+  803962:	57                   	push   %edi
+  803963:	6a 00                	push   $0x0
+  803965:	e8 4d d3 ff ff       	call   800cb7 <sys_page_map>
+  80396a:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80396c:	83 c4 20             	add    $0x20,%esp
+  80396f:	85 c0                	test   %eax,%eax
+  803971:	0f 88 a7 00 00 00    	js     803a1e <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803977:	83 ec 0c             	sub    $0xc,%esp
+  80397a:	68 05 08 00 00       	push   $0x805
+  80397f:	57                   	push   %edi
+  803980:	6a 00                	push   $0x0
+  803982:	57                   	push   %edi
+  803983:	6a 00                	push   $0x0
+  803985:	e8 2d d3 ff ff       	call   800cb7 <sys_page_map>
+  80398a:	89 c6                	mov    %eax,%esi
+	return r;
+  80398c:	83 c4 20             	add    $0x20,%esp
+  80398f:	eb 21                	jmp    8039b2 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803991:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803998:	83 ec 0c             	sub    $0xc,%esp
+  80399b:	25 07 0e 00 00       	and    $0xe07,%eax
+  8039a0:	50                   	push   %eax
+  8039a1:	57                   	push   %edi
+  8039a2:	ff 75 e4             	push   -0x1c(%ebp)
+  8039a5:	57                   	push   %edi
+  8039a6:	6a 00                	push   $0x0
+  8039a8:	e8 0a d3 ff ff       	call   800cb7 <sys_page_map>
+  8039ad:	89 c6                	mov    %eax,%esi
+  8039af:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8039b2:	85 f6                	test   %esi,%esi
+  8039b4:	0f 89 36 ff ff ff    	jns    8038f0 <fork+0x57>
+  8039ba:	eb 62                	jmp    803a1e <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8039bc:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8039c1:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8039c6:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8039c9:	89 f8                	mov    %edi,%eax
+  8039cb:	e8 6f fd ff ff       	call   80373f <copy_page_to>
+  8039d0:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8039d2:	85 c0                	test   %eax,%eax
+  8039d4:	78 48                	js     803a1e <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8039d6:	83 ec 04             	sub    $0x4,%esp
+  8039d9:	6a 07                	push   $0x7
+  8039db:	68 00 f0 bf ee       	push   $0xeebff000
+  8039e0:	57                   	push   %edi
+  8039e1:	e8 86 d2 ff ff       	call   800c6c <sys_page_alloc>
+  8039e6:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8039e8:	83 c4 10             	add    $0x10,%esp
+  8039eb:	85 c0                	test   %eax,%eax
+  8039ed:	78 2f                	js     803a1e <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8039ef:	a1 00 60 80 00       	mov    0x806000,%eax
+  8039f4:	8b 40 64             	mov    0x64(%eax),%eax
+  8039f7:	83 ec 08             	sub    $0x8,%esp
+  8039fa:	50                   	push   %eax
+  8039fb:	57                   	push   %edi
+  8039fc:	e8 d6 d3 ff ff       	call   800dd7 <sys_env_set_pgfault_upcall>
+  803a01:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803a03:	83 c4 10             	add    $0x10,%esp
+  803a06:	85 c0                	test   %eax,%eax
+  803a08:	78 14                	js     803a1e <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803a0a:	83 ec 08             	sub    $0x8,%esp
+  803a0d:	6a 02                	push   $0x2
+  803a0f:	57                   	push   %edi
+  803a10:	e8 2e d3 ff ff       	call   800d43 <sys_env_set_status>
+  803a15:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803a17:	83 c4 10             	add    $0x10,%esp
+  803a1a:	85 c0                	test   %eax,%eax
+  803a1c:	79 11                	jns    803a2f <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803a1e:	83 ec 0c             	sub    $0xc,%esp
+  803a21:	ff 75 e0             	push   -0x20(%ebp)
+  803a24:	e8 b4 d1 ff ff       	call   800bdd <sys_env_destroy>
+	return r;
+  803a29:	83 c4 10             	add    $0x10,%esp
+  803a2c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803a2f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803a32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a35:	5b                   	pop    %ebx
+  803a36:	5e                   	pop    %esi
+  803a37:	5f                   	pop    %edi
+  803a38:	5d                   	pop    %ebp
+  803a39:	c3                   	ret
+
+00803a3a <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803a3a:	55                   	push   %ebp
+  803a3b:	89 e5                	mov    %esp,%ebp
+  803a3d:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803a40:	68 4f 46 80 00       	push   $0x80464f
+  803a45:	68 bf 00 00 00       	push   $0xbf
+  803a4a:	68 44 46 80 00       	push   $0x804644
+  803a4f:	e8 43 c7 ff ff       	call   800197 <_panic>
+
+00803a54 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803a54:	55                   	push   %ebp
+  803a55:	89 e5                	mov    %esp,%ebp
+  803a57:	56                   	push   %esi
+  803a58:	53                   	push   %ebx
+  803a59:	8b 75 08             	mov    0x8(%ebp),%esi
+  803a5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803a5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803a62:	85 c0                	test   %eax,%eax
+  803a64:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803a69:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803a6c:	83 ec 0c             	sub    $0xc,%esp
+  803a6f:	50                   	push   %eax
+  803a70:	e8 3f d4 ff ff       	call   800eb4 <sys_ipc_recv>
+	if (from_env_store)
+  803a75:	83 c4 10             	add    $0x10,%esp
+  803a78:	85 f6                	test   %esi,%esi
+  803a7a:	74 14                	je     803a90 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803a7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a81:	85 c0                	test   %eax,%eax
+  803a83:	75 09                	jne    803a8e <ipc_recv+0x3a>
+  803a85:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803a8b:	8b 52 74             	mov    0x74(%edx),%edx
+  803a8e:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803a90:	85 db                	test   %ebx,%ebx
+  803a92:	74 25                	je     803ab9 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803a94:	85 c0                	test   %eax,%eax
+  803a96:	74 0d                	je     803aa5 <ipc_recv+0x51>
+  803a98:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803a9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803aa1:	5b                   	pop    %ebx
+  803aa2:	5e                   	pop    %esi
+  803aa3:	5d                   	pop    %ebp
+  803aa4:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803aa5:	a1 00 60 80 00       	mov    0x806000,%eax
+  803aaa:	8b 40 78             	mov    0x78(%eax),%eax
+  803aad:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803aaf:	a1 00 60 80 00       	mov    0x806000,%eax
+  803ab4:	8b 40 70             	mov    0x70(%eax),%eax
+  803ab7:	eb e5                	jmp    803a9e <ipc_recv+0x4a>
+  803ab9:	85 c0                	test   %eax,%eax
+  803abb:	75 e1                	jne    803a9e <ipc_recv+0x4a>
+  803abd:	eb f0                	jmp    803aaf <ipc_recv+0x5b>
+
+00803abf <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803abf:	55                   	push   %ebp
+  803ac0:	89 e5                	mov    %esp,%ebp
+  803ac2:	57                   	push   %edi
+  803ac3:	56                   	push   %esi
+  803ac4:	53                   	push   %ebx
+  803ac5:	83 ec 0c             	sub    $0xc,%esp
+  803ac8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803acb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803ace:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803ad1:	85 db                	test   %ebx,%ebx
+  803ad3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803ad8:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803adb:	ff 75 14             	push   0x14(%ebp)
+  803ade:	53                   	push   %ebx
+  803adf:	56                   	push   %esi
+  803ae0:	57                   	push   %edi
+  803ae1:	e8 3b d3 ff ff       	call   800e21 <sys_ipc_try_send>
+  803ae6:	83 c4 10             	add    $0x10,%esp
+  803ae9:	85 c0                	test   %eax,%eax
+  803aeb:	74 22                	je     803b0f <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803aed:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803af0:	75 07                	jne    803af9 <ipc_send+0x3a>
+		sys_yield();
+  803af2:	e8 56 d1 ff ff       	call   800c4d <sys_yield>
+  803af7:	eb e2                	jmp    803adb <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803af9:	68 65 46 80 00       	push   $0x804665
+  803afe:	68 60 44 80 00       	push   $0x804460
+  803b03:	6a 39                	push   $0x39
+  803b05:	68 7a 46 80 00       	push   $0x80467a
+  803b0a:	e8 88 c6 ff ff       	call   800197 <_panic>
+	}
+}
+  803b0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b12:	5b                   	pop    %ebx
+  803b13:	5e                   	pop    %esi
+  803b14:	5f                   	pop    %edi
+  803b15:	5d                   	pop    %ebp
+  803b16:	c3                   	ret
+
+00803b17 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803b17:	55                   	push   %ebp
+  803b18:	89 e5                	mov    %esp,%ebp
+  803b1a:	57                   	push   %edi
+  803b1b:	56                   	push   %esi
+  803b1c:	53                   	push   %ebx
+  803b1d:	83 ec 10             	sub    $0x10,%esp
+  803b20:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803b23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803b26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803b29:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803b2c:	85 c0                	test   %eax,%eax
+  803b2e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803b33:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803b36:	6a 00                	push   $0x0
+  803b38:	ff 33                	push   (%ebx)
+  803b3a:	50                   	push   %eax
+  803b3b:	e8 31 d3 ff ff       	call   800e71 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803b40:	83 c4 10             	add    $0x10,%esp
+  803b43:	85 c0                	test   %eax,%eax
+  803b45:	75 3c                	jne    803b83 <ipc_recvv+0x6c>
+  803b47:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803b4d:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803b50:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803b52:	85 ff                	test   %edi,%edi
+  803b54:	74 4e                	je     803ba4 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803b56:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803b5c:	8b 52 74             	mov    0x74(%edx),%edx
+  803b5f:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803b61:	85 f6                	test   %esi,%esi
+  803b63:	74 18                	je     803b7d <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803b65:	85 c0                	test   %eax,%eax
+  803b67:	75 2d                	jne    803b96 <ipc_recvv+0x7f>
+  803b69:	a1 00 60 80 00       	mov    0x806000,%eax
+  803b6e:	8b 40 78             	mov    0x78(%eax),%eax
+  803b71:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803b73:	a1 00 60 80 00       	mov    0x806000,%eax
+  803b78:	8b 40 70             	mov    0x70(%eax),%eax
+  803b7b:	eb 1f                	jmp    803b9c <ipc_recvv+0x85>
+  803b7d:	85 c0                	test   %eax,%eax
+  803b7f:	75 1b                	jne    803b9c <ipc_recvv+0x85>
+  803b81:	eb f0                	jmp    803b73 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803b83:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803b89:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803b8e:	85 ff                	test   %edi,%edi
+  803b90:	75 cd                	jne    803b5f <ipc_recvv+0x48>
+	if (perm_store)
+  803b92:	85 f6                	test   %esi,%esi
+  803b94:	74 e7                	je     803b7d <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803b96:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803b9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b9f:	5b                   	pop    %ebx
+  803ba0:	5e                   	pop    %esi
+  803ba1:	5f                   	pop    %edi
+  803ba2:	5d                   	pop    %ebp
+  803ba3:	c3                   	ret
+	if (perm_store)
+  803ba4:	85 f6                	test   %esi,%esi
+  803ba6:	75 bd                	jne    803b65 <ipc_recvv+0x4e>
+  803ba8:	eb c9                	jmp    803b73 <ipc_recvv+0x5c>
+
+00803baa <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803baa:	55                   	push   %ebp
+  803bab:	89 e5                	mov    %esp,%ebp
+  803bad:	57                   	push   %edi
+  803bae:	56                   	push   %esi
+  803baf:	53                   	push   %ebx
+  803bb0:	83 ec 0c             	sub    $0xc,%esp
+  803bb3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803bb6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803bb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  803bbc:	ff 75 14             	push   0x14(%ebp)
+  803bbf:	53                   	push   %ebx
+  803bc0:	56                   	push   %esi
+  803bc1:	57                   	push   %edi
+  803bc2:	e8 82 d2 ff ff       	call   800e49 <sys_ipc_try_sendv>
+  803bc7:	83 c4 10             	add    $0x10,%esp
+  803bca:	85 c0                	test   %eax,%eax
+  803bcc:	74 22                	je     803bf0 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803bce:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803bd1:	75 07                	jne    803bda <ipc_sendv+0x30>
+		sys_yield();
+  803bd3:	e8 75 d0 ff ff       	call   800c4d <sys_yield>
+  803bd8:	eb e2                	jmp    803bbc <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803bda:	68 65 46 80 00       	push   $0x804665
+  803bdf:	68 60 44 80 00       	push   $0x804460
+  803be4:	6a 5c                	push   $0x5c
+  803be6:	68 7a 46 80 00       	push   $0x80467a
+  803beb:	e8 a7 c5 ff ff       	call   800197 <_panic>
+	}
+}
+  803bf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bf3:	5b                   	pop    %ebx
+  803bf4:	5e                   	pop    %esi
+  803bf5:	5f                   	pop    %edi
+  803bf6:	5d                   	pop    %ebp
+  803bf7:	c3                   	ret
+
+00803bf8 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803bf8:	55                   	push   %ebp
+  803bf9:	89 e5                	mov    %esp,%ebp
+  803bfb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803c03:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803c09:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803c0f:	8b 52 50             	mov    0x50(%edx),%edx
+  803c12:	39 ca                	cmp    %ecx,%edx
+  803c14:	74 11                	je     803c27 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803c16:	83 c0 01             	add    $0x1,%eax
+  803c19:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803c1e:	75 e3                	jne    803c03 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803c20:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c25:	eb 0e                	jmp    803c35 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803c27:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803c2d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803c32:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803c35:	5d                   	pop    %ebp
+  803c36:	c3                   	ret
+
+00803c37 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803c37:	55                   	push   %ebp
+  803c38:	89 e5                	mov    %esp,%ebp
+  803c3a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803c3d:	89 c2                	mov    %eax,%edx
+  803c3f:	c1 ea 16             	shr    $0x16,%edx
+  803c42:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803c49:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803c4e:	f6 c1 01             	test   $0x1,%cl
+  803c51:	74 22                	je     803c75 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803c53:	c1 e8 0c             	shr    $0xc,%eax
+  803c56:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803c5d:	a8 01                	test   $0x1,%al
+  803c5f:	74 14                	je     803c75 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803c61:	c1 e8 0c             	shr    $0xc,%eax
+  803c64:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803c67:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803c6e:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803c72:	0f b7 d2             	movzwl %dx,%edx
+}
+  803c75:	89 d0                	mov    %edx,%eax
+  803c77:	5d                   	pop    %ebp
+  803c78:	c3                   	ret
+
+00803c79 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803c79:	55                   	push   %ebp
+  803c7a:	89 e5                	mov    %esp,%ebp
+  803c7c:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803c7f:	83 3d 08 a0 80 00 00 	cmpl   $0x0,0x80a008
+  803c86:	74 0a                	je     803c92 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803c88:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c8b:	a3 08 a0 80 00       	mov    %eax,0x80a008
+}
+  803c90:	c9                   	leave
+  803c91:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803c92:	83 ec 04             	sub    $0x4,%esp
+  803c95:	6a 07                	push   $0x7
+  803c97:	68 00 f0 bf ee       	push   $0xeebff000
+  803c9c:	6a 00                	push   $0x0
+  803c9e:	e8 c9 cf ff ff       	call   800c6c <sys_page_alloc>
+  803ca3:	83 c4 10             	add    $0x10,%esp
+  803ca6:	85 c0                	test   %eax,%eax
+  803ca8:	75 2c                	jne    803cd6 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803caa:	83 ec 08             	sub    $0x8,%esp
+  803cad:	68 ec 3c 80 00       	push   $0x803cec
+  803cb2:	6a 00                	push   $0x0
+  803cb4:	e8 1e d1 ff ff       	call   800dd7 <sys_env_set_pgfault_upcall>
+  803cb9:	83 c4 10             	add    $0x10,%esp
+  803cbc:	85 c0                	test   %eax,%eax
+  803cbe:	74 c8                	je     803c88 <set_pgfault_handler+0xf>
+  803cc0:	68 cc 46 80 00       	push   $0x8046cc
+  803cc5:	68 60 44 80 00       	push   $0x804460
+  803cca:	6a 20                	push   $0x20
+  803ccc:	68 fc 46 80 00       	push   $0x8046fc
+  803cd1:	e8 c1 c4 ff ff       	call   800197 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803cd6:	68 84 46 80 00       	push   $0x804684
+  803cdb:	68 60 44 80 00       	push   $0x804460
+  803ce0:	6a 1e                	push   $0x1e
+  803ce2:	68 fc 46 80 00       	push   $0x8046fc
+  803ce7:	e8 ab c4 ff ff       	call   800197 <_panic>
+
+00803cec <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803cec:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803ced:	a1 08 a0 80 00       	mov    0x80a008,%eax
+	call *%eax
+  803cf2:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803cf4:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803cf7:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803cfc:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803d01:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803d05:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803d08:	83 c4 08             	add    $0x8,%esp
+	popal
+  803d0b:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803d0c:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803d0f:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803d10:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803d11:	c3                   	ret
+
+00803d12 <dm>:
+  803d12:	55                   	push   %ebp
+  803d13:	57                   	push   %edi
+  803d14:	56                   	push   %esi
+  803d15:	53                   	push   %ebx
+  803d16:	83 ec 24             	sub    $0x24,%esp
+  803d19:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803d1d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803d21:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803d25:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803d29:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803d2d:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803d31:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803d35:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803d3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d44:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803d4b:	00 
+  803d4c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803d53:	00 
+  803d54:	89 fb                	mov    %edi,%ebx
+  803d56:	eb 08                	jmp    803d60 <dm+0x4e>
+  803d58:	83 e9 01             	sub    $0x1,%ecx
+  803d5b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803d5e:	74 68                	je     803dc8 <dm+0xb6>
+  803d60:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803d64:	01 c0                	add    %eax,%eax
+  803d66:	89 c6                	mov    %eax,%esi
+  803d68:	89 d7                	mov    %edx,%edi
+  803d6a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803d6e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803d72:	0f ad d0             	shrd   %cl,%edx,%eax
+  803d75:	d3 ea                	shr    %cl,%edx
+  803d77:	f6 c1 20             	test   $0x20,%cl
+  803d7a:	74 04                	je     803d80 <dm+0x6e>
+  803d7c:	89 d0                	mov    %edx,%eax
+  803d7e:	31 d2                	xor    %edx,%edx
+  803d80:	83 e0 01             	and    $0x1,%eax
+  803d83:	89 04 24             	mov    %eax,(%esp)
+  803d86:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803d8d:	00 
+  803d8e:	8b 04 24             	mov    (%esp),%eax
+  803d91:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803d95:	09 f0                	or     %esi,%eax
+  803d97:	09 fa                	or     %edi,%edx
+  803d99:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803d9d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803da1:	39 f0                	cmp    %esi,%eax
+  803da3:	89 d5                	mov    %edx,%ebp
+  803da5:	19 fd                	sbb    %edi,%ebp
+  803da7:	72 af                	jb     803d58 <dm+0x46>
+  803da9:	29 f0                	sub    %esi,%eax
+  803dab:	19 fa                	sbb    %edi,%edx
+  803dad:	89 cf                	mov    %ecx,%edi
+  803daf:	c1 ef 05             	shr    $0x5,%edi
+  803db2:	83 e7 01             	and    $0x1,%edi
+  803db5:	89 fe                	mov    %edi,%esi
+  803db7:	83 f6 01             	xor    $0x1,%esi
+  803dba:	d3 e6                	shl    %cl,%esi
+  803dbc:	d3 e7                	shl    %cl,%edi
+  803dbe:	09 74 24 18          	or     %esi,0x18(%esp)
+  803dc2:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803dc6:	eb 90                	jmp    803d58 <dm+0x46>
+  803dc8:	85 db                	test   %ebx,%ebx
+  803dca:	74 05                	je     803dd1 <dm+0xbf>
+  803dcc:	89 03                	mov    %eax,(%ebx)
+  803dce:	89 53 04             	mov    %edx,0x4(%ebx)
+  803dd1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803dd5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803dd9:	83 c4 24             	add    $0x24,%esp
+  803ddc:	5b                   	pop    %ebx
+  803ddd:	5e                   	pop    %esi
+  803dde:	5f                   	pop    %edi
+  803ddf:	5d                   	pop    %ebp
+  803de0:	c3                   	ret
+
+00803de1 <__udivdi3>:
+  803de1:	83 ec 08             	sub    $0x8,%esp
+  803de4:	6a 00                	push   $0x0
+  803de6:	ff 74 24 1c          	push   0x1c(%esp)
+  803dea:	ff 74 24 1c          	push   0x1c(%esp)
+  803dee:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803df2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803df6:	e8 17 ff ff ff       	call   803d12 <dm>
+  803dfb:	83 c4 14             	add    $0x14,%esp
+  803dfe:	c3                   	ret
+
+00803dff <__umoddi3>:
+  803dff:	83 ec 18             	sub    $0x18,%esp
+  803e02:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803e06:	50                   	push   %eax
+  803e07:	ff 74 24 2c          	push   0x2c(%esp)
+  803e0b:	ff 74 24 2c          	push   0x2c(%esp)
+  803e0f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803e13:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803e17:	e8 f6 fe ff ff       	call   803d12 <dm>
+  803e1c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803e20:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803e24:	83 c4 24             	add    $0x24,%esp
+  803e27:	c3                   	ret
+
+00803e28 <__divdi3>:
+  803e28:	53                   	push   %ebx
+  803e29:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803e2d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803e31:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803e35:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803e39:	85 d2                	test   %edx,%edx
+  803e3b:	78 15                	js     803e52 <__divdi3+0x2a>
+  803e3d:	85 db                	test   %ebx,%ebx
+  803e3f:	78 34                	js     803e75 <__divdi3+0x4d>
+  803e41:	83 ec 04             	sub    $0x4,%esp
+  803e44:	6a 00                	push   $0x0
+  803e46:	53                   	push   %ebx
+  803e47:	51                   	push   %ecx
+  803e48:	e8 c5 fe ff ff       	call   803d12 <dm>
+  803e4d:	83 c4 10             	add    $0x10,%esp
+  803e50:	eb 21                	jmp    803e73 <__divdi3+0x4b>
+  803e52:	f7 d8                	neg    %eax
+  803e54:	83 d2 00             	adc    $0x0,%edx
+  803e57:	f7 da                	neg    %edx
+  803e59:	85 db                	test   %ebx,%ebx
+  803e5b:	78 30                	js     803e8d <__divdi3+0x65>
+  803e5d:	83 ec 04             	sub    $0x4,%esp
+  803e60:	6a 00                	push   $0x0
+  803e62:	53                   	push   %ebx
+  803e63:	51                   	push   %ecx
+  803e64:	e8 a9 fe ff ff       	call   803d12 <dm>
+  803e69:	83 c4 10             	add    $0x10,%esp
+  803e6c:	f7 d8                	neg    %eax
+  803e6e:	83 d2 00             	adc    $0x0,%edx
+  803e71:	f7 da                	neg    %edx
+  803e73:	5b                   	pop    %ebx
+  803e74:	c3                   	ret
+  803e75:	83 ec 04             	sub    $0x4,%esp
+  803e78:	6a 00                	push   $0x0
+  803e7a:	f7 d9                	neg    %ecx
+  803e7c:	83 d3 00             	adc    $0x0,%ebx
+  803e7f:	f7 db                	neg    %ebx
+  803e81:	53                   	push   %ebx
+  803e82:	51                   	push   %ecx
+  803e83:	e8 8a fe ff ff       	call   803d12 <dm>
+  803e88:	83 c4 10             	add    $0x10,%esp
+  803e8b:	eb df                	jmp    803e6c <__divdi3+0x44>
+  803e8d:	83 ec 04             	sub    $0x4,%esp
+  803e90:	6a 00                	push   $0x0
+  803e92:	f7 d9                	neg    %ecx
+  803e94:	83 d3 00             	adc    $0x0,%ebx
+  803e97:	f7 db                	neg    %ebx
+  803e99:	53                   	push   %ebx
+  803e9a:	51                   	push   %ecx
+  803e9b:	e8 72 fe ff ff       	call   803d12 <dm>
+  803ea0:	83 c4 10             	add    $0x10,%esp
+  803ea3:	eb ce                	jmp    803e73 <__divdi3+0x4b>
+
+00803ea5 <__moddi3>:
+  803ea5:	55                   	push   %ebp
+  803ea6:	57                   	push   %edi
+  803ea7:	56                   	push   %esi
+  803ea8:	53                   	push   %ebx
+  803ea9:	83 ec 24             	sub    $0x24,%esp
+  803eac:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803eb0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803eb4:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803eb8:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803ebc:	85 d2                	test   %edx,%edx
+  803ebe:	78 3b                	js     803efb <__moddi3+0x56>
+  803ec0:	83 ec 04             	sub    $0x4,%esp
+  803ec3:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803ec7:	56                   	push   %esi
+  803ec8:	89 ce                	mov    %ecx,%esi
+  803eca:	f7 de                	neg    %esi
+  803ecc:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803ed0:	89 de                	mov    %ebx,%esi
+  803ed2:	83 d6 00             	adc    $0x0,%esi
+  803ed5:	f7 de                	neg    %esi
+  803ed7:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803edb:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803edf:	0f 48 f1             	cmovs  %ecx,%esi
+  803ee2:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803ee7:	53                   	push   %ebx
+  803ee8:	56                   	push   %esi
+  803ee9:	e8 24 fe ff ff       	call   803d12 <dm>
+  803eee:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803ef2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803ef6:	83 c4 10             	add    $0x10,%esp
+  803ef9:	eb 47                	jmp    803f42 <__moddi3+0x9d>
+  803efb:	f7 d8                	neg    %eax
+  803efd:	83 d2 00             	adc    $0x0,%edx
+  803f00:	f7 da                	neg    %edx
+  803f02:	83 ec 04             	sub    $0x4,%esp
+  803f05:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803f09:	56                   	push   %esi
+  803f0a:	89 cf                	mov    %ecx,%edi
+  803f0c:	f7 df                	neg    %edi
+  803f0e:	89 de                	mov    %ebx,%esi
+  803f10:	83 d6 00             	adc    $0x0,%esi
+  803f13:	f7 de                	neg    %esi
+  803f15:	0f 49 cf             	cmovns %edi,%ecx
+  803f18:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803f1c:	0f 49 de             	cmovns %esi,%ebx
+  803f1f:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803f23:	ff 74 24 0c          	push   0xc(%esp)
+  803f27:	ff 74 24 0c          	push   0xc(%esp)
+  803f2b:	e8 e2 fd ff ff       	call   803d12 <dm>
+  803f30:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803f34:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803f38:	f7 d8                	neg    %eax
+  803f3a:	83 d2 00             	adc    $0x0,%edx
+  803f3d:	f7 da                	neg    %edx
+  803f3f:	83 c4 10             	add    $0x10,%esp
+  803f42:	83 c4 24             	add    $0x24,%esp
+  803f45:	5b                   	pop    %ebx
+  803f46:	5e                   	pop    %esi
+  803f47:	5f                   	pop    %edi
+  803f48:	5d                   	pop    %ebp
+  803f49:	c3                   	ret
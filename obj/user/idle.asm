@@ -0,0 +1,7632 @@
+
+obj/user/idle.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 19 00 00 00       	call   80004a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+	binaryname = "idle";
+  800039:	c7 05 00 40 80 00 60 	movl   $0x803760,0x804000
+  800040:	37 80 00 
+	// Instead of busy-waiting like this,
+	// a better way would be to use the processor's HLT instruction
+	// to cause the processor to stop executing until the next interrupt -
+	// doing so allows the processor to conserve power more effectively.
+	while (1) {
+		sys_yield();
+  800043:	e8 22 01 00 00       	call   80016a <sys_yield>
+	while (1) {
+  800048:	eb f9                	jmp    800043 <umain+0x10>
+
+0080004a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004a:	55                   	push   %ebp
+  80004b:	89 e5                	mov    %esp,%ebp
+  80004d:	56                   	push   %esi
+  80004e:	53                   	push   %ebx
+  80004f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800052:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800055:	e8 e9 00 00 00       	call   800143 <sys_getenvid>
+  80005a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005f:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800065:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006a:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80006f:	85 db                	test   %ebx,%ebx
+  800071:	7e 07                	jle    80007a <libmain+0x30>
+		binaryname = argv[0];
+  800073:	8b 06                	mov    (%esi),%eax
+  800075:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80007a:	83 ec 08             	sub    $0x8,%esp
+  80007d:	56                   	push   %esi
+  80007e:	53                   	push   %ebx
+  80007f:	e8 af ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800084:	e8 0a 00 00 00       	call   800093 <exit>
+}
+  800089:	83 c4 10             	add    $0x10,%esp
+  80008c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008f:	5b                   	pop    %ebx
+  800090:	5e                   	pop    %esi
+  800091:	5d                   	pop    %ebp
+  800092:	c3                   	ret
+
+00800093 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800093:	55                   	push   %ebp
+  800094:	89 e5                	mov    %esp,%ebp
+  800096:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800099:	e8 c0 06 00 00       	call   80075e <close_all>
+	sys_env_destroy(0);
+  80009e:	83 ec 0c             	sub    $0xc,%esp
+  8000a1:	6a 00                	push   $0x0
+  8000a3:	e8 52 00 00 00       	call   8000fa <sys_env_destroy>
+}
+  8000a8:	83 c4 10             	add    $0x10,%esp
+  8000ab:	c9                   	leave
+  8000ac:	c3                   	ret
+
+008000ad <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000ad:	55                   	push   %ebp
+  8000ae:	89 e5                	mov    %esp,%ebp
+  8000b0:	57                   	push   %edi
+  8000b1:	56                   	push   %esi
+  8000b2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000be:	89 c3                	mov    %eax,%ebx
+  8000c0:	89 c7                	mov    %eax,%edi
+  8000c2:	55                   	push   %ebp
+  8000c3:	89 e5                	mov    %esp,%ebp
+  8000c5:	8d 35 cd 00 80 00    	lea    0x8000cd,%esi
+  8000cb:	0f 34                	sysenter
+  8000cd:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  8000ce:	5b                   	pop    %ebx
+  8000cf:	5e                   	pop    %esi
+  8000d0:	5f                   	pop    %edi
+  8000d1:	5d                   	pop    %ebp
+  8000d2:	c3                   	ret
+
+008000d3 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000d3:	55                   	push   %ebp
+  8000d4:	89 e5                	mov    %esp,%ebp
+  8000d6:	57                   	push   %edi
+  8000d7:	56                   	push   %esi
+  8000d8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000de:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000e3:	89 d1                	mov    %edx,%ecx
+  8000e5:	89 d3                	mov    %edx,%ebx
+  8000e7:	89 d7                	mov    %edx,%edi
+  8000e9:	55                   	push   %ebp
+  8000ea:	89 e5                	mov    %esp,%ebp
+  8000ec:	8d 35 f4 00 80 00    	lea    0x8000f4,%esi
+  8000f2:	0f 34                	sysenter
+  8000f4:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  8000f5:	5b                   	pop    %ebx
+  8000f6:	5e                   	pop    %esi
+  8000f7:	5f                   	pop    %edi
+  8000f8:	5d                   	pop    %ebp
+  8000f9:	c3                   	ret
+
+008000fa <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000fa:	55                   	push   %ebp
+  8000fb:	89 e5                	mov    %esp,%ebp
+  8000fd:	57                   	push   %edi
+  8000fe:	56                   	push   %esi
+  8000ff:	53                   	push   %ebx
+  800100:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800103:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800108:	8b 55 08             	mov    0x8(%ebp),%edx
+  80010b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800110:	89 cb                	mov    %ecx,%ebx
+  800112:	89 cf                	mov    %ecx,%edi
+  800114:	55                   	push   %ebp
+  800115:	89 e5                	mov    %esp,%ebp
+  800117:	8d 35 1f 01 80 00    	lea    0x80011f,%esi
+  80011d:	0f 34                	sysenter
+  80011f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800120:	85 c0                	test   %eax,%eax
+  800122:	7f 08                	jg     80012c <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800124:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800127:	5b                   	pop    %ebx
+  800128:	5e                   	pop    %esi
+  800129:	5f                   	pop    %edi
+  80012a:	5d                   	pop    %ebp
+  80012b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80012c:	83 ec 0c             	sub    $0xc,%esp
+  80012f:	50                   	push   %eax
+  800130:	6a 03                	push   $0x3
+  800132:	68 6f 37 80 00       	push   $0x80376f
+  800137:	6a 3d                	push   $0x3d
+  800139:	68 8c 37 80 00       	push   $0x80378c
+  80013e:	e8 02 24 00 00       	call   802545 <_panic>
+
+00800143 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800143:	55                   	push   %ebp
+  800144:	89 e5                	mov    %esp,%ebp
+  800146:	57                   	push   %edi
+  800147:	56                   	push   %esi
+  800148:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800149:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800153:	89 d1                	mov    %edx,%ecx
+  800155:	89 d3                	mov    %edx,%ebx
+  800157:	89 d7                	mov    %edx,%edi
+  800159:	55                   	push   %ebp
+  80015a:	89 e5                	mov    %esp,%ebp
+  80015c:	8d 35 64 01 80 00    	lea    0x800164,%esi
+  800162:	0f 34                	sysenter
+  800164:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800165:	5b                   	pop    %ebx
+  800166:	5e                   	pop    %esi
+  800167:	5f                   	pop    %edi
+  800168:	5d                   	pop    %ebp
+  800169:	c3                   	ret
+
+0080016a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80016a:	55                   	push   %ebp
+  80016b:	89 e5                	mov    %esp,%ebp
+  80016d:	57                   	push   %edi
+  80016e:	56                   	push   %esi
+  80016f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800170:	ba 00 00 00 00       	mov    $0x0,%edx
+  800175:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80017a:	89 d1                	mov    %edx,%ecx
+  80017c:	89 d3                	mov    %edx,%ebx
+  80017e:	89 d7                	mov    %edx,%edi
+  800180:	89 d6                	mov    %edx,%esi
+  800182:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800184:	5b                   	pop    %ebx
+  800185:	5e                   	pop    %esi
+  800186:	5f                   	pop    %edi
+  800187:	5d                   	pop    %ebp
+  800188:	c3                   	ret
+
+00800189 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800189:	55                   	push   %ebp
+  80018a:	89 e5                	mov    %esp,%ebp
+  80018c:	57                   	push   %edi
+  80018d:	56                   	push   %esi
+  80018e:	53                   	push   %ebx
+  80018f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800192:	8b 55 08             	mov    0x8(%ebp),%edx
+  800195:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800198:	b8 04 00 00 00       	mov    $0x4,%eax
+  80019d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001a5:	55                   	push   %ebp
+  8001a6:	89 e5                	mov    %esp,%ebp
+  8001a8:	8d 35 b0 01 80 00    	lea    0x8001b0,%esi
+  8001ae:	0f 34                	sysenter
+  8001b0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8001b1:	85 c0                	test   %eax,%eax
+  8001b3:	7f 08                	jg     8001bd <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  8001b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001b8:	5b                   	pop    %ebx
+  8001b9:	5e                   	pop    %esi
+  8001ba:	5f                   	pop    %edi
+  8001bb:	5d                   	pop    %ebp
+  8001bc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001bd:	83 ec 0c             	sub    $0xc,%esp
+  8001c0:	50                   	push   %eax
+  8001c1:	6a 04                	push   $0x4
+  8001c3:	68 6f 37 80 00       	push   $0x80376f
+  8001c8:	6a 3d                	push   $0x3d
+  8001ca:	68 8c 37 80 00       	push   $0x80378c
+  8001cf:	e8 71 23 00 00       	call   802545 <_panic>
+
+008001d4 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001d4:	55                   	push   %ebp
+  8001d5:	89 e5                	mov    %esp,%ebp
+  8001d7:	57                   	push   %edi
+  8001d8:	56                   	push   %esi
+  8001d9:	53                   	push   %ebx
+  8001da:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001e3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001eb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001ee:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001f1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001f3:	85 c0                	test   %eax,%eax
+  8001f5:	7f 08                	jg     8001ff <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fa:	5b                   	pop    %ebx
+  8001fb:	5e                   	pop    %esi
+  8001fc:	5f                   	pop    %edi
+  8001fd:	5d                   	pop    %ebp
+  8001fe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001ff:	83 ec 0c             	sub    $0xc,%esp
+  800202:	50                   	push   %eax
+  800203:	6a 05                	push   $0x5
+  800205:	68 6f 37 80 00       	push   $0x80376f
+  80020a:	6a 23                	push   $0x23
+  80020c:	68 8c 37 80 00       	push   $0x80378c
+  800211:	e8 2f 23 00 00       	call   802545 <_panic>
+
+00800216 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800216:	55                   	push   %ebp
+  800217:	89 e5                	mov    %esp,%ebp
+  800219:	57                   	push   %edi
+  80021a:	56                   	push   %esi
+  80021b:	53                   	push   %ebx
+  80021c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80021f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800224:	8b 55 08             	mov    0x8(%ebp),%edx
+  800227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80022a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80022f:	89 df                	mov    %ebx,%edi
+  800231:	55                   	push   %ebp
+  800232:	89 e5                	mov    %esp,%ebp
+  800234:	8d 35 3c 02 80 00    	lea    0x80023c,%esi
+  80023a:	0f 34                	sysenter
+  80023c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80023d:	85 c0                	test   %eax,%eax
+  80023f:	7f 08                	jg     800249 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800241:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800244:	5b                   	pop    %ebx
+  800245:	5e                   	pop    %esi
+  800246:	5f                   	pop    %edi
+  800247:	5d                   	pop    %ebp
+  800248:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800249:	83 ec 0c             	sub    $0xc,%esp
+  80024c:	50                   	push   %eax
+  80024d:	6a 06                	push   $0x6
+  80024f:	68 6f 37 80 00       	push   $0x80376f
+  800254:	6a 3d                	push   $0x3d
+  800256:	68 8c 37 80 00       	push   $0x80378c
+  80025b:	e8 e5 22 00 00       	call   802545 <_panic>
+
+00800260 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800260:	55                   	push   %ebp
+  800261:	89 e5                	mov    %esp,%ebp
+  800263:	57                   	push   %edi
+  800264:	56                   	push   %esi
+  800265:	53                   	push   %ebx
+  800266:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800269:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80026e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800271:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800274:	b8 08 00 00 00       	mov    $0x8,%eax
+  800279:	89 df                	mov    %ebx,%edi
+  80027b:	55                   	push   %ebp
+  80027c:	89 e5                	mov    %esp,%ebp
+  80027e:	8d 35 86 02 80 00    	lea    0x800286,%esi
+  800284:	0f 34                	sysenter
+  800286:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800287:	85 c0                	test   %eax,%eax
+  800289:	7f 08                	jg     800293 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  80028b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028e:	5b                   	pop    %ebx
+  80028f:	5e                   	pop    %esi
+  800290:	5f                   	pop    %edi
+  800291:	5d                   	pop    %ebp
+  800292:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800293:	83 ec 0c             	sub    $0xc,%esp
+  800296:	50                   	push   %eax
+  800297:	6a 08                	push   $0x8
+  800299:	68 6f 37 80 00       	push   $0x80376f
+  80029e:	6a 3d                	push   $0x3d
+  8002a0:	68 8c 37 80 00       	push   $0x80378c
+  8002a5:	e8 9b 22 00 00       	call   802545 <_panic>
+
+008002aa <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8002aa:	55                   	push   %ebp
+  8002ab:	89 e5                	mov    %esp,%ebp
+  8002ad:	57                   	push   %edi
+  8002ae:	56                   	push   %esi
+  8002af:	53                   	push   %ebx
+  8002b0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8002b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002be:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002c3:	89 df                	mov    %ebx,%edi
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	8d 35 d0 02 80 00    	lea    0x8002d0,%esi
+  8002ce:	0f 34                	sysenter
+  8002d0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8002d1:	85 c0                	test   %eax,%eax
+  8002d3:	7f 08                	jg     8002dd <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  8002d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d8:	5b                   	pop    %ebx
+  8002d9:	5e                   	pop    %esi
+  8002da:	5f                   	pop    %edi
+  8002db:	5d                   	pop    %ebp
+  8002dc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002dd:	83 ec 0c             	sub    $0xc,%esp
+  8002e0:	50                   	push   %eax
+  8002e1:	6a 09                	push   $0x9
+  8002e3:	68 6f 37 80 00       	push   $0x80376f
+  8002e8:	6a 3d                	push   $0x3d
+  8002ea:	68 8c 37 80 00       	push   $0x80378c
+  8002ef:	e8 51 22 00 00       	call   802545 <_panic>
+
+008002f4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002f4:	55                   	push   %ebp
+  8002f5:	89 e5                	mov    %esp,%ebp
+  8002f7:	57                   	push   %edi
+  8002f8:	56                   	push   %esi
+  8002f9:	53                   	push   %ebx
+  8002fa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8002fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800302:	8b 55 08             	mov    0x8(%ebp),%edx
+  800305:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800308:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80030d:	89 df                	mov    %ebx,%edi
+  80030f:	55                   	push   %ebp
+  800310:	89 e5                	mov    %esp,%ebp
+  800312:	8d 35 1a 03 80 00    	lea    0x80031a,%esi
+  800318:	0f 34                	sysenter
+  80031a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80031b:	85 c0                	test   %eax,%eax
+  80031d:	7f 08                	jg     800327 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  80031f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800322:	5b                   	pop    %ebx
+  800323:	5e                   	pop    %esi
+  800324:	5f                   	pop    %edi
+  800325:	5d                   	pop    %ebp
+  800326:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800327:	83 ec 0c             	sub    $0xc,%esp
+  80032a:	50                   	push   %eax
+  80032b:	6a 0a                	push   $0xa
+  80032d:	68 6f 37 80 00       	push   $0x80376f
+  800332:	6a 3d                	push   $0x3d
+  800334:	68 8c 37 80 00       	push   $0x80378c
+  800339:	e8 07 22 00 00       	call   802545 <_panic>
+
+0080033e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80033e:	55                   	push   %ebp
+  80033f:	89 e5                	mov    %esp,%ebp
+  800341:	57                   	push   %edi
+  800342:	56                   	push   %esi
+  800343:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800344:	8b 55 08             	mov    0x8(%ebp),%edx
+  800347:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80034a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80034f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800352:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800355:	55                   	push   %ebp
+  800356:	89 e5                	mov    %esp,%ebp
+  800358:	8d 35 60 03 80 00    	lea    0x800360,%esi
+  80035e:	0f 34                	sysenter
+  800360:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800361:	5b                   	pop    %ebx
+  800362:	5e                   	pop    %esi
+  800363:	5f                   	pop    %edi
+  800364:	5d                   	pop    %ebp
+  800365:	c3                   	ret
+
+00800366 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800366:	55                   	push   %ebp
+  800367:	89 e5                	mov    %esp,%ebp
+  800369:	57                   	push   %edi
+  80036a:	56                   	push   %esi
+  80036b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80036c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80036f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800372:	b8 17 00 00 00       	mov    $0x17,%eax
+  800377:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80037a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80037d:	55                   	push   %ebp
+  80037e:	89 e5                	mov    %esp,%ebp
+  800380:	8d 35 88 03 80 00    	lea    0x800388,%esi
+  800386:	0f 34                	sysenter
+  800388:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800389:	5b                   	pop    %ebx
+  80038a:	5e                   	pop    %esi
+  80038b:	5f                   	pop    %edi
+  80038c:	5d                   	pop    %ebp
+  80038d:	c3                   	ret
+
+0080038e <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  80038e:	55                   	push   %ebp
+  80038f:	89 e5                	mov    %esp,%ebp
+  800391:	57                   	push   %edi
+  800392:	56                   	push   %esi
+  800393:	53                   	push   %ebx
+  800394:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800397:	be 00 00 00 00       	mov    $0x0,%esi
+  80039c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80039f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003a2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003aa:	89 f7                	mov    %esi,%edi
+  8003ac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003ae:	85 c0                	test   %eax,%eax
+  8003b0:	7f 08                	jg     8003ba <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8003b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003b5:	5b                   	pop    %ebx
+  8003b6:	5e                   	pop    %esi
+  8003b7:	5f                   	pop    %edi
+  8003b8:	5d                   	pop    %ebp
+  8003b9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003ba:	83 ec 0c             	sub    $0xc,%esp
+  8003bd:	50                   	push   %eax
+  8003be:	6a 0d                	push   $0xd
+  8003c0:	68 6f 37 80 00       	push   $0x80376f
+  8003c5:	6a 23                	push   $0x23
+  8003c7:	68 8c 37 80 00       	push   $0x80378c
+  8003cc:	e8 74 21 00 00       	call   802545 <_panic>
+
+008003d1 <sys_ipc_recv>:
+{
+  8003d1:	55                   	push   %ebp
+  8003d2:	89 e5                	mov    %esp,%ebp
+  8003d4:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  8003d7:	6a 00                	push   $0x0
+  8003d9:	6a 01                	push   $0x1
+  8003db:	ff 75 08             	push   0x8(%ebp)
+  8003de:	e8 ab ff ff ff       	call   80038e <sys_ipc_recvv>
+}
+  8003e3:	c9                   	leave
+  8003e4:	c3                   	ret
+
+008003e5 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  8003e5:	55                   	push   %ebp
+  8003e6:	89 e5                	mov    %esp,%ebp
+  8003e8:	57                   	push   %edi
+  8003e9:	56                   	push   %esi
+  8003ea:	53                   	push   %ebx
+  8003eb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003f9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003fe:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800405:	85 c0                	test   %eax,%eax
+  800407:	7f 08                	jg     800411 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800409:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80040c:	5b                   	pop    %ebx
+  80040d:	5e                   	pop    %esi
+  80040e:	5f                   	pop    %edi
+  80040f:	5d                   	pop    %ebp
+  800410:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800411:	83 ec 0c             	sub    $0xc,%esp
+  800414:	50                   	push   %eax
+  800415:	6a 0d                	push   $0xd
+  800417:	68 6f 37 80 00       	push   $0x80376f
+  80041c:	6a 23                	push   $0x23
+  80041e:	68 8c 37 80 00       	push   $0x80378c
+  800423:	e8 1d 21 00 00       	call   802545 <_panic>
+
+00800428 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800428:	55                   	push   %ebp
+  800429:	89 e5                	mov    %esp,%ebp
+  80042b:	57                   	push   %edi
+  80042c:	56                   	push   %esi
+  80042d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80042e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800433:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800438:	89 d1                	mov    %edx,%ecx
+  80043a:	89 d3                	mov    %edx,%ebx
+  80043c:	89 d7                	mov    %edx,%edi
+  80043e:	55                   	push   %ebp
+  80043f:	89 e5                	mov    %esp,%ebp
+  800441:	8d 35 49 04 80 00    	lea    0x800449,%esi
+  800447:	0f 34                	sysenter
+  800449:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  80044a:	5b                   	pop    %ebx
+  80044b:	5e                   	pop    %esi
+  80044c:	5f                   	pop    %edi
+  80044d:	5d                   	pop    %ebp
+  80044e:	c3                   	ret
+
+0080044f <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  80044f:	55                   	push   %ebp
+  800450:	89 e5                	mov    %esp,%ebp
+  800452:	57                   	push   %edi
+  800453:	56                   	push   %esi
+  800454:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800455:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80045a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80045d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800460:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800465:	89 df                	mov    %ebx,%edi
+  800467:	55                   	push   %ebp
+  800468:	89 e5                	mov    %esp,%ebp
+  80046a:	8d 35 72 04 80 00    	lea    0x800472,%esi
+  800470:	0f 34                	sysenter
+  800472:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800473:	5b                   	pop    %ebx
+  800474:	5e                   	pop    %esi
+  800475:	5f                   	pop    %edi
+  800476:	5d                   	pop    %ebp
+  800477:	c3                   	ret
+
+00800478 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800478:	55                   	push   %ebp
+  800479:	89 e5                	mov    %esp,%ebp
+  80047b:	57                   	push   %edi
+  80047c:	56                   	push   %esi
+  80047d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80047e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800483:	8b 55 08             	mov    0x8(%ebp),%edx
+  800486:	b8 10 00 00 00       	mov    $0x10,%eax
+  80048b:	89 cb                	mov    %ecx,%ebx
+  80048d:	89 cf                	mov    %ecx,%edi
+  80048f:	55                   	push   %ebp
+  800490:	89 e5                	mov    %esp,%ebp
+  800492:	8d 35 9a 04 80 00    	lea    0x80049a,%esi
+  800498:	0f 34                	sysenter
+  80049a:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  80049b:	5b                   	pop    %ebx
+  80049c:	5e                   	pop    %esi
+  80049d:	5f                   	pop    %edi
+  80049e:	5d                   	pop    %ebp
+  80049f:	c3                   	ret
+
+008004a0 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  8004a0:	55                   	push   %ebp
+  8004a1:	89 e5                	mov    %esp,%ebp
+  8004a3:	57                   	push   %edi
+  8004a4:	56                   	push   %esi
+  8004a5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004b1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8004b6:	89 df                	mov    %ebx,%edi
+  8004b8:	55                   	push   %ebp
+  8004b9:	89 e5                	mov    %esp,%ebp
+  8004bb:	8d 35 c3 04 80 00    	lea    0x8004c3,%esi
+  8004c1:	0f 34                	sysenter
+  8004c3:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8004c4:	5b                   	pop    %ebx
+  8004c5:	5e                   	pop    %esi
+  8004c6:	5f                   	pop    %edi
+  8004c7:	5d                   	pop    %ebp
+  8004c8:	c3                   	ret
+
+008004c9 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8004c9:	55                   	push   %ebp
+  8004ca:	89 e5                	mov    %esp,%ebp
+  8004cc:	57                   	push   %edi
+  8004cd:	56                   	push   %esi
+  8004ce:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004da:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004df:	89 df                	mov    %ebx,%edi
+  8004e1:	55                   	push   %ebp
+  8004e2:	89 e5                	mov    %esp,%ebp
+  8004e4:	8d 35 ec 04 80 00    	lea    0x8004ec,%esi
+  8004ea:	0f 34                	sysenter
+  8004ec:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  8004ed:	5b                   	pop    %ebx
+  8004ee:	5e                   	pop    %esi
+  8004ef:	5f                   	pop    %edi
+  8004f0:	5d                   	pop    %ebp
+  8004f1:	c3                   	ret
+
+008004f2 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  8004f2:	55                   	push   %ebp
+  8004f3:	89 e5                	mov    %esp,%ebp
+  8004f5:	57                   	push   %edi
+  8004f6:	56                   	push   %esi
+  8004f7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004fe:	b8 13 00 00 00       	mov    $0x13,%eax
+  800503:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800506:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800509:	55                   	push   %ebp
+  80050a:	89 e5                	mov    %esp,%ebp
+  80050c:	8d 35 14 05 80 00    	lea    0x800514,%esi
+  800512:	0f 34                	sysenter
+  800514:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800515:	5b                   	pop    %ebx
+  800516:	5e                   	pop    %esi
+  800517:	5f                   	pop    %edi
+  800518:	5d                   	pop    %ebp
+  800519:	c3                   	ret
+
+0080051a <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  80051a:	55                   	push   %ebp
+  80051b:	89 e5                	mov    %esp,%ebp
+  80051d:	57                   	push   %edi
+  80051e:	56                   	push   %esi
+  80051f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800525:	8b 55 08             	mov    0x8(%ebp),%edx
+  800528:	b8 11 00 00 00       	mov    $0x11,%eax
+  80052d:	89 cb                	mov    %ecx,%ebx
+  80052f:	89 cf                	mov    %ecx,%edi
+  800531:	89 ce                	mov    %ecx,%esi
+  800533:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800535:	5b                   	pop    %ebx
+  800536:	5e                   	pop    %esi
+  800537:	5f                   	pop    %edi
+  800538:	5d                   	pop    %ebp
+  800539:	c3                   	ret
+
+0080053a <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  80053a:	55                   	push   %ebp
+  80053b:	89 e5                	mov    %esp,%ebp
+  80053d:	57                   	push   %edi
+  80053e:	56                   	push   %esi
+  80053f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800540:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800545:	8b 55 08             	mov    0x8(%ebp),%edx
+  800548:	b8 15 00 00 00       	mov    $0x15,%eax
+  80054d:	89 cb                	mov    %ecx,%ebx
+  80054f:	89 cf                	mov    %ecx,%edi
+  800551:	55                   	push   %ebp
+  800552:	89 e5                	mov    %esp,%ebp
+  800554:	8d 35 5c 05 80 00    	lea    0x80055c,%esi
+  80055a:	0f 34                	sysenter
+  80055c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  80055d:	5b                   	pop    %ebx
+  80055e:	5e                   	pop    %esi
+  80055f:	5f                   	pop    %edi
+  800560:	5d                   	pop    %ebp
+  800561:	c3                   	ret
+
+00800562 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800562:	55                   	push   %ebp
+  800563:	89 e5                	mov    %esp,%ebp
+  800565:	57                   	push   %edi
+  800566:	56                   	push   %esi
+  800567:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800568:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80056d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800570:	b8 16 00 00 00       	mov    $0x16,%eax
+  800575:	89 cb                	mov    %ecx,%ebx
+  800577:	89 cf                	mov    %ecx,%edi
+  800579:	55                   	push   %ebp
+  80057a:	89 e5                	mov    %esp,%ebp
+  80057c:	8d 35 84 05 80 00    	lea    0x800584,%esi
+  800582:	0f 34                	sysenter
+  800584:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800585:	5b                   	pop    %ebx
+  800586:	5e                   	pop    %esi
+  800587:	5f                   	pop    %edi
+  800588:	5d                   	pop    %ebp
+  800589:	c3                   	ret
+
+0080058a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80058a:	55                   	push   %ebp
+  80058b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80058d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800590:	05 00 00 00 30       	add    $0x30000000,%eax
+  800595:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800598:	5d                   	pop    %ebp
+  800599:	c3                   	ret
+
+0080059a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80059a:	55                   	push   %ebp
+  80059b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80059d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005a0:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8005a5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8005aa:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8005af:	5d                   	pop    %ebp
+  8005b0:	c3                   	ret
+
+008005b1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8005b1:	55                   	push   %ebp
+  8005b2:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8005b4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8005b9:	eb 02                	jmp    8005bd <fd_alloc+0xc>
+  8005bb:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8005bd:	89 c2                	mov    %eax,%edx
+  8005bf:	c1 ea 16             	shr    $0x16,%edx
+  8005c2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8005c9:	f6 c2 01             	test   $0x1,%dl
+  8005cc:	74 2b                	je     8005f9 <fd_alloc+0x48>
+  8005ce:	89 c2                	mov    %eax,%edx
+  8005d0:	c1 ea 0c             	shr    $0xc,%edx
+  8005d3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8005da:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8005e0:	f6 c1 01             	test   $0x1,%cl
+  8005e3:	74 14                	je     8005f9 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8005e5:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8005eb:	75 ce                	jne    8005bb <fd_alloc+0xa>
+  8005ed:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8005f2:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8005f7:	eb 05                	jmp    8005fe <fd_alloc+0x4d>
+			return 0;
+  8005f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8005fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800601:	89 02                	mov    %eax,(%edx)
+}
+  800603:	89 c8                	mov    %ecx,%eax
+  800605:	5d                   	pop    %ebp
+  800606:	c3                   	ret
+
+00800607 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800607:	55                   	push   %ebp
+  800608:	89 e5                	mov    %esp,%ebp
+  80060a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80060d:	83 f8 1f             	cmp    $0x1f,%eax
+  800610:	77 30                	ja     800642 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800612:	c1 e0 0c             	shl    $0xc,%eax
+  800615:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80061a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800620:	f6 c2 01             	test   $0x1,%dl
+  800623:	74 24                	je     800649 <fd_lookup+0x42>
+  800625:	89 c2                	mov    %eax,%edx
+  800627:	c1 ea 0c             	shr    $0xc,%edx
+  80062a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800631:	f6 c2 01             	test   $0x1,%dl
+  800634:	74 1a                	je     800650 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800636:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800639:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80063b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800640:	5d                   	pop    %ebp
+  800641:	c3                   	ret
+		return -E_INVAL;
+  800642:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800647:	eb f7                	jmp    800640 <fd_lookup+0x39>
+		return -E_INVAL;
+  800649:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80064e:	eb f0                	jmp    800640 <fd_lookup+0x39>
+  800650:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800655:	eb e9                	jmp    800640 <fd_lookup+0x39>
+
+00800657 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800657:	55                   	push   %ebp
+  800658:	89 e5                	mov    %esp,%ebp
+  80065a:	53                   	push   %ebx
+  80065b:	83 ec 04             	sub    $0x4,%esp
+  80065e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800661:	b8 00 00 00 00       	mov    $0x0,%eax
+  800666:	eb 03                	jmp    80066b <dev_lookup+0x14>
+  800668:	83 c0 01             	add    $0x1,%eax
+  80066b:	8b 1c 85 18 38 80 00 	mov    0x803818(,%eax,4),%ebx
+  800672:	85 db                	test   %ebx,%ebx
+  800674:	74 0b                	je     800681 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800676:	39 13                	cmp    %edx,(%ebx)
+  800678:	75 ee                	jne    800668 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80067a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067f:	eb 1f                	jmp    8006a0 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800681:	a1 00 50 80 00       	mov    0x805000,%eax
+  800686:	8b 40 48             	mov    0x48(%eax),%eax
+  800689:	83 ec 04             	sub    $0x4,%esp
+  80068c:	52                   	push   %edx
+  80068d:	50                   	push   %eax
+  80068e:	68 9c 37 80 00       	push   $0x80379c
+  800693:	e8 88 1f 00 00       	call   802620 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800698:	83 c4 10             	add    $0x10,%esp
+  80069b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8006a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006a3:	89 1a                	mov    %ebx,(%edx)
+}
+  8006a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006a8:	c9                   	leave
+  8006a9:	c3                   	ret
+
+008006aa <fd_close>:
+{
+  8006aa:	55                   	push   %ebp
+  8006ab:	89 e5                	mov    %esp,%ebp
+  8006ad:	57                   	push   %edi
+  8006ae:	56                   	push   %esi
+  8006af:	53                   	push   %ebx
+  8006b0:	83 ec 24             	sub    $0x24,%esp
+  8006b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006b6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006b9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8006bc:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8006bd:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8006c3:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006c6:	50                   	push   %eax
+  8006c7:	e8 3b ff ff ff       	call   800607 <fd_lookup>
+  8006cc:	89 c3                	mov    %eax,%ebx
+  8006ce:	83 c4 10             	add    $0x10,%esp
+  8006d1:	85 c0                	test   %eax,%eax
+  8006d3:	78 05                	js     8006da <fd_close+0x30>
+	    || fd != fd2)
+  8006d5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8006d8:	74 16                	je     8006f0 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8006da:	89 f8                	mov    %edi,%eax
+  8006dc:	84 c0                	test   %al,%al
+  8006de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e3:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8006e6:	89 d8                	mov    %ebx,%eax
+  8006e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006eb:	5b                   	pop    %ebx
+  8006ec:	5e                   	pop    %esi
+  8006ed:	5f                   	pop    %edi
+  8006ee:	5d                   	pop    %ebp
+  8006ef:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8006f0:	83 ec 08             	sub    $0x8,%esp
+  8006f3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8006f6:	50                   	push   %eax
+  8006f7:	ff 36                	push   (%esi)
+  8006f9:	e8 59 ff ff ff       	call   800657 <dev_lookup>
+  8006fe:	89 c3                	mov    %eax,%ebx
+  800700:	83 c4 10             	add    $0x10,%esp
+  800703:	85 c0                	test   %eax,%eax
+  800705:	78 1a                	js     800721 <fd_close+0x77>
+		if (dev->dev_close)
+  800707:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80070a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80070d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800712:	85 c0                	test   %eax,%eax
+  800714:	74 0b                	je     800721 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800716:	83 ec 0c             	sub    $0xc,%esp
+  800719:	56                   	push   %esi
+  80071a:	ff d0                	call   *%eax
+  80071c:	89 c3                	mov    %eax,%ebx
+  80071e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800721:	83 ec 08             	sub    $0x8,%esp
+  800724:	56                   	push   %esi
+  800725:	6a 00                	push   $0x0
+  800727:	e8 ea fa ff ff       	call   800216 <sys_page_unmap>
+	return r;
+  80072c:	83 c4 10             	add    $0x10,%esp
+  80072f:	eb b5                	jmp    8006e6 <fd_close+0x3c>
+
+00800731 <close>:
+
+int
+close(int fdnum)
+{
+  800731:	55                   	push   %ebp
+  800732:	89 e5                	mov    %esp,%ebp
+  800734:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800737:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80073a:	50                   	push   %eax
+  80073b:	ff 75 08             	push   0x8(%ebp)
+  80073e:	e8 c4 fe ff ff       	call   800607 <fd_lookup>
+  800743:	83 c4 10             	add    $0x10,%esp
+  800746:	85 c0                	test   %eax,%eax
+  800748:	79 02                	jns    80074c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80074a:	c9                   	leave
+  80074b:	c3                   	ret
+		return fd_close(fd, 1);
+  80074c:	83 ec 08             	sub    $0x8,%esp
+  80074f:	6a 01                	push   $0x1
+  800751:	ff 75 f4             	push   -0xc(%ebp)
+  800754:	e8 51 ff ff ff       	call   8006aa <fd_close>
+  800759:	83 c4 10             	add    $0x10,%esp
+  80075c:	eb ec                	jmp    80074a <close+0x19>
+
+0080075e <close_all>:
+
+void
+close_all(void)
+{
+  80075e:	55                   	push   %ebp
+  80075f:	89 e5                	mov    %esp,%ebp
+  800761:	53                   	push   %ebx
+  800762:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800765:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80076a:	83 ec 0c             	sub    $0xc,%esp
+  80076d:	53                   	push   %ebx
+  80076e:	e8 be ff ff ff       	call   800731 <close>
+	for (i = 0; i < MAXFD; i++)
+  800773:	83 c3 01             	add    $0x1,%ebx
+  800776:	83 c4 10             	add    $0x10,%esp
+  800779:	83 fb 20             	cmp    $0x20,%ebx
+  80077c:	75 ec                	jne    80076a <close_all+0xc>
+}
+  80077e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800781:	c9                   	leave
+  800782:	c3                   	ret
+
+00800783 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800783:	55                   	push   %ebp
+  800784:	89 e5                	mov    %esp,%ebp
+  800786:	57                   	push   %edi
+  800787:	56                   	push   %esi
+  800788:	53                   	push   %ebx
+  800789:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80078c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80078f:	50                   	push   %eax
+  800790:	ff 75 08             	push   0x8(%ebp)
+  800793:	e8 6f fe ff ff       	call   800607 <fd_lookup>
+  800798:	89 c3                	mov    %eax,%ebx
+  80079a:	83 c4 10             	add    $0x10,%esp
+  80079d:	85 c0                	test   %eax,%eax
+  80079f:	78 7f                	js     800820 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8007a1:	83 ec 0c             	sub    $0xc,%esp
+  8007a4:	ff 75 0c             	push   0xc(%ebp)
+  8007a7:	e8 85 ff ff ff       	call   800731 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8007ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8007af:	c1 e6 0c             	shl    $0xc,%esi
+  8007b2:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8007b8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8007bb:	89 3c 24             	mov    %edi,(%esp)
+  8007be:	e8 d7 fd ff ff       	call   80059a <fd2data>
+  8007c3:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8007c5:	89 34 24             	mov    %esi,(%esp)
+  8007c8:	e8 cd fd ff ff       	call   80059a <fd2data>
+  8007cd:	83 c4 10             	add    $0x10,%esp
+  8007d0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8007d3:	89 d8                	mov    %ebx,%eax
+  8007d5:	c1 e8 16             	shr    $0x16,%eax
+  8007d8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8007df:	a8 01                	test   $0x1,%al
+  8007e1:	74 11                	je     8007f4 <dup+0x71>
+  8007e3:	89 d8                	mov    %ebx,%eax
+  8007e5:	c1 e8 0c             	shr    $0xc,%eax
+  8007e8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8007ef:	f6 c2 01             	test   $0x1,%dl
+  8007f2:	75 36                	jne    80082a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8007f4:	89 f8                	mov    %edi,%eax
+  8007f6:	c1 e8 0c             	shr    $0xc,%eax
+  8007f9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800800:	83 ec 0c             	sub    $0xc,%esp
+  800803:	25 07 0e 00 00       	and    $0xe07,%eax
+  800808:	50                   	push   %eax
+  800809:	56                   	push   %esi
+  80080a:	6a 00                	push   $0x0
+  80080c:	57                   	push   %edi
+  80080d:	6a 00                	push   $0x0
+  80080f:	e8 c0 f9 ff ff       	call   8001d4 <sys_page_map>
+  800814:	89 c3                	mov    %eax,%ebx
+  800816:	83 c4 20             	add    $0x20,%esp
+  800819:	85 c0                	test   %eax,%eax
+  80081b:	78 33                	js     800850 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80081d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800820:	89 d8                	mov    %ebx,%eax
+  800822:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800825:	5b                   	pop    %ebx
+  800826:	5e                   	pop    %esi
+  800827:	5f                   	pop    %edi
+  800828:	5d                   	pop    %ebp
+  800829:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80082a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800831:	83 ec 0c             	sub    $0xc,%esp
+  800834:	25 07 0e 00 00       	and    $0xe07,%eax
+  800839:	50                   	push   %eax
+  80083a:	ff 75 d4             	push   -0x2c(%ebp)
+  80083d:	6a 00                	push   $0x0
+  80083f:	53                   	push   %ebx
+  800840:	6a 00                	push   $0x0
+  800842:	e8 8d f9 ff ff       	call   8001d4 <sys_page_map>
+  800847:	89 c3                	mov    %eax,%ebx
+  800849:	83 c4 20             	add    $0x20,%esp
+  80084c:	85 c0                	test   %eax,%eax
+  80084e:	79 a4                	jns    8007f4 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800850:	83 ec 08             	sub    $0x8,%esp
+  800853:	56                   	push   %esi
+  800854:	6a 00                	push   $0x0
+  800856:	e8 bb f9 ff ff       	call   800216 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80085b:	83 c4 08             	add    $0x8,%esp
+  80085e:	ff 75 d4             	push   -0x2c(%ebp)
+  800861:	6a 00                	push   $0x0
+  800863:	e8 ae f9 ff ff       	call   800216 <sys_page_unmap>
+	return r;
+  800868:	83 c4 10             	add    $0x10,%esp
+  80086b:	eb b3                	jmp    800820 <dup+0x9d>
+
+0080086d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80086d:	55                   	push   %ebp
+  80086e:	89 e5                	mov    %esp,%ebp
+  800870:	56                   	push   %esi
+  800871:	53                   	push   %ebx
+  800872:	83 ec 18             	sub    $0x18,%esp
+  800875:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800878:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80087b:	50                   	push   %eax
+  80087c:	56                   	push   %esi
+  80087d:	e8 85 fd ff ff       	call   800607 <fd_lookup>
+  800882:	83 c4 10             	add    $0x10,%esp
+  800885:	85 c0                	test   %eax,%eax
+  800887:	78 3c                	js     8008c5 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800889:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80088c:	83 ec 08             	sub    $0x8,%esp
+  80088f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800892:	50                   	push   %eax
+  800893:	ff 33                	push   (%ebx)
+  800895:	e8 bd fd ff ff       	call   800657 <dev_lookup>
+  80089a:	83 c4 10             	add    $0x10,%esp
+  80089d:	85 c0                	test   %eax,%eax
+  80089f:	78 24                	js     8008c5 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8008a1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8008a4:	83 e0 03             	and    $0x3,%eax
+  8008a7:	83 f8 01             	cmp    $0x1,%eax
+  8008aa:	74 20                	je     8008cc <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8008ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008af:	8b 40 08             	mov    0x8(%eax),%eax
+  8008b2:	85 c0                	test   %eax,%eax
+  8008b4:	74 37                	je     8008ed <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8008b6:	83 ec 04             	sub    $0x4,%esp
+  8008b9:	ff 75 10             	push   0x10(%ebp)
+  8008bc:	ff 75 0c             	push   0xc(%ebp)
+  8008bf:	53                   	push   %ebx
+  8008c0:	ff d0                	call   *%eax
+  8008c2:	83 c4 10             	add    $0x10,%esp
+}
+  8008c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008c8:	5b                   	pop    %ebx
+  8008c9:	5e                   	pop    %esi
+  8008ca:	5d                   	pop    %ebp
+  8008cb:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8008cc:	a1 00 50 80 00       	mov    0x805000,%eax
+  8008d1:	8b 40 48             	mov    0x48(%eax),%eax
+  8008d4:	83 ec 04             	sub    $0x4,%esp
+  8008d7:	56                   	push   %esi
+  8008d8:	50                   	push   %eax
+  8008d9:	68 dd 37 80 00       	push   $0x8037dd
+  8008de:	e8 3d 1d 00 00       	call   802620 <cprintf>
+		return -E_INVAL;
+  8008e3:	83 c4 10             	add    $0x10,%esp
+  8008e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008eb:	eb d8                	jmp    8008c5 <read+0x58>
+		return -E_NOT_SUPP;
+  8008ed:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8008f2:	eb d1                	jmp    8008c5 <read+0x58>
+
+008008f4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8008f4:	55                   	push   %ebp
+  8008f5:	89 e5                	mov    %esp,%ebp
+  8008f7:	57                   	push   %edi
+  8008f8:	56                   	push   %esi
+  8008f9:	53                   	push   %ebx
+  8008fa:	83 ec 0c             	sub    $0xc,%esp
+  8008fd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800900:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800903:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800908:	eb 02                	jmp    80090c <readn+0x18>
+  80090a:	01 c3                	add    %eax,%ebx
+  80090c:	39 f3                	cmp    %esi,%ebx
+  80090e:	73 21                	jae    800931 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800910:	83 ec 04             	sub    $0x4,%esp
+  800913:	89 f0                	mov    %esi,%eax
+  800915:	29 d8                	sub    %ebx,%eax
+  800917:	50                   	push   %eax
+  800918:	89 d8                	mov    %ebx,%eax
+  80091a:	03 45 0c             	add    0xc(%ebp),%eax
+  80091d:	50                   	push   %eax
+  80091e:	57                   	push   %edi
+  80091f:	e8 49 ff ff ff       	call   80086d <read>
+		if (m < 0)
+  800924:	83 c4 10             	add    $0x10,%esp
+  800927:	85 c0                	test   %eax,%eax
+  800929:	78 04                	js     80092f <readn+0x3b>
+			return m;
+		if (m == 0)
+  80092b:	75 dd                	jne    80090a <readn+0x16>
+  80092d:	eb 02                	jmp    800931 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80092f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  800931:	89 d8                	mov    %ebx,%eax
+  800933:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800936:	5b                   	pop    %ebx
+  800937:	5e                   	pop    %esi
+  800938:	5f                   	pop    %edi
+  800939:	5d                   	pop    %ebp
+  80093a:	c3                   	ret
+
+0080093b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80093b:	55                   	push   %ebp
+  80093c:	89 e5                	mov    %esp,%ebp
+  80093e:	56                   	push   %esi
+  80093f:	53                   	push   %ebx
+  800940:	83 ec 18             	sub    $0x18,%esp
+  800943:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800946:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800949:	50                   	push   %eax
+  80094a:	53                   	push   %ebx
+  80094b:	e8 b7 fc ff ff       	call   800607 <fd_lookup>
+  800950:	83 c4 10             	add    $0x10,%esp
+  800953:	85 c0                	test   %eax,%eax
+  800955:	78 37                	js     80098e <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800957:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80095a:	83 ec 08             	sub    $0x8,%esp
+  80095d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800960:	50                   	push   %eax
+  800961:	ff 36                	push   (%esi)
+  800963:	e8 ef fc ff ff       	call   800657 <dev_lookup>
+  800968:	83 c4 10             	add    $0x10,%esp
+  80096b:	85 c0                	test   %eax,%eax
+  80096d:	78 1f                	js     80098e <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80096f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800973:	74 20                	je     800995 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800975:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800978:	8b 40 0c             	mov    0xc(%eax),%eax
+  80097b:	85 c0                	test   %eax,%eax
+  80097d:	74 37                	je     8009b6 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80097f:	83 ec 04             	sub    $0x4,%esp
+  800982:	ff 75 10             	push   0x10(%ebp)
+  800985:	ff 75 0c             	push   0xc(%ebp)
+  800988:	56                   	push   %esi
+  800989:	ff d0                	call   *%eax
+  80098b:	83 c4 10             	add    $0x10,%esp
+}
+  80098e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800991:	5b                   	pop    %ebx
+  800992:	5e                   	pop    %esi
+  800993:	5d                   	pop    %ebp
+  800994:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800995:	a1 00 50 80 00       	mov    0x805000,%eax
+  80099a:	8b 40 48             	mov    0x48(%eax),%eax
+  80099d:	83 ec 04             	sub    $0x4,%esp
+  8009a0:	53                   	push   %ebx
+  8009a1:	50                   	push   %eax
+  8009a2:	68 f9 37 80 00       	push   $0x8037f9
+  8009a7:	e8 74 1c 00 00       	call   802620 <cprintf>
+		return -E_INVAL;
+  8009ac:	83 c4 10             	add    $0x10,%esp
+  8009af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009b4:	eb d8                	jmp    80098e <write+0x53>
+		return -E_NOT_SUPP;
+  8009b6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009bb:	eb d1                	jmp    80098e <write+0x53>
+
+008009bd <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8009bd:	55                   	push   %ebp
+  8009be:	89 e5                	mov    %esp,%ebp
+  8009c0:	53                   	push   %ebx
+  8009c1:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009c4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009c7:	50                   	push   %eax
+  8009c8:	ff 75 08             	push   0x8(%ebp)
+  8009cb:	e8 37 fc ff ff       	call   800607 <fd_lookup>
+  8009d0:	83 c4 10             	add    $0x10,%esp
+  8009d3:	85 c0                	test   %eax,%eax
+  8009d5:	78 3a                	js     800a11 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009d7:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8009da:	83 ec 08             	sub    $0x8,%esp
+  8009dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009e0:	50                   	push   %eax
+  8009e1:	ff 33                	push   (%ebx)
+  8009e3:	e8 6f fc ff ff       	call   800657 <dev_lookup>
+  8009e8:	83 c4 10             	add    $0x10,%esp
+  8009eb:	85 c0                	test   %eax,%eax
+  8009ed:	78 22                	js     800a11 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8009ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009f2:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8009f5:	85 c0                	test   %eax,%eax
+  8009f7:	74 0d                	je     800a06 <seek+0x49>
+  8009f9:	83 ec 0c             	sub    $0xc,%esp
+  8009fc:	53                   	push   %ebx
+  8009fd:	ff d0                	call   *%eax
+  8009ff:	83 c4 10             	add    $0x10,%esp
+  800a02:	85 c0                	test   %eax,%eax
+  800a04:	78 0b                	js     800a11 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  800a06:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a09:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  800a0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a14:	c9                   	leave
+  800a15:	c3                   	ret
+
+00800a16 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  800a16:	55                   	push   %ebp
+  800a17:	89 e5                	mov    %esp,%ebp
+  800a19:	53                   	push   %ebx
+  800a1a:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a1d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a20:	50                   	push   %eax
+  800a21:	ff 75 08             	push   0x8(%ebp)
+  800a24:	e8 de fb ff ff       	call   800607 <fd_lookup>
+  800a29:	83 c4 10             	add    $0x10,%esp
+  800a2c:	85 c0                	test   %eax,%eax
+  800a2e:	78 2b                	js     800a5b <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a30:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a33:	83 ec 08             	sub    $0x8,%esp
+  800a36:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a39:	50                   	push   %eax
+  800a3a:	ff 33                	push   (%ebx)
+  800a3c:	e8 16 fc ff ff       	call   800657 <dev_lookup>
+  800a41:	83 c4 10             	add    $0x10,%esp
+  800a44:	85 c0                	test   %eax,%eax
+  800a46:	78 13                	js     800a5b <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  800a48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a4b:	8b 40 1c             	mov    0x1c(%eax),%eax
+  800a4e:	85 c0                	test   %eax,%eax
+  800a50:	74 0e                	je     800a60 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  800a52:	83 ec 0c             	sub    $0xc,%esp
+  800a55:	53                   	push   %ebx
+  800a56:	ff d0                	call   *%eax
+  800a58:	83 c4 10             	add    $0x10,%esp
+}
+  800a5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a5e:	c9                   	leave
+  800a5f:	c3                   	ret
+		return 0;
+  800a60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a65:	eb f4                	jmp    800a5b <fsync+0x45>
+
+00800a67 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a67:	55                   	push   %ebp
+  800a68:	89 e5                	mov    %esp,%ebp
+  800a6a:	56                   	push   %esi
+  800a6b:	53                   	push   %ebx
+  800a6c:	83 ec 18             	sub    $0x18,%esp
+  800a6f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a72:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a75:	50                   	push   %eax
+  800a76:	53                   	push   %ebx
+  800a77:	e8 8b fb ff ff       	call   800607 <fd_lookup>
+  800a7c:	83 c4 10             	add    $0x10,%esp
+  800a7f:	85 c0                	test   %eax,%eax
+  800a81:	78 34                	js     800ab7 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a83:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a86:	83 ec 08             	sub    $0x8,%esp
+  800a89:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a8c:	50                   	push   %eax
+  800a8d:	ff 36                	push   (%esi)
+  800a8f:	e8 c3 fb ff ff       	call   800657 <dev_lookup>
+  800a94:	83 c4 10             	add    $0x10,%esp
+  800a97:	85 c0                	test   %eax,%eax
+  800a99:	78 1c                	js     800ab7 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a9b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a9f:	74 1d                	je     800abe <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800aa1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800aa4:	8b 40 18             	mov    0x18(%eax),%eax
+  800aa7:	85 c0                	test   %eax,%eax
+  800aa9:	74 34                	je     800adf <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800aab:	83 ec 08             	sub    $0x8,%esp
+  800aae:	ff 75 0c             	push   0xc(%ebp)
+  800ab1:	56                   	push   %esi
+  800ab2:	ff d0                	call   *%eax
+  800ab4:	83 c4 10             	add    $0x10,%esp
+}
+  800ab7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aba:	5b                   	pop    %ebx
+  800abb:	5e                   	pop    %esi
+  800abc:	5d                   	pop    %ebp
+  800abd:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800abe:	a1 00 50 80 00       	mov    0x805000,%eax
+  800ac3:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ac6:	83 ec 04             	sub    $0x4,%esp
+  800ac9:	53                   	push   %ebx
+  800aca:	50                   	push   %eax
+  800acb:	68 bc 37 80 00       	push   $0x8037bc
+  800ad0:	e8 4b 1b 00 00       	call   802620 <cprintf>
+		return -E_INVAL;
+  800ad5:	83 c4 10             	add    $0x10,%esp
+  800ad8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800add:	eb d8                	jmp    800ab7 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800adf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ae4:	eb d1                	jmp    800ab7 <ftruncate+0x50>
+
+00800ae6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800ae6:	55                   	push   %ebp
+  800ae7:	89 e5                	mov    %esp,%ebp
+  800ae9:	56                   	push   %esi
+  800aea:	53                   	push   %ebx
+  800aeb:	83 ec 18             	sub    $0x18,%esp
+  800aee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800af1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800af4:	50                   	push   %eax
+  800af5:	ff 75 08             	push   0x8(%ebp)
+  800af8:	e8 0a fb ff ff       	call   800607 <fd_lookup>
+  800afd:	83 c4 10             	add    $0x10,%esp
+  800b00:	85 c0                	test   %eax,%eax
+  800b02:	78 49                	js     800b4d <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b04:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b07:	83 ec 08             	sub    $0x8,%esp
+  800b0a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b0d:	50                   	push   %eax
+  800b0e:	ff 36                	push   (%esi)
+  800b10:	e8 42 fb ff ff       	call   800657 <dev_lookup>
+  800b15:	83 c4 10             	add    $0x10,%esp
+  800b18:	85 c0                	test   %eax,%eax
+  800b1a:	78 31                	js     800b4d <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b1f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b23:	74 2f                	je     800b54 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b25:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b28:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b2f:	00 00 00 
+	stat->st_isdir = 0;
+  800b32:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b39:	00 00 00 
+	stat->st_dev = dev;
+  800b3c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b42:	83 ec 08             	sub    $0x8,%esp
+  800b45:	53                   	push   %ebx
+  800b46:	56                   	push   %esi
+  800b47:	ff 50 14             	call   *0x14(%eax)
+  800b4a:	83 c4 10             	add    $0x10,%esp
+}
+  800b4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b50:	5b                   	pop    %ebx
+  800b51:	5e                   	pop    %esi
+  800b52:	5d                   	pop    %ebp
+  800b53:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b54:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b59:	eb f2                	jmp    800b4d <fstat+0x67>
+
+00800b5b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b5b:	55                   	push   %ebp
+  800b5c:	89 e5                	mov    %esp,%ebp
+  800b5e:	56                   	push   %esi
+  800b5f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  800b60:	83 ec 08             	sub    $0x8,%esp
+  800b63:	68 00 10 00 00       	push   $0x1000
+  800b68:	ff 75 08             	push   0x8(%ebp)
+  800b6b:	e8 b3 07 00 00       	call   801323 <open>
+  800b70:	89 c3                	mov    %eax,%ebx
+  800b72:	83 c4 10             	add    $0x10,%esp
+  800b75:	85 c0                	test   %eax,%eax
+  800b77:	78 1b                	js     800b94 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  800b79:	83 ec 08             	sub    $0x8,%esp
+  800b7c:	ff 75 0c             	push   0xc(%ebp)
+  800b7f:	50                   	push   %eax
+  800b80:	e8 61 ff ff ff       	call   800ae6 <fstat>
+  800b85:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800b87:	89 1c 24             	mov    %ebx,(%esp)
+  800b8a:	e8 a2 fb ff ff       	call   800731 <close>
+	return r;
+  800b8f:	83 c4 10             	add    $0x10,%esp
+  800b92:	89 f3                	mov    %esi,%ebx
+}
+  800b94:	89 d8                	mov    %ebx,%eax
+  800b96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b99:	5b                   	pop    %ebx
+  800b9a:	5e                   	pop    %esi
+  800b9b:	5d                   	pop    %ebp
+  800b9c:	c3                   	ret
+
+00800b9d <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  800b9d:	55                   	push   %ebp
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	57                   	push   %edi
+  800ba1:	56                   	push   %esi
+  800ba2:	53                   	push   %ebx
+  800ba3:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  800ba9:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  800baf:	89 d6                	mov    %edx,%esi
+  800bb1:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  800bb7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  800bba:	89 d3                	mov    %edx,%ebx
+  800bbc:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  800bc2:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800bc9:	74 1d                	je     800be8 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  800bcb:	b8 00 60 80 00       	mov    $0x806000,%eax
+  800bd0:	83 c8 07             	or     $0x7,%eax
+  800bd3:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  800bd9:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800bde:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  800be4:	01 ce                	add    %ecx,%esi
+  800be6:	eb 28                	jmp    800c10 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800be8:	83 ec 0c             	sub    $0xc,%esp
+  800beb:	6a 01                	push   $0x1
+  800bed:	e8 05 28 00 00       	call   8033f7 <ipc_find_env>
+  800bf2:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800bf7:	83 c4 10             	add    $0x10,%esp
+  800bfa:	eb cf                	jmp    800bcb <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  800bfc:	83 c0 01             	add    $0x1,%eax
+  800bff:	89 fa                	mov    %edi,%edx
+  800c01:	09 da                	or     %ebx,%edx
+  800c03:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800c0a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800c10:	39 f3                	cmp    %esi,%ebx
+  800c12:	72 e8                	jb     800bfc <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  800c14:	83 f8 41             	cmp    $0x41,%eax
+  800c17:	77 2f                	ja     800c48 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  800c19:	50                   	push   %eax
+  800c1a:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  800c20:	50                   	push   %eax
+  800c21:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  800c27:	ff 35 c8 70 80 00    	push   0x8070c8
+  800c2d:	e8 77 27 00 00       	call   8033a9 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  800c32:	83 c4 0c             	add    $0xc,%esp
+  800c35:	6a 00                	push   $0x0
+  800c37:	6a 00                	push   $0x0
+  800c39:	6a 00                	push   $0x0
+  800c3b:	e8 13 26 00 00       	call   803253 <ipc_recv>
+}
+  800c40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c43:	5b                   	pop    %ebx
+  800c44:	5e                   	pop    %esi
+  800c45:	5f                   	pop    %edi
+  800c46:	5d                   	pop    %ebp
+  800c47:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  800c48:	68 2c 38 80 00       	push   $0x80382c
+  800c4d:	68 48 38 80 00       	push   $0x803848
+  800c52:	6a 40                	push   $0x40
+  800c54:	68 5d 38 80 00       	push   $0x80385d
+  800c59:	e8 e7 18 00 00       	call   802545 <_panic>
+
+00800c5e <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  800c5e:	55                   	push   %ebp
+  800c5f:	89 e5                	mov    %esp,%ebp
+  800c61:	57                   	push   %edi
+  800c62:	56                   	push   %esi
+  800c63:	53                   	push   %ebx
+  800c64:	83 ec 1c             	sub    $0x1c,%esp
+  800c67:	89 c3                	mov    %eax,%ebx
+  800c69:	89 d6                	mov    %edx,%esi
+  800c6b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  800c6e:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  800c74:	89 ca                	mov    %ecx,%edx
+  800c76:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  800c79:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  800c80:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  800c83:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  800c8a:	8b 76 0c             	mov    0xc(%esi),%esi
+  800c8d:	89 fb                	mov    %edi,%ebx
+  800c8f:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  800c96:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c99:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  800ca0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ca3:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  800caa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cad:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  800cb4:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  800cb7:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  800cbe:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  800cc3:	39 c8                	cmp    %ecx,%eax
+  800cc5:	74 0d                	je     800cd4 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  800cc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ccf:	5b                   	pop    %ebx
+  800cd0:	5e                   	pop    %esi
+  800cd1:	5f                   	pop    %edi
+  800cd2:	5d                   	pop    %ebp
+  800cd3:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cd4:	6a 07                	push   $0x7
+  800cd6:	68 00 60 80 00       	push   $0x806000
+  800cdb:	6a 0d                	push   $0xd
+  800cdd:	ff 35 c8 70 80 00    	push   0x8070c8
+  800ce3:	e8 d6 25 00 00       	call   8032be <ipc_send>
+  800ce8:	83 c4 10             	add    $0x10,%esp
+  800ceb:	eb da                	jmp    800cc7 <fsring_post+0x69>
+
+00800ced <fsipcv>:
+{
+  800ced:	55                   	push   %ebp
+  800cee:	89 e5                	mov    %esp,%ebp
+  800cf0:	57                   	push   %edi
+  800cf1:	56                   	push   %esi
+  800cf2:	53                   	push   %ebx
+  800cf3:	83 ec 0c             	sub    $0xc,%esp
+  800cf6:	89 c7                	mov    %eax,%edi
+  800cf8:	89 d3                	mov    %edx,%ebx
+  800cfa:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  800cfc:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800d03:	74 26                	je     800d2b <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800d05:	6a 07                	push   $0x7
+  800d07:	68 00 60 80 00       	push   $0x806000
+  800d0c:	57                   	push   %edi
+  800d0d:	ff 35 c8 70 80 00    	push   0x8070c8
+  800d13:	e8 a6 25 00 00       	call   8032be <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  800d18:	6a 00                	push   $0x0
+  800d1a:	56                   	push   %esi
+  800d1b:	53                   	push   %ebx
+  800d1c:	6a 00                	push   $0x0
+  800d1e:	e8 f3 25 00 00       	call   803316 <ipc_recvv>
+}
+  800d23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d26:	5b                   	pop    %ebx
+  800d27:	5e                   	pop    %esi
+  800d28:	5f                   	pop    %edi
+  800d29:	5d                   	pop    %ebp
+  800d2a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d2b:	83 ec 0c             	sub    $0xc,%esp
+  800d2e:	6a 01                	push   $0x1
+  800d30:	e8 c2 26 00 00       	call   8033f7 <ipc_find_env>
+  800d35:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800d3a:	83 c4 10             	add    $0x10,%esp
+  800d3d:	eb c6                	jmp    800d05 <fsipcv+0x18>
+
+00800d3f <fsipc>:
+{
+  800d3f:	55                   	push   %ebp
+  800d40:	89 e5                	mov    %esp,%ebp
+  800d42:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  800d45:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  800d4c:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800d4f:	e8 99 ff ff ff       	call   800ced <fsipcv>
+}
+  800d54:	c9                   	leave
+  800d55:	c3                   	ret
+
+00800d56 <file_write_direct>:
+{
+  800d56:	55                   	push   %ebp
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	56                   	push   %esi
+  800d5a:	53                   	push   %ebx
+  800d5b:	89 c3                	mov    %eax,%ebx
+  800d5d:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800d5f:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  800d65:	77 40                	ja     800da7 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800d67:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  800d6c:	39 c8                	cmp    %ecx,%eax
+  800d6e:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d71:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  800d74:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  800d7a:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800d7f:	83 ec 04             	sub    $0x4,%esp
+  800d82:	50                   	push   %eax
+  800d83:	52                   	push   %edx
+  800d84:	68 08 60 80 00       	push   $0x806008
+  800d89:	e8 06 20 00 00       	call   802d94 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800d8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d93:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d98:	e8 a2 ff ff ff       	call   800d3f <fsipc>
+  800d9d:	83 c4 10             	add    $0x10,%esp
+}
+  800da0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800da3:	5b                   	pop    %ebx
+  800da4:	5e                   	pop    %esi
+  800da5:	5d                   	pop    %ebp
+  800da6:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  800da7:	89 d6                	mov    %edx,%esi
+  800da9:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  800daf:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  800db4:	29 f1                	sub    %esi,%ecx
+  800db6:	39 c1                	cmp    %eax,%ecx
+  800db8:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  800dbb:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800dbe:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  800dc3:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  800dc9:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  800dcf:	83 ec 0c             	sub    $0xc,%esp
+  800dd2:	6a 05                	push   $0x5
+  800dd4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dd9:	e8 bf fd ff ff       	call   800b9d <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  800dde:	83 c4 10             	add    $0x10,%esp
+  800de1:	eb bd                	jmp    800da0 <file_write_direct+0x4a>
+
+00800de3 <devfile_sync>:
+{
+  800de3:	55                   	push   %ebp
+  800de4:	89 e5                	mov    %esp,%ebp
+  800de6:	57                   	push   %edi
+  800de7:	56                   	push   %esi
+  800de8:	53                   	push   %ebx
+  800de9:	83 ec 28             	sub    $0x28,%esp
+  800dec:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  800def:	56                   	push   %esi
+  800df0:	e8 a5 f7 ff ff       	call   80059a <fd2data>
+  800df5:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  800df7:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  800dfa:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  800e01:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800e04:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  800e09:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  800e0d:	74 45                	je     800e54 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  800e0f:	8b 46 14             	mov    0x14(%esi),%eax
+  800e12:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e15:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e1f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e22:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  800e25:	39 cb                	cmp    %ecx,%ebx
+  800e27:	73 14                	jae    800e3d <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  800e29:	29 d9                	sub    %ebx,%ecx
+  800e2b:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800e2e:	89 f0                	mov    %esi,%eax
+  800e30:	e8 21 ff ff ff       	call   800d56 <file_write_direct>
+  800e35:	85 c0                	test   %eax,%eax
+  800e37:	7e 04                	jle    800e3d <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e39:	01 c3                	add    %eax,%ebx
+  800e3b:	eb e5                	jmp    800e22 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  800e3d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e40:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  800e47:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  800e4a:	85 c0                	test   %eax,%eax
+  800e4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e51:	0f 4f c2             	cmovg  %edx,%eax
+}
+  800e54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e57:	5b                   	pop    %ebx
+  800e58:	5e                   	pop    %esi
+  800e59:	5f                   	pop    %edi
+  800e5a:	5d                   	pop    %ebp
+  800e5b:	c3                   	ret
+
+00800e5c <devfile_write>:
+{
+  800e5c:	55                   	push   %ebp
+  800e5d:	89 e5                	mov    %esp,%ebp
+  800e5f:	57                   	push   %edi
+  800e60:	56                   	push   %esi
+  800e61:	53                   	push   %ebx
+  800e62:	83 ec 28             	sub    $0x28,%esp
+  800e65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e68:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  800e6b:	53                   	push   %ebx
+  800e6c:	e8 29 f7 ff ff       	call   80059a <fd2data>
+  800e71:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  800e74:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  800e77:	83 c4 10             	add    $0x10,%esp
+  800e7a:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  800e7e:	74 43                	je     800ec3 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  800e80:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  800e87:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800e8a:	85 c0                	test   %eax,%eax
+  800e8c:	74 43                	je     800ed1 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  800e8e:	89 c2                	mov    %eax,%edx
+  800e90:	03 53 14             	add    0x14(%ebx),%edx
+  800e93:	39 fa                	cmp    %edi,%edx
+  800e95:	75 0b                	jne    800ea2 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  800e97:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  800e9a:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  800ea0:	76 66                	jbe    800f08 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  800ea2:	83 ec 0c             	sub    $0xc,%esp
+  800ea5:	53                   	push   %ebx
+  800ea6:	e8 38 ff ff ff       	call   800de3 <devfile_sync>
+  800eab:	83 c4 10             	add    $0x10,%esp
+  800eae:	85 c0                	test   %eax,%eax
+  800eb0:	78 4e                	js     800f00 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800eb2:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800eb8:	77 56                	ja     800f10 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  800eba:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800ebd:	85 c0                	test   %eax,%eax
+  800ebf:	75 20                	jne    800ee1 <devfile_write+0x85>
+  800ec1:	eb 16                	jmp    800ed9 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  800ec3:	89 f1                	mov    %esi,%ecx
+  800ec5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ec8:	89 d8                	mov    %ebx,%eax
+  800eca:	e8 87 fe ff ff       	call   800d56 <file_write_direct>
+  800ecf:	eb 2f                	jmp    800f00 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800ed1:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800ed7:	77 37                	ja     800f10 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  800ed9:	89 7b 14             	mov    %edi,0x14(%ebx)
+  800edc:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  800ee1:	83 ec 04             	sub    $0x4,%esp
+  800ee4:	56                   	push   %esi
+  800ee5:	ff 75 0c             	push   0xc(%ebp)
+  800ee8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800eeb:	01 c1                	add    %eax,%ecx
+  800eed:	51                   	push   %ecx
+  800eee:	e8 a1 1e 00 00       	call   802d94 <memmove>
+	ff->buf_wlen += n;
+  800ef3:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  800ef6:	01 f7                	add    %esi,%edi
+  800ef8:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  800efb:	89 f0                	mov    %esi,%eax
+  800efd:	83 c4 10             	add    $0x10,%esp
+}
+  800f00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f03:	5b                   	pop    %ebx
+  800f04:	5e                   	pop    %esi
+  800f05:	5f                   	pop    %edi
+  800f06:	5d                   	pop    %ebp
+  800f07:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  800f08:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800f0e:	76 d1                	jbe    800ee1 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  800f10:	89 f1                	mov    %esi,%ecx
+  800f12:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f15:	89 d8                	mov    %ebx,%eax
+  800f17:	e8 3a fe ff ff       	call   800d56 <file_write_direct>
+  800f1c:	eb e2                	jmp    800f00 <devfile_write+0xa4>
+
+00800f1e <devfile_trunc>:
+{
+  800f1e:	55                   	push   %ebp
+  800f1f:	89 e5                	mov    %esp,%ebp
+  800f21:	53                   	push   %ebx
+  800f22:	83 ec 10             	sub    $0x10,%esp
+  800f25:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  800f28:	53                   	push   %ebx
+  800f29:	e8 b5 fe ff ff       	call   800de3 <devfile_sync>
+  800f2e:	83 c4 10             	add    $0x10,%esp
+  800f31:	85 c0                	test   %eax,%eax
+  800f33:	78 1f                	js     800f54 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800f35:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f38:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800f3d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f40:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800f45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f4f:	e8 eb fd ff ff       	call   800d3f <fsipc>
+}
+  800f54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f57:	c9                   	leave
+  800f58:	c3                   	ret
+
+00800f59 <devfile_stat>:
+{
+  800f59:	55                   	push   %ebp
+  800f5a:	89 e5                	mov    %esp,%ebp
+  800f5c:	56                   	push   %esi
+  800f5d:	53                   	push   %ebx
+  800f5e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800f61:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+  800f67:	53                   	push   %ebx
+  800f68:	e8 76 fe ff ff       	call   800de3 <devfile_sync>
+  800f6d:	83 c4 10             	add    $0x10,%esp
+  800f70:	85 c0                	test   %eax,%eax
+  800f72:	78 47                	js     800fbb <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800f74:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f77:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800f7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f81:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f86:	e8 b4 fd ff ff       	call   800d3f <fsipc>
+  800f8b:	85 c0                	test   %eax,%eax
+  800f8d:	78 2c                	js     800fbb <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f8f:	83 ec 08             	sub    $0x8,%esp
+  800f92:	68 00 60 80 00       	push   $0x806000
+  800f97:	56                   	push   %esi
+  800f98:	e8 71 1c 00 00       	call   802c0e <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800f9d:	a1 80 60 80 00       	mov    0x806080,%eax
+  800fa2:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800fa8:	a1 84 60 80 00       	mov    0x806084,%eax
+  800fad:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  800fb3:	83 c4 10             	add    $0x10,%esp
+  800fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fbe:	5b                   	pop    %ebx
+  800fbf:	5e                   	pop    %esi
+  800fc0:	5d                   	pop    %ebp
+  800fc1:	c3                   	ret
+
+00800fc2 <devfile_flush>:
+{
+  800fc2:	55                   	push   %ebp
+  800fc3:	89 e5                	mov    %esp,%ebp
+  800fc5:	56                   	push   %esi
+  800fc6:	53                   	push   %ebx
+  800fc7:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  800fca:	83 ec 0c             	sub    $0xc,%esp
+  800fcd:	56                   	push   %esi
+  800fce:	e8 10 fe ff ff       	call   800de3 <devfile_sync>
+  800fd3:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  800fd5:	83 c4 10             	add    $0x10,%esp
+  800fd8:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  800fdc:	75 25                	jne    801003 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800fde:	8b 46 0c             	mov    0xc(%esi),%eax
+  800fe1:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  800fe6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800feb:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ff0:	e8 4a fd ff ff       	call   800d3f <fsipc>
+  800ff5:	85 c0                	test   %eax,%eax
+  800ff7:	0f 45 d8             	cmovne %eax,%ebx
+}
+  800ffa:	89 d8                	mov    %ebx,%eax
+  800ffc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fff:	5b                   	pop    %ebx
+  801000:	5e                   	pop    %esi
+  801001:	5d                   	pop    %ebp
+  801002:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801003:	83 ec 0c             	sub    $0xc,%esp
+  801006:	56                   	push   %esi
+  801007:	e8 8e f5 ff ff       	call   80059a <fd2data>
+  80100c:	83 c4 08             	add    $0x8,%esp
+  80100f:	50                   	push   %eax
+  801010:	6a 00                	push   $0x0
+  801012:	e8 ff f1 ff ff       	call   800216 <sys_page_unmap>
+  801017:	83 c4 10             	add    $0x10,%esp
+  80101a:	eb c2                	jmp    800fde <devfile_flush+0x1c>
+
+0080101c <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	57                   	push   %edi
+  801020:	56                   	push   %esi
+  801021:	53                   	push   %ebx
+  801022:	83 ec 64             	sub    $0x64,%esp
+  801025:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801027:	52                   	push   %edx
+  801028:	50                   	push   %eax
+  801029:	e8 d9 f5 ff ff       	call   800607 <fd_lookup>
+  80102e:	89 c1                	mov    %eax,%ecx
+  801030:	83 c4 10             	add    $0x10,%esp
+  801033:	85 c0                	test   %eax,%eax
+  801035:	0f 88 f2 00 00 00    	js     80112d <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  80103b:	8b 07                	mov    (%edi),%eax
+  80103d:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801043:	39 10                	cmp    %edx,(%eax)
+  801045:	0f 85 03 01 00 00    	jne    80114e <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  80104b:	a1 00 50 80 00       	mov    0x805000,%eax
+  801050:	8b 40 48             	mov    0x48(%eax),%eax
+  801053:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801059:	0f 84 96 00 00 00    	je     8010f5 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  80105f:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801066:	0f 84 cb 00 00 00    	je     801137 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80106c:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801071:	83 c8 07             	or     $0x7,%eax
+  801074:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801077:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80107a:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  80107f:	83 ec 04             	sub    $0x4,%esp
+  801082:	68 07 04 00 00       	push   $0x407
+  801087:	53                   	push   %ebx
+  801088:	6a 00                	push   $0x0
+  80108a:	e8 fa f0 ff ff       	call   800189 <sys_page_alloc>
+  80108f:	89 c1                	mov    %eax,%ecx
+  801091:	83 c4 10             	add    $0x10,%esp
+  801094:	85 c0                	test   %eax,%eax
+  801096:	0f 88 91 00 00 00    	js     80112d <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  80109c:	89 d8                	mov    %ebx,%eax
+  80109e:	83 c8 07             	or     $0x7,%eax
+  8010a1:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8010a3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8010a9:	83 c6 04             	add    $0x4,%esi
+  8010ac:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8010b2:	75 cb                	jne    80107f <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8010b4:	6a 12                	push   $0x12
+  8010b6:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8010b9:	50                   	push   %eax
+  8010ba:	6a 0c                	push   $0xc
+  8010bc:	ff 35 c8 70 80 00    	push   0x8070c8
+  8010c2:	e8 e2 22 00 00       	call   8033a9 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8010c7:	83 c4 0c             	add    $0xc,%esp
+  8010ca:	6a 00                	push   $0x0
+  8010cc:	6a 00                	push   $0x0
+  8010ce:	6a 00                	push   $0x0
+  8010d0:	e8 7e 21 00 00       	call   803253 <ipc_recv>
+  8010d5:	89 c1                	mov    %eax,%ecx
+  8010d7:	83 c4 10             	add    $0x10,%esp
+  8010da:	85 c0                	test   %eax,%eax
+  8010dc:	78 4f                	js     80112d <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  8010de:	a1 00 50 80 00       	mov    0x805000,%eax
+  8010e3:	8b 40 48             	mov    0x48(%eax),%eax
+  8010e6:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  8010eb:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  8010f2:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  8010f5:	83 ec 0c             	sub    $0xc,%esp
+  8010f8:	ff 37                	push   (%edi)
+  8010fa:	e8 e4 fc ff ff       	call   800de3 <devfile_sync>
+  8010ff:	89 c1                	mov    %eax,%ecx
+  801101:	83 c4 10             	add    $0x10,%esp
+  801104:	85 c0                	test   %eax,%eax
+  801106:	78 25                	js     80112d <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801108:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  80110e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801113:	ba 01 00 00 00       	mov    $0x1,%edx
+  801118:	89 d0                	mov    %edx,%eax
+  80111a:	d3 e0                	shl    %cl,%eax
+  80111c:	85 d8                	test   %ebx,%eax
+  80111e:	74 0d                	je     80112d <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801120:	83 c1 01             	add    $0x1,%ecx
+  801123:	83 f9 10             	cmp    $0x10,%ecx
+  801126:	75 f0                	jne    801118 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801128:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  80112d:	89 c8                	mov    %ecx,%eax
+  80112f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801132:	5b                   	pop    %ebx
+  801133:	5e                   	pop    %esi
+  801134:	5f                   	pop    %edi
+  801135:	5d                   	pop    %ebp
+  801136:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801137:	83 ec 0c             	sub    $0xc,%esp
+  80113a:	6a 01                	push   $0x1
+  80113c:	e8 b6 22 00 00       	call   8033f7 <ipc_find_env>
+  801141:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801146:	83 c4 10             	add    $0x10,%esp
+  801149:	e9 1e ff ff ff       	jmp    80106c <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  80114e:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801153:	eb d8                	jmp    80112d <fsring_slot+0x111>
+
+00801155 <file_read_direct>:
+{
+  801155:	55                   	push   %ebp
+  801156:	89 e5                	mov    %esp,%ebp
+  801158:	57                   	push   %edi
+  801159:	56                   	push   %esi
+  80115a:	53                   	push   %ebx
+  80115b:	83 ec 1c             	sub    $0x1c,%esp
+  80115e:	89 c7                	mov    %eax,%edi
+  801160:	89 d6                	mov    %edx,%esi
+  801162:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801164:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  80116a:	77 52                	ja     8011be <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80116c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80116f:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801174:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80117a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80117f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801184:	e8 b6 fb ff ff       	call   800d3f <fsipc>
+  801189:	89 c7                	mov    %eax,%edi
+  80118b:	85 c0                	test   %eax,%eax
+  80118d:	78 25                	js     8011b4 <file_read_direct+0x5f>
+	assert(r <= n);
+  80118f:	39 c3                	cmp    %eax,%ebx
+  801191:	0f 82 87 00 00 00    	jb     80121e <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801197:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80119c:	0f 8f 95 00 00 00    	jg     801237 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8011a2:	83 ec 04             	sub    $0x4,%esp
+  8011a5:	50                   	push   %eax
+  8011a6:	68 00 60 80 00       	push   $0x806000
+  8011ab:	56                   	push   %esi
+  8011ac:	e8 e3 1b 00 00       	call   802d94 <memmove>
+	return r;
+  8011b1:	83 c4 10             	add    $0x10,%esp
+}
+  8011b4:	89 f8                	mov    %edi,%eax
+  8011b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b9:	5b                   	pop    %ebx
+  8011ba:	5e                   	pop    %esi
+  8011bb:	5f                   	pop    %edi
+  8011bc:	5d                   	pop    %ebp
+  8011bd:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8011be:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8011c4:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8011c9:	29 d1                	sub    %edx,%ecx
+  8011cb:	39 d9                	cmp    %ebx,%ecx
+  8011cd:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011d0:	89 f0                	mov    %esi,%eax
+  8011d2:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8011d5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8011d8:	eb 0f                	jmp    8011e9 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8011da:	0f b6 10             	movzbl (%eax),%edx
+  8011dd:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011df:	05 00 10 00 00       	add    $0x1000,%eax
+  8011e4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011e9:	39 c8                	cmp    %ecx,%eax
+  8011eb:	72 ed                	jb     8011da <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  8011ed:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8011f0:	8b 47 0c             	mov    0xc(%edi),%eax
+  8011f3:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  8011f8:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8011fe:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801204:	83 ec 0c             	sub    $0xc,%esp
+  801207:	6a 07                	push   $0x7
+  801209:	89 d9                	mov    %ebx,%ecx
+  80120b:	89 f2                	mov    %esi,%edx
+  80120d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801212:	e8 86 f9 ff ff       	call   800b9d <fsipc_pages>
+  801217:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801219:	83 c4 10             	add    $0x10,%esp
+  80121c:	eb 96                	jmp    8011b4 <file_read_direct+0x5f>
+	assert(r <= n);
+  80121e:	68 68 38 80 00       	push   $0x803868
+  801223:	68 48 38 80 00       	push   $0x803848
+  801228:	68 dc 00 00 00       	push   $0xdc
+  80122d:	68 5d 38 80 00       	push   $0x80385d
+  801232:	e8 0e 13 00 00       	call   802545 <_panic>
+	assert(r <= PGSIZE);
+  801237:	68 79 38 80 00       	push   $0x803879
+  80123c:	68 48 38 80 00       	push   $0x803848
+  801241:	68 dd 00 00 00       	push   $0xdd
+  801246:	68 5d 38 80 00       	push   $0x80385d
+  80124b:	e8 f5 12 00 00       	call   802545 <_panic>
+
+00801250 <devfile_read>:
+{
+  801250:	55                   	push   %ebp
+  801251:	89 e5                	mov    %esp,%ebp
+  801253:	57                   	push   %edi
+  801254:	56                   	push   %esi
+  801255:	53                   	push   %ebx
+  801256:	83 ec 28             	sub    $0x28,%esp
+  801259:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80125c:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80125f:	53                   	push   %ebx
+  801260:	e8 35 f3 ff ff       	call   80059a <fd2data>
+  801265:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801268:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80126b:	83 c4 10             	add    $0x10,%esp
+  80126e:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801272:	74 7d                	je     8012f1 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801274:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801278:	0f 85 81 00 00 00    	jne    8012ff <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  80127e:	8b 43 18             	mov    0x18(%ebx),%eax
+  801281:	85 c0                	test   %eax,%eax
+  801283:	74 0d                	je     801292 <devfile_read+0x42>
+  801285:	8b 53 14             	mov    0x14(%ebx),%edx
+  801288:	39 fa                	cmp    %edi,%edx
+  80128a:	7f 06                	jg     801292 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  80128c:	01 c2                	add    %eax,%edx
+  80128e:	39 d7                	cmp    %edx,%edi
+  801290:	72 28                	jb     8012ba <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801292:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801299:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80129f:	77 74                	ja     801315 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8012a1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012a6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8012a9:	89 d8                	mov    %ebx,%eax
+  8012ab:	e8 a5 fe ff ff       	call   801155 <file_read_direct>
+  8012b0:	85 c0                	test   %eax,%eax
+  8012b2:	7e 35                	jle    8012e9 <devfile_read+0x99>
+		ff->buf_base = pos;
+  8012b4:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8012b7:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8012ba:	8b 53 14             	mov    0x14(%ebx),%edx
+  8012bd:	89 d0                	mov    %edx,%eax
+  8012bf:	03 43 18             	add    0x18(%ebx),%eax
+  8012c2:	29 f8                	sub    %edi,%eax
+  8012c4:	39 f0                	cmp    %esi,%eax
+  8012c6:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8012c9:	83 ec 04             	sub    $0x4,%esp
+  8012cc:	56                   	push   %esi
+  8012cd:	89 f8                	mov    %edi,%eax
+  8012cf:	29 d0                	sub    %edx,%eax
+  8012d1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8012d4:	01 c1                	add    %eax,%ecx
+  8012d6:	51                   	push   %ecx
+  8012d7:	ff 75 0c             	push   0xc(%ebp)
+  8012da:	e8 b5 1a 00 00       	call   802d94 <memmove>
+	fd->fd_offset = pos + n;
+  8012df:	01 f7                	add    %esi,%edi
+  8012e1:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8012e4:	89 f0                	mov    %esi,%eax
+  8012e6:	83 c4 10             	add    $0x10,%esp
+}
+  8012e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ec:	5b                   	pop    %ebx
+  8012ed:	5e                   	pop    %esi
+  8012ee:	5f                   	pop    %edi
+  8012ef:	5d                   	pop    %ebp
+  8012f0:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  8012f1:	89 f1                	mov    %esi,%ecx
+  8012f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012f6:	89 d8                	mov    %ebx,%eax
+  8012f8:	e8 58 fe ff ff       	call   801155 <file_read_direct>
+  8012fd:	eb ea                	jmp    8012e9 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8012ff:	83 ec 0c             	sub    $0xc,%esp
+  801302:	53                   	push   %ebx
+  801303:	e8 db fa ff ff       	call   800de3 <devfile_sync>
+  801308:	83 c4 10             	add    $0x10,%esp
+  80130b:	85 c0                	test   %eax,%eax
+  80130d:	0f 89 6b ff ff ff    	jns    80127e <devfile_read+0x2e>
+  801313:	eb d4                	jmp    8012e9 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801315:	89 f1                	mov    %esi,%ecx
+  801317:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80131a:	89 d8                	mov    %ebx,%eax
+  80131c:	e8 34 fe ff ff       	call   801155 <file_read_direct>
+  801321:	eb c6                	jmp    8012e9 <devfile_read+0x99>
+
+00801323 <open>:
+{
+  801323:	55                   	push   %ebp
+  801324:	89 e5                	mov    %esp,%ebp
+  801326:	56                   	push   %esi
+  801327:	53                   	push   %ebx
+  801328:	83 ec 1c             	sub    $0x1c,%esp
+  80132b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80132e:	56                   	push   %esi
+  80132f:	e8 9f 18 00 00       	call   802bd3 <strlen>
+  801334:	83 c4 10             	add    $0x10,%esp
+  801337:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80133c:	0f 8f a0 00 00 00    	jg     8013e2 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801342:	83 ec 0c             	sub    $0xc,%esp
+  801345:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801348:	50                   	push   %eax
+  801349:	e8 63 f2 ff ff       	call   8005b1 <fd_alloc>
+  80134e:	89 c3                	mov    %eax,%ebx
+  801350:	83 c4 10             	add    $0x10,%esp
+  801353:	85 c0                	test   %eax,%eax
+  801355:	78 45                	js     80139c <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801357:	83 ec 08             	sub    $0x8,%esp
+  80135a:	56                   	push   %esi
+  80135b:	68 00 60 80 00       	push   $0x806000
+  801360:	e8 a9 18 00 00       	call   802c0e <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801365:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801368:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80136d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801370:	b8 01 00 00 00       	mov    $0x1,%eax
+  801375:	e8 c5 f9 ff ff       	call   800d3f <fsipc>
+  80137a:	89 c3                	mov    %eax,%ebx
+  80137c:	83 c4 10             	add    $0x10,%esp
+  80137f:	85 c0                	test   %eax,%eax
+  801381:	78 22                	js     8013a5 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801383:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  80138a:	74 2b                	je     8013b7 <open+0x94>
+	return fd2num(fd);
+  80138c:	83 ec 0c             	sub    $0xc,%esp
+  80138f:	ff 75 f4             	push   -0xc(%ebp)
+  801392:	e8 f3 f1 ff ff       	call   80058a <fd2num>
+  801397:	89 c3                	mov    %eax,%ebx
+  801399:	83 c4 10             	add    $0x10,%esp
+}
+  80139c:	89 d8                	mov    %ebx,%eax
+  80139e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013a1:	5b                   	pop    %ebx
+  8013a2:	5e                   	pop    %esi
+  8013a3:	5d                   	pop    %ebp
+  8013a4:	c3                   	ret
+		fd_close(fd, 0);
+  8013a5:	83 ec 08             	sub    $0x8,%esp
+  8013a8:	6a 00                	push   $0x0
+  8013aa:	ff 75 f4             	push   -0xc(%ebp)
+  8013ad:	e8 f8 f2 ff ff       	call   8006aa <fd_close>
+		return r;
+  8013b2:	83 c4 10             	add    $0x10,%esp
+  8013b5:	eb e5                	jmp    80139c <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8013b7:	83 ec 0c             	sub    $0xc,%esp
+  8013ba:	ff 75 f4             	push   -0xc(%ebp)
+  8013bd:	e8 d8 f1 ff ff       	call   80059a <fd2data>
+  8013c2:	83 c4 0c             	add    $0xc,%esp
+  8013c5:	68 07 04 00 00       	push   $0x407
+  8013ca:	50                   	push   %eax
+  8013cb:	6a 00                	push   $0x0
+  8013cd:	e8 b7 ed ff ff       	call   800189 <sys_page_alloc>
+  8013d2:	83 c4 10             	add    $0x10,%esp
+  8013d5:	85 c0                	test   %eax,%eax
+  8013d7:	75 b3                	jne    80138c <open+0x69>
+		fd->fd_file.buffered = 1;
+  8013d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013dc:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8013e0:	eb aa                	jmp    80138c <open+0x69>
+		return -E_BAD_PATH;
+  8013e2:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8013e7:	eb b3                	jmp    80139c <open+0x79>
+
+008013e9 <readdir>:
+{
+  8013e9:	55                   	push   %ebp
+  8013ea:	89 e5                	mov    %esp,%ebp
+  8013ec:	53                   	push   %ebx
+  8013ed:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013f3:	50                   	push   %eax
+  8013f4:	ff 75 08             	push   0x8(%ebp)
+  8013f7:	e8 0b f2 ff ff       	call   800607 <fd_lookup>
+  8013fc:	89 c3                	mov    %eax,%ebx
+  8013fe:	83 c4 10             	add    $0x10,%esp
+  801401:	85 c0                	test   %eax,%eax
+  801403:	78 73                	js     801478 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801405:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801408:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80140e:	39 08                	cmp    %ecx,(%eax)
+  801410:	0f 85 82 00 00 00    	jne    801498 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801416:	83 ec 0c             	sub    $0xc,%esp
+  801419:	50                   	push   %eax
+  80141a:	e8 c4 f9 ff ff       	call   800de3 <devfile_sync>
+  80141f:	89 c3                	mov    %eax,%ebx
+  801421:	83 c4 10             	add    $0x10,%esp
+  801424:	85 c0                	test   %eax,%eax
+  801426:	78 50                	js     801478 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801428:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80142b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80142e:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801433:	8b 45 10             	mov    0x10(%ebp),%eax
+  801436:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  80143b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80143e:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801443:	ba 00 00 00 00       	mov    $0x0,%edx
+  801448:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80144d:	e8 ed f8 ff ff       	call   800d3f <fsipc>
+  801452:	89 c3                	mov    %eax,%ebx
+  801454:	85 c0                	test   %eax,%eax
+  801456:	7e 20                	jle    801478 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801458:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80145b:	72 22                	jb     80147f <readdir+0x96>
+  80145d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801462:	7f 1b                	jg     80147f <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801464:	83 ec 04             	sub    $0x4,%esp
+  801467:	50                   	push   %eax
+  801468:	68 00 60 80 00       	push   $0x806000
+  80146d:	ff 75 0c             	push   0xc(%ebp)
+  801470:	e8 1f 19 00 00       	call   802d94 <memmove>
+	return r;
+  801475:	83 c4 10             	add    $0x10,%esp
+}
+  801478:	89 d8                	mov    %ebx,%eax
+  80147a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80147d:	c9                   	leave
+  80147e:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  80147f:	68 6f 38 80 00       	push   $0x80386f
+  801484:	68 48 38 80 00       	push   $0x803848
+  801489:	68 86 01 00 00       	push   $0x186
+  80148e:	68 5d 38 80 00       	push   $0x80385d
+  801493:	e8 ad 10 00 00       	call   802545 <_panic>
+		return -E_NOT_SUPP;
+  801498:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80149d:	eb d9                	jmp    801478 <readdir+0x8f>
+
+0080149f <munmap>:
+{
+  80149f:	55                   	push   %ebp
+  8014a0:	89 e5                	mov    %esp,%ebp
+  8014a2:	56                   	push   %esi
+  8014a3:	53                   	push   %ebx
+  8014a4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8014aa:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8014b0:	75 41                	jne    8014f3 <munmap+0x54>
+  8014b2:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8014b8:	77 39                	ja     8014f3 <munmap+0x54>
+  8014ba:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8014bf:	29 f0                	sub    %esi,%eax
+  8014c1:	39 d0                	cmp    %edx,%eax
+  8014c3:	72 35                	jb     8014fa <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014c5:	89 f3                	mov    %esi,%ebx
+  8014c7:	01 d6                	add    %edx,%esi
+  8014c9:	39 f3                	cmp    %esi,%ebx
+  8014cb:	73 1a                	jae    8014e7 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8014cd:	83 ec 08             	sub    $0x8,%esp
+  8014d0:	53                   	push   %ebx
+  8014d1:	6a 00                	push   $0x0
+  8014d3:	e8 3e ed ff ff       	call   800216 <sys_page_unmap>
+  8014d8:	83 c4 10             	add    $0x10,%esp
+  8014db:	85 c0                	test   %eax,%eax
+  8014dd:	78 0d                	js     8014ec <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014df:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8014e5:	eb e2                	jmp    8014c9 <munmap+0x2a>
+	return 0;
+  8014e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014ef:	5b                   	pop    %ebx
+  8014f0:	5e                   	pop    %esi
+  8014f1:	5d                   	pop    %ebp
+  8014f2:	c3                   	ret
+		return -E_INVAL;
+  8014f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014f8:	eb f2                	jmp    8014ec <munmap+0x4d>
+  8014fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014ff:	eb eb                	jmp    8014ec <munmap+0x4d>
+
+00801501 <mmap>:
+{
+  801501:	55                   	push   %ebp
+  801502:	89 e5                	mov    %esp,%ebp
+  801504:	57                   	push   %edi
+  801505:	56                   	push   %esi
+  801506:	53                   	push   %ebx
+  801507:	83 ec 34             	sub    $0x34,%esp
+  80150a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80150d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801510:	50                   	push   %eax
+  801511:	ff 75 18             	push   0x18(%ebp)
+  801514:	e8 ee f0 ff ff       	call   800607 <fd_lookup>
+  801519:	89 c3                	mov    %eax,%ebx
+  80151b:	83 c4 10             	add    $0x10,%esp
+  80151e:	85 c0                	test   %eax,%eax
+  801520:	0f 88 0e 01 00 00    	js     801634 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801526:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801529:	a1 20 40 80 00       	mov    0x804020,%eax
+  80152e:	39 02                	cmp    %eax,(%edx)
+  801530:	0f 85 50 01 00 00    	jne    801686 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801536:	8b 45 10             	mov    0x10(%ebp),%eax
+  801539:	83 e0 02             	and    $0x2,%eax
+  80153c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80153f:	74 0a                	je     80154b <mmap+0x4a>
+  801541:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801545:	0f 84 42 01 00 00    	je     80168d <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  80154b:	8b 42 08             	mov    0x8(%edx),%eax
+  80154e:	83 e0 03             	and    $0x3,%eax
+  801551:	83 f8 01             	cmp    $0x1,%eax
+  801554:	0f 84 3a 01 00 00    	je     801694 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  80155a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80155d:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801560:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801565:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801568:	0f 85 2d 01 00 00    	jne    80169b <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80156e:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801572:	0f 88 2a 01 00 00    	js     8016a2 <mmap+0x1a1>
+  801578:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80157f:	0f 87 1d 01 00 00    	ja     8016a2 <mmap+0x1a1>
+  801585:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80158a:	2b 45 08             	sub    0x8(%ebp),%eax
+  80158d:	39 f8                	cmp    %edi,%eax
+  80158f:	0f 82 14 01 00 00    	jb     8016a9 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  801595:	83 ec 0c             	sub    $0xc,%esp
+  801598:	52                   	push   %edx
+  801599:	e8 45 f8 ff ff       	call   800de3 <devfile_sync>
+  80159e:	89 c3                	mov    %eax,%ebx
+  8015a0:	83 c4 10             	add    $0x10,%esp
+  8015a3:	85 c0                	test   %eax,%eax
+  8015a5:	0f 88 89 00 00 00    	js     801634 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8015ab:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8015b1:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8015b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bc:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8015bf:	39 fe                	cmp    %edi,%esi
+  8015c1:	73 7b                	jae    80163e <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8015c3:	89 f8                	mov    %edi,%eax
+  8015c5:	29 f0                	sub    %esi,%eax
+  8015c7:	c1 e8 0c             	shr    $0xc,%eax
+  8015ca:	ba 40 00 00 00       	mov    $0x40,%edx
+  8015cf:	39 d0                	cmp    %edx,%eax
+  8015d1:	0f 47 c2             	cmova  %edx,%eax
+  8015d4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8015d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015da:	8b 52 0c             	mov    0xc(%edx),%edx
+  8015dd:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  8015e3:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8015e6:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  8015ec:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8015f1:	89 f2                	mov    %esi,%edx
+  8015f3:	03 55 08             	add    0x8(%ebp),%edx
+  8015f6:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8015f9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015fe:	e8 ea f6 ff ff       	call   800ced <fsipcv>
+  801603:	85 c0                	test   %eax,%eax
+  801605:	7e 12                	jle    801619 <mmap+0x118>
+  801607:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80160a:	85 c0                	test   %eax,%eax
+  80160c:	0f 84 9e 00 00 00    	je     8016b0 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801612:	c1 e0 0c             	shl    $0xc,%eax
+  801615:	01 c6                	add    %eax,%esi
+  801617:	eb a6                	jmp    8015bf <mmap+0xbe>
+			munmap(addr, done);
+  801619:	89 c3                	mov    %eax,%ebx
+  80161b:	83 ec 08             	sub    $0x8,%esp
+  80161e:	56                   	push   %esi
+  80161f:	ff 75 08             	push   0x8(%ebp)
+  801622:	e8 78 fe ff ff       	call   80149f <munmap>
+			return r < 0 ? r : -E_INVAL;
+  801627:	83 c4 10             	add    $0x10,%esp
+  80162a:	85 db                	test   %ebx,%ebx
+  80162c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801631:	0f 49 d8             	cmovns %eax,%ebx
+}
+  801634:	89 d8                	mov    %ebx,%eax
+  801636:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801639:	5b                   	pop    %ebx
+  80163a:	5e                   	pop    %esi
+  80163b:	5f                   	pop    %edi
+  80163c:	5d                   	pop    %ebp
+  80163d:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80163e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  801641:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  801643:	85 c0                	test   %eax,%eax
+  801645:	74 ed                	je     801634 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  801647:	be 00 00 00 00       	mov    $0x0,%esi
+  80164c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80164f:	39 fe                	cmp    %edi,%esi
+  801651:	73 2e                	jae    801681 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  801653:	83 ec 0c             	sub    $0xc,%esp
+  801656:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  801659:	50                   	push   %eax
+  80165a:	e8 f6 19 00 00       	call   803055 <cowpage>
+  80165f:	83 c4 10             	add    $0x10,%esp
+  801662:	85 c0                	test   %eax,%eax
+  801664:	78 08                	js     80166e <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  801666:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80166c:	eb e1                	jmp    80164f <mmap+0x14e>
+				munmap(addr, len);
+  80166e:	89 c3                	mov    %eax,%ebx
+  801670:	83 ec 08             	sub    $0x8,%esp
+  801673:	57                   	push   %edi
+  801674:	ff 75 08             	push   0x8(%ebp)
+  801677:	e8 23 fe ff ff       	call   80149f <munmap>
+				return r;
+  80167c:	83 c4 10             	add    $0x10,%esp
+  80167f:	eb b3                	jmp    801634 <mmap+0x133>
+	return 0;
+  801681:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801684:	eb ae                	jmp    801634 <mmap+0x133>
+		return -E_NOT_SUPP;
+  801686:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80168b:	eb a7                	jmp    801634 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80168d:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801692:	eb a0                	jmp    801634 <mmap+0x133>
+		return -E_INVAL;
+  801694:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801699:	eb 99                	jmp    801634 <mmap+0x133>
+  80169b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016a0:	eb 92                	jmp    801634 <mmap+0x133>
+  8016a2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016a7:	eb 8b                	jmp    801634 <mmap+0x133>
+  8016a9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016ae:	eb 84                	jmp    801634 <mmap+0x133>
+			munmap(addr, done);
+  8016b0:	83 ec 08             	sub    $0x8,%esp
+  8016b3:	56                   	push   %esi
+  8016b4:	ff 75 08             	push   0x8(%ebp)
+  8016b7:	e8 e3 fd ff ff       	call   80149f <munmap>
+  8016bc:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8016bf:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016c4:	e9 6b ff ff ff       	jmp    801634 <mmap+0x133>
+
+008016c9 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8016c9:	55                   	push   %ebp
+  8016ca:	89 e5                	mov    %esp,%ebp
+  8016cc:	56                   	push   %esi
+  8016cd:	53                   	push   %ebx
+  8016ce:	83 ec 10             	sub    $0x10,%esp
+  8016d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8016d4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016da:	e8 3d f9 ff ff       	call   80101c <fsring_slot>
+  8016df:	85 c0                	test   %eax,%eax
+  8016e1:	78 60                	js     801743 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8016e3:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8016e6:	8b 56 08             	mov    0x8(%esi),%edx
+  8016e9:	83 e2 03             	and    $0x3,%edx
+  8016ec:	83 fa 01             	cmp    $0x1,%edx
+  8016ef:	74 59                	je     80174a <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8016f1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8016f6:	89 c1                	mov    %eax,%ecx
+  8016f8:	d3 e2                	shl    %cl,%edx
+  8016fa:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  801700:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  801703:	c1 e2 02             	shl    $0x2,%edx
+  801706:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  80170c:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  801713:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  801716:	8b 55 18             	mov    0x18(%ebp),%edx
+  801719:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80171c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80171f:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  801722:	83 ec 08             	sub    $0x8,%esp
+  801725:	50                   	push   %eax
+  801726:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80172b:	39 c3                	cmp    %eax,%ebx
+  80172d:	0f 47 d8             	cmova  %eax,%ebx
+  801730:	53                   	push   %ebx
+  801731:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801734:	89 f2                	mov    %esi,%edx
+  801736:	b8 03 00 00 00       	mov    $0x3,%eax
+  80173b:	e8 1e f5 ff ff       	call   800c5e <fsring_post>
+  801740:	83 c4 10             	add    $0x10,%esp
+}
+  801743:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801746:	5b                   	pop    %ebx
+  801747:	5e                   	pop    %esi
+  801748:	5d                   	pop    %ebp
+  801749:	c3                   	ret
+		return -E_INVAL;
+  80174a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80174f:	eb f2                	jmp    801743 <fsring_read+0x7a>
+
+00801751 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  801751:	55                   	push   %ebp
+  801752:	89 e5                	mov    %esp,%ebp
+  801754:	56                   	push   %esi
+  801755:	53                   	push   %ebx
+  801756:	83 ec 10             	sub    $0x10,%esp
+  801759:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80175c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80175f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801762:	e8 b5 f8 ff ff       	call   80101c <fsring_slot>
+  801767:	89 c3                	mov    %eax,%ebx
+  801769:	85 c0                	test   %eax,%eax
+  80176b:	78 77                	js     8017e4 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80176d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801770:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801774:	74 77                	je     8017ed <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  801776:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80177b:	39 c6                	cmp    %eax,%esi
+  80177d:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  801780:	83 ec 04             	sub    $0x4,%esp
+  801783:	56                   	push   %esi
+  801784:	ff 75 0c             	push   0xc(%ebp)
+  801787:	89 d8                	mov    %ebx,%eax
+  801789:	c1 e0 0c             	shl    $0xc,%eax
+  80178c:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  801792:	50                   	push   %eax
+  801793:	e8 fc 15 00 00       	call   802d94 <memmove>
+	fsring_busy |= 1 << slot;
+  801798:	b8 01 00 00 00       	mov    $0x1,%eax
+  80179d:	89 d9                	mov    %ebx,%ecx
+  80179f:	d3 e0                	shl    %cl,%eax
+  8017a1:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8017a7:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8017aa:	c1 e0 02             	shl    $0x2,%eax
+  8017ad:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8017b3:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8017ba:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8017bd:	8b 45 18             	mov    0x18(%ebp),%eax
+  8017c0:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8017c3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8017ca:	83 c4 08             	add    $0x8,%esp
+  8017cd:	53                   	push   %ebx
+  8017ce:	56                   	push   %esi
+  8017cf:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8017d2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8017d5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017da:	e8 7f f4 ff ff       	call   800c5e <fsring_post>
+  8017df:	89 c3                	mov    %eax,%ebx
+  8017e1:	83 c4 10             	add    $0x10,%esp
+}
+  8017e4:	89 d8                	mov    %ebx,%eax
+  8017e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e9:	5b                   	pop    %ebx
+  8017ea:	5e                   	pop    %esi
+  8017eb:	5d                   	pop    %ebp
+  8017ec:	c3                   	ret
+		return -E_INVAL;
+  8017ed:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8017f2:	eb f0                	jmp    8017e4 <fsring_write+0x93>
+
+008017f4 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8017f4:	55                   	push   %ebp
+  8017f5:	89 e5                	mov    %esp,%ebp
+  8017f7:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8017fa:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8017fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801800:	e8 17 f8 ff ff       	call   80101c <fsring_slot>
+  801805:	85 c0                	test   %eax,%eax
+  801807:	78 4c                	js     801855 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  801809:	ba 01 00 00 00       	mov    $0x1,%edx
+  80180e:	89 c1                	mov    %eax,%ecx
+  801810:	d3 e2                	shl    %cl,%edx
+  801812:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  801818:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80181b:	c1 e2 02             	shl    $0x2,%edx
+  80181e:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  801824:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  80182b:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80182e:	8b 55 10             	mov    0x10(%ebp),%edx
+  801831:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  801834:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801837:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80183a:	83 ec 08             	sub    $0x8,%esp
+  80183d:	50                   	push   %eax
+  80183e:	6a 00                	push   $0x0
+  801840:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801845:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801848:	b8 05 00 00 00       	mov    $0x5,%eax
+  80184d:	e8 0c f4 ff ff       	call   800c5e <fsring_post>
+  801852:	83 c4 10             	add    $0x10,%esp
+}
+  801855:	c9                   	leave
+  801856:	c3                   	ret
+
+00801857 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  801857:	55                   	push   %ebp
+  801858:	89 e5                	mov    %esp,%ebp
+  80185a:	57                   	push   %edi
+  80185b:	56                   	push   %esi
+  80185c:	53                   	push   %ebx
+  80185d:	83 ec 1c             	sub    $0x1c,%esp
+  801860:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  801864:	a1 00 50 80 00       	mov    0x805000,%eax
+  801869:	8b 40 48             	mov    0x48(%eax),%eax
+  80186c:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801872:	74 12                	je     801886 <fsring_reap+0x2f>
+		return 0;
+  801874:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  801879:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80187c:	5b                   	pop    %ebx
+  80187d:	5e                   	pop    %esi
+  80187e:	5f                   	pop    %edi
+  80187f:	5d                   	pop    %ebp
+  801880:	c3                   	ret
+		sys_yield();
+  801881:	e8 e4 e8 ff ff       	call   80016a <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  801886:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  80188c:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  801891:	39 c2                	cmp    %eax,%edx
+  801893:	75 18                	jne    8018ad <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  801895:	84 db                	test   %bl,%bl
+  801897:	0f 84 21 01 00 00    	je     8019be <fsring_reap+0x167>
+  80189d:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  8018a4:	75 db                	jne    801881 <fsring_reap+0x2a>
+			return 0;
+  8018a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ab:	eb cc                	jmp    801879 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8018ad:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018b2:	83 e0 0f             	and    $0xf,%eax
+  8018b5:	83 c0 2a             	add    $0x2a,%eax
+  8018b8:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8018bf:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8018c6:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018cb:	83 c0 01             	add    $0x1,%eax
+  8018ce:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8018d3:	83 fb 0f             	cmp    $0xf,%ebx
+  8018d6:	77 5b                	ja     801933 <fsring_reap+0xdc>
+  8018d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8018dd:	89 d9                	mov    %ebx,%ecx
+  8018df:	d3 e6                	shl    %cl,%esi
+  8018e1:	89 f0                	mov    %esi,%eax
+  8018e3:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8018e9:	74 48                	je     801933 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8018eb:	89 d8                	mov    %ebx,%eax
+  8018ed:	c1 e0 0c             	shl    $0xc,%eax
+  8018f0:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8018f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8018f9:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8018fc:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  801903:	83 f8 03             	cmp    $0x3,%eax
+  801906:	74 40                	je     801948 <fsring_reap+0xf1>
+  801908:	83 f8 05             	cmp    $0x5,%eax
+  80190b:	74 64                	je     801971 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  80190d:	f7 d6                	not    %esi
+  80190f:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  801915:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801918:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  80191f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801922:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  801924:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801927:	89 38                	mov    %edi,(%eax)
+	return 1;
+  801929:	b8 01 00 00 00       	mov    $0x1,%eax
+  80192e:	e9 46 ff ff ff       	jmp    801879 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  801933:	53                   	push   %ebx
+  801934:	68 85 38 80 00       	push   $0x803885
+  801939:	68 8f 02 00 00       	push   $0x28f
+  80193e:	68 5d 38 80 00       	push   $0x80385d
+  801943:	e8 fd 0b 00 00       	call   802545 <_panic>
+		if (cqe.cqe_result > 0)
+  801948:	85 ff                	test   %edi,%edi
+  80194a:	7e c1                	jle    80190d <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80194c:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80194f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801954:	39 c7                	cmp    %eax,%edi
+  801956:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801959:	50                   	push   %eax
+  80195a:	ff 75 e4             	push   -0x1c(%ebp)
+  80195d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801960:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  801967:	e8 28 14 00 00       	call   802d94 <memmove>
+  80196c:	83 c4 10             	add    $0x10,%esp
+  80196f:	eb 9c                	jmp    80190d <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  801971:	85 ff                	test   %edi,%edi
+  801973:	75 98                	jne    80190d <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  801975:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801978:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80197f:	83 ec 08             	sub    $0x8,%esp
+  801982:	ff 75 e4             	push   -0x1c(%ebp)
+  801985:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801988:	51                   	push   %ecx
+  801989:	e8 80 12 00 00       	call   802c0e <strcpy>
+			st->st_size = ret->ret_size;
+  80198e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801991:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  801997:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80199a:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8019a0:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8019a6:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8019ac:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8019b3:	40 80 00 
+  8019b6:	83 c4 10             	add    $0x10,%esp
+  8019b9:	e9 4f ff ff ff       	jmp    80190d <fsring_reap+0xb6>
+			return 0;
+  8019be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c3:	e9 b1 fe ff ff       	jmp    801879 <fsring_reap+0x22>
+
+008019c8 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8019c8:	55                   	push   %ebp
+  8019c9:	89 e5                	mov    %esp,%ebp
+  8019cb:	57                   	push   %edi
+  8019cc:	56                   	push   %esi
+  8019cd:	53                   	push   %ebx
+  8019ce:	83 ec 28             	sub    $0x28,%esp
+  8019d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8019d7:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8019da:	53                   	push   %ebx
+  8019db:	e8 f3 11 00 00       	call   802bd3 <strlen>
+  8019e0:	83 c4 10             	add    $0x10,%esp
+  8019e3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019e8:	0f 8f 02 01 00 00    	jg     801af0 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8019ee:	83 ec 08             	sub    $0x8,%esp
+  8019f1:	53                   	push   %ebx
+  8019f2:	68 00 60 80 00       	push   $0x806000
+  8019f7:	e8 12 12 00 00       	call   802c0e <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8019fc:	83 c4 10             	add    $0x10,%esp
+  8019ff:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  801a05:	76 69                	jbe    801a70 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801a07:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a0a:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801a10:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801a15:	29 d1                	sub    %edx,%ecx
+  801a17:	39 f9                	cmp    %edi,%ecx
+  801a19:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a1f:	89 f9                	mov    %edi,%ecx
+  801a21:	01 c1                	add    %eax,%ecx
+  801a23:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a26:	eb 0f                	jmp    801a37 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  801a28:	0f b6 10             	movzbl (%eax),%edx
+  801a2b:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a2d:	05 00 10 00 00       	add    $0x1000,%eax
+  801a32:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a37:	39 c8                	cmp    %ecx,%eax
+  801a39:	72 ed                	jb     801a28 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  801a3b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a3e:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  801a44:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  801a4a:	83 ec 0c             	sub    $0xc,%esp
+  801a4d:	6a 07                	push   $0x7
+  801a4f:	89 f9                	mov    %edi,%ecx
+  801a51:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a54:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a59:	e8 3f f1 ff ff       	call   800b9d <fsipc_pages>
+  801a5e:	89 c7                	mov    %eax,%edi
+  801a60:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  801a63:	85 f6                	test   %esi,%esi
+  801a65:	74 7f                	je     801ae6 <file_slurp+0x11e>
+  801a67:	8d 43 01             	lea    0x1(%ebx),%eax
+  801a6a:	85 ff                	test   %edi,%edi
+  801a6c:	79 3c                	jns    801aaa <file_slurp+0xe2>
+  801a6e:	eb 76                	jmp    801ae6 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  801a70:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  801a76:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a7b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a80:	e8 ba f2 ff ff       	call   800d3f <fsipc>
+  801a85:	89 c7                	mov    %eax,%edi
+  801a87:	85 c0                	test   %eax,%eax
+  801a89:	7e d8                	jle    801a63 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  801a8b:	83 ec 04             	sub    $0x4,%esp
+  801a8e:	50                   	push   %eax
+  801a8f:	68 08 60 80 00       	push   $0x806008
+  801a94:	ff 75 0c             	push   0xc(%ebp)
+  801a97:	e8 f8 12 00 00       	call   802d94 <memmove>
+  801a9c:	83 c4 10             	add    $0x10,%esp
+  801a9f:	eb c2                	jmp    801a63 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  801aa1:	80 fa 2f             	cmp    $0x2f,%dl
+  801aa4:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  801aa7:	83 c0 01             	add    $0x1,%eax
+  801aaa:	89 c1                	mov    %eax,%ecx
+  801aac:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  801ab0:	84 d2                	test   %dl,%dl
+  801ab2:	75 ed                	jne    801aa1 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  801ab4:	83 ec 04             	sub    $0x4,%esp
+  801ab7:	68 80 00 00 00       	push   $0x80
+  801abc:	53                   	push   %ebx
+  801abd:	56                   	push   %esi
+  801abe:	e8 c1 11 00 00       	call   802c84 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  801ac3:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ac8:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  801ace:	a1 04 60 80 00       	mov    0x806004,%eax
+  801ad3:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  801ad9:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  801ae0:	40 80 00 
+  801ae3:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801ae6:	89 f8                	mov    %edi,%eax
+  801ae8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aeb:	5b                   	pop    %ebx
+  801aec:	5e                   	pop    %esi
+  801aed:	5f                   	pop    %edi
+  801aee:	5d                   	pop    %ebp
+  801aef:	c3                   	ret
+		return -E_BAD_PATH;
+  801af0:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  801af5:	eb ef                	jmp    801ae6 <file_slurp+0x11e>
+
+00801af7 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801af7:	55                   	push   %ebp
+  801af8:	89 e5                	mov    %esp,%ebp
+  801afa:	53                   	push   %ebx
+  801afb:	83 ec 10             	sub    $0x10,%esp
+  801afe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b01:	53                   	push   %ebx
+  801b02:	e8 cc 10 00 00       	call   802bd3 <strlen>
+  801b07:	83 c4 10             	add    $0x10,%esp
+  801b0a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b0f:	7f 25                	jg     801b36 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b11:	83 ec 08             	sub    $0x8,%esp
+  801b14:	53                   	push   %ebx
+  801b15:	68 00 60 80 00       	push   $0x806000
+  801b1a:	e8 ef 10 00 00       	call   802c0e <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b24:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b29:	e8 11 f2 ff ff       	call   800d3f <fsipc>
+  801b2e:	83 c4 10             	add    $0x10,%esp
+}
+  801b31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b34:	c9                   	leave
+  801b35:	c3                   	ret
+		return -E_BAD_PATH;
+  801b36:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b3b:	eb f4                	jmp    801b31 <remove+0x3a>
+
+00801b3d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b3d:	55                   	push   %ebp
+  801b3e:	89 e5                	mov    %esp,%ebp
+  801b40:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b43:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b48:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b4d:	e8 ed f1 ff ff       	call   800d3f <fsipc>
+}
+  801b52:	c9                   	leave
+  801b53:	c3                   	ret
+
+00801b54 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  801b54:	55                   	push   %ebp
+  801b55:	89 e5                	mov    %esp,%ebp
+  801b57:	57                   	push   %edi
+  801b58:	56                   	push   %esi
+  801b59:	53                   	push   %ebx
+  801b5a:	83 ec 18             	sub    $0x18,%esp
+  801b5d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b60:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801b66:	57                   	push   %edi
+  801b67:	e8 67 10 00 00       	call   802bd3 <strlen>
+  801b6c:	83 c4 10             	add    $0x10,%esp
+  801b6f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b74:	7f 4c                	jg     801bc2 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  801b76:	83 ec 08             	sub    $0x8,%esp
+  801b79:	57                   	push   %edi
+  801b7a:	68 00 60 80 00       	push   $0x806000
+  801b7f:	e8 8a 10 00 00       	call   802c0e <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  801b84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b89:	b8 10 00 00 00       	mov    $0x10,%eax
+  801b8e:	e8 ac f1 ff ff       	call   800d3f <fsipc>
+  801b93:	83 c4 10             	add    $0x10,%esp
+  801b96:	85 c0                	test   %eax,%eax
+  801b98:	78 20                	js     801bba <defrag+0x66>
+		return r;
+	if (before)
+  801b9a:	85 f6                	test   %esi,%esi
+  801b9c:	74 07                	je     801ba5 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  801b9e:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ba3:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  801ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  801baa:	85 db                	test   %ebx,%ebx
+  801bac:	74 0c                	je     801bba <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  801bae:	a1 04 60 80 00       	mov    0x806004,%eax
+  801bb3:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  801bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bbd:	5b                   	pop    %ebx
+  801bbe:	5e                   	pop    %esi
+  801bbf:	5f                   	pop    %edi
+  801bc0:	5d                   	pop    %ebp
+  801bc1:	c3                   	ret
+		return -E_BAD_PATH;
+  801bc2:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801bc7:	eb f1                	jmp    801bba <defrag+0x66>
+
+00801bc9 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  801bc9:	55                   	push   %ebp
+  801bca:	89 e5                	mov    %esp,%ebp
+  801bcc:	53                   	push   %ebx
+  801bcd:	83 ec 04             	sub    $0x4,%esp
+  801bd0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  801bd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd8:	b8 11 00 00 00       	mov    $0x11,%eax
+  801bdd:	e8 5d f1 ff ff       	call   800d3f <fsipc>
+  801be2:	85 c0                	test   %eax,%eax
+  801be4:	78 34                	js     801c1a <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  801be6:	a1 00 60 80 00       	mov    0x806000,%eax
+  801beb:	89 03                	mov    %eax,(%ebx)
+  801bed:	a1 04 60 80 00       	mov    0x806004,%eax
+  801bf2:	89 43 04             	mov    %eax,0x4(%ebx)
+  801bf5:	a1 08 60 80 00       	mov    0x806008,%eax
+  801bfa:	89 43 08             	mov    %eax,0x8(%ebx)
+  801bfd:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  801c02:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801c05:	a1 10 60 80 00       	mov    0x806010,%eax
+  801c0a:	89 43 10             	mov    %eax,0x10(%ebx)
+  801c0d:	a1 14 60 80 00       	mov    0x806014,%eax
+  801c12:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  801c15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c1d:	c9                   	leave
+  801c1e:	c3                   	ret
+
+00801c1f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c1f:	55                   	push   %ebp
+  801c20:	89 e5                	mov    %esp,%ebp
+  801c22:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c25:	68 9e 38 80 00       	push   $0x80389e
+  801c2a:	ff 75 0c             	push   0xc(%ebp)
+  801c2d:	e8 dc 0f 00 00       	call   802c0e <strcpy>
+	return 0;
+}
+  801c32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c37:	c9                   	leave
+  801c38:	c3                   	ret
+
+00801c39 <devsock_close>:
+{
+  801c39:	55                   	push   %ebp
+  801c3a:	89 e5                	mov    %esp,%ebp
+  801c3c:	53                   	push   %ebx
+  801c3d:	83 ec 10             	sub    $0x10,%esp
+  801c40:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c43:	53                   	push   %ebx
+  801c44:	e8 ed 17 00 00       	call   803436 <pageref>
+  801c49:	89 c2                	mov    %eax,%edx
+  801c4b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c53:	83 fa 01             	cmp    $0x1,%edx
+  801c56:	74 05                	je     801c5d <devsock_close+0x24>
+}
+  801c58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c5b:	c9                   	leave
+  801c5c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c5d:	83 ec 0c             	sub    $0xc,%esp
+  801c60:	ff 73 0c             	push   0xc(%ebx)
+  801c63:	e8 b7 02 00 00       	call   801f1f <nsipc_close>
+  801c68:	83 c4 10             	add    $0x10,%esp
+  801c6b:	eb eb                	jmp    801c58 <devsock_close+0x1f>
+
+00801c6d <devsock_write>:
+{
+  801c6d:	55                   	push   %ebp
+  801c6e:	89 e5                	mov    %esp,%ebp
+  801c70:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c73:	6a 00                	push   $0x0
+  801c75:	ff 75 10             	push   0x10(%ebp)
+  801c78:	ff 75 0c             	push   0xc(%ebp)
+  801c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7e:	ff 70 0c             	push   0xc(%eax)
+  801c81:	e8 79 03 00 00       	call   801fff <nsipc_send>
+}
+  801c86:	c9                   	leave
+  801c87:	c3                   	ret
+
+00801c88 <devsock_read>:
+{
+  801c88:	55                   	push   %ebp
+  801c89:	89 e5                	mov    %esp,%ebp
+  801c8b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801c8e:	6a 00                	push   $0x0
+  801c90:	ff 75 10             	push   0x10(%ebp)
+  801c93:	ff 75 0c             	push   0xc(%ebp)
+  801c96:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c99:	ff 70 0c             	push   0xc(%eax)
+  801c9c:	e8 ef 02 00 00       	call   801f90 <nsipc_recv>
+}
+  801ca1:	c9                   	leave
+  801ca2:	c3                   	ret
+
+00801ca3 <fd2sockid>:
+{
+  801ca3:	55                   	push   %ebp
+  801ca4:	89 e5                	mov    %esp,%ebp
+  801ca6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801ca9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801cac:	52                   	push   %edx
+  801cad:	50                   	push   %eax
+  801cae:	e8 54 e9 ff ff       	call   800607 <fd_lookup>
+  801cb3:	83 c4 10             	add    $0x10,%esp
+  801cb6:	85 c0                	test   %eax,%eax
+  801cb8:	78 10                	js     801cca <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801cba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cbd:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801cc3:	39 08                	cmp    %ecx,(%eax)
+  801cc5:	75 05                	jne    801ccc <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801cc7:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801cca:	c9                   	leave
+  801ccb:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ccc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cd1:	eb f7                	jmp    801cca <fd2sockid+0x27>
+
+00801cd3 <alloc_sockfd>:
+{
+  801cd3:	55                   	push   %ebp
+  801cd4:	89 e5                	mov    %esp,%ebp
+  801cd6:	56                   	push   %esi
+  801cd7:	53                   	push   %ebx
+  801cd8:	83 ec 1c             	sub    $0x1c,%esp
+  801cdb:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801cdd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ce0:	50                   	push   %eax
+  801ce1:	e8 cb e8 ff ff       	call   8005b1 <fd_alloc>
+  801ce6:	89 c3                	mov    %eax,%ebx
+  801ce8:	83 c4 10             	add    $0x10,%esp
+  801ceb:	85 c0                	test   %eax,%eax
+  801ced:	78 43                	js     801d32 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801cef:	83 ec 04             	sub    $0x4,%esp
+  801cf2:	68 07 04 00 00       	push   $0x407
+  801cf7:	ff 75 f4             	push   -0xc(%ebp)
+  801cfa:	6a 00                	push   $0x0
+  801cfc:	e8 88 e4 ff ff       	call   800189 <sys_page_alloc>
+  801d01:	89 c3                	mov    %eax,%ebx
+  801d03:	83 c4 10             	add    $0x10,%esp
+  801d06:	85 c0                	test   %eax,%eax
+  801d08:	78 28                	js     801d32 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801d0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d0d:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801d13:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d18:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d1f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d22:	83 ec 0c             	sub    $0xc,%esp
+  801d25:	50                   	push   %eax
+  801d26:	e8 5f e8 ff ff       	call   80058a <fd2num>
+  801d2b:	89 c3                	mov    %eax,%ebx
+  801d2d:	83 c4 10             	add    $0x10,%esp
+  801d30:	eb 0c                	jmp    801d3e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d32:	83 ec 0c             	sub    $0xc,%esp
+  801d35:	56                   	push   %esi
+  801d36:	e8 e4 01 00 00       	call   801f1f <nsipc_close>
+		return r;
+  801d3b:	83 c4 10             	add    $0x10,%esp
+}
+  801d3e:	89 d8                	mov    %ebx,%eax
+  801d40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d43:	5b                   	pop    %ebx
+  801d44:	5e                   	pop    %esi
+  801d45:	5d                   	pop    %ebp
+  801d46:	c3                   	ret
+
+00801d47 <accept>:
+{
+  801d47:	55                   	push   %ebp
+  801d48:	89 e5                	mov    %esp,%ebp
+  801d4a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d50:	e8 4e ff ff ff       	call   801ca3 <fd2sockid>
+  801d55:	85 c0                	test   %eax,%eax
+  801d57:	78 1b                	js     801d74 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d59:	83 ec 04             	sub    $0x4,%esp
+  801d5c:	ff 75 10             	push   0x10(%ebp)
+  801d5f:	ff 75 0c             	push   0xc(%ebp)
+  801d62:	50                   	push   %eax
+  801d63:	e8 0e 01 00 00       	call   801e76 <nsipc_accept>
+  801d68:	83 c4 10             	add    $0x10,%esp
+  801d6b:	85 c0                	test   %eax,%eax
+  801d6d:	78 05                	js     801d74 <accept+0x2d>
+	return alloc_sockfd(r);
+  801d6f:	e8 5f ff ff ff       	call   801cd3 <alloc_sockfd>
+}
+  801d74:	c9                   	leave
+  801d75:	c3                   	ret
+
+00801d76 <bind>:
+{
+  801d76:	55                   	push   %ebp
+  801d77:	89 e5                	mov    %esp,%ebp
+  801d79:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7f:	e8 1f ff ff ff       	call   801ca3 <fd2sockid>
+  801d84:	85 c0                	test   %eax,%eax
+  801d86:	78 12                	js     801d9a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d88:	83 ec 04             	sub    $0x4,%esp
+  801d8b:	ff 75 10             	push   0x10(%ebp)
+  801d8e:	ff 75 0c             	push   0xc(%ebp)
+  801d91:	50                   	push   %eax
+  801d92:	e8 31 01 00 00       	call   801ec8 <nsipc_bind>
+  801d97:	83 c4 10             	add    $0x10,%esp
+}
+  801d9a:	c9                   	leave
+  801d9b:	c3                   	ret
+
+00801d9c <shutdown>:
+{
+  801d9c:	55                   	push   %ebp
+  801d9d:	89 e5                	mov    %esp,%ebp
+  801d9f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801da2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da5:	e8 f9 fe ff ff       	call   801ca3 <fd2sockid>
+  801daa:	85 c0                	test   %eax,%eax
+  801dac:	78 0f                	js     801dbd <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801dae:	83 ec 08             	sub    $0x8,%esp
+  801db1:	ff 75 0c             	push   0xc(%ebp)
+  801db4:	50                   	push   %eax
+  801db5:	e8 43 01 00 00       	call   801efd <nsipc_shutdown>
+  801dba:	83 c4 10             	add    $0x10,%esp
+}
+  801dbd:	c9                   	leave
+  801dbe:	c3                   	ret
+
+00801dbf <connect>:
+{
+  801dbf:	55                   	push   %ebp
+  801dc0:	89 e5                	mov    %esp,%ebp
+  801dc2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc8:	e8 d6 fe ff ff       	call   801ca3 <fd2sockid>
+  801dcd:	85 c0                	test   %eax,%eax
+  801dcf:	78 12                	js     801de3 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801dd1:	83 ec 04             	sub    $0x4,%esp
+  801dd4:	ff 75 10             	push   0x10(%ebp)
+  801dd7:	ff 75 0c             	push   0xc(%ebp)
+  801dda:	50                   	push   %eax
+  801ddb:	e8 59 01 00 00       	call   801f39 <nsipc_connect>
+  801de0:	83 c4 10             	add    $0x10,%esp
+}
+  801de3:	c9                   	leave
+  801de4:	c3                   	ret
+
+00801de5 <listen>:
+{
+  801de5:	55                   	push   %ebp
+  801de6:	89 e5                	mov    %esp,%ebp
+  801de8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801deb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dee:	e8 b0 fe ff ff       	call   801ca3 <fd2sockid>
+  801df3:	85 c0                	test   %eax,%eax
+  801df5:	78 0f                	js     801e06 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801df7:	83 ec 08             	sub    $0x8,%esp
+  801dfa:	ff 75 0c             	push   0xc(%ebp)
+  801dfd:	50                   	push   %eax
+  801dfe:	e8 6b 01 00 00       	call   801f6e <nsipc_listen>
+  801e03:	83 c4 10             	add    $0x10,%esp
+}
+  801e06:	c9                   	leave
+  801e07:	c3                   	ret
+
+00801e08 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801e08:	55                   	push   %ebp
+  801e09:	89 e5                	mov    %esp,%ebp
+  801e0b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801e0e:	ff 75 10             	push   0x10(%ebp)
+  801e11:	ff 75 0c             	push   0xc(%ebp)
+  801e14:	ff 75 08             	push   0x8(%ebp)
+  801e17:	e8 41 02 00 00       	call   80205d <nsipc_socket>
+  801e1c:	83 c4 10             	add    $0x10,%esp
+  801e1f:	85 c0                	test   %eax,%eax
+  801e21:	78 05                	js     801e28 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e23:	e8 ab fe ff ff       	call   801cd3 <alloc_sockfd>
+}
+  801e28:	c9                   	leave
+  801e29:	c3                   	ret
+
+00801e2a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e2a:	55                   	push   %ebp
+  801e2b:	89 e5                	mov    %esp,%ebp
+  801e2d:	53                   	push   %ebx
+  801e2e:	83 ec 04             	sub    $0x4,%esp
+  801e31:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e33:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  801e3a:	74 26                	je     801e62 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e3c:	6a 07                	push   $0x7
+  801e3e:	68 00 80 80 00       	push   $0x808000
+  801e43:	53                   	push   %ebx
+  801e44:	ff 35 00 90 80 00    	push   0x809000
+  801e4a:	e8 6f 14 00 00       	call   8032be <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e4f:	83 c4 0c             	add    $0xc,%esp
+  801e52:	6a 00                	push   $0x0
+  801e54:	6a 00                	push   $0x0
+  801e56:	6a 00                	push   $0x0
+  801e58:	e8 f6 13 00 00       	call   803253 <ipc_recv>
+}
+  801e5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e60:	c9                   	leave
+  801e61:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e62:	83 ec 0c             	sub    $0xc,%esp
+  801e65:	6a 02                	push   $0x2
+  801e67:	e8 8b 15 00 00       	call   8033f7 <ipc_find_env>
+  801e6c:	a3 00 90 80 00       	mov    %eax,0x809000
+  801e71:	83 c4 10             	add    $0x10,%esp
+  801e74:	eb c6                	jmp    801e3c <nsipc+0x12>
+
+00801e76 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e76:	55                   	push   %ebp
+  801e77:	89 e5                	mov    %esp,%ebp
+  801e79:	56                   	push   %esi
+  801e7a:	53                   	push   %ebx
+  801e7b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e81:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801e86:	8b 06                	mov    (%esi),%eax
+  801e88:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801e8d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e92:	e8 93 ff ff ff       	call   801e2a <nsipc>
+  801e97:	89 c3                	mov    %eax,%ebx
+  801e99:	85 c0                	test   %eax,%eax
+  801e9b:	79 09                	jns    801ea6 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801e9d:	89 d8                	mov    %ebx,%eax
+  801e9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ea2:	5b                   	pop    %ebx
+  801ea3:	5e                   	pop    %esi
+  801ea4:	5d                   	pop    %ebp
+  801ea5:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801ea6:	83 ec 04             	sub    $0x4,%esp
+  801ea9:	ff 35 10 80 80 00    	push   0x808010
+  801eaf:	68 00 80 80 00       	push   $0x808000
+  801eb4:	ff 75 0c             	push   0xc(%ebp)
+  801eb7:	e8 d8 0e 00 00       	call   802d94 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801ebc:	a1 10 80 80 00       	mov    0x808010,%eax
+  801ec1:	89 06                	mov    %eax,(%esi)
+  801ec3:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801ec6:	eb d5                	jmp    801e9d <nsipc_accept+0x27>
+
+00801ec8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801ec8:	55                   	push   %ebp
+  801ec9:	89 e5                	mov    %esp,%ebp
+  801ecb:	53                   	push   %ebx
+  801ecc:	83 ec 08             	sub    $0x8,%esp
+  801ecf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ed2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed5:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801eda:	53                   	push   %ebx
+  801edb:	ff 75 0c             	push   0xc(%ebp)
+  801ede:	68 04 80 80 00       	push   $0x808004
+  801ee3:	e8 ac 0e 00 00       	call   802d94 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801ee8:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801eee:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ef3:	e8 32 ff ff ff       	call   801e2a <nsipc>
+}
+  801ef8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801efb:	c9                   	leave
+  801efc:	c3                   	ret
+
+00801efd <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801efd:	55                   	push   %ebp
+  801efe:	89 e5                	mov    %esp,%ebp
+  801f00:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801f03:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f06:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801f0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f0e:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801f13:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f18:	e8 0d ff ff ff       	call   801e2a <nsipc>
+}
+  801f1d:	c9                   	leave
+  801f1e:	c3                   	ret
+
+00801f1f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f1f:	55                   	push   %ebp
+  801f20:	89 e5                	mov    %esp,%ebp
+  801f22:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f25:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f28:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f2d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f32:	e8 f3 fe ff ff       	call   801e2a <nsipc>
+}
+  801f37:	c9                   	leave
+  801f38:	c3                   	ret
+
+00801f39 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f39:	55                   	push   %ebp
+  801f3a:	89 e5                	mov    %esp,%ebp
+  801f3c:	53                   	push   %ebx
+  801f3d:	83 ec 08             	sub    $0x8,%esp
+  801f40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f43:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f46:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f4b:	53                   	push   %ebx
+  801f4c:	ff 75 0c             	push   0xc(%ebp)
+  801f4f:	68 04 80 80 00       	push   $0x808004
+  801f54:	e8 3b 0e 00 00       	call   802d94 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f59:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801f5f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f64:	e8 c1 fe ff ff       	call   801e2a <nsipc>
+}
+  801f69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f6c:	c9                   	leave
+  801f6d:	c3                   	ret
+
+00801f6e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f6e:	55                   	push   %ebp
+  801f6f:	89 e5                	mov    %esp,%ebp
+  801f71:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f74:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f77:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f7c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f7f:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801f84:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f89:	e8 9c fe ff ff       	call   801e2a <nsipc>
+}
+  801f8e:	c9                   	leave
+  801f8f:	c3                   	ret
+
+00801f90 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801f90:	55                   	push   %ebp
+  801f91:	89 e5                	mov    %esp,%ebp
+  801f93:	56                   	push   %esi
+  801f94:	53                   	push   %ebx
+  801f95:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801f98:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801fa0:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801fa6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801fa9:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801fae:	b8 07 00 00 00       	mov    $0x7,%eax
+  801fb3:	e8 72 fe ff ff       	call   801e2a <nsipc>
+  801fb8:	89 c3                	mov    %eax,%ebx
+  801fba:	85 c0                	test   %eax,%eax
+  801fbc:	78 22                	js     801fe0 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801fbe:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801fc3:	39 c6                	cmp    %eax,%esi
+  801fc5:	0f 4e c6             	cmovle %esi,%eax
+  801fc8:	39 c3                	cmp    %eax,%ebx
+  801fca:	7f 1d                	jg     801fe9 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801fcc:	83 ec 04             	sub    $0x4,%esp
+  801fcf:	53                   	push   %ebx
+  801fd0:	68 00 80 80 00       	push   $0x808000
+  801fd5:	ff 75 0c             	push   0xc(%ebp)
+  801fd8:	e8 b7 0d 00 00       	call   802d94 <memmove>
+  801fdd:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801fe0:	89 d8                	mov    %ebx,%eax
+  801fe2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe5:	5b                   	pop    %ebx
+  801fe6:	5e                   	pop    %esi
+  801fe7:	5d                   	pop    %ebp
+  801fe8:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801fe9:	68 aa 38 80 00       	push   $0x8038aa
+  801fee:	68 48 38 80 00       	push   $0x803848
+  801ff3:	6a 62                	push   $0x62
+  801ff5:	68 bf 38 80 00       	push   $0x8038bf
+  801ffa:	e8 46 05 00 00       	call   802545 <_panic>
+
+00801fff <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801fff:	55                   	push   %ebp
+  802000:	89 e5                	mov    %esp,%ebp
+  802002:	53                   	push   %ebx
+  802003:	83 ec 04             	sub    $0x4,%esp
+  802006:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802009:	8b 45 08             	mov    0x8(%ebp),%eax
+  80200c:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802011:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802017:	7f 2e                	jg     802047 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802019:	83 ec 04             	sub    $0x4,%esp
+  80201c:	53                   	push   %ebx
+  80201d:	ff 75 0c             	push   0xc(%ebp)
+  802020:	68 0c 80 80 00       	push   $0x80800c
+  802025:	e8 6a 0d 00 00       	call   802d94 <memmove>
+	nsipcbuf.send.req_size = size;
+  80202a:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802030:	8b 45 14             	mov    0x14(%ebp),%eax
+  802033:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802038:	b8 08 00 00 00       	mov    $0x8,%eax
+  80203d:	e8 e8 fd ff ff       	call   801e2a <nsipc>
+}
+  802042:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802045:	c9                   	leave
+  802046:	c3                   	ret
+	assert(size < 1600);
+  802047:	68 cb 38 80 00       	push   $0x8038cb
+  80204c:	68 48 38 80 00       	push   $0x803848
+  802051:	6a 6d                	push   $0x6d
+  802053:	68 bf 38 80 00       	push   $0x8038bf
+  802058:	e8 e8 04 00 00       	call   802545 <_panic>
+
+0080205d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80205d:	55                   	push   %ebp
+  80205e:	89 e5                	mov    %esp,%ebp
+  802060:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802063:	8b 45 08             	mov    0x8(%ebp),%eax
+  802066:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  80206b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80206e:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802073:	8b 45 10             	mov    0x10(%ebp),%eax
+  802076:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  80207b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802080:	e8 a5 fd ff ff       	call   801e2a <nsipc>
+}
+  802085:	c9                   	leave
+  802086:	c3                   	ret
+
+00802087 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802087:	55                   	push   %ebp
+  802088:	89 e5                	mov    %esp,%ebp
+  80208a:	56                   	push   %esi
+  80208b:	53                   	push   %ebx
+  80208c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80208f:	83 ec 0c             	sub    $0xc,%esp
+  802092:	ff 75 08             	push   0x8(%ebp)
+  802095:	e8 00 e5 ff ff       	call   80059a <fd2data>
+  80209a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80209c:	83 c4 08             	add    $0x8,%esp
+  80209f:	68 d7 38 80 00       	push   $0x8038d7
+  8020a4:	53                   	push   %ebx
+  8020a5:	e8 64 0b 00 00       	call   802c0e <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8020aa:	8b 46 04             	mov    0x4(%esi),%eax
+  8020ad:	2b 06                	sub    (%esi),%eax
+  8020af:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8020b5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020bc:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020bf:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  8020c6:	40 80 00 
+	return 0;
+}
+  8020c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020d1:	5b                   	pop    %ebx
+  8020d2:	5e                   	pop    %esi
+  8020d3:	5d                   	pop    %ebp
+  8020d4:	c3                   	ret
+
+008020d5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020d5:	55                   	push   %ebp
+  8020d6:	89 e5                	mov    %esp,%ebp
+  8020d8:	53                   	push   %ebx
+  8020d9:	83 ec 0c             	sub    $0xc,%esp
+  8020dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020df:	53                   	push   %ebx
+  8020e0:	6a 00                	push   $0x0
+  8020e2:	e8 2f e1 ff ff       	call   800216 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8020e7:	89 1c 24             	mov    %ebx,(%esp)
+  8020ea:	e8 ab e4 ff ff       	call   80059a <fd2data>
+  8020ef:	83 c4 08             	add    $0x8,%esp
+  8020f2:	50                   	push   %eax
+  8020f3:	6a 00                	push   $0x0
+  8020f5:	e8 1c e1 ff ff       	call   800216 <sys_page_unmap>
+}
+  8020fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020fd:	c9                   	leave
+  8020fe:	c3                   	ret
+
+008020ff <_pipeisclosed>:
+{
+  8020ff:	55                   	push   %ebp
+  802100:	89 e5                	mov    %esp,%ebp
+  802102:	57                   	push   %edi
+  802103:	56                   	push   %esi
+  802104:	53                   	push   %ebx
+  802105:	83 ec 1c             	sub    $0x1c,%esp
+  802108:	89 c7                	mov    %eax,%edi
+  80210a:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80210c:	a1 00 50 80 00       	mov    0x805000,%eax
+  802111:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802114:	83 ec 0c             	sub    $0xc,%esp
+  802117:	57                   	push   %edi
+  802118:	e8 19 13 00 00       	call   803436 <pageref>
+  80211d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802120:	89 34 24             	mov    %esi,(%esp)
+  802123:	e8 0e 13 00 00       	call   803436 <pageref>
+		nn = thisenv->env_runs;
+  802128:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80212e:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802131:	83 c4 10             	add    $0x10,%esp
+  802134:	39 cb                	cmp    %ecx,%ebx
+  802136:	74 1b                	je     802153 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802138:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80213b:	75 cf                	jne    80210c <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80213d:	8b 42 58             	mov    0x58(%edx),%eax
+  802140:	6a 01                	push   $0x1
+  802142:	50                   	push   %eax
+  802143:	53                   	push   %ebx
+  802144:	68 de 38 80 00       	push   $0x8038de
+  802149:	e8 d2 04 00 00       	call   802620 <cprintf>
+  80214e:	83 c4 10             	add    $0x10,%esp
+  802151:	eb b9                	jmp    80210c <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802153:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802156:	0f 94 c0             	sete   %al
+  802159:	0f b6 c0             	movzbl %al,%eax
+}
+  80215c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80215f:	5b                   	pop    %ebx
+  802160:	5e                   	pop    %esi
+  802161:	5f                   	pop    %edi
+  802162:	5d                   	pop    %ebp
+  802163:	c3                   	ret
+
+00802164 <devpipe_write>:
+{
+  802164:	55                   	push   %ebp
+  802165:	89 e5                	mov    %esp,%ebp
+  802167:	57                   	push   %edi
+  802168:	56                   	push   %esi
+  802169:	53                   	push   %ebx
+  80216a:	83 ec 28             	sub    $0x28,%esp
+  80216d:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802170:	56                   	push   %esi
+  802171:	e8 24 e4 ff ff       	call   80059a <fd2data>
+  802176:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802178:	83 c4 10             	add    $0x10,%esp
+  80217b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802180:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802183:	75 09                	jne    80218e <devpipe_write+0x2a>
+	return i;
+  802185:	89 f8                	mov    %edi,%eax
+  802187:	eb 23                	jmp    8021ac <devpipe_write+0x48>
+			sys_yield();
+  802189:	e8 dc df ff ff       	call   80016a <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80218e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802191:	8b 0b                	mov    (%ebx),%ecx
+  802193:	8d 51 20             	lea    0x20(%ecx),%edx
+  802196:	39 d0                	cmp    %edx,%eax
+  802198:	72 1a                	jb     8021b4 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80219a:	89 da                	mov    %ebx,%edx
+  80219c:	89 f0                	mov    %esi,%eax
+  80219e:	e8 5c ff ff ff       	call   8020ff <_pipeisclosed>
+  8021a3:	85 c0                	test   %eax,%eax
+  8021a5:	74 e2                	je     802189 <devpipe_write+0x25>
+				return 0;
+  8021a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021af:	5b                   	pop    %ebx
+  8021b0:	5e                   	pop    %esi
+  8021b1:	5f                   	pop    %edi
+  8021b2:	5d                   	pop    %ebp
+  8021b3:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021b7:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021bb:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021be:	89 c2                	mov    %eax,%edx
+  8021c0:	c1 fa 1f             	sar    $0x1f,%edx
+  8021c3:	89 d1                	mov    %edx,%ecx
+  8021c5:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021c8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021cb:	83 e2 1f             	and    $0x1f,%edx
+  8021ce:	29 ca                	sub    %ecx,%edx
+  8021d0:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8021d4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021d8:	83 c0 01             	add    $0x1,%eax
+  8021db:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8021de:	83 c7 01             	add    $0x1,%edi
+  8021e1:	eb 9d                	jmp    802180 <devpipe_write+0x1c>
+
+008021e3 <devpipe_read>:
+{
+  8021e3:	55                   	push   %ebp
+  8021e4:	89 e5                	mov    %esp,%ebp
+  8021e6:	57                   	push   %edi
+  8021e7:	56                   	push   %esi
+  8021e8:	53                   	push   %ebx
+  8021e9:	83 ec 18             	sub    $0x18,%esp
+  8021ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8021ef:	57                   	push   %edi
+  8021f0:	e8 a5 e3 ff ff       	call   80059a <fd2data>
+  8021f5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021f7:	83 c4 10             	add    $0x10,%esp
+  8021fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ff:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802202:	75 13                	jne    802217 <devpipe_read+0x34>
+	return i;
+  802204:	89 f0                	mov    %esi,%eax
+  802206:	eb 02                	jmp    80220a <devpipe_read+0x27>
+				return i;
+  802208:	89 f0                	mov    %esi,%eax
+}
+  80220a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80220d:	5b                   	pop    %ebx
+  80220e:	5e                   	pop    %esi
+  80220f:	5f                   	pop    %edi
+  802210:	5d                   	pop    %ebp
+  802211:	c3                   	ret
+			sys_yield();
+  802212:	e8 53 df ff ff       	call   80016a <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802217:	8b 03                	mov    (%ebx),%eax
+  802219:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80221c:	75 18                	jne    802236 <devpipe_read+0x53>
+			if (i > 0)
+  80221e:	85 f6                	test   %esi,%esi
+  802220:	75 e6                	jne    802208 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802222:	89 da                	mov    %ebx,%edx
+  802224:	89 f8                	mov    %edi,%eax
+  802226:	e8 d4 fe ff ff       	call   8020ff <_pipeisclosed>
+  80222b:	85 c0                	test   %eax,%eax
+  80222d:	74 e3                	je     802212 <devpipe_read+0x2f>
+				return 0;
+  80222f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802234:	eb d4                	jmp    80220a <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802236:	99                   	cltd
+  802237:	c1 ea 1b             	shr    $0x1b,%edx
+  80223a:	01 d0                	add    %edx,%eax
+  80223c:	83 e0 1f             	and    $0x1f,%eax
+  80223f:	29 d0                	sub    %edx,%eax
+  802241:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802246:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802249:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80224c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80224f:	83 c6 01             	add    $0x1,%esi
+  802252:	eb ab                	jmp    8021ff <devpipe_read+0x1c>
+
+00802254 <pipe>:
+{
+  802254:	55                   	push   %ebp
+  802255:	89 e5                	mov    %esp,%ebp
+  802257:	56                   	push   %esi
+  802258:	53                   	push   %ebx
+  802259:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80225c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80225f:	50                   	push   %eax
+  802260:	e8 4c e3 ff ff       	call   8005b1 <fd_alloc>
+  802265:	89 c3                	mov    %eax,%ebx
+  802267:	83 c4 10             	add    $0x10,%esp
+  80226a:	85 c0                	test   %eax,%eax
+  80226c:	0f 88 23 01 00 00    	js     802395 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802272:	83 ec 04             	sub    $0x4,%esp
+  802275:	68 07 04 00 00       	push   $0x407
+  80227a:	ff 75 f4             	push   -0xc(%ebp)
+  80227d:	6a 00                	push   $0x0
+  80227f:	e8 05 df ff ff       	call   800189 <sys_page_alloc>
+  802284:	89 c3                	mov    %eax,%ebx
+  802286:	83 c4 10             	add    $0x10,%esp
+  802289:	85 c0                	test   %eax,%eax
+  80228b:	0f 88 04 01 00 00    	js     802395 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802291:	83 ec 0c             	sub    $0xc,%esp
+  802294:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802297:	50                   	push   %eax
+  802298:	e8 14 e3 ff ff       	call   8005b1 <fd_alloc>
+  80229d:	89 c3                	mov    %eax,%ebx
+  80229f:	83 c4 10             	add    $0x10,%esp
+  8022a2:	85 c0                	test   %eax,%eax
+  8022a4:	0f 88 db 00 00 00    	js     802385 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022aa:	83 ec 04             	sub    $0x4,%esp
+  8022ad:	68 07 04 00 00       	push   $0x407
+  8022b2:	ff 75 f0             	push   -0x10(%ebp)
+  8022b5:	6a 00                	push   $0x0
+  8022b7:	e8 cd de ff ff       	call   800189 <sys_page_alloc>
+  8022bc:	89 c3                	mov    %eax,%ebx
+  8022be:	83 c4 10             	add    $0x10,%esp
+  8022c1:	85 c0                	test   %eax,%eax
+  8022c3:	0f 88 bc 00 00 00    	js     802385 <pipe+0x131>
+	va = fd2data(fd0);
+  8022c9:	83 ec 0c             	sub    $0xc,%esp
+  8022cc:	ff 75 f4             	push   -0xc(%ebp)
+  8022cf:	e8 c6 e2 ff ff       	call   80059a <fd2data>
+  8022d4:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022d6:	83 c4 0c             	add    $0xc,%esp
+  8022d9:	68 07 04 00 00       	push   $0x407
+  8022de:	50                   	push   %eax
+  8022df:	6a 00                	push   $0x0
+  8022e1:	e8 a3 de ff ff       	call   800189 <sys_page_alloc>
+  8022e6:	89 c3                	mov    %eax,%ebx
+  8022e8:	83 c4 10             	add    $0x10,%esp
+  8022eb:	85 c0                	test   %eax,%eax
+  8022ed:	0f 88 82 00 00 00    	js     802375 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022f3:	83 ec 0c             	sub    $0xc,%esp
+  8022f6:	ff 75 f0             	push   -0x10(%ebp)
+  8022f9:	e8 9c e2 ff ff       	call   80059a <fd2data>
+  8022fe:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802305:	50                   	push   %eax
+  802306:	6a 00                	push   $0x0
+  802308:	56                   	push   %esi
+  802309:	6a 00                	push   $0x0
+  80230b:	e8 c4 de ff ff       	call   8001d4 <sys_page_map>
+  802310:	89 c3                	mov    %eax,%ebx
+  802312:	83 c4 20             	add    $0x20,%esp
+  802315:	85 c0                	test   %eax,%eax
+  802317:	78 4e                	js     802367 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802319:	a1 60 40 80 00       	mov    0x804060,%eax
+  80231e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802321:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802323:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802326:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80232d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802330:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802332:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802335:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80233c:	83 ec 0c             	sub    $0xc,%esp
+  80233f:	ff 75 f4             	push   -0xc(%ebp)
+  802342:	e8 43 e2 ff ff       	call   80058a <fd2num>
+  802347:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80234a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80234c:	83 c4 04             	add    $0x4,%esp
+  80234f:	ff 75 f0             	push   -0x10(%ebp)
+  802352:	e8 33 e2 ff ff       	call   80058a <fd2num>
+  802357:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80235a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80235d:	83 c4 10             	add    $0x10,%esp
+  802360:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802365:	eb 2e                	jmp    802395 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802367:	83 ec 08             	sub    $0x8,%esp
+  80236a:	56                   	push   %esi
+  80236b:	6a 00                	push   $0x0
+  80236d:	e8 a4 de ff ff       	call   800216 <sys_page_unmap>
+  802372:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802375:	83 ec 08             	sub    $0x8,%esp
+  802378:	ff 75 f0             	push   -0x10(%ebp)
+  80237b:	6a 00                	push   $0x0
+  80237d:	e8 94 de ff ff       	call   800216 <sys_page_unmap>
+  802382:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802385:	83 ec 08             	sub    $0x8,%esp
+  802388:	ff 75 f4             	push   -0xc(%ebp)
+  80238b:	6a 00                	push   $0x0
+  80238d:	e8 84 de ff ff       	call   800216 <sys_page_unmap>
+  802392:	83 c4 10             	add    $0x10,%esp
+}
+  802395:	89 d8                	mov    %ebx,%eax
+  802397:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80239a:	5b                   	pop    %ebx
+  80239b:	5e                   	pop    %esi
+  80239c:	5d                   	pop    %ebp
+  80239d:	c3                   	ret
+
+0080239e <pipeisclosed>:
+{
+  80239e:	55                   	push   %ebp
+  80239f:	89 e5                	mov    %esp,%ebp
+  8023a1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023a7:	50                   	push   %eax
+  8023a8:	ff 75 08             	push   0x8(%ebp)
+  8023ab:	e8 57 e2 ff ff       	call   800607 <fd_lookup>
+  8023b0:	83 c4 10             	add    $0x10,%esp
+  8023b3:	85 c0                	test   %eax,%eax
+  8023b5:	78 18                	js     8023cf <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8023b7:	83 ec 0c             	sub    $0xc,%esp
+  8023ba:	ff 75 f4             	push   -0xc(%ebp)
+  8023bd:	e8 d8 e1 ff ff       	call   80059a <fd2data>
+  8023c2:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8023c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023c7:	e8 33 fd ff ff       	call   8020ff <_pipeisclosed>
+  8023cc:	83 c4 10             	add    $0x10,%esp
+}
+  8023cf:	c9                   	leave
+  8023d0:	c3                   	ret
+
+008023d1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8023d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d6:	c3                   	ret
+
+008023d7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023d7:	55                   	push   %ebp
+  8023d8:	89 e5                	mov    %esp,%ebp
+  8023da:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8023dd:	68 f6 38 80 00       	push   $0x8038f6
+  8023e2:	ff 75 0c             	push   0xc(%ebp)
+  8023e5:	e8 24 08 00 00       	call   802c0e <strcpy>
+	return 0;
+}
+  8023ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ef:	c9                   	leave
+  8023f0:	c3                   	ret
+
+008023f1 <devcons_write>:
+{
+  8023f1:	55                   	push   %ebp
+  8023f2:	89 e5                	mov    %esp,%ebp
+  8023f4:	57                   	push   %edi
+  8023f5:	56                   	push   %esi
+  8023f6:	53                   	push   %ebx
+  8023f7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8023fd:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802402:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802408:	eb 2e                	jmp    802438 <devcons_write+0x47>
+		m = n - tot;
+  80240a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80240d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80240f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802414:	39 c3                	cmp    %eax,%ebx
+  802416:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802419:	83 ec 04             	sub    $0x4,%esp
+  80241c:	53                   	push   %ebx
+  80241d:	89 f0                	mov    %esi,%eax
+  80241f:	03 45 0c             	add    0xc(%ebp),%eax
+  802422:	50                   	push   %eax
+  802423:	57                   	push   %edi
+  802424:	e8 6b 09 00 00       	call   802d94 <memmove>
+		sys_cputs(buf, m);
+  802429:	83 c4 08             	add    $0x8,%esp
+  80242c:	53                   	push   %ebx
+  80242d:	57                   	push   %edi
+  80242e:	e8 7a dc ff ff       	call   8000ad <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802433:	01 de                	add    %ebx,%esi
+  802435:	83 c4 10             	add    $0x10,%esp
+  802438:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80243b:	72 cd                	jb     80240a <devcons_write+0x19>
+}
+  80243d:	89 f0                	mov    %esi,%eax
+  80243f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802442:	5b                   	pop    %ebx
+  802443:	5e                   	pop    %esi
+  802444:	5f                   	pop    %edi
+  802445:	5d                   	pop    %ebp
+  802446:	c3                   	ret
+
+00802447 <devcons_read>:
+{
+  802447:	55                   	push   %ebp
+  802448:	89 e5                	mov    %esp,%ebp
+  80244a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80244d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802452:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802456:	75 07                	jne    80245f <devcons_read+0x18>
+  802458:	eb 1f                	jmp    802479 <devcons_read+0x32>
+		sys_yield();
+  80245a:	e8 0b dd ff ff       	call   80016a <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80245f:	e8 6f dc ff ff       	call   8000d3 <sys_cgetc>
+  802464:	85 c0                	test   %eax,%eax
+  802466:	74 f2                	je     80245a <devcons_read+0x13>
+	if (c < 0)
+  802468:	78 0f                	js     802479 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80246a:	83 f8 04             	cmp    $0x4,%eax
+  80246d:	74 0c                	je     80247b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80246f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802472:	88 02                	mov    %al,(%edx)
+	return 1;
+  802474:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802479:	c9                   	leave
+  80247a:	c3                   	ret
+		return 0;
+  80247b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802480:	eb f7                	jmp    802479 <devcons_read+0x32>
+
+00802482 <cputchar>:
+{
+  802482:	55                   	push   %ebp
+  802483:	89 e5                	mov    %esp,%ebp
+  802485:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802488:	8b 45 08             	mov    0x8(%ebp),%eax
+  80248b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80248e:	6a 01                	push   $0x1
+  802490:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802493:	50                   	push   %eax
+  802494:	e8 14 dc ff ff       	call   8000ad <sys_cputs>
+}
+  802499:	83 c4 10             	add    $0x10,%esp
+  80249c:	c9                   	leave
+  80249d:	c3                   	ret
+
+0080249e <getchar>:
+{
+  80249e:	55                   	push   %ebp
+  80249f:	89 e5                	mov    %esp,%ebp
+  8024a1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8024a4:	6a 01                	push   $0x1
+  8024a6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8024a9:	50                   	push   %eax
+  8024aa:	6a 00                	push   $0x0
+  8024ac:	e8 bc e3 ff ff       	call   80086d <read>
+	if (r < 0)
+  8024b1:	83 c4 10             	add    $0x10,%esp
+  8024b4:	85 c0                	test   %eax,%eax
+  8024b6:	78 06                	js     8024be <getchar+0x20>
+	if (r < 1)
+  8024b8:	74 06                	je     8024c0 <getchar+0x22>
+	return c;
+  8024ba:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8024be:	c9                   	leave
+  8024bf:	c3                   	ret
+		return -E_EOF;
+  8024c0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8024c5:	eb f7                	jmp    8024be <getchar+0x20>
+
+008024c7 <iscons>:
+{
+  8024c7:	55                   	push   %ebp
+  8024c8:	89 e5                	mov    %esp,%ebp
+  8024ca:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024d0:	50                   	push   %eax
+  8024d1:	ff 75 08             	push   0x8(%ebp)
+  8024d4:	e8 2e e1 ff ff       	call   800607 <fd_lookup>
+  8024d9:	83 c4 10             	add    $0x10,%esp
+  8024dc:	85 c0                	test   %eax,%eax
+  8024de:	78 11                	js     8024f1 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8024e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024e3:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8024e9:	39 10                	cmp    %edx,(%eax)
+  8024eb:	0f 94 c0             	sete   %al
+  8024ee:	0f b6 c0             	movzbl %al,%eax
+}
+  8024f1:	c9                   	leave
+  8024f2:	c3                   	ret
+
+008024f3 <opencons>:
+{
+  8024f3:	55                   	push   %ebp
+  8024f4:	89 e5                	mov    %esp,%ebp
+  8024f6:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8024f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024fc:	50                   	push   %eax
+  8024fd:	e8 af e0 ff ff       	call   8005b1 <fd_alloc>
+  802502:	83 c4 10             	add    $0x10,%esp
+  802505:	85 c0                	test   %eax,%eax
+  802507:	78 3a                	js     802543 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802509:	83 ec 04             	sub    $0x4,%esp
+  80250c:	68 07 04 00 00       	push   $0x407
+  802511:	ff 75 f4             	push   -0xc(%ebp)
+  802514:	6a 00                	push   $0x0
+  802516:	e8 6e dc ff ff       	call   800189 <sys_page_alloc>
+  80251b:	83 c4 10             	add    $0x10,%esp
+  80251e:	85 c0                	test   %eax,%eax
+  802520:	78 21                	js     802543 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802522:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802525:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80252b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80252d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802530:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802537:	83 ec 0c             	sub    $0xc,%esp
+  80253a:	50                   	push   %eax
+  80253b:	e8 4a e0 ff ff       	call   80058a <fd2num>
+  802540:	83 c4 10             	add    $0x10,%esp
+}
+  802543:	c9                   	leave
+  802544:	c3                   	ret
+
+00802545 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802545:	55                   	push   %ebp
+  802546:	89 e5                	mov    %esp,%ebp
+  802548:	56                   	push   %esi
+  802549:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80254a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80254d:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802553:	e8 eb db ff ff       	call   800143 <sys_getenvid>
+  802558:	83 ec 0c             	sub    $0xc,%esp
+  80255b:	ff 75 0c             	push   0xc(%ebp)
+  80255e:	ff 75 08             	push   0x8(%ebp)
+  802561:	56                   	push   %esi
+  802562:	50                   	push   %eax
+  802563:	68 04 39 80 00       	push   $0x803904
+  802568:	e8 b3 00 00 00       	call   802620 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80256d:	83 c4 18             	add    $0x18,%esp
+  802570:	53                   	push   %ebx
+  802571:	ff 75 10             	push   0x10(%ebp)
+  802574:	e8 56 00 00 00       	call   8025cf <vcprintf>
+	cprintf("\n");
+  802579:	c7 04 24 ef 38 80 00 	movl   $0x8038ef,(%esp)
+  802580:	e8 9b 00 00 00       	call   802620 <cprintf>
+  802585:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802588:	cc                   	int3
+	while (1)
+  802589:	eb fd                	jmp    802588 <_panic+0x43>
+
+0080258b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80258b:	55                   	push   %ebp
+  80258c:	89 e5                	mov    %esp,%ebp
+  80258e:	53                   	push   %ebx
+  80258f:	83 ec 04             	sub    $0x4,%esp
+  802592:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802595:	8b 13                	mov    (%ebx),%edx
+  802597:	8d 42 01             	lea    0x1(%edx),%eax
+  80259a:	89 03                	mov    %eax,(%ebx)
+  80259c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80259f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8025a3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8025a8:	74 09                	je     8025b3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8025aa:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8025ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025b1:	c9                   	leave
+  8025b2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8025b3:	83 ec 08             	sub    $0x8,%esp
+  8025b6:	68 ff 00 00 00       	push   $0xff
+  8025bb:	8d 43 08             	lea    0x8(%ebx),%eax
+  8025be:	50                   	push   %eax
+  8025bf:	e8 e9 da ff ff       	call   8000ad <sys_cputs>
+		b->idx = 0;
+  8025c4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8025ca:	83 c4 10             	add    $0x10,%esp
+  8025cd:	eb db                	jmp    8025aa <putch+0x1f>
+
+008025cf <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8025cf:	55                   	push   %ebp
+  8025d0:	89 e5                	mov    %esp,%ebp
+  8025d2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8025d8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8025df:	00 00 00 
+	b.cnt = 0;
+  8025e2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8025e9:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8025ec:	ff 75 0c             	push   0xc(%ebp)
+  8025ef:	ff 75 08             	push   0x8(%ebp)
+  8025f2:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8025f8:	50                   	push   %eax
+  8025f9:	68 8b 25 80 00       	push   $0x80258b
+  8025fe:	e8 14 01 00 00       	call   802717 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802603:	83 c4 08             	add    $0x8,%esp
+  802606:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80260c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802612:	50                   	push   %eax
+  802613:	e8 95 da ff ff       	call   8000ad <sys_cputs>
+
+	return b.cnt;
+}
+  802618:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80261e:	c9                   	leave
+  80261f:	c3                   	ret
+
+00802620 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802620:	55                   	push   %ebp
+  802621:	89 e5                	mov    %esp,%ebp
+  802623:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802626:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802629:	50                   	push   %eax
+  80262a:	ff 75 08             	push   0x8(%ebp)
+  80262d:	e8 9d ff ff ff       	call   8025cf <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802632:	c9                   	leave
+  802633:	c3                   	ret
+
+00802634 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802634:	55                   	push   %ebp
+  802635:	89 e5                	mov    %esp,%ebp
+  802637:	57                   	push   %edi
+  802638:	56                   	push   %esi
+  802639:	53                   	push   %ebx
+  80263a:	83 ec 1c             	sub    $0x1c,%esp
+  80263d:	89 c7                	mov    %eax,%edi
+  80263f:	89 d6                	mov    %edx,%esi
+  802641:	8b 45 08             	mov    0x8(%ebp),%eax
+  802644:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802647:	89 d1                	mov    %edx,%ecx
+  802649:	89 c2                	mov    %eax,%edx
+  80264b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80264e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802651:	8b 45 10             	mov    0x10(%ebp),%eax
+  802654:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802657:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80265a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802661:	39 c2                	cmp    %eax,%edx
+  802663:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802666:	72 3e                	jb     8026a6 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802668:	83 ec 0c             	sub    $0xc,%esp
+  80266b:	ff 75 18             	push   0x18(%ebp)
+  80266e:	83 eb 01             	sub    $0x1,%ebx
+  802671:	53                   	push   %ebx
+  802672:	50                   	push   %eax
+  802673:	83 ec 08             	sub    $0x8,%esp
+  802676:	ff 75 e4             	push   -0x1c(%ebp)
+  802679:	ff 75 e0             	push   -0x20(%ebp)
+  80267c:	ff 75 dc             	push   -0x24(%ebp)
+  80267f:	ff 75 d8             	push   -0x28(%ebp)
+  802682:	e8 59 0f 00 00       	call   8035e0 <__udivdi3>
+  802687:	83 c4 18             	add    $0x18,%esp
+  80268a:	52                   	push   %edx
+  80268b:	50                   	push   %eax
+  80268c:	89 f2                	mov    %esi,%edx
+  80268e:	89 f8                	mov    %edi,%eax
+  802690:	e8 9f ff ff ff       	call   802634 <printnum>
+  802695:	83 c4 20             	add    $0x20,%esp
+  802698:	eb 13                	jmp    8026ad <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80269a:	83 ec 08             	sub    $0x8,%esp
+  80269d:	56                   	push   %esi
+  80269e:	ff 75 18             	push   0x18(%ebp)
+  8026a1:	ff d7                	call   *%edi
+  8026a3:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8026a6:	83 eb 01             	sub    $0x1,%ebx
+  8026a9:	85 db                	test   %ebx,%ebx
+  8026ab:	7f ed                	jg     80269a <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8026ad:	83 ec 08             	sub    $0x8,%esp
+  8026b0:	56                   	push   %esi
+  8026b1:	83 ec 04             	sub    $0x4,%esp
+  8026b4:	ff 75 e4             	push   -0x1c(%ebp)
+  8026b7:	ff 75 e0             	push   -0x20(%ebp)
+  8026ba:	ff 75 dc             	push   -0x24(%ebp)
+  8026bd:	ff 75 d8             	push   -0x28(%ebp)
+  8026c0:	e8 39 0f 00 00       	call   8035fe <__umoddi3>
+  8026c5:	83 c4 14             	add    $0x14,%esp
+  8026c8:	0f be 80 27 39 80 00 	movsbl 0x803927(%eax),%eax
+  8026cf:	50                   	push   %eax
+  8026d0:	ff d7                	call   *%edi
+}
+  8026d2:	83 c4 10             	add    $0x10,%esp
+  8026d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026d8:	5b                   	pop    %ebx
+  8026d9:	5e                   	pop    %esi
+  8026da:	5f                   	pop    %edi
+  8026db:	5d                   	pop    %ebp
+  8026dc:	c3                   	ret
+
+008026dd <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8026dd:	55                   	push   %ebp
+  8026de:	89 e5                	mov    %esp,%ebp
+  8026e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8026e3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8026e7:	8b 10                	mov    (%eax),%edx
+  8026e9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8026ec:	73 0a                	jae    8026f8 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8026ee:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8026f1:	89 08                	mov    %ecx,(%eax)
+  8026f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f6:	88 02                	mov    %al,(%edx)
+}
+  8026f8:	5d                   	pop    %ebp
+  8026f9:	c3                   	ret
+
+008026fa <printfmt>:
+{
+  8026fa:	55                   	push   %ebp
+  8026fb:	89 e5                	mov    %esp,%ebp
+  8026fd:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  802700:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  802703:	50                   	push   %eax
+  802704:	ff 75 10             	push   0x10(%ebp)
+  802707:	ff 75 0c             	push   0xc(%ebp)
+  80270a:	ff 75 08             	push   0x8(%ebp)
+  80270d:	e8 05 00 00 00       	call   802717 <vprintfmt>
+}
+  802712:	83 c4 10             	add    $0x10,%esp
+  802715:	c9                   	leave
+  802716:	c3                   	ret
+
+00802717 <vprintfmt>:
+{
+  802717:	55                   	push   %ebp
+  802718:	89 e5                	mov    %esp,%ebp
+  80271a:	57                   	push   %edi
+  80271b:	56                   	push   %esi
+  80271c:	53                   	push   %ebx
+  80271d:	83 ec 2c             	sub    $0x2c,%esp
+  802720:	8b 75 08             	mov    0x8(%ebp),%esi
+  802723:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802726:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802729:	eb 0a                	jmp    802735 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80272b:	83 ec 08             	sub    $0x8,%esp
+  80272e:	53                   	push   %ebx
+  80272f:	50                   	push   %eax
+  802730:	ff d6                	call   *%esi
+  802732:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802735:	83 c7 01             	add    $0x1,%edi
+  802738:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80273c:	83 f8 25             	cmp    $0x25,%eax
+  80273f:	74 0c                	je     80274d <vprintfmt+0x36>
+			if (ch == '\0')
+  802741:	85 c0                	test   %eax,%eax
+  802743:	75 e6                	jne    80272b <vprintfmt+0x14>
+}
+  802745:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802748:	5b                   	pop    %ebx
+  802749:	5e                   	pop    %esi
+  80274a:	5f                   	pop    %edi
+  80274b:	5d                   	pop    %ebp
+  80274c:	c3                   	ret
+		padc = ' ';
+  80274d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  802751:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802758:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80275f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  802766:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80276b:	8d 47 01             	lea    0x1(%edi),%eax
+  80276e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802771:	0f b6 17             	movzbl (%edi),%edx
+  802774:	8d 42 dd             	lea    -0x23(%edx),%eax
+  802777:	3c 55                	cmp    $0x55,%al
+  802779:	0f 87 cf 03 00 00    	ja     802b4e <vprintfmt+0x437>
+  80277f:	0f b6 c0             	movzbl %al,%eax
+  802782:	ff 24 85 80 3a 80 00 	jmp    *0x803a80(,%eax,4)
+  802789:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80278c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  802790:	eb d9                	jmp    80276b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  802792:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802795:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  802799:	eb d0                	jmp    80276b <vprintfmt+0x54>
+  80279b:	0f b6 d2             	movzbl %dl,%edx
+  80279e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8027a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8027a9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8027ac:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8027b0:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8027b3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8027b6:	83 f9 09             	cmp    $0x9,%ecx
+  8027b9:	77 55                	ja     802810 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8027bb:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8027be:	eb e9                	jmp    8027a9 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8027c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027c3:	8b 00                	mov    (%eax),%eax
+  8027c5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8027c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8027ce:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027d1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8027d4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8027d8:	79 91                	jns    80276b <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8027da:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8027dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8027e0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8027e7:	eb 82                	jmp    80276b <vprintfmt+0x54>
+			if (width < 0)
+  8027e9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8027ec:	85 d2                	test   %edx,%edx
+  8027ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f3:	0f 49 c2             	cmovns %edx,%eax
+  8027f6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027f9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8027fc:	e9 6a ff ff ff       	jmp    80276b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  802801:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  802804:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80280b:	e9 5b ff ff ff       	jmp    80276b <vprintfmt+0x54>
+  802810:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802813:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802816:	eb bc                	jmp    8027d4 <vprintfmt+0xbd>
+			lflag++;
+  802818:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80281b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80281e:	e9 48 ff ff ff       	jmp    80276b <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  802823:	8b 45 14             	mov    0x14(%ebp),%eax
+  802826:	8d 78 04             	lea    0x4(%eax),%edi
+  802829:	83 ec 08             	sub    $0x8,%esp
+  80282c:	53                   	push   %ebx
+  80282d:	ff 30                	push   (%eax)
+  80282f:	ff d6                	call   *%esi
+			break;
+  802831:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802834:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  802837:	e9 b1 02 00 00       	jmp    802aed <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80283c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80283f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  802842:	8b 10                	mov    (%eax),%edx
+  802844:	89 d0                	mov    %edx,%eax
+  802846:	f7 d8                	neg    %eax
+  802848:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80284b:	83 f8 11             	cmp    $0x11,%eax
+  80284e:	7f 23                	jg     802873 <vprintfmt+0x15c>
+  802850:	8b 14 85 e0 3b 80 00 	mov    0x803be0(,%eax,4),%edx
+  802857:	85 d2                	test   %edx,%edx
+  802859:	74 18                	je     802873 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80285b:	52                   	push   %edx
+  80285c:	68 5a 38 80 00       	push   $0x80385a
+  802861:	53                   	push   %ebx
+  802862:	56                   	push   %esi
+  802863:	e8 92 fe ff ff       	call   8026fa <printfmt>
+  802868:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80286b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80286e:	e9 7a 02 00 00       	jmp    802aed <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  802873:	50                   	push   %eax
+  802874:	68 3f 39 80 00       	push   $0x80393f
+  802879:	53                   	push   %ebx
+  80287a:	56                   	push   %esi
+  80287b:	e8 7a fe ff ff       	call   8026fa <printfmt>
+  802880:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802883:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802886:	e9 62 02 00 00       	jmp    802aed <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80288b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80288e:	83 c0 04             	add    $0x4,%eax
+  802891:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  802894:	8b 45 14             	mov    0x14(%ebp),%eax
+  802897:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  802899:	85 c9                	test   %ecx,%ecx
+  80289b:	b8 38 39 80 00       	mov    $0x803938,%eax
+  8028a0:	0f 45 c1             	cmovne %ecx,%eax
+  8028a3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8028a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8028aa:	7e 06                	jle    8028b2 <vprintfmt+0x19b>
+  8028ac:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8028b0:	75 0b                	jne    8028bd <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028b2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8028b5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8028b8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028bb:	eb 5c                	jmp    802919 <vprintfmt+0x202>
+  8028bd:	83 ec 08             	sub    $0x8,%esp
+  8028c0:	ff 75 d0             	push   -0x30(%ebp)
+  8028c3:	ff 75 cc             	push   -0x34(%ebp)
+  8028c6:	e8 20 03 00 00       	call   802beb <strnlen>
+  8028cb:	89 c2                	mov    %eax,%edx
+  8028cd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028d0:	29 d0                	sub    %edx,%eax
+  8028d2:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8028d5:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8028d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028dc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028df:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028e1:	eb 0e                	jmp    8028f1 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8028e3:	83 ec 08             	sub    $0x8,%esp
+  8028e6:	53                   	push   %ebx
+  8028e7:	57                   	push   %edi
+  8028e8:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028eb:	83 ee 01             	sub    $0x1,%esi
+  8028ee:	83 c4 10             	add    $0x10,%esp
+  8028f1:	85 f6                	test   %esi,%esi
+  8028f3:	7f ee                	jg     8028e3 <vprintfmt+0x1cc>
+  8028f5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028fb:	85 c0                	test   %eax,%eax
+  8028fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802902:	0f 49 d0             	cmovns %eax,%edx
+  802905:	29 d0                	sub    %edx,%eax
+  802907:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80290a:	eb a6                	jmp    8028b2 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80290c:	83 ec 08             	sub    $0x8,%esp
+  80290f:	53                   	push   %ebx
+  802910:	52                   	push   %edx
+  802911:	ff 55 08             	call   *0x8(%ebp)
+  802914:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802917:	89 f1                	mov    %esi,%ecx
+  802919:	8d 71 01             	lea    0x1(%ecx),%esi
+  80291c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802920:	0f be d0             	movsbl %al,%edx
+  802923:	85 d2                	test   %edx,%edx
+  802925:	74 28                	je     80294f <vprintfmt+0x238>
+  802927:	85 ff                	test   %edi,%edi
+  802929:	78 05                	js     802930 <vprintfmt+0x219>
+  80292b:	83 ef 01             	sub    $0x1,%edi
+  80292e:	78 30                	js     802960 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802930:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802934:	74 d6                	je     80290c <vprintfmt+0x1f5>
+  802936:	0f be c0             	movsbl %al,%eax
+  802939:	83 e8 20             	sub    $0x20,%eax
+  80293c:	83 f8 5e             	cmp    $0x5e,%eax
+  80293f:	76 cb                	jbe    80290c <vprintfmt+0x1f5>
+					putch('?', putdat);
+  802941:	83 ec 08             	sub    $0x8,%esp
+  802944:	53                   	push   %ebx
+  802945:	6a 3f                	push   $0x3f
+  802947:	ff 55 08             	call   *0x8(%ebp)
+  80294a:	83 c4 10             	add    $0x10,%esp
+  80294d:	eb c8                	jmp    802917 <vprintfmt+0x200>
+  80294f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802952:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802955:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802958:	01 d0                	add    %edx,%eax
+  80295a:	29 c8                	sub    %ecx,%eax
+  80295c:	89 c7                	mov    %eax,%edi
+  80295e:	eb 13                	jmp    802973 <vprintfmt+0x25c>
+  802960:	8b 75 08             	mov    0x8(%ebp),%esi
+  802963:	eb ed                	jmp    802952 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  802965:	83 ec 08             	sub    $0x8,%esp
+  802968:	53                   	push   %ebx
+  802969:	6a 20                	push   $0x20
+  80296b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80296d:	83 ef 01             	sub    $0x1,%edi
+  802970:	83 c4 10             	add    $0x10,%esp
+  802973:	85 ff                	test   %edi,%edi
+  802975:	7f ee                	jg     802965 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802977:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80297a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80297d:	e9 6b 01 00 00       	jmp    802aed <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  802982:	83 f9 01             	cmp    $0x1,%ecx
+  802985:	7f 1f                	jg     8029a6 <vprintfmt+0x28f>
+	else if (lflag)
+  802987:	85 c9                	test   %ecx,%ecx
+  802989:	74 67                	je     8029f2 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80298b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80298e:	8b 00                	mov    (%eax),%eax
+  802990:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802993:	89 c1                	mov    %eax,%ecx
+  802995:	c1 f9 1f             	sar    $0x1f,%ecx
+  802998:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80299b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80299e:	8d 40 04             	lea    0x4(%eax),%eax
+  8029a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8029a4:	eb 17                	jmp    8029bd <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8029a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029a9:	8b 50 04             	mov    0x4(%eax),%edx
+  8029ac:	8b 00                	mov    (%eax),%eax
+  8029ae:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029b1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8029b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029b7:	8d 40 08             	lea    0x8(%eax),%eax
+  8029ba:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8029bd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029c0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8029c3:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8029c8:	85 c9                	test   %ecx,%ecx
+  8029ca:	0f 89 03 01 00 00    	jns    802ad3 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8029d0:	83 ec 08             	sub    $0x8,%esp
+  8029d3:	53                   	push   %ebx
+  8029d4:	6a 2d                	push   $0x2d
+  8029d6:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8029d8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029db:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8029de:	f7 da                	neg    %edx
+  8029e0:	83 d1 00             	adc    $0x0,%ecx
+  8029e3:	f7 d9                	neg    %ecx
+  8029e5:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8029e8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029ed:	e9 e1 00 00 00       	jmp    802ad3 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8029f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029f5:	8b 00                	mov    (%eax),%eax
+  8029f7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029fa:	89 c1                	mov    %eax,%ecx
+  8029fc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8029ff:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802a02:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a05:	8d 40 04             	lea    0x4(%eax),%eax
+  802a08:	89 45 14             	mov    %eax,0x14(%ebp)
+  802a0b:	eb b0                	jmp    8029bd <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  802a0d:	83 f9 01             	cmp    $0x1,%ecx
+  802a10:	7f 1e                	jg     802a30 <vprintfmt+0x319>
+	else if (lflag)
+  802a12:	85 c9                	test   %ecx,%ecx
+  802a14:	74 32                	je     802a48 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802a16:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a19:	8b 10                	mov    (%eax),%edx
+  802a1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a20:	8d 40 04             	lea    0x4(%eax),%eax
+  802a23:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a26:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  802a2b:	e9 a3 00 00 00       	jmp    802ad3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a30:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a33:	8b 10                	mov    (%eax),%edx
+  802a35:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a38:	8d 40 08             	lea    0x8(%eax),%eax
+  802a3b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a3e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  802a43:	e9 8b 00 00 00       	jmp    802ad3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a48:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a4b:	8b 10                	mov    (%eax),%edx
+  802a4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a52:	8d 40 04             	lea    0x4(%eax),%eax
+  802a55:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a58:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  802a5d:	eb 74                	jmp    802ad3 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  802a5f:	83 f9 01             	cmp    $0x1,%ecx
+  802a62:	7f 1b                	jg     802a7f <vprintfmt+0x368>
+	else if (lflag)
+  802a64:	85 c9                	test   %ecx,%ecx
+  802a66:	74 2c                	je     802a94 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  802a68:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a6b:	8b 10                	mov    (%eax),%edx
+  802a6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a72:	8d 40 04             	lea    0x4(%eax),%eax
+  802a75:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a78:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  802a7d:	eb 54                	jmp    802ad3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a82:	8b 10                	mov    (%eax),%edx
+  802a84:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a87:	8d 40 08             	lea    0x8(%eax),%eax
+  802a8a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a8d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  802a92:	eb 3f                	jmp    802ad3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a94:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a97:	8b 10                	mov    (%eax),%edx
+  802a99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a9e:	8d 40 04             	lea    0x4(%eax),%eax
+  802aa1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802aa4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802aa9:	eb 28                	jmp    802ad3 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  802aab:	83 ec 08             	sub    $0x8,%esp
+  802aae:	53                   	push   %ebx
+  802aaf:	6a 30                	push   $0x30
+  802ab1:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802ab3:	83 c4 08             	add    $0x8,%esp
+  802ab6:	53                   	push   %ebx
+  802ab7:	6a 78                	push   $0x78
+  802ab9:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802abb:	8b 45 14             	mov    0x14(%ebp),%eax
+  802abe:	8b 10                	mov    (%eax),%edx
+  802ac0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802ac5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802ac8:	8d 40 04             	lea    0x4(%eax),%eax
+  802acb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802ace:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802ad3:	83 ec 0c             	sub    $0xc,%esp
+  802ad6:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802ada:	50                   	push   %eax
+  802adb:	ff 75 e0             	push   -0x20(%ebp)
+  802ade:	57                   	push   %edi
+  802adf:	51                   	push   %ecx
+  802ae0:	52                   	push   %edx
+  802ae1:	89 da                	mov    %ebx,%edx
+  802ae3:	89 f0                	mov    %esi,%eax
+  802ae5:	e8 4a fb ff ff       	call   802634 <printnum>
+			break;
+  802aea:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802aed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802af0:	e9 40 fc ff ff       	jmp    802735 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802af5:	83 f9 01             	cmp    $0x1,%ecx
+  802af8:	7f 1b                	jg     802b15 <vprintfmt+0x3fe>
+	else if (lflag)
+  802afa:	85 c9                	test   %ecx,%ecx
+  802afc:	74 2c                	je     802b2a <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802afe:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b01:	8b 10                	mov    (%eax),%edx
+  802b03:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b08:	8d 40 04             	lea    0x4(%eax),%eax
+  802b0b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b0e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802b13:	eb be                	jmp    802ad3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802b15:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b18:	8b 10                	mov    (%eax),%edx
+  802b1a:	8b 48 04             	mov    0x4(%eax),%ecx
+  802b1d:	8d 40 08             	lea    0x8(%eax),%eax
+  802b20:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b23:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802b28:	eb a9                	jmp    802ad3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802b2a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b2d:	8b 10                	mov    (%eax),%edx
+  802b2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b34:	8d 40 04             	lea    0x4(%eax),%eax
+  802b37:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b3a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  802b3f:	eb 92                	jmp    802ad3 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  802b41:	83 ec 08             	sub    $0x8,%esp
+  802b44:	53                   	push   %ebx
+  802b45:	6a 25                	push   $0x25
+  802b47:	ff d6                	call   *%esi
+			break;
+  802b49:	83 c4 10             	add    $0x10,%esp
+  802b4c:	eb 9f                	jmp    802aed <vprintfmt+0x3d6>
+			putch('%', putdat);
+  802b4e:	83 ec 08             	sub    $0x8,%esp
+  802b51:	53                   	push   %ebx
+  802b52:	6a 25                	push   $0x25
+  802b54:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802b56:	83 c4 10             	add    $0x10,%esp
+  802b59:	89 f8                	mov    %edi,%eax
+  802b5b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802b5f:	74 05                	je     802b66 <vprintfmt+0x44f>
+  802b61:	83 e8 01             	sub    $0x1,%eax
+  802b64:	eb f5                	jmp    802b5b <vprintfmt+0x444>
+  802b66:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b69:	eb 82                	jmp    802aed <vprintfmt+0x3d6>
+
+00802b6b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802b6b:	55                   	push   %ebp
+  802b6c:	89 e5                	mov    %esp,%ebp
+  802b6e:	83 ec 18             	sub    $0x18,%esp
+  802b71:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b74:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  802b77:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802b7a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802b7e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802b81:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802b88:	85 c0                	test   %eax,%eax
+  802b8a:	74 26                	je     802bb2 <vsnprintf+0x47>
+  802b8c:	85 d2                	test   %edx,%edx
+  802b8e:	7e 22                	jle    802bb2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  802b90:	ff 75 14             	push   0x14(%ebp)
+  802b93:	ff 75 10             	push   0x10(%ebp)
+  802b96:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802b99:	50                   	push   %eax
+  802b9a:	68 dd 26 80 00       	push   $0x8026dd
+  802b9f:	e8 73 fb ff ff       	call   802717 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802ba4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802ba7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802baa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bad:	83 c4 10             	add    $0x10,%esp
+}
+  802bb0:	c9                   	leave
+  802bb1:	c3                   	ret
+		return -E_INVAL;
+  802bb2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bb7:	eb f7                	jmp    802bb0 <vsnprintf+0x45>
+
+00802bb9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802bb9:	55                   	push   %ebp
+  802bba:	89 e5                	mov    %esp,%ebp
+  802bbc:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  802bbf:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802bc2:	50                   	push   %eax
+  802bc3:	ff 75 10             	push   0x10(%ebp)
+  802bc6:	ff 75 0c             	push   0xc(%ebp)
+  802bc9:	ff 75 08             	push   0x8(%ebp)
+  802bcc:	e8 9a ff ff ff       	call   802b6b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802bd1:	c9                   	leave
+  802bd2:	c3                   	ret
+
+00802bd3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802bd3:	55                   	push   %ebp
+  802bd4:	89 e5                	mov    %esp,%ebp
+  802bd6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802bd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bde:	eb 03                	jmp    802be3 <strlen+0x10>
+		n++;
+  802be0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802be3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802be7:	75 f7                	jne    802be0 <strlen+0xd>
+	return n;
+}
+  802be9:	5d                   	pop    %ebp
+  802bea:	c3                   	ret
+
+00802beb <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802beb:	55                   	push   %ebp
+  802bec:	89 e5                	mov    %esp,%ebp
+  802bee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802bf1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf9:	eb 03                	jmp    802bfe <strnlen+0x13>
+		n++;
+  802bfb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802bfe:	39 d0                	cmp    %edx,%eax
+  802c00:	74 08                	je     802c0a <strnlen+0x1f>
+  802c02:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802c06:	75 f3                	jne    802bfb <strnlen+0x10>
+  802c08:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802c0a:	89 d0                	mov    %edx,%eax
+  802c0c:	5d                   	pop    %ebp
+  802c0d:	c3                   	ret
+
+00802c0e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802c0e:	55                   	push   %ebp
+  802c0f:	89 e5                	mov    %esp,%ebp
+  802c11:	53                   	push   %ebx
+  802c12:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c15:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802c21:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802c24:	83 c0 01             	add    $0x1,%eax
+  802c27:	84 d2                	test   %dl,%dl
+  802c29:	75 f2                	jne    802c1d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  802c2b:	89 c8                	mov    %ecx,%eax
+  802c2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c30:	c9                   	leave
+  802c31:	c3                   	ret
+
+00802c32 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802c32:	55                   	push   %ebp
+  802c33:	89 e5                	mov    %esp,%ebp
+  802c35:	53                   	push   %ebx
+  802c36:	83 ec 10             	sub    $0x10,%esp
+  802c39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  802c3c:	53                   	push   %ebx
+  802c3d:	e8 91 ff ff ff       	call   802bd3 <strlen>
+  802c42:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  802c45:	ff 75 0c             	push   0xc(%ebp)
+  802c48:	01 d8                	add    %ebx,%eax
+  802c4a:	50                   	push   %eax
+  802c4b:	e8 be ff ff ff       	call   802c0e <strcpy>
+	return dst;
+}
+  802c50:	89 d8                	mov    %ebx,%eax
+  802c52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c55:	c9                   	leave
+  802c56:	c3                   	ret
+
+00802c57 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802c57:	55                   	push   %ebp
+  802c58:	89 e5                	mov    %esp,%ebp
+  802c5a:	56                   	push   %esi
+  802c5b:	53                   	push   %ebx
+  802c5c:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  802c62:	89 f3                	mov    %esi,%ebx
+  802c64:	03 5d 10             	add    0x10(%ebp),%ebx
+  802c67:	89 f0                	mov    %esi,%eax
+  802c69:	eb 0f                	jmp    802c7a <strncpy+0x23>
+		*dst++ = *src;
+  802c6b:	83 c0 01             	add    $0x1,%eax
+  802c6e:	0f b6 0a             	movzbl (%edx),%ecx
+  802c71:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  802c74:	80 f9 01             	cmp    $0x1,%cl
+  802c77:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  802c7a:	39 d8                	cmp    %ebx,%eax
+  802c7c:	75 ed                	jne    802c6b <strncpy+0x14>
+	}
+	return ret;
+}
+  802c7e:	89 f0                	mov    %esi,%eax
+  802c80:	5b                   	pop    %ebx
+  802c81:	5e                   	pop    %esi
+  802c82:	5d                   	pop    %ebp
+  802c83:	c3                   	ret
+
+00802c84 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802c84:	55                   	push   %ebp
+  802c85:	89 e5                	mov    %esp,%ebp
+  802c87:	56                   	push   %esi
+  802c88:	53                   	push   %ebx
+  802c89:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c8f:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  802c92:	89 f0                	mov    %esi,%eax
+  802c94:	85 d2                	test   %edx,%edx
+  802c96:	74 21                	je     802cb9 <strlcpy+0x35>
+  802c98:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  802c9c:	89 f2                	mov    %esi,%edx
+  802c9e:	eb 09                	jmp    802ca9 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  802ca0:	83 c1 01             	add    $0x1,%ecx
+  802ca3:	83 c2 01             	add    $0x1,%edx
+  802ca6:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  802ca9:	39 c2                	cmp    %eax,%edx
+  802cab:	74 09                	je     802cb6 <strlcpy+0x32>
+  802cad:	0f b6 19             	movzbl (%ecx),%ebx
+  802cb0:	84 db                	test   %bl,%bl
+  802cb2:	75 ec                	jne    802ca0 <strlcpy+0x1c>
+  802cb4:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802cb6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802cb9:	29 f0                	sub    %esi,%eax
+}
+  802cbb:	5b                   	pop    %ebx
+  802cbc:	5e                   	pop    %esi
+  802cbd:	5d                   	pop    %ebp
+  802cbe:	c3                   	ret
+
+00802cbf <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802cbf:	55                   	push   %ebp
+  802cc0:	89 e5                	mov    %esp,%ebp
+  802cc2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802cc5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802cc8:	eb 06                	jmp    802cd0 <strcmp+0x11>
+		p++, q++;
+  802cca:	83 c1 01             	add    $0x1,%ecx
+  802ccd:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802cd0:	0f b6 01             	movzbl (%ecx),%eax
+  802cd3:	84 c0                	test   %al,%al
+  802cd5:	74 04                	je     802cdb <strcmp+0x1c>
+  802cd7:	3a 02                	cmp    (%edx),%al
+  802cd9:	74 ef                	je     802cca <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802cdb:	0f b6 c0             	movzbl %al,%eax
+  802cde:	0f b6 12             	movzbl (%edx),%edx
+  802ce1:	29 d0                	sub    %edx,%eax
+}
+  802ce3:	5d                   	pop    %ebp
+  802ce4:	c3                   	ret
+
+00802ce5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802ce5:	55                   	push   %ebp
+  802ce6:	89 e5                	mov    %esp,%ebp
+  802ce8:	53                   	push   %ebx
+  802ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cef:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802cf2:	eb 09                	jmp    802cfd <strncmp+0x18>
+		n--, p++, q++;
+  802cf4:	83 ea 01             	sub    $0x1,%edx
+  802cf7:	83 c0 01             	add    $0x1,%eax
+  802cfa:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802cfd:	85 d2                	test   %edx,%edx
+  802cff:	74 18                	je     802d19 <strncmp+0x34>
+  802d01:	0f b6 18             	movzbl (%eax),%ebx
+  802d04:	84 db                	test   %bl,%bl
+  802d06:	74 04                	je     802d0c <strncmp+0x27>
+  802d08:	3a 19                	cmp    (%ecx),%bl
+  802d0a:	74 e8                	je     802cf4 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802d0c:	0f b6 00             	movzbl (%eax),%eax
+  802d0f:	0f b6 11             	movzbl (%ecx),%edx
+  802d12:	29 d0                	sub    %edx,%eax
+}
+  802d14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d17:	c9                   	leave
+  802d18:	c3                   	ret
+		return 0;
+  802d19:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1e:	eb f4                	jmp    802d14 <strncmp+0x2f>
+
+00802d20 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802d20:	55                   	push   %ebp
+  802d21:	89 e5                	mov    %esp,%ebp
+  802d23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d26:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d2a:	eb 03                	jmp    802d2f <strchr+0xf>
+  802d2c:	83 c0 01             	add    $0x1,%eax
+  802d2f:	0f b6 10             	movzbl (%eax),%edx
+  802d32:	84 d2                	test   %dl,%dl
+  802d34:	74 06                	je     802d3c <strchr+0x1c>
+		if (*s == c)
+  802d36:	38 ca                	cmp    %cl,%dl
+  802d38:	75 f2                	jne    802d2c <strchr+0xc>
+  802d3a:	eb 05                	jmp    802d41 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  802d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d41:	5d                   	pop    %ebp
+  802d42:	c3                   	ret
+
+00802d43 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802d43:	55                   	push   %ebp
+  802d44:	89 e5                	mov    %esp,%ebp
+  802d46:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d49:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d4d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  802d50:	38 ca                	cmp    %cl,%dl
+  802d52:	74 09                	je     802d5d <strfind+0x1a>
+  802d54:	84 d2                	test   %dl,%dl
+  802d56:	74 05                	je     802d5d <strfind+0x1a>
+	for (; *s; s++)
+  802d58:	83 c0 01             	add    $0x1,%eax
+  802d5b:	eb f0                	jmp    802d4d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  802d5d:	5d                   	pop    %ebp
+  802d5e:	c3                   	ret
+
+00802d5f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802d5f:	55                   	push   %ebp
+  802d60:	89 e5                	mov    %esp,%ebp
+  802d62:	57                   	push   %edi
+  802d63:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d66:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  802d69:	85 c9                	test   %ecx,%ecx
+  802d6b:	74 20                	je     802d8d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  802d6d:	89 f8                	mov    %edi,%eax
+  802d6f:	09 c8                	or     %ecx,%eax
+  802d71:	a8 03                	test   $0x3,%al
+  802d73:	75 12                	jne    802d87 <memset+0x28>
+		c &= 0xFF;
+  802d75:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802d79:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  802d7f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  802d82:	fc                   	cld
+  802d83:	f3 ab                	rep stos %eax,%es:(%edi)
+  802d85:	eb 06                	jmp    802d8d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  802d87:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d8a:	fc                   	cld
+  802d8b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  802d8d:	89 f8                	mov    %edi,%eax
+  802d8f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802d92:	c9                   	leave
+  802d93:	c3                   	ret
+
+00802d94 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  802d94:	55                   	push   %ebp
+  802d95:	89 e5                	mov    %esp,%ebp
+  802d97:	57                   	push   %edi
+  802d98:	56                   	push   %esi
+  802d99:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d9c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d9f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  802da2:	39 c6                	cmp    %eax,%esi
+  802da4:	73 32                	jae    802dd8 <memmove+0x44>
+  802da6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802da9:	39 d0                	cmp    %edx,%eax
+  802dab:	73 2b                	jae    802dd8 <memmove+0x44>
+		s += n;
+		d += n;
+  802dad:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802db0:	89 d6                	mov    %edx,%esi
+  802db2:	09 fe                	or     %edi,%esi
+  802db4:	09 ce                	or     %ecx,%esi
+  802db6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802dbc:	75 0e                	jne    802dcc <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802dbe:	83 ef 04             	sub    $0x4,%edi
+  802dc1:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802dc4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802dc7:	fd                   	std
+  802dc8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802dca:	eb 09                	jmp    802dd5 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802dcc:	83 ef 01             	sub    $0x1,%edi
+  802dcf:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802dd2:	fd                   	std
+  802dd3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802dd5:	fc                   	cld
+  802dd6:	eb 1a                	jmp    802df2 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802dd8:	89 f2                	mov    %esi,%edx
+  802dda:	09 c2                	or     %eax,%edx
+  802ddc:	09 ca                	or     %ecx,%edx
+  802dde:	f6 c2 03             	test   $0x3,%dl
+  802de1:	75 0a                	jne    802ded <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802de3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802de6:	89 c7                	mov    %eax,%edi
+  802de8:	fc                   	cld
+  802de9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802deb:	eb 05                	jmp    802df2 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802ded:	89 c7                	mov    %eax,%edi
+  802def:	fc                   	cld
+  802df0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802df2:	5e                   	pop    %esi
+  802df3:	5f                   	pop    %edi
+  802df4:	5d                   	pop    %ebp
+  802df5:	c3                   	ret
+
+00802df6 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802df6:	55                   	push   %ebp
+  802df7:	89 e5                	mov    %esp,%ebp
+  802df9:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802dfc:	ff 75 10             	push   0x10(%ebp)
+  802dff:	ff 75 0c             	push   0xc(%ebp)
+  802e02:	ff 75 08             	push   0x8(%ebp)
+  802e05:	e8 8a ff ff ff       	call   802d94 <memmove>
+}
+  802e0a:	c9                   	leave
+  802e0b:	c3                   	ret
+
+00802e0c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802e0c:	55                   	push   %ebp
+  802e0d:	89 e5                	mov    %esp,%ebp
+  802e0f:	56                   	push   %esi
+  802e10:	53                   	push   %ebx
+  802e11:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e14:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802e17:	89 c6                	mov    %eax,%esi
+  802e19:	03 75 10             	add    0x10(%ebp),%esi
+  802e1c:	eb 06                	jmp    802e24 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802e1e:	83 c0 01             	add    $0x1,%eax
+  802e21:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802e24:	39 f0                	cmp    %esi,%eax
+  802e26:	74 14                	je     802e3c <memcmp+0x30>
+		if (*s1 != *s2)
+  802e28:	0f b6 08             	movzbl (%eax),%ecx
+  802e2b:	0f b6 1a             	movzbl (%edx),%ebx
+  802e2e:	38 d9                	cmp    %bl,%cl
+  802e30:	74 ec                	je     802e1e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802e32:	0f b6 c1             	movzbl %cl,%eax
+  802e35:	0f b6 db             	movzbl %bl,%ebx
+  802e38:	29 d8                	sub    %ebx,%eax
+  802e3a:	eb 05                	jmp    802e41 <memcmp+0x35>
+	}
+
+	return 0;
+  802e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e41:	5b                   	pop    %ebx
+  802e42:	5e                   	pop    %esi
+  802e43:	5d                   	pop    %ebp
+  802e44:	c3                   	ret
+
+00802e45 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802e45:	55                   	push   %ebp
+  802e46:	89 e5                	mov    %esp,%ebp
+  802e48:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802e4e:	89 c2                	mov    %eax,%edx
+  802e50:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802e53:	eb 03                	jmp    802e58 <memfind+0x13>
+  802e55:	83 c0 01             	add    $0x1,%eax
+  802e58:	39 d0                	cmp    %edx,%eax
+  802e5a:	73 04                	jae    802e60 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802e5c:	38 08                	cmp    %cl,(%eax)
+  802e5e:	75 f5                	jne    802e55 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802e60:	5d                   	pop    %ebp
+  802e61:	c3                   	ret
+
+00802e62 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802e62:	55                   	push   %ebp
+  802e63:	89 e5                	mov    %esp,%ebp
+  802e65:	57                   	push   %edi
+  802e66:	56                   	push   %esi
+  802e67:	53                   	push   %ebx
+  802e68:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802e6e:	eb 03                	jmp    802e73 <strtol+0x11>
+		s++;
+  802e70:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802e73:	0f b6 02             	movzbl (%edx),%eax
+  802e76:	3c 20                	cmp    $0x20,%al
+  802e78:	74 f6                	je     802e70 <strtol+0xe>
+  802e7a:	3c 09                	cmp    $0x9,%al
+  802e7c:	74 f2                	je     802e70 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802e7e:	3c 2b                	cmp    $0x2b,%al
+  802e80:	74 2a                	je     802eac <strtol+0x4a>
+	int neg = 0;
+  802e82:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802e87:	3c 2d                	cmp    $0x2d,%al
+  802e89:	74 2b                	je     802eb6 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802e8b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802e91:	75 0f                	jne    802ea2 <strtol+0x40>
+  802e93:	80 3a 30             	cmpb   $0x30,(%edx)
+  802e96:	74 28                	je     802ec0 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802e98:	85 db                	test   %ebx,%ebx
+  802e9a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802e9f:	0f 44 d8             	cmove  %eax,%ebx
+  802ea2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ea7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802eaa:	eb 46                	jmp    802ef2 <strtol+0x90>
+		s++;
+  802eac:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802eaf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb4:	eb d5                	jmp    802e8b <strtol+0x29>
+		s++, neg = 1;
+  802eb6:	83 c2 01             	add    $0x1,%edx
+  802eb9:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ebe:	eb cb                	jmp    802e8b <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802ec0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802ec4:	74 0e                	je     802ed4 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802ec6:	85 db                	test   %ebx,%ebx
+  802ec8:	75 d8                	jne    802ea2 <strtol+0x40>
+		s++, base = 8;
+  802eca:	83 c2 01             	add    $0x1,%edx
+  802ecd:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802ed2:	eb ce                	jmp    802ea2 <strtol+0x40>
+		s += 2, base = 16;
+  802ed4:	83 c2 02             	add    $0x2,%edx
+  802ed7:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802edc:	eb c4                	jmp    802ea2 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802ede:	0f be c0             	movsbl %al,%eax
+  802ee1:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802ee4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802ee7:	7d 3a                	jge    802f23 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802ee9:	83 c2 01             	add    $0x1,%edx
+  802eec:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802ef0:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802ef2:	0f b6 02             	movzbl (%edx),%eax
+  802ef5:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802ef8:	89 f3                	mov    %esi,%ebx
+  802efa:	80 fb 09             	cmp    $0x9,%bl
+  802efd:	76 df                	jbe    802ede <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  802eff:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802f02:	89 f3                	mov    %esi,%ebx
+  802f04:	80 fb 19             	cmp    $0x19,%bl
+  802f07:	77 08                	ja     802f11 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802f09:	0f be c0             	movsbl %al,%eax
+  802f0c:	83 e8 57             	sub    $0x57,%eax
+  802f0f:	eb d3                	jmp    802ee4 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802f11:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802f14:	89 f3                	mov    %esi,%ebx
+  802f16:	80 fb 19             	cmp    $0x19,%bl
+  802f19:	77 08                	ja     802f23 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802f1b:	0f be c0             	movsbl %al,%eax
+  802f1e:	83 e8 37             	sub    $0x37,%eax
+  802f21:	eb c1                	jmp    802ee4 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802f23:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802f27:	74 05                	je     802f2e <strtol+0xcc>
+		*endptr = (char *) s;
+  802f29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f2c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802f2e:	89 c8                	mov    %ecx,%eax
+  802f30:	f7 d8                	neg    %eax
+  802f32:	85 ff                	test   %edi,%edi
+  802f34:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802f37:	89 c8                	mov    %ecx,%eax
+  802f39:	5b                   	pop    %ebx
+  802f3a:	5e                   	pop    %esi
+  802f3b:	5f                   	pop    %edi
+  802f3c:	5d                   	pop    %ebp
+  802f3d:	c3                   	ret
+
+00802f3e <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802f3e:	55                   	push   %ebp
+  802f3f:	89 e5                	mov    %esp,%ebp
+  802f41:	57                   	push   %edi
+  802f42:	56                   	push   %esi
+  802f43:	53                   	push   %ebx
+  802f44:	83 ec 20             	sub    $0x20,%esp
+  802f47:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f4a:	89 d7                	mov    %edx,%edi
+  802f4c:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802f4e:	51                   	push   %ecx
+  802f4f:	68 00 f0 7f 00       	push   $0x7ff000
+  802f54:	6a 00                	push   $0x0
+  802f56:	e8 2e d2 ff ff       	call   800189 <sys_page_alloc>
+  802f5b:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f5d:	83 c4 10             	add    $0x10,%esp
+  802f60:	85 c0                	test   %eax,%eax
+  802f62:	78 45                	js     802fa9 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802f64:	83 ec 04             	sub    $0x4,%esp
+  802f67:	68 00 10 00 00       	push   $0x1000
+  802f6c:	57                   	push   %edi
+  802f6d:	68 00 f0 7f 00       	push   $0x7ff000
+  802f72:	e8 1d fe ff ff       	call   802d94 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  802f77:	89 34 24             	mov    %esi,(%esp)
+  802f7a:	57                   	push   %edi
+  802f7b:	ff 75 e4             	push   -0x1c(%ebp)
+  802f7e:	68 00 f0 7f 00       	push   $0x7ff000
+  802f83:	6a 00                	push   $0x0
+  802f85:	e8 4a d2 ff ff       	call   8001d4 <sys_page_map>
+  802f8a:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f8c:	83 c4 20             	add    $0x20,%esp
+  802f8f:	85 c0                	test   %eax,%eax
+  802f91:	78 16                	js     802fa9 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802f93:	83 ec 08             	sub    $0x8,%esp
+  802f96:	68 00 f0 7f 00       	push   $0x7ff000
+  802f9b:	6a 00                	push   $0x0
+  802f9d:	e8 74 d2 ff ff       	call   800216 <sys_page_unmap>
+  802fa2:	83 c4 10             	add    $0x10,%esp
+  802fa5:	85 c0                	test   %eax,%eax
+  802fa7:	75 0a                	jne    802fb3 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  802fa9:	89 d8                	mov    %ebx,%eax
+  802fab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fae:	5b                   	pop    %ebx
+  802faf:	5e                   	pop    %esi
+  802fb0:	5f                   	pop    %edi
+  802fb1:	5d                   	pop    %ebp
+  802fb2:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802fb3:	68 48 3c 80 00       	push   $0x803c48
+  802fb8:	68 48 38 80 00       	push   $0x803848
+  802fbd:	6a 1b                	push   $0x1b
+  802fbf:	68 c0 3c 80 00       	push   $0x803cc0
+  802fc4:	e8 7c f5 ff ff       	call   802545 <_panic>
+
+00802fc9 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802fc9:	55                   	push   %ebp
+  802fca:	89 e5                	mov    %esp,%ebp
+  802fcc:	53                   	push   %ebx
+  802fcd:	83 ec 04             	sub    $0x4,%esp
+  802fd0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  802fd3:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802fd5:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  802fd9:	74 21                	je     802ffc <pgfault+0x33>
+  802fdb:	89 d0                	mov    %edx,%eax
+  802fdd:	c1 e8 16             	shr    $0x16,%eax
+  802fe0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802fe7:	a8 01                	test   $0x1,%al
+  802fe9:	74 11                	je     802ffc <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  802feb:	89 d0                	mov    %edx,%eax
+  802fed:	c1 e8 0c             	shr    $0xc,%eax
+  802ff0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802ff7:	f6 c4 08             	test   $0x8,%ah
+  802ffa:	75 17                	jne    803013 <pgfault+0x4a>
+		if (pgfault_next) {
+  802ffc:	a1 04 90 80 00       	mov    0x809004,%eax
+  803001:	85 c0                	test   %eax,%eax
+  803003:	74 27                	je     80302c <pgfault+0x63>
+			pgfault_next(utf);
+  803005:	83 ec 0c             	sub    $0xc,%esp
+  803008:	53                   	push   %ebx
+  803009:	ff d0                	call   *%eax
+			return;
+  80300b:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  80300e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803011:	c9                   	leave
+  803012:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803013:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803019:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80301e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803023:	e8 16 ff ff ff       	call   802f3e <copy_page_to>
+  803028:	85 c0                	test   %eax,%eax
+  80302a:	79 e2                	jns    80300e <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  80302c:	a1 00 50 80 00       	mov    0x805000,%eax
+  803031:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803034:	ff 73 28             	push   0x28(%ebx)
+  803037:	ff 33                	push   (%ebx)
+  803039:	50                   	push   %eax
+  80303a:	68 6c 3c 80 00       	push   $0x803c6c
+  80303f:	e8 dc f5 ff ff       	call   802620 <cprintf>
+	sys_env_destroy(0);
+  803044:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80304b:	e8 aa d0 ff ff       	call   8000fa <sys_env_destroy>
+  803050:	83 c4 10             	add    $0x10,%esp
+  803053:	eb b9                	jmp    80300e <pgfault+0x45>
+
+00803055 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803055:	55                   	push   %ebp
+  803056:	89 e5                	mov    %esp,%ebp
+  803058:	53                   	push   %ebx
+  803059:	83 ec 04             	sub    $0x4,%esp
+  80305c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80305f:	a1 08 90 80 00       	mov    0x809008,%eax
+  803064:	3d c9 2f 80 00       	cmp    $0x802fc9,%eax
+  803069:	74 15                	je     803080 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80306b:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  803070:	83 ec 0c             	sub    $0xc,%esp
+  803073:	68 c9 2f 80 00       	push   $0x802fc9
+  803078:	e8 fb 03 00 00       	call   803478 <set_pgfault_handler>
+  80307d:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803080:	83 ec 0c             	sub    $0xc,%esp
+  803083:	68 05 08 00 00       	push   $0x805
+  803088:	53                   	push   %ebx
+  803089:	6a 00                	push   $0x0
+  80308b:	53                   	push   %ebx
+  80308c:	6a 00                	push   $0x0
+  80308e:	e8 41 d1 ff ff       	call   8001d4 <sys_page_map>
+}
+  803093:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803096:	c9                   	leave
+  803097:	c3                   	ret
+
+00803098 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803098:	55                   	push   %ebp
+  803099:	89 e5                	mov    %esp,%ebp
+  80309b:	57                   	push   %edi
+  80309c:	56                   	push   %esi
+  80309d:	53                   	push   %ebx
+  80309e:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8030a1:	68 c9 2f 80 00       	push   $0x802fc9
+  8030a6:	e8 cd 03 00 00       	call   803478 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8030ab:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030b0:	cd 30                	int    $0x30
+  8030b2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8030b8:	83 c4 10             	add    $0x10,%esp
+  8030bb:	85 c0                	test   %eax,%eax
+  8030bd:	0f 88 6b 01 00 00    	js     80322e <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8030c8:	75 37                	jne    803101 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8030ca:	e8 74 d0 ff ff       	call   800143 <sys_getenvid>
+  8030cf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030d4:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8030da:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8030df:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8030e4:	e9 45 01 00 00       	jmp    80322e <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8030e9:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030ef:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8030f5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8030fb:	0f 87 ba 00 00 00    	ja     8031bb <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803101:	89 d8                	mov    %ebx,%eax
+  803103:	c1 e8 16             	shr    $0x16,%eax
+  803106:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80310d:	a8 01                	test   $0x1,%al
+  80310f:	74 d8                	je     8030e9 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803111:	89 d8                	mov    %ebx,%eax
+  803113:	c1 e8 0c             	shr    $0xc,%eax
+  803116:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80311d:	f6 c2 01             	test   $0x1,%dl
+  803120:	74 cd                	je     8030ef <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803122:	89 da                	mov    %ebx,%edx
+  803124:	80 e6 df             	and    $0xdf,%dh
+  803127:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  80312d:	74 c0                	je     8030ef <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  80312f:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803131:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803138:	f6 c6 04             	test   $0x4,%dh
+  80313b:	75 53                	jne    803190 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80313d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803144:	f6 c6 08             	test   $0x8,%dh
+  803147:	75 0c                	jne    803155 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803149:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803150:	f6 c2 02             	test   $0x2,%dl
+  803153:	74 3b                	je     803190 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803155:	83 ec 0c             	sub    $0xc,%esp
+  803158:	68 05 08 00 00       	push   $0x805
+  80315d:	57                   	push   %edi
+  80315e:	ff 75 e4             	push   -0x1c(%ebp)
+  803161:	57                   	push   %edi
+  803162:	6a 00                	push   $0x0
+  803164:	e8 6b d0 ff ff       	call   8001d4 <sys_page_map>
+  803169:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80316b:	83 c4 20             	add    $0x20,%esp
+  80316e:	85 c0                	test   %eax,%eax
+  803170:	0f 88 a7 00 00 00    	js     80321d <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803176:	83 ec 0c             	sub    $0xc,%esp
+  803179:	68 05 08 00 00       	push   $0x805
+  80317e:	57                   	push   %edi
+  80317f:	6a 00                	push   $0x0
+  803181:	57                   	push   %edi
+  803182:	6a 00                	push   $0x0
+  803184:	e8 4b d0 ff ff       	call   8001d4 <sys_page_map>
+  803189:	89 c6                	mov    %eax,%esi
+	return r;
+  80318b:	83 c4 20             	add    $0x20,%esp
+  80318e:	eb 21                	jmp    8031b1 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803190:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803197:	83 ec 0c             	sub    $0xc,%esp
+  80319a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80319f:	50                   	push   %eax
+  8031a0:	57                   	push   %edi
+  8031a1:	ff 75 e4             	push   -0x1c(%ebp)
+  8031a4:	57                   	push   %edi
+  8031a5:	6a 00                	push   $0x0
+  8031a7:	e8 28 d0 ff ff       	call   8001d4 <sys_page_map>
+  8031ac:	89 c6                	mov    %eax,%esi
+  8031ae:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8031b1:	85 f6                	test   %esi,%esi
+  8031b3:	0f 89 36 ff ff ff    	jns    8030ef <fork+0x57>
+  8031b9:	eb 62                	jmp    80321d <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031bb:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031c0:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8031c5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8031c8:	89 f8                	mov    %edi,%eax
+  8031ca:	e8 6f fd ff ff       	call   802f3e <copy_page_to>
+  8031cf:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031d1:	85 c0                	test   %eax,%eax
+  8031d3:	78 48                	js     80321d <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031d5:	83 ec 04             	sub    $0x4,%esp
+  8031d8:	6a 07                	push   $0x7
+  8031da:	68 00 f0 bf ee       	push   $0xeebff000
+  8031df:	57                   	push   %edi
+  8031e0:	e8 a4 cf ff ff       	call   800189 <sys_page_alloc>
+  8031e5:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031e7:	83 c4 10             	add    $0x10,%esp
+  8031ea:	85 c0                	test   %eax,%eax
+  8031ec:	78 2f                	js     80321d <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8031ee:	a1 00 50 80 00       	mov    0x805000,%eax
+  8031f3:	8b 40 64             	mov    0x64(%eax),%eax
+  8031f6:	83 ec 08             	sub    $0x8,%esp
+  8031f9:	50                   	push   %eax
+  8031fa:	57                   	push   %edi
+  8031fb:	e8 f4 d0 ff ff       	call   8002f4 <sys_env_set_pgfault_upcall>
+  803200:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803202:	83 c4 10             	add    $0x10,%esp
+  803205:	85 c0                	test   %eax,%eax
+  803207:	78 14                	js     80321d <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803209:	83 ec 08             	sub    $0x8,%esp
+  80320c:	6a 02                	push   $0x2
+  80320e:	57                   	push   %edi
+  80320f:	e8 4c d0 ff ff       	call   800260 <sys_env_set_status>
+  803214:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803216:	83 c4 10             	add    $0x10,%esp
+  803219:	85 c0                	test   %eax,%eax
+  80321b:	79 11                	jns    80322e <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  80321d:	83 ec 0c             	sub    $0xc,%esp
+  803220:	ff 75 e0             	push   -0x20(%ebp)
+  803223:	e8 d2 ce ff ff       	call   8000fa <sys_env_destroy>
+	return r;
+  803228:	83 c4 10             	add    $0x10,%esp
+  80322b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  80322e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803231:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803234:	5b                   	pop    %ebx
+  803235:	5e                   	pop    %esi
+  803236:	5f                   	pop    %edi
+  803237:	5d                   	pop    %ebp
+  803238:	c3                   	ret
+
+00803239 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803239:	55                   	push   %ebp
+  80323a:	89 e5                	mov    %esp,%ebp
+  80323c:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80323f:	68 cb 3c 80 00       	push   $0x803ccb
+  803244:	68 bf 00 00 00       	push   $0xbf
+  803249:	68 c0 3c 80 00       	push   $0x803cc0
+  80324e:	e8 f2 f2 ff ff       	call   802545 <_panic>
+
+00803253 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803253:	55                   	push   %ebp
+  803254:	89 e5                	mov    %esp,%ebp
+  803256:	56                   	push   %esi
+  803257:	53                   	push   %ebx
+  803258:	8b 75 08             	mov    0x8(%ebp),%esi
+  80325b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80325e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803261:	85 c0                	test   %eax,%eax
+  803263:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803268:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80326b:	83 ec 0c             	sub    $0xc,%esp
+  80326e:	50                   	push   %eax
+  80326f:	e8 5d d1 ff ff       	call   8003d1 <sys_ipc_recv>
+	if (from_env_store)
+  803274:	83 c4 10             	add    $0x10,%esp
+  803277:	85 f6                	test   %esi,%esi
+  803279:	74 14                	je     80328f <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80327b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803280:	85 c0                	test   %eax,%eax
+  803282:	75 09                	jne    80328d <ipc_recv+0x3a>
+  803284:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80328a:	8b 52 74             	mov    0x74(%edx),%edx
+  80328d:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  80328f:	85 db                	test   %ebx,%ebx
+  803291:	74 25                	je     8032b8 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803293:	85 c0                	test   %eax,%eax
+  803295:	74 0d                	je     8032a4 <ipc_recv+0x51>
+  803297:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  80329d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032a0:	5b                   	pop    %ebx
+  8032a1:	5e                   	pop    %esi
+  8032a2:	5d                   	pop    %ebp
+  8032a3:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8032a4:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032a9:	8b 40 78             	mov    0x78(%eax),%eax
+  8032ac:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8032ae:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032b3:	8b 40 70             	mov    0x70(%eax),%eax
+  8032b6:	eb e5                	jmp    80329d <ipc_recv+0x4a>
+  8032b8:	85 c0                	test   %eax,%eax
+  8032ba:	75 e1                	jne    80329d <ipc_recv+0x4a>
+  8032bc:	eb f0                	jmp    8032ae <ipc_recv+0x5b>
+
+008032be <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8032be:	55                   	push   %ebp
+  8032bf:	89 e5                	mov    %esp,%ebp
+  8032c1:	57                   	push   %edi
+  8032c2:	56                   	push   %esi
+  8032c3:	53                   	push   %ebx
+  8032c4:	83 ec 0c             	sub    $0xc,%esp
+  8032c7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032ca:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032d0:	85 db                	test   %ebx,%ebx
+  8032d2:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032d7:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8032da:	ff 75 14             	push   0x14(%ebp)
+  8032dd:	53                   	push   %ebx
+  8032de:	56                   	push   %esi
+  8032df:	57                   	push   %edi
+  8032e0:	e8 59 d0 ff ff       	call   80033e <sys_ipc_try_send>
+  8032e5:	83 c4 10             	add    $0x10,%esp
+  8032e8:	85 c0                	test   %eax,%eax
+  8032ea:	74 22                	je     80330e <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8032ec:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032ef:	75 07                	jne    8032f8 <ipc_send+0x3a>
+		sys_yield();
+  8032f1:	e8 74 ce ff ff       	call   80016a <sys_yield>
+  8032f6:	eb e2                	jmp    8032da <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8032f8:	68 e1 3c 80 00       	push   $0x803ce1
+  8032fd:	68 48 38 80 00       	push   $0x803848
+  803302:	6a 39                	push   $0x39
+  803304:	68 f6 3c 80 00       	push   $0x803cf6
+  803309:	e8 37 f2 ff ff       	call   802545 <_panic>
+	}
+}
+  80330e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803311:	5b                   	pop    %ebx
+  803312:	5e                   	pop    %esi
+  803313:	5f                   	pop    %edi
+  803314:	5d                   	pop    %ebp
+  803315:	c3                   	ret
+
+00803316 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803316:	55                   	push   %ebp
+  803317:	89 e5                	mov    %esp,%ebp
+  803319:	57                   	push   %edi
+  80331a:	56                   	push   %esi
+  80331b:	53                   	push   %ebx
+  80331c:	83 ec 10             	sub    $0x10,%esp
+  80331f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803322:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803325:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803328:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80332b:	85 c0                	test   %eax,%eax
+  80332d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803332:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803335:	6a 00                	push   $0x0
+  803337:	ff 33                	push   (%ebx)
+  803339:	50                   	push   %eax
+  80333a:	e8 4f d0 ff ff       	call   80038e <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80333f:	83 c4 10             	add    $0x10,%esp
+  803342:	85 c0                	test   %eax,%eax
+  803344:	75 3c                	jne    803382 <ipc_recvv+0x6c>
+  803346:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80334c:	8b 52 7c             	mov    0x7c(%edx),%edx
+  80334f:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803351:	85 ff                	test   %edi,%edi
+  803353:	74 4e                	je     8033a3 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803355:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80335b:	8b 52 74             	mov    0x74(%edx),%edx
+  80335e:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803360:	85 f6                	test   %esi,%esi
+  803362:	74 18                	je     80337c <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803364:	85 c0                	test   %eax,%eax
+  803366:	75 2d                	jne    803395 <ipc_recvv+0x7f>
+  803368:	a1 00 50 80 00       	mov    0x805000,%eax
+  80336d:	8b 40 78             	mov    0x78(%eax),%eax
+  803370:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803372:	a1 00 50 80 00       	mov    0x805000,%eax
+  803377:	8b 40 70             	mov    0x70(%eax),%eax
+  80337a:	eb 1f                	jmp    80339b <ipc_recvv+0x85>
+  80337c:	85 c0                	test   %eax,%eax
+  80337e:	75 1b                	jne    80339b <ipc_recvv+0x85>
+  803380:	eb f0                	jmp    803372 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803382:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803388:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  80338d:	85 ff                	test   %edi,%edi
+  80338f:	75 cd                	jne    80335e <ipc_recvv+0x48>
+	if (perm_store)
+  803391:	85 f6                	test   %esi,%esi
+  803393:	74 e7                	je     80337c <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803395:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80339b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80339e:	5b                   	pop    %ebx
+  80339f:	5e                   	pop    %esi
+  8033a0:	5f                   	pop    %edi
+  8033a1:	5d                   	pop    %ebp
+  8033a2:	c3                   	ret
+	if (perm_store)
+  8033a3:	85 f6                	test   %esi,%esi
+  8033a5:	75 bd                	jne    803364 <ipc_recvv+0x4e>
+  8033a7:	eb c9                	jmp    803372 <ipc_recvv+0x5c>
+
+008033a9 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8033a9:	55                   	push   %ebp
+  8033aa:	89 e5                	mov    %esp,%ebp
+  8033ac:	57                   	push   %edi
+  8033ad:	56                   	push   %esi
+  8033ae:	53                   	push   %ebx
+  8033af:	83 ec 0c             	sub    $0xc,%esp
+  8033b2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033b5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8033bb:	ff 75 14             	push   0x14(%ebp)
+  8033be:	53                   	push   %ebx
+  8033bf:	56                   	push   %esi
+  8033c0:	57                   	push   %edi
+  8033c1:	e8 a0 cf ff ff       	call   800366 <sys_ipc_try_sendv>
+  8033c6:	83 c4 10             	add    $0x10,%esp
+  8033c9:	85 c0                	test   %eax,%eax
+  8033cb:	74 22                	je     8033ef <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8033cd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033d0:	75 07                	jne    8033d9 <ipc_sendv+0x30>
+		sys_yield();
+  8033d2:	e8 93 cd ff ff       	call   80016a <sys_yield>
+  8033d7:	eb e2                	jmp    8033bb <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8033d9:	68 e1 3c 80 00       	push   $0x803ce1
+  8033de:	68 48 38 80 00       	push   $0x803848
+  8033e3:	6a 5c                	push   $0x5c
+  8033e5:	68 f6 3c 80 00       	push   $0x803cf6
+  8033ea:	e8 56 f1 ff ff       	call   802545 <_panic>
+	}
+}
+  8033ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033f2:	5b                   	pop    %ebx
+  8033f3:	5e                   	pop    %esi
+  8033f4:	5f                   	pop    %edi
+  8033f5:	5d                   	pop    %ebp
+  8033f6:	c3                   	ret
+
+008033f7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8033f7:	55                   	push   %ebp
+  8033f8:	89 e5                	mov    %esp,%ebp
+  8033fa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8033fd:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803402:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803408:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80340e:	8b 52 50             	mov    0x50(%edx),%edx
+  803411:	39 ca                	cmp    %ecx,%edx
+  803413:	74 11                	je     803426 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803415:	83 c0 01             	add    $0x1,%eax
+  803418:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80341d:	75 e3                	jne    803402 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80341f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803424:	eb 0e                	jmp    803434 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803426:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80342c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803431:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803434:	5d                   	pop    %ebp
+  803435:	c3                   	ret
+
+00803436 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803436:	55                   	push   %ebp
+  803437:	89 e5                	mov    %esp,%ebp
+  803439:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80343c:	89 c2                	mov    %eax,%edx
+  80343e:	c1 ea 16             	shr    $0x16,%edx
+  803441:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803448:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80344d:	f6 c1 01             	test   $0x1,%cl
+  803450:	74 22                	je     803474 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803452:	c1 e8 0c             	shr    $0xc,%eax
+  803455:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80345c:	a8 01                	test   $0x1,%al
+  80345e:	74 14                	je     803474 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803460:	c1 e8 0c             	shr    $0xc,%eax
+  803463:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803466:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80346d:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803471:	0f b7 d2             	movzwl %dx,%edx
+}
+  803474:	89 d0                	mov    %edx,%eax
+  803476:	5d                   	pop    %ebp
+  803477:	c3                   	ret
+
+00803478 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803478:	55                   	push   %ebp
+  803479:	89 e5                	mov    %esp,%ebp
+  80347b:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  80347e:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  803485:	74 0a                	je     803491 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803487:	8b 45 08             	mov    0x8(%ebp),%eax
+  80348a:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  80348f:	c9                   	leave
+  803490:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803491:	83 ec 04             	sub    $0x4,%esp
+  803494:	6a 07                	push   $0x7
+  803496:	68 00 f0 bf ee       	push   $0xeebff000
+  80349b:	6a 00                	push   $0x0
+  80349d:	e8 e7 cc ff ff       	call   800189 <sys_page_alloc>
+  8034a2:	83 c4 10             	add    $0x10,%esp
+  8034a5:	85 c0                	test   %eax,%eax
+  8034a7:	75 2c                	jne    8034d5 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8034a9:	83 ec 08             	sub    $0x8,%esp
+  8034ac:	68 eb 34 80 00       	push   $0x8034eb
+  8034b1:	6a 00                	push   $0x0
+  8034b3:	e8 3c ce ff ff       	call   8002f4 <sys_env_set_pgfault_upcall>
+  8034b8:	83 c4 10             	add    $0x10,%esp
+  8034bb:	85 c0                	test   %eax,%eax
+  8034bd:	74 c8                	je     803487 <set_pgfault_handler+0xf>
+  8034bf:	68 48 3d 80 00       	push   $0x803d48
+  8034c4:	68 48 38 80 00       	push   $0x803848
+  8034c9:	6a 20                	push   $0x20
+  8034cb:	68 78 3d 80 00       	push   $0x803d78
+  8034d0:	e8 70 f0 ff ff       	call   802545 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034d5:	68 00 3d 80 00       	push   $0x803d00
+  8034da:	68 48 38 80 00       	push   $0x803848
+  8034df:	6a 1e                	push   $0x1e
+  8034e1:	68 78 3d 80 00       	push   $0x803d78
+  8034e6:	e8 5a f0 ff ff       	call   802545 <_panic>
+
+008034eb <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8034eb:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8034ec:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  8034f1:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8034f3:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8034f6:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8034fb:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803500:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803504:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803507:	83 c4 08             	add    $0x8,%esp
+	popal
+  80350a:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  80350b:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80350e:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  80350f:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803510:	c3                   	ret
+
+00803511 <dm>:
+  803511:	55                   	push   %ebp
+  803512:	57                   	push   %edi
+  803513:	56                   	push   %esi
+  803514:	53                   	push   %ebx
+  803515:	83 ec 24             	sub    $0x24,%esp
+  803518:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80351c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803520:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803524:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803528:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80352c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803530:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803534:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803543:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80354a:	00 
+  80354b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803552:	00 
+  803553:	89 fb                	mov    %edi,%ebx
+  803555:	eb 08                	jmp    80355f <dm+0x4e>
+  803557:	83 e9 01             	sub    $0x1,%ecx
+  80355a:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80355d:	74 68                	je     8035c7 <dm+0xb6>
+  80355f:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803563:	01 c0                	add    %eax,%eax
+  803565:	89 c6                	mov    %eax,%esi
+  803567:	89 d7                	mov    %edx,%edi
+  803569:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80356d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803571:	0f ad d0             	shrd   %cl,%edx,%eax
+  803574:	d3 ea                	shr    %cl,%edx
+  803576:	f6 c1 20             	test   $0x20,%cl
+  803579:	74 04                	je     80357f <dm+0x6e>
+  80357b:	89 d0                	mov    %edx,%eax
+  80357d:	31 d2                	xor    %edx,%edx
+  80357f:	83 e0 01             	and    $0x1,%eax
+  803582:	89 04 24             	mov    %eax,(%esp)
+  803585:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80358c:	00 
+  80358d:	8b 04 24             	mov    (%esp),%eax
+  803590:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803594:	09 f0                	or     %esi,%eax
+  803596:	09 fa                	or     %edi,%edx
+  803598:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80359c:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8035a0:	39 f0                	cmp    %esi,%eax
+  8035a2:	89 d5                	mov    %edx,%ebp
+  8035a4:	19 fd                	sbb    %edi,%ebp
+  8035a6:	72 af                	jb     803557 <dm+0x46>
+  8035a8:	29 f0                	sub    %esi,%eax
+  8035aa:	19 fa                	sbb    %edi,%edx
+  8035ac:	89 cf                	mov    %ecx,%edi
+  8035ae:	c1 ef 05             	shr    $0x5,%edi
+  8035b1:	83 e7 01             	and    $0x1,%edi
+  8035b4:	89 fe                	mov    %edi,%esi
+  8035b6:	83 f6 01             	xor    $0x1,%esi
+  8035b9:	d3 e6                	shl    %cl,%esi
+  8035bb:	d3 e7                	shl    %cl,%edi
+  8035bd:	09 74 24 18          	or     %esi,0x18(%esp)
+  8035c1:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8035c5:	eb 90                	jmp    803557 <dm+0x46>
+  8035c7:	85 db                	test   %ebx,%ebx
+  8035c9:	74 05                	je     8035d0 <dm+0xbf>
+  8035cb:	89 03                	mov    %eax,(%ebx)
+  8035cd:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035d0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035d4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035d8:	83 c4 24             	add    $0x24,%esp
+  8035db:	5b                   	pop    %ebx
+  8035dc:	5e                   	pop    %esi
+  8035dd:	5f                   	pop    %edi
+  8035de:	5d                   	pop    %ebp
+  8035df:	c3                   	ret
+
+008035e0 <__udivdi3>:
+  8035e0:	83 ec 08             	sub    $0x8,%esp
+  8035e3:	6a 00                	push   $0x0
+  8035e5:	ff 74 24 1c          	push   0x1c(%esp)
+  8035e9:	ff 74 24 1c          	push   0x1c(%esp)
+  8035ed:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035f1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035f5:	e8 17 ff ff ff       	call   803511 <dm>
+  8035fa:	83 c4 14             	add    $0x14,%esp
+  8035fd:	c3                   	ret
+
+008035fe <__umoddi3>:
+  8035fe:	83 ec 18             	sub    $0x18,%esp
+  803601:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803605:	50                   	push   %eax
+  803606:	ff 74 24 2c          	push   0x2c(%esp)
+  80360a:	ff 74 24 2c          	push   0x2c(%esp)
+  80360e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803612:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803616:	e8 f6 fe ff ff       	call   803511 <dm>
+  80361b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80361f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803623:	83 c4 24             	add    $0x24,%esp
+  803626:	c3                   	ret
+
+00803627 <__divdi3>:
+  803627:	53                   	push   %ebx
+  803628:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80362c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803630:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803634:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803638:	85 d2                	test   %edx,%edx
+  80363a:	78 15                	js     803651 <__divdi3+0x2a>
+  80363c:	85 db                	test   %ebx,%ebx
+  80363e:	78 34                	js     803674 <__divdi3+0x4d>
+  803640:	83 ec 04             	sub    $0x4,%esp
+  803643:	6a 00                	push   $0x0
+  803645:	53                   	push   %ebx
+  803646:	51                   	push   %ecx
+  803647:	e8 c5 fe ff ff       	call   803511 <dm>
+  80364c:	83 c4 10             	add    $0x10,%esp
+  80364f:	eb 21                	jmp    803672 <__divdi3+0x4b>
+  803651:	f7 d8                	neg    %eax
+  803653:	83 d2 00             	adc    $0x0,%edx
+  803656:	f7 da                	neg    %edx
+  803658:	85 db                	test   %ebx,%ebx
+  80365a:	78 30                	js     80368c <__divdi3+0x65>
+  80365c:	83 ec 04             	sub    $0x4,%esp
+  80365f:	6a 00                	push   $0x0
+  803661:	53                   	push   %ebx
+  803662:	51                   	push   %ecx
+  803663:	e8 a9 fe ff ff       	call   803511 <dm>
+  803668:	83 c4 10             	add    $0x10,%esp
+  80366b:	f7 d8                	neg    %eax
+  80366d:	83 d2 00             	adc    $0x0,%edx
+  803670:	f7 da                	neg    %edx
+  803672:	5b                   	pop    %ebx
+  803673:	c3                   	ret
+  803674:	83 ec 04             	sub    $0x4,%esp
+  803677:	6a 00                	push   $0x0
+  803679:	f7 d9                	neg    %ecx
+  80367b:	83 d3 00             	adc    $0x0,%ebx
+  80367e:	f7 db                	neg    %ebx
+  803680:	53                   	push   %ebx
+  803681:	51                   	push   %ecx
+  803682:	e8 8a fe ff ff       	call   803511 <dm>
+  803687:	83 c4 10             	add    $0x10,%esp
+  80368a:	eb df                	jmp    80366b <__divdi3+0x44>
+  80368c:	83 ec 04             	sub    $0x4,%esp
+  80368f:	6a 00                	push   $0x0
+  803691:	f7 d9                	neg    %ecx
+  803693:	83 d3 00             	adc    $0x0,%ebx
+  803696:	f7 db                	neg    %ebx
+  803698:	53                   	push   %ebx
+  803699:	51                   	push   %ecx
+  80369a:	e8 72 fe ff ff       	call   803511 <dm>
+  80369f:	83 c4 10             	add    $0x10,%esp
+  8036a2:	eb ce                	jmp    803672 <__divdi3+0x4b>
+
+008036a4 <__moddi3>:
+  8036a4:	55                   	push   %ebp
+  8036a5:	57                   	push   %edi
+  8036a6:	56                   	push   %esi
+  8036a7:	53                   	push   %ebx
+  8036a8:	83 ec 24             	sub    $0x24,%esp
+  8036ab:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036af:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036b3:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036b7:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036bb:	85 d2                	test   %edx,%edx
+  8036bd:	78 3b                	js     8036fa <__moddi3+0x56>
+  8036bf:	83 ec 04             	sub    $0x4,%esp
+  8036c2:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036c6:	56                   	push   %esi
+  8036c7:	89 ce                	mov    %ecx,%esi
+  8036c9:	f7 de                	neg    %esi
+  8036cb:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8036cf:	89 de                	mov    %ebx,%esi
+  8036d1:	83 d6 00             	adc    $0x0,%esi
+  8036d4:	f7 de                	neg    %esi
+  8036d6:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8036da:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8036de:	0f 48 f1             	cmovs  %ecx,%esi
+  8036e1:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8036e6:	53                   	push   %ebx
+  8036e7:	56                   	push   %esi
+  8036e8:	e8 24 fe ff ff       	call   803511 <dm>
+  8036ed:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036f1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036f5:	83 c4 10             	add    $0x10,%esp
+  8036f8:	eb 47                	jmp    803741 <__moddi3+0x9d>
+  8036fa:	f7 d8                	neg    %eax
+  8036fc:	83 d2 00             	adc    $0x0,%edx
+  8036ff:	f7 da                	neg    %edx
+  803701:	83 ec 04             	sub    $0x4,%esp
+  803704:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803708:	56                   	push   %esi
+  803709:	89 cf                	mov    %ecx,%edi
+  80370b:	f7 df                	neg    %edi
+  80370d:	89 de                	mov    %ebx,%esi
+  80370f:	83 d6 00             	adc    $0x0,%esi
+  803712:	f7 de                	neg    %esi
+  803714:	0f 49 cf             	cmovns %edi,%ecx
+  803717:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80371b:	0f 49 de             	cmovns %esi,%ebx
+  80371e:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803722:	ff 74 24 0c          	push   0xc(%esp)
+  803726:	ff 74 24 0c          	push   0xc(%esp)
+  80372a:	e8 e2 fd ff ff       	call   803511 <dm>
+  80372f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803733:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803737:	f7 d8                	neg    %eax
+  803739:	83 d2 00             	adc    $0x0,%edx
+  80373c:	f7 da                	neg    %edx
+  80373e:	83 c4 10             	add    $0x10,%esp
+  803741:	83 c4 24             	add    $0x24,%esp
+  803744:	5b                   	pop    %ebx
+  803745:	5e                   	pop    %esi
+  803746:	5f                   	pop    %edi
+  803747:	5d                   	pop    %ebp
+  803748:	c3                   	ret
@@ -0,0 +1,8556 @@
+
+obj/user/init.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 5f 03 00 00       	call   800390 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <sum>:
+
+char bss[6000];
+
+int
+sum(const char *s, int n)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int i, tot = 0;
+  80003e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (i = 0; i < n; i++)
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	eb 0c                	jmp    800056 <sum+0x23>
+		tot ^= i * s[i];
+  80004a:	0f be 14 06          	movsbl (%esi,%eax,1),%edx
+  80004e:	0f af d0             	imul   %eax,%edx
+  800051:	31 d1                	xor    %edx,%ecx
+	for (i = 0; i < n; i++)
+  800053:	83 c0 01             	add    $0x1,%eax
+  800056:	39 d8                	cmp    %ebx,%eax
+  800058:	7c f0                	jl     80004a <sum+0x17>
+	return tot;
+}
+  80005a:	89 c8                	mov    %ecx,%eax
+  80005c:	5b                   	pop    %ebx
+  80005d:	5e                   	pop    %esi
+  80005e:	5d                   	pop    %ebp
+  80005f:	c3                   	ret
+
+00800060 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800060:	55                   	push   %ebp
+  800061:	89 e5                	mov    %esp,%ebp
+  800063:	57                   	push   %edi
+  800064:	56                   	push   %esi
+  800065:	53                   	push   %ebx
+  800066:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80006c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	int i, r, x, want;
+	char args[256];
+
+	cprintf("init: running\n");
+  80006f:	68 a0 40 80 00       	push   $0x8040a0
+  800074:	e8 55 04 00 00       	call   8004ce <cprintf>
+
+	want = 0xf989e;
+	if ((x = sum((char*)&data, sizeof data)) != want)
+  800079:	83 c4 08             	add    $0x8,%esp
+  80007c:	68 70 17 00 00       	push   $0x1770
+  800081:	68 00 50 80 00       	push   $0x805000
+  800086:	e8 a8 ff ff ff       	call   800033 <sum>
+  80008b:	83 c4 10             	add    $0x10,%esp
+  80008e:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  800093:	74 64                	je     8000f9 <umain+0x99>
+		cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  800095:	83 ec 04             	sub    $0x4,%esp
+  800098:	68 9e 98 0f 00       	push   $0xf989e
+  80009d:	50                   	push   %eax
+  80009e:	68 68 41 80 00       	push   $0x804168
+  8000a3:	e8 26 04 00 00       	call   8004ce <cprintf>
+  8000a8:	83 c4 10             	add    $0x10,%esp
+			x, want);
+	else
+		cprintf("init: data seems okay\n");
+	if ((x = sum(bss, sizeof bss)) != 0)
+  8000ab:	83 ec 08             	sub    $0x8,%esp
+  8000ae:	68 70 17 00 00       	push   $0x1770
+  8000b3:	68 00 70 80 00       	push   $0x807000
+  8000b8:	e8 76 ff ff ff       	call   800033 <sum>
+  8000bd:	83 c4 10             	add    $0x10,%esp
+  8000c0:	85 c0                	test   %eax,%eax
+  8000c2:	74 47                	je     80010b <umain+0xab>
+		cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8000c4:	83 ec 08             	sub    $0x8,%esp
+  8000c7:	50                   	push   %eax
+  8000c8:	68 a4 41 80 00       	push   $0x8041a4
+  8000cd:	e8 fc 03 00 00       	call   8004ce <cprintf>
+  8000d2:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("init: bss seems okay\n");
+
+	// output in one syscall per line to avoid output interleaving 
+	strcat(args, "init: args:");
+  8000d5:	83 ec 08             	sub    $0x8,%esp
+  8000d8:	68 dc 40 80 00       	push   $0x8040dc
+  8000dd:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8000e3:	50                   	push   %eax
+  8000e4:	e8 f7 09 00 00       	call   800ae0 <strcat>
+	for (i = 0; i < argc; i++) {
+  8000e9:	83 c4 10             	add    $0x10,%esp
+  8000ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+		strcat(args, " '");
+  8000f1:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+	for (i = 0; i < argc; i++) {
+  8000f7:	eb 55                	jmp    80014e <umain+0xee>
+		cprintf("init: data seems okay\n");
+  8000f9:	83 ec 0c             	sub    $0xc,%esp
+  8000fc:	68 af 40 80 00       	push   $0x8040af
+  800101:	e8 c8 03 00 00       	call   8004ce <cprintf>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	eb a0                	jmp    8000ab <umain+0x4b>
+		cprintf("init: bss seems okay\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 c6 40 80 00       	push   $0x8040c6
+  800113:	e8 b6 03 00 00       	call   8004ce <cprintf>
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	eb b8                	jmp    8000d5 <umain+0x75>
+		strcat(args, " '");
+  80011d:	83 ec 08             	sub    $0x8,%esp
+  800120:	68 e8 40 80 00       	push   $0x8040e8
+  800125:	56                   	push   %esi
+  800126:	e8 b5 09 00 00       	call   800ae0 <strcat>
+		strcat(args, argv[i]);
+  80012b:	83 c4 08             	add    $0x8,%esp
+  80012e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800131:	ff 34 98             	push   (%eax,%ebx,4)
+  800134:	56                   	push   %esi
+  800135:	e8 a6 09 00 00       	call   800ae0 <strcat>
+		strcat(args, "'");
+  80013a:	83 c4 08             	add    $0x8,%esp
+  80013d:	68 e9 40 80 00       	push   $0x8040e9
+  800142:	56                   	push   %esi
+  800143:	e8 98 09 00 00       	call   800ae0 <strcat>
+	for (i = 0; i < argc; i++) {
+  800148:	83 c3 01             	add    $0x1,%ebx
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	39 fb                	cmp    %edi,%ebx
+  800150:	7c cb                	jl     80011d <umain+0xbd>
+	}
+	cprintf("%s\n", args);
+  800152:	83 ec 08             	sub    $0x8,%esp
+  800155:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80015b:	50                   	push   %eax
+  80015c:	68 eb 40 80 00       	push   $0x8040eb
+  800161:	e8 68 03 00 00       	call   8004ce <cprintf>
+
+	cprintf("init: running sh\n");
+  800166:	c7 04 24 ef 40 80 00 	movl   $0x8040ef,(%esp)
+  80016d:	e8 5c 03 00 00       	call   8004ce <cprintf>
+
+	// being run directly from kernel, so no file descriptors open yet
+	close(0);
+  800172:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800179:	e8 f2 12 00 00       	call   801470 <close>
+	if ((r = opencons()) < 0)
+  80017e:	e8 bb 01 00 00       	call   80033e <opencons>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	85 c0                	test   %eax,%eax
+  800188:	78 14                	js     80019e <umain+0x13e>
+		panic("opencons: %e", r);
+	if (r != 0)
+  80018a:	74 24                	je     8001b0 <umain+0x150>
+		panic("first opencons used fd %d", r);
+  80018c:	50                   	push   %eax
+  80018d:	68 1a 41 80 00       	push   $0x80411a
+  800192:	6a 39                	push   $0x39
+  800194:	68 0e 41 80 00       	push   $0x80410e
+  800199:	e8 55 02 00 00       	call   8003f3 <_panic>
+		panic("opencons: %e", r);
+  80019e:	50                   	push   %eax
+  80019f:	68 01 41 80 00       	push   $0x804101
+  8001a4:	6a 37                	push   $0x37
+  8001a6:	68 0e 41 80 00       	push   $0x80410e
+  8001ab:	e8 43 02 00 00       	call   8003f3 <_panic>
+	if ((r = dup(0, 1)) < 0)
+  8001b0:	83 ec 08             	sub    $0x8,%esp
+  8001b3:	6a 01                	push   $0x1
+  8001b5:	6a 00                	push   $0x0
+  8001b7:	e8 06 13 00 00       	call   8014c2 <dup>
+  8001bc:	83 c4 10             	add    $0x10,%esp
+  8001bf:	85 c0                	test   %eax,%eax
+  8001c1:	79 23                	jns    8001e6 <umain+0x186>
+		panic("dup: %e", r);
+  8001c3:	50                   	push   %eax
+  8001c4:	68 34 41 80 00       	push   $0x804134
+  8001c9:	6a 3b                	push   $0x3b
+  8001cb:	68 0e 41 80 00       	push   $0x80410e
+  8001d0:	e8 1e 02 00 00       	call   8003f3 <_panic>
+	while (1) {
+		cprintf("init: starting sh\n");
+		r = spawnl("/sh", "sh", (char*)0);
+		if (r < 0) {
+			cprintf("init: spawn sh: %e\n", r);
+  8001d5:	83 ec 08             	sub    $0x8,%esp
+  8001d8:	50                   	push   %eax
+  8001d9:	68 53 41 80 00       	push   $0x804153
+  8001de:	e8 eb 02 00 00       	call   8004ce <cprintf>
+			continue;
+  8001e3:	83 c4 10             	add    $0x10,%esp
+		cprintf("init: starting sh\n");
+  8001e6:	83 ec 0c             	sub    $0xc,%esp
+  8001e9:	68 3c 41 80 00       	push   $0x80413c
+  8001ee:	e8 db 02 00 00       	call   8004ce <cprintf>
+		r = spawnl("/sh", "sh", (char*)0);
+  8001f3:	83 c4 0c             	add    $0xc,%esp
+  8001f6:	6a 00                	push   $0x0
+  8001f8:	68 50 41 80 00       	push   $0x804150
+  8001fd:	68 4f 41 80 00       	push   $0x80414f
+  800202:	e8 fa 2d 00 00       	call   803001 <spawnl>
+		if (r < 0) {
+  800207:	83 c4 10             	add    $0x10,%esp
+  80020a:	85 c0                	test   %eax,%eax
+  80020c:	78 c7                	js     8001d5 <umain+0x175>
+		}
+		wait(r);
+  80020e:	83 ec 0c             	sub    $0xc,%esp
+  800211:	50                   	push   %eax
+  800212:	e8 10 36 00 00       	call   803827 <wait>
+  800217:	83 c4 10             	add    $0x10,%esp
+  80021a:	eb ca                	jmp    8001e6 <umain+0x186>
+
+0080021c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80021c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800221:	c3                   	ret
+
+00800222 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  800228:	68 d3 41 80 00       	push   $0x8041d3
+  80022d:	ff 75 0c             	push   0xc(%ebp)
+  800230:	e8 87 08 00 00       	call   800abc <strcpy>
+	return 0;
+}
+  800235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <devcons_write>:
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	57                   	push   %edi
+  800240:	56                   	push   %esi
+  800241:	53                   	push   %ebx
+  800242:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  800248:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80024d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  800253:	eb 2e                	jmp    800283 <devcons_write+0x47>
+		m = n - tot;
+  800255:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800258:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80025a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80025f:	39 c3                	cmp    %eax,%ebx
+  800261:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  800264:	83 ec 04             	sub    $0x4,%esp
+  800267:	53                   	push   %ebx
+  800268:	89 f0                	mov    %esi,%eax
+  80026a:	03 45 0c             	add    0xc(%ebp),%eax
+  80026d:	50                   	push   %eax
+  80026e:	57                   	push   %edi
+  80026f:	e8 ce 09 00 00       	call   800c42 <memmove>
+		sys_cputs(buf, m);
+  800274:	83 c4 08             	add    $0x8,%esp
+  800277:	53                   	push   %ebx
+  800278:	57                   	push   %edi
+  800279:	e8 6e 0b 00 00       	call   800dec <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80027e:	01 de                	add    %ebx,%esi
+  800280:	83 c4 10             	add    $0x10,%esp
+  800283:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800286:	72 cd                	jb     800255 <devcons_write+0x19>
+}
+  800288:	89 f0                	mov    %esi,%eax
+  80028a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028d:	5b                   	pop    %ebx
+  80028e:	5e                   	pop    %esi
+  80028f:	5f                   	pop    %edi
+  800290:	5d                   	pop    %ebp
+  800291:	c3                   	ret
+
+00800292 <devcons_read>:
+{
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  800298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002a1:	75 07                	jne    8002aa <devcons_read+0x18>
+  8002a3:	eb 1f                	jmp    8002c4 <devcons_read+0x32>
+		sys_yield();
+  8002a5:	e8 ff 0b 00 00       	call   800ea9 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8002aa:	e8 63 0b 00 00       	call   800e12 <sys_cgetc>
+  8002af:	85 c0                	test   %eax,%eax
+  8002b1:	74 f2                	je     8002a5 <devcons_read+0x13>
+	if (c < 0)
+  8002b3:	78 0f                	js     8002c4 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8002b5:	83 f8 04             	cmp    $0x4,%eax
+  8002b8:	74 0c                	je     8002c6 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8002ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002bd:	88 02                	mov    %al,(%edx)
+	return 1;
+  8002bf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+		return 0;
+  8002c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cb:	eb f7                	jmp    8002c4 <devcons_read+0x32>
+
+008002cd <cputchar>:
+{
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8002d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8002d9:	6a 01                	push   $0x1
+  8002db:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8002de:	50                   	push   %eax
+  8002df:	e8 08 0b 00 00       	call   800dec <sys_cputs>
+}
+  8002e4:	83 c4 10             	add    $0x10,%esp
+  8002e7:	c9                   	leave
+  8002e8:	c3                   	ret
+
+008002e9 <getchar>:
+{
+  8002e9:	55                   	push   %ebp
+  8002ea:	89 e5                	mov    %esp,%ebp
+  8002ec:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8002ef:	6a 01                	push   $0x1
+  8002f1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	6a 00                	push   $0x0
+  8002f7:	e8 b0 12 00 00       	call   8015ac <read>
+	if (r < 0)
+  8002fc:	83 c4 10             	add    $0x10,%esp
+  8002ff:	85 c0                	test   %eax,%eax
+  800301:	78 06                	js     800309 <getchar+0x20>
+	if (r < 1)
+  800303:	74 06                	je     80030b <getchar+0x22>
+	return c;
+  800305:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  800309:	c9                   	leave
+  80030a:	c3                   	ret
+		return -E_EOF;
+  80030b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800310:	eb f7                	jmp    800309 <getchar+0x20>
+
+00800312 <iscons>:
+{
+  800312:	55                   	push   %ebp
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800318:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80031b:	50                   	push   %eax
+  80031c:	ff 75 08             	push   0x8(%ebp)
+  80031f:	e8 22 10 00 00       	call   801346 <fd_lookup>
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	85 c0                	test   %eax,%eax
+  800329:	78 11                	js     80033c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80032b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80032e:	8b 15 80 67 80 00    	mov    0x806780,%edx
+  800334:	39 10                	cmp    %edx,(%eax)
+  800336:	0f 94 c0             	sete   %al
+  800339:	0f b6 c0             	movzbl %al,%eax
+}
+  80033c:	c9                   	leave
+  80033d:	c3                   	ret
+
+0080033e <opencons>:
+{
+  80033e:	55                   	push   %ebp
+  80033f:	89 e5                	mov    %esp,%ebp
+  800341:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800344:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800347:	50                   	push   %eax
+  800348:	e8 a3 0f 00 00       	call   8012f0 <fd_alloc>
+  80034d:	83 c4 10             	add    $0x10,%esp
+  800350:	85 c0                	test   %eax,%eax
+  800352:	78 3a                	js     80038e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800354:	83 ec 04             	sub    $0x4,%esp
+  800357:	68 07 04 00 00       	push   $0x407
+  80035c:	ff 75 f4             	push   -0xc(%ebp)
+  80035f:	6a 00                	push   $0x0
+  800361:	e8 62 0b 00 00       	call   800ec8 <sys_page_alloc>
+  800366:	83 c4 10             	add    $0x10,%esp
+  800369:	85 c0                	test   %eax,%eax
+  80036b:	78 21                	js     80038e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80036d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800370:	8b 15 80 67 80 00    	mov    0x806780,%edx
+  800376:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800378:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80037b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800382:	83 ec 0c             	sub    $0xc,%esp
+  800385:	50                   	push   %eax
+  800386:	e8 3e 0f 00 00       	call   8012c9 <fd2num>
+  80038b:	83 c4 10             	add    $0x10,%esp
+}
+  80038e:	c9                   	leave
+  80038f:	c3                   	ret
+
+00800390 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	56                   	push   %esi
+  800394:	53                   	push   %ebx
+  800395:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800398:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80039b:	e8 e2 0a 00 00       	call   800e82 <sys_getenvid>
+  8003a0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003a5:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8003ab:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003b0:	a3 70 87 80 00       	mov    %eax,0x808770
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003b5:	85 db                	test   %ebx,%ebx
+  8003b7:	7e 07                	jle    8003c0 <libmain+0x30>
+		binaryname = argv[0];
+  8003b9:	8b 06                	mov    (%esi),%eax
+  8003bb:	a3 a0 67 80 00       	mov    %eax,0x8067a0
+
+	// call user main routine
+	umain(argc, argv);
+  8003c0:	83 ec 08             	sub    $0x8,%esp
+  8003c3:	56                   	push   %esi
+  8003c4:	53                   	push   %ebx
+  8003c5:	e8 96 fc ff ff       	call   800060 <umain>
+
+	// exit gracefully
+	exit();
+  8003ca:	e8 0a 00 00 00       	call   8003d9 <exit>
+}
+  8003cf:	83 c4 10             	add    $0x10,%esp
+  8003d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003d5:	5b                   	pop    %ebx
+  8003d6:	5e                   	pop    %esi
+  8003d7:	5d                   	pop    %ebp
+  8003d8:	c3                   	ret
+
+008003d9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003d9:	55                   	push   %ebp
+  8003da:	89 e5                	mov    %esp,%ebp
+  8003dc:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8003df:	e8 b9 10 00 00       	call   80149d <close_all>
+	sys_env_destroy(0);
+  8003e4:	83 ec 0c             	sub    $0xc,%esp
+  8003e7:	6a 00                	push   $0x0
+  8003e9:	e8 4b 0a 00 00       	call   800e39 <sys_env_destroy>
+}
+  8003ee:	83 c4 10             	add    $0x10,%esp
+  8003f1:	c9                   	leave
+  8003f2:	c3                   	ret
+
+008003f3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8003f3:	55                   	push   %ebp
+  8003f4:	89 e5                	mov    %esp,%ebp
+  8003f6:	56                   	push   %esi
+  8003f7:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8003f8:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003fb:	8b 35 a0 67 80 00    	mov    0x8067a0,%esi
+  800401:	e8 7c 0a 00 00       	call   800e82 <sys_getenvid>
+  800406:	83 ec 0c             	sub    $0xc,%esp
+  800409:	ff 75 0c             	push   0xc(%ebp)
+  80040c:	ff 75 08             	push   0x8(%ebp)
+  80040f:	56                   	push   %esi
+  800410:	50                   	push   %eax
+  800411:	68 ec 41 80 00       	push   $0x8041ec
+  800416:	e8 b3 00 00 00       	call   8004ce <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80041b:	83 c4 18             	add    $0x18,%esp
+  80041e:	53                   	push   %ebx
+  80041f:	ff 75 10             	push   0x10(%ebp)
+  800422:	e8 56 00 00 00       	call   80047d <vcprintf>
+	cprintf("\n");
+  800427:	c7 04 24 57 47 80 00 	movl   $0x804757,(%esp)
+  80042e:	e8 9b 00 00 00       	call   8004ce <cprintf>
+  800433:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800436:	cc                   	int3
+	while (1)
+  800437:	eb fd                	jmp    800436 <_panic+0x43>
+
+00800439 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800439:	55                   	push   %ebp
+  80043a:	89 e5                	mov    %esp,%ebp
+  80043c:	53                   	push   %ebx
+  80043d:	83 ec 04             	sub    $0x4,%esp
+  800440:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800443:	8b 13                	mov    (%ebx),%edx
+  800445:	8d 42 01             	lea    0x1(%edx),%eax
+  800448:	89 03                	mov    %eax,(%ebx)
+  80044a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80044d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800451:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800456:	74 09                	je     800461 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800458:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80045c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80045f:	c9                   	leave
+  800460:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800461:	83 ec 08             	sub    $0x8,%esp
+  800464:	68 ff 00 00 00       	push   $0xff
+  800469:	8d 43 08             	lea    0x8(%ebx),%eax
+  80046c:	50                   	push   %eax
+  80046d:	e8 7a 09 00 00       	call   800dec <sys_cputs>
+		b->idx = 0;
+  800472:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800478:	83 c4 10             	add    $0x10,%esp
+  80047b:	eb db                	jmp    800458 <putch+0x1f>
+
+0080047d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80047d:	55                   	push   %ebp
+  80047e:	89 e5                	mov    %esp,%ebp
+  800480:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800486:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80048d:	00 00 00 
+	b.cnt = 0;
+  800490:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800497:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80049a:	ff 75 0c             	push   0xc(%ebp)
+  80049d:	ff 75 08             	push   0x8(%ebp)
+  8004a0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004a6:	50                   	push   %eax
+  8004a7:	68 39 04 80 00       	push   $0x800439
+  8004ac:	e8 14 01 00 00       	call   8005c5 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004b1:	83 c4 08             	add    $0x8,%esp
+  8004b4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004ba:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004c0:	50                   	push   %eax
+  8004c1:	e8 26 09 00 00       	call   800dec <sys_cputs>
+
+	return b.cnt;
+}
+  8004c6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004cc:	c9                   	leave
+  8004cd:	c3                   	ret
+
+008004ce <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004ce:	55                   	push   %ebp
+  8004cf:	89 e5                	mov    %esp,%ebp
+  8004d1:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004d4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004d7:	50                   	push   %eax
+  8004d8:	ff 75 08             	push   0x8(%ebp)
+  8004db:	e8 9d ff ff ff       	call   80047d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8004e0:	c9                   	leave
+  8004e1:	c3                   	ret
+
+008004e2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004e2:	55                   	push   %ebp
+  8004e3:	89 e5                	mov    %esp,%ebp
+  8004e5:	57                   	push   %edi
+  8004e6:	56                   	push   %esi
+  8004e7:	53                   	push   %ebx
+  8004e8:	83 ec 1c             	sub    $0x1c,%esp
+  8004eb:	89 c7                	mov    %eax,%edi
+  8004ed:	89 d6                	mov    %edx,%esi
+  8004ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004f5:	89 d1                	mov    %edx,%ecx
+  8004f7:	89 c2                	mov    %eax,%edx
+  8004f9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004fc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004ff:	8b 45 10             	mov    0x10(%ebp),%eax
+  800502:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800505:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800508:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80050f:	39 c2                	cmp    %eax,%edx
+  800511:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800514:	72 3e                	jb     800554 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800516:	83 ec 0c             	sub    $0xc,%esp
+  800519:	ff 75 18             	push   0x18(%ebp)
+  80051c:	83 eb 01             	sub    $0x1,%ebx
+  80051f:	53                   	push   %ebx
+  800520:	50                   	push   %eax
+  800521:	83 ec 08             	sub    $0x8,%esp
+  800524:	ff 75 e4             	push   -0x1c(%ebp)
+  800527:	ff 75 e0             	push   -0x20(%ebp)
+  80052a:	ff 75 dc             	push   -0x24(%ebp)
+  80052d:	ff 75 d8             	push   -0x28(%ebp)
+  800530:	e8 e6 39 00 00       	call   803f1b <__udivdi3>
+  800535:	83 c4 18             	add    $0x18,%esp
+  800538:	52                   	push   %edx
+  800539:	50                   	push   %eax
+  80053a:	89 f2                	mov    %esi,%edx
+  80053c:	89 f8                	mov    %edi,%eax
+  80053e:	e8 9f ff ff ff       	call   8004e2 <printnum>
+  800543:	83 c4 20             	add    $0x20,%esp
+  800546:	eb 13                	jmp    80055b <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800548:	83 ec 08             	sub    $0x8,%esp
+  80054b:	56                   	push   %esi
+  80054c:	ff 75 18             	push   0x18(%ebp)
+  80054f:	ff d7                	call   *%edi
+  800551:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800554:	83 eb 01             	sub    $0x1,%ebx
+  800557:	85 db                	test   %ebx,%ebx
+  800559:	7f ed                	jg     800548 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80055b:	83 ec 08             	sub    $0x8,%esp
+  80055e:	56                   	push   %esi
+  80055f:	83 ec 04             	sub    $0x4,%esp
+  800562:	ff 75 e4             	push   -0x1c(%ebp)
+  800565:	ff 75 e0             	push   -0x20(%ebp)
+  800568:	ff 75 dc             	push   -0x24(%ebp)
+  80056b:	ff 75 d8             	push   -0x28(%ebp)
+  80056e:	e8 c6 39 00 00       	call   803f39 <__umoddi3>
+  800573:	83 c4 14             	add    $0x14,%esp
+  800576:	0f be 80 0f 42 80 00 	movsbl 0x80420f(%eax),%eax
+  80057d:	50                   	push   %eax
+  80057e:	ff d7                	call   *%edi
+}
+  800580:	83 c4 10             	add    $0x10,%esp
+  800583:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800586:	5b                   	pop    %ebx
+  800587:	5e                   	pop    %esi
+  800588:	5f                   	pop    %edi
+  800589:	5d                   	pop    %ebp
+  80058a:	c3                   	ret
+
+0080058b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80058b:	55                   	push   %ebp
+  80058c:	89 e5                	mov    %esp,%ebp
+  80058e:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800591:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800595:	8b 10                	mov    (%eax),%edx
+  800597:	3b 50 04             	cmp    0x4(%eax),%edx
+  80059a:	73 0a                	jae    8005a6 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80059c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80059f:	89 08                	mov    %ecx,(%eax)
+  8005a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005a4:	88 02                	mov    %al,(%edx)
+}
+  8005a6:	5d                   	pop    %ebp
+  8005a7:	c3                   	ret
+
+008005a8 <printfmt>:
+{
+  8005a8:	55                   	push   %ebp
+  8005a9:	89 e5                	mov    %esp,%ebp
+  8005ab:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005ae:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005b1:	50                   	push   %eax
+  8005b2:	ff 75 10             	push   0x10(%ebp)
+  8005b5:	ff 75 0c             	push   0xc(%ebp)
+  8005b8:	ff 75 08             	push   0x8(%ebp)
+  8005bb:	e8 05 00 00 00       	call   8005c5 <vprintfmt>
+}
+  8005c0:	83 c4 10             	add    $0x10,%esp
+  8005c3:	c9                   	leave
+  8005c4:	c3                   	ret
+
+008005c5 <vprintfmt>:
+{
+  8005c5:	55                   	push   %ebp
+  8005c6:	89 e5                	mov    %esp,%ebp
+  8005c8:	57                   	push   %edi
+  8005c9:	56                   	push   %esi
+  8005ca:	53                   	push   %ebx
+  8005cb:	83 ec 2c             	sub    $0x2c,%esp
+  8005ce:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005d1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8005d7:	eb 0a                	jmp    8005e3 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8005d9:	83 ec 08             	sub    $0x8,%esp
+  8005dc:	53                   	push   %ebx
+  8005dd:	50                   	push   %eax
+  8005de:	ff d6                	call   *%esi
+  8005e0:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005e3:	83 c7 01             	add    $0x1,%edi
+  8005e6:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8005ea:	83 f8 25             	cmp    $0x25,%eax
+  8005ed:	74 0c                	je     8005fb <vprintfmt+0x36>
+			if (ch == '\0')
+  8005ef:	85 c0                	test   %eax,%eax
+  8005f1:	75 e6                	jne    8005d9 <vprintfmt+0x14>
+}
+  8005f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005f6:	5b                   	pop    %ebx
+  8005f7:	5e                   	pop    %esi
+  8005f8:	5f                   	pop    %edi
+  8005f9:	5d                   	pop    %ebp
+  8005fa:	c3                   	ret
+		padc = ' ';
+  8005fb:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8005ff:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800606:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80060d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800614:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800619:	8d 47 01             	lea    0x1(%edi),%eax
+  80061c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80061f:	0f b6 17             	movzbl (%edi),%edx
+  800622:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800625:	3c 55                	cmp    $0x55,%al
+  800627:	0f 87 cf 03 00 00    	ja     8009fc <vprintfmt+0x437>
+  80062d:	0f b6 c0             	movzbl %al,%eax
+  800630:	ff 24 85 60 43 80 00 	jmp    *0x804360(,%eax,4)
+  800637:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80063a:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80063e:	eb d9                	jmp    800619 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800640:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800643:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800647:	eb d0                	jmp    800619 <vprintfmt+0x54>
+  800649:	0f b6 d2             	movzbl %dl,%edx
+  80064c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80064f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800654:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800657:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80065a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80065e:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800661:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800664:	83 f9 09             	cmp    $0x9,%ecx
+  800667:	77 55                	ja     8006be <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800669:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80066c:	eb e9                	jmp    800657 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	8b 00                	mov    (%eax),%eax
+  800673:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800676:	8b 45 14             	mov    0x14(%ebp),%eax
+  800679:	8d 40 04             	lea    0x4(%eax),%eax
+  80067c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80067f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800682:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800686:	79 91                	jns    800619 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800688:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80068b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80068e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800695:	eb 82                	jmp    800619 <vprintfmt+0x54>
+			if (width < 0)
+  800697:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80069a:	85 d2                	test   %edx,%edx
+  80069c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a1:	0f 49 c2             	cmovns %edx,%eax
+  8006a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006a7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006aa:	e9 6a ff ff ff       	jmp    800619 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006af:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8006b2:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006b9:	e9 5b ff ff ff       	jmp    800619 <vprintfmt+0x54>
+  8006be:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006c1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006c4:	eb bc                	jmp    800682 <vprintfmt+0xbd>
+			lflag++;
+  8006c6:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006cc:	e9 48 ff ff ff       	jmp    800619 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	8d 78 04             	lea    0x4(%eax),%edi
+  8006d7:	83 ec 08             	sub    $0x8,%esp
+  8006da:	53                   	push   %ebx
+  8006db:	ff 30                	push   (%eax)
+  8006dd:	ff d6                	call   *%esi
+			break;
+  8006df:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8006e2:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8006e5:	e9 b1 02 00 00       	jmp    80099b <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8006ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ed:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8006f0:	8b 10                	mov    (%eax),%edx
+  8006f2:	89 d0                	mov    %edx,%eax
+  8006f4:	f7 d8                	neg    %eax
+  8006f6:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006f9:	83 f8 11             	cmp    $0x11,%eax
+  8006fc:	7f 23                	jg     800721 <vprintfmt+0x15c>
+  8006fe:	8b 14 85 c0 44 80 00 	mov    0x8044c0(,%eax,4),%edx
+  800705:	85 d2                	test   %edx,%edx
+  800707:	74 18                	je     800721 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800709:	52                   	push   %edx
+  80070a:	68 12 46 80 00       	push   $0x804612
+  80070f:	53                   	push   %ebx
+  800710:	56                   	push   %esi
+  800711:	e8 92 fe ff ff       	call   8005a8 <printfmt>
+  800716:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800719:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80071c:	e9 7a 02 00 00       	jmp    80099b <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800721:	50                   	push   %eax
+  800722:	68 27 42 80 00       	push   $0x804227
+  800727:	53                   	push   %ebx
+  800728:	56                   	push   %esi
+  800729:	e8 7a fe ff ff       	call   8005a8 <printfmt>
+  80072e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800731:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800734:	e9 62 02 00 00       	jmp    80099b <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800739:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073c:	83 c0 04             	add    $0x4,%eax
+  80073f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800742:	8b 45 14             	mov    0x14(%ebp),%eax
+  800745:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800747:	85 c9                	test   %ecx,%ecx
+  800749:	b8 20 42 80 00       	mov    $0x804220,%eax
+  80074e:	0f 45 c1             	cmovne %ecx,%eax
+  800751:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800754:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800758:	7e 06                	jle    800760 <vprintfmt+0x19b>
+  80075a:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80075e:	75 0b                	jne    80076b <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800760:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800763:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800766:	89 75 08             	mov    %esi,0x8(%ebp)
+  800769:	eb 5c                	jmp    8007c7 <vprintfmt+0x202>
+  80076b:	83 ec 08             	sub    $0x8,%esp
+  80076e:	ff 75 d0             	push   -0x30(%ebp)
+  800771:	ff 75 cc             	push   -0x34(%ebp)
+  800774:	e8 20 03 00 00       	call   800a99 <strnlen>
+  800779:	89 c2                	mov    %eax,%edx
+  80077b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80077e:	29 d0                	sub    %edx,%eax
+  800780:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800783:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800787:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80078a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80078d:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80078f:	eb 0e                	jmp    80079f <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800791:	83 ec 08             	sub    $0x8,%esp
+  800794:	53                   	push   %ebx
+  800795:	57                   	push   %edi
+  800796:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800799:	83 ee 01             	sub    $0x1,%esi
+  80079c:	83 c4 10             	add    $0x10,%esp
+  80079f:	85 f6                	test   %esi,%esi
+  8007a1:	7f ee                	jg     800791 <vprintfmt+0x1cc>
+  8007a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007a9:	85 c0                	test   %eax,%eax
+  8007ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007b0:	0f 49 d0             	cmovns %eax,%edx
+  8007b3:	29 d0                	sub    %edx,%eax
+  8007b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007b8:	eb a6                	jmp    800760 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8007ba:	83 ec 08             	sub    $0x8,%esp
+  8007bd:	53                   	push   %ebx
+  8007be:	52                   	push   %edx
+  8007bf:	ff 55 08             	call   *0x8(%ebp)
+  8007c2:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007c5:	89 f1                	mov    %esi,%ecx
+  8007c7:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007ca:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007ce:	0f be d0             	movsbl %al,%edx
+  8007d1:	85 d2                	test   %edx,%edx
+  8007d3:	74 28                	je     8007fd <vprintfmt+0x238>
+  8007d5:	85 ff                	test   %edi,%edi
+  8007d7:	78 05                	js     8007de <vprintfmt+0x219>
+  8007d9:	83 ef 01             	sub    $0x1,%edi
+  8007dc:	78 30                	js     80080e <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007de:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007e2:	74 d6                	je     8007ba <vprintfmt+0x1f5>
+  8007e4:	0f be c0             	movsbl %al,%eax
+  8007e7:	83 e8 20             	sub    $0x20,%eax
+  8007ea:	83 f8 5e             	cmp    $0x5e,%eax
+  8007ed:	76 cb                	jbe    8007ba <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8007ef:	83 ec 08             	sub    $0x8,%esp
+  8007f2:	53                   	push   %ebx
+  8007f3:	6a 3f                	push   $0x3f
+  8007f5:	ff 55 08             	call   *0x8(%ebp)
+  8007f8:	83 c4 10             	add    $0x10,%esp
+  8007fb:	eb c8                	jmp    8007c5 <vprintfmt+0x200>
+  8007fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800800:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800803:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800806:	01 d0                	add    %edx,%eax
+  800808:	29 c8                	sub    %ecx,%eax
+  80080a:	89 c7                	mov    %eax,%edi
+  80080c:	eb 13                	jmp    800821 <vprintfmt+0x25c>
+  80080e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800811:	eb ed                	jmp    800800 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800813:	83 ec 08             	sub    $0x8,%esp
+  800816:	53                   	push   %ebx
+  800817:	6a 20                	push   $0x20
+  800819:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80081b:	83 ef 01             	sub    $0x1,%edi
+  80081e:	83 c4 10             	add    $0x10,%esp
+  800821:	85 ff                	test   %edi,%edi
+  800823:	7f ee                	jg     800813 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800825:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800828:	89 45 14             	mov    %eax,0x14(%ebp)
+  80082b:	e9 6b 01 00 00       	jmp    80099b <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800830:	83 f9 01             	cmp    $0x1,%ecx
+  800833:	7f 1f                	jg     800854 <vprintfmt+0x28f>
+	else if (lflag)
+  800835:	85 c9                	test   %ecx,%ecx
+  800837:	74 67                	je     8008a0 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800839:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083c:	8b 00                	mov    (%eax),%eax
+  80083e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800841:	89 c1                	mov    %eax,%ecx
+  800843:	c1 f9 1f             	sar    $0x1f,%ecx
+  800846:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800849:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084c:	8d 40 04             	lea    0x4(%eax),%eax
+  80084f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800852:	eb 17                	jmp    80086b <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800854:	8b 45 14             	mov    0x14(%ebp),%eax
+  800857:	8b 50 04             	mov    0x4(%eax),%edx
+  80085a:	8b 00                	mov    (%eax),%eax
+  80085c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80085f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800862:	8b 45 14             	mov    0x14(%ebp),%eax
+  800865:	8d 40 08             	lea    0x8(%eax),%eax
+  800868:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80086b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80086e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800871:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800876:	85 c9                	test   %ecx,%ecx
+  800878:	0f 89 03 01 00 00    	jns    800981 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80087e:	83 ec 08             	sub    $0x8,%esp
+  800881:	53                   	push   %ebx
+  800882:	6a 2d                	push   $0x2d
+  800884:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800886:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800889:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80088c:	f7 da                	neg    %edx
+  80088e:	83 d1 00             	adc    $0x0,%ecx
+  800891:	f7 d9                	neg    %ecx
+  800893:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800896:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80089b:	e9 e1 00 00 00       	jmp    800981 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8008a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a3:	8b 00                	mov    (%eax),%eax
+  8008a5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008a8:	89 c1                	mov    %eax,%ecx
+  8008aa:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008ad:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b9:	eb b0                	jmp    80086b <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8008bb:	83 f9 01             	cmp    $0x1,%ecx
+  8008be:	7f 1e                	jg     8008de <vprintfmt+0x319>
+	else if (lflag)
+  8008c0:	85 c9                	test   %ecx,%ecx
+  8008c2:	74 32                	je     8008f6 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8008c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c7:	8b 10                	mov    (%eax),%edx
+  8008c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8008d9:	e9 a3 00 00 00       	jmp    800981 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8008de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e1:	8b 10                	mov    (%eax),%edx
+  8008e3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008e6:	8d 40 08             	lea    0x8(%eax),%eax
+  8008e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008ec:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8008f1:	e9 8b 00 00 00       	jmp    800981 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f9:	8b 10                	mov    (%eax),%edx
+  8008fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800900:	8d 40 04             	lea    0x4(%eax),%eax
+  800903:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800906:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80090b:	eb 74                	jmp    800981 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80090d:	83 f9 01             	cmp    $0x1,%ecx
+  800910:	7f 1b                	jg     80092d <vprintfmt+0x368>
+	else if (lflag)
+  800912:	85 c9                	test   %ecx,%ecx
+  800914:	74 2c                	je     800942 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800916:	8b 45 14             	mov    0x14(%ebp),%eax
+  800919:	8b 10                	mov    (%eax),%edx
+  80091b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800920:	8d 40 04             	lea    0x4(%eax),%eax
+  800923:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800926:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80092b:	eb 54                	jmp    800981 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80092d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800930:	8b 10                	mov    (%eax),%edx
+  800932:	8b 48 04             	mov    0x4(%eax),%ecx
+  800935:	8d 40 08             	lea    0x8(%eax),%eax
+  800938:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80093b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800940:	eb 3f                	jmp    800981 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800942:	8b 45 14             	mov    0x14(%ebp),%eax
+  800945:	8b 10                	mov    (%eax),%edx
+  800947:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094c:	8d 40 04             	lea    0x4(%eax),%eax
+  80094f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800952:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800957:	eb 28                	jmp    800981 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800959:	83 ec 08             	sub    $0x8,%esp
+  80095c:	53                   	push   %ebx
+  80095d:	6a 30                	push   $0x30
+  80095f:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800961:	83 c4 08             	add    $0x8,%esp
+  800964:	53                   	push   %ebx
+  800965:	6a 78                	push   $0x78
+  800967:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800969:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096c:	8b 10                	mov    (%eax),%edx
+  80096e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800973:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800976:	8d 40 04             	lea    0x4(%eax),%eax
+  800979:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80097c:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800981:	83 ec 0c             	sub    $0xc,%esp
+  800984:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800988:	50                   	push   %eax
+  800989:	ff 75 e0             	push   -0x20(%ebp)
+  80098c:	57                   	push   %edi
+  80098d:	51                   	push   %ecx
+  80098e:	52                   	push   %edx
+  80098f:	89 da                	mov    %ebx,%edx
+  800991:	89 f0                	mov    %esi,%eax
+  800993:	e8 4a fb ff ff       	call   8004e2 <printnum>
+			break;
+  800998:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80099b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80099e:	e9 40 fc ff ff       	jmp    8005e3 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8009a3:	83 f9 01             	cmp    $0x1,%ecx
+  8009a6:	7f 1b                	jg     8009c3 <vprintfmt+0x3fe>
+	else if (lflag)
+  8009a8:	85 c9                	test   %ecx,%ecx
+  8009aa:	74 2c                	je     8009d8 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8009ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009af:	8b 10                	mov    (%eax),%edx
+  8009b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009bc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8009c1:	eb be                	jmp    800981 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c6:	8b 10                	mov    (%eax),%edx
+  8009c8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009cb:	8d 40 08             	lea    0x8(%eax),%eax
+  8009ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009d1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8009d6:	eb a9                	jmp    800981 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8009d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009db:	8b 10                	mov    (%eax),%edx
+  8009dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009e8:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8009ed:	eb 92                	jmp    800981 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8009ef:	83 ec 08             	sub    $0x8,%esp
+  8009f2:	53                   	push   %ebx
+  8009f3:	6a 25                	push   $0x25
+  8009f5:	ff d6                	call   *%esi
+			break;
+  8009f7:	83 c4 10             	add    $0x10,%esp
+  8009fa:	eb 9f                	jmp    80099b <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8009fc:	83 ec 08             	sub    $0x8,%esp
+  8009ff:	53                   	push   %ebx
+  800a00:	6a 25                	push   $0x25
+  800a02:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a04:	83 c4 10             	add    $0x10,%esp
+  800a07:	89 f8                	mov    %edi,%eax
+  800a09:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a0d:	74 05                	je     800a14 <vprintfmt+0x44f>
+  800a0f:	83 e8 01             	sub    $0x1,%eax
+  800a12:	eb f5                	jmp    800a09 <vprintfmt+0x444>
+  800a14:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a17:	eb 82                	jmp    80099b <vprintfmt+0x3d6>
+
+00800a19 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a19:	55                   	push   %ebp
+  800a1a:	89 e5                	mov    %esp,%ebp
+  800a1c:	83 ec 18             	sub    $0x18,%esp
+  800a1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a22:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a25:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a28:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a2c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a2f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a36:	85 c0                	test   %eax,%eax
+  800a38:	74 26                	je     800a60 <vsnprintf+0x47>
+  800a3a:	85 d2                	test   %edx,%edx
+  800a3c:	7e 22                	jle    800a60 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a3e:	ff 75 14             	push   0x14(%ebp)
+  800a41:	ff 75 10             	push   0x10(%ebp)
+  800a44:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a47:	50                   	push   %eax
+  800a48:	68 8b 05 80 00       	push   $0x80058b
+  800a4d:	e8 73 fb ff ff       	call   8005c5 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a52:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a55:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a5b:	83 c4 10             	add    $0x10,%esp
+}
+  800a5e:	c9                   	leave
+  800a5f:	c3                   	ret
+		return -E_INVAL;
+  800a60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a65:	eb f7                	jmp    800a5e <vsnprintf+0x45>
+
+00800a67 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a67:	55                   	push   %ebp
+  800a68:	89 e5                	mov    %esp,%ebp
+  800a6a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a6d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a70:	50                   	push   %eax
+  800a71:	ff 75 10             	push   0x10(%ebp)
+  800a74:	ff 75 0c             	push   0xc(%ebp)
+  800a77:	ff 75 08             	push   0x8(%ebp)
+  800a7a:	e8 9a ff ff ff       	call   800a19 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a7f:	c9                   	leave
+  800a80:	c3                   	ret
+
+00800a81 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a81:	55                   	push   %ebp
+  800a82:	89 e5                	mov    %esp,%ebp
+  800a84:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8c:	eb 03                	jmp    800a91 <strlen+0x10>
+		n++;
+  800a8e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a91:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a95:	75 f7                	jne    800a8e <strlen+0xd>
+	return n;
+}
+  800a97:	5d                   	pop    %ebp
+  800a98:	c3                   	ret
+
+00800a99 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a99:	55                   	push   %ebp
+  800a9a:	89 e5                	mov    %esp,%ebp
+  800a9c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a9f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa7:	eb 03                	jmp    800aac <strnlen+0x13>
+		n++;
+  800aa9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800aac:	39 d0                	cmp    %edx,%eax
+  800aae:	74 08                	je     800ab8 <strnlen+0x1f>
+  800ab0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ab4:	75 f3                	jne    800aa9 <strnlen+0x10>
+  800ab6:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800ab8:	89 d0                	mov    %edx,%eax
+  800aba:	5d                   	pop    %ebp
+  800abb:	c3                   	ret
+
+00800abc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800abc:	55                   	push   %ebp
+  800abd:	89 e5                	mov    %esp,%ebp
+  800abf:	53                   	push   %ebx
+  800ac0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ac3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800acf:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800ad2:	83 c0 01             	add    $0x1,%eax
+  800ad5:	84 d2                	test   %dl,%dl
+  800ad7:	75 f2                	jne    800acb <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800ad9:	89 c8                	mov    %ecx,%eax
+  800adb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ade:	c9                   	leave
+  800adf:	c3                   	ret
+
+00800ae0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ae0:	55                   	push   %ebp
+  800ae1:	89 e5                	mov    %esp,%ebp
+  800ae3:	53                   	push   %ebx
+  800ae4:	83 ec 10             	sub    $0x10,%esp
+  800ae7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800aea:	53                   	push   %ebx
+  800aeb:	e8 91 ff ff ff       	call   800a81 <strlen>
+  800af0:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800af3:	ff 75 0c             	push   0xc(%ebp)
+  800af6:	01 d8                	add    %ebx,%eax
+  800af8:	50                   	push   %eax
+  800af9:	e8 be ff ff ff       	call   800abc <strcpy>
+	return dst;
+}
+  800afe:	89 d8                	mov    %ebx,%eax
+  800b00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b03:	c9                   	leave
+  800b04:	c3                   	ret
+
+00800b05 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b05:	55                   	push   %ebp
+  800b06:	89 e5                	mov    %esp,%ebp
+  800b08:	56                   	push   %esi
+  800b09:	53                   	push   %ebx
+  800b0a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b10:	89 f3                	mov    %esi,%ebx
+  800b12:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b15:	89 f0                	mov    %esi,%eax
+  800b17:	eb 0f                	jmp    800b28 <strncpy+0x23>
+		*dst++ = *src;
+  800b19:	83 c0 01             	add    $0x1,%eax
+  800b1c:	0f b6 0a             	movzbl (%edx),%ecx
+  800b1f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b22:	80 f9 01             	cmp    $0x1,%cl
+  800b25:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b28:	39 d8                	cmp    %ebx,%eax
+  800b2a:	75 ed                	jne    800b19 <strncpy+0x14>
+	}
+	return ret;
+}
+  800b2c:	89 f0                	mov    %esi,%eax
+  800b2e:	5b                   	pop    %ebx
+  800b2f:	5e                   	pop    %esi
+  800b30:	5d                   	pop    %ebp
+  800b31:	c3                   	ret
+
+00800b32 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b32:	55                   	push   %ebp
+  800b33:	89 e5                	mov    %esp,%ebp
+  800b35:	56                   	push   %esi
+  800b36:	53                   	push   %ebx
+  800b37:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b3d:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b40:	89 f0                	mov    %esi,%eax
+  800b42:	85 d2                	test   %edx,%edx
+  800b44:	74 21                	je     800b67 <strlcpy+0x35>
+  800b46:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b4a:	89 f2                	mov    %esi,%edx
+  800b4c:	eb 09                	jmp    800b57 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b4e:	83 c1 01             	add    $0x1,%ecx
+  800b51:	83 c2 01             	add    $0x1,%edx
+  800b54:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b57:	39 c2                	cmp    %eax,%edx
+  800b59:	74 09                	je     800b64 <strlcpy+0x32>
+  800b5b:	0f b6 19             	movzbl (%ecx),%ebx
+  800b5e:	84 db                	test   %bl,%bl
+  800b60:	75 ec                	jne    800b4e <strlcpy+0x1c>
+  800b62:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b64:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b67:	29 f0                	sub    %esi,%eax
+}
+  800b69:	5b                   	pop    %ebx
+  800b6a:	5e                   	pop    %esi
+  800b6b:	5d                   	pop    %ebp
+  800b6c:	c3                   	ret
+
+00800b6d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b73:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b76:	eb 06                	jmp    800b7e <strcmp+0x11>
+		p++, q++;
+  800b78:	83 c1 01             	add    $0x1,%ecx
+  800b7b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b7e:	0f b6 01             	movzbl (%ecx),%eax
+  800b81:	84 c0                	test   %al,%al
+  800b83:	74 04                	je     800b89 <strcmp+0x1c>
+  800b85:	3a 02                	cmp    (%edx),%al
+  800b87:	74 ef                	je     800b78 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b89:	0f b6 c0             	movzbl %al,%eax
+  800b8c:	0f b6 12             	movzbl (%edx),%edx
+  800b8f:	29 d0                	sub    %edx,%eax
+}
+  800b91:	5d                   	pop    %ebp
+  800b92:	c3                   	ret
+
+00800b93 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b93:	55                   	push   %ebp
+  800b94:	89 e5                	mov    %esp,%ebp
+  800b96:	53                   	push   %ebx
+  800b97:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b9d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800ba0:	eb 09                	jmp    800bab <strncmp+0x18>
+		n--, p++, q++;
+  800ba2:	83 ea 01             	sub    $0x1,%edx
+  800ba5:	83 c0 01             	add    $0x1,%eax
+  800ba8:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800bab:	85 d2                	test   %edx,%edx
+  800bad:	74 18                	je     800bc7 <strncmp+0x34>
+  800baf:	0f b6 18             	movzbl (%eax),%ebx
+  800bb2:	84 db                	test   %bl,%bl
+  800bb4:	74 04                	je     800bba <strncmp+0x27>
+  800bb6:	3a 19                	cmp    (%ecx),%bl
+  800bb8:	74 e8                	je     800ba2 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bba:	0f b6 00             	movzbl (%eax),%eax
+  800bbd:	0f b6 11             	movzbl (%ecx),%edx
+  800bc0:	29 d0                	sub    %edx,%eax
+}
+  800bc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bc5:	c9                   	leave
+  800bc6:	c3                   	ret
+		return 0;
+  800bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bcc:	eb f4                	jmp    800bc2 <strncmp+0x2f>
+
+00800bce <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bd8:	eb 03                	jmp    800bdd <strchr+0xf>
+  800bda:	83 c0 01             	add    $0x1,%eax
+  800bdd:	0f b6 10             	movzbl (%eax),%edx
+  800be0:	84 d2                	test   %dl,%dl
+  800be2:	74 06                	je     800bea <strchr+0x1c>
+		if (*s == c)
+  800be4:	38 ca                	cmp    %cl,%dl
+  800be6:	75 f2                	jne    800bda <strchr+0xc>
+  800be8:	eb 05                	jmp    800bef <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800bea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bef:	5d                   	pop    %ebp
+  800bf0:	c3                   	ret
+
+00800bf1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bf1:	55                   	push   %ebp
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bfb:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bfe:	38 ca                	cmp    %cl,%dl
+  800c00:	74 09                	je     800c0b <strfind+0x1a>
+  800c02:	84 d2                	test   %dl,%dl
+  800c04:	74 05                	je     800c0b <strfind+0x1a>
+	for (; *s; s++)
+  800c06:	83 c0 01             	add    $0x1,%eax
+  800c09:	eb f0                	jmp    800bfb <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c0b:	5d                   	pop    %ebp
+  800c0c:	c3                   	ret
+
+00800c0d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c0d:	55                   	push   %ebp
+  800c0e:	89 e5                	mov    %esp,%ebp
+  800c10:	57                   	push   %edi
+  800c11:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c14:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c17:	85 c9                	test   %ecx,%ecx
+  800c19:	74 20                	je     800c3b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c1b:	89 f8                	mov    %edi,%eax
+  800c1d:	09 c8                	or     %ecx,%eax
+  800c1f:	a8 03                	test   $0x3,%al
+  800c21:	75 12                	jne    800c35 <memset+0x28>
+		c &= 0xFF;
+  800c23:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c27:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c2d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c30:	fc                   	cld
+  800c31:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c33:	eb 06                	jmp    800c3b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c35:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c38:	fc                   	cld
+  800c39:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c3b:	89 f8                	mov    %edi,%eax
+  800c3d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c40:	c9                   	leave
+  800c41:	c3                   	ret
+
+00800c42 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c42:	55                   	push   %ebp
+  800c43:	89 e5                	mov    %esp,%ebp
+  800c45:	57                   	push   %edi
+  800c46:	56                   	push   %esi
+  800c47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c4a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c4d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c50:	39 c6                	cmp    %eax,%esi
+  800c52:	73 32                	jae    800c86 <memmove+0x44>
+  800c54:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c57:	39 d0                	cmp    %edx,%eax
+  800c59:	73 2b                	jae    800c86 <memmove+0x44>
+		s += n;
+		d += n;
+  800c5b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c5e:	89 d6                	mov    %edx,%esi
+  800c60:	09 fe                	or     %edi,%esi
+  800c62:	09 ce                	or     %ecx,%esi
+  800c64:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c6a:	75 0e                	jne    800c7a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c6c:	83 ef 04             	sub    $0x4,%edi
+  800c6f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c72:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c75:	fd                   	std
+  800c76:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c78:	eb 09                	jmp    800c83 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c7a:	83 ef 01             	sub    $0x1,%edi
+  800c7d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c80:	fd                   	std
+  800c81:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c83:	fc                   	cld
+  800c84:	eb 1a                	jmp    800ca0 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c86:	89 f2                	mov    %esi,%edx
+  800c88:	09 c2                	or     %eax,%edx
+  800c8a:	09 ca                	or     %ecx,%edx
+  800c8c:	f6 c2 03             	test   $0x3,%dl
+  800c8f:	75 0a                	jne    800c9b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c91:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c94:	89 c7                	mov    %eax,%edi
+  800c96:	fc                   	cld
+  800c97:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c99:	eb 05                	jmp    800ca0 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c9b:	89 c7                	mov    %eax,%edi
+  800c9d:	fc                   	cld
+  800c9e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ca0:	5e                   	pop    %esi
+  800ca1:	5f                   	pop    %edi
+  800ca2:	5d                   	pop    %ebp
+  800ca3:	c3                   	ret
+
+00800ca4 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ca4:	55                   	push   %ebp
+  800ca5:	89 e5                	mov    %esp,%ebp
+  800ca7:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800caa:	ff 75 10             	push   0x10(%ebp)
+  800cad:	ff 75 0c             	push   0xc(%ebp)
+  800cb0:	ff 75 08             	push   0x8(%ebp)
+  800cb3:	e8 8a ff ff ff       	call   800c42 <memmove>
+}
+  800cb8:	c9                   	leave
+  800cb9:	c3                   	ret
+
+00800cba <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800cba:	55                   	push   %ebp
+  800cbb:	89 e5                	mov    %esp,%ebp
+  800cbd:	56                   	push   %esi
+  800cbe:	53                   	push   %ebx
+  800cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800cc5:	89 c6                	mov    %eax,%esi
+  800cc7:	03 75 10             	add    0x10(%ebp),%esi
+  800cca:	eb 06                	jmp    800cd2 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ccc:	83 c0 01             	add    $0x1,%eax
+  800ccf:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800cd2:	39 f0                	cmp    %esi,%eax
+  800cd4:	74 14                	je     800cea <memcmp+0x30>
+		if (*s1 != *s2)
+  800cd6:	0f b6 08             	movzbl (%eax),%ecx
+  800cd9:	0f b6 1a             	movzbl (%edx),%ebx
+  800cdc:	38 d9                	cmp    %bl,%cl
+  800cde:	74 ec                	je     800ccc <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ce0:	0f b6 c1             	movzbl %cl,%eax
+  800ce3:	0f b6 db             	movzbl %bl,%ebx
+  800ce6:	29 d8                	sub    %ebx,%eax
+  800ce8:	eb 05                	jmp    800cef <memcmp+0x35>
+	}
+
+	return 0;
+  800cea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cef:	5b                   	pop    %ebx
+  800cf0:	5e                   	pop    %esi
+  800cf1:	5d                   	pop    %ebp
+  800cf2:	c3                   	ret
+
+00800cf3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cf3:	55                   	push   %ebp
+  800cf4:	89 e5                	mov    %esp,%ebp
+  800cf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cfc:	89 c2                	mov    %eax,%edx
+  800cfe:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800d01:	eb 03                	jmp    800d06 <memfind+0x13>
+  800d03:	83 c0 01             	add    $0x1,%eax
+  800d06:	39 d0                	cmp    %edx,%eax
+  800d08:	73 04                	jae    800d0e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d0a:	38 08                	cmp    %cl,(%eax)
+  800d0c:	75 f5                	jne    800d03 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d0e:	5d                   	pop    %ebp
+  800d0f:	c3                   	ret
+
+00800d10 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d10:	55                   	push   %ebp
+  800d11:	89 e5                	mov    %esp,%ebp
+  800d13:	57                   	push   %edi
+  800d14:	56                   	push   %esi
+  800d15:	53                   	push   %ebx
+  800d16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d19:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d1c:	eb 03                	jmp    800d21 <strtol+0x11>
+		s++;
+  800d1e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d21:	0f b6 02             	movzbl (%edx),%eax
+  800d24:	3c 20                	cmp    $0x20,%al
+  800d26:	74 f6                	je     800d1e <strtol+0xe>
+  800d28:	3c 09                	cmp    $0x9,%al
+  800d2a:	74 f2                	je     800d1e <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d2c:	3c 2b                	cmp    $0x2b,%al
+  800d2e:	74 2a                	je     800d5a <strtol+0x4a>
+	int neg = 0;
+  800d30:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d35:	3c 2d                	cmp    $0x2d,%al
+  800d37:	74 2b                	je     800d64 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d39:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d3f:	75 0f                	jne    800d50 <strtol+0x40>
+  800d41:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d44:	74 28                	je     800d6e <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d46:	85 db                	test   %ebx,%ebx
+  800d48:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d4d:	0f 44 d8             	cmove  %eax,%ebx
+  800d50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d55:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d58:	eb 46                	jmp    800da0 <strtol+0x90>
+		s++;
+  800d5a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d62:	eb d5                	jmp    800d39 <strtol+0x29>
+		s++, neg = 1;
+  800d64:	83 c2 01             	add    $0x1,%edx
+  800d67:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d6c:	eb cb                	jmp    800d39 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d6e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d72:	74 0e                	je     800d82 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d74:	85 db                	test   %ebx,%ebx
+  800d76:	75 d8                	jne    800d50 <strtol+0x40>
+		s++, base = 8;
+  800d78:	83 c2 01             	add    $0x1,%edx
+  800d7b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d80:	eb ce                	jmp    800d50 <strtol+0x40>
+		s += 2, base = 16;
+  800d82:	83 c2 02             	add    $0x2,%edx
+  800d85:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d8a:	eb c4                	jmp    800d50 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d8c:	0f be c0             	movsbl %al,%eax
+  800d8f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d92:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d95:	7d 3a                	jge    800dd1 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d97:	83 c2 01             	add    $0x1,%edx
+  800d9a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d9e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800da0:	0f b6 02             	movzbl (%edx),%eax
+  800da3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800da6:	89 f3                	mov    %esi,%ebx
+  800da8:	80 fb 09             	cmp    $0x9,%bl
+  800dab:	76 df                	jbe    800d8c <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800dad:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800db0:	89 f3                	mov    %esi,%ebx
+  800db2:	80 fb 19             	cmp    $0x19,%bl
+  800db5:	77 08                	ja     800dbf <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800db7:	0f be c0             	movsbl %al,%eax
+  800dba:	83 e8 57             	sub    $0x57,%eax
+  800dbd:	eb d3                	jmp    800d92 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800dbf:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800dc2:	89 f3                	mov    %esi,%ebx
+  800dc4:	80 fb 19             	cmp    $0x19,%bl
+  800dc7:	77 08                	ja     800dd1 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800dc9:	0f be c0             	movsbl %al,%eax
+  800dcc:	83 e8 37             	sub    $0x37,%eax
+  800dcf:	eb c1                	jmp    800d92 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dd1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dd5:	74 05                	je     800ddc <strtol+0xcc>
+		*endptr = (char *) s;
+  800dd7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dda:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ddc:	89 c8                	mov    %ecx,%eax
+  800dde:	f7 d8                	neg    %eax
+  800de0:	85 ff                	test   %edi,%edi
+  800de2:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800de5:	89 c8                	mov    %ecx,%eax
+  800de7:	5b                   	pop    %ebx
+  800de8:	5e                   	pop    %esi
+  800de9:	5f                   	pop    %edi
+  800dea:	5d                   	pop    %ebp
+  800deb:	c3                   	ret
+
+00800dec <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	57                   	push   %edi
+  800df0:	56                   	push   %esi
+  800df1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800df2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfd:	89 c3                	mov    %eax,%ebx
+  800dff:	89 c7                	mov    %eax,%edi
+  800e01:	55                   	push   %ebp
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	8d 35 0c 0e 80 00    	lea    0x800e0c,%esi
+  800e0a:	0f 34                	sysenter
+  800e0c:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800e0d:	5b                   	pop    %ebx
+  800e0e:	5e                   	pop    %esi
+  800e0f:	5f                   	pop    %edi
+  800e10:	5d                   	pop    %ebp
+  800e11:	c3                   	ret
+
+00800e12 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e12:	55                   	push   %ebp
+  800e13:	89 e5                	mov    %esp,%ebp
+  800e15:	57                   	push   %edi
+  800e16:	56                   	push   %esi
+  800e17:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e18:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e22:	89 d1                	mov    %edx,%ecx
+  800e24:	89 d3                	mov    %edx,%ebx
+  800e26:	89 d7                	mov    %edx,%edi
+  800e28:	55                   	push   %ebp
+  800e29:	89 e5                	mov    %esp,%ebp
+  800e2b:	8d 35 33 0e 80 00    	lea    0x800e33,%esi
+  800e31:	0f 34                	sysenter
+  800e33:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800e34:	5b                   	pop    %ebx
+  800e35:	5e                   	pop    %esi
+  800e36:	5f                   	pop    %edi
+  800e37:	5d                   	pop    %ebp
+  800e38:	c3                   	ret
+
+00800e39 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e39:	55                   	push   %ebp
+  800e3a:	89 e5                	mov    %esp,%ebp
+  800e3c:	57                   	push   %edi
+  800e3d:	56                   	push   %esi
+  800e3e:	53                   	push   %ebx
+  800e3f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e42:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e4f:	89 cb                	mov    %ecx,%ebx
+  800e51:	89 cf                	mov    %ecx,%edi
+  800e53:	55                   	push   %ebp
+  800e54:	89 e5                	mov    %esp,%ebp
+  800e56:	8d 35 5e 0e 80 00    	lea    0x800e5e,%esi
+  800e5c:	0f 34                	sysenter
+  800e5e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e5f:	85 c0                	test   %eax,%eax
+  800e61:	7f 08                	jg     800e6b <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800e63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e66:	5b                   	pop    %ebx
+  800e67:	5e                   	pop    %esi
+  800e68:	5f                   	pop    %edi
+  800e69:	5d                   	pop    %ebp
+  800e6a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e6b:	83 ec 0c             	sub    $0xc,%esp
+  800e6e:	50                   	push   %eax
+  800e6f:	6a 03                	push   $0x3
+  800e71:	68 27 45 80 00       	push   $0x804527
+  800e76:	6a 3d                	push   $0x3d
+  800e78:	68 44 45 80 00       	push   $0x804544
+  800e7d:	e8 71 f5 ff ff       	call   8003f3 <_panic>
+
+00800e82 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	57                   	push   %edi
+  800e86:	56                   	push   %esi
+  800e87:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e88:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e8d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e92:	89 d1                	mov    %edx,%ecx
+  800e94:	89 d3                	mov    %edx,%ebx
+  800e96:	89 d7                	mov    %edx,%edi
+  800e98:	55                   	push   %ebp
+  800e99:	89 e5                	mov    %esp,%ebp
+  800e9b:	8d 35 a3 0e 80 00    	lea    0x800ea3,%esi
+  800ea1:	0f 34                	sysenter
+  800ea3:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800ea4:	5b                   	pop    %ebx
+  800ea5:	5e                   	pop    %esi
+  800ea6:	5f                   	pop    %edi
+  800ea7:	5d                   	pop    %ebp
+  800ea8:	c3                   	ret
+
+00800ea9 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ea9:	55                   	push   %ebp
+  800eaa:	89 e5                	mov    %esp,%ebp
+  800eac:	57                   	push   %edi
+  800ead:	56                   	push   %esi
+  800eae:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eaf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800eb9:	89 d1                	mov    %edx,%ecx
+  800ebb:	89 d3                	mov    %edx,%ebx
+  800ebd:	89 d7                	mov    %edx,%edi
+  800ebf:	89 d6                	mov    %edx,%esi
+  800ec1:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ec3:	5b                   	pop    %ebx
+  800ec4:	5e                   	pop    %esi
+  800ec5:	5f                   	pop    %edi
+  800ec6:	5d                   	pop    %ebp
+  800ec7:	c3                   	ret
+
+00800ec8 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ec8:	55                   	push   %ebp
+  800ec9:	89 e5                	mov    %esp,%ebp
+  800ecb:	57                   	push   %edi
+  800ecc:	56                   	push   %esi
+  800ecd:	53                   	push   %ebx
+  800ece:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ed1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed7:	b8 04 00 00 00       	mov    $0x4,%eax
+  800edc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ee1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ee4:	55                   	push   %ebp
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	8d 35 ef 0e 80 00    	lea    0x800eef,%esi
+  800eed:	0f 34                	sysenter
+  800eef:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ef0:	85 c0                	test   %eax,%eax
+  800ef2:	7f 08                	jg     800efc <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efc:	83 ec 0c             	sub    $0xc,%esp
+  800eff:	50                   	push   %eax
+  800f00:	6a 04                	push   $0x4
+  800f02:	68 27 45 80 00       	push   $0x804527
+  800f07:	6a 3d                	push   $0x3d
+  800f09:	68 44 45 80 00       	push   $0x804544
+  800f0e:	e8 e0 f4 ff ff       	call   8003f3 <_panic>
+
+00800f13 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	56                   	push   %esi
+  800f18:	53                   	push   %ebx
+  800f19:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f22:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f2d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f30:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f32:	85 c0                	test   %eax,%eax
+  800f34:	7f 08                	jg     800f3e <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f39:	5b                   	pop    %ebx
+  800f3a:	5e                   	pop    %esi
+  800f3b:	5f                   	pop    %edi
+  800f3c:	5d                   	pop    %ebp
+  800f3d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f3e:	83 ec 0c             	sub    $0xc,%esp
+  800f41:	50                   	push   %eax
+  800f42:	6a 05                	push   $0x5
+  800f44:	68 27 45 80 00       	push   $0x804527
+  800f49:	6a 23                	push   $0x23
+  800f4b:	68 44 45 80 00       	push   $0x804544
+  800f50:	e8 9e f4 ff ff       	call   8003f3 <_panic>
+
+00800f55 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f55:	55                   	push   %ebp
+  800f56:	89 e5                	mov    %esp,%ebp
+  800f58:	57                   	push   %edi
+  800f59:	56                   	push   %esi
+  800f5a:	53                   	push   %ebx
+  800f5b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f69:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f6e:	89 df                	mov    %ebx,%edi
+  800f70:	55                   	push   %ebp
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	8d 35 7b 0f 80 00    	lea    0x800f7b,%esi
+  800f79:	0f 34                	sysenter
+  800f7b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f7c:	85 c0                	test   %eax,%eax
+  800f7e:	7f 08                	jg     800f88 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800f80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f83:	5b                   	pop    %ebx
+  800f84:	5e                   	pop    %esi
+  800f85:	5f                   	pop    %edi
+  800f86:	5d                   	pop    %ebp
+  800f87:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f88:	83 ec 0c             	sub    $0xc,%esp
+  800f8b:	50                   	push   %eax
+  800f8c:	6a 06                	push   $0x6
+  800f8e:	68 27 45 80 00       	push   $0x804527
+  800f93:	6a 3d                	push   $0x3d
+  800f95:	68 44 45 80 00       	push   $0x804544
+  800f9a:	e8 54 f4 ff ff       	call   8003f3 <_panic>
+
+00800f9f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f9f:	55                   	push   %ebp
+  800fa0:	89 e5                	mov    %esp,%ebp
+  800fa2:	57                   	push   %edi
+  800fa3:	56                   	push   %esi
+  800fa4:	53                   	push   %ebx
+  800fa5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800fa8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb3:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fb8:	89 df                	mov    %ebx,%edi
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	8d 35 c5 0f 80 00    	lea    0x800fc5,%esi
+  800fc3:	0f 34                	sysenter
+  800fc5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800fc6:	85 c0                	test   %eax,%eax
+  800fc8:	7f 08                	jg     800fd2 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800fca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcd:	5b                   	pop    %ebx
+  800fce:	5e                   	pop    %esi
+  800fcf:	5f                   	pop    %edi
+  800fd0:	5d                   	pop    %ebp
+  800fd1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd2:	83 ec 0c             	sub    $0xc,%esp
+  800fd5:	50                   	push   %eax
+  800fd6:	6a 08                	push   $0x8
+  800fd8:	68 27 45 80 00       	push   $0x804527
+  800fdd:	6a 3d                	push   $0x3d
+  800fdf:	68 44 45 80 00       	push   $0x804544
+  800fe4:	e8 0a f4 ff ff       	call   8003f3 <_panic>
+
+00800fe9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fe9:	55                   	push   %ebp
+  800fea:	89 e5                	mov    %esp,%ebp
+  800fec:	57                   	push   %edi
+  800fed:	56                   	push   %esi
+  800fee:	53                   	push   %ebx
+  800fef:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ff2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffd:	b8 09 00 00 00       	mov    $0x9,%eax
+  801002:	89 df                	mov    %ebx,%edi
+  801004:	55                   	push   %ebp
+  801005:	89 e5                	mov    %esp,%ebp
+  801007:	8d 35 0f 10 80 00    	lea    0x80100f,%esi
+  80100d:	0f 34                	sysenter
+  80100f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801010:	85 c0                	test   %eax,%eax
+  801012:	7f 08                	jg     80101c <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  801014:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801017:	5b                   	pop    %ebx
+  801018:	5e                   	pop    %esi
+  801019:	5f                   	pop    %edi
+  80101a:	5d                   	pop    %ebp
+  80101b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80101c:	83 ec 0c             	sub    $0xc,%esp
+  80101f:	50                   	push   %eax
+  801020:	6a 09                	push   $0x9
+  801022:	68 27 45 80 00       	push   $0x804527
+  801027:	6a 3d                	push   $0x3d
+  801029:	68 44 45 80 00       	push   $0x804544
+  80102e:	e8 c0 f3 ff ff       	call   8003f3 <_panic>
+
+00801033 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801033:	55                   	push   %ebp
+  801034:	89 e5                	mov    %esp,%ebp
+  801036:	57                   	push   %edi
+  801037:	56                   	push   %esi
+  801038:	53                   	push   %ebx
+  801039:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80103c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801041:	8b 55 08             	mov    0x8(%ebp),%edx
+  801044:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801047:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80104c:	89 df                	mov    %ebx,%edi
+  80104e:	55                   	push   %ebp
+  80104f:	89 e5                	mov    %esp,%ebp
+  801051:	8d 35 59 10 80 00    	lea    0x801059,%esi
+  801057:	0f 34                	sysenter
+  801059:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80105a:	85 c0                	test   %eax,%eax
+  80105c:	7f 08                	jg     801066 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  80105e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801061:	5b                   	pop    %ebx
+  801062:	5e                   	pop    %esi
+  801063:	5f                   	pop    %edi
+  801064:	5d                   	pop    %ebp
+  801065:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801066:	83 ec 0c             	sub    $0xc,%esp
+  801069:	50                   	push   %eax
+  80106a:	6a 0a                	push   $0xa
+  80106c:	68 27 45 80 00       	push   $0x804527
+  801071:	6a 3d                	push   $0x3d
+  801073:	68 44 45 80 00       	push   $0x804544
+  801078:	e8 76 f3 ff ff       	call   8003f3 <_panic>
+
+0080107d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+  801080:	57                   	push   %edi
+  801081:	56                   	push   %esi
+  801082:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801083:	8b 55 08             	mov    0x8(%ebp),%edx
+  801086:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801089:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80108e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801091:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801094:	55                   	push   %ebp
+  801095:	89 e5                	mov    %esp,%ebp
+  801097:	8d 35 9f 10 80 00    	lea    0x80109f,%esi
+  80109d:	0f 34                	sysenter
+  80109f:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  8010a0:	5b                   	pop    %ebx
+  8010a1:	5e                   	pop    %esi
+  8010a2:	5f                   	pop    %edi
+  8010a3:	5d                   	pop    %ebp
+  8010a4:	c3                   	ret
+
+008010a5 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  8010a5:	55                   	push   %ebp
+  8010a6:	89 e5                	mov    %esp,%ebp
+  8010a8:	57                   	push   %edi
+  8010a9:	56                   	push   %esi
+  8010aa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	8d 35 c7 10 80 00    	lea    0x8010c7,%esi
+  8010c5:	0f 34                	sysenter
+  8010c7:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  8010c8:	5b                   	pop    %ebx
+  8010c9:	5e                   	pop    %esi
+  8010ca:	5f                   	pop    %edi
+  8010cb:	5d                   	pop    %ebp
+  8010cc:	c3                   	ret
+
+008010cd <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  8010cd:	55                   	push   %ebp
+  8010ce:	89 e5                	mov    %esp,%ebp
+  8010d0:	57                   	push   %edi
+  8010d1:	56                   	push   %esi
+  8010d2:	53                   	push   %ebx
+  8010d3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8010db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e9:	89 f7                	mov    %esi,%edi
+  8010eb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ed:	85 c0                	test   %eax,%eax
+  8010ef:	7f 08                	jg     8010f9 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8010f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f4:	5b                   	pop    %ebx
+  8010f5:	5e                   	pop    %esi
+  8010f6:	5f                   	pop    %edi
+  8010f7:	5d                   	pop    %ebp
+  8010f8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f9:	83 ec 0c             	sub    $0xc,%esp
+  8010fc:	50                   	push   %eax
+  8010fd:	6a 0d                	push   $0xd
+  8010ff:	68 27 45 80 00       	push   $0x804527
+  801104:	6a 23                	push   $0x23
+  801106:	68 44 45 80 00       	push   $0x804544
+  80110b:	e8 e3 f2 ff ff       	call   8003f3 <_panic>
+
+00801110 <sys_ipc_recv>:
+{
+  801110:	55                   	push   %ebp
+  801111:	89 e5                	mov    %esp,%ebp
+  801113:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  801116:	6a 00                	push   $0x0
+  801118:	6a 01                	push   $0x1
+  80111a:	ff 75 08             	push   0x8(%ebp)
+  80111d:	e8 ab ff ff ff       	call   8010cd <sys_ipc_recvv>
+}
+  801122:	c9                   	leave
+  801123:	c3                   	ret
+
+00801124 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  801124:	55                   	push   %ebp
+  801125:	89 e5                	mov    %esp,%ebp
+  801127:	57                   	push   %edi
+  801128:	56                   	push   %esi
+  801129:	53                   	push   %ebx
+  80112a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80112d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801132:	8b 55 08             	mov    0x8(%ebp),%edx
+  801135:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801138:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80113d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801140:	89 de                	mov    %ebx,%esi
+  801142:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801144:	85 c0                	test   %eax,%eax
+  801146:	7f 08                	jg     801150 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  801148:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114b:	5b                   	pop    %ebx
+  80114c:	5e                   	pop    %esi
+  80114d:	5f                   	pop    %edi
+  80114e:	5d                   	pop    %ebp
+  80114f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801150:	83 ec 0c             	sub    $0xc,%esp
+  801153:	50                   	push   %eax
+  801154:	6a 0d                	push   $0xd
+  801156:	68 27 45 80 00       	push   $0x804527
+  80115b:	6a 23                	push   $0x23
+  80115d:	68 44 45 80 00       	push   $0x804544
+  801162:	e8 8c f2 ff ff       	call   8003f3 <_panic>
+
+00801167 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801167:	55                   	push   %ebp
+  801168:	89 e5                	mov    %esp,%ebp
+  80116a:	57                   	push   %edi
+  80116b:	56                   	push   %esi
+  80116c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80116d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801172:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801177:	89 d1                	mov    %edx,%ecx
+  801179:	89 d3                	mov    %edx,%ebx
+  80117b:	89 d7                	mov    %edx,%edi
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	8d 35 88 11 80 00    	lea    0x801188,%esi
+  801186:	0f 34                	sysenter
+  801188:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  801189:	5b                   	pop    %ebx
+  80118a:	5e                   	pop    %esi
+  80118b:	5f                   	pop    %edi
+  80118c:	5d                   	pop    %ebp
+  80118d:	c3                   	ret
+
+0080118e <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  80118e:	55                   	push   %ebp
+  80118f:	89 e5                	mov    %esp,%ebp
+  801191:	57                   	push   %edi
+  801192:	56                   	push   %esi
+  801193:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801194:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801199:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011a4:	89 df                	mov    %ebx,%edi
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	8d 35 b1 11 80 00    	lea    0x8011b1,%esi
+  8011af:	0f 34                	sysenter
+  8011b1:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  8011b2:	5b                   	pop    %ebx
+  8011b3:	5e                   	pop    %esi
+  8011b4:	5f                   	pop    %edi
+  8011b5:	5d                   	pop    %ebp
+  8011b6:	c3                   	ret
+
+008011b7 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  8011b7:	55                   	push   %ebp
+  8011b8:	89 e5                	mov    %esp,%ebp
+  8011ba:	57                   	push   %edi
+  8011bb:	56                   	push   %esi
+  8011bc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011ca:	89 cb                	mov    %ecx,%ebx
+  8011cc:	89 cf                	mov    %ecx,%edi
+  8011ce:	55                   	push   %ebp
+  8011cf:	89 e5                	mov    %esp,%ebp
+  8011d1:	8d 35 d9 11 80 00    	lea    0x8011d9,%esi
+  8011d7:	0f 34                	sysenter
+  8011d9:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  8011da:	5b                   	pop    %ebx
+  8011db:	5e                   	pop    %esi
+  8011dc:	5f                   	pop    %edi
+  8011dd:	5d                   	pop    %ebp
+  8011de:	c3                   	ret
+
+008011df <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	57                   	push   %edi
+  8011e3:	56                   	push   %esi
+  8011e4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f0:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011f5:	89 df                	mov    %ebx,%edi
+  8011f7:	55                   	push   %ebp
+  8011f8:	89 e5                	mov    %esp,%ebp
+  8011fa:	8d 35 02 12 80 00    	lea    0x801202,%esi
+  801200:	0f 34                	sysenter
+  801202:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  801203:	5b                   	pop    %ebx
+  801204:	5e                   	pop    %esi
+  801205:	5f                   	pop    %edi
+  801206:	5d                   	pop    %ebp
+  801207:	c3                   	ret
+
+00801208 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  801208:	55                   	push   %ebp
+  801209:	89 e5                	mov    %esp,%ebp
+  80120b:	57                   	push   %edi
+  80120c:	56                   	push   %esi
+  80120d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80120e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801213:	8b 55 08             	mov    0x8(%ebp),%edx
+  801216:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801219:	b8 14 00 00 00       	mov    $0x14,%eax
+  80121e:	89 df                	mov    %ebx,%edi
+  801220:	55                   	push   %ebp
+  801221:	89 e5                	mov    %esp,%ebp
+  801223:	8d 35 2b 12 80 00    	lea    0x80122b,%esi
+  801229:	0f 34                	sysenter
+  80122b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  80122c:	5b                   	pop    %ebx
+  80122d:	5e                   	pop    %esi
+  80122e:	5f                   	pop    %edi
+  80122f:	5d                   	pop    %ebp
+  801230:	c3                   	ret
+
+00801231 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  801231:	55                   	push   %ebp
+  801232:	89 e5                	mov    %esp,%ebp
+  801234:	57                   	push   %edi
+  801235:	56                   	push   %esi
+  801236:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801237:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801242:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801245:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801248:	55                   	push   %ebp
+  801249:	89 e5                	mov    %esp,%ebp
+  80124b:	8d 35 53 12 80 00    	lea    0x801253,%esi
+  801251:	0f 34                	sysenter
+  801253:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  801254:	5b                   	pop    %ebx
+  801255:	5e                   	pop    %esi
+  801256:	5f                   	pop    %edi
+  801257:	5d                   	pop    %ebp
+  801258:	c3                   	ret
+
+00801259 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801259:	55                   	push   %ebp
+  80125a:	89 e5                	mov    %esp,%ebp
+  80125c:	57                   	push   %edi
+  80125d:	56                   	push   %esi
+  80125e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80125f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801264:	8b 55 08             	mov    0x8(%ebp),%edx
+  801267:	b8 11 00 00 00       	mov    $0x11,%eax
+  80126c:	89 cb                	mov    %ecx,%ebx
+  80126e:	89 cf                	mov    %ecx,%edi
+  801270:	89 ce                	mov    %ecx,%esi
+  801272:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  801274:	5b                   	pop    %ebx
+  801275:	5e                   	pop    %esi
+  801276:	5f                   	pop    %edi
+  801277:	5d                   	pop    %ebp
+  801278:	c3                   	ret
+
+00801279 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  801279:	55                   	push   %ebp
+  80127a:	89 e5                	mov    %esp,%ebp
+  80127c:	57                   	push   %edi
+  80127d:	56                   	push   %esi
+  80127e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80127f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801284:	8b 55 08             	mov    0x8(%ebp),%edx
+  801287:	b8 15 00 00 00       	mov    $0x15,%eax
+  80128c:	89 cb                	mov    %ecx,%ebx
+  80128e:	89 cf                	mov    %ecx,%edi
+  801290:	55                   	push   %ebp
+  801291:	89 e5                	mov    %esp,%ebp
+  801293:	8d 35 9b 12 80 00    	lea    0x80129b,%esi
+  801299:	0f 34                	sysenter
+  80129b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  80129c:	5b                   	pop    %ebx
+  80129d:	5e                   	pop    %esi
+  80129e:	5f                   	pop    %edi
+  80129f:	5d                   	pop    %ebp
+  8012a0:	c3                   	ret
+
+008012a1 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8012a1:	55                   	push   %ebp
+  8012a2:	89 e5                	mov    %esp,%ebp
+  8012a4:	57                   	push   %edi
+  8012a5:	56                   	push   %esi
+  8012a6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012af:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012b4:	89 cb                	mov    %ecx,%ebx
+  8012b6:	89 cf                	mov    %ecx,%edi
+  8012b8:	55                   	push   %ebp
+  8012b9:	89 e5                	mov    %esp,%ebp
+  8012bb:	8d 35 c3 12 80 00    	lea    0x8012c3,%esi
+  8012c1:	0f 34                	sysenter
+  8012c3:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8012c4:	5b                   	pop    %ebx
+  8012c5:	5e                   	pop    %esi
+  8012c6:	5f                   	pop    %edi
+  8012c7:	5d                   	pop    %ebp
+  8012c8:	c3                   	ret
+
+008012c9 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012c9:	55                   	push   %ebp
+  8012ca:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012cf:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012d4:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012d7:	5d                   	pop    %ebp
+  8012d8:	c3                   	ret
+
+008012d9 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012d9:	55                   	push   %ebp
+  8012da:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012df:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8012e4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012e9:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8012ee:	5d                   	pop    %ebp
+  8012ef:	c3                   	ret
+
+008012f0 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012f0:	55                   	push   %ebp
+  8012f1:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8012f3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8012f8:	eb 02                	jmp    8012fc <fd_alloc+0xc>
+  8012fa:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8012fc:	89 c2                	mov    %eax,%edx
+  8012fe:	c1 ea 16             	shr    $0x16,%edx
+  801301:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801308:	f6 c2 01             	test   $0x1,%dl
+  80130b:	74 2b                	je     801338 <fd_alloc+0x48>
+  80130d:	89 c2                	mov    %eax,%edx
+  80130f:	c1 ea 0c             	shr    $0xc,%edx
+  801312:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801319:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80131f:	f6 c1 01             	test   $0x1,%cl
+  801322:	74 14                	je     801338 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801324:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80132a:	75 ce                	jne    8012fa <fd_alloc+0xa>
+  80132c:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801331:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801336:	eb 05                	jmp    80133d <fd_alloc+0x4d>
+			return 0;
+  801338:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80133d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801340:	89 02                	mov    %eax,(%edx)
+}
+  801342:	89 c8                	mov    %ecx,%eax
+  801344:	5d                   	pop    %ebp
+  801345:	c3                   	ret
+
+00801346 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801346:	55                   	push   %ebp
+  801347:	89 e5                	mov    %esp,%ebp
+  801349:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80134c:	83 f8 1f             	cmp    $0x1f,%eax
+  80134f:	77 30                	ja     801381 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801351:	c1 e0 0c             	shl    $0xc,%eax
+  801354:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801359:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80135f:	f6 c2 01             	test   $0x1,%dl
+  801362:	74 24                	je     801388 <fd_lookup+0x42>
+  801364:	89 c2                	mov    %eax,%edx
+  801366:	c1 ea 0c             	shr    $0xc,%edx
+  801369:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801370:	f6 c2 01             	test   $0x1,%dl
+  801373:	74 1a                	je     80138f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801375:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801378:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80137a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80137f:	5d                   	pop    %ebp
+  801380:	c3                   	ret
+		return -E_INVAL;
+  801381:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801386:	eb f7                	jmp    80137f <fd_lookup+0x39>
+		return -E_INVAL;
+  801388:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80138d:	eb f0                	jmp    80137f <fd_lookup+0x39>
+  80138f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801394:	eb e9                	jmp    80137f <fd_lookup+0x39>
+
+00801396 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801396:	55                   	push   %ebp
+  801397:	89 e5                	mov    %esp,%ebp
+  801399:	53                   	push   %ebx
+  80139a:	83 ec 04             	sub    $0x4,%esp
+  80139d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a5:	eb 03                	jmp    8013aa <dev_lookup+0x14>
+  8013a7:	83 c0 01             	add    $0x1,%eax
+  8013aa:	8b 1c 85 d0 45 80 00 	mov    0x8045d0(,%eax,4),%ebx
+  8013b1:	85 db                	test   %ebx,%ebx
+  8013b3:	74 0b                	je     8013c0 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8013b5:	39 13                	cmp    %edx,(%ebx)
+  8013b7:	75 ee                	jne    8013a7 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8013b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013be:	eb 1f                	jmp    8013df <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013c0:	a1 70 87 80 00       	mov    0x808770,%eax
+  8013c5:	8b 40 48             	mov    0x48(%eax),%eax
+  8013c8:	83 ec 04             	sub    $0x4,%esp
+  8013cb:	52                   	push   %edx
+  8013cc:	50                   	push   %eax
+  8013cd:	68 54 45 80 00       	push   $0x804554
+  8013d2:	e8 f7 f0 ff ff       	call   8004ce <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8013d7:	83 c4 10             	add    $0x10,%esp
+  8013da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8013df:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013e2:	89 1a                	mov    %ebx,(%edx)
+}
+  8013e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013e7:	c9                   	leave
+  8013e8:	c3                   	ret
+
+008013e9 <fd_close>:
+{
+  8013e9:	55                   	push   %ebp
+  8013ea:	89 e5                	mov    %esp,%ebp
+  8013ec:	57                   	push   %edi
+  8013ed:	56                   	push   %esi
+  8013ee:	53                   	push   %ebx
+  8013ef:	83 ec 24             	sub    $0x24,%esp
+  8013f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013f5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013f8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013fb:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013fc:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801402:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801405:	50                   	push   %eax
+  801406:	e8 3b ff ff ff       	call   801346 <fd_lookup>
+  80140b:	89 c3                	mov    %eax,%ebx
+  80140d:	83 c4 10             	add    $0x10,%esp
+  801410:	85 c0                	test   %eax,%eax
+  801412:	78 05                	js     801419 <fd_close+0x30>
+	    || fd != fd2)
+  801414:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801417:	74 16                	je     80142f <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801419:	89 f8                	mov    %edi,%eax
+  80141b:	84 c0                	test   %al,%al
+  80141d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801422:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801425:	89 d8                	mov    %ebx,%eax
+  801427:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142a:	5b                   	pop    %ebx
+  80142b:	5e                   	pop    %esi
+  80142c:	5f                   	pop    %edi
+  80142d:	5d                   	pop    %ebp
+  80142e:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80142f:	83 ec 08             	sub    $0x8,%esp
+  801432:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801435:	50                   	push   %eax
+  801436:	ff 36                	push   (%esi)
+  801438:	e8 59 ff ff ff       	call   801396 <dev_lookup>
+  80143d:	89 c3                	mov    %eax,%ebx
+  80143f:	83 c4 10             	add    $0x10,%esp
+  801442:	85 c0                	test   %eax,%eax
+  801444:	78 1a                	js     801460 <fd_close+0x77>
+		if (dev->dev_close)
+  801446:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801449:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80144c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801451:	85 c0                	test   %eax,%eax
+  801453:	74 0b                	je     801460 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801455:	83 ec 0c             	sub    $0xc,%esp
+  801458:	56                   	push   %esi
+  801459:	ff d0                	call   *%eax
+  80145b:	89 c3                	mov    %eax,%ebx
+  80145d:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801460:	83 ec 08             	sub    $0x8,%esp
+  801463:	56                   	push   %esi
+  801464:	6a 00                	push   $0x0
+  801466:	e8 ea fa ff ff       	call   800f55 <sys_page_unmap>
+	return r;
+  80146b:	83 c4 10             	add    $0x10,%esp
+  80146e:	eb b5                	jmp    801425 <fd_close+0x3c>
+
+00801470 <close>:
+
+int
+close(int fdnum)
+{
+  801470:	55                   	push   %ebp
+  801471:	89 e5                	mov    %esp,%ebp
+  801473:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801476:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801479:	50                   	push   %eax
+  80147a:	ff 75 08             	push   0x8(%ebp)
+  80147d:	e8 c4 fe ff ff       	call   801346 <fd_lookup>
+  801482:	83 c4 10             	add    $0x10,%esp
+  801485:	85 c0                	test   %eax,%eax
+  801487:	79 02                	jns    80148b <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801489:	c9                   	leave
+  80148a:	c3                   	ret
+		return fd_close(fd, 1);
+  80148b:	83 ec 08             	sub    $0x8,%esp
+  80148e:	6a 01                	push   $0x1
+  801490:	ff 75 f4             	push   -0xc(%ebp)
+  801493:	e8 51 ff ff ff       	call   8013e9 <fd_close>
+  801498:	83 c4 10             	add    $0x10,%esp
+  80149b:	eb ec                	jmp    801489 <close+0x19>
+
+0080149d <close_all>:
+
+void
+close_all(void)
+{
+  80149d:	55                   	push   %ebp
+  80149e:	89 e5                	mov    %esp,%ebp
+  8014a0:	53                   	push   %ebx
+  8014a1:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8014a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8014a9:	83 ec 0c             	sub    $0xc,%esp
+  8014ac:	53                   	push   %ebx
+  8014ad:	e8 be ff ff ff       	call   801470 <close>
+	for (i = 0; i < MAXFD; i++)
+  8014b2:	83 c3 01             	add    $0x1,%ebx
+  8014b5:	83 c4 10             	add    $0x10,%esp
+  8014b8:	83 fb 20             	cmp    $0x20,%ebx
+  8014bb:	75 ec                	jne    8014a9 <close_all+0xc>
+}
+  8014bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014c0:	c9                   	leave
+  8014c1:	c3                   	ret
+
+008014c2 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014c2:	55                   	push   %ebp
+  8014c3:	89 e5                	mov    %esp,%ebp
+  8014c5:	57                   	push   %edi
+  8014c6:	56                   	push   %esi
+  8014c7:	53                   	push   %ebx
+  8014c8:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014cb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014ce:	50                   	push   %eax
+  8014cf:	ff 75 08             	push   0x8(%ebp)
+  8014d2:	e8 6f fe ff ff       	call   801346 <fd_lookup>
+  8014d7:	89 c3                	mov    %eax,%ebx
+  8014d9:	83 c4 10             	add    $0x10,%esp
+  8014dc:	85 c0                	test   %eax,%eax
+  8014de:	78 7f                	js     80155f <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8014e0:	83 ec 0c             	sub    $0xc,%esp
+  8014e3:	ff 75 0c             	push   0xc(%ebp)
+  8014e6:	e8 85 ff ff ff       	call   801470 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014ee:	c1 e6 0c             	shl    $0xc,%esi
+  8014f1:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8014f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014fa:	89 3c 24             	mov    %edi,(%esp)
+  8014fd:	e8 d7 fd ff ff       	call   8012d9 <fd2data>
+  801502:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801504:	89 34 24             	mov    %esi,(%esp)
+  801507:	e8 cd fd ff ff       	call   8012d9 <fd2data>
+  80150c:	83 c4 10             	add    $0x10,%esp
+  80150f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801512:	89 d8                	mov    %ebx,%eax
+  801514:	c1 e8 16             	shr    $0x16,%eax
+  801517:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80151e:	a8 01                	test   $0x1,%al
+  801520:	74 11                	je     801533 <dup+0x71>
+  801522:	89 d8                	mov    %ebx,%eax
+  801524:	c1 e8 0c             	shr    $0xc,%eax
+  801527:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80152e:	f6 c2 01             	test   $0x1,%dl
+  801531:	75 36                	jne    801569 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801533:	89 f8                	mov    %edi,%eax
+  801535:	c1 e8 0c             	shr    $0xc,%eax
+  801538:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80153f:	83 ec 0c             	sub    $0xc,%esp
+  801542:	25 07 0e 00 00       	and    $0xe07,%eax
+  801547:	50                   	push   %eax
+  801548:	56                   	push   %esi
+  801549:	6a 00                	push   $0x0
+  80154b:	57                   	push   %edi
+  80154c:	6a 00                	push   $0x0
+  80154e:	e8 c0 f9 ff ff       	call   800f13 <sys_page_map>
+  801553:	89 c3                	mov    %eax,%ebx
+  801555:	83 c4 20             	add    $0x20,%esp
+  801558:	85 c0                	test   %eax,%eax
+  80155a:	78 33                	js     80158f <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80155c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80155f:	89 d8                	mov    %ebx,%eax
+  801561:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801564:	5b                   	pop    %ebx
+  801565:	5e                   	pop    %esi
+  801566:	5f                   	pop    %edi
+  801567:	5d                   	pop    %ebp
+  801568:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801569:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801570:	83 ec 0c             	sub    $0xc,%esp
+  801573:	25 07 0e 00 00       	and    $0xe07,%eax
+  801578:	50                   	push   %eax
+  801579:	ff 75 d4             	push   -0x2c(%ebp)
+  80157c:	6a 00                	push   $0x0
+  80157e:	53                   	push   %ebx
+  80157f:	6a 00                	push   $0x0
+  801581:	e8 8d f9 ff ff       	call   800f13 <sys_page_map>
+  801586:	89 c3                	mov    %eax,%ebx
+  801588:	83 c4 20             	add    $0x20,%esp
+  80158b:	85 c0                	test   %eax,%eax
+  80158d:	79 a4                	jns    801533 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80158f:	83 ec 08             	sub    $0x8,%esp
+  801592:	56                   	push   %esi
+  801593:	6a 00                	push   $0x0
+  801595:	e8 bb f9 ff ff       	call   800f55 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80159a:	83 c4 08             	add    $0x8,%esp
+  80159d:	ff 75 d4             	push   -0x2c(%ebp)
+  8015a0:	6a 00                	push   $0x0
+  8015a2:	e8 ae f9 ff ff       	call   800f55 <sys_page_unmap>
+	return r;
+  8015a7:	83 c4 10             	add    $0x10,%esp
+  8015aa:	eb b3                	jmp    80155f <dup+0x9d>
+
+008015ac <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	56                   	push   %esi
+  8015b0:	53                   	push   %ebx
+  8015b1:	83 ec 18             	sub    $0x18,%esp
+  8015b4:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015b7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015ba:	50                   	push   %eax
+  8015bb:	56                   	push   %esi
+  8015bc:	e8 85 fd ff ff       	call   801346 <fd_lookup>
+  8015c1:	83 c4 10             	add    $0x10,%esp
+  8015c4:	85 c0                	test   %eax,%eax
+  8015c6:	78 3c                	js     801604 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015c8:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8015cb:	83 ec 08             	sub    $0x8,%esp
+  8015ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015d1:	50                   	push   %eax
+  8015d2:	ff 33                	push   (%ebx)
+  8015d4:	e8 bd fd ff ff       	call   801396 <dev_lookup>
+  8015d9:	83 c4 10             	add    $0x10,%esp
+  8015dc:	85 c0                	test   %eax,%eax
+  8015de:	78 24                	js     801604 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8015e0:	8b 43 08             	mov    0x8(%ebx),%eax
+  8015e3:	83 e0 03             	and    $0x3,%eax
+  8015e6:	83 f8 01             	cmp    $0x1,%eax
+  8015e9:	74 20                	je     80160b <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015ee:	8b 40 08             	mov    0x8(%eax),%eax
+  8015f1:	85 c0                	test   %eax,%eax
+  8015f3:	74 37                	je     80162c <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8015f5:	83 ec 04             	sub    $0x4,%esp
+  8015f8:	ff 75 10             	push   0x10(%ebp)
+  8015fb:	ff 75 0c             	push   0xc(%ebp)
+  8015fe:	53                   	push   %ebx
+  8015ff:	ff d0                	call   *%eax
+  801601:	83 c4 10             	add    $0x10,%esp
+}
+  801604:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801607:	5b                   	pop    %ebx
+  801608:	5e                   	pop    %esi
+  801609:	5d                   	pop    %ebp
+  80160a:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80160b:	a1 70 87 80 00       	mov    0x808770,%eax
+  801610:	8b 40 48             	mov    0x48(%eax),%eax
+  801613:	83 ec 04             	sub    $0x4,%esp
+  801616:	56                   	push   %esi
+  801617:	50                   	push   %eax
+  801618:	68 95 45 80 00       	push   $0x804595
+  80161d:	e8 ac ee ff ff       	call   8004ce <cprintf>
+		return -E_INVAL;
+  801622:	83 c4 10             	add    $0x10,%esp
+  801625:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80162a:	eb d8                	jmp    801604 <read+0x58>
+		return -E_NOT_SUPP;
+  80162c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801631:	eb d1                	jmp    801604 <read+0x58>
+
+00801633 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801633:	55                   	push   %ebp
+  801634:	89 e5                	mov    %esp,%ebp
+  801636:	57                   	push   %edi
+  801637:	56                   	push   %esi
+  801638:	53                   	push   %ebx
+  801639:	83 ec 0c             	sub    $0xc,%esp
+  80163c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80163f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801642:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801647:	eb 02                	jmp    80164b <readn+0x18>
+  801649:	01 c3                	add    %eax,%ebx
+  80164b:	39 f3                	cmp    %esi,%ebx
+  80164d:	73 21                	jae    801670 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80164f:	83 ec 04             	sub    $0x4,%esp
+  801652:	89 f0                	mov    %esi,%eax
+  801654:	29 d8                	sub    %ebx,%eax
+  801656:	50                   	push   %eax
+  801657:	89 d8                	mov    %ebx,%eax
+  801659:	03 45 0c             	add    0xc(%ebp),%eax
+  80165c:	50                   	push   %eax
+  80165d:	57                   	push   %edi
+  80165e:	e8 49 ff ff ff       	call   8015ac <read>
+		if (m < 0)
+  801663:	83 c4 10             	add    $0x10,%esp
+  801666:	85 c0                	test   %eax,%eax
+  801668:	78 04                	js     80166e <readn+0x3b>
+			return m;
+		if (m == 0)
+  80166a:	75 dd                	jne    801649 <readn+0x16>
+  80166c:	eb 02                	jmp    801670 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80166e:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801670:	89 d8                	mov    %ebx,%eax
+  801672:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801675:	5b                   	pop    %ebx
+  801676:	5e                   	pop    %esi
+  801677:	5f                   	pop    %edi
+  801678:	5d                   	pop    %ebp
+  801679:	c3                   	ret
+
+0080167a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80167a:	55                   	push   %ebp
+  80167b:	89 e5                	mov    %esp,%ebp
+  80167d:	56                   	push   %esi
+  80167e:	53                   	push   %ebx
+  80167f:	83 ec 18             	sub    $0x18,%esp
+  801682:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801685:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801688:	50                   	push   %eax
+  801689:	53                   	push   %ebx
+  80168a:	e8 b7 fc ff ff       	call   801346 <fd_lookup>
+  80168f:	83 c4 10             	add    $0x10,%esp
+  801692:	85 c0                	test   %eax,%eax
+  801694:	78 37                	js     8016cd <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801696:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801699:	83 ec 08             	sub    $0x8,%esp
+  80169c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80169f:	50                   	push   %eax
+  8016a0:	ff 36                	push   (%esi)
+  8016a2:	e8 ef fc ff ff       	call   801396 <dev_lookup>
+  8016a7:	83 c4 10             	add    $0x10,%esp
+  8016aa:	85 c0                	test   %eax,%eax
+  8016ac:	78 1f                	js     8016cd <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016ae:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016b2:	74 20                	je     8016d4 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016ba:	85 c0                	test   %eax,%eax
+  8016bc:	74 37                	je     8016f5 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016be:	83 ec 04             	sub    $0x4,%esp
+  8016c1:	ff 75 10             	push   0x10(%ebp)
+  8016c4:	ff 75 0c             	push   0xc(%ebp)
+  8016c7:	56                   	push   %esi
+  8016c8:	ff d0                	call   *%eax
+  8016ca:	83 c4 10             	add    $0x10,%esp
+}
+  8016cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016d0:	5b                   	pop    %ebx
+  8016d1:	5e                   	pop    %esi
+  8016d2:	5d                   	pop    %ebp
+  8016d3:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016d4:	a1 70 87 80 00       	mov    0x808770,%eax
+  8016d9:	8b 40 48             	mov    0x48(%eax),%eax
+  8016dc:	83 ec 04             	sub    $0x4,%esp
+  8016df:	53                   	push   %ebx
+  8016e0:	50                   	push   %eax
+  8016e1:	68 b1 45 80 00       	push   $0x8045b1
+  8016e6:	e8 e3 ed ff ff       	call   8004ce <cprintf>
+		return -E_INVAL;
+  8016eb:	83 c4 10             	add    $0x10,%esp
+  8016ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016f3:	eb d8                	jmp    8016cd <write+0x53>
+		return -E_NOT_SUPP;
+  8016f5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016fa:	eb d1                	jmp    8016cd <write+0x53>
+
+008016fc <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016fc:	55                   	push   %ebp
+  8016fd:	89 e5                	mov    %esp,%ebp
+  8016ff:	53                   	push   %ebx
+  801700:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801703:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801706:	50                   	push   %eax
+  801707:	ff 75 08             	push   0x8(%ebp)
+  80170a:	e8 37 fc ff ff       	call   801346 <fd_lookup>
+  80170f:	83 c4 10             	add    $0x10,%esp
+  801712:	85 c0                	test   %eax,%eax
+  801714:	78 3a                	js     801750 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801716:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801719:	83 ec 08             	sub    $0x8,%esp
+  80171c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80171f:	50                   	push   %eax
+  801720:	ff 33                	push   (%ebx)
+  801722:	e8 6f fc ff ff       	call   801396 <dev_lookup>
+  801727:	83 c4 10             	add    $0x10,%esp
+  80172a:	85 c0                	test   %eax,%eax
+  80172c:	78 22                	js     801750 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  80172e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801731:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801734:	85 c0                	test   %eax,%eax
+  801736:	74 0d                	je     801745 <seek+0x49>
+  801738:	83 ec 0c             	sub    $0xc,%esp
+  80173b:	53                   	push   %ebx
+  80173c:	ff d0                	call   *%eax
+  80173e:	83 c4 10             	add    $0x10,%esp
+  801741:	85 c0                	test   %eax,%eax
+  801743:	78 0b                	js     801750 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801745:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801748:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  80174b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801750:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801753:	c9                   	leave
+  801754:	c3                   	ret
+
+00801755 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801755:	55                   	push   %ebp
+  801756:	89 e5                	mov    %esp,%ebp
+  801758:	53                   	push   %ebx
+  801759:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80175c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80175f:	50                   	push   %eax
+  801760:	ff 75 08             	push   0x8(%ebp)
+  801763:	e8 de fb ff ff       	call   801346 <fd_lookup>
+  801768:	83 c4 10             	add    $0x10,%esp
+  80176b:	85 c0                	test   %eax,%eax
+  80176d:	78 2b                	js     80179a <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80176f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801772:	83 ec 08             	sub    $0x8,%esp
+  801775:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801778:	50                   	push   %eax
+  801779:	ff 33                	push   (%ebx)
+  80177b:	e8 16 fc ff ff       	call   801396 <dev_lookup>
+  801780:	83 c4 10             	add    $0x10,%esp
+  801783:	85 c0                	test   %eax,%eax
+  801785:	78 13                	js     80179a <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801787:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80178a:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80178d:	85 c0                	test   %eax,%eax
+  80178f:	74 0e                	je     80179f <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801791:	83 ec 0c             	sub    $0xc,%esp
+  801794:	53                   	push   %ebx
+  801795:	ff d0                	call   *%eax
+  801797:	83 c4 10             	add    $0x10,%esp
+}
+  80179a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80179d:	c9                   	leave
+  80179e:	c3                   	ret
+		return 0;
+  80179f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a4:	eb f4                	jmp    80179a <fsync+0x45>
+
+008017a6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017a6:	55                   	push   %ebp
+  8017a7:	89 e5                	mov    %esp,%ebp
+  8017a9:	56                   	push   %esi
+  8017aa:	53                   	push   %ebx
+  8017ab:	83 ec 18             	sub    $0x18,%esp
+  8017ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017b1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017b4:	50                   	push   %eax
+  8017b5:	53                   	push   %ebx
+  8017b6:	e8 8b fb ff ff       	call   801346 <fd_lookup>
+  8017bb:	83 c4 10             	add    $0x10,%esp
+  8017be:	85 c0                	test   %eax,%eax
+  8017c0:	78 34                	js     8017f6 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017c2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017c5:	83 ec 08             	sub    $0x8,%esp
+  8017c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017cb:	50                   	push   %eax
+  8017cc:	ff 36                	push   (%esi)
+  8017ce:	e8 c3 fb ff ff       	call   801396 <dev_lookup>
+  8017d3:	83 c4 10             	add    $0x10,%esp
+  8017d6:	85 c0                	test   %eax,%eax
+  8017d8:	78 1c                	js     8017f6 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017da:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017de:	74 1d                	je     8017fd <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8017e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017e3:	8b 40 18             	mov    0x18(%eax),%eax
+  8017e6:	85 c0                	test   %eax,%eax
+  8017e8:	74 34                	je     80181e <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8017ea:	83 ec 08             	sub    $0x8,%esp
+  8017ed:	ff 75 0c             	push   0xc(%ebp)
+  8017f0:	56                   	push   %esi
+  8017f1:	ff d0                	call   *%eax
+  8017f3:	83 c4 10             	add    $0x10,%esp
+}
+  8017f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017f9:	5b                   	pop    %ebx
+  8017fa:	5e                   	pop    %esi
+  8017fb:	5d                   	pop    %ebp
+  8017fc:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8017fd:	a1 70 87 80 00       	mov    0x808770,%eax
+  801802:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801805:	83 ec 04             	sub    $0x4,%esp
+  801808:	53                   	push   %ebx
+  801809:	50                   	push   %eax
+  80180a:	68 74 45 80 00       	push   $0x804574
+  80180f:	e8 ba ec ff ff       	call   8004ce <cprintf>
+		return -E_INVAL;
+  801814:	83 c4 10             	add    $0x10,%esp
+  801817:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80181c:	eb d8                	jmp    8017f6 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80181e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801823:	eb d1                	jmp    8017f6 <ftruncate+0x50>
+
+00801825 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801825:	55                   	push   %ebp
+  801826:	89 e5                	mov    %esp,%ebp
+  801828:	56                   	push   %esi
+  801829:	53                   	push   %ebx
+  80182a:	83 ec 18             	sub    $0x18,%esp
+  80182d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801830:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801833:	50                   	push   %eax
+  801834:	ff 75 08             	push   0x8(%ebp)
+  801837:	e8 0a fb ff ff       	call   801346 <fd_lookup>
+  80183c:	83 c4 10             	add    $0x10,%esp
+  80183f:	85 c0                	test   %eax,%eax
+  801841:	78 49                	js     80188c <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801843:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801846:	83 ec 08             	sub    $0x8,%esp
+  801849:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80184c:	50                   	push   %eax
+  80184d:	ff 36                	push   (%esi)
+  80184f:	e8 42 fb ff ff       	call   801396 <dev_lookup>
+  801854:	83 c4 10             	add    $0x10,%esp
+  801857:	85 c0                	test   %eax,%eax
+  801859:	78 31                	js     80188c <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80185b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80185e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801862:	74 2f                	je     801893 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801864:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801867:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80186e:	00 00 00 
+	stat->st_isdir = 0;
+  801871:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801878:	00 00 00 
+	stat->st_dev = dev;
+  80187b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801881:	83 ec 08             	sub    $0x8,%esp
+  801884:	53                   	push   %ebx
+  801885:	56                   	push   %esi
+  801886:	ff 50 14             	call   *0x14(%eax)
+  801889:	83 c4 10             	add    $0x10,%esp
+}
+  80188c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80188f:	5b                   	pop    %ebx
+  801890:	5e                   	pop    %esi
+  801891:	5d                   	pop    %ebp
+  801892:	c3                   	ret
+		return -E_NOT_SUPP;
+  801893:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801898:	eb f2                	jmp    80188c <fstat+0x67>
+
+0080189a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80189a:	55                   	push   %ebp
+  80189b:	89 e5                	mov    %esp,%ebp
+  80189d:	56                   	push   %esi
+  80189e:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  80189f:	83 ec 08             	sub    $0x8,%esp
+  8018a2:	68 00 10 00 00       	push   $0x1000
+  8018a7:	ff 75 08             	push   0x8(%ebp)
+  8018aa:	e8 b3 07 00 00       	call   802062 <open>
+  8018af:	89 c3                	mov    %eax,%ebx
+  8018b1:	83 c4 10             	add    $0x10,%esp
+  8018b4:	85 c0                	test   %eax,%eax
+  8018b6:	78 1b                	js     8018d3 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  8018b8:	83 ec 08             	sub    $0x8,%esp
+  8018bb:	ff 75 0c             	push   0xc(%ebp)
+  8018be:	50                   	push   %eax
+  8018bf:	e8 61 ff ff ff       	call   801825 <fstat>
+  8018c4:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8018c6:	89 1c 24             	mov    %ebx,(%esp)
+  8018c9:	e8 a2 fb ff ff       	call   801470 <close>
+	return r;
+  8018ce:	83 c4 10             	add    $0x10,%esp
+  8018d1:	89 f3                	mov    %esi,%ebx
+}
+  8018d3:	89 d8                	mov    %ebx,%eax
+  8018d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018d8:	5b                   	pop    %ebx
+  8018d9:	5e                   	pop    %esi
+  8018da:	5d                   	pop    %ebp
+  8018db:	c3                   	ret
+
+008018dc <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  8018dc:	55                   	push   %ebp
+  8018dd:	89 e5                	mov    %esp,%ebp
+  8018df:	57                   	push   %edi
+  8018e0:	56                   	push   %esi
+  8018e1:	53                   	push   %ebx
+  8018e2:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  8018e8:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  8018ee:	89 d6                	mov    %edx,%esi
+  8018f0:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  8018f6:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  8018f9:	89 d3                	mov    %edx,%ebx
+  8018fb:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801901:	83 3d c8 a0 80 00 00 	cmpl   $0x0,0x80a0c8
+  801908:	74 1d                	je     801927 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80190a:	b8 00 90 80 00       	mov    $0x809000,%eax
+  80190f:	83 c8 07             	or     $0x7,%eax
+  801912:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801918:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  80191d:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801923:	01 ce                	add    %ecx,%esi
+  801925:	eb 28                	jmp    80194f <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801927:	83 ec 0c             	sub    $0xc,%esp
+  80192a:	6a 01                	push   $0x1
+  80192c:	e8 01 24 00 00       	call   803d32 <ipc_find_env>
+  801931:	a3 c8 a0 80 00       	mov    %eax,0x80a0c8
+  801936:	83 c4 10             	add    $0x10,%esp
+  801939:	eb cf                	jmp    80190a <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  80193b:	83 c0 01             	add    $0x1,%eax
+  80193e:	89 fa                	mov    %edi,%edx
+  801940:	09 da                	or     %ebx,%edx
+  801942:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801949:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80194f:	39 f3                	cmp    %esi,%ebx
+  801951:	72 e8                	jb     80193b <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801953:	83 f8 41             	cmp    $0x41,%eax
+  801956:	77 2f                	ja     801987 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801958:	50                   	push   %eax
+  801959:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  80195f:	50                   	push   %eax
+  801960:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801966:	ff 35 c8 a0 80 00    	push   0x80a0c8
+  80196c:	e8 73 23 00 00       	call   803ce4 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801971:	83 c4 0c             	add    $0xc,%esp
+  801974:	6a 00                	push   $0x0
+  801976:	6a 00                	push   $0x0
+  801978:	6a 00                	push   $0x0
+  80197a:	e8 0f 22 00 00       	call   803b8e <ipc_recv>
+}
+  80197f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801982:	5b                   	pop    %ebx
+  801983:	5e                   	pop    %esi
+  801984:	5f                   	pop    %edi
+  801985:	5d                   	pop    %ebp
+  801986:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801987:	68 e4 45 80 00       	push   $0x8045e4
+  80198c:	68 00 46 80 00       	push   $0x804600
+  801991:	6a 40                	push   $0x40
+  801993:	68 15 46 80 00       	push   $0x804615
+  801998:	e8 56 ea ff ff       	call   8003f3 <_panic>
+
+0080199d <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  80199d:	55                   	push   %ebp
+  80199e:	89 e5                	mov    %esp,%ebp
+  8019a0:	57                   	push   %edi
+  8019a1:	56                   	push   %esi
+  8019a2:	53                   	push   %ebx
+  8019a3:	83 ec 1c             	sub    $0x1c,%esp
+  8019a6:	89 c3                	mov    %eax,%ebx
+  8019a8:	89 d6                	mov    %edx,%esi
+  8019aa:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  8019ad:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  8019b3:	89 ca                	mov    %ecx,%edx
+  8019b5:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  8019b8:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  8019bf:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8019c2:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  8019c9:	8b 76 0c             	mov    0xc(%esi),%esi
+  8019cc:	89 fb                	mov    %edi,%ebx
+  8019ce:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  8019d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019d8:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  8019df:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019e2:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  8019e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019ec:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  8019f3:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  8019f6:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  8019fd:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801a02:	39 c8                	cmp    %ecx,%eax
+  801a04:	74 0d                	je     801a13 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801a06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a0e:	5b                   	pop    %ebx
+  801a0f:	5e                   	pop    %esi
+  801a10:	5f                   	pop    %edi
+  801a11:	5d                   	pop    %ebp
+  801a12:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a13:	6a 07                	push   $0x7
+  801a15:	68 00 90 80 00       	push   $0x809000
+  801a1a:	6a 0d                	push   $0xd
+  801a1c:	ff 35 c8 a0 80 00    	push   0x80a0c8
+  801a22:	e8 d2 21 00 00       	call   803bf9 <ipc_send>
+  801a27:	83 c4 10             	add    $0x10,%esp
+  801a2a:	eb da                	jmp    801a06 <fsring_post+0x69>
+
+00801a2c <fsipcv>:
+{
+  801a2c:	55                   	push   %ebp
+  801a2d:	89 e5                	mov    %esp,%ebp
+  801a2f:	57                   	push   %edi
+  801a30:	56                   	push   %esi
+  801a31:	53                   	push   %ebx
+  801a32:	83 ec 0c             	sub    $0xc,%esp
+  801a35:	89 c7                	mov    %eax,%edi
+  801a37:	89 d3                	mov    %edx,%ebx
+  801a39:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801a3b:	83 3d c8 a0 80 00 00 	cmpl   $0x0,0x80a0c8
+  801a42:	74 26                	je     801a6a <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a44:	6a 07                	push   $0x7
+  801a46:	68 00 90 80 00       	push   $0x809000
+  801a4b:	57                   	push   %edi
+  801a4c:	ff 35 c8 a0 80 00    	push   0x80a0c8
+  801a52:	e8 a2 21 00 00       	call   803bf9 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801a57:	6a 00                	push   $0x0
+  801a59:	56                   	push   %esi
+  801a5a:	53                   	push   %ebx
+  801a5b:	6a 00                	push   $0x0
+  801a5d:	e8 ef 21 00 00       	call   803c51 <ipc_recvv>
+}
+  801a62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a65:	5b                   	pop    %ebx
+  801a66:	5e                   	pop    %esi
+  801a67:	5f                   	pop    %edi
+  801a68:	5d                   	pop    %ebp
+  801a69:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a6a:	83 ec 0c             	sub    $0xc,%esp
+  801a6d:	6a 01                	push   $0x1
+  801a6f:	e8 be 22 00 00       	call   803d32 <ipc_find_env>
+  801a74:	a3 c8 a0 80 00       	mov    %eax,0x80a0c8
+  801a79:	83 c4 10             	add    $0x10,%esp
+  801a7c:	eb c6                	jmp    801a44 <fsipcv+0x18>
+
+00801a7e <fsipc>:
+{
+  801a7e:	55                   	push   %ebp
+  801a7f:	89 e5                	mov    %esp,%ebp
+  801a81:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801a84:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801a8b:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801a8e:	e8 99 ff ff ff       	call   801a2c <fsipcv>
+}
+  801a93:	c9                   	leave
+  801a94:	c3                   	ret
+
+00801a95 <file_write_direct>:
+{
+  801a95:	55                   	push   %ebp
+  801a96:	89 e5                	mov    %esp,%ebp
+  801a98:	56                   	push   %esi
+  801a99:	53                   	push   %ebx
+  801a9a:	89 c3                	mov    %eax,%ebx
+  801a9c:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801a9e:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801aa4:	77 40                	ja     801ae6 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801aa6:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801aab:	39 c8                	cmp    %ecx,%eax
+  801aad:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ab0:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801ab3:	89 0d 00 90 80 00    	mov    %ecx,0x809000
+	fsipcbuf.write.req_n = n;
+  801ab9:	a3 04 90 80 00       	mov    %eax,0x809004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801abe:	83 ec 04             	sub    $0x4,%esp
+  801ac1:	50                   	push   %eax
+  801ac2:	52                   	push   %edx
+  801ac3:	68 08 90 80 00       	push   $0x809008
+  801ac8:	e8 75 f1 ff ff       	call   800c42 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801acd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad2:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ad7:	e8 a2 ff ff ff       	call   801a7e <fsipc>
+  801adc:	83 c4 10             	add    $0x10,%esp
+}
+  801adf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae2:	5b                   	pop    %ebx
+  801ae3:	5e                   	pop    %esi
+  801ae4:	5d                   	pop    %ebp
+  801ae5:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801ae6:	89 d6                	mov    %edx,%esi
+  801ae8:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801aee:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801af3:	29 f1                	sub    %esi,%ecx
+  801af5:	39 c1                	cmp    %eax,%ecx
+  801af7:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801afa:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801afd:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.bulk.req_n = n;
+  801b02:	89 0d 04 90 80 00    	mov    %ecx,0x809004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801b08:	89 35 08 90 80 00    	mov    %esi,0x809008
+	return fsipc_pages(type, buf, n, perm);
+  801b0e:	83 ec 0c             	sub    $0xc,%esp
+  801b11:	6a 05                	push   $0x5
+  801b13:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801b18:	e8 bf fd ff ff       	call   8018dc <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801b1d:	83 c4 10             	add    $0x10,%esp
+  801b20:	eb bd                	jmp    801adf <file_write_direct+0x4a>
+
+00801b22 <devfile_sync>:
+{
+  801b22:	55                   	push   %ebp
+  801b23:	89 e5                	mov    %esp,%ebp
+  801b25:	57                   	push   %edi
+  801b26:	56                   	push   %esi
+  801b27:	53                   	push   %ebx
+  801b28:	83 ec 28             	sub    $0x28,%esp
+  801b2b:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801b2e:	56                   	push   %esi
+  801b2f:	e8 a5 f7 ff ff       	call   8012d9 <fd2data>
+  801b34:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801b36:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801b39:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801b40:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801b43:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801b48:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801b4c:	74 45                	je     801b93 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801b4e:	8b 46 14             	mov    0x14(%esi),%eax
+  801b51:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b59:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b5e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801b61:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801b64:	39 cb                	cmp    %ecx,%ebx
+  801b66:	73 14                	jae    801b7c <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801b68:	29 d9                	sub    %ebx,%ecx
+  801b6a:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801b6d:	89 f0                	mov    %esi,%eax
+  801b6f:	e8 21 ff ff ff       	call   801a95 <file_write_direct>
+  801b74:	85 c0                	test   %eax,%eax
+  801b76:	7e 04                	jle    801b7c <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801b78:	01 c3                	add    %eax,%ebx
+  801b7a:	eb e5                	jmp    801b61 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801b7c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801b7f:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801b86:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801b89:	85 c0                	test   %eax,%eax
+  801b8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b90:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801b93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b96:	5b                   	pop    %ebx
+  801b97:	5e                   	pop    %esi
+  801b98:	5f                   	pop    %edi
+  801b99:	5d                   	pop    %ebp
+  801b9a:	c3                   	ret
+
+00801b9b <devfile_write>:
+{
+  801b9b:	55                   	push   %ebp
+  801b9c:	89 e5                	mov    %esp,%ebp
+  801b9e:	57                   	push   %edi
+  801b9f:	56                   	push   %esi
+  801ba0:	53                   	push   %ebx
+  801ba1:	83 ec 28             	sub    $0x28,%esp
+  801ba4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ba7:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801baa:	53                   	push   %ebx
+  801bab:	e8 29 f7 ff ff       	call   8012d9 <fd2data>
+  801bb0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801bb3:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801bb6:	83 c4 10             	add    $0x10,%esp
+  801bb9:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801bbd:	74 43                	je     801c02 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801bbf:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801bc6:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801bc9:	85 c0                	test   %eax,%eax
+  801bcb:	74 43                	je     801c10 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801bcd:	89 c2                	mov    %eax,%edx
+  801bcf:	03 53 14             	add    0x14(%ebx),%edx
+  801bd2:	39 fa                	cmp    %edi,%edx
+  801bd4:	75 0b                	jne    801be1 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801bd6:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801bd9:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801bdf:	76 66                	jbe    801c47 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801be1:	83 ec 0c             	sub    $0xc,%esp
+  801be4:	53                   	push   %ebx
+  801be5:	e8 38 ff ff ff       	call   801b22 <devfile_sync>
+  801bea:	83 c4 10             	add    $0x10,%esp
+  801bed:	85 c0                	test   %eax,%eax
+  801bef:	78 4e                	js     801c3f <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801bf1:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801bf7:	77 56                	ja     801c4f <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801bf9:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801bfc:	85 c0                	test   %eax,%eax
+  801bfe:	75 20                	jne    801c20 <devfile_write+0x85>
+  801c00:	eb 16                	jmp    801c18 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801c02:	89 f1                	mov    %esi,%ecx
+  801c04:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c07:	89 d8                	mov    %ebx,%eax
+  801c09:	e8 87 fe ff ff       	call   801a95 <file_write_direct>
+  801c0e:	eb 2f                	jmp    801c3f <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801c10:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801c16:	77 37                	ja     801c4f <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801c18:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801c20:	83 ec 04             	sub    $0x4,%esp
+  801c23:	56                   	push   %esi
+  801c24:	ff 75 0c             	push   0xc(%ebp)
+  801c27:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801c2a:	01 c1                	add    %eax,%ecx
+  801c2c:	51                   	push   %ecx
+  801c2d:	e8 10 f0 ff ff       	call   800c42 <memmove>
+	ff->buf_wlen += n;
+  801c32:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801c35:	01 f7                	add    %esi,%edi
+  801c37:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801c3a:	89 f0                	mov    %esi,%eax
+  801c3c:	83 c4 10             	add    $0x10,%esp
+}
+  801c3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c42:	5b                   	pop    %ebx
+  801c43:	5e                   	pop    %esi
+  801c44:	5f                   	pop    %edi
+  801c45:	5d                   	pop    %ebp
+  801c46:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801c47:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801c4d:	76 d1                	jbe    801c20 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801c4f:	89 f1                	mov    %esi,%ecx
+  801c51:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c54:	89 d8                	mov    %ebx,%eax
+  801c56:	e8 3a fe ff ff       	call   801a95 <file_write_direct>
+  801c5b:	eb e2                	jmp    801c3f <devfile_write+0xa4>
+
+00801c5d <devfile_trunc>:
+{
+  801c5d:	55                   	push   %ebp
+  801c5e:	89 e5                	mov    %esp,%ebp
+  801c60:	53                   	push   %ebx
+  801c61:	83 ec 10             	sub    $0x10,%esp
+  801c64:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801c67:	53                   	push   %ebx
+  801c68:	e8 b5 fe ff ff       	call   801b22 <devfile_sync>
+  801c6d:	83 c4 10             	add    $0x10,%esp
+  801c70:	85 c0                	test   %eax,%eax
+  801c72:	78 1f                	js     801c93 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801c74:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c77:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.set_size.req_size = newsize;
+  801c7c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c7f:	a3 04 90 80 00       	mov    %eax,0x809004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801c84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c89:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c8e:	e8 eb fd ff ff       	call   801a7e <fsipc>
+}
+  801c93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c96:	c9                   	leave
+  801c97:	c3                   	ret
+
+00801c98 <devfile_stat>:
+{
+  801c98:	55                   	push   %ebp
+  801c99:	89 e5                	mov    %esp,%ebp
+  801c9b:	56                   	push   %esi
+  801c9c:	53                   	push   %ebx
+  801c9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ca0:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801ca3:	83 ec 0c             	sub    $0xc,%esp
+  801ca6:	53                   	push   %ebx
+  801ca7:	e8 76 fe ff ff       	call   801b22 <devfile_sync>
+  801cac:	83 c4 10             	add    $0x10,%esp
+  801caf:	85 c0                	test   %eax,%eax
+  801cb1:	78 47                	js     801cfa <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801cb3:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801cb6:	a3 00 90 80 00       	mov    %eax,0x809000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801cbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc0:	b8 05 00 00 00       	mov    $0x5,%eax
+  801cc5:	e8 b4 fd ff ff       	call   801a7e <fsipc>
+  801cca:	85 c0                	test   %eax,%eax
+  801ccc:	78 2c                	js     801cfa <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801cce:	83 ec 08             	sub    $0x8,%esp
+  801cd1:	68 00 90 80 00       	push   $0x809000
+  801cd6:	56                   	push   %esi
+  801cd7:	e8 e0 ed ff ff       	call   800abc <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801cdc:	a1 80 90 80 00       	mov    0x809080,%eax
+  801ce1:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ce7:	a1 84 90 80 00       	mov    0x809084,%eax
+  801cec:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801cf2:	83 c4 10             	add    $0x10,%esp
+  801cf5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cfa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cfd:	5b                   	pop    %ebx
+  801cfe:	5e                   	pop    %esi
+  801cff:	5d                   	pop    %ebp
+  801d00:	c3                   	ret
+
+00801d01 <devfile_flush>:
+{
+  801d01:	55                   	push   %ebp
+  801d02:	89 e5                	mov    %esp,%ebp
+  801d04:	56                   	push   %esi
+  801d05:	53                   	push   %ebx
+  801d06:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801d09:	83 ec 0c             	sub    $0xc,%esp
+  801d0c:	56                   	push   %esi
+  801d0d:	e8 10 fe ff ff       	call   801b22 <devfile_sync>
+  801d12:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801d14:	83 c4 10             	add    $0x10,%esp
+  801d17:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801d1b:	75 25                	jne    801d42 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d1d:	8b 46 0c             	mov    0xc(%esi),%eax
+  801d20:	a3 00 90 80 00       	mov    %eax,0x809000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801d25:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d2a:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d2f:	e8 4a fd ff ff       	call   801a7e <fsipc>
+  801d34:	85 c0                	test   %eax,%eax
+  801d36:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801d39:	89 d8                	mov    %ebx,%eax
+  801d3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d3e:	5b                   	pop    %ebx
+  801d3f:	5e                   	pop    %esi
+  801d40:	5d                   	pop    %ebp
+  801d41:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801d42:	83 ec 0c             	sub    $0xc,%esp
+  801d45:	56                   	push   %esi
+  801d46:	e8 8e f5 ff ff       	call   8012d9 <fd2data>
+  801d4b:	83 c4 08             	add    $0x8,%esp
+  801d4e:	50                   	push   %eax
+  801d4f:	6a 00                	push   $0x0
+  801d51:	e8 ff f1 ff ff       	call   800f55 <sys_page_unmap>
+  801d56:	83 c4 10             	add    $0x10,%esp
+  801d59:	eb c2                	jmp    801d1d <devfile_flush+0x1c>
+
+00801d5b <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801d5b:	55                   	push   %ebp
+  801d5c:	89 e5                	mov    %esp,%ebp
+  801d5e:	57                   	push   %edi
+  801d5f:	56                   	push   %esi
+  801d60:	53                   	push   %ebx
+  801d61:	83 ec 64             	sub    $0x64,%esp
+  801d64:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801d66:	52                   	push   %edx
+  801d67:	50                   	push   %eax
+  801d68:	e8 d9 f5 ff ff       	call   801346 <fd_lookup>
+  801d6d:	89 c1                	mov    %eax,%ecx
+  801d6f:	83 c4 10             	add    $0x10,%esp
+  801d72:	85 c0                	test   %eax,%eax
+  801d74:	0f 88 f2 00 00 00    	js     801e6c <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801d7a:	8b 07                	mov    (%edi),%eax
+  801d7c:	8b 15 c0 67 80 00    	mov    0x8067c0,%edx
+  801d82:	39 10                	cmp    %edx,(%eax)
+  801d84:	0f 85 03 01 00 00    	jne    801e8d <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801d8a:	a1 70 87 80 00       	mov    0x808770,%eax
+  801d8f:	8b 40 48             	mov    0x48(%eax),%eax
+  801d92:	3b 05 c4 a0 80 00    	cmp    0x80a0c4,%eax
+  801d98:	0f 84 96 00 00 00    	je     801e34 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801d9e:	83 3d c8 a0 80 00 00 	cmpl   $0x0,0x80a0c8
+  801da5:	0f 84 cb 00 00 00    	je     801e76 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801dab:	b8 00 90 80 00       	mov    $0x809000,%eax
+  801db0:	83 c8 07             	or     $0x7,%eax
+  801db3:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801db6:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801db9:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801dbe:	83 ec 04             	sub    $0x4,%esp
+  801dc1:	68 07 04 00 00       	push   $0x407
+  801dc6:	53                   	push   %ebx
+  801dc7:	6a 00                	push   $0x0
+  801dc9:	e8 fa f0 ff ff       	call   800ec8 <sys_page_alloc>
+  801dce:	89 c1                	mov    %eax,%ecx
+  801dd0:	83 c4 10             	add    $0x10,%esp
+  801dd3:	85 c0                	test   %eax,%eax
+  801dd5:	0f 88 91 00 00 00    	js     801e6c <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801ddb:	89 d8                	mov    %ebx,%eax
+  801ddd:	83 c8 07             	or     $0x7,%eax
+  801de0:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801de2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801de8:	83 c6 04             	add    $0x4,%esi
+  801deb:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801df1:	75 cb                	jne    801dbe <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801df3:	6a 12                	push   $0x12
+  801df5:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801df8:	50                   	push   %eax
+  801df9:	6a 0c                	push   $0xc
+  801dfb:	ff 35 c8 a0 80 00    	push   0x80a0c8
+  801e01:	e8 de 1e 00 00       	call   803ce4 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801e06:	83 c4 0c             	add    $0xc,%esp
+  801e09:	6a 00                	push   $0x0
+  801e0b:	6a 00                	push   $0x0
+  801e0d:	6a 00                	push   $0x0
+  801e0f:	e8 7a 1d 00 00       	call   803b8e <ipc_recv>
+  801e14:	89 c1                	mov    %eax,%ecx
+  801e16:	83 c4 10             	add    $0x10,%esp
+  801e19:	85 c0                	test   %eax,%eax
+  801e1b:	78 4f                	js     801e6c <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801e1d:	a1 70 87 80 00       	mov    0x808770,%eax
+  801e22:	8b 40 48             	mov    0x48(%eax),%eax
+  801e25:	a3 c4 a0 80 00       	mov    %eax,0x80a0c4
+	fsring_busy = 0;
+  801e2a:	c7 05 c0 a0 80 00 00 	movl   $0x0,0x80a0c0
+  801e31:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801e34:	83 ec 0c             	sub    $0xc,%esp
+  801e37:	ff 37                	push   (%edi)
+  801e39:	e8 e4 fc ff ff       	call   801b22 <devfile_sync>
+  801e3e:	89 c1                	mov    %eax,%ecx
+  801e40:	83 c4 10             	add    $0x10,%esp
+  801e43:	85 c0                	test   %eax,%eax
+  801e45:	78 25                	js     801e6c <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801e47:	8b 1d c0 a0 80 00    	mov    0x80a0c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801e4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801e52:	ba 01 00 00 00       	mov    $0x1,%edx
+  801e57:	89 d0                	mov    %edx,%eax
+  801e59:	d3 e0                	shl    %cl,%eax
+  801e5b:	85 d8                	test   %ebx,%eax
+  801e5d:	74 0d                	je     801e6c <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801e5f:	83 c1 01             	add    $0x1,%ecx
+  801e62:	83 f9 10             	cmp    $0x10,%ecx
+  801e65:	75 f0                	jne    801e57 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801e67:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801e6c:	89 c8                	mov    %ecx,%eax
+  801e6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e71:	5b                   	pop    %ebx
+  801e72:	5e                   	pop    %esi
+  801e73:	5f                   	pop    %edi
+  801e74:	5d                   	pop    %ebp
+  801e75:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e76:	83 ec 0c             	sub    $0xc,%esp
+  801e79:	6a 01                	push   $0x1
+  801e7b:	e8 b2 1e 00 00       	call   803d32 <ipc_find_env>
+  801e80:	a3 c8 a0 80 00       	mov    %eax,0x80a0c8
+  801e85:	83 c4 10             	add    $0x10,%esp
+  801e88:	e9 1e ff ff ff       	jmp    801dab <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801e8d:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801e92:	eb d8                	jmp    801e6c <fsring_slot+0x111>
+
+00801e94 <file_read_direct>:
+{
+  801e94:	55                   	push   %ebp
+  801e95:	89 e5                	mov    %esp,%ebp
+  801e97:	57                   	push   %edi
+  801e98:	56                   	push   %esi
+  801e99:	53                   	push   %ebx
+  801e9a:	83 ec 1c             	sub    $0x1c,%esp
+  801e9d:	89 c7                	mov    %eax,%edi
+  801e9f:	89 d6                	mov    %edx,%esi
+  801ea1:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801ea3:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801ea9:	77 52                	ja     801efd <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801eab:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eae:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.read.req_n = n;
+  801eb3:	89 0d 04 90 80 00    	mov    %ecx,0x809004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801eb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ebe:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ec3:	e8 b6 fb ff ff       	call   801a7e <fsipc>
+  801ec8:	89 c7                	mov    %eax,%edi
+  801eca:	85 c0                	test   %eax,%eax
+  801ecc:	78 25                	js     801ef3 <file_read_direct+0x5f>
+	assert(r <= n);
+  801ece:	39 c3                	cmp    %eax,%ebx
+  801ed0:	0f 82 87 00 00 00    	jb     801f5d <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801ed6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801edb:	0f 8f 95 00 00 00    	jg     801f76 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801ee1:	83 ec 04             	sub    $0x4,%esp
+  801ee4:	50                   	push   %eax
+  801ee5:	68 00 90 80 00       	push   $0x809000
+  801eea:	56                   	push   %esi
+  801eeb:	e8 52 ed ff ff       	call   800c42 <memmove>
+	return r;
+  801ef0:	83 c4 10             	add    $0x10,%esp
+}
+  801ef3:	89 f8                	mov    %edi,%eax
+  801ef5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ef8:	5b                   	pop    %ebx
+  801ef9:	5e                   	pop    %esi
+  801efa:	5f                   	pop    %edi
+  801efb:	5d                   	pop    %ebp
+  801efc:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801efd:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801f03:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801f08:	29 d1                	sub    %edx,%ecx
+  801f0a:	39 d9                	cmp    %ebx,%ecx
+  801f0c:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801f0f:	89 f0                	mov    %esi,%eax
+  801f11:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801f14:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801f17:	eb 0f                	jmp    801f28 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801f19:	0f b6 10             	movzbl (%eax),%edx
+  801f1c:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801f1e:	05 00 10 00 00       	add    $0x1000,%eax
+  801f23:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f28:	39 c8                	cmp    %ecx,%eax
+  801f2a:	72 ed                	jb     801f19 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801f2c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f2f:	8b 47 0c             	mov    0xc(%edi),%eax
+  801f32:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.bulk.req_n = n;
+  801f37:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801f3d:	89 15 08 90 80 00    	mov    %edx,0x809008
+	return fsipc_pages(type, buf, n, perm);
+  801f43:	83 ec 0c             	sub    $0xc,%esp
+  801f46:	6a 07                	push   $0x7
+  801f48:	89 d9                	mov    %ebx,%ecx
+  801f4a:	89 f2                	mov    %esi,%edx
+  801f4c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f51:	e8 86 f9 ff ff       	call   8018dc <fsipc_pages>
+  801f56:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801f58:	83 c4 10             	add    $0x10,%esp
+  801f5b:	eb 96                	jmp    801ef3 <file_read_direct+0x5f>
+	assert(r <= n);
+  801f5d:	68 20 46 80 00       	push   $0x804620
+  801f62:	68 00 46 80 00       	push   $0x804600
+  801f67:	68 dc 00 00 00       	push   $0xdc
+  801f6c:	68 15 46 80 00       	push   $0x804615
+  801f71:	e8 7d e4 ff ff       	call   8003f3 <_panic>
+	assert(r <= PGSIZE);
+  801f76:	68 31 46 80 00       	push   $0x804631
+  801f7b:	68 00 46 80 00       	push   $0x804600
+  801f80:	68 dd 00 00 00       	push   $0xdd
+  801f85:	68 15 46 80 00       	push   $0x804615
+  801f8a:	e8 64 e4 ff ff       	call   8003f3 <_panic>
+
+00801f8f <devfile_read>:
+{
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+  801f92:	57                   	push   %edi
+  801f93:	56                   	push   %esi
+  801f94:	53                   	push   %ebx
+  801f95:	83 ec 28             	sub    $0x28,%esp
+  801f98:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f9b:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801f9e:	53                   	push   %ebx
+  801f9f:	e8 35 f3 ff ff       	call   8012d9 <fd2data>
+  801fa4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801fa7:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801faa:	83 c4 10             	add    $0x10,%esp
+  801fad:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801fb1:	74 7d                	je     802030 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801fb3:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801fb7:	0f 85 81 00 00 00    	jne    80203e <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801fbd:	8b 43 18             	mov    0x18(%ebx),%eax
+  801fc0:	85 c0                	test   %eax,%eax
+  801fc2:	74 0d                	je     801fd1 <devfile_read+0x42>
+  801fc4:	8b 53 14             	mov    0x14(%ebx),%edx
+  801fc7:	39 fa                	cmp    %edi,%edx
+  801fc9:	7f 06                	jg     801fd1 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801fcb:	01 c2                	add    %eax,%edx
+  801fcd:	39 d7                	cmp    %edx,%edi
+  801fcf:	72 28                	jb     801ff9 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801fd1:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801fd8:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801fde:	77 74                	ja     802054 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801fe0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801fe5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fe8:	89 d8                	mov    %ebx,%eax
+  801fea:	e8 a5 fe ff ff       	call   801e94 <file_read_direct>
+  801fef:	85 c0                	test   %eax,%eax
+  801ff1:	7e 35                	jle    802028 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801ff3:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801ff6:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801ff9:	8b 53 14             	mov    0x14(%ebx),%edx
+  801ffc:	89 d0                	mov    %edx,%eax
+  801ffe:	03 43 18             	add    0x18(%ebx),%eax
+  802001:	29 f8                	sub    %edi,%eax
+  802003:	39 f0                	cmp    %esi,%eax
+  802005:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  802008:	83 ec 04             	sub    $0x4,%esp
+  80200b:	56                   	push   %esi
+  80200c:	89 f8                	mov    %edi,%eax
+  80200e:	29 d0                	sub    %edx,%eax
+  802010:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802013:	01 c1                	add    %eax,%ecx
+  802015:	51                   	push   %ecx
+  802016:	ff 75 0c             	push   0xc(%ebp)
+  802019:	e8 24 ec ff ff       	call   800c42 <memmove>
+	fd->fd_offset = pos + n;
+  80201e:	01 f7                	add    %esi,%edi
+  802020:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802023:	89 f0                	mov    %esi,%eax
+  802025:	83 c4 10             	add    $0x10,%esp
+}
+  802028:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80202b:	5b                   	pop    %ebx
+  80202c:	5e                   	pop    %esi
+  80202d:	5f                   	pop    %edi
+  80202e:	5d                   	pop    %ebp
+  80202f:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802030:	89 f1                	mov    %esi,%ecx
+  802032:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802035:	89 d8                	mov    %ebx,%eax
+  802037:	e8 58 fe ff ff       	call   801e94 <file_read_direct>
+  80203c:	eb ea                	jmp    802028 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80203e:	83 ec 0c             	sub    $0xc,%esp
+  802041:	53                   	push   %ebx
+  802042:	e8 db fa ff ff       	call   801b22 <devfile_sync>
+  802047:	83 c4 10             	add    $0x10,%esp
+  80204a:	85 c0                	test   %eax,%eax
+  80204c:	0f 89 6b ff ff ff    	jns    801fbd <devfile_read+0x2e>
+  802052:	eb d4                	jmp    802028 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  802054:	89 f1                	mov    %esi,%ecx
+  802056:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802059:	89 d8                	mov    %ebx,%eax
+  80205b:	e8 34 fe ff ff       	call   801e94 <file_read_direct>
+  802060:	eb c6                	jmp    802028 <devfile_read+0x99>
+
+00802062 <open>:
+{
+  802062:	55                   	push   %ebp
+  802063:	89 e5                	mov    %esp,%ebp
+  802065:	56                   	push   %esi
+  802066:	53                   	push   %ebx
+  802067:	83 ec 1c             	sub    $0x1c,%esp
+  80206a:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80206d:	56                   	push   %esi
+  80206e:	e8 0e ea ff ff       	call   800a81 <strlen>
+  802073:	83 c4 10             	add    $0x10,%esp
+  802076:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80207b:	0f 8f a0 00 00 00    	jg     802121 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  802081:	83 ec 0c             	sub    $0xc,%esp
+  802084:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802087:	50                   	push   %eax
+  802088:	e8 63 f2 ff ff       	call   8012f0 <fd_alloc>
+  80208d:	89 c3                	mov    %eax,%ebx
+  80208f:	83 c4 10             	add    $0x10,%esp
+  802092:	85 c0                	test   %eax,%eax
+  802094:	78 45                	js     8020db <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  802096:	83 ec 08             	sub    $0x8,%esp
+  802099:	56                   	push   %esi
+  80209a:	68 00 90 80 00       	push   $0x809000
+  80209f:	e8 18 ea ff ff       	call   800abc <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8020a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020a7:	a3 00 94 80 00       	mov    %eax,0x809400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020ac:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020b4:	e8 c5 f9 ff ff       	call   801a7e <fsipc>
+  8020b9:	89 c3                	mov    %eax,%ebx
+  8020bb:	83 c4 10             	add    $0x10,%esp
+  8020be:	85 c0                	test   %eax,%eax
+  8020c0:	78 22                	js     8020e4 <open+0x82>
+	if (!(mode & O_NOBUF)
+  8020c2:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8020c9:	74 2b                	je     8020f6 <open+0x94>
+	return fd2num(fd);
+  8020cb:	83 ec 0c             	sub    $0xc,%esp
+  8020ce:	ff 75 f4             	push   -0xc(%ebp)
+  8020d1:	e8 f3 f1 ff ff       	call   8012c9 <fd2num>
+  8020d6:	89 c3                	mov    %eax,%ebx
+  8020d8:	83 c4 10             	add    $0x10,%esp
+}
+  8020db:	89 d8                	mov    %ebx,%eax
+  8020dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020e0:	5b                   	pop    %ebx
+  8020e1:	5e                   	pop    %esi
+  8020e2:	5d                   	pop    %ebp
+  8020e3:	c3                   	ret
+		fd_close(fd, 0);
+  8020e4:	83 ec 08             	sub    $0x8,%esp
+  8020e7:	6a 00                	push   $0x0
+  8020e9:	ff 75 f4             	push   -0xc(%ebp)
+  8020ec:	e8 f8 f2 ff ff       	call   8013e9 <fd_close>
+		return r;
+  8020f1:	83 c4 10             	add    $0x10,%esp
+  8020f4:	eb e5                	jmp    8020db <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8020f6:	83 ec 0c             	sub    $0xc,%esp
+  8020f9:	ff 75 f4             	push   -0xc(%ebp)
+  8020fc:	e8 d8 f1 ff ff       	call   8012d9 <fd2data>
+  802101:	83 c4 0c             	add    $0xc,%esp
+  802104:	68 07 04 00 00       	push   $0x407
+  802109:	50                   	push   %eax
+  80210a:	6a 00                	push   $0x0
+  80210c:	e8 b7 ed ff ff       	call   800ec8 <sys_page_alloc>
+  802111:	83 c4 10             	add    $0x10,%esp
+  802114:	85 c0                	test   %eax,%eax
+  802116:	75 b3                	jne    8020cb <open+0x69>
+		fd->fd_file.buffered = 1;
+  802118:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80211b:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  80211f:	eb aa                	jmp    8020cb <open+0x69>
+		return -E_BAD_PATH;
+  802121:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802126:	eb b3                	jmp    8020db <open+0x79>
+
+00802128 <readdir>:
+{
+  802128:	55                   	push   %ebp
+  802129:	89 e5                	mov    %esp,%ebp
+  80212b:	53                   	push   %ebx
+  80212c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80212f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802132:	50                   	push   %eax
+  802133:	ff 75 08             	push   0x8(%ebp)
+  802136:	e8 0b f2 ff ff       	call   801346 <fd_lookup>
+  80213b:	89 c3                	mov    %eax,%ebx
+  80213d:	83 c4 10             	add    $0x10,%esp
+  802140:	85 c0                	test   %eax,%eax
+  802142:	78 73                	js     8021b7 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802144:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802147:	8b 0d c0 67 80 00    	mov    0x8067c0,%ecx
+  80214d:	39 08                	cmp    %ecx,(%eax)
+  80214f:	0f 85 82 00 00 00    	jne    8021d7 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802155:	83 ec 0c             	sub    $0xc,%esp
+  802158:	50                   	push   %eax
+  802159:	e8 c4 f9 ff ff       	call   801b22 <devfile_sync>
+  80215e:	89 c3                	mov    %eax,%ebx
+  802160:	83 c4 10             	add    $0x10,%esp
+  802163:	85 c0                	test   %eax,%eax
+  802165:	78 50                	js     8021b7 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802167:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80216a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80216d:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.readdir.req_n = n;
+  802172:	8b 45 10             	mov    0x10(%ebp),%eax
+  802175:	a3 04 90 80 00       	mov    %eax,0x809004
+	fsipcbuf.readdir.req_flags = flags;
+  80217a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80217d:	a3 08 90 80 00       	mov    %eax,0x809008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  802182:	ba 00 00 00 00       	mov    $0x0,%edx
+  802187:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80218c:	e8 ed f8 ff ff       	call   801a7e <fsipc>
+  802191:	89 c3                	mov    %eax,%ebx
+  802193:	85 c0                	test   %eax,%eax
+  802195:	7e 20                	jle    8021b7 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  802197:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80219a:	72 22                	jb     8021be <readdir+0x96>
+  80219c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8021a1:	7f 1b                	jg     8021be <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8021a3:	83 ec 04             	sub    $0x4,%esp
+  8021a6:	50                   	push   %eax
+  8021a7:	68 00 90 80 00       	push   $0x809000
+  8021ac:	ff 75 0c             	push   0xc(%ebp)
+  8021af:	e8 8e ea ff ff       	call   800c42 <memmove>
+	return r;
+  8021b4:	83 c4 10             	add    $0x10,%esp
+}
+  8021b7:	89 d8                	mov    %ebx,%eax
+  8021b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021bc:	c9                   	leave
+  8021bd:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8021be:	68 27 46 80 00       	push   $0x804627
+  8021c3:	68 00 46 80 00       	push   $0x804600
+  8021c8:	68 86 01 00 00       	push   $0x186
+  8021cd:	68 15 46 80 00       	push   $0x804615
+  8021d2:	e8 1c e2 ff ff       	call   8003f3 <_panic>
+		return -E_NOT_SUPP;
+  8021d7:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8021dc:	eb d9                	jmp    8021b7 <readdir+0x8f>
+
+008021de <munmap>:
+{
+  8021de:	55                   	push   %ebp
+  8021df:	89 e5                	mov    %esp,%ebp
+  8021e1:	56                   	push   %esi
+  8021e2:	53                   	push   %ebx
+  8021e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8021e9:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8021ef:	75 41                	jne    802232 <munmap+0x54>
+  8021f1:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8021f7:	77 39                	ja     802232 <munmap+0x54>
+  8021f9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021fe:	29 f0                	sub    %esi,%eax
+  802200:	39 d0                	cmp    %edx,%eax
+  802202:	72 35                	jb     802239 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802204:	89 f3                	mov    %esi,%ebx
+  802206:	01 d6                	add    %edx,%esi
+  802208:	39 f3                	cmp    %esi,%ebx
+  80220a:	73 1a                	jae    802226 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  80220c:	83 ec 08             	sub    $0x8,%esp
+  80220f:	53                   	push   %ebx
+  802210:	6a 00                	push   $0x0
+  802212:	e8 3e ed ff ff       	call   800f55 <sys_page_unmap>
+  802217:	83 c4 10             	add    $0x10,%esp
+  80221a:	85 c0                	test   %eax,%eax
+  80221c:	78 0d                	js     80222b <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80221e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802224:	eb e2                	jmp    802208 <munmap+0x2a>
+	return 0;
+  802226:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80222b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80222e:	5b                   	pop    %ebx
+  80222f:	5e                   	pop    %esi
+  802230:	5d                   	pop    %ebp
+  802231:	c3                   	ret
+		return -E_INVAL;
+  802232:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802237:	eb f2                	jmp    80222b <munmap+0x4d>
+  802239:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80223e:	eb eb                	jmp    80222b <munmap+0x4d>
+
+00802240 <mmap>:
+{
+  802240:	55                   	push   %ebp
+  802241:	89 e5                	mov    %esp,%ebp
+  802243:	57                   	push   %edi
+  802244:	56                   	push   %esi
+  802245:	53                   	push   %ebx
+  802246:	83 ec 34             	sub    $0x34,%esp
+  802249:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80224c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80224f:	50                   	push   %eax
+  802250:	ff 75 18             	push   0x18(%ebp)
+  802253:	e8 ee f0 ff ff       	call   801346 <fd_lookup>
+  802258:	89 c3                	mov    %eax,%ebx
+  80225a:	83 c4 10             	add    $0x10,%esp
+  80225d:	85 c0                	test   %eax,%eax
+  80225f:	0f 88 0e 01 00 00    	js     802373 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802265:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802268:	a1 c0 67 80 00       	mov    0x8067c0,%eax
+  80226d:	39 02                	cmp    %eax,(%edx)
+  80226f:	0f 85 50 01 00 00    	jne    8023c5 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802275:	8b 45 10             	mov    0x10(%ebp),%eax
+  802278:	83 e0 02             	and    $0x2,%eax
+  80227b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80227e:	74 0a                	je     80228a <mmap+0x4a>
+  802280:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802284:	0f 84 42 01 00 00    	je     8023cc <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  80228a:	8b 42 08             	mov    0x8(%edx),%eax
+  80228d:	83 e0 03             	and    $0x3,%eax
+  802290:	83 f8 01             	cmp    $0x1,%eax
+  802293:	0f 84 3a 01 00 00    	je     8023d3 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802299:	8b 45 08             	mov    0x8(%ebp),%eax
+  80229c:	0b 45 1c             	or     0x1c(%ebp),%eax
+  80229f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8022a4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8022a7:	0f 85 2d 01 00 00    	jne    8023da <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8022ad:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8022b1:	0f 88 2a 01 00 00    	js     8023e1 <mmap+0x1a1>
+  8022b7:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8022be:	0f 87 1d 01 00 00    	ja     8023e1 <mmap+0x1a1>
+  8022c4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8022c9:	2b 45 08             	sub    0x8(%ebp),%eax
+  8022cc:	39 f8                	cmp    %edi,%eax
+  8022ce:	0f 82 14 01 00 00    	jb     8023e8 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8022d4:	83 ec 0c             	sub    $0xc,%esp
+  8022d7:	52                   	push   %edx
+  8022d8:	e8 45 f8 ff ff       	call   801b22 <devfile_sync>
+  8022dd:	89 c3                	mov    %eax,%ebx
+  8022df:	83 c4 10             	add    $0x10,%esp
+  8022e2:	85 c0                	test   %eax,%eax
+  8022e4:	0f 88 89 00 00 00    	js     802373 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8022ea:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8022f0:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8022f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8022fb:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8022fe:	39 fe                	cmp    %edi,%esi
+  802300:	73 7b                	jae    80237d <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  802302:	89 f8                	mov    %edi,%eax
+  802304:	29 f0                	sub    %esi,%eax
+  802306:	c1 e8 0c             	shr    $0xc,%eax
+  802309:	ba 40 00 00 00       	mov    $0x40,%edx
+  80230e:	39 d0                	cmp    %edx,%eax
+  802310:	0f 47 c2             	cmova  %edx,%eax
+  802313:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802316:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802319:	8b 52 0c             	mov    0xc(%edx),%edx
+  80231c:	89 15 00 90 80 00    	mov    %edx,0x809000
+		fsipcbuf.map.req_offset = offset + done;
+  802322:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802325:	89 15 04 90 80 00    	mov    %edx,0x809004
+		fsipcbuf.map.req_npages = n;
+  80232b:	a3 08 90 80 00       	mov    %eax,0x809008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802330:	89 f2                	mov    %esi,%edx
+  802332:	03 55 08             	add    0x8(%ebp),%edx
+  802335:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802338:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80233d:	e8 ea f6 ff ff       	call   801a2c <fsipcv>
+  802342:	85 c0                	test   %eax,%eax
+  802344:	7e 12                	jle    802358 <mmap+0x118>
+  802346:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802349:	85 c0                	test   %eax,%eax
+  80234b:	0f 84 9e 00 00 00    	je     8023ef <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802351:	c1 e0 0c             	shl    $0xc,%eax
+  802354:	01 c6                	add    %eax,%esi
+  802356:	eb a6                	jmp    8022fe <mmap+0xbe>
+			munmap(addr, done);
+  802358:	89 c3                	mov    %eax,%ebx
+  80235a:	83 ec 08             	sub    $0x8,%esp
+  80235d:	56                   	push   %esi
+  80235e:	ff 75 08             	push   0x8(%ebp)
+  802361:	e8 78 fe ff ff       	call   8021de <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802366:	83 c4 10             	add    $0x10,%esp
+  802369:	85 db                	test   %ebx,%ebx
+  80236b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802370:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802373:	89 d8                	mov    %ebx,%eax
+  802375:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802378:	5b                   	pop    %ebx
+  802379:	5e                   	pop    %esi
+  80237a:	5f                   	pop    %edi
+  80237b:	5d                   	pop    %ebp
+  80237c:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80237d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802380:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802382:	85 c0                	test   %eax,%eax
+  802384:	74 ed                	je     802373 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802386:	be 00 00 00 00       	mov    $0x0,%esi
+  80238b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80238e:	39 fe                	cmp    %edi,%esi
+  802390:	73 2e                	jae    8023c0 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802392:	83 ec 0c             	sub    $0xc,%esp
+  802395:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802398:	50                   	push   %eax
+  802399:	e8 f2 15 00 00       	call   803990 <cowpage>
+  80239e:	83 c4 10             	add    $0x10,%esp
+  8023a1:	85 c0                	test   %eax,%eax
+  8023a3:	78 08                	js     8023ad <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8023a5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8023ab:	eb e1                	jmp    80238e <mmap+0x14e>
+				munmap(addr, len);
+  8023ad:	89 c3                	mov    %eax,%ebx
+  8023af:	83 ec 08             	sub    $0x8,%esp
+  8023b2:	57                   	push   %edi
+  8023b3:	ff 75 08             	push   0x8(%ebp)
+  8023b6:	e8 23 fe ff ff       	call   8021de <munmap>
+				return r;
+  8023bb:	83 c4 10             	add    $0x10,%esp
+  8023be:	eb b3                	jmp    802373 <mmap+0x133>
+	return 0;
+  8023c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8023c3:	eb ae                	jmp    802373 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8023c5:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8023ca:	eb a7                	jmp    802373 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8023cc:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8023d1:	eb a0                	jmp    802373 <mmap+0x133>
+		return -E_INVAL;
+  8023d3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023d8:	eb 99                	jmp    802373 <mmap+0x133>
+  8023da:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023df:	eb 92                	jmp    802373 <mmap+0x133>
+  8023e1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023e6:	eb 8b                	jmp    802373 <mmap+0x133>
+  8023e8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023ed:	eb 84                	jmp    802373 <mmap+0x133>
+			munmap(addr, done);
+  8023ef:	83 ec 08             	sub    $0x8,%esp
+  8023f2:	56                   	push   %esi
+  8023f3:	ff 75 08             	push   0x8(%ebp)
+  8023f6:	e8 e3 fd ff ff       	call   8021de <munmap>
+  8023fb:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8023fe:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802403:	e9 6b ff ff ff       	jmp    802373 <mmap+0x133>
+
+00802408 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802408:	55                   	push   %ebp
+  802409:	89 e5                	mov    %esp,%ebp
+  80240b:	56                   	push   %esi
+  80240c:	53                   	push   %ebx
+  80240d:	83 ec 10             	sub    $0x10,%esp
+  802410:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802413:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802416:	8b 45 08             	mov    0x8(%ebp),%eax
+  802419:	e8 3d f9 ff ff       	call   801d5b <fsring_slot>
+  80241e:	85 c0                	test   %eax,%eax
+  802420:	78 60                	js     802482 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802422:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802425:	8b 56 08             	mov    0x8(%esi),%edx
+  802428:	83 e2 03             	and    $0x3,%edx
+  80242b:	83 fa 01             	cmp    $0x1,%edx
+  80242e:	74 59                	je     802489 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802430:	ba 01 00 00 00       	mov    $0x1,%edx
+  802435:	89 c1                	mov    %eax,%ecx
+  802437:	d3 e2                	shl    %cl,%edx
+  802439:	09 15 c0 a0 80 00    	or     %edx,0x80a0c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  80243f:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802442:	c1 e2 02             	shl    $0x2,%edx
+  802445:	8d 8a 00 a0 80 00    	lea    0x80a000(%edx),%ecx
+  80244b:	c7 82 00 a0 80 00 03 	movl   $0x3,0x80a000(%edx)
+  802452:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802455:	8b 55 18             	mov    0x18(%ebp),%edx
+  802458:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80245b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80245e:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802461:	83 ec 08             	sub    $0x8,%esp
+  802464:	50                   	push   %eax
+  802465:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80246a:	39 c3                	cmp    %eax,%ebx
+  80246c:	0f 47 d8             	cmova  %eax,%ebx
+  80246f:	53                   	push   %ebx
+  802470:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802473:	89 f2                	mov    %esi,%edx
+  802475:	b8 03 00 00 00       	mov    $0x3,%eax
+  80247a:	e8 1e f5 ff ff       	call   80199d <fsring_post>
+  80247f:	83 c4 10             	add    $0x10,%esp
+}
+  802482:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802485:	5b                   	pop    %ebx
+  802486:	5e                   	pop    %esi
+  802487:	5d                   	pop    %ebp
+  802488:	c3                   	ret
+		return -E_INVAL;
+  802489:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80248e:	eb f2                	jmp    802482 <fsring_read+0x7a>
+
+00802490 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802490:	55                   	push   %ebp
+  802491:	89 e5                	mov    %esp,%ebp
+  802493:	56                   	push   %esi
+  802494:	53                   	push   %ebx
+  802495:	83 ec 10             	sub    $0x10,%esp
+  802498:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80249b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80249e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024a1:	e8 b5 f8 ff ff       	call   801d5b <fsring_slot>
+  8024a6:	89 c3                	mov    %eax,%ebx
+  8024a8:	85 c0                	test   %eax,%eax
+  8024aa:	78 77                	js     802523 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8024ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024af:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8024b3:	74 77                	je     80252c <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8024b5:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8024ba:	39 c6                	cmp    %eax,%esi
+  8024bc:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8024bf:	83 ec 04             	sub    $0x4,%esp
+  8024c2:	56                   	push   %esi
+  8024c3:	ff 75 0c             	push   0xc(%ebp)
+  8024c6:	89 d8                	mov    %ebx,%eax
+  8024c8:	c1 e0 0c             	shl    $0xc,%eax
+  8024cb:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8024d1:	50                   	push   %eax
+  8024d2:	e8 6b e7 ff ff       	call   800c42 <memmove>
+	fsring_busy |= 1 << slot;
+  8024d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024dc:	89 d9                	mov    %ebx,%ecx
+  8024de:	d3 e0                	shl    %cl,%eax
+  8024e0:	09 05 c0 a0 80 00    	or     %eax,0x80a0c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8024e6:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8024e9:	c1 e0 02             	shl    $0x2,%eax
+  8024ec:	8d 90 00 a0 80 00    	lea    0x80a000(%eax),%edx
+  8024f2:	c7 80 00 a0 80 00 04 	movl   $0x4,0x80a000(%eax)
+  8024f9:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8024fc:	8b 45 18             	mov    0x18(%ebp),%eax
+  8024ff:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  802502:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802509:	83 c4 08             	add    $0x8,%esp
+  80250c:	53                   	push   %ebx
+  80250d:	56                   	push   %esi
+  80250e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802511:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802514:	b8 04 00 00 00       	mov    $0x4,%eax
+  802519:	e8 7f f4 ff ff       	call   80199d <fsring_post>
+  80251e:	89 c3                	mov    %eax,%ebx
+  802520:	83 c4 10             	add    $0x10,%esp
+}
+  802523:	89 d8                	mov    %ebx,%eax
+  802525:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802528:	5b                   	pop    %ebx
+  802529:	5e                   	pop    %esi
+  80252a:	5d                   	pop    %ebp
+  80252b:	c3                   	ret
+		return -E_INVAL;
+  80252c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802531:	eb f0                	jmp    802523 <fsring_write+0x93>
+
+00802533 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802533:	55                   	push   %ebp
+  802534:	89 e5                	mov    %esp,%ebp
+  802536:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802539:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80253c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80253f:	e8 17 f8 ff ff       	call   801d5b <fsring_slot>
+  802544:	85 c0                	test   %eax,%eax
+  802546:	78 4c                	js     802594 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802548:	ba 01 00 00 00       	mov    $0x1,%edx
+  80254d:	89 c1                	mov    %eax,%ecx
+  80254f:	d3 e2                	shl    %cl,%edx
+  802551:	09 15 c0 a0 80 00    	or     %edx,0x80a0c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802557:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80255a:	c1 e2 02             	shl    $0x2,%edx
+  80255d:	8d 8a 00 a0 80 00    	lea    0x80a000(%edx),%ecx
+  802563:	c7 82 00 a0 80 00 05 	movl   $0x5,0x80a000(%edx)
+  80256a:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80256d:	8b 55 10             	mov    0x10(%ebp),%edx
+  802570:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802573:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802576:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802579:	83 ec 08             	sub    $0x8,%esp
+  80257c:	50                   	push   %eax
+  80257d:	6a 00                	push   $0x0
+  80257f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802584:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802587:	b8 05 00 00 00       	mov    $0x5,%eax
+  80258c:	e8 0c f4 ff ff       	call   80199d <fsring_post>
+  802591:	83 c4 10             	add    $0x10,%esp
+}
+  802594:	c9                   	leave
+  802595:	c3                   	ret
+
+00802596 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802596:	55                   	push   %ebp
+  802597:	89 e5                	mov    %esp,%ebp
+  802599:	57                   	push   %edi
+  80259a:	56                   	push   %esi
+  80259b:	53                   	push   %ebx
+  80259c:	83 ec 1c             	sub    $0x1c,%esp
+  80259f:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8025a3:	a1 70 87 80 00       	mov    0x808770,%eax
+  8025a8:	8b 40 48             	mov    0x48(%eax),%eax
+  8025ab:	3b 05 c4 a0 80 00    	cmp    0x80a0c4,%eax
+  8025b1:	74 12                	je     8025c5 <fsring_reap+0x2f>
+		return 0;
+  8025b3:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8025b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025bb:	5b                   	pop    %ebx
+  8025bc:	5e                   	pop    %esi
+  8025bd:	5f                   	pop    %edi
+  8025be:	5d                   	pop    %ebp
+  8025bf:	c3                   	ret
+		sys_yield();
+  8025c0:	e8 e4 e8 ff ff       	call   800ea9 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8025c5:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8025cb:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8025d0:	39 c2                	cmp    %eax,%edx
+  8025d2:	75 18                	jne    8025ec <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8025d4:	84 db                	test   %bl,%bl
+  8025d6:	0f 84 21 01 00 00    	je     8026fd <fsring_reap+0x167>
+  8025dc:	83 3d c0 a0 80 00 00 	cmpl   $0x0,0x80a0c0
+  8025e3:	75 db                	jne    8025c0 <fsring_reap+0x2a>
+			return 0;
+  8025e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ea:	eb cc                	jmp    8025b8 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8025ec:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8025f1:	83 e0 0f             	and    $0xf,%eax
+  8025f4:	83 c0 2a             	add    $0x2a,%eax
+  8025f7:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8025fe:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802605:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80260a:	83 c0 01             	add    $0x1,%eax
+  80260d:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802612:	83 fb 0f             	cmp    $0xf,%ebx
+  802615:	77 5b                	ja     802672 <fsring_reap+0xdc>
+  802617:	be 01 00 00 00       	mov    $0x1,%esi
+  80261c:	89 d9                	mov    %ebx,%ecx
+  80261e:	d3 e6                	shl    %cl,%esi
+  802620:	89 f0                	mov    %esi,%eax
+  802622:	23 05 c0 a0 80 00    	and    0x80a0c0,%eax
+  802628:	74 48                	je     802672 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  80262a:	89 d8                	mov    %ebx,%eax
+  80262c:	c1 e0 0c             	shl    $0xc,%eax
+  80262f:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802635:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802638:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80263b:	8b 04 85 00 a0 80 00 	mov    0x80a000(,%eax,4),%eax
+  802642:	83 f8 03             	cmp    $0x3,%eax
+  802645:	74 40                	je     802687 <fsring_reap+0xf1>
+  802647:	83 f8 05             	cmp    $0x5,%eax
+  80264a:	74 64                	je     8026b0 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  80264c:	f7 d6                	not    %esi
+  80264e:	21 35 c0 a0 80 00    	and    %esi,0x80a0c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802654:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802657:	8b 14 85 04 a0 80 00 	mov    0x80a004(,%eax,4),%edx
+  80265e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802661:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802663:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802666:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802668:	b8 01 00 00 00       	mov    $0x1,%eax
+  80266d:	e9 46 ff ff ff       	jmp    8025b8 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802672:	53                   	push   %ebx
+  802673:	68 3d 46 80 00       	push   $0x80463d
+  802678:	68 8f 02 00 00       	push   $0x28f
+  80267d:	68 15 46 80 00       	push   $0x804615
+  802682:	e8 6c dd ff ff       	call   8003f3 <_panic>
+		if (cqe.cqe_result > 0)
+  802687:	85 ff                	test   %edi,%edi
+  802689:	7e c1                	jle    80264c <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80268b:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80268e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802693:	39 c7                	cmp    %eax,%edi
+  802695:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802698:	50                   	push   %eax
+  802699:	ff 75 e4             	push   -0x1c(%ebp)
+  80269c:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80269f:	ff 34 85 08 a0 80 00 	push   0x80a008(,%eax,4)
+  8026a6:	e8 97 e5 ff ff       	call   800c42 <memmove>
+  8026ab:	83 c4 10             	add    $0x10,%esp
+  8026ae:	eb 9c                	jmp    80264c <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8026b0:	85 ff                	test   %edi,%edi
+  8026b2:	75 98                	jne    80264c <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  8026b4:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8026b7:	8b 0c 85 08 a0 80 00 	mov    0x80a008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8026be:	83 ec 08             	sub    $0x8,%esp
+  8026c1:	ff 75 e4             	push   -0x1c(%ebp)
+  8026c4:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8026c7:	51                   	push   %ecx
+  8026c8:	e8 ef e3 ff ff       	call   800abc <strcpy>
+			st->st_size = ret->ret_size;
+  8026cd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8026d0:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8026d6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8026d9:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8026df:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8026e5:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8026eb:	c7 81 88 00 00 00 c0 	movl   $0x8067c0,0x88(%ecx)
+  8026f2:	67 80 00 
+  8026f5:	83 c4 10             	add    $0x10,%esp
+  8026f8:	e9 4f ff ff ff       	jmp    80264c <fsring_reap+0xb6>
+			return 0;
+  8026fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802702:	e9 b1 fe ff ff       	jmp    8025b8 <fsring_reap+0x22>
+
+00802707 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802707:	55                   	push   %ebp
+  802708:	89 e5                	mov    %esp,%ebp
+  80270a:	57                   	push   %edi
+  80270b:	56                   	push   %esi
+  80270c:	53                   	push   %ebx
+  80270d:	83 ec 28             	sub    $0x28,%esp
+  802710:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802713:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802716:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802719:	53                   	push   %ebx
+  80271a:	e8 62 e3 ff ff       	call   800a81 <strlen>
+  80271f:	83 c4 10             	add    $0x10,%esp
+  802722:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802727:	0f 8f 02 01 00 00    	jg     80282f <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  80272d:	83 ec 08             	sub    $0x8,%esp
+  802730:	53                   	push   %ebx
+  802731:	68 00 90 80 00       	push   $0x809000
+  802736:	e8 81 e3 ff ff       	call   800abc <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  80273b:	83 c4 10             	add    $0x10,%esp
+  80273e:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802744:	76 69                	jbe    8027af <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802746:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802749:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80274f:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802754:	29 d1                	sub    %edx,%ecx
+  802756:	39 f9                	cmp    %edi,%ecx
+  802758:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80275b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80275e:	89 f9                	mov    %edi,%ecx
+  802760:	01 c1                	add    %eax,%ecx
+  802762:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802765:	eb 0f                	jmp    802776 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802767:	0f b6 10             	movzbl (%eax),%edx
+  80276a:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80276c:	05 00 10 00 00       	add    $0x1000,%eax
+  802771:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802776:	39 c8                	cmp    %ecx,%eax
+  802778:	72 ed                	jb     802767 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  80277a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80277d:	89 3d 00 94 80 00    	mov    %edi,0x809400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802783:	89 15 04 94 80 00    	mov    %edx,0x809404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802789:	83 ec 0c             	sub    $0xc,%esp
+  80278c:	6a 07                	push   $0x7
+  80278e:	89 f9                	mov    %edi,%ecx
+  802790:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802793:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802798:	e8 3f f1 ff ff       	call   8018dc <fsipc_pages>
+  80279d:	89 c7                	mov    %eax,%edi
+  80279f:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8027a2:	85 f6                	test   %esi,%esi
+  8027a4:	74 7f                	je     802825 <file_slurp+0x11e>
+  8027a6:	8d 43 01             	lea    0x1(%ebx),%eax
+  8027a9:	85 ff                	test   %edi,%edi
+  8027ab:	79 3c                	jns    8027e9 <file_slurp+0xe2>
+  8027ad:	eb 76                	jmp    802825 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8027af:	89 3d 00 94 80 00    	mov    %edi,0x809400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8027b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ba:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8027bf:	e8 ba f2 ff ff       	call   801a7e <fsipc>
+  8027c4:	89 c7                	mov    %eax,%edi
+  8027c6:	85 c0                	test   %eax,%eax
+  8027c8:	7e d8                	jle    8027a2 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8027ca:	83 ec 04             	sub    $0x4,%esp
+  8027cd:	50                   	push   %eax
+  8027ce:	68 08 90 80 00       	push   $0x809008
+  8027d3:	ff 75 0c             	push   0xc(%ebp)
+  8027d6:	e8 67 e4 ff ff       	call   800c42 <memmove>
+  8027db:	83 c4 10             	add    $0x10,%esp
+  8027de:	eb c2                	jmp    8027a2 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8027e0:	80 fa 2f             	cmp    $0x2f,%dl
+  8027e3:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8027e6:	83 c0 01             	add    $0x1,%eax
+  8027e9:	89 c1                	mov    %eax,%ecx
+  8027eb:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8027ef:	84 d2                	test   %dl,%dl
+  8027f1:	75 ed                	jne    8027e0 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8027f3:	83 ec 04             	sub    $0x4,%esp
+  8027f6:	68 80 00 00 00       	push   $0x80
+  8027fb:	53                   	push   %ebx
+  8027fc:	56                   	push   %esi
+  8027fd:	e8 30 e3 ff ff       	call   800b32 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802802:	a1 00 90 80 00       	mov    0x809000,%eax
+  802807:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  80280d:	a1 04 90 80 00       	mov    0x809004,%eax
+  802812:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802818:	c7 86 88 00 00 00 c0 	movl   $0x8067c0,0x88(%esi)
+  80281f:	67 80 00 
+  802822:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802825:	89 f8                	mov    %edi,%eax
+  802827:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80282a:	5b                   	pop    %ebx
+  80282b:	5e                   	pop    %esi
+  80282c:	5f                   	pop    %edi
+  80282d:	5d                   	pop    %ebp
+  80282e:	c3                   	ret
+		return -E_BAD_PATH;
+  80282f:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802834:	eb ef                	jmp    802825 <file_slurp+0x11e>
+
+00802836 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802836:	55                   	push   %ebp
+  802837:	89 e5                	mov    %esp,%ebp
+  802839:	53                   	push   %ebx
+  80283a:	83 ec 10             	sub    $0x10,%esp
+  80283d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802840:	53                   	push   %ebx
+  802841:	e8 3b e2 ff ff       	call   800a81 <strlen>
+  802846:	83 c4 10             	add    $0x10,%esp
+  802849:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80284e:	7f 25                	jg     802875 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802850:	83 ec 08             	sub    $0x8,%esp
+  802853:	53                   	push   %ebx
+  802854:	68 00 90 80 00       	push   $0x809000
+  802859:	e8 5e e2 ff ff       	call   800abc <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80285e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802863:	b8 07 00 00 00       	mov    $0x7,%eax
+  802868:	e8 11 f2 ff ff       	call   801a7e <fsipc>
+  80286d:	83 c4 10             	add    $0x10,%esp
+}
+  802870:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802873:	c9                   	leave
+  802874:	c3                   	ret
+		return -E_BAD_PATH;
+  802875:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80287a:	eb f4                	jmp    802870 <remove+0x3a>
+
+0080287c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80287c:	55                   	push   %ebp
+  80287d:	89 e5                	mov    %esp,%ebp
+  80287f:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802882:	ba 00 00 00 00       	mov    $0x0,%edx
+  802887:	b8 08 00 00 00       	mov    $0x8,%eax
+  80288c:	e8 ed f1 ff ff       	call   801a7e <fsipc>
+}
+  802891:	c9                   	leave
+  802892:	c3                   	ret
+
+00802893 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802893:	55                   	push   %ebp
+  802894:	89 e5                	mov    %esp,%ebp
+  802896:	57                   	push   %edi
+  802897:	56                   	push   %esi
+  802898:	53                   	push   %ebx
+  802899:	83 ec 18             	sub    $0x18,%esp
+  80289c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80289f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8028a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8028a5:	57                   	push   %edi
+  8028a6:	e8 d6 e1 ff ff       	call   800a81 <strlen>
+  8028ab:	83 c4 10             	add    $0x10,%esp
+  8028ae:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8028b3:	7f 4c                	jg     802901 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  8028b5:	83 ec 08             	sub    $0x8,%esp
+  8028b8:	57                   	push   %edi
+  8028b9:	68 00 90 80 00       	push   $0x809000
+  8028be:	e8 f9 e1 ff ff       	call   800abc <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  8028c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028c8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8028cd:	e8 ac f1 ff ff       	call   801a7e <fsipc>
+  8028d2:	83 c4 10             	add    $0x10,%esp
+  8028d5:	85 c0                	test   %eax,%eax
+  8028d7:	78 20                	js     8028f9 <defrag+0x66>
+		return r;
+	if (before)
+  8028d9:	85 f6                	test   %esi,%esi
+  8028db:	74 07                	je     8028e4 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  8028dd:	a1 00 90 80 00       	mov    0x809000,%eax
+  8028e2:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  8028e4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  8028e9:	85 db                	test   %ebx,%ebx
+  8028eb:	74 0c                	je     8028f9 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  8028ed:	a1 04 90 80 00       	mov    0x809004,%eax
+  8028f2:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8028f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028fc:	5b                   	pop    %ebx
+  8028fd:	5e                   	pop    %esi
+  8028fe:	5f                   	pop    %edi
+  8028ff:	5d                   	pop    %ebp
+  802900:	c3                   	ret
+		return -E_BAD_PATH;
+  802901:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802906:	eb f1                	jmp    8028f9 <defrag+0x66>
+
+00802908 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802908:	55                   	push   %ebp
+  802909:	89 e5                	mov    %esp,%ebp
+  80290b:	53                   	push   %ebx
+  80290c:	83 ec 04             	sub    $0x4,%esp
+  80290f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802912:	ba 00 00 00 00       	mov    $0x0,%edx
+  802917:	b8 11 00 00 00       	mov    $0x11,%eax
+  80291c:	e8 5d f1 ff ff       	call   801a7e <fsipc>
+  802921:	85 c0                	test   %eax,%eax
+  802923:	78 34                	js     802959 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802925:	a1 00 90 80 00       	mov    0x809000,%eax
+  80292a:	89 03                	mov    %eax,(%ebx)
+  80292c:	a1 04 90 80 00       	mov    0x809004,%eax
+  802931:	89 43 04             	mov    %eax,0x4(%ebx)
+  802934:	a1 08 90 80 00       	mov    0x809008,%eax
+  802939:	89 43 08             	mov    %eax,0x8(%ebx)
+  80293c:	a1 0c 90 80 00       	mov    0x80900c,%eax
+  802941:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802944:	a1 10 90 80 00       	mov    0x809010,%eax
+  802949:	89 43 10             	mov    %eax,0x10(%ebx)
+  80294c:	a1 14 90 80 00       	mov    0x809014,%eax
+  802951:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802954:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802959:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80295c:	c9                   	leave
+  80295d:	c3                   	ret
+
+0080295e <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  80295e:	55                   	push   %ebp
+  80295f:	89 e5                	mov    %esp,%ebp
+  802961:	57                   	push   %edi
+  802962:	56                   	push   %esi
+  802963:	53                   	push   %ebx
+  802964:	81 ec a4 02 00 00    	sub    $0x2a4,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  80296a:	6a 00                	push   $0x0
+  80296c:	ff 75 08             	push   0x8(%ebp)
+  80296f:	e8 ee f6 ff ff       	call   802062 <open>
+  802974:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  80297a:	83 c4 10             	add    $0x10,%esp
+  80297d:	85 c0                	test   %eax,%eax
+  80297f:	0f 88 39 06 00 00    	js     802fbe <spawn+0x660>
+  802985:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802987:	83 ec 04             	sub    $0x4,%esp
+  80298a:	68 00 02 00 00       	push   $0x200
+  80298f:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802995:	50                   	push   %eax
+  802996:	51                   	push   %ecx
+  802997:	e8 97 ec ff ff       	call   801633 <readn>
+  80299c:	83 c4 10             	add    $0x10,%esp
+  80299f:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8029a4:	75 5a                	jne    802a00 <spawn+0xa2>
+	    || elf->e_magic != ELF_MAGIC) {
+  8029a6:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8029ad:	45 4c 46 
+  8029b0:	75 4e                	jne    802a00 <spawn+0xa2>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8029b2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8029b7:	cd 30                	int    $0x30
+  8029b9:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  8029bf:	85 c0                	test   %eax,%eax
+  8029c1:	0f 88 eb 05 00 00    	js     802fb2 <spawn+0x654>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  8029c7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8029cc:	69 f0 8c 00 00 00    	imul   $0x8c,%eax,%esi
+  8029d2:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8029d8:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8029de:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8029e3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  8029e5:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8029eb:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  8029f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  8029f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8029fb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8029fe:	eb 4b                	jmp    802a4b <spawn+0xed>
+		close(fd);
+  802a00:	83 ec 0c             	sub    $0xc,%esp
+  802a03:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  802a09:	e8 62 ea ff ff       	call   801470 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802a0e:	83 c4 0c             	add    $0xc,%esp
+  802a11:	68 7f 45 4c 46       	push   $0x464c457f
+  802a16:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802a1c:	68 56 46 80 00       	push   $0x804656
+  802a21:	e8 a8 da ff ff       	call   8004ce <cprintf>
+		return -E_NOT_EXEC;
+  802a26:	83 c4 10             	add    $0x10,%esp
+  802a29:	c7 85 7c fd ff ff f2 	movl   $0xfffffff2,-0x284(%ebp)
+  802a30:	ff ff ff 
+  802a33:	e9 86 05 00 00       	jmp    802fbe <spawn+0x660>
+		string_size += strlen(argv[argc]) + 1;
+  802a38:	83 ec 0c             	sub    $0xc,%esp
+  802a3b:	50                   	push   %eax
+  802a3c:	e8 40 e0 ff ff       	call   800a81 <strlen>
+  802a41:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802a45:	83 c3 01             	add    $0x1,%ebx
+  802a48:	83 c4 10             	add    $0x10,%esp
+  802a4b:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802a4e:	85 c0                	test   %eax,%eax
+  802a50:	75 e6                	jne    802a38 <spawn+0xda>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802a52:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802a58:	bf 00 10 40 00       	mov    $0x401000,%edi
+  802a5d:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802a5f:	89 fa                	mov    %edi,%edx
+  802a61:	83 e2 fc             	and    $0xfffffffc,%edx
+  802a64:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802a6b:	29 c2                	sub    %eax,%edx
+  802a6d:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802a73:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802a76:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802a7b:	0f 86 59 05 00 00    	jbe    802fda <spawn+0x67c>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802a81:	83 ec 04             	sub    $0x4,%esp
+  802a84:	6a 07                	push   $0x7
+  802a86:	68 00 00 40 00       	push   $0x400000
+  802a8b:	6a 00                	push   $0x0
+  802a8d:	e8 36 e4 ff ff       	call   800ec8 <sys_page_alloc>
+  802a92:	83 c4 10             	add    $0x10,%esp
+  802a95:	85 c0                	test   %eax,%eax
+  802a97:	0f 88 42 05 00 00    	js     802fdf <spawn+0x681>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  802a9d:	be 00 00 00 00       	mov    $0x0,%esi
+  802aa2:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  802aa8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802aab:	eb 30                	jmp    802add <spawn+0x17f>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  802aad:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802ab3:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+  802ab9:	89 04 b2             	mov    %eax,(%edx,%esi,4)
+		strcpy(string_store, argv[i]);
+  802abc:	83 ec 08             	sub    $0x8,%esp
+  802abf:	ff 34 b3             	push   (%ebx,%esi,4)
+  802ac2:	57                   	push   %edi
+  802ac3:	e8 f4 df ff ff       	call   800abc <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  802ac8:	83 c4 04             	add    $0x4,%esp
+  802acb:	ff 34 b3             	push   (%ebx,%esi,4)
+  802ace:	e8 ae df ff ff       	call   800a81 <strlen>
+  802ad3:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  802ad7:	83 c6 01             	add    $0x1,%esi
+  802ada:	83 c4 10             	add    $0x10,%esp
+  802add:	39 b5 90 fd ff ff    	cmp    %esi,-0x270(%ebp)
+  802ae3:	7f c8                	jg     802aad <spawn+0x14f>
+	}
+	argv_store[argc] = 0;
+  802ae5:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802aeb:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802af1:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802af8:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802afe:	0f 85 83 00 00 00    	jne    802b87 <spawn+0x229>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802b04:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+  802b0a:	8d 82 00 d0 7f ee    	lea    -0x11803000(%edx),%eax
+  802b10:	89 42 fc             	mov    %eax,-0x4(%edx)
+	argv_store[-2] = argc;
+  802b13:	89 d0                	mov    %edx,%eax
+  802b15:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802b1b:	89 4a f8             	mov    %ecx,-0x8(%edx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802b1e:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  802b23:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802b29:	83 ec 0c             	sub    $0xc,%esp
+  802b2c:	6a 07                	push   $0x7
+  802b2e:	68 00 d0 bf ee       	push   $0xeebfd000
+  802b33:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802b39:	68 00 00 40 00       	push   $0x400000
+  802b3e:	6a 00                	push   $0x0
+  802b40:	e8 ce e3 ff ff       	call   800f13 <sys_page_map>
+  802b45:	89 c3                	mov    %eax,%ebx
+  802b47:	83 c4 20             	add    $0x20,%esp
+  802b4a:	85 c0                	test   %eax,%eax
+  802b4c:	0f 88 95 04 00 00    	js     802fe7 <spawn+0x689>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802b52:	83 ec 08             	sub    $0x8,%esp
+  802b55:	68 00 00 40 00       	push   $0x400000
+  802b5a:	6a 00                	push   $0x0
+  802b5c:	e8 f4 e3 ff ff       	call   800f55 <sys_page_unmap>
+  802b61:	89 c3                	mov    %eax,%ebx
+  802b63:	83 c4 10             	add    $0x10,%esp
+  802b66:	85 c0                	test   %eax,%eax
+  802b68:	0f 88 79 04 00 00    	js     802fe7 <spawn+0x689>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802b6e:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802b74:	8d b4 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802b7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b80:	89 df                	mov    %ebx,%edi
+  802b82:	e9 7f 02 00 00       	jmp    802e06 <spawn+0x4a8>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802b87:	68 e0 46 80 00       	push   $0x8046e0
+  802b8c:	68 00 46 80 00       	push   $0x804600
+  802b91:	68 f0 00 00 00       	push   $0xf0
+  802b96:	68 70 46 80 00       	push   $0x804670
+  802b9b:	e8 53 d8 ff ff       	call   8003f3 <_panic>
+
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+		if (i >= filesz) {
+			// allocate a blank page
+			n = 1;
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  802ba0:	83 ec 04             	sub    $0x4,%esp
+  802ba3:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802ba9:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802baf:	01 f8                	add    %edi,%eax
+  802bb1:	50                   	push   %eax
+  802bb2:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802bb8:	e8 0b e3 ff ff       	call   800ec8 <sys_page_alloc>
+  802bbd:	83 c4 10             	add    $0x10,%esp
+  802bc0:	85 c0                	test   %eax,%eax
+  802bc2:	0f 88 04 04 00 00    	js     802fcc <spawn+0x66e>
+			n = 1;
+  802bc8:	be 01 00 00 00       	mov    $0x1,%esi
+  802bcd:	e9 99 01 00 00       	jmp    802d6b <spawn+0x40d>
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+			// read-only and all from file: map the file server's
+			// cached pages, so that every instance of the program
+			// shares one copy of its text
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  802bd2:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802bd8:	8b 8d 80 fd ff ff    	mov    -0x280(%ebp),%ecx
+  802bde:	39 c8                	cmp    %ecx,%eax
+  802be0:	72 70                	jb     802c52 <spawn+0x2f4>
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+  802be2:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802be7:	29 f8                	sub    %edi,%eax
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  802be9:	c1 e8 0c             	shr    $0xc,%eax
+			n = MIN(n, FSBULK_MAXPAGES);
+  802bec:	ba 40 00 00 00       	mov    $0x40,%edx
+  802bf1:	39 d0                	cmp    %edx,%eax
+  802bf3:	0f 4e d0             	cmovle %eax,%edx
+  802bf6:	89 d6                	mov    %edx,%esi
+			if ((r = mmap(UTEMP, n * PGSIZE, PROT_READ, MAP_SHARED,
+  802bf8:	83 ec 08             	sub    $0x8,%esp
+  802bfb:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802c01:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  802c07:	01 d0                	add    %edx,%eax
+  802c09:	50                   	push   %eax
+  802c0a:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  802c10:	6a 01                	push   $0x1
+  802c12:	6a 01                	push   $0x1
+  802c14:	89 f0                	mov    %esi,%eax
+  802c16:	c1 e0 0c             	shl    $0xc,%eax
+  802c19:	50                   	push   %eax
+  802c1a:	68 00 00 40 00       	push   $0x400000
+  802c1f:	e8 1c f6 ff ff       	call   802240 <mmap>
+  802c24:	83 c4 20             	add    $0x20,%esp
+  802c27:	85 c0                	test   %eax,%eax
+  802c29:	78 34                	js     802c5f <spawn+0x301>
+			if ((r = seek(fd, fileoffset + i)) < 0)
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
+				return r;
+		}
+		for (j = 0; j < n; j++) {
+  802c2b:	8d 86 00 04 00 00    	lea    0x400(%esi),%eax
+  802c31:	c1 e0 0c             	shl    $0xc,%eax
+  802c34:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  802c3a:	bb 00 00 40 00       	mov    $0x400000,%ebx
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  802c3f:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  802c45:	01 c7                	add    %eax,%edi
+  802c47:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+		for (j = 0; j < n; j++) {
+  802c4d:	e9 ca 00 00 00       	jmp    802d1c <spawn+0x3be>
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  802c52:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802c58:	29 f8                	sub    %edi,%eax
+  802c5a:	c1 e8 0c             	shr    $0xc,%eax
+  802c5d:	eb 8d                	jmp    802bec <spawn+0x28e>
+  802c5f:	89 c7                	mov    %eax,%edi
+  802c61:	eb 27                	jmp    802c8a <spawn+0x32c>
+			for (j = 0; j < n; j++)
+  802c63:	83 c3 01             	add    $0x1,%ebx
+  802c66:	39 de                	cmp    %ebx,%esi
+  802c68:	7e 4a                	jle    802cb4 <spawn+0x356>
+				if ((r = sys_page_alloc(0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  802c6a:	83 ec 04             	sub    $0x4,%esp
+  802c6d:	6a 07                	push   $0x7
+  802c6f:	89 d8                	mov    %ebx,%eax
+  802c71:	c1 e0 0c             	shl    $0xc,%eax
+  802c74:	05 00 00 40 00       	add    $0x400000,%eax
+  802c79:	50                   	push   %eax
+  802c7a:	6a 00                	push   $0x0
+  802c7c:	e8 47 e2 ff ff       	call   800ec8 <sys_page_alloc>
+  802c81:	83 c4 10             	add    $0x10,%esp
+  802c84:	85 c0                	test   %eax,%eax
+  802c86:	79 db                	jns    802c63 <spawn+0x305>
+  802c88:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  802c8a:	83 ec 0c             	sub    $0xc,%esp
+  802c8d:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802c93:	e8 a1 e1 ff ff       	call   800e39 <sys_env_destroy>
+	close(fd);
+  802c98:	83 c4 04             	add    $0x4,%esp
+  802c9b:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  802ca1:	e8 ca e7 ff ff       	call   801470 <close>
+	return r;
+  802ca6:	83 c4 10             	add    $0x10,%esp
+  802ca9:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+  802caf:	e9 0a 03 00 00       	jmp    802fbe <spawn+0x660>
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  802cb4:	83 ec 08             	sub    $0x8,%esp
+  802cb7:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802cbd:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  802cc3:	01 d0                	add    %edx,%eax
+  802cc5:	50                   	push   %eax
+  802cc6:	8b 9d 7c fd ff ff    	mov    -0x284(%ebp),%ebx
+  802ccc:	53                   	push   %ebx
+  802ccd:	e8 2a ea ff ff       	call   8016fc <seek>
+  802cd2:	83 c4 10             	add    $0x10,%esp
+  802cd5:	85 c0                	test   %eax,%eax
+  802cd7:	0f 88 f6 02 00 00    	js     802fd3 <spawn+0x675>
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
+  802cdd:	83 ec 04             	sub    $0x4,%esp
+  802ce0:	89 f0                	mov    %esi,%eax
+  802ce2:	c1 e0 0c             	shl    $0xc,%eax
+  802ce5:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  802ceb:	39 c8                	cmp    %ecx,%eax
+  802ced:	0f 47 c1             	cmova  %ecx,%eax
+  802cf0:	50                   	push   %eax
+  802cf1:	68 00 00 40 00       	push   $0x400000
+  802cf6:	53                   	push   %ebx
+  802cf7:	e8 37 e9 ff ff       	call   801633 <readn>
+  802cfc:	83 c4 10             	add    $0x10,%esp
+  802cff:	85 c0                	test   %eax,%eax
+  802d01:	0f 89 24 ff ff ff    	jns    802c2b <spawn+0x2cd>
+  802d07:	89 c7                	mov    %eax,%edi
+  802d09:	e9 7c ff ff ff       	jmp    802c8a <spawn+0x32c>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP + j * PGSIZE);
+  802d0e:	83 ec 08             	sub    $0x8,%esp
+  802d11:	56                   	push   %esi
+  802d12:	6a 00                	push   $0x0
+  802d14:	e8 3c e2 ff ff       	call   800f55 <sys_page_unmap>
+  802d19:	83 c4 10             	add    $0x10,%esp
+		for (j = 0; j < n; j++) {
+  802d1c:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802d22:	39 c3                	cmp    %eax,%ebx
+  802d24:	74 3f                	je     802d65 <spawn+0x407>
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  802d26:	89 de                	mov    %ebx,%esi
+  802d28:	83 ec 0c             	sub    $0xc,%esp
+  802d2b:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802d31:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  802d34:	50                   	push   %eax
+  802d35:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802d3b:	53                   	push   %ebx
+  802d3c:	6a 00                	push   $0x0
+  802d3e:	e8 d0 e1 ff ff       	call   800f13 <sys_page_map>
+  802d43:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802d49:	83 c4 20             	add    $0x20,%esp
+  802d4c:	85 c0                	test   %eax,%eax
+  802d4e:	79 be                	jns    802d0e <spawn+0x3b0>
+				panic("spawn: sys_page_map data: %e", r);
+  802d50:	50                   	push   %eax
+  802d51:	68 7c 46 80 00       	push   $0x80467c
+  802d56:	68 36 01 00 00       	push   $0x136
+  802d5b:	68 70 46 80 00       	push   $0x804670
+  802d60:	e8 8e d6 ff ff       	call   8003f3 <_panic>
+  802d65:	8b b5 74 fd ff ff    	mov    -0x28c(%ebp),%esi
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  802d6b:	c1 e6 0c             	shl    $0xc,%esi
+  802d6e:	01 b5 88 fd ff ff    	add    %esi,-0x278(%ebp)
+  802d74:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802d7a:	89 c7                	mov    %eax,%edi
+  802d7c:	8b 8d 80 fd ff ff    	mov    -0x280(%ebp),%ecx
+  802d82:	39 c8                	cmp    %ecx,%eax
+  802d84:	73 6e                	jae    802df4 <spawn+0x496>
+		if (i >= filesz) {
+  802d86:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802d8c:	39 8d 88 fd ff ff    	cmp    %ecx,-0x278(%ebp)
+  802d92:	0f 83 08 fe ff ff    	jae    802ba0 <spawn+0x242>
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+  802d98:	f6 85 94 fd ff ff 02 	testb  $0x2,-0x26c(%ebp)
+  802d9f:	75 27                	jne    802dc8 <spawn+0x46a>
+  802da1:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802da7:	05 00 10 00 00       	add    $0x1000,%eax
+  802dac:	8b 95 84 fd ff ff    	mov    -0x27c(%ebp),%edx
+  802db2:	39 c2                	cmp    %eax,%edx
+  802db4:	0f 83 18 fe ff ff    	jae    802bd2 <spawn+0x274>
+  802dba:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802dc0:	39 c2                	cmp    %eax,%edx
+  802dc2:	0f 83 0a fe ff ff    	jae    802bd2 <spawn+0x274>
+			n = MIN(FSBULK_MAXPAGES, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  802dc8:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802dce:	29 f8                	sub    %edi,%eax
+  802dd0:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  802dd6:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802ddb:	c1 e8 0c             	shr    $0xc,%eax
+  802dde:	89 c6                	mov    %eax,%esi
+  802de0:	b8 40 00 00 00       	mov    $0x40,%eax
+  802de5:	39 c6                	cmp    %eax,%esi
+  802de7:	0f 47 f0             	cmova  %eax,%esi
+			for (j = 0; j < n; j++)
+  802dea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802def:	e9 72 fe ff ff       	jmp    802c66 <spawn+0x308>
+  802df4:	8b bd 68 fd ff ff    	mov    -0x298(%ebp),%edi
+  802dfa:	8b b5 64 fd ff ff    	mov    -0x29c(%ebp),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802e00:	83 c7 01             	add    $0x1,%edi
+  802e03:	83 c6 20             	add    $0x20,%esi
+  802e06:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802e0d:	39 f8                	cmp    %edi,%eax
+  802e0f:	0f 8e 88 00 00 00    	jle    802e9d <spawn+0x53f>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802e15:	83 3e 01             	cmpl   $0x1,(%esi)
+  802e18:	75 e6                	jne    802e00 <spawn+0x4a2>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802e1a:	8b 46 18             	mov    0x18(%esi),%eax
+  802e1d:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802e20:	83 f8 01             	cmp    $0x1,%eax
+  802e23:	19 c0                	sbb    %eax,%eax
+  802e25:	83 e0 fe             	and    $0xfffffffe,%eax
+  802e28:	83 c0 07             	add    $0x7,%eax
+  802e2b:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802e31:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e34:	89 8d 78 fd ff ff    	mov    %ecx,-0x288(%ebp)
+  802e3a:	8b 5e 10             	mov    0x10(%esi),%ebx
+  802e3d:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  802e43:	8b 46 14             	mov    0x14(%esi),%eax
+  802e46:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  802e4c:	8b 56 08             	mov    0x8(%esi),%edx
+	if ((i = PGOFF(va))) {
+  802e4f:	89 d0                	mov    %edx,%eax
+  802e51:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802e56:	74 18                	je     802e70 <spawn+0x512>
+		va -= i;
+  802e58:	29 c2                	sub    %eax,%edx
+		memsz += i;
+  802e5a:	01 85 80 fd ff ff    	add    %eax,-0x280(%ebp)
+		filesz += i;
+  802e60:	01 c3                	add    %eax,%ebx
+  802e62:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+		fileoffset -= i;
+  802e68:	29 c1                	sub    %eax,%ecx
+  802e6a:	89 8d 78 fd ff ff    	mov    %ecx,-0x288(%ebp)
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  802e70:	c7 85 88 fd ff ff 00 	movl   $0x0,-0x278(%ebp)
+  802e77:	00 00 00 
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  802e7a:	8d 82 00 00 c0 ff    	lea    -0x400000(%edx),%eax
+  802e80:	89 85 70 fd ff ff    	mov    %eax,-0x290(%ebp)
+  802e86:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+  802e8c:	89 bd 68 fd ff ff    	mov    %edi,-0x298(%ebp)
+  802e92:	89 b5 64 fd ff ff    	mov    %esi,-0x29c(%ebp)
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  802e98:	e9 d7 fe ff ff       	jmp    802d74 <spawn+0x416>
+	close(fd);
+  802e9d:	83 ec 0c             	sub    $0xc,%esp
+  802ea0:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  802ea6:	e8 c5 e5 ff ff       	call   801470 <close>
+  802eab:	83 c4 10             	add    $0x10,%esp
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+	// LAB 5: Your code here.
+	int r = 0;
+  802eae:	ba 00 00 00 00       	mov    $0x0,%edx
+
+	for (uintptr_t va = 0; va < UTOP; va += PGSIZE) {
+  802eb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802eb8:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  802ebe:	eb 14                	jmp    802ed4 <spawn+0x576>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+			va += PTSIZE - PGSIZE;
+  802ec0:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t va = 0; va < UTOP; va += PGSIZE) {
+  802ec6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802ecc:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802ed2:	77 65                	ja     802f39 <spawn+0x5db>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  802ed4:	89 d8                	mov    %ebx,%eax
+  802ed6:	c1 e8 16             	shr    $0x16,%eax
+  802ed9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802ee0:	a8 01                	test   $0x1,%al
+  802ee2:	74 dc                	je     802ec0 <spawn+0x562>
+			continue;
+		}
+		if (!(uvpt[PGNUM(va)] & PTE_P) || !(uvpt[PGNUM(va)] & PTE_SHARE))
+  802ee4:	89 d8                	mov    %ebx,%eax
+  802ee6:	c1 e8 0c             	shr    $0xc,%eax
+  802ee9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802ef0:	f6 c1 01             	test   $0x1,%cl
+  802ef3:	74 d1                	je     802ec6 <spawn+0x568>
+  802ef5:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802efc:	f6 c5 04             	test   $0x4,%ch
+  802eff:	74 c5                	je     802ec6 <spawn+0x568>
+			continue;
+		r = sys_page_map(0, (void *) va, child, (void *) va,
+				 uvpt[PGNUM(va)] & PTE_SYSCALL);
+  802f01:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+		r = sys_page_map(0, (void *) va, child, (void *) va,
+  802f08:	83 ec 0c             	sub    $0xc,%esp
+  802f0b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f10:	50                   	push   %eax
+  802f11:	53                   	push   %ebx
+  802f12:	56                   	push   %esi
+  802f13:	53                   	push   %ebx
+  802f14:	6a 00                	push   $0x0
+  802f16:	e8 f8 df ff ff       	call   800f13 <sys_page_map>
+  802f1b:	89 c2                	mov    %eax,%edx
+		if (r < 0)
+  802f1d:	83 c4 20             	add    $0x20,%esp
+  802f20:	85 c0                	test   %eax,%eax
+  802f22:	79 a2                	jns    802ec6 <spawn+0x568>
+		panic("copy_shared_pages: %e", r);
+  802f24:	52                   	push   %edx
+  802f25:	68 99 46 80 00       	push   $0x804699
+  802f2a:	68 80 00 00 00       	push   $0x80
+  802f2f:	68 70 46 80 00       	push   $0x804670
+  802f34:	e8 ba d4 ff ff       	call   8003f3 <_panic>
+	if ((r = copy_shared_pages(child)) < 0)
+  802f39:	85 d2                	test   %edx,%edx
+  802f3b:	78 e7                	js     802f24 <spawn+0x5c6>
+	child_tf.tf_eflags |= FL_IOPL_3;   // devious: see user/faultio.c
+  802f3d:	81 8d dc fd ff ff 00 	orl    $0x3000,-0x224(%ebp)
+  802f44:	30 00 00 
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802f47:	83 ec 08             	sub    $0x8,%esp
+  802f4a:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802f50:	50                   	push   %eax
+  802f51:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802f57:	e8 8d e0 ff ff       	call   800fe9 <sys_env_set_trapframe>
+  802f5c:	83 c4 10             	add    $0x10,%esp
+  802f5f:	85 c0                	test   %eax,%eax
+  802f61:	78 25                	js     802f88 <spawn+0x62a>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802f63:	83 ec 08             	sub    $0x8,%esp
+  802f66:	6a 02                	push   $0x2
+  802f68:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802f6e:	e8 2c e0 ff ff       	call   800f9f <sys_env_set_status>
+  802f73:	83 c4 10             	add    $0x10,%esp
+  802f76:	85 c0                	test   %eax,%eax
+  802f78:	78 23                	js     802f9d <spawn+0x63f>
+	return child;
+  802f7a:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802f80:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802f86:	eb 36                	jmp    802fbe <spawn+0x660>
+		panic("sys_env_set_trapframe: %e", r);
+  802f88:	50                   	push   %eax
+  802f89:	68 af 46 80 00       	push   $0x8046af
+  802f8e:	68 84 00 00 00       	push   $0x84
+  802f93:	68 70 46 80 00       	push   $0x804670
+  802f98:	e8 56 d4 ff ff       	call   8003f3 <_panic>
+		panic("sys_env_set_status: %e", r);
+  802f9d:	50                   	push   %eax
+  802f9e:	68 c9 46 80 00       	push   $0x8046c9
+  802fa3:	68 87 00 00 00       	push   $0x87
+  802fa8:	68 70 46 80 00       	push   $0x804670
+  802fad:	e8 41 d4 ff ff       	call   8003f3 <_panic>
+		return r;
+  802fb2:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802fb8:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+}
+  802fbe:	8b 85 7c fd ff ff    	mov    -0x284(%ebp),%eax
+  802fc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fc7:	5b                   	pop    %ebx
+  802fc8:	5e                   	pop    %esi
+  802fc9:	5f                   	pop    %edi
+  802fca:	5d                   	pop    %ebp
+  802fcb:	c3                   	ret
+  802fcc:	89 c7                	mov    %eax,%edi
+  802fce:	e9 b7 fc ff ff       	jmp    802c8a <spawn+0x32c>
+  802fd3:	89 c7                	mov    %eax,%edi
+  802fd5:	e9 b0 fc ff ff       	jmp    802c8a <spawn+0x32c>
+		return -E_NO_MEM;
+  802fda:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802fdf:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802fe5:	eb d7                	jmp    802fbe <spawn+0x660>
+	sys_page_unmap(0, UTEMP);
+  802fe7:	83 ec 08             	sub    $0x8,%esp
+  802fea:	68 00 00 40 00       	push   $0x400000
+  802fef:	6a 00                	push   $0x0
+  802ff1:	e8 5f df ff ff       	call   800f55 <sys_page_unmap>
+  802ff6:	83 c4 10             	add    $0x10,%esp
+  802ff9:	89 9d 7c fd ff ff    	mov    %ebx,-0x284(%ebp)
+  802fff:	eb bd                	jmp    802fbe <spawn+0x660>
+
+00803001 <spawnl>:
+{
+  803001:	55                   	push   %ebp
+  803002:	89 e5                	mov    %esp,%ebp
+  803004:	56                   	push   %esi
+  803005:	53                   	push   %ebx
+	va_start(vl, arg0);
+  803006:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  803009:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  80300e:	eb 05                	jmp    803015 <spawnl+0x14>
+		argc++;
+  803010:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  803013:	89 ca                	mov    %ecx,%edx
+  803015:	8d 4a 04             	lea    0x4(%edx),%ecx
+  803018:	83 3a 00             	cmpl   $0x0,(%edx)
+  80301b:	75 f3                	jne    803010 <spawnl+0xf>
+	const char *argv[argc+2];
+  80301d:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  803024:	83 e2 f0             	and    $0xfffffff0,%edx
+  803027:	29 d4                	sub    %edx,%esp
+  803029:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  80302d:	89 da                	mov    %ebx,%edx
+  80302f:	c1 ea 02             	shr    $0x2,%edx
+  803032:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  803035:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803038:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  80303f:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  803046:	00 
+	va_start(vl, arg0);
+  803047:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  80304a:	89 c2                	mov    %eax,%edx
+  80304c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803051:	eb 0b                	jmp    80305e <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  803053:	83 c0 01             	add    $0x1,%eax
+  803056:	8b 31                	mov    (%ecx),%esi
+  803058:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  80305b:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  80305e:	39 d0                	cmp    %edx,%eax
+  803060:	75 f1                	jne    803053 <spawnl+0x52>
+	return spawn(prog, argv);
+  803062:	83 ec 08             	sub    $0x8,%esp
+  803065:	53                   	push   %ebx
+  803066:	ff 75 08             	push   0x8(%ebp)
+  803069:	e8 f0 f8 ff ff       	call   80295e <spawn>
+}
+  80306e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803071:	5b                   	pop    %ebx
+  803072:	5e                   	pop    %esi
+  803073:	5d                   	pop    %ebp
+  803074:	c3                   	ret
+
+00803075 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  803075:	55                   	push   %ebp
+  803076:	89 e5                	mov    %esp,%ebp
+  803078:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80307b:	68 06 47 80 00       	push   $0x804706
+  803080:	ff 75 0c             	push   0xc(%ebp)
+  803083:	e8 34 da ff ff       	call   800abc <strcpy>
+	return 0;
+}
+  803088:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308d:	c9                   	leave
+  80308e:	c3                   	ret
+
+0080308f <devsock_close>:
+{
+  80308f:	55                   	push   %ebp
+  803090:	89 e5                	mov    %esp,%ebp
+  803092:	53                   	push   %ebx
+  803093:	83 ec 10             	sub    $0x10,%esp
+  803096:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  803099:	53                   	push   %ebx
+  80309a:	e8 d2 0c 00 00       	call   803d71 <pageref>
+  80309f:	89 c2                	mov    %eax,%edx
+  8030a1:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8030a4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8030a9:	83 fa 01             	cmp    $0x1,%edx
+  8030ac:	74 05                	je     8030b3 <devsock_close+0x24>
+}
+  8030ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030b1:	c9                   	leave
+  8030b2:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8030b3:	83 ec 0c             	sub    $0xc,%esp
+  8030b6:	ff 73 0c             	push   0xc(%ebx)
+  8030b9:	e8 b7 02 00 00       	call   803375 <nsipc_close>
+  8030be:	83 c4 10             	add    $0x10,%esp
+  8030c1:	eb eb                	jmp    8030ae <devsock_close+0x1f>
+
+008030c3 <devsock_write>:
+{
+  8030c3:	55                   	push   %ebp
+  8030c4:	89 e5                	mov    %esp,%ebp
+  8030c6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8030c9:	6a 00                	push   $0x0
+  8030cb:	ff 75 10             	push   0x10(%ebp)
+  8030ce:	ff 75 0c             	push   0xc(%ebp)
+  8030d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030d4:	ff 70 0c             	push   0xc(%eax)
+  8030d7:	e8 79 03 00 00       	call   803455 <nsipc_send>
+}
+  8030dc:	c9                   	leave
+  8030dd:	c3                   	ret
+
+008030de <devsock_read>:
+{
+  8030de:	55                   	push   %ebp
+  8030df:	89 e5                	mov    %esp,%ebp
+  8030e1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8030e4:	6a 00                	push   $0x0
+  8030e6:	ff 75 10             	push   0x10(%ebp)
+  8030e9:	ff 75 0c             	push   0xc(%ebp)
+  8030ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030ef:	ff 70 0c             	push   0xc(%eax)
+  8030f2:	e8 ef 02 00 00       	call   8033e6 <nsipc_recv>
+}
+  8030f7:	c9                   	leave
+  8030f8:	c3                   	ret
+
+008030f9 <fd2sockid>:
+{
+  8030f9:	55                   	push   %ebp
+  8030fa:	89 e5                	mov    %esp,%ebp
+  8030fc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8030ff:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803102:	52                   	push   %edx
+  803103:	50                   	push   %eax
+  803104:	e8 3d e2 ff ff       	call   801346 <fd_lookup>
+  803109:	83 c4 10             	add    $0x10,%esp
+  80310c:	85 c0                	test   %eax,%eax
+  80310e:	78 10                	js     803120 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803110:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803113:	8b 0d e0 67 80 00    	mov    0x8067e0,%ecx
+  803119:	39 08                	cmp    %ecx,(%eax)
+  80311b:	75 05                	jne    803122 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80311d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803120:	c9                   	leave
+  803121:	c3                   	ret
+		return -E_NOT_SUPP;
+  803122:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803127:	eb f7                	jmp    803120 <fd2sockid+0x27>
+
+00803129 <alloc_sockfd>:
+{
+  803129:	55                   	push   %ebp
+  80312a:	89 e5                	mov    %esp,%ebp
+  80312c:	56                   	push   %esi
+  80312d:	53                   	push   %ebx
+  80312e:	83 ec 1c             	sub    $0x1c,%esp
+  803131:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803133:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803136:	50                   	push   %eax
+  803137:	e8 b4 e1 ff ff       	call   8012f0 <fd_alloc>
+  80313c:	89 c3                	mov    %eax,%ebx
+  80313e:	83 c4 10             	add    $0x10,%esp
+  803141:	85 c0                	test   %eax,%eax
+  803143:	78 43                	js     803188 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803145:	83 ec 04             	sub    $0x4,%esp
+  803148:	68 07 04 00 00       	push   $0x407
+  80314d:	ff 75 f4             	push   -0xc(%ebp)
+  803150:	6a 00                	push   $0x0
+  803152:	e8 71 dd ff ff       	call   800ec8 <sys_page_alloc>
+  803157:	89 c3                	mov    %eax,%ebx
+  803159:	83 c4 10             	add    $0x10,%esp
+  80315c:	85 c0                	test   %eax,%eax
+  80315e:	78 28                	js     803188 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803160:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803163:	8b 15 e0 67 80 00    	mov    0x8067e0,%edx
+  803169:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80316b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80316e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803175:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803178:	83 ec 0c             	sub    $0xc,%esp
+  80317b:	50                   	push   %eax
+  80317c:	e8 48 e1 ff ff       	call   8012c9 <fd2num>
+  803181:	89 c3                	mov    %eax,%ebx
+  803183:	83 c4 10             	add    $0x10,%esp
+  803186:	eb 0c                	jmp    803194 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803188:	83 ec 0c             	sub    $0xc,%esp
+  80318b:	56                   	push   %esi
+  80318c:	e8 e4 01 00 00       	call   803375 <nsipc_close>
+		return r;
+  803191:	83 c4 10             	add    $0x10,%esp
+}
+  803194:	89 d8                	mov    %ebx,%eax
+  803196:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803199:	5b                   	pop    %ebx
+  80319a:	5e                   	pop    %esi
+  80319b:	5d                   	pop    %ebp
+  80319c:	c3                   	ret
+
+0080319d <accept>:
+{
+  80319d:	55                   	push   %ebp
+  80319e:	89 e5                	mov    %esp,%ebp
+  8031a0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8031a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031a6:	e8 4e ff ff ff       	call   8030f9 <fd2sockid>
+  8031ab:	85 c0                	test   %eax,%eax
+  8031ad:	78 1b                	js     8031ca <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8031af:	83 ec 04             	sub    $0x4,%esp
+  8031b2:	ff 75 10             	push   0x10(%ebp)
+  8031b5:	ff 75 0c             	push   0xc(%ebp)
+  8031b8:	50                   	push   %eax
+  8031b9:	e8 0e 01 00 00       	call   8032cc <nsipc_accept>
+  8031be:	83 c4 10             	add    $0x10,%esp
+  8031c1:	85 c0                	test   %eax,%eax
+  8031c3:	78 05                	js     8031ca <accept+0x2d>
+	return alloc_sockfd(r);
+  8031c5:	e8 5f ff ff ff       	call   803129 <alloc_sockfd>
+}
+  8031ca:	c9                   	leave
+  8031cb:	c3                   	ret
+
+008031cc <bind>:
+{
+  8031cc:	55                   	push   %ebp
+  8031cd:	89 e5                	mov    %esp,%ebp
+  8031cf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8031d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031d5:	e8 1f ff ff ff       	call   8030f9 <fd2sockid>
+  8031da:	85 c0                	test   %eax,%eax
+  8031dc:	78 12                	js     8031f0 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8031de:	83 ec 04             	sub    $0x4,%esp
+  8031e1:	ff 75 10             	push   0x10(%ebp)
+  8031e4:	ff 75 0c             	push   0xc(%ebp)
+  8031e7:	50                   	push   %eax
+  8031e8:	e8 31 01 00 00       	call   80331e <nsipc_bind>
+  8031ed:	83 c4 10             	add    $0x10,%esp
+}
+  8031f0:	c9                   	leave
+  8031f1:	c3                   	ret
+
+008031f2 <shutdown>:
+{
+  8031f2:	55                   	push   %ebp
+  8031f3:	89 e5                	mov    %esp,%ebp
+  8031f5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8031f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031fb:	e8 f9 fe ff ff       	call   8030f9 <fd2sockid>
+  803200:	85 c0                	test   %eax,%eax
+  803202:	78 0f                	js     803213 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803204:	83 ec 08             	sub    $0x8,%esp
+  803207:	ff 75 0c             	push   0xc(%ebp)
+  80320a:	50                   	push   %eax
+  80320b:	e8 43 01 00 00       	call   803353 <nsipc_shutdown>
+  803210:	83 c4 10             	add    $0x10,%esp
+}
+  803213:	c9                   	leave
+  803214:	c3                   	ret
+
+00803215 <connect>:
+{
+  803215:	55                   	push   %ebp
+  803216:	89 e5                	mov    %esp,%ebp
+  803218:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80321b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80321e:	e8 d6 fe ff ff       	call   8030f9 <fd2sockid>
+  803223:	85 c0                	test   %eax,%eax
+  803225:	78 12                	js     803239 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803227:	83 ec 04             	sub    $0x4,%esp
+  80322a:	ff 75 10             	push   0x10(%ebp)
+  80322d:	ff 75 0c             	push   0xc(%ebp)
+  803230:	50                   	push   %eax
+  803231:	e8 59 01 00 00       	call   80338f <nsipc_connect>
+  803236:	83 c4 10             	add    $0x10,%esp
+}
+  803239:	c9                   	leave
+  80323a:	c3                   	ret
+
+0080323b <listen>:
+{
+  80323b:	55                   	push   %ebp
+  80323c:	89 e5                	mov    %esp,%ebp
+  80323e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803241:	8b 45 08             	mov    0x8(%ebp),%eax
+  803244:	e8 b0 fe ff ff       	call   8030f9 <fd2sockid>
+  803249:	85 c0                	test   %eax,%eax
+  80324b:	78 0f                	js     80325c <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80324d:	83 ec 08             	sub    $0x8,%esp
+  803250:	ff 75 0c             	push   0xc(%ebp)
+  803253:	50                   	push   %eax
+  803254:	e8 6b 01 00 00       	call   8033c4 <nsipc_listen>
+  803259:	83 c4 10             	add    $0x10,%esp
+}
+  80325c:	c9                   	leave
+  80325d:	c3                   	ret
+
+0080325e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80325e:	55                   	push   %ebp
+  80325f:	89 e5                	mov    %esp,%ebp
+  803261:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803264:	ff 75 10             	push   0x10(%ebp)
+  803267:	ff 75 0c             	push   0xc(%ebp)
+  80326a:	ff 75 08             	push   0x8(%ebp)
+  80326d:	e8 41 02 00 00       	call   8034b3 <nsipc_socket>
+  803272:	83 c4 10             	add    $0x10,%esp
+  803275:	85 c0                	test   %eax,%eax
+  803277:	78 05                	js     80327e <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803279:	e8 ab fe ff ff       	call   803129 <alloc_sockfd>
+}
+  80327e:	c9                   	leave
+  80327f:	c3                   	ret
+
+00803280 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803280:	55                   	push   %ebp
+  803281:	89 e5                	mov    %esp,%ebp
+  803283:	53                   	push   %ebx
+  803284:	83 ec 04             	sub    $0x4,%esp
+  803287:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803289:	83 3d 00 c0 80 00 00 	cmpl   $0x0,0x80c000
+  803290:	74 26                	je     8032b8 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803292:	6a 07                	push   $0x7
+  803294:	68 00 b0 80 00       	push   $0x80b000
+  803299:	53                   	push   %ebx
+  80329a:	ff 35 00 c0 80 00    	push   0x80c000
+  8032a0:	e8 54 09 00 00       	call   803bf9 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8032a5:	83 c4 0c             	add    $0xc,%esp
+  8032a8:	6a 00                	push   $0x0
+  8032aa:	6a 00                	push   $0x0
+  8032ac:	6a 00                	push   $0x0
+  8032ae:	e8 db 08 00 00       	call   803b8e <ipc_recv>
+}
+  8032b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032b6:	c9                   	leave
+  8032b7:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8032b8:	83 ec 0c             	sub    $0xc,%esp
+  8032bb:	6a 02                	push   $0x2
+  8032bd:	e8 70 0a 00 00       	call   803d32 <ipc_find_env>
+  8032c2:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  8032c7:	83 c4 10             	add    $0x10,%esp
+  8032ca:	eb c6                	jmp    803292 <nsipc+0x12>
+
+008032cc <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8032cc:	55                   	push   %ebp
+  8032cd:	89 e5                	mov    %esp,%ebp
+  8032cf:	56                   	push   %esi
+  8032d0:	53                   	push   %ebx
+  8032d1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8032d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032d7:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8032dc:	8b 06                	mov    (%esi),%eax
+  8032de:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8032e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032e8:	e8 93 ff ff ff       	call   803280 <nsipc>
+  8032ed:	89 c3                	mov    %eax,%ebx
+  8032ef:	85 c0                	test   %eax,%eax
+  8032f1:	79 09                	jns    8032fc <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8032f3:	89 d8                	mov    %ebx,%eax
+  8032f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032f8:	5b                   	pop    %ebx
+  8032f9:	5e                   	pop    %esi
+  8032fa:	5d                   	pop    %ebp
+  8032fb:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8032fc:	83 ec 04             	sub    $0x4,%esp
+  8032ff:	ff 35 10 b0 80 00    	push   0x80b010
+  803305:	68 00 b0 80 00       	push   $0x80b000
+  80330a:	ff 75 0c             	push   0xc(%ebp)
+  80330d:	e8 30 d9 ff ff       	call   800c42 <memmove>
+		*addrlen = ret->ret_addrlen;
+  803312:	a1 10 b0 80 00       	mov    0x80b010,%eax
+  803317:	89 06                	mov    %eax,(%esi)
+  803319:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80331c:	eb d5                	jmp    8032f3 <nsipc_accept+0x27>
+
+0080331e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80331e:	55                   	push   %ebp
+  80331f:	89 e5                	mov    %esp,%ebp
+  803321:	53                   	push   %ebx
+  803322:	83 ec 08             	sub    $0x8,%esp
+  803325:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803328:	8b 45 08             	mov    0x8(%ebp),%eax
+  80332b:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803330:	53                   	push   %ebx
+  803331:	ff 75 0c             	push   0xc(%ebp)
+  803334:	68 04 b0 80 00       	push   $0x80b004
+  803339:	e8 04 d9 ff ff       	call   800c42 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80333e:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_BIND);
+  803344:	b8 02 00 00 00       	mov    $0x2,%eax
+  803349:	e8 32 ff ff ff       	call   803280 <nsipc>
+}
+  80334e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803351:	c9                   	leave
+  803352:	c3                   	ret
+
+00803353 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803353:	55                   	push   %ebp
+  803354:	89 e5                	mov    %esp,%ebp
+  803356:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803359:	8b 45 08             	mov    0x8(%ebp),%eax
+  80335c:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.shutdown.req_how = how;
+  803361:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803364:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_SHUTDOWN);
+  803369:	b8 03 00 00 00       	mov    $0x3,%eax
+  80336e:	e8 0d ff ff ff       	call   803280 <nsipc>
+}
+  803373:	c9                   	leave
+  803374:	c3                   	ret
+
+00803375 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803375:	55                   	push   %ebp
+  803376:	89 e5                	mov    %esp,%ebp
+  803378:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80337b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80337e:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return nsipc(NSREQ_CLOSE);
+  803383:	b8 04 00 00 00       	mov    $0x4,%eax
+  803388:	e8 f3 fe ff ff       	call   803280 <nsipc>
+}
+  80338d:	c9                   	leave
+  80338e:	c3                   	ret
+
+0080338f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80338f:	55                   	push   %ebp
+  803390:	89 e5                	mov    %esp,%ebp
+  803392:	53                   	push   %ebx
+  803393:	83 ec 08             	sub    $0x8,%esp
+  803396:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803399:	8b 45 08             	mov    0x8(%ebp),%eax
+  80339c:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8033a1:	53                   	push   %ebx
+  8033a2:	ff 75 0c             	push   0xc(%ebp)
+  8033a5:	68 04 b0 80 00       	push   $0x80b004
+  8033aa:	e8 93 d8 ff ff       	call   800c42 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8033af:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_CONNECT);
+  8033b5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8033ba:	e8 c1 fe ff ff       	call   803280 <nsipc>
+}
+  8033bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033c2:	c9                   	leave
+  8033c3:	c3                   	ret
+
+008033c4 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8033c4:	55                   	push   %ebp
+  8033c5:	89 e5                	mov    %esp,%ebp
+  8033c7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8033ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033cd:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.listen.req_backlog = backlog;
+  8033d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033d5:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_LISTEN);
+  8033da:	b8 06 00 00 00       	mov    $0x6,%eax
+  8033df:	e8 9c fe ff ff       	call   803280 <nsipc>
+}
+  8033e4:	c9                   	leave
+  8033e5:	c3                   	ret
+
+008033e6 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8033e6:	55                   	push   %ebp
+  8033e7:	89 e5                	mov    %esp,%ebp
+  8033e9:	56                   	push   %esi
+  8033ea:	53                   	push   %ebx
+  8033eb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8033ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033f1:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.recv.req_len = len;
+  8033f6:	89 35 04 b0 80 00    	mov    %esi,0x80b004
+	nsipcbuf.recv.req_flags = flags;
+  8033fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8033ff:	a3 08 b0 80 00       	mov    %eax,0x80b008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803404:	b8 07 00 00 00       	mov    $0x7,%eax
+  803409:	e8 72 fe ff ff       	call   803280 <nsipc>
+  80340e:	89 c3                	mov    %eax,%ebx
+  803410:	85 c0                	test   %eax,%eax
+  803412:	78 22                	js     803436 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803414:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803419:	39 c6                	cmp    %eax,%esi
+  80341b:	0f 4e c6             	cmovle %esi,%eax
+  80341e:	39 c3                	cmp    %eax,%ebx
+  803420:	7f 1d                	jg     80343f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803422:	83 ec 04             	sub    $0x4,%esp
+  803425:	53                   	push   %ebx
+  803426:	68 00 b0 80 00       	push   $0x80b000
+  80342b:	ff 75 0c             	push   0xc(%ebp)
+  80342e:	e8 0f d8 ff ff       	call   800c42 <memmove>
+  803433:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803436:	89 d8                	mov    %ebx,%eax
+  803438:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80343b:	5b                   	pop    %ebx
+  80343c:	5e                   	pop    %esi
+  80343d:	5d                   	pop    %ebp
+  80343e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80343f:	68 12 47 80 00       	push   $0x804712
+  803444:	68 00 46 80 00       	push   $0x804600
+  803449:	6a 62                	push   $0x62
+  80344b:	68 27 47 80 00       	push   $0x804727
+  803450:	e8 9e cf ff ff       	call   8003f3 <_panic>
+
+00803455 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803455:	55                   	push   %ebp
+  803456:	89 e5                	mov    %esp,%ebp
+  803458:	53                   	push   %ebx
+  803459:	83 ec 04             	sub    $0x4,%esp
+  80345c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80345f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803462:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	assert(size < 1600);
+  803467:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80346d:	7f 2e                	jg     80349d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80346f:	83 ec 04             	sub    $0x4,%esp
+  803472:	53                   	push   %ebx
+  803473:	ff 75 0c             	push   0xc(%ebp)
+  803476:	68 0c b0 80 00       	push   $0x80b00c
+  80347b:	e8 c2 d7 ff ff       	call   800c42 <memmove>
+	nsipcbuf.send.req_size = size;
+  803480:	89 1d 04 b0 80 00    	mov    %ebx,0x80b004
+	nsipcbuf.send.req_flags = flags;
+  803486:	8b 45 14             	mov    0x14(%ebp),%eax
+  803489:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SEND);
+  80348e:	b8 08 00 00 00       	mov    $0x8,%eax
+  803493:	e8 e8 fd ff ff       	call   803280 <nsipc>
+}
+  803498:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80349b:	c9                   	leave
+  80349c:	c3                   	ret
+	assert(size < 1600);
+  80349d:	68 33 47 80 00       	push   $0x804733
+  8034a2:	68 00 46 80 00       	push   $0x804600
+  8034a7:	6a 6d                	push   $0x6d
+  8034a9:	68 27 47 80 00       	push   $0x804727
+  8034ae:	e8 40 cf ff ff       	call   8003f3 <_panic>
+
+008034b3 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8034b3:	55                   	push   %ebp
+  8034b4:	89 e5                	mov    %esp,%ebp
+  8034b6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8034b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034bc:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.socket.req_type = type;
+  8034c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034c4:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	nsipcbuf.socket.req_protocol = protocol;
+  8034c9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8034cc:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SOCKET);
+  8034d1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8034d6:	e8 a5 fd ff ff       	call   803280 <nsipc>
+}
+  8034db:	c9                   	leave
+  8034dc:	c3                   	ret
+
+008034dd <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8034dd:	55                   	push   %ebp
+  8034de:	89 e5                	mov    %esp,%ebp
+  8034e0:	56                   	push   %esi
+  8034e1:	53                   	push   %ebx
+  8034e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8034e5:	83 ec 0c             	sub    $0xc,%esp
+  8034e8:	ff 75 08             	push   0x8(%ebp)
+  8034eb:	e8 e9 dd ff ff       	call   8012d9 <fd2data>
+  8034f0:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8034f2:	83 c4 08             	add    $0x8,%esp
+  8034f5:	68 3f 47 80 00       	push   $0x80473f
+  8034fa:	53                   	push   %ebx
+  8034fb:	e8 bc d5 ff ff       	call   800abc <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803500:	8b 46 04             	mov    0x4(%esi),%eax
+  803503:	2b 06                	sub    (%esi),%eax
+  803505:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80350b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803512:	00 00 00 
+	stat->st_dev = &devpipe;
+  803515:	c7 83 88 00 00 00 00 	movl   $0x806800,0x88(%ebx)
+  80351c:	68 80 00 
+	return 0;
+}
+  80351f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803524:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803527:	5b                   	pop    %ebx
+  803528:	5e                   	pop    %esi
+  803529:	5d                   	pop    %ebp
+  80352a:	c3                   	ret
+
+0080352b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80352b:	55                   	push   %ebp
+  80352c:	89 e5                	mov    %esp,%ebp
+  80352e:	53                   	push   %ebx
+  80352f:	83 ec 0c             	sub    $0xc,%esp
+  803532:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803535:	53                   	push   %ebx
+  803536:	6a 00                	push   $0x0
+  803538:	e8 18 da ff ff       	call   800f55 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80353d:	89 1c 24             	mov    %ebx,(%esp)
+  803540:	e8 94 dd ff ff       	call   8012d9 <fd2data>
+  803545:	83 c4 08             	add    $0x8,%esp
+  803548:	50                   	push   %eax
+  803549:	6a 00                	push   $0x0
+  80354b:	e8 05 da ff ff       	call   800f55 <sys_page_unmap>
+}
+  803550:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803553:	c9                   	leave
+  803554:	c3                   	ret
+
+00803555 <_pipeisclosed>:
+{
+  803555:	55                   	push   %ebp
+  803556:	89 e5                	mov    %esp,%ebp
+  803558:	57                   	push   %edi
+  803559:	56                   	push   %esi
+  80355a:	53                   	push   %ebx
+  80355b:	83 ec 1c             	sub    $0x1c,%esp
+  80355e:	89 c7                	mov    %eax,%edi
+  803560:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  803562:	a1 70 87 80 00       	mov    0x808770,%eax
+  803567:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80356a:	83 ec 0c             	sub    $0xc,%esp
+  80356d:	57                   	push   %edi
+  80356e:	e8 fe 07 00 00       	call   803d71 <pageref>
+  803573:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803576:	89 34 24             	mov    %esi,(%esp)
+  803579:	e8 f3 07 00 00       	call   803d71 <pageref>
+		nn = thisenv->env_runs;
+  80357e:	8b 15 70 87 80 00    	mov    0x808770,%edx
+  803584:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  803587:	83 c4 10             	add    $0x10,%esp
+  80358a:	39 cb                	cmp    %ecx,%ebx
+  80358c:	74 1b                	je     8035a9 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80358e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803591:	75 cf                	jne    803562 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803593:	8b 42 58             	mov    0x58(%edx),%eax
+  803596:	6a 01                	push   $0x1
+  803598:	50                   	push   %eax
+  803599:	53                   	push   %ebx
+  80359a:	68 46 47 80 00       	push   $0x804746
+  80359f:	e8 2a cf ff ff       	call   8004ce <cprintf>
+  8035a4:	83 c4 10             	add    $0x10,%esp
+  8035a7:	eb b9                	jmp    803562 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8035a9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8035ac:	0f 94 c0             	sete   %al
+  8035af:	0f b6 c0             	movzbl %al,%eax
+}
+  8035b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035b5:	5b                   	pop    %ebx
+  8035b6:	5e                   	pop    %esi
+  8035b7:	5f                   	pop    %edi
+  8035b8:	5d                   	pop    %ebp
+  8035b9:	c3                   	ret
+
+008035ba <devpipe_write>:
+{
+  8035ba:	55                   	push   %ebp
+  8035bb:	89 e5                	mov    %esp,%ebp
+  8035bd:	57                   	push   %edi
+  8035be:	56                   	push   %esi
+  8035bf:	53                   	push   %ebx
+  8035c0:	83 ec 28             	sub    $0x28,%esp
+  8035c3:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8035c6:	56                   	push   %esi
+  8035c7:	e8 0d dd ff ff       	call   8012d9 <fd2data>
+  8035cc:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8035ce:	83 c4 10             	add    $0x10,%esp
+  8035d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035d6:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8035d9:	75 09                	jne    8035e4 <devpipe_write+0x2a>
+	return i;
+  8035db:	89 f8                	mov    %edi,%eax
+  8035dd:	eb 23                	jmp    803602 <devpipe_write+0x48>
+			sys_yield();
+  8035df:	e8 c5 d8 ff ff       	call   800ea9 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8035e4:	8b 43 04             	mov    0x4(%ebx),%eax
+  8035e7:	8b 0b                	mov    (%ebx),%ecx
+  8035e9:	8d 51 20             	lea    0x20(%ecx),%edx
+  8035ec:	39 d0                	cmp    %edx,%eax
+  8035ee:	72 1a                	jb     80360a <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8035f0:	89 da                	mov    %ebx,%edx
+  8035f2:	89 f0                	mov    %esi,%eax
+  8035f4:	e8 5c ff ff ff       	call   803555 <_pipeisclosed>
+  8035f9:	85 c0                	test   %eax,%eax
+  8035fb:	74 e2                	je     8035df <devpipe_write+0x25>
+				return 0;
+  8035fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803602:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803605:	5b                   	pop    %ebx
+  803606:	5e                   	pop    %esi
+  803607:	5f                   	pop    %edi
+  803608:	5d                   	pop    %ebp
+  803609:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80360a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80360d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803611:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803614:	89 c2                	mov    %eax,%edx
+  803616:	c1 fa 1f             	sar    $0x1f,%edx
+  803619:	89 d1                	mov    %edx,%ecx
+  80361b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80361e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803621:	83 e2 1f             	and    $0x1f,%edx
+  803624:	29 ca                	sub    %ecx,%edx
+  803626:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80362a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80362e:	83 c0 01             	add    $0x1,%eax
+  803631:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803634:	83 c7 01             	add    $0x1,%edi
+  803637:	eb 9d                	jmp    8035d6 <devpipe_write+0x1c>
+
+00803639 <devpipe_read>:
+{
+  803639:	55                   	push   %ebp
+  80363a:	89 e5                	mov    %esp,%ebp
+  80363c:	57                   	push   %edi
+  80363d:	56                   	push   %esi
+  80363e:	53                   	push   %ebx
+  80363f:	83 ec 18             	sub    $0x18,%esp
+  803642:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803645:	57                   	push   %edi
+  803646:	e8 8e dc ff ff       	call   8012d9 <fd2data>
+  80364b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80364d:	83 c4 10             	add    $0x10,%esp
+  803650:	be 00 00 00 00       	mov    $0x0,%esi
+  803655:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803658:	75 13                	jne    80366d <devpipe_read+0x34>
+	return i;
+  80365a:	89 f0                	mov    %esi,%eax
+  80365c:	eb 02                	jmp    803660 <devpipe_read+0x27>
+				return i;
+  80365e:	89 f0                	mov    %esi,%eax
+}
+  803660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803663:	5b                   	pop    %ebx
+  803664:	5e                   	pop    %esi
+  803665:	5f                   	pop    %edi
+  803666:	5d                   	pop    %ebp
+  803667:	c3                   	ret
+			sys_yield();
+  803668:	e8 3c d8 ff ff       	call   800ea9 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80366d:	8b 03                	mov    (%ebx),%eax
+  80366f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803672:	75 18                	jne    80368c <devpipe_read+0x53>
+			if (i > 0)
+  803674:	85 f6                	test   %esi,%esi
+  803676:	75 e6                	jne    80365e <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803678:	89 da                	mov    %ebx,%edx
+  80367a:	89 f8                	mov    %edi,%eax
+  80367c:	e8 d4 fe ff ff       	call   803555 <_pipeisclosed>
+  803681:	85 c0                	test   %eax,%eax
+  803683:	74 e3                	je     803668 <devpipe_read+0x2f>
+				return 0;
+  803685:	b8 00 00 00 00       	mov    $0x0,%eax
+  80368a:	eb d4                	jmp    803660 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80368c:	99                   	cltd
+  80368d:	c1 ea 1b             	shr    $0x1b,%edx
+  803690:	01 d0                	add    %edx,%eax
+  803692:	83 e0 1f             	and    $0x1f,%eax
+  803695:	29 d0                	sub    %edx,%eax
+  803697:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80369c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80369f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8036a2:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8036a5:	83 c6 01             	add    $0x1,%esi
+  8036a8:	eb ab                	jmp    803655 <devpipe_read+0x1c>
+
+008036aa <pipe>:
+{
+  8036aa:	55                   	push   %ebp
+  8036ab:	89 e5                	mov    %esp,%ebp
+  8036ad:	56                   	push   %esi
+  8036ae:	53                   	push   %ebx
+  8036af:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8036b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8036b5:	50                   	push   %eax
+  8036b6:	e8 35 dc ff ff       	call   8012f0 <fd_alloc>
+  8036bb:	89 c3                	mov    %eax,%ebx
+  8036bd:	83 c4 10             	add    $0x10,%esp
+  8036c0:	85 c0                	test   %eax,%eax
+  8036c2:	0f 88 23 01 00 00    	js     8037eb <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8036c8:	83 ec 04             	sub    $0x4,%esp
+  8036cb:	68 07 04 00 00       	push   $0x407
+  8036d0:	ff 75 f4             	push   -0xc(%ebp)
+  8036d3:	6a 00                	push   $0x0
+  8036d5:	e8 ee d7 ff ff       	call   800ec8 <sys_page_alloc>
+  8036da:	89 c3                	mov    %eax,%ebx
+  8036dc:	83 c4 10             	add    $0x10,%esp
+  8036df:	85 c0                	test   %eax,%eax
+  8036e1:	0f 88 04 01 00 00    	js     8037eb <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8036e7:	83 ec 0c             	sub    $0xc,%esp
+  8036ea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8036ed:	50                   	push   %eax
+  8036ee:	e8 fd db ff ff       	call   8012f0 <fd_alloc>
+  8036f3:	89 c3                	mov    %eax,%ebx
+  8036f5:	83 c4 10             	add    $0x10,%esp
+  8036f8:	85 c0                	test   %eax,%eax
+  8036fa:	0f 88 db 00 00 00    	js     8037db <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803700:	83 ec 04             	sub    $0x4,%esp
+  803703:	68 07 04 00 00       	push   $0x407
+  803708:	ff 75 f0             	push   -0x10(%ebp)
+  80370b:	6a 00                	push   $0x0
+  80370d:	e8 b6 d7 ff ff       	call   800ec8 <sys_page_alloc>
+  803712:	89 c3                	mov    %eax,%ebx
+  803714:	83 c4 10             	add    $0x10,%esp
+  803717:	85 c0                	test   %eax,%eax
+  803719:	0f 88 bc 00 00 00    	js     8037db <pipe+0x131>
+	va = fd2data(fd0);
+  80371f:	83 ec 0c             	sub    $0xc,%esp
+  803722:	ff 75 f4             	push   -0xc(%ebp)
+  803725:	e8 af db ff ff       	call   8012d9 <fd2data>
+  80372a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80372c:	83 c4 0c             	add    $0xc,%esp
+  80372f:	68 07 04 00 00       	push   $0x407
+  803734:	50                   	push   %eax
+  803735:	6a 00                	push   $0x0
+  803737:	e8 8c d7 ff ff       	call   800ec8 <sys_page_alloc>
+  80373c:	89 c3                	mov    %eax,%ebx
+  80373e:	83 c4 10             	add    $0x10,%esp
+  803741:	85 c0                	test   %eax,%eax
+  803743:	0f 88 82 00 00 00    	js     8037cb <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803749:	83 ec 0c             	sub    $0xc,%esp
+  80374c:	ff 75 f0             	push   -0x10(%ebp)
+  80374f:	e8 85 db ff ff       	call   8012d9 <fd2data>
+  803754:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80375b:	50                   	push   %eax
+  80375c:	6a 00                	push   $0x0
+  80375e:	56                   	push   %esi
+  80375f:	6a 00                	push   $0x0
+  803761:	e8 ad d7 ff ff       	call   800f13 <sys_page_map>
+  803766:	89 c3                	mov    %eax,%ebx
+  803768:	83 c4 20             	add    $0x20,%esp
+  80376b:	85 c0                	test   %eax,%eax
+  80376d:	78 4e                	js     8037bd <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80376f:	a1 00 68 80 00       	mov    0x806800,%eax
+  803774:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803777:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803779:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80377c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803783:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803786:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803788:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80378b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803792:	83 ec 0c             	sub    $0xc,%esp
+  803795:	ff 75 f4             	push   -0xc(%ebp)
+  803798:	e8 2c db ff ff       	call   8012c9 <fd2num>
+  80379d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8037a0:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8037a2:	83 c4 04             	add    $0x4,%esp
+  8037a5:	ff 75 f0             	push   -0x10(%ebp)
+  8037a8:	e8 1c db ff ff       	call   8012c9 <fd2num>
+  8037ad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8037b0:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8037b3:	83 c4 10             	add    $0x10,%esp
+  8037b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037bb:	eb 2e                	jmp    8037eb <pipe+0x141>
+	sys_page_unmap(0, va);
+  8037bd:	83 ec 08             	sub    $0x8,%esp
+  8037c0:	56                   	push   %esi
+  8037c1:	6a 00                	push   $0x0
+  8037c3:	e8 8d d7 ff ff       	call   800f55 <sys_page_unmap>
+  8037c8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8037cb:	83 ec 08             	sub    $0x8,%esp
+  8037ce:	ff 75 f0             	push   -0x10(%ebp)
+  8037d1:	6a 00                	push   $0x0
+  8037d3:	e8 7d d7 ff ff       	call   800f55 <sys_page_unmap>
+  8037d8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8037db:	83 ec 08             	sub    $0x8,%esp
+  8037de:	ff 75 f4             	push   -0xc(%ebp)
+  8037e1:	6a 00                	push   $0x0
+  8037e3:	e8 6d d7 ff ff       	call   800f55 <sys_page_unmap>
+  8037e8:	83 c4 10             	add    $0x10,%esp
+}
+  8037eb:	89 d8                	mov    %ebx,%eax
+  8037ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8037f0:	5b                   	pop    %ebx
+  8037f1:	5e                   	pop    %esi
+  8037f2:	5d                   	pop    %ebp
+  8037f3:	c3                   	ret
+
+008037f4 <pipeisclosed>:
+{
+  8037f4:	55                   	push   %ebp
+  8037f5:	89 e5                	mov    %esp,%ebp
+  8037f7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8037fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8037fd:	50                   	push   %eax
+  8037fe:	ff 75 08             	push   0x8(%ebp)
+  803801:	e8 40 db ff ff       	call   801346 <fd_lookup>
+  803806:	83 c4 10             	add    $0x10,%esp
+  803809:	85 c0                	test   %eax,%eax
+  80380b:	78 18                	js     803825 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80380d:	83 ec 0c             	sub    $0xc,%esp
+  803810:	ff 75 f4             	push   -0xc(%ebp)
+  803813:	e8 c1 da ff ff       	call   8012d9 <fd2data>
+  803818:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80381a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80381d:	e8 33 fd ff ff       	call   803555 <_pipeisclosed>
+  803822:	83 c4 10             	add    $0x10,%esp
+}
+  803825:	c9                   	leave
+  803826:	c3                   	ret
+
+00803827 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803827:	55                   	push   %ebp
+  803828:	89 e5                	mov    %esp,%ebp
+  80382a:	56                   	push   %esi
+  80382b:	53                   	push   %ebx
+  80382c:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  80382f:	85 f6                	test   %esi,%esi
+  803831:	74 16                	je     803849 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  803833:	89 f3                	mov    %esi,%ebx
+  803835:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80383b:	69 db 8c 00 00 00    	imul   $0x8c,%ebx,%ebx
+  803841:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803847:	eb 1b                	jmp    803864 <wait+0x3d>
+	assert(envid != 0);
+  803849:	68 5e 47 80 00       	push   $0x80475e
+  80384e:	68 00 46 80 00       	push   $0x804600
+  803853:	6a 09                	push   $0x9
+  803855:	68 69 47 80 00       	push   $0x804769
+  80385a:	e8 94 cb ff ff       	call   8003f3 <_panic>
+		sys_yield();
+  80385f:	e8 45 d6 ff ff       	call   800ea9 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803864:	8b 43 48             	mov    0x48(%ebx),%eax
+  803867:	39 f0                	cmp    %esi,%eax
+  803869:	75 07                	jne    803872 <wait+0x4b>
+  80386b:	8b 43 54             	mov    0x54(%ebx),%eax
+  80386e:	85 c0                	test   %eax,%eax
+  803870:	75 ed                	jne    80385f <wait+0x38>
+}
+  803872:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803875:	5b                   	pop    %ebx
+  803876:	5e                   	pop    %esi
+  803877:	5d                   	pop    %ebp
+  803878:	c3                   	ret
+
+00803879 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  803879:	55                   	push   %ebp
+  80387a:	89 e5                	mov    %esp,%ebp
+  80387c:	57                   	push   %edi
+  80387d:	56                   	push   %esi
+  80387e:	53                   	push   %ebx
+  80387f:	83 ec 20             	sub    $0x20,%esp
+  803882:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803885:	89 d7                	mov    %edx,%edi
+  803887:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  803889:	51                   	push   %ecx
+  80388a:	68 00 f0 7f 00       	push   $0x7ff000
+  80388f:	6a 00                	push   $0x0
+  803891:	e8 32 d6 ff ff       	call   800ec8 <sys_page_alloc>
+  803896:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803898:	83 c4 10             	add    $0x10,%esp
+  80389b:	85 c0                	test   %eax,%eax
+  80389d:	78 45                	js     8038e4 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  80389f:	83 ec 04             	sub    $0x4,%esp
+  8038a2:	68 00 10 00 00       	push   $0x1000
+  8038a7:	57                   	push   %edi
+  8038a8:	68 00 f0 7f 00       	push   $0x7ff000
+  8038ad:	e8 90 d3 ff ff       	call   800c42 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8038b2:	89 34 24             	mov    %esi,(%esp)
+  8038b5:	57                   	push   %edi
+  8038b6:	ff 75 e4             	push   -0x1c(%ebp)
+  8038b9:	68 00 f0 7f 00       	push   $0x7ff000
+  8038be:	6a 00                	push   $0x0
+  8038c0:	e8 4e d6 ff ff       	call   800f13 <sys_page_map>
+  8038c5:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8038c7:	83 c4 20             	add    $0x20,%esp
+  8038ca:	85 c0                	test   %eax,%eax
+  8038cc:	78 16                	js     8038e4 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8038ce:	83 ec 08             	sub    $0x8,%esp
+  8038d1:	68 00 f0 7f 00       	push   $0x7ff000
+  8038d6:	6a 00                	push   $0x0
+  8038d8:	e8 78 d6 ff ff       	call   800f55 <sys_page_unmap>
+  8038dd:	83 c4 10             	add    $0x10,%esp
+  8038e0:	85 c0                	test   %eax,%eax
+  8038e2:	75 0a                	jne    8038ee <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8038e4:	89 d8                	mov    %ebx,%eax
+  8038e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038e9:	5b                   	pop    %ebx
+  8038ea:	5e                   	pop    %esi
+  8038eb:	5f                   	pop    %edi
+  8038ec:	5d                   	pop    %ebp
+  8038ed:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8038ee:	68 74 47 80 00       	push   $0x804774
+  8038f3:	68 00 46 80 00       	push   $0x804600
+  8038f8:	6a 1b                	push   $0x1b
+  8038fa:	68 ec 47 80 00       	push   $0x8047ec
+  8038ff:	e8 ef ca ff ff       	call   8003f3 <_panic>
+
+00803904 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803904:	55                   	push   %ebp
+  803905:	89 e5                	mov    %esp,%ebp
+  803907:	53                   	push   %ebx
+  803908:	83 ec 04             	sub    $0x4,%esp
+  80390b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  80390e:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803910:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  803914:	74 21                	je     803937 <pgfault+0x33>
+  803916:	89 d0                	mov    %edx,%eax
+  803918:	c1 e8 16             	shr    $0x16,%eax
+  80391b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803922:	a8 01                	test   $0x1,%al
+  803924:	74 11                	je     803937 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803926:	89 d0                	mov    %edx,%eax
+  803928:	c1 e8 0c             	shr    $0xc,%eax
+  80392b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803932:	f6 c4 08             	test   $0x8,%ah
+  803935:	75 17                	jne    80394e <pgfault+0x4a>
+		if (pgfault_next) {
+  803937:	a1 04 c0 80 00       	mov    0x80c004,%eax
+  80393c:	85 c0                	test   %eax,%eax
+  80393e:	74 27                	je     803967 <pgfault+0x63>
+			pgfault_next(utf);
+  803940:	83 ec 0c             	sub    $0xc,%esp
+  803943:	53                   	push   %ebx
+  803944:	ff d0                	call   *%eax
+			return;
+  803946:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803949:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80394c:	c9                   	leave
+  80394d:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  80394e:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803954:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80395e:	e8 16 ff ff ff       	call   803879 <copy_page_to>
+  803963:	85 c0                	test   %eax,%eax
+  803965:	79 e2                	jns    803949 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803967:	a1 70 87 80 00       	mov    0x808770,%eax
+  80396c:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  80396f:	ff 73 28             	push   0x28(%ebx)
+  803972:	ff 33                	push   (%ebx)
+  803974:	50                   	push   %eax
+  803975:	68 98 47 80 00       	push   $0x804798
+  80397a:	e8 4f cb ff ff       	call   8004ce <cprintf>
+	sys_env_destroy(0);
+  80397f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803986:	e8 ae d4 ff ff       	call   800e39 <sys_env_destroy>
+  80398b:	83 c4 10             	add    $0x10,%esp
+  80398e:	eb b9                	jmp    803949 <pgfault+0x45>
+
+00803990 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803990:	55                   	push   %ebp
+  803991:	89 e5                	mov    %esp,%ebp
+  803993:	53                   	push   %ebx
+  803994:	83 ec 04             	sub    $0x4,%esp
+  803997:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80399a:	a1 08 c0 80 00       	mov    0x80c008,%eax
+  80399f:	3d 04 39 80 00       	cmp    $0x803904,%eax
+  8039a4:	74 15                	je     8039bb <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8039a6:	a3 04 c0 80 00       	mov    %eax,0x80c004
+		set_pgfault_handler(pgfault);
+  8039ab:	83 ec 0c             	sub    $0xc,%esp
+  8039ae:	68 04 39 80 00       	push   $0x803904
+  8039b3:	e8 fb 03 00 00       	call   803db3 <set_pgfault_handler>
+  8039b8:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8039bb:	83 ec 0c             	sub    $0xc,%esp
+  8039be:	68 05 08 00 00       	push   $0x805
+  8039c3:	53                   	push   %ebx
+  8039c4:	6a 00                	push   $0x0
+  8039c6:	53                   	push   %ebx
+  8039c7:	6a 00                	push   $0x0
+  8039c9:	e8 45 d5 ff ff       	call   800f13 <sys_page_map>
+}
+  8039ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8039d1:	c9                   	leave
+  8039d2:	c3                   	ret
+
+008039d3 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8039d3:	55                   	push   %ebp
+  8039d4:	89 e5                	mov    %esp,%ebp
+  8039d6:	57                   	push   %edi
+  8039d7:	56                   	push   %esi
+  8039d8:	53                   	push   %ebx
+  8039d9:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8039dc:	68 04 39 80 00       	push   $0x803904
+  8039e1:	e8 cd 03 00 00       	call   803db3 <set_pgfault_handler>
+  8039e6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8039eb:	cd 30                	int    $0x30
+  8039ed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8039f0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8039f3:	83 c4 10             	add    $0x10,%esp
+  8039f6:	85 c0                	test   %eax,%eax
+  8039f8:	0f 88 6b 01 00 00    	js     803b69 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8039fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803a03:	75 37                	jne    803a3c <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803a05:	e8 78 d4 ff ff       	call   800e82 <sys_getenvid>
+  803a0a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803a0f:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803a15:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a1a:	a3 70 87 80 00       	mov    %eax,0x808770
+		return 0;
+  803a1f:	e9 45 01 00 00       	jmp    803b69 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803a24:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803a2a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803a30:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803a36:	0f 87 ba 00 00 00    	ja     803af6 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803a3c:	89 d8                	mov    %ebx,%eax
+  803a3e:	c1 e8 16             	shr    $0x16,%eax
+  803a41:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803a48:	a8 01                	test   $0x1,%al
+  803a4a:	74 d8                	je     803a24 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803a4c:	89 d8                	mov    %ebx,%eax
+  803a4e:	c1 e8 0c             	shr    $0xc,%eax
+  803a51:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803a58:	f6 c2 01             	test   $0x1,%dl
+  803a5b:	74 cd                	je     803a2a <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803a5d:	89 da                	mov    %ebx,%edx
+  803a5f:	80 e6 df             	and    $0xdf,%dh
+  803a62:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803a68:	74 c0                	je     803a2a <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803a6a:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803a6c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803a73:	f6 c6 04             	test   $0x4,%dh
+  803a76:	75 53                	jne    803acb <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803a78:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803a7f:	f6 c6 08             	test   $0x8,%dh
+  803a82:	75 0c                	jne    803a90 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803a84:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803a8b:	f6 c2 02             	test   $0x2,%dl
+  803a8e:	74 3b                	je     803acb <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803a90:	83 ec 0c             	sub    $0xc,%esp
+  803a93:	68 05 08 00 00       	push   $0x805
+  803a98:	57                   	push   %edi
+  803a99:	ff 75 e4             	push   -0x1c(%ebp)
+  803a9c:	57                   	push   %edi
+  803a9d:	6a 00                	push   $0x0
+  803a9f:	e8 6f d4 ff ff       	call   800f13 <sys_page_map>
+  803aa4:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803aa6:	83 c4 20             	add    $0x20,%esp
+  803aa9:	85 c0                	test   %eax,%eax
+  803aab:	0f 88 a7 00 00 00    	js     803b58 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803ab1:	83 ec 0c             	sub    $0xc,%esp
+  803ab4:	68 05 08 00 00       	push   $0x805
+  803ab9:	57                   	push   %edi
+  803aba:	6a 00                	push   $0x0
+  803abc:	57                   	push   %edi
+  803abd:	6a 00                	push   $0x0
+  803abf:	e8 4f d4 ff ff       	call   800f13 <sys_page_map>
+  803ac4:	89 c6                	mov    %eax,%esi
+	return r;
+  803ac6:	83 c4 20             	add    $0x20,%esp
+  803ac9:	eb 21                	jmp    803aec <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803acb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803ad2:	83 ec 0c             	sub    $0xc,%esp
+  803ad5:	25 07 0e 00 00       	and    $0xe07,%eax
+  803ada:	50                   	push   %eax
+  803adb:	57                   	push   %edi
+  803adc:	ff 75 e4             	push   -0x1c(%ebp)
+  803adf:	57                   	push   %edi
+  803ae0:	6a 00                	push   $0x0
+  803ae2:	e8 2c d4 ff ff       	call   800f13 <sys_page_map>
+  803ae7:	89 c6                	mov    %eax,%esi
+  803ae9:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  803aec:	85 f6                	test   %esi,%esi
+  803aee:	0f 89 36 ff ff ff    	jns    803a2a <fork+0x57>
+  803af4:	eb 62                	jmp    803b58 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803af6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803afb:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  803b00:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803b03:	89 f8                	mov    %edi,%eax
+  803b05:	e8 6f fd ff ff       	call   803879 <copy_page_to>
+  803b0a:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803b0c:	85 c0                	test   %eax,%eax
+  803b0e:	78 48                	js     803b58 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803b10:	83 ec 04             	sub    $0x4,%esp
+  803b13:	6a 07                	push   $0x7
+  803b15:	68 00 f0 bf ee       	push   $0xeebff000
+  803b1a:	57                   	push   %edi
+  803b1b:	e8 a8 d3 ff ff       	call   800ec8 <sys_page_alloc>
+  803b20:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803b22:	83 c4 10             	add    $0x10,%esp
+  803b25:	85 c0                	test   %eax,%eax
+  803b27:	78 2f                	js     803b58 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803b29:	a1 70 87 80 00       	mov    0x808770,%eax
+  803b2e:	8b 40 64             	mov    0x64(%eax),%eax
+  803b31:	83 ec 08             	sub    $0x8,%esp
+  803b34:	50                   	push   %eax
+  803b35:	57                   	push   %edi
+  803b36:	e8 f8 d4 ff ff       	call   801033 <sys_env_set_pgfault_upcall>
+  803b3b:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803b3d:	83 c4 10             	add    $0x10,%esp
+  803b40:	85 c0                	test   %eax,%eax
+  803b42:	78 14                	js     803b58 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803b44:	83 ec 08             	sub    $0x8,%esp
+  803b47:	6a 02                	push   $0x2
+  803b49:	57                   	push   %edi
+  803b4a:	e8 50 d4 ff ff       	call   800f9f <sys_env_set_status>
+  803b4f:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803b51:	83 c4 10             	add    $0x10,%esp
+  803b54:	85 c0                	test   %eax,%eax
+  803b56:	79 11                	jns    803b69 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803b58:	83 ec 0c             	sub    $0xc,%esp
+  803b5b:	ff 75 e0             	push   -0x20(%ebp)
+  803b5e:	e8 d6 d2 ff ff       	call   800e39 <sys_env_destroy>
+	return r;
+  803b63:	83 c4 10             	add    $0x10,%esp
+  803b66:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803b69:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803b6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b6f:	5b                   	pop    %ebx
+  803b70:	5e                   	pop    %esi
+  803b71:	5f                   	pop    %edi
+  803b72:	5d                   	pop    %ebp
+  803b73:	c3                   	ret
+
+00803b74 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803b74:	55                   	push   %ebp
+  803b75:	89 e5                	mov    %esp,%ebp
+  803b77:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803b7a:	68 f7 47 80 00       	push   $0x8047f7
+  803b7f:	68 bf 00 00 00       	push   $0xbf
+  803b84:	68 ec 47 80 00       	push   $0x8047ec
+  803b89:	e8 65 c8 ff ff       	call   8003f3 <_panic>
+
+00803b8e <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803b8e:	55                   	push   %ebp
+  803b8f:	89 e5                	mov    %esp,%ebp
+  803b91:	56                   	push   %esi
+  803b92:	53                   	push   %ebx
+  803b93:	8b 75 08             	mov    0x8(%ebp),%esi
+  803b96:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803b99:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803b9c:	85 c0                	test   %eax,%eax
+  803b9e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803ba3:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803ba6:	83 ec 0c             	sub    $0xc,%esp
+  803ba9:	50                   	push   %eax
+  803baa:	e8 61 d5 ff ff       	call   801110 <sys_ipc_recv>
+	if (from_env_store)
+  803baf:	83 c4 10             	add    $0x10,%esp
+  803bb2:	85 f6                	test   %esi,%esi
+  803bb4:	74 14                	je     803bca <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803bb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bbb:	85 c0                	test   %eax,%eax
+  803bbd:	75 09                	jne    803bc8 <ipc_recv+0x3a>
+  803bbf:	8b 15 70 87 80 00    	mov    0x808770,%edx
+  803bc5:	8b 52 74             	mov    0x74(%edx),%edx
+  803bc8:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803bca:	85 db                	test   %ebx,%ebx
+  803bcc:	74 25                	je     803bf3 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803bce:	85 c0                	test   %eax,%eax
+  803bd0:	74 0d                	je     803bdf <ipc_recv+0x51>
+  803bd2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803bd8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bdb:	5b                   	pop    %ebx
+  803bdc:	5e                   	pop    %esi
+  803bdd:	5d                   	pop    %ebp
+  803bde:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803bdf:	a1 70 87 80 00       	mov    0x808770,%eax
+  803be4:	8b 40 78             	mov    0x78(%eax),%eax
+  803be7:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803be9:	a1 70 87 80 00       	mov    0x808770,%eax
+  803bee:	8b 40 70             	mov    0x70(%eax),%eax
+  803bf1:	eb e5                	jmp    803bd8 <ipc_recv+0x4a>
+  803bf3:	85 c0                	test   %eax,%eax
+  803bf5:	75 e1                	jne    803bd8 <ipc_recv+0x4a>
+  803bf7:	eb f0                	jmp    803be9 <ipc_recv+0x5b>
+
+00803bf9 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803bf9:	55                   	push   %ebp
+  803bfa:	89 e5                	mov    %esp,%ebp
+  803bfc:	57                   	push   %edi
+  803bfd:	56                   	push   %esi
+  803bfe:	53                   	push   %ebx
+  803bff:	83 ec 0c             	sub    $0xc,%esp
+  803c02:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803c05:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803c08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803c0b:	85 db                	test   %ebx,%ebx
+  803c0d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803c12:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803c15:	ff 75 14             	push   0x14(%ebp)
+  803c18:	53                   	push   %ebx
+  803c19:	56                   	push   %esi
+  803c1a:	57                   	push   %edi
+  803c1b:	e8 5d d4 ff ff       	call   80107d <sys_ipc_try_send>
+  803c20:	83 c4 10             	add    $0x10,%esp
+  803c23:	85 c0                	test   %eax,%eax
+  803c25:	74 22                	je     803c49 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803c27:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803c2a:	75 07                	jne    803c33 <ipc_send+0x3a>
+		sys_yield();
+  803c2c:	e8 78 d2 ff ff       	call   800ea9 <sys_yield>
+  803c31:	eb e2                	jmp    803c15 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803c33:	68 0d 48 80 00       	push   $0x80480d
+  803c38:	68 00 46 80 00       	push   $0x804600
+  803c3d:	6a 39                	push   $0x39
+  803c3f:	68 22 48 80 00       	push   $0x804822
+  803c44:	e8 aa c7 ff ff       	call   8003f3 <_panic>
+	}
+}
+  803c49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c4c:	5b                   	pop    %ebx
+  803c4d:	5e                   	pop    %esi
+  803c4e:	5f                   	pop    %edi
+  803c4f:	5d                   	pop    %ebp
+  803c50:	c3                   	ret
+
+00803c51 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803c51:	55                   	push   %ebp
+  803c52:	89 e5                	mov    %esp,%ebp
+  803c54:	57                   	push   %edi
+  803c55:	56                   	push   %esi
+  803c56:	53                   	push   %ebx
+  803c57:	83 ec 10             	sub    $0x10,%esp
+  803c5a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803c5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803c60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803c63:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803c66:	85 c0                	test   %eax,%eax
+  803c68:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803c6d:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803c70:	6a 00                	push   $0x0
+  803c72:	ff 33                	push   (%ebx)
+  803c74:	50                   	push   %eax
+  803c75:	e8 53 d4 ff ff       	call   8010cd <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803c7a:	83 c4 10             	add    $0x10,%esp
+  803c7d:	85 c0                	test   %eax,%eax
+  803c7f:	75 3c                	jne    803cbd <ipc_recvv+0x6c>
+  803c81:	8b 15 70 87 80 00    	mov    0x808770,%edx
+  803c87:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803c8a:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803c8c:	85 ff                	test   %edi,%edi
+  803c8e:	74 4e                	je     803cde <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803c90:	8b 15 70 87 80 00    	mov    0x808770,%edx
+  803c96:	8b 52 74             	mov    0x74(%edx),%edx
+  803c99:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803c9b:	85 f6                	test   %esi,%esi
+  803c9d:	74 18                	je     803cb7 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803c9f:	85 c0                	test   %eax,%eax
+  803ca1:	75 2d                	jne    803cd0 <ipc_recvv+0x7f>
+  803ca3:	a1 70 87 80 00       	mov    0x808770,%eax
+  803ca8:	8b 40 78             	mov    0x78(%eax),%eax
+  803cab:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803cad:	a1 70 87 80 00       	mov    0x808770,%eax
+  803cb2:	8b 40 70             	mov    0x70(%eax),%eax
+  803cb5:	eb 1f                	jmp    803cd6 <ipc_recvv+0x85>
+  803cb7:	85 c0                	test   %eax,%eax
+  803cb9:	75 1b                	jne    803cd6 <ipc_recvv+0x85>
+  803cbb:	eb f0                	jmp    803cad <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803cbd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803cc3:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803cc8:	85 ff                	test   %edi,%edi
+  803cca:	75 cd                	jne    803c99 <ipc_recvv+0x48>
+	if (perm_store)
+  803ccc:	85 f6                	test   %esi,%esi
+  803cce:	74 e7                	je     803cb7 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803cd0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803cd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cd9:	5b                   	pop    %ebx
+  803cda:	5e                   	pop    %esi
+  803cdb:	5f                   	pop    %edi
+  803cdc:	5d                   	pop    %ebp
+  803cdd:	c3                   	ret
+	if (perm_store)
+  803cde:	85 f6                	test   %esi,%esi
+  803ce0:	75 bd                	jne    803c9f <ipc_recvv+0x4e>
+  803ce2:	eb c9                	jmp    803cad <ipc_recvv+0x5c>
+
+00803ce4 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803ce4:	55                   	push   %ebp
+  803ce5:	89 e5                	mov    %esp,%ebp
+  803ce7:	57                   	push   %edi
+  803ce8:	56                   	push   %esi
+  803ce9:	53                   	push   %ebx
+  803cea:	83 ec 0c             	sub    $0xc,%esp
+  803ced:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803cf0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803cf3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  803cf6:	ff 75 14             	push   0x14(%ebp)
+  803cf9:	53                   	push   %ebx
+  803cfa:	56                   	push   %esi
+  803cfb:	57                   	push   %edi
+  803cfc:	e8 a4 d3 ff ff       	call   8010a5 <sys_ipc_try_sendv>
+  803d01:	83 c4 10             	add    $0x10,%esp
+  803d04:	85 c0                	test   %eax,%eax
+  803d06:	74 22                	je     803d2a <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803d08:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803d0b:	75 07                	jne    803d14 <ipc_sendv+0x30>
+		sys_yield();
+  803d0d:	e8 97 d1 ff ff       	call   800ea9 <sys_yield>
+  803d12:	eb e2                	jmp    803cf6 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803d14:	68 0d 48 80 00       	push   $0x80480d
+  803d19:	68 00 46 80 00       	push   $0x804600
+  803d1e:	6a 5c                	push   $0x5c
+  803d20:	68 22 48 80 00       	push   $0x804822
+  803d25:	e8 c9 c6 ff ff       	call   8003f3 <_panic>
+	}
+}
+  803d2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d2d:	5b                   	pop    %ebx
+  803d2e:	5e                   	pop    %esi
+  803d2f:	5f                   	pop    %edi
+  803d30:	5d                   	pop    %ebp
+  803d31:	c3                   	ret
+
+00803d32 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803d32:	55                   	push   %ebp
+  803d33:	89 e5                	mov    %esp,%ebp
+  803d35:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803d38:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803d3d:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803d43:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803d49:	8b 52 50             	mov    0x50(%edx),%edx
+  803d4c:	39 ca                	cmp    %ecx,%edx
+  803d4e:	74 11                	je     803d61 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803d50:	83 c0 01             	add    $0x1,%eax
+  803d53:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803d58:	75 e3                	jne    803d3d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803d5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d5f:	eb 0e                	jmp    803d6f <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803d61:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803d67:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803d6c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803d6f:	5d                   	pop    %ebp
+  803d70:	c3                   	ret
+
+00803d71 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803d71:	55                   	push   %ebp
+  803d72:	89 e5                	mov    %esp,%ebp
+  803d74:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803d77:	89 c2                	mov    %eax,%edx
+  803d79:	c1 ea 16             	shr    $0x16,%edx
+  803d7c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803d83:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803d88:	f6 c1 01             	test   $0x1,%cl
+  803d8b:	74 22                	je     803daf <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803d8d:	c1 e8 0c             	shr    $0xc,%eax
+  803d90:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803d97:	a8 01                	test   $0x1,%al
+  803d99:	74 14                	je     803daf <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803d9b:	c1 e8 0c             	shr    $0xc,%eax
+  803d9e:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803da1:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803da8:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803dac:	0f b7 d2             	movzwl %dx,%edx
+}
+  803daf:	89 d0                	mov    %edx,%eax
+  803db1:	5d                   	pop    %ebp
+  803db2:	c3                   	ret
+
+00803db3 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803db3:	55                   	push   %ebp
+  803db4:	89 e5                	mov    %esp,%ebp
+  803db6:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803db9:	83 3d 08 c0 80 00 00 	cmpl   $0x0,0x80c008
+  803dc0:	74 0a                	je     803dcc <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803dc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dc5:	a3 08 c0 80 00       	mov    %eax,0x80c008
+}
+  803dca:	c9                   	leave
+  803dcb:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803dcc:	83 ec 04             	sub    $0x4,%esp
+  803dcf:	6a 07                	push   $0x7
+  803dd1:	68 00 f0 bf ee       	push   $0xeebff000
+  803dd6:	6a 00                	push   $0x0
+  803dd8:	e8 eb d0 ff ff       	call   800ec8 <sys_page_alloc>
+  803ddd:	83 c4 10             	add    $0x10,%esp
+  803de0:	85 c0                	test   %eax,%eax
+  803de2:	75 2c                	jne    803e10 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803de4:	83 ec 08             	sub    $0x8,%esp
+  803de7:	68 26 3e 80 00       	push   $0x803e26
+  803dec:	6a 00                	push   $0x0
+  803dee:	e8 40 d2 ff ff       	call   801033 <sys_env_set_pgfault_upcall>
+  803df3:	83 c4 10             	add    $0x10,%esp
+  803df6:	85 c0                	test   %eax,%eax
+  803df8:	74 c8                	je     803dc2 <set_pgfault_handler+0xf>
+  803dfa:	68 74 48 80 00       	push   $0x804874
+  803dff:	68 00 46 80 00       	push   $0x804600
+  803e04:	6a 20                	push   $0x20
+  803e06:	68 a4 48 80 00       	push   $0x8048a4
+  803e0b:	e8 e3 c5 ff ff       	call   8003f3 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803e10:	68 2c 48 80 00       	push   $0x80482c
+  803e15:	68 00 46 80 00       	push   $0x804600
+  803e1a:	6a 1e                	push   $0x1e
+  803e1c:	68 a4 48 80 00       	push   $0x8048a4
+  803e21:	e8 cd c5 ff ff       	call   8003f3 <_panic>
+
+00803e26 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803e26:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803e27:	a1 08 c0 80 00       	mov    0x80c008,%eax
+	call *%eax
+  803e2c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803e2e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803e31:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803e36:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803e3b:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803e3f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803e42:	83 c4 08             	add    $0x8,%esp
+	popal
+  803e45:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803e46:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803e49:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803e4a:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803e4b:	c3                   	ret
+
+00803e4c <dm>:
+  803e4c:	55                   	push   %ebp
+  803e4d:	57                   	push   %edi
+  803e4e:	56                   	push   %esi
+  803e4f:	53                   	push   %ebx
+  803e50:	83 ec 24             	sub    $0x24,%esp
+  803e53:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803e57:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803e5b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803e5f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803e63:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803e67:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803e6b:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803e6f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803e74:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e79:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e7e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803e85:	00 
+  803e86:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803e8d:	00 
+  803e8e:	89 fb                	mov    %edi,%ebx
+  803e90:	eb 08                	jmp    803e9a <dm+0x4e>
+  803e92:	83 e9 01             	sub    $0x1,%ecx
+  803e95:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803e98:	74 68                	je     803f02 <dm+0xb6>
+  803e9a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803e9e:	01 c0                	add    %eax,%eax
+  803ea0:	89 c6                	mov    %eax,%esi
+  803ea2:	89 d7                	mov    %edx,%edi
+  803ea4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803ea8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803eac:	0f ad d0             	shrd   %cl,%edx,%eax
+  803eaf:	d3 ea                	shr    %cl,%edx
+  803eb1:	f6 c1 20             	test   $0x20,%cl
+  803eb4:	74 04                	je     803eba <dm+0x6e>
+  803eb6:	89 d0                	mov    %edx,%eax
+  803eb8:	31 d2                	xor    %edx,%edx
+  803eba:	83 e0 01             	and    $0x1,%eax
+  803ebd:	89 04 24             	mov    %eax,(%esp)
+  803ec0:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803ec7:	00 
+  803ec8:	8b 04 24             	mov    (%esp),%eax
+  803ecb:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803ecf:	09 f0                	or     %esi,%eax
+  803ed1:	09 fa                	or     %edi,%edx
+  803ed3:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803ed7:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803edb:	39 f0                	cmp    %esi,%eax
+  803edd:	89 d5                	mov    %edx,%ebp
+  803edf:	19 fd                	sbb    %edi,%ebp
+  803ee1:	72 af                	jb     803e92 <dm+0x46>
+  803ee3:	29 f0                	sub    %esi,%eax
+  803ee5:	19 fa                	sbb    %edi,%edx
+  803ee7:	89 cf                	mov    %ecx,%edi
+  803ee9:	c1 ef 05             	shr    $0x5,%edi
+  803eec:	83 e7 01             	and    $0x1,%edi
+  803eef:	89 fe                	mov    %edi,%esi
+  803ef1:	83 f6 01             	xor    $0x1,%esi
+  803ef4:	d3 e6                	shl    %cl,%esi
+  803ef6:	d3 e7                	shl    %cl,%edi
+  803ef8:	09 74 24 18          	or     %esi,0x18(%esp)
+  803efc:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803f00:	eb 90                	jmp    803e92 <dm+0x46>
+  803f02:	85 db                	test   %ebx,%ebx
+  803f04:	74 05                	je     803f0b <dm+0xbf>
+  803f06:	89 03                	mov    %eax,(%ebx)
+  803f08:	89 53 04             	mov    %edx,0x4(%ebx)
+  803f0b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f0f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f13:	83 c4 24             	add    $0x24,%esp
+  803f16:	5b                   	pop    %ebx
+  803f17:	5e                   	pop    %esi
+  803f18:	5f                   	pop    %edi
+  803f19:	5d                   	pop    %ebp
+  803f1a:	c3                   	ret
+
+00803f1b <__udivdi3>:
+  803f1b:	83 ec 08             	sub    $0x8,%esp
+  803f1e:	6a 00                	push   $0x0
+  803f20:	ff 74 24 1c          	push   0x1c(%esp)
+  803f24:	ff 74 24 1c          	push   0x1c(%esp)
+  803f28:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f2c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f30:	e8 17 ff ff ff       	call   803e4c <dm>
+  803f35:	83 c4 14             	add    $0x14,%esp
+  803f38:	c3                   	ret
+
+00803f39 <__umoddi3>:
+  803f39:	83 ec 18             	sub    $0x18,%esp
+  803f3c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803f40:	50                   	push   %eax
+  803f41:	ff 74 24 2c          	push   0x2c(%esp)
+  803f45:	ff 74 24 2c          	push   0x2c(%esp)
+  803f49:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803f4d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803f51:	e8 f6 fe ff ff       	call   803e4c <dm>
+  803f56:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f5a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f5e:	83 c4 24             	add    $0x24,%esp
+  803f61:	c3                   	ret
+
+00803f62 <__divdi3>:
+  803f62:	53                   	push   %ebx
+  803f63:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803f67:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803f6b:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803f6f:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803f73:	85 d2                	test   %edx,%edx
+  803f75:	78 15                	js     803f8c <__divdi3+0x2a>
+  803f77:	85 db                	test   %ebx,%ebx
+  803f79:	78 34                	js     803faf <__divdi3+0x4d>
+  803f7b:	83 ec 04             	sub    $0x4,%esp
+  803f7e:	6a 00                	push   $0x0
+  803f80:	53                   	push   %ebx
+  803f81:	51                   	push   %ecx
+  803f82:	e8 c5 fe ff ff       	call   803e4c <dm>
+  803f87:	83 c4 10             	add    $0x10,%esp
+  803f8a:	eb 21                	jmp    803fad <__divdi3+0x4b>
+  803f8c:	f7 d8                	neg    %eax
+  803f8e:	83 d2 00             	adc    $0x0,%edx
+  803f91:	f7 da                	neg    %edx
+  803f93:	85 db                	test   %ebx,%ebx
+  803f95:	78 30                	js     803fc7 <__divdi3+0x65>
+  803f97:	83 ec 04             	sub    $0x4,%esp
+  803f9a:	6a 00                	push   $0x0
+  803f9c:	53                   	push   %ebx
+  803f9d:	51                   	push   %ecx
+  803f9e:	e8 a9 fe ff ff       	call   803e4c <dm>
+  803fa3:	83 c4 10             	add    $0x10,%esp
+  803fa6:	f7 d8                	neg    %eax
+  803fa8:	83 d2 00             	adc    $0x0,%edx
+  803fab:	f7 da                	neg    %edx
+  803fad:	5b                   	pop    %ebx
+  803fae:	c3                   	ret
+  803faf:	83 ec 04             	sub    $0x4,%esp
+  803fb2:	6a 00                	push   $0x0
+  803fb4:	f7 d9                	neg    %ecx
+  803fb6:	83 d3 00             	adc    $0x0,%ebx
+  803fb9:	f7 db                	neg    %ebx
+  803fbb:	53                   	push   %ebx
+  803fbc:	51                   	push   %ecx
+  803fbd:	e8 8a fe ff ff       	call   803e4c <dm>
+  803fc2:	83 c4 10             	add    $0x10,%esp
+  803fc5:	eb df                	jmp    803fa6 <__divdi3+0x44>
+  803fc7:	83 ec 04             	sub    $0x4,%esp
+  803fca:	6a 00                	push   $0x0
+  803fcc:	f7 d9                	neg    %ecx
+  803fce:	83 d3 00             	adc    $0x0,%ebx
+  803fd1:	f7 db                	neg    %ebx
+  803fd3:	53                   	push   %ebx
+  803fd4:	51                   	push   %ecx
+  803fd5:	e8 72 fe ff ff       	call   803e4c <dm>
+  803fda:	83 c4 10             	add    $0x10,%esp
+  803fdd:	eb ce                	jmp    803fad <__divdi3+0x4b>
+
+00803fdf <__moddi3>:
+  803fdf:	55                   	push   %ebp
+  803fe0:	57                   	push   %edi
+  803fe1:	56                   	push   %esi
+  803fe2:	53                   	push   %ebx
+  803fe3:	83 ec 24             	sub    $0x24,%esp
+  803fe6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803fea:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803fee:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803ff2:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803ff6:	85 d2                	test   %edx,%edx
+  803ff8:	78 3b                	js     804035 <__moddi3+0x56>
+  803ffa:	83 ec 04             	sub    $0x4,%esp
+  803ffd:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804001:	56                   	push   %esi
+  804002:	89 ce                	mov    %ecx,%esi
+  804004:	f7 de                	neg    %esi
+  804006:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80400a:	89 de                	mov    %ebx,%esi
+  80400c:	83 d6 00             	adc    $0x0,%esi
+  80400f:	f7 de                	neg    %esi
+  804011:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804015:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804019:	0f 48 f1             	cmovs  %ecx,%esi
+  80401c:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804021:	53                   	push   %ebx
+  804022:	56                   	push   %esi
+  804023:	e8 24 fe ff ff       	call   803e4c <dm>
+  804028:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80402c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804030:	83 c4 10             	add    $0x10,%esp
+  804033:	eb 47                	jmp    80407c <__moddi3+0x9d>
+  804035:	f7 d8                	neg    %eax
+  804037:	83 d2 00             	adc    $0x0,%edx
+  80403a:	f7 da                	neg    %edx
+  80403c:	83 ec 04             	sub    $0x4,%esp
+  80403f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804043:	56                   	push   %esi
+  804044:	89 cf                	mov    %ecx,%edi
+  804046:	f7 df                	neg    %edi
+  804048:	89 de                	mov    %ebx,%esi
+  80404a:	83 d6 00             	adc    $0x0,%esi
+  80404d:	f7 de                	neg    %esi
+  80404f:	0f 49 cf             	cmovns %edi,%ecx
+  804052:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804056:	0f 49 de             	cmovns %esi,%ebx
+  804059:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80405d:	ff 74 24 0c          	push   0xc(%esp)
+  804061:	ff 74 24 0c          	push   0xc(%esp)
+  804065:	e8 e2 fd ff ff       	call   803e4c <dm>
+  80406a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80406e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804072:	f7 d8                	neg    %eax
+  804074:	83 d2 00             	adc    $0x0,%edx
+  804077:	f7 da                	neg    %edx
+  804079:	83 c4 10             	add    $0x10,%esp
+  80407c:	83 c4 24             	add    $0x24,%esp
+  80407f:	5b                   	pop    %ebx
+  804080:	5e                   	pop    %esi
+  804081:	5f                   	pop    %edi
+  804082:	5d                   	pop    %ebp
+  804083:	c3                   	ret
@@ -0,0 +1,8331 @@
+
+obj/user/ls.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 bf 02 00 00       	call   8002f0 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ls1>:
+	close(fd);
+}
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	const char *sep;
+
+	if(flag['l'])
+  80003e:	83 3d b0 71 80 00 00 	cmpl   $0x0,0x8071b0
+  800045:	74 20                	je     800067 <ls1+0x34>
+		printf("%11d %c ", size, isdir ? 'd' : '-');
+  800047:	89 f0                	mov    %esi,%eax
+  800049:	3c 01                	cmp    $0x1,%al
+  80004b:	19 c0                	sbb    %eax,%eax
+  80004d:	83 e0 c9             	and    $0xffffffc9,%eax
+  800050:	83 c0 64             	add    $0x64,%eax
+  800053:	83 ec 04             	sub    $0x4,%esp
+  800056:	50                   	push   %eax
+  800057:	ff 75 10             	push   0x10(%ebp)
+  80005a:	68 62 3c 80 00       	push   $0x803c62
+  80005f:	e8 a7 2a 00 00       	call   802b0b <printf>
+  800064:	83 c4 10             	add    $0x10,%esp
+	if(prefix) {
+  800067:	85 db                	test   %ebx,%ebx
+  800069:	74 1c                	je     800087 <ls1+0x54>
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+			sep = "/";
+		else
+			sep = "";
+  80006b:	b8 ae 3c 80 00       	mov    $0x803cae,%eax
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  800070:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800073:	75 4b                	jne    8000c0 <ls1+0x8d>
+		printf("%s%s", prefix, sep);
+  800075:	83 ec 04             	sub    $0x4,%esp
+  800078:	50                   	push   %eax
+  800079:	53                   	push   %ebx
+  80007a:	68 6b 3c 80 00       	push   $0x803c6b
+  80007f:	e8 87 2a 00 00       	call   802b0b <printf>
+  800084:	83 c4 10             	add    $0x10,%esp
+	}
+	printf("%s", name);
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	ff 75 14             	push   0x14(%ebp)
+  80008d:	68 12 41 80 00       	push   $0x804112
+  800092:	e8 74 2a 00 00       	call   802b0b <printf>
+	if(flag['F'] && isdir)
+  800097:	83 c4 10             	add    $0x10,%esp
+  80009a:	83 3d 18 71 80 00 00 	cmpl   $0x0,0x807118
+  8000a1:	74 06                	je     8000a9 <ls1+0x76>
+  8000a3:	89 f0                	mov    %esi,%eax
+  8000a5:	84 c0                	test   %al,%al
+  8000a7:	75 37                	jne    8000e0 <ls1+0xad>
+		printf("/");
+	printf("\n");
+  8000a9:	83 ec 0c             	sub    $0xc,%esp
+  8000ac:	68 ad 3c 80 00       	push   $0x803cad
+  8000b1:	e8 55 2a 00 00       	call   802b0b <printf>
+}
+  8000b6:	83 c4 10             	add    $0x10,%esp
+  8000b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000bc:	5b                   	pop    %ebx
+  8000bd:	5e                   	pop    %esi
+  8000be:	5d                   	pop    %ebp
+  8000bf:	c3                   	ret
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  8000c0:	83 ec 0c             	sub    $0xc,%esp
+  8000c3:	53                   	push   %ebx
+  8000c4:	e8 18 09 00 00       	call   8009e1 <strlen>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+			sep = "/";
+  8000cc:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%ebx,%eax,1)
+  8000d1:	b8 ae 3c 80 00       	mov    $0x803cae,%eax
+  8000d6:	ba 60 3c 80 00       	mov    $0x803c60,%edx
+  8000db:	0f 45 c2             	cmovne %edx,%eax
+  8000de:	eb 95                	jmp    800075 <ls1+0x42>
+		printf("/");
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  8000e3:	68 60 3c 80 00       	push   $0x803c60
+  8000e8:	e8 1e 2a 00 00       	call   802b0b <printf>
+  8000ed:	83 c4 10             	add    $0x10,%esp
+  8000f0:	eb b7                	jmp    8000a9 <ls1+0x76>
+
+008000f2 <lsdir>:
+{
+  8000f2:	55                   	push   %ebp
+  8000f3:	89 e5                	mov    %esp,%ebp
+  8000f5:	57                   	push   %edi
+  8000f6:	56                   	push   %esi
+  8000f7:	53                   	push   %ebx
+  8000f8:	83 ec 24             	sub    $0x24,%esp
+  8000fb:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  8000fe:	68 00 10 00 00       	push   $0x1000
+  800103:	57                   	push   %edi
+  800104:	e8 08 20 00 00       	call   802111 <open>
+  800109:	83 c4 10             	add    $0x10,%esp
+  80010c:	85 c0                	test   %eax,%eax
+  80010e:	78 08                	js     800118 <lsdir+0x26>
+  800110:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800113:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800116:	eb 4e                	jmp    800166 <lsdir+0x74>
+		panic("open %s: %e", path, fd);
+  800118:	83 ec 0c             	sub    $0xc,%esp
+  80011b:	50                   	push   %eax
+  80011c:	57                   	push   %edi
+  80011d:	68 70 3c 80 00       	push   $0x803c70
+  800122:	6a 1e                	push   $0x1e
+  800124:	68 7c 3c 80 00       	push   $0x803c7c
+  800129:	e8 25 02 00 00       	call   800353 <_panic>
+		for (i = 0; i < n; i += d->d_reclen) {
+  80012e:	bb 00 00 00 00       	mov    $0x0,%ebx
+			ls1(prefix, d->d_type == FTYPE_DIR, d->d_size, d->d_name);
+  800133:	8d 83 08 60 80 00    	lea    0x806008(%ebx),%eax
+  800139:	50                   	push   %eax
+  80013a:	ff b3 00 60 80 00    	push   0x806000(%ebx)
+  800140:	80 bb 04 60 80 00 01 	cmpb   $0x1,0x806004(%ebx)
+  800147:	0f 94 c0             	sete   %al
+  80014a:	0f b6 c0             	movzbl %al,%eax
+  80014d:	50                   	push   %eax
+  80014e:	ff 75 0c             	push   0xc(%ebp)
+  800151:	e8 dd fe ff ff       	call   800033 <ls1>
+		for (i = 0; i < n; i += d->d_reclen) {
+  800156:	0f b7 83 06 60 80 00 	movzwl 0x806006(%ebx),%eax
+  80015d:	01 c3                	add    %eax,%ebx
+  80015f:	83 c4 10             	add    $0x10,%esp
+  800162:	39 df                	cmp    %ebx,%edi
+  800164:	7f cd                	jg     800133 <lsdir+0x41>
+	while ((n = readdir(fd, dirbuf, sizeof dirbuf,
+  800166:	b8 00 70 80 00       	mov    $0x807000,%eax
+  80016b:	83 b8 48 01 00 00 00 	cmpl   $0x0,0x148(%eax)
+  800172:	0f 95 c0             	setne  %al
+  800175:	0f b6 c0             	movzbl %al,%eax
+  800178:	50                   	push   %eax
+  800179:	68 00 10 00 00       	push   $0x1000
+  80017e:	68 00 60 80 00       	push   $0x806000
+  800183:	ff 75 e4             	push   -0x1c(%ebp)
+  800186:	e8 4c 20 00 00       	call   8021d7 <readdir>
+  80018b:	89 c7                	mov    %eax,%edi
+			    flag['R'] ? FSREADDIR_RECURSIVE : 0)) > 0)
+  80018d:	83 c4 10             	add    $0x10,%esp
+  800190:	85 c0                	test   %eax,%eax
+  800192:	7f 9a                	jg     80012e <lsdir+0x3c>
+	if (n < 0)
+  800194:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800197:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80019a:	85 c0                	test   %eax,%eax
+  80019c:	78 14                	js     8001b2 <lsdir+0xc0>
+	close(fd);
+  80019e:	83 ec 0c             	sub    $0xc,%esp
+  8001a1:	52                   	push   %edx
+  8001a2:	e8 78 13 00 00       	call   80151f <close>
+}
+  8001a7:	83 c4 10             	add    $0x10,%esp
+  8001aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001ad:	5b                   	pop    %ebx
+  8001ae:	5e                   	pop    %esi
+  8001af:	5f                   	pop    %edi
+  8001b0:	5d                   	pop    %ebp
+  8001b1:	c3                   	ret
+		panic("error reading directory %s: %e", path, n);
+  8001b2:	83 ec 0c             	sub    $0xc,%esp
+  8001b5:	50                   	push   %eax
+  8001b6:	57                   	push   %edi
+  8001b7:	68 b0 3c 80 00       	push   $0x803cb0
+  8001bc:	6a 26                	push   $0x26
+  8001be:	68 7c 3c 80 00       	push   $0x803c7c
+  8001c3:	e8 8b 01 00 00       	call   800353 <_panic>
+
+008001c8 <ls>:
+{
+  8001c8:	55                   	push   %ebp
+  8001c9:	89 e5                	mov    %esp,%ebp
+  8001cb:	53                   	push   %ebx
+  8001cc:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8001d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = stat(path, &st)) < 0)
+  8001d5:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  8001db:	50                   	push   %eax
+  8001dc:	53                   	push   %ebx
+  8001dd:	e8 67 17 00 00       	call   801949 <stat>
+  8001e2:	83 c4 10             	add    $0x10,%esp
+  8001e5:	85 c0                	test   %eax,%eax
+  8001e7:	78 2c                	js     800215 <ls+0x4d>
+	if (st.st_isdir && !flag['d'])
+  8001e9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8001ec:	85 c0                	test   %eax,%eax
+  8001ee:	74 09                	je     8001f9 <ls+0x31>
+  8001f0:	83 3d 90 71 80 00 00 	cmpl   $0x0,0x807190
+  8001f7:	74 32                	je     80022b <ls+0x63>
+		ls1(0, st.st_isdir, st.st_size, path);
+  8001f9:	53                   	push   %ebx
+  8001fa:	ff 75 ec             	push   -0x14(%ebp)
+  8001fd:	85 c0                	test   %eax,%eax
+  8001ff:	0f 95 c0             	setne  %al
+  800202:	0f b6 c0             	movzbl %al,%eax
+  800205:	50                   	push   %eax
+  800206:	6a 00                	push   $0x0
+  800208:	e8 26 fe ff ff       	call   800033 <ls1>
+  80020d:	83 c4 10             	add    $0x10,%esp
+}
+  800210:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800213:	c9                   	leave
+  800214:	c3                   	ret
+		panic("stat %s: %e", path, r);
+  800215:	83 ec 0c             	sub    $0xc,%esp
+  800218:	50                   	push   %eax
+  800219:	53                   	push   %ebx
+  80021a:	68 86 3c 80 00       	push   $0x803c86
+  80021f:	6a 10                	push   $0x10
+  800221:	68 7c 3c 80 00       	push   $0x803c7c
+  800226:	e8 28 01 00 00       	call   800353 <_panic>
+		lsdir(path, prefix);
+  80022b:	83 ec 08             	sub    $0x8,%esp
+  80022e:	ff 75 0c             	push   0xc(%ebp)
+  800231:	53                   	push   %ebx
+  800232:	e8 bb fe ff ff       	call   8000f2 <lsdir>
+  800237:	83 c4 10             	add    $0x10,%esp
+  80023a:	eb d4                	jmp    800210 <ls+0x48>
+
+0080023c <usage>:
+
+void
+usage(void)
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	83 ec 14             	sub    $0x14,%esp
+	printf("usage: ls [-dFlR] [file...]\n");
+  800242:	68 92 3c 80 00       	push   $0x803c92
+  800247:	e8 bf 28 00 00       	call   802b0b <printf>
+	exit();
+  80024c:	e8 e8 00 00 00       	call   800339 <exit>
+}
+  800251:	83 c4 10             	add    $0x10,%esp
+  800254:	c9                   	leave
+  800255:	c3                   	ret
+
+00800256 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800256:	55                   	push   %ebp
+  800257:	89 e5                	mov    %esp,%ebp
+  800259:	57                   	push   %edi
+  80025a:	56                   	push   %esi
+  80025b:	53                   	push   %ebx
+  80025c:	83 ec 20             	sub    $0x20,%esp
+  80025f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int i;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  800262:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800265:	50                   	push   %eax
+  800266:	57                   	push   %edi
+  800267:	8d 45 08             	lea    0x8(%ebp),%eax
+  80026a:	50                   	push   %eax
+  80026b:	e8 b9 0f 00 00       	call   801229 <argstart>
+	while ((i = argnext(&args)) >= 0)
+  800270:	83 c4 10             	add    $0x10,%esp
+  800273:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+		switch (i) {
+  800276:	be 01 00 04 04       	mov    $0x4040001,%esi
+	while ((i = argnext(&args)) >= 0)
+  80027b:	eb 08                	jmp    800285 <umain+0x2f>
+		case 'd':
+		case 'F':
+		case 'l':
+		case 'R':
+			flag[i]++;
+  80027d:	83 04 85 00 70 80 00 	addl   $0x1,0x807000(,%eax,4)
+  800284:	01 
+	while ((i = argnext(&args)) >= 0)
+  800285:	83 ec 0c             	sub    $0xc,%esp
+  800288:	53                   	push   %ebx
+  800289:	e8 cb 0f 00 00       	call   801259 <argnext>
+  80028e:	83 c4 10             	add    $0x10,%esp
+  800291:	85 c0                	test   %eax,%eax
+  800293:	78 19                	js     8002ae <umain+0x58>
+		switch (i) {
+  800295:	83 f8 46             	cmp    $0x46,%eax
+  800298:	74 e3                	je     80027d <umain+0x27>
+  80029a:	8d 50 ae             	lea    -0x52(%eax),%edx
+  80029d:	83 fa 1a             	cmp    $0x1a,%edx
+  8002a0:	77 05                	ja     8002a7 <umain+0x51>
+  8002a2:	0f a3 d6             	bt     %edx,%esi
+  8002a5:	72 d6                	jb     80027d <umain+0x27>
+			break;
+		default:
+			usage();
+  8002a7:	e8 90 ff ff ff       	call   80023c <usage>
+  8002ac:	eb d7                	jmp    800285 <umain+0x2f>
+		}
+
+	if (argc == 1)
+		ls("/", "");
+	else {
+		for (i = 1; i < argc; i++)
+  8002ae:	bb 01 00 00 00       	mov    $0x1,%ebx
+	if (argc == 1)
+  8002b3:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8002b7:	75 2a                	jne    8002e3 <umain+0x8d>
+		ls("/", "");
+  8002b9:	83 ec 08             	sub    $0x8,%esp
+  8002bc:	68 ae 3c 80 00       	push   $0x803cae
+  8002c1:	68 60 3c 80 00       	push   $0x803c60
+  8002c6:	e8 fd fe ff ff       	call   8001c8 <ls>
+  8002cb:	83 c4 10             	add    $0x10,%esp
+  8002ce:	eb 18                	jmp    8002e8 <umain+0x92>
+			ls(argv[i], argv[i]);
+  8002d0:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  8002d3:	83 ec 08             	sub    $0x8,%esp
+  8002d6:	50                   	push   %eax
+  8002d7:	50                   	push   %eax
+  8002d8:	e8 eb fe ff ff       	call   8001c8 <ls>
+		for (i = 1; i < argc; i++)
+  8002dd:	83 c3 01             	add    $0x1,%ebx
+  8002e0:	83 c4 10             	add    $0x10,%esp
+  8002e3:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+  8002e6:	7f e8                	jg     8002d0 <umain+0x7a>
+	}
+}
+  8002e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002eb:	5b                   	pop    %ebx
+  8002ec:	5e                   	pop    %esi
+  8002ed:	5f                   	pop    %edi
+  8002ee:	5d                   	pop    %ebp
+  8002ef:	c3                   	ret
+
+008002f0 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002f0:	55                   	push   %ebp
+  8002f1:	89 e5                	mov    %esp,%ebp
+  8002f3:	56                   	push   %esi
+  8002f4:	53                   	push   %ebx
+  8002f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002f8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8002fb:	e8 e2 0a 00 00       	call   800de2 <sys_getenvid>
+  800300:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800305:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80030b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800310:	a3 00 74 80 00       	mov    %eax,0x807400
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800315:	85 db                	test   %ebx,%ebx
+  800317:	7e 07                	jle    800320 <libmain+0x30>
+		binaryname = argv[0];
+  800319:	8b 06                	mov    (%esi),%eax
+  80031b:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800320:	83 ec 08             	sub    $0x8,%esp
+  800323:	56                   	push   %esi
+  800324:	53                   	push   %ebx
+  800325:	e8 2c ff ff ff       	call   800256 <umain>
+
+	// exit gracefully
+	exit();
+  80032a:	e8 0a 00 00 00       	call   800339 <exit>
+}
+  80032f:	83 c4 10             	add    $0x10,%esp
+  800332:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800335:	5b                   	pop    %ebx
+  800336:	5e                   	pop    %esi
+  800337:	5d                   	pop    %ebp
+  800338:	c3                   	ret
+
+00800339 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800339:	55                   	push   %ebp
+  80033a:	89 e5                	mov    %esp,%ebp
+  80033c:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80033f:	e8 08 12 00 00       	call   80154c <close_all>
+	sys_env_destroy(0);
+  800344:	83 ec 0c             	sub    $0xc,%esp
+  800347:	6a 00                	push   $0x0
+  800349:	e8 4b 0a 00 00       	call   800d99 <sys_env_destroy>
+}
+  80034e:	83 c4 10             	add    $0x10,%esp
+  800351:	c9                   	leave
+  800352:	c3                   	ret
+
+00800353 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800353:	55                   	push   %ebp
+  800354:	89 e5                	mov    %esp,%ebp
+  800356:	56                   	push   %esi
+  800357:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800358:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80035b:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800361:	e8 7c 0a 00 00       	call   800de2 <sys_getenvid>
+  800366:	83 ec 0c             	sub    $0xc,%esp
+  800369:	ff 75 0c             	push   0xc(%ebp)
+  80036c:	ff 75 08             	push   0x8(%ebp)
+  80036f:	56                   	push   %esi
+  800370:	50                   	push   %eax
+  800371:	68 dc 3c 80 00       	push   $0x803cdc
+  800376:	e8 b3 00 00 00       	call   80042e <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80037b:	83 c4 18             	add    $0x18,%esp
+  80037e:	53                   	push   %ebx
+  80037f:	ff 75 10             	push   0x10(%ebp)
+  800382:	e8 56 00 00 00       	call   8003dd <vcprintf>
+	cprintf("\n");
+  800387:	c7 04 24 ad 3c 80 00 	movl   $0x803cad,(%esp)
+  80038e:	e8 9b 00 00 00       	call   80042e <cprintf>
+  800393:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800396:	cc                   	int3
+	while (1)
+  800397:	eb fd                	jmp    800396 <_panic+0x43>
+
+00800399 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800399:	55                   	push   %ebp
+  80039a:	89 e5                	mov    %esp,%ebp
+  80039c:	53                   	push   %ebx
+  80039d:	83 ec 04             	sub    $0x4,%esp
+  8003a0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003a3:	8b 13                	mov    (%ebx),%edx
+  8003a5:	8d 42 01             	lea    0x1(%edx),%eax
+  8003a8:	89 03                	mov    %eax,(%ebx)
+  8003aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003ad:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003b1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003b6:	74 09                	je     8003c1 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003b8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003bf:	c9                   	leave
+  8003c0:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003c1:	83 ec 08             	sub    $0x8,%esp
+  8003c4:	68 ff 00 00 00       	push   $0xff
+  8003c9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003cc:	50                   	push   %eax
+  8003cd:	e8 7a 09 00 00       	call   800d4c <sys_cputs>
+		b->idx = 0;
+  8003d2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003d8:	83 c4 10             	add    $0x10,%esp
+  8003db:	eb db                	jmp    8003b8 <putch+0x1f>
+
+008003dd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003dd:	55                   	push   %ebp
+  8003de:	89 e5                	mov    %esp,%ebp
+  8003e0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003e6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003ed:	00 00 00 
+	b.cnt = 0;
+  8003f0:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003f7:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003fa:	ff 75 0c             	push   0xc(%ebp)
+  8003fd:	ff 75 08             	push   0x8(%ebp)
+  800400:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800406:	50                   	push   %eax
+  800407:	68 99 03 80 00       	push   $0x800399
+  80040c:	e8 14 01 00 00       	call   800525 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800411:	83 c4 08             	add    $0x8,%esp
+  800414:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80041a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800420:	50                   	push   %eax
+  800421:	e8 26 09 00 00       	call   800d4c <sys_cputs>
+
+	return b.cnt;
+}
+  800426:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80042c:	c9                   	leave
+  80042d:	c3                   	ret
+
+0080042e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80042e:	55                   	push   %ebp
+  80042f:	89 e5                	mov    %esp,%ebp
+  800431:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800434:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800437:	50                   	push   %eax
+  800438:	ff 75 08             	push   0x8(%ebp)
+  80043b:	e8 9d ff ff ff       	call   8003dd <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800440:	c9                   	leave
+  800441:	c3                   	ret
+
+00800442 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800442:	55                   	push   %ebp
+  800443:	89 e5                	mov    %esp,%ebp
+  800445:	57                   	push   %edi
+  800446:	56                   	push   %esi
+  800447:	53                   	push   %ebx
+  800448:	83 ec 1c             	sub    $0x1c,%esp
+  80044b:	89 c7                	mov    %eax,%edi
+  80044d:	89 d6                	mov    %edx,%esi
+  80044f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800452:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800455:	89 d1                	mov    %edx,%ecx
+  800457:	89 c2                	mov    %eax,%edx
+  800459:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80045c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80045f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800462:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800465:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800468:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80046f:	39 c2                	cmp    %eax,%edx
+  800471:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800474:	72 3e                	jb     8004b4 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800476:	83 ec 0c             	sub    $0xc,%esp
+  800479:	ff 75 18             	push   0x18(%ebp)
+  80047c:	83 eb 01             	sub    $0x1,%ebx
+  80047f:	53                   	push   %ebx
+  800480:	50                   	push   %eax
+  800481:	83 ec 08             	sub    $0x8,%esp
+  800484:	ff 75 e4             	push   -0x1c(%ebp)
+  800487:	ff 75 e0             	push   -0x20(%ebp)
+  80048a:	ff 75 dc             	push   -0x24(%ebp)
+  80048d:	ff 75 d8             	push   -0x28(%ebp)
+  800490:	e8 54 36 00 00       	call   803ae9 <__udivdi3>
+  800495:	83 c4 18             	add    $0x18,%esp
+  800498:	52                   	push   %edx
+  800499:	50                   	push   %eax
+  80049a:	89 f2                	mov    %esi,%edx
+  80049c:	89 f8                	mov    %edi,%eax
+  80049e:	e8 9f ff ff ff       	call   800442 <printnum>
+  8004a3:	83 c4 20             	add    $0x20,%esp
+  8004a6:	eb 13                	jmp    8004bb <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8004a8:	83 ec 08             	sub    $0x8,%esp
+  8004ab:	56                   	push   %esi
+  8004ac:	ff 75 18             	push   0x18(%ebp)
+  8004af:	ff d7                	call   *%edi
+  8004b1:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8004b4:	83 eb 01             	sub    $0x1,%ebx
+  8004b7:	85 db                	test   %ebx,%ebx
+  8004b9:	7f ed                	jg     8004a8 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004bb:	83 ec 08             	sub    $0x8,%esp
+  8004be:	56                   	push   %esi
+  8004bf:	83 ec 04             	sub    $0x4,%esp
+  8004c2:	ff 75 e4             	push   -0x1c(%ebp)
+  8004c5:	ff 75 e0             	push   -0x20(%ebp)
+  8004c8:	ff 75 dc             	push   -0x24(%ebp)
+  8004cb:	ff 75 d8             	push   -0x28(%ebp)
+  8004ce:	e8 34 36 00 00       	call   803b07 <__umoddi3>
+  8004d3:	83 c4 14             	add    $0x14,%esp
+  8004d6:	0f be 80 ff 3c 80 00 	movsbl 0x803cff(%eax),%eax
+  8004dd:	50                   	push   %eax
+  8004de:	ff d7                	call   *%edi
+}
+  8004e0:	83 c4 10             	add    $0x10,%esp
+  8004e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004e6:	5b                   	pop    %ebx
+  8004e7:	5e                   	pop    %esi
+  8004e8:	5f                   	pop    %edi
+  8004e9:	5d                   	pop    %ebp
+  8004ea:	c3                   	ret
+
+008004eb <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004eb:	55                   	push   %ebp
+  8004ec:	89 e5                	mov    %esp,%ebp
+  8004ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8004f1:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8004f5:	8b 10                	mov    (%eax),%edx
+  8004f7:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004fa:	73 0a                	jae    800506 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8004fc:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004ff:	89 08                	mov    %ecx,(%eax)
+  800501:	8b 45 08             	mov    0x8(%ebp),%eax
+  800504:	88 02                	mov    %al,(%edx)
+}
+  800506:	5d                   	pop    %ebp
+  800507:	c3                   	ret
+
+00800508 <printfmt>:
+{
+  800508:	55                   	push   %ebp
+  800509:	89 e5                	mov    %esp,%ebp
+  80050b:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80050e:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800511:	50                   	push   %eax
+  800512:	ff 75 10             	push   0x10(%ebp)
+  800515:	ff 75 0c             	push   0xc(%ebp)
+  800518:	ff 75 08             	push   0x8(%ebp)
+  80051b:	e8 05 00 00 00       	call   800525 <vprintfmt>
+}
+  800520:	83 c4 10             	add    $0x10,%esp
+  800523:	c9                   	leave
+  800524:	c3                   	ret
+
+00800525 <vprintfmt>:
+{
+  800525:	55                   	push   %ebp
+  800526:	89 e5                	mov    %esp,%ebp
+  800528:	57                   	push   %edi
+  800529:	56                   	push   %esi
+  80052a:	53                   	push   %ebx
+  80052b:	83 ec 2c             	sub    $0x2c,%esp
+  80052e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800531:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800534:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800537:	eb 0a                	jmp    800543 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800539:	83 ec 08             	sub    $0x8,%esp
+  80053c:	53                   	push   %ebx
+  80053d:	50                   	push   %eax
+  80053e:	ff d6                	call   *%esi
+  800540:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800543:	83 c7 01             	add    $0x1,%edi
+  800546:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80054a:	83 f8 25             	cmp    $0x25,%eax
+  80054d:	74 0c                	je     80055b <vprintfmt+0x36>
+			if (ch == '\0')
+  80054f:	85 c0                	test   %eax,%eax
+  800551:	75 e6                	jne    800539 <vprintfmt+0x14>
+}
+  800553:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800556:	5b                   	pop    %ebx
+  800557:	5e                   	pop    %esi
+  800558:	5f                   	pop    %edi
+  800559:	5d                   	pop    %ebp
+  80055a:	c3                   	ret
+		padc = ' ';
+  80055b:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80055f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800566:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80056d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800574:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800579:	8d 47 01             	lea    0x1(%edi),%eax
+  80057c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80057f:	0f b6 17             	movzbl (%edi),%edx
+  800582:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800585:	3c 55                	cmp    $0x55,%al
+  800587:	0f 87 cf 03 00 00    	ja     80095c <vprintfmt+0x437>
+  80058d:	0f b6 c0             	movzbl %al,%eax
+  800590:	ff 24 85 60 3e 80 00 	jmp    *0x803e60(,%eax,4)
+  800597:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80059a:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80059e:	eb d9                	jmp    800579 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005a0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005a3:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8005a7:	eb d0                	jmp    800579 <vprintfmt+0x54>
+  8005a9:	0f b6 d2             	movzbl %dl,%edx
+  8005ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8005af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8005b7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005ba:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8005be:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8005c1:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005c4:	83 f9 09             	cmp    $0x9,%ecx
+  8005c7:	77 55                	ja     80061e <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8005c9:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005cc:	eb e9                	jmp    8005b7 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8005ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d1:	8b 00                	mov    (%eax),%eax
+  8005d3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005dc:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8005e2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005e6:	79 91                	jns    800579 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8005e8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005eb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005ee:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005f5:	eb 82                	jmp    800579 <vprintfmt+0x54>
+			if (width < 0)
+  8005f7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005fa:	85 d2                	test   %edx,%edx
+  8005fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800601:	0f 49 c2             	cmovns %edx,%eax
+  800604:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800607:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80060a:	e9 6a ff ff ff       	jmp    800579 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80060f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800612:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800619:	e9 5b ff ff ff       	jmp    800579 <vprintfmt+0x54>
+  80061e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800621:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800624:	eb bc                	jmp    8005e2 <vprintfmt+0xbd>
+			lflag++;
+  800626:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800629:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80062c:	e9 48 ff ff ff       	jmp    800579 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800631:	8b 45 14             	mov    0x14(%ebp),%eax
+  800634:	8d 78 04             	lea    0x4(%eax),%edi
+  800637:	83 ec 08             	sub    $0x8,%esp
+  80063a:	53                   	push   %ebx
+  80063b:	ff 30                	push   (%eax)
+  80063d:	ff d6                	call   *%esi
+			break;
+  80063f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800642:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800645:	e9 b1 02 00 00       	jmp    8008fb <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80064a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064d:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800650:	8b 10                	mov    (%eax),%edx
+  800652:	89 d0                	mov    %edx,%eax
+  800654:	f7 d8                	neg    %eax
+  800656:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800659:	83 f8 11             	cmp    $0x11,%eax
+  80065c:	7f 23                	jg     800681 <vprintfmt+0x15c>
+  80065e:	8b 14 85 c0 3f 80 00 	mov    0x803fc0(,%eax,4),%edx
+  800665:	85 d2                	test   %edx,%edx
+  800667:	74 18                	je     800681 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800669:	52                   	push   %edx
+  80066a:	68 12 41 80 00       	push   $0x804112
+  80066f:	53                   	push   %ebx
+  800670:	56                   	push   %esi
+  800671:	e8 92 fe ff ff       	call   800508 <printfmt>
+  800676:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800679:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80067c:	e9 7a 02 00 00       	jmp    8008fb <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800681:	50                   	push   %eax
+  800682:	68 17 3d 80 00       	push   $0x803d17
+  800687:	53                   	push   %ebx
+  800688:	56                   	push   %esi
+  800689:	e8 7a fe ff ff       	call   800508 <printfmt>
+  80068e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800691:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800694:	e9 62 02 00 00       	jmp    8008fb <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800699:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069c:	83 c0 04             	add    $0x4,%eax
+  80069f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8006a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a5:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8006a7:	85 c9                	test   %ecx,%ecx
+  8006a9:	b8 10 3d 80 00       	mov    $0x803d10,%eax
+  8006ae:	0f 45 c1             	cmovne %ecx,%eax
+  8006b1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8006b4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006b8:	7e 06                	jle    8006c0 <vprintfmt+0x19b>
+  8006ba:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006be:	75 0b                	jne    8006cb <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006c0:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006c3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006c6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006c9:	eb 5c                	jmp    800727 <vprintfmt+0x202>
+  8006cb:	83 ec 08             	sub    $0x8,%esp
+  8006ce:	ff 75 d0             	push   -0x30(%ebp)
+  8006d1:	ff 75 cc             	push   -0x34(%ebp)
+  8006d4:	e8 20 03 00 00       	call   8009f9 <strnlen>
+  8006d9:	89 c2                	mov    %eax,%edx
+  8006db:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006de:	29 d0                	sub    %edx,%eax
+  8006e0:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8006e3:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006e7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006ea:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006ed:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006ef:	eb 0e                	jmp    8006ff <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8006f1:	83 ec 08             	sub    $0x8,%esp
+  8006f4:	53                   	push   %ebx
+  8006f5:	57                   	push   %edi
+  8006f6:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006f9:	83 ee 01             	sub    $0x1,%esi
+  8006fc:	83 c4 10             	add    $0x10,%esp
+  8006ff:	85 f6                	test   %esi,%esi
+  800701:	7f ee                	jg     8006f1 <vprintfmt+0x1cc>
+  800703:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800706:	8b 75 08             	mov    0x8(%ebp),%esi
+  800709:	85 c0                	test   %eax,%eax
+  80070b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800710:	0f 49 d0             	cmovns %eax,%edx
+  800713:	29 d0                	sub    %edx,%eax
+  800715:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800718:	eb a6                	jmp    8006c0 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80071a:	83 ec 08             	sub    $0x8,%esp
+  80071d:	53                   	push   %ebx
+  80071e:	52                   	push   %edx
+  80071f:	ff 55 08             	call   *0x8(%ebp)
+  800722:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800725:	89 f1                	mov    %esi,%ecx
+  800727:	8d 71 01             	lea    0x1(%ecx),%esi
+  80072a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80072e:	0f be d0             	movsbl %al,%edx
+  800731:	85 d2                	test   %edx,%edx
+  800733:	74 28                	je     80075d <vprintfmt+0x238>
+  800735:	85 ff                	test   %edi,%edi
+  800737:	78 05                	js     80073e <vprintfmt+0x219>
+  800739:	83 ef 01             	sub    $0x1,%edi
+  80073c:	78 30                	js     80076e <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80073e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800742:	74 d6                	je     80071a <vprintfmt+0x1f5>
+  800744:	0f be c0             	movsbl %al,%eax
+  800747:	83 e8 20             	sub    $0x20,%eax
+  80074a:	83 f8 5e             	cmp    $0x5e,%eax
+  80074d:	76 cb                	jbe    80071a <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80074f:	83 ec 08             	sub    $0x8,%esp
+  800752:	53                   	push   %ebx
+  800753:	6a 3f                	push   $0x3f
+  800755:	ff 55 08             	call   *0x8(%ebp)
+  800758:	83 c4 10             	add    $0x10,%esp
+  80075b:	eb c8                	jmp    800725 <vprintfmt+0x200>
+  80075d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800760:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800763:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800766:	01 d0                	add    %edx,%eax
+  800768:	29 c8                	sub    %ecx,%eax
+  80076a:	89 c7                	mov    %eax,%edi
+  80076c:	eb 13                	jmp    800781 <vprintfmt+0x25c>
+  80076e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800771:	eb ed                	jmp    800760 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800773:	83 ec 08             	sub    $0x8,%esp
+  800776:	53                   	push   %ebx
+  800777:	6a 20                	push   $0x20
+  800779:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80077b:	83 ef 01             	sub    $0x1,%edi
+  80077e:	83 c4 10             	add    $0x10,%esp
+  800781:	85 ff                	test   %edi,%edi
+  800783:	7f ee                	jg     800773 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800785:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800788:	89 45 14             	mov    %eax,0x14(%ebp)
+  80078b:	e9 6b 01 00 00       	jmp    8008fb <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800790:	83 f9 01             	cmp    $0x1,%ecx
+  800793:	7f 1f                	jg     8007b4 <vprintfmt+0x28f>
+	else if (lflag)
+  800795:	85 c9                	test   %ecx,%ecx
+  800797:	74 67                	je     800800 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800799:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079c:	8b 00                	mov    (%eax),%eax
+  80079e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007a1:	89 c1                	mov    %eax,%ecx
+  8007a3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007a6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ac:	8d 40 04             	lea    0x4(%eax),%eax
+  8007af:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b2:	eb 17                	jmp    8007cb <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8007b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b7:	8b 50 04             	mov    0x4(%eax),%edx
+  8007ba:	8b 00                	mov    (%eax),%eax
+  8007bc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007bf:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c5:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007cb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007ce:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007d6:	85 c9                	test   %ecx,%ecx
+  8007d8:	0f 89 03 01 00 00    	jns    8008e1 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8007de:	83 ec 08             	sub    $0x8,%esp
+  8007e1:	53                   	push   %ebx
+  8007e2:	6a 2d                	push   $0x2d
+  8007e4:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8007e6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007e9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007ec:	f7 da                	neg    %edx
+  8007ee:	83 d1 00             	adc    $0x0,%ecx
+  8007f1:	f7 d9                	neg    %ecx
+  8007f3:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007fb:	e9 e1 00 00 00       	jmp    8008e1 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800800:	8b 45 14             	mov    0x14(%ebp),%eax
+  800803:	8b 00                	mov    (%eax),%eax
+  800805:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800808:	89 c1                	mov    %eax,%ecx
+  80080a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80080d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800810:	8b 45 14             	mov    0x14(%ebp),%eax
+  800813:	8d 40 04             	lea    0x4(%eax),%eax
+  800816:	89 45 14             	mov    %eax,0x14(%ebp)
+  800819:	eb b0                	jmp    8007cb <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80081b:	83 f9 01             	cmp    $0x1,%ecx
+  80081e:	7f 1e                	jg     80083e <vprintfmt+0x319>
+	else if (lflag)
+  800820:	85 c9                	test   %ecx,%ecx
+  800822:	74 32                	je     800856 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800824:	8b 45 14             	mov    0x14(%ebp),%eax
+  800827:	8b 10                	mov    (%eax),%edx
+  800829:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80082e:	8d 40 04             	lea    0x4(%eax),%eax
+  800831:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800834:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800839:	e9 a3 00 00 00       	jmp    8008e1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80083e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800841:	8b 10                	mov    (%eax),%edx
+  800843:	8b 48 04             	mov    0x4(%eax),%ecx
+  800846:	8d 40 08             	lea    0x8(%eax),%eax
+  800849:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80084c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800851:	e9 8b 00 00 00       	jmp    8008e1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800856:	8b 45 14             	mov    0x14(%ebp),%eax
+  800859:	8b 10                	mov    (%eax),%edx
+  80085b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800860:	8d 40 04             	lea    0x4(%eax),%eax
+  800863:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800866:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80086b:	eb 74                	jmp    8008e1 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80086d:	83 f9 01             	cmp    $0x1,%ecx
+  800870:	7f 1b                	jg     80088d <vprintfmt+0x368>
+	else if (lflag)
+  800872:	85 c9                	test   %ecx,%ecx
+  800874:	74 2c                	je     8008a2 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800876:	8b 45 14             	mov    0x14(%ebp),%eax
+  800879:	8b 10                	mov    (%eax),%edx
+  80087b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800880:	8d 40 04             	lea    0x4(%eax),%eax
+  800883:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800886:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80088b:	eb 54                	jmp    8008e1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80088d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800890:	8b 10                	mov    (%eax),%edx
+  800892:	8b 48 04             	mov    0x4(%eax),%ecx
+  800895:	8d 40 08             	lea    0x8(%eax),%eax
+  800898:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80089b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8008a0:	eb 3f                	jmp    8008e1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a5:	8b 10                	mov    (%eax),%edx
+  8008a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ac:	8d 40 04             	lea    0x4(%eax),%eax
+  8008af:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008b2:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8008b7:	eb 28                	jmp    8008e1 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8008b9:	83 ec 08             	sub    $0x8,%esp
+  8008bc:	53                   	push   %ebx
+  8008bd:	6a 30                	push   $0x30
+  8008bf:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8008c1:	83 c4 08             	add    $0x8,%esp
+  8008c4:	53                   	push   %ebx
+  8008c5:	6a 78                	push   $0x78
+  8008c7:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cc:	8b 10                	mov    (%eax),%edx
+  8008ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8008d3:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008d6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008dc:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8008e1:	83 ec 0c             	sub    $0xc,%esp
+  8008e4:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008e8:	50                   	push   %eax
+  8008e9:	ff 75 e0             	push   -0x20(%ebp)
+  8008ec:	57                   	push   %edi
+  8008ed:	51                   	push   %ecx
+  8008ee:	52                   	push   %edx
+  8008ef:	89 da                	mov    %ebx,%edx
+  8008f1:	89 f0                	mov    %esi,%eax
+  8008f3:	e8 4a fb ff ff       	call   800442 <printnum>
+			break;
+  8008f8:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8008fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008fe:	e9 40 fc ff ff       	jmp    800543 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800903:	83 f9 01             	cmp    $0x1,%ecx
+  800906:	7f 1b                	jg     800923 <vprintfmt+0x3fe>
+	else if (lflag)
+  800908:	85 c9                	test   %ecx,%ecx
+  80090a:	74 2c                	je     800938 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80090c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090f:	8b 10                	mov    (%eax),%edx
+  800911:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800916:	8d 40 04             	lea    0x4(%eax),%eax
+  800919:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80091c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800921:	eb be                	jmp    8008e1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800923:	8b 45 14             	mov    0x14(%ebp),%eax
+  800926:	8b 10                	mov    (%eax),%edx
+  800928:	8b 48 04             	mov    0x4(%eax),%ecx
+  80092b:	8d 40 08             	lea    0x8(%eax),%eax
+  80092e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800931:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800936:	eb a9                	jmp    8008e1 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800938:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093b:	8b 10                	mov    (%eax),%edx
+  80093d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800942:	8d 40 04             	lea    0x4(%eax),%eax
+  800945:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800948:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80094d:	eb 92                	jmp    8008e1 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80094f:	83 ec 08             	sub    $0x8,%esp
+  800952:	53                   	push   %ebx
+  800953:	6a 25                	push   $0x25
+  800955:	ff d6                	call   *%esi
+			break;
+  800957:	83 c4 10             	add    $0x10,%esp
+  80095a:	eb 9f                	jmp    8008fb <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80095c:	83 ec 08             	sub    $0x8,%esp
+  80095f:	53                   	push   %ebx
+  800960:	6a 25                	push   $0x25
+  800962:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800964:	83 c4 10             	add    $0x10,%esp
+  800967:	89 f8                	mov    %edi,%eax
+  800969:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80096d:	74 05                	je     800974 <vprintfmt+0x44f>
+  80096f:	83 e8 01             	sub    $0x1,%eax
+  800972:	eb f5                	jmp    800969 <vprintfmt+0x444>
+  800974:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800977:	eb 82                	jmp    8008fb <vprintfmt+0x3d6>
+
+00800979 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800979:	55                   	push   %ebp
+  80097a:	89 e5                	mov    %esp,%ebp
+  80097c:	83 ec 18             	sub    $0x18,%esp
+  80097f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800982:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800985:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800988:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80098c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80098f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800996:	85 c0                	test   %eax,%eax
+  800998:	74 26                	je     8009c0 <vsnprintf+0x47>
+  80099a:	85 d2                	test   %edx,%edx
+  80099c:	7e 22                	jle    8009c0 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80099e:	ff 75 14             	push   0x14(%ebp)
+  8009a1:	ff 75 10             	push   0x10(%ebp)
+  8009a4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009a7:	50                   	push   %eax
+  8009a8:	68 eb 04 80 00       	push   $0x8004eb
+  8009ad:	e8 73 fb ff ff       	call   800525 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009b2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009b5:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009bb:	83 c4 10             	add    $0x10,%esp
+}
+  8009be:	c9                   	leave
+  8009bf:	c3                   	ret
+		return -E_INVAL;
+  8009c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009c5:	eb f7                	jmp    8009be <vsnprintf+0x45>
+
+008009c7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009c7:	55                   	push   %ebp
+  8009c8:	89 e5                	mov    %esp,%ebp
+  8009ca:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009cd:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009d0:	50                   	push   %eax
+  8009d1:	ff 75 10             	push   0x10(%ebp)
+  8009d4:	ff 75 0c             	push   0xc(%ebp)
+  8009d7:	ff 75 08             	push   0x8(%ebp)
+  8009da:	e8 9a ff ff ff       	call   800979 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009df:	c9                   	leave
+  8009e0:	c3                   	ret
+
+008009e1 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009e1:	55                   	push   %ebp
+  8009e2:	89 e5                	mov    %esp,%ebp
+  8009e4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ec:	eb 03                	jmp    8009f1 <strlen+0x10>
+		n++;
+  8009ee:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009f1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009f5:	75 f7                	jne    8009ee <strlen+0xd>
+	return n;
+}
+  8009f7:	5d                   	pop    %ebp
+  8009f8:	c3                   	ret
+
+008009f9 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009f9:	55                   	push   %ebp
+  8009fa:	89 e5                	mov    %esp,%ebp
+  8009fc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a07:	eb 03                	jmp    800a0c <strnlen+0x13>
+		n++;
+  800a09:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a0c:	39 d0                	cmp    %edx,%eax
+  800a0e:	74 08                	je     800a18 <strnlen+0x1f>
+  800a10:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a14:	75 f3                	jne    800a09 <strnlen+0x10>
+  800a16:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a18:	89 d0                	mov    %edx,%eax
+  800a1a:	5d                   	pop    %ebp
+  800a1b:	c3                   	ret
+
+00800a1c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a1c:	55                   	push   %ebp
+  800a1d:	89 e5                	mov    %esp,%ebp
+  800a1f:	53                   	push   %ebx
+  800a20:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a23:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a2f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a32:	83 c0 01             	add    $0x1,%eax
+  800a35:	84 d2                	test   %dl,%dl
+  800a37:	75 f2                	jne    800a2b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a39:	89 c8                	mov    %ecx,%eax
+  800a3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a3e:	c9                   	leave
+  800a3f:	c3                   	ret
+
+00800a40 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a40:	55                   	push   %ebp
+  800a41:	89 e5                	mov    %esp,%ebp
+  800a43:	53                   	push   %ebx
+  800a44:	83 ec 10             	sub    $0x10,%esp
+  800a47:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a4a:	53                   	push   %ebx
+  800a4b:	e8 91 ff ff ff       	call   8009e1 <strlen>
+  800a50:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a53:	ff 75 0c             	push   0xc(%ebp)
+  800a56:	01 d8                	add    %ebx,%eax
+  800a58:	50                   	push   %eax
+  800a59:	e8 be ff ff ff       	call   800a1c <strcpy>
+	return dst;
+}
+  800a5e:	89 d8                	mov    %ebx,%eax
+  800a60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a63:	c9                   	leave
+  800a64:	c3                   	ret
+
+00800a65 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a65:	55                   	push   %ebp
+  800a66:	89 e5                	mov    %esp,%ebp
+  800a68:	56                   	push   %esi
+  800a69:	53                   	push   %ebx
+  800a6a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a6d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a70:	89 f3                	mov    %esi,%ebx
+  800a72:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a75:	89 f0                	mov    %esi,%eax
+  800a77:	eb 0f                	jmp    800a88 <strncpy+0x23>
+		*dst++ = *src;
+  800a79:	83 c0 01             	add    $0x1,%eax
+  800a7c:	0f b6 0a             	movzbl (%edx),%ecx
+  800a7f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a82:	80 f9 01             	cmp    $0x1,%cl
+  800a85:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a88:	39 d8                	cmp    %ebx,%eax
+  800a8a:	75 ed                	jne    800a79 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a8c:	89 f0                	mov    %esi,%eax
+  800a8e:	5b                   	pop    %ebx
+  800a8f:	5e                   	pop    %esi
+  800a90:	5d                   	pop    %ebp
+  800a91:	c3                   	ret
+
+00800a92 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a92:	55                   	push   %ebp
+  800a93:	89 e5                	mov    %esp,%ebp
+  800a95:	56                   	push   %esi
+  800a96:	53                   	push   %ebx
+  800a97:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a9d:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800aa0:	89 f0                	mov    %esi,%eax
+  800aa2:	85 d2                	test   %edx,%edx
+  800aa4:	74 21                	je     800ac7 <strlcpy+0x35>
+  800aa6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800aaa:	89 f2                	mov    %esi,%edx
+  800aac:	eb 09                	jmp    800ab7 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800aae:	83 c1 01             	add    $0x1,%ecx
+  800ab1:	83 c2 01             	add    $0x1,%edx
+  800ab4:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800ab7:	39 c2                	cmp    %eax,%edx
+  800ab9:	74 09                	je     800ac4 <strlcpy+0x32>
+  800abb:	0f b6 19             	movzbl (%ecx),%ebx
+  800abe:	84 db                	test   %bl,%bl
+  800ac0:	75 ec                	jne    800aae <strlcpy+0x1c>
+  800ac2:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800ac4:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800ac7:	29 f0                	sub    %esi,%eax
+}
+  800ac9:	5b                   	pop    %ebx
+  800aca:	5e                   	pop    %esi
+  800acb:	5d                   	pop    %ebp
+  800acc:	c3                   	ret
+
+00800acd <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800acd:	55                   	push   %ebp
+  800ace:	89 e5                	mov    %esp,%ebp
+  800ad0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ad3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ad6:	eb 06                	jmp    800ade <strcmp+0x11>
+		p++, q++;
+  800ad8:	83 c1 01             	add    $0x1,%ecx
+  800adb:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ade:	0f b6 01             	movzbl (%ecx),%eax
+  800ae1:	84 c0                	test   %al,%al
+  800ae3:	74 04                	je     800ae9 <strcmp+0x1c>
+  800ae5:	3a 02                	cmp    (%edx),%al
+  800ae7:	74 ef                	je     800ad8 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ae9:	0f b6 c0             	movzbl %al,%eax
+  800aec:	0f b6 12             	movzbl (%edx),%edx
+  800aef:	29 d0                	sub    %edx,%eax
+}
+  800af1:	5d                   	pop    %ebp
+  800af2:	c3                   	ret
+
+00800af3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800af3:	55                   	push   %ebp
+  800af4:	89 e5                	mov    %esp,%ebp
+  800af6:	53                   	push   %ebx
+  800af7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800afd:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b00:	eb 09                	jmp    800b0b <strncmp+0x18>
+		n--, p++, q++;
+  800b02:	83 ea 01             	sub    $0x1,%edx
+  800b05:	83 c0 01             	add    $0x1,%eax
+  800b08:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b0b:	85 d2                	test   %edx,%edx
+  800b0d:	74 18                	je     800b27 <strncmp+0x34>
+  800b0f:	0f b6 18             	movzbl (%eax),%ebx
+  800b12:	84 db                	test   %bl,%bl
+  800b14:	74 04                	je     800b1a <strncmp+0x27>
+  800b16:	3a 19                	cmp    (%ecx),%bl
+  800b18:	74 e8                	je     800b02 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b1a:	0f b6 00             	movzbl (%eax),%eax
+  800b1d:	0f b6 11             	movzbl (%ecx),%edx
+  800b20:	29 d0                	sub    %edx,%eax
+}
+  800b22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b25:	c9                   	leave
+  800b26:	c3                   	ret
+		return 0;
+  800b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2c:	eb f4                	jmp    800b22 <strncmp+0x2f>
+
+00800b2e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b2e:	55                   	push   %ebp
+  800b2f:	89 e5                	mov    %esp,%ebp
+  800b31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b34:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b38:	eb 03                	jmp    800b3d <strchr+0xf>
+  800b3a:	83 c0 01             	add    $0x1,%eax
+  800b3d:	0f b6 10             	movzbl (%eax),%edx
+  800b40:	84 d2                	test   %dl,%dl
+  800b42:	74 06                	je     800b4a <strchr+0x1c>
+		if (*s == c)
+  800b44:	38 ca                	cmp    %cl,%dl
+  800b46:	75 f2                	jne    800b3a <strchr+0xc>
+  800b48:	eb 05                	jmp    800b4f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b4f:	5d                   	pop    %ebp
+  800b50:	c3                   	ret
+
+00800b51 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b51:	55                   	push   %ebp
+  800b52:	89 e5                	mov    %esp,%ebp
+  800b54:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b57:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b5b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b5e:	38 ca                	cmp    %cl,%dl
+  800b60:	74 09                	je     800b6b <strfind+0x1a>
+  800b62:	84 d2                	test   %dl,%dl
+  800b64:	74 05                	je     800b6b <strfind+0x1a>
+	for (; *s; s++)
+  800b66:	83 c0 01             	add    $0x1,%eax
+  800b69:	eb f0                	jmp    800b5b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b6b:	5d                   	pop    %ebp
+  800b6c:	c3                   	ret
+
+00800b6d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	57                   	push   %edi
+  800b71:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b74:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b77:	85 c9                	test   %ecx,%ecx
+  800b79:	74 20                	je     800b9b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b7b:	89 f8                	mov    %edi,%eax
+  800b7d:	09 c8                	or     %ecx,%eax
+  800b7f:	a8 03                	test   $0x3,%al
+  800b81:	75 12                	jne    800b95 <memset+0x28>
+		c &= 0xFF;
+  800b83:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b87:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b8d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b90:	fc                   	cld
+  800b91:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b93:	eb 06                	jmp    800b9b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b95:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b98:	fc                   	cld
+  800b99:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b9b:	89 f8                	mov    %edi,%eax
+  800b9d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ba0:	c9                   	leave
+  800ba1:	c3                   	ret
+
+00800ba2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ba2:	55                   	push   %ebp
+  800ba3:	89 e5                	mov    %esp,%ebp
+  800ba5:	57                   	push   %edi
+  800ba6:	56                   	push   %esi
+  800ba7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800baa:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bb0:	39 c6                	cmp    %eax,%esi
+  800bb2:	73 32                	jae    800be6 <memmove+0x44>
+  800bb4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bb7:	39 d0                	cmp    %edx,%eax
+  800bb9:	73 2b                	jae    800be6 <memmove+0x44>
+		s += n;
+		d += n;
+  800bbb:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bbe:	89 d6                	mov    %edx,%esi
+  800bc0:	09 fe                	or     %edi,%esi
+  800bc2:	09 ce                	or     %ecx,%esi
+  800bc4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bca:	75 0e                	jne    800bda <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bcc:	83 ef 04             	sub    $0x4,%edi
+  800bcf:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bd2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bd5:	fd                   	std
+  800bd6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bd8:	eb 09                	jmp    800be3 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bda:	83 ef 01             	sub    $0x1,%edi
+  800bdd:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800be0:	fd                   	std
+  800be1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800be3:	fc                   	cld
+  800be4:	eb 1a                	jmp    800c00 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800be6:	89 f2                	mov    %esi,%edx
+  800be8:	09 c2                	or     %eax,%edx
+  800bea:	09 ca                	or     %ecx,%edx
+  800bec:	f6 c2 03             	test   $0x3,%dl
+  800bef:	75 0a                	jne    800bfb <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bf1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bf4:	89 c7                	mov    %eax,%edi
+  800bf6:	fc                   	cld
+  800bf7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bf9:	eb 05                	jmp    800c00 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bfb:	89 c7                	mov    %eax,%edi
+  800bfd:	fc                   	cld
+  800bfe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c00:	5e                   	pop    %esi
+  800c01:	5f                   	pop    %edi
+  800c02:	5d                   	pop    %ebp
+  800c03:	c3                   	ret
+
+00800c04 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c04:	55                   	push   %ebp
+  800c05:	89 e5                	mov    %esp,%ebp
+  800c07:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c0a:	ff 75 10             	push   0x10(%ebp)
+  800c0d:	ff 75 0c             	push   0xc(%ebp)
+  800c10:	ff 75 08             	push   0x8(%ebp)
+  800c13:	e8 8a ff ff ff       	call   800ba2 <memmove>
+}
+  800c18:	c9                   	leave
+  800c19:	c3                   	ret
+
+00800c1a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c1a:	55                   	push   %ebp
+  800c1b:	89 e5                	mov    %esp,%ebp
+  800c1d:	56                   	push   %esi
+  800c1e:	53                   	push   %ebx
+  800c1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c22:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c25:	89 c6                	mov    %eax,%esi
+  800c27:	03 75 10             	add    0x10(%ebp),%esi
+  800c2a:	eb 06                	jmp    800c32 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c2c:	83 c0 01             	add    $0x1,%eax
+  800c2f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c32:	39 f0                	cmp    %esi,%eax
+  800c34:	74 14                	je     800c4a <memcmp+0x30>
+		if (*s1 != *s2)
+  800c36:	0f b6 08             	movzbl (%eax),%ecx
+  800c39:	0f b6 1a             	movzbl (%edx),%ebx
+  800c3c:	38 d9                	cmp    %bl,%cl
+  800c3e:	74 ec                	je     800c2c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c40:	0f b6 c1             	movzbl %cl,%eax
+  800c43:	0f b6 db             	movzbl %bl,%ebx
+  800c46:	29 d8                	sub    %ebx,%eax
+  800c48:	eb 05                	jmp    800c4f <memcmp+0x35>
+	}
+
+	return 0;
+  800c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c4f:	5b                   	pop    %ebx
+  800c50:	5e                   	pop    %esi
+  800c51:	5d                   	pop    %ebp
+  800c52:	c3                   	ret
+
+00800c53 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c53:	55                   	push   %ebp
+  800c54:	89 e5                	mov    %esp,%ebp
+  800c56:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c5c:	89 c2                	mov    %eax,%edx
+  800c5e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c61:	eb 03                	jmp    800c66 <memfind+0x13>
+  800c63:	83 c0 01             	add    $0x1,%eax
+  800c66:	39 d0                	cmp    %edx,%eax
+  800c68:	73 04                	jae    800c6e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c6a:	38 08                	cmp    %cl,(%eax)
+  800c6c:	75 f5                	jne    800c63 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c6e:	5d                   	pop    %ebp
+  800c6f:	c3                   	ret
+
+00800c70 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c70:	55                   	push   %ebp
+  800c71:	89 e5                	mov    %esp,%ebp
+  800c73:	57                   	push   %edi
+  800c74:	56                   	push   %esi
+  800c75:	53                   	push   %ebx
+  800c76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c7c:	eb 03                	jmp    800c81 <strtol+0x11>
+		s++;
+  800c7e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c81:	0f b6 02             	movzbl (%edx),%eax
+  800c84:	3c 20                	cmp    $0x20,%al
+  800c86:	74 f6                	je     800c7e <strtol+0xe>
+  800c88:	3c 09                	cmp    $0x9,%al
+  800c8a:	74 f2                	je     800c7e <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c8c:	3c 2b                	cmp    $0x2b,%al
+  800c8e:	74 2a                	je     800cba <strtol+0x4a>
+	int neg = 0;
+  800c90:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c95:	3c 2d                	cmp    $0x2d,%al
+  800c97:	74 2b                	je     800cc4 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c99:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c9f:	75 0f                	jne    800cb0 <strtol+0x40>
+  800ca1:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ca4:	74 28                	je     800cce <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ca6:	85 db                	test   %ebx,%ebx
+  800ca8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cad:	0f 44 d8             	cmove  %eax,%ebx
+  800cb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cb5:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cb8:	eb 46                	jmp    800d00 <strtol+0x90>
+		s++;
+  800cba:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800cbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cc2:	eb d5                	jmp    800c99 <strtol+0x29>
+		s++, neg = 1;
+  800cc4:	83 c2 01             	add    $0x1,%edx
+  800cc7:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ccc:	eb cb                	jmp    800c99 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cce:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cd2:	74 0e                	je     800ce2 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800cd4:	85 db                	test   %ebx,%ebx
+  800cd6:	75 d8                	jne    800cb0 <strtol+0x40>
+		s++, base = 8;
+  800cd8:	83 c2 01             	add    $0x1,%edx
+  800cdb:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ce0:	eb ce                	jmp    800cb0 <strtol+0x40>
+		s += 2, base = 16;
+  800ce2:	83 c2 02             	add    $0x2,%edx
+  800ce5:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cea:	eb c4                	jmp    800cb0 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800cec:	0f be c0             	movsbl %al,%eax
+  800cef:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800cf2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cf5:	7d 3a                	jge    800d31 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800cf7:	83 c2 01             	add    $0x1,%edx
+  800cfa:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cfe:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d00:	0f b6 02             	movzbl (%edx),%eax
+  800d03:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d06:	89 f3                	mov    %esi,%ebx
+  800d08:	80 fb 09             	cmp    $0x9,%bl
+  800d0b:	76 df                	jbe    800cec <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d0d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d10:	89 f3                	mov    %esi,%ebx
+  800d12:	80 fb 19             	cmp    $0x19,%bl
+  800d15:	77 08                	ja     800d1f <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d17:	0f be c0             	movsbl %al,%eax
+  800d1a:	83 e8 57             	sub    $0x57,%eax
+  800d1d:	eb d3                	jmp    800cf2 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d1f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d22:	89 f3                	mov    %esi,%ebx
+  800d24:	80 fb 19             	cmp    $0x19,%bl
+  800d27:	77 08                	ja     800d31 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d29:	0f be c0             	movsbl %al,%eax
+  800d2c:	83 e8 37             	sub    $0x37,%eax
+  800d2f:	eb c1                	jmp    800cf2 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d31:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d35:	74 05                	je     800d3c <strtol+0xcc>
+		*endptr = (char *) s;
+  800d37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d3a:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d3c:	89 c8                	mov    %ecx,%eax
+  800d3e:	f7 d8                	neg    %eax
+  800d40:	85 ff                	test   %edi,%edi
+  800d42:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d45:	89 c8                	mov    %ecx,%eax
+  800d47:	5b                   	pop    %ebx
+  800d48:	5e                   	pop    %esi
+  800d49:	5f                   	pop    %edi
+  800d4a:	5d                   	pop    %ebp
+  800d4b:	c3                   	ret
+
+00800d4c <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d4c:	55                   	push   %ebp
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	57                   	push   %edi
+  800d50:	56                   	push   %esi
+  800d51:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5d:	89 c3                	mov    %eax,%ebx
+  800d5f:	89 c7                	mov    %eax,%edi
+  800d61:	55                   	push   %ebp
+  800d62:	89 e5                	mov    %esp,%ebp
+  800d64:	8d 35 6c 0d 80 00    	lea    0x800d6c,%esi
+  800d6a:	0f 34                	sysenter
+  800d6c:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800d6d:	5b                   	pop    %ebx
+  800d6e:	5e                   	pop    %esi
+  800d6f:	5f                   	pop    %edi
+  800d70:	5d                   	pop    %ebp
+  800d71:	c3                   	ret
+
+00800d72 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d72:	55                   	push   %ebp
+  800d73:	89 e5                	mov    %esp,%ebp
+  800d75:	57                   	push   %edi
+  800d76:	56                   	push   %esi
+  800d77:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d82:	89 d1                	mov    %edx,%ecx
+  800d84:	89 d3                	mov    %edx,%ebx
+  800d86:	89 d7                	mov    %edx,%edi
+  800d88:	55                   	push   %ebp
+  800d89:	89 e5                	mov    %esp,%ebp
+  800d8b:	8d 35 93 0d 80 00    	lea    0x800d93,%esi
+  800d91:	0f 34                	sysenter
+  800d93:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800d94:	5b                   	pop    %ebx
+  800d95:	5e                   	pop    %esi
+  800d96:	5f                   	pop    %edi
+  800d97:	5d                   	pop    %ebp
+  800d98:	c3                   	ret
+
+00800d99 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d99:	55                   	push   %ebp
+  800d9a:	89 e5                	mov    %esp,%ebp
+  800d9c:	57                   	push   %edi
+  800d9d:	56                   	push   %esi
+  800d9e:	53                   	push   %ebx
+  800d9f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800da2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800da7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800daa:	b8 03 00 00 00       	mov    $0x3,%eax
+  800daf:	89 cb                	mov    %ecx,%ebx
+  800db1:	89 cf                	mov    %ecx,%edi
+  800db3:	55                   	push   %ebp
+  800db4:	89 e5                	mov    %esp,%ebp
+  800db6:	8d 35 be 0d 80 00    	lea    0x800dbe,%esi
+  800dbc:	0f 34                	sysenter
+  800dbe:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800dbf:	85 c0                	test   %eax,%eax
+  800dc1:	7f 08                	jg     800dcb <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800dc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc6:	5b                   	pop    %ebx
+  800dc7:	5e                   	pop    %esi
+  800dc8:	5f                   	pop    %edi
+  800dc9:	5d                   	pop    %ebp
+  800dca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dcb:	83 ec 0c             	sub    $0xc,%esp
+  800dce:	50                   	push   %eax
+  800dcf:	6a 03                	push   $0x3
+  800dd1:	68 27 40 80 00       	push   $0x804027
+  800dd6:	6a 3d                	push   $0x3d
+  800dd8:	68 44 40 80 00       	push   $0x804044
+  800ddd:	e8 71 f5 ff ff       	call   800353 <_panic>
+
+00800de2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800de2:	55                   	push   %ebp
+  800de3:	89 e5                	mov    %esp,%ebp
+  800de5:	57                   	push   %edi
+  800de6:	56                   	push   %esi
+  800de7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800de8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ded:	b8 02 00 00 00       	mov    $0x2,%eax
+  800df2:	89 d1                	mov    %edx,%ecx
+  800df4:	89 d3                	mov    %edx,%ebx
+  800df6:	89 d7                	mov    %edx,%edi
+  800df8:	55                   	push   %ebp
+  800df9:	89 e5                	mov    %esp,%ebp
+  800dfb:	8d 35 03 0e 80 00    	lea    0x800e03,%esi
+  800e01:	0f 34                	sysenter
+  800e03:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800e04:	5b                   	pop    %ebx
+  800e05:	5e                   	pop    %esi
+  800e06:	5f                   	pop    %edi
+  800e07:	5d                   	pop    %ebp
+  800e08:	c3                   	ret
+
+00800e09 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e09:	55                   	push   %ebp
+  800e0a:	89 e5                	mov    %esp,%ebp
+  800e0c:	57                   	push   %edi
+  800e0d:	56                   	push   %esi
+  800e0e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e14:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e19:	89 d1                	mov    %edx,%ecx
+  800e1b:	89 d3                	mov    %edx,%ebx
+  800e1d:	89 d7                	mov    %edx,%edi
+  800e1f:	89 d6                	mov    %edx,%esi
+  800e21:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e23:	5b                   	pop    %ebx
+  800e24:	5e                   	pop    %esi
+  800e25:	5f                   	pop    %edi
+  800e26:	5d                   	pop    %ebp
+  800e27:	c3                   	ret
+
+00800e28 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e28:	55                   	push   %ebp
+  800e29:	89 e5                	mov    %esp,%ebp
+  800e2b:	57                   	push   %edi
+  800e2c:	56                   	push   %esi
+  800e2d:	53                   	push   %ebx
+  800e2e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e37:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e44:	55                   	push   %ebp
+  800e45:	89 e5                	mov    %esp,%ebp
+  800e47:	8d 35 4f 0e 80 00    	lea    0x800e4f,%esi
+  800e4d:	0f 34                	sysenter
+  800e4f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e50:	85 c0                	test   %eax,%eax
+  800e52:	7f 08                	jg     800e5c <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800e54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e57:	5b                   	pop    %ebx
+  800e58:	5e                   	pop    %esi
+  800e59:	5f                   	pop    %edi
+  800e5a:	5d                   	pop    %ebp
+  800e5b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5c:	83 ec 0c             	sub    $0xc,%esp
+  800e5f:	50                   	push   %eax
+  800e60:	6a 04                	push   $0x4
+  800e62:	68 27 40 80 00       	push   $0x804027
+  800e67:	6a 3d                	push   $0x3d
+  800e69:	68 44 40 80 00       	push   $0x804044
+  800e6e:	e8 e0 f4 ff ff       	call   800353 <_panic>
+
+00800e73 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	57                   	push   %edi
+  800e77:	56                   	push   %esi
+  800e78:	53                   	push   %ebx
+  800e79:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e82:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e90:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e92:	85 c0                	test   %eax,%eax
+  800e94:	7f 08                	jg     800e9e <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e99:	5b                   	pop    %ebx
+  800e9a:	5e                   	pop    %esi
+  800e9b:	5f                   	pop    %edi
+  800e9c:	5d                   	pop    %ebp
+  800e9d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9e:	83 ec 0c             	sub    $0xc,%esp
+  800ea1:	50                   	push   %eax
+  800ea2:	6a 05                	push   $0x5
+  800ea4:	68 27 40 80 00       	push   $0x804027
+  800ea9:	6a 23                	push   $0x23
+  800eab:	68 44 40 80 00       	push   $0x804044
+  800eb0:	e8 9e f4 ff ff       	call   800353 <_panic>
+
+00800eb5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800eb5:	55                   	push   %ebp
+  800eb6:	89 e5                	mov    %esp,%ebp
+  800eb8:	57                   	push   %edi
+  800eb9:	56                   	push   %esi
+  800eba:	53                   	push   %ebx
+  800ebb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ebe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec9:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ece:	89 df                	mov    %ebx,%edi
+  800ed0:	55                   	push   %ebp
+  800ed1:	89 e5                	mov    %esp,%ebp
+  800ed3:	8d 35 db 0e 80 00    	lea    0x800edb,%esi
+  800ed9:	0f 34                	sysenter
+  800edb:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800edc:	85 c0                	test   %eax,%eax
+  800ede:	7f 08                	jg     800ee8 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800ee0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee3:	5b                   	pop    %ebx
+  800ee4:	5e                   	pop    %esi
+  800ee5:	5f                   	pop    %edi
+  800ee6:	5d                   	pop    %ebp
+  800ee7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee8:	83 ec 0c             	sub    $0xc,%esp
+  800eeb:	50                   	push   %eax
+  800eec:	6a 06                	push   $0x6
+  800eee:	68 27 40 80 00       	push   $0x804027
+  800ef3:	6a 3d                	push   $0x3d
+  800ef5:	68 44 40 80 00       	push   $0x804044
+  800efa:	e8 54 f4 ff ff       	call   800353 <_panic>
+
+00800eff <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800eff:	55                   	push   %ebp
+  800f00:	89 e5                	mov    %esp,%ebp
+  800f02:	57                   	push   %edi
+  800f03:	56                   	push   %esi
+  800f04:	53                   	push   %ebx
+  800f05:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f13:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f18:	89 df                	mov    %ebx,%edi
+  800f1a:	55                   	push   %ebp
+  800f1b:	89 e5                	mov    %esp,%ebp
+  800f1d:	8d 35 25 0f 80 00    	lea    0x800f25,%esi
+  800f23:	0f 34                	sysenter
+  800f25:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f26:	85 c0                	test   %eax,%eax
+  800f28:	7f 08                	jg     800f32 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800f2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2d:	5b                   	pop    %ebx
+  800f2e:	5e                   	pop    %esi
+  800f2f:	5f                   	pop    %edi
+  800f30:	5d                   	pop    %ebp
+  800f31:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f32:	83 ec 0c             	sub    $0xc,%esp
+  800f35:	50                   	push   %eax
+  800f36:	6a 08                	push   $0x8
+  800f38:	68 27 40 80 00       	push   $0x804027
+  800f3d:	6a 3d                	push   $0x3d
+  800f3f:	68 44 40 80 00       	push   $0x804044
+  800f44:	e8 0a f4 ff ff       	call   800353 <_panic>
+
+00800f49 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f49:	55                   	push   %ebp
+  800f4a:	89 e5                	mov    %esp,%ebp
+  800f4c:	57                   	push   %edi
+  800f4d:	56                   	push   %esi
+  800f4e:	53                   	push   %ebx
+  800f4f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5d:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f62:	89 df                	mov    %ebx,%edi
+  800f64:	55                   	push   %ebp
+  800f65:	89 e5                	mov    %esp,%ebp
+  800f67:	8d 35 6f 0f 80 00    	lea    0x800f6f,%esi
+  800f6d:	0f 34                	sysenter
+  800f6f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f70:	85 c0                	test   %eax,%eax
+  800f72:	7f 08                	jg     800f7c <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800f74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f77:	5b                   	pop    %ebx
+  800f78:	5e                   	pop    %esi
+  800f79:	5f                   	pop    %edi
+  800f7a:	5d                   	pop    %ebp
+  800f7b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f7c:	83 ec 0c             	sub    $0xc,%esp
+  800f7f:	50                   	push   %eax
+  800f80:	6a 09                	push   $0x9
+  800f82:	68 27 40 80 00       	push   $0x804027
+  800f87:	6a 3d                	push   $0x3d
+  800f89:	68 44 40 80 00       	push   $0x804044
+  800f8e:	e8 c0 f3 ff ff       	call   800353 <_panic>
+
+00800f93 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f93:	55                   	push   %ebp
+  800f94:	89 e5                	mov    %esp,%ebp
+  800f96:	57                   	push   %edi
+  800f97:	56                   	push   %esi
+  800f98:	53                   	push   %ebx
+  800f99:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fac:	89 df                	mov    %ebx,%edi
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  800fb1:	8d 35 b9 0f 80 00    	lea    0x800fb9,%esi
+  800fb7:	0f 34                	sysenter
+  800fb9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800fba:	85 c0                	test   %eax,%eax
+  800fbc:	7f 08                	jg     800fc6 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800fbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc1:	5b                   	pop    %ebx
+  800fc2:	5e                   	pop    %esi
+  800fc3:	5f                   	pop    %edi
+  800fc4:	5d                   	pop    %ebp
+  800fc5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc6:	83 ec 0c             	sub    $0xc,%esp
+  800fc9:	50                   	push   %eax
+  800fca:	6a 0a                	push   $0xa
+  800fcc:	68 27 40 80 00       	push   $0x804027
+  800fd1:	6a 3d                	push   $0x3d
+  800fd3:	68 44 40 80 00       	push   $0x804044
+  800fd8:	e8 76 f3 ff ff       	call   800353 <_panic>
+
+00800fdd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	57                   	push   %edi
+  800fe1:	56                   	push   %esi
+  800fe2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fe3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ff4:	55                   	push   %ebp
+  800ff5:	89 e5                	mov    %esp,%ebp
+  800ff7:	8d 35 ff 0f 80 00    	lea    0x800fff,%esi
+  800ffd:	0f 34                	sysenter
+  800fff:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  801000:	5b                   	pop    %ebx
+  801001:	5e                   	pop    %esi
+  801002:	5f                   	pop    %edi
+  801003:	5d                   	pop    %ebp
+  801004:	c3                   	ret
+
+00801005 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  801005:	55                   	push   %ebp
+  801006:	89 e5                	mov    %esp,%ebp
+  801008:	57                   	push   %edi
+  801009:	56                   	push   %esi
+  80100a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80100b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801011:	b8 17 00 00 00       	mov    $0x17,%eax
+  801016:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801019:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	8d 35 27 10 80 00    	lea    0x801027,%esi
+  801025:	0f 34                	sysenter
+  801027:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  801028:	5b                   	pop    %ebx
+  801029:	5e                   	pop    %esi
+  80102a:	5f                   	pop    %edi
+  80102b:	5d                   	pop    %ebp
+  80102c:	c3                   	ret
+
+0080102d <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  80102d:	55                   	push   %ebp
+  80102e:	89 e5                	mov    %esp,%ebp
+  801030:	57                   	push   %edi
+  801031:	56                   	push   %esi
+  801032:	53                   	push   %ebx
+  801033:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801036:	be 00 00 00 00       	mov    $0x0,%esi
+  80103b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801041:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801046:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801049:	89 f7                	mov    %esi,%edi
+  80104b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80104d:	85 c0                	test   %eax,%eax
+  80104f:	7f 08                	jg     801059 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  801051:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801054:	5b                   	pop    %ebx
+  801055:	5e                   	pop    %esi
+  801056:	5f                   	pop    %edi
+  801057:	5d                   	pop    %ebp
+  801058:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801059:	83 ec 0c             	sub    $0xc,%esp
+  80105c:	50                   	push   %eax
+  80105d:	6a 0d                	push   $0xd
+  80105f:	68 27 40 80 00       	push   $0x804027
+  801064:	6a 23                	push   $0x23
+  801066:	68 44 40 80 00       	push   $0x804044
+  80106b:	e8 e3 f2 ff ff       	call   800353 <_panic>
+
+00801070 <sys_ipc_recv>:
+{
+  801070:	55                   	push   %ebp
+  801071:	89 e5                	mov    %esp,%ebp
+  801073:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  801076:	6a 00                	push   $0x0
+  801078:	6a 01                	push   $0x1
+  80107a:	ff 75 08             	push   0x8(%ebp)
+  80107d:	e8 ab ff ff ff       	call   80102d <sys_ipc_recvv>
+}
+  801082:	c9                   	leave
+  801083:	c3                   	ret
+
+00801084 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  801084:	55                   	push   %ebp
+  801085:	89 e5                	mov    %esp,%ebp
+  801087:	57                   	push   %edi
+  801088:	56                   	push   %esi
+  801089:	53                   	push   %ebx
+  80108a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80108d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801092:	8b 55 08             	mov    0x8(%ebp),%edx
+  801095:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801098:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80109d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8010a0:	89 de                	mov    %ebx,%esi
+  8010a2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010a4:	85 c0                	test   %eax,%eax
+  8010a6:	7f 08                	jg     8010b0 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  8010a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ab:	5b                   	pop    %ebx
+  8010ac:	5e                   	pop    %esi
+  8010ad:	5f                   	pop    %edi
+  8010ae:	5d                   	pop    %ebp
+  8010af:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b0:	83 ec 0c             	sub    $0xc,%esp
+  8010b3:	50                   	push   %eax
+  8010b4:	6a 0d                	push   $0xd
+  8010b6:	68 27 40 80 00       	push   $0x804027
+  8010bb:	6a 23                	push   $0x23
+  8010bd:	68 44 40 80 00       	push   $0x804044
+  8010c2:	e8 8c f2 ff ff       	call   800353 <_panic>
+
+008010c7 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	57                   	push   %edi
+  8010cb:	56                   	push   %esi
+  8010cc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010d7:	89 d1                	mov    %edx,%ecx
+  8010d9:	89 d3                	mov    %edx,%ebx
+  8010db:	89 d7                	mov    %edx,%edi
+  8010dd:	55                   	push   %ebp
+  8010de:	89 e5                	mov    %esp,%ebp
+  8010e0:	8d 35 e8 10 80 00    	lea    0x8010e8,%esi
+  8010e6:	0f 34                	sysenter
+  8010e8:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  8010e9:	5b                   	pop    %ebx
+  8010ea:	5e                   	pop    %esi
+  8010eb:	5f                   	pop    %edi
+  8010ec:	5d                   	pop    %ebp
+  8010ed:	c3                   	ret
+
+008010ee <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  8010ee:	55                   	push   %ebp
+  8010ef:	89 e5                	mov    %esp,%ebp
+  8010f1:	57                   	push   %edi
+  8010f2:	56                   	push   %esi
+  8010f3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ff:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801104:	89 df                	mov    %ebx,%edi
+  801106:	55                   	push   %ebp
+  801107:	89 e5                	mov    %esp,%ebp
+  801109:	8d 35 11 11 80 00    	lea    0x801111,%esi
+  80110f:	0f 34                	sysenter
+  801111:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  801112:	5b                   	pop    %ebx
+  801113:	5e                   	pop    %esi
+  801114:	5f                   	pop    %edi
+  801115:	5d                   	pop    %ebp
+  801116:	c3                   	ret
+
+00801117 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  801117:	55                   	push   %ebp
+  801118:	89 e5                	mov    %esp,%ebp
+  80111a:	57                   	push   %edi
+  80111b:	56                   	push   %esi
+  80111c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80111d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801122:	8b 55 08             	mov    0x8(%ebp),%edx
+  801125:	b8 10 00 00 00       	mov    $0x10,%eax
+  80112a:	89 cb                	mov    %ecx,%ebx
+  80112c:	89 cf                	mov    %ecx,%edi
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	8d 35 39 11 80 00    	lea    0x801139,%esi
+  801137:	0f 34                	sysenter
+  801139:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  80113a:	5b                   	pop    %ebx
+  80113b:	5e                   	pop    %esi
+  80113c:	5f                   	pop    %edi
+  80113d:	5d                   	pop    %ebp
+  80113e:	c3                   	ret
+
+0080113f <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  80113f:	55                   	push   %ebp
+  801140:	89 e5                	mov    %esp,%ebp
+  801142:	57                   	push   %edi
+  801143:	56                   	push   %esi
+  801144:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801145:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801150:	b8 12 00 00 00       	mov    $0x12,%eax
+  801155:	89 df                	mov    %ebx,%edi
+  801157:	55                   	push   %ebp
+  801158:	89 e5                	mov    %esp,%ebp
+  80115a:	8d 35 62 11 80 00    	lea    0x801162,%esi
+  801160:	0f 34                	sysenter
+  801162:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  801163:	5b                   	pop    %ebx
+  801164:	5e                   	pop    %esi
+  801165:	5f                   	pop    %edi
+  801166:	5d                   	pop    %ebp
+  801167:	c3                   	ret
+
+00801168 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  801168:	55                   	push   %ebp
+  801169:	89 e5                	mov    %esp,%ebp
+  80116b:	57                   	push   %edi
+  80116c:	56                   	push   %esi
+  80116d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80116e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801173:	8b 55 08             	mov    0x8(%ebp),%edx
+  801176:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801179:	b8 14 00 00 00       	mov    $0x14,%eax
+  80117e:	89 df                	mov    %ebx,%edi
+  801180:	55                   	push   %ebp
+  801181:	89 e5                	mov    %esp,%ebp
+  801183:	8d 35 8b 11 80 00    	lea    0x80118b,%esi
+  801189:	0f 34                	sysenter
+  80118b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  80118c:	5b                   	pop    %ebx
+  80118d:	5e                   	pop    %esi
+  80118e:	5f                   	pop    %edi
+  80118f:	5d                   	pop    %ebp
+  801190:	c3                   	ret
+
+00801191 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	57                   	push   %edi
+  801195:	56                   	push   %esi
+  801196:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801197:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119d:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011a8:	55                   	push   %ebp
+  8011a9:	89 e5                	mov    %esp,%ebp
+  8011ab:	8d 35 b3 11 80 00    	lea    0x8011b3,%esi
+  8011b1:	0f 34                	sysenter
+  8011b3:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  8011b4:	5b                   	pop    %ebx
+  8011b5:	5e                   	pop    %esi
+  8011b6:	5f                   	pop    %edi
+  8011b7:	5d                   	pop    %ebp
+  8011b8:	c3                   	ret
+
+008011b9 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	57                   	push   %edi
+  8011bd:	56                   	push   %esi
+  8011be:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c7:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011cc:	89 cb                	mov    %ecx,%ebx
+  8011ce:	89 cf                	mov    %ecx,%edi
+  8011d0:	89 ce                	mov    %ecx,%esi
+  8011d2:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  8011d4:	5b                   	pop    %ebx
+  8011d5:	5e                   	pop    %esi
+  8011d6:	5f                   	pop    %edi
+  8011d7:	5d                   	pop    %ebp
+  8011d8:	c3                   	ret
+
+008011d9 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  8011d9:	55                   	push   %ebp
+  8011da:	89 e5                	mov    %esp,%ebp
+  8011dc:	57                   	push   %edi
+  8011dd:	56                   	push   %esi
+  8011de:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011ec:	89 cb                	mov    %ecx,%ebx
+  8011ee:	89 cf                	mov    %ecx,%edi
+  8011f0:	55                   	push   %ebp
+  8011f1:	89 e5                	mov    %esp,%ebp
+  8011f3:	8d 35 fb 11 80 00    	lea    0x8011fb,%esi
+  8011f9:	0f 34                	sysenter
+  8011fb:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8011fc:	5b                   	pop    %ebx
+  8011fd:	5e                   	pop    %esi
+  8011fe:	5f                   	pop    %edi
+  8011ff:	5d                   	pop    %ebp
+  801200:	c3                   	ret
+
+00801201 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  801201:	55                   	push   %ebp
+  801202:	89 e5                	mov    %esp,%ebp
+  801204:	57                   	push   %edi
+  801205:	56                   	push   %esi
+  801206:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801207:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80120c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120f:	b8 16 00 00 00       	mov    $0x16,%eax
+  801214:	89 cb                	mov    %ecx,%ebx
+  801216:	89 cf                	mov    %ecx,%edi
+  801218:	55                   	push   %ebp
+  801219:	89 e5                	mov    %esp,%ebp
+  80121b:	8d 35 23 12 80 00    	lea    0x801223,%esi
+  801221:	0f 34                	sysenter
+  801223:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  801224:	5b                   	pop    %ebx
+  801225:	5e                   	pop    %esi
+  801226:	5f                   	pop    %edi
+  801227:	5d                   	pop    %ebp
+  801228:	c3                   	ret
+
+00801229 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  801229:	55                   	push   %ebp
+  80122a:	89 e5                	mov    %esp,%ebp
+  80122c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801232:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  801235:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  801237:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  80123a:	83 3a 01             	cmpl   $0x1,(%edx)
+  80123d:	7e 09                	jle    801248 <argstart+0x1f>
+  80123f:	ba ae 3c 80 00       	mov    $0x803cae,%edx
+  801244:	85 c9                	test   %ecx,%ecx
+  801246:	75 05                	jne    80124d <argstart+0x24>
+  801248:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124d:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  801250:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  801257:	5d                   	pop    %ebp
+  801258:	c3                   	ret
+
+00801259 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  801259:	55                   	push   %ebp
+  80125a:	89 e5                	mov    %esp,%ebp
+  80125c:	53                   	push   %ebx
+  80125d:	83 ec 04             	sub    $0x4,%esp
+  801260:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  801263:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  80126a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80126d:	85 c0                	test   %eax,%eax
+  80126f:	74 74                	je     8012e5 <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  801271:	80 38 00             	cmpb   $0x0,(%eax)
+  801274:	75 48                	jne    8012be <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  801276:	8b 0b                	mov    (%ebx),%ecx
+  801278:	83 39 01             	cmpl   $0x1,(%ecx)
+  80127b:	74 5a                	je     8012d7 <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  80127d:	8b 53 04             	mov    0x4(%ebx),%edx
+  801280:	8b 42 04             	mov    0x4(%edx),%eax
+  801283:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801286:	75 4f                	jne    8012d7 <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  801288:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  80128c:	74 49                	je     8012d7 <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  80128e:	83 c0 01             	add    $0x1,%eax
+  801291:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801294:	83 ec 04             	sub    $0x4,%esp
+  801297:	8b 01                	mov    (%ecx),%eax
+  801299:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  8012a0:	50                   	push   %eax
+  8012a1:	8d 42 08             	lea    0x8(%edx),%eax
+  8012a4:	50                   	push   %eax
+  8012a5:	83 c2 04             	add    $0x4,%edx
+  8012a8:	52                   	push   %edx
+  8012a9:	e8 f4 f8 ff ff       	call   800ba2 <memmove>
+		(*args->argc)--;
+  8012ae:	8b 03                	mov    (%ebx),%eax
+  8012b0:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  8012b3:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012b6:	83 c4 10             	add    $0x10,%esp
+  8012b9:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8012bc:	74 13                	je     8012d1 <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  8012be:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012c1:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  8012c4:	83 c0 01             	add    $0x1,%eax
+  8012c7:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  8012ca:	89 d0                	mov    %edx,%eax
+  8012cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012cf:	c9                   	leave
+  8012d0:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  8012d1:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8012d5:	75 e7                	jne    8012be <argnext+0x65>
+	args->curarg = 0;
+  8012d7:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  8012de:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8012e3:	eb e5                	jmp    8012ca <argnext+0x71>
+		return -1;
+  8012e5:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8012ea:	eb de                	jmp    8012ca <argnext+0x71>
+
+008012ec <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  8012ec:	55                   	push   %ebp
+  8012ed:	89 e5                	mov    %esp,%ebp
+  8012ef:	53                   	push   %ebx
+  8012f0:	83 ec 04             	sub    $0x4,%esp
+  8012f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  8012f6:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012f9:	85 c0                	test   %eax,%eax
+  8012fb:	74 12                	je     80130f <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  8012fd:	80 38 00             	cmpb   $0x0,(%eax)
+  801300:	74 12                	je     801314 <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  801302:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  801305:	c7 43 08 ae 3c 80 00 	movl   $0x803cae,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  80130c:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  80130f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801312:	c9                   	leave
+  801313:	c3                   	ret
+	} else if (*args->argc > 1) {
+  801314:	8b 13                	mov    (%ebx),%edx
+  801316:	83 3a 01             	cmpl   $0x1,(%edx)
+  801319:	7f 10                	jg     80132b <argnextvalue+0x3f>
+		args->argvalue = 0;
+  80131b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  801322:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801329:	eb e1                	jmp    80130c <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  80132b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80132e:	8b 48 04             	mov    0x4(%eax),%ecx
+  801331:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801334:	83 ec 04             	sub    $0x4,%esp
+  801337:	8b 12                	mov    (%edx),%edx
+  801339:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  801340:	52                   	push   %edx
+  801341:	8d 50 08             	lea    0x8(%eax),%edx
+  801344:	52                   	push   %edx
+  801345:	83 c0 04             	add    $0x4,%eax
+  801348:	50                   	push   %eax
+  801349:	e8 54 f8 ff ff       	call   800ba2 <memmove>
+		(*args->argc)--;
+  80134e:	8b 03                	mov    (%ebx),%eax
+  801350:	83 28 01             	subl   $0x1,(%eax)
+  801353:	83 c4 10             	add    $0x10,%esp
+  801356:	eb b4                	jmp    80130c <argnextvalue+0x20>
+
+00801358 <argvalue>:
+{
+  801358:	55                   	push   %ebp
+  801359:	89 e5                	mov    %esp,%ebp
+  80135b:	83 ec 08             	sub    $0x8,%esp
+  80135e:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801361:	8b 42 0c             	mov    0xc(%edx),%eax
+  801364:	85 c0                	test   %eax,%eax
+  801366:	74 02                	je     80136a <argvalue+0x12>
+}
+  801368:	c9                   	leave
+  801369:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  80136a:	83 ec 0c             	sub    $0xc,%esp
+  80136d:	52                   	push   %edx
+  80136e:	e8 79 ff ff ff       	call   8012ec <argnextvalue>
+  801373:	83 c4 10             	add    $0x10,%esp
+  801376:	eb f0                	jmp    801368 <argvalue+0x10>
+
+00801378 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801378:	55                   	push   %ebp
+  801379:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80137b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80137e:	05 00 00 00 30       	add    $0x30000000,%eax
+  801383:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801386:	5d                   	pop    %ebp
+  801387:	c3                   	ret
+
+00801388 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801388:	55                   	push   %ebp
+  801389:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80138b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80138e:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801393:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801398:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80139d:	5d                   	pop    %ebp
+  80139e:	c3                   	ret
+
+0080139f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80139f:	55                   	push   %ebp
+  8013a0:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8013a2:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8013a7:	eb 02                	jmp    8013ab <fd_alloc+0xc>
+  8013a9:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013ab:	89 c2                	mov    %eax,%edx
+  8013ad:	c1 ea 16             	shr    $0x16,%edx
+  8013b0:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8013b7:	f6 c2 01             	test   $0x1,%dl
+  8013ba:	74 2b                	je     8013e7 <fd_alloc+0x48>
+  8013bc:	89 c2                	mov    %eax,%edx
+  8013be:	c1 ea 0c             	shr    $0xc,%edx
+  8013c1:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8013c8:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8013ce:	f6 c1 01             	test   $0x1,%cl
+  8013d1:	74 14                	je     8013e7 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8013d3:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8013d9:	75 ce                	jne    8013a9 <fd_alloc+0xa>
+  8013db:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8013e0:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8013e5:	eb 05                	jmp    8013ec <fd_alloc+0x4d>
+			return 0;
+  8013e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8013ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ef:	89 02                	mov    %eax,(%edx)
+}
+  8013f1:	89 c8                	mov    %ecx,%eax
+  8013f3:	5d                   	pop    %ebp
+  8013f4:	c3                   	ret
+
+008013f5 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013f5:	55                   	push   %ebp
+  8013f6:	89 e5                	mov    %esp,%ebp
+  8013f8:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8013fb:	83 f8 1f             	cmp    $0x1f,%eax
+  8013fe:	77 30                	ja     801430 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801400:	c1 e0 0c             	shl    $0xc,%eax
+  801403:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801408:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80140e:	f6 c2 01             	test   $0x1,%dl
+  801411:	74 24                	je     801437 <fd_lookup+0x42>
+  801413:	89 c2                	mov    %eax,%edx
+  801415:	c1 ea 0c             	shr    $0xc,%edx
+  801418:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80141f:	f6 c2 01             	test   $0x1,%dl
+  801422:	74 1a                	je     80143e <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801424:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801427:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801429:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80142e:	5d                   	pop    %ebp
+  80142f:	c3                   	ret
+		return -E_INVAL;
+  801430:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801435:	eb f7                	jmp    80142e <fd_lookup+0x39>
+		return -E_INVAL;
+  801437:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80143c:	eb f0                	jmp    80142e <fd_lookup+0x39>
+  80143e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801443:	eb e9                	jmp    80142e <fd_lookup+0x39>
+
+00801445 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801445:	55                   	push   %ebp
+  801446:	89 e5                	mov    %esp,%ebp
+  801448:	53                   	push   %ebx
+  801449:	83 ec 04             	sub    $0x4,%esp
+  80144c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80144f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801454:	eb 03                	jmp    801459 <dev_lookup+0x14>
+  801456:	83 c0 01             	add    $0x1,%eax
+  801459:	8b 1c 85 d0 40 80 00 	mov    0x8040d0(,%eax,4),%ebx
+  801460:	85 db                	test   %ebx,%ebx
+  801462:	74 0b                	je     80146f <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801464:	39 13                	cmp    %edx,(%ebx)
+  801466:	75 ee                	jne    801456 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146d:	eb 1f                	jmp    80148e <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80146f:	a1 00 74 80 00       	mov    0x807400,%eax
+  801474:	8b 40 48             	mov    0x48(%eax),%eax
+  801477:	83 ec 04             	sub    $0x4,%esp
+  80147a:	52                   	push   %edx
+  80147b:	50                   	push   %eax
+  80147c:	68 54 40 80 00       	push   $0x804054
+  801481:	e8 a8 ef ff ff       	call   80042e <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801486:	83 c4 10             	add    $0x10,%esp
+  801489:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80148e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801491:	89 1a                	mov    %ebx,(%edx)
+}
+  801493:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801496:	c9                   	leave
+  801497:	c3                   	ret
+
+00801498 <fd_close>:
+{
+  801498:	55                   	push   %ebp
+  801499:	89 e5                	mov    %esp,%ebp
+  80149b:	57                   	push   %edi
+  80149c:	56                   	push   %esi
+  80149d:	53                   	push   %ebx
+  80149e:	83 ec 24             	sub    $0x24,%esp
+  8014a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014a4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014a7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014aa:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014ab:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014b1:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014b4:	50                   	push   %eax
+  8014b5:	e8 3b ff ff ff       	call   8013f5 <fd_lookup>
+  8014ba:	89 c3                	mov    %eax,%ebx
+  8014bc:	83 c4 10             	add    $0x10,%esp
+  8014bf:	85 c0                	test   %eax,%eax
+  8014c1:	78 05                	js     8014c8 <fd_close+0x30>
+	    || fd != fd2)
+  8014c3:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8014c6:	74 16                	je     8014de <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8014c8:	89 f8                	mov    %edi,%eax
+  8014ca:	84 c0                	test   %al,%al
+  8014cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d1:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014d4:	89 d8                	mov    %ebx,%eax
+  8014d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d9:	5b                   	pop    %ebx
+  8014da:	5e                   	pop    %esi
+  8014db:	5f                   	pop    %edi
+  8014dc:	5d                   	pop    %ebp
+  8014dd:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014de:	83 ec 08             	sub    $0x8,%esp
+  8014e1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014e4:	50                   	push   %eax
+  8014e5:	ff 36                	push   (%esi)
+  8014e7:	e8 59 ff ff ff       	call   801445 <dev_lookup>
+  8014ec:	89 c3                	mov    %eax,%ebx
+  8014ee:	83 c4 10             	add    $0x10,%esp
+  8014f1:	85 c0                	test   %eax,%eax
+  8014f3:	78 1a                	js     80150f <fd_close+0x77>
+		if (dev->dev_close)
+  8014f5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014f8:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801500:	85 c0                	test   %eax,%eax
+  801502:	74 0b                	je     80150f <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801504:	83 ec 0c             	sub    $0xc,%esp
+  801507:	56                   	push   %esi
+  801508:	ff d0                	call   *%eax
+  80150a:	89 c3                	mov    %eax,%ebx
+  80150c:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80150f:	83 ec 08             	sub    $0x8,%esp
+  801512:	56                   	push   %esi
+  801513:	6a 00                	push   $0x0
+  801515:	e8 9b f9 ff ff       	call   800eb5 <sys_page_unmap>
+	return r;
+  80151a:	83 c4 10             	add    $0x10,%esp
+  80151d:	eb b5                	jmp    8014d4 <fd_close+0x3c>
+
+0080151f <close>:
+
+int
+close(int fdnum)
+{
+  80151f:	55                   	push   %ebp
+  801520:	89 e5                	mov    %esp,%ebp
+  801522:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801525:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801528:	50                   	push   %eax
+  801529:	ff 75 08             	push   0x8(%ebp)
+  80152c:	e8 c4 fe ff ff       	call   8013f5 <fd_lookup>
+  801531:	83 c4 10             	add    $0x10,%esp
+  801534:	85 c0                	test   %eax,%eax
+  801536:	79 02                	jns    80153a <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801538:	c9                   	leave
+  801539:	c3                   	ret
+		return fd_close(fd, 1);
+  80153a:	83 ec 08             	sub    $0x8,%esp
+  80153d:	6a 01                	push   $0x1
+  80153f:	ff 75 f4             	push   -0xc(%ebp)
+  801542:	e8 51 ff ff ff       	call   801498 <fd_close>
+  801547:	83 c4 10             	add    $0x10,%esp
+  80154a:	eb ec                	jmp    801538 <close+0x19>
+
+0080154c <close_all>:
+
+void
+close_all(void)
+{
+  80154c:	55                   	push   %ebp
+  80154d:	89 e5                	mov    %esp,%ebp
+  80154f:	53                   	push   %ebx
+  801550:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801553:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801558:	83 ec 0c             	sub    $0xc,%esp
+  80155b:	53                   	push   %ebx
+  80155c:	e8 be ff ff ff       	call   80151f <close>
+	for (i = 0; i < MAXFD; i++)
+  801561:	83 c3 01             	add    $0x1,%ebx
+  801564:	83 c4 10             	add    $0x10,%esp
+  801567:	83 fb 20             	cmp    $0x20,%ebx
+  80156a:	75 ec                	jne    801558 <close_all+0xc>
+}
+  80156c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80156f:	c9                   	leave
+  801570:	c3                   	ret
+
+00801571 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801571:	55                   	push   %ebp
+  801572:	89 e5                	mov    %esp,%ebp
+  801574:	57                   	push   %edi
+  801575:	56                   	push   %esi
+  801576:	53                   	push   %ebx
+  801577:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80157a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80157d:	50                   	push   %eax
+  80157e:	ff 75 08             	push   0x8(%ebp)
+  801581:	e8 6f fe ff ff       	call   8013f5 <fd_lookup>
+  801586:	89 c3                	mov    %eax,%ebx
+  801588:	83 c4 10             	add    $0x10,%esp
+  80158b:	85 c0                	test   %eax,%eax
+  80158d:	78 7f                	js     80160e <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80158f:	83 ec 0c             	sub    $0xc,%esp
+  801592:	ff 75 0c             	push   0xc(%ebp)
+  801595:	e8 85 ff ff ff       	call   80151f <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80159a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80159d:	c1 e6 0c             	shl    $0xc,%esi
+  8015a0:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8015a6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8015a9:	89 3c 24             	mov    %edi,(%esp)
+  8015ac:	e8 d7 fd ff ff       	call   801388 <fd2data>
+  8015b1:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8015b3:	89 34 24             	mov    %esi,(%esp)
+  8015b6:	e8 cd fd ff ff       	call   801388 <fd2data>
+  8015bb:	83 c4 10             	add    $0x10,%esp
+  8015be:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8015c1:	89 d8                	mov    %ebx,%eax
+  8015c3:	c1 e8 16             	shr    $0x16,%eax
+  8015c6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015cd:	a8 01                	test   $0x1,%al
+  8015cf:	74 11                	je     8015e2 <dup+0x71>
+  8015d1:	89 d8                	mov    %ebx,%eax
+  8015d3:	c1 e8 0c             	shr    $0xc,%eax
+  8015d6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015dd:	f6 c2 01             	test   $0x1,%dl
+  8015e0:	75 36                	jne    801618 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015e2:	89 f8                	mov    %edi,%eax
+  8015e4:	c1 e8 0c             	shr    $0xc,%eax
+  8015e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015ee:	83 ec 0c             	sub    $0xc,%esp
+  8015f1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015f6:	50                   	push   %eax
+  8015f7:	56                   	push   %esi
+  8015f8:	6a 00                	push   $0x0
+  8015fa:	57                   	push   %edi
+  8015fb:	6a 00                	push   $0x0
+  8015fd:	e8 71 f8 ff ff       	call   800e73 <sys_page_map>
+  801602:	89 c3                	mov    %eax,%ebx
+  801604:	83 c4 20             	add    $0x20,%esp
+  801607:	85 c0                	test   %eax,%eax
+  801609:	78 33                	js     80163e <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80160b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80160e:	89 d8                	mov    %ebx,%eax
+  801610:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801613:	5b                   	pop    %ebx
+  801614:	5e                   	pop    %esi
+  801615:	5f                   	pop    %edi
+  801616:	5d                   	pop    %ebp
+  801617:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801618:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80161f:	83 ec 0c             	sub    $0xc,%esp
+  801622:	25 07 0e 00 00       	and    $0xe07,%eax
+  801627:	50                   	push   %eax
+  801628:	ff 75 d4             	push   -0x2c(%ebp)
+  80162b:	6a 00                	push   $0x0
+  80162d:	53                   	push   %ebx
+  80162e:	6a 00                	push   $0x0
+  801630:	e8 3e f8 ff ff       	call   800e73 <sys_page_map>
+  801635:	89 c3                	mov    %eax,%ebx
+  801637:	83 c4 20             	add    $0x20,%esp
+  80163a:	85 c0                	test   %eax,%eax
+  80163c:	79 a4                	jns    8015e2 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80163e:	83 ec 08             	sub    $0x8,%esp
+  801641:	56                   	push   %esi
+  801642:	6a 00                	push   $0x0
+  801644:	e8 6c f8 ff ff       	call   800eb5 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801649:	83 c4 08             	add    $0x8,%esp
+  80164c:	ff 75 d4             	push   -0x2c(%ebp)
+  80164f:	6a 00                	push   $0x0
+  801651:	e8 5f f8 ff ff       	call   800eb5 <sys_page_unmap>
+	return r;
+  801656:	83 c4 10             	add    $0x10,%esp
+  801659:	eb b3                	jmp    80160e <dup+0x9d>
+
+0080165b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80165b:	55                   	push   %ebp
+  80165c:	89 e5                	mov    %esp,%ebp
+  80165e:	56                   	push   %esi
+  80165f:	53                   	push   %ebx
+  801660:	83 ec 18             	sub    $0x18,%esp
+  801663:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801666:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801669:	50                   	push   %eax
+  80166a:	56                   	push   %esi
+  80166b:	e8 85 fd ff ff       	call   8013f5 <fd_lookup>
+  801670:	83 c4 10             	add    $0x10,%esp
+  801673:	85 c0                	test   %eax,%eax
+  801675:	78 3c                	js     8016b3 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801677:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80167a:	83 ec 08             	sub    $0x8,%esp
+  80167d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801680:	50                   	push   %eax
+  801681:	ff 33                	push   (%ebx)
+  801683:	e8 bd fd ff ff       	call   801445 <dev_lookup>
+  801688:	83 c4 10             	add    $0x10,%esp
+  80168b:	85 c0                	test   %eax,%eax
+  80168d:	78 24                	js     8016b3 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80168f:	8b 43 08             	mov    0x8(%ebx),%eax
+  801692:	83 e0 03             	and    $0x3,%eax
+  801695:	83 f8 01             	cmp    $0x1,%eax
+  801698:	74 20                	je     8016ba <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80169a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80169d:	8b 40 08             	mov    0x8(%eax),%eax
+  8016a0:	85 c0                	test   %eax,%eax
+  8016a2:	74 37                	je     8016db <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8016a4:	83 ec 04             	sub    $0x4,%esp
+  8016a7:	ff 75 10             	push   0x10(%ebp)
+  8016aa:	ff 75 0c             	push   0xc(%ebp)
+  8016ad:	53                   	push   %ebx
+  8016ae:	ff d0                	call   *%eax
+  8016b0:	83 c4 10             	add    $0x10,%esp
+}
+  8016b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016b6:	5b                   	pop    %ebx
+  8016b7:	5e                   	pop    %esi
+  8016b8:	5d                   	pop    %ebp
+  8016b9:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016ba:	a1 00 74 80 00       	mov    0x807400,%eax
+  8016bf:	8b 40 48             	mov    0x48(%eax),%eax
+  8016c2:	83 ec 04             	sub    $0x4,%esp
+  8016c5:	56                   	push   %esi
+  8016c6:	50                   	push   %eax
+  8016c7:	68 95 40 80 00       	push   $0x804095
+  8016cc:	e8 5d ed ff ff       	call   80042e <cprintf>
+		return -E_INVAL;
+  8016d1:	83 c4 10             	add    $0x10,%esp
+  8016d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d9:	eb d8                	jmp    8016b3 <read+0x58>
+		return -E_NOT_SUPP;
+  8016db:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016e0:	eb d1                	jmp    8016b3 <read+0x58>
+
+008016e2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016e2:	55                   	push   %ebp
+  8016e3:	89 e5                	mov    %esp,%ebp
+  8016e5:	57                   	push   %edi
+  8016e6:	56                   	push   %esi
+  8016e7:	53                   	push   %ebx
+  8016e8:	83 ec 0c             	sub    $0xc,%esp
+  8016eb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016ee:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f6:	eb 02                	jmp    8016fa <readn+0x18>
+  8016f8:	01 c3                	add    %eax,%ebx
+  8016fa:	39 f3                	cmp    %esi,%ebx
+  8016fc:	73 21                	jae    80171f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016fe:	83 ec 04             	sub    $0x4,%esp
+  801701:	89 f0                	mov    %esi,%eax
+  801703:	29 d8                	sub    %ebx,%eax
+  801705:	50                   	push   %eax
+  801706:	89 d8                	mov    %ebx,%eax
+  801708:	03 45 0c             	add    0xc(%ebp),%eax
+  80170b:	50                   	push   %eax
+  80170c:	57                   	push   %edi
+  80170d:	e8 49 ff ff ff       	call   80165b <read>
+		if (m < 0)
+  801712:	83 c4 10             	add    $0x10,%esp
+  801715:	85 c0                	test   %eax,%eax
+  801717:	78 04                	js     80171d <readn+0x3b>
+			return m;
+		if (m == 0)
+  801719:	75 dd                	jne    8016f8 <readn+0x16>
+  80171b:	eb 02                	jmp    80171f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80171d:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80171f:	89 d8                	mov    %ebx,%eax
+  801721:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801724:	5b                   	pop    %ebx
+  801725:	5e                   	pop    %esi
+  801726:	5f                   	pop    %edi
+  801727:	5d                   	pop    %ebp
+  801728:	c3                   	ret
+
+00801729 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801729:	55                   	push   %ebp
+  80172a:	89 e5                	mov    %esp,%ebp
+  80172c:	56                   	push   %esi
+  80172d:	53                   	push   %ebx
+  80172e:	83 ec 18             	sub    $0x18,%esp
+  801731:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801734:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801737:	50                   	push   %eax
+  801738:	53                   	push   %ebx
+  801739:	e8 b7 fc ff ff       	call   8013f5 <fd_lookup>
+  80173e:	83 c4 10             	add    $0x10,%esp
+  801741:	85 c0                	test   %eax,%eax
+  801743:	78 37                	js     80177c <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801745:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801748:	83 ec 08             	sub    $0x8,%esp
+  80174b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80174e:	50                   	push   %eax
+  80174f:	ff 36                	push   (%esi)
+  801751:	e8 ef fc ff ff       	call   801445 <dev_lookup>
+  801756:	83 c4 10             	add    $0x10,%esp
+  801759:	85 c0                	test   %eax,%eax
+  80175b:	78 1f                	js     80177c <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80175d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801761:	74 20                	je     801783 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801763:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801766:	8b 40 0c             	mov    0xc(%eax),%eax
+  801769:	85 c0                	test   %eax,%eax
+  80176b:	74 37                	je     8017a4 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80176d:	83 ec 04             	sub    $0x4,%esp
+  801770:	ff 75 10             	push   0x10(%ebp)
+  801773:	ff 75 0c             	push   0xc(%ebp)
+  801776:	56                   	push   %esi
+  801777:	ff d0                	call   *%eax
+  801779:	83 c4 10             	add    $0x10,%esp
+}
+  80177c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80177f:	5b                   	pop    %ebx
+  801780:	5e                   	pop    %esi
+  801781:	5d                   	pop    %ebp
+  801782:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801783:	a1 00 74 80 00       	mov    0x807400,%eax
+  801788:	8b 40 48             	mov    0x48(%eax),%eax
+  80178b:	83 ec 04             	sub    $0x4,%esp
+  80178e:	53                   	push   %ebx
+  80178f:	50                   	push   %eax
+  801790:	68 b1 40 80 00       	push   $0x8040b1
+  801795:	e8 94 ec ff ff       	call   80042e <cprintf>
+		return -E_INVAL;
+  80179a:	83 c4 10             	add    $0x10,%esp
+  80179d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a2:	eb d8                	jmp    80177c <write+0x53>
+		return -E_NOT_SUPP;
+  8017a4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017a9:	eb d1                	jmp    80177c <write+0x53>
+
+008017ab <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017ab:	55                   	push   %ebp
+  8017ac:	89 e5                	mov    %esp,%ebp
+  8017ae:	53                   	push   %ebx
+  8017af:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017b2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017b5:	50                   	push   %eax
+  8017b6:	ff 75 08             	push   0x8(%ebp)
+  8017b9:	e8 37 fc ff ff       	call   8013f5 <fd_lookup>
+  8017be:	83 c4 10             	add    $0x10,%esp
+  8017c1:	85 c0                	test   %eax,%eax
+  8017c3:	78 3a                	js     8017ff <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017c5:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8017c8:	83 ec 08             	sub    $0x8,%esp
+  8017cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017ce:	50                   	push   %eax
+  8017cf:	ff 33                	push   (%ebx)
+  8017d1:	e8 6f fc ff ff       	call   801445 <dev_lookup>
+  8017d6:	83 c4 10             	add    $0x10,%esp
+  8017d9:	85 c0                	test   %eax,%eax
+  8017db:	78 22                	js     8017ff <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8017dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017e0:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8017e3:	85 c0                	test   %eax,%eax
+  8017e5:	74 0d                	je     8017f4 <seek+0x49>
+  8017e7:	83 ec 0c             	sub    $0xc,%esp
+  8017ea:	53                   	push   %ebx
+  8017eb:	ff d0                	call   *%eax
+  8017ed:	83 c4 10             	add    $0x10,%esp
+  8017f0:	85 c0                	test   %eax,%eax
+  8017f2:	78 0b                	js     8017ff <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8017f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017f7:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8017fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801802:	c9                   	leave
+  801803:	c3                   	ret
+
+00801804 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801804:	55                   	push   %ebp
+  801805:	89 e5                	mov    %esp,%ebp
+  801807:	53                   	push   %ebx
+  801808:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80180b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80180e:	50                   	push   %eax
+  80180f:	ff 75 08             	push   0x8(%ebp)
+  801812:	e8 de fb ff ff       	call   8013f5 <fd_lookup>
+  801817:	83 c4 10             	add    $0x10,%esp
+  80181a:	85 c0                	test   %eax,%eax
+  80181c:	78 2b                	js     801849 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80181e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801821:	83 ec 08             	sub    $0x8,%esp
+  801824:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801827:	50                   	push   %eax
+  801828:	ff 33                	push   (%ebx)
+  80182a:	e8 16 fc ff ff       	call   801445 <dev_lookup>
+  80182f:	83 c4 10             	add    $0x10,%esp
+  801832:	85 c0                	test   %eax,%eax
+  801834:	78 13                	js     801849 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801836:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801839:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80183c:	85 c0                	test   %eax,%eax
+  80183e:	74 0e                	je     80184e <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801840:	83 ec 0c             	sub    $0xc,%esp
+  801843:	53                   	push   %ebx
+  801844:	ff d0                	call   *%eax
+  801846:	83 c4 10             	add    $0x10,%esp
+}
+  801849:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80184c:	c9                   	leave
+  80184d:	c3                   	ret
+		return 0;
+  80184e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801853:	eb f4                	jmp    801849 <fsync+0x45>
+
+00801855 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801855:	55                   	push   %ebp
+  801856:	89 e5                	mov    %esp,%ebp
+  801858:	56                   	push   %esi
+  801859:	53                   	push   %ebx
+  80185a:	83 ec 18             	sub    $0x18,%esp
+  80185d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801860:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801863:	50                   	push   %eax
+  801864:	53                   	push   %ebx
+  801865:	e8 8b fb ff ff       	call   8013f5 <fd_lookup>
+  80186a:	83 c4 10             	add    $0x10,%esp
+  80186d:	85 c0                	test   %eax,%eax
+  80186f:	78 34                	js     8018a5 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801871:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801874:	83 ec 08             	sub    $0x8,%esp
+  801877:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80187a:	50                   	push   %eax
+  80187b:	ff 36                	push   (%esi)
+  80187d:	e8 c3 fb ff ff       	call   801445 <dev_lookup>
+  801882:	83 c4 10             	add    $0x10,%esp
+  801885:	85 c0                	test   %eax,%eax
+  801887:	78 1c                	js     8018a5 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801889:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80188d:	74 1d                	je     8018ac <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80188f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801892:	8b 40 18             	mov    0x18(%eax),%eax
+  801895:	85 c0                	test   %eax,%eax
+  801897:	74 34                	je     8018cd <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801899:	83 ec 08             	sub    $0x8,%esp
+  80189c:	ff 75 0c             	push   0xc(%ebp)
+  80189f:	56                   	push   %esi
+  8018a0:	ff d0                	call   *%eax
+  8018a2:	83 c4 10             	add    $0x10,%esp
+}
+  8018a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018a8:	5b                   	pop    %ebx
+  8018a9:	5e                   	pop    %esi
+  8018aa:	5d                   	pop    %ebp
+  8018ab:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8018ac:	a1 00 74 80 00       	mov    0x807400,%eax
+  8018b1:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8018b4:	83 ec 04             	sub    $0x4,%esp
+  8018b7:	53                   	push   %ebx
+  8018b8:	50                   	push   %eax
+  8018b9:	68 74 40 80 00       	push   $0x804074
+  8018be:	e8 6b eb ff ff       	call   80042e <cprintf>
+		return -E_INVAL;
+  8018c3:	83 c4 10             	add    $0x10,%esp
+  8018c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018cb:	eb d8                	jmp    8018a5 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8018cd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018d2:	eb d1                	jmp    8018a5 <ftruncate+0x50>
+
+008018d4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8018d4:	55                   	push   %ebp
+  8018d5:	89 e5                	mov    %esp,%ebp
+  8018d7:	56                   	push   %esi
+  8018d8:	53                   	push   %ebx
+  8018d9:	83 ec 18             	sub    $0x18,%esp
+  8018dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018df:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018e2:	50                   	push   %eax
+  8018e3:	ff 75 08             	push   0x8(%ebp)
+  8018e6:	e8 0a fb ff ff       	call   8013f5 <fd_lookup>
+  8018eb:	83 c4 10             	add    $0x10,%esp
+  8018ee:	85 c0                	test   %eax,%eax
+  8018f0:	78 49                	js     80193b <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018f2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018f5:	83 ec 08             	sub    $0x8,%esp
+  8018f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018fb:	50                   	push   %eax
+  8018fc:	ff 36                	push   (%esi)
+  8018fe:	e8 42 fb ff ff       	call   801445 <dev_lookup>
+  801903:	83 c4 10             	add    $0x10,%esp
+  801906:	85 c0                	test   %eax,%eax
+  801908:	78 31                	js     80193b <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80190a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80190d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801911:	74 2f                	je     801942 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801913:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801916:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80191d:	00 00 00 
+	stat->st_isdir = 0;
+  801920:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801927:	00 00 00 
+	stat->st_dev = dev;
+  80192a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801930:	83 ec 08             	sub    $0x8,%esp
+  801933:	53                   	push   %ebx
+  801934:	56                   	push   %esi
+  801935:	ff 50 14             	call   *0x14(%eax)
+  801938:	83 c4 10             	add    $0x10,%esp
+}
+  80193b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80193e:	5b                   	pop    %ebx
+  80193f:	5e                   	pop    %esi
+  801940:	5d                   	pop    %ebp
+  801941:	c3                   	ret
+		return -E_NOT_SUPP;
+  801942:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801947:	eb f2                	jmp    80193b <fstat+0x67>
+
+00801949 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+  80194c:	56                   	push   %esi
+  80194d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  80194e:	83 ec 08             	sub    $0x8,%esp
+  801951:	68 00 10 00 00       	push   $0x1000
+  801956:	ff 75 08             	push   0x8(%ebp)
+  801959:	e8 b3 07 00 00       	call   802111 <open>
+  80195e:	89 c3                	mov    %eax,%ebx
+  801960:	83 c4 10             	add    $0x10,%esp
+  801963:	85 c0                	test   %eax,%eax
+  801965:	78 1b                	js     801982 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801967:	83 ec 08             	sub    $0x8,%esp
+  80196a:	ff 75 0c             	push   0xc(%ebp)
+  80196d:	50                   	push   %eax
+  80196e:	e8 61 ff ff ff       	call   8018d4 <fstat>
+  801973:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801975:	89 1c 24             	mov    %ebx,(%esp)
+  801978:	e8 a2 fb ff ff       	call   80151f <close>
+	return r;
+  80197d:	83 c4 10             	add    $0x10,%esp
+  801980:	89 f3                	mov    %esi,%ebx
+}
+  801982:	89 d8                	mov    %ebx,%eax
+  801984:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801987:	5b                   	pop    %ebx
+  801988:	5e                   	pop    %esi
+  801989:	5d                   	pop    %ebp
+  80198a:	c3                   	ret
+
+0080198b <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  80198b:	55                   	push   %ebp
+  80198c:	89 e5                	mov    %esp,%ebp
+  80198e:	57                   	push   %edi
+  80198f:	56                   	push   %esi
+  801990:	53                   	push   %ebx
+  801991:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801997:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  80199d:	89 d6                	mov    %edx,%esi
+  80199f:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  8019a5:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  8019a8:	89 d3                	mov    %edx,%ebx
+  8019aa:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  8019b0:	83 3d c8 90 80 00 00 	cmpl   $0x0,0x8090c8
+  8019b7:	74 1d                	je     8019d6 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8019b9:	b8 00 80 80 00       	mov    $0x808000,%eax
+  8019be:	83 c8 07             	or     $0x7,%eax
+  8019c1:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  8019c7:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8019cc:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  8019d2:	01 ce                	add    %ecx,%esi
+  8019d4:	eb 28                	jmp    8019fe <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019d6:	83 ec 0c             	sub    $0xc,%esp
+  8019d9:	6a 01                	push   $0x1
+  8019db:	e8 20 1f 00 00       	call   803900 <ipc_find_env>
+  8019e0:	a3 c8 90 80 00       	mov    %eax,0x8090c8
+  8019e5:	83 c4 10             	add    $0x10,%esp
+  8019e8:	eb cf                	jmp    8019b9 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  8019ea:	83 c0 01             	add    $0x1,%eax
+  8019ed:	89 fa                	mov    %edi,%edx
+  8019ef:	09 da                	or     %ebx,%edx
+  8019f1:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8019f8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8019fe:	39 f3                	cmp    %esi,%ebx
+  801a00:	72 e8                	jb     8019ea <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801a02:	83 f8 41             	cmp    $0x41,%eax
+  801a05:	77 2f                	ja     801a36 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801a07:	50                   	push   %eax
+  801a08:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801a0e:	50                   	push   %eax
+  801a0f:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801a15:	ff 35 c8 90 80 00    	push   0x8090c8
+  801a1b:	e8 92 1e 00 00       	call   8038b2 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801a20:	83 c4 0c             	add    $0xc,%esp
+  801a23:	6a 00                	push   $0x0
+  801a25:	6a 00                	push   $0x0
+  801a27:	6a 00                	push   $0x0
+  801a29:	e8 2e 1d 00 00       	call   80375c <ipc_recv>
+}
+  801a2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a31:	5b                   	pop    %ebx
+  801a32:	5e                   	pop    %esi
+  801a33:	5f                   	pop    %edi
+  801a34:	5d                   	pop    %ebp
+  801a35:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801a36:	68 e4 40 80 00       	push   $0x8040e4
+  801a3b:	68 00 41 80 00       	push   $0x804100
+  801a40:	6a 40                	push   $0x40
+  801a42:	68 15 41 80 00       	push   $0x804115
+  801a47:	e8 07 e9 ff ff       	call   800353 <_panic>
+
+00801a4c <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801a4c:	55                   	push   %ebp
+  801a4d:	89 e5                	mov    %esp,%ebp
+  801a4f:	57                   	push   %edi
+  801a50:	56                   	push   %esi
+  801a51:	53                   	push   %ebx
+  801a52:	83 ec 1c             	sub    $0x1c,%esp
+  801a55:	89 c3                	mov    %eax,%ebx
+  801a57:	89 d6                	mov    %edx,%esi
+  801a59:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801a5c:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801a62:	89 ca                	mov    %ecx,%edx
+  801a64:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801a67:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801a6e:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801a71:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801a78:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a7b:	89 fb                	mov    %edi,%ebx
+  801a7d:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801a84:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a87:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801a8e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a91:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801a98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a9b:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801aa2:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801aa5:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801aac:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801ab1:	39 c8                	cmp    %ecx,%eax
+  801ab3:	74 0d                	je     801ac2 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801ab5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801abd:	5b                   	pop    %ebx
+  801abe:	5e                   	pop    %esi
+  801abf:	5f                   	pop    %edi
+  801ac0:	5d                   	pop    %ebp
+  801ac1:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ac2:	6a 07                	push   $0x7
+  801ac4:	68 00 80 80 00       	push   $0x808000
+  801ac9:	6a 0d                	push   $0xd
+  801acb:	ff 35 c8 90 80 00    	push   0x8090c8
+  801ad1:	e8 f1 1c 00 00       	call   8037c7 <ipc_send>
+  801ad6:	83 c4 10             	add    $0x10,%esp
+  801ad9:	eb da                	jmp    801ab5 <fsring_post+0x69>
+
+00801adb <fsipcv>:
+{
+  801adb:	55                   	push   %ebp
+  801adc:	89 e5                	mov    %esp,%ebp
+  801ade:	57                   	push   %edi
+  801adf:	56                   	push   %esi
+  801ae0:	53                   	push   %ebx
+  801ae1:	83 ec 0c             	sub    $0xc,%esp
+  801ae4:	89 c7                	mov    %eax,%edi
+  801ae6:	89 d3                	mov    %edx,%ebx
+  801ae8:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801aea:	83 3d c8 90 80 00 00 	cmpl   $0x0,0x8090c8
+  801af1:	74 26                	je     801b19 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801af3:	6a 07                	push   $0x7
+  801af5:	68 00 80 80 00       	push   $0x808000
+  801afa:	57                   	push   %edi
+  801afb:	ff 35 c8 90 80 00    	push   0x8090c8
+  801b01:	e8 c1 1c 00 00       	call   8037c7 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801b06:	6a 00                	push   $0x0
+  801b08:	56                   	push   %esi
+  801b09:	53                   	push   %ebx
+  801b0a:	6a 00                	push   $0x0
+  801b0c:	e8 0e 1d 00 00       	call   80381f <ipc_recvv>
+}
+  801b11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b14:	5b                   	pop    %ebx
+  801b15:	5e                   	pop    %esi
+  801b16:	5f                   	pop    %edi
+  801b17:	5d                   	pop    %ebp
+  801b18:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b19:	83 ec 0c             	sub    $0xc,%esp
+  801b1c:	6a 01                	push   $0x1
+  801b1e:	e8 dd 1d 00 00       	call   803900 <ipc_find_env>
+  801b23:	a3 c8 90 80 00       	mov    %eax,0x8090c8
+  801b28:	83 c4 10             	add    $0x10,%esp
+  801b2b:	eb c6                	jmp    801af3 <fsipcv+0x18>
+
+00801b2d <fsipc>:
+{
+  801b2d:	55                   	push   %ebp
+  801b2e:	89 e5                	mov    %esp,%ebp
+  801b30:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801b33:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801b3a:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801b3d:	e8 99 ff ff ff       	call   801adb <fsipcv>
+}
+  801b42:	c9                   	leave
+  801b43:	c3                   	ret
+
+00801b44 <file_write_direct>:
+{
+  801b44:	55                   	push   %ebp
+  801b45:	89 e5                	mov    %esp,%ebp
+  801b47:	56                   	push   %esi
+  801b48:	53                   	push   %ebx
+  801b49:	89 c3                	mov    %eax,%ebx
+  801b4b:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801b4d:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801b53:	77 40                	ja     801b95 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801b55:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801b5a:	39 c8                	cmp    %ecx,%eax
+  801b5c:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b5f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801b62:	89 0d 00 80 80 00    	mov    %ecx,0x808000
+	fsipcbuf.write.req_n = n;
+  801b68:	a3 04 80 80 00       	mov    %eax,0x808004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801b6d:	83 ec 04             	sub    $0x4,%esp
+  801b70:	50                   	push   %eax
+  801b71:	52                   	push   %edx
+  801b72:	68 08 80 80 00       	push   $0x808008
+  801b77:	e8 26 f0 ff ff       	call   800ba2 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801b7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b81:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b86:	e8 a2 ff ff ff       	call   801b2d <fsipc>
+  801b8b:	83 c4 10             	add    $0x10,%esp
+}
+  801b8e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b91:	5b                   	pop    %ebx
+  801b92:	5e                   	pop    %esi
+  801b93:	5d                   	pop    %ebp
+  801b94:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801b95:	89 d6                	mov    %edx,%esi
+  801b97:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801b9d:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801ba2:	29 f1                	sub    %esi,%ecx
+  801ba4:	39 c1                	cmp    %eax,%ecx
+  801ba6:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801ba9:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801bac:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.bulk.req_n = n;
+  801bb1:	89 0d 04 80 80 00    	mov    %ecx,0x808004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801bb7:	89 35 08 80 80 00    	mov    %esi,0x808008
+	return fsipc_pages(type, buf, n, perm);
+  801bbd:	83 ec 0c             	sub    $0xc,%esp
+  801bc0:	6a 05                	push   $0x5
+  801bc2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801bc7:	e8 bf fd ff ff       	call   80198b <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801bcc:	83 c4 10             	add    $0x10,%esp
+  801bcf:	eb bd                	jmp    801b8e <file_write_direct+0x4a>
+
+00801bd1 <devfile_sync>:
+{
+  801bd1:	55                   	push   %ebp
+  801bd2:	89 e5                	mov    %esp,%ebp
+  801bd4:	57                   	push   %edi
+  801bd5:	56                   	push   %esi
+  801bd6:	53                   	push   %ebx
+  801bd7:	83 ec 28             	sub    $0x28,%esp
+  801bda:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801bdd:	56                   	push   %esi
+  801bde:	e8 a5 f7 ff ff       	call   801388 <fd2data>
+  801be3:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801be5:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801be8:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801bef:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801bf7:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801bfb:	74 45                	je     801c42 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801bfd:	8b 46 14             	mov    0x14(%esi),%eax
+  801c00:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801c03:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c0d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801c10:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801c13:	39 cb                	cmp    %ecx,%ebx
+  801c15:	73 14                	jae    801c2b <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801c17:	29 d9                	sub    %ebx,%ecx
+  801c19:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801c1c:	89 f0                	mov    %esi,%eax
+  801c1e:	e8 21 ff ff ff       	call   801b44 <file_write_direct>
+  801c23:	85 c0                	test   %eax,%eax
+  801c25:	7e 04                	jle    801c2b <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801c27:	01 c3                	add    %eax,%ebx
+  801c29:	eb e5                	jmp    801c10 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801c2b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801c2e:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801c35:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801c38:	85 c0                	test   %eax,%eax
+  801c3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c3f:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801c42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c45:	5b                   	pop    %ebx
+  801c46:	5e                   	pop    %esi
+  801c47:	5f                   	pop    %edi
+  801c48:	5d                   	pop    %ebp
+  801c49:	c3                   	ret
+
+00801c4a <devfile_write>:
+{
+  801c4a:	55                   	push   %ebp
+  801c4b:	89 e5                	mov    %esp,%ebp
+  801c4d:	57                   	push   %edi
+  801c4e:	56                   	push   %esi
+  801c4f:	53                   	push   %ebx
+  801c50:	83 ec 28             	sub    $0x28,%esp
+  801c53:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c56:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801c59:	53                   	push   %ebx
+  801c5a:	e8 29 f7 ff ff       	call   801388 <fd2data>
+  801c5f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801c62:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801c65:	83 c4 10             	add    $0x10,%esp
+  801c68:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801c6c:	74 43                	je     801cb1 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801c6e:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801c75:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801c78:	85 c0                	test   %eax,%eax
+  801c7a:	74 43                	je     801cbf <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801c7c:	89 c2                	mov    %eax,%edx
+  801c7e:	03 53 14             	add    0x14(%ebx),%edx
+  801c81:	39 fa                	cmp    %edi,%edx
+  801c83:	75 0b                	jne    801c90 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801c85:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801c88:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801c8e:	76 66                	jbe    801cf6 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801c90:	83 ec 0c             	sub    $0xc,%esp
+  801c93:	53                   	push   %ebx
+  801c94:	e8 38 ff ff ff       	call   801bd1 <devfile_sync>
+  801c99:	83 c4 10             	add    $0x10,%esp
+  801c9c:	85 c0                	test   %eax,%eax
+  801c9e:	78 4e                	js     801cee <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801ca0:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801ca6:	77 56                	ja     801cfe <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801ca8:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801cab:	85 c0                	test   %eax,%eax
+  801cad:	75 20                	jne    801ccf <devfile_write+0x85>
+  801caf:	eb 16                	jmp    801cc7 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801cb1:	89 f1                	mov    %esi,%ecx
+  801cb3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cb6:	89 d8                	mov    %ebx,%eax
+  801cb8:	e8 87 fe ff ff       	call   801b44 <file_write_direct>
+  801cbd:	eb 2f                	jmp    801cee <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801cbf:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801cc5:	77 37                	ja     801cfe <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801cc7:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801cca:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801ccf:	83 ec 04             	sub    $0x4,%esp
+  801cd2:	56                   	push   %esi
+  801cd3:	ff 75 0c             	push   0xc(%ebp)
+  801cd6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801cd9:	01 c1                	add    %eax,%ecx
+  801cdb:	51                   	push   %ecx
+  801cdc:	e8 c1 ee ff ff       	call   800ba2 <memmove>
+	ff->buf_wlen += n;
+  801ce1:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801ce4:	01 f7                	add    %esi,%edi
+  801ce6:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801ce9:	89 f0                	mov    %esi,%eax
+  801ceb:	83 c4 10             	add    $0x10,%esp
+}
+  801cee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf1:	5b                   	pop    %ebx
+  801cf2:	5e                   	pop    %esi
+  801cf3:	5f                   	pop    %edi
+  801cf4:	5d                   	pop    %ebp
+  801cf5:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801cf6:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801cfc:	76 d1                	jbe    801ccf <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801cfe:	89 f1                	mov    %esi,%ecx
+  801d00:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d03:	89 d8                	mov    %ebx,%eax
+  801d05:	e8 3a fe ff ff       	call   801b44 <file_write_direct>
+  801d0a:	eb e2                	jmp    801cee <devfile_write+0xa4>
+
+00801d0c <devfile_trunc>:
+{
+  801d0c:	55                   	push   %ebp
+  801d0d:	89 e5                	mov    %esp,%ebp
+  801d0f:	53                   	push   %ebx
+  801d10:	83 ec 10             	sub    $0x10,%esp
+  801d13:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801d16:	53                   	push   %ebx
+  801d17:	e8 b5 fe ff ff       	call   801bd1 <devfile_sync>
+  801d1c:	83 c4 10             	add    $0x10,%esp
+  801d1f:	85 c0                	test   %eax,%eax
+  801d21:	78 1f                	js     801d42 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d23:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801d26:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801d2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d2e:	a3 04 80 80 00       	mov    %eax,0x808004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801d33:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d38:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d3d:	e8 eb fd ff ff       	call   801b2d <fsipc>
+}
+  801d42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d45:	c9                   	leave
+  801d46:	c3                   	ret
+
+00801d47 <devfile_stat>:
+{
+  801d47:	55                   	push   %ebp
+  801d48:	89 e5                	mov    %esp,%ebp
+  801d4a:	56                   	push   %esi
+  801d4b:	53                   	push   %ebx
+  801d4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d4f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801d52:	83 ec 0c             	sub    $0xc,%esp
+  801d55:	53                   	push   %ebx
+  801d56:	e8 76 fe ff ff       	call   801bd1 <devfile_sync>
+  801d5b:	83 c4 10             	add    $0x10,%esp
+  801d5e:	85 c0                	test   %eax,%eax
+  801d60:	78 47                	js     801da9 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d62:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801d65:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d6f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d74:	e8 b4 fd ff ff       	call   801b2d <fsipc>
+  801d79:	85 c0                	test   %eax,%eax
+  801d7b:	78 2c                	js     801da9 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d7d:	83 ec 08             	sub    $0x8,%esp
+  801d80:	68 00 80 80 00       	push   $0x808000
+  801d85:	56                   	push   %esi
+  801d86:	e8 91 ec ff ff       	call   800a1c <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801d8b:	a1 80 80 80 00       	mov    0x808080,%eax
+  801d90:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d96:	a1 84 80 80 00       	mov    0x808084,%eax
+  801d9b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801da1:	83 c4 10             	add    $0x10,%esp
+  801da4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801da9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dac:	5b                   	pop    %ebx
+  801dad:	5e                   	pop    %esi
+  801dae:	5d                   	pop    %ebp
+  801daf:	c3                   	ret
+
+00801db0 <devfile_flush>:
+{
+  801db0:	55                   	push   %ebp
+  801db1:	89 e5                	mov    %esp,%ebp
+  801db3:	56                   	push   %esi
+  801db4:	53                   	push   %ebx
+  801db5:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801db8:	83 ec 0c             	sub    $0xc,%esp
+  801dbb:	56                   	push   %esi
+  801dbc:	e8 10 fe ff ff       	call   801bd1 <devfile_sync>
+  801dc1:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801dc3:	83 c4 10             	add    $0x10,%esp
+  801dc6:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801dca:	75 25                	jne    801df1 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801dcc:	8b 46 0c             	mov    0xc(%esi),%eax
+  801dcf:	a3 00 80 80 00       	mov    %eax,0x808000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801dd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd9:	b8 06 00 00 00       	mov    $0x6,%eax
+  801dde:	e8 4a fd ff ff       	call   801b2d <fsipc>
+  801de3:	85 c0                	test   %eax,%eax
+  801de5:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801de8:	89 d8                	mov    %ebx,%eax
+  801dea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ded:	5b                   	pop    %ebx
+  801dee:	5e                   	pop    %esi
+  801def:	5d                   	pop    %ebp
+  801df0:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801df1:	83 ec 0c             	sub    $0xc,%esp
+  801df4:	56                   	push   %esi
+  801df5:	e8 8e f5 ff ff       	call   801388 <fd2data>
+  801dfa:	83 c4 08             	add    $0x8,%esp
+  801dfd:	50                   	push   %eax
+  801dfe:	6a 00                	push   $0x0
+  801e00:	e8 b0 f0 ff ff       	call   800eb5 <sys_page_unmap>
+  801e05:	83 c4 10             	add    $0x10,%esp
+  801e08:	eb c2                	jmp    801dcc <devfile_flush+0x1c>
+
+00801e0a <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801e0a:	55                   	push   %ebp
+  801e0b:	89 e5                	mov    %esp,%ebp
+  801e0d:	57                   	push   %edi
+  801e0e:	56                   	push   %esi
+  801e0f:	53                   	push   %ebx
+  801e10:	83 ec 64             	sub    $0x64,%esp
+  801e13:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801e15:	52                   	push   %edx
+  801e16:	50                   	push   %eax
+  801e17:	e8 d9 f5 ff ff       	call   8013f5 <fd_lookup>
+  801e1c:	89 c1                	mov    %eax,%ecx
+  801e1e:	83 c4 10             	add    $0x10,%esp
+  801e21:	85 c0                	test   %eax,%eax
+  801e23:	0f 88 f2 00 00 00    	js     801f1b <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801e29:	8b 07                	mov    (%edi),%eax
+  801e2b:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801e31:	39 10                	cmp    %edx,(%eax)
+  801e33:	0f 85 03 01 00 00    	jne    801f3c <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801e39:	a1 00 74 80 00       	mov    0x807400,%eax
+  801e3e:	8b 40 48             	mov    0x48(%eax),%eax
+  801e41:	3b 05 c4 90 80 00    	cmp    0x8090c4,%eax
+  801e47:	0f 84 96 00 00 00    	je     801ee3 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801e4d:	83 3d c8 90 80 00 00 	cmpl   $0x0,0x8090c8
+  801e54:	0f 84 cb 00 00 00    	je     801f25 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801e5a:	b8 00 80 80 00       	mov    $0x808000,%eax
+  801e5f:	83 c8 07             	or     $0x7,%eax
+  801e62:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801e65:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801e68:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801e6d:	83 ec 04             	sub    $0x4,%esp
+  801e70:	68 07 04 00 00       	push   $0x407
+  801e75:	53                   	push   %ebx
+  801e76:	6a 00                	push   $0x0
+  801e78:	e8 ab ef ff ff       	call   800e28 <sys_page_alloc>
+  801e7d:	89 c1                	mov    %eax,%ecx
+  801e7f:	83 c4 10             	add    $0x10,%esp
+  801e82:	85 c0                	test   %eax,%eax
+  801e84:	0f 88 91 00 00 00    	js     801f1b <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801e8a:	89 d8                	mov    %ebx,%eax
+  801e8c:	83 c8 07             	or     $0x7,%eax
+  801e8f:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801e91:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e97:	83 c6 04             	add    $0x4,%esi
+  801e9a:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801ea0:	75 cb                	jne    801e6d <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801ea2:	6a 12                	push   $0x12
+  801ea4:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801ea7:	50                   	push   %eax
+  801ea8:	6a 0c                	push   $0xc
+  801eaa:	ff 35 c8 90 80 00    	push   0x8090c8
+  801eb0:	e8 fd 19 00 00       	call   8038b2 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801eb5:	83 c4 0c             	add    $0xc,%esp
+  801eb8:	6a 00                	push   $0x0
+  801eba:	6a 00                	push   $0x0
+  801ebc:	6a 00                	push   $0x0
+  801ebe:	e8 99 18 00 00       	call   80375c <ipc_recv>
+  801ec3:	89 c1                	mov    %eax,%ecx
+  801ec5:	83 c4 10             	add    $0x10,%esp
+  801ec8:	85 c0                	test   %eax,%eax
+  801eca:	78 4f                	js     801f1b <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801ecc:	a1 00 74 80 00       	mov    0x807400,%eax
+  801ed1:	8b 40 48             	mov    0x48(%eax),%eax
+  801ed4:	a3 c4 90 80 00       	mov    %eax,0x8090c4
+	fsring_busy = 0;
+  801ed9:	c7 05 c0 90 80 00 00 	movl   $0x0,0x8090c0
+  801ee0:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801ee3:	83 ec 0c             	sub    $0xc,%esp
+  801ee6:	ff 37                	push   (%edi)
+  801ee8:	e8 e4 fc ff ff       	call   801bd1 <devfile_sync>
+  801eed:	89 c1                	mov    %eax,%ecx
+  801eef:	83 c4 10             	add    $0x10,%esp
+  801ef2:	85 c0                	test   %eax,%eax
+  801ef4:	78 25                	js     801f1b <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801ef6:	8b 1d c0 90 80 00    	mov    0x8090c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801efc:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801f01:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f06:	89 d0                	mov    %edx,%eax
+  801f08:	d3 e0                	shl    %cl,%eax
+  801f0a:	85 d8                	test   %ebx,%eax
+  801f0c:	74 0d                	je     801f1b <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801f0e:	83 c1 01             	add    $0x1,%ecx
+  801f11:	83 f9 10             	cmp    $0x10,%ecx
+  801f14:	75 f0                	jne    801f06 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801f16:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801f1b:	89 c8                	mov    %ecx,%eax
+  801f1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f20:	5b                   	pop    %ebx
+  801f21:	5e                   	pop    %esi
+  801f22:	5f                   	pop    %edi
+  801f23:	5d                   	pop    %ebp
+  801f24:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f25:	83 ec 0c             	sub    $0xc,%esp
+  801f28:	6a 01                	push   $0x1
+  801f2a:	e8 d1 19 00 00       	call   803900 <ipc_find_env>
+  801f2f:	a3 c8 90 80 00       	mov    %eax,0x8090c8
+  801f34:	83 c4 10             	add    $0x10,%esp
+  801f37:	e9 1e ff ff ff       	jmp    801e5a <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801f3c:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801f41:	eb d8                	jmp    801f1b <fsring_slot+0x111>
+
+00801f43 <file_read_direct>:
+{
+  801f43:	55                   	push   %ebp
+  801f44:	89 e5                	mov    %esp,%ebp
+  801f46:	57                   	push   %edi
+  801f47:	56                   	push   %esi
+  801f48:	53                   	push   %ebx
+  801f49:	83 ec 1c             	sub    $0x1c,%esp
+  801f4c:	89 c7                	mov    %eax,%edi
+  801f4e:	89 d6                	mov    %edx,%esi
+  801f50:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801f52:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801f58:	77 52                	ja     801fac <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f5a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f5d:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801f62:	89 0d 04 80 80 00    	mov    %ecx,0x808004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f6d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f72:	e8 b6 fb ff ff       	call   801b2d <fsipc>
+  801f77:	89 c7                	mov    %eax,%edi
+  801f79:	85 c0                	test   %eax,%eax
+  801f7b:	78 25                	js     801fa2 <file_read_direct+0x5f>
+	assert(r <= n);
+  801f7d:	39 c3                	cmp    %eax,%ebx
+  801f7f:	0f 82 87 00 00 00    	jb     80200c <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801f85:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f8a:	0f 8f 95 00 00 00    	jg     802025 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f90:	83 ec 04             	sub    $0x4,%esp
+  801f93:	50                   	push   %eax
+  801f94:	68 00 80 80 00       	push   $0x808000
+  801f99:	56                   	push   %esi
+  801f9a:	e8 03 ec ff ff       	call   800ba2 <memmove>
+	return r;
+  801f9f:	83 c4 10             	add    $0x10,%esp
+}
+  801fa2:	89 f8                	mov    %edi,%eax
+  801fa4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fa7:	5b                   	pop    %ebx
+  801fa8:	5e                   	pop    %esi
+  801fa9:	5f                   	pop    %edi
+  801faa:	5d                   	pop    %ebp
+  801fab:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801fac:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801fb2:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801fb7:	29 d1                	sub    %edx,%ecx
+  801fb9:	39 d9                	cmp    %ebx,%ecx
+  801fbb:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801fbe:	89 f0                	mov    %esi,%eax
+  801fc0:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801fc3:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801fc6:	eb 0f                	jmp    801fd7 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801fc8:	0f b6 10             	movzbl (%eax),%edx
+  801fcb:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801fcd:	05 00 10 00 00       	add    $0x1000,%eax
+  801fd2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801fd7:	39 c8                	cmp    %ecx,%eax
+  801fd9:	72 ed                	jb     801fc8 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801fdb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fde:	8b 47 0c             	mov    0xc(%edi),%eax
+  801fe1:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.bulk.req_n = n;
+  801fe6:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801fec:	89 15 08 80 80 00    	mov    %edx,0x808008
+	return fsipc_pages(type, buf, n, perm);
+  801ff2:	83 ec 0c             	sub    $0xc,%esp
+  801ff5:	6a 07                	push   $0x7
+  801ff7:	89 d9                	mov    %ebx,%ecx
+  801ff9:	89 f2                	mov    %esi,%edx
+  801ffb:	b8 09 00 00 00       	mov    $0x9,%eax
+  802000:	e8 86 f9 ff ff       	call   80198b <fsipc_pages>
+  802005:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  802007:	83 c4 10             	add    $0x10,%esp
+  80200a:	eb 96                	jmp    801fa2 <file_read_direct+0x5f>
+	assert(r <= n);
+  80200c:	68 20 41 80 00       	push   $0x804120
+  802011:	68 00 41 80 00       	push   $0x804100
+  802016:	68 dc 00 00 00       	push   $0xdc
+  80201b:	68 15 41 80 00       	push   $0x804115
+  802020:	e8 2e e3 ff ff       	call   800353 <_panic>
+	assert(r <= PGSIZE);
+  802025:	68 31 41 80 00       	push   $0x804131
+  80202a:	68 00 41 80 00       	push   $0x804100
+  80202f:	68 dd 00 00 00       	push   $0xdd
+  802034:	68 15 41 80 00       	push   $0x804115
+  802039:	e8 15 e3 ff ff       	call   800353 <_panic>
+
+0080203e <devfile_read>:
+{
+  80203e:	55                   	push   %ebp
+  80203f:	89 e5                	mov    %esp,%ebp
+  802041:	57                   	push   %edi
+  802042:	56                   	push   %esi
+  802043:	53                   	push   %ebx
+  802044:	83 ec 28             	sub    $0x28,%esp
+  802047:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80204a:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80204d:	53                   	push   %ebx
+  80204e:	e8 35 f3 ff ff       	call   801388 <fd2data>
+  802053:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  802056:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  802059:	83 c4 10             	add    $0x10,%esp
+  80205c:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  802060:	74 7d                	je     8020df <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802062:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802066:	0f 85 81 00 00 00    	jne    8020ed <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  80206c:	8b 43 18             	mov    0x18(%ebx),%eax
+  80206f:	85 c0                	test   %eax,%eax
+  802071:	74 0d                	je     802080 <devfile_read+0x42>
+  802073:	8b 53 14             	mov    0x14(%ebx),%edx
+  802076:	39 fa                	cmp    %edi,%edx
+  802078:	7f 06                	jg     802080 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  80207a:	01 c2                	add    %eax,%edx
+  80207c:	39 d7                	cmp    %edx,%edi
+  80207e:	72 28                	jb     8020a8 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  802080:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  802087:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80208d:	77 74                	ja     802103 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  80208f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802094:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802097:	89 d8                	mov    %ebx,%eax
+  802099:	e8 a5 fe ff ff       	call   801f43 <file_read_direct>
+  80209e:	85 c0                	test   %eax,%eax
+  8020a0:	7e 35                	jle    8020d7 <devfile_read+0x99>
+		ff->buf_base = pos;
+  8020a2:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8020a5:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8020a8:	8b 53 14             	mov    0x14(%ebx),%edx
+  8020ab:	89 d0                	mov    %edx,%eax
+  8020ad:	03 43 18             	add    0x18(%ebx),%eax
+  8020b0:	29 f8                	sub    %edi,%eax
+  8020b2:	39 f0                	cmp    %esi,%eax
+  8020b4:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8020b7:	83 ec 04             	sub    $0x4,%esp
+  8020ba:	56                   	push   %esi
+  8020bb:	89 f8                	mov    %edi,%eax
+  8020bd:	29 d0                	sub    %edx,%eax
+  8020bf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8020c2:	01 c1                	add    %eax,%ecx
+  8020c4:	51                   	push   %ecx
+  8020c5:	ff 75 0c             	push   0xc(%ebp)
+  8020c8:	e8 d5 ea ff ff       	call   800ba2 <memmove>
+	fd->fd_offset = pos + n;
+  8020cd:	01 f7                	add    %esi,%edi
+  8020cf:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8020d2:	89 f0                	mov    %esi,%eax
+  8020d4:	83 c4 10             	add    $0x10,%esp
+}
+  8020d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020da:	5b                   	pop    %ebx
+  8020db:	5e                   	pop    %esi
+  8020dc:	5f                   	pop    %edi
+  8020dd:	5d                   	pop    %ebp
+  8020de:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  8020df:	89 f1                	mov    %esi,%ecx
+  8020e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020e4:	89 d8                	mov    %ebx,%eax
+  8020e6:	e8 58 fe ff ff       	call   801f43 <file_read_direct>
+  8020eb:	eb ea                	jmp    8020d7 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8020ed:	83 ec 0c             	sub    $0xc,%esp
+  8020f0:	53                   	push   %ebx
+  8020f1:	e8 db fa ff ff       	call   801bd1 <devfile_sync>
+  8020f6:	83 c4 10             	add    $0x10,%esp
+  8020f9:	85 c0                	test   %eax,%eax
+  8020fb:	0f 89 6b ff ff ff    	jns    80206c <devfile_read+0x2e>
+  802101:	eb d4                	jmp    8020d7 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  802103:	89 f1                	mov    %esi,%ecx
+  802105:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802108:	89 d8                	mov    %ebx,%eax
+  80210a:	e8 34 fe ff ff       	call   801f43 <file_read_direct>
+  80210f:	eb c6                	jmp    8020d7 <devfile_read+0x99>
+
+00802111 <open>:
+{
+  802111:	55                   	push   %ebp
+  802112:	89 e5                	mov    %esp,%ebp
+  802114:	56                   	push   %esi
+  802115:	53                   	push   %ebx
+  802116:	83 ec 1c             	sub    $0x1c,%esp
+  802119:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80211c:	56                   	push   %esi
+  80211d:	e8 bf e8 ff ff       	call   8009e1 <strlen>
+  802122:	83 c4 10             	add    $0x10,%esp
+  802125:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80212a:	0f 8f a0 00 00 00    	jg     8021d0 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  802130:	83 ec 0c             	sub    $0xc,%esp
+  802133:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802136:	50                   	push   %eax
+  802137:	e8 63 f2 ff ff       	call   80139f <fd_alloc>
+  80213c:	89 c3                	mov    %eax,%ebx
+  80213e:	83 c4 10             	add    $0x10,%esp
+  802141:	85 c0                	test   %eax,%eax
+  802143:	78 45                	js     80218a <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  802145:	83 ec 08             	sub    $0x8,%esp
+  802148:	56                   	push   %esi
+  802149:	68 00 80 80 00       	push   $0x808000
+  80214e:	e8 c9 e8 ff ff       	call   800a1c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802153:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802156:	a3 00 84 80 00       	mov    %eax,0x808400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80215b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80215e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802163:	e8 c5 f9 ff ff       	call   801b2d <fsipc>
+  802168:	89 c3                	mov    %eax,%ebx
+  80216a:	83 c4 10             	add    $0x10,%esp
+  80216d:	85 c0                	test   %eax,%eax
+  80216f:	78 22                	js     802193 <open+0x82>
+	if (!(mode & O_NOBUF)
+  802171:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  802178:	74 2b                	je     8021a5 <open+0x94>
+	return fd2num(fd);
+  80217a:	83 ec 0c             	sub    $0xc,%esp
+  80217d:	ff 75 f4             	push   -0xc(%ebp)
+  802180:	e8 f3 f1 ff ff       	call   801378 <fd2num>
+  802185:	89 c3                	mov    %eax,%ebx
+  802187:	83 c4 10             	add    $0x10,%esp
+}
+  80218a:	89 d8                	mov    %ebx,%eax
+  80218c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80218f:	5b                   	pop    %ebx
+  802190:	5e                   	pop    %esi
+  802191:	5d                   	pop    %ebp
+  802192:	c3                   	ret
+		fd_close(fd, 0);
+  802193:	83 ec 08             	sub    $0x8,%esp
+  802196:	6a 00                	push   $0x0
+  802198:	ff 75 f4             	push   -0xc(%ebp)
+  80219b:	e8 f8 f2 ff ff       	call   801498 <fd_close>
+		return r;
+  8021a0:	83 c4 10             	add    $0x10,%esp
+  8021a3:	eb e5                	jmp    80218a <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8021a5:	83 ec 0c             	sub    $0xc,%esp
+  8021a8:	ff 75 f4             	push   -0xc(%ebp)
+  8021ab:	e8 d8 f1 ff ff       	call   801388 <fd2data>
+  8021b0:	83 c4 0c             	add    $0xc,%esp
+  8021b3:	68 07 04 00 00       	push   $0x407
+  8021b8:	50                   	push   %eax
+  8021b9:	6a 00                	push   $0x0
+  8021bb:	e8 68 ec ff ff       	call   800e28 <sys_page_alloc>
+  8021c0:	83 c4 10             	add    $0x10,%esp
+  8021c3:	85 c0                	test   %eax,%eax
+  8021c5:	75 b3                	jne    80217a <open+0x69>
+		fd->fd_file.buffered = 1;
+  8021c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021ca:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8021ce:	eb aa                	jmp    80217a <open+0x69>
+		return -E_BAD_PATH;
+  8021d0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021d5:	eb b3                	jmp    80218a <open+0x79>
+
+008021d7 <readdir>:
+{
+  8021d7:	55                   	push   %ebp
+  8021d8:	89 e5                	mov    %esp,%ebp
+  8021da:	53                   	push   %ebx
+  8021db:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021e1:	50                   	push   %eax
+  8021e2:	ff 75 08             	push   0x8(%ebp)
+  8021e5:	e8 0b f2 ff ff       	call   8013f5 <fd_lookup>
+  8021ea:	89 c3                	mov    %eax,%ebx
+  8021ec:	83 c4 10             	add    $0x10,%esp
+  8021ef:	85 c0                	test   %eax,%eax
+  8021f1:	78 73                	js     802266 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8021f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021f6:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  8021fc:	39 08                	cmp    %ecx,(%eax)
+  8021fe:	0f 85 82 00 00 00    	jne    802286 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802204:	83 ec 0c             	sub    $0xc,%esp
+  802207:	50                   	push   %eax
+  802208:	e8 c4 f9 ff ff       	call   801bd1 <devfile_sync>
+  80220d:	89 c3                	mov    %eax,%ebx
+  80220f:	83 c4 10             	add    $0x10,%esp
+  802212:	85 c0                	test   %eax,%eax
+  802214:	78 50                	js     802266 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802216:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802219:	8b 40 0c             	mov    0xc(%eax),%eax
+  80221c:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.readdir.req_n = n;
+  802221:	8b 45 10             	mov    0x10(%ebp),%eax
+  802224:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.readdir.req_flags = flags;
+  802229:	8b 45 14             	mov    0x14(%ebp),%eax
+  80222c:	a3 08 80 80 00       	mov    %eax,0x808008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  802231:	ba 00 00 00 00       	mov    $0x0,%edx
+  802236:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80223b:	e8 ed f8 ff ff       	call   801b2d <fsipc>
+  802240:	89 c3                	mov    %eax,%ebx
+  802242:	85 c0                	test   %eax,%eax
+  802244:	7e 20                	jle    802266 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  802246:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802249:	72 22                	jb     80226d <readdir+0x96>
+  80224b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802250:	7f 1b                	jg     80226d <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802252:	83 ec 04             	sub    $0x4,%esp
+  802255:	50                   	push   %eax
+  802256:	68 00 80 80 00       	push   $0x808000
+  80225b:	ff 75 0c             	push   0xc(%ebp)
+  80225e:	e8 3f e9 ff ff       	call   800ba2 <memmove>
+	return r;
+  802263:	83 c4 10             	add    $0x10,%esp
+}
+  802266:	89 d8                	mov    %ebx,%eax
+  802268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80226b:	c9                   	leave
+  80226c:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  80226d:	68 27 41 80 00       	push   $0x804127
+  802272:	68 00 41 80 00       	push   $0x804100
+  802277:	68 86 01 00 00       	push   $0x186
+  80227c:	68 15 41 80 00       	push   $0x804115
+  802281:	e8 cd e0 ff ff       	call   800353 <_panic>
+		return -E_NOT_SUPP;
+  802286:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80228b:	eb d9                	jmp    802266 <readdir+0x8f>
+
+0080228d <munmap>:
+{
+  80228d:	55                   	push   %ebp
+  80228e:	89 e5                	mov    %esp,%ebp
+  802290:	56                   	push   %esi
+  802291:	53                   	push   %ebx
+  802292:	8b 75 08             	mov    0x8(%ebp),%esi
+  802295:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802298:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  80229e:	75 41                	jne    8022e1 <munmap+0x54>
+  8022a0:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8022a6:	77 39                	ja     8022e1 <munmap+0x54>
+  8022a8:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8022ad:	29 f0                	sub    %esi,%eax
+  8022af:	39 d0                	cmp    %edx,%eax
+  8022b1:	72 35                	jb     8022e8 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8022b3:	89 f3                	mov    %esi,%ebx
+  8022b5:	01 d6                	add    %edx,%esi
+  8022b7:	39 f3                	cmp    %esi,%ebx
+  8022b9:	73 1a                	jae    8022d5 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8022bb:	83 ec 08             	sub    $0x8,%esp
+  8022be:	53                   	push   %ebx
+  8022bf:	6a 00                	push   $0x0
+  8022c1:	e8 ef eb ff ff       	call   800eb5 <sys_page_unmap>
+  8022c6:	83 c4 10             	add    $0x10,%esp
+  8022c9:	85 c0                	test   %eax,%eax
+  8022cb:	78 0d                	js     8022da <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8022cd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022d3:	eb e2                	jmp    8022b7 <munmap+0x2a>
+	return 0;
+  8022d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022dd:	5b                   	pop    %ebx
+  8022de:	5e                   	pop    %esi
+  8022df:	5d                   	pop    %ebp
+  8022e0:	c3                   	ret
+		return -E_INVAL;
+  8022e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022e6:	eb f2                	jmp    8022da <munmap+0x4d>
+  8022e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022ed:	eb eb                	jmp    8022da <munmap+0x4d>
+
+008022ef <mmap>:
+{
+  8022ef:	55                   	push   %ebp
+  8022f0:	89 e5                	mov    %esp,%ebp
+  8022f2:	57                   	push   %edi
+  8022f3:	56                   	push   %esi
+  8022f4:	53                   	push   %ebx
+  8022f5:	83 ec 34             	sub    $0x34,%esp
+  8022f8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022fb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022fe:	50                   	push   %eax
+  8022ff:	ff 75 18             	push   0x18(%ebp)
+  802302:	e8 ee f0 ff ff       	call   8013f5 <fd_lookup>
+  802307:	89 c3                	mov    %eax,%ebx
+  802309:	83 c4 10             	add    $0x10,%esp
+  80230c:	85 c0                	test   %eax,%eax
+  80230e:	0f 88 0e 01 00 00    	js     802422 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802314:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802317:	a1 20 50 80 00       	mov    0x805020,%eax
+  80231c:	39 02                	cmp    %eax,(%edx)
+  80231e:	0f 85 50 01 00 00    	jne    802474 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802324:	8b 45 10             	mov    0x10(%ebp),%eax
+  802327:	83 e0 02             	and    $0x2,%eax
+  80232a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80232d:	74 0a                	je     802339 <mmap+0x4a>
+  80232f:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802333:	0f 84 42 01 00 00    	je     80247b <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802339:	8b 42 08             	mov    0x8(%edx),%eax
+  80233c:	83 e0 03             	and    $0x3,%eax
+  80233f:	83 f8 01             	cmp    $0x1,%eax
+  802342:	0f 84 3a 01 00 00    	je     802482 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802348:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234b:	0b 45 1c             	or     0x1c(%ebp),%eax
+  80234e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802353:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802356:	0f 85 2d 01 00 00    	jne    802489 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80235c:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802360:	0f 88 2a 01 00 00    	js     802490 <mmap+0x1a1>
+  802366:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80236d:	0f 87 1d 01 00 00    	ja     802490 <mmap+0x1a1>
+  802373:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802378:	2b 45 08             	sub    0x8(%ebp),%eax
+  80237b:	39 f8                	cmp    %edi,%eax
+  80237d:	0f 82 14 01 00 00    	jb     802497 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802383:	83 ec 0c             	sub    $0xc,%esp
+  802386:	52                   	push   %edx
+  802387:	e8 45 f8 ff ff       	call   801bd1 <devfile_sync>
+  80238c:	89 c3                	mov    %eax,%ebx
+  80238e:	83 c4 10             	add    $0x10,%esp
+  802391:	85 c0                	test   %eax,%eax
+  802393:	0f 88 89 00 00 00    	js     802422 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802399:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  80239f:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8023a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8023aa:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8023ad:	39 fe                	cmp    %edi,%esi
+  8023af:	73 7b                	jae    80242c <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8023b1:	89 f8                	mov    %edi,%eax
+  8023b3:	29 f0                	sub    %esi,%eax
+  8023b5:	c1 e8 0c             	shr    $0xc,%eax
+  8023b8:	ba 40 00 00 00       	mov    $0x40,%edx
+  8023bd:	39 d0                	cmp    %edx,%eax
+  8023bf:	0f 47 c2             	cmova  %edx,%eax
+  8023c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8023c5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8023c8:	8b 52 0c             	mov    0xc(%edx),%edx
+  8023cb:	89 15 00 80 80 00    	mov    %edx,0x808000
+		fsipcbuf.map.req_offset = offset + done;
+  8023d1:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8023d4:	89 15 04 80 80 00    	mov    %edx,0x808004
+		fsipcbuf.map.req_npages = n;
+  8023da:	a3 08 80 80 00       	mov    %eax,0x808008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8023df:	89 f2                	mov    %esi,%edx
+  8023e1:	03 55 08             	add    0x8(%ebp),%edx
+  8023e4:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8023e7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8023ec:	e8 ea f6 ff ff       	call   801adb <fsipcv>
+  8023f1:	85 c0                	test   %eax,%eax
+  8023f3:	7e 12                	jle    802407 <mmap+0x118>
+  8023f5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8023f8:	85 c0                	test   %eax,%eax
+  8023fa:	0f 84 9e 00 00 00    	je     80249e <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802400:	c1 e0 0c             	shl    $0xc,%eax
+  802403:	01 c6                	add    %eax,%esi
+  802405:	eb a6                	jmp    8023ad <mmap+0xbe>
+			munmap(addr, done);
+  802407:	89 c3                	mov    %eax,%ebx
+  802409:	83 ec 08             	sub    $0x8,%esp
+  80240c:	56                   	push   %esi
+  80240d:	ff 75 08             	push   0x8(%ebp)
+  802410:	e8 78 fe ff ff       	call   80228d <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802415:	83 c4 10             	add    $0x10,%esp
+  802418:	85 db                	test   %ebx,%ebx
+  80241a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80241f:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802422:	89 d8                	mov    %ebx,%eax
+  802424:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802427:	5b                   	pop    %ebx
+  802428:	5e                   	pop    %esi
+  802429:	5f                   	pop    %edi
+  80242a:	5d                   	pop    %ebp
+  80242b:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80242c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80242f:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802431:	85 c0                	test   %eax,%eax
+  802433:	74 ed                	je     802422 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802435:	be 00 00 00 00       	mov    $0x0,%esi
+  80243a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80243d:	39 fe                	cmp    %edi,%esi
+  80243f:	73 2e                	jae    80246f <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802441:	83 ec 0c             	sub    $0xc,%esp
+  802444:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802447:	50                   	push   %eax
+  802448:	e8 11 11 00 00       	call   80355e <cowpage>
+  80244d:	83 c4 10             	add    $0x10,%esp
+  802450:	85 c0                	test   %eax,%eax
+  802452:	78 08                	js     80245c <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802454:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80245a:	eb e1                	jmp    80243d <mmap+0x14e>
+				munmap(addr, len);
+  80245c:	89 c3                	mov    %eax,%ebx
+  80245e:	83 ec 08             	sub    $0x8,%esp
+  802461:	57                   	push   %edi
+  802462:	ff 75 08             	push   0x8(%ebp)
+  802465:	e8 23 fe ff ff       	call   80228d <munmap>
+				return r;
+  80246a:	83 c4 10             	add    $0x10,%esp
+  80246d:	eb b3                	jmp    802422 <mmap+0x133>
+	return 0;
+  80246f:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802472:	eb ae                	jmp    802422 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802474:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802479:	eb a7                	jmp    802422 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80247b:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802480:	eb a0                	jmp    802422 <mmap+0x133>
+		return -E_INVAL;
+  802482:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802487:	eb 99                	jmp    802422 <mmap+0x133>
+  802489:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80248e:	eb 92                	jmp    802422 <mmap+0x133>
+  802490:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802495:	eb 8b                	jmp    802422 <mmap+0x133>
+  802497:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80249c:	eb 84                	jmp    802422 <mmap+0x133>
+			munmap(addr, done);
+  80249e:	83 ec 08             	sub    $0x8,%esp
+  8024a1:	56                   	push   %esi
+  8024a2:	ff 75 08             	push   0x8(%ebp)
+  8024a5:	e8 e3 fd ff ff       	call   80228d <munmap>
+  8024aa:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8024ad:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024b2:	e9 6b ff ff ff       	jmp    802422 <mmap+0x133>
+
+008024b7 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8024b7:	55                   	push   %ebp
+  8024b8:	89 e5                	mov    %esp,%ebp
+  8024ba:	56                   	push   %esi
+  8024bb:	53                   	push   %ebx
+  8024bc:	83 ec 10             	sub    $0x10,%esp
+  8024bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8024c2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8024c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024c8:	e8 3d f9 ff ff       	call   801e0a <fsring_slot>
+  8024cd:	85 c0                	test   %eax,%eax
+  8024cf:	78 60                	js     802531 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8024d1:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8024d4:	8b 56 08             	mov    0x8(%esi),%edx
+  8024d7:	83 e2 03             	and    $0x3,%edx
+  8024da:	83 fa 01             	cmp    $0x1,%edx
+  8024dd:	74 59                	je     802538 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8024df:	ba 01 00 00 00       	mov    $0x1,%edx
+  8024e4:	89 c1                	mov    %eax,%ecx
+  8024e6:	d3 e2                	shl    %cl,%edx
+  8024e8:	09 15 c0 90 80 00    	or     %edx,0x8090c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8024ee:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8024f1:	c1 e2 02             	shl    $0x2,%edx
+  8024f4:	8d 8a 00 90 80 00    	lea    0x809000(%edx),%ecx
+  8024fa:	c7 82 00 90 80 00 03 	movl   $0x3,0x809000(%edx)
+  802501:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802504:	8b 55 18             	mov    0x18(%ebp),%edx
+  802507:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80250a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80250d:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802510:	83 ec 08             	sub    $0x8,%esp
+  802513:	50                   	push   %eax
+  802514:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802519:	39 c3                	cmp    %eax,%ebx
+  80251b:	0f 47 d8             	cmova  %eax,%ebx
+  80251e:	53                   	push   %ebx
+  80251f:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802522:	89 f2                	mov    %esi,%edx
+  802524:	b8 03 00 00 00       	mov    $0x3,%eax
+  802529:	e8 1e f5 ff ff       	call   801a4c <fsring_post>
+  80252e:	83 c4 10             	add    $0x10,%esp
+}
+  802531:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802534:	5b                   	pop    %ebx
+  802535:	5e                   	pop    %esi
+  802536:	5d                   	pop    %ebp
+  802537:	c3                   	ret
+		return -E_INVAL;
+  802538:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80253d:	eb f2                	jmp    802531 <fsring_read+0x7a>
+
+0080253f <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80253f:	55                   	push   %ebp
+  802540:	89 e5                	mov    %esp,%ebp
+  802542:	56                   	push   %esi
+  802543:	53                   	push   %ebx
+  802544:	83 ec 10             	sub    $0x10,%esp
+  802547:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80254a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80254d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802550:	e8 b5 f8 ff ff       	call   801e0a <fsring_slot>
+  802555:	89 c3                	mov    %eax,%ebx
+  802557:	85 c0                	test   %eax,%eax
+  802559:	78 77                	js     8025d2 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80255b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80255e:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802562:	74 77                	je     8025db <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802564:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802569:	39 c6                	cmp    %eax,%esi
+  80256b:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80256e:	83 ec 04             	sub    $0x4,%esp
+  802571:	56                   	push   %esi
+  802572:	ff 75 0c             	push   0xc(%ebp)
+  802575:	89 d8                	mov    %ebx,%eax
+  802577:	c1 e0 0c             	shl    $0xc,%eax
+  80257a:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802580:	50                   	push   %eax
+  802581:	e8 1c e6 ff ff       	call   800ba2 <memmove>
+	fsring_busy |= 1 << slot;
+  802586:	b8 01 00 00 00       	mov    $0x1,%eax
+  80258b:	89 d9                	mov    %ebx,%ecx
+  80258d:	d3 e0                	shl    %cl,%eax
+  80258f:	09 05 c0 90 80 00    	or     %eax,0x8090c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802595:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802598:	c1 e0 02             	shl    $0x2,%eax
+  80259b:	8d 90 00 90 80 00    	lea    0x809000(%eax),%edx
+  8025a1:	c7 80 00 90 80 00 04 	movl   $0x4,0x809000(%eax)
+  8025a8:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8025ab:	8b 45 18             	mov    0x18(%ebp),%eax
+  8025ae:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8025b1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8025b8:	83 c4 08             	add    $0x8,%esp
+  8025bb:	53                   	push   %ebx
+  8025bc:	56                   	push   %esi
+  8025bd:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8025c0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025c3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8025c8:	e8 7f f4 ff ff       	call   801a4c <fsring_post>
+  8025cd:	89 c3                	mov    %eax,%ebx
+  8025cf:	83 c4 10             	add    $0x10,%esp
+}
+  8025d2:	89 d8                	mov    %ebx,%eax
+  8025d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025d7:	5b                   	pop    %ebx
+  8025d8:	5e                   	pop    %esi
+  8025d9:	5d                   	pop    %ebp
+  8025da:	c3                   	ret
+		return -E_INVAL;
+  8025db:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025e0:	eb f0                	jmp    8025d2 <fsring_write+0x93>
+
+008025e2 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8025e2:	55                   	push   %ebp
+  8025e3:	89 e5                	mov    %esp,%ebp
+  8025e5:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8025e8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ee:	e8 17 f8 ff ff       	call   801e0a <fsring_slot>
+  8025f3:	85 c0                	test   %eax,%eax
+  8025f5:	78 4c                	js     802643 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8025f7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8025fc:	89 c1                	mov    %eax,%ecx
+  8025fe:	d3 e2                	shl    %cl,%edx
+  802600:	09 15 c0 90 80 00    	or     %edx,0x8090c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802606:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802609:	c1 e2 02             	shl    $0x2,%edx
+  80260c:	8d 8a 00 90 80 00    	lea    0x809000(%edx),%ecx
+  802612:	c7 82 00 90 80 00 05 	movl   $0x5,0x809000(%edx)
+  802619:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80261c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80261f:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802622:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802625:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802628:	83 ec 08             	sub    $0x8,%esp
+  80262b:	50                   	push   %eax
+  80262c:	6a 00                	push   $0x0
+  80262e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802633:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802636:	b8 05 00 00 00       	mov    $0x5,%eax
+  80263b:	e8 0c f4 ff ff       	call   801a4c <fsring_post>
+  802640:	83 c4 10             	add    $0x10,%esp
+}
+  802643:	c9                   	leave
+  802644:	c3                   	ret
+
+00802645 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802645:	55                   	push   %ebp
+  802646:	89 e5                	mov    %esp,%ebp
+  802648:	57                   	push   %edi
+  802649:	56                   	push   %esi
+  80264a:	53                   	push   %ebx
+  80264b:	83 ec 1c             	sub    $0x1c,%esp
+  80264e:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802652:	a1 00 74 80 00       	mov    0x807400,%eax
+  802657:	8b 40 48             	mov    0x48(%eax),%eax
+  80265a:	3b 05 c4 90 80 00    	cmp    0x8090c4,%eax
+  802660:	74 12                	je     802674 <fsring_reap+0x2f>
+		return 0;
+  802662:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802667:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80266a:	5b                   	pop    %ebx
+  80266b:	5e                   	pop    %esi
+  80266c:	5f                   	pop    %edi
+  80266d:	5d                   	pop    %ebp
+  80266e:	c3                   	ret
+		sys_yield();
+  80266f:	e8 95 e7 ff ff       	call   800e09 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802674:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  80267a:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80267f:	39 c2                	cmp    %eax,%edx
+  802681:	75 18                	jne    80269b <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802683:	84 db                	test   %bl,%bl
+  802685:	0f 84 21 01 00 00    	je     8027ac <fsring_reap+0x167>
+  80268b:	83 3d c0 90 80 00 00 	cmpl   $0x0,0x8090c0
+  802692:	75 db                	jne    80266f <fsring_reap+0x2a>
+			return 0;
+  802694:	b8 00 00 00 00       	mov    $0x0,%eax
+  802699:	eb cc                	jmp    802667 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  80269b:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8026a0:	83 e0 0f             	and    $0xf,%eax
+  8026a3:	83 c0 2a             	add    $0x2a,%eax
+  8026a6:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8026ad:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8026b4:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8026b9:	83 c0 01             	add    $0x1,%eax
+  8026bc:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8026c1:	83 fb 0f             	cmp    $0xf,%ebx
+  8026c4:	77 5b                	ja     802721 <fsring_reap+0xdc>
+  8026c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8026cb:	89 d9                	mov    %ebx,%ecx
+  8026cd:	d3 e6                	shl    %cl,%esi
+  8026cf:	89 f0                	mov    %esi,%eax
+  8026d1:	23 05 c0 90 80 00    	and    0x8090c0,%eax
+  8026d7:	74 48                	je     802721 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8026d9:	89 d8                	mov    %ebx,%eax
+  8026db:	c1 e0 0c             	shl    $0xc,%eax
+  8026de:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8026e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8026e7:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8026ea:	8b 04 85 00 90 80 00 	mov    0x809000(,%eax,4),%eax
+  8026f1:	83 f8 03             	cmp    $0x3,%eax
+  8026f4:	74 40                	je     802736 <fsring_reap+0xf1>
+  8026f6:	83 f8 05             	cmp    $0x5,%eax
+  8026f9:	74 64                	je     80275f <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8026fb:	f7 d6                	not    %esi
+  8026fd:	21 35 c0 90 80 00    	and    %esi,0x8090c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802703:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802706:	8b 14 85 04 90 80 00 	mov    0x809004(,%eax,4),%edx
+  80270d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802710:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802712:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802715:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802717:	b8 01 00 00 00       	mov    $0x1,%eax
+  80271c:	e9 46 ff ff ff       	jmp    802667 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802721:	53                   	push   %ebx
+  802722:	68 3d 41 80 00       	push   $0x80413d
+  802727:	68 8f 02 00 00       	push   $0x28f
+  80272c:	68 15 41 80 00       	push   $0x804115
+  802731:	e8 1d dc ff ff       	call   800353 <_panic>
+		if (cqe.cqe_result > 0)
+  802736:	85 ff                	test   %edi,%edi
+  802738:	7e c1                	jle    8026fb <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80273a:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80273d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802742:	39 c7                	cmp    %eax,%edi
+  802744:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802747:	50                   	push   %eax
+  802748:	ff 75 e4             	push   -0x1c(%ebp)
+  80274b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80274e:	ff 34 85 08 90 80 00 	push   0x809008(,%eax,4)
+  802755:	e8 48 e4 ff ff       	call   800ba2 <memmove>
+  80275a:	83 c4 10             	add    $0x10,%esp
+  80275d:	eb 9c                	jmp    8026fb <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80275f:	85 ff                	test   %edi,%edi
+  802761:	75 98                	jne    8026fb <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802763:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802766:	8b 0c 85 08 90 80 00 	mov    0x809008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80276d:	83 ec 08             	sub    $0x8,%esp
+  802770:	ff 75 e4             	push   -0x1c(%ebp)
+  802773:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802776:	51                   	push   %ecx
+  802777:	e8 a0 e2 ff ff       	call   800a1c <strcpy>
+			st->st_size = ret->ret_size;
+  80277c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80277f:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802785:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802788:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80278e:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802794:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  80279a:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  8027a1:	50 80 00 
+  8027a4:	83 c4 10             	add    $0x10,%esp
+  8027a7:	e9 4f ff ff ff       	jmp    8026fb <fsring_reap+0xb6>
+			return 0;
+  8027ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b1:	e9 b1 fe ff ff       	jmp    802667 <fsring_reap+0x22>
+
+008027b6 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8027b6:	55                   	push   %ebp
+  8027b7:	89 e5                	mov    %esp,%ebp
+  8027b9:	57                   	push   %edi
+  8027ba:	56                   	push   %esi
+  8027bb:	53                   	push   %ebx
+  8027bc:	83 ec 28             	sub    $0x28,%esp
+  8027bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8027c2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8027c5:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8027c8:	53                   	push   %ebx
+  8027c9:	e8 13 e2 ff ff       	call   8009e1 <strlen>
+  8027ce:	83 c4 10             	add    $0x10,%esp
+  8027d1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8027d6:	0f 8f 02 01 00 00    	jg     8028de <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8027dc:	83 ec 08             	sub    $0x8,%esp
+  8027df:	53                   	push   %ebx
+  8027e0:	68 00 80 80 00       	push   $0x808000
+  8027e5:	e8 32 e2 ff ff       	call   800a1c <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8027ea:	83 c4 10             	add    $0x10,%esp
+  8027ed:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8027f3:	76 69                	jbe    80285e <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8027f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027f8:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8027fe:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802803:	29 d1                	sub    %edx,%ecx
+  802805:	39 f9                	cmp    %edi,%ecx
+  802807:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80280a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80280d:	89 f9                	mov    %edi,%ecx
+  80280f:	01 c1                	add    %eax,%ecx
+  802811:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802814:	eb 0f                	jmp    802825 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802816:	0f b6 10             	movzbl (%eax),%edx
+  802819:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80281b:	05 00 10 00 00       	add    $0x1000,%eax
+  802820:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802825:	39 c8                	cmp    %ecx,%eax
+  802827:	72 ed                	jb     802816 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802829:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80282c:	89 3d 00 84 80 00    	mov    %edi,0x808400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802832:	89 15 04 84 80 00    	mov    %edx,0x808404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802838:	83 ec 0c             	sub    $0xc,%esp
+  80283b:	6a 07                	push   $0x7
+  80283d:	89 f9                	mov    %edi,%ecx
+  80283f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802842:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802847:	e8 3f f1 ff ff       	call   80198b <fsipc_pages>
+  80284c:	89 c7                	mov    %eax,%edi
+  80284e:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802851:	85 f6                	test   %esi,%esi
+  802853:	74 7f                	je     8028d4 <file_slurp+0x11e>
+  802855:	8d 43 01             	lea    0x1(%ebx),%eax
+  802858:	85 ff                	test   %edi,%edi
+  80285a:	79 3c                	jns    802898 <file_slurp+0xe2>
+  80285c:	eb 76                	jmp    8028d4 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  80285e:	89 3d 00 84 80 00    	mov    %edi,0x808400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802864:	ba 00 00 00 00       	mov    $0x0,%edx
+  802869:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80286e:	e8 ba f2 ff ff       	call   801b2d <fsipc>
+  802873:	89 c7                	mov    %eax,%edi
+  802875:	85 c0                	test   %eax,%eax
+  802877:	7e d8                	jle    802851 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802879:	83 ec 04             	sub    $0x4,%esp
+  80287c:	50                   	push   %eax
+  80287d:	68 08 80 80 00       	push   $0x808008
+  802882:	ff 75 0c             	push   0xc(%ebp)
+  802885:	e8 18 e3 ff ff       	call   800ba2 <memmove>
+  80288a:	83 c4 10             	add    $0x10,%esp
+  80288d:	eb c2                	jmp    802851 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  80288f:	80 fa 2f             	cmp    $0x2f,%dl
+  802892:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802895:	83 c0 01             	add    $0x1,%eax
+  802898:	89 c1                	mov    %eax,%ecx
+  80289a:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  80289e:	84 d2                	test   %dl,%dl
+  8028a0:	75 ed                	jne    80288f <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8028a2:	83 ec 04             	sub    $0x4,%esp
+  8028a5:	68 80 00 00 00       	push   $0x80
+  8028aa:	53                   	push   %ebx
+  8028ab:	56                   	push   %esi
+  8028ac:	e8 e1 e1 ff ff       	call   800a92 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8028b1:	a1 00 80 80 00       	mov    0x808000,%eax
+  8028b6:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8028bc:	a1 04 80 80 00       	mov    0x808004,%eax
+  8028c1:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8028c7:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  8028ce:	50 80 00 
+  8028d1:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8028d4:	89 f8                	mov    %edi,%eax
+  8028d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028d9:	5b                   	pop    %ebx
+  8028da:	5e                   	pop    %esi
+  8028db:	5f                   	pop    %edi
+  8028dc:	5d                   	pop    %ebp
+  8028dd:	c3                   	ret
+		return -E_BAD_PATH;
+  8028de:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8028e3:	eb ef                	jmp    8028d4 <file_slurp+0x11e>
+
+008028e5 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8028e5:	55                   	push   %ebp
+  8028e6:	89 e5                	mov    %esp,%ebp
+  8028e8:	53                   	push   %ebx
+  8028e9:	83 ec 10             	sub    $0x10,%esp
+  8028ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8028ef:	53                   	push   %ebx
+  8028f0:	e8 ec e0 ff ff       	call   8009e1 <strlen>
+  8028f5:	83 c4 10             	add    $0x10,%esp
+  8028f8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8028fd:	7f 25                	jg     802924 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8028ff:	83 ec 08             	sub    $0x8,%esp
+  802902:	53                   	push   %ebx
+  802903:	68 00 80 80 00       	push   $0x808000
+  802908:	e8 0f e1 ff ff       	call   800a1c <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80290d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802912:	b8 07 00 00 00       	mov    $0x7,%eax
+  802917:	e8 11 f2 ff ff       	call   801b2d <fsipc>
+  80291c:	83 c4 10             	add    $0x10,%esp
+}
+  80291f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802922:	c9                   	leave
+  802923:	c3                   	ret
+		return -E_BAD_PATH;
+  802924:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802929:	eb f4                	jmp    80291f <remove+0x3a>
+
+0080292b <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80292b:	55                   	push   %ebp
+  80292c:	89 e5                	mov    %esp,%ebp
+  80292e:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802931:	ba 00 00 00 00       	mov    $0x0,%edx
+  802936:	b8 08 00 00 00       	mov    $0x8,%eax
+  80293b:	e8 ed f1 ff ff       	call   801b2d <fsipc>
+}
+  802940:	c9                   	leave
+  802941:	c3                   	ret
+
+00802942 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802942:	55                   	push   %ebp
+  802943:	89 e5                	mov    %esp,%ebp
+  802945:	57                   	push   %edi
+  802946:	56                   	push   %esi
+  802947:	53                   	push   %ebx
+  802948:	83 ec 18             	sub    $0x18,%esp
+  80294b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80294e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802951:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802954:	57                   	push   %edi
+  802955:	e8 87 e0 ff ff       	call   8009e1 <strlen>
+  80295a:	83 c4 10             	add    $0x10,%esp
+  80295d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802962:	7f 4c                	jg     8029b0 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802964:	83 ec 08             	sub    $0x8,%esp
+  802967:	57                   	push   %edi
+  802968:	68 00 80 80 00       	push   $0x808000
+  80296d:	e8 aa e0 ff ff       	call   800a1c <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802972:	ba 00 00 00 00       	mov    $0x0,%edx
+  802977:	b8 10 00 00 00       	mov    $0x10,%eax
+  80297c:	e8 ac f1 ff ff       	call   801b2d <fsipc>
+  802981:	83 c4 10             	add    $0x10,%esp
+  802984:	85 c0                	test   %eax,%eax
+  802986:	78 20                	js     8029a8 <defrag+0x66>
+		return r;
+	if (before)
+  802988:	85 f6                	test   %esi,%esi
+  80298a:	74 07                	je     802993 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  80298c:	a1 00 80 80 00       	mov    0x808000,%eax
+  802991:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802993:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802998:	85 db                	test   %ebx,%ebx
+  80299a:	74 0c                	je     8029a8 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  80299c:	a1 04 80 80 00       	mov    0x808004,%eax
+  8029a1:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8029a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029ab:	5b                   	pop    %ebx
+  8029ac:	5e                   	pop    %esi
+  8029ad:	5f                   	pop    %edi
+  8029ae:	5d                   	pop    %ebp
+  8029af:	c3                   	ret
+		return -E_BAD_PATH;
+  8029b0:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8029b5:	eb f1                	jmp    8029a8 <defrag+0x66>
+
+008029b7 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  8029b7:	55                   	push   %ebp
+  8029b8:	89 e5                	mov    %esp,%ebp
+  8029ba:	53                   	push   %ebx
+  8029bb:	83 ec 04             	sub    $0x4,%esp
+  8029be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  8029c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029c6:	b8 11 00 00 00       	mov    $0x11,%eax
+  8029cb:	e8 5d f1 ff ff       	call   801b2d <fsipc>
+  8029d0:	85 c0                	test   %eax,%eax
+  8029d2:	78 34                	js     802a08 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  8029d4:	a1 00 80 80 00       	mov    0x808000,%eax
+  8029d9:	89 03                	mov    %eax,(%ebx)
+  8029db:	a1 04 80 80 00       	mov    0x808004,%eax
+  8029e0:	89 43 04             	mov    %eax,0x4(%ebx)
+  8029e3:	a1 08 80 80 00       	mov    0x808008,%eax
+  8029e8:	89 43 08             	mov    %eax,0x8(%ebx)
+  8029eb:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  8029f0:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8029f3:	a1 10 80 80 00       	mov    0x808010,%eax
+  8029f8:	89 43 10             	mov    %eax,0x10(%ebx)
+  8029fb:	a1 14 80 80 00       	mov    0x808014,%eax
+  802a00:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802a03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a0b:	c9                   	leave
+  802a0c:	c3                   	ret
+
+00802a0d <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  802a0d:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802a11:	7f 01                	jg     802a14 <writebuf+0x7>
+  802a13:	c3                   	ret
+{
+  802a14:	55                   	push   %ebp
+  802a15:	89 e5                	mov    %esp,%ebp
+  802a17:	53                   	push   %ebx
+  802a18:	83 ec 08             	sub    $0x8,%esp
+  802a1b:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  802a1d:	ff 70 04             	push   0x4(%eax)
+  802a20:	8d 40 10             	lea    0x10(%eax),%eax
+  802a23:	50                   	push   %eax
+  802a24:	ff 33                	push   (%ebx)
+  802a26:	e8 fe ec ff ff       	call   801729 <write>
+		if (result > 0)
+  802a2b:	83 c4 10             	add    $0x10,%esp
+  802a2e:	85 c0                	test   %eax,%eax
+  802a30:	7e 03                	jle    802a35 <writebuf+0x28>
+			b->result += result;
+  802a32:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802a35:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802a38:	74 0d                	je     802a47 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802a3a:	85 c0                	test   %eax,%eax
+  802a3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a41:	0f 4f c2             	cmovg  %edx,%eax
+  802a44:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802a47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a4a:	c9                   	leave
+  802a4b:	c3                   	ret
+
+00802a4c <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802a4c:	55                   	push   %ebp
+  802a4d:	89 e5                	mov    %esp,%ebp
+  802a4f:	53                   	push   %ebx
+  802a50:	83 ec 04             	sub    $0x4,%esp
+  802a53:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802a56:	8b 53 04             	mov    0x4(%ebx),%edx
+  802a59:	8d 42 01             	lea    0x1(%edx),%eax
+  802a5c:	89 43 04             	mov    %eax,0x4(%ebx)
+  802a5f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a62:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802a66:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802a6b:	74 05                	je     802a72 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  802a6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a70:	c9                   	leave
+  802a71:	c3                   	ret
+		writebuf(b);
+  802a72:	89 d8                	mov    %ebx,%eax
+  802a74:	e8 94 ff ff ff       	call   802a0d <writebuf>
+		b->idx = 0;
+  802a79:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  802a80:	eb eb                	jmp    802a6d <putch+0x21>
+
+00802a82 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802a82:	55                   	push   %ebp
+  802a83:	89 e5                	mov    %esp,%ebp
+  802a85:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  802a8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8e:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  802a94:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  802a9b:	00 00 00 
+	b.result = 0;
+  802a9e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802aa5:	00 00 00 
+	b.error = 1;
+  802aa8:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  802aaf:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  802ab2:	ff 75 10             	push   0x10(%ebp)
+  802ab5:	ff 75 0c             	push   0xc(%ebp)
+  802ab8:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802abe:	50                   	push   %eax
+  802abf:	68 4c 2a 80 00       	push   $0x802a4c
+  802ac4:	e8 5c da ff ff       	call   800525 <vprintfmt>
+	if (b.idx > 0)
+  802ac9:	83 c4 10             	add    $0x10,%esp
+  802acc:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802ad3:	7f 12                	jg     802ae7 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  802ad5:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802adb:	85 c0                	test   %eax,%eax
+  802add:	75 06                	jne    802ae5 <vfprintf+0x63>
+  802adf:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  802ae5:	c9                   	leave
+  802ae6:	c3                   	ret
+		writebuf(&b);
+  802ae7:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802aed:	e8 1b ff ff ff       	call   802a0d <writebuf>
+  802af2:	eb e1                	jmp    802ad5 <vfprintf+0x53>
+
+00802af4 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802af4:	55                   	push   %ebp
+  802af5:	89 e5                	mov    %esp,%ebp
+  802af7:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802afa:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  802afd:	50                   	push   %eax
+  802afe:	ff 75 0c             	push   0xc(%ebp)
+  802b01:	ff 75 08             	push   0x8(%ebp)
+  802b04:	e8 79 ff ff ff       	call   802a82 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802b09:	c9                   	leave
+  802b0a:	c3                   	ret
+
+00802b0b <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802b0b:	55                   	push   %ebp
+  802b0c:	89 e5                	mov    %esp,%ebp
+  802b0e:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802b11:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  802b14:	50                   	push   %eax
+  802b15:	ff 75 08             	push   0x8(%ebp)
+  802b18:	6a 01                	push   $0x1
+  802b1a:	e8 63 ff ff ff       	call   802a82 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802b1f:	c9                   	leave
+  802b20:	c3                   	ret
+
+00802b21 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b21:	55                   	push   %ebp
+  802b22:	89 e5                	mov    %esp,%ebp
+  802b24:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802b27:	68 56 41 80 00       	push   $0x804156
+  802b2c:	ff 75 0c             	push   0xc(%ebp)
+  802b2f:	e8 e8 de ff ff       	call   800a1c <strcpy>
+	return 0;
+}
+  802b34:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b39:	c9                   	leave
+  802b3a:	c3                   	ret
+
+00802b3b <devsock_close>:
+{
+  802b3b:	55                   	push   %ebp
+  802b3c:	89 e5                	mov    %esp,%ebp
+  802b3e:	53                   	push   %ebx
+  802b3f:	83 ec 10             	sub    $0x10,%esp
+  802b42:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802b45:	53                   	push   %ebx
+  802b46:	e8 f4 0d 00 00       	call   80393f <pageref>
+  802b4b:	89 c2                	mov    %eax,%edx
+  802b4d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802b50:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802b55:	83 fa 01             	cmp    $0x1,%edx
+  802b58:	74 05                	je     802b5f <devsock_close+0x24>
+}
+  802b5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b5d:	c9                   	leave
+  802b5e:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802b5f:	83 ec 0c             	sub    $0xc,%esp
+  802b62:	ff 73 0c             	push   0xc(%ebx)
+  802b65:	e8 b7 02 00 00       	call   802e21 <nsipc_close>
+  802b6a:	83 c4 10             	add    $0x10,%esp
+  802b6d:	eb eb                	jmp    802b5a <devsock_close+0x1f>
+
+00802b6f <devsock_write>:
+{
+  802b6f:	55                   	push   %ebp
+  802b70:	89 e5                	mov    %esp,%ebp
+  802b72:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802b75:	6a 00                	push   $0x0
+  802b77:	ff 75 10             	push   0x10(%ebp)
+  802b7a:	ff 75 0c             	push   0xc(%ebp)
+  802b7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b80:	ff 70 0c             	push   0xc(%eax)
+  802b83:	e8 79 03 00 00       	call   802f01 <nsipc_send>
+}
+  802b88:	c9                   	leave
+  802b89:	c3                   	ret
+
+00802b8a <devsock_read>:
+{
+  802b8a:	55                   	push   %ebp
+  802b8b:	89 e5                	mov    %esp,%ebp
+  802b8d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802b90:	6a 00                	push   $0x0
+  802b92:	ff 75 10             	push   0x10(%ebp)
+  802b95:	ff 75 0c             	push   0xc(%ebp)
+  802b98:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b9b:	ff 70 0c             	push   0xc(%eax)
+  802b9e:	e8 ef 02 00 00       	call   802e92 <nsipc_recv>
+}
+  802ba3:	c9                   	leave
+  802ba4:	c3                   	ret
+
+00802ba5 <fd2sockid>:
+{
+  802ba5:	55                   	push   %ebp
+  802ba6:	89 e5                	mov    %esp,%ebp
+  802ba8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802bab:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802bae:	52                   	push   %edx
+  802baf:	50                   	push   %eax
+  802bb0:	e8 40 e8 ff ff       	call   8013f5 <fd_lookup>
+  802bb5:	83 c4 10             	add    $0x10,%esp
+  802bb8:	85 c0                	test   %eax,%eax
+  802bba:	78 10                	js     802bcc <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802bbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bbf:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802bc5:	39 08                	cmp    %ecx,(%eax)
+  802bc7:	75 05                	jne    802bce <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802bc9:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802bcc:	c9                   	leave
+  802bcd:	c3                   	ret
+		return -E_NOT_SUPP;
+  802bce:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802bd3:	eb f7                	jmp    802bcc <fd2sockid+0x27>
+
+00802bd5 <alloc_sockfd>:
+{
+  802bd5:	55                   	push   %ebp
+  802bd6:	89 e5                	mov    %esp,%ebp
+  802bd8:	56                   	push   %esi
+  802bd9:	53                   	push   %ebx
+  802bda:	83 ec 1c             	sub    $0x1c,%esp
+  802bdd:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802bdf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802be2:	50                   	push   %eax
+  802be3:	e8 b7 e7 ff ff       	call   80139f <fd_alloc>
+  802be8:	89 c3                	mov    %eax,%ebx
+  802bea:	83 c4 10             	add    $0x10,%esp
+  802bed:	85 c0                	test   %eax,%eax
+  802bef:	78 43                	js     802c34 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802bf1:	83 ec 04             	sub    $0x4,%esp
+  802bf4:	68 07 04 00 00       	push   $0x407
+  802bf9:	ff 75 f4             	push   -0xc(%ebp)
+  802bfc:	6a 00                	push   $0x0
+  802bfe:	e8 25 e2 ff ff       	call   800e28 <sys_page_alloc>
+  802c03:	89 c3                	mov    %eax,%ebx
+  802c05:	83 c4 10             	add    $0x10,%esp
+  802c08:	85 c0                	test   %eax,%eax
+  802c0a:	78 28                	js     802c34 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802c0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c0f:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802c15:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802c17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c1a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802c21:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802c24:	83 ec 0c             	sub    $0xc,%esp
+  802c27:	50                   	push   %eax
+  802c28:	e8 4b e7 ff ff       	call   801378 <fd2num>
+  802c2d:	89 c3                	mov    %eax,%ebx
+  802c2f:	83 c4 10             	add    $0x10,%esp
+  802c32:	eb 0c                	jmp    802c40 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802c34:	83 ec 0c             	sub    $0xc,%esp
+  802c37:	56                   	push   %esi
+  802c38:	e8 e4 01 00 00       	call   802e21 <nsipc_close>
+		return r;
+  802c3d:	83 c4 10             	add    $0x10,%esp
+}
+  802c40:	89 d8                	mov    %ebx,%eax
+  802c42:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c45:	5b                   	pop    %ebx
+  802c46:	5e                   	pop    %esi
+  802c47:	5d                   	pop    %ebp
+  802c48:	c3                   	ret
+
+00802c49 <accept>:
+{
+  802c49:	55                   	push   %ebp
+  802c4a:	89 e5                	mov    %esp,%ebp
+  802c4c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c52:	e8 4e ff ff ff       	call   802ba5 <fd2sockid>
+  802c57:	85 c0                	test   %eax,%eax
+  802c59:	78 1b                	js     802c76 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802c5b:	83 ec 04             	sub    $0x4,%esp
+  802c5e:	ff 75 10             	push   0x10(%ebp)
+  802c61:	ff 75 0c             	push   0xc(%ebp)
+  802c64:	50                   	push   %eax
+  802c65:	e8 0e 01 00 00       	call   802d78 <nsipc_accept>
+  802c6a:	83 c4 10             	add    $0x10,%esp
+  802c6d:	85 c0                	test   %eax,%eax
+  802c6f:	78 05                	js     802c76 <accept+0x2d>
+	return alloc_sockfd(r);
+  802c71:	e8 5f ff ff ff       	call   802bd5 <alloc_sockfd>
+}
+  802c76:	c9                   	leave
+  802c77:	c3                   	ret
+
+00802c78 <bind>:
+{
+  802c78:	55                   	push   %ebp
+  802c79:	89 e5                	mov    %esp,%ebp
+  802c7b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c81:	e8 1f ff ff ff       	call   802ba5 <fd2sockid>
+  802c86:	85 c0                	test   %eax,%eax
+  802c88:	78 12                	js     802c9c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802c8a:	83 ec 04             	sub    $0x4,%esp
+  802c8d:	ff 75 10             	push   0x10(%ebp)
+  802c90:	ff 75 0c             	push   0xc(%ebp)
+  802c93:	50                   	push   %eax
+  802c94:	e8 31 01 00 00       	call   802dca <nsipc_bind>
+  802c99:	83 c4 10             	add    $0x10,%esp
+}
+  802c9c:	c9                   	leave
+  802c9d:	c3                   	ret
+
+00802c9e <shutdown>:
+{
+  802c9e:	55                   	push   %ebp
+  802c9f:	89 e5                	mov    %esp,%ebp
+  802ca1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ca4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca7:	e8 f9 fe ff ff       	call   802ba5 <fd2sockid>
+  802cac:	85 c0                	test   %eax,%eax
+  802cae:	78 0f                	js     802cbf <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802cb0:	83 ec 08             	sub    $0x8,%esp
+  802cb3:	ff 75 0c             	push   0xc(%ebp)
+  802cb6:	50                   	push   %eax
+  802cb7:	e8 43 01 00 00       	call   802dff <nsipc_shutdown>
+  802cbc:	83 c4 10             	add    $0x10,%esp
+}
+  802cbf:	c9                   	leave
+  802cc0:	c3                   	ret
+
+00802cc1 <connect>:
+{
+  802cc1:	55                   	push   %ebp
+  802cc2:	89 e5                	mov    %esp,%ebp
+  802cc4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802cc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cca:	e8 d6 fe ff ff       	call   802ba5 <fd2sockid>
+  802ccf:	85 c0                	test   %eax,%eax
+  802cd1:	78 12                	js     802ce5 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802cd3:	83 ec 04             	sub    $0x4,%esp
+  802cd6:	ff 75 10             	push   0x10(%ebp)
+  802cd9:	ff 75 0c             	push   0xc(%ebp)
+  802cdc:	50                   	push   %eax
+  802cdd:	e8 59 01 00 00       	call   802e3b <nsipc_connect>
+  802ce2:	83 c4 10             	add    $0x10,%esp
+}
+  802ce5:	c9                   	leave
+  802ce6:	c3                   	ret
+
+00802ce7 <listen>:
+{
+  802ce7:	55                   	push   %ebp
+  802ce8:	89 e5                	mov    %esp,%ebp
+  802cea:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ced:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf0:	e8 b0 fe ff ff       	call   802ba5 <fd2sockid>
+  802cf5:	85 c0                	test   %eax,%eax
+  802cf7:	78 0f                	js     802d08 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802cf9:	83 ec 08             	sub    $0x8,%esp
+  802cfc:	ff 75 0c             	push   0xc(%ebp)
+  802cff:	50                   	push   %eax
+  802d00:	e8 6b 01 00 00       	call   802e70 <nsipc_listen>
+  802d05:	83 c4 10             	add    $0x10,%esp
+}
+  802d08:	c9                   	leave
+  802d09:	c3                   	ret
+
+00802d0a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802d0a:	55                   	push   %ebp
+  802d0b:	89 e5                	mov    %esp,%ebp
+  802d0d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802d10:	ff 75 10             	push   0x10(%ebp)
+  802d13:	ff 75 0c             	push   0xc(%ebp)
+  802d16:	ff 75 08             	push   0x8(%ebp)
+  802d19:	e8 41 02 00 00       	call   802f5f <nsipc_socket>
+  802d1e:	83 c4 10             	add    $0x10,%esp
+  802d21:	85 c0                	test   %eax,%eax
+  802d23:	78 05                	js     802d2a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802d25:	e8 ab fe ff ff       	call   802bd5 <alloc_sockfd>
+}
+  802d2a:	c9                   	leave
+  802d2b:	c3                   	ret
+
+00802d2c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802d2c:	55                   	push   %ebp
+  802d2d:	89 e5                	mov    %esp,%ebp
+  802d2f:	53                   	push   %ebx
+  802d30:	83 ec 04             	sub    $0x4,%esp
+  802d33:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802d35:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  802d3c:	74 26                	je     802d64 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802d3e:	6a 07                	push   $0x7
+  802d40:	68 00 a0 80 00       	push   $0x80a000
+  802d45:	53                   	push   %ebx
+  802d46:	ff 35 00 b0 80 00    	push   0x80b000
+  802d4c:	e8 76 0a 00 00       	call   8037c7 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802d51:	83 c4 0c             	add    $0xc,%esp
+  802d54:	6a 00                	push   $0x0
+  802d56:	6a 00                	push   $0x0
+  802d58:	6a 00                	push   $0x0
+  802d5a:	e8 fd 09 00 00       	call   80375c <ipc_recv>
+}
+  802d5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d62:	c9                   	leave
+  802d63:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d64:	83 ec 0c             	sub    $0xc,%esp
+  802d67:	6a 02                	push   $0x2
+  802d69:	e8 92 0b 00 00       	call   803900 <ipc_find_env>
+  802d6e:	a3 00 b0 80 00       	mov    %eax,0x80b000
+  802d73:	83 c4 10             	add    $0x10,%esp
+  802d76:	eb c6                	jmp    802d3e <nsipc+0x12>
+
+00802d78 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802d78:	55                   	push   %ebp
+  802d79:	89 e5                	mov    %esp,%ebp
+  802d7b:	56                   	push   %esi
+  802d7c:	53                   	push   %ebx
+  802d7d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802d80:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d83:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802d88:	8b 06                	mov    (%esi),%eax
+  802d8a:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802d8f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d94:	e8 93 ff ff ff       	call   802d2c <nsipc>
+  802d99:	89 c3                	mov    %eax,%ebx
+  802d9b:	85 c0                	test   %eax,%eax
+  802d9d:	79 09                	jns    802da8 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802d9f:	89 d8                	mov    %ebx,%eax
+  802da1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802da4:	5b                   	pop    %ebx
+  802da5:	5e                   	pop    %esi
+  802da6:	5d                   	pop    %ebp
+  802da7:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802da8:	83 ec 04             	sub    $0x4,%esp
+  802dab:	ff 35 10 a0 80 00    	push   0x80a010
+  802db1:	68 00 a0 80 00       	push   $0x80a000
+  802db6:	ff 75 0c             	push   0xc(%ebp)
+  802db9:	e8 e4 dd ff ff       	call   800ba2 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802dbe:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  802dc3:	89 06                	mov    %eax,(%esi)
+  802dc5:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802dc8:	eb d5                	jmp    802d9f <nsipc_accept+0x27>
+
+00802dca <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802dca:	55                   	push   %ebp
+  802dcb:	89 e5                	mov    %esp,%ebp
+  802dcd:	53                   	push   %ebx
+  802dce:	83 ec 08             	sub    $0x8,%esp
+  802dd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802dd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dd7:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802ddc:	53                   	push   %ebx
+  802ddd:	ff 75 0c             	push   0xc(%ebp)
+  802de0:	68 04 a0 80 00       	push   $0x80a004
+  802de5:	e8 b8 dd ff ff       	call   800ba2 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802dea:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_BIND);
+  802df0:	b8 02 00 00 00       	mov    $0x2,%eax
+  802df5:	e8 32 ff ff ff       	call   802d2c <nsipc>
+}
+  802dfa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dfd:	c9                   	leave
+  802dfe:	c3                   	ret
+
+00802dff <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802dff:	55                   	push   %ebp
+  802e00:	89 e5                	mov    %esp,%ebp
+  802e02:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802e05:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e08:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.shutdown.req_how = how;
+  802e0d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e10:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_SHUTDOWN);
+  802e15:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e1a:	e8 0d ff ff ff       	call   802d2c <nsipc>
+}
+  802e1f:	c9                   	leave
+  802e20:	c3                   	ret
+
+00802e21 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802e21:	55                   	push   %ebp
+  802e22:	89 e5                	mov    %esp,%ebp
+  802e24:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802e27:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e2a:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_CLOSE);
+  802e2f:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e34:	e8 f3 fe ff ff       	call   802d2c <nsipc>
+}
+  802e39:	c9                   	leave
+  802e3a:	c3                   	ret
+
+00802e3b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802e3b:	55                   	push   %ebp
+  802e3c:	89 e5                	mov    %esp,%ebp
+  802e3e:	53                   	push   %ebx
+  802e3f:	83 ec 08             	sub    $0x8,%esp
+  802e42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802e45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e48:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802e4d:	53                   	push   %ebx
+  802e4e:	ff 75 0c             	push   0xc(%ebp)
+  802e51:	68 04 a0 80 00       	push   $0x80a004
+  802e56:	e8 47 dd ff ff       	call   800ba2 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802e5b:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_CONNECT);
+  802e61:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e66:	e8 c1 fe ff ff       	call   802d2c <nsipc>
+}
+  802e6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e6e:	c9                   	leave
+  802e6f:	c3                   	ret
+
+00802e70 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802e70:	55                   	push   %ebp
+  802e71:	89 e5                	mov    %esp,%ebp
+  802e73:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802e76:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e79:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.listen.req_backlog = backlog;
+  802e7e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e81:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_LISTEN);
+  802e86:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e8b:	e8 9c fe ff ff       	call   802d2c <nsipc>
+}
+  802e90:	c9                   	leave
+  802e91:	c3                   	ret
+
+00802e92 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802e92:	55                   	push   %ebp
+  802e93:	89 e5                	mov    %esp,%ebp
+  802e95:	56                   	push   %esi
+  802e96:	53                   	push   %ebx
+  802e97:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802e9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e9d:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.recv.req_len = len;
+  802ea2:	89 35 04 a0 80 00    	mov    %esi,0x80a004
+	nsipcbuf.recv.req_flags = flags;
+  802ea8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eab:	a3 08 a0 80 00       	mov    %eax,0x80a008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802eb0:	b8 07 00 00 00       	mov    $0x7,%eax
+  802eb5:	e8 72 fe ff ff       	call   802d2c <nsipc>
+  802eba:	89 c3                	mov    %eax,%ebx
+  802ebc:	85 c0                	test   %eax,%eax
+  802ebe:	78 22                	js     802ee2 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802ec0:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ec5:	39 c6                	cmp    %eax,%esi
+  802ec7:	0f 4e c6             	cmovle %esi,%eax
+  802eca:	39 c3                	cmp    %eax,%ebx
+  802ecc:	7f 1d                	jg     802eeb <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ece:	83 ec 04             	sub    $0x4,%esp
+  802ed1:	53                   	push   %ebx
+  802ed2:	68 00 a0 80 00       	push   $0x80a000
+  802ed7:	ff 75 0c             	push   0xc(%ebp)
+  802eda:	e8 c3 dc ff ff       	call   800ba2 <memmove>
+  802edf:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802ee2:	89 d8                	mov    %ebx,%eax
+  802ee4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ee7:	5b                   	pop    %ebx
+  802ee8:	5e                   	pop    %esi
+  802ee9:	5d                   	pop    %ebp
+  802eea:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802eeb:	68 62 41 80 00       	push   $0x804162
+  802ef0:	68 00 41 80 00       	push   $0x804100
+  802ef5:	6a 62                	push   $0x62
+  802ef7:	68 77 41 80 00       	push   $0x804177
+  802efc:	e8 52 d4 ff ff       	call   800353 <_panic>
+
+00802f01 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802f01:	55                   	push   %ebp
+  802f02:	89 e5                	mov    %esp,%ebp
+  802f04:	53                   	push   %ebx
+  802f05:	83 ec 04             	sub    $0x4,%esp
+  802f08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f0e:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	assert(size < 1600);
+  802f13:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f19:	7f 2e                	jg     802f49 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802f1b:	83 ec 04             	sub    $0x4,%esp
+  802f1e:	53                   	push   %ebx
+  802f1f:	ff 75 0c             	push   0xc(%ebp)
+  802f22:	68 0c a0 80 00       	push   $0x80a00c
+  802f27:	e8 76 dc ff ff       	call   800ba2 <memmove>
+	nsipcbuf.send.req_size = size;
+  802f2c:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	nsipcbuf.send.req_flags = flags;
+  802f32:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f35:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SEND);
+  802f3a:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f3f:	e8 e8 fd ff ff       	call   802d2c <nsipc>
+}
+  802f44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f47:	c9                   	leave
+  802f48:	c3                   	ret
+	assert(size < 1600);
+  802f49:	68 83 41 80 00       	push   $0x804183
+  802f4e:	68 00 41 80 00       	push   $0x804100
+  802f53:	6a 6d                	push   $0x6d
+  802f55:	68 77 41 80 00       	push   $0x804177
+  802f5a:	e8 f4 d3 ff ff       	call   800353 <_panic>
+
+00802f5f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802f5f:	55                   	push   %ebp
+  802f60:	89 e5                	mov    %esp,%ebp
+  802f62:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802f65:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f68:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.socket.req_type = type;
+  802f6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f70:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.socket.req_protocol = protocol;
+  802f75:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f78:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SOCKET);
+  802f7d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f82:	e8 a5 fd ff ff       	call   802d2c <nsipc>
+}
+  802f87:	c9                   	leave
+  802f88:	c3                   	ret
+
+00802f89 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f89:	55                   	push   %ebp
+  802f8a:	89 e5                	mov    %esp,%ebp
+  802f8c:	56                   	push   %esi
+  802f8d:	53                   	push   %ebx
+  802f8e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f91:	83 ec 0c             	sub    $0xc,%esp
+  802f94:	ff 75 08             	push   0x8(%ebp)
+  802f97:	e8 ec e3 ff ff       	call   801388 <fd2data>
+  802f9c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f9e:	83 c4 08             	add    $0x8,%esp
+  802fa1:	68 8f 41 80 00       	push   $0x80418f
+  802fa6:	53                   	push   %ebx
+  802fa7:	e8 70 da ff ff       	call   800a1c <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802fac:	8b 46 04             	mov    0x4(%esi),%eax
+  802faf:	2b 06                	sub    (%esi),%eax
+  802fb1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802fb7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802fbe:	00 00 00 
+	stat->st_dev = &devpipe;
+  802fc1:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  802fc8:	50 80 00 
+	return 0;
+}
+  802fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fd3:	5b                   	pop    %ebx
+  802fd4:	5e                   	pop    %esi
+  802fd5:	5d                   	pop    %ebp
+  802fd6:	c3                   	ret
+
+00802fd7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802fd7:	55                   	push   %ebp
+  802fd8:	89 e5                	mov    %esp,%ebp
+  802fda:	53                   	push   %ebx
+  802fdb:	83 ec 0c             	sub    $0xc,%esp
+  802fde:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802fe1:	53                   	push   %ebx
+  802fe2:	6a 00                	push   $0x0
+  802fe4:	e8 cc de ff ff       	call   800eb5 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802fe9:	89 1c 24             	mov    %ebx,(%esp)
+  802fec:	e8 97 e3 ff ff       	call   801388 <fd2data>
+  802ff1:	83 c4 08             	add    $0x8,%esp
+  802ff4:	50                   	push   %eax
+  802ff5:	6a 00                	push   $0x0
+  802ff7:	e8 b9 de ff ff       	call   800eb5 <sys_page_unmap>
+}
+  802ffc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fff:	c9                   	leave
+  803000:	c3                   	ret
+
+00803001 <_pipeisclosed>:
+{
+  803001:	55                   	push   %ebp
+  803002:	89 e5                	mov    %esp,%ebp
+  803004:	57                   	push   %edi
+  803005:	56                   	push   %esi
+  803006:	53                   	push   %ebx
+  803007:	83 ec 1c             	sub    $0x1c,%esp
+  80300a:	89 c7                	mov    %eax,%edi
+  80300c:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80300e:	a1 00 74 80 00       	mov    0x807400,%eax
+  803013:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803016:	83 ec 0c             	sub    $0xc,%esp
+  803019:	57                   	push   %edi
+  80301a:	e8 20 09 00 00       	call   80393f <pageref>
+  80301f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803022:	89 34 24             	mov    %esi,(%esp)
+  803025:	e8 15 09 00 00       	call   80393f <pageref>
+		nn = thisenv->env_runs;
+  80302a:	8b 15 00 74 80 00    	mov    0x807400,%edx
+  803030:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  803033:	83 c4 10             	add    $0x10,%esp
+  803036:	39 cb                	cmp    %ecx,%ebx
+  803038:	74 1b                	je     803055 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80303a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80303d:	75 cf                	jne    80300e <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80303f:	8b 42 58             	mov    0x58(%edx),%eax
+  803042:	6a 01                	push   $0x1
+  803044:	50                   	push   %eax
+  803045:	53                   	push   %ebx
+  803046:	68 96 41 80 00       	push   $0x804196
+  80304b:	e8 de d3 ff ff       	call   80042e <cprintf>
+  803050:	83 c4 10             	add    $0x10,%esp
+  803053:	eb b9                	jmp    80300e <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  803055:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803058:	0f 94 c0             	sete   %al
+  80305b:	0f b6 c0             	movzbl %al,%eax
+}
+  80305e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803061:	5b                   	pop    %ebx
+  803062:	5e                   	pop    %esi
+  803063:	5f                   	pop    %edi
+  803064:	5d                   	pop    %ebp
+  803065:	c3                   	ret
+
+00803066 <devpipe_write>:
+{
+  803066:	55                   	push   %ebp
+  803067:	89 e5                	mov    %esp,%ebp
+  803069:	57                   	push   %edi
+  80306a:	56                   	push   %esi
+  80306b:	53                   	push   %ebx
+  80306c:	83 ec 28             	sub    $0x28,%esp
+  80306f:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  803072:	56                   	push   %esi
+  803073:	e8 10 e3 ff ff       	call   801388 <fd2data>
+  803078:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80307a:	83 c4 10             	add    $0x10,%esp
+  80307d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803082:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803085:	75 09                	jne    803090 <devpipe_write+0x2a>
+	return i;
+  803087:	89 f8                	mov    %edi,%eax
+  803089:	eb 23                	jmp    8030ae <devpipe_write+0x48>
+			sys_yield();
+  80308b:	e8 79 dd ff ff       	call   800e09 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803090:	8b 43 04             	mov    0x4(%ebx),%eax
+  803093:	8b 0b                	mov    (%ebx),%ecx
+  803095:	8d 51 20             	lea    0x20(%ecx),%edx
+  803098:	39 d0                	cmp    %edx,%eax
+  80309a:	72 1a                	jb     8030b6 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80309c:	89 da                	mov    %ebx,%edx
+  80309e:	89 f0                	mov    %esi,%eax
+  8030a0:	e8 5c ff ff ff       	call   803001 <_pipeisclosed>
+  8030a5:	85 c0                	test   %eax,%eax
+  8030a7:	74 e2                	je     80308b <devpipe_write+0x25>
+				return 0;
+  8030a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030b1:	5b                   	pop    %ebx
+  8030b2:	5e                   	pop    %esi
+  8030b3:	5f                   	pop    %edi
+  8030b4:	5d                   	pop    %ebp
+  8030b5:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8030b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030b9:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8030bd:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8030c0:	89 c2                	mov    %eax,%edx
+  8030c2:	c1 fa 1f             	sar    $0x1f,%edx
+  8030c5:	89 d1                	mov    %edx,%ecx
+  8030c7:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030ca:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8030cd:	83 e2 1f             	and    $0x1f,%edx
+  8030d0:	29 ca                	sub    %ecx,%edx
+  8030d2:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8030d6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8030da:	83 c0 01             	add    $0x1,%eax
+  8030dd:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8030e0:	83 c7 01             	add    $0x1,%edi
+  8030e3:	eb 9d                	jmp    803082 <devpipe_write+0x1c>
+
+008030e5 <devpipe_read>:
+{
+  8030e5:	55                   	push   %ebp
+  8030e6:	89 e5                	mov    %esp,%ebp
+  8030e8:	57                   	push   %edi
+  8030e9:	56                   	push   %esi
+  8030ea:	53                   	push   %ebx
+  8030eb:	83 ec 18             	sub    $0x18,%esp
+  8030ee:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8030f1:	57                   	push   %edi
+  8030f2:	e8 91 e2 ff ff       	call   801388 <fd2data>
+  8030f7:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8030f9:	83 c4 10             	add    $0x10,%esp
+  8030fc:	be 00 00 00 00       	mov    $0x0,%esi
+  803101:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803104:	75 13                	jne    803119 <devpipe_read+0x34>
+	return i;
+  803106:	89 f0                	mov    %esi,%eax
+  803108:	eb 02                	jmp    80310c <devpipe_read+0x27>
+				return i;
+  80310a:	89 f0                	mov    %esi,%eax
+}
+  80310c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80310f:	5b                   	pop    %ebx
+  803110:	5e                   	pop    %esi
+  803111:	5f                   	pop    %edi
+  803112:	5d                   	pop    %ebp
+  803113:	c3                   	ret
+			sys_yield();
+  803114:	e8 f0 dc ff ff       	call   800e09 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803119:	8b 03                	mov    (%ebx),%eax
+  80311b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80311e:	75 18                	jne    803138 <devpipe_read+0x53>
+			if (i > 0)
+  803120:	85 f6                	test   %esi,%esi
+  803122:	75 e6                	jne    80310a <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803124:	89 da                	mov    %ebx,%edx
+  803126:	89 f8                	mov    %edi,%eax
+  803128:	e8 d4 fe ff ff       	call   803001 <_pipeisclosed>
+  80312d:	85 c0                	test   %eax,%eax
+  80312f:	74 e3                	je     803114 <devpipe_read+0x2f>
+				return 0;
+  803131:	b8 00 00 00 00       	mov    $0x0,%eax
+  803136:	eb d4                	jmp    80310c <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803138:	99                   	cltd
+  803139:	c1 ea 1b             	shr    $0x1b,%edx
+  80313c:	01 d0                	add    %edx,%eax
+  80313e:	83 e0 1f             	and    $0x1f,%eax
+  803141:	29 d0                	sub    %edx,%eax
+  803143:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803148:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80314b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80314e:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803151:	83 c6 01             	add    $0x1,%esi
+  803154:	eb ab                	jmp    803101 <devpipe_read+0x1c>
+
+00803156 <pipe>:
+{
+  803156:	55                   	push   %ebp
+  803157:	89 e5                	mov    %esp,%ebp
+  803159:	56                   	push   %esi
+  80315a:	53                   	push   %ebx
+  80315b:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80315e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803161:	50                   	push   %eax
+  803162:	e8 38 e2 ff ff       	call   80139f <fd_alloc>
+  803167:	89 c3                	mov    %eax,%ebx
+  803169:	83 c4 10             	add    $0x10,%esp
+  80316c:	85 c0                	test   %eax,%eax
+  80316e:	0f 88 23 01 00 00    	js     803297 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803174:	83 ec 04             	sub    $0x4,%esp
+  803177:	68 07 04 00 00       	push   $0x407
+  80317c:	ff 75 f4             	push   -0xc(%ebp)
+  80317f:	6a 00                	push   $0x0
+  803181:	e8 a2 dc ff ff       	call   800e28 <sys_page_alloc>
+  803186:	89 c3                	mov    %eax,%ebx
+  803188:	83 c4 10             	add    $0x10,%esp
+  80318b:	85 c0                	test   %eax,%eax
+  80318d:	0f 88 04 01 00 00    	js     803297 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803193:	83 ec 0c             	sub    $0xc,%esp
+  803196:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803199:	50                   	push   %eax
+  80319a:	e8 00 e2 ff ff       	call   80139f <fd_alloc>
+  80319f:	89 c3                	mov    %eax,%ebx
+  8031a1:	83 c4 10             	add    $0x10,%esp
+  8031a4:	85 c0                	test   %eax,%eax
+  8031a6:	0f 88 db 00 00 00    	js     803287 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031ac:	83 ec 04             	sub    $0x4,%esp
+  8031af:	68 07 04 00 00       	push   $0x407
+  8031b4:	ff 75 f0             	push   -0x10(%ebp)
+  8031b7:	6a 00                	push   $0x0
+  8031b9:	e8 6a dc ff ff       	call   800e28 <sys_page_alloc>
+  8031be:	89 c3                	mov    %eax,%ebx
+  8031c0:	83 c4 10             	add    $0x10,%esp
+  8031c3:	85 c0                	test   %eax,%eax
+  8031c5:	0f 88 bc 00 00 00    	js     803287 <pipe+0x131>
+	va = fd2data(fd0);
+  8031cb:	83 ec 0c             	sub    $0xc,%esp
+  8031ce:	ff 75 f4             	push   -0xc(%ebp)
+  8031d1:	e8 b2 e1 ff ff       	call   801388 <fd2data>
+  8031d6:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031d8:	83 c4 0c             	add    $0xc,%esp
+  8031db:	68 07 04 00 00       	push   $0x407
+  8031e0:	50                   	push   %eax
+  8031e1:	6a 00                	push   $0x0
+  8031e3:	e8 40 dc ff ff       	call   800e28 <sys_page_alloc>
+  8031e8:	89 c3                	mov    %eax,%ebx
+  8031ea:	83 c4 10             	add    $0x10,%esp
+  8031ed:	85 c0                	test   %eax,%eax
+  8031ef:	0f 88 82 00 00 00    	js     803277 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031f5:	83 ec 0c             	sub    $0xc,%esp
+  8031f8:	ff 75 f0             	push   -0x10(%ebp)
+  8031fb:	e8 88 e1 ff ff       	call   801388 <fd2data>
+  803200:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803207:	50                   	push   %eax
+  803208:	6a 00                	push   $0x0
+  80320a:	56                   	push   %esi
+  80320b:	6a 00                	push   $0x0
+  80320d:	e8 61 dc ff ff       	call   800e73 <sys_page_map>
+  803212:	89 c3                	mov    %eax,%ebx
+  803214:	83 c4 20             	add    $0x20,%esp
+  803217:	85 c0                	test   %eax,%eax
+  803219:	78 4e                	js     803269 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80321b:	a1 60 50 80 00       	mov    0x805060,%eax
+  803220:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803223:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803225:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803228:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80322f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803232:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803234:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803237:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80323e:	83 ec 0c             	sub    $0xc,%esp
+  803241:	ff 75 f4             	push   -0xc(%ebp)
+  803244:	e8 2f e1 ff ff       	call   801378 <fd2num>
+  803249:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80324c:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80324e:	83 c4 04             	add    $0x4,%esp
+  803251:	ff 75 f0             	push   -0x10(%ebp)
+  803254:	e8 1f e1 ff ff       	call   801378 <fd2num>
+  803259:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80325c:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80325f:	83 c4 10             	add    $0x10,%esp
+  803262:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803267:	eb 2e                	jmp    803297 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803269:	83 ec 08             	sub    $0x8,%esp
+  80326c:	56                   	push   %esi
+  80326d:	6a 00                	push   $0x0
+  80326f:	e8 41 dc ff ff       	call   800eb5 <sys_page_unmap>
+  803274:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803277:	83 ec 08             	sub    $0x8,%esp
+  80327a:	ff 75 f0             	push   -0x10(%ebp)
+  80327d:	6a 00                	push   $0x0
+  80327f:	e8 31 dc ff ff       	call   800eb5 <sys_page_unmap>
+  803284:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803287:	83 ec 08             	sub    $0x8,%esp
+  80328a:	ff 75 f4             	push   -0xc(%ebp)
+  80328d:	6a 00                	push   $0x0
+  80328f:	e8 21 dc ff ff       	call   800eb5 <sys_page_unmap>
+  803294:	83 c4 10             	add    $0x10,%esp
+}
+  803297:	89 d8                	mov    %ebx,%eax
+  803299:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80329c:	5b                   	pop    %ebx
+  80329d:	5e                   	pop    %esi
+  80329e:	5d                   	pop    %ebp
+  80329f:	c3                   	ret
+
+008032a0 <pipeisclosed>:
+{
+  8032a0:	55                   	push   %ebp
+  8032a1:	89 e5                	mov    %esp,%ebp
+  8032a3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032a9:	50                   	push   %eax
+  8032aa:	ff 75 08             	push   0x8(%ebp)
+  8032ad:	e8 43 e1 ff ff       	call   8013f5 <fd_lookup>
+  8032b2:	83 c4 10             	add    $0x10,%esp
+  8032b5:	85 c0                	test   %eax,%eax
+  8032b7:	78 18                	js     8032d1 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8032b9:	83 ec 0c             	sub    $0xc,%esp
+  8032bc:	ff 75 f4             	push   -0xc(%ebp)
+  8032bf:	e8 c4 e0 ff ff       	call   801388 <fd2data>
+  8032c4:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8032c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032c9:	e8 33 fd ff ff       	call   803001 <_pipeisclosed>
+  8032ce:	83 c4 10             	add    $0x10,%esp
+}
+  8032d1:	c9                   	leave
+  8032d2:	c3                   	ret
+
+008032d3 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8032d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d8:	c3                   	ret
+
+008032d9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8032d9:	55                   	push   %ebp
+  8032da:	89 e5                	mov    %esp,%ebp
+  8032dc:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8032df:	68 ae 41 80 00       	push   $0x8041ae
+  8032e4:	ff 75 0c             	push   0xc(%ebp)
+  8032e7:	e8 30 d7 ff ff       	call   800a1c <strcpy>
+	return 0;
+}
+  8032ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f1:	c9                   	leave
+  8032f2:	c3                   	ret
+
+008032f3 <devcons_write>:
+{
+  8032f3:	55                   	push   %ebp
+  8032f4:	89 e5                	mov    %esp,%ebp
+  8032f6:	57                   	push   %edi
+  8032f7:	56                   	push   %esi
+  8032f8:	53                   	push   %ebx
+  8032f9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8032ff:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803304:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80330a:	eb 2e                	jmp    80333a <devcons_write+0x47>
+		m = n - tot;
+  80330c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80330f:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803311:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803316:	39 c3                	cmp    %eax,%ebx
+  803318:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80331b:	83 ec 04             	sub    $0x4,%esp
+  80331e:	53                   	push   %ebx
+  80331f:	89 f0                	mov    %esi,%eax
+  803321:	03 45 0c             	add    0xc(%ebp),%eax
+  803324:	50                   	push   %eax
+  803325:	57                   	push   %edi
+  803326:	e8 77 d8 ff ff       	call   800ba2 <memmove>
+		sys_cputs(buf, m);
+  80332b:	83 c4 08             	add    $0x8,%esp
+  80332e:	53                   	push   %ebx
+  80332f:	57                   	push   %edi
+  803330:	e8 17 da ff ff       	call   800d4c <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803335:	01 de                	add    %ebx,%esi
+  803337:	83 c4 10             	add    $0x10,%esp
+  80333a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80333d:	72 cd                	jb     80330c <devcons_write+0x19>
+}
+  80333f:	89 f0                	mov    %esi,%eax
+  803341:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803344:	5b                   	pop    %ebx
+  803345:	5e                   	pop    %esi
+  803346:	5f                   	pop    %edi
+  803347:	5d                   	pop    %ebp
+  803348:	c3                   	ret
+
+00803349 <devcons_read>:
+{
+  803349:	55                   	push   %ebp
+  80334a:	89 e5                	mov    %esp,%ebp
+  80334c:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80334f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803354:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803358:	75 07                	jne    803361 <devcons_read+0x18>
+  80335a:	eb 1f                	jmp    80337b <devcons_read+0x32>
+		sys_yield();
+  80335c:	e8 a8 da ff ff       	call   800e09 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803361:	e8 0c da ff ff       	call   800d72 <sys_cgetc>
+  803366:	85 c0                	test   %eax,%eax
+  803368:	74 f2                	je     80335c <devcons_read+0x13>
+	if (c < 0)
+  80336a:	78 0f                	js     80337b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80336c:	83 f8 04             	cmp    $0x4,%eax
+  80336f:	74 0c                	je     80337d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803371:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803374:	88 02                	mov    %al,(%edx)
+	return 1;
+  803376:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80337b:	c9                   	leave
+  80337c:	c3                   	ret
+		return 0;
+  80337d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803382:	eb f7                	jmp    80337b <devcons_read+0x32>
+
+00803384 <cputchar>:
+{
+  803384:	55                   	push   %ebp
+  803385:	89 e5                	mov    %esp,%ebp
+  803387:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80338a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80338d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803390:	6a 01                	push   $0x1
+  803392:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803395:	50                   	push   %eax
+  803396:	e8 b1 d9 ff ff       	call   800d4c <sys_cputs>
+}
+  80339b:	83 c4 10             	add    $0x10,%esp
+  80339e:	c9                   	leave
+  80339f:	c3                   	ret
+
+008033a0 <getchar>:
+{
+  8033a0:	55                   	push   %ebp
+  8033a1:	89 e5                	mov    %esp,%ebp
+  8033a3:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8033a6:	6a 01                	push   $0x1
+  8033a8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033ab:	50                   	push   %eax
+  8033ac:	6a 00                	push   $0x0
+  8033ae:	e8 a8 e2 ff ff       	call   80165b <read>
+	if (r < 0)
+  8033b3:	83 c4 10             	add    $0x10,%esp
+  8033b6:	85 c0                	test   %eax,%eax
+  8033b8:	78 06                	js     8033c0 <getchar+0x20>
+	if (r < 1)
+  8033ba:	74 06                	je     8033c2 <getchar+0x22>
+	return c;
+  8033bc:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8033c0:	c9                   	leave
+  8033c1:	c3                   	ret
+		return -E_EOF;
+  8033c2:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8033c7:	eb f7                	jmp    8033c0 <getchar+0x20>
+
+008033c9 <iscons>:
+{
+  8033c9:	55                   	push   %ebp
+  8033ca:	89 e5                	mov    %esp,%ebp
+  8033cc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033d2:	50                   	push   %eax
+  8033d3:	ff 75 08             	push   0x8(%ebp)
+  8033d6:	e8 1a e0 ff ff       	call   8013f5 <fd_lookup>
+  8033db:	83 c4 10             	add    $0x10,%esp
+  8033de:	85 c0                	test   %eax,%eax
+  8033e0:	78 11                	js     8033f3 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8033e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033e5:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8033eb:	39 10                	cmp    %edx,(%eax)
+  8033ed:	0f 94 c0             	sete   %al
+  8033f0:	0f b6 c0             	movzbl %al,%eax
+}
+  8033f3:	c9                   	leave
+  8033f4:	c3                   	ret
+
+008033f5 <opencons>:
+{
+  8033f5:	55                   	push   %ebp
+  8033f6:	89 e5                	mov    %esp,%ebp
+  8033f8:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8033fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033fe:	50                   	push   %eax
+  8033ff:	e8 9b df ff ff       	call   80139f <fd_alloc>
+  803404:	83 c4 10             	add    $0x10,%esp
+  803407:	85 c0                	test   %eax,%eax
+  803409:	78 3a                	js     803445 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80340b:	83 ec 04             	sub    $0x4,%esp
+  80340e:	68 07 04 00 00       	push   $0x407
+  803413:	ff 75 f4             	push   -0xc(%ebp)
+  803416:	6a 00                	push   $0x0
+  803418:	e8 0b da ff ff       	call   800e28 <sys_page_alloc>
+  80341d:	83 c4 10             	add    $0x10,%esp
+  803420:	85 c0                	test   %eax,%eax
+  803422:	78 21                	js     803445 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803424:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803427:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80342d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80342f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803432:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803439:	83 ec 0c             	sub    $0xc,%esp
+  80343c:	50                   	push   %eax
+  80343d:	e8 36 df ff ff       	call   801378 <fd2num>
+  803442:	83 c4 10             	add    $0x10,%esp
+}
+  803445:	c9                   	leave
+  803446:	c3                   	ret
+
+00803447 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  803447:	55                   	push   %ebp
+  803448:	89 e5                	mov    %esp,%ebp
+  80344a:	57                   	push   %edi
+  80344b:	56                   	push   %esi
+  80344c:	53                   	push   %ebx
+  80344d:	83 ec 20             	sub    $0x20,%esp
+  803450:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803453:	89 d7                	mov    %edx,%edi
+  803455:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  803457:	51                   	push   %ecx
+  803458:	68 00 f0 7f 00       	push   $0x7ff000
+  80345d:	6a 00                	push   $0x0
+  80345f:	e8 c4 d9 ff ff       	call   800e28 <sys_page_alloc>
+  803464:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803466:	83 c4 10             	add    $0x10,%esp
+  803469:	85 c0                	test   %eax,%eax
+  80346b:	78 45                	js     8034b2 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  80346d:	83 ec 04             	sub    $0x4,%esp
+  803470:	68 00 10 00 00       	push   $0x1000
+  803475:	57                   	push   %edi
+  803476:	68 00 f0 7f 00       	push   $0x7ff000
+  80347b:	e8 22 d7 ff ff       	call   800ba2 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  803480:	89 34 24             	mov    %esi,(%esp)
+  803483:	57                   	push   %edi
+  803484:	ff 75 e4             	push   -0x1c(%ebp)
+  803487:	68 00 f0 7f 00       	push   $0x7ff000
+  80348c:	6a 00                	push   $0x0
+  80348e:	e8 e0 d9 ff ff       	call   800e73 <sys_page_map>
+  803493:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803495:	83 c4 20             	add    $0x20,%esp
+  803498:	85 c0                	test   %eax,%eax
+  80349a:	78 16                	js     8034b2 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80349c:	83 ec 08             	sub    $0x8,%esp
+  80349f:	68 00 f0 7f 00       	push   $0x7ff000
+  8034a4:	6a 00                	push   $0x0
+  8034a6:	e8 0a da ff ff       	call   800eb5 <sys_page_unmap>
+  8034ab:	83 c4 10             	add    $0x10,%esp
+  8034ae:	85 c0                	test   %eax,%eax
+  8034b0:	75 0a                	jne    8034bc <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8034b2:	89 d8                	mov    %ebx,%eax
+  8034b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034b7:	5b                   	pop    %ebx
+  8034b8:	5e                   	pop    %esi
+  8034b9:	5f                   	pop    %edi
+  8034ba:	5d                   	pop    %ebp
+  8034bb:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8034bc:	68 bc 41 80 00       	push   $0x8041bc
+  8034c1:	68 00 41 80 00       	push   $0x804100
+  8034c6:	6a 1b                	push   $0x1b
+  8034c8:	68 34 42 80 00       	push   $0x804234
+  8034cd:	e8 81 ce ff ff       	call   800353 <_panic>
+
+008034d2 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8034d2:	55                   	push   %ebp
+  8034d3:	89 e5                	mov    %esp,%ebp
+  8034d5:	53                   	push   %ebx
+  8034d6:	83 ec 04             	sub    $0x4,%esp
+  8034d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8034dc:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8034de:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  8034e2:	74 21                	je     803505 <pgfault+0x33>
+  8034e4:	89 d0                	mov    %edx,%eax
+  8034e6:	c1 e8 16             	shr    $0x16,%eax
+  8034e9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8034f0:	a8 01                	test   $0x1,%al
+  8034f2:	74 11                	je     803505 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  8034f4:	89 d0                	mov    %edx,%eax
+  8034f6:	c1 e8 0c             	shr    $0xc,%eax
+  8034f9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803500:	f6 c4 08             	test   $0x8,%ah
+  803503:	75 17                	jne    80351c <pgfault+0x4a>
+		if (pgfault_next) {
+  803505:	a1 04 b0 80 00       	mov    0x80b004,%eax
+  80350a:	85 c0                	test   %eax,%eax
+  80350c:	74 27                	je     803535 <pgfault+0x63>
+			pgfault_next(utf);
+  80350e:	83 ec 0c             	sub    $0xc,%esp
+  803511:	53                   	push   %ebx
+  803512:	ff d0                	call   *%eax
+			return;
+  803514:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803517:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80351a:	c9                   	leave
+  80351b:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  80351c:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803522:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803527:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352c:	e8 16 ff ff ff       	call   803447 <copy_page_to>
+  803531:	85 c0                	test   %eax,%eax
+  803533:	79 e2                	jns    803517 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803535:	a1 00 74 80 00       	mov    0x807400,%eax
+  80353a:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  80353d:	ff 73 28             	push   0x28(%ebx)
+  803540:	ff 33                	push   (%ebx)
+  803542:	50                   	push   %eax
+  803543:	68 e0 41 80 00       	push   $0x8041e0
+  803548:	e8 e1 ce ff ff       	call   80042e <cprintf>
+	sys_env_destroy(0);
+  80354d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803554:	e8 40 d8 ff ff       	call   800d99 <sys_env_destroy>
+  803559:	83 c4 10             	add    $0x10,%esp
+  80355c:	eb b9                	jmp    803517 <pgfault+0x45>
+
+0080355e <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  80355e:	55                   	push   %ebp
+  80355f:	89 e5                	mov    %esp,%ebp
+  803561:	53                   	push   %ebx
+  803562:	83 ec 04             	sub    $0x4,%esp
+  803565:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803568:	a1 08 b0 80 00       	mov    0x80b008,%eax
+  80356d:	3d d2 34 80 00       	cmp    $0x8034d2,%eax
+  803572:	74 15                	je     803589 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803574:	a3 04 b0 80 00       	mov    %eax,0x80b004
+		set_pgfault_handler(pgfault);
+  803579:	83 ec 0c             	sub    $0xc,%esp
+  80357c:	68 d2 34 80 00       	push   $0x8034d2
+  803581:	e8 fb 03 00 00       	call   803981 <set_pgfault_handler>
+  803586:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803589:	83 ec 0c             	sub    $0xc,%esp
+  80358c:	68 05 08 00 00       	push   $0x805
+  803591:	53                   	push   %ebx
+  803592:	6a 00                	push   $0x0
+  803594:	53                   	push   %ebx
+  803595:	6a 00                	push   $0x0
+  803597:	e8 d7 d8 ff ff       	call   800e73 <sys_page_map>
+}
+  80359c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80359f:	c9                   	leave
+  8035a0:	c3                   	ret
+
+008035a1 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8035a1:	55                   	push   %ebp
+  8035a2:	89 e5                	mov    %esp,%ebp
+  8035a4:	57                   	push   %edi
+  8035a5:	56                   	push   %esi
+  8035a6:	53                   	push   %ebx
+  8035a7:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8035aa:	68 d2 34 80 00       	push   $0x8034d2
+  8035af:	e8 cd 03 00 00       	call   803981 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8035b4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8035b9:	cd 30                	int    $0x30
+  8035bb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8035be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8035c1:	83 c4 10             	add    $0x10,%esp
+  8035c4:	85 c0                	test   %eax,%eax
+  8035c6:	0f 88 6b 01 00 00    	js     803737 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8035cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8035d1:	75 37                	jne    80360a <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8035d3:	e8 0a d8 ff ff       	call   800de2 <sys_getenvid>
+  8035d8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8035dd:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8035e3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8035e8:	a3 00 74 80 00       	mov    %eax,0x807400
+		return 0;
+  8035ed:	e9 45 01 00 00       	jmp    803737 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8035f2:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8035f8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8035fe:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803604:	0f 87 ba 00 00 00    	ja     8036c4 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  80360a:	89 d8                	mov    %ebx,%eax
+  80360c:	c1 e8 16             	shr    $0x16,%eax
+  80360f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803616:	a8 01                	test   $0x1,%al
+  803618:	74 d8                	je     8035f2 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  80361a:	89 d8                	mov    %ebx,%eax
+  80361c:	c1 e8 0c             	shr    $0xc,%eax
+  80361f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803626:	f6 c2 01             	test   $0x1,%dl
+  803629:	74 cd                	je     8035f8 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  80362b:	89 da                	mov    %ebx,%edx
+  80362d:	80 e6 df             	and    $0xdf,%dh
+  803630:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803636:	74 c0                	je     8035f8 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803638:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80363a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803641:	f6 c6 04             	test   $0x4,%dh
+  803644:	75 53                	jne    803699 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803646:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80364d:	f6 c6 08             	test   $0x8,%dh
+  803650:	75 0c                	jne    80365e <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803652:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803659:	f6 c2 02             	test   $0x2,%dl
+  80365c:	74 3b                	je     803699 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80365e:	83 ec 0c             	sub    $0xc,%esp
+  803661:	68 05 08 00 00       	push   $0x805
+  803666:	57                   	push   %edi
+  803667:	ff 75 e4             	push   -0x1c(%ebp)
+  80366a:	57                   	push   %edi
+  80366b:	6a 00                	push   $0x0
+  80366d:	e8 01 d8 ff ff       	call   800e73 <sys_page_map>
+  803672:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803674:	83 c4 20             	add    $0x20,%esp
+  803677:	85 c0                	test   %eax,%eax
+  803679:	0f 88 a7 00 00 00    	js     803726 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80367f:	83 ec 0c             	sub    $0xc,%esp
+  803682:	68 05 08 00 00       	push   $0x805
+  803687:	57                   	push   %edi
+  803688:	6a 00                	push   $0x0
+  80368a:	57                   	push   %edi
+  80368b:	6a 00                	push   $0x0
+  80368d:	e8 e1 d7 ff ff       	call   800e73 <sys_page_map>
+  803692:	89 c6                	mov    %eax,%esi
+	return r;
+  803694:	83 c4 20             	add    $0x20,%esp
+  803697:	eb 21                	jmp    8036ba <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803699:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8036a0:	83 ec 0c             	sub    $0xc,%esp
+  8036a3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8036a8:	50                   	push   %eax
+  8036a9:	57                   	push   %edi
+  8036aa:	ff 75 e4             	push   -0x1c(%ebp)
+  8036ad:	57                   	push   %edi
+  8036ae:	6a 00                	push   $0x0
+  8036b0:	e8 be d7 ff ff       	call   800e73 <sys_page_map>
+  8036b5:	89 c6                	mov    %eax,%esi
+  8036b7:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8036ba:	85 f6                	test   %esi,%esi
+  8036bc:	0f 89 36 ff ff ff    	jns    8035f8 <fork+0x57>
+  8036c2:	eb 62                	jmp    803726 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8036c4:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8036c9:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8036ce:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8036d1:	89 f8                	mov    %edi,%eax
+  8036d3:	e8 6f fd ff ff       	call   803447 <copy_page_to>
+  8036d8:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8036da:	85 c0                	test   %eax,%eax
+  8036dc:	78 48                	js     803726 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8036de:	83 ec 04             	sub    $0x4,%esp
+  8036e1:	6a 07                	push   $0x7
+  8036e3:	68 00 f0 bf ee       	push   $0xeebff000
+  8036e8:	57                   	push   %edi
+  8036e9:	e8 3a d7 ff ff       	call   800e28 <sys_page_alloc>
+  8036ee:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8036f0:	83 c4 10             	add    $0x10,%esp
+  8036f3:	85 c0                	test   %eax,%eax
+  8036f5:	78 2f                	js     803726 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8036f7:	a1 00 74 80 00       	mov    0x807400,%eax
+  8036fc:	8b 40 64             	mov    0x64(%eax),%eax
+  8036ff:	83 ec 08             	sub    $0x8,%esp
+  803702:	50                   	push   %eax
+  803703:	57                   	push   %edi
+  803704:	e8 8a d8 ff ff       	call   800f93 <sys_env_set_pgfault_upcall>
+  803709:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80370b:	83 c4 10             	add    $0x10,%esp
+  80370e:	85 c0                	test   %eax,%eax
+  803710:	78 14                	js     803726 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803712:	83 ec 08             	sub    $0x8,%esp
+  803715:	6a 02                	push   $0x2
+  803717:	57                   	push   %edi
+  803718:	e8 e2 d7 ff ff       	call   800eff <sys_env_set_status>
+  80371d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80371f:	83 c4 10             	add    $0x10,%esp
+  803722:	85 c0                	test   %eax,%eax
+  803724:	79 11                	jns    803737 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803726:	83 ec 0c             	sub    $0xc,%esp
+  803729:	ff 75 e0             	push   -0x20(%ebp)
+  80372c:	e8 68 d6 ff ff       	call   800d99 <sys_env_destroy>
+	return r;
+  803731:	83 c4 10             	add    $0x10,%esp
+  803734:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803737:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80373a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80373d:	5b                   	pop    %ebx
+  80373e:	5e                   	pop    %esi
+  80373f:	5f                   	pop    %edi
+  803740:	5d                   	pop    %ebp
+  803741:	c3                   	ret
+
+00803742 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803742:	55                   	push   %ebp
+  803743:	89 e5                	mov    %esp,%ebp
+  803745:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803748:	68 3f 42 80 00       	push   $0x80423f
+  80374d:	68 bf 00 00 00       	push   $0xbf
+  803752:	68 34 42 80 00       	push   $0x804234
+  803757:	e8 f7 cb ff ff       	call   800353 <_panic>
+
+0080375c <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80375c:	55                   	push   %ebp
+  80375d:	89 e5                	mov    %esp,%ebp
+  80375f:	56                   	push   %esi
+  803760:	53                   	push   %ebx
+  803761:	8b 75 08             	mov    0x8(%ebp),%esi
+  803764:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803767:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80376a:	85 c0                	test   %eax,%eax
+  80376c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803771:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803774:	83 ec 0c             	sub    $0xc,%esp
+  803777:	50                   	push   %eax
+  803778:	e8 f3 d8 ff ff       	call   801070 <sys_ipc_recv>
+	if (from_env_store)
+  80377d:	83 c4 10             	add    $0x10,%esp
+  803780:	85 f6                	test   %esi,%esi
+  803782:	74 14                	je     803798 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803784:	ba 00 00 00 00       	mov    $0x0,%edx
+  803789:	85 c0                	test   %eax,%eax
+  80378b:	75 09                	jne    803796 <ipc_recv+0x3a>
+  80378d:	8b 15 00 74 80 00    	mov    0x807400,%edx
+  803793:	8b 52 74             	mov    0x74(%edx),%edx
+  803796:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803798:	85 db                	test   %ebx,%ebx
+  80379a:	74 25                	je     8037c1 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80379c:	85 c0                	test   %eax,%eax
+  80379e:	74 0d                	je     8037ad <ipc_recv+0x51>
+  8037a0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8037a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8037a9:	5b                   	pop    %ebx
+  8037aa:	5e                   	pop    %esi
+  8037ab:	5d                   	pop    %ebp
+  8037ac:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8037ad:	a1 00 74 80 00       	mov    0x807400,%eax
+  8037b2:	8b 40 78             	mov    0x78(%eax),%eax
+  8037b5:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8037b7:	a1 00 74 80 00       	mov    0x807400,%eax
+  8037bc:	8b 40 70             	mov    0x70(%eax),%eax
+  8037bf:	eb e5                	jmp    8037a6 <ipc_recv+0x4a>
+  8037c1:	85 c0                	test   %eax,%eax
+  8037c3:	75 e1                	jne    8037a6 <ipc_recv+0x4a>
+  8037c5:	eb f0                	jmp    8037b7 <ipc_recv+0x5b>
+
+008037c7 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8037c7:	55                   	push   %ebp
+  8037c8:	89 e5                	mov    %esp,%ebp
+  8037ca:	57                   	push   %edi
+  8037cb:	56                   	push   %esi
+  8037cc:	53                   	push   %ebx
+  8037cd:	83 ec 0c             	sub    $0xc,%esp
+  8037d0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037d3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8037d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8037d9:	85 db                	test   %ebx,%ebx
+  8037db:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8037e0:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8037e3:	ff 75 14             	push   0x14(%ebp)
+  8037e6:	53                   	push   %ebx
+  8037e7:	56                   	push   %esi
+  8037e8:	57                   	push   %edi
+  8037e9:	e8 ef d7 ff ff       	call   800fdd <sys_ipc_try_send>
+  8037ee:	83 c4 10             	add    $0x10,%esp
+  8037f1:	85 c0                	test   %eax,%eax
+  8037f3:	74 22                	je     803817 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8037f5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8037f8:	75 07                	jne    803801 <ipc_send+0x3a>
+		sys_yield();
+  8037fa:	e8 0a d6 ff ff       	call   800e09 <sys_yield>
+  8037ff:	eb e2                	jmp    8037e3 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803801:	68 55 42 80 00       	push   $0x804255
+  803806:	68 00 41 80 00       	push   $0x804100
+  80380b:	6a 39                	push   $0x39
+  80380d:	68 6a 42 80 00       	push   $0x80426a
+  803812:	e8 3c cb ff ff       	call   800353 <_panic>
+	}
+}
+  803817:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80381a:	5b                   	pop    %ebx
+  80381b:	5e                   	pop    %esi
+  80381c:	5f                   	pop    %edi
+  80381d:	5d                   	pop    %ebp
+  80381e:	c3                   	ret
+
+0080381f <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80381f:	55                   	push   %ebp
+  803820:	89 e5                	mov    %esp,%ebp
+  803822:	57                   	push   %edi
+  803823:	56                   	push   %esi
+  803824:	53                   	push   %ebx
+  803825:	83 ec 10             	sub    $0x10,%esp
+  803828:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80382b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80382e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803831:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803834:	85 c0                	test   %eax,%eax
+  803836:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80383b:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  80383e:	6a 00                	push   $0x0
+  803840:	ff 33                	push   (%ebx)
+  803842:	50                   	push   %eax
+  803843:	e8 e5 d7 ff ff       	call   80102d <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803848:	83 c4 10             	add    $0x10,%esp
+  80384b:	85 c0                	test   %eax,%eax
+  80384d:	75 3c                	jne    80388b <ipc_recvv+0x6c>
+  80384f:	8b 15 00 74 80 00    	mov    0x807400,%edx
+  803855:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803858:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  80385a:	85 ff                	test   %edi,%edi
+  80385c:	74 4e                	je     8038ac <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80385e:	8b 15 00 74 80 00    	mov    0x807400,%edx
+  803864:	8b 52 74             	mov    0x74(%edx),%edx
+  803867:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803869:	85 f6                	test   %esi,%esi
+  80386b:	74 18                	je     803885 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80386d:	85 c0                	test   %eax,%eax
+  80386f:	75 2d                	jne    80389e <ipc_recvv+0x7f>
+  803871:	a1 00 74 80 00       	mov    0x807400,%eax
+  803876:	8b 40 78             	mov    0x78(%eax),%eax
+  803879:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  80387b:	a1 00 74 80 00       	mov    0x807400,%eax
+  803880:	8b 40 70             	mov    0x70(%eax),%eax
+  803883:	eb 1f                	jmp    8038a4 <ipc_recvv+0x85>
+  803885:	85 c0                	test   %eax,%eax
+  803887:	75 1b                	jne    8038a4 <ipc_recvv+0x85>
+  803889:	eb f0                	jmp    80387b <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80388b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803891:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803896:	85 ff                	test   %edi,%edi
+  803898:	75 cd                	jne    803867 <ipc_recvv+0x48>
+	if (perm_store)
+  80389a:	85 f6                	test   %esi,%esi
+  80389c:	74 e7                	je     803885 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80389e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8038a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038a7:	5b                   	pop    %ebx
+  8038a8:	5e                   	pop    %esi
+  8038a9:	5f                   	pop    %edi
+  8038aa:	5d                   	pop    %ebp
+  8038ab:	c3                   	ret
+	if (perm_store)
+  8038ac:	85 f6                	test   %esi,%esi
+  8038ae:	75 bd                	jne    80386d <ipc_recvv+0x4e>
+  8038b0:	eb c9                	jmp    80387b <ipc_recvv+0x5c>
+
+008038b2 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8038b2:	55                   	push   %ebp
+  8038b3:	89 e5                	mov    %esp,%ebp
+  8038b5:	57                   	push   %edi
+  8038b6:	56                   	push   %esi
+  8038b7:	53                   	push   %ebx
+  8038b8:	83 ec 0c             	sub    $0xc,%esp
+  8038bb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8038be:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8038c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8038c4:	ff 75 14             	push   0x14(%ebp)
+  8038c7:	53                   	push   %ebx
+  8038c8:	56                   	push   %esi
+  8038c9:	57                   	push   %edi
+  8038ca:	e8 36 d7 ff ff       	call   801005 <sys_ipc_try_sendv>
+  8038cf:	83 c4 10             	add    $0x10,%esp
+  8038d2:	85 c0                	test   %eax,%eax
+  8038d4:	74 22                	je     8038f8 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8038d6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8038d9:	75 07                	jne    8038e2 <ipc_sendv+0x30>
+		sys_yield();
+  8038db:	e8 29 d5 ff ff       	call   800e09 <sys_yield>
+  8038e0:	eb e2                	jmp    8038c4 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8038e2:	68 55 42 80 00       	push   $0x804255
+  8038e7:	68 00 41 80 00       	push   $0x804100
+  8038ec:	6a 5c                	push   $0x5c
+  8038ee:	68 6a 42 80 00       	push   $0x80426a
+  8038f3:	e8 5b ca ff ff       	call   800353 <_panic>
+	}
+}
+  8038f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038fb:	5b                   	pop    %ebx
+  8038fc:	5e                   	pop    %esi
+  8038fd:	5f                   	pop    %edi
+  8038fe:	5d                   	pop    %ebp
+  8038ff:	c3                   	ret
+
+00803900 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803900:	55                   	push   %ebp
+  803901:	89 e5                	mov    %esp,%ebp
+  803903:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803906:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80390b:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803911:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803917:	8b 52 50             	mov    0x50(%edx),%edx
+  80391a:	39 ca                	cmp    %ecx,%edx
+  80391c:	74 11                	je     80392f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80391e:	83 c0 01             	add    $0x1,%eax
+  803921:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803926:	75 e3                	jne    80390b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803928:	b8 00 00 00 00       	mov    $0x0,%eax
+  80392d:	eb 0e                	jmp    80393d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80392f:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803935:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80393a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80393d:	5d                   	pop    %ebp
+  80393e:	c3                   	ret
+
+0080393f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80393f:	55                   	push   %ebp
+  803940:	89 e5                	mov    %esp,%ebp
+  803942:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803945:	89 c2                	mov    %eax,%edx
+  803947:	c1 ea 16             	shr    $0x16,%edx
+  80394a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803951:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803956:	f6 c1 01             	test   $0x1,%cl
+  803959:	74 22                	je     80397d <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80395b:	c1 e8 0c             	shr    $0xc,%eax
+  80395e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803965:	a8 01                	test   $0x1,%al
+  803967:	74 14                	je     80397d <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803969:	c1 e8 0c             	shr    $0xc,%eax
+  80396c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80396f:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803976:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  80397a:	0f b7 d2             	movzwl %dx,%edx
+}
+  80397d:	89 d0                	mov    %edx,%eax
+  80397f:	5d                   	pop    %ebp
+  803980:	c3                   	ret
+
+00803981 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803981:	55                   	push   %ebp
+  803982:	89 e5                	mov    %esp,%ebp
+  803984:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803987:	83 3d 08 b0 80 00 00 	cmpl   $0x0,0x80b008
+  80398e:	74 0a                	je     80399a <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803990:	8b 45 08             	mov    0x8(%ebp),%eax
+  803993:	a3 08 b0 80 00       	mov    %eax,0x80b008
+}
+  803998:	c9                   	leave
+  803999:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80399a:	83 ec 04             	sub    $0x4,%esp
+  80399d:	6a 07                	push   $0x7
+  80399f:	68 00 f0 bf ee       	push   $0xeebff000
+  8039a4:	6a 00                	push   $0x0
+  8039a6:	e8 7d d4 ff ff       	call   800e28 <sys_page_alloc>
+  8039ab:	83 c4 10             	add    $0x10,%esp
+  8039ae:	85 c0                	test   %eax,%eax
+  8039b0:	75 2c                	jne    8039de <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8039b2:	83 ec 08             	sub    $0x8,%esp
+  8039b5:	68 f4 39 80 00       	push   $0x8039f4
+  8039ba:	6a 00                	push   $0x0
+  8039bc:	e8 d2 d5 ff ff       	call   800f93 <sys_env_set_pgfault_upcall>
+  8039c1:	83 c4 10             	add    $0x10,%esp
+  8039c4:	85 c0                	test   %eax,%eax
+  8039c6:	74 c8                	je     803990 <set_pgfault_handler+0xf>
+  8039c8:	68 bc 42 80 00       	push   $0x8042bc
+  8039cd:	68 00 41 80 00       	push   $0x804100
+  8039d2:	6a 20                	push   $0x20
+  8039d4:	68 ec 42 80 00       	push   $0x8042ec
+  8039d9:	e8 75 c9 ff ff       	call   800353 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8039de:	68 74 42 80 00       	push   $0x804274
+  8039e3:	68 00 41 80 00       	push   $0x804100
+  8039e8:	6a 1e                	push   $0x1e
+  8039ea:	68 ec 42 80 00       	push   $0x8042ec
+  8039ef:	e8 5f c9 ff ff       	call   800353 <_panic>
+
+008039f4 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8039f4:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8039f5:	a1 08 b0 80 00       	mov    0x80b008,%eax
+	call *%eax
+  8039fa:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8039fc:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8039ff:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803a04:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803a09:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803a0d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803a10:	83 c4 08             	add    $0x8,%esp
+	popal
+  803a13:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803a14:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803a17:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803a18:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803a19:	c3                   	ret
+
+00803a1a <dm>:
+  803a1a:	55                   	push   %ebp
+  803a1b:	57                   	push   %edi
+  803a1c:	56                   	push   %esi
+  803a1d:	53                   	push   %ebx
+  803a1e:	83 ec 24             	sub    $0x24,%esp
+  803a21:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a25:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a29:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803a2d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803a31:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803a35:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803a39:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803a3d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803a42:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a47:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a4c:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803a53:	00 
+  803a54:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803a5b:	00 
+  803a5c:	89 fb                	mov    %edi,%ebx
+  803a5e:	eb 08                	jmp    803a68 <dm+0x4e>
+  803a60:	83 e9 01             	sub    $0x1,%ecx
+  803a63:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803a66:	74 68                	je     803ad0 <dm+0xb6>
+  803a68:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803a6c:	01 c0                	add    %eax,%eax
+  803a6e:	89 c6                	mov    %eax,%esi
+  803a70:	89 d7                	mov    %edx,%edi
+  803a72:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a76:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a7a:	0f ad d0             	shrd   %cl,%edx,%eax
+  803a7d:	d3 ea                	shr    %cl,%edx
+  803a7f:	f6 c1 20             	test   $0x20,%cl
+  803a82:	74 04                	je     803a88 <dm+0x6e>
+  803a84:	89 d0                	mov    %edx,%eax
+  803a86:	31 d2                	xor    %edx,%edx
+  803a88:	83 e0 01             	and    $0x1,%eax
+  803a8b:	89 04 24             	mov    %eax,(%esp)
+  803a8e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803a95:	00 
+  803a96:	8b 04 24             	mov    (%esp),%eax
+  803a99:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803a9d:	09 f0                	or     %esi,%eax
+  803a9f:	09 fa                	or     %edi,%edx
+  803aa1:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803aa5:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803aa9:	39 f0                	cmp    %esi,%eax
+  803aab:	89 d5                	mov    %edx,%ebp
+  803aad:	19 fd                	sbb    %edi,%ebp
+  803aaf:	72 af                	jb     803a60 <dm+0x46>
+  803ab1:	29 f0                	sub    %esi,%eax
+  803ab3:	19 fa                	sbb    %edi,%edx
+  803ab5:	89 cf                	mov    %ecx,%edi
+  803ab7:	c1 ef 05             	shr    $0x5,%edi
+  803aba:	83 e7 01             	and    $0x1,%edi
+  803abd:	89 fe                	mov    %edi,%esi
+  803abf:	83 f6 01             	xor    $0x1,%esi
+  803ac2:	d3 e6                	shl    %cl,%esi
+  803ac4:	d3 e7                	shl    %cl,%edi
+  803ac6:	09 74 24 18          	or     %esi,0x18(%esp)
+  803aca:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803ace:	eb 90                	jmp    803a60 <dm+0x46>
+  803ad0:	85 db                	test   %ebx,%ebx
+  803ad2:	74 05                	je     803ad9 <dm+0xbf>
+  803ad4:	89 03                	mov    %eax,(%ebx)
+  803ad6:	89 53 04             	mov    %edx,0x4(%ebx)
+  803ad9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803add:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ae1:	83 c4 24             	add    $0x24,%esp
+  803ae4:	5b                   	pop    %ebx
+  803ae5:	5e                   	pop    %esi
+  803ae6:	5f                   	pop    %edi
+  803ae7:	5d                   	pop    %ebp
+  803ae8:	c3                   	ret
+
+00803ae9 <__udivdi3>:
+  803ae9:	83 ec 08             	sub    $0x8,%esp
+  803aec:	6a 00                	push   $0x0
+  803aee:	ff 74 24 1c          	push   0x1c(%esp)
+  803af2:	ff 74 24 1c          	push   0x1c(%esp)
+  803af6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803afa:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803afe:	e8 17 ff ff ff       	call   803a1a <dm>
+  803b03:	83 c4 14             	add    $0x14,%esp
+  803b06:	c3                   	ret
+
+00803b07 <__umoddi3>:
+  803b07:	83 ec 18             	sub    $0x18,%esp
+  803b0a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803b0e:	50                   	push   %eax
+  803b0f:	ff 74 24 2c          	push   0x2c(%esp)
+  803b13:	ff 74 24 2c          	push   0x2c(%esp)
+  803b17:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803b1b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803b1f:	e8 f6 fe ff ff       	call   803a1a <dm>
+  803b24:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b28:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b2c:	83 c4 24             	add    $0x24,%esp
+  803b2f:	c3                   	ret
+
+00803b30 <__divdi3>:
+  803b30:	53                   	push   %ebx
+  803b31:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803b35:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803b39:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803b3d:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803b41:	85 d2                	test   %edx,%edx
+  803b43:	78 15                	js     803b5a <__divdi3+0x2a>
+  803b45:	85 db                	test   %ebx,%ebx
+  803b47:	78 34                	js     803b7d <__divdi3+0x4d>
+  803b49:	83 ec 04             	sub    $0x4,%esp
+  803b4c:	6a 00                	push   $0x0
+  803b4e:	53                   	push   %ebx
+  803b4f:	51                   	push   %ecx
+  803b50:	e8 c5 fe ff ff       	call   803a1a <dm>
+  803b55:	83 c4 10             	add    $0x10,%esp
+  803b58:	eb 21                	jmp    803b7b <__divdi3+0x4b>
+  803b5a:	f7 d8                	neg    %eax
+  803b5c:	83 d2 00             	adc    $0x0,%edx
+  803b5f:	f7 da                	neg    %edx
+  803b61:	85 db                	test   %ebx,%ebx
+  803b63:	78 30                	js     803b95 <__divdi3+0x65>
+  803b65:	83 ec 04             	sub    $0x4,%esp
+  803b68:	6a 00                	push   $0x0
+  803b6a:	53                   	push   %ebx
+  803b6b:	51                   	push   %ecx
+  803b6c:	e8 a9 fe ff ff       	call   803a1a <dm>
+  803b71:	83 c4 10             	add    $0x10,%esp
+  803b74:	f7 d8                	neg    %eax
+  803b76:	83 d2 00             	adc    $0x0,%edx
+  803b79:	f7 da                	neg    %edx
+  803b7b:	5b                   	pop    %ebx
+  803b7c:	c3                   	ret
+  803b7d:	83 ec 04             	sub    $0x4,%esp
+  803b80:	6a 00                	push   $0x0
+  803b82:	f7 d9                	neg    %ecx
+  803b84:	83 d3 00             	adc    $0x0,%ebx
+  803b87:	f7 db                	neg    %ebx
+  803b89:	53                   	push   %ebx
+  803b8a:	51                   	push   %ecx
+  803b8b:	e8 8a fe ff ff       	call   803a1a <dm>
+  803b90:	83 c4 10             	add    $0x10,%esp
+  803b93:	eb df                	jmp    803b74 <__divdi3+0x44>
+  803b95:	83 ec 04             	sub    $0x4,%esp
+  803b98:	6a 00                	push   $0x0
+  803b9a:	f7 d9                	neg    %ecx
+  803b9c:	83 d3 00             	adc    $0x0,%ebx
+  803b9f:	f7 db                	neg    %ebx
+  803ba1:	53                   	push   %ebx
+  803ba2:	51                   	push   %ecx
+  803ba3:	e8 72 fe ff ff       	call   803a1a <dm>
+  803ba8:	83 c4 10             	add    $0x10,%esp
+  803bab:	eb ce                	jmp    803b7b <__divdi3+0x4b>
+
+00803bad <__moddi3>:
+  803bad:	55                   	push   %ebp
+  803bae:	57                   	push   %edi
+  803baf:	56                   	push   %esi
+  803bb0:	53                   	push   %ebx
+  803bb1:	83 ec 24             	sub    $0x24,%esp
+  803bb4:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803bb8:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803bbc:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803bc0:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803bc4:	85 d2                	test   %edx,%edx
+  803bc6:	78 3b                	js     803c03 <__moddi3+0x56>
+  803bc8:	83 ec 04             	sub    $0x4,%esp
+  803bcb:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803bcf:	56                   	push   %esi
+  803bd0:	89 ce                	mov    %ecx,%esi
+  803bd2:	f7 de                	neg    %esi
+  803bd4:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803bd8:	89 de                	mov    %ebx,%esi
+  803bda:	83 d6 00             	adc    $0x0,%esi
+  803bdd:	f7 de                	neg    %esi
+  803bdf:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803be3:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803be7:	0f 48 f1             	cmovs  %ecx,%esi
+  803bea:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803bef:	53                   	push   %ebx
+  803bf0:	56                   	push   %esi
+  803bf1:	e8 24 fe ff ff       	call   803a1a <dm>
+  803bf6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803bfa:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803bfe:	83 c4 10             	add    $0x10,%esp
+  803c01:	eb 47                	jmp    803c4a <__moddi3+0x9d>
+  803c03:	f7 d8                	neg    %eax
+  803c05:	83 d2 00             	adc    $0x0,%edx
+  803c08:	f7 da                	neg    %edx
+  803c0a:	83 ec 04             	sub    $0x4,%esp
+  803c0d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803c11:	56                   	push   %esi
+  803c12:	89 cf                	mov    %ecx,%edi
+  803c14:	f7 df                	neg    %edi
+  803c16:	89 de                	mov    %ebx,%esi
+  803c18:	83 d6 00             	adc    $0x0,%esi
+  803c1b:	f7 de                	neg    %esi
+  803c1d:	0f 49 cf             	cmovns %edi,%ecx
+  803c20:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803c24:	0f 49 de             	cmovns %esi,%ebx
+  803c27:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803c2b:	ff 74 24 0c          	push   0xc(%esp)
+  803c2f:	ff 74 24 0c          	push   0xc(%esp)
+  803c33:	e8 e2 fd ff ff       	call   803a1a <dm>
+  803c38:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803c3c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803c40:	f7 d8                	neg    %eax
+  803c42:	83 d2 00             	adc    $0x0,%edx
+  803c45:	f7 da                	neg    %edx
+  803c47:	83 c4 10             	add    $0x10,%esp
+  803c4a:	83 c4 24             	add    $0x24,%esp
+  803c4d:	5b                   	pop    %ebx
+  803c4e:	5e                   	pop    %esi
+  803c4f:	5f                   	pop    %edi
+  803c50:	5d                   	pop    %ebp
+  803c51:	c3                   	ret
@@ -0,0 +1,8120 @@
+
+obj/user/lsfd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e0 00 00 00       	call   800111 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	cprintf("usage: lsfd [-1]\n");
+  800039:	68 80 3a 80 00       	push   $0x803a80
+  80003e:	e8 c6 01 00 00       	call   800209 <cprintf>
+	exit();
+  800043:	e8 12 01 00 00       	call   80015a <exit>
+}
+  800048:	83 c4 10             	add    $0x10,%esp
+  80004b:	c9                   	leave
+  80004c:	c3                   	ret
+
+0080004d <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80004d:	55                   	push   %ebp
+  80004e:	89 e5                	mov    %esp,%ebp
+  800050:	57                   	push   %edi
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	81 ec b0 00 00 00    	sub    $0xb0,%esp
+	int i, usefprint = 0;
+	struct Stat st;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  800059:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  80005f:	50                   	push   %eax
+  800060:	ff 75 0c             	push   0xc(%ebp)
+  800063:	8d 45 08             	lea    0x8(%ebp),%eax
+  800066:	50                   	push   %eax
+  800067:	e8 98 0f 00 00       	call   801004 <argstart>
+	while ((i = argnext(&args)) >= 0)
+  80006c:	83 c4 10             	add    $0x10,%esp
+	int i, usefprint = 0;
+  80006f:	be 00 00 00 00       	mov    $0x0,%esi
+	while ((i = argnext(&args)) >= 0)
+  800074:	8d 9d 4c ff ff ff    	lea    -0xb4(%ebp),%ebx
+		if (i == '1')
+			usefprint = 1;
+  80007a:	bf 01 00 00 00       	mov    $0x1,%edi
+	while ((i = argnext(&args)) >= 0)
+  80007f:	83 ec 0c             	sub    $0xc,%esp
+  800082:	53                   	push   %ebx
+  800083:	e8 ac 0f 00 00       	call   801034 <argnext>
+  800088:	83 c4 10             	add    $0x10,%esp
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	78 10                	js     80009f <umain+0x52>
+		if (i == '1')
+  80008f:	83 f8 31             	cmp    $0x31,%eax
+  800092:	75 04                	jne    800098 <umain+0x4b>
+			usefprint = 1;
+  800094:	89 fe                	mov    %edi,%esi
+  800096:	eb e7                	jmp    80007f <umain+0x32>
+		else
+			usage();
+  800098:	e8 96 ff ff ff       	call   800033 <usage>
+  80009d:	eb e0                	jmp    80007f <umain+0x32>
+
+	for (i = 0; i < 32; i++)
+  80009f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fstat(i, &st) >= 0) {
+  8000a4:	8d bd 5c ff ff ff    	lea    -0xa4(%ebp),%edi
+  8000aa:	eb 26                	jmp    8000d2 <umain+0x85>
+			if (usefprint)
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+			else
+				cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8000ac:	83 ec 08             	sub    $0x8,%esp
+  8000af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000b2:	ff 70 04             	push   0x4(%eax)
+  8000b5:	ff 75 dc             	push   -0x24(%ebp)
+  8000b8:	ff 75 e0             	push   -0x20(%ebp)
+  8000bb:	57                   	push   %edi
+  8000bc:	53                   	push   %ebx
+  8000bd:	68 94 3a 80 00       	push   $0x803a94
+  8000c2:	e8 42 01 00 00       	call   800209 <cprintf>
+  8000c7:	83 c4 20             	add    $0x20,%esp
+	for (i = 0; i < 32; i++)
+  8000ca:	83 c3 01             	add    $0x1,%ebx
+  8000cd:	83 fb 20             	cmp    $0x20,%ebx
+  8000d0:	74 37                	je     800109 <umain+0xbc>
+		if (fstat(i, &st) >= 0) {
+  8000d2:	83 ec 08             	sub    $0x8,%esp
+  8000d5:	57                   	push   %edi
+  8000d6:	53                   	push   %ebx
+  8000d7:	e8 d3 15 00 00       	call   8016af <fstat>
+  8000dc:	83 c4 10             	add    $0x10,%esp
+  8000df:	85 c0                	test   %eax,%eax
+  8000e1:	78 e7                	js     8000ca <umain+0x7d>
+			if (usefprint)
+  8000e3:	85 f6                	test   %esi,%esi
+  8000e5:	74 c5                	je     8000ac <umain+0x5f>
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000ed:	ff 70 04             	push   0x4(%eax)
+  8000f0:	ff 75 dc             	push   -0x24(%ebp)
+  8000f3:	ff 75 e0             	push   -0x20(%ebp)
+  8000f6:	57                   	push   %edi
+  8000f7:	53                   	push   %ebx
+  8000f8:	68 94 3a 80 00       	push   $0x803a94
+  8000fd:	6a 01                	push   $0x1
+  8000ff:	e8 cb 27 00 00       	call   8028cf <fprintf>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	eb c1                	jmp    8000ca <umain+0x7d>
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+		}
+}
+  800109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80010c:	5b                   	pop    %ebx
+  80010d:	5e                   	pop    %esi
+  80010e:	5f                   	pop    %edi
+  80010f:	5d                   	pop    %ebp
+  800110:	c3                   	ret
+
+00800111 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800111:	55                   	push   %ebp
+  800112:	89 e5                	mov    %esp,%ebp
+  800114:	56                   	push   %esi
+  800115:	53                   	push   %ebx
+  800116:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800119:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80011c:	e8 9c 0a 00 00       	call   800bbd <sys_getenvid>
+  800121:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800126:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80012c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800131:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800136:	85 db                	test   %ebx,%ebx
+  800138:	7e 07                	jle    800141 <libmain+0x30>
+		binaryname = argv[0];
+  80013a:	8b 06                	mov    (%esi),%eax
+  80013c:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800141:	83 ec 08             	sub    $0x8,%esp
+  800144:	56                   	push   %esi
+  800145:	53                   	push   %ebx
+  800146:	e8 02 ff ff ff       	call   80004d <umain>
+
+	// exit gracefully
+	exit();
+  80014b:	e8 0a 00 00 00       	call   80015a <exit>
+}
+  800150:	83 c4 10             	add    $0x10,%esp
+  800153:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800156:	5b                   	pop    %ebx
+  800157:	5e                   	pop    %esi
+  800158:	5d                   	pop    %ebp
+  800159:	c3                   	ret
+
+0080015a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80015a:	55                   	push   %ebp
+  80015b:	89 e5                	mov    %esp,%ebp
+  80015d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800160:	e8 c2 11 00 00       	call   801327 <close_all>
+	sys_env_destroy(0);
+  800165:	83 ec 0c             	sub    $0xc,%esp
+  800168:	6a 00                	push   $0x0
+  80016a:	e8 05 0a 00 00       	call   800b74 <sys_env_destroy>
+}
+  80016f:	83 c4 10             	add    $0x10,%esp
+  800172:	c9                   	leave
+  800173:	c3                   	ret
+
+00800174 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800174:	55                   	push   %ebp
+  800175:	89 e5                	mov    %esp,%ebp
+  800177:	53                   	push   %ebx
+  800178:	83 ec 04             	sub    $0x4,%esp
+  80017b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80017e:	8b 13                	mov    (%ebx),%edx
+  800180:	8d 42 01             	lea    0x1(%edx),%eax
+  800183:	89 03                	mov    %eax,(%ebx)
+  800185:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800188:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80018c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800191:	74 09                	je     80019c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800193:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800197:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80019a:	c9                   	leave
+  80019b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80019c:	83 ec 08             	sub    $0x8,%esp
+  80019f:	68 ff 00 00 00       	push   $0xff
+  8001a4:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001a7:	50                   	push   %eax
+  8001a8:	e8 7a 09 00 00       	call   800b27 <sys_cputs>
+		b->idx = 0;
+  8001ad:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001b3:	83 c4 10             	add    $0x10,%esp
+  8001b6:	eb db                	jmp    800193 <putch+0x1f>
+
+008001b8 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001b8:	55                   	push   %ebp
+  8001b9:	89 e5                	mov    %esp,%ebp
+  8001bb:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001c1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001c8:	00 00 00 
+	b.cnt = 0;
+  8001cb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001d2:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001d5:	ff 75 0c             	push   0xc(%ebp)
+  8001d8:	ff 75 08             	push   0x8(%ebp)
+  8001db:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001e1:	50                   	push   %eax
+  8001e2:	68 74 01 80 00       	push   $0x800174
+  8001e7:	e8 14 01 00 00       	call   800300 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001ec:	83 c4 08             	add    $0x8,%esp
+  8001ef:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001f5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001fb:	50                   	push   %eax
+  8001fc:	e8 26 09 00 00       	call   800b27 <sys_cputs>
+
+	return b.cnt;
+}
+  800201:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+00800209 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80020f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800212:	50                   	push   %eax
+  800213:	ff 75 08             	push   0x8(%ebp)
+  800216:	e8 9d ff ff ff       	call   8001b8 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80021b:	c9                   	leave
+  80021c:	c3                   	ret
+
+0080021d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80021d:	55                   	push   %ebp
+  80021e:	89 e5                	mov    %esp,%ebp
+  800220:	57                   	push   %edi
+  800221:	56                   	push   %esi
+  800222:	53                   	push   %ebx
+  800223:	83 ec 1c             	sub    $0x1c,%esp
+  800226:	89 c7                	mov    %eax,%edi
+  800228:	89 d6                	mov    %edx,%esi
+  80022a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80022d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800230:	89 d1                	mov    %edx,%ecx
+  800232:	89 c2                	mov    %eax,%edx
+  800234:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800237:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80023a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80023d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800240:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800243:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80024a:	39 c2                	cmp    %eax,%edx
+  80024c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80024f:	72 3e                	jb     80028f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800251:	83 ec 0c             	sub    $0xc,%esp
+  800254:	ff 75 18             	push   0x18(%ebp)
+  800257:	83 eb 01             	sub    $0x1,%ebx
+  80025a:	53                   	push   %ebx
+  80025b:	50                   	push   %eax
+  80025c:	83 ec 08             	sub    $0x8,%esp
+  80025f:	ff 75 e4             	push   -0x1c(%ebp)
+  800262:	ff 75 e0             	push   -0x20(%ebp)
+  800265:	ff 75 dc             	push   -0x24(%ebp)
+  800268:	ff 75 d8             	push   -0x28(%ebp)
+  80026b:	e8 9a 36 00 00       	call   80390a <__udivdi3>
+  800270:	83 c4 18             	add    $0x18,%esp
+  800273:	52                   	push   %edx
+  800274:	50                   	push   %eax
+  800275:	89 f2                	mov    %esi,%edx
+  800277:	89 f8                	mov    %edi,%eax
+  800279:	e8 9f ff ff ff       	call   80021d <printnum>
+  80027e:	83 c4 20             	add    $0x20,%esp
+  800281:	eb 13                	jmp    800296 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800283:	83 ec 08             	sub    $0x8,%esp
+  800286:	56                   	push   %esi
+  800287:	ff 75 18             	push   0x18(%ebp)
+  80028a:	ff d7                	call   *%edi
+  80028c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80028f:	83 eb 01             	sub    $0x1,%ebx
+  800292:	85 db                	test   %ebx,%ebx
+  800294:	7f ed                	jg     800283 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800296:	83 ec 08             	sub    $0x8,%esp
+  800299:	56                   	push   %esi
+  80029a:	83 ec 04             	sub    $0x4,%esp
+  80029d:	ff 75 e4             	push   -0x1c(%ebp)
+  8002a0:	ff 75 e0             	push   -0x20(%ebp)
+  8002a3:	ff 75 dc             	push   -0x24(%ebp)
+  8002a6:	ff 75 d8             	push   -0x28(%ebp)
+  8002a9:	e8 7a 36 00 00       	call   803928 <__umoddi3>
+  8002ae:	83 c4 14             	add    $0x14,%esp
+  8002b1:	0f be 80 c6 3a 80 00 	movsbl 0x803ac6(%eax),%eax
+  8002b8:	50                   	push   %eax
+  8002b9:	ff d7                	call   *%edi
+}
+  8002bb:	83 c4 10             	add    $0x10,%esp
+  8002be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c1:	5b                   	pop    %ebx
+  8002c2:	5e                   	pop    %esi
+  8002c3:	5f                   	pop    %edi
+  8002c4:	5d                   	pop    %ebp
+  8002c5:	c3                   	ret
+
+008002c6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002c6:	55                   	push   %ebp
+  8002c7:	89 e5                	mov    %esp,%ebp
+  8002c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002cc:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002d0:	8b 10                	mov    (%eax),%edx
+  8002d2:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002d5:	73 0a                	jae    8002e1 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002d7:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002da:	89 08                	mov    %ecx,(%eax)
+  8002dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002df:	88 02                	mov    %al,(%edx)
+}
+  8002e1:	5d                   	pop    %ebp
+  8002e2:	c3                   	ret
+
+008002e3 <printfmt>:
+{
+  8002e3:	55                   	push   %ebp
+  8002e4:	89 e5                	mov    %esp,%ebp
+  8002e6:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002e9:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002ec:	50                   	push   %eax
+  8002ed:	ff 75 10             	push   0x10(%ebp)
+  8002f0:	ff 75 0c             	push   0xc(%ebp)
+  8002f3:	ff 75 08             	push   0x8(%ebp)
+  8002f6:	e8 05 00 00 00       	call   800300 <vprintfmt>
+}
+  8002fb:	83 c4 10             	add    $0x10,%esp
+  8002fe:	c9                   	leave
+  8002ff:	c3                   	ret
+
+00800300 <vprintfmt>:
+{
+  800300:	55                   	push   %ebp
+  800301:	89 e5                	mov    %esp,%ebp
+  800303:	57                   	push   %edi
+  800304:	56                   	push   %esi
+  800305:	53                   	push   %ebx
+  800306:	83 ec 2c             	sub    $0x2c,%esp
+  800309:	8b 75 08             	mov    0x8(%ebp),%esi
+  80030c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80030f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800312:	eb 0a                	jmp    80031e <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800314:	83 ec 08             	sub    $0x8,%esp
+  800317:	53                   	push   %ebx
+  800318:	50                   	push   %eax
+  800319:	ff d6                	call   *%esi
+  80031b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80031e:	83 c7 01             	add    $0x1,%edi
+  800321:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800325:	83 f8 25             	cmp    $0x25,%eax
+  800328:	74 0c                	je     800336 <vprintfmt+0x36>
+			if (ch == '\0')
+  80032a:	85 c0                	test   %eax,%eax
+  80032c:	75 e6                	jne    800314 <vprintfmt+0x14>
+}
+  80032e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800331:	5b                   	pop    %ebx
+  800332:	5e                   	pop    %esi
+  800333:	5f                   	pop    %edi
+  800334:	5d                   	pop    %ebp
+  800335:	c3                   	ret
+		padc = ' ';
+  800336:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80033a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800341:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800348:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80034f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800354:	8d 47 01             	lea    0x1(%edi),%eax
+  800357:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80035a:	0f b6 17             	movzbl (%edi),%edx
+  80035d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800360:	3c 55                	cmp    $0x55,%al
+  800362:	0f 87 cf 03 00 00    	ja     800737 <vprintfmt+0x437>
+  800368:	0f b6 c0             	movzbl %al,%eax
+  80036b:	ff 24 85 20 3c 80 00 	jmp    *0x803c20(,%eax,4)
+  800372:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800375:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800379:	eb d9                	jmp    800354 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80037b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80037e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800382:	eb d0                	jmp    800354 <vprintfmt+0x54>
+  800384:	0f b6 d2             	movzbl %dl,%edx
+  800387:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80038a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800392:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800395:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800399:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80039c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80039f:	83 f9 09             	cmp    $0x9,%ecx
+  8003a2:	77 55                	ja     8003f9 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003a4:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003a7:	eb e9                	jmp    800392 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ac:	8b 00                	mov    (%eax),%eax
+  8003ae:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8003b7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003bd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003c1:	79 91                	jns    800354 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003c3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003c9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003d0:	eb 82                	jmp    800354 <vprintfmt+0x54>
+			if (width < 0)
+  8003d2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003d5:	85 d2                	test   %edx,%edx
+  8003d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dc:	0f 49 c2             	cmovns %edx,%eax
+  8003df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003e5:	e9 6a ff ff ff       	jmp    800354 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003ed:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003f4:	e9 5b ff ff ff       	jmp    800354 <vprintfmt+0x54>
+  8003f9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003fc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ff:	eb bc                	jmp    8003bd <vprintfmt+0xbd>
+			lflag++;
+  800401:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800404:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800407:	e9 48 ff ff ff       	jmp    800354 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80040c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040f:	8d 78 04             	lea    0x4(%eax),%edi
+  800412:	83 ec 08             	sub    $0x8,%esp
+  800415:	53                   	push   %ebx
+  800416:	ff 30                	push   (%eax)
+  800418:	ff d6                	call   *%esi
+			break;
+  80041a:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80041d:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800420:	e9 b1 02 00 00       	jmp    8006d6 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800425:	8b 45 14             	mov    0x14(%ebp),%eax
+  800428:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80042b:	8b 10                	mov    (%eax),%edx
+  80042d:	89 d0                	mov    %edx,%eax
+  80042f:	f7 d8                	neg    %eax
+  800431:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800434:	83 f8 11             	cmp    $0x11,%eax
+  800437:	7f 23                	jg     80045c <vprintfmt+0x15c>
+  800439:	8b 14 85 80 3d 80 00 	mov    0x803d80(,%eax,4),%edx
+  800440:	85 d2                	test   %edx,%edx
+  800442:	74 18                	je     80045c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800444:	52                   	push   %edx
+  800445:	68 d2 3e 80 00       	push   $0x803ed2
+  80044a:	53                   	push   %ebx
+  80044b:	56                   	push   %esi
+  80044c:	e8 92 fe ff ff       	call   8002e3 <printfmt>
+  800451:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800454:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800457:	e9 7a 02 00 00       	jmp    8006d6 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80045c:	50                   	push   %eax
+  80045d:	68 de 3a 80 00       	push   $0x803ade
+  800462:	53                   	push   %ebx
+  800463:	56                   	push   %esi
+  800464:	e8 7a fe ff ff       	call   8002e3 <printfmt>
+  800469:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80046c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80046f:	e9 62 02 00 00       	jmp    8006d6 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800474:	8b 45 14             	mov    0x14(%ebp),%eax
+  800477:	83 c0 04             	add    $0x4,%eax
+  80047a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80047d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800480:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800482:	85 c9                	test   %ecx,%ecx
+  800484:	b8 d7 3a 80 00       	mov    $0x803ad7,%eax
+  800489:	0f 45 c1             	cmovne %ecx,%eax
+  80048c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80048f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800493:	7e 06                	jle    80049b <vprintfmt+0x19b>
+  800495:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800499:	75 0b                	jne    8004a6 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80049b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80049e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004a1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004a4:	eb 5c                	jmp    800502 <vprintfmt+0x202>
+  8004a6:	83 ec 08             	sub    $0x8,%esp
+  8004a9:	ff 75 d0             	push   -0x30(%ebp)
+  8004ac:	ff 75 cc             	push   -0x34(%ebp)
+  8004af:	e8 20 03 00 00       	call   8007d4 <strnlen>
+  8004b4:	89 c2                	mov    %eax,%edx
+  8004b6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b9:	29 d0                	sub    %edx,%eax
+  8004bb:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004be:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004c8:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ca:	eb 0e                	jmp    8004da <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004cc:	83 ec 08             	sub    $0x8,%esp
+  8004cf:	53                   	push   %ebx
+  8004d0:	57                   	push   %edi
+  8004d1:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d4:	83 ee 01             	sub    $0x1,%esi
+  8004d7:	83 c4 10             	add    $0x10,%esp
+  8004da:	85 f6                	test   %esi,%esi
+  8004dc:	7f ee                	jg     8004cc <vprintfmt+0x1cc>
+  8004de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e4:	85 c0                	test   %eax,%eax
+  8004e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004eb:	0f 49 d0             	cmovns %eax,%edx
+  8004ee:	29 d0                	sub    %edx,%eax
+  8004f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f3:	eb a6                	jmp    80049b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004f5:	83 ec 08             	sub    $0x8,%esp
+  8004f8:	53                   	push   %ebx
+  8004f9:	52                   	push   %edx
+  8004fa:	ff 55 08             	call   *0x8(%ebp)
+  8004fd:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800500:	89 f1                	mov    %esi,%ecx
+  800502:	8d 71 01             	lea    0x1(%ecx),%esi
+  800505:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800509:	0f be d0             	movsbl %al,%edx
+  80050c:	85 d2                	test   %edx,%edx
+  80050e:	74 28                	je     800538 <vprintfmt+0x238>
+  800510:	85 ff                	test   %edi,%edi
+  800512:	78 05                	js     800519 <vprintfmt+0x219>
+  800514:	83 ef 01             	sub    $0x1,%edi
+  800517:	78 30                	js     800549 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800519:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80051d:	74 d6                	je     8004f5 <vprintfmt+0x1f5>
+  80051f:	0f be c0             	movsbl %al,%eax
+  800522:	83 e8 20             	sub    $0x20,%eax
+  800525:	83 f8 5e             	cmp    $0x5e,%eax
+  800528:	76 cb                	jbe    8004f5 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80052a:	83 ec 08             	sub    $0x8,%esp
+  80052d:	53                   	push   %ebx
+  80052e:	6a 3f                	push   $0x3f
+  800530:	ff 55 08             	call   *0x8(%ebp)
+  800533:	83 c4 10             	add    $0x10,%esp
+  800536:	eb c8                	jmp    800500 <vprintfmt+0x200>
+  800538:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80053e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800541:	01 d0                	add    %edx,%eax
+  800543:	29 c8                	sub    %ecx,%eax
+  800545:	89 c7                	mov    %eax,%edi
+  800547:	eb 13                	jmp    80055c <vprintfmt+0x25c>
+  800549:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054c:	eb ed                	jmp    80053b <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80054e:	83 ec 08             	sub    $0x8,%esp
+  800551:	53                   	push   %ebx
+  800552:	6a 20                	push   $0x20
+  800554:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800556:	83 ef 01             	sub    $0x1,%edi
+  800559:	83 c4 10             	add    $0x10,%esp
+  80055c:	85 ff                	test   %edi,%edi
+  80055e:	7f ee                	jg     80054e <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800560:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800563:	89 45 14             	mov    %eax,0x14(%ebp)
+  800566:	e9 6b 01 00 00       	jmp    8006d6 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80056b:	83 f9 01             	cmp    $0x1,%ecx
+  80056e:	7f 1f                	jg     80058f <vprintfmt+0x28f>
+	else if (lflag)
+  800570:	85 c9                	test   %ecx,%ecx
+  800572:	74 67                	je     8005db <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800574:	8b 45 14             	mov    0x14(%ebp),%eax
+  800577:	8b 00                	mov    (%eax),%eax
+  800579:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80057c:	89 c1                	mov    %eax,%ecx
+  80057e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800581:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800584:	8b 45 14             	mov    0x14(%ebp),%eax
+  800587:	8d 40 04             	lea    0x4(%eax),%eax
+  80058a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80058d:	eb 17                	jmp    8005a6 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8b 50 04             	mov    0x4(%eax),%edx
+  800595:	8b 00                	mov    (%eax),%eax
+  800597:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80059a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80059d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a0:	8d 40 08             	lea    0x8(%eax),%eax
+  8005a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005a6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005a9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005ac:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005b1:	85 c9                	test   %ecx,%ecx
+  8005b3:	0f 89 03 01 00 00    	jns    8006bc <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005b9:	83 ec 08             	sub    $0x8,%esp
+  8005bc:	53                   	push   %ebx
+  8005bd:	6a 2d                	push   $0x2d
+  8005bf:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005c1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005c7:	f7 da                	neg    %edx
+  8005c9:	83 d1 00             	adc    $0x0,%ecx
+  8005cc:	f7 d9                	neg    %ecx
+  8005ce:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005d6:	e9 e1 00 00 00       	jmp    8006bc <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005de:	8b 00                	mov    (%eax),%eax
+  8005e0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e3:	89 c1                	mov    %eax,%ecx
+  8005e5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005e8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f4:	eb b0                	jmp    8005a6 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005f6:	83 f9 01             	cmp    $0x1,%ecx
+  8005f9:	7f 1e                	jg     800619 <vprintfmt+0x319>
+	else if (lflag)
+  8005fb:	85 c9                	test   %ecx,%ecx
+  8005fd:	74 32                	je     800631 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800602:	8b 10                	mov    (%eax),%edx
+  800604:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800609:	8d 40 04             	lea    0x4(%eax),%eax
+  80060c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80060f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800614:	e9 a3 00 00 00       	jmp    8006bc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800619:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061c:	8b 10                	mov    (%eax),%edx
+  80061e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800621:	8d 40 08             	lea    0x8(%eax),%eax
+  800624:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800627:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80062c:	e9 8b 00 00 00       	jmp    8006bc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800631:	8b 45 14             	mov    0x14(%ebp),%eax
+  800634:	8b 10                	mov    (%eax),%edx
+  800636:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80063b:	8d 40 04             	lea    0x4(%eax),%eax
+  80063e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800641:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800646:	eb 74                	jmp    8006bc <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800648:	83 f9 01             	cmp    $0x1,%ecx
+  80064b:	7f 1b                	jg     800668 <vprintfmt+0x368>
+	else if (lflag)
+  80064d:	85 c9                	test   %ecx,%ecx
+  80064f:	74 2c                	je     80067d <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800651:	8b 45 14             	mov    0x14(%ebp),%eax
+  800654:	8b 10                	mov    (%eax),%edx
+  800656:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065b:	8d 40 04             	lea    0x4(%eax),%eax
+  80065e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800661:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800666:	eb 54                	jmp    8006bc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800668:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066b:	8b 10                	mov    (%eax),%edx
+  80066d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800670:	8d 40 08             	lea    0x8(%eax),%eax
+  800673:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800676:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80067b:	eb 3f                	jmp    8006bc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80067d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800680:	8b 10                	mov    (%eax),%edx
+  800682:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800687:	8d 40 04             	lea    0x4(%eax),%eax
+  80068a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80068d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800692:	eb 28                	jmp    8006bc <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800694:	83 ec 08             	sub    $0x8,%esp
+  800697:	53                   	push   %ebx
+  800698:	6a 30                	push   $0x30
+  80069a:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80069c:	83 c4 08             	add    $0x8,%esp
+  80069f:	53                   	push   %ebx
+  8006a0:	6a 78                	push   $0x78
+  8006a2:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a7:	8b 10                	mov    (%eax),%edx
+  8006a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006ae:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b7:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006bc:	83 ec 0c             	sub    $0xc,%esp
+  8006bf:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006c3:	50                   	push   %eax
+  8006c4:	ff 75 e0             	push   -0x20(%ebp)
+  8006c7:	57                   	push   %edi
+  8006c8:	51                   	push   %ecx
+  8006c9:	52                   	push   %edx
+  8006ca:	89 da                	mov    %ebx,%edx
+  8006cc:	89 f0                	mov    %esi,%eax
+  8006ce:	e8 4a fb ff ff       	call   80021d <printnum>
+			break;
+  8006d3:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006d6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006d9:	e9 40 fc ff ff       	jmp    80031e <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006de:	83 f9 01             	cmp    $0x1,%ecx
+  8006e1:	7f 1b                	jg     8006fe <vprintfmt+0x3fe>
+	else if (lflag)
+  8006e3:	85 c9                	test   %ecx,%ecx
+  8006e5:	74 2c                	je     800713 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ea:	8b 10                	mov    (%eax),%edx
+  8006ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006fc:	eb be                	jmp    8006bc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 10                	mov    (%eax),%edx
+  800703:	8b 48 04             	mov    0x4(%eax),%ecx
+  800706:	8d 40 08             	lea    0x8(%eax),%eax
+  800709:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80070c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800711:	eb a9                	jmp    8006bc <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800713:	8b 45 14             	mov    0x14(%ebp),%eax
+  800716:	8b 10                	mov    (%eax),%edx
+  800718:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071d:	8d 40 04             	lea    0x4(%eax),%eax
+  800720:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800723:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800728:	eb 92                	jmp    8006bc <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80072a:	83 ec 08             	sub    $0x8,%esp
+  80072d:	53                   	push   %ebx
+  80072e:	6a 25                	push   $0x25
+  800730:	ff d6                	call   *%esi
+			break;
+  800732:	83 c4 10             	add    $0x10,%esp
+  800735:	eb 9f                	jmp    8006d6 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800737:	83 ec 08             	sub    $0x8,%esp
+  80073a:	53                   	push   %ebx
+  80073b:	6a 25                	push   $0x25
+  80073d:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80073f:	83 c4 10             	add    $0x10,%esp
+  800742:	89 f8                	mov    %edi,%eax
+  800744:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800748:	74 05                	je     80074f <vprintfmt+0x44f>
+  80074a:	83 e8 01             	sub    $0x1,%eax
+  80074d:	eb f5                	jmp    800744 <vprintfmt+0x444>
+  80074f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800752:	eb 82                	jmp    8006d6 <vprintfmt+0x3d6>
+
+00800754 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800754:	55                   	push   %ebp
+  800755:	89 e5                	mov    %esp,%ebp
+  800757:	83 ec 18             	sub    $0x18,%esp
+  80075a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80075d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800760:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800763:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800767:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80076a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800771:	85 c0                	test   %eax,%eax
+  800773:	74 26                	je     80079b <vsnprintf+0x47>
+  800775:	85 d2                	test   %edx,%edx
+  800777:	7e 22                	jle    80079b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800779:	ff 75 14             	push   0x14(%ebp)
+  80077c:	ff 75 10             	push   0x10(%ebp)
+  80077f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800782:	50                   	push   %eax
+  800783:	68 c6 02 80 00       	push   $0x8002c6
+  800788:	e8 73 fb ff ff       	call   800300 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80078d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800790:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800793:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800796:	83 c4 10             	add    $0x10,%esp
+}
+  800799:	c9                   	leave
+  80079a:	c3                   	ret
+		return -E_INVAL;
+  80079b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007a0:	eb f7                	jmp    800799 <vsnprintf+0x45>
+
+008007a2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007a2:	55                   	push   %ebp
+  8007a3:	89 e5                	mov    %esp,%ebp
+  8007a5:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007a8:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007ab:	50                   	push   %eax
+  8007ac:	ff 75 10             	push   0x10(%ebp)
+  8007af:	ff 75 0c             	push   0xc(%ebp)
+  8007b2:	ff 75 08             	push   0x8(%ebp)
+  8007b5:	e8 9a ff ff ff       	call   800754 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007ba:	c9                   	leave
+  8007bb:	c3                   	ret
+
+008007bc <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007bc:	55                   	push   %ebp
+  8007bd:	89 e5                	mov    %esp,%ebp
+  8007bf:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c7:	eb 03                	jmp    8007cc <strlen+0x10>
+		n++;
+  8007c9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007cc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007d0:	75 f7                	jne    8007c9 <strlen+0xd>
+	return n;
+}
+  8007d2:	5d                   	pop    %ebp
+  8007d3:	c3                   	ret
+
+008007d4 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007d4:	55                   	push   %ebp
+  8007d5:	89 e5                	mov    %esp,%ebp
+  8007d7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007da:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e2:	eb 03                	jmp    8007e7 <strnlen+0x13>
+		n++;
+  8007e4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007e7:	39 d0                	cmp    %edx,%eax
+  8007e9:	74 08                	je     8007f3 <strnlen+0x1f>
+  8007eb:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007ef:	75 f3                	jne    8007e4 <strnlen+0x10>
+  8007f1:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007f3:	89 d0                	mov    %edx,%eax
+  8007f5:	5d                   	pop    %ebp
+  8007f6:	c3                   	ret
+
+008007f7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007f7:	55                   	push   %ebp
+  8007f8:	89 e5                	mov    %esp,%ebp
+  8007fa:	53                   	push   %ebx
+  8007fb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800801:	b8 00 00 00 00       	mov    $0x0,%eax
+  800806:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80080a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80080d:	83 c0 01             	add    $0x1,%eax
+  800810:	84 d2                	test   %dl,%dl
+  800812:	75 f2                	jne    800806 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800814:	89 c8                	mov    %ecx,%eax
+  800816:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800819:	c9                   	leave
+  80081a:	c3                   	ret
+
+0080081b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80081b:	55                   	push   %ebp
+  80081c:	89 e5                	mov    %esp,%ebp
+  80081e:	53                   	push   %ebx
+  80081f:	83 ec 10             	sub    $0x10,%esp
+  800822:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800825:	53                   	push   %ebx
+  800826:	e8 91 ff ff ff       	call   8007bc <strlen>
+  80082b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80082e:	ff 75 0c             	push   0xc(%ebp)
+  800831:	01 d8                	add    %ebx,%eax
+  800833:	50                   	push   %eax
+  800834:	e8 be ff ff ff       	call   8007f7 <strcpy>
+	return dst;
+}
+  800839:	89 d8                	mov    %ebx,%eax
+  80083b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083e:	c9                   	leave
+  80083f:	c3                   	ret
+
+00800840 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800840:	55                   	push   %ebp
+  800841:	89 e5                	mov    %esp,%ebp
+  800843:	56                   	push   %esi
+  800844:	53                   	push   %ebx
+  800845:	8b 75 08             	mov    0x8(%ebp),%esi
+  800848:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80084b:	89 f3                	mov    %esi,%ebx
+  80084d:	03 5d 10             	add    0x10(%ebp),%ebx
+  800850:	89 f0                	mov    %esi,%eax
+  800852:	eb 0f                	jmp    800863 <strncpy+0x23>
+		*dst++ = *src;
+  800854:	83 c0 01             	add    $0x1,%eax
+  800857:	0f b6 0a             	movzbl (%edx),%ecx
+  80085a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80085d:	80 f9 01             	cmp    $0x1,%cl
+  800860:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800863:	39 d8                	cmp    %ebx,%eax
+  800865:	75 ed                	jne    800854 <strncpy+0x14>
+	}
+	return ret;
+}
+  800867:	89 f0                	mov    %esi,%eax
+  800869:	5b                   	pop    %ebx
+  80086a:	5e                   	pop    %esi
+  80086b:	5d                   	pop    %ebp
+  80086c:	c3                   	ret
+
+0080086d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80086d:	55                   	push   %ebp
+  80086e:	89 e5                	mov    %esp,%ebp
+  800870:	56                   	push   %esi
+  800871:	53                   	push   %ebx
+  800872:	8b 75 08             	mov    0x8(%ebp),%esi
+  800875:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800878:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80087b:	89 f0                	mov    %esi,%eax
+  80087d:	85 d2                	test   %edx,%edx
+  80087f:	74 21                	je     8008a2 <strlcpy+0x35>
+  800881:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800885:	89 f2                	mov    %esi,%edx
+  800887:	eb 09                	jmp    800892 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800889:	83 c1 01             	add    $0x1,%ecx
+  80088c:	83 c2 01             	add    $0x1,%edx
+  80088f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800892:	39 c2                	cmp    %eax,%edx
+  800894:	74 09                	je     80089f <strlcpy+0x32>
+  800896:	0f b6 19             	movzbl (%ecx),%ebx
+  800899:	84 db                	test   %bl,%bl
+  80089b:	75 ec                	jne    800889 <strlcpy+0x1c>
+  80089d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80089f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008a2:	29 f0                	sub    %esi,%eax
+}
+  8008a4:	5b                   	pop    %ebx
+  8008a5:	5e                   	pop    %esi
+  8008a6:	5d                   	pop    %ebp
+  8008a7:	c3                   	ret
+
+008008a8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008a8:	55                   	push   %ebp
+  8008a9:	89 e5                	mov    %esp,%ebp
+  8008ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008b1:	eb 06                	jmp    8008b9 <strcmp+0x11>
+		p++, q++;
+  8008b3:	83 c1 01             	add    $0x1,%ecx
+  8008b6:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008b9:	0f b6 01             	movzbl (%ecx),%eax
+  8008bc:	84 c0                	test   %al,%al
+  8008be:	74 04                	je     8008c4 <strcmp+0x1c>
+  8008c0:	3a 02                	cmp    (%edx),%al
+  8008c2:	74 ef                	je     8008b3 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008c4:	0f b6 c0             	movzbl %al,%eax
+  8008c7:	0f b6 12             	movzbl (%edx),%edx
+  8008ca:	29 d0                	sub    %edx,%eax
+}
+  8008cc:	5d                   	pop    %ebp
+  8008cd:	c3                   	ret
+
+008008ce <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008ce:	55                   	push   %ebp
+  8008cf:	89 e5                	mov    %esp,%ebp
+  8008d1:	53                   	push   %ebx
+  8008d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d8:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008db:	eb 09                	jmp    8008e6 <strncmp+0x18>
+		n--, p++, q++;
+  8008dd:	83 ea 01             	sub    $0x1,%edx
+  8008e0:	83 c0 01             	add    $0x1,%eax
+  8008e3:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008e6:	85 d2                	test   %edx,%edx
+  8008e8:	74 18                	je     800902 <strncmp+0x34>
+  8008ea:	0f b6 18             	movzbl (%eax),%ebx
+  8008ed:	84 db                	test   %bl,%bl
+  8008ef:	74 04                	je     8008f5 <strncmp+0x27>
+  8008f1:	3a 19                	cmp    (%ecx),%bl
+  8008f3:	74 e8                	je     8008dd <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008f5:	0f b6 00             	movzbl (%eax),%eax
+  8008f8:	0f b6 11             	movzbl (%ecx),%edx
+  8008fb:	29 d0                	sub    %edx,%eax
+}
+  8008fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800900:	c9                   	leave
+  800901:	c3                   	ret
+		return 0;
+  800902:	b8 00 00 00 00       	mov    $0x0,%eax
+  800907:	eb f4                	jmp    8008fd <strncmp+0x2f>
+
+00800909 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800909:	55                   	push   %ebp
+  80090a:	89 e5                	mov    %esp,%ebp
+  80090c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800913:	eb 03                	jmp    800918 <strchr+0xf>
+  800915:	83 c0 01             	add    $0x1,%eax
+  800918:	0f b6 10             	movzbl (%eax),%edx
+  80091b:	84 d2                	test   %dl,%dl
+  80091d:	74 06                	je     800925 <strchr+0x1c>
+		if (*s == c)
+  80091f:	38 ca                	cmp    %cl,%dl
+  800921:	75 f2                	jne    800915 <strchr+0xc>
+  800923:	eb 05                	jmp    80092a <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800925:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80092a:	5d                   	pop    %ebp
+  80092b:	c3                   	ret
+
+0080092c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80092c:	55                   	push   %ebp
+  80092d:	89 e5                	mov    %esp,%ebp
+  80092f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800932:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800936:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800939:	38 ca                	cmp    %cl,%dl
+  80093b:	74 09                	je     800946 <strfind+0x1a>
+  80093d:	84 d2                	test   %dl,%dl
+  80093f:	74 05                	je     800946 <strfind+0x1a>
+	for (; *s; s++)
+  800941:	83 c0 01             	add    $0x1,%eax
+  800944:	eb f0                	jmp    800936 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800946:	5d                   	pop    %ebp
+  800947:	c3                   	ret
+
+00800948 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800948:	55                   	push   %ebp
+  800949:	89 e5                	mov    %esp,%ebp
+  80094b:	57                   	push   %edi
+  80094c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80094f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800952:	85 c9                	test   %ecx,%ecx
+  800954:	74 20                	je     800976 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800956:	89 f8                	mov    %edi,%eax
+  800958:	09 c8                	or     %ecx,%eax
+  80095a:	a8 03                	test   $0x3,%al
+  80095c:	75 12                	jne    800970 <memset+0x28>
+		c &= 0xFF;
+  80095e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800962:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800968:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80096b:	fc                   	cld
+  80096c:	f3 ab                	rep stos %eax,%es:(%edi)
+  80096e:	eb 06                	jmp    800976 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800970:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800973:	fc                   	cld
+  800974:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800976:	89 f8                	mov    %edi,%eax
+  800978:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80097b:	c9                   	leave
+  80097c:	c3                   	ret
+
+0080097d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80097d:	55                   	push   %ebp
+  80097e:	89 e5                	mov    %esp,%ebp
+  800980:	57                   	push   %edi
+  800981:	56                   	push   %esi
+  800982:	8b 45 08             	mov    0x8(%ebp),%eax
+  800985:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800988:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80098b:	39 c6                	cmp    %eax,%esi
+  80098d:	73 32                	jae    8009c1 <memmove+0x44>
+  80098f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800992:	39 d0                	cmp    %edx,%eax
+  800994:	73 2b                	jae    8009c1 <memmove+0x44>
+		s += n;
+		d += n;
+  800996:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800999:	89 d6                	mov    %edx,%esi
+  80099b:	09 fe                	or     %edi,%esi
+  80099d:	09 ce                	or     %ecx,%esi
+  80099f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009a5:	75 0e                	jne    8009b5 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009a7:	83 ef 04             	sub    $0x4,%edi
+  8009aa:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009ad:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009b0:	fd                   	std
+  8009b1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009b3:	eb 09                	jmp    8009be <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009b5:	83 ef 01             	sub    $0x1,%edi
+  8009b8:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009bb:	fd                   	std
+  8009bc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009be:	fc                   	cld
+  8009bf:	eb 1a                	jmp    8009db <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009c1:	89 f2                	mov    %esi,%edx
+  8009c3:	09 c2                	or     %eax,%edx
+  8009c5:	09 ca                	or     %ecx,%edx
+  8009c7:	f6 c2 03             	test   $0x3,%dl
+  8009ca:	75 0a                	jne    8009d6 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009cc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009cf:	89 c7                	mov    %eax,%edi
+  8009d1:	fc                   	cld
+  8009d2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009d4:	eb 05                	jmp    8009db <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009d6:	89 c7                	mov    %eax,%edi
+  8009d8:	fc                   	cld
+  8009d9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009db:	5e                   	pop    %esi
+  8009dc:	5f                   	pop    %edi
+  8009dd:	5d                   	pop    %ebp
+  8009de:	c3                   	ret
+
+008009df <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009df:	55                   	push   %ebp
+  8009e0:	89 e5                	mov    %esp,%ebp
+  8009e2:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009e5:	ff 75 10             	push   0x10(%ebp)
+  8009e8:	ff 75 0c             	push   0xc(%ebp)
+  8009eb:	ff 75 08             	push   0x8(%ebp)
+  8009ee:	e8 8a ff ff ff       	call   80097d <memmove>
+}
+  8009f3:	c9                   	leave
+  8009f4:	c3                   	ret
+
+008009f5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009f5:	55                   	push   %ebp
+  8009f6:	89 e5                	mov    %esp,%ebp
+  8009f8:	56                   	push   %esi
+  8009f9:	53                   	push   %ebx
+  8009fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a00:	89 c6                	mov    %eax,%esi
+  800a02:	03 75 10             	add    0x10(%ebp),%esi
+  800a05:	eb 06                	jmp    800a0d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a07:	83 c0 01             	add    $0x1,%eax
+  800a0a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a0d:	39 f0                	cmp    %esi,%eax
+  800a0f:	74 14                	je     800a25 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a11:	0f b6 08             	movzbl (%eax),%ecx
+  800a14:	0f b6 1a             	movzbl (%edx),%ebx
+  800a17:	38 d9                	cmp    %bl,%cl
+  800a19:	74 ec                	je     800a07 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a1b:	0f b6 c1             	movzbl %cl,%eax
+  800a1e:	0f b6 db             	movzbl %bl,%ebx
+  800a21:	29 d8                	sub    %ebx,%eax
+  800a23:	eb 05                	jmp    800a2a <memcmp+0x35>
+	}
+
+	return 0;
+  800a25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a2a:	5b                   	pop    %ebx
+  800a2b:	5e                   	pop    %esi
+  800a2c:	5d                   	pop    %ebp
+  800a2d:	c3                   	ret
+
+00800a2e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a2e:	55                   	push   %ebp
+  800a2f:	89 e5                	mov    %esp,%ebp
+  800a31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a37:	89 c2                	mov    %eax,%edx
+  800a39:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a3c:	eb 03                	jmp    800a41 <memfind+0x13>
+  800a3e:	83 c0 01             	add    $0x1,%eax
+  800a41:	39 d0                	cmp    %edx,%eax
+  800a43:	73 04                	jae    800a49 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a45:	38 08                	cmp    %cl,(%eax)
+  800a47:	75 f5                	jne    800a3e <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a49:	5d                   	pop    %ebp
+  800a4a:	c3                   	ret
+
+00800a4b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a4b:	55                   	push   %ebp
+  800a4c:	89 e5                	mov    %esp,%ebp
+  800a4e:	57                   	push   %edi
+  800a4f:	56                   	push   %esi
+  800a50:	53                   	push   %ebx
+  800a51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a57:	eb 03                	jmp    800a5c <strtol+0x11>
+		s++;
+  800a59:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a5c:	0f b6 02             	movzbl (%edx),%eax
+  800a5f:	3c 20                	cmp    $0x20,%al
+  800a61:	74 f6                	je     800a59 <strtol+0xe>
+  800a63:	3c 09                	cmp    $0x9,%al
+  800a65:	74 f2                	je     800a59 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a67:	3c 2b                	cmp    $0x2b,%al
+  800a69:	74 2a                	je     800a95 <strtol+0x4a>
+	int neg = 0;
+  800a6b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a70:	3c 2d                	cmp    $0x2d,%al
+  800a72:	74 2b                	je     800a9f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a74:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a7a:	75 0f                	jne    800a8b <strtol+0x40>
+  800a7c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a7f:	74 28                	je     800aa9 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a81:	85 db                	test   %ebx,%ebx
+  800a83:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a88:	0f 44 d8             	cmove  %eax,%ebx
+  800a8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a90:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a93:	eb 46                	jmp    800adb <strtol+0x90>
+		s++;
+  800a95:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a98:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a9d:	eb d5                	jmp    800a74 <strtol+0x29>
+		s++, neg = 1;
+  800a9f:	83 c2 01             	add    $0x1,%edx
+  800aa2:	bf 01 00 00 00       	mov    $0x1,%edi
+  800aa7:	eb cb                	jmp    800a74 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800aad:	74 0e                	je     800abd <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800aaf:	85 db                	test   %ebx,%ebx
+  800ab1:	75 d8                	jne    800a8b <strtol+0x40>
+		s++, base = 8;
+  800ab3:	83 c2 01             	add    $0x1,%edx
+  800ab6:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800abb:	eb ce                	jmp    800a8b <strtol+0x40>
+		s += 2, base = 16;
+  800abd:	83 c2 02             	add    $0x2,%edx
+  800ac0:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ac5:	eb c4                	jmp    800a8b <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ac7:	0f be c0             	movsbl %al,%eax
+  800aca:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800acd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ad0:	7d 3a                	jge    800b0c <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ad2:	83 c2 01             	add    $0x1,%edx
+  800ad5:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ad9:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800adb:	0f b6 02             	movzbl (%edx),%eax
+  800ade:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ae1:	89 f3                	mov    %esi,%ebx
+  800ae3:	80 fb 09             	cmp    $0x9,%bl
+  800ae6:	76 df                	jbe    800ac7 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ae8:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800aeb:	89 f3                	mov    %esi,%ebx
+  800aed:	80 fb 19             	cmp    $0x19,%bl
+  800af0:	77 08                	ja     800afa <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800af2:	0f be c0             	movsbl %al,%eax
+  800af5:	83 e8 57             	sub    $0x57,%eax
+  800af8:	eb d3                	jmp    800acd <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800afa:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800afd:	89 f3                	mov    %esi,%ebx
+  800aff:	80 fb 19             	cmp    $0x19,%bl
+  800b02:	77 08                	ja     800b0c <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b04:	0f be c0             	movsbl %al,%eax
+  800b07:	83 e8 37             	sub    $0x37,%eax
+  800b0a:	eb c1                	jmp    800acd <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b0c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b10:	74 05                	je     800b17 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b15:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b17:	89 c8                	mov    %ecx,%eax
+  800b19:	f7 d8                	neg    %eax
+  800b1b:	85 ff                	test   %edi,%edi
+  800b1d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b20:	89 c8                	mov    %ecx,%eax
+  800b22:	5b                   	pop    %ebx
+  800b23:	5e                   	pop    %esi
+  800b24:	5f                   	pop    %edi
+  800b25:	5d                   	pop    %ebp
+  800b26:	c3                   	ret
+
+00800b27 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b27:	55                   	push   %ebp
+  800b28:	89 e5                	mov    %esp,%ebp
+  800b2a:	57                   	push   %edi
+  800b2b:	56                   	push   %esi
+  800b2c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b38:	89 c3                	mov    %eax,%ebx
+  800b3a:	89 c7                	mov    %eax,%edi
+  800b3c:	55                   	push   %ebp
+  800b3d:	89 e5                	mov    %esp,%ebp
+  800b3f:	8d 35 47 0b 80 00    	lea    0x800b47,%esi
+  800b45:	0f 34                	sysenter
+  800b47:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800b48:	5b                   	pop    %ebx
+  800b49:	5e                   	pop    %esi
+  800b4a:	5f                   	pop    %edi
+  800b4b:	5d                   	pop    %ebp
+  800b4c:	c3                   	ret
+
+00800b4d <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b4d:	55                   	push   %ebp
+  800b4e:	89 e5                	mov    %esp,%ebp
+  800b50:	57                   	push   %edi
+  800b51:	56                   	push   %esi
+  800b52:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b58:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b5d:	89 d1                	mov    %edx,%ecx
+  800b5f:	89 d3                	mov    %edx,%ebx
+  800b61:	89 d7                	mov    %edx,%edi
+  800b63:	55                   	push   %ebp
+  800b64:	89 e5                	mov    %esp,%ebp
+  800b66:	8d 35 6e 0b 80 00    	lea    0x800b6e,%esi
+  800b6c:	0f 34                	sysenter
+  800b6e:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800b6f:	5b                   	pop    %ebx
+  800b70:	5e                   	pop    %esi
+  800b71:	5f                   	pop    %edi
+  800b72:	5d                   	pop    %ebp
+  800b73:	c3                   	ret
+
+00800b74 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b74:	55                   	push   %ebp
+  800b75:	89 e5                	mov    %esp,%ebp
+  800b77:	57                   	push   %edi
+  800b78:	56                   	push   %esi
+  800b79:	53                   	push   %ebx
+  800b7a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b85:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b8a:	89 cb                	mov    %ecx,%ebx
+  800b8c:	89 cf                	mov    %ecx,%edi
+  800b8e:	55                   	push   %ebp
+  800b8f:	89 e5                	mov    %esp,%ebp
+  800b91:	8d 35 99 0b 80 00    	lea    0x800b99,%esi
+  800b97:	0f 34                	sysenter
+  800b99:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b9a:	85 c0                	test   %eax,%eax
+  800b9c:	7f 08                	jg     800ba6 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800b9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba1:	5b                   	pop    %ebx
+  800ba2:	5e                   	pop    %esi
+  800ba3:	5f                   	pop    %edi
+  800ba4:	5d                   	pop    %ebp
+  800ba5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ba6:	83 ec 0c             	sub    $0xc,%esp
+  800ba9:	50                   	push   %eax
+  800baa:	6a 03                	push   $0x3
+  800bac:	68 e7 3d 80 00       	push   $0x803de7
+  800bb1:	6a 3d                	push   $0x3d
+  800bb3:	68 04 3e 80 00       	push   $0x803e04
+  800bb8:	e8 65 26 00 00       	call   803222 <_panic>
+
+00800bbd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bbd:	55                   	push   %ebp
+  800bbe:	89 e5                	mov    %esp,%ebp
+  800bc0:	57                   	push   %edi
+  800bc1:	56                   	push   %esi
+  800bc2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800bc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bc8:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bcd:	89 d1                	mov    %edx,%ecx
+  800bcf:	89 d3                	mov    %edx,%ebx
+  800bd1:	89 d7                	mov    %edx,%edi
+  800bd3:	55                   	push   %ebp
+  800bd4:	89 e5                	mov    %esp,%ebp
+  800bd6:	8d 35 de 0b 80 00    	lea    0x800bde,%esi
+  800bdc:	0f 34                	sysenter
+  800bde:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800bdf:	5b                   	pop    %ebx
+  800be0:	5e                   	pop    %esi
+  800be1:	5f                   	pop    %edi
+  800be2:	5d                   	pop    %ebp
+  800be3:	c3                   	ret
+
+00800be4 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800be4:	55                   	push   %ebp
+  800be5:	89 e5                	mov    %esp,%ebp
+  800be7:	57                   	push   %edi
+  800be8:	56                   	push   %esi
+  800be9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bef:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bf4:	89 d1                	mov    %edx,%ecx
+  800bf6:	89 d3                	mov    %edx,%ebx
+  800bf8:	89 d7                	mov    %edx,%edi
+  800bfa:	89 d6                	mov    %edx,%esi
+  800bfc:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bfe:	5b                   	pop    %ebx
+  800bff:	5e                   	pop    %esi
+  800c00:	5f                   	pop    %edi
+  800c01:	5d                   	pop    %ebp
+  800c02:	c3                   	ret
+
+00800c03 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c03:	55                   	push   %ebp
+  800c04:	89 e5                	mov    %esp,%ebp
+  800c06:	57                   	push   %edi
+  800c07:	56                   	push   %esi
+  800c08:	53                   	push   %ebx
+  800c09:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c12:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c17:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c1f:	55                   	push   %ebp
+  800c20:	89 e5                	mov    %esp,%ebp
+  800c22:	8d 35 2a 0c 80 00    	lea    0x800c2a,%esi
+  800c28:	0f 34                	sysenter
+  800c2a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c2b:	85 c0                	test   %eax,%eax
+  800c2d:	7f 08                	jg     800c37 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800c2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c32:	5b                   	pop    %ebx
+  800c33:	5e                   	pop    %esi
+  800c34:	5f                   	pop    %edi
+  800c35:	5d                   	pop    %ebp
+  800c36:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c37:	83 ec 0c             	sub    $0xc,%esp
+  800c3a:	50                   	push   %eax
+  800c3b:	6a 04                	push   $0x4
+  800c3d:	68 e7 3d 80 00       	push   $0x803de7
+  800c42:	6a 3d                	push   $0x3d
+  800c44:	68 04 3e 80 00       	push   $0x803e04
+  800c49:	e8 d4 25 00 00       	call   803222 <_panic>
+
+00800c4e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c4e:	55                   	push   %ebp
+  800c4f:	89 e5                	mov    %esp,%ebp
+  800c51:	57                   	push   %edi
+  800c52:	56                   	push   %esi
+  800c53:	53                   	push   %ebx
+  800c54:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c62:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c65:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c68:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c6b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c6d:	85 c0                	test   %eax,%eax
+  800c6f:	7f 08                	jg     800c79 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c74:	5b                   	pop    %ebx
+  800c75:	5e                   	pop    %esi
+  800c76:	5f                   	pop    %edi
+  800c77:	5d                   	pop    %ebp
+  800c78:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c79:	83 ec 0c             	sub    $0xc,%esp
+  800c7c:	50                   	push   %eax
+  800c7d:	6a 05                	push   $0x5
+  800c7f:	68 e7 3d 80 00       	push   $0x803de7
+  800c84:	6a 23                	push   $0x23
+  800c86:	68 04 3e 80 00       	push   $0x803e04
+  800c8b:	e8 92 25 00 00       	call   803222 <_panic>
+
+00800c90 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c90:	55                   	push   %ebp
+  800c91:	89 e5                	mov    %esp,%ebp
+  800c93:	57                   	push   %edi
+  800c94:	56                   	push   %esi
+  800c95:	53                   	push   %ebx
+  800c96:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca4:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ca9:	89 df                	mov    %ebx,%edi
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	8d 35 b6 0c 80 00    	lea    0x800cb6,%esi
+  800cb4:	0f 34                	sysenter
+  800cb6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cb7:	85 c0                	test   %eax,%eax
+  800cb9:	7f 08                	jg     800cc3 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800cbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbe:	5b                   	pop    %ebx
+  800cbf:	5e                   	pop    %esi
+  800cc0:	5f                   	pop    %edi
+  800cc1:	5d                   	pop    %ebp
+  800cc2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cc3:	83 ec 0c             	sub    $0xc,%esp
+  800cc6:	50                   	push   %eax
+  800cc7:	6a 06                	push   $0x6
+  800cc9:	68 e7 3d 80 00       	push   $0x803de7
+  800cce:	6a 3d                	push   $0x3d
+  800cd0:	68 04 3e 80 00       	push   $0x803e04
+  800cd5:	e8 48 25 00 00       	call   803222 <_panic>
+
+00800cda <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800cda:	55                   	push   %ebp
+  800cdb:	89 e5                	mov    %esp,%ebp
+  800cdd:	57                   	push   %edi
+  800cde:	56                   	push   %esi
+  800cdf:	53                   	push   %ebx
+  800ce0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ce3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ceb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cee:	b8 08 00 00 00       	mov    $0x8,%eax
+  800cf3:	89 df                	mov    %ebx,%edi
+  800cf5:	55                   	push   %ebp
+  800cf6:	89 e5                	mov    %esp,%ebp
+  800cf8:	8d 35 00 0d 80 00    	lea    0x800d00,%esi
+  800cfe:	0f 34                	sysenter
+  800d00:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d01:	85 c0                	test   %eax,%eax
+  800d03:	7f 08                	jg     800d0d <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800d05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d08:	5b                   	pop    %ebx
+  800d09:	5e                   	pop    %esi
+  800d0a:	5f                   	pop    %edi
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d0d:	83 ec 0c             	sub    $0xc,%esp
+  800d10:	50                   	push   %eax
+  800d11:	6a 08                	push   $0x8
+  800d13:	68 e7 3d 80 00       	push   $0x803de7
+  800d18:	6a 3d                	push   $0x3d
+  800d1a:	68 04 3e 80 00       	push   $0x803e04
+  800d1f:	e8 fe 24 00 00       	call   803222 <_panic>
+
+00800d24 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d24:	55                   	push   %ebp
+  800d25:	89 e5                	mov    %esp,%ebp
+  800d27:	57                   	push   %edi
+  800d28:	56                   	push   %esi
+  800d29:	53                   	push   %ebx
+  800d2a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d38:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d3d:	89 df                	mov    %ebx,%edi
+  800d3f:	55                   	push   %ebp
+  800d40:	89 e5                	mov    %esp,%ebp
+  800d42:	8d 35 4a 0d 80 00    	lea    0x800d4a,%esi
+  800d48:	0f 34                	sysenter
+  800d4a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d4b:	85 c0                	test   %eax,%eax
+  800d4d:	7f 08                	jg     800d57 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800d4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d52:	5b                   	pop    %ebx
+  800d53:	5e                   	pop    %esi
+  800d54:	5f                   	pop    %edi
+  800d55:	5d                   	pop    %ebp
+  800d56:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d57:	83 ec 0c             	sub    $0xc,%esp
+  800d5a:	50                   	push   %eax
+  800d5b:	6a 09                	push   $0x9
+  800d5d:	68 e7 3d 80 00       	push   $0x803de7
+  800d62:	6a 3d                	push   $0x3d
+  800d64:	68 04 3e 80 00       	push   $0x803e04
+  800d69:	e8 b4 24 00 00       	call   803222 <_panic>
+
+00800d6e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d6e:	55                   	push   %ebp
+  800d6f:	89 e5                	mov    %esp,%ebp
+  800d71:	57                   	push   %edi
+  800d72:	56                   	push   %esi
+  800d73:	53                   	push   %ebx
+  800d74:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d82:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d87:	89 df                	mov    %ebx,%edi
+  800d89:	55                   	push   %ebp
+  800d8a:	89 e5                	mov    %esp,%ebp
+  800d8c:	8d 35 94 0d 80 00    	lea    0x800d94,%esi
+  800d92:	0f 34                	sysenter
+  800d94:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d95:	85 c0                	test   %eax,%eax
+  800d97:	7f 08                	jg     800da1 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800d99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9c:	5b                   	pop    %ebx
+  800d9d:	5e                   	pop    %esi
+  800d9e:	5f                   	pop    %edi
+  800d9f:	5d                   	pop    %ebp
+  800da0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da1:	83 ec 0c             	sub    $0xc,%esp
+  800da4:	50                   	push   %eax
+  800da5:	6a 0a                	push   $0xa
+  800da7:	68 e7 3d 80 00       	push   $0x803de7
+  800dac:	6a 3d                	push   $0x3d
+  800dae:	68 04 3e 80 00       	push   $0x803e04
+  800db3:	e8 6a 24 00 00       	call   803222 <_panic>
+
+00800db8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800db8:	55                   	push   %ebp
+  800db9:	89 e5                	mov    %esp,%ebp
+  800dbb:	57                   	push   %edi
+  800dbc:	56                   	push   %esi
+  800dbd:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800dbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800dc9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dcc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dcf:	55                   	push   %ebp
+  800dd0:	89 e5                	mov    %esp,%ebp
+  800dd2:	8d 35 da 0d 80 00    	lea    0x800dda,%esi
+  800dd8:	0f 34                	sysenter
+  800dda:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800ddb:	5b                   	pop    %ebx
+  800ddc:	5e                   	pop    %esi
+  800ddd:	5f                   	pop    %edi
+  800dde:	5d                   	pop    %ebp
+  800ddf:	c3                   	ret
+
+00800de0 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800de0:	55                   	push   %ebp
+  800de1:	89 e5                	mov    %esp,%ebp
+  800de3:	57                   	push   %edi
+  800de4:	56                   	push   %esi
+  800de5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800de6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dec:	b8 17 00 00 00       	mov    $0x17,%eax
+  800df1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800df7:	55                   	push   %ebp
+  800df8:	89 e5                	mov    %esp,%ebp
+  800dfa:	8d 35 02 0e 80 00    	lea    0x800e02,%esi
+  800e00:	0f 34                	sysenter
+  800e02:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800e03:	5b                   	pop    %ebx
+  800e04:	5e                   	pop    %esi
+  800e05:	5f                   	pop    %edi
+  800e06:	5d                   	pop    %ebp
+  800e07:	c3                   	ret
+
+00800e08 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800e08:	55                   	push   %ebp
+  800e09:	89 e5                	mov    %esp,%ebp
+  800e0b:	57                   	push   %edi
+  800e0c:	56                   	push   %esi
+  800e0d:	53                   	push   %ebx
+  800e0e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e11:	be 00 00 00 00       	mov    $0x0,%esi
+  800e16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e24:	89 f7                	mov    %esi,%edi
+  800e26:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e28:	85 c0                	test   %eax,%eax
+  800e2a:	7f 08                	jg     800e34 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800e2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2f:	5b                   	pop    %ebx
+  800e30:	5e                   	pop    %esi
+  800e31:	5f                   	pop    %edi
+  800e32:	5d                   	pop    %ebp
+  800e33:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e34:	83 ec 0c             	sub    $0xc,%esp
+  800e37:	50                   	push   %eax
+  800e38:	6a 0d                	push   $0xd
+  800e3a:	68 e7 3d 80 00       	push   $0x803de7
+  800e3f:	6a 23                	push   $0x23
+  800e41:	68 04 3e 80 00       	push   $0x803e04
+  800e46:	e8 d7 23 00 00       	call   803222 <_panic>
+
+00800e4b <sys_ipc_recv>:
+{
+  800e4b:	55                   	push   %ebp
+  800e4c:	89 e5                	mov    %esp,%ebp
+  800e4e:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800e51:	6a 00                	push   $0x0
+  800e53:	6a 01                	push   $0x1
+  800e55:	ff 75 08             	push   0x8(%ebp)
+  800e58:	e8 ab ff ff ff       	call   800e08 <sys_ipc_recvv>
+}
+  800e5d:	c9                   	leave
+  800e5e:	c3                   	ret
+
+00800e5f <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800e5f:	55                   	push   %ebp
+  800e60:	89 e5                	mov    %esp,%ebp
+  800e62:	57                   	push   %edi
+  800e63:	56                   	push   %esi
+  800e64:	53                   	push   %ebx
+  800e65:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e73:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e78:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e7b:	89 de                	mov    %ebx,%esi
+  800e7d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e7f:	85 c0                	test   %eax,%eax
+  800e81:	7f 08                	jg     800e8b <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800e83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e86:	5b                   	pop    %ebx
+  800e87:	5e                   	pop    %esi
+  800e88:	5f                   	pop    %edi
+  800e89:	5d                   	pop    %ebp
+  800e8a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8b:	83 ec 0c             	sub    $0xc,%esp
+  800e8e:	50                   	push   %eax
+  800e8f:	6a 0d                	push   $0xd
+  800e91:	68 e7 3d 80 00       	push   $0x803de7
+  800e96:	6a 23                	push   $0x23
+  800e98:	68 04 3e 80 00       	push   $0x803e04
+  800e9d:	e8 80 23 00 00       	call   803222 <_panic>
+
+00800ea2 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ea2:	55                   	push   %ebp
+  800ea3:	89 e5                	mov    %esp,%ebp
+  800ea5:	57                   	push   %edi
+  800ea6:	56                   	push   %esi
+  800ea7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ea8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ead:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800eb2:	89 d1                	mov    %edx,%ecx
+  800eb4:	89 d3                	mov    %edx,%ebx
+  800eb6:	89 d7                	mov    %edx,%edi
+  800eb8:	55                   	push   %ebp
+  800eb9:	89 e5                	mov    %esp,%ebp
+  800ebb:	8d 35 c3 0e 80 00    	lea    0x800ec3,%esi
+  800ec1:	0f 34                	sysenter
+  800ec3:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800ec4:	5b                   	pop    %ebx
+  800ec5:	5e                   	pop    %esi
+  800ec6:	5f                   	pop    %edi
+  800ec7:	5d                   	pop    %ebp
+  800ec8:	c3                   	ret
+
+00800ec9 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800ec9:	55                   	push   %ebp
+  800eca:	89 e5                	mov    %esp,%ebp
+  800ecc:	57                   	push   %edi
+  800ecd:	56                   	push   %esi
+  800ece:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ecf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eda:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800edf:	89 df                	mov    %ebx,%edi
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	8d 35 ec 0e 80 00    	lea    0x800eec,%esi
+  800eea:	0f 34                	sysenter
+  800eec:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800eed:	5b                   	pop    %ebx
+  800eee:	5e                   	pop    %esi
+  800eef:	5f                   	pop    %edi
+  800ef0:	5d                   	pop    %ebp
+  800ef1:	c3                   	ret
+
+00800ef2 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800ef2:	55                   	push   %ebp
+  800ef3:	89 e5                	mov    %esp,%ebp
+  800ef5:	57                   	push   %edi
+  800ef6:	56                   	push   %esi
+  800ef7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ef8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800efd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f00:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f05:	89 cb                	mov    %ecx,%ebx
+  800f07:	89 cf                	mov    %ecx,%edi
+  800f09:	55                   	push   %ebp
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	8d 35 14 0f 80 00    	lea    0x800f14,%esi
+  800f12:	0f 34                	sysenter
+  800f14:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800f15:	5b                   	pop    %ebx
+  800f16:	5e                   	pop    %esi
+  800f17:	5f                   	pop    %edi
+  800f18:	5d                   	pop    %ebp
+  800f19:	c3                   	ret
+
+00800f1a <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800f1a:	55                   	push   %ebp
+  800f1b:	89 e5                	mov    %esp,%ebp
+  800f1d:	57                   	push   %edi
+  800f1e:	56                   	push   %esi
+  800f1f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2b:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f30:	89 df                	mov    %ebx,%edi
+  800f32:	55                   	push   %ebp
+  800f33:	89 e5                	mov    %esp,%ebp
+  800f35:	8d 35 3d 0f 80 00    	lea    0x800f3d,%esi
+  800f3b:	0f 34                	sysenter
+  800f3d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800f3e:	5b                   	pop    %ebx
+  800f3f:	5e                   	pop    %esi
+  800f40:	5f                   	pop    %edi
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+
+00800f43 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800f43:	55                   	push   %ebp
+  800f44:	89 e5                	mov    %esp,%ebp
+  800f46:	57                   	push   %edi
+  800f47:	56                   	push   %esi
+  800f48:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f54:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f59:	89 df                	mov    %ebx,%edi
+  800f5b:	55                   	push   %ebp
+  800f5c:	89 e5                	mov    %esp,%ebp
+  800f5e:	8d 35 66 0f 80 00    	lea    0x800f66,%esi
+  800f64:	0f 34                	sysenter
+  800f66:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800f67:	5b                   	pop    %ebx
+  800f68:	5e                   	pop    %esi
+  800f69:	5f                   	pop    %edi
+  800f6a:	5d                   	pop    %ebp
+  800f6b:	c3                   	ret
+
+00800f6c <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800f6c:	55                   	push   %ebp
+  800f6d:	89 e5                	mov    %esp,%ebp
+  800f6f:	57                   	push   %edi
+  800f70:	56                   	push   %esi
+  800f71:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f78:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f7d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f80:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	8d 35 8e 0f 80 00    	lea    0x800f8e,%esi
+  800f8c:	0f 34                	sysenter
+  800f8e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800f8f:	5b                   	pop    %ebx
+  800f90:	5e                   	pop    %esi
+  800f91:	5f                   	pop    %edi
+  800f92:	5d                   	pop    %ebp
+  800f93:	c3                   	ret
+
+00800f94 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800f94:	55                   	push   %ebp
+  800f95:	89 e5                	mov    %esp,%ebp
+  800f97:	57                   	push   %edi
+  800f98:	56                   	push   %esi
+  800f99:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa2:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fa7:	89 cb                	mov    %ecx,%ebx
+  800fa9:	89 cf                	mov    %ecx,%edi
+  800fab:	89 ce                	mov    %ecx,%esi
+  800fad:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800faf:	5b                   	pop    %ebx
+  800fb0:	5e                   	pop    %esi
+  800fb1:	5f                   	pop    %edi
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	c3                   	ret
+
+00800fb4 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800fb4:	55                   	push   %ebp
+  800fb5:	89 e5                	mov    %esp,%ebp
+  800fb7:	57                   	push   %edi
+  800fb8:	56                   	push   %esi
+  800fb9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc2:	b8 15 00 00 00       	mov    $0x15,%eax
+  800fc7:	89 cb                	mov    %ecx,%ebx
+  800fc9:	89 cf                	mov    %ecx,%edi
+  800fcb:	55                   	push   %ebp
+  800fcc:	89 e5                	mov    %esp,%ebp
+  800fce:	8d 35 d6 0f 80 00    	lea    0x800fd6,%esi
+  800fd4:	0f 34                	sysenter
+  800fd6:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800fd7:	5b                   	pop    %ebx
+  800fd8:	5e                   	pop    %esi
+  800fd9:	5f                   	pop    %edi
+  800fda:	5d                   	pop    %ebp
+  800fdb:	c3                   	ret
+
+00800fdc <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800fdc:	55                   	push   %ebp
+  800fdd:	89 e5                	mov    %esp,%ebp
+  800fdf:	57                   	push   %edi
+  800fe0:	56                   	push   %esi
+  800fe1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fe2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fea:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fef:	89 cb                	mov    %ecx,%ebx
+  800ff1:	89 cf                	mov    %ecx,%edi
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	8d 35 fe 0f 80 00    	lea    0x800ffe,%esi
+  800ffc:	0f 34                	sysenter
+  800ffe:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800fff:	5b                   	pop    %ebx
+  801000:	5e                   	pop    %esi
+  801001:	5f                   	pop    %edi
+  801002:	5d                   	pop    %ebp
+  801003:	c3                   	ret
+
+00801004 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  801004:	55                   	push   %ebp
+  801005:	89 e5                	mov    %esp,%ebp
+  801007:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100d:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  801010:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  801012:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  801015:	83 3a 01             	cmpl   $0x1,(%edx)
+  801018:	7e 09                	jle    801023 <argstart+0x1f>
+  80101a:	ba 91 3a 80 00       	mov    $0x803a91,%edx
+  80101f:	85 c9                	test   %ecx,%ecx
+  801021:	75 05                	jne    801028 <argstart+0x24>
+  801023:	ba 00 00 00 00       	mov    $0x0,%edx
+  801028:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  80102b:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  801032:	5d                   	pop    %ebp
+  801033:	c3                   	ret
+
+00801034 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  801034:	55                   	push   %ebp
+  801035:	89 e5                	mov    %esp,%ebp
+  801037:	53                   	push   %ebx
+  801038:	83 ec 04             	sub    $0x4,%esp
+  80103b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  80103e:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  801045:	8b 43 08             	mov    0x8(%ebx),%eax
+  801048:	85 c0                	test   %eax,%eax
+  80104a:	74 74                	je     8010c0 <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  80104c:	80 38 00             	cmpb   $0x0,(%eax)
+  80104f:	75 48                	jne    801099 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  801051:	8b 0b                	mov    (%ebx),%ecx
+  801053:	83 39 01             	cmpl   $0x1,(%ecx)
+  801056:	74 5a                	je     8010b2 <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  801058:	8b 53 04             	mov    0x4(%ebx),%edx
+  80105b:	8b 42 04             	mov    0x4(%edx),%eax
+  80105e:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801061:	75 4f                	jne    8010b2 <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  801063:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801067:	74 49                	je     8010b2 <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  801069:	83 c0 01             	add    $0x1,%eax
+  80106c:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  80106f:	83 ec 04             	sub    $0x4,%esp
+  801072:	8b 01                	mov    (%ecx),%eax
+  801074:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  80107b:	50                   	push   %eax
+  80107c:	8d 42 08             	lea    0x8(%edx),%eax
+  80107f:	50                   	push   %eax
+  801080:	83 c2 04             	add    $0x4,%edx
+  801083:	52                   	push   %edx
+  801084:	e8 f4 f8 ff ff       	call   80097d <memmove>
+		(*args->argc)--;
+  801089:	8b 03                	mov    (%ebx),%eax
+  80108b:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  80108e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801091:	83 c4 10             	add    $0x10,%esp
+  801094:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801097:	74 13                	je     8010ac <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  801099:	8b 43 08             	mov    0x8(%ebx),%eax
+  80109c:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  80109f:	83 c0 01             	add    $0x1,%eax
+  8010a2:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  8010a5:	89 d0                	mov    %edx,%eax
+  8010a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010aa:	c9                   	leave
+  8010ab:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  8010ac:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8010b0:	75 e7                	jne    801099 <argnext+0x65>
+	args->curarg = 0;
+  8010b2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  8010b9:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8010be:	eb e5                	jmp    8010a5 <argnext+0x71>
+		return -1;
+  8010c0:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8010c5:	eb de                	jmp    8010a5 <argnext+0x71>
+
+008010c7 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	53                   	push   %ebx
+  8010cb:	83 ec 04             	sub    $0x4,%esp
+  8010ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  8010d1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8010d4:	85 c0                	test   %eax,%eax
+  8010d6:	74 12                	je     8010ea <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  8010d8:	80 38 00             	cmpb   $0x0,(%eax)
+  8010db:	74 12                	je     8010ef <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  8010dd:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  8010e0:	c7 43 08 91 3a 80 00 	movl   $0x803a91,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  8010e7:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  8010ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010ed:	c9                   	leave
+  8010ee:	c3                   	ret
+	} else if (*args->argc > 1) {
+  8010ef:	8b 13                	mov    (%ebx),%edx
+  8010f1:	83 3a 01             	cmpl   $0x1,(%edx)
+  8010f4:	7f 10                	jg     801106 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  8010f6:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  8010fd:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801104:	eb e1                	jmp    8010e7 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  801106:	8b 43 04             	mov    0x4(%ebx),%eax
+  801109:	8b 48 04             	mov    0x4(%eax),%ecx
+  80110c:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  80110f:	83 ec 04             	sub    $0x4,%esp
+  801112:	8b 12                	mov    (%edx),%edx
+  801114:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  80111b:	52                   	push   %edx
+  80111c:	8d 50 08             	lea    0x8(%eax),%edx
+  80111f:	52                   	push   %edx
+  801120:	83 c0 04             	add    $0x4,%eax
+  801123:	50                   	push   %eax
+  801124:	e8 54 f8 ff ff       	call   80097d <memmove>
+		(*args->argc)--;
+  801129:	8b 03                	mov    (%ebx),%eax
+  80112b:	83 28 01             	subl   $0x1,(%eax)
+  80112e:	83 c4 10             	add    $0x10,%esp
+  801131:	eb b4                	jmp    8010e7 <argnextvalue+0x20>
+
+00801133 <argvalue>:
+{
+  801133:	55                   	push   %ebp
+  801134:	89 e5                	mov    %esp,%ebp
+  801136:	83 ec 08             	sub    $0x8,%esp
+  801139:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  80113c:	8b 42 0c             	mov    0xc(%edx),%eax
+  80113f:	85 c0                	test   %eax,%eax
+  801141:	74 02                	je     801145 <argvalue+0x12>
+}
+  801143:	c9                   	leave
+  801144:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801145:	83 ec 0c             	sub    $0xc,%esp
+  801148:	52                   	push   %edx
+  801149:	e8 79 ff ff ff       	call   8010c7 <argnextvalue>
+  80114e:	83 c4 10             	add    $0x10,%esp
+  801151:	eb f0                	jmp    801143 <argvalue+0x10>
+
+00801153 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801153:	55                   	push   %ebp
+  801154:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801156:	8b 45 08             	mov    0x8(%ebp),%eax
+  801159:	05 00 00 00 30       	add    $0x30000000,%eax
+  80115e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801161:	5d                   	pop    %ebp
+  801162:	c3                   	ret
+
+00801163 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801163:	55                   	push   %ebp
+  801164:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801166:	8b 45 08             	mov    0x8(%ebp),%eax
+  801169:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80116e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801173:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+
+0080117a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80117d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801182:	eb 02                	jmp    801186 <fd_alloc+0xc>
+  801184:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801186:	89 c2                	mov    %eax,%edx
+  801188:	c1 ea 16             	shr    $0x16,%edx
+  80118b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801192:	f6 c2 01             	test   $0x1,%dl
+  801195:	74 2b                	je     8011c2 <fd_alloc+0x48>
+  801197:	89 c2                	mov    %eax,%edx
+  801199:	c1 ea 0c             	shr    $0xc,%edx
+  80119c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8011a3:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011a9:	f6 c1 01             	test   $0x1,%cl
+  8011ac:	74 14                	je     8011c2 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8011ae:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8011b4:	75 ce                	jne    801184 <fd_alloc+0xa>
+  8011b6:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8011bb:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011c0:	eb 05                	jmp    8011c7 <fd_alloc+0x4d>
+			return 0;
+  8011c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8011c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ca:	89 02                	mov    %eax,(%edx)
+}
+  8011cc:	89 c8                	mov    %ecx,%eax
+  8011ce:	5d                   	pop    %ebp
+  8011cf:	c3                   	ret
+
+008011d0 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011d0:	55                   	push   %ebp
+  8011d1:	89 e5                	mov    %esp,%ebp
+  8011d3:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8011d6:	83 f8 1f             	cmp    $0x1f,%eax
+  8011d9:	77 30                	ja     80120b <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8011db:	c1 e0 0c             	shl    $0xc,%eax
+  8011de:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011e3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011e9:	f6 c2 01             	test   $0x1,%dl
+  8011ec:	74 24                	je     801212 <fd_lookup+0x42>
+  8011ee:	89 c2                	mov    %eax,%edx
+  8011f0:	c1 ea 0c             	shr    $0xc,%edx
+  8011f3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011fa:	f6 c2 01             	test   $0x1,%dl
+  8011fd:	74 1a                	je     801219 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8011ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801202:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801204:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801209:	5d                   	pop    %ebp
+  80120a:	c3                   	ret
+		return -E_INVAL;
+  80120b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801210:	eb f7                	jmp    801209 <fd_lookup+0x39>
+		return -E_INVAL;
+  801212:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801217:	eb f0                	jmp    801209 <fd_lookup+0x39>
+  801219:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80121e:	eb e9                	jmp    801209 <fd_lookup+0x39>
+
+00801220 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801220:	55                   	push   %ebp
+  801221:	89 e5                	mov    %esp,%ebp
+  801223:	53                   	push   %ebx
+  801224:	83 ec 04             	sub    $0x4,%esp
+  801227:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80122a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122f:	eb 03                	jmp    801234 <dev_lookup+0x14>
+  801231:	83 c0 01             	add    $0x1,%eax
+  801234:	8b 1c 85 90 3e 80 00 	mov    0x803e90(,%eax,4),%ebx
+  80123b:	85 db                	test   %ebx,%ebx
+  80123d:	74 0b                	je     80124a <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80123f:	39 13                	cmp    %edx,(%ebx)
+  801241:	75 ee                	jne    801231 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801243:	b8 00 00 00 00       	mov    $0x0,%eax
+  801248:	eb 1f                	jmp    801269 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80124a:	a1 00 60 80 00       	mov    0x806000,%eax
+  80124f:	8b 40 48             	mov    0x48(%eax),%eax
+  801252:	83 ec 04             	sub    $0x4,%esp
+  801255:	52                   	push   %edx
+  801256:	50                   	push   %eax
+  801257:	68 14 3e 80 00       	push   $0x803e14
+  80125c:	e8 a8 ef ff ff       	call   800209 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801261:	83 c4 10             	add    $0x10,%esp
+  801264:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801269:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80126c:	89 1a                	mov    %ebx,(%edx)
+}
+  80126e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801271:	c9                   	leave
+  801272:	c3                   	ret
+
+00801273 <fd_close>:
+{
+  801273:	55                   	push   %ebp
+  801274:	89 e5                	mov    %esp,%ebp
+  801276:	57                   	push   %edi
+  801277:	56                   	push   %esi
+  801278:	53                   	push   %ebx
+  801279:	83 ec 24             	sub    $0x24,%esp
+  80127c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80127f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801282:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801285:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801286:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80128c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80128f:	50                   	push   %eax
+  801290:	e8 3b ff ff ff       	call   8011d0 <fd_lookup>
+  801295:	89 c3                	mov    %eax,%ebx
+  801297:	83 c4 10             	add    $0x10,%esp
+  80129a:	85 c0                	test   %eax,%eax
+  80129c:	78 05                	js     8012a3 <fd_close+0x30>
+	    || fd != fd2)
+  80129e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8012a1:	74 16                	je     8012b9 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8012a3:	89 f8                	mov    %edi,%eax
+  8012a5:	84 c0                	test   %al,%al
+  8012a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ac:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012af:	89 d8                	mov    %ebx,%eax
+  8012b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b4:	5b                   	pop    %ebx
+  8012b5:	5e                   	pop    %esi
+  8012b6:	5f                   	pop    %edi
+  8012b7:	5d                   	pop    %ebp
+  8012b8:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012b9:	83 ec 08             	sub    $0x8,%esp
+  8012bc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012bf:	50                   	push   %eax
+  8012c0:	ff 36                	push   (%esi)
+  8012c2:	e8 59 ff ff ff       	call   801220 <dev_lookup>
+  8012c7:	89 c3                	mov    %eax,%ebx
+  8012c9:	83 c4 10             	add    $0x10,%esp
+  8012cc:	85 c0                	test   %eax,%eax
+  8012ce:	78 1a                	js     8012ea <fd_close+0x77>
+		if (dev->dev_close)
+  8012d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012d3:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8012d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8012db:	85 c0                	test   %eax,%eax
+  8012dd:	74 0b                	je     8012ea <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8012df:	83 ec 0c             	sub    $0xc,%esp
+  8012e2:	56                   	push   %esi
+  8012e3:	ff d0                	call   *%eax
+  8012e5:	89 c3                	mov    %eax,%ebx
+  8012e7:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8012ea:	83 ec 08             	sub    $0x8,%esp
+  8012ed:	56                   	push   %esi
+  8012ee:	6a 00                	push   $0x0
+  8012f0:	e8 9b f9 ff ff       	call   800c90 <sys_page_unmap>
+	return r;
+  8012f5:	83 c4 10             	add    $0x10,%esp
+  8012f8:	eb b5                	jmp    8012af <fd_close+0x3c>
+
+008012fa <close>:
+
+int
+close(int fdnum)
+{
+  8012fa:	55                   	push   %ebp
+  8012fb:	89 e5                	mov    %esp,%ebp
+  8012fd:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801300:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801303:	50                   	push   %eax
+  801304:	ff 75 08             	push   0x8(%ebp)
+  801307:	e8 c4 fe ff ff       	call   8011d0 <fd_lookup>
+  80130c:	83 c4 10             	add    $0x10,%esp
+  80130f:	85 c0                	test   %eax,%eax
+  801311:	79 02                	jns    801315 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801313:	c9                   	leave
+  801314:	c3                   	ret
+		return fd_close(fd, 1);
+  801315:	83 ec 08             	sub    $0x8,%esp
+  801318:	6a 01                	push   $0x1
+  80131a:	ff 75 f4             	push   -0xc(%ebp)
+  80131d:	e8 51 ff ff ff       	call   801273 <fd_close>
+  801322:	83 c4 10             	add    $0x10,%esp
+  801325:	eb ec                	jmp    801313 <close+0x19>
+
+00801327 <close_all>:
+
+void
+close_all(void)
+{
+  801327:	55                   	push   %ebp
+  801328:	89 e5                	mov    %esp,%ebp
+  80132a:	53                   	push   %ebx
+  80132b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80132e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801333:	83 ec 0c             	sub    $0xc,%esp
+  801336:	53                   	push   %ebx
+  801337:	e8 be ff ff ff       	call   8012fa <close>
+	for (i = 0; i < MAXFD; i++)
+  80133c:	83 c3 01             	add    $0x1,%ebx
+  80133f:	83 c4 10             	add    $0x10,%esp
+  801342:	83 fb 20             	cmp    $0x20,%ebx
+  801345:	75 ec                	jne    801333 <close_all+0xc>
+}
+  801347:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80134a:	c9                   	leave
+  80134b:	c3                   	ret
+
+0080134c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80134c:	55                   	push   %ebp
+  80134d:	89 e5                	mov    %esp,%ebp
+  80134f:	57                   	push   %edi
+  801350:	56                   	push   %esi
+  801351:	53                   	push   %ebx
+  801352:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801355:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801358:	50                   	push   %eax
+  801359:	ff 75 08             	push   0x8(%ebp)
+  80135c:	e8 6f fe ff ff       	call   8011d0 <fd_lookup>
+  801361:	89 c3                	mov    %eax,%ebx
+  801363:	83 c4 10             	add    $0x10,%esp
+  801366:	85 c0                	test   %eax,%eax
+  801368:	78 7f                	js     8013e9 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80136a:	83 ec 0c             	sub    $0xc,%esp
+  80136d:	ff 75 0c             	push   0xc(%ebp)
+  801370:	e8 85 ff ff ff       	call   8012fa <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801375:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801378:	c1 e6 0c             	shl    $0xc,%esi
+  80137b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801381:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801384:	89 3c 24             	mov    %edi,(%esp)
+  801387:	e8 d7 fd ff ff       	call   801163 <fd2data>
+  80138c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80138e:	89 34 24             	mov    %esi,(%esp)
+  801391:	e8 cd fd ff ff       	call   801163 <fd2data>
+  801396:	83 c4 10             	add    $0x10,%esp
+  801399:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80139c:	89 d8                	mov    %ebx,%eax
+  80139e:	c1 e8 16             	shr    $0x16,%eax
+  8013a1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013a8:	a8 01                	test   $0x1,%al
+  8013aa:	74 11                	je     8013bd <dup+0x71>
+  8013ac:	89 d8                	mov    %ebx,%eax
+  8013ae:	c1 e8 0c             	shr    $0xc,%eax
+  8013b1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013b8:	f6 c2 01             	test   $0x1,%dl
+  8013bb:	75 36                	jne    8013f3 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013bd:	89 f8                	mov    %edi,%eax
+  8013bf:	c1 e8 0c             	shr    $0xc,%eax
+  8013c2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013c9:	83 ec 0c             	sub    $0xc,%esp
+  8013cc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013d1:	50                   	push   %eax
+  8013d2:	56                   	push   %esi
+  8013d3:	6a 00                	push   $0x0
+  8013d5:	57                   	push   %edi
+  8013d6:	6a 00                	push   $0x0
+  8013d8:	e8 71 f8 ff ff       	call   800c4e <sys_page_map>
+  8013dd:	89 c3                	mov    %eax,%ebx
+  8013df:	83 c4 20             	add    $0x20,%esp
+  8013e2:	85 c0                	test   %eax,%eax
+  8013e4:	78 33                	js     801419 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8013e6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8013e9:	89 d8                	mov    %ebx,%eax
+  8013eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ee:	5b                   	pop    %ebx
+  8013ef:	5e                   	pop    %esi
+  8013f0:	5f                   	pop    %edi
+  8013f1:	5d                   	pop    %ebp
+  8013f2:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8013f3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013fa:	83 ec 0c             	sub    $0xc,%esp
+  8013fd:	25 07 0e 00 00       	and    $0xe07,%eax
+  801402:	50                   	push   %eax
+  801403:	ff 75 d4             	push   -0x2c(%ebp)
+  801406:	6a 00                	push   $0x0
+  801408:	53                   	push   %ebx
+  801409:	6a 00                	push   $0x0
+  80140b:	e8 3e f8 ff ff       	call   800c4e <sys_page_map>
+  801410:	89 c3                	mov    %eax,%ebx
+  801412:	83 c4 20             	add    $0x20,%esp
+  801415:	85 c0                	test   %eax,%eax
+  801417:	79 a4                	jns    8013bd <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801419:	83 ec 08             	sub    $0x8,%esp
+  80141c:	56                   	push   %esi
+  80141d:	6a 00                	push   $0x0
+  80141f:	e8 6c f8 ff ff       	call   800c90 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801424:	83 c4 08             	add    $0x8,%esp
+  801427:	ff 75 d4             	push   -0x2c(%ebp)
+  80142a:	6a 00                	push   $0x0
+  80142c:	e8 5f f8 ff ff       	call   800c90 <sys_page_unmap>
+	return r;
+  801431:	83 c4 10             	add    $0x10,%esp
+  801434:	eb b3                	jmp    8013e9 <dup+0x9d>
+
+00801436 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801436:	55                   	push   %ebp
+  801437:	89 e5                	mov    %esp,%ebp
+  801439:	56                   	push   %esi
+  80143a:	53                   	push   %ebx
+  80143b:	83 ec 18             	sub    $0x18,%esp
+  80143e:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801441:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801444:	50                   	push   %eax
+  801445:	56                   	push   %esi
+  801446:	e8 85 fd ff ff       	call   8011d0 <fd_lookup>
+  80144b:	83 c4 10             	add    $0x10,%esp
+  80144e:	85 c0                	test   %eax,%eax
+  801450:	78 3c                	js     80148e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801452:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801455:	83 ec 08             	sub    $0x8,%esp
+  801458:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80145b:	50                   	push   %eax
+  80145c:	ff 33                	push   (%ebx)
+  80145e:	e8 bd fd ff ff       	call   801220 <dev_lookup>
+  801463:	83 c4 10             	add    $0x10,%esp
+  801466:	85 c0                	test   %eax,%eax
+  801468:	78 24                	js     80148e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80146a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80146d:	83 e0 03             	and    $0x3,%eax
+  801470:	83 f8 01             	cmp    $0x1,%eax
+  801473:	74 20                	je     801495 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801475:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801478:	8b 40 08             	mov    0x8(%eax),%eax
+  80147b:	85 c0                	test   %eax,%eax
+  80147d:	74 37                	je     8014b6 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80147f:	83 ec 04             	sub    $0x4,%esp
+  801482:	ff 75 10             	push   0x10(%ebp)
+  801485:	ff 75 0c             	push   0xc(%ebp)
+  801488:	53                   	push   %ebx
+  801489:	ff d0                	call   *%eax
+  80148b:	83 c4 10             	add    $0x10,%esp
+}
+  80148e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801491:	5b                   	pop    %ebx
+  801492:	5e                   	pop    %esi
+  801493:	5d                   	pop    %ebp
+  801494:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801495:	a1 00 60 80 00       	mov    0x806000,%eax
+  80149a:	8b 40 48             	mov    0x48(%eax),%eax
+  80149d:	83 ec 04             	sub    $0x4,%esp
+  8014a0:	56                   	push   %esi
+  8014a1:	50                   	push   %eax
+  8014a2:	68 55 3e 80 00       	push   $0x803e55
+  8014a7:	e8 5d ed ff ff       	call   800209 <cprintf>
+		return -E_INVAL;
+  8014ac:	83 c4 10             	add    $0x10,%esp
+  8014af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014b4:	eb d8                	jmp    80148e <read+0x58>
+		return -E_NOT_SUPP;
+  8014b6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014bb:	eb d1                	jmp    80148e <read+0x58>
+
+008014bd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014bd:	55                   	push   %ebp
+  8014be:	89 e5                	mov    %esp,%ebp
+  8014c0:	57                   	push   %edi
+  8014c1:	56                   	push   %esi
+  8014c2:	53                   	push   %ebx
+  8014c3:	83 ec 0c             	sub    $0xc,%esp
+  8014c6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014c9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8014cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d1:	eb 02                	jmp    8014d5 <readn+0x18>
+  8014d3:	01 c3                	add    %eax,%ebx
+  8014d5:	39 f3                	cmp    %esi,%ebx
+  8014d7:	73 21                	jae    8014fa <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014d9:	83 ec 04             	sub    $0x4,%esp
+  8014dc:	89 f0                	mov    %esi,%eax
+  8014de:	29 d8                	sub    %ebx,%eax
+  8014e0:	50                   	push   %eax
+  8014e1:	89 d8                	mov    %ebx,%eax
+  8014e3:	03 45 0c             	add    0xc(%ebp),%eax
+  8014e6:	50                   	push   %eax
+  8014e7:	57                   	push   %edi
+  8014e8:	e8 49 ff ff ff       	call   801436 <read>
+		if (m < 0)
+  8014ed:	83 c4 10             	add    $0x10,%esp
+  8014f0:	85 c0                	test   %eax,%eax
+  8014f2:	78 04                	js     8014f8 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8014f4:	75 dd                	jne    8014d3 <readn+0x16>
+  8014f6:	eb 02                	jmp    8014fa <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8014f8:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8014fa:	89 d8                	mov    %ebx,%eax
+  8014fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ff:	5b                   	pop    %ebx
+  801500:	5e                   	pop    %esi
+  801501:	5f                   	pop    %edi
+  801502:	5d                   	pop    %ebp
+  801503:	c3                   	ret
+
+00801504 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801504:	55                   	push   %ebp
+  801505:	89 e5                	mov    %esp,%ebp
+  801507:	56                   	push   %esi
+  801508:	53                   	push   %ebx
+  801509:	83 ec 18             	sub    $0x18,%esp
+  80150c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80150f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801512:	50                   	push   %eax
+  801513:	53                   	push   %ebx
+  801514:	e8 b7 fc ff ff       	call   8011d0 <fd_lookup>
+  801519:	83 c4 10             	add    $0x10,%esp
+  80151c:	85 c0                	test   %eax,%eax
+  80151e:	78 37                	js     801557 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801520:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801523:	83 ec 08             	sub    $0x8,%esp
+  801526:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801529:	50                   	push   %eax
+  80152a:	ff 36                	push   (%esi)
+  80152c:	e8 ef fc ff ff       	call   801220 <dev_lookup>
+  801531:	83 c4 10             	add    $0x10,%esp
+  801534:	85 c0                	test   %eax,%eax
+  801536:	78 1f                	js     801557 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801538:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80153c:	74 20                	je     80155e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80153e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801541:	8b 40 0c             	mov    0xc(%eax),%eax
+  801544:	85 c0                	test   %eax,%eax
+  801546:	74 37                	je     80157f <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801548:	83 ec 04             	sub    $0x4,%esp
+  80154b:	ff 75 10             	push   0x10(%ebp)
+  80154e:	ff 75 0c             	push   0xc(%ebp)
+  801551:	56                   	push   %esi
+  801552:	ff d0                	call   *%eax
+  801554:	83 c4 10             	add    $0x10,%esp
+}
+  801557:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80155a:	5b                   	pop    %ebx
+  80155b:	5e                   	pop    %esi
+  80155c:	5d                   	pop    %ebp
+  80155d:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80155e:	a1 00 60 80 00       	mov    0x806000,%eax
+  801563:	8b 40 48             	mov    0x48(%eax),%eax
+  801566:	83 ec 04             	sub    $0x4,%esp
+  801569:	53                   	push   %ebx
+  80156a:	50                   	push   %eax
+  80156b:	68 71 3e 80 00       	push   $0x803e71
+  801570:	e8 94 ec ff ff       	call   800209 <cprintf>
+		return -E_INVAL;
+  801575:	83 c4 10             	add    $0x10,%esp
+  801578:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80157d:	eb d8                	jmp    801557 <write+0x53>
+		return -E_NOT_SUPP;
+  80157f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801584:	eb d1                	jmp    801557 <write+0x53>
+
+00801586 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801586:	55                   	push   %ebp
+  801587:	89 e5                	mov    %esp,%ebp
+  801589:	53                   	push   %ebx
+  80158a:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80158d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801590:	50                   	push   %eax
+  801591:	ff 75 08             	push   0x8(%ebp)
+  801594:	e8 37 fc ff ff       	call   8011d0 <fd_lookup>
+  801599:	83 c4 10             	add    $0x10,%esp
+  80159c:	85 c0                	test   %eax,%eax
+  80159e:	78 3a                	js     8015da <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015a0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8015a3:	83 ec 08             	sub    $0x8,%esp
+  8015a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015a9:	50                   	push   %eax
+  8015aa:	ff 33                	push   (%ebx)
+  8015ac:	e8 6f fc ff ff       	call   801220 <dev_lookup>
+  8015b1:	83 c4 10             	add    $0x10,%esp
+  8015b4:	85 c0                	test   %eax,%eax
+  8015b6:	78 22                	js     8015da <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8015b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015bb:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8015be:	85 c0                	test   %eax,%eax
+  8015c0:	74 0d                	je     8015cf <seek+0x49>
+  8015c2:	83 ec 0c             	sub    $0xc,%esp
+  8015c5:	53                   	push   %ebx
+  8015c6:	ff d0                	call   *%eax
+  8015c8:	83 c4 10             	add    $0x10,%esp
+  8015cb:	85 c0                	test   %eax,%eax
+  8015cd:	78 0b                	js     8015da <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8015cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015d2:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8015d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015dd:	c9                   	leave
+  8015de:	c3                   	ret
+
+008015df <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8015df:	55                   	push   %ebp
+  8015e0:	89 e5                	mov    %esp,%ebp
+  8015e2:	53                   	push   %ebx
+  8015e3:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015e9:	50                   	push   %eax
+  8015ea:	ff 75 08             	push   0x8(%ebp)
+  8015ed:	e8 de fb ff ff       	call   8011d0 <fd_lookup>
+  8015f2:	83 c4 10             	add    $0x10,%esp
+  8015f5:	85 c0                	test   %eax,%eax
+  8015f7:	78 2b                	js     801624 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015f9:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8015fc:	83 ec 08             	sub    $0x8,%esp
+  8015ff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801602:	50                   	push   %eax
+  801603:	ff 33                	push   (%ebx)
+  801605:	e8 16 fc ff ff       	call   801220 <dev_lookup>
+  80160a:	83 c4 10             	add    $0x10,%esp
+  80160d:	85 c0                	test   %eax,%eax
+  80160f:	78 13                	js     801624 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801611:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801614:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801617:	85 c0                	test   %eax,%eax
+  801619:	74 0e                	je     801629 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  80161b:	83 ec 0c             	sub    $0xc,%esp
+  80161e:	53                   	push   %ebx
+  80161f:	ff d0                	call   *%eax
+  801621:	83 c4 10             	add    $0x10,%esp
+}
+  801624:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801627:	c9                   	leave
+  801628:	c3                   	ret
+		return 0;
+  801629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162e:	eb f4                	jmp    801624 <fsync+0x45>
+
+00801630 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801630:	55                   	push   %ebp
+  801631:	89 e5                	mov    %esp,%ebp
+  801633:	56                   	push   %esi
+  801634:	53                   	push   %ebx
+  801635:	83 ec 18             	sub    $0x18,%esp
+  801638:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80163b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80163e:	50                   	push   %eax
+  80163f:	53                   	push   %ebx
+  801640:	e8 8b fb ff ff       	call   8011d0 <fd_lookup>
+  801645:	83 c4 10             	add    $0x10,%esp
+  801648:	85 c0                	test   %eax,%eax
+  80164a:	78 34                	js     801680 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80164c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80164f:	83 ec 08             	sub    $0x8,%esp
+  801652:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801655:	50                   	push   %eax
+  801656:	ff 36                	push   (%esi)
+  801658:	e8 c3 fb ff ff       	call   801220 <dev_lookup>
+  80165d:	83 c4 10             	add    $0x10,%esp
+  801660:	85 c0                	test   %eax,%eax
+  801662:	78 1c                	js     801680 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801664:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801668:	74 1d                	je     801687 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80166a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80166d:	8b 40 18             	mov    0x18(%eax),%eax
+  801670:	85 c0                	test   %eax,%eax
+  801672:	74 34                	je     8016a8 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801674:	83 ec 08             	sub    $0x8,%esp
+  801677:	ff 75 0c             	push   0xc(%ebp)
+  80167a:	56                   	push   %esi
+  80167b:	ff d0                	call   *%eax
+  80167d:	83 c4 10             	add    $0x10,%esp
+}
+  801680:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801683:	5b                   	pop    %ebx
+  801684:	5e                   	pop    %esi
+  801685:	5d                   	pop    %ebp
+  801686:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801687:	a1 00 60 80 00       	mov    0x806000,%eax
+  80168c:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80168f:	83 ec 04             	sub    $0x4,%esp
+  801692:	53                   	push   %ebx
+  801693:	50                   	push   %eax
+  801694:	68 34 3e 80 00       	push   $0x803e34
+  801699:	e8 6b eb ff ff       	call   800209 <cprintf>
+		return -E_INVAL;
+  80169e:	83 c4 10             	add    $0x10,%esp
+  8016a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016a6:	eb d8                	jmp    801680 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016a8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016ad:	eb d1                	jmp    801680 <ftruncate+0x50>
+
+008016af <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016af:	55                   	push   %ebp
+  8016b0:	89 e5                	mov    %esp,%ebp
+  8016b2:	56                   	push   %esi
+  8016b3:	53                   	push   %ebx
+  8016b4:	83 ec 18             	sub    $0x18,%esp
+  8016b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016ba:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016bd:	50                   	push   %eax
+  8016be:	ff 75 08             	push   0x8(%ebp)
+  8016c1:	e8 0a fb ff ff       	call   8011d0 <fd_lookup>
+  8016c6:	83 c4 10             	add    $0x10,%esp
+  8016c9:	85 c0                	test   %eax,%eax
+  8016cb:	78 49                	js     801716 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016cd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016d0:	83 ec 08             	sub    $0x8,%esp
+  8016d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d6:	50                   	push   %eax
+  8016d7:	ff 36                	push   (%esi)
+  8016d9:	e8 42 fb ff ff       	call   801220 <dev_lookup>
+  8016de:	83 c4 10             	add    $0x10,%esp
+  8016e1:	85 c0                	test   %eax,%eax
+  8016e3:	78 31                	js     801716 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8016e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e8:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016ec:	74 2f                	je     80171d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8016ee:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8016f1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016f8:	00 00 00 
+	stat->st_isdir = 0;
+  8016fb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801702:	00 00 00 
+	stat->st_dev = dev;
+  801705:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80170b:	83 ec 08             	sub    $0x8,%esp
+  80170e:	53                   	push   %ebx
+  80170f:	56                   	push   %esi
+  801710:	ff 50 14             	call   *0x14(%eax)
+  801713:	83 c4 10             	add    $0x10,%esp
+}
+  801716:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801719:	5b                   	pop    %ebx
+  80171a:	5e                   	pop    %esi
+  80171b:	5d                   	pop    %ebp
+  80171c:	c3                   	ret
+		return -E_NOT_SUPP;
+  80171d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801722:	eb f2                	jmp    801716 <fstat+0x67>
+
+00801724 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801724:	55                   	push   %ebp
+  801725:	89 e5                	mov    %esp,%ebp
+  801727:	56                   	push   %esi
+  801728:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801729:	83 ec 08             	sub    $0x8,%esp
+  80172c:	68 00 10 00 00       	push   $0x1000
+  801731:	ff 75 08             	push   0x8(%ebp)
+  801734:	e8 b3 07 00 00       	call   801eec <open>
+  801739:	89 c3                	mov    %eax,%ebx
+  80173b:	83 c4 10             	add    $0x10,%esp
+  80173e:	85 c0                	test   %eax,%eax
+  801740:	78 1b                	js     80175d <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801742:	83 ec 08             	sub    $0x8,%esp
+  801745:	ff 75 0c             	push   0xc(%ebp)
+  801748:	50                   	push   %eax
+  801749:	e8 61 ff ff ff       	call   8016af <fstat>
+  80174e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801750:	89 1c 24             	mov    %ebx,(%esp)
+  801753:	e8 a2 fb ff ff       	call   8012fa <close>
+	return r;
+  801758:	83 c4 10             	add    $0x10,%esp
+  80175b:	89 f3                	mov    %esi,%ebx
+}
+  80175d:	89 d8                	mov    %ebx,%eax
+  80175f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801762:	5b                   	pop    %ebx
+  801763:	5e                   	pop    %esi
+  801764:	5d                   	pop    %ebp
+  801765:	c3                   	ret
+
+00801766 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801766:	55                   	push   %ebp
+  801767:	89 e5                	mov    %esp,%ebp
+  801769:	57                   	push   %edi
+  80176a:	56                   	push   %esi
+  80176b:	53                   	push   %ebx
+  80176c:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801772:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801778:	89 d6                	mov    %edx,%esi
+  80177a:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801780:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801783:	89 d3                	mov    %edx,%ebx
+  801785:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  80178b:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801792:	74 1d                	je     8017b1 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801794:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801799:	83 c8 07             	or     $0x7,%eax
+  80179c:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  8017a2:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8017a7:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  8017ad:	01 ce                	add    %ecx,%esi
+  8017af:	eb 28                	jmp    8017d9 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017b1:	83 ec 0c             	sub    $0xc,%esp
+  8017b4:	6a 01                	push   $0x1
+  8017b6:	e8 66 1f 00 00       	call   803721 <ipc_find_env>
+  8017bb:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  8017c0:	83 c4 10             	add    $0x10,%esp
+  8017c3:	eb cf                	jmp    801794 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  8017c5:	83 c0 01             	add    $0x1,%eax
+  8017c8:	89 fa                	mov    %edi,%edx
+  8017ca:	09 da                	or     %ebx,%edx
+  8017cc:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8017d3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8017d9:	39 f3                	cmp    %esi,%ebx
+  8017db:	72 e8                	jb     8017c5 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  8017dd:	83 f8 41             	cmp    $0x41,%eax
+  8017e0:	77 2f                	ja     801811 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  8017e2:	50                   	push   %eax
+  8017e3:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  8017e9:	50                   	push   %eax
+  8017ea:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  8017f0:	ff 35 c8 80 80 00    	push   0x8080c8
+  8017f6:	e8 d8 1e 00 00       	call   8036d3 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  8017fb:	83 c4 0c             	add    $0xc,%esp
+  8017fe:	6a 00                	push   $0x0
+  801800:	6a 00                	push   $0x0
+  801802:	6a 00                	push   $0x0
+  801804:	e8 74 1d 00 00       	call   80357d <ipc_recv>
+}
+  801809:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80180c:	5b                   	pop    %ebx
+  80180d:	5e                   	pop    %esi
+  80180e:	5f                   	pop    %edi
+  80180f:	5d                   	pop    %ebp
+  801810:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801811:	68 a4 3e 80 00       	push   $0x803ea4
+  801816:	68 c0 3e 80 00       	push   $0x803ec0
+  80181b:	6a 40                	push   $0x40
+  80181d:	68 d5 3e 80 00       	push   $0x803ed5
+  801822:	e8 fb 19 00 00       	call   803222 <_panic>
+
+00801827 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801827:	55                   	push   %ebp
+  801828:	89 e5                	mov    %esp,%ebp
+  80182a:	57                   	push   %edi
+  80182b:	56                   	push   %esi
+  80182c:	53                   	push   %ebx
+  80182d:	83 ec 1c             	sub    $0x1c,%esp
+  801830:	89 c3                	mov    %eax,%ebx
+  801832:	89 d6                	mov    %edx,%esi
+  801834:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801837:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  80183d:	89 ca                	mov    %ecx,%edx
+  80183f:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801842:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801849:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80184c:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801853:	8b 76 0c             	mov    0xc(%esi),%esi
+  801856:	89 fb                	mov    %edi,%ebx
+  801858:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  80185f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801862:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801869:	8b 75 08             	mov    0x8(%ebp),%esi
+  80186c:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801873:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801876:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  80187d:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801880:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801887:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  80188c:	39 c8                	cmp    %ecx,%eax
+  80188e:	74 0d                	je     80189d <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801890:	b8 00 00 00 00       	mov    $0x0,%eax
+  801895:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801898:	5b                   	pop    %ebx
+  801899:	5e                   	pop    %esi
+  80189a:	5f                   	pop    %edi
+  80189b:	5d                   	pop    %ebp
+  80189c:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80189d:	6a 07                	push   $0x7
+  80189f:	68 00 70 80 00       	push   $0x807000
+  8018a4:	6a 0d                	push   $0xd
+  8018a6:	ff 35 c8 80 80 00    	push   0x8080c8
+  8018ac:	e8 37 1d 00 00       	call   8035e8 <ipc_send>
+  8018b1:	83 c4 10             	add    $0x10,%esp
+  8018b4:	eb da                	jmp    801890 <fsring_post+0x69>
+
+008018b6 <fsipcv>:
+{
+  8018b6:	55                   	push   %ebp
+  8018b7:	89 e5                	mov    %esp,%ebp
+  8018b9:	57                   	push   %edi
+  8018ba:	56                   	push   %esi
+  8018bb:	53                   	push   %ebx
+  8018bc:	83 ec 0c             	sub    $0xc,%esp
+  8018bf:	89 c7                	mov    %eax,%edi
+  8018c1:	89 d3                	mov    %edx,%ebx
+  8018c3:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  8018c5:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  8018cc:	74 26                	je     8018f4 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018ce:	6a 07                	push   $0x7
+  8018d0:	68 00 70 80 00       	push   $0x807000
+  8018d5:	57                   	push   %edi
+  8018d6:	ff 35 c8 80 80 00    	push   0x8080c8
+  8018dc:	e8 07 1d 00 00       	call   8035e8 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  8018e1:	6a 00                	push   $0x0
+  8018e3:	56                   	push   %esi
+  8018e4:	53                   	push   %ebx
+  8018e5:	6a 00                	push   $0x0
+  8018e7:	e8 54 1d 00 00       	call   803640 <ipc_recvv>
+}
+  8018ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ef:	5b                   	pop    %ebx
+  8018f0:	5e                   	pop    %esi
+  8018f1:	5f                   	pop    %edi
+  8018f2:	5d                   	pop    %ebp
+  8018f3:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018f4:	83 ec 0c             	sub    $0xc,%esp
+  8018f7:	6a 01                	push   $0x1
+  8018f9:	e8 23 1e 00 00       	call   803721 <ipc_find_env>
+  8018fe:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801903:	83 c4 10             	add    $0x10,%esp
+  801906:	eb c6                	jmp    8018ce <fsipcv+0x18>
+
+00801908 <fsipc>:
+{
+  801908:	55                   	push   %ebp
+  801909:	89 e5                	mov    %esp,%ebp
+  80190b:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  80190e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801915:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801918:	e8 99 ff ff ff       	call   8018b6 <fsipcv>
+}
+  80191d:	c9                   	leave
+  80191e:	c3                   	ret
+
+0080191f <file_write_direct>:
+{
+  80191f:	55                   	push   %ebp
+  801920:	89 e5                	mov    %esp,%ebp
+  801922:	56                   	push   %esi
+  801923:	53                   	push   %ebx
+  801924:	89 c3                	mov    %eax,%ebx
+  801926:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801928:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  80192e:	77 40                	ja     801970 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801930:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801935:	39 c8                	cmp    %ecx,%eax
+  801937:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80193a:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  80193d:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  801943:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801948:	83 ec 04             	sub    $0x4,%esp
+  80194b:	50                   	push   %eax
+  80194c:	52                   	push   %edx
+  80194d:	68 08 70 80 00       	push   $0x807008
+  801952:	e8 26 f0 ff ff       	call   80097d <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801957:	ba 00 00 00 00       	mov    $0x0,%edx
+  80195c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801961:	e8 a2 ff ff ff       	call   801908 <fsipc>
+  801966:	83 c4 10             	add    $0x10,%esp
+}
+  801969:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80196c:	5b                   	pop    %ebx
+  80196d:	5e                   	pop    %esi
+  80196e:	5d                   	pop    %ebp
+  80196f:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801970:	89 d6                	mov    %edx,%esi
+  801972:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801978:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80197d:	29 f1                	sub    %esi,%ecx
+  80197f:	39 c1                	cmp    %eax,%ecx
+  801981:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801984:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801987:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  80198c:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801992:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801998:	83 ec 0c             	sub    $0xc,%esp
+  80199b:	6a 05                	push   $0x5
+  80199d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8019a2:	e8 bf fd ff ff       	call   801766 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  8019a7:	83 c4 10             	add    $0x10,%esp
+  8019aa:	eb bd                	jmp    801969 <file_write_direct+0x4a>
+
+008019ac <devfile_sync>:
+{
+  8019ac:	55                   	push   %ebp
+  8019ad:	89 e5                	mov    %esp,%ebp
+  8019af:	57                   	push   %edi
+  8019b0:	56                   	push   %esi
+  8019b1:	53                   	push   %ebx
+  8019b2:	83 ec 28             	sub    $0x28,%esp
+  8019b5:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  8019b8:	56                   	push   %esi
+  8019b9:	e8 a5 f7 ff ff       	call   801163 <fd2data>
+  8019be:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  8019c0:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  8019c3:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  8019ca:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8019cd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  8019d2:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8019d6:	74 45                	je     801a1d <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  8019d8:	8b 46 14             	mov    0x14(%esi),%eax
+  8019db:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8019de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8019eb:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  8019ee:	39 cb                	cmp    %ecx,%ebx
+  8019f0:	73 14                	jae    801a06 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  8019f2:	29 d9                	sub    %ebx,%ecx
+  8019f4:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8019f7:	89 f0                	mov    %esi,%eax
+  8019f9:	e8 21 ff ff ff       	call   80191f <file_write_direct>
+  8019fe:	85 c0                	test   %eax,%eax
+  801a00:	7e 04                	jle    801a06 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801a02:	01 c3                	add    %eax,%ebx
+  801a04:	eb e5                	jmp    8019eb <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801a06:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801a09:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801a10:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801a13:	85 c0                	test   %eax,%eax
+  801a15:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a1a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801a1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a20:	5b                   	pop    %ebx
+  801a21:	5e                   	pop    %esi
+  801a22:	5f                   	pop    %edi
+  801a23:	5d                   	pop    %ebp
+  801a24:	c3                   	ret
+
+00801a25 <devfile_write>:
+{
+  801a25:	55                   	push   %ebp
+  801a26:	89 e5                	mov    %esp,%ebp
+  801a28:	57                   	push   %edi
+  801a29:	56                   	push   %esi
+  801a2a:	53                   	push   %ebx
+  801a2b:	83 ec 28             	sub    $0x28,%esp
+  801a2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a31:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801a34:	53                   	push   %ebx
+  801a35:	e8 29 f7 ff ff       	call   801163 <fd2data>
+  801a3a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801a3d:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801a40:	83 c4 10             	add    $0x10,%esp
+  801a43:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801a47:	74 43                	je     801a8c <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801a49:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801a50:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801a53:	85 c0                	test   %eax,%eax
+  801a55:	74 43                	je     801a9a <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801a57:	89 c2                	mov    %eax,%edx
+  801a59:	03 53 14             	add    0x14(%ebx),%edx
+  801a5c:	39 fa                	cmp    %edi,%edx
+  801a5e:	75 0b                	jne    801a6b <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801a60:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801a63:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801a69:	76 66                	jbe    801ad1 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801a6b:	83 ec 0c             	sub    $0xc,%esp
+  801a6e:	53                   	push   %ebx
+  801a6f:	e8 38 ff ff ff       	call   8019ac <devfile_sync>
+  801a74:	83 c4 10             	add    $0x10,%esp
+  801a77:	85 c0                	test   %eax,%eax
+  801a79:	78 4e                	js     801ac9 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801a7b:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801a81:	77 56                	ja     801ad9 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801a83:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801a86:	85 c0                	test   %eax,%eax
+  801a88:	75 20                	jne    801aaa <devfile_write+0x85>
+  801a8a:	eb 16                	jmp    801aa2 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801a8c:	89 f1                	mov    %esi,%ecx
+  801a8e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a91:	89 d8                	mov    %ebx,%eax
+  801a93:	e8 87 fe ff ff       	call   80191f <file_write_direct>
+  801a98:	eb 2f                	jmp    801ac9 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801a9a:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801aa0:	77 37                	ja     801ad9 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801aa2:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801aaa:	83 ec 04             	sub    $0x4,%esp
+  801aad:	56                   	push   %esi
+  801aae:	ff 75 0c             	push   0xc(%ebp)
+  801ab1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801ab4:	01 c1                	add    %eax,%ecx
+  801ab6:	51                   	push   %ecx
+  801ab7:	e8 c1 ee ff ff       	call   80097d <memmove>
+	ff->buf_wlen += n;
+  801abc:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801abf:	01 f7                	add    %esi,%edi
+  801ac1:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801ac4:	89 f0                	mov    %esi,%eax
+  801ac6:	83 c4 10             	add    $0x10,%esp
+}
+  801ac9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801acc:	5b                   	pop    %ebx
+  801acd:	5e                   	pop    %esi
+  801ace:	5f                   	pop    %edi
+  801acf:	5d                   	pop    %ebp
+  801ad0:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801ad1:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801ad7:	76 d1                	jbe    801aaa <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801ad9:	89 f1                	mov    %esi,%ecx
+  801adb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ade:	89 d8                	mov    %ebx,%eax
+  801ae0:	e8 3a fe ff ff       	call   80191f <file_write_direct>
+  801ae5:	eb e2                	jmp    801ac9 <devfile_write+0xa4>
+
+00801ae7 <devfile_trunc>:
+{
+  801ae7:	55                   	push   %ebp
+  801ae8:	89 e5                	mov    %esp,%ebp
+  801aea:	53                   	push   %ebx
+  801aeb:	83 ec 10             	sub    $0x10,%esp
+  801aee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801af1:	53                   	push   %ebx
+  801af2:	e8 b5 fe ff ff       	call   8019ac <devfile_sync>
+  801af7:	83 c4 10             	add    $0x10,%esp
+  801afa:	85 c0                	test   %eax,%eax
+  801afc:	78 1f                	js     801b1d <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801afe:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b01:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801b06:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b09:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801b0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b13:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b18:	e8 eb fd ff ff       	call   801908 <fsipc>
+}
+  801b1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b20:	c9                   	leave
+  801b21:	c3                   	ret
+
+00801b22 <devfile_stat>:
+{
+  801b22:	55                   	push   %ebp
+  801b23:	89 e5                	mov    %esp,%ebp
+  801b25:	56                   	push   %esi
+  801b26:	53                   	push   %ebx
+  801b27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801b2a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801b2d:	83 ec 0c             	sub    $0xc,%esp
+  801b30:	53                   	push   %ebx
+  801b31:	e8 76 fe ff ff       	call   8019ac <devfile_sync>
+  801b36:	83 c4 10             	add    $0x10,%esp
+  801b39:	85 c0                	test   %eax,%eax
+  801b3b:	78 47                	js     801b84 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b3d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b40:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b45:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b4a:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b4f:	e8 b4 fd ff ff       	call   801908 <fsipc>
+  801b54:	85 c0                	test   %eax,%eax
+  801b56:	78 2c                	js     801b84 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b58:	83 ec 08             	sub    $0x8,%esp
+  801b5b:	68 00 70 80 00       	push   $0x807000
+  801b60:	56                   	push   %esi
+  801b61:	e8 91 ec ff ff       	call   8007f7 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801b66:	a1 80 70 80 00       	mov    0x807080,%eax
+  801b6b:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b71:	a1 84 70 80 00       	mov    0x807084,%eax
+  801b76:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801b7c:	83 c4 10             	add    $0x10,%esp
+  801b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b87:	5b                   	pop    %ebx
+  801b88:	5e                   	pop    %esi
+  801b89:	5d                   	pop    %ebp
+  801b8a:	c3                   	ret
+
+00801b8b <devfile_flush>:
+{
+  801b8b:	55                   	push   %ebp
+  801b8c:	89 e5                	mov    %esp,%ebp
+  801b8e:	56                   	push   %esi
+  801b8f:	53                   	push   %ebx
+  801b90:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801b93:	83 ec 0c             	sub    $0xc,%esp
+  801b96:	56                   	push   %esi
+  801b97:	e8 10 fe ff ff       	call   8019ac <devfile_sync>
+  801b9c:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801b9e:	83 c4 10             	add    $0x10,%esp
+  801ba1:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801ba5:	75 25                	jne    801bcc <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ba7:	8b 46 0c             	mov    0xc(%esi),%eax
+  801baa:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801baf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb4:	b8 06 00 00 00       	mov    $0x6,%eax
+  801bb9:	e8 4a fd ff ff       	call   801908 <fsipc>
+  801bbe:	85 c0                	test   %eax,%eax
+  801bc0:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801bc3:	89 d8                	mov    %ebx,%eax
+  801bc5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bc8:	5b                   	pop    %ebx
+  801bc9:	5e                   	pop    %esi
+  801bca:	5d                   	pop    %ebp
+  801bcb:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801bcc:	83 ec 0c             	sub    $0xc,%esp
+  801bcf:	56                   	push   %esi
+  801bd0:	e8 8e f5 ff ff       	call   801163 <fd2data>
+  801bd5:	83 c4 08             	add    $0x8,%esp
+  801bd8:	50                   	push   %eax
+  801bd9:	6a 00                	push   $0x0
+  801bdb:	e8 b0 f0 ff ff       	call   800c90 <sys_page_unmap>
+  801be0:	83 c4 10             	add    $0x10,%esp
+  801be3:	eb c2                	jmp    801ba7 <devfile_flush+0x1c>
+
+00801be5 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801be5:	55                   	push   %ebp
+  801be6:	89 e5                	mov    %esp,%ebp
+  801be8:	57                   	push   %edi
+  801be9:	56                   	push   %esi
+  801bea:	53                   	push   %ebx
+  801beb:	83 ec 64             	sub    $0x64,%esp
+  801bee:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801bf0:	52                   	push   %edx
+  801bf1:	50                   	push   %eax
+  801bf2:	e8 d9 f5 ff ff       	call   8011d0 <fd_lookup>
+  801bf7:	89 c1                	mov    %eax,%ecx
+  801bf9:	83 c4 10             	add    $0x10,%esp
+  801bfc:	85 c0                	test   %eax,%eax
+  801bfe:	0f 88 f2 00 00 00    	js     801cf6 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801c04:	8b 07                	mov    (%edi),%eax
+  801c06:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801c0c:	39 10                	cmp    %edx,(%eax)
+  801c0e:	0f 85 03 01 00 00    	jne    801d17 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801c14:	a1 00 60 80 00       	mov    0x806000,%eax
+  801c19:	8b 40 48             	mov    0x48(%eax),%eax
+  801c1c:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  801c22:	0f 84 96 00 00 00    	je     801cbe <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801c28:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801c2f:	0f 84 cb 00 00 00    	je     801d00 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801c35:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801c3a:	83 c8 07             	or     $0x7,%eax
+  801c3d:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801c40:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801c43:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801c48:	83 ec 04             	sub    $0x4,%esp
+  801c4b:	68 07 04 00 00       	push   $0x407
+  801c50:	53                   	push   %ebx
+  801c51:	6a 00                	push   $0x0
+  801c53:	e8 ab ef ff ff       	call   800c03 <sys_page_alloc>
+  801c58:	89 c1                	mov    %eax,%ecx
+  801c5a:	83 c4 10             	add    $0x10,%esp
+  801c5d:	85 c0                	test   %eax,%eax
+  801c5f:	0f 88 91 00 00 00    	js     801cf6 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801c65:	89 d8                	mov    %ebx,%eax
+  801c67:	83 c8 07             	or     $0x7,%eax
+  801c6a:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801c6c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c72:	83 c6 04             	add    $0x4,%esi
+  801c75:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801c7b:	75 cb                	jne    801c48 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801c7d:	6a 12                	push   $0x12
+  801c7f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801c82:	50                   	push   %eax
+  801c83:	6a 0c                	push   $0xc
+  801c85:	ff 35 c8 80 80 00    	push   0x8080c8
+  801c8b:	e8 43 1a 00 00       	call   8036d3 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801c90:	83 c4 0c             	add    $0xc,%esp
+  801c93:	6a 00                	push   $0x0
+  801c95:	6a 00                	push   $0x0
+  801c97:	6a 00                	push   $0x0
+  801c99:	e8 df 18 00 00       	call   80357d <ipc_recv>
+  801c9e:	89 c1                	mov    %eax,%ecx
+  801ca0:	83 c4 10             	add    $0x10,%esp
+  801ca3:	85 c0                	test   %eax,%eax
+  801ca5:	78 4f                	js     801cf6 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801ca7:	a1 00 60 80 00       	mov    0x806000,%eax
+  801cac:	8b 40 48             	mov    0x48(%eax),%eax
+  801caf:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  801cb4:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  801cbb:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801cbe:	83 ec 0c             	sub    $0xc,%esp
+  801cc1:	ff 37                	push   (%edi)
+  801cc3:	e8 e4 fc ff ff       	call   8019ac <devfile_sync>
+  801cc8:	89 c1                	mov    %eax,%ecx
+  801cca:	83 c4 10             	add    $0x10,%esp
+  801ccd:	85 c0                	test   %eax,%eax
+  801ccf:	78 25                	js     801cf6 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801cd1:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801cd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801cdc:	ba 01 00 00 00       	mov    $0x1,%edx
+  801ce1:	89 d0                	mov    %edx,%eax
+  801ce3:	d3 e0                	shl    %cl,%eax
+  801ce5:	85 d8                	test   %ebx,%eax
+  801ce7:	74 0d                	je     801cf6 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801ce9:	83 c1 01             	add    $0x1,%ecx
+  801cec:	83 f9 10             	cmp    $0x10,%ecx
+  801cef:	75 f0                	jne    801ce1 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801cf1:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801cf6:	89 c8                	mov    %ecx,%eax
+  801cf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cfb:	5b                   	pop    %ebx
+  801cfc:	5e                   	pop    %esi
+  801cfd:	5f                   	pop    %edi
+  801cfe:	5d                   	pop    %ebp
+  801cff:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d00:	83 ec 0c             	sub    $0xc,%esp
+  801d03:	6a 01                	push   $0x1
+  801d05:	e8 17 1a 00 00       	call   803721 <ipc_find_env>
+  801d0a:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801d0f:	83 c4 10             	add    $0x10,%esp
+  801d12:	e9 1e ff ff ff       	jmp    801c35 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801d17:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801d1c:	eb d8                	jmp    801cf6 <fsring_slot+0x111>
+
+00801d1e <file_read_direct>:
+{
+  801d1e:	55                   	push   %ebp
+  801d1f:	89 e5                	mov    %esp,%ebp
+  801d21:	57                   	push   %edi
+  801d22:	56                   	push   %esi
+  801d23:	53                   	push   %ebx
+  801d24:	83 ec 1c             	sub    $0x1c,%esp
+  801d27:	89 c7                	mov    %eax,%edi
+  801d29:	89 d6                	mov    %edx,%esi
+  801d2b:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801d2d:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801d33:	77 52                	ja     801d87 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801d35:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d38:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801d3d:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801d43:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d48:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d4d:	e8 b6 fb ff ff       	call   801908 <fsipc>
+  801d52:	89 c7                	mov    %eax,%edi
+  801d54:	85 c0                	test   %eax,%eax
+  801d56:	78 25                	js     801d7d <file_read_direct+0x5f>
+	assert(r <= n);
+  801d58:	39 c3                	cmp    %eax,%ebx
+  801d5a:	0f 82 87 00 00 00    	jb     801de7 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801d60:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801d65:	0f 8f 95 00 00 00    	jg     801e00 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801d6b:	83 ec 04             	sub    $0x4,%esp
+  801d6e:	50                   	push   %eax
+  801d6f:	68 00 70 80 00       	push   $0x807000
+  801d74:	56                   	push   %esi
+  801d75:	e8 03 ec ff ff       	call   80097d <memmove>
+	return r;
+  801d7a:	83 c4 10             	add    $0x10,%esp
+}
+  801d7d:	89 f8                	mov    %edi,%eax
+  801d7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d82:	5b                   	pop    %ebx
+  801d83:	5e                   	pop    %esi
+  801d84:	5f                   	pop    %edi
+  801d85:	5d                   	pop    %ebp
+  801d86:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801d87:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801d8d:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801d92:	29 d1                	sub    %edx,%ecx
+  801d94:	39 d9                	cmp    %ebx,%ecx
+  801d96:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801d99:	89 f0                	mov    %esi,%eax
+  801d9b:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801d9e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801da1:	eb 0f                	jmp    801db2 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801da3:	0f b6 10             	movzbl (%eax),%edx
+  801da6:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801da8:	05 00 10 00 00       	add    $0x1000,%eax
+  801dad:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801db2:	39 c8                	cmp    %ecx,%eax
+  801db4:	72 ed                	jb     801da3 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801db6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801db9:	8b 47 0c             	mov    0xc(%edi),%eax
+  801dbc:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801dc1:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801dc7:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801dcd:	83 ec 0c             	sub    $0xc,%esp
+  801dd0:	6a 07                	push   $0x7
+  801dd2:	89 d9                	mov    %ebx,%ecx
+  801dd4:	89 f2                	mov    %esi,%edx
+  801dd6:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ddb:	e8 86 f9 ff ff       	call   801766 <fsipc_pages>
+  801de0:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801de2:	83 c4 10             	add    $0x10,%esp
+  801de5:	eb 96                	jmp    801d7d <file_read_direct+0x5f>
+	assert(r <= n);
+  801de7:	68 e0 3e 80 00       	push   $0x803ee0
+  801dec:	68 c0 3e 80 00       	push   $0x803ec0
+  801df1:	68 dc 00 00 00       	push   $0xdc
+  801df6:	68 d5 3e 80 00       	push   $0x803ed5
+  801dfb:	e8 22 14 00 00       	call   803222 <_panic>
+	assert(r <= PGSIZE);
+  801e00:	68 f1 3e 80 00       	push   $0x803ef1
+  801e05:	68 c0 3e 80 00       	push   $0x803ec0
+  801e0a:	68 dd 00 00 00       	push   $0xdd
+  801e0f:	68 d5 3e 80 00       	push   $0x803ed5
+  801e14:	e8 09 14 00 00       	call   803222 <_panic>
+
+00801e19 <devfile_read>:
+{
+  801e19:	55                   	push   %ebp
+  801e1a:	89 e5                	mov    %esp,%ebp
+  801e1c:	57                   	push   %edi
+  801e1d:	56                   	push   %esi
+  801e1e:	53                   	push   %ebx
+  801e1f:	83 ec 28             	sub    $0x28,%esp
+  801e22:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e25:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801e28:	53                   	push   %ebx
+  801e29:	e8 35 f3 ff ff       	call   801163 <fd2data>
+  801e2e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801e31:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801e34:	83 c4 10             	add    $0x10,%esp
+  801e37:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801e3b:	74 7d                	je     801eba <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801e3d:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801e41:	0f 85 81 00 00 00    	jne    801ec8 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801e47:	8b 43 18             	mov    0x18(%ebx),%eax
+  801e4a:	85 c0                	test   %eax,%eax
+  801e4c:	74 0d                	je     801e5b <devfile_read+0x42>
+  801e4e:	8b 53 14             	mov    0x14(%ebx),%edx
+  801e51:	39 fa                	cmp    %edi,%edx
+  801e53:	7f 06                	jg     801e5b <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801e55:	01 c2                	add    %eax,%edx
+  801e57:	39 d7                	cmp    %edx,%edi
+  801e59:	72 28                	jb     801e83 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801e5b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801e62:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e68:	77 74                	ja     801ede <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801e6a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e6f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801e72:	89 d8                	mov    %ebx,%eax
+  801e74:	e8 a5 fe ff ff       	call   801d1e <file_read_direct>
+  801e79:	85 c0                	test   %eax,%eax
+  801e7b:	7e 35                	jle    801eb2 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801e7d:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801e80:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801e83:	8b 53 14             	mov    0x14(%ebx),%edx
+  801e86:	89 d0                	mov    %edx,%eax
+  801e88:	03 43 18             	add    0x18(%ebx),%eax
+  801e8b:	29 f8                	sub    %edi,%eax
+  801e8d:	39 f0                	cmp    %esi,%eax
+  801e8f:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801e92:	83 ec 04             	sub    $0x4,%esp
+  801e95:	56                   	push   %esi
+  801e96:	89 f8                	mov    %edi,%eax
+  801e98:	29 d0                	sub    %edx,%eax
+  801e9a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e9d:	01 c1                	add    %eax,%ecx
+  801e9f:	51                   	push   %ecx
+  801ea0:	ff 75 0c             	push   0xc(%ebp)
+  801ea3:	e8 d5 ea ff ff       	call   80097d <memmove>
+	fd->fd_offset = pos + n;
+  801ea8:	01 f7                	add    %esi,%edi
+  801eaa:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801ead:	89 f0                	mov    %esi,%eax
+  801eaf:	83 c4 10             	add    $0x10,%esp
+}
+  801eb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eb5:	5b                   	pop    %ebx
+  801eb6:	5e                   	pop    %esi
+  801eb7:	5f                   	pop    %edi
+  801eb8:	5d                   	pop    %ebp
+  801eb9:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801eba:	89 f1                	mov    %esi,%ecx
+  801ebc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ebf:	89 d8                	mov    %ebx,%eax
+  801ec1:	e8 58 fe ff ff       	call   801d1e <file_read_direct>
+  801ec6:	eb ea                	jmp    801eb2 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801ec8:	83 ec 0c             	sub    $0xc,%esp
+  801ecb:	53                   	push   %ebx
+  801ecc:	e8 db fa ff ff       	call   8019ac <devfile_sync>
+  801ed1:	83 c4 10             	add    $0x10,%esp
+  801ed4:	85 c0                	test   %eax,%eax
+  801ed6:	0f 89 6b ff ff ff    	jns    801e47 <devfile_read+0x2e>
+  801edc:	eb d4                	jmp    801eb2 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801ede:	89 f1                	mov    %esi,%ecx
+  801ee0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ee3:	89 d8                	mov    %ebx,%eax
+  801ee5:	e8 34 fe ff ff       	call   801d1e <file_read_direct>
+  801eea:	eb c6                	jmp    801eb2 <devfile_read+0x99>
+
+00801eec <open>:
+{
+  801eec:	55                   	push   %ebp
+  801eed:	89 e5                	mov    %esp,%ebp
+  801eef:	56                   	push   %esi
+  801ef0:	53                   	push   %ebx
+  801ef1:	83 ec 1c             	sub    $0x1c,%esp
+  801ef4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801ef7:	56                   	push   %esi
+  801ef8:	e8 bf e8 ff ff       	call   8007bc <strlen>
+  801efd:	83 c4 10             	add    $0x10,%esp
+  801f00:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f05:	0f 8f a0 00 00 00    	jg     801fab <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801f0b:	83 ec 0c             	sub    $0xc,%esp
+  801f0e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f11:	50                   	push   %eax
+  801f12:	e8 63 f2 ff ff       	call   80117a <fd_alloc>
+  801f17:	89 c3                	mov    %eax,%ebx
+  801f19:	83 c4 10             	add    $0x10,%esp
+  801f1c:	85 c0                	test   %eax,%eax
+  801f1e:	78 45                	js     801f65 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801f20:	83 ec 08             	sub    $0x8,%esp
+  801f23:	56                   	push   %esi
+  801f24:	68 00 70 80 00       	push   $0x807000
+  801f29:	e8 c9 e8 ff ff       	call   8007f7 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801f2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f31:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801f36:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f39:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f3e:	e8 c5 f9 ff ff       	call   801908 <fsipc>
+  801f43:	89 c3                	mov    %eax,%ebx
+  801f45:	83 c4 10             	add    $0x10,%esp
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	78 22                	js     801f6e <open+0x82>
+	if (!(mode & O_NOBUF)
+  801f4c:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801f53:	74 2b                	je     801f80 <open+0x94>
+	return fd2num(fd);
+  801f55:	83 ec 0c             	sub    $0xc,%esp
+  801f58:	ff 75 f4             	push   -0xc(%ebp)
+  801f5b:	e8 f3 f1 ff ff       	call   801153 <fd2num>
+  801f60:	89 c3                	mov    %eax,%ebx
+  801f62:	83 c4 10             	add    $0x10,%esp
+}
+  801f65:	89 d8                	mov    %ebx,%eax
+  801f67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f6a:	5b                   	pop    %ebx
+  801f6b:	5e                   	pop    %esi
+  801f6c:	5d                   	pop    %ebp
+  801f6d:	c3                   	ret
+		fd_close(fd, 0);
+  801f6e:	83 ec 08             	sub    $0x8,%esp
+  801f71:	6a 00                	push   $0x0
+  801f73:	ff 75 f4             	push   -0xc(%ebp)
+  801f76:	e8 f8 f2 ff ff       	call   801273 <fd_close>
+		return r;
+  801f7b:	83 c4 10             	add    $0x10,%esp
+  801f7e:	eb e5                	jmp    801f65 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801f80:	83 ec 0c             	sub    $0xc,%esp
+  801f83:	ff 75 f4             	push   -0xc(%ebp)
+  801f86:	e8 d8 f1 ff ff       	call   801163 <fd2data>
+  801f8b:	83 c4 0c             	add    $0xc,%esp
+  801f8e:	68 07 04 00 00       	push   $0x407
+  801f93:	50                   	push   %eax
+  801f94:	6a 00                	push   $0x0
+  801f96:	e8 68 ec ff ff       	call   800c03 <sys_page_alloc>
+  801f9b:	83 c4 10             	add    $0x10,%esp
+  801f9e:	85 c0                	test   %eax,%eax
+  801fa0:	75 b3                	jne    801f55 <open+0x69>
+		fd->fd_file.buffered = 1;
+  801fa2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fa5:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801fa9:	eb aa                	jmp    801f55 <open+0x69>
+		return -E_BAD_PATH;
+  801fab:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801fb0:	eb b3                	jmp    801f65 <open+0x79>
+
+00801fb2 <readdir>:
+{
+  801fb2:	55                   	push   %ebp
+  801fb3:	89 e5                	mov    %esp,%ebp
+  801fb5:	53                   	push   %ebx
+  801fb6:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fb9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fbc:	50                   	push   %eax
+  801fbd:	ff 75 08             	push   0x8(%ebp)
+  801fc0:	e8 0b f2 ff ff       	call   8011d0 <fd_lookup>
+  801fc5:	89 c3                	mov    %eax,%ebx
+  801fc7:	83 c4 10             	add    $0x10,%esp
+  801fca:	85 c0                	test   %eax,%eax
+  801fcc:	78 73                	js     802041 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801fce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fd1:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  801fd7:	39 08                	cmp    %ecx,(%eax)
+  801fd9:	0f 85 82 00 00 00    	jne    802061 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801fdf:	83 ec 0c             	sub    $0xc,%esp
+  801fe2:	50                   	push   %eax
+  801fe3:	e8 c4 f9 ff ff       	call   8019ac <devfile_sync>
+  801fe8:	89 c3                	mov    %eax,%ebx
+  801fea:	83 c4 10             	add    $0x10,%esp
+  801fed:	85 c0                	test   %eax,%eax
+  801fef:	78 50                	js     802041 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801ff1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ff4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ff7:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  801ffc:	8b 45 10             	mov    0x10(%ebp),%eax
+  801fff:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  802004:	8b 45 14             	mov    0x14(%ebp),%eax
+  802007:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  80200c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802011:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802016:	e8 ed f8 ff ff       	call   801908 <fsipc>
+  80201b:	89 c3                	mov    %eax,%ebx
+  80201d:	85 c0                	test   %eax,%eax
+  80201f:	7e 20                	jle    802041 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  802021:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802024:	72 22                	jb     802048 <readdir+0x96>
+  802026:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80202b:	7f 1b                	jg     802048 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80202d:	83 ec 04             	sub    $0x4,%esp
+  802030:	50                   	push   %eax
+  802031:	68 00 70 80 00       	push   $0x807000
+  802036:	ff 75 0c             	push   0xc(%ebp)
+  802039:	e8 3f e9 ff ff       	call   80097d <memmove>
+	return r;
+  80203e:	83 c4 10             	add    $0x10,%esp
+}
+  802041:	89 d8                	mov    %ebx,%eax
+  802043:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802046:	c9                   	leave
+  802047:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  802048:	68 e7 3e 80 00       	push   $0x803ee7
+  80204d:	68 c0 3e 80 00       	push   $0x803ec0
+  802052:	68 86 01 00 00       	push   $0x186
+  802057:	68 d5 3e 80 00       	push   $0x803ed5
+  80205c:	e8 c1 11 00 00       	call   803222 <_panic>
+		return -E_NOT_SUPP;
+  802061:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802066:	eb d9                	jmp    802041 <readdir+0x8f>
+
+00802068 <munmap>:
+{
+  802068:	55                   	push   %ebp
+  802069:	89 e5                	mov    %esp,%ebp
+  80206b:	56                   	push   %esi
+  80206c:	53                   	push   %ebx
+  80206d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802070:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802073:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  802079:	75 41                	jne    8020bc <munmap+0x54>
+  80207b:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  802081:	77 39                	ja     8020bc <munmap+0x54>
+  802083:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802088:	29 f0                	sub    %esi,%eax
+  80208a:	39 d0                	cmp    %edx,%eax
+  80208c:	72 35                	jb     8020c3 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80208e:	89 f3                	mov    %esi,%ebx
+  802090:	01 d6                	add    %edx,%esi
+  802092:	39 f3                	cmp    %esi,%ebx
+  802094:	73 1a                	jae    8020b0 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802096:	83 ec 08             	sub    $0x8,%esp
+  802099:	53                   	push   %ebx
+  80209a:	6a 00                	push   $0x0
+  80209c:	e8 ef eb ff ff       	call   800c90 <sys_page_unmap>
+  8020a1:	83 c4 10             	add    $0x10,%esp
+  8020a4:	85 c0                	test   %eax,%eax
+  8020a6:	78 0d                	js     8020b5 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8020a8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8020ae:	eb e2                	jmp    802092 <munmap+0x2a>
+	return 0;
+  8020b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020b8:	5b                   	pop    %ebx
+  8020b9:	5e                   	pop    %esi
+  8020ba:	5d                   	pop    %ebp
+  8020bb:	c3                   	ret
+		return -E_INVAL;
+  8020bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020c1:	eb f2                	jmp    8020b5 <munmap+0x4d>
+  8020c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020c8:	eb eb                	jmp    8020b5 <munmap+0x4d>
+
+008020ca <mmap>:
+{
+  8020ca:	55                   	push   %ebp
+  8020cb:	89 e5                	mov    %esp,%ebp
+  8020cd:	57                   	push   %edi
+  8020ce:	56                   	push   %esi
+  8020cf:	53                   	push   %ebx
+  8020d0:	83 ec 34             	sub    $0x34,%esp
+  8020d3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020d6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020d9:	50                   	push   %eax
+  8020da:	ff 75 18             	push   0x18(%ebp)
+  8020dd:	e8 ee f0 ff ff       	call   8011d0 <fd_lookup>
+  8020e2:	89 c3                	mov    %eax,%ebx
+  8020e4:	83 c4 10             	add    $0x10,%esp
+  8020e7:	85 c0                	test   %eax,%eax
+  8020e9:	0f 88 0e 01 00 00    	js     8021fd <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8020ef:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8020f2:	a1 20 50 80 00       	mov    0x805020,%eax
+  8020f7:	39 02                	cmp    %eax,(%edx)
+  8020f9:	0f 85 50 01 00 00    	jne    80224f <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  8020ff:	8b 45 10             	mov    0x10(%ebp),%eax
+  802102:	83 e0 02             	and    $0x2,%eax
+  802105:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802108:	74 0a                	je     802114 <mmap+0x4a>
+  80210a:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80210e:	0f 84 42 01 00 00    	je     802256 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802114:	8b 42 08             	mov    0x8(%edx),%eax
+  802117:	83 e0 03             	and    $0x3,%eax
+  80211a:	83 f8 01             	cmp    $0x1,%eax
+  80211d:	0f 84 3a 01 00 00    	je     80225d <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802123:	8b 45 08             	mov    0x8(%ebp),%eax
+  802126:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802129:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80212e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802131:	0f 85 2d 01 00 00    	jne    802264 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802137:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80213b:	0f 88 2a 01 00 00    	js     80226b <mmap+0x1a1>
+  802141:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  802148:	0f 87 1d 01 00 00    	ja     80226b <mmap+0x1a1>
+  80214e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802153:	2b 45 08             	sub    0x8(%ebp),%eax
+  802156:	39 f8                	cmp    %edi,%eax
+  802158:	0f 82 14 01 00 00    	jb     802272 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  80215e:	83 ec 0c             	sub    $0xc,%esp
+  802161:	52                   	push   %edx
+  802162:	e8 45 f8 ff ff       	call   8019ac <devfile_sync>
+  802167:	89 c3                	mov    %eax,%ebx
+  802169:	83 c4 10             	add    $0x10,%esp
+  80216c:	85 c0                	test   %eax,%eax
+  80216e:	0f 88 89 00 00 00    	js     8021fd <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802174:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  80217a:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802180:	be 00 00 00 00       	mov    $0x0,%esi
+  802185:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802188:	39 fe                	cmp    %edi,%esi
+  80218a:	73 7b                	jae    802207 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  80218c:	89 f8                	mov    %edi,%eax
+  80218e:	29 f0                	sub    %esi,%eax
+  802190:	c1 e8 0c             	shr    $0xc,%eax
+  802193:	ba 40 00 00 00       	mov    $0x40,%edx
+  802198:	39 d0                	cmp    %edx,%eax
+  80219a:	0f 47 c2             	cmova  %edx,%eax
+  80219d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8021a0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8021a3:	8b 52 0c             	mov    0xc(%edx),%edx
+  8021a6:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  8021ac:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8021af:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  8021b5:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8021ba:	89 f2                	mov    %esi,%edx
+  8021bc:	03 55 08             	add    0x8(%ebp),%edx
+  8021bf:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8021c2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8021c7:	e8 ea f6 ff ff       	call   8018b6 <fsipcv>
+  8021cc:	85 c0                	test   %eax,%eax
+  8021ce:	7e 12                	jle    8021e2 <mmap+0x118>
+  8021d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	0f 84 9e 00 00 00    	je     802279 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8021db:	c1 e0 0c             	shl    $0xc,%eax
+  8021de:	01 c6                	add    %eax,%esi
+  8021e0:	eb a6                	jmp    802188 <mmap+0xbe>
+			munmap(addr, done);
+  8021e2:	89 c3                	mov    %eax,%ebx
+  8021e4:	83 ec 08             	sub    $0x8,%esp
+  8021e7:	56                   	push   %esi
+  8021e8:	ff 75 08             	push   0x8(%ebp)
+  8021eb:	e8 78 fe ff ff       	call   802068 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  8021f0:	83 c4 10             	add    $0x10,%esp
+  8021f3:	85 db                	test   %ebx,%ebx
+  8021f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021fa:	0f 49 d8             	cmovns %eax,%ebx
+}
+  8021fd:	89 d8                	mov    %ebx,%eax
+  8021ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802202:	5b                   	pop    %ebx
+  802203:	5e                   	pop    %esi
+  802204:	5f                   	pop    %edi
+  802205:	5d                   	pop    %ebp
+  802206:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802207:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80220a:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80220c:	85 c0                	test   %eax,%eax
+  80220e:	74 ed                	je     8021fd <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802210:	be 00 00 00 00       	mov    $0x0,%esi
+  802215:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802218:	39 fe                	cmp    %edi,%esi
+  80221a:	73 2e                	jae    80224a <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80221c:	83 ec 0c             	sub    $0xc,%esp
+  80221f:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802222:	50                   	push   %eax
+  802223:	e8 57 11 00 00       	call   80337f <cowpage>
+  802228:	83 c4 10             	add    $0x10,%esp
+  80222b:	85 c0                	test   %eax,%eax
+  80222d:	78 08                	js     802237 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  80222f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802235:	eb e1                	jmp    802218 <mmap+0x14e>
+				munmap(addr, len);
+  802237:	89 c3                	mov    %eax,%ebx
+  802239:	83 ec 08             	sub    $0x8,%esp
+  80223c:	57                   	push   %edi
+  80223d:	ff 75 08             	push   0x8(%ebp)
+  802240:	e8 23 fe ff ff       	call   802068 <munmap>
+				return r;
+  802245:	83 c4 10             	add    $0x10,%esp
+  802248:	eb b3                	jmp    8021fd <mmap+0x133>
+	return 0;
+  80224a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80224d:	eb ae                	jmp    8021fd <mmap+0x133>
+		return -E_NOT_SUPP;
+  80224f:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802254:	eb a7                	jmp    8021fd <mmap+0x133>
+		return -E_NOT_SUPP;
+  802256:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80225b:	eb a0                	jmp    8021fd <mmap+0x133>
+		return -E_INVAL;
+  80225d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802262:	eb 99                	jmp    8021fd <mmap+0x133>
+  802264:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802269:	eb 92                	jmp    8021fd <mmap+0x133>
+  80226b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802270:	eb 8b                	jmp    8021fd <mmap+0x133>
+  802272:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802277:	eb 84                	jmp    8021fd <mmap+0x133>
+			munmap(addr, done);
+  802279:	83 ec 08             	sub    $0x8,%esp
+  80227c:	56                   	push   %esi
+  80227d:	ff 75 08             	push   0x8(%ebp)
+  802280:	e8 e3 fd ff ff       	call   802068 <munmap>
+  802285:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802288:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80228d:	e9 6b ff ff ff       	jmp    8021fd <mmap+0x133>
+
+00802292 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802292:	55                   	push   %ebp
+  802293:	89 e5                	mov    %esp,%ebp
+  802295:	56                   	push   %esi
+  802296:	53                   	push   %ebx
+  802297:	83 ec 10             	sub    $0x10,%esp
+  80229a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80229d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8022a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a3:	e8 3d f9 ff ff       	call   801be5 <fsring_slot>
+  8022a8:	85 c0                	test   %eax,%eax
+  8022aa:	78 60                	js     80230c <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8022ac:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8022af:	8b 56 08             	mov    0x8(%esi),%edx
+  8022b2:	83 e2 03             	and    $0x3,%edx
+  8022b5:	83 fa 01             	cmp    $0x1,%edx
+  8022b8:	74 59                	je     802313 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8022ba:	ba 01 00 00 00       	mov    $0x1,%edx
+  8022bf:	89 c1                	mov    %eax,%ecx
+  8022c1:	d3 e2                	shl    %cl,%edx
+  8022c3:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8022c9:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8022cc:	c1 e2 02             	shl    $0x2,%edx
+  8022cf:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  8022d5:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  8022dc:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8022df:	8b 55 18             	mov    0x18(%ebp),%edx
+  8022e2:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8022e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022e8:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8022eb:	83 ec 08             	sub    $0x8,%esp
+  8022ee:	50                   	push   %eax
+  8022ef:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8022f4:	39 c3                	cmp    %eax,%ebx
+  8022f6:	0f 47 d8             	cmova  %eax,%ebx
+  8022f9:	53                   	push   %ebx
+  8022fa:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8022fd:	89 f2                	mov    %esi,%edx
+  8022ff:	b8 03 00 00 00       	mov    $0x3,%eax
+  802304:	e8 1e f5 ff ff       	call   801827 <fsring_post>
+  802309:	83 c4 10             	add    $0x10,%esp
+}
+  80230c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80230f:	5b                   	pop    %ebx
+  802310:	5e                   	pop    %esi
+  802311:	5d                   	pop    %ebp
+  802312:	c3                   	ret
+		return -E_INVAL;
+  802313:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802318:	eb f2                	jmp    80230c <fsring_read+0x7a>
+
+0080231a <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80231a:	55                   	push   %ebp
+  80231b:	89 e5                	mov    %esp,%ebp
+  80231d:	56                   	push   %esi
+  80231e:	53                   	push   %ebx
+  80231f:	83 ec 10             	sub    $0x10,%esp
+  802322:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802325:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802328:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232b:	e8 b5 f8 ff ff       	call   801be5 <fsring_slot>
+  802330:	89 c3                	mov    %eax,%ebx
+  802332:	85 c0                	test   %eax,%eax
+  802334:	78 77                	js     8023ad <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802336:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802339:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80233d:	74 77                	je     8023b6 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80233f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802344:	39 c6                	cmp    %eax,%esi
+  802346:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802349:	83 ec 04             	sub    $0x4,%esp
+  80234c:	56                   	push   %esi
+  80234d:	ff 75 0c             	push   0xc(%ebp)
+  802350:	89 d8                	mov    %ebx,%eax
+  802352:	c1 e0 0c             	shl    $0xc,%eax
+  802355:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80235b:	50                   	push   %eax
+  80235c:	e8 1c e6 ff ff       	call   80097d <memmove>
+	fsring_busy |= 1 << slot;
+  802361:	b8 01 00 00 00       	mov    $0x1,%eax
+  802366:	89 d9                	mov    %ebx,%ecx
+  802368:	d3 e0                	shl    %cl,%eax
+  80236a:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802370:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802373:	c1 e0 02             	shl    $0x2,%eax
+  802376:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  80237c:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  802383:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802386:	8b 45 18             	mov    0x18(%ebp),%eax
+  802389:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80238c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802393:	83 c4 08             	add    $0x8,%esp
+  802396:	53                   	push   %ebx
+  802397:	56                   	push   %esi
+  802398:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80239b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80239e:	b8 04 00 00 00       	mov    $0x4,%eax
+  8023a3:	e8 7f f4 ff ff       	call   801827 <fsring_post>
+  8023a8:	89 c3                	mov    %eax,%ebx
+  8023aa:	83 c4 10             	add    $0x10,%esp
+}
+  8023ad:	89 d8                	mov    %ebx,%eax
+  8023af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023b2:	5b                   	pop    %ebx
+  8023b3:	5e                   	pop    %esi
+  8023b4:	5d                   	pop    %ebp
+  8023b5:	c3                   	ret
+		return -E_INVAL;
+  8023b6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023bb:	eb f0                	jmp    8023ad <fsring_write+0x93>
+
+008023bd <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8023bd:	55                   	push   %ebp
+  8023be:	89 e5                	mov    %esp,%ebp
+  8023c0:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8023c3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8023c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023c9:	e8 17 f8 ff ff       	call   801be5 <fsring_slot>
+  8023ce:	85 c0                	test   %eax,%eax
+  8023d0:	78 4c                	js     80241e <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8023d2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8023d7:	89 c1                	mov    %eax,%ecx
+  8023d9:	d3 e2                	shl    %cl,%edx
+  8023db:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8023e1:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8023e4:	c1 e2 02             	shl    $0x2,%edx
+  8023e7:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  8023ed:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  8023f4:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8023f7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8023fa:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8023fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802400:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802403:	83 ec 08             	sub    $0x8,%esp
+  802406:	50                   	push   %eax
+  802407:	6a 00                	push   $0x0
+  802409:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80240e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802411:	b8 05 00 00 00       	mov    $0x5,%eax
+  802416:	e8 0c f4 ff ff       	call   801827 <fsring_post>
+  80241b:	83 c4 10             	add    $0x10,%esp
+}
+  80241e:	c9                   	leave
+  80241f:	c3                   	ret
+
+00802420 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802420:	55                   	push   %ebp
+  802421:	89 e5                	mov    %esp,%ebp
+  802423:	57                   	push   %edi
+  802424:	56                   	push   %esi
+  802425:	53                   	push   %ebx
+  802426:	83 ec 1c             	sub    $0x1c,%esp
+  802429:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80242d:	a1 00 60 80 00       	mov    0x806000,%eax
+  802432:	8b 40 48             	mov    0x48(%eax),%eax
+  802435:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  80243b:	74 12                	je     80244f <fsring_reap+0x2f>
+		return 0;
+  80243d:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802442:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802445:	5b                   	pop    %ebx
+  802446:	5e                   	pop    %esi
+  802447:	5f                   	pop    %edi
+  802448:	5d                   	pop    %ebp
+  802449:	c3                   	ret
+		sys_yield();
+  80244a:	e8 95 e7 ff ff       	call   800be4 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  80244f:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802455:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80245a:	39 c2                	cmp    %eax,%edx
+  80245c:	75 18                	jne    802476 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  80245e:	84 db                	test   %bl,%bl
+  802460:	0f 84 21 01 00 00    	je     802587 <fsring_reap+0x167>
+  802466:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  80246d:	75 db                	jne    80244a <fsring_reap+0x2a>
+			return 0;
+  80246f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802474:	eb cc                	jmp    802442 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802476:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80247b:	83 e0 0f             	and    $0xf,%eax
+  80247e:	83 c0 2a             	add    $0x2a,%eax
+  802481:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802488:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  80248f:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802494:	83 c0 01             	add    $0x1,%eax
+  802497:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  80249c:	83 fb 0f             	cmp    $0xf,%ebx
+  80249f:	77 5b                	ja     8024fc <fsring_reap+0xdc>
+  8024a1:	be 01 00 00 00       	mov    $0x1,%esi
+  8024a6:	89 d9                	mov    %ebx,%ecx
+  8024a8:	d3 e6                	shl    %cl,%esi
+  8024aa:	89 f0                	mov    %esi,%eax
+  8024ac:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  8024b2:	74 48                	je     8024fc <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8024b4:	89 d8                	mov    %ebx,%eax
+  8024b6:	c1 e0 0c             	shl    $0xc,%eax
+  8024b9:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8024bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8024c2:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8024c5:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  8024cc:	83 f8 03             	cmp    $0x3,%eax
+  8024cf:	74 40                	je     802511 <fsring_reap+0xf1>
+  8024d1:	83 f8 05             	cmp    $0x5,%eax
+  8024d4:	74 64                	je     80253a <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8024d6:	f7 d6                	not    %esi
+  8024d8:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8024de:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8024e1:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  8024e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024eb:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8024ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024f0:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8024f2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024f7:	e9 46 ff ff ff       	jmp    802442 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8024fc:	53                   	push   %ebx
+  8024fd:	68 fd 3e 80 00       	push   $0x803efd
+  802502:	68 8f 02 00 00       	push   $0x28f
+  802507:	68 d5 3e 80 00       	push   $0x803ed5
+  80250c:	e8 11 0d 00 00       	call   803222 <_panic>
+		if (cqe.cqe_result > 0)
+  802511:	85 ff                	test   %edi,%edi
+  802513:	7e c1                	jle    8024d6 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802515:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802518:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80251d:	39 c7                	cmp    %eax,%edi
+  80251f:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802522:	50                   	push   %eax
+  802523:	ff 75 e4             	push   -0x1c(%ebp)
+  802526:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802529:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  802530:	e8 48 e4 ff ff       	call   80097d <memmove>
+  802535:	83 c4 10             	add    $0x10,%esp
+  802538:	eb 9c                	jmp    8024d6 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80253a:	85 ff                	test   %edi,%edi
+  80253c:	75 98                	jne    8024d6 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80253e:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802541:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802548:	83 ec 08             	sub    $0x8,%esp
+  80254b:	ff 75 e4             	push   -0x1c(%ebp)
+  80254e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802551:	51                   	push   %ecx
+  802552:	e8 a0 e2 ff ff       	call   8007f7 <strcpy>
+			st->st_size = ret->ret_size;
+  802557:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80255a:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802560:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802563:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802569:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  80256f:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802575:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  80257c:	50 80 00 
+  80257f:	83 c4 10             	add    $0x10,%esp
+  802582:	e9 4f ff ff ff       	jmp    8024d6 <fsring_reap+0xb6>
+			return 0;
+  802587:	b8 00 00 00 00       	mov    $0x0,%eax
+  80258c:	e9 b1 fe ff ff       	jmp    802442 <fsring_reap+0x22>
+
+00802591 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802591:	55                   	push   %ebp
+  802592:	89 e5                	mov    %esp,%ebp
+  802594:	57                   	push   %edi
+  802595:	56                   	push   %esi
+  802596:	53                   	push   %ebx
+  802597:	83 ec 28             	sub    $0x28,%esp
+  80259a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80259d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8025a0:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8025a3:	53                   	push   %ebx
+  8025a4:	e8 13 e2 ff ff       	call   8007bc <strlen>
+  8025a9:	83 c4 10             	add    $0x10,%esp
+  8025ac:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025b1:	0f 8f 02 01 00 00    	jg     8026b9 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8025b7:	83 ec 08             	sub    $0x8,%esp
+  8025ba:	53                   	push   %ebx
+  8025bb:	68 00 70 80 00       	push   $0x807000
+  8025c0:	e8 32 e2 ff ff       	call   8007f7 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8025c5:	83 c4 10             	add    $0x10,%esp
+  8025c8:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8025ce:	76 69                	jbe    802639 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8025d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025d3:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8025d9:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8025de:	29 d1                	sub    %edx,%ecx
+  8025e0:	39 f9                	cmp    %edi,%ecx
+  8025e2:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8025e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025e8:	89 f9                	mov    %edi,%ecx
+  8025ea:	01 c1                	add    %eax,%ecx
+  8025ec:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8025ef:	eb 0f                	jmp    802600 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  8025f1:	0f b6 10             	movzbl (%eax),%edx
+  8025f4:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8025f6:	05 00 10 00 00       	add    $0x1000,%eax
+  8025fb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802600:	39 c8                	cmp    %ecx,%eax
+  802602:	72 ed                	jb     8025f1 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802604:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802607:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  80260d:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802613:	83 ec 0c             	sub    $0xc,%esp
+  802616:	6a 07                	push   $0x7
+  802618:	89 f9                	mov    %edi,%ecx
+  80261a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80261d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802622:	e8 3f f1 ff ff       	call   801766 <fsipc_pages>
+  802627:	89 c7                	mov    %eax,%edi
+  802629:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  80262c:	85 f6                	test   %esi,%esi
+  80262e:	74 7f                	je     8026af <file_slurp+0x11e>
+  802630:	8d 43 01             	lea    0x1(%ebx),%eax
+  802633:	85 ff                	test   %edi,%edi
+  802635:	79 3c                	jns    802673 <file_slurp+0xe2>
+  802637:	eb 76                	jmp    8026af <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802639:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  80263f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802644:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802649:	e8 ba f2 ff ff       	call   801908 <fsipc>
+  80264e:	89 c7                	mov    %eax,%edi
+  802650:	85 c0                	test   %eax,%eax
+  802652:	7e d8                	jle    80262c <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802654:	83 ec 04             	sub    $0x4,%esp
+  802657:	50                   	push   %eax
+  802658:	68 08 70 80 00       	push   $0x807008
+  80265d:	ff 75 0c             	push   0xc(%ebp)
+  802660:	e8 18 e3 ff ff       	call   80097d <memmove>
+  802665:	83 c4 10             	add    $0x10,%esp
+  802668:	eb c2                	jmp    80262c <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  80266a:	80 fa 2f             	cmp    $0x2f,%dl
+  80266d:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802670:	83 c0 01             	add    $0x1,%eax
+  802673:	89 c1                	mov    %eax,%ecx
+  802675:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802679:	84 d2                	test   %dl,%dl
+  80267b:	75 ed                	jne    80266a <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  80267d:	83 ec 04             	sub    $0x4,%esp
+  802680:	68 80 00 00 00       	push   $0x80
+  802685:	53                   	push   %ebx
+  802686:	56                   	push   %esi
+  802687:	e8 e1 e1 ff ff       	call   80086d <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  80268c:	a1 00 70 80 00       	mov    0x807000,%eax
+  802691:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802697:	a1 04 70 80 00       	mov    0x807004,%eax
+  80269c:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8026a2:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  8026a9:	50 80 00 
+  8026ac:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8026af:	89 f8                	mov    %edi,%eax
+  8026b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026b4:	5b                   	pop    %ebx
+  8026b5:	5e                   	pop    %esi
+  8026b6:	5f                   	pop    %edi
+  8026b7:	5d                   	pop    %ebp
+  8026b8:	c3                   	ret
+		return -E_BAD_PATH;
+  8026b9:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8026be:	eb ef                	jmp    8026af <file_slurp+0x11e>
+
+008026c0 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8026c0:	55                   	push   %ebp
+  8026c1:	89 e5                	mov    %esp,%ebp
+  8026c3:	53                   	push   %ebx
+  8026c4:	83 ec 10             	sub    $0x10,%esp
+  8026c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8026ca:	53                   	push   %ebx
+  8026cb:	e8 ec e0 ff ff       	call   8007bc <strlen>
+  8026d0:	83 c4 10             	add    $0x10,%esp
+  8026d3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8026d8:	7f 25                	jg     8026ff <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8026da:	83 ec 08             	sub    $0x8,%esp
+  8026dd:	53                   	push   %ebx
+  8026de:	68 00 70 80 00       	push   $0x807000
+  8026e3:	e8 0f e1 ff ff       	call   8007f7 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8026e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026ed:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026f2:	e8 11 f2 ff ff       	call   801908 <fsipc>
+  8026f7:	83 c4 10             	add    $0x10,%esp
+}
+  8026fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026fd:	c9                   	leave
+  8026fe:	c3                   	ret
+		return -E_BAD_PATH;
+  8026ff:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802704:	eb f4                	jmp    8026fa <remove+0x3a>
+
+00802706 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802706:	55                   	push   %ebp
+  802707:	89 e5                	mov    %esp,%ebp
+  802709:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80270c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802711:	b8 08 00 00 00       	mov    $0x8,%eax
+  802716:	e8 ed f1 ff ff       	call   801908 <fsipc>
+}
+  80271b:	c9                   	leave
+  80271c:	c3                   	ret
+
+0080271d <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  80271d:	55                   	push   %ebp
+  80271e:	89 e5                	mov    %esp,%ebp
+  802720:	57                   	push   %edi
+  802721:	56                   	push   %esi
+  802722:	53                   	push   %ebx
+  802723:	83 ec 18             	sub    $0x18,%esp
+  802726:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802729:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80272c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80272f:	57                   	push   %edi
+  802730:	e8 87 e0 ff ff       	call   8007bc <strlen>
+  802735:	83 c4 10             	add    $0x10,%esp
+  802738:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80273d:	7f 4c                	jg     80278b <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  80273f:	83 ec 08             	sub    $0x8,%esp
+  802742:	57                   	push   %edi
+  802743:	68 00 70 80 00       	push   $0x807000
+  802748:	e8 aa e0 ff ff       	call   8007f7 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  80274d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802752:	b8 10 00 00 00       	mov    $0x10,%eax
+  802757:	e8 ac f1 ff ff       	call   801908 <fsipc>
+  80275c:	83 c4 10             	add    $0x10,%esp
+  80275f:	85 c0                	test   %eax,%eax
+  802761:	78 20                	js     802783 <defrag+0x66>
+		return r;
+	if (before)
+  802763:	85 f6                	test   %esi,%esi
+  802765:	74 07                	je     80276e <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802767:	a1 00 70 80 00       	mov    0x807000,%eax
+  80276c:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  80276e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802773:	85 db                	test   %ebx,%ebx
+  802775:	74 0c                	je     802783 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802777:	a1 04 70 80 00       	mov    0x807004,%eax
+  80277c:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  80277e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802783:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802786:	5b                   	pop    %ebx
+  802787:	5e                   	pop    %esi
+  802788:	5f                   	pop    %edi
+  802789:	5d                   	pop    %ebp
+  80278a:	c3                   	ret
+		return -E_BAD_PATH;
+  80278b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802790:	eb f1                	jmp    802783 <defrag+0x66>
+
+00802792 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802792:	55                   	push   %ebp
+  802793:	89 e5                	mov    %esp,%ebp
+  802795:	53                   	push   %ebx
+  802796:	83 ec 04             	sub    $0x4,%esp
+  802799:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  80279c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027a1:	b8 11 00 00 00       	mov    $0x11,%eax
+  8027a6:	e8 5d f1 ff ff       	call   801908 <fsipc>
+  8027ab:	85 c0                	test   %eax,%eax
+  8027ad:	78 34                	js     8027e3 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  8027af:	a1 00 70 80 00       	mov    0x807000,%eax
+  8027b4:	89 03                	mov    %eax,(%ebx)
+  8027b6:	a1 04 70 80 00       	mov    0x807004,%eax
+  8027bb:	89 43 04             	mov    %eax,0x4(%ebx)
+  8027be:	a1 08 70 80 00       	mov    0x807008,%eax
+  8027c3:	89 43 08             	mov    %eax,0x8(%ebx)
+  8027c6:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  8027cb:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8027ce:	a1 10 70 80 00       	mov    0x807010,%eax
+  8027d3:	89 43 10             	mov    %eax,0x10(%ebx)
+  8027d6:	a1 14 70 80 00       	mov    0x807014,%eax
+  8027db:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  8027de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027e6:	c9                   	leave
+  8027e7:	c3                   	ret
+
+008027e8 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  8027e8:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8027ec:	7f 01                	jg     8027ef <writebuf+0x7>
+  8027ee:	c3                   	ret
+{
+  8027ef:	55                   	push   %ebp
+  8027f0:	89 e5                	mov    %esp,%ebp
+  8027f2:	53                   	push   %ebx
+  8027f3:	83 ec 08             	sub    $0x8,%esp
+  8027f6:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  8027f8:	ff 70 04             	push   0x4(%eax)
+  8027fb:	8d 40 10             	lea    0x10(%eax),%eax
+  8027fe:	50                   	push   %eax
+  8027ff:	ff 33                	push   (%ebx)
+  802801:	e8 fe ec ff ff       	call   801504 <write>
+		if (result > 0)
+  802806:	83 c4 10             	add    $0x10,%esp
+  802809:	85 c0                	test   %eax,%eax
+  80280b:	7e 03                	jle    802810 <writebuf+0x28>
+			b->result += result;
+  80280d:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802810:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802813:	74 0d                	je     802822 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802815:	85 c0                	test   %eax,%eax
+  802817:	ba 00 00 00 00       	mov    $0x0,%edx
+  80281c:	0f 4f c2             	cmovg  %edx,%eax
+  80281f:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802822:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802825:	c9                   	leave
+  802826:	c3                   	ret
+
+00802827 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802827:	55                   	push   %ebp
+  802828:	89 e5                	mov    %esp,%ebp
+  80282a:	53                   	push   %ebx
+  80282b:	83 ec 04             	sub    $0x4,%esp
+  80282e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802831:	8b 53 04             	mov    0x4(%ebx),%edx
+  802834:	8d 42 01             	lea    0x1(%edx),%eax
+  802837:	89 43 04             	mov    %eax,0x4(%ebx)
+  80283a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80283d:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802841:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802846:	74 05                	je     80284d <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  802848:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80284b:	c9                   	leave
+  80284c:	c3                   	ret
+		writebuf(b);
+  80284d:	89 d8                	mov    %ebx,%eax
+  80284f:	e8 94 ff ff ff       	call   8027e8 <writebuf>
+		b->idx = 0;
+  802854:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  80285b:	eb eb                	jmp    802848 <putch+0x21>
+
+0080285d <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  80285d:	55                   	push   %ebp
+  80285e:	89 e5                	mov    %esp,%ebp
+  802860:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  802866:	8b 45 08             	mov    0x8(%ebp),%eax
+  802869:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  80286f:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  802876:	00 00 00 
+	b.result = 0;
+  802879:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802880:	00 00 00 
+	b.error = 1;
+  802883:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  80288a:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  80288d:	ff 75 10             	push   0x10(%ebp)
+  802890:	ff 75 0c             	push   0xc(%ebp)
+  802893:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802899:	50                   	push   %eax
+  80289a:	68 27 28 80 00       	push   $0x802827
+  80289f:	e8 5c da ff ff       	call   800300 <vprintfmt>
+	if (b.idx > 0)
+  8028a4:	83 c4 10             	add    $0x10,%esp
+  8028a7:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8028ae:	7f 12                	jg     8028c2 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8028b0:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8028b6:	85 c0                	test   %eax,%eax
+  8028b8:	75 06                	jne    8028c0 <vfprintf+0x63>
+  8028ba:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8028c0:	c9                   	leave
+  8028c1:	c3                   	ret
+		writebuf(&b);
+  8028c2:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8028c8:	e8 1b ff ff ff       	call   8027e8 <writebuf>
+  8028cd:	eb e1                	jmp    8028b0 <vfprintf+0x53>
+
+008028cf <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8028cf:	55                   	push   %ebp
+  8028d0:	89 e5                	mov    %esp,%ebp
+  8028d2:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8028d5:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8028d8:	50                   	push   %eax
+  8028d9:	ff 75 0c             	push   0xc(%ebp)
+  8028dc:	ff 75 08             	push   0x8(%ebp)
+  8028df:	e8 79 ff ff ff       	call   80285d <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8028e4:	c9                   	leave
+  8028e5:	c3                   	ret
+
+008028e6 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8028e6:	55                   	push   %ebp
+  8028e7:	89 e5                	mov    %esp,%ebp
+  8028e9:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8028ec:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  8028ef:	50                   	push   %eax
+  8028f0:	ff 75 08             	push   0x8(%ebp)
+  8028f3:	6a 01                	push   $0x1
+  8028f5:	e8 63 ff ff ff       	call   80285d <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8028fa:	c9                   	leave
+  8028fb:	c3                   	ret
+
+008028fc <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8028fc:	55                   	push   %ebp
+  8028fd:	89 e5                	mov    %esp,%ebp
+  8028ff:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802902:	68 16 3f 80 00       	push   $0x803f16
+  802907:	ff 75 0c             	push   0xc(%ebp)
+  80290a:	e8 e8 de ff ff       	call   8007f7 <strcpy>
+	return 0;
+}
+  80290f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802914:	c9                   	leave
+  802915:	c3                   	ret
+
+00802916 <devsock_close>:
+{
+  802916:	55                   	push   %ebp
+  802917:	89 e5                	mov    %esp,%ebp
+  802919:	53                   	push   %ebx
+  80291a:	83 ec 10             	sub    $0x10,%esp
+  80291d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802920:	53                   	push   %ebx
+  802921:	e8 3a 0e 00 00       	call   803760 <pageref>
+  802926:	89 c2                	mov    %eax,%edx
+  802928:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80292b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802930:	83 fa 01             	cmp    $0x1,%edx
+  802933:	74 05                	je     80293a <devsock_close+0x24>
+}
+  802935:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802938:	c9                   	leave
+  802939:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80293a:	83 ec 0c             	sub    $0xc,%esp
+  80293d:	ff 73 0c             	push   0xc(%ebx)
+  802940:	e8 b7 02 00 00       	call   802bfc <nsipc_close>
+  802945:	83 c4 10             	add    $0x10,%esp
+  802948:	eb eb                	jmp    802935 <devsock_close+0x1f>
+
+0080294a <devsock_write>:
+{
+  80294a:	55                   	push   %ebp
+  80294b:	89 e5                	mov    %esp,%ebp
+  80294d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802950:	6a 00                	push   $0x0
+  802952:	ff 75 10             	push   0x10(%ebp)
+  802955:	ff 75 0c             	push   0xc(%ebp)
+  802958:	8b 45 08             	mov    0x8(%ebp),%eax
+  80295b:	ff 70 0c             	push   0xc(%eax)
+  80295e:	e8 79 03 00 00       	call   802cdc <nsipc_send>
+}
+  802963:	c9                   	leave
+  802964:	c3                   	ret
+
+00802965 <devsock_read>:
+{
+  802965:	55                   	push   %ebp
+  802966:	89 e5                	mov    %esp,%ebp
+  802968:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80296b:	6a 00                	push   $0x0
+  80296d:	ff 75 10             	push   0x10(%ebp)
+  802970:	ff 75 0c             	push   0xc(%ebp)
+  802973:	8b 45 08             	mov    0x8(%ebp),%eax
+  802976:	ff 70 0c             	push   0xc(%eax)
+  802979:	e8 ef 02 00 00       	call   802c6d <nsipc_recv>
+}
+  80297e:	c9                   	leave
+  80297f:	c3                   	ret
+
+00802980 <fd2sockid>:
+{
+  802980:	55                   	push   %ebp
+  802981:	89 e5                	mov    %esp,%ebp
+  802983:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802986:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802989:	52                   	push   %edx
+  80298a:	50                   	push   %eax
+  80298b:	e8 40 e8 ff ff       	call   8011d0 <fd_lookup>
+  802990:	83 c4 10             	add    $0x10,%esp
+  802993:	85 c0                	test   %eax,%eax
+  802995:	78 10                	js     8029a7 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802997:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80299a:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  8029a0:	39 08                	cmp    %ecx,(%eax)
+  8029a2:	75 05                	jne    8029a9 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8029a4:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8029a7:	c9                   	leave
+  8029a8:	c3                   	ret
+		return -E_NOT_SUPP;
+  8029a9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8029ae:	eb f7                	jmp    8029a7 <fd2sockid+0x27>
+
+008029b0 <alloc_sockfd>:
+{
+  8029b0:	55                   	push   %ebp
+  8029b1:	89 e5                	mov    %esp,%ebp
+  8029b3:	56                   	push   %esi
+  8029b4:	53                   	push   %ebx
+  8029b5:	83 ec 1c             	sub    $0x1c,%esp
+  8029b8:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8029ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029bd:	50                   	push   %eax
+  8029be:	e8 b7 e7 ff ff       	call   80117a <fd_alloc>
+  8029c3:	89 c3                	mov    %eax,%ebx
+  8029c5:	83 c4 10             	add    $0x10,%esp
+  8029c8:	85 c0                	test   %eax,%eax
+  8029ca:	78 43                	js     802a0f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8029cc:	83 ec 04             	sub    $0x4,%esp
+  8029cf:	68 07 04 00 00       	push   $0x407
+  8029d4:	ff 75 f4             	push   -0xc(%ebp)
+  8029d7:	6a 00                	push   $0x0
+  8029d9:	e8 25 e2 ff ff       	call   800c03 <sys_page_alloc>
+  8029de:	89 c3                	mov    %eax,%ebx
+  8029e0:	83 c4 10             	add    $0x10,%esp
+  8029e3:	85 c0                	test   %eax,%eax
+  8029e5:	78 28                	js     802a0f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8029e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029ea:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  8029f0:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8029f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029f5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8029fc:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8029ff:	83 ec 0c             	sub    $0xc,%esp
+  802a02:	50                   	push   %eax
+  802a03:	e8 4b e7 ff ff       	call   801153 <fd2num>
+  802a08:	89 c3                	mov    %eax,%ebx
+  802a0a:	83 c4 10             	add    $0x10,%esp
+  802a0d:	eb 0c                	jmp    802a1b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802a0f:	83 ec 0c             	sub    $0xc,%esp
+  802a12:	56                   	push   %esi
+  802a13:	e8 e4 01 00 00       	call   802bfc <nsipc_close>
+		return r;
+  802a18:	83 c4 10             	add    $0x10,%esp
+}
+  802a1b:	89 d8                	mov    %ebx,%eax
+  802a1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a20:	5b                   	pop    %ebx
+  802a21:	5e                   	pop    %esi
+  802a22:	5d                   	pop    %ebp
+  802a23:	c3                   	ret
+
+00802a24 <accept>:
+{
+  802a24:	55                   	push   %ebp
+  802a25:	89 e5                	mov    %esp,%ebp
+  802a27:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a2d:	e8 4e ff ff ff       	call   802980 <fd2sockid>
+  802a32:	85 c0                	test   %eax,%eax
+  802a34:	78 1b                	js     802a51 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802a36:	83 ec 04             	sub    $0x4,%esp
+  802a39:	ff 75 10             	push   0x10(%ebp)
+  802a3c:	ff 75 0c             	push   0xc(%ebp)
+  802a3f:	50                   	push   %eax
+  802a40:	e8 0e 01 00 00       	call   802b53 <nsipc_accept>
+  802a45:	83 c4 10             	add    $0x10,%esp
+  802a48:	85 c0                	test   %eax,%eax
+  802a4a:	78 05                	js     802a51 <accept+0x2d>
+	return alloc_sockfd(r);
+  802a4c:	e8 5f ff ff ff       	call   8029b0 <alloc_sockfd>
+}
+  802a51:	c9                   	leave
+  802a52:	c3                   	ret
+
+00802a53 <bind>:
+{
+  802a53:	55                   	push   %ebp
+  802a54:	89 e5                	mov    %esp,%ebp
+  802a56:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a59:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a5c:	e8 1f ff ff ff       	call   802980 <fd2sockid>
+  802a61:	85 c0                	test   %eax,%eax
+  802a63:	78 12                	js     802a77 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802a65:	83 ec 04             	sub    $0x4,%esp
+  802a68:	ff 75 10             	push   0x10(%ebp)
+  802a6b:	ff 75 0c             	push   0xc(%ebp)
+  802a6e:	50                   	push   %eax
+  802a6f:	e8 31 01 00 00       	call   802ba5 <nsipc_bind>
+  802a74:	83 c4 10             	add    $0x10,%esp
+}
+  802a77:	c9                   	leave
+  802a78:	c3                   	ret
+
+00802a79 <shutdown>:
+{
+  802a79:	55                   	push   %ebp
+  802a7a:	89 e5                	mov    %esp,%ebp
+  802a7c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a82:	e8 f9 fe ff ff       	call   802980 <fd2sockid>
+  802a87:	85 c0                	test   %eax,%eax
+  802a89:	78 0f                	js     802a9a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802a8b:	83 ec 08             	sub    $0x8,%esp
+  802a8e:	ff 75 0c             	push   0xc(%ebp)
+  802a91:	50                   	push   %eax
+  802a92:	e8 43 01 00 00       	call   802bda <nsipc_shutdown>
+  802a97:	83 c4 10             	add    $0x10,%esp
+}
+  802a9a:	c9                   	leave
+  802a9b:	c3                   	ret
+
+00802a9c <connect>:
+{
+  802a9c:	55                   	push   %ebp
+  802a9d:	89 e5                	mov    %esp,%ebp
+  802a9f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802aa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa5:	e8 d6 fe ff ff       	call   802980 <fd2sockid>
+  802aaa:	85 c0                	test   %eax,%eax
+  802aac:	78 12                	js     802ac0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802aae:	83 ec 04             	sub    $0x4,%esp
+  802ab1:	ff 75 10             	push   0x10(%ebp)
+  802ab4:	ff 75 0c             	push   0xc(%ebp)
+  802ab7:	50                   	push   %eax
+  802ab8:	e8 59 01 00 00       	call   802c16 <nsipc_connect>
+  802abd:	83 c4 10             	add    $0x10,%esp
+}
+  802ac0:	c9                   	leave
+  802ac1:	c3                   	ret
+
+00802ac2 <listen>:
+{
+  802ac2:	55                   	push   %ebp
+  802ac3:	89 e5                	mov    %esp,%ebp
+  802ac5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ac8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802acb:	e8 b0 fe ff ff       	call   802980 <fd2sockid>
+  802ad0:	85 c0                	test   %eax,%eax
+  802ad2:	78 0f                	js     802ae3 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802ad4:	83 ec 08             	sub    $0x8,%esp
+  802ad7:	ff 75 0c             	push   0xc(%ebp)
+  802ada:	50                   	push   %eax
+  802adb:	e8 6b 01 00 00       	call   802c4b <nsipc_listen>
+  802ae0:	83 c4 10             	add    $0x10,%esp
+}
+  802ae3:	c9                   	leave
+  802ae4:	c3                   	ret
+
+00802ae5 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802ae5:	55                   	push   %ebp
+  802ae6:	89 e5                	mov    %esp,%ebp
+  802ae8:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802aeb:	ff 75 10             	push   0x10(%ebp)
+  802aee:	ff 75 0c             	push   0xc(%ebp)
+  802af1:	ff 75 08             	push   0x8(%ebp)
+  802af4:	e8 41 02 00 00       	call   802d3a <nsipc_socket>
+  802af9:	83 c4 10             	add    $0x10,%esp
+  802afc:	85 c0                	test   %eax,%eax
+  802afe:	78 05                	js     802b05 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802b00:	e8 ab fe ff ff       	call   8029b0 <alloc_sockfd>
+}
+  802b05:	c9                   	leave
+  802b06:	c3                   	ret
+
+00802b07 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802b07:	55                   	push   %ebp
+  802b08:	89 e5                	mov    %esp,%ebp
+  802b0a:	53                   	push   %ebx
+  802b0b:	83 ec 04             	sub    $0x4,%esp
+  802b0e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802b10:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802b17:	74 26                	je     802b3f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802b19:	6a 07                	push   $0x7
+  802b1b:	68 00 90 80 00       	push   $0x809000
+  802b20:	53                   	push   %ebx
+  802b21:	ff 35 00 a0 80 00    	push   0x80a000
+  802b27:	e8 bc 0a 00 00       	call   8035e8 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802b2c:	83 c4 0c             	add    $0xc,%esp
+  802b2f:	6a 00                	push   $0x0
+  802b31:	6a 00                	push   $0x0
+  802b33:	6a 00                	push   $0x0
+  802b35:	e8 43 0a 00 00       	call   80357d <ipc_recv>
+}
+  802b3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b3d:	c9                   	leave
+  802b3e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802b3f:	83 ec 0c             	sub    $0xc,%esp
+  802b42:	6a 02                	push   $0x2
+  802b44:	e8 d8 0b 00 00       	call   803721 <ipc_find_env>
+  802b49:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  802b4e:	83 c4 10             	add    $0x10,%esp
+  802b51:	eb c6                	jmp    802b19 <nsipc+0x12>
+
+00802b53 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802b53:	55                   	push   %ebp
+  802b54:	89 e5                	mov    %esp,%ebp
+  802b56:	56                   	push   %esi
+  802b57:	53                   	push   %ebx
+  802b58:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b5e:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802b63:	8b 06                	mov    (%esi),%eax
+  802b65:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802b6a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b6f:	e8 93 ff ff ff       	call   802b07 <nsipc>
+  802b74:	89 c3                	mov    %eax,%ebx
+  802b76:	85 c0                	test   %eax,%eax
+  802b78:	79 09                	jns    802b83 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802b7a:	89 d8                	mov    %ebx,%eax
+  802b7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b7f:	5b                   	pop    %ebx
+  802b80:	5e                   	pop    %esi
+  802b81:	5d                   	pop    %ebp
+  802b82:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802b83:	83 ec 04             	sub    $0x4,%esp
+  802b86:	ff 35 10 90 80 00    	push   0x809010
+  802b8c:	68 00 90 80 00       	push   $0x809000
+  802b91:	ff 75 0c             	push   0xc(%ebp)
+  802b94:	e8 e4 dd ff ff       	call   80097d <memmove>
+		*addrlen = ret->ret_addrlen;
+  802b99:	a1 10 90 80 00       	mov    0x809010,%eax
+  802b9e:	89 06                	mov    %eax,(%esi)
+  802ba0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802ba3:	eb d5                	jmp    802b7a <nsipc_accept+0x27>
+
+00802ba5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802ba5:	55                   	push   %ebp
+  802ba6:	89 e5                	mov    %esp,%ebp
+  802ba8:	53                   	push   %ebx
+  802ba9:	83 ec 08             	sub    $0x8,%esp
+  802bac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802baf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb2:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802bb7:	53                   	push   %ebx
+  802bb8:	ff 75 0c             	push   0xc(%ebp)
+  802bbb:	68 04 90 80 00       	push   $0x809004
+  802bc0:	e8 b8 dd ff ff       	call   80097d <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802bc5:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802bcb:	b8 02 00 00 00       	mov    $0x2,%eax
+  802bd0:	e8 32 ff ff ff       	call   802b07 <nsipc>
+}
+  802bd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bd8:	c9                   	leave
+  802bd9:	c3                   	ret
+
+00802bda <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802bda:	55                   	push   %ebp
+  802bdb:	89 e5                	mov    %esp,%ebp
+  802bdd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802be0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be3:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802be8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802beb:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802bf0:	b8 03 00 00 00       	mov    $0x3,%eax
+  802bf5:	e8 0d ff ff ff       	call   802b07 <nsipc>
+}
+  802bfa:	c9                   	leave
+  802bfb:	c3                   	ret
+
+00802bfc <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802bfc:	55                   	push   %ebp
+  802bfd:	89 e5                	mov    %esp,%ebp
+  802bff:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802c02:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c05:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802c0a:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c0f:	e8 f3 fe ff ff       	call   802b07 <nsipc>
+}
+  802c14:	c9                   	leave
+  802c15:	c3                   	ret
+
+00802c16 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802c16:	55                   	push   %ebp
+  802c17:	89 e5                	mov    %esp,%ebp
+  802c19:	53                   	push   %ebx
+  802c1a:	83 ec 08             	sub    $0x8,%esp
+  802c1d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802c20:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c23:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802c28:	53                   	push   %ebx
+  802c29:	ff 75 0c             	push   0xc(%ebp)
+  802c2c:	68 04 90 80 00       	push   $0x809004
+  802c31:	e8 47 dd ff ff       	call   80097d <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802c36:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802c3c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802c41:	e8 c1 fe ff ff       	call   802b07 <nsipc>
+}
+  802c46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c49:	c9                   	leave
+  802c4a:	c3                   	ret
+
+00802c4b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802c4b:	55                   	push   %ebp
+  802c4c:	89 e5                	mov    %esp,%ebp
+  802c4e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802c51:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c54:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802c59:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c5c:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802c61:	b8 06 00 00 00       	mov    $0x6,%eax
+  802c66:	e8 9c fe ff ff       	call   802b07 <nsipc>
+}
+  802c6b:	c9                   	leave
+  802c6c:	c3                   	ret
+
+00802c6d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802c6d:	55                   	push   %ebp
+  802c6e:	89 e5                	mov    %esp,%ebp
+  802c70:	56                   	push   %esi
+  802c71:	53                   	push   %ebx
+  802c72:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802c75:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c78:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802c7d:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802c83:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c86:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802c8b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802c90:	e8 72 fe ff ff       	call   802b07 <nsipc>
+  802c95:	89 c3                	mov    %eax,%ebx
+  802c97:	85 c0                	test   %eax,%eax
+  802c99:	78 22                	js     802cbd <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802c9b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ca0:	39 c6                	cmp    %eax,%esi
+  802ca2:	0f 4e c6             	cmovle %esi,%eax
+  802ca5:	39 c3                	cmp    %eax,%ebx
+  802ca7:	7f 1d                	jg     802cc6 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ca9:	83 ec 04             	sub    $0x4,%esp
+  802cac:	53                   	push   %ebx
+  802cad:	68 00 90 80 00       	push   $0x809000
+  802cb2:	ff 75 0c             	push   0xc(%ebp)
+  802cb5:	e8 c3 dc ff ff       	call   80097d <memmove>
+  802cba:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802cbd:	89 d8                	mov    %ebx,%eax
+  802cbf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cc2:	5b                   	pop    %ebx
+  802cc3:	5e                   	pop    %esi
+  802cc4:	5d                   	pop    %ebp
+  802cc5:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802cc6:	68 22 3f 80 00       	push   $0x803f22
+  802ccb:	68 c0 3e 80 00       	push   $0x803ec0
+  802cd0:	6a 62                	push   $0x62
+  802cd2:	68 37 3f 80 00       	push   $0x803f37
+  802cd7:	e8 46 05 00 00       	call   803222 <_panic>
+
+00802cdc <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802cdc:	55                   	push   %ebp
+  802cdd:	89 e5                	mov    %esp,%ebp
+  802cdf:	53                   	push   %ebx
+  802ce0:	83 ec 04             	sub    $0x4,%esp
+  802ce3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce9:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802cee:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802cf4:	7f 2e                	jg     802d24 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802cf6:	83 ec 04             	sub    $0x4,%esp
+  802cf9:	53                   	push   %ebx
+  802cfa:	ff 75 0c             	push   0xc(%ebp)
+  802cfd:	68 0c 90 80 00       	push   $0x80900c
+  802d02:	e8 76 dc ff ff       	call   80097d <memmove>
+	nsipcbuf.send.req_size = size;
+  802d07:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802d0d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d10:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802d15:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d1a:	e8 e8 fd ff ff       	call   802b07 <nsipc>
+}
+  802d1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d22:	c9                   	leave
+  802d23:	c3                   	ret
+	assert(size < 1600);
+  802d24:	68 43 3f 80 00       	push   $0x803f43
+  802d29:	68 c0 3e 80 00       	push   $0x803ec0
+  802d2e:	6a 6d                	push   $0x6d
+  802d30:	68 37 3f 80 00       	push   $0x803f37
+  802d35:	e8 e8 04 00 00       	call   803222 <_panic>
+
+00802d3a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802d3a:	55                   	push   %ebp
+  802d3b:	89 e5                	mov    %esp,%ebp
+  802d3d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802d40:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d43:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802d48:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d4b:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802d50:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d53:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802d58:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d5d:	e8 a5 fd ff ff       	call   802b07 <nsipc>
+}
+  802d62:	c9                   	leave
+  802d63:	c3                   	ret
+
+00802d64 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d64:	55                   	push   %ebp
+  802d65:	89 e5                	mov    %esp,%ebp
+  802d67:	56                   	push   %esi
+  802d68:	53                   	push   %ebx
+  802d69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802d6c:	83 ec 0c             	sub    $0xc,%esp
+  802d6f:	ff 75 08             	push   0x8(%ebp)
+  802d72:	e8 ec e3 ff ff       	call   801163 <fd2data>
+  802d77:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802d79:	83 c4 08             	add    $0x8,%esp
+  802d7c:	68 4f 3f 80 00       	push   $0x803f4f
+  802d81:	53                   	push   %ebx
+  802d82:	e8 70 da ff ff       	call   8007f7 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802d87:	8b 46 04             	mov    0x4(%esi),%eax
+  802d8a:	2b 06                	sub    (%esi),%eax
+  802d8c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802d92:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802d99:	00 00 00 
+	stat->st_dev = &devpipe;
+  802d9c:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  802da3:	50 80 00 
+	return 0;
+}
+  802da6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dae:	5b                   	pop    %ebx
+  802daf:	5e                   	pop    %esi
+  802db0:	5d                   	pop    %ebp
+  802db1:	c3                   	ret
+
+00802db2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802db2:	55                   	push   %ebp
+  802db3:	89 e5                	mov    %esp,%ebp
+  802db5:	53                   	push   %ebx
+  802db6:	83 ec 0c             	sub    $0xc,%esp
+  802db9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802dbc:	53                   	push   %ebx
+  802dbd:	6a 00                	push   $0x0
+  802dbf:	e8 cc de ff ff       	call   800c90 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802dc4:	89 1c 24             	mov    %ebx,(%esp)
+  802dc7:	e8 97 e3 ff ff       	call   801163 <fd2data>
+  802dcc:	83 c4 08             	add    $0x8,%esp
+  802dcf:	50                   	push   %eax
+  802dd0:	6a 00                	push   $0x0
+  802dd2:	e8 b9 de ff ff       	call   800c90 <sys_page_unmap>
+}
+  802dd7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dda:	c9                   	leave
+  802ddb:	c3                   	ret
+
+00802ddc <_pipeisclosed>:
+{
+  802ddc:	55                   	push   %ebp
+  802ddd:	89 e5                	mov    %esp,%ebp
+  802ddf:	57                   	push   %edi
+  802de0:	56                   	push   %esi
+  802de1:	53                   	push   %ebx
+  802de2:	83 ec 1c             	sub    $0x1c,%esp
+  802de5:	89 c7                	mov    %eax,%edi
+  802de7:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802de9:	a1 00 60 80 00       	mov    0x806000,%eax
+  802dee:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802df1:	83 ec 0c             	sub    $0xc,%esp
+  802df4:	57                   	push   %edi
+  802df5:	e8 66 09 00 00       	call   803760 <pageref>
+  802dfa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802dfd:	89 34 24             	mov    %esi,(%esp)
+  802e00:	e8 5b 09 00 00       	call   803760 <pageref>
+		nn = thisenv->env_runs;
+  802e05:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  802e0b:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802e0e:	83 c4 10             	add    $0x10,%esp
+  802e11:	39 cb                	cmp    %ecx,%ebx
+  802e13:	74 1b                	je     802e30 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802e15:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e18:	75 cf                	jne    802de9 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802e1a:	8b 42 58             	mov    0x58(%edx),%eax
+  802e1d:	6a 01                	push   $0x1
+  802e1f:	50                   	push   %eax
+  802e20:	53                   	push   %ebx
+  802e21:	68 56 3f 80 00       	push   $0x803f56
+  802e26:	e8 de d3 ff ff       	call   800209 <cprintf>
+  802e2b:	83 c4 10             	add    $0x10,%esp
+  802e2e:	eb b9                	jmp    802de9 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802e30:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e33:	0f 94 c0             	sete   %al
+  802e36:	0f b6 c0             	movzbl %al,%eax
+}
+  802e39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e3c:	5b                   	pop    %ebx
+  802e3d:	5e                   	pop    %esi
+  802e3e:	5f                   	pop    %edi
+  802e3f:	5d                   	pop    %ebp
+  802e40:	c3                   	ret
+
+00802e41 <devpipe_write>:
+{
+  802e41:	55                   	push   %ebp
+  802e42:	89 e5                	mov    %esp,%ebp
+  802e44:	57                   	push   %edi
+  802e45:	56                   	push   %esi
+  802e46:	53                   	push   %ebx
+  802e47:	83 ec 28             	sub    $0x28,%esp
+  802e4a:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802e4d:	56                   	push   %esi
+  802e4e:	e8 10 e3 ff ff       	call   801163 <fd2data>
+  802e53:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802e55:	83 c4 10             	add    $0x10,%esp
+  802e58:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e5d:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802e60:	75 09                	jne    802e6b <devpipe_write+0x2a>
+	return i;
+  802e62:	89 f8                	mov    %edi,%eax
+  802e64:	eb 23                	jmp    802e89 <devpipe_write+0x48>
+			sys_yield();
+  802e66:	e8 79 dd ff ff       	call   800be4 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802e6b:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e6e:	8b 0b                	mov    (%ebx),%ecx
+  802e70:	8d 51 20             	lea    0x20(%ecx),%edx
+  802e73:	39 d0                	cmp    %edx,%eax
+  802e75:	72 1a                	jb     802e91 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802e77:	89 da                	mov    %ebx,%edx
+  802e79:	89 f0                	mov    %esi,%eax
+  802e7b:	e8 5c ff ff ff       	call   802ddc <_pipeisclosed>
+  802e80:	85 c0                	test   %eax,%eax
+  802e82:	74 e2                	je     802e66 <devpipe_write+0x25>
+				return 0;
+  802e84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e8c:	5b                   	pop    %ebx
+  802e8d:	5e                   	pop    %esi
+  802e8e:	5f                   	pop    %edi
+  802e8f:	5d                   	pop    %ebp
+  802e90:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802e91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e94:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802e98:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802e9b:	89 c2                	mov    %eax,%edx
+  802e9d:	c1 fa 1f             	sar    $0x1f,%edx
+  802ea0:	89 d1                	mov    %edx,%ecx
+  802ea2:	c1 e9 1b             	shr    $0x1b,%ecx
+  802ea5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802ea8:	83 e2 1f             	and    $0x1f,%edx
+  802eab:	29 ca                	sub    %ecx,%edx
+  802ead:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802eb1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802eb5:	83 c0 01             	add    $0x1,%eax
+  802eb8:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802ebb:	83 c7 01             	add    $0x1,%edi
+  802ebe:	eb 9d                	jmp    802e5d <devpipe_write+0x1c>
+
+00802ec0 <devpipe_read>:
+{
+  802ec0:	55                   	push   %ebp
+  802ec1:	89 e5                	mov    %esp,%ebp
+  802ec3:	57                   	push   %edi
+  802ec4:	56                   	push   %esi
+  802ec5:	53                   	push   %ebx
+  802ec6:	83 ec 18             	sub    $0x18,%esp
+  802ec9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802ecc:	57                   	push   %edi
+  802ecd:	e8 91 e2 ff ff       	call   801163 <fd2data>
+  802ed2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802ed4:	83 c4 10             	add    $0x10,%esp
+  802ed7:	be 00 00 00 00       	mov    $0x0,%esi
+  802edc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802edf:	75 13                	jne    802ef4 <devpipe_read+0x34>
+	return i;
+  802ee1:	89 f0                	mov    %esi,%eax
+  802ee3:	eb 02                	jmp    802ee7 <devpipe_read+0x27>
+				return i;
+  802ee5:	89 f0                	mov    %esi,%eax
+}
+  802ee7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802eea:	5b                   	pop    %ebx
+  802eeb:	5e                   	pop    %esi
+  802eec:	5f                   	pop    %edi
+  802eed:	5d                   	pop    %ebp
+  802eee:	c3                   	ret
+			sys_yield();
+  802eef:	e8 f0 dc ff ff       	call   800be4 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802ef4:	8b 03                	mov    (%ebx),%eax
+  802ef6:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802ef9:	75 18                	jne    802f13 <devpipe_read+0x53>
+			if (i > 0)
+  802efb:	85 f6                	test   %esi,%esi
+  802efd:	75 e6                	jne    802ee5 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802eff:	89 da                	mov    %ebx,%edx
+  802f01:	89 f8                	mov    %edi,%eax
+  802f03:	e8 d4 fe ff ff       	call   802ddc <_pipeisclosed>
+  802f08:	85 c0                	test   %eax,%eax
+  802f0a:	74 e3                	je     802eef <devpipe_read+0x2f>
+				return 0;
+  802f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f11:	eb d4                	jmp    802ee7 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802f13:	99                   	cltd
+  802f14:	c1 ea 1b             	shr    $0x1b,%edx
+  802f17:	01 d0                	add    %edx,%eax
+  802f19:	83 e0 1f             	and    $0x1f,%eax
+  802f1c:	29 d0                	sub    %edx,%eax
+  802f1e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802f23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f26:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802f29:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802f2c:	83 c6 01             	add    $0x1,%esi
+  802f2f:	eb ab                	jmp    802edc <devpipe_read+0x1c>
+
+00802f31 <pipe>:
+{
+  802f31:	55                   	push   %ebp
+  802f32:	89 e5                	mov    %esp,%ebp
+  802f34:	56                   	push   %esi
+  802f35:	53                   	push   %ebx
+  802f36:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802f39:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f3c:	50                   	push   %eax
+  802f3d:	e8 38 e2 ff ff       	call   80117a <fd_alloc>
+  802f42:	89 c3                	mov    %eax,%ebx
+  802f44:	83 c4 10             	add    $0x10,%esp
+  802f47:	85 c0                	test   %eax,%eax
+  802f49:	0f 88 23 01 00 00    	js     803072 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f4f:	83 ec 04             	sub    $0x4,%esp
+  802f52:	68 07 04 00 00       	push   $0x407
+  802f57:	ff 75 f4             	push   -0xc(%ebp)
+  802f5a:	6a 00                	push   $0x0
+  802f5c:	e8 a2 dc ff ff       	call   800c03 <sys_page_alloc>
+  802f61:	89 c3                	mov    %eax,%ebx
+  802f63:	83 c4 10             	add    $0x10,%esp
+  802f66:	85 c0                	test   %eax,%eax
+  802f68:	0f 88 04 01 00 00    	js     803072 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802f6e:	83 ec 0c             	sub    $0xc,%esp
+  802f71:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802f74:	50                   	push   %eax
+  802f75:	e8 00 e2 ff ff       	call   80117a <fd_alloc>
+  802f7a:	89 c3                	mov    %eax,%ebx
+  802f7c:	83 c4 10             	add    $0x10,%esp
+  802f7f:	85 c0                	test   %eax,%eax
+  802f81:	0f 88 db 00 00 00    	js     803062 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f87:	83 ec 04             	sub    $0x4,%esp
+  802f8a:	68 07 04 00 00       	push   $0x407
+  802f8f:	ff 75 f0             	push   -0x10(%ebp)
+  802f92:	6a 00                	push   $0x0
+  802f94:	e8 6a dc ff ff       	call   800c03 <sys_page_alloc>
+  802f99:	89 c3                	mov    %eax,%ebx
+  802f9b:	83 c4 10             	add    $0x10,%esp
+  802f9e:	85 c0                	test   %eax,%eax
+  802fa0:	0f 88 bc 00 00 00    	js     803062 <pipe+0x131>
+	va = fd2data(fd0);
+  802fa6:	83 ec 0c             	sub    $0xc,%esp
+  802fa9:	ff 75 f4             	push   -0xc(%ebp)
+  802fac:	e8 b2 e1 ff ff       	call   801163 <fd2data>
+  802fb1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802fb3:	83 c4 0c             	add    $0xc,%esp
+  802fb6:	68 07 04 00 00       	push   $0x407
+  802fbb:	50                   	push   %eax
+  802fbc:	6a 00                	push   $0x0
+  802fbe:	e8 40 dc ff ff       	call   800c03 <sys_page_alloc>
+  802fc3:	89 c3                	mov    %eax,%ebx
+  802fc5:	83 c4 10             	add    $0x10,%esp
+  802fc8:	85 c0                	test   %eax,%eax
+  802fca:	0f 88 82 00 00 00    	js     803052 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802fd0:	83 ec 0c             	sub    $0xc,%esp
+  802fd3:	ff 75 f0             	push   -0x10(%ebp)
+  802fd6:	e8 88 e1 ff ff       	call   801163 <fd2data>
+  802fdb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802fe2:	50                   	push   %eax
+  802fe3:	6a 00                	push   $0x0
+  802fe5:	56                   	push   %esi
+  802fe6:	6a 00                	push   $0x0
+  802fe8:	e8 61 dc ff ff       	call   800c4e <sys_page_map>
+  802fed:	89 c3                	mov    %eax,%ebx
+  802fef:	83 c4 20             	add    $0x20,%esp
+  802ff2:	85 c0                	test   %eax,%eax
+  802ff4:	78 4e                	js     803044 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802ff6:	a1 60 50 80 00       	mov    0x805060,%eax
+  802ffb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802ffe:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803000:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803003:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80300a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80300d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80300f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803012:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803019:	83 ec 0c             	sub    $0xc,%esp
+  80301c:	ff 75 f4             	push   -0xc(%ebp)
+  80301f:	e8 2f e1 ff ff       	call   801153 <fd2num>
+  803024:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803027:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803029:	83 c4 04             	add    $0x4,%esp
+  80302c:	ff 75 f0             	push   -0x10(%ebp)
+  80302f:	e8 1f e1 ff ff       	call   801153 <fd2num>
+  803034:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803037:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80303a:	83 c4 10             	add    $0x10,%esp
+  80303d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803042:	eb 2e                	jmp    803072 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803044:	83 ec 08             	sub    $0x8,%esp
+  803047:	56                   	push   %esi
+  803048:	6a 00                	push   $0x0
+  80304a:	e8 41 dc ff ff       	call   800c90 <sys_page_unmap>
+  80304f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803052:	83 ec 08             	sub    $0x8,%esp
+  803055:	ff 75 f0             	push   -0x10(%ebp)
+  803058:	6a 00                	push   $0x0
+  80305a:	e8 31 dc ff ff       	call   800c90 <sys_page_unmap>
+  80305f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803062:	83 ec 08             	sub    $0x8,%esp
+  803065:	ff 75 f4             	push   -0xc(%ebp)
+  803068:	6a 00                	push   $0x0
+  80306a:	e8 21 dc ff ff       	call   800c90 <sys_page_unmap>
+  80306f:	83 c4 10             	add    $0x10,%esp
+}
+  803072:	89 d8                	mov    %ebx,%eax
+  803074:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803077:	5b                   	pop    %ebx
+  803078:	5e                   	pop    %esi
+  803079:	5d                   	pop    %ebp
+  80307a:	c3                   	ret
+
+0080307b <pipeisclosed>:
+{
+  80307b:	55                   	push   %ebp
+  80307c:	89 e5                	mov    %esp,%ebp
+  80307e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803081:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803084:	50                   	push   %eax
+  803085:	ff 75 08             	push   0x8(%ebp)
+  803088:	e8 43 e1 ff ff       	call   8011d0 <fd_lookup>
+  80308d:	83 c4 10             	add    $0x10,%esp
+  803090:	85 c0                	test   %eax,%eax
+  803092:	78 18                	js     8030ac <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803094:	83 ec 0c             	sub    $0xc,%esp
+  803097:	ff 75 f4             	push   -0xc(%ebp)
+  80309a:	e8 c4 e0 ff ff       	call   801163 <fd2data>
+  80309f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8030a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030a4:	e8 33 fd ff ff       	call   802ddc <_pipeisclosed>
+  8030a9:	83 c4 10             	add    $0x10,%esp
+}
+  8030ac:	c9                   	leave
+  8030ad:	c3                   	ret
+
+008030ae <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8030ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b3:	c3                   	ret
+
+008030b4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8030b4:	55                   	push   %ebp
+  8030b5:	89 e5                	mov    %esp,%ebp
+  8030b7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8030ba:	68 6e 3f 80 00       	push   $0x803f6e
+  8030bf:	ff 75 0c             	push   0xc(%ebp)
+  8030c2:	e8 30 d7 ff ff       	call   8007f7 <strcpy>
+	return 0;
+}
+  8030c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030cc:	c9                   	leave
+  8030cd:	c3                   	ret
+
+008030ce <devcons_write>:
+{
+  8030ce:	55                   	push   %ebp
+  8030cf:	89 e5                	mov    %esp,%ebp
+  8030d1:	57                   	push   %edi
+  8030d2:	56                   	push   %esi
+  8030d3:	53                   	push   %ebx
+  8030d4:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8030da:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8030df:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8030e5:	eb 2e                	jmp    803115 <devcons_write+0x47>
+		m = n - tot;
+  8030e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8030ea:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8030ec:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8030f1:	39 c3                	cmp    %eax,%ebx
+  8030f3:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8030f6:	83 ec 04             	sub    $0x4,%esp
+  8030f9:	53                   	push   %ebx
+  8030fa:	89 f0                	mov    %esi,%eax
+  8030fc:	03 45 0c             	add    0xc(%ebp),%eax
+  8030ff:	50                   	push   %eax
+  803100:	57                   	push   %edi
+  803101:	e8 77 d8 ff ff       	call   80097d <memmove>
+		sys_cputs(buf, m);
+  803106:	83 c4 08             	add    $0x8,%esp
+  803109:	53                   	push   %ebx
+  80310a:	57                   	push   %edi
+  80310b:	e8 17 da ff ff       	call   800b27 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803110:	01 de                	add    %ebx,%esi
+  803112:	83 c4 10             	add    $0x10,%esp
+  803115:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803118:	72 cd                	jb     8030e7 <devcons_write+0x19>
+}
+  80311a:	89 f0                	mov    %esi,%eax
+  80311c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80311f:	5b                   	pop    %ebx
+  803120:	5e                   	pop    %esi
+  803121:	5f                   	pop    %edi
+  803122:	5d                   	pop    %ebp
+  803123:	c3                   	ret
+
+00803124 <devcons_read>:
+{
+  803124:	55                   	push   %ebp
+  803125:	89 e5                	mov    %esp,%ebp
+  803127:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80312a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80312f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803133:	75 07                	jne    80313c <devcons_read+0x18>
+  803135:	eb 1f                	jmp    803156 <devcons_read+0x32>
+		sys_yield();
+  803137:	e8 a8 da ff ff       	call   800be4 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80313c:	e8 0c da ff ff       	call   800b4d <sys_cgetc>
+  803141:	85 c0                	test   %eax,%eax
+  803143:	74 f2                	je     803137 <devcons_read+0x13>
+	if (c < 0)
+  803145:	78 0f                	js     803156 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803147:	83 f8 04             	cmp    $0x4,%eax
+  80314a:	74 0c                	je     803158 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80314c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80314f:	88 02                	mov    %al,(%edx)
+	return 1;
+  803151:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803156:	c9                   	leave
+  803157:	c3                   	ret
+		return 0;
+  803158:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315d:	eb f7                	jmp    803156 <devcons_read+0x32>
+
+0080315f <cputchar>:
+{
+  80315f:	55                   	push   %ebp
+  803160:	89 e5                	mov    %esp,%ebp
+  803162:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803165:	8b 45 08             	mov    0x8(%ebp),%eax
+  803168:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80316b:	6a 01                	push   $0x1
+  80316d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803170:	50                   	push   %eax
+  803171:	e8 b1 d9 ff ff       	call   800b27 <sys_cputs>
+}
+  803176:	83 c4 10             	add    $0x10,%esp
+  803179:	c9                   	leave
+  80317a:	c3                   	ret
+
+0080317b <getchar>:
+{
+  80317b:	55                   	push   %ebp
+  80317c:	89 e5                	mov    %esp,%ebp
+  80317e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803181:	6a 01                	push   $0x1
+  803183:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803186:	50                   	push   %eax
+  803187:	6a 00                	push   $0x0
+  803189:	e8 a8 e2 ff ff       	call   801436 <read>
+	if (r < 0)
+  80318e:	83 c4 10             	add    $0x10,%esp
+  803191:	85 c0                	test   %eax,%eax
+  803193:	78 06                	js     80319b <getchar+0x20>
+	if (r < 1)
+  803195:	74 06                	je     80319d <getchar+0x22>
+	return c;
+  803197:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80319b:	c9                   	leave
+  80319c:	c3                   	ret
+		return -E_EOF;
+  80319d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8031a2:	eb f7                	jmp    80319b <getchar+0x20>
+
+008031a4 <iscons>:
+{
+  8031a4:	55                   	push   %ebp
+  8031a5:	89 e5                	mov    %esp,%ebp
+  8031a7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031ad:	50                   	push   %eax
+  8031ae:	ff 75 08             	push   0x8(%ebp)
+  8031b1:	e8 1a e0 ff ff       	call   8011d0 <fd_lookup>
+  8031b6:	83 c4 10             	add    $0x10,%esp
+  8031b9:	85 c0                	test   %eax,%eax
+  8031bb:	78 11                	js     8031ce <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8031bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031c0:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8031c6:	39 10                	cmp    %edx,(%eax)
+  8031c8:	0f 94 c0             	sete   %al
+  8031cb:	0f b6 c0             	movzbl %al,%eax
+}
+  8031ce:	c9                   	leave
+  8031cf:	c3                   	ret
+
+008031d0 <opencons>:
+{
+  8031d0:	55                   	push   %ebp
+  8031d1:	89 e5                	mov    %esp,%ebp
+  8031d3:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8031d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031d9:	50                   	push   %eax
+  8031da:	e8 9b df ff ff       	call   80117a <fd_alloc>
+  8031df:	83 c4 10             	add    $0x10,%esp
+  8031e2:	85 c0                	test   %eax,%eax
+  8031e4:	78 3a                	js     803220 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8031e6:	83 ec 04             	sub    $0x4,%esp
+  8031e9:	68 07 04 00 00       	push   $0x407
+  8031ee:	ff 75 f4             	push   -0xc(%ebp)
+  8031f1:	6a 00                	push   $0x0
+  8031f3:	e8 0b da ff ff       	call   800c03 <sys_page_alloc>
+  8031f8:	83 c4 10             	add    $0x10,%esp
+  8031fb:	85 c0                	test   %eax,%eax
+  8031fd:	78 21                	js     803220 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8031ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803202:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803208:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80320a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80320d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803214:	83 ec 0c             	sub    $0xc,%esp
+  803217:	50                   	push   %eax
+  803218:	e8 36 df ff ff       	call   801153 <fd2num>
+  80321d:	83 c4 10             	add    $0x10,%esp
+}
+  803220:	c9                   	leave
+  803221:	c3                   	ret
+
+00803222 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803222:	55                   	push   %ebp
+  803223:	89 e5                	mov    %esp,%ebp
+  803225:	56                   	push   %esi
+  803226:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803227:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80322a:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803230:	e8 88 d9 ff ff       	call   800bbd <sys_getenvid>
+  803235:	83 ec 0c             	sub    $0xc,%esp
+  803238:	ff 75 0c             	push   0xc(%ebp)
+  80323b:	ff 75 08             	push   0x8(%ebp)
+  80323e:	56                   	push   %esi
+  80323f:	50                   	push   %eax
+  803240:	68 7c 3f 80 00       	push   $0x803f7c
+  803245:	e8 bf cf ff ff       	call   800209 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80324a:	83 c4 18             	add    $0x18,%esp
+  80324d:	53                   	push   %ebx
+  80324e:	ff 75 10             	push   0x10(%ebp)
+  803251:	e8 62 cf ff ff       	call   8001b8 <vcprintf>
+	cprintf("\n");
+  803256:	c7 04 24 90 3a 80 00 	movl   $0x803a90,(%esp)
+  80325d:	e8 a7 cf ff ff       	call   800209 <cprintf>
+  803262:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803265:	cc                   	int3
+	while (1)
+  803266:	eb fd                	jmp    803265 <_panic+0x43>
+
+00803268 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  803268:	55                   	push   %ebp
+  803269:	89 e5                	mov    %esp,%ebp
+  80326b:	57                   	push   %edi
+  80326c:	56                   	push   %esi
+  80326d:	53                   	push   %ebx
+  80326e:	83 ec 20             	sub    $0x20,%esp
+  803271:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803274:	89 d7                	mov    %edx,%edi
+  803276:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  803278:	51                   	push   %ecx
+  803279:	68 00 f0 7f 00       	push   $0x7ff000
+  80327e:	6a 00                	push   $0x0
+  803280:	e8 7e d9 ff ff       	call   800c03 <sys_page_alloc>
+  803285:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803287:	83 c4 10             	add    $0x10,%esp
+  80328a:	85 c0                	test   %eax,%eax
+  80328c:	78 45                	js     8032d3 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  80328e:	83 ec 04             	sub    $0x4,%esp
+  803291:	68 00 10 00 00       	push   $0x1000
+  803296:	57                   	push   %edi
+  803297:	68 00 f0 7f 00       	push   $0x7ff000
+  80329c:	e8 dc d6 ff ff       	call   80097d <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8032a1:	89 34 24             	mov    %esi,(%esp)
+  8032a4:	57                   	push   %edi
+  8032a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8032a8:	68 00 f0 7f 00       	push   $0x7ff000
+  8032ad:	6a 00                	push   $0x0
+  8032af:	e8 9a d9 ff ff       	call   800c4e <sys_page_map>
+  8032b4:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8032b6:	83 c4 20             	add    $0x20,%esp
+  8032b9:	85 c0                	test   %eax,%eax
+  8032bb:	78 16                	js     8032d3 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8032bd:	83 ec 08             	sub    $0x8,%esp
+  8032c0:	68 00 f0 7f 00       	push   $0x7ff000
+  8032c5:	6a 00                	push   $0x0
+  8032c7:	e8 c4 d9 ff ff       	call   800c90 <sys_page_unmap>
+  8032cc:	83 c4 10             	add    $0x10,%esp
+  8032cf:	85 c0                	test   %eax,%eax
+  8032d1:	75 0a                	jne    8032dd <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8032d3:	89 d8                	mov    %ebx,%eax
+  8032d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032d8:	5b                   	pop    %ebx
+  8032d9:	5e                   	pop    %esi
+  8032da:	5f                   	pop    %edi
+  8032db:	5d                   	pop    %ebp
+  8032dc:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8032dd:	68 a0 3f 80 00       	push   $0x803fa0
+  8032e2:	68 c0 3e 80 00       	push   $0x803ec0
+  8032e7:	6a 1b                	push   $0x1b
+  8032e9:	68 18 40 80 00       	push   $0x804018
+  8032ee:	e8 2f ff ff ff       	call   803222 <_panic>
+
+008032f3 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8032f3:	55                   	push   %ebp
+  8032f4:	89 e5                	mov    %esp,%ebp
+  8032f6:	53                   	push   %ebx
+  8032f7:	83 ec 04             	sub    $0x4,%esp
+  8032fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8032fd:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8032ff:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  803303:	74 21                	je     803326 <pgfault+0x33>
+  803305:	89 d0                	mov    %edx,%eax
+  803307:	c1 e8 16             	shr    $0x16,%eax
+  80330a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803311:	a8 01                	test   $0x1,%al
+  803313:	74 11                	je     803326 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803315:	89 d0                	mov    %edx,%eax
+  803317:	c1 e8 0c             	shr    $0xc,%eax
+  80331a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803321:	f6 c4 08             	test   $0x8,%ah
+  803324:	75 17                	jne    80333d <pgfault+0x4a>
+		if (pgfault_next) {
+  803326:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  80332b:	85 c0                	test   %eax,%eax
+  80332d:	74 27                	je     803356 <pgfault+0x63>
+			pgfault_next(utf);
+  80332f:	83 ec 0c             	sub    $0xc,%esp
+  803332:	53                   	push   %ebx
+  803333:	ff d0                	call   *%eax
+			return;
+  803335:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803338:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80333b:	c9                   	leave
+  80333c:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  80333d:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803343:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803348:	b8 00 00 00 00       	mov    $0x0,%eax
+  80334d:	e8 16 ff ff ff       	call   803268 <copy_page_to>
+  803352:	85 c0                	test   %eax,%eax
+  803354:	79 e2                	jns    803338 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803356:	a1 00 60 80 00       	mov    0x806000,%eax
+  80335b:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  80335e:	ff 73 28             	push   0x28(%ebx)
+  803361:	ff 33                	push   (%ebx)
+  803363:	50                   	push   %eax
+  803364:	68 c4 3f 80 00       	push   $0x803fc4
+  803369:	e8 9b ce ff ff       	call   800209 <cprintf>
+	sys_env_destroy(0);
+  80336e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803375:	e8 fa d7 ff ff       	call   800b74 <sys_env_destroy>
+  80337a:	83 c4 10             	add    $0x10,%esp
+  80337d:	eb b9                	jmp    803338 <pgfault+0x45>
+
+0080337f <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  80337f:	55                   	push   %ebp
+  803380:	89 e5                	mov    %esp,%ebp
+  803382:	53                   	push   %ebx
+  803383:	83 ec 04             	sub    $0x4,%esp
+  803386:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803389:	a1 08 a0 80 00       	mov    0x80a008,%eax
+  80338e:	3d f3 32 80 00       	cmp    $0x8032f3,%eax
+  803393:	74 15                	je     8033aa <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803395:	a3 04 a0 80 00       	mov    %eax,0x80a004
+		set_pgfault_handler(pgfault);
+  80339a:	83 ec 0c             	sub    $0xc,%esp
+  80339d:	68 f3 32 80 00       	push   $0x8032f3
+  8033a2:	e8 fb 03 00 00       	call   8037a2 <set_pgfault_handler>
+  8033a7:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8033aa:	83 ec 0c             	sub    $0xc,%esp
+  8033ad:	68 05 08 00 00       	push   $0x805
+  8033b2:	53                   	push   %ebx
+  8033b3:	6a 00                	push   $0x0
+  8033b5:	53                   	push   %ebx
+  8033b6:	6a 00                	push   $0x0
+  8033b8:	e8 91 d8 ff ff       	call   800c4e <sys_page_map>
+}
+  8033bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033c0:	c9                   	leave
+  8033c1:	c3                   	ret
+
+008033c2 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8033c2:	55                   	push   %ebp
+  8033c3:	89 e5                	mov    %esp,%ebp
+  8033c5:	57                   	push   %edi
+  8033c6:	56                   	push   %esi
+  8033c7:	53                   	push   %ebx
+  8033c8:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8033cb:	68 f3 32 80 00       	push   $0x8032f3
+  8033d0:	e8 cd 03 00 00       	call   8037a2 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8033d5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8033da:	cd 30                	int    $0x30
+  8033dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8033df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8033e2:	83 c4 10             	add    $0x10,%esp
+  8033e5:	85 c0                	test   %eax,%eax
+  8033e7:	0f 88 6b 01 00 00    	js     803558 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8033ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8033f2:	75 37                	jne    80342b <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8033f4:	e8 c4 d7 ff ff       	call   800bbd <sys_getenvid>
+  8033f9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8033fe:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803404:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803409:	a3 00 60 80 00       	mov    %eax,0x806000
+		return 0;
+  80340e:	e9 45 01 00 00       	jmp    803558 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803413:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803419:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80341f:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803425:	0f 87 ba 00 00 00    	ja     8034e5 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  80342b:	89 d8                	mov    %ebx,%eax
+  80342d:	c1 e8 16             	shr    $0x16,%eax
+  803430:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803437:	a8 01                	test   $0x1,%al
+  803439:	74 d8                	je     803413 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  80343b:	89 d8                	mov    %ebx,%eax
+  80343d:	c1 e8 0c             	shr    $0xc,%eax
+  803440:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803447:	f6 c2 01             	test   $0x1,%dl
+  80344a:	74 cd                	je     803419 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  80344c:	89 da                	mov    %ebx,%edx
+  80344e:	80 e6 df             	and    $0xdf,%dh
+  803451:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803457:	74 c0                	je     803419 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803459:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80345b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803462:	f6 c6 04             	test   $0x4,%dh
+  803465:	75 53                	jne    8034ba <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803467:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80346e:	f6 c6 08             	test   $0x8,%dh
+  803471:	75 0c                	jne    80347f <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803473:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80347a:	f6 c2 02             	test   $0x2,%dl
+  80347d:	74 3b                	je     8034ba <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80347f:	83 ec 0c             	sub    $0xc,%esp
+  803482:	68 05 08 00 00       	push   $0x805
+  803487:	57                   	push   %edi
+  803488:	ff 75 e4             	push   -0x1c(%ebp)
+  80348b:	57                   	push   %edi
+  80348c:	6a 00                	push   $0x0
+  80348e:	e8 bb d7 ff ff       	call   800c4e <sys_page_map>
+  803493:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803495:	83 c4 20             	add    $0x20,%esp
+  803498:	85 c0                	test   %eax,%eax
+  80349a:	0f 88 a7 00 00 00    	js     803547 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8034a0:	83 ec 0c             	sub    $0xc,%esp
+  8034a3:	68 05 08 00 00       	push   $0x805
+  8034a8:	57                   	push   %edi
+  8034a9:	6a 00                	push   $0x0
+  8034ab:	57                   	push   %edi
+  8034ac:	6a 00                	push   $0x0
+  8034ae:	e8 9b d7 ff ff       	call   800c4e <sys_page_map>
+  8034b3:	89 c6                	mov    %eax,%esi
+	return r;
+  8034b5:	83 c4 20             	add    $0x20,%esp
+  8034b8:	eb 21                	jmp    8034db <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8034ba:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8034c1:	83 ec 0c             	sub    $0xc,%esp
+  8034c4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8034c9:	50                   	push   %eax
+  8034ca:	57                   	push   %edi
+  8034cb:	ff 75 e4             	push   -0x1c(%ebp)
+  8034ce:	57                   	push   %edi
+  8034cf:	6a 00                	push   $0x0
+  8034d1:	e8 78 d7 ff ff       	call   800c4e <sys_page_map>
+  8034d6:	89 c6                	mov    %eax,%esi
+  8034d8:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8034db:	85 f6                	test   %esi,%esi
+  8034dd:	0f 89 36 ff ff ff    	jns    803419 <fork+0x57>
+  8034e3:	eb 62                	jmp    803547 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8034e5:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8034ea:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8034ef:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8034f2:	89 f8                	mov    %edi,%eax
+  8034f4:	e8 6f fd ff ff       	call   803268 <copy_page_to>
+  8034f9:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8034fb:	85 c0                	test   %eax,%eax
+  8034fd:	78 48                	js     803547 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8034ff:	83 ec 04             	sub    $0x4,%esp
+  803502:	6a 07                	push   $0x7
+  803504:	68 00 f0 bf ee       	push   $0xeebff000
+  803509:	57                   	push   %edi
+  80350a:	e8 f4 d6 ff ff       	call   800c03 <sys_page_alloc>
+  80350f:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803511:	83 c4 10             	add    $0x10,%esp
+  803514:	85 c0                	test   %eax,%eax
+  803516:	78 2f                	js     803547 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803518:	a1 00 60 80 00       	mov    0x806000,%eax
+  80351d:	8b 40 64             	mov    0x64(%eax),%eax
+  803520:	83 ec 08             	sub    $0x8,%esp
+  803523:	50                   	push   %eax
+  803524:	57                   	push   %edi
+  803525:	e8 44 d8 ff ff       	call   800d6e <sys_env_set_pgfault_upcall>
+  80352a:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80352c:	83 c4 10             	add    $0x10,%esp
+  80352f:	85 c0                	test   %eax,%eax
+  803531:	78 14                	js     803547 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803533:	83 ec 08             	sub    $0x8,%esp
+  803536:	6a 02                	push   $0x2
+  803538:	57                   	push   %edi
+  803539:	e8 9c d7 ff ff       	call   800cda <sys_env_set_status>
+  80353e:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803540:	83 c4 10             	add    $0x10,%esp
+  803543:	85 c0                	test   %eax,%eax
+  803545:	79 11                	jns    803558 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803547:	83 ec 0c             	sub    $0xc,%esp
+  80354a:	ff 75 e0             	push   -0x20(%ebp)
+  80354d:	e8 22 d6 ff ff       	call   800b74 <sys_env_destroy>
+	return r;
+  803552:	83 c4 10             	add    $0x10,%esp
+  803555:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803558:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80355b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80355e:	5b                   	pop    %ebx
+  80355f:	5e                   	pop    %esi
+  803560:	5f                   	pop    %edi
+  803561:	5d                   	pop    %ebp
+  803562:	c3                   	ret
+
+00803563 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803563:	55                   	push   %ebp
+  803564:	89 e5                	mov    %esp,%ebp
+  803566:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803569:	68 23 40 80 00       	push   $0x804023
+  80356e:	68 bf 00 00 00       	push   $0xbf
+  803573:	68 18 40 80 00       	push   $0x804018
+  803578:	e8 a5 fc ff ff       	call   803222 <_panic>
+
+0080357d <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80357d:	55                   	push   %ebp
+  80357e:	89 e5                	mov    %esp,%ebp
+  803580:	56                   	push   %esi
+  803581:	53                   	push   %ebx
+  803582:	8b 75 08             	mov    0x8(%ebp),%esi
+  803585:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803588:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80358b:	85 c0                	test   %eax,%eax
+  80358d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803592:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803595:	83 ec 0c             	sub    $0xc,%esp
+  803598:	50                   	push   %eax
+  803599:	e8 ad d8 ff ff       	call   800e4b <sys_ipc_recv>
+	if (from_env_store)
+  80359e:	83 c4 10             	add    $0x10,%esp
+  8035a1:	85 f6                	test   %esi,%esi
+  8035a3:	74 14                	je     8035b9 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8035a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035aa:	85 c0                	test   %eax,%eax
+  8035ac:	75 09                	jne    8035b7 <ipc_recv+0x3a>
+  8035ae:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8035b4:	8b 52 74             	mov    0x74(%edx),%edx
+  8035b7:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8035b9:	85 db                	test   %ebx,%ebx
+  8035bb:	74 25                	je     8035e2 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8035bd:	85 c0                	test   %eax,%eax
+  8035bf:	74 0d                	je     8035ce <ipc_recv+0x51>
+  8035c1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8035c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035ca:	5b                   	pop    %ebx
+  8035cb:	5e                   	pop    %esi
+  8035cc:	5d                   	pop    %ebp
+  8035cd:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8035ce:	a1 00 60 80 00       	mov    0x806000,%eax
+  8035d3:	8b 40 78             	mov    0x78(%eax),%eax
+  8035d6:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8035d8:	a1 00 60 80 00       	mov    0x806000,%eax
+  8035dd:	8b 40 70             	mov    0x70(%eax),%eax
+  8035e0:	eb e5                	jmp    8035c7 <ipc_recv+0x4a>
+  8035e2:	85 c0                	test   %eax,%eax
+  8035e4:	75 e1                	jne    8035c7 <ipc_recv+0x4a>
+  8035e6:	eb f0                	jmp    8035d8 <ipc_recv+0x5b>
+
+008035e8 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8035e8:	55                   	push   %ebp
+  8035e9:	89 e5                	mov    %esp,%ebp
+  8035eb:	57                   	push   %edi
+  8035ec:	56                   	push   %esi
+  8035ed:	53                   	push   %ebx
+  8035ee:	83 ec 0c             	sub    $0xc,%esp
+  8035f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035f4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8035f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8035fa:	85 db                	test   %ebx,%ebx
+  8035fc:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803601:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803604:	ff 75 14             	push   0x14(%ebp)
+  803607:	53                   	push   %ebx
+  803608:	56                   	push   %esi
+  803609:	57                   	push   %edi
+  80360a:	e8 a9 d7 ff ff       	call   800db8 <sys_ipc_try_send>
+  80360f:	83 c4 10             	add    $0x10,%esp
+  803612:	85 c0                	test   %eax,%eax
+  803614:	74 22                	je     803638 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803616:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803619:	75 07                	jne    803622 <ipc_send+0x3a>
+		sys_yield();
+  80361b:	e8 c4 d5 ff ff       	call   800be4 <sys_yield>
+  803620:	eb e2                	jmp    803604 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803622:	68 39 40 80 00       	push   $0x804039
+  803627:	68 c0 3e 80 00       	push   $0x803ec0
+  80362c:	6a 39                	push   $0x39
+  80362e:	68 4e 40 80 00       	push   $0x80404e
+  803633:	e8 ea fb ff ff       	call   803222 <_panic>
+	}
+}
+  803638:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80363b:	5b                   	pop    %ebx
+  80363c:	5e                   	pop    %esi
+  80363d:	5f                   	pop    %edi
+  80363e:	5d                   	pop    %ebp
+  80363f:	c3                   	ret
+
+00803640 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803640:	55                   	push   %ebp
+  803641:	89 e5                	mov    %esp,%ebp
+  803643:	57                   	push   %edi
+  803644:	56                   	push   %esi
+  803645:	53                   	push   %ebx
+  803646:	83 ec 10             	sub    $0x10,%esp
+  803649:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80364c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80364f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803652:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803655:	85 c0                	test   %eax,%eax
+  803657:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80365c:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  80365f:	6a 00                	push   $0x0
+  803661:	ff 33                	push   (%ebx)
+  803663:	50                   	push   %eax
+  803664:	e8 9f d7 ff ff       	call   800e08 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803669:	83 c4 10             	add    $0x10,%esp
+  80366c:	85 c0                	test   %eax,%eax
+  80366e:	75 3c                	jne    8036ac <ipc_recvv+0x6c>
+  803670:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803676:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803679:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  80367b:	85 ff                	test   %edi,%edi
+  80367d:	74 4e                	je     8036cd <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80367f:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803685:	8b 52 74             	mov    0x74(%edx),%edx
+  803688:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  80368a:	85 f6                	test   %esi,%esi
+  80368c:	74 18                	je     8036a6 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80368e:	85 c0                	test   %eax,%eax
+  803690:	75 2d                	jne    8036bf <ipc_recvv+0x7f>
+  803692:	a1 00 60 80 00       	mov    0x806000,%eax
+  803697:	8b 40 78             	mov    0x78(%eax),%eax
+  80369a:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  80369c:	a1 00 60 80 00       	mov    0x806000,%eax
+  8036a1:	8b 40 70             	mov    0x70(%eax),%eax
+  8036a4:	eb 1f                	jmp    8036c5 <ipc_recvv+0x85>
+  8036a6:	85 c0                	test   %eax,%eax
+  8036a8:	75 1b                	jne    8036c5 <ipc_recvv+0x85>
+  8036aa:	eb f0                	jmp    80369c <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8036ac:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8036b2:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8036b7:	85 ff                	test   %edi,%edi
+  8036b9:	75 cd                	jne    803688 <ipc_recvv+0x48>
+	if (perm_store)
+  8036bb:	85 f6                	test   %esi,%esi
+  8036bd:	74 e7                	je     8036a6 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8036bf:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8036c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036c8:	5b                   	pop    %ebx
+  8036c9:	5e                   	pop    %esi
+  8036ca:	5f                   	pop    %edi
+  8036cb:	5d                   	pop    %ebp
+  8036cc:	c3                   	ret
+	if (perm_store)
+  8036cd:	85 f6                	test   %esi,%esi
+  8036cf:	75 bd                	jne    80368e <ipc_recvv+0x4e>
+  8036d1:	eb c9                	jmp    80369c <ipc_recvv+0x5c>
+
+008036d3 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8036d3:	55                   	push   %ebp
+  8036d4:	89 e5                	mov    %esp,%ebp
+  8036d6:	57                   	push   %edi
+  8036d7:	56                   	push   %esi
+  8036d8:	53                   	push   %ebx
+  8036d9:	83 ec 0c             	sub    $0xc,%esp
+  8036dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8036df:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8036e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8036e5:	ff 75 14             	push   0x14(%ebp)
+  8036e8:	53                   	push   %ebx
+  8036e9:	56                   	push   %esi
+  8036ea:	57                   	push   %edi
+  8036eb:	e8 f0 d6 ff ff       	call   800de0 <sys_ipc_try_sendv>
+  8036f0:	83 c4 10             	add    $0x10,%esp
+  8036f3:	85 c0                	test   %eax,%eax
+  8036f5:	74 22                	je     803719 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8036f7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8036fa:	75 07                	jne    803703 <ipc_sendv+0x30>
+		sys_yield();
+  8036fc:	e8 e3 d4 ff ff       	call   800be4 <sys_yield>
+  803701:	eb e2                	jmp    8036e5 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803703:	68 39 40 80 00       	push   $0x804039
+  803708:	68 c0 3e 80 00       	push   $0x803ec0
+  80370d:	6a 5c                	push   $0x5c
+  80370f:	68 4e 40 80 00       	push   $0x80404e
+  803714:	e8 09 fb ff ff       	call   803222 <_panic>
+	}
+}
+  803719:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80371c:	5b                   	pop    %ebx
+  80371d:	5e                   	pop    %esi
+  80371e:	5f                   	pop    %edi
+  80371f:	5d                   	pop    %ebp
+  803720:	c3                   	ret
+
+00803721 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803721:	55                   	push   %ebp
+  803722:	89 e5                	mov    %esp,%ebp
+  803724:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803727:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80372c:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803732:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803738:	8b 52 50             	mov    0x50(%edx),%edx
+  80373b:	39 ca                	cmp    %ecx,%edx
+  80373d:	74 11                	je     803750 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80373f:	83 c0 01             	add    $0x1,%eax
+  803742:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803747:	75 e3                	jne    80372c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803749:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374e:	eb 0e                	jmp    80375e <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803750:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803756:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80375b:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80375e:	5d                   	pop    %ebp
+  80375f:	c3                   	ret
+
+00803760 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803760:	55                   	push   %ebp
+  803761:	89 e5                	mov    %esp,%ebp
+  803763:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803766:	89 c2                	mov    %eax,%edx
+  803768:	c1 ea 16             	shr    $0x16,%edx
+  80376b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803772:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803777:	f6 c1 01             	test   $0x1,%cl
+  80377a:	74 22                	je     80379e <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80377c:	c1 e8 0c             	shr    $0xc,%eax
+  80377f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803786:	a8 01                	test   $0x1,%al
+  803788:	74 14                	je     80379e <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80378a:	c1 e8 0c             	shr    $0xc,%eax
+  80378d:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803790:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803797:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  80379b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80379e:	89 d0                	mov    %edx,%eax
+  8037a0:	5d                   	pop    %ebp
+  8037a1:	c3                   	ret
+
+008037a2 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8037a2:	55                   	push   %ebp
+  8037a3:	89 e5                	mov    %esp,%ebp
+  8037a5:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8037a8:	83 3d 08 a0 80 00 00 	cmpl   $0x0,0x80a008
+  8037af:	74 0a                	je     8037bb <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8037b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037b4:	a3 08 a0 80 00       	mov    %eax,0x80a008
+}
+  8037b9:	c9                   	leave
+  8037ba:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8037bb:	83 ec 04             	sub    $0x4,%esp
+  8037be:	6a 07                	push   $0x7
+  8037c0:	68 00 f0 bf ee       	push   $0xeebff000
+  8037c5:	6a 00                	push   $0x0
+  8037c7:	e8 37 d4 ff ff       	call   800c03 <sys_page_alloc>
+  8037cc:	83 c4 10             	add    $0x10,%esp
+  8037cf:	85 c0                	test   %eax,%eax
+  8037d1:	75 2c                	jne    8037ff <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8037d3:	83 ec 08             	sub    $0x8,%esp
+  8037d6:	68 15 38 80 00       	push   $0x803815
+  8037db:	6a 00                	push   $0x0
+  8037dd:	e8 8c d5 ff ff       	call   800d6e <sys_env_set_pgfault_upcall>
+  8037e2:	83 c4 10             	add    $0x10,%esp
+  8037e5:	85 c0                	test   %eax,%eax
+  8037e7:	74 c8                	je     8037b1 <set_pgfault_handler+0xf>
+  8037e9:	68 a0 40 80 00       	push   $0x8040a0
+  8037ee:	68 c0 3e 80 00       	push   $0x803ec0
+  8037f3:	6a 20                	push   $0x20
+  8037f5:	68 d0 40 80 00       	push   $0x8040d0
+  8037fa:	e8 23 fa ff ff       	call   803222 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8037ff:	68 58 40 80 00       	push   $0x804058
+  803804:	68 c0 3e 80 00       	push   $0x803ec0
+  803809:	6a 1e                	push   $0x1e
+  80380b:	68 d0 40 80 00       	push   $0x8040d0
+  803810:	e8 0d fa ff ff       	call   803222 <_panic>
+
+00803815 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803815:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803816:	a1 08 a0 80 00       	mov    0x80a008,%eax
+	call *%eax
+  80381b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80381d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803820:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803825:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  80382a:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  80382e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803831:	83 c4 08             	add    $0x8,%esp
+	popal
+  803834:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803835:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803838:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803839:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80383a:	c3                   	ret
+
+0080383b <dm>:
+  80383b:	55                   	push   %ebp
+  80383c:	57                   	push   %edi
+  80383d:	56                   	push   %esi
+  80383e:	53                   	push   %ebx
+  80383f:	83 ec 24             	sub    $0x24,%esp
+  803842:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803846:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80384a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80384e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803852:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803856:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80385a:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80385e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803863:	b8 00 00 00 00       	mov    $0x0,%eax
+  803868:	ba 00 00 00 00       	mov    $0x0,%edx
+  80386d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803874:	00 
+  803875:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80387c:	00 
+  80387d:	89 fb                	mov    %edi,%ebx
+  80387f:	eb 08                	jmp    803889 <dm+0x4e>
+  803881:	83 e9 01             	sub    $0x1,%ecx
+  803884:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803887:	74 68                	je     8038f1 <dm+0xb6>
+  803889:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80388d:	01 c0                	add    %eax,%eax
+  80388f:	89 c6                	mov    %eax,%esi
+  803891:	89 d7                	mov    %edx,%edi
+  803893:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803897:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80389b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80389e:	d3 ea                	shr    %cl,%edx
+  8038a0:	f6 c1 20             	test   $0x20,%cl
+  8038a3:	74 04                	je     8038a9 <dm+0x6e>
+  8038a5:	89 d0                	mov    %edx,%eax
+  8038a7:	31 d2                	xor    %edx,%edx
+  8038a9:	83 e0 01             	and    $0x1,%eax
+  8038ac:	89 04 24             	mov    %eax,(%esp)
+  8038af:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8038b6:	00 
+  8038b7:	8b 04 24             	mov    (%esp),%eax
+  8038ba:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8038be:	09 f0                	or     %esi,%eax
+  8038c0:	09 fa                	or     %edi,%edx
+  8038c2:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8038c6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8038ca:	39 f0                	cmp    %esi,%eax
+  8038cc:	89 d5                	mov    %edx,%ebp
+  8038ce:	19 fd                	sbb    %edi,%ebp
+  8038d0:	72 af                	jb     803881 <dm+0x46>
+  8038d2:	29 f0                	sub    %esi,%eax
+  8038d4:	19 fa                	sbb    %edi,%edx
+  8038d6:	89 cf                	mov    %ecx,%edi
+  8038d8:	c1 ef 05             	shr    $0x5,%edi
+  8038db:	83 e7 01             	and    $0x1,%edi
+  8038de:	89 fe                	mov    %edi,%esi
+  8038e0:	83 f6 01             	xor    $0x1,%esi
+  8038e3:	d3 e6                	shl    %cl,%esi
+  8038e5:	d3 e7                	shl    %cl,%edi
+  8038e7:	09 74 24 18          	or     %esi,0x18(%esp)
+  8038eb:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8038ef:	eb 90                	jmp    803881 <dm+0x46>
+  8038f1:	85 db                	test   %ebx,%ebx
+  8038f3:	74 05                	je     8038fa <dm+0xbf>
+  8038f5:	89 03                	mov    %eax,(%ebx)
+  8038f7:	89 53 04             	mov    %edx,0x4(%ebx)
+  8038fa:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8038fe:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803902:	83 c4 24             	add    $0x24,%esp
+  803905:	5b                   	pop    %ebx
+  803906:	5e                   	pop    %esi
+  803907:	5f                   	pop    %edi
+  803908:	5d                   	pop    %ebp
+  803909:	c3                   	ret
+
+0080390a <__udivdi3>:
+  80390a:	83 ec 08             	sub    $0x8,%esp
+  80390d:	6a 00                	push   $0x0
+  80390f:	ff 74 24 1c          	push   0x1c(%esp)
+  803913:	ff 74 24 1c          	push   0x1c(%esp)
+  803917:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80391b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80391f:	e8 17 ff ff ff       	call   80383b <dm>
+  803924:	83 c4 14             	add    $0x14,%esp
+  803927:	c3                   	ret
+
+00803928 <__umoddi3>:
+  803928:	83 ec 18             	sub    $0x18,%esp
+  80392b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80392f:	50                   	push   %eax
+  803930:	ff 74 24 2c          	push   0x2c(%esp)
+  803934:	ff 74 24 2c          	push   0x2c(%esp)
+  803938:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80393c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803940:	e8 f6 fe ff ff       	call   80383b <dm>
+  803945:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803949:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80394d:	83 c4 24             	add    $0x24,%esp
+  803950:	c3                   	ret
+
+00803951 <__divdi3>:
+  803951:	53                   	push   %ebx
+  803952:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803956:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80395a:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80395e:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803962:	85 d2                	test   %edx,%edx
+  803964:	78 15                	js     80397b <__divdi3+0x2a>
+  803966:	85 db                	test   %ebx,%ebx
+  803968:	78 34                	js     80399e <__divdi3+0x4d>
+  80396a:	83 ec 04             	sub    $0x4,%esp
+  80396d:	6a 00                	push   $0x0
+  80396f:	53                   	push   %ebx
+  803970:	51                   	push   %ecx
+  803971:	e8 c5 fe ff ff       	call   80383b <dm>
+  803976:	83 c4 10             	add    $0x10,%esp
+  803979:	eb 21                	jmp    80399c <__divdi3+0x4b>
+  80397b:	f7 d8                	neg    %eax
+  80397d:	83 d2 00             	adc    $0x0,%edx
+  803980:	f7 da                	neg    %edx
+  803982:	85 db                	test   %ebx,%ebx
+  803984:	78 30                	js     8039b6 <__divdi3+0x65>
+  803986:	83 ec 04             	sub    $0x4,%esp
+  803989:	6a 00                	push   $0x0
+  80398b:	53                   	push   %ebx
+  80398c:	51                   	push   %ecx
+  80398d:	e8 a9 fe ff ff       	call   80383b <dm>
+  803992:	83 c4 10             	add    $0x10,%esp
+  803995:	f7 d8                	neg    %eax
+  803997:	83 d2 00             	adc    $0x0,%edx
+  80399a:	f7 da                	neg    %edx
+  80399c:	5b                   	pop    %ebx
+  80399d:	c3                   	ret
+  80399e:	83 ec 04             	sub    $0x4,%esp
+  8039a1:	6a 00                	push   $0x0
+  8039a3:	f7 d9                	neg    %ecx
+  8039a5:	83 d3 00             	adc    $0x0,%ebx
+  8039a8:	f7 db                	neg    %ebx
+  8039aa:	53                   	push   %ebx
+  8039ab:	51                   	push   %ecx
+  8039ac:	e8 8a fe ff ff       	call   80383b <dm>
+  8039b1:	83 c4 10             	add    $0x10,%esp
+  8039b4:	eb df                	jmp    803995 <__divdi3+0x44>
+  8039b6:	83 ec 04             	sub    $0x4,%esp
+  8039b9:	6a 00                	push   $0x0
+  8039bb:	f7 d9                	neg    %ecx
+  8039bd:	83 d3 00             	adc    $0x0,%ebx
+  8039c0:	f7 db                	neg    %ebx
+  8039c2:	53                   	push   %ebx
+  8039c3:	51                   	push   %ecx
+  8039c4:	e8 72 fe ff ff       	call   80383b <dm>
+  8039c9:	83 c4 10             	add    $0x10,%esp
+  8039cc:	eb ce                	jmp    80399c <__divdi3+0x4b>
+
+008039ce <__moddi3>:
+  8039ce:	55                   	push   %ebp
+  8039cf:	57                   	push   %edi
+  8039d0:	56                   	push   %esi
+  8039d1:	53                   	push   %ebx
+  8039d2:	83 ec 24             	sub    $0x24,%esp
+  8039d5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8039d9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8039dd:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8039e1:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8039e5:	85 d2                	test   %edx,%edx
+  8039e7:	78 3b                	js     803a24 <__moddi3+0x56>
+  8039e9:	83 ec 04             	sub    $0x4,%esp
+  8039ec:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8039f0:	56                   	push   %esi
+  8039f1:	89 ce                	mov    %ecx,%esi
+  8039f3:	f7 de                	neg    %esi
+  8039f5:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8039f9:	89 de                	mov    %ebx,%esi
+  8039fb:	83 d6 00             	adc    $0x0,%esi
+  8039fe:	f7 de                	neg    %esi
+  803a00:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803a04:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803a08:	0f 48 f1             	cmovs  %ecx,%esi
+  803a0b:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803a10:	53                   	push   %ebx
+  803a11:	56                   	push   %esi
+  803a12:	e8 24 fe ff ff       	call   80383b <dm>
+  803a17:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a1b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a1f:	83 c4 10             	add    $0x10,%esp
+  803a22:	eb 47                	jmp    803a6b <__moddi3+0x9d>
+  803a24:	f7 d8                	neg    %eax
+  803a26:	83 d2 00             	adc    $0x0,%edx
+  803a29:	f7 da                	neg    %edx
+  803a2b:	83 ec 04             	sub    $0x4,%esp
+  803a2e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803a32:	56                   	push   %esi
+  803a33:	89 cf                	mov    %ecx,%edi
+  803a35:	f7 df                	neg    %edi
+  803a37:	89 de                	mov    %ebx,%esi
+  803a39:	83 d6 00             	adc    $0x0,%esi
+  803a3c:	f7 de                	neg    %esi
+  803a3e:	0f 49 cf             	cmovns %edi,%ecx
+  803a41:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803a45:	0f 49 de             	cmovns %esi,%ebx
+  803a48:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803a4c:	ff 74 24 0c          	push   0xc(%esp)
+  803a50:	ff 74 24 0c          	push   0xc(%esp)
+  803a54:	e8 e2 fd ff ff       	call   80383b <dm>
+  803a59:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a5d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a61:	f7 d8                	neg    %eax
+  803a63:	83 d2 00             	adc    $0x0,%edx
+  803a66:	f7 da                	neg    %edx
+  803a68:	83 c4 10             	add    $0x10,%esp
+  803a6b:	83 c4 24             	add    $0x24,%esp
+  803a6e:	5b                   	pop    %ebx
+  803a6f:	5e                   	pop    %esi
+  803a70:	5f                   	pop    %edi
+  803a71:	5d                   	pop    %ebp
+  803a72:	c3                   	ret
@@ -0,0 +1,7956 @@
+
+obj/user/num.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4a 01 00 00       	call   80017b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <num>:
+int bol = 1;
+int line = 0;
+
+void
+num(int f, const char *s)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+  80003b:	8b 75 08             	mov    0x8(%ebp),%esi
+	long n;
+	int r;
+	char c;
+
+	while ((n = read(f, &c, 1)) > 0) {
+  80003e:	8d 5d f7             	lea    -0x9(%ebp),%ebx
+  800041:	eb 1b                	jmp    80005e <num+0x2b>
+		if (bol) {
+			printf("%5d ", ++line);
+			bol = 0;
+		}
+		if ((r = write(1, &c, 1)) != 1)
+  800043:	83 ec 04             	sub    $0x4,%esp
+  800046:	6a 01                	push   $0x1
+  800048:	53                   	push   %ebx
+  800049:	6a 01                	push   $0x1
+  80004b:	e8 15 14 00 00       	call   801465 <write>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	83 f8 01             	cmp    $0x1,%eax
+  800056:	75 4c                	jne    8000a4 <num+0x71>
+			panic("write error copying %s: %e", s, r);
+		if (c == '\n')
+  800058:	80 7d f7 0a          	cmpb   $0xa,-0x9(%ebp)
+  80005c:	74 5e                	je     8000bc <num+0x89>
+	while ((n = read(f, &c, 1)) > 0) {
+  80005e:	83 ec 04             	sub    $0x4,%esp
+  800061:	6a 01                	push   $0x1
+  800063:	53                   	push   %ebx
+  800064:	56                   	push   %esi
+  800065:	e8 2d 13 00 00       	call   801397 <read>
+  80006a:	83 c4 10             	add    $0x10,%esp
+  80006d:	85 c0                	test   %eax,%eax
+  80006f:	7e 57                	jle    8000c8 <num+0x95>
+		if (bol) {
+  800071:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800078:	74 c9                	je     800043 <num+0x10>
+			printf("%5d ", ++line);
+  80007a:	a1 00 60 80 00       	mov    0x806000,%eax
+  80007f:	83 c0 01             	add    $0x1,%eax
+  800082:	a3 00 60 80 00       	mov    %eax,0x806000
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	50                   	push   %eax
+  80008b:	68 a0 39 80 00       	push   $0x8039a0
+  800090:	e8 b2 27 00 00       	call   802847 <printf>
+			bol = 0;
+  800095:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  80009c:	00 00 00 
+  80009f:	83 c4 10             	add    $0x10,%esp
+  8000a2:	eb 9f                	jmp    800043 <num+0x10>
+			panic("write error copying %s: %e", s, r);
+  8000a4:	83 ec 0c             	sub    $0xc,%esp
+  8000a7:	50                   	push   %eax
+  8000a8:	ff 75 0c             	push   0xc(%ebp)
+  8000ab:	68 a5 39 80 00       	push   $0x8039a5
+  8000b0:	6a 13                	push   $0x13
+  8000b2:	68 c0 39 80 00       	push   $0x8039c0
+  8000b7:	e8 22 01 00 00       	call   8001de <_panic>
+			bol = 1;
+  8000bc:	c7 05 00 50 80 00 01 	movl   $0x1,0x805000
+  8000c3:	00 00 00 
+  8000c6:	eb 96                	jmp    80005e <num+0x2b>
+	}
+	if (n < 0)
+  8000c8:	78 07                	js     8000d1 <num+0x9e>
+		panic("error reading %s: %e", s, n);
+}
+  8000ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000cd:	5b                   	pop    %ebx
+  8000ce:	5e                   	pop    %esi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+		panic("error reading %s: %e", s, n);
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	50                   	push   %eax
+  8000d5:	ff 75 0c             	push   0xc(%ebp)
+  8000d8:	68 cb 39 80 00       	push   $0x8039cb
+  8000dd:	6a 18                	push   $0x18
+  8000df:	68 c0 39 80 00       	push   $0x8039c0
+  8000e4:	e8 f5 00 00 00       	call   8001de <_panic>
+
+008000e9 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000e9:	55                   	push   %ebp
+  8000ea:	89 e5                	mov    %esp,%ebp
+  8000ec:	57                   	push   %edi
+  8000ed:	56                   	push   %esi
+  8000ee:	53                   	push   %ebx
+  8000ef:	83 ec 0c             	sub    $0xc,%esp
+	int f, i;
+
+	binaryname = "num";
+  8000f2:	c7 05 04 50 80 00 e0 	movl   $0x8039e0,0x805004
+  8000f9:	39 80 00 
+	if (argc == 1)
+  8000fc:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800100:	74 0d                	je     80010f <umain+0x26>
+  800102:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800105:	8d 70 04             	lea    0x4(%eax),%esi
+		num(0, "<stdin>");
+	else
+		for (i = 1; i < argc; i++) {
+  800108:	bf 01 00 00 00       	mov    $0x1,%edi
+  80010d:	eb 3b                	jmp    80014a <umain+0x61>
+		num(0, "<stdin>");
+  80010f:	83 ec 08             	sub    $0x8,%esp
+  800112:	68 e4 39 80 00       	push   $0x8039e4
+  800117:	6a 00                	push   $0x0
+  800119:	e8 15 ff ff ff       	call   800033 <num>
+  80011e:	83 c4 10             	add    $0x10,%esp
+			else {
+				num(f, argv[i]);
+				close(f);
+			}
+		}
+	exit();
+  800121:	e8 9e 00 00 00       	call   8001c4 <exit>
+}
+  800126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800129:	5b                   	pop    %ebx
+  80012a:	5e                   	pop    %esi
+  80012b:	5f                   	pop    %edi
+  80012c:	5d                   	pop    %ebp
+  80012d:	c3                   	ret
+				num(f, argv[i]);
+  80012e:	83 ec 08             	sub    $0x8,%esp
+  800131:	ff 36                	push   (%esi)
+  800133:	50                   	push   %eax
+  800134:	e8 fa fe ff ff       	call   800033 <num>
+				close(f);
+  800139:	89 1c 24             	mov    %ebx,(%esp)
+  80013c:	e8 1a 11 00 00       	call   80125b <close>
+		for (i = 1; i < argc; i++) {
+  800141:	83 c7 01             	add    $0x1,%edi
+  800144:	83 c6 04             	add    $0x4,%esi
+  800147:	83 c4 10             	add    $0x10,%esp
+  80014a:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80014d:	7d d2                	jge    800121 <umain+0x38>
+			f = open(argv[i], O_RDONLY);
+  80014f:	83 ec 08             	sub    $0x8,%esp
+  800152:	6a 00                	push   $0x0
+  800154:	ff 36                	push   (%esi)
+  800156:	e8 f2 1c 00 00       	call   801e4d <open>
+  80015b:	89 c3                	mov    %eax,%ebx
+			if (f < 0)
+  80015d:	83 c4 10             	add    $0x10,%esp
+  800160:	85 c0                	test   %eax,%eax
+  800162:	79 ca                	jns    80012e <umain+0x45>
+				panic("can't open %s: %e", argv[i], f);
+  800164:	83 ec 0c             	sub    $0xc,%esp
+  800167:	50                   	push   %eax
+  800168:	ff 36                	push   (%esi)
+  80016a:	68 ec 39 80 00       	push   $0x8039ec
+  80016f:	6a 27                	push   $0x27
+  800171:	68 c0 39 80 00       	push   $0x8039c0
+  800176:	e8 63 00 00 00       	call   8001de <_panic>
+
+0080017b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80017b:	55                   	push   %ebp
+  80017c:	89 e5                	mov    %esp,%ebp
+  80017e:	56                   	push   %esi
+  80017f:	53                   	push   %ebx
+  800180:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800183:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800186:	e8 e2 0a 00 00       	call   800c6d <sys_getenvid>
+  80018b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800190:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800196:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80019b:	a3 04 60 80 00       	mov    %eax,0x806004
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001a0:	85 db                	test   %ebx,%ebx
+  8001a2:	7e 07                	jle    8001ab <libmain+0x30>
+		binaryname = argv[0];
+  8001a4:	8b 06                	mov    (%esi),%eax
+  8001a6:	a3 04 50 80 00       	mov    %eax,0x805004
+
+	// call user main routine
+	umain(argc, argv);
+  8001ab:	83 ec 08             	sub    $0x8,%esp
+  8001ae:	56                   	push   %esi
+  8001af:	53                   	push   %ebx
+  8001b0:	e8 34 ff ff ff       	call   8000e9 <umain>
+
+	// exit gracefully
+	exit();
+  8001b5:	e8 0a 00 00 00       	call   8001c4 <exit>
+}
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001c0:	5b                   	pop    %ebx
+  8001c1:	5e                   	pop    %esi
+  8001c2:	5d                   	pop    %ebp
+  8001c3:	c3                   	ret
+
+008001c4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001c4:	55                   	push   %ebp
+  8001c5:	89 e5                	mov    %esp,%ebp
+  8001c7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001ca:	e8 b9 10 00 00       	call   801288 <close_all>
+	sys_env_destroy(0);
+  8001cf:	83 ec 0c             	sub    $0xc,%esp
+  8001d2:	6a 00                	push   $0x0
+  8001d4:	e8 4b 0a 00 00       	call   800c24 <sys_env_destroy>
+}
+  8001d9:	83 c4 10             	add    $0x10,%esp
+  8001dc:	c9                   	leave
+  8001dd:	c3                   	ret
+
+008001de <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001de:	55                   	push   %ebp
+  8001df:	89 e5                	mov    %esp,%ebp
+  8001e1:	56                   	push   %esi
+  8001e2:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001e3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001e6:	8b 35 04 50 80 00    	mov    0x805004,%esi
+  8001ec:	e8 7c 0a 00 00       	call   800c6d <sys_getenvid>
+  8001f1:	83 ec 0c             	sub    $0xc,%esp
+  8001f4:	ff 75 0c             	push   0xc(%ebp)
+  8001f7:	ff 75 08             	push   0x8(%ebp)
+  8001fa:	56                   	push   %esi
+  8001fb:	50                   	push   %eax
+  8001fc:	68 08 3a 80 00       	push   $0x803a08
+  800201:	e8 b3 00 00 00       	call   8002b9 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800206:	83 c4 18             	add    $0x18,%esp
+  800209:	53                   	push   %ebx
+  80020a:	ff 75 10             	push   0x10(%ebp)
+  80020d:	e8 56 00 00 00       	call   800268 <vcprintf>
+	cprintf("\n");
+  800212:	c7 04 24 c7 3e 80 00 	movl   $0x803ec7,(%esp)
+  800219:	e8 9b 00 00 00       	call   8002b9 <cprintf>
+  80021e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800221:	cc                   	int3
+	while (1)
+  800222:	eb fd                	jmp    800221 <_panic+0x43>
+
+00800224 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800224:	55                   	push   %ebp
+  800225:	89 e5                	mov    %esp,%ebp
+  800227:	53                   	push   %ebx
+  800228:	83 ec 04             	sub    $0x4,%esp
+  80022b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80022e:	8b 13                	mov    (%ebx),%edx
+  800230:	8d 42 01             	lea    0x1(%edx),%eax
+  800233:	89 03                	mov    %eax,(%ebx)
+  800235:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800238:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80023c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800241:	74 09                	je     80024c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800243:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800247:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80024a:	c9                   	leave
+  80024b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80024c:	83 ec 08             	sub    $0x8,%esp
+  80024f:	68 ff 00 00 00       	push   $0xff
+  800254:	8d 43 08             	lea    0x8(%ebx),%eax
+  800257:	50                   	push   %eax
+  800258:	e8 7a 09 00 00       	call   800bd7 <sys_cputs>
+		b->idx = 0;
+  80025d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800263:	83 c4 10             	add    $0x10,%esp
+  800266:	eb db                	jmp    800243 <putch+0x1f>
+
+00800268 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800268:	55                   	push   %ebp
+  800269:	89 e5                	mov    %esp,%ebp
+  80026b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800271:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800278:	00 00 00 
+	b.cnt = 0;
+  80027b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800282:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800285:	ff 75 0c             	push   0xc(%ebp)
+  800288:	ff 75 08             	push   0x8(%ebp)
+  80028b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800291:	50                   	push   %eax
+  800292:	68 24 02 80 00       	push   $0x800224
+  800297:	e8 14 01 00 00       	call   8003b0 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80029c:	83 c4 08             	add    $0x8,%esp
+  80029f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002a5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002ab:	50                   	push   %eax
+  8002ac:	e8 26 09 00 00       	call   800bd7 <sys_cputs>
+
+	return b.cnt;
+}
+  8002b1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002b7:	c9                   	leave
+  8002b8:	c3                   	ret
+
+008002b9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002b9:	55                   	push   %ebp
+  8002ba:	89 e5                	mov    %esp,%ebp
+  8002bc:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002bf:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002c2:	50                   	push   %eax
+  8002c3:	ff 75 08             	push   0x8(%ebp)
+  8002c6:	e8 9d ff ff ff       	call   800268 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002cb:	c9                   	leave
+  8002cc:	c3                   	ret
+
+008002cd <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	57                   	push   %edi
+  8002d1:	56                   	push   %esi
+  8002d2:	53                   	push   %ebx
+  8002d3:	83 ec 1c             	sub    $0x1c,%esp
+  8002d6:	89 c7                	mov    %eax,%edi
+  8002d8:	89 d6                	mov    %edx,%esi
+  8002da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002e0:	89 d1                	mov    %edx,%ecx
+  8002e2:	89 c2                	mov    %eax,%edx
+  8002e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002ea:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002ed:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002f3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002fa:	39 c2                	cmp    %eax,%edx
+  8002fc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002ff:	72 3e                	jb     80033f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800301:	83 ec 0c             	sub    $0xc,%esp
+  800304:	ff 75 18             	push   0x18(%ebp)
+  800307:	83 eb 01             	sub    $0x1,%ebx
+  80030a:	53                   	push   %ebx
+  80030b:	50                   	push   %eax
+  80030c:	83 ec 08             	sub    $0x8,%esp
+  80030f:	ff 75 e4             	push   -0x1c(%ebp)
+  800312:	ff 75 e0             	push   -0x20(%ebp)
+  800315:	ff 75 dc             	push   -0x24(%ebp)
+  800318:	ff 75 d8             	push   -0x28(%ebp)
+  80031b:	e8 05 35 00 00       	call   803825 <__udivdi3>
+  800320:	83 c4 18             	add    $0x18,%esp
+  800323:	52                   	push   %edx
+  800324:	50                   	push   %eax
+  800325:	89 f2                	mov    %esi,%edx
+  800327:	89 f8                	mov    %edi,%eax
+  800329:	e8 9f ff ff ff       	call   8002cd <printnum>
+  80032e:	83 c4 20             	add    $0x20,%esp
+  800331:	eb 13                	jmp    800346 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800333:	83 ec 08             	sub    $0x8,%esp
+  800336:	56                   	push   %esi
+  800337:	ff 75 18             	push   0x18(%ebp)
+  80033a:	ff d7                	call   *%edi
+  80033c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80033f:	83 eb 01             	sub    $0x1,%ebx
+  800342:	85 db                	test   %ebx,%ebx
+  800344:	7f ed                	jg     800333 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800346:	83 ec 08             	sub    $0x8,%esp
+  800349:	56                   	push   %esi
+  80034a:	83 ec 04             	sub    $0x4,%esp
+  80034d:	ff 75 e4             	push   -0x1c(%ebp)
+  800350:	ff 75 e0             	push   -0x20(%ebp)
+  800353:	ff 75 dc             	push   -0x24(%ebp)
+  800356:	ff 75 d8             	push   -0x28(%ebp)
+  800359:	e8 e5 34 00 00       	call   803843 <__umoddi3>
+  80035e:	83 c4 14             	add    $0x14,%esp
+  800361:	0f be 80 2b 3a 80 00 	movsbl 0x803a2b(%eax),%eax
+  800368:	50                   	push   %eax
+  800369:	ff d7                	call   *%edi
+}
+  80036b:	83 c4 10             	add    $0x10,%esp
+  80036e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800371:	5b                   	pop    %ebx
+  800372:	5e                   	pop    %esi
+  800373:	5f                   	pop    %edi
+  800374:	5d                   	pop    %ebp
+  800375:	c3                   	ret
+
+00800376 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800376:	55                   	push   %ebp
+  800377:	89 e5                	mov    %esp,%ebp
+  800379:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80037c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800380:	8b 10                	mov    (%eax),%edx
+  800382:	3b 50 04             	cmp    0x4(%eax),%edx
+  800385:	73 0a                	jae    800391 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800387:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80038a:	89 08                	mov    %ecx,(%eax)
+  80038c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80038f:	88 02                	mov    %al,(%edx)
+}
+  800391:	5d                   	pop    %ebp
+  800392:	c3                   	ret
+
+00800393 <printfmt>:
+{
+  800393:	55                   	push   %ebp
+  800394:	89 e5                	mov    %esp,%ebp
+  800396:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800399:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80039c:	50                   	push   %eax
+  80039d:	ff 75 10             	push   0x10(%ebp)
+  8003a0:	ff 75 0c             	push   0xc(%ebp)
+  8003a3:	ff 75 08             	push   0x8(%ebp)
+  8003a6:	e8 05 00 00 00       	call   8003b0 <vprintfmt>
+}
+  8003ab:	83 c4 10             	add    $0x10,%esp
+  8003ae:	c9                   	leave
+  8003af:	c3                   	ret
+
+008003b0 <vprintfmt>:
+{
+  8003b0:	55                   	push   %ebp
+  8003b1:	89 e5                	mov    %esp,%ebp
+  8003b3:	57                   	push   %edi
+  8003b4:	56                   	push   %esi
+  8003b5:	53                   	push   %ebx
+  8003b6:	83 ec 2c             	sub    $0x2c,%esp
+  8003b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003bf:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003c2:	eb 0a                	jmp    8003ce <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003c4:	83 ec 08             	sub    $0x8,%esp
+  8003c7:	53                   	push   %ebx
+  8003c8:	50                   	push   %eax
+  8003c9:	ff d6                	call   *%esi
+  8003cb:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003ce:	83 c7 01             	add    $0x1,%edi
+  8003d1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003d5:	83 f8 25             	cmp    $0x25,%eax
+  8003d8:	74 0c                	je     8003e6 <vprintfmt+0x36>
+			if (ch == '\0')
+  8003da:	85 c0                	test   %eax,%eax
+  8003dc:	75 e6                	jne    8003c4 <vprintfmt+0x14>
+}
+  8003de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e1:	5b                   	pop    %ebx
+  8003e2:	5e                   	pop    %esi
+  8003e3:	5f                   	pop    %edi
+  8003e4:	5d                   	pop    %ebp
+  8003e5:	c3                   	ret
+		padc = ' ';
+  8003e6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003ea:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003f1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003f8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800404:	8d 47 01             	lea    0x1(%edi),%eax
+  800407:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80040a:	0f b6 17             	movzbl (%edi),%edx
+  80040d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800410:	3c 55                	cmp    $0x55,%al
+  800412:	0f 87 cf 03 00 00    	ja     8007e7 <vprintfmt+0x437>
+  800418:	0f b6 c0             	movzbl %al,%eax
+  80041b:	ff 24 85 80 3b 80 00 	jmp    *0x803b80(,%eax,4)
+  800422:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800425:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800429:	eb d9                	jmp    800404 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80042b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80042e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800432:	eb d0                	jmp    800404 <vprintfmt+0x54>
+  800434:	0f b6 d2             	movzbl %dl,%edx
+  800437:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80043a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800442:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800445:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800449:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80044c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80044f:	83 f9 09             	cmp    $0x9,%ecx
+  800452:	77 55                	ja     8004a9 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800454:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800457:	eb e9                	jmp    800442 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800459:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045c:	8b 00                	mov    (%eax),%eax
+  80045e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800461:	8b 45 14             	mov    0x14(%ebp),%eax
+  800464:	8d 40 04             	lea    0x4(%eax),%eax
+  800467:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80046a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80046d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800471:	79 91                	jns    800404 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800473:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800476:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800479:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800480:	eb 82                	jmp    800404 <vprintfmt+0x54>
+			if (width < 0)
+  800482:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800485:	85 d2                	test   %edx,%edx
+  800487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048c:	0f 49 c2             	cmovns %edx,%eax
+  80048f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800492:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800495:	e9 6a ff ff ff       	jmp    800404 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80049a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80049d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004a4:	e9 5b ff ff ff       	jmp    800404 <vprintfmt+0x54>
+  8004a9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004af:	eb bc                	jmp    80046d <vprintfmt+0xbd>
+			lflag++;
+  8004b1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004b7:	e9 48 ff ff ff       	jmp    800404 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bf:	8d 78 04             	lea    0x4(%eax),%edi
+  8004c2:	83 ec 08             	sub    $0x8,%esp
+  8004c5:	53                   	push   %ebx
+  8004c6:	ff 30                	push   (%eax)
+  8004c8:	ff d6                	call   *%esi
+			break;
+  8004ca:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004cd:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004d0:	e9 b1 02 00 00       	jmp    800786 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8004d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004db:	8b 10                	mov    (%eax),%edx
+  8004dd:	89 d0                	mov    %edx,%eax
+  8004df:	f7 d8                	neg    %eax
+  8004e1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004e4:	83 f8 11             	cmp    $0x11,%eax
+  8004e7:	7f 23                	jg     80050c <vprintfmt+0x15c>
+  8004e9:	8b 14 85 e0 3c 80 00 	mov    0x803ce0(,%eax,4),%edx
+  8004f0:	85 d2                	test   %edx,%edx
+  8004f2:	74 18                	je     80050c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004f4:	52                   	push   %edx
+  8004f5:	68 32 3e 80 00       	push   $0x803e32
+  8004fa:	53                   	push   %ebx
+  8004fb:	56                   	push   %esi
+  8004fc:	e8 92 fe ff ff       	call   800393 <printfmt>
+  800501:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800504:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800507:	e9 7a 02 00 00       	jmp    800786 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80050c:	50                   	push   %eax
+  80050d:	68 43 3a 80 00       	push   $0x803a43
+  800512:	53                   	push   %ebx
+  800513:	56                   	push   %esi
+  800514:	e8 7a fe ff ff       	call   800393 <printfmt>
+  800519:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80051c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80051f:	e9 62 02 00 00       	jmp    800786 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	83 c0 04             	add    $0x4,%eax
+  80052a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80052d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800530:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800532:	85 c9                	test   %ecx,%ecx
+  800534:	b8 3c 3a 80 00       	mov    $0x803a3c,%eax
+  800539:	0f 45 c1             	cmovne %ecx,%eax
+  80053c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80053f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800543:	7e 06                	jle    80054b <vprintfmt+0x19b>
+  800545:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800549:	75 0b                	jne    800556 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80054b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80054e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800551:	89 75 08             	mov    %esi,0x8(%ebp)
+  800554:	eb 5c                	jmp    8005b2 <vprintfmt+0x202>
+  800556:	83 ec 08             	sub    $0x8,%esp
+  800559:	ff 75 d0             	push   -0x30(%ebp)
+  80055c:	ff 75 cc             	push   -0x34(%ebp)
+  80055f:	e8 20 03 00 00       	call   800884 <strnlen>
+  800564:	89 c2                	mov    %eax,%edx
+  800566:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800569:	29 d0                	sub    %edx,%eax
+  80056b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80056e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800572:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800575:	89 75 08             	mov    %esi,0x8(%ebp)
+  800578:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80057a:	eb 0e                	jmp    80058a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80057c:	83 ec 08             	sub    $0x8,%esp
+  80057f:	53                   	push   %ebx
+  800580:	57                   	push   %edi
+  800581:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800584:	83 ee 01             	sub    $0x1,%esi
+  800587:	83 c4 10             	add    $0x10,%esp
+  80058a:	85 f6                	test   %esi,%esi
+  80058c:	7f ee                	jg     80057c <vprintfmt+0x1cc>
+  80058e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800591:	8b 75 08             	mov    0x8(%ebp),%esi
+  800594:	85 c0                	test   %eax,%eax
+  800596:	ba 00 00 00 00       	mov    $0x0,%edx
+  80059b:	0f 49 d0             	cmovns %eax,%edx
+  80059e:	29 d0                	sub    %edx,%eax
+  8005a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005a3:	eb a6                	jmp    80054b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005a5:	83 ec 08             	sub    $0x8,%esp
+  8005a8:	53                   	push   %ebx
+  8005a9:	52                   	push   %edx
+  8005aa:	ff 55 08             	call   *0x8(%ebp)
+  8005ad:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005b0:	89 f1                	mov    %esi,%ecx
+  8005b2:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005b5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005b9:	0f be d0             	movsbl %al,%edx
+  8005bc:	85 d2                	test   %edx,%edx
+  8005be:	74 28                	je     8005e8 <vprintfmt+0x238>
+  8005c0:	85 ff                	test   %edi,%edi
+  8005c2:	78 05                	js     8005c9 <vprintfmt+0x219>
+  8005c4:	83 ef 01             	sub    $0x1,%edi
+  8005c7:	78 30                	js     8005f9 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005c9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005cd:	74 d6                	je     8005a5 <vprintfmt+0x1f5>
+  8005cf:	0f be c0             	movsbl %al,%eax
+  8005d2:	83 e8 20             	sub    $0x20,%eax
+  8005d5:	83 f8 5e             	cmp    $0x5e,%eax
+  8005d8:	76 cb                	jbe    8005a5 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005da:	83 ec 08             	sub    $0x8,%esp
+  8005dd:	53                   	push   %ebx
+  8005de:	6a 3f                	push   $0x3f
+  8005e0:	ff 55 08             	call   *0x8(%ebp)
+  8005e3:	83 c4 10             	add    $0x10,%esp
+  8005e6:	eb c8                	jmp    8005b0 <vprintfmt+0x200>
+  8005e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005eb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005ee:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005f1:	01 d0                	add    %edx,%eax
+  8005f3:	29 c8                	sub    %ecx,%eax
+  8005f5:	89 c7                	mov    %eax,%edi
+  8005f7:	eb 13                	jmp    80060c <vprintfmt+0x25c>
+  8005f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005fc:	eb ed                	jmp    8005eb <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005fe:	83 ec 08             	sub    $0x8,%esp
+  800601:	53                   	push   %ebx
+  800602:	6a 20                	push   $0x20
+  800604:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800606:	83 ef 01             	sub    $0x1,%edi
+  800609:	83 c4 10             	add    $0x10,%esp
+  80060c:	85 ff                	test   %edi,%edi
+  80060e:	7f ee                	jg     8005fe <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800610:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800613:	89 45 14             	mov    %eax,0x14(%ebp)
+  800616:	e9 6b 01 00 00       	jmp    800786 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80061b:	83 f9 01             	cmp    $0x1,%ecx
+  80061e:	7f 1f                	jg     80063f <vprintfmt+0x28f>
+	else if (lflag)
+  800620:	85 c9                	test   %ecx,%ecx
+  800622:	74 67                	je     80068b <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800624:	8b 45 14             	mov    0x14(%ebp),%eax
+  800627:	8b 00                	mov    (%eax),%eax
+  800629:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062c:	89 c1                	mov    %eax,%ecx
+  80062e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800631:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800634:	8b 45 14             	mov    0x14(%ebp),%eax
+  800637:	8d 40 04             	lea    0x4(%eax),%eax
+  80063a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063d:	eb 17                	jmp    800656 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80063f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800642:	8b 50 04             	mov    0x4(%eax),%edx
+  800645:	8b 00                	mov    (%eax),%eax
+  800647:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80064a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80064d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800650:	8d 40 08             	lea    0x8(%eax),%eax
+  800653:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800656:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800659:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80065c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800661:	85 c9                	test   %ecx,%ecx
+  800663:	0f 89 03 01 00 00    	jns    80076c <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800669:	83 ec 08             	sub    $0x8,%esp
+  80066c:	53                   	push   %ebx
+  80066d:	6a 2d                	push   $0x2d
+  80066f:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800671:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800674:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800677:	f7 da                	neg    %edx
+  800679:	83 d1 00             	adc    $0x0,%ecx
+  80067c:	f7 d9                	neg    %ecx
+  80067e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800681:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800686:	e9 e1 00 00 00       	jmp    80076c <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80068b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068e:	8b 00                	mov    (%eax),%eax
+  800690:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800693:	89 c1                	mov    %eax,%ecx
+  800695:	c1 f9 1f             	sar    $0x1f,%ecx
+  800698:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80069b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069e:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a4:	eb b0                	jmp    800656 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006a6:	83 f9 01             	cmp    $0x1,%ecx
+  8006a9:	7f 1e                	jg     8006c9 <vprintfmt+0x319>
+	else if (lflag)
+  8006ab:	85 c9                	test   %ecx,%ecx
+  8006ad:	74 32                	je     8006e1 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8006af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b2:	8b 10                	mov    (%eax),%edx
+  8006b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006bf:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006c4:	e9 a3 00 00 00       	jmp    80076c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cc:	8b 10                	mov    (%eax),%edx
+  8006ce:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006d1:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006dc:	e9 8b 00 00 00       	jmp    80076c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e4:	8b 10                	mov    (%eax),%edx
+  8006e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006f1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006f6:	eb 74                	jmp    80076c <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8006f8:	83 f9 01             	cmp    $0x1,%ecx
+  8006fb:	7f 1b                	jg     800718 <vprintfmt+0x368>
+	else if (lflag)
+  8006fd:	85 c9                	test   %ecx,%ecx
+  8006ff:	74 2c                	je     80072d <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800701:	8b 45 14             	mov    0x14(%ebp),%eax
+  800704:	8b 10                	mov    (%eax),%edx
+  800706:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070b:	8d 40 04             	lea    0x4(%eax),%eax
+  80070e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800711:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800716:	eb 54                	jmp    80076c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800718:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071b:	8b 10                	mov    (%eax),%edx
+  80071d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800720:	8d 40 08             	lea    0x8(%eax),%eax
+  800723:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800726:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80072b:	eb 3f                	jmp    80076c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80072d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800730:	8b 10                	mov    (%eax),%edx
+  800732:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800737:	8d 40 04             	lea    0x4(%eax),%eax
+  80073a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80073d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800742:	eb 28                	jmp    80076c <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800744:	83 ec 08             	sub    $0x8,%esp
+  800747:	53                   	push   %ebx
+  800748:	6a 30                	push   $0x30
+  80074a:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80074c:	83 c4 08             	add    $0x8,%esp
+  80074f:	53                   	push   %ebx
+  800750:	6a 78                	push   $0x78
+  800752:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800754:	8b 45 14             	mov    0x14(%ebp),%eax
+  800757:	8b 10                	mov    (%eax),%edx
+  800759:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80075e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800761:	8d 40 04             	lea    0x4(%eax),%eax
+  800764:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800767:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80076c:	83 ec 0c             	sub    $0xc,%esp
+  80076f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800773:	50                   	push   %eax
+  800774:	ff 75 e0             	push   -0x20(%ebp)
+  800777:	57                   	push   %edi
+  800778:	51                   	push   %ecx
+  800779:	52                   	push   %edx
+  80077a:	89 da                	mov    %ebx,%edx
+  80077c:	89 f0                	mov    %esi,%eax
+  80077e:	e8 4a fb ff ff       	call   8002cd <printnum>
+			break;
+  800783:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800786:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800789:	e9 40 fc ff ff       	jmp    8003ce <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80078e:	83 f9 01             	cmp    $0x1,%ecx
+  800791:	7f 1b                	jg     8007ae <vprintfmt+0x3fe>
+	else if (lflag)
+  800793:	85 c9                	test   %ecx,%ecx
+  800795:	74 2c                	je     8007c3 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800797:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079a:	8b 10                	mov    (%eax),%edx
+  80079c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007a7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007ac:	eb be                	jmp    80076c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b1:	8b 10                	mov    (%eax),%edx
+  8007b3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007b6:	8d 40 08             	lea    0x8(%eax),%eax
+  8007b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007bc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007c1:	eb a9                	jmp    80076c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c6:	8b 10                	mov    (%eax),%edx
+  8007c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007d8:	eb 92                	jmp    80076c <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8007da:	83 ec 08             	sub    $0x8,%esp
+  8007dd:	53                   	push   %ebx
+  8007de:	6a 25                	push   $0x25
+  8007e0:	ff d6                	call   *%esi
+			break;
+  8007e2:	83 c4 10             	add    $0x10,%esp
+  8007e5:	eb 9f                	jmp    800786 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8007e7:	83 ec 08             	sub    $0x8,%esp
+  8007ea:	53                   	push   %ebx
+  8007eb:	6a 25                	push   $0x25
+  8007ed:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007ef:	83 c4 10             	add    $0x10,%esp
+  8007f2:	89 f8                	mov    %edi,%eax
+  8007f4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007f8:	74 05                	je     8007ff <vprintfmt+0x44f>
+  8007fa:	83 e8 01             	sub    $0x1,%eax
+  8007fd:	eb f5                	jmp    8007f4 <vprintfmt+0x444>
+  8007ff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800802:	eb 82                	jmp    800786 <vprintfmt+0x3d6>
+
+00800804 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800804:	55                   	push   %ebp
+  800805:	89 e5                	mov    %esp,%ebp
+  800807:	83 ec 18             	sub    $0x18,%esp
+  80080a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80080d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800810:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800813:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800817:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80081a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800821:	85 c0                	test   %eax,%eax
+  800823:	74 26                	je     80084b <vsnprintf+0x47>
+  800825:	85 d2                	test   %edx,%edx
+  800827:	7e 22                	jle    80084b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800829:	ff 75 14             	push   0x14(%ebp)
+  80082c:	ff 75 10             	push   0x10(%ebp)
+  80082f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800832:	50                   	push   %eax
+  800833:	68 76 03 80 00       	push   $0x800376
+  800838:	e8 73 fb ff ff       	call   8003b0 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80083d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800840:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800843:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800846:	83 c4 10             	add    $0x10,%esp
+}
+  800849:	c9                   	leave
+  80084a:	c3                   	ret
+		return -E_INVAL;
+  80084b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800850:	eb f7                	jmp    800849 <vsnprintf+0x45>
+
+00800852 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800852:	55                   	push   %ebp
+  800853:	89 e5                	mov    %esp,%ebp
+  800855:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800858:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80085b:	50                   	push   %eax
+  80085c:	ff 75 10             	push   0x10(%ebp)
+  80085f:	ff 75 0c             	push   0xc(%ebp)
+  800862:	ff 75 08             	push   0x8(%ebp)
+  800865:	e8 9a ff ff ff       	call   800804 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80086a:	c9                   	leave
+  80086b:	c3                   	ret
+
+0080086c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80086c:	55                   	push   %ebp
+  80086d:	89 e5                	mov    %esp,%ebp
+  80086f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800872:	b8 00 00 00 00       	mov    $0x0,%eax
+  800877:	eb 03                	jmp    80087c <strlen+0x10>
+		n++;
+  800879:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80087c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800880:	75 f7                	jne    800879 <strlen+0xd>
+	return n;
+}
+  800882:	5d                   	pop    %ebp
+  800883:	c3                   	ret
+
+00800884 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80088a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80088d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800892:	eb 03                	jmp    800897 <strnlen+0x13>
+		n++;
+  800894:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800897:	39 d0                	cmp    %edx,%eax
+  800899:	74 08                	je     8008a3 <strnlen+0x1f>
+  80089b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80089f:	75 f3                	jne    800894 <strnlen+0x10>
+  8008a1:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008a3:	89 d0                	mov    %edx,%eax
+  8008a5:	5d                   	pop    %ebp
+  8008a6:	c3                   	ret
+
+008008a7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008a7:	55                   	push   %ebp
+  8008a8:	89 e5                	mov    %esp,%ebp
+  8008aa:	53                   	push   %ebx
+  8008ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008ba:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008bd:	83 c0 01             	add    $0x1,%eax
+  8008c0:	84 d2                	test   %dl,%dl
+  8008c2:	75 f2                	jne    8008b6 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008c4:	89 c8                	mov    %ecx,%eax
+  8008c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008c9:	c9                   	leave
+  8008ca:	c3                   	ret
+
+008008cb <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008cb:	55                   	push   %ebp
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	53                   	push   %ebx
+  8008cf:	83 ec 10             	sub    $0x10,%esp
+  8008d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008d5:	53                   	push   %ebx
+  8008d6:	e8 91 ff ff ff       	call   80086c <strlen>
+  8008db:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008de:	ff 75 0c             	push   0xc(%ebp)
+  8008e1:	01 d8                	add    %ebx,%eax
+  8008e3:	50                   	push   %eax
+  8008e4:	e8 be ff ff ff       	call   8008a7 <strcpy>
+	return dst;
+}
+  8008e9:	89 d8                	mov    %ebx,%eax
+  8008eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ee:	c9                   	leave
+  8008ef:	c3                   	ret
+
+008008f0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008f0:	55                   	push   %ebp
+  8008f1:	89 e5                	mov    %esp,%ebp
+  8008f3:	56                   	push   %esi
+  8008f4:	53                   	push   %ebx
+  8008f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008fb:	89 f3                	mov    %esi,%ebx
+  8008fd:	03 5d 10             	add    0x10(%ebp),%ebx
+  800900:	89 f0                	mov    %esi,%eax
+  800902:	eb 0f                	jmp    800913 <strncpy+0x23>
+		*dst++ = *src;
+  800904:	83 c0 01             	add    $0x1,%eax
+  800907:	0f b6 0a             	movzbl (%edx),%ecx
+  80090a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80090d:	80 f9 01             	cmp    $0x1,%cl
+  800910:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800913:	39 d8                	cmp    %ebx,%eax
+  800915:	75 ed                	jne    800904 <strncpy+0x14>
+	}
+	return ret;
+}
+  800917:	89 f0                	mov    %esi,%eax
+  800919:	5b                   	pop    %ebx
+  80091a:	5e                   	pop    %esi
+  80091b:	5d                   	pop    %ebp
+  80091c:	c3                   	ret
+
+0080091d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80091d:	55                   	push   %ebp
+  80091e:	89 e5                	mov    %esp,%ebp
+  800920:	56                   	push   %esi
+  800921:	53                   	push   %ebx
+  800922:	8b 75 08             	mov    0x8(%ebp),%esi
+  800925:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800928:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80092b:	89 f0                	mov    %esi,%eax
+  80092d:	85 d2                	test   %edx,%edx
+  80092f:	74 21                	je     800952 <strlcpy+0x35>
+  800931:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800935:	89 f2                	mov    %esi,%edx
+  800937:	eb 09                	jmp    800942 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800939:	83 c1 01             	add    $0x1,%ecx
+  80093c:	83 c2 01             	add    $0x1,%edx
+  80093f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800942:	39 c2                	cmp    %eax,%edx
+  800944:	74 09                	je     80094f <strlcpy+0x32>
+  800946:	0f b6 19             	movzbl (%ecx),%ebx
+  800949:	84 db                	test   %bl,%bl
+  80094b:	75 ec                	jne    800939 <strlcpy+0x1c>
+  80094d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80094f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800952:	29 f0                	sub    %esi,%eax
+}
+  800954:	5b                   	pop    %ebx
+  800955:	5e                   	pop    %esi
+  800956:	5d                   	pop    %ebp
+  800957:	c3                   	ret
+
+00800958 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800958:	55                   	push   %ebp
+  800959:	89 e5                	mov    %esp,%ebp
+  80095b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80095e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800961:	eb 06                	jmp    800969 <strcmp+0x11>
+		p++, q++;
+  800963:	83 c1 01             	add    $0x1,%ecx
+  800966:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800969:	0f b6 01             	movzbl (%ecx),%eax
+  80096c:	84 c0                	test   %al,%al
+  80096e:	74 04                	je     800974 <strcmp+0x1c>
+  800970:	3a 02                	cmp    (%edx),%al
+  800972:	74 ef                	je     800963 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800974:	0f b6 c0             	movzbl %al,%eax
+  800977:	0f b6 12             	movzbl (%edx),%edx
+  80097a:	29 d0                	sub    %edx,%eax
+}
+  80097c:	5d                   	pop    %ebp
+  80097d:	c3                   	ret
+
+0080097e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80097e:	55                   	push   %ebp
+  80097f:	89 e5                	mov    %esp,%ebp
+  800981:	53                   	push   %ebx
+  800982:	8b 45 08             	mov    0x8(%ebp),%eax
+  800985:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800988:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80098b:	eb 09                	jmp    800996 <strncmp+0x18>
+		n--, p++, q++;
+  80098d:	83 ea 01             	sub    $0x1,%edx
+  800990:	83 c0 01             	add    $0x1,%eax
+  800993:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800996:	85 d2                	test   %edx,%edx
+  800998:	74 18                	je     8009b2 <strncmp+0x34>
+  80099a:	0f b6 18             	movzbl (%eax),%ebx
+  80099d:	84 db                	test   %bl,%bl
+  80099f:	74 04                	je     8009a5 <strncmp+0x27>
+  8009a1:	3a 19                	cmp    (%ecx),%bl
+  8009a3:	74 e8                	je     80098d <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009a5:	0f b6 00             	movzbl (%eax),%eax
+  8009a8:	0f b6 11             	movzbl (%ecx),%edx
+  8009ab:	29 d0                	sub    %edx,%eax
+}
+  8009ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009b0:	c9                   	leave
+  8009b1:	c3                   	ret
+		return 0;
+  8009b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b7:	eb f4                	jmp    8009ad <strncmp+0x2f>
+
+008009b9 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009b9:	55                   	push   %ebp
+  8009ba:	89 e5                	mov    %esp,%ebp
+  8009bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009bf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009c3:	eb 03                	jmp    8009c8 <strchr+0xf>
+  8009c5:	83 c0 01             	add    $0x1,%eax
+  8009c8:	0f b6 10             	movzbl (%eax),%edx
+  8009cb:	84 d2                	test   %dl,%dl
+  8009cd:	74 06                	je     8009d5 <strchr+0x1c>
+		if (*s == c)
+  8009cf:	38 ca                	cmp    %cl,%dl
+  8009d1:	75 f2                	jne    8009c5 <strchr+0xc>
+  8009d3:	eb 05                	jmp    8009da <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009da:	5d                   	pop    %ebp
+  8009db:	c3                   	ret
+
+008009dc <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009dc:	55                   	push   %ebp
+  8009dd:	89 e5                	mov    %esp,%ebp
+  8009df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009e6:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009e9:	38 ca                	cmp    %cl,%dl
+  8009eb:	74 09                	je     8009f6 <strfind+0x1a>
+  8009ed:	84 d2                	test   %dl,%dl
+  8009ef:	74 05                	je     8009f6 <strfind+0x1a>
+	for (; *s; s++)
+  8009f1:	83 c0 01             	add    $0x1,%eax
+  8009f4:	eb f0                	jmp    8009e6 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009f6:	5d                   	pop    %ebp
+  8009f7:	c3                   	ret
+
+008009f8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	57                   	push   %edi
+  8009fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009ff:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a02:	85 c9                	test   %ecx,%ecx
+  800a04:	74 20                	je     800a26 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a06:	89 f8                	mov    %edi,%eax
+  800a08:	09 c8                	or     %ecx,%eax
+  800a0a:	a8 03                	test   $0x3,%al
+  800a0c:	75 12                	jne    800a20 <memset+0x28>
+		c &= 0xFF;
+  800a0e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a12:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a18:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a1b:	fc                   	cld
+  800a1c:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a1e:	eb 06                	jmp    800a26 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a20:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a23:	fc                   	cld
+  800a24:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a26:	89 f8                	mov    %edi,%eax
+  800a28:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a2b:	c9                   	leave
+  800a2c:	c3                   	ret
+
+00800a2d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a2d:	55                   	push   %ebp
+  800a2e:	89 e5                	mov    %esp,%ebp
+  800a30:	57                   	push   %edi
+  800a31:	56                   	push   %esi
+  800a32:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a35:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a38:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a3b:	39 c6                	cmp    %eax,%esi
+  800a3d:	73 32                	jae    800a71 <memmove+0x44>
+  800a3f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a42:	39 d0                	cmp    %edx,%eax
+  800a44:	73 2b                	jae    800a71 <memmove+0x44>
+		s += n;
+		d += n;
+  800a46:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a49:	89 d6                	mov    %edx,%esi
+  800a4b:	09 fe                	or     %edi,%esi
+  800a4d:	09 ce                	or     %ecx,%esi
+  800a4f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a55:	75 0e                	jne    800a65 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a57:	83 ef 04             	sub    $0x4,%edi
+  800a5a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a5d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a60:	fd                   	std
+  800a61:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a63:	eb 09                	jmp    800a6e <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a65:	83 ef 01             	sub    $0x1,%edi
+  800a68:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a6b:	fd                   	std
+  800a6c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a6e:	fc                   	cld
+  800a6f:	eb 1a                	jmp    800a8b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a71:	89 f2                	mov    %esi,%edx
+  800a73:	09 c2                	or     %eax,%edx
+  800a75:	09 ca                	or     %ecx,%edx
+  800a77:	f6 c2 03             	test   $0x3,%dl
+  800a7a:	75 0a                	jne    800a86 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a7c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a7f:	89 c7                	mov    %eax,%edi
+  800a81:	fc                   	cld
+  800a82:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a84:	eb 05                	jmp    800a8b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a86:	89 c7                	mov    %eax,%edi
+  800a88:	fc                   	cld
+  800a89:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a8b:	5e                   	pop    %esi
+  800a8c:	5f                   	pop    %edi
+  800a8d:	5d                   	pop    %ebp
+  800a8e:	c3                   	ret
+
+00800a8f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a8f:	55                   	push   %ebp
+  800a90:	89 e5                	mov    %esp,%ebp
+  800a92:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a95:	ff 75 10             	push   0x10(%ebp)
+  800a98:	ff 75 0c             	push   0xc(%ebp)
+  800a9b:	ff 75 08             	push   0x8(%ebp)
+  800a9e:	e8 8a ff ff ff       	call   800a2d <memmove>
+}
+  800aa3:	c9                   	leave
+  800aa4:	c3                   	ret
+
+00800aa5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800aa5:	55                   	push   %ebp
+  800aa6:	89 e5                	mov    %esp,%ebp
+  800aa8:	56                   	push   %esi
+  800aa9:	53                   	push   %ebx
+  800aaa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aad:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ab0:	89 c6                	mov    %eax,%esi
+  800ab2:	03 75 10             	add    0x10(%ebp),%esi
+  800ab5:	eb 06                	jmp    800abd <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ab7:	83 c0 01             	add    $0x1,%eax
+  800aba:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800abd:	39 f0                	cmp    %esi,%eax
+  800abf:	74 14                	je     800ad5 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ac1:	0f b6 08             	movzbl (%eax),%ecx
+  800ac4:	0f b6 1a             	movzbl (%edx),%ebx
+  800ac7:	38 d9                	cmp    %bl,%cl
+  800ac9:	74 ec                	je     800ab7 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800acb:	0f b6 c1             	movzbl %cl,%eax
+  800ace:	0f b6 db             	movzbl %bl,%ebx
+  800ad1:	29 d8                	sub    %ebx,%eax
+  800ad3:	eb 05                	jmp    800ada <memcmp+0x35>
+	}
+
+	return 0;
+  800ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ada:	5b                   	pop    %ebx
+  800adb:	5e                   	pop    %esi
+  800adc:	5d                   	pop    %ebp
+  800add:	c3                   	ret
+
+00800ade <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ae7:	89 c2                	mov    %eax,%edx
+  800ae9:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800aec:	eb 03                	jmp    800af1 <memfind+0x13>
+  800aee:	83 c0 01             	add    $0x1,%eax
+  800af1:	39 d0                	cmp    %edx,%eax
+  800af3:	73 04                	jae    800af9 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800af5:	38 08                	cmp    %cl,(%eax)
+  800af7:	75 f5                	jne    800aee <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800af9:	5d                   	pop    %ebp
+  800afa:	c3                   	ret
+
+00800afb <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800afb:	55                   	push   %ebp
+  800afc:	89 e5                	mov    %esp,%ebp
+  800afe:	57                   	push   %edi
+  800aff:	56                   	push   %esi
+  800b00:	53                   	push   %ebx
+  800b01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b07:	eb 03                	jmp    800b0c <strtol+0x11>
+		s++;
+  800b09:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b0c:	0f b6 02             	movzbl (%edx),%eax
+  800b0f:	3c 20                	cmp    $0x20,%al
+  800b11:	74 f6                	je     800b09 <strtol+0xe>
+  800b13:	3c 09                	cmp    $0x9,%al
+  800b15:	74 f2                	je     800b09 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b17:	3c 2b                	cmp    $0x2b,%al
+  800b19:	74 2a                	je     800b45 <strtol+0x4a>
+	int neg = 0;
+  800b1b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b20:	3c 2d                	cmp    $0x2d,%al
+  800b22:	74 2b                	je     800b4f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b24:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b2a:	75 0f                	jne    800b3b <strtol+0x40>
+  800b2c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b2f:	74 28                	je     800b59 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b31:	85 db                	test   %ebx,%ebx
+  800b33:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b38:	0f 44 d8             	cmove  %eax,%ebx
+  800b3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b40:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b43:	eb 46                	jmp    800b8b <strtol+0x90>
+		s++;
+  800b45:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b48:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b4d:	eb d5                	jmp    800b24 <strtol+0x29>
+		s++, neg = 1;
+  800b4f:	83 c2 01             	add    $0x1,%edx
+  800b52:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b57:	eb cb                	jmp    800b24 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b59:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b5d:	74 0e                	je     800b6d <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b5f:	85 db                	test   %ebx,%ebx
+  800b61:	75 d8                	jne    800b3b <strtol+0x40>
+		s++, base = 8;
+  800b63:	83 c2 01             	add    $0x1,%edx
+  800b66:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b6b:	eb ce                	jmp    800b3b <strtol+0x40>
+		s += 2, base = 16;
+  800b6d:	83 c2 02             	add    $0x2,%edx
+  800b70:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b75:	eb c4                	jmp    800b3b <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b77:	0f be c0             	movsbl %al,%eax
+  800b7a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b7d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b80:	7d 3a                	jge    800bbc <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b82:	83 c2 01             	add    $0x1,%edx
+  800b85:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b89:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b8b:	0f b6 02             	movzbl (%edx),%eax
+  800b8e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b91:	89 f3                	mov    %esi,%ebx
+  800b93:	80 fb 09             	cmp    $0x9,%bl
+  800b96:	76 df                	jbe    800b77 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b98:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b9b:	89 f3                	mov    %esi,%ebx
+  800b9d:	80 fb 19             	cmp    $0x19,%bl
+  800ba0:	77 08                	ja     800baa <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ba2:	0f be c0             	movsbl %al,%eax
+  800ba5:	83 e8 57             	sub    $0x57,%eax
+  800ba8:	eb d3                	jmp    800b7d <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800baa:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bad:	89 f3                	mov    %esi,%ebx
+  800baf:	80 fb 19             	cmp    $0x19,%bl
+  800bb2:	77 08                	ja     800bbc <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bb4:	0f be c0             	movsbl %al,%eax
+  800bb7:	83 e8 37             	sub    $0x37,%eax
+  800bba:	eb c1                	jmp    800b7d <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bbc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bc0:	74 05                	je     800bc7 <strtol+0xcc>
+		*endptr = (char *) s;
+  800bc2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bc5:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800bc7:	89 c8                	mov    %ecx,%eax
+  800bc9:	f7 d8                	neg    %eax
+  800bcb:	85 ff                	test   %edi,%edi
+  800bcd:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bd0:	89 c8                	mov    %ecx,%eax
+  800bd2:	5b                   	pop    %ebx
+  800bd3:	5e                   	pop    %esi
+  800bd4:	5f                   	pop    %edi
+  800bd5:	5d                   	pop    %ebp
+  800bd6:	c3                   	ret
+
+00800bd7 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bd7:	55                   	push   %ebp
+  800bd8:	89 e5                	mov    %esp,%ebp
+  800bda:	57                   	push   %edi
+  800bdb:	56                   	push   %esi
+  800bdc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be8:	89 c3                	mov    %eax,%ebx
+  800bea:	89 c7                	mov    %eax,%edi
+  800bec:	55                   	push   %ebp
+  800bed:	89 e5                	mov    %esp,%ebp
+  800bef:	8d 35 f7 0b 80 00    	lea    0x800bf7,%esi
+  800bf5:	0f 34                	sysenter
+  800bf7:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800bf8:	5b                   	pop    %ebx
+  800bf9:	5e                   	pop    %esi
+  800bfa:	5f                   	pop    %edi
+  800bfb:	5d                   	pop    %ebp
+  800bfc:	c3                   	ret
+
+00800bfd <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	57                   	push   %edi
+  800c01:	56                   	push   %esi
+  800c02:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c03:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c08:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c0d:	89 d1                	mov    %edx,%ecx
+  800c0f:	89 d3                	mov    %edx,%ebx
+  800c11:	89 d7                	mov    %edx,%edi
+  800c13:	55                   	push   %ebp
+  800c14:	89 e5                	mov    %esp,%ebp
+  800c16:	8d 35 1e 0c 80 00    	lea    0x800c1e,%esi
+  800c1c:	0f 34                	sysenter
+  800c1e:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800c1f:	5b                   	pop    %ebx
+  800c20:	5e                   	pop    %esi
+  800c21:	5f                   	pop    %edi
+  800c22:	5d                   	pop    %ebp
+  800c23:	c3                   	ret
+
+00800c24 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	57                   	push   %edi
+  800c28:	56                   	push   %esi
+  800c29:	53                   	push   %ebx
+  800c2a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c35:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c3a:	89 cb                	mov    %ecx,%ebx
+  800c3c:	89 cf                	mov    %ecx,%edi
+  800c3e:	55                   	push   %ebp
+  800c3f:	89 e5                	mov    %esp,%ebp
+  800c41:	8d 35 49 0c 80 00    	lea    0x800c49,%esi
+  800c47:	0f 34                	sysenter
+  800c49:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c4a:	85 c0                	test   %eax,%eax
+  800c4c:	7f 08                	jg     800c56 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800c4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c51:	5b                   	pop    %ebx
+  800c52:	5e                   	pop    %esi
+  800c53:	5f                   	pop    %edi
+  800c54:	5d                   	pop    %ebp
+  800c55:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c56:	83 ec 0c             	sub    $0xc,%esp
+  800c59:	50                   	push   %eax
+  800c5a:	6a 03                	push   $0x3
+  800c5c:	68 47 3d 80 00       	push   $0x803d47
+  800c61:	6a 3d                	push   $0x3d
+  800c63:	68 64 3d 80 00       	push   $0x803d64
+  800c68:	e8 71 f5 ff ff       	call   8001de <_panic>
+
+00800c6d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c6d:	55                   	push   %ebp
+  800c6e:	89 e5                	mov    %esp,%ebp
+  800c70:	57                   	push   %edi
+  800c71:	56                   	push   %esi
+  800c72:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c78:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c7d:	89 d1                	mov    %edx,%ecx
+  800c7f:	89 d3                	mov    %edx,%ebx
+  800c81:	89 d7                	mov    %edx,%edi
+  800c83:	55                   	push   %ebp
+  800c84:	89 e5                	mov    %esp,%ebp
+  800c86:	8d 35 8e 0c 80 00    	lea    0x800c8e,%esi
+  800c8c:	0f 34                	sysenter
+  800c8e:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800c8f:	5b                   	pop    %ebx
+  800c90:	5e                   	pop    %esi
+  800c91:	5f                   	pop    %edi
+  800c92:	5d                   	pop    %ebp
+  800c93:	c3                   	ret
+
+00800c94 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c94:	55                   	push   %ebp
+  800c95:	89 e5                	mov    %esp,%ebp
+  800c97:	57                   	push   %edi
+  800c98:	56                   	push   %esi
+  800c99:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c9f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ca4:	89 d1                	mov    %edx,%ecx
+  800ca6:	89 d3                	mov    %edx,%ebx
+  800ca8:	89 d7                	mov    %edx,%edi
+  800caa:	89 d6                	mov    %edx,%esi
+  800cac:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cae:	5b                   	pop    %ebx
+  800caf:	5e                   	pop    %esi
+  800cb0:	5f                   	pop    %edi
+  800cb1:	5d                   	pop    %ebp
+  800cb2:	c3                   	ret
+
+00800cb3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cb3:	55                   	push   %ebp
+  800cb4:	89 e5                	mov    %esp,%ebp
+  800cb6:	57                   	push   %edi
+  800cb7:	56                   	push   %esi
+  800cb8:	53                   	push   %ebx
+  800cb9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ccc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ccf:	55                   	push   %ebp
+  800cd0:	89 e5                	mov    %esp,%ebp
+  800cd2:	8d 35 da 0c 80 00    	lea    0x800cda,%esi
+  800cd8:	0f 34                	sysenter
+  800cda:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cdb:	85 c0                	test   %eax,%eax
+  800cdd:	7f 08                	jg     800ce7 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800cdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce2:	5b                   	pop    %ebx
+  800ce3:	5e                   	pop    %esi
+  800ce4:	5f                   	pop    %edi
+  800ce5:	5d                   	pop    %ebp
+  800ce6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce7:	83 ec 0c             	sub    $0xc,%esp
+  800cea:	50                   	push   %eax
+  800ceb:	6a 04                	push   $0x4
+  800ced:	68 47 3d 80 00       	push   $0x803d47
+  800cf2:	6a 3d                	push   $0x3d
+  800cf4:	68 64 3d 80 00       	push   $0x803d64
+  800cf9:	e8 e0 f4 ff ff       	call   8001de <_panic>
+
+00800cfe <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cfe:	55                   	push   %ebp
+  800cff:	89 e5                	mov    %esp,%ebp
+  800d01:	57                   	push   %edi
+  800d02:	56                   	push   %esi
+  800d03:	53                   	push   %ebx
+  800d04:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d15:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d18:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d1b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d1d:	85 c0                	test   %eax,%eax
+  800d1f:	7f 08                	jg     800d29 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d24:	5b                   	pop    %ebx
+  800d25:	5e                   	pop    %esi
+  800d26:	5f                   	pop    %edi
+  800d27:	5d                   	pop    %ebp
+  800d28:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d29:	83 ec 0c             	sub    $0xc,%esp
+  800d2c:	50                   	push   %eax
+  800d2d:	6a 05                	push   $0x5
+  800d2f:	68 47 3d 80 00       	push   $0x803d47
+  800d34:	6a 23                	push   $0x23
+  800d36:	68 64 3d 80 00       	push   $0x803d64
+  800d3b:	e8 9e f4 ff ff       	call   8001de <_panic>
+
+00800d40 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d40:	55                   	push   %ebp
+  800d41:	89 e5                	mov    %esp,%ebp
+  800d43:	57                   	push   %edi
+  800d44:	56                   	push   %esi
+  800d45:	53                   	push   %ebx
+  800d46:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d54:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d59:	89 df                	mov    %ebx,%edi
+  800d5b:	55                   	push   %ebp
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	8d 35 66 0d 80 00    	lea    0x800d66,%esi
+  800d64:	0f 34                	sysenter
+  800d66:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d67:	85 c0                	test   %eax,%eax
+  800d69:	7f 08                	jg     800d73 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800d6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6e:	5b                   	pop    %ebx
+  800d6f:	5e                   	pop    %esi
+  800d70:	5f                   	pop    %edi
+  800d71:	5d                   	pop    %ebp
+  800d72:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d73:	83 ec 0c             	sub    $0xc,%esp
+  800d76:	50                   	push   %eax
+  800d77:	6a 06                	push   $0x6
+  800d79:	68 47 3d 80 00       	push   $0x803d47
+  800d7e:	6a 3d                	push   $0x3d
+  800d80:	68 64 3d 80 00       	push   $0x803d64
+  800d85:	e8 54 f4 ff ff       	call   8001de <_panic>
+
+00800d8a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d8a:	55                   	push   %ebp
+  800d8b:	89 e5                	mov    %esp,%ebp
+  800d8d:	57                   	push   %edi
+  800d8e:	56                   	push   %esi
+  800d8f:	53                   	push   %ebx
+  800d90:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d93:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800da3:	89 df                	mov    %ebx,%edi
+  800da5:	55                   	push   %ebp
+  800da6:	89 e5                	mov    %esp,%ebp
+  800da8:	8d 35 b0 0d 80 00    	lea    0x800db0,%esi
+  800dae:	0f 34                	sysenter
+  800db0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800db1:	85 c0                	test   %eax,%eax
+  800db3:	7f 08                	jg     800dbd <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800db5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db8:	5b                   	pop    %ebx
+  800db9:	5e                   	pop    %esi
+  800dba:	5f                   	pop    %edi
+  800dbb:	5d                   	pop    %ebp
+  800dbc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dbd:	83 ec 0c             	sub    $0xc,%esp
+  800dc0:	50                   	push   %eax
+  800dc1:	6a 08                	push   $0x8
+  800dc3:	68 47 3d 80 00       	push   $0x803d47
+  800dc8:	6a 3d                	push   $0x3d
+  800dca:	68 64 3d 80 00       	push   $0x803d64
+  800dcf:	e8 0a f4 ff ff       	call   8001de <_panic>
+
+00800dd4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800dd4:	55                   	push   %ebp
+  800dd5:	89 e5                	mov    %esp,%ebp
+  800dd7:	57                   	push   %edi
+  800dd8:	56                   	push   %esi
+  800dd9:	53                   	push   %ebx
+  800dda:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ddd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800de2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de8:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ded:	89 df                	mov    %ebx,%edi
+  800def:	55                   	push   %ebp
+  800df0:	89 e5                	mov    %esp,%ebp
+  800df2:	8d 35 fa 0d 80 00    	lea    0x800dfa,%esi
+  800df8:	0f 34                	sysenter
+  800dfa:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800dfb:	85 c0                	test   %eax,%eax
+  800dfd:	7f 08                	jg     800e07 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800dff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e02:	5b                   	pop    %ebx
+  800e03:	5e                   	pop    %esi
+  800e04:	5f                   	pop    %edi
+  800e05:	5d                   	pop    %ebp
+  800e06:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e07:	83 ec 0c             	sub    $0xc,%esp
+  800e0a:	50                   	push   %eax
+  800e0b:	6a 09                	push   $0x9
+  800e0d:	68 47 3d 80 00       	push   $0x803d47
+  800e12:	6a 3d                	push   $0x3d
+  800e14:	68 64 3d 80 00       	push   $0x803d64
+  800e19:	e8 c0 f3 ff ff       	call   8001de <_panic>
+
+00800e1e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e1e:	55                   	push   %ebp
+  800e1f:	89 e5                	mov    %esp,%ebp
+  800e21:	57                   	push   %edi
+  800e22:	56                   	push   %esi
+  800e23:	53                   	push   %ebx
+  800e24:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e32:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e37:	89 df                	mov    %ebx,%edi
+  800e39:	55                   	push   %ebp
+  800e3a:	89 e5                	mov    %esp,%ebp
+  800e3c:	8d 35 44 0e 80 00    	lea    0x800e44,%esi
+  800e42:	0f 34                	sysenter
+  800e44:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e45:	85 c0                	test   %eax,%eax
+  800e47:	7f 08                	jg     800e51 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800e49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4c:	5b                   	pop    %ebx
+  800e4d:	5e                   	pop    %esi
+  800e4e:	5f                   	pop    %edi
+  800e4f:	5d                   	pop    %ebp
+  800e50:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e51:	83 ec 0c             	sub    $0xc,%esp
+  800e54:	50                   	push   %eax
+  800e55:	6a 0a                	push   $0xa
+  800e57:	68 47 3d 80 00       	push   $0x803d47
+  800e5c:	6a 3d                	push   $0x3d
+  800e5e:	68 64 3d 80 00       	push   $0x803d64
+  800e63:	e8 76 f3 ff ff       	call   8001de <_panic>
+
+00800e68 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e68:	55                   	push   %ebp
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	57                   	push   %edi
+  800e6c:	56                   	push   %esi
+  800e6d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e74:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e7c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	8d 35 8a 0e 80 00    	lea    0x800e8a,%esi
+  800e88:	0f 34                	sysenter
+  800e8a:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800e8b:	5b                   	pop    %ebx
+  800e8c:	5e                   	pop    %esi
+  800e8d:	5f                   	pop    %edi
+  800e8e:	5d                   	pop    %ebp
+  800e8f:	c3                   	ret
+
+00800e90 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800e90:	55                   	push   %ebp
+  800e91:	89 e5                	mov    %esp,%ebp
+  800e93:	57                   	push   %edi
+  800e94:	56                   	push   %esi
+  800e95:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9c:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ea1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ea7:	55                   	push   %ebp
+  800ea8:	89 e5                	mov    %esp,%ebp
+  800eaa:	8d 35 b2 0e 80 00    	lea    0x800eb2,%esi
+  800eb0:	0f 34                	sysenter
+  800eb2:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800eb3:	5b                   	pop    %ebx
+  800eb4:	5e                   	pop    %esi
+  800eb5:	5f                   	pop    %edi
+  800eb6:	5d                   	pop    %ebp
+  800eb7:	c3                   	ret
+
+00800eb8 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800eb8:	55                   	push   %ebp
+  800eb9:	89 e5                	mov    %esp,%ebp
+  800ebb:	57                   	push   %edi
+  800ebc:	56                   	push   %esi
+  800ebd:	53                   	push   %ebx
+  800ebe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ec1:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ed1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ed4:	89 f7                	mov    %esi,%edi
+  800ed6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed8:	85 c0                	test   %eax,%eax
+  800eda:	7f 08                	jg     800ee4 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800edc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edf:	5b                   	pop    %ebx
+  800ee0:	5e                   	pop    %esi
+  800ee1:	5f                   	pop    %edi
+  800ee2:	5d                   	pop    %ebp
+  800ee3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ee4:	83 ec 0c             	sub    $0xc,%esp
+  800ee7:	50                   	push   %eax
+  800ee8:	6a 0d                	push   $0xd
+  800eea:	68 47 3d 80 00       	push   $0x803d47
+  800eef:	6a 23                	push   $0x23
+  800ef1:	68 64 3d 80 00       	push   $0x803d64
+  800ef6:	e8 e3 f2 ff ff       	call   8001de <_panic>
+
+00800efb <sys_ipc_recv>:
+{
+  800efb:	55                   	push   %ebp
+  800efc:	89 e5                	mov    %esp,%ebp
+  800efe:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800f01:	6a 00                	push   $0x0
+  800f03:	6a 01                	push   $0x1
+  800f05:	ff 75 08             	push   0x8(%ebp)
+  800f08:	e8 ab ff ff ff       	call   800eb8 <sys_ipc_recvv>
+}
+  800f0d:	c9                   	leave
+  800f0e:	c3                   	ret
+
+00800f0f <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800f0f:	55                   	push   %ebp
+  800f10:	89 e5                	mov    %esp,%ebp
+  800f12:	57                   	push   %edi
+  800f13:	56                   	push   %esi
+  800f14:	53                   	push   %ebx
+  800f15:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f18:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f23:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f28:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800f2b:	89 de                	mov    %ebx,%esi
+  800f2d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f2f:	85 c0                	test   %eax,%eax
+  800f31:	7f 08                	jg     800f3b <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800f33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f36:	5b                   	pop    %ebx
+  800f37:	5e                   	pop    %esi
+  800f38:	5f                   	pop    %edi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f3b:	83 ec 0c             	sub    $0xc,%esp
+  800f3e:	50                   	push   %eax
+  800f3f:	6a 0d                	push   $0xd
+  800f41:	68 47 3d 80 00       	push   $0x803d47
+  800f46:	6a 23                	push   $0x23
+  800f48:	68 64 3d 80 00       	push   $0x803d64
+  800f4d:	e8 8c f2 ff ff       	call   8001de <_panic>
+
+00800f52 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f52:	55                   	push   %ebp
+  800f53:	89 e5                	mov    %esp,%ebp
+  800f55:	57                   	push   %edi
+  800f56:	56                   	push   %esi
+  800f57:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f58:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f62:	89 d1                	mov    %edx,%ecx
+  800f64:	89 d3                	mov    %edx,%ebx
+  800f66:	89 d7                	mov    %edx,%edi
+  800f68:	55                   	push   %ebp
+  800f69:	89 e5                	mov    %esp,%ebp
+  800f6b:	8d 35 73 0f 80 00    	lea    0x800f73,%esi
+  800f71:	0f 34                	sysenter
+  800f73:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800f74:	5b                   	pop    %ebx
+  800f75:	5e                   	pop    %esi
+  800f76:	5f                   	pop    %edi
+  800f77:	5d                   	pop    %ebp
+  800f78:	c3                   	ret
+
+00800f79 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800f79:	55                   	push   %ebp
+  800f7a:	89 e5                	mov    %esp,%ebp
+  800f7c:	57                   	push   %edi
+  800f7d:	56                   	push   %esi
+  800f7e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f8f:	89 df                	mov    %ebx,%edi
+  800f91:	55                   	push   %ebp
+  800f92:	89 e5                	mov    %esp,%ebp
+  800f94:	8d 35 9c 0f 80 00    	lea    0x800f9c,%esi
+  800f9a:	0f 34                	sysenter
+  800f9c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800f9d:	5b                   	pop    %ebx
+  800f9e:	5e                   	pop    %esi
+  800f9f:	5f                   	pop    %edi
+  800fa0:	5d                   	pop    %ebp
+  800fa1:	c3                   	ret
+
+00800fa2 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800fa2:	55                   	push   %ebp
+  800fa3:	89 e5                	mov    %esp,%ebp
+  800fa5:	57                   	push   %edi
+  800fa6:	56                   	push   %esi
+  800fa7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fa8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb0:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fb5:	89 cb                	mov    %ecx,%ebx
+  800fb7:	89 cf                	mov    %ecx,%edi
+  800fb9:	55                   	push   %ebp
+  800fba:	89 e5                	mov    %esp,%ebp
+  800fbc:	8d 35 c4 0f 80 00    	lea    0x800fc4,%esi
+  800fc2:	0f 34                	sysenter
+  800fc4:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800fc5:	5b                   	pop    %ebx
+  800fc6:	5e                   	pop    %esi
+  800fc7:	5f                   	pop    %edi
+  800fc8:	5d                   	pop    %ebp
+  800fc9:	c3                   	ret
+
+00800fca <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800fca:	55                   	push   %ebp
+  800fcb:	89 e5                	mov    %esp,%ebp
+  800fcd:	57                   	push   %edi
+  800fce:	56                   	push   %esi
+  800fcf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fd0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdb:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fe0:	89 df                	mov    %ebx,%edi
+  800fe2:	55                   	push   %ebp
+  800fe3:	89 e5                	mov    %esp,%ebp
+  800fe5:	8d 35 ed 0f 80 00    	lea    0x800fed,%esi
+  800feb:	0f 34                	sysenter
+  800fed:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800fee:	5b                   	pop    %ebx
+  800fef:	5e                   	pop    %esi
+  800ff0:	5f                   	pop    %edi
+  800ff1:	5d                   	pop    %ebp
+  800ff2:	c3                   	ret
+
+00800ff3 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	57                   	push   %edi
+  800ff7:	56                   	push   %esi
+  800ff8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ff9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801001:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801004:	b8 14 00 00 00       	mov    $0x14,%eax
+  801009:	89 df                	mov    %ebx,%edi
+  80100b:	55                   	push   %ebp
+  80100c:	89 e5                	mov    %esp,%ebp
+  80100e:	8d 35 16 10 80 00    	lea    0x801016,%esi
+  801014:	0f 34                	sysenter
+  801016:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  801017:	5b                   	pop    %ebx
+  801018:	5e                   	pop    %esi
+  801019:	5f                   	pop    %edi
+  80101a:	5d                   	pop    %ebp
+  80101b:	c3                   	ret
+
+0080101c <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	57                   	push   %edi
+  801020:	56                   	push   %esi
+  801021:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801022:	8b 55 08             	mov    0x8(%ebp),%edx
+  801025:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801028:	b8 13 00 00 00       	mov    $0x13,%eax
+  80102d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801030:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801033:	55                   	push   %ebp
+  801034:	89 e5                	mov    %esp,%ebp
+  801036:	8d 35 3e 10 80 00    	lea    0x80103e,%esi
+  80103c:	0f 34                	sysenter
+  80103e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  80103f:	5b                   	pop    %ebx
+  801040:	5e                   	pop    %esi
+  801041:	5f                   	pop    %edi
+  801042:	5d                   	pop    %ebp
+  801043:	c3                   	ret
+
+00801044 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801044:	55                   	push   %ebp
+  801045:	89 e5                	mov    %esp,%ebp
+  801047:	57                   	push   %edi
+  801048:	56                   	push   %esi
+  801049:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80104a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80104f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801052:	b8 11 00 00 00       	mov    $0x11,%eax
+  801057:	89 cb                	mov    %ecx,%ebx
+  801059:	89 cf                	mov    %ecx,%edi
+  80105b:	89 ce                	mov    %ecx,%esi
+  80105d:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  80105f:	5b                   	pop    %ebx
+  801060:	5e                   	pop    %esi
+  801061:	5f                   	pop    %edi
+  801062:	5d                   	pop    %ebp
+  801063:	c3                   	ret
+
+00801064 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  801064:	55                   	push   %ebp
+  801065:	89 e5                	mov    %esp,%ebp
+  801067:	57                   	push   %edi
+  801068:	56                   	push   %esi
+  801069:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80106a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80106f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801072:	b8 15 00 00 00       	mov    $0x15,%eax
+  801077:	89 cb                	mov    %ecx,%ebx
+  801079:	89 cf                	mov    %ecx,%edi
+  80107b:	55                   	push   %ebp
+  80107c:	89 e5                	mov    %esp,%ebp
+  80107e:	8d 35 86 10 80 00    	lea    0x801086,%esi
+  801084:	0f 34                	sysenter
+  801086:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  801087:	5b                   	pop    %ebx
+  801088:	5e                   	pop    %esi
+  801089:	5f                   	pop    %edi
+  80108a:	5d                   	pop    %ebp
+  80108b:	c3                   	ret
+
+0080108c <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  80108c:	55                   	push   %ebp
+  80108d:	89 e5                	mov    %esp,%ebp
+  80108f:	57                   	push   %edi
+  801090:	56                   	push   %esi
+  801091:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801092:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801097:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109a:	b8 16 00 00 00       	mov    $0x16,%eax
+  80109f:	89 cb                	mov    %ecx,%ebx
+  8010a1:	89 cf                	mov    %ecx,%edi
+  8010a3:	55                   	push   %ebp
+  8010a4:	89 e5                	mov    %esp,%ebp
+  8010a6:	8d 35 ae 10 80 00    	lea    0x8010ae,%esi
+  8010ac:	0f 34                	sysenter
+  8010ae:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8010af:	5b                   	pop    %ebx
+  8010b0:	5e                   	pop    %esi
+  8010b1:	5f                   	pop    %edi
+  8010b2:	5d                   	pop    %ebp
+  8010b3:	c3                   	ret
+
+008010b4 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8010b4:	55                   	push   %ebp
+  8010b5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010ba:	05 00 00 00 30       	add    $0x30000000,%eax
+  8010bf:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8010c2:	5d                   	pop    %ebp
+  8010c3:	c3                   	ret
+
+008010c4 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8010c4:	55                   	push   %ebp
+  8010c5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010ca:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8010cf:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8010d4:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8010d9:	5d                   	pop    %ebp
+  8010da:	c3                   	ret
+
+008010db <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8010db:	55                   	push   %ebp
+  8010dc:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8010de:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8010e3:	eb 02                	jmp    8010e7 <fd_alloc+0xc>
+  8010e5:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8010e7:	89 c2                	mov    %eax,%edx
+  8010e9:	c1 ea 16             	shr    $0x16,%edx
+  8010ec:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8010f3:	f6 c2 01             	test   $0x1,%dl
+  8010f6:	74 2b                	je     801123 <fd_alloc+0x48>
+  8010f8:	89 c2                	mov    %eax,%edx
+  8010fa:	c1 ea 0c             	shr    $0xc,%edx
+  8010fd:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801104:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80110a:	f6 c1 01             	test   $0x1,%cl
+  80110d:	74 14                	je     801123 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80110f:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801115:	75 ce                	jne    8010e5 <fd_alloc+0xa>
+  801117:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80111c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801121:	eb 05                	jmp    801128 <fd_alloc+0x4d>
+			return 0;
+  801123:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801128:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112b:	89 02                	mov    %eax,(%edx)
+}
+  80112d:	89 c8                	mov    %ecx,%eax
+  80112f:	5d                   	pop    %ebp
+  801130:	c3                   	ret
+
+00801131 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801131:	55                   	push   %ebp
+  801132:	89 e5                	mov    %esp,%ebp
+  801134:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801137:	83 f8 1f             	cmp    $0x1f,%eax
+  80113a:	77 30                	ja     80116c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80113c:	c1 e0 0c             	shl    $0xc,%eax
+  80113f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801144:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80114a:	f6 c2 01             	test   $0x1,%dl
+  80114d:	74 24                	je     801173 <fd_lookup+0x42>
+  80114f:	89 c2                	mov    %eax,%edx
+  801151:	c1 ea 0c             	shr    $0xc,%edx
+  801154:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80115b:	f6 c2 01             	test   $0x1,%dl
+  80115e:	74 1a                	je     80117a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801160:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801163:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801165:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80116a:	5d                   	pop    %ebp
+  80116b:	c3                   	ret
+		return -E_INVAL;
+  80116c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801171:	eb f7                	jmp    80116a <fd_lookup+0x39>
+		return -E_INVAL;
+  801173:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801178:	eb f0                	jmp    80116a <fd_lookup+0x39>
+  80117a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80117f:	eb e9                	jmp    80116a <fd_lookup+0x39>
+
+00801181 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801181:	55                   	push   %ebp
+  801182:	89 e5                	mov    %esp,%ebp
+  801184:	53                   	push   %ebx
+  801185:	83 ec 04             	sub    $0x4,%esp
+  801188:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80118b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801190:	eb 03                	jmp    801195 <dev_lookup+0x14>
+  801192:	83 c0 01             	add    $0x1,%eax
+  801195:	8b 1c 85 f0 3d 80 00 	mov    0x803df0(,%eax,4),%ebx
+  80119c:	85 db                	test   %ebx,%ebx
+  80119e:	74 0b                	je     8011ab <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8011a0:	39 13                	cmp    %edx,(%ebx)
+  8011a2:	75 ee                	jne    801192 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8011a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a9:	eb 1f                	jmp    8011ca <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8011ab:	a1 04 60 80 00       	mov    0x806004,%eax
+  8011b0:	8b 40 48             	mov    0x48(%eax),%eax
+  8011b3:	83 ec 04             	sub    $0x4,%esp
+  8011b6:	52                   	push   %edx
+  8011b7:	50                   	push   %eax
+  8011b8:	68 74 3d 80 00       	push   $0x803d74
+  8011bd:	e8 f7 f0 ff ff       	call   8002b9 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8011c2:	83 c4 10             	add    $0x10,%esp
+  8011c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8011ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011cd:	89 1a                	mov    %ebx,(%edx)
+}
+  8011cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011d2:	c9                   	leave
+  8011d3:	c3                   	ret
+
+008011d4 <fd_close>:
+{
+  8011d4:	55                   	push   %ebp
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	57                   	push   %edi
+  8011d8:	56                   	push   %esi
+  8011d9:	53                   	push   %ebx
+  8011da:	83 ec 24             	sub    $0x24,%esp
+  8011dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011e0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011e3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011e6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011e7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8011ed:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011f0:	50                   	push   %eax
+  8011f1:	e8 3b ff ff ff       	call   801131 <fd_lookup>
+  8011f6:	89 c3                	mov    %eax,%ebx
+  8011f8:	83 c4 10             	add    $0x10,%esp
+  8011fb:	85 c0                	test   %eax,%eax
+  8011fd:	78 05                	js     801204 <fd_close+0x30>
+	    || fd != fd2)
+  8011ff:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801202:	74 16                	je     80121a <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801204:	89 f8                	mov    %edi,%eax
+  801206:	84 c0                	test   %al,%al
+  801208:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801210:	89 d8                	mov    %ebx,%eax
+  801212:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801215:	5b                   	pop    %ebx
+  801216:	5e                   	pop    %esi
+  801217:	5f                   	pop    %edi
+  801218:	5d                   	pop    %ebp
+  801219:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80121a:	83 ec 08             	sub    $0x8,%esp
+  80121d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801220:	50                   	push   %eax
+  801221:	ff 36                	push   (%esi)
+  801223:	e8 59 ff ff ff       	call   801181 <dev_lookup>
+  801228:	89 c3                	mov    %eax,%ebx
+  80122a:	83 c4 10             	add    $0x10,%esp
+  80122d:	85 c0                	test   %eax,%eax
+  80122f:	78 1a                	js     80124b <fd_close+0x77>
+		if (dev->dev_close)
+  801231:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801234:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801237:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80123c:	85 c0                	test   %eax,%eax
+  80123e:	74 0b                	je     80124b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801240:	83 ec 0c             	sub    $0xc,%esp
+  801243:	56                   	push   %esi
+  801244:	ff d0                	call   *%eax
+  801246:	89 c3                	mov    %eax,%ebx
+  801248:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80124b:	83 ec 08             	sub    $0x8,%esp
+  80124e:	56                   	push   %esi
+  80124f:	6a 00                	push   $0x0
+  801251:	e8 ea fa ff ff       	call   800d40 <sys_page_unmap>
+	return r;
+  801256:	83 c4 10             	add    $0x10,%esp
+  801259:	eb b5                	jmp    801210 <fd_close+0x3c>
+
+0080125b <close>:
+
+int
+close(int fdnum)
+{
+  80125b:	55                   	push   %ebp
+  80125c:	89 e5                	mov    %esp,%ebp
+  80125e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801261:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801264:	50                   	push   %eax
+  801265:	ff 75 08             	push   0x8(%ebp)
+  801268:	e8 c4 fe ff ff       	call   801131 <fd_lookup>
+  80126d:	83 c4 10             	add    $0x10,%esp
+  801270:	85 c0                	test   %eax,%eax
+  801272:	79 02                	jns    801276 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801274:	c9                   	leave
+  801275:	c3                   	ret
+		return fd_close(fd, 1);
+  801276:	83 ec 08             	sub    $0x8,%esp
+  801279:	6a 01                	push   $0x1
+  80127b:	ff 75 f4             	push   -0xc(%ebp)
+  80127e:	e8 51 ff ff ff       	call   8011d4 <fd_close>
+  801283:	83 c4 10             	add    $0x10,%esp
+  801286:	eb ec                	jmp    801274 <close+0x19>
+
+00801288 <close_all>:
+
+void
+close_all(void)
+{
+  801288:	55                   	push   %ebp
+  801289:	89 e5                	mov    %esp,%ebp
+  80128b:	53                   	push   %ebx
+  80128c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80128f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801294:	83 ec 0c             	sub    $0xc,%esp
+  801297:	53                   	push   %ebx
+  801298:	e8 be ff ff ff       	call   80125b <close>
+	for (i = 0; i < MAXFD; i++)
+  80129d:	83 c3 01             	add    $0x1,%ebx
+  8012a0:	83 c4 10             	add    $0x10,%esp
+  8012a3:	83 fb 20             	cmp    $0x20,%ebx
+  8012a6:	75 ec                	jne    801294 <close_all+0xc>
+}
+  8012a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012ab:	c9                   	leave
+  8012ac:	c3                   	ret
+
+008012ad <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8012ad:	55                   	push   %ebp
+  8012ae:	89 e5                	mov    %esp,%ebp
+  8012b0:	57                   	push   %edi
+  8012b1:	56                   	push   %esi
+  8012b2:	53                   	push   %ebx
+  8012b3:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8012b6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012b9:	50                   	push   %eax
+  8012ba:	ff 75 08             	push   0x8(%ebp)
+  8012bd:	e8 6f fe ff ff       	call   801131 <fd_lookup>
+  8012c2:	89 c3                	mov    %eax,%ebx
+  8012c4:	83 c4 10             	add    $0x10,%esp
+  8012c7:	85 c0                	test   %eax,%eax
+  8012c9:	78 7f                	js     80134a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8012cb:	83 ec 0c             	sub    $0xc,%esp
+  8012ce:	ff 75 0c             	push   0xc(%ebp)
+  8012d1:	e8 85 ff ff ff       	call   80125b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8012d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8012d9:	c1 e6 0c             	shl    $0xc,%esi
+  8012dc:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8012e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8012e5:	89 3c 24             	mov    %edi,(%esp)
+  8012e8:	e8 d7 fd ff ff       	call   8010c4 <fd2data>
+  8012ed:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8012ef:	89 34 24             	mov    %esi,(%esp)
+  8012f2:	e8 cd fd ff ff       	call   8010c4 <fd2data>
+  8012f7:	83 c4 10             	add    $0x10,%esp
+  8012fa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8012fd:	89 d8                	mov    %ebx,%eax
+  8012ff:	c1 e8 16             	shr    $0x16,%eax
+  801302:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801309:	a8 01                	test   $0x1,%al
+  80130b:	74 11                	je     80131e <dup+0x71>
+  80130d:	89 d8                	mov    %ebx,%eax
+  80130f:	c1 e8 0c             	shr    $0xc,%eax
+  801312:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801319:	f6 c2 01             	test   $0x1,%dl
+  80131c:	75 36                	jne    801354 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80131e:	89 f8                	mov    %edi,%eax
+  801320:	c1 e8 0c             	shr    $0xc,%eax
+  801323:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80132a:	83 ec 0c             	sub    $0xc,%esp
+  80132d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801332:	50                   	push   %eax
+  801333:	56                   	push   %esi
+  801334:	6a 00                	push   $0x0
+  801336:	57                   	push   %edi
+  801337:	6a 00                	push   $0x0
+  801339:	e8 c0 f9 ff ff       	call   800cfe <sys_page_map>
+  80133e:	89 c3                	mov    %eax,%ebx
+  801340:	83 c4 20             	add    $0x20,%esp
+  801343:	85 c0                	test   %eax,%eax
+  801345:	78 33                	js     80137a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801347:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80134a:	89 d8                	mov    %ebx,%eax
+  80134c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80134f:	5b                   	pop    %ebx
+  801350:	5e                   	pop    %esi
+  801351:	5f                   	pop    %edi
+  801352:	5d                   	pop    %ebp
+  801353:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801354:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80135b:	83 ec 0c             	sub    $0xc,%esp
+  80135e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801363:	50                   	push   %eax
+  801364:	ff 75 d4             	push   -0x2c(%ebp)
+  801367:	6a 00                	push   $0x0
+  801369:	53                   	push   %ebx
+  80136a:	6a 00                	push   $0x0
+  80136c:	e8 8d f9 ff ff       	call   800cfe <sys_page_map>
+  801371:	89 c3                	mov    %eax,%ebx
+  801373:	83 c4 20             	add    $0x20,%esp
+  801376:	85 c0                	test   %eax,%eax
+  801378:	79 a4                	jns    80131e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80137a:	83 ec 08             	sub    $0x8,%esp
+  80137d:	56                   	push   %esi
+  80137e:	6a 00                	push   $0x0
+  801380:	e8 bb f9 ff ff       	call   800d40 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801385:	83 c4 08             	add    $0x8,%esp
+  801388:	ff 75 d4             	push   -0x2c(%ebp)
+  80138b:	6a 00                	push   $0x0
+  80138d:	e8 ae f9 ff ff       	call   800d40 <sys_page_unmap>
+	return r;
+  801392:	83 c4 10             	add    $0x10,%esp
+  801395:	eb b3                	jmp    80134a <dup+0x9d>
+
+00801397 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801397:	55                   	push   %ebp
+  801398:	89 e5                	mov    %esp,%ebp
+  80139a:	56                   	push   %esi
+  80139b:	53                   	push   %ebx
+  80139c:	83 ec 18             	sub    $0x18,%esp
+  80139f:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013a2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013a5:	50                   	push   %eax
+  8013a6:	56                   	push   %esi
+  8013a7:	e8 85 fd ff ff       	call   801131 <fd_lookup>
+  8013ac:	83 c4 10             	add    $0x10,%esp
+  8013af:	85 c0                	test   %eax,%eax
+  8013b1:	78 3c                	js     8013ef <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013b3:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8013b6:	83 ec 08             	sub    $0x8,%esp
+  8013b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013bc:	50                   	push   %eax
+  8013bd:	ff 33                	push   (%ebx)
+  8013bf:	e8 bd fd ff ff       	call   801181 <dev_lookup>
+  8013c4:	83 c4 10             	add    $0x10,%esp
+  8013c7:	85 c0                	test   %eax,%eax
+  8013c9:	78 24                	js     8013ef <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8013cb:	8b 43 08             	mov    0x8(%ebx),%eax
+  8013ce:	83 e0 03             	and    $0x3,%eax
+  8013d1:	83 f8 01             	cmp    $0x1,%eax
+  8013d4:	74 20                	je     8013f6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8013d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013d9:	8b 40 08             	mov    0x8(%eax),%eax
+  8013dc:	85 c0                	test   %eax,%eax
+  8013de:	74 37                	je     801417 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8013e0:	83 ec 04             	sub    $0x4,%esp
+  8013e3:	ff 75 10             	push   0x10(%ebp)
+  8013e6:	ff 75 0c             	push   0xc(%ebp)
+  8013e9:	53                   	push   %ebx
+  8013ea:	ff d0                	call   *%eax
+  8013ec:	83 c4 10             	add    $0x10,%esp
+}
+  8013ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013f2:	5b                   	pop    %ebx
+  8013f3:	5e                   	pop    %esi
+  8013f4:	5d                   	pop    %ebp
+  8013f5:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013f6:	a1 04 60 80 00       	mov    0x806004,%eax
+  8013fb:	8b 40 48             	mov    0x48(%eax),%eax
+  8013fe:	83 ec 04             	sub    $0x4,%esp
+  801401:	56                   	push   %esi
+  801402:	50                   	push   %eax
+  801403:	68 b5 3d 80 00       	push   $0x803db5
+  801408:	e8 ac ee ff ff       	call   8002b9 <cprintf>
+		return -E_INVAL;
+  80140d:	83 c4 10             	add    $0x10,%esp
+  801410:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801415:	eb d8                	jmp    8013ef <read+0x58>
+		return -E_NOT_SUPP;
+  801417:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80141c:	eb d1                	jmp    8013ef <read+0x58>
+
+0080141e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80141e:	55                   	push   %ebp
+  80141f:	89 e5                	mov    %esp,%ebp
+  801421:	57                   	push   %edi
+  801422:	56                   	push   %esi
+  801423:	53                   	push   %ebx
+  801424:	83 ec 0c             	sub    $0xc,%esp
+  801427:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80142a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80142d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801432:	eb 02                	jmp    801436 <readn+0x18>
+  801434:	01 c3                	add    %eax,%ebx
+  801436:	39 f3                	cmp    %esi,%ebx
+  801438:	73 21                	jae    80145b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80143a:	83 ec 04             	sub    $0x4,%esp
+  80143d:	89 f0                	mov    %esi,%eax
+  80143f:	29 d8                	sub    %ebx,%eax
+  801441:	50                   	push   %eax
+  801442:	89 d8                	mov    %ebx,%eax
+  801444:	03 45 0c             	add    0xc(%ebp),%eax
+  801447:	50                   	push   %eax
+  801448:	57                   	push   %edi
+  801449:	e8 49 ff ff ff       	call   801397 <read>
+		if (m < 0)
+  80144e:	83 c4 10             	add    $0x10,%esp
+  801451:	85 c0                	test   %eax,%eax
+  801453:	78 04                	js     801459 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801455:	75 dd                	jne    801434 <readn+0x16>
+  801457:	eb 02                	jmp    80145b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801459:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80145b:	89 d8                	mov    %ebx,%eax
+  80145d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801460:	5b                   	pop    %ebx
+  801461:	5e                   	pop    %esi
+  801462:	5f                   	pop    %edi
+  801463:	5d                   	pop    %ebp
+  801464:	c3                   	ret
+
+00801465 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801465:	55                   	push   %ebp
+  801466:	89 e5                	mov    %esp,%ebp
+  801468:	56                   	push   %esi
+  801469:	53                   	push   %ebx
+  80146a:	83 ec 18             	sub    $0x18,%esp
+  80146d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801470:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801473:	50                   	push   %eax
+  801474:	53                   	push   %ebx
+  801475:	e8 b7 fc ff ff       	call   801131 <fd_lookup>
+  80147a:	83 c4 10             	add    $0x10,%esp
+  80147d:	85 c0                	test   %eax,%eax
+  80147f:	78 37                	js     8014b8 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801481:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801484:	83 ec 08             	sub    $0x8,%esp
+  801487:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80148a:	50                   	push   %eax
+  80148b:	ff 36                	push   (%esi)
+  80148d:	e8 ef fc ff ff       	call   801181 <dev_lookup>
+  801492:	83 c4 10             	add    $0x10,%esp
+  801495:	85 c0                	test   %eax,%eax
+  801497:	78 1f                	js     8014b8 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801499:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80149d:	74 20                	je     8014bf <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80149f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014a2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014a5:	85 c0                	test   %eax,%eax
+  8014a7:	74 37                	je     8014e0 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8014a9:	83 ec 04             	sub    $0x4,%esp
+  8014ac:	ff 75 10             	push   0x10(%ebp)
+  8014af:	ff 75 0c             	push   0xc(%ebp)
+  8014b2:	56                   	push   %esi
+  8014b3:	ff d0                	call   *%eax
+  8014b5:	83 c4 10             	add    $0x10,%esp
+}
+  8014b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014bb:	5b                   	pop    %ebx
+  8014bc:	5e                   	pop    %esi
+  8014bd:	5d                   	pop    %ebp
+  8014be:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014bf:	a1 04 60 80 00       	mov    0x806004,%eax
+  8014c4:	8b 40 48             	mov    0x48(%eax),%eax
+  8014c7:	83 ec 04             	sub    $0x4,%esp
+  8014ca:	53                   	push   %ebx
+  8014cb:	50                   	push   %eax
+  8014cc:	68 d1 3d 80 00       	push   $0x803dd1
+  8014d1:	e8 e3 ed ff ff       	call   8002b9 <cprintf>
+		return -E_INVAL;
+  8014d6:	83 c4 10             	add    $0x10,%esp
+  8014d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014de:	eb d8                	jmp    8014b8 <write+0x53>
+		return -E_NOT_SUPP;
+  8014e0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014e5:	eb d1                	jmp    8014b8 <write+0x53>
+
+008014e7 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8014e7:	55                   	push   %ebp
+  8014e8:	89 e5                	mov    %esp,%ebp
+  8014ea:	53                   	push   %ebx
+  8014eb:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014ee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014f1:	50                   	push   %eax
+  8014f2:	ff 75 08             	push   0x8(%ebp)
+  8014f5:	e8 37 fc ff ff       	call   801131 <fd_lookup>
+  8014fa:	83 c4 10             	add    $0x10,%esp
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	78 3a                	js     80153b <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801501:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801504:	83 ec 08             	sub    $0x8,%esp
+  801507:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80150a:	50                   	push   %eax
+  80150b:	ff 33                	push   (%ebx)
+  80150d:	e8 6f fc ff ff       	call   801181 <dev_lookup>
+  801512:	83 c4 10             	add    $0x10,%esp
+  801515:	85 c0                	test   %eax,%eax
+  801517:	78 22                	js     80153b <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801519:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80151c:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80151f:	85 c0                	test   %eax,%eax
+  801521:	74 0d                	je     801530 <seek+0x49>
+  801523:	83 ec 0c             	sub    $0xc,%esp
+  801526:	53                   	push   %ebx
+  801527:	ff d0                	call   *%eax
+  801529:	83 c4 10             	add    $0x10,%esp
+  80152c:	85 c0                	test   %eax,%eax
+  80152e:	78 0b                	js     80153b <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801530:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801533:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801536:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80153b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80153e:	c9                   	leave
+  80153f:	c3                   	ret
+
+00801540 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801540:	55                   	push   %ebp
+  801541:	89 e5                	mov    %esp,%ebp
+  801543:	53                   	push   %ebx
+  801544:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801547:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80154a:	50                   	push   %eax
+  80154b:	ff 75 08             	push   0x8(%ebp)
+  80154e:	e8 de fb ff ff       	call   801131 <fd_lookup>
+  801553:	83 c4 10             	add    $0x10,%esp
+  801556:	85 c0                	test   %eax,%eax
+  801558:	78 2b                	js     801585 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80155a:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80155d:	83 ec 08             	sub    $0x8,%esp
+  801560:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801563:	50                   	push   %eax
+  801564:	ff 33                	push   (%ebx)
+  801566:	e8 16 fc ff ff       	call   801181 <dev_lookup>
+  80156b:	83 c4 10             	add    $0x10,%esp
+  80156e:	85 c0                	test   %eax,%eax
+  801570:	78 13                	js     801585 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801572:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801575:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801578:	85 c0                	test   %eax,%eax
+  80157a:	74 0e                	je     80158a <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  80157c:	83 ec 0c             	sub    $0xc,%esp
+  80157f:	53                   	push   %ebx
+  801580:	ff d0                	call   *%eax
+  801582:	83 c4 10             	add    $0x10,%esp
+}
+  801585:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801588:	c9                   	leave
+  801589:	c3                   	ret
+		return 0;
+  80158a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80158f:	eb f4                	jmp    801585 <fsync+0x45>
+
+00801591 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801591:	55                   	push   %ebp
+  801592:	89 e5                	mov    %esp,%ebp
+  801594:	56                   	push   %esi
+  801595:	53                   	push   %ebx
+  801596:	83 ec 18             	sub    $0x18,%esp
+  801599:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80159c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80159f:	50                   	push   %eax
+  8015a0:	53                   	push   %ebx
+  8015a1:	e8 8b fb ff ff       	call   801131 <fd_lookup>
+  8015a6:	83 c4 10             	add    $0x10,%esp
+  8015a9:	85 c0                	test   %eax,%eax
+  8015ab:	78 34                	js     8015e1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015ad:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015b0:	83 ec 08             	sub    $0x8,%esp
+  8015b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015b6:	50                   	push   %eax
+  8015b7:	ff 36                	push   (%esi)
+  8015b9:	e8 c3 fb ff ff       	call   801181 <dev_lookup>
+  8015be:	83 c4 10             	add    $0x10,%esp
+  8015c1:	85 c0                	test   %eax,%eax
+  8015c3:	78 1c                	js     8015e1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015c5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015c9:	74 1d                	je     8015e8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8015cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015ce:	8b 40 18             	mov    0x18(%eax),%eax
+  8015d1:	85 c0                	test   %eax,%eax
+  8015d3:	74 34                	je     801609 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8015d5:	83 ec 08             	sub    $0x8,%esp
+  8015d8:	ff 75 0c             	push   0xc(%ebp)
+  8015db:	56                   	push   %esi
+  8015dc:	ff d0                	call   *%eax
+  8015de:	83 c4 10             	add    $0x10,%esp
+}
+  8015e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015e4:	5b                   	pop    %ebx
+  8015e5:	5e                   	pop    %esi
+  8015e6:	5d                   	pop    %ebp
+  8015e7:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8015e8:	a1 04 60 80 00       	mov    0x806004,%eax
+  8015ed:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015f0:	83 ec 04             	sub    $0x4,%esp
+  8015f3:	53                   	push   %ebx
+  8015f4:	50                   	push   %eax
+  8015f5:	68 94 3d 80 00       	push   $0x803d94
+  8015fa:	e8 ba ec ff ff       	call   8002b9 <cprintf>
+		return -E_INVAL;
+  8015ff:	83 c4 10             	add    $0x10,%esp
+  801602:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801607:	eb d8                	jmp    8015e1 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801609:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80160e:	eb d1                	jmp    8015e1 <ftruncate+0x50>
+
+00801610 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801610:	55                   	push   %ebp
+  801611:	89 e5                	mov    %esp,%ebp
+  801613:	56                   	push   %esi
+  801614:	53                   	push   %ebx
+  801615:	83 ec 18             	sub    $0x18,%esp
+  801618:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80161b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80161e:	50                   	push   %eax
+  80161f:	ff 75 08             	push   0x8(%ebp)
+  801622:	e8 0a fb ff ff       	call   801131 <fd_lookup>
+  801627:	83 c4 10             	add    $0x10,%esp
+  80162a:	85 c0                	test   %eax,%eax
+  80162c:	78 49                	js     801677 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80162e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801631:	83 ec 08             	sub    $0x8,%esp
+  801634:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801637:	50                   	push   %eax
+  801638:	ff 36                	push   (%esi)
+  80163a:	e8 42 fb ff ff       	call   801181 <dev_lookup>
+  80163f:	83 c4 10             	add    $0x10,%esp
+  801642:	85 c0                	test   %eax,%eax
+  801644:	78 31                	js     801677 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801646:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801649:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80164d:	74 2f                	je     80167e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80164f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801652:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801659:	00 00 00 
+	stat->st_isdir = 0;
+  80165c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801663:	00 00 00 
+	stat->st_dev = dev;
+  801666:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80166c:	83 ec 08             	sub    $0x8,%esp
+  80166f:	53                   	push   %ebx
+  801670:	56                   	push   %esi
+  801671:	ff 50 14             	call   *0x14(%eax)
+  801674:	83 c4 10             	add    $0x10,%esp
+}
+  801677:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80167a:	5b                   	pop    %ebx
+  80167b:	5e                   	pop    %esi
+  80167c:	5d                   	pop    %ebp
+  80167d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80167e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801683:	eb f2                	jmp    801677 <fstat+0x67>
+
+00801685 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801685:	55                   	push   %ebp
+  801686:	89 e5                	mov    %esp,%ebp
+  801688:	56                   	push   %esi
+  801689:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  80168a:	83 ec 08             	sub    $0x8,%esp
+  80168d:	68 00 10 00 00       	push   $0x1000
+  801692:	ff 75 08             	push   0x8(%ebp)
+  801695:	e8 b3 07 00 00       	call   801e4d <open>
+  80169a:	89 c3                	mov    %eax,%ebx
+  80169c:	83 c4 10             	add    $0x10,%esp
+  80169f:	85 c0                	test   %eax,%eax
+  8016a1:	78 1b                	js     8016be <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  8016a3:	83 ec 08             	sub    $0x8,%esp
+  8016a6:	ff 75 0c             	push   0xc(%ebp)
+  8016a9:	50                   	push   %eax
+  8016aa:	e8 61 ff ff ff       	call   801610 <fstat>
+  8016af:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8016b1:	89 1c 24             	mov    %ebx,(%esp)
+  8016b4:	e8 a2 fb ff ff       	call   80125b <close>
+	return r;
+  8016b9:	83 c4 10             	add    $0x10,%esp
+  8016bc:	89 f3                	mov    %esi,%ebx
+}
+  8016be:	89 d8                	mov    %ebx,%eax
+  8016c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016c3:	5b                   	pop    %ebx
+  8016c4:	5e                   	pop    %esi
+  8016c5:	5d                   	pop    %ebp
+  8016c6:	c3                   	ret
+
+008016c7 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  8016c7:	55                   	push   %ebp
+  8016c8:	89 e5                	mov    %esp,%ebp
+  8016ca:	57                   	push   %edi
+  8016cb:	56                   	push   %esi
+  8016cc:	53                   	push   %ebx
+  8016cd:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  8016d3:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  8016d9:	89 d6                	mov    %edx,%esi
+  8016db:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  8016e1:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  8016e4:	89 d3                	mov    %edx,%ebx
+  8016e6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  8016ec:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  8016f3:	74 1d                	je     801712 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8016f5:	b8 00 70 80 00       	mov    $0x807000,%eax
+  8016fa:	83 c8 07             	or     $0x7,%eax
+  8016fd:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801703:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801708:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  80170e:	01 ce                	add    %ecx,%esi
+  801710:	eb 28                	jmp    80173a <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801712:	83 ec 0c             	sub    $0xc,%esp
+  801715:	6a 01                	push   $0x1
+  801717:	e8 20 1f 00 00       	call   80363c <ipc_find_env>
+  80171c:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801721:	83 c4 10             	add    $0x10,%esp
+  801724:	eb cf                	jmp    8016f5 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801726:	83 c0 01             	add    $0x1,%eax
+  801729:	89 fa                	mov    %edi,%edx
+  80172b:	09 da                	or     %ebx,%edx
+  80172d:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801734:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80173a:	39 f3                	cmp    %esi,%ebx
+  80173c:	72 e8                	jb     801726 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  80173e:	83 f8 41             	cmp    $0x41,%eax
+  801741:	77 2f                	ja     801772 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801743:	50                   	push   %eax
+  801744:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  80174a:	50                   	push   %eax
+  80174b:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801751:	ff 35 c8 80 80 00    	push   0x8080c8
+  801757:	e8 92 1e 00 00       	call   8035ee <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  80175c:	83 c4 0c             	add    $0xc,%esp
+  80175f:	6a 00                	push   $0x0
+  801761:	6a 00                	push   $0x0
+  801763:	6a 00                	push   $0x0
+  801765:	e8 2e 1d 00 00       	call   803498 <ipc_recv>
+}
+  80176a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80176d:	5b                   	pop    %ebx
+  80176e:	5e                   	pop    %esi
+  80176f:	5f                   	pop    %edi
+  801770:	5d                   	pop    %ebp
+  801771:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801772:	68 04 3e 80 00       	push   $0x803e04
+  801777:	68 20 3e 80 00       	push   $0x803e20
+  80177c:	6a 40                	push   $0x40
+  80177e:	68 35 3e 80 00       	push   $0x803e35
+  801783:	e8 56 ea ff ff       	call   8001de <_panic>
+
+00801788 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801788:	55                   	push   %ebp
+  801789:	89 e5                	mov    %esp,%ebp
+  80178b:	57                   	push   %edi
+  80178c:	56                   	push   %esi
+  80178d:	53                   	push   %ebx
+  80178e:	83 ec 1c             	sub    $0x1c,%esp
+  801791:	89 c3                	mov    %eax,%ebx
+  801793:	89 d6                	mov    %edx,%esi
+  801795:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801798:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  80179e:	89 ca                	mov    %ecx,%edx
+  8017a0:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  8017a3:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  8017aa:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8017ad:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  8017b4:	8b 76 0c             	mov    0xc(%esi),%esi
+  8017b7:	89 fb                	mov    %edi,%ebx
+  8017b9:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  8017c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8017c3:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  8017ca:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017cd:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  8017d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017d7:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  8017de:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  8017e1:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  8017e8:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  8017ed:	39 c8                	cmp    %ecx,%eax
+  8017ef:	74 0d                	je     8017fe <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  8017f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f9:	5b                   	pop    %ebx
+  8017fa:	5e                   	pop    %esi
+  8017fb:	5f                   	pop    %edi
+  8017fc:	5d                   	pop    %ebp
+  8017fd:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017fe:	6a 07                	push   $0x7
+  801800:	68 00 70 80 00       	push   $0x807000
+  801805:	6a 0d                	push   $0xd
+  801807:	ff 35 c8 80 80 00    	push   0x8080c8
+  80180d:	e8 f1 1c 00 00       	call   803503 <ipc_send>
+  801812:	83 c4 10             	add    $0x10,%esp
+  801815:	eb da                	jmp    8017f1 <fsring_post+0x69>
+
+00801817 <fsipcv>:
+{
+  801817:	55                   	push   %ebp
+  801818:	89 e5                	mov    %esp,%ebp
+  80181a:	57                   	push   %edi
+  80181b:	56                   	push   %esi
+  80181c:	53                   	push   %ebx
+  80181d:	83 ec 0c             	sub    $0xc,%esp
+  801820:	89 c7                	mov    %eax,%edi
+  801822:	89 d3                	mov    %edx,%ebx
+  801824:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801826:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  80182d:	74 26                	je     801855 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80182f:	6a 07                	push   $0x7
+  801831:	68 00 70 80 00       	push   $0x807000
+  801836:	57                   	push   %edi
+  801837:	ff 35 c8 80 80 00    	push   0x8080c8
+  80183d:	e8 c1 1c 00 00       	call   803503 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801842:	6a 00                	push   $0x0
+  801844:	56                   	push   %esi
+  801845:	53                   	push   %ebx
+  801846:	6a 00                	push   $0x0
+  801848:	e8 0e 1d 00 00       	call   80355b <ipc_recvv>
+}
+  80184d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801850:	5b                   	pop    %ebx
+  801851:	5e                   	pop    %esi
+  801852:	5f                   	pop    %edi
+  801853:	5d                   	pop    %ebp
+  801854:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801855:	83 ec 0c             	sub    $0xc,%esp
+  801858:	6a 01                	push   $0x1
+  80185a:	e8 dd 1d 00 00       	call   80363c <ipc_find_env>
+  80185f:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801864:	83 c4 10             	add    $0x10,%esp
+  801867:	eb c6                	jmp    80182f <fsipcv+0x18>
+
+00801869 <fsipc>:
+{
+  801869:	55                   	push   %ebp
+  80186a:	89 e5                	mov    %esp,%ebp
+  80186c:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  80186f:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801876:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801879:	e8 99 ff ff ff       	call   801817 <fsipcv>
+}
+  80187e:	c9                   	leave
+  80187f:	c3                   	ret
+
+00801880 <file_write_direct>:
+{
+  801880:	55                   	push   %ebp
+  801881:	89 e5                	mov    %esp,%ebp
+  801883:	56                   	push   %esi
+  801884:	53                   	push   %ebx
+  801885:	89 c3                	mov    %eax,%ebx
+  801887:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801889:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  80188f:	77 40                	ja     8018d1 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801891:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801896:	39 c8                	cmp    %ecx,%eax
+  801898:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80189b:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  80189e:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  8018a4:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8018a9:	83 ec 04             	sub    $0x4,%esp
+  8018ac:	50                   	push   %eax
+  8018ad:	52                   	push   %edx
+  8018ae:	68 08 70 80 00       	push   $0x807008
+  8018b3:	e8 75 f1 ff ff       	call   800a2d <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8018b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018bd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018c2:	e8 a2 ff ff ff       	call   801869 <fsipc>
+  8018c7:	83 c4 10             	add    $0x10,%esp
+}
+  8018ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018cd:	5b                   	pop    %ebx
+  8018ce:	5e                   	pop    %esi
+  8018cf:	5d                   	pop    %ebp
+  8018d0:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8018d1:	89 d6                	mov    %edx,%esi
+  8018d3:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8018d9:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8018de:	29 f1                	sub    %esi,%ecx
+  8018e0:	39 c1                	cmp    %eax,%ecx
+  8018e2:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  8018e5:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8018e8:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  8018ed:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8018f3:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  8018f9:	83 ec 0c             	sub    $0xc,%esp
+  8018fc:	6a 05                	push   $0x5
+  8018fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801903:	e8 bf fd ff ff       	call   8016c7 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801908:	83 c4 10             	add    $0x10,%esp
+  80190b:	eb bd                	jmp    8018ca <file_write_direct+0x4a>
+
+0080190d <devfile_sync>:
+{
+  80190d:	55                   	push   %ebp
+  80190e:	89 e5                	mov    %esp,%ebp
+  801910:	57                   	push   %edi
+  801911:	56                   	push   %esi
+  801912:	53                   	push   %ebx
+  801913:	83 ec 28             	sub    $0x28,%esp
+  801916:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801919:	56                   	push   %esi
+  80191a:	e8 a5 f7 ff ff       	call   8010c4 <fd2data>
+  80191f:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801921:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801924:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  80192b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80192e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801933:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801937:	74 45                	je     80197e <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801939:	8b 46 14             	mov    0x14(%esi),%eax
+  80193c:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80193f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801944:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801949:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  80194c:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  80194f:	39 cb                	cmp    %ecx,%ebx
+  801951:	73 14                	jae    801967 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801953:	29 d9                	sub    %ebx,%ecx
+  801955:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801958:	89 f0                	mov    %esi,%eax
+  80195a:	e8 21 ff ff ff       	call   801880 <file_write_direct>
+  80195f:	85 c0                	test   %eax,%eax
+  801961:	7e 04                	jle    801967 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801963:	01 c3                	add    %eax,%ebx
+  801965:	eb e5                	jmp    80194c <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801967:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80196a:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801971:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801974:	85 c0                	test   %eax,%eax
+  801976:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80197e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801981:	5b                   	pop    %ebx
+  801982:	5e                   	pop    %esi
+  801983:	5f                   	pop    %edi
+  801984:	5d                   	pop    %ebp
+  801985:	c3                   	ret
+
+00801986 <devfile_write>:
+{
+  801986:	55                   	push   %ebp
+  801987:	89 e5                	mov    %esp,%ebp
+  801989:	57                   	push   %edi
+  80198a:	56                   	push   %esi
+  80198b:	53                   	push   %ebx
+  80198c:	83 ec 28             	sub    $0x28,%esp
+  80198f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801992:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801995:	53                   	push   %ebx
+  801996:	e8 29 f7 ff ff       	call   8010c4 <fd2data>
+  80199b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  80199e:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8019a1:	83 c4 10             	add    $0x10,%esp
+  8019a4:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8019a8:	74 43                	je     8019ed <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  8019aa:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  8019b1:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8019b4:	85 c0                	test   %eax,%eax
+  8019b6:	74 43                	je     8019fb <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  8019b8:	89 c2                	mov    %eax,%edx
+  8019ba:	03 53 14             	add    0x14(%ebx),%edx
+  8019bd:	39 fa                	cmp    %edi,%edx
+  8019bf:	75 0b                	jne    8019cc <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  8019c1:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  8019c4:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  8019ca:	76 66                	jbe    801a32 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  8019cc:	83 ec 0c             	sub    $0xc,%esp
+  8019cf:	53                   	push   %ebx
+  8019d0:	e8 38 ff ff ff       	call   80190d <devfile_sync>
+  8019d5:	83 c4 10             	add    $0x10,%esp
+  8019d8:	85 c0                	test   %eax,%eax
+  8019da:	78 4e                	js     801a2a <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8019dc:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8019e2:	77 56                	ja     801a3a <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  8019e4:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8019e7:	85 c0                	test   %eax,%eax
+  8019e9:	75 20                	jne    801a0b <devfile_write+0x85>
+  8019eb:	eb 16                	jmp    801a03 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  8019ed:	89 f1                	mov    %esi,%ecx
+  8019ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019f2:	89 d8                	mov    %ebx,%eax
+  8019f4:	e8 87 fe ff ff       	call   801880 <file_write_direct>
+  8019f9:	eb 2f                	jmp    801a2a <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8019fb:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801a01:	77 37                	ja     801a3a <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801a03:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801a06:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801a0b:	83 ec 04             	sub    $0x4,%esp
+  801a0e:	56                   	push   %esi
+  801a0f:	ff 75 0c             	push   0xc(%ebp)
+  801a12:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801a15:	01 c1                	add    %eax,%ecx
+  801a17:	51                   	push   %ecx
+  801a18:	e8 10 f0 ff ff       	call   800a2d <memmove>
+	ff->buf_wlen += n;
+  801a1d:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801a20:	01 f7                	add    %esi,%edi
+  801a22:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801a25:	89 f0                	mov    %esi,%eax
+  801a27:	83 c4 10             	add    $0x10,%esp
+}
+  801a2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a2d:	5b                   	pop    %ebx
+  801a2e:	5e                   	pop    %esi
+  801a2f:	5f                   	pop    %edi
+  801a30:	5d                   	pop    %ebp
+  801a31:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801a32:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801a38:	76 d1                	jbe    801a0b <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801a3a:	89 f1                	mov    %esi,%ecx
+  801a3c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a3f:	89 d8                	mov    %ebx,%eax
+  801a41:	e8 3a fe ff ff       	call   801880 <file_write_direct>
+  801a46:	eb e2                	jmp    801a2a <devfile_write+0xa4>
+
+00801a48 <devfile_trunc>:
+{
+  801a48:	55                   	push   %ebp
+  801a49:	89 e5                	mov    %esp,%ebp
+  801a4b:	53                   	push   %ebx
+  801a4c:	83 ec 10             	sub    $0x10,%esp
+  801a4f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801a52:	53                   	push   %ebx
+  801a53:	e8 b5 fe ff ff       	call   80190d <devfile_sync>
+  801a58:	83 c4 10             	add    $0x10,%esp
+  801a5b:	85 c0                	test   %eax,%eax
+  801a5d:	78 1f                	js     801a7e <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a5f:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a62:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801a67:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a6a:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801a6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a74:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a79:	e8 eb fd ff ff       	call   801869 <fsipc>
+}
+  801a7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a81:	c9                   	leave
+  801a82:	c3                   	ret
+
+00801a83 <devfile_stat>:
+{
+  801a83:	55                   	push   %ebp
+  801a84:	89 e5                	mov    %esp,%ebp
+  801a86:	56                   	push   %esi
+  801a87:	53                   	push   %ebx
+  801a88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a8b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801a8e:	83 ec 0c             	sub    $0xc,%esp
+  801a91:	53                   	push   %ebx
+  801a92:	e8 76 fe ff ff       	call   80190d <devfile_sync>
+  801a97:	83 c4 10             	add    $0x10,%esp
+  801a9a:	85 c0                	test   %eax,%eax
+  801a9c:	78 47                	js     801ae5 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a9e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801aa1:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801aa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aab:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ab0:	e8 b4 fd ff ff       	call   801869 <fsipc>
+  801ab5:	85 c0                	test   %eax,%eax
+  801ab7:	78 2c                	js     801ae5 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ab9:	83 ec 08             	sub    $0x8,%esp
+  801abc:	68 00 70 80 00       	push   $0x807000
+  801ac1:	56                   	push   %esi
+  801ac2:	e8 e0 ed ff ff       	call   8008a7 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801ac7:	a1 80 70 80 00       	mov    0x807080,%eax
+  801acc:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ad2:	a1 84 70 80 00       	mov    0x807084,%eax
+  801ad7:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801add:	83 c4 10             	add    $0x10,%esp
+  801ae0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ae5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae8:	5b                   	pop    %ebx
+  801ae9:	5e                   	pop    %esi
+  801aea:	5d                   	pop    %ebp
+  801aeb:	c3                   	ret
+
+00801aec <devfile_flush>:
+{
+  801aec:	55                   	push   %ebp
+  801aed:	89 e5                	mov    %esp,%ebp
+  801aef:	56                   	push   %esi
+  801af0:	53                   	push   %ebx
+  801af1:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801af4:	83 ec 0c             	sub    $0xc,%esp
+  801af7:	56                   	push   %esi
+  801af8:	e8 10 fe ff ff       	call   80190d <devfile_sync>
+  801afd:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801aff:	83 c4 10             	add    $0x10,%esp
+  801b02:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801b06:	75 25                	jne    801b2d <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b08:	8b 46 0c             	mov    0xc(%esi),%eax
+  801b0b:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801b10:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b15:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b1a:	e8 4a fd ff ff       	call   801869 <fsipc>
+  801b1f:	85 c0                	test   %eax,%eax
+  801b21:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801b24:	89 d8                	mov    %ebx,%eax
+  801b26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b29:	5b                   	pop    %ebx
+  801b2a:	5e                   	pop    %esi
+  801b2b:	5d                   	pop    %ebp
+  801b2c:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801b2d:	83 ec 0c             	sub    $0xc,%esp
+  801b30:	56                   	push   %esi
+  801b31:	e8 8e f5 ff ff       	call   8010c4 <fd2data>
+  801b36:	83 c4 08             	add    $0x8,%esp
+  801b39:	50                   	push   %eax
+  801b3a:	6a 00                	push   $0x0
+  801b3c:	e8 ff f1 ff ff       	call   800d40 <sys_page_unmap>
+  801b41:	83 c4 10             	add    $0x10,%esp
+  801b44:	eb c2                	jmp    801b08 <devfile_flush+0x1c>
+
+00801b46 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801b46:	55                   	push   %ebp
+  801b47:	89 e5                	mov    %esp,%ebp
+  801b49:	57                   	push   %edi
+  801b4a:	56                   	push   %esi
+  801b4b:	53                   	push   %ebx
+  801b4c:	83 ec 64             	sub    $0x64,%esp
+  801b4f:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801b51:	52                   	push   %edx
+  801b52:	50                   	push   %eax
+  801b53:	e8 d9 f5 ff ff       	call   801131 <fd_lookup>
+  801b58:	89 c1                	mov    %eax,%ecx
+  801b5a:	83 c4 10             	add    $0x10,%esp
+  801b5d:	85 c0                	test   %eax,%eax
+  801b5f:	0f 88 f2 00 00 00    	js     801c57 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801b65:	8b 07                	mov    (%edi),%eax
+  801b67:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801b6d:	39 10                	cmp    %edx,(%eax)
+  801b6f:	0f 85 03 01 00 00    	jne    801c78 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801b75:	a1 04 60 80 00       	mov    0x806004,%eax
+  801b7a:	8b 40 48             	mov    0x48(%eax),%eax
+  801b7d:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  801b83:	0f 84 96 00 00 00    	je     801c1f <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801b89:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801b90:	0f 84 cb 00 00 00    	je     801c61 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b96:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801b9b:	83 c8 07             	or     $0x7,%eax
+  801b9e:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801ba1:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801ba4:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801ba9:	83 ec 04             	sub    $0x4,%esp
+  801bac:	68 07 04 00 00       	push   $0x407
+  801bb1:	53                   	push   %ebx
+  801bb2:	6a 00                	push   $0x0
+  801bb4:	e8 fa f0 ff ff       	call   800cb3 <sys_page_alloc>
+  801bb9:	89 c1                	mov    %eax,%ecx
+  801bbb:	83 c4 10             	add    $0x10,%esp
+  801bbe:	85 c0                	test   %eax,%eax
+  801bc0:	0f 88 91 00 00 00    	js     801c57 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801bc6:	89 d8                	mov    %ebx,%eax
+  801bc8:	83 c8 07             	or     $0x7,%eax
+  801bcb:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801bcd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801bd3:	83 c6 04             	add    $0x4,%esi
+  801bd6:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801bdc:	75 cb                	jne    801ba9 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801bde:	6a 12                	push   $0x12
+  801be0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801be3:	50                   	push   %eax
+  801be4:	6a 0c                	push   $0xc
+  801be6:	ff 35 c8 80 80 00    	push   0x8080c8
+  801bec:	e8 fd 19 00 00       	call   8035ee <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801bf1:	83 c4 0c             	add    $0xc,%esp
+  801bf4:	6a 00                	push   $0x0
+  801bf6:	6a 00                	push   $0x0
+  801bf8:	6a 00                	push   $0x0
+  801bfa:	e8 99 18 00 00       	call   803498 <ipc_recv>
+  801bff:	89 c1                	mov    %eax,%ecx
+  801c01:	83 c4 10             	add    $0x10,%esp
+  801c04:	85 c0                	test   %eax,%eax
+  801c06:	78 4f                	js     801c57 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801c08:	a1 04 60 80 00       	mov    0x806004,%eax
+  801c0d:	8b 40 48             	mov    0x48(%eax),%eax
+  801c10:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  801c15:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  801c1c:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801c1f:	83 ec 0c             	sub    $0xc,%esp
+  801c22:	ff 37                	push   (%edi)
+  801c24:	e8 e4 fc ff ff       	call   80190d <devfile_sync>
+  801c29:	89 c1                	mov    %eax,%ecx
+  801c2b:	83 c4 10             	add    $0x10,%esp
+  801c2e:	85 c0                	test   %eax,%eax
+  801c30:	78 25                	js     801c57 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801c32:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801c38:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801c3d:	ba 01 00 00 00       	mov    $0x1,%edx
+  801c42:	89 d0                	mov    %edx,%eax
+  801c44:	d3 e0                	shl    %cl,%eax
+  801c46:	85 d8                	test   %ebx,%eax
+  801c48:	74 0d                	je     801c57 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801c4a:	83 c1 01             	add    $0x1,%ecx
+  801c4d:	83 f9 10             	cmp    $0x10,%ecx
+  801c50:	75 f0                	jne    801c42 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801c52:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801c57:	89 c8                	mov    %ecx,%eax
+  801c59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c5c:	5b                   	pop    %ebx
+  801c5d:	5e                   	pop    %esi
+  801c5e:	5f                   	pop    %edi
+  801c5f:	5d                   	pop    %ebp
+  801c60:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c61:	83 ec 0c             	sub    $0xc,%esp
+  801c64:	6a 01                	push   $0x1
+  801c66:	e8 d1 19 00 00       	call   80363c <ipc_find_env>
+  801c6b:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801c70:	83 c4 10             	add    $0x10,%esp
+  801c73:	e9 1e ff ff ff       	jmp    801b96 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801c78:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801c7d:	eb d8                	jmp    801c57 <fsring_slot+0x111>
+
+00801c7f <file_read_direct>:
+{
+  801c7f:	55                   	push   %ebp
+  801c80:	89 e5                	mov    %esp,%ebp
+  801c82:	57                   	push   %edi
+  801c83:	56                   	push   %esi
+  801c84:	53                   	push   %ebx
+  801c85:	83 ec 1c             	sub    $0x1c,%esp
+  801c88:	89 c7                	mov    %eax,%edi
+  801c8a:	89 d6                	mov    %edx,%esi
+  801c8c:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801c8e:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801c94:	77 52                	ja     801ce8 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c96:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c99:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801c9e:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ca4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ca9:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cae:	e8 b6 fb ff ff       	call   801869 <fsipc>
+  801cb3:	89 c7                	mov    %eax,%edi
+  801cb5:	85 c0                	test   %eax,%eax
+  801cb7:	78 25                	js     801cde <file_read_direct+0x5f>
+	assert(r <= n);
+  801cb9:	39 c3                	cmp    %eax,%ebx
+  801cbb:	0f 82 87 00 00 00    	jb     801d48 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801cc1:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801cc6:	0f 8f 95 00 00 00    	jg     801d61 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801ccc:	83 ec 04             	sub    $0x4,%esp
+  801ccf:	50                   	push   %eax
+  801cd0:	68 00 70 80 00       	push   $0x807000
+  801cd5:	56                   	push   %esi
+  801cd6:	e8 52 ed ff ff       	call   800a2d <memmove>
+	return r;
+  801cdb:	83 c4 10             	add    $0x10,%esp
+}
+  801cde:	89 f8                	mov    %edi,%eax
+  801ce0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ce3:	5b                   	pop    %ebx
+  801ce4:	5e                   	pop    %esi
+  801ce5:	5f                   	pop    %edi
+  801ce6:	5d                   	pop    %ebp
+  801ce7:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801ce8:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801cee:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801cf3:	29 d1                	sub    %edx,%ecx
+  801cf5:	39 d9                	cmp    %ebx,%ecx
+  801cf7:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801cfa:	89 f0                	mov    %esi,%eax
+  801cfc:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801cff:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801d02:	eb 0f                	jmp    801d13 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801d04:	0f b6 10             	movzbl (%eax),%edx
+  801d07:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801d09:	05 00 10 00 00       	add    $0x1000,%eax
+  801d0e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d13:	39 c8                	cmp    %ecx,%eax
+  801d15:	72 ed                	jb     801d04 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801d17:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d1a:	8b 47 0c             	mov    0xc(%edi),%eax
+  801d1d:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801d22:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801d28:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801d2e:	83 ec 0c             	sub    $0xc,%esp
+  801d31:	6a 07                	push   $0x7
+  801d33:	89 d9                	mov    %ebx,%ecx
+  801d35:	89 f2                	mov    %esi,%edx
+  801d37:	b8 09 00 00 00       	mov    $0x9,%eax
+  801d3c:	e8 86 f9 ff ff       	call   8016c7 <fsipc_pages>
+  801d41:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801d43:	83 c4 10             	add    $0x10,%esp
+  801d46:	eb 96                	jmp    801cde <file_read_direct+0x5f>
+	assert(r <= n);
+  801d48:	68 40 3e 80 00       	push   $0x803e40
+  801d4d:	68 20 3e 80 00       	push   $0x803e20
+  801d52:	68 dc 00 00 00       	push   $0xdc
+  801d57:	68 35 3e 80 00       	push   $0x803e35
+  801d5c:	e8 7d e4 ff ff       	call   8001de <_panic>
+	assert(r <= PGSIZE);
+  801d61:	68 51 3e 80 00       	push   $0x803e51
+  801d66:	68 20 3e 80 00       	push   $0x803e20
+  801d6b:	68 dd 00 00 00       	push   $0xdd
+  801d70:	68 35 3e 80 00       	push   $0x803e35
+  801d75:	e8 64 e4 ff ff       	call   8001de <_panic>
+
+00801d7a <devfile_read>:
+{
+  801d7a:	55                   	push   %ebp
+  801d7b:	89 e5                	mov    %esp,%ebp
+  801d7d:	57                   	push   %edi
+  801d7e:	56                   	push   %esi
+  801d7f:	53                   	push   %ebx
+  801d80:	83 ec 28             	sub    $0x28,%esp
+  801d83:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d86:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801d89:	53                   	push   %ebx
+  801d8a:	e8 35 f3 ff ff       	call   8010c4 <fd2data>
+  801d8f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801d92:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801d95:	83 c4 10             	add    $0x10,%esp
+  801d98:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801d9c:	74 7d                	je     801e1b <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801d9e:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801da2:	0f 85 81 00 00 00    	jne    801e29 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801da8:	8b 43 18             	mov    0x18(%ebx),%eax
+  801dab:	85 c0                	test   %eax,%eax
+  801dad:	74 0d                	je     801dbc <devfile_read+0x42>
+  801daf:	8b 53 14             	mov    0x14(%ebx),%edx
+  801db2:	39 fa                	cmp    %edi,%edx
+  801db4:	7f 06                	jg     801dbc <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801db6:	01 c2                	add    %eax,%edx
+  801db8:	39 d7                	cmp    %edx,%edi
+  801dba:	72 28                	jb     801de4 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801dbc:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801dc3:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801dc9:	77 74                	ja     801e3f <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801dcb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801dd0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801dd3:	89 d8                	mov    %ebx,%eax
+  801dd5:	e8 a5 fe ff ff       	call   801c7f <file_read_direct>
+  801dda:	85 c0                	test   %eax,%eax
+  801ddc:	7e 35                	jle    801e13 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801dde:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801de1:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801de4:	8b 53 14             	mov    0x14(%ebx),%edx
+  801de7:	89 d0                	mov    %edx,%eax
+  801de9:	03 43 18             	add    0x18(%ebx),%eax
+  801dec:	29 f8                	sub    %edi,%eax
+  801dee:	39 f0                	cmp    %esi,%eax
+  801df0:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801df3:	83 ec 04             	sub    $0x4,%esp
+  801df6:	56                   	push   %esi
+  801df7:	89 f8                	mov    %edi,%eax
+  801df9:	29 d0                	sub    %edx,%eax
+  801dfb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801dfe:	01 c1                	add    %eax,%ecx
+  801e00:	51                   	push   %ecx
+  801e01:	ff 75 0c             	push   0xc(%ebp)
+  801e04:	e8 24 ec ff ff       	call   800a2d <memmove>
+	fd->fd_offset = pos + n;
+  801e09:	01 f7                	add    %esi,%edi
+  801e0b:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801e0e:	89 f0                	mov    %esi,%eax
+  801e10:	83 c4 10             	add    $0x10,%esp
+}
+  801e13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e16:	5b                   	pop    %ebx
+  801e17:	5e                   	pop    %esi
+  801e18:	5f                   	pop    %edi
+  801e19:	5d                   	pop    %ebp
+  801e1a:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801e1b:	89 f1                	mov    %esi,%ecx
+  801e1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e20:	89 d8                	mov    %ebx,%eax
+  801e22:	e8 58 fe ff ff       	call   801c7f <file_read_direct>
+  801e27:	eb ea                	jmp    801e13 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801e29:	83 ec 0c             	sub    $0xc,%esp
+  801e2c:	53                   	push   %ebx
+  801e2d:	e8 db fa ff ff       	call   80190d <devfile_sync>
+  801e32:	83 c4 10             	add    $0x10,%esp
+  801e35:	85 c0                	test   %eax,%eax
+  801e37:	0f 89 6b ff ff ff    	jns    801da8 <devfile_read+0x2e>
+  801e3d:	eb d4                	jmp    801e13 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801e3f:	89 f1                	mov    %esi,%ecx
+  801e41:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e44:	89 d8                	mov    %ebx,%eax
+  801e46:	e8 34 fe ff ff       	call   801c7f <file_read_direct>
+  801e4b:	eb c6                	jmp    801e13 <devfile_read+0x99>
+
+00801e4d <open>:
+{
+  801e4d:	55                   	push   %ebp
+  801e4e:	89 e5                	mov    %esp,%ebp
+  801e50:	56                   	push   %esi
+  801e51:	53                   	push   %ebx
+  801e52:	83 ec 1c             	sub    $0x1c,%esp
+  801e55:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801e58:	56                   	push   %esi
+  801e59:	e8 0e ea ff ff       	call   80086c <strlen>
+  801e5e:	83 c4 10             	add    $0x10,%esp
+  801e61:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e66:	0f 8f a0 00 00 00    	jg     801f0c <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801e6c:	83 ec 0c             	sub    $0xc,%esp
+  801e6f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e72:	50                   	push   %eax
+  801e73:	e8 63 f2 ff ff       	call   8010db <fd_alloc>
+  801e78:	89 c3                	mov    %eax,%ebx
+  801e7a:	83 c4 10             	add    $0x10,%esp
+  801e7d:	85 c0                	test   %eax,%eax
+  801e7f:	78 45                	js     801ec6 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801e81:	83 ec 08             	sub    $0x8,%esp
+  801e84:	56                   	push   %esi
+  801e85:	68 00 70 80 00       	push   $0x807000
+  801e8a:	e8 18 ea ff ff       	call   8008a7 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801e8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e92:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801e97:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e9a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e9f:	e8 c5 f9 ff ff       	call   801869 <fsipc>
+  801ea4:	89 c3                	mov    %eax,%ebx
+  801ea6:	83 c4 10             	add    $0x10,%esp
+  801ea9:	85 c0                	test   %eax,%eax
+  801eab:	78 22                	js     801ecf <open+0x82>
+	if (!(mode & O_NOBUF)
+  801ead:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801eb4:	74 2b                	je     801ee1 <open+0x94>
+	return fd2num(fd);
+  801eb6:	83 ec 0c             	sub    $0xc,%esp
+  801eb9:	ff 75 f4             	push   -0xc(%ebp)
+  801ebc:	e8 f3 f1 ff ff       	call   8010b4 <fd2num>
+  801ec1:	89 c3                	mov    %eax,%ebx
+  801ec3:	83 c4 10             	add    $0x10,%esp
+}
+  801ec6:	89 d8                	mov    %ebx,%eax
+  801ec8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ecb:	5b                   	pop    %ebx
+  801ecc:	5e                   	pop    %esi
+  801ecd:	5d                   	pop    %ebp
+  801ece:	c3                   	ret
+		fd_close(fd, 0);
+  801ecf:	83 ec 08             	sub    $0x8,%esp
+  801ed2:	6a 00                	push   $0x0
+  801ed4:	ff 75 f4             	push   -0xc(%ebp)
+  801ed7:	e8 f8 f2 ff ff       	call   8011d4 <fd_close>
+		return r;
+  801edc:	83 c4 10             	add    $0x10,%esp
+  801edf:	eb e5                	jmp    801ec6 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801ee1:	83 ec 0c             	sub    $0xc,%esp
+  801ee4:	ff 75 f4             	push   -0xc(%ebp)
+  801ee7:	e8 d8 f1 ff ff       	call   8010c4 <fd2data>
+  801eec:	83 c4 0c             	add    $0xc,%esp
+  801eef:	68 07 04 00 00       	push   $0x407
+  801ef4:	50                   	push   %eax
+  801ef5:	6a 00                	push   $0x0
+  801ef7:	e8 b7 ed ff ff       	call   800cb3 <sys_page_alloc>
+  801efc:	83 c4 10             	add    $0x10,%esp
+  801eff:	85 c0                	test   %eax,%eax
+  801f01:	75 b3                	jne    801eb6 <open+0x69>
+		fd->fd_file.buffered = 1;
+  801f03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f06:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801f0a:	eb aa                	jmp    801eb6 <open+0x69>
+		return -E_BAD_PATH;
+  801f0c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f11:	eb b3                	jmp    801ec6 <open+0x79>
+
+00801f13 <readdir>:
+{
+  801f13:	55                   	push   %ebp
+  801f14:	89 e5                	mov    %esp,%ebp
+  801f16:	53                   	push   %ebx
+  801f17:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f1a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f1d:	50                   	push   %eax
+  801f1e:	ff 75 08             	push   0x8(%ebp)
+  801f21:	e8 0b f2 ff ff       	call   801131 <fd_lookup>
+  801f26:	89 c3                	mov    %eax,%ebx
+  801f28:	83 c4 10             	add    $0x10,%esp
+  801f2b:	85 c0                	test   %eax,%eax
+  801f2d:	78 73                	js     801fa2 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801f2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f32:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  801f38:	39 08                	cmp    %ecx,(%eax)
+  801f3a:	0f 85 82 00 00 00    	jne    801fc2 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801f40:	83 ec 0c             	sub    $0xc,%esp
+  801f43:	50                   	push   %eax
+  801f44:	e8 c4 f9 ff ff       	call   80190d <devfile_sync>
+  801f49:	89 c3                	mov    %eax,%ebx
+  801f4b:	83 c4 10             	add    $0x10,%esp
+  801f4e:	85 c0                	test   %eax,%eax
+  801f50:	78 50                	js     801fa2 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801f52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f55:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f58:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  801f5d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f60:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  801f65:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f68:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801f6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f72:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f77:	e8 ed f8 ff ff       	call   801869 <fsipc>
+  801f7c:	89 c3                	mov    %eax,%ebx
+  801f7e:	85 c0                	test   %eax,%eax
+  801f80:	7e 20                	jle    801fa2 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801f82:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801f85:	72 22                	jb     801fa9 <readdir+0x96>
+  801f87:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f8c:	7f 1b                	jg     801fa9 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f8e:	83 ec 04             	sub    $0x4,%esp
+  801f91:	50                   	push   %eax
+  801f92:	68 00 70 80 00       	push   $0x807000
+  801f97:	ff 75 0c             	push   0xc(%ebp)
+  801f9a:	e8 8e ea ff ff       	call   800a2d <memmove>
+	return r;
+  801f9f:	83 c4 10             	add    $0x10,%esp
+}
+  801fa2:	89 d8                	mov    %ebx,%eax
+  801fa4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fa7:	c9                   	leave
+  801fa8:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801fa9:	68 47 3e 80 00       	push   $0x803e47
+  801fae:	68 20 3e 80 00       	push   $0x803e20
+  801fb3:	68 86 01 00 00       	push   $0x186
+  801fb8:	68 35 3e 80 00       	push   $0x803e35
+  801fbd:	e8 1c e2 ff ff       	call   8001de <_panic>
+		return -E_NOT_SUPP;
+  801fc2:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801fc7:	eb d9                	jmp    801fa2 <readdir+0x8f>
+
+00801fc9 <munmap>:
+{
+  801fc9:	55                   	push   %ebp
+  801fca:	89 e5                	mov    %esp,%ebp
+  801fcc:	56                   	push   %esi
+  801fcd:	53                   	push   %ebx
+  801fce:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fd1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801fd4:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801fda:	75 41                	jne    80201d <munmap+0x54>
+  801fdc:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801fe2:	77 39                	ja     80201d <munmap+0x54>
+  801fe4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801fe9:	29 f0                	sub    %esi,%eax
+  801feb:	39 d0                	cmp    %edx,%eax
+  801fed:	72 35                	jb     802024 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801fef:	89 f3                	mov    %esi,%ebx
+  801ff1:	01 d6                	add    %edx,%esi
+  801ff3:	39 f3                	cmp    %esi,%ebx
+  801ff5:	73 1a                	jae    802011 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801ff7:	83 ec 08             	sub    $0x8,%esp
+  801ffa:	53                   	push   %ebx
+  801ffb:	6a 00                	push   $0x0
+  801ffd:	e8 3e ed ff ff       	call   800d40 <sys_page_unmap>
+  802002:	83 c4 10             	add    $0x10,%esp
+  802005:	85 c0                	test   %eax,%eax
+  802007:	78 0d                	js     802016 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802009:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80200f:	eb e2                	jmp    801ff3 <munmap+0x2a>
+	return 0;
+  802011:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802016:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802019:	5b                   	pop    %ebx
+  80201a:	5e                   	pop    %esi
+  80201b:	5d                   	pop    %ebp
+  80201c:	c3                   	ret
+		return -E_INVAL;
+  80201d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802022:	eb f2                	jmp    802016 <munmap+0x4d>
+  802024:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802029:	eb eb                	jmp    802016 <munmap+0x4d>
+
+0080202b <mmap>:
+{
+  80202b:	55                   	push   %ebp
+  80202c:	89 e5                	mov    %esp,%ebp
+  80202e:	57                   	push   %edi
+  80202f:	56                   	push   %esi
+  802030:	53                   	push   %ebx
+  802031:	83 ec 34             	sub    $0x34,%esp
+  802034:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802037:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80203a:	50                   	push   %eax
+  80203b:	ff 75 18             	push   0x18(%ebp)
+  80203e:	e8 ee f0 ff ff       	call   801131 <fd_lookup>
+  802043:	89 c3                	mov    %eax,%ebx
+  802045:	83 c4 10             	add    $0x10,%esp
+  802048:	85 c0                	test   %eax,%eax
+  80204a:	0f 88 0e 01 00 00    	js     80215e <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802050:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802053:	a1 20 50 80 00       	mov    0x805020,%eax
+  802058:	39 02                	cmp    %eax,(%edx)
+  80205a:	0f 85 50 01 00 00    	jne    8021b0 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802060:	8b 45 10             	mov    0x10(%ebp),%eax
+  802063:	83 e0 02             	and    $0x2,%eax
+  802066:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802069:	74 0a                	je     802075 <mmap+0x4a>
+  80206b:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80206f:	0f 84 42 01 00 00    	je     8021b7 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802075:	8b 42 08             	mov    0x8(%edx),%eax
+  802078:	83 e0 03             	and    $0x3,%eax
+  80207b:	83 f8 01             	cmp    $0x1,%eax
+  80207e:	0f 84 3a 01 00 00    	je     8021be <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802084:	8b 45 08             	mov    0x8(%ebp),%eax
+  802087:	0b 45 1c             	or     0x1c(%ebp),%eax
+  80208a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80208f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802092:	0f 85 2d 01 00 00    	jne    8021c5 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802098:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80209c:	0f 88 2a 01 00 00    	js     8021cc <mmap+0x1a1>
+  8020a2:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8020a9:	0f 87 1d 01 00 00    	ja     8021cc <mmap+0x1a1>
+  8020af:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8020b4:	2b 45 08             	sub    0x8(%ebp),%eax
+  8020b7:	39 f8                	cmp    %edi,%eax
+  8020b9:	0f 82 14 01 00 00    	jb     8021d3 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8020bf:	83 ec 0c             	sub    $0xc,%esp
+  8020c2:	52                   	push   %edx
+  8020c3:	e8 45 f8 ff ff       	call   80190d <devfile_sync>
+  8020c8:	89 c3                	mov    %eax,%ebx
+  8020ca:	83 c4 10             	add    $0x10,%esp
+  8020cd:	85 c0                	test   %eax,%eax
+  8020cf:	0f 88 89 00 00 00    	js     80215e <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8020d5:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8020db:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8020e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8020e6:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8020e9:	39 fe                	cmp    %edi,%esi
+  8020eb:	73 7b                	jae    802168 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8020ed:	89 f8                	mov    %edi,%eax
+  8020ef:	29 f0                	sub    %esi,%eax
+  8020f1:	c1 e8 0c             	shr    $0xc,%eax
+  8020f4:	ba 40 00 00 00       	mov    $0x40,%edx
+  8020f9:	39 d0                	cmp    %edx,%eax
+  8020fb:	0f 47 c2             	cmova  %edx,%eax
+  8020fe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802101:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802104:	8b 52 0c             	mov    0xc(%edx),%edx
+  802107:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  80210d:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802110:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  802116:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  80211b:	89 f2                	mov    %esi,%edx
+  80211d:	03 55 08             	add    0x8(%ebp),%edx
+  802120:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802123:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802128:	e8 ea f6 ff ff       	call   801817 <fsipcv>
+  80212d:	85 c0                	test   %eax,%eax
+  80212f:	7e 12                	jle    802143 <mmap+0x118>
+  802131:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802134:	85 c0                	test   %eax,%eax
+  802136:	0f 84 9e 00 00 00    	je     8021da <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80213c:	c1 e0 0c             	shl    $0xc,%eax
+  80213f:	01 c6                	add    %eax,%esi
+  802141:	eb a6                	jmp    8020e9 <mmap+0xbe>
+			munmap(addr, done);
+  802143:	89 c3                	mov    %eax,%ebx
+  802145:	83 ec 08             	sub    $0x8,%esp
+  802148:	56                   	push   %esi
+  802149:	ff 75 08             	push   0x8(%ebp)
+  80214c:	e8 78 fe ff ff       	call   801fc9 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802151:	83 c4 10             	add    $0x10,%esp
+  802154:	85 db                	test   %ebx,%ebx
+  802156:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80215b:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80215e:	89 d8                	mov    %ebx,%eax
+  802160:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802163:	5b                   	pop    %ebx
+  802164:	5e                   	pop    %esi
+  802165:	5f                   	pop    %edi
+  802166:	5d                   	pop    %ebp
+  802167:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802168:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80216b:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80216d:	85 c0                	test   %eax,%eax
+  80216f:	74 ed                	je     80215e <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802171:	be 00 00 00 00       	mov    $0x0,%esi
+  802176:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802179:	39 fe                	cmp    %edi,%esi
+  80217b:	73 2e                	jae    8021ab <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80217d:	83 ec 0c             	sub    $0xc,%esp
+  802180:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802183:	50                   	push   %eax
+  802184:	e8 11 11 00 00       	call   80329a <cowpage>
+  802189:	83 c4 10             	add    $0x10,%esp
+  80218c:	85 c0                	test   %eax,%eax
+  80218e:	78 08                	js     802198 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802190:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802196:	eb e1                	jmp    802179 <mmap+0x14e>
+				munmap(addr, len);
+  802198:	89 c3                	mov    %eax,%ebx
+  80219a:	83 ec 08             	sub    $0x8,%esp
+  80219d:	57                   	push   %edi
+  80219e:	ff 75 08             	push   0x8(%ebp)
+  8021a1:	e8 23 fe ff ff       	call   801fc9 <munmap>
+				return r;
+  8021a6:	83 c4 10             	add    $0x10,%esp
+  8021a9:	eb b3                	jmp    80215e <mmap+0x133>
+	return 0;
+  8021ab:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8021ae:	eb ae                	jmp    80215e <mmap+0x133>
+		return -E_NOT_SUPP;
+  8021b0:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8021b5:	eb a7                	jmp    80215e <mmap+0x133>
+		return -E_NOT_SUPP;
+  8021b7:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8021bc:	eb a0                	jmp    80215e <mmap+0x133>
+		return -E_INVAL;
+  8021be:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021c3:	eb 99                	jmp    80215e <mmap+0x133>
+  8021c5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021ca:	eb 92                	jmp    80215e <mmap+0x133>
+  8021cc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021d1:	eb 8b                	jmp    80215e <mmap+0x133>
+  8021d3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021d8:	eb 84                	jmp    80215e <mmap+0x133>
+			munmap(addr, done);
+  8021da:	83 ec 08             	sub    $0x8,%esp
+  8021dd:	56                   	push   %esi
+  8021de:	ff 75 08             	push   0x8(%ebp)
+  8021e1:	e8 e3 fd ff ff       	call   801fc9 <munmap>
+  8021e6:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8021e9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021ee:	e9 6b ff ff ff       	jmp    80215e <mmap+0x133>
+
+008021f3 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8021f3:	55                   	push   %ebp
+  8021f4:	89 e5                	mov    %esp,%ebp
+  8021f6:	56                   	push   %esi
+  8021f7:	53                   	push   %ebx
+  8021f8:	83 ec 10             	sub    $0x10,%esp
+  8021fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8021fe:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802201:	8b 45 08             	mov    0x8(%ebp),%eax
+  802204:	e8 3d f9 ff ff       	call   801b46 <fsring_slot>
+  802209:	85 c0                	test   %eax,%eax
+  80220b:	78 60                	js     80226d <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80220d:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802210:	8b 56 08             	mov    0x8(%esi),%edx
+  802213:	83 e2 03             	and    $0x3,%edx
+  802216:	83 fa 01             	cmp    $0x1,%edx
+  802219:	74 59                	je     802274 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  80221b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802220:	89 c1                	mov    %eax,%ecx
+  802222:	d3 e2                	shl    %cl,%edx
+  802224:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  80222a:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80222d:	c1 e2 02             	shl    $0x2,%edx
+  802230:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  802236:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  80223d:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802240:	8b 55 18             	mov    0x18(%ebp),%edx
+  802243:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802246:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802249:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80224c:	83 ec 08             	sub    $0x8,%esp
+  80224f:	50                   	push   %eax
+  802250:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802255:	39 c3                	cmp    %eax,%ebx
+  802257:	0f 47 d8             	cmova  %eax,%ebx
+  80225a:	53                   	push   %ebx
+  80225b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80225e:	89 f2                	mov    %esi,%edx
+  802260:	b8 03 00 00 00       	mov    $0x3,%eax
+  802265:	e8 1e f5 ff ff       	call   801788 <fsring_post>
+  80226a:	83 c4 10             	add    $0x10,%esp
+}
+  80226d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802270:	5b                   	pop    %ebx
+  802271:	5e                   	pop    %esi
+  802272:	5d                   	pop    %ebp
+  802273:	c3                   	ret
+		return -E_INVAL;
+  802274:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802279:	eb f2                	jmp    80226d <fsring_read+0x7a>
+
+0080227b <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80227b:	55                   	push   %ebp
+  80227c:	89 e5                	mov    %esp,%ebp
+  80227e:	56                   	push   %esi
+  80227f:	53                   	push   %ebx
+  802280:	83 ec 10             	sub    $0x10,%esp
+  802283:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802286:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802289:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228c:	e8 b5 f8 ff ff       	call   801b46 <fsring_slot>
+  802291:	89 c3                	mov    %eax,%ebx
+  802293:	85 c0                	test   %eax,%eax
+  802295:	78 77                	js     80230e <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802297:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80229a:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80229e:	74 77                	je     802317 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8022a0:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8022a5:	39 c6                	cmp    %eax,%esi
+  8022a7:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8022aa:	83 ec 04             	sub    $0x4,%esp
+  8022ad:	56                   	push   %esi
+  8022ae:	ff 75 0c             	push   0xc(%ebp)
+  8022b1:	89 d8                	mov    %ebx,%eax
+  8022b3:	c1 e0 0c             	shl    $0xc,%eax
+  8022b6:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8022bc:	50                   	push   %eax
+  8022bd:	e8 6b e7 ff ff       	call   800a2d <memmove>
+	fsring_busy |= 1 << slot;
+  8022c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022c7:	89 d9                	mov    %ebx,%ecx
+  8022c9:	d3 e0                	shl    %cl,%eax
+  8022cb:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8022d1:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8022d4:	c1 e0 02             	shl    $0x2,%eax
+  8022d7:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  8022dd:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  8022e4:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8022e7:	8b 45 18             	mov    0x18(%ebp),%eax
+  8022ea:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8022ed:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8022f4:	83 c4 08             	add    $0x8,%esp
+  8022f7:	53                   	push   %ebx
+  8022f8:	56                   	push   %esi
+  8022f9:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8022fc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022ff:	b8 04 00 00 00       	mov    $0x4,%eax
+  802304:	e8 7f f4 ff ff       	call   801788 <fsring_post>
+  802309:	89 c3                	mov    %eax,%ebx
+  80230b:	83 c4 10             	add    $0x10,%esp
+}
+  80230e:	89 d8                	mov    %ebx,%eax
+  802310:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802313:	5b                   	pop    %ebx
+  802314:	5e                   	pop    %esi
+  802315:	5d                   	pop    %ebp
+  802316:	c3                   	ret
+		return -E_INVAL;
+  802317:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80231c:	eb f0                	jmp    80230e <fsring_write+0x93>
+
+0080231e <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80231e:	55                   	push   %ebp
+  80231f:	89 e5                	mov    %esp,%ebp
+  802321:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802324:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802327:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232a:	e8 17 f8 ff ff       	call   801b46 <fsring_slot>
+  80232f:	85 c0                	test   %eax,%eax
+  802331:	78 4c                	js     80237f <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802333:	ba 01 00 00 00       	mov    $0x1,%edx
+  802338:	89 c1                	mov    %eax,%ecx
+  80233a:	d3 e2                	shl    %cl,%edx
+  80233c:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802342:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802345:	c1 e2 02             	shl    $0x2,%edx
+  802348:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  80234e:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  802355:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802358:	8b 55 10             	mov    0x10(%ebp),%edx
+  80235b:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80235e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802361:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802364:	83 ec 08             	sub    $0x8,%esp
+  802367:	50                   	push   %eax
+  802368:	6a 00                	push   $0x0
+  80236a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80236f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802372:	b8 05 00 00 00       	mov    $0x5,%eax
+  802377:	e8 0c f4 ff ff       	call   801788 <fsring_post>
+  80237c:	83 c4 10             	add    $0x10,%esp
+}
+  80237f:	c9                   	leave
+  802380:	c3                   	ret
+
+00802381 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802381:	55                   	push   %ebp
+  802382:	89 e5                	mov    %esp,%ebp
+  802384:	57                   	push   %edi
+  802385:	56                   	push   %esi
+  802386:	53                   	push   %ebx
+  802387:	83 ec 1c             	sub    $0x1c,%esp
+  80238a:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80238e:	a1 04 60 80 00       	mov    0x806004,%eax
+  802393:	8b 40 48             	mov    0x48(%eax),%eax
+  802396:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  80239c:	74 12                	je     8023b0 <fsring_reap+0x2f>
+		return 0;
+  80239e:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8023a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023a6:	5b                   	pop    %ebx
+  8023a7:	5e                   	pop    %esi
+  8023a8:	5f                   	pop    %edi
+  8023a9:	5d                   	pop    %ebp
+  8023aa:	c3                   	ret
+		sys_yield();
+  8023ab:	e8 e4 e8 ff ff       	call   800c94 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8023b0:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8023b6:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8023bb:	39 c2                	cmp    %eax,%edx
+  8023bd:	75 18                	jne    8023d7 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8023bf:	84 db                	test   %bl,%bl
+  8023c1:	0f 84 21 01 00 00    	je     8024e8 <fsring_reap+0x167>
+  8023c7:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  8023ce:	75 db                	jne    8023ab <fsring_reap+0x2a>
+			return 0;
+  8023d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d5:	eb cc                	jmp    8023a3 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8023d7:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8023dc:	83 e0 0f             	and    $0xf,%eax
+  8023df:	83 c0 2a             	add    $0x2a,%eax
+  8023e2:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8023e9:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8023f0:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8023f5:	83 c0 01             	add    $0x1,%eax
+  8023f8:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8023fd:	83 fb 0f             	cmp    $0xf,%ebx
+  802400:	77 5b                	ja     80245d <fsring_reap+0xdc>
+  802402:	be 01 00 00 00       	mov    $0x1,%esi
+  802407:	89 d9                	mov    %ebx,%ecx
+  802409:	d3 e6                	shl    %cl,%esi
+  80240b:	89 f0                	mov    %esi,%eax
+  80240d:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  802413:	74 48                	je     80245d <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802415:	89 d8                	mov    %ebx,%eax
+  802417:	c1 e0 0c             	shl    $0xc,%eax
+  80241a:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802420:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802423:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802426:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  80242d:	83 f8 03             	cmp    $0x3,%eax
+  802430:	74 40                	je     802472 <fsring_reap+0xf1>
+  802432:	83 f8 05             	cmp    $0x5,%eax
+  802435:	74 64                	je     80249b <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802437:	f7 d6                	not    %esi
+  802439:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  80243f:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802442:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  802449:	8b 45 08             	mov    0x8(%ebp),%eax
+  80244c:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  80244e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802451:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802453:	b8 01 00 00 00       	mov    $0x1,%eax
+  802458:	e9 46 ff ff ff       	jmp    8023a3 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80245d:	53                   	push   %ebx
+  80245e:	68 5d 3e 80 00       	push   $0x803e5d
+  802463:	68 8f 02 00 00       	push   $0x28f
+  802468:	68 35 3e 80 00       	push   $0x803e35
+  80246d:	e8 6c dd ff ff       	call   8001de <_panic>
+		if (cqe.cqe_result > 0)
+  802472:	85 ff                	test   %edi,%edi
+  802474:	7e c1                	jle    802437 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802476:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802479:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80247e:	39 c7                	cmp    %eax,%edi
+  802480:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802483:	50                   	push   %eax
+  802484:	ff 75 e4             	push   -0x1c(%ebp)
+  802487:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80248a:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  802491:	e8 97 e5 ff ff       	call   800a2d <memmove>
+  802496:	83 c4 10             	add    $0x10,%esp
+  802499:	eb 9c                	jmp    802437 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80249b:	85 ff                	test   %edi,%edi
+  80249d:	75 98                	jne    802437 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80249f:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8024a2:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8024a9:	83 ec 08             	sub    $0x8,%esp
+  8024ac:	ff 75 e4             	push   -0x1c(%ebp)
+  8024af:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8024b2:	51                   	push   %ecx
+  8024b3:	e8 ef e3 ff ff       	call   8008a7 <strcpy>
+			st->st_size = ret->ret_size;
+  8024b8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024bb:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8024c1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8024c4:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8024ca:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8024d0:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8024d6:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  8024dd:	50 80 00 
+  8024e0:	83 c4 10             	add    $0x10,%esp
+  8024e3:	e9 4f ff ff ff       	jmp    802437 <fsring_reap+0xb6>
+			return 0;
+  8024e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ed:	e9 b1 fe ff ff       	jmp    8023a3 <fsring_reap+0x22>
+
+008024f2 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8024f2:	55                   	push   %ebp
+  8024f3:	89 e5                	mov    %esp,%ebp
+  8024f5:	57                   	push   %edi
+  8024f6:	56                   	push   %esi
+  8024f7:	53                   	push   %ebx
+  8024f8:	83 ec 28             	sub    $0x28,%esp
+  8024fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8024fe:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802501:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802504:	53                   	push   %ebx
+  802505:	e8 62 e3 ff ff       	call   80086c <strlen>
+  80250a:	83 c4 10             	add    $0x10,%esp
+  80250d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802512:	0f 8f 02 01 00 00    	jg     80261a <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802518:	83 ec 08             	sub    $0x8,%esp
+  80251b:	53                   	push   %ebx
+  80251c:	68 00 70 80 00       	push   $0x807000
+  802521:	e8 81 e3 ff ff       	call   8008a7 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802526:	83 c4 10             	add    $0x10,%esp
+  802529:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  80252f:	76 69                	jbe    80259a <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802531:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802534:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80253a:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80253f:	29 d1                	sub    %edx,%ecx
+  802541:	39 f9                	cmp    %edi,%ecx
+  802543:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802546:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802549:	89 f9                	mov    %edi,%ecx
+  80254b:	01 c1                	add    %eax,%ecx
+  80254d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802550:	eb 0f                	jmp    802561 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802552:	0f b6 10             	movzbl (%eax),%edx
+  802555:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802557:	05 00 10 00 00       	add    $0x1000,%eax
+  80255c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802561:	39 c8                	cmp    %ecx,%eax
+  802563:	72 ed                	jb     802552 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802565:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802568:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  80256e:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802574:	83 ec 0c             	sub    $0xc,%esp
+  802577:	6a 07                	push   $0x7
+  802579:	89 f9                	mov    %edi,%ecx
+  80257b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80257e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802583:	e8 3f f1 ff ff       	call   8016c7 <fsipc_pages>
+  802588:	89 c7                	mov    %eax,%edi
+  80258a:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  80258d:	85 f6                	test   %esi,%esi
+  80258f:	74 7f                	je     802610 <file_slurp+0x11e>
+  802591:	8d 43 01             	lea    0x1(%ebx),%eax
+  802594:	85 ff                	test   %edi,%edi
+  802596:	79 3c                	jns    8025d4 <file_slurp+0xe2>
+  802598:	eb 76                	jmp    802610 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  80259a:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8025a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8025aa:	e8 ba f2 ff ff       	call   801869 <fsipc>
+  8025af:	89 c7                	mov    %eax,%edi
+  8025b1:	85 c0                	test   %eax,%eax
+  8025b3:	7e d8                	jle    80258d <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8025b5:	83 ec 04             	sub    $0x4,%esp
+  8025b8:	50                   	push   %eax
+  8025b9:	68 08 70 80 00       	push   $0x807008
+  8025be:	ff 75 0c             	push   0xc(%ebp)
+  8025c1:	e8 67 e4 ff ff       	call   800a2d <memmove>
+  8025c6:	83 c4 10             	add    $0x10,%esp
+  8025c9:	eb c2                	jmp    80258d <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8025cb:	80 fa 2f             	cmp    $0x2f,%dl
+  8025ce:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8025d1:	83 c0 01             	add    $0x1,%eax
+  8025d4:	89 c1                	mov    %eax,%ecx
+  8025d6:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8025da:	84 d2                	test   %dl,%dl
+  8025dc:	75 ed                	jne    8025cb <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8025de:	83 ec 04             	sub    $0x4,%esp
+  8025e1:	68 80 00 00 00       	push   $0x80
+  8025e6:	53                   	push   %ebx
+  8025e7:	56                   	push   %esi
+  8025e8:	e8 30 e3 ff ff       	call   80091d <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8025ed:	a1 00 70 80 00       	mov    0x807000,%eax
+  8025f2:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8025f8:	a1 04 70 80 00       	mov    0x807004,%eax
+  8025fd:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802603:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  80260a:	50 80 00 
+  80260d:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802610:	89 f8                	mov    %edi,%eax
+  802612:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802615:	5b                   	pop    %ebx
+  802616:	5e                   	pop    %esi
+  802617:	5f                   	pop    %edi
+  802618:	5d                   	pop    %ebp
+  802619:	c3                   	ret
+		return -E_BAD_PATH;
+  80261a:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  80261f:	eb ef                	jmp    802610 <file_slurp+0x11e>
+
+00802621 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802621:	55                   	push   %ebp
+  802622:	89 e5                	mov    %esp,%ebp
+  802624:	53                   	push   %ebx
+  802625:	83 ec 10             	sub    $0x10,%esp
+  802628:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80262b:	53                   	push   %ebx
+  80262c:	e8 3b e2 ff ff       	call   80086c <strlen>
+  802631:	83 c4 10             	add    $0x10,%esp
+  802634:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802639:	7f 25                	jg     802660 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80263b:	83 ec 08             	sub    $0x8,%esp
+  80263e:	53                   	push   %ebx
+  80263f:	68 00 70 80 00       	push   $0x807000
+  802644:	e8 5e e2 ff ff       	call   8008a7 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802649:	ba 00 00 00 00       	mov    $0x0,%edx
+  80264e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802653:	e8 11 f2 ff ff       	call   801869 <fsipc>
+  802658:	83 c4 10             	add    $0x10,%esp
+}
+  80265b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80265e:	c9                   	leave
+  80265f:	c3                   	ret
+		return -E_BAD_PATH;
+  802660:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802665:	eb f4                	jmp    80265b <remove+0x3a>
+
+00802667 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802667:	55                   	push   %ebp
+  802668:	89 e5                	mov    %esp,%ebp
+  80266a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80266d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802672:	b8 08 00 00 00       	mov    $0x8,%eax
+  802677:	e8 ed f1 ff ff       	call   801869 <fsipc>
+}
+  80267c:	c9                   	leave
+  80267d:	c3                   	ret
+
+0080267e <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  80267e:	55                   	push   %ebp
+  80267f:	89 e5                	mov    %esp,%ebp
+  802681:	57                   	push   %edi
+  802682:	56                   	push   %esi
+  802683:	53                   	push   %ebx
+  802684:	83 ec 18             	sub    $0x18,%esp
+  802687:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80268a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80268d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802690:	57                   	push   %edi
+  802691:	e8 d6 e1 ff ff       	call   80086c <strlen>
+  802696:	83 c4 10             	add    $0x10,%esp
+  802699:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80269e:	7f 4c                	jg     8026ec <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  8026a0:	83 ec 08             	sub    $0x8,%esp
+  8026a3:	57                   	push   %edi
+  8026a4:	68 00 70 80 00       	push   $0x807000
+  8026a9:	e8 f9 e1 ff ff       	call   8008a7 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  8026ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b3:	b8 10 00 00 00       	mov    $0x10,%eax
+  8026b8:	e8 ac f1 ff ff       	call   801869 <fsipc>
+  8026bd:	83 c4 10             	add    $0x10,%esp
+  8026c0:	85 c0                	test   %eax,%eax
+  8026c2:	78 20                	js     8026e4 <defrag+0x66>
+		return r;
+	if (before)
+  8026c4:	85 f6                	test   %esi,%esi
+  8026c6:	74 07                	je     8026cf <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  8026c8:	a1 00 70 80 00       	mov    0x807000,%eax
+  8026cd:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  8026cf:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  8026d4:	85 db                	test   %ebx,%ebx
+  8026d6:	74 0c                	je     8026e4 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  8026d8:	a1 04 70 80 00       	mov    0x807004,%eax
+  8026dd:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8026df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026e7:	5b                   	pop    %ebx
+  8026e8:	5e                   	pop    %esi
+  8026e9:	5f                   	pop    %edi
+  8026ea:	5d                   	pop    %ebp
+  8026eb:	c3                   	ret
+		return -E_BAD_PATH;
+  8026ec:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8026f1:	eb f1                	jmp    8026e4 <defrag+0x66>
+
+008026f3 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  8026f3:	55                   	push   %ebp
+  8026f4:	89 e5                	mov    %esp,%ebp
+  8026f6:	53                   	push   %ebx
+  8026f7:	83 ec 04             	sub    $0x4,%esp
+  8026fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  8026fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802702:	b8 11 00 00 00       	mov    $0x11,%eax
+  802707:	e8 5d f1 ff ff       	call   801869 <fsipc>
+  80270c:	85 c0                	test   %eax,%eax
+  80270e:	78 34                	js     802744 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802710:	a1 00 70 80 00       	mov    0x807000,%eax
+  802715:	89 03                	mov    %eax,(%ebx)
+  802717:	a1 04 70 80 00       	mov    0x807004,%eax
+  80271c:	89 43 04             	mov    %eax,0x4(%ebx)
+  80271f:	a1 08 70 80 00       	mov    0x807008,%eax
+  802724:	89 43 08             	mov    %eax,0x8(%ebx)
+  802727:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  80272c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80272f:	a1 10 70 80 00       	mov    0x807010,%eax
+  802734:	89 43 10             	mov    %eax,0x10(%ebx)
+  802737:	a1 14 70 80 00       	mov    0x807014,%eax
+  80273c:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  80273f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802744:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802747:	c9                   	leave
+  802748:	c3                   	ret
+
+00802749 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  802749:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80274d:	7f 01                	jg     802750 <writebuf+0x7>
+  80274f:	c3                   	ret
+{
+  802750:	55                   	push   %ebp
+  802751:	89 e5                	mov    %esp,%ebp
+  802753:	53                   	push   %ebx
+  802754:	83 ec 08             	sub    $0x8,%esp
+  802757:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  802759:	ff 70 04             	push   0x4(%eax)
+  80275c:	8d 40 10             	lea    0x10(%eax),%eax
+  80275f:	50                   	push   %eax
+  802760:	ff 33                	push   (%ebx)
+  802762:	e8 fe ec ff ff       	call   801465 <write>
+		if (result > 0)
+  802767:	83 c4 10             	add    $0x10,%esp
+  80276a:	85 c0                	test   %eax,%eax
+  80276c:	7e 03                	jle    802771 <writebuf+0x28>
+			b->result += result;
+  80276e:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802771:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802774:	74 0d                	je     802783 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802776:	85 c0                	test   %eax,%eax
+  802778:	ba 00 00 00 00       	mov    $0x0,%edx
+  80277d:	0f 4f c2             	cmovg  %edx,%eax
+  802780:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802783:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802786:	c9                   	leave
+  802787:	c3                   	ret
+
+00802788 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802788:	55                   	push   %ebp
+  802789:	89 e5                	mov    %esp,%ebp
+  80278b:	53                   	push   %ebx
+  80278c:	83 ec 04             	sub    $0x4,%esp
+  80278f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802792:	8b 53 04             	mov    0x4(%ebx),%edx
+  802795:	8d 42 01             	lea    0x1(%edx),%eax
+  802798:	89 43 04             	mov    %eax,0x4(%ebx)
+  80279b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80279e:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  8027a2:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8027a7:	74 05                	je     8027ae <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  8027a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027ac:	c9                   	leave
+  8027ad:	c3                   	ret
+		writebuf(b);
+  8027ae:	89 d8                	mov    %ebx,%eax
+  8027b0:	e8 94 ff ff ff       	call   802749 <writebuf>
+		b->idx = 0;
+  8027b5:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  8027bc:	eb eb                	jmp    8027a9 <putch+0x21>
+
+008027be <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  8027be:	55                   	push   %ebp
+  8027bf:	89 e5                	mov    %esp,%ebp
+  8027c1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  8027c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ca:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  8027d0:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8027d7:	00 00 00 
+	b.result = 0;
+  8027da:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8027e1:	00 00 00 
+	b.error = 1;
+  8027e4:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8027eb:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8027ee:	ff 75 10             	push   0x10(%ebp)
+  8027f1:	ff 75 0c             	push   0xc(%ebp)
+  8027f4:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8027fa:	50                   	push   %eax
+  8027fb:	68 88 27 80 00       	push   $0x802788
+  802800:	e8 ab db ff ff       	call   8003b0 <vprintfmt>
+	if (b.idx > 0)
+  802805:	83 c4 10             	add    $0x10,%esp
+  802808:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  80280f:	7f 12                	jg     802823 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  802811:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802817:	85 c0                	test   %eax,%eax
+  802819:	75 06                	jne    802821 <vfprintf+0x63>
+  80281b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  802821:	c9                   	leave
+  802822:	c3                   	ret
+		writebuf(&b);
+  802823:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802829:	e8 1b ff ff ff       	call   802749 <writebuf>
+  80282e:	eb e1                	jmp    802811 <vfprintf+0x53>
+
+00802830 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802830:	55                   	push   %ebp
+  802831:	89 e5                	mov    %esp,%ebp
+  802833:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802836:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  802839:	50                   	push   %eax
+  80283a:	ff 75 0c             	push   0xc(%ebp)
+  80283d:	ff 75 08             	push   0x8(%ebp)
+  802840:	e8 79 ff ff ff       	call   8027be <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802845:	c9                   	leave
+  802846:	c3                   	ret
+
+00802847 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802847:	55                   	push   %ebp
+  802848:	89 e5                	mov    %esp,%ebp
+  80284a:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80284d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  802850:	50                   	push   %eax
+  802851:	ff 75 08             	push   0x8(%ebp)
+  802854:	6a 01                	push   $0x1
+  802856:	e8 63 ff ff ff       	call   8027be <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80285b:	c9                   	leave
+  80285c:	c3                   	ret
+
+0080285d <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80285d:	55                   	push   %ebp
+  80285e:	89 e5                	mov    %esp,%ebp
+  802860:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802863:	68 76 3e 80 00       	push   $0x803e76
+  802868:	ff 75 0c             	push   0xc(%ebp)
+  80286b:	e8 37 e0 ff ff       	call   8008a7 <strcpy>
+	return 0;
+}
+  802870:	b8 00 00 00 00       	mov    $0x0,%eax
+  802875:	c9                   	leave
+  802876:	c3                   	ret
+
+00802877 <devsock_close>:
+{
+  802877:	55                   	push   %ebp
+  802878:	89 e5                	mov    %esp,%ebp
+  80287a:	53                   	push   %ebx
+  80287b:	83 ec 10             	sub    $0x10,%esp
+  80287e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802881:	53                   	push   %ebx
+  802882:	e8 f4 0d 00 00       	call   80367b <pageref>
+  802887:	89 c2                	mov    %eax,%edx
+  802889:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80288c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802891:	83 fa 01             	cmp    $0x1,%edx
+  802894:	74 05                	je     80289b <devsock_close+0x24>
+}
+  802896:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802899:	c9                   	leave
+  80289a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80289b:	83 ec 0c             	sub    $0xc,%esp
+  80289e:	ff 73 0c             	push   0xc(%ebx)
+  8028a1:	e8 b7 02 00 00       	call   802b5d <nsipc_close>
+  8028a6:	83 c4 10             	add    $0x10,%esp
+  8028a9:	eb eb                	jmp    802896 <devsock_close+0x1f>
+
+008028ab <devsock_write>:
+{
+  8028ab:	55                   	push   %ebp
+  8028ac:	89 e5                	mov    %esp,%ebp
+  8028ae:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8028b1:	6a 00                	push   $0x0
+  8028b3:	ff 75 10             	push   0x10(%ebp)
+  8028b6:	ff 75 0c             	push   0xc(%ebp)
+  8028b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028bc:	ff 70 0c             	push   0xc(%eax)
+  8028bf:	e8 79 03 00 00       	call   802c3d <nsipc_send>
+}
+  8028c4:	c9                   	leave
+  8028c5:	c3                   	ret
+
+008028c6 <devsock_read>:
+{
+  8028c6:	55                   	push   %ebp
+  8028c7:	89 e5                	mov    %esp,%ebp
+  8028c9:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8028cc:	6a 00                	push   $0x0
+  8028ce:	ff 75 10             	push   0x10(%ebp)
+  8028d1:	ff 75 0c             	push   0xc(%ebp)
+  8028d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d7:	ff 70 0c             	push   0xc(%eax)
+  8028da:	e8 ef 02 00 00       	call   802bce <nsipc_recv>
+}
+  8028df:	c9                   	leave
+  8028e0:	c3                   	ret
+
+008028e1 <fd2sockid>:
+{
+  8028e1:	55                   	push   %ebp
+  8028e2:	89 e5                	mov    %esp,%ebp
+  8028e4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8028e7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8028ea:	52                   	push   %edx
+  8028eb:	50                   	push   %eax
+  8028ec:	e8 40 e8 ff ff       	call   801131 <fd_lookup>
+  8028f1:	83 c4 10             	add    $0x10,%esp
+  8028f4:	85 c0                	test   %eax,%eax
+  8028f6:	78 10                	js     802908 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8028f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028fb:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802901:	39 08                	cmp    %ecx,(%eax)
+  802903:	75 05                	jne    80290a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802905:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802908:	c9                   	leave
+  802909:	c3                   	ret
+		return -E_NOT_SUPP;
+  80290a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80290f:	eb f7                	jmp    802908 <fd2sockid+0x27>
+
+00802911 <alloc_sockfd>:
+{
+  802911:	55                   	push   %ebp
+  802912:	89 e5                	mov    %esp,%ebp
+  802914:	56                   	push   %esi
+  802915:	53                   	push   %ebx
+  802916:	83 ec 1c             	sub    $0x1c,%esp
+  802919:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80291b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80291e:	50                   	push   %eax
+  80291f:	e8 b7 e7 ff ff       	call   8010db <fd_alloc>
+  802924:	89 c3                	mov    %eax,%ebx
+  802926:	83 c4 10             	add    $0x10,%esp
+  802929:	85 c0                	test   %eax,%eax
+  80292b:	78 43                	js     802970 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80292d:	83 ec 04             	sub    $0x4,%esp
+  802930:	68 07 04 00 00       	push   $0x407
+  802935:	ff 75 f4             	push   -0xc(%ebp)
+  802938:	6a 00                	push   $0x0
+  80293a:	e8 74 e3 ff ff       	call   800cb3 <sys_page_alloc>
+  80293f:	89 c3                	mov    %eax,%ebx
+  802941:	83 c4 10             	add    $0x10,%esp
+  802944:	85 c0                	test   %eax,%eax
+  802946:	78 28                	js     802970 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802948:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80294b:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802951:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802953:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802956:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80295d:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802960:	83 ec 0c             	sub    $0xc,%esp
+  802963:	50                   	push   %eax
+  802964:	e8 4b e7 ff ff       	call   8010b4 <fd2num>
+  802969:	89 c3                	mov    %eax,%ebx
+  80296b:	83 c4 10             	add    $0x10,%esp
+  80296e:	eb 0c                	jmp    80297c <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802970:	83 ec 0c             	sub    $0xc,%esp
+  802973:	56                   	push   %esi
+  802974:	e8 e4 01 00 00       	call   802b5d <nsipc_close>
+		return r;
+  802979:	83 c4 10             	add    $0x10,%esp
+}
+  80297c:	89 d8                	mov    %ebx,%eax
+  80297e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802981:	5b                   	pop    %ebx
+  802982:	5e                   	pop    %esi
+  802983:	5d                   	pop    %ebp
+  802984:	c3                   	ret
+
+00802985 <accept>:
+{
+  802985:	55                   	push   %ebp
+  802986:	89 e5                	mov    %esp,%ebp
+  802988:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80298b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80298e:	e8 4e ff ff ff       	call   8028e1 <fd2sockid>
+  802993:	85 c0                	test   %eax,%eax
+  802995:	78 1b                	js     8029b2 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802997:	83 ec 04             	sub    $0x4,%esp
+  80299a:	ff 75 10             	push   0x10(%ebp)
+  80299d:	ff 75 0c             	push   0xc(%ebp)
+  8029a0:	50                   	push   %eax
+  8029a1:	e8 0e 01 00 00       	call   802ab4 <nsipc_accept>
+  8029a6:	83 c4 10             	add    $0x10,%esp
+  8029a9:	85 c0                	test   %eax,%eax
+  8029ab:	78 05                	js     8029b2 <accept+0x2d>
+	return alloc_sockfd(r);
+  8029ad:	e8 5f ff ff ff       	call   802911 <alloc_sockfd>
+}
+  8029b2:	c9                   	leave
+  8029b3:	c3                   	ret
+
+008029b4 <bind>:
+{
+  8029b4:	55                   	push   %ebp
+  8029b5:	89 e5                	mov    %esp,%ebp
+  8029b7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029bd:	e8 1f ff ff ff       	call   8028e1 <fd2sockid>
+  8029c2:	85 c0                	test   %eax,%eax
+  8029c4:	78 12                	js     8029d8 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8029c6:	83 ec 04             	sub    $0x4,%esp
+  8029c9:	ff 75 10             	push   0x10(%ebp)
+  8029cc:	ff 75 0c             	push   0xc(%ebp)
+  8029cf:	50                   	push   %eax
+  8029d0:	e8 31 01 00 00       	call   802b06 <nsipc_bind>
+  8029d5:	83 c4 10             	add    $0x10,%esp
+}
+  8029d8:	c9                   	leave
+  8029d9:	c3                   	ret
+
+008029da <shutdown>:
+{
+  8029da:	55                   	push   %ebp
+  8029db:	89 e5                	mov    %esp,%ebp
+  8029dd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029e3:	e8 f9 fe ff ff       	call   8028e1 <fd2sockid>
+  8029e8:	85 c0                	test   %eax,%eax
+  8029ea:	78 0f                	js     8029fb <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8029ec:	83 ec 08             	sub    $0x8,%esp
+  8029ef:	ff 75 0c             	push   0xc(%ebp)
+  8029f2:	50                   	push   %eax
+  8029f3:	e8 43 01 00 00       	call   802b3b <nsipc_shutdown>
+  8029f8:	83 c4 10             	add    $0x10,%esp
+}
+  8029fb:	c9                   	leave
+  8029fc:	c3                   	ret
+
+008029fd <connect>:
+{
+  8029fd:	55                   	push   %ebp
+  8029fe:	89 e5                	mov    %esp,%ebp
+  802a00:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a03:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a06:	e8 d6 fe ff ff       	call   8028e1 <fd2sockid>
+  802a0b:	85 c0                	test   %eax,%eax
+  802a0d:	78 12                	js     802a21 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802a0f:	83 ec 04             	sub    $0x4,%esp
+  802a12:	ff 75 10             	push   0x10(%ebp)
+  802a15:	ff 75 0c             	push   0xc(%ebp)
+  802a18:	50                   	push   %eax
+  802a19:	e8 59 01 00 00       	call   802b77 <nsipc_connect>
+  802a1e:	83 c4 10             	add    $0x10,%esp
+}
+  802a21:	c9                   	leave
+  802a22:	c3                   	ret
+
+00802a23 <listen>:
+{
+  802a23:	55                   	push   %ebp
+  802a24:	89 e5                	mov    %esp,%ebp
+  802a26:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a2c:	e8 b0 fe ff ff       	call   8028e1 <fd2sockid>
+  802a31:	85 c0                	test   %eax,%eax
+  802a33:	78 0f                	js     802a44 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802a35:	83 ec 08             	sub    $0x8,%esp
+  802a38:	ff 75 0c             	push   0xc(%ebp)
+  802a3b:	50                   	push   %eax
+  802a3c:	e8 6b 01 00 00       	call   802bac <nsipc_listen>
+  802a41:	83 c4 10             	add    $0x10,%esp
+}
+  802a44:	c9                   	leave
+  802a45:	c3                   	ret
+
+00802a46 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802a46:	55                   	push   %ebp
+  802a47:	89 e5                	mov    %esp,%ebp
+  802a49:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802a4c:	ff 75 10             	push   0x10(%ebp)
+  802a4f:	ff 75 0c             	push   0xc(%ebp)
+  802a52:	ff 75 08             	push   0x8(%ebp)
+  802a55:	e8 41 02 00 00       	call   802c9b <nsipc_socket>
+  802a5a:	83 c4 10             	add    $0x10,%esp
+  802a5d:	85 c0                	test   %eax,%eax
+  802a5f:	78 05                	js     802a66 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802a61:	e8 ab fe ff ff       	call   802911 <alloc_sockfd>
+}
+  802a66:	c9                   	leave
+  802a67:	c3                   	ret
+
+00802a68 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a68:	55                   	push   %ebp
+  802a69:	89 e5                	mov    %esp,%ebp
+  802a6b:	53                   	push   %ebx
+  802a6c:	83 ec 04             	sub    $0x4,%esp
+  802a6f:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802a71:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802a78:	74 26                	je     802aa0 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802a7a:	6a 07                	push   $0x7
+  802a7c:	68 00 90 80 00       	push   $0x809000
+  802a81:	53                   	push   %ebx
+  802a82:	ff 35 00 a0 80 00    	push   0x80a000
+  802a88:	e8 76 0a 00 00       	call   803503 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802a8d:	83 c4 0c             	add    $0xc,%esp
+  802a90:	6a 00                	push   $0x0
+  802a92:	6a 00                	push   $0x0
+  802a94:	6a 00                	push   $0x0
+  802a96:	e8 fd 09 00 00       	call   803498 <ipc_recv>
+}
+  802a9b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a9e:	c9                   	leave
+  802a9f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802aa0:	83 ec 0c             	sub    $0xc,%esp
+  802aa3:	6a 02                	push   $0x2
+  802aa5:	e8 92 0b 00 00       	call   80363c <ipc_find_env>
+  802aaa:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  802aaf:	83 c4 10             	add    $0x10,%esp
+  802ab2:	eb c6                	jmp    802a7a <nsipc+0x12>
+
+00802ab4 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802ab4:	55                   	push   %ebp
+  802ab5:	89 e5                	mov    %esp,%ebp
+  802ab7:	56                   	push   %esi
+  802ab8:	53                   	push   %ebx
+  802ab9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802abc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802abf:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802ac4:	8b 06                	mov    (%esi),%eax
+  802ac6:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802acb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ad0:	e8 93 ff ff ff       	call   802a68 <nsipc>
+  802ad5:	89 c3                	mov    %eax,%ebx
+  802ad7:	85 c0                	test   %eax,%eax
+  802ad9:	79 09                	jns    802ae4 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802adb:	89 d8                	mov    %ebx,%eax
+  802add:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ae0:	5b                   	pop    %ebx
+  802ae1:	5e                   	pop    %esi
+  802ae2:	5d                   	pop    %ebp
+  802ae3:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802ae4:	83 ec 04             	sub    $0x4,%esp
+  802ae7:	ff 35 10 90 80 00    	push   0x809010
+  802aed:	68 00 90 80 00       	push   $0x809000
+  802af2:	ff 75 0c             	push   0xc(%ebp)
+  802af5:	e8 33 df ff ff       	call   800a2d <memmove>
+		*addrlen = ret->ret_addrlen;
+  802afa:	a1 10 90 80 00       	mov    0x809010,%eax
+  802aff:	89 06                	mov    %eax,(%esi)
+  802b01:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802b04:	eb d5                	jmp    802adb <nsipc_accept+0x27>
+
+00802b06 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802b06:	55                   	push   %ebp
+  802b07:	89 e5                	mov    %esp,%ebp
+  802b09:	53                   	push   %ebx
+  802b0a:	83 ec 08             	sub    $0x8,%esp
+  802b0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802b10:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b13:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802b18:	53                   	push   %ebx
+  802b19:	ff 75 0c             	push   0xc(%ebp)
+  802b1c:	68 04 90 80 00       	push   $0x809004
+  802b21:	e8 07 df ff ff       	call   800a2d <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802b26:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802b2c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b31:	e8 32 ff ff ff       	call   802a68 <nsipc>
+}
+  802b36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b39:	c9                   	leave
+  802b3a:	c3                   	ret
+
+00802b3b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802b3b:	55                   	push   %ebp
+  802b3c:	89 e5                	mov    %esp,%ebp
+  802b3e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802b41:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b44:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802b49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b4c:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802b51:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b56:	e8 0d ff ff ff       	call   802a68 <nsipc>
+}
+  802b5b:	c9                   	leave
+  802b5c:	c3                   	ret
+
+00802b5d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802b5d:	55                   	push   %ebp
+  802b5e:	89 e5                	mov    %esp,%ebp
+  802b60:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802b63:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b66:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802b6b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b70:	e8 f3 fe ff ff       	call   802a68 <nsipc>
+}
+  802b75:	c9                   	leave
+  802b76:	c3                   	ret
+
+00802b77 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802b77:	55                   	push   %ebp
+  802b78:	89 e5                	mov    %esp,%ebp
+  802b7a:	53                   	push   %ebx
+  802b7b:	83 ec 08             	sub    $0x8,%esp
+  802b7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802b81:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b84:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802b89:	53                   	push   %ebx
+  802b8a:	ff 75 0c             	push   0xc(%ebp)
+  802b8d:	68 04 90 80 00       	push   $0x809004
+  802b92:	e8 96 de ff ff       	call   800a2d <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802b97:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802b9d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802ba2:	e8 c1 fe ff ff       	call   802a68 <nsipc>
+}
+  802ba7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802baa:	c9                   	leave
+  802bab:	c3                   	ret
+
+00802bac <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802bac:	55                   	push   %ebp
+  802bad:	89 e5                	mov    %esp,%ebp
+  802baf:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802bb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb5:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802bba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bbd:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802bc2:	b8 06 00 00 00       	mov    $0x6,%eax
+  802bc7:	e8 9c fe ff ff       	call   802a68 <nsipc>
+}
+  802bcc:	c9                   	leave
+  802bcd:	c3                   	ret
+
+00802bce <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802bce:	55                   	push   %ebp
+  802bcf:	89 e5                	mov    %esp,%ebp
+  802bd1:	56                   	push   %esi
+  802bd2:	53                   	push   %ebx
+  802bd3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802bd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd9:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802bde:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802be4:	8b 45 14             	mov    0x14(%ebp),%eax
+  802be7:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802bec:	b8 07 00 00 00       	mov    $0x7,%eax
+  802bf1:	e8 72 fe ff ff       	call   802a68 <nsipc>
+  802bf6:	89 c3                	mov    %eax,%ebx
+  802bf8:	85 c0                	test   %eax,%eax
+  802bfa:	78 22                	js     802c1e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802bfc:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802c01:	39 c6                	cmp    %eax,%esi
+  802c03:	0f 4e c6             	cmovle %esi,%eax
+  802c06:	39 c3                	cmp    %eax,%ebx
+  802c08:	7f 1d                	jg     802c27 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802c0a:	83 ec 04             	sub    $0x4,%esp
+  802c0d:	53                   	push   %ebx
+  802c0e:	68 00 90 80 00       	push   $0x809000
+  802c13:	ff 75 0c             	push   0xc(%ebp)
+  802c16:	e8 12 de ff ff       	call   800a2d <memmove>
+  802c1b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802c1e:	89 d8                	mov    %ebx,%eax
+  802c20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c23:	5b                   	pop    %ebx
+  802c24:	5e                   	pop    %esi
+  802c25:	5d                   	pop    %ebp
+  802c26:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802c27:	68 82 3e 80 00       	push   $0x803e82
+  802c2c:	68 20 3e 80 00       	push   $0x803e20
+  802c31:	6a 62                	push   $0x62
+  802c33:	68 97 3e 80 00       	push   $0x803e97
+  802c38:	e8 a1 d5 ff ff       	call   8001de <_panic>
+
+00802c3d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802c3d:	55                   	push   %ebp
+  802c3e:	89 e5                	mov    %esp,%ebp
+  802c40:	53                   	push   %ebx
+  802c41:	83 ec 04             	sub    $0x4,%esp
+  802c44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802c47:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c4a:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802c4f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802c55:	7f 2e                	jg     802c85 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802c57:	83 ec 04             	sub    $0x4,%esp
+  802c5a:	53                   	push   %ebx
+  802c5b:	ff 75 0c             	push   0xc(%ebp)
+  802c5e:	68 0c 90 80 00       	push   $0x80900c
+  802c63:	e8 c5 dd ff ff       	call   800a2d <memmove>
+	nsipcbuf.send.req_size = size;
+  802c68:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802c6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c71:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802c76:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c7b:	e8 e8 fd ff ff       	call   802a68 <nsipc>
+}
+  802c80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c83:	c9                   	leave
+  802c84:	c3                   	ret
+	assert(size < 1600);
+  802c85:	68 a3 3e 80 00       	push   $0x803ea3
+  802c8a:	68 20 3e 80 00       	push   $0x803e20
+  802c8f:	6a 6d                	push   $0x6d
+  802c91:	68 97 3e 80 00       	push   $0x803e97
+  802c96:	e8 43 d5 ff ff       	call   8001de <_panic>
+
+00802c9b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802c9b:	55                   	push   %ebp
+  802c9c:	89 e5                	mov    %esp,%ebp
+  802c9e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802ca1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca4:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802ca9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cac:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802cb1:	8b 45 10             	mov    0x10(%ebp),%eax
+  802cb4:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802cb9:	b8 09 00 00 00       	mov    $0x9,%eax
+  802cbe:	e8 a5 fd ff ff       	call   802a68 <nsipc>
+}
+  802cc3:	c9                   	leave
+  802cc4:	c3                   	ret
+
+00802cc5 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802cc5:	55                   	push   %ebp
+  802cc6:	89 e5                	mov    %esp,%ebp
+  802cc8:	56                   	push   %esi
+  802cc9:	53                   	push   %ebx
+  802cca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802ccd:	83 ec 0c             	sub    $0xc,%esp
+  802cd0:	ff 75 08             	push   0x8(%ebp)
+  802cd3:	e8 ec e3 ff ff       	call   8010c4 <fd2data>
+  802cd8:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802cda:	83 c4 08             	add    $0x8,%esp
+  802cdd:	68 af 3e 80 00       	push   $0x803eaf
+  802ce2:	53                   	push   %ebx
+  802ce3:	e8 bf db ff ff       	call   8008a7 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802ce8:	8b 46 04             	mov    0x4(%esi),%eax
+  802ceb:	2b 06                	sub    (%esi),%eax
+  802ced:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802cf3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802cfa:	00 00 00 
+	stat->st_dev = &devpipe;
+  802cfd:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  802d04:	50 80 00 
+	return 0;
+}
+  802d07:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d0f:	5b                   	pop    %ebx
+  802d10:	5e                   	pop    %esi
+  802d11:	5d                   	pop    %ebp
+  802d12:	c3                   	ret
+
+00802d13 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802d13:	55                   	push   %ebp
+  802d14:	89 e5                	mov    %esp,%ebp
+  802d16:	53                   	push   %ebx
+  802d17:	83 ec 0c             	sub    $0xc,%esp
+  802d1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802d1d:	53                   	push   %ebx
+  802d1e:	6a 00                	push   $0x0
+  802d20:	e8 1b e0 ff ff       	call   800d40 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802d25:	89 1c 24             	mov    %ebx,(%esp)
+  802d28:	e8 97 e3 ff ff       	call   8010c4 <fd2data>
+  802d2d:	83 c4 08             	add    $0x8,%esp
+  802d30:	50                   	push   %eax
+  802d31:	6a 00                	push   $0x0
+  802d33:	e8 08 e0 ff ff       	call   800d40 <sys_page_unmap>
+}
+  802d38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d3b:	c9                   	leave
+  802d3c:	c3                   	ret
+
+00802d3d <_pipeisclosed>:
+{
+  802d3d:	55                   	push   %ebp
+  802d3e:	89 e5                	mov    %esp,%ebp
+  802d40:	57                   	push   %edi
+  802d41:	56                   	push   %esi
+  802d42:	53                   	push   %ebx
+  802d43:	83 ec 1c             	sub    $0x1c,%esp
+  802d46:	89 c7                	mov    %eax,%edi
+  802d48:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802d4a:	a1 04 60 80 00       	mov    0x806004,%eax
+  802d4f:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802d52:	83 ec 0c             	sub    $0xc,%esp
+  802d55:	57                   	push   %edi
+  802d56:	e8 20 09 00 00       	call   80367b <pageref>
+  802d5b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d5e:	89 34 24             	mov    %esi,(%esp)
+  802d61:	e8 15 09 00 00       	call   80367b <pageref>
+		nn = thisenv->env_runs;
+  802d66:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  802d6c:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802d6f:	83 c4 10             	add    $0x10,%esp
+  802d72:	39 cb                	cmp    %ecx,%ebx
+  802d74:	74 1b                	je     802d91 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802d76:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d79:	75 cf                	jne    802d4a <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802d7b:	8b 42 58             	mov    0x58(%edx),%eax
+  802d7e:	6a 01                	push   $0x1
+  802d80:	50                   	push   %eax
+  802d81:	53                   	push   %ebx
+  802d82:	68 b6 3e 80 00       	push   $0x803eb6
+  802d87:	e8 2d d5 ff ff       	call   8002b9 <cprintf>
+  802d8c:	83 c4 10             	add    $0x10,%esp
+  802d8f:	eb b9                	jmp    802d4a <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802d91:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d94:	0f 94 c0             	sete   %al
+  802d97:	0f b6 c0             	movzbl %al,%eax
+}
+  802d9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d9d:	5b                   	pop    %ebx
+  802d9e:	5e                   	pop    %esi
+  802d9f:	5f                   	pop    %edi
+  802da0:	5d                   	pop    %ebp
+  802da1:	c3                   	ret
+
+00802da2 <devpipe_write>:
+{
+  802da2:	55                   	push   %ebp
+  802da3:	89 e5                	mov    %esp,%ebp
+  802da5:	57                   	push   %edi
+  802da6:	56                   	push   %esi
+  802da7:	53                   	push   %ebx
+  802da8:	83 ec 28             	sub    $0x28,%esp
+  802dab:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802dae:	56                   	push   %esi
+  802daf:	e8 10 e3 ff ff       	call   8010c4 <fd2data>
+  802db4:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802db6:	83 c4 10             	add    $0x10,%esp
+  802db9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dbe:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802dc1:	75 09                	jne    802dcc <devpipe_write+0x2a>
+	return i;
+  802dc3:	89 f8                	mov    %edi,%eax
+  802dc5:	eb 23                	jmp    802dea <devpipe_write+0x48>
+			sys_yield();
+  802dc7:	e8 c8 de ff ff       	call   800c94 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802dcc:	8b 43 04             	mov    0x4(%ebx),%eax
+  802dcf:	8b 0b                	mov    (%ebx),%ecx
+  802dd1:	8d 51 20             	lea    0x20(%ecx),%edx
+  802dd4:	39 d0                	cmp    %edx,%eax
+  802dd6:	72 1a                	jb     802df2 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802dd8:	89 da                	mov    %ebx,%edx
+  802dda:	89 f0                	mov    %esi,%eax
+  802ddc:	e8 5c ff ff ff       	call   802d3d <_pipeisclosed>
+  802de1:	85 c0                	test   %eax,%eax
+  802de3:	74 e2                	je     802dc7 <devpipe_write+0x25>
+				return 0;
+  802de5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802dea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ded:	5b                   	pop    %ebx
+  802dee:	5e                   	pop    %esi
+  802def:	5f                   	pop    %edi
+  802df0:	5d                   	pop    %ebp
+  802df1:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802df2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802df5:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802df9:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802dfc:	89 c2                	mov    %eax,%edx
+  802dfe:	c1 fa 1f             	sar    $0x1f,%edx
+  802e01:	89 d1                	mov    %edx,%ecx
+  802e03:	c1 e9 1b             	shr    $0x1b,%ecx
+  802e06:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802e09:	83 e2 1f             	and    $0x1f,%edx
+  802e0c:	29 ca                	sub    %ecx,%edx
+  802e0e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802e12:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802e16:	83 c0 01             	add    $0x1,%eax
+  802e19:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802e1c:	83 c7 01             	add    $0x1,%edi
+  802e1f:	eb 9d                	jmp    802dbe <devpipe_write+0x1c>
+
+00802e21 <devpipe_read>:
+{
+  802e21:	55                   	push   %ebp
+  802e22:	89 e5                	mov    %esp,%ebp
+  802e24:	57                   	push   %edi
+  802e25:	56                   	push   %esi
+  802e26:	53                   	push   %ebx
+  802e27:	83 ec 18             	sub    $0x18,%esp
+  802e2a:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802e2d:	57                   	push   %edi
+  802e2e:	e8 91 e2 ff ff       	call   8010c4 <fd2data>
+  802e33:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802e35:	83 c4 10             	add    $0x10,%esp
+  802e38:	be 00 00 00 00       	mov    $0x0,%esi
+  802e3d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802e40:	75 13                	jne    802e55 <devpipe_read+0x34>
+	return i;
+  802e42:	89 f0                	mov    %esi,%eax
+  802e44:	eb 02                	jmp    802e48 <devpipe_read+0x27>
+				return i;
+  802e46:	89 f0                	mov    %esi,%eax
+}
+  802e48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e4b:	5b                   	pop    %ebx
+  802e4c:	5e                   	pop    %esi
+  802e4d:	5f                   	pop    %edi
+  802e4e:	5d                   	pop    %ebp
+  802e4f:	c3                   	ret
+			sys_yield();
+  802e50:	e8 3f de ff ff       	call   800c94 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802e55:	8b 03                	mov    (%ebx),%eax
+  802e57:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802e5a:	75 18                	jne    802e74 <devpipe_read+0x53>
+			if (i > 0)
+  802e5c:	85 f6                	test   %esi,%esi
+  802e5e:	75 e6                	jne    802e46 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802e60:	89 da                	mov    %ebx,%edx
+  802e62:	89 f8                	mov    %edi,%eax
+  802e64:	e8 d4 fe ff ff       	call   802d3d <_pipeisclosed>
+  802e69:	85 c0                	test   %eax,%eax
+  802e6b:	74 e3                	je     802e50 <devpipe_read+0x2f>
+				return 0;
+  802e6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e72:	eb d4                	jmp    802e48 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802e74:	99                   	cltd
+  802e75:	c1 ea 1b             	shr    $0x1b,%edx
+  802e78:	01 d0                	add    %edx,%eax
+  802e7a:	83 e0 1f             	and    $0x1f,%eax
+  802e7d:	29 d0                	sub    %edx,%eax
+  802e7f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802e84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e87:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802e8a:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802e8d:	83 c6 01             	add    $0x1,%esi
+  802e90:	eb ab                	jmp    802e3d <devpipe_read+0x1c>
+
+00802e92 <pipe>:
+{
+  802e92:	55                   	push   %ebp
+  802e93:	89 e5                	mov    %esp,%ebp
+  802e95:	56                   	push   %esi
+  802e96:	53                   	push   %ebx
+  802e97:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802e9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e9d:	50                   	push   %eax
+  802e9e:	e8 38 e2 ff ff       	call   8010db <fd_alloc>
+  802ea3:	89 c3                	mov    %eax,%ebx
+  802ea5:	83 c4 10             	add    $0x10,%esp
+  802ea8:	85 c0                	test   %eax,%eax
+  802eaa:	0f 88 23 01 00 00    	js     802fd3 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802eb0:	83 ec 04             	sub    $0x4,%esp
+  802eb3:	68 07 04 00 00       	push   $0x407
+  802eb8:	ff 75 f4             	push   -0xc(%ebp)
+  802ebb:	6a 00                	push   $0x0
+  802ebd:	e8 f1 dd ff ff       	call   800cb3 <sys_page_alloc>
+  802ec2:	89 c3                	mov    %eax,%ebx
+  802ec4:	83 c4 10             	add    $0x10,%esp
+  802ec7:	85 c0                	test   %eax,%eax
+  802ec9:	0f 88 04 01 00 00    	js     802fd3 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802ecf:	83 ec 0c             	sub    $0xc,%esp
+  802ed2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802ed5:	50                   	push   %eax
+  802ed6:	e8 00 e2 ff ff       	call   8010db <fd_alloc>
+  802edb:	89 c3                	mov    %eax,%ebx
+  802edd:	83 c4 10             	add    $0x10,%esp
+  802ee0:	85 c0                	test   %eax,%eax
+  802ee2:	0f 88 db 00 00 00    	js     802fc3 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ee8:	83 ec 04             	sub    $0x4,%esp
+  802eeb:	68 07 04 00 00       	push   $0x407
+  802ef0:	ff 75 f0             	push   -0x10(%ebp)
+  802ef3:	6a 00                	push   $0x0
+  802ef5:	e8 b9 dd ff ff       	call   800cb3 <sys_page_alloc>
+  802efa:	89 c3                	mov    %eax,%ebx
+  802efc:	83 c4 10             	add    $0x10,%esp
+  802eff:	85 c0                	test   %eax,%eax
+  802f01:	0f 88 bc 00 00 00    	js     802fc3 <pipe+0x131>
+	va = fd2data(fd0);
+  802f07:	83 ec 0c             	sub    $0xc,%esp
+  802f0a:	ff 75 f4             	push   -0xc(%ebp)
+  802f0d:	e8 b2 e1 ff ff       	call   8010c4 <fd2data>
+  802f12:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f14:	83 c4 0c             	add    $0xc,%esp
+  802f17:	68 07 04 00 00       	push   $0x407
+  802f1c:	50                   	push   %eax
+  802f1d:	6a 00                	push   $0x0
+  802f1f:	e8 8f dd ff ff       	call   800cb3 <sys_page_alloc>
+  802f24:	89 c3                	mov    %eax,%ebx
+  802f26:	83 c4 10             	add    $0x10,%esp
+  802f29:	85 c0                	test   %eax,%eax
+  802f2b:	0f 88 82 00 00 00    	js     802fb3 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f31:	83 ec 0c             	sub    $0xc,%esp
+  802f34:	ff 75 f0             	push   -0x10(%ebp)
+  802f37:	e8 88 e1 ff ff       	call   8010c4 <fd2data>
+  802f3c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802f43:	50                   	push   %eax
+  802f44:	6a 00                	push   $0x0
+  802f46:	56                   	push   %esi
+  802f47:	6a 00                	push   $0x0
+  802f49:	e8 b0 dd ff ff       	call   800cfe <sys_page_map>
+  802f4e:	89 c3                	mov    %eax,%ebx
+  802f50:	83 c4 20             	add    $0x20,%esp
+  802f53:	85 c0                	test   %eax,%eax
+  802f55:	78 4e                	js     802fa5 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802f57:	a1 60 50 80 00       	mov    0x805060,%eax
+  802f5c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f5f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802f61:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f64:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802f6b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802f6e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802f70:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802f73:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802f7a:	83 ec 0c             	sub    $0xc,%esp
+  802f7d:	ff 75 f4             	push   -0xc(%ebp)
+  802f80:	e8 2f e1 ff ff       	call   8010b4 <fd2num>
+  802f85:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f88:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802f8a:	83 c4 04             	add    $0x4,%esp
+  802f8d:	ff 75 f0             	push   -0x10(%ebp)
+  802f90:	e8 1f e1 ff ff       	call   8010b4 <fd2num>
+  802f95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f98:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802f9b:	83 c4 10             	add    $0x10,%esp
+  802f9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fa3:	eb 2e                	jmp    802fd3 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802fa5:	83 ec 08             	sub    $0x8,%esp
+  802fa8:	56                   	push   %esi
+  802fa9:	6a 00                	push   $0x0
+  802fab:	e8 90 dd ff ff       	call   800d40 <sys_page_unmap>
+  802fb0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802fb3:	83 ec 08             	sub    $0x8,%esp
+  802fb6:	ff 75 f0             	push   -0x10(%ebp)
+  802fb9:	6a 00                	push   $0x0
+  802fbb:	e8 80 dd ff ff       	call   800d40 <sys_page_unmap>
+  802fc0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802fc3:	83 ec 08             	sub    $0x8,%esp
+  802fc6:	ff 75 f4             	push   -0xc(%ebp)
+  802fc9:	6a 00                	push   $0x0
+  802fcb:	e8 70 dd ff ff       	call   800d40 <sys_page_unmap>
+  802fd0:	83 c4 10             	add    $0x10,%esp
+}
+  802fd3:	89 d8                	mov    %ebx,%eax
+  802fd5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fd8:	5b                   	pop    %ebx
+  802fd9:	5e                   	pop    %esi
+  802fda:	5d                   	pop    %ebp
+  802fdb:	c3                   	ret
+
+00802fdc <pipeisclosed>:
+{
+  802fdc:	55                   	push   %ebp
+  802fdd:	89 e5                	mov    %esp,%ebp
+  802fdf:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802fe2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fe5:	50                   	push   %eax
+  802fe6:	ff 75 08             	push   0x8(%ebp)
+  802fe9:	e8 43 e1 ff ff       	call   801131 <fd_lookup>
+  802fee:	83 c4 10             	add    $0x10,%esp
+  802ff1:	85 c0                	test   %eax,%eax
+  802ff3:	78 18                	js     80300d <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802ff5:	83 ec 0c             	sub    $0xc,%esp
+  802ff8:	ff 75 f4             	push   -0xc(%ebp)
+  802ffb:	e8 c4 e0 ff ff       	call   8010c4 <fd2data>
+  803000:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803002:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803005:	e8 33 fd ff ff       	call   802d3d <_pipeisclosed>
+  80300a:	83 c4 10             	add    $0x10,%esp
+}
+  80300d:	c9                   	leave
+  80300e:	c3                   	ret
+
+0080300f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80300f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803014:	c3                   	ret
+
+00803015 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803015:	55                   	push   %ebp
+  803016:	89 e5                	mov    %esp,%ebp
+  803018:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80301b:	68 ce 3e 80 00       	push   $0x803ece
+  803020:	ff 75 0c             	push   0xc(%ebp)
+  803023:	e8 7f d8 ff ff       	call   8008a7 <strcpy>
+	return 0;
+}
+  803028:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302d:	c9                   	leave
+  80302e:	c3                   	ret
+
+0080302f <devcons_write>:
+{
+  80302f:	55                   	push   %ebp
+  803030:	89 e5                	mov    %esp,%ebp
+  803032:	57                   	push   %edi
+  803033:	56                   	push   %esi
+  803034:	53                   	push   %ebx
+  803035:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80303b:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803040:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803046:	eb 2e                	jmp    803076 <devcons_write+0x47>
+		m = n - tot;
+  803048:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80304b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80304d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803052:	39 c3                	cmp    %eax,%ebx
+  803054:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803057:	83 ec 04             	sub    $0x4,%esp
+  80305a:	53                   	push   %ebx
+  80305b:	89 f0                	mov    %esi,%eax
+  80305d:	03 45 0c             	add    0xc(%ebp),%eax
+  803060:	50                   	push   %eax
+  803061:	57                   	push   %edi
+  803062:	e8 c6 d9 ff ff       	call   800a2d <memmove>
+		sys_cputs(buf, m);
+  803067:	83 c4 08             	add    $0x8,%esp
+  80306a:	53                   	push   %ebx
+  80306b:	57                   	push   %edi
+  80306c:	e8 66 db ff ff       	call   800bd7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803071:	01 de                	add    %ebx,%esi
+  803073:	83 c4 10             	add    $0x10,%esp
+  803076:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803079:	72 cd                	jb     803048 <devcons_write+0x19>
+}
+  80307b:	89 f0                	mov    %esi,%eax
+  80307d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803080:	5b                   	pop    %ebx
+  803081:	5e                   	pop    %esi
+  803082:	5f                   	pop    %edi
+  803083:	5d                   	pop    %ebp
+  803084:	c3                   	ret
+
+00803085 <devcons_read>:
+{
+  803085:	55                   	push   %ebp
+  803086:	89 e5                	mov    %esp,%ebp
+  803088:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80308b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803090:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803094:	75 07                	jne    80309d <devcons_read+0x18>
+  803096:	eb 1f                	jmp    8030b7 <devcons_read+0x32>
+		sys_yield();
+  803098:	e8 f7 db ff ff       	call   800c94 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80309d:	e8 5b db ff ff       	call   800bfd <sys_cgetc>
+  8030a2:	85 c0                	test   %eax,%eax
+  8030a4:	74 f2                	je     803098 <devcons_read+0x13>
+	if (c < 0)
+  8030a6:	78 0f                	js     8030b7 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8030a8:	83 f8 04             	cmp    $0x4,%eax
+  8030ab:	74 0c                	je     8030b9 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8030ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8030b0:	88 02                	mov    %al,(%edx)
+	return 1;
+  8030b2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8030b7:	c9                   	leave
+  8030b8:	c3                   	ret
+		return 0;
+  8030b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030be:	eb f7                	jmp    8030b7 <devcons_read+0x32>
+
+008030c0 <cputchar>:
+{
+  8030c0:	55                   	push   %ebp
+  8030c1:	89 e5                	mov    %esp,%ebp
+  8030c3:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8030c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030c9:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8030cc:	6a 01                	push   $0x1
+  8030ce:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8030d1:	50                   	push   %eax
+  8030d2:	e8 00 db ff ff       	call   800bd7 <sys_cputs>
+}
+  8030d7:	83 c4 10             	add    $0x10,%esp
+  8030da:	c9                   	leave
+  8030db:	c3                   	ret
+
+008030dc <getchar>:
+{
+  8030dc:	55                   	push   %ebp
+  8030dd:	89 e5                	mov    %esp,%ebp
+  8030df:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8030e2:	6a 01                	push   $0x1
+  8030e4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8030e7:	50                   	push   %eax
+  8030e8:	6a 00                	push   $0x0
+  8030ea:	e8 a8 e2 ff ff       	call   801397 <read>
+	if (r < 0)
+  8030ef:	83 c4 10             	add    $0x10,%esp
+  8030f2:	85 c0                	test   %eax,%eax
+  8030f4:	78 06                	js     8030fc <getchar+0x20>
+	if (r < 1)
+  8030f6:	74 06                	je     8030fe <getchar+0x22>
+	return c;
+  8030f8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8030fc:	c9                   	leave
+  8030fd:	c3                   	ret
+		return -E_EOF;
+  8030fe:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803103:	eb f7                	jmp    8030fc <getchar+0x20>
+
+00803105 <iscons>:
+{
+  803105:	55                   	push   %ebp
+  803106:	89 e5                	mov    %esp,%ebp
+  803108:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80310b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80310e:	50                   	push   %eax
+  80310f:	ff 75 08             	push   0x8(%ebp)
+  803112:	e8 1a e0 ff ff       	call   801131 <fd_lookup>
+  803117:	83 c4 10             	add    $0x10,%esp
+  80311a:	85 c0                	test   %eax,%eax
+  80311c:	78 11                	js     80312f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80311e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803121:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803127:	39 10                	cmp    %edx,(%eax)
+  803129:	0f 94 c0             	sete   %al
+  80312c:	0f b6 c0             	movzbl %al,%eax
+}
+  80312f:	c9                   	leave
+  803130:	c3                   	ret
+
+00803131 <opencons>:
+{
+  803131:	55                   	push   %ebp
+  803132:	89 e5                	mov    %esp,%ebp
+  803134:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803137:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80313a:	50                   	push   %eax
+  80313b:	e8 9b df ff ff       	call   8010db <fd_alloc>
+  803140:	83 c4 10             	add    $0x10,%esp
+  803143:	85 c0                	test   %eax,%eax
+  803145:	78 3a                	js     803181 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803147:	83 ec 04             	sub    $0x4,%esp
+  80314a:	68 07 04 00 00       	push   $0x407
+  80314f:	ff 75 f4             	push   -0xc(%ebp)
+  803152:	6a 00                	push   $0x0
+  803154:	e8 5a db ff ff       	call   800cb3 <sys_page_alloc>
+  803159:	83 c4 10             	add    $0x10,%esp
+  80315c:	85 c0                	test   %eax,%eax
+  80315e:	78 21                	js     803181 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803160:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803163:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803169:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80316b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80316e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803175:	83 ec 0c             	sub    $0xc,%esp
+  803178:	50                   	push   %eax
+  803179:	e8 36 df ff ff       	call   8010b4 <fd2num>
+  80317e:	83 c4 10             	add    $0x10,%esp
+}
+  803181:	c9                   	leave
+  803182:	c3                   	ret
+
+00803183 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  803183:	55                   	push   %ebp
+  803184:	89 e5                	mov    %esp,%ebp
+  803186:	57                   	push   %edi
+  803187:	56                   	push   %esi
+  803188:	53                   	push   %ebx
+  803189:	83 ec 20             	sub    $0x20,%esp
+  80318c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80318f:	89 d7                	mov    %edx,%edi
+  803191:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  803193:	51                   	push   %ecx
+  803194:	68 00 f0 7f 00       	push   $0x7ff000
+  803199:	6a 00                	push   $0x0
+  80319b:	e8 13 db ff ff       	call   800cb3 <sys_page_alloc>
+  8031a0:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8031a2:	83 c4 10             	add    $0x10,%esp
+  8031a5:	85 c0                	test   %eax,%eax
+  8031a7:	78 45                	js     8031ee <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  8031a9:	83 ec 04             	sub    $0x4,%esp
+  8031ac:	68 00 10 00 00       	push   $0x1000
+  8031b1:	57                   	push   %edi
+  8031b2:	68 00 f0 7f 00       	push   $0x7ff000
+  8031b7:	e8 71 d8 ff ff       	call   800a2d <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8031bc:	89 34 24             	mov    %esi,(%esp)
+  8031bf:	57                   	push   %edi
+  8031c0:	ff 75 e4             	push   -0x1c(%ebp)
+  8031c3:	68 00 f0 7f 00       	push   $0x7ff000
+  8031c8:	6a 00                	push   $0x0
+  8031ca:	e8 2f db ff ff       	call   800cfe <sys_page_map>
+  8031cf:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8031d1:	83 c4 20             	add    $0x20,%esp
+  8031d4:	85 c0                	test   %eax,%eax
+  8031d6:	78 16                	js     8031ee <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8031d8:	83 ec 08             	sub    $0x8,%esp
+  8031db:	68 00 f0 7f 00       	push   $0x7ff000
+  8031e0:	6a 00                	push   $0x0
+  8031e2:	e8 59 db ff ff       	call   800d40 <sys_page_unmap>
+  8031e7:	83 c4 10             	add    $0x10,%esp
+  8031ea:	85 c0                	test   %eax,%eax
+  8031ec:	75 0a                	jne    8031f8 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8031ee:	89 d8                	mov    %ebx,%eax
+  8031f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031f3:	5b                   	pop    %ebx
+  8031f4:	5e                   	pop    %esi
+  8031f5:	5f                   	pop    %edi
+  8031f6:	5d                   	pop    %ebp
+  8031f7:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8031f8:	68 dc 3e 80 00       	push   $0x803edc
+  8031fd:	68 20 3e 80 00       	push   $0x803e20
+  803202:	6a 1b                	push   $0x1b
+  803204:	68 54 3f 80 00       	push   $0x803f54
+  803209:	e8 d0 cf ff ff       	call   8001de <_panic>
+
+0080320e <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80320e:	55                   	push   %ebp
+  80320f:	89 e5                	mov    %esp,%ebp
+  803211:	53                   	push   %ebx
+  803212:	83 ec 04             	sub    $0x4,%esp
+  803215:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803218:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80321a:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  80321e:	74 21                	je     803241 <pgfault+0x33>
+  803220:	89 d0                	mov    %edx,%eax
+  803222:	c1 e8 16             	shr    $0x16,%eax
+  803225:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80322c:	a8 01                	test   $0x1,%al
+  80322e:	74 11                	je     803241 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803230:	89 d0                	mov    %edx,%eax
+  803232:	c1 e8 0c             	shr    $0xc,%eax
+  803235:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80323c:	f6 c4 08             	test   $0x8,%ah
+  80323f:	75 17                	jne    803258 <pgfault+0x4a>
+		if (pgfault_next) {
+  803241:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  803246:	85 c0                	test   %eax,%eax
+  803248:	74 27                	je     803271 <pgfault+0x63>
+			pgfault_next(utf);
+  80324a:	83 ec 0c             	sub    $0xc,%esp
+  80324d:	53                   	push   %ebx
+  80324e:	ff d0                	call   *%eax
+			return;
+  803250:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803253:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803256:	c9                   	leave
+  803257:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803258:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80325e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803263:	b8 00 00 00 00       	mov    $0x0,%eax
+  803268:	e8 16 ff ff ff       	call   803183 <copy_page_to>
+  80326d:	85 c0                	test   %eax,%eax
+  80326f:	79 e2                	jns    803253 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803271:	a1 04 60 80 00       	mov    0x806004,%eax
+  803276:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803279:	ff 73 28             	push   0x28(%ebx)
+  80327c:	ff 33                	push   (%ebx)
+  80327e:	50                   	push   %eax
+  80327f:	68 00 3f 80 00       	push   $0x803f00
+  803284:	e8 30 d0 ff ff       	call   8002b9 <cprintf>
+	sys_env_destroy(0);
+  803289:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803290:	e8 8f d9 ff ff       	call   800c24 <sys_env_destroy>
+  803295:	83 c4 10             	add    $0x10,%esp
+  803298:	eb b9                	jmp    803253 <pgfault+0x45>
+
+0080329a <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  80329a:	55                   	push   %ebp
+  80329b:	89 e5                	mov    %esp,%ebp
+  80329d:	53                   	push   %ebx
+  80329e:	83 ec 04             	sub    $0x4,%esp
+  8032a1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8032a4:	a1 08 a0 80 00       	mov    0x80a008,%eax
+  8032a9:	3d 0e 32 80 00       	cmp    $0x80320e,%eax
+  8032ae:	74 15                	je     8032c5 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8032b0:	a3 04 a0 80 00       	mov    %eax,0x80a004
+		set_pgfault_handler(pgfault);
+  8032b5:	83 ec 0c             	sub    $0xc,%esp
+  8032b8:	68 0e 32 80 00       	push   $0x80320e
+  8032bd:	e8 fb 03 00 00       	call   8036bd <set_pgfault_handler>
+  8032c2:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8032c5:	83 ec 0c             	sub    $0xc,%esp
+  8032c8:	68 05 08 00 00       	push   $0x805
+  8032cd:	53                   	push   %ebx
+  8032ce:	6a 00                	push   $0x0
+  8032d0:	53                   	push   %ebx
+  8032d1:	6a 00                	push   $0x0
+  8032d3:	e8 26 da ff ff       	call   800cfe <sys_page_map>
+}
+  8032d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032db:	c9                   	leave
+  8032dc:	c3                   	ret
+
+008032dd <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8032dd:	55                   	push   %ebp
+  8032de:	89 e5                	mov    %esp,%ebp
+  8032e0:	57                   	push   %edi
+  8032e1:	56                   	push   %esi
+  8032e2:	53                   	push   %ebx
+  8032e3:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8032e6:	68 0e 32 80 00       	push   $0x80320e
+  8032eb:	e8 cd 03 00 00       	call   8036bd <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8032f0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8032f5:	cd 30                	int    $0x30
+  8032f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8032fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8032fd:	83 c4 10             	add    $0x10,%esp
+  803300:	85 c0                	test   %eax,%eax
+  803302:	0f 88 6b 01 00 00    	js     803473 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803308:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  80330d:	75 37                	jne    803346 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80330f:	e8 59 d9 ff ff       	call   800c6d <sys_getenvid>
+  803314:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803319:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80331f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803324:	a3 04 60 80 00       	mov    %eax,0x806004
+		return 0;
+  803329:	e9 45 01 00 00       	jmp    803473 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  80332e:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803334:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80333a:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803340:	0f 87 ba 00 00 00    	ja     803400 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803346:	89 d8                	mov    %ebx,%eax
+  803348:	c1 e8 16             	shr    $0x16,%eax
+  80334b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803352:	a8 01                	test   $0x1,%al
+  803354:	74 d8                	je     80332e <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803356:	89 d8                	mov    %ebx,%eax
+  803358:	c1 e8 0c             	shr    $0xc,%eax
+  80335b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803362:	f6 c2 01             	test   $0x1,%dl
+  803365:	74 cd                	je     803334 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803367:	89 da                	mov    %ebx,%edx
+  803369:	80 e6 df             	and    $0xdf,%dh
+  80336c:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803372:	74 c0                	je     803334 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803374:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803376:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80337d:	f6 c6 04             	test   $0x4,%dh
+  803380:	75 53                	jne    8033d5 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803382:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803389:	f6 c6 08             	test   $0x8,%dh
+  80338c:	75 0c                	jne    80339a <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80338e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803395:	f6 c2 02             	test   $0x2,%dl
+  803398:	74 3b                	je     8033d5 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80339a:	83 ec 0c             	sub    $0xc,%esp
+  80339d:	68 05 08 00 00       	push   $0x805
+  8033a2:	57                   	push   %edi
+  8033a3:	ff 75 e4             	push   -0x1c(%ebp)
+  8033a6:	57                   	push   %edi
+  8033a7:	6a 00                	push   $0x0
+  8033a9:	e8 50 d9 ff ff       	call   800cfe <sys_page_map>
+  8033ae:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8033b0:	83 c4 20             	add    $0x20,%esp
+  8033b3:	85 c0                	test   %eax,%eax
+  8033b5:	0f 88 a7 00 00 00    	js     803462 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8033bb:	83 ec 0c             	sub    $0xc,%esp
+  8033be:	68 05 08 00 00       	push   $0x805
+  8033c3:	57                   	push   %edi
+  8033c4:	6a 00                	push   $0x0
+  8033c6:	57                   	push   %edi
+  8033c7:	6a 00                	push   $0x0
+  8033c9:	e8 30 d9 ff ff       	call   800cfe <sys_page_map>
+  8033ce:	89 c6                	mov    %eax,%esi
+	return r;
+  8033d0:	83 c4 20             	add    $0x20,%esp
+  8033d3:	eb 21                	jmp    8033f6 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8033d5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033dc:	83 ec 0c             	sub    $0xc,%esp
+  8033df:	25 07 0e 00 00       	and    $0xe07,%eax
+  8033e4:	50                   	push   %eax
+  8033e5:	57                   	push   %edi
+  8033e6:	ff 75 e4             	push   -0x1c(%ebp)
+  8033e9:	57                   	push   %edi
+  8033ea:	6a 00                	push   $0x0
+  8033ec:	e8 0d d9 ff ff       	call   800cfe <sys_page_map>
+  8033f1:	89 c6                	mov    %eax,%esi
+  8033f3:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8033f6:	85 f6                	test   %esi,%esi
+  8033f8:	0f 89 36 ff ff ff    	jns    803334 <fork+0x57>
+  8033fe:	eb 62                	jmp    803462 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803400:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803405:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  80340a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80340d:	89 f8                	mov    %edi,%eax
+  80340f:	e8 6f fd ff ff       	call   803183 <copy_page_to>
+  803414:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803416:	85 c0                	test   %eax,%eax
+  803418:	78 48                	js     803462 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80341a:	83 ec 04             	sub    $0x4,%esp
+  80341d:	6a 07                	push   $0x7
+  80341f:	68 00 f0 bf ee       	push   $0xeebff000
+  803424:	57                   	push   %edi
+  803425:	e8 89 d8 ff ff       	call   800cb3 <sys_page_alloc>
+  80342a:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80342c:	83 c4 10             	add    $0x10,%esp
+  80342f:	85 c0                	test   %eax,%eax
+  803431:	78 2f                	js     803462 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803433:	a1 04 60 80 00       	mov    0x806004,%eax
+  803438:	8b 40 64             	mov    0x64(%eax),%eax
+  80343b:	83 ec 08             	sub    $0x8,%esp
+  80343e:	50                   	push   %eax
+  80343f:	57                   	push   %edi
+  803440:	e8 d9 d9 ff ff       	call   800e1e <sys_env_set_pgfault_upcall>
+  803445:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803447:	83 c4 10             	add    $0x10,%esp
+  80344a:	85 c0                	test   %eax,%eax
+  80344c:	78 14                	js     803462 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80344e:	83 ec 08             	sub    $0x8,%esp
+  803451:	6a 02                	push   $0x2
+  803453:	57                   	push   %edi
+  803454:	e8 31 d9 ff ff       	call   800d8a <sys_env_set_status>
+  803459:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80345b:	83 c4 10             	add    $0x10,%esp
+  80345e:	85 c0                	test   %eax,%eax
+  803460:	79 11                	jns    803473 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803462:	83 ec 0c             	sub    $0xc,%esp
+  803465:	ff 75 e0             	push   -0x20(%ebp)
+  803468:	e8 b7 d7 ff ff       	call   800c24 <sys_env_destroy>
+	return r;
+  80346d:	83 c4 10             	add    $0x10,%esp
+  803470:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803473:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803476:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803479:	5b                   	pop    %ebx
+  80347a:	5e                   	pop    %esi
+  80347b:	5f                   	pop    %edi
+  80347c:	5d                   	pop    %ebp
+  80347d:	c3                   	ret
+
+0080347e <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80347e:	55                   	push   %ebp
+  80347f:	89 e5                	mov    %esp,%ebp
+  803481:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803484:	68 5f 3f 80 00       	push   $0x803f5f
+  803489:	68 bf 00 00 00       	push   $0xbf
+  80348e:	68 54 3f 80 00       	push   $0x803f54
+  803493:	e8 46 cd ff ff       	call   8001de <_panic>
+
+00803498 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803498:	55                   	push   %ebp
+  803499:	89 e5                	mov    %esp,%ebp
+  80349b:	56                   	push   %esi
+  80349c:	53                   	push   %ebx
+  80349d:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8034a6:	85 c0                	test   %eax,%eax
+  8034a8:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8034ad:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8034b0:	83 ec 0c             	sub    $0xc,%esp
+  8034b3:	50                   	push   %eax
+  8034b4:	e8 42 da ff ff       	call   800efb <sys_ipc_recv>
+	if (from_env_store)
+  8034b9:	83 c4 10             	add    $0x10,%esp
+  8034bc:	85 f6                	test   %esi,%esi
+  8034be:	74 14                	je     8034d4 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8034c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034c5:	85 c0                	test   %eax,%eax
+  8034c7:	75 09                	jne    8034d2 <ipc_recv+0x3a>
+  8034c9:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  8034cf:	8b 52 74             	mov    0x74(%edx),%edx
+  8034d2:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8034d4:	85 db                	test   %ebx,%ebx
+  8034d6:	74 25                	je     8034fd <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8034d8:	85 c0                	test   %eax,%eax
+  8034da:	74 0d                	je     8034e9 <ipc_recv+0x51>
+  8034dc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8034e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034e5:	5b                   	pop    %ebx
+  8034e6:	5e                   	pop    %esi
+  8034e7:	5d                   	pop    %ebp
+  8034e8:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8034e9:	a1 04 60 80 00       	mov    0x806004,%eax
+  8034ee:	8b 40 78             	mov    0x78(%eax),%eax
+  8034f1:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8034f3:	a1 04 60 80 00       	mov    0x806004,%eax
+  8034f8:	8b 40 70             	mov    0x70(%eax),%eax
+  8034fb:	eb e5                	jmp    8034e2 <ipc_recv+0x4a>
+  8034fd:	85 c0                	test   %eax,%eax
+  8034ff:	75 e1                	jne    8034e2 <ipc_recv+0x4a>
+  803501:	eb f0                	jmp    8034f3 <ipc_recv+0x5b>
+
+00803503 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803503:	55                   	push   %ebp
+  803504:	89 e5                	mov    %esp,%ebp
+  803506:	57                   	push   %edi
+  803507:	56                   	push   %esi
+  803508:	53                   	push   %ebx
+  803509:	83 ec 0c             	sub    $0xc,%esp
+  80350c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80350f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803512:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803515:	85 db                	test   %ebx,%ebx
+  803517:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80351c:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80351f:	ff 75 14             	push   0x14(%ebp)
+  803522:	53                   	push   %ebx
+  803523:	56                   	push   %esi
+  803524:	57                   	push   %edi
+  803525:	e8 3e d9 ff ff       	call   800e68 <sys_ipc_try_send>
+  80352a:	83 c4 10             	add    $0x10,%esp
+  80352d:	85 c0                	test   %eax,%eax
+  80352f:	74 22                	je     803553 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803531:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803534:	75 07                	jne    80353d <ipc_send+0x3a>
+		sys_yield();
+  803536:	e8 59 d7 ff ff       	call   800c94 <sys_yield>
+  80353b:	eb e2                	jmp    80351f <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80353d:	68 75 3f 80 00       	push   $0x803f75
+  803542:	68 20 3e 80 00       	push   $0x803e20
+  803547:	6a 39                	push   $0x39
+  803549:	68 8a 3f 80 00       	push   $0x803f8a
+  80354e:	e8 8b cc ff ff       	call   8001de <_panic>
+	}
+}
+  803553:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803556:	5b                   	pop    %ebx
+  803557:	5e                   	pop    %esi
+  803558:	5f                   	pop    %edi
+  803559:	5d                   	pop    %ebp
+  80355a:	c3                   	ret
+
+0080355b <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80355b:	55                   	push   %ebp
+  80355c:	89 e5                	mov    %esp,%ebp
+  80355e:	57                   	push   %edi
+  80355f:	56                   	push   %esi
+  803560:	53                   	push   %ebx
+  803561:	83 ec 10             	sub    $0x10,%esp
+  803564:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803567:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80356a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80356d:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803570:	85 c0                	test   %eax,%eax
+  803572:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803577:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  80357a:	6a 00                	push   $0x0
+  80357c:	ff 33                	push   (%ebx)
+  80357e:	50                   	push   %eax
+  80357f:	e8 34 d9 ff ff       	call   800eb8 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803584:	83 c4 10             	add    $0x10,%esp
+  803587:	85 c0                	test   %eax,%eax
+  803589:	75 3c                	jne    8035c7 <ipc_recvv+0x6c>
+  80358b:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  803591:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803594:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803596:	85 ff                	test   %edi,%edi
+  803598:	74 4e                	je     8035e8 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80359a:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  8035a0:	8b 52 74             	mov    0x74(%edx),%edx
+  8035a3:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8035a5:	85 f6                	test   %esi,%esi
+  8035a7:	74 18                	je     8035c1 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8035a9:	85 c0                	test   %eax,%eax
+  8035ab:	75 2d                	jne    8035da <ipc_recvv+0x7f>
+  8035ad:	a1 04 60 80 00       	mov    0x806004,%eax
+  8035b2:	8b 40 78             	mov    0x78(%eax),%eax
+  8035b5:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8035b7:	a1 04 60 80 00       	mov    0x806004,%eax
+  8035bc:	8b 40 70             	mov    0x70(%eax),%eax
+  8035bf:	eb 1f                	jmp    8035e0 <ipc_recvv+0x85>
+  8035c1:	85 c0                	test   %eax,%eax
+  8035c3:	75 1b                	jne    8035e0 <ipc_recvv+0x85>
+  8035c5:	eb f0                	jmp    8035b7 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8035c7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8035cd:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8035d2:	85 ff                	test   %edi,%edi
+  8035d4:	75 cd                	jne    8035a3 <ipc_recvv+0x48>
+	if (perm_store)
+  8035d6:	85 f6                	test   %esi,%esi
+  8035d8:	74 e7                	je     8035c1 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8035da:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8035e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035e3:	5b                   	pop    %ebx
+  8035e4:	5e                   	pop    %esi
+  8035e5:	5f                   	pop    %edi
+  8035e6:	5d                   	pop    %ebp
+  8035e7:	c3                   	ret
+	if (perm_store)
+  8035e8:	85 f6                	test   %esi,%esi
+  8035ea:	75 bd                	jne    8035a9 <ipc_recvv+0x4e>
+  8035ec:	eb c9                	jmp    8035b7 <ipc_recvv+0x5c>
+
+008035ee <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8035ee:	55                   	push   %ebp
+  8035ef:	89 e5                	mov    %esp,%ebp
+  8035f1:	57                   	push   %edi
+  8035f2:	56                   	push   %esi
+  8035f3:	53                   	push   %ebx
+  8035f4:	83 ec 0c             	sub    $0xc,%esp
+  8035f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035fa:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8035fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  803600:	ff 75 14             	push   0x14(%ebp)
+  803603:	53                   	push   %ebx
+  803604:	56                   	push   %esi
+  803605:	57                   	push   %edi
+  803606:	e8 85 d8 ff ff       	call   800e90 <sys_ipc_try_sendv>
+  80360b:	83 c4 10             	add    $0x10,%esp
+  80360e:	85 c0                	test   %eax,%eax
+  803610:	74 22                	je     803634 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803612:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803615:	75 07                	jne    80361e <ipc_sendv+0x30>
+		sys_yield();
+  803617:	e8 78 d6 ff ff       	call   800c94 <sys_yield>
+  80361c:	eb e2                	jmp    803600 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80361e:	68 75 3f 80 00       	push   $0x803f75
+  803623:	68 20 3e 80 00       	push   $0x803e20
+  803628:	6a 5c                	push   $0x5c
+  80362a:	68 8a 3f 80 00       	push   $0x803f8a
+  80362f:	e8 aa cb ff ff       	call   8001de <_panic>
+	}
+}
+  803634:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803637:	5b                   	pop    %ebx
+  803638:	5e                   	pop    %esi
+  803639:	5f                   	pop    %edi
+  80363a:	5d                   	pop    %ebp
+  80363b:	c3                   	ret
+
+0080363c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80363c:	55                   	push   %ebp
+  80363d:	89 e5                	mov    %esp,%ebp
+  80363f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803642:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803647:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80364d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803653:	8b 52 50             	mov    0x50(%edx),%edx
+  803656:	39 ca                	cmp    %ecx,%edx
+  803658:	74 11                	je     80366b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80365a:	83 c0 01             	add    $0x1,%eax
+  80365d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803662:	75 e3                	jne    803647 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803664:	b8 00 00 00 00       	mov    $0x0,%eax
+  803669:	eb 0e                	jmp    803679 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80366b:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803671:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803676:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803679:	5d                   	pop    %ebp
+  80367a:	c3                   	ret
+
+0080367b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80367b:	55                   	push   %ebp
+  80367c:	89 e5                	mov    %esp,%ebp
+  80367e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803681:	89 c2                	mov    %eax,%edx
+  803683:	c1 ea 16             	shr    $0x16,%edx
+  803686:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80368d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803692:	f6 c1 01             	test   $0x1,%cl
+  803695:	74 22                	je     8036b9 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803697:	c1 e8 0c             	shr    $0xc,%eax
+  80369a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8036a1:	a8 01                	test   $0x1,%al
+  8036a3:	74 14                	je     8036b9 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8036a5:	c1 e8 0c             	shr    $0xc,%eax
+  8036a8:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8036ab:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8036b2:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8036b6:	0f b7 d2             	movzwl %dx,%edx
+}
+  8036b9:	89 d0                	mov    %edx,%eax
+  8036bb:	5d                   	pop    %ebp
+  8036bc:	c3                   	ret
+
+008036bd <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8036bd:	55                   	push   %ebp
+  8036be:	89 e5                	mov    %esp,%ebp
+  8036c0:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8036c3:	83 3d 08 a0 80 00 00 	cmpl   $0x0,0x80a008
+  8036ca:	74 0a                	je     8036d6 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8036cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036cf:	a3 08 a0 80 00       	mov    %eax,0x80a008
+}
+  8036d4:	c9                   	leave
+  8036d5:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8036d6:	83 ec 04             	sub    $0x4,%esp
+  8036d9:	6a 07                	push   $0x7
+  8036db:	68 00 f0 bf ee       	push   $0xeebff000
+  8036e0:	6a 00                	push   $0x0
+  8036e2:	e8 cc d5 ff ff       	call   800cb3 <sys_page_alloc>
+  8036e7:	83 c4 10             	add    $0x10,%esp
+  8036ea:	85 c0                	test   %eax,%eax
+  8036ec:	75 2c                	jne    80371a <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8036ee:	83 ec 08             	sub    $0x8,%esp
+  8036f1:	68 30 37 80 00       	push   $0x803730
+  8036f6:	6a 00                	push   $0x0
+  8036f8:	e8 21 d7 ff ff       	call   800e1e <sys_env_set_pgfault_upcall>
+  8036fd:	83 c4 10             	add    $0x10,%esp
+  803700:	85 c0                	test   %eax,%eax
+  803702:	74 c8                	je     8036cc <set_pgfault_handler+0xf>
+  803704:	68 dc 3f 80 00       	push   $0x803fdc
+  803709:	68 20 3e 80 00       	push   $0x803e20
+  80370e:	6a 20                	push   $0x20
+  803710:	68 0c 40 80 00       	push   $0x80400c
+  803715:	e8 c4 ca ff ff       	call   8001de <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80371a:	68 94 3f 80 00       	push   $0x803f94
+  80371f:	68 20 3e 80 00       	push   $0x803e20
+  803724:	6a 1e                	push   $0x1e
+  803726:	68 0c 40 80 00       	push   $0x80400c
+  80372b:	e8 ae ca ff ff       	call   8001de <_panic>
+
+00803730 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803730:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803731:	a1 08 a0 80 00       	mov    0x80a008,%eax
+	call *%eax
+  803736:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803738:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80373b:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803740:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803745:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803749:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80374c:	83 c4 08             	add    $0x8,%esp
+	popal
+  80374f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803750:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803753:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803754:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803755:	c3                   	ret
+
+00803756 <dm>:
+  803756:	55                   	push   %ebp
+  803757:	57                   	push   %edi
+  803758:	56                   	push   %esi
+  803759:	53                   	push   %ebx
+  80375a:	83 ec 24             	sub    $0x24,%esp
+  80375d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803761:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803765:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803769:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80376d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803771:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803775:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803779:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80377e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803783:	ba 00 00 00 00       	mov    $0x0,%edx
+  803788:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80378f:	00 
+  803790:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803797:	00 
+  803798:	89 fb                	mov    %edi,%ebx
+  80379a:	eb 08                	jmp    8037a4 <dm+0x4e>
+  80379c:	83 e9 01             	sub    $0x1,%ecx
+  80379f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8037a2:	74 68                	je     80380c <dm+0xb6>
+  8037a4:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8037a8:	01 c0                	add    %eax,%eax
+  8037aa:	89 c6                	mov    %eax,%esi
+  8037ac:	89 d7                	mov    %edx,%edi
+  8037ae:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8037b2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8037b6:	0f ad d0             	shrd   %cl,%edx,%eax
+  8037b9:	d3 ea                	shr    %cl,%edx
+  8037bb:	f6 c1 20             	test   $0x20,%cl
+  8037be:	74 04                	je     8037c4 <dm+0x6e>
+  8037c0:	89 d0                	mov    %edx,%eax
+  8037c2:	31 d2                	xor    %edx,%edx
+  8037c4:	83 e0 01             	and    $0x1,%eax
+  8037c7:	89 04 24             	mov    %eax,(%esp)
+  8037ca:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8037d1:	00 
+  8037d2:	8b 04 24             	mov    (%esp),%eax
+  8037d5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8037d9:	09 f0                	or     %esi,%eax
+  8037db:	09 fa                	or     %edi,%edx
+  8037dd:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8037e1:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8037e5:	39 f0                	cmp    %esi,%eax
+  8037e7:	89 d5                	mov    %edx,%ebp
+  8037e9:	19 fd                	sbb    %edi,%ebp
+  8037eb:	72 af                	jb     80379c <dm+0x46>
+  8037ed:	29 f0                	sub    %esi,%eax
+  8037ef:	19 fa                	sbb    %edi,%edx
+  8037f1:	89 cf                	mov    %ecx,%edi
+  8037f3:	c1 ef 05             	shr    $0x5,%edi
+  8037f6:	83 e7 01             	and    $0x1,%edi
+  8037f9:	89 fe                	mov    %edi,%esi
+  8037fb:	83 f6 01             	xor    $0x1,%esi
+  8037fe:	d3 e6                	shl    %cl,%esi
+  803800:	d3 e7                	shl    %cl,%edi
+  803802:	09 74 24 18          	or     %esi,0x18(%esp)
+  803806:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80380a:	eb 90                	jmp    80379c <dm+0x46>
+  80380c:	85 db                	test   %ebx,%ebx
+  80380e:	74 05                	je     803815 <dm+0xbf>
+  803810:	89 03                	mov    %eax,(%ebx)
+  803812:	89 53 04             	mov    %edx,0x4(%ebx)
+  803815:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803819:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80381d:	83 c4 24             	add    $0x24,%esp
+  803820:	5b                   	pop    %ebx
+  803821:	5e                   	pop    %esi
+  803822:	5f                   	pop    %edi
+  803823:	5d                   	pop    %ebp
+  803824:	c3                   	ret
+
+00803825 <__udivdi3>:
+  803825:	83 ec 08             	sub    $0x8,%esp
+  803828:	6a 00                	push   $0x0
+  80382a:	ff 74 24 1c          	push   0x1c(%esp)
+  80382e:	ff 74 24 1c          	push   0x1c(%esp)
+  803832:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803836:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80383a:	e8 17 ff ff ff       	call   803756 <dm>
+  80383f:	83 c4 14             	add    $0x14,%esp
+  803842:	c3                   	ret
+
+00803843 <__umoddi3>:
+  803843:	83 ec 18             	sub    $0x18,%esp
+  803846:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80384a:	50                   	push   %eax
+  80384b:	ff 74 24 2c          	push   0x2c(%esp)
+  80384f:	ff 74 24 2c          	push   0x2c(%esp)
+  803853:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803857:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80385b:	e8 f6 fe ff ff       	call   803756 <dm>
+  803860:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803864:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803868:	83 c4 24             	add    $0x24,%esp
+  80386b:	c3                   	ret
+
+0080386c <__divdi3>:
+  80386c:	53                   	push   %ebx
+  80386d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803871:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803875:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803879:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80387d:	85 d2                	test   %edx,%edx
+  80387f:	78 15                	js     803896 <__divdi3+0x2a>
+  803881:	85 db                	test   %ebx,%ebx
+  803883:	78 34                	js     8038b9 <__divdi3+0x4d>
+  803885:	83 ec 04             	sub    $0x4,%esp
+  803888:	6a 00                	push   $0x0
+  80388a:	53                   	push   %ebx
+  80388b:	51                   	push   %ecx
+  80388c:	e8 c5 fe ff ff       	call   803756 <dm>
+  803891:	83 c4 10             	add    $0x10,%esp
+  803894:	eb 21                	jmp    8038b7 <__divdi3+0x4b>
+  803896:	f7 d8                	neg    %eax
+  803898:	83 d2 00             	adc    $0x0,%edx
+  80389b:	f7 da                	neg    %edx
+  80389d:	85 db                	test   %ebx,%ebx
+  80389f:	78 30                	js     8038d1 <__divdi3+0x65>
+  8038a1:	83 ec 04             	sub    $0x4,%esp
+  8038a4:	6a 00                	push   $0x0
+  8038a6:	53                   	push   %ebx
+  8038a7:	51                   	push   %ecx
+  8038a8:	e8 a9 fe ff ff       	call   803756 <dm>
+  8038ad:	83 c4 10             	add    $0x10,%esp
+  8038b0:	f7 d8                	neg    %eax
+  8038b2:	83 d2 00             	adc    $0x0,%edx
+  8038b5:	f7 da                	neg    %edx
+  8038b7:	5b                   	pop    %ebx
+  8038b8:	c3                   	ret
+  8038b9:	83 ec 04             	sub    $0x4,%esp
+  8038bc:	6a 00                	push   $0x0
+  8038be:	f7 d9                	neg    %ecx
+  8038c0:	83 d3 00             	adc    $0x0,%ebx
+  8038c3:	f7 db                	neg    %ebx
+  8038c5:	53                   	push   %ebx
+  8038c6:	51                   	push   %ecx
+  8038c7:	e8 8a fe ff ff       	call   803756 <dm>
+  8038cc:	83 c4 10             	add    $0x10,%esp
+  8038cf:	eb df                	jmp    8038b0 <__divdi3+0x44>
+  8038d1:	83 ec 04             	sub    $0x4,%esp
+  8038d4:	6a 00                	push   $0x0
+  8038d6:	f7 d9                	neg    %ecx
+  8038d8:	83 d3 00             	adc    $0x0,%ebx
+  8038db:	f7 db                	neg    %ebx
+  8038dd:	53                   	push   %ebx
+  8038de:	51                   	push   %ecx
+  8038df:	e8 72 fe ff ff       	call   803756 <dm>
+  8038e4:	83 c4 10             	add    $0x10,%esp
+  8038e7:	eb ce                	jmp    8038b7 <__divdi3+0x4b>
+
+008038e9 <__moddi3>:
+  8038e9:	55                   	push   %ebp
+  8038ea:	57                   	push   %edi
+  8038eb:	56                   	push   %esi
+  8038ec:	53                   	push   %ebx
+  8038ed:	83 ec 24             	sub    $0x24,%esp
+  8038f0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038f4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038f8:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8038fc:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803900:	85 d2                	test   %edx,%edx
+  803902:	78 3b                	js     80393f <__moddi3+0x56>
+  803904:	83 ec 04             	sub    $0x4,%esp
+  803907:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80390b:	56                   	push   %esi
+  80390c:	89 ce                	mov    %ecx,%esi
+  80390e:	f7 de                	neg    %esi
+  803910:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803914:	89 de                	mov    %ebx,%esi
+  803916:	83 d6 00             	adc    $0x0,%esi
+  803919:	f7 de                	neg    %esi
+  80391b:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80391f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803923:	0f 48 f1             	cmovs  %ecx,%esi
+  803926:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80392b:	53                   	push   %ebx
+  80392c:	56                   	push   %esi
+  80392d:	e8 24 fe ff ff       	call   803756 <dm>
+  803932:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803936:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80393a:	83 c4 10             	add    $0x10,%esp
+  80393d:	eb 47                	jmp    803986 <__moddi3+0x9d>
+  80393f:	f7 d8                	neg    %eax
+  803941:	83 d2 00             	adc    $0x0,%edx
+  803944:	f7 da                	neg    %edx
+  803946:	83 ec 04             	sub    $0x4,%esp
+  803949:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80394d:	56                   	push   %esi
+  80394e:	89 cf                	mov    %ecx,%edi
+  803950:	f7 df                	neg    %edi
+  803952:	89 de                	mov    %ebx,%esi
+  803954:	83 d6 00             	adc    $0x0,%esi
+  803957:	f7 de                	neg    %esi
+  803959:	0f 49 cf             	cmovns %edi,%ecx
+  80395c:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803960:	0f 49 de             	cmovns %esi,%ebx
+  803963:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803967:	ff 74 24 0c          	push   0xc(%esp)
+  80396b:	ff 74 24 0c          	push   0xc(%esp)
+  80396f:	e8 e2 fd ff ff       	call   803756 <dm>
+  803974:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803978:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80397c:	f7 d8                	neg    %eax
+  80397e:	83 d2 00             	adc    $0x0,%edx
+  803981:	f7 da                	neg    %edx
+  803983:	83 c4 10             	add    $0x10,%esp
+  803986:	83 c4 24             	add    $0x24,%esp
+  803989:	5b                   	pop    %ebx
+  80398a:	5e                   	pop    %esi
+  80398b:	5f                   	pop    %edi
+  80398c:	5d                   	pop    %ebp
+  80398d:	c3                   	ret
@@ -0,0 +1,7694 @@
+
+obj/user/pingpong.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8f 00 00 00       	call   8000c0 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	envid_t who;
+
+	if ((who = fork()) != 0) {
+  80003c:	e8 cc 10 00 00       	call   80110d <fork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 4f                	jne    800097 <umain+0x64>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+		ipc_send(who, 0, 0, 0);
+	}
+
+	while (1) {
+		uint32_t i = ipc_recv(&who, 0, 0);
+  800048:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80004b:	83 ec 04             	sub    $0x4,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	6a 00                	push   $0x0
+  800052:	56                   	push   %esi
+  800053:	e8 70 12 00 00       	call   8012c8 <ipc_recv>
+  800058:	89 c3                	mov    %eax,%ebx
+		cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  80005a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80005d:	e8 0a 0b 00 00       	call   800b6c <sys_getenvid>
+  800062:	57                   	push   %edi
+  800063:	53                   	push   %ebx
+  800064:	50                   	push   %eax
+  800065:	68 d6 37 80 00       	push   $0x8037d6
+  80006a:	e8 49 01 00 00       	call   8001b8 <cprintf>
+		if (i == 10)
+  80006f:	83 c4 20             	add    $0x20,%esp
+  800072:	83 fb 0a             	cmp    $0xa,%ebx
+  800075:	74 18                	je     80008f <umain+0x5c>
+			return;
+		i++;
+  800077:	83 c3 01             	add    $0x1,%ebx
+		ipc_send(who, i, 0, 0);
+  80007a:	6a 00                	push   $0x0
+  80007c:	6a 00                	push   $0x0
+  80007e:	53                   	push   %ebx
+  80007f:	ff 75 e4             	push   -0x1c(%ebp)
+  800082:	e8 ac 12 00 00       	call   801333 <ipc_send>
+		if (i == 10)
+  800087:	83 c4 10             	add    $0x10,%esp
+  80008a:	83 fb 0a             	cmp    $0xa,%ebx
+  80008d:	75 bc                	jne    80004b <umain+0x18>
+			return;
+	}
+
+}
+  80008f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800092:	5b                   	pop    %ebx
+  800093:	5e                   	pop    %esi
+  800094:	5f                   	pop    %edi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+  800097:	89 c3                	mov    %eax,%ebx
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  800099:	e8 ce 0a 00 00       	call   800b6c <sys_getenvid>
+  80009e:	83 ec 04             	sub    $0x4,%esp
+  8000a1:	53                   	push   %ebx
+  8000a2:	50                   	push   %eax
+  8000a3:	68 c0 37 80 00       	push   $0x8037c0
+  8000a8:	e8 0b 01 00 00       	call   8001b8 <cprintf>
+		ipc_send(who, 0, 0, 0);
+  8000ad:	6a 00                	push   $0x0
+  8000af:	6a 00                	push   $0x0
+  8000b1:	6a 00                	push   $0x0
+  8000b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b6:	e8 78 12 00 00       	call   801333 <ipc_send>
+  8000bb:	83 c4 20             	add    $0x20,%esp
+  8000be:	eb 88                	jmp    800048 <umain+0x15>
+
+008000c0 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	56                   	push   %esi
+  8000c4:	53                   	push   %ebx
+  8000c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000cb:	e8 9c 0a 00 00       	call   800b6c <sys_getenvid>
+  8000d0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000d5:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8000db:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000e0:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000e5:	85 db                	test   %ebx,%ebx
+  8000e7:	7e 07                	jle    8000f0 <libmain+0x30>
+		binaryname = argv[0];
+  8000e9:	8b 06                	mov    (%esi),%eax
+  8000eb:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000f0:	83 ec 08             	sub    $0x8,%esp
+  8000f3:	56                   	push   %esi
+  8000f4:	53                   	push   %ebx
+  8000f5:	e8 39 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000fa:	e8 0a 00 00 00       	call   800109 <exit>
+}
+  8000ff:	83 c4 10             	add    $0x10,%esp
+  800102:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800105:	5b                   	pop    %ebx
+  800106:	5e                   	pop    %esi
+  800107:	5d                   	pop    %ebp
+  800108:	c3                   	ret
+
+00800109 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800109:	55                   	push   %ebp
+  80010a:	89 e5                	mov    %esp,%ebp
+  80010c:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80010f:	e8 6b 15 00 00       	call   80167f <close_all>
+	sys_env_destroy(0);
+  800114:	83 ec 0c             	sub    $0xc,%esp
+  800117:	6a 00                	push   $0x0
+  800119:	e8 05 0a 00 00       	call   800b23 <sys_env_destroy>
+}
+  80011e:	83 c4 10             	add    $0x10,%esp
+  800121:	c9                   	leave
+  800122:	c3                   	ret
+
+00800123 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800123:	55                   	push   %ebp
+  800124:	89 e5                	mov    %esp,%ebp
+  800126:	53                   	push   %ebx
+  800127:	83 ec 04             	sub    $0x4,%esp
+  80012a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80012d:	8b 13                	mov    (%ebx),%edx
+  80012f:	8d 42 01             	lea    0x1(%edx),%eax
+  800132:	89 03                	mov    %eax,(%ebx)
+  800134:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800137:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80013b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800140:	74 09                	je     80014b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800142:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800146:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800149:	c9                   	leave
+  80014a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80014b:	83 ec 08             	sub    $0x8,%esp
+  80014e:	68 ff 00 00 00       	push   $0xff
+  800153:	8d 43 08             	lea    0x8(%ebx),%eax
+  800156:	50                   	push   %eax
+  800157:	e8 7a 09 00 00       	call   800ad6 <sys_cputs>
+		b->idx = 0;
+  80015c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800162:	83 c4 10             	add    $0x10,%esp
+  800165:	eb db                	jmp    800142 <putch+0x1f>
+
+00800167 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800167:	55                   	push   %ebp
+  800168:	89 e5                	mov    %esp,%ebp
+  80016a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800170:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800177:	00 00 00 
+	b.cnt = 0;
+  80017a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800181:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800184:	ff 75 0c             	push   0xc(%ebp)
+  800187:	ff 75 08             	push   0x8(%ebp)
+  80018a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800190:	50                   	push   %eax
+  800191:	68 23 01 80 00       	push   $0x800123
+  800196:	e8 14 01 00 00       	call   8002af <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80019b:	83 c4 08             	add    $0x8,%esp
+  80019e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001a4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001aa:	50                   	push   %eax
+  8001ab:	e8 26 09 00 00       	call   800ad6 <sys_cputs>
+
+	return b.cnt;
+}
+  8001b0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001b6:	c9                   	leave
+  8001b7:	c3                   	ret
+
+008001b8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001b8:	55                   	push   %ebp
+  8001b9:	89 e5                	mov    %esp,%ebp
+  8001bb:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001be:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001c1:	50                   	push   %eax
+  8001c2:	ff 75 08             	push   0x8(%ebp)
+  8001c5:	e8 9d ff ff ff       	call   800167 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001ca:	c9                   	leave
+  8001cb:	c3                   	ret
+
+008001cc <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001cc:	55                   	push   %ebp
+  8001cd:	89 e5                	mov    %esp,%ebp
+  8001cf:	57                   	push   %edi
+  8001d0:	56                   	push   %esi
+  8001d1:	53                   	push   %ebx
+  8001d2:	83 ec 1c             	sub    $0x1c,%esp
+  8001d5:	89 c7                	mov    %eax,%edi
+  8001d7:	89 d6                	mov    %edx,%esi
+  8001d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001df:	89 d1                	mov    %edx,%ecx
+  8001e1:	89 c2                	mov    %eax,%edx
+  8001e3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001e6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001e9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ec:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001f2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001f9:	39 c2                	cmp    %eax,%edx
+  8001fb:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001fe:	72 3e                	jb     80023e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800200:	83 ec 0c             	sub    $0xc,%esp
+  800203:	ff 75 18             	push   0x18(%ebp)
+  800206:	83 eb 01             	sub    $0x1,%ebx
+  800209:	53                   	push   %ebx
+  80020a:	50                   	push   %eax
+  80020b:	83 ec 08             	sub    $0x8,%esp
+  80020e:	ff 75 e4             	push   -0x1c(%ebp)
+  800211:	ff 75 e0             	push   -0x20(%ebp)
+  800214:	ff 75 dc             	push   -0x24(%ebp)
+  800217:	ff 75 d8             	push   -0x28(%ebp)
+  80021a:	e8 37 34 00 00       	call   803656 <__udivdi3>
+  80021f:	83 c4 18             	add    $0x18,%esp
+  800222:	52                   	push   %edx
+  800223:	50                   	push   %eax
+  800224:	89 f2                	mov    %esi,%edx
+  800226:	89 f8                	mov    %edi,%eax
+  800228:	e8 9f ff ff ff       	call   8001cc <printnum>
+  80022d:	83 c4 20             	add    $0x20,%esp
+  800230:	eb 13                	jmp    800245 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800232:	83 ec 08             	sub    $0x8,%esp
+  800235:	56                   	push   %esi
+  800236:	ff 75 18             	push   0x18(%ebp)
+  800239:	ff d7                	call   *%edi
+  80023b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80023e:	83 eb 01             	sub    $0x1,%ebx
+  800241:	85 db                	test   %ebx,%ebx
+  800243:	7f ed                	jg     800232 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800245:	83 ec 08             	sub    $0x8,%esp
+  800248:	56                   	push   %esi
+  800249:	83 ec 04             	sub    $0x4,%esp
+  80024c:	ff 75 e4             	push   -0x1c(%ebp)
+  80024f:	ff 75 e0             	push   -0x20(%ebp)
+  800252:	ff 75 dc             	push   -0x24(%ebp)
+  800255:	ff 75 d8             	push   -0x28(%ebp)
+  800258:	e8 17 34 00 00       	call   803674 <__umoddi3>
+  80025d:	83 c4 14             	add    $0x14,%esp
+  800260:	0f be 80 f3 37 80 00 	movsbl 0x8037f3(%eax),%eax
+  800267:	50                   	push   %eax
+  800268:	ff d7                	call   *%edi
+}
+  80026a:	83 c4 10             	add    $0x10,%esp
+  80026d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800270:	5b                   	pop    %ebx
+  800271:	5e                   	pop    %esi
+  800272:	5f                   	pop    %edi
+  800273:	5d                   	pop    %ebp
+  800274:	c3                   	ret
+
+00800275 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800275:	55                   	push   %ebp
+  800276:	89 e5                	mov    %esp,%ebp
+  800278:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80027b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80027f:	8b 10                	mov    (%eax),%edx
+  800281:	3b 50 04             	cmp    0x4(%eax),%edx
+  800284:	73 0a                	jae    800290 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800286:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800289:	89 08                	mov    %ecx,(%eax)
+  80028b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028e:	88 02                	mov    %al,(%edx)
+}
+  800290:	5d                   	pop    %ebp
+  800291:	c3                   	ret
+
+00800292 <printfmt>:
+{
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800298:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80029b:	50                   	push   %eax
+  80029c:	ff 75 10             	push   0x10(%ebp)
+  80029f:	ff 75 0c             	push   0xc(%ebp)
+  8002a2:	ff 75 08             	push   0x8(%ebp)
+  8002a5:	e8 05 00 00 00       	call   8002af <vprintfmt>
+}
+  8002aa:	83 c4 10             	add    $0x10,%esp
+  8002ad:	c9                   	leave
+  8002ae:	c3                   	ret
+
+008002af <vprintfmt>:
+{
+  8002af:	55                   	push   %ebp
+  8002b0:	89 e5                	mov    %esp,%ebp
+  8002b2:	57                   	push   %edi
+  8002b3:	56                   	push   %esi
+  8002b4:	53                   	push   %ebx
+  8002b5:	83 ec 2c             	sub    $0x2c,%esp
+  8002b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002be:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002c1:	eb 0a                	jmp    8002cd <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002c3:	83 ec 08             	sub    $0x8,%esp
+  8002c6:	53                   	push   %ebx
+  8002c7:	50                   	push   %eax
+  8002c8:	ff d6                	call   *%esi
+  8002ca:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002cd:	83 c7 01             	add    $0x1,%edi
+  8002d0:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002d4:	83 f8 25             	cmp    $0x25,%eax
+  8002d7:	74 0c                	je     8002e5 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	75 e6                	jne    8002c3 <vprintfmt+0x14>
+}
+  8002dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e0:	5b                   	pop    %ebx
+  8002e1:	5e                   	pop    %esi
+  8002e2:	5f                   	pop    %edi
+  8002e3:	5d                   	pop    %ebp
+  8002e4:	c3                   	ret
+		padc = ' ';
+  8002e5:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002e9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002f0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002f7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800303:	8d 47 01             	lea    0x1(%edi),%eax
+  800306:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800309:	0f b6 17             	movzbl (%edi),%edx
+  80030c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80030f:	3c 55                	cmp    $0x55,%al
+  800311:	0f 87 cf 03 00 00    	ja     8006e6 <vprintfmt+0x437>
+  800317:	0f b6 c0             	movzbl %al,%eax
+  80031a:	ff 24 85 60 39 80 00 	jmp    *0x803960(,%eax,4)
+  800321:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800324:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800328:	eb d9                	jmp    800303 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80032a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80032d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800331:	eb d0                	jmp    800303 <vprintfmt+0x54>
+  800333:	0f b6 d2             	movzbl %dl,%edx
+  800336:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800339:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800341:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800344:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800348:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80034b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80034e:	83 f9 09             	cmp    $0x9,%ecx
+  800351:	77 55                	ja     8003a8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800353:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800356:	eb e9                	jmp    800341 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800358:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035b:	8b 00                	mov    (%eax),%eax
+  80035d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800360:	8b 45 14             	mov    0x14(%ebp),%eax
+  800363:	8d 40 04             	lea    0x4(%eax),%eax
+  800366:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800369:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80036c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800370:	79 91                	jns    800303 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800372:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800375:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800378:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80037f:	eb 82                	jmp    800303 <vprintfmt+0x54>
+			if (width < 0)
+  800381:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800384:	85 d2                	test   %edx,%edx
+  800386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038b:	0f 49 c2             	cmovns %edx,%eax
+  80038e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800391:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800394:	e9 6a ff ff ff       	jmp    800303 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800399:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80039c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003a3:	e9 5b ff ff ff       	jmp    800303 <vprintfmt+0x54>
+  8003a8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ae:	eb bc                	jmp    80036c <vprintfmt+0xbd>
+			lflag++;
+  8003b0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003b6:	e9 48 ff ff ff       	jmp    800303 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003be:	8d 78 04             	lea    0x4(%eax),%edi
+  8003c1:	83 ec 08             	sub    $0x8,%esp
+  8003c4:	53                   	push   %ebx
+  8003c5:	ff 30                	push   (%eax)
+  8003c7:	ff d6                	call   *%esi
+			break;
+  8003c9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003cc:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003cf:	e9 b1 02 00 00       	jmp    800685 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d7:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003da:	8b 10                	mov    (%eax),%edx
+  8003dc:	89 d0                	mov    %edx,%eax
+  8003de:	f7 d8                	neg    %eax
+  8003e0:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003e3:	83 f8 11             	cmp    $0x11,%eax
+  8003e6:	7f 23                	jg     80040b <vprintfmt+0x15c>
+  8003e8:	8b 14 85 c0 3a 80 00 	mov    0x803ac0(,%eax,4),%edx
+  8003ef:	85 d2                	test   %edx,%edx
+  8003f1:	74 18                	je     80040b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003f3:	52                   	push   %edx
+  8003f4:	68 de 3b 80 00       	push   $0x803bde
+  8003f9:	53                   	push   %ebx
+  8003fa:	56                   	push   %esi
+  8003fb:	e8 92 fe ff ff       	call   800292 <printfmt>
+  800400:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800403:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800406:	e9 7a 02 00 00       	jmp    800685 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80040b:	50                   	push   %eax
+  80040c:	68 0b 38 80 00       	push   $0x80380b
+  800411:	53                   	push   %ebx
+  800412:	56                   	push   %esi
+  800413:	e8 7a fe ff ff       	call   800292 <printfmt>
+  800418:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80041b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80041e:	e9 62 02 00 00       	jmp    800685 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800423:	8b 45 14             	mov    0x14(%ebp),%eax
+  800426:	83 c0 04             	add    $0x4,%eax
+  800429:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80042c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800431:	85 c9                	test   %ecx,%ecx
+  800433:	b8 04 38 80 00       	mov    $0x803804,%eax
+  800438:	0f 45 c1             	cmovne %ecx,%eax
+  80043b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80043e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800442:	7e 06                	jle    80044a <vprintfmt+0x19b>
+  800444:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800448:	75 0b                	jne    800455 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80044a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80044d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800450:	89 75 08             	mov    %esi,0x8(%ebp)
+  800453:	eb 5c                	jmp    8004b1 <vprintfmt+0x202>
+  800455:	83 ec 08             	sub    $0x8,%esp
+  800458:	ff 75 d0             	push   -0x30(%ebp)
+  80045b:	ff 75 cc             	push   -0x34(%ebp)
+  80045e:	e8 20 03 00 00       	call   800783 <strnlen>
+  800463:	89 c2                	mov    %eax,%edx
+  800465:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800468:	29 d0                	sub    %edx,%eax
+  80046a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80046d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800471:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800474:	89 75 08             	mov    %esi,0x8(%ebp)
+  800477:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800479:	eb 0e                	jmp    800489 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80047b:	83 ec 08             	sub    $0x8,%esp
+  80047e:	53                   	push   %ebx
+  80047f:	57                   	push   %edi
+  800480:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800483:	83 ee 01             	sub    $0x1,%esi
+  800486:	83 c4 10             	add    $0x10,%esp
+  800489:	85 f6                	test   %esi,%esi
+  80048b:	7f ee                	jg     80047b <vprintfmt+0x1cc>
+  80048d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800490:	8b 75 08             	mov    0x8(%ebp),%esi
+  800493:	85 c0                	test   %eax,%eax
+  800495:	ba 00 00 00 00       	mov    $0x0,%edx
+  80049a:	0f 49 d0             	cmovns %eax,%edx
+  80049d:	29 d0                	sub    %edx,%eax
+  80049f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004a2:	eb a6                	jmp    80044a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004a4:	83 ec 08             	sub    $0x8,%esp
+  8004a7:	53                   	push   %ebx
+  8004a8:	52                   	push   %edx
+  8004a9:	ff 55 08             	call   *0x8(%ebp)
+  8004ac:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004af:	89 f1                	mov    %esi,%ecx
+  8004b1:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004b4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004b8:	0f be d0             	movsbl %al,%edx
+  8004bb:	85 d2                	test   %edx,%edx
+  8004bd:	74 28                	je     8004e7 <vprintfmt+0x238>
+  8004bf:	85 ff                	test   %edi,%edi
+  8004c1:	78 05                	js     8004c8 <vprintfmt+0x219>
+  8004c3:	83 ef 01             	sub    $0x1,%edi
+  8004c6:	78 30                	js     8004f8 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004c8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004cc:	74 d6                	je     8004a4 <vprintfmt+0x1f5>
+  8004ce:	0f be c0             	movsbl %al,%eax
+  8004d1:	83 e8 20             	sub    $0x20,%eax
+  8004d4:	83 f8 5e             	cmp    $0x5e,%eax
+  8004d7:	76 cb                	jbe    8004a4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004d9:	83 ec 08             	sub    $0x8,%esp
+  8004dc:	53                   	push   %ebx
+  8004dd:	6a 3f                	push   $0x3f
+  8004df:	ff 55 08             	call   *0x8(%ebp)
+  8004e2:	83 c4 10             	add    $0x10,%esp
+  8004e5:	eb c8                	jmp    8004af <vprintfmt+0x200>
+  8004e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ea:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ed:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004f0:	01 d0                	add    %edx,%eax
+  8004f2:	29 c8                	sub    %ecx,%eax
+  8004f4:	89 c7                	mov    %eax,%edi
+  8004f6:	eb 13                	jmp    80050b <vprintfmt+0x25c>
+  8004f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004fb:	eb ed                	jmp    8004ea <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004fd:	83 ec 08             	sub    $0x8,%esp
+  800500:	53                   	push   %ebx
+  800501:	6a 20                	push   $0x20
+  800503:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800505:	83 ef 01             	sub    $0x1,%edi
+  800508:	83 c4 10             	add    $0x10,%esp
+  80050b:	85 ff                	test   %edi,%edi
+  80050d:	7f ee                	jg     8004fd <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80050f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800512:	89 45 14             	mov    %eax,0x14(%ebp)
+  800515:	e9 6b 01 00 00       	jmp    800685 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80051a:	83 f9 01             	cmp    $0x1,%ecx
+  80051d:	7f 1f                	jg     80053e <vprintfmt+0x28f>
+	else if (lflag)
+  80051f:	85 c9                	test   %ecx,%ecx
+  800521:	74 67                	je     80058a <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800523:	8b 45 14             	mov    0x14(%ebp),%eax
+  800526:	8b 00                	mov    (%eax),%eax
+  800528:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052b:	89 c1                	mov    %eax,%ecx
+  80052d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800530:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800533:	8b 45 14             	mov    0x14(%ebp),%eax
+  800536:	8d 40 04             	lea    0x4(%eax),%eax
+  800539:	89 45 14             	mov    %eax,0x14(%ebp)
+  80053c:	eb 17                	jmp    800555 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80053e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800541:	8b 50 04             	mov    0x4(%eax),%edx
+  800544:	8b 00                	mov    (%eax),%eax
+  800546:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800549:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80054c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054f:	8d 40 08             	lea    0x8(%eax),%eax
+  800552:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800555:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800558:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80055b:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800560:	85 c9                	test   %ecx,%ecx
+  800562:	0f 89 03 01 00 00    	jns    80066b <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800568:	83 ec 08             	sub    $0x8,%esp
+  80056b:	53                   	push   %ebx
+  80056c:	6a 2d                	push   $0x2d
+  80056e:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800570:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800573:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800576:	f7 da                	neg    %edx
+  800578:	83 d1 00             	adc    $0x0,%ecx
+  80057b:	f7 d9                	neg    %ecx
+  80057d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800580:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800585:	e9 e1 00 00 00       	jmp    80066b <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80058a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058d:	8b 00                	mov    (%eax),%eax
+  80058f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800592:	89 c1                	mov    %eax,%ecx
+  800594:	c1 f9 1f             	sar    $0x1f,%ecx
+  800597:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80059a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059d:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a3:	eb b0                	jmp    800555 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005a5:	83 f9 01             	cmp    $0x1,%ecx
+  8005a8:	7f 1e                	jg     8005c8 <vprintfmt+0x319>
+	else if (lflag)
+  8005aa:	85 c9                	test   %ecx,%ecx
+  8005ac:	74 32                	je     8005e0 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b1:	8b 10                	mov    (%eax),%edx
+  8005b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005be:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005c3:	e9 a3 00 00 00       	jmp    80066b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cb:	8b 10                	mov    (%eax),%edx
+  8005cd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005d0:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005d6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005db:	e9 8b 00 00 00       	jmp    80066b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e3:	8b 10                	mov    (%eax),%edx
+  8005e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ed:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005f5:	eb 74                	jmp    80066b <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005f7:	83 f9 01             	cmp    $0x1,%ecx
+  8005fa:	7f 1b                	jg     800617 <vprintfmt+0x368>
+	else if (lflag)
+  8005fc:	85 c9                	test   %ecx,%ecx
+  8005fe:	74 2c                	je     80062c <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800600:	8b 45 14             	mov    0x14(%ebp),%eax
+  800603:	8b 10                	mov    (%eax),%edx
+  800605:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80060a:	8d 40 04             	lea    0x4(%eax),%eax
+  80060d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800610:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800615:	eb 54                	jmp    80066b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061a:	8b 10                	mov    (%eax),%edx
+  80061c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80061f:	8d 40 08             	lea    0x8(%eax),%eax
+  800622:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800625:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80062a:	eb 3f                	jmp    80066b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80062c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062f:	8b 10                	mov    (%eax),%edx
+  800631:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800636:	8d 40 04             	lea    0x4(%eax),%eax
+  800639:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80063c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800641:	eb 28                	jmp    80066b <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800643:	83 ec 08             	sub    $0x8,%esp
+  800646:	53                   	push   %ebx
+  800647:	6a 30                	push   $0x30
+  800649:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80064b:	83 c4 08             	add    $0x8,%esp
+  80064e:	53                   	push   %ebx
+  80064f:	6a 78                	push   $0x78
+  800651:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800653:	8b 45 14             	mov    0x14(%ebp),%eax
+  800656:	8b 10                	mov    (%eax),%edx
+  800658:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80065d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800660:	8d 40 04             	lea    0x4(%eax),%eax
+  800663:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800666:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80066b:	83 ec 0c             	sub    $0xc,%esp
+  80066e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800672:	50                   	push   %eax
+  800673:	ff 75 e0             	push   -0x20(%ebp)
+  800676:	57                   	push   %edi
+  800677:	51                   	push   %ecx
+  800678:	52                   	push   %edx
+  800679:	89 da                	mov    %ebx,%edx
+  80067b:	89 f0                	mov    %esi,%eax
+  80067d:	e8 4a fb ff ff       	call   8001cc <printnum>
+			break;
+  800682:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800685:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800688:	e9 40 fc ff ff       	jmp    8002cd <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80068d:	83 f9 01             	cmp    $0x1,%ecx
+  800690:	7f 1b                	jg     8006ad <vprintfmt+0x3fe>
+	else if (lflag)
+  800692:	85 c9                	test   %ecx,%ecx
+  800694:	74 2c                	je     8006c2 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8b 10                	mov    (%eax),%edx
+  80069b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006ab:	eb be                	jmp    80066b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b0:	8b 10                	mov    (%eax),%edx
+  8006b2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b5:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006bb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006c0:	eb a9                	jmp    80066b <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c5:	8b 10                	mov    (%eax),%edx
+  8006c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d2:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006d7:	eb 92                	jmp    80066b <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006d9:	83 ec 08             	sub    $0x8,%esp
+  8006dc:	53                   	push   %ebx
+  8006dd:	6a 25                	push   $0x25
+  8006df:	ff d6                	call   *%esi
+			break;
+  8006e1:	83 c4 10             	add    $0x10,%esp
+  8006e4:	eb 9f                	jmp    800685 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006e6:	83 ec 08             	sub    $0x8,%esp
+  8006e9:	53                   	push   %ebx
+  8006ea:	6a 25                	push   $0x25
+  8006ec:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006ee:	83 c4 10             	add    $0x10,%esp
+  8006f1:	89 f8                	mov    %edi,%eax
+  8006f3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006f7:	74 05                	je     8006fe <vprintfmt+0x44f>
+  8006f9:	83 e8 01             	sub    $0x1,%eax
+  8006fc:	eb f5                	jmp    8006f3 <vprintfmt+0x444>
+  8006fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800701:	eb 82                	jmp    800685 <vprintfmt+0x3d6>
+
+00800703 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800703:	55                   	push   %ebp
+  800704:	89 e5                	mov    %esp,%ebp
+  800706:	83 ec 18             	sub    $0x18,%esp
+  800709:	8b 45 08             	mov    0x8(%ebp),%eax
+  80070c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80070f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800712:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800716:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800719:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800720:	85 c0                	test   %eax,%eax
+  800722:	74 26                	je     80074a <vsnprintf+0x47>
+  800724:	85 d2                	test   %edx,%edx
+  800726:	7e 22                	jle    80074a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800728:	ff 75 14             	push   0x14(%ebp)
+  80072b:	ff 75 10             	push   0x10(%ebp)
+  80072e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800731:	50                   	push   %eax
+  800732:	68 75 02 80 00       	push   $0x800275
+  800737:	e8 73 fb ff ff       	call   8002af <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80073c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80073f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800742:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800745:	83 c4 10             	add    $0x10,%esp
+}
+  800748:	c9                   	leave
+  800749:	c3                   	ret
+		return -E_INVAL;
+  80074a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80074f:	eb f7                	jmp    800748 <vsnprintf+0x45>
+
+00800751 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800751:	55                   	push   %ebp
+  800752:	89 e5                	mov    %esp,%ebp
+  800754:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800757:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80075a:	50                   	push   %eax
+  80075b:	ff 75 10             	push   0x10(%ebp)
+  80075e:	ff 75 0c             	push   0xc(%ebp)
+  800761:	ff 75 08             	push   0x8(%ebp)
+  800764:	e8 9a ff ff ff       	call   800703 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800769:	c9                   	leave
+  80076a:	c3                   	ret
+
+0080076b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80076b:	55                   	push   %ebp
+  80076c:	89 e5                	mov    %esp,%ebp
+  80076e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800771:	b8 00 00 00 00       	mov    $0x0,%eax
+  800776:	eb 03                	jmp    80077b <strlen+0x10>
+		n++;
+  800778:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80077b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80077f:	75 f7                	jne    800778 <strlen+0xd>
+	return n;
+}
+  800781:	5d                   	pop    %ebp
+  800782:	c3                   	ret
+
+00800783 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800783:	55                   	push   %ebp
+  800784:	89 e5                	mov    %esp,%ebp
+  800786:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800789:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80078c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800791:	eb 03                	jmp    800796 <strnlen+0x13>
+		n++;
+  800793:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800796:	39 d0                	cmp    %edx,%eax
+  800798:	74 08                	je     8007a2 <strnlen+0x1f>
+  80079a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80079e:	75 f3                	jne    800793 <strnlen+0x10>
+  8007a0:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007a2:	89 d0                	mov    %edx,%eax
+  8007a4:	5d                   	pop    %ebp
+  8007a5:	c3                   	ret
+
+008007a6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007a6:	55                   	push   %ebp
+  8007a7:	89 e5                	mov    %esp,%ebp
+  8007a9:	53                   	push   %ebx
+  8007aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007b9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007bc:	83 c0 01             	add    $0x1,%eax
+  8007bf:	84 d2                	test   %dl,%dl
+  8007c1:	75 f2                	jne    8007b5 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007c3:	89 c8                	mov    %ecx,%eax
+  8007c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c8:	c9                   	leave
+  8007c9:	c3                   	ret
+
+008007ca <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007ca:	55                   	push   %ebp
+  8007cb:	89 e5                	mov    %esp,%ebp
+  8007cd:	53                   	push   %ebx
+  8007ce:	83 ec 10             	sub    $0x10,%esp
+  8007d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007d4:	53                   	push   %ebx
+  8007d5:	e8 91 ff ff ff       	call   80076b <strlen>
+  8007da:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007dd:	ff 75 0c             	push   0xc(%ebp)
+  8007e0:	01 d8                	add    %ebx,%eax
+  8007e2:	50                   	push   %eax
+  8007e3:	e8 be ff ff ff       	call   8007a6 <strcpy>
+	return dst;
+}
+  8007e8:	89 d8                	mov    %ebx,%eax
+  8007ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ed:	c9                   	leave
+  8007ee:	c3                   	ret
+
+008007ef <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007ef:	55                   	push   %ebp
+  8007f0:	89 e5                	mov    %esp,%ebp
+  8007f2:	56                   	push   %esi
+  8007f3:	53                   	push   %ebx
+  8007f4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007fa:	89 f3                	mov    %esi,%ebx
+  8007fc:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007ff:	89 f0                	mov    %esi,%eax
+  800801:	eb 0f                	jmp    800812 <strncpy+0x23>
+		*dst++ = *src;
+  800803:	83 c0 01             	add    $0x1,%eax
+  800806:	0f b6 0a             	movzbl (%edx),%ecx
+  800809:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80080c:	80 f9 01             	cmp    $0x1,%cl
+  80080f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800812:	39 d8                	cmp    %ebx,%eax
+  800814:	75 ed                	jne    800803 <strncpy+0x14>
+	}
+	return ret;
+}
+  800816:	89 f0                	mov    %esi,%eax
+  800818:	5b                   	pop    %ebx
+  800819:	5e                   	pop    %esi
+  80081a:	5d                   	pop    %ebp
+  80081b:	c3                   	ret
+
+0080081c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80081c:	55                   	push   %ebp
+  80081d:	89 e5                	mov    %esp,%ebp
+  80081f:	56                   	push   %esi
+  800820:	53                   	push   %ebx
+  800821:	8b 75 08             	mov    0x8(%ebp),%esi
+  800824:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800827:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80082a:	89 f0                	mov    %esi,%eax
+  80082c:	85 d2                	test   %edx,%edx
+  80082e:	74 21                	je     800851 <strlcpy+0x35>
+  800830:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800834:	89 f2                	mov    %esi,%edx
+  800836:	eb 09                	jmp    800841 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800838:	83 c1 01             	add    $0x1,%ecx
+  80083b:	83 c2 01             	add    $0x1,%edx
+  80083e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800841:	39 c2                	cmp    %eax,%edx
+  800843:	74 09                	je     80084e <strlcpy+0x32>
+  800845:	0f b6 19             	movzbl (%ecx),%ebx
+  800848:	84 db                	test   %bl,%bl
+  80084a:	75 ec                	jne    800838 <strlcpy+0x1c>
+  80084c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80084e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800851:	29 f0                	sub    %esi,%eax
+}
+  800853:	5b                   	pop    %ebx
+  800854:	5e                   	pop    %esi
+  800855:	5d                   	pop    %ebp
+  800856:	c3                   	ret
+
+00800857 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800857:	55                   	push   %ebp
+  800858:	89 e5                	mov    %esp,%ebp
+  80085a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80085d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800860:	eb 06                	jmp    800868 <strcmp+0x11>
+		p++, q++;
+  800862:	83 c1 01             	add    $0x1,%ecx
+  800865:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800868:	0f b6 01             	movzbl (%ecx),%eax
+  80086b:	84 c0                	test   %al,%al
+  80086d:	74 04                	je     800873 <strcmp+0x1c>
+  80086f:	3a 02                	cmp    (%edx),%al
+  800871:	74 ef                	je     800862 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800873:	0f b6 c0             	movzbl %al,%eax
+  800876:	0f b6 12             	movzbl (%edx),%edx
+  800879:	29 d0                	sub    %edx,%eax
+}
+  80087b:	5d                   	pop    %ebp
+  80087c:	c3                   	ret
+
+0080087d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80087d:	55                   	push   %ebp
+  80087e:	89 e5                	mov    %esp,%ebp
+  800880:	53                   	push   %ebx
+  800881:	8b 45 08             	mov    0x8(%ebp),%eax
+  800884:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800887:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80088a:	eb 09                	jmp    800895 <strncmp+0x18>
+		n--, p++, q++;
+  80088c:	83 ea 01             	sub    $0x1,%edx
+  80088f:	83 c0 01             	add    $0x1,%eax
+  800892:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800895:	85 d2                	test   %edx,%edx
+  800897:	74 18                	je     8008b1 <strncmp+0x34>
+  800899:	0f b6 18             	movzbl (%eax),%ebx
+  80089c:	84 db                	test   %bl,%bl
+  80089e:	74 04                	je     8008a4 <strncmp+0x27>
+  8008a0:	3a 19                	cmp    (%ecx),%bl
+  8008a2:	74 e8                	je     80088c <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008a4:	0f b6 00             	movzbl (%eax),%eax
+  8008a7:	0f b6 11             	movzbl (%ecx),%edx
+  8008aa:	29 d0                	sub    %edx,%eax
+}
+  8008ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008af:	c9                   	leave
+  8008b0:	c3                   	ret
+		return 0;
+  8008b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b6:	eb f4                	jmp    8008ac <strncmp+0x2f>
+
+008008b8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008b8:	55                   	push   %ebp
+  8008b9:	89 e5                	mov    %esp,%ebp
+  8008bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008be:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008c2:	eb 03                	jmp    8008c7 <strchr+0xf>
+  8008c4:	83 c0 01             	add    $0x1,%eax
+  8008c7:	0f b6 10             	movzbl (%eax),%edx
+  8008ca:	84 d2                	test   %dl,%dl
+  8008cc:	74 06                	je     8008d4 <strchr+0x1c>
+		if (*s == c)
+  8008ce:	38 ca                	cmp    %cl,%dl
+  8008d0:	75 f2                	jne    8008c4 <strchr+0xc>
+  8008d2:	eb 05                	jmp    8008d9 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008d9:	5d                   	pop    %ebp
+  8008da:	c3                   	ret
+
+008008db <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008db:	55                   	push   %ebp
+  8008dc:	89 e5                	mov    %esp,%ebp
+  8008de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008e5:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008e8:	38 ca                	cmp    %cl,%dl
+  8008ea:	74 09                	je     8008f5 <strfind+0x1a>
+  8008ec:	84 d2                	test   %dl,%dl
+  8008ee:	74 05                	je     8008f5 <strfind+0x1a>
+	for (; *s; s++)
+  8008f0:	83 c0 01             	add    $0x1,%eax
+  8008f3:	eb f0                	jmp    8008e5 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008f5:	5d                   	pop    %ebp
+  8008f6:	c3                   	ret
+
+008008f7 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008f7:	55                   	push   %ebp
+  8008f8:	89 e5                	mov    %esp,%ebp
+  8008fa:	57                   	push   %edi
+  8008fb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008fe:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800901:	85 c9                	test   %ecx,%ecx
+  800903:	74 20                	je     800925 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800905:	89 f8                	mov    %edi,%eax
+  800907:	09 c8                	or     %ecx,%eax
+  800909:	a8 03                	test   $0x3,%al
+  80090b:	75 12                	jne    80091f <memset+0x28>
+		c &= 0xFF;
+  80090d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800911:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800917:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80091a:	fc                   	cld
+  80091b:	f3 ab                	rep stos %eax,%es:(%edi)
+  80091d:	eb 06                	jmp    800925 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80091f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800922:	fc                   	cld
+  800923:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800925:	89 f8                	mov    %edi,%eax
+  800927:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80092a:	c9                   	leave
+  80092b:	c3                   	ret
+
+0080092c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80092c:	55                   	push   %ebp
+  80092d:	89 e5                	mov    %esp,%ebp
+  80092f:	57                   	push   %edi
+  800930:	56                   	push   %esi
+  800931:	8b 45 08             	mov    0x8(%ebp),%eax
+  800934:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800937:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80093a:	39 c6                	cmp    %eax,%esi
+  80093c:	73 32                	jae    800970 <memmove+0x44>
+  80093e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800941:	39 d0                	cmp    %edx,%eax
+  800943:	73 2b                	jae    800970 <memmove+0x44>
+		s += n;
+		d += n;
+  800945:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800948:	89 d6                	mov    %edx,%esi
+  80094a:	09 fe                	or     %edi,%esi
+  80094c:	09 ce                	or     %ecx,%esi
+  80094e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800954:	75 0e                	jne    800964 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800956:	83 ef 04             	sub    $0x4,%edi
+  800959:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80095c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80095f:	fd                   	std
+  800960:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800962:	eb 09                	jmp    80096d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800964:	83 ef 01             	sub    $0x1,%edi
+  800967:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80096a:	fd                   	std
+  80096b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80096d:	fc                   	cld
+  80096e:	eb 1a                	jmp    80098a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800970:	89 f2                	mov    %esi,%edx
+  800972:	09 c2                	or     %eax,%edx
+  800974:	09 ca                	or     %ecx,%edx
+  800976:	f6 c2 03             	test   $0x3,%dl
+  800979:	75 0a                	jne    800985 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80097b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80097e:	89 c7                	mov    %eax,%edi
+  800980:	fc                   	cld
+  800981:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800983:	eb 05                	jmp    80098a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800985:	89 c7                	mov    %eax,%edi
+  800987:	fc                   	cld
+  800988:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80098a:	5e                   	pop    %esi
+  80098b:	5f                   	pop    %edi
+  80098c:	5d                   	pop    %ebp
+  80098d:	c3                   	ret
+
+0080098e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80098e:	55                   	push   %ebp
+  80098f:	89 e5                	mov    %esp,%ebp
+  800991:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800994:	ff 75 10             	push   0x10(%ebp)
+  800997:	ff 75 0c             	push   0xc(%ebp)
+  80099a:	ff 75 08             	push   0x8(%ebp)
+  80099d:	e8 8a ff ff ff       	call   80092c <memmove>
+}
+  8009a2:	c9                   	leave
+  8009a3:	c3                   	ret
+
+008009a4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009a4:	55                   	push   %ebp
+  8009a5:	89 e5                	mov    %esp,%ebp
+  8009a7:	56                   	push   %esi
+  8009a8:	53                   	push   %ebx
+  8009a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009af:	89 c6                	mov    %eax,%esi
+  8009b1:	03 75 10             	add    0x10(%ebp),%esi
+  8009b4:	eb 06                	jmp    8009bc <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009b6:	83 c0 01             	add    $0x1,%eax
+  8009b9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009bc:	39 f0                	cmp    %esi,%eax
+  8009be:	74 14                	je     8009d4 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009c0:	0f b6 08             	movzbl (%eax),%ecx
+  8009c3:	0f b6 1a             	movzbl (%edx),%ebx
+  8009c6:	38 d9                	cmp    %bl,%cl
+  8009c8:	74 ec                	je     8009b6 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009ca:	0f b6 c1             	movzbl %cl,%eax
+  8009cd:	0f b6 db             	movzbl %bl,%ebx
+  8009d0:	29 d8                	sub    %ebx,%eax
+  8009d2:	eb 05                	jmp    8009d9 <memcmp+0x35>
+	}
+
+	return 0;
+  8009d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009d9:	5b                   	pop    %ebx
+  8009da:	5e                   	pop    %esi
+  8009db:	5d                   	pop    %ebp
+  8009dc:	c3                   	ret
+
+008009dd <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009dd:	55                   	push   %ebp
+  8009de:	89 e5                	mov    %esp,%ebp
+  8009e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009e6:	89 c2                	mov    %eax,%edx
+  8009e8:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009eb:	eb 03                	jmp    8009f0 <memfind+0x13>
+  8009ed:	83 c0 01             	add    $0x1,%eax
+  8009f0:	39 d0                	cmp    %edx,%eax
+  8009f2:	73 04                	jae    8009f8 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009f4:	38 08                	cmp    %cl,(%eax)
+  8009f6:	75 f5                	jne    8009ed <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009f8:	5d                   	pop    %ebp
+  8009f9:	c3                   	ret
+
+008009fa <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009fa:	55                   	push   %ebp
+  8009fb:	89 e5                	mov    %esp,%ebp
+  8009fd:	57                   	push   %edi
+  8009fe:	56                   	push   %esi
+  8009ff:	53                   	push   %ebx
+  800a00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a06:	eb 03                	jmp    800a0b <strtol+0x11>
+		s++;
+  800a08:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a0b:	0f b6 02             	movzbl (%edx),%eax
+  800a0e:	3c 20                	cmp    $0x20,%al
+  800a10:	74 f6                	je     800a08 <strtol+0xe>
+  800a12:	3c 09                	cmp    $0x9,%al
+  800a14:	74 f2                	je     800a08 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a16:	3c 2b                	cmp    $0x2b,%al
+  800a18:	74 2a                	je     800a44 <strtol+0x4a>
+	int neg = 0;
+  800a1a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a1f:	3c 2d                	cmp    $0x2d,%al
+  800a21:	74 2b                	je     800a4e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a23:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a29:	75 0f                	jne    800a3a <strtol+0x40>
+  800a2b:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a2e:	74 28                	je     800a58 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a30:	85 db                	test   %ebx,%ebx
+  800a32:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a37:	0f 44 d8             	cmove  %eax,%ebx
+  800a3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a3f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a42:	eb 46                	jmp    800a8a <strtol+0x90>
+		s++;
+  800a44:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a47:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a4c:	eb d5                	jmp    800a23 <strtol+0x29>
+		s++, neg = 1;
+  800a4e:	83 c2 01             	add    $0x1,%edx
+  800a51:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a56:	eb cb                	jmp    800a23 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a58:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a5c:	74 0e                	je     800a6c <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a5e:	85 db                	test   %ebx,%ebx
+  800a60:	75 d8                	jne    800a3a <strtol+0x40>
+		s++, base = 8;
+  800a62:	83 c2 01             	add    $0x1,%edx
+  800a65:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a6a:	eb ce                	jmp    800a3a <strtol+0x40>
+		s += 2, base = 16;
+  800a6c:	83 c2 02             	add    $0x2,%edx
+  800a6f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a74:	eb c4                	jmp    800a3a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a76:	0f be c0             	movsbl %al,%eax
+  800a79:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a7c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a7f:	7d 3a                	jge    800abb <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a81:	83 c2 01             	add    $0x1,%edx
+  800a84:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a88:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a8a:	0f b6 02             	movzbl (%edx),%eax
+  800a8d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a90:	89 f3                	mov    %esi,%ebx
+  800a92:	80 fb 09             	cmp    $0x9,%bl
+  800a95:	76 df                	jbe    800a76 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a97:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a9a:	89 f3                	mov    %esi,%ebx
+  800a9c:	80 fb 19             	cmp    $0x19,%bl
+  800a9f:	77 08                	ja     800aa9 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800aa1:	0f be c0             	movsbl %al,%eax
+  800aa4:	83 e8 57             	sub    $0x57,%eax
+  800aa7:	eb d3                	jmp    800a7c <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800aa9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aac:	89 f3                	mov    %esi,%ebx
+  800aae:	80 fb 19             	cmp    $0x19,%bl
+  800ab1:	77 08                	ja     800abb <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ab3:	0f be c0             	movsbl %al,%eax
+  800ab6:	83 e8 37             	sub    $0x37,%eax
+  800ab9:	eb c1                	jmp    800a7c <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800abb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800abf:	74 05                	je     800ac6 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ac1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ac4:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ac6:	89 c8                	mov    %ecx,%eax
+  800ac8:	f7 d8                	neg    %eax
+  800aca:	85 ff                	test   %edi,%edi
+  800acc:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800acf:	89 c8                	mov    %ecx,%eax
+  800ad1:	5b                   	pop    %ebx
+  800ad2:	5e                   	pop    %esi
+  800ad3:	5f                   	pop    %edi
+  800ad4:	5d                   	pop    %ebp
+  800ad5:	c3                   	ret
+
+00800ad6 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ad6:	55                   	push   %ebp
+  800ad7:	89 e5                	mov    %esp,%ebp
+  800ad9:	57                   	push   %edi
+  800ada:	56                   	push   %esi
+  800adb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800adc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae7:	89 c3                	mov    %eax,%ebx
+  800ae9:	89 c7                	mov    %eax,%edi
+  800aeb:	55                   	push   %ebp
+  800aec:	89 e5                	mov    %esp,%ebp
+  800aee:	8d 35 f6 0a 80 00    	lea    0x800af6,%esi
+  800af4:	0f 34                	sysenter
+  800af6:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800af7:	5b                   	pop    %ebx
+  800af8:	5e                   	pop    %esi
+  800af9:	5f                   	pop    %edi
+  800afa:	5d                   	pop    %ebp
+  800afb:	c3                   	ret
+
+00800afc <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800afc:	55                   	push   %ebp
+  800afd:	89 e5                	mov    %esp,%ebp
+  800aff:	57                   	push   %edi
+  800b00:	56                   	push   %esi
+  800b01:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b02:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b07:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b0c:	89 d1                	mov    %edx,%ecx
+  800b0e:	89 d3                	mov    %edx,%ebx
+  800b10:	89 d7                	mov    %edx,%edi
+  800b12:	55                   	push   %ebp
+  800b13:	89 e5                	mov    %esp,%ebp
+  800b15:	8d 35 1d 0b 80 00    	lea    0x800b1d,%esi
+  800b1b:	0f 34                	sysenter
+  800b1d:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800b1e:	5b                   	pop    %ebx
+  800b1f:	5e                   	pop    %esi
+  800b20:	5f                   	pop    %edi
+  800b21:	5d                   	pop    %ebp
+  800b22:	c3                   	ret
+
+00800b23 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b23:	55                   	push   %ebp
+  800b24:	89 e5                	mov    %esp,%ebp
+  800b26:	57                   	push   %edi
+  800b27:	56                   	push   %esi
+  800b28:	53                   	push   %ebx
+  800b29:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b34:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b39:	89 cb                	mov    %ecx,%ebx
+  800b3b:	89 cf                	mov    %ecx,%edi
+  800b3d:	55                   	push   %ebp
+  800b3e:	89 e5                	mov    %esp,%ebp
+  800b40:	8d 35 48 0b 80 00    	lea    0x800b48,%esi
+  800b46:	0f 34                	sysenter
+  800b48:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b49:	85 c0                	test   %eax,%eax
+  800b4b:	7f 08                	jg     800b55 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800b4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b50:	5b                   	pop    %ebx
+  800b51:	5e                   	pop    %esi
+  800b52:	5f                   	pop    %edi
+  800b53:	5d                   	pop    %ebp
+  800b54:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b55:	83 ec 0c             	sub    $0xc,%esp
+  800b58:	50                   	push   %eax
+  800b59:	6a 03                	push   $0x3
+  800b5b:	68 27 3b 80 00       	push   $0x803b27
+  800b60:	6a 3d                	push   $0x3d
+  800b62:	68 44 3b 80 00       	push   $0x803b44
+  800b67:	e8 fa 28 00 00       	call   803466 <_panic>
+
+00800b6c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b6c:	55                   	push   %ebp
+  800b6d:	89 e5                	mov    %esp,%ebp
+  800b6f:	57                   	push   %edi
+  800b70:	56                   	push   %esi
+  800b71:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b72:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b77:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b7c:	89 d1                	mov    %edx,%ecx
+  800b7e:	89 d3                	mov    %edx,%ebx
+  800b80:	89 d7                	mov    %edx,%edi
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	8d 35 8d 0b 80 00    	lea    0x800b8d,%esi
+  800b8b:	0f 34                	sysenter
+  800b8d:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800b8e:	5b                   	pop    %ebx
+  800b8f:	5e                   	pop    %esi
+  800b90:	5f                   	pop    %edi
+  800b91:	5d                   	pop    %ebp
+  800b92:	c3                   	ret
+
+00800b93 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b93:	55                   	push   %ebp
+  800b94:	89 e5                	mov    %esp,%ebp
+  800b96:	57                   	push   %edi
+  800b97:	56                   	push   %esi
+  800b98:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b99:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b9e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ba3:	89 d1                	mov    %edx,%ecx
+  800ba5:	89 d3                	mov    %edx,%ebx
+  800ba7:	89 d7                	mov    %edx,%edi
+  800ba9:	89 d6                	mov    %edx,%esi
+  800bab:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bad:	5b                   	pop    %ebx
+  800bae:	5e                   	pop    %esi
+  800baf:	5f                   	pop    %edi
+  800bb0:	5d                   	pop    %ebp
+  800bb1:	c3                   	ret
+
+00800bb2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bb2:	55                   	push   %ebp
+  800bb3:	89 e5                	mov    %esp,%ebp
+  800bb5:	57                   	push   %edi
+  800bb6:	56                   	push   %esi
+  800bb7:	53                   	push   %ebx
+  800bb8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800bbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bcb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	8d 35 d9 0b 80 00    	lea    0x800bd9,%esi
+  800bd7:	0f 34                	sysenter
+  800bd9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bda:	85 c0                	test   %eax,%eax
+  800bdc:	7f 08                	jg     800be6 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800bde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be1:	5b                   	pop    %ebx
+  800be2:	5e                   	pop    %esi
+  800be3:	5f                   	pop    %edi
+  800be4:	5d                   	pop    %ebp
+  800be5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800be6:	83 ec 0c             	sub    $0xc,%esp
+  800be9:	50                   	push   %eax
+  800bea:	6a 04                	push   $0x4
+  800bec:	68 27 3b 80 00       	push   $0x803b27
+  800bf1:	6a 3d                	push   $0x3d
+  800bf3:	68 44 3b 80 00       	push   $0x803b44
+  800bf8:	e8 69 28 00 00       	call   803466 <_panic>
+
+00800bfd <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	57                   	push   %edi
+  800c01:	56                   	push   %esi
+  800c02:	53                   	push   %ebx
+  800c03:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c0c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c14:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c17:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c1a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c1c:	85 c0                	test   %eax,%eax
+  800c1e:	7f 08                	jg     800c28 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c23:	5b                   	pop    %ebx
+  800c24:	5e                   	pop    %esi
+  800c25:	5f                   	pop    %edi
+  800c26:	5d                   	pop    %ebp
+  800c27:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c28:	83 ec 0c             	sub    $0xc,%esp
+  800c2b:	50                   	push   %eax
+  800c2c:	6a 05                	push   $0x5
+  800c2e:	68 27 3b 80 00       	push   $0x803b27
+  800c33:	6a 23                	push   $0x23
+  800c35:	68 44 3b 80 00       	push   $0x803b44
+  800c3a:	e8 27 28 00 00       	call   803466 <_panic>
+
+00800c3f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c3f:	55                   	push   %ebp
+  800c40:	89 e5                	mov    %esp,%ebp
+  800c42:	57                   	push   %edi
+  800c43:	56                   	push   %esi
+  800c44:	53                   	push   %ebx
+  800c45:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c53:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c58:	89 df                	mov    %ebx,%edi
+  800c5a:	55                   	push   %ebp
+  800c5b:	89 e5                	mov    %esp,%ebp
+  800c5d:	8d 35 65 0c 80 00    	lea    0x800c65,%esi
+  800c63:	0f 34                	sysenter
+  800c65:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c66:	85 c0                	test   %eax,%eax
+  800c68:	7f 08                	jg     800c72 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800c6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6d:	5b                   	pop    %ebx
+  800c6e:	5e                   	pop    %esi
+  800c6f:	5f                   	pop    %edi
+  800c70:	5d                   	pop    %ebp
+  800c71:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c72:	83 ec 0c             	sub    $0xc,%esp
+  800c75:	50                   	push   %eax
+  800c76:	6a 06                	push   $0x6
+  800c78:	68 27 3b 80 00       	push   $0x803b27
+  800c7d:	6a 3d                	push   $0x3d
+  800c7f:	68 44 3b 80 00       	push   $0x803b44
+  800c84:	e8 dd 27 00 00       	call   803466 <_panic>
+
+00800c89 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	57                   	push   %edi
+  800c8d:	56                   	push   %esi
+  800c8e:	53                   	push   %ebx
+  800c8f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ca2:	89 df                	mov    %ebx,%edi
+  800ca4:	55                   	push   %ebp
+  800ca5:	89 e5                	mov    %esp,%ebp
+  800ca7:	8d 35 af 0c 80 00    	lea    0x800caf,%esi
+  800cad:	0f 34                	sysenter
+  800caf:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cb0:	85 c0                	test   %eax,%eax
+  800cb2:	7f 08                	jg     800cbc <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800cb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb7:	5b                   	pop    %ebx
+  800cb8:	5e                   	pop    %esi
+  800cb9:	5f                   	pop    %edi
+  800cba:	5d                   	pop    %ebp
+  800cbb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cbc:	83 ec 0c             	sub    $0xc,%esp
+  800cbf:	50                   	push   %eax
+  800cc0:	6a 08                	push   $0x8
+  800cc2:	68 27 3b 80 00       	push   $0x803b27
+  800cc7:	6a 3d                	push   $0x3d
+  800cc9:	68 44 3b 80 00       	push   $0x803b44
+  800cce:	e8 93 27 00 00       	call   803466 <_panic>
+
+00800cd3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800cd3:	55                   	push   %ebp
+  800cd4:	89 e5                	mov    %esp,%ebp
+  800cd6:	57                   	push   %edi
+  800cd7:	56                   	push   %esi
+  800cd8:	53                   	push   %ebx
+  800cd9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cdc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce7:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cec:	89 df                	mov    %ebx,%edi
+  800cee:	55                   	push   %ebp
+  800cef:	89 e5                	mov    %esp,%ebp
+  800cf1:	8d 35 f9 0c 80 00    	lea    0x800cf9,%esi
+  800cf7:	0f 34                	sysenter
+  800cf9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cfa:	85 c0                	test   %eax,%eax
+  800cfc:	7f 08                	jg     800d06 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800cfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d01:	5b                   	pop    %ebx
+  800d02:	5e                   	pop    %esi
+  800d03:	5f                   	pop    %edi
+  800d04:	5d                   	pop    %ebp
+  800d05:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d06:	83 ec 0c             	sub    $0xc,%esp
+  800d09:	50                   	push   %eax
+  800d0a:	6a 09                	push   $0x9
+  800d0c:	68 27 3b 80 00       	push   $0x803b27
+  800d11:	6a 3d                	push   $0x3d
+  800d13:	68 44 3b 80 00       	push   $0x803b44
+  800d18:	e8 49 27 00 00       	call   803466 <_panic>
+
+00800d1d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d1d:	55                   	push   %ebp
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	57                   	push   %edi
+  800d21:	56                   	push   %esi
+  800d22:	53                   	push   %ebx
+  800d23:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d31:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d36:	89 df                	mov    %ebx,%edi
+  800d38:	55                   	push   %ebp
+  800d39:	89 e5                	mov    %esp,%ebp
+  800d3b:	8d 35 43 0d 80 00    	lea    0x800d43,%esi
+  800d41:	0f 34                	sysenter
+  800d43:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d44:	85 c0                	test   %eax,%eax
+  800d46:	7f 08                	jg     800d50 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800d48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4b:	5b                   	pop    %ebx
+  800d4c:	5e                   	pop    %esi
+  800d4d:	5f                   	pop    %edi
+  800d4e:	5d                   	pop    %ebp
+  800d4f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d50:	83 ec 0c             	sub    $0xc,%esp
+  800d53:	50                   	push   %eax
+  800d54:	6a 0a                	push   $0xa
+  800d56:	68 27 3b 80 00       	push   $0x803b27
+  800d5b:	6a 3d                	push   $0x3d
+  800d5d:	68 44 3b 80 00       	push   $0x803b44
+  800d62:	e8 ff 26 00 00       	call   803466 <_panic>
+
+00800d67 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800d67:	55                   	push   %ebp
+  800d68:	89 e5                	mov    %esp,%ebp
+  800d6a:	57                   	push   %edi
+  800d6b:	56                   	push   %esi
+  800d6c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d73:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d78:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d7e:	55                   	push   %ebp
+  800d7f:	89 e5                	mov    %esp,%ebp
+  800d81:	8d 35 89 0d 80 00    	lea    0x800d89,%esi
+  800d87:	0f 34                	sysenter
+  800d89:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800d8a:	5b                   	pop    %ebx
+  800d8b:	5e                   	pop    %esi
+  800d8c:	5f                   	pop    %edi
+  800d8d:	5d                   	pop    %ebp
+  800d8e:	c3                   	ret
+
+00800d8f <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800d8f:	55                   	push   %ebp
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	57                   	push   %edi
+  800d93:	56                   	push   %esi
+  800d94:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9b:	b8 17 00 00 00       	mov    $0x17,%eax
+  800da0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800da6:	55                   	push   %ebp
+  800da7:	89 e5                	mov    %esp,%ebp
+  800da9:	8d 35 b1 0d 80 00    	lea    0x800db1,%esi
+  800daf:	0f 34                	sysenter
+  800db1:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800db2:	5b                   	pop    %ebx
+  800db3:	5e                   	pop    %esi
+  800db4:	5f                   	pop    %edi
+  800db5:	5d                   	pop    %ebp
+  800db6:	c3                   	ret
+
+00800db7 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800db7:	55                   	push   %ebp
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	57                   	push   %edi
+  800dbb:	56                   	push   %esi
+  800dbc:	53                   	push   %ebx
+  800dbd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc0:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800dd0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd3:	89 f7                	mov    %esi,%edi
+  800dd5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dd7:	85 c0                	test   %eax,%eax
+  800dd9:	7f 08                	jg     800de3 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800ddb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dde:	5b                   	pop    %ebx
+  800ddf:	5e                   	pop    %esi
+  800de0:	5f                   	pop    %edi
+  800de1:	5d                   	pop    %ebp
+  800de2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de3:	83 ec 0c             	sub    $0xc,%esp
+  800de6:	50                   	push   %eax
+  800de7:	6a 0d                	push   $0xd
+  800de9:	68 27 3b 80 00       	push   $0x803b27
+  800dee:	6a 23                	push   $0x23
+  800df0:	68 44 3b 80 00       	push   $0x803b44
+  800df5:	e8 6c 26 00 00       	call   803466 <_panic>
+
+00800dfa <sys_ipc_recv>:
+{
+  800dfa:	55                   	push   %ebp
+  800dfb:	89 e5                	mov    %esp,%ebp
+  800dfd:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800e00:	6a 00                	push   $0x0
+  800e02:	6a 01                	push   $0x1
+  800e04:	ff 75 08             	push   0x8(%ebp)
+  800e07:	e8 ab ff ff ff       	call   800db7 <sys_ipc_recvv>
+}
+  800e0c:	c9                   	leave
+  800e0d:	c3                   	ret
+
+00800e0e <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800e0e:	55                   	push   %ebp
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	57                   	push   %edi
+  800e12:	56                   	push   %esi
+  800e13:	53                   	push   %ebx
+  800e14:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e22:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e27:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e2a:	89 de                	mov    %ebx,%esi
+  800e2c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e2e:	85 c0                	test   %eax,%eax
+  800e30:	7f 08                	jg     800e3a <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800e32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e35:	5b                   	pop    %ebx
+  800e36:	5e                   	pop    %esi
+  800e37:	5f                   	pop    %edi
+  800e38:	5d                   	pop    %ebp
+  800e39:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e3a:	83 ec 0c             	sub    $0xc,%esp
+  800e3d:	50                   	push   %eax
+  800e3e:	6a 0d                	push   $0xd
+  800e40:	68 27 3b 80 00       	push   $0x803b27
+  800e45:	6a 23                	push   $0x23
+  800e47:	68 44 3b 80 00       	push   $0x803b44
+  800e4c:	e8 15 26 00 00       	call   803466 <_panic>
+
+00800e51 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e51:	55                   	push   %ebp
+  800e52:	89 e5                	mov    %esp,%ebp
+  800e54:	57                   	push   %edi
+  800e55:	56                   	push   %esi
+  800e56:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e57:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e61:	89 d1                	mov    %edx,%ecx
+  800e63:	89 d3                	mov    %edx,%ebx
+  800e65:	89 d7                	mov    %edx,%edi
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	8d 35 72 0e 80 00    	lea    0x800e72,%esi
+  800e70:	0f 34                	sysenter
+  800e72:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800e73:	5b                   	pop    %ebx
+  800e74:	5e                   	pop    %esi
+  800e75:	5f                   	pop    %edi
+  800e76:	5d                   	pop    %ebp
+  800e77:	c3                   	ret
+
+00800e78 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800e78:	55                   	push   %ebp
+  800e79:	89 e5                	mov    %esp,%ebp
+  800e7b:	57                   	push   %edi
+  800e7c:	56                   	push   %esi
+  800e7d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e89:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e8e:	89 df                	mov    %ebx,%edi
+  800e90:	55                   	push   %ebp
+  800e91:	89 e5                	mov    %esp,%ebp
+  800e93:	8d 35 9b 0e 80 00    	lea    0x800e9b,%esi
+  800e99:	0f 34                	sysenter
+  800e9b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800e9c:	5b                   	pop    %ebx
+  800e9d:	5e                   	pop    %esi
+  800e9e:	5f                   	pop    %edi
+  800e9f:	5d                   	pop    %ebp
+  800ea0:	c3                   	ret
+
+00800ea1 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800ea1:	55                   	push   %ebp
+  800ea2:	89 e5                	mov    %esp,%ebp
+  800ea4:	57                   	push   %edi
+  800ea5:	56                   	push   %esi
+  800ea6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ea7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eaf:	b8 10 00 00 00       	mov    $0x10,%eax
+  800eb4:	89 cb                	mov    %ecx,%ebx
+  800eb6:	89 cf                	mov    %ecx,%edi
+  800eb8:	55                   	push   %ebp
+  800eb9:	89 e5                	mov    %esp,%ebp
+  800ebb:	8d 35 c3 0e 80 00    	lea    0x800ec3,%esi
+  800ec1:	0f 34                	sysenter
+  800ec3:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800ec4:	5b                   	pop    %ebx
+  800ec5:	5e                   	pop    %esi
+  800ec6:	5f                   	pop    %edi
+  800ec7:	5d                   	pop    %ebp
+  800ec8:	c3                   	ret
+
+00800ec9 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800ec9:	55                   	push   %ebp
+  800eca:	89 e5                	mov    %esp,%ebp
+  800ecc:	57                   	push   %edi
+  800ecd:	56                   	push   %esi
+  800ece:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ecf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eda:	b8 12 00 00 00       	mov    $0x12,%eax
+  800edf:	89 df                	mov    %ebx,%edi
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	8d 35 ec 0e 80 00    	lea    0x800eec,%esi
+  800eea:	0f 34                	sysenter
+  800eec:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800eed:	5b                   	pop    %ebx
+  800eee:	5e                   	pop    %esi
+  800eef:	5f                   	pop    %edi
+  800ef0:	5d                   	pop    %ebp
+  800ef1:	c3                   	ret
+
+00800ef2 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800ef2:	55                   	push   %ebp
+  800ef3:	89 e5                	mov    %esp,%ebp
+  800ef5:	57                   	push   %edi
+  800ef6:	56                   	push   %esi
+  800ef7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ef8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f03:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f08:	89 df                	mov    %ebx,%edi
+  800f0a:	55                   	push   %ebp
+  800f0b:	89 e5                	mov    %esp,%ebp
+  800f0d:	8d 35 15 0f 80 00    	lea    0x800f15,%esi
+  800f13:	0f 34                	sysenter
+  800f15:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800f16:	5b                   	pop    %ebx
+  800f17:	5e                   	pop    %esi
+  800f18:	5f                   	pop    %edi
+  800f19:	5d                   	pop    %ebp
+  800f1a:	c3                   	ret
+
+00800f1b <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800f1b:	55                   	push   %ebp
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	57                   	push   %edi
+  800f1f:	56                   	push   %esi
+  800f20:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f27:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f32:	55                   	push   %ebp
+  800f33:	89 e5                	mov    %esp,%ebp
+  800f35:	8d 35 3d 0f 80 00    	lea    0x800f3d,%esi
+  800f3b:	0f 34                	sysenter
+  800f3d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800f3e:	5b                   	pop    %ebx
+  800f3f:	5e                   	pop    %esi
+  800f40:	5f                   	pop    %edi
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+
+00800f43 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800f43:	55                   	push   %ebp
+  800f44:	89 e5                	mov    %esp,%ebp
+  800f46:	57                   	push   %edi
+  800f47:	56                   	push   %esi
+  800f48:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f51:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f56:	89 cb                	mov    %ecx,%ebx
+  800f58:	89 cf                	mov    %ecx,%edi
+  800f5a:	89 ce                	mov    %ecx,%esi
+  800f5c:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800f5e:	5b                   	pop    %ebx
+  800f5f:	5e                   	pop    %esi
+  800f60:	5f                   	pop    %edi
+  800f61:	5d                   	pop    %ebp
+  800f62:	c3                   	ret
+
+00800f63 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800f63:	55                   	push   %ebp
+  800f64:	89 e5                	mov    %esp,%ebp
+  800f66:	57                   	push   %edi
+  800f67:	56                   	push   %esi
+  800f68:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f71:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f76:	89 cb                	mov    %ecx,%ebx
+  800f78:	89 cf                	mov    %ecx,%edi
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	8d 35 85 0f 80 00    	lea    0x800f85,%esi
+  800f83:	0f 34                	sysenter
+  800f85:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800f86:	5b                   	pop    %ebx
+  800f87:	5e                   	pop    %esi
+  800f88:	5f                   	pop    %edi
+  800f89:	5d                   	pop    %ebp
+  800f8a:	c3                   	ret
+
+00800f8b <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800f8b:	55                   	push   %ebp
+  800f8c:	89 e5                	mov    %esp,%ebp
+  800f8e:	57                   	push   %edi
+  800f8f:	56                   	push   %esi
+  800f90:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f91:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f9e:	89 cb                	mov    %ecx,%ebx
+  800fa0:	89 cf                	mov    %ecx,%edi
+  800fa2:	55                   	push   %ebp
+  800fa3:	89 e5                	mov    %esp,%ebp
+  800fa5:	8d 35 ad 0f 80 00    	lea    0x800fad,%esi
+  800fab:	0f 34                	sysenter
+  800fad:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800fae:	5b                   	pop    %ebx
+  800faf:	5e                   	pop    %esi
+  800fb0:	5f                   	pop    %edi
+  800fb1:	5d                   	pop    %ebp
+  800fb2:	c3                   	ret
+
+00800fb3 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  800fb3:	55                   	push   %ebp
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	57                   	push   %edi
+  800fb7:	56                   	push   %esi
+  800fb8:	53                   	push   %ebx
+  800fb9:	83 ec 20             	sub    $0x20,%esp
+  800fbc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800fbf:	89 d7                	mov    %edx,%edi
+  800fc1:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  800fc3:	51                   	push   %ecx
+  800fc4:	68 00 f0 7f 00       	push   $0x7ff000
+  800fc9:	6a 00                	push   $0x0
+  800fcb:	e8 e2 fb ff ff       	call   800bb2 <sys_page_alloc>
+  800fd0:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  800fd2:	83 c4 10             	add    $0x10,%esp
+  800fd5:	85 c0                	test   %eax,%eax
+  800fd7:	78 45                	js     80101e <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  800fd9:	83 ec 04             	sub    $0x4,%esp
+  800fdc:	68 00 10 00 00       	push   $0x1000
+  800fe1:	57                   	push   %edi
+  800fe2:	68 00 f0 7f 00       	push   $0x7ff000
+  800fe7:	e8 40 f9 ff ff       	call   80092c <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  800fec:	89 34 24             	mov    %esi,(%esp)
+  800fef:	57                   	push   %edi
+  800ff0:	ff 75 e4             	push   -0x1c(%ebp)
+  800ff3:	68 00 f0 7f 00       	push   $0x7ff000
+  800ff8:	6a 00                	push   $0x0
+  800ffa:	e8 fe fb ff ff       	call   800bfd <sys_page_map>
+  800fff:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801001:	83 c4 20             	add    $0x20,%esp
+  801004:	85 c0                	test   %eax,%eax
+  801006:	78 16                	js     80101e <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801008:	83 ec 08             	sub    $0x8,%esp
+  80100b:	68 00 f0 7f 00       	push   $0x7ff000
+  801010:	6a 00                	push   $0x0
+  801012:	e8 28 fc ff ff       	call   800c3f <sys_page_unmap>
+  801017:	83 c4 10             	add    $0x10,%esp
+  80101a:	85 c0                	test   %eax,%eax
+  80101c:	75 0a                	jne    801028 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  80101e:	89 d8                	mov    %ebx,%eax
+  801020:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801023:	5b                   	pop    %ebx
+  801024:	5e                   	pop    %esi
+  801025:	5f                   	pop    %edi
+  801026:	5d                   	pop    %ebp
+  801027:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801028:	68 54 3b 80 00       	push   $0x803b54
+  80102d:	68 cc 3b 80 00       	push   $0x803bcc
+  801032:	6a 1b                	push   $0x1b
+  801034:	68 e1 3b 80 00       	push   $0x803be1
+  801039:	e8 28 24 00 00       	call   803466 <_panic>
+
+0080103e <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80103e:	55                   	push   %ebp
+  80103f:	89 e5                	mov    %esp,%ebp
+  801041:	53                   	push   %ebx
+  801042:	83 ec 04             	sub    $0x4,%esp
+  801045:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  801048:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80104a:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  80104e:	74 21                	je     801071 <pgfault+0x33>
+  801050:	89 d0                	mov    %edx,%eax
+  801052:	c1 e8 16             	shr    $0x16,%eax
+  801055:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80105c:	a8 01                	test   $0x1,%al
+  80105e:	74 11                	je     801071 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  801060:	89 d0                	mov    %edx,%eax
+  801062:	c1 e8 0c             	shr    $0xc,%eax
+  801065:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80106c:	f6 c4 08             	test   $0x8,%ah
+  80106f:	75 17                	jne    801088 <pgfault+0x4a>
+		if (pgfault_next) {
+  801071:	a1 04 50 80 00       	mov    0x805004,%eax
+  801076:	85 c0                	test   %eax,%eax
+  801078:	74 27                	je     8010a1 <pgfault+0x63>
+			pgfault_next(utf);
+  80107a:	83 ec 0c             	sub    $0xc,%esp
+  80107d:	53                   	push   %ebx
+  80107e:	ff d0                	call   *%eax
+			return;
+  801080:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  801083:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801086:	c9                   	leave
+  801087:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  801088:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80108e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801093:	b8 00 00 00 00       	mov    $0x0,%eax
+  801098:	e8 16 ff ff ff       	call   800fb3 <copy_page_to>
+  80109d:	85 c0                	test   %eax,%eax
+  80109f:	79 e2                	jns    801083 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8010a1:	a1 00 50 80 00       	mov    0x805000,%eax
+  8010a6:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8010a9:	ff 73 28             	push   0x28(%ebx)
+  8010ac:	ff 33                	push   (%ebx)
+  8010ae:	50                   	push   %eax
+  8010af:	68 78 3b 80 00       	push   $0x803b78
+  8010b4:	e8 ff f0 ff ff       	call   8001b8 <cprintf>
+	sys_env_destroy(0);
+  8010b9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8010c0:	e8 5e fa ff ff       	call   800b23 <sys_env_destroy>
+  8010c5:	83 c4 10             	add    $0x10,%esp
+  8010c8:	eb b9                	jmp    801083 <pgfault+0x45>
+
+008010ca <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8010ca:	55                   	push   %ebp
+  8010cb:	89 e5                	mov    %esp,%ebp
+  8010cd:	53                   	push   %ebx
+  8010ce:	83 ec 04             	sub    $0x4,%esp
+  8010d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8010d4:	a1 04 90 80 00       	mov    0x809004,%eax
+  8010d9:	3d 3e 10 80 00       	cmp    $0x80103e,%eax
+  8010de:	74 15                	je     8010f5 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8010e0:	a3 04 50 80 00       	mov    %eax,0x805004
+		set_pgfault_handler(pgfault);
+  8010e5:	83 ec 0c             	sub    $0xc,%esp
+  8010e8:	68 3e 10 80 00       	push   $0x80103e
+  8010ed:	e8 ba 23 00 00       	call   8034ac <set_pgfault_handler>
+  8010f2:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8010f5:	83 ec 0c             	sub    $0xc,%esp
+  8010f8:	68 05 08 00 00       	push   $0x805
+  8010fd:	53                   	push   %ebx
+  8010fe:	6a 00                	push   $0x0
+  801100:	53                   	push   %ebx
+  801101:	6a 00                	push   $0x0
+  801103:	e8 f5 fa ff ff       	call   800bfd <sys_page_map>
+}
+  801108:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80110b:	c9                   	leave
+  80110c:	c3                   	ret
+
+0080110d <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80110d:	55                   	push   %ebp
+  80110e:	89 e5                	mov    %esp,%ebp
+  801110:	57                   	push   %edi
+  801111:	56                   	push   %esi
+  801112:	53                   	push   %ebx
+  801113:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801116:	68 3e 10 80 00       	push   $0x80103e
+  80111b:	e8 8c 23 00 00       	call   8034ac <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801120:	b8 07 00 00 00       	mov    $0x7,%eax
+  801125:	cd 30                	int    $0x30
+  801127:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80112a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  80112d:	83 c4 10             	add    $0x10,%esp
+  801130:	85 c0                	test   %eax,%eax
+  801132:	0f 88 6b 01 00 00    	js     8012a3 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801138:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  80113d:	75 37                	jne    801176 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80113f:	e8 28 fa ff ff       	call   800b6c <sys_getenvid>
+  801144:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801149:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80114f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801154:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  801159:	e9 45 01 00 00       	jmp    8012a3 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  80115e:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801164:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80116a:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801170:	0f 87 ba 00 00 00    	ja     801230 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  801176:	89 d8                	mov    %ebx,%eax
+  801178:	c1 e8 16             	shr    $0x16,%eax
+  80117b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801182:	a8 01                	test   $0x1,%al
+  801184:	74 d8                	je     80115e <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  801186:	89 d8                	mov    %ebx,%eax
+  801188:	c1 e8 0c             	shr    $0xc,%eax
+  80118b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801192:	f6 c2 01             	test   $0x1,%dl
+  801195:	74 cd                	je     801164 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  801197:	89 da                	mov    %ebx,%edx
+  801199:	80 e6 df             	and    $0xdf,%dh
+  80119c:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8011a2:	74 c0                	je     801164 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8011a4:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8011a6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011ad:	f6 c6 04             	test   $0x4,%dh
+  8011b0:	75 53                	jne    801205 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8011b2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8011b9:	f6 c6 08             	test   $0x8,%dh
+  8011bc:	75 0c                	jne    8011ca <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8011be:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011c5:	f6 c2 02             	test   $0x2,%dl
+  8011c8:	74 3b                	je     801205 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8011ca:	83 ec 0c             	sub    $0xc,%esp
+  8011cd:	68 05 08 00 00       	push   $0x805
+  8011d2:	57                   	push   %edi
+  8011d3:	ff 75 e4             	push   -0x1c(%ebp)
+  8011d6:	57                   	push   %edi
+  8011d7:	6a 00                	push   $0x0
+  8011d9:	e8 1f fa ff ff       	call   800bfd <sys_page_map>
+  8011de:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8011e0:	83 c4 20             	add    $0x20,%esp
+  8011e3:	85 c0                	test   %eax,%eax
+  8011e5:	0f 88 a7 00 00 00    	js     801292 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8011eb:	83 ec 0c             	sub    $0xc,%esp
+  8011ee:	68 05 08 00 00       	push   $0x805
+  8011f3:	57                   	push   %edi
+  8011f4:	6a 00                	push   $0x0
+  8011f6:	57                   	push   %edi
+  8011f7:	6a 00                	push   $0x0
+  8011f9:	e8 ff f9 ff ff       	call   800bfd <sys_page_map>
+  8011fe:	89 c6                	mov    %eax,%esi
+	return r;
+  801200:	83 c4 20             	add    $0x20,%esp
+  801203:	eb 21                	jmp    801226 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  801205:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80120c:	83 ec 0c             	sub    $0xc,%esp
+  80120f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801214:	50                   	push   %eax
+  801215:	57                   	push   %edi
+  801216:	ff 75 e4             	push   -0x1c(%ebp)
+  801219:	57                   	push   %edi
+  80121a:	6a 00                	push   $0x0
+  80121c:	e8 dc f9 ff ff       	call   800bfd <sys_page_map>
+  801221:	89 c6                	mov    %eax,%esi
+  801223:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  801226:	85 f6                	test   %esi,%esi
+  801228:	0f 89 36 ff ff ff    	jns    801164 <fork+0x57>
+  80122e:	eb 62                	jmp    801292 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801230:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801235:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  80123a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80123d:	89 f8                	mov    %edi,%eax
+  80123f:	e8 6f fd ff ff       	call   800fb3 <copy_page_to>
+  801244:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801246:	85 c0                	test   %eax,%eax
+  801248:	78 48                	js     801292 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80124a:	83 ec 04             	sub    $0x4,%esp
+  80124d:	6a 07                	push   $0x7
+  80124f:	68 00 f0 bf ee       	push   $0xeebff000
+  801254:	57                   	push   %edi
+  801255:	e8 58 f9 ff ff       	call   800bb2 <sys_page_alloc>
+  80125a:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80125c:	83 c4 10             	add    $0x10,%esp
+  80125f:	85 c0                	test   %eax,%eax
+  801261:	78 2f                	js     801292 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801263:	a1 00 50 80 00       	mov    0x805000,%eax
+  801268:	8b 40 64             	mov    0x64(%eax),%eax
+  80126b:	83 ec 08             	sub    $0x8,%esp
+  80126e:	50                   	push   %eax
+  80126f:	57                   	push   %edi
+  801270:	e8 a8 fa ff ff       	call   800d1d <sys_env_set_pgfault_upcall>
+  801275:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801277:	83 c4 10             	add    $0x10,%esp
+  80127a:	85 c0                	test   %eax,%eax
+  80127c:	78 14                	js     801292 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80127e:	83 ec 08             	sub    $0x8,%esp
+  801281:	6a 02                	push   $0x2
+  801283:	57                   	push   %edi
+  801284:	e8 00 fa ff ff       	call   800c89 <sys_env_set_status>
+  801289:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80128b:	83 c4 10             	add    $0x10,%esp
+  80128e:	85 c0                	test   %eax,%eax
+  801290:	79 11                	jns    8012a3 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  801292:	83 ec 0c             	sub    $0xc,%esp
+  801295:	ff 75 e0             	push   -0x20(%ebp)
+  801298:	e8 86 f8 ff ff       	call   800b23 <sys_env_destroy>
+	return r;
+  80129d:	83 c4 10             	add    $0x10,%esp
+  8012a0:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8012a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a9:	5b                   	pop    %ebx
+  8012aa:	5e                   	pop    %esi
+  8012ab:	5f                   	pop    %edi
+  8012ac:	5d                   	pop    %ebp
+  8012ad:	c3                   	ret
+
+008012ae <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8012ae:	55                   	push   %ebp
+  8012af:	89 e5                	mov    %esp,%ebp
+  8012b1:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8012b4:	68 ec 3b 80 00       	push   $0x803bec
+  8012b9:	68 bf 00 00 00       	push   $0xbf
+  8012be:	68 e1 3b 80 00       	push   $0x803be1
+  8012c3:	e8 9e 21 00 00       	call   803466 <_panic>
+
+008012c8 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8012c8:	55                   	push   %ebp
+  8012c9:	89 e5                	mov    %esp,%ebp
+  8012cb:	56                   	push   %esi
+  8012cc:	53                   	push   %ebx
+  8012cd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8012d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8012d6:	85 c0                	test   %eax,%eax
+  8012d8:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8012dd:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8012e0:	83 ec 0c             	sub    $0xc,%esp
+  8012e3:	50                   	push   %eax
+  8012e4:	e8 11 fb ff ff       	call   800dfa <sys_ipc_recv>
+	if (from_env_store)
+  8012e9:	83 c4 10             	add    $0x10,%esp
+  8012ec:	85 f6                	test   %esi,%esi
+  8012ee:	74 14                	je     801304 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8012f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f5:	85 c0                	test   %eax,%eax
+  8012f7:	75 09                	jne    801302 <ipc_recv+0x3a>
+  8012f9:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8012ff:	8b 52 74             	mov    0x74(%edx),%edx
+  801302:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  801304:	85 db                	test   %ebx,%ebx
+  801306:	74 25                	je     80132d <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801308:	85 c0                	test   %eax,%eax
+  80130a:	74 0d                	je     801319 <ipc_recv+0x51>
+  80130c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  801312:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801315:	5b                   	pop    %ebx
+  801316:	5e                   	pop    %esi
+  801317:	5d                   	pop    %ebp
+  801318:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801319:	a1 00 50 80 00       	mov    0x805000,%eax
+  80131e:	8b 40 78             	mov    0x78(%eax),%eax
+  801321:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  801323:	a1 00 50 80 00       	mov    0x805000,%eax
+  801328:	8b 40 70             	mov    0x70(%eax),%eax
+  80132b:	eb e5                	jmp    801312 <ipc_recv+0x4a>
+  80132d:	85 c0                	test   %eax,%eax
+  80132f:	75 e1                	jne    801312 <ipc_recv+0x4a>
+  801331:	eb f0                	jmp    801323 <ipc_recv+0x5b>
+
+00801333 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801333:	55                   	push   %ebp
+  801334:	89 e5                	mov    %esp,%ebp
+  801336:	57                   	push   %edi
+  801337:	56                   	push   %esi
+  801338:	53                   	push   %ebx
+  801339:	83 ec 0c             	sub    $0xc,%esp
+  80133c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80133f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801342:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801345:	85 db                	test   %ebx,%ebx
+  801347:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80134c:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80134f:	ff 75 14             	push   0x14(%ebp)
+  801352:	53                   	push   %ebx
+  801353:	56                   	push   %esi
+  801354:	57                   	push   %edi
+  801355:	e8 0d fa ff ff       	call   800d67 <sys_ipc_try_send>
+  80135a:	83 c4 10             	add    $0x10,%esp
+  80135d:	85 c0                	test   %eax,%eax
+  80135f:	74 22                	je     801383 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  801361:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801364:	75 07                	jne    80136d <ipc_send+0x3a>
+		sys_yield();
+  801366:	e8 28 f8 ff ff       	call   800b93 <sys_yield>
+  80136b:	eb e2                	jmp    80134f <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80136d:	68 02 3c 80 00       	push   $0x803c02
+  801372:	68 cc 3b 80 00       	push   $0x803bcc
+  801377:	6a 39                	push   $0x39
+  801379:	68 17 3c 80 00       	push   $0x803c17
+  80137e:	e8 e3 20 00 00       	call   803466 <_panic>
+	}
+}
+  801383:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801386:	5b                   	pop    %ebx
+  801387:	5e                   	pop    %esi
+  801388:	5f                   	pop    %edi
+  801389:	5d                   	pop    %ebp
+  80138a:	c3                   	ret
+
+0080138b <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80138b:	55                   	push   %ebp
+  80138c:	89 e5                	mov    %esp,%ebp
+  80138e:	57                   	push   %edi
+  80138f:	56                   	push   %esi
+  801390:	53                   	push   %ebx
+  801391:	83 ec 10             	sub    $0x10,%esp
+  801394:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801397:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80139a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80139d:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8013a0:	85 c0                	test   %eax,%eax
+  8013a2:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8013a7:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8013aa:	6a 00                	push   $0x0
+  8013ac:	ff 33                	push   (%ebx)
+  8013ae:	50                   	push   %eax
+  8013af:	e8 03 fa ff ff       	call   800db7 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8013b4:	83 c4 10             	add    $0x10,%esp
+  8013b7:	85 c0                	test   %eax,%eax
+  8013b9:	75 3c                	jne    8013f7 <ipc_recvv+0x6c>
+  8013bb:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8013c1:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8013c4:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8013c6:	85 ff                	test   %edi,%edi
+  8013c8:	74 4e                	je     801418 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8013ca:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8013d0:	8b 52 74             	mov    0x74(%edx),%edx
+  8013d3:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8013d5:	85 f6                	test   %esi,%esi
+  8013d7:	74 18                	je     8013f1 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8013d9:	85 c0                	test   %eax,%eax
+  8013db:	75 2d                	jne    80140a <ipc_recvv+0x7f>
+  8013dd:	a1 00 50 80 00       	mov    0x805000,%eax
+  8013e2:	8b 40 78             	mov    0x78(%eax),%eax
+  8013e5:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8013e7:	a1 00 50 80 00       	mov    0x805000,%eax
+  8013ec:	8b 40 70             	mov    0x70(%eax),%eax
+  8013ef:	eb 1f                	jmp    801410 <ipc_recvv+0x85>
+  8013f1:	85 c0                	test   %eax,%eax
+  8013f3:	75 1b                	jne    801410 <ipc_recvv+0x85>
+  8013f5:	eb f0                	jmp    8013e7 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8013f7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8013fd:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  801402:	85 ff                	test   %edi,%edi
+  801404:	75 cd                	jne    8013d3 <ipc_recvv+0x48>
+	if (perm_store)
+  801406:	85 f6                	test   %esi,%esi
+  801408:	74 e7                	je     8013f1 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80140a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  801410:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801413:	5b                   	pop    %ebx
+  801414:	5e                   	pop    %esi
+  801415:	5f                   	pop    %edi
+  801416:	5d                   	pop    %ebp
+  801417:	c3                   	ret
+	if (perm_store)
+  801418:	85 f6                	test   %esi,%esi
+  80141a:	75 bd                	jne    8013d9 <ipc_recvv+0x4e>
+  80141c:	eb c9                	jmp    8013e7 <ipc_recvv+0x5c>
+
+0080141e <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  80141e:	55                   	push   %ebp
+  80141f:	89 e5                	mov    %esp,%ebp
+  801421:	57                   	push   %edi
+  801422:	56                   	push   %esi
+  801423:	53                   	push   %ebx
+  801424:	83 ec 0c             	sub    $0xc,%esp
+  801427:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80142a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80142d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  801430:	ff 75 14             	push   0x14(%ebp)
+  801433:	53                   	push   %ebx
+  801434:	56                   	push   %esi
+  801435:	57                   	push   %edi
+  801436:	e8 54 f9 ff ff       	call   800d8f <sys_ipc_try_sendv>
+  80143b:	83 c4 10             	add    $0x10,%esp
+  80143e:	85 c0                	test   %eax,%eax
+  801440:	74 22                	je     801464 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  801442:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801445:	75 07                	jne    80144e <ipc_sendv+0x30>
+		sys_yield();
+  801447:	e8 47 f7 ff ff       	call   800b93 <sys_yield>
+  80144c:	eb e2                	jmp    801430 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80144e:	68 02 3c 80 00       	push   $0x803c02
+  801453:	68 cc 3b 80 00       	push   $0x803bcc
+  801458:	6a 5c                	push   $0x5c
+  80145a:	68 17 3c 80 00       	push   $0x803c17
+  80145f:	e8 02 20 00 00       	call   803466 <_panic>
+	}
+}
+  801464:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801467:	5b                   	pop    %ebx
+  801468:	5e                   	pop    %esi
+  801469:	5f                   	pop    %edi
+  80146a:	5d                   	pop    %ebp
+  80146b:	c3                   	ret
+
+0080146c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80146c:	55                   	push   %ebp
+  80146d:	89 e5                	mov    %esp,%ebp
+  80146f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801472:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801477:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80147d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801483:	8b 52 50             	mov    0x50(%edx),%edx
+  801486:	39 ca                	cmp    %ecx,%edx
+  801488:	74 11                	je     80149b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80148a:	83 c0 01             	add    $0x1,%eax
+  80148d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801492:	75 e3                	jne    801477 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801494:	b8 00 00 00 00       	mov    $0x0,%eax
+  801499:	eb 0e                	jmp    8014a9 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80149b:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8014a1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8014a6:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8014a9:	5d                   	pop    %ebp
+  8014aa:	c3                   	ret
+
+008014ab <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014ab:	55                   	push   %ebp
+  8014ac:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014b1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014b6:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014b9:	5d                   	pop    %ebp
+  8014ba:	c3                   	ret
+
+008014bb <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014bb:	55                   	push   %ebp
+  8014bc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014c1:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8014c6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8014cb:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8014d0:	5d                   	pop    %ebp
+  8014d1:	c3                   	ret
+
+008014d2 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8014d2:	55                   	push   %ebp
+  8014d3:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8014d5:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8014da:	eb 02                	jmp    8014de <fd_alloc+0xc>
+  8014dc:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8014de:	89 c2                	mov    %eax,%edx
+  8014e0:	c1 ea 16             	shr    $0x16,%edx
+  8014e3:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8014ea:	f6 c2 01             	test   $0x1,%dl
+  8014ed:	74 2b                	je     80151a <fd_alloc+0x48>
+  8014ef:	89 c2                	mov    %eax,%edx
+  8014f1:	c1 ea 0c             	shr    $0xc,%edx
+  8014f4:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8014fb:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801501:	f6 c1 01             	test   $0x1,%cl
+  801504:	74 14                	je     80151a <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801506:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80150c:	75 ce                	jne    8014dc <fd_alloc+0xa>
+  80150e:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801513:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801518:	eb 05                	jmp    80151f <fd_alloc+0x4d>
+			return 0;
+  80151a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80151f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801522:	89 02                	mov    %eax,(%edx)
+}
+  801524:	89 c8                	mov    %ecx,%eax
+  801526:	5d                   	pop    %ebp
+  801527:	c3                   	ret
+
+00801528 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801528:	55                   	push   %ebp
+  801529:	89 e5                	mov    %esp,%ebp
+  80152b:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80152e:	83 f8 1f             	cmp    $0x1f,%eax
+  801531:	77 30                	ja     801563 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801533:	c1 e0 0c             	shl    $0xc,%eax
+  801536:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80153b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801541:	f6 c2 01             	test   $0x1,%dl
+  801544:	74 24                	je     80156a <fd_lookup+0x42>
+  801546:	89 c2                	mov    %eax,%edx
+  801548:	c1 ea 0c             	shr    $0xc,%edx
+  80154b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801552:	f6 c2 01             	test   $0x1,%dl
+  801555:	74 1a                	je     801571 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801557:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80155a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80155c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801561:	5d                   	pop    %ebp
+  801562:	c3                   	ret
+		return -E_INVAL;
+  801563:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801568:	eb f7                	jmp    801561 <fd_lookup+0x39>
+		return -E_INVAL;
+  80156a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80156f:	eb f0                	jmp    801561 <fd_lookup+0x39>
+  801571:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801576:	eb e9                	jmp    801561 <fd_lookup+0x39>
+
+00801578 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801578:	55                   	push   %ebp
+  801579:	89 e5                	mov    %esp,%ebp
+  80157b:	53                   	push   %ebx
+  80157c:	83 ec 04             	sub    $0x4,%esp
+  80157f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801582:	b8 00 00 00 00       	mov    $0x0,%eax
+  801587:	eb 03                	jmp    80158c <dev_lookup+0x14>
+  801589:	83 c0 01             	add    $0x1,%eax
+  80158c:	8b 1c 85 a0 3c 80 00 	mov    0x803ca0(,%eax,4),%ebx
+  801593:	85 db                	test   %ebx,%ebx
+  801595:	74 0b                	je     8015a2 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801597:	39 13                	cmp    %edx,(%ebx)
+  801599:	75 ee                	jne    801589 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80159b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a0:	eb 1f                	jmp    8015c1 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015a2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8015a7:	8b 40 48             	mov    0x48(%eax),%eax
+  8015aa:	83 ec 04             	sub    $0x4,%esp
+  8015ad:	52                   	push   %edx
+  8015ae:	50                   	push   %eax
+  8015af:	68 24 3c 80 00       	push   $0x803c24
+  8015b4:	e8 ff eb ff ff       	call   8001b8 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8015b9:	83 c4 10             	add    $0x10,%esp
+  8015bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8015c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015c4:	89 1a                	mov    %ebx,(%edx)
+}
+  8015c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015c9:	c9                   	leave
+  8015ca:	c3                   	ret
+
+008015cb <fd_close>:
+{
+  8015cb:	55                   	push   %ebp
+  8015cc:	89 e5                	mov    %esp,%ebp
+  8015ce:	57                   	push   %edi
+  8015cf:	56                   	push   %esi
+  8015d0:	53                   	push   %ebx
+  8015d1:	83 ec 24             	sub    $0x24,%esp
+  8015d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8015d7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015da:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015dd:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015de:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8015e4:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015e7:	50                   	push   %eax
+  8015e8:	e8 3b ff ff ff       	call   801528 <fd_lookup>
+  8015ed:	89 c3                	mov    %eax,%ebx
+  8015ef:	83 c4 10             	add    $0x10,%esp
+  8015f2:	85 c0                	test   %eax,%eax
+  8015f4:	78 05                	js     8015fb <fd_close+0x30>
+	    || fd != fd2)
+  8015f6:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8015f9:	74 16                	je     801611 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8015fb:	89 f8                	mov    %edi,%eax
+  8015fd:	84 c0                	test   %al,%al
+  8015ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801604:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801607:	89 d8                	mov    %ebx,%eax
+  801609:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160c:	5b                   	pop    %ebx
+  80160d:	5e                   	pop    %esi
+  80160e:	5f                   	pop    %edi
+  80160f:	5d                   	pop    %ebp
+  801610:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801611:	83 ec 08             	sub    $0x8,%esp
+  801614:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801617:	50                   	push   %eax
+  801618:	ff 36                	push   (%esi)
+  80161a:	e8 59 ff ff ff       	call   801578 <dev_lookup>
+  80161f:	89 c3                	mov    %eax,%ebx
+  801621:	83 c4 10             	add    $0x10,%esp
+  801624:	85 c0                	test   %eax,%eax
+  801626:	78 1a                	js     801642 <fd_close+0x77>
+		if (dev->dev_close)
+  801628:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80162b:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80162e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801633:	85 c0                	test   %eax,%eax
+  801635:	74 0b                	je     801642 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801637:	83 ec 0c             	sub    $0xc,%esp
+  80163a:	56                   	push   %esi
+  80163b:	ff d0                	call   *%eax
+  80163d:	89 c3                	mov    %eax,%ebx
+  80163f:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801642:	83 ec 08             	sub    $0x8,%esp
+  801645:	56                   	push   %esi
+  801646:	6a 00                	push   $0x0
+  801648:	e8 f2 f5 ff ff       	call   800c3f <sys_page_unmap>
+	return r;
+  80164d:	83 c4 10             	add    $0x10,%esp
+  801650:	eb b5                	jmp    801607 <fd_close+0x3c>
+
+00801652 <close>:
+
+int
+close(int fdnum)
+{
+  801652:	55                   	push   %ebp
+  801653:	89 e5                	mov    %esp,%ebp
+  801655:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801658:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80165b:	50                   	push   %eax
+  80165c:	ff 75 08             	push   0x8(%ebp)
+  80165f:	e8 c4 fe ff ff       	call   801528 <fd_lookup>
+  801664:	83 c4 10             	add    $0x10,%esp
+  801667:	85 c0                	test   %eax,%eax
+  801669:	79 02                	jns    80166d <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80166b:	c9                   	leave
+  80166c:	c3                   	ret
+		return fd_close(fd, 1);
+  80166d:	83 ec 08             	sub    $0x8,%esp
+  801670:	6a 01                	push   $0x1
+  801672:	ff 75 f4             	push   -0xc(%ebp)
+  801675:	e8 51 ff ff ff       	call   8015cb <fd_close>
+  80167a:	83 c4 10             	add    $0x10,%esp
+  80167d:	eb ec                	jmp    80166b <close+0x19>
+
+0080167f <close_all>:
+
+void
+close_all(void)
+{
+  80167f:	55                   	push   %ebp
+  801680:	89 e5                	mov    %esp,%ebp
+  801682:	53                   	push   %ebx
+  801683:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801686:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80168b:	83 ec 0c             	sub    $0xc,%esp
+  80168e:	53                   	push   %ebx
+  80168f:	e8 be ff ff ff       	call   801652 <close>
+	for (i = 0; i < MAXFD; i++)
+  801694:	83 c3 01             	add    $0x1,%ebx
+  801697:	83 c4 10             	add    $0x10,%esp
+  80169a:	83 fb 20             	cmp    $0x20,%ebx
+  80169d:	75 ec                	jne    80168b <close_all+0xc>
+}
+  80169f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016a2:	c9                   	leave
+  8016a3:	c3                   	ret
+
+008016a4 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016a4:	55                   	push   %ebp
+  8016a5:	89 e5                	mov    %esp,%ebp
+  8016a7:	57                   	push   %edi
+  8016a8:	56                   	push   %esi
+  8016a9:	53                   	push   %ebx
+  8016aa:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016ad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016b0:	50                   	push   %eax
+  8016b1:	ff 75 08             	push   0x8(%ebp)
+  8016b4:	e8 6f fe ff ff       	call   801528 <fd_lookup>
+  8016b9:	89 c3                	mov    %eax,%ebx
+  8016bb:	83 c4 10             	add    $0x10,%esp
+  8016be:	85 c0                	test   %eax,%eax
+  8016c0:	78 7f                	js     801741 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8016c2:	83 ec 0c             	sub    $0xc,%esp
+  8016c5:	ff 75 0c             	push   0xc(%ebp)
+  8016c8:	e8 85 ff ff ff       	call   801652 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8016cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8016d0:	c1 e6 0c             	shl    $0xc,%esi
+  8016d3:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8016d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8016dc:	89 3c 24             	mov    %edi,(%esp)
+  8016df:	e8 d7 fd ff ff       	call   8014bb <fd2data>
+  8016e4:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8016e6:	89 34 24             	mov    %esi,(%esp)
+  8016e9:	e8 cd fd ff ff       	call   8014bb <fd2data>
+  8016ee:	83 c4 10             	add    $0x10,%esp
+  8016f1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8016f4:	89 d8                	mov    %ebx,%eax
+  8016f6:	c1 e8 16             	shr    $0x16,%eax
+  8016f9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801700:	a8 01                	test   $0x1,%al
+  801702:	74 11                	je     801715 <dup+0x71>
+  801704:	89 d8                	mov    %ebx,%eax
+  801706:	c1 e8 0c             	shr    $0xc,%eax
+  801709:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801710:	f6 c2 01             	test   $0x1,%dl
+  801713:	75 36                	jne    80174b <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801715:	89 f8                	mov    %edi,%eax
+  801717:	c1 e8 0c             	shr    $0xc,%eax
+  80171a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801721:	83 ec 0c             	sub    $0xc,%esp
+  801724:	25 07 0e 00 00       	and    $0xe07,%eax
+  801729:	50                   	push   %eax
+  80172a:	56                   	push   %esi
+  80172b:	6a 00                	push   $0x0
+  80172d:	57                   	push   %edi
+  80172e:	6a 00                	push   $0x0
+  801730:	e8 c8 f4 ff ff       	call   800bfd <sys_page_map>
+  801735:	89 c3                	mov    %eax,%ebx
+  801737:	83 c4 20             	add    $0x20,%esp
+  80173a:	85 c0                	test   %eax,%eax
+  80173c:	78 33                	js     801771 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80173e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801741:	89 d8                	mov    %ebx,%eax
+  801743:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801746:	5b                   	pop    %ebx
+  801747:	5e                   	pop    %esi
+  801748:	5f                   	pop    %edi
+  801749:	5d                   	pop    %ebp
+  80174a:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80174b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801752:	83 ec 0c             	sub    $0xc,%esp
+  801755:	25 07 0e 00 00       	and    $0xe07,%eax
+  80175a:	50                   	push   %eax
+  80175b:	ff 75 d4             	push   -0x2c(%ebp)
+  80175e:	6a 00                	push   $0x0
+  801760:	53                   	push   %ebx
+  801761:	6a 00                	push   $0x0
+  801763:	e8 95 f4 ff ff       	call   800bfd <sys_page_map>
+  801768:	89 c3                	mov    %eax,%ebx
+  80176a:	83 c4 20             	add    $0x20,%esp
+  80176d:	85 c0                	test   %eax,%eax
+  80176f:	79 a4                	jns    801715 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801771:	83 ec 08             	sub    $0x8,%esp
+  801774:	56                   	push   %esi
+  801775:	6a 00                	push   $0x0
+  801777:	e8 c3 f4 ff ff       	call   800c3f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80177c:	83 c4 08             	add    $0x8,%esp
+  80177f:	ff 75 d4             	push   -0x2c(%ebp)
+  801782:	6a 00                	push   $0x0
+  801784:	e8 b6 f4 ff ff       	call   800c3f <sys_page_unmap>
+	return r;
+  801789:	83 c4 10             	add    $0x10,%esp
+  80178c:	eb b3                	jmp    801741 <dup+0x9d>
+
+0080178e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80178e:	55                   	push   %ebp
+  80178f:	89 e5                	mov    %esp,%ebp
+  801791:	56                   	push   %esi
+  801792:	53                   	push   %ebx
+  801793:	83 ec 18             	sub    $0x18,%esp
+  801796:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801799:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80179c:	50                   	push   %eax
+  80179d:	56                   	push   %esi
+  80179e:	e8 85 fd ff ff       	call   801528 <fd_lookup>
+  8017a3:	83 c4 10             	add    $0x10,%esp
+  8017a6:	85 c0                	test   %eax,%eax
+  8017a8:	78 3c                	js     8017e6 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017aa:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8017ad:	83 ec 08             	sub    $0x8,%esp
+  8017b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b3:	50                   	push   %eax
+  8017b4:	ff 33                	push   (%ebx)
+  8017b6:	e8 bd fd ff ff       	call   801578 <dev_lookup>
+  8017bb:	83 c4 10             	add    $0x10,%esp
+  8017be:	85 c0                	test   %eax,%eax
+  8017c0:	78 24                	js     8017e6 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8017c2:	8b 43 08             	mov    0x8(%ebx),%eax
+  8017c5:	83 e0 03             	and    $0x3,%eax
+  8017c8:	83 f8 01             	cmp    $0x1,%eax
+  8017cb:	74 20                	je     8017ed <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8017cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017d0:	8b 40 08             	mov    0x8(%eax),%eax
+  8017d3:	85 c0                	test   %eax,%eax
+  8017d5:	74 37                	je     80180e <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8017d7:	83 ec 04             	sub    $0x4,%esp
+  8017da:	ff 75 10             	push   0x10(%ebp)
+  8017dd:	ff 75 0c             	push   0xc(%ebp)
+  8017e0:	53                   	push   %ebx
+  8017e1:	ff d0                	call   *%eax
+  8017e3:	83 c4 10             	add    $0x10,%esp
+}
+  8017e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e9:	5b                   	pop    %ebx
+  8017ea:	5e                   	pop    %esi
+  8017eb:	5d                   	pop    %ebp
+  8017ec:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017ed:	a1 00 50 80 00       	mov    0x805000,%eax
+  8017f2:	8b 40 48             	mov    0x48(%eax),%eax
+  8017f5:	83 ec 04             	sub    $0x4,%esp
+  8017f8:	56                   	push   %esi
+  8017f9:	50                   	push   %eax
+  8017fa:	68 65 3c 80 00       	push   $0x803c65
+  8017ff:	e8 b4 e9 ff ff       	call   8001b8 <cprintf>
+		return -E_INVAL;
+  801804:	83 c4 10             	add    $0x10,%esp
+  801807:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80180c:	eb d8                	jmp    8017e6 <read+0x58>
+		return -E_NOT_SUPP;
+  80180e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801813:	eb d1                	jmp    8017e6 <read+0x58>
+
+00801815 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801815:	55                   	push   %ebp
+  801816:	89 e5                	mov    %esp,%ebp
+  801818:	57                   	push   %edi
+  801819:	56                   	push   %esi
+  80181a:	53                   	push   %ebx
+  80181b:	83 ec 0c             	sub    $0xc,%esp
+  80181e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801821:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801824:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801829:	eb 02                	jmp    80182d <readn+0x18>
+  80182b:	01 c3                	add    %eax,%ebx
+  80182d:	39 f3                	cmp    %esi,%ebx
+  80182f:	73 21                	jae    801852 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801831:	83 ec 04             	sub    $0x4,%esp
+  801834:	89 f0                	mov    %esi,%eax
+  801836:	29 d8                	sub    %ebx,%eax
+  801838:	50                   	push   %eax
+  801839:	89 d8                	mov    %ebx,%eax
+  80183b:	03 45 0c             	add    0xc(%ebp),%eax
+  80183e:	50                   	push   %eax
+  80183f:	57                   	push   %edi
+  801840:	e8 49 ff ff ff       	call   80178e <read>
+		if (m < 0)
+  801845:	83 c4 10             	add    $0x10,%esp
+  801848:	85 c0                	test   %eax,%eax
+  80184a:	78 04                	js     801850 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80184c:	75 dd                	jne    80182b <readn+0x16>
+  80184e:	eb 02                	jmp    801852 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801850:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801852:	89 d8                	mov    %ebx,%eax
+  801854:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801857:	5b                   	pop    %ebx
+  801858:	5e                   	pop    %esi
+  801859:	5f                   	pop    %edi
+  80185a:	5d                   	pop    %ebp
+  80185b:	c3                   	ret
+
+0080185c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80185c:	55                   	push   %ebp
+  80185d:	89 e5                	mov    %esp,%ebp
+  80185f:	56                   	push   %esi
+  801860:	53                   	push   %ebx
+  801861:	83 ec 18             	sub    $0x18,%esp
+  801864:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801867:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80186a:	50                   	push   %eax
+  80186b:	53                   	push   %ebx
+  80186c:	e8 b7 fc ff ff       	call   801528 <fd_lookup>
+  801871:	83 c4 10             	add    $0x10,%esp
+  801874:	85 c0                	test   %eax,%eax
+  801876:	78 37                	js     8018af <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801878:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80187b:	83 ec 08             	sub    $0x8,%esp
+  80187e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801881:	50                   	push   %eax
+  801882:	ff 36                	push   (%esi)
+  801884:	e8 ef fc ff ff       	call   801578 <dev_lookup>
+  801889:	83 c4 10             	add    $0x10,%esp
+  80188c:	85 c0                	test   %eax,%eax
+  80188e:	78 1f                	js     8018af <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801890:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801894:	74 20                	je     8018b6 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801896:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801899:	8b 40 0c             	mov    0xc(%eax),%eax
+  80189c:	85 c0                	test   %eax,%eax
+  80189e:	74 37                	je     8018d7 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8018a0:	83 ec 04             	sub    $0x4,%esp
+  8018a3:	ff 75 10             	push   0x10(%ebp)
+  8018a6:	ff 75 0c             	push   0xc(%ebp)
+  8018a9:	56                   	push   %esi
+  8018aa:	ff d0                	call   *%eax
+  8018ac:	83 c4 10             	add    $0x10,%esp
+}
+  8018af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b2:	5b                   	pop    %ebx
+  8018b3:	5e                   	pop    %esi
+  8018b4:	5d                   	pop    %ebp
+  8018b5:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018b6:	a1 00 50 80 00       	mov    0x805000,%eax
+  8018bb:	8b 40 48             	mov    0x48(%eax),%eax
+  8018be:	83 ec 04             	sub    $0x4,%esp
+  8018c1:	53                   	push   %ebx
+  8018c2:	50                   	push   %eax
+  8018c3:	68 81 3c 80 00       	push   $0x803c81
+  8018c8:	e8 eb e8 ff ff       	call   8001b8 <cprintf>
+		return -E_INVAL;
+  8018cd:	83 c4 10             	add    $0x10,%esp
+  8018d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018d5:	eb d8                	jmp    8018af <write+0x53>
+		return -E_NOT_SUPP;
+  8018d7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018dc:	eb d1                	jmp    8018af <write+0x53>
+
+008018de <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8018de:	55                   	push   %ebp
+  8018df:	89 e5                	mov    %esp,%ebp
+  8018e1:	53                   	push   %ebx
+  8018e2:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018e5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018e8:	50                   	push   %eax
+  8018e9:	ff 75 08             	push   0x8(%ebp)
+  8018ec:	e8 37 fc ff ff       	call   801528 <fd_lookup>
+  8018f1:	83 c4 10             	add    $0x10,%esp
+  8018f4:	85 c0                	test   %eax,%eax
+  8018f6:	78 3a                	js     801932 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018f8:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8018fb:	83 ec 08             	sub    $0x8,%esp
+  8018fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801901:	50                   	push   %eax
+  801902:	ff 33                	push   (%ebx)
+  801904:	e8 6f fc ff ff       	call   801578 <dev_lookup>
+  801909:	83 c4 10             	add    $0x10,%esp
+  80190c:	85 c0                	test   %eax,%eax
+  80190e:	78 22                	js     801932 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801910:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801913:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801916:	85 c0                	test   %eax,%eax
+  801918:	74 0d                	je     801927 <seek+0x49>
+  80191a:	83 ec 0c             	sub    $0xc,%esp
+  80191d:	53                   	push   %ebx
+  80191e:	ff d0                	call   *%eax
+  801920:	83 c4 10             	add    $0x10,%esp
+  801923:	85 c0                	test   %eax,%eax
+  801925:	78 0b                	js     801932 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801927:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80192a:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  80192d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801932:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801935:	c9                   	leave
+  801936:	c3                   	ret
+
+00801937 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801937:	55                   	push   %ebp
+  801938:	89 e5                	mov    %esp,%ebp
+  80193a:	53                   	push   %ebx
+  80193b:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80193e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801941:	50                   	push   %eax
+  801942:	ff 75 08             	push   0x8(%ebp)
+  801945:	e8 de fb ff ff       	call   801528 <fd_lookup>
+  80194a:	83 c4 10             	add    $0x10,%esp
+  80194d:	85 c0                	test   %eax,%eax
+  80194f:	78 2b                	js     80197c <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801951:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801954:	83 ec 08             	sub    $0x8,%esp
+  801957:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80195a:	50                   	push   %eax
+  80195b:	ff 33                	push   (%ebx)
+  80195d:	e8 16 fc ff ff       	call   801578 <dev_lookup>
+  801962:	83 c4 10             	add    $0x10,%esp
+  801965:	85 c0                	test   %eax,%eax
+  801967:	78 13                	js     80197c <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801969:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80196c:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80196f:	85 c0                	test   %eax,%eax
+  801971:	74 0e                	je     801981 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801973:	83 ec 0c             	sub    $0xc,%esp
+  801976:	53                   	push   %ebx
+  801977:	ff d0                	call   *%eax
+  801979:	83 c4 10             	add    $0x10,%esp
+}
+  80197c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80197f:	c9                   	leave
+  801980:	c3                   	ret
+		return 0;
+  801981:	b8 00 00 00 00       	mov    $0x0,%eax
+  801986:	eb f4                	jmp    80197c <fsync+0x45>
+
+00801988 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801988:	55                   	push   %ebp
+  801989:	89 e5                	mov    %esp,%ebp
+  80198b:	56                   	push   %esi
+  80198c:	53                   	push   %ebx
+  80198d:	83 ec 18             	sub    $0x18,%esp
+  801990:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801993:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801996:	50                   	push   %eax
+  801997:	53                   	push   %ebx
+  801998:	e8 8b fb ff ff       	call   801528 <fd_lookup>
+  80199d:	83 c4 10             	add    $0x10,%esp
+  8019a0:	85 c0                	test   %eax,%eax
+  8019a2:	78 34                	js     8019d8 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019a4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019a7:	83 ec 08             	sub    $0x8,%esp
+  8019aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ad:	50                   	push   %eax
+  8019ae:	ff 36                	push   (%esi)
+  8019b0:	e8 c3 fb ff ff       	call   801578 <dev_lookup>
+  8019b5:	83 c4 10             	add    $0x10,%esp
+  8019b8:	85 c0                	test   %eax,%eax
+  8019ba:	78 1c                	js     8019d8 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019bc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019c0:	74 1d                	je     8019df <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8019c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019c5:	8b 40 18             	mov    0x18(%eax),%eax
+  8019c8:	85 c0                	test   %eax,%eax
+  8019ca:	74 34                	je     801a00 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8019cc:	83 ec 08             	sub    $0x8,%esp
+  8019cf:	ff 75 0c             	push   0xc(%ebp)
+  8019d2:	56                   	push   %esi
+  8019d3:	ff d0                	call   *%eax
+  8019d5:	83 c4 10             	add    $0x10,%esp
+}
+  8019d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019db:	5b                   	pop    %ebx
+  8019dc:	5e                   	pop    %esi
+  8019dd:	5d                   	pop    %ebp
+  8019de:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8019df:	a1 00 50 80 00       	mov    0x805000,%eax
+  8019e4:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8019e7:	83 ec 04             	sub    $0x4,%esp
+  8019ea:	53                   	push   %ebx
+  8019eb:	50                   	push   %eax
+  8019ec:	68 44 3c 80 00       	push   $0x803c44
+  8019f1:	e8 c2 e7 ff ff       	call   8001b8 <cprintf>
+		return -E_INVAL;
+  8019f6:	83 c4 10             	add    $0x10,%esp
+  8019f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019fe:	eb d8                	jmp    8019d8 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a00:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a05:	eb d1                	jmp    8019d8 <ftruncate+0x50>
+
+00801a07 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a07:	55                   	push   %ebp
+  801a08:	89 e5                	mov    %esp,%ebp
+  801a0a:	56                   	push   %esi
+  801a0b:	53                   	push   %ebx
+  801a0c:	83 ec 18             	sub    $0x18,%esp
+  801a0f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a12:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a15:	50                   	push   %eax
+  801a16:	ff 75 08             	push   0x8(%ebp)
+  801a19:	e8 0a fb ff ff       	call   801528 <fd_lookup>
+  801a1e:	83 c4 10             	add    $0x10,%esp
+  801a21:	85 c0                	test   %eax,%eax
+  801a23:	78 49                	js     801a6e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a25:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a28:	83 ec 08             	sub    $0x8,%esp
+  801a2b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a2e:	50                   	push   %eax
+  801a2f:	ff 36                	push   (%esi)
+  801a31:	e8 42 fb ff ff       	call   801578 <dev_lookup>
+  801a36:	83 c4 10             	add    $0x10,%esp
+  801a39:	85 c0                	test   %eax,%eax
+  801a3b:	78 31                	js     801a6e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801a3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a40:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a44:	74 2f                	je     801a75 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a46:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a49:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a50:	00 00 00 
+	stat->st_isdir = 0;
+  801a53:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a5a:	00 00 00 
+	stat->st_dev = dev;
+  801a5d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a63:	83 ec 08             	sub    $0x8,%esp
+  801a66:	53                   	push   %ebx
+  801a67:	56                   	push   %esi
+  801a68:	ff 50 14             	call   *0x14(%eax)
+  801a6b:	83 c4 10             	add    $0x10,%esp
+}
+  801a6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a71:	5b                   	pop    %ebx
+  801a72:	5e                   	pop    %esi
+  801a73:	5d                   	pop    %ebp
+  801a74:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a75:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a7a:	eb f2                	jmp    801a6e <fstat+0x67>
+
+00801a7c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a7c:	55                   	push   %ebp
+  801a7d:	89 e5                	mov    %esp,%ebp
+  801a7f:	56                   	push   %esi
+  801a80:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801a81:	83 ec 08             	sub    $0x8,%esp
+  801a84:	68 00 10 00 00       	push   $0x1000
+  801a89:	ff 75 08             	push   0x8(%ebp)
+  801a8c:	e8 b3 07 00 00       	call   802244 <open>
+  801a91:	89 c3                	mov    %eax,%ebx
+  801a93:	83 c4 10             	add    $0x10,%esp
+  801a96:	85 c0                	test   %eax,%eax
+  801a98:	78 1b                	js     801ab5 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801a9a:	83 ec 08             	sub    $0x8,%esp
+  801a9d:	ff 75 0c             	push   0xc(%ebp)
+  801aa0:	50                   	push   %eax
+  801aa1:	e8 61 ff ff ff       	call   801a07 <fstat>
+  801aa6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801aa8:	89 1c 24             	mov    %ebx,(%esp)
+  801aab:	e8 a2 fb ff ff       	call   801652 <close>
+	return r;
+  801ab0:	83 c4 10             	add    $0x10,%esp
+  801ab3:	89 f3                	mov    %esi,%ebx
+}
+  801ab5:	89 d8                	mov    %ebx,%eax
+  801ab7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aba:	5b                   	pop    %ebx
+  801abb:	5e                   	pop    %esi
+  801abc:	5d                   	pop    %ebp
+  801abd:	c3                   	ret
+
+00801abe <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801abe:	55                   	push   %ebp
+  801abf:	89 e5                	mov    %esp,%ebp
+  801ac1:	57                   	push   %edi
+  801ac2:	56                   	push   %esi
+  801ac3:	53                   	push   %ebx
+  801ac4:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801aca:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801ad0:	89 d6                	mov    %edx,%esi
+  801ad2:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801ad8:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801adb:	89 d3                	mov    %edx,%ebx
+  801add:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801ae3:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801aea:	74 1d                	je     801b09 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801aec:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801af1:	83 c8 07             	or     $0x7,%eax
+  801af4:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801afa:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801aff:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801b05:	01 ce                	add    %ecx,%esi
+  801b07:	eb 28                	jmp    801b31 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b09:	83 ec 0c             	sub    $0xc,%esp
+  801b0c:	6a 01                	push   $0x1
+  801b0e:	e8 59 f9 ff ff       	call   80146c <ipc_find_env>
+  801b13:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801b18:	83 c4 10             	add    $0x10,%esp
+  801b1b:	eb cf                	jmp    801aec <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801b1d:	83 c0 01             	add    $0x1,%eax
+  801b20:	89 fa                	mov    %edi,%edx
+  801b22:	09 da                	or     %ebx,%edx
+  801b24:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801b2b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b31:	39 f3                	cmp    %esi,%ebx
+  801b33:	72 e8                	jb     801b1d <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801b35:	83 f8 41             	cmp    $0x41,%eax
+  801b38:	77 2f                	ja     801b69 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801b3a:	50                   	push   %eax
+  801b3b:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801b41:	50                   	push   %eax
+  801b42:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801b48:	ff 35 c8 70 80 00    	push   0x8070c8
+  801b4e:	e8 cb f8 ff ff       	call   80141e <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801b53:	83 c4 0c             	add    $0xc,%esp
+  801b56:	6a 00                	push   $0x0
+  801b58:	6a 00                	push   $0x0
+  801b5a:	6a 00                	push   $0x0
+  801b5c:	e8 67 f7 ff ff       	call   8012c8 <ipc_recv>
+}
+  801b61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b64:	5b                   	pop    %ebx
+  801b65:	5e                   	pop    %esi
+  801b66:	5f                   	pop    %edi
+  801b67:	5d                   	pop    %ebp
+  801b68:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801b69:	68 b4 3c 80 00       	push   $0x803cb4
+  801b6e:	68 cc 3b 80 00       	push   $0x803bcc
+  801b73:	6a 40                	push   $0x40
+  801b75:	68 d0 3c 80 00       	push   $0x803cd0
+  801b7a:	e8 e7 18 00 00       	call   803466 <_panic>
+
+00801b7f <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801b7f:	55                   	push   %ebp
+  801b80:	89 e5                	mov    %esp,%ebp
+  801b82:	57                   	push   %edi
+  801b83:	56                   	push   %esi
+  801b84:	53                   	push   %ebx
+  801b85:	83 ec 1c             	sub    $0x1c,%esp
+  801b88:	89 c3                	mov    %eax,%ebx
+  801b8a:	89 d6                	mov    %edx,%esi
+  801b8c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801b8f:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801b95:	89 ca                	mov    %ecx,%edx
+  801b97:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801b9a:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801ba1:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801ba4:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801bab:	8b 76 0c             	mov    0xc(%esi),%esi
+  801bae:	89 fb                	mov    %edi,%ebx
+  801bb0:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801bb7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801bba:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801bc1:	8b 75 08             	mov    0x8(%ebp),%esi
+  801bc4:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801bcb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bce:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801bd5:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801bd8:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801bdf:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801be4:	39 c8                	cmp    %ecx,%eax
+  801be6:	74 0d                	je     801bf5 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bf0:	5b                   	pop    %ebx
+  801bf1:	5e                   	pop    %esi
+  801bf2:	5f                   	pop    %edi
+  801bf3:	5d                   	pop    %ebp
+  801bf4:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801bf5:	6a 07                	push   $0x7
+  801bf7:	68 00 60 80 00       	push   $0x806000
+  801bfc:	6a 0d                	push   $0xd
+  801bfe:	ff 35 c8 70 80 00    	push   0x8070c8
+  801c04:	e8 2a f7 ff ff       	call   801333 <ipc_send>
+  801c09:	83 c4 10             	add    $0x10,%esp
+  801c0c:	eb da                	jmp    801be8 <fsring_post+0x69>
+
+00801c0e <fsipcv>:
+{
+  801c0e:	55                   	push   %ebp
+  801c0f:	89 e5                	mov    %esp,%ebp
+  801c11:	57                   	push   %edi
+  801c12:	56                   	push   %esi
+  801c13:	53                   	push   %ebx
+  801c14:	83 ec 0c             	sub    $0xc,%esp
+  801c17:	89 c7                	mov    %eax,%edi
+  801c19:	89 d3                	mov    %edx,%ebx
+  801c1b:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801c1d:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801c24:	74 26                	je     801c4c <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801c26:	6a 07                	push   $0x7
+  801c28:	68 00 60 80 00       	push   $0x806000
+  801c2d:	57                   	push   %edi
+  801c2e:	ff 35 c8 70 80 00    	push   0x8070c8
+  801c34:	e8 fa f6 ff ff       	call   801333 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801c39:	6a 00                	push   $0x0
+  801c3b:	56                   	push   %esi
+  801c3c:	53                   	push   %ebx
+  801c3d:	6a 00                	push   $0x0
+  801c3f:	e8 47 f7 ff ff       	call   80138b <ipc_recvv>
+}
+  801c44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c47:	5b                   	pop    %ebx
+  801c48:	5e                   	pop    %esi
+  801c49:	5f                   	pop    %edi
+  801c4a:	5d                   	pop    %ebp
+  801c4b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c4c:	83 ec 0c             	sub    $0xc,%esp
+  801c4f:	6a 01                	push   $0x1
+  801c51:	e8 16 f8 ff ff       	call   80146c <ipc_find_env>
+  801c56:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801c5b:	83 c4 10             	add    $0x10,%esp
+  801c5e:	eb c6                	jmp    801c26 <fsipcv+0x18>
+
+00801c60 <fsipc>:
+{
+  801c60:	55                   	push   %ebp
+  801c61:	89 e5                	mov    %esp,%ebp
+  801c63:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801c66:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801c6d:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801c70:	e8 99 ff ff ff       	call   801c0e <fsipcv>
+}
+  801c75:	c9                   	leave
+  801c76:	c3                   	ret
+
+00801c77 <file_write_direct>:
+{
+  801c77:	55                   	push   %ebp
+  801c78:	89 e5                	mov    %esp,%ebp
+  801c7a:	56                   	push   %esi
+  801c7b:	53                   	push   %ebx
+  801c7c:	89 c3                	mov    %eax,%ebx
+  801c7e:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801c80:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801c86:	77 40                	ja     801cc8 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801c88:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801c8d:	39 c8                	cmp    %ecx,%eax
+  801c8f:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c92:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801c95:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  801c9b:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801ca0:	83 ec 04             	sub    $0x4,%esp
+  801ca3:	50                   	push   %eax
+  801ca4:	52                   	push   %edx
+  801ca5:	68 08 60 80 00       	push   $0x806008
+  801caa:	e8 7d ec ff ff       	call   80092c <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801caf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cb4:	b8 04 00 00 00       	mov    $0x4,%eax
+  801cb9:	e8 a2 ff ff ff       	call   801c60 <fsipc>
+  801cbe:	83 c4 10             	add    $0x10,%esp
+}
+  801cc1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cc4:	5b                   	pop    %ebx
+  801cc5:	5e                   	pop    %esi
+  801cc6:	5d                   	pop    %ebp
+  801cc7:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801cc8:	89 d6                	mov    %edx,%esi
+  801cca:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801cd0:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801cd5:	29 f1                	sub    %esi,%ecx
+  801cd7:	39 c1                	cmp    %eax,%ecx
+  801cd9:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801cdc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801cdf:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801ce4:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801cea:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801cf0:	83 ec 0c             	sub    $0xc,%esp
+  801cf3:	6a 05                	push   $0x5
+  801cf5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801cfa:	e8 bf fd ff ff       	call   801abe <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801cff:	83 c4 10             	add    $0x10,%esp
+  801d02:	eb bd                	jmp    801cc1 <file_write_direct+0x4a>
+
+00801d04 <devfile_sync>:
+{
+  801d04:	55                   	push   %ebp
+  801d05:	89 e5                	mov    %esp,%ebp
+  801d07:	57                   	push   %edi
+  801d08:	56                   	push   %esi
+  801d09:	53                   	push   %ebx
+  801d0a:	83 ec 28             	sub    $0x28,%esp
+  801d0d:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801d10:	56                   	push   %esi
+  801d11:	e8 a5 f7 ff ff       	call   8014bb <fd2data>
+  801d16:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801d18:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801d1b:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801d22:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d25:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801d2a:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801d2e:	74 45                	je     801d75 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801d30:	8b 46 14             	mov    0x14(%esi),%eax
+  801d33:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801d36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d40:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801d43:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801d46:	39 cb                	cmp    %ecx,%ebx
+  801d48:	73 14                	jae    801d5e <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801d4a:	29 d9                	sub    %ebx,%ecx
+  801d4c:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801d4f:	89 f0                	mov    %esi,%eax
+  801d51:	e8 21 ff ff ff       	call   801c77 <file_write_direct>
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	7e 04                	jle    801d5e <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801d5a:	01 c3                	add    %eax,%ebx
+  801d5c:	eb e5                	jmp    801d43 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801d5e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d61:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801d68:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801d6b:	85 c0                	test   %eax,%eax
+  801d6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d72:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801d75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d78:	5b                   	pop    %ebx
+  801d79:	5e                   	pop    %esi
+  801d7a:	5f                   	pop    %edi
+  801d7b:	5d                   	pop    %ebp
+  801d7c:	c3                   	ret
+
+00801d7d <devfile_write>:
+{
+  801d7d:	55                   	push   %ebp
+  801d7e:	89 e5                	mov    %esp,%ebp
+  801d80:	57                   	push   %edi
+  801d81:	56                   	push   %esi
+  801d82:	53                   	push   %ebx
+  801d83:	83 ec 28             	sub    $0x28,%esp
+  801d86:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d89:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801d8c:	53                   	push   %ebx
+  801d8d:	e8 29 f7 ff ff       	call   8014bb <fd2data>
+  801d92:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801d95:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801d98:	83 c4 10             	add    $0x10,%esp
+  801d9b:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801d9f:	74 43                	je     801de4 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801da1:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801da8:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801dab:	85 c0                	test   %eax,%eax
+  801dad:	74 43                	je     801df2 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801daf:	89 c2                	mov    %eax,%edx
+  801db1:	03 53 14             	add    0x14(%ebx),%edx
+  801db4:	39 fa                	cmp    %edi,%edx
+  801db6:	75 0b                	jne    801dc3 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801db8:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801dbb:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801dc1:	76 66                	jbe    801e29 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801dc3:	83 ec 0c             	sub    $0xc,%esp
+  801dc6:	53                   	push   %ebx
+  801dc7:	e8 38 ff ff ff       	call   801d04 <devfile_sync>
+  801dcc:	83 c4 10             	add    $0x10,%esp
+  801dcf:	85 c0                	test   %eax,%eax
+  801dd1:	78 4e                	js     801e21 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801dd3:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801dd9:	77 56                	ja     801e31 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801ddb:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801dde:	85 c0                	test   %eax,%eax
+  801de0:	75 20                	jne    801e02 <devfile_write+0x85>
+  801de2:	eb 16                	jmp    801dfa <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801de4:	89 f1                	mov    %esi,%ecx
+  801de6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801de9:	89 d8                	mov    %ebx,%eax
+  801deb:	e8 87 fe ff ff       	call   801c77 <file_write_direct>
+  801df0:	eb 2f                	jmp    801e21 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801df2:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801df8:	77 37                	ja     801e31 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801dfa:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801e02:	83 ec 04             	sub    $0x4,%esp
+  801e05:	56                   	push   %esi
+  801e06:	ff 75 0c             	push   0xc(%ebp)
+  801e09:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e0c:	01 c1                	add    %eax,%ecx
+  801e0e:	51                   	push   %ecx
+  801e0f:	e8 18 eb ff ff       	call   80092c <memmove>
+	ff->buf_wlen += n;
+  801e14:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801e17:	01 f7                	add    %esi,%edi
+  801e19:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801e1c:	89 f0                	mov    %esi,%eax
+  801e1e:	83 c4 10             	add    $0x10,%esp
+}
+  801e21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e24:	5b                   	pop    %ebx
+  801e25:	5e                   	pop    %esi
+  801e26:	5f                   	pop    %edi
+  801e27:	5d                   	pop    %ebp
+  801e28:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801e29:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e2f:	76 d1                	jbe    801e02 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801e31:	89 f1                	mov    %esi,%ecx
+  801e33:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e36:	89 d8                	mov    %ebx,%eax
+  801e38:	e8 3a fe ff ff       	call   801c77 <file_write_direct>
+  801e3d:	eb e2                	jmp    801e21 <devfile_write+0xa4>
+
+00801e3f <devfile_trunc>:
+{
+  801e3f:	55                   	push   %ebp
+  801e40:	89 e5                	mov    %esp,%ebp
+  801e42:	53                   	push   %ebx
+  801e43:	83 ec 10             	sub    $0x10,%esp
+  801e46:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801e49:	53                   	push   %ebx
+  801e4a:	e8 b5 fe ff ff       	call   801d04 <devfile_sync>
+  801e4f:	83 c4 10             	add    $0x10,%esp
+  801e52:	85 c0                	test   %eax,%eax
+  801e54:	78 1f                	js     801e75 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e56:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801e59:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801e5e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e61:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e70:	e8 eb fd ff ff       	call   801c60 <fsipc>
+}
+  801e75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e78:	c9                   	leave
+  801e79:	c3                   	ret
+
+00801e7a <devfile_stat>:
+{
+  801e7a:	55                   	push   %ebp
+  801e7b:	89 e5                	mov    %esp,%ebp
+  801e7d:	56                   	push   %esi
+  801e7e:	53                   	push   %ebx
+  801e7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e82:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801e85:	83 ec 0c             	sub    $0xc,%esp
+  801e88:	53                   	push   %ebx
+  801e89:	e8 76 fe ff ff       	call   801d04 <devfile_sync>
+  801e8e:	83 c4 10             	add    $0x10,%esp
+  801e91:	85 c0                	test   %eax,%eax
+  801e93:	78 47                	js     801edc <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e95:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801e98:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea2:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ea7:	e8 b4 fd ff ff       	call   801c60 <fsipc>
+  801eac:	85 c0                	test   %eax,%eax
+  801eae:	78 2c                	js     801edc <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801eb0:	83 ec 08             	sub    $0x8,%esp
+  801eb3:	68 00 60 80 00       	push   $0x806000
+  801eb8:	56                   	push   %esi
+  801eb9:	e8 e8 e8 ff ff       	call   8007a6 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801ebe:	a1 80 60 80 00       	mov    0x806080,%eax
+  801ec3:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ec9:	a1 84 60 80 00       	mov    0x806084,%eax
+  801ece:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801ed4:	83 c4 10             	add    $0x10,%esp
+  801ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801edc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801edf:	5b                   	pop    %ebx
+  801ee0:	5e                   	pop    %esi
+  801ee1:	5d                   	pop    %ebp
+  801ee2:	c3                   	ret
+
+00801ee3 <devfile_flush>:
+{
+  801ee3:	55                   	push   %ebp
+  801ee4:	89 e5                	mov    %esp,%ebp
+  801ee6:	56                   	push   %esi
+  801ee7:	53                   	push   %ebx
+  801ee8:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801eeb:	83 ec 0c             	sub    $0xc,%esp
+  801eee:	56                   	push   %esi
+  801eef:	e8 10 fe ff ff       	call   801d04 <devfile_sync>
+  801ef4:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801ef6:	83 c4 10             	add    $0x10,%esp
+  801ef9:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801efd:	75 25                	jne    801f24 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801eff:	8b 46 0c             	mov    0xc(%esi),%eax
+  801f02:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801f07:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f0c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f11:	e8 4a fd ff ff       	call   801c60 <fsipc>
+  801f16:	85 c0                	test   %eax,%eax
+  801f18:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801f1b:	89 d8                	mov    %ebx,%eax
+  801f1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f20:	5b                   	pop    %ebx
+  801f21:	5e                   	pop    %esi
+  801f22:	5d                   	pop    %ebp
+  801f23:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801f24:	83 ec 0c             	sub    $0xc,%esp
+  801f27:	56                   	push   %esi
+  801f28:	e8 8e f5 ff ff       	call   8014bb <fd2data>
+  801f2d:	83 c4 08             	add    $0x8,%esp
+  801f30:	50                   	push   %eax
+  801f31:	6a 00                	push   $0x0
+  801f33:	e8 07 ed ff ff       	call   800c3f <sys_page_unmap>
+  801f38:	83 c4 10             	add    $0x10,%esp
+  801f3b:	eb c2                	jmp    801eff <devfile_flush+0x1c>
+
+00801f3d <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801f3d:	55                   	push   %ebp
+  801f3e:	89 e5                	mov    %esp,%ebp
+  801f40:	57                   	push   %edi
+  801f41:	56                   	push   %esi
+  801f42:	53                   	push   %ebx
+  801f43:	83 ec 64             	sub    $0x64,%esp
+  801f46:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801f48:	52                   	push   %edx
+  801f49:	50                   	push   %eax
+  801f4a:	e8 d9 f5 ff ff       	call   801528 <fd_lookup>
+  801f4f:	89 c1                	mov    %eax,%ecx
+  801f51:	83 c4 10             	add    $0x10,%esp
+  801f54:	85 c0                	test   %eax,%eax
+  801f56:	0f 88 f2 00 00 00    	js     80204e <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801f5c:	8b 07                	mov    (%edi),%eax
+  801f5e:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801f64:	39 10                	cmp    %edx,(%eax)
+  801f66:	0f 85 03 01 00 00    	jne    80206f <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801f6c:	a1 00 50 80 00       	mov    0x805000,%eax
+  801f71:	8b 40 48             	mov    0x48(%eax),%eax
+  801f74:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801f7a:	0f 84 96 00 00 00    	je     802016 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801f80:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801f87:	0f 84 cb 00 00 00    	je     802058 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801f8d:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801f92:	83 c8 07             	or     $0x7,%eax
+  801f95:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801f98:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801f9b:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801fa0:	83 ec 04             	sub    $0x4,%esp
+  801fa3:	68 07 04 00 00       	push   $0x407
+  801fa8:	53                   	push   %ebx
+  801fa9:	6a 00                	push   $0x0
+  801fab:	e8 02 ec ff ff       	call   800bb2 <sys_page_alloc>
+  801fb0:	89 c1                	mov    %eax,%ecx
+  801fb2:	83 c4 10             	add    $0x10,%esp
+  801fb5:	85 c0                	test   %eax,%eax
+  801fb7:	0f 88 91 00 00 00    	js     80204e <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801fbd:	89 d8                	mov    %ebx,%eax
+  801fbf:	83 c8 07             	or     $0x7,%eax
+  801fc2:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801fc4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801fca:	83 c6 04             	add    $0x4,%esi
+  801fcd:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801fd3:	75 cb                	jne    801fa0 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801fd5:	6a 12                	push   $0x12
+  801fd7:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801fda:	50                   	push   %eax
+  801fdb:	6a 0c                	push   $0xc
+  801fdd:	ff 35 c8 70 80 00    	push   0x8070c8
+  801fe3:	e8 36 f4 ff ff       	call   80141e <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801fe8:	83 c4 0c             	add    $0xc,%esp
+  801feb:	6a 00                	push   $0x0
+  801fed:	6a 00                	push   $0x0
+  801fef:	6a 00                	push   $0x0
+  801ff1:	e8 d2 f2 ff ff       	call   8012c8 <ipc_recv>
+  801ff6:	89 c1                	mov    %eax,%ecx
+  801ff8:	83 c4 10             	add    $0x10,%esp
+  801ffb:	85 c0                	test   %eax,%eax
+  801ffd:	78 4f                	js     80204e <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801fff:	a1 00 50 80 00       	mov    0x805000,%eax
+  802004:	8b 40 48             	mov    0x48(%eax),%eax
+  802007:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  80200c:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  802013:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  802016:	83 ec 0c             	sub    $0xc,%esp
+  802019:	ff 37                	push   (%edi)
+  80201b:	e8 e4 fc ff ff       	call   801d04 <devfile_sync>
+  802020:	89 c1                	mov    %eax,%ecx
+  802022:	83 c4 10             	add    $0x10,%esp
+  802025:	85 c0                	test   %eax,%eax
+  802027:	78 25                	js     80204e <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  802029:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  80202f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  802034:	ba 01 00 00 00       	mov    $0x1,%edx
+  802039:	89 d0                	mov    %edx,%eax
+  80203b:	d3 e0                	shl    %cl,%eax
+  80203d:	85 d8                	test   %ebx,%eax
+  80203f:	74 0d                	je     80204e <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802041:	83 c1 01             	add    $0x1,%ecx
+  802044:	83 f9 10             	cmp    $0x10,%ecx
+  802047:	75 f0                	jne    802039 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  802049:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  80204e:	89 c8                	mov    %ecx,%eax
+  802050:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802053:	5b                   	pop    %ebx
+  802054:	5e                   	pop    %esi
+  802055:	5f                   	pop    %edi
+  802056:	5d                   	pop    %ebp
+  802057:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802058:	83 ec 0c             	sub    $0xc,%esp
+  80205b:	6a 01                	push   $0x1
+  80205d:	e8 0a f4 ff ff       	call   80146c <ipc_find_env>
+  802062:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  802067:	83 c4 10             	add    $0x10,%esp
+  80206a:	e9 1e ff ff ff       	jmp    801f8d <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  80206f:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  802074:	eb d8                	jmp    80204e <fsring_slot+0x111>
+
+00802076 <file_read_direct>:
+{
+  802076:	55                   	push   %ebp
+  802077:	89 e5                	mov    %esp,%ebp
+  802079:	57                   	push   %edi
+  80207a:	56                   	push   %esi
+  80207b:	53                   	push   %ebx
+  80207c:	83 ec 1c             	sub    $0x1c,%esp
+  80207f:	89 c7                	mov    %eax,%edi
+  802081:	89 d6                	mov    %edx,%esi
+  802083:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  802085:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  80208b:	77 52                	ja     8020df <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80208d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802090:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802095:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80209b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020a5:	e8 b6 fb ff ff       	call   801c60 <fsipc>
+  8020aa:	89 c7                	mov    %eax,%edi
+  8020ac:	85 c0                	test   %eax,%eax
+  8020ae:	78 25                	js     8020d5 <file_read_direct+0x5f>
+	assert(r <= n);
+  8020b0:	39 c3                	cmp    %eax,%ebx
+  8020b2:	0f 82 87 00 00 00    	jb     80213f <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  8020b8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8020bd:	0f 8f 95 00 00 00    	jg     802158 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8020c3:	83 ec 04             	sub    $0x4,%esp
+  8020c6:	50                   	push   %eax
+  8020c7:	68 00 60 80 00       	push   $0x806000
+  8020cc:	56                   	push   %esi
+  8020cd:	e8 5a e8 ff ff       	call   80092c <memmove>
+	return r;
+  8020d2:	83 c4 10             	add    $0x10,%esp
+}
+  8020d5:	89 f8                	mov    %edi,%eax
+  8020d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020da:	5b                   	pop    %ebx
+  8020db:	5e                   	pop    %esi
+  8020dc:	5f                   	pop    %edi
+  8020dd:	5d                   	pop    %ebp
+  8020de:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8020df:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8020e5:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8020ea:	29 d1                	sub    %edx,%ecx
+  8020ec:	39 d9                	cmp    %ebx,%ecx
+  8020ee:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8020f1:	89 f0                	mov    %esi,%eax
+  8020f3:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8020f6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8020f9:	eb 0f                	jmp    80210a <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8020fb:	0f b6 10             	movzbl (%eax),%edx
+  8020fe:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802100:	05 00 10 00 00       	add    $0x1000,%eax
+  802105:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80210a:	39 c8                	cmp    %ecx,%eax
+  80210c:	72 ed                	jb     8020fb <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  80210e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802111:	8b 47 0c             	mov    0xc(%edi),%eax
+  802114:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  802119:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  80211f:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  802125:	83 ec 0c             	sub    $0xc,%esp
+  802128:	6a 07                	push   $0x7
+  80212a:	89 d9                	mov    %ebx,%ecx
+  80212c:	89 f2                	mov    %esi,%edx
+  80212e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802133:	e8 86 f9 ff ff       	call   801abe <fsipc_pages>
+  802138:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  80213a:	83 c4 10             	add    $0x10,%esp
+  80213d:	eb 96                	jmp    8020d5 <file_read_direct+0x5f>
+	assert(r <= n);
+  80213f:	68 db 3c 80 00       	push   $0x803cdb
+  802144:	68 cc 3b 80 00       	push   $0x803bcc
+  802149:	68 dc 00 00 00       	push   $0xdc
+  80214e:	68 d0 3c 80 00       	push   $0x803cd0
+  802153:	e8 0e 13 00 00       	call   803466 <_panic>
+	assert(r <= PGSIZE);
+  802158:	68 ec 3c 80 00       	push   $0x803cec
+  80215d:	68 cc 3b 80 00       	push   $0x803bcc
+  802162:	68 dd 00 00 00       	push   $0xdd
+  802167:	68 d0 3c 80 00       	push   $0x803cd0
+  80216c:	e8 f5 12 00 00       	call   803466 <_panic>
+
+00802171 <devfile_read>:
+{
+  802171:	55                   	push   %ebp
+  802172:	89 e5                	mov    %esp,%ebp
+  802174:	57                   	push   %edi
+  802175:	56                   	push   %esi
+  802176:	53                   	push   %ebx
+  802177:	83 ec 28             	sub    $0x28,%esp
+  80217a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80217d:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  802180:	53                   	push   %ebx
+  802181:	e8 35 f3 ff ff       	call   8014bb <fd2data>
+  802186:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  802189:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80218c:	83 c4 10             	add    $0x10,%esp
+  80218f:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  802193:	74 7d                	je     802212 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802195:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802199:	0f 85 81 00 00 00    	jne    802220 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  80219f:	8b 43 18             	mov    0x18(%ebx),%eax
+  8021a2:	85 c0                	test   %eax,%eax
+  8021a4:	74 0d                	je     8021b3 <devfile_read+0x42>
+  8021a6:	8b 53 14             	mov    0x14(%ebx),%edx
+  8021a9:	39 fa                	cmp    %edi,%edx
+  8021ab:	7f 06                	jg     8021b3 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8021ad:	01 c2                	add    %eax,%edx
+  8021af:	39 d7                	cmp    %edx,%edi
+  8021b1:	72 28                	jb     8021db <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8021b3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8021ba:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8021c0:	77 74                	ja     802236 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8021c2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021c7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8021ca:	89 d8                	mov    %ebx,%eax
+  8021cc:	e8 a5 fe ff ff       	call   802076 <file_read_direct>
+  8021d1:	85 c0                	test   %eax,%eax
+  8021d3:	7e 35                	jle    80220a <devfile_read+0x99>
+		ff->buf_base = pos;
+  8021d5:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8021d8:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8021db:	8b 53 14             	mov    0x14(%ebx),%edx
+  8021de:	89 d0                	mov    %edx,%eax
+  8021e0:	03 43 18             	add    0x18(%ebx),%eax
+  8021e3:	29 f8                	sub    %edi,%eax
+  8021e5:	39 f0                	cmp    %esi,%eax
+  8021e7:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8021ea:	83 ec 04             	sub    $0x4,%esp
+  8021ed:	56                   	push   %esi
+  8021ee:	89 f8                	mov    %edi,%eax
+  8021f0:	29 d0                	sub    %edx,%eax
+  8021f2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8021f5:	01 c1                	add    %eax,%ecx
+  8021f7:	51                   	push   %ecx
+  8021f8:	ff 75 0c             	push   0xc(%ebp)
+  8021fb:	e8 2c e7 ff ff       	call   80092c <memmove>
+	fd->fd_offset = pos + n;
+  802200:	01 f7                	add    %esi,%edi
+  802202:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802205:	89 f0                	mov    %esi,%eax
+  802207:	83 c4 10             	add    $0x10,%esp
+}
+  80220a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80220d:	5b                   	pop    %ebx
+  80220e:	5e                   	pop    %esi
+  80220f:	5f                   	pop    %edi
+  802210:	5d                   	pop    %ebp
+  802211:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802212:	89 f1                	mov    %esi,%ecx
+  802214:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802217:	89 d8                	mov    %ebx,%eax
+  802219:	e8 58 fe ff ff       	call   802076 <file_read_direct>
+  80221e:	eb ea                	jmp    80220a <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802220:	83 ec 0c             	sub    $0xc,%esp
+  802223:	53                   	push   %ebx
+  802224:	e8 db fa ff ff       	call   801d04 <devfile_sync>
+  802229:	83 c4 10             	add    $0x10,%esp
+  80222c:	85 c0                	test   %eax,%eax
+  80222e:	0f 89 6b ff ff ff    	jns    80219f <devfile_read+0x2e>
+  802234:	eb d4                	jmp    80220a <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  802236:	89 f1                	mov    %esi,%ecx
+  802238:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80223b:	89 d8                	mov    %ebx,%eax
+  80223d:	e8 34 fe ff ff       	call   802076 <file_read_direct>
+  802242:	eb c6                	jmp    80220a <devfile_read+0x99>
+
+00802244 <open>:
+{
+  802244:	55                   	push   %ebp
+  802245:	89 e5                	mov    %esp,%ebp
+  802247:	56                   	push   %esi
+  802248:	53                   	push   %ebx
+  802249:	83 ec 1c             	sub    $0x1c,%esp
+  80224c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80224f:	56                   	push   %esi
+  802250:	e8 16 e5 ff ff       	call   80076b <strlen>
+  802255:	83 c4 10             	add    $0x10,%esp
+  802258:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80225d:	0f 8f a0 00 00 00    	jg     802303 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  802263:	83 ec 0c             	sub    $0xc,%esp
+  802266:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802269:	50                   	push   %eax
+  80226a:	e8 63 f2 ff ff       	call   8014d2 <fd_alloc>
+  80226f:	89 c3                	mov    %eax,%ebx
+  802271:	83 c4 10             	add    $0x10,%esp
+  802274:	85 c0                	test   %eax,%eax
+  802276:	78 45                	js     8022bd <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  802278:	83 ec 08             	sub    $0x8,%esp
+  80227b:	56                   	push   %esi
+  80227c:	68 00 60 80 00       	push   $0x806000
+  802281:	e8 20 e5 ff ff       	call   8007a6 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802286:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802289:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80228e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802291:	b8 01 00 00 00       	mov    $0x1,%eax
+  802296:	e8 c5 f9 ff ff       	call   801c60 <fsipc>
+  80229b:	89 c3                	mov    %eax,%ebx
+  80229d:	83 c4 10             	add    $0x10,%esp
+  8022a0:	85 c0                	test   %eax,%eax
+  8022a2:	78 22                	js     8022c6 <open+0x82>
+	if (!(mode & O_NOBUF)
+  8022a4:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8022ab:	74 2b                	je     8022d8 <open+0x94>
+	return fd2num(fd);
+  8022ad:	83 ec 0c             	sub    $0xc,%esp
+  8022b0:	ff 75 f4             	push   -0xc(%ebp)
+  8022b3:	e8 f3 f1 ff ff       	call   8014ab <fd2num>
+  8022b8:	89 c3                	mov    %eax,%ebx
+  8022ba:	83 c4 10             	add    $0x10,%esp
+}
+  8022bd:	89 d8                	mov    %ebx,%eax
+  8022bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022c2:	5b                   	pop    %ebx
+  8022c3:	5e                   	pop    %esi
+  8022c4:	5d                   	pop    %ebp
+  8022c5:	c3                   	ret
+		fd_close(fd, 0);
+  8022c6:	83 ec 08             	sub    $0x8,%esp
+  8022c9:	6a 00                	push   $0x0
+  8022cb:	ff 75 f4             	push   -0xc(%ebp)
+  8022ce:	e8 f8 f2 ff ff       	call   8015cb <fd_close>
+		return r;
+  8022d3:	83 c4 10             	add    $0x10,%esp
+  8022d6:	eb e5                	jmp    8022bd <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8022d8:	83 ec 0c             	sub    $0xc,%esp
+  8022db:	ff 75 f4             	push   -0xc(%ebp)
+  8022de:	e8 d8 f1 ff ff       	call   8014bb <fd2data>
+  8022e3:	83 c4 0c             	add    $0xc,%esp
+  8022e6:	68 07 04 00 00       	push   $0x407
+  8022eb:	50                   	push   %eax
+  8022ec:	6a 00                	push   $0x0
+  8022ee:	e8 bf e8 ff ff       	call   800bb2 <sys_page_alloc>
+  8022f3:	83 c4 10             	add    $0x10,%esp
+  8022f6:	85 c0                	test   %eax,%eax
+  8022f8:	75 b3                	jne    8022ad <open+0x69>
+		fd->fd_file.buffered = 1;
+  8022fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022fd:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802301:	eb aa                	jmp    8022ad <open+0x69>
+		return -E_BAD_PATH;
+  802303:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802308:	eb b3                	jmp    8022bd <open+0x79>
+
+0080230a <readdir>:
+{
+  80230a:	55                   	push   %ebp
+  80230b:	89 e5                	mov    %esp,%ebp
+  80230d:	53                   	push   %ebx
+  80230e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802311:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802314:	50                   	push   %eax
+  802315:	ff 75 08             	push   0x8(%ebp)
+  802318:	e8 0b f2 ff ff       	call   801528 <fd_lookup>
+  80231d:	89 c3                	mov    %eax,%ebx
+  80231f:	83 c4 10             	add    $0x10,%esp
+  802322:	85 c0                	test   %eax,%eax
+  802324:	78 73                	js     802399 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802326:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802329:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80232f:	39 08                	cmp    %ecx,(%eax)
+  802331:	0f 85 82 00 00 00    	jne    8023b9 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802337:	83 ec 0c             	sub    $0xc,%esp
+  80233a:	50                   	push   %eax
+  80233b:	e8 c4 f9 ff ff       	call   801d04 <devfile_sync>
+  802340:	89 c3                	mov    %eax,%ebx
+  802342:	83 c4 10             	add    $0x10,%esp
+  802345:	85 c0                	test   %eax,%eax
+  802347:	78 50                	js     802399 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802349:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80234c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80234f:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  802354:	8b 45 10             	mov    0x10(%ebp),%eax
+  802357:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  80235c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80235f:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  802364:	ba 00 00 00 00       	mov    $0x0,%edx
+  802369:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80236e:	e8 ed f8 ff ff       	call   801c60 <fsipc>
+  802373:	89 c3                	mov    %eax,%ebx
+  802375:	85 c0                	test   %eax,%eax
+  802377:	7e 20                	jle    802399 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  802379:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80237c:	72 22                	jb     8023a0 <readdir+0x96>
+  80237e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802383:	7f 1b                	jg     8023a0 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802385:	83 ec 04             	sub    $0x4,%esp
+  802388:	50                   	push   %eax
+  802389:	68 00 60 80 00       	push   $0x806000
+  80238e:	ff 75 0c             	push   0xc(%ebp)
+  802391:	e8 96 e5 ff ff       	call   80092c <memmove>
+	return r;
+  802396:	83 c4 10             	add    $0x10,%esp
+}
+  802399:	89 d8                	mov    %ebx,%eax
+  80239b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80239e:	c9                   	leave
+  80239f:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8023a0:	68 e2 3c 80 00       	push   $0x803ce2
+  8023a5:	68 cc 3b 80 00       	push   $0x803bcc
+  8023aa:	68 86 01 00 00       	push   $0x186
+  8023af:	68 d0 3c 80 00       	push   $0x803cd0
+  8023b4:	e8 ad 10 00 00       	call   803466 <_panic>
+		return -E_NOT_SUPP;
+  8023b9:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8023be:	eb d9                	jmp    802399 <readdir+0x8f>
+
+008023c0 <munmap>:
+{
+  8023c0:	55                   	push   %ebp
+  8023c1:	89 e5                	mov    %esp,%ebp
+  8023c3:	56                   	push   %esi
+  8023c4:	53                   	push   %ebx
+  8023c5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8023c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8023cb:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8023d1:	75 41                	jne    802414 <munmap+0x54>
+  8023d3:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8023d9:	77 39                	ja     802414 <munmap+0x54>
+  8023db:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8023e0:	29 f0                	sub    %esi,%eax
+  8023e2:	39 d0                	cmp    %edx,%eax
+  8023e4:	72 35                	jb     80241b <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8023e6:	89 f3                	mov    %esi,%ebx
+  8023e8:	01 d6                	add    %edx,%esi
+  8023ea:	39 f3                	cmp    %esi,%ebx
+  8023ec:	73 1a                	jae    802408 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8023ee:	83 ec 08             	sub    $0x8,%esp
+  8023f1:	53                   	push   %ebx
+  8023f2:	6a 00                	push   $0x0
+  8023f4:	e8 46 e8 ff ff       	call   800c3f <sys_page_unmap>
+  8023f9:	83 c4 10             	add    $0x10,%esp
+  8023fc:	85 c0                	test   %eax,%eax
+  8023fe:	78 0d                	js     80240d <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802400:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802406:	eb e2                	jmp    8023ea <munmap+0x2a>
+	return 0;
+  802408:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80240d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802410:	5b                   	pop    %ebx
+  802411:	5e                   	pop    %esi
+  802412:	5d                   	pop    %ebp
+  802413:	c3                   	ret
+		return -E_INVAL;
+  802414:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802419:	eb f2                	jmp    80240d <munmap+0x4d>
+  80241b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802420:	eb eb                	jmp    80240d <munmap+0x4d>
+
+00802422 <mmap>:
+{
+  802422:	55                   	push   %ebp
+  802423:	89 e5                	mov    %esp,%ebp
+  802425:	57                   	push   %edi
+  802426:	56                   	push   %esi
+  802427:	53                   	push   %ebx
+  802428:	83 ec 34             	sub    $0x34,%esp
+  80242b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80242e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802431:	50                   	push   %eax
+  802432:	ff 75 18             	push   0x18(%ebp)
+  802435:	e8 ee f0 ff ff       	call   801528 <fd_lookup>
+  80243a:	89 c3                	mov    %eax,%ebx
+  80243c:	83 c4 10             	add    $0x10,%esp
+  80243f:	85 c0                	test   %eax,%eax
+  802441:	0f 88 0e 01 00 00    	js     802555 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802447:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80244a:	a1 20 40 80 00       	mov    0x804020,%eax
+  80244f:	39 02                	cmp    %eax,(%edx)
+  802451:	0f 85 50 01 00 00    	jne    8025a7 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802457:	8b 45 10             	mov    0x10(%ebp),%eax
+  80245a:	83 e0 02             	and    $0x2,%eax
+  80245d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802460:	74 0a                	je     80246c <mmap+0x4a>
+  802462:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802466:	0f 84 42 01 00 00    	je     8025ae <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  80246c:	8b 42 08             	mov    0x8(%edx),%eax
+  80246f:	83 e0 03             	and    $0x3,%eax
+  802472:	83 f8 01             	cmp    $0x1,%eax
+  802475:	0f 84 3a 01 00 00    	je     8025b5 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  80247b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80247e:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802481:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802486:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802489:	0f 85 2d 01 00 00    	jne    8025bc <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80248f:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802493:	0f 88 2a 01 00 00    	js     8025c3 <mmap+0x1a1>
+  802499:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8024a0:	0f 87 1d 01 00 00    	ja     8025c3 <mmap+0x1a1>
+  8024a6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8024ab:	2b 45 08             	sub    0x8(%ebp),%eax
+  8024ae:	39 f8                	cmp    %edi,%eax
+  8024b0:	0f 82 14 01 00 00    	jb     8025ca <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8024b6:	83 ec 0c             	sub    $0xc,%esp
+  8024b9:	52                   	push   %edx
+  8024ba:	e8 45 f8 ff ff       	call   801d04 <devfile_sync>
+  8024bf:	89 c3                	mov    %eax,%ebx
+  8024c1:	83 c4 10             	add    $0x10,%esp
+  8024c4:	85 c0                	test   %eax,%eax
+  8024c6:	0f 88 89 00 00 00    	js     802555 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8024cc:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8024d2:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8024d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8024dd:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8024e0:	39 fe                	cmp    %edi,%esi
+  8024e2:	73 7b                	jae    80255f <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8024e4:	89 f8                	mov    %edi,%eax
+  8024e6:	29 f0                	sub    %esi,%eax
+  8024e8:	c1 e8 0c             	shr    $0xc,%eax
+  8024eb:	ba 40 00 00 00       	mov    $0x40,%edx
+  8024f0:	39 d0                	cmp    %edx,%eax
+  8024f2:	0f 47 c2             	cmova  %edx,%eax
+  8024f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8024f8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024fb:	8b 52 0c             	mov    0xc(%edx),%edx
+  8024fe:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  802504:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802507:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  80250d:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802512:	89 f2                	mov    %esi,%edx
+  802514:	03 55 08             	add    0x8(%ebp),%edx
+  802517:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80251a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80251f:	e8 ea f6 ff ff       	call   801c0e <fsipcv>
+  802524:	85 c0                	test   %eax,%eax
+  802526:	7e 12                	jle    80253a <mmap+0x118>
+  802528:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80252b:	85 c0                	test   %eax,%eax
+  80252d:	0f 84 9e 00 00 00    	je     8025d1 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802533:	c1 e0 0c             	shl    $0xc,%eax
+  802536:	01 c6                	add    %eax,%esi
+  802538:	eb a6                	jmp    8024e0 <mmap+0xbe>
+			munmap(addr, done);
+  80253a:	89 c3                	mov    %eax,%ebx
+  80253c:	83 ec 08             	sub    $0x8,%esp
+  80253f:	56                   	push   %esi
+  802540:	ff 75 08             	push   0x8(%ebp)
+  802543:	e8 78 fe ff ff       	call   8023c0 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802548:	83 c4 10             	add    $0x10,%esp
+  80254b:	85 db                	test   %ebx,%ebx
+  80254d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802552:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802555:	89 d8                	mov    %ebx,%eax
+  802557:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80255a:	5b                   	pop    %ebx
+  80255b:	5e                   	pop    %esi
+  80255c:	5f                   	pop    %edi
+  80255d:	5d                   	pop    %ebp
+  80255e:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80255f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802562:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802564:	85 c0                	test   %eax,%eax
+  802566:	74 ed                	je     802555 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802568:	be 00 00 00 00       	mov    $0x0,%esi
+  80256d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802570:	39 fe                	cmp    %edi,%esi
+  802572:	73 2e                	jae    8025a2 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802574:	83 ec 0c             	sub    $0xc,%esp
+  802577:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  80257a:	50                   	push   %eax
+  80257b:	e8 4a eb ff ff       	call   8010ca <cowpage>
+  802580:	83 c4 10             	add    $0x10,%esp
+  802583:	85 c0                	test   %eax,%eax
+  802585:	78 08                	js     80258f <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802587:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80258d:	eb e1                	jmp    802570 <mmap+0x14e>
+				munmap(addr, len);
+  80258f:	89 c3                	mov    %eax,%ebx
+  802591:	83 ec 08             	sub    $0x8,%esp
+  802594:	57                   	push   %edi
+  802595:	ff 75 08             	push   0x8(%ebp)
+  802598:	e8 23 fe ff ff       	call   8023c0 <munmap>
+				return r;
+  80259d:	83 c4 10             	add    $0x10,%esp
+  8025a0:	eb b3                	jmp    802555 <mmap+0x133>
+	return 0;
+  8025a2:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8025a5:	eb ae                	jmp    802555 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8025a7:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8025ac:	eb a7                	jmp    802555 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8025ae:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8025b3:	eb a0                	jmp    802555 <mmap+0x133>
+		return -E_INVAL;
+  8025b5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025ba:	eb 99                	jmp    802555 <mmap+0x133>
+  8025bc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025c1:	eb 92                	jmp    802555 <mmap+0x133>
+  8025c3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025c8:	eb 8b                	jmp    802555 <mmap+0x133>
+  8025ca:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025cf:	eb 84                	jmp    802555 <mmap+0x133>
+			munmap(addr, done);
+  8025d1:	83 ec 08             	sub    $0x8,%esp
+  8025d4:	56                   	push   %esi
+  8025d5:	ff 75 08             	push   0x8(%ebp)
+  8025d8:	e8 e3 fd ff ff       	call   8023c0 <munmap>
+  8025dd:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8025e0:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025e5:	e9 6b ff ff ff       	jmp    802555 <mmap+0x133>
+
+008025ea <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8025ea:	55                   	push   %ebp
+  8025eb:	89 e5                	mov    %esp,%ebp
+  8025ed:	56                   	push   %esi
+  8025ee:	53                   	push   %ebx
+  8025ef:	83 ec 10             	sub    $0x10,%esp
+  8025f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8025f5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025fb:	e8 3d f9 ff ff       	call   801f3d <fsring_slot>
+  802600:	85 c0                	test   %eax,%eax
+  802602:	78 60                	js     802664 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802604:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802607:	8b 56 08             	mov    0x8(%esi),%edx
+  80260a:	83 e2 03             	and    $0x3,%edx
+  80260d:	83 fa 01             	cmp    $0x1,%edx
+  802610:	74 59                	je     80266b <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802612:	ba 01 00 00 00       	mov    $0x1,%edx
+  802617:	89 c1                	mov    %eax,%ecx
+  802619:	d3 e2                	shl    %cl,%edx
+  80261b:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802621:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802624:	c1 e2 02             	shl    $0x2,%edx
+  802627:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  80262d:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  802634:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802637:	8b 55 18             	mov    0x18(%ebp),%edx
+  80263a:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80263d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802640:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802643:	83 ec 08             	sub    $0x8,%esp
+  802646:	50                   	push   %eax
+  802647:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80264c:	39 c3                	cmp    %eax,%ebx
+  80264e:	0f 47 d8             	cmova  %eax,%ebx
+  802651:	53                   	push   %ebx
+  802652:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802655:	89 f2                	mov    %esi,%edx
+  802657:	b8 03 00 00 00       	mov    $0x3,%eax
+  80265c:	e8 1e f5 ff ff       	call   801b7f <fsring_post>
+  802661:	83 c4 10             	add    $0x10,%esp
+}
+  802664:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802667:	5b                   	pop    %ebx
+  802668:	5e                   	pop    %esi
+  802669:	5d                   	pop    %ebp
+  80266a:	c3                   	ret
+		return -E_INVAL;
+  80266b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802670:	eb f2                	jmp    802664 <fsring_read+0x7a>
+
+00802672 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802672:	55                   	push   %ebp
+  802673:	89 e5                	mov    %esp,%ebp
+  802675:	56                   	push   %esi
+  802676:	53                   	push   %ebx
+  802677:	83 ec 10             	sub    $0x10,%esp
+  80267a:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80267d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802680:	8b 45 08             	mov    0x8(%ebp),%eax
+  802683:	e8 b5 f8 ff ff       	call   801f3d <fsring_slot>
+  802688:	89 c3                	mov    %eax,%ebx
+  80268a:	85 c0                	test   %eax,%eax
+  80268c:	78 77                	js     802705 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80268e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802691:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802695:	74 77                	je     80270e <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802697:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80269c:	39 c6                	cmp    %eax,%esi
+  80269e:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8026a1:	83 ec 04             	sub    $0x4,%esp
+  8026a4:	56                   	push   %esi
+  8026a5:	ff 75 0c             	push   0xc(%ebp)
+  8026a8:	89 d8                	mov    %ebx,%eax
+  8026aa:	c1 e0 0c             	shl    $0xc,%eax
+  8026ad:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8026b3:	50                   	push   %eax
+  8026b4:	e8 73 e2 ff ff       	call   80092c <memmove>
+	fsring_busy |= 1 << slot;
+  8026b9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026be:	89 d9                	mov    %ebx,%ecx
+  8026c0:	d3 e0                	shl    %cl,%eax
+  8026c2:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8026c8:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8026cb:	c1 e0 02             	shl    $0x2,%eax
+  8026ce:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8026d4:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8026db:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8026de:	8b 45 18             	mov    0x18(%ebp),%eax
+  8026e1:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8026e4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8026eb:	83 c4 08             	add    $0x8,%esp
+  8026ee:	53                   	push   %ebx
+  8026ef:	56                   	push   %esi
+  8026f0:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8026f3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026f6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8026fb:	e8 7f f4 ff ff       	call   801b7f <fsring_post>
+  802700:	89 c3                	mov    %eax,%ebx
+  802702:	83 c4 10             	add    $0x10,%esp
+}
+  802705:	89 d8                	mov    %ebx,%eax
+  802707:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80270a:	5b                   	pop    %ebx
+  80270b:	5e                   	pop    %esi
+  80270c:	5d                   	pop    %ebp
+  80270d:	c3                   	ret
+		return -E_INVAL;
+  80270e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802713:	eb f0                	jmp    802705 <fsring_write+0x93>
+
+00802715 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802715:	55                   	push   %ebp
+  802716:	89 e5                	mov    %esp,%ebp
+  802718:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80271b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80271e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802721:	e8 17 f8 ff ff       	call   801f3d <fsring_slot>
+  802726:	85 c0                	test   %eax,%eax
+  802728:	78 4c                	js     802776 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  80272a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80272f:	89 c1                	mov    %eax,%ecx
+  802731:	d3 e2                	shl    %cl,%edx
+  802733:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802739:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80273c:	c1 e2 02             	shl    $0x2,%edx
+  80273f:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  802745:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  80274c:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80274f:	8b 55 10             	mov    0x10(%ebp),%edx
+  802752:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802755:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802758:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80275b:	83 ec 08             	sub    $0x8,%esp
+  80275e:	50                   	push   %eax
+  80275f:	6a 00                	push   $0x0
+  802761:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802766:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802769:	b8 05 00 00 00       	mov    $0x5,%eax
+  80276e:	e8 0c f4 ff ff       	call   801b7f <fsring_post>
+  802773:	83 c4 10             	add    $0x10,%esp
+}
+  802776:	c9                   	leave
+  802777:	c3                   	ret
+
+00802778 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802778:	55                   	push   %ebp
+  802779:	89 e5                	mov    %esp,%ebp
+  80277b:	57                   	push   %edi
+  80277c:	56                   	push   %esi
+  80277d:	53                   	push   %ebx
+  80277e:	83 ec 1c             	sub    $0x1c,%esp
+  802781:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802785:	a1 00 50 80 00       	mov    0x805000,%eax
+  80278a:	8b 40 48             	mov    0x48(%eax),%eax
+  80278d:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  802793:	74 12                	je     8027a7 <fsring_reap+0x2f>
+		return 0;
+  802795:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  80279a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80279d:	5b                   	pop    %ebx
+  80279e:	5e                   	pop    %esi
+  80279f:	5f                   	pop    %edi
+  8027a0:	5d                   	pop    %ebp
+  8027a1:	c3                   	ret
+		sys_yield();
+  8027a2:	e8 ec e3 ff ff       	call   800b93 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8027a7:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8027ad:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8027b2:	39 c2                	cmp    %eax,%edx
+  8027b4:	75 18                	jne    8027ce <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8027b6:	84 db                	test   %bl,%bl
+  8027b8:	0f 84 21 01 00 00    	je     8028df <fsring_reap+0x167>
+  8027be:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  8027c5:	75 db                	jne    8027a2 <fsring_reap+0x2a>
+			return 0;
+  8027c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027cc:	eb cc                	jmp    80279a <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8027ce:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8027d3:	83 e0 0f             	and    $0xf,%eax
+  8027d6:	83 c0 2a             	add    $0x2a,%eax
+  8027d9:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8027e0:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8027e7:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8027ec:	83 c0 01             	add    $0x1,%eax
+  8027ef:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8027f4:	83 fb 0f             	cmp    $0xf,%ebx
+  8027f7:	77 5b                	ja     802854 <fsring_reap+0xdc>
+  8027f9:	be 01 00 00 00       	mov    $0x1,%esi
+  8027fe:	89 d9                	mov    %ebx,%ecx
+  802800:	d3 e6                	shl    %cl,%esi
+  802802:	89 f0                	mov    %esi,%eax
+  802804:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  80280a:	74 48                	je     802854 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  80280c:	89 d8                	mov    %ebx,%eax
+  80280e:	c1 e0 0c             	shl    $0xc,%eax
+  802811:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802817:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  80281a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80281d:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  802824:	83 f8 03             	cmp    $0x3,%eax
+  802827:	74 40                	je     802869 <fsring_reap+0xf1>
+  802829:	83 f8 05             	cmp    $0x5,%eax
+  80282c:	74 64                	je     802892 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  80282e:	f7 d6                	not    %esi
+  802830:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802836:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802839:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  802840:	8b 45 08             	mov    0x8(%ebp),%eax
+  802843:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802845:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802848:	89 38                	mov    %edi,(%eax)
+	return 1;
+  80284a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80284f:	e9 46 ff ff ff       	jmp    80279a <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802854:	53                   	push   %ebx
+  802855:	68 f8 3c 80 00       	push   $0x803cf8
+  80285a:	68 8f 02 00 00       	push   $0x28f
+  80285f:	68 d0 3c 80 00       	push   $0x803cd0
+  802864:	e8 fd 0b 00 00       	call   803466 <_panic>
+		if (cqe.cqe_result > 0)
+  802869:	85 ff                	test   %edi,%edi
+  80286b:	7e c1                	jle    80282e <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80286d:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802870:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802875:	39 c7                	cmp    %eax,%edi
+  802877:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80287a:	50                   	push   %eax
+  80287b:	ff 75 e4             	push   -0x1c(%ebp)
+  80287e:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802881:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  802888:	e8 9f e0 ff ff       	call   80092c <memmove>
+  80288d:	83 c4 10             	add    $0x10,%esp
+  802890:	eb 9c                	jmp    80282e <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802892:	85 ff                	test   %edi,%edi
+  802894:	75 98                	jne    80282e <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802896:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802899:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8028a0:	83 ec 08             	sub    $0x8,%esp
+  8028a3:	ff 75 e4             	push   -0x1c(%ebp)
+  8028a6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8028a9:	51                   	push   %ecx
+  8028aa:	e8 f7 de ff ff       	call   8007a6 <strcpy>
+			st->st_size = ret->ret_size;
+  8028af:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028b2:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8028b8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8028bb:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8028c1:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8028c7:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8028cd:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8028d4:	40 80 00 
+  8028d7:	83 c4 10             	add    $0x10,%esp
+  8028da:	e9 4f ff ff ff       	jmp    80282e <fsring_reap+0xb6>
+			return 0;
+  8028df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e4:	e9 b1 fe ff ff       	jmp    80279a <fsring_reap+0x22>
+
+008028e9 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8028e9:	55                   	push   %ebp
+  8028ea:	89 e5                	mov    %esp,%ebp
+  8028ec:	57                   	push   %edi
+  8028ed:	56                   	push   %esi
+  8028ee:	53                   	push   %ebx
+  8028ef:	83 ec 28             	sub    $0x28,%esp
+  8028f2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8028f5:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8028f8:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8028fb:	53                   	push   %ebx
+  8028fc:	e8 6a de ff ff       	call   80076b <strlen>
+  802901:	83 c4 10             	add    $0x10,%esp
+  802904:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802909:	0f 8f 02 01 00 00    	jg     802a11 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  80290f:	83 ec 08             	sub    $0x8,%esp
+  802912:	53                   	push   %ebx
+  802913:	68 00 60 80 00       	push   $0x806000
+  802918:	e8 89 de ff ff       	call   8007a6 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  80291d:	83 c4 10             	add    $0x10,%esp
+  802920:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802926:	76 69                	jbe    802991 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802928:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80292b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802931:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802936:	29 d1                	sub    %edx,%ecx
+  802938:	39 f9                	cmp    %edi,%ecx
+  80293a:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80293d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802940:	89 f9                	mov    %edi,%ecx
+  802942:	01 c1                	add    %eax,%ecx
+  802944:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802947:	eb 0f                	jmp    802958 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802949:	0f b6 10             	movzbl (%eax),%edx
+  80294c:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80294e:	05 00 10 00 00       	add    $0x1000,%eax
+  802953:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802958:	39 c8                	cmp    %ecx,%eax
+  80295a:	72 ed                	jb     802949 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  80295c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80295f:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802965:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  80296b:	83 ec 0c             	sub    $0xc,%esp
+  80296e:	6a 07                	push   $0x7
+  802970:	89 f9                	mov    %edi,%ecx
+  802972:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802975:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80297a:	e8 3f f1 ff ff       	call   801abe <fsipc_pages>
+  80297f:	89 c7                	mov    %eax,%edi
+  802981:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802984:	85 f6                	test   %esi,%esi
+  802986:	74 7f                	je     802a07 <file_slurp+0x11e>
+  802988:	8d 43 01             	lea    0x1(%ebx),%eax
+  80298b:	85 ff                	test   %edi,%edi
+  80298d:	79 3c                	jns    8029cb <file_slurp+0xe2>
+  80298f:	eb 76                	jmp    802a07 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802991:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802997:	ba 00 00 00 00       	mov    $0x0,%edx
+  80299c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8029a1:	e8 ba f2 ff ff       	call   801c60 <fsipc>
+  8029a6:	89 c7                	mov    %eax,%edi
+  8029a8:	85 c0                	test   %eax,%eax
+  8029aa:	7e d8                	jle    802984 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8029ac:	83 ec 04             	sub    $0x4,%esp
+  8029af:	50                   	push   %eax
+  8029b0:	68 08 60 80 00       	push   $0x806008
+  8029b5:	ff 75 0c             	push   0xc(%ebp)
+  8029b8:	e8 6f df ff ff       	call   80092c <memmove>
+  8029bd:	83 c4 10             	add    $0x10,%esp
+  8029c0:	eb c2                	jmp    802984 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8029c2:	80 fa 2f             	cmp    $0x2f,%dl
+  8029c5:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8029c8:	83 c0 01             	add    $0x1,%eax
+  8029cb:	89 c1                	mov    %eax,%ecx
+  8029cd:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8029d1:	84 d2                	test   %dl,%dl
+  8029d3:	75 ed                	jne    8029c2 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8029d5:	83 ec 04             	sub    $0x4,%esp
+  8029d8:	68 80 00 00 00       	push   $0x80
+  8029dd:	53                   	push   %ebx
+  8029de:	56                   	push   %esi
+  8029df:	e8 38 de ff ff       	call   80081c <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8029e4:	a1 00 60 80 00       	mov    0x806000,%eax
+  8029e9:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8029ef:	a1 04 60 80 00       	mov    0x806004,%eax
+  8029f4:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8029fa:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  802a01:	40 80 00 
+  802a04:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802a07:	89 f8                	mov    %edi,%eax
+  802a09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a0c:	5b                   	pop    %ebx
+  802a0d:	5e                   	pop    %esi
+  802a0e:	5f                   	pop    %edi
+  802a0f:	5d                   	pop    %ebp
+  802a10:	c3                   	ret
+		return -E_BAD_PATH;
+  802a11:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802a16:	eb ef                	jmp    802a07 <file_slurp+0x11e>
+
+00802a18 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802a18:	55                   	push   %ebp
+  802a19:	89 e5                	mov    %esp,%ebp
+  802a1b:	53                   	push   %ebx
+  802a1c:	83 ec 10             	sub    $0x10,%esp
+  802a1f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802a22:	53                   	push   %ebx
+  802a23:	e8 43 dd ff ff       	call   80076b <strlen>
+  802a28:	83 c4 10             	add    $0x10,%esp
+  802a2b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a30:	7f 25                	jg     802a57 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802a32:	83 ec 08             	sub    $0x8,%esp
+  802a35:	53                   	push   %ebx
+  802a36:	68 00 60 80 00       	push   $0x806000
+  802a3b:	e8 66 dd ff ff       	call   8007a6 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802a40:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a45:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a4a:	e8 11 f2 ff ff       	call   801c60 <fsipc>
+  802a4f:	83 c4 10             	add    $0x10,%esp
+}
+  802a52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a55:	c9                   	leave
+  802a56:	c3                   	ret
+		return -E_BAD_PATH;
+  802a57:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802a5c:	eb f4                	jmp    802a52 <remove+0x3a>
+
+00802a5e <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802a5e:	55                   	push   %ebp
+  802a5f:	89 e5                	mov    %esp,%ebp
+  802a61:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802a64:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a69:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a6e:	e8 ed f1 ff ff       	call   801c60 <fsipc>
+}
+  802a73:	c9                   	leave
+  802a74:	c3                   	ret
+
+00802a75 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802a75:	55                   	push   %ebp
+  802a76:	89 e5                	mov    %esp,%ebp
+  802a78:	57                   	push   %edi
+  802a79:	56                   	push   %esi
+  802a7a:	53                   	push   %ebx
+  802a7b:	83 ec 18             	sub    $0x18,%esp
+  802a7e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a81:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802a87:	57                   	push   %edi
+  802a88:	e8 de dc ff ff       	call   80076b <strlen>
+  802a8d:	83 c4 10             	add    $0x10,%esp
+  802a90:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a95:	7f 4c                	jg     802ae3 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802a97:	83 ec 08             	sub    $0x8,%esp
+  802a9a:	57                   	push   %edi
+  802a9b:	68 00 60 80 00       	push   $0x806000
+  802aa0:	e8 01 dd ff ff       	call   8007a6 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802aa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aaa:	b8 10 00 00 00       	mov    $0x10,%eax
+  802aaf:	e8 ac f1 ff ff       	call   801c60 <fsipc>
+  802ab4:	83 c4 10             	add    $0x10,%esp
+  802ab7:	85 c0                	test   %eax,%eax
+  802ab9:	78 20                	js     802adb <defrag+0x66>
+		return r;
+	if (before)
+  802abb:	85 f6                	test   %esi,%esi
+  802abd:	74 07                	je     802ac6 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802abf:	a1 00 60 80 00       	mov    0x806000,%eax
+  802ac4:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802acb:	85 db                	test   %ebx,%ebx
+  802acd:	74 0c                	je     802adb <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802acf:	a1 04 60 80 00       	mov    0x806004,%eax
+  802ad4:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802ad6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802adb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ade:	5b                   	pop    %ebx
+  802adf:	5e                   	pop    %esi
+  802ae0:	5f                   	pop    %edi
+  802ae1:	5d                   	pop    %ebp
+  802ae2:	c3                   	ret
+		return -E_BAD_PATH;
+  802ae3:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802ae8:	eb f1                	jmp    802adb <defrag+0x66>
+
+00802aea <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802aea:	55                   	push   %ebp
+  802aeb:	89 e5                	mov    %esp,%ebp
+  802aed:	53                   	push   %ebx
+  802aee:	83 ec 04             	sub    $0x4,%esp
+  802af1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802af4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802af9:	b8 11 00 00 00       	mov    $0x11,%eax
+  802afe:	e8 5d f1 ff ff       	call   801c60 <fsipc>
+  802b03:	85 c0                	test   %eax,%eax
+  802b05:	78 34                	js     802b3b <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802b07:	a1 00 60 80 00       	mov    0x806000,%eax
+  802b0c:	89 03                	mov    %eax,(%ebx)
+  802b0e:	a1 04 60 80 00       	mov    0x806004,%eax
+  802b13:	89 43 04             	mov    %eax,0x4(%ebx)
+  802b16:	a1 08 60 80 00       	mov    0x806008,%eax
+  802b1b:	89 43 08             	mov    %eax,0x8(%ebx)
+  802b1e:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  802b23:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802b26:	a1 10 60 80 00       	mov    0x806010,%eax
+  802b2b:	89 43 10             	mov    %eax,0x10(%ebx)
+  802b2e:	a1 14 60 80 00       	mov    0x806014,%eax
+  802b33:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802b36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b3e:	c9                   	leave
+  802b3f:	c3                   	ret
+
+00802b40 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b40:	55                   	push   %ebp
+  802b41:	89 e5                	mov    %esp,%ebp
+  802b43:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802b46:	68 11 3d 80 00       	push   $0x803d11
+  802b4b:	ff 75 0c             	push   0xc(%ebp)
+  802b4e:	e8 53 dc ff ff       	call   8007a6 <strcpy>
+	return 0;
+}
+  802b53:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b58:	c9                   	leave
+  802b59:	c3                   	ret
+
+00802b5a <devsock_close>:
+{
+  802b5a:	55                   	push   %ebp
+  802b5b:	89 e5                	mov    %esp,%ebp
+  802b5d:	53                   	push   %ebx
+  802b5e:	83 ec 10             	sub    $0x10,%esp
+  802b61:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802b64:	53                   	push   %ebx
+  802b65:	e8 db 09 00 00       	call   803545 <pageref>
+  802b6a:	89 c2                	mov    %eax,%edx
+  802b6c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802b6f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802b74:	83 fa 01             	cmp    $0x1,%edx
+  802b77:	74 05                	je     802b7e <devsock_close+0x24>
+}
+  802b79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b7c:	c9                   	leave
+  802b7d:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802b7e:	83 ec 0c             	sub    $0xc,%esp
+  802b81:	ff 73 0c             	push   0xc(%ebx)
+  802b84:	e8 b7 02 00 00       	call   802e40 <nsipc_close>
+  802b89:	83 c4 10             	add    $0x10,%esp
+  802b8c:	eb eb                	jmp    802b79 <devsock_close+0x1f>
+
+00802b8e <devsock_write>:
+{
+  802b8e:	55                   	push   %ebp
+  802b8f:	89 e5                	mov    %esp,%ebp
+  802b91:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802b94:	6a 00                	push   $0x0
+  802b96:	ff 75 10             	push   0x10(%ebp)
+  802b99:	ff 75 0c             	push   0xc(%ebp)
+  802b9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b9f:	ff 70 0c             	push   0xc(%eax)
+  802ba2:	e8 79 03 00 00       	call   802f20 <nsipc_send>
+}
+  802ba7:	c9                   	leave
+  802ba8:	c3                   	ret
+
+00802ba9 <devsock_read>:
+{
+  802ba9:	55                   	push   %ebp
+  802baa:	89 e5                	mov    %esp,%ebp
+  802bac:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802baf:	6a 00                	push   $0x0
+  802bb1:	ff 75 10             	push   0x10(%ebp)
+  802bb4:	ff 75 0c             	push   0xc(%ebp)
+  802bb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bba:	ff 70 0c             	push   0xc(%eax)
+  802bbd:	e8 ef 02 00 00       	call   802eb1 <nsipc_recv>
+}
+  802bc2:	c9                   	leave
+  802bc3:	c3                   	ret
+
+00802bc4 <fd2sockid>:
+{
+  802bc4:	55                   	push   %ebp
+  802bc5:	89 e5                	mov    %esp,%ebp
+  802bc7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802bca:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802bcd:	52                   	push   %edx
+  802bce:	50                   	push   %eax
+  802bcf:	e8 54 e9 ff ff       	call   801528 <fd_lookup>
+  802bd4:	83 c4 10             	add    $0x10,%esp
+  802bd7:	85 c0                	test   %eax,%eax
+  802bd9:	78 10                	js     802beb <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802bdb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bde:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  802be4:	39 08                	cmp    %ecx,(%eax)
+  802be6:	75 05                	jne    802bed <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802be8:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802beb:	c9                   	leave
+  802bec:	c3                   	ret
+		return -E_NOT_SUPP;
+  802bed:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802bf2:	eb f7                	jmp    802beb <fd2sockid+0x27>
+
+00802bf4 <alloc_sockfd>:
+{
+  802bf4:	55                   	push   %ebp
+  802bf5:	89 e5                	mov    %esp,%ebp
+  802bf7:	56                   	push   %esi
+  802bf8:	53                   	push   %ebx
+  802bf9:	83 ec 1c             	sub    $0x1c,%esp
+  802bfc:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802bfe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c01:	50                   	push   %eax
+  802c02:	e8 cb e8 ff ff       	call   8014d2 <fd_alloc>
+  802c07:	89 c3                	mov    %eax,%ebx
+  802c09:	83 c4 10             	add    $0x10,%esp
+  802c0c:	85 c0                	test   %eax,%eax
+  802c0e:	78 43                	js     802c53 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802c10:	83 ec 04             	sub    $0x4,%esp
+  802c13:	68 07 04 00 00       	push   $0x407
+  802c18:	ff 75 f4             	push   -0xc(%ebp)
+  802c1b:	6a 00                	push   $0x0
+  802c1d:	e8 90 df ff ff       	call   800bb2 <sys_page_alloc>
+  802c22:	89 c3                	mov    %eax,%ebx
+  802c24:	83 c4 10             	add    $0x10,%esp
+  802c27:	85 c0                	test   %eax,%eax
+  802c29:	78 28                	js     802c53 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802c2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c2e:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802c34:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802c36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c39:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802c40:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802c43:	83 ec 0c             	sub    $0xc,%esp
+  802c46:	50                   	push   %eax
+  802c47:	e8 5f e8 ff ff       	call   8014ab <fd2num>
+  802c4c:	89 c3                	mov    %eax,%ebx
+  802c4e:	83 c4 10             	add    $0x10,%esp
+  802c51:	eb 0c                	jmp    802c5f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802c53:	83 ec 0c             	sub    $0xc,%esp
+  802c56:	56                   	push   %esi
+  802c57:	e8 e4 01 00 00       	call   802e40 <nsipc_close>
+		return r;
+  802c5c:	83 c4 10             	add    $0x10,%esp
+}
+  802c5f:	89 d8                	mov    %ebx,%eax
+  802c61:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c64:	5b                   	pop    %ebx
+  802c65:	5e                   	pop    %esi
+  802c66:	5d                   	pop    %ebp
+  802c67:	c3                   	ret
+
+00802c68 <accept>:
+{
+  802c68:	55                   	push   %ebp
+  802c69:	89 e5                	mov    %esp,%ebp
+  802c6b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c71:	e8 4e ff ff ff       	call   802bc4 <fd2sockid>
+  802c76:	85 c0                	test   %eax,%eax
+  802c78:	78 1b                	js     802c95 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802c7a:	83 ec 04             	sub    $0x4,%esp
+  802c7d:	ff 75 10             	push   0x10(%ebp)
+  802c80:	ff 75 0c             	push   0xc(%ebp)
+  802c83:	50                   	push   %eax
+  802c84:	e8 0e 01 00 00       	call   802d97 <nsipc_accept>
+  802c89:	83 c4 10             	add    $0x10,%esp
+  802c8c:	85 c0                	test   %eax,%eax
+  802c8e:	78 05                	js     802c95 <accept+0x2d>
+	return alloc_sockfd(r);
+  802c90:	e8 5f ff ff ff       	call   802bf4 <alloc_sockfd>
+}
+  802c95:	c9                   	leave
+  802c96:	c3                   	ret
+
+00802c97 <bind>:
+{
+  802c97:	55                   	push   %ebp
+  802c98:	89 e5                	mov    %esp,%ebp
+  802c9a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca0:	e8 1f ff ff ff       	call   802bc4 <fd2sockid>
+  802ca5:	85 c0                	test   %eax,%eax
+  802ca7:	78 12                	js     802cbb <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802ca9:	83 ec 04             	sub    $0x4,%esp
+  802cac:	ff 75 10             	push   0x10(%ebp)
+  802caf:	ff 75 0c             	push   0xc(%ebp)
+  802cb2:	50                   	push   %eax
+  802cb3:	e8 31 01 00 00       	call   802de9 <nsipc_bind>
+  802cb8:	83 c4 10             	add    $0x10,%esp
+}
+  802cbb:	c9                   	leave
+  802cbc:	c3                   	ret
+
+00802cbd <shutdown>:
+{
+  802cbd:	55                   	push   %ebp
+  802cbe:	89 e5                	mov    %esp,%ebp
+  802cc0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802cc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc6:	e8 f9 fe ff ff       	call   802bc4 <fd2sockid>
+  802ccb:	85 c0                	test   %eax,%eax
+  802ccd:	78 0f                	js     802cde <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802ccf:	83 ec 08             	sub    $0x8,%esp
+  802cd2:	ff 75 0c             	push   0xc(%ebp)
+  802cd5:	50                   	push   %eax
+  802cd6:	e8 43 01 00 00       	call   802e1e <nsipc_shutdown>
+  802cdb:	83 c4 10             	add    $0x10,%esp
+}
+  802cde:	c9                   	leave
+  802cdf:	c3                   	ret
+
+00802ce0 <connect>:
+{
+  802ce0:	55                   	push   %ebp
+  802ce1:	89 e5                	mov    %esp,%ebp
+  802ce3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce9:	e8 d6 fe ff ff       	call   802bc4 <fd2sockid>
+  802cee:	85 c0                	test   %eax,%eax
+  802cf0:	78 12                	js     802d04 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802cf2:	83 ec 04             	sub    $0x4,%esp
+  802cf5:	ff 75 10             	push   0x10(%ebp)
+  802cf8:	ff 75 0c             	push   0xc(%ebp)
+  802cfb:	50                   	push   %eax
+  802cfc:	e8 59 01 00 00       	call   802e5a <nsipc_connect>
+  802d01:	83 c4 10             	add    $0x10,%esp
+}
+  802d04:	c9                   	leave
+  802d05:	c3                   	ret
+
+00802d06 <listen>:
+{
+  802d06:	55                   	push   %ebp
+  802d07:	89 e5                	mov    %esp,%ebp
+  802d09:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d0f:	e8 b0 fe ff ff       	call   802bc4 <fd2sockid>
+  802d14:	85 c0                	test   %eax,%eax
+  802d16:	78 0f                	js     802d27 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802d18:	83 ec 08             	sub    $0x8,%esp
+  802d1b:	ff 75 0c             	push   0xc(%ebp)
+  802d1e:	50                   	push   %eax
+  802d1f:	e8 6b 01 00 00       	call   802e8f <nsipc_listen>
+  802d24:	83 c4 10             	add    $0x10,%esp
+}
+  802d27:	c9                   	leave
+  802d28:	c3                   	ret
+
+00802d29 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802d29:	55                   	push   %ebp
+  802d2a:	89 e5                	mov    %esp,%ebp
+  802d2c:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802d2f:	ff 75 10             	push   0x10(%ebp)
+  802d32:	ff 75 0c             	push   0xc(%ebp)
+  802d35:	ff 75 08             	push   0x8(%ebp)
+  802d38:	e8 41 02 00 00       	call   802f7e <nsipc_socket>
+  802d3d:	83 c4 10             	add    $0x10,%esp
+  802d40:	85 c0                	test   %eax,%eax
+  802d42:	78 05                	js     802d49 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802d44:	e8 ab fe ff ff       	call   802bf4 <alloc_sockfd>
+}
+  802d49:	c9                   	leave
+  802d4a:	c3                   	ret
+
+00802d4b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802d4b:	55                   	push   %ebp
+  802d4c:	89 e5                	mov    %esp,%ebp
+  802d4e:	53                   	push   %ebx
+  802d4f:	83 ec 04             	sub    $0x4,%esp
+  802d52:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802d54:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802d5b:	74 26                	je     802d83 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802d5d:	6a 07                	push   $0x7
+  802d5f:	68 00 80 80 00       	push   $0x808000
+  802d64:	53                   	push   %ebx
+  802d65:	ff 35 00 90 80 00    	push   0x809000
+  802d6b:	e8 c3 e5 ff ff       	call   801333 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802d70:	83 c4 0c             	add    $0xc,%esp
+  802d73:	6a 00                	push   $0x0
+  802d75:	6a 00                	push   $0x0
+  802d77:	6a 00                	push   $0x0
+  802d79:	e8 4a e5 ff ff       	call   8012c8 <ipc_recv>
+}
+  802d7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d81:	c9                   	leave
+  802d82:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d83:	83 ec 0c             	sub    $0xc,%esp
+  802d86:	6a 02                	push   $0x2
+  802d88:	e8 df e6 ff ff       	call   80146c <ipc_find_env>
+  802d8d:	a3 00 90 80 00       	mov    %eax,0x809000
+  802d92:	83 c4 10             	add    $0x10,%esp
+  802d95:	eb c6                	jmp    802d5d <nsipc+0x12>
+
+00802d97 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802d97:	55                   	push   %ebp
+  802d98:	89 e5                	mov    %esp,%ebp
+  802d9a:	56                   	push   %esi
+  802d9b:	53                   	push   %ebx
+  802d9c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802d9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802da7:	8b 06                	mov    (%esi),%eax
+  802da9:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802dae:	b8 01 00 00 00       	mov    $0x1,%eax
+  802db3:	e8 93 ff ff ff       	call   802d4b <nsipc>
+  802db8:	89 c3                	mov    %eax,%ebx
+  802dba:	85 c0                	test   %eax,%eax
+  802dbc:	79 09                	jns    802dc7 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802dbe:	89 d8                	mov    %ebx,%eax
+  802dc0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dc3:	5b                   	pop    %ebx
+  802dc4:	5e                   	pop    %esi
+  802dc5:	5d                   	pop    %ebp
+  802dc6:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802dc7:	83 ec 04             	sub    $0x4,%esp
+  802dca:	ff 35 10 80 80 00    	push   0x808010
+  802dd0:	68 00 80 80 00       	push   $0x808000
+  802dd5:	ff 75 0c             	push   0xc(%ebp)
+  802dd8:	e8 4f db ff ff       	call   80092c <memmove>
+		*addrlen = ret->ret_addrlen;
+  802ddd:	a1 10 80 80 00       	mov    0x808010,%eax
+  802de2:	89 06                	mov    %eax,(%esi)
+  802de4:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802de7:	eb d5                	jmp    802dbe <nsipc_accept+0x27>
+
+00802de9 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802de9:	55                   	push   %ebp
+  802dea:	89 e5                	mov    %esp,%ebp
+  802dec:	53                   	push   %ebx
+  802ded:	83 ec 08             	sub    $0x8,%esp
+  802df0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802df3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802df6:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802dfb:	53                   	push   %ebx
+  802dfc:	ff 75 0c             	push   0xc(%ebp)
+  802dff:	68 04 80 80 00       	push   $0x808004
+  802e04:	e8 23 db ff ff       	call   80092c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802e09:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802e0f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802e14:	e8 32 ff ff ff       	call   802d4b <nsipc>
+}
+  802e19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e1c:	c9                   	leave
+  802e1d:	c3                   	ret
+
+00802e1e <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802e1e:	55                   	push   %ebp
+  802e1f:	89 e5                	mov    %esp,%ebp
+  802e21:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802e24:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e27:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802e2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e2f:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802e34:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e39:	e8 0d ff ff ff       	call   802d4b <nsipc>
+}
+  802e3e:	c9                   	leave
+  802e3f:	c3                   	ret
+
+00802e40 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802e40:	55                   	push   %ebp
+  802e41:	89 e5                	mov    %esp,%ebp
+  802e43:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802e46:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e49:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802e4e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e53:	e8 f3 fe ff ff       	call   802d4b <nsipc>
+}
+  802e58:	c9                   	leave
+  802e59:	c3                   	ret
+
+00802e5a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802e5a:	55                   	push   %ebp
+  802e5b:	89 e5                	mov    %esp,%ebp
+  802e5d:	53                   	push   %ebx
+  802e5e:	83 ec 08             	sub    $0x8,%esp
+  802e61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802e64:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e67:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802e6c:	53                   	push   %ebx
+  802e6d:	ff 75 0c             	push   0xc(%ebp)
+  802e70:	68 04 80 80 00       	push   $0x808004
+  802e75:	e8 b2 da ff ff       	call   80092c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802e7a:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802e80:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e85:	e8 c1 fe ff ff       	call   802d4b <nsipc>
+}
+  802e8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e8d:	c9                   	leave
+  802e8e:	c3                   	ret
+
+00802e8f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802e8f:	55                   	push   %ebp
+  802e90:	89 e5                	mov    %esp,%ebp
+  802e92:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802e95:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e98:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802e9d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ea0:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802ea5:	b8 06 00 00 00       	mov    $0x6,%eax
+  802eaa:	e8 9c fe ff ff       	call   802d4b <nsipc>
+}
+  802eaf:	c9                   	leave
+  802eb0:	c3                   	ret
+
+00802eb1 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802eb1:	55                   	push   %ebp
+  802eb2:	89 e5                	mov    %esp,%ebp
+  802eb4:	56                   	push   %esi
+  802eb5:	53                   	push   %ebx
+  802eb6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802eb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ebc:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802ec1:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802ec7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eca:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802ecf:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ed4:	e8 72 fe ff ff       	call   802d4b <nsipc>
+  802ed9:	89 c3                	mov    %eax,%ebx
+  802edb:	85 c0                	test   %eax,%eax
+  802edd:	78 22                	js     802f01 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802edf:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ee4:	39 c6                	cmp    %eax,%esi
+  802ee6:	0f 4e c6             	cmovle %esi,%eax
+  802ee9:	39 c3                	cmp    %eax,%ebx
+  802eeb:	7f 1d                	jg     802f0a <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802eed:	83 ec 04             	sub    $0x4,%esp
+  802ef0:	53                   	push   %ebx
+  802ef1:	68 00 80 80 00       	push   $0x808000
+  802ef6:	ff 75 0c             	push   0xc(%ebp)
+  802ef9:	e8 2e da ff ff       	call   80092c <memmove>
+  802efe:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802f01:	89 d8                	mov    %ebx,%eax
+  802f03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f06:	5b                   	pop    %ebx
+  802f07:	5e                   	pop    %esi
+  802f08:	5d                   	pop    %ebp
+  802f09:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802f0a:	68 1d 3d 80 00       	push   $0x803d1d
+  802f0f:	68 cc 3b 80 00       	push   $0x803bcc
+  802f14:	6a 62                	push   $0x62
+  802f16:	68 32 3d 80 00       	push   $0x803d32
+  802f1b:	e8 46 05 00 00       	call   803466 <_panic>
+
+00802f20 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802f20:	55                   	push   %ebp
+  802f21:	89 e5                	mov    %esp,%ebp
+  802f23:	53                   	push   %ebx
+  802f24:	83 ec 04             	sub    $0x4,%esp
+  802f27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802f2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f2d:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802f32:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f38:	7f 2e                	jg     802f68 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802f3a:	83 ec 04             	sub    $0x4,%esp
+  802f3d:	53                   	push   %ebx
+  802f3e:	ff 75 0c             	push   0xc(%ebp)
+  802f41:	68 0c 80 80 00       	push   $0x80800c
+  802f46:	e8 e1 d9 ff ff       	call   80092c <memmove>
+	nsipcbuf.send.req_size = size;
+  802f4b:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802f51:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f54:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802f59:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f5e:	e8 e8 fd ff ff       	call   802d4b <nsipc>
+}
+  802f63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f66:	c9                   	leave
+  802f67:	c3                   	ret
+	assert(size < 1600);
+  802f68:	68 3e 3d 80 00       	push   $0x803d3e
+  802f6d:	68 cc 3b 80 00       	push   $0x803bcc
+  802f72:	6a 6d                	push   $0x6d
+  802f74:	68 32 3d 80 00       	push   $0x803d32
+  802f79:	e8 e8 04 00 00       	call   803466 <_panic>
+
+00802f7e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802f7e:	55                   	push   %ebp
+  802f7f:	89 e5                	mov    %esp,%ebp
+  802f81:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802f84:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f87:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802f8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f8f:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802f94:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f97:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802f9c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802fa1:	e8 a5 fd ff ff       	call   802d4b <nsipc>
+}
+  802fa6:	c9                   	leave
+  802fa7:	c3                   	ret
+
+00802fa8 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802fa8:	55                   	push   %ebp
+  802fa9:	89 e5                	mov    %esp,%ebp
+  802fab:	56                   	push   %esi
+  802fac:	53                   	push   %ebx
+  802fad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802fb0:	83 ec 0c             	sub    $0xc,%esp
+  802fb3:	ff 75 08             	push   0x8(%ebp)
+  802fb6:	e8 00 e5 ff ff       	call   8014bb <fd2data>
+  802fbb:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802fbd:	83 c4 08             	add    $0x8,%esp
+  802fc0:	68 4a 3d 80 00       	push   $0x803d4a
+  802fc5:	53                   	push   %ebx
+  802fc6:	e8 db d7 ff ff       	call   8007a6 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802fcb:	8b 46 04             	mov    0x4(%esi),%eax
+  802fce:	2b 06                	sub    (%esi),%eax
+  802fd0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802fd6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802fdd:	00 00 00 
+	stat->st_dev = &devpipe;
+  802fe0:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802fe7:	40 80 00 
+	return 0;
+}
+  802fea:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ff2:	5b                   	pop    %ebx
+  802ff3:	5e                   	pop    %esi
+  802ff4:	5d                   	pop    %ebp
+  802ff5:	c3                   	ret
+
+00802ff6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ff6:	55                   	push   %ebp
+  802ff7:	89 e5                	mov    %esp,%ebp
+  802ff9:	53                   	push   %ebx
+  802ffa:	83 ec 0c             	sub    $0xc,%esp
+  802ffd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803000:	53                   	push   %ebx
+  803001:	6a 00                	push   $0x0
+  803003:	e8 37 dc ff ff       	call   800c3f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803008:	89 1c 24             	mov    %ebx,(%esp)
+  80300b:	e8 ab e4 ff ff       	call   8014bb <fd2data>
+  803010:	83 c4 08             	add    $0x8,%esp
+  803013:	50                   	push   %eax
+  803014:	6a 00                	push   $0x0
+  803016:	e8 24 dc ff ff       	call   800c3f <sys_page_unmap>
+}
+  80301b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80301e:	c9                   	leave
+  80301f:	c3                   	ret
+
+00803020 <_pipeisclosed>:
+{
+  803020:	55                   	push   %ebp
+  803021:	89 e5                	mov    %esp,%ebp
+  803023:	57                   	push   %edi
+  803024:	56                   	push   %esi
+  803025:	53                   	push   %ebx
+  803026:	83 ec 1c             	sub    $0x1c,%esp
+  803029:	89 c7                	mov    %eax,%edi
+  80302b:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80302d:	a1 00 50 80 00       	mov    0x805000,%eax
+  803032:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803035:	83 ec 0c             	sub    $0xc,%esp
+  803038:	57                   	push   %edi
+  803039:	e8 07 05 00 00       	call   803545 <pageref>
+  80303e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803041:	89 34 24             	mov    %esi,(%esp)
+  803044:	e8 fc 04 00 00       	call   803545 <pageref>
+		nn = thisenv->env_runs;
+  803049:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80304f:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  803052:	83 c4 10             	add    $0x10,%esp
+  803055:	39 cb                	cmp    %ecx,%ebx
+  803057:	74 1b                	je     803074 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  803059:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80305c:	75 cf                	jne    80302d <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80305e:	8b 42 58             	mov    0x58(%edx),%eax
+  803061:	6a 01                	push   $0x1
+  803063:	50                   	push   %eax
+  803064:	53                   	push   %ebx
+  803065:	68 51 3d 80 00       	push   $0x803d51
+  80306a:	e8 49 d1 ff ff       	call   8001b8 <cprintf>
+  80306f:	83 c4 10             	add    $0x10,%esp
+  803072:	eb b9                	jmp    80302d <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  803074:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803077:	0f 94 c0             	sete   %al
+  80307a:	0f b6 c0             	movzbl %al,%eax
+}
+  80307d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803080:	5b                   	pop    %ebx
+  803081:	5e                   	pop    %esi
+  803082:	5f                   	pop    %edi
+  803083:	5d                   	pop    %ebp
+  803084:	c3                   	ret
+
+00803085 <devpipe_write>:
+{
+  803085:	55                   	push   %ebp
+  803086:	89 e5                	mov    %esp,%ebp
+  803088:	57                   	push   %edi
+  803089:	56                   	push   %esi
+  80308a:	53                   	push   %ebx
+  80308b:	83 ec 28             	sub    $0x28,%esp
+  80308e:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  803091:	56                   	push   %esi
+  803092:	e8 24 e4 ff ff       	call   8014bb <fd2data>
+  803097:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803099:	83 c4 10             	add    $0x10,%esp
+  80309c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030a1:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8030a4:	75 09                	jne    8030af <devpipe_write+0x2a>
+	return i;
+  8030a6:	89 f8                	mov    %edi,%eax
+  8030a8:	eb 23                	jmp    8030cd <devpipe_write+0x48>
+			sys_yield();
+  8030aa:	e8 e4 da ff ff       	call   800b93 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8030af:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030b2:	8b 0b                	mov    (%ebx),%ecx
+  8030b4:	8d 51 20             	lea    0x20(%ecx),%edx
+  8030b7:	39 d0                	cmp    %edx,%eax
+  8030b9:	72 1a                	jb     8030d5 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8030bb:	89 da                	mov    %ebx,%edx
+  8030bd:	89 f0                	mov    %esi,%eax
+  8030bf:	e8 5c ff ff ff       	call   803020 <_pipeisclosed>
+  8030c4:	85 c0                	test   %eax,%eax
+  8030c6:	74 e2                	je     8030aa <devpipe_write+0x25>
+				return 0;
+  8030c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030d0:	5b                   	pop    %ebx
+  8030d1:	5e                   	pop    %esi
+  8030d2:	5f                   	pop    %edi
+  8030d3:	5d                   	pop    %ebp
+  8030d4:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8030d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030d8:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8030dc:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8030df:	89 c2                	mov    %eax,%edx
+  8030e1:	c1 fa 1f             	sar    $0x1f,%edx
+  8030e4:	89 d1                	mov    %edx,%ecx
+  8030e6:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030e9:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8030ec:	83 e2 1f             	and    $0x1f,%edx
+  8030ef:	29 ca                	sub    %ecx,%edx
+  8030f1:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8030f5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8030f9:	83 c0 01             	add    $0x1,%eax
+  8030fc:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8030ff:	83 c7 01             	add    $0x1,%edi
+  803102:	eb 9d                	jmp    8030a1 <devpipe_write+0x1c>
+
+00803104 <devpipe_read>:
+{
+  803104:	55                   	push   %ebp
+  803105:	89 e5                	mov    %esp,%ebp
+  803107:	57                   	push   %edi
+  803108:	56                   	push   %esi
+  803109:	53                   	push   %ebx
+  80310a:	83 ec 18             	sub    $0x18,%esp
+  80310d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803110:	57                   	push   %edi
+  803111:	e8 a5 e3 ff ff       	call   8014bb <fd2data>
+  803116:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803118:	83 c4 10             	add    $0x10,%esp
+  80311b:	be 00 00 00 00       	mov    $0x0,%esi
+  803120:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803123:	75 13                	jne    803138 <devpipe_read+0x34>
+	return i;
+  803125:	89 f0                	mov    %esi,%eax
+  803127:	eb 02                	jmp    80312b <devpipe_read+0x27>
+				return i;
+  803129:	89 f0                	mov    %esi,%eax
+}
+  80312b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80312e:	5b                   	pop    %ebx
+  80312f:	5e                   	pop    %esi
+  803130:	5f                   	pop    %edi
+  803131:	5d                   	pop    %ebp
+  803132:	c3                   	ret
+			sys_yield();
+  803133:	e8 5b da ff ff       	call   800b93 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803138:	8b 03                	mov    (%ebx),%eax
+  80313a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80313d:	75 18                	jne    803157 <devpipe_read+0x53>
+			if (i > 0)
+  80313f:	85 f6                	test   %esi,%esi
+  803141:	75 e6                	jne    803129 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803143:	89 da                	mov    %ebx,%edx
+  803145:	89 f8                	mov    %edi,%eax
+  803147:	e8 d4 fe ff ff       	call   803020 <_pipeisclosed>
+  80314c:	85 c0                	test   %eax,%eax
+  80314e:	74 e3                	je     803133 <devpipe_read+0x2f>
+				return 0;
+  803150:	b8 00 00 00 00       	mov    $0x0,%eax
+  803155:	eb d4                	jmp    80312b <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803157:	99                   	cltd
+  803158:	c1 ea 1b             	shr    $0x1b,%edx
+  80315b:	01 d0                	add    %edx,%eax
+  80315d:	83 e0 1f             	and    $0x1f,%eax
+  803160:	29 d0                	sub    %edx,%eax
+  803162:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803167:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80316a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80316d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803170:	83 c6 01             	add    $0x1,%esi
+  803173:	eb ab                	jmp    803120 <devpipe_read+0x1c>
+
+00803175 <pipe>:
+{
+  803175:	55                   	push   %ebp
+  803176:	89 e5                	mov    %esp,%ebp
+  803178:	56                   	push   %esi
+  803179:	53                   	push   %ebx
+  80317a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80317d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803180:	50                   	push   %eax
+  803181:	e8 4c e3 ff ff       	call   8014d2 <fd_alloc>
+  803186:	89 c3                	mov    %eax,%ebx
+  803188:	83 c4 10             	add    $0x10,%esp
+  80318b:	85 c0                	test   %eax,%eax
+  80318d:	0f 88 23 01 00 00    	js     8032b6 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803193:	83 ec 04             	sub    $0x4,%esp
+  803196:	68 07 04 00 00       	push   $0x407
+  80319b:	ff 75 f4             	push   -0xc(%ebp)
+  80319e:	6a 00                	push   $0x0
+  8031a0:	e8 0d da ff ff       	call   800bb2 <sys_page_alloc>
+  8031a5:	89 c3                	mov    %eax,%ebx
+  8031a7:	83 c4 10             	add    $0x10,%esp
+  8031aa:	85 c0                	test   %eax,%eax
+  8031ac:	0f 88 04 01 00 00    	js     8032b6 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8031b2:	83 ec 0c             	sub    $0xc,%esp
+  8031b5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031b8:	50                   	push   %eax
+  8031b9:	e8 14 e3 ff ff       	call   8014d2 <fd_alloc>
+  8031be:	89 c3                	mov    %eax,%ebx
+  8031c0:	83 c4 10             	add    $0x10,%esp
+  8031c3:	85 c0                	test   %eax,%eax
+  8031c5:	0f 88 db 00 00 00    	js     8032a6 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031cb:	83 ec 04             	sub    $0x4,%esp
+  8031ce:	68 07 04 00 00       	push   $0x407
+  8031d3:	ff 75 f0             	push   -0x10(%ebp)
+  8031d6:	6a 00                	push   $0x0
+  8031d8:	e8 d5 d9 ff ff       	call   800bb2 <sys_page_alloc>
+  8031dd:	89 c3                	mov    %eax,%ebx
+  8031df:	83 c4 10             	add    $0x10,%esp
+  8031e2:	85 c0                	test   %eax,%eax
+  8031e4:	0f 88 bc 00 00 00    	js     8032a6 <pipe+0x131>
+	va = fd2data(fd0);
+  8031ea:	83 ec 0c             	sub    $0xc,%esp
+  8031ed:	ff 75 f4             	push   -0xc(%ebp)
+  8031f0:	e8 c6 e2 ff ff       	call   8014bb <fd2data>
+  8031f5:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031f7:	83 c4 0c             	add    $0xc,%esp
+  8031fa:	68 07 04 00 00       	push   $0x407
+  8031ff:	50                   	push   %eax
+  803200:	6a 00                	push   $0x0
+  803202:	e8 ab d9 ff ff       	call   800bb2 <sys_page_alloc>
+  803207:	89 c3                	mov    %eax,%ebx
+  803209:	83 c4 10             	add    $0x10,%esp
+  80320c:	85 c0                	test   %eax,%eax
+  80320e:	0f 88 82 00 00 00    	js     803296 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803214:	83 ec 0c             	sub    $0xc,%esp
+  803217:	ff 75 f0             	push   -0x10(%ebp)
+  80321a:	e8 9c e2 ff ff       	call   8014bb <fd2data>
+  80321f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803226:	50                   	push   %eax
+  803227:	6a 00                	push   $0x0
+  803229:	56                   	push   %esi
+  80322a:	6a 00                	push   $0x0
+  80322c:	e8 cc d9 ff ff       	call   800bfd <sys_page_map>
+  803231:	89 c3                	mov    %eax,%ebx
+  803233:	83 c4 20             	add    $0x20,%esp
+  803236:	85 c0                	test   %eax,%eax
+  803238:	78 4e                	js     803288 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80323a:	a1 60 40 80 00       	mov    0x804060,%eax
+  80323f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803242:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803244:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803247:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80324e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803251:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803253:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803256:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80325d:	83 ec 0c             	sub    $0xc,%esp
+  803260:	ff 75 f4             	push   -0xc(%ebp)
+  803263:	e8 43 e2 ff ff       	call   8014ab <fd2num>
+  803268:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80326b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80326d:	83 c4 04             	add    $0x4,%esp
+  803270:	ff 75 f0             	push   -0x10(%ebp)
+  803273:	e8 33 e2 ff ff       	call   8014ab <fd2num>
+  803278:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80327b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80327e:	83 c4 10             	add    $0x10,%esp
+  803281:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803286:	eb 2e                	jmp    8032b6 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803288:	83 ec 08             	sub    $0x8,%esp
+  80328b:	56                   	push   %esi
+  80328c:	6a 00                	push   $0x0
+  80328e:	e8 ac d9 ff ff       	call   800c3f <sys_page_unmap>
+  803293:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803296:	83 ec 08             	sub    $0x8,%esp
+  803299:	ff 75 f0             	push   -0x10(%ebp)
+  80329c:	6a 00                	push   $0x0
+  80329e:	e8 9c d9 ff ff       	call   800c3f <sys_page_unmap>
+  8032a3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8032a6:	83 ec 08             	sub    $0x8,%esp
+  8032a9:	ff 75 f4             	push   -0xc(%ebp)
+  8032ac:	6a 00                	push   $0x0
+  8032ae:	e8 8c d9 ff ff       	call   800c3f <sys_page_unmap>
+  8032b3:	83 c4 10             	add    $0x10,%esp
+}
+  8032b6:	89 d8                	mov    %ebx,%eax
+  8032b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032bb:	5b                   	pop    %ebx
+  8032bc:	5e                   	pop    %esi
+  8032bd:	5d                   	pop    %ebp
+  8032be:	c3                   	ret
+
+008032bf <pipeisclosed>:
+{
+  8032bf:	55                   	push   %ebp
+  8032c0:	89 e5                	mov    %esp,%ebp
+  8032c2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032c8:	50                   	push   %eax
+  8032c9:	ff 75 08             	push   0x8(%ebp)
+  8032cc:	e8 57 e2 ff ff       	call   801528 <fd_lookup>
+  8032d1:	83 c4 10             	add    $0x10,%esp
+  8032d4:	85 c0                	test   %eax,%eax
+  8032d6:	78 18                	js     8032f0 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8032d8:	83 ec 0c             	sub    $0xc,%esp
+  8032db:	ff 75 f4             	push   -0xc(%ebp)
+  8032de:	e8 d8 e1 ff ff       	call   8014bb <fd2data>
+  8032e3:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8032e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032e8:	e8 33 fd ff ff       	call   803020 <_pipeisclosed>
+  8032ed:	83 c4 10             	add    $0x10,%esp
+}
+  8032f0:	c9                   	leave
+  8032f1:	c3                   	ret
+
+008032f2 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8032f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f7:	c3                   	ret
+
+008032f8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8032f8:	55                   	push   %ebp
+  8032f9:	89 e5                	mov    %esp,%ebp
+  8032fb:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8032fe:	68 69 3d 80 00       	push   $0x803d69
+  803303:	ff 75 0c             	push   0xc(%ebp)
+  803306:	e8 9b d4 ff ff       	call   8007a6 <strcpy>
+	return 0;
+}
+  80330b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803310:	c9                   	leave
+  803311:	c3                   	ret
+
+00803312 <devcons_write>:
+{
+  803312:	55                   	push   %ebp
+  803313:	89 e5                	mov    %esp,%ebp
+  803315:	57                   	push   %edi
+  803316:	56                   	push   %esi
+  803317:	53                   	push   %ebx
+  803318:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80331e:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803323:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803329:	eb 2e                	jmp    803359 <devcons_write+0x47>
+		m = n - tot;
+  80332b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80332e:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803330:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803335:	39 c3                	cmp    %eax,%ebx
+  803337:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80333a:	83 ec 04             	sub    $0x4,%esp
+  80333d:	53                   	push   %ebx
+  80333e:	89 f0                	mov    %esi,%eax
+  803340:	03 45 0c             	add    0xc(%ebp),%eax
+  803343:	50                   	push   %eax
+  803344:	57                   	push   %edi
+  803345:	e8 e2 d5 ff ff       	call   80092c <memmove>
+		sys_cputs(buf, m);
+  80334a:	83 c4 08             	add    $0x8,%esp
+  80334d:	53                   	push   %ebx
+  80334e:	57                   	push   %edi
+  80334f:	e8 82 d7 ff ff       	call   800ad6 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803354:	01 de                	add    %ebx,%esi
+  803356:	83 c4 10             	add    $0x10,%esp
+  803359:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80335c:	72 cd                	jb     80332b <devcons_write+0x19>
+}
+  80335e:	89 f0                	mov    %esi,%eax
+  803360:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803363:	5b                   	pop    %ebx
+  803364:	5e                   	pop    %esi
+  803365:	5f                   	pop    %edi
+  803366:	5d                   	pop    %ebp
+  803367:	c3                   	ret
+
+00803368 <devcons_read>:
+{
+  803368:	55                   	push   %ebp
+  803369:	89 e5                	mov    %esp,%ebp
+  80336b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80336e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803373:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803377:	75 07                	jne    803380 <devcons_read+0x18>
+  803379:	eb 1f                	jmp    80339a <devcons_read+0x32>
+		sys_yield();
+  80337b:	e8 13 d8 ff ff       	call   800b93 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803380:	e8 77 d7 ff ff       	call   800afc <sys_cgetc>
+  803385:	85 c0                	test   %eax,%eax
+  803387:	74 f2                	je     80337b <devcons_read+0x13>
+	if (c < 0)
+  803389:	78 0f                	js     80339a <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80338b:	83 f8 04             	cmp    $0x4,%eax
+  80338e:	74 0c                	je     80339c <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803390:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803393:	88 02                	mov    %al,(%edx)
+	return 1;
+  803395:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80339a:	c9                   	leave
+  80339b:	c3                   	ret
+		return 0;
+  80339c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a1:	eb f7                	jmp    80339a <devcons_read+0x32>
+
+008033a3 <cputchar>:
+{
+  8033a3:	55                   	push   %ebp
+  8033a4:	89 e5                	mov    %esp,%ebp
+  8033a6:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8033a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033ac:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8033af:	6a 01                	push   $0x1
+  8033b1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033b4:	50                   	push   %eax
+  8033b5:	e8 1c d7 ff ff       	call   800ad6 <sys_cputs>
+}
+  8033ba:	83 c4 10             	add    $0x10,%esp
+  8033bd:	c9                   	leave
+  8033be:	c3                   	ret
+
+008033bf <getchar>:
+{
+  8033bf:	55                   	push   %ebp
+  8033c0:	89 e5                	mov    %esp,%ebp
+  8033c2:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8033c5:	6a 01                	push   $0x1
+  8033c7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033ca:	50                   	push   %eax
+  8033cb:	6a 00                	push   $0x0
+  8033cd:	e8 bc e3 ff ff       	call   80178e <read>
+	if (r < 0)
+  8033d2:	83 c4 10             	add    $0x10,%esp
+  8033d5:	85 c0                	test   %eax,%eax
+  8033d7:	78 06                	js     8033df <getchar+0x20>
+	if (r < 1)
+  8033d9:	74 06                	je     8033e1 <getchar+0x22>
+	return c;
+  8033db:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8033df:	c9                   	leave
+  8033e0:	c3                   	ret
+		return -E_EOF;
+  8033e1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8033e6:	eb f7                	jmp    8033df <getchar+0x20>
+
+008033e8 <iscons>:
+{
+  8033e8:	55                   	push   %ebp
+  8033e9:	89 e5                	mov    %esp,%ebp
+  8033eb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033f1:	50                   	push   %eax
+  8033f2:	ff 75 08             	push   0x8(%ebp)
+  8033f5:	e8 2e e1 ff ff       	call   801528 <fd_lookup>
+  8033fa:	83 c4 10             	add    $0x10,%esp
+  8033fd:	85 c0                	test   %eax,%eax
+  8033ff:	78 11                	js     803412 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803401:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803404:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80340a:	39 10                	cmp    %edx,(%eax)
+  80340c:	0f 94 c0             	sete   %al
+  80340f:	0f b6 c0             	movzbl %al,%eax
+}
+  803412:	c9                   	leave
+  803413:	c3                   	ret
+
+00803414 <opencons>:
+{
+  803414:	55                   	push   %ebp
+  803415:	89 e5                	mov    %esp,%ebp
+  803417:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80341a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80341d:	50                   	push   %eax
+  80341e:	e8 af e0 ff ff       	call   8014d2 <fd_alloc>
+  803423:	83 c4 10             	add    $0x10,%esp
+  803426:	85 c0                	test   %eax,%eax
+  803428:	78 3a                	js     803464 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80342a:	83 ec 04             	sub    $0x4,%esp
+  80342d:	68 07 04 00 00       	push   $0x407
+  803432:	ff 75 f4             	push   -0xc(%ebp)
+  803435:	6a 00                	push   $0x0
+  803437:	e8 76 d7 ff ff       	call   800bb2 <sys_page_alloc>
+  80343c:	83 c4 10             	add    $0x10,%esp
+  80343f:	85 c0                	test   %eax,%eax
+  803441:	78 21                	js     803464 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803443:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803446:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80344c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80344e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803451:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803458:	83 ec 0c             	sub    $0xc,%esp
+  80345b:	50                   	push   %eax
+  80345c:	e8 4a e0 ff ff       	call   8014ab <fd2num>
+  803461:	83 c4 10             	add    $0x10,%esp
+}
+  803464:	c9                   	leave
+  803465:	c3                   	ret
+
+00803466 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803466:	55                   	push   %ebp
+  803467:	89 e5                	mov    %esp,%ebp
+  803469:	56                   	push   %esi
+  80346a:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80346b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80346e:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  803474:	e8 f3 d6 ff ff       	call   800b6c <sys_getenvid>
+  803479:	83 ec 0c             	sub    $0xc,%esp
+  80347c:	ff 75 0c             	push   0xc(%ebp)
+  80347f:	ff 75 08             	push   0x8(%ebp)
+  803482:	56                   	push   %esi
+  803483:	50                   	push   %eax
+  803484:	68 78 3d 80 00       	push   $0x803d78
+  803489:	e8 2a cd ff ff       	call   8001b8 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80348e:	83 c4 18             	add    $0x18,%esp
+  803491:	53                   	push   %ebx
+  803492:	ff 75 10             	push   0x10(%ebp)
+  803495:	e8 cd cc ff ff       	call   800167 <vcprintf>
+	cprintf("\n");
+  80349a:	c7 04 24 62 3d 80 00 	movl   $0x803d62,(%esp)
+  8034a1:	e8 12 cd ff ff       	call   8001b8 <cprintf>
+  8034a6:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8034a9:	cc                   	int3
+	while (1)
+  8034aa:	eb fd                	jmp    8034a9 <_panic+0x43>
+
+008034ac <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8034ac:	55                   	push   %ebp
+  8034ad:	89 e5                	mov    %esp,%ebp
+  8034af:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8034b2:	83 3d 04 90 80 00 00 	cmpl   $0x0,0x809004
+  8034b9:	74 0a                	je     8034c5 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8034bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034be:	a3 04 90 80 00       	mov    %eax,0x809004
+}
+  8034c3:	c9                   	leave
+  8034c4:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034c5:	83 ec 04             	sub    $0x4,%esp
+  8034c8:	6a 07                	push   $0x7
+  8034ca:	68 00 f0 bf ee       	push   $0xeebff000
+  8034cf:	6a 00                	push   $0x0
+  8034d1:	e8 dc d6 ff ff       	call   800bb2 <sys_page_alloc>
+  8034d6:	83 c4 10             	add    $0x10,%esp
+  8034d9:	85 c0                	test   %eax,%eax
+  8034db:	75 2c                	jne    803509 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8034dd:	83 ec 08             	sub    $0x8,%esp
+  8034e0:	68 1f 35 80 00       	push   $0x80351f
+  8034e5:	6a 00                	push   $0x0
+  8034e7:	e8 31 d8 ff ff       	call   800d1d <sys_env_set_pgfault_upcall>
+  8034ec:	83 c4 10             	add    $0x10,%esp
+  8034ef:	85 c0                	test   %eax,%eax
+  8034f1:	74 c8                	je     8034bb <set_pgfault_handler+0xf>
+  8034f3:	68 e4 3d 80 00       	push   $0x803de4
+  8034f8:	68 cc 3b 80 00       	push   $0x803bcc
+  8034fd:	6a 20                	push   $0x20
+  8034ff:	68 14 3e 80 00       	push   $0x803e14
+  803504:	e8 5d ff ff ff       	call   803466 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803509:	68 9c 3d 80 00       	push   $0x803d9c
+  80350e:	68 cc 3b 80 00       	push   $0x803bcc
+  803513:	6a 1e                	push   $0x1e
+  803515:	68 14 3e 80 00       	push   $0x803e14
+  80351a:	e8 47 ff ff ff       	call   803466 <_panic>
+
+0080351f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80351f:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803520:	a1 04 90 80 00       	mov    0x809004,%eax
+	call *%eax
+  803525:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803527:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80352a:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  80352f:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803534:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803538:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80353b:	83 c4 08             	add    $0x8,%esp
+	popal
+  80353e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  80353f:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803542:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803543:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803544:	c3                   	ret
+
+00803545 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803545:	55                   	push   %ebp
+  803546:	89 e5                	mov    %esp,%ebp
+  803548:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80354b:	89 c2                	mov    %eax,%edx
+  80354d:	c1 ea 16             	shr    $0x16,%edx
+  803550:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803557:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80355c:	f6 c1 01             	test   $0x1,%cl
+  80355f:	74 22                	je     803583 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803561:	c1 e8 0c             	shr    $0xc,%eax
+  803564:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80356b:	a8 01                	test   $0x1,%al
+  80356d:	74 14                	je     803583 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80356f:	c1 e8 0c             	shr    $0xc,%eax
+  803572:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803575:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80357c:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803580:	0f b7 d2             	movzwl %dx,%edx
+}
+  803583:	89 d0                	mov    %edx,%eax
+  803585:	5d                   	pop    %ebp
+  803586:	c3                   	ret
+
+00803587 <dm>:
+  803587:	55                   	push   %ebp
+  803588:	57                   	push   %edi
+  803589:	56                   	push   %esi
+  80358a:	53                   	push   %ebx
+  80358b:	83 ec 24             	sub    $0x24,%esp
+  80358e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803592:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803596:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80359a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80359e:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035a2:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035a6:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8035aa:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035b9:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035c0:	00 
+  8035c1:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035c8:	00 
+  8035c9:	89 fb                	mov    %edi,%ebx
+  8035cb:	eb 08                	jmp    8035d5 <dm+0x4e>
+  8035cd:	83 e9 01             	sub    $0x1,%ecx
+  8035d0:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8035d3:	74 68                	je     80363d <dm+0xb6>
+  8035d5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8035d9:	01 c0                	add    %eax,%eax
+  8035db:	89 c6                	mov    %eax,%esi
+  8035dd:	89 d7                	mov    %edx,%edi
+  8035df:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8035e3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8035e7:	0f ad d0             	shrd   %cl,%edx,%eax
+  8035ea:	d3 ea                	shr    %cl,%edx
+  8035ec:	f6 c1 20             	test   $0x20,%cl
+  8035ef:	74 04                	je     8035f5 <dm+0x6e>
+  8035f1:	89 d0                	mov    %edx,%eax
+  8035f3:	31 d2                	xor    %edx,%edx
+  8035f5:	83 e0 01             	and    $0x1,%eax
+  8035f8:	89 04 24             	mov    %eax,(%esp)
+  8035fb:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803602:	00 
+  803603:	8b 04 24             	mov    (%esp),%eax
+  803606:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80360a:	09 f0                	or     %esi,%eax
+  80360c:	09 fa                	or     %edi,%edx
+  80360e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803612:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803616:	39 f0                	cmp    %esi,%eax
+  803618:	89 d5                	mov    %edx,%ebp
+  80361a:	19 fd                	sbb    %edi,%ebp
+  80361c:	72 af                	jb     8035cd <dm+0x46>
+  80361e:	29 f0                	sub    %esi,%eax
+  803620:	19 fa                	sbb    %edi,%edx
+  803622:	89 cf                	mov    %ecx,%edi
+  803624:	c1 ef 05             	shr    $0x5,%edi
+  803627:	83 e7 01             	and    $0x1,%edi
+  80362a:	89 fe                	mov    %edi,%esi
+  80362c:	83 f6 01             	xor    $0x1,%esi
+  80362f:	d3 e6                	shl    %cl,%esi
+  803631:	d3 e7                	shl    %cl,%edi
+  803633:	09 74 24 18          	or     %esi,0x18(%esp)
+  803637:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80363b:	eb 90                	jmp    8035cd <dm+0x46>
+  80363d:	85 db                	test   %ebx,%ebx
+  80363f:	74 05                	je     803646 <dm+0xbf>
+  803641:	89 03                	mov    %eax,(%ebx)
+  803643:	89 53 04             	mov    %edx,0x4(%ebx)
+  803646:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80364a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80364e:	83 c4 24             	add    $0x24,%esp
+  803651:	5b                   	pop    %ebx
+  803652:	5e                   	pop    %esi
+  803653:	5f                   	pop    %edi
+  803654:	5d                   	pop    %ebp
+  803655:	c3                   	ret
+
+00803656 <__udivdi3>:
+  803656:	83 ec 08             	sub    $0x8,%esp
+  803659:	6a 00                	push   $0x0
+  80365b:	ff 74 24 1c          	push   0x1c(%esp)
+  80365f:	ff 74 24 1c          	push   0x1c(%esp)
+  803663:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803667:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80366b:	e8 17 ff ff ff       	call   803587 <dm>
+  803670:	83 c4 14             	add    $0x14,%esp
+  803673:	c3                   	ret
+
+00803674 <__umoddi3>:
+  803674:	83 ec 18             	sub    $0x18,%esp
+  803677:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80367b:	50                   	push   %eax
+  80367c:	ff 74 24 2c          	push   0x2c(%esp)
+  803680:	ff 74 24 2c          	push   0x2c(%esp)
+  803684:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803688:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80368c:	e8 f6 fe ff ff       	call   803587 <dm>
+  803691:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803695:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803699:	83 c4 24             	add    $0x24,%esp
+  80369c:	c3                   	ret
+
+0080369d <__divdi3>:
+  80369d:	53                   	push   %ebx
+  80369e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036a2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036a6:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8036aa:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036ae:	85 d2                	test   %edx,%edx
+  8036b0:	78 15                	js     8036c7 <__divdi3+0x2a>
+  8036b2:	85 db                	test   %ebx,%ebx
+  8036b4:	78 34                	js     8036ea <__divdi3+0x4d>
+  8036b6:	83 ec 04             	sub    $0x4,%esp
+  8036b9:	6a 00                	push   $0x0
+  8036bb:	53                   	push   %ebx
+  8036bc:	51                   	push   %ecx
+  8036bd:	e8 c5 fe ff ff       	call   803587 <dm>
+  8036c2:	83 c4 10             	add    $0x10,%esp
+  8036c5:	eb 21                	jmp    8036e8 <__divdi3+0x4b>
+  8036c7:	f7 d8                	neg    %eax
+  8036c9:	83 d2 00             	adc    $0x0,%edx
+  8036cc:	f7 da                	neg    %edx
+  8036ce:	85 db                	test   %ebx,%ebx
+  8036d0:	78 30                	js     803702 <__divdi3+0x65>
+  8036d2:	83 ec 04             	sub    $0x4,%esp
+  8036d5:	6a 00                	push   $0x0
+  8036d7:	53                   	push   %ebx
+  8036d8:	51                   	push   %ecx
+  8036d9:	e8 a9 fe ff ff       	call   803587 <dm>
+  8036de:	83 c4 10             	add    $0x10,%esp
+  8036e1:	f7 d8                	neg    %eax
+  8036e3:	83 d2 00             	adc    $0x0,%edx
+  8036e6:	f7 da                	neg    %edx
+  8036e8:	5b                   	pop    %ebx
+  8036e9:	c3                   	ret
+  8036ea:	83 ec 04             	sub    $0x4,%esp
+  8036ed:	6a 00                	push   $0x0
+  8036ef:	f7 d9                	neg    %ecx
+  8036f1:	83 d3 00             	adc    $0x0,%ebx
+  8036f4:	f7 db                	neg    %ebx
+  8036f6:	53                   	push   %ebx
+  8036f7:	51                   	push   %ecx
+  8036f8:	e8 8a fe ff ff       	call   803587 <dm>
+  8036fd:	83 c4 10             	add    $0x10,%esp
+  803700:	eb df                	jmp    8036e1 <__divdi3+0x44>
+  803702:	83 ec 04             	sub    $0x4,%esp
+  803705:	6a 00                	push   $0x0
+  803707:	f7 d9                	neg    %ecx
+  803709:	83 d3 00             	adc    $0x0,%ebx
+  80370c:	f7 db                	neg    %ebx
+  80370e:	53                   	push   %ebx
+  80370f:	51                   	push   %ecx
+  803710:	e8 72 fe ff ff       	call   803587 <dm>
+  803715:	83 c4 10             	add    $0x10,%esp
+  803718:	eb ce                	jmp    8036e8 <__divdi3+0x4b>
+
+0080371a <__moddi3>:
+  80371a:	55                   	push   %ebp
+  80371b:	57                   	push   %edi
+  80371c:	56                   	push   %esi
+  80371d:	53                   	push   %ebx
+  80371e:	83 ec 24             	sub    $0x24,%esp
+  803721:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803725:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803729:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80372d:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803731:	85 d2                	test   %edx,%edx
+  803733:	78 3b                	js     803770 <__moddi3+0x56>
+  803735:	83 ec 04             	sub    $0x4,%esp
+  803738:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80373c:	56                   	push   %esi
+  80373d:	89 ce                	mov    %ecx,%esi
+  80373f:	f7 de                	neg    %esi
+  803741:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803745:	89 de                	mov    %ebx,%esi
+  803747:	83 d6 00             	adc    $0x0,%esi
+  80374a:	f7 de                	neg    %esi
+  80374c:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803750:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803754:	0f 48 f1             	cmovs  %ecx,%esi
+  803757:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80375c:	53                   	push   %ebx
+  80375d:	56                   	push   %esi
+  80375e:	e8 24 fe ff ff       	call   803587 <dm>
+  803763:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803767:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80376b:	83 c4 10             	add    $0x10,%esp
+  80376e:	eb 47                	jmp    8037b7 <__moddi3+0x9d>
+  803770:	f7 d8                	neg    %eax
+  803772:	83 d2 00             	adc    $0x0,%edx
+  803775:	f7 da                	neg    %edx
+  803777:	83 ec 04             	sub    $0x4,%esp
+  80377a:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80377e:	56                   	push   %esi
+  80377f:	89 cf                	mov    %ecx,%edi
+  803781:	f7 df                	neg    %edi
+  803783:	89 de                	mov    %ebx,%esi
+  803785:	83 d6 00             	adc    $0x0,%esi
+  803788:	f7 de                	neg    %esi
+  80378a:	0f 49 cf             	cmovns %edi,%ecx
+  80378d:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803791:	0f 49 de             	cmovns %esi,%ebx
+  803794:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803798:	ff 74 24 0c          	push   0xc(%esp)
+  80379c:	ff 74 24 0c          	push   0xc(%esp)
+  8037a0:	e8 e2 fd ff ff       	call   803587 <dm>
+  8037a5:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037a9:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037ad:	f7 d8                	neg    %eax
+  8037af:	83 d2 00             	adc    $0x0,%edx
+  8037b2:	f7 da                	neg    %edx
+  8037b4:	83 c4 10             	add    $0x10,%esp
+  8037b7:	83 c4 24             	add    $0x24,%esp
+  8037ba:	5b                   	pop    %ebx
+  8037bb:	5e                   	pop    %esi
+  8037bc:	5f                   	pop    %edi
+  8037bd:	5d                   	pop    %ebp
+  8037be:	c3                   	ret
@@ -0,0 +1,7712 @@
+
+obj/user/pingpongs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 d2 00 00 00       	call   800103 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t val;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t who;
+	uint32_t i;
+
+	i = 0;
+	if ((who = sfork()) != 0) {
+  80003c:	e8 b0 12 00 00       	call   8012f1 <sfork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 74                	jne    8000bc <umain+0x89>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+		ipc_send(who, 0, 0, 0);
+	}
+
+	while (1) {
+		ipc_recv(&who, 0, 0);
+  800048:	83 ec 04             	sub    $0x4,%esp
+  80004b:	6a 00                	push   $0x0
+  80004d:	6a 00                	push   $0x0
+  80004f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800052:	50                   	push   %eax
+  800053:	e8 b3 12 00 00       	call   80130b <ipc_recv>
+		cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800058:	8b 1d 04 50 80 00    	mov    0x805004,%ebx
+  80005e:	8b 7b 48             	mov    0x48(%ebx),%edi
+  800061:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800064:	a1 00 50 80 00       	mov    0x805000,%eax
+  800069:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80006c:	e8 3e 0b 00 00       	call   800baf <sys_getenvid>
+  800071:	83 c4 08             	add    $0x8,%esp
+  800074:	57                   	push   %edi
+  800075:	53                   	push   %ebx
+  800076:	56                   	push   %esi
+  800077:	ff 75 d4             	push   -0x2c(%ebp)
+  80007a:	50                   	push   %eax
+  80007b:	68 50 38 80 00       	push   $0x803850
+  800080:	e8 76 01 00 00       	call   8001fb <cprintf>
+		if (val == 10)
+  800085:	a1 00 50 80 00       	mov    0x805000,%eax
+  80008a:	83 c4 20             	add    $0x20,%esp
+  80008d:	83 f8 0a             	cmp    $0xa,%eax
+  800090:	74 22                	je     8000b4 <umain+0x81>
+			return;
+		++val;
+  800092:	83 c0 01             	add    $0x1,%eax
+  800095:	a3 00 50 80 00       	mov    %eax,0x805000
+		ipc_send(who, 0, 0, 0);
+  80009a:	6a 00                	push   $0x0
+  80009c:	6a 00                	push   $0x0
+  80009e:	6a 00                	push   $0x0
+  8000a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8000a3:	e8 ce 12 00 00       	call   801376 <ipc_send>
+		if (val == 10)
+  8000a8:	83 c4 10             	add    $0x10,%esp
+  8000ab:	83 3d 00 50 80 00 0a 	cmpl   $0xa,0x805000
+  8000b2:	75 94                	jne    800048 <umain+0x15>
+			return;
+	}
+
+}
+  8000b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000b7:	5b                   	pop    %ebx
+  8000b8:	5e                   	pop    %esi
+  8000b9:	5f                   	pop    %edi
+  8000ba:	5d                   	pop    %ebp
+  8000bb:	c3                   	ret
+		cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  8000bc:	8b 1d 04 50 80 00    	mov    0x805004,%ebx
+  8000c2:	e8 e8 0a 00 00       	call   800baf <sys_getenvid>
+  8000c7:	83 ec 04             	sub    $0x4,%esp
+  8000ca:	53                   	push   %ebx
+  8000cb:	50                   	push   %eax
+  8000cc:	68 20 38 80 00       	push   $0x803820
+  8000d1:	e8 25 01 00 00       	call   8001fb <cprintf>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8000d6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8000d9:	e8 d1 0a 00 00       	call   800baf <sys_getenvid>
+  8000de:	83 c4 0c             	add    $0xc,%esp
+  8000e1:	53                   	push   %ebx
+  8000e2:	50                   	push   %eax
+  8000e3:	68 3a 38 80 00       	push   $0x80383a
+  8000e8:	e8 0e 01 00 00       	call   8001fb <cprintf>
+		ipc_send(who, 0, 0, 0);
+  8000ed:	6a 00                	push   $0x0
+  8000ef:	6a 00                	push   $0x0
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000f6:	e8 7b 12 00 00       	call   801376 <ipc_send>
+  8000fb:	83 c4 20             	add    $0x20,%esp
+  8000fe:	e9 45 ff ff ff       	jmp    800048 <umain+0x15>
+
+00800103 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800103:	55                   	push   %ebp
+  800104:	89 e5                	mov    %esp,%ebp
+  800106:	56                   	push   %esi
+  800107:	53                   	push   %ebx
+  800108:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80010b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80010e:	e8 9c 0a 00 00       	call   800baf <sys_getenvid>
+  800113:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800118:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80011e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800123:	a3 04 50 80 00       	mov    %eax,0x805004
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800128:	85 db                	test   %ebx,%ebx
+  80012a:	7e 07                	jle    800133 <libmain+0x30>
+		binaryname = argv[0];
+  80012c:	8b 06                	mov    (%esi),%eax
+  80012e:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800133:	83 ec 08             	sub    $0x8,%esp
+  800136:	56                   	push   %esi
+  800137:	53                   	push   %ebx
+  800138:	e8 f6 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80013d:	e8 0a 00 00 00       	call   80014c <exit>
+}
+  800142:	83 c4 10             	add    $0x10,%esp
+  800145:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800148:	5b                   	pop    %ebx
+  800149:	5e                   	pop    %esi
+  80014a:	5d                   	pop    %ebp
+  80014b:	c3                   	ret
+
+0080014c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80014c:	55                   	push   %ebp
+  80014d:	89 e5                	mov    %esp,%ebp
+  80014f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800152:	e8 6b 15 00 00       	call   8016c2 <close_all>
+	sys_env_destroy(0);
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	6a 00                	push   $0x0
+  80015c:	e8 05 0a 00 00       	call   800b66 <sys_env_destroy>
+}
+  800161:	83 c4 10             	add    $0x10,%esp
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+
+00800166 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800166:	55                   	push   %ebp
+  800167:	89 e5                	mov    %esp,%ebp
+  800169:	53                   	push   %ebx
+  80016a:	83 ec 04             	sub    $0x4,%esp
+  80016d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800170:	8b 13                	mov    (%ebx),%edx
+  800172:	8d 42 01             	lea    0x1(%edx),%eax
+  800175:	89 03                	mov    %eax,(%ebx)
+  800177:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80017a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80017e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800183:	74 09                	je     80018e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800185:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800189:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80018c:	c9                   	leave
+  80018d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80018e:	83 ec 08             	sub    $0x8,%esp
+  800191:	68 ff 00 00 00       	push   $0xff
+  800196:	8d 43 08             	lea    0x8(%ebx),%eax
+  800199:	50                   	push   %eax
+  80019a:	e8 7a 09 00 00       	call   800b19 <sys_cputs>
+		b->idx = 0;
+  80019f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001a5:	83 c4 10             	add    $0x10,%esp
+  8001a8:	eb db                	jmp    800185 <putch+0x1f>
+
+008001aa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001aa:	55                   	push   %ebp
+  8001ab:	89 e5                	mov    %esp,%ebp
+  8001ad:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001b3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001ba:	00 00 00 
+	b.cnt = 0;
+  8001bd:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001c4:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001c7:	ff 75 0c             	push   0xc(%ebp)
+  8001ca:	ff 75 08             	push   0x8(%ebp)
+  8001cd:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001d3:	50                   	push   %eax
+  8001d4:	68 66 01 80 00       	push   $0x800166
+  8001d9:	e8 14 01 00 00       	call   8002f2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001de:	83 c4 08             	add    $0x8,%esp
+  8001e1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001e7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ed:	50                   	push   %eax
+  8001ee:	e8 26 09 00 00       	call   800b19 <sys_cputs>
+
+	return b.cnt;
+}
+  8001f3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f9:	c9                   	leave
+  8001fa:	c3                   	ret
+
+008001fb <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001fb:	55                   	push   %ebp
+  8001fc:	89 e5                	mov    %esp,%ebp
+  8001fe:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800201:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800204:	50                   	push   %eax
+  800205:	ff 75 08             	push   0x8(%ebp)
+  800208:	e8 9d ff ff ff       	call   8001aa <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80020d:	c9                   	leave
+  80020e:	c3                   	ret
+
+0080020f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80020f:	55                   	push   %ebp
+  800210:	89 e5                	mov    %esp,%ebp
+  800212:	57                   	push   %edi
+  800213:	56                   	push   %esi
+  800214:	53                   	push   %ebx
+  800215:	83 ec 1c             	sub    $0x1c,%esp
+  800218:	89 c7                	mov    %eax,%edi
+  80021a:	89 d6                	mov    %edx,%esi
+  80021c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80021f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800222:	89 d1                	mov    %edx,%ecx
+  800224:	89 c2                	mov    %eax,%edx
+  800226:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800229:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80022c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80022f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800232:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800235:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80023c:	39 c2                	cmp    %eax,%edx
+  80023e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800241:	72 3e                	jb     800281 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800243:	83 ec 0c             	sub    $0xc,%esp
+  800246:	ff 75 18             	push   0x18(%ebp)
+  800249:	83 eb 01             	sub    $0x1,%ebx
+  80024c:	53                   	push   %ebx
+  80024d:	50                   	push   %eax
+  80024e:	83 ec 08             	sub    $0x8,%esp
+  800251:	ff 75 e4             	push   -0x1c(%ebp)
+  800254:	ff 75 e0             	push   -0x20(%ebp)
+  800257:	ff 75 dc             	push   -0x24(%ebp)
+  80025a:	ff 75 d8             	push   -0x28(%ebp)
+  80025d:	e8 37 34 00 00       	call   803699 <__udivdi3>
+  800262:	83 c4 18             	add    $0x18,%esp
+  800265:	52                   	push   %edx
+  800266:	50                   	push   %eax
+  800267:	89 f2                	mov    %esi,%edx
+  800269:	89 f8                	mov    %edi,%eax
+  80026b:	e8 9f ff ff ff       	call   80020f <printnum>
+  800270:	83 c4 20             	add    $0x20,%esp
+  800273:	eb 13                	jmp    800288 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800275:	83 ec 08             	sub    $0x8,%esp
+  800278:	56                   	push   %esi
+  800279:	ff 75 18             	push   0x18(%ebp)
+  80027c:	ff d7                	call   *%edi
+  80027e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800281:	83 eb 01             	sub    $0x1,%ebx
+  800284:	85 db                	test   %ebx,%ebx
+  800286:	7f ed                	jg     800275 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800288:	83 ec 08             	sub    $0x8,%esp
+  80028b:	56                   	push   %esi
+  80028c:	83 ec 04             	sub    $0x4,%esp
+  80028f:	ff 75 e4             	push   -0x1c(%ebp)
+  800292:	ff 75 e0             	push   -0x20(%ebp)
+  800295:	ff 75 dc             	push   -0x24(%ebp)
+  800298:	ff 75 d8             	push   -0x28(%ebp)
+  80029b:	e8 17 34 00 00       	call   8036b7 <__umoddi3>
+  8002a0:	83 c4 14             	add    $0x14,%esp
+  8002a3:	0f be 80 80 38 80 00 	movsbl 0x803880(%eax),%eax
+  8002aa:	50                   	push   %eax
+  8002ab:	ff d7                	call   *%edi
+}
+  8002ad:	83 c4 10             	add    $0x10,%esp
+  8002b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b3:	5b                   	pop    %ebx
+  8002b4:	5e                   	pop    %esi
+  8002b5:	5f                   	pop    %edi
+  8002b6:	5d                   	pop    %ebp
+  8002b7:	c3                   	ret
+
+008002b8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002be:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002c2:	8b 10                	mov    (%eax),%edx
+  8002c4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002c7:	73 0a                	jae    8002d3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002c9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002cc:	89 08                	mov    %ecx,(%eax)
+  8002ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d1:	88 02                	mov    %al,(%edx)
+}
+  8002d3:	5d                   	pop    %ebp
+  8002d4:	c3                   	ret
+
+008002d5 <printfmt>:
+{
+  8002d5:	55                   	push   %ebp
+  8002d6:	89 e5                	mov    %esp,%ebp
+  8002d8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002db:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002de:	50                   	push   %eax
+  8002df:	ff 75 10             	push   0x10(%ebp)
+  8002e2:	ff 75 0c             	push   0xc(%ebp)
+  8002e5:	ff 75 08             	push   0x8(%ebp)
+  8002e8:	e8 05 00 00 00       	call   8002f2 <vprintfmt>
+}
+  8002ed:	83 c4 10             	add    $0x10,%esp
+  8002f0:	c9                   	leave
+  8002f1:	c3                   	ret
+
+008002f2 <vprintfmt>:
+{
+  8002f2:	55                   	push   %ebp
+  8002f3:	89 e5                	mov    %esp,%ebp
+  8002f5:	57                   	push   %edi
+  8002f6:	56                   	push   %esi
+  8002f7:	53                   	push   %ebx
+  8002f8:	83 ec 2c             	sub    $0x2c,%esp
+  8002fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800301:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800304:	eb 0a                	jmp    800310 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800306:	83 ec 08             	sub    $0x8,%esp
+  800309:	53                   	push   %ebx
+  80030a:	50                   	push   %eax
+  80030b:	ff d6                	call   *%esi
+  80030d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800310:	83 c7 01             	add    $0x1,%edi
+  800313:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800317:	83 f8 25             	cmp    $0x25,%eax
+  80031a:	74 0c                	je     800328 <vprintfmt+0x36>
+			if (ch == '\0')
+  80031c:	85 c0                	test   %eax,%eax
+  80031e:	75 e6                	jne    800306 <vprintfmt+0x14>
+}
+  800320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800323:	5b                   	pop    %ebx
+  800324:	5e                   	pop    %esi
+  800325:	5f                   	pop    %edi
+  800326:	5d                   	pop    %ebp
+  800327:	c3                   	ret
+		padc = ' ';
+  800328:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80032c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800333:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80033a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800341:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800346:	8d 47 01             	lea    0x1(%edi),%eax
+  800349:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80034c:	0f b6 17             	movzbl (%edi),%edx
+  80034f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800352:	3c 55                	cmp    $0x55,%al
+  800354:	0f 87 cf 03 00 00    	ja     800729 <vprintfmt+0x437>
+  80035a:	0f b6 c0             	movzbl %al,%eax
+  80035d:	ff 24 85 e0 39 80 00 	jmp    *0x8039e0(,%eax,4)
+  800364:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800367:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80036b:	eb d9                	jmp    800346 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80036d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800370:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800374:	eb d0                	jmp    800346 <vprintfmt+0x54>
+  800376:	0f b6 d2             	movzbl %dl,%edx
+  800379:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80037c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800381:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800384:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800387:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80038b:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80038e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800391:	83 f9 09             	cmp    $0x9,%ecx
+  800394:	77 55                	ja     8003eb <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800396:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800399:	eb e9                	jmp    800384 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80039b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039e:	8b 00                	mov    (%eax),%eax
+  8003a0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8003a9:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ac:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003af:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003b3:	79 91                	jns    800346 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003b5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003bb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003c2:	eb 82                	jmp    800346 <vprintfmt+0x54>
+			if (width < 0)
+  8003c4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003c7:	85 d2                	test   %edx,%edx
+  8003c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ce:	0f 49 c2             	cmovns %edx,%eax
+  8003d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003d7:	e9 6a ff ff ff       	jmp    800346 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003df:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003e6:	e9 5b ff ff ff       	jmp    800346 <vprintfmt+0x54>
+  8003eb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ee:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003f1:	eb bc                	jmp    8003af <vprintfmt+0xbd>
+			lflag++;
+  8003f3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f9:	e9 48 ff ff ff       	jmp    800346 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800401:	8d 78 04             	lea    0x4(%eax),%edi
+  800404:	83 ec 08             	sub    $0x8,%esp
+  800407:	53                   	push   %ebx
+  800408:	ff 30                	push   (%eax)
+  80040a:	ff d6                	call   *%esi
+			break;
+  80040c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80040f:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800412:	e9 b1 02 00 00       	jmp    8006c8 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800417:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041a:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80041d:	8b 10                	mov    (%eax),%edx
+  80041f:	89 d0                	mov    %edx,%eax
+  800421:	f7 d8                	neg    %eax
+  800423:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800426:	83 f8 11             	cmp    $0x11,%eax
+  800429:	7f 23                	jg     80044e <vprintfmt+0x15c>
+  80042b:	8b 14 85 40 3b 80 00 	mov    0x803b40(,%eax,4),%edx
+  800432:	85 d2                	test   %edx,%edx
+  800434:	74 18                	je     80044e <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800436:	52                   	push   %edx
+  800437:	68 5e 3c 80 00       	push   $0x803c5e
+  80043c:	53                   	push   %ebx
+  80043d:	56                   	push   %esi
+  80043e:	e8 92 fe ff ff       	call   8002d5 <printfmt>
+  800443:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800446:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800449:	e9 7a 02 00 00       	jmp    8006c8 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80044e:	50                   	push   %eax
+  80044f:	68 98 38 80 00       	push   $0x803898
+  800454:	53                   	push   %ebx
+  800455:	56                   	push   %esi
+  800456:	e8 7a fe ff ff       	call   8002d5 <printfmt>
+  80045b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80045e:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800461:	e9 62 02 00 00       	jmp    8006c8 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800466:	8b 45 14             	mov    0x14(%ebp),%eax
+  800469:	83 c0 04             	add    $0x4,%eax
+  80046c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80046f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800472:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800474:	85 c9                	test   %ecx,%ecx
+  800476:	b8 91 38 80 00       	mov    $0x803891,%eax
+  80047b:	0f 45 c1             	cmovne %ecx,%eax
+  80047e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800481:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800485:	7e 06                	jle    80048d <vprintfmt+0x19b>
+  800487:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80048b:	75 0b                	jne    800498 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80048d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800490:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800493:	89 75 08             	mov    %esi,0x8(%ebp)
+  800496:	eb 5c                	jmp    8004f4 <vprintfmt+0x202>
+  800498:	83 ec 08             	sub    $0x8,%esp
+  80049b:	ff 75 d0             	push   -0x30(%ebp)
+  80049e:	ff 75 cc             	push   -0x34(%ebp)
+  8004a1:	e8 20 03 00 00       	call   8007c6 <strnlen>
+  8004a6:	89 c2                	mov    %eax,%edx
+  8004a8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ab:	29 d0                	sub    %edx,%eax
+  8004ad:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004b0:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004b4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004b7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ba:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004bc:	eb 0e                	jmp    8004cc <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004be:	83 ec 08             	sub    $0x8,%esp
+  8004c1:	53                   	push   %ebx
+  8004c2:	57                   	push   %edi
+  8004c3:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c6:	83 ee 01             	sub    $0x1,%esi
+  8004c9:	83 c4 10             	add    $0x10,%esp
+  8004cc:	85 f6                	test   %esi,%esi
+  8004ce:	7f ee                	jg     8004be <vprintfmt+0x1cc>
+  8004d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d6:	85 c0                	test   %eax,%eax
+  8004d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004dd:	0f 49 d0             	cmovns %eax,%edx
+  8004e0:	29 d0                	sub    %edx,%eax
+  8004e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e5:	eb a6                	jmp    80048d <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004e7:	83 ec 08             	sub    $0x8,%esp
+  8004ea:	53                   	push   %ebx
+  8004eb:	52                   	push   %edx
+  8004ec:	ff 55 08             	call   *0x8(%ebp)
+  8004ef:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004f2:	89 f1                	mov    %esi,%ecx
+  8004f4:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004f7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004fb:	0f be d0             	movsbl %al,%edx
+  8004fe:	85 d2                	test   %edx,%edx
+  800500:	74 28                	je     80052a <vprintfmt+0x238>
+  800502:	85 ff                	test   %edi,%edi
+  800504:	78 05                	js     80050b <vprintfmt+0x219>
+  800506:	83 ef 01             	sub    $0x1,%edi
+  800509:	78 30                	js     80053b <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80050b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80050f:	74 d6                	je     8004e7 <vprintfmt+0x1f5>
+  800511:	0f be c0             	movsbl %al,%eax
+  800514:	83 e8 20             	sub    $0x20,%eax
+  800517:	83 f8 5e             	cmp    $0x5e,%eax
+  80051a:	76 cb                	jbe    8004e7 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80051c:	83 ec 08             	sub    $0x8,%esp
+  80051f:	53                   	push   %ebx
+  800520:	6a 3f                	push   $0x3f
+  800522:	ff 55 08             	call   *0x8(%ebp)
+  800525:	83 c4 10             	add    $0x10,%esp
+  800528:	eb c8                	jmp    8004f2 <vprintfmt+0x200>
+  80052a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80052d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800530:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800533:	01 d0                	add    %edx,%eax
+  800535:	29 c8                	sub    %ecx,%eax
+  800537:	89 c7                	mov    %eax,%edi
+  800539:	eb 13                	jmp    80054e <vprintfmt+0x25c>
+  80053b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80053e:	eb ed                	jmp    80052d <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800540:	83 ec 08             	sub    $0x8,%esp
+  800543:	53                   	push   %ebx
+  800544:	6a 20                	push   $0x20
+  800546:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800548:	83 ef 01             	sub    $0x1,%edi
+  80054b:	83 c4 10             	add    $0x10,%esp
+  80054e:	85 ff                	test   %edi,%edi
+  800550:	7f ee                	jg     800540 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800552:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800555:	89 45 14             	mov    %eax,0x14(%ebp)
+  800558:	e9 6b 01 00 00       	jmp    8006c8 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80055d:	83 f9 01             	cmp    $0x1,%ecx
+  800560:	7f 1f                	jg     800581 <vprintfmt+0x28f>
+	else if (lflag)
+  800562:	85 c9                	test   %ecx,%ecx
+  800564:	74 67                	je     8005cd <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800566:	8b 45 14             	mov    0x14(%ebp),%eax
+  800569:	8b 00                	mov    (%eax),%eax
+  80056b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056e:	89 c1                	mov    %eax,%ecx
+  800570:	c1 f9 1f             	sar    $0x1f,%ecx
+  800573:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800576:	8b 45 14             	mov    0x14(%ebp),%eax
+  800579:	8d 40 04             	lea    0x4(%eax),%eax
+  80057c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057f:	eb 17                	jmp    800598 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800581:	8b 45 14             	mov    0x14(%ebp),%eax
+  800584:	8b 50 04             	mov    0x4(%eax),%edx
+  800587:	8b 00                	mov    (%eax),%eax
+  800589:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80058c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8d 40 08             	lea    0x8(%eax),%eax
+  800595:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800598:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80059b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80059e:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005a3:	85 c9                	test   %ecx,%ecx
+  8005a5:	0f 89 03 01 00 00    	jns    8006ae <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005ab:	83 ec 08             	sub    $0x8,%esp
+  8005ae:	53                   	push   %ebx
+  8005af:	6a 2d                	push   $0x2d
+  8005b1:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005b3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005b9:	f7 da                	neg    %edx
+  8005bb:	83 d1 00             	adc    $0x0,%ecx
+  8005be:	f7 d9                	neg    %ecx
+  8005c0:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005c3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005c8:	e9 e1 00 00 00       	jmp    8006ae <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d0:	8b 00                	mov    (%eax),%eax
+  8005d2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005d5:	89 c1                	mov    %eax,%ecx
+  8005d7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005da:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e6:	eb b0                	jmp    800598 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005e8:	83 f9 01             	cmp    $0x1,%ecx
+  8005eb:	7f 1e                	jg     80060b <vprintfmt+0x319>
+	else if (lflag)
+  8005ed:	85 c9                	test   %ecx,%ecx
+  8005ef:	74 32                	je     800623 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8b 10                	mov    (%eax),%edx
+  8005f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800601:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800606:	e9 a3 00 00 00       	jmp    8006ae <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80060b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060e:	8b 10                	mov    (%eax),%edx
+  800610:	8b 48 04             	mov    0x4(%eax),%ecx
+  800613:	8d 40 08             	lea    0x8(%eax),%eax
+  800616:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800619:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80061e:	e9 8b 00 00 00       	jmp    8006ae <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800623:	8b 45 14             	mov    0x14(%ebp),%eax
+  800626:	8b 10                	mov    (%eax),%edx
+  800628:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062d:	8d 40 04             	lea    0x4(%eax),%eax
+  800630:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800633:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800638:	eb 74                	jmp    8006ae <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80063a:	83 f9 01             	cmp    $0x1,%ecx
+  80063d:	7f 1b                	jg     80065a <vprintfmt+0x368>
+	else if (lflag)
+  80063f:	85 c9                	test   %ecx,%ecx
+  800641:	74 2c                	je     80066f <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800643:	8b 45 14             	mov    0x14(%ebp),%eax
+  800646:	8b 10                	mov    (%eax),%edx
+  800648:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064d:	8d 40 04             	lea    0x4(%eax),%eax
+  800650:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800653:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800658:	eb 54                	jmp    8006ae <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80065a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065d:	8b 10                	mov    (%eax),%edx
+  80065f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800662:	8d 40 08             	lea    0x8(%eax),%eax
+  800665:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800668:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80066d:	eb 3f                	jmp    8006ae <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80066f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800672:	8b 10                	mov    (%eax),%edx
+  800674:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800679:	8d 40 04             	lea    0x4(%eax),%eax
+  80067c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80067f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800684:	eb 28                	jmp    8006ae <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800686:	83 ec 08             	sub    $0x8,%esp
+  800689:	53                   	push   %ebx
+  80068a:	6a 30                	push   $0x30
+  80068c:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80068e:	83 c4 08             	add    $0x8,%esp
+  800691:	53                   	push   %ebx
+  800692:	6a 78                	push   $0x78
+  800694:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8b 10                	mov    (%eax),%edx
+  80069b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006a0:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a9:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006ae:	83 ec 0c             	sub    $0xc,%esp
+  8006b1:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006b5:	50                   	push   %eax
+  8006b6:	ff 75 e0             	push   -0x20(%ebp)
+  8006b9:	57                   	push   %edi
+  8006ba:	51                   	push   %ecx
+  8006bb:	52                   	push   %edx
+  8006bc:	89 da                	mov    %ebx,%edx
+  8006be:	89 f0                	mov    %esi,%eax
+  8006c0:	e8 4a fb ff ff       	call   80020f <printnum>
+			break;
+  8006c5:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006cb:	e9 40 fc ff ff       	jmp    800310 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006d0:	83 f9 01             	cmp    $0x1,%ecx
+  8006d3:	7f 1b                	jg     8006f0 <vprintfmt+0x3fe>
+	else if (lflag)
+  8006d5:	85 c9                	test   %ecx,%ecx
+  8006d7:	74 2c                	je     800705 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dc:	8b 10                	mov    (%eax),%edx
+  8006de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006ee:	eb be                	jmp    8006ae <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f3:	8b 10                	mov    (%eax),%edx
+  8006f5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f8:	8d 40 08             	lea    0x8(%eax),%eax
+  8006fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006fe:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800703:	eb a9                	jmp    8006ae <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800705:	8b 45 14             	mov    0x14(%ebp),%eax
+  800708:	8b 10                	mov    (%eax),%edx
+  80070a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070f:	8d 40 04             	lea    0x4(%eax),%eax
+  800712:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800715:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80071a:	eb 92                	jmp    8006ae <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80071c:	83 ec 08             	sub    $0x8,%esp
+  80071f:	53                   	push   %ebx
+  800720:	6a 25                	push   $0x25
+  800722:	ff d6                	call   *%esi
+			break;
+  800724:	83 c4 10             	add    $0x10,%esp
+  800727:	eb 9f                	jmp    8006c8 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800729:	83 ec 08             	sub    $0x8,%esp
+  80072c:	53                   	push   %ebx
+  80072d:	6a 25                	push   $0x25
+  80072f:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800731:	83 c4 10             	add    $0x10,%esp
+  800734:	89 f8                	mov    %edi,%eax
+  800736:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80073a:	74 05                	je     800741 <vprintfmt+0x44f>
+  80073c:	83 e8 01             	sub    $0x1,%eax
+  80073f:	eb f5                	jmp    800736 <vprintfmt+0x444>
+  800741:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800744:	eb 82                	jmp    8006c8 <vprintfmt+0x3d6>
+
+00800746 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800746:	55                   	push   %ebp
+  800747:	89 e5                	mov    %esp,%ebp
+  800749:	83 ec 18             	sub    $0x18,%esp
+  80074c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80074f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800752:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800755:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800759:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80075c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800763:	85 c0                	test   %eax,%eax
+  800765:	74 26                	je     80078d <vsnprintf+0x47>
+  800767:	85 d2                	test   %edx,%edx
+  800769:	7e 22                	jle    80078d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80076b:	ff 75 14             	push   0x14(%ebp)
+  80076e:	ff 75 10             	push   0x10(%ebp)
+  800771:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800774:	50                   	push   %eax
+  800775:	68 b8 02 80 00       	push   $0x8002b8
+  80077a:	e8 73 fb ff ff       	call   8002f2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80077f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800782:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800785:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800788:	83 c4 10             	add    $0x10,%esp
+}
+  80078b:	c9                   	leave
+  80078c:	c3                   	ret
+		return -E_INVAL;
+  80078d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800792:	eb f7                	jmp    80078b <vsnprintf+0x45>
+
+00800794 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800794:	55                   	push   %ebp
+  800795:	89 e5                	mov    %esp,%ebp
+  800797:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80079a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80079d:	50                   	push   %eax
+  80079e:	ff 75 10             	push   0x10(%ebp)
+  8007a1:	ff 75 0c             	push   0xc(%ebp)
+  8007a4:	ff 75 08             	push   0x8(%ebp)
+  8007a7:	e8 9a ff ff ff       	call   800746 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007ac:	c9                   	leave
+  8007ad:	c3                   	ret
+
+008007ae <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007ae:	55                   	push   %ebp
+  8007af:	89 e5                	mov    %esp,%ebp
+  8007b1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b9:	eb 03                	jmp    8007be <strlen+0x10>
+		n++;
+  8007bb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007be:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007c2:	75 f7                	jne    8007bb <strlen+0xd>
+	return n;
+}
+  8007c4:	5d                   	pop    %ebp
+  8007c5:	c3                   	ret
+
+008007c6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007c6:	55                   	push   %ebp
+  8007c7:	89 e5                	mov    %esp,%ebp
+  8007c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d4:	eb 03                	jmp    8007d9 <strnlen+0x13>
+		n++;
+  8007d6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007d9:	39 d0                	cmp    %edx,%eax
+  8007db:	74 08                	je     8007e5 <strnlen+0x1f>
+  8007dd:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007e1:	75 f3                	jne    8007d6 <strnlen+0x10>
+  8007e3:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007e5:	89 d0                	mov    %edx,%eax
+  8007e7:	5d                   	pop    %ebp
+  8007e8:	c3                   	ret
+
+008007e9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007e9:	55                   	push   %ebp
+  8007ea:	89 e5                	mov    %esp,%ebp
+  8007ec:	53                   	push   %ebx
+  8007ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007f0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007fc:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007ff:	83 c0 01             	add    $0x1,%eax
+  800802:	84 d2                	test   %dl,%dl
+  800804:	75 f2                	jne    8007f8 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800806:	89 c8                	mov    %ecx,%eax
+  800808:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80080b:	c9                   	leave
+  80080c:	c3                   	ret
+
+0080080d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80080d:	55                   	push   %ebp
+  80080e:	89 e5                	mov    %esp,%ebp
+  800810:	53                   	push   %ebx
+  800811:	83 ec 10             	sub    $0x10,%esp
+  800814:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800817:	53                   	push   %ebx
+  800818:	e8 91 ff ff ff       	call   8007ae <strlen>
+  80081d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800820:	ff 75 0c             	push   0xc(%ebp)
+  800823:	01 d8                	add    %ebx,%eax
+  800825:	50                   	push   %eax
+  800826:	e8 be ff ff ff       	call   8007e9 <strcpy>
+	return dst;
+}
+  80082b:	89 d8                	mov    %ebx,%eax
+  80082d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800830:	c9                   	leave
+  800831:	c3                   	ret
+
+00800832 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800832:	55                   	push   %ebp
+  800833:	89 e5                	mov    %esp,%ebp
+  800835:	56                   	push   %esi
+  800836:	53                   	push   %ebx
+  800837:	8b 75 08             	mov    0x8(%ebp),%esi
+  80083a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80083d:	89 f3                	mov    %esi,%ebx
+  80083f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800842:	89 f0                	mov    %esi,%eax
+  800844:	eb 0f                	jmp    800855 <strncpy+0x23>
+		*dst++ = *src;
+  800846:	83 c0 01             	add    $0x1,%eax
+  800849:	0f b6 0a             	movzbl (%edx),%ecx
+  80084c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80084f:	80 f9 01             	cmp    $0x1,%cl
+  800852:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800855:	39 d8                	cmp    %ebx,%eax
+  800857:	75 ed                	jne    800846 <strncpy+0x14>
+	}
+	return ret;
+}
+  800859:	89 f0                	mov    %esi,%eax
+  80085b:	5b                   	pop    %ebx
+  80085c:	5e                   	pop    %esi
+  80085d:	5d                   	pop    %ebp
+  80085e:	c3                   	ret
+
+0080085f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80085f:	55                   	push   %ebp
+  800860:	89 e5                	mov    %esp,%ebp
+  800862:	56                   	push   %esi
+  800863:	53                   	push   %ebx
+  800864:	8b 75 08             	mov    0x8(%ebp),%esi
+  800867:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80086a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80086d:	89 f0                	mov    %esi,%eax
+  80086f:	85 d2                	test   %edx,%edx
+  800871:	74 21                	je     800894 <strlcpy+0x35>
+  800873:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800877:	89 f2                	mov    %esi,%edx
+  800879:	eb 09                	jmp    800884 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80087b:	83 c1 01             	add    $0x1,%ecx
+  80087e:	83 c2 01             	add    $0x1,%edx
+  800881:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800884:	39 c2                	cmp    %eax,%edx
+  800886:	74 09                	je     800891 <strlcpy+0x32>
+  800888:	0f b6 19             	movzbl (%ecx),%ebx
+  80088b:	84 db                	test   %bl,%bl
+  80088d:	75 ec                	jne    80087b <strlcpy+0x1c>
+  80088f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800891:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800894:	29 f0                	sub    %esi,%eax
+}
+  800896:	5b                   	pop    %ebx
+  800897:	5e                   	pop    %esi
+  800898:	5d                   	pop    %ebp
+  800899:	c3                   	ret
+
+0080089a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80089a:	55                   	push   %ebp
+  80089b:	89 e5                	mov    %esp,%ebp
+  80089d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008a3:	eb 06                	jmp    8008ab <strcmp+0x11>
+		p++, q++;
+  8008a5:	83 c1 01             	add    $0x1,%ecx
+  8008a8:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008ab:	0f b6 01             	movzbl (%ecx),%eax
+  8008ae:	84 c0                	test   %al,%al
+  8008b0:	74 04                	je     8008b6 <strcmp+0x1c>
+  8008b2:	3a 02                	cmp    (%edx),%al
+  8008b4:	74 ef                	je     8008a5 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008b6:	0f b6 c0             	movzbl %al,%eax
+  8008b9:	0f b6 12             	movzbl (%edx),%edx
+  8008bc:	29 d0                	sub    %edx,%eax
+}
+  8008be:	5d                   	pop    %ebp
+  8008bf:	c3                   	ret
+
+008008c0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008c0:	55                   	push   %ebp
+  8008c1:	89 e5                	mov    %esp,%ebp
+  8008c3:	53                   	push   %ebx
+  8008c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ca:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008cd:	eb 09                	jmp    8008d8 <strncmp+0x18>
+		n--, p++, q++;
+  8008cf:	83 ea 01             	sub    $0x1,%edx
+  8008d2:	83 c0 01             	add    $0x1,%eax
+  8008d5:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008d8:	85 d2                	test   %edx,%edx
+  8008da:	74 18                	je     8008f4 <strncmp+0x34>
+  8008dc:	0f b6 18             	movzbl (%eax),%ebx
+  8008df:	84 db                	test   %bl,%bl
+  8008e1:	74 04                	je     8008e7 <strncmp+0x27>
+  8008e3:	3a 19                	cmp    (%ecx),%bl
+  8008e5:	74 e8                	je     8008cf <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008e7:	0f b6 00             	movzbl (%eax),%eax
+  8008ea:	0f b6 11             	movzbl (%ecx),%edx
+  8008ed:	29 d0                	sub    %edx,%eax
+}
+  8008ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f2:	c9                   	leave
+  8008f3:	c3                   	ret
+		return 0;
+  8008f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f9:	eb f4                	jmp    8008ef <strncmp+0x2f>
+
+008008fb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008fb:	55                   	push   %ebp
+  8008fc:	89 e5                	mov    %esp,%ebp
+  8008fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800901:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800905:	eb 03                	jmp    80090a <strchr+0xf>
+  800907:	83 c0 01             	add    $0x1,%eax
+  80090a:	0f b6 10             	movzbl (%eax),%edx
+  80090d:	84 d2                	test   %dl,%dl
+  80090f:	74 06                	je     800917 <strchr+0x1c>
+		if (*s == c)
+  800911:	38 ca                	cmp    %cl,%dl
+  800913:	75 f2                	jne    800907 <strchr+0xc>
+  800915:	eb 05                	jmp    80091c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800917:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80091c:	5d                   	pop    %ebp
+  80091d:	c3                   	ret
+
+0080091e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80091e:	55                   	push   %ebp
+  80091f:	89 e5                	mov    %esp,%ebp
+  800921:	8b 45 08             	mov    0x8(%ebp),%eax
+  800924:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800928:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80092b:	38 ca                	cmp    %cl,%dl
+  80092d:	74 09                	je     800938 <strfind+0x1a>
+  80092f:	84 d2                	test   %dl,%dl
+  800931:	74 05                	je     800938 <strfind+0x1a>
+	for (; *s; s++)
+  800933:	83 c0 01             	add    $0x1,%eax
+  800936:	eb f0                	jmp    800928 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800938:	5d                   	pop    %ebp
+  800939:	c3                   	ret
+
+0080093a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80093a:	55                   	push   %ebp
+  80093b:	89 e5                	mov    %esp,%ebp
+  80093d:	57                   	push   %edi
+  80093e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800941:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800944:	85 c9                	test   %ecx,%ecx
+  800946:	74 20                	je     800968 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800948:	89 f8                	mov    %edi,%eax
+  80094a:	09 c8                	or     %ecx,%eax
+  80094c:	a8 03                	test   $0x3,%al
+  80094e:	75 12                	jne    800962 <memset+0x28>
+		c &= 0xFF;
+  800950:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800954:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80095a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80095d:	fc                   	cld
+  80095e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800960:	eb 06                	jmp    800968 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800962:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800965:	fc                   	cld
+  800966:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800968:	89 f8                	mov    %edi,%eax
+  80096a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80096d:	c9                   	leave
+  80096e:	c3                   	ret
+
+0080096f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80096f:	55                   	push   %ebp
+  800970:	89 e5                	mov    %esp,%ebp
+  800972:	57                   	push   %edi
+  800973:	56                   	push   %esi
+  800974:	8b 45 08             	mov    0x8(%ebp),%eax
+  800977:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80097a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80097d:	39 c6                	cmp    %eax,%esi
+  80097f:	73 32                	jae    8009b3 <memmove+0x44>
+  800981:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800984:	39 d0                	cmp    %edx,%eax
+  800986:	73 2b                	jae    8009b3 <memmove+0x44>
+		s += n;
+		d += n;
+  800988:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80098b:	89 d6                	mov    %edx,%esi
+  80098d:	09 fe                	or     %edi,%esi
+  80098f:	09 ce                	or     %ecx,%esi
+  800991:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800997:	75 0e                	jne    8009a7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800999:	83 ef 04             	sub    $0x4,%edi
+  80099c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80099f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009a2:	fd                   	std
+  8009a3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009a5:	eb 09                	jmp    8009b0 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009a7:	83 ef 01             	sub    $0x1,%edi
+  8009aa:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009ad:	fd                   	std
+  8009ae:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009b0:	fc                   	cld
+  8009b1:	eb 1a                	jmp    8009cd <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009b3:	89 f2                	mov    %esi,%edx
+  8009b5:	09 c2                	or     %eax,%edx
+  8009b7:	09 ca                	or     %ecx,%edx
+  8009b9:	f6 c2 03             	test   $0x3,%dl
+  8009bc:	75 0a                	jne    8009c8 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009be:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009c1:	89 c7                	mov    %eax,%edi
+  8009c3:	fc                   	cld
+  8009c4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009c6:	eb 05                	jmp    8009cd <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009c8:	89 c7                	mov    %eax,%edi
+  8009ca:	fc                   	cld
+  8009cb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009cd:	5e                   	pop    %esi
+  8009ce:	5f                   	pop    %edi
+  8009cf:	5d                   	pop    %ebp
+  8009d0:	c3                   	ret
+
+008009d1 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009d7:	ff 75 10             	push   0x10(%ebp)
+  8009da:	ff 75 0c             	push   0xc(%ebp)
+  8009dd:	ff 75 08             	push   0x8(%ebp)
+  8009e0:	e8 8a ff ff ff       	call   80096f <memmove>
+}
+  8009e5:	c9                   	leave
+  8009e6:	c3                   	ret
+
+008009e7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009e7:	55                   	push   %ebp
+  8009e8:	89 e5                	mov    %esp,%ebp
+  8009ea:	56                   	push   %esi
+  8009eb:	53                   	push   %ebx
+  8009ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009f2:	89 c6                	mov    %eax,%esi
+  8009f4:	03 75 10             	add    0x10(%ebp),%esi
+  8009f7:	eb 06                	jmp    8009ff <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009f9:	83 c0 01             	add    $0x1,%eax
+  8009fc:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009ff:	39 f0                	cmp    %esi,%eax
+  800a01:	74 14                	je     800a17 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a03:	0f b6 08             	movzbl (%eax),%ecx
+  800a06:	0f b6 1a             	movzbl (%edx),%ebx
+  800a09:	38 d9                	cmp    %bl,%cl
+  800a0b:	74 ec                	je     8009f9 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a0d:	0f b6 c1             	movzbl %cl,%eax
+  800a10:	0f b6 db             	movzbl %bl,%ebx
+  800a13:	29 d8                	sub    %ebx,%eax
+  800a15:	eb 05                	jmp    800a1c <memcmp+0x35>
+	}
+
+	return 0;
+  800a17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a1c:	5b                   	pop    %ebx
+  800a1d:	5e                   	pop    %esi
+  800a1e:	5d                   	pop    %ebp
+  800a1f:	c3                   	ret
+
+00800a20 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a20:	55                   	push   %ebp
+  800a21:	89 e5                	mov    %esp,%ebp
+  800a23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a29:	89 c2                	mov    %eax,%edx
+  800a2b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a2e:	eb 03                	jmp    800a33 <memfind+0x13>
+  800a30:	83 c0 01             	add    $0x1,%eax
+  800a33:	39 d0                	cmp    %edx,%eax
+  800a35:	73 04                	jae    800a3b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a37:	38 08                	cmp    %cl,(%eax)
+  800a39:	75 f5                	jne    800a30 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a3b:	5d                   	pop    %ebp
+  800a3c:	c3                   	ret
+
+00800a3d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a3d:	55                   	push   %ebp
+  800a3e:	89 e5                	mov    %esp,%ebp
+  800a40:	57                   	push   %edi
+  800a41:	56                   	push   %esi
+  800a42:	53                   	push   %ebx
+  800a43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a49:	eb 03                	jmp    800a4e <strtol+0x11>
+		s++;
+  800a4b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a4e:	0f b6 02             	movzbl (%edx),%eax
+  800a51:	3c 20                	cmp    $0x20,%al
+  800a53:	74 f6                	je     800a4b <strtol+0xe>
+  800a55:	3c 09                	cmp    $0x9,%al
+  800a57:	74 f2                	je     800a4b <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a59:	3c 2b                	cmp    $0x2b,%al
+  800a5b:	74 2a                	je     800a87 <strtol+0x4a>
+	int neg = 0;
+  800a5d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a62:	3c 2d                	cmp    $0x2d,%al
+  800a64:	74 2b                	je     800a91 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a66:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a6c:	75 0f                	jne    800a7d <strtol+0x40>
+  800a6e:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a71:	74 28                	je     800a9b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a73:	85 db                	test   %ebx,%ebx
+  800a75:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a7a:	0f 44 d8             	cmove  %eax,%ebx
+  800a7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a82:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a85:	eb 46                	jmp    800acd <strtol+0x90>
+		s++;
+  800a87:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a8f:	eb d5                	jmp    800a66 <strtol+0x29>
+		s++, neg = 1;
+  800a91:	83 c2 01             	add    $0x1,%edx
+  800a94:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a99:	eb cb                	jmp    800a66 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a9b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a9f:	74 0e                	je     800aaf <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800aa1:	85 db                	test   %ebx,%ebx
+  800aa3:	75 d8                	jne    800a7d <strtol+0x40>
+		s++, base = 8;
+  800aa5:	83 c2 01             	add    $0x1,%edx
+  800aa8:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aad:	eb ce                	jmp    800a7d <strtol+0x40>
+		s += 2, base = 16;
+  800aaf:	83 c2 02             	add    $0x2,%edx
+  800ab2:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ab7:	eb c4                	jmp    800a7d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ab9:	0f be c0             	movsbl %al,%eax
+  800abc:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800abf:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ac2:	7d 3a                	jge    800afe <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ac4:	83 c2 01             	add    $0x1,%edx
+  800ac7:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800acb:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800acd:	0f b6 02             	movzbl (%edx),%eax
+  800ad0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ad3:	89 f3                	mov    %esi,%ebx
+  800ad5:	80 fb 09             	cmp    $0x9,%bl
+  800ad8:	76 df                	jbe    800ab9 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ada:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800add:	89 f3                	mov    %esi,%ebx
+  800adf:	80 fb 19             	cmp    $0x19,%bl
+  800ae2:	77 08                	ja     800aec <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ae4:	0f be c0             	movsbl %al,%eax
+  800ae7:	83 e8 57             	sub    $0x57,%eax
+  800aea:	eb d3                	jmp    800abf <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800aec:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aef:	89 f3                	mov    %esi,%ebx
+  800af1:	80 fb 19             	cmp    $0x19,%bl
+  800af4:	77 08                	ja     800afe <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800af6:	0f be c0             	movsbl %al,%eax
+  800af9:	83 e8 37             	sub    $0x37,%eax
+  800afc:	eb c1                	jmp    800abf <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800afe:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b02:	74 05                	je     800b09 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b04:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b07:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b09:	89 c8                	mov    %ecx,%eax
+  800b0b:	f7 d8                	neg    %eax
+  800b0d:	85 ff                	test   %edi,%edi
+  800b0f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b12:	89 c8                	mov    %ecx,%eax
+  800b14:	5b                   	pop    %ebx
+  800b15:	5e                   	pop    %esi
+  800b16:	5f                   	pop    %edi
+  800b17:	5d                   	pop    %ebp
+  800b18:	c3                   	ret
+
+00800b19 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b19:	55                   	push   %ebp
+  800b1a:	89 e5                	mov    %esp,%ebp
+  800b1c:	57                   	push   %edi
+  800b1d:	56                   	push   %esi
+  800b1e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b24:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b2a:	89 c3                	mov    %eax,%ebx
+  800b2c:	89 c7                	mov    %eax,%edi
+  800b2e:	55                   	push   %ebp
+  800b2f:	89 e5                	mov    %esp,%ebp
+  800b31:	8d 35 39 0b 80 00    	lea    0x800b39,%esi
+  800b37:	0f 34                	sysenter
+  800b39:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800b3a:	5b                   	pop    %ebx
+  800b3b:	5e                   	pop    %esi
+  800b3c:	5f                   	pop    %edi
+  800b3d:	5d                   	pop    %ebp
+  800b3e:	c3                   	ret
+
+00800b3f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b3f:	55                   	push   %ebp
+  800b40:	89 e5                	mov    %esp,%ebp
+  800b42:	57                   	push   %edi
+  800b43:	56                   	push   %esi
+  800b44:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b4f:	89 d1                	mov    %edx,%ecx
+  800b51:	89 d3                	mov    %edx,%ebx
+  800b53:	89 d7                	mov    %edx,%edi
+  800b55:	55                   	push   %ebp
+  800b56:	89 e5                	mov    %esp,%ebp
+  800b58:	8d 35 60 0b 80 00    	lea    0x800b60,%esi
+  800b5e:	0f 34                	sysenter
+  800b60:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800b61:	5b                   	pop    %ebx
+  800b62:	5e                   	pop    %esi
+  800b63:	5f                   	pop    %edi
+  800b64:	5d                   	pop    %ebp
+  800b65:	c3                   	ret
+
+00800b66 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b66:	55                   	push   %ebp
+  800b67:	89 e5                	mov    %esp,%ebp
+  800b69:	57                   	push   %edi
+  800b6a:	56                   	push   %esi
+  800b6b:	53                   	push   %ebx
+  800b6c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b77:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b7c:	89 cb                	mov    %ecx,%ebx
+  800b7e:	89 cf                	mov    %ecx,%edi
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	8d 35 8b 0b 80 00    	lea    0x800b8b,%esi
+  800b89:	0f 34                	sysenter
+  800b8b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b8c:	85 c0                	test   %eax,%eax
+  800b8e:	7f 08                	jg     800b98 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800b90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b93:	5b                   	pop    %ebx
+  800b94:	5e                   	pop    %esi
+  800b95:	5f                   	pop    %edi
+  800b96:	5d                   	pop    %ebp
+  800b97:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b98:	83 ec 0c             	sub    $0xc,%esp
+  800b9b:	50                   	push   %eax
+  800b9c:	6a 03                	push   $0x3
+  800b9e:	68 a7 3b 80 00       	push   $0x803ba7
+  800ba3:	6a 3d                	push   $0x3d
+  800ba5:	68 c4 3b 80 00       	push   $0x803bc4
+  800baa:	e8 fa 28 00 00       	call   8034a9 <_panic>
+
+00800baf <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800baf:	55                   	push   %ebp
+  800bb0:	89 e5                	mov    %esp,%ebp
+  800bb2:	57                   	push   %edi
+  800bb3:	56                   	push   %esi
+  800bb4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800bb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bba:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bbf:	89 d1                	mov    %edx,%ecx
+  800bc1:	89 d3                	mov    %edx,%ebx
+  800bc3:	89 d7                	mov    %edx,%edi
+  800bc5:	55                   	push   %ebp
+  800bc6:	89 e5                	mov    %esp,%ebp
+  800bc8:	8d 35 d0 0b 80 00    	lea    0x800bd0,%esi
+  800bce:	0f 34                	sysenter
+  800bd0:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800bd1:	5b                   	pop    %ebx
+  800bd2:	5e                   	pop    %esi
+  800bd3:	5f                   	pop    %edi
+  800bd4:	5d                   	pop    %ebp
+  800bd5:	c3                   	ret
+
+00800bd6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bd6:	55                   	push   %ebp
+  800bd7:	89 e5                	mov    %esp,%ebp
+  800bd9:	57                   	push   %edi
+  800bda:	56                   	push   %esi
+  800bdb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800be1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800be6:	89 d1                	mov    %edx,%ecx
+  800be8:	89 d3                	mov    %edx,%ebx
+  800bea:	89 d7                	mov    %edx,%edi
+  800bec:	89 d6                	mov    %edx,%esi
+  800bee:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bf0:	5b                   	pop    %ebx
+  800bf1:	5e                   	pop    %esi
+  800bf2:	5f                   	pop    %edi
+  800bf3:	5d                   	pop    %ebp
+  800bf4:	c3                   	ret
+
+00800bf5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bf5:	55                   	push   %ebp
+  800bf6:	89 e5                	mov    %esp,%ebp
+  800bf8:	57                   	push   %edi
+  800bf9:	56                   	push   %esi
+  800bfa:	53                   	push   %ebx
+  800bfb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800bfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c04:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c09:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c11:	55                   	push   %ebp
+  800c12:	89 e5                	mov    %esp,%ebp
+  800c14:	8d 35 1c 0c 80 00    	lea    0x800c1c,%esi
+  800c1a:	0f 34                	sysenter
+  800c1c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c1d:	85 c0                	test   %eax,%eax
+  800c1f:	7f 08                	jg     800c29 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800c21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c24:	5b                   	pop    %ebx
+  800c25:	5e                   	pop    %esi
+  800c26:	5f                   	pop    %edi
+  800c27:	5d                   	pop    %ebp
+  800c28:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c29:	83 ec 0c             	sub    $0xc,%esp
+  800c2c:	50                   	push   %eax
+  800c2d:	6a 04                	push   $0x4
+  800c2f:	68 a7 3b 80 00       	push   $0x803ba7
+  800c34:	6a 3d                	push   $0x3d
+  800c36:	68 c4 3b 80 00       	push   $0x803bc4
+  800c3b:	e8 69 28 00 00       	call   8034a9 <_panic>
+
+00800c40 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c40:	55                   	push   %ebp
+  800c41:	89 e5                	mov    %esp,%ebp
+  800c43:	57                   	push   %edi
+  800c44:	56                   	push   %esi
+  800c45:	53                   	push   %ebx
+  800c46:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c4f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c57:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c5a:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c5d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c5f:	85 c0                	test   %eax,%eax
+  800c61:	7f 08                	jg     800c6b <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c66:	5b                   	pop    %ebx
+  800c67:	5e                   	pop    %esi
+  800c68:	5f                   	pop    %edi
+  800c69:	5d                   	pop    %ebp
+  800c6a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c6b:	83 ec 0c             	sub    $0xc,%esp
+  800c6e:	50                   	push   %eax
+  800c6f:	6a 05                	push   $0x5
+  800c71:	68 a7 3b 80 00       	push   $0x803ba7
+  800c76:	6a 23                	push   $0x23
+  800c78:	68 c4 3b 80 00       	push   $0x803bc4
+  800c7d:	e8 27 28 00 00       	call   8034a9 <_panic>
+
+00800c82 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c82:	55                   	push   %ebp
+  800c83:	89 e5                	mov    %esp,%ebp
+  800c85:	57                   	push   %edi
+  800c86:	56                   	push   %esi
+  800c87:	53                   	push   %ebx
+  800c88:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c96:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c9b:	89 df                	mov    %ebx,%edi
+  800c9d:	55                   	push   %ebp
+  800c9e:	89 e5                	mov    %esp,%ebp
+  800ca0:	8d 35 a8 0c 80 00    	lea    0x800ca8,%esi
+  800ca6:	0f 34                	sysenter
+  800ca8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ca9:	85 c0                	test   %eax,%eax
+  800cab:	7f 08                	jg     800cb5 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800cad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb0:	5b                   	pop    %ebx
+  800cb1:	5e                   	pop    %esi
+  800cb2:	5f                   	pop    %edi
+  800cb3:	5d                   	pop    %ebp
+  800cb4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb5:	83 ec 0c             	sub    $0xc,%esp
+  800cb8:	50                   	push   %eax
+  800cb9:	6a 06                	push   $0x6
+  800cbb:	68 a7 3b 80 00       	push   $0x803ba7
+  800cc0:	6a 3d                	push   $0x3d
+  800cc2:	68 c4 3b 80 00       	push   $0x803bc4
+  800cc7:	e8 dd 27 00 00       	call   8034a9 <_panic>
+
+00800ccc <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ccc:	55                   	push   %ebp
+  800ccd:	89 e5                	mov    %esp,%ebp
+  800ccf:	57                   	push   %edi
+  800cd0:	56                   	push   %esi
+  800cd1:	53                   	push   %ebx
+  800cd2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce0:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ce5:	89 df                	mov    %ebx,%edi
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	8d 35 f2 0c 80 00    	lea    0x800cf2,%esi
+  800cf0:	0f 34                	sysenter
+  800cf2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cf3:	85 c0                	test   %eax,%eax
+  800cf5:	7f 08                	jg     800cff <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800cf7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfa:	5b                   	pop    %ebx
+  800cfb:	5e                   	pop    %esi
+  800cfc:	5f                   	pop    %edi
+  800cfd:	5d                   	pop    %ebp
+  800cfe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cff:	83 ec 0c             	sub    $0xc,%esp
+  800d02:	50                   	push   %eax
+  800d03:	6a 08                	push   $0x8
+  800d05:	68 a7 3b 80 00       	push   $0x803ba7
+  800d0a:	6a 3d                	push   $0x3d
+  800d0c:	68 c4 3b 80 00       	push   $0x803bc4
+  800d11:	e8 93 27 00 00       	call   8034a9 <_panic>
+
+00800d16 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d16:	55                   	push   %ebp
+  800d17:	89 e5                	mov    %esp,%ebp
+  800d19:	57                   	push   %edi
+  800d1a:	56                   	push   %esi
+  800d1b:	53                   	push   %ebx
+  800d1c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d24:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2a:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d2f:	89 df                	mov    %ebx,%edi
+  800d31:	55                   	push   %ebp
+  800d32:	89 e5                	mov    %esp,%ebp
+  800d34:	8d 35 3c 0d 80 00    	lea    0x800d3c,%esi
+  800d3a:	0f 34                	sysenter
+  800d3c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d3d:	85 c0                	test   %eax,%eax
+  800d3f:	7f 08                	jg     800d49 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800d41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d44:	5b                   	pop    %ebx
+  800d45:	5e                   	pop    %esi
+  800d46:	5f                   	pop    %edi
+  800d47:	5d                   	pop    %ebp
+  800d48:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d49:	83 ec 0c             	sub    $0xc,%esp
+  800d4c:	50                   	push   %eax
+  800d4d:	6a 09                	push   $0x9
+  800d4f:	68 a7 3b 80 00       	push   $0x803ba7
+  800d54:	6a 3d                	push   $0x3d
+  800d56:	68 c4 3b 80 00       	push   $0x803bc4
+  800d5b:	e8 49 27 00 00       	call   8034a9 <_panic>
+
+00800d60 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d60:	55                   	push   %ebp
+  800d61:	89 e5                	mov    %esp,%ebp
+  800d63:	57                   	push   %edi
+  800d64:	56                   	push   %esi
+  800d65:	53                   	push   %ebx
+  800d66:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d74:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d79:	89 df                	mov    %ebx,%edi
+  800d7b:	55                   	push   %ebp
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	8d 35 86 0d 80 00    	lea    0x800d86,%esi
+  800d84:	0f 34                	sysenter
+  800d86:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d87:	85 c0                	test   %eax,%eax
+  800d89:	7f 08                	jg     800d93 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800d8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8e:	5b                   	pop    %ebx
+  800d8f:	5e                   	pop    %esi
+  800d90:	5f                   	pop    %edi
+  800d91:	5d                   	pop    %ebp
+  800d92:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d93:	83 ec 0c             	sub    $0xc,%esp
+  800d96:	50                   	push   %eax
+  800d97:	6a 0a                	push   $0xa
+  800d99:	68 a7 3b 80 00       	push   $0x803ba7
+  800d9e:	6a 3d                	push   $0x3d
+  800da0:	68 c4 3b 80 00       	push   $0x803bc4
+  800da5:	e8 ff 26 00 00       	call   8034a9 <_panic>
+
+00800daa <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	57                   	push   %edi
+  800dae:	56                   	push   %esi
+  800daf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800db0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800dbb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc1:	55                   	push   %ebp
+  800dc2:	89 e5                	mov    %esp,%ebp
+  800dc4:	8d 35 cc 0d 80 00    	lea    0x800dcc,%esi
+  800dca:	0f 34                	sysenter
+  800dcc:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800dcd:	5b                   	pop    %ebx
+  800dce:	5e                   	pop    %esi
+  800dcf:	5f                   	pop    %edi
+  800dd0:	5d                   	pop    %ebp
+  800dd1:	c3                   	ret
+
+00800dd2 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800dd2:	55                   	push   %ebp
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	57                   	push   %edi
+  800dd6:	56                   	push   %esi
+  800dd7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800dd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dde:	b8 17 00 00 00       	mov    $0x17,%eax
+  800de3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800de9:	55                   	push   %ebp
+  800dea:	89 e5                	mov    %esp,%ebp
+  800dec:	8d 35 f4 0d 80 00    	lea    0x800df4,%esi
+  800df2:	0f 34                	sysenter
+  800df4:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800df5:	5b                   	pop    %ebx
+  800df6:	5e                   	pop    %esi
+  800df7:	5f                   	pop    %edi
+  800df8:	5d                   	pop    %ebp
+  800df9:	c3                   	ret
+
+00800dfa <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800dfa:	55                   	push   %ebp
+  800dfb:	89 e5                	mov    %esp,%ebp
+  800dfd:	57                   	push   %edi
+  800dfe:	56                   	push   %esi
+  800dff:	53                   	push   %ebx
+  800e00:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e03:	be 00 00 00 00       	mov    $0x0,%esi
+  800e08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e13:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e16:	89 f7                	mov    %esi,%edi
+  800e18:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e1a:	85 c0                	test   %eax,%eax
+  800e1c:	7f 08                	jg     800e26 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800e1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e21:	5b                   	pop    %ebx
+  800e22:	5e                   	pop    %esi
+  800e23:	5f                   	pop    %edi
+  800e24:	5d                   	pop    %ebp
+  800e25:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e26:	83 ec 0c             	sub    $0xc,%esp
+  800e29:	50                   	push   %eax
+  800e2a:	6a 0d                	push   $0xd
+  800e2c:	68 a7 3b 80 00       	push   $0x803ba7
+  800e31:	6a 23                	push   $0x23
+  800e33:	68 c4 3b 80 00       	push   $0x803bc4
+  800e38:	e8 6c 26 00 00       	call   8034a9 <_panic>
+
+00800e3d <sys_ipc_recv>:
+{
+  800e3d:	55                   	push   %ebp
+  800e3e:	89 e5                	mov    %esp,%ebp
+  800e40:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800e43:	6a 00                	push   $0x0
+  800e45:	6a 01                	push   $0x1
+  800e47:	ff 75 08             	push   0x8(%ebp)
+  800e4a:	e8 ab ff ff ff       	call   800dfa <sys_ipc_recvv>
+}
+  800e4f:	c9                   	leave
+  800e50:	c3                   	ret
+
+00800e51 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800e51:	55                   	push   %ebp
+  800e52:	89 e5                	mov    %esp,%ebp
+  800e54:	57                   	push   %edi
+  800e55:	56                   	push   %esi
+  800e56:	53                   	push   %ebx
+  800e57:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e65:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e6a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e6d:	89 de                	mov    %ebx,%esi
+  800e6f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e71:	85 c0                	test   %eax,%eax
+  800e73:	7f 08                	jg     800e7d <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800e75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e78:	5b                   	pop    %ebx
+  800e79:	5e                   	pop    %esi
+  800e7a:	5f                   	pop    %edi
+  800e7b:	5d                   	pop    %ebp
+  800e7c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e7d:	83 ec 0c             	sub    $0xc,%esp
+  800e80:	50                   	push   %eax
+  800e81:	6a 0d                	push   $0xd
+  800e83:	68 a7 3b 80 00       	push   $0x803ba7
+  800e88:	6a 23                	push   $0x23
+  800e8a:	68 c4 3b 80 00       	push   $0x803bc4
+  800e8f:	e8 15 26 00 00       	call   8034a9 <_panic>
+
+00800e94 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e94:	55                   	push   %ebp
+  800e95:	89 e5                	mov    %esp,%ebp
+  800e97:	57                   	push   %edi
+  800e98:	56                   	push   %esi
+  800e99:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e9f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ea4:	89 d1                	mov    %edx,%ecx
+  800ea6:	89 d3                	mov    %edx,%ebx
+  800ea8:	89 d7                	mov    %edx,%edi
+  800eaa:	55                   	push   %ebp
+  800eab:	89 e5                	mov    %esp,%ebp
+  800ead:	8d 35 b5 0e 80 00    	lea    0x800eb5,%esi
+  800eb3:	0f 34                	sysenter
+  800eb5:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800eb6:	5b                   	pop    %ebx
+  800eb7:	5e                   	pop    %esi
+  800eb8:	5f                   	pop    %edi
+  800eb9:	5d                   	pop    %ebp
+  800eba:	c3                   	ret
+
+00800ebb <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800ebb:	55                   	push   %ebp
+  800ebc:	89 e5                	mov    %esp,%ebp
+  800ebe:	57                   	push   %edi
+  800ebf:	56                   	push   %esi
+  800ec0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ec1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ed1:	89 df                	mov    %ebx,%edi
+  800ed3:	55                   	push   %ebp
+  800ed4:	89 e5                	mov    %esp,%ebp
+  800ed6:	8d 35 de 0e 80 00    	lea    0x800ede,%esi
+  800edc:	0f 34                	sysenter
+  800ede:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800edf:	5b                   	pop    %ebx
+  800ee0:	5e                   	pop    %esi
+  800ee1:	5f                   	pop    %edi
+  800ee2:	5d                   	pop    %ebp
+  800ee3:	c3                   	ret
+
+00800ee4 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800ee4:	55                   	push   %ebp
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	57                   	push   %edi
+  800ee8:	56                   	push   %esi
+  800ee9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef2:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ef7:	89 cb                	mov    %ecx,%ebx
+  800ef9:	89 cf                	mov    %ecx,%edi
+  800efb:	55                   	push   %ebp
+  800efc:	89 e5                	mov    %esp,%ebp
+  800efe:	8d 35 06 0f 80 00    	lea    0x800f06,%esi
+  800f04:	0f 34                	sysenter
+  800f06:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800f07:	5b                   	pop    %ebx
+  800f08:	5e                   	pop    %esi
+  800f09:	5f                   	pop    %edi
+  800f0a:	5d                   	pop    %ebp
+  800f0b:	c3                   	ret
+
+00800f0c <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800f0c:	55                   	push   %ebp
+  800f0d:	89 e5                	mov    %esp,%ebp
+  800f0f:	57                   	push   %edi
+  800f10:	56                   	push   %esi
+  800f11:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1d:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f22:	89 df                	mov    %ebx,%edi
+  800f24:	55                   	push   %ebp
+  800f25:	89 e5                	mov    %esp,%ebp
+  800f27:	8d 35 2f 0f 80 00    	lea    0x800f2f,%esi
+  800f2d:	0f 34                	sysenter
+  800f2f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800f30:	5b                   	pop    %ebx
+  800f31:	5e                   	pop    %esi
+  800f32:	5f                   	pop    %edi
+  800f33:	5d                   	pop    %ebp
+  800f34:	c3                   	ret
+
+00800f35 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800f35:	55                   	push   %ebp
+  800f36:	89 e5                	mov    %esp,%ebp
+  800f38:	57                   	push   %edi
+  800f39:	56                   	push   %esi
+  800f3a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f46:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f4b:	89 df                	mov    %ebx,%edi
+  800f4d:	55                   	push   %ebp
+  800f4e:	89 e5                	mov    %esp,%ebp
+  800f50:	8d 35 58 0f 80 00    	lea    0x800f58,%esi
+  800f56:	0f 34                	sysenter
+  800f58:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800f59:	5b                   	pop    %ebx
+  800f5a:	5e                   	pop    %esi
+  800f5b:	5f                   	pop    %edi
+  800f5c:	5d                   	pop    %ebp
+  800f5d:	c3                   	ret
+
+00800f5e <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6a:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f72:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f75:	55                   	push   %ebp
+  800f76:	89 e5                	mov    %esp,%ebp
+  800f78:	8d 35 80 0f 80 00    	lea    0x800f80,%esi
+  800f7e:	0f 34                	sysenter
+  800f80:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800f81:	5b                   	pop    %ebx
+  800f82:	5e                   	pop    %esi
+  800f83:	5f                   	pop    %edi
+  800f84:	5d                   	pop    %ebp
+  800f85:	c3                   	ret
+
+00800f86 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800f86:	55                   	push   %ebp
+  800f87:	89 e5                	mov    %esp,%ebp
+  800f89:	57                   	push   %edi
+  800f8a:	56                   	push   %esi
+  800f8b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f94:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f99:	89 cb                	mov    %ecx,%ebx
+  800f9b:	89 cf                	mov    %ecx,%edi
+  800f9d:	89 ce                	mov    %ecx,%esi
+  800f9f:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800fa1:	5b                   	pop    %ebx
+  800fa2:	5e                   	pop    %esi
+  800fa3:	5f                   	pop    %edi
+  800fa4:	5d                   	pop    %ebp
+  800fa5:	c3                   	ret
+
+00800fa6 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800fa6:	55                   	push   %ebp
+  800fa7:	89 e5                	mov    %esp,%ebp
+  800fa9:	57                   	push   %edi
+  800faa:	56                   	push   %esi
+  800fab:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb4:	b8 15 00 00 00       	mov    $0x15,%eax
+  800fb9:	89 cb                	mov    %ecx,%ebx
+  800fbb:	89 cf                	mov    %ecx,%edi
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	8d 35 c8 0f 80 00    	lea    0x800fc8,%esi
+  800fc6:	0f 34                	sysenter
+  800fc8:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800fc9:	5b                   	pop    %ebx
+  800fca:	5e                   	pop    %esi
+  800fcb:	5f                   	pop    %edi
+  800fcc:	5d                   	pop    %ebp
+  800fcd:	c3                   	ret
+
+00800fce <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	57                   	push   %edi
+  800fd2:	56                   	push   %esi
+  800fd3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fd4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fe1:	89 cb                	mov    %ecx,%ebx
+  800fe3:	89 cf                	mov    %ecx,%edi
+  800fe5:	55                   	push   %ebp
+  800fe6:	89 e5                	mov    %esp,%ebp
+  800fe8:	8d 35 f0 0f 80 00    	lea    0x800ff0,%esi
+  800fee:	0f 34                	sysenter
+  800ff0:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800ff1:	5b                   	pop    %ebx
+  800ff2:	5e                   	pop    %esi
+  800ff3:	5f                   	pop    %edi
+  800ff4:	5d                   	pop    %ebp
+  800ff5:	c3                   	ret
+
+00800ff6 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	57                   	push   %edi
+  800ffa:	56                   	push   %esi
+  800ffb:	53                   	push   %ebx
+  800ffc:	83 ec 20             	sub    $0x20,%esp
+  800fff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801002:	89 d7                	mov    %edx,%edi
+  801004:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  801006:	51                   	push   %ecx
+  801007:	68 00 f0 7f 00       	push   $0x7ff000
+  80100c:	6a 00                	push   $0x0
+  80100e:	e8 e2 fb ff ff       	call   800bf5 <sys_page_alloc>
+  801013:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801015:	83 c4 10             	add    $0x10,%esp
+  801018:	85 c0                	test   %eax,%eax
+  80101a:	78 45                	js     801061 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  80101c:	83 ec 04             	sub    $0x4,%esp
+  80101f:	68 00 10 00 00       	push   $0x1000
+  801024:	57                   	push   %edi
+  801025:	68 00 f0 7f 00       	push   $0x7ff000
+  80102a:	e8 40 f9 ff ff       	call   80096f <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  80102f:	89 34 24             	mov    %esi,(%esp)
+  801032:	57                   	push   %edi
+  801033:	ff 75 e4             	push   -0x1c(%ebp)
+  801036:	68 00 f0 7f 00       	push   $0x7ff000
+  80103b:	6a 00                	push   $0x0
+  80103d:	e8 fe fb ff ff       	call   800c40 <sys_page_map>
+  801042:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801044:	83 c4 20             	add    $0x20,%esp
+  801047:	85 c0                	test   %eax,%eax
+  801049:	78 16                	js     801061 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80104b:	83 ec 08             	sub    $0x8,%esp
+  80104e:	68 00 f0 7f 00       	push   $0x7ff000
+  801053:	6a 00                	push   $0x0
+  801055:	e8 28 fc ff ff       	call   800c82 <sys_page_unmap>
+  80105a:	83 c4 10             	add    $0x10,%esp
+  80105d:	85 c0                	test   %eax,%eax
+  80105f:	75 0a                	jne    80106b <copy_page_to+0x75>
+exit:
+	return r;
+}
+  801061:	89 d8                	mov    %ebx,%eax
+  801063:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801066:	5b                   	pop    %ebx
+  801067:	5e                   	pop    %esi
+  801068:	5f                   	pop    %edi
+  801069:	5d                   	pop    %ebp
+  80106a:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80106b:	68 d4 3b 80 00       	push   $0x803bd4
+  801070:	68 4c 3c 80 00       	push   $0x803c4c
+  801075:	6a 1b                	push   $0x1b
+  801077:	68 61 3c 80 00       	push   $0x803c61
+  80107c:	e8 28 24 00 00       	call   8034a9 <_panic>
+
+00801081 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801081:	55                   	push   %ebp
+  801082:	89 e5                	mov    %esp,%ebp
+  801084:	53                   	push   %ebx
+  801085:	83 ec 04             	sub    $0x4,%esp
+  801088:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  80108b:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80108d:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  801091:	74 21                	je     8010b4 <pgfault+0x33>
+  801093:	89 d0                	mov    %edx,%eax
+  801095:	c1 e8 16             	shr    $0x16,%eax
+  801098:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80109f:	a8 01                	test   $0x1,%al
+  8010a1:	74 11                	je     8010b4 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  8010a3:	89 d0                	mov    %edx,%eax
+  8010a5:	c1 e8 0c             	shr    $0xc,%eax
+  8010a8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010af:	f6 c4 08             	test   $0x8,%ah
+  8010b2:	75 17                	jne    8010cb <pgfault+0x4a>
+		if (pgfault_next) {
+  8010b4:	a1 08 50 80 00       	mov    0x805008,%eax
+  8010b9:	85 c0                	test   %eax,%eax
+  8010bb:	74 27                	je     8010e4 <pgfault+0x63>
+			pgfault_next(utf);
+  8010bd:	83 ec 0c             	sub    $0xc,%esp
+  8010c0:	53                   	push   %ebx
+  8010c1:	ff d0                	call   *%eax
+			return;
+  8010c3:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8010c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010c9:	c9                   	leave
+  8010ca:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8010cb:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8010d1:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8010d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010db:	e8 16 ff ff ff       	call   800ff6 <copy_page_to>
+  8010e0:	85 c0                	test   %eax,%eax
+  8010e2:	79 e2                	jns    8010c6 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8010e4:	a1 04 50 80 00       	mov    0x805004,%eax
+  8010e9:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8010ec:	ff 73 28             	push   0x28(%ebx)
+  8010ef:	ff 33                	push   (%ebx)
+  8010f1:	50                   	push   %eax
+  8010f2:	68 f8 3b 80 00       	push   $0x803bf8
+  8010f7:	e8 ff f0 ff ff       	call   8001fb <cprintf>
+	sys_env_destroy(0);
+  8010fc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801103:	e8 5e fa ff ff       	call   800b66 <sys_env_destroy>
+  801108:	83 c4 10             	add    $0x10,%esp
+  80110b:	eb b9                	jmp    8010c6 <pgfault+0x45>
+
+0080110d <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  80110d:	55                   	push   %ebp
+  80110e:	89 e5                	mov    %esp,%ebp
+  801110:	53                   	push   %ebx
+  801111:	83 ec 04             	sub    $0x4,%esp
+  801114:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  801117:	a1 04 90 80 00       	mov    0x809004,%eax
+  80111c:	3d 81 10 80 00       	cmp    $0x801081,%eax
+  801121:	74 15                	je     801138 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  801123:	a3 08 50 80 00       	mov    %eax,0x805008
+		set_pgfault_handler(pgfault);
+  801128:	83 ec 0c             	sub    $0xc,%esp
+  80112b:	68 81 10 80 00       	push   $0x801081
+  801130:	e8 ba 23 00 00       	call   8034ef <set_pgfault_handler>
+  801135:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801138:	83 ec 0c             	sub    $0xc,%esp
+  80113b:	68 05 08 00 00       	push   $0x805
+  801140:	53                   	push   %ebx
+  801141:	6a 00                	push   $0x0
+  801143:	53                   	push   %ebx
+  801144:	6a 00                	push   $0x0
+  801146:	e8 f5 fa ff ff       	call   800c40 <sys_page_map>
+}
+  80114b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80114e:	c9                   	leave
+  80114f:	c3                   	ret
+
+00801150 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801150:	55                   	push   %ebp
+  801151:	89 e5                	mov    %esp,%ebp
+  801153:	57                   	push   %edi
+  801154:	56                   	push   %esi
+  801155:	53                   	push   %ebx
+  801156:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801159:	68 81 10 80 00       	push   $0x801081
+  80115e:	e8 8c 23 00 00       	call   8034ef <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801163:	b8 07 00 00 00       	mov    $0x7,%eax
+  801168:	cd 30                	int    $0x30
+  80116a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80116d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  801170:	83 c4 10             	add    $0x10,%esp
+  801173:	85 c0                	test   %eax,%eax
+  801175:	0f 88 6b 01 00 00    	js     8012e6 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80117b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  801180:	75 37                	jne    8011b9 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801182:	e8 28 fa ff ff       	call   800baf <sys_getenvid>
+  801187:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80118c:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  801192:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801197:	a3 04 50 80 00       	mov    %eax,0x805004
+		return 0;
+  80119c:	e9 45 01 00 00       	jmp    8012e6 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8011a1:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8011a7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8011ad:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011b3:	0f 87 ba 00 00 00    	ja     801273 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8011b9:	89 d8                	mov    %ebx,%eax
+  8011bb:	c1 e8 16             	shr    $0x16,%eax
+  8011be:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8011c5:	a8 01                	test   $0x1,%al
+  8011c7:	74 d8                	je     8011a1 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8011c9:	89 d8                	mov    %ebx,%eax
+  8011cb:	c1 e8 0c             	shr    $0xc,%eax
+  8011ce:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011d5:	f6 c2 01             	test   $0x1,%dl
+  8011d8:	74 cd                	je     8011a7 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8011da:	89 da                	mov    %ebx,%edx
+  8011dc:	80 e6 df             	and    $0xdf,%dh
+  8011df:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8011e5:	74 c0                	je     8011a7 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8011e7:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8011e9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011f0:	f6 c6 04             	test   $0x4,%dh
+  8011f3:	75 53                	jne    801248 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8011f5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8011fc:	f6 c6 08             	test   $0x8,%dh
+  8011ff:	75 0c                	jne    80120d <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  801201:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801208:	f6 c2 02             	test   $0x2,%dl
+  80120b:	74 3b                	je     801248 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80120d:	83 ec 0c             	sub    $0xc,%esp
+  801210:	68 05 08 00 00       	push   $0x805
+  801215:	57                   	push   %edi
+  801216:	ff 75 e4             	push   -0x1c(%ebp)
+  801219:	57                   	push   %edi
+  80121a:	6a 00                	push   $0x0
+  80121c:	e8 1f fa ff ff       	call   800c40 <sys_page_map>
+  801221:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801223:	83 c4 20             	add    $0x20,%esp
+  801226:	85 c0                	test   %eax,%eax
+  801228:	0f 88 a7 00 00 00    	js     8012d5 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80122e:	83 ec 0c             	sub    $0xc,%esp
+  801231:	68 05 08 00 00       	push   $0x805
+  801236:	57                   	push   %edi
+  801237:	6a 00                	push   $0x0
+  801239:	57                   	push   %edi
+  80123a:	6a 00                	push   $0x0
+  80123c:	e8 ff f9 ff ff       	call   800c40 <sys_page_map>
+  801241:	89 c6                	mov    %eax,%esi
+	return r;
+  801243:	83 c4 20             	add    $0x20,%esp
+  801246:	eb 21                	jmp    801269 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  801248:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80124f:	83 ec 0c             	sub    $0xc,%esp
+  801252:	25 07 0e 00 00       	and    $0xe07,%eax
+  801257:	50                   	push   %eax
+  801258:	57                   	push   %edi
+  801259:	ff 75 e4             	push   -0x1c(%ebp)
+  80125c:	57                   	push   %edi
+  80125d:	6a 00                	push   $0x0
+  80125f:	e8 dc f9 ff ff       	call   800c40 <sys_page_map>
+  801264:	89 c6                	mov    %eax,%esi
+  801266:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  801269:	85 f6                	test   %esi,%esi
+  80126b:	0f 89 36 ff ff ff    	jns    8011a7 <fork+0x57>
+  801271:	eb 62                	jmp    8012d5 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801273:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801278:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  80127d:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801280:	89 f8                	mov    %edi,%eax
+  801282:	e8 6f fd ff ff       	call   800ff6 <copy_page_to>
+  801287:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801289:	85 c0                	test   %eax,%eax
+  80128b:	78 48                	js     8012d5 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80128d:	83 ec 04             	sub    $0x4,%esp
+  801290:	6a 07                	push   $0x7
+  801292:	68 00 f0 bf ee       	push   $0xeebff000
+  801297:	57                   	push   %edi
+  801298:	e8 58 f9 ff ff       	call   800bf5 <sys_page_alloc>
+  80129d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80129f:	83 c4 10             	add    $0x10,%esp
+  8012a2:	85 c0                	test   %eax,%eax
+  8012a4:	78 2f                	js     8012d5 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8012a6:	a1 04 50 80 00       	mov    0x805004,%eax
+  8012ab:	8b 40 64             	mov    0x64(%eax),%eax
+  8012ae:	83 ec 08             	sub    $0x8,%esp
+  8012b1:	50                   	push   %eax
+  8012b2:	57                   	push   %edi
+  8012b3:	e8 a8 fa ff ff       	call   800d60 <sys_env_set_pgfault_upcall>
+  8012b8:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8012ba:	83 c4 10             	add    $0x10,%esp
+  8012bd:	85 c0                	test   %eax,%eax
+  8012bf:	78 14                	js     8012d5 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8012c1:	83 ec 08             	sub    $0x8,%esp
+  8012c4:	6a 02                	push   $0x2
+  8012c6:	57                   	push   %edi
+  8012c7:	e8 00 fa ff ff       	call   800ccc <sys_env_set_status>
+  8012cc:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8012ce:	83 c4 10             	add    $0x10,%esp
+  8012d1:	85 c0                	test   %eax,%eax
+  8012d3:	79 11                	jns    8012e6 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8012d5:	83 ec 0c             	sub    $0xc,%esp
+  8012d8:	ff 75 e0             	push   -0x20(%ebp)
+  8012db:	e8 86 f8 ff ff       	call   800b66 <sys_env_destroy>
+	return r;
+  8012e0:	83 c4 10             	add    $0x10,%esp
+  8012e3:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8012e6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ec:	5b                   	pop    %ebx
+  8012ed:	5e                   	pop    %esi
+  8012ee:	5f                   	pop    %edi
+  8012ef:	5d                   	pop    %ebp
+  8012f0:	c3                   	ret
+
+008012f1 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8012f1:	55                   	push   %ebp
+  8012f2:	89 e5                	mov    %esp,%ebp
+  8012f4:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8012f7:	68 6c 3c 80 00       	push   $0x803c6c
+  8012fc:	68 bf 00 00 00       	push   $0xbf
+  801301:	68 61 3c 80 00       	push   $0x803c61
+  801306:	e8 9e 21 00 00       	call   8034a9 <_panic>
+
+0080130b <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80130b:	55                   	push   %ebp
+  80130c:	89 e5                	mov    %esp,%ebp
+  80130e:	56                   	push   %esi
+  80130f:	53                   	push   %ebx
+  801310:	8b 75 08             	mov    0x8(%ebp),%esi
+  801313:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801316:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801319:	85 c0                	test   %eax,%eax
+  80131b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801320:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  801323:	83 ec 0c             	sub    $0xc,%esp
+  801326:	50                   	push   %eax
+  801327:	e8 11 fb ff ff       	call   800e3d <sys_ipc_recv>
+	if (from_env_store)
+  80132c:	83 c4 10             	add    $0x10,%esp
+  80132f:	85 f6                	test   %esi,%esi
+  801331:	74 14                	je     801347 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801333:	ba 00 00 00 00       	mov    $0x0,%edx
+  801338:	85 c0                	test   %eax,%eax
+  80133a:	75 09                	jne    801345 <ipc_recv+0x3a>
+  80133c:	8b 15 04 50 80 00    	mov    0x805004,%edx
+  801342:	8b 52 74             	mov    0x74(%edx),%edx
+  801345:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  801347:	85 db                	test   %ebx,%ebx
+  801349:	74 25                	je     801370 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80134b:	85 c0                	test   %eax,%eax
+  80134d:	74 0d                	je     80135c <ipc_recv+0x51>
+  80134f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  801355:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801358:	5b                   	pop    %ebx
+  801359:	5e                   	pop    %esi
+  80135a:	5d                   	pop    %ebp
+  80135b:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80135c:	a1 04 50 80 00       	mov    0x805004,%eax
+  801361:	8b 40 78             	mov    0x78(%eax),%eax
+  801364:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  801366:	a1 04 50 80 00       	mov    0x805004,%eax
+  80136b:	8b 40 70             	mov    0x70(%eax),%eax
+  80136e:	eb e5                	jmp    801355 <ipc_recv+0x4a>
+  801370:	85 c0                	test   %eax,%eax
+  801372:	75 e1                	jne    801355 <ipc_recv+0x4a>
+  801374:	eb f0                	jmp    801366 <ipc_recv+0x5b>
+
+00801376 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801376:	55                   	push   %ebp
+  801377:	89 e5                	mov    %esp,%ebp
+  801379:	57                   	push   %edi
+  80137a:	56                   	push   %esi
+  80137b:	53                   	push   %ebx
+  80137c:	83 ec 0c             	sub    $0xc,%esp
+  80137f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801382:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801385:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801388:	85 db                	test   %ebx,%ebx
+  80138a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80138f:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  801392:	ff 75 14             	push   0x14(%ebp)
+  801395:	53                   	push   %ebx
+  801396:	56                   	push   %esi
+  801397:	57                   	push   %edi
+  801398:	e8 0d fa ff ff       	call   800daa <sys_ipc_try_send>
+  80139d:	83 c4 10             	add    $0x10,%esp
+  8013a0:	85 c0                	test   %eax,%eax
+  8013a2:	74 22                	je     8013c6 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8013a4:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8013a7:	75 07                	jne    8013b0 <ipc_send+0x3a>
+		sys_yield();
+  8013a9:	e8 28 f8 ff ff       	call   800bd6 <sys_yield>
+  8013ae:	eb e2                	jmp    801392 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8013b0:	68 82 3c 80 00       	push   $0x803c82
+  8013b5:	68 4c 3c 80 00       	push   $0x803c4c
+  8013ba:	6a 39                	push   $0x39
+  8013bc:	68 97 3c 80 00       	push   $0x803c97
+  8013c1:	e8 e3 20 00 00       	call   8034a9 <_panic>
+	}
+}
+  8013c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c9:	5b                   	pop    %ebx
+  8013ca:	5e                   	pop    %esi
+  8013cb:	5f                   	pop    %edi
+  8013cc:	5d                   	pop    %ebp
+  8013cd:	c3                   	ret
+
+008013ce <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  8013ce:	55                   	push   %ebp
+  8013cf:	89 e5                	mov    %esp,%ebp
+  8013d1:	57                   	push   %edi
+  8013d2:	56                   	push   %esi
+  8013d3:	53                   	push   %ebx
+  8013d4:	83 ec 10             	sub    $0x10,%esp
+  8013d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e0:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8013e3:	85 c0                	test   %eax,%eax
+  8013e5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8013ea:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8013ed:	6a 00                	push   $0x0
+  8013ef:	ff 33                	push   (%ebx)
+  8013f1:	50                   	push   %eax
+  8013f2:	e8 03 fa ff ff       	call   800dfa <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8013f7:	83 c4 10             	add    $0x10,%esp
+  8013fa:	85 c0                	test   %eax,%eax
+  8013fc:	75 3c                	jne    80143a <ipc_recvv+0x6c>
+  8013fe:	8b 15 04 50 80 00    	mov    0x805004,%edx
+  801404:	8b 52 7c             	mov    0x7c(%edx),%edx
+  801407:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  801409:	85 ff                	test   %edi,%edi
+  80140b:	74 4e                	je     80145b <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80140d:	8b 15 04 50 80 00    	mov    0x805004,%edx
+  801413:	8b 52 74             	mov    0x74(%edx),%edx
+  801416:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  801418:	85 f6                	test   %esi,%esi
+  80141a:	74 18                	je     801434 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80141c:	85 c0                	test   %eax,%eax
+  80141e:	75 2d                	jne    80144d <ipc_recvv+0x7f>
+  801420:	a1 04 50 80 00       	mov    0x805004,%eax
+  801425:	8b 40 78             	mov    0x78(%eax),%eax
+  801428:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  80142a:	a1 04 50 80 00       	mov    0x805004,%eax
+  80142f:	8b 40 70             	mov    0x70(%eax),%eax
+  801432:	eb 1f                	jmp    801453 <ipc_recvv+0x85>
+  801434:	85 c0                	test   %eax,%eax
+  801436:	75 1b                	jne    801453 <ipc_recvv+0x85>
+  801438:	eb f0                	jmp    80142a <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80143a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801440:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  801445:	85 ff                	test   %edi,%edi
+  801447:	75 cd                	jne    801416 <ipc_recvv+0x48>
+	if (perm_store)
+  801449:	85 f6                	test   %esi,%esi
+  80144b:	74 e7                	je     801434 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80144d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  801453:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801456:	5b                   	pop    %ebx
+  801457:	5e                   	pop    %esi
+  801458:	5f                   	pop    %edi
+  801459:	5d                   	pop    %ebp
+  80145a:	c3                   	ret
+	if (perm_store)
+  80145b:	85 f6                	test   %esi,%esi
+  80145d:	75 bd                	jne    80141c <ipc_recvv+0x4e>
+  80145f:	eb c9                	jmp    80142a <ipc_recvv+0x5c>
+
+00801461 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  801461:	55                   	push   %ebp
+  801462:	89 e5                	mov    %esp,%ebp
+  801464:	57                   	push   %edi
+  801465:	56                   	push   %esi
+  801466:	53                   	push   %ebx
+  801467:	83 ec 0c             	sub    $0xc,%esp
+  80146a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80146d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801470:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  801473:	ff 75 14             	push   0x14(%ebp)
+  801476:	53                   	push   %ebx
+  801477:	56                   	push   %esi
+  801478:	57                   	push   %edi
+  801479:	e8 54 f9 ff ff       	call   800dd2 <sys_ipc_try_sendv>
+  80147e:	83 c4 10             	add    $0x10,%esp
+  801481:	85 c0                	test   %eax,%eax
+  801483:	74 22                	je     8014a7 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  801485:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801488:	75 07                	jne    801491 <ipc_sendv+0x30>
+		sys_yield();
+  80148a:	e8 47 f7 ff ff       	call   800bd6 <sys_yield>
+  80148f:	eb e2                	jmp    801473 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  801491:	68 82 3c 80 00       	push   $0x803c82
+  801496:	68 4c 3c 80 00       	push   $0x803c4c
+  80149b:	6a 5c                	push   $0x5c
+  80149d:	68 97 3c 80 00       	push   $0x803c97
+  8014a2:	e8 02 20 00 00       	call   8034a9 <_panic>
+	}
+}
+  8014a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014aa:	5b                   	pop    %ebx
+  8014ab:	5e                   	pop    %esi
+  8014ac:	5f                   	pop    %edi
+  8014ad:	5d                   	pop    %ebp
+  8014ae:	c3                   	ret
+
+008014af <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8014af:	55                   	push   %ebp
+  8014b0:	89 e5                	mov    %esp,%ebp
+  8014b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8014b5:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8014ba:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8014c0:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8014c6:	8b 52 50             	mov    0x50(%edx),%edx
+  8014c9:	39 ca                	cmp    %ecx,%edx
+  8014cb:	74 11                	je     8014de <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8014cd:	83 c0 01             	add    $0x1,%eax
+  8014d0:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8014d5:	75 e3                	jne    8014ba <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8014d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014dc:	eb 0e                	jmp    8014ec <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8014de:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8014e4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8014e9:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8014ec:	5d                   	pop    %ebp
+  8014ed:	c3                   	ret
+
+008014ee <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014ee:	55                   	push   %ebp
+  8014ef:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014f4:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014f9:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014fc:	5d                   	pop    %ebp
+  8014fd:	c3                   	ret
+
+008014fe <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014fe:	55                   	push   %ebp
+  8014ff:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801501:	8b 45 08             	mov    0x8(%ebp),%eax
+  801504:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801509:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80150e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801513:	5d                   	pop    %ebp
+  801514:	c3                   	ret
+
+00801515 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801515:	55                   	push   %ebp
+  801516:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801518:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80151d:	eb 02                	jmp    801521 <fd_alloc+0xc>
+  80151f:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801521:	89 c2                	mov    %eax,%edx
+  801523:	c1 ea 16             	shr    $0x16,%edx
+  801526:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80152d:	f6 c2 01             	test   $0x1,%dl
+  801530:	74 2b                	je     80155d <fd_alloc+0x48>
+  801532:	89 c2                	mov    %eax,%edx
+  801534:	c1 ea 0c             	shr    $0xc,%edx
+  801537:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80153e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801544:	f6 c1 01             	test   $0x1,%cl
+  801547:	74 14                	je     80155d <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801549:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80154f:	75 ce                	jne    80151f <fd_alloc+0xa>
+  801551:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801556:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80155b:	eb 05                	jmp    801562 <fd_alloc+0x4d>
+			return 0;
+  80155d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801562:	8b 55 08             	mov    0x8(%ebp),%edx
+  801565:	89 02                	mov    %eax,(%edx)
+}
+  801567:	89 c8                	mov    %ecx,%eax
+  801569:	5d                   	pop    %ebp
+  80156a:	c3                   	ret
+
+0080156b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80156b:	55                   	push   %ebp
+  80156c:	89 e5                	mov    %esp,%ebp
+  80156e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801571:	83 f8 1f             	cmp    $0x1f,%eax
+  801574:	77 30                	ja     8015a6 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801576:	c1 e0 0c             	shl    $0xc,%eax
+  801579:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80157e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801584:	f6 c2 01             	test   $0x1,%dl
+  801587:	74 24                	je     8015ad <fd_lookup+0x42>
+  801589:	89 c2                	mov    %eax,%edx
+  80158b:	c1 ea 0c             	shr    $0xc,%edx
+  80158e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801595:	f6 c2 01             	test   $0x1,%dl
+  801598:	74 1a                	je     8015b4 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80159a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80159d:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80159f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015a4:	5d                   	pop    %ebp
+  8015a5:	c3                   	ret
+		return -E_INVAL;
+  8015a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ab:	eb f7                	jmp    8015a4 <fd_lookup+0x39>
+		return -E_INVAL;
+  8015ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b2:	eb f0                	jmp    8015a4 <fd_lookup+0x39>
+  8015b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b9:	eb e9                	jmp    8015a4 <fd_lookup+0x39>
+
+008015bb <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8015bb:	55                   	push   %ebp
+  8015bc:	89 e5                	mov    %esp,%ebp
+  8015be:	53                   	push   %ebx
+  8015bf:	83 ec 04             	sub    $0x4,%esp
+  8015c2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8015c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ca:	eb 03                	jmp    8015cf <dev_lookup+0x14>
+  8015cc:	83 c0 01             	add    $0x1,%eax
+  8015cf:	8b 1c 85 20 3d 80 00 	mov    0x803d20(,%eax,4),%ebx
+  8015d6:	85 db                	test   %ebx,%ebx
+  8015d8:	74 0b                	je     8015e5 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8015da:	39 13                	cmp    %edx,(%ebx)
+  8015dc:	75 ee                	jne    8015cc <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8015de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e3:	eb 1f                	jmp    801604 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015e5:	a1 04 50 80 00       	mov    0x805004,%eax
+  8015ea:	8b 40 48             	mov    0x48(%eax),%eax
+  8015ed:	83 ec 04             	sub    $0x4,%esp
+  8015f0:	52                   	push   %edx
+  8015f1:	50                   	push   %eax
+  8015f2:	68 a4 3c 80 00       	push   $0x803ca4
+  8015f7:	e8 ff eb ff ff       	call   8001fb <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8015fc:	83 c4 10             	add    $0x10,%esp
+  8015ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801604:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801607:	89 1a                	mov    %ebx,(%edx)
+}
+  801609:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80160c:	c9                   	leave
+  80160d:	c3                   	ret
+
+0080160e <fd_close>:
+{
+  80160e:	55                   	push   %ebp
+  80160f:	89 e5                	mov    %esp,%ebp
+  801611:	57                   	push   %edi
+  801612:	56                   	push   %esi
+  801613:	53                   	push   %ebx
+  801614:	83 ec 24             	sub    $0x24,%esp
+  801617:	8b 75 08             	mov    0x8(%ebp),%esi
+  80161a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80161d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801620:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801621:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801627:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80162a:	50                   	push   %eax
+  80162b:	e8 3b ff ff ff       	call   80156b <fd_lookup>
+  801630:	89 c3                	mov    %eax,%ebx
+  801632:	83 c4 10             	add    $0x10,%esp
+  801635:	85 c0                	test   %eax,%eax
+  801637:	78 05                	js     80163e <fd_close+0x30>
+	    || fd != fd2)
+  801639:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80163c:	74 16                	je     801654 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80163e:	89 f8                	mov    %edi,%eax
+  801640:	84 c0                	test   %al,%al
+  801642:	b8 00 00 00 00       	mov    $0x0,%eax
+  801647:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80164a:	89 d8                	mov    %ebx,%eax
+  80164c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80164f:	5b                   	pop    %ebx
+  801650:	5e                   	pop    %esi
+  801651:	5f                   	pop    %edi
+  801652:	5d                   	pop    %ebp
+  801653:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801654:	83 ec 08             	sub    $0x8,%esp
+  801657:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80165a:	50                   	push   %eax
+  80165b:	ff 36                	push   (%esi)
+  80165d:	e8 59 ff ff ff       	call   8015bb <dev_lookup>
+  801662:	89 c3                	mov    %eax,%ebx
+  801664:	83 c4 10             	add    $0x10,%esp
+  801667:	85 c0                	test   %eax,%eax
+  801669:	78 1a                	js     801685 <fd_close+0x77>
+		if (dev->dev_close)
+  80166b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80166e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801671:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801676:	85 c0                	test   %eax,%eax
+  801678:	74 0b                	je     801685 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80167a:	83 ec 0c             	sub    $0xc,%esp
+  80167d:	56                   	push   %esi
+  80167e:	ff d0                	call   *%eax
+  801680:	89 c3                	mov    %eax,%ebx
+  801682:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801685:	83 ec 08             	sub    $0x8,%esp
+  801688:	56                   	push   %esi
+  801689:	6a 00                	push   $0x0
+  80168b:	e8 f2 f5 ff ff       	call   800c82 <sys_page_unmap>
+	return r;
+  801690:	83 c4 10             	add    $0x10,%esp
+  801693:	eb b5                	jmp    80164a <fd_close+0x3c>
+
+00801695 <close>:
+
+int
+close(int fdnum)
+{
+  801695:	55                   	push   %ebp
+  801696:	89 e5                	mov    %esp,%ebp
+  801698:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80169b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80169e:	50                   	push   %eax
+  80169f:	ff 75 08             	push   0x8(%ebp)
+  8016a2:	e8 c4 fe ff ff       	call   80156b <fd_lookup>
+  8016a7:	83 c4 10             	add    $0x10,%esp
+  8016aa:	85 c0                	test   %eax,%eax
+  8016ac:	79 02                	jns    8016b0 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8016ae:	c9                   	leave
+  8016af:	c3                   	ret
+		return fd_close(fd, 1);
+  8016b0:	83 ec 08             	sub    $0x8,%esp
+  8016b3:	6a 01                	push   $0x1
+  8016b5:	ff 75 f4             	push   -0xc(%ebp)
+  8016b8:	e8 51 ff ff ff       	call   80160e <fd_close>
+  8016bd:	83 c4 10             	add    $0x10,%esp
+  8016c0:	eb ec                	jmp    8016ae <close+0x19>
+
+008016c2 <close_all>:
+
+void
+close_all(void)
+{
+  8016c2:	55                   	push   %ebp
+  8016c3:	89 e5                	mov    %esp,%ebp
+  8016c5:	53                   	push   %ebx
+  8016c6:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8016c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8016ce:	83 ec 0c             	sub    $0xc,%esp
+  8016d1:	53                   	push   %ebx
+  8016d2:	e8 be ff ff ff       	call   801695 <close>
+	for (i = 0; i < MAXFD; i++)
+  8016d7:	83 c3 01             	add    $0x1,%ebx
+  8016da:	83 c4 10             	add    $0x10,%esp
+  8016dd:	83 fb 20             	cmp    $0x20,%ebx
+  8016e0:	75 ec                	jne    8016ce <close_all+0xc>
+}
+  8016e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016e5:	c9                   	leave
+  8016e6:	c3                   	ret
+
+008016e7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016e7:	55                   	push   %ebp
+  8016e8:	89 e5                	mov    %esp,%ebp
+  8016ea:	57                   	push   %edi
+  8016eb:	56                   	push   %esi
+  8016ec:	53                   	push   %ebx
+  8016ed:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016f0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016f3:	50                   	push   %eax
+  8016f4:	ff 75 08             	push   0x8(%ebp)
+  8016f7:	e8 6f fe ff ff       	call   80156b <fd_lookup>
+  8016fc:	89 c3                	mov    %eax,%ebx
+  8016fe:	83 c4 10             	add    $0x10,%esp
+  801701:	85 c0                	test   %eax,%eax
+  801703:	78 7f                	js     801784 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801705:	83 ec 0c             	sub    $0xc,%esp
+  801708:	ff 75 0c             	push   0xc(%ebp)
+  80170b:	e8 85 ff ff ff       	call   801695 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801710:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801713:	c1 e6 0c             	shl    $0xc,%esi
+  801716:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80171c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80171f:	89 3c 24             	mov    %edi,(%esp)
+  801722:	e8 d7 fd ff ff       	call   8014fe <fd2data>
+  801727:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801729:	89 34 24             	mov    %esi,(%esp)
+  80172c:	e8 cd fd ff ff       	call   8014fe <fd2data>
+  801731:	83 c4 10             	add    $0x10,%esp
+  801734:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801737:	89 d8                	mov    %ebx,%eax
+  801739:	c1 e8 16             	shr    $0x16,%eax
+  80173c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801743:	a8 01                	test   $0x1,%al
+  801745:	74 11                	je     801758 <dup+0x71>
+  801747:	89 d8                	mov    %ebx,%eax
+  801749:	c1 e8 0c             	shr    $0xc,%eax
+  80174c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801753:	f6 c2 01             	test   $0x1,%dl
+  801756:	75 36                	jne    80178e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801758:	89 f8                	mov    %edi,%eax
+  80175a:	c1 e8 0c             	shr    $0xc,%eax
+  80175d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801764:	83 ec 0c             	sub    $0xc,%esp
+  801767:	25 07 0e 00 00       	and    $0xe07,%eax
+  80176c:	50                   	push   %eax
+  80176d:	56                   	push   %esi
+  80176e:	6a 00                	push   $0x0
+  801770:	57                   	push   %edi
+  801771:	6a 00                	push   $0x0
+  801773:	e8 c8 f4 ff ff       	call   800c40 <sys_page_map>
+  801778:	89 c3                	mov    %eax,%ebx
+  80177a:	83 c4 20             	add    $0x20,%esp
+  80177d:	85 c0                	test   %eax,%eax
+  80177f:	78 33                	js     8017b4 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801781:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801784:	89 d8                	mov    %ebx,%eax
+  801786:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801789:	5b                   	pop    %ebx
+  80178a:	5e                   	pop    %esi
+  80178b:	5f                   	pop    %edi
+  80178c:	5d                   	pop    %ebp
+  80178d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80178e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801795:	83 ec 0c             	sub    $0xc,%esp
+  801798:	25 07 0e 00 00       	and    $0xe07,%eax
+  80179d:	50                   	push   %eax
+  80179e:	ff 75 d4             	push   -0x2c(%ebp)
+  8017a1:	6a 00                	push   $0x0
+  8017a3:	53                   	push   %ebx
+  8017a4:	6a 00                	push   $0x0
+  8017a6:	e8 95 f4 ff ff       	call   800c40 <sys_page_map>
+  8017ab:	89 c3                	mov    %eax,%ebx
+  8017ad:	83 c4 20             	add    $0x20,%esp
+  8017b0:	85 c0                	test   %eax,%eax
+  8017b2:	79 a4                	jns    801758 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8017b4:	83 ec 08             	sub    $0x8,%esp
+  8017b7:	56                   	push   %esi
+  8017b8:	6a 00                	push   $0x0
+  8017ba:	e8 c3 f4 ff ff       	call   800c82 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8017bf:	83 c4 08             	add    $0x8,%esp
+  8017c2:	ff 75 d4             	push   -0x2c(%ebp)
+  8017c5:	6a 00                	push   $0x0
+  8017c7:	e8 b6 f4 ff ff       	call   800c82 <sys_page_unmap>
+	return r;
+  8017cc:	83 c4 10             	add    $0x10,%esp
+  8017cf:	eb b3                	jmp    801784 <dup+0x9d>
+
+008017d1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8017d1:	55                   	push   %ebp
+  8017d2:	89 e5                	mov    %esp,%ebp
+  8017d4:	56                   	push   %esi
+  8017d5:	53                   	push   %ebx
+  8017d6:	83 ec 18             	sub    $0x18,%esp
+  8017d9:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017dc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017df:	50                   	push   %eax
+  8017e0:	56                   	push   %esi
+  8017e1:	e8 85 fd ff ff       	call   80156b <fd_lookup>
+  8017e6:	83 c4 10             	add    $0x10,%esp
+  8017e9:	85 c0                	test   %eax,%eax
+  8017eb:	78 3c                	js     801829 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017ed:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8017f0:	83 ec 08             	sub    $0x8,%esp
+  8017f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017f6:	50                   	push   %eax
+  8017f7:	ff 33                	push   (%ebx)
+  8017f9:	e8 bd fd ff ff       	call   8015bb <dev_lookup>
+  8017fe:	83 c4 10             	add    $0x10,%esp
+  801801:	85 c0                	test   %eax,%eax
+  801803:	78 24                	js     801829 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801805:	8b 43 08             	mov    0x8(%ebx),%eax
+  801808:	83 e0 03             	and    $0x3,%eax
+  80180b:	83 f8 01             	cmp    $0x1,%eax
+  80180e:	74 20                	je     801830 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801810:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801813:	8b 40 08             	mov    0x8(%eax),%eax
+  801816:	85 c0                	test   %eax,%eax
+  801818:	74 37                	je     801851 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80181a:	83 ec 04             	sub    $0x4,%esp
+  80181d:	ff 75 10             	push   0x10(%ebp)
+  801820:	ff 75 0c             	push   0xc(%ebp)
+  801823:	53                   	push   %ebx
+  801824:	ff d0                	call   *%eax
+  801826:	83 c4 10             	add    $0x10,%esp
+}
+  801829:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80182c:	5b                   	pop    %ebx
+  80182d:	5e                   	pop    %esi
+  80182e:	5d                   	pop    %ebp
+  80182f:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801830:	a1 04 50 80 00       	mov    0x805004,%eax
+  801835:	8b 40 48             	mov    0x48(%eax),%eax
+  801838:	83 ec 04             	sub    $0x4,%esp
+  80183b:	56                   	push   %esi
+  80183c:	50                   	push   %eax
+  80183d:	68 e5 3c 80 00       	push   $0x803ce5
+  801842:	e8 b4 e9 ff ff       	call   8001fb <cprintf>
+		return -E_INVAL;
+  801847:	83 c4 10             	add    $0x10,%esp
+  80184a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80184f:	eb d8                	jmp    801829 <read+0x58>
+		return -E_NOT_SUPP;
+  801851:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801856:	eb d1                	jmp    801829 <read+0x58>
+
+00801858 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801858:	55                   	push   %ebp
+  801859:	89 e5                	mov    %esp,%ebp
+  80185b:	57                   	push   %edi
+  80185c:	56                   	push   %esi
+  80185d:	53                   	push   %ebx
+  80185e:	83 ec 0c             	sub    $0xc,%esp
+  801861:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801864:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801867:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186c:	eb 02                	jmp    801870 <readn+0x18>
+  80186e:	01 c3                	add    %eax,%ebx
+  801870:	39 f3                	cmp    %esi,%ebx
+  801872:	73 21                	jae    801895 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801874:	83 ec 04             	sub    $0x4,%esp
+  801877:	89 f0                	mov    %esi,%eax
+  801879:	29 d8                	sub    %ebx,%eax
+  80187b:	50                   	push   %eax
+  80187c:	89 d8                	mov    %ebx,%eax
+  80187e:	03 45 0c             	add    0xc(%ebp),%eax
+  801881:	50                   	push   %eax
+  801882:	57                   	push   %edi
+  801883:	e8 49 ff ff ff       	call   8017d1 <read>
+		if (m < 0)
+  801888:	83 c4 10             	add    $0x10,%esp
+  80188b:	85 c0                	test   %eax,%eax
+  80188d:	78 04                	js     801893 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80188f:	75 dd                	jne    80186e <readn+0x16>
+  801891:	eb 02                	jmp    801895 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801893:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801895:	89 d8                	mov    %ebx,%eax
+  801897:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80189a:	5b                   	pop    %ebx
+  80189b:	5e                   	pop    %esi
+  80189c:	5f                   	pop    %edi
+  80189d:	5d                   	pop    %ebp
+  80189e:	c3                   	ret
+
+0080189f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80189f:	55                   	push   %ebp
+  8018a0:	89 e5                	mov    %esp,%ebp
+  8018a2:	56                   	push   %esi
+  8018a3:	53                   	push   %ebx
+  8018a4:	83 ec 18             	sub    $0x18,%esp
+  8018a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018aa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018ad:	50                   	push   %eax
+  8018ae:	53                   	push   %ebx
+  8018af:	e8 b7 fc ff ff       	call   80156b <fd_lookup>
+  8018b4:	83 c4 10             	add    $0x10,%esp
+  8018b7:	85 c0                	test   %eax,%eax
+  8018b9:	78 37                	js     8018f2 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018bb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018be:	83 ec 08             	sub    $0x8,%esp
+  8018c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c4:	50                   	push   %eax
+  8018c5:	ff 36                	push   (%esi)
+  8018c7:	e8 ef fc ff ff       	call   8015bb <dev_lookup>
+  8018cc:	83 c4 10             	add    $0x10,%esp
+  8018cf:	85 c0                	test   %eax,%eax
+  8018d1:	78 1f                	js     8018f2 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018d3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018d7:	74 20                	je     8018f9 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8018d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018dc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018df:	85 c0                	test   %eax,%eax
+  8018e1:	74 37                	je     80191a <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8018e3:	83 ec 04             	sub    $0x4,%esp
+  8018e6:	ff 75 10             	push   0x10(%ebp)
+  8018e9:	ff 75 0c             	push   0xc(%ebp)
+  8018ec:	56                   	push   %esi
+  8018ed:	ff d0                	call   *%eax
+  8018ef:	83 c4 10             	add    $0x10,%esp
+}
+  8018f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018f5:	5b                   	pop    %ebx
+  8018f6:	5e                   	pop    %esi
+  8018f7:	5d                   	pop    %ebp
+  8018f8:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018f9:	a1 04 50 80 00       	mov    0x805004,%eax
+  8018fe:	8b 40 48             	mov    0x48(%eax),%eax
+  801901:	83 ec 04             	sub    $0x4,%esp
+  801904:	53                   	push   %ebx
+  801905:	50                   	push   %eax
+  801906:	68 01 3d 80 00       	push   $0x803d01
+  80190b:	e8 eb e8 ff ff       	call   8001fb <cprintf>
+		return -E_INVAL;
+  801910:	83 c4 10             	add    $0x10,%esp
+  801913:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801918:	eb d8                	jmp    8018f2 <write+0x53>
+		return -E_NOT_SUPP;
+  80191a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80191f:	eb d1                	jmp    8018f2 <write+0x53>
+
+00801921 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801921:	55                   	push   %ebp
+  801922:	89 e5                	mov    %esp,%ebp
+  801924:	53                   	push   %ebx
+  801925:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801928:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80192b:	50                   	push   %eax
+  80192c:	ff 75 08             	push   0x8(%ebp)
+  80192f:	e8 37 fc ff ff       	call   80156b <fd_lookup>
+  801934:	83 c4 10             	add    $0x10,%esp
+  801937:	85 c0                	test   %eax,%eax
+  801939:	78 3a                	js     801975 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80193b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80193e:	83 ec 08             	sub    $0x8,%esp
+  801941:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801944:	50                   	push   %eax
+  801945:	ff 33                	push   (%ebx)
+  801947:	e8 6f fc ff ff       	call   8015bb <dev_lookup>
+  80194c:	83 c4 10             	add    $0x10,%esp
+  80194f:	85 c0                	test   %eax,%eax
+  801951:	78 22                	js     801975 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801953:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801956:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801959:	85 c0                	test   %eax,%eax
+  80195b:	74 0d                	je     80196a <seek+0x49>
+  80195d:	83 ec 0c             	sub    $0xc,%esp
+  801960:	53                   	push   %ebx
+  801961:	ff d0                	call   *%eax
+  801963:	83 c4 10             	add    $0x10,%esp
+  801966:	85 c0                	test   %eax,%eax
+  801968:	78 0b                	js     801975 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  80196a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80196d:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801970:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801975:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801978:	c9                   	leave
+  801979:	c3                   	ret
+
+0080197a <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  80197a:	55                   	push   %ebp
+  80197b:	89 e5                	mov    %esp,%ebp
+  80197d:	53                   	push   %ebx
+  80197e:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801981:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801984:	50                   	push   %eax
+  801985:	ff 75 08             	push   0x8(%ebp)
+  801988:	e8 de fb ff ff       	call   80156b <fd_lookup>
+  80198d:	83 c4 10             	add    $0x10,%esp
+  801990:	85 c0                	test   %eax,%eax
+  801992:	78 2b                	js     8019bf <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801994:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801997:	83 ec 08             	sub    $0x8,%esp
+  80199a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80199d:	50                   	push   %eax
+  80199e:	ff 33                	push   (%ebx)
+  8019a0:	e8 16 fc ff ff       	call   8015bb <dev_lookup>
+  8019a5:	83 c4 10             	add    $0x10,%esp
+  8019a8:	85 c0                	test   %eax,%eax
+  8019aa:	78 13                	js     8019bf <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8019ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019af:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8019b2:	85 c0                	test   %eax,%eax
+  8019b4:	74 0e                	je     8019c4 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8019b6:	83 ec 0c             	sub    $0xc,%esp
+  8019b9:	53                   	push   %ebx
+  8019ba:	ff d0                	call   *%eax
+  8019bc:	83 c4 10             	add    $0x10,%esp
+}
+  8019bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019c2:	c9                   	leave
+  8019c3:	c3                   	ret
+		return 0;
+  8019c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c9:	eb f4                	jmp    8019bf <fsync+0x45>
+
+008019cb <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8019cb:	55                   	push   %ebp
+  8019cc:	89 e5                	mov    %esp,%ebp
+  8019ce:	56                   	push   %esi
+  8019cf:	53                   	push   %ebx
+  8019d0:	83 ec 18             	sub    $0x18,%esp
+  8019d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019d6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019d9:	50                   	push   %eax
+  8019da:	53                   	push   %ebx
+  8019db:	e8 8b fb ff ff       	call   80156b <fd_lookup>
+  8019e0:	83 c4 10             	add    $0x10,%esp
+  8019e3:	85 c0                	test   %eax,%eax
+  8019e5:	78 34                	js     801a1b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019e7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019ea:	83 ec 08             	sub    $0x8,%esp
+  8019ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019f0:	50                   	push   %eax
+  8019f1:	ff 36                	push   (%esi)
+  8019f3:	e8 c3 fb ff ff       	call   8015bb <dev_lookup>
+  8019f8:	83 c4 10             	add    $0x10,%esp
+  8019fb:	85 c0                	test   %eax,%eax
+  8019fd:	78 1c                	js     801a1b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019ff:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a03:	74 1d                	je     801a22 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801a05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a08:	8b 40 18             	mov    0x18(%eax),%eax
+  801a0b:	85 c0                	test   %eax,%eax
+  801a0d:	74 34                	je     801a43 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801a0f:	83 ec 08             	sub    $0x8,%esp
+  801a12:	ff 75 0c             	push   0xc(%ebp)
+  801a15:	56                   	push   %esi
+  801a16:	ff d0                	call   *%eax
+  801a18:	83 c4 10             	add    $0x10,%esp
+}
+  801a1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a1e:	5b                   	pop    %ebx
+  801a1f:	5e                   	pop    %esi
+  801a20:	5d                   	pop    %ebp
+  801a21:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801a22:	a1 04 50 80 00       	mov    0x805004,%eax
+  801a27:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a2a:	83 ec 04             	sub    $0x4,%esp
+  801a2d:	53                   	push   %ebx
+  801a2e:	50                   	push   %eax
+  801a2f:	68 c4 3c 80 00       	push   $0x803cc4
+  801a34:	e8 c2 e7 ff ff       	call   8001fb <cprintf>
+		return -E_INVAL;
+  801a39:	83 c4 10             	add    $0x10,%esp
+  801a3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a41:	eb d8                	jmp    801a1b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a43:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a48:	eb d1                	jmp    801a1b <ftruncate+0x50>
+
+00801a4a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a4a:	55                   	push   %ebp
+  801a4b:	89 e5                	mov    %esp,%ebp
+  801a4d:	56                   	push   %esi
+  801a4e:	53                   	push   %ebx
+  801a4f:	83 ec 18             	sub    $0x18,%esp
+  801a52:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a55:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a58:	50                   	push   %eax
+  801a59:	ff 75 08             	push   0x8(%ebp)
+  801a5c:	e8 0a fb ff ff       	call   80156b <fd_lookup>
+  801a61:	83 c4 10             	add    $0x10,%esp
+  801a64:	85 c0                	test   %eax,%eax
+  801a66:	78 49                	js     801ab1 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a68:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a6b:	83 ec 08             	sub    $0x8,%esp
+  801a6e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a71:	50                   	push   %eax
+  801a72:	ff 36                	push   (%esi)
+  801a74:	e8 42 fb ff ff       	call   8015bb <dev_lookup>
+  801a79:	83 c4 10             	add    $0x10,%esp
+  801a7c:	85 c0                	test   %eax,%eax
+  801a7e:	78 31                	js     801ab1 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801a80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a83:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a87:	74 2f                	je     801ab8 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a89:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a8c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a93:	00 00 00 
+	stat->st_isdir = 0;
+  801a96:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a9d:	00 00 00 
+	stat->st_dev = dev;
+  801aa0:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801aa6:	83 ec 08             	sub    $0x8,%esp
+  801aa9:	53                   	push   %ebx
+  801aaa:	56                   	push   %esi
+  801aab:	ff 50 14             	call   *0x14(%eax)
+  801aae:	83 c4 10             	add    $0x10,%esp
+}
+  801ab1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab4:	5b                   	pop    %ebx
+  801ab5:	5e                   	pop    %esi
+  801ab6:	5d                   	pop    %ebp
+  801ab7:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ab8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801abd:	eb f2                	jmp    801ab1 <fstat+0x67>
+
+00801abf <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801abf:	55                   	push   %ebp
+  801ac0:	89 e5                	mov    %esp,%ebp
+  801ac2:	56                   	push   %esi
+  801ac3:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801ac4:	83 ec 08             	sub    $0x8,%esp
+  801ac7:	68 00 10 00 00       	push   $0x1000
+  801acc:	ff 75 08             	push   0x8(%ebp)
+  801acf:	e8 b3 07 00 00       	call   802287 <open>
+  801ad4:	89 c3                	mov    %eax,%ebx
+  801ad6:	83 c4 10             	add    $0x10,%esp
+  801ad9:	85 c0                	test   %eax,%eax
+  801adb:	78 1b                	js     801af8 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801add:	83 ec 08             	sub    $0x8,%esp
+  801ae0:	ff 75 0c             	push   0xc(%ebp)
+  801ae3:	50                   	push   %eax
+  801ae4:	e8 61 ff ff ff       	call   801a4a <fstat>
+  801ae9:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801aeb:	89 1c 24             	mov    %ebx,(%esp)
+  801aee:	e8 a2 fb ff ff       	call   801695 <close>
+	return r;
+  801af3:	83 c4 10             	add    $0x10,%esp
+  801af6:	89 f3                	mov    %esi,%ebx
+}
+  801af8:	89 d8                	mov    %ebx,%eax
+  801afa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801afd:	5b                   	pop    %ebx
+  801afe:	5e                   	pop    %esi
+  801aff:	5d                   	pop    %ebp
+  801b00:	c3                   	ret
+
+00801b01 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801b01:	55                   	push   %ebp
+  801b02:	89 e5                	mov    %esp,%ebp
+  801b04:	57                   	push   %edi
+  801b05:	56                   	push   %esi
+  801b06:	53                   	push   %ebx
+  801b07:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801b0d:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801b13:	89 d6                	mov    %edx,%esi
+  801b15:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801b1b:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801b1e:	89 d3                	mov    %edx,%ebx
+  801b20:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801b26:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801b2d:	74 1d                	je     801b4c <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b2f:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801b34:	83 c8 07             	or     $0x7,%eax
+  801b37:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801b3d:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801b42:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801b48:	01 ce                	add    %ecx,%esi
+  801b4a:	eb 28                	jmp    801b74 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b4c:	83 ec 0c             	sub    $0xc,%esp
+  801b4f:	6a 01                	push   $0x1
+  801b51:	e8 59 f9 ff ff       	call   8014af <ipc_find_env>
+  801b56:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801b5b:	83 c4 10             	add    $0x10,%esp
+  801b5e:	eb cf                	jmp    801b2f <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801b60:	83 c0 01             	add    $0x1,%eax
+  801b63:	89 fa                	mov    %edi,%edx
+  801b65:	09 da                	or     %ebx,%edx
+  801b67:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801b6e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b74:	39 f3                	cmp    %esi,%ebx
+  801b76:	72 e8                	jb     801b60 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801b78:	83 f8 41             	cmp    $0x41,%eax
+  801b7b:	77 2f                	ja     801bac <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801b7d:	50                   	push   %eax
+  801b7e:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801b84:	50                   	push   %eax
+  801b85:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801b8b:	ff 35 c8 70 80 00    	push   0x8070c8
+  801b91:	e8 cb f8 ff ff       	call   801461 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801b96:	83 c4 0c             	add    $0xc,%esp
+  801b99:	6a 00                	push   $0x0
+  801b9b:	6a 00                	push   $0x0
+  801b9d:	6a 00                	push   $0x0
+  801b9f:	e8 67 f7 ff ff       	call   80130b <ipc_recv>
+}
+  801ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ba7:	5b                   	pop    %ebx
+  801ba8:	5e                   	pop    %esi
+  801ba9:	5f                   	pop    %edi
+  801baa:	5d                   	pop    %ebp
+  801bab:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801bac:	68 34 3d 80 00       	push   $0x803d34
+  801bb1:	68 4c 3c 80 00       	push   $0x803c4c
+  801bb6:	6a 40                	push   $0x40
+  801bb8:	68 50 3d 80 00       	push   $0x803d50
+  801bbd:	e8 e7 18 00 00       	call   8034a9 <_panic>
+
+00801bc2 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801bc2:	55                   	push   %ebp
+  801bc3:	89 e5                	mov    %esp,%ebp
+  801bc5:	57                   	push   %edi
+  801bc6:	56                   	push   %esi
+  801bc7:	53                   	push   %ebx
+  801bc8:	83 ec 1c             	sub    $0x1c,%esp
+  801bcb:	89 c3                	mov    %eax,%ebx
+  801bcd:	89 d6                	mov    %edx,%esi
+  801bcf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801bd2:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801bd8:	89 ca                	mov    %ecx,%edx
+  801bda:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801bdd:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801be4:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801be7:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801bee:	8b 76 0c             	mov    0xc(%esi),%esi
+  801bf1:	89 fb                	mov    %edi,%ebx
+  801bf3:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801bfa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801bfd:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801c04:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c07:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801c0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c11:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801c18:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801c1b:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801c22:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801c27:	39 c8                	cmp    %ecx,%eax
+  801c29:	74 0d                	je     801c38 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c33:	5b                   	pop    %ebx
+  801c34:	5e                   	pop    %esi
+  801c35:	5f                   	pop    %edi
+  801c36:	5d                   	pop    %ebp
+  801c37:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801c38:	6a 07                	push   $0x7
+  801c3a:	68 00 60 80 00       	push   $0x806000
+  801c3f:	6a 0d                	push   $0xd
+  801c41:	ff 35 c8 70 80 00    	push   0x8070c8
+  801c47:	e8 2a f7 ff ff       	call   801376 <ipc_send>
+  801c4c:	83 c4 10             	add    $0x10,%esp
+  801c4f:	eb da                	jmp    801c2b <fsring_post+0x69>
+
+00801c51 <fsipcv>:
+{
+  801c51:	55                   	push   %ebp
+  801c52:	89 e5                	mov    %esp,%ebp
+  801c54:	57                   	push   %edi
+  801c55:	56                   	push   %esi
+  801c56:	53                   	push   %ebx
+  801c57:	83 ec 0c             	sub    $0xc,%esp
+  801c5a:	89 c7                	mov    %eax,%edi
+  801c5c:	89 d3                	mov    %edx,%ebx
+  801c5e:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801c60:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801c67:	74 26                	je     801c8f <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801c69:	6a 07                	push   $0x7
+  801c6b:	68 00 60 80 00       	push   $0x806000
+  801c70:	57                   	push   %edi
+  801c71:	ff 35 c8 70 80 00    	push   0x8070c8
+  801c77:	e8 fa f6 ff ff       	call   801376 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801c7c:	6a 00                	push   $0x0
+  801c7e:	56                   	push   %esi
+  801c7f:	53                   	push   %ebx
+  801c80:	6a 00                	push   $0x0
+  801c82:	e8 47 f7 ff ff       	call   8013ce <ipc_recvv>
+}
+  801c87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c8a:	5b                   	pop    %ebx
+  801c8b:	5e                   	pop    %esi
+  801c8c:	5f                   	pop    %edi
+  801c8d:	5d                   	pop    %ebp
+  801c8e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c8f:	83 ec 0c             	sub    $0xc,%esp
+  801c92:	6a 01                	push   $0x1
+  801c94:	e8 16 f8 ff ff       	call   8014af <ipc_find_env>
+  801c99:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801c9e:	83 c4 10             	add    $0x10,%esp
+  801ca1:	eb c6                	jmp    801c69 <fsipcv+0x18>
+
+00801ca3 <fsipc>:
+{
+  801ca3:	55                   	push   %ebp
+  801ca4:	89 e5                	mov    %esp,%ebp
+  801ca6:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801ca9:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801cb0:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801cb3:	e8 99 ff ff ff       	call   801c51 <fsipcv>
+}
+  801cb8:	c9                   	leave
+  801cb9:	c3                   	ret
+
+00801cba <file_write_direct>:
+{
+  801cba:	55                   	push   %ebp
+  801cbb:	89 e5                	mov    %esp,%ebp
+  801cbd:	56                   	push   %esi
+  801cbe:	53                   	push   %ebx
+  801cbf:	89 c3                	mov    %eax,%ebx
+  801cc1:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801cc3:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801cc9:	77 40                	ja     801d0b <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801ccb:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801cd0:	39 c8                	cmp    %ecx,%eax
+  801cd2:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801cd5:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801cd8:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  801cde:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801ce3:	83 ec 04             	sub    $0x4,%esp
+  801ce6:	50                   	push   %eax
+  801ce7:	52                   	push   %edx
+  801ce8:	68 08 60 80 00       	push   $0x806008
+  801ced:	e8 7d ec ff ff       	call   80096f <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801cf2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf7:	b8 04 00 00 00       	mov    $0x4,%eax
+  801cfc:	e8 a2 ff ff ff       	call   801ca3 <fsipc>
+  801d01:	83 c4 10             	add    $0x10,%esp
+}
+  801d04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d07:	5b                   	pop    %ebx
+  801d08:	5e                   	pop    %esi
+  801d09:	5d                   	pop    %ebp
+  801d0a:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801d0b:	89 d6                	mov    %edx,%esi
+  801d0d:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801d13:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801d18:	29 f1                	sub    %esi,%ecx
+  801d1a:	39 c1                	cmp    %eax,%ecx
+  801d1c:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801d1f:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801d22:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801d27:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801d2d:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801d33:	83 ec 0c             	sub    $0xc,%esp
+  801d36:	6a 05                	push   $0x5
+  801d38:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801d3d:	e8 bf fd ff ff       	call   801b01 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801d42:	83 c4 10             	add    $0x10,%esp
+  801d45:	eb bd                	jmp    801d04 <file_write_direct+0x4a>
+
+00801d47 <devfile_sync>:
+{
+  801d47:	55                   	push   %ebp
+  801d48:	89 e5                	mov    %esp,%ebp
+  801d4a:	57                   	push   %edi
+  801d4b:	56                   	push   %esi
+  801d4c:	53                   	push   %ebx
+  801d4d:	83 ec 28             	sub    $0x28,%esp
+  801d50:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801d53:	56                   	push   %esi
+  801d54:	e8 a5 f7 ff ff       	call   8014fe <fd2data>
+  801d59:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801d5b:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801d5e:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801d65:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d68:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801d6d:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801d71:	74 45                	je     801db8 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801d73:	8b 46 14             	mov    0x14(%esi),%eax
+  801d76:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801d79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d83:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801d86:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801d89:	39 cb                	cmp    %ecx,%ebx
+  801d8b:	73 14                	jae    801da1 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801d8d:	29 d9                	sub    %ebx,%ecx
+  801d8f:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801d92:	89 f0                	mov    %esi,%eax
+  801d94:	e8 21 ff ff ff       	call   801cba <file_write_direct>
+  801d99:	85 c0                	test   %eax,%eax
+  801d9b:	7e 04                	jle    801da1 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801d9d:	01 c3                	add    %eax,%ebx
+  801d9f:	eb e5                	jmp    801d86 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801da1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801da4:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801dab:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801dae:	85 c0                	test   %eax,%eax
+  801db0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db5:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801db8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dbb:	5b                   	pop    %ebx
+  801dbc:	5e                   	pop    %esi
+  801dbd:	5f                   	pop    %edi
+  801dbe:	5d                   	pop    %ebp
+  801dbf:	c3                   	ret
+
+00801dc0 <devfile_write>:
+{
+  801dc0:	55                   	push   %ebp
+  801dc1:	89 e5                	mov    %esp,%ebp
+  801dc3:	57                   	push   %edi
+  801dc4:	56                   	push   %esi
+  801dc5:	53                   	push   %ebx
+  801dc6:	83 ec 28             	sub    $0x28,%esp
+  801dc9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801dcc:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801dcf:	53                   	push   %ebx
+  801dd0:	e8 29 f7 ff ff       	call   8014fe <fd2data>
+  801dd5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801dd8:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801ddb:	83 c4 10             	add    $0x10,%esp
+  801dde:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801de2:	74 43                	je     801e27 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801de4:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801deb:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801dee:	85 c0                	test   %eax,%eax
+  801df0:	74 43                	je     801e35 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801df2:	89 c2                	mov    %eax,%edx
+  801df4:	03 53 14             	add    0x14(%ebx),%edx
+  801df7:	39 fa                	cmp    %edi,%edx
+  801df9:	75 0b                	jne    801e06 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801dfb:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801dfe:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801e04:	76 66                	jbe    801e6c <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801e06:	83 ec 0c             	sub    $0xc,%esp
+  801e09:	53                   	push   %ebx
+  801e0a:	e8 38 ff ff ff       	call   801d47 <devfile_sync>
+  801e0f:	83 c4 10             	add    $0x10,%esp
+  801e12:	85 c0                	test   %eax,%eax
+  801e14:	78 4e                	js     801e64 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801e16:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e1c:	77 56                	ja     801e74 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801e1e:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801e21:	85 c0                	test   %eax,%eax
+  801e23:	75 20                	jne    801e45 <devfile_write+0x85>
+  801e25:	eb 16                	jmp    801e3d <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801e27:	89 f1                	mov    %esi,%ecx
+  801e29:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e2c:	89 d8                	mov    %ebx,%eax
+  801e2e:	e8 87 fe ff ff       	call   801cba <file_write_direct>
+  801e33:	eb 2f                	jmp    801e64 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801e35:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e3b:	77 37                	ja     801e74 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801e3d:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801e40:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801e45:	83 ec 04             	sub    $0x4,%esp
+  801e48:	56                   	push   %esi
+  801e49:	ff 75 0c             	push   0xc(%ebp)
+  801e4c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e4f:	01 c1                	add    %eax,%ecx
+  801e51:	51                   	push   %ecx
+  801e52:	e8 18 eb ff ff       	call   80096f <memmove>
+	ff->buf_wlen += n;
+  801e57:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801e5a:	01 f7                	add    %esi,%edi
+  801e5c:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801e5f:	89 f0                	mov    %esi,%eax
+  801e61:	83 c4 10             	add    $0x10,%esp
+}
+  801e64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e67:	5b                   	pop    %ebx
+  801e68:	5e                   	pop    %esi
+  801e69:	5f                   	pop    %edi
+  801e6a:	5d                   	pop    %ebp
+  801e6b:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801e6c:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e72:	76 d1                	jbe    801e45 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801e74:	89 f1                	mov    %esi,%ecx
+  801e76:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e79:	89 d8                	mov    %ebx,%eax
+  801e7b:	e8 3a fe ff ff       	call   801cba <file_write_direct>
+  801e80:	eb e2                	jmp    801e64 <devfile_write+0xa4>
+
+00801e82 <devfile_trunc>:
+{
+  801e82:	55                   	push   %ebp
+  801e83:	89 e5                	mov    %esp,%ebp
+  801e85:	53                   	push   %ebx
+  801e86:	83 ec 10             	sub    $0x10,%esp
+  801e89:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801e8c:	53                   	push   %ebx
+  801e8d:	e8 b5 fe ff ff       	call   801d47 <devfile_sync>
+  801e92:	83 c4 10             	add    $0x10,%esp
+  801e95:	85 c0                	test   %eax,%eax
+  801e97:	78 1f                	js     801eb8 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e99:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801e9c:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801ea1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ea4:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ea9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eae:	b8 02 00 00 00       	mov    $0x2,%eax
+  801eb3:	e8 eb fd ff ff       	call   801ca3 <fsipc>
+}
+  801eb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ebb:	c9                   	leave
+  801ebc:	c3                   	ret
+
+00801ebd <devfile_stat>:
+{
+  801ebd:	55                   	push   %ebp
+  801ebe:	89 e5                	mov    %esp,%ebp
+  801ec0:	56                   	push   %esi
+  801ec1:	53                   	push   %ebx
+  801ec2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ec5:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801ec8:	83 ec 0c             	sub    $0xc,%esp
+  801ecb:	53                   	push   %ebx
+  801ecc:	e8 76 fe ff ff       	call   801d47 <devfile_sync>
+  801ed1:	83 c4 10             	add    $0x10,%esp
+  801ed4:	85 c0                	test   %eax,%eax
+  801ed6:	78 47                	js     801f1f <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ed8:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801edb:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ee0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee5:	b8 05 00 00 00       	mov    $0x5,%eax
+  801eea:	e8 b4 fd ff ff       	call   801ca3 <fsipc>
+  801eef:	85 c0                	test   %eax,%eax
+  801ef1:	78 2c                	js     801f1f <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ef3:	83 ec 08             	sub    $0x8,%esp
+  801ef6:	68 00 60 80 00       	push   $0x806000
+  801efb:	56                   	push   %esi
+  801efc:	e8 e8 e8 ff ff       	call   8007e9 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f01:	a1 80 60 80 00       	mov    0x806080,%eax
+  801f06:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f0c:	a1 84 60 80 00       	mov    0x806084,%eax
+  801f11:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801f17:	83 c4 10             	add    $0x10,%esp
+  801f1a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f22:	5b                   	pop    %ebx
+  801f23:	5e                   	pop    %esi
+  801f24:	5d                   	pop    %ebp
+  801f25:	c3                   	ret
+
+00801f26 <devfile_flush>:
+{
+  801f26:	55                   	push   %ebp
+  801f27:	89 e5                	mov    %esp,%ebp
+  801f29:	56                   	push   %esi
+  801f2a:	53                   	push   %ebx
+  801f2b:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801f2e:	83 ec 0c             	sub    $0xc,%esp
+  801f31:	56                   	push   %esi
+  801f32:	e8 10 fe ff ff       	call   801d47 <devfile_sync>
+  801f37:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801f39:	83 c4 10             	add    $0x10,%esp
+  801f3c:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801f40:	75 25                	jne    801f67 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f42:	8b 46 0c             	mov    0xc(%esi),%eax
+  801f45:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801f4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f54:	e8 4a fd ff ff       	call   801ca3 <fsipc>
+  801f59:	85 c0                	test   %eax,%eax
+  801f5b:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801f5e:	89 d8                	mov    %ebx,%eax
+  801f60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f63:	5b                   	pop    %ebx
+  801f64:	5e                   	pop    %esi
+  801f65:	5d                   	pop    %ebp
+  801f66:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801f67:	83 ec 0c             	sub    $0xc,%esp
+  801f6a:	56                   	push   %esi
+  801f6b:	e8 8e f5 ff ff       	call   8014fe <fd2data>
+  801f70:	83 c4 08             	add    $0x8,%esp
+  801f73:	50                   	push   %eax
+  801f74:	6a 00                	push   $0x0
+  801f76:	e8 07 ed ff ff       	call   800c82 <sys_page_unmap>
+  801f7b:	83 c4 10             	add    $0x10,%esp
+  801f7e:	eb c2                	jmp    801f42 <devfile_flush+0x1c>
+
+00801f80 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801f80:	55                   	push   %ebp
+  801f81:	89 e5                	mov    %esp,%ebp
+  801f83:	57                   	push   %edi
+  801f84:	56                   	push   %esi
+  801f85:	53                   	push   %ebx
+  801f86:	83 ec 64             	sub    $0x64,%esp
+  801f89:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801f8b:	52                   	push   %edx
+  801f8c:	50                   	push   %eax
+  801f8d:	e8 d9 f5 ff ff       	call   80156b <fd_lookup>
+  801f92:	89 c1                	mov    %eax,%ecx
+  801f94:	83 c4 10             	add    $0x10,%esp
+  801f97:	85 c0                	test   %eax,%eax
+  801f99:	0f 88 f2 00 00 00    	js     802091 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801f9f:	8b 07                	mov    (%edi),%eax
+  801fa1:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801fa7:	39 10                	cmp    %edx,(%eax)
+  801fa9:	0f 85 03 01 00 00    	jne    8020b2 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801faf:	a1 04 50 80 00       	mov    0x805004,%eax
+  801fb4:	8b 40 48             	mov    0x48(%eax),%eax
+  801fb7:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801fbd:	0f 84 96 00 00 00    	je     802059 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801fc3:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801fca:	0f 84 cb 00 00 00    	je     80209b <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801fd0:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801fd5:	83 c8 07             	or     $0x7,%eax
+  801fd8:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801fdb:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801fde:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801fe3:	83 ec 04             	sub    $0x4,%esp
+  801fe6:	68 07 04 00 00       	push   $0x407
+  801feb:	53                   	push   %ebx
+  801fec:	6a 00                	push   $0x0
+  801fee:	e8 02 ec ff ff       	call   800bf5 <sys_page_alloc>
+  801ff3:	89 c1                	mov    %eax,%ecx
+  801ff5:	83 c4 10             	add    $0x10,%esp
+  801ff8:	85 c0                	test   %eax,%eax
+  801ffa:	0f 88 91 00 00 00    	js     802091 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  802000:	89 d8                	mov    %ebx,%eax
+  802002:	83 c8 07             	or     $0x7,%eax
+  802005:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  802007:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80200d:	83 c6 04             	add    $0x4,%esi
+  802010:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  802016:	75 cb                	jne    801fe3 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  802018:	6a 12                	push   $0x12
+  80201a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80201d:	50                   	push   %eax
+  80201e:	6a 0c                	push   $0xc
+  802020:	ff 35 c8 70 80 00    	push   0x8070c8
+  802026:	e8 36 f4 ff ff       	call   801461 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80202b:	83 c4 0c             	add    $0xc,%esp
+  80202e:	6a 00                	push   $0x0
+  802030:	6a 00                	push   $0x0
+  802032:	6a 00                	push   $0x0
+  802034:	e8 d2 f2 ff ff       	call   80130b <ipc_recv>
+  802039:	89 c1                	mov    %eax,%ecx
+  80203b:	83 c4 10             	add    $0x10,%esp
+  80203e:	85 c0                	test   %eax,%eax
+  802040:	78 4f                	js     802091 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  802042:	a1 04 50 80 00       	mov    0x805004,%eax
+  802047:	8b 40 48             	mov    0x48(%eax),%eax
+  80204a:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  80204f:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  802056:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  802059:	83 ec 0c             	sub    $0xc,%esp
+  80205c:	ff 37                	push   (%edi)
+  80205e:	e8 e4 fc ff ff       	call   801d47 <devfile_sync>
+  802063:	89 c1                	mov    %eax,%ecx
+  802065:	83 c4 10             	add    $0x10,%esp
+  802068:	85 c0                	test   %eax,%eax
+  80206a:	78 25                	js     802091 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  80206c:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802072:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  802077:	ba 01 00 00 00       	mov    $0x1,%edx
+  80207c:	89 d0                	mov    %edx,%eax
+  80207e:	d3 e0                	shl    %cl,%eax
+  802080:	85 d8                	test   %ebx,%eax
+  802082:	74 0d                	je     802091 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802084:	83 c1 01             	add    $0x1,%ecx
+  802087:	83 f9 10             	cmp    $0x10,%ecx
+  80208a:	75 f0                	jne    80207c <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  80208c:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  802091:	89 c8                	mov    %ecx,%eax
+  802093:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802096:	5b                   	pop    %ebx
+  802097:	5e                   	pop    %esi
+  802098:	5f                   	pop    %edi
+  802099:	5d                   	pop    %ebp
+  80209a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80209b:	83 ec 0c             	sub    $0xc,%esp
+  80209e:	6a 01                	push   $0x1
+  8020a0:	e8 0a f4 ff ff       	call   8014af <ipc_find_env>
+  8020a5:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8020aa:	83 c4 10             	add    $0x10,%esp
+  8020ad:	e9 1e ff ff ff       	jmp    801fd0 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  8020b2:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  8020b7:	eb d8                	jmp    802091 <fsring_slot+0x111>
+
+008020b9 <file_read_direct>:
+{
+  8020b9:	55                   	push   %ebp
+  8020ba:	89 e5                	mov    %esp,%ebp
+  8020bc:	57                   	push   %edi
+  8020bd:	56                   	push   %esi
+  8020be:	53                   	push   %ebx
+  8020bf:	83 ec 1c             	sub    $0x1c,%esp
+  8020c2:	89 c7                	mov    %eax,%edi
+  8020c4:	89 d6                	mov    %edx,%esi
+  8020c6:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  8020c8:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  8020ce:	77 52                	ja     802122 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020d0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020d3:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8020d8:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8020de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020e8:	e8 b6 fb ff ff       	call   801ca3 <fsipc>
+  8020ed:	89 c7                	mov    %eax,%edi
+  8020ef:	85 c0                	test   %eax,%eax
+  8020f1:	78 25                	js     802118 <file_read_direct+0x5f>
+	assert(r <= n);
+  8020f3:	39 c3                	cmp    %eax,%ebx
+  8020f5:	0f 82 87 00 00 00    	jb     802182 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  8020fb:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802100:	0f 8f 95 00 00 00    	jg     80219b <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802106:	83 ec 04             	sub    $0x4,%esp
+  802109:	50                   	push   %eax
+  80210a:	68 00 60 80 00       	push   $0x806000
+  80210f:	56                   	push   %esi
+  802110:	e8 5a e8 ff ff       	call   80096f <memmove>
+	return r;
+  802115:	83 c4 10             	add    $0x10,%esp
+}
+  802118:	89 f8                	mov    %edi,%eax
+  80211a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80211d:	5b                   	pop    %ebx
+  80211e:	5e                   	pop    %esi
+  80211f:	5f                   	pop    %edi
+  802120:	5d                   	pop    %ebp
+  802121:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802122:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802128:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80212d:	29 d1                	sub    %edx,%ecx
+  80212f:	39 d9                	cmp    %ebx,%ecx
+  802131:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802134:	89 f0                	mov    %esi,%eax
+  802136:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  802139:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80213c:	eb 0f                	jmp    80214d <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  80213e:	0f b6 10             	movzbl (%eax),%edx
+  802141:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802143:	05 00 10 00 00       	add    $0x1000,%eax
+  802148:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80214d:	39 c8                	cmp    %ecx,%eax
+  80214f:	72 ed                	jb     80213e <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802151:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802154:	8b 47 0c             	mov    0xc(%edi),%eax
+  802157:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  80215c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802162:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  802168:	83 ec 0c             	sub    $0xc,%esp
+  80216b:	6a 07                	push   $0x7
+  80216d:	89 d9                	mov    %ebx,%ecx
+  80216f:	89 f2                	mov    %esi,%edx
+  802171:	b8 09 00 00 00       	mov    $0x9,%eax
+  802176:	e8 86 f9 ff ff       	call   801b01 <fsipc_pages>
+  80217b:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  80217d:	83 c4 10             	add    $0x10,%esp
+  802180:	eb 96                	jmp    802118 <file_read_direct+0x5f>
+	assert(r <= n);
+  802182:	68 5b 3d 80 00       	push   $0x803d5b
+  802187:	68 4c 3c 80 00       	push   $0x803c4c
+  80218c:	68 dc 00 00 00       	push   $0xdc
+  802191:	68 50 3d 80 00       	push   $0x803d50
+  802196:	e8 0e 13 00 00       	call   8034a9 <_panic>
+	assert(r <= PGSIZE);
+  80219b:	68 6c 3d 80 00       	push   $0x803d6c
+  8021a0:	68 4c 3c 80 00       	push   $0x803c4c
+  8021a5:	68 dd 00 00 00       	push   $0xdd
+  8021aa:	68 50 3d 80 00       	push   $0x803d50
+  8021af:	e8 f5 12 00 00       	call   8034a9 <_panic>
+
+008021b4 <devfile_read>:
+{
+  8021b4:	55                   	push   %ebp
+  8021b5:	89 e5                	mov    %esp,%ebp
+  8021b7:	57                   	push   %edi
+  8021b8:	56                   	push   %esi
+  8021b9:	53                   	push   %ebx
+  8021ba:	83 ec 28             	sub    $0x28,%esp
+  8021bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8021c0:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8021c3:	53                   	push   %ebx
+  8021c4:	e8 35 f3 ff ff       	call   8014fe <fd2data>
+  8021c9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8021cc:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8021cf:	83 c4 10             	add    $0x10,%esp
+  8021d2:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8021d6:	74 7d                	je     802255 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8021d8:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8021dc:	0f 85 81 00 00 00    	jne    802263 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  8021e2:	8b 43 18             	mov    0x18(%ebx),%eax
+  8021e5:	85 c0                	test   %eax,%eax
+  8021e7:	74 0d                	je     8021f6 <devfile_read+0x42>
+  8021e9:	8b 53 14             	mov    0x14(%ebx),%edx
+  8021ec:	39 fa                	cmp    %edi,%edx
+  8021ee:	7f 06                	jg     8021f6 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8021f0:	01 c2                	add    %eax,%edx
+  8021f2:	39 d7                	cmp    %edx,%edi
+  8021f4:	72 28                	jb     80221e <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8021f6:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8021fd:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802203:	77 74                	ja     802279 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  802205:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80220a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80220d:	89 d8                	mov    %ebx,%eax
+  80220f:	e8 a5 fe ff ff       	call   8020b9 <file_read_direct>
+  802214:	85 c0                	test   %eax,%eax
+  802216:	7e 35                	jle    80224d <devfile_read+0x99>
+		ff->buf_base = pos;
+  802218:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  80221b:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  80221e:	8b 53 14             	mov    0x14(%ebx),%edx
+  802221:	89 d0                	mov    %edx,%eax
+  802223:	03 43 18             	add    0x18(%ebx),%eax
+  802226:	29 f8                	sub    %edi,%eax
+  802228:	39 f0                	cmp    %esi,%eax
+  80222a:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  80222d:	83 ec 04             	sub    $0x4,%esp
+  802230:	56                   	push   %esi
+  802231:	89 f8                	mov    %edi,%eax
+  802233:	29 d0                	sub    %edx,%eax
+  802235:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802238:	01 c1                	add    %eax,%ecx
+  80223a:	51                   	push   %ecx
+  80223b:	ff 75 0c             	push   0xc(%ebp)
+  80223e:	e8 2c e7 ff ff       	call   80096f <memmove>
+	fd->fd_offset = pos + n;
+  802243:	01 f7                	add    %esi,%edi
+  802245:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802248:	89 f0                	mov    %esi,%eax
+  80224a:	83 c4 10             	add    $0x10,%esp
+}
+  80224d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802250:	5b                   	pop    %ebx
+  802251:	5e                   	pop    %esi
+  802252:	5f                   	pop    %edi
+  802253:	5d                   	pop    %ebp
+  802254:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802255:	89 f1                	mov    %esi,%ecx
+  802257:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80225a:	89 d8                	mov    %ebx,%eax
+  80225c:	e8 58 fe ff ff       	call   8020b9 <file_read_direct>
+  802261:	eb ea                	jmp    80224d <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802263:	83 ec 0c             	sub    $0xc,%esp
+  802266:	53                   	push   %ebx
+  802267:	e8 db fa ff ff       	call   801d47 <devfile_sync>
+  80226c:	83 c4 10             	add    $0x10,%esp
+  80226f:	85 c0                	test   %eax,%eax
+  802271:	0f 89 6b ff ff ff    	jns    8021e2 <devfile_read+0x2e>
+  802277:	eb d4                	jmp    80224d <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  802279:	89 f1                	mov    %esi,%ecx
+  80227b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80227e:	89 d8                	mov    %ebx,%eax
+  802280:	e8 34 fe ff ff       	call   8020b9 <file_read_direct>
+  802285:	eb c6                	jmp    80224d <devfile_read+0x99>
+
+00802287 <open>:
+{
+  802287:	55                   	push   %ebp
+  802288:	89 e5                	mov    %esp,%ebp
+  80228a:	56                   	push   %esi
+  80228b:	53                   	push   %ebx
+  80228c:	83 ec 1c             	sub    $0x1c,%esp
+  80228f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802292:	56                   	push   %esi
+  802293:	e8 16 e5 ff ff       	call   8007ae <strlen>
+  802298:	83 c4 10             	add    $0x10,%esp
+  80229b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022a0:	0f 8f a0 00 00 00    	jg     802346 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  8022a6:	83 ec 0c             	sub    $0xc,%esp
+  8022a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022ac:	50                   	push   %eax
+  8022ad:	e8 63 f2 ff ff       	call   801515 <fd_alloc>
+  8022b2:	89 c3                	mov    %eax,%ebx
+  8022b4:	83 c4 10             	add    $0x10,%esp
+  8022b7:	85 c0                	test   %eax,%eax
+  8022b9:	78 45                	js     802300 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  8022bb:	83 ec 08             	sub    $0x8,%esp
+  8022be:	56                   	push   %esi
+  8022bf:	68 00 60 80 00       	push   $0x806000
+  8022c4:	e8 20 e5 ff ff       	call   8007e9 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8022c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022cc:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8022d1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022d9:	e8 c5 f9 ff ff       	call   801ca3 <fsipc>
+  8022de:	89 c3                	mov    %eax,%ebx
+  8022e0:	83 c4 10             	add    $0x10,%esp
+  8022e3:	85 c0                	test   %eax,%eax
+  8022e5:	78 22                	js     802309 <open+0x82>
+	if (!(mode & O_NOBUF)
+  8022e7:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8022ee:	74 2b                	je     80231b <open+0x94>
+	return fd2num(fd);
+  8022f0:	83 ec 0c             	sub    $0xc,%esp
+  8022f3:	ff 75 f4             	push   -0xc(%ebp)
+  8022f6:	e8 f3 f1 ff ff       	call   8014ee <fd2num>
+  8022fb:	89 c3                	mov    %eax,%ebx
+  8022fd:	83 c4 10             	add    $0x10,%esp
+}
+  802300:	89 d8                	mov    %ebx,%eax
+  802302:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802305:	5b                   	pop    %ebx
+  802306:	5e                   	pop    %esi
+  802307:	5d                   	pop    %ebp
+  802308:	c3                   	ret
+		fd_close(fd, 0);
+  802309:	83 ec 08             	sub    $0x8,%esp
+  80230c:	6a 00                	push   $0x0
+  80230e:	ff 75 f4             	push   -0xc(%ebp)
+  802311:	e8 f8 f2 ff ff       	call   80160e <fd_close>
+		return r;
+  802316:	83 c4 10             	add    $0x10,%esp
+  802319:	eb e5                	jmp    802300 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  80231b:	83 ec 0c             	sub    $0xc,%esp
+  80231e:	ff 75 f4             	push   -0xc(%ebp)
+  802321:	e8 d8 f1 ff ff       	call   8014fe <fd2data>
+  802326:	83 c4 0c             	add    $0xc,%esp
+  802329:	68 07 04 00 00       	push   $0x407
+  80232e:	50                   	push   %eax
+  80232f:	6a 00                	push   $0x0
+  802331:	e8 bf e8 ff ff       	call   800bf5 <sys_page_alloc>
+  802336:	83 c4 10             	add    $0x10,%esp
+  802339:	85 c0                	test   %eax,%eax
+  80233b:	75 b3                	jne    8022f0 <open+0x69>
+		fd->fd_file.buffered = 1;
+  80233d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802340:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802344:	eb aa                	jmp    8022f0 <open+0x69>
+		return -E_BAD_PATH;
+  802346:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80234b:	eb b3                	jmp    802300 <open+0x79>
+
+0080234d <readdir>:
+{
+  80234d:	55                   	push   %ebp
+  80234e:	89 e5                	mov    %esp,%ebp
+  802350:	53                   	push   %ebx
+  802351:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802354:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802357:	50                   	push   %eax
+  802358:	ff 75 08             	push   0x8(%ebp)
+  80235b:	e8 0b f2 ff ff       	call   80156b <fd_lookup>
+  802360:	89 c3                	mov    %eax,%ebx
+  802362:	83 c4 10             	add    $0x10,%esp
+  802365:	85 c0                	test   %eax,%eax
+  802367:	78 73                	js     8023dc <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802369:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80236c:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802372:	39 08                	cmp    %ecx,(%eax)
+  802374:	0f 85 82 00 00 00    	jne    8023fc <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  80237a:	83 ec 0c             	sub    $0xc,%esp
+  80237d:	50                   	push   %eax
+  80237e:	e8 c4 f9 ff ff       	call   801d47 <devfile_sync>
+  802383:	89 c3                	mov    %eax,%ebx
+  802385:	83 c4 10             	add    $0x10,%esp
+  802388:	85 c0                	test   %eax,%eax
+  80238a:	78 50                	js     8023dc <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  80238c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80238f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802392:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  802397:	8b 45 10             	mov    0x10(%ebp),%eax
+  80239a:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  80239f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023a2:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  8023a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ac:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8023b1:	e8 ed f8 ff ff       	call   801ca3 <fsipc>
+  8023b6:	89 c3                	mov    %eax,%ebx
+  8023b8:	85 c0                	test   %eax,%eax
+  8023ba:	7e 20                	jle    8023dc <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  8023bc:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8023bf:	72 22                	jb     8023e3 <readdir+0x96>
+  8023c1:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8023c6:	7f 1b                	jg     8023e3 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8023c8:	83 ec 04             	sub    $0x4,%esp
+  8023cb:	50                   	push   %eax
+  8023cc:	68 00 60 80 00       	push   $0x806000
+  8023d1:	ff 75 0c             	push   0xc(%ebp)
+  8023d4:	e8 96 e5 ff ff       	call   80096f <memmove>
+	return r;
+  8023d9:	83 c4 10             	add    $0x10,%esp
+}
+  8023dc:	89 d8                	mov    %ebx,%eax
+  8023de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023e1:	c9                   	leave
+  8023e2:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8023e3:	68 62 3d 80 00       	push   $0x803d62
+  8023e8:	68 4c 3c 80 00       	push   $0x803c4c
+  8023ed:	68 86 01 00 00       	push   $0x186
+  8023f2:	68 50 3d 80 00       	push   $0x803d50
+  8023f7:	e8 ad 10 00 00       	call   8034a9 <_panic>
+		return -E_NOT_SUPP;
+  8023fc:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802401:	eb d9                	jmp    8023dc <readdir+0x8f>
+
+00802403 <munmap>:
+{
+  802403:	55                   	push   %ebp
+  802404:	89 e5                	mov    %esp,%ebp
+  802406:	56                   	push   %esi
+  802407:	53                   	push   %ebx
+  802408:	8b 75 08             	mov    0x8(%ebp),%esi
+  80240b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80240e:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  802414:	75 41                	jne    802457 <munmap+0x54>
+  802416:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  80241c:	77 39                	ja     802457 <munmap+0x54>
+  80241e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802423:	29 f0                	sub    %esi,%eax
+  802425:	39 d0                	cmp    %edx,%eax
+  802427:	72 35                	jb     80245e <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802429:	89 f3                	mov    %esi,%ebx
+  80242b:	01 d6                	add    %edx,%esi
+  80242d:	39 f3                	cmp    %esi,%ebx
+  80242f:	73 1a                	jae    80244b <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802431:	83 ec 08             	sub    $0x8,%esp
+  802434:	53                   	push   %ebx
+  802435:	6a 00                	push   $0x0
+  802437:	e8 46 e8 ff ff       	call   800c82 <sys_page_unmap>
+  80243c:	83 c4 10             	add    $0x10,%esp
+  80243f:	85 c0                	test   %eax,%eax
+  802441:	78 0d                	js     802450 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802443:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802449:	eb e2                	jmp    80242d <munmap+0x2a>
+	return 0;
+  80244b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802450:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802453:	5b                   	pop    %ebx
+  802454:	5e                   	pop    %esi
+  802455:	5d                   	pop    %ebp
+  802456:	c3                   	ret
+		return -E_INVAL;
+  802457:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80245c:	eb f2                	jmp    802450 <munmap+0x4d>
+  80245e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802463:	eb eb                	jmp    802450 <munmap+0x4d>
+
+00802465 <mmap>:
+{
+  802465:	55                   	push   %ebp
+  802466:	89 e5                	mov    %esp,%ebp
+  802468:	57                   	push   %edi
+  802469:	56                   	push   %esi
+  80246a:	53                   	push   %ebx
+  80246b:	83 ec 34             	sub    $0x34,%esp
+  80246e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802471:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802474:	50                   	push   %eax
+  802475:	ff 75 18             	push   0x18(%ebp)
+  802478:	e8 ee f0 ff ff       	call   80156b <fd_lookup>
+  80247d:	89 c3                	mov    %eax,%ebx
+  80247f:	83 c4 10             	add    $0x10,%esp
+  802482:	85 c0                	test   %eax,%eax
+  802484:	0f 88 0e 01 00 00    	js     802598 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80248a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80248d:	a1 20 40 80 00       	mov    0x804020,%eax
+  802492:	39 02                	cmp    %eax,(%edx)
+  802494:	0f 85 50 01 00 00    	jne    8025ea <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  80249a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80249d:	83 e0 02             	and    $0x2,%eax
+  8024a0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8024a3:	74 0a                	je     8024af <mmap+0x4a>
+  8024a5:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8024a9:	0f 84 42 01 00 00    	je     8025f1 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  8024af:	8b 42 08             	mov    0x8(%edx),%eax
+  8024b2:	83 e0 03             	and    $0x3,%eax
+  8024b5:	83 f8 01             	cmp    $0x1,%eax
+  8024b8:	0f 84 3a 01 00 00    	je     8025f8 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8024be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024c1:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8024c4:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8024c9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8024cc:	0f 85 2d 01 00 00    	jne    8025ff <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8024d2:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8024d6:	0f 88 2a 01 00 00    	js     802606 <mmap+0x1a1>
+  8024dc:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8024e3:	0f 87 1d 01 00 00    	ja     802606 <mmap+0x1a1>
+  8024e9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8024ee:	2b 45 08             	sub    0x8(%ebp),%eax
+  8024f1:	39 f8                	cmp    %edi,%eax
+  8024f3:	0f 82 14 01 00 00    	jb     80260d <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8024f9:	83 ec 0c             	sub    $0xc,%esp
+  8024fc:	52                   	push   %edx
+  8024fd:	e8 45 f8 ff ff       	call   801d47 <devfile_sync>
+  802502:	89 c3                	mov    %eax,%ebx
+  802504:	83 c4 10             	add    $0x10,%esp
+  802507:	85 c0                	test   %eax,%eax
+  802509:	0f 88 89 00 00 00    	js     802598 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  80250f:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802515:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80251b:	be 00 00 00 00       	mov    $0x0,%esi
+  802520:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802523:	39 fe                	cmp    %edi,%esi
+  802525:	73 7b                	jae    8025a2 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  802527:	89 f8                	mov    %edi,%eax
+  802529:	29 f0                	sub    %esi,%eax
+  80252b:	c1 e8 0c             	shr    $0xc,%eax
+  80252e:	ba 40 00 00 00       	mov    $0x40,%edx
+  802533:	39 d0                	cmp    %edx,%eax
+  802535:	0f 47 c2             	cmova  %edx,%eax
+  802538:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80253b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80253e:	8b 52 0c             	mov    0xc(%edx),%edx
+  802541:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  802547:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  80254a:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  802550:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802555:	89 f2                	mov    %esi,%edx
+  802557:	03 55 08             	add    0x8(%ebp),%edx
+  80255a:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80255d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802562:	e8 ea f6 ff ff       	call   801c51 <fsipcv>
+  802567:	85 c0                	test   %eax,%eax
+  802569:	7e 12                	jle    80257d <mmap+0x118>
+  80256b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80256e:	85 c0                	test   %eax,%eax
+  802570:	0f 84 9e 00 00 00    	je     802614 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802576:	c1 e0 0c             	shl    $0xc,%eax
+  802579:	01 c6                	add    %eax,%esi
+  80257b:	eb a6                	jmp    802523 <mmap+0xbe>
+			munmap(addr, done);
+  80257d:	89 c3                	mov    %eax,%ebx
+  80257f:	83 ec 08             	sub    $0x8,%esp
+  802582:	56                   	push   %esi
+  802583:	ff 75 08             	push   0x8(%ebp)
+  802586:	e8 78 fe ff ff       	call   802403 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80258b:	83 c4 10             	add    $0x10,%esp
+  80258e:	85 db                	test   %ebx,%ebx
+  802590:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802595:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802598:	89 d8                	mov    %ebx,%eax
+  80259a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80259d:	5b                   	pop    %ebx
+  80259e:	5e                   	pop    %esi
+  80259f:	5f                   	pop    %edi
+  8025a0:	5d                   	pop    %ebp
+  8025a1:	c3                   	ret
+	if (prot & PROT_WRITE)
+  8025a2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8025a5:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8025a7:	85 c0                	test   %eax,%eax
+  8025a9:	74 ed                	je     802598 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8025ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8025b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8025b3:	39 fe                	cmp    %edi,%esi
+  8025b5:	73 2e                	jae    8025e5 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8025b7:	83 ec 0c             	sub    $0xc,%esp
+  8025ba:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8025bd:	50                   	push   %eax
+  8025be:	e8 4a eb ff ff       	call   80110d <cowpage>
+  8025c3:	83 c4 10             	add    $0x10,%esp
+  8025c6:	85 c0                	test   %eax,%eax
+  8025c8:	78 08                	js     8025d2 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8025ca:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8025d0:	eb e1                	jmp    8025b3 <mmap+0x14e>
+				munmap(addr, len);
+  8025d2:	89 c3                	mov    %eax,%ebx
+  8025d4:	83 ec 08             	sub    $0x8,%esp
+  8025d7:	57                   	push   %edi
+  8025d8:	ff 75 08             	push   0x8(%ebp)
+  8025db:	e8 23 fe ff ff       	call   802403 <munmap>
+				return r;
+  8025e0:	83 c4 10             	add    $0x10,%esp
+  8025e3:	eb b3                	jmp    802598 <mmap+0x133>
+	return 0;
+  8025e5:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8025e8:	eb ae                	jmp    802598 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8025ea:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8025ef:	eb a7                	jmp    802598 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8025f1:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8025f6:	eb a0                	jmp    802598 <mmap+0x133>
+		return -E_INVAL;
+  8025f8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025fd:	eb 99                	jmp    802598 <mmap+0x133>
+  8025ff:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802604:	eb 92                	jmp    802598 <mmap+0x133>
+  802606:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80260b:	eb 8b                	jmp    802598 <mmap+0x133>
+  80260d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802612:	eb 84                	jmp    802598 <mmap+0x133>
+			munmap(addr, done);
+  802614:	83 ec 08             	sub    $0x8,%esp
+  802617:	56                   	push   %esi
+  802618:	ff 75 08             	push   0x8(%ebp)
+  80261b:	e8 e3 fd ff ff       	call   802403 <munmap>
+  802620:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802623:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802628:	e9 6b ff ff ff       	jmp    802598 <mmap+0x133>
+
+0080262d <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80262d:	55                   	push   %ebp
+  80262e:	89 e5                	mov    %esp,%ebp
+  802630:	56                   	push   %esi
+  802631:	53                   	push   %ebx
+  802632:	83 ec 10             	sub    $0x10,%esp
+  802635:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802638:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80263b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80263e:	e8 3d f9 ff ff       	call   801f80 <fsring_slot>
+  802643:	85 c0                	test   %eax,%eax
+  802645:	78 60                	js     8026a7 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802647:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80264a:	8b 56 08             	mov    0x8(%esi),%edx
+  80264d:	83 e2 03             	and    $0x3,%edx
+  802650:	83 fa 01             	cmp    $0x1,%edx
+  802653:	74 59                	je     8026ae <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802655:	ba 01 00 00 00       	mov    $0x1,%edx
+  80265a:	89 c1                	mov    %eax,%ecx
+  80265c:	d3 e2                	shl    %cl,%edx
+  80265e:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802664:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802667:	c1 e2 02             	shl    $0x2,%edx
+  80266a:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  802670:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  802677:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80267a:	8b 55 18             	mov    0x18(%ebp),%edx
+  80267d:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802680:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802683:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802686:	83 ec 08             	sub    $0x8,%esp
+  802689:	50                   	push   %eax
+  80268a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80268f:	39 c3                	cmp    %eax,%ebx
+  802691:	0f 47 d8             	cmova  %eax,%ebx
+  802694:	53                   	push   %ebx
+  802695:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802698:	89 f2                	mov    %esi,%edx
+  80269a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80269f:	e8 1e f5 ff ff       	call   801bc2 <fsring_post>
+  8026a4:	83 c4 10             	add    $0x10,%esp
+}
+  8026a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026aa:	5b                   	pop    %ebx
+  8026ab:	5e                   	pop    %esi
+  8026ac:	5d                   	pop    %ebp
+  8026ad:	c3                   	ret
+		return -E_INVAL;
+  8026ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026b3:	eb f2                	jmp    8026a7 <fsring_read+0x7a>
+
+008026b5 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8026b5:	55                   	push   %ebp
+  8026b6:	89 e5                	mov    %esp,%ebp
+  8026b8:	56                   	push   %esi
+  8026b9:	53                   	push   %ebx
+  8026ba:	83 ec 10             	sub    $0x10,%esp
+  8026bd:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8026c0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026c6:	e8 b5 f8 ff ff       	call   801f80 <fsring_slot>
+  8026cb:	89 c3                	mov    %eax,%ebx
+  8026cd:	85 c0                	test   %eax,%eax
+  8026cf:	78 77                	js     802748 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8026d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026d4:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8026d8:	74 77                	je     802751 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8026da:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8026df:	39 c6                	cmp    %eax,%esi
+  8026e1:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8026e4:	83 ec 04             	sub    $0x4,%esp
+  8026e7:	56                   	push   %esi
+  8026e8:	ff 75 0c             	push   0xc(%ebp)
+  8026eb:	89 d8                	mov    %ebx,%eax
+  8026ed:	c1 e0 0c             	shl    $0xc,%eax
+  8026f0:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8026f6:	50                   	push   %eax
+  8026f7:	e8 73 e2 ff ff       	call   80096f <memmove>
+	fsring_busy |= 1 << slot;
+  8026fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802701:	89 d9                	mov    %ebx,%ecx
+  802703:	d3 e0                	shl    %cl,%eax
+  802705:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  80270b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80270e:	c1 e0 02             	shl    $0x2,%eax
+  802711:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  802717:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  80271e:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802721:	8b 45 18             	mov    0x18(%ebp),%eax
+  802724:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  802727:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  80272e:	83 c4 08             	add    $0x8,%esp
+  802731:	53                   	push   %ebx
+  802732:	56                   	push   %esi
+  802733:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802736:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802739:	b8 04 00 00 00       	mov    $0x4,%eax
+  80273e:	e8 7f f4 ff ff       	call   801bc2 <fsring_post>
+  802743:	89 c3                	mov    %eax,%ebx
+  802745:	83 c4 10             	add    $0x10,%esp
+}
+  802748:	89 d8                	mov    %ebx,%eax
+  80274a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80274d:	5b                   	pop    %ebx
+  80274e:	5e                   	pop    %esi
+  80274f:	5d                   	pop    %ebp
+  802750:	c3                   	ret
+		return -E_INVAL;
+  802751:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802756:	eb f0                	jmp    802748 <fsring_write+0x93>
+
+00802758 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802758:	55                   	push   %ebp
+  802759:	89 e5                	mov    %esp,%ebp
+  80275b:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80275e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802761:	8b 45 08             	mov    0x8(%ebp),%eax
+  802764:	e8 17 f8 ff ff       	call   801f80 <fsring_slot>
+  802769:	85 c0                	test   %eax,%eax
+  80276b:	78 4c                	js     8027b9 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  80276d:	ba 01 00 00 00       	mov    $0x1,%edx
+  802772:	89 c1                	mov    %eax,%ecx
+  802774:	d3 e2                	shl    %cl,%edx
+  802776:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  80277c:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80277f:	c1 e2 02             	shl    $0x2,%edx
+  802782:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  802788:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  80278f:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802792:	8b 55 10             	mov    0x10(%ebp),%edx
+  802795:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802798:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80279b:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80279e:	83 ec 08             	sub    $0x8,%esp
+  8027a1:	50                   	push   %eax
+  8027a2:	6a 00                	push   $0x0
+  8027a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027a9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027ac:	b8 05 00 00 00       	mov    $0x5,%eax
+  8027b1:	e8 0c f4 ff ff       	call   801bc2 <fsring_post>
+  8027b6:	83 c4 10             	add    $0x10,%esp
+}
+  8027b9:	c9                   	leave
+  8027ba:	c3                   	ret
+
+008027bb <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8027bb:	55                   	push   %ebp
+  8027bc:	89 e5                	mov    %esp,%ebp
+  8027be:	57                   	push   %edi
+  8027bf:	56                   	push   %esi
+  8027c0:	53                   	push   %ebx
+  8027c1:	83 ec 1c             	sub    $0x1c,%esp
+  8027c4:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8027c8:	a1 04 50 80 00       	mov    0x805004,%eax
+  8027cd:	8b 40 48             	mov    0x48(%eax),%eax
+  8027d0:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  8027d6:	74 12                	je     8027ea <fsring_reap+0x2f>
+		return 0;
+  8027d8:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8027dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027e0:	5b                   	pop    %ebx
+  8027e1:	5e                   	pop    %esi
+  8027e2:	5f                   	pop    %edi
+  8027e3:	5d                   	pop    %ebp
+  8027e4:	c3                   	ret
+		sys_yield();
+  8027e5:	e8 ec e3 ff ff       	call   800bd6 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8027ea:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8027f0:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8027f5:	39 c2                	cmp    %eax,%edx
+  8027f7:	75 18                	jne    802811 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8027f9:	84 db                	test   %bl,%bl
+  8027fb:	0f 84 21 01 00 00    	je     802922 <fsring_reap+0x167>
+  802801:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  802808:	75 db                	jne    8027e5 <fsring_reap+0x2a>
+			return 0;
+  80280a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280f:	eb cc                	jmp    8027dd <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802811:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802816:	83 e0 0f             	and    $0xf,%eax
+  802819:	83 c0 2a             	add    $0x2a,%eax
+  80281c:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802823:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  80282a:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80282f:	83 c0 01             	add    $0x1,%eax
+  802832:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802837:	83 fb 0f             	cmp    $0xf,%ebx
+  80283a:	77 5b                	ja     802897 <fsring_reap+0xdc>
+  80283c:	be 01 00 00 00       	mov    $0x1,%esi
+  802841:	89 d9                	mov    %ebx,%ecx
+  802843:	d3 e6                	shl    %cl,%esi
+  802845:	89 f0                	mov    %esi,%eax
+  802847:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  80284d:	74 48                	je     802897 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  80284f:	89 d8                	mov    %ebx,%eax
+  802851:	c1 e0 0c             	shl    $0xc,%eax
+  802854:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80285a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  80285d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802860:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  802867:	83 f8 03             	cmp    $0x3,%eax
+  80286a:	74 40                	je     8028ac <fsring_reap+0xf1>
+  80286c:	83 f8 05             	cmp    $0x5,%eax
+  80286f:	74 64                	je     8028d5 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802871:	f7 d6                	not    %esi
+  802873:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802879:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80287c:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  802883:	8b 45 08             	mov    0x8(%ebp),%eax
+  802886:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802888:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80288b:	89 38                	mov    %edi,(%eax)
+	return 1;
+  80288d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802892:	e9 46 ff ff ff       	jmp    8027dd <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802897:	53                   	push   %ebx
+  802898:	68 78 3d 80 00       	push   $0x803d78
+  80289d:	68 8f 02 00 00       	push   $0x28f
+  8028a2:	68 50 3d 80 00       	push   $0x803d50
+  8028a7:	e8 fd 0b 00 00       	call   8034a9 <_panic>
+		if (cqe.cqe_result > 0)
+  8028ac:	85 ff                	test   %edi,%edi
+  8028ae:	7e c1                	jle    802871 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8028b0:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8028b3:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8028b8:	39 c7                	cmp    %eax,%edi
+  8028ba:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8028bd:	50                   	push   %eax
+  8028be:	ff 75 e4             	push   -0x1c(%ebp)
+  8028c1:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8028c4:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  8028cb:	e8 9f e0 ff ff       	call   80096f <memmove>
+  8028d0:	83 c4 10             	add    $0x10,%esp
+  8028d3:	eb 9c                	jmp    802871 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8028d5:	85 ff                	test   %edi,%edi
+  8028d7:	75 98                	jne    802871 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  8028d9:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8028dc:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8028e3:	83 ec 08             	sub    $0x8,%esp
+  8028e6:	ff 75 e4             	push   -0x1c(%ebp)
+  8028e9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8028ec:	51                   	push   %ecx
+  8028ed:	e8 f7 de ff ff       	call   8007e9 <strcpy>
+			st->st_size = ret->ret_size;
+  8028f2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028f5:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8028fb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8028fe:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802904:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  80290a:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802910:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  802917:	40 80 00 
+  80291a:	83 c4 10             	add    $0x10,%esp
+  80291d:	e9 4f ff ff ff       	jmp    802871 <fsring_reap+0xb6>
+			return 0;
+  802922:	b8 00 00 00 00       	mov    $0x0,%eax
+  802927:	e9 b1 fe ff ff       	jmp    8027dd <fsring_reap+0x22>
+
+0080292c <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  80292c:	55                   	push   %ebp
+  80292d:	89 e5                	mov    %esp,%ebp
+  80292f:	57                   	push   %edi
+  802930:	56                   	push   %esi
+  802931:	53                   	push   %ebx
+  802932:	83 ec 28             	sub    $0x28,%esp
+  802935:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802938:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80293b:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80293e:	53                   	push   %ebx
+  80293f:	e8 6a de ff ff       	call   8007ae <strlen>
+  802944:	83 c4 10             	add    $0x10,%esp
+  802947:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80294c:	0f 8f 02 01 00 00    	jg     802a54 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802952:	83 ec 08             	sub    $0x8,%esp
+  802955:	53                   	push   %ebx
+  802956:	68 00 60 80 00       	push   $0x806000
+  80295b:	e8 89 de ff ff       	call   8007e9 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802960:	83 c4 10             	add    $0x10,%esp
+  802963:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802969:	76 69                	jbe    8029d4 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80296b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80296e:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802974:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802979:	29 d1                	sub    %edx,%ecx
+  80297b:	39 f9                	cmp    %edi,%ecx
+  80297d:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802980:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802983:	89 f9                	mov    %edi,%ecx
+  802985:	01 c1                	add    %eax,%ecx
+  802987:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80298a:	eb 0f                	jmp    80299b <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  80298c:	0f b6 10             	movzbl (%eax),%edx
+  80298f:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802991:	05 00 10 00 00       	add    $0x1000,%eax
+  802996:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80299b:	39 c8                	cmp    %ecx,%eax
+  80299d:	72 ed                	jb     80298c <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  80299f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8029a2:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  8029a8:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8029ae:	83 ec 0c             	sub    $0xc,%esp
+  8029b1:	6a 07                	push   $0x7
+  8029b3:	89 f9                	mov    %edi,%ecx
+  8029b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029b8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8029bd:	e8 3f f1 ff ff       	call   801b01 <fsipc_pages>
+  8029c2:	89 c7                	mov    %eax,%edi
+  8029c4:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8029c7:	85 f6                	test   %esi,%esi
+  8029c9:	74 7f                	je     802a4a <file_slurp+0x11e>
+  8029cb:	8d 43 01             	lea    0x1(%ebx),%eax
+  8029ce:	85 ff                	test   %edi,%edi
+  8029d0:	79 3c                	jns    802a0e <file_slurp+0xe2>
+  8029d2:	eb 76                	jmp    802a4a <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8029d4:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8029da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029df:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8029e4:	e8 ba f2 ff ff       	call   801ca3 <fsipc>
+  8029e9:	89 c7                	mov    %eax,%edi
+  8029eb:	85 c0                	test   %eax,%eax
+  8029ed:	7e d8                	jle    8029c7 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8029ef:	83 ec 04             	sub    $0x4,%esp
+  8029f2:	50                   	push   %eax
+  8029f3:	68 08 60 80 00       	push   $0x806008
+  8029f8:	ff 75 0c             	push   0xc(%ebp)
+  8029fb:	e8 6f df ff ff       	call   80096f <memmove>
+  802a00:	83 c4 10             	add    $0x10,%esp
+  802a03:	eb c2                	jmp    8029c7 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802a05:	80 fa 2f             	cmp    $0x2f,%dl
+  802a08:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802a0b:	83 c0 01             	add    $0x1,%eax
+  802a0e:	89 c1                	mov    %eax,%ecx
+  802a10:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802a14:	84 d2                	test   %dl,%dl
+  802a16:	75 ed                	jne    802a05 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802a18:	83 ec 04             	sub    $0x4,%esp
+  802a1b:	68 80 00 00 00       	push   $0x80
+  802a20:	53                   	push   %ebx
+  802a21:	56                   	push   %esi
+  802a22:	e8 38 de ff ff       	call   80085f <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802a27:	a1 00 60 80 00       	mov    0x806000,%eax
+  802a2c:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802a32:	a1 04 60 80 00       	mov    0x806004,%eax
+  802a37:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802a3d:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  802a44:	40 80 00 
+  802a47:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802a4a:	89 f8                	mov    %edi,%eax
+  802a4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a4f:	5b                   	pop    %ebx
+  802a50:	5e                   	pop    %esi
+  802a51:	5f                   	pop    %edi
+  802a52:	5d                   	pop    %ebp
+  802a53:	c3                   	ret
+		return -E_BAD_PATH;
+  802a54:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802a59:	eb ef                	jmp    802a4a <file_slurp+0x11e>
+
+00802a5b <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802a5b:	55                   	push   %ebp
+  802a5c:	89 e5                	mov    %esp,%ebp
+  802a5e:	53                   	push   %ebx
+  802a5f:	83 ec 10             	sub    $0x10,%esp
+  802a62:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802a65:	53                   	push   %ebx
+  802a66:	e8 43 dd ff ff       	call   8007ae <strlen>
+  802a6b:	83 c4 10             	add    $0x10,%esp
+  802a6e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a73:	7f 25                	jg     802a9a <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802a75:	83 ec 08             	sub    $0x8,%esp
+  802a78:	53                   	push   %ebx
+  802a79:	68 00 60 80 00       	push   $0x806000
+  802a7e:	e8 66 dd ff ff       	call   8007e9 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802a83:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a88:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a8d:	e8 11 f2 ff ff       	call   801ca3 <fsipc>
+  802a92:	83 c4 10             	add    $0x10,%esp
+}
+  802a95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a98:	c9                   	leave
+  802a99:	c3                   	ret
+		return -E_BAD_PATH;
+  802a9a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802a9f:	eb f4                	jmp    802a95 <remove+0x3a>
+
+00802aa1 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802aa1:	55                   	push   %ebp
+  802aa2:	89 e5                	mov    %esp,%ebp
+  802aa4:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802aa7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aac:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ab1:	e8 ed f1 ff ff       	call   801ca3 <fsipc>
+}
+  802ab6:	c9                   	leave
+  802ab7:	c3                   	ret
+
+00802ab8 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802ab8:	55                   	push   %ebp
+  802ab9:	89 e5                	mov    %esp,%ebp
+  802abb:	57                   	push   %edi
+  802abc:	56                   	push   %esi
+  802abd:	53                   	push   %ebx
+  802abe:	83 ec 18             	sub    $0x18,%esp
+  802ac1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ac4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802ac7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802aca:	57                   	push   %edi
+  802acb:	e8 de dc ff ff       	call   8007ae <strlen>
+  802ad0:	83 c4 10             	add    $0x10,%esp
+  802ad3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802ad8:	7f 4c                	jg     802b26 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802ada:	83 ec 08             	sub    $0x8,%esp
+  802add:	57                   	push   %edi
+  802ade:	68 00 60 80 00       	push   $0x806000
+  802ae3:	e8 01 dd ff ff       	call   8007e9 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802ae8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aed:	b8 10 00 00 00       	mov    $0x10,%eax
+  802af2:	e8 ac f1 ff ff       	call   801ca3 <fsipc>
+  802af7:	83 c4 10             	add    $0x10,%esp
+  802afa:	85 c0                	test   %eax,%eax
+  802afc:	78 20                	js     802b1e <defrag+0x66>
+		return r;
+	if (before)
+  802afe:	85 f6                	test   %esi,%esi
+  802b00:	74 07                	je     802b09 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802b02:	a1 00 60 80 00       	mov    0x806000,%eax
+  802b07:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802b09:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802b0e:	85 db                	test   %ebx,%ebx
+  802b10:	74 0c                	je     802b1e <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802b12:	a1 04 60 80 00       	mov    0x806004,%eax
+  802b17:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802b19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b21:	5b                   	pop    %ebx
+  802b22:	5e                   	pop    %esi
+  802b23:	5f                   	pop    %edi
+  802b24:	5d                   	pop    %ebp
+  802b25:	c3                   	ret
+		return -E_BAD_PATH;
+  802b26:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802b2b:	eb f1                	jmp    802b1e <defrag+0x66>
+
+00802b2d <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802b2d:	55                   	push   %ebp
+  802b2e:	89 e5                	mov    %esp,%ebp
+  802b30:	53                   	push   %ebx
+  802b31:	83 ec 04             	sub    $0x4,%esp
+  802b34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802b37:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b3c:	b8 11 00 00 00       	mov    $0x11,%eax
+  802b41:	e8 5d f1 ff ff       	call   801ca3 <fsipc>
+  802b46:	85 c0                	test   %eax,%eax
+  802b48:	78 34                	js     802b7e <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802b4a:	a1 00 60 80 00       	mov    0x806000,%eax
+  802b4f:	89 03                	mov    %eax,(%ebx)
+  802b51:	a1 04 60 80 00       	mov    0x806004,%eax
+  802b56:	89 43 04             	mov    %eax,0x4(%ebx)
+  802b59:	a1 08 60 80 00       	mov    0x806008,%eax
+  802b5e:	89 43 08             	mov    %eax,0x8(%ebx)
+  802b61:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  802b66:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802b69:	a1 10 60 80 00       	mov    0x806010,%eax
+  802b6e:	89 43 10             	mov    %eax,0x10(%ebx)
+  802b71:	a1 14 60 80 00       	mov    0x806014,%eax
+  802b76:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802b79:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b81:	c9                   	leave
+  802b82:	c3                   	ret
+
+00802b83 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b83:	55                   	push   %ebp
+  802b84:	89 e5                	mov    %esp,%ebp
+  802b86:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802b89:	68 91 3d 80 00       	push   $0x803d91
+  802b8e:	ff 75 0c             	push   0xc(%ebp)
+  802b91:	e8 53 dc ff ff       	call   8007e9 <strcpy>
+	return 0;
+}
+  802b96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9b:	c9                   	leave
+  802b9c:	c3                   	ret
+
+00802b9d <devsock_close>:
+{
+  802b9d:	55                   	push   %ebp
+  802b9e:	89 e5                	mov    %esp,%ebp
+  802ba0:	53                   	push   %ebx
+  802ba1:	83 ec 10             	sub    $0x10,%esp
+  802ba4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802ba7:	53                   	push   %ebx
+  802ba8:	e8 db 09 00 00       	call   803588 <pageref>
+  802bad:	89 c2                	mov    %eax,%edx
+  802baf:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802bb7:	83 fa 01             	cmp    $0x1,%edx
+  802bba:	74 05                	je     802bc1 <devsock_close+0x24>
+}
+  802bbc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bbf:	c9                   	leave
+  802bc0:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802bc1:	83 ec 0c             	sub    $0xc,%esp
+  802bc4:	ff 73 0c             	push   0xc(%ebx)
+  802bc7:	e8 b7 02 00 00       	call   802e83 <nsipc_close>
+  802bcc:	83 c4 10             	add    $0x10,%esp
+  802bcf:	eb eb                	jmp    802bbc <devsock_close+0x1f>
+
+00802bd1 <devsock_write>:
+{
+  802bd1:	55                   	push   %ebp
+  802bd2:	89 e5                	mov    %esp,%ebp
+  802bd4:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802bd7:	6a 00                	push   $0x0
+  802bd9:	ff 75 10             	push   0x10(%ebp)
+  802bdc:	ff 75 0c             	push   0xc(%ebp)
+  802bdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be2:	ff 70 0c             	push   0xc(%eax)
+  802be5:	e8 79 03 00 00       	call   802f63 <nsipc_send>
+}
+  802bea:	c9                   	leave
+  802beb:	c3                   	ret
+
+00802bec <devsock_read>:
+{
+  802bec:	55                   	push   %ebp
+  802bed:	89 e5                	mov    %esp,%ebp
+  802bef:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802bf2:	6a 00                	push   $0x0
+  802bf4:	ff 75 10             	push   0x10(%ebp)
+  802bf7:	ff 75 0c             	push   0xc(%ebp)
+  802bfa:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bfd:	ff 70 0c             	push   0xc(%eax)
+  802c00:	e8 ef 02 00 00       	call   802ef4 <nsipc_recv>
+}
+  802c05:	c9                   	leave
+  802c06:	c3                   	ret
+
+00802c07 <fd2sockid>:
+{
+  802c07:	55                   	push   %ebp
+  802c08:	89 e5                	mov    %esp,%ebp
+  802c0a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802c0d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802c10:	52                   	push   %edx
+  802c11:	50                   	push   %eax
+  802c12:	e8 54 e9 ff ff       	call   80156b <fd_lookup>
+  802c17:	83 c4 10             	add    $0x10,%esp
+  802c1a:	85 c0                	test   %eax,%eax
+  802c1c:	78 10                	js     802c2e <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802c1e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c21:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  802c27:	39 08                	cmp    %ecx,(%eax)
+  802c29:	75 05                	jne    802c30 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802c2b:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802c2e:	c9                   	leave
+  802c2f:	c3                   	ret
+		return -E_NOT_SUPP;
+  802c30:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802c35:	eb f7                	jmp    802c2e <fd2sockid+0x27>
+
+00802c37 <alloc_sockfd>:
+{
+  802c37:	55                   	push   %ebp
+  802c38:	89 e5                	mov    %esp,%ebp
+  802c3a:	56                   	push   %esi
+  802c3b:	53                   	push   %ebx
+  802c3c:	83 ec 1c             	sub    $0x1c,%esp
+  802c3f:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802c41:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c44:	50                   	push   %eax
+  802c45:	e8 cb e8 ff ff       	call   801515 <fd_alloc>
+  802c4a:	89 c3                	mov    %eax,%ebx
+  802c4c:	83 c4 10             	add    $0x10,%esp
+  802c4f:	85 c0                	test   %eax,%eax
+  802c51:	78 43                	js     802c96 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802c53:	83 ec 04             	sub    $0x4,%esp
+  802c56:	68 07 04 00 00       	push   $0x407
+  802c5b:	ff 75 f4             	push   -0xc(%ebp)
+  802c5e:	6a 00                	push   $0x0
+  802c60:	e8 90 df ff ff       	call   800bf5 <sys_page_alloc>
+  802c65:	89 c3                	mov    %eax,%ebx
+  802c67:	83 c4 10             	add    $0x10,%esp
+  802c6a:	85 c0                	test   %eax,%eax
+  802c6c:	78 28                	js     802c96 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802c6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c71:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802c77:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802c79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c7c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802c83:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802c86:	83 ec 0c             	sub    $0xc,%esp
+  802c89:	50                   	push   %eax
+  802c8a:	e8 5f e8 ff ff       	call   8014ee <fd2num>
+  802c8f:	89 c3                	mov    %eax,%ebx
+  802c91:	83 c4 10             	add    $0x10,%esp
+  802c94:	eb 0c                	jmp    802ca2 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802c96:	83 ec 0c             	sub    $0xc,%esp
+  802c99:	56                   	push   %esi
+  802c9a:	e8 e4 01 00 00       	call   802e83 <nsipc_close>
+		return r;
+  802c9f:	83 c4 10             	add    $0x10,%esp
+}
+  802ca2:	89 d8                	mov    %ebx,%eax
+  802ca4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ca7:	5b                   	pop    %ebx
+  802ca8:	5e                   	pop    %esi
+  802ca9:	5d                   	pop    %ebp
+  802caa:	c3                   	ret
+
+00802cab <accept>:
+{
+  802cab:	55                   	push   %ebp
+  802cac:	89 e5                	mov    %esp,%ebp
+  802cae:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802cb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb4:	e8 4e ff ff ff       	call   802c07 <fd2sockid>
+  802cb9:	85 c0                	test   %eax,%eax
+  802cbb:	78 1b                	js     802cd8 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802cbd:	83 ec 04             	sub    $0x4,%esp
+  802cc0:	ff 75 10             	push   0x10(%ebp)
+  802cc3:	ff 75 0c             	push   0xc(%ebp)
+  802cc6:	50                   	push   %eax
+  802cc7:	e8 0e 01 00 00       	call   802dda <nsipc_accept>
+  802ccc:	83 c4 10             	add    $0x10,%esp
+  802ccf:	85 c0                	test   %eax,%eax
+  802cd1:	78 05                	js     802cd8 <accept+0x2d>
+	return alloc_sockfd(r);
+  802cd3:	e8 5f ff ff ff       	call   802c37 <alloc_sockfd>
+}
+  802cd8:	c9                   	leave
+  802cd9:	c3                   	ret
+
+00802cda <bind>:
+{
+  802cda:	55                   	push   %ebp
+  802cdb:	89 e5                	mov    %esp,%ebp
+  802cdd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ce0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce3:	e8 1f ff ff ff       	call   802c07 <fd2sockid>
+  802ce8:	85 c0                	test   %eax,%eax
+  802cea:	78 12                	js     802cfe <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802cec:	83 ec 04             	sub    $0x4,%esp
+  802cef:	ff 75 10             	push   0x10(%ebp)
+  802cf2:	ff 75 0c             	push   0xc(%ebp)
+  802cf5:	50                   	push   %eax
+  802cf6:	e8 31 01 00 00       	call   802e2c <nsipc_bind>
+  802cfb:	83 c4 10             	add    $0x10,%esp
+}
+  802cfe:	c9                   	leave
+  802cff:	c3                   	ret
+
+00802d00 <shutdown>:
+{
+  802d00:	55                   	push   %ebp
+  802d01:	89 e5                	mov    %esp,%ebp
+  802d03:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d06:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d09:	e8 f9 fe ff ff       	call   802c07 <fd2sockid>
+  802d0e:	85 c0                	test   %eax,%eax
+  802d10:	78 0f                	js     802d21 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802d12:	83 ec 08             	sub    $0x8,%esp
+  802d15:	ff 75 0c             	push   0xc(%ebp)
+  802d18:	50                   	push   %eax
+  802d19:	e8 43 01 00 00       	call   802e61 <nsipc_shutdown>
+  802d1e:	83 c4 10             	add    $0x10,%esp
+}
+  802d21:	c9                   	leave
+  802d22:	c3                   	ret
+
+00802d23 <connect>:
+{
+  802d23:	55                   	push   %ebp
+  802d24:	89 e5                	mov    %esp,%ebp
+  802d26:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d2c:	e8 d6 fe ff ff       	call   802c07 <fd2sockid>
+  802d31:	85 c0                	test   %eax,%eax
+  802d33:	78 12                	js     802d47 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802d35:	83 ec 04             	sub    $0x4,%esp
+  802d38:	ff 75 10             	push   0x10(%ebp)
+  802d3b:	ff 75 0c             	push   0xc(%ebp)
+  802d3e:	50                   	push   %eax
+  802d3f:	e8 59 01 00 00       	call   802e9d <nsipc_connect>
+  802d44:	83 c4 10             	add    $0x10,%esp
+}
+  802d47:	c9                   	leave
+  802d48:	c3                   	ret
+
+00802d49 <listen>:
+{
+  802d49:	55                   	push   %ebp
+  802d4a:	89 e5                	mov    %esp,%ebp
+  802d4c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d52:	e8 b0 fe ff ff       	call   802c07 <fd2sockid>
+  802d57:	85 c0                	test   %eax,%eax
+  802d59:	78 0f                	js     802d6a <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802d5b:	83 ec 08             	sub    $0x8,%esp
+  802d5e:	ff 75 0c             	push   0xc(%ebp)
+  802d61:	50                   	push   %eax
+  802d62:	e8 6b 01 00 00       	call   802ed2 <nsipc_listen>
+  802d67:	83 c4 10             	add    $0x10,%esp
+}
+  802d6a:	c9                   	leave
+  802d6b:	c3                   	ret
+
+00802d6c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802d6c:	55                   	push   %ebp
+  802d6d:	89 e5                	mov    %esp,%ebp
+  802d6f:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802d72:	ff 75 10             	push   0x10(%ebp)
+  802d75:	ff 75 0c             	push   0xc(%ebp)
+  802d78:	ff 75 08             	push   0x8(%ebp)
+  802d7b:	e8 41 02 00 00       	call   802fc1 <nsipc_socket>
+  802d80:	83 c4 10             	add    $0x10,%esp
+  802d83:	85 c0                	test   %eax,%eax
+  802d85:	78 05                	js     802d8c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802d87:	e8 ab fe ff ff       	call   802c37 <alloc_sockfd>
+}
+  802d8c:	c9                   	leave
+  802d8d:	c3                   	ret
+
+00802d8e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802d8e:	55                   	push   %ebp
+  802d8f:	89 e5                	mov    %esp,%ebp
+  802d91:	53                   	push   %ebx
+  802d92:	83 ec 04             	sub    $0x4,%esp
+  802d95:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802d97:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802d9e:	74 26                	je     802dc6 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802da0:	6a 07                	push   $0x7
+  802da2:	68 00 80 80 00       	push   $0x808000
+  802da7:	53                   	push   %ebx
+  802da8:	ff 35 00 90 80 00    	push   0x809000
+  802dae:	e8 c3 e5 ff ff       	call   801376 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802db3:	83 c4 0c             	add    $0xc,%esp
+  802db6:	6a 00                	push   $0x0
+  802db8:	6a 00                	push   $0x0
+  802dba:	6a 00                	push   $0x0
+  802dbc:	e8 4a e5 ff ff       	call   80130b <ipc_recv>
+}
+  802dc1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dc4:	c9                   	leave
+  802dc5:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802dc6:	83 ec 0c             	sub    $0xc,%esp
+  802dc9:	6a 02                	push   $0x2
+  802dcb:	e8 df e6 ff ff       	call   8014af <ipc_find_env>
+  802dd0:	a3 00 90 80 00       	mov    %eax,0x809000
+  802dd5:	83 c4 10             	add    $0x10,%esp
+  802dd8:	eb c6                	jmp    802da0 <nsipc+0x12>
+
+00802dda <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802dda:	55                   	push   %ebp
+  802ddb:	89 e5                	mov    %esp,%ebp
+  802ddd:	56                   	push   %esi
+  802dde:	53                   	push   %ebx
+  802ddf:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802de2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802de5:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802dea:	8b 06                	mov    (%esi),%eax
+  802dec:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802df1:	b8 01 00 00 00       	mov    $0x1,%eax
+  802df6:	e8 93 ff ff ff       	call   802d8e <nsipc>
+  802dfb:	89 c3                	mov    %eax,%ebx
+  802dfd:	85 c0                	test   %eax,%eax
+  802dff:	79 09                	jns    802e0a <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802e01:	89 d8                	mov    %ebx,%eax
+  802e03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e06:	5b                   	pop    %ebx
+  802e07:	5e                   	pop    %esi
+  802e08:	5d                   	pop    %ebp
+  802e09:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802e0a:	83 ec 04             	sub    $0x4,%esp
+  802e0d:	ff 35 10 80 80 00    	push   0x808010
+  802e13:	68 00 80 80 00       	push   $0x808000
+  802e18:	ff 75 0c             	push   0xc(%ebp)
+  802e1b:	e8 4f db ff ff       	call   80096f <memmove>
+		*addrlen = ret->ret_addrlen;
+  802e20:	a1 10 80 80 00       	mov    0x808010,%eax
+  802e25:	89 06                	mov    %eax,(%esi)
+  802e27:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802e2a:	eb d5                	jmp    802e01 <nsipc_accept+0x27>
+
+00802e2c <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802e2c:	55                   	push   %ebp
+  802e2d:	89 e5                	mov    %esp,%ebp
+  802e2f:	53                   	push   %ebx
+  802e30:	83 ec 08             	sub    $0x8,%esp
+  802e33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802e36:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e39:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802e3e:	53                   	push   %ebx
+  802e3f:	ff 75 0c             	push   0xc(%ebp)
+  802e42:	68 04 80 80 00       	push   $0x808004
+  802e47:	e8 23 db ff ff       	call   80096f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802e4c:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802e52:	b8 02 00 00 00       	mov    $0x2,%eax
+  802e57:	e8 32 ff ff ff       	call   802d8e <nsipc>
+}
+  802e5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e5f:	c9                   	leave
+  802e60:	c3                   	ret
+
+00802e61 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802e61:	55                   	push   %ebp
+  802e62:	89 e5                	mov    %esp,%ebp
+  802e64:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802e67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e6a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802e6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e72:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802e77:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e7c:	e8 0d ff ff ff       	call   802d8e <nsipc>
+}
+  802e81:	c9                   	leave
+  802e82:	c3                   	ret
+
+00802e83 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802e83:	55                   	push   %ebp
+  802e84:	89 e5                	mov    %esp,%ebp
+  802e86:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802e89:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e8c:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802e91:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e96:	e8 f3 fe ff ff       	call   802d8e <nsipc>
+}
+  802e9b:	c9                   	leave
+  802e9c:	c3                   	ret
+
+00802e9d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802e9d:	55                   	push   %ebp
+  802e9e:	89 e5                	mov    %esp,%ebp
+  802ea0:	53                   	push   %ebx
+  802ea1:	83 ec 08             	sub    $0x8,%esp
+  802ea4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802ea7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eaa:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802eaf:	53                   	push   %ebx
+  802eb0:	ff 75 0c             	push   0xc(%ebp)
+  802eb3:	68 04 80 80 00       	push   $0x808004
+  802eb8:	e8 b2 da ff ff       	call   80096f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802ebd:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802ec3:	b8 05 00 00 00       	mov    $0x5,%eax
+  802ec8:	e8 c1 fe ff ff       	call   802d8e <nsipc>
+}
+  802ecd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ed0:	c9                   	leave
+  802ed1:	c3                   	ret
+
+00802ed2 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802ed2:	55                   	push   %ebp
+  802ed3:	89 e5                	mov    %esp,%ebp
+  802ed5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802ed8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802edb:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802ee0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ee3:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802ee8:	b8 06 00 00 00       	mov    $0x6,%eax
+  802eed:	e8 9c fe ff ff       	call   802d8e <nsipc>
+}
+  802ef2:	c9                   	leave
+  802ef3:	c3                   	ret
+
+00802ef4 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802ef4:	55                   	push   %ebp
+  802ef5:	89 e5                	mov    %esp,%ebp
+  802ef7:	56                   	push   %esi
+  802ef8:	53                   	push   %ebx
+  802ef9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802efc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eff:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802f04:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802f0a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f0d:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802f12:	b8 07 00 00 00       	mov    $0x7,%eax
+  802f17:	e8 72 fe ff ff       	call   802d8e <nsipc>
+  802f1c:	89 c3                	mov    %eax,%ebx
+  802f1e:	85 c0                	test   %eax,%eax
+  802f20:	78 22                	js     802f44 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802f22:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802f27:	39 c6                	cmp    %eax,%esi
+  802f29:	0f 4e c6             	cmovle %esi,%eax
+  802f2c:	39 c3                	cmp    %eax,%ebx
+  802f2e:	7f 1d                	jg     802f4d <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802f30:	83 ec 04             	sub    $0x4,%esp
+  802f33:	53                   	push   %ebx
+  802f34:	68 00 80 80 00       	push   $0x808000
+  802f39:	ff 75 0c             	push   0xc(%ebp)
+  802f3c:	e8 2e da ff ff       	call   80096f <memmove>
+  802f41:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802f44:	89 d8                	mov    %ebx,%eax
+  802f46:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f49:	5b                   	pop    %ebx
+  802f4a:	5e                   	pop    %esi
+  802f4b:	5d                   	pop    %ebp
+  802f4c:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802f4d:	68 9d 3d 80 00       	push   $0x803d9d
+  802f52:	68 4c 3c 80 00       	push   $0x803c4c
+  802f57:	6a 62                	push   $0x62
+  802f59:	68 b2 3d 80 00       	push   $0x803db2
+  802f5e:	e8 46 05 00 00       	call   8034a9 <_panic>
+
+00802f63 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802f63:	55                   	push   %ebp
+  802f64:	89 e5                	mov    %esp,%ebp
+  802f66:	53                   	push   %ebx
+  802f67:	83 ec 04             	sub    $0x4,%esp
+  802f6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802f6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f70:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802f75:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f7b:	7f 2e                	jg     802fab <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802f7d:	83 ec 04             	sub    $0x4,%esp
+  802f80:	53                   	push   %ebx
+  802f81:	ff 75 0c             	push   0xc(%ebp)
+  802f84:	68 0c 80 80 00       	push   $0x80800c
+  802f89:	e8 e1 d9 ff ff       	call   80096f <memmove>
+	nsipcbuf.send.req_size = size;
+  802f8e:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802f94:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f97:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802f9c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802fa1:	e8 e8 fd ff ff       	call   802d8e <nsipc>
+}
+  802fa6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fa9:	c9                   	leave
+  802faa:	c3                   	ret
+	assert(size < 1600);
+  802fab:	68 be 3d 80 00       	push   $0x803dbe
+  802fb0:	68 4c 3c 80 00       	push   $0x803c4c
+  802fb5:	6a 6d                	push   $0x6d
+  802fb7:	68 b2 3d 80 00       	push   $0x803db2
+  802fbc:	e8 e8 04 00 00       	call   8034a9 <_panic>
+
+00802fc1 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802fc1:	55                   	push   %ebp
+  802fc2:	89 e5                	mov    %esp,%ebp
+  802fc4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802fc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fca:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802fcf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fd2:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802fd7:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fda:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802fdf:	b8 09 00 00 00       	mov    $0x9,%eax
+  802fe4:	e8 a5 fd ff ff       	call   802d8e <nsipc>
+}
+  802fe9:	c9                   	leave
+  802fea:	c3                   	ret
+
+00802feb <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802feb:	55                   	push   %ebp
+  802fec:	89 e5                	mov    %esp,%ebp
+  802fee:	56                   	push   %esi
+  802fef:	53                   	push   %ebx
+  802ff0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802ff3:	83 ec 0c             	sub    $0xc,%esp
+  802ff6:	ff 75 08             	push   0x8(%ebp)
+  802ff9:	e8 00 e5 ff ff       	call   8014fe <fd2data>
+  802ffe:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803000:	83 c4 08             	add    $0x8,%esp
+  803003:	68 ca 3d 80 00       	push   $0x803dca
+  803008:	53                   	push   %ebx
+  803009:	e8 db d7 ff ff       	call   8007e9 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80300e:	8b 46 04             	mov    0x4(%esi),%eax
+  803011:	2b 06                	sub    (%esi),%eax
+  803013:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803019:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803020:	00 00 00 
+	stat->st_dev = &devpipe;
+  803023:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  80302a:	40 80 00 
+	return 0;
+}
+  80302d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803032:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803035:	5b                   	pop    %ebx
+  803036:	5e                   	pop    %esi
+  803037:	5d                   	pop    %ebp
+  803038:	c3                   	ret
+
+00803039 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803039:	55                   	push   %ebp
+  80303a:	89 e5                	mov    %esp,%ebp
+  80303c:	53                   	push   %ebx
+  80303d:	83 ec 0c             	sub    $0xc,%esp
+  803040:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803043:	53                   	push   %ebx
+  803044:	6a 00                	push   $0x0
+  803046:	e8 37 dc ff ff       	call   800c82 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80304b:	89 1c 24             	mov    %ebx,(%esp)
+  80304e:	e8 ab e4 ff ff       	call   8014fe <fd2data>
+  803053:	83 c4 08             	add    $0x8,%esp
+  803056:	50                   	push   %eax
+  803057:	6a 00                	push   $0x0
+  803059:	e8 24 dc ff ff       	call   800c82 <sys_page_unmap>
+}
+  80305e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803061:	c9                   	leave
+  803062:	c3                   	ret
+
+00803063 <_pipeisclosed>:
+{
+  803063:	55                   	push   %ebp
+  803064:	89 e5                	mov    %esp,%ebp
+  803066:	57                   	push   %edi
+  803067:	56                   	push   %esi
+  803068:	53                   	push   %ebx
+  803069:	83 ec 1c             	sub    $0x1c,%esp
+  80306c:	89 c7                	mov    %eax,%edi
+  80306e:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  803070:	a1 04 50 80 00       	mov    0x805004,%eax
+  803075:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803078:	83 ec 0c             	sub    $0xc,%esp
+  80307b:	57                   	push   %edi
+  80307c:	e8 07 05 00 00       	call   803588 <pageref>
+  803081:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803084:	89 34 24             	mov    %esi,(%esp)
+  803087:	e8 fc 04 00 00       	call   803588 <pageref>
+		nn = thisenv->env_runs;
+  80308c:	8b 15 04 50 80 00    	mov    0x805004,%edx
+  803092:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  803095:	83 c4 10             	add    $0x10,%esp
+  803098:	39 cb                	cmp    %ecx,%ebx
+  80309a:	74 1b                	je     8030b7 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80309c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80309f:	75 cf                	jne    803070 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8030a1:	8b 42 58             	mov    0x58(%edx),%eax
+  8030a4:	6a 01                	push   $0x1
+  8030a6:	50                   	push   %eax
+  8030a7:	53                   	push   %ebx
+  8030a8:	68 d1 3d 80 00       	push   $0x803dd1
+  8030ad:	e8 49 d1 ff ff       	call   8001fb <cprintf>
+  8030b2:	83 c4 10             	add    $0x10,%esp
+  8030b5:	eb b9                	jmp    803070 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8030b7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8030ba:	0f 94 c0             	sete   %al
+  8030bd:	0f b6 c0             	movzbl %al,%eax
+}
+  8030c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030c3:	5b                   	pop    %ebx
+  8030c4:	5e                   	pop    %esi
+  8030c5:	5f                   	pop    %edi
+  8030c6:	5d                   	pop    %ebp
+  8030c7:	c3                   	ret
+
+008030c8 <devpipe_write>:
+{
+  8030c8:	55                   	push   %ebp
+  8030c9:	89 e5                	mov    %esp,%ebp
+  8030cb:	57                   	push   %edi
+  8030cc:	56                   	push   %esi
+  8030cd:	53                   	push   %ebx
+  8030ce:	83 ec 28             	sub    $0x28,%esp
+  8030d1:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8030d4:	56                   	push   %esi
+  8030d5:	e8 24 e4 ff ff       	call   8014fe <fd2data>
+  8030da:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8030dc:	83 c4 10             	add    $0x10,%esp
+  8030df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030e4:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8030e7:	75 09                	jne    8030f2 <devpipe_write+0x2a>
+	return i;
+  8030e9:	89 f8                	mov    %edi,%eax
+  8030eb:	eb 23                	jmp    803110 <devpipe_write+0x48>
+			sys_yield();
+  8030ed:	e8 e4 da ff ff       	call   800bd6 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8030f2:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030f5:	8b 0b                	mov    (%ebx),%ecx
+  8030f7:	8d 51 20             	lea    0x20(%ecx),%edx
+  8030fa:	39 d0                	cmp    %edx,%eax
+  8030fc:	72 1a                	jb     803118 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8030fe:	89 da                	mov    %ebx,%edx
+  803100:	89 f0                	mov    %esi,%eax
+  803102:	e8 5c ff ff ff       	call   803063 <_pipeisclosed>
+  803107:	85 c0                	test   %eax,%eax
+  803109:	74 e2                	je     8030ed <devpipe_write+0x25>
+				return 0;
+  80310b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803110:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803113:	5b                   	pop    %ebx
+  803114:	5e                   	pop    %esi
+  803115:	5f                   	pop    %edi
+  803116:	5d                   	pop    %ebp
+  803117:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803118:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80311b:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80311f:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803122:	89 c2                	mov    %eax,%edx
+  803124:	c1 fa 1f             	sar    $0x1f,%edx
+  803127:	89 d1                	mov    %edx,%ecx
+  803129:	c1 e9 1b             	shr    $0x1b,%ecx
+  80312c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80312f:	83 e2 1f             	and    $0x1f,%edx
+  803132:	29 ca                	sub    %ecx,%edx
+  803134:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803138:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80313c:	83 c0 01             	add    $0x1,%eax
+  80313f:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803142:	83 c7 01             	add    $0x1,%edi
+  803145:	eb 9d                	jmp    8030e4 <devpipe_write+0x1c>
+
+00803147 <devpipe_read>:
+{
+  803147:	55                   	push   %ebp
+  803148:	89 e5                	mov    %esp,%ebp
+  80314a:	57                   	push   %edi
+  80314b:	56                   	push   %esi
+  80314c:	53                   	push   %ebx
+  80314d:	83 ec 18             	sub    $0x18,%esp
+  803150:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803153:	57                   	push   %edi
+  803154:	e8 a5 e3 ff ff       	call   8014fe <fd2data>
+  803159:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80315b:	83 c4 10             	add    $0x10,%esp
+  80315e:	be 00 00 00 00       	mov    $0x0,%esi
+  803163:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803166:	75 13                	jne    80317b <devpipe_read+0x34>
+	return i;
+  803168:	89 f0                	mov    %esi,%eax
+  80316a:	eb 02                	jmp    80316e <devpipe_read+0x27>
+				return i;
+  80316c:	89 f0                	mov    %esi,%eax
+}
+  80316e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803171:	5b                   	pop    %ebx
+  803172:	5e                   	pop    %esi
+  803173:	5f                   	pop    %edi
+  803174:	5d                   	pop    %ebp
+  803175:	c3                   	ret
+			sys_yield();
+  803176:	e8 5b da ff ff       	call   800bd6 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80317b:	8b 03                	mov    (%ebx),%eax
+  80317d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803180:	75 18                	jne    80319a <devpipe_read+0x53>
+			if (i > 0)
+  803182:	85 f6                	test   %esi,%esi
+  803184:	75 e6                	jne    80316c <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803186:	89 da                	mov    %ebx,%edx
+  803188:	89 f8                	mov    %edi,%eax
+  80318a:	e8 d4 fe ff ff       	call   803063 <_pipeisclosed>
+  80318f:	85 c0                	test   %eax,%eax
+  803191:	74 e3                	je     803176 <devpipe_read+0x2f>
+				return 0;
+  803193:	b8 00 00 00 00       	mov    $0x0,%eax
+  803198:	eb d4                	jmp    80316e <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80319a:	99                   	cltd
+  80319b:	c1 ea 1b             	shr    $0x1b,%edx
+  80319e:	01 d0                	add    %edx,%eax
+  8031a0:	83 e0 1f             	and    $0x1f,%eax
+  8031a3:	29 d0                	sub    %edx,%eax
+  8031a5:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8031aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031ad:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8031b0:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8031b3:	83 c6 01             	add    $0x1,%esi
+  8031b6:	eb ab                	jmp    803163 <devpipe_read+0x1c>
+
+008031b8 <pipe>:
+{
+  8031b8:	55                   	push   %ebp
+  8031b9:	89 e5                	mov    %esp,%ebp
+  8031bb:	56                   	push   %esi
+  8031bc:	53                   	push   %ebx
+  8031bd:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8031c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031c3:	50                   	push   %eax
+  8031c4:	e8 4c e3 ff ff       	call   801515 <fd_alloc>
+  8031c9:	89 c3                	mov    %eax,%ebx
+  8031cb:	83 c4 10             	add    $0x10,%esp
+  8031ce:	85 c0                	test   %eax,%eax
+  8031d0:	0f 88 23 01 00 00    	js     8032f9 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031d6:	83 ec 04             	sub    $0x4,%esp
+  8031d9:	68 07 04 00 00       	push   $0x407
+  8031de:	ff 75 f4             	push   -0xc(%ebp)
+  8031e1:	6a 00                	push   $0x0
+  8031e3:	e8 0d da ff ff       	call   800bf5 <sys_page_alloc>
+  8031e8:	89 c3                	mov    %eax,%ebx
+  8031ea:	83 c4 10             	add    $0x10,%esp
+  8031ed:	85 c0                	test   %eax,%eax
+  8031ef:	0f 88 04 01 00 00    	js     8032f9 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8031f5:	83 ec 0c             	sub    $0xc,%esp
+  8031f8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031fb:	50                   	push   %eax
+  8031fc:	e8 14 e3 ff ff       	call   801515 <fd_alloc>
+  803201:	89 c3                	mov    %eax,%ebx
+  803203:	83 c4 10             	add    $0x10,%esp
+  803206:	85 c0                	test   %eax,%eax
+  803208:	0f 88 db 00 00 00    	js     8032e9 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80320e:	83 ec 04             	sub    $0x4,%esp
+  803211:	68 07 04 00 00       	push   $0x407
+  803216:	ff 75 f0             	push   -0x10(%ebp)
+  803219:	6a 00                	push   $0x0
+  80321b:	e8 d5 d9 ff ff       	call   800bf5 <sys_page_alloc>
+  803220:	89 c3                	mov    %eax,%ebx
+  803222:	83 c4 10             	add    $0x10,%esp
+  803225:	85 c0                	test   %eax,%eax
+  803227:	0f 88 bc 00 00 00    	js     8032e9 <pipe+0x131>
+	va = fd2data(fd0);
+  80322d:	83 ec 0c             	sub    $0xc,%esp
+  803230:	ff 75 f4             	push   -0xc(%ebp)
+  803233:	e8 c6 e2 ff ff       	call   8014fe <fd2data>
+  803238:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80323a:	83 c4 0c             	add    $0xc,%esp
+  80323d:	68 07 04 00 00       	push   $0x407
+  803242:	50                   	push   %eax
+  803243:	6a 00                	push   $0x0
+  803245:	e8 ab d9 ff ff       	call   800bf5 <sys_page_alloc>
+  80324a:	89 c3                	mov    %eax,%ebx
+  80324c:	83 c4 10             	add    $0x10,%esp
+  80324f:	85 c0                	test   %eax,%eax
+  803251:	0f 88 82 00 00 00    	js     8032d9 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803257:	83 ec 0c             	sub    $0xc,%esp
+  80325a:	ff 75 f0             	push   -0x10(%ebp)
+  80325d:	e8 9c e2 ff ff       	call   8014fe <fd2data>
+  803262:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803269:	50                   	push   %eax
+  80326a:	6a 00                	push   $0x0
+  80326c:	56                   	push   %esi
+  80326d:	6a 00                	push   $0x0
+  80326f:	e8 cc d9 ff ff       	call   800c40 <sys_page_map>
+  803274:	89 c3                	mov    %eax,%ebx
+  803276:	83 c4 20             	add    $0x20,%esp
+  803279:	85 c0                	test   %eax,%eax
+  80327b:	78 4e                	js     8032cb <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80327d:	a1 60 40 80 00       	mov    0x804060,%eax
+  803282:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803285:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803287:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80328a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803291:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803294:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803296:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803299:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8032a0:	83 ec 0c             	sub    $0xc,%esp
+  8032a3:	ff 75 f4             	push   -0xc(%ebp)
+  8032a6:	e8 43 e2 ff ff       	call   8014ee <fd2num>
+  8032ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032ae:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8032b0:	83 c4 04             	add    $0x4,%esp
+  8032b3:	ff 75 f0             	push   -0x10(%ebp)
+  8032b6:	e8 33 e2 ff ff       	call   8014ee <fd2num>
+  8032bb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032be:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8032c1:	83 c4 10             	add    $0x10,%esp
+  8032c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032c9:	eb 2e                	jmp    8032f9 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8032cb:	83 ec 08             	sub    $0x8,%esp
+  8032ce:	56                   	push   %esi
+  8032cf:	6a 00                	push   $0x0
+  8032d1:	e8 ac d9 ff ff       	call   800c82 <sys_page_unmap>
+  8032d6:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8032d9:	83 ec 08             	sub    $0x8,%esp
+  8032dc:	ff 75 f0             	push   -0x10(%ebp)
+  8032df:	6a 00                	push   $0x0
+  8032e1:	e8 9c d9 ff ff       	call   800c82 <sys_page_unmap>
+  8032e6:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8032e9:	83 ec 08             	sub    $0x8,%esp
+  8032ec:	ff 75 f4             	push   -0xc(%ebp)
+  8032ef:	6a 00                	push   $0x0
+  8032f1:	e8 8c d9 ff ff       	call   800c82 <sys_page_unmap>
+  8032f6:	83 c4 10             	add    $0x10,%esp
+}
+  8032f9:	89 d8                	mov    %ebx,%eax
+  8032fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032fe:	5b                   	pop    %ebx
+  8032ff:	5e                   	pop    %esi
+  803300:	5d                   	pop    %ebp
+  803301:	c3                   	ret
+
+00803302 <pipeisclosed>:
+{
+  803302:	55                   	push   %ebp
+  803303:	89 e5                	mov    %esp,%ebp
+  803305:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803308:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80330b:	50                   	push   %eax
+  80330c:	ff 75 08             	push   0x8(%ebp)
+  80330f:	e8 57 e2 ff ff       	call   80156b <fd_lookup>
+  803314:	83 c4 10             	add    $0x10,%esp
+  803317:	85 c0                	test   %eax,%eax
+  803319:	78 18                	js     803333 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80331b:	83 ec 0c             	sub    $0xc,%esp
+  80331e:	ff 75 f4             	push   -0xc(%ebp)
+  803321:	e8 d8 e1 ff ff       	call   8014fe <fd2data>
+  803326:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803328:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80332b:	e8 33 fd ff ff       	call   803063 <_pipeisclosed>
+  803330:	83 c4 10             	add    $0x10,%esp
+}
+  803333:	c9                   	leave
+  803334:	c3                   	ret
+
+00803335 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80333a:	c3                   	ret
+
+0080333b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80333b:	55                   	push   %ebp
+  80333c:	89 e5                	mov    %esp,%ebp
+  80333e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803341:	68 e9 3d 80 00       	push   $0x803de9
+  803346:	ff 75 0c             	push   0xc(%ebp)
+  803349:	e8 9b d4 ff ff       	call   8007e9 <strcpy>
+	return 0;
+}
+  80334e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803353:	c9                   	leave
+  803354:	c3                   	ret
+
+00803355 <devcons_write>:
+{
+  803355:	55                   	push   %ebp
+  803356:	89 e5                	mov    %esp,%ebp
+  803358:	57                   	push   %edi
+  803359:	56                   	push   %esi
+  80335a:	53                   	push   %ebx
+  80335b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803361:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803366:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80336c:	eb 2e                	jmp    80339c <devcons_write+0x47>
+		m = n - tot;
+  80336e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803371:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803373:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803378:	39 c3                	cmp    %eax,%ebx
+  80337a:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80337d:	83 ec 04             	sub    $0x4,%esp
+  803380:	53                   	push   %ebx
+  803381:	89 f0                	mov    %esi,%eax
+  803383:	03 45 0c             	add    0xc(%ebp),%eax
+  803386:	50                   	push   %eax
+  803387:	57                   	push   %edi
+  803388:	e8 e2 d5 ff ff       	call   80096f <memmove>
+		sys_cputs(buf, m);
+  80338d:	83 c4 08             	add    $0x8,%esp
+  803390:	53                   	push   %ebx
+  803391:	57                   	push   %edi
+  803392:	e8 82 d7 ff ff       	call   800b19 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803397:	01 de                	add    %ebx,%esi
+  803399:	83 c4 10             	add    $0x10,%esp
+  80339c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80339f:	72 cd                	jb     80336e <devcons_write+0x19>
+}
+  8033a1:	89 f0                	mov    %esi,%eax
+  8033a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033a6:	5b                   	pop    %ebx
+  8033a7:	5e                   	pop    %esi
+  8033a8:	5f                   	pop    %edi
+  8033a9:	5d                   	pop    %ebp
+  8033aa:	c3                   	ret
+
+008033ab <devcons_read>:
+{
+  8033ab:	55                   	push   %ebp
+  8033ac:	89 e5                	mov    %esp,%ebp
+  8033ae:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8033b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033ba:	75 07                	jne    8033c3 <devcons_read+0x18>
+  8033bc:	eb 1f                	jmp    8033dd <devcons_read+0x32>
+		sys_yield();
+  8033be:	e8 13 d8 ff ff       	call   800bd6 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8033c3:	e8 77 d7 ff ff       	call   800b3f <sys_cgetc>
+  8033c8:	85 c0                	test   %eax,%eax
+  8033ca:	74 f2                	je     8033be <devcons_read+0x13>
+	if (c < 0)
+  8033cc:	78 0f                	js     8033dd <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8033ce:	83 f8 04             	cmp    $0x4,%eax
+  8033d1:	74 0c                	je     8033df <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8033d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033d6:	88 02                	mov    %al,(%edx)
+	return 1;
+  8033d8:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8033dd:	c9                   	leave
+  8033de:	c3                   	ret
+		return 0;
+  8033df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e4:	eb f7                	jmp    8033dd <devcons_read+0x32>
+
+008033e6 <cputchar>:
+{
+  8033e6:	55                   	push   %ebp
+  8033e7:	89 e5                	mov    %esp,%ebp
+  8033e9:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8033ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033ef:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8033f2:	6a 01                	push   $0x1
+  8033f4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033f7:	50                   	push   %eax
+  8033f8:	e8 1c d7 ff ff       	call   800b19 <sys_cputs>
+}
+  8033fd:	83 c4 10             	add    $0x10,%esp
+  803400:	c9                   	leave
+  803401:	c3                   	ret
+
+00803402 <getchar>:
+{
+  803402:	55                   	push   %ebp
+  803403:	89 e5                	mov    %esp,%ebp
+  803405:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803408:	6a 01                	push   $0x1
+  80340a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80340d:	50                   	push   %eax
+  80340e:	6a 00                	push   $0x0
+  803410:	e8 bc e3 ff ff       	call   8017d1 <read>
+	if (r < 0)
+  803415:	83 c4 10             	add    $0x10,%esp
+  803418:	85 c0                	test   %eax,%eax
+  80341a:	78 06                	js     803422 <getchar+0x20>
+	if (r < 1)
+  80341c:	74 06                	je     803424 <getchar+0x22>
+	return c;
+  80341e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803422:	c9                   	leave
+  803423:	c3                   	ret
+		return -E_EOF;
+  803424:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803429:	eb f7                	jmp    803422 <getchar+0x20>
+
+0080342b <iscons>:
+{
+  80342b:	55                   	push   %ebp
+  80342c:	89 e5                	mov    %esp,%ebp
+  80342e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803431:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803434:	50                   	push   %eax
+  803435:	ff 75 08             	push   0x8(%ebp)
+  803438:	e8 2e e1 ff ff       	call   80156b <fd_lookup>
+  80343d:	83 c4 10             	add    $0x10,%esp
+  803440:	85 c0                	test   %eax,%eax
+  803442:	78 11                	js     803455 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803444:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803447:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80344d:	39 10                	cmp    %edx,(%eax)
+  80344f:	0f 94 c0             	sete   %al
+  803452:	0f b6 c0             	movzbl %al,%eax
+}
+  803455:	c9                   	leave
+  803456:	c3                   	ret
+
+00803457 <opencons>:
+{
+  803457:	55                   	push   %ebp
+  803458:	89 e5                	mov    %esp,%ebp
+  80345a:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80345d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803460:	50                   	push   %eax
+  803461:	e8 af e0 ff ff       	call   801515 <fd_alloc>
+  803466:	83 c4 10             	add    $0x10,%esp
+  803469:	85 c0                	test   %eax,%eax
+  80346b:	78 3a                	js     8034a7 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80346d:	83 ec 04             	sub    $0x4,%esp
+  803470:	68 07 04 00 00       	push   $0x407
+  803475:	ff 75 f4             	push   -0xc(%ebp)
+  803478:	6a 00                	push   $0x0
+  80347a:	e8 76 d7 ff ff       	call   800bf5 <sys_page_alloc>
+  80347f:	83 c4 10             	add    $0x10,%esp
+  803482:	85 c0                	test   %eax,%eax
+  803484:	78 21                	js     8034a7 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803486:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803489:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80348f:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803491:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803494:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80349b:	83 ec 0c             	sub    $0xc,%esp
+  80349e:	50                   	push   %eax
+  80349f:	e8 4a e0 ff ff       	call   8014ee <fd2num>
+  8034a4:	83 c4 10             	add    $0x10,%esp
+}
+  8034a7:	c9                   	leave
+  8034a8:	c3                   	ret
+
+008034a9 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8034a9:	55                   	push   %ebp
+  8034aa:	89 e5                	mov    %esp,%ebp
+  8034ac:	56                   	push   %esi
+  8034ad:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8034ae:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8034b1:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8034b7:	e8 f3 d6 ff ff       	call   800baf <sys_getenvid>
+  8034bc:	83 ec 0c             	sub    $0xc,%esp
+  8034bf:	ff 75 0c             	push   0xc(%ebp)
+  8034c2:	ff 75 08             	push   0x8(%ebp)
+  8034c5:	56                   	push   %esi
+  8034c6:	50                   	push   %eax
+  8034c7:	68 f8 3d 80 00       	push   $0x803df8
+  8034cc:	e8 2a cd ff ff       	call   8001fb <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8034d1:	83 c4 18             	add    $0x18,%esp
+  8034d4:	53                   	push   %ebx
+  8034d5:	ff 75 10             	push   0x10(%ebp)
+  8034d8:	e8 cd cc ff ff       	call   8001aa <vcprintf>
+	cprintf("\n");
+  8034dd:	c7 04 24 e2 3d 80 00 	movl   $0x803de2,(%esp)
+  8034e4:	e8 12 cd ff ff       	call   8001fb <cprintf>
+  8034e9:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8034ec:	cc                   	int3
+	while (1)
+  8034ed:	eb fd                	jmp    8034ec <_panic+0x43>
+
+008034ef <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8034ef:	55                   	push   %ebp
+  8034f0:	89 e5                	mov    %esp,%ebp
+  8034f2:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8034f5:	83 3d 04 90 80 00 00 	cmpl   $0x0,0x809004
+  8034fc:	74 0a                	je     803508 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8034fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  803501:	a3 04 90 80 00       	mov    %eax,0x809004
+}
+  803506:	c9                   	leave
+  803507:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803508:	83 ec 04             	sub    $0x4,%esp
+  80350b:	6a 07                	push   $0x7
+  80350d:	68 00 f0 bf ee       	push   $0xeebff000
+  803512:	6a 00                	push   $0x0
+  803514:	e8 dc d6 ff ff       	call   800bf5 <sys_page_alloc>
+  803519:	83 c4 10             	add    $0x10,%esp
+  80351c:	85 c0                	test   %eax,%eax
+  80351e:	75 2c                	jne    80354c <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803520:	83 ec 08             	sub    $0x8,%esp
+  803523:	68 62 35 80 00       	push   $0x803562
+  803528:	6a 00                	push   $0x0
+  80352a:	e8 31 d8 ff ff       	call   800d60 <sys_env_set_pgfault_upcall>
+  80352f:	83 c4 10             	add    $0x10,%esp
+  803532:	85 c0                	test   %eax,%eax
+  803534:	74 c8                	je     8034fe <set_pgfault_handler+0xf>
+  803536:	68 64 3e 80 00       	push   $0x803e64
+  80353b:	68 4c 3c 80 00       	push   $0x803c4c
+  803540:	6a 20                	push   $0x20
+  803542:	68 94 3e 80 00       	push   $0x803e94
+  803547:	e8 5d ff ff ff       	call   8034a9 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80354c:	68 1c 3e 80 00       	push   $0x803e1c
+  803551:	68 4c 3c 80 00       	push   $0x803c4c
+  803556:	6a 1e                	push   $0x1e
+  803558:	68 94 3e 80 00       	push   $0x803e94
+  80355d:	e8 47 ff ff ff       	call   8034a9 <_panic>
+
+00803562 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803562:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803563:	a1 04 90 80 00       	mov    0x809004,%eax
+	call *%eax
+  803568:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80356a:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80356d:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803572:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803577:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  80357b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80357e:	83 c4 08             	add    $0x8,%esp
+	popal
+  803581:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803582:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803585:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803586:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803587:	c3                   	ret
+
+00803588 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803588:	55                   	push   %ebp
+  803589:	89 e5                	mov    %esp,%ebp
+  80358b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80358e:	89 c2                	mov    %eax,%edx
+  803590:	c1 ea 16             	shr    $0x16,%edx
+  803593:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80359a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80359f:	f6 c1 01             	test   $0x1,%cl
+  8035a2:	74 22                	je     8035c6 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8035a4:	c1 e8 0c             	shr    $0xc,%eax
+  8035a7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8035ae:	a8 01                	test   $0x1,%al
+  8035b0:	74 14                	je     8035c6 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8035b2:	c1 e8 0c             	shr    $0xc,%eax
+  8035b5:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8035b8:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8035bf:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8035c3:	0f b7 d2             	movzwl %dx,%edx
+}
+  8035c6:	89 d0                	mov    %edx,%eax
+  8035c8:	5d                   	pop    %ebp
+  8035c9:	c3                   	ret
+
+008035ca <dm>:
+  8035ca:	55                   	push   %ebp
+  8035cb:	57                   	push   %edi
+  8035cc:	56                   	push   %esi
+  8035cd:	53                   	push   %ebx
+  8035ce:	83 ec 24             	sub    $0x24,%esp
+  8035d1:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8035d5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035d9:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035dd:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035e1:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035e5:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035e9:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8035ed:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035fc:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803603:	00 
+  803604:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80360b:	00 
+  80360c:	89 fb                	mov    %edi,%ebx
+  80360e:	eb 08                	jmp    803618 <dm+0x4e>
+  803610:	83 e9 01             	sub    $0x1,%ecx
+  803613:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803616:	74 68                	je     803680 <dm+0xb6>
+  803618:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80361c:	01 c0                	add    %eax,%eax
+  80361e:	89 c6                	mov    %eax,%esi
+  803620:	89 d7                	mov    %edx,%edi
+  803622:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803626:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80362a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80362d:	d3 ea                	shr    %cl,%edx
+  80362f:	f6 c1 20             	test   $0x20,%cl
+  803632:	74 04                	je     803638 <dm+0x6e>
+  803634:	89 d0                	mov    %edx,%eax
+  803636:	31 d2                	xor    %edx,%edx
+  803638:	83 e0 01             	and    $0x1,%eax
+  80363b:	89 04 24             	mov    %eax,(%esp)
+  80363e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803645:	00 
+  803646:	8b 04 24             	mov    (%esp),%eax
+  803649:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80364d:	09 f0                	or     %esi,%eax
+  80364f:	09 fa                	or     %edi,%edx
+  803651:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803655:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803659:	39 f0                	cmp    %esi,%eax
+  80365b:	89 d5                	mov    %edx,%ebp
+  80365d:	19 fd                	sbb    %edi,%ebp
+  80365f:	72 af                	jb     803610 <dm+0x46>
+  803661:	29 f0                	sub    %esi,%eax
+  803663:	19 fa                	sbb    %edi,%edx
+  803665:	89 cf                	mov    %ecx,%edi
+  803667:	c1 ef 05             	shr    $0x5,%edi
+  80366a:	83 e7 01             	and    $0x1,%edi
+  80366d:	89 fe                	mov    %edi,%esi
+  80366f:	83 f6 01             	xor    $0x1,%esi
+  803672:	d3 e6                	shl    %cl,%esi
+  803674:	d3 e7                	shl    %cl,%edi
+  803676:	09 74 24 18          	or     %esi,0x18(%esp)
+  80367a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80367e:	eb 90                	jmp    803610 <dm+0x46>
+  803680:	85 db                	test   %ebx,%ebx
+  803682:	74 05                	je     803689 <dm+0xbf>
+  803684:	89 03                	mov    %eax,(%ebx)
+  803686:	89 53 04             	mov    %edx,0x4(%ebx)
+  803689:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80368d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803691:	83 c4 24             	add    $0x24,%esp
+  803694:	5b                   	pop    %ebx
+  803695:	5e                   	pop    %esi
+  803696:	5f                   	pop    %edi
+  803697:	5d                   	pop    %ebp
+  803698:	c3                   	ret
+
+00803699 <__udivdi3>:
+  803699:	83 ec 08             	sub    $0x8,%esp
+  80369c:	6a 00                	push   $0x0
+  80369e:	ff 74 24 1c          	push   0x1c(%esp)
+  8036a2:	ff 74 24 1c          	push   0x1c(%esp)
+  8036a6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036aa:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036ae:	e8 17 ff ff ff       	call   8035ca <dm>
+  8036b3:	83 c4 14             	add    $0x14,%esp
+  8036b6:	c3                   	ret
+
+008036b7 <__umoddi3>:
+  8036b7:	83 ec 18             	sub    $0x18,%esp
+  8036ba:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036be:	50                   	push   %eax
+  8036bf:	ff 74 24 2c          	push   0x2c(%esp)
+  8036c3:	ff 74 24 2c          	push   0x2c(%esp)
+  8036c7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036cb:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036cf:	e8 f6 fe ff ff       	call   8035ca <dm>
+  8036d4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036d8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036dc:	83 c4 24             	add    $0x24,%esp
+  8036df:	c3                   	ret
+
+008036e0 <__divdi3>:
+  8036e0:	53                   	push   %ebx
+  8036e1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036e5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036e9:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8036ed:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036f1:	85 d2                	test   %edx,%edx
+  8036f3:	78 15                	js     80370a <__divdi3+0x2a>
+  8036f5:	85 db                	test   %ebx,%ebx
+  8036f7:	78 34                	js     80372d <__divdi3+0x4d>
+  8036f9:	83 ec 04             	sub    $0x4,%esp
+  8036fc:	6a 00                	push   $0x0
+  8036fe:	53                   	push   %ebx
+  8036ff:	51                   	push   %ecx
+  803700:	e8 c5 fe ff ff       	call   8035ca <dm>
+  803705:	83 c4 10             	add    $0x10,%esp
+  803708:	eb 21                	jmp    80372b <__divdi3+0x4b>
+  80370a:	f7 d8                	neg    %eax
+  80370c:	83 d2 00             	adc    $0x0,%edx
+  80370f:	f7 da                	neg    %edx
+  803711:	85 db                	test   %ebx,%ebx
+  803713:	78 30                	js     803745 <__divdi3+0x65>
+  803715:	83 ec 04             	sub    $0x4,%esp
+  803718:	6a 00                	push   $0x0
+  80371a:	53                   	push   %ebx
+  80371b:	51                   	push   %ecx
+  80371c:	e8 a9 fe ff ff       	call   8035ca <dm>
+  803721:	83 c4 10             	add    $0x10,%esp
+  803724:	f7 d8                	neg    %eax
+  803726:	83 d2 00             	adc    $0x0,%edx
+  803729:	f7 da                	neg    %edx
+  80372b:	5b                   	pop    %ebx
+  80372c:	c3                   	ret
+  80372d:	83 ec 04             	sub    $0x4,%esp
+  803730:	6a 00                	push   $0x0
+  803732:	f7 d9                	neg    %ecx
+  803734:	83 d3 00             	adc    $0x0,%ebx
+  803737:	f7 db                	neg    %ebx
+  803739:	53                   	push   %ebx
+  80373a:	51                   	push   %ecx
+  80373b:	e8 8a fe ff ff       	call   8035ca <dm>
+  803740:	83 c4 10             	add    $0x10,%esp
+  803743:	eb df                	jmp    803724 <__divdi3+0x44>
+  803745:	83 ec 04             	sub    $0x4,%esp
+  803748:	6a 00                	push   $0x0
+  80374a:	f7 d9                	neg    %ecx
+  80374c:	83 d3 00             	adc    $0x0,%ebx
+  80374f:	f7 db                	neg    %ebx
+  803751:	53                   	push   %ebx
+  803752:	51                   	push   %ecx
+  803753:	e8 72 fe ff ff       	call   8035ca <dm>
+  803758:	83 c4 10             	add    $0x10,%esp
+  80375b:	eb ce                	jmp    80372b <__divdi3+0x4b>
+
+0080375d <__moddi3>:
+  80375d:	55                   	push   %ebp
+  80375e:	57                   	push   %edi
+  80375f:	56                   	push   %esi
+  803760:	53                   	push   %ebx
+  803761:	83 ec 24             	sub    $0x24,%esp
+  803764:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803768:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80376c:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803770:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803774:	85 d2                	test   %edx,%edx
+  803776:	78 3b                	js     8037b3 <__moddi3+0x56>
+  803778:	83 ec 04             	sub    $0x4,%esp
+  80377b:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80377f:	56                   	push   %esi
+  803780:	89 ce                	mov    %ecx,%esi
+  803782:	f7 de                	neg    %esi
+  803784:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803788:	89 de                	mov    %ebx,%esi
+  80378a:	83 d6 00             	adc    $0x0,%esi
+  80378d:	f7 de                	neg    %esi
+  80378f:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803793:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803797:	0f 48 f1             	cmovs  %ecx,%esi
+  80379a:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80379f:	53                   	push   %ebx
+  8037a0:	56                   	push   %esi
+  8037a1:	e8 24 fe ff ff       	call   8035ca <dm>
+  8037a6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037aa:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037ae:	83 c4 10             	add    $0x10,%esp
+  8037b1:	eb 47                	jmp    8037fa <__moddi3+0x9d>
+  8037b3:	f7 d8                	neg    %eax
+  8037b5:	83 d2 00             	adc    $0x0,%edx
+  8037b8:	f7 da                	neg    %edx
+  8037ba:	83 ec 04             	sub    $0x4,%esp
+  8037bd:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8037c1:	56                   	push   %esi
+  8037c2:	89 cf                	mov    %ecx,%edi
+  8037c4:	f7 df                	neg    %edi
+  8037c6:	89 de                	mov    %ebx,%esi
+  8037c8:	83 d6 00             	adc    $0x0,%esi
+  8037cb:	f7 de                	neg    %esi
+  8037cd:	0f 49 cf             	cmovns %edi,%ecx
+  8037d0:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8037d4:	0f 49 de             	cmovns %esi,%ebx
+  8037d7:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8037db:	ff 74 24 0c          	push   0xc(%esp)
+  8037df:	ff 74 24 0c          	push   0xc(%esp)
+  8037e3:	e8 e2 fd ff ff       	call   8035ca <dm>
+  8037e8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037ec:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037f0:	f7 d8                	neg    %eax
+  8037f2:	83 d2 00             	adc    $0x0,%edx
+  8037f5:	f7 da                	neg    %edx
+  8037f7:	83 c4 10             	add    $0x10,%esp
+  8037fa:	83 c4 24             	add    $0x24,%esp
+  8037fd:	5b                   	pop    %ebx
+  8037fe:	5e                   	pop    %esi
+  8037ff:	5f                   	pop    %edi
+  803800:	5d                   	pop    %ebp
+  803801:	c3                   	ret
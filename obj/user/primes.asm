@@ -0,0 +1,7734 @@
+
+obj/user/primes.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c3 00 00 00       	call   8000f4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	int i, id, p;
+	envid_t envid;
+
+	// fetch a prime from our left neighbor
+top:
+	p = ipc_recv(&envid, 0, 0);
+  80003c:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80003f:	83 ec 04             	sub    $0x4,%esp
+  800042:	6a 00                	push   $0x0
+  800044:	6a 00                	push   $0x0
+  800046:	56                   	push   %esi
+  800047:	e8 f6 12 00 00       	call   801342 <ipc_recv>
+  80004c:	89 c3                	mov    %eax,%ebx
+	cprintf("CPU %d: %d ", thisenv->env_cpunum, p);
+  80004e:	a1 00 50 80 00       	mov    0x805000,%eax
+  800053:	8b 40 5c             	mov    0x5c(%eax),%eax
+  800056:	83 c4 0c             	add    $0xc,%esp
+  800059:	53                   	push   %ebx
+  80005a:	50                   	push   %eax
+  80005b:	68 00 38 80 00       	push   $0x803800
+  800060:	e8 cd 01 00 00       	call   800232 <cprintf>
+
+	// fork a right neighbor to continue the chain
+	if ((id = fork()) < 0)
+  800065:	e8 1d 11 00 00       	call   801187 <fork>
+  80006a:	89 c7                	mov    %eax,%edi
+  80006c:	83 c4 10             	add    $0x10,%esp
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	78 2e                	js     8000a1 <primeproc+0x6e>
+		panic("fork: %e", id);
+	if (id == 0)
+  800073:	74 ca                	je     80003f <primeproc+0xc>
+		goto top;
+
+	// filter out multiples of our prime
+	while (1) {
+		i = ipc_recv(&envid, 0, 0);
+  800075:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800078:	83 ec 04             	sub    $0x4,%esp
+  80007b:	6a 00                	push   $0x0
+  80007d:	6a 00                	push   $0x0
+  80007f:	56                   	push   %esi
+  800080:	e8 bd 12 00 00       	call   801342 <ipc_recv>
+  800085:	89 c1                	mov    %eax,%ecx
+		if (i % p)
+  800087:	99                   	cltd
+  800088:	f7 fb                	idiv   %ebx
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	85 d2                	test   %edx,%edx
+  80008f:	74 e7                	je     800078 <primeproc+0x45>
+			ipc_send(id, i, 0, 0);
+  800091:	6a 00                	push   $0x0
+  800093:	6a 00                	push   $0x0
+  800095:	51                   	push   %ecx
+  800096:	57                   	push   %edi
+  800097:	e8 11 13 00 00       	call   8013ad <ipc_send>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb d7                	jmp    800078 <primeproc+0x45>
+		panic("fork: %e", id);
+  8000a1:	50                   	push   %eax
+  8000a2:	68 0c 38 80 00       	push   $0x80380c
+  8000a7:	6a 1a                	push   $0x1a
+  8000a9:	68 15 38 80 00       	push   $0x803815
+  8000ae:	e8 a4 00 00 00       	call   800157 <_panic>
+
+008000b3 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  8000b3:	55                   	push   %ebp
+  8000b4:	89 e5                	mov    %esp,%ebp
+  8000b6:	56                   	push   %esi
+  8000b7:	53                   	push   %ebx
+	int i, id;
+
+	// fork the first prime process in the chain
+	if ((id = fork()) < 0)
+  8000b8:	e8 ca 10 00 00       	call   801187 <fork>
+  8000bd:	89 c6                	mov    %eax,%esi
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	78 1a                	js     8000dd <umain+0x2a>
+		panic("fork: %e", id);
+	if (id == 0)
+		primeproc();
+
+	// feed all the integers through
+	for (i = 2; ; i++)
+  8000c3:	bb 02 00 00 00       	mov    $0x2,%ebx
+	if (id == 0)
+  8000c8:	74 25                	je     8000ef <umain+0x3c>
+		ipc_send(id, i, 0, 0);
+  8000ca:	6a 00                	push   $0x0
+  8000cc:	6a 00                	push   $0x0
+  8000ce:	53                   	push   %ebx
+  8000cf:	56                   	push   %esi
+  8000d0:	e8 d8 12 00 00       	call   8013ad <ipc_send>
+	for (i = 2; ; i++)
+  8000d5:	83 c3 01             	add    $0x1,%ebx
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	eb ed                	jmp    8000ca <umain+0x17>
+		panic("fork: %e", id);
+  8000dd:	50                   	push   %eax
+  8000de:	68 0c 38 80 00       	push   $0x80380c
+  8000e3:	6a 2d                	push   $0x2d
+  8000e5:	68 15 38 80 00       	push   $0x803815
+  8000ea:	e8 68 00 00 00       	call   800157 <_panic>
+		primeproc();
+  8000ef:	e8 3f ff ff ff       	call   800033 <primeproc>
+
+008000f4 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	56                   	push   %esi
+  8000f8:	53                   	push   %ebx
+  8000f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000ff:	e8 e2 0a 00 00       	call   800be6 <sys_getenvid>
+  800104:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800109:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80010f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800114:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800119:	85 db                	test   %ebx,%ebx
+  80011b:	7e 07                	jle    800124 <libmain+0x30>
+		binaryname = argv[0];
+  80011d:	8b 06                	mov    (%esi),%eax
+  80011f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800124:	83 ec 08             	sub    $0x8,%esp
+  800127:	56                   	push   %esi
+  800128:	53                   	push   %ebx
+  800129:	e8 85 ff ff ff       	call   8000b3 <umain>
+
+	// exit gracefully
+	exit();
+  80012e:	e8 0a 00 00 00       	call   80013d <exit>
+}
+  800133:	83 c4 10             	add    $0x10,%esp
+  800136:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800139:	5b                   	pop    %ebx
+  80013a:	5e                   	pop    %esi
+  80013b:	5d                   	pop    %ebp
+  80013c:	c3                   	ret
+
+0080013d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80013d:	55                   	push   %ebp
+  80013e:	89 e5                	mov    %esp,%ebp
+  800140:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800143:	e8 b1 15 00 00       	call   8016f9 <close_all>
+	sys_env_destroy(0);
+  800148:	83 ec 0c             	sub    $0xc,%esp
+  80014b:	6a 00                	push   $0x0
+  80014d:	e8 4b 0a 00 00       	call   800b9d <sys_env_destroy>
+}
+  800152:	83 c4 10             	add    $0x10,%esp
+  800155:	c9                   	leave
+  800156:	c3                   	ret
+
+00800157 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800157:	55                   	push   %ebp
+  800158:	89 e5                	mov    %esp,%ebp
+  80015a:	56                   	push   %esi
+  80015b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80015c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80015f:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800165:	e8 7c 0a 00 00       	call   800be6 <sys_getenvid>
+  80016a:	83 ec 0c             	sub    $0xc,%esp
+  80016d:	ff 75 0c             	push   0xc(%ebp)
+  800170:	ff 75 08             	push   0x8(%ebp)
+  800173:	56                   	push   %esi
+  800174:	50                   	push   %eax
+  800175:	68 30 38 80 00       	push   $0x803830
+  80017a:	e8 b3 00 00 00       	call   800232 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80017f:	83 c4 18             	add    $0x18,%esp
+  800182:	53                   	push   %ebx
+  800183:	ff 75 10             	push   0x10(%ebp)
+  800186:	e8 56 00 00 00       	call   8001e1 <vcprintf>
+	cprintf("\n");
+  80018b:	c7 04 24 c2 3d 80 00 	movl   $0x803dc2,(%esp)
+  800192:	e8 9b 00 00 00       	call   800232 <cprintf>
+  800197:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80019a:	cc                   	int3
+	while (1)
+  80019b:	eb fd                	jmp    80019a <_panic+0x43>
+
+0080019d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80019d:	55                   	push   %ebp
+  80019e:	89 e5                	mov    %esp,%ebp
+  8001a0:	53                   	push   %ebx
+  8001a1:	83 ec 04             	sub    $0x4,%esp
+  8001a4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001a7:	8b 13                	mov    (%ebx),%edx
+  8001a9:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ac:	89 03                	mov    %eax,(%ebx)
+  8001ae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001b1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001b5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001ba:	74 09                	je     8001c5 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001bc:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c3:	c9                   	leave
+  8001c4:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001c5:	83 ec 08             	sub    $0x8,%esp
+  8001c8:	68 ff 00 00 00       	push   $0xff
+  8001cd:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001d0:	50                   	push   %eax
+  8001d1:	e8 7a 09 00 00       	call   800b50 <sys_cputs>
+		b->idx = 0;
+  8001d6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001dc:	83 c4 10             	add    $0x10,%esp
+  8001df:	eb db                	jmp    8001bc <putch+0x1f>
+
+008001e1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001e1:	55                   	push   %ebp
+  8001e2:	89 e5                	mov    %esp,%ebp
+  8001e4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ea:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001f1:	00 00 00 
+	b.cnt = 0;
+  8001f4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001fb:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001fe:	ff 75 0c             	push   0xc(%ebp)
+  800201:	ff 75 08             	push   0x8(%ebp)
+  800204:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80020a:	50                   	push   %eax
+  80020b:	68 9d 01 80 00       	push   $0x80019d
+  800210:	e8 14 01 00 00       	call   800329 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800215:	83 c4 08             	add    $0x8,%esp
+  800218:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80021e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800224:	50                   	push   %eax
+  800225:	e8 26 09 00 00       	call   800b50 <sys_cputs>
+
+	return b.cnt;
+}
+  80022a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800230:	c9                   	leave
+  800231:	c3                   	ret
+
+00800232 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800232:	55                   	push   %ebp
+  800233:	89 e5                	mov    %esp,%ebp
+  800235:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800238:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80023b:	50                   	push   %eax
+  80023c:	ff 75 08             	push   0x8(%ebp)
+  80023f:	e8 9d ff ff ff       	call   8001e1 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800244:	c9                   	leave
+  800245:	c3                   	ret
+
+00800246 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800246:	55                   	push   %ebp
+  800247:	89 e5                	mov    %esp,%ebp
+  800249:	57                   	push   %edi
+  80024a:	56                   	push   %esi
+  80024b:	53                   	push   %ebx
+  80024c:	83 ec 1c             	sub    $0x1c,%esp
+  80024f:	89 c7                	mov    %eax,%edi
+  800251:	89 d6                	mov    %edx,%esi
+  800253:	8b 45 08             	mov    0x8(%ebp),%eax
+  800256:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800259:	89 d1                	mov    %edx,%ecx
+  80025b:	89 c2                	mov    %eax,%edx
+  80025d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800260:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800263:	8b 45 10             	mov    0x10(%ebp),%eax
+  800266:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800269:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80026c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800273:	39 c2                	cmp    %eax,%edx
+  800275:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800278:	72 3e                	jb     8002b8 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80027a:	83 ec 0c             	sub    $0xc,%esp
+  80027d:	ff 75 18             	push   0x18(%ebp)
+  800280:	83 eb 01             	sub    $0x1,%ebx
+  800283:	53                   	push   %ebx
+  800284:	50                   	push   %eax
+  800285:	83 ec 08             	sub    $0x8,%esp
+  800288:	ff 75 e4             	push   -0x1c(%ebp)
+  80028b:	ff 75 e0             	push   -0x20(%ebp)
+  80028e:	ff 75 dc             	push   -0x24(%ebp)
+  800291:	ff 75 d8             	push   -0x28(%ebp)
+  800294:	e8 f1 33 00 00       	call   80368a <__udivdi3>
+  800299:	83 c4 18             	add    $0x18,%esp
+  80029c:	52                   	push   %edx
+  80029d:	50                   	push   %eax
+  80029e:	89 f2                	mov    %esi,%edx
+  8002a0:	89 f8                	mov    %edi,%eax
+  8002a2:	e8 9f ff ff ff       	call   800246 <printnum>
+  8002a7:	83 c4 20             	add    $0x20,%esp
+  8002aa:	eb 13                	jmp    8002bf <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002ac:	83 ec 08             	sub    $0x8,%esp
+  8002af:	56                   	push   %esi
+  8002b0:	ff 75 18             	push   0x18(%ebp)
+  8002b3:	ff d7                	call   *%edi
+  8002b5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002b8:	83 eb 01             	sub    $0x1,%ebx
+  8002bb:	85 db                	test   %ebx,%ebx
+  8002bd:	7f ed                	jg     8002ac <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002bf:	83 ec 08             	sub    $0x8,%esp
+  8002c2:	56                   	push   %esi
+  8002c3:	83 ec 04             	sub    $0x4,%esp
+  8002c6:	ff 75 e4             	push   -0x1c(%ebp)
+  8002c9:	ff 75 e0             	push   -0x20(%ebp)
+  8002cc:	ff 75 dc             	push   -0x24(%ebp)
+  8002cf:	ff 75 d8             	push   -0x28(%ebp)
+  8002d2:	e8 d1 33 00 00       	call   8036a8 <__umoddi3>
+  8002d7:	83 c4 14             	add    $0x14,%esp
+  8002da:	0f be 80 53 38 80 00 	movsbl 0x803853(%eax),%eax
+  8002e1:	50                   	push   %eax
+  8002e2:	ff d7                	call   *%edi
+}
+  8002e4:	83 c4 10             	add    $0x10,%esp
+  8002e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ea:	5b                   	pop    %ebx
+  8002eb:	5e                   	pop    %esi
+  8002ec:	5f                   	pop    %edi
+  8002ed:	5d                   	pop    %ebp
+  8002ee:	c3                   	ret
+
+008002ef <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002ef:	55                   	push   %ebp
+  8002f0:	89 e5                	mov    %esp,%ebp
+  8002f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002f5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002f9:	8b 10                	mov    (%eax),%edx
+  8002fb:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002fe:	73 0a                	jae    80030a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800300:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800303:	89 08                	mov    %ecx,(%eax)
+  800305:	8b 45 08             	mov    0x8(%ebp),%eax
+  800308:	88 02                	mov    %al,(%edx)
+}
+  80030a:	5d                   	pop    %ebp
+  80030b:	c3                   	ret
+
+0080030c <printfmt>:
+{
+  80030c:	55                   	push   %ebp
+  80030d:	89 e5                	mov    %esp,%ebp
+  80030f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800312:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800315:	50                   	push   %eax
+  800316:	ff 75 10             	push   0x10(%ebp)
+  800319:	ff 75 0c             	push   0xc(%ebp)
+  80031c:	ff 75 08             	push   0x8(%ebp)
+  80031f:	e8 05 00 00 00       	call   800329 <vprintfmt>
+}
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	c9                   	leave
+  800328:	c3                   	ret
+
+00800329 <vprintfmt>:
+{
+  800329:	55                   	push   %ebp
+  80032a:	89 e5                	mov    %esp,%ebp
+  80032c:	57                   	push   %edi
+  80032d:	56                   	push   %esi
+  80032e:	53                   	push   %ebx
+  80032f:	83 ec 2c             	sub    $0x2c,%esp
+  800332:	8b 75 08             	mov    0x8(%ebp),%esi
+  800335:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800338:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80033b:	eb 0a                	jmp    800347 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80033d:	83 ec 08             	sub    $0x8,%esp
+  800340:	53                   	push   %ebx
+  800341:	50                   	push   %eax
+  800342:	ff d6                	call   *%esi
+  800344:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800347:	83 c7 01             	add    $0x1,%edi
+  80034a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80034e:	83 f8 25             	cmp    $0x25,%eax
+  800351:	74 0c                	je     80035f <vprintfmt+0x36>
+			if (ch == '\0')
+  800353:	85 c0                	test   %eax,%eax
+  800355:	75 e6                	jne    80033d <vprintfmt+0x14>
+}
+  800357:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80035a:	5b                   	pop    %ebx
+  80035b:	5e                   	pop    %esi
+  80035c:	5f                   	pop    %edi
+  80035d:	5d                   	pop    %ebp
+  80035e:	c3                   	ret
+		padc = ' ';
+  80035f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800363:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80036a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800371:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800378:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80037d:	8d 47 01             	lea    0x1(%edi),%eax
+  800380:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800383:	0f b6 17             	movzbl (%edi),%edx
+  800386:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800389:	3c 55                	cmp    $0x55,%al
+  80038b:	0f 87 cf 03 00 00    	ja     800760 <vprintfmt+0x437>
+  800391:	0f b6 c0             	movzbl %al,%eax
+  800394:	ff 24 85 c0 39 80 00 	jmp    *0x8039c0(,%eax,4)
+  80039b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80039e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003a2:	eb d9                	jmp    80037d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003a7:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003ab:	eb d0                	jmp    80037d <vprintfmt+0x54>
+  8003ad:	0f b6 d2             	movzbl %dl,%edx
+  8003b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003bb:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003be:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003c2:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003c5:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003c8:	83 f9 09             	cmp    $0x9,%ecx
+  8003cb:	77 55                	ja     800422 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003cd:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003d0:	eb e9                	jmp    8003bb <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d5:	8b 00                	mov    (%eax),%eax
+  8003d7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8003e0:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003e6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ea:	79 91                	jns    80037d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003ec:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003f2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003f9:	eb 82                	jmp    80037d <vprintfmt+0x54>
+			if (width < 0)
+  8003fb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003fe:	85 d2                	test   %edx,%edx
+  800400:	b8 00 00 00 00       	mov    $0x0,%eax
+  800405:	0f 49 c2             	cmovns %edx,%eax
+  800408:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80040b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80040e:	e9 6a ff ff ff       	jmp    80037d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800413:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800416:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80041d:	e9 5b ff ff ff       	jmp    80037d <vprintfmt+0x54>
+  800422:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800425:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800428:	eb bc                	jmp    8003e6 <vprintfmt+0xbd>
+			lflag++;
+  80042a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80042d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800430:	e9 48 ff ff ff       	jmp    80037d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800435:	8b 45 14             	mov    0x14(%ebp),%eax
+  800438:	8d 78 04             	lea    0x4(%eax),%edi
+  80043b:	83 ec 08             	sub    $0x8,%esp
+  80043e:	53                   	push   %ebx
+  80043f:	ff 30                	push   (%eax)
+  800441:	ff d6                	call   *%esi
+			break;
+  800443:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800446:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800449:	e9 b1 02 00 00       	jmp    8006ff <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80044e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800451:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800454:	8b 10                	mov    (%eax),%edx
+  800456:	89 d0                	mov    %edx,%eax
+  800458:	f7 d8                	neg    %eax
+  80045a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80045d:	83 f8 11             	cmp    $0x11,%eax
+  800460:	7f 23                	jg     800485 <vprintfmt+0x15c>
+  800462:	8b 14 85 20 3b 80 00 	mov    0x803b20(,%eax,4),%edx
+  800469:	85 d2                	test   %edx,%edx
+  80046b:	74 18                	je     800485 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80046d:	52                   	push   %edx
+  80046e:	68 3e 3c 80 00       	push   $0x803c3e
+  800473:	53                   	push   %ebx
+  800474:	56                   	push   %esi
+  800475:	e8 92 fe ff ff       	call   80030c <printfmt>
+  80047a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800480:	e9 7a 02 00 00       	jmp    8006ff <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800485:	50                   	push   %eax
+  800486:	68 6b 38 80 00       	push   $0x80386b
+  80048b:	53                   	push   %ebx
+  80048c:	56                   	push   %esi
+  80048d:	e8 7a fe ff ff       	call   80030c <printfmt>
+  800492:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800495:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800498:	e9 62 02 00 00       	jmp    8006ff <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80049d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a0:	83 c0 04             	add    $0x4,%eax
+  8004a3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004ab:	85 c9                	test   %ecx,%ecx
+  8004ad:	b8 64 38 80 00       	mov    $0x803864,%eax
+  8004b2:	0f 45 c1             	cmovne %ecx,%eax
+  8004b5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004b8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004bc:	7e 06                	jle    8004c4 <vprintfmt+0x19b>
+  8004be:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004c2:	75 0b                	jne    8004cf <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c4:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004c7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004ca:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004cd:	eb 5c                	jmp    80052b <vprintfmt+0x202>
+  8004cf:	83 ec 08             	sub    $0x8,%esp
+  8004d2:	ff 75 d0             	push   -0x30(%ebp)
+  8004d5:	ff 75 cc             	push   -0x34(%ebp)
+  8004d8:	e8 20 03 00 00       	call   8007fd <strnlen>
+  8004dd:	89 c2                	mov    %eax,%edx
+  8004df:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e2:	29 d0                	sub    %edx,%eax
+  8004e4:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004e7:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004eb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ee:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004f1:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f3:	eb 0e                	jmp    800503 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004f5:	83 ec 08             	sub    $0x8,%esp
+  8004f8:	53                   	push   %ebx
+  8004f9:	57                   	push   %edi
+  8004fa:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fd:	83 ee 01             	sub    $0x1,%esi
+  800500:	83 c4 10             	add    $0x10,%esp
+  800503:	85 f6                	test   %esi,%esi
+  800505:	7f ee                	jg     8004f5 <vprintfmt+0x1cc>
+  800507:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80050a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050d:	85 c0                	test   %eax,%eax
+  80050f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800514:	0f 49 d0             	cmovns %eax,%edx
+  800517:	29 d0                	sub    %edx,%eax
+  800519:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80051c:	eb a6                	jmp    8004c4 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80051e:	83 ec 08             	sub    $0x8,%esp
+  800521:	53                   	push   %ebx
+  800522:	52                   	push   %edx
+  800523:	ff 55 08             	call   *0x8(%ebp)
+  800526:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800529:	89 f1                	mov    %esi,%ecx
+  80052b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80052e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800532:	0f be d0             	movsbl %al,%edx
+  800535:	85 d2                	test   %edx,%edx
+  800537:	74 28                	je     800561 <vprintfmt+0x238>
+  800539:	85 ff                	test   %edi,%edi
+  80053b:	78 05                	js     800542 <vprintfmt+0x219>
+  80053d:	83 ef 01             	sub    $0x1,%edi
+  800540:	78 30                	js     800572 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800542:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800546:	74 d6                	je     80051e <vprintfmt+0x1f5>
+  800548:	0f be c0             	movsbl %al,%eax
+  80054b:	83 e8 20             	sub    $0x20,%eax
+  80054e:	83 f8 5e             	cmp    $0x5e,%eax
+  800551:	76 cb                	jbe    80051e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800553:	83 ec 08             	sub    $0x8,%esp
+  800556:	53                   	push   %ebx
+  800557:	6a 3f                	push   $0x3f
+  800559:	ff 55 08             	call   *0x8(%ebp)
+  80055c:	83 c4 10             	add    $0x10,%esp
+  80055f:	eb c8                	jmp    800529 <vprintfmt+0x200>
+  800561:	8b 75 08             	mov    0x8(%ebp),%esi
+  800564:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800567:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80056a:	01 d0                	add    %edx,%eax
+  80056c:	29 c8                	sub    %ecx,%eax
+  80056e:	89 c7                	mov    %eax,%edi
+  800570:	eb 13                	jmp    800585 <vprintfmt+0x25c>
+  800572:	8b 75 08             	mov    0x8(%ebp),%esi
+  800575:	eb ed                	jmp    800564 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800577:	83 ec 08             	sub    $0x8,%esp
+  80057a:	53                   	push   %ebx
+  80057b:	6a 20                	push   $0x20
+  80057d:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80057f:	83 ef 01             	sub    $0x1,%edi
+  800582:	83 c4 10             	add    $0x10,%esp
+  800585:	85 ff                	test   %edi,%edi
+  800587:	7f ee                	jg     800577 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800589:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80058c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80058f:	e9 6b 01 00 00       	jmp    8006ff <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800594:	83 f9 01             	cmp    $0x1,%ecx
+  800597:	7f 1f                	jg     8005b8 <vprintfmt+0x28f>
+	else if (lflag)
+  800599:	85 c9                	test   %ecx,%ecx
+  80059b:	74 67                	je     800604 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80059d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a0:	8b 00                	mov    (%eax),%eax
+  8005a2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a5:	89 c1                	mov    %eax,%ecx
+  8005a7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005aa:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b6:	eb 17                	jmp    8005cf <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bb:	8b 50 04             	mov    0x4(%eax),%edx
+  8005be:	8b 00                	mov    (%eax),%eax
+  8005c0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c9:	8d 40 08             	lea    0x8(%eax),%eax
+  8005cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005cf:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005d5:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005da:	85 c9                	test   %ecx,%ecx
+  8005dc:	0f 89 03 01 00 00    	jns    8006e5 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005e2:	83 ec 08             	sub    $0x8,%esp
+  8005e5:	53                   	push   %ebx
+  8005e6:	6a 2d                	push   $0x2d
+  8005e8:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005ea:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ed:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005f0:	f7 da                	neg    %edx
+  8005f2:	83 d1 00             	adc    $0x0,%ecx
+  8005f5:	f7 d9                	neg    %ecx
+  8005f7:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005fa:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005ff:	e9 e1 00 00 00       	jmp    8006e5 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800604:	8b 45 14             	mov    0x14(%ebp),%eax
+  800607:	8b 00                	mov    (%eax),%eax
+  800609:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80060c:	89 c1                	mov    %eax,%ecx
+  80060e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800611:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800614:	8b 45 14             	mov    0x14(%ebp),%eax
+  800617:	8d 40 04             	lea    0x4(%eax),%eax
+  80061a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061d:	eb b0                	jmp    8005cf <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80061f:	83 f9 01             	cmp    $0x1,%ecx
+  800622:	7f 1e                	jg     800642 <vprintfmt+0x319>
+	else if (lflag)
+  800624:	85 c9                	test   %ecx,%ecx
+  800626:	74 32                	je     80065a <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800628:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062b:	8b 10                	mov    (%eax),%edx
+  80062d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800632:	8d 40 04             	lea    0x4(%eax),%eax
+  800635:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800638:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80063d:	e9 a3 00 00 00       	jmp    8006e5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800642:	8b 45 14             	mov    0x14(%ebp),%eax
+  800645:	8b 10                	mov    (%eax),%edx
+  800647:	8b 48 04             	mov    0x4(%eax),%ecx
+  80064a:	8d 40 08             	lea    0x8(%eax),%eax
+  80064d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800650:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800655:	e9 8b 00 00 00       	jmp    8006e5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80065a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065d:	8b 10                	mov    (%eax),%edx
+  80065f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800664:	8d 40 04             	lea    0x4(%eax),%eax
+  800667:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80066a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80066f:	eb 74                	jmp    8006e5 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800671:	83 f9 01             	cmp    $0x1,%ecx
+  800674:	7f 1b                	jg     800691 <vprintfmt+0x368>
+	else if (lflag)
+  800676:	85 c9                	test   %ecx,%ecx
+  800678:	74 2c                	je     8006a6 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80067a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067d:	8b 10                	mov    (%eax),%edx
+  80067f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800684:	8d 40 04             	lea    0x4(%eax),%eax
+  800687:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80068a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80068f:	eb 54                	jmp    8006e5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800691:	8b 45 14             	mov    0x14(%ebp),%eax
+  800694:	8b 10                	mov    (%eax),%edx
+  800696:	8b 48 04             	mov    0x4(%eax),%ecx
+  800699:	8d 40 08             	lea    0x8(%eax),%eax
+  80069c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80069f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006a4:	eb 3f                	jmp    8006e5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a9:	8b 10                	mov    (%eax),%edx
+  8006ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006b6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006bb:	eb 28                	jmp    8006e5 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006bd:	83 ec 08             	sub    $0x8,%esp
+  8006c0:	53                   	push   %ebx
+  8006c1:	6a 30                	push   $0x30
+  8006c3:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006c5:	83 c4 08             	add    $0x8,%esp
+  8006c8:	53                   	push   %ebx
+  8006c9:	6a 78                	push   $0x78
+  8006cb:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d0:	8b 10                	mov    (%eax),%edx
+  8006d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006d7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006da:	8d 40 04             	lea    0x4(%eax),%eax
+  8006dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e0:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006e5:	83 ec 0c             	sub    $0xc,%esp
+  8006e8:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006ec:	50                   	push   %eax
+  8006ed:	ff 75 e0             	push   -0x20(%ebp)
+  8006f0:	57                   	push   %edi
+  8006f1:	51                   	push   %ecx
+  8006f2:	52                   	push   %edx
+  8006f3:	89 da                	mov    %ebx,%edx
+  8006f5:	89 f0                	mov    %esi,%eax
+  8006f7:	e8 4a fb ff ff       	call   800246 <printnum>
+			break;
+  8006fc:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006ff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800702:	e9 40 fc ff ff       	jmp    800347 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800707:	83 f9 01             	cmp    $0x1,%ecx
+  80070a:	7f 1b                	jg     800727 <vprintfmt+0x3fe>
+	else if (lflag)
+  80070c:	85 c9                	test   %ecx,%ecx
+  80070e:	74 2c                	je     80073c <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800710:	8b 45 14             	mov    0x14(%ebp),%eax
+  800713:	8b 10                	mov    (%eax),%edx
+  800715:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071a:	8d 40 04             	lea    0x4(%eax),%eax
+  80071d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800720:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800725:	eb be                	jmp    8006e5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800727:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072a:	8b 10                	mov    (%eax),%edx
+  80072c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80072f:	8d 40 08             	lea    0x8(%eax),%eax
+  800732:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800735:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80073a:	eb a9                	jmp    8006e5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80073c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073f:	8b 10                	mov    (%eax),%edx
+  800741:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800746:	8d 40 04             	lea    0x4(%eax),%eax
+  800749:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80074c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800751:	eb 92                	jmp    8006e5 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800753:	83 ec 08             	sub    $0x8,%esp
+  800756:	53                   	push   %ebx
+  800757:	6a 25                	push   $0x25
+  800759:	ff d6                	call   *%esi
+			break;
+  80075b:	83 c4 10             	add    $0x10,%esp
+  80075e:	eb 9f                	jmp    8006ff <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800760:	83 ec 08             	sub    $0x8,%esp
+  800763:	53                   	push   %ebx
+  800764:	6a 25                	push   $0x25
+  800766:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800768:	83 c4 10             	add    $0x10,%esp
+  80076b:	89 f8                	mov    %edi,%eax
+  80076d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800771:	74 05                	je     800778 <vprintfmt+0x44f>
+  800773:	83 e8 01             	sub    $0x1,%eax
+  800776:	eb f5                	jmp    80076d <vprintfmt+0x444>
+  800778:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80077b:	eb 82                	jmp    8006ff <vprintfmt+0x3d6>
+
+0080077d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80077d:	55                   	push   %ebp
+  80077e:	89 e5                	mov    %esp,%ebp
+  800780:	83 ec 18             	sub    $0x18,%esp
+  800783:	8b 45 08             	mov    0x8(%ebp),%eax
+  800786:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800789:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80078c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800790:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800793:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80079a:	85 c0                	test   %eax,%eax
+  80079c:	74 26                	je     8007c4 <vsnprintf+0x47>
+  80079e:	85 d2                	test   %edx,%edx
+  8007a0:	7e 22                	jle    8007c4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007a2:	ff 75 14             	push   0x14(%ebp)
+  8007a5:	ff 75 10             	push   0x10(%ebp)
+  8007a8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007ab:	50                   	push   %eax
+  8007ac:	68 ef 02 80 00       	push   $0x8002ef
+  8007b1:	e8 73 fb ff ff       	call   800329 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007b6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007b9:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007bf:	83 c4 10             	add    $0x10,%esp
+}
+  8007c2:	c9                   	leave
+  8007c3:	c3                   	ret
+		return -E_INVAL;
+  8007c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007c9:	eb f7                	jmp    8007c2 <vsnprintf+0x45>
+
+008007cb <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007cb:	55                   	push   %ebp
+  8007cc:	89 e5                	mov    %esp,%ebp
+  8007ce:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007d1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007d4:	50                   	push   %eax
+  8007d5:	ff 75 10             	push   0x10(%ebp)
+  8007d8:	ff 75 0c             	push   0xc(%ebp)
+  8007db:	ff 75 08             	push   0x8(%ebp)
+  8007de:	e8 9a ff ff ff       	call   80077d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007e3:	c9                   	leave
+  8007e4:	c3                   	ret
+
+008007e5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007e5:	55                   	push   %ebp
+  8007e6:	89 e5                	mov    %esp,%ebp
+  8007e8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f0:	eb 03                	jmp    8007f5 <strlen+0x10>
+		n++;
+  8007f2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007f5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007f9:	75 f7                	jne    8007f2 <strlen+0xd>
+	return n;
+}
+  8007fb:	5d                   	pop    %ebp
+  8007fc:	c3                   	ret
+
+008007fd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007fd:	55                   	push   %ebp
+  8007fe:	89 e5                	mov    %esp,%ebp
+  800800:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800803:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800806:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080b:	eb 03                	jmp    800810 <strnlen+0x13>
+		n++;
+  80080d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800810:	39 d0                	cmp    %edx,%eax
+  800812:	74 08                	je     80081c <strnlen+0x1f>
+  800814:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800818:	75 f3                	jne    80080d <strnlen+0x10>
+  80081a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80081c:	89 d0                	mov    %edx,%eax
+  80081e:	5d                   	pop    %ebp
+  80081f:	c3                   	ret
+
+00800820 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800820:	55                   	push   %ebp
+  800821:	89 e5                	mov    %esp,%ebp
+  800823:	53                   	push   %ebx
+  800824:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800827:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80082a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800833:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800836:	83 c0 01             	add    $0x1,%eax
+  800839:	84 d2                	test   %dl,%dl
+  80083b:	75 f2                	jne    80082f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80083d:	89 c8                	mov    %ecx,%eax
+  80083f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800842:	c9                   	leave
+  800843:	c3                   	ret
+
+00800844 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800844:	55                   	push   %ebp
+  800845:	89 e5                	mov    %esp,%ebp
+  800847:	53                   	push   %ebx
+  800848:	83 ec 10             	sub    $0x10,%esp
+  80084b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80084e:	53                   	push   %ebx
+  80084f:	e8 91 ff ff ff       	call   8007e5 <strlen>
+  800854:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800857:	ff 75 0c             	push   0xc(%ebp)
+  80085a:	01 d8                	add    %ebx,%eax
+  80085c:	50                   	push   %eax
+  80085d:	e8 be ff ff ff       	call   800820 <strcpy>
+	return dst;
+}
+  800862:	89 d8                	mov    %ebx,%eax
+  800864:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800867:	c9                   	leave
+  800868:	c3                   	ret
+
+00800869 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800869:	55                   	push   %ebp
+  80086a:	89 e5                	mov    %esp,%ebp
+  80086c:	56                   	push   %esi
+  80086d:	53                   	push   %ebx
+  80086e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800871:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800874:	89 f3                	mov    %esi,%ebx
+  800876:	03 5d 10             	add    0x10(%ebp),%ebx
+  800879:	89 f0                	mov    %esi,%eax
+  80087b:	eb 0f                	jmp    80088c <strncpy+0x23>
+		*dst++ = *src;
+  80087d:	83 c0 01             	add    $0x1,%eax
+  800880:	0f b6 0a             	movzbl (%edx),%ecx
+  800883:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800886:	80 f9 01             	cmp    $0x1,%cl
+  800889:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80088c:	39 d8                	cmp    %ebx,%eax
+  80088e:	75 ed                	jne    80087d <strncpy+0x14>
+	}
+	return ret;
+}
+  800890:	89 f0                	mov    %esi,%eax
+  800892:	5b                   	pop    %ebx
+  800893:	5e                   	pop    %esi
+  800894:	5d                   	pop    %ebp
+  800895:	c3                   	ret
+
+00800896 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800896:	55                   	push   %ebp
+  800897:	89 e5                	mov    %esp,%ebp
+  800899:	56                   	push   %esi
+  80089a:	53                   	push   %ebx
+  80089b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80089e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a1:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008a4:	89 f0                	mov    %esi,%eax
+  8008a6:	85 d2                	test   %edx,%edx
+  8008a8:	74 21                	je     8008cb <strlcpy+0x35>
+  8008aa:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008ae:	89 f2                	mov    %esi,%edx
+  8008b0:	eb 09                	jmp    8008bb <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008b2:	83 c1 01             	add    $0x1,%ecx
+  8008b5:	83 c2 01             	add    $0x1,%edx
+  8008b8:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008bb:	39 c2                	cmp    %eax,%edx
+  8008bd:	74 09                	je     8008c8 <strlcpy+0x32>
+  8008bf:	0f b6 19             	movzbl (%ecx),%ebx
+  8008c2:	84 db                	test   %bl,%bl
+  8008c4:	75 ec                	jne    8008b2 <strlcpy+0x1c>
+  8008c6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008c8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008cb:	29 f0                	sub    %esi,%eax
+}
+  8008cd:	5b                   	pop    %ebx
+  8008ce:	5e                   	pop    %esi
+  8008cf:	5d                   	pop    %ebp
+  8008d0:	c3                   	ret
+
+008008d1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008d1:	55                   	push   %ebp
+  8008d2:	89 e5                	mov    %esp,%ebp
+  8008d4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008da:	eb 06                	jmp    8008e2 <strcmp+0x11>
+		p++, q++;
+  8008dc:	83 c1 01             	add    $0x1,%ecx
+  8008df:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008e2:	0f b6 01             	movzbl (%ecx),%eax
+  8008e5:	84 c0                	test   %al,%al
+  8008e7:	74 04                	je     8008ed <strcmp+0x1c>
+  8008e9:	3a 02                	cmp    (%edx),%al
+  8008eb:	74 ef                	je     8008dc <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ed:	0f b6 c0             	movzbl %al,%eax
+  8008f0:	0f b6 12             	movzbl (%edx),%edx
+  8008f3:	29 d0                	sub    %edx,%eax
+}
+  8008f5:	5d                   	pop    %ebp
+  8008f6:	c3                   	ret
+
+008008f7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008f7:	55                   	push   %ebp
+  8008f8:	89 e5                	mov    %esp,%ebp
+  8008fa:	53                   	push   %ebx
+  8008fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800901:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800904:	eb 09                	jmp    80090f <strncmp+0x18>
+		n--, p++, q++;
+  800906:	83 ea 01             	sub    $0x1,%edx
+  800909:	83 c0 01             	add    $0x1,%eax
+  80090c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80090f:	85 d2                	test   %edx,%edx
+  800911:	74 18                	je     80092b <strncmp+0x34>
+  800913:	0f b6 18             	movzbl (%eax),%ebx
+  800916:	84 db                	test   %bl,%bl
+  800918:	74 04                	je     80091e <strncmp+0x27>
+  80091a:	3a 19                	cmp    (%ecx),%bl
+  80091c:	74 e8                	je     800906 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80091e:	0f b6 00             	movzbl (%eax),%eax
+  800921:	0f b6 11             	movzbl (%ecx),%edx
+  800924:	29 d0                	sub    %edx,%eax
+}
+  800926:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800929:	c9                   	leave
+  80092a:	c3                   	ret
+		return 0;
+  80092b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800930:	eb f4                	jmp    800926 <strncmp+0x2f>
+
+00800932 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800932:	55                   	push   %ebp
+  800933:	89 e5                	mov    %esp,%ebp
+  800935:	8b 45 08             	mov    0x8(%ebp),%eax
+  800938:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80093c:	eb 03                	jmp    800941 <strchr+0xf>
+  80093e:	83 c0 01             	add    $0x1,%eax
+  800941:	0f b6 10             	movzbl (%eax),%edx
+  800944:	84 d2                	test   %dl,%dl
+  800946:	74 06                	je     80094e <strchr+0x1c>
+		if (*s == c)
+  800948:	38 ca                	cmp    %cl,%dl
+  80094a:	75 f2                	jne    80093e <strchr+0xc>
+  80094c:	eb 05                	jmp    800953 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80094e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800953:	5d                   	pop    %ebp
+  800954:	c3                   	ret
+
+00800955 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800955:	55                   	push   %ebp
+  800956:	89 e5                	mov    %esp,%ebp
+  800958:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80095f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800962:	38 ca                	cmp    %cl,%dl
+  800964:	74 09                	je     80096f <strfind+0x1a>
+  800966:	84 d2                	test   %dl,%dl
+  800968:	74 05                	je     80096f <strfind+0x1a>
+	for (; *s; s++)
+  80096a:	83 c0 01             	add    $0x1,%eax
+  80096d:	eb f0                	jmp    80095f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80096f:	5d                   	pop    %ebp
+  800970:	c3                   	ret
+
+00800971 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800971:	55                   	push   %ebp
+  800972:	89 e5                	mov    %esp,%ebp
+  800974:	57                   	push   %edi
+  800975:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800978:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80097b:	85 c9                	test   %ecx,%ecx
+  80097d:	74 20                	je     80099f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80097f:	89 f8                	mov    %edi,%eax
+  800981:	09 c8                	or     %ecx,%eax
+  800983:	a8 03                	test   $0x3,%al
+  800985:	75 12                	jne    800999 <memset+0x28>
+		c &= 0xFF;
+  800987:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80098b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800991:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800994:	fc                   	cld
+  800995:	f3 ab                	rep stos %eax,%es:(%edi)
+  800997:	eb 06                	jmp    80099f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800999:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80099c:	fc                   	cld
+  80099d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80099f:	89 f8                	mov    %edi,%eax
+  8009a1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009a4:	c9                   	leave
+  8009a5:	c3                   	ret
+
+008009a6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009a6:	55                   	push   %ebp
+  8009a7:	89 e5                	mov    %esp,%ebp
+  8009a9:	57                   	push   %edi
+  8009aa:	56                   	push   %esi
+  8009ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ae:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009b1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009b4:	39 c6                	cmp    %eax,%esi
+  8009b6:	73 32                	jae    8009ea <memmove+0x44>
+  8009b8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009bb:	39 d0                	cmp    %edx,%eax
+  8009bd:	73 2b                	jae    8009ea <memmove+0x44>
+		s += n;
+		d += n;
+  8009bf:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009c2:	89 d6                	mov    %edx,%esi
+  8009c4:	09 fe                	or     %edi,%esi
+  8009c6:	09 ce                	or     %ecx,%esi
+  8009c8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009ce:	75 0e                	jne    8009de <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009d0:	83 ef 04             	sub    $0x4,%edi
+  8009d3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009d6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009d9:	fd                   	std
+  8009da:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009dc:	eb 09                	jmp    8009e7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009de:	83 ef 01             	sub    $0x1,%edi
+  8009e1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009e4:	fd                   	std
+  8009e5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009e7:	fc                   	cld
+  8009e8:	eb 1a                	jmp    800a04 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ea:	89 f2                	mov    %esi,%edx
+  8009ec:	09 c2                	or     %eax,%edx
+  8009ee:	09 ca                	or     %ecx,%edx
+  8009f0:	f6 c2 03             	test   $0x3,%dl
+  8009f3:	75 0a                	jne    8009ff <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009f5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009f8:	89 c7                	mov    %eax,%edi
+  8009fa:	fc                   	cld
+  8009fb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009fd:	eb 05                	jmp    800a04 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009ff:	89 c7                	mov    %eax,%edi
+  800a01:	fc                   	cld
+  800a02:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a04:	5e                   	pop    %esi
+  800a05:	5f                   	pop    %edi
+  800a06:	5d                   	pop    %ebp
+  800a07:	c3                   	ret
+
+00800a08 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a08:	55                   	push   %ebp
+  800a09:	89 e5                	mov    %esp,%ebp
+  800a0b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a0e:	ff 75 10             	push   0x10(%ebp)
+  800a11:	ff 75 0c             	push   0xc(%ebp)
+  800a14:	ff 75 08             	push   0x8(%ebp)
+  800a17:	e8 8a ff ff ff       	call   8009a6 <memmove>
+}
+  800a1c:	c9                   	leave
+  800a1d:	c3                   	ret
+
+00800a1e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a1e:	55                   	push   %ebp
+  800a1f:	89 e5                	mov    %esp,%ebp
+  800a21:	56                   	push   %esi
+  800a22:	53                   	push   %ebx
+  800a23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a26:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a29:	89 c6                	mov    %eax,%esi
+  800a2b:	03 75 10             	add    0x10(%ebp),%esi
+  800a2e:	eb 06                	jmp    800a36 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a30:	83 c0 01             	add    $0x1,%eax
+  800a33:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a36:	39 f0                	cmp    %esi,%eax
+  800a38:	74 14                	je     800a4e <memcmp+0x30>
+		if (*s1 != *s2)
+  800a3a:	0f b6 08             	movzbl (%eax),%ecx
+  800a3d:	0f b6 1a             	movzbl (%edx),%ebx
+  800a40:	38 d9                	cmp    %bl,%cl
+  800a42:	74 ec                	je     800a30 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a44:	0f b6 c1             	movzbl %cl,%eax
+  800a47:	0f b6 db             	movzbl %bl,%ebx
+  800a4a:	29 d8                	sub    %ebx,%eax
+  800a4c:	eb 05                	jmp    800a53 <memcmp+0x35>
+	}
+
+	return 0;
+  800a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a53:	5b                   	pop    %ebx
+  800a54:	5e                   	pop    %esi
+  800a55:	5d                   	pop    %ebp
+  800a56:	c3                   	ret
+
+00800a57 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a57:	55                   	push   %ebp
+  800a58:	89 e5                	mov    %esp,%ebp
+  800a5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a60:	89 c2                	mov    %eax,%edx
+  800a62:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a65:	eb 03                	jmp    800a6a <memfind+0x13>
+  800a67:	83 c0 01             	add    $0x1,%eax
+  800a6a:	39 d0                	cmp    %edx,%eax
+  800a6c:	73 04                	jae    800a72 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a6e:	38 08                	cmp    %cl,(%eax)
+  800a70:	75 f5                	jne    800a67 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a72:	5d                   	pop    %ebp
+  800a73:	c3                   	ret
+
+00800a74 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a74:	55                   	push   %ebp
+  800a75:	89 e5                	mov    %esp,%ebp
+  800a77:	57                   	push   %edi
+  800a78:	56                   	push   %esi
+  800a79:	53                   	push   %ebx
+  800a7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a7d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a80:	eb 03                	jmp    800a85 <strtol+0x11>
+		s++;
+  800a82:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a85:	0f b6 02             	movzbl (%edx),%eax
+  800a88:	3c 20                	cmp    $0x20,%al
+  800a8a:	74 f6                	je     800a82 <strtol+0xe>
+  800a8c:	3c 09                	cmp    $0x9,%al
+  800a8e:	74 f2                	je     800a82 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a90:	3c 2b                	cmp    $0x2b,%al
+  800a92:	74 2a                	je     800abe <strtol+0x4a>
+	int neg = 0;
+  800a94:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a99:	3c 2d                	cmp    $0x2d,%al
+  800a9b:	74 2b                	je     800ac8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a9d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800aa3:	75 0f                	jne    800ab4 <strtol+0x40>
+  800aa5:	80 3a 30             	cmpb   $0x30,(%edx)
+  800aa8:	74 28                	je     800ad2 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800aaa:	85 db                	test   %ebx,%ebx
+  800aac:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ab1:	0f 44 d8             	cmove  %eax,%ebx
+  800ab4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ab9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800abc:	eb 46                	jmp    800b04 <strtol+0x90>
+		s++;
+  800abe:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ac1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ac6:	eb d5                	jmp    800a9d <strtol+0x29>
+		s++, neg = 1;
+  800ac8:	83 c2 01             	add    $0x1,%edx
+  800acb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ad0:	eb cb                	jmp    800a9d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ad2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ad6:	74 0e                	je     800ae6 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ad8:	85 db                	test   %ebx,%ebx
+  800ada:	75 d8                	jne    800ab4 <strtol+0x40>
+		s++, base = 8;
+  800adc:	83 c2 01             	add    $0x1,%edx
+  800adf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ae4:	eb ce                	jmp    800ab4 <strtol+0x40>
+		s += 2, base = 16;
+  800ae6:	83 c2 02             	add    $0x2,%edx
+  800ae9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800aee:	eb c4                	jmp    800ab4 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800af0:	0f be c0             	movsbl %al,%eax
+  800af3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800af6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800af9:	7d 3a                	jge    800b35 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800afb:	83 c2 01             	add    $0x1,%edx
+  800afe:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b02:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b04:	0f b6 02             	movzbl (%edx),%eax
+  800b07:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b0a:	89 f3                	mov    %esi,%ebx
+  800b0c:	80 fb 09             	cmp    $0x9,%bl
+  800b0f:	76 df                	jbe    800af0 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b11:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b14:	89 f3                	mov    %esi,%ebx
+  800b16:	80 fb 19             	cmp    $0x19,%bl
+  800b19:	77 08                	ja     800b23 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b1b:	0f be c0             	movsbl %al,%eax
+  800b1e:	83 e8 57             	sub    $0x57,%eax
+  800b21:	eb d3                	jmp    800af6 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b23:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b26:	89 f3                	mov    %esi,%ebx
+  800b28:	80 fb 19             	cmp    $0x19,%bl
+  800b2b:	77 08                	ja     800b35 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b2d:	0f be c0             	movsbl %al,%eax
+  800b30:	83 e8 37             	sub    $0x37,%eax
+  800b33:	eb c1                	jmp    800af6 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b35:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b39:	74 05                	je     800b40 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b3b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b3e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b40:	89 c8                	mov    %ecx,%eax
+  800b42:	f7 d8                	neg    %eax
+  800b44:	85 ff                	test   %edi,%edi
+  800b46:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b49:	89 c8                	mov    %ecx,%eax
+  800b4b:	5b                   	pop    %ebx
+  800b4c:	5e                   	pop    %esi
+  800b4d:	5f                   	pop    %edi
+  800b4e:	5d                   	pop    %ebp
+  800b4f:	c3                   	ret
+
+00800b50 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b50:	55                   	push   %ebp
+  800b51:	89 e5                	mov    %esp,%ebp
+  800b53:	57                   	push   %edi
+  800b54:	56                   	push   %esi
+  800b55:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b61:	89 c3                	mov    %eax,%ebx
+  800b63:	89 c7                	mov    %eax,%edi
+  800b65:	55                   	push   %ebp
+  800b66:	89 e5                	mov    %esp,%ebp
+  800b68:	8d 35 70 0b 80 00    	lea    0x800b70,%esi
+  800b6e:	0f 34                	sysenter
+  800b70:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800b71:	5b                   	pop    %ebx
+  800b72:	5e                   	pop    %esi
+  800b73:	5f                   	pop    %edi
+  800b74:	5d                   	pop    %ebp
+  800b75:	c3                   	ret
+
+00800b76 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b76:	55                   	push   %ebp
+  800b77:	89 e5                	mov    %esp,%ebp
+  800b79:	57                   	push   %edi
+  800b7a:	56                   	push   %esi
+  800b7b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b81:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b86:	89 d1                	mov    %edx,%ecx
+  800b88:	89 d3                	mov    %edx,%ebx
+  800b8a:	89 d7                	mov    %edx,%edi
+  800b8c:	55                   	push   %ebp
+  800b8d:	89 e5                	mov    %esp,%ebp
+  800b8f:	8d 35 97 0b 80 00    	lea    0x800b97,%esi
+  800b95:	0f 34                	sysenter
+  800b97:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800b98:	5b                   	pop    %ebx
+  800b99:	5e                   	pop    %esi
+  800b9a:	5f                   	pop    %edi
+  800b9b:	5d                   	pop    %ebp
+  800b9c:	c3                   	ret
+
+00800b9d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b9d:	55                   	push   %ebp
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	57                   	push   %edi
+  800ba1:	56                   	push   %esi
+  800ba2:	53                   	push   %ebx
+  800ba3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ba6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bae:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bb3:	89 cb                	mov    %ecx,%ebx
+  800bb5:	89 cf                	mov    %ecx,%edi
+  800bb7:	55                   	push   %ebp
+  800bb8:	89 e5                	mov    %esp,%ebp
+  800bba:	8d 35 c2 0b 80 00    	lea    0x800bc2,%esi
+  800bc0:	0f 34                	sysenter
+  800bc2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bc3:	85 c0                	test   %eax,%eax
+  800bc5:	7f 08                	jg     800bcf <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800bc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bca:	5b                   	pop    %ebx
+  800bcb:	5e                   	pop    %esi
+  800bcc:	5f                   	pop    %edi
+  800bcd:	5d                   	pop    %ebp
+  800bce:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bcf:	83 ec 0c             	sub    $0xc,%esp
+  800bd2:	50                   	push   %eax
+  800bd3:	6a 03                	push   $0x3
+  800bd5:	68 87 3b 80 00       	push   $0x803b87
+  800bda:	6a 3d                	push   $0x3d
+  800bdc:	68 a4 3b 80 00       	push   $0x803ba4
+  800be1:	e8 71 f5 ff ff       	call   800157 <_panic>
+
+00800be6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800be6:	55                   	push   %ebp
+  800be7:	89 e5                	mov    %esp,%ebp
+  800be9:	57                   	push   %edi
+  800bea:	56                   	push   %esi
+  800beb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800bec:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf1:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bf6:	89 d1                	mov    %edx,%ecx
+  800bf8:	89 d3                	mov    %edx,%ebx
+  800bfa:	89 d7                	mov    %edx,%edi
+  800bfc:	55                   	push   %ebp
+  800bfd:	89 e5                	mov    %esp,%ebp
+  800bff:	8d 35 07 0c 80 00    	lea    0x800c07,%esi
+  800c05:	0f 34                	sysenter
+  800c07:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800c08:	5b                   	pop    %ebx
+  800c09:	5e                   	pop    %esi
+  800c0a:	5f                   	pop    %edi
+  800c0b:	5d                   	pop    %ebp
+  800c0c:	c3                   	ret
+
+00800c0d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c0d:	55                   	push   %ebp
+  800c0e:	89 e5                	mov    %esp,%ebp
+  800c10:	57                   	push   %edi
+  800c11:	56                   	push   %esi
+  800c12:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c13:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c18:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c1d:	89 d1                	mov    %edx,%ecx
+  800c1f:	89 d3                	mov    %edx,%ebx
+  800c21:	89 d7                	mov    %edx,%edi
+  800c23:	89 d6                	mov    %edx,%esi
+  800c25:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c27:	5b                   	pop    %ebx
+  800c28:	5e                   	pop    %esi
+  800c29:	5f                   	pop    %edi
+  800c2a:	5d                   	pop    %ebp
+  800c2b:	c3                   	ret
+
+00800c2c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c2c:	55                   	push   %ebp
+  800c2d:	89 e5                	mov    %esp,%ebp
+  800c2f:	57                   	push   %edi
+  800c30:	56                   	push   %esi
+  800c31:	53                   	push   %ebx
+  800c32:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c40:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c48:	55                   	push   %ebp
+  800c49:	89 e5                	mov    %esp,%ebp
+  800c4b:	8d 35 53 0c 80 00    	lea    0x800c53,%esi
+  800c51:	0f 34                	sysenter
+  800c53:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c54:	85 c0                	test   %eax,%eax
+  800c56:	7f 08                	jg     800c60 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800c58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c5b:	5b                   	pop    %ebx
+  800c5c:	5e                   	pop    %esi
+  800c5d:	5f                   	pop    %edi
+  800c5e:	5d                   	pop    %ebp
+  800c5f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c60:	83 ec 0c             	sub    $0xc,%esp
+  800c63:	50                   	push   %eax
+  800c64:	6a 04                	push   $0x4
+  800c66:	68 87 3b 80 00       	push   $0x803b87
+  800c6b:	6a 3d                	push   $0x3d
+  800c6d:	68 a4 3b 80 00       	push   $0x803ba4
+  800c72:	e8 e0 f4 ff ff       	call   800157 <_panic>
+
+00800c77 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c77:	55                   	push   %ebp
+  800c78:	89 e5                	mov    %esp,%ebp
+  800c7a:	57                   	push   %edi
+  800c7b:	56                   	push   %esi
+  800c7c:	53                   	push   %ebx
+  800c7d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c86:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c8b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c8e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c91:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c94:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c96:	85 c0                	test   %eax,%eax
+  800c98:	7f 08                	jg     800ca2 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9d:	5b                   	pop    %ebx
+  800c9e:	5e                   	pop    %esi
+  800c9f:	5f                   	pop    %edi
+  800ca0:	5d                   	pop    %ebp
+  800ca1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca2:	83 ec 0c             	sub    $0xc,%esp
+  800ca5:	50                   	push   %eax
+  800ca6:	6a 05                	push   $0x5
+  800ca8:	68 87 3b 80 00       	push   $0x803b87
+  800cad:	6a 23                	push   $0x23
+  800caf:	68 a4 3b 80 00       	push   $0x803ba4
+  800cb4:	e8 9e f4 ff ff       	call   800157 <_panic>
+
+00800cb9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cb9:	55                   	push   %ebp
+  800cba:	89 e5                	mov    %esp,%ebp
+  800cbc:	57                   	push   %edi
+  800cbd:	56                   	push   %esi
+  800cbe:	53                   	push   %ebx
+  800cbf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ccd:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cd2:	89 df                	mov    %ebx,%edi
+  800cd4:	55                   	push   %ebp
+  800cd5:	89 e5                	mov    %esp,%ebp
+  800cd7:	8d 35 df 0c 80 00    	lea    0x800cdf,%esi
+  800cdd:	0f 34                	sysenter
+  800cdf:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ce0:	85 c0                	test   %eax,%eax
+  800ce2:	7f 08                	jg     800cec <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800ce4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce7:	5b                   	pop    %ebx
+  800ce8:	5e                   	pop    %esi
+  800ce9:	5f                   	pop    %edi
+  800cea:	5d                   	pop    %ebp
+  800ceb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cec:	83 ec 0c             	sub    $0xc,%esp
+  800cef:	50                   	push   %eax
+  800cf0:	6a 06                	push   $0x6
+  800cf2:	68 87 3b 80 00       	push   $0x803b87
+  800cf7:	6a 3d                	push   $0x3d
+  800cf9:	68 a4 3b 80 00       	push   $0x803ba4
+  800cfe:	e8 54 f4 ff ff       	call   800157 <_panic>
+
+00800d03 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d03:	55                   	push   %ebp
+  800d04:	89 e5                	mov    %esp,%ebp
+  800d06:	57                   	push   %edi
+  800d07:	56                   	push   %esi
+  800d08:	53                   	push   %ebx
+  800d09:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d11:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d17:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d1c:	89 df                	mov    %ebx,%edi
+  800d1e:	55                   	push   %ebp
+  800d1f:	89 e5                	mov    %esp,%ebp
+  800d21:	8d 35 29 0d 80 00    	lea    0x800d29,%esi
+  800d27:	0f 34                	sysenter
+  800d29:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d2a:	85 c0                	test   %eax,%eax
+  800d2c:	7f 08                	jg     800d36 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800d2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d31:	5b                   	pop    %ebx
+  800d32:	5e                   	pop    %esi
+  800d33:	5f                   	pop    %edi
+  800d34:	5d                   	pop    %ebp
+  800d35:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d36:	83 ec 0c             	sub    $0xc,%esp
+  800d39:	50                   	push   %eax
+  800d3a:	6a 08                	push   $0x8
+  800d3c:	68 87 3b 80 00       	push   $0x803b87
+  800d41:	6a 3d                	push   $0x3d
+  800d43:	68 a4 3b 80 00       	push   $0x803ba4
+  800d48:	e8 0a f4 ff ff       	call   800157 <_panic>
+
+00800d4d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d4d:	55                   	push   %ebp
+  800d4e:	89 e5                	mov    %esp,%ebp
+  800d50:	57                   	push   %edi
+  800d51:	56                   	push   %esi
+  800d52:	53                   	push   %ebx
+  800d53:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d61:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d66:	89 df                	mov    %ebx,%edi
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	8d 35 73 0d 80 00    	lea    0x800d73,%esi
+  800d71:	0f 34                	sysenter
+  800d73:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d74:	85 c0                	test   %eax,%eax
+  800d76:	7f 08                	jg     800d80 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800d78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d7b:	5b                   	pop    %ebx
+  800d7c:	5e                   	pop    %esi
+  800d7d:	5f                   	pop    %edi
+  800d7e:	5d                   	pop    %ebp
+  800d7f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d80:	83 ec 0c             	sub    $0xc,%esp
+  800d83:	50                   	push   %eax
+  800d84:	6a 09                	push   $0x9
+  800d86:	68 87 3b 80 00       	push   $0x803b87
+  800d8b:	6a 3d                	push   $0x3d
+  800d8d:	68 a4 3b 80 00       	push   $0x803ba4
+  800d92:	e8 c0 f3 ff ff       	call   800157 <_panic>
+
+00800d97 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d97:	55                   	push   %ebp
+  800d98:	89 e5                	mov    %esp,%ebp
+  800d9a:	57                   	push   %edi
+  800d9b:	56                   	push   %esi
+  800d9c:	53                   	push   %ebx
+  800d9d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800da0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800da5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dab:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800db0:	89 df                	mov    %ebx,%edi
+  800db2:	55                   	push   %ebp
+  800db3:	89 e5                	mov    %esp,%ebp
+  800db5:	8d 35 bd 0d 80 00    	lea    0x800dbd,%esi
+  800dbb:	0f 34                	sysenter
+  800dbd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800dbe:	85 c0                	test   %eax,%eax
+  800dc0:	7f 08                	jg     800dca <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800dc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc5:	5b                   	pop    %ebx
+  800dc6:	5e                   	pop    %esi
+  800dc7:	5f                   	pop    %edi
+  800dc8:	5d                   	pop    %ebp
+  800dc9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dca:	83 ec 0c             	sub    $0xc,%esp
+  800dcd:	50                   	push   %eax
+  800dce:	6a 0a                	push   $0xa
+  800dd0:	68 87 3b 80 00       	push   $0x803b87
+  800dd5:	6a 3d                	push   $0x3d
+  800dd7:	68 a4 3b 80 00       	push   $0x803ba4
+  800ddc:	e8 76 f3 ff ff       	call   800157 <_panic>
+
+00800de1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800de1:	55                   	push   %ebp
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	57                   	push   %edi
+  800de5:	56                   	push   %esi
+  800de6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800de7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ded:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800df2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800df8:	55                   	push   %ebp
+  800df9:	89 e5                	mov    %esp,%ebp
+  800dfb:	8d 35 03 0e 80 00    	lea    0x800e03,%esi
+  800e01:	0f 34                	sysenter
+  800e03:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800e04:	5b                   	pop    %ebx
+  800e05:	5e                   	pop    %esi
+  800e06:	5f                   	pop    %edi
+  800e07:	5d                   	pop    %ebp
+  800e08:	c3                   	ret
+
+00800e09 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800e09:	55                   	push   %ebp
+  800e0a:	89 e5                	mov    %esp,%ebp
+  800e0c:	57                   	push   %edi
+  800e0d:	56                   	push   %esi
+  800e0e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e15:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e1a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e1d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e20:	55                   	push   %ebp
+  800e21:	89 e5                	mov    %esp,%ebp
+  800e23:	8d 35 2b 0e 80 00    	lea    0x800e2b,%esi
+  800e29:	0f 34                	sysenter
+  800e2b:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800e2c:	5b                   	pop    %ebx
+  800e2d:	5e                   	pop    %esi
+  800e2e:	5f                   	pop    %edi
+  800e2f:	5d                   	pop    %ebp
+  800e30:	c3                   	ret
+
+00800e31 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	57                   	push   %edi
+  800e35:	56                   	push   %esi
+  800e36:	53                   	push   %ebx
+  800e37:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e3a:	be 00 00 00 00       	mov    $0x0,%esi
+  800e3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e42:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e45:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4d:	89 f7                	mov    %esi,%edi
+  800e4f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e51:	85 c0                	test   %eax,%eax
+  800e53:	7f 08                	jg     800e5d <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800e55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5f                   	pop    %edi
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5d:	83 ec 0c             	sub    $0xc,%esp
+  800e60:	50                   	push   %eax
+  800e61:	6a 0d                	push   $0xd
+  800e63:	68 87 3b 80 00       	push   $0x803b87
+  800e68:	6a 23                	push   $0x23
+  800e6a:	68 a4 3b 80 00       	push   $0x803ba4
+  800e6f:	e8 e3 f2 ff ff       	call   800157 <_panic>
+
+00800e74 <sys_ipc_recv>:
+{
+  800e74:	55                   	push   %ebp
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800e7a:	6a 00                	push   $0x0
+  800e7c:	6a 01                	push   $0x1
+  800e7e:	ff 75 08             	push   0x8(%ebp)
+  800e81:	e8 ab ff ff ff       	call   800e31 <sys_ipc_recvv>
+}
+  800e86:	c9                   	leave
+  800e87:	c3                   	ret
+
+00800e88 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800e88:	55                   	push   %ebp
+  800e89:	89 e5                	mov    %esp,%ebp
+  800e8b:	57                   	push   %edi
+  800e8c:	56                   	push   %esi
+  800e8d:	53                   	push   %ebx
+  800e8e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ea1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800ea4:	89 de                	mov    %ebx,%esi
+  800ea6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea8:	85 c0                	test   %eax,%eax
+  800eaa:	7f 08                	jg     800eb4 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800eac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eaf:	5b                   	pop    %ebx
+  800eb0:	5e                   	pop    %esi
+  800eb1:	5f                   	pop    %edi
+  800eb2:	5d                   	pop    %ebp
+  800eb3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb4:	83 ec 0c             	sub    $0xc,%esp
+  800eb7:	50                   	push   %eax
+  800eb8:	6a 0d                	push   $0xd
+  800eba:	68 87 3b 80 00       	push   $0x803b87
+  800ebf:	6a 23                	push   $0x23
+  800ec1:	68 a4 3b 80 00       	push   $0x803ba4
+  800ec6:	e8 8c f2 ff ff       	call   800157 <_panic>
+
+00800ecb <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ecb:	55                   	push   %ebp
+  800ecc:	89 e5                	mov    %esp,%ebp
+  800ece:	57                   	push   %edi
+  800ecf:	56                   	push   %esi
+  800ed0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ed1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800edb:	89 d1                	mov    %edx,%ecx
+  800edd:	89 d3                	mov    %edx,%ebx
+  800edf:	89 d7                	mov    %edx,%edi
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	8d 35 ec 0e 80 00    	lea    0x800eec,%esi
+  800eea:	0f 34                	sysenter
+  800eec:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800eed:	5b                   	pop    %ebx
+  800eee:	5e                   	pop    %esi
+  800eef:	5f                   	pop    %edi
+  800ef0:	5d                   	pop    %ebp
+  800ef1:	c3                   	ret
+
+00800ef2 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800ef2:	55                   	push   %ebp
+  800ef3:	89 e5                	mov    %esp,%ebp
+  800ef5:	57                   	push   %edi
+  800ef6:	56                   	push   %esi
+  800ef7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ef8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f03:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f08:	89 df                	mov    %ebx,%edi
+  800f0a:	55                   	push   %ebp
+  800f0b:	89 e5                	mov    %esp,%ebp
+  800f0d:	8d 35 15 0f 80 00    	lea    0x800f15,%esi
+  800f13:	0f 34                	sysenter
+  800f15:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800f16:	5b                   	pop    %ebx
+  800f17:	5e                   	pop    %esi
+  800f18:	5f                   	pop    %edi
+  800f19:	5d                   	pop    %ebp
+  800f1a:	c3                   	ret
+
+00800f1b <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800f1b:	55                   	push   %ebp
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	57                   	push   %edi
+  800f1f:	56                   	push   %esi
+  800f20:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f29:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f2e:	89 cb                	mov    %ecx,%ebx
+  800f30:	89 cf                	mov    %ecx,%edi
+  800f32:	55                   	push   %ebp
+  800f33:	89 e5                	mov    %esp,%ebp
+  800f35:	8d 35 3d 0f 80 00    	lea    0x800f3d,%esi
+  800f3b:	0f 34                	sysenter
+  800f3d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800f3e:	5b                   	pop    %ebx
+  800f3f:	5e                   	pop    %esi
+  800f40:	5f                   	pop    %edi
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+
+00800f43 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800f43:	55                   	push   %ebp
+  800f44:	89 e5                	mov    %esp,%ebp
+  800f46:	57                   	push   %edi
+  800f47:	56                   	push   %esi
+  800f48:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f54:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f59:	89 df                	mov    %ebx,%edi
+  800f5b:	55                   	push   %ebp
+  800f5c:	89 e5                	mov    %esp,%ebp
+  800f5e:	8d 35 66 0f 80 00    	lea    0x800f66,%esi
+  800f64:	0f 34                	sysenter
+  800f66:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800f67:	5b                   	pop    %ebx
+  800f68:	5e                   	pop    %esi
+  800f69:	5f                   	pop    %edi
+  800f6a:	5d                   	pop    %ebp
+  800f6b:	c3                   	ret
+
+00800f6c <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800f6c:	55                   	push   %ebp
+  800f6d:	89 e5                	mov    %esp,%ebp
+  800f6f:	57                   	push   %edi
+  800f70:	56                   	push   %esi
+  800f71:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7d:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f82:	89 df                	mov    %ebx,%edi
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	8d 35 8f 0f 80 00    	lea    0x800f8f,%esi
+  800f8d:	0f 34                	sysenter
+  800f8f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800f90:	5b                   	pop    %ebx
+  800f91:	5e                   	pop    %esi
+  800f92:	5f                   	pop    %edi
+  800f93:	5d                   	pop    %ebp
+  800f94:	c3                   	ret
+
+00800f95 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800f95:	55                   	push   %ebp
+  800f96:	89 e5                	mov    %esp,%ebp
+  800f98:	57                   	push   %edi
+  800f99:	56                   	push   %esi
+  800f9a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa1:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fa6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fac:	55                   	push   %ebp
+  800fad:	89 e5                	mov    %esp,%ebp
+  800faf:	8d 35 b7 0f 80 00    	lea    0x800fb7,%esi
+  800fb5:	0f 34                	sysenter
+  800fb7:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800fb8:	5b                   	pop    %ebx
+  800fb9:	5e                   	pop    %esi
+  800fba:	5f                   	pop    %edi
+  800fbb:	5d                   	pop    %ebp
+  800fbc:	c3                   	ret
+
+00800fbd <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	57                   	push   %edi
+  800fc1:	56                   	push   %esi
+  800fc2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcb:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fd0:	89 cb                	mov    %ecx,%ebx
+  800fd2:	89 cf                	mov    %ecx,%edi
+  800fd4:	89 ce                	mov    %ecx,%esi
+  800fd6:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800fd8:	5b                   	pop    %ebx
+  800fd9:	5e                   	pop    %esi
+  800fda:	5f                   	pop    %edi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	c3                   	ret
+
+00800fdd <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	57                   	push   %edi
+  800fe1:	56                   	push   %esi
+  800fe2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fe3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800feb:	b8 15 00 00 00       	mov    $0x15,%eax
+  800ff0:	89 cb                	mov    %ecx,%ebx
+  800ff2:	89 cf                	mov    %ecx,%edi
+  800ff4:	55                   	push   %ebp
+  800ff5:	89 e5                	mov    %esp,%ebp
+  800ff7:	8d 35 ff 0f 80 00    	lea    0x800fff,%esi
+  800ffd:	0f 34                	sysenter
+  800fff:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  801000:	5b                   	pop    %ebx
+  801001:	5e                   	pop    %esi
+  801002:	5f                   	pop    %edi
+  801003:	5d                   	pop    %ebp
+  801004:	c3                   	ret
+
+00801005 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  801005:	55                   	push   %ebp
+  801006:	89 e5                	mov    %esp,%ebp
+  801008:	57                   	push   %edi
+  801009:	56                   	push   %esi
+  80100a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80100b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801010:	8b 55 08             	mov    0x8(%ebp),%edx
+  801013:	b8 16 00 00 00       	mov    $0x16,%eax
+  801018:	89 cb                	mov    %ecx,%ebx
+  80101a:	89 cf                	mov    %ecx,%edi
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	8d 35 27 10 80 00    	lea    0x801027,%esi
+  801025:	0f 34                	sysenter
+  801027:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  801028:	5b                   	pop    %ebx
+  801029:	5e                   	pop    %esi
+  80102a:	5f                   	pop    %edi
+  80102b:	5d                   	pop    %ebp
+  80102c:	c3                   	ret
+
+0080102d <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  80102d:	55                   	push   %ebp
+  80102e:	89 e5                	mov    %esp,%ebp
+  801030:	57                   	push   %edi
+  801031:	56                   	push   %esi
+  801032:	53                   	push   %ebx
+  801033:	83 ec 20             	sub    $0x20,%esp
+  801036:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801039:	89 d7                	mov    %edx,%edi
+  80103b:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  80103d:	51                   	push   %ecx
+  80103e:	68 00 f0 7f 00       	push   $0x7ff000
+  801043:	6a 00                	push   $0x0
+  801045:	e8 e2 fb ff ff       	call   800c2c <sys_page_alloc>
+  80104a:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80104c:	83 c4 10             	add    $0x10,%esp
+  80104f:	85 c0                	test   %eax,%eax
+  801051:	78 45                	js     801098 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  801053:	83 ec 04             	sub    $0x4,%esp
+  801056:	68 00 10 00 00       	push   $0x1000
+  80105b:	57                   	push   %edi
+  80105c:	68 00 f0 7f 00       	push   $0x7ff000
+  801061:	e8 40 f9 ff ff       	call   8009a6 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  801066:	89 34 24             	mov    %esi,(%esp)
+  801069:	57                   	push   %edi
+  80106a:	ff 75 e4             	push   -0x1c(%ebp)
+  80106d:	68 00 f0 7f 00       	push   $0x7ff000
+  801072:	6a 00                	push   $0x0
+  801074:	e8 fe fb ff ff       	call   800c77 <sys_page_map>
+  801079:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80107b:	83 c4 20             	add    $0x20,%esp
+  80107e:	85 c0                	test   %eax,%eax
+  801080:	78 16                	js     801098 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801082:	83 ec 08             	sub    $0x8,%esp
+  801085:	68 00 f0 7f 00       	push   $0x7ff000
+  80108a:	6a 00                	push   $0x0
+  80108c:	e8 28 fc ff ff       	call   800cb9 <sys_page_unmap>
+  801091:	83 c4 10             	add    $0x10,%esp
+  801094:	85 c0                	test   %eax,%eax
+  801096:	75 0a                	jne    8010a2 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  801098:	89 d8                	mov    %ebx,%eax
+  80109a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109d:	5b                   	pop    %ebx
+  80109e:	5e                   	pop    %esi
+  80109f:	5f                   	pop    %edi
+  8010a0:	5d                   	pop    %ebp
+  8010a1:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8010a2:	68 b4 3b 80 00       	push   $0x803bb4
+  8010a7:	68 2c 3c 80 00       	push   $0x803c2c
+  8010ac:	6a 1b                	push   $0x1b
+  8010ae:	68 41 3c 80 00       	push   $0x803c41
+  8010b3:	e8 9f f0 ff ff       	call   800157 <_panic>
+
+008010b8 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8010b8:	55                   	push   %ebp
+  8010b9:	89 e5                	mov    %esp,%ebp
+  8010bb:	53                   	push   %ebx
+  8010bc:	83 ec 04             	sub    $0x4,%esp
+  8010bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8010c2:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8010c4:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  8010c8:	74 21                	je     8010eb <pgfault+0x33>
+  8010ca:	89 d0                	mov    %edx,%eax
+  8010cc:	c1 e8 16             	shr    $0x16,%eax
+  8010cf:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8010d6:	a8 01                	test   $0x1,%al
+  8010d8:	74 11                	je     8010eb <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  8010da:	89 d0                	mov    %edx,%eax
+  8010dc:	c1 e8 0c             	shr    $0xc,%eax
+  8010df:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010e6:	f6 c4 08             	test   $0x8,%ah
+  8010e9:	75 17                	jne    801102 <pgfault+0x4a>
+		if (pgfault_next) {
+  8010eb:	a1 04 50 80 00       	mov    0x805004,%eax
+  8010f0:	85 c0                	test   %eax,%eax
+  8010f2:	74 27                	je     80111b <pgfault+0x63>
+			pgfault_next(utf);
+  8010f4:	83 ec 0c             	sub    $0xc,%esp
+  8010f7:	53                   	push   %ebx
+  8010f8:	ff d0                	call   *%eax
+			return;
+  8010fa:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8010fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801100:	c9                   	leave
+  801101:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  801102:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  801108:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80110d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801112:	e8 16 ff ff ff       	call   80102d <copy_page_to>
+  801117:	85 c0                	test   %eax,%eax
+  801119:	79 e2                	jns    8010fd <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  80111b:	a1 00 50 80 00       	mov    0x805000,%eax
+  801120:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  801123:	ff 73 28             	push   0x28(%ebx)
+  801126:	ff 33                	push   (%ebx)
+  801128:	50                   	push   %eax
+  801129:	68 d8 3b 80 00       	push   $0x803bd8
+  80112e:	e8 ff f0 ff ff       	call   800232 <cprintf>
+	sys_env_destroy(0);
+  801133:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80113a:	e8 5e fa ff ff       	call   800b9d <sys_env_destroy>
+  80113f:	83 c4 10             	add    $0x10,%esp
+  801142:	eb b9                	jmp    8010fd <pgfault+0x45>
+
+00801144 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  801144:	55                   	push   %ebp
+  801145:	89 e5                	mov    %esp,%ebp
+  801147:	53                   	push   %ebx
+  801148:	83 ec 04             	sub    $0x4,%esp
+  80114b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80114e:	a1 04 90 80 00       	mov    0x809004,%eax
+  801153:	3d b8 10 80 00       	cmp    $0x8010b8,%eax
+  801158:	74 15                	je     80116f <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80115a:	a3 04 50 80 00       	mov    %eax,0x805004
+		set_pgfault_handler(pgfault);
+  80115f:	83 ec 0c             	sub    $0xc,%esp
+  801162:	68 b8 10 80 00       	push   $0x8010b8
+  801167:	e8 74 23 00 00       	call   8034e0 <set_pgfault_handler>
+  80116c:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80116f:	83 ec 0c             	sub    $0xc,%esp
+  801172:	68 05 08 00 00       	push   $0x805
+  801177:	53                   	push   %ebx
+  801178:	6a 00                	push   $0x0
+  80117a:	53                   	push   %ebx
+  80117b:	6a 00                	push   $0x0
+  80117d:	e8 f5 fa ff ff       	call   800c77 <sys_page_map>
+}
+  801182:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801185:	c9                   	leave
+  801186:	c3                   	ret
+
+00801187 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801187:	55                   	push   %ebp
+  801188:	89 e5                	mov    %esp,%ebp
+  80118a:	57                   	push   %edi
+  80118b:	56                   	push   %esi
+  80118c:	53                   	push   %ebx
+  80118d:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801190:	68 b8 10 80 00       	push   $0x8010b8
+  801195:	e8 46 23 00 00       	call   8034e0 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80119a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80119f:	cd 30                	int    $0x30
+  8011a1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8011a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8011a7:	83 c4 10             	add    $0x10,%esp
+  8011aa:	85 c0                	test   %eax,%eax
+  8011ac:	0f 88 6b 01 00 00    	js     80131d <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8011b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8011b7:	75 37                	jne    8011f0 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8011b9:	e8 28 fa ff ff       	call   800be6 <sys_getenvid>
+  8011be:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8011c3:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8011c9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8011ce:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8011d3:	e9 45 01 00 00       	jmp    80131d <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8011d8:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8011de:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8011e4:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011ea:	0f 87 ba 00 00 00    	ja     8012aa <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8011f0:	89 d8                	mov    %ebx,%eax
+  8011f2:	c1 e8 16             	shr    $0x16,%eax
+  8011f5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8011fc:	a8 01                	test   $0x1,%al
+  8011fe:	74 d8                	je     8011d8 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  801200:	89 d8                	mov    %ebx,%eax
+  801202:	c1 e8 0c             	shr    $0xc,%eax
+  801205:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80120c:	f6 c2 01             	test   $0x1,%dl
+  80120f:	74 cd                	je     8011de <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  801211:	89 da                	mov    %ebx,%edx
+  801213:	80 e6 df             	and    $0xdf,%dh
+  801216:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  80121c:	74 c0                	je     8011de <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  80121e:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801220:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801227:	f6 c6 04             	test   $0x4,%dh
+  80122a:	75 53                	jne    80127f <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80122c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801233:	f6 c6 08             	test   $0x8,%dh
+  801236:	75 0c                	jne    801244 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  801238:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80123f:	f6 c2 02             	test   $0x2,%dl
+  801242:	74 3b                	je     80127f <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  801244:	83 ec 0c             	sub    $0xc,%esp
+  801247:	68 05 08 00 00       	push   $0x805
+  80124c:	57                   	push   %edi
+  80124d:	ff 75 e4             	push   -0x1c(%ebp)
+  801250:	57                   	push   %edi
+  801251:	6a 00                	push   $0x0
+  801253:	e8 1f fa ff ff       	call   800c77 <sys_page_map>
+  801258:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80125a:	83 c4 20             	add    $0x20,%esp
+  80125d:	85 c0                	test   %eax,%eax
+  80125f:	0f 88 a7 00 00 00    	js     80130c <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801265:	83 ec 0c             	sub    $0xc,%esp
+  801268:	68 05 08 00 00       	push   $0x805
+  80126d:	57                   	push   %edi
+  80126e:	6a 00                	push   $0x0
+  801270:	57                   	push   %edi
+  801271:	6a 00                	push   $0x0
+  801273:	e8 ff f9 ff ff       	call   800c77 <sys_page_map>
+  801278:	89 c6                	mov    %eax,%esi
+	return r;
+  80127a:	83 c4 20             	add    $0x20,%esp
+  80127d:	eb 21                	jmp    8012a0 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  80127f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801286:	83 ec 0c             	sub    $0xc,%esp
+  801289:	25 07 0e 00 00       	and    $0xe07,%eax
+  80128e:	50                   	push   %eax
+  80128f:	57                   	push   %edi
+  801290:	ff 75 e4             	push   -0x1c(%ebp)
+  801293:	57                   	push   %edi
+  801294:	6a 00                	push   $0x0
+  801296:	e8 dc f9 ff ff       	call   800c77 <sys_page_map>
+  80129b:	89 c6                	mov    %eax,%esi
+  80129d:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8012a0:	85 f6                	test   %esi,%esi
+  8012a2:	0f 89 36 ff ff ff    	jns    8011de <fork+0x57>
+  8012a8:	eb 62                	jmp    80130c <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8012aa:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8012af:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8012b4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8012b7:	89 f8                	mov    %edi,%eax
+  8012b9:	e8 6f fd ff ff       	call   80102d <copy_page_to>
+  8012be:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8012c0:	85 c0                	test   %eax,%eax
+  8012c2:	78 48                	js     80130c <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8012c4:	83 ec 04             	sub    $0x4,%esp
+  8012c7:	6a 07                	push   $0x7
+  8012c9:	68 00 f0 bf ee       	push   $0xeebff000
+  8012ce:	57                   	push   %edi
+  8012cf:	e8 58 f9 ff ff       	call   800c2c <sys_page_alloc>
+  8012d4:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8012d6:	83 c4 10             	add    $0x10,%esp
+  8012d9:	85 c0                	test   %eax,%eax
+  8012db:	78 2f                	js     80130c <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8012dd:	a1 00 50 80 00       	mov    0x805000,%eax
+  8012e2:	8b 40 64             	mov    0x64(%eax),%eax
+  8012e5:	83 ec 08             	sub    $0x8,%esp
+  8012e8:	50                   	push   %eax
+  8012e9:	57                   	push   %edi
+  8012ea:	e8 a8 fa ff ff       	call   800d97 <sys_env_set_pgfault_upcall>
+  8012ef:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8012f1:	83 c4 10             	add    $0x10,%esp
+  8012f4:	85 c0                	test   %eax,%eax
+  8012f6:	78 14                	js     80130c <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8012f8:	83 ec 08             	sub    $0x8,%esp
+  8012fb:	6a 02                	push   $0x2
+  8012fd:	57                   	push   %edi
+  8012fe:	e8 00 fa ff ff       	call   800d03 <sys_env_set_status>
+  801303:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801305:	83 c4 10             	add    $0x10,%esp
+  801308:	85 c0                	test   %eax,%eax
+  80130a:	79 11                	jns    80131d <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  80130c:	83 ec 0c             	sub    $0xc,%esp
+  80130f:	ff 75 e0             	push   -0x20(%ebp)
+  801312:	e8 86 f8 ff ff       	call   800b9d <sys_env_destroy>
+	return r;
+  801317:	83 c4 10             	add    $0x10,%esp
+  80131a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  80131d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801323:	5b                   	pop    %ebx
+  801324:	5e                   	pop    %esi
+  801325:	5f                   	pop    %edi
+  801326:	5d                   	pop    %ebp
+  801327:	c3                   	ret
+
+00801328 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801328:	55                   	push   %ebp
+  801329:	89 e5                	mov    %esp,%ebp
+  80132b:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80132e:	68 4c 3c 80 00       	push   $0x803c4c
+  801333:	68 bf 00 00 00       	push   $0xbf
+  801338:	68 41 3c 80 00       	push   $0x803c41
+  80133d:	e8 15 ee ff ff       	call   800157 <_panic>
+
+00801342 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801342:	55                   	push   %ebp
+  801343:	89 e5                	mov    %esp,%ebp
+  801345:	56                   	push   %esi
+  801346:	53                   	push   %ebx
+  801347:	8b 75 08             	mov    0x8(%ebp),%esi
+  80134a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80134d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801350:	85 c0                	test   %eax,%eax
+  801352:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801357:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80135a:	83 ec 0c             	sub    $0xc,%esp
+  80135d:	50                   	push   %eax
+  80135e:	e8 11 fb ff ff       	call   800e74 <sys_ipc_recv>
+	if (from_env_store)
+  801363:	83 c4 10             	add    $0x10,%esp
+  801366:	85 f6                	test   %esi,%esi
+  801368:	74 14                	je     80137e <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80136a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80136f:	85 c0                	test   %eax,%eax
+  801371:	75 09                	jne    80137c <ipc_recv+0x3a>
+  801373:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  801379:	8b 52 74             	mov    0x74(%edx),%edx
+  80137c:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  80137e:	85 db                	test   %ebx,%ebx
+  801380:	74 25                	je     8013a7 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801382:	85 c0                	test   %eax,%eax
+  801384:	74 0d                	je     801393 <ipc_recv+0x51>
+  801386:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  80138c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80138f:	5b                   	pop    %ebx
+  801390:	5e                   	pop    %esi
+  801391:	5d                   	pop    %ebp
+  801392:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801393:	a1 00 50 80 00       	mov    0x805000,%eax
+  801398:	8b 40 78             	mov    0x78(%eax),%eax
+  80139b:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  80139d:	a1 00 50 80 00       	mov    0x805000,%eax
+  8013a2:	8b 40 70             	mov    0x70(%eax),%eax
+  8013a5:	eb e5                	jmp    80138c <ipc_recv+0x4a>
+  8013a7:	85 c0                	test   %eax,%eax
+  8013a9:	75 e1                	jne    80138c <ipc_recv+0x4a>
+  8013ab:	eb f0                	jmp    80139d <ipc_recv+0x5b>
+
+008013ad <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8013ad:	55                   	push   %ebp
+  8013ae:	89 e5                	mov    %esp,%ebp
+  8013b0:	57                   	push   %edi
+  8013b1:	56                   	push   %esi
+  8013b2:	53                   	push   %ebx
+  8013b3:	83 ec 0c             	sub    $0xc,%esp
+  8013b6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8013bf:	85 db                	test   %ebx,%ebx
+  8013c1:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8013c6:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8013c9:	ff 75 14             	push   0x14(%ebp)
+  8013cc:	53                   	push   %ebx
+  8013cd:	56                   	push   %esi
+  8013ce:	57                   	push   %edi
+  8013cf:	e8 0d fa ff ff       	call   800de1 <sys_ipc_try_send>
+  8013d4:	83 c4 10             	add    $0x10,%esp
+  8013d7:	85 c0                	test   %eax,%eax
+  8013d9:	74 22                	je     8013fd <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8013db:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8013de:	75 07                	jne    8013e7 <ipc_send+0x3a>
+		sys_yield();
+  8013e0:	e8 28 f8 ff ff       	call   800c0d <sys_yield>
+  8013e5:	eb e2                	jmp    8013c9 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8013e7:	68 62 3c 80 00       	push   $0x803c62
+  8013ec:	68 2c 3c 80 00       	push   $0x803c2c
+  8013f1:	6a 39                	push   $0x39
+  8013f3:	68 77 3c 80 00       	push   $0x803c77
+  8013f8:	e8 5a ed ff ff       	call   800157 <_panic>
+	}
+}
+  8013fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801400:	5b                   	pop    %ebx
+  801401:	5e                   	pop    %esi
+  801402:	5f                   	pop    %edi
+  801403:	5d                   	pop    %ebp
+  801404:	c3                   	ret
+
+00801405 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  801405:	55                   	push   %ebp
+  801406:	89 e5                	mov    %esp,%ebp
+  801408:	57                   	push   %edi
+  801409:	56                   	push   %esi
+  80140a:	53                   	push   %ebx
+  80140b:	83 ec 10             	sub    $0x10,%esp
+  80140e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801411:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801414:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801417:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80141a:	85 c0                	test   %eax,%eax
+  80141c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801421:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  801424:	6a 00                	push   $0x0
+  801426:	ff 33                	push   (%ebx)
+  801428:	50                   	push   %eax
+  801429:	e8 03 fa ff ff       	call   800e31 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80142e:	83 c4 10             	add    $0x10,%esp
+  801431:	85 c0                	test   %eax,%eax
+  801433:	75 3c                	jne    801471 <ipc_recvv+0x6c>
+  801435:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80143b:	8b 52 7c             	mov    0x7c(%edx),%edx
+  80143e:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  801440:	85 ff                	test   %edi,%edi
+  801442:	74 4e                	je     801492 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801444:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80144a:	8b 52 74             	mov    0x74(%edx),%edx
+  80144d:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  80144f:	85 f6                	test   %esi,%esi
+  801451:	74 18                	je     80146b <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801453:	85 c0                	test   %eax,%eax
+  801455:	75 2d                	jne    801484 <ipc_recvv+0x7f>
+  801457:	a1 00 50 80 00       	mov    0x805000,%eax
+  80145c:	8b 40 78             	mov    0x78(%eax),%eax
+  80145f:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  801461:	a1 00 50 80 00       	mov    0x805000,%eax
+  801466:	8b 40 70             	mov    0x70(%eax),%eax
+  801469:	eb 1f                	jmp    80148a <ipc_recvv+0x85>
+  80146b:	85 c0                	test   %eax,%eax
+  80146d:	75 1b                	jne    80148a <ipc_recvv+0x85>
+  80146f:	eb f0                	jmp    801461 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  801471:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801477:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  80147c:	85 ff                	test   %edi,%edi
+  80147e:	75 cd                	jne    80144d <ipc_recvv+0x48>
+	if (perm_store)
+  801480:	85 f6                	test   %esi,%esi
+  801482:	74 e7                	je     80146b <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801484:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80148a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80148d:	5b                   	pop    %ebx
+  80148e:	5e                   	pop    %esi
+  80148f:	5f                   	pop    %edi
+  801490:	5d                   	pop    %ebp
+  801491:	c3                   	ret
+	if (perm_store)
+  801492:	85 f6                	test   %esi,%esi
+  801494:	75 bd                	jne    801453 <ipc_recvv+0x4e>
+  801496:	eb c9                	jmp    801461 <ipc_recvv+0x5c>
+
+00801498 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  801498:	55                   	push   %ebp
+  801499:	89 e5                	mov    %esp,%ebp
+  80149b:	57                   	push   %edi
+  80149c:	56                   	push   %esi
+  80149d:	53                   	push   %ebx
+  80149e:	83 ec 0c             	sub    $0xc,%esp
+  8014a1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014a4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8014aa:	ff 75 14             	push   0x14(%ebp)
+  8014ad:	53                   	push   %ebx
+  8014ae:	56                   	push   %esi
+  8014af:	57                   	push   %edi
+  8014b0:	e8 54 f9 ff ff       	call   800e09 <sys_ipc_try_sendv>
+  8014b5:	83 c4 10             	add    $0x10,%esp
+  8014b8:	85 c0                	test   %eax,%eax
+  8014ba:	74 22                	je     8014de <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8014bc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8014bf:	75 07                	jne    8014c8 <ipc_sendv+0x30>
+		sys_yield();
+  8014c1:	e8 47 f7 ff ff       	call   800c0d <sys_yield>
+  8014c6:	eb e2                	jmp    8014aa <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8014c8:	68 62 3c 80 00       	push   $0x803c62
+  8014cd:	68 2c 3c 80 00       	push   $0x803c2c
+  8014d2:	6a 5c                	push   $0x5c
+  8014d4:	68 77 3c 80 00       	push   $0x803c77
+  8014d9:	e8 79 ec ff ff       	call   800157 <_panic>
+	}
+}
+  8014de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e1:	5b                   	pop    %ebx
+  8014e2:	5e                   	pop    %esi
+  8014e3:	5f                   	pop    %edi
+  8014e4:	5d                   	pop    %ebp
+  8014e5:	c3                   	ret
+
+008014e6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8014e6:	55                   	push   %ebp
+  8014e7:	89 e5                	mov    %esp,%ebp
+  8014e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8014ec:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8014f1:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8014f7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8014fd:	8b 52 50             	mov    0x50(%edx),%edx
+  801500:	39 ca                	cmp    %ecx,%edx
+  801502:	74 11                	je     801515 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801504:	83 c0 01             	add    $0x1,%eax
+  801507:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80150c:	75 e3                	jne    8014f1 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80150e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801513:	eb 0e                	jmp    801523 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801515:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80151b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801520:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801523:	5d                   	pop    %ebp
+  801524:	c3                   	ret
+
+00801525 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801525:	55                   	push   %ebp
+  801526:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801528:	8b 45 08             	mov    0x8(%ebp),%eax
+  80152b:	05 00 00 00 30       	add    $0x30000000,%eax
+  801530:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801533:	5d                   	pop    %ebp
+  801534:	c3                   	ret
+
+00801535 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801535:	55                   	push   %ebp
+  801536:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801538:	8b 45 08             	mov    0x8(%ebp),%eax
+  80153b:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801540:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801545:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80154a:	5d                   	pop    %ebp
+  80154b:	c3                   	ret
+
+0080154c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80154c:	55                   	push   %ebp
+  80154d:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80154f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801554:	eb 02                	jmp    801558 <fd_alloc+0xc>
+  801556:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801558:	89 c2                	mov    %eax,%edx
+  80155a:	c1 ea 16             	shr    $0x16,%edx
+  80155d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801564:	f6 c2 01             	test   $0x1,%dl
+  801567:	74 2b                	je     801594 <fd_alloc+0x48>
+  801569:	89 c2                	mov    %eax,%edx
+  80156b:	c1 ea 0c             	shr    $0xc,%edx
+  80156e:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801575:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80157b:	f6 c1 01             	test   $0x1,%cl
+  80157e:	74 14                	je     801594 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801580:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801586:	75 ce                	jne    801556 <fd_alloc+0xa>
+  801588:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80158d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801592:	eb 05                	jmp    801599 <fd_alloc+0x4d>
+			return 0;
+  801594:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801599:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159c:	89 02                	mov    %eax,(%edx)
+}
+  80159e:	89 c8                	mov    %ecx,%eax
+  8015a0:	5d                   	pop    %ebp
+  8015a1:	c3                   	ret
+
+008015a2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8015a2:	55                   	push   %ebp
+  8015a3:	89 e5                	mov    %esp,%ebp
+  8015a5:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8015a8:	83 f8 1f             	cmp    $0x1f,%eax
+  8015ab:	77 30                	ja     8015dd <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8015ad:	c1 e0 0c             	shl    $0xc,%eax
+  8015b0:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8015b5:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8015bb:	f6 c2 01             	test   $0x1,%dl
+  8015be:	74 24                	je     8015e4 <fd_lookup+0x42>
+  8015c0:	89 c2                	mov    %eax,%edx
+  8015c2:	c1 ea 0c             	shr    $0xc,%edx
+  8015c5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015cc:	f6 c2 01             	test   $0x1,%dl
+  8015cf:	74 1a                	je     8015eb <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8015d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015d4:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8015d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015db:	5d                   	pop    %ebp
+  8015dc:	c3                   	ret
+		return -E_INVAL;
+  8015dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e2:	eb f7                	jmp    8015db <fd_lookup+0x39>
+		return -E_INVAL;
+  8015e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e9:	eb f0                	jmp    8015db <fd_lookup+0x39>
+  8015eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015f0:	eb e9                	jmp    8015db <fd_lookup+0x39>
+
+008015f2 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8015f2:	55                   	push   %ebp
+  8015f3:	89 e5                	mov    %esp,%ebp
+  8015f5:	53                   	push   %ebx
+  8015f6:	83 ec 04             	sub    $0x4,%esp
+  8015f9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8015fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801601:	eb 03                	jmp    801606 <dev_lookup+0x14>
+  801603:	83 c0 01             	add    $0x1,%eax
+  801606:	8b 1c 85 00 3d 80 00 	mov    0x803d00(,%eax,4),%ebx
+  80160d:	85 db                	test   %ebx,%ebx
+  80160f:	74 0b                	je     80161c <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801611:	39 13                	cmp    %edx,(%ebx)
+  801613:	75 ee                	jne    801603 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161a:	eb 1f                	jmp    80163b <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80161c:	a1 00 50 80 00       	mov    0x805000,%eax
+  801621:	8b 40 48             	mov    0x48(%eax),%eax
+  801624:	83 ec 04             	sub    $0x4,%esp
+  801627:	52                   	push   %edx
+  801628:	50                   	push   %eax
+  801629:	68 84 3c 80 00       	push   $0x803c84
+  80162e:	e8 ff eb ff ff       	call   800232 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801633:	83 c4 10             	add    $0x10,%esp
+  801636:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80163b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80163e:	89 1a                	mov    %ebx,(%edx)
+}
+  801640:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801643:	c9                   	leave
+  801644:	c3                   	ret
+
+00801645 <fd_close>:
+{
+  801645:	55                   	push   %ebp
+  801646:	89 e5                	mov    %esp,%ebp
+  801648:	57                   	push   %edi
+  801649:	56                   	push   %esi
+  80164a:	53                   	push   %ebx
+  80164b:	83 ec 24             	sub    $0x24,%esp
+  80164e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801651:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801654:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801657:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801658:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80165e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801661:	50                   	push   %eax
+  801662:	e8 3b ff ff ff       	call   8015a2 <fd_lookup>
+  801667:	89 c3                	mov    %eax,%ebx
+  801669:	83 c4 10             	add    $0x10,%esp
+  80166c:	85 c0                	test   %eax,%eax
+  80166e:	78 05                	js     801675 <fd_close+0x30>
+	    || fd != fd2)
+  801670:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801673:	74 16                	je     80168b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801675:	89 f8                	mov    %edi,%eax
+  801677:	84 c0                	test   %al,%al
+  801679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801681:	89 d8                	mov    %ebx,%eax
+  801683:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801686:	5b                   	pop    %ebx
+  801687:	5e                   	pop    %esi
+  801688:	5f                   	pop    %edi
+  801689:	5d                   	pop    %ebp
+  80168a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80168b:	83 ec 08             	sub    $0x8,%esp
+  80168e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801691:	50                   	push   %eax
+  801692:	ff 36                	push   (%esi)
+  801694:	e8 59 ff ff ff       	call   8015f2 <dev_lookup>
+  801699:	89 c3                	mov    %eax,%ebx
+  80169b:	83 c4 10             	add    $0x10,%esp
+  80169e:	85 c0                	test   %eax,%eax
+  8016a0:	78 1a                	js     8016bc <fd_close+0x77>
+		if (dev->dev_close)
+  8016a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016a5:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8016a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8016ad:	85 c0                	test   %eax,%eax
+  8016af:	74 0b                	je     8016bc <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8016b1:	83 ec 0c             	sub    $0xc,%esp
+  8016b4:	56                   	push   %esi
+  8016b5:	ff d0                	call   *%eax
+  8016b7:	89 c3                	mov    %eax,%ebx
+  8016b9:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8016bc:	83 ec 08             	sub    $0x8,%esp
+  8016bf:	56                   	push   %esi
+  8016c0:	6a 00                	push   $0x0
+  8016c2:	e8 f2 f5 ff ff       	call   800cb9 <sys_page_unmap>
+	return r;
+  8016c7:	83 c4 10             	add    $0x10,%esp
+  8016ca:	eb b5                	jmp    801681 <fd_close+0x3c>
+
+008016cc <close>:
+
+int
+close(int fdnum)
+{
+  8016cc:	55                   	push   %ebp
+  8016cd:	89 e5                	mov    %esp,%ebp
+  8016cf:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d5:	50                   	push   %eax
+  8016d6:	ff 75 08             	push   0x8(%ebp)
+  8016d9:	e8 c4 fe ff ff       	call   8015a2 <fd_lookup>
+  8016de:	83 c4 10             	add    $0x10,%esp
+  8016e1:	85 c0                	test   %eax,%eax
+  8016e3:	79 02                	jns    8016e7 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8016e5:	c9                   	leave
+  8016e6:	c3                   	ret
+		return fd_close(fd, 1);
+  8016e7:	83 ec 08             	sub    $0x8,%esp
+  8016ea:	6a 01                	push   $0x1
+  8016ec:	ff 75 f4             	push   -0xc(%ebp)
+  8016ef:	e8 51 ff ff ff       	call   801645 <fd_close>
+  8016f4:	83 c4 10             	add    $0x10,%esp
+  8016f7:	eb ec                	jmp    8016e5 <close+0x19>
+
+008016f9 <close_all>:
+
+void
+close_all(void)
+{
+  8016f9:	55                   	push   %ebp
+  8016fa:	89 e5                	mov    %esp,%ebp
+  8016fc:	53                   	push   %ebx
+  8016fd:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801700:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801705:	83 ec 0c             	sub    $0xc,%esp
+  801708:	53                   	push   %ebx
+  801709:	e8 be ff ff ff       	call   8016cc <close>
+	for (i = 0; i < MAXFD; i++)
+  80170e:	83 c3 01             	add    $0x1,%ebx
+  801711:	83 c4 10             	add    $0x10,%esp
+  801714:	83 fb 20             	cmp    $0x20,%ebx
+  801717:	75 ec                	jne    801705 <close_all+0xc>
+}
+  801719:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80171c:	c9                   	leave
+  80171d:	c3                   	ret
+
+0080171e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80171e:	55                   	push   %ebp
+  80171f:	89 e5                	mov    %esp,%ebp
+  801721:	57                   	push   %edi
+  801722:	56                   	push   %esi
+  801723:	53                   	push   %ebx
+  801724:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801727:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80172a:	50                   	push   %eax
+  80172b:	ff 75 08             	push   0x8(%ebp)
+  80172e:	e8 6f fe ff ff       	call   8015a2 <fd_lookup>
+  801733:	89 c3                	mov    %eax,%ebx
+  801735:	83 c4 10             	add    $0x10,%esp
+  801738:	85 c0                	test   %eax,%eax
+  80173a:	78 7f                	js     8017bb <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80173c:	83 ec 0c             	sub    $0xc,%esp
+  80173f:	ff 75 0c             	push   0xc(%ebp)
+  801742:	e8 85 ff ff ff       	call   8016cc <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801747:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80174a:	c1 e6 0c             	shl    $0xc,%esi
+  80174d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801753:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801756:	89 3c 24             	mov    %edi,(%esp)
+  801759:	e8 d7 fd ff ff       	call   801535 <fd2data>
+  80175e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801760:	89 34 24             	mov    %esi,(%esp)
+  801763:	e8 cd fd ff ff       	call   801535 <fd2data>
+  801768:	83 c4 10             	add    $0x10,%esp
+  80176b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80176e:	89 d8                	mov    %ebx,%eax
+  801770:	c1 e8 16             	shr    $0x16,%eax
+  801773:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80177a:	a8 01                	test   $0x1,%al
+  80177c:	74 11                	je     80178f <dup+0x71>
+  80177e:	89 d8                	mov    %ebx,%eax
+  801780:	c1 e8 0c             	shr    $0xc,%eax
+  801783:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80178a:	f6 c2 01             	test   $0x1,%dl
+  80178d:	75 36                	jne    8017c5 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80178f:	89 f8                	mov    %edi,%eax
+  801791:	c1 e8 0c             	shr    $0xc,%eax
+  801794:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80179b:	83 ec 0c             	sub    $0xc,%esp
+  80179e:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017a3:	50                   	push   %eax
+  8017a4:	56                   	push   %esi
+  8017a5:	6a 00                	push   $0x0
+  8017a7:	57                   	push   %edi
+  8017a8:	6a 00                	push   $0x0
+  8017aa:	e8 c8 f4 ff ff       	call   800c77 <sys_page_map>
+  8017af:	89 c3                	mov    %eax,%ebx
+  8017b1:	83 c4 20             	add    $0x20,%esp
+  8017b4:	85 c0                	test   %eax,%eax
+  8017b6:	78 33                	js     8017eb <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8017b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8017bb:	89 d8                	mov    %ebx,%eax
+  8017bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c0:	5b                   	pop    %ebx
+  8017c1:	5e                   	pop    %esi
+  8017c2:	5f                   	pop    %edi
+  8017c3:	5d                   	pop    %ebp
+  8017c4:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8017c5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017cc:	83 ec 0c             	sub    $0xc,%esp
+  8017cf:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017d4:	50                   	push   %eax
+  8017d5:	ff 75 d4             	push   -0x2c(%ebp)
+  8017d8:	6a 00                	push   $0x0
+  8017da:	53                   	push   %ebx
+  8017db:	6a 00                	push   $0x0
+  8017dd:	e8 95 f4 ff ff       	call   800c77 <sys_page_map>
+  8017e2:	89 c3                	mov    %eax,%ebx
+  8017e4:	83 c4 20             	add    $0x20,%esp
+  8017e7:	85 c0                	test   %eax,%eax
+  8017e9:	79 a4                	jns    80178f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8017eb:	83 ec 08             	sub    $0x8,%esp
+  8017ee:	56                   	push   %esi
+  8017ef:	6a 00                	push   $0x0
+  8017f1:	e8 c3 f4 ff ff       	call   800cb9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8017f6:	83 c4 08             	add    $0x8,%esp
+  8017f9:	ff 75 d4             	push   -0x2c(%ebp)
+  8017fc:	6a 00                	push   $0x0
+  8017fe:	e8 b6 f4 ff ff       	call   800cb9 <sys_page_unmap>
+	return r;
+  801803:	83 c4 10             	add    $0x10,%esp
+  801806:	eb b3                	jmp    8017bb <dup+0x9d>
+
+00801808 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801808:	55                   	push   %ebp
+  801809:	89 e5                	mov    %esp,%ebp
+  80180b:	56                   	push   %esi
+  80180c:	53                   	push   %ebx
+  80180d:	83 ec 18             	sub    $0x18,%esp
+  801810:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801813:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801816:	50                   	push   %eax
+  801817:	56                   	push   %esi
+  801818:	e8 85 fd ff ff       	call   8015a2 <fd_lookup>
+  80181d:	83 c4 10             	add    $0x10,%esp
+  801820:	85 c0                	test   %eax,%eax
+  801822:	78 3c                	js     801860 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801824:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801827:	83 ec 08             	sub    $0x8,%esp
+  80182a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80182d:	50                   	push   %eax
+  80182e:	ff 33                	push   (%ebx)
+  801830:	e8 bd fd ff ff       	call   8015f2 <dev_lookup>
+  801835:	83 c4 10             	add    $0x10,%esp
+  801838:	85 c0                	test   %eax,%eax
+  80183a:	78 24                	js     801860 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80183c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80183f:	83 e0 03             	and    $0x3,%eax
+  801842:	83 f8 01             	cmp    $0x1,%eax
+  801845:	74 20                	je     801867 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801847:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80184a:	8b 40 08             	mov    0x8(%eax),%eax
+  80184d:	85 c0                	test   %eax,%eax
+  80184f:	74 37                	je     801888 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801851:	83 ec 04             	sub    $0x4,%esp
+  801854:	ff 75 10             	push   0x10(%ebp)
+  801857:	ff 75 0c             	push   0xc(%ebp)
+  80185a:	53                   	push   %ebx
+  80185b:	ff d0                	call   *%eax
+  80185d:	83 c4 10             	add    $0x10,%esp
+}
+  801860:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801863:	5b                   	pop    %ebx
+  801864:	5e                   	pop    %esi
+  801865:	5d                   	pop    %ebp
+  801866:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801867:	a1 00 50 80 00       	mov    0x805000,%eax
+  80186c:	8b 40 48             	mov    0x48(%eax),%eax
+  80186f:	83 ec 04             	sub    $0x4,%esp
+  801872:	56                   	push   %esi
+  801873:	50                   	push   %eax
+  801874:	68 c5 3c 80 00       	push   $0x803cc5
+  801879:	e8 b4 e9 ff ff       	call   800232 <cprintf>
+		return -E_INVAL;
+  80187e:	83 c4 10             	add    $0x10,%esp
+  801881:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801886:	eb d8                	jmp    801860 <read+0x58>
+		return -E_NOT_SUPP;
+  801888:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80188d:	eb d1                	jmp    801860 <read+0x58>
+
+0080188f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80188f:	55                   	push   %ebp
+  801890:	89 e5                	mov    %esp,%ebp
+  801892:	57                   	push   %edi
+  801893:	56                   	push   %esi
+  801894:	53                   	push   %ebx
+  801895:	83 ec 0c             	sub    $0xc,%esp
+  801898:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80189b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80189e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a3:	eb 02                	jmp    8018a7 <readn+0x18>
+  8018a5:	01 c3                	add    %eax,%ebx
+  8018a7:	39 f3                	cmp    %esi,%ebx
+  8018a9:	73 21                	jae    8018cc <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018ab:	83 ec 04             	sub    $0x4,%esp
+  8018ae:	89 f0                	mov    %esi,%eax
+  8018b0:	29 d8                	sub    %ebx,%eax
+  8018b2:	50                   	push   %eax
+  8018b3:	89 d8                	mov    %ebx,%eax
+  8018b5:	03 45 0c             	add    0xc(%ebp),%eax
+  8018b8:	50                   	push   %eax
+  8018b9:	57                   	push   %edi
+  8018ba:	e8 49 ff ff ff       	call   801808 <read>
+		if (m < 0)
+  8018bf:	83 c4 10             	add    $0x10,%esp
+  8018c2:	85 c0                	test   %eax,%eax
+  8018c4:	78 04                	js     8018ca <readn+0x3b>
+			return m;
+		if (m == 0)
+  8018c6:	75 dd                	jne    8018a5 <readn+0x16>
+  8018c8:	eb 02                	jmp    8018cc <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018ca:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8018cc:	89 d8                	mov    %ebx,%eax
+  8018ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018d1:	5b                   	pop    %ebx
+  8018d2:	5e                   	pop    %esi
+  8018d3:	5f                   	pop    %edi
+  8018d4:	5d                   	pop    %ebp
+  8018d5:	c3                   	ret
+
+008018d6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8018d6:	55                   	push   %ebp
+  8018d7:	89 e5                	mov    %esp,%ebp
+  8018d9:	56                   	push   %esi
+  8018da:	53                   	push   %ebx
+  8018db:	83 ec 18             	sub    $0x18,%esp
+  8018de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018e1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018e4:	50                   	push   %eax
+  8018e5:	53                   	push   %ebx
+  8018e6:	e8 b7 fc ff ff       	call   8015a2 <fd_lookup>
+  8018eb:	83 c4 10             	add    $0x10,%esp
+  8018ee:	85 c0                	test   %eax,%eax
+  8018f0:	78 37                	js     801929 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018f2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018f5:	83 ec 08             	sub    $0x8,%esp
+  8018f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018fb:	50                   	push   %eax
+  8018fc:	ff 36                	push   (%esi)
+  8018fe:	e8 ef fc ff ff       	call   8015f2 <dev_lookup>
+  801903:	83 c4 10             	add    $0x10,%esp
+  801906:	85 c0                	test   %eax,%eax
+  801908:	78 1f                	js     801929 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80190a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80190e:	74 20                	je     801930 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801910:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801913:	8b 40 0c             	mov    0xc(%eax),%eax
+  801916:	85 c0                	test   %eax,%eax
+  801918:	74 37                	je     801951 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80191a:	83 ec 04             	sub    $0x4,%esp
+  80191d:	ff 75 10             	push   0x10(%ebp)
+  801920:	ff 75 0c             	push   0xc(%ebp)
+  801923:	56                   	push   %esi
+  801924:	ff d0                	call   *%eax
+  801926:	83 c4 10             	add    $0x10,%esp
+}
+  801929:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80192c:	5b                   	pop    %ebx
+  80192d:	5e                   	pop    %esi
+  80192e:	5d                   	pop    %ebp
+  80192f:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801930:	a1 00 50 80 00       	mov    0x805000,%eax
+  801935:	8b 40 48             	mov    0x48(%eax),%eax
+  801938:	83 ec 04             	sub    $0x4,%esp
+  80193b:	53                   	push   %ebx
+  80193c:	50                   	push   %eax
+  80193d:	68 e1 3c 80 00       	push   $0x803ce1
+  801942:	e8 eb e8 ff ff       	call   800232 <cprintf>
+		return -E_INVAL;
+  801947:	83 c4 10             	add    $0x10,%esp
+  80194a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194f:	eb d8                	jmp    801929 <write+0x53>
+		return -E_NOT_SUPP;
+  801951:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801956:	eb d1                	jmp    801929 <write+0x53>
+
+00801958 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801958:	55                   	push   %ebp
+  801959:	89 e5                	mov    %esp,%ebp
+  80195b:	53                   	push   %ebx
+  80195c:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80195f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801962:	50                   	push   %eax
+  801963:	ff 75 08             	push   0x8(%ebp)
+  801966:	e8 37 fc ff ff       	call   8015a2 <fd_lookup>
+  80196b:	83 c4 10             	add    $0x10,%esp
+  80196e:	85 c0                	test   %eax,%eax
+  801970:	78 3a                	js     8019ac <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801972:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801975:	83 ec 08             	sub    $0x8,%esp
+  801978:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80197b:	50                   	push   %eax
+  80197c:	ff 33                	push   (%ebx)
+  80197e:	e8 6f fc ff ff       	call   8015f2 <dev_lookup>
+  801983:	83 c4 10             	add    $0x10,%esp
+  801986:	85 c0                	test   %eax,%eax
+  801988:	78 22                	js     8019ac <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  80198a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80198d:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801990:	85 c0                	test   %eax,%eax
+  801992:	74 0d                	je     8019a1 <seek+0x49>
+  801994:	83 ec 0c             	sub    $0xc,%esp
+  801997:	53                   	push   %ebx
+  801998:	ff d0                	call   *%eax
+  80199a:	83 c4 10             	add    $0x10,%esp
+  80199d:	85 c0                	test   %eax,%eax
+  80199f:	78 0b                	js     8019ac <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8019a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019a4:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8019a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019af:	c9                   	leave
+  8019b0:	c3                   	ret
+
+008019b1 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8019b1:	55                   	push   %ebp
+  8019b2:	89 e5                	mov    %esp,%ebp
+  8019b4:	53                   	push   %ebx
+  8019b5:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019b8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019bb:	50                   	push   %eax
+  8019bc:	ff 75 08             	push   0x8(%ebp)
+  8019bf:	e8 de fb ff ff       	call   8015a2 <fd_lookup>
+  8019c4:	83 c4 10             	add    $0x10,%esp
+  8019c7:	85 c0                	test   %eax,%eax
+  8019c9:	78 2b                	js     8019f6 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019cb:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8019ce:	83 ec 08             	sub    $0x8,%esp
+  8019d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019d4:	50                   	push   %eax
+  8019d5:	ff 33                	push   (%ebx)
+  8019d7:	e8 16 fc ff ff       	call   8015f2 <dev_lookup>
+  8019dc:	83 c4 10             	add    $0x10,%esp
+  8019df:	85 c0                	test   %eax,%eax
+  8019e1:	78 13                	js     8019f6 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8019e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019e6:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8019e9:	85 c0                	test   %eax,%eax
+  8019eb:	74 0e                	je     8019fb <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8019ed:	83 ec 0c             	sub    $0xc,%esp
+  8019f0:	53                   	push   %ebx
+  8019f1:	ff d0                	call   *%eax
+  8019f3:	83 c4 10             	add    $0x10,%esp
+}
+  8019f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019f9:	c9                   	leave
+  8019fa:	c3                   	ret
+		return 0;
+  8019fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a00:	eb f4                	jmp    8019f6 <fsync+0x45>
+
+00801a02 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801a02:	55                   	push   %ebp
+  801a03:	89 e5                	mov    %esp,%ebp
+  801a05:	56                   	push   %esi
+  801a06:	53                   	push   %ebx
+  801a07:	83 ec 18             	sub    $0x18,%esp
+  801a0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a0d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a10:	50                   	push   %eax
+  801a11:	53                   	push   %ebx
+  801a12:	e8 8b fb ff ff       	call   8015a2 <fd_lookup>
+  801a17:	83 c4 10             	add    $0x10,%esp
+  801a1a:	85 c0                	test   %eax,%eax
+  801a1c:	78 34                	js     801a52 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a1e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a21:	83 ec 08             	sub    $0x8,%esp
+  801a24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a27:	50                   	push   %eax
+  801a28:	ff 36                	push   (%esi)
+  801a2a:	e8 c3 fb ff ff       	call   8015f2 <dev_lookup>
+  801a2f:	83 c4 10             	add    $0x10,%esp
+  801a32:	85 c0                	test   %eax,%eax
+  801a34:	78 1c                	js     801a52 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a36:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a3a:	74 1d                	je     801a59 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801a3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a3f:	8b 40 18             	mov    0x18(%eax),%eax
+  801a42:	85 c0                	test   %eax,%eax
+  801a44:	74 34                	je     801a7a <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801a46:	83 ec 08             	sub    $0x8,%esp
+  801a49:	ff 75 0c             	push   0xc(%ebp)
+  801a4c:	56                   	push   %esi
+  801a4d:	ff d0                	call   *%eax
+  801a4f:	83 c4 10             	add    $0x10,%esp
+}
+  801a52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a55:	5b                   	pop    %ebx
+  801a56:	5e                   	pop    %esi
+  801a57:	5d                   	pop    %ebp
+  801a58:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801a59:	a1 00 50 80 00       	mov    0x805000,%eax
+  801a5e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a61:	83 ec 04             	sub    $0x4,%esp
+  801a64:	53                   	push   %ebx
+  801a65:	50                   	push   %eax
+  801a66:	68 a4 3c 80 00       	push   $0x803ca4
+  801a6b:	e8 c2 e7 ff ff       	call   800232 <cprintf>
+		return -E_INVAL;
+  801a70:	83 c4 10             	add    $0x10,%esp
+  801a73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a78:	eb d8                	jmp    801a52 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a7a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a7f:	eb d1                	jmp    801a52 <ftruncate+0x50>
+
+00801a81 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a81:	55                   	push   %ebp
+  801a82:	89 e5                	mov    %esp,%ebp
+  801a84:	56                   	push   %esi
+  801a85:	53                   	push   %ebx
+  801a86:	83 ec 18             	sub    $0x18,%esp
+  801a89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a8c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a8f:	50                   	push   %eax
+  801a90:	ff 75 08             	push   0x8(%ebp)
+  801a93:	e8 0a fb ff ff       	call   8015a2 <fd_lookup>
+  801a98:	83 c4 10             	add    $0x10,%esp
+  801a9b:	85 c0                	test   %eax,%eax
+  801a9d:	78 49                	js     801ae8 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a9f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801aa2:	83 ec 08             	sub    $0x8,%esp
+  801aa5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aa8:	50                   	push   %eax
+  801aa9:	ff 36                	push   (%esi)
+  801aab:	e8 42 fb ff ff       	call   8015f2 <dev_lookup>
+  801ab0:	83 c4 10             	add    $0x10,%esp
+  801ab3:	85 c0                	test   %eax,%eax
+  801ab5:	78 31                	js     801ae8 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801ab7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aba:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801abe:	74 2f                	je     801aef <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801ac0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801ac3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801aca:	00 00 00 
+	stat->st_isdir = 0;
+  801acd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ad4:	00 00 00 
+	stat->st_dev = dev;
+  801ad7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801add:	83 ec 08             	sub    $0x8,%esp
+  801ae0:	53                   	push   %ebx
+  801ae1:	56                   	push   %esi
+  801ae2:	ff 50 14             	call   *0x14(%eax)
+  801ae5:	83 c4 10             	add    $0x10,%esp
+}
+  801ae8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aeb:	5b                   	pop    %ebx
+  801aec:	5e                   	pop    %esi
+  801aed:	5d                   	pop    %ebp
+  801aee:	c3                   	ret
+		return -E_NOT_SUPP;
+  801aef:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801af4:	eb f2                	jmp    801ae8 <fstat+0x67>
+
+00801af6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801af6:	55                   	push   %ebp
+  801af7:	89 e5                	mov    %esp,%ebp
+  801af9:	56                   	push   %esi
+  801afa:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801afb:	83 ec 08             	sub    $0x8,%esp
+  801afe:	68 00 10 00 00       	push   $0x1000
+  801b03:	ff 75 08             	push   0x8(%ebp)
+  801b06:	e8 b3 07 00 00       	call   8022be <open>
+  801b0b:	89 c3                	mov    %eax,%ebx
+  801b0d:	83 c4 10             	add    $0x10,%esp
+  801b10:	85 c0                	test   %eax,%eax
+  801b12:	78 1b                	js     801b2f <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801b14:	83 ec 08             	sub    $0x8,%esp
+  801b17:	ff 75 0c             	push   0xc(%ebp)
+  801b1a:	50                   	push   %eax
+  801b1b:	e8 61 ff ff ff       	call   801a81 <fstat>
+  801b20:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801b22:	89 1c 24             	mov    %ebx,(%esp)
+  801b25:	e8 a2 fb ff ff       	call   8016cc <close>
+	return r;
+  801b2a:	83 c4 10             	add    $0x10,%esp
+  801b2d:	89 f3                	mov    %esi,%ebx
+}
+  801b2f:	89 d8                	mov    %ebx,%eax
+  801b31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b34:	5b                   	pop    %ebx
+  801b35:	5e                   	pop    %esi
+  801b36:	5d                   	pop    %ebp
+  801b37:	c3                   	ret
+
+00801b38 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801b38:	55                   	push   %ebp
+  801b39:	89 e5                	mov    %esp,%ebp
+  801b3b:	57                   	push   %edi
+  801b3c:	56                   	push   %esi
+  801b3d:	53                   	push   %ebx
+  801b3e:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801b44:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801b4a:	89 d6                	mov    %edx,%esi
+  801b4c:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801b52:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801b55:	89 d3                	mov    %edx,%ebx
+  801b57:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801b5d:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801b64:	74 1d                	je     801b83 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b66:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801b6b:	83 c8 07             	or     $0x7,%eax
+  801b6e:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801b74:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801b79:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801b7f:	01 ce                	add    %ecx,%esi
+  801b81:	eb 28                	jmp    801bab <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b83:	83 ec 0c             	sub    $0xc,%esp
+  801b86:	6a 01                	push   $0x1
+  801b88:	e8 59 f9 ff ff       	call   8014e6 <ipc_find_env>
+  801b8d:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801b92:	83 c4 10             	add    $0x10,%esp
+  801b95:	eb cf                	jmp    801b66 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801b97:	83 c0 01             	add    $0x1,%eax
+  801b9a:	89 fa                	mov    %edi,%edx
+  801b9c:	09 da                	or     %ebx,%edx
+  801b9e:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801ba5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801bab:	39 f3                	cmp    %esi,%ebx
+  801bad:	72 e8                	jb     801b97 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801baf:	83 f8 41             	cmp    $0x41,%eax
+  801bb2:	77 2f                	ja     801be3 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801bb4:	50                   	push   %eax
+  801bb5:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801bbb:	50                   	push   %eax
+  801bbc:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801bc2:	ff 35 c8 70 80 00    	push   0x8070c8
+  801bc8:	e8 cb f8 ff ff       	call   801498 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801bcd:	83 c4 0c             	add    $0xc,%esp
+  801bd0:	6a 00                	push   $0x0
+  801bd2:	6a 00                	push   $0x0
+  801bd4:	6a 00                	push   $0x0
+  801bd6:	e8 67 f7 ff ff       	call   801342 <ipc_recv>
+}
+  801bdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bde:	5b                   	pop    %ebx
+  801bdf:	5e                   	pop    %esi
+  801be0:	5f                   	pop    %edi
+  801be1:	5d                   	pop    %ebp
+  801be2:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801be3:	68 14 3d 80 00       	push   $0x803d14
+  801be8:	68 2c 3c 80 00       	push   $0x803c2c
+  801bed:	6a 40                	push   $0x40
+  801bef:	68 30 3d 80 00       	push   $0x803d30
+  801bf4:	e8 5e e5 ff ff       	call   800157 <_panic>
+
+00801bf9 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801bf9:	55                   	push   %ebp
+  801bfa:	89 e5                	mov    %esp,%ebp
+  801bfc:	57                   	push   %edi
+  801bfd:	56                   	push   %esi
+  801bfe:	53                   	push   %ebx
+  801bff:	83 ec 1c             	sub    $0x1c,%esp
+  801c02:	89 c3                	mov    %eax,%ebx
+  801c04:	89 d6                	mov    %edx,%esi
+  801c06:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801c09:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801c0f:	89 ca                	mov    %ecx,%edx
+  801c11:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801c14:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801c1b:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801c1e:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801c25:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c28:	89 fb                	mov    %edi,%ebx
+  801c2a:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801c31:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c34:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801c3b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c3e:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801c45:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c48:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801c4f:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801c52:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801c59:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801c5e:	39 c8                	cmp    %ecx,%eax
+  801c60:	74 0d                	je     801c6f <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c6a:	5b                   	pop    %ebx
+  801c6b:	5e                   	pop    %esi
+  801c6c:	5f                   	pop    %edi
+  801c6d:	5d                   	pop    %ebp
+  801c6e:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801c6f:	6a 07                	push   $0x7
+  801c71:	68 00 60 80 00       	push   $0x806000
+  801c76:	6a 0d                	push   $0xd
+  801c78:	ff 35 c8 70 80 00    	push   0x8070c8
+  801c7e:	e8 2a f7 ff ff       	call   8013ad <ipc_send>
+  801c83:	83 c4 10             	add    $0x10,%esp
+  801c86:	eb da                	jmp    801c62 <fsring_post+0x69>
+
+00801c88 <fsipcv>:
+{
+  801c88:	55                   	push   %ebp
+  801c89:	89 e5                	mov    %esp,%ebp
+  801c8b:	57                   	push   %edi
+  801c8c:	56                   	push   %esi
+  801c8d:	53                   	push   %ebx
+  801c8e:	83 ec 0c             	sub    $0xc,%esp
+  801c91:	89 c7                	mov    %eax,%edi
+  801c93:	89 d3                	mov    %edx,%ebx
+  801c95:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801c97:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801c9e:	74 26                	je     801cc6 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ca0:	6a 07                	push   $0x7
+  801ca2:	68 00 60 80 00       	push   $0x806000
+  801ca7:	57                   	push   %edi
+  801ca8:	ff 35 c8 70 80 00    	push   0x8070c8
+  801cae:	e8 fa f6 ff ff       	call   8013ad <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801cb3:	6a 00                	push   $0x0
+  801cb5:	56                   	push   %esi
+  801cb6:	53                   	push   %ebx
+  801cb7:	6a 00                	push   $0x0
+  801cb9:	e8 47 f7 ff ff       	call   801405 <ipc_recvv>
+}
+  801cbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cc1:	5b                   	pop    %ebx
+  801cc2:	5e                   	pop    %esi
+  801cc3:	5f                   	pop    %edi
+  801cc4:	5d                   	pop    %ebp
+  801cc5:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801cc6:	83 ec 0c             	sub    $0xc,%esp
+  801cc9:	6a 01                	push   $0x1
+  801ccb:	e8 16 f8 ff ff       	call   8014e6 <ipc_find_env>
+  801cd0:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801cd5:	83 c4 10             	add    $0x10,%esp
+  801cd8:	eb c6                	jmp    801ca0 <fsipcv+0x18>
+
+00801cda <fsipc>:
+{
+  801cda:	55                   	push   %ebp
+  801cdb:	89 e5                	mov    %esp,%ebp
+  801cdd:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801ce0:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801ce7:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801cea:	e8 99 ff ff ff       	call   801c88 <fsipcv>
+}
+  801cef:	c9                   	leave
+  801cf0:	c3                   	ret
+
+00801cf1 <file_write_direct>:
+{
+  801cf1:	55                   	push   %ebp
+  801cf2:	89 e5                	mov    %esp,%ebp
+  801cf4:	56                   	push   %esi
+  801cf5:	53                   	push   %ebx
+  801cf6:	89 c3                	mov    %eax,%ebx
+  801cf8:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801cfa:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801d00:	77 40                	ja     801d42 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801d02:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801d07:	39 c8                	cmp    %ecx,%eax
+  801d09:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d0c:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801d0f:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  801d15:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801d1a:	83 ec 04             	sub    $0x4,%esp
+  801d1d:	50                   	push   %eax
+  801d1e:	52                   	push   %edx
+  801d1f:	68 08 60 80 00       	push   $0x806008
+  801d24:	e8 7d ec ff ff       	call   8009a6 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801d29:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d2e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d33:	e8 a2 ff ff ff       	call   801cda <fsipc>
+  801d38:	83 c4 10             	add    $0x10,%esp
+}
+  801d3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d3e:	5b                   	pop    %ebx
+  801d3f:	5e                   	pop    %esi
+  801d40:	5d                   	pop    %ebp
+  801d41:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801d42:	89 d6                	mov    %edx,%esi
+  801d44:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801d4a:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801d4f:	29 f1                	sub    %esi,%ecx
+  801d51:	39 c1                	cmp    %eax,%ecx
+  801d53:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801d56:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801d59:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801d5e:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801d64:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801d6a:	83 ec 0c             	sub    $0xc,%esp
+  801d6d:	6a 05                	push   $0x5
+  801d6f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801d74:	e8 bf fd ff ff       	call   801b38 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801d79:	83 c4 10             	add    $0x10,%esp
+  801d7c:	eb bd                	jmp    801d3b <file_write_direct+0x4a>
+
+00801d7e <devfile_sync>:
+{
+  801d7e:	55                   	push   %ebp
+  801d7f:	89 e5                	mov    %esp,%ebp
+  801d81:	57                   	push   %edi
+  801d82:	56                   	push   %esi
+  801d83:	53                   	push   %ebx
+  801d84:	83 ec 28             	sub    $0x28,%esp
+  801d87:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801d8a:	56                   	push   %esi
+  801d8b:	e8 a5 f7 ff ff       	call   801535 <fd2data>
+  801d90:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801d92:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801d95:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801d9c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801da4:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801da8:	74 45                	je     801def <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801daa:	8b 46 14             	mov    0x14(%esi),%eax
+  801dad:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801db0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dba:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801dbd:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801dc0:	39 cb                	cmp    %ecx,%ebx
+  801dc2:	73 14                	jae    801dd8 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801dc4:	29 d9                	sub    %ebx,%ecx
+  801dc6:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801dc9:	89 f0                	mov    %esi,%eax
+  801dcb:	e8 21 ff ff ff       	call   801cf1 <file_write_direct>
+  801dd0:	85 c0                	test   %eax,%eax
+  801dd2:	7e 04                	jle    801dd8 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801dd4:	01 c3                	add    %eax,%ebx
+  801dd6:	eb e5                	jmp    801dbd <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801dd8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801ddb:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801de2:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801de5:	85 c0                	test   %eax,%eax
+  801de7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dec:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801def:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801df2:	5b                   	pop    %ebx
+  801df3:	5e                   	pop    %esi
+  801df4:	5f                   	pop    %edi
+  801df5:	5d                   	pop    %ebp
+  801df6:	c3                   	ret
+
+00801df7 <devfile_write>:
+{
+  801df7:	55                   	push   %ebp
+  801df8:	89 e5                	mov    %esp,%ebp
+  801dfa:	57                   	push   %edi
+  801dfb:	56                   	push   %esi
+  801dfc:	53                   	push   %ebx
+  801dfd:	83 ec 28             	sub    $0x28,%esp
+  801e00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e03:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801e06:	53                   	push   %ebx
+  801e07:	e8 29 f7 ff ff       	call   801535 <fd2data>
+  801e0c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801e0f:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801e12:	83 c4 10             	add    $0x10,%esp
+  801e15:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801e19:	74 43                	je     801e5e <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801e1b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801e22:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801e25:	85 c0                	test   %eax,%eax
+  801e27:	74 43                	je     801e6c <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801e29:	89 c2                	mov    %eax,%edx
+  801e2b:	03 53 14             	add    0x14(%ebx),%edx
+  801e2e:	39 fa                	cmp    %edi,%edx
+  801e30:	75 0b                	jne    801e3d <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801e32:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801e35:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801e3b:	76 66                	jbe    801ea3 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801e3d:	83 ec 0c             	sub    $0xc,%esp
+  801e40:	53                   	push   %ebx
+  801e41:	e8 38 ff ff ff       	call   801d7e <devfile_sync>
+  801e46:	83 c4 10             	add    $0x10,%esp
+  801e49:	85 c0                	test   %eax,%eax
+  801e4b:	78 4e                	js     801e9b <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801e4d:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e53:	77 56                	ja     801eab <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801e55:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801e58:	85 c0                	test   %eax,%eax
+  801e5a:	75 20                	jne    801e7c <devfile_write+0x85>
+  801e5c:	eb 16                	jmp    801e74 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801e5e:	89 f1                	mov    %esi,%ecx
+  801e60:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e63:	89 d8                	mov    %ebx,%eax
+  801e65:	e8 87 fe ff ff       	call   801cf1 <file_write_direct>
+  801e6a:	eb 2f                	jmp    801e9b <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801e6c:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e72:	77 37                	ja     801eab <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801e74:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801e77:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801e7c:	83 ec 04             	sub    $0x4,%esp
+  801e7f:	56                   	push   %esi
+  801e80:	ff 75 0c             	push   0xc(%ebp)
+  801e83:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e86:	01 c1                	add    %eax,%ecx
+  801e88:	51                   	push   %ecx
+  801e89:	e8 18 eb ff ff       	call   8009a6 <memmove>
+	ff->buf_wlen += n;
+  801e8e:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801e91:	01 f7                	add    %esi,%edi
+  801e93:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801e96:	89 f0                	mov    %esi,%eax
+  801e98:	83 c4 10             	add    $0x10,%esp
+}
+  801e9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e9e:	5b                   	pop    %ebx
+  801e9f:	5e                   	pop    %esi
+  801ea0:	5f                   	pop    %edi
+  801ea1:	5d                   	pop    %ebp
+  801ea2:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801ea3:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801ea9:	76 d1                	jbe    801e7c <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801eab:	89 f1                	mov    %esi,%ecx
+  801ead:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801eb0:	89 d8                	mov    %ebx,%eax
+  801eb2:	e8 3a fe ff ff       	call   801cf1 <file_write_direct>
+  801eb7:	eb e2                	jmp    801e9b <devfile_write+0xa4>
+
+00801eb9 <devfile_trunc>:
+{
+  801eb9:	55                   	push   %ebp
+  801eba:	89 e5                	mov    %esp,%ebp
+  801ebc:	53                   	push   %ebx
+  801ebd:	83 ec 10             	sub    $0x10,%esp
+  801ec0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801ec3:	53                   	push   %ebx
+  801ec4:	e8 b5 fe ff ff       	call   801d7e <devfile_sync>
+  801ec9:	83 c4 10             	add    $0x10,%esp
+  801ecc:	85 c0                	test   %eax,%eax
+  801ece:	78 1f                	js     801eef <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ed0:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801ed3:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801ed8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801edb:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ee0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee5:	b8 02 00 00 00       	mov    $0x2,%eax
+  801eea:	e8 eb fd ff ff       	call   801cda <fsipc>
+}
+  801eef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ef2:	c9                   	leave
+  801ef3:	c3                   	ret
+
+00801ef4 <devfile_stat>:
+{
+  801ef4:	55                   	push   %ebp
+  801ef5:	89 e5                	mov    %esp,%ebp
+  801ef7:	56                   	push   %esi
+  801ef8:	53                   	push   %ebx
+  801ef9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801efc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801eff:	83 ec 0c             	sub    $0xc,%esp
+  801f02:	53                   	push   %ebx
+  801f03:	e8 76 fe ff ff       	call   801d7e <devfile_sync>
+  801f08:	83 c4 10             	add    $0x10,%esp
+  801f0b:	85 c0                	test   %eax,%eax
+  801f0d:	78 47                	js     801f56 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f0f:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801f12:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f17:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f1c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f21:	e8 b4 fd ff ff       	call   801cda <fsipc>
+  801f26:	85 c0                	test   %eax,%eax
+  801f28:	78 2c                	js     801f56 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f2a:	83 ec 08             	sub    $0x8,%esp
+  801f2d:	68 00 60 80 00       	push   $0x806000
+  801f32:	56                   	push   %esi
+  801f33:	e8 e8 e8 ff ff       	call   800820 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f38:	a1 80 60 80 00       	mov    0x806080,%eax
+  801f3d:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f43:	a1 84 60 80 00       	mov    0x806084,%eax
+  801f48:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801f4e:	83 c4 10             	add    $0x10,%esp
+  801f51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f59:	5b                   	pop    %ebx
+  801f5a:	5e                   	pop    %esi
+  801f5b:	5d                   	pop    %ebp
+  801f5c:	c3                   	ret
+
+00801f5d <devfile_flush>:
+{
+  801f5d:	55                   	push   %ebp
+  801f5e:	89 e5                	mov    %esp,%ebp
+  801f60:	56                   	push   %esi
+  801f61:	53                   	push   %ebx
+  801f62:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801f65:	83 ec 0c             	sub    $0xc,%esp
+  801f68:	56                   	push   %esi
+  801f69:	e8 10 fe ff ff       	call   801d7e <devfile_sync>
+  801f6e:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801f70:	83 c4 10             	add    $0x10,%esp
+  801f73:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801f77:	75 25                	jne    801f9e <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f79:	8b 46 0c             	mov    0xc(%esi),%eax
+  801f7c:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801f81:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f86:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f8b:	e8 4a fd ff ff       	call   801cda <fsipc>
+  801f90:	85 c0                	test   %eax,%eax
+  801f92:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801f95:	89 d8                	mov    %ebx,%eax
+  801f97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f9a:	5b                   	pop    %ebx
+  801f9b:	5e                   	pop    %esi
+  801f9c:	5d                   	pop    %ebp
+  801f9d:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801f9e:	83 ec 0c             	sub    $0xc,%esp
+  801fa1:	56                   	push   %esi
+  801fa2:	e8 8e f5 ff ff       	call   801535 <fd2data>
+  801fa7:	83 c4 08             	add    $0x8,%esp
+  801faa:	50                   	push   %eax
+  801fab:	6a 00                	push   $0x0
+  801fad:	e8 07 ed ff ff       	call   800cb9 <sys_page_unmap>
+  801fb2:	83 c4 10             	add    $0x10,%esp
+  801fb5:	eb c2                	jmp    801f79 <devfile_flush+0x1c>
+
+00801fb7 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801fb7:	55                   	push   %ebp
+  801fb8:	89 e5                	mov    %esp,%ebp
+  801fba:	57                   	push   %edi
+  801fbb:	56                   	push   %esi
+  801fbc:	53                   	push   %ebx
+  801fbd:	83 ec 64             	sub    $0x64,%esp
+  801fc0:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801fc2:	52                   	push   %edx
+  801fc3:	50                   	push   %eax
+  801fc4:	e8 d9 f5 ff ff       	call   8015a2 <fd_lookup>
+  801fc9:	89 c1                	mov    %eax,%ecx
+  801fcb:	83 c4 10             	add    $0x10,%esp
+  801fce:	85 c0                	test   %eax,%eax
+  801fd0:	0f 88 f2 00 00 00    	js     8020c8 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801fd6:	8b 07                	mov    (%edi),%eax
+  801fd8:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801fde:	39 10                	cmp    %edx,(%eax)
+  801fe0:	0f 85 03 01 00 00    	jne    8020e9 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801fe6:	a1 00 50 80 00       	mov    0x805000,%eax
+  801feb:	8b 40 48             	mov    0x48(%eax),%eax
+  801fee:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801ff4:	0f 84 96 00 00 00    	je     802090 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801ffa:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  802001:	0f 84 cb 00 00 00    	je     8020d2 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  802007:	b8 00 60 80 00       	mov    $0x806000,%eax
+  80200c:	83 c8 07             	or     $0x7,%eax
+  80200f:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  802012:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  802015:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  80201a:	83 ec 04             	sub    $0x4,%esp
+  80201d:	68 07 04 00 00       	push   $0x407
+  802022:	53                   	push   %ebx
+  802023:	6a 00                	push   $0x0
+  802025:	e8 02 ec ff ff       	call   800c2c <sys_page_alloc>
+  80202a:	89 c1                	mov    %eax,%ecx
+  80202c:	83 c4 10             	add    $0x10,%esp
+  80202f:	85 c0                	test   %eax,%eax
+  802031:	0f 88 91 00 00 00    	js     8020c8 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  802037:	89 d8                	mov    %ebx,%eax
+  802039:	83 c8 07             	or     $0x7,%eax
+  80203c:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  80203e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802044:	83 c6 04             	add    $0x4,%esi
+  802047:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  80204d:	75 cb                	jne    80201a <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  80204f:	6a 12                	push   $0x12
+  802051:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802054:	50                   	push   %eax
+  802055:	6a 0c                	push   $0xc
+  802057:	ff 35 c8 70 80 00    	push   0x8070c8
+  80205d:	e8 36 f4 ff ff       	call   801498 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802062:	83 c4 0c             	add    $0xc,%esp
+  802065:	6a 00                	push   $0x0
+  802067:	6a 00                	push   $0x0
+  802069:	6a 00                	push   $0x0
+  80206b:	e8 d2 f2 ff ff       	call   801342 <ipc_recv>
+  802070:	89 c1                	mov    %eax,%ecx
+  802072:	83 c4 10             	add    $0x10,%esp
+  802075:	85 c0                	test   %eax,%eax
+  802077:	78 4f                	js     8020c8 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  802079:	a1 00 50 80 00       	mov    0x805000,%eax
+  80207e:	8b 40 48             	mov    0x48(%eax),%eax
+  802081:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  802086:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  80208d:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  802090:	83 ec 0c             	sub    $0xc,%esp
+  802093:	ff 37                	push   (%edi)
+  802095:	e8 e4 fc ff ff       	call   801d7e <devfile_sync>
+  80209a:	89 c1                	mov    %eax,%ecx
+  80209c:	83 c4 10             	add    $0x10,%esp
+  80209f:	85 c0                	test   %eax,%eax
+  8020a1:	78 25                	js     8020c8 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  8020a3:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  8020a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  8020ae:	ba 01 00 00 00       	mov    $0x1,%edx
+  8020b3:	89 d0                	mov    %edx,%eax
+  8020b5:	d3 e0                	shl    %cl,%eax
+  8020b7:	85 d8                	test   %ebx,%eax
+  8020b9:	74 0d                	je     8020c8 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  8020bb:	83 c1 01             	add    $0x1,%ecx
+  8020be:	83 f9 10             	cmp    $0x10,%ecx
+  8020c1:	75 f0                	jne    8020b3 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  8020c3:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  8020c8:	89 c8                	mov    %ecx,%eax
+  8020ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020cd:	5b                   	pop    %ebx
+  8020ce:	5e                   	pop    %esi
+  8020cf:	5f                   	pop    %edi
+  8020d0:	5d                   	pop    %ebp
+  8020d1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020d2:	83 ec 0c             	sub    $0xc,%esp
+  8020d5:	6a 01                	push   $0x1
+  8020d7:	e8 0a f4 ff ff       	call   8014e6 <ipc_find_env>
+  8020dc:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8020e1:	83 c4 10             	add    $0x10,%esp
+  8020e4:	e9 1e ff ff ff       	jmp    802007 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  8020e9:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  8020ee:	eb d8                	jmp    8020c8 <fsring_slot+0x111>
+
+008020f0 <file_read_direct>:
+{
+  8020f0:	55                   	push   %ebp
+  8020f1:	89 e5                	mov    %esp,%ebp
+  8020f3:	57                   	push   %edi
+  8020f4:	56                   	push   %esi
+  8020f5:	53                   	push   %ebx
+  8020f6:	83 ec 1c             	sub    $0x1c,%esp
+  8020f9:	89 c7                	mov    %eax,%edi
+  8020fb:	89 d6                	mov    %edx,%esi
+  8020fd:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  8020ff:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  802105:	77 52                	ja     802159 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802107:	8b 40 0c             	mov    0xc(%eax),%eax
+  80210a:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  80210f:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802115:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80211f:	e8 b6 fb ff ff       	call   801cda <fsipc>
+  802124:	89 c7                	mov    %eax,%edi
+  802126:	85 c0                	test   %eax,%eax
+  802128:	78 25                	js     80214f <file_read_direct+0x5f>
+	assert(r <= n);
+  80212a:	39 c3                	cmp    %eax,%ebx
+  80212c:	0f 82 87 00 00 00    	jb     8021b9 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  802132:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802137:	0f 8f 95 00 00 00    	jg     8021d2 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80213d:	83 ec 04             	sub    $0x4,%esp
+  802140:	50                   	push   %eax
+  802141:	68 00 60 80 00       	push   $0x806000
+  802146:	56                   	push   %esi
+  802147:	e8 5a e8 ff ff       	call   8009a6 <memmove>
+	return r;
+  80214c:	83 c4 10             	add    $0x10,%esp
+}
+  80214f:	89 f8                	mov    %edi,%eax
+  802151:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802154:	5b                   	pop    %ebx
+  802155:	5e                   	pop    %esi
+  802156:	5f                   	pop    %edi
+  802157:	5d                   	pop    %ebp
+  802158:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802159:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80215f:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802164:	29 d1                	sub    %edx,%ecx
+  802166:	39 d9                	cmp    %ebx,%ecx
+  802168:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80216b:	89 f0                	mov    %esi,%eax
+  80216d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  802170:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802173:	eb 0f                	jmp    802184 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  802175:	0f b6 10             	movzbl (%eax),%edx
+  802178:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80217a:	05 00 10 00 00       	add    $0x1000,%eax
+  80217f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802184:	39 c8                	cmp    %ecx,%eax
+  802186:	72 ed                	jb     802175 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802188:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80218b:	8b 47 0c             	mov    0xc(%edi),%eax
+  80218e:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  802193:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802199:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  80219f:	83 ec 0c             	sub    $0xc,%esp
+  8021a2:	6a 07                	push   $0x7
+  8021a4:	89 d9                	mov    %ebx,%ecx
+  8021a6:	89 f2                	mov    %esi,%edx
+  8021a8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021ad:	e8 86 f9 ff ff       	call   801b38 <fsipc_pages>
+  8021b2:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  8021b4:	83 c4 10             	add    $0x10,%esp
+  8021b7:	eb 96                	jmp    80214f <file_read_direct+0x5f>
+	assert(r <= n);
+  8021b9:	68 3b 3d 80 00       	push   $0x803d3b
+  8021be:	68 2c 3c 80 00       	push   $0x803c2c
+  8021c3:	68 dc 00 00 00       	push   $0xdc
+  8021c8:	68 30 3d 80 00       	push   $0x803d30
+  8021cd:	e8 85 df ff ff       	call   800157 <_panic>
+	assert(r <= PGSIZE);
+  8021d2:	68 4c 3d 80 00       	push   $0x803d4c
+  8021d7:	68 2c 3c 80 00       	push   $0x803c2c
+  8021dc:	68 dd 00 00 00       	push   $0xdd
+  8021e1:	68 30 3d 80 00       	push   $0x803d30
+  8021e6:	e8 6c df ff ff       	call   800157 <_panic>
+
+008021eb <devfile_read>:
+{
+  8021eb:	55                   	push   %ebp
+  8021ec:	89 e5                	mov    %esp,%ebp
+  8021ee:	57                   	push   %edi
+  8021ef:	56                   	push   %esi
+  8021f0:	53                   	push   %ebx
+  8021f1:	83 ec 28             	sub    $0x28,%esp
+  8021f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8021f7:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8021fa:	53                   	push   %ebx
+  8021fb:	e8 35 f3 ff ff       	call   801535 <fd2data>
+  802200:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  802203:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  802206:	83 c4 10             	add    $0x10,%esp
+  802209:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  80220d:	74 7d                	je     80228c <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80220f:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802213:	0f 85 81 00 00 00    	jne    80229a <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  802219:	8b 43 18             	mov    0x18(%ebx),%eax
+  80221c:	85 c0                	test   %eax,%eax
+  80221e:	74 0d                	je     80222d <devfile_read+0x42>
+  802220:	8b 53 14             	mov    0x14(%ebx),%edx
+  802223:	39 fa                	cmp    %edi,%edx
+  802225:	7f 06                	jg     80222d <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  802227:	01 c2                	add    %eax,%edx
+  802229:	39 d7                	cmp    %edx,%edi
+  80222b:	72 28                	jb     802255 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  80222d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  802234:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80223a:	77 74                	ja     8022b0 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  80223c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802241:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802244:	89 d8                	mov    %ebx,%eax
+  802246:	e8 a5 fe ff ff       	call   8020f0 <file_read_direct>
+  80224b:	85 c0                	test   %eax,%eax
+  80224d:	7e 35                	jle    802284 <devfile_read+0x99>
+		ff->buf_base = pos;
+  80224f:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  802252:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  802255:	8b 53 14             	mov    0x14(%ebx),%edx
+  802258:	89 d0                	mov    %edx,%eax
+  80225a:	03 43 18             	add    0x18(%ebx),%eax
+  80225d:	29 f8                	sub    %edi,%eax
+  80225f:	39 f0                	cmp    %esi,%eax
+  802261:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  802264:	83 ec 04             	sub    $0x4,%esp
+  802267:	56                   	push   %esi
+  802268:	89 f8                	mov    %edi,%eax
+  80226a:	29 d0                	sub    %edx,%eax
+  80226c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80226f:	01 c1                	add    %eax,%ecx
+  802271:	51                   	push   %ecx
+  802272:	ff 75 0c             	push   0xc(%ebp)
+  802275:	e8 2c e7 ff ff       	call   8009a6 <memmove>
+	fd->fd_offset = pos + n;
+  80227a:	01 f7                	add    %esi,%edi
+  80227c:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80227f:	89 f0                	mov    %esi,%eax
+  802281:	83 c4 10             	add    $0x10,%esp
+}
+  802284:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802287:	5b                   	pop    %ebx
+  802288:	5e                   	pop    %esi
+  802289:	5f                   	pop    %edi
+  80228a:	5d                   	pop    %ebp
+  80228b:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  80228c:	89 f1                	mov    %esi,%ecx
+  80228e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802291:	89 d8                	mov    %ebx,%eax
+  802293:	e8 58 fe ff ff       	call   8020f0 <file_read_direct>
+  802298:	eb ea                	jmp    802284 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80229a:	83 ec 0c             	sub    $0xc,%esp
+  80229d:	53                   	push   %ebx
+  80229e:	e8 db fa ff ff       	call   801d7e <devfile_sync>
+  8022a3:	83 c4 10             	add    $0x10,%esp
+  8022a6:	85 c0                	test   %eax,%eax
+  8022a8:	0f 89 6b ff ff ff    	jns    802219 <devfile_read+0x2e>
+  8022ae:	eb d4                	jmp    802284 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  8022b0:	89 f1                	mov    %esi,%ecx
+  8022b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022b5:	89 d8                	mov    %ebx,%eax
+  8022b7:	e8 34 fe ff ff       	call   8020f0 <file_read_direct>
+  8022bc:	eb c6                	jmp    802284 <devfile_read+0x99>
+
+008022be <open>:
+{
+  8022be:	55                   	push   %ebp
+  8022bf:	89 e5                	mov    %esp,%ebp
+  8022c1:	56                   	push   %esi
+  8022c2:	53                   	push   %ebx
+  8022c3:	83 ec 1c             	sub    $0x1c,%esp
+  8022c6:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8022c9:	56                   	push   %esi
+  8022ca:	e8 16 e5 ff ff       	call   8007e5 <strlen>
+  8022cf:	83 c4 10             	add    $0x10,%esp
+  8022d2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022d7:	0f 8f a0 00 00 00    	jg     80237d <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  8022dd:	83 ec 0c             	sub    $0xc,%esp
+  8022e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022e3:	50                   	push   %eax
+  8022e4:	e8 63 f2 ff ff       	call   80154c <fd_alloc>
+  8022e9:	89 c3                	mov    %eax,%ebx
+  8022eb:	83 c4 10             	add    $0x10,%esp
+  8022ee:	85 c0                	test   %eax,%eax
+  8022f0:	78 45                	js     802337 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  8022f2:	83 ec 08             	sub    $0x8,%esp
+  8022f5:	56                   	push   %esi
+  8022f6:	68 00 60 80 00       	push   $0x806000
+  8022fb:	e8 20 e5 ff ff       	call   800820 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802300:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802303:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802308:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80230b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802310:	e8 c5 f9 ff ff       	call   801cda <fsipc>
+  802315:	89 c3                	mov    %eax,%ebx
+  802317:	83 c4 10             	add    $0x10,%esp
+  80231a:	85 c0                	test   %eax,%eax
+  80231c:	78 22                	js     802340 <open+0x82>
+	if (!(mode & O_NOBUF)
+  80231e:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  802325:	74 2b                	je     802352 <open+0x94>
+	return fd2num(fd);
+  802327:	83 ec 0c             	sub    $0xc,%esp
+  80232a:	ff 75 f4             	push   -0xc(%ebp)
+  80232d:	e8 f3 f1 ff ff       	call   801525 <fd2num>
+  802332:	89 c3                	mov    %eax,%ebx
+  802334:	83 c4 10             	add    $0x10,%esp
+}
+  802337:	89 d8                	mov    %ebx,%eax
+  802339:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80233c:	5b                   	pop    %ebx
+  80233d:	5e                   	pop    %esi
+  80233e:	5d                   	pop    %ebp
+  80233f:	c3                   	ret
+		fd_close(fd, 0);
+  802340:	83 ec 08             	sub    $0x8,%esp
+  802343:	6a 00                	push   $0x0
+  802345:	ff 75 f4             	push   -0xc(%ebp)
+  802348:	e8 f8 f2 ff ff       	call   801645 <fd_close>
+		return r;
+  80234d:	83 c4 10             	add    $0x10,%esp
+  802350:	eb e5                	jmp    802337 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  802352:	83 ec 0c             	sub    $0xc,%esp
+  802355:	ff 75 f4             	push   -0xc(%ebp)
+  802358:	e8 d8 f1 ff ff       	call   801535 <fd2data>
+  80235d:	83 c4 0c             	add    $0xc,%esp
+  802360:	68 07 04 00 00       	push   $0x407
+  802365:	50                   	push   %eax
+  802366:	6a 00                	push   $0x0
+  802368:	e8 bf e8 ff ff       	call   800c2c <sys_page_alloc>
+  80236d:	83 c4 10             	add    $0x10,%esp
+  802370:	85 c0                	test   %eax,%eax
+  802372:	75 b3                	jne    802327 <open+0x69>
+		fd->fd_file.buffered = 1;
+  802374:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802377:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  80237b:	eb aa                	jmp    802327 <open+0x69>
+		return -E_BAD_PATH;
+  80237d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802382:	eb b3                	jmp    802337 <open+0x79>
+
+00802384 <readdir>:
+{
+  802384:	55                   	push   %ebp
+  802385:	89 e5                	mov    %esp,%ebp
+  802387:	53                   	push   %ebx
+  802388:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80238b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80238e:	50                   	push   %eax
+  80238f:	ff 75 08             	push   0x8(%ebp)
+  802392:	e8 0b f2 ff ff       	call   8015a2 <fd_lookup>
+  802397:	89 c3                	mov    %eax,%ebx
+  802399:	83 c4 10             	add    $0x10,%esp
+  80239c:	85 c0                	test   %eax,%eax
+  80239e:	78 73                	js     802413 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8023a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023a3:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8023a9:	39 08                	cmp    %ecx,(%eax)
+  8023ab:	0f 85 82 00 00 00    	jne    802433 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  8023b1:	83 ec 0c             	sub    $0xc,%esp
+  8023b4:	50                   	push   %eax
+  8023b5:	e8 c4 f9 ff ff       	call   801d7e <devfile_sync>
+  8023ba:	89 c3                	mov    %eax,%ebx
+  8023bc:	83 c4 10             	add    $0x10,%esp
+  8023bf:	85 c0                	test   %eax,%eax
+  8023c1:	78 50                	js     802413 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  8023c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023c6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023c9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  8023ce:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023d1:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  8023d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023d9:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  8023de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8023e8:	e8 ed f8 ff ff       	call   801cda <fsipc>
+  8023ed:	89 c3                	mov    %eax,%ebx
+  8023ef:	85 c0                	test   %eax,%eax
+  8023f1:	7e 20                	jle    802413 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  8023f3:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8023f6:	72 22                	jb     80241a <readdir+0x96>
+  8023f8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8023fd:	7f 1b                	jg     80241a <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8023ff:	83 ec 04             	sub    $0x4,%esp
+  802402:	50                   	push   %eax
+  802403:	68 00 60 80 00       	push   $0x806000
+  802408:	ff 75 0c             	push   0xc(%ebp)
+  80240b:	e8 96 e5 ff ff       	call   8009a6 <memmove>
+	return r;
+  802410:	83 c4 10             	add    $0x10,%esp
+}
+  802413:	89 d8                	mov    %ebx,%eax
+  802415:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802418:	c9                   	leave
+  802419:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  80241a:	68 42 3d 80 00       	push   $0x803d42
+  80241f:	68 2c 3c 80 00       	push   $0x803c2c
+  802424:	68 86 01 00 00       	push   $0x186
+  802429:	68 30 3d 80 00       	push   $0x803d30
+  80242e:	e8 24 dd ff ff       	call   800157 <_panic>
+		return -E_NOT_SUPP;
+  802433:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802438:	eb d9                	jmp    802413 <readdir+0x8f>
+
+0080243a <munmap>:
+{
+  80243a:	55                   	push   %ebp
+  80243b:	89 e5                	mov    %esp,%ebp
+  80243d:	56                   	push   %esi
+  80243e:	53                   	push   %ebx
+  80243f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802442:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802445:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  80244b:	75 41                	jne    80248e <munmap+0x54>
+  80244d:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  802453:	77 39                	ja     80248e <munmap+0x54>
+  802455:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80245a:	29 f0                	sub    %esi,%eax
+  80245c:	39 d0                	cmp    %edx,%eax
+  80245e:	72 35                	jb     802495 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802460:	89 f3                	mov    %esi,%ebx
+  802462:	01 d6                	add    %edx,%esi
+  802464:	39 f3                	cmp    %esi,%ebx
+  802466:	73 1a                	jae    802482 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802468:	83 ec 08             	sub    $0x8,%esp
+  80246b:	53                   	push   %ebx
+  80246c:	6a 00                	push   $0x0
+  80246e:	e8 46 e8 ff ff       	call   800cb9 <sys_page_unmap>
+  802473:	83 c4 10             	add    $0x10,%esp
+  802476:	85 c0                	test   %eax,%eax
+  802478:	78 0d                	js     802487 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80247a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802480:	eb e2                	jmp    802464 <munmap+0x2a>
+	return 0;
+  802482:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802487:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80248a:	5b                   	pop    %ebx
+  80248b:	5e                   	pop    %esi
+  80248c:	5d                   	pop    %ebp
+  80248d:	c3                   	ret
+		return -E_INVAL;
+  80248e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802493:	eb f2                	jmp    802487 <munmap+0x4d>
+  802495:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80249a:	eb eb                	jmp    802487 <munmap+0x4d>
+
+0080249c <mmap>:
+{
+  80249c:	55                   	push   %ebp
+  80249d:	89 e5                	mov    %esp,%ebp
+  80249f:	57                   	push   %edi
+  8024a0:	56                   	push   %esi
+  8024a1:	53                   	push   %ebx
+  8024a2:	83 ec 34             	sub    $0x34,%esp
+  8024a5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024a8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024ab:	50                   	push   %eax
+  8024ac:	ff 75 18             	push   0x18(%ebp)
+  8024af:	e8 ee f0 ff ff       	call   8015a2 <fd_lookup>
+  8024b4:	89 c3                	mov    %eax,%ebx
+  8024b6:	83 c4 10             	add    $0x10,%esp
+  8024b9:	85 c0                	test   %eax,%eax
+  8024bb:	0f 88 0e 01 00 00    	js     8025cf <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8024c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024c4:	a1 20 40 80 00       	mov    0x804020,%eax
+  8024c9:	39 02                	cmp    %eax,(%edx)
+  8024cb:	0f 85 50 01 00 00    	jne    802621 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  8024d1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024d4:	83 e0 02             	and    $0x2,%eax
+  8024d7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8024da:	74 0a                	je     8024e6 <mmap+0x4a>
+  8024dc:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8024e0:	0f 84 42 01 00 00    	je     802628 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  8024e6:	8b 42 08             	mov    0x8(%edx),%eax
+  8024e9:	83 e0 03             	and    $0x3,%eax
+  8024ec:	83 f8 01             	cmp    $0x1,%eax
+  8024ef:	0f 84 3a 01 00 00    	je     80262f <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8024f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f8:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8024fb:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802500:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802503:	0f 85 2d 01 00 00    	jne    802636 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802509:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80250d:	0f 88 2a 01 00 00    	js     80263d <mmap+0x1a1>
+  802513:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80251a:	0f 87 1d 01 00 00    	ja     80263d <mmap+0x1a1>
+  802520:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802525:	2b 45 08             	sub    0x8(%ebp),%eax
+  802528:	39 f8                	cmp    %edi,%eax
+  80252a:	0f 82 14 01 00 00    	jb     802644 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802530:	83 ec 0c             	sub    $0xc,%esp
+  802533:	52                   	push   %edx
+  802534:	e8 45 f8 ff ff       	call   801d7e <devfile_sync>
+  802539:	89 c3                	mov    %eax,%ebx
+  80253b:	83 c4 10             	add    $0x10,%esp
+  80253e:	85 c0                	test   %eax,%eax
+  802540:	0f 88 89 00 00 00    	js     8025cf <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802546:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  80254c:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802552:	be 00 00 00 00       	mov    $0x0,%esi
+  802557:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  80255a:	39 fe                	cmp    %edi,%esi
+  80255c:	73 7b                	jae    8025d9 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  80255e:	89 f8                	mov    %edi,%eax
+  802560:	29 f0                	sub    %esi,%eax
+  802562:	c1 e8 0c             	shr    $0xc,%eax
+  802565:	ba 40 00 00 00       	mov    $0x40,%edx
+  80256a:	39 d0                	cmp    %edx,%eax
+  80256c:	0f 47 c2             	cmova  %edx,%eax
+  80256f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802572:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802575:	8b 52 0c             	mov    0xc(%edx),%edx
+  802578:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  80257e:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802581:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  802587:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  80258c:	89 f2                	mov    %esi,%edx
+  80258e:	03 55 08             	add    0x8(%ebp),%edx
+  802591:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802594:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802599:	e8 ea f6 ff ff       	call   801c88 <fsipcv>
+  80259e:	85 c0                	test   %eax,%eax
+  8025a0:	7e 12                	jle    8025b4 <mmap+0x118>
+  8025a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8025a5:	85 c0                	test   %eax,%eax
+  8025a7:	0f 84 9e 00 00 00    	je     80264b <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8025ad:	c1 e0 0c             	shl    $0xc,%eax
+  8025b0:	01 c6                	add    %eax,%esi
+  8025b2:	eb a6                	jmp    80255a <mmap+0xbe>
+			munmap(addr, done);
+  8025b4:	89 c3                	mov    %eax,%ebx
+  8025b6:	83 ec 08             	sub    $0x8,%esp
+  8025b9:	56                   	push   %esi
+  8025ba:	ff 75 08             	push   0x8(%ebp)
+  8025bd:	e8 78 fe ff ff       	call   80243a <munmap>
+			return r < 0 ? r : -E_INVAL;
+  8025c2:	83 c4 10             	add    $0x10,%esp
+  8025c5:	85 db                	test   %ebx,%ebx
+  8025c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025cc:	0f 49 d8             	cmovns %eax,%ebx
+}
+  8025cf:	89 d8                	mov    %ebx,%eax
+  8025d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025d4:	5b                   	pop    %ebx
+  8025d5:	5e                   	pop    %esi
+  8025d6:	5f                   	pop    %edi
+  8025d7:	5d                   	pop    %ebp
+  8025d8:	c3                   	ret
+	if (prot & PROT_WRITE)
+  8025d9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8025dc:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8025de:	85 c0                	test   %eax,%eax
+  8025e0:	74 ed                	je     8025cf <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8025e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8025ea:	39 fe                	cmp    %edi,%esi
+  8025ec:	73 2e                	jae    80261c <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8025ee:	83 ec 0c             	sub    $0xc,%esp
+  8025f1:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8025f4:	50                   	push   %eax
+  8025f5:	e8 4a eb ff ff       	call   801144 <cowpage>
+  8025fa:	83 c4 10             	add    $0x10,%esp
+  8025fd:	85 c0                	test   %eax,%eax
+  8025ff:	78 08                	js     802609 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802601:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802607:	eb e1                	jmp    8025ea <mmap+0x14e>
+				munmap(addr, len);
+  802609:	89 c3                	mov    %eax,%ebx
+  80260b:	83 ec 08             	sub    $0x8,%esp
+  80260e:	57                   	push   %edi
+  80260f:	ff 75 08             	push   0x8(%ebp)
+  802612:	e8 23 fe ff ff       	call   80243a <munmap>
+				return r;
+  802617:	83 c4 10             	add    $0x10,%esp
+  80261a:	eb b3                	jmp    8025cf <mmap+0x133>
+	return 0;
+  80261c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80261f:	eb ae                	jmp    8025cf <mmap+0x133>
+		return -E_NOT_SUPP;
+  802621:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802626:	eb a7                	jmp    8025cf <mmap+0x133>
+		return -E_NOT_SUPP;
+  802628:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80262d:	eb a0                	jmp    8025cf <mmap+0x133>
+		return -E_INVAL;
+  80262f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802634:	eb 99                	jmp    8025cf <mmap+0x133>
+  802636:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80263b:	eb 92                	jmp    8025cf <mmap+0x133>
+  80263d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802642:	eb 8b                	jmp    8025cf <mmap+0x133>
+  802644:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802649:	eb 84                	jmp    8025cf <mmap+0x133>
+			munmap(addr, done);
+  80264b:	83 ec 08             	sub    $0x8,%esp
+  80264e:	56                   	push   %esi
+  80264f:	ff 75 08             	push   0x8(%ebp)
+  802652:	e8 e3 fd ff ff       	call   80243a <munmap>
+  802657:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  80265a:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80265f:	e9 6b ff ff ff       	jmp    8025cf <mmap+0x133>
+
+00802664 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802664:	55                   	push   %ebp
+  802665:	89 e5                	mov    %esp,%ebp
+  802667:	56                   	push   %esi
+  802668:	53                   	push   %ebx
+  802669:	83 ec 10             	sub    $0x10,%esp
+  80266c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80266f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802672:	8b 45 08             	mov    0x8(%ebp),%eax
+  802675:	e8 3d f9 ff ff       	call   801fb7 <fsring_slot>
+  80267a:	85 c0                	test   %eax,%eax
+  80267c:	78 60                	js     8026de <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80267e:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802681:	8b 56 08             	mov    0x8(%esi),%edx
+  802684:	83 e2 03             	and    $0x3,%edx
+  802687:	83 fa 01             	cmp    $0x1,%edx
+  80268a:	74 59                	je     8026e5 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  80268c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802691:	89 c1                	mov    %eax,%ecx
+  802693:	d3 e2                	shl    %cl,%edx
+  802695:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  80269b:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80269e:	c1 e2 02             	shl    $0x2,%edx
+  8026a1:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8026a7:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  8026ae:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8026b1:	8b 55 18             	mov    0x18(%ebp),%edx
+  8026b4:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8026b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8026ba:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8026bd:	83 ec 08             	sub    $0x8,%esp
+  8026c0:	50                   	push   %eax
+  8026c1:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8026c6:	39 c3                	cmp    %eax,%ebx
+  8026c8:	0f 47 d8             	cmova  %eax,%ebx
+  8026cb:	53                   	push   %ebx
+  8026cc:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8026cf:	89 f2                	mov    %esi,%edx
+  8026d1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026d6:	e8 1e f5 ff ff       	call   801bf9 <fsring_post>
+  8026db:	83 c4 10             	add    $0x10,%esp
+}
+  8026de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e1:	5b                   	pop    %ebx
+  8026e2:	5e                   	pop    %esi
+  8026e3:	5d                   	pop    %ebp
+  8026e4:	c3                   	ret
+		return -E_INVAL;
+  8026e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026ea:	eb f2                	jmp    8026de <fsring_read+0x7a>
+
+008026ec <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8026ec:	55                   	push   %ebp
+  8026ed:	89 e5                	mov    %esp,%ebp
+  8026ef:	56                   	push   %esi
+  8026f0:	53                   	push   %ebx
+  8026f1:	83 ec 10             	sub    $0x10,%esp
+  8026f4:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8026f7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026fd:	e8 b5 f8 ff ff       	call   801fb7 <fsring_slot>
+  802702:	89 c3                	mov    %eax,%ebx
+  802704:	85 c0                	test   %eax,%eax
+  802706:	78 77                	js     80277f <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802708:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80270b:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80270f:	74 77                	je     802788 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802711:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802716:	39 c6                	cmp    %eax,%esi
+  802718:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80271b:	83 ec 04             	sub    $0x4,%esp
+  80271e:	56                   	push   %esi
+  80271f:	ff 75 0c             	push   0xc(%ebp)
+  802722:	89 d8                	mov    %ebx,%eax
+  802724:	c1 e0 0c             	shl    $0xc,%eax
+  802727:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80272d:	50                   	push   %eax
+  80272e:	e8 73 e2 ff ff       	call   8009a6 <memmove>
+	fsring_busy |= 1 << slot;
+  802733:	b8 01 00 00 00       	mov    $0x1,%eax
+  802738:	89 d9                	mov    %ebx,%ecx
+  80273a:	d3 e0                	shl    %cl,%eax
+  80273c:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802742:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802745:	c1 e0 02             	shl    $0x2,%eax
+  802748:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  80274e:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  802755:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802758:	8b 45 18             	mov    0x18(%ebp),%eax
+  80275b:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80275e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802765:	83 c4 08             	add    $0x8,%esp
+  802768:	53                   	push   %ebx
+  802769:	56                   	push   %esi
+  80276a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80276d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802770:	b8 04 00 00 00       	mov    $0x4,%eax
+  802775:	e8 7f f4 ff ff       	call   801bf9 <fsring_post>
+  80277a:	89 c3                	mov    %eax,%ebx
+  80277c:	83 c4 10             	add    $0x10,%esp
+}
+  80277f:	89 d8                	mov    %ebx,%eax
+  802781:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802784:	5b                   	pop    %ebx
+  802785:	5e                   	pop    %esi
+  802786:	5d                   	pop    %ebp
+  802787:	c3                   	ret
+		return -E_INVAL;
+  802788:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80278d:	eb f0                	jmp    80277f <fsring_write+0x93>
+
+0080278f <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80278f:	55                   	push   %ebp
+  802790:	89 e5                	mov    %esp,%ebp
+  802792:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802795:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802798:	8b 45 08             	mov    0x8(%ebp),%eax
+  80279b:	e8 17 f8 ff ff       	call   801fb7 <fsring_slot>
+  8027a0:	85 c0                	test   %eax,%eax
+  8027a2:	78 4c                	js     8027f0 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8027a4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8027a9:	89 c1                	mov    %eax,%ecx
+  8027ab:	d3 e2                	shl    %cl,%edx
+  8027ad:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8027b3:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8027b6:	c1 e2 02             	shl    $0x2,%edx
+  8027b9:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8027bf:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  8027c6:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8027c9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027cc:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8027cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027d2:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  8027d5:	83 ec 08             	sub    $0x8,%esp
+  8027d8:	50                   	push   %eax
+  8027d9:	6a 00                	push   $0x0
+  8027db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027e0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027e3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8027e8:	e8 0c f4 ff ff       	call   801bf9 <fsring_post>
+  8027ed:	83 c4 10             	add    $0x10,%esp
+}
+  8027f0:	c9                   	leave
+  8027f1:	c3                   	ret
+
+008027f2 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8027f2:	55                   	push   %ebp
+  8027f3:	89 e5                	mov    %esp,%ebp
+  8027f5:	57                   	push   %edi
+  8027f6:	56                   	push   %esi
+  8027f7:	53                   	push   %ebx
+  8027f8:	83 ec 1c             	sub    $0x1c,%esp
+  8027fb:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8027ff:	a1 00 50 80 00       	mov    0x805000,%eax
+  802804:	8b 40 48             	mov    0x48(%eax),%eax
+  802807:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  80280d:	74 12                	je     802821 <fsring_reap+0x2f>
+		return 0;
+  80280f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802814:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802817:	5b                   	pop    %ebx
+  802818:	5e                   	pop    %esi
+  802819:	5f                   	pop    %edi
+  80281a:	5d                   	pop    %ebp
+  80281b:	c3                   	ret
+		sys_yield();
+  80281c:	e8 ec e3 ff ff       	call   800c0d <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802821:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802827:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80282c:	39 c2                	cmp    %eax,%edx
+  80282e:	75 18                	jne    802848 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802830:	84 db                	test   %bl,%bl
+  802832:	0f 84 21 01 00 00    	je     802959 <fsring_reap+0x167>
+  802838:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  80283f:	75 db                	jne    80281c <fsring_reap+0x2a>
+			return 0;
+  802841:	b8 00 00 00 00       	mov    $0x0,%eax
+  802846:	eb cc                	jmp    802814 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802848:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80284d:	83 e0 0f             	and    $0xf,%eax
+  802850:	83 c0 2a             	add    $0x2a,%eax
+  802853:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  80285a:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802861:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802866:	83 c0 01             	add    $0x1,%eax
+  802869:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  80286e:	83 fb 0f             	cmp    $0xf,%ebx
+  802871:	77 5b                	ja     8028ce <fsring_reap+0xdc>
+  802873:	be 01 00 00 00       	mov    $0x1,%esi
+  802878:	89 d9                	mov    %ebx,%ecx
+  80287a:	d3 e6                	shl    %cl,%esi
+  80287c:	89 f0                	mov    %esi,%eax
+  80287e:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  802884:	74 48                	je     8028ce <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802886:	89 d8                	mov    %ebx,%eax
+  802888:	c1 e0 0c             	shl    $0xc,%eax
+  80288b:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802891:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802894:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802897:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  80289e:	83 f8 03             	cmp    $0x3,%eax
+  8028a1:	74 40                	je     8028e3 <fsring_reap+0xf1>
+  8028a3:	83 f8 05             	cmp    $0x5,%eax
+  8028a6:	74 64                	je     80290c <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8028a8:	f7 d6                	not    %esi
+  8028aa:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8028b0:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8028b3:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  8028ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028bd:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8028bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028c2:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8028c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028c9:	e9 46 ff ff ff       	jmp    802814 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8028ce:	53                   	push   %ebx
+  8028cf:	68 58 3d 80 00       	push   $0x803d58
+  8028d4:	68 8f 02 00 00       	push   $0x28f
+  8028d9:	68 30 3d 80 00       	push   $0x803d30
+  8028de:	e8 74 d8 ff ff       	call   800157 <_panic>
+		if (cqe.cqe_result > 0)
+  8028e3:	85 ff                	test   %edi,%edi
+  8028e5:	7e c1                	jle    8028a8 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8028e7:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8028ea:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8028ef:	39 c7                	cmp    %eax,%edi
+  8028f1:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8028f4:	50                   	push   %eax
+  8028f5:	ff 75 e4             	push   -0x1c(%ebp)
+  8028f8:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8028fb:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  802902:	e8 9f e0 ff ff       	call   8009a6 <memmove>
+  802907:	83 c4 10             	add    $0x10,%esp
+  80290a:	eb 9c                	jmp    8028a8 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80290c:	85 ff                	test   %edi,%edi
+  80290e:	75 98                	jne    8028a8 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802910:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802913:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80291a:	83 ec 08             	sub    $0x8,%esp
+  80291d:	ff 75 e4             	push   -0x1c(%ebp)
+  802920:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802923:	51                   	push   %ecx
+  802924:	e8 f7 de ff ff       	call   800820 <strcpy>
+			st->st_size = ret->ret_size;
+  802929:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80292c:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802932:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802935:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80293b:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802941:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802947:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  80294e:	40 80 00 
+  802951:	83 c4 10             	add    $0x10,%esp
+  802954:	e9 4f ff ff ff       	jmp    8028a8 <fsring_reap+0xb6>
+			return 0;
+  802959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80295e:	e9 b1 fe ff ff       	jmp    802814 <fsring_reap+0x22>
+
+00802963 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802963:	55                   	push   %ebp
+  802964:	89 e5                	mov    %esp,%ebp
+  802966:	57                   	push   %edi
+  802967:	56                   	push   %esi
+  802968:	53                   	push   %ebx
+  802969:	83 ec 28             	sub    $0x28,%esp
+  80296c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80296f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802972:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802975:	53                   	push   %ebx
+  802976:	e8 6a de ff ff       	call   8007e5 <strlen>
+  80297b:	83 c4 10             	add    $0x10,%esp
+  80297e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802983:	0f 8f 02 01 00 00    	jg     802a8b <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802989:	83 ec 08             	sub    $0x8,%esp
+  80298c:	53                   	push   %ebx
+  80298d:	68 00 60 80 00       	push   $0x806000
+  802992:	e8 89 de ff ff       	call   800820 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802997:	83 c4 10             	add    $0x10,%esp
+  80299a:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8029a0:	76 69                	jbe    802a0b <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8029a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029a5:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8029ab:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8029b0:	29 d1                	sub    %edx,%ecx
+  8029b2:	39 f9                	cmp    %edi,%ecx
+  8029b4:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8029b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029ba:	89 f9                	mov    %edi,%ecx
+  8029bc:	01 c1                	add    %eax,%ecx
+  8029be:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8029c1:	eb 0f                	jmp    8029d2 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  8029c3:	0f b6 10             	movzbl (%eax),%edx
+  8029c6:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8029c8:	05 00 10 00 00       	add    $0x1000,%eax
+  8029cd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8029d2:	39 c8                	cmp    %ecx,%eax
+  8029d4:	72 ed                	jb     8029c3 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  8029d6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8029d9:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  8029df:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8029e5:	83 ec 0c             	sub    $0xc,%esp
+  8029e8:	6a 07                	push   $0x7
+  8029ea:	89 f9                	mov    %edi,%ecx
+  8029ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029ef:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8029f4:	e8 3f f1 ff ff       	call   801b38 <fsipc_pages>
+  8029f9:	89 c7                	mov    %eax,%edi
+  8029fb:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8029fe:	85 f6                	test   %esi,%esi
+  802a00:	74 7f                	je     802a81 <file_slurp+0x11e>
+  802a02:	8d 43 01             	lea    0x1(%ebx),%eax
+  802a05:	85 ff                	test   %edi,%edi
+  802a07:	79 3c                	jns    802a45 <file_slurp+0xe2>
+  802a09:	eb 76                	jmp    802a81 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802a0b:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802a11:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a16:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802a1b:	e8 ba f2 ff ff       	call   801cda <fsipc>
+  802a20:	89 c7                	mov    %eax,%edi
+  802a22:	85 c0                	test   %eax,%eax
+  802a24:	7e d8                	jle    8029fe <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802a26:	83 ec 04             	sub    $0x4,%esp
+  802a29:	50                   	push   %eax
+  802a2a:	68 08 60 80 00       	push   $0x806008
+  802a2f:	ff 75 0c             	push   0xc(%ebp)
+  802a32:	e8 6f df ff ff       	call   8009a6 <memmove>
+  802a37:	83 c4 10             	add    $0x10,%esp
+  802a3a:	eb c2                	jmp    8029fe <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802a3c:	80 fa 2f             	cmp    $0x2f,%dl
+  802a3f:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802a42:	83 c0 01             	add    $0x1,%eax
+  802a45:	89 c1                	mov    %eax,%ecx
+  802a47:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802a4b:	84 d2                	test   %dl,%dl
+  802a4d:	75 ed                	jne    802a3c <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802a4f:	83 ec 04             	sub    $0x4,%esp
+  802a52:	68 80 00 00 00       	push   $0x80
+  802a57:	53                   	push   %ebx
+  802a58:	56                   	push   %esi
+  802a59:	e8 38 de ff ff       	call   800896 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802a5e:	a1 00 60 80 00       	mov    0x806000,%eax
+  802a63:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802a69:	a1 04 60 80 00       	mov    0x806004,%eax
+  802a6e:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802a74:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  802a7b:	40 80 00 
+  802a7e:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802a81:	89 f8                	mov    %edi,%eax
+  802a83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a86:	5b                   	pop    %ebx
+  802a87:	5e                   	pop    %esi
+  802a88:	5f                   	pop    %edi
+  802a89:	5d                   	pop    %ebp
+  802a8a:	c3                   	ret
+		return -E_BAD_PATH;
+  802a8b:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802a90:	eb ef                	jmp    802a81 <file_slurp+0x11e>
+
+00802a92 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802a92:	55                   	push   %ebp
+  802a93:	89 e5                	mov    %esp,%ebp
+  802a95:	53                   	push   %ebx
+  802a96:	83 ec 10             	sub    $0x10,%esp
+  802a99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802a9c:	53                   	push   %ebx
+  802a9d:	e8 43 dd ff ff       	call   8007e5 <strlen>
+  802aa2:	83 c4 10             	add    $0x10,%esp
+  802aa5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802aaa:	7f 25                	jg     802ad1 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802aac:	83 ec 08             	sub    $0x8,%esp
+  802aaf:	53                   	push   %ebx
+  802ab0:	68 00 60 80 00       	push   $0x806000
+  802ab5:	e8 66 dd ff ff       	call   800820 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802aba:	ba 00 00 00 00       	mov    $0x0,%edx
+  802abf:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ac4:	e8 11 f2 ff ff       	call   801cda <fsipc>
+  802ac9:	83 c4 10             	add    $0x10,%esp
+}
+  802acc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802acf:	c9                   	leave
+  802ad0:	c3                   	ret
+		return -E_BAD_PATH;
+  802ad1:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802ad6:	eb f4                	jmp    802acc <remove+0x3a>
+
+00802ad8 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802ad8:	55                   	push   %ebp
+  802ad9:	89 e5                	mov    %esp,%ebp
+  802adb:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802ade:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae3:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ae8:	e8 ed f1 ff ff       	call   801cda <fsipc>
+}
+  802aed:	c9                   	leave
+  802aee:	c3                   	ret
+
+00802aef <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802aef:	55                   	push   %ebp
+  802af0:	89 e5                	mov    %esp,%ebp
+  802af2:	57                   	push   %edi
+  802af3:	56                   	push   %esi
+  802af4:	53                   	push   %ebx
+  802af5:	83 ec 18             	sub    $0x18,%esp
+  802af8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802afb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802afe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802b01:	57                   	push   %edi
+  802b02:	e8 de dc ff ff       	call   8007e5 <strlen>
+  802b07:	83 c4 10             	add    $0x10,%esp
+  802b0a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802b0f:	7f 4c                	jg     802b5d <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802b11:	83 ec 08             	sub    $0x8,%esp
+  802b14:	57                   	push   %edi
+  802b15:	68 00 60 80 00       	push   $0x806000
+  802b1a:	e8 01 dd ff ff       	call   800820 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802b1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b24:	b8 10 00 00 00       	mov    $0x10,%eax
+  802b29:	e8 ac f1 ff ff       	call   801cda <fsipc>
+  802b2e:	83 c4 10             	add    $0x10,%esp
+  802b31:	85 c0                	test   %eax,%eax
+  802b33:	78 20                	js     802b55 <defrag+0x66>
+		return r;
+	if (before)
+  802b35:	85 f6                	test   %esi,%esi
+  802b37:	74 07                	je     802b40 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802b39:	a1 00 60 80 00       	mov    0x806000,%eax
+  802b3e:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802b40:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802b45:	85 db                	test   %ebx,%ebx
+  802b47:	74 0c                	je     802b55 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802b49:	a1 04 60 80 00       	mov    0x806004,%eax
+  802b4e:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802b50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b58:	5b                   	pop    %ebx
+  802b59:	5e                   	pop    %esi
+  802b5a:	5f                   	pop    %edi
+  802b5b:	5d                   	pop    %ebp
+  802b5c:	c3                   	ret
+		return -E_BAD_PATH;
+  802b5d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802b62:	eb f1                	jmp    802b55 <defrag+0x66>
+
+00802b64 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802b64:	55                   	push   %ebp
+  802b65:	89 e5                	mov    %esp,%ebp
+  802b67:	53                   	push   %ebx
+  802b68:	83 ec 04             	sub    $0x4,%esp
+  802b6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802b6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b73:	b8 11 00 00 00       	mov    $0x11,%eax
+  802b78:	e8 5d f1 ff ff       	call   801cda <fsipc>
+  802b7d:	85 c0                	test   %eax,%eax
+  802b7f:	78 34                	js     802bb5 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802b81:	a1 00 60 80 00       	mov    0x806000,%eax
+  802b86:	89 03                	mov    %eax,(%ebx)
+  802b88:	a1 04 60 80 00       	mov    0x806004,%eax
+  802b8d:	89 43 04             	mov    %eax,0x4(%ebx)
+  802b90:	a1 08 60 80 00       	mov    0x806008,%eax
+  802b95:	89 43 08             	mov    %eax,0x8(%ebx)
+  802b98:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  802b9d:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802ba0:	a1 10 60 80 00       	mov    0x806010,%eax
+  802ba5:	89 43 10             	mov    %eax,0x10(%ebx)
+  802ba8:	a1 14 60 80 00       	mov    0x806014,%eax
+  802bad:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bb8:	c9                   	leave
+  802bb9:	c3                   	ret
+
+00802bba <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802bba:	55                   	push   %ebp
+  802bbb:	89 e5                	mov    %esp,%ebp
+  802bbd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802bc0:	68 71 3d 80 00       	push   $0x803d71
+  802bc5:	ff 75 0c             	push   0xc(%ebp)
+  802bc8:	e8 53 dc ff ff       	call   800820 <strcpy>
+	return 0;
+}
+  802bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd2:	c9                   	leave
+  802bd3:	c3                   	ret
+
+00802bd4 <devsock_close>:
+{
+  802bd4:	55                   	push   %ebp
+  802bd5:	89 e5                	mov    %esp,%ebp
+  802bd7:	53                   	push   %ebx
+  802bd8:	83 ec 10             	sub    $0x10,%esp
+  802bdb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802bde:	53                   	push   %ebx
+  802bdf:	e8 95 09 00 00       	call   803579 <pageref>
+  802be4:	89 c2                	mov    %eax,%edx
+  802be6:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802be9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802bee:	83 fa 01             	cmp    $0x1,%edx
+  802bf1:	74 05                	je     802bf8 <devsock_close+0x24>
+}
+  802bf3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bf6:	c9                   	leave
+  802bf7:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802bf8:	83 ec 0c             	sub    $0xc,%esp
+  802bfb:	ff 73 0c             	push   0xc(%ebx)
+  802bfe:	e8 b7 02 00 00       	call   802eba <nsipc_close>
+  802c03:	83 c4 10             	add    $0x10,%esp
+  802c06:	eb eb                	jmp    802bf3 <devsock_close+0x1f>
+
+00802c08 <devsock_write>:
+{
+  802c08:	55                   	push   %ebp
+  802c09:	89 e5                	mov    %esp,%ebp
+  802c0b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802c0e:	6a 00                	push   $0x0
+  802c10:	ff 75 10             	push   0x10(%ebp)
+  802c13:	ff 75 0c             	push   0xc(%ebp)
+  802c16:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c19:	ff 70 0c             	push   0xc(%eax)
+  802c1c:	e8 79 03 00 00       	call   802f9a <nsipc_send>
+}
+  802c21:	c9                   	leave
+  802c22:	c3                   	ret
+
+00802c23 <devsock_read>:
+{
+  802c23:	55                   	push   %ebp
+  802c24:	89 e5                	mov    %esp,%ebp
+  802c26:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802c29:	6a 00                	push   $0x0
+  802c2b:	ff 75 10             	push   0x10(%ebp)
+  802c2e:	ff 75 0c             	push   0xc(%ebp)
+  802c31:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c34:	ff 70 0c             	push   0xc(%eax)
+  802c37:	e8 ef 02 00 00       	call   802f2b <nsipc_recv>
+}
+  802c3c:	c9                   	leave
+  802c3d:	c3                   	ret
+
+00802c3e <fd2sockid>:
+{
+  802c3e:	55                   	push   %ebp
+  802c3f:	89 e5                	mov    %esp,%ebp
+  802c41:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802c44:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802c47:	52                   	push   %edx
+  802c48:	50                   	push   %eax
+  802c49:	e8 54 e9 ff ff       	call   8015a2 <fd_lookup>
+  802c4e:	83 c4 10             	add    $0x10,%esp
+  802c51:	85 c0                	test   %eax,%eax
+  802c53:	78 10                	js     802c65 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802c55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c58:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  802c5e:	39 08                	cmp    %ecx,(%eax)
+  802c60:	75 05                	jne    802c67 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802c62:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802c65:	c9                   	leave
+  802c66:	c3                   	ret
+		return -E_NOT_SUPP;
+  802c67:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802c6c:	eb f7                	jmp    802c65 <fd2sockid+0x27>
+
+00802c6e <alloc_sockfd>:
+{
+  802c6e:	55                   	push   %ebp
+  802c6f:	89 e5                	mov    %esp,%ebp
+  802c71:	56                   	push   %esi
+  802c72:	53                   	push   %ebx
+  802c73:	83 ec 1c             	sub    $0x1c,%esp
+  802c76:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802c78:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c7b:	50                   	push   %eax
+  802c7c:	e8 cb e8 ff ff       	call   80154c <fd_alloc>
+  802c81:	89 c3                	mov    %eax,%ebx
+  802c83:	83 c4 10             	add    $0x10,%esp
+  802c86:	85 c0                	test   %eax,%eax
+  802c88:	78 43                	js     802ccd <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802c8a:	83 ec 04             	sub    $0x4,%esp
+  802c8d:	68 07 04 00 00       	push   $0x407
+  802c92:	ff 75 f4             	push   -0xc(%ebp)
+  802c95:	6a 00                	push   $0x0
+  802c97:	e8 90 df ff ff       	call   800c2c <sys_page_alloc>
+  802c9c:	89 c3                	mov    %eax,%ebx
+  802c9e:	83 c4 10             	add    $0x10,%esp
+  802ca1:	85 c0                	test   %eax,%eax
+  802ca3:	78 28                	js     802ccd <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802ca5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ca8:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802cae:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802cb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cb3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802cba:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802cbd:	83 ec 0c             	sub    $0xc,%esp
+  802cc0:	50                   	push   %eax
+  802cc1:	e8 5f e8 ff ff       	call   801525 <fd2num>
+  802cc6:	89 c3                	mov    %eax,%ebx
+  802cc8:	83 c4 10             	add    $0x10,%esp
+  802ccb:	eb 0c                	jmp    802cd9 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802ccd:	83 ec 0c             	sub    $0xc,%esp
+  802cd0:	56                   	push   %esi
+  802cd1:	e8 e4 01 00 00       	call   802eba <nsipc_close>
+		return r;
+  802cd6:	83 c4 10             	add    $0x10,%esp
+}
+  802cd9:	89 d8                	mov    %ebx,%eax
+  802cdb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cde:	5b                   	pop    %ebx
+  802cdf:	5e                   	pop    %esi
+  802ce0:	5d                   	pop    %ebp
+  802ce1:	c3                   	ret
+
+00802ce2 <accept>:
+{
+  802ce2:	55                   	push   %ebp
+  802ce3:	89 e5                	mov    %esp,%ebp
+  802ce5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ce8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ceb:	e8 4e ff ff ff       	call   802c3e <fd2sockid>
+  802cf0:	85 c0                	test   %eax,%eax
+  802cf2:	78 1b                	js     802d0f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802cf4:	83 ec 04             	sub    $0x4,%esp
+  802cf7:	ff 75 10             	push   0x10(%ebp)
+  802cfa:	ff 75 0c             	push   0xc(%ebp)
+  802cfd:	50                   	push   %eax
+  802cfe:	e8 0e 01 00 00       	call   802e11 <nsipc_accept>
+  802d03:	83 c4 10             	add    $0x10,%esp
+  802d06:	85 c0                	test   %eax,%eax
+  802d08:	78 05                	js     802d0f <accept+0x2d>
+	return alloc_sockfd(r);
+  802d0a:	e8 5f ff ff ff       	call   802c6e <alloc_sockfd>
+}
+  802d0f:	c9                   	leave
+  802d10:	c3                   	ret
+
+00802d11 <bind>:
+{
+  802d11:	55                   	push   %ebp
+  802d12:	89 e5                	mov    %esp,%ebp
+  802d14:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d17:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d1a:	e8 1f ff ff ff       	call   802c3e <fd2sockid>
+  802d1f:	85 c0                	test   %eax,%eax
+  802d21:	78 12                	js     802d35 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802d23:	83 ec 04             	sub    $0x4,%esp
+  802d26:	ff 75 10             	push   0x10(%ebp)
+  802d29:	ff 75 0c             	push   0xc(%ebp)
+  802d2c:	50                   	push   %eax
+  802d2d:	e8 31 01 00 00       	call   802e63 <nsipc_bind>
+  802d32:	83 c4 10             	add    $0x10,%esp
+}
+  802d35:	c9                   	leave
+  802d36:	c3                   	ret
+
+00802d37 <shutdown>:
+{
+  802d37:	55                   	push   %ebp
+  802d38:	89 e5                	mov    %esp,%ebp
+  802d3a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d40:	e8 f9 fe ff ff       	call   802c3e <fd2sockid>
+  802d45:	85 c0                	test   %eax,%eax
+  802d47:	78 0f                	js     802d58 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802d49:	83 ec 08             	sub    $0x8,%esp
+  802d4c:	ff 75 0c             	push   0xc(%ebp)
+  802d4f:	50                   	push   %eax
+  802d50:	e8 43 01 00 00       	call   802e98 <nsipc_shutdown>
+  802d55:	83 c4 10             	add    $0x10,%esp
+}
+  802d58:	c9                   	leave
+  802d59:	c3                   	ret
+
+00802d5a <connect>:
+{
+  802d5a:	55                   	push   %ebp
+  802d5b:	89 e5                	mov    %esp,%ebp
+  802d5d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d60:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d63:	e8 d6 fe ff ff       	call   802c3e <fd2sockid>
+  802d68:	85 c0                	test   %eax,%eax
+  802d6a:	78 12                	js     802d7e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802d6c:	83 ec 04             	sub    $0x4,%esp
+  802d6f:	ff 75 10             	push   0x10(%ebp)
+  802d72:	ff 75 0c             	push   0xc(%ebp)
+  802d75:	50                   	push   %eax
+  802d76:	e8 59 01 00 00       	call   802ed4 <nsipc_connect>
+  802d7b:	83 c4 10             	add    $0x10,%esp
+}
+  802d7e:	c9                   	leave
+  802d7f:	c3                   	ret
+
+00802d80 <listen>:
+{
+  802d80:	55                   	push   %ebp
+  802d81:	89 e5                	mov    %esp,%ebp
+  802d83:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d86:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d89:	e8 b0 fe ff ff       	call   802c3e <fd2sockid>
+  802d8e:	85 c0                	test   %eax,%eax
+  802d90:	78 0f                	js     802da1 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802d92:	83 ec 08             	sub    $0x8,%esp
+  802d95:	ff 75 0c             	push   0xc(%ebp)
+  802d98:	50                   	push   %eax
+  802d99:	e8 6b 01 00 00       	call   802f09 <nsipc_listen>
+  802d9e:	83 c4 10             	add    $0x10,%esp
+}
+  802da1:	c9                   	leave
+  802da2:	c3                   	ret
+
+00802da3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802da3:	55                   	push   %ebp
+  802da4:	89 e5                	mov    %esp,%ebp
+  802da6:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802da9:	ff 75 10             	push   0x10(%ebp)
+  802dac:	ff 75 0c             	push   0xc(%ebp)
+  802daf:	ff 75 08             	push   0x8(%ebp)
+  802db2:	e8 41 02 00 00       	call   802ff8 <nsipc_socket>
+  802db7:	83 c4 10             	add    $0x10,%esp
+  802dba:	85 c0                	test   %eax,%eax
+  802dbc:	78 05                	js     802dc3 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802dbe:	e8 ab fe ff ff       	call   802c6e <alloc_sockfd>
+}
+  802dc3:	c9                   	leave
+  802dc4:	c3                   	ret
+
+00802dc5 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802dc5:	55                   	push   %ebp
+  802dc6:	89 e5                	mov    %esp,%ebp
+  802dc8:	53                   	push   %ebx
+  802dc9:	83 ec 04             	sub    $0x4,%esp
+  802dcc:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802dce:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802dd5:	74 26                	je     802dfd <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802dd7:	6a 07                	push   $0x7
+  802dd9:	68 00 80 80 00       	push   $0x808000
+  802dde:	53                   	push   %ebx
+  802ddf:	ff 35 00 90 80 00    	push   0x809000
+  802de5:	e8 c3 e5 ff ff       	call   8013ad <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802dea:	83 c4 0c             	add    $0xc,%esp
+  802ded:	6a 00                	push   $0x0
+  802def:	6a 00                	push   $0x0
+  802df1:	6a 00                	push   $0x0
+  802df3:	e8 4a e5 ff ff       	call   801342 <ipc_recv>
+}
+  802df8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dfb:	c9                   	leave
+  802dfc:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802dfd:	83 ec 0c             	sub    $0xc,%esp
+  802e00:	6a 02                	push   $0x2
+  802e02:	e8 df e6 ff ff       	call   8014e6 <ipc_find_env>
+  802e07:	a3 00 90 80 00       	mov    %eax,0x809000
+  802e0c:	83 c4 10             	add    $0x10,%esp
+  802e0f:	eb c6                	jmp    802dd7 <nsipc+0x12>
+
+00802e11 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802e11:	55                   	push   %ebp
+  802e12:	89 e5                	mov    %esp,%ebp
+  802e14:	56                   	push   %esi
+  802e15:	53                   	push   %ebx
+  802e16:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802e19:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e1c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802e21:	8b 06                	mov    (%esi),%eax
+  802e23:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802e28:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e2d:	e8 93 ff ff ff       	call   802dc5 <nsipc>
+  802e32:	89 c3                	mov    %eax,%ebx
+  802e34:	85 c0                	test   %eax,%eax
+  802e36:	79 09                	jns    802e41 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802e38:	89 d8                	mov    %ebx,%eax
+  802e3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e3d:	5b                   	pop    %ebx
+  802e3e:	5e                   	pop    %esi
+  802e3f:	5d                   	pop    %ebp
+  802e40:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802e41:	83 ec 04             	sub    $0x4,%esp
+  802e44:	ff 35 10 80 80 00    	push   0x808010
+  802e4a:	68 00 80 80 00       	push   $0x808000
+  802e4f:	ff 75 0c             	push   0xc(%ebp)
+  802e52:	e8 4f db ff ff       	call   8009a6 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802e57:	a1 10 80 80 00       	mov    0x808010,%eax
+  802e5c:	89 06                	mov    %eax,(%esi)
+  802e5e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802e61:	eb d5                	jmp    802e38 <nsipc_accept+0x27>
+
+00802e63 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802e63:	55                   	push   %ebp
+  802e64:	89 e5                	mov    %esp,%ebp
+  802e66:	53                   	push   %ebx
+  802e67:	83 ec 08             	sub    $0x8,%esp
+  802e6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802e6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e70:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802e75:	53                   	push   %ebx
+  802e76:	ff 75 0c             	push   0xc(%ebp)
+  802e79:	68 04 80 80 00       	push   $0x808004
+  802e7e:	e8 23 db ff ff       	call   8009a6 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802e83:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802e89:	b8 02 00 00 00       	mov    $0x2,%eax
+  802e8e:	e8 32 ff ff ff       	call   802dc5 <nsipc>
+}
+  802e93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e96:	c9                   	leave
+  802e97:	c3                   	ret
+
+00802e98 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802e98:	55                   	push   %ebp
+  802e99:	89 e5                	mov    %esp,%ebp
+  802e9b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802e9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ea1:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802ea6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ea9:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802eae:	b8 03 00 00 00       	mov    $0x3,%eax
+  802eb3:	e8 0d ff ff ff       	call   802dc5 <nsipc>
+}
+  802eb8:	c9                   	leave
+  802eb9:	c3                   	ret
+
+00802eba <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802eba:	55                   	push   %ebp
+  802ebb:	89 e5                	mov    %esp,%ebp
+  802ebd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802ec0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ec3:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802ec8:	b8 04 00 00 00       	mov    $0x4,%eax
+  802ecd:	e8 f3 fe ff ff       	call   802dc5 <nsipc>
+}
+  802ed2:	c9                   	leave
+  802ed3:	c3                   	ret
+
+00802ed4 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802ed4:	55                   	push   %ebp
+  802ed5:	89 e5                	mov    %esp,%ebp
+  802ed7:	53                   	push   %ebx
+  802ed8:	83 ec 08             	sub    $0x8,%esp
+  802edb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802ede:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ee1:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802ee6:	53                   	push   %ebx
+  802ee7:	ff 75 0c             	push   0xc(%ebp)
+  802eea:	68 04 80 80 00       	push   $0x808004
+  802eef:	e8 b2 da ff ff       	call   8009a6 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802ef4:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802efa:	b8 05 00 00 00       	mov    $0x5,%eax
+  802eff:	e8 c1 fe ff ff       	call   802dc5 <nsipc>
+}
+  802f04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f07:	c9                   	leave
+  802f08:	c3                   	ret
+
+00802f09 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802f09:	55                   	push   %ebp
+  802f0a:	89 e5                	mov    %esp,%ebp
+  802f0c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802f0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f12:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802f17:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f1a:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802f1f:	b8 06 00 00 00       	mov    $0x6,%eax
+  802f24:	e8 9c fe ff ff       	call   802dc5 <nsipc>
+}
+  802f29:	c9                   	leave
+  802f2a:	c3                   	ret
+
+00802f2b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802f2b:	55                   	push   %ebp
+  802f2c:	89 e5                	mov    %esp,%ebp
+  802f2e:	56                   	push   %esi
+  802f2f:	53                   	push   %ebx
+  802f30:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802f33:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f36:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802f3b:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802f41:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f44:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802f49:	b8 07 00 00 00       	mov    $0x7,%eax
+  802f4e:	e8 72 fe ff ff       	call   802dc5 <nsipc>
+  802f53:	89 c3                	mov    %eax,%ebx
+  802f55:	85 c0                	test   %eax,%eax
+  802f57:	78 22                	js     802f7b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802f59:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802f5e:	39 c6                	cmp    %eax,%esi
+  802f60:	0f 4e c6             	cmovle %esi,%eax
+  802f63:	39 c3                	cmp    %eax,%ebx
+  802f65:	7f 1d                	jg     802f84 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802f67:	83 ec 04             	sub    $0x4,%esp
+  802f6a:	53                   	push   %ebx
+  802f6b:	68 00 80 80 00       	push   $0x808000
+  802f70:	ff 75 0c             	push   0xc(%ebp)
+  802f73:	e8 2e da ff ff       	call   8009a6 <memmove>
+  802f78:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802f7b:	89 d8                	mov    %ebx,%eax
+  802f7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f80:	5b                   	pop    %ebx
+  802f81:	5e                   	pop    %esi
+  802f82:	5d                   	pop    %ebp
+  802f83:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802f84:	68 7d 3d 80 00       	push   $0x803d7d
+  802f89:	68 2c 3c 80 00       	push   $0x803c2c
+  802f8e:	6a 62                	push   $0x62
+  802f90:	68 92 3d 80 00       	push   $0x803d92
+  802f95:	e8 bd d1 ff ff       	call   800157 <_panic>
+
+00802f9a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802f9a:	55                   	push   %ebp
+  802f9b:	89 e5                	mov    %esp,%ebp
+  802f9d:	53                   	push   %ebx
+  802f9e:	83 ec 04             	sub    $0x4,%esp
+  802fa1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802fa4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fa7:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802fac:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802fb2:	7f 2e                	jg     802fe2 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802fb4:	83 ec 04             	sub    $0x4,%esp
+  802fb7:	53                   	push   %ebx
+  802fb8:	ff 75 0c             	push   0xc(%ebp)
+  802fbb:	68 0c 80 80 00       	push   $0x80800c
+  802fc0:	e8 e1 d9 ff ff       	call   8009a6 <memmove>
+	nsipcbuf.send.req_size = size;
+  802fc5:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802fcb:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fce:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802fd3:	b8 08 00 00 00       	mov    $0x8,%eax
+  802fd8:	e8 e8 fd ff ff       	call   802dc5 <nsipc>
+}
+  802fdd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fe0:	c9                   	leave
+  802fe1:	c3                   	ret
+	assert(size < 1600);
+  802fe2:	68 9e 3d 80 00       	push   $0x803d9e
+  802fe7:	68 2c 3c 80 00       	push   $0x803c2c
+  802fec:	6a 6d                	push   $0x6d
+  802fee:	68 92 3d 80 00       	push   $0x803d92
+  802ff3:	e8 5f d1 ff ff       	call   800157 <_panic>
+
+00802ff8 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802ff8:	55                   	push   %ebp
+  802ff9:	89 e5                	mov    %esp,%ebp
+  802ffb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802ffe:	8b 45 08             	mov    0x8(%ebp),%eax
+  803001:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  803006:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803009:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  80300e:	8b 45 10             	mov    0x10(%ebp),%eax
+  803011:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  803016:	b8 09 00 00 00       	mov    $0x9,%eax
+  80301b:	e8 a5 fd ff ff       	call   802dc5 <nsipc>
+}
+  803020:	c9                   	leave
+  803021:	c3                   	ret
+
+00803022 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803022:	55                   	push   %ebp
+  803023:	89 e5                	mov    %esp,%ebp
+  803025:	56                   	push   %esi
+  803026:	53                   	push   %ebx
+  803027:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80302a:	83 ec 0c             	sub    $0xc,%esp
+  80302d:	ff 75 08             	push   0x8(%ebp)
+  803030:	e8 00 e5 ff ff       	call   801535 <fd2data>
+  803035:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803037:	83 c4 08             	add    $0x8,%esp
+  80303a:	68 aa 3d 80 00       	push   $0x803daa
+  80303f:	53                   	push   %ebx
+  803040:	e8 db d7 ff ff       	call   800820 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803045:	8b 46 04             	mov    0x4(%esi),%eax
+  803048:	2b 06                	sub    (%esi),%eax
+  80304a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803050:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803057:	00 00 00 
+	stat->st_dev = &devpipe;
+  80305a:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  803061:	40 80 00 
+	return 0;
+}
+  803064:	b8 00 00 00 00       	mov    $0x0,%eax
+  803069:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80306c:	5b                   	pop    %ebx
+  80306d:	5e                   	pop    %esi
+  80306e:	5d                   	pop    %ebp
+  80306f:	c3                   	ret
+
+00803070 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803070:	55                   	push   %ebp
+  803071:	89 e5                	mov    %esp,%ebp
+  803073:	53                   	push   %ebx
+  803074:	83 ec 0c             	sub    $0xc,%esp
+  803077:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80307a:	53                   	push   %ebx
+  80307b:	6a 00                	push   $0x0
+  80307d:	e8 37 dc ff ff       	call   800cb9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803082:	89 1c 24             	mov    %ebx,(%esp)
+  803085:	e8 ab e4 ff ff       	call   801535 <fd2data>
+  80308a:	83 c4 08             	add    $0x8,%esp
+  80308d:	50                   	push   %eax
+  80308e:	6a 00                	push   $0x0
+  803090:	e8 24 dc ff ff       	call   800cb9 <sys_page_unmap>
+}
+  803095:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803098:	c9                   	leave
+  803099:	c3                   	ret
+
+0080309a <_pipeisclosed>:
+{
+  80309a:	55                   	push   %ebp
+  80309b:	89 e5                	mov    %esp,%ebp
+  80309d:	57                   	push   %edi
+  80309e:	56                   	push   %esi
+  80309f:	53                   	push   %ebx
+  8030a0:	83 ec 1c             	sub    $0x1c,%esp
+  8030a3:	89 c7                	mov    %eax,%edi
+  8030a5:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8030a7:	a1 00 50 80 00       	mov    0x805000,%eax
+  8030ac:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8030af:	83 ec 0c             	sub    $0xc,%esp
+  8030b2:	57                   	push   %edi
+  8030b3:	e8 c1 04 00 00       	call   803579 <pageref>
+  8030b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030bb:	89 34 24             	mov    %esi,(%esp)
+  8030be:	e8 b6 04 00 00       	call   803579 <pageref>
+		nn = thisenv->env_runs;
+  8030c3:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8030c9:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8030cc:	83 c4 10             	add    $0x10,%esp
+  8030cf:	39 cb                	cmp    %ecx,%ebx
+  8030d1:	74 1b                	je     8030ee <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8030d3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8030d6:	75 cf                	jne    8030a7 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8030d8:	8b 42 58             	mov    0x58(%edx),%eax
+  8030db:	6a 01                	push   $0x1
+  8030dd:	50                   	push   %eax
+  8030de:	53                   	push   %ebx
+  8030df:	68 b1 3d 80 00       	push   $0x803db1
+  8030e4:	e8 49 d1 ff ff       	call   800232 <cprintf>
+  8030e9:	83 c4 10             	add    $0x10,%esp
+  8030ec:	eb b9                	jmp    8030a7 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8030ee:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8030f1:	0f 94 c0             	sete   %al
+  8030f4:	0f b6 c0             	movzbl %al,%eax
+}
+  8030f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030fa:	5b                   	pop    %ebx
+  8030fb:	5e                   	pop    %esi
+  8030fc:	5f                   	pop    %edi
+  8030fd:	5d                   	pop    %ebp
+  8030fe:	c3                   	ret
+
+008030ff <devpipe_write>:
+{
+  8030ff:	55                   	push   %ebp
+  803100:	89 e5                	mov    %esp,%ebp
+  803102:	57                   	push   %edi
+  803103:	56                   	push   %esi
+  803104:	53                   	push   %ebx
+  803105:	83 ec 28             	sub    $0x28,%esp
+  803108:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80310b:	56                   	push   %esi
+  80310c:	e8 24 e4 ff ff       	call   801535 <fd2data>
+  803111:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803113:	83 c4 10             	add    $0x10,%esp
+  803116:	bf 00 00 00 00       	mov    $0x0,%edi
+  80311b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80311e:	75 09                	jne    803129 <devpipe_write+0x2a>
+	return i;
+  803120:	89 f8                	mov    %edi,%eax
+  803122:	eb 23                	jmp    803147 <devpipe_write+0x48>
+			sys_yield();
+  803124:	e8 e4 da ff ff       	call   800c0d <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803129:	8b 43 04             	mov    0x4(%ebx),%eax
+  80312c:	8b 0b                	mov    (%ebx),%ecx
+  80312e:	8d 51 20             	lea    0x20(%ecx),%edx
+  803131:	39 d0                	cmp    %edx,%eax
+  803133:	72 1a                	jb     80314f <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803135:	89 da                	mov    %ebx,%edx
+  803137:	89 f0                	mov    %esi,%eax
+  803139:	e8 5c ff ff ff       	call   80309a <_pipeisclosed>
+  80313e:	85 c0                	test   %eax,%eax
+  803140:	74 e2                	je     803124 <devpipe_write+0x25>
+				return 0;
+  803142:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803147:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80314a:	5b                   	pop    %ebx
+  80314b:	5e                   	pop    %esi
+  80314c:	5f                   	pop    %edi
+  80314d:	5d                   	pop    %ebp
+  80314e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80314f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803152:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803156:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803159:	89 c2                	mov    %eax,%edx
+  80315b:	c1 fa 1f             	sar    $0x1f,%edx
+  80315e:	89 d1                	mov    %edx,%ecx
+  803160:	c1 e9 1b             	shr    $0x1b,%ecx
+  803163:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803166:	83 e2 1f             	and    $0x1f,%edx
+  803169:	29 ca                	sub    %ecx,%edx
+  80316b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80316f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803173:	83 c0 01             	add    $0x1,%eax
+  803176:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803179:	83 c7 01             	add    $0x1,%edi
+  80317c:	eb 9d                	jmp    80311b <devpipe_write+0x1c>
+
+0080317e <devpipe_read>:
+{
+  80317e:	55                   	push   %ebp
+  80317f:	89 e5                	mov    %esp,%ebp
+  803181:	57                   	push   %edi
+  803182:	56                   	push   %esi
+  803183:	53                   	push   %ebx
+  803184:	83 ec 18             	sub    $0x18,%esp
+  803187:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80318a:	57                   	push   %edi
+  80318b:	e8 a5 e3 ff ff       	call   801535 <fd2data>
+  803190:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803192:	83 c4 10             	add    $0x10,%esp
+  803195:	be 00 00 00 00       	mov    $0x0,%esi
+  80319a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80319d:	75 13                	jne    8031b2 <devpipe_read+0x34>
+	return i;
+  80319f:	89 f0                	mov    %esi,%eax
+  8031a1:	eb 02                	jmp    8031a5 <devpipe_read+0x27>
+				return i;
+  8031a3:	89 f0                	mov    %esi,%eax
+}
+  8031a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031a8:	5b                   	pop    %ebx
+  8031a9:	5e                   	pop    %esi
+  8031aa:	5f                   	pop    %edi
+  8031ab:	5d                   	pop    %ebp
+  8031ac:	c3                   	ret
+			sys_yield();
+  8031ad:	e8 5b da ff ff       	call   800c0d <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8031b2:	8b 03                	mov    (%ebx),%eax
+  8031b4:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8031b7:	75 18                	jne    8031d1 <devpipe_read+0x53>
+			if (i > 0)
+  8031b9:	85 f6                	test   %esi,%esi
+  8031bb:	75 e6                	jne    8031a3 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8031bd:	89 da                	mov    %ebx,%edx
+  8031bf:	89 f8                	mov    %edi,%eax
+  8031c1:	e8 d4 fe ff ff       	call   80309a <_pipeisclosed>
+  8031c6:	85 c0                	test   %eax,%eax
+  8031c8:	74 e3                	je     8031ad <devpipe_read+0x2f>
+				return 0;
+  8031ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031cf:	eb d4                	jmp    8031a5 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8031d1:	99                   	cltd
+  8031d2:	c1 ea 1b             	shr    $0x1b,%edx
+  8031d5:	01 d0                	add    %edx,%eax
+  8031d7:	83 e0 1f             	and    $0x1f,%eax
+  8031da:	29 d0                	sub    %edx,%eax
+  8031dc:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8031e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031e4:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8031e7:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8031ea:	83 c6 01             	add    $0x1,%esi
+  8031ed:	eb ab                	jmp    80319a <devpipe_read+0x1c>
+
+008031ef <pipe>:
+{
+  8031ef:	55                   	push   %ebp
+  8031f0:	89 e5                	mov    %esp,%ebp
+  8031f2:	56                   	push   %esi
+  8031f3:	53                   	push   %ebx
+  8031f4:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8031f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031fa:	50                   	push   %eax
+  8031fb:	e8 4c e3 ff ff       	call   80154c <fd_alloc>
+  803200:	89 c3                	mov    %eax,%ebx
+  803202:	83 c4 10             	add    $0x10,%esp
+  803205:	85 c0                	test   %eax,%eax
+  803207:	0f 88 23 01 00 00    	js     803330 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80320d:	83 ec 04             	sub    $0x4,%esp
+  803210:	68 07 04 00 00       	push   $0x407
+  803215:	ff 75 f4             	push   -0xc(%ebp)
+  803218:	6a 00                	push   $0x0
+  80321a:	e8 0d da ff ff       	call   800c2c <sys_page_alloc>
+  80321f:	89 c3                	mov    %eax,%ebx
+  803221:	83 c4 10             	add    $0x10,%esp
+  803224:	85 c0                	test   %eax,%eax
+  803226:	0f 88 04 01 00 00    	js     803330 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80322c:	83 ec 0c             	sub    $0xc,%esp
+  80322f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803232:	50                   	push   %eax
+  803233:	e8 14 e3 ff ff       	call   80154c <fd_alloc>
+  803238:	89 c3                	mov    %eax,%ebx
+  80323a:	83 c4 10             	add    $0x10,%esp
+  80323d:	85 c0                	test   %eax,%eax
+  80323f:	0f 88 db 00 00 00    	js     803320 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803245:	83 ec 04             	sub    $0x4,%esp
+  803248:	68 07 04 00 00       	push   $0x407
+  80324d:	ff 75 f0             	push   -0x10(%ebp)
+  803250:	6a 00                	push   $0x0
+  803252:	e8 d5 d9 ff ff       	call   800c2c <sys_page_alloc>
+  803257:	89 c3                	mov    %eax,%ebx
+  803259:	83 c4 10             	add    $0x10,%esp
+  80325c:	85 c0                	test   %eax,%eax
+  80325e:	0f 88 bc 00 00 00    	js     803320 <pipe+0x131>
+	va = fd2data(fd0);
+  803264:	83 ec 0c             	sub    $0xc,%esp
+  803267:	ff 75 f4             	push   -0xc(%ebp)
+  80326a:	e8 c6 e2 ff ff       	call   801535 <fd2data>
+  80326f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803271:	83 c4 0c             	add    $0xc,%esp
+  803274:	68 07 04 00 00       	push   $0x407
+  803279:	50                   	push   %eax
+  80327a:	6a 00                	push   $0x0
+  80327c:	e8 ab d9 ff ff       	call   800c2c <sys_page_alloc>
+  803281:	89 c3                	mov    %eax,%ebx
+  803283:	83 c4 10             	add    $0x10,%esp
+  803286:	85 c0                	test   %eax,%eax
+  803288:	0f 88 82 00 00 00    	js     803310 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80328e:	83 ec 0c             	sub    $0xc,%esp
+  803291:	ff 75 f0             	push   -0x10(%ebp)
+  803294:	e8 9c e2 ff ff       	call   801535 <fd2data>
+  803299:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8032a0:	50                   	push   %eax
+  8032a1:	6a 00                	push   $0x0
+  8032a3:	56                   	push   %esi
+  8032a4:	6a 00                	push   $0x0
+  8032a6:	e8 cc d9 ff ff       	call   800c77 <sys_page_map>
+  8032ab:	89 c3                	mov    %eax,%ebx
+  8032ad:	83 c4 20             	add    $0x20,%esp
+  8032b0:	85 c0                	test   %eax,%eax
+  8032b2:	78 4e                	js     803302 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8032b4:	a1 60 40 80 00       	mov    0x804060,%eax
+  8032b9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032bc:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8032be:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032c1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8032c8:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8032cb:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8032cd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8032d0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8032d7:	83 ec 0c             	sub    $0xc,%esp
+  8032da:	ff 75 f4             	push   -0xc(%ebp)
+  8032dd:	e8 43 e2 ff ff       	call   801525 <fd2num>
+  8032e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032e5:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8032e7:	83 c4 04             	add    $0x4,%esp
+  8032ea:	ff 75 f0             	push   -0x10(%ebp)
+  8032ed:	e8 33 e2 ff ff       	call   801525 <fd2num>
+  8032f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032f5:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8032f8:	83 c4 10             	add    $0x10,%esp
+  8032fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803300:	eb 2e                	jmp    803330 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803302:	83 ec 08             	sub    $0x8,%esp
+  803305:	56                   	push   %esi
+  803306:	6a 00                	push   $0x0
+  803308:	e8 ac d9 ff ff       	call   800cb9 <sys_page_unmap>
+  80330d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803310:	83 ec 08             	sub    $0x8,%esp
+  803313:	ff 75 f0             	push   -0x10(%ebp)
+  803316:	6a 00                	push   $0x0
+  803318:	e8 9c d9 ff ff       	call   800cb9 <sys_page_unmap>
+  80331d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803320:	83 ec 08             	sub    $0x8,%esp
+  803323:	ff 75 f4             	push   -0xc(%ebp)
+  803326:	6a 00                	push   $0x0
+  803328:	e8 8c d9 ff ff       	call   800cb9 <sys_page_unmap>
+  80332d:	83 c4 10             	add    $0x10,%esp
+}
+  803330:	89 d8                	mov    %ebx,%eax
+  803332:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803335:	5b                   	pop    %ebx
+  803336:	5e                   	pop    %esi
+  803337:	5d                   	pop    %ebp
+  803338:	c3                   	ret
+
+00803339 <pipeisclosed>:
+{
+  803339:	55                   	push   %ebp
+  80333a:	89 e5                	mov    %esp,%ebp
+  80333c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80333f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803342:	50                   	push   %eax
+  803343:	ff 75 08             	push   0x8(%ebp)
+  803346:	e8 57 e2 ff ff       	call   8015a2 <fd_lookup>
+  80334b:	83 c4 10             	add    $0x10,%esp
+  80334e:	85 c0                	test   %eax,%eax
+  803350:	78 18                	js     80336a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803352:	83 ec 0c             	sub    $0xc,%esp
+  803355:	ff 75 f4             	push   -0xc(%ebp)
+  803358:	e8 d8 e1 ff ff       	call   801535 <fd2data>
+  80335d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80335f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803362:	e8 33 fd ff ff       	call   80309a <_pipeisclosed>
+  803367:	83 c4 10             	add    $0x10,%esp
+}
+  80336a:	c9                   	leave
+  80336b:	c3                   	ret
+
+0080336c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80336c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803371:	c3                   	ret
+
+00803372 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803372:	55                   	push   %ebp
+  803373:	89 e5                	mov    %esp,%ebp
+  803375:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803378:	68 c9 3d 80 00       	push   $0x803dc9
+  80337d:	ff 75 0c             	push   0xc(%ebp)
+  803380:	e8 9b d4 ff ff       	call   800820 <strcpy>
+	return 0;
+}
+  803385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80338a:	c9                   	leave
+  80338b:	c3                   	ret
+
+0080338c <devcons_write>:
+{
+  80338c:	55                   	push   %ebp
+  80338d:	89 e5                	mov    %esp,%ebp
+  80338f:	57                   	push   %edi
+  803390:	56                   	push   %esi
+  803391:	53                   	push   %ebx
+  803392:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803398:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80339d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8033a3:	eb 2e                	jmp    8033d3 <devcons_write+0x47>
+		m = n - tot;
+  8033a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033a8:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8033aa:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8033af:	39 c3                	cmp    %eax,%ebx
+  8033b1:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8033b4:	83 ec 04             	sub    $0x4,%esp
+  8033b7:	53                   	push   %ebx
+  8033b8:	89 f0                	mov    %esi,%eax
+  8033ba:	03 45 0c             	add    0xc(%ebp),%eax
+  8033bd:	50                   	push   %eax
+  8033be:	57                   	push   %edi
+  8033bf:	e8 e2 d5 ff ff       	call   8009a6 <memmove>
+		sys_cputs(buf, m);
+  8033c4:	83 c4 08             	add    $0x8,%esp
+  8033c7:	53                   	push   %ebx
+  8033c8:	57                   	push   %edi
+  8033c9:	e8 82 d7 ff ff       	call   800b50 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8033ce:	01 de                	add    %ebx,%esi
+  8033d0:	83 c4 10             	add    $0x10,%esp
+  8033d3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8033d6:	72 cd                	jb     8033a5 <devcons_write+0x19>
+}
+  8033d8:	89 f0                	mov    %esi,%eax
+  8033da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033dd:	5b                   	pop    %ebx
+  8033de:	5e                   	pop    %esi
+  8033df:	5f                   	pop    %edi
+  8033e0:	5d                   	pop    %ebp
+  8033e1:	c3                   	ret
+
+008033e2 <devcons_read>:
+{
+  8033e2:	55                   	push   %ebp
+  8033e3:	89 e5                	mov    %esp,%ebp
+  8033e5:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8033e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ed:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033f1:	75 07                	jne    8033fa <devcons_read+0x18>
+  8033f3:	eb 1f                	jmp    803414 <devcons_read+0x32>
+		sys_yield();
+  8033f5:	e8 13 d8 ff ff       	call   800c0d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8033fa:	e8 77 d7 ff ff       	call   800b76 <sys_cgetc>
+  8033ff:	85 c0                	test   %eax,%eax
+  803401:	74 f2                	je     8033f5 <devcons_read+0x13>
+	if (c < 0)
+  803403:	78 0f                	js     803414 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803405:	83 f8 04             	cmp    $0x4,%eax
+  803408:	74 0c                	je     803416 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80340a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80340d:	88 02                	mov    %al,(%edx)
+	return 1;
+  80340f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803414:	c9                   	leave
+  803415:	c3                   	ret
+		return 0;
+  803416:	b8 00 00 00 00       	mov    $0x0,%eax
+  80341b:	eb f7                	jmp    803414 <devcons_read+0x32>
+
+0080341d <cputchar>:
+{
+  80341d:	55                   	push   %ebp
+  80341e:	89 e5                	mov    %esp,%ebp
+  803420:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803423:	8b 45 08             	mov    0x8(%ebp),%eax
+  803426:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803429:	6a 01                	push   $0x1
+  80342b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80342e:	50                   	push   %eax
+  80342f:	e8 1c d7 ff ff       	call   800b50 <sys_cputs>
+}
+  803434:	83 c4 10             	add    $0x10,%esp
+  803437:	c9                   	leave
+  803438:	c3                   	ret
+
+00803439 <getchar>:
+{
+  803439:	55                   	push   %ebp
+  80343a:	89 e5                	mov    %esp,%ebp
+  80343c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80343f:	6a 01                	push   $0x1
+  803441:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803444:	50                   	push   %eax
+  803445:	6a 00                	push   $0x0
+  803447:	e8 bc e3 ff ff       	call   801808 <read>
+	if (r < 0)
+  80344c:	83 c4 10             	add    $0x10,%esp
+  80344f:	85 c0                	test   %eax,%eax
+  803451:	78 06                	js     803459 <getchar+0x20>
+	if (r < 1)
+  803453:	74 06                	je     80345b <getchar+0x22>
+	return c;
+  803455:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803459:	c9                   	leave
+  80345a:	c3                   	ret
+		return -E_EOF;
+  80345b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803460:	eb f7                	jmp    803459 <getchar+0x20>
+
+00803462 <iscons>:
+{
+  803462:	55                   	push   %ebp
+  803463:	89 e5                	mov    %esp,%ebp
+  803465:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803468:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80346b:	50                   	push   %eax
+  80346c:	ff 75 08             	push   0x8(%ebp)
+  80346f:	e8 2e e1 ff ff       	call   8015a2 <fd_lookup>
+  803474:	83 c4 10             	add    $0x10,%esp
+  803477:	85 c0                	test   %eax,%eax
+  803479:	78 11                	js     80348c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80347b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80347e:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  803484:	39 10                	cmp    %edx,(%eax)
+  803486:	0f 94 c0             	sete   %al
+  803489:	0f b6 c0             	movzbl %al,%eax
+}
+  80348c:	c9                   	leave
+  80348d:	c3                   	ret
+
+0080348e <opencons>:
+{
+  80348e:	55                   	push   %ebp
+  80348f:	89 e5                	mov    %esp,%ebp
+  803491:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803494:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803497:	50                   	push   %eax
+  803498:	e8 af e0 ff ff       	call   80154c <fd_alloc>
+  80349d:	83 c4 10             	add    $0x10,%esp
+  8034a0:	85 c0                	test   %eax,%eax
+  8034a2:	78 3a                	js     8034de <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8034a4:	83 ec 04             	sub    $0x4,%esp
+  8034a7:	68 07 04 00 00       	push   $0x407
+  8034ac:	ff 75 f4             	push   -0xc(%ebp)
+  8034af:	6a 00                	push   $0x0
+  8034b1:	e8 76 d7 ff ff       	call   800c2c <sys_page_alloc>
+  8034b6:	83 c4 10             	add    $0x10,%esp
+  8034b9:	85 c0                	test   %eax,%eax
+  8034bb:	78 21                	js     8034de <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8034bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034c0:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8034c6:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8034c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034cb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8034d2:	83 ec 0c             	sub    $0xc,%esp
+  8034d5:	50                   	push   %eax
+  8034d6:	e8 4a e0 ff ff       	call   801525 <fd2num>
+  8034db:	83 c4 10             	add    $0x10,%esp
+}
+  8034de:	c9                   	leave
+  8034df:	c3                   	ret
+
+008034e0 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8034e0:	55                   	push   %ebp
+  8034e1:	89 e5                	mov    %esp,%ebp
+  8034e3:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8034e6:	83 3d 04 90 80 00 00 	cmpl   $0x0,0x809004
+  8034ed:	74 0a                	je     8034f9 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8034ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034f2:	a3 04 90 80 00       	mov    %eax,0x809004
+}
+  8034f7:	c9                   	leave
+  8034f8:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034f9:	83 ec 04             	sub    $0x4,%esp
+  8034fc:	6a 07                	push   $0x7
+  8034fe:	68 00 f0 bf ee       	push   $0xeebff000
+  803503:	6a 00                	push   $0x0
+  803505:	e8 22 d7 ff ff       	call   800c2c <sys_page_alloc>
+  80350a:	83 c4 10             	add    $0x10,%esp
+  80350d:	85 c0                	test   %eax,%eax
+  80350f:	75 2c                	jne    80353d <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803511:	83 ec 08             	sub    $0x8,%esp
+  803514:	68 53 35 80 00       	push   $0x803553
+  803519:	6a 00                	push   $0x0
+  80351b:	e8 77 d8 ff ff       	call   800d97 <sys_env_set_pgfault_upcall>
+  803520:	83 c4 10             	add    $0x10,%esp
+  803523:	85 c0                	test   %eax,%eax
+  803525:	74 c8                	je     8034ef <set_pgfault_handler+0xf>
+  803527:	68 20 3e 80 00       	push   $0x803e20
+  80352c:	68 2c 3c 80 00       	push   $0x803c2c
+  803531:	6a 20                	push   $0x20
+  803533:	68 50 3e 80 00       	push   $0x803e50
+  803538:	e8 1a cc ff ff       	call   800157 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80353d:	68 d8 3d 80 00       	push   $0x803dd8
+  803542:	68 2c 3c 80 00       	push   $0x803c2c
+  803547:	6a 1e                	push   $0x1e
+  803549:	68 50 3e 80 00       	push   $0x803e50
+  80354e:	e8 04 cc ff ff       	call   800157 <_panic>
+
+00803553 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803553:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803554:	a1 04 90 80 00       	mov    0x809004,%eax
+	call *%eax
+  803559:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80355b:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80355e:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803563:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803568:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  80356c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80356f:	83 c4 08             	add    $0x8,%esp
+	popal
+  803572:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803573:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803576:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803577:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803578:	c3                   	ret
+
+00803579 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803579:	55                   	push   %ebp
+  80357a:	89 e5                	mov    %esp,%ebp
+  80357c:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80357f:	89 c2                	mov    %eax,%edx
+  803581:	c1 ea 16             	shr    $0x16,%edx
+  803584:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80358b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803590:	f6 c1 01             	test   $0x1,%cl
+  803593:	74 22                	je     8035b7 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803595:	c1 e8 0c             	shr    $0xc,%eax
+  803598:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80359f:	a8 01                	test   $0x1,%al
+  8035a1:	74 14                	je     8035b7 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8035a3:	c1 e8 0c             	shr    $0xc,%eax
+  8035a6:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8035a9:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8035b0:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8035b4:	0f b7 d2             	movzwl %dx,%edx
+}
+  8035b7:	89 d0                	mov    %edx,%eax
+  8035b9:	5d                   	pop    %ebp
+  8035ba:	c3                   	ret
+
+008035bb <dm>:
+  8035bb:	55                   	push   %ebp
+  8035bc:	57                   	push   %edi
+  8035bd:	56                   	push   %esi
+  8035be:	53                   	push   %ebx
+  8035bf:	83 ec 24             	sub    $0x24,%esp
+  8035c2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8035c6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035ca:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035ce:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035d2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035d6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035da:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8035de:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035ed:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035f4:	00 
+  8035f5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035fc:	00 
+  8035fd:	89 fb                	mov    %edi,%ebx
+  8035ff:	eb 08                	jmp    803609 <dm+0x4e>
+  803601:	83 e9 01             	sub    $0x1,%ecx
+  803604:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803607:	74 68                	je     803671 <dm+0xb6>
+  803609:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80360d:	01 c0                	add    %eax,%eax
+  80360f:	89 c6                	mov    %eax,%esi
+  803611:	89 d7                	mov    %edx,%edi
+  803613:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803617:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80361b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80361e:	d3 ea                	shr    %cl,%edx
+  803620:	f6 c1 20             	test   $0x20,%cl
+  803623:	74 04                	je     803629 <dm+0x6e>
+  803625:	89 d0                	mov    %edx,%eax
+  803627:	31 d2                	xor    %edx,%edx
+  803629:	83 e0 01             	and    $0x1,%eax
+  80362c:	89 04 24             	mov    %eax,(%esp)
+  80362f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803636:	00 
+  803637:	8b 04 24             	mov    (%esp),%eax
+  80363a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80363e:	09 f0                	or     %esi,%eax
+  803640:	09 fa                	or     %edi,%edx
+  803642:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803646:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80364a:	39 f0                	cmp    %esi,%eax
+  80364c:	89 d5                	mov    %edx,%ebp
+  80364e:	19 fd                	sbb    %edi,%ebp
+  803650:	72 af                	jb     803601 <dm+0x46>
+  803652:	29 f0                	sub    %esi,%eax
+  803654:	19 fa                	sbb    %edi,%edx
+  803656:	89 cf                	mov    %ecx,%edi
+  803658:	c1 ef 05             	shr    $0x5,%edi
+  80365b:	83 e7 01             	and    $0x1,%edi
+  80365e:	89 fe                	mov    %edi,%esi
+  803660:	83 f6 01             	xor    $0x1,%esi
+  803663:	d3 e6                	shl    %cl,%esi
+  803665:	d3 e7                	shl    %cl,%edi
+  803667:	09 74 24 18          	or     %esi,0x18(%esp)
+  80366b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80366f:	eb 90                	jmp    803601 <dm+0x46>
+  803671:	85 db                	test   %ebx,%ebx
+  803673:	74 05                	je     80367a <dm+0xbf>
+  803675:	89 03                	mov    %eax,(%ebx)
+  803677:	89 53 04             	mov    %edx,0x4(%ebx)
+  80367a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80367e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803682:	83 c4 24             	add    $0x24,%esp
+  803685:	5b                   	pop    %ebx
+  803686:	5e                   	pop    %esi
+  803687:	5f                   	pop    %edi
+  803688:	5d                   	pop    %ebp
+  803689:	c3                   	ret
+
+0080368a <__udivdi3>:
+  80368a:	83 ec 08             	sub    $0x8,%esp
+  80368d:	6a 00                	push   $0x0
+  80368f:	ff 74 24 1c          	push   0x1c(%esp)
+  803693:	ff 74 24 1c          	push   0x1c(%esp)
+  803697:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80369b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80369f:	e8 17 ff ff ff       	call   8035bb <dm>
+  8036a4:	83 c4 14             	add    $0x14,%esp
+  8036a7:	c3                   	ret
+
+008036a8 <__umoddi3>:
+  8036a8:	83 ec 18             	sub    $0x18,%esp
+  8036ab:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036af:	50                   	push   %eax
+  8036b0:	ff 74 24 2c          	push   0x2c(%esp)
+  8036b4:	ff 74 24 2c          	push   0x2c(%esp)
+  8036b8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036bc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036c0:	e8 f6 fe ff ff       	call   8035bb <dm>
+  8036c5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036c9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036cd:	83 c4 24             	add    $0x24,%esp
+  8036d0:	c3                   	ret
+
+008036d1 <__divdi3>:
+  8036d1:	53                   	push   %ebx
+  8036d2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036d6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036da:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8036de:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036e2:	85 d2                	test   %edx,%edx
+  8036e4:	78 15                	js     8036fb <__divdi3+0x2a>
+  8036e6:	85 db                	test   %ebx,%ebx
+  8036e8:	78 34                	js     80371e <__divdi3+0x4d>
+  8036ea:	83 ec 04             	sub    $0x4,%esp
+  8036ed:	6a 00                	push   $0x0
+  8036ef:	53                   	push   %ebx
+  8036f0:	51                   	push   %ecx
+  8036f1:	e8 c5 fe ff ff       	call   8035bb <dm>
+  8036f6:	83 c4 10             	add    $0x10,%esp
+  8036f9:	eb 21                	jmp    80371c <__divdi3+0x4b>
+  8036fb:	f7 d8                	neg    %eax
+  8036fd:	83 d2 00             	adc    $0x0,%edx
+  803700:	f7 da                	neg    %edx
+  803702:	85 db                	test   %ebx,%ebx
+  803704:	78 30                	js     803736 <__divdi3+0x65>
+  803706:	83 ec 04             	sub    $0x4,%esp
+  803709:	6a 00                	push   $0x0
+  80370b:	53                   	push   %ebx
+  80370c:	51                   	push   %ecx
+  80370d:	e8 a9 fe ff ff       	call   8035bb <dm>
+  803712:	83 c4 10             	add    $0x10,%esp
+  803715:	f7 d8                	neg    %eax
+  803717:	83 d2 00             	adc    $0x0,%edx
+  80371a:	f7 da                	neg    %edx
+  80371c:	5b                   	pop    %ebx
+  80371d:	c3                   	ret
+  80371e:	83 ec 04             	sub    $0x4,%esp
+  803721:	6a 00                	push   $0x0
+  803723:	f7 d9                	neg    %ecx
+  803725:	83 d3 00             	adc    $0x0,%ebx
+  803728:	f7 db                	neg    %ebx
+  80372a:	53                   	push   %ebx
+  80372b:	51                   	push   %ecx
+  80372c:	e8 8a fe ff ff       	call   8035bb <dm>
+  803731:	83 c4 10             	add    $0x10,%esp
+  803734:	eb df                	jmp    803715 <__divdi3+0x44>
+  803736:	83 ec 04             	sub    $0x4,%esp
+  803739:	6a 00                	push   $0x0
+  80373b:	f7 d9                	neg    %ecx
+  80373d:	83 d3 00             	adc    $0x0,%ebx
+  803740:	f7 db                	neg    %ebx
+  803742:	53                   	push   %ebx
+  803743:	51                   	push   %ecx
+  803744:	e8 72 fe ff ff       	call   8035bb <dm>
+  803749:	83 c4 10             	add    $0x10,%esp
+  80374c:	eb ce                	jmp    80371c <__divdi3+0x4b>
+
+0080374e <__moddi3>:
+  80374e:	55                   	push   %ebp
+  80374f:	57                   	push   %edi
+  803750:	56                   	push   %esi
+  803751:	53                   	push   %ebx
+  803752:	83 ec 24             	sub    $0x24,%esp
+  803755:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803759:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80375d:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803761:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803765:	85 d2                	test   %edx,%edx
+  803767:	78 3b                	js     8037a4 <__moddi3+0x56>
+  803769:	83 ec 04             	sub    $0x4,%esp
+  80376c:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803770:	56                   	push   %esi
+  803771:	89 ce                	mov    %ecx,%esi
+  803773:	f7 de                	neg    %esi
+  803775:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803779:	89 de                	mov    %ebx,%esi
+  80377b:	83 d6 00             	adc    $0x0,%esi
+  80377e:	f7 de                	neg    %esi
+  803780:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803784:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803788:	0f 48 f1             	cmovs  %ecx,%esi
+  80378b:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803790:	53                   	push   %ebx
+  803791:	56                   	push   %esi
+  803792:	e8 24 fe ff ff       	call   8035bb <dm>
+  803797:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80379b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80379f:	83 c4 10             	add    $0x10,%esp
+  8037a2:	eb 47                	jmp    8037eb <__moddi3+0x9d>
+  8037a4:	f7 d8                	neg    %eax
+  8037a6:	83 d2 00             	adc    $0x0,%edx
+  8037a9:	f7 da                	neg    %edx
+  8037ab:	83 ec 04             	sub    $0x4,%esp
+  8037ae:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8037b2:	56                   	push   %esi
+  8037b3:	89 cf                	mov    %ecx,%edi
+  8037b5:	f7 df                	neg    %edi
+  8037b7:	89 de                	mov    %ebx,%esi
+  8037b9:	83 d6 00             	adc    $0x0,%esi
+  8037bc:	f7 de                	neg    %esi
+  8037be:	0f 49 cf             	cmovns %edi,%ecx
+  8037c1:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8037c5:	0f 49 de             	cmovns %esi,%ebx
+  8037c8:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8037cc:	ff 74 24 0c          	push   0xc(%esp)
+  8037d0:	ff 74 24 0c          	push   0xc(%esp)
+  8037d4:	e8 e2 fd ff ff       	call   8035bb <dm>
+  8037d9:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037dd:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037e1:	f7 d8                	neg    %eax
+  8037e3:	83 d2 00             	adc    $0x0,%edx
+  8037e6:	f7 da                	neg    %edx
+  8037e8:	83 c4 10             	add    $0x10,%esp
+  8037eb:	83 c4 24             	add    $0x24,%esp
+  8037ee:	5b                   	pop    %ebx
+  8037ef:	5e                   	pop    %esi
+  8037f0:	5f                   	pop    %edi
+  8037f1:	5d                   	pop    %ebp
+  8037f2:	c3                   	ret
@@ -0,0 +1,7861 @@
+
+obj/user/primespipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 06 02 00 00       	call   800237 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int i, id, p, pfd[2], wfd, r;
+
+	// fetch a prime from our left neighbor
+top:
+	if ((r = readn(fd, &p, 4)) != 4)
+  80003f:	8d 75 e0             	lea    -0x20(%ebp),%esi
+		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+
+	cprintf("%d\n", p);
+
+	// fork a right neighbor to continue the chain
+	if ((i=pipe(pfd)) < 0)
+  800042:	8d 7d d8             	lea    -0x28(%ebp),%edi
+	if ((r = readn(fd, &p, 4)) != 4)
+  800045:	83 ec 04             	sub    $0x4,%esp
+  800048:	6a 04                	push   $0x4
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	e8 9e 17 00 00       	call   8017ef <readn>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	83 f8 04             	cmp    $0x4,%eax
+  800057:	75 49                	jne    8000a2 <primeproc+0x6f>
+	cprintf("%d\n", p);
+  800059:	83 ec 08             	sub    $0x8,%esp
+  80005c:	ff 75 e0             	push   -0x20(%ebp)
+  80005f:	68 81 39 80 00       	push   $0x803981
+  800064:	e8 0c 03 00 00       	call   800375 <cprintf>
+	if ((i=pipe(pfd)) < 0)
+  800069:	89 3c 24             	mov    %edi,(%esp)
+  80006c:	e8 de 30 00 00       	call   80314f <pipe>
+  800071:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 47                	js     8000c2 <primeproc+0x8f>
+		panic("pipe: %e", i);
+	if ((id = fork()) < 0)
+  80007b:	e8 4a 12 00 00       	call   8012ca <fork>
+  800080:	85 c0                	test   %eax,%eax
+  800082:	78 50                	js     8000d4 <primeproc+0xa1>
+		panic("fork: %e", id);
+	if (id == 0) {
+  800084:	75 60                	jne    8000e6 <primeproc+0xb3>
+		close(fd);
+  800086:	83 ec 0c             	sub    $0xc,%esp
+  800089:	53                   	push   %ebx
+  80008a:	e8 9d 15 00 00       	call   80162c <close>
+		close(pfd[1]);
+  80008f:	83 c4 04             	add    $0x4,%esp
+  800092:	ff 75 dc             	push   -0x24(%ebp)
+  800095:	e8 92 15 00 00       	call   80162c <close>
+		fd = pfd[0];
+  80009a:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+		goto top;
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	eb a3                	jmp    800045 <primeproc+0x12>
+		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	85 c0                	test   %eax,%eax
+  8000a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ac:	0f 4e d0             	cmovle %eax,%edx
+  8000af:	52                   	push   %edx
+  8000b0:	50                   	push   %eax
+  8000b1:	68 40 39 80 00       	push   $0x803940
+  8000b6:	6a 15                	push   $0x15
+  8000b8:	68 6f 39 80 00       	push   $0x80396f
+  8000bd:	e8 d8 01 00 00       	call   80029a <_panic>
+		panic("pipe: %e", i);
+  8000c2:	50                   	push   %eax
+  8000c3:	68 85 39 80 00       	push   $0x803985
+  8000c8:	6a 1b                	push   $0x1b
+  8000ca:	68 6f 39 80 00       	push   $0x80396f
+  8000cf:	e8 c6 01 00 00       	call   80029a <_panic>
+		panic("fork: %e", id);
+  8000d4:	50                   	push   %eax
+  8000d5:	68 8e 39 80 00       	push   $0x80398e
+  8000da:	6a 1d                	push   $0x1d
+  8000dc:	68 6f 39 80 00       	push   $0x80396f
+  8000e1:	e8 b4 01 00 00       	call   80029a <_panic>
+	}
+
+	close(pfd[0]);
+  8000e6:	83 ec 0c             	sub    $0xc,%esp
+  8000e9:	ff 75 d8             	push   -0x28(%ebp)
+  8000ec:	e8 3b 15 00 00       	call   80162c <close>
+	wfd = pfd[1];
+  8000f1:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8000f4:	83 c4 10             	add    $0x10,%esp
+
+	// filter out multiples of our prime
+	for (;;) {
+		if ((r=readn(fd, &i, 4)) != 4)
+  8000f7:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8000fa:	83 ec 04             	sub    $0x4,%esp
+  8000fd:	6a 04                	push   $0x4
+  8000ff:	56                   	push   %esi
+  800100:	53                   	push   %ebx
+  800101:	e8 e9 16 00 00       	call   8017ef <readn>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	83 f8 04             	cmp    $0x4,%eax
+  80010c:	75 45                	jne    800153 <primeproc+0x120>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+		if (i%p)
+  80010e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800111:	99                   	cltd
+  800112:	f7 7d e0             	idivl  -0x20(%ebp)
+  800115:	85 d2                	test   %edx,%edx
+  800117:	74 e1                	je     8000fa <primeproc+0xc7>
+			if ((r=write(wfd, &i, 4)) != 4)
+  800119:	83 ec 04             	sub    $0x4,%esp
+  80011c:	6a 04                	push   $0x4
+  80011e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800121:	50                   	push   %eax
+  800122:	57                   	push   %edi
+  800123:	e8 0e 17 00 00       	call   801836 <write>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	83 f8 04             	cmp    $0x4,%eax
+  80012e:	74 ca                	je     8000fa <primeproc+0xc7>
+				panic("primeproc %d write: %d %e", p, r, r >= 0 ? 0 : r);
+  800130:	83 ec 08             	sub    $0x8,%esp
+  800133:	85 c0                	test   %eax,%eax
+  800135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013a:	0f 4e d0             	cmovle %eax,%edx
+  80013d:	52                   	push   %edx
+  80013e:	50                   	push   %eax
+  80013f:	ff 75 e0             	push   -0x20(%ebp)
+  800142:	68 b3 39 80 00       	push   $0x8039b3
+  800147:	6a 2e                	push   $0x2e
+  800149:	68 6f 39 80 00       	push   $0x80396f
+  80014e:	e8 47 01 00 00       	call   80029a <_panic>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+  800153:	83 ec 04             	sub    $0x4,%esp
+  800156:	85 c0                	test   %eax,%eax
+  800158:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015d:	0f 4e d0             	cmovle %eax,%edx
+  800160:	52                   	push   %edx
+  800161:	50                   	push   %eax
+  800162:	53                   	push   %ebx
+  800163:	ff 75 e0             	push   -0x20(%ebp)
+  800166:	68 97 39 80 00       	push   $0x803997
+  80016b:	6a 2b                	push   $0x2b
+  80016d:	68 6f 39 80 00       	push   $0x80396f
+  800172:	e8 23 01 00 00       	call   80029a <_panic>
+
+00800177 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800177:	55                   	push   %ebp
+  800178:	89 e5                	mov    %esp,%ebp
+  80017a:	53                   	push   %ebx
+  80017b:	83 ec 20             	sub    $0x20,%esp
+	int i, id, p[2], r;
+
+	binaryname = "primespipe";
+  80017e:	c7 05 00 50 80 00 cd 	movl   $0x8039cd,0x805000
+  800185:	39 80 00 
+
+	if ((i=pipe(p)) < 0)
+  800188:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80018b:	50                   	push   %eax
+  80018c:	e8 be 2f 00 00       	call   80314f <pipe>
+  800191:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800194:	83 c4 10             	add    $0x10,%esp
+  800197:	85 c0                	test   %eax,%eax
+  800199:	78 21                	js     8001bc <umain+0x45>
+		panic("pipe: %e", i);
+
+	// fork the first prime process in the chain
+	if ((id=fork()) < 0)
+  80019b:	e8 2a 11 00 00       	call   8012ca <fork>
+  8001a0:	85 c0                	test   %eax,%eax
+  8001a2:	78 2a                	js     8001ce <umain+0x57>
+		panic("fork: %e", id);
+
+	if (id == 0) {
+  8001a4:	75 3a                	jne    8001e0 <umain+0x69>
+		close(p[1]);
+  8001a6:	83 ec 0c             	sub    $0xc,%esp
+  8001a9:	ff 75 f0             	push   -0x10(%ebp)
+  8001ac:	e8 7b 14 00 00       	call   80162c <close>
+		primeproc(p[0]);
+  8001b1:	83 c4 04             	add    $0x4,%esp
+  8001b4:	ff 75 ec             	push   -0x14(%ebp)
+  8001b7:	e8 77 fe ff ff       	call   800033 <primeproc>
+		panic("pipe: %e", i);
+  8001bc:	50                   	push   %eax
+  8001bd:	68 85 39 80 00       	push   $0x803985
+  8001c2:	6a 3a                	push   $0x3a
+  8001c4:	68 6f 39 80 00       	push   $0x80396f
+  8001c9:	e8 cc 00 00 00       	call   80029a <_panic>
+		panic("fork: %e", id);
+  8001ce:	50                   	push   %eax
+  8001cf:	68 8e 39 80 00       	push   $0x80398e
+  8001d4:	6a 3e                	push   $0x3e
+  8001d6:	68 6f 39 80 00       	push   $0x80396f
+  8001db:	e8 ba 00 00 00       	call   80029a <_panic>
+	}
+
+	close(p[0]);
+  8001e0:	83 ec 0c             	sub    $0xc,%esp
+  8001e3:	ff 75 ec             	push   -0x14(%ebp)
+  8001e6:	e8 41 14 00 00       	call   80162c <close>
+  8001eb:	83 c4 10             	add    $0x10,%esp
+  8001ee:	b8 02 00 00 00       	mov    $0x2,%eax
+
+	// feed all the integers through
+	for (i=2;; i++)
+		if ((r=write(p[1], &i, 4)) != 4)
+  8001f3:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  8001f6:	eb 06                	jmp    8001fe <umain+0x87>
+	for (i=2;; i++)
+  8001f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001fb:	83 c0 01             	add    $0x1,%eax
+  8001fe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+		if ((r=write(p[1], &i, 4)) != 4)
+  800201:	83 ec 04             	sub    $0x4,%esp
+  800204:	6a 04                	push   $0x4
+  800206:	53                   	push   %ebx
+  800207:	ff 75 f0             	push   -0x10(%ebp)
+  80020a:	e8 27 16 00 00       	call   801836 <write>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	83 f8 04             	cmp    $0x4,%eax
+  800215:	74 e1                	je     8001f8 <umain+0x81>
+			panic("generator write: %d, %e", r, r >= 0 ? 0 : r);
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	85 c0                	test   %eax,%eax
+  80021c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800221:	0f 4e d0             	cmovle %eax,%edx
+  800224:	52                   	push   %edx
+  800225:	50                   	push   %eax
+  800226:	68 d8 39 80 00       	push   $0x8039d8
+  80022b:	6a 4a                	push   $0x4a
+  80022d:	68 6f 39 80 00       	push   $0x80396f
+  800232:	e8 63 00 00 00       	call   80029a <_panic>
+
+00800237 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	56                   	push   %esi
+  80023b:	53                   	push   %ebx
+  80023c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80023f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800242:	e8 e2 0a 00 00       	call   800d29 <sys_getenvid>
+  800247:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80024c:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800252:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800257:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80025c:	85 db                	test   %ebx,%ebx
+  80025e:	7e 07                	jle    800267 <libmain+0x30>
+		binaryname = argv[0];
+  800260:	8b 06                	mov    (%esi),%eax
+  800262:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800267:	83 ec 08             	sub    $0x8,%esp
+  80026a:	56                   	push   %esi
+  80026b:	53                   	push   %ebx
+  80026c:	e8 06 ff ff ff       	call   800177 <umain>
+
+	// exit gracefully
+	exit();
+  800271:	e8 0a 00 00 00       	call   800280 <exit>
+}
+  800276:	83 c4 10             	add    $0x10,%esp
+  800279:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80027c:	5b                   	pop    %ebx
+  80027d:	5e                   	pop    %esi
+  80027e:	5d                   	pop    %ebp
+  80027f:	c3                   	ret
+
+00800280 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800280:	55                   	push   %ebp
+  800281:	89 e5                	mov    %esp,%ebp
+  800283:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800286:	e8 ce 13 00 00       	call   801659 <close_all>
+	sys_env_destroy(0);
+  80028b:	83 ec 0c             	sub    $0xc,%esp
+  80028e:	6a 00                	push   $0x0
+  800290:	e8 4b 0a 00 00       	call   800ce0 <sys_env_destroy>
+}
+  800295:	83 c4 10             	add    $0x10,%esp
+  800298:	c9                   	leave
+  800299:	c3                   	ret
+
+0080029a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80029a:	55                   	push   %ebp
+  80029b:	89 e5                	mov    %esp,%ebp
+  80029d:	56                   	push   %esi
+  80029e:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80029f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002a2:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8002a8:	e8 7c 0a 00 00       	call   800d29 <sys_getenvid>
+  8002ad:	83 ec 0c             	sub    $0xc,%esp
+  8002b0:	ff 75 0c             	push   0xc(%ebp)
+  8002b3:	ff 75 08             	push   0x8(%ebp)
+  8002b6:	56                   	push   %esi
+  8002b7:	50                   	push   %eax
+  8002b8:	68 fc 39 80 00       	push   $0x8039fc
+  8002bd:	e8 b3 00 00 00       	call   800375 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002c2:	83 c4 18             	add    $0x18,%esp
+  8002c5:	53                   	push   %ebx
+  8002c6:	ff 75 10             	push   0x10(%ebp)
+  8002c9:	e8 56 00 00 00       	call   800324 <vcprintf>
+	cprintf("\n");
+  8002ce:	c7 04 24 83 39 80 00 	movl   $0x803983,(%esp)
+  8002d5:	e8 9b 00 00 00       	call   800375 <cprintf>
+  8002da:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002dd:	cc                   	int3
+	while (1)
+  8002de:	eb fd                	jmp    8002dd <_panic+0x43>
+
+008002e0 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002e0:	55                   	push   %ebp
+  8002e1:	89 e5                	mov    %esp,%ebp
+  8002e3:	53                   	push   %ebx
+  8002e4:	83 ec 04             	sub    $0x4,%esp
+  8002e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002ea:	8b 13                	mov    (%ebx),%edx
+  8002ec:	8d 42 01             	lea    0x1(%edx),%eax
+  8002ef:	89 03                	mov    %eax,(%ebx)
+  8002f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002f4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002f8:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002fd:	74 09                	je     800308 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002ff:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800303:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800306:	c9                   	leave
+  800307:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800308:	83 ec 08             	sub    $0x8,%esp
+  80030b:	68 ff 00 00 00       	push   $0xff
+  800310:	8d 43 08             	lea    0x8(%ebx),%eax
+  800313:	50                   	push   %eax
+  800314:	e8 7a 09 00 00       	call   800c93 <sys_cputs>
+		b->idx = 0;
+  800319:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80031f:	83 c4 10             	add    $0x10,%esp
+  800322:	eb db                	jmp    8002ff <putch+0x1f>
+
+00800324 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800324:	55                   	push   %ebp
+  800325:	89 e5                	mov    %esp,%ebp
+  800327:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80032d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800334:	00 00 00 
+	b.cnt = 0;
+  800337:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80033e:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800341:	ff 75 0c             	push   0xc(%ebp)
+  800344:	ff 75 08             	push   0x8(%ebp)
+  800347:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80034d:	50                   	push   %eax
+  80034e:	68 e0 02 80 00       	push   $0x8002e0
+  800353:	e8 14 01 00 00       	call   80046c <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800358:	83 c4 08             	add    $0x8,%esp
+  80035b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800361:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800367:	50                   	push   %eax
+  800368:	e8 26 09 00 00       	call   800c93 <sys_cputs>
+
+	return b.cnt;
+}
+  80036d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800373:	c9                   	leave
+  800374:	c3                   	ret
+
+00800375 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800375:	55                   	push   %ebp
+  800376:	89 e5                	mov    %esp,%ebp
+  800378:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80037b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80037e:	50                   	push   %eax
+  80037f:	ff 75 08             	push   0x8(%ebp)
+  800382:	e8 9d ff ff ff       	call   800324 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800387:	c9                   	leave
+  800388:	c3                   	ret
+
+00800389 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800389:	55                   	push   %ebp
+  80038a:	89 e5                	mov    %esp,%ebp
+  80038c:	57                   	push   %edi
+  80038d:	56                   	push   %esi
+  80038e:	53                   	push   %ebx
+  80038f:	83 ec 1c             	sub    $0x1c,%esp
+  800392:	89 c7                	mov    %eax,%edi
+  800394:	89 d6                	mov    %edx,%esi
+  800396:	8b 45 08             	mov    0x8(%ebp),%eax
+  800399:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80039c:	89 d1                	mov    %edx,%ecx
+  80039e:	89 c2                	mov    %eax,%edx
+  8003a0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003a3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003a6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003a9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003af:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003b6:	39 c2                	cmp    %eax,%edx
+  8003b8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003bb:	72 3e                	jb     8003fb <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003bd:	83 ec 0c             	sub    $0xc,%esp
+  8003c0:	ff 75 18             	push   0x18(%ebp)
+  8003c3:	83 eb 01             	sub    $0x1,%ebx
+  8003c6:	53                   	push   %ebx
+  8003c7:	50                   	push   %eax
+  8003c8:	83 ec 08             	sub    $0x8,%esp
+  8003cb:	ff 75 e4             	push   -0x1c(%ebp)
+  8003ce:	ff 75 e0             	push   -0x20(%ebp)
+  8003d1:	ff 75 dc             	push   -0x24(%ebp)
+  8003d4:	ff 75 d8             	push   -0x28(%ebp)
+  8003d7:	e8 f1 33 00 00       	call   8037cd <__udivdi3>
+  8003dc:	83 c4 18             	add    $0x18,%esp
+  8003df:	52                   	push   %edx
+  8003e0:	50                   	push   %eax
+  8003e1:	89 f2                	mov    %esi,%edx
+  8003e3:	89 f8                	mov    %edi,%eax
+  8003e5:	e8 9f ff ff ff       	call   800389 <printnum>
+  8003ea:	83 c4 20             	add    $0x20,%esp
+  8003ed:	eb 13                	jmp    800402 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003ef:	83 ec 08             	sub    $0x8,%esp
+  8003f2:	56                   	push   %esi
+  8003f3:	ff 75 18             	push   0x18(%ebp)
+  8003f6:	ff d7                	call   *%edi
+  8003f8:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003fb:	83 eb 01             	sub    $0x1,%ebx
+  8003fe:	85 db                	test   %ebx,%ebx
+  800400:	7f ed                	jg     8003ef <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800402:	83 ec 08             	sub    $0x8,%esp
+  800405:	56                   	push   %esi
+  800406:	83 ec 04             	sub    $0x4,%esp
+  800409:	ff 75 e4             	push   -0x1c(%ebp)
+  80040c:	ff 75 e0             	push   -0x20(%ebp)
+  80040f:	ff 75 dc             	push   -0x24(%ebp)
+  800412:	ff 75 d8             	push   -0x28(%ebp)
+  800415:	e8 d1 33 00 00       	call   8037eb <__umoddi3>
+  80041a:	83 c4 14             	add    $0x14,%esp
+  80041d:	0f be 80 1f 3a 80 00 	movsbl 0x803a1f(%eax),%eax
+  800424:	50                   	push   %eax
+  800425:	ff d7                	call   *%edi
+}
+  800427:	83 c4 10             	add    $0x10,%esp
+  80042a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80042d:	5b                   	pop    %ebx
+  80042e:	5e                   	pop    %esi
+  80042f:	5f                   	pop    %edi
+  800430:	5d                   	pop    %ebp
+  800431:	c3                   	ret
+
+00800432 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800432:	55                   	push   %ebp
+  800433:	89 e5                	mov    %esp,%ebp
+  800435:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800438:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80043c:	8b 10                	mov    (%eax),%edx
+  80043e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800441:	73 0a                	jae    80044d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800443:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800446:	89 08                	mov    %ecx,(%eax)
+  800448:	8b 45 08             	mov    0x8(%ebp),%eax
+  80044b:	88 02                	mov    %al,(%edx)
+}
+  80044d:	5d                   	pop    %ebp
+  80044e:	c3                   	ret
+
+0080044f <printfmt>:
+{
+  80044f:	55                   	push   %ebp
+  800450:	89 e5                	mov    %esp,%ebp
+  800452:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800455:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800458:	50                   	push   %eax
+  800459:	ff 75 10             	push   0x10(%ebp)
+  80045c:	ff 75 0c             	push   0xc(%ebp)
+  80045f:	ff 75 08             	push   0x8(%ebp)
+  800462:	e8 05 00 00 00       	call   80046c <vprintfmt>
+}
+  800467:	83 c4 10             	add    $0x10,%esp
+  80046a:	c9                   	leave
+  80046b:	c3                   	ret
+
+0080046c <vprintfmt>:
+{
+  80046c:	55                   	push   %ebp
+  80046d:	89 e5                	mov    %esp,%ebp
+  80046f:	57                   	push   %edi
+  800470:	56                   	push   %esi
+  800471:	53                   	push   %ebx
+  800472:	83 ec 2c             	sub    $0x2c,%esp
+  800475:	8b 75 08             	mov    0x8(%ebp),%esi
+  800478:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80047b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80047e:	eb 0a                	jmp    80048a <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800480:	83 ec 08             	sub    $0x8,%esp
+  800483:	53                   	push   %ebx
+  800484:	50                   	push   %eax
+  800485:	ff d6                	call   *%esi
+  800487:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80048a:	83 c7 01             	add    $0x1,%edi
+  80048d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800491:	83 f8 25             	cmp    $0x25,%eax
+  800494:	74 0c                	je     8004a2 <vprintfmt+0x36>
+			if (ch == '\0')
+  800496:	85 c0                	test   %eax,%eax
+  800498:	75 e6                	jne    800480 <vprintfmt+0x14>
+}
+  80049a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80049d:	5b                   	pop    %ebx
+  80049e:	5e                   	pop    %esi
+  80049f:	5f                   	pop    %edi
+  8004a0:	5d                   	pop    %ebp
+  8004a1:	c3                   	ret
+		padc = ' ';
+  8004a2:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004a6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004ad:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004b4:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c0:	8d 47 01             	lea    0x1(%edi),%eax
+  8004c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004c6:	0f b6 17             	movzbl (%edi),%edx
+  8004c9:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004cc:	3c 55                	cmp    $0x55,%al
+  8004ce:	0f 87 cf 03 00 00    	ja     8008a3 <vprintfmt+0x437>
+  8004d4:	0f b6 c0             	movzbl %al,%eax
+  8004d7:	ff 24 85 80 3b 80 00 	jmp    *0x803b80(,%eax,4)
+  8004de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8004e1:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004e5:	eb d9                	jmp    8004c0 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004ea:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004ee:	eb d0                	jmp    8004c0 <vprintfmt+0x54>
+  8004f0:	0f b6 d2             	movzbl %dl,%edx
+  8004f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004fe:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800501:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800505:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800508:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80050b:	83 f9 09             	cmp    $0x9,%ecx
+  80050e:	77 55                	ja     800565 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800510:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800513:	eb e9                	jmp    8004fe <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800515:	8b 45 14             	mov    0x14(%ebp),%eax
+  800518:	8b 00                	mov    (%eax),%eax
+  80051a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80051d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800520:	8d 40 04             	lea    0x4(%eax),%eax
+  800523:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800526:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800529:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80052d:	79 91                	jns    8004c0 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80052f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800532:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800535:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80053c:	eb 82                	jmp    8004c0 <vprintfmt+0x54>
+			if (width < 0)
+  80053e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800541:	85 d2                	test   %edx,%edx
+  800543:	b8 00 00 00 00       	mov    $0x0,%eax
+  800548:	0f 49 c2             	cmovns %edx,%eax
+  80054b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80054e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800551:	e9 6a ff ff ff       	jmp    8004c0 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800556:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800559:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800560:	e9 5b ff ff ff       	jmp    8004c0 <vprintfmt+0x54>
+  800565:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800568:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80056b:	eb bc                	jmp    800529 <vprintfmt+0xbd>
+			lflag++;
+  80056d:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800570:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800573:	e9 48 ff ff ff       	jmp    8004c0 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800578:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057b:	8d 78 04             	lea    0x4(%eax),%edi
+  80057e:	83 ec 08             	sub    $0x8,%esp
+  800581:	53                   	push   %ebx
+  800582:	ff 30                	push   (%eax)
+  800584:	ff d6                	call   *%esi
+			break;
+  800586:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800589:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80058c:	e9 b1 02 00 00       	jmp    800842 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800597:	8b 10                	mov    (%eax),%edx
+  800599:	89 d0                	mov    %edx,%eax
+  80059b:	f7 d8                	neg    %eax
+  80059d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005a0:	83 f8 11             	cmp    $0x11,%eax
+  8005a3:	7f 23                	jg     8005c8 <vprintfmt+0x15c>
+  8005a5:	8b 14 85 e0 3c 80 00 	mov    0x803ce0(,%eax,4),%edx
+  8005ac:	85 d2                	test   %edx,%edx
+  8005ae:	74 18                	je     8005c8 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8005b0:	52                   	push   %edx
+  8005b1:	68 fe 3d 80 00       	push   $0x803dfe
+  8005b6:	53                   	push   %ebx
+  8005b7:	56                   	push   %esi
+  8005b8:	e8 92 fe ff ff       	call   80044f <printfmt>
+  8005bd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005c0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005c3:	e9 7a 02 00 00       	jmp    800842 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8005c8:	50                   	push   %eax
+  8005c9:	68 37 3a 80 00       	push   $0x803a37
+  8005ce:	53                   	push   %ebx
+  8005cf:	56                   	push   %esi
+  8005d0:	e8 7a fe ff ff       	call   80044f <printfmt>
+  8005d5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005d8:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005db:	e9 62 02 00 00       	jmp    800842 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e3:	83 c0 04             	add    $0x4,%eax
+  8005e6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ec:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005ee:	85 c9                	test   %ecx,%ecx
+  8005f0:	b8 30 3a 80 00       	mov    $0x803a30,%eax
+  8005f5:	0f 45 c1             	cmovne %ecx,%eax
+  8005f8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005fb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005ff:	7e 06                	jle    800607 <vprintfmt+0x19b>
+  800601:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800605:	75 0b                	jne    800612 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800607:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80060a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80060d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800610:	eb 5c                	jmp    80066e <vprintfmt+0x202>
+  800612:	83 ec 08             	sub    $0x8,%esp
+  800615:	ff 75 d0             	push   -0x30(%ebp)
+  800618:	ff 75 cc             	push   -0x34(%ebp)
+  80061b:	e8 20 03 00 00       	call   800940 <strnlen>
+  800620:	89 c2                	mov    %eax,%edx
+  800622:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800625:	29 d0                	sub    %edx,%eax
+  800627:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80062a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80062e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800631:	89 75 08             	mov    %esi,0x8(%ebp)
+  800634:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800636:	eb 0e                	jmp    800646 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800638:	83 ec 08             	sub    $0x8,%esp
+  80063b:	53                   	push   %ebx
+  80063c:	57                   	push   %edi
+  80063d:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800640:	83 ee 01             	sub    $0x1,%esi
+  800643:	83 c4 10             	add    $0x10,%esp
+  800646:	85 f6                	test   %esi,%esi
+  800648:	7f ee                	jg     800638 <vprintfmt+0x1cc>
+  80064a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80064d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800650:	85 c0                	test   %eax,%eax
+  800652:	ba 00 00 00 00       	mov    $0x0,%edx
+  800657:	0f 49 d0             	cmovns %eax,%edx
+  80065a:	29 d0                	sub    %edx,%eax
+  80065c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80065f:	eb a6                	jmp    800607 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800661:	83 ec 08             	sub    $0x8,%esp
+  800664:	53                   	push   %ebx
+  800665:	52                   	push   %edx
+  800666:	ff 55 08             	call   *0x8(%ebp)
+  800669:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80066c:	89 f1                	mov    %esi,%ecx
+  80066e:	8d 71 01             	lea    0x1(%ecx),%esi
+  800671:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800675:	0f be d0             	movsbl %al,%edx
+  800678:	85 d2                	test   %edx,%edx
+  80067a:	74 28                	je     8006a4 <vprintfmt+0x238>
+  80067c:	85 ff                	test   %edi,%edi
+  80067e:	78 05                	js     800685 <vprintfmt+0x219>
+  800680:	83 ef 01             	sub    $0x1,%edi
+  800683:	78 30                	js     8006b5 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800685:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800689:	74 d6                	je     800661 <vprintfmt+0x1f5>
+  80068b:	0f be c0             	movsbl %al,%eax
+  80068e:	83 e8 20             	sub    $0x20,%eax
+  800691:	83 f8 5e             	cmp    $0x5e,%eax
+  800694:	76 cb                	jbe    800661 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800696:	83 ec 08             	sub    $0x8,%esp
+  800699:	53                   	push   %ebx
+  80069a:	6a 3f                	push   $0x3f
+  80069c:	ff 55 08             	call   *0x8(%ebp)
+  80069f:	83 c4 10             	add    $0x10,%esp
+  8006a2:	eb c8                	jmp    80066c <vprintfmt+0x200>
+  8006a4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006a7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006aa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006ad:	01 d0                	add    %edx,%eax
+  8006af:	29 c8                	sub    %ecx,%eax
+  8006b1:	89 c7                	mov    %eax,%edi
+  8006b3:	eb 13                	jmp    8006c8 <vprintfmt+0x25c>
+  8006b5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006b8:	eb ed                	jmp    8006a7 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8006ba:	83 ec 08             	sub    $0x8,%esp
+  8006bd:	53                   	push   %ebx
+  8006be:	6a 20                	push   $0x20
+  8006c0:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006c2:	83 ef 01             	sub    $0x1,%edi
+  8006c5:	83 c4 10             	add    $0x10,%esp
+  8006c8:	85 ff                	test   %edi,%edi
+  8006ca:	7f ee                	jg     8006ba <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006cc:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d2:	e9 6b 01 00 00       	jmp    800842 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8006d7:	83 f9 01             	cmp    $0x1,%ecx
+  8006da:	7f 1f                	jg     8006fb <vprintfmt+0x28f>
+	else if (lflag)
+  8006dc:	85 c9                	test   %ecx,%ecx
+  8006de:	74 67                	je     800747 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8006e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e3:	8b 00                	mov    (%eax),%eax
+  8006e5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e8:	89 c1                	mov    %eax,%ecx
+  8006ea:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006ed:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f9:	eb 17                	jmp    800712 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8006fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fe:	8b 50 04             	mov    0x4(%eax),%edx
+  800701:	8b 00                	mov    (%eax),%eax
+  800703:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800706:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800709:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070c:	8d 40 08             	lea    0x8(%eax),%eax
+  80070f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800712:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800715:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800718:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80071d:	85 c9                	test   %ecx,%ecx
+  80071f:	0f 89 03 01 00 00    	jns    800828 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800725:	83 ec 08             	sub    $0x8,%esp
+  800728:	53                   	push   %ebx
+  800729:	6a 2d                	push   $0x2d
+  80072b:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80072d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800730:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800733:	f7 da                	neg    %edx
+  800735:	83 d1 00             	adc    $0x0,%ecx
+  800738:	f7 d9                	neg    %ecx
+  80073a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80073d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800742:	e9 e1 00 00 00       	jmp    800828 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800747:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074a:	8b 00                	mov    (%eax),%eax
+  80074c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80074f:	89 c1                	mov    %eax,%ecx
+  800751:	c1 f9 1f             	sar    $0x1f,%ecx
+  800754:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800757:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075a:	8d 40 04             	lea    0x4(%eax),%eax
+  80075d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800760:	eb b0                	jmp    800712 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800762:	83 f9 01             	cmp    $0x1,%ecx
+  800765:	7f 1e                	jg     800785 <vprintfmt+0x319>
+	else if (lflag)
+  800767:	85 c9                	test   %ecx,%ecx
+  800769:	74 32                	je     80079d <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80076b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076e:	8b 10                	mov    (%eax),%edx
+  800770:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800775:	8d 40 04             	lea    0x4(%eax),%eax
+  800778:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80077b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800780:	e9 a3 00 00 00       	jmp    800828 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800785:	8b 45 14             	mov    0x14(%ebp),%eax
+  800788:	8b 10                	mov    (%eax),%edx
+  80078a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80078d:	8d 40 08             	lea    0x8(%eax),%eax
+  800790:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800793:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800798:	e9 8b 00 00 00       	jmp    800828 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80079d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a0:	8b 10                	mov    (%eax),%edx
+  8007a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8007aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007ad:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007b2:	eb 74                	jmp    800828 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8007b4:	83 f9 01             	cmp    $0x1,%ecx
+  8007b7:	7f 1b                	jg     8007d4 <vprintfmt+0x368>
+	else if (lflag)
+  8007b9:	85 c9                	test   %ecx,%ecx
+  8007bb:	74 2c                	je     8007e9 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8007bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c0:	8b 10                	mov    (%eax),%edx
+  8007c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007cd:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8007d2:	eb 54                	jmp    800828 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d7:	8b 10                	mov    (%eax),%edx
+  8007d9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007dc:	8d 40 08             	lea    0x8(%eax),%eax
+  8007df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007e2:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8007e7:	eb 3f                	jmp    800828 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ec:	8b 10                	mov    (%eax),%edx
+  8007ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007f9:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8007fe:	eb 28                	jmp    800828 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800800:	83 ec 08             	sub    $0x8,%esp
+  800803:	53                   	push   %ebx
+  800804:	6a 30                	push   $0x30
+  800806:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800808:	83 c4 08             	add    $0x8,%esp
+  80080b:	53                   	push   %ebx
+  80080c:	6a 78                	push   $0x78
+  80080e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800810:	8b 45 14             	mov    0x14(%ebp),%eax
+  800813:	8b 10                	mov    (%eax),%edx
+  800815:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80081a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80081d:	8d 40 04             	lea    0x4(%eax),%eax
+  800820:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800823:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800828:	83 ec 0c             	sub    $0xc,%esp
+  80082b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80082f:	50                   	push   %eax
+  800830:	ff 75 e0             	push   -0x20(%ebp)
+  800833:	57                   	push   %edi
+  800834:	51                   	push   %ecx
+  800835:	52                   	push   %edx
+  800836:	89 da                	mov    %ebx,%edx
+  800838:	89 f0                	mov    %esi,%eax
+  80083a:	e8 4a fb ff ff       	call   800389 <printnum>
+			break;
+  80083f:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800842:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800845:	e9 40 fc ff ff       	jmp    80048a <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80084a:	83 f9 01             	cmp    $0x1,%ecx
+  80084d:	7f 1b                	jg     80086a <vprintfmt+0x3fe>
+	else if (lflag)
+  80084f:	85 c9                	test   %ecx,%ecx
+  800851:	74 2c                	je     80087f <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800853:	8b 45 14             	mov    0x14(%ebp),%eax
+  800856:	8b 10                	mov    (%eax),%edx
+  800858:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80085d:	8d 40 04             	lea    0x4(%eax),%eax
+  800860:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800863:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800868:	eb be                	jmp    800828 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80086a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086d:	8b 10                	mov    (%eax),%edx
+  80086f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800872:	8d 40 08             	lea    0x8(%eax),%eax
+  800875:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800878:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80087d:	eb a9                	jmp    800828 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80087f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800882:	8b 10                	mov    (%eax),%edx
+  800884:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800889:	8d 40 04             	lea    0x4(%eax),%eax
+  80088c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80088f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800894:	eb 92                	jmp    800828 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800896:	83 ec 08             	sub    $0x8,%esp
+  800899:	53                   	push   %ebx
+  80089a:	6a 25                	push   $0x25
+  80089c:	ff d6                	call   *%esi
+			break;
+  80089e:	83 c4 10             	add    $0x10,%esp
+  8008a1:	eb 9f                	jmp    800842 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8008a3:	83 ec 08             	sub    $0x8,%esp
+  8008a6:	53                   	push   %ebx
+  8008a7:	6a 25                	push   $0x25
+  8008a9:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008ab:	83 c4 10             	add    $0x10,%esp
+  8008ae:	89 f8                	mov    %edi,%eax
+  8008b0:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008b4:	74 05                	je     8008bb <vprintfmt+0x44f>
+  8008b6:	83 e8 01             	sub    $0x1,%eax
+  8008b9:	eb f5                	jmp    8008b0 <vprintfmt+0x444>
+  8008bb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008be:	eb 82                	jmp    800842 <vprintfmt+0x3d6>
+
+008008c0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008c0:	55                   	push   %ebp
+  8008c1:	89 e5                	mov    %esp,%ebp
+  8008c3:	83 ec 18             	sub    $0x18,%esp
+  8008c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008cc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008cf:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008d3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008d6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008dd:	85 c0                	test   %eax,%eax
+  8008df:	74 26                	je     800907 <vsnprintf+0x47>
+  8008e1:	85 d2                	test   %edx,%edx
+  8008e3:	7e 22                	jle    800907 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008e5:	ff 75 14             	push   0x14(%ebp)
+  8008e8:	ff 75 10             	push   0x10(%ebp)
+  8008eb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008ee:	50                   	push   %eax
+  8008ef:	68 32 04 80 00       	push   $0x800432
+  8008f4:	e8 73 fb ff ff       	call   80046c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008f9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008fc:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800902:	83 c4 10             	add    $0x10,%esp
+}
+  800905:	c9                   	leave
+  800906:	c3                   	ret
+		return -E_INVAL;
+  800907:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80090c:	eb f7                	jmp    800905 <vsnprintf+0x45>
+
+0080090e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80090e:	55                   	push   %ebp
+  80090f:	89 e5                	mov    %esp,%ebp
+  800911:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800914:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800917:	50                   	push   %eax
+  800918:	ff 75 10             	push   0x10(%ebp)
+  80091b:	ff 75 0c             	push   0xc(%ebp)
+  80091e:	ff 75 08             	push   0x8(%ebp)
+  800921:	e8 9a ff ff ff       	call   8008c0 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800926:	c9                   	leave
+  800927:	c3                   	ret
+
+00800928 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800928:	55                   	push   %ebp
+  800929:	89 e5                	mov    %esp,%ebp
+  80092b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80092e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800933:	eb 03                	jmp    800938 <strlen+0x10>
+		n++;
+  800935:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800938:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80093c:	75 f7                	jne    800935 <strlen+0xd>
+	return n;
+}
+  80093e:	5d                   	pop    %ebp
+  80093f:	c3                   	ret
+
+00800940 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800940:	55                   	push   %ebp
+  800941:	89 e5                	mov    %esp,%ebp
+  800943:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800946:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094e:	eb 03                	jmp    800953 <strnlen+0x13>
+		n++;
+  800950:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800953:	39 d0                	cmp    %edx,%eax
+  800955:	74 08                	je     80095f <strnlen+0x1f>
+  800957:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80095b:	75 f3                	jne    800950 <strnlen+0x10>
+  80095d:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80095f:	89 d0                	mov    %edx,%eax
+  800961:	5d                   	pop    %ebp
+  800962:	c3                   	ret
+
+00800963 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800963:	55                   	push   %ebp
+  800964:	89 e5                	mov    %esp,%ebp
+  800966:	53                   	push   %ebx
+  800967:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80096a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80096d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800972:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800976:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800979:	83 c0 01             	add    $0x1,%eax
+  80097c:	84 d2                	test   %dl,%dl
+  80097e:	75 f2                	jne    800972 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800980:	89 c8                	mov    %ecx,%eax
+  800982:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800985:	c9                   	leave
+  800986:	c3                   	ret
+
+00800987 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800987:	55                   	push   %ebp
+  800988:	89 e5                	mov    %esp,%ebp
+  80098a:	53                   	push   %ebx
+  80098b:	83 ec 10             	sub    $0x10,%esp
+  80098e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800991:	53                   	push   %ebx
+  800992:	e8 91 ff ff ff       	call   800928 <strlen>
+  800997:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80099a:	ff 75 0c             	push   0xc(%ebp)
+  80099d:	01 d8                	add    %ebx,%eax
+  80099f:	50                   	push   %eax
+  8009a0:	e8 be ff ff ff       	call   800963 <strcpy>
+	return dst;
+}
+  8009a5:	89 d8                	mov    %ebx,%eax
+  8009a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009aa:	c9                   	leave
+  8009ab:	c3                   	ret
+
+008009ac <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009ac:	55                   	push   %ebp
+  8009ad:	89 e5                	mov    %esp,%ebp
+  8009af:	56                   	push   %esi
+  8009b0:	53                   	push   %ebx
+  8009b1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009b7:	89 f3                	mov    %esi,%ebx
+  8009b9:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009bc:	89 f0                	mov    %esi,%eax
+  8009be:	eb 0f                	jmp    8009cf <strncpy+0x23>
+		*dst++ = *src;
+  8009c0:	83 c0 01             	add    $0x1,%eax
+  8009c3:	0f b6 0a             	movzbl (%edx),%ecx
+  8009c6:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009c9:	80 f9 01             	cmp    $0x1,%cl
+  8009cc:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009cf:	39 d8                	cmp    %ebx,%eax
+  8009d1:	75 ed                	jne    8009c0 <strncpy+0x14>
+	}
+	return ret;
+}
+  8009d3:	89 f0                	mov    %esi,%eax
+  8009d5:	5b                   	pop    %ebx
+  8009d6:	5e                   	pop    %esi
+  8009d7:	5d                   	pop    %ebp
+  8009d8:	c3                   	ret
+
+008009d9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009d9:	55                   	push   %ebp
+  8009da:	89 e5                	mov    %esp,%ebp
+  8009dc:	56                   	push   %esi
+  8009dd:	53                   	push   %ebx
+  8009de:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e4:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009e7:	89 f0                	mov    %esi,%eax
+  8009e9:	85 d2                	test   %edx,%edx
+  8009eb:	74 21                	je     800a0e <strlcpy+0x35>
+  8009ed:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009f1:	89 f2                	mov    %esi,%edx
+  8009f3:	eb 09                	jmp    8009fe <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009f5:	83 c1 01             	add    $0x1,%ecx
+  8009f8:	83 c2 01             	add    $0x1,%edx
+  8009fb:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009fe:	39 c2                	cmp    %eax,%edx
+  800a00:	74 09                	je     800a0b <strlcpy+0x32>
+  800a02:	0f b6 19             	movzbl (%ecx),%ebx
+  800a05:	84 db                	test   %bl,%bl
+  800a07:	75 ec                	jne    8009f5 <strlcpy+0x1c>
+  800a09:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a0b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a0e:	29 f0                	sub    %esi,%eax
+}
+  800a10:	5b                   	pop    %ebx
+  800a11:	5e                   	pop    %esi
+  800a12:	5d                   	pop    %ebp
+  800a13:	c3                   	ret
+
+00800a14 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a14:	55                   	push   %ebp
+  800a15:	89 e5                	mov    %esp,%ebp
+  800a17:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a1d:	eb 06                	jmp    800a25 <strcmp+0x11>
+		p++, q++;
+  800a1f:	83 c1 01             	add    $0x1,%ecx
+  800a22:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a25:	0f b6 01             	movzbl (%ecx),%eax
+  800a28:	84 c0                	test   %al,%al
+  800a2a:	74 04                	je     800a30 <strcmp+0x1c>
+  800a2c:	3a 02                	cmp    (%edx),%al
+  800a2e:	74 ef                	je     800a1f <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a30:	0f b6 c0             	movzbl %al,%eax
+  800a33:	0f b6 12             	movzbl (%edx),%edx
+  800a36:	29 d0                	sub    %edx,%eax
+}
+  800a38:	5d                   	pop    %ebp
+  800a39:	c3                   	ret
+
+00800a3a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a3a:	55                   	push   %ebp
+  800a3b:	89 e5                	mov    %esp,%ebp
+  800a3d:	53                   	push   %ebx
+  800a3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a44:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a47:	eb 09                	jmp    800a52 <strncmp+0x18>
+		n--, p++, q++;
+  800a49:	83 ea 01             	sub    $0x1,%edx
+  800a4c:	83 c0 01             	add    $0x1,%eax
+  800a4f:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a52:	85 d2                	test   %edx,%edx
+  800a54:	74 18                	je     800a6e <strncmp+0x34>
+  800a56:	0f b6 18             	movzbl (%eax),%ebx
+  800a59:	84 db                	test   %bl,%bl
+  800a5b:	74 04                	je     800a61 <strncmp+0x27>
+  800a5d:	3a 19                	cmp    (%ecx),%bl
+  800a5f:	74 e8                	je     800a49 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a61:	0f b6 00             	movzbl (%eax),%eax
+  800a64:	0f b6 11             	movzbl (%ecx),%edx
+  800a67:	29 d0                	sub    %edx,%eax
+}
+  800a69:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a6c:	c9                   	leave
+  800a6d:	c3                   	ret
+		return 0;
+  800a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a73:	eb f4                	jmp    800a69 <strncmp+0x2f>
+
+00800a75 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a75:	55                   	push   %ebp
+  800a76:	89 e5                	mov    %esp,%ebp
+  800a78:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a7b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a7f:	eb 03                	jmp    800a84 <strchr+0xf>
+  800a81:	83 c0 01             	add    $0x1,%eax
+  800a84:	0f b6 10             	movzbl (%eax),%edx
+  800a87:	84 d2                	test   %dl,%dl
+  800a89:	74 06                	je     800a91 <strchr+0x1c>
+		if (*s == c)
+  800a8b:	38 ca                	cmp    %cl,%dl
+  800a8d:	75 f2                	jne    800a81 <strchr+0xc>
+  800a8f:	eb 05                	jmp    800a96 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a91:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a96:	5d                   	pop    %ebp
+  800a97:	c3                   	ret
+
+00800a98 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a98:	55                   	push   %ebp
+  800a99:	89 e5                	mov    %esp,%ebp
+  800a9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800aa2:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800aa5:	38 ca                	cmp    %cl,%dl
+  800aa7:	74 09                	je     800ab2 <strfind+0x1a>
+  800aa9:	84 d2                	test   %dl,%dl
+  800aab:	74 05                	je     800ab2 <strfind+0x1a>
+	for (; *s; s++)
+  800aad:	83 c0 01             	add    $0x1,%eax
+  800ab0:	eb f0                	jmp    800aa2 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800ab2:	5d                   	pop    %ebp
+  800ab3:	c3                   	ret
+
+00800ab4 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ab4:	55                   	push   %ebp
+  800ab5:	89 e5                	mov    %esp,%ebp
+  800ab7:	57                   	push   %edi
+  800ab8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800abb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800abe:	85 c9                	test   %ecx,%ecx
+  800ac0:	74 20                	je     800ae2 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ac2:	89 f8                	mov    %edi,%eax
+  800ac4:	09 c8                	or     %ecx,%eax
+  800ac6:	a8 03                	test   $0x3,%al
+  800ac8:	75 12                	jne    800adc <memset+0x28>
+		c &= 0xFF;
+  800aca:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ace:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ad4:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ad7:	fc                   	cld
+  800ad8:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ada:	eb 06                	jmp    800ae2 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800adc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800adf:	fc                   	cld
+  800ae0:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ae2:	89 f8                	mov    %edi,%eax
+  800ae4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ae7:	c9                   	leave
+  800ae8:	c3                   	ret
+
+00800ae9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ae9:	55                   	push   %ebp
+  800aea:	89 e5                	mov    %esp,%ebp
+  800aec:	57                   	push   %edi
+  800aed:	56                   	push   %esi
+  800aee:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800af4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800af7:	39 c6                	cmp    %eax,%esi
+  800af9:	73 32                	jae    800b2d <memmove+0x44>
+  800afb:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800afe:	39 d0                	cmp    %edx,%eax
+  800b00:	73 2b                	jae    800b2d <memmove+0x44>
+		s += n;
+		d += n;
+  800b02:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b05:	89 d6                	mov    %edx,%esi
+  800b07:	09 fe                	or     %edi,%esi
+  800b09:	09 ce                	or     %ecx,%esi
+  800b0b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b11:	75 0e                	jne    800b21 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b13:	83 ef 04             	sub    $0x4,%edi
+  800b16:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b19:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b1c:	fd                   	std
+  800b1d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b1f:	eb 09                	jmp    800b2a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b21:	83 ef 01             	sub    $0x1,%edi
+  800b24:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b27:	fd                   	std
+  800b28:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b2a:	fc                   	cld
+  800b2b:	eb 1a                	jmp    800b47 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b2d:	89 f2                	mov    %esi,%edx
+  800b2f:	09 c2                	or     %eax,%edx
+  800b31:	09 ca                	or     %ecx,%edx
+  800b33:	f6 c2 03             	test   $0x3,%dl
+  800b36:	75 0a                	jne    800b42 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b38:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b3b:	89 c7                	mov    %eax,%edi
+  800b3d:	fc                   	cld
+  800b3e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b40:	eb 05                	jmp    800b47 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b42:	89 c7                	mov    %eax,%edi
+  800b44:	fc                   	cld
+  800b45:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b47:	5e                   	pop    %esi
+  800b48:	5f                   	pop    %edi
+  800b49:	5d                   	pop    %ebp
+  800b4a:	c3                   	ret
+
+00800b4b <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b51:	ff 75 10             	push   0x10(%ebp)
+  800b54:	ff 75 0c             	push   0xc(%ebp)
+  800b57:	ff 75 08             	push   0x8(%ebp)
+  800b5a:	e8 8a ff ff ff       	call   800ae9 <memmove>
+}
+  800b5f:	c9                   	leave
+  800b60:	c3                   	ret
+
+00800b61 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b61:	55                   	push   %ebp
+  800b62:	89 e5                	mov    %esp,%ebp
+  800b64:	56                   	push   %esi
+  800b65:	53                   	push   %ebx
+  800b66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b69:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b6c:	89 c6                	mov    %eax,%esi
+  800b6e:	03 75 10             	add    0x10(%ebp),%esi
+  800b71:	eb 06                	jmp    800b79 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b73:	83 c0 01             	add    $0x1,%eax
+  800b76:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b79:	39 f0                	cmp    %esi,%eax
+  800b7b:	74 14                	je     800b91 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b7d:	0f b6 08             	movzbl (%eax),%ecx
+  800b80:	0f b6 1a             	movzbl (%edx),%ebx
+  800b83:	38 d9                	cmp    %bl,%cl
+  800b85:	74 ec                	je     800b73 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b87:	0f b6 c1             	movzbl %cl,%eax
+  800b8a:	0f b6 db             	movzbl %bl,%ebx
+  800b8d:	29 d8                	sub    %ebx,%eax
+  800b8f:	eb 05                	jmp    800b96 <memcmp+0x35>
+	}
+
+	return 0;
+  800b91:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b96:	5b                   	pop    %ebx
+  800b97:	5e                   	pop    %esi
+  800b98:	5d                   	pop    %ebp
+  800b99:	c3                   	ret
+
+00800b9a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b9a:	55                   	push   %ebp
+  800b9b:	89 e5                	mov    %esp,%ebp
+  800b9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ba0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ba3:	89 c2                	mov    %eax,%edx
+  800ba5:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ba8:	eb 03                	jmp    800bad <memfind+0x13>
+  800baa:	83 c0 01             	add    $0x1,%eax
+  800bad:	39 d0                	cmp    %edx,%eax
+  800baf:	73 04                	jae    800bb5 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bb1:	38 08                	cmp    %cl,(%eax)
+  800bb3:	75 f5                	jne    800baa <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800bb5:	5d                   	pop    %ebp
+  800bb6:	c3                   	ret
+
+00800bb7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bb7:	55                   	push   %ebp
+  800bb8:	89 e5                	mov    %esp,%ebp
+  800bba:	57                   	push   %edi
+  800bbb:	56                   	push   %esi
+  800bbc:	53                   	push   %ebx
+  800bbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bc3:	eb 03                	jmp    800bc8 <strtol+0x11>
+		s++;
+  800bc5:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800bc8:	0f b6 02             	movzbl (%edx),%eax
+  800bcb:	3c 20                	cmp    $0x20,%al
+  800bcd:	74 f6                	je     800bc5 <strtol+0xe>
+  800bcf:	3c 09                	cmp    $0x9,%al
+  800bd1:	74 f2                	je     800bc5 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bd3:	3c 2b                	cmp    $0x2b,%al
+  800bd5:	74 2a                	je     800c01 <strtol+0x4a>
+	int neg = 0;
+  800bd7:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bdc:	3c 2d                	cmp    $0x2d,%al
+  800bde:	74 2b                	je     800c0b <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800be0:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800be6:	75 0f                	jne    800bf7 <strtol+0x40>
+  800be8:	80 3a 30             	cmpb   $0x30,(%edx)
+  800beb:	74 28                	je     800c15 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bed:	85 db                	test   %ebx,%ebx
+  800bef:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bf4:	0f 44 d8             	cmove  %eax,%ebx
+  800bf7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bfc:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bff:	eb 46                	jmp    800c47 <strtol+0x90>
+		s++;
+  800c01:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c04:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c09:	eb d5                	jmp    800be0 <strtol+0x29>
+		s++, neg = 1;
+  800c0b:	83 c2 01             	add    $0x1,%edx
+  800c0e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c13:	eb cb                	jmp    800be0 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c15:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c19:	74 0e                	je     800c29 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800c1b:	85 db                	test   %ebx,%ebx
+  800c1d:	75 d8                	jne    800bf7 <strtol+0x40>
+		s++, base = 8;
+  800c1f:	83 c2 01             	add    $0x1,%edx
+  800c22:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c27:	eb ce                	jmp    800bf7 <strtol+0x40>
+		s += 2, base = 16;
+  800c29:	83 c2 02             	add    $0x2,%edx
+  800c2c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c31:	eb c4                	jmp    800bf7 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c33:	0f be c0             	movsbl %al,%eax
+  800c36:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c39:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c3c:	7d 3a                	jge    800c78 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800c3e:	83 c2 01             	add    $0x1,%edx
+  800c41:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c45:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c47:	0f b6 02             	movzbl (%edx),%eax
+  800c4a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c4d:	89 f3                	mov    %esi,%ebx
+  800c4f:	80 fb 09             	cmp    $0x9,%bl
+  800c52:	76 df                	jbe    800c33 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c54:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c57:	89 f3                	mov    %esi,%ebx
+  800c59:	80 fb 19             	cmp    $0x19,%bl
+  800c5c:	77 08                	ja     800c66 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c5e:	0f be c0             	movsbl %al,%eax
+  800c61:	83 e8 57             	sub    $0x57,%eax
+  800c64:	eb d3                	jmp    800c39 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c66:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c69:	89 f3                	mov    %esi,%ebx
+  800c6b:	80 fb 19             	cmp    $0x19,%bl
+  800c6e:	77 08                	ja     800c78 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c70:	0f be c0             	movsbl %al,%eax
+  800c73:	83 e8 37             	sub    $0x37,%eax
+  800c76:	eb c1                	jmp    800c39 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c78:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c7c:	74 05                	je     800c83 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c7e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c81:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c83:	89 c8                	mov    %ecx,%eax
+  800c85:	f7 d8                	neg    %eax
+  800c87:	85 ff                	test   %edi,%edi
+  800c89:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c8c:	89 c8                	mov    %ecx,%eax
+  800c8e:	5b                   	pop    %ebx
+  800c8f:	5e                   	pop    %esi
+  800c90:	5f                   	pop    %edi
+  800c91:	5d                   	pop    %ebp
+  800c92:	c3                   	ret
+
+00800c93 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c93:	55                   	push   %ebp
+  800c94:	89 e5                	mov    %esp,%ebp
+  800c96:	57                   	push   %edi
+  800c97:	56                   	push   %esi
+  800c98:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca4:	89 c3                	mov    %eax,%ebx
+  800ca6:	89 c7                	mov    %eax,%edi
+  800ca8:	55                   	push   %ebp
+  800ca9:	89 e5                	mov    %esp,%ebp
+  800cab:	8d 35 b3 0c 80 00    	lea    0x800cb3,%esi
+  800cb1:	0f 34                	sysenter
+  800cb3:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800cb4:	5b                   	pop    %ebx
+  800cb5:	5e                   	pop    %esi
+  800cb6:	5f                   	pop    %edi
+  800cb7:	5d                   	pop    %ebp
+  800cb8:	c3                   	ret
+
+00800cb9 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cb9:	55                   	push   %ebp
+  800cba:	89 e5                	mov    %esp,%ebp
+  800cbc:	57                   	push   %edi
+  800cbd:	56                   	push   %esi
+  800cbe:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800cbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cc9:	89 d1                	mov    %edx,%ecx
+  800ccb:	89 d3                	mov    %edx,%ebx
+  800ccd:	89 d7                	mov    %edx,%edi
+  800ccf:	55                   	push   %ebp
+  800cd0:	89 e5                	mov    %esp,%ebp
+  800cd2:	8d 35 da 0c 80 00    	lea    0x800cda,%esi
+  800cd8:	0f 34                	sysenter
+  800cda:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800cdb:	5b                   	pop    %ebx
+  800cdc:	5e                   	pop    %esi
+  800cdd:	5f                   	pop    %edi
+  800cde:	5d                   	pop    %ebp
+  800cdf:	c3                   	ret
+
+00800ce0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ce0:	55                   	push   %ebp
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	57                   	push   %edi
+  800ce4:	56                   	push   %esi
+  800ce5:	53                   	push   %ebx
+  800ce6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ce9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf1:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cf6:	89 cb                	mov    %ecx,%ebx
+  800cf8:	89 cf                	mov    %ecx,%edi
+  800cfa:	55                   	push   %ebp
+  800cfb:	89 e5                	mov    %esp,%ebp
+  800cfd:	8d 35 05 0d 80 00    	lea    0x800d05,%esi
+  800d03:	0f 34                	sysenter
+  800d05:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d06:	85 c0                	test   %eax,%eax
+  800d08:	7f 08                	jg     800d12 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800d0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0d:	5b                   	pop    %ebx
+  800d0e:	5e                   	pop    %esi
+  800d0f:	5f                   	pop    %edi
+  800d10:	5d                   	pop    %ebp
+  800d11:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d12:	83 ec 0c             	sub    $0xc,%esp
+  800d15:	50                   	push   %eax
+  800d16:	6a 03                	push   $0x3
+  800d18:	68 47 3d 80 00       	push   $0x803d47
+  800d1d:	6a 3d                	push   $0x3d
+  800d1f:	68 64 3d 80 00       	push   $0x803d64
+  800d24:	e8 71 f5 ff ff       	call   80029a <_panic>
+
+00800d29 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	57                   	push   %edi
+  800d2d:	56                   	push   %esi
+  800d2e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d34:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d39:	89 d1                	mov    %edx,%ecx
+  800d3b:	89 d3                	mov    %edx,%ebx
+  800d3d:	89 d7                	mov    %edx,%edi
+  800d3f:	55                   	push   %ebp
+  800d40:	89 e5                	mov    %esp,%ebp
+  800d42:	8d 35 4a 0d 80 00    	lea    0x800d4a,%esi
+  800d48:	0f 34                	sysenter
+  800d4a:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800d4b:	5b                   	pop    %ebx
+  800d4c:	5e                   	pop    %esi
+  800d4d:	5f                   	pop    %edi
+  800d4e:	5d                   	pop    %ebp
+  800d4f:	c3                   	ret
+
+00800d50 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d50:	55                   	push   %ebp
+  800d51:	89 e5                	mov    %esp,%ebp
+  800d53:	57                   	push   %edi
+  800d54:	56                   	push   %esi
+  800d55:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d56:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d60:	89 d1                	mov    %edx,%ecx
+  800d62:	89 d3                	mov    %edx,%ebx
+  800d64:	89 d7                	mov    %edx,%edi
+  800d66:	89 d6                	mov    %edx,%esi
+  800d68:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d6a:	5b                   	pop    %ebx
+  800d6b:	5e                   	pop    %esi
+  800d6c:	5f                   	pop    %edi
+  800d6d:	5d                   	pop    %ebp
+  800d6e:	c3                   	ret
+
+00800d6f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	57                   	push   %edi
+  800d73:	56                   	push   %esi
+  800d74:	53                   	push   %ebx
+  800d75:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d83:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d8b:	55                   	push   %ebp
+  800d8c:	89 e5                	mov    %esp,%ebp
+  800d8e:	8d 35 96 0d 80 00    	lea    0x800d96,%esi
+  800d94:	0f 34                	sysenter
+  800d96:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d97:	85 c0                	test   %eax,%eax
+  800d99:	7f 08                	jg     800da3 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800d9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9e:	5b                   	pop    %ebx
+  800d9f:	5e                   	pop    %esi
+  800da0:	5f                   	pop    %edi
+  800da1:	5d                   	pop    %ebp
+  800da2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da3:	83 ec 0c             	sub    $0xc,%esp
+  800da6:	50                   	push   %eax
+  800da7:	6a 04                	push   $0x4
+  800da9:	68 47 3d 80 00       	push   $0x803d47
+  800dae:	6a 3d                	push   $0x3d
+  800db0:	68 64 3d 80 00       	push   $0x803d64
+  800db5:	e8 e0 f4 ff ff       	call   80029a <_panic>
+
+00800dba <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800dba:	55                   	push   %ebp
+  800dbb:	89 e5                	mov    %esp,%ebp
+  800dbd:	57                   	push   %edi
+  800dbe:	56                   	push   %esi
+  800dbf:	53                   	push   %ebx
+  800dc0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dd4:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dd7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dd9:	85 c0                	test   %eax,%eax
+  800ddb:	7f 08                	jg     800de5 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ddd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de0:	5b                   	pop    %ebx
+  800de1:	5e                   	pop    %esi
+  800de2:	5f                   	pop    %edi
+  800de3:	5d                   	pop    %ebp
+  800de4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de5:	83 ec 0c             	sub    $0xc,%esp
+  800de8:	50                   	push   %eax
+  800de9:	6a 05                	push   $0x5
+  800deb:	68 47 3d 80 00       	push   $0x803d47
+  800df0:	6a 23                	push   $0x23
+  800df2:	68 64 3d 80 00       	push   $0x803d64
+  800df7:	e8 9e f4 ff ff       	call   80029a <_panic>
+
+00800dfc <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dfc:	55                   	push   %ebp
+  800dfd:	89 e5                	mov    %esp,%ebp
+  800dff:	57                   	push   %edi
+  800e00:	56                   	push   %esi
+  800e01:	53                   	push   %ebx
+  800e02:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e10:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e15:	89 df                	mov    %ebx,%edi
+  800e17:	55                   	push   %ebp
+  800e18:	89 e5                	mov    %esp,%ebp
+  800e1a:	8d 35 22 0e 80 00    	lea    0x800e22,%esi
+  800e20:	0f 34                	sysenter
+  800e22:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e23:	85 c0                	test   %eax,%eax
+  800e25:	7f 08                	jg     800e2f <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800e27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2a:	5b                   	pop    %ebx
+  800e2b:	5e                   	pop    %esi
+  800e2c:	5f                   	pop    %edi
+  800e2d:	5d                   	pop    %ebp
+  800e2e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e2f:	83 ec 0c             	sub    $0xc,%esp
+  800e32:	50                   	push   %eax
+  800e33:	6a 06                	push   $0x6
+  800e35:	68 47 3d 80 00       	push   $0x803d47
+  800e3a:	6a 3d                	push   $0x3d
+  800e3c:	68 64 3d 80 00       	push   $0x803d64
+  800e41:	e8 54 f4 ff ff       	call   80029a <_panic>
+
+00800e46 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e46:	55                   	push   %ebp
+  800e47:	89 e5                	mov    %esp,%ebp
+  800e49:	57                   	push   %edi
+  800e4a:	56                   	push   %esi
+  800e4b:	53                   	push   %ebx
+  800e4c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5a:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e5f:	89 df                	mov    %ebx,%edi
+  800e61:	55                   	push   %ebp
+  800e62:	89 e5                	mov    %esp,%ebp
+  800e64:	8d 35 6c 0e 80 00    	lea    0x800e6c,%esi
+  800e6a:	0f 34                	sysenter
+  800e6c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e6d:	85 c0                	test   %eax,%eax
+  800e6f:	7f 08                	jg     800e79 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800e71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e74:	5b                   	pop    %ebx
+  800e75:	5e                   	pop    %esi
+  800e76:	5f                   	pop    %edi
+  800e77:	5d                   	pop    %ebp
+  800e78:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e79:	83 ec 0c             	sub    $0xc,%esp
+  800e7c:	50                   	push   %eax
+  800e7d:	6a 08                	push   $0x8
+  800e7f:	68 47 3d 80 00       	push   $0x803d47
+  800e84:	6a 3d                	push   $0x3d
+  800e86:	68 64 3d 80 00       	push   $0x803d64
+  800e8b:	e8 0a f4 ff ff       	call   80029a <_panic>
+
+00800e90 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e90:	55                   	push   %ebp
+  800e91:	89 e5                	mov    %esp,%ebp
+  800e93:	57                   	push   %edi
+  800e94:	56                   	push   %esi
+  800e95:	53                   	push   %ebx
+  800e96:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea4:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ea9:	89 df                	mov    %ebx,%edi
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	8d 35 b6 0e 80 00    	lea    0x800eb6,%esi
+  800eb4:	0f 34                	sysenter
+  800eb6:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800eb7:	85 c0                	test   %eax,%eax
+  800eb9:	7f 08                	jg     800ec3 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800ebb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ebe:	5b                   	pop    %ebx
+  800ebf:	5e                   	pop    %esi
+  800ec0:	5f                   	pop    %edi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec3:	83 ec 0c             	sub    $0xc,%esp
+  800ec6:	50                   	push   %eax
+  800ec7:	6a 09                	push   $0x9
+  800ec9:	68 47 3d 80 00       	push   $0x803d47
+  800ece:	6a 3d                	push   $0x3d
+  800ed0:	68 64 3d 80 00       	push   $0x803d64
+  800ed5:	e8 c0 f3 ff ff       	call   80029a <_panic>
+
+00800eda <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800eda:	55                   	push   %ebp
+  800edb:	89 e5                	mov    %esp,%ebp
+  800edd:	57                   	push   %edi
+  800ede:	56                   	push   %esi
+  800edf:	53                   	push   %ebx
+  800ee0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ee3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eeb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eee:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ef3:	89 df                	mov    %ebx,%edi
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	8d 35 00 0f 80 00    	lea    0x800f00,%esi
+  800efe:	0f 34                	sysenter
+  800f00:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f01:	85 c0                	test   %eax,%eax
+  800f03:	7f 08                	jg     800f0d <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800f05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f08:	5b                   	pop    %ebx
+  800f09:	5e                   	pop    %esi
+  800f0a:	5f                   	pop    %edi
+  800f0b:	5d                   	pop    %ebp
+  800f0c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0d:	83 ec 0c             	sub    $0xc,%esp
+  800f10:	50                   	push   %eax
+  800f11:	6a 0a                	push   $0xa
+  800f13:	68 47 3d 80 00       	push   $0x803d47
+  800f18:	6a 3d                	push   $0x3d
+  800f1a:	68 64 3d 80 00       	push   $0x803d64
+  800f1f:	e8 76 f3 ff ff       	call   80029a <_panic>
+
+00800f24 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f24:	55                   	push   %ebp
+  800f25:	89 e5                	mov    %esp,%ebp
+  800f27:	57                   	push   %edi
+  800f28:	56                   	push   %esi
+  800f29:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f30:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f38:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	8d 35 46 0f 80 00    	lea    0x800f46,%esi
+  800f44:	0f 34                	sysenter
+  800f46:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800f47:	5b                   	pop    %ebx
+  800f48:	5e                   	pop    %esi
+  800f49:	5f                   	pop    %edi
+  800f4a:	5d                   	pop    %ebp
+  800f4b:	c3                   	ret
+
+00800f4c <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800f4c:	55                   	push   %ebp
+  800f4d:	89 e5                	mov    %esp,%ebp
+  800f4f:	57                   	push   %edi
+  800f50:	56                   	push   %esi
+  800f51:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f52:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f58:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f60:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f63:	55                   	push   %ebp
+  800f64:	89 e5                	mov    %esp,%ebp
+  800f66:	8d 35 6e 0f 80 00    	lea    0x800f6e,%esi
+  800f6c:	0f 34                	sysenter
+  800f6e:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800f6f:	5b                   	pop    %ebx
+  800f70:	5e                   	pop    %esi
+  800f71:	5f                   	pop    %edi
+  800f72:	5d                   	pop    %ebp
+  800f73:	c3                   	ret
+
+00800f74 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	57                   	push   %edi
+  800f78:	56                   	push   %esi
+  800f79:	53                   	push   %ebx
+  800f7a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f7d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f88:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f90:	89 f7                	mov    %esi,%edi
+  800f92:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f94:	85 c0                	test   %eax,%eax
+  800f96:	7f 08                	jg     800fa0 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800f98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9b:	5b                   	pop    %ebx
+  800f9c:	5e                   	pop    %esi
+  800f9d:	5f                   	pop    %edi
+  800f9e:	5d                   	pop    %ebp
+  800f9f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa0:	83 ec 0c             	sub    $0xc,%esp
+  800fa3:	50                   	push   %eax
+  800fa4:	6a 0d                	push   $0xd
+  800fa6:	68 47 3d 80 00       	push   $0x803d47
+  800fab:	6a 23                	push   $0x23
+  800fad:	68 64 3d 80 00       	push   $0x803d64
+  800fb2:	e8 e3 f2 ff ff       	call   80029a <_panic>
+
+00800fb7 <sys_ipc_recv>:
+{
+  800fb7:	55                   	push   %ebp
+  800fb8:	89 e5                	mov    %esp,%ebp
+  800fba:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800fbd:	6a 00                	push   $0x0
+  800fbf:	6a 01                	push   $0x1
+  800fc1:	ff 75 08             	push   0x8(%ebp)
+  800fc4:	e8 ab ff ff ff       	call   800f74 <sys_ipc_recvv>
+}
+  800fc9:	c9                   	leave
+  800fca:	c3                   	ret
+
+00800fcb <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800fcb:	55                   	push   %ebp
+  800fcc:	89 e5                	mov    %esp,%ebp
+  800fce:	57                   	push   %edi
+  800fcf:	56                   	push   %esi
+  800fd0:	53                   	push   %ebx
+  800fd1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fe4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800fe7:	89 de                	mov    %ebx,%esi
+  800fe9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800feb:	85 c0                	test   %eax,%eax
+  800fed:	7f 08                	jg     800ff7 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800fef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff2:	5b                   	pop    %ebx
+  800ff3:	5e                   	pop    %esi
+  800ff4:	5f                   	pop    %edi
+  800ff5:	5d                   	pop    %ebp
+  800ff6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff7:	83 ec 0c             	sub    $0xc,%esp
+  800ffa:	50                   	push   %eax
+  800ffb:	6a 0d                	push   $0xd
+  800ffd:	68 47 3d 80 00       	push   $0x803d47
+  801002:	6a 23                	push   $0x23
+  801004:	68 64 3d 80 00       	push   $0x803d64
+  801009:	e8 8c f2 ff ff       	call   80029a <_panic>
+
+0080100e <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80100e:	55                   	push   %ebp
+  80100f:	89 e5                	mov    %esp,%ebp
+  801011:	57                   	push   %edi
+  801012:	56                   	push   %esi
+  801013:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801014:	ba 00 00 00 00       	mov    $0x0,%edx
+  801019:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80101e:	89 d1                	mov    %edx,%ecx
+  801020:	89 d3                	mov    %edx,%ebx
+  801022:	89 d7                	mov    %edx,%edi
+  801024:	55                   	push   %ebp
+  801025:	89 e5                	mov    %esp,%ebp
+  801027:	8d 35 2f 10 80 00    	lea    0x80102f,%esi
+  80102d:	0f 34                	sysenter
+  80102f:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  801030:	5b                   	pop    %ebx
+  801031:	5e                   	pop    %esi
+  801032:	5f                   	pop    %edi
+  801033:	5d                   	pop    %ebp
+  801034:	c3                   	ret
+
+00801035 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	57                   	push   %edi
+  801039:	56                   	push   %esi
+  80103a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80103b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801040:	8b 55 08             	mov    0x8(%ebp),%edx
+  801043:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801046:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80104b:	89 df                	mov    %ebx,%edi
+  80104d:	55                   	push   %ebp
+  80104e:	89 e5                	mov    %esp,%ebp
+  801050:	8d 35 58 10 80 00    	lea    0x801058,%esi
+  801056:	0f 34                	sysenter
+  801058:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  801059:	5b                   	pop    %ebx
+  80105a:	5e                   	pop    %esi
+  80105b:	5f                   	pop    %edi
+  80105c:	5d                   	pop    %ebp
+  80105d:	c3                   	ret
+
+0080105e <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	57                   	push   %edi
+  801062:	56                   	push   %esi
+  801063:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801064:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801069:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801071:	89 cb                	mov    %ecx,%ebx
+  801073:	89 cf                	mov    %ecx,%edi
+  801075:	55                   	push   %ebp
+  801076:	89 e5                	mov    %esp,%ebp
+  801078:	8d 35 80 10 80 00    	lea    0x801080,%esi
+  80107e:	0f 34                	sysenter
+  801080:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  801081:	5b                   	pop    %ebx
+  801082:	5e                   	pop    %esi
+  801083:	5f                   	pop    %edi
+  801084:	5d                   	pop    %ebp
+  801085:	c3                   	ret
+
+00801086 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	57                   	push   %edi
+  80108a:	56                   	push   %esi
+  80108b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80108c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801091:	8b 55 08             	mov    0x8(%ebp),%edx
+  801094:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801097:	b8 12 00 00 00       	mov    $0x12,%eax
+  80109c:	89 df                	mov    %ebx,%edi
+  80109e:	55                   	push   %ebp
+  80109f:	89 e5                	mov    %esp,%ebp
+  8010a1:	8d 35 a9 10 80 00    	lea    0x8010a9,%esi
+  8010a7:	0f 34                	sysenter
+  8010a9:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8010aa:	5b                   	pop    %ebx
+  8010ab:	5e                   	pop    %esi
+  8010ac:	5f                   	pop    %edi
+  8010ad:	5d                   	pop    %ebp
+  8010ae:	c3                   	ret
+
+008010af <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8010af:	55                   	push   %ebp
+  8010b0:	89 e5                	mov    %esp,%ebp
+  8010b2:	57                   	push   %edi
+  8010b3:	56                   	push   %esi
+  8010b4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010c5:	89 df                	mov    %ebx,%edi
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	8d 35 d2 10 80 00    	lea    0x8010d2,%esi
+  8010d0:	0f 34                	sysenter
+  8010d2:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  8010d3:	5b                   	pop    %ebx
+  8010d4:	5e                   	pop    %esi
+  8010d5:	5f                   	pop    %edi
+  8010d6:	5d                   	pop    %ebp
+  8010d7:	c3                   	ret
+
+008010d8 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	57                   	push   %edi
+  8010dc:	56                   	push   %esi
+  8010dd:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ef:	55                   	push   %ebp
+  8010f0:	89 e5                	mov    %esp,%ebp
+  8010f2:	8d 35 fa 10 80 00    	lea    0x8010fa,%esi
+  8010f8:	0f 34                	sysenter
+  8010fa:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  8010fb:	5b                   	pop    %ebx
+  8010fc:	5e                   	pop    %esi
+  8010fd:	5f                   	pop    %edi
+  8010fe:	5d                   	pop    %ebp
+  8010ff:	c3                   	ret
+
+00801100 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801100:	55                   	push   %ebp
+  801101:	89 e5                	mov    %esp,%ebp
+  801103:	57                   	push   %edi
+  801104:	56                   	push   %esi
+  801105:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801106:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80110b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801113:	89 cb                	mov    %ecx,%ebx
+  801115:	89 cf                	mov    %ecx,%edi
+  801117:	89 ce                	mov    %ecx,%esi
+  801119:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  80111b:	5b                   	pop    %ebx
+  80111c:	5e                   	pop    %esi
+  80111d:	5f                   	pop    %edi
+  80111e:	5d                   	pop    %ebp
+  80111f:	c3                   	ret
+
+00801120 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  801120:	55                   	push   %ebp
+  801121:	89 e5                	mov    %esp,%ebp
+  801123:	57                   	push   %edi
+  801124:	56                   	push   %esi
+  801125:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801126:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80112b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801133:	89 cb                	mov    %ecx,%ebx
+  801135:	89 cf                	mov    %ecx,%edi
+  801137:	55                   	push   %ebp
+  801138:	89 e5                	mov    %esp,%ebp
+  80113a:	8d 35 42 11 80 00    	lea    0x801142,%esi
+  801140:	0f 34                	sysenter
+  801142:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  801143:	5b                   	pop    %ebx
+  801144:	5e                   	pop    %esi
+  801145:	5f                   	pop    %edi
+  801146:	5d                   	pop    %ebp
+  801147:	c3                   	ret
+
+00801148 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	57                   	push   %edi
+  80114c:	56                   	push   %esi
+  80114d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80114e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801153:	8b 55 08             	mov    0x8(%ebp),%edx
+  801156:	b8 16 00 00 00       	mov    $0x16,%eax
+  80115b:	89 cb                	mov    %ecx,%ebx
+  80115d:	89 cf                	mov    %ecx,%edi
+  80115f:	55                   	push   %ebp
+  801160:	89 e5                	mov    %esp,%ebp
+  801162:	8d 35 6a 11 80 00    	lea    0x80116a,%esi
+  801168:	0f 34                	sysenter
+  80116a:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  80116b:	5b                   	pop    %ebx
+  80116c:	5e                   	pop    %esi
+  80116d:	5f                   	pop    %edi
+  80116e:	5d                   	pop    %ebp
+  80116f:	c3                   	ret
+
+00801170 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	57                   	push   %edi
+  801174:	56                   	push   %esi
+  801175:	53                   	push   %ebx
+  801176:	83 ec 20             	sub    $0x20,%esp
+  801179:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80117c:	89 d7                	mov    %edx,%edi
+  80117e:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  801180:	51                   	push   %ecx
+  801181:	68 00 f0 7f 00       	push   $0x7ff000
+  801186:	6a 00                	push   $0x0
+  801188:	e8 e2 fb ff ff       	call   800d6f <sys_page_alloc>
+  80118d:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80118f:	83 c4 10             	add    $0x10,%esp
+  801192:	85 c0                	test   %eax,%eax
+  801194:	78 45                	js     8011db <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  801196:	83 ec 04             	sub    $0x4,%esp
+  801199:	68 00 10 00 00       	push   $0x1000
+  80119e:	57                   	push   %edi
+  80119f:	68 00 f0 7f 00       	push   $0x7ff000
+  8011a4:	e8 40 f9 ff ff       	call   800ae9 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8011a9:	89 34 24             	mov    %esi,(%esp)
+  8011ac:	57                   	push   %edi
+  8011ad:	ff 75 e4             	push   -0x1c(%ebp)
+  8011b0:	68 00 f0 7f 00       	push   $0x7ff000
+  8011b5:	6a 00                	push   $0x0
+  8011b7:	e8 fe fb ff ff       	call   800dba <sys_page_map>
+  8011bc:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8011be:	83 c4 20             	add    $0x20,%esp
+  8011c1:	85 c0                	test   %eax,%eax
+  8011c3:	78 16                	js     8011db <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8011c5:	83 ec 08             	sub    $0x8,%esp
+  8011c8:	68 00 f0 7f 00       	push   $0x7ff000
+  8011cd:	6a 00                	push   $0x0
+  8011cf:	e8 28 fc ff ff       	call   800dfc <sys_page_unmap>
+  8011d4:	83 c4 10             	add    $0x10,%esp
+  8011d7:	85 c0                	test   %eax,%eax
+  8011d9:	75 0a                	jne    8011e5 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8011db:	89 d8                	mov    %ebx,%eax
+  8011dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e0:	5b                   	pop    %ebx
+  8011e1:	5e                   	pop    %esi
+  8011e2:	5f                   	pop    %edi
+  8011e3:	5d                   	pop    %ebp
+  8011e4:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8011e5:	68 74 3d 80 00       	push   $0x803d74
+  8011ea:	68 ec 3d 80 00       	push   $0x803dec
+  8011ef:	6a 1b                	push   $0x1b
+  8011f1:	68 01 3e 80 00       	push   $0x803e01
+  8011f6:	e8 9f f0 ff ff       	call   80029a <_panic>
+
+008011fb <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8011fb:	55                   	push   %ebp
+  8011fc:	89 e5                	mov    %esp,%ebp
+  8011fe:	53                   	push   %ebx
+  8011ff:	83 ec 04             	sub    $0x4,%esp
+  801202:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  801205:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  801207:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  80120b:	74 21                	je     80122e <pgfault+0x33>
+  80120d:	89 d0                	mov    %edx,%eax
+  80120f:	c1 e8 16             	shr    $0x16,%eax
+  801212:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801219:	a8 01                	test   $0x1,%al
+  80121b:	74 11                	je     80122e <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  80121d:	89 d0                	mov    %edx,%eax
+  80121f:	c1 e8 0c             	shr    $0xc,%eax
+  801222:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801229:	f6 c4 08             	test   $0x8,%ah
+  80122c:	75 17                	jne    801245 <pgfault+0x4a>
+		if (pgfault_next) {
+  80122e:	a1 04 60 80 00       	mov    0x806004,%eax
+  801233:	85 c0                	test   %eax,%eax
+  801235:	74 27                	je     80125e <pgfault+0x63>
+			pgfault_next(utf);
+  801237:	83 ec 0c             	sub    $0xc,%esp
+  80123a:	53                   	push   %ebx
+  80123b:	ff d0                	call   *%eax
+			return;
+  80123d:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  801240:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801243:	c9                   	leave
+  801244:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  801245:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  80124b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801250:	b8 00 00 00 00       	mov    $0x0,%eax
+  801255:	e8 16 ff ff ff       	call   801170 <copy_page_to>
+  80125a:	85 c0                	test   %eax,%eax
+  80125c:	79 e2                	jns    801240 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  80125e:	a1 00 60 80 00       	mov    0x806000,%eax
+  801263:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  801266:	ff 73 28             	push   0x28(%ebx)
+  801269:	ff 33                	push   (%ebx)
+  80126b:	50                   	push   %eax
+  80126c:	68 98 3d 80 00       	push   $0x803d98
+  801271:	e8 ff f0 ff ff       	call   800375 <cprintf>
+	sys_env_destroy(0);
+  801276:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80127d:	e8 5e fa ff ff       	call   800ce0 <sys_env_destroy>
+  801282:	83 c4 10             	add    $0x10,%esp
+  801285:	eb b9                	jmp    801240 <pgfault+0x45>
+
+00801287 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  801287:	55                   	push   %ebp
+  801288:	89 e5                	mov    %esp,%ebp
+  80128a:	53                   	push   %ebx
+  80128b:	83 ec 04             	sub    $0x4,%esp
+  80128e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  801291:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  801296:	3d fb 11 80 00       	cmp    $0x8011fb,%eax
+  80129b:	74 15                	je     8012b2 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80129d:	a3 04 60 80 00       	mov    %eax,0x806004
+		set_pgfault_handler(pgfault);
+  8012a2:	83 ec 0c             	sub    $0xc,%esp
+  8012a5:	68 fb 11 80 00       	push   $0x8011fb
+  8012aa:	e8 91 21 00 00       	call   803440 <set_pgfault_handler>
+  8012af:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8012b2:	83 ec 0c             	sub    $0xc,%esp
+  8012b5:	68 05 08 00 00       	push   $0x805
+  8012ba:	53                   	push   %ebx
+  8012bb:	6a 00                	push   $0x0
+  8012bd:	53                   	push   %ebx
+  8012be:	6a 00                	push   $0x0
+  8012c0:	e8 f5 fa ff ff       	call   800dba <sys_page_map>
+}
+  8012c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012c8:	c9                   	leave
+  8012c9:	c3                   	ret
+
+008012ca <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8012ca:	55                   	push   %ebp
+  8012cb:	89 e5                	mov    %esp,%ebp
+  8012cd:	57                   	push   %edi
+  8012ce:	56                   	push   %esi
+  8012cf:	53                   	push   %ebx
+  8012d0:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8012d3:	68 fb 11 80 00       	push   $0x8011fb
+  8012d8:	e8 63 21 00 00       	call   803440 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8012dd:	b8 07 00 00 00       	mov    $0x7,%eax
+  8012e2:	cd 30                	int    $0x30
+  8012e4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8012e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8012ea:	83 c4 10             	add    $0x10,%esp
+  8012ed:	85 c0                	test   %eax,%eax
+  8012ef:	0f 88 6b 01 00 00    	js     801460 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8012f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8012fa:	75 37                	jne    801333 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8012fc:	e8 28 fa ff ff       	call   800d29 <sys_getenvid>
+  801301:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801306:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80130c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801311:	a3 00 60 80 00       	mov    %eax,0x806000
+		return 0;
+  801316:	e9 45 01 00 00       	jmp    801460 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  80131b:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801321:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801327:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80132d:	0f 87 ba 00 00 00    	ja     8013ed <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  801333:	89 d8                	mov    %ebx,%eax
+  801335:	c1 e8 16             	shr    $0x16,%eax
+  801338:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80133f:	a8 01                	test   $0x1,%al
+  801341:	74 d8                	je     80131b <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  801343:	89 d8                	mov    %ebx,%eax
+  801345:	c1 e8 0c             	shr    $0xc,%eax
+  801348:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80134f:	f6 c2 01             	test   $0x1,%dl
+  801352:	74 cd                	je     801321 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  801354:	89 da                	mov    %ebx,%edx
+  801356:	80 e6 df             	and    $0xdf,%dh
+  801359:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  80135f:	74 c0                	je     801321 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  801361:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801363:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80136a:	f6 c6 04             	test   $0x4,%dh
+  80136d:	75 53                	jne    8013c2 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80136f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801376:	f6 c6 08             	test   $0x8,%dh
+  801379:	75 0c                	jne    801387 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80137b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801382:	f6 c2 02             	test   $0x2,%dl
+  801385:	74 3b                	je     8013c2 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  801387:	83 ec 0c             	sub    $0xc,%esp
+  80138a:	68 05 08 00 00       	push   $0x805
+  80138f:	57                   	push   %edi
+  801390:	ff 75 e4             	push   -0x1c(%ebp)
+  801393:	57                   	push   %edi
+  801394:	6a 00                	push   $0x0
+  801396:	e8 1f fa ff ff       	call   800dba <sys_page_map>
+  80139b:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80139d:	83 c4 20             	add    $0x20,%esp
+  8013a0:	85 c0                	test   %eax,%eax
+  8013a2:	0f 88 a7 00 00 00    	js     80144f <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8013a8:	83 ec 0c             	sub    $0xc,%esp
+  8013ab:	68 05 08 00 00       	push   $0x805
+  8013b0:	57                   	push   %edi
+  8013b1:	6a 00                	push   $0x0
+  8013b3:	57                   	push   %edi
+  8013b4:	6a 00                	push   $0x0
+  8013b6:	e8 ff f9 ff ff       	call   800dba <sys_page_map>
+  8013bb:	89 c6                	mov    %eax,%esi
+	return r;
+  8013bd:	83 c4 20             	add    $0x20,%esp
+  8013c0:	eb 21                	jmp    8013e3 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8013c2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013c9:	83 ec 0c             	sub    $0xc,%esp
+  8013cc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013d1:	50                   	push   %eax
+  8013d2:	57                   	push   %edi
+  8013d3:	ff 75 e4             	push   -0x1c(%ebp)
+  8013d6:	57                   	push   %edi
+  8013d7:	6a 00                	push   $0x0
+  8013d9:	e8 dc f9 ff ff       	call   800dba <sys_page_map>
+  8013de:	89 c6                	mov    %eax,%esi
+  8013e0:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8013e3:	85 f6                	test   %esi,%esi
+  8013e5:	0f 89 36 ff ff ff    	jns    801321 <fork+0x57>
+  8013eb:	eb 62                	jmp    80144f <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8013ed:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8013f2:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8013f7:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8013fa:	89 f8                	mov    %edi,%eax
+  8013fc:	e8 6f fd ff ff       	call   801170 <copy_page_to>
+  801401:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801403:	85 c0                	test   %eax,%eax
+  801405:	78 48                	js     80144f <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801407:	83 ec 04             	sub    $0x4,%esp
+  80140a:	6a 07                	push   $0x7
+  80140c:	68 00 f0 bf ee       	push   $0xeebff000
+  801411:	57                   	push   %edi
+  801412:	e8 58 f9 ff ff       	call   800d6f <sys_page_alloc>
+  801417:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801419:	83 c4 10             	add    $0x10,%esp
+  80141c:	85 c0                	test   %eax,%eax
+  80141e:	78 2f                	js     80144f <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801420:	a1 00 60 80 00       	mov    0x806000,%eax
+  801425:	8b 40 64             	mov    0x64(%eax),%eax
+  801428:	83 ec 08             	sub    $0x8,%esp
+  80142b:	50                   	push   %eax
+  80142c:	57                   	push   %edi
+  80142d:	e8 a8 fa ff ff       	call   800eda <sys_env_set_pgfault_upcall>
+  801432:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801434:	83 c4 10             	add    $0x10,%esp
+  801437:	85 c0                	test   %eax,%eax
+  801439:	78 14                	js     80144f <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80143b:	83 ec 08             	sub    $0x8,%esp
+  80143e:	6a 02                	push   $0x2
+  801440:	57                   	push   %edi
+  801441:	e8 00 fa ff ff       	call   800e46 <sys_env_set_status>
+  801446:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801448:	83 c4 10             	add    $0x10,%esp
+  80144b:	85 c0                	test   %eax,%eax
+  80144d:	79 11                	jns    801460 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  80144f:	83 ec 0c             	sub    $0xc,%esp
+  801452:	ff 75 e0             	push   -0x20(%ebp)
+  801455:	e8 86 f8 ff ff       	call   800ce0 <sys_env_destroy>
+	return r;
+  80145a:	83 c4 10             	add    $0x10,%esp
+  80145d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  801460:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801463:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801466:	5b                   	pop    %ebx
+  801467:	5e                   	pop    %esi
+  801468:	5f                   	pop    %edi
+  801469:	5d                   	pop    %ebp
+  80146a:	c3                   	ret
+
+0080146b <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80146b:	55                   	push   %ebp
+  80146c:	89 e5                	mov    %esp,%ebp
+  80146e:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801471:	68 0c 3e 80 00       	push   $0x803e0c
+  801476:	68 bf 00 00 00       	push   $0xbf
+  80147b:	68 01 3e 80 00       	push   $0x803e01
+  801480:	e8 15 ee ff ff       	call   80029a <_panic>
+
+00801485 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801485:	55                   	push   %ebp
+  801486:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801488:	8b 45 08             	mov    0x8(%ebp),%eax
+  80148b:	05 00 00 00 30       	add    $0x30000000,%eax
+  801490:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801493:	5d                   	pop    %ebp
+  801494:	c3                   	ret
+
+00801495 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801495:	55                   	push   %ebp
+  801496:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801498:	8b 45 08             	mov    0x8(%ebp),%eax
+  80149b:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8014a0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8014a5:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8014aa:	5d                   	pop    %ebp
+  8014ab:	c3                   	ret
+
+008014ac <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8014ac:	55                   	push   %ebp
+  8014ad:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8014af:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8014b4:	eb 02                	jmp    8014b8 <fd_alloc+0xc>
+  8014b6:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8014b8:	89 c2                	mov    %eax,%edx
+  8014ba:	c1 ea 16             	shr    $0x16,%edx
+  8014bd:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8014c4:	f6 c2 01             	test   $0x1,%dl
+  8014c7:	74 2b                	je     8014f4 <fd_alloc+0x48>
+  8014c9:	89 c2                	mov    %eax,%edx
+  8014cb:	c1 ea 0c             	shr    $0xc,%edx
+  8014ce:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8014d5:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8014db:	f6 c1 01             	test   $0x1,%cl
+  8014de:	74 14                	je     8014f4 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8014e0:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8014e6:	75 ce                	jne    8014b6 <fd_alloc+0xa>
+  8014e8:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8014ed:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8014f2:	eb 05                	jmp    8014f9 <fd_alloc+0x4d>
+			return 0;
+  8014f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8014f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fc:	89 02                	mov    %eax,(%edx)
+}
+  8014fe:	89 c8                	mov    %ecx,%eax
+  801500:	5d                   	pop    %ebp
+  801501:	c3                   	ret
+
+00801502 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801502:	55                   	push   %ebp
+  801503:	89 e5                	mov    %esp,%ebp
+  801505:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801508:	83 f8 1f             	cmp    $0x1f,%eax
+  80150b:	77 30                	ja     80153d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80150d:	c1 e0 0c             	shl    $0xc,%eax
+  801510:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801515:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80151b:	f6 c2 01             	test   $0x1,%dl
+  80151e:	74 24                	je     801544 <fd_lookup+0x42>
+  801520:	89 c2                	mov    %eax,%edx
+  801522:	c1 ea 0c             	shr    $0xc,%edx
+  801525:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80152c:	f6 c2 01             	test   $0x1,%dl
+  80152f:	74 1a                	je     80154b <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801531:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801534:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801536:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80153b:	5d                   	pop    %ebp
+  80153c:	c3                   	ret
+		return -E_INVAL;
+  80153d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801542:	eb f7                	jmp    80153b <fd_lookup+0x39>
+		return -E_INVAL;
+  801544:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801549:	eb f0                	jmp    80153b <fd_lookup+0x39>
+  80154b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801550:	eb e9                	jmp    80153b <fd_lookup+0x39>
+
+00801552 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801552:	55                   	push   %ebp
+  801553:	89 e5                	mov    %esp,%ebp
+  801555:	53                   	push   %ebx
+  801556:	83 ec 04             	sub    $0x4,%esp
+  801559:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80155c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801561:	eb 03                	jmp    801566 <dev_lookup+0x14>
+  801563:	83 c0 01             	add    $0x1,%eax
+  801566:	8b 1c 85 a0 3e 80 00 	mov    0x803ea0(,%eax,4),%ebx
+  80156d:	85 db                	test   %ebx,%ebx
+  80156f:	74 0b                	je     80157c <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801571:	39 13                	cmp    %edx,(%ebx)
+  801573:	75 ee                	jne    801563 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157a:	eb 1f                	jmp    80159b <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80157c:	a1 00 60 80 00       	mov    0x806000,%eax
+  801581:	8b 40 48             	mov    0x48(%eax),%eax
+  801584:	83 ec 04             	sub    $0x4,%esp
+  801587:	52                   	push   %edx
+  801588:	50                   	push   %eax
+  801589:	68 24 3e 80 00       	push   $0x803e24
+  80158e:	e8 e2 ed ff ff       	call   800375 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801593:	83 c4 10             	add    $0x10,%esp
+  801596:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80159b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80159e:	89 1a                	mov    %ebx,(%edx)
+}
+  8015a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015a3:	c9                   	leave
+  8015a4:	c3                   	ret
+
+008015a5 <fd_close>:
+{
+  8015a5:	55                   	push   %ebp
+  8015a6:	89 e5                	mov    %esp,%ebp
+  8015a8:	57                   	push   %edi
+  8015a9:	56                   	push   %esi
+  8015aa:	53                   	push   %ebx
+  8015ab:	83 ec 24             	sub    $0x24,%esp
+  8015ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8015b1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015b4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015b7:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015b8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8015be:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015c1:	50                   	push   %eax
+  8015c2:	e8 3b ff ff ff       	call   801502 <fd_lookup>
+  8015c7:	89 c3                	mov    %eax,%ebx
+  8015c9:	83 c4 10             	add    $0x10,%esp
+  8015cc:	85 c0                	test   %eax,%eax
+  8015ce:	78 05                	js     8015d5 <fd_close+0x30>
+	    || fd != fd2)
+  8015d0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8015d3:	74 16                	je     8015eb <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8015d5:	89 f8                	mov    %edi,%eax
+  8015d7:	84 c0                	test   %al,%al
+  8015d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015de:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8015e1:	89 d8                	mov    %ebx,%eax
+  8015e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e6:	5b                   	pop    %ebx
+  8015e7:	5e                   	pop    %esi
+  8015e8:	5f                   	pop    %edi
+  8015e9:	5d                   	pop    %ebp
+  8015ea:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8015eb:	83 ec 08             	sub    $0x8,%esp
+  8015ee:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8015f1:	50                   	push   %eax
+  8015f2:	ff 36                	push   (%esi)
+  8015f4:	e8 59 ff ff ff       	call   801552 <dev_lookup>
+  8015f9:	89 c3                	mov    %eax,%ebx
+  8015fb:	83 c4 10             	add    $0x10,%esp
+  8015fe:	85 c0                	test   %eax,%eax
+  801600:	78 1a                	js     80161c <fd_close+0x77>
+		if (dev->dev_close)
+  801602:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801605:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801608:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80160d:	85 c0                	test   %eax,%eax
+  80160f:	74 0b                	je     80161c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801611:	83 ec 0c             	sub    $0xc,%esp
+  801614:	56                   	push   %esi
+  801615:	ff d0                	call   *%eax
+  801617:	89 c3                	mov    %eax,%ebx
+  801619:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80161c:	83 ec 08             	sub    $0x8,%esp
+  80161f:	56                   	push   %esi
+  801620:	6a 00                	push   $0x0
+  801622:	e8 d5 f7 ff ff       	call   800dfc <sys_page_unmap>
+	return r;
+  801627:	83 c4 10             	add    $0x10,%esp
+  80162a:	eb b5                	jmp    8015e1 <fd_close+0x3c>
+
+0080162c <close>:
+
+int
+close(int fdnum)
+{
+  80162c:	55                   	push   %ebp
+  80162d:	89 e5                	mov    %esp,%ebp
+  80162f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801632:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801635:	50                   	push   %eax
+  801636:	ff 75 08             	push   0x8(%ebp)
+  801639:	e8 c4 fe ff ff       	call   801502 <fd_lookup>
+  80163e:	83 c4 10             	add    $0x10,%esp
+  801641:	85 c0                	test   %eax,%eax
+  801643:	79 02                	jns    801647 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801645:	c9                   	leave
+  801646:	c3                   	ret
+		return fd_close(fd, 1);
+  801647:	83 ec 08             	sub    $0x8,%esp
+  80164a:	6a 01                	push   $0x1
+  80164c:	ff 75 f4             	push   -0xc(%ebp)
+  80164f:	e8 51 ff ff ff       	call   8015a5 <fd_close>
+  801654:	83 c4 10             	add    $0x10,%esp
+  801657:	eb ec                	jmp    801645 <close+0x19>
+
+00801659 <close_all>:
+
+void
+close_all(void)
+{
+  801659:	55                   	push   %ebp
+  80165a:	89 e5                	mov    %esp,%ebp
+  80165c:	53                   	push   %ebx
+  80165d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801660:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801665:	83 ec 0c             	sub    $0xc,%esp
+  801668:	53                   	push   %ebx
+  801669:	e8 be ff ff ff       	call   80162c <close>
+	for (i = 0; i < MAXFD; i++)
+  80166e:	83 c3 01             	add    $0x1,%ebx
+  801671:	83 c4 10             	add    $0x10,%esp
+  801674:	83 fb 20             	cmp    $0x20,%ebx
+  801677:	75 ec                	jne    801665 <close_all+0xc>
+}
+  801679:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80167c:	c9                   	leave
+  80167d:	c3                   	ret
+
+0080167e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80167e:	55                   	push   %ebp
+  80167f:	89 e5                	mov    %esp,%ebp
+  801681:	57                   	push   %edi
+  801682:	56                   	push   %esi
+  801683:	53                   	push   %ebx
+  801684:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801687:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80168a:	50                   	push   %eax
+  80168b:	ff 75 08             	push   0x8(%ebp)
+  80168e:	e8 6f fe ff ff       	call   801502 <fd_lookup>
+  801693:	89 c3                	mov    %eax,%ebx
+  801695:	83 c4 10             	add    $0x10,%esp
+  801698:	85 c0                	test   %eax,%eax
+  80169a:	78 7f                	js     80171b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80169c:	83 ec 0c             	sub    $0xc,%esp
+  80169f:	ff 75 0c             	push   0xc(%ebp)
+  8016a2:	e8 85 ff ff ff       	call   80162c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8016a7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8016aa:	c1 e6 0c             	shl    $0xc,%esi
+  8016ad:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8016b3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8016b6:	89 3c 24             	mov    %edi,(%esp)
+  8016b9:	e8 d7 fd ff ff       	call   801495 <fd2data>
+  8016be:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8016c0:	89 34 24             	mov    %esi,(%esp)
+  8016c3:	e8 cd fd ff ff       	call   801495 <fd2data>
+  8016c8:	83 c4 10             	add    $0x10,%esp
+  8016cb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8016ce:	89 d8                	mov    %ebx,%eax
+  8016d0:	c1 e8 16             	shr    $0x16,%eax
+  8016d3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8016da:	a8 01                	test   $0x1,%al
+  8016dc:	74 11                	je     8016ef <dup+0x71>
+  8016de:	89 d8                	mov    %ebx,%eax
+  8016e0:	c1 e8 0c             	shr    $0xc,%eax
+  8016e3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016ea:	f6 c2 01             	test   $0x1,%dl
+  8016ed:	75 36                	jne    801725 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8016ef:	89 f8                	mov    %edi,%eax
+  8016f1:	c1 e8 0c             	shr    $0xc,%eax
+  8016f4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016fb:	83 ec 0c             	sub    $0xc,%esp
+  8016fe:	25 07 0e 00 00       	and    $0xe07,%eax
+  801703:	50                   	push   %eax
+  801704:	56                   	push   %esi
+  801705:	6a 00                	push   $0x0
+  801707:	57                   	push   %edi
+  801708:	6a 00                	push   $0x0
+  80170a:	e8 ab f6 ff ff       	call   800dba <sys_page_map>
+  80170f:	89 c3                	mov    %eax,%ebx
+  801711:	83 c4 20             	add    $0x20,%esp
+  801714:	85 c0                	test   %eax,%eax
+  801716:	78 33                	js     80174b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801718:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80171b:	89 d8                	mov    %ebx,%eax
+  80171d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801720:	5b                   	pop    %ebx
+  801721:	5e                   	pop    %esi
+  801722:	5f                   	pop    %edi
+  801723:	5d                   	pop    %ebp
+  801724:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801725:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80172c:	83 ec 0c             	sub    $0xc,%esp
+  80172f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801734:	50                   	push   %eax
+  801735:	ff 75 d4             	push   -0x2c(%ebp)
+  801738:	6a 00                	push   $0x0
+  80173a:	53                   	push   %ebx
+  80173b:	6a 00                	push   $0x0
+  80173d:	e8 78 f6 ff ff       	call   800dba <sys_page_map>
+  801742:	89 c3                	mov    %eax,%ebx
+  801744:	83 c4 20             	add    $0x20,%esp
+  801747:	85 c0                	test   %eax,%eax
+  801749:	79 a4                	jns    8016ef <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80174b:	83 ec 08             	sub    $0x8,%esp
+  80174e:	56                   	push   %esi
+  80174f:	6a 00                	push   $0x0
+  801751:	e8 a6 f6 ff ff       	call   800dfc <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801756:	83 c4 08             	add    $0x8,%esp
+  801759:	ff 75 d4             	push   -0x2c(%ebp)
+  80175c:	6a 00                	push   $0x0
+  80175e:	e8 99 f6 ff ff       	call   800dfc <sys_page_unmap>
+	return r;
+  801763:	83 c4 10             	add    $0x10,%esp
+  801766:	eb b3                	jmp    80171b <dup+0x9d>
+
+00801768 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801768:	55                   	push   %ebp
+  801769:	89 e5                	mov    %esp,%ebp
+  80176b:	56                   	push   %esi
+  80176c:	53                   	push   %ebx
+  80176d:	83 ec 18             	sub    $0x18,%esp
+  801770:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801773:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801776:	50                   	push   %eax
+  801777:	56                   	push   %esi
+  801778:	e8 85 fd ff ff       	call   801502 <fd_lookup>
+  80177d:	83 c4 10             	add    $0x10,%esp
+  801780:	85 c0                	test   %eax,%eax
+  801782:	78 3c                	js     8017c0 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801784:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801787:	83 ec 08             	sub    $0x8,%esp
+  80178a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80178d:	50                   	push   %eax
+  80178e:	ff 33                	push   (%ebx)
+  801790:	e8 bd fd ff ff       	call   801552 <dev_lookup>
+  801795:	83 c4 10             	add    $0x10,%esp
+  801798:	85 c0                	test   %eax,%eax
+  80179a:	78 24                	js     8017c0 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80179c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80179f:	83 e0 03             	and    $0x3,%eax
+  8017a2:	83 f8 01             	cmp    $0x1,%eax
+  8017a5:	74 20                	je     8017c7 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8017a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017aa:	8b 40 08             	mov    0x8(%eax),%eax
+  8017ad:	85 c0                	test   %eax,%eax
+  8017af:	74 37                	je     8017e8 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8017b1:	83 ec 04             	sub    $0x4,%esp
+  8017b4:	ff 75 10             	push   0x10(%ebp)
+  8017b7:	ff 75 0c             	push   0xc(%ebp)
+  8017ba:	53                   	push   %ebx
+  8017bb:	ff d0                	call   *%eax
+  8017bd:	83 c4 10             	add    $0x10,%esp
+}
+  8017c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017c3:	5b                   	pop    %ebx
+  8017c4:	5e                   	pop    %esi
+  8017c5:	5d                   	pop    %ebp
+  8017c6:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017c7:	a1 00 60 80 00       	mov    0x806000,%eax
+  8017cc:	8b 40 48             	mov    0x48(%eax),%eax
+  8017cf:	83 ec 04             	sub    $0x4,%esp
+  8017d2:	56                   	push   %esi
+  8017d3:	50                   	push   %eax
+  8017d4:	68 65 3e 80 00       	push   $0x803e65
+  8017d9:	e8 97 eb ff ff       	call   800375 <cprintf>
+		return -E_INVAL;
+  8017de:	83 c4 10             	add    $0x10,%esp
+  8017e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e6:	eb d8                	jmp    8017c0 <read+0x58>
+		return -E_NOT_SUPP;
+  8017e8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017ed:	eb d1                	jmp    8017c0 <read+0x58>
+
+008017ef <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8017ef:	55                   	push   %ebp
+  8017f0:	89 e5                	mov    %esp,%ebp
+  8017f2:	57                   	push   %edi
+  8017f3:	56                   	push   %esi
+  8017f4:	53                   	push   %ebx
+  8017f5:	83 ec 0c             	sub    $0xc,%esp
+  8017f8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8017fb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8017fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801803:	eb 02                	jmp    801807 <readn+0x18>
+  801805:	01 c3                	add    %eax,%ebx
+  801807:	39 f3                	cmp    %esi,%ebx
+  801809:	73 21                	jae    80182c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80180b:	83 ec 04             	sub    $0x4,%esp
+  80180e:	89 f0                	mov    %esi,%eax
+  801810:	29 d8                	sub    %ebx,%eax
+  801812:	50                   	push   %eax
+  801813:	89 d8                	mov    %ebx,%eax
+  801815:	03 45 0c             	add    0xc(%ebp),%eax
+  801818:	50                   	push   %eax
+  801819:	57                   	push   %edi
+  80181a:	e8 49 ff ff ff       	call   801768 <read>
+		if (m < 0)
+  80181f:	83 c4 10             	add    $0x10,%esp
+  801822:	85 c0                	test   %eax,%eax
+  801824:	78 04                	js     80182a <readn+0x3b>
+			return m;
+		if (m == 0)
+  801826:	75 dd                	jne    801805 <readn+0x16>
+  801828:	eb 02                	jmp    80182c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80182a:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80182c:	89 d8                	mov    %ebx,%eax
+  80182e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801831:	5b                   	pop    %ebx
+  801832:	5e                   	pop    %esi
+  801833:	5f                   	pop    %edi
+  801834:	5d                   	pop    %ebp
+  801835:	c3                   	ret
+
+00801836 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801836:	55                   	push   %ebp
+  801837:	89 e5                	mov    %esp,%ebp
+  801839:	56                   	push   %esi
+  80183a:	53                   	push   %ebx
+  80183b:	83 ec 18             	sub    $0x18,%esp
+  80183e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801841:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801844:	50                   	push   %eax
+  801845:	53                   	push   %ebx
+  801846:	e8 b7 fc ff ff       	call   801502 <fd_lookup>
+  80184b:	83 c4 10             	add    $0x10,%esp
+  80184e:	85 c0                	test   %eax,%eax
+  801850:	78 37                	js     801889 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801852:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801855:	83 ec 08             	sub    $0x8,%esp
+  801858:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80185b:	50                   	push   %eax
+  80185c:	ff 36                	push   (%esi)
+  80185e:	e8 ef fc ff ff       	call   801552 <dev_lookup>
+  801863:	83 c4 10             	add    $0x10,%esp
+  801866:	85 c0                	test   %eax,%eax
+  801868:	78 1f                	js     801889 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80186a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80186e:	74 20                	je     801890 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801870:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801873:	8b 40 0c             	mov    0xc(%eax),%eax
+  801876:	85 c0                	test   %eax,%eax
+  801878:	74 37                	je     8018b1 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80187a:	83 ec 04             	sub    $0x4,%esp
+  80187d:	ff 75 10             	push   0x10(%ebp)
+  801880:	ff 75 0c             	push   0xc(%ebp)
+  801883:	56                   	push   %esi
+  801884:	ff d0                	call   *%eax
+  801886:	83 c4 10             	add    $0x10,%esp
+}
+  801889:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80188c:	5b                   	pop    %ebx
+  80188d:	5e                   	pop    %esi
+  80188e:	5d                   	pop    %ebp
+  80188f:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801890:	a1 00 60 80 00       	mov    0x806000,%eax
+  801895:	8b 40 48             	mov    0x48(%eax),%eax
+  801898:	83 ec 04             	sub    $0x4,%esp
+  80189b:	53                   	push   %ebx
+  80189c:	50                   	push   %eax
+  80189d:	68 81 3e 80 00       	push   $0x803e81
+  8018a2:	e8 ce ea ff ff       	call   800375 <cprintf>
+		return -E_INVAL;
+  8018a7:	83 c4 10             	add    $0x10,%esp
+  8018aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018af:	eb d8                	jmp    801889 <write+0x53>
+		return -E_NOT_SUPP;
+  8018b1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018b6:	eb d1                	jmp    801889 <write+0x53>
+
+008018b8 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8018b8:	55                   	push   %ebp
+  8018b9:	89 e5                	mov    %esp,%ebp
+  8018bb:	53                   	push   %ebx
+  8018bc:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018bf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018c2:	50                   	push   %eax
+  8018c3:	ff 75 08             	push   0x8(%ebp)
+  8018c6:	e8 37 fc ff ff       	call   801502 <fd_lookup>
+  8018cb:	83 c4 10             	add    $0x10,%esp
+  8018ce:	85 c0                	test   %eax,%eax
+  8018d0:	78 3a                	js     80190c <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018d2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8018d5:	83 ec 08             	sub    $0x8,%esp
+  8018d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018db:	50                   	push   %eax
+  8018dc:	ff 33                	push   (%ebx)
+  8018de:	e8 6f fc ff ff       	call   801552 <dev_lookup>
+  8018e3:	83 c4 10             	add    $0x10,%esp
+  8018e6:	85 c0                	test   %eax,%eax
+  8018e8:	78 22                	js     80190c <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8018ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018ed:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8018f0:	85 c0                	test   %eax,%eax
+  8018f2:	74 0d                	je     801901 <seek+0x49>
+  8018f4:	83 ec 0c             	sub    $0xc,%esp
+  8018f7:	53                   	push   %ebx
+  8018f8:	ff d0                	call   *%eax
+  8018fa:	83 c4 10             	add    $0x10,%esp
+  8018fd:	85 c0                	test   %eax,%eax
+  8018ff:	78 0b                	js     80190c <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801901:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801904:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801907:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80190c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80190f:	c9                   	leave
+  801910:	c3                   	ret
+
+00801911 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801911:	55                   	push   %ebp
+  801912:	89 e5                	mov    %esp,%ebp
+  801914:	53                   	push   %ebx
+  801915:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801918:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80191b:	50                   	push   %eax
+  80191c:	ff 75 08             	push   0x8(%ebp)
+  80191f:	e8 de fb ff ff       	call   801502 <fd_lookup>
+  801924:	83 c4 10             	add    $0x10,%esp
+  801927:	85 c0                	test   %eax,%eax
+  801929:	78 2b                	js     801956 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80192b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80192e:	83 ec 08             	sub    $0x8,%esp
+  801931:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801934:	50                   	push   %eax
+  801935:	ff 33                	push   (%ebx)
+  801937:	e8 16 fc ff ff       	call   801552 <dev_lookup>
+  80193c:	83 c4 10             	add    $0x10,%esp
+  80193f:	85 c0                	test   %eax,%eax
+  801941:	78 13                	js     801956 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801943:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801946:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801949:	85 c0                	test   %eax,%eax
+  80194b:	74 0e                	je     80195b <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  80194d:	83 ec 0c             	sub    $0xc,%esp
+  801950:	53                   	push   %ebx
+  801951:	ff d0                	call   *%eax
+  801953:	83 c4 10             	add    $0x10,%esp
+}
+  801956:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801959:	c9                   	leave
+  80195a:	c3                   	ret
+		return 0;
+  80195b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801960:	eb f4                	jmp    801956 <fsync+0x45>
+
+00801962 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801962:	55                   	push   %ebp
+  801963:	89 e5                	mov    %esp,%ebp
+  801965:	56                   	push   %esi
+  801966:	53                   	push   %ebx
+  801967:	83 ec 18             	sub    $0x18,%esp
+  80196a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80196d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801970:	50                   	push   %eax
+  801971:	53                   	push   %ebx
+  801972:	e8 8b fb ff ff       	call   801502 <fd_lookup>
+  801977:	83 c4 10             	add    $0x10,%esp
+  80197a:	85 c0                	test   %eax,%eax
+  80197c:	78 34                	js     8019b2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80197e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801981:	83 ec 08             	sub    $0x8,%esp
+  801984:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801987:	50                   	push   %eax
+  801988:	ff 36                	push   (%esi)
+  80198a:	e8 c3 fb ff ff       	call   801552 <dev_lookup>
+  80198f:	83 c4 10             	add    $0x10,%esp
+  801992:	85 c0                	test   %eax,%eax
+  801994:	78 1c                	js     8019b2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801996:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80199a:	74 1d                	je     8019b9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80199c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80199f:	8b 40 18             	mov    0x18(%eax),%eax
+  8019a2:	85 c0                	test   %eax,%eax
+  8019a4:	74 34                	je     8019da <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8019a6:	83 ec 08             	sub    $0x8,%esp
+  8019a9:	ff 75 0c             	push   0xc(%ebp)
+  8019ac:	56                   	push   %esi
+  8019ad:	ff d0                	call   *%eax
+  8019af:	83 c4 10             	add    $0x10,%esp
+}
+  8019b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019b5:	5b                   	pop    %ebx
+  8019b6:	5e                   	pop    %esi
+  8019b7:	5d                   	pop    %ebp
+  8019b8:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8019b9:	a1 00 60 80 00       	mov    0x806000,%eax
+  8019be:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8019c1:	83 ec 04             	sub    $0x4,%esp
+  8019c4:	53                   	push   %ebx
+  8019c5:	50                   	push   %eax
+  8019c6:	68 44 3e 80 00       	push   $0x803e44
+  8019cb:	e8 a5 e9 ff ff       	call   800375 <cprintf>
+		return -E_INVAL;
+  8019d0:	83 c4 10             	add    $0x10,%esp
+  8019d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019d8:	eb d8                	jmp    8019b2 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8019da:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019df:	eb d1                	jmp    8019b2 <ftruncate+0x50>
+
+008019e1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8019e1:	55                   	push   %ebp
+  8019e2:	89 e5                	mov    %esp,%ebp
+  8019e4:	56                   	push   %esi
+  8019e5:	53                   	push   %ebx
+  8019e6:	83 ec 18             	sub    $0x18,%esp
+  8019e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019ec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019ef:	50                   	push   %eax
+  8019f0:	ff 75 08             	push   0x8(%ebp)
+  8019f3:	e8 0a fb ff ff       	call   801502 <fd_lookup>
+  8019f8:	83 c4 10             	add    $0x10,%esp
+  8019fb:	85 c0                	test   %eax,%eax
+  8019fd:	78 49                	js     801a48 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019ff:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a02:	83 ec 08             	sub    $0x8,%esp
+  801a05:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a08:	50                   	push   %eax
+  801a09:	ff 36                	push   (%esi)
+  801a0b:	e8 42 fb ff ff       	call   801552 <dev_lookup>
+  801a10:	83 c4 10             	add    $0x10,%esp
+  801a13:	85 c0                	test   %eax,%eax
+  801a15:	78 31                	js     801a48 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801a17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a1a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a1e:	74 2f                	je     801a4f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a20:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a23:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a2a:	00 00 00 
+	stat->st_isdir = 0;
+  801a2d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a34:	00 00 00 
+	stat->st_dev = dev;
+  801a37:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a3d:	83 ec 08             	sub    $0x8,%esp
+  801a40:	53                   	push   %ebx
+  801a41:	56                   	push   %esi
+  801a42:	ff 50 14             	call   *0x14(%eax)
+  801a45:	83 c4 10             	add    $0x10,%esp
+}
+  801a48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a4b:	5b                   	pop    %ebx
+  801a4c:	5e                   	pop    %esi
+  801a4d:	5d                   	pop    %ebp
+  801a4e:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a4f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a54:	eb f2                	jmp    801a48 <fstat+0x67>
+
+00801a56 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a56:	55                   	push   %ebp
+  801a57:	89 e5                	mov    %esp,%ebp
+  801a59:	56                   	push   %esi
+  801a5a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801a5b:	83 ec 08             	sub    $0x8,%esp
+  801a5e:	68 00 10 00 00       	push   $0x1000
+  801a63:	ff 75 08             	push   0x8(%ebp)
+  801a66:	e8 b3 07 00 00       	call   80221e <open>
+  801a6b:	89 c3                	mov    %eax,%ebx
+  801a6d:	83 c4 10             	add    $0x10,%esp
+  801a70:	85 c0                	test   %eax,%eax
+  801a72:	78 1b                	js     801a8f <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801a74:	83 ec 08             	sub    $0x8,%esp
+  801a77:	ff 75 0c             	push   0xc(%ebp)
+  801a7a:	50                   	push   %eax
+  801a7b:	e8 61 ff ff ff       	call   8019e1 <fstat>
+  801a80:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a82:	89 1c 24             	mov    %ebx,(%esp)
+  801a85:	e8 a2 fb ff ff       	call   80162c <close>
+	return r;
+  801a8a:	83 c4 10             	add    $0x10,%esp
+  801a8d:	89 f3                	mov    %esi,%ebx
+}
+  801a8f:	89 d8                	mov    %ebx,%eax
+  801a91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a94:	5b                   	pop    %ebx
+  801a95:	5e                   	pop    %esi
+  801a96:	5d                   	pop    %ebp
+  801a97:	c3                   	ret
+
+00801a98 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801a98:	55                   	push   %ebp
+  801a99:	89 e5                	mov    %esp,%ebp
+  801a9b:	57                   	push   %edi
+  801a9c:	56                   	push   %esi
+  801a9d:	53                   	push   %ebx
+  801a9e:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801aa4:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801aaa:	89 d6                	mov    %edx,%esi
+  801aac:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801ab2:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801ab5:	89 d3                	mov    %edx,%ebx
+  801ab7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801abd:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801ac4:	74 1d                	je     801ae3 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801ac6:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801acb:	83 c8 07             	or     $0x7,%eax
+  801ace:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801ad4:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801ad9:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801adf:	01 ce                	add    %ecx,%esi
+  801ae1:	eb 28                	jmp    801b0b <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ae3:	83 ec 0c             	sub    $0xc,%esp
+  801ae6:	6a 01                	push   $0x1
+  801ae8:	e8 90 1b 00 00       	call   80367d <ipc_find_env>
+  801aed:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801af2:	83 c4 10             	add    $0x10,%esp
+  801af5:	eb cf                	jmp    801ac6 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801af7:	83 c0 01             	add    $0x1,%eax
+  801afa:	89 fa                	mov    %edi,%edx
+  801afc:	09 da                	or     %ebx,%edx
+  801afe:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801b05:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b0b:	39 f3                	cmp    %esi,%ebx
+  801b0d:	72 e8                	jb     801af7 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801b0f:	83 f8 41             	cmp    $0x41,%eax
+  801b12:	77 2f                	ja     801b43 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801b14:	50                   	push   %eax
+  801b15:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801b1b:	50                   	push   %eax
+  801b1c:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801b22:	ff 35 c8 80 80 00    	push   0x8080c8
+  801b28:	e8 02 1b 00 00       	call   80362f <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801b2d:	83 c4 0c             	add    $0xc,%esp
+  801b30:	6a 00                	push   $0x0
+  801b32:	6a 00                	push   $0x0
+  801b34:	6a 00                	push   $0x0
+  801b36:	e8 9e 19 00 00       	call   8034d9 <ipc_recv>
+}
+  801b3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b3e:	5b                   	pop    %ebx
+  801b3f:	5e                   	pop    %esi
+  801b40:	5f                   	pop    %edi
+  801b41:	5d                   	pop    %ebp
+  801b42:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801b43:	68 b4 3e 80 00       	push   $0x803eb4
+  801b48:	68 ec 3d 80 00       	push   $0x803dec
+  801b4d:	6a 40                	push   $0x40
+  801b4f:	68 d0 3e 80 00       	push   $0x803ed0
+  801b54:	e8 41 e7 ff ff       	call   80029a <_panic>
+
+00801b59 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801b59:	55                   	push   %ebp
+  801b5a:	89 e5                	mov    %esp,%ebp
+  801b5c:	57                   	push   %edi
+  801b5d:	56                   	push   %esi
+  801b5e:	53                   	push   %ebx
+  801b5f:	83 ec 1c             	sub    $0x1c,%esp
+  801b62:	89 c3                	mov    %eax,%ebx
+  801b64:	89 d6                	mov    %edx,%esi
+  801b66:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801b69:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801b6f:	89 ca                	mov    %ecx,%edx
+  801b71:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801b74:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801b7b:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801b7e:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801b85:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b88:	89 fb                	mov    %edi,%ebx
+  801b8a:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801b91:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b94:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801b9b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b9e:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801ba5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ba8:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801baf:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801bb2:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801bb9:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801bbe:	39 c8                	cmp    %ecx,%eax
+  801bc0:	74 0d                	je     801bcf <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801bc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bca:	5b                   	pop    %ebx
+  801bcb:	5e                   	pop    %esi
+  801bcc:	5f                   	pop    %edi
+  801bcd:	5d                   	pop    %ebp
+  801bce:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801bcf:	6a 07                	push   $0x7
+  801bd1:	68 00 70 80 00       	push   $0x807000
+  801bd6:	6a 0d                	push   $0xd
+  801bd8:	ff 35 c8 80 80 00    	push   0x8080c8
+  801bde:	e8 61 19 00 00       	call   803544 <ipc_send>
+  801be3:	83 c4 10             	add    $0x10,%esp
+  801be6:	eb da                	jmp    801bc2 <fsring_post+0x69>
+
+00801be8 <fsipcv>:
+{
+  801be8:	55                   	push   %ebp
+  801be9:	89 e5                	mov    %esp,%ebp
+  801beb:	57                   	push   %edi
+  801bec:	56                   	push   %esi
+  801bed:	53                   	push   %ebx
+  801bee:	83 ec 0c             	sub    $0xc,%esp
+  801bf1:	89 c7                	mov    %eax,%edi
+  801bf3:	89 d3                	mov    %edx,%ebx
+  801bf5:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801bf7:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801bfe:	74 26                	je     801c26 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801c00:	6a 07                	push   $0x7
+  801c02:	68 00 70 80 00       	push   $0x807000
+  801c07:	57                   	push   %edi
+  801c08:	ff 35 c8 80 80 00    	push   0x8080c8
+  801c0e:	e8 31 19 00 00       	call   803544 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801c13:	6a 00                	push   $0x0
+  801c15:	56                   	push   %esi
+  801c16:	53                   	push   %ebx
+  801c17:	6a 00                	push   $0x0
+  801c19:	e8 7e 19 00 00       	call   80359c <ipc_recvv>
+}
+  801c1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c21:	5b                   	pop    %ebx
+  801c22:	5e                   	pop    %esi
+  801c23:	5f                   	pop    %edi
+  801c24:	5d                   	pop    %ebp
+  801c25:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c26:	83 ec 0c             	sub    $0xc,%esp
+  801c29:	6a 01                	push   $0x1
+  801c2b:	e8 4d 1a 00 00       	call   80367d <ipc_find_env>
+  801c30:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801c35:	83 c4 10             	add    $0x10,%esp
+  801c38:	eb c6                	jmp    801c00 <fsipcv+0x18>
+
+00801c3a <fsipc>:
+{
+  801c3a:	55                   	push   %ebp
+  801c3b:	89 e5                	mov    %esp,%ebp
+  801c3d:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801c40:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801c47:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801c4a:	e8 99 ff ff ff       	call   801be8 <fsipcv>
+}
+  801c4f:	c9                   	leave
+  801c50:	c3                   	ret
+
+00801c51 <file_write_direct>:
+{
+  801c51:	55                   	push   %ebp
+  801c52:	89 e5                	mov    %esp,%ebp
+  801c54:	56                   	push   %esi
+  801c55:	53                   	push   %ebx
+  801c56:	89 c3                	mov    %eax,%ebx
+  801c58:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801c5a:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801c60:	77 40                	ja     801ca2 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801c62:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801c67:	39 c8                	cmp    %ecx,%eax
+  801c69:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c6c:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801c6f:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  801c75:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801c7a:	83 ec 04             	sub    $0x4,%esp
+  801c7d:	50                   	push   %eax
+  801c7e:	52                   	push   %edx
+  801c7f:	68 08 70 80 00       	push   $0x807008
+  801c84:	e8 60 ee ff ff       	call   800ae9 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801c89:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c93:	e8 a2 ff ff ff       	call   801c3a <fsipc>
+  801c98:	83 c4 10             	add    $0x10,%esp
+}
+  801c9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c9e:	5b                   	pop    %ebx
+  801c9f:	5e                   	pop    %esi
+  801ca0:	5d                   	pop    %ebp
+  801ca1:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801ca2:	89 d6                	mov    %edx,%esi
+  801ca4:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801caa:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801caf:	29 f1                	sub    %esi,%ecx
+  801cb1:	39 c1                	cmp    %eax,%ecx
+  801cb3:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801cb6:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801cb9:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801cbe:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801cc4:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801cca:	83 ec 0c             	sub    $0xc,%esp
+  801ccd:	6a 05                	push   $0x5
+  801ccf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801cd4:	e8 bf fd ff ff       	call   801a98 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801cd9:	83 c4 10             	add    $0x10,%esp
+  801cdc:	eb bd                	jmp    801c9b <file_write_direct+0x4a>
+
+00801cde <devfile_sync>:
+{
+  801cde:	55                   	push   %ebp
+  801cdf:	89 e5                	mov    %esp,%ebp
+  801ce1:	57                   	push   %edi
+  801ce2:	56                   	push   %esi
+  801ce3:	53                   	push   %ebx
+  801ce4:	83 ec 28             	sub    $0x28,%esp
+  801ce7:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801cea:	56                   	push   %esi
+  801ceb:	e8 a5 f7 ff ff       	call   801495 <fd2data>
+  801cf0:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801cf2:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801cf5:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801cfc:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801cff:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801d04:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801d08:	74 45                	je     801d4f <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801d0a:	8b 46 14             	mov    0x14(%esi),%eax
+  801d0d:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801d10:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d1a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801d1d:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801d20:	39 cb                	cmp    %ecx,%ebx
+  801d22:	73 14                	jae    801d38 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801d24:	29 d9                	sub    %ebx,%ecx
+  801d26:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801d29:	89 f0                	mov    %esi,%eax
+  801d2b:	e8 21 ff ff ff       	call   801c51 <file_write_direct>
+  801d30:	85 c0                	test   %eax,%eax
+  801d32:	7e 04                	jle    801d38 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801d34:	01 c3                	add    %eax,%ebx
+  801d36:	eb e5                	jmp    801d1d <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801d38:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d3b:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801d42:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801d45:	85 c0                	test   %eax,%eax
+  801d47:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d4c:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801d4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d52:	5b                   	pop    %ebx
+  801d53:	5e                   	pop    %esi
+  801d54:	5f                   	pop    %edi
+  801d55:	5d                   	pop    %ebp
+  801d56:	c3                   	ret
+
+00801d57 <devfile_write>:
+{
+  801d57:	55                   	push   %ebp
+  801d58:	89 e5                	mov    %esp,%ebp
+  801d5a:	57                   	push   %edi
+  801d5b:	56                   	push   %esi
+  801d5c:	53                   	push   %ebx
+  801d5d:	83 ec 28             	sub    $0x28,%esp
+  801d60:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d63:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801d66:	53                   	push   %ebx
+  801d67:	e8 29 f7 ff ff       	call   801495 <fd2data>
+  801d6c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801d6f:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801d72:	83 c4 10             	add    $0x10,%esp
+  801d75:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801d79:	74 43                	je     801dbe <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801d7b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801d82:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801d85:	85 c0                	test   %eax,%eax
+  801d87:	74 43                	je     801dcc <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801d89:	89 c2                	mov    %eax,%edx
+  801d8b:	03 53 14             	add    0x14(%ebx),%edx
+  801d8e:	39 fa                	cmp    %edi,%edx
+  801d90:	75 0b                	jne    801d9d <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801d92:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801d95:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801d9b:	76 66                	jbe    801e03 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801d9d:	83 ec 0c             	sub    $0xc,%esp
+  801da0:	53                   	push   %ebx
+  801da1:	e8 38 ff ff ff       	call   801cde <devfile_sync>
+  801da6:	83 c4 10             	add    $0x10,%esp
+  801da9:	85 c0                	test   %eax,%eax
+  801dab:	78 4e                	js     801dfb <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801dad:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801db3:	77 56                	ja     801e0b <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801db5:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801db8:	85 c0                	test   %eax,%eax
+  801dba:	75 20                	jne    801ddc <devfile_write+0x85>
+  801dbc:	eb 16                	jmp    801dd4 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801dbe:	89 f1                	mov    %esi,%ecx
+  801dc0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dc3:	89 d8                	mov    %ebx,%eax
+  801dc5:	e8 87 fe ff ff       	call   801c51 <file_write_direct>
+  801dca:	eb 2f                	jmp    801dfb <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801dcc:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801dd2:	77 37                	ja     801e0b <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801dd4:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801ddc:	83 ec 04             	sub    $0x4,%esp
+  801ddf:	56                   	push   %esi
+  801de0:	ff 75 0c             	push   0xc(%ebp)
+  801de3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801de6:	01 c1                	add    %eax,%ecx
+  801de8:	51                   	push   %ecx
+  801de9:	e8 fb ec ff ff       	call   800ae9 <memmove>
+	ff->buf_wlen += n;
+  801dee:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801df1:	01 f7                	add    %esi,%edi
+  801df3:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801df6:	89 f0                	mov    %esi,%eax
+  801df8:	83 c4 10             	add    $0x10,%esp
+}
+  801dfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dfe:	5b                   	pop    %ebx
+  801dff:	5e                   	pop    %esi
+  801e00:	5f                   	pop    %edi
+  801e01:	5d                   	pop    %ebp
+  801e02:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801e03:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e09:	76 d1                	jbe    801ddc <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801e0b:	89 f1                	mov    %esi,%ecx
+  801e0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e10:	89 d8                	mov    %ebx,%eax
+  801e12:	e8 3a fe ff ff       	call   801c51 <file_write_direct>
+  801e17:	eb e2                	jmp    801dfb <devfile_write+0xa4>
+
+00801e19 <devfile_trunc>:
+{
+  801e19:	55                   	push   %ebp
+  801e1a:	89 e5                	mov    %esp,%ebp
+  801e1c:	53                   	push   %ebx
+  801e1d:	83 ec 10             	sub    $0x10,%esp
+  801e20:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801e23:	53                   	push   %ebx
+  801e24:	e8 b5 fe ff ff       	call   801cde <devfile_sync>
+  801e29:	83 c4 10             	add    $0x10,%esp
+  801e2c:	85 c0                	test   %eax,%eax
+  801e2e:	78 1f                	js     801e4f <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e30:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801e33:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801e38:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e3b:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e40:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e45:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e4a:	e8 eb fd ff ff       	call   801c3a <fsipc>
+}
+  801e4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e52:	c9                   	leave
+  801e53:	c3                   	ret
+
+00801e54 <devfile_stat>:
+{
+  801e54:	55                   	push   %ebp
+  801e55:	89 e5                	mov    %esp,%ebp
+  801e57:	56                   	push   %esi
+  801e58:	53                   	push   %ebx
+  801e59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e5c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801e5f:	83 ec 0c             	sub    $0xc,%esp
+  801e62:	53                   	push   %ebx
+  801e63:	e8 76 fe ff ff       	call   801cde <devfile_sync>
+  801e68:	83 c4 10             	add    $0x10,%esp
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	78 47                	js     801eb6 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e6f:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801e72:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e77:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e7c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e81:	e8 b4 fd ff ff       	call   801c3a <fsipc>
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	78 2c                	js     801eb6 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e8a:	83 ec 08             	sub    $0x8,%esp
+  801e8d:	68 00 70 80 00       	push   $0x807000
+  801e92:	56                   	push   %esi
+  801e93:	e8 cb ea ff ff       	call   800963 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e98:	a1 80 70 80 00       	mov    0x807080,%eax
+  801e9d:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ea3:	a1 84 70 80 00       	mov    0x807084,%eax
+  801ea8:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801eae:	83 c4 10             	add    $0x10,%esp
+  801eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eb6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb9:	5b                   	pop    %ebx
+  801eba:	5e                   	pop    %esi
+  801ebb:	5d                   	pop    %ebp
+  801ebc:	c3                   	ret
+
+00801ebd <devfile_flush>:
+{
+  801ebd:	55                   	push   %ebp
+  801ebe:	89 e5                	mov    %esp,%ebp
+  801ec0:	56                   	push   %esi
+  801ec1:	53                   	push   %ebx
+  801ec2:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801ec5:	83 ec 0c             	sub    $0xc,%esp
+  801ec8:	56                   	push   %esi
+  801ec9:	e8 10 fe ff ff       	call   801cde <devfile_sync>
+  801ece:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801ed0:	83 c4 10             	add    $0x10,%esp
+  801ed3:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801ed7:	75 25                	jne    801efe <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ed9:	8b 46 0c             	mov    0xc(%esi),%eax
+  801edc:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801ee1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee6:	b8 06 00 00 00       	mov    $0x6,%eax
+  801eeb:	e8 4a fd ff ff       	call   801c3a <fsipc>
+  801ef0:	85 c0                	test   %eax,%eax
+  801ef2:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801ef5:	89 d8                	mov    %ebx,%eax
+  801ef7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801efa:	5b                   	pop    %ebx
+  801efb:	5e                   	pop    %esi
+  801efc:	5d                   	pop    %ebp
+  801efd:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801efe:	83 ec 0c             	sub    $0xc,%esp
+  801f01:	56                   	push   %esi
+  801f02:	e8 8e f5 ff ff       	call   801495 <fd2data>
+  801f07:	83 c4 08             	add    $0x8,%esp
+  801f0a:	50                   	push   %eax
+  801f0b:	6a 00                	push   $0x0
+  801f0d:	e8 ea ee ff ff       	call   800dfc <sys_page_unmap>
+  801f12:	83 c4 10             	add    $0x10,%esp
+  801f15:	eb c2                	jmp    801ed9 <devfile_flush+0x1c>
+
+00801f17 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801f17:	55                   	push   %ebp
+  801f18:	89 e5                	mov    %esp,%ebp
+  801f1a:	57                   	push   %edi
+  801f1b:	56                   	push   %esi
+  801f1c:	53                   	push   %ebx
+  801f1d:	83 ec 64             	sub    $0x64,%esp
+  801f20:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801f22:	52                   	push   %edx
+  801f23:	50                   	push   %eax
+  801f24:	e8 d9 f5 ff ff       	call   801502 <fd_lookup>
+  801f29:	89 c1                	mov    %eax,%ecx
+  801f2b:	83 c4 10             	add    $0x10,%esp
+  801f2e:	85 c0                	test   %eax,%eax
+  801f30:	0f 88 f2 00 00 00    	js     802028 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801f36:	8b 07                	mov    (%edi),%eax
+  801f38:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801f3e:	39 10                	cmp    %edx,(%eax)
+  801f40:	0f 85 03 01 00 00    	jne    802049 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801f46:	a1 00 60 80 00       	mov    0x806000,%eax
+  801f4b:	8b 40 48             	mov    0x48(%eax),%eax
+  801f4e:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  801f54:	0f 84 96 00 00 00    	je     801ff0 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801f5a:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801f61:	0f 84 cb 00 00 00    	je     802032 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801f67:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801f6c:	83 c8 07             	or     $0x7,%eax
+  801f6f:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801f72:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801f75:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801f7a:	83 ec 04             	sub    $0x4,%esp
+  801f7d:	68 07 04 00 00       	push   $0x407
+  801f82:	53                   	push   %ebx
+  801f83:	6a 00                	push   $0x0
+  801f85:	e8 e5 ed ff ff       	call   800d6f <sys_page_alloc>
+  801f8a:	89 c1                	mov    %eax,%ecx
+  801f8c:	83 c4 10             	add    $0x10,%esp
+  801f8f:	85 c0                	test   %eax,%eax
+  801f91:	0f 88 91 00 00 00    	js     802028 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801f97:	89 d8                	mov    %ebx,%eax
+  801f99:	83 c8 07             	or     $0x7,%eax
+  801f9c:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801f9e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801fa4:	83 c6 04             	add    $0x4,%esi
+  801fa7:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801fad:	75 cb                	jne    801f7a <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801faf:	6a 12                	push   $0x12
+  801fb1:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801fb4:	50                   	push   %eax
+  801fb5:	6a 0c                	push   $0xc
+  801fb7:	ff 35 c8 80 80 00    	push   0x8080c8
+  801fbd:	e8 6d 16 00 00       	call   80362f <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801fc2:	83 c4 0c             	add    $0xc,%esp
+  801fc5:	6a 00                	push   $0x0
+  801fc7:	6a 00                	push   $0x0
+  801fc9:	6a 00                	push   $0x0
+  801fcb:	e8 09 15 00 00       	call   8034d9 <ipc_recv>
+  801fd0:	89 c1                	mov    %eax,%ecx
+  801fd2:	83 c4 10             	add    $0x10,%esp
+  801fd5:	85 c0                	test   %eax,%eax
+  801fd7:	78 4f                	js     802028 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801fd9:	a1 00 60 80 00       	mov    0x806000,%eax
+  801fde:	8b 40 48             	mov    0x48(%eax),%eax
+  801fe1:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  801fe6:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  801fed:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801ff0:	83 ec 0c             	sub    $0xc,%esp
+  801ff3:	ff 37                	push   (%edi)
+  801ff5:	e8 e4 fc ff ff       	call   801cde <devfile_sync>
+  801ffa:	89 c1                	mov    %eax,%ecx
+  801ffc:	83 c4 10             	add    $0x10,%esp
+  801fff:	85 c0                	test   %eax,%eax
+  802001:	78 25                	js     802028 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  802003:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802009:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  80200e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802013:	89 d0                	mov    %edx,%eax
+  802015:	d3 e0                	shl    %cl,%eax
+  802017:	85 d8                	test   %ebx,%eax
+  802019:	74 0d                	je     802028 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  80201b:	83 c1 01             	add    $0x1,%ecx
+  80201e:	83 f9 10             	cmp    $0x10,%ecx
+  802021:	75 f0                	jne    802013 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  802023:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  802028:	89 c8                	mov    %ecx,%eax
+  80202a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80202d:	5b                   	pop    %ebx
+  80202e:	5e                   	pop    %esi
+  80202f:	5f                   	pop    %edi
+  802030:	5d                   	pop    %ebp
+  802031:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802032:	83 ec 0c             	sub    $0xc,%esp
+  802035:	6a 01                	push   $0x1
+  802037:	e8 41 16 00 00       	call   80367d <ipc_find_env>
+  80203c:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  802041:	83 c4 10             	add    $0x10,%esp
+  802044:	e9 1e ff ff ff       	jmp    801f67 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  802049:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  80204e:	eb d8                	jmp    802028 <fsring_slot+0x111>
+
+00802050 <file_read_direct>:
+{
+  802050:	55                   	push   %ebp
+  802051:	89 e5                	mov    %esp,%ebp
+  802053:	57                   	push   %edi
+  802054:	56                   	push   %esi
+  802055:	53                   	push   %ebx
+  802056:	83 ec 1c             	sub    $0x1c,%esp
+  802059:	89 c7                	mov    %eax,%edi
+  80205b:	89 d6                	mov    %edx,%esi
+  80205d:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  80205f:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  802065:	77 52                	ja     8020b9 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802067:	8b 40 0c             	mov    0xc(%eax),%eax
+  80206a:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  80206f:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802075:	ba 00 00 00 00       	mov    $0x0,%edx
+  80207a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80207f:	e8 b6 fb ff ff       	call   801c3a <fsipc>
+  802084:	89 c7                	mov    %eax,%edi
+  802086:	85 c0                	test   %eax,%eax
+  802088:	78 25                	js     8020af <file_read_direct+0x5f>
+	assert(r <= n);
+  80208a:	39 c3                	cmp    %eax,%ebx
+  80208c:	0f 82 87 00 00 00    	jb     802119 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  802092:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802097:	0f 8f 95 00 00 00    	jg     802132 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80209d:	83 ec 04             	sub    $0x4,%esp
+  8020a0:	50                   	push   %eax
+  8020a1:	68 00 70 80 00       	push   $0x807000
+  8020a6:	56                   	push   %esi
+  8020a7:	e8 3d ea ff ff       	call   800ae9 <memmove>
+	return r;
+  8020ac:	83 c4 10             	add    $0x10,%esp
+}
+  8020af:	89 f8                	mov    %edi,%eax
+  8020b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020b4:	5b                   	pop    %ebx
+  8020b5:	5e                   	pop    %esi
+  8020b6:	5f                   	pop    %edi
+  8020b7:	5d                   	pop    %ebp
+  8020b8:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8020b9:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8020bf:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8020c4:	29 d1                	sub    %edx,%ecx
+  8020c6:	39 d9                	cmp    %ebx,%ecx
+  8020c8:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8020cb:	89 f0                	mov    %esi,%eax
+  8020cd:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8020d0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8020d3:	eb 0f                	jmp    8020e4 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8020d5:	0f b6 10             	movzbl (%eax),%edx
+  8020d8:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8020da:	05 00 10 00 00       	add    $0x1000,%eax
+  8020df:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8020e4:	39 c8                	cmp    %ecx,%eax
+  8020e6:	72 ed                	jb     8020d5 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  8020e8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8020eb:	8b 47 0c             	mov    0xc(%edi),%eax
+  8020ee:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  8020f3:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8020f9:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  8020ff:	83 ec 0c             	sub    $0xc,%esp
+  802102:	6a 07                	push   $0x7
+  802104:	89 d9                	mov    %ebx,%ecx
+  802106:	89 f2                	mov    %esi,%edx
+  802108:	b8 09 00 00 00       	mov    $0x9,%eax
+  80210d:	e8 86 f9 ff ff       	call   801a98 <fsipc_pages>
+  802112:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  802114:	83 c4 10             	add    $0x10,%esp
+  802117:	eb 96                	jmp    8020af <file_read_direct+0x5f>
+	assert(r <= n);
+  802119:	68 db 3e 80 00       	push   $0x803edb
+  80211e:	68 ec 3d 80 00       	push   $0x803dec
+  802123:	68 dc 00 00 00       	push   $0xdc
+  802128:	68 d0 3e 80 00       	push   $0x803ed0
+  80212d:	e8 68 e1 ff ff       	call   80029a <_panic>
+	assert(r <= PGSIZE);
+  802132:	68 ec 3e 80 00       	push   $0x803eec
+  802137:	68 ec 3d 80 00       	push   $0x803dec
+  80213c:	68 dd 00 00 00       	push   $0xdd
+  802141:	68 d0 3e 80 00       	push   $0x803ed0
+  802146:	e8 4f e1 ff ff       	call   80029a <_panic>
+
+0080214b <devfile_read>:
+{
+  80214b:	55                   	push   %ebp
+  80214c:	89 e5                	mov    %esp,%ebp
+  80214e:	57                   	push   %edi
+  80214f:	56                   	push   %esi
+  802150:	53                   	push   %ebx
+  802151:	83 ec 28             	sub    $0x28,%esp
+  802154:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802157:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80215a:	53                   	push   %ebx
+  80215b:	e8 35 f3 ff ff       	call   801495 <fd2data>
+  802160:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  802163:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  802166:	83 c4 10             	add    $0x10,%esp
+  802169:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  80216d:	74 7d                	je     8021ec <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80216f:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802173:	0f 85 81 00 00 00    	jne    8021fa <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  802179:	8b 43 18             	mov    0x18(%ebx),%eax
+  80217c:	85 c0                	test   %eax,%eax
+  80217e:	74 0d                	je     80218d <devfile_read+0x42>
+  802180:	8b 53 14             	mov    0x14(%ebx),%edx
+  802183:	39 fa                	cmp    %edi,%edx
+  802185:	7f 06                	jg     80218d <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  802187:	01 c2                	add    %eax,%edx
+  802189:	39 d7                	cmp    %edx,%edi
+  80218b:	72 28                	jb     8021b5 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  80218d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  802194:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80219a:	77 74                	ja     802210 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  80219c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021a1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8021a4:	89 d8                	mov    %ebx,%eax
+  8021a6:	e8 a5 fe ff ff       	call   802050 <file_read_direct>
+  8021ab:	85 c0                	test   %eax,%eax
+  8021ad:	7e 35                	jle    8021e4 <devfile_read+0x99>
+		ff->buf_base = pos;
+  8021af:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8021b2:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8021b5:	8b 53 14             	mov    0x14(%ebx),%edx
+  8021b8:	89 d0                	mov    %edx,%eax
+  8021ba:	03 43 18             	add    0x18(%ebx),%eax
+  8021bd:	29 f8                	sub    %edi,%eax
+  8021bf:	39 f0                	cmp    %esi,%eax
+  8021c1:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8021c4:	83 ec 04             	sub    $0x4,%esp
+  8021c7:	56                   	push   %esi
+  8021c8:	89 f8                	mov    %edi,%eax
+  8021ca:	29 d0                	sub    %edx,%eax
+  8021cc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8021cf:	01 c1                	add    %eax,%ecx
+  8021d1:	51                   	push   %ecx
+  8021d2:	ff 75 0c             	push   0xc(%ebp)
+  8021d5:	e8 0f e9 ff ff       	call   800ae9 <memmove>
+	fd->fd_offset = pos + n;
+  8021da:	01 f7                	add    %esi,%edi
+  8021dc:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8021df:	89 f0                	mov    %esi,%eax
+  8021e1:	83 c4 10             	add    $0x10,%esp
+}
+  8021e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021e7:	5b                   	pop    %ebx
+  8021e8:	5e                   	pop    %esi
+  8021e9:	5f                   	pop    %edi
+  8021ea:	5d                   	pop    %ebp
+  8021eb:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  8021ec:	89 f1                	mov    %esi,%ecx
+  8021ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021f1:	89 d8                	mov    %ebx,%eax
+  8021f3:	e8 58 fe ff ff       	call   802050 <file_read_direct>
+  8021f8:	eb ea                	jmp    8021e4 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8021fa:	83 ec 0c             	sub    $0xc,%esp
+  8021fd:	53                   	push   %ebx
+  8021fe:	e8 db fa ff ff       	call   801cde <devfile_sync>
+  802203:	83 c4 10             	add    $0x10,%esp
+  802206:	85 c0                	test   %eax,%eax
+  802208:	0f 89 6b ff ff ff    	jns    802179 <devfile_read+0x2e>
+  80220e:	eb d4                	jmp    8021e4 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  802210:	89 f1                	mov    %esi,%ecx
+  802212:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802215:	89 d8                	mov    %ebx,%eax
+  802217:	e8 34 fe ff ff       	call   802050 <file_read_direct>
+  80221c:	eb c6                	jmp    8021e4 <devfile_read+0x99>
+
+0080221e <open>:
+{
+  80221e:	55                   	push   %ebp
+  80221f:	89 e5                	mov    %esp,%ebp
+  802221:	56                   	push   %esi
+  802222:	53                   	push   %ebx
+  802223:	83 ec 1c             	sub    $0x1c,%esp
+  802226:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802229:	56                   	push   %esi
+  80222a:	e8 f9 e6 ff ff       	call   800928 <strlen>
+  80222f:	83 c4 10             	add    $0x10,%esp
+  802232:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802237:	0f 8f a0 00 00 00    	jg     8022dd <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  80223d:	83 ec 0c             	sub    $0xc,%esp
+  802240:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802243:	50                   	push   %eax
+  802244:	e8 63 f2 ff ff       	call   8014ac <fd_alloc>
+  802249:	89 c3                	mov    %eax,%ebx
+  80224b:	83 c4 10             	add    $0x10,%esp
+  80224e:	85 c0                	test   %eax,%eax
+  802250:	78 45                	js     802297 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  802252:	83 ec 08             	sub    $0x8,%esp
+  802255:	56                   	push   %esi
+  802256:	68 00 70 80 00       	push   $0x807000
+  80225b:	e8 03 e7 ff ff       	call   800963 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802260:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802263:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802268:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80226b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802270:	e8 c5 f9 ff ff       	call   801c3a <fsipc>
+  802275:	89 c3                	mov    %eax,%ebx
+  802277:	83 c4 10             	add    $0x10,%esp
+  80227a:	85 c0                	test   %eax,%eax
+  80227c:	78 22                	js     8022a0 <open+0x82>
+	if (!(mode & O_NOBUF)
+  80227e:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  802285:	74 2b                	je     8022b2 <open+0x94>
+	return fd2num(fd);
+  802287:	83 ec 0c             	sub    $0xc,%esp
+  80228a:	ff 75 f4             	push   -0xc(%ebp)
+  80228d:	e8 f3 f1 ff ff       	call   801485 <fd2num>
+  802292:	89 c3                	mov    %eax,%ebx
+  802294:	83 c4 10             	add    $0x10,%esp
+}
+  802297:	89 d8                	mov    %ebx,%eax
+  802299:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80229c:	5b                   	pop    %ebx
+  80229d:	5e                   	pop    %esi
+  80229e:	5d                   	pop    %ebp
+  80229f:	c3                   	ret
+		fd_close(fd, 0);
+  8022a0:	83 ec 08             	sub    $0x8,%esp
+  8022a3:	6a 00                	push   $0x0
+  8022a5:	ff 75 f4             	push   -0xc(%ebp)
+  8022a8:	e8 f8 f2 ff ff       	call   8015a5 <fd_close>
+		return r;
+  8022ad:	83 c4 10             	add    $0x10,%esp
+  8022b0:	eb e5                	jmp    802297 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8022b2:	83 ec 0c             	sub    $0xc,%esp
+  8022b5:	ff 75 f4             	push   -0xc(%ebp)
+  8022b8:	e8 d8 f1 ff ff       	call   801495 <fd2data>
+  8022bd:	83 c4 0c             	add    $0xc,%esp
+  8022c0:	68 07 04 00 00       	push   $0x407
+  8022c5:	50                   	push   %eax
+  8022c6:	6a 00                	push   $0x0
+  8022c8:	e8 a2 ea ff ff       	call   800d6f <sys_page_alloc>
+  8022cd:	83 c4 10             	add    $0x10,%esp
+  8022d0:	85 c0                	test   %eax,%eax
+  8022d2:	75 b3                	jne    802287 <open+0x69>
+		fd->fd_file.buffered = 1;
+  8022d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022d7:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8022db:	eb aa                	jmp    802287 <open+0x69>
+		return -E_BAD_PATH;
+  8022dd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8022e2:	eb b3                	jmp    802297 <open+0x79>
+
+008022e4 <readdir>:
+{
+  8022e4:	55                   	push   %ebp
+  8022e5:	89 e5                	mov    %esp,%ebp
+  8022e7:	53                   	push   %ebx
+  8022e8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022ee:	50                   	push   %eax
+  8022ef:	ff 75 08             	push   0x8(%ebp)
+  8022f2:	e8 0b f2 ff ff       	call   801502 <fd_lookup>
+  8022f7:	89 c3                	mov    %eax,%ebx
+  8022f9:	83 c4 10             	add    $0x10,%esp
+  8022fc:	85 c0                	test   %eax,%eax
+  8022fe:	78 73                	js     802373 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802300:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802303:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802309:	39 08                	cmp    %ecx,(%eax)
+  80230b:	0f 85 82 00 00 00    	jne    802393 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802311:	83 ec 0c             	sub    $0xc,%esp
+  802314:	50                   	push   %eax
+  802315:	e8 c4 f9 ff ff       	call   801cde <devfile_sync>
+  80231a:	89 c3                	mov    %eax,%ebx
+  80231c:	83 c4 10             	add    $0x10,%esp
+  80231f:	85 c0                	test   %eax,%eax
+  802321:	78 50                	js     802373 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802323:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802326:	8b 40 0c             	mov    0xc(%eax),%eax
+  802329:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  80232e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802331:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  802336:	8b 45 14             	mov    0x14(%ebp),%eax
+  802339:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  80233e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802343:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802348:	e8 ed f8 ff ff       	call   801c3a <fsipc>
+  80234d:	89 c3                	mov    %eax,%ebx
+  80234f:	85 c0                	test   %eax,%eax
+  802351:	7e 20                	jle    802373 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  802353:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802356:	72 22                	jb     80237a <readdir+0x96>
+  802358:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80235d:	7f 1b                	jg     80237a <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80235f:	83 ec 04             	sub    $0x4,%esp
+  802362:	50                   	push   %eax
+  802363:	68 00 70 80 00       	push   $0x807000
+  802368:	ff 75 0c             	push   0xc(%ebp)
+  80236b:	e8 79 e7 ff ff       	call   800ae9 <memmove>
+	return r;
+  802370:	83 c4 10             	add    $0x10,%esp
+}
+  802373:	89 d8                	mov    %ebx,%eax
+  802375:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802378:	c9                   	leave
+  802379:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  80237a:	68 e2 3e 80 00       	push   $0x803ee2
+  80237f:	68 ec 3d 80 00       	push   $0x803dec
+  802384:	68 86 01 00 00       	push   $0x186
+  802389:	68 d0 3e 80 00       	push   $0x803ed0
+  80238e:	e8 07 df ff ff       	call   80029a <_panic>
+		return -E_NOT_SUPP;
+  802393:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802398:	eb d9                	jmp    802373 <readdir+0x8f>
+
+0080239a <munmap>:
+{
+  80239a:	55                   	push   %ebp
+  80239b:	89 e5                	mov    %esp,%ebp
+  80239d:	56                   	push   %esi
+  80239e:	53                   	push   %ebx
+  80239f:	8b 75 08             	mov    0x8(%ebp),%esi
+  8023a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8023a5:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8023ab:	75 41                	jne    8023ee <munmap+0x54>
+  8023ad:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8023b3:	77 39                	ja     8023ee <munmap+0x54>
+  8023b5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8023ba:	29 f0                	sub    %esi,%eax
+  8023bc:	39 d0                	cmp    %edx,%eax
+  8023be:	72 35                	jb     8023f5 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8023c0:	89 f3                	mov    %esi,%ebx
+  8023c2:	01 d6                	add    %edx,%esi
+  8023c4:	39 f3                	cmp    %esi,%ebx
+  8023c6:	73 1a                	jae    8023e2 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8023c8:	83 ec 08             	sub    $0x8,%esp
+  8023cb:	53                   	push   %ebx
+  8023cc:	6a 00                	push   $0x0
+  8023ce:	e8 29 ea ff ff       	call   800dfc <sys_page_unmap>
+  8023d3:	83 c4 10             	add    $0x10,%esp
+  8023d6:	85 c0                	test   %eax,%eax
+  8023d8:	78 0d                	js     8023e7 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8023da:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8023e0:	eb e2                	jmp    8023c4 <munmap+0x2a>
+	return 0;
+  8023e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023ea:	5b                   	pop    %ebx
+  8023eb:	5e                   	pop    %esi
+  8023ec:	5d                   	pop    %ebp
+  8023ed:	c3                   	ret
+		return -E_INVAL;
+  8023ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023f3:	eb f2                	jmp    8023e7 <munmap+0x4d>
+  8023f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023fa:	eb eb                	jmp    8023e7 <munmap+0x4d>
+
+008023fc <mmap>:
+{
+  8023fc:	55                   	push   %ebp
+  8023fd:	89 e5                	mov    %esp,%ebp
+  8023ff:	57                   	push   %edi
+  802400:	56                   	push   %esi
+  802401:	53                   	push   %ebx
+  802402:	83 ec 34             	sub    $0x34,%esp
+  802405:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802408:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80240b:	50                   	push   %eax
+  80240c:	ff 75 18             	push   0x18(%ebp)
+  80240f:	e8 ee f0 ff ff       	call   801502 <fd_lookup>
+  802414:	89 c3                	mov    %eax,%ebx
+  802416:	83 c4 10             	add    $0x10,%esp
+  802419:	85 c0                	test   %eax,%eax
+  80241b:	0f 88 0e 01 00 00    	js     80252f <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802421:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802424:	a1 20 50 80 00       	mov    0x805020,%eax
+  802429:	39 02                	cmp    %eax,(%edx)
+  80242b:	0f 85 50 01 00 00    	jne    802581 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802431:	8b 45 10             	mov    0x10(%ebp),%eax
+  802434:	83 e0 02             	and    $0x2,%eax
+  802437:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80243a:	74 0a                	je     802446 <mmap+0x4a>
+  80243c:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802440:	0f 84 42 01 00 00    	je     802588 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802446:	8b 42 08             	mov    0x8(%edx),%eax
+  802449:	83 e0 03             	and    $0x3,%eax
+  80244c:	83 f8 01             	cmp    $0x1,%eax
+  80244f:	0f 84 3a 01 00 00    	je     80258f <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802455:	8b 45 08             	mov    0x8(%ebp),%eax
+  802458:	0b 45 1c             	or     0x1c(%ebp),%eax
+  80245b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802460:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802463:	0f 85 2d 01 00 00    	jne    802596 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802469:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80246d:	0f 88 2a 01 00 00    	js     80259d <mmap+0x1a1>
+  802473:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80247a:	0f 87 1d 01 00 00    	ja     80259d <mmap+0x1a1>
+  802480:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802485:	2b 45 08             	sub    0x8(%ebp),%eax
+  802488:	39 f8                	cmp    %edi,%eax
+  80248a:	0f 82 14 01 00 00    	jb     8025a4 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802490:	83 ec 0c             	sub    $0xc,%esp
+  802493:	52                   	push   %edx
+  802494:	e8 45 f8 ff ff       	call   801cde <devfile_sync>
+  802499:	89 c3                	mov    %eax,%ebx
+  80249b:	83 c4 10             	add    $0x10,%esp
+  80249e:	85 c0                	test   %eax,%eax
+  8024a0:	0f 88 89 00 00 00    	js     80252f <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8024a6:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8024ac:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8024b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b7:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8024ba:	39 fe                	cmp    %edi,%esi
+  8024bc:	73 7b                	jae    802539 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8024be:	89 f8                	mov    %edi,%eax
+  8024c0:	29 f0                	sub    %esi,%eax
+  8024c2:	c1 e8 0c             	shr    $0xc,%eax
+  8024c5:	ba 40 00 00 00       	mov    $0x40,%edx
+  8024ca:	39 d0                	cmp    %edx,%eax
+  8024cc:	0f 47 c2             	cmova  %edx,%eax
+  8024cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8024d2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024d5:	8b 52 0c             	mov    0xc(%edx),%edx
+  8024d8:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  8024de:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8024e1:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  8024e7:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8024ec:	89 f2                	mov    %esi,%edx
+  8024ee:	03 55 08             	add    0x8(%ebp),%edx
+  8024f1:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8024f4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8024f9:	e8 ea f6 ff ff       	call   801be8 <fsipcv>
+  8024fe:	85 c0                	test   %eax,%eax
+  802500:	7e 12                	jle    802514 <mmap+0x118>
+  802502:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802505:	85 c0                	test   %eax,%eax
+  802507:	0f 84 9e 00 00 00    	je     8025ab <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80250d:	c1 e0 0c             	shl    $0xc,%eax
+  802510:	01 c6                	add    %eax,%esi
+  802512:	eb a6                	jmp    8024ba <mmap+0xbe>
+			munmap(addr, done);
+  802514:	89 c3                	mov    %eax,%ebx
+  802516:	83 ec 08             	sub    $0x8,%esp
+  802519:	56                   	push   %esi
+  80251a:	ff 75 08             	push   0x8(%ebp)
+  80251d:	e8 78 fe ff ff       	call   80239a <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802522:	83 c4 10             	add    $0x10,%esp
+  802525:	85 db                	test   %ebx,%ebx
+  802527:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80252c:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80252f:	89 d8                	mov    %ebx,%eax
+  802531:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802534:	5b                   	pop    %ebx
+  802535:	5e                   	pop    %esi
+  802536:	5f                   	pop    %edi
+  802537:	5d                   	pop    %ebp
+  802538:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802539:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80253c:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80253e:	85 c0                	test   %eax,%eax
+  802540:	74 ed                	je     80252f <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802542:	be 00 00 00 00       	mov    $0x0,%esi
+  802547:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80254a:	39 fe                	cmp    %edi,%esi
+  80254c:	73 2e                	jae    80257c <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80254e:	83 ec 0c             	sub    $0xc,%esp
+  802551:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802554:	50                   	push   %eax
+  802555:	e8 2d ed ff ff       	call   801287 <cowpage>
+  80255a:	83 c4 10             	add    $0x10,%esp
+  80255d:	85 c0                	test   %eax,%eax
+  80255f:	78 08                	js     802569 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802561:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802567:	eb e1                	jmp    80254a <mmap+0x14e>
+				munmap(addr, len);
+  802569:	89 c3                	mov    %eax,%ebx
+  80256b:	83 ec 08             	sub    $0x8,%esp
+  80256e:	57                   	push   %edi
+  80256f:	ff 75 08             	push   0x8(%ebp)
+  802572:	e8 23 fe ff ff       	call   80239a <munmap>
+				return r;
+  802577:	83 c4 10             	add    $0x10,%esp
+  80257a:	eb b3                	jmp    80252f <mmap+0x133>
+	return 0;
+  80257c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80257f:	eb ae                	jmp    80252f <mmap+0x133>
+		return -E_NOT_SUPP;
+  802581:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802586:	eb a7                	jmp    80252f <mmap+0x133>
+		return -E_NOT_SUPP;
+  802588:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80258d:	eb a0                	jmp    80252f <mmap+0x133>
+		return -E_INVAL;
+  80258f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802594:	eb 99                	jmp    80252f <mmap+0x133>
+  802596:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80259b:	eb 92                	jmp    80252f <mmap+0x133>
+  80259d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025a2:	eb 8b                	jmp    80252f <mmap+0x133>
+  8025a4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025a9:	eb 84                	jmp    80252f <mmap+0x133>
+			munmap(addr, done);
+  8025ab:	83 ec 08             	sub    $0x8,%esp
+  8025ae:	56                   	push   %esi
+  8025af:	ff 75 08             	push   0x8(%ebp)
+  8025b2:	e8 e3 fd ff ff       	call   80239a <munmap>
+  8025b7:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8025ba:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025bf:	e9 6b ff ff ff       	jmp    80252f <mmap+0x133>
+
+008025c4 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8025c4:	55                   	push   %ebp
+  8025c5:	89 e5                	mov    %esp,%ebp
+  8025c7:	56                   	push   %esi
+  8025c8:	53                   	push   %ebx
+  8025c9:	83 ec 10             	sub    $0x10,%esp
+  8025cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8025cf:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025d5:	e8 3d f9 ff ff       	call   801f17 <fsring_slot>
+  8025da:	85 c0                	test   %eax,%eax
+  8025dc:	78 60                	js     80263e <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8025de:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8025e1:	8b 56 08             	mov    0x8(%esi),%edx
+  8025e4:	83 e2 03             	and    $0x3,%edx
+  8025e7:	83 fa 01             	cmp    $0x1,%edx
+  8025ea:	74 59                	je     802645 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8025ec:	ba 01 00 00 00       	mov    $0x1,%edx
+  8025f1:	89 c1                	mov    %eax,%ecx
+  8025f3:	d3 e2                	shl    %cl,%edx
+  8025f5:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8025fb:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8025fe:	c1 e2 02             	shl    $0x2,%edx
+  802601:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  802607:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  80260e:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802611:	8b 55 18             	mov    0x18(%ebp),%edx
+  802614:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802617:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80261a:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80261d:	83 ec 08             	sub    $0x8,%esp
+  802620:	50                   	push   %eax
+  802621:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802626:	39 c3                	cmp    %eax,%ebx
+  802628:	0f 47 d8             	cmova  %eax,%ebx
+  80262b:	53                   	push   %ebx
+  80262c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80262f:	89 f2                	mov    %esi,%edx
+  802631:	b8 03 00 00 00       	mov    $0x3,%eax
+  802636:	e8 1e f5 ff ff       	call   801b59 <fsring_post>
+  80263b:	83 c4 10             	add    $0x10,%esp
+}
+  80263e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802641:	5b                   	pop    %ebx
+  802642:	5e                   	pop    %esi
+  802643:	5d                   	pop    %ebp
+  802644:	c3                   	ret
+		return -E_INVAL;
+  802645:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80264a:	eb f2                	jmp    80263e <fsring_read+0x7a>
+
+0080264c <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80264c:	55                   	push   %ebp
+  80264d:	89 e5                	mov    %esp,%ebp
+  80264f:	56                   	push   %esi
+  802650:	53                   	push   %ebx
+  802651:	83 ec 10             	sub    $0x10,%esp
+  802654:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802657:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80265a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80265d:	e8 b5 f8 ff ff       	call   801f17 <fsring_slot>
+  802662:	89 c3                	mov    %eax,%ebx
+  802664:	85 c0                	test   %eax,%eax
+  802666:	78 77                	js     8026df <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802668:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80266b:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80266f:	74 77                	je     8026e8 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802671:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802676:	39 c6                	cmp    %eax,%esi
+  802678:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80267b:	83 ec 04             	sub    $0x4,%esp
+  80267e:	56                   	push   %esi
+  80267f:	ff 75 0c             	push   0xc(%ebp)
+  802682:	89 d8                	mov    %ebx,%eax
+  802684:	c1 e0 0c             	shl    $0xc,%eax
+  802687:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80268d:	50                   	push   %eax
+  80268e:	e8 56 e4 ff ff       	call   800ae9 <memmove>
+	fsring_busy |= 1 << slot;
+  802693:	b8 01 00 00 00       	mov    $0x1,%eax
+  802698:	89 d9                	mov    %ebx,%ecx
+  80269a:	d3 e0                	shl    %cl,%eax
+  80269c:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8026a2:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8026a5:	c1 e0 02             	shl    $0x2,%eax
+  8026a8:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  8026ae:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  8026b5:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8026b8:	8b 45 18             	mov    0x18(%ebp),%eax
+  8026bb:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8026be:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8026c5:	83 c4 08             	add    $0x8,%esp
+  8026c8:	53                   	push   %ebx
+  8026c9:	56                   	push   %esi
+  8026ca:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8026cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026d0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8026d5:	e8 7f f4 ff ff       	call   801b59 <fsring_post>
+  8026da:	89 c3                	mov    %eax,%ebx
+  8026dc:	83 c4 10             	add    $0x10,%esp
+}
+  8026df:	89 d8                	mov    %ebx,%eax
+  8026e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e4:	5b                   	pop    %ebx
+  8026e5:	5e                   	pop    %esi
+  8026e6:	5d                   	pop    %ebp
+  8026e7:	c3                   	ret
+		return -E_INVAL;
+  8026e8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8026ed:	eb f0                	jmp    8026df <fsring_write+0x93>
+
+008026ef <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8026ef:	55                   	push   %ebp
+  8026f0:	89 e5                	mov    %esp,%ebp
+  8026f2:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8026f5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026fb:	e8 17 f8 ff ff       	call   801f17 <fsring_slot>
+  802700:	85 c0                	test   %eax,%eax
+  802702:	78 4c                	js     802750 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802704:	ba 01 00 00 00       	mov    $0x1,%edx
+  802709:	89 c1                	mov    %eax,%ecx
+  80270b:	d3 e2                	shl    %cl,%edx
+  80270d:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802713:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802716:	c1 e2 02             	shl    $0x2,%edx
+  802719:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  80271f:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  802726:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802729:	8b 55 10             	mov    0x10(%ebp),%edx
+  80272c:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80272f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802732:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802735:	83 ec 08             	sub    $0x8,%esp
+  802738:	50                   	push   %eax
+  802739:	6a 00                	push   $0x0
+  80273b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802740:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802743:	b8 05 00 00 00       	mov    $0x5,%eax
+  802748:	e8 0c f4 ff ff       	call   801b59 <fsring_post>
+  80274d:	83 c4 10             	add    $0x10,%esp
+}
+  802750:	c9                   	leave
+  802751:	c3                   	ret
+
+00802752 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802752:	55                   	push   %ebp
+  802753:	89 e5                	mov    %esp,%ebp
+  802755:	57                   	push   %edi
+  802756:	56                   	push   %esi
+  802757:	53                   	push   %ebx
+  802758:	83 ec 1c             	sub    $0x1c,%esp
+  80275b:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80275f:	a1 00 60 80 00       	mov    0x806000,%eax
+  802764:	8b 40 48             	mov    0x48(%eax),%eax
+  802767:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  80276d:	74 12                	je     802781 <fsring_reap+0x2f>
+		return 0;
+  80276f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802774:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802777:	5b                   	pop    %ebx
+  802778:	5e                   	pop    %esi
+  802779:	5f                   	pop    %edi
+  80277a:	5d                   	pop    %ebp
+  80277b:	c3                   	ret
+		sys_yield();
+  80277c:	e8 cf e5 ff ff       	call   800d50 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802781:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802787:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80278c:	39 c2                	cmp    %eax,%edx
+  80278e:	75 18                	jne    8027a8 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802790:	84 db                	test   %bl,%bl
+  802792:	0f 84 21 01 00 00    	je     8028b9 <fsring_reap+0x167>
+  802798:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  80279f:	75 db                	jne    80277c <fsring_reap+0x2a>
+			return 0;
+  8027a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a6:	eb cc                	jmp    802774 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8027a8:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8027ad:	83 e0 0f             	and    $0xf,%eax
+  8027b0:	83 c0 2a             	add    $0x2a,%eax
+  8027b3:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8027ba:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8027c1:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8027c6:	83 c0 01             	add    $0x1,%eax
+  8027c9:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8027ce:	83 fb 0f             	cmp    $0xf,%ebx
+  8027d1:	77 5b                	ja     80282e <fsring_reap+0xdc>
+  8027d3:	be 01 00 00 00       	mov    $0x1,%esi
+  8027d8:	89 d9                	mov    %ebx,%ecx
+  8027da:	d3 e6                	shl    %cl,%esi
+  8027dc:	89 f0                	mov    %esi,%eax
+  8027de:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  8027e4:	74 48                	je     80282e <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8027e6:	89 d8                	mov    %ebx,%eax
+  8027e8:	c1 e0 0c             	shl    $0xc,%eax
+  8027eb:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8027f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8027f4:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8027f7:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  8027fe:	83 f8 03             	cmp    $0x3,%eax
+  802801:	74 40                	je     802843 <fsring_reap+0xf1>
+  802803:	83 f8 05             	cmp    $0x5,%eax
+  802806:	74 64                	je     80286c <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802808:	f7 d6                	not    %esi
+  80280a:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802810:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802813:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  80281a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80281d:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  80281f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802822:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802824:	b8 01 00 00 00       	mov    $0x1,%eax
+  802829:	e9 46 ff ff ff       	jmp    802774 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80282e:	53                   	push   %ebx
+  80282f:	68 f8 3e 80 00       	push   $0x803ef8
+  802834:	68 8f 02 00 00       	push   $0x28f
+  802839:	68 d0 3e 80 00       	push   $0x803ed0
+  80283e:	e8 57 da ff ff       	call   80029a <_panic>
+		if (cqe.cqe_result > 0)
+  802843:	85 ff                	test   %edi,%edi
+  802845:	7e c1                	jle    802808 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802847:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80284a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80284f:	39 c7                	cmp    %eax,%edi
+  802851:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802854:	50                   	push   %eax
+  802855:	ff 75 e4             	push   -0x1c(%ebp)
+  802858:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80285b:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  802862:	e8 82 e2 ff ff       	call   800ae9 <memmove>
+  802867:	83 c4 10             	add    $0x10,%esp
+  80286a:	eb 9c                	jmp    802808 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80286c:	85 ff                	test   %edi,%edi
+  80286e:	75 98                	jne    802808 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802870:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802873:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80287a:	83 ec 08             	sub    $0x8,%esp
+  80287d:	ff 75 e4             	push   -0x1c(%ebp)
+  802880:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802883:	51                   	push   %ecx
+  802884:	e8 da e0 ff ff       	call   800963 <strcpy>
+			st->st_size = ret->ret_size;
+  802889:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80288c:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802892:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802895:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80289b:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8028a1:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8028a7:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  8028ae:	50 80 00 
+  8028b1:	83 c4 10             	add    $0x10,%esp
+  8028b4:	e9 4f ff ff ff       	jmp    802808 <fsring_reap+0xb6>
+			return 0;
+  8028b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028be:	e9 b1 fe ff ff       	jmp    802774 <fsring_reap+0x22>
+
+008028c3 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8028c3:	55                   	push   %ebp
+  8028c4:	89 e5                	mov    %esp,%ebp
+  8028c6:	57                   	push   %edi
+  8028c7:	56                   	push   %esi
+  8028c8:	53                   	push   %ebx
+  8028c9:	83 ec 28             	sub    $0x28,%esp
+  8028cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8028cf:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8028d2:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8028d5:	53                   	push   %ebx
+  8028d6:	e8 4d e0 ff ff       	call   800928 <strlen>
+  8028db:	83 c4 10             	add    $0x10,%esp
+  8028de:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8028e3:	0f 8f 02 01 00 00    	jg     8029eb <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8028e9:	83 ec 08             	sub    $0x8,%esp
+  8028ec:	53                   	push   %ebx
+  8028ed:	68 00 70 80 00       	push   $0x807000
+  8028f2:	e8 6c e0 ff ff       	call   800963 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8028f7:	83 c4 10             	add    $0x10,%esp
+  8028fa:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802900:	76 69                	jbe    80296b <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802902:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802905:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80290b:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802910:	29 d1                	sub    %edx,%ecx
+  802912:	39 f9                	cmp    %edi,%ecx
+  802914:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802917:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80291a:	89 f9                	mov    %edi,%ecx
+  80291c:	01 c1                	add    %eax,%ecx
+  80291e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802921:	eb 0f                	jmp    802932 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802923:	0f b6 10             	movzbl (%eax),%edx
+  802926:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802928:	05 00 10 00 00       	add    $0x1000,%eax
+  80292d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802932:	39 c8                	cmp    %ecx,%eax
+  802934:	72 ed                	jb     802923 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802936:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802939:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  80293f:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802945:	83 ec 0c             	sub    $0xc,%esp
+  802948:	6a 07                	push   $0x7
+  80294a:	89 f9                	mov    %edi,%ecx
+  80294c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80294f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802954:	e8 3f f1 ff ff       	call   801a98 <fsipc_pages>
+  802959:	89 c7                	mov    %eax,%edi
+  80295b:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  80295e:	85 f6                	test   %esi,%esi
+  802960:	74 7f                	je     8029e1 <file_slurp+0x11e>
+  802962:	8d 43 01             	lea    0x1(%ebx),%eax
+  802965:	85 ff                	test   %edi,%edi
+  802967:	79 3c                	jns    8029a5 <file_slurp+0xe2>
+  802969:	eb 76                	jmp    8029e1 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  80296b:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802971:	ba 00 00 00 00       	mov    $0x0,%edx
+  802976:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80297b:	e8 ba f2 ff ff       	call   801c3a <fsipc>
+  802980:	89 c7                	mov    %eax,%edi
+  802982:	85 c0                	test   %eax,%eax
+  802984:	7e d8                	jle    80295e <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802986:	83 ec 04             	sub    $0x4,%esp
+  802989:	50                   	push   %eax
+  80298a:	68 08 70 80 00       	push   $0x807008
+  80298f:	ff 75 0c             	push   0xc(%ebp)
+  802992:	e8 52 e1 ff ff       	call   800ae9 <memmove>
+  802997:	83 c4 10             	add    $0x10,%esp
+  80299a:	eb c2                	jmp    80295e <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  80299c:	80 fa 2f             	cmp    $0x2f,%dl
+  80299f:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8029a2:	83 c0 01             	add    $0x1,%eax
+  8029a5:	89 c1                	mov    %eax,%ecx
+  8029a7:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8029ab:	84 d2                	test   %dl,%dl
+  8029ad:	75 ed                	jne    80299c <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8029af:	83 ec 04             	sub    $0x4,%esp
+  8029b2:	68 80 00 00 00       	push   $0x80
+  8029b7:	53                   	push   %ebx
+  8029b8:	56                   	push   %esi
+  8029b9:	e8 1b e0 ff ff       	call   8009d9 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8029be:	a1 00 70 80 00       	mov    0x807000,%eax
+  8029c3:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8029c9:	a1 04 70 80 00       	mov    0x807004,%eax
+  8029ce:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8029d4:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  8029db:	50 80 00 
+  8029de:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8029e1:	89 f8                	mov    %edi,%eax
+  8029e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029e6:	5b                   	pop    %ebx
+  8029e7:	5e                   	pop    %esi
+  8029e8:	5f                   	pop    %edi
+  8029e9:	5d                   	pop    %ebp
+  8029ea:	c3                   	ret
+		return -E_BAD_PATH;
+  8029eb:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8029f0:	eb ef                	jmp    8029e1 <file_slurp+0x11e>
+
+008029f2 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8029f2:	55                   	push   %ebp
+  8029f3:	89 e5                	mov    %esp,%ebp
+  8029f5:	53                   	push   %ebx
+  8029f6:	83 ec 10             	sub    $0x10,%esp
+  8029f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8029fc:	53                   	push   %ebx
+  8029fd:	e8 26 df ff ff       	call   800928 <strlen>
+  802a02:	83 c4 10             	add    $0x10,%esp
+  802a05:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a0a:	7f 25                	jg     802a31 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802a0c:	83 ec 08             	sub    $0x8,%esp
+  802a0f:	53                   	push   %ebx
+  802a10:	68 00 70 80 00       	push   $0x807000
+  802a15:	e8 49 df ff ff       	call   800963 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802a1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a1f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a24:	e8 11 f2 ff ff       	call   801c3a <fsipc>
+  802a29:	83 c4 10             	add    $0x10,%esp
+}
+  802a2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a2f:	c9                   	leave
+  802a30:	c3                   	ret
+		return -E_BAD_PATH;
+  802a31:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802a36:	eb f4                	jmp    802a2c <remove+0x3a>
+
+00802a38 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802a38:	55                   	push   %ebp
+  802a39:	89 e5                	mov    %esp,%ebp
+  802a3b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802a3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a43:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a48:	e8 ed f1 ff ff       	call   801c3a <fsipc>
+}
+  802a4d:	c9                   	leave
+  802a4e:	c3                   	ret
+
+00802a4f <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802a4f:	55                   	push   %ebp
+  802a50:	89 e5                	mov    %esp,%ebp
+  802a52:	57                   	push   %edi
+  802a53:	56                   	push   %esi
+  802a54:	53                   	push   %ebx
+  802a55:	83 ec 18             	sub    $0x18,%esp
+  802a58:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a5b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802a61:	57                   	push   %edi
+  802a62:	e8 c1 de ff ff       	call   800928 <strlen>
+  802a67:	83 c4 10             	add    $0x10,%esp
+  802a6a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a6f:	7f 4c                	jg     802abd <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802a71:	83 ec 08             	sub    $0x8,%esp
+  802a74:	57                   	push   %edi
+  802a75:	68 00 70 80 00       	push   $0x807000
+  802a7a:	e8 e4 de ff ff       	call   800963 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802a7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a84:	b8 10 00 00 00       	mov    $0x10,%eax
+  802a89:	e8 ac f1 ff ff       	call   801c3a <fsipc>
+  802a8e:	83 c4 10             	add    $0x10,%esp
+  802a91:	85 c0                	test   %eax,%eax
+  802a93:	78 20                	js     802ab5 <defrag+0x66>
+		return r;
+	if (before)
+  802a95:	85 f6                	test   %esi,%esi
+  802a97:	74 07                	je     802aa0 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802a99:	a1 00 70 80 00       	mov    0x807000,%eax
+  802a9e:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802aa0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802aa5:	85 db                	test   %ebx,%ebx
+  802aa7:	74 0c                	je     802ab5 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802aa9:	a1 04 70 80 00       	mov    0x807004,%eax
+  802aae:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802ab0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ab5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ab8:	5b                   	pop    %ebx
+  802ab9:	5e                   	pop    %esi
+  802aba:	5f                   	pop    %edi
+  802abb:	5d                   	pop    %ebp
+  802abc:	c3                   	ret
+		return -E_BAD_PATH;
+  802abd:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802ac2:	eb f1                	jmp    802ab5 <defrag+0x66>
+
+00802ac4 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802ac4:	55                   	push   %ebp
+  802ac5:	89 e5                	mov    %esp,%ebp
+  802ac7:	53                   	push   %ebx
+  802ac8:	83 ec 04             	sub    $0x4,%esp
+  802acb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802ace:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ad3:	b8 11 00 00 00       	mov    $0x11,%eax
+  802ad8:	e8 5d f1 ff ff       	call   801c3a <fsipc>
+  802add:	85 c0                	test   %eax,%eax
+  802adf:	78 34                	js     802b15 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802ae1:	a1 00 70 80 00       	mov    0x807000,%eax
+  802ae6:	89 03                	mov    %eax,(%ebx)
+  802ae8:	a1 04 70 80 00       	mov    0x807004,%eax
+  802aed:	89 43 04             	mov    %eax,0x4(%ebx)
+  802af0:	a1 08 70 80 00       	mov    0x807008,%eax
+  802af5:	89 43 08             	mov    %eax,0x8(%ebx)
+  802af8:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  802afd:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802b00:	a1 10 70 80 00       	mov    0x807010,%eax
+  802b05:	89 43 10             	mov    %eax,0x10(%ebx)
+  802b08:	a1 14 70 80 00       	mov    0x807014,%eax
+  802b0d:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802b10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b18:	c9                   	leave
+  802b19:	c3                   	ret
+
+00802b1a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b1a:	55                   	push   %ebp
+  802b1b:	89 e5                	mov    %esp,%ebp
+  802b1d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802b20:	68 11 3f 80 00       	push   $0x803f11
+  802b25:	ff 75 0c             	push   0xc(%ebp)
+  802b28:	e8 36 de ff ff       	call   800963 <strcpy>
+	return 0;
+}
+  802b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b32:	c9                   	leave
+  802b33:	c3                   	ret
+
+00802b34 <devsock_close>:
+{
+  802b34:	55                   	push   %ebp
+  802b35:	89 e5                	mov    %esp,%ebp
+  802b37:	53                   	push   %ebx
+  802b38:	83 ec 10             	sub    $0x10,%esp
+  802b3b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802b3e:	53                   	push   %ebx
+  802b3f:	e8 78 0b 00 00       	call   8036bc <pageref>
+  802b44:	89 c2                	mov    %eax,%edx
+  802b46:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802b49:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802b4e:	83 fa 01             	cmp    $0x1,%edx
+  802b51:	74 05                	je     802b58 <devsock_close+0x24>
+}
+  802b53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b56:	c9                   	leave
+  802b57:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802b58:	83 ec 0c             	sub    $0xc,%esp
+  802b5b:	ff 73 0c             	push   0xc(%ebx)
+  802b5e:	e8 b7 02 00 00       	call   802e1a <nsipc_close>
+  802b63:	83 c4 10             	add    $0x10,%esp
+  802b66:	eb eb                	jmp    802b53 <devsock_close+0x1f>
+
+00802b68 <devsock_write>:
+{
+  802b68:	55                   	push   %ebp
+  802b69:	89 e5                	mov    %esp,%ebp
+  802b6b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802b6e:	6a 00                	push   $0x0
+  802b70:	ff 75 10             	push   0x10(%ebp)
+  802b73:	ff 75 0c             	push   0xc(%ebp)
+  802b76:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b79:	ff 70 0c             	push   0xc(%eax)
+  802b7c:	e8 79 03 00 00       	call   802efa <nsipc_send>
+}
+  802b81:	c9                   	leave
+  802b82:	c3                   	ret
+
+00802b83 <devsock_read>:
+{
+  802b83:	55                   	push   %ebp
+  802b84:	89 e5                	mov    %esp,%ebp
+  802b86:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802b89:	6a 00                	push   $0x0
+  802b8b:	ff 75 10             	push   0x10(%ebp)
+  802b8e:	ff 75 0c             	push   0xc(%ebp)
+  802b91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b94:	ff 70 0c             	push   0xc(%eax)
+  802b97:	e8 ef 02 00 00       	call   802e8b <nsipc_recv>
+}
+  802b9c:	c9                   	leave
+  802b9d:	c3                   	ret
+
+00802b9e <fd2sockid>:
+{
+  802b9e:	55                   	push   %ebp
+  802b9f:	89 e5                	mov    %esp,%ebp
+  802ba1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802ba4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802ba7:	52                   	push   %edx
+  802ba8:	50                   	push   %eax
+  802ba9:	e8 54 e9 ff ff       	call   801502 <fd_lookup>
+  802bae:	83 c4 10             	add    $0x10,%esp
+  802bb1:	85 c0                	test   %eax,%eax
+  802bb3:	78 10                	js     802bc5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802bb5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bb8:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802bbe:	39 08                	cmp    %ecx,(%eax)
+  802bc0:	75 05                	jne    802bc7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802bc2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802bc5:	c9                   	leave
+  802bc6:	c3                   	ret
+		return -E_NOT_SUPP;
+  802bc7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802bcc:	eb f7                	jmp    802bc5 <fd2sockid+0x27>
+
+00802bce <alloc_sockfd>:
+{
+  802bce:	55                   	push   %ebp
+  802bcf:	89 e5                	mov    %esp,%ebp
+  802bd1:	56                   	push   %esi
+  802bd2:	53                   	push   %ebx
+  802bd3:	83 ec 1c             	sub    $0x1c,%esp
+  802bd6:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802bd8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bdb:	50                   	push   %eax
+  802bdc:	e8 cb e8 ff ff       	call   8014ac <fd_alloc>
+  802be1:	89 c3                	mov    %eax,%ebx
+  802be3:	83 c4 10             	add    $0x10,%esp
+  802be6:	85 c0                	test   %eax,%eax
+  802be8:	78 43                	js     802c2d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802bea:	83 ec 04             	sub    $0x4,%esp
+  802bed:	68 07 04 00 00       	push   $0x407
+  802bf2:	ff 75 f4             	push   -0xc(%ebp)
+  802bf5:	6a 00                	push   $0x0
+  802bf7:	e8 73 e1 ff ff       	call   800d6f <sys_page_alloc>
+  802bfc:	89 c3                	mov    %eax,%ebx
+  802bfe:	83 c4 10             	add    $0x10,%esp
+  802c01:	85 c0                	test   %eax,%eax
+  802c03:	78 28                	js     802c2d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802c05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c08:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802c0e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802c10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c13:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802c1a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802c1d:	83 ec 0c             	sub    $0xc,%esp
+  802c20:	50                   	push   %eax
+  802c21:	e8 5f e8 ff ff       	call   801485 <fd2num>
+  802c26:	89 c3                	mov    %eax,%ebx
+  802c28:	83 c4 10             	add    $0x10,%esp
+  802c2b:	eb 0c                	jmp    802c39 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802c2d:	83 ec 0c             	sub    $0xc,%esp
+  802c30:	56                   	push   %esi
+  802c31:	e8 e4 01 00 00       	call   802e1a <nsipc_close>
+		return r;
+  802c36:	83 c4 10             	add    $0x10,%esp
+}
+  802c39:	89 d8                	mov    %ebx,%eax
+  802c3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c3e:	5b                   	pop    %ebx
+  802c3f:	5e                   	pop    %esi
+  802c40:	5d                   	pop    %ebp
+  802c41:	c3                   	ret
+
+00802c42 <accept>:
+{
+  802c42:	55                   	push   %ebp
+  802c43:	89 e5                	mov    %esp,%ebp
+  802c45:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c48:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c4b:	e8 4e ff ff ff       	call   802b9e <fd2sockid>
+  802c50:	85 c0                	test   %eax,%eax
+  802c52:	78 1b                	js     802c6f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802c54:	83 ec 04             	sub    $0x4,%esp
+  802c57:	ff 75 10             	push   0x10(%ebp)
+  802c5a:	ff 75 0c             	push   0xc(%ebp)
+  802c5d:	50                   	push   %eax
+  802c5e:	e8 0e 01 00 00       	call   802d71 <nsipc_accept>
+  802c63:	83 c4 10             	add    $0x10,%esp
+  802c66:	85 c0                	test   %eax,%eax
+  802c68:	78 05                	js     802c6f <accept+0x2d>
+	return alloc_sockfd(r);
+  802c6a:	e8 5f ff ff ff       	call   802bce <alloc_sockfd>
+}
+  802c6f:	c9                   	leave
+  802c70:	c3                   	ret
+
+00802c71 <bind>:
+{
+  802c71:	55                   	push   %ebp
+  802c72:	89 e5                	mov    %esp,%ebp
+  802c74:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c77:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c7a:	e8 1f ff ff ff       	call   802b9e <fd2sockid>
+  802c7f:	85 c0                	test   %eax,%eax
+  802c81:	78 12                	js     802c95 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802c83:	83 ec 04             	sub    $0x4,%esp
+  802c86:	ff 75 10             	push   0x10(%ebp)
+  802c89:	ff 75 0c             	push   0xc(%ebp)
+  802c8c:	50                   	push   %eax
+  802c8d:	e8 31 01 00 00       	call   802dc3 <nsipc_bind>
+  802c92:	83 c4 10             	add    $0x10,%esp
+}
+  802c95:	c9                   	leave
+  802c96:	c3                   	ret
+
+00802c97 <shutdown>:
+{
+  802c97:	55                   	push   %ebp
+  802c98:	89 e5                	mov    %esp,%ebp
+  802c9a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca0:	e8 f9 fe ff ff       	call   802b9e <fd2sockid>
+  802ca5:	85 c0                	test   %eax,%eax
+  802ca7:	78 0f                	js     802cb8 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802ca9:	83 ec 08             	sub    $0x8,%esp
+  802cac:	ff 75 0c             	push   0xc(%ebp)
+  802caf:	50                   	push   %eax
+  802cb0:	e8 43 01 00 00       	call   802df8 <nsipc_shutdown>
+  802cb5:	83 c4 10             	add    $0x10,%esp
+}
+  802cb8:	c9                   	leave
+  802cb9:	c3                   	ret
+
+00802cba <connect>:
+{
+  802cba:	55                   	push   %ebp
+  802cbb:	89 e5                	mov    %esp,%ebp
+  802cbd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802cc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc3:	e8 d6 fe ff ff       	call   802b9e <fd2sockid>
+  802cc8:	85 c0                	test   %eax,%eax
+  802cca:	78 12                	js     802cde <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802ccc:	83 ec 04             	sub    $0x4,%esp
+  802ccf:	ff 75 10             	push   0x10(%ebp)
+  802cd2:	ff 75 0c             	push   0xc(%ebp)
+  802cd5:	50                   	push   %eax
+  802cd6:	e8 59 01 00 00       	call   802e34 <nsipc_connect>
+  802cdb:	83 c4 10             	add    $0x10,%esp
+}
+  802cde:	c9                   	leave
+  802cdf:	c3                   	ret
+
+00802ce0 <listen>:
+{
+  802ce0:	55                   	push   %ebp
+  802ce1:	89 e5                	mov    %esp,%ebp
+  802ce3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce9:	e8 b0 fe ff ff       	call   802b9e <fd2sockid>
+  802cee:	85 c0                	test   %eax,%eax
+  802cf0:	78 0f                	js     802d01 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802cf2:	83 ec 08             	sub    $0x8,%esp
+  802cf5:	ff 75 0c             	push   0xc(%ebp)
+  802cf8:	50                   	push   %eax
+  802cf9:	e8 6b 01 00 00       	call   802e69 <nsipc_listen>
+  802cfe:	83 c4 10             	add    $0x10,%esp
+}
+  802d01:	c9                   	leave
+  802d02:	c3                   	ret
+
+00802d03 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802d03:	55                   	push   %ebp
+  802d04:	89 e5                	mov    %esp,%ebp
+  802d06:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802d09:	ff 75 10             	push   0x10(%ebp)
+  802d0c:	ff 75 0c             	push   0xc(%ebp)
+  802d0f:	ff 75 08             	push   0x8(%ebp)
+  802d12:	e8 41 02 00 00       	call   802f58 <nsipc_socket>
+  802d17:	83 c4 10             	add    $0x10,%esp
+  802d1a:	85 c0                	test   %eax,%eax
+  802d1c:	78 05                	js     802d23 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802d1e:	e8 ab fe ff ff       	call   802bce <alloc_sockfd>
+}
+  802d23:	c9                   	leave
+  802d24:	c3                   	ret
+
+00802d25 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802d25:	55                   	push   %ebp
+  802d26:	89 e5                	mov    %esp,%ebp
+  802d28:	53                   	push   %ebx
+  802d29:	83 ec 04             	sub    $0x4,%esp
+  802d2c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802d2e:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802d35:	74 26                	je     802d5d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802d37:	6a 07                	push   $0x7
+  802d39:	68 00 90 80 00       	push   $0x809000
+  802d3e:	53                   	push   %ebx
+  802d3f:	ff 35 00 a0 80 00    	push   0x80a000
+  802d45:	e8 fa 07 00 00       	call   803544 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802d4a:	83 c4 0c             	add    $0xc,%esp
+  802d4d:	6a 00                	push   $0x0
+  802d4f:	6a 00                	push   $0x0
+  802d51:	6a 00                	push   $0x0
+  802d53:	e8 81 07 00 00       	call   8034d9 <ipc_recv>
+}
+  802d58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d5b:	c9                   	leave
+  802d5c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d5d:	83 ec 0c             	sub    $0xc,%esp
+  802d60:	6a 02                	push   $0x2
+  802d62:	e8 16 09 00 00       	call   80367d <ipc_find_env>
+  802d67:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  802d6c:	83 c4 10             	add    $0x10,%esp
+  802d6f:	eb c6                	jmp    802d37 <nsipc+0x12>
+
+00802d71 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802d71:	55                   	push   %ebp
+  802d72:	89 e5                	mov    %esp,%ebp
+  802d74:	56                   	push   %esi
+  802d75:	53                   	push   %ebx
+  802d76:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802d79:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d7c:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802d81:	8b 06                	mov    (%esi),%eax
+  802d83:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802d88:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d8d:	e8 93 ff ff ff       	call   802d25 <nsipc>
+  802d92:	89 c3                	mov    %eax,%ebx
+  802d94:	85 c0                	test   %eax,%eax
+  802d96:	79 09                	jns    802da1 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802d98:	89 d8                	mov    %ebx,%eax
+  802d9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d9d:	5b                   	pop    %ebx
+  802d9e:	5e                   	pop    %esi
+  802d9f:	5d                   	pop    %ebp
+  802da0:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802da1:	83 ec 04             	sub    $0x4,%esp
+  802da4:	ff 35 10 90 80 00    	push   0x809010
+  802daa:	68 00 90 80 00       	push   $0x809000
+  802daf:	ff 75 0c             	push   0xc(%ebp)
+  802db2:	e8 32 dd ff ff       	call   800ae9 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802db7:	a1 10 90 80 00       	mov    0x809010,%eax
+  802dbc:	89 06                	mov    %eax,(%esi)
+  802dbe:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802dc1:	eb d5                	jmp    802d98 <nsipc_accept+0x27>
+
+00802dc3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802dc3:	55                   	push   %ebp
+  802dc4:	89 e5                	mov    %esp,%ebp
+  802dc6:	53                   	push   %ebx
+  802dc7:	83 ec 08             	sub    $0x8,%esp
+  802dca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802dcd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dd0:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802dd5:	53                   	push   %ebx
+  802dd6:	ff 75 0c             	push   0xc(%ebp)
+  802dd9:	68 04 90 80 00       	push   $0x809004
+  802dde:	e8 06 dd ff ff       	call   800ae9 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802de3:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802de9:	b8 02 00 00 00       	mov    $0x2,%eax
+  802dee:	e8 32 ff ff ff       	call   802d25 <nsipc>
+}
+  802df3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802df6:	c9                   	leave
+  802df7:	c3                   	ret
+
+00802df8 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802df8:	55                   	push   %ebp
+  802df9:	89 e5                	mov    %esp,%ebp
+  802dfb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802dfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e01:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802e06:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e09:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802e0e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e13:	e8 0d ff ff ff       	call   802d25 <nsipc>
+}
+  802e18:	c9                   	leave
+  802e19:	c3                   	ret
+
+00802e1a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802e1a:	55                   	push   %ebp
+  802e1b:	89 e5                	mov    %esp,%ebp
+  802e1d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802e20:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e23:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802e28:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e2d:	e8 f3 fe ff ff       	call   802d25 <nsipc>
+}
+  802e32:	c9                   	leave
+  802e33:	c3                   	ret
+
+00802e34 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802e34:	55                   	push   %ebp
+  802e35:	89 e5                	mov    %esp,%ebp
+  802e37:	53                   	push   %ebx
+  802e38:	83 ec 08             	sub    $0x8,%esp
+  802e3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802e3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e41:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802e46:	53                   	push   %ebx
+  802e47:	ff 75 0c             	push   0xc(%ebp)
+  802e4a:	68 04 90 80 00       	push   $0x809004
+  802e4f:	e8 95 dc ff ff       	call   800ae9 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802e54:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802e5a:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e5f:	e8 c1 fe ff ff       	call   802d25 <nsipc>
+}
+  802e64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e67:	c9                   	leave
+  802e68:	c3                   	ret
+
+00802e69 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802e69:	55                   	push   %ebp
+  802e6a:	89 e5                	mov    %esp,%ebp
+  802e6c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802e6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e72:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802e77:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e7a:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802e7f:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e84:	e8 9c fe ff ff       	call   802d25 <nsipc>
+}
+  802e89:	c9                   	leave
+  802e8a:	c3                   	ret
+
+00802e8b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802e8b:	55                   	push   %ebp
+  802e8c:	89 e5                	mov    %esp,%ebp
+  802e8e:	56                   	push   %esi
+  802e8f:	53                   	push   %ebx
+  802e90:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802e93:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e96:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802e9b:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802ea1:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ea4:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802ea9:	b8 07 00 00 00       	mov    $0x7,%eax
+  802eae:	e8 72 fe ff ff       	call   802d25 <nsipc>
+  802eb3:	89 c3                	mov    %eax,%ebx
+  802eb5:	85 c0                	test   %eax,%eax
+  802eb7:	78 22                	js     802edb <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802eb9:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ebe:	39 c6                	cmp    %eax,%esi
+  802ec0:	0f 4e c6             	cmovle %esi,%eax
+  802ec3:	39 c3                	cmp    %eax,%ebx
+  802ec5:	7f 1d                	jg     802ee4 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ec7:	83 ec 04             	sub    $0x4,%esp
+  802eca:	53                   	push   %ebx
+  802ecb:	68 00 90 80 00       	push   $0x809000
+  802ed0:	ff 75 0c             	push   0xc(%ebp)
+  802ed3:	e8 11 dc ff ff       	call   800ae9 <memmove>
+  802ed8:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802edb:	89 d8                	mov    %ebx,%eax
+  802edd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ee0:	5b                   	pop    %ebx
+  802ee1:	5e                   	pop    %esi
+  802ee2:	5d                   	pop    %ebp
+  802ee3:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802ee4:	68 1d 3f 80 00       	push   $0x803f1d
+  802ee9:	68 ec 3d 80 00       	push   $0x803dec
+  802eee:	6a 62                	push   $0x62
+  802ef0:	68 32 3f 80 00       	push   $0x803f32
+  802ef5:	e8 a0 d3 ff ff       	call   80029a <_panic>
+
+00802efa <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802efa:	55                   	push   %ebp
+  802efb:	89 e5                	mov    %esp,%ebp
+  802efd:	53                   	push   %ebx
+  802efe:	83 ec 04             	sub    $0x4,%esp
+  802f01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802f04:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f07:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802f0c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f12:	7f 2e                	jg     802f42 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802f14:	83 ec 04             	sub    $0x4,%esp
+  802f17:	53                   	push   %ebx
+  802f18:	ff 75 0c             	push   0xc(%ebp)
+  802f1b:	68 0c 90 80 00       	push   $0x80900c
+  802f20:	e8 c4 db ff ff       	call   800ae9 <memmove>
+	nsipcbuf.send.req_size = size;
+  802f25:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802f2b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f2e:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802f33:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f38:	e8 e8 fd ff ff       	call   802d25 <nsipc>
+}
+  802f3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f40:	c9                   	leave
+  802f41:	c3                   	ret
+	assert(size < 1600);
+  802f42:	68 3e 3f 80 00       	push   $0x803f3e
+  802f47:	68 ec 3d 80 00       	push   $0x803dec
+  802f4c:	6a 6d                	push   $0x6d
+  802f4e:	68 32 3f 80 00       	push   $0x803f32
+  802f53:	e8 42 d3 ff ff       	call   80029a <_panic>
+
+00802f58 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802f58:	55                   	push   %ebp
+  802f59:	89 e5                	mov    %esp,%ebp
+  802f5b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802f5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f61:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802f66:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f69:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802f6e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f71:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802f76:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f7b:	e8 a5 fd ff ff       	call   802d25 <nsipc>
+}
+  802f80:	c9                   	leave
+  802f81:	c3                   	ret
+
+00802f82 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f82:	55                   	push   %ebp
+  802f83:	89 e5                	mov    %esp,%ebp
+  802f85:	56                   	push   %esi
+  802f86:	53                   	push   %ebx
+  802f87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f8a:	83 ec 0c             	sub    $0xc,%esp
+  802f8d:	ff 75 08             	push   0x8(%ebp)
+  802f90:	e8 00 e5 ff ff       	call   801495 <fd2data>
+  802f95:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f97:	83 c4 08             	add    $0x8,%esp
+  802f9a:	68 4a 3f 80 00       	push   $0x803f4a
+  802f9f:	53                   	push   %ebx
+  802fa0:	e8 be d9 ff ff       	call   800963 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802fa5:	8b 46 04             	mov    0x4(%esi),%eax
+  802fa8:	2b 06                	sub    (%esi),%eax
+  802faa:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802fb0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802fb7:	00 00 00 
+	stat->st_dev = &devpipe;
+  802fba:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  802fc1:	50 80 00 
+	return 0;
+}
+  802fc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fcc:	5b                   	pop    %ebx
+  802fcd:	5e                   	pop    %esi
+  802fce:	5d                   	pop    %ebp
+  802fcf:	c3                   	ret
+
+00802fd0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802fd0:	55                   	push   %ebp
+  802fd1:	89 e5                	mov    %esp,%ebp
+  802fd3:	53                   	push   %ebx
+  802fd4:	83 ec 0c             	sub    $0xc,%esp
+  802fd7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802fda:	53                   	push   %ebx
+  802fdb:	6a 00                	push   $0x0
+  802fdd:	e8 1a de ff ff       	call   800dfc <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802fe2:	89 1c 24             	mov    %ebx,(%esp)
+  802fe5:	e8 ab e4 ff ff       	call   801495 <fd2data>
+  802fea:	83 c4 08             	add    $0x8,%esp
+  802fed:	50                   	push   %eax
+  802fee:	6a 00                	push   $0x0
+  802ff0:	e8 07 de ff ff       	call   800dfc <sys_page_unmap>
+}
+  802ff5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ff8:	c9                   	leave
+  802ff9:	c3                   	ret
+
+00802ffa <_pipeisclosed>:
+{
+  802ffa:	55                   	push   %ebp
+  802ffb:	89 e5                	mov    %esp,%ebp
+  802ffd:	57                   	push   %edi
+  802ffe:	56                   	push   %esi
+  802fff:	53                   	push   %ebx
+  803000:	83 ec 1c             	sub    $0x1c,%esp
+  803003:	89 c7                	mov    %eax,%edi
+  803005:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  803007:	a1 00 60 80 00       	mov    0x806000,%eax
+  80300c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80300f:	83 ec 0c             	sub    $0xc,%esp
+  803012:	57                   	push   %edi
+  803013:	e8 a4 06 00 00       	call   8036bc <pageref>
+  803018:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80301b:	89 34 24             	mov    %esi,(%esp)
+  80301e:	e8 99 06 00 00       	call   8036bc <pageref>
+		nn = thisenv->env_runs;
+  803023:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803029:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80302c:	83 c4 10             	add    $0x10,%esp
+  80302f:	39 cb                	cmp    %ecx,%ebx
+  803031:	74 1b                	je     80304e <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  803033:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803036:	75 cf                	jne    803007 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803038:	8b 42 58             	mov    0x58(%edx),%eax
+  80303b:	6a 01                	push   $0x1
+  80303d:	50                   	push   %eax
+  80303e:	53                   	push   %ebx
+  80303f:	68 51 3f 80 00       	push   $0x803f51
+  803044:	e8 2c d3 ff ff       	call   800375 <cprintf>
+  803049:	83 c4 10             	add    $0x10,%esp
+  80304c:	eb b9                	jmp    803007 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80304e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803051:	0f 94 c0             	sete   %al
+  803054:	0f b6 c0             	movzbl %al,%eax
+}
+  803057:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80305a:	5b                   	pop    %ebx
+  80305b:	5e                   	pop    %esi
+  80305c:	5f                   	pop    %edi
+  80305d:	5d                   	pop    %ebp
+  80305e:	c3                   	ret
+
+0080305f <devpipe_write>:
+{
+  80305f:	55                   	push   %ebp
+  803060:	89 e5                	mov    %esp,%ebp
+  803062:	57                   	push   %edi
+  803063:	56                   	push   %esi
+  803064:	53                   	push   %ebx
+  803065:	83 ec 28             	sub    $0x28,%esp
+  803068:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80306b:	56                   	push   %esi
+  80306c:	e8 24 e4 ff ff       	call   801495 <fd2data>
+  803071:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803073:	83 c4 10             	add    $0x10,%esp
+  803076:	bf 00 00 00 00       	mov    $0x0,%edi
+  80307b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80307e:	75 09                	jne    803089 <devpipe_write+0x2a>
+	return i;
+  803080:	89 f8                	mov    %edi,%eax
+  803082:	eb 23                	jmp    8030a7 <devpipe_write+0x48>
+			sys_yield();
+  803084:	e8 c7 dc ff ff       	call   800d50 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803089:	8b 43 04             	mov    0x4(%ebx),%eax
+  80308c:	8b 0b                	mov    (%ebx),%ecx
+  80308e:	8d 51 20             	lea    0x20(%ecx),%edx
+  803091:	39 d0                	cmp    %edx,%eax
+  803093:	72 1a                	jb     8030af <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803095:	89 da                	mov    %ebx,%edx
+  803097:	89 f0                	mov    %esi,%eax
+  803099:	e8 5c ff ff ff       	call   802ffa <_pipeisclosed>
+  80309e:	85 c0                	test   %eax,%eax
+  8030a0:	74 e2                	je     803084 <devpipe_write+0x25>
+				return 0;
+  8030a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030aa:	5b                   	pop    %ebx
+  8030ab:	5e                   	pop    %esi
+  8030ac:	5f                   	pop    %edi
+  8030ad:	5d                   	pop    %ebp
+  8030ae:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8030af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030b2:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8030b6:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8030b9:	89 c2                	mov    %eax,%edx
+  8030bb:	c1 fa 1f             	sar    $0x1f,%edx
+  8030be:	89 d1                	mov    %edx,%ecx
+  8030c0:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030c3:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8030c6:	83 e2 1f             	and    $0x1f,%edx
+  8030c9:	29 ca                	sub    %ecx,%edx
+  8030cb:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8030cf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8030d3:	83 c0 01             	add    $0x1,%eax
+  8030d6:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8030d9:	83 c7 01             	add    $0x1,%edi
+  8030dc:	eb 9d                	jmp    80307b <devpipe_write+0x1c>
+
+008030de <devpipe_read>:
+{
+  8030de:	55                   	push   %ebp
+  8030df:	89 e5                	mov    %esp,%ebp
+  8030e1:	57                   	push   %edi
+  8030e2:	56                   	push   %esi
+  8030e3:	53                   	push   %ebx
+  8030e4:	83 ec 18             	sub    $0x18,%esp
+  8030e7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8030ea:	57                   	push   %edi
+  8030eb:	e8 a5 e3 ff ff       	call   801495 <fd2data>
+  8030f0:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8030f2:	83 c4 10             	add    $0x10,%esp
+  8030f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8030fa:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030fd:	75 13                	jne    803112 <devpipe_read+0x34>
+	return i;
+  8030ff:	89 f0                	mov    %esi,%eax
+  803101:	eb 02                	jmp    803105 <devpipe_read+0x27>
+				return i;
+  803103:	89 f0                	mov    %esi,%eax
+}
+  803105:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803108:	5b                   	pop    %ebx
+  803109:	5e                   	pop    %esi
+  80310a:	5f                   	pop    %edi
+  80310b:	5d                   	pop    %ebp
+  80310c:	c3                   	ret
+			sys_yield();
+  80310d:	e8 3e dc ff ff       	call   800d50 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803112:	8b 03                	mov    (%ebx),%eax
+  803114:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803117:	75 18                	jne    803131 <devpipe_read+0x53>
+			if (i > 0)
+  803119:	85 f6                	test   %esi,%esi
+  80311b:	75 e6                	jne    803103 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80311d:	89 da                	mov    %ebx,%edx
+  80311f:	89 f8                	mov    %edi,%eax
+  803121:	e8 d4 fe ff ff       	call   802ffa <_pipeisclosed>
+  803126:	85 c0                	test   %eax,%eax
+  803128:	74 e3                	je     80310d <devpipe_read+0x2f>
+				return 0;
+  80312a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80312f:	eb d4                	jmp    803105 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803131:	99                   	cltd
+  803132:	c1 ea 1b             	shr    $0x1b,%edx
+  803135:	01 d0                	add    %edx,%eax
+  803137:	83 e0 1f             	and    $0x1f,%eax
+  80313a:	29 d0                	sub    %edx,%eax
+  80313c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803141:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803144:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803147:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80314a:	83 c6 01             	add    $0x1,%esi
+  80314d:	eb ab                	jmp    8030fa <devpipe_read+0x1c>
+
+0080314f <pipe>:
+{
+  80314f:	55                   	push   %ebp
+  803150:	89 e5                	mov    %esp,%ebp
+  803152:	56                   	push   %esi
+  803153:	53                   	push   %ebx
+  803154:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803157:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80315a:	50                   	push   %eax
+  80315b:	e8 4c e3 ff ff       	call   8014ac <fd_alloc>
+  803160:	89 c3                	mov    %eax,%ebx
+  803162:	83 c4 10             	add    $0x10,%esp
+  803165:	85 c0                	test   %eax,%eax
+  803167:	0f 88 23 01 00 00    	js     803290 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80316d:	83 ec 04             	sub    $0x4,%esp
+  803170:	68 07 04 00 00       	push   $0x407
+  803175:	ff 75 f4             	push   -0xc(%ebp)
+  803178:	6a 00                	push   $0x0
+  80317a:	e8 f0 db ff ff       	call   800d6f <sys_page_alloc>
+  80317f:	89 c3                	mov    %eax,%ebx
+  803181:	83 c4 10             	add    $0x10,%esp
+  803184:	85 c0                	test   %eax,%eax
+  803186:	0f 88 04 01 00 00    	js     803290 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80318c:	83 ec 0c             	sub    $0xc,%esp
+  80318f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803192:	50                   	push   %eax
+  803193:	e8 14 e3 ff ff       	call   8014ac <fd_alloc>
+  803198:	89 c3                	mov    %eax,%ebx
+  80319a:	83 c4 10             	add    $0x10,%esp
+  80319d:	85 c0                	test   %eax,%eax
+  80319f:	0f 88 db 00 00 00    	js     803280 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031a5:	83 ec 04             	sub    $0x4,%esp
+  8031a8:	68 07 04 00 00       	push   $0x407
+  8031ad:	ff 75 f0             	push   -0x10(%ebp)
+  8031b0:	6a 00                	push   $0x0
+  8031b2:	e8 b8 db ff ff       	call   800d6f <sys_page_alloc>
+  8031b7:	89 c3                	mov    %eax,%ebx
+  8031b9:	83 c4 10             	add    $0x10,%esp
+  8031bc:	85 c0                	test   %eax,%eax
+  8031be:	0f 88 bc 00 00 00    	js     803280 <pipe+0x131>
+	va = fd2data(fd0);
+  8031c4:	83 ec 0c             	sub    $0xc,%esp
+  8031c7:	ff 75 f4             	push   -0xc(%ebp)
+  8031ca:	e8 c6 e2 ff ff       	call   801495 <fd2data>
+  8031cf:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031d1:	83 c4 0c             	add    $0xc,%esp
+  8031d4:	68 07 04 00 00       	push   $0x407
+  8031d9:	50                   	push   %eax
+  8031da:	6a 00                	push   $0x0
+  8031dc:	e8 8e db ff ff       	call   800d6f <sys_page_alloc>
+  8031e1:	89 c3                	mov    %eax,%ebx
+  8031e3:	83 c4 10             	add    $0x10,%esp
+  8031e6:	85 c0                	test   %eax,%eax
+  8031e8:	0f 88 82 00 00 00    	js     803270 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031ee:	83 ec 0c             	sub    $0xc,%esp
+  8031f1:	ff 75 f0             	push   -0x10(%ebp)
+  8031f4:	e8 9c e2 ff ff       	call   801495 <fd2data>
+  8031f9:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803200:	50                   	push   %eax
+  803201:	6a 00                	push   $0x0
+  803203:	56                   	push   %esi
+  803204:	6a 00                	push   $0x0
+  803206:	e8 af db ff ff       	call   800dba <sys_page_map>
+  80320b:	89 c3                	mov    %eax,%ebx
+  80320d:	83 c4 20             	add    $0x20,%esp
+  803210:	85 c0                	test   %eax,%eax
+  803212:	78 4e                	js     803262 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803214:	a1 60 50 80 00       	mov    0x805060,%eax
+  803219:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80321c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80321e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803221:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803228:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80322b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80322d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803230:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803237:	83 ec 0c             	sub    $0xc,%esp
+  80323a:	ff 75 f4             	push   -0xc(%ebp)
+  80323d:	e8 43 e2 ff ff       	call   801485 <fd2num>
+  803242:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803245:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803247:	83 c4 04             	add    $0x4,%esp
+  80324a:	ff 75 f0             	push   -0x10(%ebp)
+  80324d:	e8 33 e2 ff ff       	call   801485 <fd2num>
+  803252:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803255:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803258:	83 c4 10             	add    $0x10,%esp
+  80325b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803260:	eb 2e                	jmp    803290 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803262:	83 ec 08             	sub    $0x8,%esp
+  803265:	56                   	push   %esi
+  803266:	6a 00                	push   $0x0
+  803268:	e8 8f db ff ff       	call   800dfc <sys_page_unmap>
+  80326d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803270:	83 ec 08             	sub    $0x8,%esp
+  803273:	ff 75 f0             	push   -0x10(%ebp)
+  803276:	6a 00                	push   $0x0
+  803278:	e8 7f db ff ff       	call   800dfc <sys_page_unmap>
+  80327d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803280:	83 ec 08             	sub    $0x8,%esp
+  803283:	ff 75 f4             	push   -0xc(%ebp)
+  803286:	6a 00                	push   $0x0
+  803288:	e8 6f db ff ff       	call   800dfc <sys_page_unmap>
+  80328d:	83 c4 10             	add    $0x10,%esp
+}
+  803290:	89 d8                	mov    %ebx,%eax
+  803292:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803295:	5b                   	pop    %ebx
+  803296:	5e                   	pop    %esi
+  803297:	5d                   	pop    %ebp
+  803298:	c3                   	ret
+
+00803299 <pipeisclosed>:
+{
+  803299:	55                   	push   %ebp
+  80329a:	89 e5                	mov    %esp,%ebp
+  80329c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80329f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032a2:	50                   	push   %eax
+  8032a3:	ff 75 08             	push   0x8(%ebp)
+  8032a6:	e8 57 e2 ff ff       	call   801502 <fd_lookup>
+  8032ab:	83 c4 10             	add    $0x10,%esp
+  8032ae:	85 c0                	test   %eax,%eax
+  8032b0:	78 18                	js     8032ca <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8032b2:	83 ec 0c             	sub    $0xc,%esp
+  8032b5:	ff 75 f4             	push   -0xc(%ebp)
+  8032b8:	e8 d8 e1 ff ff       	call   801495 <fd2data>
+  8032bd:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8032bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032c2:	e8 33 fd ff ff       	call   802ffa <_pipeisclosed>
+  8032c7:	83 c4 10             	add    $0x10,%esp
+}
+  8032ca:	c9                   	leave
+  8032cb:	c3                   	ret
+
+008032cc <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8032cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d1:	c3                   	ret
+
+008032d2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8032d2:	55                   	push   %ebp
+  8032d3:	89 e5                	mov    %esp,%ebp
+  8032d5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8032d8:	68 64 3f 80 00       	push   $0x803f64
+  8032dd:	ff 75 0c             	push   0xc(%ebp)
+  8032e0:	e8 7e d6 ff ff       	call   800963 <strcpy>
+	return 0;
+}
+  8032e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ea:	c9                   	leave
+  8032eb:	c3                   	ret
+
+008032ec <devcons_write>:
+{
+  8032ec:	55                   	push   %ebp
+  8032ed:	89 e5                	mov    %esp,%ebp
+  8032ef:	57                   	push   %edi
+  8032f0:	56                   	push   %esi
+  8032f1:	53                   	push   %ebx
+  8032f2:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8032f8:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8032fd:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803303:	eb 2e                	jmp    803333 <devcons_write+0x47>
+		m = n - tot;
+  803305:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803308:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80330a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80330f:	39 c3                	cmp    %eax,%ebx
+  803311:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803314:	83 ec 04             	sub    $0x4,%esp
+  803317:	53                   	push   %ebx
+  803318:	89 f0                	mov    %esi,%eax
+  80331a:	03 45 0c             	add    0xc(%ebp),%eax
+  80331d:	50                   	push   %eax
+  80331e:	57                   	push   %edi
+  80331f:	e8 c5 d7 ff ff       	call   800ae9 <memmove>
+		sys_cputs(buf, m);
+  803324:	83 c4 08             	add    $0x8,%esp
+  803327:	53                   	push   %ebx
+  803328:	57                   	push   %edi
+  803329:	e8 65 d9 ff ff       	call   800c93 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80332e:	01 de                	add    %ebx,%esi
+  803330:	83 c4 10             	add    $0x10,%esp
+  803333:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803336:	72 cd                	jb     803305 <devcons_write+0x19>
+}
+  803338:	89 f0                	mov    %esi,%eax
+  80333a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80333d:	5b                   	pop    %ebx
+  80333e:	5e                   	pop    %esi
+  80333f:	5f                   	pop    %edi
+  803340:	5d                   	pop    %ebp
+  803341:	c3                   	ret
+
+00803342 <devcons_read>:
+{
+  803342:	55                   	push   %ebp
+  803343:	89 e5                	mov    %esp,%ebp
+  803345:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803348:	b8 00 00 00 00       	mov    $0x0,%eax
+  80334d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803351:	75 07                	jne    80335a <devcons_read+0x18>
+  803353:	eb 1f                	jmp    803374 <devcons_read+0x32>
+		sys_yield();
+  803355:	e8 f6 d9 ff ff       	call   800d50 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80335a:	e8 5a d9 ff ff       	call   800cb9 <sys_cgetc>
+  80335f:	85 c0                	test   %eax,%eax
+  803361:	74 f2                	je     803355 <devcons_read+0x13>
+	if (c < 0)
+  803363:	78 0f                	js     803374 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803365:	83 f8 04             	cmp    $0x4,%eax
+  803368:	74 0c                	je     803376 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80336a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80336d:	88 02                	mov    %al,(%edx)
+	return 1;
+  80336f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803374:	c9                   	leave
+  803375:	c3                   	ret
+		return 0;
+  803376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80337b:	eb f7                	jmp    803374 <devcons_read+0x32>
+
+0080337d <cputchar>:
+{
+  80337d:	55                   	push   %ebp
+  80337e:	89 e5                	mov    %esp,%ebp
+  803380:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803383:	8b 45 08             	mov    0x8(%ebp),%eax
+  803386:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803389:	6a 01                	push   $0x1
+  80338b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80338e:	50                   	push   %eax
+  80338f:	e8 ff d8 ff ff       	call   800c93 <sys_cputs>
+}
+  803394:	83 c4 10             	add    $0x10,%esp
+  803397:	c9                   	leave
+  803398:	c3                   	ret
+
+00803399 <getchar>:
+{
+  803399:	55                   	push   %ebp
+  80339a:	89 e5                	mov    %esp,%ebp
+  80339c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80339f:	6a 01                	push   $0x1
+  8033a1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033a4:	50                   	push   %eax
+  8033a5:	6a 00                	push   $0x0
+  8033a7:	e8 bc e3 ff ff       	call   801768 <read>
+	if (r < 0)
+  8033ac:	83 c4 10             	add    $0x10,%esp
+  8033af:	85 c0                	test   %eax,%eax
+  8033b1:	78 06                	js     8033b9 <getchar+0x20>
+	if (r < 1)
+  8033b3:	74 06                	je     8033bb <getchar+0x22>
+	return c;
+  8033b5:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8033b9:	c9                   	leave
+  8033ba:	c3                   	ret
+		return -E_EOF;
+  8033bb:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8033c0:	eb f7                	jmp    8033b9 <getchar+0x20>
+
+008033c2 <iscons>:
+{
+  8033c2:	55                   	push   %ebp
+  8033c3:	89 e5                	mov    %esp,%ebp
+  8033c5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033cb:	50                   	push   %eax
+  8033cc:	ff 75 08             	push   0x8(%ebp)
+  8033cf:	e8 2e e1 ff ff       	call   801502 <fd_lookup>
+  8033d4:	83 c4 10             	add    $0x10,%esp
+  8033d7:	85 c0                	test   %eax,%eax
+  8033d9:	78 11                	js     8033ec <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8033db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033de:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8033e4:	39 10                	cmp    %edx,(%eax)
+  8033e6:	0f 94 c0             	sete   %al
+  8033e9:	0f b6 c0             	movzbl %al,%eax
+}
+  8033ec:	c9                   	leave
+  8033ed:	c3                   	ret
+
+008033ee <opencons>:
+{
+  8033ee:	55                   	push   %ebp
+  8033ef:	89 e5                	mov    %esp,%ebp
+  8033f1:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8033f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033f7:	50                   	push   %eax
+  8033f8:	e8 af e0 ff ff       	call   8014ac <fd_alloc>
+  8033fd:	83 c4 10             	add    $0x10,%esp
+  803400:	85 c0                	test   %eax,%eax
+  803402:	78 3a                	js     80343e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803404:	83 ec 04             	sub    $0x4,%esp
+  803407:	68 07 04 00 00       	push   $0x407
+  80340c:	ff 75 f4             	push   -0xc(%ebp)
+  80340f:	6a 00                	push   $0x0
+  803411:	e8 59 d9 ff ff       	call   800d6f <sys_page_alloc>
+  803416:	83 c4 10             	add    $0x10,%esp
+  803419:	85 c0                	test   %eax,%eax
+  80341b:	78 21                	js     80343e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80341d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803420:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803426:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803428:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80342b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803432:	83 ec 0c             	sub    $0xc,%esp
+  803435:	50                   	push   %eax
+  803436:	e8 4a e0 ff ff       	call   801485 <fd2num>
+  80343b:	83 c4 10             	add    $0x10,%esp
+}
+  80343e:	c9                   	leave
+  80343f:	c3                   	ret
+
+00803440 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803440:	55                   	push   %ebp
+  803441:	89 e5                	mov    %esp,%ebp
+  803443:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803446:	83 3d 04 a0 80 00 00 	cmpl   $0x0,0x80a004
+  80344d:	74 0a                	je     803459 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80344f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803452:	a3 04 a0 80 00       	mov    %eax,0x80a004
+}
+  803457:	c9                   	leave
+  803458:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803459:	83 ec 04             	sub    $0x4,%esp
+  80345c:	6a 07                	push   $0x7
+  80345e:	68 00 f0 bf ee       	push   $0xeebff000
+  803463:	6a 00                	push   $0x0
+  803465:	e8 05 d9 ff ff       	call   800d6f <sys_page_alloc>
+  80346a:	83 c4 10             	add    $0x10,%esp
+  80346d:	85 c0                	test   %eax,%eax
+  80346f:	75 2c                	jne    80349d <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803471:	83 ec 08             	sub    $0x8,%esp
+  803474:	68 b3 34 80 00       	push   $0x8034b3
+  803479:	6a 00                	push   $0x0
+  80347b:	e8 5a da ff ff       	call   800eda <sys_env_set_pgfault_upcall>
+  803480:	83 c4 10             	add    $0x10,%esp
+  803483:	85 c0                	test   %eax,%eax
+  803485:	74 c8                	je     80344f <set_pgfault_handler+0xf>
+  803487:	68 b8 3f 80 00       	push   $0x803fb8
+  80348c:	68 ec 3d 80 00       	push   $0x803dec
+  803491:	6a 20                	push   $0x20
+  803493:	68 e8 3f 80 00       	push   $0x803fe8
+  803498:	e8 fd cd ff ff       	call   80029a <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80349d:	68 70 3f 80 00       	push   $0x803f70
+  8034a2:	68 ec 3d 80 00       	push   $0x803dec
+  8034a7:	6a 1e                	push   $0x1e
+  8034a9:	68 e8 3f 80 00       	push   $0x803fe8
+  8034ae:	e8 e7 cd ff ff       	call   80029a <_panic>
+
+008034b3 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8034b3:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8034b4:	a1 04 a0 80 00       	mov    0x80a004,%eax
+	call *%eax
+  8034b9:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8034bb:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8034be:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8034c3:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8034c8:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8034cc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8034cf:	83 c4 08             	add    $0x8,%esp
+	popal
+  8034d2:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8034d3:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8034d6:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8034d7:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8034d8:	c3                   	ret
+
+008034d9 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8034d9:	55                   	push   %ebp
+  8034da:	89 e5                	mov    %esp,%ebp
+  8034dc:	56                   	push   %esi
+  8034dd:	53                   	push   %ebx
+  8034de:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8034e7:	85 c0                	test   %eax,%eax
+  8034e9:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8034ee:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8034f1:	83 ec 0c             	sub    $0xc,%esp
+  8034f4:	50                   	push   %eax
+  8034f5:	e8 bd da ff ff       	call   800fb7 <sys_ipc_recv>
+	if (from_env_store)
+  8034fa:	83 c4 10             	add    $0x10,%esp
+  8034fd:	85 f6                	test   %esi,%esi
+  8034ff:	74 14                	je     803515 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803501:	ba 00 00 00 00       	mov    $0x0,%edx
+  803506:	85 c0                	test   %eax,%eax
+  803508:	75 09                	jne    803513 <ipc_recv+0x3a>
+  80350a:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803510:	8b 52 74             	mov    0x74(%edx),%edx
+  803513:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803515:	85 db                	test   %ebx,%ebx
+  803517:	74 25                	je     80353e <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803519:	85 c0                	test   %eax,%eax
+  80351b:	74 0d                	je     80352a <ipc_recv+0x51>
+  80351d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803523:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803526:	5b                   	pop    %ebx
+  803527:	5e                   	pop    %esi
+  803528:	5d                   	pop    %ebp
+  803529:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80352a:	a1 00 60 80 00       	mov    0x806000,%eax
+  80352f:	8b 40 78             	mov    0x78(%eax),%eax
+  803532:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803534:	a1 00 60 80 00       	mov    0x806000,%eax
+  803539:	8b 40 70             	mov    0x70(%eax),%eax
+  80353c:	eb e5                	jmp    803523 <ipc_recv+0x4a>
+  80353e:	85 c0                	test   %eax,%eax
+  803540:	75 e1                	jne    803523 <ipc_recv+0x4a>
+  803542:	eb f0                	jmp    803534 <ipc_recv+0x5b>
+
+00803544 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803544:	55                   	push   %ebp
+  803545:	89 e5                	mov    %esp,%ebp
+  803547:	57                   	push   %edi
+  803548:	56                   	push   %esi
+  803549:	53                   	push   %ebx
+  80354a:	83 ec 0c             	sub    $0xc,%esp
+  80354d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803550:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803553:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803556:	85 db                	test   %ebx,%ebx
+  803558:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80355d:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803560:	ff 75 14             	push   0x14(%ebp)
+  803563:	53                   	push   %ebx
+  803564:	56                   	push   %esi
+  803565:	57                   	push   %edi
+  803566:	e8 b9 d9 ff ff       	call   800f24 <sys_ipc_try_send>
+  80356b:	83 c4 10             	add    $0x10,%esp
+  80356e:	85 c0                	test   %eax,%eax
+  803570:	74 22                	je     803594 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803572:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803575:	75 07                	jne    80357e <ipc_send+0x3a>
+		sys_yield();
+  803577:	e8 d4 d7 ff ff       	call   800d50 <sys_yield>
+  80357c:	eb e2                	jmp    803560 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80357e:	68 f6 3f 80 00       	push   $0x803ff6
+  803583:	68 ec 3d 80 00       	push   $0x803dec
+  803588:	6a 39                	push   $0x39
+  80358a:	68 0b 40 80 00       	push   $0x80400b
+  80358f:	e8 06 cd ff ff       	call   80029a <_panic>
+	}
+}
+  803594:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803597:	5b                   	pop    %ebx
+  803598:	5e                   	pop    %esi
+  803599:	5f                   	pop    %edi
+  80359a:	5d                   	pop    %ebp
+  80359b:	c3                   	ret
+
+0080359c <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80359c:	55                   	push   %ebp
+  80359d:	89 e5                	mov    %esp,%ebp
+  80359f:	57                   	push   %edi
+  8035a0:	56                   	push   %esi
+  8035a1:	53                   	push   %ebx
+  8035a2:	83 ec 10             	sub    $0x10,%esp
+  8035a5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8035ae:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8035b1:	85 c0                	test   %eax,%eax
+  8035b3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8035b8:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8035bb:	6a 00                	push   $0x0
+  8035bd:	ff 33                	push   (%ebx)
+  8035bf:	50                   	push   %eax
+  8035c0:	e8 af d9 ff ff       	call   800f74 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8035c5:	83 c4 10             	add    $0x10,%esp
+  8035c8:	85 c0                	test   %eax,%eax
+  8035ca:	75 3c                	jne    803608 <ipc_recvv+0x6c>
+  8035cc:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8035d2:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8035d5:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8035d7:	85 ff                	test   %edi,%edi
+  8035d9:	74 4e                	je     803629 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8035db:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8035e1:	8b 52 74             	mov    0x74(%edx),%edx
+  8035e4:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8035e6:	85 f6                	test   %esi,%esi
+  8035e8:	74 18                	je     803602 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8035ea:	85 c0                	test   %eax,%eax
+  8035ec:	75 2d                	jne    80361b <ipc_recvv+0x7f>
+  8035ee:	a1 00 60 80 00       	mov    0x806000,%eax
+  8035f3:	8b 40 78             	mov    0x78(%eax),%eax
+  8035f6:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8035f8:	a1 00 60 80 00       	mov    0x806000,%eax
+  8035fd:	8b 40 70             	mov    0x70(%eax),%eax
+  803600:	eb 1f                	jmp    803621 <ipc_recvv+0x85>
+  803602:	85 c0                	test   %eax,%eax
+  803604:	75 1b                	jne    803621 <ipc_recvv+0x85>
+  803606:	eb f0                	jmp    8035f8 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803608:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80360e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803613:	85 ff                	test   %edi,%edi
+  803615:	75 cd                	jne    8035e4 <ipc_recvv+0x48>
+	if (perm_store)
+  803617:	85 f6                	test   %esi,%esi
+  803619:	74 e7                	je     803602 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80361b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803621:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803624:	5b                   	pop    %ebx
+  803625:	5e                   	pop    %esi
+  803626:	5f                   	pop    %edi
+  803627:	5d                   	pop    %ebp
+  803628:	c3                   	ret
+	if (perm_store)
+  803629:	85 f6                	test   %esi,%esi
+  80362b:	75 bd                	jne    8035ea <ipc_recvv+0x4e>
+  80362d:	eb c9                	jmp    8035f8 <ipc_recvv+0x5c>
+
+0080362f <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  80362f:	55                   	push   %ebp
+  803630:	89 e5                	mov    %esp,%ebp
+  803632:	57                   	push   %edi
+  803633:	56                   	push   %esi
+  803634:	53                   	push   %ebx
+  803635:	83 ec 0c             	sub    $0xc,%esp
+  803638:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80363b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80363e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  803641:	ff 75 14             	push   0x14(%ebp)
+  803644:	53                   	push   %ebx
+  803645:	56                   	push   %esi
+  803646:	57                   	push   %edi
+  803647:	e8 00 d9 ff ff       	call   800f4c <sys_ipc_try_sendv>
+  80364c:	83 c4 10             	add    $0x10,%esp
+  80364f:	85 c0                	test   %eax,%eax
+  803651:	74 22                	je     803675 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803653:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803656:	75 07                	jne    80365f <ipc_sendv+0x30>
+		sys_yield();
+  803658:	e8 f3 d6 ff ff       	call   800d50 <sys_yield>
+  80365d:	eb e2                	jmp    803641 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80365f:	68 f6 3f 80 00       	push   $0x803ff6
+  803664:	68 ec 3d 80 00       	push   $0x803dec
+  803669:	6a 5c                	push   $0x5c
+  80366b:	68 0b 40 80 00       	push   $0x80400b
+  803670:	e8 25 cc ff ff       	call   80029a <_panic>
+	}
+}
+  803675:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803678:	5b                   	pop    %ebx
+  803679:	5e                   	pop    %esi
+  80367a:	5f                   	pop    %edi
+  80367b:	5d                   	pop    %ebp
+  80367c:	c3                   	ret
+
+0080367d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80367d:	55                   	push   %ebp
+  80367e:	89 e5                	mov    %esp,%ebp
+  803680:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803683:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803688:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80368e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803694:	8b 52 50             	mov    0x50(%edx),%edx
+  803697:	39 ca                	cmp    %ecx,%edx
+  803699:	74 11                	je     8036ac <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80369b:	83 c0 01             	add    $0x1,%eax
+  80369e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8036a3:	75 e3                	jne    803688 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8036a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036aa:	eb 0e                	jmp    8036ba <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8036ac:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8036b2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8036b7:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8036ba:	5d                   	pop    %ebp
+  8036bb:	c3                   	ret
+
+008036bc <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8036bc:	55                   	push   %ebp
+  8036bd:	89 e5                	mov    %esp,%ebp
+  8036bf:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8036c2:	89 c2                	mov    %eax,%edx
+  8036c4:	c1 ea 16             	shr    $0x16,%edx
+  8036c7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8036ce:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8036d3:	f6 c1 01             	test   $0x1,%cl
+  8036d6:	74 22                	je     8036fa <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8036d8:	c1 e8 0c             	shr    $0xc,%eax
+  8036db:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8036e2:	a8 01                	test   $0x1,%al
+  8036e4:	74 14                	je     8036fa <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8036e6:	c1 e8 0c             	shr    $0xc,%eax
+  8036e9:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8036ec:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8036f3:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8036f7:	0f b7 d2             	movzwl %dx,%edx
+}
+  8036fa:	89 d0                	mov    %edx,%eax
+  8036fc:	5d                   	pop    %ebp
+  8036fd:	c3                   	ret
+
+008036fe <dm>:
+  8036fe:	55                   	push   %ebp
+  8036ff:	57                   	push   %edi
+  803700:	56                   	push   %esi
+  803701:	53                   	push   %ebx
+  803702:	83 ec 24             	sub    $0x24,%esp
+  803705:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803709:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80370d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803711:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803715:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803719:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80371d:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803721:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803726:	b8 00 00 00 00       	mov    $0x0,%eax
+  80372b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803730:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803737:	00 
+  803738:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80373f:	00 
+  803740:	89 fb                	mov    %edi,%ebx
+  803742:	eb 08                	jmp    80374c <dm+0x4e>
+  803744:	83 e9 01             	sub    $0x1,%ecx
+  803747:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80374a:	74 68                	je     8037b4 <dm+0xb6>
+  80374c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803750:	01 c0                	add    %eax,%eax
+  803752:	89 c6                	mov    %eax,%esi
+  803754:	89 d7                	mov    %edx,%edi
+  803756:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80375a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80375e:	0f ad d0             	shrd   %cl,%edx,%eax
+  803761:	d3 ea                	shr    %cl,%edx
+  803763:	f6 c1 20             	test   $0x20,%cl
+  803766:	74 04                	je     80376c <dm+0x6e>
+  803768:	89 d0                	mov    %edx,%eax
+  80376a:	31 d2                	xor    %edx,%edx
+  80376c:	83 e0 01             	and    $0x1,%eax
+  80376f:	89 04 24             	mov    %eax,(%esp)
+  803772:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803779:	00 
+  80377a:	8b 04 24             	mov    (%esp),%eax
+  80377d:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803781:	09 f0                	or     %esi,%eax
+  803783:	09 fa                	or     %edi,%edx
+  803785:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803789:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80378d:	39 f0                	cmp    %esi,%eax
+  80378f:	89 d5                	mov    %edx,%ebp
+  803791:	19 fd                	sbb    %edi,%ebp
+  803793:	72 af                	jb     803744 <dm+0x46>
+  803795:	29 f0                	sub    %esi,%eax
+  803797:	19 fa                	sbb    %edi,%edx
+  803799:	89 cf                	mov    %ecx,%edi
+  80379b:	c1 ef 05             	shr    $0x5,%edi
+  80379e:	83 e7 01             	and    $0x1,%edi
+  8037a1:	89 fe                	mov    %edi,%esi
+  8037a3:	83 f6 01             	xor    $0x1,%esi
+  8037a6:	d3 e6                	shl    %cl,%esi
+  8037a8:	d3 e7                	shl    %cl,%edi
+  8037aa:	09 74 24 18          	or     %esi,0x18(%esp)
+  8037ae:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8037b2:	eb 90                	jmp    803744 <dm+0x46>
+  8037b4:	85 db                	test   %ebx,%ebx
+  8037b6:	74 05                	je     8037bd <dm+0xbf>
+  8037b8:	89 03                	mov    %eax,(%ebx)
+  8037ba:	89 53 04             	mov    %edx,0x4(%ebx)
+  8037bd:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8037c1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8037c5:	83 c4 24             	add    $0x24,%esp
+  8037c8:	5b                   	pop    %ebx
+  8037c9:	5e                   	pop    %esi
+  8037ca:	5f                   	pop    %edi
+  8037cb:	5d                   	pop    %ebp
+  8037cc:	c3                   	ret
+
+008037cd <__udivdi3>:
+  8037cd:	83 ec 08             	sub    $0x8,%esp
+  8037d0:	6a 00                	push   $0x0
+  8037d2:	ff 74 24 1c          	push   0x1c(%esp)
+  8037d6:	ff 74 24 1c          	push   0x1c(%esp)
+  8037da:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8037de:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8037e2:	e8 17 ff ff ff       	call   8036fe <dm>
+  8037e7:	83 c4 14             	add    $0x14,%esp
+  8037ea:	c3                   	ret
+
+008037eb <__umoddi3>:
+  8037eb:	83 ec 18             	sub    $0x18,%esp
+  8037ee:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8037f2:	50                   	push   %eax
+  8037f3:	ff 74 24 2c          	push   0x2c(%esp)
+  8037f7:	ff 74 24 2c          	push   0x2c(%esp)
+  8037fb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037ff:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803803:	e8 f6 fe ff ff       	call   8036fe <dm>
+  803808:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80380c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803810:	83 c4 24             	add    $0x24,%esp
+  803813:	c3                   	ret
+
+00803814 <__divdi3>:
+  803814:	53                   	push   %ebx
+  803815:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803819:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80381d:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803821:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803825:	85 d2                	test   %edx,%edx
+  803827:	78 15                	js     80383e <__divdi3+0x2a>
+  803829:	85 db                	test   %ebx,%ebx
+  80382b:	78 34                	js     803861 <__divdi3+0x4d>
+  80382d:	83 ec 04             	sub    $0x4,%esp
+  803830:	6a 00                	push   $0x0
+  803832:	53                   	push   %ebx
+  803833:	51                   	push   %ecx
+  803834:	e8 c5 fe ff ff       	call   8036fe <dm>
+  803839:	83 c4 10             	add    $0x10,%esp
+  80383c:	eb 21                	jmp    80385f <__divdi3+0x4b>
+  80383e:	f7 d8                	neg    %eax
+  803840:	83 d2 00             	adc    $0x0,%edx
+  803843:	f7 da                	neg    %edx
+  803845:	85 db                	test   %ebx,%ebx
+  803847:	78 30                	js     803879 <__divdi3+0x65>
+  803849:	83 ec 04             	sub    $0x4,%esp
+  80384c:	6a 00                	push   $0x0
+  80384e:	53                   	push   %ebx
+  80384f:	51                   	push   %ecx
+  803850:	e8 a9 fe ff ff       	call   8036fe <dm>
+  803855:	83 c4 10             	add    $0x10,%esp
+  803858:	f7 d8                	neg    %eax
+  80385a:	83 d2 00             	adc    $0x0,%edx
+  80385d:	f7 da                	neg    %edx
+  80385f:	5b                   	pop    %ebx
+  803860:	c3                   	ret
+  803861:	83 ec 04             	sub    $0x4,%esp
+  803864:	6a 00                	push   $0x0
+  803866:	f7 d9                	neg    %ecx
+  803868:	83 d3 00             	adc    $0x0,%ebx
+  80386b:	f7 db                	neg    %ebx
+  80386d:	53                   	push   %ebx
+  80386e:	51                   	push   %ecx
+  80386f:	e8 8a fe ff ff       	call   8036fe <dm>
+  803874:	83 c4 10             	add    $0x10,%esp
+  803877:	eb df                	jmp    803858 <__divdi3+0x44>
+  803879:	83 ec 04             	sub    $0x4,%esp
+  80387c:	6a 00                	push   $0x0
+  80387e:	f7 d9                	neg    %ecx
+  803880:	83 d3 00             	adc    $0x0,%ebx
+  803883:	f7 db                	neg    %ebx
+  803885:	53                   	push   %ebx
+  803886:	51                   	push   %ecx
+  803887:	e8 72 fe ff ff       	call   8036fe <dm>
+  80388c:	83 c4 10             	add    $0x10,%esp
+  80388f:	eb ce                	jmp    80385f <__divdi3+0x4b>
+
+00803891 <__moddi3>:
+  803891:	55                   	push   %ebp
+  803892:	57                   	push   %edi
+  803893:	56                   	push   %esi
+  803894:	53                   	push   %ebx
+  803895:	83 ec 24             	sub    $0x24,%esp
+  803898:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80389c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038a0:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8038a4:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8038a8:	85 d2                	test   %edx,%edx
+  8038aa:	78 3b                	js     8038e7 <__moddi3+0x56>
+  8038ac:	83 ec 04             	sub    $0x4,%esp
+  8038af:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8038b3:	56                   	push   %esi
+  8038b4:	89 ce                	mov    %ecx,%esi
+  8038b6:	f7 de                	neg    %esi
+  8038b8:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8038bc:	89 de                	mov    %ebx,%esi
+  8038be:	83 d6 00             	adc    $0x0,%esi
+  8038c1:	f7 de                	neg    %esi
+  8038c3:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8038c7:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8038cb:	0f 48 f1             	cmovs  %ecx,%esi
+  8038ce:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8038d3:	53                   	push   %ebx
+  8038d4:	56                   	push   %esi
+  8038d5:	e8 24 fe ff ff       	call   8036fe <dm>
+  8038da:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8038de:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038e2:	83 c4 10             	add    $0x10,%esp
+  8038e5:	eb 47                	jmp    80392e <__moddi3+0x9d>
+  8038e7:	f7 d8                	neg    %eax
+  8038e9:	83 d2 00             	adc    $0x0,%edx
+  8038ec:	f7 da                	neg    %edx
+  8038ee:	83 ec 04             	sub    $0x4,%esp
+  8038f1:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8038f5:	56                   	push   %esi
+  8038f6:	89 cf                	mov    %ecx,%edi
+  8038f8:	f7 df                	neg    %edi
+  8038fa:	89 de                	mov    %ebx,%esi
+  8038fc:	83 d6 00             	adc    $0x0,%esi
+  8038ff:	f7 de                	neg    %esi
+  803901:	0f 49 cf             	cmovns %edi,%ecx
+  803904:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803908:	0f 49 de             	cmovns %esi,%ebx
+  80390b:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80390f:	ff 74 24 0c          	push   0xc(%esp)
+  803913:	ff 74 24 0c          	push   0xc(%esp)
+  803917:	e8 e2 fd ff ff       	call   8036fe <dm>
+  80391c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803920:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803924:	f7 d8                	neg    %eax
+  803926:	83 d2 00             	adc    $0x0,%edx
+  803929:	f7 da                	neg    %edx
+  80392b:	83 c4 10             	add    $0x10,%esp
+  80392e:	83 c4 24             	add    $0x24,%esp
+  803931:	5b                   	pop    %ebx
+  803932:	5e                   	pop    %esi
+  803933:	5f                   	pop    %edi
+  803934:	5d                   	pop    %ebp
+  803935:	c3                   	ret
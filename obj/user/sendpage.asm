@@ -0,0 +1,7743 @@
+
+obj/user/sendpage.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 73 01 00 00       	call   8001a4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define TEMP_ADDR	((char*)0xa00000)
+#define TEMP_ADDR_CHILD	((char*)0xb00000)
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 18             	sub    $0x18,%esp
+	envid_t who;
+
+	if ((who = fork()) == 0) {
+  800039:	e8 b3 11 00 00       	call   8011f1 <fork>
+  80003e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800041:	85 c0                	test   %eax,%eax
+  800043:	0f 84 a5 00 00 00    	je     8000ee <umain+0xbb>
+		ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+		return;
+	}
+
+	// Parent
+	sys_page_alloc(thisenv->env_id, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  800049:	a1 00 50 80 00       	mov    0x805000,%eax
+  80004e:	8b 40 48             	mov    0x48(%eax),%eax
+  800051:	83 ec 04             	sub    $0x4,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 a0 00       	push   $0xa00000
+  80005b:	50                   	push   %eax
+  80005c:	e8 35 0c 00 00       	call   800c96 <sys_page_alloc>
+	memcpy(TEMP_ADDR, str1, strlen(str1) + 1);
+  800061:	83 c4 04             	add    $0x4,%esp
+  800064:	ff 35 04 40 80 00    	push   0x804004
+  80006a:	e8 e0 07 00 00       	call   80084f <strlen>
+  80006f:	83 c4 0c             	add    $0xc,%esp
+  800072:	83 c0 01             	add    $0x1,%eax
+  800075:	50                   	push   %eax
+  800076:	ff 35 04 40 80 00    	push   0x804004
+  80007c:	68 00 00 a0 00       	push   $0xa00000
+  800081:	e8 ec 09 00 00       	call   800a72 <memcpy>
+	ipc_send(who, 0, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  800086:	6a 07                	push   $0x7
+  800088:	68 00 00 a0 00       	push   $0xa00000
+  80008d:	6a 00                	push   $0x0
+  80008f:	ff 75 f4             	push   -0xc(%ebp)
+  800092:	e8 80 13 00 00       	call   801417 <ipc_send>
+
+	ipc_recv(&who, TEMP_ADDR, 0);
+  800097:	83 c4 1c             	add    $0x1c,%esp
+  80009a:	6a 00                	push   $0x0
+  80009c:	68 00 00 a0 00       	push   $0xa00000
+  8000a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a4:	50                   	push   %eax
+  8000a5:	e8 02 13 00 00       	call   8013ac <ipc_recv>
+	cprintf("%x got message: %s\n", who, TEMP_ADDR);
+  8000aa:	83 c4 0c             	add    $0xc,%esp
+  8000ad:	68 00 00 a0 00       	push   $0xa00000
+  8000b2:	ff 75 f4             	push   -0xc(%ebp)
+  8000b5:	68 c0 38 80 00       	push   $0x8038c0
+  8000ba:	e8 dd 01 00 00       	call   80029c <cprintf>
+	if (strncmp(TEMP_ADDR, str2, strlen(str2)) == 0)
+  8000bf:	83 c4 04             	add    $0x4,%esp
+  8000c2:	ff 35 00 40 80 00    	push   0x804000
+  8000c8:	e8 82 07 00 00       	call   80084f <strlen>
+  8000cd:	83 c4 0c             	add    $0xc,%esp
+  8000d0:	50                   	push   %eax
+  8000d1:	ff 35 00 40 80 00    	push   0x804000
+  8000d7:	68 00 00 a0 00       	push   $0xa00000
+  8000dc:	e8 80 08 00 00       	call   800961 <strncmp>
+  8000e1:	83 c4 10             	add    $0x10,%esp
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	0f 84 a3 00 00 00    	je     80018f <umain+0x15c>
+		cprintf("parent received correct message\n");
+	return;
+}
+  8000ec:	c9                   	leave
+  8000ed:	c3                   	ret
+		ipc_recv(&who, TEMP_ADDR_CHILD, 0);
+  8000ee:	83 ec 04             	sub    $0x4,%esp
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	68 00 00 b0 00       	push   $0xb00000
+  8000f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000fb:	50                   	push   %eax
+  8000fc:	e8 ab 12 00 00       	call   8013ac <ipc_recv>
+		cprintf("%x got message: %s\n", who, TEMP_ADDR_CHILD);
+  800101:	83 c4 0c             	add    $0xc,%esp
+  800104:	68 00 00 b0 00       	push   $0xb00000
+  800109:	ff 75 f4             	push   -0xc(%ebp)
+  80010c:	68 c0 38 80 00       	push   $0x8038c0
+  800111:	e8 86 01 00 00       	call   80029c <cprintf>
+		if (strncmp(TEMP_ADDR_CHILD, str1, strlen(str1)) == 0)
+  800116:	83 c4 04             	add    $0x4,%esp
+  800119:	ff 35 04 40 80 00    	push   0x804004
+  80011f:	e8 2b 07 00 00       	call   80084f <strlen>
+  800124:	83 c4 0c             	add    $0xc,%esp
+  800127:	50                   	push   %eax
+  800128:	ff 35 04 40 80 00    	push   0x804004
+  80012e:	68 00 00 b0 00       	push   $0xb00000
+  800133:	e8 29 08 00 00       	call   800961 <strncmp>
+  800138:	83 c4 10             	add    $0x10,%esp
+  80013b:	85 c0                	test   %eax,%eax
+  80013d:	74 3e                	je     80017d <umain+0x14a>
+		memcpy(TEMP_ADDR_CHILD, str2, strlen(str2) + 1);
+  80013f:	83 ec 0c             	sub    $0xc,%esp
+  800142:	ff 35 00 40 80 00    	push   0x804000
+  800148:	e8 02 07 00 00       	call   80084f <strlen>
+  80014d:	83 c4 0c             	add    $0xc,%esp
+  800150:	83 c0 01             	add    $0x1,%eax
+  800153:	50                   	push   %eax
+  800154:	ff 35 00 40 80 00    	push   0x804000
+  80015a:	68 00 00 b0 00       	push   $0xb00000
+  80015f:	e8 0e 09 00 00       	call   800a72 <memcpy>
+		ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+  800164:	6a 07                	push   $0x7
+  800166:	68 00 00 b0 00       	push   $0xb00000
+  80016b:	6a 00                	push   $0x0
+  80016d:	ff 75 f4             	push   -0xc(%ebp)
+  800170:	e8 a2 12 00 00       	call   801417 <ipc_send>
+		return;
+  800175:	83 c4 20             	add    $0x20,%esp
+  800178:	e9 6f ff ff ff       	jmp    8000ec <umain+0xb9>
+			cprintf("child received correct message\n");
+  80017d:	83 ec 0c             	sub    $0xc,%esp
+  800180:	68 d4 38 80 00       	push   $0x8038d4
+  800185:	e8 12 01 00 00       	call   80029c <cprintf>
+  80018a:	83 c4 10             	add    $0x10,%esp
+  80018d:	eb b0                	jmp    80013f <umain+0x10c>
+		cprintf("parent received correct message\n");
+  80018f:	83 ec 0c             	sub    $0xc,%esp
+  800192:	68 f4 38 80 00       	push   $0x8038f4
+  800197:	e8 00 01 00 00       	call   80029c <cprintf>
+  80019c:	83 c4 10             	add    $0x10,%esp
+  80019f:	e9 48 ff ff ff       	jmp    8000ec <umain+0xb9>
+
+008001a4 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001a4:	55                   	push   %ebp
+  8001a5:	89 e5                	mov    %esp,%ebp
+  8001a7:	56                   	push   %esi
+  8001a8:	53                   	push   %ebx
+  8001a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001af:	e8 9c 0a 00 00       	call   800c50 <sys_getenvid>
+  8001b4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001b9:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8001bf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001c4:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001c9:	85 db                	test   %ebx,%ebx
+  8001cb:	7e 07                	jle    8001d4 <libmain+0x30>
+		binaryname = argv[0];
+  8001cd:	8b 06                	mov    (%esi),%eax
+  8001cf:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// call user main routine
+	umain(argc, argv);
+  8001d4:	83 ec 08             	sub    $0x8,%esp
+  8001d7:	56                   	push   %esi
+  8001d8:	53                   	push   %ebx
+  8001d9:	e8 55 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8001de:	e8 0a 00 00 00       	call   8001ed <exit>
+}
+  8001e3:	83 c4 10             	add    $0x10,%esp
+  8001e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001e9:	5b                   	pop    %ebx
+  8001ea:	5e                   	pop    %esi
+  8001eb:	5d                   	pop    %ebp
+  8001ec:	c3                   	ret
+
+008001ed <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001ed:	55                   	push   %ebp
+  8001ee:	89 e5                	mov    %esp,%ebp
+  8001f0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001f3:	e8 6b 15 00 00       	call   801763 <close_all>
+	sys_env_destroy(0);
+  8001f8:	83 ec 0c             	sub    $0xc,%esp
+  8001fb:	6a 00                	push   $0x0
+  8001fd:	e8 05 0a 00 00       	call   800c07 <sys_env_destroy>
+}
+  800202:	83 c4 10             	add    $0x10,%esp
+  800205:	c9                   	leave
+  800206:	c3                   	ret
+
+00800207 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800207:	55                   	push   %ebp
+  800208:	89 e5                	mov    %esp,%ebp
+  80020a:	53                   	push   %ebx
+  80020b:	83 ec 04             	sub    $0x4,%esp
+  80020e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800211:	8b 13                	mov    (%ebx),%edx
+  800213:	8d 42 01             	lea    0x1(%edx),%eax
+  800216:	89 03                	mov    %eax,(%ebx)
+  800218:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80021b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80021f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800224:	74 09                	je     80022f <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800226:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80022a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80022d:	c9                   	leave
+  80022e:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80022f:	83 ec 08             	sub    $0x8,%esp
+  800232:	68 ff 00 00 00       	push   $0xff
+  800237:	8d 43 08             	lea    0x8(%ebx),%eax
+  80023a:	50                   	push   %eax
+  80023b:	e8 7a 09 00 00       	call   800bba <sys_cputs>
+		b->idx = 0;
+  800240:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800246:	83 c4 10             	add    $0x10,%esp
+  800249:	eb db                	jmp    800226 <putch+0x1f>
+
+0080024b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80024b:	55                   	push   %ebp
+  80024c:	89 e5                	mov    %esp,%ebp
+  80024e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800254:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80025b:	00 00 00 
+	b.cnt = 0;
+  80025e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800265:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800268:	ff 75 0c             	push   0xc(%ebp)
+  80026b:	ff 75 08             	push   0x8(%ebp)
+  80026e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800274:	50                   	push   %eax
+  800275:	68 07 02 80 00       	push   $0x800207
+  80027a:	e8 14 01 00 00       	call   800393 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80027f:	83 c4 08             	add    $0x8,%esp
+  800282:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800288:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80028e:	50                   	push   %eax
+  80028f:	e8 26 09 00 00       	call   800bba <sys_cputs>
+
+	return b.cnt;
+}
+  800294:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80029a:	c9                   	leave
+  80029b:	c3                   	ret
+
+0080029c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80029c:	55                   	push   %ebp
+  80029d:	89 e5                	mov    %esp,%ebp
+  80029f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002a2:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002a5:	50                   	push   %eax
+  8002a6:	ff 75 08             	push   0x8(%ebp)
+  8002a9:	e8 9d ff ff ff       	call   80024b <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002ae:	c9                   	leave
+  8002af:	c3                   	ret
+
+008002b0 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002b0:	55                   	push   %ebp
+  8002b1:	89 e5                	mov    %esp,%ebp
+  8002b3:	57                   	push   %edi
+  8002b4:	56                   	push   %esi
+  8002b5:	53                   	push   %ebx
+  8002b6:	83 ec 1c             	sub    $0x1c,%esp
+  8002b9:	89 c7                	mov    %eax,%edi
+  8002bb:	89 d6                	mov    %edx,%esi
+  8002bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002c3:	89 d1                	mov    %edx,%ecx
+  8002c5:	89 c2                	mov    %eax,%edx
+  8002c7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002ca:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002cd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002d0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002d6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002dd:	39 c2                	cmp    %eax,%edx
+  8002df:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002e2:	72 3e                	jb     800322 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002e4:	83 ec 0c             	sub    $0xc,%esp
+  8002e7:	ff 75 18             	push   0x18(%ebp)
+  8002ea:	83 eb 01             	sub    $0x1,%ebx
+  8002ed:	53                   	push   %ebx
+  8002ee:	50                   	push   %eax
+  8002ef:	83 ec 08             	sub    $0x8,%esp
+  8002f2:	ff 75 e4             	push   -0x1c(%ebp)
+  8002f5:	ff 75 e0             	push   -0x20(%ebp)
+  8002f8:	ff 75 dc             	push   -0x24(%ebp)
+  8002fb:	ff 75 d8             	push   -0x28(%ebp)
+  8002fe:	e8 37 34 00 00       	call   80373a <__udivdi3>
+  800303:	83 c4 18             	add    $0x18,%esp
+  800306:	52                   	push   %edx
+  800307:	50                   	push   %eax
+  800308:	89 f2                	mov    %esi,%edx
+  80030a:	89 f8                	mov    %edi,%eax
+  80030c:	e8 9f ff ff ff       	call   8002b0 <printnum>
+  800311:	83 c4 20             	add    $0x20,%esp
+  800314:	eb 13                	jmp    800329 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800316:	83 ec 08             	sub    $0x8,%esp
+  800319:	56                   	push   %esi
+  80031a:	ff 75 18             	push   0x18(%ebp)
+  80031d:	ff d7                	call   *%edi
+  80031f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800322:	83 eb 01             	sub    $0x1,%ebx
+  800325:	85 db                	test   %ebx,%ebx
+  800327:	7f ed                	jg     800316 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800329:	83 ec 08             	sub    $0x8,%esp
+  80032c:	56                   	push   %esi
+  80032d:	83 ec 04             	sub    $0x4,%esp
+  800330:	ff 75 e4             	push   -0x1c(%ebp)
+  800333:	ff 75 e0             	push   -0x20(%ebp)
+  800336:	ff 75 dc             	push   -0x24(%ebp)
+  800339:	ff 75 d8             	push   -0x28(%ebp)
+  80033c:	e8 17 34 00 00       	call   803758 <__umoddi3>
+  800341:	83 c4 14             	add    $0x14,%esp
+  800344:	0f be 80 6c 39 80 00 	movsbl 0x80396c(%eax),%eax
+  80034b:	50                   	push   %eax
+  80034c:	ff d7                	call   *%edi
+}
+  80034e:	83 c4 10             	add    $0x10,%esp
+  800351:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800354:	5b                   	pop    %ebx
+  800355:	5e                   	pop    %esi
+  800356:	5f                   	pop    %edi
+  800357:	5d                   	pop    %ebp
+  800358:	c3                   	ret
+
+00800359 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800359:	55                   	push   %ebp
+  80035a:	89 e5                	mov    %esp,%ebp
+  80035c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80035f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800363:	8b 10                	mov    (%eax),%edx
+  800365:	3b 50 04             	cmp    0x4(%eax),%edx
+  800368:	73 0a                	jae    800374 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80036a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80036d:	89 08                	mov    %ecx,(%eax)
+  80036f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800372:	88 02                	mov    %al,(%edx)
+}
+  800374:	5d                   	pop    %ebp
+  800375:	c3                   	ret
+
+00800376 <printfmt>:
+{
+  800376:	55                   	push   %ebp
+  800377:	89 e5                	mov    %esp,%ebp
+  800379:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80037c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80037f:	50                   	push   %eax
+  800380:	ff 75 10             	push   0x10(%ebp)
+  800383:	ff 75 0c             	push   0xc(%ebp)
+  800386:	ff 75 08             	push   0x8(%ebp)
+  800389:	e8 05 00 00 00       	call   800393 <vprintfmt>
+}
+  80038e:	83 c4 10             	add    $0x10,%esp
+  800391:	c9                   	leave
+  800392:	c3                   	ret
+
+00800393 <vprintfmt>:
+{
+  800393:	55                   	push   %ebp
+  800394:	89 e5                	mov    %esp,%ebp
+  800396:	57                   	push   %edi
+  800397:	56                   	push   %esi
+  800398:	53                   	push   %ebx
+  800399:	83 ec 2c             	sub    $0x2c,%esp
+  80039c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80039f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003a2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003a5:	eb 0a                	jmp    8003b1 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003a7:	83 ec 08             	sub    $0x8,%esp
+  8003aa:	53                   	push   %ebx
+  8003ab:	50                   	push   %eax
+  8003ac:	ff d6                	call   *%esi
+  8003ae:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003b1:	83 c7 01             	add    $0x1,%edi
+  8003b4:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003b8:	83 f8 25             	cmp    $0x25,%eax
+  8003bb:	74 0c                	je     8003c9 <vprintfmt+0x36>
+			if (ch == '\0')
+  8003bd:	85 c0                	test   %eax,%eax
+  8003bf:	75 e6                	jne    8003a7 <vprintfmt+0x14>
+}
+  8003c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c4:	5b                   	pop    %ebx
+  8003c5:	5e                   	pop    %esi
+  8003c6:	5f                   	pop    %edi
+  8003c7:	5d                   	pop    %ebp
+  8003c8:	c3                   	ret
+		padc = ' ';
+  8003c9:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8003cd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003d4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003db:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e7:	8d 47 01             	lea    0x1(%edi),%eax
+  8003ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ed:	0f b6 17             	movzbl (%edi),%edx
+  8003f0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003f3:	3c 55                	cmp    $0x55,%al
+  8003f5:	0f 87 cf 03 00 00    	ja     8007ca <vprintfmt+0x437>
+  8003fb:	0f b6 c0             	movzbl %al,%eax
+  8003fe:	ff 24 85 c0 3a 80 00 	jmp    *0x803ac0(,%eax,4)
+  800405:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800408:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80040c:	eb d9                	jmp    8003e7 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80040e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800411:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800415:	eb d0                	jmp    8003e7 <vprintfmt+0x54>
+  800417:	0f b6 d2             	movzbl %dl,%edx
+  80041a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80041d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800422:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800425:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800428:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80042c:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80042f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800432:	83 f9 09             	cmp    $0x9,%ecx
+  800435:	77 55                	ja     80048c <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800437:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80043a:	eb e9                	jmp    800425 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80043c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043f:	8b 00                	mov    (%eax),%eax
+  800441:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800444:	8b 45 14             	mov    0x14(%ebp),%eax
+  800447:	8d 40 04             	lea    0x4(%eax),%eax
+  80044a:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80044d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800450:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800454:	79 91                	jns    8003e7 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800456:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800459:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80045c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800463:	eb 82                	jmp    8003e7 <vprintfmt+0x54>
+			if (width < 0)
+  800465:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800468:	85 d2                	test   %edx,%edx
+  80046a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046f:	0f 49 c2             	cmovns %edx,%eax
+  800472:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800475:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800478:	e9 6a ff ff ff       	jmp    8003e7 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800480:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800487:	e9 5b ff ff ff       	jmp    8003e7 <vprintfmt+0x54>
+  80048c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80048f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800492:	eb bc                	jmp    800450 <vprintfmt+0xbd>
+			lflag++;
+  800494:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800497:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80049a:	e9 48 ff ff ff       	jmp    8003e7 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80049f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a2:	8d 78 04             	lea    0x4(%eax),%edi
+  8004a5:	83 ec 08             	sub    $0x8,%esp
+  8004a8:	53                   	push   %ebx
+  8004a9:	ff 30                	push   (%eax)
+  8004ab:	ff d6                	call   *%esi
+			break;
+  8004ad:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004b0:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004b3:	e9 b1 02 00 00       	jmp    800769 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8004b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bb:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004be:	8b 10                	mov    (%eax),%edx
+  8004c0:	89 d0                	mov    %edx,%eax
+  8004c2:	f7 d8                	neg    %eax
+  8004c4:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004c7:	83 f8 11             	cmp    $0x11,%eax
+  8004ca:	7f 23                	jg     8004ef <vprintfmt+0x15c>
+  8004cc:	8b 14 85 20 3c 80 00 	mov    0x803c20(,%eax,4),%edx
+  8004d3:	85 d2                	test   %edx,%edx
+  8004d5:	74 18                	je     8004ef <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8004d7:	52                   	push   %edx
+  8004d8:	68 3e 3d 80 00       	push   $0x803d3e
+  8004dd:	53                   	push   %ebx
+  8004de:	56                   	push   %esi
+  8004df:	e8 92 fe ff ff       	call   800376 <printfmt>
+  8004e4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004e7:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004ea:	e9 7a 02 00 00       	jmp    800769 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8004ef:	50                   	push   %eax
+  8004f0:	68 84 39 80 00       	push   $0x803984
+  8004f5:	53                   	push   %ebx
+  8004f6:	56                   	push   %esi
+  8004f7:	e8 7a fe ff ff       	call   800376 <printfmt>
+  8004fc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004ff:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800502:	e9 62 02 00 00       	jmp    800769 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800507:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050a:	83 c0 04             	add    $0x4,%eax
+  80050d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800510:	8b 45 14             	mov    0x14(%ebp),%eax
+  800513:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800515:	85 c9                	test   %ecx,%ecx
+  800517:	b8 7d 39 80 00       	mov    $0x80397d,%eax
+  80051c:	0f 45 c1             	cmovne %ecx,%eax
+  80051f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800522:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800526:	7e 06                	jle    80052e <vprintfmt+0x19b>
+  800528:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80052c:	75 0b                	jne    800539 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80052e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800531:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800534:	89 75 08             	mov    %esi,0x8(%ebp)
+  800537:	eb 5c                	jmp    800595 <vprintfmt+0x202>
+  800539:	83 ec 08             	sub    $0x8,%esp
+  80053c:	ff 75 d0             	push   -0x30(%ebp)
+  80053f:	ff 75 cc             	push   -0x34(%ebp)
+  800542:	e8 20 03 00 00       	call   800867 <strnlen>
+  800547:	89 c2                	mov    %eax,%edx
+  800549:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80054c:	29 d0                	sub    %edx,%eax
+  80054e:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800551:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800555:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800558:	89 75 08             	mov    %esi,0x8(%ebp)
+  80055b:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80055d:	eb 0e                	jmp    80056d <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80055f:	83 ec 08             	sub    $0x8,%esp
+  800562:	53                   	push   %ebx
+  800563:	57                   	push   %edi
+  800564:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800567:	83 ee 01             	sub    $0x1,%esi
+  80056a:	83 c4 10             	add    $0x10,%esp
+  80056d:	85 f6                	test   %esi,%esi
+  80056f:	7f ee                	jg     80055f <vprintfmt+0x1cc>
+  800571:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800574:	8b 75 08             	mov    0x8(%ebp),%esi
+  800577:	85 c0                	test   %eax,%eax
+  800579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80057e:	0f 49 d0             	cmovns %eax,%edx
+  800581:	29 d0                	sub    %edx,%eax
+  800583:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800586:	eb a6                	jmp    80052e <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800588:	83 ec 08             	sub    $0x8,%esp
+  80058b:	53                   	push   %ebx
+  80058c:	52                   	push   %edx
+  80058d:	ff 55 08             	call   *0x8(%ebp)
+  800590:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800593:	89 f1                	mov    %esi,%ecx
+  800595:	8d 71 01             	lea    0x1(%ecx),%esi
+  800598:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80059c:	0f be d0             	movsbl %al,%edx
+  80059f:	85 d2                	test   %edx,%edx
+  8005a1:	74 28                	je     8005cb <vprintfmt+0x238>
+  8005a3:	85 ff                	test   %edi,%edi
+  8005a5:	78 05                	js     8005ac <vprintfmt+0x219>
+  8005a7:	83 ef 01             	sub    $0x1,%edi
+  8005aa:	78 30                	js     8005dc <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005ac:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005b0:	74 d6                	je     800588 <vprintfmt+0x1f5>
+  8005b2:	0f be c0             	movsbl %al,%eax
+  8005b5:	83 e8 20             	sub    $0x20,%eax
+  8005b8:	83 f8 5e             	cmp    $0x5e,%eax
+  8005bb:	76 cb                	jbe    800588 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005bd:	83 ec 08             	sub    $0x8,%esp
+  8005c0:	53                   	push   %ebx
+  8005c1:	6a 3f                	push   $0x3f
+  8005c3:	ff 55 08             	call   *0x8(%ebp)
+  8005c6:	83 c4 10             	add    $0x10,%esp
+  8005c9:	eb c8                	jmp    800593 <vprintfmt+0x200>
+  8005cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ce:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005d4:	01 d0                	add    %edx,%eax
+  8005d6:	29 c8                	sub    %ecx,%eax
+  8005d8:	89 c7                	mov    %eax,%edi
+  8005da:	eb 13                	jmp    8005ef <vprintfmt+0x25c>
+  8005dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005df:	eb ed                	jmp    8005ce <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8005e1:	83 ec 08             	sub    $0x8,%esp
+  8005e4:	53                   	push   %ebx
+  8005e5:	6a 20                	push   $0x20
+  8005e7:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8005e9:	83 ef 01             	sub    $0x1,%edi
+  8005ec:	83 c4 10             	add    $0x10,%esp
+  8005ef:	85 ff                	test   %edi,%edi
+  8005f1:	7f ee                	jg     8005e1 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005f3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f9:	e9 6b 01 00 00       	jmp    800769 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8005fe:	83 f9 01             	cmp    $0x1,%ecx
+  800601:	7f 1f                	jg     800622 <vprintfmt+0x28f>
+	else if (lflag)
+  800603:	85 c9                	test   %ecx,%ecx
+  800605:	74 67                	je     80066e <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060a:	8b 00                	mov    (%eax),%eax
+  80060c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80060f:	89 c1                	mov    %eax,%ecx
+  800611:	c1 f9 1f             	sar    $0x1f,%ecx
+  800614:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061a:	8d 40 04             	lea    0x4(%eax),%eax
+  80061d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800620:	eb 17                	jmp    800639 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8b 50 04             	mov    0x4(%eax),%edx
+  800628:	8b 00                	mov    (%eax),%eax
+  80062a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8d 40 08             	lea    0x8(%eax),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800639:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80063c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80063f:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800644:	85 c9                	test   %ecx,%ecx
+  800646:	0f 89 03 01 00 00    	jns    80074f <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80064c:	83 ec 08             	sub    $0x8,%esp
+  80064f:	53                   	push   %ebx
+  800650:	6a 2d                	push   $0x2d
+  800652:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800654:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800657:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80065a:	f7 da                	neg    %edx
+  80065c:	83 d1 00             	adc    $0x0,%ecx
+  80065f:	f7 d9                	neg    %ecx
+  800661:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800664:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800669:	e9 e1 00 00 00       	jmp    80074f <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	8b 00                	mov    (%eax),%eax
+  800673:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800676:	89 c1                	mov    %eax,%ecx
+  800678:	c1 f9 1f             	sar    $0x1f,%ecx
+  80067b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80067e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800681:	8d 40 04             	lea    0x4(%eax),%eax
+  800684:	89 45 14             	mov    %eax,0x14(%ebp)
+  800687:	eb b0                	jmp    800639 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800689:	83 f9 01             	cmp    $0x1,%ecx
+  80068c:	7f 1e                	jg     8006ac <vprintfmt+0x319>
+	else if (lflag)
+  80068e:	85 c9                	test   %ecx,%ecx
+  800690:	74 32                	je     8006c4 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800692:	8b 45 14             	mov    0x14(%ebp),%eax
+  800695:	8b 10                	mov    (%eax),%edx
+  800697:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069c:	8d 40 04             	lea    0x4(%eax),%eax
+  80069f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006a2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006a7:	e9 a3 00 00 00       	jmp    80074f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006af:	8b 10                	mov    (%eax),%edx
+  8006b1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006ba:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006bf:	e9 8b 00 00 00       	jmp    80074f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c7:	8b 10                	mov    (%eax),%edx
+  8006c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8006d9:	eb 74                	jmp    80074f <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8006db:	83 f9 01             	cmp    $0x1,%ecx
+  8006de:	7f 1b                	jg     8006fb <vprintfmt+0x368>
+	else if (lflag)
+  8006e0:	85 c9                	test   %ecx,%ecx
+  8006e2:	74 2c                	je     800710 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8006e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e7:	8b 10                	mov    (%eax),%edx
+  8006e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006f4:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8006f9:	eb 54                	jmp    80074f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fe:	8b 10                	mov    (%eax),%edx
+  800700:	8b 48 04             	mov    0x4(%eax),%ecx
+  800703:	8d 40 08             	lea    0x8(%eax),%eax
+  800706:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800709:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80070e:	eb 3f                	jmp    80074f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800710:	8b 45 14             	mov    0x14(%ebp),%eax
+  800713:	8b 10                	mov    (%eax),%edx
+  800715:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071a:	8d 40 04             	lea    0x4(%eax),%eax
+  80071d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800720:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800725:	eb 28                	jmp    80074f <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800727:	83 ec 08             	sub    $0x8,%esp
+  80072a:	53                   	push   %ebx
+  80072b:	6a 30                	push   $0x30
+  80072d:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80072f:	83 c4 08             	add    $0x8,%esp
+  800732:	53                   	push   %ebx
+  800733:	6a 78                	push   $0x78
+  800735:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800737:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073a:	8b 10                	mov    (%eax),%edx
+  80073c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800741:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800744:	8d 40 04             	lea    0x4(%eax),%eax
+  800747:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80074a:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80074f:	83 ec 0c             	sub    $0xc,%esp
+  800752:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800756:	50                   	push   %eax
+  800757:	ff 75 e0             	push   -0x20(%ebp)
+  80075a:	57                   	push   %edi
+  80075b:	51                   	push   %ecx
+  80075c:	52                   	push   %edx
+  80075d:	89 da                	mov    %ebx,%edx
+  80075f:	89 f0                	mov    %esi,%eax
+  800761:	e8 4a fb ff ff       	call   8002b0 <printnum>
+			break;
+  800766:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800769:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80076c:	e9 40 fc ff ff       	jmp    8003b1 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800771:	83 f9 01             	cmp    $0x1,%ecx
+  800774:	7f 1b                	jg     800791 <vprintfmt+0x3fe>
+	else if (lflag)
+  800776:	85 c9                	test   %ecx,%ecx
+  800778:	74 2c                	je     8007a6 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80077a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077d:	8b 10                	mov    (%eax),%edx
+  80077f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800784:	8d 40 04             	lea    0x4(%eax),%eax
+  800787:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80078a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80078f:	eb be                	jmp    80074f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800791:	8b 45 14             	mov    0x14(%ebp),%eax
+  800794:	8b 10                	mov    (%eax),%edx
+  800796:	8b 48 04             	mov    0x4(%eax),%ecx
+  800799:	8d 40 08             	lea    0x8(%eax),%eax
+  80079c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80079f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007a4:	eb a9                	jmp    80074f <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a9:	8b 10                	mov    (%eax),%edx
+  8007ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007bb:	eb 92                	jmp    80074f <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8007bd:	83 ec 08             	sub    $0x8,%esp
+  8007c0:	53                   	push   %ebx
+  8007c1:	6a 25                	push   $0x25
+  8007c3:	ff d6                	call   *%esi
+			break;
+  8007c5:	83 c4 10             	add    $0x10,%esp
+  8007c8:	eb 9f                	jmp    800769 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8007ca:	83 ec 08             	sub    $0x8,%esp
+  8007cd:	53                   	push   %ebx
+  8007ce:	6a 25                	push   $0x25
+  8007d0:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007d2:	83 c4 10             	add    $0x10,%esp
+  8007d5:	89 f8                	mov    %edi,%eax
+  8007d7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007db:	74 05                	je     8007e2 <vprintfmt+0x44f>
+  8007dd:	83 e8 01             	sub    $0x1,%eax
+  8007e0:	eb f5                	jmp    8007d7 <vprintfmt+0x444>
+  8007e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007e5:	eb 82                	jmp    800769 <vprintfmt+0x3d6>
+
+008007e7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007e7:	55                   	push   %ebp
+  8007e8:	89 e5                	mov    %esp,%ebp
+  8007ea:	83 ec 18             	sub    $0x18,%esp
+  8007ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007f3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007f6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007fa:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007fd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800804:	85 c0                	test   %eax,%eax
+  800806:	74 26                	je     80082e <vsnprintf+0x47>
+  800808:	85 d2                	test   %edx,%edx
+  80080a:	7e 22                	jle    80082e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80080c:	ff 75 14             	push   0x14(%ebp)
+  80080f:	ff 75 10             	push   0x10(%ebp)
+  800812:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800815:	50                   	push   %eax
+  800816:	68 59 03 80 00       	push   $0x800359
+  80081b:	e8 73 fb ff ff       	call   800393 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800820:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800823:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800826:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800829:	83 c4 10             	add    $0x10,%esp
+}
+  80082c:	c9                   	leave
+  80082d:	c3                   	ret
+		return -E_INVAL;
+  80082e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800833:	eb f7                	jmp    80082c <vsnprintf+0x45>
+
+00800835 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800835:	55                   	push   %ebp
+  800836:	89 e5                	mov    %esp,%ebp
+  800838:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80083b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80083e:	50                   	push   %eax
+  80083f:	ff 75 10             	push   0x10(%ebp)
+  800842:	ff 75 0c             	push   0xc(%ebp)
+  800845:	ff 75 08             	push   0x8(%ebp)
+  800848:	e8 9a ff ff ff       	call   8007e7 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80084d:	c9                   	leave
+  80084e:	c3                   	ret
+
+0080084f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80084f:	55                   	push   %ebp
+  800850:	89 e5                	mov    %esp,%ebp
+  800852:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085a:	eb 03                	jmp    80085f <strlen+0x10>
+		n++;
+  80085c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80085f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800863:	75 f7                	jne    80085c <strlen+0xd>
+	return n;
+}
+  800865:	5d                   	pop    %ebp
+  800866:	c3                   	ret
+
+00800867 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800867:	55                   	push   %ebp
+  800868:	89 e5                	mov    %esp,%ebp
+  80086a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80086d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800870:	b8 00 00 00 00       	mov    $0x0,%eax
+  800875:	eb 03                	jmp    80087a <strnlen+0x13>
+		n++;
+  800877:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80087a:	39 d0                	cmp    %edx,%eax
+  80087c:	74 08                	je     800886 <strnlen+0x1f>
+  80087e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800882:	75 f3                	jne    800877 <strnlen+0x10>
+  800884:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800886:	89 d0                	mov    %edx,%eax
+  800888:	5d                   	pop    %ebp
+  800889:	c3                   	ret
+
+0080088a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80088a:	55                   	push   %ebp
+  80088b:	89 e5                	mov    %esp,%ebp
+  80088d:	53                   	push   %ebx
+  80088e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800891:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800894:	b8 00 00 00 00       	mov    $0x0,%eax
+  800899:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80089d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008a0:	83 c0 01             	add    $0x1,%eax
+  8008a3:	84 d2                	test   %dl,%dl
+  8008a5:	75 f2                	jne    800899 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008a7:	89 c8                	mov    %ecx,%eax
+  8008a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ac:	c9                   	leave
+  8008ad:	c3                   	ret
+
+008008ae <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008ae:	55                   	push   %ebp
+  8008af:	89 e5                	mov    %esp,%ebp
+  8008b1:	53                   	push   %ebx
+  8008b2:	83 ec 10             	sub    $0x10,%esp
+  8008b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008b8:	53                   	push   %ebx
+  8008b9:	e8 91 ff ff ff       	call   80084f <strlen>
+  8008be:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008c1:	ff 75 0c             	push   0xc(%ebp)
+  8008c4:	01 d8                	add    %ebx,%eax
+  8008c6:	50                   	push   %eax
+  8008c7:	e8 be ff ff ff       	call   80088a <strcpy>
+	return dst;
+}
+  8008cc:	89 d8                	mov    %ebx,%eax
+  8008ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d1:	c9                   	leave
+  8008d2:	c3                   	ret
+
+008008d3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008d3:	55                   	push   %ebp
+  8008d4:	89 e5                	mov    %esp,%ebp
+  8008d6:	56                   	push   %esi
+  8008d7:	53                   	push   %ebx
+  8008d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008db:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008de:	89 f3                	mov    %esi,%ebx
+  8008e0:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008e3:	89 f0                	mov    %esi,%eax
+  8008e5:	eb 0f                	jmp    8008f6 <strncpy+0x23>
+		*dst++ = *src;
+  8008e7:	83 c0 01             	add    $0x1,%eax
+  8008ea:	0f b6 0a             	movzbl (%edx),%ecx
+  8008ed:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008f0:	80 f9 01             	cmp    $0x1,%cl
+  8008f3:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008f6:	39 d8                	cmp    %ebx,%eax
+  8008f8:	75 ed                	jne    8008e7 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008fa:	89 f0                	mov    %esi,%eax
+  8008fc:	5b                   	pop    %ebx
+  8008fd:	5e                   	pop    %esi
+  8008fe:	5d                   	pop    %ebp
+  8008ff:	c3                   	ret
+
+00800900 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800900:	55                   	push   %ebp
+  800901:	89 e5                	mov    %esp,%ebp
+  800903:	56                   	push   %esi
+  800904:	53                   	push   %ebx
+  800905:	8b 75 08             	mov    0x8(%ebp),%esi
+  800908:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80090b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80090e:	89 f0                	mov    %esi,%eax
+  800910:	85 d2                	test   %edx,%edx
+  800912:	74 21                	je     800935 <strlcpy+0x35>
+  800914:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800918:	89 f2                	mov    %esi,%edx
+  80091a:	eb 09                	jmp    800925 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80091c:	83 c1 01             	add    $0x1,%ecx
+  80091f:	83 c2 01             	add    $0x1,%edx
+  800922:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800925:	39 c2                	cmp    %eax,%edx
+  800927:	74 09                	je     800932 <strlcpy+0x32>
+  800929:	0f b6 19             	movzbl (%ecx),%ebx
+  80092c:	84 db                	test   %bl,%bl
+  80092e:	75 ec                	jne    80091c <strlcpy+0x1c>
+  800930:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800932:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800935:	29 f0                	sub    %esi,%eax
+}
+  800937:	5b                   	pop    %ebx
+  800938:	5e                   	pop    %esi
+  800939:	5d                   	pop    %ebp
+  80093a:	c3                   	ret
+
+0080093b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80093b:	55                   	push   %ebp
+  80093c:	89 e5                	mov    %esp,%ebp
+  80093e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800941:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800944:	eb 06                	jmp    80094c <strcmp+0x11>
+		p++, q++;
+  800946:	83 c1 01             	add    $0x1,%ecx
+  800949:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80094c:	0f b6 01             	movzbl (%ecx),%eax
+  80094f:	84 c0                	test   %al,%al
+  800951:	74 04                	je     800957 <strcmp+0x1c>
+  800953:	3a 02                	cmp    (%edx),%al
+  800955:	74 ef                	je     800946 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800957:	0f b6 c0             	movzbl %al,%eax
+  80095a:	0f b6 12             	movzbl (%edx),%edx
+  80095d:	29 d0                	sub    %edx,%eax
+}
+  80095f:	5d                   	pop    %ebp
+  800960:	c3                   	ret
+
+00800961 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800961:	55                   	push   %ebp
+  800962:	89 e5                	mov    %esp,%ebp
+  800964:	53                   	push   %ebx
+  800965:	8b 45 08             	mov    0x8(%ebp),%eax
+  800968:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80096b:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80096e:	eb 09                	jmp    800979 <strncmp+0x18>
+		n--, p++, q++;
+  800970:	83 ea 01             	sub    $0x1,%edx
+  800973:	83 c0 01             	add    $0x1,%eax
+  800976:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800979:	85 d2                	test   %edx,%edx
+  80097b:	74 18                	je     800995 <strncmp+0x34>
+  80097d:	0f b6 18             	movzbl (%eax),%ebx
+  800980:	84 db                	test   %bl,%bl
+  800982:	74 04                	je     800988 <strncmp+0x27>
+  800984:	3a 19                	cmp    (%ecx),%bl
+  800986:	74 e8                	je     800970 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800988:	0f b6 00             	movzbl (%eax),%eax
+  80098b:	0f b6 11             	movzbl (%ecx),%edx
+  80098e:	29 d0                	sub    %edx,%eax
+}
+  800990:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800993:	c9                   	leave
+  800994:	c3                   	ret
+		return 0;
+  800995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099a:	eb f4                	jmp    800990 <strncmp+0x2f>
+
+0080099c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80099c:	55                   	push   %ebp
+  80099d:	89 e5                	mov    %esp,%ebp
+  80099f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009a6:	eb 03                	jmp    8009ab <strchr+0xf>
+  8009a8:	83 c0 01             	add    $0x1,%eax
+  8009ab:	0f b6 10             	movzbl (%eax),%edx
+  8009ae:	84 d2                	test   %dl,%dl
+  8009b0:	74 06                	je     8009b8 <strchr+0x1c>
+		if (*s == c)
+  8009b2:	38 ca                	cmp    %cl,%dl
+  8009b4:	75 f2                	jne    8009a8 <strchr+0xc>
+  8009b6:	eb 05                	jmp    8009bd <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009bd:	5d                   	pop    %ebp
+  8009be:	c3                   	ret
+
+008009bf <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009bf:	55                   	push   %ebp
+  8009c0:	89 e5                	mov    %esp,%ebp
+  8009c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009c9:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009cc:	38 ca                	cmp    %cl,%dl
+  8009ce:	74 09                	je     8009d9 <strfind+0x1a>
+  8009d0:	84 d2                	test   %dl,%dl
+  8009d2:	74 05                	je     8009d9 <strfind+0x1a>
+	for (; *s; s++)
+  8009d4:	83 c0 01             	add    $0x1,%eax
+  8009d7:	eb f0                	jmp    8009c9 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009d9:	5d                   	pop    %ebp
+  8009da:	c3                   	ret
+
+008009db <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	57                   	push   %edi
+  8009df:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009e2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009e5:	85 c9                	test   %ecx,%ecx
+  8009e7:	74 20                	je     800a09 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009e9:	89 f8                	mov    %edi,%eax
+  8009eb:	09 c8                	or     %ecx,%eax
+  8009ed:	a8 03                	test   $0x3,%al
+  8009ef:	75 12                	jne    800a03 <memset+0x28>
+		c &= 0xFF;
+  8009f1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009f5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009fb:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009fe:	fc                   	cld
+  8009ff:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a01:	eb 06                	jmp    800a09 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a06:	fc                   	cld
+  800a07:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a09:	89 f8                	mov    %edi,%eax
+  800a0b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a0e:	c9                   	leave
+  800a0f:	c3                   	ret
+
+00800a10 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a10:	55                   	push   %ebp
+  800a11:	89 e5                	mov    %esp,%ebp
+  800a13:	57                   	push   %edi
+  800a14:	56                   	push   %esi
+  800a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a18:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a1b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a1e:	39 c6                	cmp    %eax,%esi
+  800a20:	73 32                	jae    800a54 <memmove+0x44>
+  800a22:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a25:	39 d0                	cmp    %edx,%eax
+  800a27:	73 2b                	jae    800a54 <memmove+0x44>
+		s += n;
+		d += n;
+  800a29:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a2c:	89 d6                	mov    %edx,%esi
+  800a2e:	09 fe                	or     %edi,%esi
+  800a30:	09 ce                	or     %ecx,%esi
+  800a32:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a38:	75 0e                	jne    800a48 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a3a:	83 ef 04             	sub    $0x4,%edi
+  800a3d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a40:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a43:	fd                   	std
+  800a44:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a46:	eb 09                	jmp    800a51 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a48:	83 ef 01             	sub    $0x1,%edi
+  800a4b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a4e:	fd                   	std
+  800a4f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a51:	fc                   	cld
+  800a52:	eb 1a                	jmp    800a6e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a54:	89 f2                	mov    %esi,%edx
+  800a56:	09 c2                	or     %eax,%edx
+  800a58:	09 ca                	or     %ecx,%edx
+  800a5a:	f6 c2 03             	test   $0x3,%dl
+  800a5d:	75 0a                	jne    800a69 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a5f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a62:	89 c7                	mov    %eax,%edi
+  800a64:	fc                   	cld
+  800a65:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a67:	eb 05                	jmp    800a6e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a69:	89 c7                	mov    %eax,%edi
+  800a6b:	fc                   	cld
+  800a6c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a6e:	5e                   	pop    %esi
+  800a6f:	5f                   	pop    %edi
+  800a70:	5d                   	pop    %ebp
+  800a71:	c3                   	ret
+
+00800a72 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a72:	55                   	push   %ebp
+  800a73:	89 e5                	mov    %esp,%ebp
+  800a75:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a78:	ff 75 10             	push   0x10(%ebp)
+  800a7b:	ff 75 0c             	push   0xc(%ebp)
+  800a7e:	ff 75 08             	push   0x8(%ebp)
+  800a81:	e8 8a ff ff ff       	call   800a10 <memmove>
+}
+  800a86:	c9                   	leave
+  800a87:	c3                   	ret
+
+00800a88 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a88:	55                   	push   %ebp
+  800a89:	89 e5                	mov    %esp,%ebp
+  800a8b:	56                   	push   %esi
+  800a8c:	53                   	push   %ebx
+  800a8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a90:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a93:	89 c6                	mov    %eax,%esi
+  800a95:	03 75 10             	add    0x10(%ebp),%esi
+  800a98:	eb 06                	jmp    800aa0 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a9a:	83 c0 01             	add    $0x1,%eax
+  800a9d:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800aa0:	39 f0                	cmp    %esi,%eax
+  800aa2:	74 14                	je     800ab8 <memcmp+0x30>
+		if (*s1 != *s2)
+  800aa4:	0f b6 08             	movzbl (%eax),%ecx
+  800aa7:	0f b6 1a             	movzbl (%edx),%ebx
+  800aaa:	38 d9                	cmp    %bl,%cl
+  800aac:	74 ec                	je     800a9a <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800aae:	0f b6 c1             	movzbl %cl,%eax
+  800ab1:	0f b6 db             	movzbl %bl,%ebx
+  800ab4:	29 d8                	sub    %ebx,%eax
+  800ab6:	eb 05                	jmp    800abd <memcmp+0x35>
+	}
+
+	return 0;
+  800ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800abd:	5b                   	pop    %ebx
+  800abe:	5e                   	pop    %esi
+  800abf:	5d                   	pop    %ebp
+  800ac0:	c3                   	ret
+
+00800ac1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ac1:	55                   	push   %ebp
+  800ac2:	89 e5                	mov    %esp,%ebp
+  800ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800aca:	89 c2                	mov    %eax,%edx
+  800acc:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800acf:	eb 03                	jmp    800ad4 <memfind+0x13>
+  800ad1:	83 c0 01             	add    $0x1,%eax
+  800ad4:	39 d0                	cmp    %edx,%eax
+  800ad6:	73 04                	jae    800adc <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ad8:	38 08                	cmp    %cl,(%eax)
+  800ada:	75 f5                	jne    800ad1 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800adc:	5d                   	pop    %ebp
+  800add:	c3                   	ret
+
+00800ade <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	57                   	push   %edi
+  800ae2:	56                   	push   %esi
+  800ae3:	53                   	push   %ebx
+  800ae4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800aea:	eb 03                	jmp    800aef <strtol+0x11>
+		s++;
+  800aec:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800aef:	0f b6 02             	movzbl (%edx),%eax
+  800af2:	3c 20                	cmp    $0x20,%al
+  800af4:	74 f6                	je     800aec <strtol+0xe>
+  800af6:	3c 09                	cmp    $0x9,%al
+  800af8:	74 f2                	je     800aec <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800afa:	3c 2b                	cmp    $0x2b,%al
+  800afc:	74 2a                	je     800b28 <strtol+0x4a>
+	int neg = 0;
+  800afe:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b03:	3c 2d                	cmp    $0x2d,%al
+  800b05:	74 2b                	je     800b32 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b07:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b0d:	75 0f                	jne    800b1e <strtol+0x40>
+  800b0f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b12:	74 28                	je     800b3c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b14:	85 db                	test   %ebx,%ebx
+  800b16:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b1b:	0f 44 d8             	cmove  %eax,%ebx
+  800b1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b23:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b26:	eb 46                	jmp    800b6e <strtol+0x90>
+		s++;
+  800b28:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b30:	eb d5                	jmp    800b07 <strtol+0x29>
+		s++, neg = 1;
+  800b32:	83 c2 01             	add    $0x1,%edx
+  800b35:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b3a:	eb cb                	jmp    800b07 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b3c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b40:	74 0e                	je     800b50 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b42:	85 db                	test   %ebx,%ebx
+  800b44:	75 d8                	jne    800b1e <strtol+0x40>
+		s++, base = 8;
+  800b46:	83 c2 01             	add    $0x1,%edx
+  800b49:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b4e:	eb ce                	jmp    800b1e <strtol+0x40>
+		s += 2, base = 16;
+  800b50:	83 c2 02             	add    $0x2,%edx
+  800b53:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b58:	eb c4                	jmp    800b1e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b5a:	0f be c0             	movsbl %al,%eax
+  800b5d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b60:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b63:	7d 3a                	jge    800b9f <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b65:	83 c2 01             	add    $0x1,%edx
+  800b68:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b6c:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b6e:	0f b6 02             	movzbl (%edx),%eax
+  800b71:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b74:	89 f3                	mov    %esi,%ebx
+  800b76:	80 fb 09             	cmp    $0x9,%bl
+  800b79:	76 df                	jbe    800b5a <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b7b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b7e:	89 f3                	mov    %esi,%ebx
+  800b80:	80 fb 19             	cmp    $0x19,%bl
+  800b83:	77 08                	ja     800b8d <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b85:	0f be c0             	movsbl %al,%eax
+  800b88:	83 e8 57             	sub    $0x57,%eax
+  800b8b:	eb d3                	jmp    800b60 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b8d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b90:	89 f3                	mov    %esi,%ebx
+  800b92:	80 fb 19             	cmp    $0x19,%bl
+  800b95:	77 08                	ja     800b9f <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b97:	0f be c0             	movsbl %al,%eax
+  800b9a:	83 e8 37             	sub    $0x37,%eax
+  800b9d:	eb c1                	jmp    800b60 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b9f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ba3:	74 05                	je     800baa <strtol+0xcc>
+		*endptr = (char *) s;
+  800ba5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ba8:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800baa:	89 c8                	mov    %ecx,%eax
+  800bac:	f7 d8                	neg    %eax
+  800bae:	85 ff                	test   %edi,%edi
+  800bb0:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bb3:	89 c8                	mov    %ecx,%eax
+  800bb5:	5b                   	pop    %ebx
+  800bb6:	5e                   	pop    %esi
+  800bb7:	5f                   	pop    %edi
+  800bb8:	5d                   	pop    %ebp
+  800bb9:	c3                   	ret
+
+00800bba <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bba:	55                   	push   %ebp
+  800bbb:	89 e5                	mov    %esp,%ebp
+  800bbd:	57                   	push   %edi
+  800bbe:	56                   	push   %esi
+  800bbf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bcb:	89 c3                	mov    %eax,%ebx
+  800bcd:	89 c7                	mov    %eax,%edi
+  800bcf:	55                   	push   %ebp
+  800bd0:	89 e5                	mov    %esp,%ebp
+  800bd2:	8d 35 da 0b 80 00    	lea    0x800bda,%esi
+  800bd8:	0f 34                	sysenter
+  800bda:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800bdb:	5b                   	pop    %ebx
+  800bdc:	5e                   	pop    %esi
+  800bdd:	5f                   	pop    %edi
+  800bde:	5d                   	pop    %ebp
+  800bdf:	c3                   	ret
+
+00800be0 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800be0:	55                   	push   %ebp
+  800be1:	89 e5                	mov    %esp,%ebp
+  800be3:	57                   	push   %edi
+  800be4:	56                   	push   %esi
+  800be5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800be6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800beb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bf0:	89 d1                	mov    %edx,%ecx
+  800bf2:	89 d3                	mov    %edx,%ebx
+  800bf4:	89 d7                	mov    %edx,%edi
+  800bf6:	55                   	push   %ebp
+  800bf7:	89 e5                	mov    %esp,%ebp
+  800bf9:	8d 35 01 0c 80 00    	lea    0x800c01,%esi
+  800bff:	0f 34                	sysenter
+  800c01:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800c02:	5b                   	pop    %ebx
+  800c03:	5e                   	pop    %esi
+  800c04:	5f                   	pop    %edi
+  800c05:	5d                   	pop    %ebp
+  800c06:	c3                   	ret
+
+00800c07 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c07:	55                   	push   %ebp
+  800c08:	89 e5                	mov    %esp,%ebp
+  800c0a:	57                   	push   %edi
+  800c0b:	56                   	push   %esi
+  800c0c:	53                   	push   %ebx
+  800c0d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c18:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c1d:	89 cb                	mov    %ecx,%ebx
+  800c1f:	89 cf                	mov    %ecx,%edi
+  800c21:	55                   	push   %ebp
+  800c22:	89 e5                	mov    %esp,%ebp
+  800c24:	8d 35 2c 0c 80 00    	lea    0x800c2c,%esi
+  800c2a:	0f 34                	sysenter
+  800c2c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c2d:	85 c0                	test   %eax,%eax
+  800c2f:	7f 08                	jg     800c39 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800c31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c34:	5b                   	pop    %ebx
+  800c35:	5e                   	pop    %esi
+  800c36:	5f                   	pop    %edi
+  800c37:	5d                   	pop    %ebp
+  800c38:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c39:	83 ec 0c             	sub    $0xc,%esp
+  800c3c:	50                   	push   %eax
+  800c3d:	6a 03                	push   $0x3
+  800c3f:	68 87 3c 80 00       	push   $0x803c87
+  800c44:	6a 3d                	push   $0x3d
+  800c46:	68 a4 3c 80 00       	push   $0x803ca4
+  800c4b:	e8 fa 28 00 00       	call   80354a <_panic>
+
+00800c50 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c50:	55                   	push   %ebp
+  800c51:	89 e5                	mov    %esp,%ebp
+  800c53:	57                   	push   %edi
+  800c54:	56                   	push   %esi
+  800c55:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c56:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c5b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c60:	89 d1                	mov    %edx,%ecx
+  800c62:	89 d3                	mov    %edx,%ebx
+  800c64:	89 d7                	mov    %edx,%edi
+  800c66:	55                   	push   %ebp
+  800c67:	89 e5                	mov    %esp,%ebp
+  800c69:	8d 35 71 0c 80 00    	lea    0x800c71,%esi
+  800c6f:	0f 34                	sysenter
+  800c71:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800c72:	5b                   	pop    %ebx
+  800c73:	5e                   	pop    %esi
+  800c74:	5f                   	pop    %edi
+  800c75:	5d                   	pop    %ebp
+  800c76:	c3                   	ret
+
+00800c77 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c77:	55                   	push   %ebp
+  800c78:	89 e5                	mov    %esp,%ebp
+  800c7a:	57                   	push   %edi
+  800c7b:	56                   	push   %esi
+  800c7c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c82:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c87:	89 d1                	mov    %edx,%ecx
+  800c89:	89 d3                	mov    %edx,%ebx
+  800c8b:	89 d7                	mov    %edx,%edi
+  800c8d:	89 d6                	mov    %edx,%esi
+  800c8f:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c91:	5b                   	pop    %ebx
+  800c92:	5e                   	pop    %esi
+  800c93:	5f                   	pop    %edi
+  800c94:	5d                   	pop    %ebp
+  800c95:	c3                   	ret
+
+00800c96 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c96:	55                   	push   %ebp
+  800c97:	89 e5                	mov    %esp,%ebp
+  800c99:	57                   	push   %edi
+  800c9a:	56                   	push   %esi
+  800c9b:	53                   	push   %ebx
+  800c9c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca5:	b8 04 00 00 00       	mov    $0x4,%eax
+  800caa:	bf 00 00 00 00       	mov    $0x0,%edi
+  800caf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cb2:	55                   	push   %ebp
+  800cb3:	89 e5                	mov    %esp,%ebp
+  800cb5:	8d 35 bd 0c 80 00    	lea    0x800cbd,%esi
+  800cbb:	0f 34                	sysenter
+  800cbd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cbe:	85 c0                	test   %eax,%eax
+  800cc0:	7f 08                	jg     800cca <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800cc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc5:	5b                   	pop    %ebx
+  800cc6:	5e                   	pop    %esi
+  800cc7:	5f                   	pop    %edi
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cca:	83 ec 0c             	sub    $0xc,%esp
+  800ccd:	50                   	push   %eax
+  800cce:	6a 04                	push   $0x4
+  800cd0:	68 87 3c 80 00       	push   $0x803c87
+  800cd5:	6a 3d                	push   $0x3d
+  800cd7:	68 a4 3c 80 00       	push   $0x803ca4
+  800cdc:	e8 69 28 00 00       	call   80354a <_panic>
+
+00800ce1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ce1:	55                   	push   %ebp
+  800ce2:	89 e5                	mov    %esp,%ebp
+  800ce4:	57                   	push   %edi
+  800ce5:	56                   	push   %esi
+  800ce6:	53                   	push   %ebx
+  800ce7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ced:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf0:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cf5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cf8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cfb:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cfe:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d00:	85 c0                	test   %eax,%eax
+  800d02:	7f 08                	jg     800d0c <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d07:	5b                   	pop    %ebx
+  800d08:	5e                   	pop    %esi
+  800d09:	5f                   	pop    %edi
+  800d0a:	5d                   	pop    %ebp
+  800d0b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d0c:	83 ec 0c             	sub    $0xc,%esp
+  800d0f:	50                   	push   %eax
+  800d10:	6a 05                	push   $0x5
+  800d12:	68 87 3c 80 00       	push   $0x803c87
+  800d17:	6a 23                	push   $0x23
+  800d19:	68 a4 3c 80 00       	push   $0x803ca4
+  800d1e:	e8 27 28 00 00       	call   80354a <_panic>
+
+00800d23 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d23:	55                   	push   %ebp
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	57                   	push   %edi
+  800d27:	56                   	push   %esi
+  800d28:	53                   	push   %ebx
+  800d29:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d37:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d3c:	89 df                	mov    %ebx,%edi
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	8d 35 49 0d 80 00    	lea    0x800d49,%esi
+  800d47:	0f 34                	sysenter
+  800d49:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d4a:	85 c0                	test   %eax,%eax
+  800d4c:	7f 08                	jg     800d56 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800d4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d51:	5b                   	pop    %ebx
+  800d52:	5e                   	pop    %esi
+  800d53:	5f                   	pop    %edi
+  800d54:	5d                   	pop    %ebp
+  800d55:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d56:	83 ec 0c             	sub    $0xc,%esp
+  800d59:	50                   	push   %eax
+  800d5a:	6a 06                	push   $0x6
+  800d5c:	68 87 3c 80 00       	push   $0x803c87
+  800d61:	6a 3d                	push   $0x3d
+  800d63:	68 a4 3c 80 00       	push   $0x803ca4
+  800d68:	e8 dd 27 00 00       	call   80354a <_panic>
+
+00800d6d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	57                   	push   %edi
+  800d71:	56                   	push   %esi
+  800d72:	53                   	push   %ebx
+  800d73:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d81:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d86:	89 df                	mov    %ebx,%edi
+  800d88:	55                   	push   %ebp
+  800d89:	89 e5                	mov    %esp,%ebp
+  800d8b:	8d 35 93 0d 80 00    	lea    0x800d93,%esi
+  800d91:	0f 34                	sysenter
+  800d93:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d94:	85 c0                	test   %eax,%eax
+  800d96:	7f 08                	jg     800da0 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800d98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9b:	5b                   	pop    %ebx
+  800d9c:	5e                   	pop    %esi
+  800d9d:	5f                   	pop    %edi
+  800d9e:	5d                   	pop    %ebp
+  800d9f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da0:	83 ec 0c             	sub    $0xc,%esp
+  800da3:	50                   	push   %eax
+  800da4:	6a 08                	push   $0x8
+  800da6:	68 87 3c 80 00       	push   $0x803c87
+  800dab:	6a 3d                	push   $0x3d
+  800dad:	68 a4 3c 80 00       	push   $0x803ca4
+  800db2:	e8 93 27 00 00       	call   80354a <_panic>
+
+00800db7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800db7:	55                   	push   %ebp
+  800db8:	89 e5                	mov    %esp,%ebp
+  800dba:	57                   	push   %edi
+  800dbb:	56                   	push   %esi
+  800dbc:	53                   	push   %ebx
+  800dbd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800dc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcb:	b8 09 00 00 00       	mov    $0x9,%eax
+  800dd0:	89 df                	mov    %ebx,%edi
+  800dd2:	55                   	push   %ebp
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	8d 35 dd 0d 80 00    	lea    0x800ddd,%esi
+  800ddb:	0f 34                	sysenter
+  800ddd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800dde:	85 c0                	test   %eax,%eax
+  800de0:	7f 08                	jg     800dea <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800de2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de5:	5b                   	pop    %ebx
+  800de6:	5e                   	pop    %esi
+  800de7:	5f                   	pop    %edi
+  800de8:	5d                   	pop    %ebp
+  800de9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dea:	83 ec 0c             	sub    $0xc,%esp
+  800ded:	50                   	push   %eax
+  800dee:	6a 09                	push   $0x9
+  800df0:	68 87 3c 80 00       	push   $0x803c87
+  800df5:	6a 3d                	push   $0x3d
+  800df7:	68 a4 3c 80 00       	push   $0x803ca4
+  800dfc:	e8 49 27 00 00       	call   80354a <_panic>
+
+00800e01 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e01:	55                   	push   %ebp
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	57                   	push   %edi
+  800e05:	56                   	push   %esi
+  800e06:	53                   	push   %ebx
+  800e07:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e15:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e1a:	89 df                	mov    %ebx,%edi
+  800e1c:	55                   	push   %ebp
+  800e1d:	89 e5                	mov    %esp,%ebp
+  800e1f:	8d 35 27 0e 80 00    	lea    0x800e27,%esi
+  800e25:	0f 34                	sysenter
+  800e27:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e28:	85 c0                	test   %eax,%eax
+  800e2a:	7f 08                	jg     800e34 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800e2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2f:	5b                   	pop    %ebx
+  800e30:	5e                   	pop    %esi
+  800e31:	5f                   	pop    %edi
+  800e32:	5d                   	pop    %ebp
+  800e33:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e34:	83 ec 0c             	sub    $0xc,%esp
+  800e37:	50                   	push   %eax
+  800e38:	6a 0a                	push   $0xa
+  800e3a:	68 87 3c 80 00       	push   $0x803c87
+  800e3f:	6a 3d                	push   $0x3d
+  800e41:	68 a4 3c 80 00       	push   $0x803ca4
+  800e46:	e8 ff 26 00 00       	call   80354a <_panic>
+
+00800e4b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e4b:	55                   	push   %ebp
+  800e4c:	89 e5                	mov    %esp,%ebp
+  800e4e:	57                   	push   %edi
+  800e4f:	56                   	push   %esi
+  800e50:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e57:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e5c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e62:	55                   	push   %ebp
+  800e63:	89 e5                	mov    %esp,%ebp
+  800e65:	8d 35 6d 0e 80 00    	lea    0x800e6d,%esi
+  800e6b:	0f 34                	sysenter
+  800e6d:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800e6e:	5b                   	pop    %ebx
+  800e6f:	5e                   	pop    %esi
+  800e70:	5f                   	pop    %edi
+  800e71:	5d                   	pop    %ebp
+  800e72:	c3                   	ret
+
+00800e73 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	57                   	push   %edi
+  800e77:	56                   	push   %esi
+  800e78:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7f:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e87:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8a:	55                   	push   %ebp
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	8d 35 95 0e 80 00    	lea    0x800e95,%esi
+  800e93:	0f 34                	sysenter
+  800e95:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800e96:	5b                   	pop    %ebx
+  800e97:	5e                   	pop    %esi
+  800e98:	5f                   	pop    %edi
+  800e99:	5d                   	pop    %ebp
+  800e9a:	c3                   	ret
+
+00800e9b <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800e9b:	55                   	push   %ebp
+  800e9c:	89 e5                	mov    %esp,%ebp
+  800e9e:	57                   	push   %edi
+  800e9f:	56                   	push   %esi
+  800ea0:	53                   	push   %ebx
+  800ea1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ea4:	be 00 00 00 00       	mov    $0x0,%esi
+  800ea9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eaf:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eb4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eb7:	89 f7                	mov    %esi,%edi
+  800eb9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ebb:	85 c0                	test   %eax,%eax
+  800ebd:	7f 08                	jg     800ec7 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800ebf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec2:	5b                   	pop    %ebx
+  800ec3:	5e                   	pop    %esi
+  800ec4:	5f                   	pop    %edi
+  800ec5:	5d                   	pop    %ebp
+  800ec6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec7:	83 ec 0c             	sub    $0xc,%esp
+  800eca:	50                   	push   %eax
+  800ecb:	6a 0d                	push   $0xd
+  800ecd:	68 87 3c 80 00       	push   $0x803c87
+  800ed2:	6a 23                	push   $0x23
+  800ed4:	68 a4 3c 80 00       	push   $0x803ca4
+  800ed9:	e8 6c 26 00 00       	call   80354a <_panic>
+
+00800ede <sys_ipc_recv>:
+{
+  800ede:	55                   	push   %ebp
+  800edf:	89 e5                	mov    %esp,%ebp
+  800ee1:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800ee4:	6a 00                	push   $0x0
+  800ee6:	6a 01                	push   $0x1
+  800ee8:	ff 75 08             	push   0x8(%ebp)
+  800eeb:	e8 ab ff ff ff       	call   800e9b <sys_ipc_recvv>
+}
+  800ef0:	c9                   	leave
+  800ef1:	c3                   	ret
+
+00800ef2 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800ef2:	55                   	push   %ebp
+  800ef3:	89 e5                	mov    %esp,%ebp
+  800ef5:	57                   	push   %edi
+  800ef6:	56                   	push   %esi
+  800ef7:	53                   	push   %ebx
+  800ef8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800efb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f06:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f0b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800f0e:	89 de                	mov    %ebx,%esi
+  800f10:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f12:	85 c0                	test   %eax,%eax
+  800f14:	7f 08                	jg     800f1e <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800f16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f19:	5b                   	pop    %ebx
+  800f1a:	5e                   	pop    %esi
+  800f1b:	5f                   	pop    %edi
+  800f1c:	5d                   	pop    %ebp
+  800f1d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1e:	83 ec 0c             	sub    $0xc,%esp
+  800f21:	50                   	push   %eax
+  800f22:	6a 0d                	push   $0xd
+  800f24:	68 87 3c 80 00       	push   $0x803c87
+  800f29:	6a 23                	push   $0x23
+  800f2b:	68 a4 3c 80 00       	push   $0x803ca4
+  800f30:	e8 15 26 00 00       	call   80354a <_panic>
+
+00800f35 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f35:	55                   	push   %ebp
+  800f36:	89 e5                	mov    %esp,%ebp
+  800f38:	57                   	push   %edi
+  800f39:	56                   	push   %esi
+  800f3a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f40:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f45:	89 d1                	mov    %edx,%ecx
+  800f47:	89 d3                	mov    %edx,%ebx
+  800f49:	89 d7                	mov    %edx,%edi
+  800f4b:	55                   	push   %ebp
+  800f4c:	89 e5                	mov    %esp,%ebp
+  800f4e:	8d 35 56 0f 80 00    	lea    0x800f56,%esi
+  800f54:	0f 34                	sysenter
+  800f56:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800f57:	5b                   	pop    %ebx
+  800f58:	5e                   	pop    %esi
+  800f59:	5f                   	pop    %edi
+  800f5a:	5d                   	pop    %ebp
+  800f5b:	c3                   	ret
+
+00800f5c <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800f5c:	55                   	push   %ebp
+  800f5d:	89 e5                	mov    %esp,%ebp
+  800f5f:	57                   	push   %edi
+  800f60:	56                   	push   %esi
+  800f61:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f67:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f72:	89 df                	mov    %ebx,%edi
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	8d 35 7f 0f 80 00    	lea    0x800f7f,%esi
+  800f7d:	0f 34                	sysenter
+  800f7f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800f80:	5b                   	pop    %ebx
+  800f81:	5e                   	pop    %esi
+  800f82:	5f                   	pop    %edi
+  800f83:	5d                   	pop    %ebp
+  800f84:	c3                   	ret
+
+00800f85 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800f85:	55                   	push   %ebp
+  800f86:	89 e5                	mov    %esp,%ebp
+  800f88:	57                   	push   %edi
+  800f89:	56                   	push   %esi
+  800f8a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f93:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f98:	89 cb                	mov    %ecx,%ebx
+  800f9a:	89 cf                	mov    %ecx,%edi
+  800f9c:	55                   	push   %ebp
+  800f9d:	89 e5                	mov    %esp,%ebp
+  800f9f:	8d 35 a7 0f 80 00    	lea    0x800fa7,%esi
+  800fa5:	0f 34                	sysenter
+  800fa7:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800fa8:	5b                   	pop    %ebx
+  800fa9:	5e                   	pop    %esi
+  800faa:	5f                   	pop    %edi
+  800fab:	5d                   	pop    %ebp
+  800fac:	c3                   	ret
+
+00800fad <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800fad:	55                   	push   %ebp
+  800fae:	89 e5                	mov    %esp,%ebp
+  800fb0:	57                   	push   %edi
+  800fb1:	56                   	push   %esi
+  800fb2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbe:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fc3:	89 df                	mov    %ebx,%edi
+  800fc5:	55                   	push   %ebp
+  800fc6:	89 e5                	mov    %esp,%ebp
+  800fc8:	8d 35 d0 0f 80 00    	lea    0x800fd0,%esi
+  800fce:	0f 34                	sysenter
+  800fd0:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800fd1:	5b                   	pop    %ebx
+  800fd2:	5e                   	pop    %esi
+  800fd3:	5f                   	pop    %edi
+  800fd4:	5d                   	pop    %ebp
+  800fd5:	c3                   	ret
+
+00800fd6 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800fd6:	55                   	push   %ebp
+  800fd7:	89 e5                	mov    %esp,%ebp
+  800fd9:	57                   	push   %edi
+  800fda:	56                   	push   %esi
+  800fdb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fdc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe7:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fec:	89 df                	mov    %ebx,%edi
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	8d 35 f9 0f 80 00    	lea    0x800ff9,%esi
+  800ff7:	0f 34                	sysenter
+  800ff9:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800ffa:	5b                   	pop    %ebx
+  800ffb:	5e                   	pop    %esi
+  800ffc:	5f                   	pop    %edi
+  800ffd:	5d                   	pop    %ebp
+  800ffe:	c3                   	ret
+
+00800fff <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800fff:	55                   	push   %ebp
+  801000:	89 e5                	mov    %esp,%ebp
+  801002:	57                   	push   %edi
+  801003:	56                   	push   %esi
+  801004:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801005:	8b 55 08             	mov    0x8(%ebp),%edx
+  801008:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801010:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801013:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801016:	55                   	push   %ebp
+  801017:	89 e5                	mov    %esp,%ebp
+  801019:	8d 35 21 10 80 00    	lea    0x801021,%esi
+  80101f:	0f 34                	sysenter
+  801021:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  801022:	5b                   	pop    %ebx
+  801023:	5e                   	pop    %esi
+  801024:	5f                   	pop    %edi
+  801025:	5d                   	pop    %ebp
+  801026:	c3                   	ret
+
+00801027 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	57                   	push   %edi
+  80102b:	56                   	push   %esi
+  80102c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80102d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801032:	8b 55 08             	mov    0x8(%ebp),%edx
+  801035:	b8 11 00 00 00       	mov    $0x11,%eax
+  80103a:	89 cb                	mov    %ecx,%ebx
+  80103c:	89 cf                	mov    %ecx,%edi
+  80103e:	89 ce                	mov    %ecx,%esi
+  801040:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  801042:	5b                   	pop    %ebx
+  801043:	5e                   	pop    %esi
+  801044:	5f                   	pop    %edi
+  801045:	5d                   	pop    %ebp
+  801046:	c3                   	ret
+
+00801047 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  801047:	55                   	push   %ebp
+  801048:	89 e5                	mov    %esp,%ebp
+  80104a:	57                   	push   %edi
+  80104b:	56                   	push   %esi
+  80104c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80104d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801052:	8b 55 08             	mov    0x8(%ebp),%edx
+  801055:	b8 15 00 00 00       	mov    $0x15,%eax
+  80105a:	89 cb                	mov    %ecx,%ebx
+  80105c:	89 cf                	mov    %ecx,%edi
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	8d 35 69 10 80 00    	lea    0x801069,%esi
+  801067:	0f 34                	sysenter
+  801069:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  80106a:	5b                   	pop    %ebx
+  80106b:	5e                   	pop    %esi
+  80106c:	5f                   	pop    %edi
+  80106d:	5d                   	pop    %ebp
+  80106e:	c3                   	ret
+
+0080106f <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	57                   	push   %edi
+  801073:	56                   	push   %esi
+  801074:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801075:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80107a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107d:	b8 16 00 00 00       	mov    $0x16,%eax
+  801082:	89 cb                	mov    %ecx,%ebx
+  801084:	89 cf                	mov    %ecx,%edi
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	8d 35 91 10 80 00    	lea    0x801091,%esi
+  80108f:	0f 34                	sysenter
+  801091:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  801092:	5b                   	pop    %ebx
+  801093:	5e                   	pop    %esi
+  801094:	5f                   	pop    %edi
+  801095:	5d                   	pop    %ebp
+  801096:	c3                   	ret
+
+00801097 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  801097:	55                   	push   %ebp
+  801098:	89 e5                	mov    %esp,%ebp
+  80109a:	57                   	push   %edi
+  80109b:	56                   	push   %esi
+  80109c:	53                   	push   %ebx
+  80109d:	83 ec 20             	sub    $0x20,%esp
+  8010a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8010a3:	89 d7                	mov    %edx,%edi
+  8010a5:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  8010a7:	51                   	push   %ecx
+  8010a8:	68 00 f0 7f 00       	push   $0x7ff000
+  8010ad:	6a 00                	push   $0x0
+  8010af:	e8 e2 fb ff ff       	call   800c96 <sys_page_alloc>
+  8010b4:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8010b6:	83 c4 10             	add    $0x10,%esp
+  8010b9:	85 c0                	test   %eax,%eax
+  8010bb:	78 45                	js     801102 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  8010bd:	83 ec 04             	sub    $0x4,%esp
+  8010c0:	68 00 10 00 00       	push   $0x1000
+  8010c5:	57                   	push   %edi
+  8010c6:	68 00 f0 7f 00       	push   $0x7ff000
+  8010cb:	e8 40 f9 ff ff       	call   800a10 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8010d0:	89 34 24             	mov    %esi,(%esp)
+  8010d3:	57                   	push   %edi
+  8010d4:	ff 75 e4             	push   -0x1c(%ebp)
+  8010d7:	68 00 f0 7f 00       	push   $0x7ff000
+  8010dc:	6a 00                	push   $0x0
+  8010de:	e8 fe fb ff ff       	call   800ce1 <sys_page_map>
+  8010e3:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8010e5:	83 c4 20             	add    $0x20,%esp
+  8010e8:	85 c0                	test   %eax,%eax
+  8010ea:	78 16                	js     801102 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8010ec:	83 ec 08             	sub    $0x8,%esp
+  8010ef:	68 00 f0 7f 00       	push   $0x7ff000
+  8010f4:	6a 00                	push   $0x0
+  8010f6:	e8 28 fc ff ff       	call   800d23 <sys_page_unmap>
+  8010fb:	83 c4 10             	add    $0x10,%esp
+  8010fe:	85 c0                	test   %eax,%eax
+  801100:	75 0a                	jne    80110c <copy_page_to+0x75>
+exit:
+	return r;
+}
+  801102:	89 d8                	mov    %ebx,%eax
+  801104:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801107:	5b                   	pop    %ebx
+  801108:	5e                   	pop    %esi
+  801109:	5f                   	pop    %edi
+  80110a:	5d                   	pop    %ebp
+  80110b:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80110c:	68 b4 3c 80 00       	push   $0x803cb4
+  801111:	68 2c 3d 80 00       	push   $0x803d2c
+  801116:	6a 1b                	push   $0x1b
+  801118:	68 41 3d 80 00       	push   $0x803d41
+  80111d:	e8 28 24 00 00       	call   80354a <_panic>
+
+00801122 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801122:	55                   	push   %ebp
+  801123:	89 e5                	mov    %esp,%ebp
+  801125:	53                   	push   %ebx
+  801126:	83 ec 04             	sub    $0x4,%esp
+  801129:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  80112c:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80112e:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  801132:	74 21                	je     801155 <pgfault+0x33>
+  801134:	89 d0                	mov    %edx,%eax
+  801136:	c1 e8 16             	shr    $0x16,%eax
+  801139:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801140:	a8 01                	test   $0x1,%al
+  801142:	74 11                	je     801155 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  801144:	89 d0                	mov    %edx,%eax
+  801146:	c1 e8 0c             	shr    $0xc,%eax
+  801149:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801150:	f6 c4 08             	test   $0x8,%ah
+  801153:	75 17                	jne    80116c <pgfault+0x4a>
+		if (pgfault_next) {
+  801155:	a1 04 50 80 00       	mov    0x805004,%eax
+  80115a:	85 c0                	test   %eax,%eax
+  80115c:	74 27                	je     801185 <pgfault+0x63>
+			pgfault_next(utf);
+  80115e:	83 ec 0c             	sub    $0xc,%esp
+  801161:	53                   	push   %ebx
+  801162:	ff d0                	call   *%eax
+			return;
+  801164:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  801167:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80116a:	c9                   	leave
+  80116b:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  80116c:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  801172:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801177:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117c:	e8 16 ff ff ff       	call   801097 <copy_page_to>
+  801181:	85 c0                	test   %eax,%eax
+  801183:	79 e2                	jns    801167 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  801185:	a1 00 50 80 00       	mov    0x805000,%eax
+  80118a:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  80118d:	ff 73 28             	push   0x28(%ebx)
+  801190:	ff 33                	push   (%ebx)
+  801192:	50                   	push   %eax
+  801193:	68 d8 3c 80 00       	push   $0x803cd8
+  801198:	e8 ff f0 ff ff       	call   80029c <cprintf>
+	sys_env_destroy(0);
+  80119d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8011a4:	e8 5e fa ff ff       	call   800c07 <sys_env_destroy>
+  8011a9:	83 c4 10             	add    $0x10,%esp
+  8011ac:	eb b9                	jmp    801167 <pgfault+0x45>
+
+008011ae <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8011ae:	55                   	push   %ebp
+  8011af:	89 e5                	mov    %esp,%ebp
+  8011b1:	53                   	push   %ebx
+  8011b2:	83 ec 04             	sub    $0x4,%esp
+  8011b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8011b8:	a1 04 90 80 00       	mov    0x809004,%eax
+  8011bd:	3d 22 11 80 00       	cmp    $0x801122,%eax
+  8011c2:	74 15                	je     8011d9 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8011c4:	a3 04 50 80 00       	mov    %eax,0x805004
+		set_pgfault_handler(pgfault);
+  8011c9:	83 ec 0c             	sub    $0xc,%esp
+  8011cc:	68 22 11 80 00       	push   $0x801122
+  8011d1:	e8 ba 23 00 00       	call   803590 <set_pgfault_handler>
+  8011d6:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8011d9:	83 ec 0c             	sub    $0xc,%esp
+  8011dc:	68 05 08 00 00       	push   $0x805
+  8011e1:	53                   	push   %ebx
+  8011e2:	6a 00                	push   $0x0
+  8011e4:	53                   	push   %ebx
+  8011e5:	6a 00                	push   $0x0
+  8011e7:	e8 f5 fa ff ff       	call   800ce1 <sys_page_map>
+}
+  8011ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011ef:	c9                   	leave
+  8011f0:	c3                   	ret
+
+008011f1 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8011f1:	55                   	push   %ebp
+  8011f2:	89 e5                	mov    %esp,%ebp
+  8011f4:	57                   	push   %edi
+  8011f5:	56                   	push   %esi
+  8011f6:	53                   	push   %ebx
+  8011f7:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8011fa:	68 22 11 80 00       	push   $0x801122
+  8011ff:	e8 8c 23 00 00       	call   803590 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801204:	b8 07 00 00 00       	mov    $0x7,%eax
+  801209:	cd 30                	int    $0x30
+  80120b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80120e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  801211:	83 c4 10             	add    $0x10,%esp
+  801214:	85 c0                	test   %eax,%eax
+  801216:	0f 88 6b 01 00 00    	js     801387 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80121c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  801221:	75 37                	jne    80125a <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801223:	e8 28 fa ff ff       	call   800c50 <sys_getenvid>
+  801228:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80122d:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  801233:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801238:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  80123d:	e9 45 01 00 00       	jmp    801387 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  801242:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801248:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80124e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801254:	0f 87 ba 00 00 00    	ja     801314 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  80125a:	89 d8                	mov    %ebx,%eax
+  80125c:	c1 e8 16             	shr    $0x16,%eax
+  80125f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801266:	a8 01                	test   $0x1,%al
+  801268:	74 d8                	je     801242 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  80126a:	89 d8                	mov    %ebx,%eax
+  80126c:	c1 e8 0c             	shr    $0xc,%eax
+  80126f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801276:	f6 c2 01             	test   $0x1,%dl
+  801279:	74 cd                	je     801248 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  80127b:	89 da                	mov    %ebx,%edx
+  80127d:	80 e6 df             	and    $0xdf,%dh
+  801280:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  801286:	74 c0                	je     801248 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  801288:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80128a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801291:	f6 c6 04             	test   $0x4,%dh
+  801294:	75 53                	jne    8012e9 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  801296:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80129d:	f6 c6 08             	test   $0x8,%dh
+  8012a0:	75 0c                	jne    8012ae <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8012a2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012a9:	f6 c2 02             	test   $0x2,%dl
+  8012ac:	74 3b                	je     8012e9 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8012ae:	83 ec 0c             	sub    $0xc,%esp
+  8012b1:	68 05 08 00 00       	push   $0x805
+  8012b6:	57                   	push   %edi
+  8012b7:	ff 75 e4             	push   -0x1c(%ebp)
+  8012ba:	57                   	push   %edi
+  8012bb:	6a 00                	push   $0x0
+  8012bd:	e8 1f fa ff ff       	call   800ce1 <sys_page_map>
+  8012c2:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8012c4:	83 c4 20             	add    $0x20,%esp
+  8012c7:	85 c0                	test   %eax,%eax
+  8012c9:	0f 88 a7 00 00 00    	js     801376 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8012cf:	83 ec 0c             	sub    $0xc,%esp
+  8012d2:	68 05 08 00 00       	push   $0x805
+  8012d7:	57                   	push   %edi
+  8012d8:	6a 00                	push   $0x0
+  8012da:	57                   	push   %edi
+  8012db:	6a 00                	push   $0x0
+  8012dd:	e8 ff f9 ff ff       	call   800ce1 <sys_page_map>
+  8012e2:	89 c6                	mov    %eax,%esi
+	return r;
+  8012e4:	83 c4 20             	add    $0x20,%esp
+  8012e7:	eb 21                	jmp    80130a <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8012e9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012f0:	83 ec 0c             	sub    $0xc,%esp
+  8012f3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012f8:	50                   	push   %eax
+  8012f9:	57                   	push   %edi
+  8012fa:	ff 75 e4             	push   -0x1c(%ebp)
+  8012fd:	57                   	push   %edi
+  8012fe:	6a 00                	push   $0x0
+  801300:	e8 dc f9 ff ff       	call   800ce1 <sys_page_map>
+  801305:	89 c6                	mov    %eax,%esi
+  801307:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  80130a:	85 f6                	test   %esi,%esi
+  80130c:	0f 89 36 ff ff ff    	jns    801248 <fork+0x57>
+  801312:	eb 62                	jmp    801376 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801314:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801319:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  80131e:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801321:	89 f8                	mov    %edi,%eax
+  801323:	e8 6f fd ff ff       	call   801097 <copy_page_to>
+  801328:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80132a:	85 c0                	test   %eax,%eax
+  80132c:	78 48                	js     801376 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80132e:	83 ec 04             	sub    $0x4,%esp
+  801331:	6a 07                	push   $0x7
+  801333:	68 00 f0 bf ee       	push   $0xeebff000
+  801338:	57                   	push   %edi
+  801339:	e8 58 f9 ff ff       	call   800c96 <sys_page_alloc>
+  80133e:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801340:	83 c4 10             	add    $0x10,%esp
+  801343:	85 c0                	test   %eax,%eax
+  801345:	78 2f                	js     801376 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801347:	a1 00 50 80 00       	mov    0x805000,%eax
+  80134c:	8b 40 64             	mov    0x64(%eax),%eax
+  80134f:	83 ec 08             	sub    $0x8,%esp
+  801352:	50                   	push   %eax
+  801353:	57                   	push   %edi
+  801354:	e8 a8 fa ff ff       	call   800e01 <sys_env_set_pgfault_upcall>
+  801359:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80135b:	83 c4 10             	add    $0x10,%esp
+  80135e:	85 c0                	test   %eax,%eax
+  801360:	78 14                	js     801376 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  801362:	83 ec 08             	sub    $0x8,%esp
+  801365:	6a 02                	push   $0x2
+  801367:	57                   	push   %edi
+  801368:	e8 00 fa ff ff       	call   800d6d <sys_env_set_status>
+  80136d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80136f:	83 c4 10             	add    $0x10,%esp
+  801372:	85 c0                	test   %eax,%eax
+  801374:	79 11                	jns    801387 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  801376:	83 ec 0c             	sub    $0xc,%esp
+  801379:	ff 75 e0             	push   -0x20(%ebp)
+  80137c:	e8 86 f8 ff ff       	call   800c07 <sys_env_destroy>
+	return r;
+  801381:	83 c4 10             	add    $0x10,%esp
+  801384:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  801387:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80138a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138d:	5b                   	pop    %ebx
+  80138e:	5e                   	pop    %esi
+  80138f:	5f                   	pop    %edi
+  801390:	5d                   	pop    %ebp
+  801391:	c3                   	ret
+
+00801392 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801392:	55                   	push   %ebp
+  801393:	89 e5                	mov    %esp,%ebp
+  801395:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801398:	68 4c 3d 80 00       	push   $0x803d4c
+  80139d:	68 bf 00 00 00       	push   $0xbf
+  8013a2:	68 41 3d 80 00       	push   $0x803d41
+  8013a7:	e8 9e 21 00 00       	call   80354a <_panic>
+
+008013ac <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8013ac:	55                   	push   %ebp
+  8013ad:	89 e5                	mov    %esp,%ebp
+  8013af:	56                   	push   %esi
+  8013b0:	53                   	push   %ebx
+  8013b1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8013ba:	85 c0                	test   %eax,%eax
+  8013bc:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8013c1:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8013c4:	83 ec 0c             	sub    $0xc,%esp
+  8013c7:	50                   	push   %eax
+  8013c8:	e8 11 fb ff ff       	call   800ede <sys_ipc_recv>
+	if (from_env_store)
+  8013cd:	83 c4 10             	add    $0x10,%esp
+  8013d0:	85 f6                	test   %esi,%esi
+  8013d2:	74 14                	je     8013e8 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8013d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d9:	85 c0                	test   %eax,%eax
+  8013db:	75 09                	jne    8013e6 <ipc_recv+0x3a>
+  8013dd:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8013e3:	8b 52 74             	mov    0x74(%edx),%edx
+  8013e6:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8013e8:	85 db                	test   %ebx,%ebx
+  8013ea:	74 25                	je     801411 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8013ec:	85 c0                	test   %eax,%eax
+  8013ee:	74 0d                	je     8013fd <ipc_recv+0x51>
+  8013f0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8013f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013f9:	5b                   	pop    %ebx
+  8013fa:	5e                   	pop    %esi
+  8013fb:	5d                   	pop    %ebp
+  8013fc:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8013fd:	a1 00 50 80 00       	mov    0x805000,%eax
+  801402:	8b 40 78             	mov    0x78(%eax),%eax
+  801405:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  801407:	a1 00 50 80 00       	mov    0x805000,%eax
+  80140c:	8b 40 70             	mov    0x70(%eax),%eax
+  80140f:	eb e5                	jmp    8013f6 <ipc_recv+0x4a>
+  801411:	85 c0                	test   %eax,%eax
+  801413:	75 e1                	jne    8013f6 <ipc_recv+0x4a>
+  801415:	eb f0                	jmp    801407 <ipc_recv+0x5b>
+
+00801417 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801417:	55                   	push   %ebp
+  801418:	89 e5                	mov    %esp,%ebp
+  80141a:	57                   	push   %edi
+  80141b:	56                   	push   %esi
+  80141c:	53                   	push   %ebx
+  80141d:	83 ec 0c             	sub    $0xc,%esp
+  801420:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801423:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801426:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801429:	85 db                	test   %ebx,%ebx
+  80142b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801430:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  801433:	ff 75 14             	push   0x14(%ebp)
+  801436:	53                   	push   %ebx
+  801437:	56                   	push   %esi
+  801438:	57                   	push   %edi
+  801439:	e8 0d fa ff ff       	call   800e4b <sys_ipc_try_send>
+  80143e:	83 c4 10             	add    $0x10,%esp
+  801441:	85 c0                	test   %eax,%eax
+  801443:	74 22                	je     801467 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  801445:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801448:	75 07                	jne    801451 <ipc_send+0x3a>
+		sys_yield();
+  80144a:	e8 28 f8 ff ff       	call   800c77 <sys_yield>
+  80144f:	eb e2                	jmp    801433 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  801451:	68 62 3d 80 00       	push   $0x803d62
+  801456:	68 2c 3d 80 00       	push   $0x803d2c
+  80145b:	6a 39                	push   $0x39
+  80145d:	68 77 3d 80 00       	push   $0x803d77
+  801462:	e8 e3 20 00 00       	call   80354a <_panic>
+	}
+}
+  801467:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146a:	5b                   	pop    %ebx
+  80146b:	5e                   	pop    %esi
+  80146c:	5f                   	pop    %edi
+  80146d:	5d                   	pop    %ebp
+  80146e:	c3                   	ret
+
+0080146f <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80146f:	55                   	push   %ebp
+  801470:	89 e5                	mov    %esp,%ebp
+  801472:	57                   	push   %edi
+  801473:	56                   	push   %esi
+  801474:	53                   	push   %ebx
+  801475:	83 ec 10             	sub    $0x10,%esp
+  801478:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80147b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80147e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801481:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801484:	85 c0                	test   %eax,%eax
+  801486:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80148b:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  80148e:	6a 00                	push   $0x0
+  801490:	ff 33                	push   (%ebx)
+  801492:	50                   	push   %eax
+  801493:	e8 03 fa ff ff       	call   800e9b <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  801498:	83 c4 10             	add    $0x10,%esp
+  80149b:	85 c0                	test   %eax,%eax
+  80149d:	75 3c                	jne    8014db <ipc_recvv+0x6c>
+  80149f:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8014a5:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8014a8:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8014aa:	85 ff                	test   %edi,%edi
+  8014ac:	74 4e                	je     8014fc <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8014ae:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8014b4:	8b 52 74             	mov    0x74(%edx),%edx
+  8014b7:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8014b9:	85 f6                	test   %esi,%esi
+  8014bb:	74 18                	je     8014d5 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8014bd:	85 c0                	test   %eax,%eax
+  8014bf:	75 2d                	jne    8014ee <ipc_recvv+0x7f>
+  8014c1:	a1 00 50 80 00       	mov    0x805000,%eax
+  8014c6:	8b 40 78             	mov    0x78(%eax),%eax
+  8014c9:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8014cb:	a1 00 50 80 00       	mov    0x805000,%eax
+  8014d0:	8b 40 70             	mov    0x70(%eax),%eax
+  8014d3:	eb 1f                	jmp    8014f4 <ipc_recvv+0x85>
+  8014d5:	85 c0                	test   %eax,%eax
+  8014d7:	75 1b                	jne    8014f4 <ipc_recvv+0x85>
+  8014d9:	eb f0                	jmp    8014cb <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8014db:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8014e1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8014e6:	85 ff                	test   %edi,%edi
+  8014e8:	75 cd                	jne    8014b7 <ipc_recvv+0x48>
+	if (perm_store)
+  8014ea:	85 f6                	test   %esi,%esi
+  8014ec:	74 e7                	je     8014d5 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8014ee:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8014f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f7:	5b                   	pop    %ebx
+  8014f8:	5e                   	pop    %esi
+  8014f9:	5f                   	pop    %edi
+  8014fa:	5d                   	pop    %ebp
+  8014fb:	c3                   	ret
+	if (perm_store)
+  8014fc:	85 f6                	test   %esi,%esi
+  8014fe:	75 bd                	jne    8014bd <ipc_recvv+0x4e>
+  801500:	eb c9                	jmp    8014cb <ipc_recvv+0x5c>
+
+00801502 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  801502:	55                   	push   %ebp
+  801503:	89 e5                	mov    %esp,%ebp
+  801505:	57                   	push   %edi
+  801506:	56                   	push   %esi
+  801507:	53                   	push   %ebx
+  801508:	83 ec 0c             	sub    $0xc,%esp
+  80150b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80150e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801511:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  801514:	ff 75 14             	push   0x14(%ebp)
+  801517:	53                   	push   %ebx
+  801518:	56                   	push   %esi
+  801519:	57                   	push   %edi
+  80151a:	e8 54 f9 ff ff       	call   800e73 <sys_ipc_try_sendv>
+  80151f:	83 c4 10             	add    $0x10,%esp
+  801522:	85 c0                	test   %eax,%eax
+  801524:	74 22                	je     801548 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  801526:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801529:	75 07                	jne    801532 <ipc_sendv+0x30>
+		sys_yield();
+  80152b:	e8 47 f7 ff ff       	call   800c77 <sys_yield>
+  801530:	eb e2                	jmp    801514 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  801532:	68 62 3d 80 00       	push   $0x803d62
+  801537:	68 2c 3d 80 00       	push   $0x803d2c
+  80153c:	6a 5c                	push   $0x5c
+  80153e:	68 77 3d 80 00       	push   $0x803d77
+  801543:	e8 02 20 00 00       	call   80354a <_panic>
+	}
+}
+  801548:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80154b:	5b                   	pop    %ebx
+  80154c:	5e                   	pop    %esi
+  80154d:	5f                   	pop    %edi
+  80154e:	5d                   	pop    %ebp
+  80154f:	c3                   	ret
+
+00801550 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801550:	55                   	push   %ebp
+  801551:	89 e5                	mov    %esp,%ebp
+  801553:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801556:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80155b:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  801561:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801567:	8b 52 50             	mov    0x50(%edx),%edx
+  80156a:	39 ca                	cmp    %ecx,%edx
+  80156c:	74 11                	je     80157f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80156e:	83 c0 01             	add    $0x1,%eax
+  801571:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801576:	75 e3                	jne    80155b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801578:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157d:	eb 0e                	jmp    80158d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80157f:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  801585:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80158a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80158d:	5d                   	pop    %ebp
+  80158e:	c3                   	ret
+
+0080158f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80158f:	55                   	push   %ebp
+  801590:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801592:	8b 45 08             	mov    0x8(%ebp),%eax
+  801595:	05 00 00 00 30       	add    $0x30000000,%eax
+  80159a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80159d:	5d                   	pop    %ebp
+  80159e:	c3                   	ret
+
+0080159f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80159f:	55                   	push   %ebp
+  8015a0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015a5:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8015aa:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8015af:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8015b4:	5d                   	pop    %ebp
+  8015b5:	c3                   	ret
+
+008015b6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8015b6:	55                   	push   %ebp
+  8015b7:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8015b9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8015be:	eb 02                	jmp    8015c2 <fd_alloc+0xc>
+  8015c0:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8015c2:	89 c2                	mov    %eax,%edx
+  8015c4:	c1 ea 16             	shr    $0x16,%edx
+  8015c7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8015ce:	f6 c2 01             	test   $0x1,%dl
+  8015d1:	74 2b                	je     8015fe <fd_alloc+0x48>
+  8015d3:	89 c2                	mov    %eax,%edx
+  8015d5:	c1 ea 0c             	shr    $0xc,%edx
+  8015d8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8015df:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8015e5:	f6 c1 01             	test   $0x1,%cl
+  8015e8:	74 14                	je     8015fe <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8015ea:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8015f0:	75 ce                	jne    8015c0 <fd_alloc+0xa>
+  8015f2:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8015f7:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8015fc:	eb 05                	jmp    801603 <fd_alloc+0x4d>
+			return 0;
+  8015fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801603:	8b 55 08             	mov    0x8(%ebp),%edx
+  801606:	89 02                	mov    %eax,(%edx)
+}
+  801608:	89 c8                	mov    %ecx,%eax
+  80160a:	5d                   	pop    %ebp
+  80160b:	c3                   	ret
+
+0080160c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80160c:	55                   	push   %ebp
+  80160d:	89 e5                	mov    %esp,%ebp
+  80160f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801612:	83 f8 1f             	cmp    $0x1f,%eax
+  801615:	77 30                	ja     801647 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801617:	c1 e0 0c             	shl    $0xc,%eax
+  80161a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80161f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801625:	f6 c2 01             	test   $0x1,%dl
+  801628:	74 24                	je     80164e <fd_lookup+0x42>
+  80162a:	89 c2                	mov    %eax,%edx
+  80162c:	c1 ea 0c             	shr    $0xc,%edx
+  80162f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801636:	f6 c2 01             	test   $0x1,%dl
+  801639:	74 1a                	je     801655 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80163b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80163e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801640:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801645:	5d                   	pop    %ebp
+  801646:	c3                   	ret
+		return -E_INVAL;
+  801647:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80164c:	eb f7                	jmp    801645 <fd_lookup+0x39>
+		return -E_INVAL;
+  80164e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801653:	eb f0                	jmp    801645 <fd_lookup+0x39>
+  801655:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80165a:	eb e9                	jmp    801645 <fd_lookup+0x39>
+
+0080165c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80165c:	55                   	push   %ebp
+  80165d:	89 e5                	mov    %esp,%ebp
+  80165f:	53                   	push   %ebx
+  801660:	83 ec 04             	sub    $0x4,%esp
+  801663:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801666:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166b:	eb 03                	jmp    801670 <dev_lookup+0x14>
+  80166d:	83 c0 01             	add    $0x1,%eax
+  801670:	8b 1c 85 00 3e 80 00 	mov    0x803e00(,%eax,4),%ebx
+  801677:	85 db                	test   %ebx,%ebx
+  801679:	74 0b                	je     801686 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80167b:	39 13                	cmp    %edx,(%ebx)
+  80167d:	75 ee                	jne    80166d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80167f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801684:	eb 1f                	jmp    8016a5 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801686:	a1 00 50 80 00       	mov    0x805000,%eax
+  80168b:	8b 40 48             	mov    0x48(%eax),%eax
+  80168e:	83 ec 04             	sub    $0x4,%esp
+  801691:	52                   	push   %edx
+  801692:	50                   	push   %eax
+  801693:	68 84 3d 80 00       	push   $0x803d84
+  801698:	e8 ff eb ff ff       	call   80029c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80169d:	83 c4 10             	add    $0x10,%esp
+  8016a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8016a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016a8:	89 1a                	mov    %ebx,(%edx)
+}
+  8016aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016ad:	c9                   	leave
+  8016ae:	c3                   	ret
+
+008016af <fd_close>:
+{
+  8016af:	55                   	push   %ebp
+  8016b0:	89 e5                	mov    %esp,%ebp
+  8016b2:	57                   	push   %edi
+  8016b3:	56                   	push   %esi
+  8016b4:	53                   	push   %ebx
+  8016b5:	83 ec 24             	sub    $0x24,%esp
+  8016b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8016bb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8016be:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016c1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8016c2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8016c8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8016cb:	50                   	push   %eax
+  8016cc:	e8 3b ff ff ff       	call   80160c <fd_lookup>
+  8016d1:	89 c3                	mov    %eax,%ebx
+  8016d3:	83 c4 10             	add    $0x10,%esp
+  8016d6:	85 c0                	test   %eax,%eax
+  8016d8:	78 05                	js     8016df <fd_close+0x30>
+	    || fd != fd2)
+  8016da:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8016dd:	74 16                	je     8016f5 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8016df:	89 f8                	mov    %edi,%eax
+  8016e1:	84 c0                	test   %al,%al
+  8016e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8016eb:	89 d8                	mov    %ebx,%eax
+  8016ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f0:	5b                   	pop    %ebx
+  8016f1:	5e                   	pop    %esi
+  8016f2:	5f                   	pop    %edi
+  8016f3:	5d                   	pop    %ebp
+  8016f4:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016f5:	83 ec 08             	sub    $0x8,%esp
+  8016f8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8016fb:	50                   	push   %eax
+  8016fc:	ff 36                	push   (%esi)
+  8016fe:	e8 59 ff ff ff       	call   80165c <dev_lookup>
+  801703:	89 c3                	mov    %eax,%ebx
+  801705:	83 c4 10             	add    $0x10,%esp
+  801708:	85 c0                	test   %eax,%eax
+  80170a:	78 1a                	js     801726 <fd_close+0x77>
+		if (dev->dev_close)
+  80170c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80170f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801712:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801717:	85 c0                	test   %eax,%eax
+  801719:	74 0b                	je     801726 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80171b:	83 ec 0c             	sub    $0xc,%esp
+  80171e:	56                   	push   %esi
+  80171f:	ff d0                	call   *%eax
+  801721:	89 c3                	mov    %eax,%ebx
+  801723:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801726:	83 ec 08             	sub    $0x8,%esp
+  801729:	56                   	push   %esi
+  80172a:	6a 00                	push   $0x0
+  80172c:	e8 f2 f5 ff ff       	call   800d23 <sys_page_unmap>
+	return r;
+  801731:	83 c4 10             	add    $0x10,%esp
+  801734:	eb b5                	jmp    8016eb <fd_close+0x3c>
+
+00801736 <close>:
+
+int
+close(int fdnum)
+{
+  801736:	55                   	push   %ebp
+  801737:	89 e5                	mov    %esp,%ebp
+  801739:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80173c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80173f:	50                   	push   %eax
+  801740:	ff 75 08             	push   0x8(%ebp)
+  801743:	e8 c4 fe ff ff       	call   80160c <fd_lookup>
+  801748:	83 c4 10             	add    $0x10,%esp
+  80174b:	85 c0                	test   %eax,%eax
+  80174d:	79 02                	jns    801751 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80174f:	c9                   	leave
+  801750:	c3                   	ret
+		return fd_close(fd, 1);
+  801751:	83 ec 08             	sub    $0x8,%esp
+  801754:	6a 01                	push   $0x1
+  801756:	ff 75 f4             	push   -0xc(%ebp)
+  801759:	e8 51 ff ff ff       	call   8016af <fd_close>
+  80175e:	83 c4 10             	add    $0x10,%esp
+  801761:	eb ec                	jmp    80174f <close+0x19>
+
+00801763 <close_all>:
+
+void
+close_all(void)
+{
+  801763:	55                   	push   %ebp
+  801764:	89 e5                	mov    %esp,%ebp
+  801766:	53                   	push   %ebx
+  801767:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80176a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80176f:	83 ec 0c             	sub    $0xc,%esp
+  801772:	53                   	push   %ebx
+  801773:	e8 be ff ff ff       	call   801736 <close>
+	for (i = 0; i < MAXFD; i++)
+  801778:	83 c3 01             	add    $0x1,%ebx
+  80177b:	83 c4 10             	add    $0x10,%esp
+  80177e:	83 fb 20             	cmp    $0x20,%ebx
+  801781:	75 ec                	jne    80176f <close_all+0xc>
+}
+  801783:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801786:	c9                   	leave
+  801787:	c3                   	ret
+
+00801788 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801788:	55                   	push   %ebp
+  801789:	89 e5                	mov    %esp,%ebp
+  80178b:	57                   	push   %edi
+  80178c:	56                   	push   %esi
+  80178d:	53                   	push   %ebx
+  80178e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801791:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801794:	50                   	push   %eax
+  801795:	ff 75 08             	push   0x8(%ebp)
+  801798:	e8 6f fe ff ff       	call   80160c <fd_lookup>
+  80179d:	89 c3                	mov    %eax,%ebx
+  80179f:	83 c4 10             	add    $0x10,%esp
+  8017a2:	85 c0                	test   %eax,%eax
+  8017a4:	78 7f                	js     801825 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8017a6:	83 ec 0c             	sub    $0xc,%esp
+  8017a9:	ff 75 0c             	push   0xc(%ebp)
+  8017ac:	e8 85 ff ff ff       	call   801736 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8017b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8017b4:	c1 e6 0c             	shl    $0xc,%esi
+  8017b7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8017bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8017c0:	89 3c 24             	mov    %edi,(%esp)
+  8017c3:	e8 d7 fd ff ff       	call   80159f <fd2data>
+  8017c8:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8017ca:	89 34 24             	mov    %esi,(%esp)
+  8017cd:	e8 cd fd ff ff       	call   80159f <fd2data>
+  8017d2:	83 c4 10             	add    $0x10,%esp
+  8017d5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8017d8:	89 d8                	mov    %ebx,%eax
+  8017da:	c1 e8 16             	shr    $0x16,%eax
+  8017dd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8017e4:	a8 01                	test   $0x1,%al
+  8017e6:	74 11                	je     8017f9 <dup+0x71>
+  8017e8:	89 d8                	mov    %ebx,%eax
+  8017ea:	c1 e8 0c             	shr    $0xc,%eax
+  8017ed:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017f4:	f6 c2 01             	test   $0x1,%dl
+  8017f7:	75 36                	jne    80182f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8017f9:	89 f8                	mov    %edi,%eax
+  8017fb:	c1 e8 0c             	shr    $0xc,%eax
+  8017fe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801805:	83 ec 0c             	sub    $0xc,%esp
+  801808:	25 07 0e 00 00       	and    $0xe07,%eax
+  80180d:	50                   	push   %eax
+  80180e:	56                   	push   %esi
+  80180f:	6a 00                	push   $0x0
+  801811:	57                   	push   %edi
+  801812:	6a 00                	push   $0x0
+  801814:	e8 c8 f4 ff ff       	call   800ce1 <sys_page_map>
+  801819:	89 c3                	mov    %eax,%ebx
+  80181b:	83 c4 20             	add    $0x20,%esp
+  80181e:	85 c0                	test   %eax,%eax
+  801820:	78 33                	js     801855 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801822:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801825:	89 d8                	mov    %ebx,%eax
+  801827:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80182a:	5b                   	pop    %ebx
+  80182b:	5e                   	pop    %esi
+  80182c:	5f                   	pop    %edi
+  80182d:	5d                   	pop    %ebp
+  80182e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80182f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801836:	83 ec 0c             	sub    $0xc,%esp
+  801839:	25 07 0e 00 00       	and    $0xe07,%eax
+  80183e:	50                   	push   %eax
+  80183f:	ff 75 d4             	push   -0x2c(%ebp)
+  801842:	6a 00                	push   $0x0
+  801844:	53                   	push   %ebx
+  801845:	6a 00                	push   $0x0
+  801847:	e8 95 f4 ff ff       	call   800ce1 <sys_page_map>
+  80184c:	89 c3                	mov    %eax,%ebx
+  80184e:	83 c4 20             	add    $0x20,%esp
+  801851:	85 c0                	test   %eax,%eax
+  801853:	79 a4                	jns    8017f9 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801855:	83 ec 08             	sub    $0x8,%esp
+  801858:	56                   	push   %esi
+  801859:	6a 00                	push   $0x0
+  80185b:	e8 c3 f4 ff ff       	call   800d23 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801860:	83 c4 08             	add    $0x8,%esp
+  801863:	ff 75 d4             	push   -0x2c(%ebp)
+  801866:	6a 00                	push   $0x0
+  801868:	e8 b6 f4 ff ff       	call   800d23 <sys_page_unmap>
+	return r;
+  80186d:	83 c4 10             	add    $0x10,%esp
+  801870:	eb b3                	jmp    801825 <dup+0x9d>
+
+00801872 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801872:	55                   	push   %ebp
+  801873:	89 e5                	mov    %esp,%ebp
+  801875:	56                   	push   %esi
+  801876:	53                   	push   %ebx
+  801877:	83 ec 18             	sub    $0x18,%esp
+  80187a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80187d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801880:	50                   	push   %eax
+  801881:	56                   	push   %esi
+  801882:	e8 85 fd ff ff       	call   80160c <fd_lookup>
+  801887:	83 c4 10             	add    $0x10,%esp
+  80188a:	85 c0                	test   %eax,%eax
+  80188c:	78 3c                	js     8018ca <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80188e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801891:	83 ec 08             	sub    $0x8,%esp
+  801894:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801897:	50                   	push   %eax
+  801898:	ff 33                	push   (%ebx)
+  80189a:	e8 bd fd ff ff       	call   80165c <dev_lookup>
+  80189f:	83 c4 10             	add    $0x10,%esp
+  8018a2:	85 c0                	test   %eax,%eax
+  8018a4:	78 24                	js     8018ca <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8018a6:	8b 43 08             	mov    0x8(%ebx),%eax
+  8018a9:	83 e0 03             	and    $0x3,%eax
+  8018ac:	83 f8 01             	cmp    $0x1,%eax
+  8018af:	74 20                	je     8018d1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8018b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018b4:	8b 40 08             	mov    0x8(%eax),%eax
+  8018b7:	85 c0                	test   %eax,%eax
+  8018b9:	74 37                	je     8018f2 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8018bb:	83 ec 04             	sub    $0x4,%esp
+  8018be:	ff 75 10             	push   0x10(%ebp)
+  8018c1:	ff 75 0c             	push   0xc(%ebp)
+  8018c4:	53                   	push   %ebx
+  8018c5:	ff d0                	call   *%eax
+  8018c7:	83 c4 10             	add    $0x10,%esp
+}
+  8018ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018cd:	5b                   	pop    %ebx
+  8018ce:	5e                   	pop    %esi
+  8018cf:	5d                   	pop    %ebp
+  8018d0:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018d1:	a1 00 50 80 00       	mov    0x805000,%eax
+  8018d6:	8b 40 48             	mov    0x48(%eax),%eax
+  8018d9:	83 ec 04             	sub    $0x4,%esp
+  8018dc:	56                   	push   %esi
+  8018dd:	50                   	push   %eax
+  8018de:	68 c5 3d 80 00       	push   $0x803dc5
+  8018e3:	e8 b4 e9 ff ff       	call   80029c <cprintf>
+		return -E_INVAL;
+  8018e8:	83 c4 10             	add    $0x10,%esp
+  8018eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018f0:	eb d8                	jmp    8018ca <read+0x58>
+		return -E_NOT_SUPP;
+  8018f2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018f7:	eb d1                	jmp    8018ca <read+0x58>
+
+008018f9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8018f9:	55                   	push   %ebp
+  8018fa:	89 e5                	mov    %esp,%ebp
+  8018fc:	57                   	push   %edi
+  8018fd:	56                   	push   %esi
+  8018fe:	53                   	push   %ebx
+  8018ff:	83 ec 0c             	sub    $0xc,%esp
+  801902:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801905:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801908:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80190d:	eb 02                	jmp    801911 <readn+0x18>
+  80190f:	01 c3                	add    %eax,%ebx
+  801911:	39 f3                	cmp    %esi,%ebx
+  801913:	73 21                	jae    801936 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801915:	83 ec 04             	sub    $0x4,%esp
+  801918:	89 f0                	mov    %esi,%eax
+  80191a:	29 d8                	sub    %ebx,%eax
+  80191c:	50                   	push   %eax
+  80191d:	89 d8                	mov    %ebx,%eax
+  80191f:	03 45 0c             	add    0xc(%ebp),%eax
+  801922:	50                   	push   %eax
+  801923:	57                   	push   %edi
+  801924:	e8 49 ff ff ff       	call   801872 <read>
+		if (m < 0)
+  801929:	83 c4 10             	add    $0x10,%esp
+  80192c:	85 c0                	test   %eax,%eax
+  80192e:	78 04                	js     801934 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801930:	75 dd                	jne    80190f <readn+0x16>
+  801932:	eb 02                	jmp    801936 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801934:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801936:	89 d8                	mov    %ebx,%eax
+  801938:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80193b:	5b                   	pop    %ebx
+  80193c:	5e                   	pop    %esi
+  80193d:	5f                   	pop    %edi
+  80193e:	5d                   	pop    %ebp
+  80193f:	c3                   	ret
+
+00801940 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801940:	55                   	push   %ebp
+  801941:	89 e5                	mov    %esp,%ebp
+  801943:	56                   	push   %esi
+  801944:	53                   	push   %ebx
+  801945:	83 ec 18             	sub    $0x18,%esp
+  801948:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80194b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80194e:	50                   	push   %eax
+  80194f:	53                   	push   %ebx
+  801950:	e8 b7 fc ff ff       	call   80160c <fd_lookup>
+  801955:	83 c4 10             	add    $0x10,%esp
+  801958:	85 c0                	test   %eax,%eax
+  80195a:	78 37                	js     801993 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80195c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80195f:	83 ec 08             	sub    $0x8,%esp
+  801962:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801965:	50                   	push   %eax
+  801966:	ff 36                	push   (%esi)
+  801968:	e8 ef fc ff ff       	call   80165c <dev_lookup>
+  80196d:	83 c4 10             	add    $0x10,%esp
+  801970:	85 c0                	test   %eax,%eax
+  801972:	78 1f                	js     801993 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801974:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801978:	74 20                	je     80199a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80197a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80197d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801980:	85 c0                	test   %eax,%eax
+  801982:	74 37                	je     8019bb <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801984:	83 ec 04             	sub    $0x4,%esp
+  801987:	ff 75 10             	push   0x10(%ebp)
+  80198a:	ff 75 0c             	push   0xc(%ebp)
+  80198d:	56                   	push   %esi
+  80198e:	ff d0                	call   *%eax
+  801990:	83 c4 10             	add    $0x10,%esp
+}
+  801993:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801996:	5b                   	pop    %ebx
+  801997:	5e                   	pop    %esi
+  801998:	5d                   	pop    %ebp
+  801999:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80199a:	a1 00 50 80 00       	mov    0x805000,%eax
+  80199f:	8b 40 48             	mov    0x48(%eax),%eax
+  8019a2:	83 ec 04             	sub    $0x4,%esp
+  8019a5:	53                   	push   %ebx
+  8019a6:	50                   	push   %eax
+  8019a7:	68 e1 3d 80 00       	push   $0x803de1
+  8019ac:	e8 eb e8 ff ff       	call   80029c <cprintf>
+		return -E_INVAL;
+  8019b1:	83 c4 10             	add    $0x10,%esp
+  8019b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019b9:	eb d8                	jmp    801993 <write+0x53>
+		return -E_NOT_SUPP;
+  8019bb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019c0:	eb d1                	jmp    801993 <write+0x53>
+
+008019c2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8019c2:	55                   	push   %ebp
+  8019c3:	89 e5                	mov    %esp,%ebp
+  8019c5:	53                   	push   %ebx
+  8019c6:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019c9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019cc:	50                   	push   %eax
+  8019cd:	ff 75 08             	push   0x8(%ebp)
+  8019d0:	e8 37 fc ff ff       	call   80160c <fd_lookup>
+  8019d5:	83 c4 10             	add    $0x10,%esp
+  8019d8:	85 c0                	test   %eax,%eax
+  8019da:	78 3a                	js     801a16 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019dc:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8019df:	83 ec 08             	sub    $0x8,%esp
+  8019e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019e5:	50                   	push   %eax
+  8019e6:	ff 33                	push   (%ebx)
+  8019e8:	e8 6f fc ff ff       	call   80165c <dev_lookup>
+  8019ed:	83 c4 10             	add    $0x10,%esp
+  8019f0:	85 c0                	test   %eax,%eax
+  8019f2:	78 22                	js     801a16 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8019f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019f7:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8019fa:	85 c0                	test   %eax,%eax
+  8019fc:	74 0d                	je     801a0b <seek+0x49>
+  8019fe:	83 ec 0c             	sub    $0xc,%esp
+  801a01:	53                   	push   %ebx
+  801a02:	ff d0                	call   *%eax
+  801a04:	83 c4 10             	add    $0x10,%esp
+  801a07:	85 c0                	test   %eax,%eax
+  801a09:	78 0b                	js     801a16 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801a0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a0e:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801a11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a19:	c9                   	leave
+  801a1a:	c3                   	ret
+
+00801a1b <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801a1b:	55                   	push   %ebp
+  801a1c:	89 e5                	mov    %esp,%ebp
+  801a1e:	53                   	push   %ebx
+  801a1f:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a22:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a25:	50                   	push   %eax
+  801a26:	ff 75 08             	push   0x8(%ebp)
+  801a29:	e8 de fb ff ff       	call   80160c <fd_lookup>
+  801a2e:	83 c4 10             	add    $0x10,%esp
+  801a31:	85 c0                	test   %eax,%eax
+  801a33:	78 2b                	js     801a60 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a35:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801a38:	83 ec 08             	sub    $0x8,%esp
+  801a3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a3e:	50                   	push   %eax
+  801a3f:	ff 33                	push   (%ebx)
+  801a41:	e8 16 fc ff ff       	call   80165c <dev_lookup>
+  801a46:	83 c4 10             	add    $0x10,%esp
+  801a49:	85 c0                	test   %eax,%eax
+  801a4b:	78 13                	js     801a60 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801a4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a50:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801a53:	85 c0                	test   %eax,%eax
+  801a55:	74 0e                	je     801a65 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801a57:	83 ec 0c             	sub    $0xc,%esp
+  801a5a:	53                   	push   %ebx
+  801a5b:	ff d0                	call   *%eax
+  801a5d:	83 c4 10             	add    $0x10,%esp
+}
+  801a60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a63:	c9                   	leave
+  801a64:	c3                   	ret
+		return 0;
+  801a65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6a:	eb f4                	jmp    801a60 <fsync+0x45>
+
+00801a6c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801a6c:	55                   	push   %ebp
+  801a6d:	89 e5                	mov    %esp,%ebp
+  801a6f:	56                   	push   %esi
+  801a70:	53                   	push   %ebx
+  801a71:	83 ec 18             	sub    $0x18,%esp
+  801a74:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a77:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a7a:	50                   	push   %eax
+  801a7b:	53                   	push   %ebx
+  801a7c:	e8 8b fb ff ff       	call   80160c <fd_lookup>
+  801a81:	83 c4 10             	add    $0x10,%esp
+  801a84:	85 c0                	test   %eax,%eax
+  801a86:	78 34                	js     801abc <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a88:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a8b:	83 ec 08             	sub    $0x8,%esp
+  801a8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a91:	50                   	push   %eax
+  801a92:	ff 36                	push   (%esi)
+  801a94:	e8 c3 fb ff ff       	call   80165c <dev_lookup>
+  801a99:	83 c4 10             	add    $0x10,%esp
+  801a9c:	85 c0                	test   %eax,%eax
+  801a9e:	78 1c                	js     801abc <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801aa0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801aa4:	74 1d                	je     801ac3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801aa6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa9:	8b 40 18             	mov    0x18(%eax),%eax
+  801aac:	85 c0                	test   %eax,%eax
+  801aae:	74 34                	je     801ae4 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801ab0:	83 ec 08             	sub    $0x8,%esp
+  801ab3:	ff 75 0c             	push   0xc(%ebp)
+  801ab6:	56                   	push   %esi
+  801ab7:	ff d0                	call   *%eax
+  801ab9:	83 c4 10             	add    $0x10,%esp
+}
+  801abc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801abf:	5b                   	pop    %ebx
+  801ac0:	5e                   	pop    %esi
+  801ac1:	5d                   	pop    %ebp
+  801ac2:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801ac3:	a1 00 50 80 00       	mov    0x805000,%eax
+  801ac8:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801acb:	83 ec 04             	sub    $0x4,%esp
+  801ace:	53                   	push   %ebx
+  801acf:	50                   	push   %eax
+  801ad0:	68 a4 3d 80 00       	push   $0x803da4
+  801ad5:	e8 c2 e7 ff ff       	call   80029c <cprintf>
+		return -E_INVAL;
+  801ada:	83 c4 10             	add    $0x10,%esp
+  801add:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ae2:	eb d8                	jmp    801abc <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801ae4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ae9:	eb d1                	jmp    801abc <ftruncate+0x50>
+
+00801aeb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801aeb:	55                   	push   %ebp
+  801aec:	89 e5                	mov    %esp,%ebp
+  801aee:	56                   	push   %esi
+  801aef:	53                   	push   %ebx
+  801af0:	83 ec 18             	sub    $0x18,%esp
+  801af3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801af6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801af9:	50                   	push   %eax
+  801afa:	ff 75 08             	push   0x8(%ebp)
+  801afd:	e8 0a fb ff ff       	call   80160c <fd_lookup>
+  801b02:	83 c4 10             	add    $0x10,%esp
+  801b05:	85 c0                	test   %eax,%eax
+  801b07:	78 49                	js     801b52 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b09:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b0c:	83 ec 08             	sub    $0x8,%esp
+  801b0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b12:	50                   	push   %eax
+  801b13:	ff 36                	push   (%esi)
+  801b15:	e8 42 fb ff ff       	call   80165c <dev_lookup>
+  801b1a:	83 c4 10             	add    $0x10,%esp
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	78 31                	js     801b52 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801b21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b24:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b28:	74 2f                	je     801b59 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801b2a:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801b2d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b34:	00 00 00 
+	stat->st_isdir = 0;
+  801b37:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b3e:	00 00 00 
+	stat->st_dev = dev;
+  801b41:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801b47:	83 ec 08             	sub    $0x8,%esp
+  801b4a:	53                   	push   %ebx
+  801b4b:	56                   	push   %esi
+  801b4c:	ff 50 14             	call   *0x14(%eax)
+  801b4f:	83 c4 10             	add    $0x10,%esp
+}
+  801b52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b55:	5b                   	pop    %ebx
+  801b56:	5e                   	pop    %esi
+  801b57:	5d                   	pop    %ebp
+  801b58:	c3                   	ret
+		return -E_NOT_SUPP;
+  801b59:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b5e:	eb f2                	jmp    801b52 <fstat+0x67>
+
+00801b60 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801b60:	55                   	push   %ebp
+  801b61:	89 e5                	mov    %esp,%ebp
+  801b63:	56                   	push   %esi
+  801b64:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801b65:	83 ec 08             	sub    $0x8,%esp
+  801b68:	68 00 10 00 00       	push   $0x1000
+  801b6d:	ff 75 08             	push   0x8(%ebp)
+  801b70:	e8 b3 07 00 00       	call   802328 <open>
+  801b75:	89 c3                	mov    %eax,%ebx
+  801b77:	83 c4 10             	add    $0x10,%esp
+  801b7a:	85 c0                	test   %eax,%eax
+  801b7c:	78 1b                	js     801b99 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801b7e:	83 ec 08             	sub    $0x8,%esp
+  801b81:	ff 75 0c             	push   0xc(%ebp)
+  801b84:	50                   	push   %eax
+  801b85:	e8 61 ff ff ff       	call   801aeb <fstat>
+  801b8a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801b8c:	89 1c 24             	mov    %ebx,(%esp)
+  801b8f:	e8 a2 fb ff ff       	call   801736 <close>
+	return r;
+  801b94:	83 c4 10             	add    $0x10,%esp
+  801b97:	89 f3                	mov    %esi,%ebx
+}
+  801b99:	89 d8                	mov    %ebx,%eax
+  801b9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b9e:	5b                   	pop    %ebx
+  801b9f:	5e                   	pop    %esi
+  801ba0:	5d                   	pop    %ebp
+  801ba1:	c3                   	ret
+
+00801ba2 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801ba2:	55                   	push   %ebp
+  801ba3:	89 e5                	mov    %esp,%ebp
+  801ba5:	57                   	push   %edi
+  801ba6:	56                   	push   %esi
+  801ba7:	53                   	push   %ebx
+  801ba8:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801bae:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801bb4:	89 d6                	mov    %edx,%esi
+  801bb6:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801bbc:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801bbf:	89 d3                	mov    %edx,%ebx
+  801bc1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801bc7:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801bce:	74 1d                	je     801bed <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801bd0:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801bd5:	83 c8 07             	or     $0x7,%eax
+  801bd8:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801bde:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801be3:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801be9:	01 ce                	add    %ecx,%esi
+  801beb:	eb 28                	jmp    801c15 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801bed:	83 ec 0c             	sub    $0xc,%esp
+  801bf0:	6a 01                	push   $0x1
+  801bf2:	e8 59 f9 ff ff       	call   801550 <ipc_find_env>
+  801bf7:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801bfc:	83 c4 10             	add    $0x10,%esp
+  801bff:	eb cf                	jmp    801bd0 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801c01:	83 c0 01             	add    $0x1,%eax
+  801c04:	89 fa                	mov    %edi,%edx
+  801c06:	09 da                	or     %ebx,%edx
+  801c08:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801c0f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c15:	39 f3                	cmp    %esi,%ebx
+  801c17:	72 e8                	jb     801c01 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801c19:	83 f8 41             	cmp    $0x41,%eax
+  801c1c:	77 2f                	ja     801c4d <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801c1e:	50                   	push   %eax
+  801c1f:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801c25:	50                   	push   %eax
+  801c26:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801c2c:	ff 35 c8 70 80 00    	push   0x8070c8
+  801c32:	e8 cb f8 ff ff       	call   801502 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801c37:	83 c4 0c             	add    $0xc,%esp
+  801c3a:	6a 00                	push   $0x0
+  801c3c:	6a 00                	push   $0x0
+  801c3e:	6a 00                	push   $0x0
+  801c40:	e8 67 f7 ff ff       	call   8013ac <ipc_recv>
+}
+  801c45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c48:	5b                   	pop    %ebx
+  801c49:	5e                   	pop    %esi
+  801c4a:	5f                   	pop    %edi
+  801c4b:	5d                   	pop    %ebp
+  801c4c:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801c4d:	68 14 3e 80 00       	push   $0x803e14
+  801c52:	68 2c 3d 80 00       	push   $0x803d2c
+  801c57:	6a 40                	push   $0x40
+  801c59:	68 30 3e 80 00       	push   $0x803e30
+  801c5e:	e8 e7 18 00 00       	call   80354a <_panic>
+
+00801c63 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801c63:	55                   	push   %ebp
+  801c64:	89 e5                	mov    %esp,%ebp
+  801c66:	57                   	push   %edi
+  801c67:	56                   	push   %esi
+  801c68:	53                   	push   %ebx
+  801c69:	83 ec 1c             	sub    $0x1c,%esp
+  801c6c:	89 c3                	mov    %eax,%ebx
+  801c6e:	89 d6                	mov    %edx,%esi
+  801c70:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801c73:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801c79:	89 ca                	mov    %ecx,%edx
+  801c7b:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801c7e:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801c85:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801c88:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801c8f:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c92:	89 fb                	mov    %edi,%ebx
+  801c94:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801c9b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c9e:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801ca5:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ca8:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801caf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cb2:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801cb9:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801cbc:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801cc3:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801cc8:	39 c8                	cmp    %ecx,%eax
+  801cca:	74 0d                	je     801cd9 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801ccc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cd4:	5b                   	pop    %ebx
+  801cd5:	5e                   	pop    %esi
+  801cd6:	5f                   	pop    %edi
+  801cd7:	5d                   	pop    %ebp
+  801cd8:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801cd9:	6a 07                	push   $0x7
+  801cdb:	68 00 60 80 00       	push   $0x806000
+  801ce0:	6a 0d                	push   $0xd
+  801ce2:	ff 35 c8 70 80 00    	push   0x8070c8
+  801ce8:	e8 2a f7 ff ff       	call   801417 <ipc_send>
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	eb da                	jmp    801ccc <fsring_post+0x69>
+
+00801cf2 <fsipcv>:
+{
+  801cf2:	55                   	push   %ebp
+  801cf3:	89 e5                	mov    %esp,%ebp
+  801cf5:	57                   	push   %edi
+  801cf6:	56                   	push   %esi
+  801cf7:	53                   	push   %ebx
+  801cf8:	83 ec 0c             	sub    $0xc,%esp
+  801cfb:	89 c7                	mov    %eax,%edi
+  801cfd:	89 d3                	mov    %edx,%ebx
+  801cff:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801d01:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801d08:	74 26                	je     801d30 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801d0a:	6a 07                	push   $0x7
+  801d0c:	68 00 60 80 00       	push   $0x806000
+  801d11:	57                   	push   %edi
+  801d12:	ff 35 c8 70 80 00    	push   0x8070c8
+  801d18:	e8 fa f6 ff ff       	call   801417 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801d1d:	6a 00                	push   $0x0
+  801d1f:	56                   	push   %esi
+  801d20:	53                   	push   %ebx
+  801d21:	6a 00                	push   $0x0
+  801d23:	e8 47 f7 ff ff       	call   80146f <ipc_recvv>
+}
+  801d28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d2b:	5b                   	pop    %ebx
+  801d2c:	5e                   	pop    %esi
+  801d2d:	5f                   	pop    %edi
+  801d2e:	5d                   	pop    %ebp
+  801d2f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d30:	83 ec 0c             	sub    $0xc,%esp
+  801d33:	6a 01                	push   $0x1
+  801d35:	e8 16 f8 ff ff       	call   801550 <ipc_find_env>
+  801d3a:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801d3f:	83 c4 10             	add    $0x10,%esp
+  801d42:	eb c6                	jmp    801d0a <fsipcv+0x18>
+
+00801d44 <fsipc>:
+{
+  801d44:	55                   	push   %ebp
+  801d45:	89 e5                	mov    %esp,%ebp
+  801d47:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801d4a:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801d51:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801d54:	e8 99 ff ff ff       	call   801cf2 <fsipcv>
+}
+  801d59:	c9                   	leave
+  801d5a:	c3                   	ret
+
+00801d5b <file_write_direct>:
+{
+  801d5b:	55                   	push   %ebp
+  801d5c:	89 e5                	mov    %esp,%ebp
+  801d5e:	56                   	push   %esi
+  801d5f:	53                   	push   %ebx
+  801d60:	89 c3                	mov    %eax,%ebx
+  801d62:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801d64:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801d6a:	77 40                	ja     801dac <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801d6c:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801d71:	39 c8                	cmp    %ecx,%eax
+  801d73:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d76:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801d79:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  801d7f:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801d84:	83 ec 04             	sub    $0x4,%esp
+  801d87:	50                   	push   %eax
+  801d88:	52                   	push   %edx
+  801d89:	68 08 60 80 00       	push   $0x806008
+  801d8e:	e8 7d ec ff ff       	call   800a10 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801d93:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d98:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d9d:	e8 a2 ff ff ff       	call   801d44 <fsipc>
+  801da2:	83 c4 10             	add    $0x10,%esp
+}
+  801da5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da8:	5b                   	pop    %ebx
+  801da9:	5e                   	pop    %esi
+  801daa:	5d                   	pop    %ebp
+  801dab:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801dac:	89 d6                	mov    %edx,%esi
+  801dae:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801db4:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801db9:	29 f1                	sub    %esi,%ecx
+  801dbb:	39 c1                	cmp    %eax,%ecx
+  801dbd:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801dc0:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801dc3:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801dc8:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801dce:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801dd4:	83 ec 0c             	sub    $0xc,%esp
+  801dd7:	6a 05                	push   $0x5
+  801dd9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801dde:	e8 bf fd ff ff       	call   801ba2 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801de3:	83 c4 10             	add    $0x10,%esp
+  801de6:	eb bd                	jmp    801da5 <file_write_direct+0x4a>
+
+00801de8 <devfile_sync>:
+{
+  801de8:	55                   	push   %ebp
+  801de9:	89 e5                	mov    %esp,%ebp
+  801deb:	57                   	push   %edi
+  801dec:	56                   	push   %esi
+  801ded:	53                   	push   %ebx
+  801dee:	83 ec 28             	sub    $0x28,%esp
+  801df1:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801df4:	56                   	push   %esi
+  801df5:	e8 a5 f7 ff ff       	call   80159f <fd2data>
+  801dfa:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801dfc:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801dff:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801e06:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801e09:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801e0e:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801e12:	74 45                	je     801e59 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801e14:	8b 46 14             	mov    0x14(%esi),%eax
+  801e17:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e24:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801e27:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801e2a:	39 cb                	cmp    %ecx,%ebx
+  801e2c:	73 14                	jae    801e42 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801e2e:	29 d9                	sub    %ebx,%ecx
+  801e30:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801e33:	89 f0                	mov    %esi,%eax
+  801e35:	e8 21 ff ff ff       	call   801d5b <file_write_direct>
+  801e3a:	85 c0                	test   %eax,%eax
+  801e3c:	7e 04                	jle    801e42 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801e3e:	01 c3                	add    %eax,%ebx
+  801e40:	eb e5                	jmp    801e27 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801e42:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e45:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801e4c:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801e4f:	85 c0                	test   %eax,%eax
+  801e51:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e56:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801e59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e5c:	5b                   	pop    %ebx
+  801e5d:	5e                   	pop    %esi
+  801e5e:	5f                   	pop    %edi
+  801e5f:	5d                   	pop    %ebp
+  801e60:	c3                   	ret
+
+00801e61 <devfile_write>:
+{
+  801e61:	55                   	push   %ebp
+  801e62:	89 e5                	mov    %esp,%ebp
+  801e64:	57                   	push   %edi
+  801e65:	56                   	push   %esi
+  801e66:	53                   	push   %ebx
+  801e67:	83 ec 28             	sub    $0x28,%esp
+  801e6a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e6d:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801e70:	53                   	push   %ebx
+  801e71:	e8 29 f7 ff ff       	call   80159f <fd2data>
+  801e76:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801e79:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801e7c:	83 c4 10             	add    $0x10,%esp
+  801e7f:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801e83:	74 43                	je     801ec8 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801e85:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801e8c:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801e8f:	85 c0                	test   %eax,%eax
+  801e91:	74 43                	je     801ed6 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801e93:	89 c2                	mov    %eax,%edx
+  801e95:	03 53 14             	add    0x14(%ebx),%edx
+  801e98:	39 fa                	cmp    %edi,%edx
+  801e9a:	75 0b                	jne    801ea7 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801e9c:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801e9f:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801ea5:	76 66                	jbe    801f0d <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801ea7:	83 ec 0c             	sub    $0xc,%esp
+  801eaa:	53                   	push   %ebx
+  801eab:	e8 38 ff ff ff       	call   801de8 <devfile_sync>
+  801eb0:	83 c4 10             	add    $0x10,%esp
+  801eb3:	85 c0                	test   %eax,%eax
+  801eb5:	78 4e                	js     801f05 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801eb7:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801ebd:	77 56                	ja     801f15 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801ebf:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801ec2:	85 c0                	test   %eax,%eax
+  801ec4:	75 20                	jne    801ee6 <devfile_write+0x85>
+  801ec6:	eb 16                	jmp    801ede <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801ec8:	89 f1                	mov    %esi,%ecx
+  801eca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ecd:	89 d8                	mov    %ebx,%eax
+  801ecf:	e8 87 fe ff ff       	call   801d5b <file_write_direct>
+  801ed4:	eb 2f                	jmp    801f05 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801ed6:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801edc:	77 37                	ja     801f15 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801ede:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801ee6:	83 ec 04             	sub    $0x4,%esp
+  801ee9:	56                   	push   %esi
+  801eea:	ff 75 0c             	push   0xc(%ebp)
+  801eed:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801ef0:	01 c1                	add    %eax,%ecx
+  801ef2:	51                   	push   %ecx
+  801ef3:	e8 18 eb ff ff       	call   800a10 <memmove>
+	ff->buf_wlen += n;
+  801ef8:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801efb:	01 f7                	add    %esi,%edi
+  801efd:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801f00:	89 f0                	mov    %esi,%eax
+  801f02:	83 c4 10             	add    $0x10,%esp
+}
+  801f05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f08:	5b                   	pop    %ebx
+  801f09:	5e                   	pop    %esi
+  801f0a:	5f                   	pop    %edi
+  801f0b:	5d                   	pop    %ebp
+  801f0c:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801f0d:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801f13:	76 d1                	jbe    801ee6 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801f15:	89 f1                	mov    %esi,%ecx
+  801f17:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f1a:	89 d8                	mov    %ebx,%eax
+  801f1c:	e8 3a fe ff ff       	call   801d5b <file_write_direct>
+  801f21:	eb e2                	jmp    801f05 <devfile_write+0xa4>
+
+00801f23 <devfile_trunc>:
+{
+  801f23:	55                   	push   %ebp
+  801f24:	89 e5                	mov    %esp,%ebp
+  801f26:	53                   	push   %ebx
+  801f27:	83 ec 10             	sub    $0x10,%esp
+  801f2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801f2d:	53                   	push   %ebx
+  801f2e:	e8 b5 fe ff ff       	call   801de8 <devfile_sync>
+  801f33:	83 c4 10             	add    $0x10,%esp
+  801f36:	85 c0                	test   %eax,%eax
+  801f38:	78 1f                	js     801f59 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f3a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801f3d:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801f42:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f45:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801f4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f54:	e8 eb fd ff ff       	call   801d44 <fsipc>
+}
+  801f59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f5c:	c9                   	leave
+  801f5d:	c3                   	ret
+
+00801f5e <devfile_stat>:
+{
+  801f5e:	55                   	push   %ebp
+  801f5f:	89 e5                	mov    %esp,%ebp
+  801f61:	56                   	push   %esi
+  801f62:	53                   	push   %ebx
+  801f63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f66:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801f69:	83 ec 0c             	sub    $0xc,%esp
+  801f6c:	53                   	push   %ebx
+  801f6d:	e8 76 fe ff ff       	call   801de8 <devfile_sync>
+  801f72:	83 c4 10             	add    $0x10,%esp
+  801f75:	85 c0                	test   %eax,%eax
+  801f77:	78 47                	js     801fc0 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f79:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801f7c:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f81:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f86:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f8b:	e8 b4 fd ff ff       	call   801d44 <fsipc>
+  801f90:	85 c0                	test   %eax,%eax
+  801f92:	78 2c                	js     801fc0 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f94:	83 ec 08             	sub    $0x8,%esp
+  801f97:	68 00 60 80 00       	push   $0x806000
+  801f9c:	56                   	push   %esi
+  801f9d:	e8 e8 e8 ff ff       	call   80088a <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801fa2:	a1 80 60 80 00       	mov    0x806080,%eax
+  801fa7:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801fad:	a1 84 60 80 00       	mov    0x806084,%eax
+  801fb2:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801fb8:	83 c4 10             	add    $0x10,%esp
+  801fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fc0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc3:	5b                   	pop    %ebx
+  801fc4:	5e                   	pop    %esi
+  801fc5:	5d                   	pop    %ebp
+  801fc6:	c3                   	ret
+
+00801fc7 <devfile_flush>:
+{
+  801fc7:	55                   	push   %ebp
+  801fc8:	89 e5                	mov    %esp,%ebp
+  801fca:	56                   	push   %esi
+  801fcb:	53                   	push   %ebx
+  801fcc:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801fcf:	83 ec 0c             	sub    $0xc,%esp
+  801fd2:	56                   	push   %esi
+  801fd3:	e8 10 fe ff ff       	call   801de8 <devfile_sync>
+  801fd8:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801fda:	83 c4 10             	add    $0x10,%esp
+  801fdd:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801fe1:	75 25                	jne    802008 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801fe3:	8b 46 0c             	mov    0xc(%esi),%eax
+  801fe6:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801feb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff0:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ff5:	e8 4a fd ff ff       	call   801d44 <fsipc>
+  801ffa:	85 c0                	test   %eax,%eax
+  801ffc:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801fff:	89 d8                	mov    %ebx,%eax
+  802001:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802004:	5b                   	pop    %ebx
+  802005:	5e                   	pop    %esi
+  802006:	5d                   	pop    %ebp
+  802007:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  802008:	83 ec 0c             	sub    $0xc,%esp
+  80200b:	56                   	push   %esi
+  80200c:	e8 8e f5 ff ff       	call   80159f <fd2data>
+  802011:	83 c4 08             	add    $0x8,%esp
+  802014:	50                   	push   %eax
+  802015:	6a 00                	push   $0x0
+  802017:	e8 07 ed ff ff       	call   800d23 <sys_page_unmap>
+  80201c:	83 c4 10             	add    $0x10,%esp
+  80201f:	eb c2                	jmp    801fe3 <devfile_flush+0x1c>
+
+00802021 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  802021:	55                   	push   %ebp
+  802022:	89 e5                	mov    %esp,%ebp
+  802024:	57                   	push   %edi
+  802025:	56                   	push   %esi
+  802026:	53                   	push   %ebx
+  802027:	83 ec 64             	sub    $0x64,%esp
+  80202a:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  80202c:	52                   	push   %edx
+  80202d:	50                   	push   %eax
+  80202e:	e8 d9 f5 ff ff       	call   80160c <fd_lookup>
+  802033:	89 c1                	mov    %eax,%ecx
+  802035:	83 c4 10             	add    $0x10,%esp
+  802038:	85 c0                	test   %eax,%eax
+  80203a:	0f 88 f2 00 00 00    	js     802132 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  802040:	8b 07                	mov    (%edi),%eax
+  802042:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802048:	39 10                	cmp    %edx,(%eax)
+  80204a:	0f 85 03 01 00 00    	jne    802153 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  802050:	a1 00 50 80 00       	mov    0x805000,%eax
+  802055:	8b 40 48             	mov    0x48(%eax),%eax
+  802058:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  80205e:	0f 84 96 00 00 00    	je     8020fa <fsring_slot+0xd9>
+	if (fsenv == 0)
+  802064:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  80206b:	0f 84 cb 00 00 00    	je     80213c <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  802071:	b8 00 60 80 00       	mov    $0x806000,%eax
+  802076:	83 c8 07             	or     $0x7,%eax
+  802079:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  80207c:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80207f:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  802084:	83 ec 04             	sub    $0x4,%esp
+  802087:	68 07 04 00 00       	push   $0x407
+  80208c:	53                   	push   %ebx
+  80208d:	6a 00                	push   $0x0
+  80208f:	e8 02 ec ff ff       	call   800c96 <sys_page_alloc>
+  802094:	89 c1                	mov    %eax,%ecx
+  802096:	83 c4 10             	add    $0x10,%esp
+  802099:	85 c0                	test   %eax,%eax
+  80209b:	0f 88 91 00 00 00    	js     802132 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  8020a1:	89 d8                	mov    %ebx,%eax
+  8020a3:	83 c8 07             	or     $0x7,%eax
+  8020a6:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8020a8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8020ae:	83 c6 04             	add    $0x4,%esi
+  8020b1:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8020b7:	75 cb                	jne    802084 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8020b9:	6a 12                	push   $0x12
+  8020bb:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8020be:	50                   	push   %eax
+  8020bf:	6a 0c                	push   $0xc
+  8020c1:	ff 35 c8 70 80 00    	push   0x8070c8
+  8020c7:	e8 36 f4 ff ff       	call   801502 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8020cc:	83 c4 0c             	add    $0xc,%esp
+  8020cf:	6a 00                	push   $0x0
+  8020d1:	6a 00                	push   $0x0
+  8020d3:	6a 00                	push   $0x0
+  8020d5:	e8 d2 f2 ff ff       	call   8013ac <ipc_recv>
+  8020da:	89 c1                	mov    %eax,%ecx
+  8020dc:	83 c4 10             	add    $0x10,%esp
+  8020df:	85 c0                	test   %eax,%eax
+  8020e1:	78 4f                	js     802132 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  8020e3:	a1 00 50 80 00       	mov    0x805000,%eax
+  8020e8:	8b 40 48             	mov    0x48(%eax),%eax
+  8020eb:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  8020f0:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  8020f7:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  8020fa:	83 ec 0c             	sub    $0xc,%esp
+  8020fd:	ff 37                	push   (%edi)
+  8020ff:	e8 e4 fc ff ff       	call   801de8 <devfile_sync>
+  802104:	89 c1                	mov    %eax,%ecx
+  802106:	83 c4 10             	add    $0x10,%esp
+  802109:	85 c0                	test   %eax,%eax
+  80210b:	78 25                	js     802132 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  80210d:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802113:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  802118:	ba 01 00 00 00       	mov    $0x1,%edx
+  80211d:	89 d0                	mov    %edx,%eax
+  80211f:	d3 e0                	shl    %cl,%eax
+  802121:	85 d8                	test   %ebx,%eax
+  802123:	74 0d                	je     802132 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802125:	83 c1 01             	add    $0x1,%ecx
+  802128:	83 f9 10             	cmp    $0x10,%ecx
+  80212b:	75 f0                	jne    80211d <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  80212d:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  802132:	89 c8                	mov    %ecx,%eax
+  802134:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802137:	5b                   	pop    %ebx
+  802138:	5e                   	pop    %esi
+  802139:	5f                   	pop    %edi
+  80213a:	5d                   	pop    %ebp
+  80213b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80213c:	83 ec 0c             	sub    $0xc,%esp
+  80213f:	6a 01                	push   $0x1
+  802141:	e8 0a f4 ff ff       	call   801550 <ipc_find_env>
+  802146:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  80214b:	83 c4 10             	add    $0x10,%esp
+  80214e:	e9 1e ff ff ff       	jmp    802071 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  802153:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  802158:	eb d8                	jmp    802132 <fsring_slot+0x111>
+
+0080215a <file_read_direct>:
+{
+  80215a:	55                   	push   %ebp
+  80215b:	89 e5                	mov    %esp,%ebp
+  80215d:	57                   	push   %edi
+  80215e:	56                   	push   %esi
+  80215f:	53                   	push   %ebx
+  802160:	83 ec 1c             	sub    $0x1c,%esp
+  802163:	89 c7                	mov    %eax,%edi
+  802165:	89 d6                	mov    %edx,%esi
+  802167:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  802169:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  80216f:	77 52                	ja     8021c3 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802171:	8b 40 0c             	mov    0xc(%eax),%eax
+  802174:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802179:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80217f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802184:	b8 03 00 00 00       	mov    $0x3,%eax
+  802189:	e8 b6 fb ff ff       	call   801d44 <fsipc>
+  80218e:	89 c7                	mov    %eax,%edi
+  802190:	85 c0                	test   %eax,%eax
+  802192:	78 25                	js     8021b9 <file_read_direct+0x5f>
+	assert(r <= n);
+  802194:	39 c3                	cmp    %eax,%ebx
+  802196:	0f 82 87 00 00 00    	jb     802223 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  80219c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8021a1:	0f 8f 95 00 00 00    	jg     80223c <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8021a7:	83 ec 04             	sub    $0x4,%esp
+  8021aa:	50                   	push   %eax
+  8021ab:	68 00 60 80 00       	push   $0x806000
+  8021b0:	56                   	push   %esi
+  8021b1:	e8 5a e8 ff ff       	call   800a10 <memmove>
+	return r;
+  8021b6:	83 c4 10             	add    $0x10,%esp
+}
+  8021b9:	89 f8                	mov    %edi,%eax
+  8021bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021be:	5b                   	pop    %ebx
+  8021bf:	5e                   	pop    %esi
+  8021c0:	5f                   	pop    %edi
+  8021c1:	5d                   	pop    %ebp
+  8021c2:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8021c3:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8021c9:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8021ce:	29 d1                	sub    %edx,%ecx
+  8021d0:	39 d9                	cmp    %ebx,%ecx
+  8021d2:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8021d5:	89 f0                	mov    %esi,%eax
+  8021d7:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8021da:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8021dd:	eb 0f                	jmp    8021ee <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8021df:	0f b6 10             	movzbl (%eax),%edx
+  8021e2:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8021e4:	05 00 10 00 00       	add    $0x1000,%eax
+  8021e9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8021ee:	39 c8                	cmp    %ecx,%eax
+  8021f0:	72 ed                	jb     8021df <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  8021f2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8021f5:	8b 47 0c             	mov    0xc(%edi),%eax
+  8021f8:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  8021fd:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802203:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  802209:	83 ec 0c             	sub    $0xc,%esp
+  80220c:	6a 07                	push   $0x7
+  80220e:	89 d9                	mov    %ebx,%ecx
+  802210:	89 f2                	mov    %esi,%edx
+  802212:	b8 09 00 00 00       	mov    $0x9,%eax
+  802217:	e8 86 f9 ff ff       	call   801ba2 <fsipc_pages>
+  80221c:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  80221e:	83 c4 10             	add    $0x10,%esp
+  802221:	eb 96                	jmp    8021b9 <file_read_direct+0x5f>
+	assert(r <= n);
+  802223:	68 3b 3e 80 00       	push   $0x803e3b
+  802228:	68 2c 3d 80 00       	push   $0x803d2c
+  80222d:	68 dc 00 00 00       	push   $0xdc
+  802232:	68 30 3e 80 00       	push   $0x803e30
+  802237:	e8 0e 13 00 00       	call   80354a <_panic>
+	assert(r <= PGSIZE);
+  80223c:	68 4c 3e 80 00       	push   $0x803e4c
+  802241:	68 2c 3d 80 00       	push   $0x803d2c
+  802246:	68 dd 00 00 00       	push   $0xdd
+  80224b:	68 30 3e 80 00       	push   $0x803e30
+  802250:	e8 f5 12 00 00       	call   80354a <_panic>
+
+00802255 <devfile_read>:
+{
+  802255:	55                   	push   %ebp
+  802256:	89 e5                	mov    %esp,%ebp
+  802258:	57                   	push   %edi
+  802259:	56                   	push   %esi
+  80225a:	53                   	push   %ebx
+  80225b:	83 ec 28             	sub    $0x28,%esp
+  80225e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802261:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  802264:	53                   	push   %ebx
+  802265:	e8 35 f3 ff ff       	call   80159f <fd2data>
+  80226a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  80226d:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  802270:	83 c4 10             	add    $0x10,%esp
+  802273:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  802277:	74 7d                	je     8022f6 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802279:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80227d:	0f 85 81 00 00 00    	jne    802304 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  802283:	8b 43 18             	mov    0x18(%ebx),%eax
+  802286:	85 c0                	test   %eax,%eax
+  802288:	74 0d                	je     802297 <devfile_read+0x42>
+  80228a:	8b 53 14             	mov    0x14(%ebx),%edx
+  80228d:	39 fa                	cmp    %edi,%edx
+  80228f:	7f 06                	jg     802297 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  802291:	01 c2                	add    %eax,%edx
+  802293:	39 d7                	cmp    %edx,%edi
+  802295:	72 28                	jb     8022bf <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  802297:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  80229e:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8022a4:	77 74                	ja     80231a <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8022a6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022ab:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8022ae:	89 d8                	mov    %ebx,%eax
+  8022b0:	e8 a5 fe ff ff       	call   80215a <file_read_direct>
+  8022b5:	85 c0                	test   %eax,%eax
+  8022b7:	7e 35                	jle    8022ee <devfile_read+0x99>
+		ff->buf_base = pos;
+  8022b9:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8022bc:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8022bf:	8b 53 14             	mov    0x14(%ebx),%edx
+  8022c2:	89 d0                	mov    %edx,%eax
+  8022c4:	03 43 18             	add    0x18(%ebx),%eax
+  8022c7:	29 f8                	sub    %edi,%eax
+  8022c9:	39 f0                	cmp    %esi,%eax
+  8022cb:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8022ce:	83 ec 04             	sub    $0x4,%esp
+  8022d1:	56                   	push   %esi
+  8022d2:	89 f8                	mov    %edi,%eax
+  8022d4:	29 d0                	sub    %edx,%eax
+  8022d6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8022d9:	01 c1                	add    %eax,%ecx
+  8022db:	51                   	push   %ecx
+  8022dc:	ff 75 0c             	push   0xc(%ebp)
+  8022df:	e8 2c e7 ff ff       	call   800a10 <memmove>
+	fd->fd_offset = pos + n;
+  8022e4:	01 f7                	add    %esi,%edi
+  8022e6:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8022e9:	89 f0                	mov    %esi,%eax
+  8022eb:	83 c4 10             	add    $0x10,%esp
+}
+  8022ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f1:	5b                   	pop    %ebx
+  8022f2:	5e                   	pop    %esi
+  8022f3:	5f                   	pop    %edi
+  8022f4:	5d                   	pop    %ebp
+  8022f5:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  8022f6:	89 f1                	mov    %esi,%ecx
+  8022f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022fb:	89 d8                	mov    %ebx,%eax
+  8022fd:	e8 58 fe ff ff       	call   80215a <file_read_direct>
+  802302:	eb ea                	jmp    8022ee <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802304:	83 ec 0c             	sub    $0xc,%esp
+  802307:	53                   	push   %ebx
+  802308:	e8 db fa ff ff       	call   801de8 <devfile_sync>
+  80230d:	83 c4 10             	add    $0x10,%esp
+  802310:	85 c0                	test   %eax,%eax
+  802312:	0f 89 6b ff ff ff    	jns    802283 <devfile_read+0x2e>
+  802318:	eb d4                	jmp    8022ee <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  80231a:	89 f1                	mov    %esi,%ecx
+  80231c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80231f:	89 d8                	mov    %ebx,%eax
+  802321:	e8 34 fe ff ff       	call   80215a <file_read_direct>
+  802326:	eb c6                	jmp    8022ee <devfile_read+0x99>
+
+00802328 <open>:
+{
+  802328:	55                   	push   %ebp
+  802329:	89 e5                	mov    %esp,%ebp
+  80232b:	56                   	push   %esi
+  80232c:	53                   	push   %ebx
+  80232d:	83 ec 1c             	sub    $0x1c,%esp
+  802330:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802333:	56                   	push   %esi
+  802334:	e8 16 e5 ff ff       	call   80084f <strlen>
+  802339:	83 c4 10             	add    $0x10,%esp
+  80233c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802341:	0f 8f a0 00 00 00    	jg     8023e7 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  802347:	83 ec 0c             	sub    $0xc,%esp
+  80234a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80234d:	50                   	push   %eax
+  80234e:	e8 63 f2 ff ff       	call   8015b6 <fd_alloc>
+  802353:	89 c3                	mov    %eax,%ebx
+  802355:	83 c4 10             	add    $0x10,%esp
+  802358:	85 c0                	test   %eax,%eax
+  80235a:	78 45                	js     8023a1 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  80235c:	83 ec 08             	sub    $0x8,%esp
+  80235f:	56                   	push   %esi
+  802360:	68 00 60 80 00       	push   $0x806000
+  802365:	e8 20 e5 ff ff       	call   80088a <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80236a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80236d:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802372:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802375:	b8 01 00 00 00       	mov    $0x1,%eax
+  80237a:	e8 c5 f9 ff ff       	call   801d44 <fsipc>
+  80237f:	89 c3                	mov    %eax,%ebx
+  802381:	83 c4 10             	add    $0x10,%esp
+  802384:	85 c0                	test   %eax,%eax
+  802386:	78 22                	js     8023aa <open+0x82>
+	if (!(mode & O_NOBUF)
+  802388:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  80238f:	74 2b                	je     8023bc <open+0x94>
+	return fd2num(fd);
+  802391:	83 ec 0c             	sub    $0xc,%esp
+  802394:	ff 75 f4             	push   -0xc(%ebp)
+  802397:	e8 f3 f1 ff ff       	call   80158f <fd2num>
+  80239c:	89 c3                	mov    %eax,%ebx
+  80239e:	83 c4 10             	add    $0x10,%esp
+}
+  8023a1:	89 d8                	mov    %ebx,%eax
+  8023a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023a6:	5b                   	pop    %ebx
+  8023a7:	5e                   	pop    %esi
+  8023a8:	5d                   	pop    %ebp
+  8023a9:	c3                   	ret
+		fd_close(fd, 0);
+  8023aa:	83 ec 08             	sub    $0x8,%esp
+  8023ad:	6a 00                	push   $0x0
+  8023af:	ff 75 f4             	push   -0xc(%ebp)
+  8023b2:	e8 f8 f2 ff ff       	call   8016af <fd_close>
+		return r;
+  8023b7:	83 c4 10             	add    $0x10,%esp
+  8023ba:	eb e5                	jmp    8023a1 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8023bc:	83 ec 0c             	sub    $0xc,%esp
+  8023bf:	ff 75 f4             	push   -0xc(%ebp)
+  8023c2:	e8 d8 f1 ff ff       	call   80159f <fd2data>
+  8023c7:	83 c4 0c             	add    $0xc,%esp
+  8023ca:	68 07 04 00 00       	push   $0x407
+  8023cf:	50                   	push   %eax
+  8023d0:	6a 00                	push   $0x0
+  8023d2:	e8 bf e8 ff ff       	call   800c96 <sys_page_alloc>
+  8023d7:	83 c4 10             	add    $0x10,%esp
+  8023da:	85 c0                	test   %eax,%eax
+  8023dc:	75 b3                	jne    802391 <open+0x69>
+		fd->fd_file.buffered = 1;
+  8023de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023e1:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8023e5:	eb aa                	jmp    802391 <open+0x69>
+		return -E_BAD_PATH;
+  8023e7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8023ec:	eb b3                	jmp    8023a1 <open+0x79>
+
+008023ee <readdir>:
+{
+  8023ee:	55                   	push   %ebp
+  8023ef:	89 e5                	mov    %esp,%ebp
+  8023f1:	53                   	push   %ebx
+  8023f2:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023f8:	50                   	push   %eax
+  8023f9:	ff 75 08             	push   0x8(%ebp)
+  8023fc:	e8 0b f2 ff ff       	call   80160c <fd_lookup>
+  802401:	89 c3                	mov    %eax,%ebx
+  802403:	83 c4 10             	add    $0x10,%esp
+  802406:	85 c0                	test   %eax,%eax
+  802408:	78 73                	js     80247d <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80240a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80240d:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802413:	39 08                	cmp    %ecx,(%eax)
+  802415:	0f 85 82 00 00 00    	jne    80249d <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  80241b:	83 ec 0c             	sub    $0xc,%esp
+  80241e:	50                   	push   %eax
+  80241f:	e8 c4 f9 ff ff       	call   801de8 <devfile_sync>
+  802424:	89 c3                	mov    %eax,%ebx
+  802426:	83 c4 10             	add    $0x10,%esp
+  802429:	85 c0                	test   %eax,%eax
+  80242b:	78 50                	js     80247d <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  80242d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802430:	8b 40 0c             	mov    0xc(%eax),%eax
+  802433:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  802438:	8b 45 10             	mov    0x10(%ebp),%eax
+  80243b:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  802440:	8b 45 14             	mov    0x14(%ebp),%eax
+  802443:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  802448:	ba 00 00 00 00       	mov    $0x0,%edx
+  80244d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802452:	e8 ed f8 ff ff       	call   801d44 <fsipc>
+  802457:	89 c3                	mov    %eax,%ebx
+  802459:	85 c0                	test   %eax,%eax
+  80245b:	7e 20                	jle    80247d <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  80245d:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802460:	72 22                	jb     802484 <readdir+0x96>
+  802462:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802467:	7f 1b                	jg     802484 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802469:	83 ec 04             	sub    $0x4,%esp
+  80246c:	50                   	push   %eax
+  80246d:	68 00 60 80 00       	push   $0x806000
+  802472:	ff 75 0c             	push   0xc(%ebp)
+  802475:	e8 96 e5 ff ff       	call   800a10 <memmove>
+	return r;
+  80247a:	83 c4 10             	add    $0x10,%esp
+}
+  80247d:	89 d8                	mov    %ebx,%eax
+  80247f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802482:	c9                   	leave
+  802483:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  802484:	68 42 3e 80 00       	push   $0x803e42
+  802489:	68 2c 3d 80 00       	push   $0x803d2c
+  80248e:	68 86 01 00 00       	push   $0x186
+  802493:	68 30 3e 80 00       	push   $0x803e30
+  802498:	e8 ad 10 00 00       	call   80354a <_panic>
+		return -E_NOT_SUPP;
+  80249d:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8024a2:	eb d9                	jmp    80247d <readdir+0x8f>
+
+008024a4 <munmap>:
+{
+  8024a4:	55                   	push   %ebp
+  8024a5:	89 e5                	mov    %esp,%ebp
+  8024a7:	56                   	push   %esi
+  8024a8:	53                   	push   %ebx
+  8024a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8024ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8024af:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8024b5:	75 41                	jne    8024f8 <munmap+0x54>
+  8024b7:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8024bd:	77 39                	ja     8024f8 <munmap+0x54>
+  8024bf:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8024c4:	29 f0                	sub    %esi,%eax
+  8024c6:	39 d0                	cmp    %edx,%eax
+  8024c8:	72 35                	jb     8024ff <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8024ca:	89 f3                	mov    %esi,%ebx
+  8024cc:	01 d6                	add    %edx,%esi
+  8024ce:	39 f3                	cmp    %esi,%ebx
+  8024d0:	73 1a                	jae    8024ec <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8024d2:	83 ec 08             	sub    $0x8,%esp
+  8024d5:	53                   	push   %ebx
+  8024d6:	6a 00                	push   $0x0
+  8024d8:	e8 46 e8 ff ff       	call   800d23 <sys_page_unmap>
+  8024dd:	83 c4 10             	add    $0x10,%esp
+  8024e0:	85 c0                	test   %eax,%eax
+  8024e2:	78 0d                	js     8024f1 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8024e4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8024ea:	eb e2                	jmp    8024ce <munmap+0x2a>
+	return 0;
+  8024ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024f4:	5b                   	pop    %ebx
+  8024f5:	5e                   	pop    %esi
+  8024f6:	5d                   	pop    %ebp
+  8024f7:	c3                   	ret
+		return -E_INVAL;
+  8024f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024fd:	eb f2                	jmp    8024f1 <munmap+0x4d>
+  8024ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802504:	eb eb                	jmp    8024f1 <munmap+0x4d>
+
+00802506 <mmap>:
+{
+  802506:	55                   	push   %ebp
+  802507:	89 e5                	mov    %esp,%ebp
+  802509:	57                   	push   %edi
+  80250a:	56                   	push   %esi
+  80250b:	53                   	push   %ebx
+  80250c:	83 ec 34             	sub    $0x34,%esp
+  80250f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802512:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802515:	50                   	push   %eax
+  802516:	ff 75 18             	push   0x18(%ebp)
+  802519:	e8 ee f0 ff ff       	call   80160c <fd_lookup>
+  80251e:	89 c3                	mov    %eax,%ebx
+  802520:	83 c4 10             	add    $0x10,%esp
+  802523:	85 c0                	test   %eax,%eax
+  802525:	0f 88 0e 01 00 00    	js     802639 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80252b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80252e:	a1 20 40 80 00       	mov    0x804020,%eax
+  802533:	39 02                	cmp    %eax,(%edx)
+  802535:	0f 85 50 01 00 00    	jne    80268b <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  80253b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80253e:	83 e0 02             	and    $0x2,%eax
+  802541:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802544:	74 0a                	je     802550 <mmap+0x4a>
+  802546:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80254a:	0f 84 42 01 00 00    	je     802692 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802550:	8b 42 08             	mov    0x8(%edx),%eax
+  802553:	83 e0 03             	and    $0x3,%eax
+  802556:	83 f8 01             	cmp    $0x1,%eax
+  802559:	0f 84 3a 01 00 00    	je     802699 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  80255f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802562:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802565:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80256a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80256d:	0f 85 2d 01 00 00    	jne    8026a0 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802573:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802577:	0f 88 2a 01 00 00    	js     8026a7 <mmap+0x1a1>
+  80257d:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  802584:	0f 87 1d 01 00 00    	ja     8026a7 <mmap+0x1a1>
+  80258a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80258f:	2b 45 08             	sub    0x8(%ebp),%eax
+  802592:	39 f8                	cmp    %edi,%eax
+  802594:	0f 82 14 01 00 00    	jb     8026ae <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  80259a:	83 ec 0c             	sub    $0xc,%esp
+  80259d:	52                   	push   %edx
+  80259e:	e8 45 f8 ff ff       	call   801de8 <devfile_sync>
+  8025a3:	89 c3                	mov    %eax,%ebx
+  8025a5:	83 c4 10             	add    $0x10,%esp
+  8025a8:	85 c0                	test   %eax,%eax
+  8025aa:	0f 88 89 00 00 00    	js     802639 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8025b0:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8025b6:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8025bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c1:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8025c4:	39 fe                	cmp    %edi,%esi
+  8025c6:	73 7b                	jae    802643 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8025c8:	89 f8                	mov    %edi,%eax
+  8025ca:	29 f0                	sub    %esi,%eax
+  8025cc:	c1 e8 0c             	shr    $0xc,%eax
+  8025cf:	ba 40 00 00 00       	mov    $0x40,%edx
+  8025d4:	39 d0                	cmp    %edx,%eax
+  8025d6:	0f 47 c2             	cmova  %edx,%eax
+  8025d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8025dc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025df:	8b 52 0c             	mov    0xc(%edx),%edx
+  8025e2:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  8025e8:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8025eb:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  8025f1:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8025f6:	89 f2                	mov    %esi,%edx
+  8025f8:	03 55 08             	add    0x8(%ebp),%edx
+  8025fb:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8025fe:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802603:	e8 ea f6 ff ff       	call   801cf2 <fsipcv>
+  802608:	85 c0                	test   %eax,%eax
+  80260a:	7e 12                	jle    80261e <mmap+0x118>
+  80260c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80260f:	85 c0                	test   %eax,%eax
+  802611:	0f 84 9e 00 00 00    	je     8026b5 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802617:	c1 e0 0c             	shl    $0xc,%eax
+  80261a:	01 c6                	add    %eax,%esi
+  80261c:	eb a6                	jmp    8025c4 <mmap+0xbe>
+			munmap(addr, done);
+  80261e:	89 c3                	mov    %eax,%ebx
+  802620:	83 ec 08             	sub    $0x8,%esp
+  802623:	56                   	push   %esi
+  802624:	ff 75 08             	push   0x8(%ebp)
+  802627:	e8 78 fe ff ff       	call   8024a4 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80262c:	83 c4 10             	add    $0x10,%esp
+  80262f:	85 db                	test   %ebx,%ebx
+  802631:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802636:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802639:	89 d8                	mov    %ebx,%eax
+  80263b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80263e:	5b                   	pop    %ebx
+  80263f:	5e                   	pop    %esi
+  802640:	5f                   	pop    %edi
+  802641:	5d                   	pop    %ebp
+  802642:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802643:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802646:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802648:	85 c0                	test   %eax,%eax
+  80264a:	74 ed                	je     802639 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80264c:	be 00 00 00 00       	mov    $0x0,%esi
+  802651:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802654:	39 fe                	cmp    %edi,%esi
+  802656:	73 2e                	jae    802686 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802658:	83 ec 0c             	sub    $0xc,%esp
+  80265b:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  80265e:	50                   	push   %eax
+  80265f:	e8 4a eb ff ff       	call   8011ae <cowpage>
+  802664:	83 c4 10             	add    $0x10,%esp
+  802667:	85 c0                	test   %eax,%eax
+  802669:	78 08                	js     802673 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  80266b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802671:	eb e1                	jmp    802654 <mmap+0x14e>
+				munmap(addr, len);
+  802673:	89 c3                	mov    %eax,%ebx
+  802675:	83 ec 08             	sub    $0x8,%esp
+  802678:	57                   	push   %edi
+  802679:	ff 75 08             	push   0x8(%ebp)
+  80267c:	e8 23 fe ff ff       	call   8024a4 <munmap>
+				return r;
+  802681:	83 c4 10             	add    $0x10,%esp
+  802684:	eb b3                	jmp    802639 <mmap+0x133>
+	return 0;
+  802686:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802689:	eb ae                	jmp    802639 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80268b:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802690:	eb a7                	jmp    802639 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802692:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802697:	eb a0                	jmp    802639 <mmap+0x133>
+		return -E_INVAL;
+  802699:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80269e:	eb 99                	jmp    802639 <mmap+0x133>
+  8026a0:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8026a5:	eb 92                	jmp    802639 <mmap+0x133>
+  8026a7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8026ac:	eb 8b                	jmp    802639 <mmap+0x133>
+  8026ae:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8026b3:	eb 84                	jmp    802639 <mmap+0x133>
+			munmap(addr, done);
+  8026b5:	83 ec 08             	sub    $0x8,%esp
+  8026b8:	56                   	push   %esi
+  8026b9:	ff 75 08             	push   0x8(%ebp)
+  8026bc:	e8 e3 fd ff ff       	call   8024a4 <munmap>
+  8026c1:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8026c4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8026c9:	e9 6b ff ff ff       	jmp    802639 <mmap+0x133>
+
+008026ce <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8026ce:	55                   	push   %ebp
+  8026cf:	89 e5                	mov    %esp,%ebp
+  8026d1:	56                   	push   %esi
+  8026d2:	53                   	push   %ebx
+  8026d3:	83 ec 10             	sub    $0x10,%esp
+  8026d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8026d9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026df:	e8 3d f9 ff ff       	call   802021 <fsring_slot>
+  8026e4:	85 c0                	test   %eax,%eax
+  8026e6:	78 60                	js     802748 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8026e8:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8026eb:	8b 56 08             	mov    0x8(%esi),%edx
+  8026ee:	83 e2 03             	and    $0x3,%edx
+  8026f1:	83 fa 01             	cmp    $0x1,%edx
+  8026f4:	74 59                	je     80274f <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8026f6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8026fb:	89 c1                	mov    %eax,%ecx
+  8026fd:	d3 e2                	shl    %cl,%edx
+  8026ff:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802705:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802708:	c1 e2 02             	shl    $0x2,%edx
+  80270b:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  802711:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  802718:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80271b:	8b 55 18             	mov    0x18(%ebp),%edx
+  80271e:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802721:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802724:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802727:	83 ec 08             	sub    $0x8,%esp
+  80272a:	50                   	push   %eax
+  80272b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802730:	39 c3                	cmp    %eax,%ebx
+  802732:	0f 47 d8             	cmova  %eax,%ebx
+  802735:	53                   	push   %ebx
+  802736:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802739:	89 f2                	mov    %esi,%edx
+  80273b:	b8 03 00 00 00       	mov    $0x3,%eax
+  802740:	e8 1e f5 ff ff       	call   801c63 <fsring_post>
+  802745:	83 c4 10             	add    $0x10,%esp
+}
+  802748:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80274b:	5b                   	pop    %ebx
+  80274c:	5e                   	pop    %esi
+  80274d:	5d                   	pop    %ebp
+  80274e:	c3                   	ret
+		return -E_INVAL;
+  80274f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802754:	eb f2                	jmp    802748 <fsring_read+0x7a>
+
+00802756 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802756:	55                   	push   %ebp
+  802757:	89 e5                	mov    %esp,%ebp
+  802759:	56                   	push   %esi
+  80275a:	53                   	push   %ebx
+  80275b:	83 ec 10             	sub    $0x10,%esp
+  80275e:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802761:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802764:	8b 45 08             	mov    0x8(%ebp),%eax
+  802767:	e8 b5 f8 ff ff       	call   802021 <fsring_slot>
+  80276c:	89 c3                	mov    %eax,%ebx
+  80276e:	85 c0                	test   %eax,%eax
+  802770:	78 77                	js     8027e9 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802772:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802775:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802779:	74 77                	je     8027f2 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80277b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802780:	39 c6                	cmp    %eax,%esi
+  802782:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802785:	83 ec 04             	sub    $0x4,%esp
+  802788:	56                   	push   %esi
+  802789:	ff 75 0c             	push   0xc(%ebp)
+  80278c:	89 d8                	mov    %ebx,%eax
+  80278e:	c1 e0 0c             	shl    $0xc,%eax
+  802791:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802797:	50                   	push   %eax
+  802798:	e8 73 e2 ff ff       	call   800a10 <memmove>
+	fsring_busy |= 1 << slot;
+  80279d:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027a2:	89 d9                	mov    %ebx,%ecx
+  8027a4:	d3 e0                	shl    %cl,%eax
+  8027a6:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8027ac:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8027af:	c1 e0 02             	shl    $0x2,%eax
+  8027b2:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8027b8:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8027bf:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8027c2:	8b 45 18             	mov    0x18(%ebp),%eax
+  8027c5:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8027c8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8027cf:	83 c4 08             	add    $0x8,%esp
+  8027d2:	53                   	push   %ebx
+  8027d3:	56                   	push   %esi
+  8027d4:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8027d7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027da:	b8 04 00 00 00       	mov    $0x4,%eax
+  8027df:	e8 7f f4 ff ff       	call   801c63 <fsring_post>
+  8027e4:	89 c3                	mov    %eax,%ebx
+  8027e6:	83 c4 10             	add    $0x10,%esp
+}
+  8027e9:	89 d8                	mov    %ebx,%eax
+  8027eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ee:	5b                   	pop    %ebx
+  8027ef:	5e                   	pop    %esi
+  8027f0:	5d                   	pop    %ebp
+  8027f1:	c3                   	ret
+		return -E_INVAL;
+  8027f2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8027f7:	eb f0                	jmp    8027e9 <fsring_write+0x93>
+
+008027f9 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8027f9:	55                   	push   %ebp
+  8027fa:	89 e5                	mov    %esp,%ebp
+  8027fc:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8027ff:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802802:	8b 45 08             	mov    0x8(%ebp),%eax
+  802805:	e8 17 f8 ff ff       	call   802021 <fsring_slot>
+  80280a:	85 c0                	test   %eax,%eax
+  80280c:	78 4c                	js     80285a <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  80280e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802813:	89 c1                	mov    %eax,%ecx
+  802815:	d3 e2                	shl    %cl,%edx
+  802817:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  80281d:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802820:	c1 e2 02             	shl    $0x2,%edx
+  802823:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  802829:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  802830:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802833:	8b 55 10             	mov    0x10(%ebp),%edx
+  802836:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802839:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80283c:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80283f:	83 ec 08             	sub    $0x8,%esp
+  802842:	50                   	push   %eax
+  802843:	6a 00                	push   $0x0
+  802845:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80284a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80284d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802852:	e8 0c f4 ff ff       	call   801c63 <fsring_post>
+  802857:	83 c4 10             	add    $0x10,%esp
+}
+  80285a:	c9                   	leave
+  80285b:	c3                   	ret
+
+0080285c <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  80285c:	55                   	push   %ebp
+  80285d:	89 e5                	mov    %esp,%ebp
+  80285f:	57                   	push   %edi
+  802860:	56                   	push   %esi
+  802861:	53                   	push   %ebx
+  802862:	83 ec 1c             	sub    $0x1c,%esp
+  802865:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802869:	a1 00 50 80 00       	mov    0x805000,%eax
+  80286e:	8b 40 48             	mov    0x48(%eax),%eax
+  802871:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  802877:	74 12                	je     80288b <fsring_reap+0x2f>
+		return 0;
+  802879:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  80287e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802881:	5b                   	pop    %ebx
+  802882:	5e                   	pop    %esi
+  802883:	5f                   	pop    %edi
+  802884:	5d                   	pop    %ebp
+  802885:	c3                   	ret
+		sys_yield();
+  802886:	e8 ec e3 ff ff       	call   800c77 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  80288b:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802891:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802896:	39 c2                	cmp    %eax,%edx
+  802898:	75 18                	jne    8028b2 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  80289a:	84 db                	test   %bl,%bl
+  80289c:	0f 84 21 01 00 00    	je     8029c3 <fsring_reap+0x167>
+  8028a2:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  8028a9:	75 db                	jne    802886 <fsring_reap+0x2a>
+			return 0;
+  8028ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b0:	eb cc                	jmp    80287e <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8028b2:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8028b7:	83 e0 0f             	and    $0xf,%eax
+  8028ba:	83 c0 2a             	add    $0x2a,%eax
+  8028bd:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8028c4:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8028cb:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8028d0:	83 c0 01             	add    $0x1,%eax
+  8028d3:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8028d8:	83 fb 0f             	cmp    $0xf,%ebx
+  8028db:	77 5b                	ja     802938 <fsring_reap+0xdc>
+  8028dd:	be 01 00 00 00       	mov    $0x1,%esi
+  8028e2:	89 d9                	mov    %ebx,%ecx
+  8028e4:	d3 e6                	shl    %cl,%esi
+  8028e6:	89 f0                	mov    %esi,%eax
+  8028e8:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8028ee:	74 48                	je     802938 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8028f0:	89 d8                	mov    %ebx,%eax
+  8028f2:	c1 e0 0c             	shl    $0xc,%eax
+  8028f5:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8028fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8028fe:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802901:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  802908:	83 f8 03             	cmp    $0x3,%eax
+  80290b:	74 40                	je     80294d <fsring_reap+0xf1>
+  80290d:	83 f8 05             	cmp    $0x5,%eax
+  802910:	74 64                	je     802976 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802912:	f7 d6                	not    %esi
+  802914:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  80291a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80291d:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  802924:	8b 45 08             	mov    0x8(%ebp),%eax
+  802927:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802929:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80292c:	89 38                	mov    %edi,(%eax)
+	return 1;
+  80292e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802933:	e9 46 ff ff ff       	jmp    80287e <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802938:	53                   	push   %ebx
+  802939:	68 58 3e 80 00       	push   $0x803e58
+  80293e:	68 8f 02 00 00       	push   $0x28f
+  802943:	68 30 3e 80 00       	push   $0x803e30
+  802948:	e8 fd 0b 00 00       	call   80354a <_panic>
+		if (cqe.cqe_result > 0)
+  80294d:	85 ff                	test   %edi,%edi
+  80294f:	7e c1                	jle    802912 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802951:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802954:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802959:	39 c7                	cmp    %eax,%edi
+  80295b:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80295e:	50                   	push   %eax
+  80295f:	ff 75 e4             	push   -0x1c(%ebp)
+  802962:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802965:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  80296c:	e8 9f e0 ff ff       	call   800a10 <memmove>
+  802971:	83 c4 10             	add    $0x10,%esp
+  802974:	eb 9c                	jmp    802912 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802976:	85 ff                	test   %edi,%edi
+  802978:	75 98                	jne    802912 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80297a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80297d:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802984:	83 ec 08             	sub    $0x8,%esp
+  802987:	ff 75 e4             	push   -0x1c(%ebp)
+  80298a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80298d:	51                   	push   %ecx
+  80298e:	e8 f7 de ff ff       	call   80088a <strcpy>
+			st->st_size = ret->ret_size;
+  802993:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802996:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  80299c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80299f:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8029a5:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8029ab:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8029b1:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8029b8:	40 80 00 
+  8029bb:	83 c4 10             	add    $0x10,%esp
+  8029be:	e9 4f ff ff ff       	jmp    802912 <fsring_reap+0xb6>
+			return 0;
+  8029c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c8:	e9 b1 fe ff ff       	jmp    80287e <fsring_reap+0x22>
+
+008029cd <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8029cd:	55                   	push   %ebp
+  8029ce:	89 e5                	mov    %esp,%ebp
+  8029d0:	57                   	push   %edi
+  8029d1:	56                   	push   %esi
+  8029d2:	53                   	push   %ebx
+  8029d3:	83 ec 28             	sub    $0x28,%esp
+  8029d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029d9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8029dc:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8029df:	53                   	push   %ebx
+  8029e0:	e8 6a de ff ff       	call   80084f <strlen>
+  8029e5:	83 c4 10             	add    $0x10,%esp
+  8029e8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8029ed:	0f 8f 02 01 00 00    	jg     802af5 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8029f3:	83 ec 08             	sub    $0x8,%esp
+  8029f6:	53                   	push   %ebx
+  8029f7:	68 00 60 80 00       	push   $0x806000
+  8029fc:	e8 89 de ff ff       	call   80088a <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802a01:	83 c4 10             	add    $0x10,%esp
+  802a04:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802a0a:	76 69                	jbe    802a75 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802a0c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a0f:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802a15:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802a1a:	29 d1                	sub    %edx,%ecx
+  802a1c:	39 f9                	cmp    %edi,%ecx
+  802a1e:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802a21:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a24:	89 f9                	mov    %edi,%ecx
+  802a26:	01 c1                	add    %eax,%ecx
+  802a28:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802a2b:	eb 0f                	jmp    802a3c <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802a2d:	0f b6 10             	movzbl (%eax),%edx
+  802a30:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802a32:	05 00 10 00 00       	add    $0x1000,%eax
+  802a37:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802a3c:	39 c8                	cmp    %ecx,%eax
+  802a3e:	72 ed                	jb     802a2d <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802a40:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a43:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802a49:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802a4f:	83 ec 0c             	sub    $0xc,%esp
+  802a52:	6a 07                	push   $0x7
+  802a54:	89 f9                	mov    %edi,%ecx
+  802a56:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a59:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802a5e:	e8 3f f1 ff ff       	call   801ba2 <fsipc_pages>
+  802a63:	89 c7                	mov    %eax,%edi
+  802a65:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802a68:	85 f6                	test   %esi,%esi
+  802a6a:	74 7f                	je     802aeb <file_slurp+0x11e>
+  802a6c:	8d 43 01             	lea    0x1(%ebx),%eax
+  802a6f:	85 ff                	test   %edi,%edi
+  802a71:	79 3c                	jns    802aaf <file_slurp+0xe2>
+  802a73:	eb 76                	jmp    802aeb <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802a75:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802a7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a80:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802a85:	e8 ba f2 ff ff       	call   801d44 <fsipc>
+  802a8a:	89 c7                	mov    %eax,%edi
+  802a8c:	85 c0                	test   %eax,%eax
+  802a8e:	7e d8                	jle    802a68 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802a90:	83 ec 04             	sub    $0x4,%esp
+  802a93:	50                   	push   %eax
+  802a94:	68 08 60 80 00       	push   $0x806008
+  802a99:	ff 75 0c             	push   0xc(%ebp)
+  802a9c:	e8 6f df ff ff       	call   800a10 <memmove>
+  802aa1:	83 c4 10             	add    $0x10,%esp
+  802aa4:	eb c2                	jmp    802a68 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802aa6:	80 fa 2f             	cmp    $0x2f,%dl
+  802aa9:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802aac:	83 c0 01             	add    $0x1,%eax
+  802aaf:	89 c1                	mov    %eax,%ecx
+  802ab1:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802ab5:	84 d2                	test   %dl,%dl
+  802ab7:	75 ed                	jne    802aa6 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802ab9:	83 ec 04             	sub    $0x4,%esp
+  802abc:	68 80 00 00 00       	push   $0x80
+  802ac1:	53                   	push   %ebx
+  802ac2:	56                   	push   %esi
+  802ac3:	e8 38 de ff ff       	call   800900 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802ac8:	a1 00 60 80 00       	mov    0x806000,%eax
+  802acd:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802ad3:	a1 04 60 80 00       	mov    0x806004,%eax
+  802ad8:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802ade:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  802ae5:	40 80 00 
+  802ae8:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802aeb:	89 f8                	mov    %edi,%eax
+  802aed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802af0:	5b                   	pop    %ebx
+  802af1:	5e                   	pop    %esi
+  802af2:	5f                   	pop    %edi
+  802af3:	5d                   	pop    %ebp
+  802af4:	c3                   	ret
+		return -E_BAD_PATH;
+  802af5:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802afa:	eb ef                	jmp    802aeb <file_slurp+0x11e>
+
+00802afc <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802afc:	55                   	push   %ebp
+  802afd:	89 e5                	mov    %esp,%ebp
+  802aff:	53                   	push   %ebx
+  802b00:	83 ec 10             	sub    $0x10,%esp
+  802b03:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802b06:	53                   	push   %ebx
+  802b07:	e8 43 dd ff ff       	call   80084f <strlen>
+  802b0c:	83 c4 10             	add    $0x10,%esp
+  802b0f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802b14:	7f 25                	jg     802b3b <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802b16:	83 ec 08             	sub    $0x8,%esp
+  802b19:	53                   	push   %ebx
+  802b1a:	68 00 60 80 00       	push   $0x806000
+  802b1f:	e8 66 dd ff ff       	call   80088a <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802b24:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b29:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b2e:	e8 11 f2 ff ff       	call   801d44 <fsipc>
+  802b33:	83 c4 10             	add    $0x10,%esp
+}
+  802b36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b39:	c9                   	leave
+  802b3a:	c3                   	ret
+		return -E_BAD_PATH;
+  802b3b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802b40:	eb f4                	jmp    802b36 <remove+0x3a>
+
+00802b42 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802b42:	55                   	push   %ebp
+  802b43:	89 e5                	mov    %esp,%ebp
+  802b45:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802b48:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b4d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b52:	e8 ed f1 ff ff       	call   801d44 <fsipc>
+}
+  802b57:	c9                   	leave
+  802b58:	c3                   	ret
+
+00802b59 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802b59:	55                   	push   %ebp
+  802b5a:	89 e5                	mov    %esp,%ebp
+  802b5c:	57                   	push   %edi
+  802b5d:	56                   	push   %esi
+  802b5e:	53                   	push   %ebx
+  802b5f:	83 ec 18             	sub    $0x18,%esp
+  802b62:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b65:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802b6b:	57                   	push   %edi
+  802b6c:	e8 de dc ff ff       	call   80084f <strlen>
+  802b71:	83 c4 10             	add    $0x10,%esp
+  802b74:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802b79:	7f 4c                	jg     802bc7 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802b7b:	83 ec 08             	sub    $0x8,%esp
+  802b7e:	57                   	push   %edi
+  802b7f:	68 00 60 80 00       	push   $0x806000
+  802b84:	e8 01 dd ff ff       	call   80088a <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802b89:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b8e:	b8 10 00 00 00       	mov    $0x10,%eax
+  802b93:	e8 ac f1 ff ff       	call   801d44 <fsipc>
+  802b98:	83 c4 10             	add    $0x10,%esp
+  802b9b:	85 c0                	test   %eax,%eax
+  802b9d:	78 20                	js     802bbf <defrag+0x66>
+		return r;
+	if (before)
+  802b9f:	85 f6                	test   %esi,%esi
+  802ba1:	74 07                	je     802baa <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802ba3:	a1 00 60 80 00       	mov    0x806000,%eax
+  802ba8:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802baa:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802baf:	85 db                	test   %ebx,%ebx
+  802bb1:	74 0c                	je     802bbf <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802bb3:	a1 04 60 80 00       	mov    0x806004,%eax
+  802bb8:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802bba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bc2:	5b                   	pop    %ebx
+  802bc3:	5e                   	pop    %esi
+  802bc4:	5f                   	pop    %edi
+  802bc5:	5d                   	pop    %ebp
+  802bc6:	c3                   	ret
+		return -E_BAD_PATH;
+  802bc7:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802bcc:	eb f1                	jmp    802bbf <defrag+0x66>
+
+00802bce <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802bce:	55                   	push   %ebp
+  802bcf:	89 e5                	mov    %esp,%ebp
+  802bd1:	53                   	push   %ebx
+  802bd2:	83 ec 04             	sub    $0x4,%esp
+  802bd5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802bd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bdd:	b8 11 00 00 00       	mov    $0x11,%eax
+  802be2:	e8 5d f1 ff ff       	call   801d44 <fsipc>
+  802be7:	85 c0                	test   %eax,%eax
+  802be9:	78 34                	js     802c1f <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802beb:	a1 00 60 80 00       	mov    0x806000,%eax
+  802bf0:	89 03                	mov    %eax,(%ebx)
+  802bf2:	a1 04 60 80 00       	mov    0x806004,%eax
+  802bf7:	89 43 04             	mov    %eax,0x4(%ebx)
+  802bfa:	a1 08 60 80 00       	mov    0x806008,%eax
+  802bff:	89 43 08             	mov    %eax,0x8(%ebx)
+  802c02:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  802c07:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802c0a:	a1 10 60 80 00       	mov    0x806010,%eax
+  802c0f:	89 43 10             	mov    %eax,0x10(%ebx)
+  802c12:	a1 14 60 80 00       	mov    0x806014,%eax
+  802c17:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c22:	c9                   	leave
+  802c23:	c3                   	ret
+
+00802c24 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c24:	55                   	push   %ebp
+  802c25:	89 e5                	mov    %esp,%ebp
+  802c27:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802c2a:	68 71 3e 80 00       	push   $0x803e71
+  802c2f:	ff 75 0c             	push   0xc(%ebp)
+  802c32:	e8 53 dc ff ff       	call   80088a <strcpy>
+	return 0;
+}
+  802c37:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3c:	c9                   	leave
+  802c3d:	c3                   	ret
+
+00802c3e <devsock_close>:
+{
+  802c3e:	55                   	push   %ebp
+  802c3f:	89 e5                	mov    %esp,%ebp
+  802c41:	53                   	push   %ebx
+  802c42:	83 ec 10             	sub    $0x10,%esp
+  802c45:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802c48:	53                   	push   %ebx
+  802c49:	e8 db 09 00 00       	call   803629 <pageref>
+  802c4e:	89 c2                	mov    %eax,%edx
+  802c50:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802c53:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802c58:	83 fa 01             	cmp    $0x1,%edx
+  802c5b:	74 05                	je     802c62 <devsock_close+0x24>
+}
+  802c5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c60:	c9                   	leave
+  802c61:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802c62:	83 ec 0c             	sub    $0xc,%esp
+  802c65:	ff 73 0c             	push   0xc(%ebx)
+  802c68:	e8 b7 02 00 00       	call   802f24 <nsipc_close>
+  802c6d:	83 c4 10             	add    $0x10,%esp
+  802c70:	eb eb                	jmp    802c5d <devsock_close+0x1f>
+
+00802c72 <devsock_write>:
+{
+  802c72:	55                   	push   %ebp
+  802c73:	89 e5                	mov    %esp,%ebp
+  802c75:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802c78:	6a 00                	push   $0x0
+  802c7a:	ff 75 10             	push   0x10(%ebp)
+  802c7d:	ff 75 0c             	push   0xc(%ebp)
+  802c80:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c83:	ff 70 0c             	push   0xc(%eax)
+  802c86:	e8 79 03 00 00       	call   803004 <nsipc_send>
+}
+  802c8b:	c9                   	leave
+  802c8c:	c3                   	ret
+
+00802c8d <devsock_read>:
+{
+  802c8d:	55                   	push   %ebp
+  802c8e:	89 e5                	mov    %esp,%ebp
+  802c90:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802c93:	6a 00                	push   $0x0
+  802c95:	ff 75 10             	push   0x10(%ebp)
+  802c98:	ff 75 0c             	push   0xc(%ebp)
+  802c9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9e:	ff 70 0c             	push   0xc(%eax)
+  802ca1:	e8 ef 02 00 00       	call   802f95 <nsipc_recv>
+}
+  802ca6:	c9                   	leave
+  802ca7:	c3                   	ret
+
+00802ca8 <fd2sockid>:
+{
+  802ca8:	55                   	push   %ebp
+  802ca9:	89 e5                	mov    %esp,%ebp
+  802cab:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802cae:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802cb1:	52                   	push   %edx
+  802cb2:	50                   	push   %eax
+  802cb3:	e8 54 e9 ff ff       	call   80160c <fd_lookup>
+  802cb8:	83 c4 10             	add    $0x10,%esp
+  802cbb:	85 c0                	test   %eax,%eax
+  802cbd:	78 10                	js     802ccf <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802cbf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cc2:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  802cc8:	39 08                	cmp    %ecx,(%eax)
+  802cca:	75 05                	jne    802cd1 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802ccc:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802ccf:	c9                   	leave
+  802cd0:	c3                   	ret
+		return -E_NOT_SUPP;
+  802cd1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802cd6:	eb f7                	jmp    802ccf <fd2sockid+0x27>
+
+00802cd8 <alloc_sockfd>:
+{
+  802cd8:	55                   	push   %ebp
+  802cd9:	89 e5                	mov    %esp,%ebp
+  802cdb:	56                   	push   %esi
+  802cdc:	53                   	push   %ebx
+  802cdd:	83 ec 1c             	sub    $0x1c,%esp
+  802ce0:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802ce2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ce5:	50                   	push   %eax
+  802ce6:	e8 cb e8 ff ff       	call   8015b6 <fd_alloc>
+  802ceb:	89 c3                	mov    %eax,%ebx
+  802ced:	83 c4 10             	add    $0x10,%esp
+  802cf0:	85 c0                	test   %eax,%eax
+  802cf2:	78 43                	js     802d37 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802cf4:	83 ec 04             	sub    $0x4,%esp
+  802cf7:	68 07 04 00 00       	push   $0x407
+  802cfc:	ff 75 f4             	push   -0xc(%ebp)
+  802cff:	6a 00                	push   $0x0
+  802d01:	e8 90 df ff ff       	call   800c96 <sys_page_alloc>
+  802d06:	89 c3                	mov    %eax,%ebx
+  802d08:	83 c4 10             	add    $0x10,%esp
+  802d0b:	85 c0                	test   %eax,%eax
+  802d0d:	78 28                	js     802d37 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802d0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d12:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802d18:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802d1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d1d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802d24:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802d27:	83 ec 0c             	sub    $0xc,%esp
+  802d2a:	50                   	push   %eax
+  802d2b:	e8 5f e8 ff ff       	call   80158f <fd2num>
+  802d30:	89 c3                	mov    %eax,%ebx
+  802d32:	83 c4 10             	add    $0x10,%esp
+  802d35:	eb 0c                	jmp    802d43 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802d37:	83 ec 0c             	sub    $0xc,%esp
+  802d3a:	56                   	push   %esi
+  802d3b:	e8 e4 01 00 00       	call   802f24 <nsipc_close>
+		return r;
+  802d40:	83 c4 10             	add    $0x10,%esp
+}
+  802d43:	89 d8                	mov    %ebx,%eax
+  802d45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d48:	5b                   	pop    %ebx
+  802d49:	5e                   	pop    %esi
+  802d4a:	5d                   	pop    %ebp
+  802d4b:	c3                   	ret
+
+00802d4c <accept>:
+{
+  802d4c:	55                   	push   %ebp
+  802d4d:	89 e5                	mov    %esp,%ebp
+  802d4f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d52:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d55:	e8 4e ff ff ff       	call   802ca8 <fd2sockid>
+  802d5a:	85 c0                	test   %eax,%eax
+  802d5c:	78 1b                	js     802d79 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802d5e:	83 ec 04             	sub    $0x4,%esp
+  802d61:	ff 75 10             	push   0x10(%ebp)
+  802d64:	ff 75 0c             	push   0xc(%ebp)
+  802d67:	50                   	push   %eax
+  802d68:	e8 0e 01 00 00       	call   802e7b <nsipc_accept>
+  802d6d:	83 c4 10             	add    $0x10,%esp
+  802d70:	85 c0                	test   %eax,%eax
+  802d72:	78 05                	js     802d79 <accept+0x2d>
+	return alloc_sockfd(r);
+  802d74:	e8 5f ff ff ff       	call   802cd8 <alloc_sockfd>
+}
+  802d79:	c9                   	leave
+  802d7a:	c3                   	ret
+
+00802d7b <bind>:
+{
+  802d7b:	55                   	push   %ebp
+  802d7c:	89 e5                	mov    %esp,%ebp
+  802d7e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d81:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d84:	e8 1f ff ff ff       	call   802ca8 <fd2sockid>
+  802d89:	85 c0                	test   %eax,%eax
+  802d8b:	78 12                	js     802d9f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802d8d:	83 ec 04             	sub    $0x4,%esp
+  802d90:	ff 75 10             	push   0x10(%ebp)
+  802d93:	ff 75 0c             	push   0xc(%ebp)
+  802d96:	50                   	push   %eax
+  802d97:	e8 31 01 00 00       	call   802ecd <nsipc_bind>
+  802d9c:	83 c4 10             	add    $0x10,%esp
+}
+  802d9f:	c9                   	leave
+  802da0:	c3                   	ret
+
+00802da1 <shutdown>:
+{
+  802da1:	55                   	push   %ebp
+  802da2:	89 e5                	mov    %esp,%ebp
+  802da4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802da7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802daa:	e8 f9 fe ff ff       	call   802ca8 <fd2sockid>
+  802daf:	85 c0                	test   %eax,%eax
+  802db1:	78 0f                	js     802dc2 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802db3:	83 ec 08             	sub    $0x8,%esp
+  802db6:	ff 75 0c             	push   0xc(%ebp)
+  802db9:	50                   	push   %eax
+  802dba:	e8 43 01 00 00       	call   802f02 <nsipc_shutdown>
+  802dbf:	83 c4 10             	add    $0x10,%esp
+}
+  802dc2:	c9                   	leave
+  802dc3:	c3                   	ret
+
+00802dc4 <connect>:
+{
+  802dc4:	55                   	push   %ebp
+  802dc5:	89 e5                	mov    %esp,%ebp
+  802dc7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802dca:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dcd:	e8 d6 fe ff ff       	call   802ca8 <fd2sockid>
+  802dd2:	85 c0                	test   %eax,%eax
+  802dd4:	78 12                	js     802de8 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802dd6:	83 ec 04             	sub    $0x4,%esp
+  802dd9:	ff 75 10             	push   0x10(%ebp)
+  802ddc:	ff 75 0c             	push   0xc(%ebp)
+  802ddf:	50                   	push   %eax
+  802de0:	e8 59 01 00 00       	call   802f3e <nsipc_connect>
+  802de5:	83 c4 10             	add    $0x10,%esp
+}
+  802de8:	c9                   	leave
+  802de9:	c3                   	ret
+
+00802dea <listen>:
+{
+  802dea:	55                   	push   %ebp
+  802deb:	89 e5                	mov    %esp,%ebp
+  802ded:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802df0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802df3:	e8 b0 fe ff ff       	call   802ca8 <fd2sockid>
+  802df8:	85 c0                	test   %eax,%eax
+  802dfa:	78 0f                	js     802e0b <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802dfc:	83 ec 08             	sub    $0x8,%esp
+  802dff:	ff 75 0c             	push   0xc(%ebp)
+  802e02:	50                   	push   %eax
+  802e03:	e8 6b 01 00 00       	call   802f73 <nsipc_listen>
+  802e08:	83 c4 10             	add    $0x10,%esp
+}
+  802e0b:	c9                   	leave
+  802e0c:	c3                   	ret
+
+00802e0d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802e0d:	55                   	push   %ebp
+  802e0e:	89 e5                	mov    %esp,%ebp
+  802e10:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802e13:	ff 75 10             	push   0x10(%ebp)
+  802e16:	ff 75 0c             	push   0xc(%ebp)
+  802e19:	ff 75 08             	push   0x8(%ebp)
+  802e1c:	e8 41 02 00 00       	call   803062 <nsipc_socket>
+  802e21:	83 c4 10             	add    $0x10,%esp
+  802e24:	85 c0                	test   %eax,%eax
+  802e26:	78 05                	js     802e2d <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802e28:	e8 ab fe ff ff       	call   802cd8 <alloc_sockfd>
+}
+  802e2d:	c9                   	leave
+  802e2e:	c3                   	ret
+
+00802e2f <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802e2f:	55                   	push   %ebp
+  802e30:	89 e5                	mov    %esp,%ebp
+  802e32:	53                   	push   %ebx
+  802e33:	83 ec 04             	sub    $0x4,%esp
+  802e36:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802e38:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802e3f:	74 26                	je     802e67 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802e41:	6a 07                	push   $0x7
+  802e43:	68 00 80 80 00       	push   $0x808000
+  802e48:	53                   	push   %ebx
+  802e49:	ff 35 00 90 80 00    	push   0x809000
+  802e4f:	e8 c3 e5 ff ff       	call   801417 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802e54:	83 c4 0c             	add    $0xc,%esp
+  802e57:	6a 00                	push   $0x0
+  802e59:	6a 00                	push   $0x0
+  802e5b:	6a 00                	push   $0x0
+  802e5d:	e8 4a e5 ff ff       	call   8013ac <ipc_recv>
+}
+  802e62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e65:	c9                   	leave
+  802e66:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802e67:	83 ec 0c             	sub    $0xc,%esp
+  802e6a:	6a 02                	push   $0x2
+  802e6c:	e8 df e6 ff ff       	call   801550 <ipc_find_env>
+  802e71:	a3 00 90 80 00       	mov    %eax,0x809000
+  802e76:	83 c4 10             	add    $0x10,%esp
+  802e79:	eb c6                	jmp    802e41 <nsipc+0x12>
+
+00802e7b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802e7b:	55                   	push   %ebp
+  802e7c:	89 e5                	mov    %esp,%ebp
+  802e7e:	56                   	push   %esi
+  802e7f:	53                   	push   %ebx
+  802e80:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802e83:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e86:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802e8b:	8b 06                	mov    (%esi),%eax
+  802e8d:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802e92:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e97:	e8 93 ff ff ff       	call   802e2f <nsipc>
+  802e9c:	89 c3                	mov    %eax,%ebx
+  802e9e:	85 c0                	test   %eax,%eax
+  802ea0:	79 09                	jns    802eab <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802ea2:	89 d8                	mov    %ebx,%eax
+  802ea4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ea7:	5b                   	pop    %ebx
+  802ea8:	5e                   	pop    %esi
+  802ea9:	5d                   	pop    %ebp
+  802eaa:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802eab:	83 ec 04             	sub    $0x4,%esp
+  802eae:	ff 35 10 80 80 00    	push   0x808010
+  802eb4:	68 00 80 80 00       	push   $0x808000
+  802eb9:	ff 75 0c             	push   0xc(%ebp)
+  802ebc:	e8 4f db ff ff       	call   800a10 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802ec1:	a1 10 80 80 00       	mov    0x808010,%eax
+  802ec6:	89 06                	mov    %eax,(%esi)
+  802ec8:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802ecb:	eb d5                	jmp    802ea2 <nsipc_accept+0x27>
+
+00802ecd <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802ecd:	55                   	push   %ebp
+  802ece:	89 e5                	mov    %esp,%ebp
+  802ed0:	53                   	push   %ebx
+  802ed1:	83 ec 08             	sub    $0x8,%esp
+  802ed4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802ed7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eda:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802edf:	53                   	push   %ebx
+  802ee0:	ff 75 0c             	push   0xc(%ebp)
+  802ee3:	68 04 80 80 00       	push   $0x808004
+  802ee8:	e8 23 db ff ff       	call   800a10 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802eed:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802ef3:	b8 02 00 00 00       	mov    $0x2,%eax
+  802ef8:	e8 32 ff ff ff       	call   802e2f <nsipc>
+}
+  802efd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f00:	c9                   	leave
+  802f01:	c3                   	ret
+
+00802f02 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802f02:	55                   	push   %ebp
+  802f03:	89 e5                	mov    %esp,%ebp
+  802f05:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802f08:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f0b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802f10:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f13:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802f18:	b8 03 00 00 00       	mov    $0x3,%eax
+  802f1d:	e8 0d ff ff ff       	call   802e2f <nsipc>
+}
+  802f22:	c9                   	leave
+  802f23:	c3                   	ret
+
+00802f24 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802f24:	55                   	push   %ebp
+  802f25:	89 e5                	mov    %esp,%ebp
+  802f27:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802f2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f2d:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802f32:	b8 04 00 00 00       	mov    $0x4,%eax
+  802f37:	e8 f3 fe ff ff       	call   802e2f <nsipc>
+}
+  802f3c:	c9                   	leave
+  802f3d:	c3                   	ret
+
+00802f3e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802f3e:	55                   	push   %ebp
+  802f3f:	89 e5                	mov    %esp,%ebp
+  802f41:	53                   	push   %ebx
+  802f42:	83 ec 08             	sub    $0x8,%esp
+  802f45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802f48:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f4b:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802f50:	53                   	push   %ebx
+  802f51:	ff 75 0c             	push   0xc(%ebp)
+  802f54:	68 04 80 80 00       	push   $0x808004
+  802f59:	e8 b2 da ff ff       	call   800a10 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802f5e:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802f64:	b8 05 00 00 00       	mov    $0x5,%eax
+  802f69:	e8 c1 fe ff ff       	call   802e2f <nsipc>
+}
+  802f6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f71:	c9                   	leave
+  802f72:	c3                   	ret
+
+00802f73 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802f73:	55                   	push   %ebp
+  802f74:	89 e5                	mov    %esp,%ebp
+  802f76:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802f79:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f7c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802f81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f84:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802f89:	b8 06 00 00 00       	mov    $0x6,%eax
+  802f8e:	e8 9c fe ff ff       	call   802e2f <nsipc>
+}
+  802f93:	c9                   	leave
+  802f94:	c3                   	ret
+
+00802f95 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802f95:	55                   	push   %ebp
+  802f96:	89 e5                	mov    %esp,%ebp
+  802f98:	56                   	push   %esi
+  802f99:	53                   	push   %ebx
+  802f9a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802f9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fa0:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802fa5:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802fab:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fae:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802fb3:	b8 07 00 00 00       	mov    $0x7,%eax
+  802fb8:	e8 72 fe ff ff       	call   802e2f <nsipc>
+  802fbd:	89 c3                	mov    %eax,%ebx
+  802fbf:	85 c0                	test   %eax,%eax
+  802fc1:	78 22                	js     802fe5 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802fc3:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802fc8:	39 c6                	cmp    %eax,%esi
+  802fca:	0f 4e c6             	cmovle %esi,%eax
+  802fcd:	39 c3                	cmp    %eax,%ebx
+  802fcf:	7f 1d                	jg     802fee <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802fd1:	83 ec 04             	sub    $0x4,%esp
+  802fd4:	53                   	push   %ebx
+  802fd5:	68 00 80 80 00       	push   $0x808000
+  802fda:	ff 75 0c             	push   0xc(%ebp)
+  802fdd:	e8 2e da ff ff       	call   800a10 <memmove>
+  802fe2:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802fe5:	89 d8                	mov    %ebx,%eax
+  802fe7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fea:	5b                   	pop    %ebx
+  802feb:	5e                   	pop    %esi
+  802fec:	5d                   	pop    %ebp
+  802fed:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802fee:	68 7d 3e 80 00       	push   $0x803e7d
+  802ff3:	68 2c 3d 80 00       	push   $0x803d2c
+  802ff8:	6a 62                	push   $0x62
+  802ffa:	68 92 3e 80 00       	push   $0x803e92
+  802fff:	e8 46 05 00 00       	call   80354a <_panic>
+
+00803004 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803004:	55                   	push   %ebp
+  803005:	89 e5                	mov    %esp,%ebp
+  803007:	53                   	push   %ebx
+  803008:	83 ec 04             	sub    $0x4,%esp
+  80300b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80300e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803011:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  803016:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80301c:	7f 2e                	jg     80304c <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80301e:	83 ec 04             	sub    $0x4,%esp
+  803021:	53                   	push   %ebx
+  803022:	ff 75 0c             	push   0xc(%ebp)
+  803025:	68 0c 80 80 00       	push   $0x80800c
+  80302a:	e8 e1 d9 ff ff       	call   800a10 <memmove>
+	nsipcbuf.send.req_size = size;
+  80302f:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  803035:	8b 45 14             	mov    0x14(%ebp),%eax
+  803038:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  80303d:	b8 08 00 00 00       	mov    $0x8,%eax
+  803042:	e8 e8 fd ff ff       	call   802e2f <nsipc>
+}
+  803047:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80304a:	c9                   	leave
+  80304b:	c3                   	ret
+	assert(size < 1600);
+  80304c:	68 9e 3e 80 00       	push   $0x803e9e
+  803051:	68 2c 3d 80 00       	push   $0x803d2c
+  803056:	6a 6d                	push   $0x6d
+  803058:	68 92 3e 80 00       	push   $0x803e92
+  80305d:	e8 e8 04 00 00       	call   80354a <_panic>
+
+00803062 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803062:	55                   	push   %ebp
+  803063:	89 e5                	mov    %esp,%ebp
+  803065:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803068:	8b 45 08             	mov    0x8(%ebp),%eax
+  80306b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  803070:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803073:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  803078:	8b 45 10             	mov    0x10(%ebp),%eax
+  80307b:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  803080:	b8 09 00 00 00       	mov    $0x9,%eax
+  803085:	e8 a5 fd ff ff       	call   802e2f <nsipc>
+}
+  80308a:	c9                   	leave
+  80308b:	c3                   	ret
+
+0080308c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80308c:	55                   	push   %ebp
+  80308d:	89 e5                	mov    %esp,%ebp
+  80308f:	56                   	push   %esi
+  803090:	53                   	push   %ebx
+  803091:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803094:	83 ec 0c             	sub    $0xc,%esp
+  803097:	ff 75 08             	push   0x8(%ebp)
+  80309a:	e8 00 e5 ff ff       	call   80159f <fd2data>
+  80309f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8030a1:	83 c4 08             	add    $0x8,%esp
+  8030a4:	68 aa 3e 80 00       	push   $0x803eaa
+  8030a9:	53                   	push   %ebx
+  8030aa:	e8 db d7 ff ff       	call   80088a <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8030af:	8b 46 04             	mov    0x4(%esi),%eax
+  8030b2:	2b 06                	sub    (%esi),%eax
+  8030b4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8030ba:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8030c1:	00 00 00 
+	stat->st_dev = &devpipe;
+  8030c4:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  8030cb:	40 80 00 
+	return 0;
+}
+  8030ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030d6:	5b                   	pop    %ebx
+  8030d7:	5e                   	pop    %esi
+  8030d8:	5d                   	pop    %ebp
+  8030d9:	c3                   	ret
+
+008030da <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8030da:	55                   	push   %ebp
+  8030db:	89 e5                	mov    %esp,%ebp
+  8030dd:	53                   	push   %ebx
+  8030de:	83 ec 0c             	sub    $0xc,%esp
+  8030e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8030e4:	53                   	push   %ebx
+  8030e5:	6a 00                	push   $0x0
+  8030e7:	e8 37 dc ff ff       	call   800d23 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8030ec:	89 1c 24             	mov    %ebx,(%esp)
+  8030ef:	e8 ab e4 ff ff       	call   80159f <fd2data>
+  8030f4:	83 c4 08             	add    $0x8,%esp
+  8030f7:	50                   	push   %eax
+  8030f8:	6a 00                	push   $0x0
+  8030fa:	e8 24 dc ff ff       	call   800d23 <sys_page_unmap>
+}
+  8030ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803102:	c9                   	leave
+  803103:	c3                   	ret
+
+00803104 <_pipeisclosed>:
+{
+  803104:	55                   	push   %ebp
+  803105:	89 e5                	mov    %esp,%ebp
+  803107:	57                   	push   %edi
+  803108:	56                   	push   %esi
+  803109:	53                   	push   %ebx
+  80310a:	83 ec 1c             	sub    $0x1c,%esp
+  80310d:	89 c7                	mov    %eax,%edi
+  80310f:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  803111:	a1 00 50 80 00       	mov    0x805000,%eax
+  803116:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803119:	83 ec 0c             	sub    $0xc,%esp
+  80311c:	57                   	push   %edi
+  80311d:	e8 07 05 00 00       	call   803629 <pageref>
+  803122:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803125:	89 34 24             	mov    %esi,(%esp)
+  803128:	e8 fc 04 00 00       	call   803629 <pageref>
+		nn = thisenv->env_runs;
+  80312d:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803133:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  803136:	83 c4 10             	add    $0x10,%esp
+  803139:	39 cb                	cmp    %ecx,%ebx
+  80313b:	74 1b                	je     803158 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80313d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803140:	75 cf                	jne    803111 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803142:	8b 42 58             	mov    0x58(%edx),%eax
+  803145:	6a 01                	push   $0x1
+  803147:	50                   	push   %eax
+  803148:	53                   	push   %ebx
+  803149:	68 b1 3e 80 00       	push   $0x803eb1
+  80314e:	e8 49 d1 ff ff       	call   80029c <cprintf>
+  803153:	83 c4 10             	add    $0x10,%esp
+  803156:	eb b9                	jmp    803111 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  803158:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80315b:	0f 94 c0             	sete   %al
+  80315e:	0f b6 c0             	movzbl %al,%eax
+}
+  803161:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803164:	5b                   	pop    %ebx
+  803165:	5e                   	pop    %esi
+  803166:	5f                   	pop    %edi
+  803167:	5d                   	pop    %ebp
+  803168:	c3                   	ret
+
+00803169 <devpipe_write>:
+{
+  803169:	55                   	push   %ebp
+  80316a:	89 e5                	mov    %esp,%ebp
+  80316c:	57                   	push   %edi
+  80316d:	56                   	push   %esi
+  80316e:	53                   	push   %ebx
+  80316f:	83 ec 28             	sub    $0x28,%esp
+  803172:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  803175:	56                   	push   %esi
+  803176:	e8 24 e4 ff ff       	call   80159f <fd2data>
+  80317b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80317d:	83 c4 10             	add    $0x10,%esp
+  803180:	bf 00 00 00 00       	mov    $0x0,%edi
+  803185:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803188:	75 09                	jne    803193 <devpipe_write+0x2a>
+	return i;
+  80318a:	89 f8                	mov    %edi,%eax
+  80318c:	eb 23                	jmp    8031b1 <devpipe_write+0x48>
+			sys_yield();
+  80318e:	e8 e4 da ff ff       	call   800c77 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803193:	8b 43 04             	mov    0x4(%ebx),%eax
+  803196:	8b 0b                	mov    (%ebx),%ecx
+  803198:	8d 51 20             	lea    0x20(%ecx),%edx
+  80319b:	39 d0                	cmp    %edx,%eax
+  80319d:	72 1a                	jb     8031b9 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80319f:	89 da                	mov    %ebx,%edx
+  8031a1:	89 f0                	mov    %esi,%eax
+  8031a3:	e8 5c ff ff ff       	call   803104 <_pipeisclosed>
+  8031a8:	85 c0                	test   %eax,%eax
+  8031aa:	74 e2                	je     80318e <devpipe_write+0x25>
+				return 0;
+  8031ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031b4:	5b                   	pop    %ebx
+  8031b5:	5e                   	pop    %esi
+  8031b6:	5f                   	pop    %edi
+  8031b7:	5d                   	pop    %ebp
+  8031b8:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8031b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031bc:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8031c0:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8031c3:	89 c2                	mov    %eax,%edx
+  8031c5:	c1 fa 1f             	sar    $0x1f,%edx
+  8031c8:	89 d1                	mov    %edx,%ecx
+  8031ca:	c1 e9 1b             	shr    $0x1b,%ecx
+  8031cd:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8031d0:	83 e2 1f             	and    $0x1f,%edx
+  8031d3:	29 ca                	sub    %ecx,%edx
+  8031d5:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8031d9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8031dd:	83 c0 01             	add    $0x1,%eax
+  8031e0:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8031e3:	83 c7 01             	add    $0x1,%edi
+  8031e6:	eb 9d                	jmp    803185 <devpipe_write+0x1c>
+
+008031e8 <devpipe_read>:
+{
+  8031e8:	55                   	push   %ebp
+  8031e9:	89 e5                	mov    %esp,%ebp
+  8031eb:	57                   	push   %edi
+  8031ec:	56                   	push   %esi
+  8031ed:	53                   	push   %ebx
+  8031ee:	83 ec 18             	sub    $0x18,%esp
+  8031f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8031f4:	57                   	push   %edi
+  8031f5:	e8 a5 e3 ff ff       	call   80159f <fd2data>
+  8031fa:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8031fc:	83 c4 10             	add    $0x10,%esp
+  8031ff:	be 00 00 00 00       	mov    $0x0,%esi
+  803204:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803207:	75 13                	jne    80321c <devpipe_read+0x34>
+	return i;
+  803209:	89 f0                	mov    %esi,%eax
+  80320b:	eb 02                	jmp    80320f <devpipe_read+0x27>
+				return i;
+  80320d:	89 f0                	mov    %esi,%eax
+}
+  80320f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803212:	5b                   	pop    %ebx
+  803213:	5e                   	pop    %esi
+  803214:	5f                   	pop    %edi
+  803215:	5d                   	pop    %ebp
+  803216:	c3                   	ret
+			sys_yield();
+  803217:	e8 5b da ff ff       	call   800c77 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80321c:	8b 03                	mov    (%ebx),%eax
+  80321e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803221:	75 18                	jne    80323b <devpipe_read+0x53>
+			if (i > 0)
+  803223:	85 f6                	test   %esi,%esi
+  803225:	75 e6                	jne    80320d <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803227:	89 da                	mov    %ebx,%edx
+  803229:	89 f8                	mov    %edi,%eax
+  80322b:	e8 d4 fe ff ff       	call   803104 <_pipeisclosed>
+  803230:	85 c0                	test   %eax,%eax
+  803232:	74 e3                	je     803217 <devpipe_read+0x2f>
+				return 0;
+  803234:	b8 00 00 00 00       	mov    $0x0,%eax
+  803239:	eb d4                	jmp    80320f <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80323b:	99                   	cltd
+  80323c:	c1 ea 1b             	shr    $0x1b,%edx
+  80323f:	01 d0                	add    %edx,%eax
+  803241:	83 e0 1f             	and    $0x1f,%eax
+  803244:	29 d0                	sub    %edx,%eax
+  803246:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80324b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80324e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803251:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803254:	83 c6 01             	add    $0x1,%esi
+  803257:	eb ab                	jmp    803204 <devpipe_read+0x1c>
+
+00803259 <pipe>:
+{
+  803259:	55                   	push   %ebp
+  80325a:	89 e5                	mov    %esp,%ebp
+  80325c:	56                   	push   %esi
+  80325d:	53                   	push   %ebx
+  80325e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803261:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803264:	50                   	push   %eax
+  803265:	e8 4c e3 ff ff       	call   8015b6 <fd_alloc>
+  80326a:	89 c3                	mov    %eax,%ebx
+  80326c:	83 c4 10             	add    $0x10,%esp
+  80326f:	85 c0                	test   %eax,%eax
+  803271:	0f 88 23 01 00 00    	js     80339a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803277:	83 ec 04             	sub    $0x4,%esp
+  80327a:	68 07 04 00 00       	push   $0x407
+  80327f:	ff 75 f4             	push   -0xc(%ebp)
+  803282:	6a 00                	push   $0x0
+  803284:	e8 0d da ff ff       	call   800c96 <sys_page_alloc>
+  803289:	89 c3                	mov    %eax,%ebx
+  80328b:	83 c4 10             	add    $0x10,%esp
+  80328e:	85 c0                	test   %eax,%eax
+  803290:	0f 88 04 01 00 00    	js     80339a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803296:	83 ec 0c             	sub    $0xc,%esp
+  803299:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80329c:	50                   	push   %eax
+  80329d:	e8 14 e3 ff ff       	call   8015b6 <fd_alloc>
+  8032a2:	89 c3                	mov    %eax,%ebx
+  8032a4:	83 c4 10             	add    $0x10,%esp
+  8032a7:	85 c0                	test   %eax,%eax
+  8032a9:	0f 88 db 00 00 00    	js     80338a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032af:	83 ec 04             	sub    $0x4,%esp
+  8032b2:	68 07 04 00 00       	push   $0x407
+  8032b7:	ff 75 f0             	push   -0x10(%ebp)
+  8032ba:	6a 00                	push   $0x0
+  8032bc:	e8 d5 d9 ff ff       	call   800c96 <sys_page_alloc>
+  8032c1:	89 c3                	mov    %eax,%ebx
+  8032c3:	83 c4 10             	add    $0x10,%esp
+  8032c6:	85 c0                	test   %eax,%eax
+  8032c8:	0f 88 bc 00 00 00    	js     80338a <pipe+0x131>
+	va = fd2data(fd0);
+  8032ce:	83 ec 0c             	sub    $0xc,%esp
+  8032d1:	ff 75 f4             	push   -0xc(%ebp)
+  8032d4:	e8 c6 e2 ff ff       	call   80159f <fd2data>
+  8032d9:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032db:	83 c4 0c             	add    $0xc,%esp
+  8032de:	68 07 04 00 00       	push   $0x407
+  8032e3:	50                   	push   %eax
+  8032e4:	6a 00                	push   $0x0
+  8032e6:	e8 ab d9 ff ff       	call   800c96 <sys_page_alloc>
+  8032eb:	89 c3                	mov    %eax,%ebx
+  8032ed:	83 c4 10             	add    $0x10,%esp
+  8032f0:	85 c0                	test   %eax,%eax
+  8032f2:	0f 88 82 00 00 00    	js     80337a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032f8:	83 ec 0c             	sub    $0xc,%esp
+  8032fb:	ff 75 f0             	push   -0x10(%ebp)
+  8032fe:	e8 9c e2 ff ff       	call   80159f <fd2data>
+  803303:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80330a:	50                   	push   %eax
+  80330b:	6a 00                	push   $0x0
+  80330d:	56                   	push   %esi
+  80330e:	6a 00                	push   $0x0
+  803310:	e8 cc d9 ff ff       	call   800ce1 <sys_page_map>
+  803315:	89 c3                	mov    %eax,%ebx
+  803317:	83 c4 20             	add    $0x20,%esp
+  80331a:	85 c0                	test   %eax,%eax
+  80331c:	78 4e                	js     80336c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80331e:	a1 60 40 80 00       	mov    0x804060,%eax
+  803323:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803326:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803328:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80332b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803332:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803335:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803337:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80333a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803341:	83 ec 0c             	sub    $0xc,%esp
+  803344:	ff 75 f4             	push   -0xc(%ebp)
+  803347:	e8 43 e2 ff ff       	call   80158f <fd2num>
+  80334c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80334f:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803351:	83 c4 04             	add    $0x4,%esp
+  803354:	ff 75 f0             	push   -0x10(%ebp)
+  803357:	e8 33 e2 ff ff       	call   80158f <fd2num>
+  80335c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80335f:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803362:	83 c4 10             	add    $0x10,%esp
+  803365:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80336a:	eb 2e                	jmp    80339a <pipe+0x141>
+	sys_page_unmap(0, va);
+  80336c:	83 ec 08             	sub    $0x8,%esp
+  80336f:	56                   	push   %esi
+  803370:	6a 00                	push   $0x0
+  803372:	e8 ac d9 ff ff       	call   800d23 <sys_page_unmap>
+  803377:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80337a:	83 ec 08             	sub    $0x8,%esp
+  80337d:	ff 75 f0             	push   -0x10(%ebp)
+  803380:	6a 00                	push   $0x0
+  803382:	e8 9c d9 ff ff       	call   800d23 <sys_page_unmap>
+  803387:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80338a:	83 ec 08             	sub    $0x8,%esp
+  80338d:	ff 75 f4             	push   -0xc(%ebp)
+  803390:	6a 00                	push   $0x0
+  803392:	e8 8c d9 ff ff       	call   800d23 <sys_page_unmap>
+  803397:	83 c4 10             	add    $0x10,%esp
+}
+  80339a:	89 d8                	mov    %ebx,%eax
+  80339c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80339f:	5b                   	pop    %ebx
+  8033a0:	5e                   	pop    %esi
+  8033a1:	5d                   	pop    %ebp
+  8033a2:	c3                   	ret
+
+008033a3 <pipeisclosed>:
+{
+  8033a3:	55                   	push   %ebp
+  8033a4:	89 e5                	mov    %esp,%ebp
+  8033a6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033ac:	50                   	push   %eax
+  8033ad:	ff 75 08             	push   0x8(%ebp)
+  8033b0:	e8 57 e2 ff ff       	call   80160c <fd_lookup>
+  8033b5:	83 c4 10             	add    $0x10,%esp
+  8033b8:	85 c0                	test   %eax,%eax
+  8033ba:	78 18                	js     8033d4 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8033bc:	83 ec 0c             	sub    $0xc,%esp
+  8033bf:	ff 75 f4             	push   -0xc(%ebp)
+  8033c2:	e8 d8 e1 ff ff       	call   80159f <fd2data>
+  8033c7:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8033c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033cc:	e8 33 fd ff ff       	call   803104 <_pipeisclosed>
+  8033d1:	83 c4 10             	add    $0x10,%esp
+}
+  8033d4:	c9                   	leave
+  8033d5:	c3                   	ret
+
+008033d6 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8033d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033db:	c3                   	ret
+
+008033dc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8033dc:	55                   	push   %ebp
+  8033dd:	89 e5                	mov    %esp,%ebp
+  8033df:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8033e2:	68 c9 3e 80 00       	push   $0x803ec9
+  8033e7:	ff 75 0c             	push   0xc(%ebp)
+  8033ea:	e8 9b d4 ff ff       	call   80088a <strcpy>
+	return 0;
+}
+  8033ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f4:	c9                   	leave
+  8033f5:	c3                   	ret
+
+008033f6 <devcons_write>:
+{
+  8033f6:	55                   	push   %ebp
+  8033f7:	89 e5                	mov    %esp,%ebp
+  8033f9:	57                   	push   %edi
+  8033fa:	56                   	push   %esi
+  8033fb:	53                   	push   %ebx
+  8033fc:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803402:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803407:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80340d:	eb 2e                	jmp    80343d <devcons_write+0x47>
+		m = n - tot;
+  80340f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803412:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803414:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803419:	39 c3                	cmp    %eax,%ebx
+  80341b:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80341e:	83 ec 04             	sub    $0x4,%esp
+  803421:	53                   	push   %ebx
+  803422:	89 f0                	mov    %esi,%eax
+  803424:	03 45 0c             	add    0xc(%ebp),%eax
+  803427:	50                   	push   %eax
+  803428:	57                   	push   %edi
+  803429:	e8 e2 d5 ff ff       	call   800a10 <memmove>
+		sys_cputs(buf, m);
+  80342e:	83 c4 08             	add    $0x8,%esp
+  803431:	53                   	push   %ebx
+  803432:	57                   	push   %edi
+  803433:	e8 82 d7 ff ff       	call   800bba <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803438:	01 de                	add    %ebx,%esi
+  80343a:	83 c4 10             	add    $0x10,%esp
+  80343d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803440:	72 cd                	jb     80340f <devcons_write+0x19>
+}
+  803442:	89 f0                	mov    %esi,%eax
+  803444:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803447:	5b                   	pop    %ebx
+  803448:	5e                   	pop    %esi
+  803449:	5f                   	pop    %edi
+  80344a:	5d                   	pop    %ebp
+  80344b:	c3                   	ret
+
+0080344c <devcons_read>:
+{
+  80344c:	55                   	push   %ebp
+  80344d:	89 e5                	mov    %esp,%ebp
+  80344f:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803452:	b8 00 00 00 00       	mov    $0x0,%eax
+  803457:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80345b:	75 07                	jne    803464 <devcons_read+0x18>
+  80345d:	eb 1f                	jmp    80347e <devcons_read+0x32>
+		sys_yield();
+  80345f:	e8 13 d8 ff ff       	call   800c77 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803464:	e8 77 d7 ff ff       	call   800be0 <sys_cgetc>
+  803469:	85 c0                	test   %eax,%eax
+  80346b:	74 f2                	je     80345f <devcons_read+0x13>
+	if (c < 0)
+  80346d:	78 0f                	js     80347e <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80346f:	83 f8 04             	cmp    $0x4,%eax
+  803472:	74 0c                	je     803480 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803474:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803477:	88 02                	mov    %al,(%edx)
+	return 1;
+  803479:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80347e:	c9                   	leave
+  80347f:	c3                   	ret
+		return 0;
+  803480:	b8 00 00 00 00       	mov    $0x0,%eax
+  803485:	eb f7                	jmp    80347e <devcons_read+0x32>
+
+00803487 <cputchar>:
+{
+  803487:	55                   	push   %ebp
+  803488:	89 e5                	mov    %esp,%ebp
+  80348a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80348d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803490:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803493:	6a 01                	push   $0x1
+  803495:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803498:	50                   	push   %eax
+  803499:	e8 1c d7 ff ff       	call   800bba <sys_cputs>
+}
+  80349e:	83 c4 10             	add    $0x10,%esp
+  8034a1:	c9                   	leave
+  8034a2:	c3                   	ret
+
+008034a3 <getchar>:
+{
+  8034a3:	55                   	push   %ebp
+  8034a4:	89 e5                	mov    %esp,%ebp
+  8034a6:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8034a9:	6a 01                	push   $0x1
+  8034ab:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034ae:	50                   	push   %eax
+  8034af:	6a 00                	push   $0x0
+  8034b1:	e8 bc e3 ff ff       	call   801872 <read>
+	if (r < 0)
+  8034b6:	83 c4 10             	add    $0x10,%esp
+  8034b9:	85 c0                	test   %eax,%eax
+  8034bb:	78 06                	js     8034c3 <getchar+0x20>
+	if (r < 1)
+  8034bd:	74 06                	je     8034c5 <getchar+0x22>
+	return c;
+  8034bf:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8034c3:	c9                   	leave
+  8034c4:	c3                   	ret
+		return -E_EOF;
+  8034c5:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8034ca:	eb f7                	jmp    8034c3 <getchar+0x20>
+
+008034cc <iscons>:
+{
+  8034cc:	55                   	push   %ebp
+  8034cd:	89 e5                	mov    %esp,%ebp
+  8034cf:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8034d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034d5:	50                   	push   %eax
+  8034d6:	ff 75 08             	push   0x8(%ebp)
+  8034d9:	e8 2e e1 ff ff       	call   80160c <fd_lookup>
+  8034de:	83 c4 10             	add    $0x10,%esp
+  8034e1:	85 c0                	test   %eax,%eax
+  8034e3:	78 11                	js     8034f6 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8034e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034e8:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8034ee:	39 10                	cmp    %edx,(%eax)
+  8034f0:	0f 94 c0             	sete   %al
+  8034f3:	0f b6 c0             	movzbl %al,%eax
+}
+  8034f6:	c9                   	leave
+  8034f7:	c3                   	ret
+
+008034f8 <opencons>:
+{
+  8034f8:	55                   	push   %ebp
+  8034f9:	89 e5                	mov    %esp,%ebp
+  8034fb:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8034fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803501:	50                   	push   %eax
+  803502:	e8 af e0 ff ff       	call   8015b6 <fd_alloc>
+  803507:	83 c4 10             	add    $0x10,%esp
+  80350a:	85 c0                	test   %eax,%eax
+  80350c:	78 3a                	js     803548 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80350e:	83 ec 04             	sub    $0x4,%esp
+  803511:	68 07 04 00 00       	push   $0x407
+  803516:	ff 75 f4             	push   -0xc(%ebp)
+  803519:	6a 00                	push   $0x0
+  80351b:	e8 76 d7 ff ff       	call   800c96 <sys_page_alloc>
+  803520:	83 c4 10             	add    $0x10,%esp
+  803523:	85 c0                	test   %eax,%eax
+  803525:	78 21                	js     803548 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803527:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80352a:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  803530:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803532:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803535:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80353c:	83 ec 0c             	sub    $0xc,%esp
+  80353f:	50                   	push   %eax
+  803540:	e8 4a e0 ff ff       	call   80158f <fd2num>
+  803545:	83 c4 10             	add    $0x10,%esp
+}
+  803548:	c9                   	leave
+  803549:	c3                   	ret
+
+0080354a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80354a:	55                   	push   %ebp
+  80354b:	89 e5                	mov    %esp,%ebp
+  80354d:	56                   	push   %esi
+  80354e:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80354f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803552:	8b 35 08 40 80 00    	mov    0x804008,%esi
+  803558:	e8 f3 d6 ff ff       	call   800c50 <sys_getenvid>
+  80355d:	83 ec 0c             	sub    $0xc,%esp
+  803560:	ff 75 0c             	push   0xc(%ebp)
+  803563:	ff 75 08             	push   0x8(%ebp)
+  803566:	56                   	push   %esi
+  803567:	50                   	push   %eax
+  803568:	68 d8 3e 80 00       	push   $0x803ed8
+  80356d:	e8 2a cd ff ff       	call   80029c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803572:	83 c4 18             	add    $0x18,%esp
+  803575:	53                   	push   %ebx
+  803576:	ff 75 10             	push   0x10(%ebp)
+  803579:	e8 cd cc ff ff       	call   80024b <vcprintf>
+	cprintf("\n");
+  80357e:	c7 04 24 c2 3e 80 00 	movl   $0x803ec2,(%esp)
+  803585:	e8 12 cd ff ff       	call   80029c <cprintf>
+  80358a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80358d:	cc                   	int3
+	while (1)
+  80358e:	eb fd                	jmp    80358d <_panic+0x43>
+
+00803590 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803590:	55                   	push   %ebp
+  803591:	89 e5                	mov    %esp,%ebp
+  803593:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803596:	83 3d 04 90 80 00 00 	cmpl   $0x0,0x809004
+  80359d:	74 0a                	je     8035a9 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80359f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035a2:	a3 04 90 80 00       	mov    %eax,0x809004
+}
+  8035a7:	c9                   	leave
+  8035a8:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8035a9:	83 ec 04             	sub    $0x4,%esp
+  8035ac:	6a 07                	push   $0x7
+  8035ae:	68 00 f0 bf ee       	push   $0xeebff000
+  8035b3:	6a 00                	push   $0x0
+  8035b5:	e8 dc d6 ff ff       	call   800c96 <sys_page_alloc>
+  8035ba:	83 c4 10             	add    $0x10,%esp
+  8035bd:	85 c0                	test   %eax,%eax
+  8035bf:	75 2c                	jne    8035ed <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8035c1:	83 ec 08             	sub    $0x8,%esp
+  8035c4:	68 03 36 80 00       	push   $0x803603
+  8035c9:	6a 00                	push   $0x0
+  8035cb:	e8 31 d8 ff ff       	call   800e01 <sys_env_set_pgfault_upcall>
+  8035d0:	83 c4 10             	add    $0x10,%esp
+  8035d3:	85 c0                	test   %eax,%eax
+  8035d5:	74 c8                	je     80359f <set_pgfault_handler+0xf>
+  8035d7:	68 44 3f 80 00       	push   $0x803f44
+  8035dc:	68 2c 3d 80 00       	push   $0x803d2c
+  8035e1:	6a 20                	push   $0x20
+  8035e3:	68 74 3f 80 00       	push   $0x803f74
+  8035e8:	e8 5d ff ff ff       	call   80354a <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8035ed:	68 fc 3e 80 00       	push   $0x803efc
+  8035f2:	68 2c 3d 80 00       	push   $0x803d2c
+  8035f7:	6a 1e                	push   $0x1e
+  8035f9:	68 74 3f 80 00       	push   $0x803f74
+  8035fe:	e8 47 ff ff ff       	call   80354a <_panic>
+
+00803603 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803603:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803604:	a1 04 90 80 00       	mov    0x809004,%eax
+	call *%eax
+  803609:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80360b:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80360e:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803613:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803618:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  80361c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80361f:	83 c4 08             	add    $0x8,%esp
+	popal
+  803622:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803623:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803626:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803627:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803628:	c3                   	ret
+
+00803629 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803629:	55                   	push   %ebp
+  80362a:	89 e5                	mov    %esp,%ebp
+  80362c:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80362f:	89 c2                	mov    %eax,%edx
+  803631:	c1 ea 16             	shr    $0x16,%edx
+  803634:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80363b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803640:	f6 c1 01             	test   $0x1,%cl
+  803643:	74 22                	je     803667 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803645:	c1 e8 0c             	shr    $0xc,%eax
+  803648:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80364f:	a8 01                	test   $0x1,%al
+  803651:	74 14                	je     803667 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803653:	c1 e8 0c             	shr    $0xc,%eax
+  803656:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803659:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803660:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803664:	0f b7 d2             	movzwl %dx,%edx
+}
+  803667:	89 d0                	mov    %edx,%eax
+  803669:	5d                   	pop    %ebp
+  80366a:	c3                   	ret
+
+0080366b <dm>:
+  80366b:	55                   	push   %ebp
+  80366c:	57                   	push   %edi
+  80366d:	56                   	push   %esi
+  80366e:	53                   	push   %ebx
+  80366f:	83 ec 24             	sub    $0x24,%esp
+  803672:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803676:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80367a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80367e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803682:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803686:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80368a:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80368e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803693:	b8 00 00 00 00       	mov    $0x0,%eax
+  803698:	ba 00 00 00 00       	mov    $0x0,%edx
+  80369d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8036a4:	00 
+  8036a5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8036ac:	00 
+  8036ad:	89 fb                	mov    %edi,%ebx
+  8036af:	eb 08                	jmp    8036b9 <dm+0x4e>
+  8036b1:	83 e9 01             	sub    $0x1,%ecx
+  8036b4:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8036b7:	74 68                	je     803721 <dm+0xb6>
+  8036b9:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8036bd:	01 c0                	add    %eax,%eax
+  8036bf:	89 c6                	mov    %eax,%esi
+  8036c1:	89 d7                	mov    %edx,%edi
+  8036c3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036c7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036cb:	0f ad d0             	shrd   %cl,%edx,%eax
+  8036ce:	d3 ea                	shr    %cl,%edx
+  8036d0:	f6 c1 20             	test   $0x20,%cl
+  8036d3:	74 04                	je     8036d9 <dm+0x6e>
+  8036d5:	89 d0                	mov    %edx,%eax
+  8036d7:	31 d2                	xor    %edx,%edx
+  8036d9:	83 e0 01             	and    $0x1,%eax
+  8036dc:	89 04 24             	mov    %eax,(%esp)
+  8036df:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8036e6:	00 
+  8036e7:	8b 04 24             	mov    (%esp),%eax
+  8036ea:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8036ee:	09 f0                	or     %esi,%eax
+  8036f0:	09 fa                	or     %edi,%edx
+  8036f2:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8036f6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8036fa:	39 f0                	cmp    %esi,%eax
+  8036fc:	89 d5                	mov    %edx,%ebp
+  8036fe:	19 fd                	sbb    %edi,%ebp
+  803700:	72 af                	jb     8036b1 <dm+0x46>
+  803702:	29 f0                	sub    %esi,%eax
+  803704:	19 fa                	sbb    %edi,%edx
+  803706:	89 cf                	mov    %ecx,%edi
+  803708:	c1 ef 05             	shr    $0x5,%edi
+  80370b:	83 e7 01             	and    $0x1,%edi
+  80370e:	89 fe                	mov    %edi,%esi
+  803710:	83 f6 01             	xor    $0x1,%esi
+  803713:	d3 e6                	shl    %cl,%esi
+  803715:	d3 e7                	shl    %cl,%edi
+  803717:	09 74 24 18          	or     %esi,0x18(%esp)
+  80371b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80371f:	eb 90                	jmp    8036b1 <dm+0x46>
+  803721:	85 db                	test   %ebx,%ebx
+  803723:	74 05                	je     80372a <dm+0xbf>
+  803725:	89 03                	mov    %eax,(%ebx)
+  803727:	89 53 04             	mov    %edx,0x4(%ebx)
+  80372a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80372e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803732:	83 c4 24             	add    $0x24,%esp
+  803735:	5b                   	pop    %ebx
+  803736:	5e                   	pop    %esi
+  803737:	5f                   	pop    %edi
+  803738:	5d                   	pop    %ebp
+  803739:	c3                   	ret
+
+0080373a <__udivdi3>:
+  80373a:	83 ec 08             	sub    $0x8,%esp
+  80373d:	6a 00                	push   $0x0
+  80373f:	ff 74 24 1c          	push   0x1c(%esp)
+  803743:	ff 74 24 1c          	push   0x1c(%esp)
+  803747:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80374b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80374f:	e8 17 ff ff ff       	call   80366b <dm>
+  803754:	83 c4 14             	add    $0x14,%esp
+  803757:	c3                   	ret
+
+00803758 <__umoddi3>:
+  803758:	83 ec 18             	sub    $0x18,%esp
+  80375b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80375f:	50                   	push   %eax
+  803760:	ff 74 24 2c          	push   0x2c(%esp)
+  803764:	ff 74 24 2c          	push   0x2c(%esp)
+  803768:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80376c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803770:	e8 f6 fe ff ff       	call   80366b <dm>
+  803775:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803779:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80377d:	83 c4 24             	add    $0x24,%esp
+  803780:	c3                   	ret
+
+00803781 <__divdi3>:
+  803781:	53                   	push   %ebx
+  803782:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803786:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80378a:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80378e:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803792:	85 d2                	test   %edx,%edx
+  803794:	78 15                	js     8037ab <__divdi3+0x2a>
+  803796:	85 db                	test   %ebx,%ebx
+  803798:	78 34                	js     8037ce <__divdi3+0x4d>
+  80379a:	83 ec 04             	sub    $0x4,%esp
+  80379d:	6a 00                	push   $0x0
+  80379f:	53                   	push   %ebx
+  8037a0:	51                   	push   %ecx
+  8037a1:	e8 c5 fe ff ff       	call   80366b <dm>
+  8037a6:	83 c4 10             	add    $0x10,%esp
+  8037a9:	eb 21                	jmp    8037cc <__divdi3+0x4b>
+  8037ab:	f7 d8                	neg    %eax
+  8037ad:	83 d2 00             	adc    $0x0,%edx
+  8037b0:	f7 da                	neg    %edx
+  8037b2:	85 db                	test   %ebx,%ebx
+  8037b4:	78 30                	js     8037e6 <__divdi3+0x65>
+  8037b6:	83 ec 04             	sub    $0x4,%esp
+  8037b9:	6a 00                	push   $0x0
+  8037bb:	53                   	push   %ebx
+  8037bc:	51                   	push   %ecx
+  8037bd:	e8 a9 fe ff ff       	call   80366b <dm>
+  8037c2:	83 c4 10             	add    $0x10,%esp
+  8037c5:	f7 d8                	neg    %eax
+  8037c7:	83 d2 00             	adc    $0x0,%edx
+  8037ca:	f7 da                	neg    %edx
+  8037cc:	5b                   	pop    %ebx
+  8037cd:	c3                   	ret
+  8037ce:	83 ec 04             	sub    $0x4,%esp
+  8037d1:	6a 00                	push   $0x0
+  8037d3:	f7 d9                	neg    %ecx
+  8037d5:	83 d3 00             	adc    $0x0,%ebx
+  8037d8:	f7 db                	neg    %ebx
+  8037da:	53                   	push   %ebx
+  8037db:	51                   	push   %ecx
+  8037dc:	e8 8a fe ff ff       	call   80366b <dm>
+  8037e1:	83 c4 10             	add    $0x10,%esp
+  8037e4:	eb df                	jmp    8037c5 <__divdi3+0x44>
+  8037e6:	83 ec 04             	sub    $0x4,%esp
+  8037e9:	6a 00                	push   $0x0
+  8037eb:	f7 d9                	neg    %ecx
+  8037ed:	83 d3 00             	adc    $0x0,%ebx
+  8037f0:	f7 db                	neg    %ebx
+  8037f2:	53                   	push   %ebx
+  8037f3:	51                   	push   %ecx
+  8037f4:	e8 72 fe ff ff       	call   80366b <dm>
+  8037f9:	83 c4 10             	add    $0x10,%esp
+  8037fc:	eb ce                	jmp    8037cc <__divdi3+0x4b>
+
+008037fe <__moddi3>:
+  8037fe:	55                   	push   %ebp
+  8037ff:	57                   	push   %edi
+  803800:	56                   	push   %esi
+  803801:	53                   	push   %ebx
+  803802:	83 ec 24             	sub    $0x24,%esp
+  803805:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803809:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80380d:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803811:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803815:	85 d2                	test   %edx,%edx
+  803817:	78 3b                	js     803854 <__moddi3+0x56>
+  803819:	83 ec 04             	sub    $0x4,%esp
+  80381c:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803820:	56                   	push   %esi
+  803821:	89 ce                	mov    %ecx,%esi
+  803823:	f7 de                	neg    %esi
+  803825:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803829:	89 de                	mov    %ebx,%esi
+  80382b:	83 d6 00             	adc    $0x0,%esi
+  80382e:	f7 de                	neg    %esi
+  803830:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803834:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803838:	0f 48 f1             	cmovs  %ecx,%esi
+  80383b:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803840:	53                   	push   %ebx
+  803841:	56                   	push   %esi
+  803842:	e8 24 fe ff ff       	call   80366b <dm>
+  803847:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80384b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80384f:	83 c4 10             	add    $0x10,%esp
+  803852:	eb 47                	jmp    80389b <__moddi3+0x9d>
+  803854:	f7 d8                	neg    %eax
+  803856:	83 d2 00             	adc    $0x0,%edx
+  803859:	f7 da                	neg    %edx
+  80385b:	83 ec 04             	sub    $0x4,%esp
+  80385e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803862:	56                   	push   %esi
+  803863:	89 cf                	mov    %ecx,%edi
+  803865:	f7 df                	neg    %edi
+  803867:	89 de                	mov    %ebx,%esi
+  803869:	83 d6 00             	adc    $0x0,%esi
+  80386c:	f7 de                	neg    %esi
+  80386e:	0f 49 cf             	cmovns %edi,%ecx
+  803871:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803875:	0f 49 de             	cmovns %esi,%ebx
+  803878:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80387c:	ff 74 24 0c          	push   0xc(%esp)
+  803880:	ff 74 24 0c          	push   0xc(%esp)
+  803884:	e8 e2 fd ff ff       	call   80366b <dm>
+  803889:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80388d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803891:	f7 d8                	neg    %eax
+  803893:	83 d2 00             	adc    $0x0,%edx
+  803896:	f7 da                	neg    %edx
+  803898:	83 c4 10             	add    $0x10,%esp
+  80389b:	83 c4 24             	add    $0x24,%esp
+  80389e:	5b                   	pop    %ebx
+  80389f:	5e                   	pop    %esi
+  8038a0:	5f                   	pop    %edi
+  8038a1:	5d                   	pop    %ebp
+  8038a2:	c3                   	ret
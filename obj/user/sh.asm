@@ -0,0 +1,9747 @@
+
+obj/user/sh.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 f2 09 00 00       	call   800a23 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <_gettoken>:
+#define WHITESPACE " \t\r\n"
+#define SYMBOLS "<|>&;()"
+
+int
+_gettoken(char *s, char **p1, char **p2)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int t;
+
+	if (s == 0) {
+  800042:	85 db                	test   %ebx,%ebx
+  800044:	74 1a                	je     800060 <_gettoken+0x2d>
+		if (debug > 1)
+			cprintf("GETTOKEN NULL\n");
+		return 0;
+	}
+
+	if (debug > 1)
+  800046:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  80004d:	7f 31                	jg     800080 <_gettoken+0x4d>
+		cprintf("GETTOKEN: %s\n", s);
+
+	*p1 = 0;
+  80004f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+	*p2 = 0;
+  800055:	8b 45 10             	mov    0x10(%ebp),%eax
+  800058:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+
+	while (strchr(WHITESPACE, *s))
+  80005e:	eb 3a                	jmp    80009a <_gettoken+0x67>
+		return 0;
+  800060:	be 00 00 00 00       	mov    $0x0,%esi
+		if (debug > 1)
+  800065:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  80006c:	7e 59                	jle    8000c7 <_gettoken+0x94>
+			cprintf("GETTOKEN NULL\n");
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	68 80 4a 80 00       	push   $0x804a80
+  800076:	e8 e6 0a 00 00       	call   800b61 <cprintf>
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	eb 47                	jmp    8000c7 <_gettoken+0x94>
+		cprintf("GETTOKEN: %s\n", s);
+  800080:	83 ec 08             	sub    $0x8,%esp
+  800083:	53                   	push   %ebx
+  800084:	68 8f 4a 80 00       	push   $0x804a8f
+  800089:	e8 d3 0a 00 00       	call   800b61 <cprintf>
+  80008e:	83 c4 10             	add    $0x10,%esp
+  800091:	eb bc                	jmp    80004f <_gettoken+0x1c>
+		*s++ = 0;
+  800093:	83 c3 01             	add    $0x1,%ebx
+  800096:	c6 43 ff 00          	movb   $0x0,-0x1(%ebx)
+	while (strchr(WHITESPACE, *s))
+  80009a:	83 ec 08             	sub    $0x8,%esp
+  80009d:	0f be 03             	movsbl (%ebx),%eax
+  8000a0:	50                   	push   %eax
+  8000a1:	68 9d 4a 80 00       	push   $0x804a9d
+  8000a6:	e8 a6 12 00 00       	call   801351 <strchr>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	85 c0                	test   %eax,%eax
+  8000b0:	75 e1                	jne    800093 <_gettoken+0x60>
+	if (*s == 0) {
+  8000b2:	0f b6 03             	movzbl (%ebx),%eax
+  8000b5:	84 c0                	test   %al,%al
+  8000b7:	75 2a                	jne    8000e3 <_gettoken+0xb0>
+		if (debug > 1)
+			cprintf("EOL\n");
+		return 0;
+  8000b9:	be 00 00 00 00       	mov    $0x0,%esi
+		if (debug > 1)
+  8000be:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  8000c5:	7f 0a                	jg     8000d1 <_gettoken+0x9e>
+		**p2 = 0;
+		cprintf("WORD: %s\n", *p1);
+		**p2 = t;
+	}
+	return 'w';
+}
+  8000c7:	89 f0                	mov    %esi,%eax
+  8000c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000cc:	5b                   	pop    %ebx
+  8000cd:	5e                   	pop    %esi
+  8000ce:	5f                   	pop    %edi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+			cprintf("EOL\n");
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	68 a2 4a 80 00       	push   $0x804aa2
+  8000d9:	e8 83 0a 00 00       	call   800b61 <cprintf>
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	eb e4                	jmp    8000c7 <_gettoken+0x94>
+	if (strchr(SYMBOLS, *s)) {
+  8000e3:	83 ec 08             	sub    $0x8,%esp
+  8000e6:	0f be c0             	movsbl %al,%eax
+  8000e9:	50                   	push   %eax
+  8000ea:	68 b3 4a 80 00       	push   $0x804ab3
+  8000ef:	e8 5d 12 00 00       	call   801351 <strchr>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	85 c0                	test   %eax,%eax
+  8000f9:	74 2c                	je     800127 <_gettoken+0xf4>
+		t = *s;
+  8000fb:	0f be 33             	movsbl (%ebx),%esi
+		*p1 = s;
+  8000fe:	89 1f                	mov    %ebx,(%edi)
+		*s++ = 0;
+  800100:	c6 03 00             	movb   $0x0,(%ebx)
+  800103:	83 c3 01             	add    $0x1,%ebx
+  800106:	8b 45 10             	mov    0x10(%ebp),%eax
+  800109:	89 18                	mov    %ebx,(%eax)
+		if (debug > 1)
+  80010b:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  800112:	7e b3                	jle    8000c7 <_gettoken+0x94>
+			cprintf("TOK %c\n", t);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	56                   	push   %esi
+  800118:	68 a7 4a 80 00       	push   $0x804aa7
+  80011d:	e8 3f 0a 00 00       	call   800b61 <cprintf>
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	eb a0                	jmp    8000c7 <_gettoken+0x94>
+	*p1 = s;
+  800127:	89 1f                	mov    %ebx,(%edi)
+	while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  800129:	eb 03                	jmp    80012e <_gettoken+0xfb>
+		s++;
+  80012b:	83 c3 01             	add    $0x1,%ebx
+	while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  80012e:	0f b6 03             	movzbl (%ebx),%eax
+  800131:	84 c0                	test   %al,%al
+  800133:	74 18                	je     80014d <_gettoken+0x11a>
+  800135:	83 ec 08             	sub    $0x8,%esp
+  800138:	0f be c0             	movsbl %al,%eax
+  80013b:	50                   	push   %eax
+  80013c:	68 af 4a 80 00       	push   $0x804aaf
+  800141:	e8 0b 12 00 00       	call   801351 <strchr>
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	85 c0                	test   %eax,%eax
+  80014b:	74 de                	je     80012b <_gettoken+0xf8>
+	*p2 = s;
+  80014d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800150:	89 18                	mov    %ebx,(%eax)
+	return 'w';
+  800152:	be 77 00 00 00       	mov    $0x77,%esi
+	if (debug > 1) {
+  800157:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  80015e:	0f 8e 63 ff ff ff    	jle    8000c7 <_gettoken+0x94>
+		t = **p2;
+  800164:	0f b6 33             	movzbl (%ebx),%esi
+		**p2 = 0;
+  800167:	c6 03 00             	movb   $0x0,(%ebx)
+		cprintf("WORD: %s\n", *p1);
+  80016a:	83 ec 08             	sub    $0x8,%esp
+  80016d:	ff 37                	push   (%edi)
+  80016f:	68 bb 4a 80 00       	push   $0x804abb
+  800174:	e8 e8 09 00 00       	call   800b61 <cprintf>
+		**p2 = t;
+  800179:	8b 45 10             	mov    0x10(%ebp),%eax
+  80017c:	8b 00                	mov    (%eax),%eax
+  80017e:	89 f2                	mov    %esi,%edx
+  800180:	88 10                	mov    %dl,(%eax)
+  800182:	83 c4 10             	add    $0x10,%esp
+	return 'w';
+  800185:	be 77 00 00 00       	mov    $0x77,%esi
+  80018a:	e9 38 ff ff ff       	jmp    8000c7 <_gettoken+0x94>
+
+0080018f <gettoken>:
+
+int
+gettoken(char *s, char **p1)
+{
+  80018f:	55                   	push   %ebp
+  800190:	89 e5                	mov    %esp,%ebp
+  800192:	83 ec 08             	sub    $0x8,%esp
+  800195:	8b 45 08             	mov    0x8(%ebp),%eax
+	static int c, nc;
+	static char* np1, *np2;
+
+	if (s) {
+  800198:	85 c0                	test   %eax,%eax
+  80019a:	74 22                	je     8001be <gettoken+0x2f>
+		nc = _gettoken(s, &np1, &np2);
+  80019c:	83 ec 04             	sub    $0x4,%esp
+  80019f:	68 0c 70 80 00       	push   $0x80700c
+  8001a4:	68 10 70 80 00       	push   $0x807010
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 84 fe ff ff       	call   800033 <_gettoken>
+  8001af:	a3 08 70 80 00       	mov    %eax,0x807008
+		return 0;
+  8001b4:	83 c4 10             	add    $0x10,%esp
+  8001b7:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	c = nc;
+	*p1 = np1;
+	nc = _gettoken(np2, &np1, &np2);
+	return c;
+}
+  8001bc:	c9                   	leave
+  8001bd:	c3                   	ret
+	c = nc;
+  8001be:	a1 08 70 80 00       	mov    0x807008,%eax
+  8001c3:	a3 04 70 80 00       	mov    %eax,0x807004
+	*p1 = np1;
+  8001c8:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8001ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8001d1:	89 10                	mov    %edx,(%eax)
+	nc = _gettoken(np2, &np1, &np2);
+  8001d3:	83 ec 04             	sub    $0x4,%esp
+  8001d6:	68 0c 70 80 00       	push   $0x80700c
+  8001db:	68 10 70 80 00       	push   $0x807010
+  8001e0:	ff 35 0c 70 80 00    	push   0x80700c
+  8001e6:	e8 48 fe ff ff       	call   800033 <_gettoken>
+  8001eb:	a3 08 70 80 00       	mov    %eax,0x807008
+	return c;
+  8001f0:	a1 04 70 80 00       	mov    0x807004,%eax
+  8001f5:	83 c4 10             	add    $0x10,%esp
+  8001f8:	eb c2                	jmp    8001bc <gettoken+0x2d>
+
+008001fa <runcmd>:
+{
+  8001fa:	55                   	push   %ebp
+  8001fb:	89 e5                	mov    %esp,%ebp
+  8001fd:	57                   	push   %edi
+  8001fe:	56                   	push   %esi
+  8001ff:	53                   	push   %ebx
+  800200:	81 ec 74 04 00 00    	sub    $0x474,%esp
+	gettoken(s, 0);
+  800206:	6a 00                	push   $0x0
+  800208:	ff 75 08             	push   0x8(%ebp)
+  80020b:	e8 7f ff ff ff       	call   80018f <gettoken>
+  800210:	83 c4 10             	add    $0x10,%esp
+		switch ((c = gettoken(0, &t))) {
+  800213:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	argc = 0;
+  800216:	bb 00 00 00 00       	mov    $0x0,%ebx
+		switch ((c = gettoken(0, &t))) {
+  80021b:	83 ec 08             	sub    $0x8,%esp
+  80021e:	56                   	push   %esi
+  80021f:	6a 00                	push   $0x0
+  800221:	e8 69 ff ff ff       	call   80018f <gettoken>
+  800226:	89 c7                	mov    %eax,%edi
+  800228:	83 c4 10             	add    $0x10,%esp
+  80022b:	83 f8 3e             	cmp    $0x3e,%eax
+  80022e:	0f 84 3f 01 00 00    	je     800373 <runcmd+0x179>
+  800234:	7f 53                	jg     800289 <runcmd+0x8f>
+  800236:	85 c0                	test   %eax,%eax
+  800238:	0f 84 36 02 00 00    	je     800474 <runcmd+0x27a>
+  80023e:	83 f8 3c             	cmp    $0x3c,%eax
+  800241:	0f 85 09 03 00 00    	jne    800550 <runcmd+0x356>
+			if (gettoken(0, &t) != 'w') {
+  800247:	83 ec 08             	sub    $0x8,%esp
+  80024a:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  80024d:	50                   	push   %eax
+  80024e:	6a 00                	push   $0x0
+  800250:	e8 3a ff ff ff       	call   80018f <gettoken>
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	83 f8 77             	cmp    $0x77,%eax
+  80025b:	0f 85 c1 00 00 00    	jne    800322 <runcmd+0x128>
+			if ((fd = open(t, O_RDONLY)) < 0) {
+  800261:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  800264:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  80026a:	83 ec 08             	sub    $0x8,%esp
+  80026d:	6a 00                	push   $0x0
+  80026f:	50                   	push   %eax
+  800270:	e8 d4 29 00 00       	call   802c49 <open>
+  800275:	89 c7                	mov    %eax,%edi
+  800277:	83 c4 10             	add    $0x10,%esp
+  80027a:	85 c0                	test   %eax,%eax
+  80027c:	0f 88 ba 00 00 00    	js     80033c <runcmd+0x142>
+			if (fd != 0) {
+  800282:	74 97                	je     80021b <runcmd+0x21>
+  800284:	e9 cf 00 00 00       	jmp    800358 <runcmd+0x15e>
+		switch ((c = gettoken(0, &t))) {
+  800289:	83 f8 77             	cmp    $0x77,%eax
+  80028c:	74 69                	je     8002f7 <runcmd+0xfd>
+  80028e:	83 f8 7c             	cmp    $0x7c,%eax
+  800291:	0f 85 b9 02 00 00    	jne    800550 <runcmd+0x356>
+			if ((r = pipe(p)) < 0) {
+  800297:	83 ec 0c             	sub    $0xc,%esp
+  80029a:	8d 85 9c fb ff ff    	lea    -0x464(%ebp),%eax
+  8002a0:	50                   	push   %eax
+  8002a1:	e8 ff 40 00 00       	call   8043a5 <pipe>
+  8002a6:	83 c4 10             	add    $0x10,%esp
+  8002a9:	85 c0                	test   %eax,%eax
+  8002ab:	0f 88 51 01 00 00    	js     800402 <runcmd+0x208>
+			if (debug)
+  8002b1:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8002b8:	0f 85 5f 01 00 00    	jne    80041d <runcmd+0x223>
+			if ((r = fork()) < 0) {
+  8002be:	e8 e3 18 00 00       	call   801ba6 <fork>
+  8002c3:	89 c7                	mov    %eax,%edi
+  8002c5:	85 c0                	test   %eax,%eax
+  8002c7:	0f 88 71 01 00 00    	js     80043e <runcmd+0x244>
+			if (r == 0) {
+  8002cd:	0f 85 81 01 00 00    	jne    800454 <runcmd+0x25a>
+				if (p[0] != 0) {
+  8002d3:	8b 85 9c fb ff ff    	mov    -0x464(%ebp),%eax
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	0f 85 2d 02 00 00    	jne    80050e <runcmd+0x314>
+				close(p[1]);
+  8002e1:	83 ec 0c             	sub    $0xc,%esp
+  8002e4:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  8002ea:	e8 68 1d 00 00       	call   802057 <close>
+				goto again;
+  8002ef:	83 c4 10             	add    $0x10,%esp
+  8002f2:	e9 1f ff ff ff       	jmp    800216 <runcmd+0x1c>
+			if (argc == MAXARGS) {
+  8002f7:	83 fb 10             	cmp    $0x10,%ebx
+  8002fa:	74 0f                	je     80030b <runcmd+0x111>
+			argv[argc++] = t;
+  8002fc:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  8002ff:	89 44 9d a8          	mov    %eax,-0x58(%ebp,%ebx,4)
+  800303:	8d 5b 01             	lea    0x1(%ebx),%ebx
+			break;
+  800306:	e9 10 ff ff ff       	jmp    80021b <runcmd+0x21>
+				cprintf("too many arguments\n");
+  80030b:	83 ec 0c             	sub    $0xc,%esp
+  80030e:	68 c5 4a 80 00       	push   $0x804ac5
+  800313:	e8 49 08 00 00       	call   800b61 <cprintf>
+				exit();
+  800318:	e8 4f 07 00 00       	call   800a6c <exit>
+  80031d:	83 c4 10             	add    $0x10,%esp
+  800320:	eb da                	jmp    8002fc <runcmd+0x102>
+				cprintf("syntax error: < not followed by word\n");
+  800322:	83 ec 0c             	sub    $0xc,%esp
+  800325:	68 1c 4c 80 00       	push   $0x804c1c
+  80032a:	e8 32 08 00 00       	call   800b61 <cprintf>
+				exit();
+  80032f:	e8 38 07 00 00       	call   800a6c <exit>
+  800334:	83 c4 10             	add    $0x10,%esp
+  800337:	e9 25 ff ff ff       	jmp    800261 <runcmd+0x67>
+				cprintf("Can't open file: %s, %e\n", t, fd);
+  80033c:	83 ec 04             	sub    $0x4,%esp
+  80033f:	50                   	push   %eax
+  800340:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  800346:	68 d9 4a 80 00       	push   $0x804ad9
+  80034b:	e8 11 08 00 00       	call   800b61 <cprintf>
+				exit();
+  800350:	e8 17 07 00 00       	call   800a6c <exit>
+  800355:	83 c4 10             	add    $0x10,%esp
+				dup(fd, 0);
+  800358:	83 ec 08             	sub    $0x8,%esp
+  80035b:	6a 00                	push   $0x0
+  80035d:	57                   	push   %edi
+  80035e:	e8 46 1d 00 00       	call   8020a9 <dup>
+				close(fd);
+  800363:	89 3c 24             	mov    %edi,(%esp)
+  800366:	e8 ec 1c 00 00       	call   802057 <close>
+  80036b:	83 c4 10             	add    $0x10,%esp
+  80036e:	e9 a8 fe ff ff       	jmp    80021b <runcmd+0x21>
+			if (gettoken(0, &t) != 'w') {
+  800373:	83 ec 08             	sub    $0x8,%esp
+  800376:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  800379:	50                   	push   %eax
+  80037a:	6a 00                	push   $0x0
+  80037c:	e8 0e fe ff ff       	call   80018f <gettoken>
+  800381:	83 c4 10             	add    $0x10,%esp
+  800384:	83 f8 77             	cmp    $0x77,%eax
+  800387:	75 2b                	jne    8003b4 <runcmd+0x1ba>
+			if ((fd = open(t, O_WRONLY|O_CREAT|O_TRUNC)) < 0) {
+  800389:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  80038c:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  800392:	83 ec 08             	sub    $0x8,%esp
+  800395:	68 01 03 00 00       	push   $0x301
+  80039a:	50                   	push   %eax
+  80039b:	e8 a9 28 00 00       	call   802c49 <open>
+  8003a0:	89 c7                	mov    %eax,%edi
+  8003a2:	83 c4 10             	add    $0x10,%esp
+  8003a5:	85 c0                	test   %eax,%eax
+  8003a7:	78 22                	js     8003cb <runcmd+0x1d1>
+			if (fd != 1) {
+  8003a9:	83 f8 01             	cmp    $0x1,%eax
+  8003ac:	0f 84 69 fe ff ff    	je     80021b <runcmd+0x21>
+  8003b2:	eb 33                	jmp    8003e7 <runcmd+0x1ed>
+				cprintf("syntax error: > not followed by word\n");
+  8003b4:	83 ec 0c             	sub    $0xc,%esp
+  8003b7:	68 44 4c 80 00       	push   $0x804c44
+  8003bc:	e8 a0 07 00 00       	call   800b61 <cprintf>
+				exit();
+  8003c1:	e8 a6 06 00 00       	call   800a6c <exit>
+  8003c6:	83 c4 10             	add    $0x10,%esp
+  8003c9:	eb be                	jmp    800389 <runcmd+0x18f>
+				cprintf("open %s for write: %e", t, fd);
+  8003cb:	83 ec 04             	sub    $0x4,%esp
+  8003ce:	50                   	push   %eax
+  8003cf:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  8003d5:	68 f2 4a 80 00       	push   $0x804af2
+  8003da:	e8 82 07 00 00       	call   800b61 <cprintf>
+				exit();
+  8003df:	e8 88 06 00 00       	call   800a6c <exit>
+  8003e4:	83 c4 10             	add    $0x10,%esp
+				dup(fd, 1);
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	6a 01                	push   $0x1
+  8003ec:	57                   	push   %edi
+  8003ed:	e8 b7 1c 00 00       	call   8020a9 <dup>
+				close(fd);
+  8003f2:	89 3c 24             	mov    %edi,(%esp)
+  8003f5:	e8 5d 1c 00 00       	call   802057 <close>
+  8003fa:	83 c4 10             	add    $0x10,%esp
+  8003fd:	e9 19 fe ff ff       	jmp    80021b <runcmd+0x21>
+				cprintf("pipe: %e", r);
+  800402:	83 ec 08             	sub    $0x8,%esp
+  800405:	50                   	push   %eax
+  800406:	68 08 4b 80 00       	push   $0x804b08
+  80040b:	e8 51 07 00 00       	call   800b61 <cprintf>
+				exit();
+  800410:	e8 57 06 00 00       	call   800a6c <exit>
+  800415:	83 c4 10             	add    $0x10,%esp
+  800418:	e9 94 fe ff ff       	jmp    8002b1 <runcmd+0xb7>
+				cprintf("PIPE: %d %d\n", p[0], p[1]);
+  80041d:	83 ec 04             	sub    $0x4,%esp
+  800420:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  800426:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  80042c:	68 11 4b 80 00       	push   $0x804b11
+  800431:	e8 2b 07 00 00       	call   800b61 <cprintf>
+  800436:	83 c4 10             	add    $0x10,%esp
+  800439:	e9 80 fe ff ff       	jmp    8002be <runcmd+0xc4>
+				cprintf("fork: %e", r);
+  80043e:	83 ec 08             	sub    $0x8,%esp
+  800441:	50                   	push   %eax
+  800442:	68 1e 4b 80 00       	push   $0x804b1e
+  800447:	e8 15 07 00 00       	call   800b61 <cprintf>
+				exit();
+  80044c:	e8 1b 06 00 00       	call   800a6c <exit>
+  800451:	83 c4 10             	add    $0x10,%esp
+				if (p[1] != 1) {
+  800454:	8b 85 a0 fb ff ff    	mov    -0x460(%ebp),%eax
+  80045a:	83 f8 01             	cmp    $0x1,%eax
+  80045d:	0f 85 cc 00 00 00    	jne    80052f <runcmd+0x335>
+				close(p[0]);
+  800463:	83 ec 0c             	sub    $0xc,%esp
+  800466:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  80046c:	e8 e6 1b 00 00       	call   802057 <close>
+				goto runit;
+  800471:	83 c4 10             	add    $0x10,%esp
+	if(argc == 0) {
+  800474:	85 db                	test   %ebx,%ebx
+  800476:	0f 84 e6 00 00 00    	je     800562 <runcmd+0x368>
+	if (argv[0][0] != '/') {
+  80047c:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  80047f:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800482:	0f 85 f5 00 00 00    	jne    80057d <runcmd+0x383>
+	argv[argc] = 0;
+  800488:	c7 44 9d a8 00 00 00 	movl   $0x0,-0x58(%ebp,%ebx,4)
+  80048f:	00 
+	if (debug) {
+  800490:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800497:	0f 85 08 01 00 00    	jne    8005a5 <runcmd+0x3ab>
+	if ((r = spawn(argv[0], (const char**) argv)) < 0)
+  80049d:	83 ec 08             	sub    $0x8,%esp
+  8004a0:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  8004a3:	50                   	push   %eax
+  8004a4:	ff 75 a8             	push   -0x58(%ebp)
+  8004a7:	e8 ad 31 00 00       	call   803659 <spawn>
+  8004ac:	89 c3                	mov    %eax,%ebx
+  8004ae:	83 c4 10             	add    $0x10,%esp
+  8004b1:	85 c0                	test   %eax,%eax
+  8004b3:	0f 88 3a 01 00 00    	js     8005f3 <runcmd+0x3f9>
+	close_all();
+  8004b9:	e8 c6 1b 00 00       	call   802084 <close_all>
+		if (debug)
+  8004be:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8004c5:	0f 85 75 01 00 00    	jne    800640 <runcmd+0x446>
+		wait(r);
+  8004cb:	83 ec 0c             	sub    $0xc,%esp
+  8004ce:	53                   	push   %ebx
+  8004cf:	e8 4e 40 00 00       	call   804522 <wait>
+		if (debug)
+  8004d4:	83 c4 10             	add    $0x10,%esp
+  8004d7:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8004de:	0f 85 7b 01 00 00    	jne    80065f <runcmd+0x465>
+	if (pipe_child) {
+  8004e4:	85 ff                	test   %edi,%edi
+  8004e6:	74 19                	je     800501 <runcmd+0x307>
+		wait(pipe_child);
+  8004e8:	83 ec 0c             	sub    $0xc,%esp
+  8004eb:	57                   	push   %edi
+  8004ec:	e8 31 40 00 00       	call   804522 <wait>
+		if (debug)
+  8004f1:	83 c4 10             	add    $0x10,%esp
+  8004f4:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8004fb:	0f 85 79 01 00 00    	jne    80067a <runcmd+0x480>
+	exit();
+  800501:	e8 66 05 00 00       	call   800a6c <exit>
+}
+  800506:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800509:	5b                   	pop    %ebx
+  80050a:	5e                   	pop    %esi
+  80050b:	5f                   	pop    %edi
+  80050c:	5d                   	pop    %ebp
+  80050d:	c3                   	ret
+					dup(p[0], 0);
+  80050e:	83 ec 08             	sub    $0x8,%esp
+  800511:	6a 00                	push   $0x0
+  800513:	50                   	push   %eax
+  800514:	e8 90 1b 00 00       	call   8020a9 <dup>
+					close(p[0]);
+  800519:	83 c4 04             	add    $0x4,%esp
+  80051c:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  800522:	e8 30 1b 00 00       	call   802057 <close>
+  800527:	83 c4 10             	add    $0x10,%esp
+  80052a:	e9 b2 fd ff ff       	jmp    8002e1 <runcmd+0xe7>
+					dup(p[1], 1);
+  80052f:	83 ec 08             	sub    $0x8,%esp
+  800532:	6a 01                	push   $0x1
+  800534:	50                   	push   %eax
+  800535:	e8 6f 1b 00 00       	call   8020a9 <dup>
+					close(p[1]);
+  80053a:	83 c4 04             	add    $0x4,%esp
+  80053d:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  800543:	e8 0f 1b 00 00       	call   802057 <close>
+  800548:	83 c4 10             	add    $0x10,%esp
+  80054b:	e9 13 ff ff ff       	jmp    800463 <runcmd+0x269>
+			panic("bad return %d from gettoken", c);
+  800550:	57                   	push   %edi
+  800551:	68 27 4b 80 00       	push   $0x804b27
+  800556:	6a 77                	push   $0x77
+  800558:	68 43 4b 80 00       	push   $0x804b43
+  80055d:	e8 24 05 00 00       	call   800a86 <_panic>
+		if (debug)
+  800562:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800569:	74 9b                	je     800506 <runcmd+0x30c>
+			cprintf("EMPTY COMMAND\n");
+  80056b:	83 ec 0c             	sub    $0xc,%esp
+  80056e:	68 4d 4b 80 00       	push   $0x804b4d
+  800573:	e8 e9 05 00 00       	call   800b61 <cprintf>
+  800578:	83 c4 10             	add    $0x10,%esp
+		return;
+  80057b:	eb 89                	jmp    800506 <runcmd+0x30c>
+		argv0buf[0] = '/';
+  80057d:	c6 85 a4 fb ff ff 2f 	movb   $0x2f,-0x45c(%ebp)
+		strcpy(argv0buf + 1, argv[0]);
+  800584:	83 ec 08             	sub    $0x8,%esp
+  800587:	50                   	push   %eax
+  800588:	8d b5 a4 fb ff ff    	lea    -0x45c(%ebp),%esi
+  80058e:	8d 85 a5 fb ff ff    	lea    -0x45b(%ebp),%eax
+  800594:	50                   	push   %eax
+  800595:	e8 a5 0c 00 00       	call   80123f <strcpy>
+		argv[0] = argv0buf;
+  80059a:	89 75 a8             	mov    %esi,-0x58(%ebp)
+  80059d:	83 c4 10             	add    $0x10,%esp
+  8005a0:	e9 e3 fe ff ff       	jmp    800488 <runcmd+0x28e>
+		cprintf("[%08x] SPAWN:", thisenv->env_id);
+  8005a5:	a1 14 70 80 00       	mov    0x807014,%eax
+  8005aa:	8b 40 48             	mov    0x48(%eax),%eax
+  8005ad:	83 ec 08             	sub    $0x8,%esp
+  8005b0:	50                   	push   %eax
+  8005b1:	68 5c 4b 80 00       	push   $0x804b5c
+  8005b6:	e8 a6 05 00 00       	call   800b61 <cprintf>
+		for (i = 0; argv[i]; i++)
+  8005bb:	8d 5d a8             	lea    -0x58(%ebp),%ebx
+  8005be:	83 c4 10             	add    $0x10,%esp
+  8005c1:	eb 11                	jmp    8005d4 <runcmd+0x3da>
+			cprintf(" %s", argv[i]);
+  8005c3:	83 ec 08             	sub    $0x8,%esp
+  8005c6:	50                   	push   %eax
+  8005c7:	68 e4 4b 80 00       	push   $0x804be4
+  8005cc:	e8 90 05 00 00       	call   800b61 <cprintf>
+  8005d1:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; argv[i]; i++)
+  8005d4:	83 c3 04             	add    $0x4,%ebx
+  8005d7:	8b 43 fc             	mov    -0x4(%ebx),%eax
+  8005da:	85 c0                	test   %eax,%eax
+  8005dc:	75 e5                	jne    8005c3 <runcmd+0x3c9>
+		cprintf("\n");
+  8005de:	83 ec 0c             	sub    $0xc,%esp
+  8005e1:	68 a0 4a 80 00       	push   $0x804aa0
+  8005e6:	e8 76 05 00 00       	call   800b61 <cprintf>
+  8005eb:	83 c4 10             	add    $0x10,%esp
+  8005ee:	e9 aa fe ff ff       	jmp    80049d <runcmd+0x2a3>
+		cprintf("spawn %s: %e\n", argv[0], r);
+  8005f3:	83 ec 04             	sub    $0x4,%esp
+  8005f6:	50                   	push   %eax
+  8005f7:	ff 75 a8             	push   -0x58(%ebp)
+  8005fa:	68 6a 4b 80 00       	push   $0x804b6a
+  8005ff:	e8 5d 05 00 00       	call   800b61 <cprintf>
+	close_all();
+  800604:	e8 7b 1a 00 00       	call   802084 <close_all>
+	if (r >= 0) {
+  800609:	83 c4 10             	add    $0x10,%esp
+	if (pipe_child) {
+  80060c:	85 ff                	test   %edi,%edi
+  80060e:	0f 84 ed fe ff ff    	je     800501 <runcmd+0x307>
+		if (debug)
+  800614:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80061b:	0f 84 c7 fe ff ff    	je     8004e8 <runcmd+0x2ee>
+			cprintf("[%08x] WAIT pipe_child %08x\n", thisenv->env_id, pipe_child);
+  800621:	a1 14 70 80 00       	mov    0x807014,%eax
+  800626:	8b 40 48             	mov    0x48(%eax),%eax
+  800629:	83 ec 04             	sub    $0x4,%esp
+  80062c:	57                   	push   %edi
+  80062d:	50                   	push   %eax
+  80062e:	68 a3 4b 80 00       	push   $0x804ba3
+  800633:	e8 29 05 00 00       	call   800b61 <cprintf>
+  800638:	83 c4 10             	add    $0x10,%esp
+  80063b:	e9 a8 fe ff ff       	jmp    8004e8 <runcmd+0x2ee>
+			cprintf("[%08x] WAIT %s %08x\n", thisenv->env_id, argv[0], r);
+  800640:	a1 14 70 80 00       	mov    0x807014,%eax
+  800645:	8b 40 48             	mov    0x48(%eax),%eax
+  800648:	53                   	push   %ebx
+  800649:	ff 75 a8             	push   -0x58(%ebp)
+  80064c:	50                   	push   %eax
+  80064d:	68 78 4b 80 00       	push   $0x804b78
+  800652:	e8 0a 05 00 00       	call   800b61 <cprintf>
+  800657:	83 c4 10             	add    $0x10,%esp
+  80065a:	e9 6c fe ff ff       	jmp    8004cb <runcmd+0x2d1>
+			cprintf("[%08x] wait finished\n", thisenv->env_id);
+  80065f:	a1 14 70 80 00       	mov    0x807014,%eax
+  800664:	8b 40 48             	mov    0x48(%eax),%eax
+  800667:	83 ec 08             	sub    $0x8,%esp
+  80066a:	50                   	push   %eax
+  80066b:	68 8d 4b 80 00       	push   $0x804b8d
+  800670:	e8 ec 04 00 00       	call   800b61 <cprintf>
+  800675:	83 c4 10             	add    $0x10,%esp
+  800678:	eb 92                	jmp    80060c <runcmd+0x412>
+			cprintf("[%08x] wait finished\n", thisenv->env_id);
+  80067a:	a1 14 70 80 00       	mov    0x807014,%eax
+  80067f:	8b 40 48             	mov    0x48(%eax),%eax
+  800682:	83 ec 08             	sub    $0x8,%esp
+  800685:	50                   	push   %eax
+  800686:	68 8d 4b 80 00       	push   $0x804b8d
+  80068b:	e8 d1 04 00 00       	call   800b61 <cprintf>
+  800690:	83 c4 10             	add    $0x10,%esp
+  800693:	e9 69 fe ff ff       	jmp    800501 <runcmd+0x307>
+
+00800698 <usage>:
+
+
+void
+usage(void)
+{
+  800698:	55                   	push   %ebp
+  800699:	89 e5                	mov    %esp,%ebp
+  80069b:	83 ec 14             	sub    $0x14,%esp
+	cprintf("usage: sh [-dix] [command-file]\n");
+  80069e:	68 6c 4c 80 00       	push   $0x804c6c
+  8006a3:	e8 b9 04 00 00       	call   800b61 <cprintf>
+	exit();
+  8006a8:	e8 bf 03 00 00       	call   800a6c <exit>
+}
+  8006ad:	83 c4 10             	add    $0x10,%esp
+  8006b0:	c9                   	leave
+  8006b1:	c3                   	ret
+
+008006b2 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8006b2:	55                   	push   %ebp
+  8006b3:	89 e5                	mov    %esp,%ebp
+  8006b5:	57                   	push   %edi
+  8006b6:	56                   	push   %esi
+  8006b7:	53                   	push   %ebx
+  8006b8:	83 ec 30             	sub    $0x30,%esp
+	int r, interactive, echocmds;
+	struct Argstate args;
+
+	interactive = '?';
+	echocmds = 0;
+	argstart(&argc, argv, &args);
+  8006bb:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  8006be:	50                   	push   %eax
+  8006bf:	ff 75 0c             	push   0xc(%ebp)
+  8006c2:	8d 45 08             	lea    0x8(%ebp),%eax
+  8006c5:	50                   	push   %eax
+  8006c6:	e8 96 16 00 00       	call   801d61 <argstart>
+	while ((r = argnext(&args)) >= 0)
+  8006cb:	83 c4 10             	add    $0x10,%esp
+	echocmds = 0;
+  8006ce:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+	interactive = '?';
+  8006d5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+	while ((r = argnext(&args)) >= 0)
+  8006da:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+		switch (r) {
+		case 'd':
+			debug++;
+			break;
+		case 'i':
+			interactive = 1;
+  8006dd:	be 01 00 00 00       	mov    $0x1,%esi
+	while ((r = argnext(&args)) >= 0)
+  8006e2:	eb 10                	jmp    8006f4 <umain+0x42>
+			debug++;
+  8006e4:	83 05 00 70 80 00 01 	addl   $0x1,0x807000
+			break;
+  8006eb:	eb 07                	jmp    8006f4 <umain+0x42>
+			interactive = 1;
+  8006ed:	89 f7                	mov    %esi,%edi
+  8006ef:	eb 03                	jmp    8006f4 <umain+0x42>
+		switch (r) {
+  8006f1:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+	while ((r = argnext(&args)) >= 0)
+  8006f4:	83 ec 0c             	sub    $0xc,%esp
+  8006f7:	53                   	push   %ebx
+  8006f8:	e8 94 16 00 00       	call   801d91 <argnext>
+  8006fd:	83 c4 10             	add    $0x10,%esp
+  800700:	85 c0                	test   %eax,%eax
+  800702:	78 16                	js     80071a <umain+0x68>
+		switch (r) {
+  800704:	83 f8 69             	cmp    $0x69,%eax
+  800707:	74 e4                	je     8006ed <umain+0x3b>
+  800709:	83 f8 78             	cmp    $0x78,%eax
+  80070c:	74 e3                	je     8006f1 <umain+0x3f>
+  80070e:	83 f8 64             	cmp    $0x64,%eax
+  800711:	74 d1                	je     8006e4 <umain+0x32>
+			break;
+		case 'x':
+			echocmds = 1;
+			break;
+		default:
+			usage();
+  800713:	e8 80 ff ff ff       	call   800698 <usage>
+  800718:	eb da                	jmp    8006f4 <umain+0x42>
+		}
+
+	if (argc > 2)
+  80071a:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  80071e:	7f 1f                	jg     80073f <umain+0x8d>
+		usage();
+	if (argc == 2) {
+  800720:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  800724:	74 20                	je     800746 <umain+0x94>
+		close(0);
+		if ((r = open(argv[1], O_RDONLY)) < 0)
+			panic("open %s: %e", argv[1], r);
+		assert(r == 0);
+	}
+	if (interactive == '?')
+  800726:	83 ff 3f             	cmp    $0x3f,%edi
+  800729:	74 75                	je     8007a0 <umain+0xee>
+  80072b:	85 ff                	test   %edi,%edi
+  80072d:	bf e8 4b 80 00       	mov    $0x804be8,%edi
+  800732:	b8 00 00 00 00       	mov    $0x0,%eax
+  800737:	0f 44 f8             	cmove  %eax,%edi
+  80073a:	e9 06 01 00 00       	jmp    800845 <umain+0x193>
+		usage();
+  80073f:	e8 54 ff ff ff       	call   800698 <usage>
+  800744:	eb da                	jmp    800720 <umain+0x6e>
+		close(0);
+  800746:	83 ec 0c             	sub    $0xc,%esp
+  800749:	6a 00                	push   $0x0
+  80074b:	e8 07 19 00 00       	call   802057 <close>
+		if ((r = open(argv[1], O_RDONLY)) < 0)
+  800750:	83 c4 08             	add    $0x8,%esp
+  800753:	6a 00                	push   $0x0
+  800755:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800758:	ff 70 04             	push   0x4(%eax)
+  80075b:	e8 e9 24 00 00       	call   802c49 <open>
+  800760:	83 c4 10             	add    $0x10,%esp
+  800763:	85 c0                	test   %eax,%eax
+  800765:	78 1b                	js     800782 <umain+0xd0>
+		assert(r == 0);
+  800767:	74 bd                	je     800726 <umain+0x74>
+  800769:	68 cc 4b 80 00       	push   $0x804bcc
+  80076e:	68 d3 4b 80 00       	push   $0x804bd3
+  800773:	68 28 01 00 00       	push   $0x128
+  800778:	68 43 4b 80 00       	push   $0x804b43
+  80077d:	e8 04 03 00 00       	call   800a86 <_panic>
+			panic("open %s: %e", argv[1], r);
+  800782:	83 ec 0c             	sub    $0xc,%esp
+  800785:	50                   	push   %eax
+  800786:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800789:	ff 70 04             	push   0x4(%eax)
+  80078c:	68 c0 4b 80 00       	push   $0x804bc0
+  800791:	68 27 01 00 00       	push   $0x127
+  800796:	68 43 4b 80 00       	push   $0x804b43
+  80079b:	e8 e6 02 00 00       	call   800a86 <_panic>
+		interactive = iscons(0);
+  8007a0:	83 ec 0c             	sub    $0xc,%esp
+  8007a3:	6a 00                	push   $0x0
+  8007a5:	e8 fb 01 00 00       	call   8009a5 <iscons>
+  8007aa:	89 c7                	mov    %eax,%edi
+  8007ac:	83 c4 10             	add    $0x10,%esp
+  8007af:	e9 77 ff ff ff       	jmp    80072b <umain+0x79>
+	while (1) {
+		char *buf;
+
+		buf = readline(interactive ? "$ " : NULL);
+		if (buf == NULL) {
+			if (debug)
+  8007b4:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8007bb:	75 0a                	jne    8007c7 <umain+0x115>
+				cprintf("EXITING\n");
+			exit();	// end of file
+  8007bd:	e8 aa 02 00 00       	call   800a6c <exit>
+  8007c2:	e9 94 00 00 00       	jmp    80085b <umain+0x1a9>
+				cprintf("EXITING\n");
+  8007c7:	83 ec 0c             	sub    $0xc,%esp
+  8007ca:	68 eb 4b 80 00       	push   $0x804beb
+  8007cf:	e8 8d 03 00 00       	call   800b61 <cprintf>
+  8007d4:	83 c4 10             	add    $0x10,%esp
+  8007d7:	eb e4                	jmp    8007bd <umain+0x10b>
+		}
+		if (debug)
+			cprintf("LINE: %s\n", buf);
+  8007d9:	83 ec 08             	sub    $0x8,%esp
+  8007dc:	53                   	push   %ebx
+  8007dd:	68 f4 4b 80 00       	push   $0x804bf4
+  8007e2:	e8 7a 03 00 00       	call   800b61 <cprintf>
+  8007e7:	83 c4 10             	add    $0x10,%esp
+  8007ea:	eb 7c                	jmp    800868 <umain+0x1b6>
+		if (buf[0] == '#')
+			continue;
+		if (echocmds)
+			printf("# %s\n", buf);
+  8007ec:	83 ec 08             	sub    $0x8,%esp
+  8007ef:	53                   	push   %ebx
+  8007f0:	68 fe 4b 80 00       	push   $0x804bfe
+  8007f5:	e8 49 2e 00 00       	call   803643 <printf>
+  8007fa:	83 c4 10             	add    $0x10,%esp
+  8007fd:	eb 78                	jmp    800877 <umain+0x1c5>
+		if (debug)
+			cprintf("BEFORE FORK\n");
+  8007ff:	83 ec 0c             	sub    $0xc,%esp
+  800802:	68 04 4c 80 00       	push   $0x804c04
+  800807:	e8 55 03 00 00       	call   800b61 <cprintf>
+  80080c:	83 c4 10             	add    $0x10,%esp
+  80080f:	eb 73                	jmp    800884 <umain+0x1d2>
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+  800811:	50                   	push   %eax
+  800812:	68 1e 4b 80 00       	push   $0x804b1e
+  800817:	68 3f 01 00 00       	push   $0x13f
+  80081c:	68 43 4b 80 00       	push   $0x804b43
+  800821:	e8 60 02 00 00       	call   800a86 <_panic>
+		if (debug)
+			cprintf("FORK: %d\n", r);
+  800826:	83 ec 08             	sub    $0x8,%esp
+  800829:	50                   	push   %eax
+  80082a:	68 11 4c 80 00       	push   $0x804c11
+  80082f:	e8 2d 03 00 00       	call   800b61 <cprintf>
+  800834:	83 c4 10             	add    $0x10,%esp
+  800837:	eb 5f                	jmp    800898 <umain+0x1e6>
+		if (r == 0) {
+			runcmd(buf);
+			exit();
+		} else
+			wait(r);
+  800839:	83 ec 0c             	sub    $0xc,%esp
+  80083c:	56                   	push   %esi
+  80083d:	e8 e0 3c 00 00       	call   804522 <wait>
+  800842:	83 c4 10             	add    $0x10,%esp
+		buf = readline(interactive ? "$ " : NULL);
+  800845:	83 ec 0c             	sub    $0xc,%esp
+  800848:	57                   	push   %edi
+  800849:	e8 c6 08 00 00       	call   801114 <readline>
+  80084e:	89 c3                	mov    %eax,%ebx
+		if (buf == NULL) {
+  800850:	83 c4 10             	add    $0x10,%esp
+  800853:	85 c0                	test   %eax,%eax
+  800855:	0f 84 59 ff ff ff    	je     8007b4 <umain+0x102>
+		if (debug)
+  80085b:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800862:	0f 85 71 ff ff ff    	jne    8007d9 <umain+0x127>
+		if (buf[0] == '#')
+  800868:	80 3b 23             	cmpb   $0x23,(%ebx)
+  80086b:	74 d8                	je     800845 <umain+0x193>
+		if (echocmds)
+  80086d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  800871:	0f 85 75 ff ff ff    	jne    8007ec <umain+0x13a>
+		if (debug)
+  800877:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80087e:	0f 85 7b ff ff ff    	jne    8007ff <umain+0x14d>
+		if ((r = fork()) < 0)
+  800884:	e8 1d 13 00 00       	call   801ba6 <fork>
+  800889:	89 c6                	mov    %eax,%esi
+  80088b:	85 c0                	test   %eax,%eax
+  80088d:	78 82                	js     800811 <umain+0x15f>
+		if (debug)
+  80088f:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800896:	75 8e                	jne    800826 <umain+0x174>
+		if (r == 0) {
+  800898:	85 f6                	test   %esi,%esi
+  80089a:	75 9d                	jne    800839 <umain+0x187>
+			runcmd(buf);
+  80089c:	83 ec 0c             	sub    $0xc,%esp
+  80089f:	53                   	push   %ebx
+  8008a0:	e8 55 f9 ff ff       	call   8001fa <runcmd>
+			exit();
+  8008a5:	e8 c2 01 00 00       	call   800a6c <exit>
+  8008aa:	83 c4 10             	add    $0x10,%esp
+  8008ad:	eb 96                	jmp    800845 <umain+0x193>
+
+008008af <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8008af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b4:	c3                   	ret
+
+008008b5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8008b5:	55                   	push   %ebp
+  8008b6:	89 e5                	mov    %esp,%ebp
+  8008b8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8008bb:	68 8d 4c 80 00       	push   $0x804c8d
+  8008c0:	ff 75 0c             	push   0xc(%ebp)
+  8008c3:	e8 77 09 00 00       	call   80123f <strcpy>
+	return 0;
+}
+  8008c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cd:	c9                   	leave
+  8008ce:	c3                   	ret
+
+008008cf <devcons_write>:
+{
+  8008cf:	55                   	push   %ebp
+  8008d0:	89 e5                	mov    %esp,%ebp
+  8008d2:	57                   	push   %edi
+  8008d3:	56                   	push   %esi
+  8008d4:	53                   	push   %ebx
+  8008d5:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8008db:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8008e0:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8008e6:	eb 2e                	jmp    800916 <devcons_write+0x47>
+		m = n - tot;
+  8008e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008eb:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8008ed:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8008f2:	39 c3                	cmp    %eax,%ebx
+  8008f4:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8008f7:	83 ec 04             	sub    $0x4,%esp
+  8008fa:	53                   	push   %ebx
+  8008fb:	89 f0                	mov    %esi,%eax
+  8008fd:	03 45 0c             	add    0xc(%ebp),%eax
+  800900:	50                   	push   %eax
+  800901:	57                   	push   %edi
+  800902:	e8 be 0a 00 00       	call   8013c5 <memmove>
+		sys_cputs(buf, m);
+  800907:	83 c4 08             	add    $0x8,%esp
+  80090a:	53                   	push   %ebx
+  80090b:	57                   	push   %edi
+  80090c:	e8 5e 0c 00 00       	call   80156f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800911:	01 de                	add    %ebx,%esi
+  800913:	83 c4 10             	add    $0x10,%esp
+  800916:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800919:	72 cd                	jb     8008e8 <devcons_write+0x19>
+}
+  80091b:	89 f0                	mov    %esi,%eax
+  80091d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800920:	5b                   	pop    %ebx
+  800921:	5e                   	pop    %esi
+  800922:	5f                   	pop    %edi
+  800923:	5d                   	pop    %ebp
+  800924:	c3                   	ret
+
+00800925 <devcons_read>:
+{
+  800925:	55                   	push   %ebp
+  800926:	89 e5                	mov    %esp,%ebp
+  800928:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80092b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800930:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800934:	75 07                	jne    80093d <devcons_read+0x18>
+  800936:	eb 1f                	jmp    800957 <devcons_read+0x32>
+		sys_yield();
+  800938:	e8 ef 0c 00 00       	call   80162c <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80093d:	e8 53 0c 00 00       	call   801595 <sys_cgetc>
+  800942:	85 c0                	test   %eax,%eax
+  800944:	74 f2                	je     800938 <devcons_read+0x13>
+	if (c < 0)
+  800946:	78 0f                	js     800957 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  800948:	83 f8 04             	cmp    $0x4,%eax
+  80094b:	74 0c                	je     800959 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80094d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800950:	88 02                	mov    %al,(%edx)
+	return 1;
+  800952:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  800957:	c9                   	leave
+  800958:	c3                   	ret
+		return 0;
+  800959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095e:	eb f7                	jmp    800957 <devcons_read+0x32>
+
+00800960 <cputchar>:
+{
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  800966:	8b 45 08             	mov    0x8(%ebp),%eax
+  800969:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80096c:	6a 01                	push   $0x1
+  80096e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800971:	50                   	push   %eax
+  800972:	e8 f8 0b 00 00       	call   80156f <sys_cputs>
+}
+  800977:	83 c4 10             	add    $0x10,%esp
+  80097a:	c9                   	leave
+  80097b:	c3                   	ret
+
+0080097c <getchar>:
+{
+  80097c:	55                   	push   %ebp
+  80097d:	89 e5                	mov    %esp,%ebp
+  80097f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  800982:	6a 01                	push   $0x1
+  800984:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800987:	50                   	push   %eax
+  800988:	6a 00                	push   $0x0
+  80098a:	e8 04 18 00 00       	call   802193 <read>
+	if (r < 0)
+  80098f:	83 c4 10             	add    $0x10,%esp
+  800992:	85 c0                	test   %eax,%eax
+  800994:	78 06                	js     80099c <getchar+0x20>
+	if (r < 1)
+  800996:	74 06                	je     80099e <getchar+0x22>
+	return c;
+  800998:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80099c:	c9                   	leave
+  80099d:	c3                   	ret
+		return -E_EOF;
+  80099e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8009a3:	eb f7                	jmp    80099c <getchar+0x20>
+
+008009a5 <iscons>:
+{
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8009ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009ae:	50                   	push   %eax
+  8009af:	ff 75 08             	push   0x8(%ebp)
+  8009b2:	e8 76 15 00 00       	call   801f2d <fd_lookup>
+  8009b7:	83 c4 10             	add    $0x10,%esp
+  8009ba:	85 c0                	test   %eax,%eax
+  8009bc:	78 11                	js     8009cf <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8009be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009c1:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8009c7:	39 10                	cmp    %edx,(%eax)
+  8009c9:	0f 94 c0             	sete   %al
+  8009cc:	0f b6 c0             	movzbl %al,%eax
+}
+  8009cf:	c9                   	leave
+  8009d0:	c3                   	ret
+
+008009d1 <opencons>:
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8009d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009da:	50                   	push   %eax
+  8009db:	e8 f7 14 00 00       	call   801ed7 <fd_alloc>
+  8009e0:	83 c4 10             	add    $0x10,%esp
+  8009e3:	85 c0                	test   %eax,%eax
+  8009e5:	78 3a                	js     800a21 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8009e7:	83 ec 04             	sub    $0x4,%esp
+  8009ea:	68 07 04 00 00       	push   $0x407
+  8009ef:	ff 75 f4             	push   -0xc(%ebp)
+  8009f2:	6a 00                	push   $0x0
+  8009f4:	e8 52 0c 00 00       	call   80164b <sys_page_alloc>
+  8009f9:	83 c4 10             	add    $0x10,%esp
+  8009fc:	85 c0                	test   %eax,%eax
+  8009fe:	78 21                	js     800a21 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800a00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a03:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  800a09:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800a0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a0e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800a15:	83 ec 0c             	sub    $0xc,%esp
+  800a18:	50                   	push   %eax
+  800a19:	e8 92 14 00 00       	call   801eb0 <fd2num>
+  800a1e:	83 c4 10             	add    $0x10,%esp
+}
+  800a21:	c9                   	leave
+  800a22:	c3                   	ret
+
+00800a23 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800a23:	55                   	push   %ebp
+  800a24:	89 e5                	mov    %esp,%ebp
+  800a26:	56                   	push   %esi
+  800a27:	53                   	push   %ebx
+  800a28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800a2b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800a2e:	e8 d2 0b 00 00       	call   801605 <sys_getenvid>
+  800a33:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800a38:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800a3e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800a43:	a3 14 70 80 00       	mov    %eax,0x807014
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800a48:	85 db                	test   %ebx,%ebx
+  800a4a:	7e 07                	jle    800a53 <libmain+0x30>
+		binaryname = argv[0];
+  800a4c:	8b 06                	mov    (%esi),%eax
+  800a4e:	a3 20 60 80 00       	mov    %eax,0x806020
+
+	// call user main routine
+	umain(argc, argv);
+  800a53:	83 ec 08             	sub    $0x8,%esp
+  800a56:	56                   	push   %esi
+  800a57:	53                   	push   %ebx
+  800a58:	e8 55 fc ff ff       	call   8006b2 <umain>
+
+	// exit gracefully
+	exit();
+  800a5d:	e8 0a 00 00 00       	call   800a6c <exit>
+}
+  800a62:	83 c4 10             	add    $0x10,%esp
+  800a65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a68:	5b                   	pop    %ebx
+  800a69:	5e                   	pop    %esi
+  800a6a:	5d                   	pop    %ebp
+  800a6b:	c3                   	ret
+
+00800a6c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800a6c:	55                   	push   %ebp
+  800a6d:	89 e5                	mov    %esp,%ebp
+  800a6f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800a72:	e8 0d 16 00 00       	call   802084 <close_all>
+	sys_env_destroy(0);
+  800a77:	83 ec 0c             	sub    $0xc,%esp
+  800a7a:	6a 00                	push   $0x0
+  800a7c:	e8 3b 0b 00 00       	call   8015bc <sys_env_destroy>
+}
+  800a81:	83 c4 10             	add    $0x10,%esp
+  800a84:	c9                   	leave
+  800a85:	c3                   	ret
+
+00800a86 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800a86:	55                   	push   %ebp
+  800a87:	89 e5                	mov    %esp,%ebp
+  800a89:	56                   	push   %esi
+  800a8a:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800a8b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800a8e:	8b 35 20 60 80 00    	mov    0x806020,%esi
+  800a94:	e8 6c 0b 00 00       	call   801605 <sys_getenvid>
+  800a99:	83 ec 0c             	sub    $0xc,%esp
+  800a9c:	ff 75 0c             	push   0xc(%ebp)
+  800a9f:	ff 75 08             	push   0x8(%ebp)
+  800aa2:	56                   	push   %esi
+  800aa3:	50                   	push   %eax
+  800aa4:	68 a4 4c 80 00       	push   $0x804ca4
+  800aa9:	e8 b3 00 00 00       	call   800b61 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800aae:	83 c4 18             	add    $0x18,%esp
+  800ab1:	53                   	push   %ebx
+  800ab2:	ff 75 10             	push   0x10(%ebp)
+  800ab5:	e8 56 00 00 00       	call   800b10 <vcprintf>
+	cprintf("\n");
+  800aba:	c7 04 24 a0 4a 80 00 	movl   $0x804aa0,(%esp)
+  800ac1:	e8 9b 00 00 00       	call   800b61 <cprintf>
+  800ac6:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800ac9:	cc                   	int3
+	while (1)
+  800aca:	eb fd                	jmp    800ac9 <_panic+0x43>
+
+00800acc <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	53                   	push   %ebx
+  800ad0:	83 ec 04             	sub    $0x4,%esp
+  800ad3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800ad6:	8b 13                	mov    (%ebx),%edx
+  800ad8:	8d 42 01             	lea    0x1(%edx),%eax
+  800adb:	89 03                	mov    %eax,(%ebx)
+  800add:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ae0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800ae4:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800ae9:	74 09                	je     800af4 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800aeb:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800aef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800af2:	c9                   	leave
+  800af3:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800af4:	83 ec 08             	sub    $0x8,%esp
+  800af7:	68 ff 00 00 00       	push   $0xff
+  800afc:	8d 43 08             	lea    0x8(%ebx),%eax
+  800aff:	50                   	push   %eax
+  800b00:	e8 6a 0a 00 00       	call   80156f <sys_cputs>
+		b->idx = 0;
+  800b05:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800b0b:	83 c4 10             	add    $0x10,%esp
+  800b0e:	eb db                	jmp    800aeb <putch+0x1f>
+
+00800b10 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800b10:	55                   	push   %ebp
+  800b11:	89 e5                	mov    %esp,%ebp
+  800b13:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800b19:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800b20:	00 00 00 
+	b.cnt = 0;
+  800b23:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800b2a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800b2d:	ff 75 0c             	push   0xc(%ebp)
+  800b30:	ff 75 08             	push   0x8(%ebp)
+  800b33:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800b39:	50                   	push   %eax
+  800b3a:	68 cc 0a 80 00       	push   $0x800acc
+  800b3f:	e8 14 01 00 00       	call   800c58 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800b44:	83 c4 08             	add    $0x8,%esp
+  800b47:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800b4d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800b53:	50                   	push   %eax
+  800b54:	e8 16 0a 00 00       	call   80156f <sys_cputs>
+
+	return b.cnt;
+}
+  800b59:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800b5f:	c9                   	leave
+  800b60:	c3                   	ret
+
+00800b61 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800b61:	55                   	push   %ebp
+  800b62:	89 e5                	mov    %esp,%ebp
+  800b64:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800b67:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800b6a:	50                   	push   %eax
+  800b6b:	ff 75 08             	push   0x8(%ebp)
+  800b6e:	e8 9d ff ff ff       	call   800b10 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800b73:	c9                   	leave
+  800b74:	c3                   	ret
+
+00800b75 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800b75:	55                   	push   %ebp
+  800b76:	89 e5                	mov    %esp,%ebp
+  800b78:	57                   	push   %edi
+  800b79:	56                   	push   %esi
+  800b7a:	53                   	push   %ebx
+  800b7b:	83 ec 1c             	sub    $0x1c,%esp
+  800b7e:	89 c7                	mov    %eax,%edi
+  800b80:	89 d6                	mov    %edx,%esi
+  800b82:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b85:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b88:	89 d1                	mov    %edx,%ecx
+  800b8a:	89 c2                	mov    %eax,%edx
+  800b8c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b8f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b92:	8b 45 10             	mov    0x10(%ebp),%eax
+  800b95:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800b98:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b9b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800ba2:	39 c2                	cmp    %eax,%edx
+  800ba4:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800ba7:	72 3e                	jb     800be7 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800ba9:	83 ec 0c             	sub    $0xc,%esp
+  800bac:	ff 75 18             	push   0x18(%ebp)
+  800baf:	83 eb 01             	sub    $0x1,%ebx
+  800bb2:	53                   	push   %ebx
+  800bb3:	50                   	push   %eax
+  800bb4:	83 ec 08             	sub    $0x8,%esp
+  800bb7:	ff 75 e4             	push   -0x1c(%ebp)
+  800bba:	ff 75 e0             	push   -0x20(%ebp)
+  800bbd:	ff 75 dc             	push   -0x24(%ebp)
+  800bc0:	ff 75 d8             	push   -0x28(%ebp)
+  800bc3:	e8 39 3d 00 00       	call   804901 <__udivdi3>
+  800bc8:	83 c4 18             	add    $0x18,%esp
+  800bcb:	52                   	push   %edx
+  800bcc:	50                   	push   %eax
+  800bcd:	89 f2                	mov    %esi,%edx
+  800bcf:	89 f8                	mov    %edi,%eax
+  800bd1:	e8 9f ff ff ff       	call   800b75 <printnum>
+  800bd6:	83 c4 20             	add    $0x20,%esp
+  800bd9:	eb 13                	jmp    800bee <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800bdb:	83 ec 08             	sub    $0x8,%esp
+  800bde:	56                   	push   %esi
+  800bdf:	ff 75 18             	push   0x18(%ebp)
+  800be2:	ff d7                	call   *%edi
+  800be4:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800be7:	83 eb 01             	sub    $0x1,%ebx
+  800bea:	85 db                	test   %ebx,%ebx
+  800bec:	7f ed                	jg     800bdb <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800bee:	83 ec 08             	sub    $0x8,%esp
+  800bf1:	56                   	push   %esi
+  800bf2:	83 ec 04             	sub    $0x4,%esp
+  800bf5:	ff 75 e4             	push   -0x1c(%ebp)
+  800bf8:	ff 75 e0             	push   -0x20(%ebp)
+  800bfb:	ff 75 dc             	push   -0x24(%ebp)
+  800bfe:	ff 75 d8             	push   -0x28(%ebp)
+  800c01:	e8 19 3d 00 00       	call   80491f <__umoddi3>
+  800c06:	83 c4 14             	add    $0x14,%esp
+  800c09:	0f be 80 c7 4c 80 00 	movsbl 0x804cc7(%eax),%eax
+  800c10:	50                   	push   %eax
+  800c11:	ff d7                	call   *%edi
+}
+  800c13:	83 c4 10             	add    $0x10,%esp
+  800c16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c19:	5b                   	pop    %ebx
+  800c1a:	5e                   	pop    %esi
+  800c1b:	5f                   	pop    %edi
+  800c1c:	5d                   	pop    %ebp
+  800c1d:	c3                   	ret
+
+00800c1e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800c1e:	55                   	push   %ebp
+  800c1f:	89 e5                	mov    %esp,%ebp
+  800c21:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800c24:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800c28:	8b 10                	mov    (%eax),%edx
+  800c2a:	3b 50 04             	cmp    0x4(%eax),%edx
+  800c2d:	73 0a                	jae    800c39 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800c2f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800c32:	89 08                	mov    %ecx,(%eax)
+  800c34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c37:	88 02                	mov    %al,(%edx)
+}
+  800c39:	5d                   	pop    %ebp
+  800c3a:	c3                   	ret
+
+00800c3b <printfmt>:
+{
+  800c3b:	55                   	push   %ebp
+  800c3c:	89 e5                	mov    %esp,%ebp
+  800c3e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800c41:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800c44:	50                   	push   %eax
+  800c45:	ff 75 10             	push   0x10(%ebp)
+  800c48:	ff 75 0c             	push   0xc(%ebp)
+  800c4b:	ff 75 08             	push   0x8(%ebp)
+  800c4e:	e8 05 00 00 00       	call   800c58 <vprintfmt>
+}
+  800c53:	83 c4 10             	add    $0x10,%esp
+  800c56:	c9                   	leave
+  800c57:	c3                   	ret
+
+00800c58 <vprintfmt>:
+{
+  800c58:	55                   	push   %ebp
+  800c59:	89 e5                	mov    %esp,%ebp
+  800c5b:	57                   	push   %edi
+  800c5c:	56                   	push   %esi
+  800c5d:	53                   	push   %ebx
+  800c5e:	83 ec 2c             	sub    $0x2c,%esp
+  800c61:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c64:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c67:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800c6a:	eb 0a                	jmp    800c76 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800c6c:	83 ec 08             	sub    $0x8,%esp
+  800c6f:	53                   	push   %ebx
+  800c70:	50                   	push   %eax
+  800c71:	ff d6                	call   *%esi
+  800c73:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c76:	83 c7 01             	add    $0x1,%edi
+  800c79:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800c7d:	83 f8 25             	cmp    $0x25,%eax
+  800c80:	74 0c                	je     800c8e <vprintfmt+0x36>
+			if (ch == '\0')
+  800c82:	85 c0                	test   %eax,%eax
+  800c84:	75 e6                	jne    800c6c <vprintfmt+0x14>
+}
+  800c86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c89:	5b                   	pop    %ebx
+  800c8a:	5e                   	pop    %esi
+  800c8b:	5f                   	pop    %edi
+  800c8c:	5d                   	pop    %ebp
+  800c8d:	c3                   	ret
+		padc = ' ';
+  800c8e:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800c92:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800c99:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800ca0:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800ca7:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800cac:	8d 47 01             	lea    0x1(%edi),%eax
+  800caf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800cb2:	0f b6 17             	movzbl (%edi),%edx
+  800cb5:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800cb8:	3c 55                	cmp    $0x55,%al
+  800cba:	0f 87 cf 03 00 00    	ja     80108f <vprintfmt+0x437>
+  800cc0:	0f b6 c0             	movzbl %al,%eax
+  800cc3:	ff 24 85 20 4e 80 00 	jmp    *0x804e20(,%eax,4)
+  800cca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800ccd:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800cd1:	eb d9                	jmp    800cac <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800cd3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800cd6:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800cda:	eb d0                	jmp    800cac <vprintfmt+0x54>
+  800cdc:	0f b6 d2             	movzbl %dl,%edx
+  800cdf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800cea:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800ced:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800cf1:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800cf4:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800cf7:	83 f9 09             	cmp    $0x9,%ecx
+  800cfa:	77 55                	ja     800d51 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800cfc:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800cff:	eb e9                	jmp    800cea <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800d01:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d04:	8b 00                	mov    (%eax),%eax
+  800d06:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800d09:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d0c:	8d 40 04             	lea    0x4(%eax),%eax
+  800d0f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800d12:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800d15:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800d19:	79 91                	jns    800cac <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800d1b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800d1e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800d21:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800d28:	eb 82                	jmp    800cac <vprintfmt+0x54>
+			if (width < 0)
+  800d2a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800d2d:	85 d2                	test   %edx,%edx
+  800d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d34:	0f 49 c2             	cmovns %edx,%eax
+  800d37:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800d3a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800d3d:	e9 6a ff ff ff       	jmp    800cac <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800d42:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800d45:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800d4c:	e9 5b ff ff ff       	jmp    800cac <vprintfmt+0x54>
+  800d51:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800d54:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800d57:	eb bc                	jmp    800d15 <vprintfmt+0xbd>
+			lflag++;
+  800d59:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800d5c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800d5f:	e9 48 ff ff ff       	jmp    800cac <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800d64:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d67:	8d 78 04             	lea    0x4(%eax),%edi
+  800d6a:	83 ec 08             	sub    $0x8,%esp
+  800d6d:	53                   	push   %ebx
+  800d6e:	ff 30                	push   (%eax)
+  800d70:	ff d6                	call   *%esi
+			break;
+  800d72:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800d75:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800d78:	e9 b1 02 00 00       	jmp    80102e <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800d7d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d80:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800d83:	8b 10                	mov    (%eax),%edx
+  800d85:	89 d0                	mov    %edx,%eax
+  800d87:	f7 d8                	neg    %eax
+  800d89:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d8c:	83 f8 11             	cmp    $0x11,%eax
+  800d8f:	7f 23                	jg     800db4 <vprintfmt+0x15c>
+  800d91:	8b 14 85 80 4f 80 00 	mov    0x804f80(,%eax,4),%edx
+  800d98:	85 d2                	test   %edx,%edx
+  800d9a:	74 18                	je     800db4 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800d9c:	52                   	push   %edx
+  800d9d:	68 e5 4b 80 00       	push   $0x804be5
+  800da2:	53                   	push   %ebx
+  800da3:	56                   	push   %esi
+  800da4:	e8 92 fe ff ff       	call   800c3b <printfmt>
+  800da9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800dac:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800daf:	e9 7a 02 00 00       	jmp    80102e <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800db4:	50                   	push   %eax
+  800db5:	68 df 4c 80 00       	push   $0x804cdf
+  800dba:	53                   	push   %ebx
+  800dbb:	56                   	push   %esi
+  800dbc:	e8 7a fe ff ff       	call   800c3b <printfmt>
+  800dc1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800dc4:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800dc7:	e9 62 02 00 00       	jmp    80102e <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800dcc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dcf:	83 c0 04             	add    $0x4,%eax
+  800dd2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800dd5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dd8:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800dda:	85 c9                	test   %ecx,%ecx
+  800ddc:	b8 d8 4c 80 00       	mov    $0x804cd8,%eax
+  800de1:	0f 45 c1             	cmovne %ecx,%eax
+  800de4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800de7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800deb:	7e 06                	jle    800df3 <vprintfmt+0x19b>
+  800ded:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800df1:	75 0b                	jne    800dfe <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800df3:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800df6:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800df9:	89 75 08             	mov    %esi,0x8(%ebp)
+  800dfc:	eb 5c                	jmp    800e5a <vprintfmt+0x202>
+  800dfe:	83 ec 08             	sub    $0x8,%esp
+  800e01:	ff 75 d0             	push   -0x30(%ebp)
+  800e04:	ff 75 cc             	push   -0x34(%ebp)
+  800e07:	e8 10 04 00 00       	call   80121c <strnlen>
+  800e0c:	89 c2                	mov    %eax,%edx
+  800e0e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800e11:	29 d0                	sub    %edx,%eax
+  800e13:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800e16:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800e1a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e1d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e20:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800e22:	eb 0e                	jmp    800e32 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800e24:	83 ec 08             	sub    $0x8,%esp
+  800e27:	53                   	push   %ebx
+  800e28:	57                   	push   %edi
+  800e29:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800e2c:	83 ee 01             	sub    $0x1,%esi
+  800e2f:	83 c4 10             	add    $0x10,%esp
+  800e32:	85 f6                	test   %esi,%esi
+  800e34:	7f ee                	jg     800e24 <vprintfmt+0x1cc>
+  800e36:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800e39:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e3c:	85 c0                	test   %eax,%eax
+  800e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e43:	0f 49 d0             	cmovns %eax,%edx
+  800e46:	29 d0                	sub    %edx,%eax
+  800e48:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e4b:	eb a6                	jmp    800df3 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800e4d:	83 ec 08             	sub    $0x8,%esp
+  800e50:	53                   	push   %ebx
+  800e51:	52                   	push   %edx
+  800e52:	ff 55 08             	call   *0x8(%ebp)
+  800e55:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e58:	89 f1                	mov    %esi,%ecx
+  800e5a:	8d 71 01             	lea    0x1(%ecx),%esi
+  800e5d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800e61:	0f be d0             	movsbl %al,%edx
+  800e64:	85 d2                	test   %edx,%edx
+  800e66:	74 28                	je     800e90 <vprintfmt+0x238>
+  800e68:	85 ff                	test   %edi,%edi
+  800e6a:	78 05                	js     800e71 <vprintfmt+0x219>
+  800e6c:	83 ef 01             	sub    $0x1,%edi
+  800e6f:	78 30                	js     800ea1 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800e71:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800e75:	74 d6                	je     800e4d <vprintfmt+0x1f5>
+  800e77:	0f be c0             	movsbl %al,%eax
+  800e7a:	83 e8 20             	sub    $0x20,%eax
+  800e7d:	83 f8 5e             	cmp    $0x5e,%eax
+  800e80:	76 cb                	jbe    800e4d <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800e82:	83 ec 08             	sub    $0x8,%esp
+  800e85:	53                   	push   %ebx
+  800e86:	6a 3f                	push   $0x3f
+  800e88:	ff 55 08             	call   *0x8(%ebp)
+  800e8b:	83 c4 10             	add    $0x10,%esp
+  800e8e:	eb c8                	jmp    800e58 <vprintfmt+0x200>
+  800e90:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e93:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800e96:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e99:	01 d0                	add    %edx,%eax
+  800e9b:	29 c8                	sub    %ecx,%eax
+  800e9d:	89 c7                	mov    %eax,%edi
+  800e9f:	eb 13                	jmp    800eb4 <vprintfmt+0x25c>
+  800ea1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ea4:	eb ed                	jmp    800e93 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800ea6:	83 ec 08             	sub    $0x8,%esp
+  800ea9:	53                   	push   %ebx
+  800eaa:	6a 20                	push   $0x20
+  800eac:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800eae:	83 ef 01             	sub    $0x1,%edi
+  800eb1:	83 c4 10             	add    $0x10,%esp
+  800eb4:	85 ff                	test   %edi,%edi
+  800eb6:	7f ee                	jg     800ea6 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800eb8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800ebb:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ebe:	e9 6b 01 00 00       	jmp    80102e <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800ec3:	83 f9 01             	cmp    $0x1,%ecx
+  800ec6:	7f 1f                	jg     800ee7 <vprintfmt+0x28f>
+	else if (lflag)
+  800ec8:	85 c9                	test   %ecx,%ecx
+  800eca:	74 67                	je     800f33 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800ecc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ecf:	8b 00                	mov    (%eax),%eax
+  800ed1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ed4:	89 c1                	mov    %eax,%ecx
+  800ed6:	c1 f9 1f             	sar    $0x1f,%ecx
+  800ed9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800edc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800edf:	8d 40 04             	lea    0x4(%eax),%eax
+  800ee2:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ee5:	eb 17                	jmp    800efe <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800ee7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800eea:	8b 50 04             	mov    0x4(%eax),%edx
+  800eed:	8b 00                	mov    (%eax),%eax
+  800eef:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ef2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ef5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ef8:	8d 40 08             	lea    0x8(%eax),%eax
+  800efb:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800efe:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800f01:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800f04:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800f09:	85 c9                	test   %ecx,%ecx
+  800f0b:	0f 89 03 01 00 00    	jns    801014 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800f11:	83 ec 08             	sub    $0x8,%esp
+  800f14:	53                   	push   %ebx
+  800f15:	6a 2d                	push   $0x2d
+  800f17:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800f19:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800f1c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800f1f:	f7 da                	neg    %edx
+  800f21:	83 d1 00             	adc    $0x0,%ecx
+  800f24:	f7 d9                	neg    %ecx
+  800f26:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800f29:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800f2e:	e9 e1 00 00 00       	jmp    801014 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800f33:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f36:	8b 00                	mov    (%eax),%eax
+  800f38:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800f3b:	89 c1                	mov    %eax,%ecx
+  800f3d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800f40:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800f43:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f46:	8d 40 04             	lea    0x4(%eax),%eax
+  800f49:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f4c:	eb b0                	jmp    800efe <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800f4e:	83 f9 01             	cmp    $0x1,%ecx
+  800f51:	7f 1e                	jg     800f71 <vprintfmt+0x319>
+	else if (lflag)
+  800f53:	85 c9                	test   %ecx,%ecx
+  800f55:	74 32                	je     800f89 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800f57:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f5a:	8b 10                	mov    (%eax),%edx
+  800f5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f61:	8d 40 04             	lea    0x4(%eax),%eax
+  800f64:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f67:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800f6c:	e9 a3 00 00 00       	jmp    801014 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800f71:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f74:	8b 10                	mov    (%eax),%edx
+  800f76:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f79:	8d 40 08             	lea    0x8(%eax),%eax
+  800f7c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f7f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800f84:	e9 8b 00 00 00       	jmp    801014 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800f89:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f8c:	8b 10                	mov    (%eax),%edx
+  800f8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f93:	8d 40 04             	lea    0x4(%eax),%eax
+  800f96:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f99:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800f9e:	eb 74                	jmp    801014 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800fa0:	83 f9 01             	cmp    $0x1,%ecx
+  800fa3:	7f 1b                	jg     800fc0 <vprintfmt+0x368>
+	else if (lflag)
+  800fa5:	85 c9                	test   %ecx,%ecx
+  800fa7:	74 2c                	je     800fd5 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800fa9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fac:	8b 10                	mov    (%eax),%edx
+  800fae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb3:	8d 40 04             	lea    0x4(%eax),%eax
+  800fb6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800fb9:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800fbe:	eb 54                	jmp    801014 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800fc0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fc3:	8b 10                	mov    (%eax),%edx
+  800fc5:	8b 48 04             	mov    0x4(%eax),%ecx
+  800fc8:	8d 40 08             	lea    0x8(%eax),%eax
+  800fcb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800fce:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800fd3:	eb 3f                	jmp    801014 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800fd5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fd8:	8b 10                	mov    (%eax),%edx
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fdf:	8d 40 04             	lea    0x4(%eax),%eax
+  800fe2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800fe5:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800fea:	eb 28                	jmp    801014 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800fec:	83 ec 08             	sub    $0x8,%esp
+  800fef:	53                   	push   %ebx
+  800ff0:	6a 30                	push   $0x30
+  800ff2:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800ff4:	83 c4 08             	add    $0x8,%esp
+  800ff7:	53                   	push   %ebx
+  800ff8:	6a 78                	push   $0x78
+  800ffa:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800ffc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fff:	8b 10                	mov    (%eax),%edx
+  801001:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  801006:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  801009:	8d 40 04             	lea    0x4(%eax),%eax
+  80100c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80100f:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  801014:	83 ec 0c             	sub    $0xc,%esp
+  801017:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80101b:	50                   	push   %eax
+  80101c:	ff 75 e0             	push   -0x20(%ebp)
+  80101f:	57                   	push   %edi
+  801020:	51                   	push   %ecx
+  801021:	52                   	push   %edx
+  801022:	89 da                	mov    %ebx,%edx
+  801024:	89 f0                	mov    %esi,%eax
+  801026:	e8 4a fb ff ff       	call   800b75 <printnum>
+			break;
+  80102b:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80102e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801031:	e9 40 fc ff ff       	jmp    800c76 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  801036:	83 f9 01             	cmp    $0x1,%ecx
+  801039:	7f 1b                	jg     801056 <vprintfmt+0x3fe>
+	else if (lflag)
+  80103b:	85 c9                	test   %ecx,%ecx
+  80103d:	74 2c                	je     80106b <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80103f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801042:	8b 10                	mov    (%eax),%edx
+  801044:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801049:	8d 40 04             	lea    0x4(%eax),%eax
+  80104c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80104f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  801054:	eb be                	jmp    801014 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  801056:	8b 45 14             	mov    0x14(%ebp),%eax
+  801059:	8b 10                	mov    (%eax),%edx
+  80105b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80105e:	8d 40 08             	lea    0x8(%eax),%eax
+  801061:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801064:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  801069:	eb a9                	jmp    801014 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80106b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80106e:	8b 10                	mov    (%eax),%edx
+  801070:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801075:	8d 40 04             	lea    0x4(%eax),%eax
+  801078:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80107b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801080:	eb 92                	jmp    801014 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  801082:	83 ec 08             	sub    $0x8,%esp
+  801085:	53                   	push   %ebx
+  801086:	6a 25                	push   $0x25
+  801088:	ff d6                	call   *%esi
+			break;
+  80108a:	83 c4 10             	add    $0x10,%esp
+  80108d:	eb 9f                	jmp    80102e <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80108f:	83 ec 08             	sub    $0x8,%esp
+  801092:	53                   	push   %ebx
+  801093:	6a 25                	push   $0x25
+  801095:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801097:	83 c4 10             	add    $0x10,%esp
+  80109a:	89 f8                	mov    %edi,%eax
+  80109c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8010a0:	74 05                	je     8010a7 <vprintfmt+0x44f>
+  8010a2:	83 e8 01             	sub    $0x1,%eax
+  8010a5:	eb f5                	jmp    80109c <vprintfmt+0x444>
+  8010a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8010aa:	eb 82                	jmp    80102e <vprintfmt+0x3d6>
+
+008010ac <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	83 ec 18             	sub    $0x18,%esp
+  8010b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8010b8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8010bb:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8010bf:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8010c2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8010c9:	85 c0                	test   %eax,%eax
+  8010cb:	74 26                	je     8010f3 <vsnprintf+0x47>
+  8010cd:	85 d2                	test   %edx,%edx
+  8010cf:	7e 22                	jle    8010f3 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8010d1:	ff 75 14             	push   0x14(%ebp)
+  8010d4:	ff 75 10             	push   0x10(%ebp)
+  8010d7:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8010da:	50                   	push   %eax
+  8010db:	68 1e 0c 80 00       	push   $0x800c1e
+  8010e0:	e8 73 fb ff ff       	call   800c58 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8010e5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010e8:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8010eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010ee:	83 c4 10             	add    $0x10,%esp
+}
+  8010f1:	c9                   	leave
+  8010f2:	c3                   	ret
+		return -E_INVAL;
+  8010f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010f8:	eb f7                	jmp    8010f1 <vsnprintf+0x45>
+
+008010fa <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8010fa:	55                   	push   %ebp
+  8010fb:	89 e5                	mov    %esp,%ebp
+  8010fd:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801100:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801103:	50                   	push   %eax
+  801104:	ff 75 10             	push   0x10(%ebp)
+  801107:	ff 75 0c             	push   0xc(%ebp)
+  80110a:	ff 75 08             	push   0x8(%ebp)
+  80110d:	e8 9a ff ff ff       	call   8010ac <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801112:	c9                   	leave
+  801113:	c3                   	ret
+
+00801114 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  801114:	55                   	push   %ebp
+  801115:	89 e5                	mov    %esp,%ebp
+  801117:	57                   	push   %edi
+  801118:	56                   	push   %esi
+  801119:	53                   	push   %ebx
+  80111a:	83 ec 0c             	sub    $0xc,%esp
+  80111d:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  801120:	85 c0                	test   %eax,%eax
+  801122:	74 13                	je     801137 <readline+0x23>
+		fprintf(1, "%s", prompt);
+  801124:	83 ec 04             	sub    $0x4,%esp
+  801127:	50                   	push   %eax
+  801128:	68 e5 4b 80 00       	push   $0x804be5
+  80112d:	6a 01                	push   $0x1
+  80112f:	e8 f8 24 00 00       	call   80362c <fprintf>
+  801134:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  801137:	83 ec 0c             	sub    $0xc,%esp
+  80113a:	6a 00                	push   $0x0
+  80113c:	e8 64 f8 ff ff       	call   8009a5 <iscons>
+  801141:	89 c7                	mov    %eax,%edi
+  801143:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  801146:	be 00 00 00 00       	mov    $0x0,%esi
+  80114b:	eb 4b                	jmp    801198 <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  80114d:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  801152:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  801155:	75 08                	jne    80115f <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  801157:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115a:	5b                   	pop    %ebx
+  80115b:	5e                   	pop    %esi
+  80115c:	5f                   	pop    %edi
+  80115d:	5d                   	pop    %ebp
+  80115e:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  80115f:	83 ec 08             	sub    $0x8,%esp
+  801162:	53                   	push   %ebx
+  801163:	68 e7 4f 80 00       	push   $0x804fe7
+  801168:	e8 f4 f9 ff ff       	call   800b61 <cprintf>
+  80116d:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  801170:	b8 00 00 00 00       	mov    $0x0,%eax
+  801175:	eb e0                	jmp    801157 <readline+0x43>
+			if (echoing)
+  801177:	85 ff                	test   %edi,%edi
+  801179:	75 05                	jne    801180 <readline+0x6c>
+			i--;
+  80117b:	83 ee 01             	sub    $0x1,%esi
+  80117e:	eb 18                	jmp    801198 <readline+0x84>
+				cputchar('\b');
+  801180:	83 ec 0c             	sub    $0xc,%esp
+  801183:	6a 08                	push   $0x8
+  801185:	e8 d6 f7 ff ff       	call   800960 <cputchar>
+  80118a:	83 c4 10             	add    $0x10,%esp
+  80118d:	eb ec                	jmp    80117b <readline+0x67>
+			buf[i++] = c;
+  80118f:	88 9e 20 70 80 00    	mov    %bl,0x807020(%esi)
+  801195:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  801198:	e8 df f7 ff ff       	call   80097c <getchar>
+  80119d:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  80119f:	85 c0                	test   %eax,%eax
+  8011a1:	78 aa                	js     80114d <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  8011a3:	83 f8 08             	cmp    $0x8,%eax
+  8011a6:	0f 94 c0             	sete   %al
+  8011a9:	83 fb 7f             	cmp    $0x7f,%ebx
+  8011ac:	0f 94 c2             	sete   %dl
+  8011af:	08 d0                	or     %dl,%al
+  8011b1:	74 04                	je     8011b7 <readline+0xa3>
+  8011b3:	85 f6                	test   %esi,%esi
+  8011b5:	7f c0                	jg     801177 <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  8011b7:	83 fb 1f             	cmp    $0x1f,%ebx
+  8011ba:	7e 1a                	jle    8011d6 <readline+0xc2>
+  8011bc:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  8011c2:	7f 12                	jg     8011d6 <readline+0xc2>
+			if (echoing)
+  8011c4:	85 ff                	test   %edi,%edi
+  8011c6:	74 c7                	je     80118f <readline+0x7b>
+				cputchar(c);
+  8011c8:	83 ec 0c             	sub    $0xc,%esp
+  8011cb:	53                   	push   %ebx
+  8011cc:	e8 8f f7 ff ff       	call   800960 <cputchar>
+  8011d1:	83 c4 10             	add    $0x10,%esp
+  8011d4:	eb b9                	jmp    80118f <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  8011d6:	83 fb 0a             	cmp    $0xa,%ebx
+  8011d9:	74 05                	je     8011e0 <readline+0xcc>
+  8011db:	83 fb 0d             	cmp    $0xd,%ebx
+  8011de:	75 b8                	jne    801198 <readline+0x84>
+			if (echoing)
+  8011e0:	85 ff                	test   %edi,%edi
+  8011e2:	75 11                	jne    8011f5 <readline+0xe1>
+			buf[i] = 0;
+  8011e4:	c6 86 20 70 80 00 00 	movb   $0x0,0x807020(%esi)
+			return buf;
+  8011eb:	b8 20 70 80 00       	mov    $0x807020,%eax
+  8011f0:	e9 62 ff ff ff       	jmp    801157 <readline+0x43>
+				cputchar('\n');
+  8011f5:	83 ec 0c             	sub    $0xc,%esp
+  8011f8:	6a 0a                	push   $0xa
+  8011fa:	e8 61 f7 ff ff       	call   800960 <cputchar>
+  8011ff:	83 c4 10             	add    $0x10,%esp
+  801202:	eb e0                	jmp    8011e4 <readline+0xd0>
+
+00801204 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801204:	55                   	push   %ebp
+  801205:	89 e5                	mov    %esp,%ebp
+  801207:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80120a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120f:	eb 03                	jmp    801214 <strlen+0x10>
+		n++;
+  801211:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801214:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801218:	75 f7                	jne    801211 <strlen+0xd>
+	return n;
+}
+  80121a:	5d                   	pop    %ebp
+  80121b:	c3                   	ret
+
+0080121c <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80121c:	55                   	push   %ebp
+  80121d:	89 e5                	mov    %esp,%ebp
+  80121f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801222:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801225:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122a:	eb 03                	jmp    80122f <strnlen+0x13>
+		n++;
+  80122c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80122f:	39 d0                	cmp    %edx,%eax
+  801231:	74 08                	je     80123b <strnlen+0x1f>
+  801233:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801237:	75 f3                	jne    80122c <strnlen+0x10>
+  801239:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80123b:	89 d0                	mov    %edx,%eax
+  80123d:	5d                   	pop    %ebp
+  80123e:	c3                   	ret
+
+0080123f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80123f:	55                   	push   %ebp
+  801240:	89 e5                	mov    %esp,%ebp
+  801242:	53                   	push   %ebx
+  801243:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801246:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801249:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801252:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801255:	83 c0 01             	add    $0x1,%eax
+  801258:	84 d2                	test   %dl,%dl
+  80125a:	75 f2                	jne    80124e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80125c:	89 c8                	mov    %ecx,%eax
+  80125e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801261:	c9                   	leave
+  801262:	c3                   	ret
+
+00801263 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	53                   	push   %ebx
+  801267:	83 ec 10             	sub    $0x10,%esp
+  80126a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80126d:	53                   	push   %ebx
+  80126e:	e8 91 ff ff ff       	call   801204 <strlen>
+  801273:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  801276:	ff 75 0c             	push   0xc(%ebp)
+  801279:	01 d8                	add    %ebx,%eax
+  80127b:	50                   	push   %eax
+  80127c:	e8 be ff ff ff       	call   80123f <strcpy>
+	return dst;
+}
+  801281:	89 d8                	mov    %ebx,%eax
+  801283:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801286:	c9                   	leave
+  801287:	c3                   	ret
+
+00801288 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801288:	55                   	push   %ebp
+  801289:	89 e5                	mov    %esp,%ebp
+  80128b:	56                   	push   %esi
+  80128c:	53                   	push   %ebx
+  80128d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801290:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801293:	89 f3                	mov    %esi,%ebx
+  801295:	03 5d 10             	add    0x10(%ebp),%ebx
+  801298:	89 f0                	mov    %esi,%eax
+  80129a:	eb 0f                	jmp    8012ab <strncpy+0x23>
+		*dst++ = *src;
+  80129c:	83 c0 01             	add    $0x1,%eax
+  80129f:	0f b6 0a             	movzbl (%edx),%ecx
+  8012a2:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8012a5:	80 f9 01             	cmp    $0x1,%cl
+  8012a8:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8012ab:	39 d8                	cmp    %ebx,%eax
+  8012ad:	75 ed                	jne    80129c <strncpy+0x14>
+	}
+	return ret;
+}
+  8012af:	89 f0                	mov    %esi,%eax
+  8012b1:	5b                   	pop    %ebx
+  8012b2:	5e                   	pop    %esi
+  8012b3:	5d                   	pop    %ebp
+  8012b4:	c3                   	ret
+
+008012b5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8012b5:	55                   	push   %ebp
+  8012b6:	89 e5                	mov    %esp,%ebp
+  8012b8:	56                   	push   %esi
+  8012b9:	53                   	push   %ebx
+  8012ba:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c0:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8012c3:	89 f0                	mov    %esi,%eax
+  8012c5:	85 d2                	test   %edx,%edx
+  8012c7:	74 21                	je     8012ea <strlcpy+0x35>
+  8012c9:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8012cd:	89 f2                	mov    %esi,%edx
+  8012cf:	eb 09                	jmp    8012da <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8012d1:	83 c1 01             	add    $0x1,%ecx
+  8012d4:	83 c2 01             	add    $0x1,%edx
+  8012d7:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8012da:	39 c2                	cmp    %eax,%edx
+  8012dc:	74 09                	je     8012e7 <strlcpy+0x32>
+  8012de:	0f b6 19             	movzbl (%ecx),%ebx
+  8012e1:	84 db                	test   %bl,%bl
+  8012e3:	75 ec                	jne    8012d1 <strlcpy+0x1c>
+  8012e5:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8012e7:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8012ea:	29 f0                	sub    %esi,%eax
+}
+  8012ec:	5b                   	pop    %ebx
+  8012ed:	5e                   	pop    %esi
+  8012ee:	5d                   	pop    %ebp
+  8012ef:	c3                   	ret
+
+008012f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8012f0:	55                   	push   %ebp
+  8012f1:	89 e5                	mov    %esp,%ebp
+  8012f3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8012f9:	eb 06                	jmp    801301 <strcmp+0x11>
+		p++, q++;
+  8012fb:	83 c1 01             	add    $0x1,%ecx
+  8012fe:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801301:	0f b6 01             	movzbl (%ecx),%eax
+  801304:	84 c0                	test   %al,%al
+  801306:	74 04                	je     80130c <strcmp+0x1c>
+  801308:	3a 02                	cmp    (%edx),%al
+  80130a:	74 ef                	je     8012fb <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80130c:	0f b6 c0             	movzbl %al,%eax
+  80130f:	0f b6 12             	movzbl (%edx),%edx
+  801312:	29 d0                	sub    %edx,%eax
+}
+  801314:	5d                   	pop    %ebp
+  801315:	c3                   	ret
+
+00801316 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801316:	55                   	push   %ebp
+  801317:	89 e5                	mov    %esp,%ebp
+  801319:	53                   	push   %ebx
+  80131a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80131d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801320:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801323:	eb 09                	jmp    80132e <strncmp+0x18>
+		n--, p++, q++;
+  801325:	83 ea 01             	sub    $0x1,%edx
+  801328:	83 c0 01             	add    $0x1,%eax
+  80132b:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80132e:	85 d2                	test   %edx,%edx
+  801330:	74 18                	je     80134a <strncmp+0x34>
+  801332:	0f b6 18             	movzbl (%eax),%ebx
+  801335:	84 db                	test   %bl,%bl
+  801337:	74 04                	je     80133d <strncmp+0x27>
+  801339:	3a 19                	cmp    (%ecx),%bl
+  80133b:	74 e8                	je     801325 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80133d:	0f b6 00             	movzbl (%eax),%eax
+  801340:	0f b6 11             	movzbl (%ecx),%edx
+  801343:	29 d0                	sub    %edx,%eax
+}
+  801345:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801348:	c9                   	leave
+  801349:	c3                   	ret
+		return 0;
+  80134a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134f:	eb f4                	jmp    801345 <strncmp+0x2f>
+
+00801351 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801351:	55                   	push   %ebp
+  801352:	89 e5                	mov    %esp,%ebp
+  801354:	8b 45 08             	mov    0x8(%ebp),%eax
+  801357:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80135b:	eb 03                	jmp    801360 <strchr+0xf>
+  80135d:	83 c0 01             	add    $0x1,%eax
+  801360:	0f b6 10             	movzbl (%eax),%edx
+  801363:	84 d2                	test   %dl,%dl
+  801365:	74 06                	je     80136d <strchr+0x1c>
+		if (*s == c)
+  801367:	38 ca                	cmp    %cl,%dl
+  801369:	75 f2                	jne    80135d <strchr+0xc>
+  80136b:	eb 05                	jmp    801372 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80136d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801372:	5d                   	pop    %ebp
+  801373:	c3                   	ret
+
+00801374 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801374:	55                   	push   %ebp
+  801375:	89 e5                	mov    %esp,%ebp
+  801377:	8b 45 08             	mov    0x8(%ebp),%eax
+  80137a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80137e:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801381:	38 ca                	cmp    %cl,%dl
+  801383:	74 09                	je     80138e <strfind+0x1a>
+  801385:	84 d2                	test   %dl,%dl
+  801387:	74 05                	je     80138e <strfind+0x1a>
+	for (; *s; s++)
+  801389:	83 c0 01             	add    $0x1,%eax
+  80138c:	eb f0                	jmp    80137e <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80138e:	5d                   	pop    %ebp
+  80138f:	c3                   	ret
+
+00801390 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801390:	55                   	push   %ebp
+  801391:	89 e5                	mov    %esp,%ebp
+  801393:	57                   	push   %edi
+  801394:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801397:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80139a:	85 c9                	test   %ecx,%ecx
+  80139c:	74 20                	je     8013be <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80139e:	89 f8                	mov    %edi,%eax
+  8013a0:	09 c8                	or     %ecx,%eax
+  8013a2:	a8 03                	test   $0x3,%al
+  8013a4:	75 12                	jne    8013b8 <memset+0x28>
+		c &= 0xFF;
+  8013a6:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8013aa:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8013b0:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8013b3:	fc                   	cld
+  8013b4:	f3 ab                	rep stos %eax,%es:(%edi)
+  8013b6:	eb 06                	jmp    8013be <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8013b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013bb:	fc                   	cld
+  8013bc:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8013be:	89 f8                	mov    %edi,%eax
+  8013c0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8013c3:	c9                   	leave
+  8013c4:	c3                   	ret
+
+008013c5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8013c5:	55                   	push   %ebp
+  8013c6:	89 e5                	mov    %esp,%ebp
+  8013c8:	57                   	push   %edi
+  8013c9:	56                   	push   %esi
+  8013ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013d0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8013d3:	39 c6                	cmp    %eax,%esi
+  8013d5:	73 32                	jae    801409 <memmove+0x44>
+  8013d7:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8013da:	39 d0                	cmp    %edx,%eax
+  8013dc:	73 2b                	jae    801409 <memmove+0x44>
+		s += n;
+		d += n;
+  8013de:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8013e1:	89 d6                	mov    %edx,%esi
+  8013e3:	09 fe                	or     %edi,%esi
+  8013e5:	09 ce                	or     %ecx,%esi
+  8013e7:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8013ed:	75 0e                	jne    8013fd <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8013ef:	83 ef 04             	sub    $0x4,%edi
+  8013f2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8013f5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8013f8:	fd                   	std
+  8013f9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8013fb:	eb 09                	jmp    801406 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8013fd:	83 ef 01             	sub    $0x1,%edi
+  801400:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801403:	fd                   	std
+  801404:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801406:	fc                   	cld
+  801407:	eb 1a                	jmp    801423 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801409:	89 f2                	mov    %esi,%edx
+  80140b:	09 c2                	or     %eax,%edx
+  80140d:	09 ca                	or     %ecx,%edx
+  80140f:	f6 c2 03             	test   $0x3,%dl
+  801412:	75 0a                	jne    80141e <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801414:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801417:	89 c7                	mov    %eax,%edi
+  801419:	fc                   	cld
+  80141a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80141c:	eb 05                	jmp    801423 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80141e:	89 c7                	mov    %eax,%edi
+  801420:	fc                   	cld
+  801421:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801423:	5e                   	pop    %esi
+  801424:	5f                   	pop    %edi
+  801425:	5d                   	pop    %ebp
+  801426:	c3                   	ret
+
+00801427 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801427:	55                   	push   %ebp
+  801428:	89 e5                	mov    %esp,%ebp
+  80142a:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80142d:	ff 75 10             	push   0x10(%ebp)
+  801430:	ff 75 0c             	push   0xc(%ebp)
+  801433:	ff 75 08             	push   0x8(%ebp)
+  801436:	e8 8a ff ff ff       	call   8013c5 <memmove>
+}
+  80143b:	c9                   	leave
+  80143c:	c3                   	ret
+
+0080143d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80143d:	55                   	push   %ebp
+  80143e:	89 e5                	mov    %esp,%ebp
+  801440:	56                   	push   %esi
+  801441:	53                   	push   %ebx
+  801442:	8b 45 08             	mov    0x8(%ebp),%eax
+  801445:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801448:	89 c6                	mov    %eax,%esi
+  80144a:	03 75 10             	add    0x10(%ebp),%esi
+  80144d:	eb 06                	jmp    801455 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80144f:	83 c0 01             	add    $0x1,%eax
+  801452:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801455:	39 f0                	cmp    %esi,%eax
+  801457:	74 14                	je     80146d <memcmp+0x30>
+		if (*s1 != *s2)
+  801459:	0f b6 08             	movzbl (%eax),%ecx
+  80145c:	0f b6 1a             	movzbl (%edx),%ebx
+  80145f:	38 d9                	cmp    %bl,%cl
+  801461:	74 ec                	je     80144f <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801463:	0f b6 c1             	movzbl %cl,%eax
+  801466:	0f b6 db             	movzbl %bl,%ebx
+  801469:	29 d8                	sub    %ebx,%eax
+  80146b:	eb 05                	jmp    801472 <memcmp+0x35>
+	}
+
+	return 0;
+  80146d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801472:	5b                   	pop    %ebx
+  801473:	5e                   	pop    %esi
+  801474:	5d                   	pop    %ebp
+  801475:	c3                   	ret
+
+00801476 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801476:	55                   	push   %ebp
+  801477:	89 e5                	mov    %esp,%ebp
+  801479:	8b 45 08             	mov    0x8(%ebp),%eax
+  80147c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80147f:	89 c2                	mov    %eax,%edx
+  801481:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801484:	eb 03                	jmp    801489 <memfind+0x13>
+  801486:	83 c0 01             	add    $0x1,%eax
+  801489:	39 d0                	cmp    %edx,%eax
+  80148b:	73 04                	jae    801491 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80148d:	38 08                	cmp    %cl,(%eax)
+  80148f:	75 f5                	jne    801486 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801491:	5d                   	pop    %ebp
+  801492:	c3                   	ret
+
+00801493 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801493:	55                   	push   %ebp
+  801494:	89 e5                	mov    %esp,%ebp
+  801496:	57                   	push   %edi
+  801497:	56                   	push   %esi
+  801498:	53                   	push   %ebx
+  801499:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80149f:	eb 03                	jmp    8014a4 <strtol+0x11>
+		s++;
+  8014a1:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8014a4:	0f b6 02             	movzbl (%edx),%eax
+  8014a7:	3c 20                	cmp    $0x20,%al
+  8014a9:	74 f6                	je     8014a1 <strtol+0xe>
+  8014ab:	3c 09                	cmp    $0x9,%al
+  8014ad:	74 f2                	je     8014a1 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8014af:	3c 2b                	cmp    $0x2b,%al
+  8014b1:	74 2a                	je     8014dd <strtol+0x4a>
+	int neg = 0;
+  8014b3:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8014b8:	3c 2d                	cmp    $0x2d,%al
+  8014ba:	74 2b                	je     8014e7 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8014bc:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8014c2:	75 0f                	jne    8014d3 <strtol+0x40>
+  8014c4:	80 3a 30             	cmpb   $0x30,(%edx)
+  8014c7:	74 28                	je     8014f1 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8014c9:	85 db                	test   %ebx,%ebx
+  8014cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014d0:	0f 44 d8             	cmove  %eax,%ebx
+  8014d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014d8:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8014db:	eb 46                	jmp    801523 <strtol+0x90>
+		s++;
+  8014dd:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8014e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014e5:	eb d5                	jmp    8014bc <strtol+0x29>
+		s++, neg = 1;
+  8014e7:	83 c2 01             	add    $0x1,%edx
+  8014ea:	bf 01 00 00 00       	mov    $0x1,%edi
+  8014ef:	eb cb                	jmp    8014bc <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8014f1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8014f5:	74 0e                	je     801505 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8014f7:	85 db                	test   %ebx,%ebx
+  8014f9:	75 d8                	jne    8014d3 <strtol+0x40>
+		s++, base = 8;
+  8014fb:	83 c2 01             	add    $0x1,%edx
+  8014fe:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801503:	eb ce                	jmp    8014d3 <strtol+0x40>
+		s += 2, base = 16;
+  801505:	83 c2 02             	add    $0x2,%edx
+  801508:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80150d:	eb c4                	jmp    8014d3 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80150f:	0f be c0             	movsbl %al,%eax
+  801512:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801515:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801518:	7d 3a                	jge    801554 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  80151a:	83 c2 01             	add    $0x1,%edx
+  80151d:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801521:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801523:	0f b6 02             	movzbl (%edx),%eax
+  801526:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801529:	89 f3                	mov    %esi,%ebx
+  80152b:	80 fb 09             	cmp    $0x9,%bl
+  80152e:	76 df                	jbe    80150f <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801530:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801533:	89 f3                	mov    %esi,%ebx
+  801535:	80 fb 19             	cmp    $0x19,%bl
+  801538:	77 08                	ja     801542 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  80153a:	0f be c0             	movsbl %al,%eax
+  80153d:	83 e8 57             	sub    $0x57,%eax
+  801540:	eb d3                	jmp    801515 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801542:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801545:	89 f3                	mov    %esi,%ebx
+  801547:	80 fb 19             	cmp    $0x19,%bl
+  80154a:	77 08                	ja     801554 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80154c:	0f be c0             	movsbl %al,%eax
+  80154f:	83 e8 37             	sub    $0x37,%eax
+  801552:	eb c1                	jmp    801515 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801554:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801558:	74 05                	je     80155f <strtol+0xcc>
+		*endptr = (char *) s;
+  80155a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80155d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80155f:	89 c8                	mov    %ecx,%eax
+  801561:	f7 d8                	neg    %eax
+  801563:	85 ff                	test   %edi,%edi
+  801565:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801568:	89 c8                	mov    %ecx,%eax
+  80156a:	5b                   	pop    %ebx
+  80156b:	5e                   	pop    %esi
+  80156c:	5f                   	pop    %edi
+  80156d:	5d                   	pop    %ebp
+  80156e:	c3                   	ret
+
+0080156f <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80156f:	55                   	push   %ebp
+  801570:	89 e5                	mov    %esp,%ebp
+  801572:	57                   	push   %edi
+  801573:	56                   	push   %esi
+  801574:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801580:	89 c3                	mov    %eax,%ebx
+  801582:	89 c7                	mov    %eax,%edi
+  801584:	55                   	push   %ebp
+  801585:	89 e5                	mov    %esp,%ebp
+  801587:	8d 35 8f 15 80 00    	lea    0x80158f,%esi
+  80158d:	0f 34                	sysenter
+  80158f:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  801590:	5b                   	pop    %ebx
+  801591:	5e                   	pop    %esi
+  801592:	5f                   	pop    %edi
+  801593:	5d                   	pop    %ebp
+  801594:	c3                   	ret
+
+00801595 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801595:	55                   	push   %ebp
+  801596:	89 e5                	mov    %esp,%ebp
+  801598:	57                   	push   %edi
+  801599:	56                   	push   %esi
+  80159a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80159b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8015a5:	89 d1                	mov    %edx,%ecx
+  8015a7:	89 d3                	mov    %edx,%ebx
+  8015a9:	89 d7                	mov    %edx,%edi
+  8015ab:	55                   	push   %ebp
+  8015ac:	89 e5                	mov    %esp,%ebp
+  8015ae:	8d 35 b6 15 80 00    	lea    0x8015b6,%esi
+  8015b4:	0f 34                	sysenter
+  8015b6:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  8015b7:	5b                   	pop    %ebx
+  8015b8:	5e                   	pop    %esi
+  8015b9:	5f                   	pop    %edi
+  8015ba:	5d                   	pop    %ebp
+  8015bb:	c3                   	ret
+
+008015bc <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8015bc:	55                   	push   %ebp
+  8015bd:	89 e5                	mov    %esp,%ebp
+  8015bf:	57                   	push   %edi
+  8015c0:	56                   	push   %esi
+  8015c1:	53                   	push   %ebx
+  8015c2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8015c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8015d2:	89 cb                	mov    %ecx,%ebx
+  8015d4:	89 cf                	mov    %ecx,%edi
+  8015d6:	55                   	push   %ebp
+  8015d7:	89 e5                	mov    %esp,%ebp
+  8015d9:	8d 35 e1 15 80 00    	lea    0x8015e1,%esi
+  8015df:	0f 34                	sysenter
+  8015e1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015e2:	85 c0                	test   %eax,%eax
+  8015e4:	7f 08                	jg     8015ee <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  8015e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e9:	5b                   	pop    %ebx
+  8015ea:	5e                   	pop    %esi
+  8015eb:	5f                   	pop    %edi
+  8015ec:	5d                   	pop    %ebp
+  8015ed:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015ee:	83 ec 0c             	sub    $0xc,%esp
+  8015f1:	50                   	push   %eax
+  8015f2:	6a 03                	push   $0x3
+  8015f4:	68 f7 4f 80 00       	push   $0x804ff7
+  8015f9:	6a 3d                	push   $0x3d
+  8015fb:	68 14 50 80 00       	push   $0x805014
+  801600:	e8 81 f4 ff ff       	call   800a86 <_panic>
+
+00801605 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801605:	55                   	push   %ebp
+  801606:	89 e5                	mov    %esp,%ebp
+  801608:	57                   	push   %edi
+  801609:	56                   	push   %esi
+  80160a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80160b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801610:	b8 02 00 00 00       	mov    $0x2,%eax
+  801615:	89 d1                	mov    %edx,%ecx
+  801617:	89 d3                	mov    %edx,%ebx
+  801619:	89 d7                	mov    %edx,%edi
+  80161b:	55                   	push   %ebp
+  80161c:	89 e5                	mov    %esp,%ebp
+  80161e:	8d 35 26 16 80 00    	lea    0x801626,%esi
+  801624:	0f 34                	sysenter
+  801626:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  801627:	5b                   	pop    %ebx
+  801628:	5e                   	pop    %esi
+  801629:	5f                   	pop    %edi
+  80162a:	5d                   	pop    %ebp
+  80162b:	c3                   	ret
+
+0080162c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80162c:	55                   	push   %ebp
+  80162d:	89 e5                	mov    %esp,%ebp
+  80162f:	57                   	push   %edi
+  801630:	56                   	push   %esi
+  801631:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801632:	ba 00 00 00 00       	mov    $0x0,%edx
+  801637:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80163c:	89 d1                	mov    %edx,%ecx
+  80163e:	89 d3                	mov    %edx,%ebx
+  801640:	89 d7                	mov    %edx,%edi
+  801642:	89 d6                	mov    %edx,%esi
+  801644:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801646:	5b                   	pop    %ebx
+  801647:	5e                   	pop    %esi
+  801648:	5f                   	pop    %edi
+  801649:	5d                   	pop    %ebp
+  80164a:	c3                   	ret
+
+0080164b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80164b:	55                   	push   %ebp
+  80164c:	89 e5                	mov    %esp,%ebp
+  80164e:	57                   	push   %edi
+  80164f:	56                   	push   %esi
+  801650:	53                   	push   %ebx
+  801651:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801654:	8b 55 08             	mov    0x8(%ebp),%edx
+  801657:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80165a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80165f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801664:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801667:	55                   	push   %ebp
+  801668:	89 e5                	mov    %esp,%ebp
+  80166a:	8d 35 72 16 80 00    	lea    0x801672,%esi
+  801670:	0f 34                	sysenter
+  801672:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801673:	85 c0                	test   %eax,%eax
+  801675:	7f 08                	jg     80167f <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  801677:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80167a:	5b                   	pop    %ebx
+  80167b:	5e                   	pop    %esi
+  80167c:	5f                   	pop    %edi
+  80167d:	5d                   	pop    %ebp
+  80167e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80167f:	83 ec 0c             	sub    $0xc,%esp
+  801682:	50                   	push   %eax
+  801683:	6a 04                	push   $0x4
+  801685:	68 f7 4f 80 00       	push   $0x804ff7
+  80168a:	6a 3d                	push   $0x3d
+  80168c:	68 14 50 80 00       	push   $0x805014
+  801691:	e8 f0 f3 ff ff       	call   800a86 <_panic>
+
+00801696 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801696:	55                   	push   %ebp
+  801697:	89 e5                	mov    %esp,%ebp
+  801699:	57                   	push   %edi
+  80169a:	56                   	push   %esi
+  80169b:	53                   	push   %ebx
+  80169c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80169f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8016aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016ad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016b0:	8b 75 18             	mov    0x18(%ebp),%esi
+  8016b3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016b5:	85 c0                	test   %eax,%eax
+  8016b7:	7f 08                	jg     8016c1 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8016b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016bc:	5b                   	pop    %ebx
+  8016bd:	5e                   	pop    %esi
+  8016be:	5f                   	pop    %edi
+  8016bf:	5d                   	pop    %ebp
+  8016c0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016c1:	83 ec 0c             	sub    $0xc,%esp
+  8016c4:	50                   	push   %eax
+  8016c5:	6a 05                	push   $0x5
+  8016c7:	68 f7 4f 80 00       	push   $0x804ff7
+  8016cc:	6a 23                	push   $0x23
+  8016ce:	68 14 50 80 00       	push   $0x805014
+  8016d3:	e8 ae f3 ff ff       	call   800a86 <_panic>
+
+008016d8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8016d8:	55                   	push   %ebp
+  8016d9:	89 e5                	mov    %esp,%ebp
+  8016db:	57                   	push   %edi
+  8016dc:	56                   	push   %esi
+  8016dd:	53                   	push   %ebx
+  8016de:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8016e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ec:	b8 06 00 00 00       	mov    $0x6,%eax
+  8016f1:	89 df                	mov    %ebx,%edi
+  8016f3:	55                   	push   %ebp
+  8016f4:	89 e5                	mov    %esp,%ebp
+  8016f6:	8d 35 fe 16 80 00    	lea    0x8016fe,%esi
+  8016fc:	0f 34                	sysenter
+  8016fe:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8016ff:	85 c0                	test   %eax,%eax
+  801701:	7f 08                	jg     80170b <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  801703:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801706:	5b                   	pop    %ebx
+  801707:	5e                   	pop    %esi
+  801708:	5f                   	pop    %edi
+  801709:	5d                   	pop    %ebp
+  80170a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80170b:	83 ec 0c             	sub    $0xc,%esp
+  80170e:	50                   	push   %eax
+  80170f:	6a 06                	push   $0x6
+  801711:	68 f7 4f 80 00       	push   $0x804ff7
+  801716:	6a 3d                	push   $0x3d
+  801718:	68 14 50 80 00       	push   $0x805014
+  80171d:	e8 64 f3 ff ff       	call   800a86 <_panic>
+
+00801722 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801722:	55                   	push   %ebp
+  801723:	89 e5                	mov    %esp,%ebp
+  801725:	57                   	push   %edi
+  801726:	56                   	push   %esi
+  801727:	53                   	push   %ebx
+  801728:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80172b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801730:	8b 55 08             	mov    0x8(%ebp),%edx
+  801733:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801736:	b8 08 00 00 00       	mov    $0x8,%eax
+  80173b:	89 df                	mov    %ebx,%edi
+  80173d:	55                   	push   %ebp
+  80173e:	89 e5                	mov    %esp,%ebp
+  801740:	8d 35 48 17 80 00    	lea    0x801748,%esi
+  801746:	0f 34                	sysenter
+  801748:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801749:	85 c0                	test   %eax,%eax
+  80174b:	7f 08                	jg     801755 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  80174d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801750:	5b                   	pop    %ebx
+  801751:	5e                   	pop    %esi
+  801752:	5f                   	pop    %edi
+  801753:	5d                   	pop    %ebp
+  801754:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801755:	83 ec 0c             	sub    $0xc,%esp
+  801758:	50                   	push   %eax
+  801759:	6a 08                	push   $0x8
+  80175b:	68 f7 4f 80 00       	push   $0x804ff7
+  801760:	6a 3d                	push   $0x3d
+  801762:	68 14 50 80 00       	push   $0x805014
+  801767:	e8 1a f3 ff ff       	call   800a86 <_panic>
+
+0080176c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80176c:	55                   	push   %ebp
+  80176d:	89 e5                	mov    %esp,%ebp
+  80176f:	57                   	push   %edi
+  801770:	56                   	push   %esi
+  801771:	53                   	push   %ebx
+  801772:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801775:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80177a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801780:	b8 09 00 00 00       	mov    $0x9,%eax
+  801785:	89 df                	mov    %ebx,%edi
+  801787:	55                   	push   %ebp
+  801788:	89 e5                	mov    %esp,%ebp
+  80178a:	8d 35 92 17 80 00    	lea    0x801792,%esi
+  801790:	0f 34                	sysenter
+  801792:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801793:	85 c0                	test   %eax,%eax
+  801795:	7f 08                	jg     80179f <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  801797:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80179a:	5b                   	pop    %ebx
+  80179b:	5e                   	pop    %esi
+  80179c:	5f                   	pop    %edi
+  80179d:	5d                   	pop    %ebp
+  80179e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80179f:	83 ec 0c             	sub    $0xc,%esp
+  8017a2:	50                   	push   %eax
+  8017a3:	6a 09                	push   $0x9
+  8017a5:	68 f7 4f 80 00       	push   $0x804ff7
+  8017aa:	6a 3d                	push   $0x3d
+  8017ac:	68 14 50 80 00       	push   $0x805014
+  8017b1:	e8 d0 f2 ff ff       	call   800a86 <_panic>
+
+008017b6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8017b6:	55                   	push   %ebp
+  8017b7:	89 e5                	mov    %esp,%ebp
+  8017b9:	57                   	push   %edi
+  8017ba:	56                   	push   %esi
+  8017bb:	53                   	push   %ebx
+  8017bc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8017bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8017cf:	89 df                	mov    %ebx,%edi
+  8017d1:	55                   	push   %ebp
+  8017d2:	89 e5                	mov    %esp,%ebp
+  8017d4:	8d 35 dc 17 80 00    	lea    0x8017dc,%esi
+  8017da:	0f 34                	sysenter
+  8017dc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8017dd:	85 c0                	test   %eax,%eax
+  8017df:	7f 08                	jg     8017e9 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  8017e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017e4:	5b                   	pop    %ebx
+  8017e5:	5e                   	pop    %esi
+  8017e6:	5f                   	pop    %edi
+  8017e7:	5d                   	pop    %ebp
+  8017e8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017e9:	83 ec 0c             	sub    $0xc,%esp
+  8017ec:	50                   	push   %eax
+  8017ed:	6a 0a                	push   $0xa
+  8017ef:	68 f7 4f 80 00       	push   $0x804ff7
+  8017f4:	6a 3d                	push   $0x3d
+  8017f6:	68 14 50 80 00       	push   $0x805014
+  8017fb:	e8 86 f2 ff ff       	call   800a86 <_panic>
+
+00801800 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801800:	55                   	push   %ebp
+  801801:	89 e5                	mov    %esp,%ebp
+  801803:	57                   	push   %edi
+  801804:	56                   	push   %esi
+  801805:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801806:	8b 55 08             	mov    0x8(%ebp),%edx
+  801809:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80180c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801811:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801814:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801817:	55                   	push   %ebp
+  801818:	89 e5                	mov    %esp,%ebp
+  80181a:	8d 35 22 18 80 00    	lea    0x801822,%esi
+  801820:	0f 34                	sysenter
+  801822:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  801823:	5b                   	pop    %ebx
+  801824:	5e                   	pop    %esi
+  801825:	5f                   	pop    %edi
+  801826:	5d                   	pop    %ebp
+  801827:	c3                   	ret
+
+00801828 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  801828:	55                   	push   %ebp
+  801829:	89 e5                	mov    %esp,%ebp
+  80182b:	57                   	push   %edi
+  80182c:	56                   	push   %esi
+  80182d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80182e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801831:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801834:	b8 17 00 00 00       	mov    $0x17,%eax
+  801839:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80183c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80183f:	55                   	push   %ebp
+  801840:	89 e5                	mov    %esp,%ebp
+  801842:	8d 35 4a 18 80 00    	lea    0x80184a,%esi
+  801848:	0f 34                	sysenter
+  80184a:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  80184b:	5b                   	pop    %ebx
+  80184c:	5e                   	pop    %esi
+  80184d:	5f                   	pop    %edi
+  80184e:	5d                   	pop    %ebp
+  80184f:	c3                   	ret
+
+00801850 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  801850:	55                   	push   %ebp
+  801851:	89 e5                	mov    %esp,%ebp
+  801853:	57                   	push   %edi
+  801854:	56                   	push   %esi
+  801855:	53                   	push   %ebx
+  801856:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801859:	be 00 00 00 00       	mov    $0x0,%esi
+  80185e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801861:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801864:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801869:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80186c:	89 f7                	mov    %esi,%edi
+  80186e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801870:	85 c0                	test   %eax,%eax
+  801872:	7f 08                	jg     80187c <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  801874:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801877:	5b                   	pop    %ebx
+  801878:	5e                   	pop    %esi
+  801879:	5f                   	pop    %edi
+  80187a:	5d                   	pop    %ebp
+  80187b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80187c:	83 ec 0c             	sub    $0xc,%esp
+  80187f:	50                   	push   %eax
+  801880:	6a 0d                	push   $0xd
+  801882:	68 f7 4f 80 00       	push   $0x804ff7
+  801887:	6a 23                	push   $0x23
+  801889:	68 14 50 80 00       	push   $0x805014
+  80188e:	e8 f3 f1 ff ff       	call   800a86 <_panic>
+
+00801893 <sys_ipc_recv>:
+{
+  801893:	55                   	push   %ebp
+  801894:	89 e5                	mov    %esp,%ebp
+  801896:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  801899:	6a 00                	push   $0x0
+  80189b:	6a 01                	push   $0x1
+  80189d:	ff 75 08             	push   0x8(%ebp)
+  8018a0:	e8 ab ff ff ff       	call   801850 <sys_ipc_recvv>
+}
+  8018a5:	c9                   	leave
+  8018a6:	c3                   	ret
+
+008018a7 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  8018a7:	55                   	push   %ebp
+  8018a8:	89 e5                	mov    %esp,%ebp
+  8018aa:	57                   	push   %edi
+  8018ab:	56                   	push   %esi
+  8018ac:	53                   	push   %ebx
+  8018ad:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8018b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018bb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8018c0:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8018c3:	89 de                	mov    %ebx,%esi
+  8018c5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018c7:	85 c0                	test   %eax,%eax
+  8018c9:	7f 08                	jg     8018d3 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  8018cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ce:	5b                   	pop    %ebx
+  8018cf:	5e                   	pop    %esi
+  8018d0:	5f                   	pop    %edi
+  8018d1:	5d                   	pop    %ebp
+  8018d2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018d3:	83 ec 0c             	sub    $0xc,%esp
+  8018d6:	50                   	push   %eax
+  8018d7:	6a 0d                	push   $0xd
+  8018d9:	68 f7 4f 80 00       	push   $0x804ff7
+  8018de:	6a 23                	push   $0x23
+  8018e0:	68 14 50 80 00       	push   $0x805014
+  8018e5:	e8 9c f1 ff ff       	call   800a86 <_panic>
+
+008018ea <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8018ea:	55                   	push   %ebp
+  8018eb:	89 e5                	mov    %esp,%ebp
+  8018ed:	57                   	push   %edi
+  8018ee:	56                   	push   %esi
+  8018ef:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8018f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8018fa:	89 d1                	mov    %edx,%ecx
+  8018fc:	89 d3                	mov    %edx,%ebx
+  8018fe:	89 d7                	mov    %edx,%edi
+  801900:	55                   	push   %ebp
+  801901:	89 e5                	mov    %esp,%ebp
+  801903:	8d 35 0b 19 80 00    	lea    0x80190b,%esi
+  801909:	0f 34                	sysenter
+  80190b:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  80190c:	5b                   	pop    %ebx
+  80190d:	5e                   	pop    %esi
+  80190e:	5f                   	pop    %edi
+  80190f:	5d                   	pop    %ebp
+  801910:	c3                   	ret
+
+00801911 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  801911:	55                   	push   %ebp
+  801912:	89 e5                	mov    %esp,%ebp
+  801914:	57                   	push   %edi
+  801915:	56                   	push   %esi
+  801916:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801917:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80191c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80191f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801922:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801927:	89 df                	mov    %ebx,%edi
+  801929:	55                   	push   %ebp
+  80192a:	89 e5                	mov    %esp,%ebp
+  80192c:	8d 35 34 19 80 00    	lea    0x801934,%esi
+  801932:	0f 34                	sysenter
+  801934:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  801935:	5b                   	pop    %ebx
+  801936:	5e                   	pop    %esi
+  801937:	5f                   	pop    %edi
+  801938:	5d                   	pop    %ebp
+  801939:	c3                   	ret
+
+0080193a <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  80193a:	55                   	push   %ebp
+  80193b:	89 e5                	mov    %esp,%ebp
+  80193d:	57                   	push   %edi
+  80193e:	56                   	push   %esi
+  80193f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801940:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801945:	8b 55 08             	mov    0x8(%ebp),%edx
+  801948:	b8 10 00 00 00       	mov    $0x10,%eax
+  80194d:	89 cb                	mov    %ecx,%ebx
+  80194f:	89 cf                	mov    %ecx,%edi
+  801951:	55                   	push   %ebp
+  801952:	89 e5                	mov    %esp,%ebp
+  801954:	8d 35 5c 19 80 00    	lea    0x80195c,%esi
+  80195a:	0f 34                	sysenter
+  80195c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  80195d:	5b                   	pop    %ebx
+  80195e:	5e                   	pop    %esi
+  80195f:	5f                   	pop    %edi
+  801960:	5d                   	pop    %ebp
+  801961:	c3                   	ret
+
+00801962 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  801962:	55                   	push   %ebp
+  801963:	89 e5                	mov    %esp,%ebp
+  801965:	57                   	push   %edi
+  801966:	56                   	push   %esi
+  801967:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801968:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801970:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801973:	b8 12 00 00 00       	mov    $0x12,%eax
+  801978:	89 df                	mov    %ebx,%edi
+  80197a:	55                   	push   %ebp
+  80197b:	89 e5                	mov    %esp,%ebp
+  80197d:	8d 35 85 19 80 00    	lea    0x801985,%esi
+  801983:	0f 34                	sysenter
+  801985:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  801986:	5b                   	pop    %ebx
+  801987:	5e                   	pop    %esi
+  801988:	5f                   	pop    %edi
+  801989:	5d                   	pop    %ebp
+  80198a:	c3                   	ret
+
+0080198b <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  80198b:	55                   	push   %ebp
+  80198c:	89 e5                	mov    %esp,%ebp
+  80198e:	57                   	push   %edi
+  80198f:	56                   	push   %esi
+  801990:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801991:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801996:	8b 55 08             	mov    0x8(%ebp),%edx
+  801999:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80199c:	b8 14 00 00 00       	mov    $0x14,%eax
+  8019a1:	89 df                	mov    %ebx,%edi
+  8019a3:	55                   	push   %ebp
+  8019a4:	89 e5                	mov    %esp,%ebp
+  8019a6:	8d 35 ae 19 80 00    	lea    0x8019ae,%esi
+  8019ac:	0f 34                	sysenter
+  8019ae:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  8019af:	5b                   	pop    %ebx
+  8019b0:	5e                   	pop    %esi
+  8019b1:	5f                   	pop    %edi
+  8019b2:	5d                   	pop    %ebp
+  8019b3:	c3                   	ret
+
+008019b4 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  8019b4:	55                   	push   %ebp
+  8019b5:	89 e5                	mov    %esp,%ebp
+  8019b7:	57                   	push   %edi
+  8019b8:	56                   	push   %esi
+  8019b9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8019ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019c0:	b8 13 00 00 00       	mov    $0x13,%eax
+  8019c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019c8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019cb:	55                   	push   %ebp
+  8019cc:	89 e5                	mov    %esp,%ebp
+  8019ce:	8d 35 d6 19 80 00    	lea    0x8019d6,%esi
+  8019d4:	0f 34                	sysenter
+  8019d6:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  8019d7:	5b                   	pop    %ebx
+  8019d8:	5e                   	pop    %esi
+  8019d9:	5f                   	pop    %edi
+  8019da:	5d                   	pop    %ebp
+  8019db:	c3                   	ret
+
+008019dc <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  8019dc:	55                   	push   %ebp
+  8019dd:	89 e5                	mov    %esp,%ebp
+  8019df:	57                   	push   %edi
+  8019e0:	56                   	push   %esi
+  8019e1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8019e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ea:	b8 11 00 00 00       	mov    $0x11,%eax
+  8019ef:	89 cb                	mov    %ecx,%ebx
+  8019f1:	89 cf                	mov    %ecx,%edi
+  8019f3:	89 ce                	mov    %ecx,%esi
+  8019f5:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  8019f7:	5b                   	pop    %ebx
+  8019f8:	5e                   	pop    %esi
+  8019f9:	5f                   	pop    %edi
+  8019fa:	5d                   	pop    %ebp
+  8019fb:	c3                   	ret
+
+008019fc <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  8019fc:	55                   	push   %ebp
+  8019fd:	89 e5                	mov    %esp,%ebp
+  8019ff:	57                   	push   %edi
+  801a00:	56                   	push   %esi
+  801a01:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801a02:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a07:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a0a:	b8 15 00 00 00       	mov    $0x15,%eax
+  801a0f:	89 cb                	mov    %ecx,%ebx
+  801a11:	89 cf                	mov    %ecx,%edi
+  801a13:	55                   	push   %ebp
+  801a14:	89 e5                	mov    %esp,%ebp
+  801a16:	8d 35 1e 1a 80 00    	lea    0x801a1e,%esi
+  801a1c:	0f 34                	sysenter
+  801a1e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  801a1f:	5b                   	pop    %ebx
+  801a20:	5e                   	pop    %esi
+  801a21:	5f                   	pop    %edi
+  801a22:	5d                   	pop    %ebp
+  801a23:	c3                   	ret
+
+00801a24 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  801a24:	55                   	push   %ebp
+  801a25:	89 e5                	mov    %esp,%ebp
+  801a27:	57                   	push   %edi
+  801a28:	56                   	push   %esi
+  801a29:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801a2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a32:	b8 16 00 00 00       	mov    $0x16,%eax
+  801a37:	89 cb                	mov    %ecx,%ebx
+  801a39:	89 cf                	mov    %ecx,%edi
+  801a3b:	55                   	push   %ebp
+  801a3c:	89 e5                	mov    %esp,%ebp
+  801a3e:	8d 35 46 1a 80 00    	lea    0x801a46,%esi
+  801a44:	0f 34                	sysenter
+  801a46:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  801a47:	5b                   	pop    %ebx
+  801a48:	5e                   	pop    %esi
+  801a49:	5f                   	pop    %edi
+  801a4a:	5d                   	pop    %ebp
+  801a4b:	c3                   	ret
+
+00801a4c <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  801a4c:	55                   	push   %ebp
+  801a4d:	89 e5                	mov    %esp,%ebp
+  801a4f:	57                   	push   %edi
+  801a50:	56                   	push   %esi
+  801a51:	53                   	push   %ebx
+  801a52:	83 ec 20             	sub    $0x20,%esp
+  801a55:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a58:	89 d7                	mov    %edx,%edi
+  801a5a:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  801a5c:	51                   	push   %ecx
+  801a5d:	68 00 f0 7f 00       	push   $0x7ff000
+  801a62:	6a 00                	push   $0x0
+  801a64:	e8 e2 fb ff ff       	call   80164b <sys_page_alloc>
+  801a69:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801a6b:	83 c4 10             	add    $0x10,%esp
+  801a6e:	85 c0                	test   %eax,%eax
+  801a70:	78 45                	js     801ab7 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  801a72:	83 ec 04             	sub    $0x4,%esp
+  801a75:	68 00 10 00 00       	push   $0x1000
+  801a7a:	57                   	push   %edi
+  801a7b:	68 00 f0 7f 00       	push   $0x7ff000
+  801a80:	e8 40 f9 ff ff       	call   8013c5 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  801a85:	89 34 24             	mov    %esi,(%esp)
+  801a88:	57                   	push   %edi
+  801a89:	ff 75 e4             	push   -0x1c(%ebp)
+  801a8c:	68 00 f0 7f 00       	push   $0x7ff000
+  801a91:	6a 00                	push   $0x0
+  801a93:	e8 fe fb ff ff       	call   801696 <sys_page_map>
+  801a98:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801a9a:	83 c4 20             	add    $0x20,%esp
+  801a9d:	85 c0                	test   %eax,%eax
+  801a9f:	78 16                	js     801ab7 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801aa1:	83 ec 08             	sub    $0x8,%esp
+  801aa4:	68 00 f0 7f 00       	push   $0x7ff000
+  801aa9:	6a 00                	push   $0x0
+  801aab:	e8 28 fc ff ff       	call   8016d8 <sys_page_unmap>
+  801ab0:	83 c4 10             	add    $0x10,%esp
+  801ab3:	85 c0                	test   %eax,%eax
+  801ab5:	75 0a                	jne    801ac1 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  801ab7:	89 d8                	mov    %ebx,%eax
+  801ab9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801abc:	5b                   	pop    %ebx
+  801abd:	5e                   	pop    %esi
+  801abe:	5f                   	pop    %edi
+  801abf:	5d                   	pop    %ebp
+  801ac0:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801ac1:	68 24 50 80 00       	push   $0x805024
+  801ac6:	68 d3 4b 80 00       	push   $0x804bd3
+  801acb:	6a 1b                	push   $0x1b
+  801acd:	68 9c 50 80 00       	push   $0x80509c
+  801ad2:	e8 af ef ff ff       	call   800a86 <_panic>
+
+00801ad7 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801ad7:	55                   	push   %ebp
+  801ad8:	89 e5                	mov    %esp,%ebp
+  801ada:	53                   	push   %ebx
+  801adb:	83 ec 04             	sub    $0x4,%esp
+  801ade:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  801ae1:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  801ae3:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  801ae7:	74 21                	je     801b0a <pgfault+0x33>
+  801ae9:	89 d0                	mov    %edx,%eax
+  801aeb:	c1 e8 16             	shr    $0x16,%eax
+  801aee:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801af5:	a8 01                	test   $0x1,%al
+  801af7:	74 11                	je     801b0a <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  801af9:	89 d0                	mov    %edx,%eax
+  801afb:	c1 e8 0c             	shr    $0xc,%eax
+  801afe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b05:	f6 c4 08             	test   $0x8,%ah
+  801b08:	75 17                	jne    801b21 <pgfault+0x4a>
+		if (pgfault_next) {
+  801b0a:	a1 20 74 80 00       	mov    0x807420,%eax
+  801b0f:	85 c0                	test   %eax,%eax
+  801b11:	74 27                	je     801b3a <pgfault+0x63>
+			pgfault_next(utf);
+  801b13:	83 ec 0c             	sub    $0xc,%esp
+  801b16:	53                   	push   %ebx
+  801b17:	ff d0                	call   *%eax
+			return;
+  801b19:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  801b1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b1f:	c9                   	leave
+  801b20:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  801b21:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  801b27:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b31:	e8 16 ff ff ff       	call   801a4c <copy_page_to>
+  801b36:	85 c0                	test   %eax,%eax
+  801b38:	79 e2                	jns    801b1c <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  801b3a:	a1 14 70 80 00       	mov    0x807014,%eax
+  801b3f:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  801b42:	ff 73 28             	push   0x28(%ebx)
+  801b45:	ff 33                	push   (%ebx)
+  801b47:	50                   	push   %eax
+  801b48:	68 48 50 80 00       	push   $0x805048
+  801b4d:	e8 0f f0 ff ff       	call   800b61 <cprintf>
+	sys_env_destroy(0);
+  801b52:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801b59:	e8 5e fa ff ff       	call   8015bc <sys_env_destroy>
+  801b5e:	83 c4 10             	add    $0x10,%esp
+  801b61:	eb b9                	jmp    801b1c <pgfault+0x45>
+
+00801b63 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  801b63:	55                   	push   %ebp
+  801b64:	89 e5                	mov    %esp,%ebp
+  801b66:	53                   	push   %ebx
+  801b67:	83 ec 04             	sub    $0x4,%esp
+  801b6a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  801b6d:	a1 04 b0 80 00       	mov    0x80b004,%eax
+  801b72:	3d d7 1a 80 00       	cmp    $0x801ad7,%eax
+  801b77:	74 15                	je     801b8e <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  801b79:	a3 20 74 80 00       	mov    %eax,0x807420
+		set_pgfault_handler(pgfault);
+  801b7e:	83 ec 0c             	sub    $0xc,%esp
+  801b81:	68 d7 1a 80 00       	push   $0x801ad7
+  801b86:	e8 e9 29 00 00       	call   804574 <set_pgfault_handler>
+  801b8b:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801b8e:	83 ec 0c             	sub    $0xc,%esp
+  801b91:	68 05 08 00 00       	push   $0x805
+  801b96:	53                   	push   %ebx
+  801b97:	6a 00                	push   $0x0
+  801b99:	53                   	push   %ebx
+  801b9a:	6a 00                	push   $0x0
+  801b9c:	e8 f5 fa ff ff       	call   801696 <sys_page_map>
+}
+  801ba1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ba4:	c9                   	leave
+  801ba5:	c3                   	ret
+
+00801ba6 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801ba6:	55                   	push   %ebp
+  801ba7:	89 e5                	mov    %esp,%ebp
+  801ba9:	57                   	push   %edi
+  801baa:	56                   	push   %esi
+  801bab:	53                   	push   %ebx
+  801bac:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801baf:	68 d7 1a 80 00       	push   $0x801ad7
+  801bb4:	e8 bb 29 00 00       	call   804574 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801bb9:	b8 07 00 00 00       	mov    $0x7,%eax
+  801bbe:	cd 30                	int    $0x30
+  801bc0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801bc3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  801bc6:	83 c4 10             	add    $0x10,%esp
+  801bc9:	85 c0                	test   %eax,%eax
+  801bcb:	0f 88 6b 01 00 00    	js     801d3c <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801bd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  801bd6:	75 37                	jne    801c0f <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801bd8:	e8 28 fa ff ff       	call   801605 <sys_getenvid>
+  801bdd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801be2:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  801be8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801bed:	a3 14 70 80 00       	mov    %eax,0x807014
+		return 0;
+  801bf2:	e9 45 01 00 00       	jmp    801d3c <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  801bf7:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801bfd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c03:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801c09:	0f 87 ba 00 00 00    	ja     801cc9 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  801c0f:	89 d8                	mov    %ebx,%eax
+  801c11:	c1 e8 16             	shr    $0x16,%eax
+  801c14:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c1b:	a8 01                	test   $0x1,%al
+  801c1d:	74 d8                	je     801bf7 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  801c1f:	89 d8                	mov    %ebx,%eax
+  801c21:	c1 e8 0c             	shr    $0xc,%eax
+  801c24:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c2b:	f6 c2 01             	test   $0x1,%dl
+  801c2e:	74 cd                	je     801bfd <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  801c30:	89 da                	mov    %ebx,%edx
+  801c32:	80 e6 df             	and    $0xdf,%dh
+  801c35:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  801c3b:	74 c0                	je     801bfd <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  801c3d:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801c3f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c46:	f6 c6 04             	test   $0x4,%dh
+  801c49:	75 53                	jne    801c9e <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  801c4b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801c52:	f6 c6 08             	test   $0x8,%dh
+  801c55:	75 0c                	jne    801c63 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  801c57:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c5e:	f6 c2 02             	test   $0x2,%dl
+  801c61:	74 3b                	je     801c9e <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  801c63:	83 ec 0c             	sub    $0xc,%esp
+  801c66:	68 05 08 00 00       	push   $0x805
+  801c6b:	57                   	push   %edi
+  801c6c:	ff 75 e4             	push   -0x1c(%ebp)
+  801c6f:	57                   	push   %edi
+  801c70:	6a 00                	push   $0x0
+  801c72:	e8 1f fa ff ff       	call   801696 <sys_page_map>
+  801c77:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801c79:	83 c4 20             	add    $0x20,%esp
+  801c7c:	85 c0                	test   %eax,%eax
+  801c7e:	0f 88 a7 00 00 00    	js     801d2b <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801c84:	83 ec 0c             	sub    $0xc,%esp
+  801c87:	68 05 08 00 00       	push   $0x805
+  801c8c:	57                   	push   %edi
+  801c8d:	6a 00                	push   $0x0
+  801c8f:	57                   	push   %edi
+  801c90:	6a 00                	push   $0x0
+  801c92:	e8 ff f9 ff ff       	call   801696 <sys_page_map>
+  801c97:	89 c6                	mov    %eax,%esi
+	return r;
+  801c99:	83 c4 20             	add    $0x20,%esp
+  801c9c:	eb 21                	jmp    801cbf <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  801c9e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ca5:	83 ec 0c             	sub    $0xc,%esp
+  801ca8:	25 07 0e 00 00       	and    $0xe07,%eax
+  801cad:	50                   	push   %eax
+  801cae:	57                   	push   %edi
+  801caf:	ff 75 e4             	push   -0x1c(%ebp)
+  801cb2:	57                   	push   %edi
+  801cb3:	6a 00                	push   $0x0
+  801cb5:	e8 dc f9 ff ff       	call   801696 <sys_page_map>
+  801cba:	89 c6                	mov    %eax,%esi
+  801cbc:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  801cbf:	85 f6                	test   %esi,%esi
+  801cc1:	0f 89 36 ff ff ff    	jns    801bfd <fork+0x57>
+  801cc7:	eb 62                	jmp    801d2b <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801cc9:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801cce:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  801cd3:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801cd6:	89 f8                	mov    %edi,%eax
+  801cd8:	e8 6f fd ff ff       	call   801a4c <copy_page_to>
+  801cdd:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801cdf:	85 c0                	test   %eax,%eax
+  801ce1:	78 48                	js     801d2b <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801ce3:	83 ec 04             	sub    $0x4,%esp
+  801ce6:	6a 07                	push   $0x7
+  801ce8:	68 00 f0 bf ee       	push   $0xeebff000
+  801ced:	57                   	push   %edi
+  801cee:	e8 58 f9 ff ff       	call   80164b <sys_page_alloc>
+  801cf3:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801cf5:	83 c4 10             	add    $0x10,%esp
+  801cf8:	85 c0                	test   %eax,%eax
+  801cfa:	78 2f                	js     801d2b <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801cfc:	a1 14 70 80 00       	mov    0x807014,%eax
+  801d01:	8b 40 64             	mov    0x64(%eax),%eax
+  801d04:	83 ec 08             	sub    $0x8,%esp
+  801d07:	50                   	push   %eax
+  801d08:	57                   	push   %edi
+  801d09:	e8 a8 fa ff ff       	call   8017b6 <sys_env_set_pgfault_upcall>
+  801d0e:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801d10:	83 c4 10             	add    $0x10,%esp
+  801d13:	85 c0                	test   %eax,%eax
+  801d15:	78 14                	js     801d2b <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  801d17:	83 ec 08             	sub    $0x8,%esp
+  801d1a:	6a 02                	push   $0x2
+  801d1c:	57                   	push   %edi
+  801d1d:	e8 00 fa ff ff       	call   801722 <sys_env_set_status>
+  801d22:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801d24:	83 c4 10             	add    $0x10,%esp
+  801d27:	85 c0                	test   %eax,%eax
+  801d29:	79 11                	jns    801d3c <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  801d2b:	83 ec 0c             	sub    $0xc,%esp
+  801d2e:	ff 75 e0             	push   -0x20(%ebp)
+  801d31:	e8 86 f8 ff ff       	call   8015bc <sys_env_destroy>
+	return r;
+  801d36:	83 c4 10             	add    $0x10,%esp
+  801d39:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  801d3c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d42:	5b                   	pop    %ebx
+  801d43:	5e                   	pop    %esi
+  801d44:	5f                   	pop    %edi
+  801d45:	5d                   	pop    %ebp
+  801d46:	c3                   	ret
+
+00801d47 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801d47:	55                   	push   %ebp
+  801d48:	89 e5                	mov    %esp,%ebp
+  801d4a:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801d4d:	68 a7 50 80 00       	push   $0x8050a7
+  801d52:	68 bf 00 00 00       	push   $0xbf
+  801d57:	68 9c 50 80 00       	push   $0x80509c
+  801d5c:	e8 25 ed ff ff       	call   800a86 <_panic>
+
+00801d61 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  801d61:	55                   	push   %ebp
+  801d62:	89 e5                	mov    %esp,%ebp
+  801d64:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d6a:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  801d6d:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  801d6f:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  801d72:	83 3a 01             	cmpl   $0x1,(%edx)
+  801d75:	7e 09                	jle    801d80 <argstart+0x1f>
+  801d77:	ba a1 4a 80 00       	mov    $0x804aa1,%edx
+  801d7c:	85 c9                	test   %ecx,%ecx
+  801d7e:	75 05                	jne    801d85 <argstart+0x24>
+  801d80:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d85:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  801d88:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  801d8f:	5d                   	pop    %ebp
+  801d90:	c3                   	ret
+
+00801d91 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  801d91:	55                   	push   %ebp
+  801d92:	89 e5                	mov    %esp,%ebp
+  801d94:	53                   	push   %ebx
+  801d95:	83 ec 04             	sub    $0x4,%esp
+  801d98:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  801d9b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  801da2:	8b 43 08             	mov    0x8(%ebx),%eax
+  801da5:	85 c0                	test   %eax,%eax
+  801da7:	74 74                	je     801e1d <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  801da9:	80 38 00             	cmpb   $0x0,(%eax)
+  801dac:	75 48                	jne    801df6 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  801dae:	8b 0b                	mov    (%ebx),%ecx
+  801db0:	83 39 01             	cmpl   $0x1,(%ecx)
+  801db3:	74 5a                	je     801e0f <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  801db5:	8b 53 04             	mov    0x4(%ebx),%edx
+  801db8:	8b 42 04             	mov    0x4(%edx),%eax
+  801dbb:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801dbe:	75 4f                	jne    801e0f <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  801dc0:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801dc4:	74 49                	je     801e0f <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  801dc6:	83 c0 01             	add    $0x1,%eax
+  801dc9:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801dcc:	83 ec 04             	sub    $0x4,%esp
+  801dcf:	8b 01                	mov    (%ecx),%eax
+  801dd1:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  801dd8:	50                   	push   %eax
+  801dd9:	8d 42 08             	lea    0x8(%edx),%eax
+  801ddc:	50                   	push   %eax
+  801ddd:	83 c2 04             	add    $0x4,%edx
+  801de0:	52                   	push   %edx
+  801de1:	e8 df f5 ff ff       	call   8013c5 <memmove>
+		(*args->argc)--;
+  801de6:	8b 03                	mov    (%ebx),%eax
+  801de8:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801deb:	8b 43 08             	mov    0x8(%ebx),%eax
+  801dee:	83 c4 10             	add    $0x10,%esp
+  801df1:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801df4:	74 13                	je     801e09 <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  801df6:	8b 43 08             	mov    0x8(%ebx),%eax
+  801df9:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  801dfc:	83 c0 01             	add    $0x1,%eax
+  801dff:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  801e02:	89 d0                	mov    %edx,%eax
+  801e04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e07:	c9                   	leave
+  801e08:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801e09:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801e0d:	75 e7                	jne    801df6 <argnext+0x65>
+	args->curarg = 0;
+  801e0f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  801e16:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801e1b:	eb e5                	jmp    801e02 <argnext+0x71>
+		return -1;
+  801e1d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801e22:	eb de                	jmp    801e02 <argnext+0x71>
+
+00801e24 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  801e24:	55                   	push   %ebp
+  801e25:	89 e5                	mov    %esp,%ebp
+  801e27:	53                   	push   %ebx
+  801e28:	83 ec 04             	sub    $0x4,%esp
+  801e2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  801e2e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801e31:	85 c0                	test   %eax,%eax
+  801e33:	74 12                	je     801e47 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  801e35:	80 38 00             	cmpb   $0x0,(%eax)
+  801e38:	74 12                	je     801e4c <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  801e3a:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  801e3d:	c7 43 08 a1 4a 80 00 	movl   $0x804aa1,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  801e44:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  801e47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e4a:	c9                   	leave
+  801e4b:	c3                   	ret
+	} else if (*args->argc > 1) {
+  801e4c:	8b 13                	mov    (%ebx),%edx
+  801e4e:	83 3a 01             	cmpl   $0x1,(%edx)
+  801e51:	7f 10                	jg     801e63 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  801e53:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  801e5a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801e61:	eb e1                	jmp    801e44 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  801e63:	8b 43 04             	mov    0x4(%ebx),%eax
+  801e66:	8b 48 04             	mov    0x4(%eax),%ecx
+  801e69:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801e6c:	83 ec 04             	sub    $0x4,%esp
+  801e6f:	8b 12                	mov    (%edx),%edx
+  801e71:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  801e78:	52                   	push   %edx
+  801e79:	8d 50 08             	lea    0x8(%eax),%edx
+  801e7c:	52                   	push   %edx
+  801e7d:	83 c0 04             	add    $0x4,%eax
+  801e80:	50                   	push   %eax
+  801e81:	e8 3f f5 ff ff       	call   8013c5 <memmove>
+		(*args->argc)--;
+  801e86:	8b 03                	mov    (%ebx),%eax
+  801e88:	83 28 01             	subl   $0x1,(%eax)
+  801e8b:	83 c4 10             	add    $0x10,%esp
+  801e8e:	eb b4                	jmp    801e44 <argnextvalue+0x20>
+
+00801e90 <argvalue>:
+{
+  801e90:	55                   	push   %ebp
+  801e91:	89 e5                	mov    %esp,%ebp
+  801e93:	83 ec 08             	sub    $0x8,%esp
+  801e96:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801e99:	8b 42 0c             	mov    0xc(%edx),%eax
+  801e9c:	85 c0                	test   %eax,%eax
+  801e9e:	74 02                	je     801ea2 <argvalue+0x12>
+}
+  801ea0:	c9                   	leave
+  801ea1:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801ea2:	83 ec 0c             	sub    $0xc,%esp
+  801ea5:	52                   	push   %edx
+  801ea6:	e8 79 ff ff ff       	call   801e24 <argnextvalue>
+  801eab:	83 c4 10             	add    $0x10,%esp
+  801eae:	eb f0                	jmp    801ea0 <argvalue+0x10>
+
+00801eb0 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801eb0:	55                   	push   %ebp
+  801eb1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801eb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb6:	05 00 00 00 30       	add    $0x30000000,%eax
+  801ebb:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801ebe:	5d                   	pop    %ebp
+  801ebf:	c3                   	ret
+
+00801ec0 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801ec0:	55                   	push   %ebp
+  801ec1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ec3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec6:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801ecb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ed0:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801ed5:	5d                   	pop    %ebp
+  801ed6:	c3                   	ret
+
+00801ed7 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801ed7:	55                   	push   %ebp
+  801ed8:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801eda:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801edf:	eb 02                	jmp    801ee3 <fd_alloc+0xc>
+  801ee1:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801ee3:	89 c2                	mov    %eax,%edx
+  801ee5:	c1 ea 16             	shr    $0x16,%edx
+  801ee8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801eef:	f6 c2 01             	test   $0x1,%dl
+  801ef2:	74 2b                	je     801f1f <fd_alloc+0x48>
+  801ef4:	89 c2                	mov    %eax,%edx
+  801ef6:	c1 ea 0c             	shr    $0xc,%edx
+  801ef9:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801f00:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801f06:	f6 c1 01             	test   $0x1,%cl
+  801f09:	74 14                	je     801f1f <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801f0b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801f11:	75 ce                	jne    801ee1 <fd_alloc+0xa>
+  801f13:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801f18:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801f1d:	eb 05                	jmp    801f24 <fd_alloc+0x4d>
+			return 0;
+  801f1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801f24:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f27:	89 02                	mov    %eax,(%edx)
+}
+  801f29:	89 c8                	mov    %ecx,%eax
+  801f2b:	5d                   	pop    %ebp
+  801f2c:	c3                   	ret
+
+00801f2d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801f2d:	55                   	push   %ebp
+  801f2e:	89 e5                	mov    %esp,%ebp
+  801f30:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801f33:	83 f8 1f             	cmp    $0x1f,%eax
+  801f36:	77 30                	ja     801f68 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801f38:	c1 e0 0c             	shl    $0xc,%eax
+  801f3b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801f40:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801f46:	f6 c2 01             	test   $0x1,%dl
+  801f49:	74 24                	je     801f6f <fd_lookup+0x42>
+  801f4b:	89 c2                	mov    %eax,%edx
+  801f4d:	c1 ea 0c             	shr    $0xc,%edx
+  801f50:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801f57:	f6 c2 01             	test   $0x1,%dl
+  801f5a:	74 1a                	je     801f76 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801f5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f5f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801f61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f66:	5d                   	pop    %ebp
+  801f67:	c3                   	ret
+		return -E_INVAL;
+  801f68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f6d:	eb f7                	jmp    801f66 <fd_lookup+0x39>
+		return -E_INVAL;
+  801f6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f74:	eb f0                	jmp    801f66 <fd_lookup+0x39>
+  801f76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f7b:	eb e9                	jmp    801f66 <fd_lookup+0x39>
+
+00801f7d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801f7d:	55                   	push   %ebp
+  801f7e:	89 e5                	mov    %esp,%ebp
+  801f80:	53                   	push   %ebx
+  801f81:	83 ec 04             	sub    $0x4,%esp
+  801f84:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801f87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f8c:	eb 03                	jmp    801f91 <dev_lookup+0x14>
+  801f8e:	83 c0 01             	add    $0x1,%eax
+  801f91:	8b 1c 85 3c 51 80 00 	mov    0x80513c(,%eax,4),%ebx
+  801f98:	85 db                	test   %ebx,%ebx
+  801f9a:	74 0b                	je     801fa7 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801f9c:	39 13                	cmp    %edx,(%ebx)
+  801f9e:	75 ee                	jne    801f8e <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa5:	eb 1f                	jmp    801fc6 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801fa7:	a1 14 70 80 00       	mov    0x807014,%eax
+  801fac:	8b 40 48             	mov    0x48(%eax),%eax
+  801faf:	83 ec 04             	sub    $0x4,%esp
+  801fb2:	52                   	push   %edx
+  801fb3:	50                   	push   %eax
+  801fb4:	68 c0 50 80 00       	push   $0x8050c0
+  801fb9:	e8 a3 eb ff ff       	call   800b61 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801fbe:	83 c4 10             	add    $0x10,%esp
+  801fc1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801fc6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fc9:	89 1a                	mov    %ebx,(%edx)
+}
+  801fcb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fce:	c9                   	leave
+  801fcf:	c3                   	ret
+
+00801fd0 <fd_close>:
+{
+  801fd0:	55                   	push   %ebp
+  801fd1:	89 e5                	mov    %esp,%ebp
+  801fd3:	57                   	push   %edi
+  801fd4:	56                   	push   %esi
+  801fd5:	53                   	push   %ebx
+  801fd6:	83 ec 24             	sub    $0x24,%esp
+  801fd9:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fdc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801fdf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fe2:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801fe3:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801fe9:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801fec:	50                   	push   %eax
+  801fed:	e8 3b ff ff ff       	call   801f2d <fd_lookup>
+  801ff2:	89 c3                	mov    %eax,%ebx
+  801ff4:	83 c4 10             	add    $0x10,%esp
+  801ff7:	85 c0                	test   %eax,%eax
+  801ff9:	78 05                	js     802000 <fd_close+0x30>
+	    || fd != fd2)
+  801ffb:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ffe:	74 16                	je     802016 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802000:	89 f8                	mov    %edi,%eax
+  802002:	84 c0                	test   %al,%al
+  802004:	b8 00 00 00 00       	mov    $0x0,%eax
+  802009:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80200c:	89 d8                	mov    %ebx,%eax
+  80200e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802011:	5b                   	pop    %ebx
+  802012:	5e                   	pop    %esi
+  802013:	5f                   	pop    %edi
+  802014:	5d                   	pop    %ebp
+  802015:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802016:	83 ec 08             	sub    $0x8,%esp
+  802019:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80201c:	50                   	push   %eax
+  80201d:	ff 36                	push   (%esi)
+  80201f:	e8 59 ff ff ff       	call   801f7d <dev_lookup>
+  802024:	89 c3                	mov    %eax,%ebx
+  802026:	83 c4 10             	add    $0x10,%esp
+  802029:	85 c0                	test   %eax,%eax
+  80202b:	78 1a                	js     802047 <fd_close+0x77>
+		if (dev->dev_close)
+  80202d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802030:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802033:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802038:	85 c0                	test   %eax,%eax
+  80203a:	74 0b                	je     802047 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80203c:	83 ec 0c             	sub    $0xc,%esp
+  80203f:	56                   	push   %esi
+  802040:	ff d0                	call   *%eax
+  802042:	89 c3                	mov    %eax,%ebx
+  802044:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802047:	83 ec 08             	sub    $0x8,%esp
+  80204a:	56                   	push   %esi
+  80204b:	6a 00                	push   $0x0
+  80204d:	e8 86 f6 ff ff       	call   8016d8 <sys_page_unmap>
+	return r;
+  802052:	83 c4 10             	add    $0x10,%esp
+  802055:	eb b5                	jmp    80200c <fd_close+0x3c>
+
+00802057 <close>:
+
+int
+close(int fdnum)
+{
+  802057:	55                   	push   %ebp
+  802058:	89 e5                	mov    %esp,%ebp
+  80205a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80205d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802060:	50                   	push   %eax
+  802061:	ff 75 08             	push   0x8(%ebp)
+  802064:	e8 c4 fe ff ff       	call   801f2d <fd_lookup>
+  802069:	83 c4 10             	add    $0x10,%esp
+  80206c:	85 c0                	test   %eax,%eax
+  80206e:	79 02                	jns    802072 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802070:	c9                   	leave
+  802071:	c3                   	ret
+		return fd_close(fd, 1);
+  802072:	83 ec 08             	sub    $0x8,%esp
+  802075:	6a 01                	push   $0x1
+  802077:	ff 75 f4             	push   -0xc(%ebp)
+  80207a:	e8 51 ff ff ff       	call   801fd0 <fd_close>
+  80207f:	83 c4 10             	add    $0x10,%esp
+  802082:	eb ec                	jmp    802070 <close+0x19>
+
+00802084 <close_all>:
+
+void
+close_all(void)
+{
+  802084:	55                   	push   %ebp
+  802085:	89 e5                	mov    %esp,%ebp
+  802087:	53                   	push   %ebx
+  802088:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80208b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802090:	83 ec 0c             	sub    $0xc,%esp
+  802093:	53                   	push   %ebx
+  802094:	e8 be ff ff ff       	call   802057 <close>
+	for (i = 0; i < MAXFD; i++)
+  802099:	83 c3 01             	add    $0x1,%ebx
+  80209c:	83 c4 10             	add    $0x10,%esp
+  80209f:	83 fb 20             	cmp    $0x20,%ebx
+  8020a2:	75 ec                	jne    802090 <close_all+0xc>
+}
+  8020a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020a7:	c9                   	leave
+  8020a8:	c3                   	ret
+
+008020a9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8020a9:	55                   	push   %ebp
+  8020aa:	89 e5                	mov    %esp,%ebp
+  8020ac:	57                   	push   %edi
+  8020ad:	56                   	push   %esi
+  8020ae:	53                   	push   %ebx
+  8020af:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8020b2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020b5:	50                   	push   %eax
+  8020b6:	ff 75 08             	push   0x8(%ebp)
+  8020b9:	e8 6f fe ff ff       	call   801f2d <fd_lookup>
+  8020be:	89 c3                	mov    %eax,%ebx
+  8020c0:	83 c4 10             	add    $0x10,%esp
+  8020c3:	85 c0                	test   %eax,%eax
+  8020c5:	78 7f                	js     802146 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8020c7:	83 ec 0c             	sub    $0xc,%esp
+  8020ca:	ff 75 0c             	push   0xc(%ebp)
+  8020cd:	e8 85 ff ff ff       	call   802057 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8020d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8020d5:	c1 e6 0c             	shl    $0xc,%esi
+  8020d8:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8020de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8020e1:	89 3c 24             	mov    %edi,(%esp)
+  8020e4:	e8 d7 fd ff ff       	call   801ec0 <fd2data>
+  8020e9:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8020eb:	89 34 24             	mov    %esi,(%esp)
+  8020ee:	e8 cd fd ff ff       	call   801ec0 <fd2data>
+  8020f3:	83 c4 10             	add    $0x10,%esp
+  8020f6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8020f9:	89 d8                	mov    %ebx,%eax
+  8020fb:	c1 e8 16             	shr    $0x16,%eax
+  8020fe:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802105:	a8 01                	test   $0x1,%al
+  802107:	74 11                	je     80211a <dup+0x71>
+  802109:	89 d8                	mov    %ebx,%eax
+  80210b:	c1 e8 0c             	shr    $0xc,%eax
+  80210e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802115:	f6 c2 01             	test   $0x1,%dl
+  802118:	75 36                	jne    802150 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80211a:	89 f8                	mov    %edi,%eax
+  80211c:	c1 e8 0c             	shr    $0xc,%eax
+  80211f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802126:	83 ec 0c             	sub    $0xc,%esp
+  802129:	25 07 0e 00 00       	and    $0xe07,%eax
+  80212e:	50                   	push   %eax
+  80212f:	56                   	push   %esi
+  802130:	6a 00                	push   $0x0
+  802132:	57                   	push   %edi
+  802133:	6a 00                	push   $0x0
+  802135:	e8 5c f5 ff ff       	call   801696 <sys_page_map>
+  80213a:	89 c3                	mov    %eax,%ebx
+  80213c:	83 c4 20             	add    $0x20,%esp
+  80213f:	85 c0                	test   %eax,%eax
+  802141:	78 33                	js     802176 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802143:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802146:	89 d8                	mov    %ebx,%eax
+  802148:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80214b:	5b                   	pop    %ebx
+  80214c:	5e                   	pop    %esi
+  80214d:	5f                   	pop    %edi
+  80214e:	5d                   	pop    %ebp
+  80214f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802150:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802157:	83 ec 0c             	sub    $0xc,%esp
+  80215a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80215f:	50                   	push   %eax
+  802160:	ff 75 d4             	push   -0x2c(%ebp)
+  802163:	6a 00                	push   $0x0
+  802165:	53                   	push   %ebx
+  802166:	6a 00                	push   $0x0
+  802168:	e8 29 f5 ff ff       	call   801696 <sys_page_map>
+  80216d:	89 c3                	mov    %eax,%ebx
+  80216f:	83 c4 20             	add    $0x20,%esp
+  802172:	85 c0                	test   %eax,%eax
+  802174:	79 a4                	jns    80211a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802176:	83 ec 08             	sub    $0x8,%esp
+  802179:	56                   	push   %esi
+  80217a:	6a 00                	push   $0x0
+  80217c:	e8 57 f5 ff ff       	call   8016d8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802181:	83 c4 08             	add    $0x8,%esp
+  802184:	ff 75 d4             	push   -0x2c(%ebp)
+  802187:	6a 00                	push   $0x0
+  802189:	e8 4a f5 ff ff       	call   8016d8 <sys_page_unmap>
+	return r;
+  80218e:	83 c4 10             	add    $0x10,%esp
+  802191:	eb b3                	jmp    802146 <dup+0x9d>
+
+00802193 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802193:	55                   	push   %ebp
+  802194:	89 e5                	mov    %esp,%ebp
+  802196:	56                   	push   %esi
+  802197:	53                   	push   %ebx
+  802198:	83 ec 18             	sub    $0x18,%esp
+  80219b:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80219e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021a1:	50                   	push   %eax
+  8021a2:	56                   	push   %esi
+  8021a3:	e8 85 fd ff ff       	call   801f2d <fd_lookup>
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	85 c0                	test   %eax,%eax
+  8021ad:	78 3c                	js     8021eb <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8021af:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8021b2:	83 ec 08             	sub    $0x8,%esp
+  8021b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b8:	50                   	push   %eax
+  8021b9:	ff 33                	push   (%ebx)
+  8021bb:	e8 bd fd ff ff       	call   801f7d <dev_lookup>
+  8021c0:	83 c4 10             	add    $0x10,%esp
+  8021c3:	85 c0                	test   %eax,%eax
+  8021c5:	78 24                	js     8021eb <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8021c7:	8b 43 08             	mov    0x8(%ebx),%eax
+  8021ca:	83 e0 03             	and    $0x3,%eax
+  8021cd:	83 f8 01             	cmp    $0x1,%eax
+  8021d0:	74 20                	je     8021f2 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8021d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021d5:	8b 40 08             	mov    0x8(%eax),%eax
+  8021d8:	85 c0                	test   %eax,%eax
+  8021da:	74 37                	je     802213 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8021dc:	83 ec 04             	sub    $0x4,%esp
+  8021df:	ff 75 10             	push   0x10(%ebp)
+  8021e2:	ff 75 0c             	push   0xc(%ebp)
+  8021e5:	53                   	push   %ebx
+  8021e6:	ff d0                	call   *%eax
+  8021e8:	83 c4 10             	add    $0x10,%esp
+}
+  8021eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021ee:	5b                   	pop    %ebx
+  8021ef:	5e                   	pop    %esi
+  8021f0:	5d                   	pop    %ebp
+  8021f1:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021f2:	a1 14 70 80 00       	mov    0x807014,%eax
+  8021f7:	8b 40 48             	mov    0x48(%eax),%eax
+  8021fa:	83 ec 04             	sub    $0x4,%esp
+  8021fd:	56                   	push   %esi
+  8021fe:	50                   	push   %eax
+  8021ff:	68 01 51 80 00       	push   $0x805101
+  802204:	e8 58 e9 ff ff       	call   800b61 <cprintf>
+		return -E_INVAL;
+  802209:	83 c4 10             	add    $0x10,%esp
+  80220c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802211:	eb d8                	jmp    8021eb <read+0x58>
+		return -E_NOT_SUPP;
+  802213:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802218:	eb d1                	jmp    8021eb <read+0x58>
+
+0080221a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80221a:	55                   	push   %ebp
+  80221b:	89 e5                	mov    %esp,%ebp
+  80221d:	57                   	push   %edi
+  80221e:	56                   	push   %esi
+  80221f:	53                   	push   %ebx
+  802220:	83 ec 0c             	sub    $0xc,%esp
+  802223:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802226:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802229:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80222e:	eb 02                	jmp    802232 <readn+0x18>
+  802230:	01 c3                	add    %eax,%ebx
+  802232:	39 f3                	cmp    %esi,%ebx
+  802234:	73 21                	jae    802257 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802236:	83 ec 04             	sub    $0x4,%esp
+  802239:	89 f0                	mov    %esi,%eax
+  80223b:	29 d8                	sub    %ebx,%eax
+  80223d:	50                   	push   %eax
+  80223e:	89 d8                	mov    %ebx,%eax
+  802240:	03 45 0c             	add    0xc(%ebp),%eax
+  802243:	50                   	push   %eax
+  802244:	57                   	push   %edi
+  802245:	e8 49 ff ff ff       	call   802193 <read>
+		if (m < 0)
+  80224a:	83 c4 10             	add    $0x10,%esp
+  80224d:	85 c0                	test   %eax,%eax
+  80224f:	78 04                	js     802255 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802251:	75 dd                	jne    802230 <readn+0x16>
+  802253:	eb 02                	jmp    802257 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802255:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802257:	89 d8                	mov    %ebx,%eax
+  802259:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80225c:	5b                   	pop    %ebx
+  80225d:	5e                   	pop    %esi
+  80225e:	5f                   	pop    %edi
+  80225f:	5d                   	pop    %ebp
+  802260:	c3                   	ret
+
+00802261 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802261:	55                   	push   %ebp
+  802262:	89 e5                	mov    %esp,%ebp
+  802264:	56                   	push   %esi
+  802265:	53                   	push   %ebx
+  802266:	83 ec 18             	sub    $0x18,%esp
+  802269:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80226c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80226f:	50                   	push   %eax
+  802270:	53                   	push   %ebx
+  802271:	e8 b7 fc ff ff       	call   801f2d <fd_lookup>
+  802276:	83 c4 10             	add    $0x10,%esp
+  802279:	85 c0                	test   %eax,%eax
+  80227b:	78 37                	js     8022b4 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80227d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802280:	83 ec 08             	sub    $0x8,%esp
+  802283:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802286:	50                   	push   %eax
+  802287:	ff 36                	push   (%esi)
+  802289:	e8 ef fc ff ff       	call   801f7d <dev_lookup>
+  80228e:	83 c4 10             	add    $0x10,%esp
+  802291:	85 c0                	test   %eax,%eax
+  802293:	78 1f                	js     8022b4 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802295:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802299:	74 20                	je     8022bb <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80229b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80229e:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022a1:	85 c0                	test   %eax,%eax
+  8022a3:	74 37                	je     8022dc <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8022a5:	83 ec 04             	sub    $0x4,%esp
+  8022a8:	ff 75 10             	push   0x10(%ebp)
+  8022ab:	ff 75 0c             	push   0xc(%ebp)
+  8022ae:	56                   	push   %esi
+  8022af:	ff d0                	call   *%eax
+  8022b1:	83 c4 10             	add    $0x10,%esp
+}
+  8022b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022b7:	5b                   	pop    %ebx
+  8022b8:	5e                   	pop    %esi
+  8022b9:	5d                   	pop    %ebp
+  8022ba:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022bb:	a1 14 70 80 00       	mov    0x807014,%eax
+  8022c0:	8b 40 48             	mov    0x48(%eax),%eax
+  8022c3:	83 ec 04             	sub    $0x4,%esp
+  8022c6:	53                   	push   %ebx
+  8022c7:	50                   	push   %eax
+  8022c8:	68 1d 51 80 00       	push   $0x80511d
+  8022cd:	e8 8f e8 ff ff       	call   800b61 <cprintf>
+		return -E_INVAL;
+  8022d2:	83 c4 10             	add    $0x10,%esp
+  8022d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022da:	eb d8                	jmp    8022b4 <write+0x53>
+		return -E_NOT_SUPP;
+  8022dc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022e1:	eb d1                	jmp    8022b4 <write+0x53>
+
+008022e3 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8022e3:	55                   	push   %ebp
+  8022e4:	89 e5                	mov    %esp,%ebp
+  8022e6:	53                   	push   %ebx
+  8022e7:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8022ea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022ed:	50                   	push   %eax
+  8022ee:	ff 75 08             	push   0x8(%ebp)
+  8022f1:	e8 37 fc ff ff       	call   801f2d <fd_lookup>
+  8022f6:	83 c4 10             	add    $0x10,%esp
+  8022f9:	85 c0                	test   %eax,%eax
+  8022fb:	78 3a                	js     802337 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8022fd:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802300:	83 ec 08             	sub    $0x8,%esp
+  802303:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802306:	50                   	push   %eax
+  802307:	ff 33                	push   (%ebx)
+  802309:	e8 6f fc ff ff       	call   801f7d <dev_lookup>
+  80230e:	83 c4 10             	add    $0x10,%esp
+  802311:	85 c0                	test   %eax,%eax
+  802313:	78 22                	js     802337 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  802315:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802318:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80231b:	85 c0                	test   %eax,%eax
+  80231d:	74 0d                	je     80232c <seek+0x49>
+  80231f:	83 ec 0c             	sub    $0xc,%esp
+  802322:	53                   	push   %ebx
+  802323:	ff d0                	call   *%eax
+  802325:	83 c4 10             	add    $0x10,%esp
+  802328:	85 c0                	test   %eax,%eax
+  80232a:	78 0b                	js     802337 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  80232c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80232f:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  802332:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802337:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80233a:	c9                   	leave
+  80233b:	c3                   	ret
+
+0080233c <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  80233c:	55                   	push   %ebp
+  80233d:	89 e5                	mov    %esp,%ebp
+  80233f:	53                   	push   %ebx
+  802340:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802343:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802346:	50                   	push   %eax
+  802347:	ff 75 08             	push   0x8(%ebp)
+  80234a:	e8 de fb ff ff       	call   801f2d <fd_lookup>
+  80234f:	83 c4 10             	add    $0x10,%esp
+  802352:	85 c0                	test   %eax,%eax
+  802354:	78 2b                	js     802381 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802356:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802359:	83 ec 08             	sub    $0x8,%esp
+  80235c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80235f:	50                   	push   %eax
+  802360:	ff 33                	push   (%ebx)
+  802362:	e8 16 fc ff ff       	call   801f7d <dev_lookup>
+  802367:	83 c4 10             	add    $0x10,%esp
+  80236a:	85 c0                	test   %eax,%eax
+  80236c:	78 13                	js     802381 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  80236e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802371:	8b 40 1c             	mov    0x1c(%eax),%eax
+  802374:	85 c0                	test   %eax,%eax
+  802376:	74 0e                	je     802386 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  802378:	83 ec 0c             	sub    $0xc,%esp
+  80237b:	53                   	push   %ebx
+  80237c:	ff d0                	call   *%eax
+  80237e:	83 c4 10             	add    $0x10,%esp
+}
+  802381:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802384:	c9                   	leave
+  802385:	c3                   	ret
+		return 0;
+  802386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80238b:	eb f4                	jmp    802381 <fsync+0x45>
+
+0080238d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80238d:	55                   	push   %ebp
+  80238e:	89 e5                	mov    %esp,%ebp
+  802390:	56                   	push   %esi
+  802391:	53                   	push   %ebx
+  802392:	83 ec 18             	sub    $0x18,%esp
+  802395:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802398:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80239b:	50                   	push   %eax
+  80239c:	53                   	push   %ebx
+  80239d:	e8 8b fb ff ff       	call   801f2d <fd_lookup>
+  8023a2:	83 c4 10             	add    $0x10,%esp
+  8023a5:	85 c0                	test   %eax,%eax
+  8023a7:	78 34                	js     8023dd <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8023a9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8023ac:	83 ec 08             	sub    $0x8,%esp
+  8023af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023b2:	50                   	push   %eax
+  8023b3:	ff 36                	push   (%esi)
+  8023b5:	e8 c3 fb ff ff       	call   801f7d <dev_lookup>
+  8023ba:	83 c4 10             	add    $0x10,%esp
+  8023bd:	85 c0                	test   %eax,%eax
+  8023bf:	78 1c                	js     8023dd <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8023c1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8023c5:	74 1d                	je     8023e4 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8023c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023ca:	8b 40 18             	mov    0x18(%eax),%eax
+  8023cd:	85 c0                	test   %eax,%eax
+  8023cf:	74 34                	je     802405 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8023d1:	83 ec 08             	sub    $0x8,%esp
+  8023d4:	ff 75 0c             	push   0xc(%ebp)
+  8023d7:	56                   	push   %esi
+  8023d8:	ff d0                	call   *%eax
+  8023da:	83 c4 10             	add    $0x10,%esp
+}
+  8023dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023e0:	5b                   	pop    %ebx
+  8023e1:	5e                   	pop    %esi
+  8023e2:	5d                   	pop    %ebp
+  8023e3:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8023e4:	a1 14 70 80 00       	mov    0x807014,%eax
+  8023e9:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8023ec:	83 ec 04             	sub    $0x4,%esp
+  8023ef:	53                   	push   %ebx
+  8023f0:	50                   	push   %eax
+  8023f1:	68 e0 50 80 00       	push   $0x8050e0
+  8023f6:	e8 66 e7 ff ff       	call   800b61 <cprintf>
+		return -E_INVAL;
+  8023fb:	83 c4 10             	add    $0x10,%esp
+  8023fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802403:	eb d8                	jmp    8023dd <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802405:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80240a:	eb d1                	jmp    8023dd <ftruncate+0x50>
+
+0080240c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80240c:	55                   	push   %ebp
+  80240d:	89 e5                	mov    %esp,%ebp
+  80240f:	56                   	push   %esi
+  802410:	53                   	push   %ebx
+  802411:	83 ec 18             	sub    $0x18,%esp
+  802414:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802417:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80241a:	50                   	push   %eax
+  80241b:	ff 75 08             	push   0x8(%ebp)
+  80241e:	e8 0a fb ff ff       	call   801f2d <fd_lookup>
+  802423:	83 c4 10             	add    $0x10,%esp
+  802426:	85 c0                	test   %eax,%eax
+  802428:	78 49                	js     802473 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80242a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80242d:	83 ec 08             	sub    $0x8,%esp
+  802430:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802433:	50                   	push   %eax
+  802434:	ff 36                	push   (%esi)
+  802436:	e8 42 fb ff ff       	call   801f7d <dev_lookup>
+  80243b:	83 c4 10             	add    $0x10,%esp
+  80243e:	85 c0                	test   %eax,%eax
+  802440:	78 31                	js     802473 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802442:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802445:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802449:	74 2f                	je     80247a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80244b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80244e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802455:	00 00 00 
+	stat->st_isdir = 0;
+  802458:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80245f:	00 00 00 
+	stat->st_dev = dev;
+  802462:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802468:	83 ec 08             	sub    $0x8,%esp
+  80246b:	53                   	push   %ebx
+  80246c:	56                   	push   %esi
+  80246d:	ff 50 14             	call   *0x14(%eax)
+  802470:	83 c4 10             	add    $0x10,%esp
+}
+  802473:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802476:	5b                   	pop    %ebx
+  802477:	5e                   	pop    %esi
+  802478:	5d                   	pop    %ebp
+  802479:	c3                   	ret
+		return -E_NOT_SUPP;
+  80247a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80247f:	eb f2                	jmp    802473 <fstat+0x67>
+
+00802481 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802481:	55                   	push   %ebp
+  802482:	89 e5                	mov    %esp,%ebp
+  802484:	56                   	push   %esi
+  802485:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  802486:	83 ec 08             	sub    $0x8,%esp
+  802489:	68 00 10 00 00       	push   $0x1000
+  80248e:	ff 75 08             	push   0x8(%ebp)
+  802491:	e8 b3 07 00 00       	call   802c49 <open>
+  802496:	89 c3                	mov    %eax,%ebx
+  802498:	83 c4 10             	add    $0x10,%esp
+  80249b:	85 c0                	test   %eax,%eax
+  80249d:	78 1b                	js     8024ba <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  80249f:	83 ec 08             	sub    $0x8,%esp
+  8024a2:	ff 75 0c             	push   0xc(%ebp)
+  8024a5:	50                   	push   %eax
+  8024a6:	e8 61 ff ff ff       	call   80240c <fstat>
+  8024ab:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8024ad:	89 1c 24             	mov    %ebx,(%esp)
+  8024b0:	e8 a2 fb ff ff       	call   802057 <close>
+	return r;
+  8024b5:	83 c4 10             	add    $0x10,%esp
+  8024b8:	89 f3                	mov    %esi,%ebx
+}
+  8024ba:	89 d8                	mov    %ebx,%eax
+  8024bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024bf:	5b                   	pop    %ebx
+  8024c0:	5e                   	pop    %esi
+  8024c1:	5d                   	pop    %ebp
+  8024c2:	c3                   	ret
+
+008024c3 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  8024c3:	55                   	push   %ebp
+  8024c4:	89 e5                	mov    %esp,%ebp
+  8024c6:	57                   	push   %edi
+  8024c7:	56                   	push   %esi
+  8024c8:	53                   	push   %ebx
+  8024c9:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  8024cf:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  8024d5:	89 d6                	mov    %edx,%esi
+  8024d7:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  8024dd:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  8024e0:	89 d3                	mov    %edx,%ebx
+  8024e2:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  8024e8:	83 3d c8 90 80 00 00 	cmpl   $0x0,0x8090c8
+  8024ef:	74 1d                	je     80250e <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8024f1:	b8 00 80 80 00       	mov    $0x808000,%eax
+  8024f6:	83 c8 07             	or     $0x7,%eax
+  8024f9:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  8024ff:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  802504:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  80250a:	01 ce                	add    %ecx,%esi
+  80250c:	eb 28                	jmp    802536 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80250e:	83 ec 0c             	sub    $0xc,%esp
+  802511:	6a 01                	push   $0x1
+  802513:	e8 99 22 00 00       	call   8047b1 <ipc_find_env>
+  802518:	a3 c8 90 80 00       	mov    %eax,0x8090c8
+  80251d:	83 c4 10             	add    $0x10,%esp
+  802520:	eb cf                	jmp    8024f1 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  802522:	83 c0 01             	add    $0x1,%eax
+  802525:	89 fa                	mov    %edi,%edx
+  802527:	09 da                	or     %ebx,%edx
+  802529:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  802530:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802536:	39 f3                	cmp    %esi,%ebx
+  802538:	72 e8                	jb     802522 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  80253a:	83 f8 41             	cmp    $0x41,%eax
+  80253d:	77 2f                	ja     80256e <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  80253f:	50                   	push   %eax
+  802540:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  802546:	50                   	push   %eax
+  802547:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  80254d:	ff 35 c8 90 80 00    	push   0x8090c8
+  802553:	e8 0b 22 00 00       	call   804763 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  802558:	83 c4 0c             	add    $0xc,%esp
+  80255b:	6a 00                	push   $0x0
+  80255d:	6a 00                	push   $0x0
+  80255f:	6a 00                	push   $0x0
+  802561:	e8 a7 20 00 00       	call   80460d <ipc_recv>
+}
+  802566:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802569:	5b                   	pop    %ebx
+  80256a:	5e                   	pop    %esi
+  80256b:	5f                   	pop    %edi
+  80256c:	5d                   	pop    %ebp
+  80256d:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  80256e:	68 50 51 80 00       	push   $0x805150
+  802573:	68 d3 4b 80 00       	push   $0x804bd3
+  802578:	6a 40                	push   $0x40
+  80257a:	68 6c 51 80 00       	push   $0x80516c
+  80257f:	e8 02 e5 ff ff       	call   800a86 <_panic>
+
+00802584 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  802584:	55                   	push   %ebp
+  802585:	89 e5                	mov    %esp,%ebp
+  802587:	57                   	push   %edi
+  802588:	56                   	push   %esi
+  802589:	53                   	push   %ebx
+  80258a:	83 ec 1c             	sub    $0x1c,%esp
+  80258d:	89 c3                	mov    %eax,%ebx
+  80258f:	89 d6                	mov    %edx,%esi
+  802591:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  802594:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  80259a:	89 ca                	mov    %ecx,%edx
+  80259c:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  80259f:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  8025a6:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8025a9:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  8025b0:	8b 76 0c             	mov    0xc(%esi),%esi
+  8025b3:	89 fb                	mov    %edi,%ebx
+  8025b5:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  8025bc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8025bf:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  8025c6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8025c9:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  8025d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025d3:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  8025da:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  8025dd:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  8025e4:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  8025e9:	39 c8                	cmp    %ecx,%eax
+  8025eb:	74 0d                	je     8025fa <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  8025ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025f5:	5b                   	pop    %ebx
+  8025f6:	5e                   	pop    %esi
+  8025f7:	5f                   	pop    %edi
+  8025f8:	5d                   	pop    %ebp
+  8025f9:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8025fa:	6a 07                	push   $0x7
+  8025fc:	68 00 80 80 00       	push   $0x808000
+  802601:	6a 0d                	push   $0xd
+  802603:	ff 35 c8 90 80 00    	push   0x8090c8
+  802609:	e8 6a 20 00 00       	call   804678 <ipc_send>
+  80260e:	83 c4 10             	add    $0x10,%esp
+  802611:	eb da                	jmp    8025ed <fsring_post+0x69>
+
+00802613 <fsipcv>:
+{
+  802613:	55                   	push   %ebp
+  802614:	89 e5                	mov    %esp,%ebp
+  802616:	57                   	push   %edi
+  802617:	56                   	push   %esi
+  802618:	53                   	push   %ebx
+  802619:	83 ec 0c             	sub    $0xc,%esp
+  80261c:	89 c7                	mov    %eax,%edi
+  80261e:	89 d3                	mov    %edx,%ebx
+  802620:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  802622:	83 3d c8 90 80 00 00 	cmpl   $0x0,0x8090c8
+  802629:	74 26                	je     802651 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80262b:	6a 07                	push   $0x7
+  80262d:	68 00 80 80 00       	push   $0x808000
+  802632:	57                   	push   %edi
+  802633:	ff 35 c8 90 80 00    	push   0x8090c8
+  802639:	e8 3a 20 00 00       	call   804678 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  80263e:	6a 00                	push   $0x0
+  802640:	56                   	push   %esi
+  802641:	53                   	push   %ebx
+  802642:	6a 00                	push   $0x0
+  802644:	e8 87 20 00 00       	call   8046d0 <ipc_recvv>
+}
+  802649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80264c:	5b                   	pop    %ebx
+  80264d:	5e                   	pop    %esi
+  80264e:	5f                   	pop    %edi
+  80264f:	5d                   	pop    %ebp
+  802650:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802651:	83 ec 0c             	sub    $0xc,%esp
+  802654:	6a 01                	push   $0x1
+  802656:	e8 56 21 00 00       	call   8047b1 <ipc_find_env>
+  80265b:	a3 c8 90 80 00       	mov    %eax,0x8090c8
+  802660:	83 c4 10             	add    $0x10,%esp
+  802663:	eb c6                	jmp    80262b <fsipcv+0x18>
+
+00802665 <fsipc>:
+{
+  802665:	55                   	push   %ebp
+  802666:	89 e5                	mov    %esp,%ebp
+  802668:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  80266b:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  802672:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  802675:	e8 99 ff ff ff       	call   802613 <fsipcv>
+}
+  80267a:	c9                   	leave
+  80267b:	c3                   	ret
+
+0080267c <file_write_direct>:
+{
+  80267c:	55                   	push   %ebp
+  80267d:	89 e5                	mov    %esp,%ebp
+  80267f:	56                   	push   %esi
+  802680:	53                   	push   %ebx
+  802681:	89 c3                	mov    %eax,%ebx
+  802683:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  802685:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  80268b:	77 40                	ja     8026cd <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80268d:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  802692:	39 c8                	cmp    %ecx,%eax
+  802694:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802697:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  80269a:	89 0d 00 80 80 00    	mov    %ecx,0x808000
+	fsipcbuf.write.req_n = n;
+  8026a0:	a3 04 80 80 00       	mov    %eax,0x808004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8026a5:	83 ec 04             	sub    $0x4,%esp
+  8026a8:	50                   	push   %eax
+  8026a9:	52                   	push   %edx
+  8026aa:	68 08 80 80 00       	push   $0x808008
+  8026af:	e8 11 ed ff ff       	call   8013c5 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8026b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8026be:	e8 a2 ff ff ff       	call   802665 <fsipc>
+  8026c3:	83 c4 10             	add    $0x10,%esp
+}
+  8026c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026c9:	5b                   	pop    %ebx
+  8026ca:	5e                   	pop    %esi
+  8026cb:	5d                   	pop    %ebp
+  8026cc:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8026cd:	89 d6                	mov    %edx,%esi
+  8026cf:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8026d5:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8026da:	29 f1                	sub    %esi,%ecx
+  8026dc:	39 c1                	cmp    %eax,%ecx
+  8026de:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  8026e1:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8026e4:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.bulk.req_n = n;
+  8026e9:	89 0d 04 80 80 00    	mov    %ecx,0x808004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8026ef:	89 35 08 80 80 00    	mov    %esi,0x808008
+	return fsipc_pages(type, buf, n, perm);
+  8026f5:	83 ec 0c             	sub    $0xc,%esp
+  8026f8:	6a 05                	push   $0x5
+  8026fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8026ff:	e8 bf fd ff ff       	call   8024c3 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  802704:	83 c4 10             	add    $0x10,%esp
+  802707:	eb bd                	jmp    8026c6 <file_write_direct+0x4a>
+
+00802709 <devfile_sync>:
+{
+  802709:	55                   	push   %ebp
+  80270a:	89 e5                	mov    %esp,%ebp
+  80270c:	57                   	push   %edi
+  80270d:	56                   	push   %esi
+  80270e:	53                   	push   %ebx
+  80270f:	83 ec 28             	sub    $0x28,%esp
+  802712:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  802715:	56                   	push   %esi
+  802716:	e8 a5 f7 ff ff       	call   801ec0 <fd2data>
+  80271b:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  80271d:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  802720:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  802727:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80272a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  80272f:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802733:	74 45                	je     80277a <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  802735:	8b 46 14             	mov    0x14(%esi),%eax
+  802738:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80273b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802740:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802745:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  802748:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  80274b:	39 cb                	cmp    %ecx,%ebx
+  80274d:	73 14                	jae    802763 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  80274f:	29 d9                	sub    %ebx,%ecx
+  802751:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  802754:	89 f0                	mov    %esi,%eax
+  802756:	e8 21 ff ff ff       	call   80267c <file_write_direct>
+  80275b:	85 c0                	test   %eax,%eax
+  80275d:	7e 04                	jle    802763 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80275f:	01 c3                	add    %eax,%ebx
+  802761:	eb e5                	jmp    802748 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  802763:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802766:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  80276d:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  802770:	85 c0                	test   %eax,%eax
+  802772:	ba 00 00 00 00       	mov    $0x0,%edx
+  802777:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80277a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80277d:	5b                   	pop    %ebx
+  80277e:	5e                   	pop    %esi
+  80277f:	5f                   	pop    %edi
+  802780:	5d                   	pop    %ebp
+  802781:	c3                   	ret
+
+00802782 <devfile_write>:
+{
+  802782:	55                   	push   %ebp
+  802783:	89 e5                	mov    %esp,%ebp
+  802785:	57                   	push   %edi
+  802786:	56                   	push   %esi
+  802787:	53                   	push   %ebx
+  802788:	83 ec 28             	sub    $0x28,%esp
+  80278b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80278e:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  802791:	53                   	push   %ebx
+  802792:	e8 29 f7 ff ff       	call   801ec0 <fd2data>
+  802797:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  80279a:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80279d:	83 c4 10             	add    $0x10,%esp
+  8027a0:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8027a4:	74 43                	je     8027e9 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  8027a6:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  8027ad:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8027b0:	85 c0                	test   %eax,%eax
+  8027b2:	74 43                	je     8027f7 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  8027b4:	89 c2                	mov    %eax,%edx
+  8027b6:	03 53 14             	add    0x14(%ebx),%edx
+  8027b9:	39 fa                	cmp    %edi,%edx
+  8027bb:	75 0b                	jne    8027c8 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  8027bd:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  8027c0:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  8027c6:	76 66                	jbe    80282e <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  8027c8:	83 ec 0c             	sub    $0xc,%esp
+  8027cb:	53                   	push   %ebx
+  8027cc:	e8 38 ff ff ff       	call   802709 <devfile_sync>
+  8027d1:	83 c4 10             	add    $0x10,%esp
+  8027d4:	85 c0                	test   %eax,%eax
+  8027d6:	78 4e                	js     802826 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8027d8:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8027de:	77 56                	ja     802836 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  8027e0:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8027e3:	85 c0                	test   %eax,%eax
+  8027e5:	75 20                	jne    802807 <devfile_write+0x85>
+  8027e7:	eb 16                	jmp    8027ff <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  8027e9:	89 f1                	mov    %esi,%ecx
+  8027eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027ee:	89 d8                	mov    %ebx,%eax
+  8027f0:	e8 87 fe ff ff       	call   80267c <file_write_direct>
+  8027f5:	eb 2f                	jmp    802826 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8027f7:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8027fd:	77 37                	ja     802836 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  8027ff:	89 7b 14             	mov    %edi,0x14(%ebx)
+  802802:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  802807:	83 ec 04             	sub    $0x4,%esp
+  80280a:	56                   	push   %esi
+  80280b:	ff 75 0c             	push   0xc(%ebp)
+  80280e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802811:	01 c1                	add    %eax,%ecx
+  802813:	51                   	push   %ecx
+  802814:	e8 ac eb ff ff       	call   8013c5 <memmove>
+	ff->buf_wlen += n;
+  802819:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  80281c:	01 f7                	add    %esi,%edi
+  80281e:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802821:	89 f0                	mov    %esi,%eax
+  802823:	83 c4 10             	add    $0x10,%esp
+}
+  802826:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802829:	5b                   	pop    %ebx
+  80282a:	5e                   	pop    %esi
+  80282b:	5f                   	pop    %edi
+  80282c:	5d                   	pop    %ebp
+  80282d:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  80282e:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802834:	76 d1                	jbe    802807 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  802836:	89 f1                	mov    %esi,%ecx
+  802838:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80283b:	89 d8                	mov    %ebx,%eax
+  80283d:	e8 3a fe ff ff       	call   80267c <file_write_direct>
+  802842:	eb e2                	jmp    802826 <devfile_write+0xa4>
+
+00802844 <devfile_trunc>:
+{
+  802844:	55                   	push   %ebp
+  802845:	89 e5                	mov    %esp,%ebp
+  802847:	53                   	push   %ebx
+  802848:	83 ec 10             	sub    $0x10,%esp
+  80284b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  80284e:	53                   	push   %ebx
+  80284f:	e8 b5 fe ff ff       	call   802709 <devfile_sync>
+  802854:	83 c4 10             	add    $0x10,%esp
+  802857:	85 c0                	test   %eax,%eax
+  802859:	78 1f                	js     80287a <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80285b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80285e:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  802863:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802866:	a3 04 80 80 00       	mov    %eax,0x808004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80286b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802870:	b8 02 00 00 00       	mov    $0x2,%eax
+  802875:	e8 eb fd ff ff       	call   802665 <fsipc>
+}
+  80287a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80287d:	c9                   	leave
+  80287e:	c3                   	ret
+
+0080287f <devfile_stat>:
+{
+  80287f:	55                   	push   %ebp
+  802880:	89 e5                	mov    %esp,%ebp
+  802882:	56                   	push   %esi
+  802883:	53                   	push   %ebx
+  802884:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802887:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  80288a:	83 ec 0c             	sub    $0xc,%esp
+  80288d:	53                   	push   %ebx
+  80288e:	e8 76 fe ff ff       	call   802709 <devfile_sync>
+  802893:	83 c4 10             	add    $0x10,%esp
+  802896:	85 c0                	test   %eax,%eax
+  802898:	78 47                	js     8028e1 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80289a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80289d:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8028a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028a7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8028ac:	e8 b4 fd ff ff       	call   802665 <fsipc>
+  8028b1:	85 c0                	test   %eax,%eax
+  8028b3:	78 2c                	js     8028e1 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8028b5:	83 ec 08             	sub    $0x8,%esp
+  8028b8:	68 00 80 80 00       	push   $0x808000
+  8028bd:	56                   	push   %esi
+  8028be:	e8 7c e9 ff ff       	call   80123f <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8028c3:	a1 80 80 80 00       	mov    0x808080,%eax
+  8028c8:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8028ce:	a1 84 80 80 00       	mov    0x808084,%eax
+  8028d3:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  8028d9:	83 c4 10             	add    $0x10,%esp
+  8028dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028e4:	5b                   	pop    %ebx
+  8028e5:	5e                   	pop    %esi
+  8028e6:	5d                   	pop    %ebp
+  8028e7:	c3                   	ret
+
+008028e8 <devfile_flush>:
+{
+  8028e8:	55                   	push   %ebp
+  8028e9:	89 e5                	mov    %esp,%ebp
+  8028eb:	56                   	push   %esi
+  8028ec:	53                   	push   %ebx
+  8028ed:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  8028f0:	83 ec 0c             	sub    $0xc,%esp
+  8028f3:	56                   	push   %esi
+  8028f4:	e8 10 fe ff ff       	call   802709 <devfile_sync>
+  8028f9:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  8028fb:	83 c4 10             	add    $0x10,%esp
+  8028fe:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  802902:	75 25                	jne    802929 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802904:	8b 46 0c             	mov    0xc(%esi),%eax
+  802907:	a3 00 80 80 00       	mov    %eax,0x808000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  80290c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802911:	b8 06 00 00 00       	mov    $0x6,%eax
+  802916:	e8 4a fd ff ff       	call   802665 <fsipc>
+  80291b:	85 c0                	test   %eax,%eax
+  80291d:	0f 45 d8             	cmovne %eax,%ebx
+}
+  802920:	89 d8                	mov    %ebx,%eax
+  802922:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802925:	5b                   	pop    %ebx
+  802926:	5e                   	pop    %esi
+  802927:	5d                   	pop    %ebp
+  802928:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  802929:	83 ec 0c             	sub    $0xc,%esp
+  80292c:	56                   	push   %esi
+  80292d:	e8 8e f5 ff ff       	call   801ec0 <fd2data>
+  802932:	83 c4 08             	add    $0x8,%esp
+  802935:	50                   	push   %eax
+  802936:	6a 00                	push   $0x0
+  802938:	e8 9b ed ff ff       	call   8016d8 <sys_page_unmap>
+  80293d:	83 c4 10             	add    $0x10,%esp
+  802940:	eb c2                	jmp    802904 <devfile_flush+0x1c>
+
+00802942 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  802942:	55                   	push   %ebp
+  802943:	89 e5                	mov    %esp,%ebp
+  802945:	57                   	push   %edi
+  802946:	56                   	push   %esi
+  802947:	53                   	push   %ebx
+  802948:	83 ec 64             	sub    $0x64,%esp
+  80294b:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  80294d:	52                   	push   %edx
+  80294e:	50                   	push   %eax
+  80294f:	e8 d9 f5 ff ff       	call   801f2d <fd_lookup>
+  802954:	89 c1                	mov    %eax,%ecx
+  802956:	83 c4 10             	add    $0x10,%esp
+  802959:	85 c0                	test   %eax,%eax
+  80295b:	0f 88 f2 00 00 00    	js     802a53 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  802961:	8b 07                	mov    (%edi),%eax
+  802963:	8b 15 40 60 80 00    	mov    0x806040,%edx
+  802969:	39 10                	cmp    %edx,(%eax)
+  80296b:	0f 85 03 01 00 00    	jne    802a74 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  802971:	a1 14 70 80 00       	mov    0x807014,%eax
+  802976:	8b 40 48             	mov    0x48(%eax),%eax
+  802979:	3b 05 c4 90 80 00    	cmp    0x8090c4,%eax
+  80297f:	0f 84 96 00 00 00    	je     802a1b <fsring_slot+0xd9>
+	if (fsenv == 0)
+  802985:	83 3d c8 90 80 00 00 	cmpl   $0x0,0x8090c8
+  80298c:	0f 84 cb 00 00 00    	je     802a5d <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  802992:	b8 00 80 80 00       	mov    $0x808000,%eax
+  802997:	83 c8 07             	or     $0x7,%eax
+  80299a:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  80299d:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8029a0:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  8029a5:	83 ec 04             	sub    $0x4,%esp
+  8029a8:	68 07 04 00 00       	push   $0x407
+  8029ad:	53                   	push   %ebx
+  8029ae:	6a 00                	push   $0x0
+  8029b0:	e8 96 ec ff ff       	call   80164b <sys_page_alloc>
+  8029b5:	89 c1                	mov    %eax,%ecx
+  8029b7:	83 c4 10             	add    $0x10,%esp
+  8029ba:	85 c0                	test   %eax,%eax
+  8029bc:	0f 88 91 00 00 00    	js     802a53 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  8029c2:	89 d8                	mov    %ebx,%eax
+  8029c4:	83 c8 07             	or     $0x7,%eax
+  8029c7:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8029c9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8029cf:	83 c6 04             	add    $0x4,%esi
+  8029d2:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8029d8:	75 cb                	jne    8029a5 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8029da:	6a 12                	push   $0x12
+  8029dc:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8029df:	50                   	push   %eax
+  8029e0:	6a 0c                	push   $0xc
+  8029e2:	ff 35 c8 90 80 00    	push   0x8090c8
+  8029e8:	e8 76 1d 00 00       	call   804763 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8029ed:	83 c4 0c             	add    $0xc,%esp
+  8029f0:	6a 00                	push   $0x0
+  8029f2:	6a 00                	push   $0x0
+  8029f4:	6a 00                	push   $0x0
+  8029f6:	e8 12 1c 00 00       	call   80460d <ipc_recv>
+  8029fb:	89 c1                	mov    %eax,%ecx
+  8029fd:	83 c4 10             	add    $0x10,%esp
+  802a00:	85 c0                	test   %eax,%eax
+  802a02:	78 4f                	js     802a53 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  802a04:	a1 14 70 80 00       	mov    0x807014,%eax
+  802a09:	8b 40 48             	mov    0x48(%eax),%eax
+  802a0c:	a3 c4 90 80 00       	mov    %eax,0x8090c4
+	fsring_busy = 0;
+  802a11:	c7 05 c0 90 80 00 00 	movl   $0x0,0x8090c0
+  802a18:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  802a1b:	83 ec 0c             	sub    $0xc,%esp
+  802a1e:	ff 37                	push   (%edi)
+  802a20:	e8 e4 fc ff ff       	call   802709 <devfile_sync>
+  802a25:	89 c1                	mov    %eax,%ecx
+  802a27:	83 c4 10             	add    $0x10,%esp
+  802a2a:	85 c0                	test   %eax,%eax
+  802a2c:	78 25                	js     802a53 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  802a2e:	8b 1d c0 90 80 00    	mov    0x8090c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802a34:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  802a39:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a3e:	89 d0                	mov    %edx,%eax
+  802a40:	d3 e0                	shl    %cl,%eax
+  802a42:	85 d8                	test   %ebx,%eax
+  802a44:	74 0d                	je     802a53 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802a46:	83 c1 01             	add    $0x1,%ecx
+  802a49:	83 f9 10             	cmp    $0x10,%ecx
+  802a4c:	75 f0                	jne    802a3e <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  802a4e:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  802a53:	89 c8                	mov    %ecx,%eax
+  802a55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a58:	5b                   	pop    %ebx
+  802a59:	5e                   	pop    %esi
+  802a5a:	5f                   	pop    %edi
+  802a5b:	5d                   	pop    %ebp
+  802a5c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802a5d:	83 ec 0c             	sub    $0xc,%esp
+  802a60:	6a 01                	push   $0x1
+  802a62:	e8 4a 1d 00 00       	call   8047b1 <ipc_find_env>
+  802a67:	a3 c8 90 80 00       	mov    %eax,0x8090c8
+  802a6c:	83 c4 10             	add    $0x10,%esp
+  802a6f:	e9 1e ff ff ff       	jmp    802992 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  802a74:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  802a79:	eb d8                	jmp    802a53 <fsring_slot+0x111>
+
+00802a7b <file_read_direct>:
+{
+  802a7b:	55                   	push   %ebp
+  802a7c:	89 e5                	mov    %esp,%ebp
+  802a7e:	57                   	push   %edi
+  802a7f:	56                   	push   %esi
+  802a80:	53                   	push   %ebx
+  802a81:	83 ec 1c             	sub    $0x1c,%esp
+  802a84:	89 c7                	mov    %eax,%edi
+  802a86:	89 d6                	mov    %edx,%esi
+  802a88:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  802a8a:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  802a90:	77 52                	ja     802ae4 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a92:	8b 40 0c             	mov    0xc(%eax),%eax
+  802a95:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  802a9a:	89 0d 04 80 80 00    	mov    %ecx,0x808004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802aa0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aa5:	b8 03 00 00 00       	mov    $0x3,%eax
+  802aaa:	e8 b6 fb ff ff       	call   802665 <fsipc>
+  802aaf:	89 c7                	mov    %eax,%edi
+  802ab1:	85 c0                	test   %eax,%eax
+  802ab3:	78 25                	js     802ada <file_read_direct+0x5f>
+	assert(r <= n);
+  802ab5:	39 c3                	cmp    %eax,%ebx
+  802ab7:	0f 82 87 00 00 00    	jb     802b44 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  802abd:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802ac2:	0f 8f 95 00 00 00    	jg     802b5d <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802ac8:	83 ec 04             	sub    $0x4,%esp
+  802acb:	50                   	push   %eax
+  802acc:	68 00 80 80 00       	push   $0x808000
+  802ad1:	56                   	push   %esi
+  802ad2:	e8 ee e8 ff ff       	call   8013c5 <memmove>
+	return r;
+  802ad7:	83 c4 10             	add    $0x10,%esp
+}
+  802ada:	89 f8                	mov    %edi,%eax
+  802adc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802adf:	5b                   	pop    %ebx
+  802ae0:	5e                   	pop    %esi
+  802ae1:	5f                   	pop    %edi
+  802ae2:	5d                   	pop    %ebp
+  802ae3:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802ae4:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802aea:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802aef:	29 d1                	sub    %edx,%ecx
+  802af1:	39 d9                	cmp    %ebx,%ecx
+  802af3:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802af6:	89 f0                	mov    %esi,%eax
+  802af8:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  802afb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802afe:	eb 0f                	jmp    802b0f <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  802b00:	0f b6 10             	movzbl (%eax),%edx
+  802b03:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802b05:	05 00 10 00 00       	add    $0x1000,%eax
+  802b0a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802b0f:	39 c8                	cmp    %ecx,%eax
+  802b11:	72 ed                	jb     802b00 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802b13:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802b16:	8b 47 0c             	mov    0xc(%edi),%eax
+  802b19:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.bulk.req_n = n;
+  802b1e:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802b24:	89 15 08 80 80 00    	mov    %edx,0x808008
+	return fsipc_pages(type, buf, n, perm);
+  802b2a:	83 ec 0c             	sub    $0xc,%esp
+  802b2d:	6a 07                	push   $0x7
+  802b2f:	89 d9                	mov    %ebx,%ecx
+  802b31:	89 f2                	mov    %esi,%edx
+  802b33:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b38:	e8 86 f9 ff ff       	call   8024c3 <fsipc_pages>
+  802b3d:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  802b3f:	83 c4 10             	add    $0x10,%esp
+  802b42:	eb 96                	jmp    802ada <file_read_direct+0x5f>
+	assert(r <= n);
+  802b44:	68 77 51 80 00       	push   $0x805177
+  802b49:	68 d3 4b 80 00       	push   $0x804bd3
+  802b4e:	68 dc 00 00 00       	push   $0xdc
+  802b53:	68 6c 51 80 00       	push   $0x80516c
+  802b58:	e8 29 df ff ff       	call   800a86 <_panic>
+	assert(r <= PGSIZE);
+  802b5d:	68 88 51 80 00       	push   $0x805188
+  802b62:	68 d3 4b 80 00       	push   $0x804bd3
+  802b67:	68 dd 00 00 00       	push   $0xdd
+  802b6c:	68 6c 51 80 00       	push   $0x80516c
+  802b71:	e8 10 df ff ff       	call   800a86 <_panic>
+
+00802b76 <devfile_read>:
+{
+  802b76:	55                   	push   %ebp
+  802b77:	89 e5                	mov    %esp,%ebp
+  802b79:	57                   	push   %edi
+  802b7a:	56                   	push   %esi
+  802b7b:	53                   	push   %ebx
+  802b7c:	83 ec 28             	sub    $0x28,%esp
+  802b7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b82:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  802b85:	53                   	push   %ebx
+  802b86:	e8 35 f3 ff ff       	call   801ec0 <fd2data>
+  802b8b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  802b8e:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  802b91:	83 c4 10             	add    $0x10,%esp
+  802b94:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  802b98:	74 7d                	je     802c17 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802b9a:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802b9e:	0f 85 81 00 00 00    	jne    802c25 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  802ba4:	8b 43 18             	mov    0x18(%ebx),%eax
+  802ba7:	85 c0                	test   %eax,%eax
+  802ba9:	74 0d                	je     802bb8 <devfile_read+0x42>
+  802bab:	8b 53 14             	mov    0x14(%ebx),%edx
+  802bae:	39 fa                	cmp    %edi,%edx
+  802bb0:	7f 06                	jg     802bb8 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  802bb2:	01 c2                	add    %eax,%edx
+  802bb4:	39 d7                	cmp    %edx,%edi
+  802bb6:	72 28                	jb     802be0 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  802bb8:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  802bbf:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802bc5:	77 74                	ja     802c3b <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  802bc7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802bcc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802bcf:	89 d8                	mov    %ebx,%eax
+  802bd1:	e8 a5 fe ff ff       	call   802a7b <file_read_direct>
+  802bd6:	85 c0                	test   %eax,%eax
+  802bd8:	7e 35                	jle    802c0f <devfile_read+0x99>
+		ff->buf_base = pos;
+  802bda:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  802bdd:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  802be0:	8b 53 14             	mov    0x14(%ebx),%edx
+  802be3:	89 d0                	mov    %edx,%eax
+  802be5:	03 43 18             	add    0x18(%ebx),%eax
+  802be8:	29 f8                	sub    %edi,%eax
+  802bea:	39 f0                	cmp    %esi,%eax
+  802bec:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  802bef:	83 ec 04             	sub    $0x4,%esp
+  802bf2:	56                   	push   %esi
+  802bf3:	89 f8                	mov    %edi,%eax
+  802bf5:	29 d0                	sub    %edx,%eax
+  802bf7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802bfa:	01 c1                	add    %eax,%ecx
+  802bfc:	51                   	push   %ecx
+  802bfd:	ff 75 0c             	push   0xc(%ebp)
+  802c00:	e8 c0 e7 ff ff       	call   8013c5 <memmove>
+	fd->fd_offset = pos + n;
+  802c05:	01 f7                	add    %esi,%edi
+  802c07:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802c0a:	89 f0                	mov    %esi,%eax
+  802c0c:	83 c4 10             	add    $0x10,%esp
+}
+  802c0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c12:	5b                   	pop    %ebx
+  802c13:	5e                   	pop    %esi
+  802c14:	5f                   	pop    %edi
+  802c15:	5d                   	pop    %ebp
+  802c16:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802c17:	89 f1                	mov    %esi,%ecx
+  802c19:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c1c:	89 d8                	mov    %ebx,%eax
+  802c1e:	e8 58 fe ff ff       	call   802a7b <file_read_direct>
+  802c23:	eb ea                	jmp    802c0f <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802c25:	83 ec 0c             	sub    $0xc,%esp
+  802c28:	53                   	push   %ebx
+  802c29:	e8 db fa ff ff       	call   802709 <devfile_sync>
+  802c2e:	83 c4 10             	add    $0x10,%esp
+  802c31:	85 c0                	test   %eax,%eax
+  802c33:	0f 89 6b ff ff ff    	jns    802ba4 <devfile_read+0x2e>
+  802c39:	eb d4                	jmp    802c0f <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  802c3b:	89 f1                	mov    %esi,%ecx
+  802c3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c40:	89 d8                	mov    %ebx,%eax
+  802c42:	e8 34 fe ff ff       	call   802a7b <file_read_direct>
+  802c47:	eb c6                	jmp    802c0f <devfile_read+0x99>
+
+00802c49 <open>:
+{
+  802c49:	55                   	push   %ebp
+  802c4a:	89 e5                	mov    %esp,%ebp
+  802c4c:	56                   	push   %esi
+  802c4d:	53                   	push   %ebx
+  802c4e:	83 ec 1c             	sub    $0x1c,%esp
+  802c51:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802c54:	56                   	push   %esi
+  802c55:	e8 aa e5 ff ff       	call   801204 <strlen>
+  802c5a:	83 c4 10             	add    $0x10,%esp
+  802c5d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802c62:	0f 8f a0 00 00 00    	jg     802d08 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  802c68:	83 ec 0c             	sub    $0xc,%esp
+  802c6b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c6e:	50                   	push   %eax
+  802c6f:	e8 63 f2 ff ff       	call   801ed7 <fd_alloc>
+  802c74:	89 c3                	mov    %eax,%ebx
+  802c76:	83 c4 10             	add    $0x10,%esp
+  802c79:	85 c0                	test   %eax,%eax
+  802c7b:	78 45                	js     802cc2 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  802c7d:	83 ec 08             	sub    $0x8,%esp
+  802c80:	56                   	push   %esi
+  802c81:	68 00 80 80 00       	push   $0x808000
+  802c86:	e8 b4 e5 ff ff       	call   80123f <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802c8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c8e:	a3 00 84 80 00       	mov    %eax,0x808400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802c93:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802c96:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c9b:	e8 c5 f9 ff ff       	call   802665 <fsipc>
+  802ca0:	89 c3                	mov    %eax,%ebx
+  802ca2:	83 c4 10             	add    $0x10,%esp
+  802ca5:	85 c0                	test   %eax,%eax
+  802ca7:	78 22                	js     802ccb <open+0x82>
+	if (!(mode & O_NOBUF)
+  802ca9:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  802cb0:	74 2b                	je     802cdd <open+0x94>
+	return fd2num(fd);
+  802cb2:	83 ec 0c             	sub    $0xc,%esp
+  802cb5:	ff 75 f4             	push   -0xc(%ebp)
+  802cb8:	e8 f3 f1 ff ff       	call   801eb0 <fd2num>
+  802cbd:	89 c3                	mov    %eax,%ebx
+  802cbf:	83 c4 10             	add    $0x10,%esp
+}
+  802cc2:	89 d8                	mov    %ebx,%eax
+  802cc4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cc7:	5b                   	pop    %ebx
+  802cc8:	5e                   	pop    %esi
+  802cc9:	5d                   	pop    %ebp
+  802cca:	c3                   	ret
+		fd_close(fd, 0);
+  802ccb:	83 ec 08             	sub    $0x8,%esp
+  802cce:	6a 00                	push   $0x0
+  802cd0:	ff 75 f4             	push   -0xc(%ebp)
+  802cd3:	e8 f8 f2 ff ff       	call   801fd0 <fd_close>
+		return r;
+  802cd8:	83 c4 10             	add    $0x10,%esp
+  802cdb:	eb e5                	jmp    802cc2 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  802cdd:	83 ec 0c             	sub    $0xc,%esp
+  802ce0:	ff 75 f4             	push   -0xc(%ebp)
+  802ce3:	e8 d8 f1 ff ff       	call   801ec0 <fd2data>
+  802ce8:	83 c4 0c             	add    $0xc,%esp
+  802ceb:	68 07 04 00 00       	push   $0x407
+  802cf0:	50                   	push   %eax
+  802cf1:	6a 00                	push   $0x0
+  802cf3:	e8 53 e9 ff ff       	call   80164b <sys_page_alloc>
+  802cf8:	83 c4 10             	add    $0x10,%esp
+  802cfb:	85 c0                	test   %eax,%eax
+  802cfd:	75 b3                	jne    802cb2 <open+0x69>
+		fd->fd_file.buffered = 1;
+  802cff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d02:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802d06:	eb aa                	jmp    802cb2 <open+0x69>
+		return -E_BAD_PATH;
+  802d08:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802d0d:	eb b3                	jmp    802cc2 <open+0x79>
+
+00802d0f <readdir>:
+{
+  802d0f:	55                   	push   %ebp
+  802d10:	89 e5                	mov    %esp,%ebp
+  802d12:	53                   	push   %ebx
+  802d13:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d16:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d19:	50                   	push   %eax
+  802d1a:	ff 75 08             	push   0x8(%ebp)
+  802d1d:	e8 0b f2 ff ff       	call   801f2d <fd_lookup>
+  802d22:	89 c3                	mov    %eax,%ebx
+  802d24:	83 c4 10             	add    $0x10,%esp
+  802d27:	85 c0                	test   %eax,%eax
+  802d29:	78 73                	js     802d9e <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802d2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d2e:	8b 0d 40 60 80 00    	mov    0x806040,%ecx
+  802d34:	39 08                	cmp    %ecx,(%eax)
+  802d36:	0f 85 82 00 00 00    	jne    802dbe <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802d3c:	83 ec 0c             	sub    $0xc,%esp
+  802d3f:	50                   	push   %eax
+  802d40:	e8 c4 f9 ff ff       	call   802709 <devfile_sync>
+  802d45:	89 c3                	mov    %eax,%ebx
+  802d47:	83 c4 10             	add    $0x10,%esp
+  802d4a:	85 c0                	test   %eax,%eax
+  802d4c:	78 50                	js     802d9e <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802d4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d51:	8b 40 0c             	mov    0xc(%eax),%eax
+  802d54:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.readdir.req_n = n;
+  802d59:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d5c:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.readdir.req_flags = flags;
+  802d61:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d64:	a3 08 80 80 00       	mov    %eax,0x808008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  802d69:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d6e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802d73:	e8 ed f8 ff ff       	call   802665 <fsipc>
+  802d78:	89 c3                	mov    %eax,%ebx
+  802d7a:	85 c0                	test   %eax,%eax
+  802d7c:	7e 20                	jle    802d9e <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  802d7e:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802d81:	72 22                	jb     802da5 <readdir+0x96>
+  802d83:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802d88:	7f 1b                	jg     802da5 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802d8a:	83 ec 04             	sub    $0x4,%esp
+  802d8d:	50                   	push   %eax
+  802d8e:	68 00 80 80 00       	push   $0x808000
+  802d93:	ff 75 0c             	push   0xc(%ebp)
+  802d96:	e8 2a e6 ff ff       	call   8013c5 <memmove>
+	return r;
+  802d9b:	83 c4 10             	add    $0x10,%esp
+}
+  802d9e:	89 d8                	mov    %ebx,%eax
+  802da0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802da3:	c9                   	leave
+  802da4:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  802da5:	68 7e 51 80 00       	push   $0x80517e
+  802daa:	68 d3 4b 80 00       	push   $0x804bd3
+  802daf:	68 86 01 00 00       	push   $0x186
+  802db4:	68 6c 51 80 00       	push   $0x80516c
+  802db9:	e8 c8 dc ff ff       	call   800a86 <_panic>
+		return -E_NOT_SUPP;
+  802dbe:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802dc3:	eb d9                	jmp    802d9e <readdir+0x8f>
+
+00802dc5 <munmap>:
+{
+  802dc5:	55                   	push   %ebp
+  802dc6:	89 e5                	mov    %esp,%ebp
+  802dc8:	56                   	push   %esi
+  802dc9:	53                   	push   %ebx
+  802dca:	8b 75 08             	mov    0x8(%ebp),%esi
+  802dcd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802dd0:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  802dd6:	75 41                	jne    802e19 <munmap+0x54>
+  802dd8:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  802dde:	77 39                	ja     802e19 <munmap+0x54>
+  802de0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802de5:	29 f0                	sub    %esi,%eax
+  802de7:	39 d0                	cmp    %edx,%eax
+  802de9:	72 35                	jb     802e20 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802deb:	89 f3                	mov    %esi,%ebx
+  802ded:	01 d6                	add    %edx,%esi
+  802def:	39 f3                	cmp    %esi,%ebx
+  802df1:	73 1a                	jae    802e0d <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802df3:	83 ec 08             	sub    $0x8,%esp
+  802df6:	53                   	push   %ebx
+  802df7:	6a 00                	push   $0x0
+  802df9:	e8 da e8 ff ff       	call   8016d8 <sys_page_unmap>
+  802dfe:	83 c4 10             	add    $0x10,%esp
+  802e01:	85 c0                	test   %eax,%eax
+  802e03:	78 0d                	js     802e12 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802e05:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802e0b:	eb e2                	jmp    802def <munmap+0x2a>
+	return 0;
+  802e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e15:	5b                   	pop    %ebx
+  802e16:	5e                   	pop    %esi
+  802e17:	5d                   	pop    %ebp
+  802e18:	c3                   	ret
+		return -E_INVAL;
+  802e19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e1e:	eb f2                	jmp    802e12 <munmap+0x4d>
+  802e20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e25:	eb eb                	jmp    802e12 <munmap+0x4d>
+
+00802e27 <mmap>:
+{
+  802e27:	55                   	push   %ebp
+  802e28:	89 e5                	mov    %esp,%ebp
+  802e2a:	57                   	push   %edi
+  802e2b:	56                   	push   %esi
+  802e2c:	53                   	push   %ebx
+  802e2d:	83 ec 34             	sub    $0x34,%esp
+  802e30:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e33:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802e36:	50                   	push   %eax
+  802e37:	ff 75 18             	push   0x18(%ebp)
+  802e3a:	e8 ee f0 ff ff       	call   801f2d <fd_lookup>
+  802e3f:	89 c3                	mov    %eax,%ebx
+  802e41:	83 c4 10             	add    $0x10,%esp
+  802e44:	85 c0                	test   %eax,%eax
+  802e46:	0f 88 0e 01 00 00    	js     802f5a <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802e4c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e4f:	a1 40 60 80 00       	mov    0x806040,%eax
+  802e54:	39 02                	cmp    %eax,(%edx)
+  802e56:	0f 85 50 01 00 00    	jne    802fac <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802e5c:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e5f:	83 e0 02             	and    $0x2,%eax
+  802e62:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802e65:	74 0a                	je     802e71 <mmap+0x4a>
+  802e67:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802e6b:	0f 84 42 01 00 00    	je     802fb3 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802e71:	8b 42 08             	mov    0x8(%edx),%eax
+  802e74:	83 e0 03             	and    $0x3,%eax
+  802e77:	83 f8 01             	cmp    $0x1,%eax
+  802e7a:	0f 84 3a 01 00 00    	je     802fba <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802e80:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e83:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802e86:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802e8b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802e8e:	0f 85 2d 01 00 00    	jne    802fc1 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802e94:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802e98:	0f 88 2a 01 00 00    	js     802fc8 <mmap+0x1a1>
+  802e9e:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  802ea5:	0f 87 1d 01 00 00    	ja     802fc8 <mmap+0x1a1>
+  802eab:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802eb0:	2b 45 08             	sub    0x8(%ebp),%eax
+  802eb3:	39 f8                	cmp    %edi,%eax
+  802eb5:	0f 82 14 01 00 00    	jb     802fcf <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802ebb:	83 ec 0c             	sub    $0xc,%esp
+  802ebe:	52                   	push   %edx
+  802ebf:	e8 45 f8 ff ff       	call   802709 <devfile_sync>
+  802ec4:	89 c3                	mov    %eax,%ebx
+  802ec6:	83 c4 10             	add    $0x10,%esp
+  802ec9:	85 c0                	test   %eax,%eax
+  802ecb:	0f 88 89 00 00 00    	js     802f5a <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802ed1:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802ed7:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802edd:	be 00 00 00 00       	mov    $0x0,%esi
+  802ee2:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802ee5:	39 fe                	cmp    %edi,%esi
+  802ee7:	73 7b                	jae    802f64 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  802ee9:	89 f8                	mov    %edi,%eax
+  802eeb:	29 f0                	sub    %esi,%eax
+  802eed:	c1 e8 0c             	shr    $0xc,%eax
+  802ef0:	ba 40 00 00 00       	mov    $0x40,%edx
+  802ef5:	39 d0                	cmp    %edx,%eax
+  802ef7:	0f 47 c2             	cmova  %edx,%eax
+  802efa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802efd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802f00:	8b 52 0c             	mov    0xc(%edx),%edx
+  802f03:	89 15 00 80 80 00    	mov    %edx,0x808000
+		fsipcbuf.map.req_offset = offset + done;
+  802f09:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802f0c:	89 15 04 80 80 00    	mov    %edx,0x808004
+		fsipcbuf.map.req_npages = n;
+  802f12:	a3 08 80 80 00       	mov    %eax,0x808008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802f17:	89 f2                	mov    %esi,%edx
+  802f19:	03 55 08             	add    0x8(%ebp),%edx
+  802f1c:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802f1f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802f24:	e8 ea f6 ff ff       	call   802613 <fsipcv>
+  802f29:	85 c0                	test   %eax,%eax
+  802f2b:	7e 12                	jle    802f3f <mmap+0x118>
+  802f2d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f30:	85 c0                	test   %eax,%eax
+  802f32:	0f 84 9e 00 00 00    	je     802fd6 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802f38:	c1 e0 0c             	shl    $0xc,%eax
+  802f3b:	01 c6                	add    %eax,%esi
+  802f3d:	eb a6                	jmp    802ee5 <mmap+0xbe>
+			munmap(addr, done);
+  802f3f:	89 c3                	mov    %eax,%ebx
+  802f41:	83 ec 08             	sub    $0x8,%esp
+  802f44:	56                   	push   %esi
+  802f45:	ff 75 08             	push   0x8(%ebp)
+  802f48:	e8 78 fe ff ff       	call   802dc5 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802f4d:	83 c4 10             	add    $0x10,%esp
+  802f50:	85 db                	test   %ebx,%ebx
+  802f52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f57:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802f5a:	89 d8                	mov    %ebx,%eax
+  802f5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f5f:	5b                   	pop    %ebx
+  802f60:	5e                   	pop    %esi
+  802f61:	5f                   	pop    %edi
+  802f62:	5d                   	pop    %ebp
+  802f63:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802f64:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802f67:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802f69:	85 c0                	test   %eax,%eax
+  802f6b:	74 ed                	je     802f5a <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802f6d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f72:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802f75:	39 fe                	cmp    %edi,%esi
+  802f77:	73 2e                	jae    802fa7 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802f79:	83 ec 0c             	sub    $0xc,%esp
+  802f7c:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802f7f:	50                   	push   %eax
+  802f80:	e8 de eb ff ff       	call   801b63 <cowpage>
+  802f85:	83 c4 10             	add    $0x10,%esp
+  802f88:	85 c0                	test   %eax,%eax
+  802f8a:	78 08                	js     802f94 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802f8c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802f92:	eb e1                	jmp    802f75 <mmap+0x14e>
+				munmap(addr, len);
+  802f94:	89 c3                	mov    %eax,%ebx
+  802f96:	83 ec 08             	sub    $0x8,%esp
+  802f99:	57                   	push   %edi
+  802f9a:	ff 75 08             	push   0x8(%ebp)
+  802f9d:	e8 23 fe ff ff       	call   802dc5 <munmap>
+				return r;
+  802fa2:	83 c4 10             	add    $0x10,%esp
+  802fa5:	eb b3                	jmp    802f5a <mmap+0x133>
+	return 0;
+  802fa7:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802faa:	eb ae                	jmp    802f5a <mmap+0x133>
+		return -E_NOT_SUPP;
+  802fac:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802fb1:	eb a7                	jmp    802f5a <mmap+0x133>
+		return -E_NOT_SUPP;
+  802fb3:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802fb8:	eb a0                	jmp    802f5a <mmap+0x133>
+		return -E_INVAL;
+  802fba:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802fbf:	eb 99                	jmp    802f5a <mmap+0x133>
+  802fc1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802fc6:	eb 92                	jmp    802f5a <mmap+0x133>
+  802fc8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802fcd:	eb 8b                	jmp    802f5a <mmap+0x133>
+  802fcf:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802fd4:	eb 84                	jmp    802f5a <mmap+0x133>
+			munmap(addr, done);
+  802fd6:	83 ec 08             	sub    $0x8,%esp
+  802fd9:	56                   	push   %esi
+  802fda:	ff 75 08             	push   0x8(%ebp)
+  802fdd:	e8 e3 fd ff ff       	call   802dc5 <munmap>
+  802fe2:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802fe5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802fea:	e9 6b ff ff ff       	jmp    802f5a <mmap+0x133>
+
+00802fef <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802fef:	55                   	push   %ebp
+  802ff0:	89 e5                	mov    %esp,%ebp
+  802ff2:	56                   	push   %esi
+  802ff3:	53                   	push   %ebx
+  802ff4:	83 ec 10             	sub    $0x10,%esp
+  802ff7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802ffa:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802ffd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803000:	e8 3d f9 ff ff       	call   802942 <fsring_slot>
+  803005:	85 c0                	test   %eax,%eax
+  803007:	78 60                	js     803069 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  803009:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80300c:	8b 56 08             	mov    0x8(%esi),%edx
+  80300f:	83 e2 03             	and    $0x3,%edx
+  803012:	83 fa 01             	cmp    $0x1,%edx
+  803015:	74 59                	je     803070 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  803017:	ba 01 00 00 00       	mov    $0x1,%edx
+  80301c:	89 c1                	mov    %eax,%ecx
+  80301e:	d3 e2                	shl    %cl,%edx
+  803020:	09 15 c0 90 80 00    	or     %edx,0x8090c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  803026:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  803029:	c1 e2 02             	shl    $0x2,%edx
+  80302c:	8d 8a 00 90 80 00    	lea    0x809000(%edx),%ecx
+  803032:	c7 82 00 90 80 00 03 	movl   $0x3,0x809000(%edx)
+  803039:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80303c:	8b 55 18             	mov    0x18(%ebp),%edx
+  80303f:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  803042:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803045:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  803048:	83 ec 08             	sub    $0x8,%esp
+  80304b:	50                   	push   %eax
+  80304c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803051:	39 c3                	cmp    %eax,%ebx
+  803053:	0f 47 d8             	cmova  %eax,%ebx
+  803056:	53                   	push   %ebx
+  803057:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80305a:	89 f2                	mov    %esi,%edx
+  80305c:	b8 03 00 00 00       	mov    $0x3,%eax
+  803061:	e8 1e f5 ff ff       	call   802584 <fsring_post>
+  803066:	83 c4 10             	add    $0x10,%esp
+}
+  803069:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80306c:	5b                   	pop    %ebx
+  80306d:	5e                   	pop    %esi
+  80306e:	5d                   	pop    %ebp
+  80306f:	c3                   	ret
+		return -E_INVAL;
+  803070:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803075:	eb f2                	jmp    803069 <fsring_read+0x7a>
+
+00803077 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  803077:	55                   	push   %ebp
+  803078:	89 e5                	mov    %esp,%ebp
+  80307a:	56                   	push   %esi
+  80307b:	53                   	push   %ebx
+  80307c:	83 ec 10             	sub    $0x10,%esp
+  80307f:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  803082:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803085:	8b 45 08             	mov    0x8(%ebp),%eax
+  803088:	e8 b5 f8 ff ff       	call   802942 <fsring_slot>
+  80308d:	89 c3                	mov    %eax,%ebx
+  80308f:	85 c0                	test   %eax,%eax
+  803091:	78 77                	js     80310a <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  803093:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803096:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80309a:	74 77                	je     803113 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80309c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8030a1:	39 c6                	cmp    %eax,%esi
+  8030a3:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8030a6:	83 ec 04             	sub    $0x4,%esp
+  8030a9:	56                   	push   %esi
+  8030aa:	ff 75 0c             	push   0xc(%ebp)
+  8030ad:	89 d8                	mov    %ebx,%eax
+  8030af:	c1 e0 0c             	shl    $0xc,%eax
+  8030b2:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8030b8:	50                   	push   %eax
+  8030b9:	e8 07 e3 ff ff       	call   8013c5 <memmove>
+	fsring_busy |= 1 << slot;
+  8030be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030c3:	89 d9                	mov    %ebx,%ecx
+  8030c5:	d3 e0                	shl    %cl,%eax
+  8030c7:	09 05 c0 90 80 00    	or     %eax,0x8090c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8030cd:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8030d0:	c1 e0 02             	shl    $0x2,%eax
+  8030d3:	8d 90 00 90 80 00    	lea    0x809000(%eax),%edx
+  8030d9:	c7 80 00 90 80 00 04 	movl   $0x4,0x809000(%eax)
+  8030e0:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8030e3:	8b 45 18             	mov    0x18(%ebp),%eax
+  8030e6:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8030e9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8030f0:	83 c4 08             	add    $0x8,%esp
+  8030f3:	53                   	push   %ebx
+  8030f4:	56                   	push   %esi
+  8030f5:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8030f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030fb:	b8 04 00 00 00       	mov    $0x4,%eax
+  803100:	e8 7f f4 ff ff       	call   802584 <fsring_post>
+  803105:	89 c3                	mov    %eax,%ebx
+  803107:	83 c4 10             	add    $0x10,%esp
+}
+  80310a:	89 d8                	mov    %ebx,%eax
+  80310c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80310f:	5b                   	pop    %ebx
+  803110:	5e                   	pop    %esi
+  803111:	5d                   	pop    %ebp
+  803112:	c3                   	ret
+		return -E_INVAL;
+  803113:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  803118:	eb f0                	jmp    80310a <fsring_write+0x93>
+
+0080311a <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80311a:	55                   	push   %ebp
+  80311b:	89 e5                	mov    %esp,%ebp
+  80311d:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  803120:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803123:	8b 45 08             	mov    0x8(%ebp),%eax
+  803126:	e8 17 f8 ff ff       	call   802942 <fsring_slot>
+  80312b:	85 c0                	test   %eax,%eax
+  80312d:	78 4c                	js     80317b <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  80312f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803134:	89 c1                	mov    %eax,%ecx
+  803136:	d3 e2                	shl    %cl,%edx
+  803138:	09 15 c0 90 80 00    	or     %edx,0x8090c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  80313e:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  803141:	c1 e2 02             	shl    $0x2,%edx
+  803144:	8d 8a 00 90 80 00    	lea    0x809000(%edx),%ecx
+  80314a:	c7 82 00 90 80 00 05 	movl   $0x5,0x809000(%edx)
+  803151:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  803154:	8b 55 10             	mov    0x10(%ebp),%edx
+  803157:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80315a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80315d:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  803160:	83 ec 08             	sub    $0x8,%esp
+  803163:	50                   	push   %eax
+  803164:	6a 00                	push   $0x0
+  803166:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80316b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80316e:	b8 05 00 00 00       	mov    $0x5,%eax
+  803173:	e8 0c f4 ff ff       	call   802584 <fsring_post>
+  803178:	83 c4 10             	add    $0x10,%esp
+}
+  80317b:	c9                   	leave
+  80317c:	c3                   	ret
+
+0080317d <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  80317d:	55                   	push   %ebp
+  80317e:	89 e5                	mov    %esp,%ebp
+  803180:	57                   	push   %edi
+  803181:	56                   	push   %esi
+  803182:	53                   	push   %ebx
+  803183:	83 ec 1c             	sub    $0x1c,%esp
+  803186:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80318a:	a1 14 70 80 00       	mov    0x807014,%eax
+  80318f:	8b 40 48             	mov    0x48(%eax),%eax
+  803192:	3b 05 c4 90 80 00    	cmp    0x8090c4,%eax
+  803198:	74 12                	je     8031ac <fsring_reap+0x2f>
+		return 0;
+  80319a:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  80319f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031a2:	5b                   	pop    %ebx
+  8031a3:	5e                   	pop    %esi
+  8031a4:	5f                   	pop    %edi
+  8031a5:	5d                   	pop    %ebp
+  8031a6:	c3                   	ret
+		sys_yield();
+  8031a7:	e8 80 e4 ff ff       	call   80162c <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8031ac:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8031b2:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8031b7:	39 c2                	cmp    %eax,%edx
+  8031b9:	75 18                	jne    8031d3 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8031bb:	84 db                	test   %bl,%bl
+  8031bd:	0f 84 21 01 00 00    	je     8032e4 <fsring_reap+0x167>
+  8031c3:	83 3d c0 90 80 00 00 	cmpl   $0x0,0x8090c0
+  8031ca:	75 db                	jne    8031a7 <fsring_reap+0x2a>
+			return 0;
+  8031cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d1:	eb cc                	jmp    80319f <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8031d3:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8031d8:	83 e0 0f             	and    $0xf,%eax
+  8031db:	83 c0 2a             	add    $0x2a,%eax
+  8031de:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8031e5:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8031ec:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8031f1:	83 c0 01             	add    $0x1,%eax
+  8031f4:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8031f9:	83 fb 0f             	cmp    $0xf,%ebx
+  8031fc:	77 5b                	ja     803259 <fsring_reap+0xdc>
+  8031fe:	be 01 00 00 00       	mov    $0x1,%esi
+  803203:	89 d9                	mov    %ebx,%ecx
+  803205:	d3 e6                	shl    %cl,%esi
+  803207:	89 f0                	mov    %esi,%eax
+  803209:	23 05 c0 90 80 00    	and    0x8090c0,%eax
+  80320f:	74 48                	je     803259 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  803211:	89 d8                	mov    %ebx,%eax
+  803213:	c1 e0 0c             	shl    $0xc,%eax
+  803216:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80321c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  80321f:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  803222:	8b 04 85 00 90 80 00 	mov    0x809000(,%eax,4),%eax
+  803229:	83 f8 03             	cmp    $0x3,%eax
+  80322c:	74 40                	je     80326e <fsring_reap+0xf1>
+  80322e:	83 f8 05             	cmp    $0x5,%eax
+  803231:	74 64                	je     803297 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  803233:	f7 d6                	not    %esi
+  803235:	21 35 c0 90 80 00    	and    %esi,0x8090c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  80323b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80323e:	8b 14 85 04 90 80 00 	mov    0x809004(,%eax,4),%edx
+  803245:	8b 45 08             	mov    0x8(%ebp),%eax
+  803248:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  80324a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80324d:	89 38                	mov    %edi,(%eax)
+	return 1;
+  80324f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803254:	e9 46 ff ff ff       	jmp    80319f <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  803259:	53                   	push   %ebx
+  80325a:	68 94 51 80 00       	push   $0x805194
+  80325f:	68 8f 02 00 00       	push   $0x28f
+  803264:	68 6c 51 80 00       	push   $0x80516c
+  803269:	e8 18 d8 ff ff       	call   800a86 <_panic>
+		if (cqe.cqe_result > 0)
+  80326e:	85 ff                	test   %edi,%edi
+  803270:	7e c1                	jle    803233 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  803272:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  803275:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80327a:	39 c7                	cmp    %eax,%edi
+  80327c:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80327f:	50                   	push   %eax
+  803280:	ff 75 e4             	push   -0x1c(%ebp)
+  803283:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  803286:	ff 34 85 08 90 80 00 	push   0x809008(,%eax,4)
+  80328d:	e8 33 e1 ff ff       	call   8013c5 <memmove>
+  803292:	83 c4 10             	add    $0x10,%esp
+  803295:	eb 9c                	jmp    803233 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  803297:	85 ff                	test   %edi,%edi
+  803299:	75 98                	jne    803233 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80329b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80329e:	8b 0c 85 08 90 80 00 	mov    0x809008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8032a5:	83 ec 08             	sub    $0x8,%esp
+  8032a8:	ff 75 e4             	push   -0x1c(%ebp)
+  8032ab:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8032ae:	51                   	push   %ecx
+  8032af:	e8 8b df ff ff       	call   80123f <strcpy>
+			st->st_size = ret->ret_size;
+  8032b4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8032b7:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8032bd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8032c0:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8032c6:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8032cc:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8032d2:	c7 81 88 00 00 00 40 	movl   $0x806040,0x88(%ecx)
+  8032d9:	60 80 00 
+  8032dc:	83 c4 10             	add    $0x10,%esp
+  8032df:	e9 4f ff ff ff       	jmp    803233 <fsring_reap+0xb6>
+			return 0;
+  8032e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032e9:	e9 b1 fe ff ff       	jmp    80319f <fsring_reap+0x22>
+
+008032ee <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8032ee:	55                   	push   %ebp
+  8032ef:	89 e5                	mov    %esp,%ebp
+  8032f1:	57                   	push   %edi
+  8032f2:	56                   	push   %esi
+  8032f3:	53                   	push   %ebx
+  8032f4:	83 ec 28             	sub    $0x28,%esp
+  8032f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8032fa:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8032fd:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  803300:	53                   	push   %ebx
+  803301:	e8 fe de ff ff       	call   801204 <strlen>
+  803306:	83 c4 10             	add    $0x10,%esp
+  803309:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80330e:	0f 8f 02 01 00 00    	jg     803416 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  803314:	83 ec 08             	sub    $0x8,%esp
+  803317:	53                   	push   %ebx
+  803318:	68 00 80 80 00       	push   $0x808000
+  80331d:	e8 1d df ff ff       	call   80123f <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  803322:	83 c4 10             	add    $0x10,%esp
+  803325:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  80332b:	76 69                	jbe    803396 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80332d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803330:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803336:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80333b:	29 d1                	sub    %edx,%ecx
+  80333d:	39 f9                	cmp    %edi,%ecx
+  80333f:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  803342:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803345:	89 f9                	mov    %edi,%ecx
+  803347:	01 c1                	add    %eax,%ecx
+  803349:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80334c:	eb 0f                	jmp    80335d <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  80334e:	0f b6 10             	movzbl (%eax),%edx
+  803351:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  803353:	05 00 10 00 00       	add    $0x1000,%eax
+  803358:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80335d:	39 c8                	cmp    %ecx,%eax
+  80335f:	72 ed                	jb     80334e <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  803361:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803364:	89 3d 00 84 80 00    	mov    %edi,0x808400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  80336a:	89 15 04 84 80 00    	mov    %edx,0x808404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  803370:	83 ec 0c             	sub    $0xc,%esp
+  803373:	6a 07                	push   $0x7
+  803375:	89 f9                	mov    %edi,%ecx
+  803377:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80337a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80337f:	e8 3f f1 ff ff       	call   8024c3 <fsipc_pages>
+  803384:	89 c7                	mov    %eax,%edi
+  803386:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  803389:	85 f6                	test   %esi,%esi
+  80338b:	74 7f                	je     80340c <file_slurp+0x11e>
+  80338d:	8d 43 01             	lea    0x1(%ebx),%eax
+  803390:	85 ff                	test   %edi,%edi
+  803392:	79 3c                	jns    8033d0 <file_slurp+0xe2>
+  803394:	eb 76                	jmp    80340c <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  803396:	89 3d 00 84 80 00    	mov    %edi,0x808400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  80339c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033a1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8033a6:	e8 ba f2 ff ff       	call   802665 <fsipc>
+  8033ab:	89 c7                	mov    %eax,%edi
+  8033ad:	85 c0                	test   %eax,%eax
+  8033af:	7e d8                	jle    803389 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8033b1:	83 ec 04             	sub    $0x4,%esp
+  8033b4:	50                   	push   %eax
+  8033b5:	68 08 80 80 00       	push   $0x808008
+  8033ba:	ff 75 0c             	push   0xc(%ebp)
+  8033bd:	e8 03 e0 ff ff       	call   8013c5 <memmove>
+  8033c2:	83 c4 10             	add    $0x10,%esp
+  8033c5:	eb c2                	jmp    803389 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8033c7:	80 fa 2f             	cmp    $0x2f,%dl
+  8033ca:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8033cd:	83 c0 01             	add    $0x1,%eax
+  8033d0:	89 c1                	mov    %eax,%ecx
+  8033d2:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8033d6:	84 d2                	test   %dl,%dl
+  8033d8:	75 ed                	jne    8033c7 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8033da:	83 ec 04             	sub    $0x4,%esp
+  8033dd:	68 80 00 00 00       	push   $0x80
+  8033e2:	53                   	push   %ebx
+  8033e3:	56                   	push   %esi
+  8033e4:	e8 cc de ff ff       	call   8012b5 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8033e9:	a1 00 80 80 00       	mov    0x808000,%eax
+  8033ee:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8033f4:	a1 04 80 80 00       	mov    0x808004,%eax
+  8033f9:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8033ff:	c7 86 88 00 00 00 40 	movl   $0x806040,0x88(%esi)
+  803406:	60 80 00 
+  803409:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80340c:	89 f8                	mov    %edi,%eax
+  80340e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803411:	5b                   	pop    %ebx
+  803412:	5e                   	pop    %esi
+  803413:	5f                   	pop    %edi
+  803414:	5d                   	pop    %ebp
+  803415:	c3                   	ret
+		return -E_BAD_PATH;
+  803416:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  80341b:	eb ef                	jmp    80340c <file_slurp+0x11e>
+
+0080341d <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80341d:	55                   	push   %ebp
+  80341e:	89 e5                	mov    %esp,%ebp
+  803420:	53                   	push   %ebx
+  803421:	83 ec 10             	sub    $0x10,%esp
+  803424:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  803427:	53                   	push   %ebx
+  803428:	e8 d7 dd ff ff       	call   801204 <strlen>
+  80342d:	83 c4 10             	add    $0x10,%esp
+  803430:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803435:	7f 25                	jg     80345c <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  803437:	83 ec 08             	sub    $0x8,%esp
+  80343a:	53                   	push   %ebx
+  80343b:	68 00 80 80 00       	push   $0x808000
+  803440:	e8 fa dd ff ff       	call   80123f <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  803445:	ba 00 00 00 00       	mov    $0x0,%edx
+  80344a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80344f:	e8 11 f2 ff ff       	call   802665 <fsipc>
+  803454:	83 c4 10             	add    $0x10,%esp
+}
+  803457:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80345a:	c9                   	leave
+  80345b:	c3                   	ret
+		return -E_BAD_PATH;
+  80345c:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  803461:	eb f4                	jmp    803457 <remove+0x3a>
+
+00803463 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803463:	55                   	push   %ebp
+  803464:	89 e5                	mov    %esp,%ebp
+  803466:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  803469:	ba 00 00 00 00       	mov    $0x0,%edx
+  80346e:	b8 08 00 00 00       	mov    $0x8,%eax
+  803473:	e8 ed f1 ff ff       	call   802665 <fsipc>
+}
+  803478:	c9                   	leave
+  803479:	c3                   	ret
+
+0080347a <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  80347a:	55                   	push   %ebp
+  80347b:	89 e5                	mov    %esp,%ebp
+  80347d:	57                   	push   %edi
+  80347e:	56                   	push   %esi
+  80347f:	53                   	push   %ebx
+  803480:	83 ec 18             	sub    $0x18,%esp
+  803483:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803486:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803489:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80348c:	57                   	push   %edi
+  80348d:	e8 72 dd ff ff       	call   801204 <strlen>
+  803492:	83 c4 10             	add    $0x10,%esp
+  803495:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80349a:	7f 4c                	jg     8034e8 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  80349c:	83 ec 08             	sub    $0x8,%esp
+  80349f:	57                   	push   %edi
+  8034a0:	68 00 80 80 00       	push   $0x808000
+  8034a5:	e8 95 dd ff ff       	call   80123f <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  8034aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034af:	b8 10 00 00 00       	mov    $0x10,%eax
+  8034b4:	e8 ac f1 ff ff       	call   802665 <fsipc>
+  8034b9:	83 c4 10             	add    $0x10,%esp
+  8034bc:	85 c0                	test   %eax,%eax
+  8034be:	78 20                	js     8034e0 <defrag+0x66>
+		return r;
+	if (before)
+  8034c0:	85 f6                	test   %esi,%esi
+  8034c2:	74 07                	je     8034cb <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  8034c4:	a1 00 80 80 00       	mov    0x808000,%eax
+  8034c9:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  8034cb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  8034d0:	85 db                	test   %ebx,%ebx
+  8034d2:	74 0c                	je     8034e0 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  8034d4:	a1 04 80 80 00       	mov    0x808004,%eax
+  8034d9:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8034db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034e3:	5b                   	pop    %ebx
+  8034e4:	5e                   	pop    %esi
+  8034e5:	5f                   	pop    %edi
+  8034e6:	5d                   	pop    %ebp
+  8034e7:	c3                   	ret
+		return -E_BAD_PATH;
+  8034e8:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8034ed:	eb f1                	jmp    8034e0 <defrag+0x66>
+
+008034ef <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  8034ef:	55                   	push   %ebp
+  8034f0:	89 e5                	mov    %esp,%ebp
+  8034f2:	53                   	push   %ebx
+  8034f3:	83 ec 04             	sub    $0x4,%esp
+  8034f6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  8034f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034fe:	b8 11 00 00 00       	mov    $0x11,%eax
+  803503:	e8 5d f1 ff ff       	call   802665 <fsipc>
+  803508:	85 c0                	test   %eax,%eax
+  80350a:	78 34                	js     803540 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  80350c:	a1 00 80 80 00       	mov    0x808000,%eax
+  803511:	89 03                	mov    %eax,(%ebx)
+  803513:	a1 04 80 80 00       	mov    0x808004,%eax
+  803518:	89 43 04             	mov    %eax,0x4(%ebx)
+  80351b:	a1 08 80 80 00       	mov    0x808008,%eax
+  803520:	89 43 08             	mov    %eax,0x8(%ebx)
+  803523:	a1 0c 80 80 00       	mov    0x80800c,%eax
+  803528:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80352b:	a1 10 80 80 00       	mov    0x808010,%eax
+  803530:	89 43 10             	mov    %eax,0x10(%ebx)
+  803533:	a1 14 80 80 00       	mov    0x808014,%eax
+  803538:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  80353b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803540:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803543:	c9                   	leave
+  803544:	c3                   	ret
+
+00803545 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  803545:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  803549:	7f 01                	jg     80354c <writebuf+0x7>
+  80354b:	c3                   	ret
+{
+  80354c:	55                   	push   %ebp
+  80354d:	89 e5                	mov    %esp,%ebp
+  80354f:	53                   	push   %ebx
+  803550:	83 ec 08             	sub    $0x8,%esp
+  803553:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  803555:	ff 70 04             	push   0x4(%eax)
+  803558:	8d 40 10             	lea    0x10(%eax),%eax
+  80355b:	50                   	push   %eax
+  80355c:	ff 33                	push   (%ebx)
+  80355e:	e8 fe ec ff ff       	call   802261 <write>
+		if (result > 0)
+  803563:	83 c4 10             	add    $0x10,%esp
+  803566:	85 c0                	test   %eax,%eax
+  803568:	7e 03                	jle    80356d <writebuf+0x28>
+			b->result += result;
+  80356a:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  80356d:	39 43 04             	cmp    %eax,0x4(%ebx)
+  803570:	74 0d                	je     80357f <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  803572:	85 c0                	test   %eax,%eax
+  803574:	ba 00 00 00 00       	mov    $0x0,%edx
+  803579:	0f 4f c2             	cmovg  %edx,%eax
+  80357c:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  80357f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803582:	c9                   	leave
+  803583:	c3                   	ret
+
+00803584 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  803584:	55                   	push   %ebp
+  803585:	89 e5                	mov    %esp,%ebp
+  803587:	53                   	push   %ebx
+  803588:	83 ec 04             	sub    $0x4,%esp
+  80358b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  80358e:	8b 53 04             	mov    0x4(%ebx),%edx
+  803591:	8d 42 01             	lea    0x1(%edx),%eax
+  803594:	89 43 04             	mov    %eax,0x4(%ebx)
+  803597:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80359a:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  80359e:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8035a3:	74 05                	je     8035aa <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  8035a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035a8:	c9                   	leave
+  8035a9:	c3                   	ret
+		writebuf(b);
+  8035aa:	89 d8                	mov    %ebx,%eax
+  8035ac:	e8 94 ff ff ff       	call   803545 <writebuf>
+		b->idx = 0;
+  8035b1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  8035b8:	eb eb                	jmp    8035a5 <putch+0x21>
+
+008035ba <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  8035ba:	55                   	push   %ebp
+  8035bb:	89 e5                	mov    %esp,%ebp
+  8035bd:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  8035c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035c6:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  8035cc:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8035d3:	00 00 00 
+	b.result = 0;
+  8035d6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8035dd:	00 00 00 
+	b.error = 1;
+  8035e0:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8035e7:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8035ea:	ff 75 10             	push   0x10(%ebp)
+  8035ed:	ff 75 0c             	push   0xc(%ebp)
+  8035f0:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8035f6:	50                   	push   %eax
+  8035f7:	68 84 35 80 00       	push   $0x803584
+  8035fc:	e8 57 d6 ff ff       	call   800c58 <vprintfmt>
+	if (b.idx > 0)
+  803601:	83 c4 10             	add    $0x10,%esp
+  803604:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  80360b:	7f 12                	jg     80361f <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  80360d:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  803613:	85 c0                	test   %eax,%eax
+  803615:	75 06                	jne    80361d <vfprintf+0x63>
+  803617:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  80361d:	c9                   	leave
+  80361e:	c3                   	ret
+		writebuf(&b);
+  80361f:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  803625:	e8 1b ff ff ff       	call   803545 <writebuf>
+  80362a:	eb e1                	jmp    80360d <vfprintf+0x53>
+
+0080362c <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  80362c:	55                   	push   %ebp
+  80362d:	89 e5                	mov    %esp,%ebp
+  80362f:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  803632:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  803635:	50                   	push   %eax
+  803636:	ff 75 0c             	push   0xc(%ebp)
+  803639:	ff 75 08             	push   0x8(%ebp)
+  80363c:	e8 79 ff ff ff       	call   8035ba <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  803641:	c9                   	leave
+  803642:	c3                   	ret
+
+00803643 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  803643:	55                   	push   %ebp
+  803644:	89 e5                	mov    %esp,%ebp
+  803646:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  803649:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  80364c:	50                   	push   %eax
+  80364d:	ff 75 08             	push   0x8(%ebp)
+  803650:	6a 01                	push   $0x1
+  803652:	e8 63 ff ff ff       	call   8035ba <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  803657:	c9                   	leave
+  803658:	c3                   	ret
+
+00803659 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  803659:	55                   	push   %ebp
+  80365a:	89 e5                	mov    %esp,%ebp
+  80365c:	57                   	push   %edi
+  80365d:	56                   	push   %esi
+  80365e:	53                   	push   %ebx
+  80365f:	81 ec a4 02 00 00    	sub    $0x2a4,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  803665:	6a 00                	push   $0x0
+  803667:	ff 75 08             	push   0x8(%ebp)
+  80366a:	e8 da f5 ff ff       	call   802c49 <open>
+  80366f:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  803675:	83 c4 10             	add    $0x10,%esp
+  803678:	85 c0                	test   %eax,%eax
+  80367a:	0f 88 39 06 00 00    	js     803cb9 <spawn+0x660>
+  803680:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  803682:	83 ec 04             	sub    $0x4,%esp
+  803685:	68 00 02 00 00       	push   $0x200
+  80368a:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  803690:	50                   	push   %eax
+  803691:	51                   	push   %ecx
+  803692:	e8 83 eb ff ff       	call   80221a <readn>
+  803697:	83 c4 10             	add    $0x10,%esp
+  80369a:	3d 00 02 00 00       	cmp    $0x200,%eax
+  80369f:	75 5a                	jne    8036fb <spawn+0xa2>
+	    || elf->e_magic != ELF_MAGIC) {
+  8036a1:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8036a8:	45 4c 46 
+  8036ab:	75 4e                	jne    8036fb <spawn+0xa2>
+  8036ad:	b8 07 00 00 00       	mov    $0x7,%eax
+  8036b2:	cd 30                	int    $0x30
+  8036b4:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  8036ba:	85 c0                	test   %eax,%eax
+  8036bc:	0f 88 eb 05 00 00    	js     803cad <spawn+0x654>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  8036c2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8036c7:	69 f0 8c 00 00 00    	imul   $0x8c,%eax,%esi
+  8036cd:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8036d3:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8036d9:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8036de:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  8036e0:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8036e6:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  8036ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  8036f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8036f6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8036f9:	eb 4b                	jmp    803746 <spawn+0xed>
+		close(fd);
+  8036fb:	83 ec 0c             	sub    $0xc,%esp
+  8036fe:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  803704:	e8 4e e9 ff ff       	call   802057 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803709:	83 c4 0c             	add    $0xc,%esp
+  80370c:	68 7f 45 4c 46       	push   $0x464c457f
+  803711:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  803717:	68 ad 51 80 00       	push   $0x8051ad
+  80371c:	e8 40 d4 ff ff       	call   800b61 <cprintf>
+		return -E_NOT_EXEC;
+  803721:	83 c4 10             	add    $0x10,%esp
+  803724:	c7 85 7c fd ff ff f2 	movl   $0xfffffff2,-0x284(%ebp)
+  80372b:	ff ff ff 
+  80372e:	e9 86 05 00 00       	jmp    803cb9 <spawn+0x660>
+		string_size += strlen(argv[argc]) + 1;
+  803733:	83 ec 0c             	sub    $0xc,%esp
+  803736:	50                   	push   %eax
+  803737:	e8 c8 da ff ff       	call   801204 <strlen>
+  80373c:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  803740:	83 c3 01             	add    $0x1,%ebx
+  803743:	83 c4 10             	add    $0x10,%esp
+  803746:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  803749:	85 c0                	test   %eax,%eax
+  80374b:	75 e6                	jne    803733 <spawn+0xda>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  80374d:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  803753:	bf 00 10 40 00       	mov    $0x401000,%edi
+  803758:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  80375a:	89 fa                	mov    %edi,%edx
+  80375c:	83 e2 fc             	and    $0xfffffffc,%edx
+  80375f:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  803766:	29 c2                	sub    %eax,%edx
+  803768:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  80376e:	8d 42 f8             	lea    -0x8(%edx),%eax
+  803771:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  803776:	0f 86 59 05 00 00    	jbe    803cd5 <spawn+0x67c>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  80377c:	83 ec 04             	sub    $0x4,%esp
+  80377f:	6a 07                	push   $0x7
+  803781:	68 00 00 40 00       	push   $0x400000
+  803786:	6a 00                	push   $0x0
+  803788:	e8 be de ff ff       	call   80164b <sys_page_alloc>
+  80378d:	83 c4 10             	add    $0x10,%esp
+  803790:	85 c0                	test   %eax,%eax
+  803792:	0f 88 42 05 00 00    	js     803cda <spawn+0x681>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  803798:	be 00 00 00 00       	mov    $0x0,%esi
+  80379d:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  8037a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8037a6:	eb 30                	jmp    8037d8 <spawn+0x17f>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  8037a8:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  8037ae:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+  8037b4:	89 04 b2             	mov    %eax,(%edx,%esi,4)
+		strcpy(string_store, argv[i]);
+  8037b7:	83 ec 08             	sub    $0x8,%esp
+  8037ba:	ff 34 b3             	push   (%ebx,%esi,4)
+  8037bd:	57                   	push   %edi
+  8037be:	e8 7c da ff ff       	call   80123f <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  8037c3:	83 c4 04             	add    $0x4,%esp
+  8037c6:	ff 34 b3             	push   (%ebx,%esi,4)
+  8037c9:	e8 36 da ff ff       	call   801204 <strlen>
+  8037ce:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  8037d2:	83 c6 01             	add    $0x1,%esi
+  8037d5:	83 c4 10             	add    $0x10,%esp
+  8037d8:	39 b5 90 fd ff ff    	cmp    %esi,-0x270(%ebp)
+  8037de:	7f c8                	jg     8037a8 <spawn+0x14f>
+	}
+	argv_store[argc] = 0;
+  8037e0:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  8037e6:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  8037ec:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  8037f3:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  8037f9:	0f 85 83 00 00 00    	jne    803882 <spawn+0x229>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  8037ff:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+  803805:	8d 82 00 d0 7f ee    	lea    -0x11803000(%edx),%eax
+  80380b:	89 42 fc             	mov    %eax,-0x4(%edx)
+	argv_store[-2] = argc;
+  80380e:	89 d0                	mov    %edx,%eax
+  803810:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  803816:	89 4a f8             	mov    %ecx,-0x8(%edx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  803819:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  80381e:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  803824:	83 ec 0c             	sub    $0xc,%esp
+  803827:	6a 07                	push   $0x7
+  803829:	68 00 d0 bf ee       	push   $0xeebfd000
+  80382e:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  803834:	68 00 00 40 00       	push   $0x400000
+  803839:	6a 00                	push   $0x0
+  80383b:	e8 56 de ff ff       	call   801696 <sys_page_map>
+  803840:	89 c3                	mov    %eax,%ebx
+  803842:	83 c4 20             	add    $0x20,%esp
+  803845:	85 c0                	test   %eax,%eax
+  803847:	0f 88 95 04 00 00    	js     803ce2 <spawn+0x689>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80384d:	83 ec 08             	sub    $0x8,%esp
+  803850:	68 00 00 40 00       	push   $0x400000
+  803855:	6a 00                	push   $0x0
+  803857:	e8 7c de ff ff       	call   8016d8 <sys_page_unmap>
+  80385c:	89 c3                	mov    %eax,%ebx
+  80385e:	83 c4 10             	add    $0x10,%esp
+  803861:	85 c0                	test   %eax,%eax
+  803863:	0f 88 79 04 00 00    	js     803ce2 <spawn+0x689>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  803869:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  80386f:	8d b4 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  803876:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80387b:	89 df                	mov    %ebx,%edi
+  80387d:	e9 7f 02 00 00       	jmp    803b01 <spawn+0x4a8>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  803882:	68 38 52 80 00       	push   $0x805238
+  803887:	68 d3 4b 80 00       	push   $0x804bd3
+  80388c:	68 f0 00 00 00       	push   $0xf0
+  803891:	68 c7 51 80 00       	push   $0x8051c7
+  803896:	e8 eb d1 ff ff       	call   800a86 <_panic>
+
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+		if (i >= filesz) {
+			// allocate a blank page
+			n = 1;
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  80389b:	83 ec 04             	sub    $0x4,%esp
+  80389e:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  8038a4:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  8038aa:	01 f8                	add    %edi,%eax
+  8038ac:	50                   	push   %eax
+  8038ad:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  8038b3:	e8 93 dd ff ff       	call   80164b <sys_page_alloc>
+  8038b8:	83 c4 10             	add    $0x10,%esp
+  8038bb:	85 c0                	test   %eax,%eax
+  8038bd:	0f 88 04 04 00 00    	js     803cc7 <spawn+0x66e>
+			n = 1;
+  8038c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8038c8:	e9 99 01 00 00       	jmp    803a66 <spawn+0x40d>
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+			// read-only and all from file: map the file server's
+			// cached pages, so that every instance of the program
+			// shares one copy of its text
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  8038cd:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  8038d3:	8b 8d 80 fd ff ff    	mov    -0x280(%ebp),%ecx
+  8038d9:	39 c8                	cmp    %ecx,%eax
+  8038db:	72 70                	jb     80394d <spawn+0x2f4>
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+  8038dd:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8038e2:	29 f8                	sub    %edi,%eax
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  8038e4:	c1 e8 0c             	shr    $0xc,%eax
+			n = MIN(n, FSBULK_MAXPAGES);
+  8038e7:	ba 40 00 00 00       	mov    $0x40,%edx
+  8038ec:	39 d0                	cmp    %edx,%eax
+  8038ee:	0f 4e d0             	cmovle %eax,%edx
+  8038f1:	89 d6                	mov    %edx,%esi
+			if ((r = mmap(UTEMP, n * PGSIZE, PROT_READ, MAP_SHARED,
+  8038f3:	83 ec 08             	sub    $0x8,%esp
+  8038f6:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  8038fc:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  803902:	01 d0                	add    %edx,%eax
+  803904:	50                   	push   %eax
+  803905:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  80390b:	6a 01                	push   $0x1
+  80390d:	6a 01                	push   $0x1
+  80390f:	89 f0                	mov    %esi,%eax
+  803911:	c1 e0 0c             	shl    $0xc,%eax
+  803914:	50                   	push   %eax
+  803915:	68 00 00 40 00       	push   $0x400000
+  80391a:	e8 08 f5 ff ff       	call   802e27 <mmap>
+  80391f:	83 c4 20             	add    $0x20,%esp
+  803922:	85 c0                	test   %eax,%eax
+  803924:	78 34                	js     80395a <spawn+0x301>
+			if ((r = seek(fd, fileoffset + i)) < 0)
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
+				return r;
+		}
+		for (j = 0; j < n; j++) {
+  803926:	8d 86 00 04 00 00    	lea    0x400(%esi),%eax
+  80392c:	c1 e0 0c             	shl    $0xc,%eax
+  80392f:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  803935:	bb 00 00 40 00       	mov    $0x400000,%ebx
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  80393a:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  803940:	01 c7                	add    %eax,%edi
+  803942:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+		for (j = 0; j < n; j++) {
+  803948:	e9 ca 00 00 00       	jmp    803a17 <spawn+0x3be>
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  80394d:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  803953:	29 f8                	sub    %edi,%eax
+  803955:	c1 e8 0c             	shr    $0xc,%eax
+  803958:	eb 8d                	jmp    8038e7 <spawn+0x28e>
+  80395a:	89 c7                	mov    %eax,%edi
+  80395c:	eb 27                	jmp    803985 <spawn+0x32c>
+			for (j = 0; j < n; j++)
+  80395e:	83 c3 01             	add    $0x1,%ebx
+  803961:	39 de                	cmp    %ebx,%esi
+  803963:	7e 4a                	jle    8039af <spawn+0x356>
+				if ((r = sys_page_alloc(0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  803965:	83 ec 04             	sub    $0x4,%esp
+  803968:	6a 07                	push   $0x7
+  80396a:	89 d8                	mov    %ebx,%eax
+  80396c:	c1 e0 0c             	shl    $0xc,%eax
+  80396f:	05 00 00 40 00       	add    $0x400000,%eax
+  803974:	50                   	push   %eax
+  803975:	6a 00                	push   $0x0
+  803977:	e8 cf dc ff ff       	call   80164b <sys_page_alloc>
+  80397c:	83 c4 10             	add    $0x10,%esp
+  80397f:	85 c0                	test   %eax,%eax
+  803981:	79 db                	jns    80395e <spawn+0x305>
+  803983:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  803985:	83 ec 0c             	sub    $0xc,%esp
+  803988:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  80398e:	e8 29 dc ff ff       	call   8015bc <sys_env_destroy>
+	close(fd);
+  803993:	83 c4 04             	add    $0x4,%esp
+  803996:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  80399c:	e8 b6 e6 ff ff       	call   802057 <close>
+	return r;
+  8039a1:	83 c4 10             	add    $0x10,%esp
+  8039a4:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+  8039aa:	e9 0a 03 00 00       	jmp    803cb9 <spawn+0x660>
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  8039af:	83 ec 08             	sub    $0x8,%esp
+  8039b2:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  8039b8:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  8039be:	01 d0                	add    %edx,%eax
+  8039c0:	50                   	push   %eax
+  8039c1:	8b 9d 7c fd ff ff    	mov    -0x284(%ebp),%ebx
+  8039c7:	53                   	push   %ebx
+  8039c8:	e8 16 e9 ff ff       	call   8022e3 <seek>
+  8039cd:	83 c4 10             	add    $0x10,%esp
+  8039d0:	85 c0                	test   %eax,%eax
+  8039d2:	0f 88 f6 02 00 00    	js     803cce <spawn+0x675>
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
+  8039d8:	83 ec 04             	sub    $0x4,%esp
+  8039db:	89 f0                	mov    %esi,%eax
+  8039dd:	c1 e0 0c             	shl    $0xc,%eax
+  8039e0:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  8039e6:	39 c8                	cmp    %ecx,%eax
+  8039e8:	0f 47 c1             	cmova  %ecx,%eax
+  8039eb:	50                   	push   %eax
+  8039ec:	68 00 00 40 00       	push   $0x400000
+  8039f1:	53                   	push   %ebx
+  8039f2:	e8 23 e8 ff ff       	call   80221a <readn>
+  8039f7:	83 c4 10             	add    $0x10,%esp
+  8039fa:	85 c0                	test   %eax,%eax
+  8039fc:	0f 89 24 ff ff ff    	jns    803926 <spawn+0x2cd>
+  803a02:	89 c7                	mov    %eax,%edi
+  803a04:	e9 7c ff ff ff       	jmp    803985 <spawn+0x32c>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP + j * PGSIZE);
+  803a09:	83 ec 08             	sub    $0x8,%esp
+  803a0c:	56                   	push   %esi
+  803a0d:	6a 00                	push   $0x0
+  803a0f:	e8 c4 dc ff ff       	call   8016d8 <sys_page_unmap>
+  803a14:	83 c4 10             	add    $0x10,%esp
+		for (j = 0; j < n; j++) {
+  803a17:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  803a1d:	39 c3                	cmp    %eax,%ebx
+  803a1f:	74 3f                	je     803a60 <spawn+0x407>
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  803a21:	89 de                	mov    %ebx,%esi
+  803a23:	83 ec 0c             	sub    $0xc,%esp
+  803a26:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  803a2c:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  803a2f:	50                   	push   %eax
+  803a30:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  803a36:	53                   	push   %ebx
+  803a37:	6a 00                	push   $0x0
+  803a39:	e8 58 dc ff ff       	call   801696 <sys_page_map>
+  803a3e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803a44:	83 c4 20             	add    $0x20,%esp
+  803a47:	85 c0                	test   %eax,%eax
+  803a49:	79 be                	jns    803a09 <spawn+0x3b0>
+				panic("spawn: sys_page_map data: %e", r);
+  803a4b:	50                   	push   %eax
+  803a4c:	68 d3 51 80 00       	push   $0x8051d3
+  803a51:	68 36 01 00 00       	push   $0x136
+  803a56:	68 c7 51 80 00       	push   $0x8051c7
+  803a5b:	e8 26 d0 ff ff       	call   800a86 <_panic>
+  803a60:	8b b5 74 fd ff ff    	mov    -0x28c(%ebp),%esi
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  803a66:	c1 e6 0c             	shl    $0xc,%esi
+  803a69:	01 b5 88 fd ff ff    	add    %esi,-0x278(%ebp)
+  803a6f:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  803a75:	89 c7                	mov    %eax,%edi
+  803a77:	8b 8d 80 fd ff ff    	mov    -0x280(%ebp),%ecx
+  803a7d:	39 c8                	cmp    %ecx,%eax
+  803a7f:	73 6e                	jae    803aef <spawn+0x496>
+		if (i >= filesz) {
+  803a81:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  803a87:	39 8d 88 fd ff ff    	cmp    %ecx,-0x278(%ebp)
+  803a8d:	0f 83 08 fe ff ff    	jae    80389b <spawn+0x242>
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+  803a93:	f6 85 94 fd ff ff 02 	testb  $0x2,-0x26c(%ebp)
+  803a9a:	75 27                	jne    803ac3 <spawn+0x46a>
+  803a9c:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  803aa2:	05 00 10 00 00       	add    $0x1000,%eax
+  803aa7:	8b 95 84 fd ff ff    	mov    -0x27c(%ebp),%edx
+  803aad:	39 c2                	cmp    %eax,%edx
+  803aaf:	0f 83 18 fe ff ff    	jae    8038cd <spawn+0x274>
+  803ab5:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  803abb:	39 c2                	cmp    %eax,%edx
+  803abd:	0f 83 0a fe ff ff    	jae    8038cd <spawn+0x274>
+			n = MIN(FSBULK_MAXPAGES, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  803ac3:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  803ac9:	29 f8                	sub    %edi,%eax
+  803acb:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  803ad1:	05 ff 0f 00 00       	add    $0xfff,%eax
+  803ad6:	c1 e8 0c             	shr    $0xc,%eax
+  803ad9:	89 c6                	mov    %eax,%esi
+  803adb:	b8 40 00 00 00       	mov    $0x40,%eax
+  803ae0:	39 c6                	cmp    %eax,%esi
+  803ae2:	0f 47 f0             	cmova  %eax,%esi
+			for (j = 0; j < n; j++)
+  803ae5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803aea:	e9 72 fe ff ff       	jmp    803961 <spawn+0x308>
+  803aef:	8b bd 68 fd ff ff    	mov    -0x298(%ebp),%edi
+  803af5:	8b b5 64 fd ff ff    	mov    -0x29c(%ebp),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  803afb:	83 c7 01             	add    $0x1,%edi
+  803afe:	83 c6 20             	add    $0x20,%esi
+  803b01:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  803b08:	39 f8                	cmp    %edi,%eax
+  803b0a:	0f 8e 88 00 00 00    	jle    803b98 <spawn+0x53f>
+		if (ph->p_type != ELF_PROG_LOAD)
+  803b10:	83 3e 01             	cmpl   $0x1,(%esi)
+  803b13:	75 e6                	jne    803afb <spawn+0x4a2>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  803b15:	8b 46 18             	mov    0x18(%esi),%eax
+  803b18:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  803b1b:	83 f8 01             	cmp    $0x1,%eax
+  803b1e:	19 c0                	sbb    %eax,%eax
+  803b20:	83 e0 fe             	and    $0xfffffffe,%eax
+  803b23:	83 c0 07             	add    $0x7,%eax
+  803b26:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  803b2c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803b2f:	89 8d 78 fd ff ff    	mov    %ecx,-0x288(%ebp)
+  803b35:	8b 5e 10             	mov    0x10(%esi),%ebx
+  803b38:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  803b3e:	8b 46 14             	mov    0x14(%esi),%eax
+  803b41:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  803b47:	8b 56 08             	mov    0x8(%esi),%edx
+	if ((i = PGOFF(va))) {
+  803b4a:	89 d0                	mov    %edx,%eax
+  803b4c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803b51:	74 18                	je     803b6b <spawn+0x512>
+		va -= i;
+  803b53:	29 c2                	sub    %eax,%edx
+		memsz += i;
+  803b55:	01 85 80 fd ff ff    	add    %eax,-0x280(%ebp)
+		filesz += i;
+  803b5b:	01 c3                	add    %eax,%ebx
+  803b5d:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+		fileoffset -= i;
+  803b63:	29 c1                	sub    %eax,%ecx
+  803b65:	89 8d 78 fd ff ff    	mov    %ecx,-0x288(%ebp)
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  803b6b:	c7 85 88 fd ff ff 00 	movl   $0x0,-0x278(%ebp)
+  803b72:	00 00 00 
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  803b75:	8d 82 00 00 c0 ff    	lea    -0x400000(%edx),%eax
+  803b7b:	89 85 70 fd ff ff    	mov    %eax,-0x290(%ebp)
+  803b81:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+  803b87:	89 bd 68 fd ff ff    	mov    %edi,-0x298(%ebp)
+  803b8d:	89 b5 64 fd ff ff    	mov    %esi,-0x29c(%ebp)
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  803b93:	e9 d7 fe ff ff       	jmp    803a6f <spawn+0x416>
+	close(fd);
+  803b98:	83 ec 0c             	sub    $0xc,%esp
+  803b9b:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  803ba1:	e8 b1 e4 ff ff       	call   802057 <close>
+  803ba6:	83 c4 10             	add    $0x10,%esp
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+	// LAB 5: Your code here.
+	int r = 0;
+  803ba9:	ba 00 00 00 00       	mov    $0x0,%edx
+
+	for (uintptr_t va = 0; va < UTOP; va += PGSIZE) {
+  803bae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803bb3:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  803bb9:	eb 14                	jmp    803bcf <spawn+0x576>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+			va += PTSIZE - PGSIZE;
+  803bbb:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t va = 0; va < UTOP; va += PGSIZE) {
+  803bc1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803bc7:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803bcd:	77 65                	ja     803c34 <spawn+0x5db>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  803bcf:	89 d8                	mov    %ebx,%eax
+  803bd1:	c1 e8 16             	shr    $0x16,%eax
+  803bd4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803bdb:	a8 01                	test   $0x1,%al
+  803bdd:	74 dc                	je     803bbb <spawn+0x562>
+			continue;
+		}
+		if (!(uvpt[PGNUM(va)] & PTE_P) || !(uvpt[PGNUM(va)] & PTE_SHARE))
+  803bdf:	89 d8                	mov    %ebx,%eax
+  803be1:	c1 e8 0c             	shr    $0xc,%eax
+  803be4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803beb:	f6 c1 01             	test   $0x1,%cl
+  803bee:	74 d1                	je     803bc1 <spawn+0x568>
+  803bf0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803bf7:	f6 c5 04             	test   $0x4,%ch
+  803bfa:	74 c5                	je     803bc1 <spawn+0x568>
+			continue;
+		r = sys_page_map(0, (void *) va, child, (void *) va,
+				 uvpt[PGNUM(va)] & PTE_SYSCALL);
+  803bfc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+		r = sys_page_map(0, (void *) va, child, (void *) va,
+  803c03:	83 ec 0c             	sub    $0xc,%esp
+  803c06:	25 07 0e 00 00       	and    $0xe07,%eax
+  803c0b:	50                   	push   %eax
+  803c0c:	53                   	push   %ebx
+  803c0d:	56                   	push   %esi
+  803c0e:	53                   	push   %ebx
+  803c0f:	6a 00                	push   $0x0
+  803c11:	e8 80 da ff ff       	call   801696 <sys_page_map>
+  803c16:	89 c2                	mov    %eax,%edx
+		if (r < 0)
+  803c18:	83 c4 20             	add    $0x20,%esp
+  803c1b:	85 c0                	test   %eax,%eax
+  803c1d:	79 a2                	jns    803bc1 <spawn+0x568>
+		panic("copy_shared_pages: %e", r);
+  803c1f:	52                   	push   %edx
+  803c20:	68 f0 51 80 00       	push   $0x8051f0
+  803c25:	68 80 00 00 00       	push   $0x80
+  803c2a:	68 c7 51 80 00       	push   $0x8051c7
+  803c2f:	e8 52 ce ff ff       	call   800a86 <_panic>
+	if ((r = copy_shared_pages(child)) < 0)
+  803c34:	85 d2                	test   %edx,%edx
+  803c36:	78 e7                	js     803c1f <spawn+0x5c6>
+	child_tf.tf_eflags |= FL_IOPL_3;   // devious: see user/faultio.c
+  803c38:	81 8d dc fd ff ff 00 	orl    $0x3000,-0x224(%ebp)
+  803c3f:	30 00 00 
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  803c42:	83 ec 08             	sub    $0x8,%esp
+  803c45:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  803c4b:	50                   	push   %eax
+  803c4c:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  803c52:	e8 15 db ff ff       	call   80176c <sys_env_set_trapframe>
+  803c57:	83 c4 10             	add    $0x10,%esp
+  803c5a:	85 c0                	test   %eax,%eax
+  803c5c:	78 25                	js     803c83 <spawn+0x62a>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  803c5e:	83 ec 08             	sub    $0x8,%esp
+  803c61:	6a 02                	push   $0x2
+  803c63:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  803c69:	e8 b4 da ff ff       	call   801722 <sys_env_set_status>
+  803c6e:	83 c4 10             	add    $0x10,%esp
+  803c71:	85 c0                	test   %eax,%eax
+  803c73:	78 23                	js     803c98 <spawn+0x63f>
+	return child;
+  803c75:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  803c7b:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  803c81:	eb 36                	jmp    803cb9 <spawn+0x660>
+		panic("sys_env_set_trapframe: %e", r);
+  803c83:	50                   	push   %eax
+  803c84:	68 06 52 80 00       	push   $0x805206
+  803c89:	68 84 00 00 00       	push   $0x84
+  803c8e:	68 c7 51 80 00       	push   $0x8051c7
+  803c93:	e8 ee cd ff ff       	call   800a86 <_panic>
+		panic("sys_env_set_status: %e", r);
+  803c98:	50                   	push   %eax
+  803c99:	68 20 52 80 00       	push   $0x805220
+  803c9e:	68 87 00 00 00       	push   $0x87
+  803ca3:	68 c7 51 80 00       	push   $0x8051c7
+  803ca8:	e8 d9 cd ff ff       	call   800a86 <_panic>
+		return r;
+  803cad:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  803cb3:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+}
+  803cb9:	8b 85 7c fd ff ff    	mov    -0x284(%ebp),%eax
+  803cbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cc2:	5b                   	pop    %ebx
+  803cc3:	5e                   	pop    %esi
+  803cc4:	5f                   	pop    %edi
+  803cc5:	5d                   	pop    %ebp
+  803cc6:	c3                   	ret
+  803cc7:	89 c7                	mov    %eax,%edi
+  803cc9:	e9 b7 fc ff ff       	jmp    803985 <spawn+0x32c>
+  803cce:	89 c7                	mov    %eax,%edi
+  803cd0:	e9 b0 fc ff ff       	jmp    803985 <spawn+0x32c>
+		return -E_NO_MEM;
+  803cd5:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  803cda:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  803ce0:	eb d7                	jmp    803cb9 <spawn+0x660>
+	sys_page_unmap(0, UTEMP);
+  803ce2:	83 ec 08             	sub    $0x8,%esp
+  803ce5:	68 00 00 40 00       	push   $0x400000
+  803cea:	6a 00                	push   $0x0
+  803cec:	e8 e7 d9 ff ff       	call   8016d8 <sys_page_unmap>
+  803cf1:	83 c4 10             	add    $0x10,%esp
+  803cf4:	89 9d 7c fd ff ff    	mov    %ebx,-0x284(%ebp)
+  803cfa:	eb bd                	jmp    803cb9 <spawn+0x660>
+
+00803cfc <spawnl>:
+{
+  803cfc:	55                   	push   %ebp
+  803cfd:	89 e5                	mov    %esp,%ebp
+  803cff:	56                   	push   %esi
+  803d00:	53                   	push   %ebx
+	va_start(vl, arg0);
+  803d01:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  803d04:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  803d09:	eb 05                	jmp    803d10 <spawnl+0x14>
+		argc++;
+  803d0b:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  803d0e:	89 ca                	mov    %ecx,%edx
+  803d10:	8d 4a 04             	lea    0x4(%edx),%ecx
+  803d13:	83 3a 00             	cmpl   $0x0,(%edx)
+  803d16:	75 f3                	jne    803d0b <spawnl+0xf>
+	const char *argv[argc+2];
+  803d18:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  803d1f:	83 e2 f0             	and    $0xfffffff0,%edx
+  803d22:	29 d4                	sub    %edx,%esp
+  803d24:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  803d28:	89 da                	mov    %ebx,%edx
+  803d2a:	c1 ea 02             	shr    $0x2,%edx
+  803d2d:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  803d30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803d33:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  803d3a:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  803d41:	00 
+	va_start(vl, arg0);
+  803d42:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  803d45:	89 c2                	mov    %eax,%edx
+  803d47:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d4c:	eb 0b                	jmp    803d59 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  803d4e:	83 c0 01             	add    $0x1,%eax
+  803d51:	8b 31                	mov    (%ecx),%esi
+  803d53:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  803d56:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  803d59:	39 d0                	cmp    %edx,%eax
+  803d5b:	75 f1                	jne    803d4e <spawnl+0x52>
+	return spawn(prog, argv);
+  803d5d:	83 ec 08             	sub    $0x8,%esp
+  803d60:	53                   	push   %ebx
+  803d61:	ff 75 08             	push   0x8(%ebp)
+  803d64:	e8 f0 f8 ff ff       	call   803659 <spawn>
+}
+  803d69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d6c:	5b                   	pop    %ebx
+  803d6d:	5e                   	pop    %esi
+  803d6e:	5d                   	pop    %ebp
+  803d6f:	c3                   	ret
+
+00803d70 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  803d70:	55                   	push   %ebp
+  803d71:	89 e5                	mov    %esp,%ebp
+  803d73:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803d76:	68 5e 52 80 00       	push   $0x80525e
+  803d7b:	ff 75 0c             	push   0xc(%ebp)
+  803d7e:	e8 bc d4 ff ff       	call   80123f <strcpy>
+	return 0;
+}
+  803d83:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d88:	c9                   	leave
+  803d89:	c3                   	ret
+
+00803d8a <devsock_close>:
+{
+  803d8a:	55                   	push   %ebp
+  803d8b:	89 e5                	mov    %esp,%ebp
+  803d8d:	53                   	push   %ebx
+  803d8e:	83 ec 10             	sub    $0x10,%esp
+  803d91:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  803d94:	53                   	push   %ebx
+  803d95:	e8 56 0a 00 00       	call   8047f0 <pageref>
+  803d9a:	89 c2                	mov    %eax,%edx
+  803d9c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  803d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803da4:	83 fa 01             	cmp    $0x1,%edx
+  803da7:	74 05                	je     803dae <devsock_close+0x24>
+}
+  803da9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803dac:	c9                   	leave
+  803dad:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  803dae:	83 ec 0c             	sub    $0xc,%esp
+  803db1:	ff 73 0c             	push   0xc(%ebx)
+  803db4:	e8 b7 02 00 00       	call   804070 <nsipc_close>
+  803db9:	83 c4 10             	add    $0x10,%esp
+  803dbc:	eb eb                	jmp    803da9 <devsock_close+0x1f>
+
+00803dbe <devsock_write>:
+{
+  803dbe:	55                   	push   %ebp
+  803dbf:	89 e5                	mov    %esp,%ebp
+  803dc1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  803dc4:	6a 00                	push   $0x0
+  803dc6:	ff 75 10             	push   0x10(%ebp)
+  803dc9:	ff 75 0c             	push   0xc(%ebp)
+  803dcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dcf:	ff 70 0c             	push   0xc(%eax)
+  803dd2:	e8 79 03 00 00       	call   804150 <nsipc_send>
+}
+  803dd7:	c9                   	leave
+  803dd8:	c3                   	ret
+
+00803dd9 <devsock_read>:
+{
+  803dd9:	55                   	push   %ebp
+  803dda:	89 e5                	mov    %esp,%ebp
+  803ddc:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  803ddf:	6a 00                	push   $0x0
+  803de1:	ff 75 10             	push   0x10(%ebp)
+  803de4:	ff 75 0c             	push   0xc(%ebp)
+  803de7:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dea:	ff 70 0c             	push   0xc(%eax)
+  803ded:	e8 ef 02 00 00       	call   8040e1 <nsipc_recv>
+}
+  803df2:	c9                   	leave
+  803df3:	c3                   	ret
+
+00803df4 <fd2sockid>:
+{
+  803df4:	55                   	push   %ebp
+  803df5:	89 e5                	mov    %esp,%ebp
+  803df7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803dfa:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803dfd:	52                   	push   %edx
+  803dfe:	50                   	push   %eax
+  803dff:	e8 29 e1 ff ff       	call   801f2d <fd_lookup>
+  803e04:	83 c4 10             	add    $0x10,%esp
+  803e07:	85 c0                	test   %eax,%eax
+  803e09:	78 10                	js     803e1b <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803e0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e0e:	8b 0d 60 60 80 00    	mov    0x806060,%ecx
+  803e14:	39 08                	cmp    %ecx,(%eax)
+  803e16:	75 05                	jne    803e1d <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803e18:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803e1b:	c9                   	leave
+  803e1c:	c3                   	ret
+		return -E_NOT_SUPP;
+  803e1d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803e22:	eb f7                	jmp    803e1b <fd2sockid+0x27>
+
+00803e24 <alloc_sockfd>:
+{
+  803e24:	55                   	push   %ebp
+  803e25:	89 e5                	mov    %esp,%ebp
+  803e27:	56                   	push   %esi
+  803e28:	53                   	push   %ebx
+  803e29:	83 ec 1c             	sub    $0x1c,%esp
+  803e2c:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803e2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e31:	50                   	push   %eax
+  803e32:	e8 a0 e0 ff ff       	call   801ed7 <fd_alloc>
+  803e37:	89 c3                	mov    %eax,%ebx
+  803e39:	83 c4 10             	add    $0x10,%esp
+  803e3c:	85 c0                	test   %eax,%eax
+  803e3e:	78 43                	js     803e83 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803e40:	83 ec 04             	sub    $0x4,%esp
+  803e43:	68 07 04 00 00       	push   $0x407
+  803e48:	ff 75 f4             	push   -0xc(%ebp)
+  803e4b:	6a 00                	push   $0x0
+  803e4d:	e8 f9 d7 ff ff       	call   80164b <sys_page_alloc>
+  803e52:	89 c3                	mov    %eax,%ebx
+  803e54:	83 c4 10             	add    $0x10,%esp
+  803e57:	85 c0                	test   %eax,%eax
+  803e59:	78 28                	js     803e83 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803e5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e5e:	8b 15 60 60 80 00    	mov    0x806060,%edx
+  803e64:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803e66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e69:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803e70:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803e73:	83 ec 0c             	sub    $0xc,%esp
+  803e76:	50                   	push   %eax
+  803e77:	e8 34 e0 ff ff       	call   801eb0 <fd2num>
+  803e7c:	89 c3                	mov    %eax,%ebx
+  803e7e:	83 c4 10             	add    $0x10,%esp
+  803e81:	eb 0c                	jmp    803e8f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803e83:	83 ec 0c             	sub    $0xc,%esp
+  803e86:	56                   	push   %esi
+  803e87:	e8 e4 01 00 00       	call   804070 <nsipc_close>
+		return r;
+  803e8c:	83 c4 10             	add    $0x10,%esp
+}
+  803e8f:	89 d8                	mov    %ebx,%eax
+  803e91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e94:	5b                   	pop    %ebx
+  803e95:	5e                   	pop    %esi
+  803e96:	5d                   	pop    %ebp
+  803e97:	c3                   	ret
+
+00803e98 <accept>:
+{
+  803e98:	55                   	push   %ebp
+  803e99:	89 e5                	mov    %esp,%ebp
+  803e9b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803e9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ea1:	e8 4e ff ff ff       	call   803df4 <fd2sockid>
+  803ea6:	85 c0                	test   %eax,%eax
+  803ea8:	78 1b                	js     803ec5 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803eaa:	83 ec 04             	sub    $0x4,%esp
+  803ead:	ff 75 10             	push   0x10(%ebp)
+  803eb0:	ff 75 0c             	push   0xc(%ebp)
+  803eb3:	50                   	push   %eax
+  803eb4:	e8 0e 01 00 00       	call   803fc7 <nsipc_accept>
+  803eb9:	83 c4 10             	add    $0x10,%esp
+  803ebc:	85 c0                	test   %eax,%eax
+  803ebe:	78 05                	js     803ec5 <accept+0x2d>
+	return alloc_sockfd(r);
+  803ec0:	e8 5f ff ff ff       	call   803e24 <alloc_sockfd>
+}
+  803ec5:	c9                   	leave
+  803ec6:	c3                   	ret
+
+00803ec7 <bind>:
+{
+  803ec7:	55                   	push   %ebp
+  803ec8:	89 e5                	mov    %esp,%ebp
+  803eca:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803ecd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ed0:	e8 1f ff ff ff       	call   803df4 <fd2sockid>
+  803ed5:	85 c0                	test   %eax,%eax
+  803ed7:	78 12                	js     803eeb <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  803ed9:	83 ec 04             	sub    $0x4,%esp
+  803edc:	ff 75 10             	push   0x10(%ebp)
+  803edf:	ff 75 0c             	push   0xc(%ebp)
+  803ee2:	50                   	push   %eax
+  803ee3:	e8 31 01 00 00       	call   804019 <nsipc_bind>
+  803ee8:	83 c4 10             	add    $0x10,%esp
+}
+  803eeb:	c9                   	leave
+  803eec:	c3                   	ret
+
+00803eed <shutdown>:
+{
+  803eed:	55                   	push   %ebp
+  803eee:	89 e5                	mov    %esp,%ebp
+  803ef0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803ef3:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ef6:	e8 f9 fe ff ff       	call   803df4 <fd2sockid>
+  803efb:	85 c0                	test   %eax,%eax
+  803efd:	78 0f                	js     803f0e <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803eff:	83 ec 08             	sub    $0x8,%esp
+  803f02:	ff 75 0c             	push   0xc(%ebp)
+  803f05:	50                   	push   %eax
+  803f06:	e8 43 01 00 00       	call   80404e <nsipc_shutdown>
+  803f0b:	83 c4 10             	add    $0x10,%esp
+}
+  803f0e:	c9                   	leave
+  803f0f:	c3                   	ret
+
+00803f10 <connect>:
+{
+  803f10:	55                   	push   %ebp
+  803f11:	89 e5                	mov    %esp,%ebp
+  803f13:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803f16:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f19:	e8 d6 fe ff ff       	call   803df4 <fd2sockid>
+  803f1e:	85 c0                	test   %eax,%eax
+  803f20:	78 12                	js     803f34 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803f22:	83 ec 04             	sub    $0x4,%esp
+  803f25:	ff 75 10             	push   0x10(%ebp)
+  803f28:	ff 75 0c             	push   0xc(%ebp)
+  803f2b:	50                   	push   %eax
+  803f2c:	e8 59 01 00 00       	call   80408a <nsipc_connect>
+  803f31:	83 c4 10             	add    $0x10,%esp
+}
+  803f34:	c9                   	leave
+  803f35:	c3                   	ret
+
+00803f36 <listen>:
+{
+  803f36:	55                   	push   %ebp
+  803f37:	89 e5                	mov    %esp,%ebp
+  803f39:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803f3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f3f:	e8 b0 fe ff ff       	call   803df4 <fd2sockid>
+  803f44:	85 c0                	test   %eax,%eax
+  803f46:	78 0f                	js     803f57 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803f48:	83 ec 08             	sub    $0x8,%esp
+  803f4b:	ff 75 0c             	push   0xc(%ebp)
+  803f4e:	50                   	push   %eax
+  803f4f:	e8 6b 01 00 00       	call   8040bf <nsipc_listen>
+  803f54:	83 c4 10             	add    $0x10,%esp
+}
+  803f57:	c9                   	leave
+  803f58:	c3                   	ret
+
+00803f59 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803f59:	55                   	push   %ebp
+  803f5a:	89 e5                	mov    %esp,%ebp
+  803f5c:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803f5f:	ff 75 10             	push   0x10(%ebp)
+  803f62:	ff 75 0c             	push   0xc(%ebp)
+  803f65:	ff 75 08             	push   0x8(%ebp)
+  803f68:	e8 41 02 00 00       	call   8041ae <nsipc_socket>
+  803f6d:	83 c4 10             	add    $0x10,%esp
+  803f70:	85 c0                	test   %eax,%eax
+  803f72:	78 05                	js     803f79 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803f74:	e8 ab fe ff ff       	call   803e24 <alloc_sockfd>
+}
+  803f79:	c9                   	leave
+  803f7a:	c3                   	ret
+
+00803f7b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803f7b:	55                   	push   %ebp
+  803f7c:	89 e5                	mov    %esp,%ebp
+  803f7e:	53                   	push   %ebx
+  803f7f:	83 ec 04             	sub    $0x4,%esp
+  803f82:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803f84:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  803f8b:	74 26                	je     803fb3 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803f8d:	6a 07                	push   $0x7
+  803f8f:	68 00 a0 80 00       	push   $0x80a000
+  803f94:	53                   	push   %ebx
+  803f95:	ff 35 00 b0 80 00    	push   0x80b000
+  803f9b:	e8 d8 06 00 00       	call   804678 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803fa0:	83 c4 0c             	add    $0xc,%esp
+  803fa3:	6a 00                	push   $0x0
+  803fa5:	6a 00                	push   $0x0
+  803fa7:	6a 00                	push   $0x0
+  803fa9:	e8 5f 06 00 00       	call   80460d <ipc_recv>
+}
+  803fae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803fb1:	c9                   	leave
+  803fb2:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803fb3:	83 ec 0c             	sub    $0xc,%esp
+  803fb6:	6a 02                	push   $0x2
+  803fb8:	e8 f4 07 00 00       	call   8047b1 <ipc_find_env>
+  803fbd:	a3 00 b0 80 00       	mov    %eax,0x80b000
+  803fc2:	83 c4 10             	add    $0x10,%esp
+  803fc5:	eb c6                	jmp    803f8d <nsipc+0x12>
+
+00803fc7 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803fc7:	55                   	push   %ebp
+  803fc8:	89 e5                	mov    %esp,%ebp
+  803fca:	56                   	push   %esi
+  803fcb:	53                   	push   %ebx
+  803fcc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803fcf:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fd2:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  803fd7:	8b 06                	mov    (%esi),%eax
+  803fd9:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803fde:	b8 01 00 00 00       	mov    $0x1,%eax
+  803fe3:	e8 93 ff ff ff       	call   803f7b <nsipc>
+  803fe8:	89 c3                	mov    %eax,%ebx
+  803fea:	85 c0                	test   %eax,%eax
+  803fec:	79 09                	jns    803ff7 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803fee:	89 d8                	mov    %ebx,%eax
+  803ff0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ff3:	5b                   	pop    %ebx
+  803ff4:	5e                   	pop    %esi
+  803ff5:	5d                   	pop    %ebp
+  803ff6:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803ff7:	83 ec 04             	sub    $0x4,%esp
+  803ffa:	ff 35 10 a0 80 00    	push   0x80a010
+  804000:	68 00 a0 80 00       	push   $0x80a000
+  804005:	ff 75 0c             	push   0xc(%ebp)
+  804008:	e8 b8 d3 ff ff       	call   8013c5 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80400d:	a1 10 a0 80 00       	mov    0x80a010,%eax
+  804012:	89 06                	mov    %eax,(%esi)
+  804014:	83 c4 10             	add    $0x10,%esp
+	return r;
+  804017:	eb d5                	jmp    803fee <nsipc_accept+0x27>
+
+00804019 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804019:	55                   	push   %ebp
+  80401a:	89 e5                	mov    %esp,%ebp
+  80401c:	53                   	push   %ebx
+  80401d:	83 ec 08             	sub    $0x8,%esp
+  804020:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  804023:	8b 45 08             	mov    0x8(%ebp),%eax
+  804026:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80402b:	53                   	push   %ebx
+  80402c:	ff 75 0c             	push   0xc(%ebp)
+  80402f:	68 04 a0 80 00       	push   $0x80a004
+  804034:	e8 8c d3 ff ff       	call   8013c5 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  804039:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_BIND);
+  80403f:	b8 02 00 00 00       	mov    $0x2,%eax
+  804044:	e8 32 ff ff ff       	call   803f7b <nsipc>
+}
+  804049:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80404c:	c9                   	leave
+  80404d:	c3                   	ret
+
+0080404e <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80404e:	55                   	push   %ebp
+  80404f:	89 e5                	mov    %esp,%ebp
+  804051:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  804054:	8b 45 08             	mov    0x8(%ebp),%eax
+  804057:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.shutdown.req_how = how;
+  80405c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80405f:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_SHUTDOWN);
+  804064:	b8 03 00 00 00       	mov    $0x3,%eax
+  804069:	e8 0d ff ff ff       	call   803f7b <nsipc>
+}
+  80406e:	c9                   	leave
+  80406f:	c3                   	ret
+
+00804070 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  804070:	55                   	push   %ebp
+  804071:	89 e5                	mov    %esp,%ebp
+  804073:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  804076:	8b 45 08             	mov    0x8(%ebp),%eax
+  804079:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_CLOSE);
+  80407e:	b8 04 00 00 00       	mov    $0x4,%eax
+  804083:	e8 f3 fe ff ff       	call   803f7b <nsipc>
+}
+  804088:	c9                   	leave
+  804089:	c3                   	ret
+
+0080408a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80408a:	55                   	push   %ebp
+  80408b:	89 e5                	mov    %esp,%ebp
+  80408d:	53                   	push   %ebx
+  80408e:	83 ec 08             	sub    $0x8,%esp
+  804091:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  804094:	8b 45 08             	mov    0x8(%ebp),%eax
+  804097:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80409c:	53                   	push   %ebx
+  80409d:	ff 75 0c             	push   0xc(%ebp)
+  8040a0:	68 04 a0 80 00       	push   $0x80a004
+  8040a5:	e8 1b d3 ff ff       	call   8013c5 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8040aa:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_CONNECT);
+  8040b0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8040b5:	e8 c1 fe ff ff       	call   803f7b <nsipc>
+}
+  8040ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8040bd:	c9                   	leave
+  8040be:	c3                   	ret
+
+008040bf <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8040bf:	55                   	push   %ebp
+  8040c0:	89 e5                	mov    %esp,%ebp
+  8040c2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8040c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040c8:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.listen.req_backlog = backlog;
+  8040cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8040d0:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_LISTEN);
+  8040d5:	b8 06 00 00 00       	mov    $0x6,%eax
+  8040da:	e8 9c fe ff ff       	call   803f7b <nsipc>
+}
+  8040df:	c9                   	leave
+  8040e0:	c3                   	ret
+
+008040e1 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8040e1:	55                   	push   %ebp
+  8040e2:	89 e5                	mov    %esp,%ebp
+  8040e4:	56                   	push   %esi
+  8040e5:	53                   	push   %ebx
+  8040e6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8040e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040ec:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.recv.req_len = len;
+  8040f1:	89 35 04 a0 80 00    	mov    %esi,0x80a004
+	nsipcbuf.recv.req_flags = flags;
+  8040f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8040fa:	a3 08 a0 80 00       	mov    %eax,0x80a008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8040ff:	b8 07 00 00 00       	mov    $0x7,%eax
+  804104:	e8 72 fe ff ff       	call   803f7b <nsipc>
+  804109:	89 c3                	mov    %eax,%ebx
+  80410b:	85 c0                	test   %eax,%eax
+  80410d:	78 22                	js     804131 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80410f:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  804114:	39 c6                	cmp    %eax,%esi
+  804116:	0f 4e c6             	cmovle %esi,%eax
+  804119:	39 c3                	cmp    %eax,%ebx
+  80411b:	7f 1d                	jg     80413a <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80411d:	83 ec 04             	sub    $0x4,%esp
+  804120:	53                   	push   %ebx
+  804121:	68 00 a0 80 00       	push   $0x80a000
+  804126:	ff 75 0c             	push   0xc(%ebp)
+  804129:	e8 97 d2 ff ff       	call   8013c5 <memmove>
+  80412e:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  804131:	89 d8                	mov    %ebx,%eax
+  804133:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804136:	5b                   	pop    %ebx
+  804137:	5e                   	pop    %esi
+  804138:	5d                   	pop    %ebp
+  804139:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80413a:	68 6a 52 80 00       	push   $0x80526a
+  80413f:	68 d3 4b 80 00       	push   $0x804bd3
+  804144:	6a 62                	push   $0x62
+  804146:	68 7f 52 80 00       	push   $0x80527f
+  80414b:	e8 36 c9 ff ff       	call   800a86 <_panic>
+
+00804150 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  804150:	55                   	push   %ebp
+  804151:	89 e5                	mov    %esp,%ebp
+  804153:	53                   	push   %ebx
+  804154:	83 ec 04             	sub    $0x4,%esp
+  804157:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80415a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80415d:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	assert(size < 1600);
+  804162:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  804168:	7f 2e                	jg     804198 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80416a:	83 ec 04             	sub    $0x4,%esp
+  80416d:	53                   	push   %ebx
+  80416e:	ff 75 0c             	push   0xc(%ebp)
+  804171:	68 0c a0 80 00       	push   $0x80a00c
+  804176:	e8 4a d2 ff ff       	call   8013c5 <memmove>
+	nsipcbuf.send.req_size = size;
+  80417b:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	nsipcbuf.send.req_flags = flags;
+  804181:	8b 45 14             	mov    0x14(%ebp),%eax
+  804184:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SEND);
+  804189:	b8 08 00 00 00       	mov    $0x8,%eax
+  80418e:	e8 e8 fd ff ff       	call   803f7b <nsipc>
+}
+  804193:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804196:	c9                   	leave
+  804197:	c3                   	ret
+	assert(size < 1600);
+  804198:	68 8b 52 80 00       	push   $0x80528b
+  80419d:	68 d3 4b 80 00       	push   $0x804bd3
+  8041a2:	6a 6d                	push   $0x6d
+  8041a4:	68 7f 52 80 00       	push   $0x80527f
+  8041a9:	e8 d8 c8 ff ff       	call   800a86 <_panic>
+
+008041ae <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8041ae:	55                   	push   %ebp
+  8041af:	89 e5                	mov    %esp,%ebp
+  8041b1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8041b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041b7:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.socket.req_type = type;
+  8041bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8041bf:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.socket.req_protocol = protocol;
+  8041c4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8041c7:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SOCKET);
+  8041cc:	b8 09 00 00 00       	mov    $0x9,%eax
+  8041d1:	e8 a5 fd ff ff       	call   803f7b <nsipc>
+}
+  8041d6:	c9                   	leave
+  8041d7:	c3                   	ret
+
+008041d8 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8041d8:	55                   	push   %ebp
+  8041d9:	89 e5                	mov    %esp,%ebp
+  8041db:	56                   	push   %esi
+  8041dc:	53                   	push   %ebx
+  8041dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8041e0:	83 ec 0c             	sub    $0xc,%esp
+  8041e3:	ff 75 08             	push   0x8(%ebp)
+  8041e6:	e8 d5 dc ff ff       	call   801ec0 <fd2data>
+  8041eb:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8041ed:	83 c4 08             	add    $0x8,%esp
+  8041f0:	68 97 52 80 00       	push   $0x805297
+  8041f5:	53                   	push   %ebx
+  8041f6:	e8 44 d0 ff ff       	call   80123f <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8041fb:	8b 46 04             	mov    0x4(%esi),%eax
+  8041fe:	2b 06                	sub    (%esi),%eax
+  804200:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  804206:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80420d:	00 00 00 
+	stat->st_dev = &devpipe;
+  804210:	c7 83 88 00 00 00 80 	movl   $0x806080,0x88(%ebx)
+  804217:	60 80 00 
+	return 0;
+}
+  80421a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80421f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804222:	5b                   	pop    %ebx
+  804223:	5e                   	pop    %esi
+  804224:	5d                   	pop    %ebp
+  804225:	c3                   	ret
+
+00804226 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  804226:	55                   	push   %ebp
+  804227:	89 e5                	mov    %esp,%ebp
+  804229:	53                   	push   %ebx
+  80422a:	83 ec 0c             	sub    $0xc,%esp
+  80422d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  804230:	53                   	push   %ebx
+  804231:	6a 00                	push   $0x0
+  804233:	e8 a0 d4 ff ff       	call   8016d8 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  804238:	89 1c 24             	mov    %ebx,(%esp)
+  80423b:	e8 80 dc ff ff       	call   801ec0 <fd2data>
+  804240:	83 c4 08             	add    $0x8,%esp
+  804243:	50                   	push   %eax
+  804244:	6a 00                	push   $0x0
+  804246:	e8 8d d4 ff ff       	call   8016d8 <sys_page_unmap>
+}
+  80424b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80424e:	c9                   	leave
+  80424f:	c3                   	ret
+
+00804250 <_pipeisclosed>:
+{
+  804250:	55                   	push   %ebp
+  804251:	89 e5                	mov    %esp,%ebp
+  804253:	57                   	push   %edi
+  804254:	56                   	push   %esi
+  804255:	53                   	push   %ebx
+  804256:	83 ec 1c             	sub    $0x1c,%esp
+  804259:	89 c7                	mov    %eax,%edi
+  80425b:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80425d:	a1 14 70 80 00       	mov    0x807014,%eax
+  804262:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  804265:	83 ec 0c             	sub    $0xc,%esp
+  804268:	57                   	push   %edi
+  804269:	e8 82 05 00 00       	call   8047f0 <pageref>
+  80426e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804271:	89 34 24             	mov    %esi,(%esp)
+  804274:	e8 77 05 00 00       	call   8047f0 <pageref>
+		nn = thisenv->env_runs;
+  804279:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  80427f:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  804282:	83 c4 10             	add    $0x10,%esp
+  804285:	39 cb                	cmp    %ecx,%ebx
+  804287:	74 1b                	je     8042a4 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  804289:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80428c:	75 cf                	jne    80425d <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80428e:	8b 42 58             	mov    0x58(%edx),%eax
+  804291:	6a 01                	push   $0x1
+  804293:	50                   	push   %eax
+  804294:	53                   	push   %ebx
+  804295:	68 9e 52 80 00       	push   $0x80529e
+  80429a:	e8 c2 c8 ff ff       	call   800b61 <cprintf>
+  80429f:	83 c4 10             	add    $0x10,%esp
+  8042a2:	eb b9                	jmp    80425d <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8042a4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8042a7:	0f 94 c0             	sete   %al
+  8042aa:	0f b6 c0             	movzbl %al,%eax
+}
+  8042ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042b0:	5b                   	pop    %ebx
+  8042b1:	5e                   	pop    %esi
+  8042b2:	5f                   	pop    %edi
+  8042b3:	5d                   	pop    %ebp
+  8042b4:	c3                   	ret
+
+008042b5 <devpipe_write>:
+{
+  8042b5:	55                   	push   %ebp
+  8042b6:	89 e5                	mov    %esp,%ebp
+  8042b8:	57                   	push   %edi
+  8042b9:	56                   	push   %esi
+  8042ba:	53                   	push   %ebx
+  8042bb:	83 ec 28             	sub    $0x28,%esp
+  8042be:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8042c1:	56                   	push   %esi
+  8042c2:	e8 f9 db ff ff       	call   801ec0 <fd2data>
+  8042c7:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8042c9:	83 c4 10             	add    $0x10,%esp
+  8042cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042d1:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8042d4:	75 09                	jne    8042df <devpipe_write+0x2a>
+	return i;
+  8042d6:	89 f8                	mov    %edi,%eax
+  8042d8:	eb 23                	jmp    8042fd <devpipe_write+0x48>
+			sys_yield();
+  8042da:	e8 4d d3 ff ff       	call   80162c <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8042df:	8b 43 04             	mov    0x4(%ebx),%eax
+  8042e2:	8b 0b                	mov    (%ebx),%ecx
+  8042e4:	8d 51 20             	lea    0x20(%ecx),%edx
+  8042e7:	39 d0                	cmp    %edx,%eax
+  8042e9:	72 1a                	jb     804305 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8042eb:	89 da                	mov    %ebx,%edx
+  8042ed:	89 f0                	mov    %esi,%eax
+  8042ef:	e8 5c ff ff ff       	call   804250 <_pipeisclosed>
+  8042f4:	85 c0                	test   %eax,%eax
+  8042f6:	74 e2                	je     8042da <devpipe_write+0x25>
+				return 0;
+  8042f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804300:	5b                   	pop    %ebx
+  804301:	5e                   	pop    %esi
+  804302:	5f                   	pop    %edi
+  804303:	5d                   	pop    %ebp
+  804304:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804305:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804308:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80430c:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80430f:	89 c2                	mov    %eax,%edx
+  804311:	c1 fa 1f             	sar    $0x1f,%edx
+  804314:	89 d1                	mov    %edx,%ecx
+  804316:	c1 e9 1b             	shr    $0x1b,%ecx
+  804319:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80431c:	83 e2 1f             	and    $0x1f,%edx
+  80431f:	29 ca                	sub    %ecx,%edx
+  804321:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  804325:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  804329:	83 c0 01             	add    $0x1,%eax
+  80432c:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80432f:	83 c7 01             	add    $0x1,%edi
+  804332:	eb 9d                	jmp    8042d1 <devpipe_write+0x1c>
+
+00804334 <devpipe_read>:
+{
+  804334:	55                   	push   %ebp
+  804335:	89 e5                	mov    %esp,%ebp
+  804337:	57                   	push   %edi
+  804338:	56                   	push   %esi
+  804339:	53                   	push   %ebx
+  80433a:	83 ec 18             	sub    $0x18,%esp
+  80433d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  804340:	57                   	push   %edi
+  804341:	e8 7a db ff ff       	call   801ec0 <fd2data>
+  804346:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  804348:	83 c4 10             	add    $0x10,%esp
+  80434b:	be 00 00 00 00       	mov    $0x0,%esi
+  804350:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804353:	75 13                	jne    804368 <devpipe_read+0x34>
+	return i;
+  804355:	89 f0                	mov    %esi,%eax
+  804357:	eb 02                	jmp    80435b <devpipe_read+0x27>
+				return i;
+  804359:	89 f0                	mov    %esi,%eax
+}
+  80435b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80435e:	5b                   	pop    %ebx
+  80435f:	5e                   	pop    %esi
+  804360:	5f                   	pop    %edi
+  804361:	5d                   	pop    %ebp
+  804362:	c3                   	ret
+			sys_yield();
+  804363:	e8 c4 d2 ff ff       	call   80162c <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  804368:	8b 03                	mov    (%ebx),%eax
+  80436a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80436d:	75 18                	jne    804387 <devpipe_read+0x53>
+			if (i > 0)
+  80436f:	85 f6                	test   %esi,%esi
+  804371:	75 e6                	jne    804359 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  804373:	89 da                	mov    %ebx,%edx
+  804375:	89 f8                	mov    %edi,%eax
+  804377:	e8 d4 fe ff ff       	call   804250 <_pipeisclosed>
+  80437c:	85 c0                	test   %eax,%eax
+  80437e:	74 e3                	je     804363 <devpipe_read+0x2f>
+				return 0;
+  804380:	b8 00 00 00 00       	mov    $0x0,%eax
+  804385:	eb d4                	jmp    80435b <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804387:	99                   	cltd
+  804388:	c1 ea 1b             	shr    $0x1b,%edx
+  80438b:	01 d0                	add    %edx,%eax
+  80438d:	83 e0 1f             	and    $0x1f,%eax
+  804390:	29 d0                	sub    %edx,%eax
+  804392:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  804397:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80439a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80439d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8043a0:	83 c6 01             	add    $0x1,%esi
+  8043a3:	eb ab                	jmp    804350 <devpipe_read+0x1c>
+
+008043a5 <pipe>:
+{
+  8043a5:	55                   	push   %ebp
+  8043a6:	89 e5                	mov    %esp,%ebp
+  8043a8:	56                   	push   %esi
+  8043a9:	53                   	push   %ebx
+  8043aa:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8043ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8043b0:	50                   	push   %eax
+  8043b1:	e8 21 db ff ff       	call   801ed7 <fd_alloc>
+  8043b6:	89 c3                	mov    %eax,%ebx
+  8043b8:	83 c4 10             	add    $0x10,%esp
+  8043bb:	85 c0                	test   %eax,%eax
+  8043bd:	0f 88 23 01 00 00    	js     8044e6 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8043c3:	83 ec 04             	sub    $0x4,%esp
+  8043c6:	68 07 04 00 00       	push   $0x407
+  8043cb:	ff 75 f4             	push   -0xc(%ebp)
+  8043ce:	6a 00                	push   $0x0
+  8043d0:	e8 76 d2 ff ff       	call   80164b <sys_page_alloc>
+  8043d5:	89 c3                	mov    %eax,%ebx
+  8043d7:	83 c4 10             	add    $0x10,%esp
+  8043da:	85 c0                	test   %eax,%eax
+  8043dc:	0f 88 04 01 00 00    	js     8044e6 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8043e2:	83 ec 0c             	sub    $0xc,%esp
+  8043e5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8043e8:	50                   	push   %eax
+  8043e9:	e8 e9 da ff ff       	call   801ed7 <fd_alloc>
+  8043ee:	89 c3                	mov    %eax,%ebx
+  8043f0:	83 c4 10             	add    $0x10,%esp
+  8043f3:	85 c0                	test   %eax,%eax
+  8043f5:	0f 88 db 00 00 00    	js     8044d6 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8043fb:	83 ec 04             	sub    $0x4,%esp
+  8043fe:	68 07 04 00 00       	push   $0x407
+  804403:	ff 75 f0             	push   -0x10(%ebp)
+  804406:	6a 00                	push   $0x0
+  804408:	e8 3e d2 ff ff       	call   80164b <sys_page_alloc>
+  80440d:	89 c3                	mov    %eax,%ebx
+  80440f:	83 c4 10             	add    $0x10,%esp
+  804412:	85 c0                	test   %eax,%eax
+  804414:	0f 88 bc 00 00 00    	js     8044d6 <pipe+0x131>
+	va = fd2data(fd0);
+  80441a:	83 ec 0c             	sub    $0xc,%esp
+  80441d:	ff 75 f4             	push   -0xc(%ebp)
+  804420:	e8 9b da ff ff       	call   801ec0 <fd2data>
+  804425:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804427:	83 c4 0c             	add    $0xc,%esp
+  80442a:	68 07 04 00 00       	push   $0x407
+  80442f:	50                   	push   %eax
+  804430:	6a 00                	push   $0x0
+  804432:	e8 14 d2 ff ff       	call   80164b <sys_page_alloc>
+  804437:	89 c3                	mov    %eax,%ebx
+  804439:	83 c4 10             	add    $0x10,%esp
+  80443c:	85 c0                	test   %eax,%eax
+  80443e:	0f 88 82 00 00 00    	js     8044c6 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804444:	83 ec 0c             	sub    $0xc,%esp
+  804447:	ff 75 f0             	push   -0x10(%ebp)
+  80444a:	e8 71 da ff ff       	call   801ec0 <fd2data>
+  80444f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  804456:	50                   	push   %eax
+  804457:	6a 00                	push   $0x0
+  804459:	56                   	push   %esi
+  80445a:	6a 00                	push   $0x0
+  80445c:	e8 35 d2 ff ff       	call   801696 <sys_page_map>
+  804461:	89 c3                	mov    %eax,%ebx
+  804463:	83 c4 20             	add    $0x20,%esp
+  804466:	85 c0                	test   %eax,%eax
+  804468:	78 4e                	js     8044b8 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80446a:	a1 80 60 80 00       	mov    0x806080,%eax
+  80446f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804472:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  804474:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804477:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80447e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  804481:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  804483:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804486:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80448d:	83 ec 0c             	sub    $0xc,%esp
+  804490:	ff 75 f4             	push   -0xc(%ebp)
+  804493:	e8 18 da ff ff       	call   801eb0 <fd2num>
+  804498:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80449b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80449d:	83 c4 04             	add    $0x4,%esp
+  8044a0:	ff 75 f0             	push   -0x10(%ebp)
+  8044a3:	e8 08 da ff ff       	call   801eb0 <fd2num>
+  8044a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8044ab:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8044ae:	83 c4 10             	add    $0x10,%esp
+  8044b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8044b6:	eb 2e                	jmp    8044e6 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8044b8:	83 ec 08             	sub    $0x8,%esp
+  8044bb:	56                   	push   %esi
+  8044bc:	6a 00                	push   $0x0
+  8044be:	e8 15 d2 ff ff       	call   8016d8 <sys_page_unmap>
+  8044c3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8044c6:	83 ec 08             	sub    $0x8,%esp
+  8044c9:	ff 75 f0             	push   -0x10(%ebp)
+  8044cc:	6a 00                	push   $0x0
+  8044ce:	e8 05 d2 ff ff       	call   8016d8 <sys_page_unmap>
+  8044d3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8044d6:	83 ec 08             	sub    $0x8,%esp
+  8044d9:	ff 75 f4             	push   -0xc(%ebp)
+  8044dc:	6a 00                	push   $0x0
+  8044de:	e8 f5 d1 ff ff       	call   8016d8 <sys_page_unmap>
+  8044e3:	83 c4 10             	add    $0x10,%esp
+}
+  8044e6:	89 d8                	mov    %ebx,%eax
+  8044e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8044eb:	5b                   	pop    %ebx
+  8044ec:	5e                   	pop    %esi
+  8044ed:	5d                   	pop    %ebp
+  8044ee:	c3                   	ret
+
+008044ef <pipeisclosed>:
+{
+  8044ef:	55                   	push   %ebp
+  8044f0:	89 e5                	mov    %esp,%ebp
+  8044f2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8044f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8044f8:	50                   	push   %eax
+  8044f9:	ff 75 08             	push   0x8(%ebp)
+  8044fc:	e8 2c da ff ff       	call   801f2d <fd_lookup>
+  804501:	83 c4 10             	add    $0x10,%esp
+  804504:	85 c0                	test   %eax,%eax
+  804506:	78 18                	js     804520 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  804508:	83 ec 0c             	sub    $0xc,%esp
+  80450b:	ff 75 f4             	push   -0xc(%ebp)
+  80450e:	e8 ad d9 ff ff       	call   801ec0 <fd2data>
+  804513:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  804515:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804518:	e8 33 fd ff ff       	call   804250 <_pipeisclosed>
+  80451d:	83 c4 10             	add    $0x10,%esp
+}
+  804520:	c9                   	leave
+  804521:	c3                   	ret
+
+00804522 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  804522:	55                   	push   %ebp
+  804523:	89 e5                	mov    %esp,%ebp
+  804525:	56                   	push   %esi
+  804526:	53                   	push   %ebx
+  804527:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  80452a:	85 f6                	test   %esi,%esi
+  80452c:	74 16                	je     804544 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  80452e:	89 f3                	mov    %esi,%ebx
+  804530:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  804536:	69 db 8c 00 00 00    	imul   $0x8c,%ebx,%ebx
+  80453c:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  804542:	eb 1b                	jmp    80455f <wait+0x3d>
+	assert(envid != 0);
+  804544:	68 b6 52 80 00       	push   $0x8052b6
+  804549:	68 d3 4b 80 00       	push   $0x804bd3
+  80454e:	6a 09                	push   $0x9
+  804550:	68 c1 52 80 00       	push   $0x8052c1
+  804555:	e8 2c c5 ff ff       	call   800a86 <_panic>
+		sys_yield();
+  80455a:	e8 cd d0 ff ff       	call   80162c <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80455f:	8b 43 48             	mov    0x48(%ebx),%eax
+  804562:	39 f0                	cmp    %esi,%eax
+  804564:	75 07                	jne    80456d <wait+0x4b>
+  804566:	8b 43 54             	mov    0x54(%ebx),%eax
+  804569:	85 c0                	test   %eax,%eax
+  80456b:	75 ed                	jne    80455a <wait+0x38>
+}
+  80456d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804570:	5b                   	pop    %ebx
+  804571:	5e                   	pop    %esi
+  804572:	5d                   	pop    %ebp
+  804573:	c3                   	ret
+
+00804574 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804574:	55                   	push   %ebp
+  804575:	89 e5                	mov    %esp,%ebp
+  804577:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  80457a:	83 3d 04 b0 80 00 00 	cmpl   $0x0,0x80b004
+  804581:	74 0a                	je     80458d <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804583:	8b 45 08             	mov    0x8(%ebp),%eax
+  804586:	a3 04 b0 80 00       	mov    %eax,0x80b004
+}
+  80458b:	c9                   	leave
+  80458c:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80458d:	83 ec 04             	sub    $0x4,%esp
+  804590:	6a 07                	push   $0x7
+  804592:	68 00 f0 bf ee       	push   $0xeebff000
+  804597:	6a 00                	push   $0x0
+  804599:	e8 ad d0 ff ff       	call   80164b <sys_page_alloc>
+  80459e:	83 c4 10             	add    $0x10,%esp
+  8045a1:	85 c0                	test   %eax,%eax
+  8045a3:	75 2c                	jne    8045d1 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8045a5:	83 ec 08             	sub    $0x8,%esp
+  8045a8:	68 e7 45 80 00       	push   $0x8045e7
+  8045ad:	6a 00                	push   $0x0
+  8045af:	e8 02 d2 ff ff       	call   8017b6 <sys_env_set_pgfault_upcall>
+  8045b4:	83 c4 10             	add    $0x10,%esp
+  8045b7:	85 c0                	test   %eax,%eax
+  8045b9:	74 c8                	je     804583 <set_pgfault_handler+0xf>
+  8045bb:	68 14 53 80 00       	push   $0x805314
+  8045c0:	68 d3 4b 80 00       	push   $0x804bd3
+  8045c5:	6a 20                	push   $0x20
+  8045c7:	68 44 53 80 00       	push   $0x805344
+  8045cc:	e8 b5 c4 ff ff       	call   800a86 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8045d1:	68 cc 52 80 00       	push   $0x8052cc
+  8045d6:	68 d3 4b 80 00       	push   $0x804bd3
+  8045db:	6a 1e                	push   $0x1e
+  8045dd:	68 44 53 80 00       	push   $0x805344
+  8045e2:	e8 9f c4 ff ff       	call   800a86 <_panic>
+
+008045e7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8045e7:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8045e8:	a1 04 b0 80 00       	mov    0x80b004,%eax
+	call *%eax
+  8045ed:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8045ef:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8045f2:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8045f7:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8045fc:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  804600:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  804603:	83 c4 08             	add    $0x8,%esp
+	popal
+  804606:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  804607:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80460a:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  80460b:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80460c:	c3                   	ret
+
+0080460d <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80460d:	55                   	push   %ebp
+  80460e:	89 e5                	mov    %esp,%ebp
+  804610:	56                   	push   %esi
+  804611:	53                   	push   %ebx
+  804612:	8b 75 08             	mov    0x8(%ebp),%esi
+  804615:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804618:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80461b:	85 c0                	test   %eax,%eax
+  80461d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804622:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  804625:	83 ec 0c             	sub    $0xc,%esp
+  804628:	50                   	push   %eax
+  804629:	e8 65 d2 ff ff       	call   801893 <sys_ipc_recv>
+	if (from_env_store)
+  80462e:	83 c4 10             	add    $0x10,%esp
+  804631:	85 f6                	test   %esi,%esi
+  804633:	74 14                	je     804649 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  804635:	ba 00 00 00 00       	mov    $0x0,%edx
+  80463a:	85 c0                	test   %eax,%eax
+  80463c:	75 09                	jne    804647 <ipc_recv+0x3a>
+  80463e:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  804644:	8b 52 74             	mov    0x74(%edx),%edx
+  804647:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  804649:	85 db                	test   %ebx,%ebx
+  80464b:	74 25                	je     804672 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80464d:	85 c0                	test   %eax,%eax
+  80464f:	74 0d                	je     80465e <ipc_recv+0x51>
+  804651:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  804657:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80465a:	5b                   	pop    %ebx
+  80465b:	5e                   	pop    %esi
+  80465c:	5d                   	pop    %ebp
+  80465d:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80465e:	a1 14 70 80 00       	mov    0x807014,%eax
+  804663:	8b 40 78             	mov    0x78(%eax),%eax
+  804666:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  804668:	a1 14 70 80 00       	mov    0x807014,%eax
+  80466d:	8b 40 70             	mov    0x70(%eax),%eax
+  804670:	eb e5                	jmp    804657 <ipc_recv+0x4a>
+  804672:	85 c0                	test   %eax,%eax
+  804674:	75 e1                	jne    804657 <ipc_recv+0x4a>
+  804676:	eb f0                	jmp    804668 <ipc_recv+0x5b>
+
+00804678 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804678:	55                   	push   %ebp
+  804679:	89 e5                	mov    %esp,%ebp
+  80467b:	57                   	push   %edi
+  80467c:	56                   	push   %esi
+  80467d:	53                   	push   %ebx
+  80467e:	83 ec 0c             	sub    $0xc,%esp
+  804681:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804684:	8b 75 0c             	mov    0xc(%ebp),%esi
+  804687:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80468a:	85 db                	test   %ebx,%ebx
+  80468c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804691:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804694:	ff 75 14             	push   0x14(%ebp)
+  804697:	53                   	push   %ebx
+  804698:	56                   	push   %esi
+  804699:	57                   	push   %edi
+  80469a:	e8 61 d1 ff ff       	call   801800 <sys_ipc_try_send>
+  80469f:	83 c4 10             	add    $0x10,%esp
+  8046a2:	85 c0                	test   %eax,%eax
+  8046a4:	74 22                	je     8046c8 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8046a6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8046a9:	75 07                	jne    8046b2 <ipc_send+0x3a>
+		sys_yield();
+  8046ab:	e8 7c cf ff ff       	call   80162c <sys_yield>
+  8046b0:	eb e2                	jmp    804694 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8046b2:	68 52 53 80 00       	push   $0x805352
+  8046b7:	68 d3 4b 80 00       	push   $0x804bd3
+  8046bc:	6a 39                	push   $0x39
+  8046be:	68 67 53 80 00       	push   $0x805367
+  8046c3:	e8 be c3 ff ff       	call   800a86 <_panic>
+	}
+}
+  8046c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046cb:	5b                   	pop    %ebx
+  8046cc:	5e                   	pop    %esi
+  8046cd:	5f                   	pop    %edi
+  8046ce:	5d                   	pop    %ebp
+  8046cf:	c3                   	ret
+
+008046d0 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  8046d0:	55                   	push   %ebp
+  8046d1:	89 e5                	mov    %esp,%ebp
+  8046d3:	57                   	push   %edi
+  8046d4:	56                   	push   %esi
+  8046d5:	53                   	push   %ebx
+  8046d6:	83 ec 10             	sub    $0x10,%esp
+  8046d9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8046dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8046df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8046e2:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8046e5:	85 c0                	test   %eax,%eax
+  8046e7:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8046ec:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8046ef:	6a 00                	push   $0x0
+  8046f1:	ff 33                	push   (%ebx)
+  8046f3:	50                   	push   %eax
+  8046f4:	e8 57 d1 ff ff       	call   801850 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8046f9:	83 c4 10             	add    $0x10,%esp
+  8046fc:	85 c0                	test   %eax,%eax
+  8046fe:	75 3c                	jne    80473c <ipc_recvv+0x6c>
+  804700:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  804706:	8b 52 7c             	mov    0x7c(%edx),%edx
+  804709:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  80470b:	85 ff                	test   %edi,%edi
+  80470d:	74 4e                	je     80475d <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80470f:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  804715:	8b 52 74             	mov    0x74(%edx),%edx
+  804718:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  80471a:	85 f6                	test   %esi,%esi
+  80471c:	74 18                	je     804736 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80471e:	85 c0                	test   %eax,%eax
+  804720:	75 2d                	jne    80474f <ipc_recvv+0x7f>
+  804722:	a1 14 70 80 00       	mov    0x807014,%eax
+  804727:	8b 40 78             	mov    0x78(%eax),%eax
+  80472a:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  80472c:	a1 14 70 80 00       	mov    0x807014,%eax
+  804731:	8b 40 70             	mov    0x70(%eax),%eax
+  804734:	eb 1f                	jmp    804755 <ipc_recvv+0x85>
+  804736:	85 c0                	test   %eax,%eax
+  804738:	75 1b                	jne    804755 <ipc_recvv+0x85>
+  80473a:	eb f0                	jmp    80472c <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80473c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  804742:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  804747:	85 ff                	test   %edi,%edi
+  804749:	75 cd                	jne    804718 <ipc_recvv+0x48>
+	if (perm_store)
+  80474b:	85 f6                	test   %esi,%esi
+  80474d:	74 e7                	je     804736 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80474f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  804755:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804758:	5b                   	pop    %ebx
+  804759:	5e                   	pop    %esi
+  80475a:	5f                   	pop    %edi
+  80475b:	5d                   	pop    %ebp
+  80475c:	c3                   	ret
+	if (perm_store)
+  80475d:	85 f6                	test   %esi,%esi
+  80475f:	75 bd                	jne    80471e <ipc_recvv+0x4e>
+  804761:	eb c9                	jmp    80472c <ipc_recvv+0x5c>
+
+00804763 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  804763:	55                   	push   %ebp
+  804764:	89 e5                	mov    %esp,%ebp
+  804766:	57                   	push   %edi
+  804767:	56                   	push   %esi
+  804768:	53                   	push   %ebx
+  804769:	83 ec 0c             	sub    $0xc,%esp
+  80476c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80476f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  804772:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  804775:	ff 75 14             	push   0x14(%ebp)
+  804778:	53                   	push   %ebx
+  804779:	56                   	push   %esi
+  80477a:	57                   	push   %edi
+  80477b:	e8 a8 d0 ff ff       	call   801828 <sys_ipc_try_sendv>
+  804780:	83 c4 10             	add    $0x10,%esp
+  804783:	85 c0                	test   %eax,%eax
+  804785:	74 22                	je     8047a9 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  804787:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80478a:	75 07                	jne    804793 <ipc_sendv+0x30>
+		sys_yield();
+  80478c:	e8 9b ce ff ff       	call   80162c <sys_yield>
+  804791:	eb e2                	jmp    804775 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  804793:	68 52 53 80 00       	push   $0x805352
+  804798:	68 d3 4b 80 00       	push   $0x804bd3
+  80479d:	6a 5c                	push   $0x5c
+  80479f:	68 67 53 80 00       	push   $0x805367
+  8047a4:	e8 dd c2 ff ff       	call   800a86 <_panic>
+	}
+}
+  8047a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047ac:	5b                   	pop    %ebx
+  8047ad:	5e                   	pop    %esi
+  8047ae:	5f                   	pop    %edi
+  8047af:	5d                   	pop    %ebp
+  8047b0:	c3                   	ret
+
+008047b1 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8047b1:	55                   	push   %ebp
+  8047b2:	89 e5                	mov    %esp,%ebp
+  8047b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8047b7:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8047bc:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8047c2:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8047c8:	8b 52 50             	mov    0x50(%edx),%edx
+  8047cb:	39 ca                	cmp    %ecx,%edx
+  8047cd:	74 11                	je     8047e0 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8047cf:	83 c0 01             	add    $0x1,%eax
+  8047d2:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8047d7:	75 e3                	jne    8047bc <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8047d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047de:	eb 0e                	jmp    8047ee <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8047e0:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8047e6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8047eb:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8047ee:	5d                   	pop    %ebp
+  8047ef:	c3                   	ret
+
+008047f0 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8047f0:	55                   	push   %ebp
+  8047f1:	89 e5                	mov    %esp,%ebp
+  8047f3:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8047f6:	89 c2                	mov    %eax,%edx
+  8047f8:	c1 ea 16             	shr    $0x16,%edx
+  8047fb:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804802:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804807:	f6 c1 01             	test   $0x1,%cl
+  80480a:	74 22                	je     80482e <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80480c:	c1 e8 0c             	shr    $0xc,%eax
+  80480f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804816:	a8 01                	test   $0x1,%al
+  804818:	74 14                	je     80482e <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80481a:	c1 e8 0c             	shr    $0xc,%eax
+  80481d:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  804820:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  804827:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  80482b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80482e:	89 d0                	mov    %edx,%eax
+  804830:	5d                   	pop    %ebp
+  804831:	c3                   	ret
+
+00804832 <dm>:
+  804832:	55                   	push   %ebp
+  804833:	57                   	push   %edi
+  804834:	56                   	push   %esi
+  804835:	53                   	push   %ebx
+  804836:	83 ec 24             	sub    $0x24,%esp
+  804839:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80483d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804841:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804845:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804849:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80484d:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804851:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  804855:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80485a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80485f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804864:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80486b:	00 
+  80486c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804873:	00 
+  804874:	89 fb                	mov    %edi,%ebx
+  804876:	eb 08                	jmp    804880 <dm+0x4e>
+  804878:	83 e9 01             	sub    $0x1,%ecx
+  80487b:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80487e:	74 68                	je     8048e8 <dm+0xb6>
+  804880:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804884:	01 c0                	add    %eax,%eax
+  804886:	89 c6                	mov    %eax,%esi
+  804888:	89 d7                	mov    %edx,%edi
+  80488a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80488e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804892:	0f ad d0             	shrd   %cl,%edx,%eax
+  804895:	d3 ea                	shr    %cl,%edx
+  804897:	f6 c1 20             	test   $0x20,%cl
+  80489a:	74 04                	je     8048a0 <dm+0x6e>
+  80489c:	89 d0                	mov    %edx,%eax
+  80489e:	31 d2                	xor    %edx,%edx
+  8048a0:	83 e0 01             	and    $0x1,%eax
+  8048a3:	89 04 24             	mov    %eax,(%esp)
+  8048a6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8048ad:	00 
+  8048ae:	8b 04 24             	mov    (%esp),%eax
+  8048b1:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8048b5:	09 f0                	or     %esi,%eax
+  8048b7:	09 fa                	or     %edi,%edx
+  8048b9:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8048bd:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8048c1:	39 f0                	cmp    %esi,%eax
+  8048c3:	89 d5                	mov    %edx,%ebp
+  8048c5:	19 fd                	sbb    %edi,%ebp
+  8048c7:	72 af                	jb     804878 <dm+0x46>
+  8048c9:	29 f0                	sub    %esi,%eax
+  8048cb:	19 fa                	sbb    %edi,%edx
+  8048cd:	89 cf                	mov    %ecx,%edi
+  8048cf:	c1 ef 05             	shr    $0x5,%edi
+  8048d2:	83 e7 01             	and    $0x1,%edi
+  8048d5:	89 fe                	mov    %edi,%esi
+  8048d7:	83 f6 01             	xor    $0x1,%esi
+  8048da:	d3 e6                	shl    %cl,%esi
+  8048dc:	d3 e7                	shl    %cl,%edi
+  8048de:	09 74 24 18          	or     %esi,0x18(%esp)
+  8048e2:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8048e6:	eb 90                	jmp    804878 <dm+0x46>
+  8048e8:	85 db                	test   %ebx,%ebx
+  8048ea:	74 05                	je     8048f1 <dm+0xbf>
+  8048ec:	89 03                	mov    %eax,(%ebx)
+  8048ee:	89 53 04             	mov    %edx,0x4(%ebx)
+  8048f1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8048f5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8048f9:	83 c4 24             	add    $0x24,%esp
+  8048fc:	5b                   	pop    %ebx
+  8048fd:	5e                   	pop    %esi
+  8048fe:	5f                   	pop    %edi
+  8048ff:	5d                   	pop    %ebp
+  804900:	c3                   	ret
+
+00804901 <__udivdi3>:
+  804901:	83 ec 08             	sub    $0x8,%esp
+  804904:	6a 00                	push   $0x0
+  804906:	ff 74 24 1c          	push   0x1c(%esp)
+  80490a:	ff 74 24 1c          	push   0x1c(%esp)
+  80490e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804912:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804916:	e8 17 ff ff ff       	call   804832 <dm>
+  80491b:	83 c4 14             	add    $0x14,%esp
+  80491e:	c3                   	ret
+
+0080491f <__umoddi3>:
+  80491f:	83 ec 18             	sub    $0x18,%esp
+  804922:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804926:	50                   	push   %eax
+  804927:	ff 74 24 2c          	push   0x2c(%esp)
+  80492b:	ff 74 24 2c          	push   0x2c(%esp)
+  80492f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804933:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804937:	e8 f6 fe ff ff       	call   804832 <dm>
+  80493c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804940:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804944:	83 c4 24             	add    $0x24,%esp
+  804947:	c3                   	ret
+
+00804948 <__divdi3>:
+  804948:	53                   	push   %ebx
+  804949:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80494d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804951:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  804955:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804959:	85 d2                	test   %edx,%edx
+  80495b:	78 15                	js     804972 <__divdi3+0x2a>
+  80495d:	85 db                	test   %ebx,%ebx
+  80495f:	78 34                	js     804995 <__divdi3+0x4d>
+  804961:	83 ec 04             	sub    $0x4,%esp
+  804964:	6a 00                	push   $0x0
+  804966:	53                   	push   %ebx
+  804967:	51                   	push   %ecx
+  804968:	e8 c5 fe ff ff       	call   804832 <dm>
+  80496d:	83 c4 10             	add    $0x10,%esp
+  804970:	eb 21                	jmp    804993 <__divdi3+0x4b>
+  804972:	f7 d8                	neg    %eax
+  804974:	83 d2 00             	adc    $0x0,%edx
+  804977:	f7 da                	neg    %edx
+  804979:	85 db                	test   %ebx,%ebx
+  80497b:	78 30                	js     8049ad <__divdi3+0x65>
+  80497d:	83 ec 04             	sub    $0x4,%esp
+  804980:	6a 00                	push   $0x0
+  804982:	53                   	push   %ebx
+  804983:	51                   	push   %ecx
+  804984:	e8 a9 fe ff ff       	call   804832 <dm>
+  804989:	83 c4 10             	add    $0x10,%esp
+  80498c:	f7 d8                	neg    %eax
+  80498e:	83 d2 00             	adc    $0x0,%edx
+  804991:	f7 da                	neg    %edx
+  804993:	5b                   	pop    %ebx
+  804994:	c3                   	ret
+  804995:	83 ec 04             	sub    $0x4,%esp
+  804998:	6a 00                	push   $0x0
+  80499a:	f7 d9                	neg    %ecx
+  80499c:	83 d3 00             	adc    $0x0,%ebx
+  80499f:	f7 db                	neg    %ebx
+  8049a1:	53                   	push   %ebx
+  8049a2:	51                   	push   %ecx
+  8049a3:	e8 8a fe ff ff       	call   804832 <dm>
+  8049a8:	83 c4 10             	add    $0x10,%esp
+  8049ab:	eb df                	jmp    80498c <__divdi3+0x44>
+  8049ad:	83 ec 04             	sub    $0x4,%esp
+  8049b0:	6a 00                	push   $0x0
+  8049b2:	f7 d9                	neg    %ecx
+  8049b4:	83 d3 00             	adc    $0x0,%ebx
+  8049b7:	f7 db                	neg    %ebx
+  8049b9:	53                   	push   %ebx
+  8049ba:	51                   	push   %ecx
+  8049bb:	e8 72 fe ff ff       	call   804832 <dm>
+  8049c0:	83 c4 10             	add    $0x10,%esp
+  8049c3:	eb ce                	jmp    804993 <__divdi3+0x4b>
+
+008049c5 <__moddi3>:
+  8049c5:	55                   	push   %ebp
+  8049c6:	57                   	push   %edi
+  8049c7:	56                   	push   %esi
+  8049c8:	53                   	push   %ebx
+  8049c9:	83 ec 24             	sub    $0x24,%esp
+  8049cc:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8049d0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8049d4:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8049d8:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8049dc:	85 d2                	test   %edx,%edx
+  8049de:	78 3b                	js     804a1b <__moddi3+0x56>
+  8049e0:	83 ec 04             	sub    $0x4,%esp
+  8049e3:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8049e7:	56                   	push   %esi
+  8049e8:	89 ce                	mov    %ecx,%esi
+  8049ea:	f7 de                	neg    %esi
+  8049ec:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8049f0:	89 de                	mov    %ebx,%esi
+  8049f2:	83 d6 00             	adc    $0x0,%esi
+  8049f5:	f7 de                	neg    %esi
+  8049f7:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8049fb:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8049ff:	0f 48 f1             	cmovs  %ecx,%esi
+  804a02:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804a07:	53                   	push   %ebx
+  804a08:	56                   	push   %esi
+  804a09:	e8 24 fe ff ff       	call   804832 <dm>
+  804a0e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804a12:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804a16:	83 c4 10             	add    $0x10,%esp
+  804a19:	eb 47                	jmp    804a62 <__moddi3+0x9d>
+  804a1b:	f7 d8                	neg    %eax
+  804a1d:	83 d2 00             	adc    $0x0,%edx
+  804a20:	f7 da                	neg    %edx
+  804a22:	83 ec 04             	sub    $0x4,%esp
+  804a25:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804a29:	56                   	push   %esi
+  804a2a:	89 cf                	mov    %ecx,%edi
+  804a2c:	f7 df                	neg    %edi
+  804a2e:	89 de                	mov    %ebx,%esi
+  804a30:	83 d6 00             	adc    $0x0,%esi
+  804a33:	f7 de                	neg    %esi
+  804a35:	0f 49 cf             	cmovns %edi,%ecx
+  804a38:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804a3c:	0f 49 de             	cmovns %esi,%ebx
+  804a3f:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804a43:	ff 74 24 0c          	push   0xc(%esp)
+  804a47:	ff 74 24 0c          	push   0xc(%esp)
+  804a4b:	e8 e2 fd ff ff       	call   804832 <dm>
+  804a50:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804a54:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804a58:	f7 d8                	neg    %eax
+  804a5a:	83 d2 00             	adc    $0x0,%edx
+  804a5d:	f7 da                	neg    %edx
+  804a5f:	83 c4 10             	add    $0x10,%esp
+  804a62:	83 c4 24             	add    $0x24,%esp
+  804a65:	5b                   	pop    %ebx
+  804a66:	5e                   	pop    %esi
+  804a67:	5f                   	pop    %edi
+  804a68:	5d                   	pop    %ebp
+  804a69:	c3                   	ret
@@ -0,0 +1,7620 @@
+
+obj/user/softint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 05 00 00 00       	call   800036 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $14");	// page fault
+  800033:	cd 0e                	int    $0xe
+}
+  800035:	c3                   	ret
+
+00800036 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800036:	55                   	push   %ebp
+  800037:	89 e5                	mov    %esp,%ebp
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800041:	e8 e9 00 00 00       	call   80012f <sys_getenvid>
+  800046:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004b:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800051:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800056:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80005b:	85 db                	test   %ebx,%ebx
+  80005d:	7e 07                	jle    800066 <libmain+0x30>
+		binaryname = argv[0];
+  80005f:	8b 06                	mov    (%esi),%eax
+  800061:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800066:	83 ec 08             	sub    $0x8,%esp
+  800069:	56                   	push   %esi
+  80006a:	53                   	push   %ebx
+  80006b:	e8 c3 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800070:	e8 0a 00 00 00       	call   80007f <exit>
+}
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80007b:	5b                   	pop    %ebx
+  80007c:	5e                   	pop    %esi
+  80007d:	5d                   	pop    %ebp
+  80007e:	c3                   	ret
+
+0080007f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80007f:	55                   	push   %ebp
+  800080:	89 e5                	mov    %esp,%ebp
+  800082:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800085:	e8 c0 06 00 00       	call   80074a <close_all>
+	sys_env_destroy(0);
+  80008a:	83 ec 0c             	sub    $0xc,%esp
+  80008d:	6a 00                	push   $0x0
+  80008f:	e8 52 00 00 00       	call   8000e6 <sys_env_destroy>
+}
+  800094:	83 c4 10             	add    $0x10,%esp
+  800097:	c9                   	leave
+  800098:	c3                   	ret
+
+00800099 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800099:	55                   	push   %ebp
+  80009a:	89 e5                	mov    %esp,%ebp
+  80009c:	57                   	push   %edi
+  80009d:	56                   	push   %esi
+  80009e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80009f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000aa:	89 c3                	mov    %eax,%ebx
+  8000ac:	89 c7                	mov    %eax,%edi
+  8000ae:	55                   	push   %ebp
+  8000af:	89 e5                	mov    %esp,%ebp
+  8000b1:	8d 35 b9 00 80 00    	lea    0x8000b9,%esi
+  8000b7:	0f 34                	sysenter
+  8000b9:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  8000ba:	5b                   	pop    %ebx
+  8000bb:	5e                   	pop    %esi
+  8000bc:	5f                   	pop    %edi
+  8000bd:	5d                   	pop    %ebp
+  8000be:	c3                   	ret
+
+008000bf <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000bf:	55                   	push   %ebp
+  8000c0:	89 e5                	mov    %esp,%ebp
+  8000c2:	57                   	push   %edi
+  8000c3:	56                   	push   %esi
+  8000c4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8000c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000cf:	89 d1                	mov    %edx,%ecx
+  8000d1:	89 d3                	mov    %edx,%ebx
+  8000d3:	89 d7                	mov    %edx,%edi
+  8000d5:	55                   	push   %ebp
+  8000d6:	89 e5                	mov    %esp,%ebp
+  8000d8:	8d 35 e0 00 80 00    	lea    0x8000e0,%esi
+  8000de:	0f 34                	sysenter
+  8000e0:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  8000e1:	5b                   	pop    %ebx
+  8000e2:	5e                   	pop    %esi
+  8000e3:	5f                   	pop    %edi
+  8000e4:	5d                   	pop    %ebp
+  8000e5:	c3                   	ret
+
+008000e6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000e6:	55                   	push   %ebp
+  8000e7:	89 e5                	mov    %esp,%ebp
+  8000e9:	57                   	push   %edi
+  8000ea:	56                   	push   %esi
+  8000eb:	53                   	push   %ebx
+  8000ec:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8000ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000fc:	89 cb                	mov    %ecx,%ebx
+  8000fe:	89 cf                	mov    %ecx,%edi
+  800100:	55                   	push   %ebp
+  800101:	89 e5                	mov    %esp,%ebp
+  800103:	8d 35 0b 01 80 00    	lea    0x80010b,%esi
+  800109:	0f 34                	sysenter
+  80010b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80010c:	85 c0                	test   %eax,%eax
+  80010e:	7f 08                	jg     800118 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800110:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800113:	5b                   	pop    %ebx
+  800114:	5e                   	pop    %esi
+  800115:	5f                   	pop    %edi
+  800116:	5d                   	pop    %ebp
+  800117:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800118:	83 ec 0c             	sub    $0xc,%esp
+  80011b:	50                   	push   %eax
+  80011c:	6a 03                	push   $0x3
+  80011e:	68 4a 37 80 00       	push   $0x80374a
+  800123:	6a 3d                	push   $0x3d
+  800125:	68 67 37 80 00       	push   $0x803767
+  80012a:	e8 02 24 00 00       	call   802531 <_panic>
+
+0080012f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80012f:	55                   	push   %ebp
+  800130:	89 e5                	mov    %esp,%ebp
+  800132:	57                   	push   %edi
+  800133:	56                   	push   %esi
+  800134:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80013f:	89 d1                	mov    %edx,%ecx
+  800141:	89 d3                	mov    %edx,%ebx
+  800143:	89 d7                	mov    %edx,%edi
+  800145:	55                   	push   %ebp
+  800146:	89 e5                	mov    %esp,%ebp
+  800148:	8d 35 50 01 80 00    	lea    0x800150,%esi
+  80014e:	0f 34                	sysenter
+  800150:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800151:	5b                   	pop    %ebx
+  800152:	5e                   	pop    %esi
+  800153:	5f                   	pop    %edi
+  800154:	5d                   	pop    %ebp
+  800155:	c3                   	ret
+
+00800156 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800156:	55                   	push   %ebp
+  800157:	89 e5                	mov    %esp,%ebp
+  800159:	57                   	push   %edi
+  80015a:	56                   	push   %esi
+  80015b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80015c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800161:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800166:	89 d1                	mov    %edx,%ecx
+  800168:	89 d3                	mov    %edx,%ebx
+  80016a:	89 d7                	mov    %edx,%edi
+  80016c:	89 d6                	mov    %edx,%esi
+  80016e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800170:	5b                   	pop    %ebx
+  800171:	5e                   	pop    %esi
+  800172:	5f                   	pop    %edi
+  800173:	5d                   	pop    %ebp
+  800174:	c3                   	ret
+
+00800175 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800175:	55                   	push   %ebp
+  800176:	89 e5                	mov    %esp,%ebp
+  800178:	57                   	push   %edi
+  800179:	56                   	push   %esi
+  80017a:	53                   	push   %ebx
+  80017b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80017e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800181:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800184:	b8 04 00 00 00       	mov    $0x4,%eax
+  800189:	bf 00 00 00 00       	mov    $0x0,%edi
+  80018e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800191:	55                   	push   %ebp
+  800192:	89 e5                	mov    %esp,%ebp
+  800194:	8d 35 9c 01 80 00    	lea    0x80019c,%esi
+  80019a:	0f 34                	sysenter
+  80019c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80019d:	85 c0                	test   %eax,%eax
+  80019f:	7f 08                	jg     8001a9 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  8001a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a4:	5b                   	pop    %ebx
+  8001a5:	5e                   	pop    %esi
+  8001a6:	5f                   	pop    %edi
+  8001a7:	5d                   	pop    %ebp
+  8001a8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001a9:	83 ec 0c             	sub    $0xc,%esp
+  8001ac:	50                   	push   %eax
+  8001ad:	6a 04                	push   $0x4
+  8001af:	68 4a 37 80 00       	push   $0x80374a
+  8001b4:	6a 3d                	push   $0x3d
+  8001b6:	68 67 37 80 00       	push   $0x803767
+  8001bb:	e8 71 23 00 00       	call   802531 <_panic>
+
+008001c0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001c0:	55                   	push   %ebp
+  8001c1:	89 e5                	mov    %esp,%ebp
+  8001c3:	57                   	push   %edi
+  8001c4:	56                   	push   %esi
+  8001c5:	53                   	push   %ebx
+  8001c6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001cf:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001da:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001dd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001df:	85 c0                	test   %eax,%eax
+  8001e1:	7f 08                	jg     8001eb <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8001e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001e6:	5b                   	pop    %ebx
+  8001e7:	5e                   	pop    %esi
+  8001e8:	5f                   	pop    %edi
+  8001e9:	5d                   	pop    %ebp
+  8001ea:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001eb:	83 ec 0c             	sub    $0xc,%esp
+  8001ee:	50                   	push   %eax
+  8001ef:	6a 05                	push   $0x5
+  8001f1:	68 4a 37 80 00       	push   $0x80374a
+  8001f6:	6a 23                	push   $0x23
+  8001f8:	68 67 37 80 00       	push   $0x803767
+  8001fd:	e8 2f 23 00 00       	call   802531 <_panic>
+
+00800202 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800202:	55                   	push   %ebp
+  800203:	89 e5                	mov    %esp,%ebp
+  800205:	57                   	push   %edi
+  800206:	56                   	push   %esi
+  800207:	53                   	push   %ebx
+  800208:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80020b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800210:	8b 55 08             	mov    0x8(%ebp),%edx
+  800213:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800216:	b8 06 00 00 00       	mov    $0x6,%eax
+  80021b:	89 df                	mov    %ebx,%edi
+  80021d:	55                   	push   %ebp
+  80021e:	89 e5                	mov    %esp,%ebp
+  800220:	8d 35 28 02 80 00    	lea    0x800228,%esi
+  800226:	0f 34                	sysenter
+  800228:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800229:	85 c0                	test   %eax,%eax
+  80022b:	7f 08                	jg     800235 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  80022d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800230:	5b                   	pop    %ebx
+  800231:	5e                   	pop    %esi
+  800232:	5f                   	pop    %edi
+  800233:	5d                   	pop    %ebp
+  800234:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800235:	83 ec 0c             	sub    $0xc,%esp
+  800238:	50                   	push   %eax
+  800239:	6a 06                	push   $0x6
+  80023b:	68 4a 37 80 00       	push   $0x80374a
+  800240:	6a 3d                	push   $0x3d
+  800242:	68 67 37 80 00       	push   $0x803767
+  800247:	e8 e5 22 00 00       	call   802531 <_panic>
+
+0080024c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80024c:	55                   	push   %ebp
+  80024d:	89 e5                	mov    %esp,%ebp
+  80024f:	57                   	push   %edi
+  800250:	56                   	push   %esi
+  800251:	53                   	push   %ebx
+  800252:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800255:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80025a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80025d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800260:	b8 08 00 00 00       	mov    $0x8,%eax
+  800265:	89 df                	mov    %ebx,%edi
+  800267:	55                   	push   %ebp
+  800268:	89 e5                	mov    %esp,%ebp
+  80026a:	8d 35 72 02 80 00    	lea    0x800272,%esi
+  800270:	0f 34                	sysenter
+  800272:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800273:	85 c0                	test   %eax,%eax
+  800275:	7f 08                	jg     80027f <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800277:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027a:	5b                   	pop    %ebx
+  80027b:	5e                   	pop    %esi
+  80027c:	5f                   	pop    %edi
+  80027d:	5d                   	pop    %ebp
+  80027e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80027f:	83 ec 0c             	sub    $0xc,%esp
+  800282:	50                   	push   %eax
+  800283:	6a 08                	push   $0x8
+  800285:	68 4a 37 80 00       	push   $0x80374a
+  80028a:	6a 3d                	push   $0x3d
+  80028c:	68 67 37 80 00       	push   $0x803767
+  800291:	e8 9b 22 00 00       	call   802531 <_panic>
+
+00800296 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800296:	55                   	push   %ebp
+  800297:	89 e5                	mov    %esp,%ebp
+  800299:	57                   	push   %edi
+  80029a:	56                   	push   %esi
+  80029b:	53                   	push   %ebx
+  80029c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80029f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002aa:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002af:	89 df                	mov    %ebx,%edi
+  8002b1:	55                   	push   %ebp
+  8002b2:	89 e5                	mov    %esp,%ebp
+  8002b4:	8d 35 bc 02 80 00    	lea    0x8002bc,%esi
+  8002ba:	0f 34                	sysenter
+  8002bc:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8002bd:	85 c0                	test   %eax,%eax
+  8002bf:	7f 08                	jg     8002c9 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  8002c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c4:	5b                   	pop    %ebx
+  8002c5:	5e                   	pop    %esi
+  8002c6:	5f                   	pop    %edi
+  8002c7:	5d                   	pop    %ebp
+  8002c8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002c9:	83 ec 0c             	sub    $0xc,%esp
+  8002cc:	50                   	push   %eax
+  8002cd:	6a 09                	push   $0x9
+  8002cf:	68 4a 37 80 00       	push   $0x80374a
+  8002d4:	6a 3d                	push   $0x3d
+  8002d6:	68 67 37 80 00       	push   $0x803767
+  8002db:	e8 51 22 00 00       	call   802531 <_panic>
+
+008002e0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002e0:	55                   	push   %ebp
+  8002e1:	89 e5                	mov    %esp,%ebp
+  8002e3:	57                   	push   %edi
+  8002e4:	56                   	push   %esi
+  8002e5:	53                   	push   %ebx
+  8002e6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8002e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002f9:	89 df                	mov    %ebx,%edi
+  8002fb:	55                   	push   %ebp
+  8002fc:	89 e5                	mov    %esp,%ebp
+  8002fe:	8d 35 06 03 80 00    	lea    0x800306,%esi
+  800304:	0f 34                	sysenter
+  800306:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800307:	85 c0                	test   %eax,%eax
+  800309:	7f 08                	jg     800313 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  80030b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030e:	5b                   	pop    %ebx
+  80030f:	5e                   	pop    %esi
+  800310:	5f                   	pop    %edi
+  800311:	5d                   	pop    %ebp
+  800312:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800313:	83 ec 0c             	sub    $0xc,%esp
+  800316:	50                   	push   %eax
+  800317:	6a 0a                	push   $0xa
+  800319:	68 4a 37 80 00       	push   $0x80374a
+  80031e:	6a 3d                	push   $0x3d
+  800320:	68 67 37 80 00       	push   $0x803767
+  800325:	e8 07 22 00 00       	call   802531 <_panic>
+
+0080032a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80032a:	55                   	push   %ebp
+  80032b:	89 e5                	mov    %esp,%ebp
+  80032d:	57                   	push   %edi
+  80032e:	56                   	push   %esi
+  80032f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800330:	8b 55 08             	mov    0x8(%ebp),%edx
+  800333:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800336:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80033b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80033e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800341:	55                   	push   %ebp
+  800342:	89 e5                	mov    %esp,%ebp
+  800344:	8d 35 4c 03 80 00    	lea    0x80034c,%esi
+  80034a:	0f 34                	sysenter
+  80034c:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  80034d:	5b                   	pop    %ebx
+  80034e:	5e                   	pop    %esi
+  80034f:	5f                   	pop    %edi
+  800350:	5d                   	pop    %ebp
+  800351:	c3                   	ret
+
+00800352 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800352:	55                   	push   %ebp
+  800353:	89 e5                	mov    %esp,%ebp
+  800355:	57                   	push   %edi
+  800356:	56                   	push   %esi
+  800357:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800358:	8b 55 08             	mov    0x8(%ebp),%edx
+  80035b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80035e:	b8 17 00 00 00       	mov    $0x17,%eax
+  800363:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800366:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800369:	55                   	push   %ebp
+  80036a:	89 e5                	mov    %esp,%ebp
+  80036c:	8d 35 74 03 80 00    	lea    0x800374,%esi
+  800372:	0f 34                	sysenter
+  800374:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800375:	5b                   	pop    %ebx
+  800376:	5e                   	pop    %esi
+  800377:	5f                   	pop    %edi
+  800378:	5d                   	pop    %ebp
+  800379:	c3                   	ret
+
+0080037a <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  80037a:	55                   	push   %ebp
+  80037b:	89 e5                	mov    %esp,%ebp
+  80037d:	57                   	push   %edi
+  80037e:	56                   	push   %esi
+  80037f:	53                   	push   %ebx
+  800380:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800383:	be 00 00 00 00       	mov    $0x0,%esi
+  800388:	8b 55 08             	mov    0x8(%ebp),%edx
+  80038b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80038e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800393:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800396:	89 f7                	mov    %esi,%edi
+  800398:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80039a:	85 c0                	test   %eax,%eax
+  80039c:	7f 08                	jg     8003a6 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  80039e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a1:	5b                   	pop    %ebx
+  8003a2:	5e                   	pop    %esi
+  8003a3:	5f                   	pop    %edi
+  8003a4:	5d                   	pop    %ebp
+  8003a5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003a6:	83 ec 0c             	sub    $0xc,%esp
+  8003a9:	50                   	push   %eax
+  8003aa:	6a 0d                	push   $0xd
+  8003ac:	68 4a 37 80 00       	push   $0x80374a
+  8003b1:	6a 23                	push   $0x23
+  8003b3:	68 67 37 80 00       	push   $0x803767
+  8003b8:	e8 74 21 00 00       	call   802531 <_panic>
+
+008003bd <sys_ipc_recv>:
+{
+  8003bd:	55                   	push   %ebp
+  8003be:	89 e5                	mov    %esp,%ebp
+  8003c0:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  8003c3:	6a 00                	push   $0x0
+  8003c5:	6a 01                	push   $0x1
+  8003c7:	ff 75 08             	push   0x8(%ebp)
+  8003ca:	e8 ab ff ff ff       	call   80037a <sys_ipc_recvv>
+}
+  8003cf:	c9                   	leave
+  8003d0:	c3                   	ret
+
+008003d1 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  8003d1:	55                   	push   %ebp
+  8003d2:	89 e5                	mov    %esp,%ebp
+  8003d4:	57                   	push   %edi
+  8003d5:	56                   	push   %esi
+  8003d6:	53                   	push   %ebx
+  8003d7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003e5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003ea:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003ed:	89 de                	mov    %ebx,%esi
+  8003ef:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003f1:	85 c0                	test   %eax,%eax
+  8003f3:	7f 08                	jg     8003fd <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  8003f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f8:	5b                   	pop    %ebx
+  8003f9:	5e                   	pop    %esi
+  8003fa:	5f                   	pop    %edi
+  8003fb:	5d                   	pop    %ebp
+  8003fc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003fd:	83 ec 0c             	sub    $0xc,%esp
+  800400:	50                   	push   %eax
+  800401:	6a 0d                	push   $0xd
+  800403:	68 4a 37 80 00       	push   $0x80374a
+  800408:	6a 23                	push   $0x23
+  80040a:	68 67 37 80 00       	push   $0x803767
+  80040f:	e8 1d 21 00 00       	call   802531 <_panic>
+
+00800414 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800414:	55                   	push   %ebp
+  800415:	89 e5                	mov    %esp,%ebp
+  800417:	57                   	push   %edi
+  800418:	56                   	push   %esi
+  800419:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80041a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80041f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800424:	89 d1                	mov    %edx,%ecx
+  800426:	89 d3                	mov    %edx,%ebx
+  800428:	89 d7                	mov    %edx,%edi
+  80042a:	55                   	push   %ebp
+  80042b:	89 e5                	mov    %esp,%ebp
+  80042d:	8d 35 35 04 80 00    	lea    0x800435,%esi
+  800433:	0f 34                	sysenter
+  800435:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800436:	5b                   	pop    %ebx
+  800437:	5e                   	pop    %esi
+  800438:	5f                   	pop    %edi
+  800439:	5d                   	pop    %ebp
+  80043a:	c3                   	ret
+
+0080043b <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  80043b:	55                   	push   %ebp
+  80043c:	89 e5                	mov    %esp,%ebp
+  80043e:	57                   	push   %edi
+  80043f:	56                   	push   %esi
+  800440:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800441:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800446:	8b 55 08             	mov    0x8(%ebp),%edx
+  800449:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80044c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800451:	89 df                	mov    %ebx,%edi
+  800453:	55                   	push   %ebp
+  800454:	89 e5                	mov    %esp,%ebp
+  800456:	8d 35 5e 04 80 00    	lea    0x80045e,%esi
+  80045c:	0f 34                	sysenter
+  80045e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  80045f:	5b                   	pop    %ebx
+  800460:	5e                   	pop    %esi
+  800461:	5f                   	pop    %edi
+  800462:	5d                   	pop    %ebp
+  800463:	c3                   	ret
+
+00800464 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800464:	55                   	push   %ebp
+  800465:	89 e5                	mov    %esp,%ebp
+  800467:	57                   	push   %edi
+  800468:	56                   	push   %esi
+  800469:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80046a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80046f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800472:	b8 10 00 00 00       	mov    $0x10,%eax
+  800477:	89 cb                	mov    %ecx,%ebx
+  800479:	89 cf                	mov    %ecx,%edi
+  80047b:	55                   	push   %ebp
+  80047c:	89 e5                	mov    %esp,%ebp
+  80047e:	8d 35 86 04 80 00    	lea    0x800486,%esi
+  800484:	0f 34                	sysenter
+  800486:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800487:	5b                   	pop    %ebx
+  800488:	5e                   	pop    %esi
+  800489:	5f                   	pop    %edi
+  80048a:	5d                   	pop    %ebp
+  80048b:	c3                   	ret
+
+0080048c <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  80048c:	55                   	push   %ebp
+  80048d:	89 e5                	mov    %esp,%ebp
+  80048f:	57                   	push   %edi
+  800490:	56                   	push   %esi
+  800491:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800492:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800497:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80049d:	b8 12 00 00 00       	mov    $0x12,%eax
+  8004a2:	89 df                	mov    %ebx,%edi
+  8004a4:	55                   	push   %ebp
+  8004a5:	89 e5                	mov    %esp,%ebp
+  8004a7:	8d 35 af 04 80 00    	lea    0x8004af,%esi
+  8004ad:	0f 34                	sysenter
+  8004af:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8004b0:	5b                   	pop    %ebx
+  8004b1:	5e                   	pop    %esi
+  8004b2:	5f                   	pop    %edi
+  8004b3:	5d                   	pop    %ebp
+  8004b4:	c3                   	ret
+
+008004b5 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8004b5:	55                   	push   %ebp
+  8004b6:	89 e5                	mov    %esp,%ebp
+  8004b8:	57                   	push   %edi
+  8004b9:	56                   	push   %esi
+  8004ba:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004cb:	89 df                	mov    %ebx,%edi
+  8004cd:	55                   	push   %ebp
+  8004ce:	89 e5                	mov    %esp,%ebp
+  8004d0:	8d 35 d8 04 80 00    	lea    0x8004d8,%esi
+  8004d6:	0f 34                	sysenter
+  8004d8:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  8004d9:	5b                   	pop    %ebx
+  8004da:	5e                   	pop    %esi
+  8004db:	5f                   	pop    %edi
+  8004dc:	5d                   	pop    %ebp
+  8004dd:	c3                   	ret
+
+008004de <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  8004de:	55                   	push   %ebp
+  8004df:	89 e5                	mov    %esp,%ebp
+  8004e1:	57                   	push   %edi
+  8004e2:	56                   	push   %esi
+  8004e3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8004e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ea:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004f2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004f5:	55                   	push   %ebp
+  8004f6:	89 e5                	mov    %esp,%ebp
+  8004f8:	8d 35 00 05 80 00    	lea    0x800500,%esi
+  8004fe:	0f 34                	sysenter
+  800500:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800501:	5b                   	pop    %ebx
+  800502:	5e                   	pop    %esi
+  800503:	5f                   	pop    %edi
+  800504:	5d                   	pop    %ebp
+  800505:	c3                   	ret
+
+00800506 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800506:	55                   	push   %ebp
+  800507:	89 e5                	mov    %esp,%ebp
+  800509:	57                   	push   %edi
+  80050a:	56                   	push   %esi
+  80050b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80050c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800511:	8b 55 08             	mov    0x8(%ebp),%edx
+  800514:	b8 11 00 00 00       	mov    $0x11,%eax
+  800519:	89 cb                	mov    %ecx,%ebx
+  80051b:	89 cf                	mov    %ecx,%edi
+  80051d:	89 ce                	mov    %ecx,%esi
+  80051f:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800521:	5b                   	pop    %ebx
+  800522:	5e                   	pop    %esi
+  800523:	5f                   	pop    %edi
+  800524:	5d                   	pop    %ebp
+  800525:	c3                   	ret
+
+00800526 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800526:	55                   	push   %ebp
+  800527:	89 e5                	mov    %esp,%ebp
+  800529:	57                   	push   %edi
+  80052a:	56                   	push   %esi
+  80052b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80052c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800531:	8b 55 08             	mov    0x8(%ebp),%edx
+  800534:	b8 15 00 00 00       	mov    $0x15,%eax
+  800539:	89 cb                	mov    %ecx,%ebx
+  80053b:	89 cf                	mov    %ecx,%edi
+  80053d:	55                   	push   %ebp
+  80053e:	89 e5                	mov    %esp,%ebp
+  800540:	8d 35 48 05 80 00    	lea    0x800548,%esi
+  800546:	0f 34                	sysenter
+  800548:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800549:	5b                   	pop    %ebx
+  80054a:	5e                   	pop    %esi
+  80054b:	5f                   	pop    %edi
+  80054c:	5d                   	pop    %ebp
+  80054d:	c3                   	ret
+
+0080054e <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  80054e:	55                   	push   %ebp
+  80054f:	89 e5                	mov    %esp,%ebp
+  800551:	57                   	push   %edi
+  800552:	56                   	push   %esi
+  800553:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800554:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800559:	8b 55 08             	mov    0x8(%ebp),%edx
+  80055c:	b8 16 00 00 00       	mov    $0x16,%eax
+  800561:	89 cb                	mov    %ecx,%ebx
+  800563:	89 cf                	mov    %ecx,%edi
+  800565:	55                   	push   %ebp
+  800566:	89 e5                	mov    %esp,%ebp
+  800568:	8d 35 70 05 80 00    	lea    0x800570,%esi
+  80056e:	0f 34                	sysenter
+  800570:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800571:	5b                   	pop    %ebx
+  800572:	5e                   	pop    %esi
+  800573:	5f                   	pop    %edi
+  800574:	5d                   	pop    %ebp
+  800575:	c3                   	ret
+
+00800576 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800576:	55                   	push   %ebp
+  800577:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800579:	8b 45 08             	mov    0x8(%ebp),%eax
+  80057c:	05 00 00 00 30       	add    $0x30000000,%eax
+  800581:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800584:	5d                   	pop    %ebp
+  800585:	c3                   	ret
+
+00800586 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800586:	55                   	push   %ebp
+  800587:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800589:	8b 45 08             	mov    0x8(%ebp),%eax
+  80058c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800591:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800596:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80059b:	5d                   	pop    %ebp
+  80059c:	c3                   	ret
+
+0080059d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80059d:	55                   	push   %ebp
+  80059e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8005a0:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8005a5:	eb 02                	jmp    8005a9 <fd_alloc+0xc>
+  8005a7:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8005a9:	89 c2                	mov    %eax,%edx
+  8005ab:	c1 ea 16             	shr    $0x16,%edx
+  8005ae:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8005b5:	f6 c2 01             	test   $0x1,%dl
+  8005b8:	74 2b                	je     8005e5 <fd_alloc+0x48>
+  8005ba:	89 c2                	mov    %eax,%edx
+  8005bc:	c1 ea 0c             	shr    $0xc,%edx
+  8005bf:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8005c6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8005cc:	f6 c1 01             	test   $0x1,%cl
+  8005cf:	74 14                	je     8005e5 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8005d1:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8005d7:	75 ce                	jne    8005a7 <fd_alloc+0xa>
+  8005d9:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8005de:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8005e3:	eb 05                	jmp    8005ea <fd_alloc+0x4d>
+			return 0;
+  8005e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8005ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005ed:	89 02                	mov    %eax,(%edx)
+}
+  8005ef:	89 c8                	mov    %ecx,%eax
+  8005f1:	5d                   	pop    %ebp
+  8005f2:	c3                   	ret
+
+008005f3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8005f3:	55                   	push   %ebp
+  8005f4:	89 e5                	mov    %esp,%ebp
+  8005f6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8005f9:	83 f8 1f             	cmp    $0x1f,%eax
+  8005fc:	77 30                	ja     80062e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8005fe:	c1 e0 0c             	shl    $0xc,%eax
+  800601:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800606:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80060c:	f6 c2 01             	test   $0x1,%dl
+  80060f:	74 24                	je     800635 <fd_lookup+0x42>
+  800611:	89 c2                	mov    %eax,%edx
+  800613:	c1 ea 0c             	shr    $0xc,%edx
+  800616:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80061d:	f6 c2 01             	test   $0x1,%dl
+  800620:	74 1a                	je     80063c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800622:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800625:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800627:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80062c:	5d                   	pop    %ebp
+  80062d:	c3                   	ret
+		return -E_INVAL;
+  80062e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800633:	eb f7                	jmp    80062c <fd_lookup+0x39>
+		return -E_INVAL;
+  800635:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80063a:	eb f0                	jmp    80062c <fd_lookup+0x39>
+  80063c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800641:	eb e9                	jmp    80062c <fd_lookup+0x39>
+
+00800643 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800643:	55                   	push   %ebp
+  800644:	89 e5                	mov    %esp,%ebp
+  800646:	53                   	push   %ebx
+  800647:	83 ec 04             	sub    $0x4,%esp
+  80064a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80064d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800652:	eb 03                	jmp    800657 <dev_lookup+0x14>
+  800654:	83 c0 01             	add    $0x1,%eax
+  800657:	8b 1c 85 f4 37 80 00 	mov    0x8037f4(,%eax,4),%ebx
+  80065e:	85 db                	test   %ebx,%ebx
+  800660:	74 0b                	je     80066d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  800662:	39 13                	cmp    %edx,(%ebx)
+  800664:	75 ee                	jne    800654 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  800666:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066b:	eb 1f                	jmp    80068c <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80066d:	a1 00 50 80 00       	mov    0x805000,%eax
+  800672:	8b 40 48             	mov    0x48(%eax),%eax
+  800675:	83 ec 04             	sub    $0x4,%esp
+  800678:	52                   	push   %edx
+  800679:	50                   	push   %eax
+  80067a:	68 78 37 80 00       	push   $0x803778
+  80067f:	e8 88 1f 00 00       	call   80260c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800684:	83 c4 10             	add    $0x10,%esp
+  800687:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80068c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80068f:	89 1a                	mov    %ebx,(%edx)
+}
+  800691:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800694:	c9                   	leave
+  800695:	c3                   	ret
+
+00800696 <fd_close>:
+{
+  800696:	55                   	push   %ebp
+  800697:	89 e5                	mov    %esp,%ebp
+  800699:	57                   	push   %edi
+  80069a:	56                   	push   %esi
+  80069b:	53                   	push   %ebx
+  80069c:	83 ec 24             	sub    $0x24,%esp
+  80069f:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006a2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006a5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8006a8:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8006a9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8006af:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8006b2:	50                   	push   %eax
+  8006b3:	e8 3b ff ff ff       	call   8005f3 <fd_lookup>
+  8006b8:	89 c3                	mov    %eax,%ebx
+  8006ba:	83 c4 10             	add    $0x10,%esp
+  8006bd:	85 c0                	test   %eax,%eax
+  8006bf:	78 05                	js     8006c6 <fd_close+0x30>
+	    || fd != fd2)
+  8006c1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8006c4:	74 16                	je     8006dc <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8006c6:	89 f8                	mov    %edi,%eax
+  8006c8:	84 c0                	test   %al,%al
+  8006ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006cf:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8006d2:	89 d8                	mov    %ebx,%eax
+  8006d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006d7:	5b                   	pop    %ebx
+  8006d8:	5e                   	pop    %esi
+  8006d9:	5f                   	pop    %edi
+  8006da:	5d                   	pop    %ebp
+  8006db:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8006dc:	83 ec 08             	sub    $0x8,%esp
+  8006df:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8006e2:	50                   	push   %eax
+  8006e3:	ff 36                	push   (%esi)
+  8006e5:	e8 59 ff ff ff       	call   800643 <dev_lookup>
+  8006ea:	89 c3                	mov    %eax,%ebx
+  8006ec:	83 c4 10             	add    $0x10,%esp
+  8006ef:	85 c0                	test   %eax,%eax
+  8006f1:	78 1a                	js     80070d <fd_close+0x77>
+		if (dev->dev_close)
+  8006f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006f6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8006f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8006fe:	85 c0                	test   %eax,%eax
+  800700:	74 0b                	je     80070d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  800702:	83 ec 0c             	sub    $0xc,%esp
+  800705:	56                   	push   %esi
+  800706:	ff d0                	call   *%eax
+  800708:	89 c3                	mov    %eax,%ebx
+  80070a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80070d:	83 ec 08             	sub    $0x8,%esp
+  800710:	56                   	push   %esi
+  800711:	6a 00                	push   $0x0
+  800713:	e8 ea fa ff ff       	call   800202 <sys_page_unmap>
+	return r;
+  800718:	83 c4 10             	add    $0x10,%esp
+  80071b:	eb b5                	jmp    8006d2 <fd_close+0x3c>
+
+0080071d <close>:
+
+int
+close(int fdnum)
+{
+  80071d:	55                   	push   %ebp
+  80071e:	89 e5                	mov    %esp,%ebp
+  800720:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800723:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800726:	50                   	push   %eax
+  800727:	ff 75 08             	push   0x8(%ebp)
+  80072a:	e8 c4 fe ff ff       	call   8005f3 <fd_lookup>
+  80072f:	83 c4 10             	add    $0x10,%esp
+  800732:	85 c0                	test   %eax,%eax
+  800734:	79 02                	jns    800738 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800736:	c9                   	leave
+  800737:	c3                   	ret
+		return fd_close(fd, 1);
+  800738:	83 ec 08             	sub    $0x8,%esp
+  80073b:	6a 01                	push   $0x1
+  80073d:	ff 75 f4             	push   -0xc(%ebp)
+  800740:	e8 51 ff ff ff       	call   800696 <fd_close>
+  800745:	83 c4 10             	add    $0x10,%esp
+  800748:	eb ec                	jmp    800736 <close+0x19>
+
+0080074a <close_all>:
+
+void
+close_all(void)
+{
+  80074a:	55                   	push   %ebp
+  80074b:	89 e5                	mov    %esp,%ebp
+  80074d:	53                   	push   %ebx
+  80074e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800751:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800756:	83 ec 0c             	sub    $0xc,%esp
+  800759:	53                   	push   %ebx
+  80075a:	e8 be ff ff ff       	call   80071d <close>
+	for (i = 0; i < MAXFD; i++)
+  80075f:	83 c3 01             	add    $0x1,%ebx
+  800762:	83 c4 10             	add    $0x10,%esp
+  800765:	83 fb 20             	cmp    $0x20,%ebx
+  800768:	75 ec                	jne    800756 <close_all+0xc>
+}
+  80076a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80076d:	c9                   	leave
+  80076e:	c3                   	ret
+
+0080076f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80076f:	55                   	push   %ebp
+  800770:	89 e5                	mov    %esp,%ebp
+  800772:	57                   	push   %edi
+  800773:	56                   	push   %esi
+  800774:	53                   	push   %ebx
+  800775:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800778:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80077b:	50                   	push   %eax
+  80077c:	ff 75 08             	push   0x8(%ebp)
+  80077f:	e8 6f fe ff ff       	call   8005f3 <fd_lookup>
+  800784:	89 c3                	mov    %eax,%ebx
+  800786:	83 c4 10             	add    $0x10,%esp
+  800789:	85 c0                	test   %eax,%eax
+  80078b:	78 7f                	js     80080c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80078d:	83 ec 0c             	sub    $0xc,%esp
+  800790:	ff 75 0c             	push   0xc(%ebp)
+  800793:	e8 85 ff ff ff       	call   80071d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800798:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80079b:	c1 e6 0c             	shl    $0xc,%esi
+  80079e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8007a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8007a7:	89 3c 24             	mov    %edi,(%esp)
+  8007aa:	e8 d7 fd ff ff       	call   800586 <fd2data>
+  8007af:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8007b1:	89 34 24             	mov    %esi,(%esp)
+  8007b4:	e8 cd fd ff ff       	call   800586 <fd2data>
+  8007b9:	83 c4 10             	add    $0x10,%esp
+  8007bc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8007bf:	89 d8                	mov    %ebx,%eax
+  8007c1:	c1 e8 16             	shr    $0x16,%eax
+  8007c4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8007cb:	a8 01                	test   $0x1,%al
+  8007cd:	74 11                	je     8007e0 <dup+0x71>
+  8007cf:	89 d8                	mov    %ebx,%eax
+  8007d1:	c1 e8 0c             	shr    $0xc,%eax
+  8007d4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8007db:	f6 c2 01             	test   $0x1,%dl
+  8007de:	75 36                	jne    800816 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8007e0:	89 f8                	mov    %edi,%eax
+  8007e2:	c1 e8 0c             	shr    $0xc,%eax
+  8007e5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8007ec:	83 ec 0c             	sub    $0xc,%esp
+  8007ef:	25 07 0e 00 00       	and    $0xe07,%eax
+  8007f4:	50                   	push   %eax
+  8007f5:	56                   	push   %esi
+  8007f6:	6a 00                	push   $0x0
+  8007f8:	57                   	push   %edi
+  8007f9:	6a 00                	push   $0x0
+  8007fb:	e8 c0 f9 ff ff       	call   8001c0 <sys_page_map>
+  800800:	89 c3                	mov    %eax,%ebx
+  800802:	83 c4 20             	add    $0x20,%esp
+  800805:	85 c0                	test   %eax,%eax
+  800807:	78 33                	js     80083c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800809:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80080c:	89 d8                	mov    %ebx,%eax
+  80080e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800811:	5b                   	pop    %ebx
+  800812:	5e                   	pop    %esi
+  800813:	5f                   	pop    %edi
+  800814:	5d                   	pop    %ebp
+  800815:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800816:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80081d:	83 ec 0c             	sub    $0xc,%esp
+  800820:	25 07 0e 00 00       	and    $0xe07,%eax
+  800825:	50                   	push   %eax
+  800826:	ff 75 d4             	push   -0x2c(%ebp)
+  800829:	6a 00                	push   $0x0
+  80082b:	53                   	push   %ebx
+  80082c:	6a 00                	push   $0x0
+  80082e:	e8 8d f9 ff ff       	call   8001c0 <sys_page_map>
+  800833:	89 c3                	mov    %eax,%ebx
+  800835:	83 c4 20             	add    $0x20,%esp
+  800838:	85 c0                	test   %eax,%eax
+  80083a:	79 a4                	jns    8007e0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80083c:	83 ec 08             	sub    $0x8,%esp
+  80083f:	56                   	push   %esi
+  800840:	6a 00                	push   $0x0
+  800842:	e8 bb f9 ff ff       	call   800202 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800847:	83 c4 08             	add    $0x8,%esp
+  80084a:	ff 75 d4             	push   -0x2c(%ebp)
+  80084d:	6a 00                	push   $0x0
+  80084f:	e8 ae f9 ff ff       	call   800202 <sys_page_unmap>
+	return r;
+  800854:	83 c4 10             	add    $0x10,%esp
+  800857:	eb b3                	jmp    80080c <dup+0x9d>
+
+00800859 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800859:	55                   	push   %ebp
+  80085a:	89 e5                	mov    %esp,%ebp
+  80085c:	56                   	push   %esi
+  80085d:	53                   	push   %ebx
+  80085e:	83 ec 18             	sub    $0x18,%esp
+  800861:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800864:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800867:	50                   	push   %eax
+  800868:	56                   	push   %esi
+  800869:	e8 85 fd ff ff       	call   8005f3 <fd_lookup>
+  80086e:	83 c4 10             	add    $0x10,%esp
+  800871:	85 c0                	test   %eax,%eax
+  800873:	78 3c                	js     8008b1 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800875:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800878:	83 ec 08             	sub    $0x8,%esp
+  80087b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80087e:	50                   	push   %eax
+  80087f:	ff 33                	push   (%ebx)
+  800881:	e8 bd fd ff ff       	call   800643 <dev_lookup>
+  800886:	83 c4 10             	add    $0x10,%esp
+  800889:	85 c0                	test   %eax,%eax
+  80088b:	78 24                	js     8008b1 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80088d:	8b 43 08             	mov    0x8(%ebx),%eax
+  800890:	83 e0 03             	and    $0x3,%eax
+  800893:	83 f8 01             	cmp    $0x1,%eax
+  800896:	74 20                	je     8008b8 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800898:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80089b:	8b 40 08             	mov    0x8(%eax),%eax
+  80089e:	85 c0                	test   %eax,%eax
+  8008a0:	74 37                	je     8008d9 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8008a2:	83 ec 04             	sub    $0x4,%esp
+  8008a5:	ff 75 10             	push   0x10(%ebp)
+  8008a8:	ff 75 0c             	push   0xc(%ebp)
+  8008ab:	53                   	push   %ebx
+  8008ac:	ff d0                	call   *%eax
+  8008ae:	83 c4 10             	add    $0x10,%esp
+}
+  8008b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8008b4:	5b                   	pop    %ebx
+  8008b5:	5e                   	pop    %esi
+  8008b6:	5d                   	pop    %ebp
+  8008b7:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8008b8:	a1 00 50 80 00       	mov    0x805000,%eax
+  8008bd:	8b 40 48             	mov    0x48(%eax),%eax
+  8008c0:	83 ec 04             	sub    $0x4,%esp
+  8008c3:	56                   	push   %esi
+  8008c4:	50                   	push   %eax
+  8008c5:	68 b9 37 80 00       	push   $0x8037b9
+  8008ca:	e8 3d 1d 00 00       	call   80260c <cprintf>
+		return -E_INVAL;
+  8008cf:	83 c4 10             	add    $0x10,%esp
+  8008d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008d7:	eb d8                	jmp    8008b1 <read+0x58>
+		return -E_NOT_SUPP;
+  8008d9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8008de:	eb d1                	jmp    8008b1 <read+0x58>
+
+008008e0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8008e0:	55                   	push   %ebp
+  8008e1:	89 e5                	mov    %esp,%ebp
+  8008e3:	57                   	push   %edi
+  8008e4:	56                   	push   %esi
+  8008e5:	53                   	push   %ebx
+  8008e6:	83 ec 0c             	sub    $0xc,%esp
+  8008e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008ec:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8008ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008f4:	eb 02                	jmp    8008f8 <readn+0x18>
+  8008f6:	01 c3                	add    %eax,%ebx
+  8008f8:	39 f3                	cmp    %esi,%ebx
+  8008fa:	73 21                	jae    80091d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8008fc:	83 ec 04             	sub    $0x4,%esp
+  8008ff:	89 f0                	mov    %esi,%eax
+  800901:	29 d8                	sub    %ebx,%eax
+  800903:	50                   	push   %eax
+  800904:	89 d8                	mov    %ebx,%eax
+  800906:	03 45 0c             	add    0xc(%ebp),%eax
+  800909:	50                   	push   %eax
+  80090a:	57                   	push   %edi
+  80090b:	e8 49 ff ff ff       	call   800859 <read>
+		if (m < 0)
+  800910:	83 c4 10             	add    $0x10,%esp
+  800913:	85 c0                	test   %eax,%eax
+  800915:	78 04                	js     80091b <readn+0x3b>
+			return m;
+		if (m == 0)
+  800917:	75 dd                	jne    8008f6 <readn+0x16>
+  800919:	eb 02                	jmp    80091d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80091b:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80091d:	89 d8                	mov    %ebx,%eax
+  80091f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800922:	5b                   	pop    %ebx
+  800923:	5e                   	pop    %esi
+  800924:	5f                   	pop    %edi
+  800925:	5d                   	pop    %ebp
+  800926:	c3                   	ret
+
+00800927 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800927:	55                   	push   %ebp
+  800928:	89 e5                	mov    %esp,%ebp
+  80092a:	56                   	push   %esi
+  80092b:	53                   	push   %ebx
+  80092c:	83 ec 18             	sub    $0x18,%esp
+  80092f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800932:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800935:	50                   	push   %eax
+  800936:	53                   	push   %ebx
+  800937:	e8 b7 fc ff ff       	call   8005f3 <fd_lookup>
+  80093c:	83 c4 10             	add    $0x10,%esp
+  80093f:	85 c0                	test   %eax,%eax
+  800941:	78 37                	js     80097a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800943:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800946:	83 ec 08             	sub    $0x8,%esp
+  800949:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80094c:	50                   	push   %eax
+  80094d:	ff 36                	push   (%esi)
+  80094f:	e8 ef fc ff ff       	call   800643 <dev_lookup>
+  800954:	83 c4 10             	add    $0x10,%esp
+  800957:	85 c0                	test   %eax,%eax
+  800959:	78 1f                	js     80097a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80095b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80095f:	74 20                	je     800981 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800961:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800964:	8b 40 0c             	mov    0xc(%eax),%eax
+  800967:	85 c0                	test   %eax,%eax
+  800969:	74 37                	je     8009a2 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80096b:	83 ec 04             	sub    $0x4,%esp
+  80096e:	ff 75 10             	push   0x10(%ebp)
+  800971:	ff 75 0c             	push   0xc(%ebp)
+  800974:	56                   	push   %esi
+  800975:	ff d0                	call   *%eax
+  800977:	83 c4 10             	add    $0x10,%esp
+}
+  80097a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80097d:	5b                   	pop    %ebx
+  80097e:	5e                   	pop    %esi
+  80097f:	5d                   	pop    %ebp
+  800980:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800981:	a1 00 50 80 00       	mov    0x805000,%eax
+  800986:	8b 40 48             	mov    0x48(%eax),%eax
+  800989:	83 ec 04             	sub    $0x4,%esp
+  80098c:	53                   	push   %ebx
+  80098d:	50                   	push   %eax
+  80098e:	68 d5 37 80 00       	push   $0x8037d5
+  800993:	e8 74 1c 00 00       	call   80260c <cprintf>
+		return -E_INVAL;
+  800998:	83 c4 10             	add    $0x10,%esp
+  80099b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009a0:	eb d8                	jmp    80097a <write+0x53>
+		return -E_NOT_SUPP;
+  8009a2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009a7:	eb d1                	jmp    80097a <write+0x53>
+
+008009a9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	53                   	push   %ebx
+  8009ad:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009b0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009b3:	50                   	push   %eax
+  8009b4:	ff 75 08             	push   0x8(%ebp)
+  8009b7:	e8 37 fc ff ff       	call   8005f3 <fd_lookup>
+  8009bc:	83 c4 10             	add    $0x10,%esp
+  8009bf:	85 c0                	test   %eax,%eax
+  8009c1:	78 3a                	js     8009fd <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009c3:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8009c6:	83 ec 08             	sub    $0x8,%esp
+  8009c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009cc:	50                   	push   %eax
+  8009cd:	ff 33                	push   (%ebx)
+  8009cf:	e8 6f fc ff ff       	call   800643 <dev_lookup>
+  8009d4:	83 c4 10             	add    $0x10,%esp
+  8009d7:	85 c0                	test   %eax,%eax
+  8009d9:	78 22                	js     8009fd <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8009db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009de:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8009e1:	85 c0                	test   %eax,%eax
+  8009e3:	74 0d                	je     8009f2 <seek+0x49>
+  8009e5:	83 ec 0c             	sub    $0xc,%esp
+  8009e8:	53                   	push   %ebx
+  8009e9:	ff d0                	call   *%eax
+  8009eb:	83 c4 10             	add    $0x10,%esp
+  8009ee:	85 c0                	test   %eax,%eax
+  8009f0:	78 0b                	js     8009fd <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8009f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009f5:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8009f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a00:	c9                   	leave
+  800a01:	c3                   	ret
+
+00800a02 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  800a02:	55                   	push   %ebp
+  800a03:	89 e5                	mov    %esp,%ebp
+  800a05:	53                   	push   %ebx
+  800a06:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a09:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a0c:	50                   	push   %eax
+  800a0d:	ff 75 08             	push   0x8(%ebp)
+  800a10:	e8 de fb ff ff       	call   8005f3 <fd_lookup>
+  800a15:	83 c4 10             	add    $0x10,%esp
+  800a18:	85 c0                	test   %eax,%eax
+  800a1a:	78 2b                	js     800a47 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a1c:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800a1f:	83 ec 08             	sub    $0x8,%esp
+  800a22:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a25:	50                   	push   %eax
+  800a26:	ff 33                	push   (%ebx)
+  800a28:	e8 16 fc ff ff       	call   800643 <dev_lookup>
+  800a2d:	83 c4 10             	add    $0x10,%esp
+  800a30:	85 c0                	test   %eax,%eax
+  800a32:	78 13                	js     800a47 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  800a34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a37:	8b 40 1c             	mov    0x1c(%eax),%eax
+  800a3a:	85 c0                	test   %eax,%eax
+  800a3c:	74 0e                	je     800a4c <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  800a3e:	83 ec 0c             	sub    $0xc,%esp
+  800a41:	53                   	push   %ebx
+  800a42:	ff d0                	call   *%eax
+  800a44:	83 c4 10             	add    $0x10,%esp
+}
+  800a47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a4a:	c9                   	leave
+  800a4b:	c3                   	ret
+		return 0;
+  800a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a51:	eb f4                	jmp    800a47 <fsync+0x45>
+
+00800a53 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800a53:	55                   	push   %ebp
+  800a54:	89 e5                	mov    %esp,%ebp
+  800a56:	56                   	push   %esi
+  800a57:	53                   	push   %ebx
+  800a58:	83 ec 18             	sub    $0x18,%esp
+  800a5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a5e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a61:	50                   	push   %eax
+  800a62:	53                   	push   %ebx
+  800a63:	e8 8b fb ff ff       	call   8005f3 <fd_lookup>
+  800a68:	83 c4 10             	add    $0x10,%esp
+  800a6b:	85 c0                	test   %eax,%eax
+  800a6d:	78 34                	js     800aa3 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a6f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a72:	83 ec 08             	sub    $0x8,%esp
+  800a75:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a78:	50                   	push   %eax
+  800a79:	ff 36                	push   (%esi)
+  800a7b:	e8 c3 fb ff ff       	call   800643 <dev_lookup>
+  800a80:	83 c4 10             	add    $0x10,%esp
+  800a83:	85 c0                	test   %eax,%eax
+  800a85:	78 1c                	js     800aa3 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a87:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a8b:	74 1d                	je     800aaa <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800a8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a90:	8b 40 18             	mov    0x18(%eax),%eax
+  800a93:	85 c0                	test   %eax,%eax
+  800a95:	74 34                	je     800acb <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800a97:	83 ec 08             	sub    $0x8,%esp
+  800a9a:	ff 75 0c             	push   0xc(%ebp)
+  800a9d:	56                   	push   %esi
+  800a9e:	ff d0                	call   *%eax
+  800aa0:	83 c4 10             	add    $0x10,%esp
+}
+  800aa3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aa6:	5b                   	pop    %ebx
+  800aa7:	5e                   	pop    %esi
+  800aa8:	5d                   	pop    %ebp
+  800aa9:	c3                   	ret
+			thisenv->env_id, fdnum);
+  800aaa:	a1 00 50 80 00       	mov    0x805000,%eax
+  800aaf:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ab2:	83 ec 04             	sub    $0x4,%esp
+  800ab5:	53                   	push   %ebx
+  800ab6:	50                   	push   %eax
+  800ab7:	68 98 37 80 00       	push   $0x803798
+  800abc:	e8 4b 1b 00 00       	call   80260c <cprintf>
+		return -E_INVAL;
+  800ac1:	83 c4 10             	add    $0x10,%esp
+  800ac4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac9:	eb d8                	jmp    800aa3 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800acb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ad0:	eb d1                	jmp    800aa3 <ftruncate+0x50>
+
+00800ad2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800ad2:	55                   	push   %ebp
+  800ad3:	89 e5                	mov    %esp,%ebp
+  800ad5:	56                   	push   %esi
+  800ad6:	53                   	push   %ebx
+  800ad7:	83 ec 18             	sub    $0x18,%esp
+  800ada:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800add:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ae0:	50                   	push   %eax
+  800ae1:	ff 75 08             	push   0x8(%ebp)
+  800ae4:	e8 0a fb ff ff       	call   8005f3 <fd_lookup>
+  800ae9:	83 c4 10             	add    $0x10,%esp
+  800aec:	85 c0                	test   %eax,%eax
+  800aee:	78 49                	js     800b39 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800af0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800af3:	83 ec 08             	sub    $0x8,%esp
+  800af6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800af9:	50                   	push   %eax
+  800afa:	ff 36                	push   (%esi)
+  800afc:	e8 42 fb ff ff       	call   800643 <dev_lookup>
+  800b01:	83 c4 10             	add    $0x10,%esp
+  800b04:	85 c0                	test   %eax,%eax
+  800b06:	78 31                	js     800b39 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  800b08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b0b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800b0f:	74 2f                	je     800b40 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800b11:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800b14:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800b1b:	00 00 00 
+	stat->st_isdir = 0;
+  800b1e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800b25:	00 00 00 
+	stat->st_dev = dev;
+  800b28:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800b2e:	83 ec 08             	sub    $0x8,%esp
+  800b31:	53                   	push   %ebx
+  800b32:	56                   	push   %esi
+  800b33:	ff 50 14             	call   *0x14(%eax)
+  800b36:	83 c4 10             	add    $0x10,%esp
+}
+  800b39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b3c:	5b                   	pop    %ebx
+  800b3d:	5e                   	pop    %esi
+  800b3e:	5d                   	pop    %ebp
+  800b3f:	c3                   	ret
+		return -E_NOT_SUPP;
+  800b40:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b45:	eb f2                	jmp    800b39 <fstat+0x67>
+
+00800b47 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800b47:	55                   	push   %ebp
+  800b48:	89 e5                	mov    %esp,%ebp
+  800b4a:	56                   	push   %esi
+  800b4b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  800b4c:	83 ec 08             	sub    $0x8,%esp
+  800b4f:	68 00 10 00 00       	push   $0x1000
+  800b54:	ff 75 08             	push   0x8(%ebp)
+  800b57:	e8 b3 07 00 00       	call   80130f <open>
+  800b5c:	89 c3                	mov    %eax,%ebx
+  800b5e:	83 c4 10             	add    $0x10,%esp
+  800b61:	85 c0                	test   %eax,%eax
+  800b63:	78 1b                	js     800b80 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  800b65:	83 ec 08             	sub    $0x8,%esp
+  800b68:	ff 75 0c             	push   0xc(%ebp)
+  800b6b:	50                   	push   %eax
+  800b6c:	e8 61 ff ff ff       	call   800ad2 <fstat>
+  800b71:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800b73:	89 1c 24             	mov    %ebx,(%esp)
+  800b76:	e8 a2 fb ff ff       	call   80071d <close>
+	return r;
+  800b7b:	83 c4 10             	add    $0x10,%esp
+  800b7e:	89 f3                	mov    %esi,%ebx
+}
+  800b80:	89 d8                	mov    %ebx,%eax
+  800b82:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b85:	5b                   	pop    %ebx
+  800b86:	5e                   	pop    %esi
+  800b87:	5d                   	pop    %ebp
+  800b88:	c3                   	ret
+
+00800b89 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  800b89:	55                   	push   %ebp
+  800b8a:	89 e5                	mov    %esp,%ebp
+  800b8c:	57                   	push   %edi
+  800b8d:	56                   	push   %esi
+  800b8e:	53                   	push   %ebx
+  800b8f:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  800b95:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  800b9b:	89 d6                	mov    %edx,%esi
+  800b9d:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  800ba3:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  800ba6:	89 d3                	mov    %edx,%ebx
+  800ba8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  800bae:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800bb5:	74 1d                	je     800bd4 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  800bb7:	b8 00 60 80 00       	mov    $0x806000,%eax
+  800bbc:	83 c8 07             	or     $0x7,%eax
+  800bbf:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  800bc5:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800bca:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  800bd0:	01 ce                	add    %ecx,%esi
+  800bd2:	eb 28                	jmp    800bfc <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800bd4:	83 ec 0c             	sub    $0xc,%esp
+  800bd7:	6a 01                	push   $0x1
+  800bd9:	e8 05 28 00 00       	call   8033e3 <ipc_find_env>
+  800bde:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800be3:	83 c4 10             	add    $0x10,%esp
+  800be6:	eb cf                	jmp    800bb7 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  800be8:	83 c0 01             	add    $0x1,%eax
+  800beb:	89 fa                	mov    %edi,%edx
+  800bed:	09 da                	or     %ebx,%edx
+  800bef:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  800bf6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800bfc:	39 f3                	cmp    %esi,%ebx
+  800bfe:	72 e8                	jb     800be8 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  800c00:	83 f8 41             	cmp    $0x41,%eax
+  800c03:	77 2f                	ja     800c34 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  800c05:	50                   	push   %eax
+  800c06:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  800c0c:	50                   	push   %eax
+  800c0d:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  800c13:	ff 35 c8 70 80 00    	push   0x8070c8
+  800c19:	e8 77 27 00 00       	call   803395 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  800c1e:	83 c4 0c             	add    $0xc,%esp
+  800c21:	6a 00                	push   $0x0
+  800c23:	6a 00                	push   $0x0
+  800c25:	6a 00                	push   $0x0
+  800c27:	e8 13 26 00 00       	call   80323f <ipc_recv>
+}
+  800c2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2f:	5b                   	pop    %ebx
+  800c30:	5e                   	pop    %esi
+  800c31:	5f                   	pop    %edi
+  800c32:	5d                   	pop    %ebp
+  800c33:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  800c34:	68 08 38 80 00       	push   $0x803808
+  800c39:	68 24 38 80 00       	push   $0x803824
+  800c3e:	6a 40                	push   $0x40
+  800c40:	68 39 38 80 00       	push   $0x803839
+  800c45:	e8 e7 18 00 00       	call   802531 <_panic>
+
+00800c4a <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  800c4a:	55                   	push   %ebp
+  800c4b:	89 e5                	mov    %esp,%ebp
+  800c4d:	57                   	push   %edi
+  800c4e:	56                   	push   %esi
+  800c4f:	53                   	push   %ebx
+  800c50:	83 ec 1c             	sub    $0x1c,%esp
+  800c53:	89 c3                	mov    %eax,%ebx
+  800c55:	89 d6                	mov    %edx,%esi
+  800c57:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  800c5a:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  800c60:	89 ca                	mov    %ecx,%edx
+  800c62:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  800c65:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  800c6c:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  800c6f:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  800c76:	8b 76 0c             	mov    0xc(%esi),%esi
+  800c79:	89 fb                	mov    %edi,%ebx
+  800c7b:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  800c82:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c85:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  800c8c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c8f:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  800c96:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c99:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  800ca0:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  800ca3:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  800caa:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  800caf:	39 c8                	cmp    %ecx,%eax
+  800cb1:	74 0d                	je     800cc0 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  800cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbb:	5b                   	pop    %ebx
+  800cbc:	5e                   	pop    %esi
+  800cbd:	5f                   	pop    %edi
+  800cbe:	5d                   	pop    %ebp
+  800cbf:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cc0:	6a 07                	push   $0x7
+  800cc2:	68 00 60 80 00       	push   $0x806000
+  800cc7:	6a 0d                	push   $0xd
+  800cc9:	ff 35 c8 70 80 00    	push   0x8070c8
+  800ccf:	e8 d6 25 00 00       	call   8032aa <ipc_send>
+  800cd4:	83 c4 10             	add    $0x10,%esp
+  800cd7:	eb da                	jmp    800cb3 <fsring_post+0x69>
+
+00800cd9 <fsipcv>:
+{
+  800cd9:	55                   	push   %ebp
+  800cda:	89 e5                	mov    %esp,%ebp
+  800cdc:	57                   	push   %edi
+  800cdd:	56                   	push   %esi
+  800cde:	53                   	push   %ebx
+  800cdf:	83 ec 0c             	sub    $0xc,%esp
+  800ce2:	89 c7                	mov    %eax,%edi
+  800ce4:	89 d3                	mov    %edx,%ebx
+  800ce6:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  800ce8:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  800cef:	74 26                	je     800d17 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800cf1:	6a 07                	push   $0x7
+  800cf3:	68 00 60 80 00       	push   $0x806000
+  800cf8:	57                   	push   %edi
+  800cf9:	ff 35 c8 70 80 00    	push   0x8070c8
+  800cff:	e8 a6 25 00 00       	call   8032aa <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  800d04:	6a 00                	push   $0x0
+  800d06:	56                   	push   %esi
+  800d07:	53                   	push   %ebx
+  800d08:	6a 00                	push   $0x0
+  800d0a:	e8 f3 25 00 00       	call   803302 <ipc_recvv>
+}
+  800d0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d12:	5b                   	pop    %ebx
+  800d13:	5e                   	pop    %esi
+  800d14:	5f                   	pop    %edi
+  800d15:	5d                   	pop    %ebp
+  800d16:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800d17:	83 ec 0c             	sub    $0xc,%esp
+  800d1a:	6a 01                	push   $0x1
+  800d1c:	e8 c2 26 00 00       	call   8033e3 <ipc_find_env>
+  800d21:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  800d26:	83 c4 10             	add    $0x10,%esp
+  800d29:	eb c6                	jmp    800cf1 <fsipcv+0x18>
+
+00800d2b <fsipc>:
+{
+  800d2b:	55                   	push   %ebp
+  800d2c:	89 e5                	mov    %esp,%ebp
+  800d2e:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  800d31:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  800d38:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800d3b:	e8 99 ff ff ff       	call   800cd9 <fsipcv>
+}
+  800d40:	c9                   	leave
+  800d41:	c3                   	ret
+
+00800d42 <file_write_direct>:
+{
+  800d42:	55                   	push   %ebp
+  800d43:	89 e5                	mov    %esp,%ebp
+  800d45:	56                   	push   %esi
+  800d46:	53                   	push   %ebx
+  800d47:	89 c3                	mov    %eax,%ebx
+  800d49:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  800d4b:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  800d51:	77 40                	ja     800d93 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  800d53:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  800d58:	39 c8                	cmp    %ecx,%eax
+  800d5a:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d5d:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  800d60:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  800d66:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  800d6b:	83 ec 04             	sub    $0x4,%esp
+  800d6e:	50                   	push   %eax
+  800d6f:	52                   	push   %edx
+  800d70:	68 08 60 80 00       	push   $0x806008
+  800d75:	e8 06 20 00 00       	call   802d80 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  800d7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d84:	e8 a2 ff ff ff       	call   800d2b <fsipc>
+  800d89:	83 c4 10             	add    $0x10,%esp
+}
+  800d8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800d8f:	5b                   	pop    %ebx
+  800d90:	5e                   	pop    %esi
+  800d91:	5d                   	pop    %ebp
+  800d92:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  800d93:	89 d6                	mov    %edx,%esi
+  800d95:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  800d9b:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  800da0:	29 f1                	sub    %esi,%ecx
+  800da2:	39 c1                	cmp    %eax,%ecx
+  800da4:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  800da7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800daa:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  800daf:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  800db5:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  800dbb:	83 ec 0c             	sub    $0xc,%esp
+  800dbe:	6a 05                	push   $0x5
+  800dc0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dc5:	e8 bf fd ff ff       	call   800b89 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  800dca:	83 c4 10             	add    $0x10,%esp
+  800dcd:	eb bd                	jmp    800d8c <file_write_direct+0x4a>
+
+00800dcf <devfile_sync>:
+{
+  800dcf:	55                   	push   %ebp
+  800dd0:	89 e5                	mov    %esp,%ebp
+  800dd2:	57                   	push   %edi
+  800dd3:	56                   	push   %esi
+  800dd4:	53                   	push   %ebx
+  800dd5:	83 ec 28             	sub    $0x28,%esp
+  800dd8:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  800ddb:	56                   	push   %esi
+  800ddc:	e8 a5 f7 ff ff       	call   800586 <fd2data>
+  800de1:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  800de3:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  800de6:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  800ded:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800df0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  800df5:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  800df9:	74 45                	je     800e40 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  800dfb:	8b 46 14             	mov    0x14(%esi),%eax
+  800dfe:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  800e0e:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  800e11:	39 cb                	cmp    %ecx,%ebx
+  800e13:	73 14                	jae    800e29 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  800e15:	29 d9                	sub    %ebx,%ecx
+  800e17:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  800e1a:	89 f0                	mov    %esi,%eax
+  800e1c:	e8 21 ff ff ff       	call   800d42 <file_write_direct>
+  800e21:	85 c0                	test   %eax,%eax
+  800e23:	7e 04                	jle    800e29 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  800e25:	01 c3                	add    %eax,%ebx
+  800e27:	eb e5                	jmp    800e0e <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  800e29:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800e2c:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  800e33:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  800e36:	85 c0                	test   %eax,%eax
+  800e38:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3d:	0f 4f c2             	cmovg  %edx,%eax
+}
+  800e40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e43:	5b                   	pop    %ebx
+  800e44:	5e                   	pop    %esi
+  800e45:	5f                   	pop    %edi
+  800e46:	5d                   	pop    %ebp
+  800e47:	c3                   	ret
+
+00800e48 <devfile_write>:
+{
+  800e48:	55                   	push   %ebp
+  800e49:	89 e5                	mov    %esp,%ebp
+  800e4b:	57                   	push   %edi
+  800e4c:	56                   	push   %esi
+  800e4d:	53                   	push   %ebx
+  800e4e:	83 ec 28             	sub    $0x28,%esp
+  800e51:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800e54:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  800e57:	53                   	push   %ebx
+  800e58:	e8 29 f7 ff ff       	call   800586 <fd2data>
+  800e5d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  800e60:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  800e63:	83 c4 10             	add    $0x10,%esp
+  800e66:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  800e6a:	74 43                	je     800eaf <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  800e6c:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  800e73:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800e76:	85 c0                	test   %eax,%eax
+  800e78:	74 43                	je     800ebd <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  800e7a:	89 c2                	mov    %eax,%edx
+  800e7c:	03 53 14             	add    0x14(%ebx),%edx
+  800e7f:	39 fa                	cmp    %edi,%edx
+  800e81:	75 0b                	jne    800e8e <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  800e83:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  800e86:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  800e8c:	76 66                	jbe    800ef4 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  800e8e:	83 ec 0c             	sub    $0xc,%esp
+  800e91:	53                   	push   %ebx
+  800e92:	e8 38 ff ff ff       	call   800dcf <devfile_sync>
+  800e97:	83 c4 10             	add    $0x10,%esp
+  800e9a:	85 c0                	test   %eax,%eax
+  800e9c:	78 4e                	js     800eec <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800e9e:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800ea4:	77 56                	ja     800efc <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  800ea6:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  800ea9:	85 c0                	test   %eax,%eax
+  800eab:	75 20                	jne    800ecd <devfile_write+0x85>
+  800ead:	eb 16                	jmp    800ec5 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  800eaf:	89 f1                	mov    %esi,%ecx
+  800eb1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800eb4:	89 d8                	mov    %ebx,%eax
+  800eb6:	e8 87 fe ff ff       	call   800d42 <file_write_direct>
+  800ebb:	eb 2f                	jmp    800eec <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  800ebd:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800ec3:	77 37                	ja     800efc <devfile_write+0xb4>
+		ff->buf_base = pos;
+  800ec5:	89 7b 14             	mov    %edi,0x14(%ebx)
+  800ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  800ecd:	83 ec 04             	sub    $0x4,%esp
+  800ed0:	56                   	push   %esi
+  800ed1:	ff 75 0c             	push   0xc(%ebp)
+  800ed4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800ed7:	01 c1                	add    %eax,%ecx
+  800ed9:	51                   	push   %ecx
+  800eda:	e8 a1 1e 00 00       	call   802d80 <memmove>
+	ff->buf_wlen += n;
+  800edf:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  800ee2:	01 f7                	add    %esi,%edi
+  800ee4:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  800ee7:	89 f0                	mov    %esi,%eax
+  800ee9:	83 c4 10             	add    $0x10,%esp
+}
+  800eec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eef:	5b                   	pop    %ebx
+  800ef0:	5e                   	pop    %esi
+  800ef1:	5f                   	pop    %edi
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  800ef4:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  800efa:	76 d1                	jbe    800ecd <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  800efc:	89 f1                	mov    %esi,%ecx
+  800efe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f01:	89 d8                	mov    %ebx,%eax
+  800f03:	e8 3a fe ff ff       	call   800d42 <file_write_direct>
+  800f08:	eb e2                	jmp    800eec <devfile_write+0xa4>
+
+00800f0a <devfile_trunc>:
+{
+  800f0a:	55                   	push   %ebp
+  800f0b:	89 e5                	mov    %esp,%ebp
+  800f0d:	53                   	push   %ebx
+  800f0e:	83 ec 10             	sub    $0x10,%esp
+  800f11:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  800f14:	53                   	push   %ebx
+  800f15:	e8 b5 fe ff ff       	call   800dcf <devfile_sync>
+  800f1a:	83 c4 10             	add    $0x10,%esp
+  800f1d:	85 c0                	test   %eax,%eax
+  800f1f:	78 1f                	js     800f40 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800f21:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f24:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800f29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f2c:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800f31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f36:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f3b:	e8 eb fd ff ff       	call   800d2b <fsipc>
+}
+  800f40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f43:	c9                   	leave
+  800f44:	c3                   	ret
+
+00800f45 <devfile_stat>:
+{
+  800f45:	55                   	push   %ebp
+  800f46:	89 e5                	mov    %esp,%ebp
+  800f48:	56                   	push   %esi
+  800f49:	53                   	push   %ebx
+  800f4a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800f4d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  800f50:	83 ec 0c             	sub    $0xc,%esp
+  800f53:	53                   	push   %ebx
+  800f54:	e8 76 fe ff ff       	call   800dcf <devfile_sync>
+  800f59:	83 c4 10             	add    $0x10,%esp
+  800f5c:	85 c0                	test   %eax,%eax
+  800f5e:	78 47                	js     800fa7 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800f60:	8b 43 0c             	mov    0xc(%ebx),%eax
+  800f63:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800f68:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f72:	e8 b4 fd ff ff       	call   800d2b <fsipc>
+  800f77:	85 c0                	test   %eax,%eax
+  800f79:	78 2c                	js     800fa7 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f7b:	83 ec 08             	sub    $0x8,%esp
+  800f7e:	68 00 60 80 00       	push   $0x806000
+  800f83:	56                   	push   %esi
+  800f84:	e8 71 1c 00 00       	call   802bfa <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800f89:	a1 80 60 80 00       	mov    0x806080,%eax
+  800f8e:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800f94:	a1 84 60 80 00       	mov    0x806084,%eax
+  800f99:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  800f9f:	83 c4 10             	add    $0x10,%esp
+  800fa2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fa7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800faa:	5b                   	pop    %ebx
+  800fab:	5e                   	pop    %esi
+  800fac:	5d                   	pop    %ebp
+  800fad:	c3                   	ret
+
+00800fae <devfile_flush>:
+{
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  800fb1:	56                   	push   %esi
+  800fb2:	53                   	push   %ebx
+  800fb3:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  800fb6:	83 ec 0c             	sub    $0xc,%esp
+  800fb9:	56                   	push   %esi
+  800fba:	e8 10 fe ff ff       	call   800dcf <devfile_sync>
+  800fbf:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  800fc1:	83 c4 10             	add    $0x10,%esp
+  800fc4:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  800fc8:	75 25                	jne    800fef <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800fca:	8b 46 0c             	mov    0xc(%esi),%eax
+  800fcd:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  800fd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fdc:	e8 4a fd ff ff       	call   800d2b <fsipc>
+  800fe1:	85 c0                	test   %eax,%eax
+  800fe3:	0f 45 d8             	cmovne %eax,%ebx
+}
+  800fe6:	89 d8                	mov    %ebx,%eax
+  800fe8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800feb:	5b                   	pop    %ebx
+  800fec:	5e                   	pop    %esi
+  800fed:	5d                   	pop    %ebp
+  800fee:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  800fef:	83 ec 0c             	sub    $0xc,%esp
+  800ff2:	56                   	push   %esi
+  800ff3:	e8 8e f5 ff ff       	call   800586 <fd2data>
+  800ff8:	83 c4 08             	add    $0x8,%esp
+  800ffb:	50                   	push   %eax
+  800ffc:	6a 00                	push   $0x0
+  800ffe:	e8 ff f1 ff ff       	call   800202 <sys_page_unmap>
+  801003:	83 c4 10             	add    $0x10,%esp
+  801006:	eb c2                	jmp    800fca <devfile_flush+0x1c>
+
+00801008 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801008:	55                   	push   %ebp
+  801009:	89 e5                	mov    %esp,%ebp
+  80100b:	57                   	push   %edi
+  80100c:	56                   	push   %esi
+  80100d:	53                   	push   %ebx
+  80100e:	83 ec 64             	sub    $0x64,%esp
+  801011:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801013:	52                   	push   %edx
+  801014:	50                   	push   %eax
+  801015:	e8 d9 f5 ff ff       	call   8005f3 <fd_lookup>
+  80101a:	89 c1                	mov    %eax,%ecx
+  80101c:	83 c4 10             	add    $0x10,%esp
+  80101f:	85 c0                	test   %eax,%eax
+  801021:	0f 88 f2 00 00 00    	js     801119 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801027:	8b 07                	mov    (%edi),%eax
+  801029:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80102f:	39 10                	cmp    %edx,(%eax)
+  801031:	0f 85 03 01 00 00    	jne    80113a <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801037:	a1 00 50 80 00       	mov    0x805000,%eax
+  80103c:	8b 40 48             	mov    0x48(%eax),%eax
+  80103f:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801045:	0f 84 96 00 00 00    	je     8010e1 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  80104b:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801052:	0f 84 cb 00 00 00    	je     801123 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801058:	b8 00 60 80 00       	mov    $0x806000,%eax
+  80105d:	83 c8 07             	or     $0x7,%eax
+  801060:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801063:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801066:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  80106b:	83 ec 04             	sub    $0x4,%esp
+  80106e:	68 07 04 00 00       	push   $0x407
+  801073:	53                   	push   %ebx
+  801074:	6a 00                	push   $0x0
+  801076:	e8 fa f0 ff ff       	call   800175 <sys_page_alloc>
+  80107b:	89 c1                	mov    %eax,%ecx
+  80107d:	83 c4 10             	add    $0x10,%esp
+  801080:	85 c0                	test   %eax,%eax
+  801082:	0f 88 91 00 00 00    	js     801119 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801088:	89 d8                	mov    %ebx,%eax
+  80108a:	83 c8 07             	or     $0x7,%eax
+  80108d:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  80108f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801095:	83 c6 04             	add    $0x4,%esi
+  801098:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  80109e:	75 cb                	jne    80106b <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8010a0:	6a 12                	push   $0x12
+  8010a2:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8010a5:	50                   	push   %eax
+  8010a6:	6a 0c                	push   $0xc
+  8010a8:	ff 35 c8 70 80 00    	push   0x8070c8
+  8010ae:	e8 e2 22 00 00       	call   803395 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8010b3:	83 c4 0c             	add    $0xc,%esp
+  8010b6:	6a 00                	push   $0x0
+  8010b8:	6a 00                	push   $0x0
+  8010ba:	6a 00                	push   $0x0
+  8010bc:	e8 7e 21 00 00       	call   80323f <ipc_recv>
+  8010c1:	89 c1                	mov    %eax,%ecx
+  8010c3:	83 c4 10             	add    $0x10,%esp
+  8010c6:	85 c0                	test   %eax,%eax
+  8010c8:	78 4f                	js     801119 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  8010ca:	a1 00 50 80 00       	mov    0x805000,%eax
+  8010cf:	8b 40 48             	mov    0x48(%eax),%eax
+  8010d2:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  8010d7:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  8010de:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  8010e1:	83 ec 0c             	sub    $0xc,%esp
+  8010e4:	ff 37                	push   (%edi)
+  8010e6:	e8 e4 fc ff ff       	call   800dcf <devfile_sync>
+  8010eb:	89 c1                	mov    %eax,%ecx
+  8010ed:	83 c4 10             	add    $0x10,%esp
+  8010f0:	85 c0                	test   %eax,%eax
+  8010f2:	78 25                	js     801119 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  8010f4:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  8010fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  8010ff:	ba 01 00 00 00       	mov    $0x1,%edx
+  801104:	89 d0                	mov    %edx,%eax
+  801106:	d3 e0                	shl    %cl,%eax
+  801108:	85 d8                	test   %ebx,%eax
+  80110a:	74 0d                	je     801119 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  80110c:	83 c1 01             	add    $0x1,%ecx
+  80110f:	83 f9 10             	cmp    $0x10,%ecx
+  801112:	75 f0                	jne    801104 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801114:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801119:	89 c8                	mov    %ecx,%eax
+  80111b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111e:	5b                   	pop    %ebx
+  80111f:	5e                   	pop    %esi
+  801120:	5f                   	pop    %edi
+  801121:	5d                   	pop    %ebp
+  801122:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801123:	83 ec 0c             	sub    $0xc,%esp
+  801126:	6a 01                	push   $0x1
+  801128:	e8 b6 22 00 00       	call   8033e3 <ipc_find_env>
+  80112d:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801132:	83 c4 10             	add    $0x10,%esp
+  801135:	e9 1e ff ff ff       	jmp    801058 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  80113a:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  80113f:	eb d8                	jmp    801119 <fsring_slot+0x111>
+
+00801141 <file_read_direct>:
+{
+  801141:	55                   	push   %ebp
+  801142:	89 e5                	mov    %esp,%ebp
+  801144:	57                   	push   %edi
+  801145:	56                   	push   %esi
+  801146:	53                   	push   %ebx
+  801147:	83 ec 1c             	sub    $0x1c,%esp
+  80114a:	89 c7                	mov    %eax,%edi
+  80114c:	89 d6                	mov    %edx,%esi
+  80114e:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801150:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801156:	77 52                	ja     8011aa <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801158:	8b 40 0c             	mov    0xc(%eax),%eax
+  80115b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801160:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801166:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801170:	e8 b6 fb ff ff       	call   800d2b <fsipc>
+  801175:	89 c7                	mov    %eax,%edi
+  801177:	85 c0                	test   %eax,%eax
+  801179:	78 25                	js     8011a0 <file_read_direct+0x5f>
+	assert(r <= n);
+  80117b:	39 c3                	cmp    %eax,%ebx
+  80117d:	0f 82 87 00 00 00    	jb     80120a <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801183:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801188:	0f 8f 95 00 00 00    	jg     801223 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80118e:	83 ec 04             	sub    $0x4,%esp
+  801191:	50                   	push   %eax
+  801192:	68 00 60 80 00       	push   $0x806000
+  801197:	56                   	push   %esi
+  801198:	e8 e3 1b 00 00       	call   802d80 <memmove>
+	return r;
+  80119d:	83 c4 10             	add    $0x10,%esp
+}
+  8011a0:	89 f8                	mov    %edi,%eax
+  8011a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a5:	5b                   	pop    %ebx
+  8011a6:	5e                   	pop    %esi
+  8011a7:	5f                   	pop    %edi
+  8011a8:	5d                   	pop    %ebp
+  8011a9:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8011aa:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8011b0:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8011b5:	29 d1                	sub    %edx,%ecx
+  8011b7:	39 d9                	cmp    %ebx,%ecx
+  8011b9:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011bc:	89 f0                	mov    %esi,%eax
+  8011be:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8011c1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8011c4:	eb 0f                	jmp    8011d5 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8011c6:	0f b6 10             	movzbl (%eax),%edx
+  8011c9:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8011cb:	05 00 10 00 00       	add    $0x1000,%eax
+  8011d0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011d5:	39 c8                	cmp    %ecx,%eax
+  8011d7:	72 ed                	jb     8011c6 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  8011d9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8011dc:	8b 47 0c             	mov    0xc(%edi),%eax
+  8011df:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  8011e4:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8011ea:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  8011f0:	83 ec 0c             	sub    $0xc,%esp
+  8011f3:	6a 07                	push   $0x7
+  8011f5:	89 d9                	mov    %ebx,%ecx
+  8011f7:	89 f2                	mov    %esi,%edx
+  8011f9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011fe:	e8 86 f9 ff ff       	call   800b89 <fsipc_pages>
+  801203:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801205:	83 c4 10             	add    $0x10,%esp
+  801208:	eb 96                	jmp    8011a0 <file_read_direct+0x5f>
+	assert(r <= n);
+  80120a:	68 44 38 80 00       	push   $0x803844
+  80120f:	68 24 38 80 00       	push   $0x803824
+  801214:	68 dc 00 00 00       	push   $0xdc
+  801219:	68 39 38 80 00       	push   $0x803839
+  80121e:	e8 0e 13 00 00       	call   802531 <_panic>
+	assert(r <= PGSIZE);
+  801223:	68 55 38 80 00       	push   $0x803855
+  801228:	68 24 38 80 00       	push   $0x803824
+  80122d:	68 dd 00 00 00       	push   $0xdd
+  801232:	68 39 38 80 00       	push   $0x803839
+  801237:	e8 f5 12 00 00       	call   802531 <_panic>
+
+0080123c <devfile_read>:
+{
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	57                   	push   %edi
+  801240:	56                   	push   %esi
+  801241:	53                   	push   %ebx
+  801242:	83 ec 28             	sub    $0x28,%esp
+  801245:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801248:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80124b:	53                   	push   %ebx
+  80124c:	e8 35 f3 ff ff       	call   800586 <fd2data>
+  801251:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801254:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801257:	83 c4 10             	add    $0x10,%esp
+  80125a:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  80125e:	74 7d                	je     8012dd <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801260:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801264:	0f 85 81 00 00 00    	jne    8012eb <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  80126a:	8b 43 18             	mov    0x18(%ebx),%eax
+  80126d:	85 c0                	test   %eax,%eax
+  80126f:	74 0d                	je     80127e <devfile_read+0x42>
+  801271:	8b 53 14             	mov    0x14(%ebx),%edx
+  801274:	39 fa                	cmp    %edi,%edx
+  801276:	7f 06                	jg     80127e <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801278:	01 c2                	add    %eax,%edx
+  80127a:	39 d7                	cmp    %edx,%edi
+  80127c:	72 28                	jb     8012a6 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  80127e:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801285:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80128b:	77 74                	ja     801301 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  80128d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801292:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801295:	89 d8                	mov    %ebx,%eax
+  801297:	e8 a5 fe ff ff       	call   801141 <file_read_direct>
+  80129c:	85 c0                	test   %eax,%eax
+  80129e:	7e 35                	jle    8012d5 <devfile_read+0x99>
+		ff->buf_base = pos;
+  8012a0:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8012a3:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8012a6:	8b 53 14             	mov    0x14(%ebx),%edx
+  8012a9:	89 d0                	mov    %edx,%eax
+  8012ab:	03 43 18             	add    0x18(%ebx),%eax
+  8012ae:	29 f8                	sub    %edi,%eax
+  8012b0:	39 f0                	cmp    %esi,%eax
+  8012b2:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8012b5:	83 ec 04             	sub    $0x4,%esp
+  8012b8:	56                   	push   %esi
+  8012b9:	89 f8                	mov    %edi,%eax
+  8012bb:	29 d0                	sub    %edx,%eax
+  8012bd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8012c0:	01 c1                	add    %eax,%ecx
+  8012c2:	51                   	push   %ecx
+  8012c3:	ff 75 0c             	push   0xc(%ebp)
+  8012c6:	e8 b5 1a 00 00       	call   802d80 <memmove>
+	fd->fd_offset = pos + n;
+  8012cb:	01 f7                	add    %esi,%edi
+  8012cd:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8012d0:	89 f0                	mov    %esi,%eax
+  8012d2:	83 c4 10             	add    $0x10,%esp
+}
+  8012d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d8:	5b                   	pop    %ebx
+  8012d9:	5e                   	pop    %esi
+  8012da:	5f                   	pop    %edi
+  8012db:	5d                   	pop    %ebp
+  8012dc:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  8012dd:	89 f1                	mov    %esi,%ecx
+  8012df:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012e2:	89 d8                	mov    %ebx,%eax
+  8012e4:	e8 58 fe ff ff       	call   801141 <file_read_direct>
+  8012e9:	eb ea                	jmp    8012d5 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8012eb:	83 ec 0c             	sub    $0xc,%esp
+  8012ee:	53                   	push   %ebx
+  8012ef:	e8 db fa ff ff       	call   800dcf <devfile_sync>
+  8012f4:	83 c4 10             	add    $0x10,%esp
+  8012f7:	85 c0                	test   %eax,%eax
+  8012f9:	0f 89 6b ff ff ff    	jns    80126a <devfile_read+0x2e>
+  8012ff:	eb d4                	jmp    8012d5 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801301:	89 f1                	mov    %esi,%ecx
+  801303:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801306:	89 d8                	mov    %ebx,%eax
+  801308:	e8 34 fe ff ff       	call   801141 <file_read_direct>
+  80130d:	eb c6                	jmp    8012d5 <devfile_read+0x99>
+
+0080130f <open>:
+{
+  80130f:	55                   	push   %ebp
+  801310:	89 e5                	mov    %esp,%ebp
+  801312:	56                   	push   %esi
+  801313:	53                   	push   %ebx
+  801314:	83 ec 1c             	sub    $0x1c,%esp
+  801317:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80131a:	56                   	push   %esi
+  80131b:	e8 9f 18 00 00       	call   802bbf <strlen>
+  801320:	83 c4 10             	add    $0x10,%esp
+  801323:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801328:	0f 8f a0 00 00 00    	jg     8013ce <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  80132e:	83 ec 0c             	sub    $0xc,%esp
+  801331:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801334:	50                   	push   %eax
+  801335:	e8 63 f2 ff ff       	call   80059d <fd_alloc>
+  80133a:	89 c3                	mov    %eax,%ebx
+  80133c:	83 c4 10             	add    $0x10,%esp
+  80133f:	85 c0                	test   %eax,%eax
+  801341:	78 45                	js     801388 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801343:	83 ec 08             	sub    $0x8,%esp
+  801346:	56                   	push   %esi
+  801347:	68 00 60 80 00       	push   $0x806000
+  80134c:	e8 a9 18 00 00       	call   802bfa <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801351:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801354:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801359:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80135c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801361:	e8 c5 f9 ff ff       	call   800d2b <fsipc>
+  801366:	89 c3                	mov    %eax,%ebx
+  801368:	83 c4 10             	add    $0x10,%esp
+  80136b:	85 c0                	test   %eax,%eax
+  80136d:	78 22                	js     801391 <open+0x82>
+	if (!(mode & O_NOBUF)
+  80136f:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801376:	74 2b                	je     8013a3 <open+0x94>
+	return fd2num(fd);
+  801378:	83 ec 0c             	sub    $0xc,%esp
+  80137b:	ff 75 f4             	push   -0xc(%ebp)
+  80137e:	e8 f3 f1 ff ff       	call   800576 <fd2num>
+  801383:	89 c3                	mov    %eax,%ebx
+  801385:	83 c4 10             	add    $0x10,%esp
+}
+  801388:	89 d8                	mov    %ebx,%eax
+  80138a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80138d:	5b                   	pop    %ebx
+  80138e:	5e                   	pop    %esi
+  80138f:	5d                   	pop    %ebp
+  801390:	c3                   	ret
+		fd_close(fd, 0);
+  801391:	83 ec 08             	sub    $0x8,%esp
+  801394:	6a 00                	push   $0x0
+  801396:	ff 75 f4             	push   -0xc(%ebp)
+  801399:	e8 f8 f2 ff ff       	call   800696 <fd_close>
+		return r;
+  80139e:	83 c4 10             	add    $0x10,%esp
+  8013a1:	eb e5                	jmp    801388 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8013a3:	83 ec 0c             	sub    $0xc,%esp
+  8013a6:	ff 75 f4             	push   -0xc(%ebp)
+  8013a9:	e8 d8 f1 ff ff       	call   800586 <fd2data>
+  8013ae:	83 c4 0c             	add    $0xc,%esp
+  8013b1:	68 07 04 00 00       	push   $0x407
+  8013b6:	50                   	push   %eax
+  8013b7:	6a 00                	push   $0x0
+  8013b9:	e8 b7 ed ff ff       	call   800175 <sys_page_alloc>
+  8013be:	83 c4 10             	add    $0x10,%esp
+  8013c1:	85 c0                	test   %eax,%eax
+  8013c3:	75 b3                	jne    801378 <open+0x69>
+		fd->fd_file.buffered = 1;
+  8013c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013c8:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8013cc:	eb aa                	jmp    801378 <open+0x69>
+		return -E_BAD_PATH;
+  8013ce:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8013d3:	eb b3                	jmp    801388 <open+0x79>
+
+008013d5 <readdir>:
+{
+  8013d5:	55                   	push   %ebp
+  8013d6:	89 e5                	mov    %esp,%ebp
+  8013d8:	53                   	push   %ebx
+  8013d9:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013df:	50                   	push   %eax
+  8013e0:	ff 75 08             	push   0x8(%ebp)
+  8013e3:	e8 0b f2 ff ff       	call   8005f3 <fd_lookup>
+  8013e8:	89 c3                	mov    %eax,%ebx
+  8013ea:	83 c4 10             	add    $0x10,%esp
+  8013ed:	85 c0                	test   %eax,%eax
+  8013ef:	78 73                	js     801464 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8013f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013f4:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8013fa:	39 08                	cmp    %ecx,(%eax)
+  8013fc:	0f 85 82 00 00 00    	jne    801484 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801402:	83 ec 0c             	sub    $0xc,%esp
+  801405:	50                   	push   %eax
+  801406:	e8 c4 f9 ff ff       	call   800dcf <devfile_sync>
+  80140b:	89 c3                	mov    %eax,%ebx
+  80140d:	83 c4 10             	add    $0x10,%esp
+  801410:	85 c0                	test   %eax,%eax
+  801412:	78 50                	js     801464 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801414:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801417:	8b 40 0c             	mov    0xc(%eax),%eax
+  80141a:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  80141f:	8b 45 10             	mov    0x10(%ebp),%eax
+  801422:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801427:	8b 45 14             	mov    0x14(%ebp),%eax
+  80142a:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  80142f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801434:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801439:	e8 ed f8 ff ff       	call   800d2b <fsipc>
+  80143e:	89 c3                	mov    %eax,%ebx
+  801440:	85 c0                	test   %eax,%eax
+  801442:	7e 20                	jle    801464 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801444:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801447:	72 22                	jb     80146b <readdir+0x96>
+  801449:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80144e:	7f 1b                	jg     80146b <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801450:	83 ec 04             	sub    $0x4,%esp
+  801453:	50                   	push   %eax
+  801454:	68 00 60 80 00       	push   $0x806000
+  801459:	ff 75 0c             	push   0xc(%ebp)
+  80145c:	e8 1f 19 00 00       	call   802d80 <memmove>
+	return r;
+  801461:	83 c4 10             	add    $0x10,%esp
+}
+  801464:	89 d8                	mov    %ebx,%eax
+  801466:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801469:	c9                   	leave
+  80146a:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  80146b:	68 4b 38 80 00       	push   $0x80384b
+  801470:	68 24 38 80 00       	push   $0x803824
+  801475:	68 86 01 00 00       	push   $0x186
+  80147a:	68 39 38 80 00       	push   $0x803839
+  80147f:	e8 ad 10 00 00       	call   802531 <_panic>
+		return -E_NOT_SUPP;
+  801484:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801489:	eb d9                	jmp    801464 <readdir+0x8f>
+
+0080148b <munmap>:
+{
+  80148b:	55                   	push   %ebp
+  80148c:	89 e5                	mov    %esp,%ebp
+  80148e:	56                   	push   %esi
+  80148f:	53                   	push   %ebx
+  801490:	8b 75 08             	mov    0x8(%ebp),%esi
+  801493:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801496:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  80149c:	75 41                	jne    8014df <munmap+0x54>
+  80149e:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8014a4:	77 39                	ja     8014df <munmap+0x54>
+  8014a6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8014ab:	29 f0                	sub    %esi,%eax
+  8014ad:	39 d0                	cmp    %edx,%eax
+  8014af:	72 35                	jb     8014e6 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014b1:	89 f3                	mov    %esi,%ebx
+  8014b3:	01 d6                	add    %edx,%esi
+  8014b5:	39 f3                	cmp    %esi,%ebx
+  8014b7:	73 1a                	jae    8014d3 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8014b9:	83 ec 08             	sub    $0x8,%esp
+  8014bc:	53                   	push   %ebx
+  8014bd:	6a 00                	push   $0x0
+  8014bf:	e8 3e ed ff ff       	call   800202 <sys_page_unmap>
+  8014c4:	83 c4 10             	add    $0x10,%esp
+  8014c7:	85 c0                	test   %eax,%eax
+  8014c9:	78 0d                	js     8014d8 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8014cb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8014d1:	eb e2                	jmp    8014b5 <munmap+0x2a>
+	return 0;
+  8014d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014db:	5b                   	pop    %ebx
+  8014dc:	5e                   	pop    %esi
+  8014dd:	5d                   	pop    %ebp
+  8014de:	c3                   	ret
+		return -E_INVAL;
+  8014df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014e4:	eb f2                	jmp    8014d8 <munmap+0x4d>
+  8014e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014eb:	eb eb                	jmp    8014d8 <munmap+0x4d>
+
+008014ed <mmap>:
+{
+  8014ed:	55                   	push   %ebp
+  8014ee:	89 e5                	mov    %esp,%ebp
+  8014f0:	57                   	push   %edi
+  8014f1:	56                   	push   %esi
+  8014f2:	53                   	push   %ebx
+  8014f3:	83 ec 34             	sub    $0x34,%esp
+  8014f6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014f9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014fc:	50                   	push   %eax
+  8014fd:	ff 75 18             	push   0x18(%ebp)
+  801500:	e8 ee f0 ff ff       	call   8005f3 <fd_lookup>
+  801505:	89 c3                	mov    %eax,%ebx
+  801507:	83 c4 10             	add    $0x10,%esp
+  80150a:	85 c0                	test   %eax,%eax
+  80150c:	0f 88 0e 01 00 00    	js     801620 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801512:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801515:	a1 20 40 80 00       	mov    0x804020,%eax
+  80151a:	39 02                	cmp    %eax,(%edx)
+  80151c:	0f 85 50 01 00 00    	jne    801672 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801522:	8b 45 10             	mov    0x10(%ebp),%eax
+  801525:	83 e0 02             	and    $0x2,%eax
+  801528:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80152b:	74 0a                	je     801537 <mmap+0x4a>
+  80152d:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801531:	0f 84 42 01 00 00    	je     801679 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801537:	8b 42 08             	mov    0x8(%edx),%eax
+  80153a:	83 e0 03             	and    $0x3,%eax
+  80153d:	83 f8 01             	cmp    $0x1,%eax
+  801540:	0f 84 3a 01 00 00    	je     801680 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  801546:	8b 45 08             	mov    0x8(%ebp),%eax
+  801549:	0b 45 1c             	or     0x1c(%ebp),%eax
+  80154c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801551:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801554:	0f 85 2d 01 00 00    	jne    801687 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80155a:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80155e:	0f 88 2a 01 00 00    	js     80168e <mmap+0x1a1>
+  801564:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80156b:	0f 87 1d 01 00 00    	ja     80168e <mmap+0x1a1>
+  801571:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801576:	2b 45 08             	sub    0x8(%ebp),%eax
+  801579:	39 f8                	cmp    %edi,%eax
+  80157b:	0f 82 14 01 00 00    	jb     801695 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  801581:	83 ec 0c             	sub    $0xc,%esp
+  801584:	52                   	push   %edx
+  801585:	e8 45 f8 ff ff       	call   800dcf <devfile_sync>
+  80158a:	89 c3                	mov    %eax,%ebx
+  80158c:	83 c4 10             	add    $0x10,%esp
+  80158f:	85 c0                	test   %eax,%eax
+  801591:	0f 88 89 00 00 00    	js     801620 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  801597:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  80159d:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8015a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a8:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8015ab:	39 fe                	cmp    %edi,%esi
+  8015ad:	73 7b                	jae    80162a <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8015af:	89 f8                	mov    %edi,%eax
+  8015b1:	29 f0                	sub    %esi,%eax
+  8015b3:	c1 e8 0c             	shr    $0xc,%eax
+  8015b6:	ba 40 00 00 00       	mov    $0x40,%edx
+  8015bb:	39 d0                	cmp    %edx,%eax
+  8015bd:	0f 47 c2             	cmova  %edx,%eax
+  8015c0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8015c3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015c6:	8b 52 0c             	mov    0xc(%edx),%edx
+  8015c9:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  8015cf:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8015d2:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  8015d8:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8015dd:	89 f2                	mov    %esi,%edx
+  8015df:	03 55 08             	add    0x8(%ebp),%edx
+  8015e2:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8015e5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015ea:	e8 ea f6 ff ff       	call   800cd9 <fsipcv>
+  8015ef:	85 c0                	test   %eax,%eax
+  8015f1:	7e 12                	jle    801605 <mmap+0x118>
+  8015f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015f6:	85 c0                	test   %eax,%eax
+  8015f8:	0f 84 9e 00 00 00    	je     80169c <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8015fe:	c1 e0 0c             	shl    $0xc,%eax
+  801601:	01 c6                	add    %eax,%esi
+  801603:	eb a6                	jmp    8015ab <mmap+0xbe>
+			munmap(addr, done);
+  801605:	89 c3                	mov    %eax,%ebx
+  801607:	83 ec 08             	sub    $0x8,%esp
+  80160a:	56                   	push   %esi
+  80160b:	ff 75 08             	push   0x8(%ebp)
+  80160e:	e8 78 fe ff ff       	call   80148b <munmap>
+			return r < 0 ? r : -E_INVAL;
+  801613:	83 c4 10             	add    $0x10,%esp
+  801616:	85 db                	test   %ebx,%ebx
+  801618:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80161d:	0f 49 d8             	cmovns %eax,%ebx
+}
+  801620:	89 d8                	mov    %ebx,%eax
+  801622:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801625:	5b                   	pop    %ebx
+  801626:	5e                   	pop    %esi
+  801627:	5f                   	pop    %edi
+  801628:	5d                   	pop    %ebp
+  801629:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80162a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80162d:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80162f:	85 c0                	test   %eax,%eax
+  801631:	74 ed                	je     801620 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  801633:	be 00 00 00 00       	mov    $0x0,%esi
+  801638:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80163b:	39 fe                	cmp    %edi,%esi
+  80163d:	73 2e                	jae    80166d <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80163f:	83 ec 0c             	sub    $0xc,%esp
+  801642:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  801645:	50                   	push   %eax
+  801646:	e8 f6 19 00 00       	call   803041 <cowpage>
+  80164b:	83 c4 10             	add    $0x10,%esp
+  80164e:	85 c0                	test   %eax,%eax
+  801650:	78 08                	js     80165a <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  801652:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801658:	eb e1                	jmp    80163b <mmap+0x14e>
+				munmap(addr, len);
+  80165a:	89 c3                	mov    %eax,%ebx
+  80165c:	83 ec 08             	sub    $0x8,%esp
+  80165f:	57                   	push   %edi
+  801660:	ff 75 08             	push   0x8(%ebp)
+  801663:	e8 23 fe ff ff       	call   80148b <munmap>
+				return r;
+  801668:	83 c4 10             	add    $0x10,%esp
+  80166b:	eb b3                	jmp    801620 <mmap+0x133>
+	return 0;
+  80166d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801670:	eb ae                	jmp    801620 <mmap+0x133>
+		return -E_NOT_SUPP;
+  801672:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801677:	eb a7                	jmp    801620 <mmap+0x133>
+		return -E_NOT_SUPP;
+  801679:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80167e:	eb a0                	jmp    801620 <mmap+0x133>
+		return -E_INVAL;
+  801680:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801685:	eb 99                	jmp    801620 <mmap+0x133>
+  801687:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80168c:	eb 92                	jmp    801620 <mmap+0x133>
+  80168e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  801693:	eb 8b                	jmp    801620 <mmap+0x133>
+  801695:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80169a:	eb 84                	jmp    801620 <mmap+0x133>
+			munmap(addr, done);
+  80169c:	83 ec 08             	sub    $0x8,%esp
+  80169f:	56                   	push   %esi
+  8016a0:	ff 75 08             	push   0x8(%ebp)
+  8016a3:	e8 e3 fd ff ff       	call   80148b <munmap>
+  8016a8:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8016ab:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8016b0:	e9 6b ff ff ff       	jmp    801620 <mmap+0x133>
+
+008016b5 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8016b5:	55                   	push   %ebp
+  8016b6:	89 e5                	mov    %esp,%ebp
+  8016b8:	56                   	push   %esi
+  8016b9:	53                   	push   %ebx
+  8016ba:	83 ec 10             	sub    $0x10,%esp
+  8016bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8016c0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016c6:	e8 3d f9 ff ff       	call   801008 <fsring_slot>
+  8016cb:	85 c0                	test   %eax,%eax
+  8016cd:	78 60                	js     80172f <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8016cf:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8016d2:	8b 56 08             	mov    0x8(%esi),%edx
+  8016d5:	83 e2 03             	and    $0x3,%edx
+  8016d8:	83 fa 01             	cmp    $0x1,%edx
+  8016db:	74 59                	je     801736 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8016dd:	ba 01 00 00 00       	mov    $0x1,%edx
+  8016e2:	89 c1                	mov    %eax,%ecx
+  8016e4:	d3 e2                	shl    %cl,%edx
+  8016e6:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8016ec:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8016ef:	c1 e2 02             	shl    $0x2,%edx
+  8016f2:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8016f8:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  8016ff:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  801702:	8b 55 18             	mov    0x18(%ebp),%edx
+  801705:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  801708:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80170b:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80170e:	83 ec 08             	sub    $0x8,%esp
+  801711:	50                   	push   %eax
+  801712:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801717:	39 c3                	cmp    %eax,%ebx
+  801719:	0f 47 d8             	cmova  %eax,%ebx
+  80171c:	53                   	push   %ebx
+  80171d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801720:	89 f2                	mov    %esi,%edx
+  801722:	b8 03 00 00 00       	mov    $0x3,%eax
+  801727:	e8 1e f5 ff ff       	call   800c4a <fsring_post>
+  80172c:	83 c4 10             	add    $0x10,%esp
+}
+  80172f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801732:	5b                   	pop    %ebx
+  801733:	5e                   	pop    %esi
+  801734:	5d                   	pop    %ebp
+  801735:	c3                   	ret
+		return -E_INVAL;
+  801736:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80173b:	eb f2                	jmp    80172f <fsring_read+0x7a>
+
+0080173d <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80173d:	55                   	push   %ebp
+  80173e:	89 e5                	mov    %esp,%ebp
+  801740:	56                   	push   %esi
+  801741:	53                   	push   %ebx
+  801742:	83 ec 10             	sub    $0x10,%esp
+  801745:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  801748:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80174b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80174e:	e8 b5 f8 ff ff       	call   801008 <fsring_slot>
+  801753:	89 c3                	mov    %eax,%ebx
+  801755:	85 c0                	test   %eax,%eax
+  801757:	78 77                	js     8017d0 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  801759:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80175c:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801760:	74 77                	je     8017d9 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  801762:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801767:	39 c6                	cmp    %eax,%esi
+  801769:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80176c:	83 ec 04             	sub    $0x4,%esp
+  80176f:	56                   	push   %esi
+  801770:	ff 75 0c             	push   0xc(%ebp)
+  801773:	89 d8                	mov    %ebx,%eax
+  801775:	c1 e0 0c             	shl    $0xc,%eax
+  801778:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80177e:	50                   	push   %eax
+  80177f:	e8 fc 15 00 00       	call   802d80 <memmove>
+	fsring_busy |= 1 << slot;
+  801784:	b8 01 00 00 00       	mov    $0x1,%eax
+  801789:	89 d9                	mov    %ebx,%ecx
+  80178b:	d3 e0                	shl    %cl,%eax
+  80178d:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  801793:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801796:	c1 e0 02             	shl    $0x2,%eax
+  801799:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  80179f:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8017a6:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8017a9:	8b 45 18             	mov    0x18(%ebp),%eax
+  8017ac:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8017af:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8017b6:	83 c4 08             	add    $0x8,%esp
+  8017b9:	53                   	push   %ebx
+  8017ba:	56                   	push   %esi
+  8017bb:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8017be:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8017c1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017c6:	e8 7f f4 ff ff       	call   800c4a <fsring_post>
+  8017cb:	89 c3                	mov    %eax,%ebx
+  8017cd:	83 c4 10             	add    $0x10,%esp
+}
+  8017d0:	89 d8                	mov    %ebx,%eax
+  8017d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017d5:	5b                   	pop    %ebx
+  8017d6:	5e                   	pop    %esi
+  8017d7:	5d                   	pop    %ebp
+  8017d8:	c3                   	ret
+		return -E_INVAL;
+  8017d9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8017de:	eb f0                	jmp    8017d0 <fsring_write+0x93>
+
+008017e0 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8017e0:	55                   	push   %ebp
+  8017e1:	89 e5                	mov    %esp,%ebp
+  8017e3:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8017e6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8017e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ec:	e8 17 f8 ff ff       	call   801008 <fsring_slot>
+  8017f1:	85 c0                	test   %eax,%eax
+  8017f3:	78 4c                	js     801841 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8017f5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8017fa:	89 c1                	mov    %eax,%ecx
+  8017fc:	d3 e2                	shl    %cl,%edx
+  8017fe:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  801804:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  801807:	c1 e2 02             	shl    $0x2,%edx
+  80180a:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  801810:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  801817:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80181a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80181d:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  801820:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801823:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  801826:	83 ec 08             	sub    $0x8,%esp
+  801829:	50                   	push   %eax
+  80182a:	6a 00                	push   $0x0
+  80182c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801831:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801834:	b8 05 00 00 00       	mov    $0x5,%eax
+  801839:	e8 0c f4 ff ff       	call   800c4a <fsring_post>
+  80183e:	83 c4 10             	add    $0x10,%esp
+}
+  801841:	c9                   	leave
+  801842:	c3                   	ret
+
+00801843 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  801843:	55                   	push   %ebp
+  801844:	89 e5                	mov    %esp,%ebp
+  801846:	57                   	push   %edi
+  801847:	56                   	push   %esi
+  801848:	53                   	push   %ebx
+  801849:	83 ec 1c             	sub    $0x1c,%esp
+  80184c:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  801850:	a1 00 50 80 00       	mov    0x805000,%eax
+  801855:	8b 40 48             	mov    0x48(%eax),%eax
+  801858:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  80185e:	74 12                	je     801872 <fsring_reap+0x2f>
+		return 0;
+  801860:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  801865:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801868:	5b                   	pop    %ebx
+  801869:	5e                   	pop    %esi
+  80186a:	5f                   	pop    %edi
+  80186b:	5d                   	pop    %ebp
+  80186c:	c3                   	ret
+		sys_yield();
+  80186d:	e8 e4 e8 ff ff       	call   800156 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  801872:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  801878:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80187d:	39 c2                	cmp    %eax,%edx
+  80187f:	75 18                	jne    801899 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  801881:	84 db                	test   %bl,%bl
+  801883:	0f 84 21 01 00 00    	je     8019aa <fsring_reap+0x167>
+  801889:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  801890:	75 db                	jne    80186d <fsring_reap+0x2a>
+			return 0;
+  801892:	b8 00 00 00 00       	mov    $0x0,%eax
+  801897:	eb cc                	jmp    801865 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  801899:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80189e:	83 e0 0f             	and    $0xf,%eax
+  8018a1:	83 c0 2a             	add    $0x2a,%eax
+  8018a4:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8018ab:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8018b2:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8018b7:	83 c0 01             	add    $0x1,%eax
+  8018ba:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8018bf:	83 fb 0f             	cmp    $0xf,%ebx
+  8018c2:	77 5b                	ja     80191f <fsring_reap+0xdc>
+  8018c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8018c9:	89 d9                	mov    %ebx,%ecx
+  8018cb:	d3 e6                	shl    %cl,%esi
+  8018cd:	89 f0                	mov    %esi,%eax
+  8018cf:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8018d5:	74 48                	je     80191f <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8018d7:	89 d8                	mov    %ebx,%eax
+  8018d9:	c1 e0 0c             	shl    $0xc,%eax
+  8018dc:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8018e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8018e5:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8018e8:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  8018ef:	83 f8 03             	cmp    $0x3,%eax
+  8018f2:	74 40                	je     801934 <fsring_reap+0xf1>
+  8018f4:	83 f8 05             	cmp    $0x5,%eax
+  8018f7:	74 64                	je     80195d <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8018f9:	f7 d6                	not    %esi
+  8018fb:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  801901:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801904:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  80190b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80190e:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  801910:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801913:	89 38                	mov    %edi,(%eax)
+	return 1;
+  801915:	b8 01 00 00 00       	mov    $0x1,%eax
+  80191a:	e9 46 ff ff ff       	jmp    801865 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80191f:	53                   	push   %ebx
+  801920:	68 61 38 80 00       	push   $0x803861
+  801925:	68 8f 02 00 00       	push   $0x28f
+  80192a:	68 39 38 80 00       	push   $0x803839
+  80192f:	e8 fd 0b 00 00       	call   802531 <_panic>
+		if (cqe.cqe_result > 0)
+  801934:	85 ff                	test   %edi,%edi
+  801936:	7e c1                	jle    8018f9 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801938:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  80193b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801940:	39 c7                	cmp    %eax,%edi
+  801942:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  801945:	50                   	push   %eax
+  801946:	ff 75 e4             	push   -0x1c(%ebp)
+  801949:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80194c:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  801953:	e8 28 14 00 00       	call   802d80 <memmove>
+  801958:	83 c4 10             	add    $0x10,%esp
+  80195b:	eb 9c                	jmp    8018f9 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80195d:	85 ff                	test   %edi,%edi
+  80195f:	75 98                	jne    8018f9 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  801961:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  801964:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80196b:	83 ec 08             	sub    $0x8,%esp
+  80196e:	ff 75 e4             	push   -0x1c(%ebp)
+  801971:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801974:	51                   	push   %ecx
+  801975:	e8 80 12 00 00       	call   802bfa <strcpy>
+			st->st_size = ret->ret_size;
+  80197a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80197d:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  801983:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801986:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80198c:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  801992:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  801998:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  80199f:	40 80 00 
+  8019a2:	83 c4 10             	add    $0x10,%esp
+  8019a5:	e9 4f ff ff ff       	jmp    8018f9 <fsring_reap+0xb6>
+			return 0;
+  8019aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019af:	e9 b1 fe ff ff       	jmp    801865 <fsring_reap+0x22>
+
+008019b4 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8019b4:	55                   	push   %ebp
+  8019b5:	89 e5                	mov    %esp,%ebp
+  8019b7:	57                   	push   %edi
+  8019b8:	56                   	push   %esi
+  8019b9:	53                   	push   %ebx
+  8019ba:	83 ec 28             	sub    $0x28,%esp
+  8019bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019c0:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8019c3:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8019c6:	53                   	push   %ebx
+  8019c7:	e8 f3 11 00 00       	call   802bbf <strlen>
+  8019cc:	83 c4 10             	add    $0x10,%esp
+  8019cf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8019d4:	0f 8f 02 01 00 00    	jg     801adc <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8019da:	83 ec 08             	sub    $0x8,%esp
+  8019dd:	53                   	push   %ebx
+  8019de:	68 00 60 80 00       	push   $0x806000
+  8019e3:	e8 12 12 00 00       	call   802bfa <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8019e8:	83 c4 10             	add    $0x10,%esp
+  8019eb:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8019f1:	76 69                	jbe    801a5c <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8019f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019f6:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8019fc:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801a01:	29 d1                	sub    %edx,%ecx
+  801a03:	39 f9                	cmp    %edi,%ecx
+  801a05:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a08:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a0b:	89 f9                	mov    %edi,%ecx
+  801a0d:	01 c1                	add    %eax,%ecx
+  801a0f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a12:	eb 0f                	jmp    801a23 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  801a14:	0f b6 10             	movzbl (%eax),%edx
+  801a17:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801a19:	05 00 10 00 00       	add    $0x1000,%eax
+  801a1e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a23:	39 c8                	cmp    %ecx,%eax
+  801a25:	72 ed                	jb     801a14 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  801a27:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a2a:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  801a30:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  801a36:	83 ec 0c             	sub    $0xc,%esp
+  801a39:	6a 07                	push   $0x7
+  801a3b:	89 f9                	mov    %edi,%ecx
+  801a3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a40:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a45:	e8 3f f1 ff ff       	call   800b89 <fsipc_pages>
+  801a4a:	89 c7                	mov    %eax,%edi
+  801a4c:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  801a4f:	85 f6                	test   %esi,%esi
+  801a51:	74 7f                	je     801ad2 <file_slurp+0x11e>
+  801a53:	8d 43 01             	lea    0x1(%ebx),%eax
+  801a56:	85 ff                	test   %edi,%edi
+  801a58:	79 3c                	jns    801a96 <file_slurp+0xe2>
+  801a5a:	eb 76                	jmp    801ad2 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  801a5c:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  801a62:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a67:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a6c:	e8 ba f2 ff ff       	call   800d2b <fsipc>
+  801a71:	89 c7                	mov    %eax,%edi
+  801a73:	85 c0                	test   %eax,%eax
+  801a75:	7e d8                	jle    801a4f <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  801a77:	83 ec 04             	sub    $0x4,%esp
+  801a7a:	50                   	push   %eax
+  801a7b:	68 08 60 80 00       	push   $0x806008
+  801a80:	ff 75 0c             	push   0xc(%ebp)
+  801a83:	e8 f8 12 00 00       	call   802d80 <memmove>
+  801a88:	83 c4 10             	add    $0x10,%esp
+  801a8b:	eb c2                	jmp    801a4f <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  801a8d:	80 fa 2f             	cmp    $0x2f,%dl
+  801a90:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  801a93:	83 c0 01             	add    $0x1,%eax
+  801a96:	89 c1                	mov    %eax,%ecx
+  801a98:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  801a9c:	84 d2                	test   %dl,%dl
+  801a9e:	75 ed                	jne    801a8d <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  801aa0:	83 ec 04             	sub    $0x4,%esp
+  801aa3:	68 80 00 00 00       	push   $0x80
+  801aa8:	53                   	push   %ebx
+  801aa9:	56                   	push   %esi
+  801aaa:	e8 c1 11 00 00       	call   802c70 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  801aaf:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ab4:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  801aba:	a1 04 60 80 00       	mov    0x806004,%eax
+  801abf:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  801ac5:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  801acc:	40 80 00 
+  801acf:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801ad2:	89 f8                	mov    %edi,%eax
+  801ad4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ad7:	5b                   	pop    %ebx
+  801ad8:	5e                   	pop    %esi
+  801ad9:	5f                   	pop    %edi
+  801ada:	5d                   	pop    %ebp
+  801adb:	c3                   	ret
+		return -E_BAD_PATH;
+  801adc:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  801ae1:	eb ef                	jmp    801ad2 <file_slurp+0x11e>
+
+00801ae3 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801ae3:	55                   	push   %ebp
+  801ae4:	89 e5                	mov    %esp,%ebp
+  801ae6:	53                   	push   %ebx
+  801ae7:	83 ec 10             	sub    $0x10,%esp
+  801aea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801aed:	53                   	push   %ebx
+  801aee:	e8 cc 10 00 00       	call   802bbf <strlen>
+  801af3:	83 c4 10             	add    $0x10,%esp
+  801af6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801afb:	7f 25                	jg     801b22 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801afd:	83 ec 08             	sub    $0x8,%esp
+  801b00:	53                   	push   %ebx
+  801b01:	68 00 60 80 00       	push   $0x806000
+  801b06:	e8 ef 10 00 00       	call   802bfa <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b10:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b15:	e8 11 f2 ff ff       	call   800d2b <fsipc>
+  801b1a:	83 c4 10             	add    $0x10,%esp
+}
+  801b1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b20:	c9                   	leave
+  801b21:	c3                   	ret
+		return -E_BAD_PATH;
+  801b22:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b27:	eb f4                	jmp    801b1d <remove+0x3a>
+
+00801b29 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b29:	55                   	push   %ebp
+  801b2a:	89 e5                	mov    %esp,%ebp
+  801b2c:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b34:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b39:	e8 ed f1 ff ff       	call   800d2b <fsipc>
+}
+  801b3e:	c9                   	leave
+  801b3f:	c3                   	ret
+
+00801b40 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  801b40:	55                   	push   %ebp
+  801b41:	89 e5                	mov    %esp,%ebp
+  801b43:	57                   	push   %edi
+  801b44:	56                   	push   %esi
+  801b45:	53                   	push   %ebx
+  801b46:	83 ec 18             	sub    $0x18,%esp
+  801b49:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  801b52:	57                   	push   %edi
+  801b53:	e8 67 10 00 00       	call   802bbf <strlen>
+  801b58:	83 c4 10             	add    $0x10,%esp
+  801b5b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b60:	7f 4c                	jg     801bae <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  801b62:	83 ec 08             	sub    $0x8,%esp
+  801b65:	57                   	push   %edi
+  801b66:	68 00 60 80 00       	push   $0x806000
+  801b6b:	e8 8a 10 00 00       	call   802bfa <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  801b70:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b75:	b8 10 00 00 00       	mov    $0x10,%eax
+  801b7a:	e8 ac f1 ff ff       	call   800d2b <fsipc>
+  801b7f:	83 c4 10             	add    $0x10,%esp
+  801b82:	85 c0                	test   %eax,%eax
+  801b84:	78 20                	js     801ba6 <defrag+0x66>
+		return r;
+	if (before)
+  801b86:	85 f6                	test   %esi,%esi
+  801b88:	74 07                	je     801b91 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  801b8a:	a1 00 60 80 00       	mov    0x806000,%eax
+  801b8f:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  801b91:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  801b96:	85 db                	test   %ebx,%ebx
+  801b98:	74 0c                	je     801ba6 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  801b9a:	a1 04 60 80 00       	mov    0x806004,%eax
+  801b9f:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  801ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ba6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ba9:	5b                   	pop    %ebx
+  801baa:	5e                   	pop    %esi
+  801bab:	5f                   	pop    %edi
+  801bac:	5d                   	pop    %ebp
+  801bad:	c3                   	ret
+		return -E_BAD_PATH;
+  801bae:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801bb3:	eb f1                	jmp    801ba6 <defrag+0x66>
+
+00801bb5 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  801bb5:	55                   	push   %ebp
+  801bb6:	89 e5                	mov    %esp,%ebp
+  801bb8:	53                   	push   %ebx
+  801bb9:	83 ec 04             	sub    $0x4,%esp
+  801bbc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  801bbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc4:	b8 11 00 00 00       	mov    $0x11,%eax
+  801bc9:	e8 5d f1 ff ff       	call   800d2b <fsipc>
+  801bce:	85 c0                	test   %eax,%eax
+  801bd0:	78 34                	js     801c06 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  801bd2:	a1 00 60 80 00       	mov    0x806000,%eax
+  801bd7:	89 03                	mov    %eax,(%ebx)
+  801bd9:	a1 04 60 80 00       	mov    0x806004,%eax
+  801bde:	89 43 04             	mov    %eax,0x4(%ebx)
+  801be1:	a1 08 60 80 00       	mov    0x806008,%eax
+  801be6:	89 43 08             	mov    %eax,0x8(%ebx)
+  801be9:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  801bee:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801bf1:	a1 10 60 80 00       	mov    0x806010,%eax
+  801bf6:	89 43 10             	mov    %eax,0x10(%ebx)
+  801bf9:	a1 14 60 80 00       	mov    0x806014,%eax
+  801bfe:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  801c01:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c09:	c9                   	leave
+  801c0a:	c3                   	ret
+
+00801c0b <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c0b:	55                   	push   %ebp
+  801c0c:	89 e5                	mov    %esp,%ebp
+  801c0e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c11:	68 7a 38 80 00       	push   $0x80387a
+  801c16:	ff 75 0c             	push   0xc(%ebp)
+  801c19:	e8 dc 0f 00 00       	call   802bfa <strcpy>
+	return 0;
+}
+  801c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c23:	c9                   	leave
+  801c24:	c3                   	ret
+
+00801c25 <devsock_close>:
+{
+  801c25:	55                   	push   %ebp
+  801c26:	89 e5                	mov    %esp,%ebp
+  801c28:	53                   	push   %ebx
+  801c29:	83 ec 10             	sub    $0x10,%esp
+  801c2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c2f:	53                   	push   %ebx
+  801c30:	e8 ed 17 00 00       	call   803422 <pageref>
+  801c35:	89 c2                	mov    %eax,%edx
+  801c37:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c3f:	83 fa 01             	cmp    $0x1,%edx
+  801c42:	74 05                	je     801c49 <devsock_close+0x24>
+}
+  801c44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c47:	c9                   	leave
+  801c48:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801c49:	83 ec 0c             	sub    $0xc,%esp
+  801c4c:	ff 73 0c             	push   0xc(%ebx)
+  801c4f:	e8 b7 02 00 00       	call   801f0b <nsipc_close>
+  801c54:	83 c4 10             	add    $0x10,%esp
+  801c57:	eb eb                	jmp    801c44 <devsock_close+0x1f>
+
+00801c59 <devsock_write>:
+{
+  801c59:	55                   	push   %ebp
+  801c5a:	89 e5                	mov    %esp,%ebp
+  801c5c:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  801c5f:	6a 00                	push   $0x0
+  801c61:	ff 75 10             	push   0x10(%ebp)
+  801c64:	ff 75 0c             	push   0xc(%ebp)
+  801c67:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c6a:	ff 70 0c             	push   0xc(%eax)
+  801c6d:	e8 79 03 00 00       	call   801feb <nsipc_send>
+}
+  801c72:	c9                   	leave
+  801c73:	c3                   	ret
+
+00801c74 <devsock_read>:
+{
+  801c74:	55                   	push   %ebp
+  801c75:	89 e5                	mov    %esp,%ebp
+  801c77:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  801c7a:	6a 00                	push   $0x0
+  801c7c:	ff 75 10             	push   0x10(%ebp)
+  801c7f:	ff 75 0c             	push   0xc(%ebp)
+  801c82:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c85:	ff 70 0c             	push   0xc(%eax)
+  801c88:	e8 ef 02 00 00       	call   801f7c <nsipc_recv>
+}
+  801c8d:	c9                   	leave
+  801c8e:	c3                   	ret
+
+00801c8f <fd2sockid>:
+{
+  801c8f:	55                   	push   %ebp
+  801c90:	89 e5                	mov    %esp,%ebp
+  801c92:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c95:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c98:	52                   	push   %edx
+  801c99:	50                   	push   %eax
+  801c9a:	e8 54 e9 ff ff       	call   8005f3 <fd_lookup>
+  801c9f:	83 c4 10             	add    $0x10,%esp
+  801ca2:	85 c0                	test   %eax,%eax
+  801ca4:	78 10                	js     801cb6 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801ca6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ca9:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  801caf:	39 08                	cmp    %ecx,(%eax)
+  801cb1:	75 05                	jne    801cb8 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801cb3:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801cb6:	c9                   	leave
+  801cb7:	c3                   	ret
+		return -E_NOT_SUPP;
+  801cb8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cbd:	eb f7                	jmp    801cb6 <fd2sockid+0x27>
+
+00801cbf <alloc_sockfd>:
+{
+  801cbf:	55                   	push   %ebp
+  801cc0:	89 e5                	mov    %esp,%ebp
+  801cc2:	56                   	push   %esi
+  801cc3:	53                   	push   %ebx
+  801cc4:	83 ec 1c             	sub    $0x1c,%esp
+  801cc7:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801cc9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ccc:	50                   	push   %eax
+  801ccd:	e8 cb e8 ff ff       	call   80059d <fd_alloc>
+  801cd2:	89 c3                	mov    %eax,%ebx
+  801cd4:	83 c4 10             	add    $0x10,%esp
+  801cd7:	85 c0                	test   %eax,%eax
+  801cd9:	78 43                	js     801d1e <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801cdb:	83 ec 04             	sub    $0x4,%esp
+  801cde:	68 07 04 00 00       	push   $0x407
+  801ce3:	ff 75 f4             	push   -0xc(%ebp)
+  801ce6:	6a 00                	push   $0x0
+  801ce8:	e8 88 e4 ff ff       	call   800175 <sys_page_alloc>
+  801ced:	89 c3                	mov    %eax,%ebx
+  801cef:	83 c4 10             	add    $0x10,%esp
+  801cf2:	85 c0                	test   %eax,%eax
+  801cf4:	78 28                	js     801d1e <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801cf6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cf9:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  801cff:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d04:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d0b:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d0e:	83 ec 0c             	sub    $0xc,%esp
+  801d11:	50                   	push   %eax
+  801d12:	e8 5f e8 ff ff       	call   800576 <fd2num>
+  801d17:	89 c3                	mov    %eax,%ebx
+  801d19:	83 c4 10             	add    $0x10,%esp
+  801d1c:	eb 0c                	jmp    801d2a <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d1e:	83 ec 0c             	sub    $0xc,%esp
+  801d21:	56                   	push   %esi
+  801d22:	e8 e4 01 00 00       	call   801f0b <nsipc_close>
+		return r;
+  801d27:	83 c4 10             	add    $0x10,%esp
+}
+  801d2a:	89 d8                	mov    %ebx,%eax
+  801d2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d2f:	5b                   	pop    %ebx
+  801d30:	5e                   	pop    %esi
+  801d31:	5d                   	pop    %ebp
+  801d32:	c3                   	ret
+
+00801d33 <accept>:
+{
+  801d33:	55                   	push   %ebp
+  801d34:	89 e5                	mov    %esp,%ebp
+  801d36:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d3c:	e8 4e ff ff ff       	call   801c8f <fd2sockid>
+  801d41:	85 c0                	test   %eax,%eax
+  801d43:	78 1b                	js     801d60 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  801d45:	83 ec 04             	sub    $0x4,%esp
+  801d48:	ff 75 10             	push   0x10(%ebp)
+  801d4b:	ff 75 0c             	push   0xc(%ebp)
+  801d4e:	50                   	push   %eax
+  801d4f:	e8 0e 01 00 00       	call   801e62 <nsipc_accept>
+  801d54:	83 c4 10             	add    $0x10,%esp
+  801d57:	85 c0                	test   %eax,%eax
+  801d59:	78 05                	js     801d60 <accept+0x2d>
+	return alloc_sockfd(r);
+  801d5b:	e8 5f ff ff ff       	call   801cbf <alloc_sockfd>
+}
+  801d60:	c9                   	leave
+  801d61:	c3                   	ret
+
+00801d62 <bind>:
+{
+  801d62:	55                   	push   %ebp
+  801d63:	89 e5                	mov    %esp,%ebp
+  801d65:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d68:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d6b:	e8 1f ff ff ff       	call   801c8f <fd2sockid>
+  801d70:	85 c0                	test   %eax,%eax
+  801d72:	78 12                	js     801d86 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d74:	83 ec 04             	sub    $0x4,%esp
+  801d77:	ff 75 10             	push   0x10(%ebp)
+  801d7a:	ff 75 0c             	push   0xc(%ebp)
+  801d7d:	50                   	push   %eax
+  801d7e:	e8 31 01 00 00       	call   801eb4 <nsipc_bind>
+  801d83:	83 c4 10             	add    $0x10,%esp
+}
+  801d86:	c9                   	leave
+  801d87:	c3                   	ret
+
+00801d88 <shutdown>:
+{
+  801d88:	55                   	push   %ebp
+  801d89:	89 e5                	mov    %esp,%ebp
+  801d8b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d91:	e8 f9 fe ff ff       	call   801c8f <fd2sockid>
+  801d96:	85 c0                	test   %eax,%eax
+  801d98:	78 0f                	js     801da9 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801d9a:	83 ec 08             	sub    $0x8,%esp
+  801d9d:	ff 75 0c             	push   0xc(%ebp)
+  801da0:	50                   	push   %eax
+  801da1:	e8 43 01 00 00       	call   801ee9 <nsipc_shutdown>
+  801da6:	83 c4 10             	add    $0x10,%esp
+}
+  801da9:	c9                   	leave
+  801daa:	c3                   	ret
+
+00801dab <connect>:
+{
+  801dab:	55                   	push   %ebp
+  801dac:	89 e5                	mov    %esp,%ebp
+  801dae:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801db1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db4:	e8 d6 fe ff ff       	call   801c8f <fd2sockid>
+  801db9:	85 c0                	test   %eax,%eax
+  801dbb:	78 12                	js     801dcf <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801dbd:	83 ec 04             	sub    $0x4,%esp
+  801dc0:	ff 75 10             	push   0x10(%ebp)
+  801dc3:	ff 75 0c             	push   0xc(%ebp)
+  801dc6:	50                   	push   %eax
+  801dc7:	e8 59 01 00 00       	call   801f25 <nsipc_connect>
+  801dcc:	83 c4 10             	add    $0x10,%esp
+}
+  801dcf:	c9                   	leave
+  801dd0:	c3                   	ret
+
+00801dd1 <listen>:
+{
+  801dd1:	55                   	push   %ebp
+  801dd2:	89 e5                	mov    %esp,%ebp
+  801dd4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dda:	e8 b0 fe ff ff       	call   801c8f <fd2sockid>
+  801ddf:	85 c0                	test   %eax,%eax
+  801de1:	78 0f                	js     801df2 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801de3:	83 ec 08             	sub    $0x8,%esp
+  801de6:	ff 75 0c             	push   0xc(%ebp)
+  801de9:	50                   	push   %eax
+  801dea:	e8 6b 01 00 00       	call   801f5a <nsipc_listen>
+  801def:	83 c4 10             	add    $0x10,%esp
+}
+  801df2:	c9                   	leave
+  801df3:	c3                   	ret
+
+00801df4 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801df4:	55                   	push   %ebp
+  801df5:	89 e5                	mov    %esp,%ebp
+  801df7:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801dfa:	ff 75 10             	push   0x10(%ebp)
+  801dfd:	ff 75 0c             	push   0xc(%ebp)
+  801e00:	ff 75 08             	push   0x8(%ebp)
+  801e03:	e8 41 02 00 00       	call   802049 <nsipc_socket>
+  801e08:	83 c4 10             	add    $0x10,%esp
+  801e0b:	85 c0                	test   %eax,%eax
+  801e0d:	78 05                	js     801e14 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801e0f:	e8 ab fe ff ff       	call   801cbf <alloc_sockfd>
+}
+  801e14:	c9                   	leave
+  801e15:	c3                   	ret
+
+00801e16 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801e16:	55                   	push   %ebp
+  801e17:	89 e5                	mov    %esp,%ebp
+  801e19:	53                   	push   %ebx
+  801e1a:	83 ec 04             	sub    $0x4,%esp
+  801e1d:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  801e1f:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  801e26:	74 26                	je     801e4e <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801e28:	6a 07                	push   $0x7
+  801e2a:	68 00 80 80 00       	push   $0x808000
+  801e2f:	53                   	push   %ebx
+  801e30:	ff 35 00 90 80 00    	push   0x809000
+  801e36:	e8 6f 14 00 00       	call   8032aa <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801e3b:	83 c4 0c             	add    $0xc,%esp
+  801e3e:	6a 00                	push   $0x0
+  801e40:	6a 00                	push   $0x0
+  801e42:	6a 00                	push   $0x0
+  801e44:	e8 f6 13 00 00       	call   80323f <ipc_recv>
+}
+  801e49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e4c:	c9                   	leave
+  801e4d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801e4e:	83 ec 0c             	sub    $0xc,%esp
+  801e51:	6a 02                	push   $0x2
+  801e53:	e8 8b 15 00 00       	call   8033e3 <ipc_find_env>
+  801e58:	a3 00 90 80 00       	mov    %eax,0x809000
+  801e5d:	83 c4 10             	add    $0x10,%esp
+  801e60:	eb c6                	jmp    801e28 <nsipc+0x12>
+
+00801e62 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  801e62:	55                   	push   %ebp
+  801e63:	89 e5                	mov    %esp,%ebp
+  801e65:	56                   	push   %esi
+  801e66:	53                   	push   %ebx
+  801e67:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801e6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e6d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  801e72:	8b 06                	mov    (%esi),%eax
+  801e74:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801e79:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e7e:	e8 93 ff ff ff       	call   801e16 <nsipc>
+  801e83:	89 c3                	mov    %eax,%ebx
+  801e85:	85 c0                	test   %eax,%eax
+  801e87:	79 09                	jns    801e92 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801e89:	89 d8                	mov    %ebx,%eax
+  801e8b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e8e:	5b                   	pop    %ebx
+  801e8f:	5e                   	pop    %esi
+  801e90:	5d                   	pop    %ebp
+  801e91:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801e92:	83 ec 04             	sub    $0x4,%esp
+  801e95:	ff 35 10 80 80 00    	push   0x808010
+  801e9b:	68 00 80 80 00       	push   $0x808000
+  801ea0:	ff 75 0c             	push   0xc(%ebp)
+  801ea3:	e8 d8 0e 00 00       	call   802d80 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801ea8:	a1 10 80 80 00       	mov    0x808010,%eax
+  801ead:	89 06                	mov    %eax,(%esi)
+  801eaf:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801eb2:	eb d5                	jmp    801e89 <nsipc_accept+0x27>
+
+00801eb4 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801eb4:	55                   	push   %ebp
+  801eb5:	89 e5                	mov    %esp,%ebp
+  801eb7:	53                   	push   %ebx
+  801eb8:	83 ec 08             	sub    $0x8,%esp
+  801ebb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801ebe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec1:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801ec6:	53                   	push   %ebx
+  801ec7:	ff 75 0c             	push   0xc(%ebp)
+  801eca:	68 04 80 80 00       	push   $0x808004
+  801ecf:	e8 ac 0e 00 00       	call   802d80 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801ed4:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  801eda:	b8 02 00 00 00       	mov    $0x2,%eax
+  801edf:	e8 32 ff ff ff       	call   801e16 <nsipc>
+}
+  801ee4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee7:	c9                   	leave
+  801ee8:	c3                   	ret
+
+00801ee9 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801ee9:	55                   	push   %ebp
+  801eea:	89 e5                	mov    %esp,%ebp
+  801eec:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801eef:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  801ef7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801efa:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  801eff:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f04:	e8 0d ff ff ff       	call   801e16 <nsipc>
+}
+  801f09:	c9                   	leave
+  801f0a:	c3                   	ret
+
+00801f0b <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801f0b:	55                   	push   %ebp
+  801f0c:	89 e5                	mov    %esp,%ebp
+  801f0e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801f11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f14:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  801f19:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f1e:	e8 f3 fe ff ff       	call   801e16 <nsipc>
+}
+  801f23:	c9                   	leave
+  801f24:	c3                   	ret
+
+00801f25 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801f25:	55                   	push   %ebp
+  801f26:	89 e5                	mov    %esp,%ebp
+  801f28:	53                   	push   %ebx
+  801f29:	83 ec 08             	sub    $0x8,%esp
+  801f2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801f2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f32:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801f37:	53                   	push   %ebx
+  801f38:	ff 75 0c             	push   0xc(%ebp)
+  801f3b:	68 04 80 80 00       	push   $0x808004
+  801f40:	e8 3b 0e 00 00       	call   802d80 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801f45:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  801f4b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f50:	e8 c1 fe ff ff       	call   801e16 <nsipc>
+}
+  801f55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f58:	c9                   	leave
+  801f59:	c3                   	ret
+
+00801f5a <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801f5a:	55                   	push   %ebp
+  801f5b:	89 e5                	mov    %esp,%ebp
+  801f5d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801f60:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f63:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  801f68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f6b:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  801f70:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f75:	e8 9c fe ff ff       	call   801e16 <nsipc>
+}
+  801f7a:	c9                   	leave
+  801f7b:	c3                   	ret
+
+00801f7c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801f7c:	55                   	push   %ebp
+  801f7d:	89 e5                	mov    %esp,%ebp
+  801f7f:	56                   	push   %esi
+  801f80:	53                   	push   %ebx
+  801f81:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801f84:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f87:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  801f8c:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  801f92:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f95:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801f9a:	b8 07 00 00 00       	mov    $0x7,%eax
+  801f9f:	e8 72 fe ff ff       	call   801e16 <nsipc>
+  801fa4:	89 c3                	mov    %eax,%ebx
+  801fa6:	85 c0                	test   %eax,%eax
+  801fa8:	78 22                	js     801fcc <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801faa:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801faf:	39 c6                	cmp    %eax,%esi
+  801fb1:	0f 4e c6             	cmovle %esi,%eax
+  801fb4:	39 c3                	cmp    %eax,%ebx
+  801fb6:	7f 1d                	jg     801fd5 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801fb8:	83 ec 04             	sub    $0x4,%esp
+  801fbb:	53                   	push   %ebx
+  801fbc:	68 00 80 80 00       	push   $0x808000
+  801fc1:	ff 75 0c             	push   0xc(%ebp)
+  801fc4:	e8 b7 0d 00 00       	call   802d80 <memmove>
+  801fc9:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801fcc:	89 d8                	mov    %ebx,%eax
+  801fce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd1:	5b                   	pop    %ebx
+  801fd2:	5e                   	pop    %esi
+  801fd3:	5d                   	pop    %ebp
+  801fd4:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801fd5:	68 86 38 80 00       	push   $0x803886
+  801fda:	68 24 38 80 00       	push   $0x803824
+  801fdf:	6a 62                	push   $0x62
+  801fe1:	68 9b 38 80 00       	push   $0x80389b
+  801fe6:	e8 46 05 00 00       	call   802531 <_panic>
+
+00801feb <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801feb:	55                   	push   %ebp
+  801fec:	89 e5                	mov    %esp,%ebp
+  801fee:	53                   	push   %ebx
+  801fef:	83 ec 04             	sub    $0x4,%esp
+  801ff2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801ff5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff8:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  801ffd:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802003:	7f 2e                	jg     802033 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802005:	83 ec 04             	sub    $0x4,%esp
+  802008:	53                   	push   %ebx
+  802009:	ff 75 0c             	push   0xc(%ebp)
+  80200c:	68 0c 80 80 00       	push   $0x80800c
+  802011:	e8 6a 0d 00 00       	call   802d80 <memmove>
+	nsipcbuf.send.req_size = size;
+  802016:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  80201c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80201f:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802024:	b8 08 00 00 00       	mov    $0x8,%eax
+  802029:	e8 e8 fd ff ff       	call   801e16 <nsipc>
+}
+  80202e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802031:	c9                   	leave
+  802032:	c3                   	ret
+	assert(size < 1600);
+  802033:	68 a7 38 80 00       	push   $0x8038a7
+  802038:	68 24 38 80 00       	push   $0x803824
+  80203d:	6a 6d                	push   $0x6d
+  80203f:	68 9b 38 80 00       	push   $0x80389b
+  802044:	e8 e8 04 00 00       	call   802531 <_panic>
+
+00802049 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802049:	55                   	push   %ebp
+  80204a:	89 e5                	mov    %esp,%ebp
+  80204c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80204f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802052:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802057:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80205a:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  80205f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802062:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802067:	b8 09 00 00 00       	mov    $0x9,%eax
+  80206c:	e8 a5 fd ff ff       	call   801e16 <nsipc>
+}
+  802071:	c9                   	leave
+  802072:	c3                   	ret
+
+00802073 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802073:	55                   	push   %ebp
+  802074:	89 e5                	mov    %esp,%ebp
+  802076:	56                   	push   %esi
+  802077:	53                   	push   %ebx
+  802078:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80207b:	83 ec 0c             	sub    $0xc,%esp
+  80207e:	ff 75 08             	push   0x8(%ebp)
+  802081:	e8 00 e5 ff ff       	call   800586 <fd2data>
+  802086:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802088:	83 c4 08             	add    $0x8,%esp
+  80208b:	68 b3 38 80 00       	push   $0x8038b3
+  802090:	53                   	push   %ebx
+  802091:	e8 64 0b 00 00       	call   802bfa <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802096:	8b 46 04             	mov    0x4(%esi),%eax
+  802099:	2b 06                	sub    (%esi),%eax
+  80209b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8020a1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020a8:	00 00 00 
+	stat->st_dev = &devpipe;
+  8020ab:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  8020b2:	40 80 00 
+	return 0;
+}
+  8020b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020bd:	5b                   	pop    %ebx
+  8020be:	5e                   	pop    %esi
+  8020bf:	5d                   	pop    %ebp
+  8020c0:	c3                   	ret
+
+008020c1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020c1:	55                   	push   %ebp
+  8020c2:	89 e5                	mov    %esp,%ebp
+  8020c4:	53                   	push   %ebx
+  8020c5:	83 ec 0c             	sub    $0xc,%esp
+  8020c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8020cb:	53                   	push   %ebx
+  8020cc:	6a 00                	push   $0x0
+  8020ce:	e8 2f e1 ff ff       	call   800202 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8020d3:	89 1c 24             	mov    %ebx,(%esp)
+  8020d6:	e8 ab e4 ff ff       	call   800586 <fd2data>
+  8020db:	83 c4 08             	add    $0x8,%esp
+  8020de:	50                   	push   %eax
+  8020df:	6a 00                	push   $0x0
+  8020e1:	e8 1c e1 ff ff       	call   800202 <sys_page_unmap>
+}
+  8020e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020e9:	c9                   	leave
+  8020ea:	c3                   	ret
+
+008020eb <_pipeisclosed>:
+{
+  8020eb:	55                   	push   %ebp
+  8020ec:	89 e5                	mov    %esp,%ebp
+  8020ee:	57                   	push   %edi
+  8020ef:	56                   	push   %esi
+  8020f0:	53                   	push   %ebx
+  8020f1:	83 ec 1c             	sub    $0x1c,%esp
+  8020f4:	89 c7                	mov    %eax,%edi
+  8020f6:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8020f8:	a1 00 50 80 00       	mov    0x805000,%eax
+  8020fd:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802100:	83 ec 0c             	sub    $0xc,%esp
+  802103:	57                   	push   %edi
+  802104:	e8 19 13 00 00       	call   803422 <pageref>
+  802109:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80210c:	89 34 24             	mov    %esi,(%esp)
+  80210f:	e8 0e 13 00 00       	call   803422 <pageref>
+		nn = thisenv->env_runs;
+  802114:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80211a:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80211d:	83 c4 10             	add    $0x10,%esp
+  802120:	39 cb                	cmp    %ecx,%ebx
+  802122:	74 1b                	je     80213f <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802124:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802127:	75 cf                	jne    8020f8 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802129:	8b 42 58             	mov    0x58(%edx),%eax
+  80212c:	6a 01                	push   $0x1
+  80212e:	50                   	push   %eax
+  80212f:	53                   	push   %ebx
+  802130:	68 ba 38 80 00       	push   $0x8038ba
+  802135:	e8 d2 04 00 00       	call   80260c <cprintf>
+  80213a:	83 c4 10             	add    $0x10,%esp
+  80213d:	eb b9                	jmp    8020f8 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80213f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802142:	0f 94 c0             	sete   %al
+  802145:	0f b6 c0             	movzbl %al,%eax
+}
+  802148:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80214b:	5b                   	pop    %ebx
+  80214c:	5e                   	pop    %esi
+  80214d:	5f                   	pop    %edi
+  80214e:	5d                   	pop    %ebp
+  80214f:	c3                   	ret
+
+00802150 <devpipe_write>:
+{
+  802150:	55                   	push   %ebp
+  802151:	89 e5                	mov    %esp,%ebp
+  802153:	57                   	push   %edi
+  802154:	56                   	push   %esi
+  802155:	53                   	push   %ebx
+  802156:	83 ec 28             	sub    $0x28,%esp
+  802159:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80215c:	56                   	push   %esi
+  80215d:	e8 24 e4 ff ff       	call   800586 <fd2data>
+  802162:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802164:	83 c4 10             	add    $0x10,%esp
+  802167:	bf 00 00 00 00       	mov    $0x0,%edi
+  80216c:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80216f:	75 09                	jne    80217a <devpipe_write+0x2a>
+	return i;
+  802171:	89 f8                	mov    %edi,%eax
+  802173:	eb 23                	jmp    802198 <devpipe_write+0x48>
+			sys_yield();
+  802175:	e8 dc df ff ff       	call   800156 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80217a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80217d:	8b 0b                	mov    (%ebx),%ecx
+  80217f:	8d 51 20             	lea    0x20(%ecx),%edx
+  802182:	39 d0                	cmp    %edx,%eax
+  802184:	72 1a                	jb     8021a0 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802186:	89 da                	mov    %ebx,%edx
+  802188:	89 f0                	mov    %esi,%eax
+  80218a:	e8 5c ff ff ff       	call   8020eb <_pipeisclosed>
+  80218f:	85 c0                	test   %eax,%eax
+  802191:	74 e2                	je     802175 <devpipe_write+0x25>
+				return 0;
+  802193:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802198:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80219b:	5b                   	pop    %ebx
+  80219c:	5e                   	pop    %esi
+  80219d:	5f                   	pop    %edi
+  80219e:	5d                   	pop    %ebp
+  80219f:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021a3:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8021a7:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8021aa:	89 c2                	mov    %eax,%edx
+  8021ac:	c1 fa 1f             	sar    $0x1f,%edx
+  8021af:	89 d1                	mov    %edx,%ecx
+  8021b1:	c1 e9 1b             	shr    $0x1b,%ecx
+  8021b4:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8021b7:	83 e2 1f             	and    $0x1f,%edx
+  8021ba:	29 ca                	sub    %ecx,%edx
+  8021bc:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8021c0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8021c4:	83 c0 01             	add    $0x1,%eax
+  8021c7:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8021ca:	83 c7 01             	add    $0x1,%edi
+  8021cd:	eb 9d                	jmp    80216c <devpipe_write+0x1c>
+
+008021cf <devpipe_read>:
+{
+  8021cf:	55                   	push   %ebp
+  8021d0:	89 e5                	mov    %esp,%ebp
+  8021d2:	57                   	push   %edi
+  8021d3:	56                   	push   %esi
+  8021d4:	53                   	push   %ebx
+  8021d5:	83 ec 18             	sub    $0x18,%esp
+  8021d8:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8021db:	57                   	push   %edi
+  8021dc:	e8 a5 e3 ff ff       	call   800586 <fd2data>
+  8021e1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8021e3:	83 c4 10             	add    $0x10,%esp
+  8021e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021eb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021ee:	75 13                	jne    802203 <devpipe_read+0x34>
+	return i;
+  8021f0:	89 f0                	mov    %esi,%eax
+  8021f2:	eb 02                	jmp    8021f6 <devpipe_read+0x27>
+				return i;
+  8021f4:	89 f0                	mov    %esi,%eax
+}
+  8021f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021f9:	5b                   	pop    %ebx
+  8021fa:	5e                   	pop    %esi
+  8021fb:	5f                   	pop    %edi
+  8021fc:	5d                   	pop    %ebp
+  8021fd:	c3                   	ret
+			sys_yield();
+  8021fe:	e8 53 df ff ff       	call   800156 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802203:	8b 03                	mov    (%ebx),%eax
+  802205:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802208:	75 18                	jne    802222 <devpipe_read+0x53>
+			if (i > 0)
+  80220a:	85 f6                	test   %esi,%esi
+  80220c:	75 e6                	jne    8021f4 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80220e:	89 da                	mov    %ebx,%edx
+  802210:	89 f8                	mov    %edi,%eax
+  802212:	e8 d4 fe ff ff       	call   8020eb <_pipeisclosed>
+  802217:	85 c0                	test   %eax,%eax
+  802219:	74 e3                	je     8021fe <devpipe_read+0x2f>
+				return 0;
+  80221b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802220:	eb d4                	jmp    8021f6 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802222:	99                   	cltd
+  802223:	c1 ea 1b             	shr    $0x1b,%edx
+  802226:	01 d0                	add    %edx,%eax
+  802228:	83 e0 1f             	and    $0x1f,%eax
+  80222b:	29 d0                	sub    %edx,%eax
+  80222d:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802232:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802235:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802238:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80223b:	83 c6 01             	add    $0x1,%esi
+  80223e:	eb ab                	jmp    8021eb <devpipe_read+0x1c>
+
+00802240 <pipe>:
+{
+  802240:	55                   	push   %ebp
+  802241:	89 e5                	mov    %esp,%ebp
+  802243:	56                   	push   %esi
+  802244:	53                   	push   %ebx
+  802245:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802248:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80224b:	50                   	push   %eax
+  80224c:	e8 4c e3 ff ff       	call   80059d <fd_alloc>
+  802251:	89 c3                	mov    %eax,%ebx
+  802253:	83 c4 10             	add    $0x10,%esp
+  802256:	85 c0                	test   %eax,%eax
+  802258:	0f 88 23 01 00 00    	js     802381 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80225e:	83 ec 04             	sub    $0x4,%esp
+  802261:	68 07 04 00 00       	push   $0x407
+  802266:	ff 75 f4             	push   -0xc(%ebp)
+  802269:	6a 00                	push   $0x0
+  80226b:	e8 05 df ff ff       	call   800175 <sys_page_alloc>
+  802270:	89 c3                	mov    %eax,%ebx
+  802272:	83 c4 10             	add    $0x10,%esp
+  802275:	85 c0                	test   %eax,%eax
+  802277:	0f 88 04 01 00 00    	js     802381 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80227d:	83 ec 0c             	sub    $0xc,%esp
+  802280:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802283:	50                   	push   %eax
+  802284:	e8 14 e3 ff ff       	call   80059d <fd_alloc>
+  802289:	89 c3                	mov    %eax,%ebx
+  80228b:	83 c4 10             	add    $0x10,%esp
+  80228e:	85 c0                	test   %eax,%eax
+  802290:	0f 88 db 00 00 00    	js     802371 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802296:	83 ec 04             	sub    $0x4,%esp
+  802299:	68 07 04 00 00       	push   $0x407
+  80229e:	ff 75 f0             	push   -0x10(%ebp)
+  8022a1:	6a 00                	push   $0x0
+  8022a3:	e8 cd de ff ff       	call   800175 <sys_page_alloc>
+  8022a8:	89 c3                	mov    %eax,%ebx
+  8022aa:	83 c4 10             	add    $0x10,%esp
+  8022ad:	85 c0                	test   %eax,%eax
+  8022af:	0f 88 bc 00 00 00    	js     802371 <pipe+0x131>
+	va = fd2data(fd0);
+  8022b5:	83 ec 0c             	sub    $0xc,%esp
+  8022b8:	ff 75 f4             	push   -0xc(%ebp)
+  8022bb:	e8 c6 e2 ff ff       	call   800586 <fd2data>
+  8022c0:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022c2:	83 c4 0c             	add    $0xc,%esp
+  8022c5:	68 07 04 00 00       	push   $0x407
+  8022ca:	50                   	push   %eax
+  8022cb:	6a 00                	push   $0x0
+  8022cd:	e8 a3 de ff ff       	call   800175 <sys_page_alloc>
+  8022d2:	89 c3                	mov    %eax,%ebx
+  8022d4:	83 c4 10             	add    $0x10,%esp
+  8022d7:	85 c0                	test   %eax,%eax
+  8022d9:	0f 88 82 00 00 00    	js     802361 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8022df:	83 ec 0c             	sub    $0xc,%esp
+  8022e2:	ff 75 f0             	push   -0x10(%ebp)
+  8022e5:	e8 9c e2 ff ff       	call   800586 <fd2data>
+  8022ea:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8022f1:	50                   	push   %eax
+  8022f2:	6a 00                	push   $0x0
+  8022f4:	56                   	push   %esi
+  8022f5:	6a 00                	push   $0x0
+  8022f7:	e8 c4 de ff ff       	call   8001c0 <sys_page_map>
+  8022fc:	89 c3                	mov    %eax,%ebx
+  8022fe:	83 c4 20             	add    $0x20,%esp
+  802301:	85 c0                	test   %eax,%eax
+  802303:	78 4e                	js     802353 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802305:	a1 60 40 80 00       	mov    0x804060,%eax
+  80230a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80230d:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80230f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802312:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802319:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80231c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80231e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802321:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802328:	83 ec 0c             	sub    $0xc,%esp
+  80232b:	ff 75 f4             	push   -0xc(%ebp)
+  80232e:	e8 43 e2 ff ff       	call   800576 <fd2num>
+  802333:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802336:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802338:	83 c4 04             	add    $0x4,%esp
+  80233b:	ff 75 f0             	push   -0x10(%ebp)
+  80233e:	e8 33 e2 ff ff       	call   800576 <fd2num>
+  802343:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802346:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802349:	83 c4 10             	add    $0x10,%esp
+  80234c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802351:	eb 2e                	jmp    802381 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802353:	83 ec 08             	sub    $0x8,%esp
+  802356:	56                   	push   %esi
+  802357:	6a 00                	push   $0x0
+  802359:	e8 a4 de ff ff       	call   800202 <sys_page_unmap>
+  80235e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802361:	83 ec 08             	sub    $0x8,%esp
+  802364:	ff 75 f0             	push   -0x10(%ebp)
+  802367:	6a 00                	push   $0x0
+  802369:	e8 94 de ff ff       	call   800202 <sys_page_unmap>
+  80236e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802371:	83 ec 08             	sub    $0x8,%esp
+  802374:	ff 75 f4             	push   -0xc(%ebp)
+  802377:	6a 00                	push   $0x0
+  802379:	e8 84 de ff ff       	call   800202 <sys_page_unmap>
+  80237e:	83 c4 10             	add    $0x10,%esp
+}
+  802381:	89 d8                	mov    %ebx,%eax
+  802383:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802386:	5b                   	pop    %ebx
+  802387:	5e                   	pop    %esi
+  802388:	5d                   	pop    %ebp
+  802389:	c3                   	ret
+
+0080238a <pipeisclosed>:
+{
+  80238a:	55                   	push   %ebp
+  80238b:	89 e5                	mov    %esp,%ebp
+  80238d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802390:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802393:	50                   	push   %eax
+  802394:	ff 75 08             	push   0x8(%ebp)
+  802397:	e8 57 e2 ff ff       	call   8005f3 <fd_lookup>
+  80239c:	83 c4 10             	add    $0x10,%esp
+  80239f:	85 c0                	test   %eax,%eax
+  8023a1:	78 18                	js     8023bb <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8023a3:	83 ec 0c             	sub    $0xc,%esp
+  8023a6:	ff 75 f4             	push   -0xc(%ebp)
+  8023a9:	e8 d8 e1 ff ff       	call   800586 <fd2data>
+  8023ae:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8023b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b3:	e8 33 fd ff ff       	call   8020eb <_pipeisclosed>
+  8023b8:	83 c4 10             	add    $0x10,%esp
+}
+  8023bb:	c9                   	leave
+  8023bc:	c3                   	ret
+
+008023bd <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8023bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c2:	c3                   	ret
+
+008023c3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023c3:	55                   	push   %ebp
+  8023c4:	89 e5                	mov    %esp,%ebp
+  8023c6:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8023c9:	68 d2 38 80 00       	push   $0x8038d2
+  8023ce:	ff 75 0c             	push   0xc(%ebp)
+  8023d1:	e8 24 08 00 00       	call   802bfa <strcpy>
+	return 0;
+}
+  8023d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023db:	c9                   	leave
+  8023dc:	c3                   	ret
+
+008023dd <devcons_write>:
+{
+  8023dd:	55                   	push   %ebp
+  8023de:	89 e5                	mov    %esp,%ebp
+  8023e0:	57                   	push   %edi
+  8023e1:	56                   	push   %esi
+  8023e2:	53                   	push   %ebx
+  8023e3:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8023e9:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8023ee:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8023f4:	eb 2e                	jmp    802424 <devcons_write+0x47>
+		m = n - tot;
+  8023f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8023f9:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8023fb:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802400:	39 c3                	cmp    %eax,%ebx
+  802402:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802405:	83 ec 04             	sub    $0x4,%esp
+  802408:	53                   	push   %ebx
+  802409:	89 f0                	mov    %esi,%eax
+  80240b:	03 45 0c             	add    0xc(%ebp),%eax
+  80240e:	50                   	push   %eax
+  80240f:	57                   	push   %edi
+  802410:	e8 6b 09 00 00       	call   802d80 <memmove>
+		sys_cputs(buf, m);
+  802415:	83 c4 08             	add    $0x8,%esp
+  802418:	53                   	push   %ebx
+  802419:	57                   	push   %edi
+  80241a:	e8 7a dc ff ff       	call   800099 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80241f:	01 de                	add    %ebx,%esi
+  802421:	83 c4 10             	add    $0x10,%esp
+  802424:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802427:	72 cd                	jb     8023f6 <devcons_write+0x19>
+}
+  802429:	89 f0                	mov    %esi,%eax
+  80242b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80242e:	5b                   	pop    %ebx
+  80242f:	5e                   	pop    %esi
+  802430:	5f                   	pop    %edi
+  802431:	5d                   	pop    %ebp
+  802432:	c3                   	ret
+
+00802433 <devcons_read>:
+{
+  802433:	55                   	push   %ebp
+  802434:	89 e5                	mov    %esp,%ebp
+  802436:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80243e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802442:	75 07                	jne    80244b <devcons_read+0x18>
+  802444:	eb 1f                	jmp    802465 <devcons_read+0x32>
+		sys_yield();
+  802446:	e8 0b dd ff ff       	call   800156 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80244b:	e8 6f dc ff ff       	call   8000bf <sys_cgetc>
+  802450:	85 c0                	test   %eax,%eax
+  802452:	74 f2                	je     802446 <devcons_read+0x13>
+	if (c < 0)
+  802454:	78 0f                	js     802465 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802456:	83 f8 04             	cmp    $0x4,%eax
+  802459:	74 0c                	je     802467 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80245b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80245e:	88 02                	mov    %al,(%edx)
+	return 1;
+  802460:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802465:	c9                   	leave
+  802466:	c3                   	ret
+		return 0;
+  802467:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246c:	eb f7                	jmp    802465 <devcons_read+0x32>
+
+0080246e <cputchar>:
+{
+  80246e:	55                   	push   %ebp
+  80246f:	89 e5                	mov    %esp,%ebp
+  802471:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802474:	8b 45 08             	mov    0x8(%ebp),%eax
+  802477:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80247a:	6a 01                	push   $0x1
+  80247c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80247f:	50                   	push   %eax
+  802480:	e8 14 dc ff ff       	call   800099 <sys_cputs>
+}
+  802485:	83 c4 10             	add    $0x10,%esp
+  802488:	c9                   	leave
+  802489:	c3                   	ret
+
+0080248a <getchar>:
+{
+  80248a:	55                   	push   %ebp
+  80248b:	89 e5                	mov    %esp,%ebp
+  80248d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802490:	6a 01                	push   $0x1
+  802492:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802495:	50                   	push   %eax
+  802496:	6a 00                	push   $0x0
+  802498:	e8 bc e3 ff ff       	call   800859 <read>
+	if (r < 0)
+  80249d:	83 c4 10             	add    $0x10,%esp
+  8024a0:	85 c0                	test   %eax,%eax
+  8024a2:	78 06                	js     8024aa <getchar+0x20>
+	if (r < 1)
+  8024a4:	74 06                	je     8024ac <getchar+0x22>
+	return c;
+  8024a6:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8024aa:	c9                   	leave
+  8024ab:	c3                   	ret
+		return -E_EOF;
+  8024ac:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8024b1:	eb f7                	jmp    8024aa <getchar+0x20>
+
+008024b3 <iscons>:
+{
+  8024b3:	55                   	push   %ebp
+  8024b4:	89 e5                	mov    %esp,%ebp
+  8024b6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024bc:	50                   	push   %eax
+  8024bd:	ff 75 08             	push   0x8(%ebp)
+  8024c0:	e8 2e e1 ff ff       	call   8005f3 <fd_lookup>
+  8024c5:	83 c4 10             	add    $0x10,%esp
+  8024c8:	85 c0                	test   %eax,%eax
+  8024ca:	78 11                	js     8024dd <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8024cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024cf:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8024d5:	39 10                	cmp    %edx,(%eax)
+  8024d7:	0f 94 c0             	sete   %al
+  8024da:	0f b6 c0             	movzbl %al,%eax
+}
+  8024dd:	c9                   	leave
+  8024de:	c3                   	ret
+
+008024df <opencons>:
+{
+  8024df:	55                   	push   %ebp
+  8024e0:	89 e5                	mov    %esp,%ebp
+  8024e2:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8024e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024e8:	50                   	push   %eax
+  8024e9:	e8 af e0 ff ff       	call   80059d <fd_alloc>
+  8024ee:	83 c4 10             	add    $0x10,%esp
+  8024f1:	85 c0                	test   %eax,%eax
+  8024f3:	78 3a                	js     80252f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8024f5:	83 ec 04             	sub    $0x4,%esp
+  8024f8:	68 07 04 00 00       	push   $0x407
+  8024fd:	ff 75 f4             	push   -0xc(%ebp)
+  802500:	6a 00                	push   $0x0
+  802502:	e8 6e dc ff ff       	call   800175 <sys_page_alloc>
+  802507:	83 c4 10             	add    $0x10,%esp
+  80250a:	85 c0                	test   %eax,%eax
+  80250c:	78 21                	js     80252f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80250e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802511:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802517:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802519:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80251c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802523:	83 ec 0c             	sub    $0xc,%esp
+  802526:	50                   	push   %eax
+  802527:	e8 4a e0 ff ff       	call   800576 <fd2num>
+  80252c:	83 c4 10             	add    $0x10,%esp
+}
+  80252f:	c9                   	leave
+  802530:	c3                   	ret
+
+00802531 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802531:	55                   	push   %ebp
+  802532:	89 e5                	mov    %esp,%ebp
+  802534:	56                   	push   %esi
+  802535:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802536:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802539:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80253f:	e8 eb db ff ff       	call   80012f <sys_getenvid>
+  802544:	83 ec 0c             	sub    $0xc,%esp
+  802547:	ff 75 0c             	push   0xc(%ebp)
+  80254a:	ff 75 08             	push   0x8(%ebp)
+  80254d:	56                   	push   %esi
+  80254e:	50                   	push   %eax
+  80254f:	68 e0 38 80 00       	push   $0x8038e0
+  802554:	e8 b3 00 00 00       	call   80260c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802559:	83 c4 18             	add    $0x18,%esp
+  80255c:	53                   	push   %ebx
+  80255d:	ff 75 10             	push   0x10(%ebp)
+  802560:	e8 56 00 00 00       	call   8025bb <vcprintf>
+	cprintf("\n");
+  802565:	c7 04 24 cb 38 80 00 	movl   $0x8038cb,(%esp)
+  80256c:	e8 9b 00 00 00       	call   80260c <cprintf>
+  802571:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802574:	cc                   	int3
+	while (1)
+  802575:	eb fd                	jmp    802574 <_panic+0x43>
+
+00802577 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  802577:	55                   	push   %ebp
+  802578:	89 e5                	mov    %esp,%ebp
+  80257a:	53                   	push   %ebx
+  80257b:	83 ec 04             	sub    $0x4,%esp
+  80257e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802581:	8b 13                	mov    (%ebx),%edx
+  802583:	8d 42 01             	lea    0x1(%edx),%eax
+  802586:	89 03                	mov    %eax,(%ebx)
+  802588:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80258b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80258f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802594:	74 09                	je     80259f <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  802596:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80259a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80259d:	c9                   	leave
+  80259e:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80259f:	83 ec 08             	sub    $0x8,%esp
+  8025a2:	68 ff 00 00 00       	push   $0xff
+  8025a7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8025aa:	50                   	push   %eax
+  8025ab:	e8 e9 da ff ff       	call   800099 <sys_cputs>
+		b->idx = 0;
+  8025b0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8025b6:	83 c4 10             	add    $0x10,%esp
+  8025b9:	eb db                	jmp    802596 <putch+0x1f>
+
+008025bb <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8025bb:	55                   	push   %ebp
+  8025bc:	89 e5                	mov    %esp,%ebp
+  8025be:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8025c4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8025cb:	00 00 00 
+	b.cnt = 0;
+  8025ce:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8025d5:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8025d8:	ff 75 0c             	push   0xc(%ebp)
+  8025db:	ff 75 08             	push   0x8(%ebp)
+  8025de:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8025e4:	50                   	push   %eax
+  8025e5:	68 77 25 80 00       	push   $0x802577
+  8025ea:	e8 14 01 00 00       	call   802703 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8025ef:	83 c4 08             	add    $0x8,%esp
+  8025f2:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8025f8:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8025fe:	50                   	push   %eax
+  8025ff:	e8 95 da ff ff       	call   800099 <sys_cputs>
+
+	return b.cnt;
+}
+  802604:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80260a:	c9                   	leave
+  80260b:	c3                   	ret
+
+0080260c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80260c:	55                   	push   %ebp
+  80260d:	89 e5                	mov    %esp,%ebp
+  80260f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802612:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802615:	50                   	push   %eax
+  802616:	ff 75 08             	push   0x8(%ebp)
+  802619:	e8 9d ff ff ff       	call   8025bb <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80261e:	c9                   	leave
+  80261f:	c3                   	ret
+
+00802620 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802620:	55                   	push   %ebp
+  802621:	89 e5                	mov    %esp,%ebp
+  802623:	57                   	push   %edi
+  802624:	56                   	push   %esi
+  802625:	53                   	push   %ebx
+  802626:	83 ec 1c             	sub    $0x1c,%esp
+  802629:	89 c7                	mov    %eax,%edi
+  80262b:	89 d6                	mov    %edx,%esi
+  80262d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802630:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802633:	89 d1                	mov    %edx,%ecx
+  802635:	89 c2                	mov    %eax,%edx
+  802637:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80263a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80263d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802640:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802643:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802646:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80264d:	39 c2                	cmp    %eax,%edx
+  80264f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802652:	72 3e                	jb     802692 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802654:	83 ec 0c             	sub    $0xc,%esp
+  802657:	ff 75 18             	push   0x18(%ebp)
+  80265a:	83 eb 01             	sub    $0x1,%ebx
+  80265d:	53                   	push   %ebx
+  80265e:	50                   	push   %eax
+  80265f:	83 ec 08             	sub    $0x8,%esp
+  802662:	ff 75 e4             	push   -0x1c(%ebp)
+  802665:	ff 75 e0             	push   -0x20(%ebp)
+  802668:	ff 75 dc             	push   -0x24(%ebp)
+  80266b:	ff 75 d8             	push   -0x28(%ebp)
+  80266e:	e8 59 0f 00 00       	call   8035cc <__udivdi3>
+  802673:	83 c4 18             	add    $0x18,%esp
+  802676:	52                   	push   %edx
+  802677:	50                   	push   %eax
+  802678:	89 f2                	mov    %esi,%edx
+  80267a:	89 f8                	mov    %edi,%eax
+  80267c:	e8 9f ff ff ff       	call   802620 <printnum>
+  802681:	83 c4 20             	add    $0x20,%esp
+  802684:	eb 13                	jmp    802699 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  802686:	83 ec 08             	sub    $0x8,%esp
+  802689:	56                   	push   %esi
+  80268a:	ff 75 18             	push   0x18(%ebp)
+  80268d:	ff d7                	call   *%edi
+  80268f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  802692:	83 eb 01             	sub    $0x1,%ebx
+  802695:	85 db                	test   %ebx,%ebx
+  802697:	7f ed                	jg     802686 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  802699:	83 ec 08             	sub    $0x8,%esp
+  80269c:	56                   	push   %esi
+  80269d:	83 ec 04             	sub    $0x4,%esp
+  8026a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8026a3:	ff 75 e0             	push   -0x20(%ebp)
+  8026a6:	ff 75 dc             	push   -0x24(%ebp)
+  8026a9:	ff 75 d8             	push   -0x28(%ebp)
+  8026ac:	e8 39 0f 00 00       	call   8035ea <__umoddi3>
+  8026b1:	83 c4 14             	add    $0x14,%esp
+  8026b4:	0f be 80 03 39 80 00 	movsbl 0x803903(%eax),%eax
+  8026bb:	50                   	push   %eax
+  8026bc:	ff d7                	call   *%edi
+}
+  8026be:	83 c4 10             	add    $0x10,%esp
+  8026c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026c4:	5b                   	pop    %ebx
+  8026c5:	5e                   	pop    %esi
+  8026c6:	5f                   	pop    %edi
+  8026c7:	5d                   	pop    %ebp
+  8026c8:	c3                   	ret
+
+008026c9 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8026c9:	55                   	push   %ebp
+  8026ca:	89 e5                	mov    %esp,%ebp
+  8026cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8026cf:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8026d3:	8b 10                	mov    (%eax),%edx
+  8026d5:	3b 50 04             	cmp    0x4(%eax),%edx
+  8026d8:	73 0a                	jae    8026e4 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8026da:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8026dd:	89 08                	mov    %ecx,(%eax)
+  8026df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e2:	88 02                	mov    %al,(%edx)
+}
+  8026e4:	5d                   	pop    %ebp
+  8026e5:	c3                   	ret
+
+008026e6 <printfmt>:
+{
+  8026e6:	55                   	push   %ebp
+  8026e7:	89 e5                	mov    %esp,%ebp
+  8026e9:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8026ec:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8026ef:	50                   	push   %eax
+  8026f0:	ff 75 10             	push   0x10(%ebp)
+  8026f3:	ff 75 0c             	push   0xc(%ebp)
+  8026f6:	ff 75 08             	push   0x8(%ebp)
+  8026f9:	e8 05 00 00 00       	call   802703 <vprintfmt>
+}
+  8026fe:	83 c4 10             	add    $0x10,%esp
+  802701:	c9                   	leave
+  802702:	c3                   	ret
+
+00802703 <vprintfmt>:
+{
+  802703:	55                   	push   %ebp
+  802704:	89 e5                	mov    %esp,%ebp
+  802706:	57                   	push   %edi
+  802707:	56                   	push   %esi
+  802708:	53                   	push   %ebx
+  802709:	83 ec 2c             	sub    $0x2c,%esp
+  80270c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80270f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802712:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802715:	eb 0a                	jmp    802721 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  802717:	83 ec 08             	sub    $0x8,%esp
+  80271a:	53                   	push   %ebx
+  80271b:	50                   	push   %eax
+  80271c:	ff d6                	call   *%esi
+  80271e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802721:	83 c7 01             	add    $0x1,%edi
+  802724:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  802728:	83 f8 25             	cmp    $0x25,%eax
+  80272b:	74 0c                	je     802739 <vprintfmt+0x36>
+			if (ch == '\0')
+  80272d:	85 c0                	test   %eax,%eax
+  80272f:	75 e6                	jne    802717 <vprintfmt+0x14>
+}
+  802731:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802734:	5b                   	pop    %ebx
+  802735:	5e                   	pop    %esi
+  802736:	5f                   	pop    %edi
+  802737:	5d                   	pop    %ebp
+  802738:	c3                   	ret
+		padc = ' ';
+  802739:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80273d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802744:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80274b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  802752:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  802757:	8d 47 01             	lea    0x1(%edi),%eax
+  80275a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80275d:	0f b6 17             	movzbl (%edi),%edx
+  802760:	8d 42 dd             	lea    -0x23(%edx),%eax
+  802763:	3c 55                	cmp    $0x55,%al
+  802765:	0f 87 cf 03 00 00    	ja     802b3a <vprintfmt+0x437>
+  80276b:	0f b6 c0             	movzbl %al,%eax
+  80276e:	ff 24 85 60 3a 80 00 	jmp    *0x803a60(,%eax,4)
+  802775:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  802778:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80277c:	eb d9                	jmp    802757 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80277e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802781:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  802785:	eb d0                	jmp    802757 <vprintfmt+0x54>
+  802787:	0f b6 d2             	movzbl %dl,%edx
+  80278a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80278d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802792:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  802795:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  802798:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80279c:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80279f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8027a2:	83 f9 09             	cmp    $0x9,%ecx
+  8027a5:	77 55                	ja     8027fc <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8027a7:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8027aa:	eb e9                	jmp    802795 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8027ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027af:	8b 00                	mov    (%eax),%eax
+  8027b1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8027b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8027ba:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8027c0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8027c4:	79 91                	jns    802757 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8027c6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8027c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8027cc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8027d3:	eb 82                	jmp    802757 <vprintfmt+0x54>
+			if (width < 0)
+  8027d5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8027d8:	85 d2                	test   %edx,%edx
+  8027da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027df:	0f 49 c2             	cmovns %edx,%eax
+  8027e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8027e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8027e8:	e9 6a ff ff ff       	jmp    802757 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8027ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8027f0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8027f7:	e9 5b ff ff ff       	jmp    802757 <vprintfmt+0x54>
+  8027fc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8027ff:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802802:	eb bc                	jmp    8027c0 <vprintfmt+0xbd>
+			lflag++;
+  802804:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  802807:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80280a:	e9 48 ff ff ff       	jmp    802757 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80280f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802812:	8d 78 04             	lea    0x4(%eax),%edi
+  802815:	83 ec 08             	sub    $0x8,%esp
+  802818:	53                   	push   %ebx
+  802819:	ff 30                	push   (%eax)
+  80281b:	ff d6                	call   *%esi
+			break;
+  80281d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802820:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  802823:	e9 b1 02 00 00       	jmp    802ad9 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  802828:	8b 45 14             	mov    0x14(%ebp),%eax
+  80282b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80282e:	8b 10                	mov    (%eax),%edx
+  802830:	89 d0                	mov    %edx,%eax
+  802832:	f7 d8                	neg    %eax
+  802834:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802837:	83 f8 11             	cmp    $0x11,%eax
+  80283a:	7f 23                	jg     80285f <vprintfmt+0x15c>
+  80283c:	8b 14 85 c0 3b 80 00 	mov    0x803bc0(,%eax,4),%edx
+  802843:	85 d2                	test   %edx,%edx
+  802845:	74 18                	je     80285f <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  802847:	52                   	push   %edx
+  802848:	68 36 38 80 00       	push   $0x803836
+  80284d:	53                   	push   %ebx
+  80284e:	56                   	push   %esi
+  80284f:	e8 92 fe ff ff       	call   8026e6 <printfmt>
+  802854:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802857:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80285a:	e9 7a 02 00 00       	jmp    802ad9 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80285f:	50                   	push   %eax
+  802860:	68 1b 39 80 00       	push   $0x80391b
+  802865:	53                   	push   %ebx
+  802866:	56                   	push   %esi
+  802867:	e8 7a fe ff ff       	call   8026e6 <printfmt>
+  80286c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80286f:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802872:	e9 62 02 00 00       	jmp    802ad9 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802877:	8b 45 14             	mov    0x14(%ebp),%eax
+  80287a:	83 c0 04             	add    $0x4,%eax
+  80287d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  802880:	8b 45 14             	mov    0x14(%ebp),%eax
+  802883:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  802885:	85 c9                	test   %ecx,%ecx
+  802887:	b8 14 39 80 00       	mov    $0x803914,%eax
+  80288c:	0f 45 c1             	cmovne %ecx,%eax
+  80288f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  802892:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  802896:	7e 06                	jle    80289e <vprintfmt+0x19b>
+  802898:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80289c:	75 0b                	jne    8028a9 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80289e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8028a1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8028a4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028a7:	eb 5c                	jmp    802905 <vprintfmt+0x202>
+  8028a9:	83 ec 08             	sub    $0x8,%esp
+  8028ac:	ff 75 d0             	push   -0x30(%ebp)
+  8028af:	ff 75 cc             	push   -0x34(%ebp)
+  8028b2:	e8 20 03 00 00       	call   802bd7 <strnlen>
+  8028b7:	89 c2                	mov    %eax,%edx
+  8028b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028bc:	29 d0                	sub    %edx,%eax
+  8028be:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8028c1:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8028c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028c8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8028cb:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028cd:	eb 0e                	jmp    8028dd <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8028cf:	83 ec 08             	sub    $0x8,%esp
+  8028d2:	53                   	push   %ebx
+  8028d3:	57                   	push   %edi
+  8028d4:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8028d7:	83 ee 01             	sub    $0x1,%esi
+  8028da:	83 c4 10             	add    $0x10,%esp
+  8028dd:	85 f6                	test   %esi,%esi
+  8028df:	7f ee                	jg     8028cf <vprintfmt+0x1cc>
+  8028e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8028e7:	85 c0                	test   %eax,%eax
+  8028e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ee:	0f 49 d0             	cmovns %eax,%edx
+  8028f1:	29 d0                	sub    %edx,%eax
+  8028f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028f6:	eb a6                	jmp    80289e <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8028f8:	83 ec 08             	sub    $0x8,%esp
+  8028fb:	53                   	push   %ebx
+  8028fc:	52                   	push   %edx
+  8028fd:	ff 55 08             	call   *0x8(%ebp)
+  802900:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802903:	89 f1                	mov    %esi,%ecx
+  802905:	8d 71 01             	lea    0x1(%ecx),%esi
+  802908:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80290c:	0f be d0             	movsbl %al,%edx
+  80290f:	85 d2                	test   %edx,%edx
+  802911:	74 28                	je     80293b <vprintfmt+0x238>
+  802913:	85 ff                	test   %edi,%edi
+  802915:	78 05                	js     80291c <vprintfmt+0x219>
+  802917:	83 ef 01             	sub    $0x1,%edi
+  80291a:	78 30                	js     80294c <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80291c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802920:	74 d6                	je     8028f8 <vprintfmt+0x1f5>
+  802922:	0f be c0             	movsbl %al,%eax
+  802925:	83 e8 20             	sub    $0x20,%eax
+  802928:	83 f8 5e             	cmp    $0x5e,%eax
+  80292b:	76 cb                	jbe    8028f8 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80292d:	83 ec 08             	sub    $0x8,%esp
+  802930:	53                   	push   %ebx
+  802931:	6a 3f                	push   $0x3f
+  802933:	ff 55 08             	call   *0x8(%ebp)
+  802936:	83 c4 10             	add    $0x10,%esp
+  802939:	eb c8                	jmp    802903 <vprintfmt+0x200>
+  80293b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80293e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802941:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802944:	01 d0                	add    %edx,%eax
+  802946:	29 c8                	sub    %ecx,%eax
+  802948:	89 c7                	mov    %eax,%edi
+  80294a:	eb 13                	jmp    80295f <vprintfmt+0x25c>
+  80294c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80294f:	eb ed                	jmp    80293e <vprintfmt+0x23b>
+				putch(' ', putdat);
+  802951:	83 ec 08             	sub    $0x8,%esp
+  802954:	53                   	push   %ebx
+  802955:	6a 20                	push   $0x20
+  802957:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  802959:	83 ef 01             	sub    $0x1,%edi
+  80295c:	83 c4 10             	add    $0x10,%esp
+  80295f:	85 ff                	test   %edi,%edi
+  802961:	7f ee                	jg     802951 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802963:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  802966:	89 45 14             	mov    %eax,0x14(%ebp)
+  802969:	e9 6b 01 00 00       	jmp    802ad9 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80296e:	83 f9 01             	cmp    $0x1,%ecx
+  802971:	7f 1f                	jg     802992 <vprintfmt+0x28f>
+	else if (lflag)
+  802973:	85 c9                	test   %ecx,%ecx
+  802975:	74 67                	je     8029de <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  802977:	8b 45 14             	mov    0x14(%ebp),%eax
+  80297a:	8b 00                	mov    (%eax),%eax
+  80297c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80297f:	89 c1                	mov    %eax,%ecx
+  802981:	c1 f9 1f             	sar    $0x1f,%ecx
+  802984:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802987:	8b 45 14             	mov    0x14(%ebp),%eax
+  80298a:	8d 40 04             	lea    0x4(%eax),%eax
+  80298d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802990:	eb 17                	jmp    8029a9 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  802992:	8b 45 14             	mov    0x14(%ebp),%eax
+  802995:	8b 50 04             	mov    0x4(%eax),%edx
+  802998:	8b 00                	mov    (%eax),%eax
+  80299a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80299d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8029a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029a3:	8d 40 08             	lea    0x8(%eax),%eax
+  8029a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8029a9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029ac:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8029af:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8029b4:	85 c9                	test   %ecx,%ecx
+  8029b6:	0f 89 03 01 00 00    	jns    802abf <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8029bc:	83 ec 08             	sub    $0x8,%esp
+  8029bf:	53                   	push   %ebx
+  8029c0:	6a 2d                	push   $0x2d
+  8029c2:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8029c4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8029c7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8029ca:	f7 da                	neg    %edx
+  8029cc:	83 d1 00             	adc    $0x0,%ecx
+  8029cf:	f7 d9                	neg    %ecx
+  8029d1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8029d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029d9:	e9 e1 00 00 00       	jmp    802abf <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8029de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029e1:	8b 00                	mov    (%eax),%eax
+  8029e3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8029e6:	89 c1                	mov    %eax,%ecx
+  8029e8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8029eb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8029ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8029f4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8029f7:	eb b0                	jmp    8029a9 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8029f9:	83 f9 01             	cmp    $0x1,%ecx
+  8029fc:	7f 1e                	jg     802a1c <vprintfmt+0x319>
+	else if (lflag)
+  8029fe:	85 c9                	test   %ecx,%ecx
+  802a00:	74 32                	je     802a34 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  802a02:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a05:	8b 10                	mov    (%eax),%edx
+  802a07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a0c:	8d 40 04             	lea    0x4(%eax),%eax
+  802a0f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a12:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  802a17:	e9 a3 00 00 00       	jmp    802abf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a1c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a1f:	8b 10                	mov    (%eax),%edx
+  802a21:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a24:	8d 40 08             	lea    0x8(%eax),%eax
+  802a27:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a2a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  802a2f:	e9 8b 00 00 00       	jmp    802abf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a34:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a37:	8b 10                	mov    (%eax),%edx
+  802a39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a3e:	8d 40 04             	lea    0x4(%eax),%eax
+  802a41:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802a44:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  802a49:	eb 74                	jmp    802abf <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  802a4b:	83 f9 01             	cmp    $0x1,%ecx
+  802a4e:	7f 1b                	jg     802a6b <vprintfmt+0x368>
+	else if (lflag)
+  802a50:	85 c9                	test   %ecx,%ecx
+  802a52:	74 2c                	je     802a80 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  802a54:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a57:	8b 10                	mov    (%eax),%edx
+  802a59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a5e:	8d 40 04             	lea    0x4(%eax),%eax
+  802a61:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a64:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  802a69:	eb 54                	jmp    802abf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802a6b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a6e:	8b 10                	mov    (%eax),%edx
+  802a70:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a73:	8d 40 08             	lea    0x8(%eax),%eax
+  802a76:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a79:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  802a7e:	eb 3f                	jmp    802abf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802a80:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a83:	8b 10                	mov    (%eax),%edx
+  802a85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a8a:	8d 40 04             	lea    0x4(%eax),%eax
+  802a8d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802a90:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  802a95:	eb 28                	jmp    802abf <vprintfmt+0x3bc>
+			putch('0', putdat);
+  802a97:	83 ec 08             	sub    $0x8,%esp
+  802a9a:	53                   	push   %ebx
+  802a9b:	6a 30                	push   $0x30
+  802a9d:	ff d6                	call   *%esi
+			putch('x', putdat);
+  802a9f:	83 c4 08             	add    $0x8,%esp
+  802aa2:	53                   	push   %ebx
+  802aa3:	6a 78                	push   $0x78
+  802aa5:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  802aa7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802aaa:	8b 10                	mov    (%eax),%edx
+  802aac:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802ab1:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802ab4:	8d 40 04             	lea    0x4(%eax),%eax
+  802ab7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802aba:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  802abf:	83 ec 0c             	sub    $0xc,%esp
+  802ac2:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802ac6:	50                   	push   %eax
+  802ac7:	ff 75 e0             	push   -0x20(%ebp)
+  802aca:	57                   	push   %edi
+  802acb:	51                   	push   %ecx
+  802acc:	52                   	push   %edx
+  802acd:	89 da                	mov    %ebx,%edx
+  802acf:	89 f0                	mov    %esi,%eax
+  802ad1:	e8 4a fb ff ff       	call   802620 <printnum>
+			break;
+  802ad6:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  802ad9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802adc:	e9 40 fc ff ff       	jmp    802721 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  802ae1:	83 f9 01             	cmp    $0x1,%ecx
+  802ae4:	7f 1b                	jg     802b01 <vprintfmt+0x3fe>
+	else if (lflag)
+  802ae6:	85 c9                	test   %ecx,%ecx
+  802ae8:	74 2c                	je     802b16 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  802aea:	8b 45 14             	mov    0x14(%ebp),%eax
+  802aed:	8b 10                	mov    (%eax),%edx
+  802aef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802af4:	8d 40 04             	lea    0x4(%eax),%eax
+  802af7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802afa:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  802aff:	eb be                	jmp    802abf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  802b01:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b04:	8b 10                	mov    (%eax),%edx
+  802b06:	8b 48 04             	mov    0x4(%eax),%ecx
+  802b09:	8d 40 08             	lea    0x8(%eax),%eax
+  802b0c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b0f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  802b14:	eb a9                	jmp    802abf <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  802b16:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b19:	8b 10                	mov    (%eax),%edx
+  802b1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b20:	8d 40 04             	lea    0x4(%eax),%eax
+  802b23:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802b26:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  802b2b:	eb 92                	jmp    802abf <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  802b2d:	83 ec 08             	sub    $0x8,%esp
+  802b30:	53                   	push   %ebx
+  802b31:	6a 25                	push   $0x25
+  802b33:	ff d6                	call   *%esi
+			break;
+  802b35:	83 c4 10             	add    $0x10,%esp
+  802b38:	eb 9f                	jmp    802ad9 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  802b3a:	83 ec 08             	sub    $0x8,%esp
+  802b3d:	53                   	push   %ebx
+  802b3e:	6a 25                	push   $0x25
+  802b40:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802b42:	83 c4 10             	add    $0x10,%esp
+  802b45:	89 f8                	mov    %edi,%eax
+  802b47:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802b4b:	74 05                	je     802b52 <vprintfmt+0x44f>
+  802b4d:	83 e8 01             	sub    $0x1,%eax
+  802b50:	eb f5                	jmp    802b47 <vprintfmt+0x444>
+  802b52:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b55:	eb 82                	jmp    802ad9 <vprintfmt+0x3d6>
+
+00802b57 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802b57:	55                   	push   %ebp
+  802b58:	89 e5                	mov    %esp,%ebp
+  802b5a:	83 ec 18             	sub    $0x18,%esp
+  802b5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b60:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  802b63:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802b66:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802b6a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802b6d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802b74:	85 c0                	test   %eax,%eax
+  802b76:	74 26                	je     802b9e <vsnprintf+0x47>
+  802b78:	85 d2                	test   %edx,%edx
+  802b7a:	7e 22                	jle    802b9e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  802b7c:	ff 75 14             	push   0x14(%ebp)
+  802b7f:	ff 75 10             	push   0x10(%ebp)
+  802b82:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802b85:	50                   	push   %eax
+  802b86:	68 c9 26 80 00       	push   $0x8026c9
+  802b8b:	e8 73 fb ff ff       	call   802703 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  802b90:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802b93:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802b96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b99:	83 c4 10             	add    $0x10,%esp
+}
+  802b9c:	c9                   	leave
+  802b9d:	c3                   	ret
+		return -E_INVAL;
+  802b9e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ba3:	eb f7                	jmp    802b9c <vsnprintf+0x45>
+
+00802ba5 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802ba5:	55                   	push   %ebp
+  802ba6:	89 e5                	mov    %esp,%ebp
+  802ba8:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  802bab:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  802bae:	50                   	push   %eax
+  802baf:	ff 75 10             	push   0x10(%ebp)
+  802bb2:	ff 75 0c             	push   0xc(%ebp)
+  802bb5:	ff 75 08             	push   0x8(%ebp)
+  802bb8:	e8 9a ff ff ff       	call   802b57 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  802bbd:	c9                   	leave
+  802bbe:	c3                   	ret
+
+00802bbf <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802bbf:	55                   	push   %ebp
+  802bc0:	89 e5                	mov    %esp,%ebp
+  802bc2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bca:	eb 03                	jmp    802bcf <strlen+0x10>
+		n++;
+  802bcc:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  802bcf:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802bd3:	75 f7                	jne    802bcc <strlen+0xd>
+	return n;
+}
+  802bd5:	5d                   	pop    %ebp
+  802bd6:	c3                   	ret
+
+00802bd7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802bd7:	55                   	push   %ebp
+  802bd8:	89 e5                	mov    %esp,%ebp
+  802bda:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802bdd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802be0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be5:	eb 03                	jmp    802bea <strnlen+0x13>
+		n++;
+  802be7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802bea:	39 d0                	cmp    %edx,%eax
+  802bec:	74 08                	je     802bf6 <strnlen+0x1f>
+  802bee:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802bf2:	75 f3                	jne    802be7 <strnlen+0x10>
+  802bf4:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802bf6:	89 d0                	mov    %edx,%eax
+  802bf8:	5d                   	pop    %ebp
+  802bf9:	c3                   	ret
+
+00802bfa <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802bfa:	55                   	push   %ebp
+  802bfb:	89 e5                	mov    %esp,%ebp
+  802bfd:	53                   	push   %ebx
+  802bfe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c01:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  802c04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c09:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802c0d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802c10:	83 c0 01             	add    $0x1,%eax
+  802c13:	84 d2                	test   %dl,%dl
+  802c15:	75 f2                	jne    802c09 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  802c17:	89 c8                	mov    %ecx,%eax
+  802c19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c1c:	c9                   	leave
+  802c1d:	c3                   	ret
+
+00802c1e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802c1e:	55                   	push   %ebp
+  802c1f:	89 e5                	mov    %esp,%ebp
+  802c21:	53                   	push   %ebx
+  802c22:	83 ec 10             	sub    $0x10,%esp
+  802c25:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  802c28:	53                   	push   %ebx
+  802c29:	e8 91 ff ff ff       	call   802bbf <strlen>
+  802c2e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  802c31:	ff 75 0c             	push   0xc(%ebp)
+  802c34:	01 d8                	add    %ebx,%eax
+  802c36:	50                   	push   %eax
+  802c37:	e8 be ff ff ff       	call   802bfa <strcpy>
+	return dst;
+}
+  802c3c:	89 d8                	mov    %ebx,%eax
+  802c3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c41:	c9                   	leave
+  802c42:	c3                   	ret
+
+00802c43 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802c43:	55                   	push   %ebp
+  802c44:	89 e5                	mov    %esp,%ebp
+  802c46:	56                   	push   %esi
+  802c47:	53                   	push   %ebx
+  802c48:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c4b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  802c4e:	89 f3                	mov    %esi,%ebx
+  802c50:	03 5d 10             	add    0x10(%ebp),%ebx
+  802c53:	89 f0                	mov    %esi,%eax
+  802c55:	eb 0f                	jmp    802c66 <strncpy+0x23>
+		*dst++ = *src;
+  802c57:	83 c0 01             	add    $0x1,%eax
+  802c5a:	0f b6 0a             	movzbl (%edx),%ecx
+  802c5d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  802c60:	80 f9 01             	cmp    $0x1,%cl
+  802c63:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  802c66:	39 d8                	cmp    %ebx,%eax
+  802c68:	75 ed                	jne    802c57 <strncpy+0x14>
+	}
+	return ret;
+}
+  802c6a:	89 f0                	mov    %esi,%eax
+  802c6c:	5b                   	pop    %ebx
+  802c6d:	5e                   	pop    %esi
+  802c6e:	5d                   	pop    %ebp
+  802c6f:	c3                   	ret
+
+00802c70 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802c70:	55                   	push   %ebp
+  802c71:	89 e5                	mov    %esp,%ebp
+  802c73:	56                   	push   %esi
+  802c74:	53                   	push   %ebx
+  802c75:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c7b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  802c7e:	89 f0                	mov    %esi,%eax
+  802c80:	85 d2                	test   %edx,%edx
+  802c82:	74 21                	je     802ca5 <strlcpy+0x35>
+  802c84:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  802c88:	89 f2                	mov    %esi,%edx
+  802c8a:	eb 09                	jmp    802c95 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  802c8c:	83 c1 01             	add    $0x1,%ecx
+  802c8f:	83 c2 01             	add    $0x1,%edx
+  802c92:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  802c95:	39 c2                	cmp    %eax,%edx
+  802c97:	74 09                	je     802ca2 <strlcpy+0x32>
+  802c99:	0f b6 19             	movzbl (%ecx),%ebx
+  802c9c:	84 db                	test   %bl,%bl
+  802c9e:	75 ec                	jne    802c8c <strlcpy+0x1c>
+  802ca0:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802ca2:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802ca5:	29 f0                	sub    %esi,%eax
+}
+  802ca7:	5b                   	pop    %ebx
+  802ca8:	5e                   	pop    %esi
+  802ca9:	5d                   	pop    %ebp
+  802caa:	c3                   	ret
+
+00802cab <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802cab:	55                   	push   %ebp
+  802cac:	89 e5                	mov    %esp,%ebp
+  802cae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802cb1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802cb4:	eb 06                	jmp    802cbc <strcmp+0x11>
+		p++, q++;
+  802cb6:	83 c1 01             	add    $0x1,%ecx
+  802cb9:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  802cbc:	0f b6 01             	movzbl (%ecx),%eax
+  802cbf:	84 c0                	test   %al,%al
+  802cc1:	74 04                	je     802cc7 <strcmp+0x1c>
+  802cc3:	3a 02                	cmp    (%edx),%al
+  802cc5:	74 ef                	je     802cb6 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802cc7:	0f b6 c0             	movzbl %al,%eax
+  802cca:	0f b6 12             	movzbl (%edx),%edx
+  802ccd:	29 d0                	sub    %edx,%eax
+}
+  802ccf:	5d                   	pop    %ebp
+  802cd0:	c3                   	ret
+
+00802cd1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802cd1:	55                   	push   %ebp
+  802cd2:	89 e5                	mov    %esp,%ebp
+  802cd4:	53                   	push   %ebx
+  802cd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cdb:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  802cde:	eb 09                	jmp    802ce9 <strncmp+0x18>
+		n--, p++, q++;
+  802ce0:	83 ea 01             	sub    $0x1,%edx
+  802ce3:	83 c0 01             	add    $0x1,%eax
+  802ce6:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802ce9:	85 d2                	test   %edx,%edx
+  802ceb:	74 18                	je     802d05 <strncmp+0x34>
+  802ced:	0f b6 18             	movzbl (%eax),%ebx
+  802cf0:	84 db                	test   %bl,%bl
+  802cf2:	74 04                	je     802cf8 <strncmp+0x27>
+  802cf4:	3a 19                	cmp    (%ecx),%bl
+  802cf6:	74 e8                	je     802ce0 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802cf8:	0f b6 00             	movzbl (%eax),%eax
+  802cfb:	0f b6 11             	movzbl (%ecx),%edx
+  802cfe:	29 d0                	sub    %edx,%eax
+}
+  802d00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d03:	c9                   	leave
+  802d04:	c3                   	ret
+		return 0;
+  802d05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0a:	eb f4                	jmp    802d00 <strncmp+0x2f>
+
+00802d0c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802d0c:	55                   	push   %ebp
+  802d0d:	89 e5                	mov    %esp,%ebp
+  802d0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d12:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d16:	eb 03                	jmp    802d1b <strchr+0xf>
+  802d18:	83 c0 01             	add    $0x1,%eax
+  802d1b:	0f b6 10             	movzbl (%eax),%edx
+  802d1e:	84 d2                	test   %dl,%dl
+  802d20:	74 06                	je     802d28 <strchr+0x1c>
+		if (*s == c)
+  802d22:	38 ca                	cmp    %cl,%dl
+  802d24:	75 f2                	jne    802d18 <strchr+0xc>
+  802d26:	eb 05                	jmp    802d2d <strchr+0x21>
+			return (char *) s;
+	return 0;
+  802d28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d2d:	5d                   	pop    %ebp
+  802d2e:	c3                   	ret
+
+00802d2f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802d2f:	55                   	push   %ebp
+  802d30:	89 e5                	mov    %esp,%ebp
+  802d32:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d35:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  802d39:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  802d3c:	38 ca                	cmp    %cl,%dl
+  802d3e:	74 09                	je     802d49 <strfind+0x1a>
+  802d40:	84 d2                	test   %dl,%dl
+  802d42:	74 05                	je     802d49 <strfind+0x1a>
+	for (; *s; s++)
+  802d44:	83 c0 01             	add    $0x1,%eax
+  802d47:	eb f0                	jmp    802d39 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  802d49:	5d                   	pop    %ebp
+  802d4a:	c3                   	ret
+
+00802d4b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802d4b:	55                   	push   %ebp
+  802d4c:	89 e5                	mov    %esp,%ebp
+  802d4e:	57                   	push   %edi
+  802d4f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d52:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  802d55:	85 c9                	test   %ecx,%ecx
+  802d57:	74 20                	je     802d79 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  802d59:	89 f8                	mov    %edi,%eax
+  802d5b:	09 c8                	or     %ecx,%eax
+  802d5d:	a8 03                	test   $0x3,%al
+  802d5f:	75 12                	jne    802d73 <memset+0x28>
+		c &= 0xFF;
+  802d61:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802d65:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  802d6b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  802d6e:	fc                   	cld
+  802d6f:	f3 ab                	rep stos %eax,%es:(%edi)
+  802d71:	eb 06                	jmp    802d79 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  802d73:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d76:	fc                   	cld
+  802d77:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  802d79:	89 f8                	mov    %edi,%eax
+  802d7b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  802d7e:	c9                   	leave
+  802d7f:	c3                   	ret
+
+00802d80 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  802d80:	55                   	push   %ebp
+  802d81:	89 e5                	mov    %esp,%ebp
+  802d83:	57                   	push   %edi
+  802d84:	56                   	push   %esi
+  802d85:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d88:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d8b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  802d8e:	39 c6                	cmp    %eax,%esi
+  802d90:	73 32                	jae    802dc4 <memmove+0x44>
+  802d92:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802d95:	39 d0                	cmp    %edx,%eax
+  802d97:	73 2b                	jae    802dc4 <memmove+0x44>
+		s += n;
+		d += n;
+  802d99:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802d9c:	89 d6                	mov    %edx,%esi
+  802d9e:	09 fe                	or     %edi,%esi
+  802da0:	09 ce                	or     %ecx,%esi
+  802da2:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802da8:	75 0e                	jne    802db8 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802daa:	83 ef 04             	sub    $0x4,%edi
+  802dad:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802db0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802db3:	fd                   	std
+  802db4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802db6:	eb 09                	jmp    802dc1 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802db8:	83 ef 01             	sub    $0x1,%edi
+  802dbb:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  802dbe:	fd                   	std
+  802dbf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802dc1:	fc                   	cld
+  802dc2:	eb 1a                	jmp    802dde <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802dc4:	89 f2                	mov    %esi,%edx
+  802dc6:	09 c2                	or     %eax,%edx
+  802dc8:	09 ca                	or     %ecx,%edx
+  802dca:	f6 c2 03             	test   $0x3,%dl
+  802dcd:	75 0a                	jne    802dd9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802dcf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802dd2:	89 c7                	mov    %eax,%edi
+  802dd4:	fc                   	cld
+  802dd5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802dd7:	eb 05                	jmp    802dde <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802dd9:	89 c7                	mov    %eax,%edi
+  802ddb:	fc                   	cld
+  802ddc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  802dde:	5e                   	pop    %esi
+  802ddf:	5f                   	pop    %edi
+  802de0:	5d                   	pop    %ebp
+  802de1:	c3                   	ret
+
+00802de2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802de2:	55                   	push   %ebp
+  802de3:	89 e5                	mov    %esp,%ebp
+  802de5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802de8:	ff 75 10             	push   0x10(%ebp)
+  802deb:	ff 75 0c             	push   0xc(%ebp)
+  802dee:	ff 75 08             	push   0x8(%ebp)
+  802df1:	e8 8a ff ff ff       	call   802d80 <memmove>
+}
+  802df6:	c9                   	leave
+  802df7:	c3                   	ret
+
+00802df8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802df8:	55                   	push   %ebp
+  802df9:	89 e5                	mov    %esp,%ebp
+  802dfb:	56                   	push   %esi
+  802dfc:	53                   	push   %ebx
+  802dfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e00:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  802e03:	89 c6                	mov    %eax,%esi
+  802e05:	03 75 10             	add    0x10(%ebp),%esi
+  802e08:	eb 06                	jmp    802e10 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  802e0a:	83 c0 01             	add    $0x1,%eax
+  802e0d:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  802e10:	39 f0                	cmp    %esi,%eax
+  802e12:	74 14                	je     802e28 <memcmp+0x30>
+		if (*s1 != *s2)
+  802e14:	0f b6 08             	movzbl (%eax),%ecx
+  802e17:	0f b6 1a             	movzbl (%edx),%ebx
+  802e1a:	38 d9                	cmp    %bl,%cl
+  802e1c:	74 ec                	je     802e0a <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  802e1e:	0f b6 c1             	movzbl %cl,%eax
+  802e21:	0f b6 db             	movzbl %bl,%ebx
+  802e24:	29 d8                	sub    %ebx,%eax
+  802e26:	eb 05                	jmp    802e2d <memcmp+0x35>
+	}
+
+	return 0;
+  802e28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e2d:	5b                   	pop    %ebx
+  802e2e:	5e                   	pop    %esi
+  802e2f:	5d                   	pop    %ebp
+  802e30:	c3                   	ret
+
+00802e31 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802e31:	55                   	push   %ebp
+  802e32:	89 e5                	mov    %esp,%ebp
+  802e34:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  802e3a:	89 c2                	mov    %eax,%edx
+  802e3c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  802e3f:	eb 03                	jmp    802e44 <memfind+0x13>
+  802e41:	83 c0 01             	add    $0x1,%eax
+  802e44:	39 d0                	cmp    %edx,%eax
+  802e46:	73 04                	jae    802e4c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802e48:	38 08                	cmp    %cl,(%eax)
+  802e4a:	75 f5                	jne    802e41 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  802e4c:	5d                   	pop    %ebp
+  802e4d:	c3                   	ret
+
+00802e4e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802e4e:	55                   	push   %ebp
+  802e4f:	89 e5                	mov    %esp,%ebp
+  802e51:	57                   	push   %edi
+  802e52:	56                   	push   %esi
+  802e53:	53                   	push   %ebx
+  802e54:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802e5a:	eb 03                	jmp    802e5f <strtol+0x11>
+		s++;
+  802e5c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  802e5f:	0f b6 02             	movzbl (%edx),%eax
+  802e62:	3c 20                	cmp    $0x20,%al
+  802e64:	74 f6                	je     802e5c <strtol+0xe>
+  802e66:	3c 09                	cmp    $0x9,%al
+  802e68:	74 f2                	je     802e5c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  802e6a:	3c 2b                	cmp    $0x2b,%al
+  802e6c:	74 2a                	je     802e98 <strtol+0x4a>
+	int neg = 0;
+  802e6e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  802e73:	3c 2d                	cmp    $0x2d,%al
+  802e75:	74 2b                	je     802ea2 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802e77:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  802e7d:	75 0f                	jne    802e8e <strtol+0x40>
+  802e7f:	80 3a 30             	cmpb   $0x30,(%edx)
+  802e82:	74 28                	je     802eac <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802e84:	85 db                	test   %ebx,%ebx
+  802e86:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802e8b:	0f 44 d8             	cmove  %eax,%ebx
+  802e8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e93:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802e96:	eb 46                	jmp    802ede <strtol+0x90>
+		s++;
+  802e98:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  802e9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ea0:	eb d5                	jmp    802e77 <strtol+0x29>
+		s++, neg = 1;
+  802ea2:	83 c2 01             	add    $0x1,%edx
+  802ea5:	bf 01 00 00 00       	mov    $0x1,%edi
+  802eaa:	eb cb                	jmp    802e77 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802eac:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802eb0:	74 0e                	je     802ec0 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  802eb2:	85 db                	test   %ebx,%ebx
+  802eb4:	75 d8                	jne    802e8e <strtol+0x40>
+		s++, base = 8;
+  802eb6:	83 c2 01             	add    $0x1,%edx
+  802eb9:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802ebe:	eb ce                	jmp    802e8e <strtol+0x40>
+		s += 2, base = 16;
+  802ec0:	83 c2 02             	add    $0x2,%edx
+  802ec3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802ec8:	eb c4                	jmp    802e8e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  802eca:	0f be c0             	movsbl %al,%eax
+  802ecd:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  802ed0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802ed3:	7d 3a                	jge    802f0f <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  802ed5:	83 c2 01             	add    $0x1,%edx
+  802ed8:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802edc:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  802ede:	0f b6 02             	movzbl (%edx),%eax
+  802ee1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802ee4:	89 f3                	mov    %esi,%ebx
+  802ee6:	80 fb 09             	cmp    $0x9,%bl
+  802ee9:	76 df                	jbe    802eca <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  802eeb:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802eee:	89 f3                	mov    %esi,%ebx
+  802ef0:	80 fb 19             	cmp    $0x19,%bl
+  802ef3:	77 08                	ja     802efd <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  802ef5:	0f be c0             	movsbl %al,%eax
+  802ef8:	83 e8 57             	sub    $0x57,%eax
+  802efb:	eb d3                	jmp    802ed0 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  802efd:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802f00:	89 f3                	mov    %esi,%ebx
+  802f02:	80 fb 19             	cmp    $0x19,%bl
+  802f05:	77 08                	ja     802f0f <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  802f07:	0f be c0             	movsbl %al,%eax
+  802f0a:	83 e8 37             	sub    $0x37,%eax
+  802f0d:	eb c1                	jmp    802ed0 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802f0f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802f13:	74 05                	je     802f1a <strtol+0xcc>
+		*endptr = (char *) s;
+  802f15:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f18:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  802f1a:	89 c8                	mov    %ecx,%eax
+  802f1c:	f7 d8                	neg    %eax
+  802f1e:	85 ff                	test   %edi,%edi
+  802f20:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802f23:	89 c8                	mov    %ecx,%eax
+  802f25:	5b                   	pop    %ebx
+  802f26:	5e                   	pop    %esi
+  802f27:	5f                   	pop    %edi
+  802f28:	5d                   	pop    %ebp
+  802f29:	c3                   	ret
+
+00802f2a <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802f2a:	55                   	push   %ebp
+  802f2b:	89 e5                	mov    %esp,%ebp
+  802f2d:	57                   	push   %edi
+  802f2e:	56                   	push   %esi
+  802f2f:	53                   	push   %ebx
+  802f30:	83 ec 20             	sub    $0x20,%esp
+  802f33:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f36:	89 d7                	mov    %edx,%edi
+  802f38:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802f3a:	51                   	push   %ecx
+  802f3b:	68 00 f0 7f 00       	push   $0x7ff000
+  802f40:	6a 00                	push   $0x0
+  802f42:	e8 2e d2 ff ff       	call   800175 <sys_page_alloc>
+  802f47:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f49:	83 c4 10             	add    $0x10,%esp
+  802f4c:	85 c0                	test   %eax,%eax
+  802f4e:	78 45                	js     802f95 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802f50:	83 ec 04             	sub    $0x4,%esp
+  802f53:	68 00 10 00 00       	push   $0x1000
+  802f58:	57                   	push   %edi
+  802f59:	68 00 f0 7f 00       	push   $0x7ff000
+  802f5e:	e8 1d fe ff ff       	call   802d80 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  802f63:	89 34 24             	mov    %esi,(%esp)
+  802f66:	57                   	push   %edi
+  802f67:	ff 75 e4             	push   -0x1c(%ebp)
+  802f6a:	68 00 f0 7f 00       	push   $0x7ff000
+  802f6f:	6a 00                	push   $0x0
+  802f71:	e8 4a d2 ff ff       	call   8001c0 <sys_page_map>
+  802f76:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802f78:	83 c4 20             	add    $0x20,%esp
+  802f7b:	85 c0                	test   %eax,%eax
+  802f7d:	78 16                	js     802f95 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802f7f:	83 ec 08             	sub    $0x8,%esp
+  802f82:	68 00 f0 7f 00       	push   $0x7ff000
+  802f87:	6a 00                	push   $0x0
+  802f89:	e8 74 d2 ff ff       	call   800202 <sys_page_unmap>
+  802f8e:	83 c4 10             	add    $0x10,%esp
+  802f91:	85 c0                	test   %eax,%eax
+  802f93:	75 0a                	jne    802f9f <copy_page_to+0x75>
+exit:
+	return r;
+}
+  802f95:	89 d8                	mov    %ebx,%eax
+  802f97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f9a:	5b                   	pop    %ebx
+  802f9b:	5e                   	pop    %esi
+  802f9c:	5f                   	pop    %edi
+  802f9d:	5d                   	pop    %ebp
+  802f9e:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802f9f:	68 28 3c 80 00       	push   $0x803c28
+  802fa4:	68 24 38 80 00       	push   $0x803824
+  802fa9:	6a 1b                	push   $0x1b
+  802fab:	68 a0 3c 80 00       	push   $0x803ca0
+  802fb0:	e8 7c f5 ff ff       	call   802531 <_panic>
+
+00802fb5 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802fb5:	55                   	push   %ebp
+  802fb6:	89 e5                	mov    %esp,%ebp
+  802fb8:	53                   	push   %ebx
+  802fb9:	83 ec 04             	sub    $0x4,%esp
+  802fbc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  802fbf:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  802fc1:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  802fc5:	74 21                	je     802fe8 <pgfault+0x33>
+  802fc7:	89 d0                	mov    %edx,%eax
+  802fc9:	c1 e8 16             	shr    $0x16,%eax
+  802fcc:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802fd3:	a8 01                	test   $0x1,%al
+  802fd5:	74 11                	je     802fe8 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  802fd7:	89 d0                	mov    %edx,%eax
+  802fd9:	c1 e8 0c             	shr    $0xc,%eax
+  802fdc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802fe3:	f6 c4 08             	test   $0x8,%ah
+  802fe6:	75 17                	jne    802fff <pgfault+0x4a>
+		if (pgfault_next) {
+  802fe8:	a1 04 90 80 00       	mov    0x809004,%eax
+  802fed:	85 c0                	test   %eax,%eax
+  802fef:	74 27                	je     803018 <pgfault+0x63>
+			pgfault_next(utf);
+  802ff1:	83 ec 0c             	sub    $0xc,%esp
+  802ff4:	53                   	push   %ebx
+  802ff5:	ff d0                	call   *%eax
+			return;
+  802ff7:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  802ffa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ffd:	c9                   	leave
+  802ffe:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  802fff:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803005:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80300a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80300f:	e8 16 ff ff ff       	call   802f2a <copy_page_to>
+  803014:	85 c0                	test   %eax,%eax
+  803016:	79 e2                	jns    802ffa <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803018:	a1 00 50 80 00       	mov    0x805000,%eax
+  80301d:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803020:	ff 73 28             	push   0x28(%ebx)
+  803023:	ff 33                	push   (%ebx)
+  803025:	50                   	push   %eax
+  803026:	68 4c 3c 80 00       	push   $0x803c4c
+  80302b:	e8 dc f5 ff ff       	call   80260c <cprintf>
+	sys_env_destroy(0);
+  803030:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803037:	e8 aa d0 ff ff       	call   8000e6 <sys_env_destroy>
+  80303c:	83 c4 10             	add    $0x10,%esp
+  80303f:	eb b9                	jmp    802ffa <pgfault+0x45>
+
+00803041 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803041:	55                   	push   %ebp
+  803042:	89 e5                	mov    %esp,%ebp
+  803044:	53                   	push   %ebx
+  803045:	83 ec 04             	sub    $0x4,%esp
+  803048:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80304b:	a1 08 90 80 00       	mov    0x809008,%eax
+  803050:	3d b5 2f 80 00       	cmp    $0x802fb5,%eax
+  803055:	74 15                	je     80306c <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803057:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  80305c:	83 ec 0c             	sub    $0xc,%esp
+  80305f:	68 b5 2f 80 00       	push   $0x802fb5
+  803064:	e8 fb 03 00 00       	call   803464 <set_pgfault_handler>
+  803069:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80306c:	83 ec 0c             	sub    $0xc,%esp
+  80306f:	68 05 08 00 00       	push   $0x805
+  803074:	53                   	push   %ebx
+  803075:	6a 00                	push   $0x0
+  803077:	53                   	push   %ebx
+  803078:	6a 00                	push   $0x0
+  80307a:	e8 41 d1 ff ff       	call   8001c0 <sys_page_map>
+}
+  80307f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803082:	c9                   	leave
+  803083:	c3                   	ret
+
+00803084 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803084:	55                   	push   %ebp
+  803085:	89 e5                	mov    %esp,%ebp
+  803087:	57                   	push   %edi
+  803088:	56                   	push   %esi
+  803089:	53                   	push   %ebx
+  80308a:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80308d:	68 b5 2f 80 00       	push   $0x802fb5
+  803092:	e8 cd 03 00 00       	call   803464 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803097:	b8 07 00 00 00       	mov    $0x7,%eax
+  80309c:	cd 30                	int    $0x30
+  80309e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8030a4:	83 c4 10             	add    $0x10,%esp
+  8030a7:	85 c0                	test   %eax,%eax
+  8030a9:	0f 88 6b 01 00 00    	js     80321a <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030af:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8030b4:	75 37                	jne    8030ed <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8030b6:	e8 74 d0 ff ff       	call   80012f <sys_getenvid>
+  8030bb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030c0:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8030c6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8030cb:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8030d0:	e9 45 01 00 00       	jmp    80321a <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8030d5:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8030db:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8030e1:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8030e7:	0f 87 ba 00 00 00    	ja     8031a7 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8030ed:	89 d8                	mov    %ebx,%eax
+  8030ef:	c1 e8 16             	shr    $0x16,%eax
+  8030f2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8030f9:	a8 01                	test   $0x1,%al
+  8030fb:	74 d8                	je     8030d5 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8030fd:	89 d8                	mov    %ebx,%eax
+  8030ff:	c1 e8 0c             	shr    $0xc,%eax
+  803102:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803109:	f6 c2 01             	test   $0x1,%dl
+  80310c:	74 cd                	je     8030db <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  80310e:	89 da                	mov    %ebx,%edx
+  803110:	80 e6 df             	and    $0xdf,%dh
+  803113:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803119:	74 c0                	je     8030db <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  80311b:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80311d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803124:	f6 c6 04             	test   $0x4,%dh
+  803127:	75 53                	jne    80317c <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803129:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803130:	f6 c6 08             	test   $0x8,%dh
+  803133:	75 0c                	jne    803141 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803135:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80313c:	f6 c2 02             	test   $0x2,%dl
+  80313f:	74 3b                	je     80317c <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803141:	83 ec 0c             	sub    $0xc,%esp
+  803144:	68 05 08 00 00       	push   $0x805
+  803149:	57                   	push   %edi
+  80314a:	ff 75 e4             	push   -0x1c(%ebp)
+  80314d:	57                   	push   %edi
+  80314e:	6a 00                	push   $0x0
+  803150:	e8 6b d0 ff ff       	call   8001c0 <sys_page_map>
+  803155:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803157:	83 c4 20             	add    $0x20,%esp
+  80315a:	85 c0                	test   %eax,%eax
+  80315c:	0f 88 a7 00 00 00    	js     803209 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803162:	83 ec 0c             	sub    $0xc,%esp
+  803165:	68 05 08 00 00       	push   $0x805
+  80316a:	57                   	push   %edi
+  80316b:	6a 00                	push   $0x0
+  80316d:	57                   	push   %edi
+  80316e:	6a 00                	push   $0x0
+  803170:	e8 4b d0 ff ff       	call   8001c0 <sys_page_map>
+  803175:	89 c6                	mov    %eax,%esi
+	return r;
+  803177:	83 c4 20             	add    $0x20,%esp
+  80317a:	eb 21                	jmp    80319d <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  80317c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803183:	83 ec 0c             	sub    $0xc,%esp
+  803186:	25 07 0e 00 00       	and    $0xe07,%eax
+  80318b:	50                   	push   %eax
+  80318c:	57                   	push   %edi
+  80318d:	ff 75 e4             	push   -0x1c(%ebp)
+  803190:	57                   	push   %edi
+  803191:	6a 00                	push   $0x0
+  803193:	e8 28 d0 ff ff       	call   8001c0 <sys_page_map>
+  803198:	89 c6                	mov    %eax,%esi
+  80319a:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  80319d:	85 f6                	test   %esi,%esi
+  80319f:	0f 89 36 ff ff ff    	jns    8030db <fork+0x57>
+  8031a5:	eb 62                	jmp    803209 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031a7:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031ac:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8031b1:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8031b4:	89 f8                	mov    %edi,%eax
+  8031b6:	e8 6f fd ff ff       	call   802f2a <copy_page_to>
+  8031bb:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031bd:	85 c0                	test   %eax,%eax
+  8031bf:	78 48                	js     803209 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8031c1:	83 ec 04             	sub    $0x4,%esp
+  8031c4:	6a 07                	push   $0x7
+  8031c6:	68 00 f0 bf ee       	push   $0xeebff000
+  8031cb:	57                   	push   %edi
+  8031cc:	e8 a4 cf ff ff       	call   800175 <sys_page_alloc>
+  8031d1:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031d3:	83 c4 10             	add    $0x10,%esp
+  8031d6:	85 c0                	test   %eax,%eax
+  8031d8:	78 2f                	js     803209 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8031da:	a1 00 50 80 00       	mov    0x805000,%eax
+  8031df:	8b 40 64             	mov    0x64(%eax),%eax
+  8031e2:	83 ec 08             	sub    $0x8,%esp
+  8031e5:	50                   	push   %eax
+  8031e6:	57                   	push   %edi
+  8031e7:	e8 f4 d0 ff ff       	call   8002e0 <sys_env_set_pgfault_upcall>
+  8031ec:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031ee:	83 c4 10             	add    $0x10,%esp
+  8031f1:	85 c0                	test   %eax,%eax
+  8031f3:	78 14                	js     803209 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8031f5:	83 ec 08             	sub    $0x8,%esp
+  8031f8:	6a 02                	push   $0x2
+  8031fa:	57                   	push   %edi
+  8031fb:	e8 4c d0 ff ff       	call   80024c <sys_env_set_status>
+  803200:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803202:	83 c4 10             	add    $0x10,%esp
+  803205:	85 c0                	test   %eax,%eax
+  803207:	79 11                	jns    80321a <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803209:	83 ec 0c             	sub    $0xc,%esp
+  80320c:	ff 75 e0             	push   -0x20(%ebp)
+  80320f:	e8 d2 ce ff ff       	call   8000e6 <sys_env_destroy>
+	return r;
+  803214:	83 c4 10             	add    $0x10,%esp
+  803217:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  80321a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80321d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803220:	5b                   	pop    %ebx
+  803221:	5e                   	pop    %esi
+  803222:	5f                   	pop    %edi
+  803223:	5d                   	pop    %ebp
+  803224:	c3                   	ret
+
+00803225 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803225:	55                   	push   %ebp
+  803226:	89 e5                	mov    %esp,%ebp
+  803228:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80322b:	68 ab 3c 80 00       	push   $0x803cab
+  803230:	68 bf 00 00 00       	push   $0xbf
+  803235:	68 a0 3c 80 00       	push   $0x803ca0
+  80323a:	e8 f2 f2 ff ff       	call   802531 <_panic>
+
+0080323f <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80323f:	55                   	push   %ebp
+  803240:	89 e5                	mov    %esp,%ebp
+  803242:	56                   	push   %esi
+  803243:	53                   	push   %ebx
+  803244:	8b 75 08             	mov    0x8(%ebp),%esi
+  803247:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80324a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80324d:	85 c0                	test   %eax,%eax
+  80324f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803254:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803257:	83 ec 0c             	sub    $0xc,%esp
+  80325a:	50                   	push   %eax
+  80325b:	e8 5d d1 ff ff       	call   8003bd <sys_ipc_recv>
+	if (from_env_store)
+  803260:	83 c4 10             	add    $0x10,%esp
+  803263:	85 f6                	test   %esi,%esi
+  803265:	74 14                	je     80327b <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803267:	ba 00 00 00 00       	mov    $0x0,%edx
+  80326c:	85 c0                	test   %eax,%eax
+  80326e:	75 09                	jne    803279 <ipc_recv+0x3a>
+  803270:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803276:	8b 52 74             	mov    0x74(%edx),%edx
+  803279:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  80327b:	85 db                	test   %ebx,%ebx
+  80327d:	74 25                	je     8032a4 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80327f:	85 c0                	test   %eax,%eax
+  803281:	74 0d                	je     803290 <ipc_recv+0x51>
+  803283:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803289:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80328c:	5b                   	pop    %ebx
+  80328d:	5e                   	pop    %esi
+  80328e:	5d                   	pop    %ebp
+  80328f:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803290:	a1 00 50 80 00       	mov    0x805000,%eax
+  803295:	8b 40 78             	mov    0x78(%eax),%eax
+  803298:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  80329a:	a1 00 50 80 00       	mov    0x805000,%eax
+  80329f:	8b 40 70             	mov    0x70(%eax),%eax
+  8032a2:	eb e5                	jmp    803289 <ipc_recv+0x4a>
+  8032a4:	85 c0                	test   %eax,%eax
+  8032a6:	75 e1                	jne    803289 <ipc_recv+0x4a>
+  8032a8:	eb f0                	jmp    80329a <ipc_recv+0x5b>
+
+008032aa <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8032aa:	55                   	push   %ebp
+  8032ab:	89 e5                	mov    %esp,%ebp
+  8032ad:	57                   	push   %edi
+  8032ae:	56                   	push   %esi
+  8032af:	53                   	push   %ebx
+  8032b0:	83 ec 0c             	sub    $0xc,%esp
+  8032b3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032b6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032bc:	85 db                	test   %ebx,%ebx
+  8032be:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032c3:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8032c6:	ff 75 14             	push   0x14(%ebp)
+  8032c9:	53                   	push   %ebx
+  8032ca:	56                   	push   %esi
+  8032cb:	57                   	push   %edi
+  8032cc:	e8 59 d0 ff ff       	call   80032a <sys_ipc_try_send>
+  8032d1:	83 c4 10             	add    $0x10,%esp
+  8032d4:	85 c0                	test   %eax,%eax
+  8032d6:	74 22                	je     8032fa <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8032d8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032db:	75 07                	jne    8032e4 <ipc_send+0x3a>
+		sys_yield();
+  8032dd:	e8 74 ce ff ff       	call   800156 <sys_yield>
+  8032e2:	eb e2                	jmp    8032c6 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8032e4:	68 c1 3c 80 00       	push   $0x803cc1
+  8032e9:	68 24 38 80 00       	push   $0x803824
+  8032ee:	6a 39                	push   $0x39
+  8032f0:	68 d6 3c 80 00       	push   $0x803cd6
+  8032f5:	e8 37 f2 ff ff       	call   802531 <_panic>
+	}
+}
+  8032fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032fd:	5b                   	pop    %ebx
+  8032fe:	5e                   	pop    %esi
+  8032ff:	5f                   	pop    %edi
+  803300:	5d                   	pop    %ebp
+  803301:	c3                   	ret
+
+00803302 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803302:	55                   	push   %ebp
+  803303:	89 e5                	mov    %esp,%ebp
+  803305:	57                   	push   %edi
+  803306:	56                   	push   %esi
+  803307:	53                   	push   %ebx
+  803308:	83 ec 10             	sub    $0x10,%esp
+  80330b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80330e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803311:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803314:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803317:	85 c0                	test   %eax,%eax
+  803319:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80331e:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803321:	6a 00                	push   $0x0
+  803323:	ff 33                	push   (%ebx)
+  803325:	50                   	push   %eax
+  803326:	e8 4f d0 ff ff       	call   80037a <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80332b:	83 c4 10             	add    $0x10,%esp
+  80332e:	85 c0                	test   %eax,%eax
+  803330:	75 3c                	jne    80336e <ipc_recvv+0x6c>
+  803332:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803338:	8b 52 7c             	mov    0x7c(%edx),%edx
+  80333b:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  80333d:	85 ff                	test   %edi,%edi
+  80333f:	74 4e                	je     80338f <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803341:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803347:	8b 52 74             	mov    0x74(%edx),%edx
+  80334a:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  80334c:	85 f6                	test   %esi,%esi
+  80334e:	74 18                	je     803368 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803350:	85 c0                	test   %eax,%eax
+  803352:	75 2d                	jne    803381 <ipc_recvv+0x7f>
+  803354:	a1 00 50 80 00       	mov    0x805000,%eax
+  803359:	8b 40 78             	mov    0x78(%eax),%eax
+  80335c:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  80335e:	a1 00 50 80 00       	mov    0x805000,%eax
+  803363:	8b 40 70             	mov    0x70(%eax),%eax
+  803366:	eb 1f                	jmp    803387 <ipc_recvv+0x85>
+  803368:	85 c0                	test   %eax,%eax
+  80336a:	75 1b                	jne    803387 <ipc_recvv+0x85>
+  80336c:	eb f0                	jmp    80335e <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80336e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803374:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803379:	85 ff                	test   %edi,%edi
+  80337b:	75 cd                	jne    80334a <ipc_recvv+0x48>
+	if (perm_store)
+  80337d:	85 f6                	test   %esi,%esi
+  80337f:	74 e7                	je     803368 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803381:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803387:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80338a:	5b                   	pop    %ebx
+  80338b:	5e                   	pop    %esi
+  80338c:	5f                   	pop    %edi
+  80338d:	5d                   	pop    %ebp
+  80338e:	c3                   	ret
+	if (perm_store)
+  80338f:	85 f6                	test   %esi,%esi
+  803391:	75 bd                	jne    803350 <ipc_recvv+0x4e>
+  803393:	eb c9                	jmp    80335e <ipc_recvv+0x5c>
+
+00803395 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803395:	55                   	push   %ebp
+  803396:	89 e5                	mov    %esp,%ebp
+  803398:	57                   	push   %edi
+  803399:	56                   	push   %esi
+  80339a:	53                   	push   %ebx
+  80339b:	83 ec 0c             	sub    $0xc,%esp
+  80339e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8033a7:	ff 75 14             	push   0x14(%ebp)
+  8033aa:	53                   	push   %ebx
+  8033ab:	56                   	push   %esi
+  8033ac:	57                   	push   %edi
+  8033ad:	e8 a0 cf ff ff       	call   800352 <sys_ipc_try_sendv>
+  8033b2:	83 c4 10             	add    $0x10,%esp
+  8033b5:	85 c0                	test   %eax,%eax
+  8033b7:	74 22                	je     8033db <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8033b9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033bc:	75 07                	jne    8033c5 <ipc_sendv+0x30>
+		sys_yield();
+  8033be:	e8 93 cd ff ff       	call   800156 <sys_yield>
+  8033c3:	eb e2                	jmp    8033a7 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8033c5:	68 c1 3c 80 00       	push   $0x803cc1
+  8033ca:	68 24 38 80 00       	push   $0x803824
+  8033cf:	6a 5c                	push   $0x5c
+  8033d1:	68 d6 3c 80 00       	push   $0x803cd6
+  8033d6:	e8 56 f1 ff ff       	call   802531 <_panic>
+	}
+}
+  8033db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033de:	5b                   	pop    %ebx
+  8033df:	5e                   	pop    %esi
+  8033e0:	5f                   	pop    %edi
+  8033e1:	5d                   	pop    %ebp
+  8033e2:	c3                   	ret
+
+008033e3 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8033e3:	55                   	push   %ebp
+  8033e4:	89 e5                	mov    %esp,%ebp
+  8033e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8033e9:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8033ee:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8033f4:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8033fa:	8b 52 50             	mov    0x50(%edx),%edx
+  8033fd:	39 ca                	cmp    %ecx,%edx
+  8033ff:	74 11                	je     803412 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803401:	83 c0 01             	add    $0x1,%eax
+  803404:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803409:	75 e3                	jne    8033ee <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80340b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803410:	eb 0e                	jmp    803420 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803412:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803418:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80341d:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803420:	5d                   	pop    %ebp
+  803421:	c3                   	ret
+
+00803422 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803422:	55                   	push   %ebp
+  803423:	89 e5                	mov    %esp,%ebp
+  803425:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803428:	89 c2                	mov    %eax,%edx
+  80342a:	c1 ea 16             	shr    $0x16,%edx
+  80342d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803434:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803439:	f6 c1 01             	test   $0x1,%cl
+  80343c:	74 22                	je     803460 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80343e:	c1 e8 0c             	shr    $0xc,%eax
+  803441:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803448:	a8 01                	test   $0x1,%al
+  80344a:	74 14                	je     803460 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80344c:	c1 e8 0c             	shr    $0xc,%eax
+  80344f:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803452:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803459:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  80345d:	0f b7 d2             	movzwl %dx,%edx
+}
+  803460:	89 d0                	mov    %edx,%eax
+  803462:	5d                   	pop    %ebp
+  803463:	c3                   	ret
+
+00803464 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803464:	55                   	push   %ebp
+  803465:	89 e5                	mov    %esp,%ebp
+  803467:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  80346a:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  803471:	74 0a                	je     80347d <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803473:	8b 45 08             	mov    0x8(%ebp),%eax
+  803476:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  80347b:	c9                   	leave
+  80347c:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80347d:	83 ec 04             	sub    $0x4,%esp
+  803480:	6a 07                	push   $0x7
+  803482:	68 00 f0 bf ee       	push   $0xeebff000
+  803487:	6a 00                	push   $0x0
+  803489:	e8 e7 cc ff ff       	call   800175 <sys_page_alloc>
+  80348e:	83 c4 10             	add    $0x10,%esp
+  803491:	85 c0                	test   %eax,%eax
+  803493:	75 2c                	jne    8034c1 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803495:	83 ec 08             	sub    $0x8,%esp
+  803498:	68 d7 34 80 00       	push   $0x8034d7
+  80349d:	6a 00                	push   $0x0
+  80349f:	e8 3c ce ff ff       	call   8002e0 <sys_env_set_pgfault_upcall>
+  8034a4:	83 c4 10             	add    $0x10,%esp
+  8034a7:	85 c0                	test   %eax,%eax
+  8034a9:	74 c8                	je     803473 <set_pgfault_handler+0xf>
+  8034ab:	68 28 3d 80 00       	push   $0x803d28
+  8034b0:	68 24 38 80 00       	push   $0x803824
+  8034b5:	6a 20                	push   $0x20
+  8034b7:	68 58 3d 80 00       	push   $0x803d58
+  8034bc:	e8 70 f0 ff ff       	call   802531 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034c1:	68 e0 3c 80 00       	push   $0x803ce0
+  8034c6:	68 24 38 80 00       	push   $0x803824
+  8034cb:	6a 1e                	push   $0x1e
+  8034cd:	68 58 3d 80 00       	push   $0x803d58
+  8034d2:	e8 5a f0 ff ff       	call   802531 <_panic>
+
+008034d7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8034d7:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8034d8:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  8034dd:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8034df:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8034e2:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8034e7:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8034ec:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8034f0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8034f3:	83 c4 08             	add    $0x8,%esp
+	popal
+  8034f6:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8034f7:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8034fa:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8034fb:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8034fc:	c3                   	ret
+
+008034fd <dm>:
+  8034fd:	55                   	push   %ebp
+  8034fe:	57                   	push   %edi
+  8034ff:	56                   	push   %esi
+  803500:	53                   	push   %ebx
+  803501:	83 ec 24             	sub    $0x24,%esp
+  803504:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803508:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80350c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803510:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803514:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803518:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80351c:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803520:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803525:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80352f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803536:	00 
+  803537:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80353e:	00 
+  80353f:	89 fb                	mov    %edi,%ebx
+  803541:	eb 08                	jmp    80354b <dm+0x4e>
+  803543:	83 e9 01             	sub    $0x1,%ecx
+  803546:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803549:	74 68                	je     8035b3 <dm+0xb6>
+  80354b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80354f:	01 c0                	add    %eax,%eax
+  803551:	89 c6                	mov    %eax,%esi
+  803553:	89 d7                	mov    %edx,%edi
+  803555:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803559:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80355d:	0f ad d0             	shrd   %cl,%edx,%eax
+  803560:	d3 ea                	shr    %cl,%edx
+  803562:	f6 c1 20             	test   $0x20,%cl
+  803565:	74 04                	je     80356b <dm+0x6e>
+  803567:	89 d0                	mov    %edx,%eax
+  803569:	31 d2                	xor    %edx,%edx
+  80356b:	83 e0 01             	and    $0x1,%eax
+  80356e:	89 04 24             	mov    %eax,(%esp)
+  803571:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803578:	00 
+  803579:	8b 04 24             	mov    (%esp),%eax
+  80357c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803580:	09 f0                	or     %esi,%eax
+  803582:	09 fa                	or     %edi,%edx
+  803584:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803588:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80358c:	39 f0                	cmp    %esi,%eax
+  80358e:	89 d5                	mov    %edx,%ebp
+  803590:	19 fd                	sbb    %edi,%ebp
+  803592:	72 af                	jb     803543 <dm+0x46>
+  803594:	29 f0                	sub    %esi,%eax
+  803596:	19 fa                	sbb    %edi,%edx
+  803598:	89 cf                	mov    %ecx,%edi
+  80359a:	c1 ef 05             	shr    $0x5,%edi
+  80359d:	83 e7 01             	and    $0x1,%edi
+  8035a0:	89 fe                	mov    %edi,%esi
+  8035a2:	83 f6 01             	xor    $0x1,%esi
+  8035a5:	d3 e6                	shl    %cl,%esi
+  8035a7:	d3 e7                	shl    %cl,%edi
+  8035a9:	09 74 24 18          	or     %esi,0x18(%esp)
+  8035ad:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8035b1:	eb 90                	jmp    803543 <dm+0x46>
+  8035b3:	85 db                	test   %ebx,%ebx
+  8035b5:	74 05                	je     8035bc <dm+0xbf>
+  8035b7:	89 03                	mov    %eax,(%ebx)
+  8035b9:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035bc:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035c0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035c4:	83 c4 24             	add    $0x24,%esp
+  8035c7:	5b                   	pop    %ebx
+  8035c8:	5e                   	pop    %esi
+  8035c9:	5f                   	pop    %edi
+  8035ca:	5d                   	pop    %ebp
+  8035cb:	c3                   	ret
+
+008035cc <__udivdi3>:
+  8035cc:	83 ec 08             	sub    $0x8,%esp
+  8035cf:	6a 00                	push   $0x0
+  8035d1:	ff 74 24 1c          	push   0x1c(%esp)
+  8035d5:	ff 74 24 1c          	push   0x1c(%esp)
+  8035d9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035dd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035e1:	e8 17 ff ff ff       	call   8034fd <dm>
+  8035e6:	83 c4 14             	add    $0x14,%esp
+  8035e9:	c3                   	ret
+
+008035ea <__umoddi3>:
+  8035ea:	83 ec 18             	sub    $0x18,%esp
+  8035ed:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8035f1:	50                   	push   %eax
+  8035f2:	ff 74 24 2c          	push   0x2c(%esp)
+  8035f6:	ff 74 24 2c          	push   0x2c(%esp)
+  8035fa:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8035fe:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803602:	e8 f6 fe ff ff       	call   8034fd <dm>
+  803607:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80360b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80360f:	83 c4 24             	add    $0x24,%esp
+  803612:	c3                   	ret
+
+00803613 <__divdi3>:
+  803613:	53                   	push   %ebx
+  803614:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803618:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80361c:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803620:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803624:	85 d2                	test   %edx,%edx
+  803626:	78 15                	js     80363d <__divdi3+0x2a>
+  803628:	85 db                	test   %ebx,%ebx
+  80362a:	78 34                	js     803660 <__divdi3+0x4d>
+  80362c:	83 ec 04             	sub    $0x4,%esp
+  80362f:	6a 00                	push   $0x0
+  803631:	53                   	push   %ebx
+  803632:	51                   	push   %ecx
+  803633:	e8 c5 fe ff ff       	call   8034fd <dm>
+  803638:	83 c4 10             	add    $0x10,%esp
+  80363b:	eb 21                	jmp    80365e <__divdi3+0x4b>
+  80363d:	f7 d8                	neg    %eax
+  80363f:	83 d2 00             	adc    $0x0,%edx
+  803642:	f7 da                	neg    %edx
+  803644:	85 db                	test   %ebx,%ebx
+  803646:	78 30                	js     803678 <__divdi3+0x65>
+  803648:	83 ec 04             	sub    $0x4,%esp
+  80364b:	6a 00                	push   $0x0
+  80364d:	53                   	push   %ebx
+  80364e:	51                   	push   %ecx
+  80364f:	e8 a9 fe ff ff       	call   8034fd <dm>
+  803654:	83 c4 10             	add    $0x10,%esp
+  803657:	f7 d8                	neg    %eax
+  803659:	83 d2 00             	adc    $0x0,%edx
+  80365c:	f7 da                	neg    %edx
+  80365e:	5b                   	pop    %ebx
+  80365f:	c3                   	ret
+  803660:	83 ec 04             	sub    $0x4,%esp
+  803663:	6a 00                	push   $0x0
+  803665:	f7 d9                	neg    %ecx
+  803667:	83 d3 00             	adc    $0x0,%ebx
+  80366a:	f7 db                	neg    %ebx
+  80366c:	53                   	push   %ebx
+  80366d:	51                   	push   %ecx
+  80366e:	e8 8a fe ff ff       	call   8034fd <dm>
+  803673:	83 c4 10             	add    $0x10,%esp
+  803676:	eb df                	jmp    803657 <__divdi3+0x44>
+  803678:	83 ec 04             	sub    $0x4,%esp
+  80367b:	6a 00                	push   $0x0
+  80367d:	f7 d9                	neg    %ecx
+  80367f:	83 d3 00             	adc    $0x0,%ebx
+  803682:	f7 db                	neg    %ebx
+  803684:	53                   	push   %ebx
+  803685:	51                   	push   %ecx
+  803686:	e8 72 fe ff ff       	call   8034fd <dm>
+  80368b:	83 c4 10             	add    $0x10,%esp
+  80368e:	eb ce                	jmp    80365e <__divdi3+0x4b>
+
+00803690 <__moddi3>:
+  803690:	55                   	push   %ebp
+  803691:	57                   	push   %edi
+  803692:	56                   	push   %esi
+  803693:	53                   	push   %ebx
+  803694:	83 ec 24             	sub    $0x24,%esp
+  803697:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80369b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80369f:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036a3:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036a7:	85 d2                	test   %edx,%edx
+  8036a9:	78 3b                	js     8036e6 <__moddi3+0x56>
+  8036ab:	83 ec 04             	sub    $0x4,%esp
+  8036ae:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036b2:	56                   	push   %esi
+  8036b3:	89 ce                	mov    %ecx,%esi
+  8036b5:	f7 de                	neg    %esi
+  8036b7:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8036bb:	89 de                	mov    %ebx,%esi
+  8036bd:	83 d6 00             	adc    $0x0,%esi
+  8036c0:	f7 de                	neg    %esi
+  8036c2:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8036c6:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8036ca:	0f 48 f1             	cmovs  %ecx,%esi
+  8036cd:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8036d2:	53                   	push   %ebx
+  8036d3:	56                   	push   %esi
+  8036d4:	e8 24 fe ff ff       	call   8034fd <dm>
+  8036d9:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036dd:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036e1:	83 c4 10             	add    $0x10,%esp
+  8036e4:	eb 47                	jmp    80372d <__moddi3+0x9d>
+  8036e6:	f7 d8                	neg    %eax
+  8036e8:	83 d2 00             	adc    $0x0,%edx
+  8036eb:	f7 da                	neg    %edx
+  8036ed:	83 ec 04             	sub    $0x4,%esp
+  8036f0:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036f4:	56                   	push   %esi
+  8036f5:	89 cf                	mov    %ecx,%edi
+  8036f7:	f7 df                	neg    %edi
+  8036f9:	89 de                	mov    %ebx,%esi
+  8036fb:	83 d6 00             	adc    $0x0,%esi
+  8036fe:	f7 de                	neg    %esi
+  803700:	0f 49 cf             	cmovns %edi,%ecx
+  803703:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803707:	0f 49 de             	cmovns %esi,%ebx
+  80370a:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80370e:	ff 74 24 0c          	push   0xc(%esp)
+  803712:	ff 74 24 0c          	push   0xc(%esp)
+  803716:	e8 e2 fd ff ff       	call   8034fd <dm>
+  80371b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80371f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803723:	f7 d8                	neg    %eax
+  803725:	83 d2 00             	adc    $0x0,%edx
+  803728:	f7 da                	neg    %edx
+  80372a:	83 c4 10             	add    $0x10,%esp
+  80372d:	83 c4 24             	add    $0x24,%esp
+  803730:	5b                   	pop    %ebx
+  803731:	5e                   	pop    %esi
+  803732:	5f                   	pop    %edi
+  803733:	5d                   	pop    %ebp
+  803734:	c3                   	ret
@@ -0,0 +1,8327 @@
+
+obj/user/spawnfaultio.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4a 00 00 00       	call   80007b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	int r;
+	cprintf("i am parent environment %08x\n", thisenv->env_id);
+  800039:	a1 00 60 80 00       	mov    0x806000,%eax
+  80003e:	8b 40 48             	mov    0x48(%eax),%eax
+  800041:	50                   	push   %eax
+  800042:	68 a0 3e 80 00       	push   $0x803ea0
+  800047:	e8 6d 01 00 00       	call   8001b9 <cprintf>
+	if ((r = spawnl("faultio", "faultio", 0)) < 0)
+  80004c:	83 c4 0c             	add    $0xc,%esp
+  80004f:	6a 00                	push   $0x0
+  800051:	68 be 3e 80 00       	push   $0x803ebe
+  800056:	68 be 3e 80 00       	push   $0x803ebe
+  80005b:	e8 8c 2c 00 00       	call   802cec <spawnl>
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	85 c0                	test   %eax,%eax
+  800065:	78 02                	js     800069 <umain+0x36>
+		panic("spawn(faultio) failed: %e", r);
+}
+  800067:	c9                   	leave
+  800068:	c3                   	ret
+		panic("spawn(faultio) failed: %e", r);
+  800069:	50                   	push   %eax
+  80006a:	68 c6 3e 80 00       	push   $0x803ec6
+  80006f:	6a 09                	push   $0x9
+  800071:	68 e0 3e 80 00       	push   $0x803ee0
+  800076:	e8 63 00 00 00       	call   8000de <_panic>
+
+0080007b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80007b:	55                   	push   %ebp
+  80007c:	89 e5                	mov    %esp,%ebp
+  80007e:	56                   	push   %esi
+  80007f:	53                   	push   %ebx
+  800080:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800083:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800086:	e8 e2 0a 00 00       	call   800b6d <sys_getenvid>
+  80008b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800090:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800096:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80009b:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000a0:	85 db                	test   %ebx,%ebx
+  8000a2:	7e 07                	jle    8000ab <libmain+0x30>
+		binaryname = argv[0];
+  8000a4:	8b 06                	mov    (%esi),%eax
+  8000a6:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ab:	83 ec 08             	sub    $0x8,%esp
+  8000ae:	56                   	push   %esi
+  8000af:	53                   	push   %ebx
+  8000b0:	e8 7e ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000b5:	e8 0a 00 00 00       	call   8000c4 <exit>
+}
+  8000ba:	83 c4 10             	add    $0x10,%esp
+  8000bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c0:	5b                   	pop    %ebx
+  8000c1:	5e                   	pop    %esi
+  8000c2:	5d                   	pop    %ebp
+  8000c3:	c3                   	ret
+
+008000c4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c4:	55                   	push   %ebp
+  8000c5:	89 e5                	mov    %esp,%ebp
+  8000c7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000ca:	e8 b9 10 00 00       	call   801188 <close_all>
+	sys_env_destroy(0);
+  8000cf:	83 ec 0c             	sub    $0xc,%esp
+  8000d2:	6a 00                	push   $0x0
+  8000d4:	e8 4b 0a 00 00       	call   800b24 <sys_env_destroy>
+}
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	c9                   	leave
+  8000dd:	c3                   	ret
+
+008000de <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8000de:	55                   	push   %ebp
+  8000df:	89 e5                	mov    %esp,%ebp
+  8000e1:	56                   	push   %esi
+  8000e2:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8000e3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8000e6:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8000ec:	e8 7c 0a 00 00       	call   800b6d <sys_getenvid>
+  8000f1:	83 ec 0c             	sub    $0xc,%esp
+  8000f4:	ff 75 0c             	push   0xc(%ebp)
+  8000f7:	ff 75 08             	push   0x8(%ebp)
+  8000fa:	56                   	push   %esi
+  8000fb:	50                   	push   %eax
+  8000fc:	68 00 3f 80 00       	push   $0x803f00
+  800101:	e8 b3 00 00 00       	call   8001b9 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800106:	83 c4 18             	add    $0x18,%esp
+  800109:	53                   	push   %ebx
+  80010a:	ff 75 10             	push   0x10(%ebp)
+  80010d:	e8 56 00 00 00       	call   800168 <vcprintf>
+	cprintf("\n");
+  800112:	c7 04 24 77 44 80 00 	movl   $0x804477,(%esp)
+  800119:	e8 9b 00 00 00       	call   8001b9 <cprintf>
+  80011e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800121:	cc                   	int3
+	while (1)
+  800122:	eb fd                	jmp    800121 <_panic+0x43>
+
+00800124 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800124:	55                   	push   %ebp
+  800125:	89 e5                	mov    %esp,%ebp
+  800127:	53                   	push   %ebx
+  800128:	83 ec 04             	sub    $0x4,%esp
+  80012b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80012e:	8b 13                	mov    (%ebx),%edx
+  800130:	8d 42 01             	lea    0x1(%edx),%eax
+  800133:	89 03                	mov    %eax,(%ebx)
+  800135:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800138:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80013c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800141:	74 09                	je     80014c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800143:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800147:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80014a:	c9                   	leave
+  80014b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80014c:	83 ec 08             	sub    $0x8,%esp
+  80014f:	68 ff 00 00 00       	push   $0xff
+  800154:	8d 43 08             	lea    0x8(%ebx),%eax
+  800157:	50                   	push   %eax
+  800158:	e8 7a 09 00 00       	call   800ad7 <sys_cputs>
+		b->idx = 0;
+  80015d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800163:	83 c4 10             	add    $0x10,%esp
+  800166:	eb db                	jmp    800143 <putch+0x1f>
+
+00800168 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800168:	55                   	push   %ebp
+  800169:	89 e5                	mov    %esp,%ebp
+  80016b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800171:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800178:	00 00 00 
+	b.cnt = 0;
+  80017b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800182:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800185:	ff 75 0c             	push   0xc(%ebp)
+  800188:	ff 75 08             	push   0x8(%ebp)
+  80018b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800191:	50                   	push   %eax
+  800192:	68 24 01 80 00       	push   $0x800124
+  800197:	e8 14 01 00 00       	call   8002b0 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80019c:	83 c4 08             	add    $0x8,%esp
+  80019f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001a5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ab:	50                   	push   %eax
+  8001ac:	e8 26 09 00 00       	call   800ad7 <sys_cputs>
+
+	return b.cnt;
+}
+  8001b1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001b7:	c9                   	leave
+  8001b8:	c3                   	ret
+
+008001b9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001b9:	55                   	push   %ebp
+  8001ba:	89 e5                	mov    %esp,%ebp
+  8001bc:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001bf:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001c2:	50                   	push   %eax
+  8001c3:	ff 75 08             	push   0x8(%ebp)
+  8001c6:	e8 9d ff ff ff       	call   800168 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001cb:	c9                   	leave
+  8001cc:	c3                   	ret
+
+008001cd <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001cd:	55                   	push   %ebp
+  8001ce:	89 e5                	mov    %esp,%ebp
+  8001d0:	57                   	push   %edi
+  8001d1:	56                   	push   %esi
+  8001d2:	53                   	push   %ebx
+  8001d3:	83 ec 1c             	sub    $0x1c,%esp
+  8001d6:	89 c7                	mov    %eax,%edi
+  8001d8:	89 d6                	mov    %edx,%esi
+  8001da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001e0:	89 d1                	mov    %edx,%ecx
+  8001e2:	89 c2                	mov    %eax,%edx
+  8001e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001ea:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001ed:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001f3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001fa:	39 c2                	cmp    %eax,%edx
+  8001fc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001ff:	72 3e                	jb     80023f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800201:	83 ec 0c             	sub    $0xc,%esp
+  800204:	ff 75 18             	push   0x18(%ebp)
+  800207:	83 eb 01             	sub    $0x1,%ebx
+  80020a:	53                   	push   %ebx
+  80020b:	50                   	push   %eax
+  80020c:	83 ec 08             	sub    $0x8,%esp
+  80020f:	ff 75 e4             	push   -0x1c(%ebp)
+  800212:	ff 75 e0             	push   -0x20(%ebp)
+  800215:	ff 75 dc             	push   -0x24(%ebp)
+  800218:	ff 75 d8             	push   -0x28(%ebp)
+  80021b:	e8 08 3b 00 00       	call   803d28 <__udivdi3>
+  800220:	83 c4 18             	add    $0x18,%esp
+  800223:	52                   	push   %edx
+  800224:	50                   	push   %eax
+  800225:	89 f2                	mov    %esi,%edx
+  800227:	89 f8                	mov    %edi,%eax
+  800229:	e8 9f ff ff ff       	call   8001cd <printnum>
+  80022e:	83 c4 20             	add    $0x20,%esp
+  800231:	eb 13                	jmp    800246 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800233:	83 ec 08             	sub    $0x8,%esp
+  800236:	56                   	push   %esi
+  800237:	ff 75 18             	push   0x18(%ebp)
+  80023a:	ff d7                	call   *%edi
+  80023c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80023f:	83 eb 01             	sub    $0x1,%ebx
+  800242:	85 db                	test   %ebx,%ebx
+  800244:	7f ed                	jg     800233 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800246:	83 ec 08             	sub    $0x8,%esp
+  800249:	56                   	push   %esi
+  80024a:	83 ec 04             	sub    $0x4,%esp
+  80024d:	ff 75 e4             	push   -0x1c(%ebp)
+  800250:	ff 75 e0             	push   -0x20(%ebp)
+  800253:	ff 75 dc             	push   -0x24(%ebp)
+  800256:	ff 75 d8             	push   -0x28(%ebp)
+  800259:	e8 e8 3a 00 00       	call   803d46 <__umoddi3>
+  80025e:	83 c4 14             	add    $0x14,%esp
+  800261:	0f be 80 23 3f 80 00 	movsbl 0x803f23(%eax),%eax
+  800268:	50                   	push   %eax
+  800269:	ff d7                	call   *%edi
+}
+  80026b:	83 c4 10             	add    $0x10,%esp
+  80026e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800271:	5b                   	pop    %ebx
+  800272:	5e                   	pop    %esi
+  800273:	5f                   	pop    %edi
+  800274:	5d                   	pop    %ebp
+  800275:	c3                   	ret
+
+00800276 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800276:	55                   	push   %ebp
+  800277:	89 e5                	mov    %esp,%ebp
+  800279:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80027c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800280:	8b 10                	mov    (%eax),%edx
+  800282:	3b 50 04             	cmp    0x4(%eax),%edx
+  800285:	73 0a                	jae    800291 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800287:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80028a:	89 08                	mov    %ecx,(%eax)
+  80028c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028f:	88 02                	mov    %al,(%edx)
+}
+  800291:	5d                   	pop    %ebp
+  800292:	c3                   	ret
+
+00800293 <printfmt>:
+{
+  800293:	55                   	push   %ebp
+  800294:	89 e5                	mov    %esp,%ebp
+  800296:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800299:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80029c:	50                   	push   %eax
+  80029d:	ff 75 10             	push   0x10(%ebp)
+  8002a0:	ff 75 0c             	push   0xc(%ebp)
+  8002a3:	ff 75 08             	push   0x8(%ebp)
+  8002a6:	e8 05 00 00 00       	call   8002b0 <vprintfmt>
+}
+  8002ab:	83 c4 10             	add    $0x10,%esp
+  8002ae:	c9                   	leave
+  8002af:	c3                   	ret
+
+008002b0 <vprintfmt>:
+{
+  8002b0:	55                   	push   %ebp
+  8002b1:	89 e5                	mov    %esp,%ebp
+  8002b3:	57                   	push   %edi
+  8002b4:	56                   	push   %esi
+  8002b5:	53                   	push   %ebx
+  8002b6:	83 ec 2c             	sub    $0x2c,%esp
+  8002b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002bf:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002c2:	eb 0a                	jmp    8002ce <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002c4:	83 ec 08             	sub    $0x8,%esp
+  8002c7:	53                   	push   %ebx
+  8002c8:	50                   	push   %eax
+  8002c9:	ff d6                	call   *%esi
+  8002cb:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002ce:	83 c7 01             	add    $0x1,%edi
+  8002d1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002d5:	83 f8 25             	cmp    $0x25,%eax
+  8002d8:	74 0c                	je     8002e6 <vprintfmt+0x36>
+			if (ch == '\0')
+  8002da:	85 c0                	test   %eax,%eax
+  8002dc:	75 e6                	jne    8002c4 <vprintfmt+0x14>
+}
+  8002de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e1:	5b                   	pop    %ebx
+  8002e2:	5e                   	pop    %esi
+  8002e3:	5f                   	pop    %edi
+  8002e4:	5d                   	pop    %ebp
+  8002e5:	c3                   	ret
+		padc = ' ';
+  8002e6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002ea:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002f1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002f8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800304:	8d 47 01             	lea    0x1(%edi),%eax
+  800307:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80030a:	0f b6 17             	movzbl (%edi),%edx
+  80030d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800310:	3c 55                	cmp    $0x55,%al
+  800312:	0f 87 cf 03 00 00    	ja     8006e7 <vprintfmt+0x437>
+  800318:	0f b6 c0             	movzbl %al,%eax
+  80031b:	ff 24 85 80 40 80 00 	jmp    *0x804080(,%eax,4)
+  800322:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800325:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800329:	eb d9                	jmp    800304 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80032b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80032e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800332:	eb d0                	jmp    800304 <vprintfmt+0x54>
+  800334:	0f b6 d2             	movzbl %dl,%edx
+  800337:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80033a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800342:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800345:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800349:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80034c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80034f:	83 f9 09             	cmp    $0x9,%ecx
+  800352:	77 55                	ja     8003a9 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800354:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800357:	eb e9                	jmp    800342 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800359:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035c:	8b 00                	mov    (%eax),%eax
+  80035e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800361:	8b 45 14             	mov    0x14(%ebp),%eax
+  800364:	8d 40 04             	lea    0x4(%eax),%eax
+  800367:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80036a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80036d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800371:	79 91                	jns    800304 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800373:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800376:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800379:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800380:	eb 82                	jmp    800304 <vprintfmt+0x54>
+			if (width < 0)
+  800382:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800385:	85 d2                	test   %edx,%edx
+  800387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038c:	0f 49 c2             	cmovns %edx,%eax
+  80038f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800392:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800395:	e9 6a ff ff ff       	jmp    800304 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80039a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80039d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003a4:	e9 5b ff ff ff       	jmp    800304 <vprintfmt+0x54>
+  8003a9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003af:	eb bc                	jmp    80036d <vprintfmt+0xbd>
+			lflag++;
+  8003b1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003b7:	e9 48 ff ff ff       	jmp    800304 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bf:	8d 78 04             	lea    0x4(%eax),%edi
+  8003c2:	83 ec 08             	sub    $0x8,%esp
+  8003c5:	53                   	push   %ebx
+  8003c6:	ff 30                	push   (%eax)
+  8003c8:	ff d6                	call   *%esi
+			break;
+  8003ca:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003cd:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003d0:	e9 b1 02 00 00       	jmp    800686 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003db:	8b 10                	mov    (%eax),%edx
+  8003dd:	89 d0                	mov    %edx,%eax
+  8003df:	f7 d8                	neg    %eax
+  8003e1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003e4:	83 f8 11             	cmp    $0x11,%eax
+  8003e7:	7f 23                	jg     80040c <vprintfmt+0x15c>
+  8003e9:	8b 14 85 e0 41 80 00 	mov    0x8041e0(,%eax,4),%edx
+  8003f0:	85 d2                	test   %edx,%edx
+  8003f2:	74 18                	je     80040c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003f4:	52                   	push   %edx
+  8003f5:	68 32 43 80 00       	push   $0x804332
+  8003fa:	53                   	push   %ebx
+  8003fb:	56                   	push   %esi
+  8003fc:	e8 92 fe ff ff       	call   800293 <printfmt>
+  800401:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800404:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800407:	e9 7a 02 00 00       	jmp    800686 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80040c:	50                   	push   %eax
+  80040d:	68 3b 3f 80 00       	push   $0x803f3b
+  800412:	53                   	push   %ebx
+  800413:	56                   	push   %esi
+  800414:	e8 7a fe ff ff       	call   800293 <printfmt>
+  800419:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80041c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80041f:	e9 62 02 00 00       	jmp    800686 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800424:	8b 45 14             	mov    0x14(%ebp),%eax
+  800427:	83 c0 04             	add    $0x4,%eax
+  80042a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80042d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800430:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800432:	85 c9                	test   %ecx,%ecx
+  800434:	b8 34 3f 80 00       	mov    $0x803f34,%eax
+  800439:	0f 45 c1             	cmovne %ecx,%eax
+  80043c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80043f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800443:	7e 06                	jle    80044b <vprintfmt+0x19b>
+  800445:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800449:	75 0b                	jne    800456 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80044b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80044e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800451:	89 75 08             	mov    %esi,0x8(%ebp)
+  800454:	eb 5c                	jmp    8004b2 <vprintfmt+0x202>
+  800456:	83 ec 08             	sub    $0x8,%esp
+  800459:	ff 75 d0             	push   -0x30(%ebp)
+  80045c:	ff 75 cc             	push   -0x34(%ebp)
+  80045f:	e8 20 03 00 00       	call   800784 <strnlen>
+  800464:	89 c2                	mov    %eax,%edx
+  800466:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800469:	29 d0                	sub    %edx,%eax
+  80046b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80046e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800472:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800475:	89 75 08             	mov    %esi,0x8(%ebp)
+  800478:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80047a:	eb 0e                	jmp    80048a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80047c:	83 ec 08             	sub    $0x8,%esp
+  80047f:	53                   	push   %ebx
+  800480:	57                   	push   %edi
+  800481:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800484:	83 ee 01             	sub    $0x1,%esi
+  800487:	83 c4 10             	add    $0x10,%esp
+  80048a:	85 f6                	test   %esi,%esi
+  80048c:	7f ee                	jg     80047c <vprintfmt+0x1cc>
+  80048e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800491:	8b 75 08             	mov    0x8(%ebp),%esi
+  800494:	85 c0                	test   %eax,%eax
+  800496:	ba 00 00 00 00       	mov    $0x0,%edx
+  80049b:	0f 49 d0             	cmovns %eax,%edx
+  80049e:	29 d0                	sub    %edx,%eax
+  8004a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004a3:	eb a6                	jmp    80044b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8004a5:	83 ec 08             	sub    $0x8,%esp
+  8004a8:	53                   	push   %ebx
+  8004a9:	52                   	push   %edx
+  8004aa:	ff 55 08             	call   *0x8(%ebp)
+  8004ad:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004b0:	89 f1                	mov    %esi,%ecx
+  8004b2:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004b5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004b9:	0f be d0             	movsbl %al,%edx
+  8004bc:	85 d2                	test   %edx,%edx
+  8004be:	74 28                	je     8004e8 <vprintfmt+0x238>
+  8004c0:	85 ff                	test   %edi,%edi
+  8004c2:	78 05                	js     8004c9 <vprintfmt+0x219>
+  8004c4:	83 ef 01             	sub    $0x1,%edi
+  8004c7:	78 30                	js     8004f9 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004c9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004cd:	74 d6                	je     8004a5 <vprintfmt+0x1f5>
+  8004cf:	0f be c0             	movsbl %al,%eax
+  8004d2:	83 e8 20             	sub    $0x20,%eax
+  8004d5:	83 f8 5e             	cmp    $0x5e,%eax
+  8004d8:	76 cb                	jbe    8004a5 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004da:	83 ec 08             	sub    $0x8,%esp
+  8004dd:	53                   	push   %ebx
+  8004de:	6a 3f                	push   $0x3f
+  8004e0:	ff 55 08             	call   *0x8(%ebp)
+  8004e3:	83 c4 10             	add    $0x10,%esp
+  8004e6:	eb c8                	jmp    8004b0 <vprintfmt+0x200>
+  8004e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004eb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ee:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004f1:	01 d0                	add    %edx,%eax
+  8004f3:	29 c8                	sub    %ecx,%eax
+  8004f5:	89 c7                	mov    %eax,%edi
+  8004f7:	eb 13                	jmp    80050c <vprintfmt+0x25c>
+  8004f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004fc:	eb ed                	jmp    8004eb <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	53                   	push   %ebx
+  800502:	6a 20                	push   $0x20
+  800504:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800506:	83 ef 01             	sub    $0x1,%edi
+  800509:	83 c4 10             	add    $0x10,%esp
+  80050c:	85 ff                	test   %edi,%edi
+  80050e:	7f ee                	jg     8004fe <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800510:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800513:	89 45 14             	mov    %eax,0x14(%ebp)
+  800516:	e9 6b 01 00 00       	jmp    800686 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80051b:	83 f9 01             	cmp    $0x1,%ecx
+  80051e:	7f 1f                	jg     80053f <vprintfmt+0x28f>
+	else if (lflag)
+  800520:	85 c9                	test   %ecx,%ecx
+  800522:	74 67                	je     80058b <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	8b 00                	mov    (%eax),%eax
+  800529:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052c:	89 c1                	mov    %eax,%ecx
+  80052e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800531:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800534:	8b 45 14             	mov    0x14(%ebp),%eax
+  800537:	8d 40 04             	lea    0x4(%eax),%eax
+  80053a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80053d:	eb 17                	jmp    800556 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80053f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800542:	8b 50 04             	mov    0x4(%eax),%edx
+  800545:	8b 00                	mov    (%eax),%eax
+  800547:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80054a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80054d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800550:	8d 40 08             	lea    0x8(%eax),%eax
+  800553:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800556:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800559:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80055c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800561:	85 c9                	test   %ecx,%ecx
+  800563:	0f 89 03 01 00 00    	jns    80066c <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800569:	83 ec 08             	sub    $0x8,%esp
+  80056c:	53                   	push   %ebx
+  80056d:	6a 2d                	push   $0x2d
+  80056f:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800571:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800574:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800577:	f7 da                	neg    %edx
+  800579:	83 d1 00             	adc    $0x0,%ecx
+  80057c:	f7 d9                	neg    %ecx
+  80057e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800581:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800586:	e9 e1 00 00 00       	jmp    80066c <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80058b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058e:	8b 00                	mov    (%eax),%eax
+  800590:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800593:	89 c1                	mov    %eax,%ecx
+  800595:	c1 f9 1f             	sar    $0x1f,%ecx
+  800598:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80059b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059e:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a4:	eb b0                	jmp    800556 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8005a6:	83 f9 01             	cmp    $0x1,%ecx
+  8005a9:	7f 1e                	jg     8005c9 <vprintfmt+0x319>
+	else if (lflag)
+  8005ab:	85 c9                	test   %ecx,%ecx
+  8005ad:	74 32                	je     8005e1 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b2:	8b 10                	mov    (%eax),%edx
+  8005b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005bf:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005c4:	e9 a3 00 00 00       	jmp    80066c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cc:	8b 10                	mov    (%eax),%edx
+  8005ce:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005d1:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005d7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005dc:	e9 8b 00 00 00       	jmp    80066c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e4:	8b 10                	mov    (%eax),%edx
+  8005e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005f1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005f6:	eb 74                	jmp    80066c <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005f8:	83 f9 01             	cmp    $0x1,%ecx
+  8005fb:	7f 1b                	jg     800618 <vprintfmt+0x368>
+	else if (lflag)
+  8005fd:	85 c9                	test   %ecx,%ecx
+  8005ff:	74 2c                	je     80062d <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800601:	8b 45 14             	mov    0x14(%ebp),%eax
+  800604:	8b 10                	mov    (%eax),%edx
+  800606:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80060b:	8d 40 04             	lea    0x4(%eax),%eax
+  80060e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800611:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800616:	eb 54                	jmp    80066c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800618:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061b:	8b 10                	mov    (%eax),%edx
+  80061d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800620:	8d 40 08             	lea    0x8(%eax),%eax
+  800623:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800626:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80062b:	eb 3f                	jmp    80066c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8b 10                	mov    (%eax),%edx
+  800632:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800637:	8d 40 04             	lea    0x4(%eax),%eax
+  80063a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80063d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800642:	eb 28                	jmp    80066c <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800644:	83 ec 08             	sub    $0x8,%esp
+  800647:	53                   	push   %ebx
+  800648:	6a 30                	push   $0x30
+  80064a:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80064c:	83 c4 08             	add    $0x8,%esp
+  80064f:	53                   	push   %ebx
+  800650:	6a 78                	push   $0x78
+  800652:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8b 10                	mov    (%eax),%edx
+  800659:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80065e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800661:	8d 40 04             	lea    0x4(%eax),%eax
+  800664:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800667:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80066c:	83 ec 0c             	sub    $0xc,%esp
+  80066f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800673:	50                   	push   %eax
+  800674:	ff 75 e0             	push   -0x20(%ebp)
+  800677:	57                   	push   %edi
+  800678:	51                   	push   %ecx
+  800679:	52                   	push   %edx
+  80067a:	89 da                	mov    %ebx,%edx
+  80067c:	89 f0                	mov    %esi,%eax
+  80067e:	e8 4a fb ff ff       	call   8001cd <printnum>
+			break;
+  800683:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800686:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800689:	e9 40 fc ff ff       	jmp    8002ce <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80068e:	83 f9 01             	cmp    $0x1,%ecx
+  800691:	7f 1b                	jg     8006ae <vprintfmt+0x3fe>
+	else if (lflag)
+  800693:	85 c9                	test   %ecx,%ecx
+  800695:	74 2c                	je     8006c3 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	8b 10                	mov    (%eax),%edx
+  80069c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006a7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006ac:	eb be                	jmp    80066c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b1:	8b 10                	mov    (%eax),%edx
+  8006b3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b6:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006bc:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006c1:	eb a9                	jmp    80066c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c6:	8b 10                	mov    (%eax),%edx
+  8006c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006d8:	eb 92                	jmp    80066c <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006da:	83 ec 08             	sub    $0x8,%esp
+  8006dd:	53                   	push   %ebx
+  8006de:	6a 25                	push   $0x25
+  8006e0:	ff d6                	call   *%esi
+			break;
+  8006e2:	83 c4 10             	add    $0x10,%esp
+  8006e5:	eb 9f                	jmp    800686 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006e7:	83 ec 08             	sub    $0x8,%esp
+  8006ea:	53                   	push   %ebx
+  8006eb:	6a 25                	push   $0x25
+  8006ed:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006ef:	83 c4 10             	add    $0x10,%esp
+  8006f2:	89 f8                	mov    %edi,%eax
+  8006f4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006f8:	74 05                	je     8006ff <vprintfmt+0x44f>
+  8006fa:	83 e8 01             	sub    $0x1,%eax
+  8006fd:	eb f5                	jmp    8006f4 <vprintfmt+0x444>
+  8006ff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800702:	eb 82                	jmp    800686 <vprintfmt+0x3d6>
+
+00800704 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800704:	55                   	push   %ebp
+  800705:	89 e5                	mov    %esp,%ebp
+  800707:	83 ec 18             	sub    $0x18,%esp
+  80070a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80070d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800710:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800713:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800717:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80071a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800721:	85 c0                	test   %eax,%eax
+  800723:	74 26                	je     80074b <vsnprintf+0x47>
+  800725:	85 d2                	test   %edx,%edx
+  800727:	7e 22                	jle    80074b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800729:	ff 75 14             	push   0x14(%ebp)
+  80072c:	ff 75 10             	push   0x10(%ebp)
+  80072f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800732:	50                   	push   %eax
+  800733:	68 76 02 80 00       	push   $0x800276
+  800738:	e8 73 fb ff ff       	call   8002b0 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80073d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800740:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800743:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800746:	83 c4 10             	add    $0x10,%esp
+}
+  800749:	c9                   	leave
+  80074a:	c3                   	ret
+		return -E_INVAL;
+  80074b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800750:	eb f7                	jmp    800749 <vsnprintf+0x45>
+
+00800752 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800752:	55                   	push   %ebp
+  800753:	89 e5                	mov    %esp,%ebp
+  800755:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800758:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80075b:	50                   	push   %eax
+  80075c:	ff 75 10             	push   0x10(%ebp)
+  80075f:	ff 75 0c             	push   0xc(%ebp)
+  800762:	ff 75 08             	push   0x8(%ebp)
+  800765:	e8 9a ff ff ff       	call   800704 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80076a:	c9                   	leave
+  80076b:	c3                   	ret
+
+0080076c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80076c:	55                   	push   %ebp
+  80076d:	89 e5                	mov    %esp,%ebp
+  80076f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800772:	b8 00 00 00 00       	mov    $0x0,%eax
+  800777:	eb 03                	jmp    80077c <strlen+0x10>
+		n++;
+  800779:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80077c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800780:	75 f7                	jne    800779 <strlen+0xd>
+	return n;
+}
+  800782:	5d                   	pop    %ebp
+  800783:	c3                   	ret
+
+00800784 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800784:	55                   	push   %ebp
+  800785:	89 e5                	mov    %esp,%ebp
+  800787:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80078a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80078d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800792:	eb 03                	jmp    800797 <strnlen+0x13>
+		n++;
+  800794:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800797:	39 d0                	cmp    %edx,%eax
+  800799:	74 08                	je     8007a3 <strnlen+0x1f>
+  80079b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80079f:	75 f3                	jne    800794 <strnlen+0x10>
+  8007a1:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8007a3:	89 d0                	mov    %edx,%eax
+  8007a5:	5d                   	pop    %ebp
+  8007a6:	c3                   	ret
+
+008007a7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007a7:	55                   	push   %ebp
+  8007a8:	89 e5                	mov    %esp,%ebp
+  8007aa:	53                   	push   %ebx
+  8007ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007ba:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007bd:	83 c0 01             	add    $0x1,%eax
+  8007c0:	84 d2                	test   %dl,%dl
+  8007c2:	75 f2                	jne    8007b6 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007c4:	89 c8                	mov    %ecx,%eax
+  8007c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c9:	c9                   	leave
+  8007ca:	c3                   	ret
+
+008007cb <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007cb:	55                   	push   %ebp
+  8007cc:	89 e5                	mov    %esp,%ebp
+  8007ce:	53                   	push   %ebx
+  8007cf:	83 ec 10             	sub    $0x10,%esp
+  8007d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007d5:	53                   	push   %ebx
+  8007d6:	e8 91 ff ff ff       	call   80076c <strlen>
+  8007db:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007de:	ff 75 0c             	push   0xc(%ebp)
+  8007e1:	01 d8                	add    %ebx,%eax
+  8007e3:	50                   	push   %eax
+  8007e4:	e8 be ff ff ff       	call   8007a7 <strcpy>
+	return dst;
+}
+  8007e9:	89 d8                	mov    %ebx,%eax
+  8007eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ee:	c9                   	leave
+  8007ef:	c3                   	ret
+
+008007f0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007f0:	55                   	push   %ebp
+  8007f1:	89 e5                	mov    %esp,%ebp
+  8007f3:	56                   	push   %esi
+  8007f4:	53                   	push   %ebx
+  8007f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007fb:	89 f3                	mov    %esi,%ebx
+  8007fd:	03 5d 10             	add    0x10(%ebp),%ebx
+  800800:	89 f0                	mov    %esi,%eax
+  800802:	eb 0f                	jmp    800813 <strncpy+0x23>
+		*dst++ = *src;
+  800804:	83 c0 01             	add    $0x1,%eax
+  800807:	0f b6 0a             	movzbl (%edx),%ecx
+  80080a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80080d:	80 f9 01             	cmp    $0x1,%cl
+  800810:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800813:	39 d8                	cmp    %ebx,%eax
+  800815:	75 ed                	jne    800804 <strncpy+0x14>
+	}
+	return ret;
+}
+  800817:	89 f0                	mov    %esi,%eax
+  800819:	5b                   	pop    %ebx
+  80081a:	5e                   	pop    %esi
+  80081b:	5d                   	pop    %ebp
+  80081c:	c3                   	ret
+
+0080081d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80081d:	55                   	push   %ebp
+  80081e:	89 e5                	mov    %esp,%ebp
+  800820:	56                   	push   %esi
+  800821:	53                   	push   %ebx
+  800822:	8b 75 08             	mov    0x8(%ebp),%esi
+  800825:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800828:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80082b:	89 f0                	mov    %esi,%eax
+  80082d:	85 d2                	test   %edx,%edx
+  80082f:	74 21                	je     800852 <strlcpy+0x35>
+  800831:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800835:	89 f2                	mov    %esi,%edx
+  800837:	eb 09                	jmp    800842 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800839:	83 c1 01             	add    $0x1,%ecx
+  80083c:	83 c2 01             	add    $0x1,%edx
+  80083f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800842:	39 c2                	cmp    %eax,%edx
+  800844:	74 09                	je     80084f <strlcpy+0x32>
+  800846:	0f b6 19             	movzbl (%ecx),%ebx
+  800849:	84 db                	test   %bl,%bl
+  80084b:	75 ec                	jne    800839 <strlcpy+0x1c>
+  80084d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80084f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800852:	29 f0                	sub    %esi,%eax
+}
+  800854:	5b                   	pop    %ebx
+  800855:	5e                   	pop    %esi
+  800856:	5d                   	pop    %ebp
+  800857:	c3                   	ret
+
+00800858 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800858:	55                   	push   %ebp
+  800859:	89 e5                	mov    %esp,%ebp
+  80085b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80085e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800861:	eb 06                	jmp    800869 <strcmp+0x11>
+		p++, q++;
+  800863:	83 c1 01             	add    $0x1,%ecx
+  800866:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800869:	0f b6 01             	movzbl (%ecx),%eax
+  80086c:	84 c0                	test   %al,%al
+  80086e:	74 04                	je     800874 <strcmp+0x1c>
+  800870:	3a 02                	cmp    (%edx),%al
+  800872:	74 ef                	je     800863 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800874:	0f b6 c0             	movzbl %al,%eax
+  800877:	0f b6 12             	movzbl (%edx),%edx
+  80087a:	29 d0                	sub    %edx,%eax
+}
+  80087c:	5d                   	pop    %ebp
+  80087d:	c3                   	ret
+
+0080087e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80087e:	55                   	push   %ebp
+  80087f:	89 e5                	mov    %esp,%ebp
+  800881:	53                   	push   %ebx
+  800882:	8b 45 08             	mov    0x8(%ebp),%eax
+  800885:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800888:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80088b:	eb 09                	jmp    800896 <strncmp+0x18>
+		n--, p++, q++;
+  80088d:	83 ea 01             	sub    $0x1,%edx
+  800890:	83 c0 01             	add    $0x1,%eax
+  800893:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800896:	85 d2                	test   %edx,%edx
+  800898:	74 18                	je     8008b2 <strncmp+0x34>
+  80089a:	0f b6 18             	movzbl (%eax),%ebx
+  80089d:	84 db                	test   %bl,%bl
+  80089f:	74 04                	je     8008a5 <strncmp+0x27>
+  8008a1:	3a 19                	cmp    (%ecx),%bl
+  8008a3:	74 e8                	je     80088d <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008a5:	0f b6 00             	movzbl (%eax),%eax
+  8008a8:	0f b6 11             	movzbl (%ecx),%edx
+  8008ab:	29 d0                	sub    %edx,%eax
+}
+  8008ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008b0:	c9                   	leave
+  8008b1:	c3                   	ret
+		return 0;
+  8008b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b7:	eb f4                	jmp    8008ad <strncmp+0x2f>
+
+008008b9 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008b9:	55                   	push   %ebp
+  8008ba:	89 e5                	mov    %esp,%ebp
+  8008bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008c3:	eb 03                	jmp    8008c8 <strchr+0xf>
+  8008c5:	83 c0 01             	add    $0x1,%eax
+  8008c8:	0f b6 10             	movzbl (%eax),%edx
+  8008cb:	84 d2                	test   %dl,%dl
+  8008cd:	74 06                	je     8008d5 <strchr+0x1c>
+		if (*s == c)
+  8008cf:	38 ca                	cmp    %cl,%dl
+  8008d1:	75 f2                	jne    8008c5 <strchr+0xc>
+  8008d3:	eb 05                	jmp    8008da <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008da:	5d                   	pop    %ebp
+  8008db:	c3                   	ret
+
+008008dc <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008dc:	55                   	push   %ebp
+  8008dd:	89 e5                	mov    %esp,%ebp
+  8008df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008e6:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008e9:	38 ca                	cmp    %cl,%dl
+  8008eb:	74 09                	je     8008f6 <strfind+0x1a>
+  8008ed:	84 d2                	test   %dl,%dl
+  8008ef:	74 05                	je     8008f6 <strfind+0x1a>
+	for (; *s; s++)
+  8008f1:	83 c0 01             	add    $0x1,%eax
+  8008f4:	eb f0                	jmp    8008e6 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008f6:	5d                   	pop    %ebp
+  8008f7:	c3                   	ret
+
+008008f8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008f8:	55                   	push   %ebp
+  8008f9:	89 e5                	mov    %esp,%ebp
+  8008fb:	57                   	push   %edi
+  8008fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008ff:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800902:	85 c9                	test   %ecx,%ecx
+  800904:	74 20                	je     800926 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800906:	89 f8                	mov    %edi,%eax
+  800908:	09 c8                	or     %ecx,%eax
+  80090a:	a8 03                	test   $0x3,%al
+  80090c:	75 12                	jne    800920 <memset+0x28>
+		c &= 0xFF;
+  80090e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800912:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800918:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80091b:	fc                   	cld
+  80091c:	f3 ab                	rep stos %eax,%es:(%edi)
+  80091e:	eb 06                	jmp    800926 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800920:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800923:	fc                   	cld
+  800924:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800926:	89 f8                	mov    %edi,%eax
+  800928:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80092b:	c9                   	leave
+  80092c:	c3                   	ret
+
+0080092d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80092d:	55                   	push   %ebp
+  80092e:	89 e5                	mov    %esp,%ebp
+  800930:	57                   	push   %edi
+  800931:	56                   	push   %esi
+  800932:	8b 45 08             	mov    0x8(%ebp),%eax
+  800935:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800938:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80093b:	39 c6                	cmp    %eax,%esi
+  80093d:	73 32                	jae    800971 <memmove+0x44>
+  80093f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800942:	39 d0                	cmp    %edx,%eax
+  800944:	73 2b                	jae    800971 <memmove+0x44>
+		s += n;
+		d += n;
+  800946:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800949:	89 d6                	mov    %edx,%esi
+  80094b:	09 fe                	or     %edi,%esi
+  80094d:	09 ce                	or     %ecx,%esi
+  80094f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800955:	75 0e                	jne    800965 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800957:	83 ef 04             	sub    $0x4,%edi
+  80095a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80095d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800960:	fd                   	std
+  800961:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800963:	eb 09                	jmp    80096e <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800965:	83 ef 01             	sub    $0x1,%edi
+  800968:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80096b:	fd                   	std
+  80096c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80096e:	fc                   	cld
+  80096f:	eb 1a                	jmp    80098b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800971:	89 f2                	mov    %esi,%edx
+  800973:	09 c2                	or     %eax,%edx
+  800975:	09 ca                	or     %ecx,%edx
+  800977:	f6 c2 03             	test   $0x3,%dl
+  80097a:	75 0a                	jne    800986 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80097c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80097f:	89 c7                	mov    %eax,%edi
+  800981:	fc                   	cld
+  800982:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800984:	eb 05                	jmp    80098b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800986:	89 c7                	mov    %eax,%edi
+  800988:	fc                   	cld
+  800989:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80098b:	5e                   	pop    %esi
+  80098c:	5f                   	pop    %edi
+  80098d:	5d                   	pop    %ebp
+  80098e:	c3                   	ret
+
+0080098f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80098f:	55                   	push   %ebp
+  800990:	89 e5                	mov    %esp,%ebp
+  800992:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800995:	ff 75 10             	push   0x10(%ebp)
+  800998:	ff 75 0c             	push   0xc(%ebp)
+  80099b:	ff 75 08             	push   0x8(%ebp)
+  80099e:	e8 8a ff ff ff       	call   80092d <memmove>
+}
+  8009a3:	c9                   	leave
+  8009a4:	c3                   	ret
+
+008009a5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	56                   	push   %esi
+  8009a9:	53                   	push   %ebx
+  8009aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009b0:	89 c6                	mov    %eax,%esi
+  8009b2:	03 75 10             	add    0x10(%ebp),%esi
+  8009b5:	eb 06                	jmp    8009bd <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009b7:	83 c0 01             	add    $0x1,%eax
+  8009ba:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009bd:	39 f0                	cmp    %esi,%eax
+  8009bf:	74 14                	je     8009d5 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009c1:	0f b6 08             	movzbl (%eax),%ecx
+  8009c4:	0f b6 1a             	movzbl (%edx),%ebx
+  8009c7:	38 d9                	cmp    %bl,%cl
+  8009c9:	74 ec                	je     8009b7 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009cb:	0f b6 c1             	movzbl %cl,%eax
+  8009ce:	0f b6 db             	movzbl %bl,%ebx
+  8009d1:	29 d8                	sub    %ebx,%eax
+  8009d3:	eb 05                	jmp    8009da <memcmp+0x35>
+	}
+
+	return 0;
+  8009d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009da:	5b                   	pop    %ebx
+  8009db:	5e                   	pop    %esi
+  8009dc:	5d                   	pop    %ebp
+  8009dd:	c3                   	ret
+
+008009de <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009de:	55                   	push   %ebp
+  8009df:	89 e5                	mov    %esp,%ebp
+  8009e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009e7:	89 c2                	mov    %eax,%edx
+  8009e9:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009ec:	eb 03                	jmp    8009f1 <memfind+0x13>
+  8009ee:	83 c0 01             	add    $0x1,%eax
+  8009f1:	39 d0                	cmp    %edx,%eax
+  8009f3:	73 04                	jae    8009f9 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009f5:	38 08                	cmp    %cl,(%eax)
+  8009f7:	75 f5                	jne    8009ee <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009f9:	5d                   	pop    %ebp
+  8009fa:	c3                   	ret
+
+008009fb <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009fb:	55                   	push   %ebp
+  8009fc:	89 e5                	mov    %esp,%ebp
+  8009fe:	57                   	push   %edi
+  8009ff:	56                   	push   %esi
+  800a00:	53                   	push   %ebx
+  800a01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a07:	eb 03                	jmp    800a0c <strtol+0x11>
+		s++;
+  800a09:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a0c:	0f b6 02             	movzbl (%edx),%eax
+  800a0f:	3c 20                	cmp    $0x20,%al
+  800a11:	74 f6                	je     800a09 <strtol+0xe>
+  800a13:	3c 09                	cmp    $0x9,%al
+  800a15:	74 f2                	je     800a09 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a17:	3c 2b                	cmp    $0x2b,%al
+  800a19:	74 2a                	je     800a45 <strtol+0x4a>
+	int neg = 0;
+  800a1b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a20:	3c 2d                	cmp    $0x2d,%al
+  800a22:	74 2b                	je     800a4f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a24:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a2a:	75 0f                	jne    800a3b <strtol+0x40>
+  800a2c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a2f:	74 28                	je     800a59 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a31:	85 db                	test   %ebx,%ebx
+  800a33:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a38:	0f 44 d8             	cmove  %eax,%ebx
+  800a3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a40:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a43:	eb 46                	jmp    800a8b <strtol+0x90>
+		s++;
+  800a45:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a48:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a4d:	eb d5                	jmp    800a24 <strtol+0x29>
+		s++, neg = 1;
+  800a4f:	83 c2 01             	add    $0x1,%edx
+  800a52:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a57:	eb cb                	jmp    800a24 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a59:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a5d:	74 0e                	je     800a6d <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a5f:	85 db                	test   %ebx,%ebx
+  800a61:	75 d8                	jne    800a3b <strtol+0x40>
+		s++, base = 8;
+  800a63:	83 c2 01             	add    $0x1,%edx
+  800a66:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a6b:	eb ce                	jmp    800a3b <strtol+0x40>
+		s += 2, base = 16;
+  800a6d:	83 c2 02             	add    $0x2,%edx
+  800a70:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a75:	eb c4                	jmp    800a3b <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a77:	0f be c0             	movsbl %al,%eax
+  800a7a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a7d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a80:	7d 3a                	jge    800abc <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a82:	83 c2 01             	add    $0x1,%edx
+  800a85:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a89:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a8b:	0f b6 02             	movzbl (%edx),%eax
+  800a8e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a91:	89 f3                	mov    %esi,%ebx
+  800a93:	80 fb 09             	cmp    $0x9,%bl
+  800a96:	76 df                	jbe    800a77 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a98:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a9b:	89 f3                	mov    %esi,%ebx
+  800a9d:	80 fb 19             	cmp    $0x19,%bl
+  800aa0:	77 08                	ja     800aaa <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800aa2:	0f be c0             	movsbl %al,%eax
+  800aa5:	83 e8 57             	sub    $0x57,%eax
+  800aa8:	eb d3                	jmp    800a7d <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800aaa:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aad:	89 f3                	mov    %esi,%ebx
+  800aaf:	80 fb 19             	cmp    $0x19,%bl
+  800ab2:	77 08                	ja     800abc <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ab4:	0f be c0             	movsbl %al,%eax
+  800ab7:	83 e8 37             	sub    $0x37,%eax
+  800aba:	eb c1                	jmp    800a7d <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800abc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ac0:	74 05                	je     800ac7 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ac2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ac5:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ac7:	89 c8                	mov    %ecx,%eax
+  800ac9:	f7 d8                	neg    %eax
+  800acb:	85 ff                	test   %edi,%edi
+  800acd:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ad0:	89 c8                	mov    %ecx,%eax
+  800ad2:	5b                   	pop    %ebx
+  800ad3:	5e                   	pop    %esi
+  800ad4:	5f                   	pop    %edi
+  800ad5:	5d                   	pop    %ebp
+  800ad6:	c3                   	ret
+
+00800ad7 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	57                   	push   %edi
+  800adb:	56                   	push   %esi
+  800adc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800add:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae8:	89 c3                	mov    %eax,%ebx
+  800aea:	89 c7                	mov    %eax,%edi
+  800aec:	55                   	push   %ebp
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	8d 35 f7 0a 80 00    	lea    0x800af7,%esi
+  800af5:	0f 34                	sysenter
+  800af7:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800af8:	5b                   	pop    %ebx
+  800af9:	5e                   	pop    %esi
+  800afa:	5f                   	pop    %edi
+  800afb:	5d                   	pop    %ebp
+  800afc:	c3                   	ret
+
+00800afd <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800afd:	55                   	push   %ebp
+  800afe:	89 e5                	mov    %esp,%ebp
+  800b00:	57                   	push   %edi
+  800b01:	56                   	push   %esi
+  800b02:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b03:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b08:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b0d:	89 d1                	mov    %edx,%ecx
+  800b0f:	89 d3                	mov    %edx,%ebx
+  800b11:	89 d7                	mov    %edx,%edi
+  800b13:	55                   	push   %ebp
+  800b14:	89 e5                	mov    %esp,%ebp
+  800b16:	8d 35 1e 0b 80 00    	lea    0x800b1e,%esi
+  800b1c:	0f 34                	sysenter
+  800b1e:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800b1f:	5b                   	pop    %ebx
+  800b20:	5e                   	pop    %esi
+  800b21:	5f                   	pop    %edi
+  800b22:	5d                   	pop    %ebp
+  800b23:	c3                   	ret
+
+00800b24 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b24:	55                   	push   %ebp
+  800b25:	89 e5                	mov    %esp,%ebp
+  800b27:	57                   	push   %edi
+  800b28:	56                   	push   %esi
+  800b29:	53                   	push   %ebx
+  800b2a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b35:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b3a:	89 cb                	mov    %ecx,%ebx
+  800b3c:	89 cf                	mov    %ecx,%edi
+  800b3e:	55                   	push   %ebp
+  800b3f:	89 e5                	mov    %esp,%ebp
+  800b41:	8d 35 49 0b 80 00    	lea    0x800b49,%esi
+  800b47:	0f 34                	sysenter
+  800b49:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b4a:	85 c0                	test   %eax,%eax
+  800b4c:	7f 08                	jg     800b56 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800b4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b51:	5b                   	pop    %ebx
+  800b52:	5e                   	pop    %esi
+  800b53:	5f                   	pop    %edi
+  800b54:	5d                   	pop    %ebp
+  800b55:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b56:	83 ec 0c             	sub    $0xc,%esp
+  800b59:	50                   	push   %eax
+  800b5a:	6a 03                	push   $0x3
+  800b5c:	68 47 42 80 00       	push   $0x804247
+  800b61:	6a 3d                	push   $0x3d
+  800b63:	68 64 42 80 00       	push   $0x804264
+  800b68:	e8 71 f5 ff ff       	call   8000de <_panic>
+
+00800b6d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	57                   	push   %edi
+  800b71:	56                   	push   %esi
+  800b72:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b78:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b7d:	89 d1                	mov    %edx,%ecx
+  800b7f:	89 d3                	mov    %edx,%ebx
+  800b81:	89 d7                	mov    %edx,%edi
+  800b83:	55                   	push   %ebp
+  800b84:	89 e5                	mov    %esp,%ebp
+  800b86:	8d 35 8e 0b 80 00    	lea    0x800b8e,%esi
+  800b8c:	0f 34                	sysenter
+  800b8e:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800b8f:	5b                   	pop    %ebx
+  800b90:	5e                   	pop    %esi
+  800b91:	5f                   	pop    %edi
+  800b92:	5d                   	pop    %ebp
+  800b93:	c3                   	ret
+
+00800b94 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b94:	55                   	push   %ebp
+  800b95:	89 e5                	mov    %esp,%ebp
+  800b97:	57                   	push   %edi
+  800b98:	56                   	push   %esi
+  800b99:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b9f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ba4:	89 d1                	mov    %edx,%ecx
+  800ba6:	89 d3                	mov    %edx,%ebx
+  800ba8:	89 d7                	mov    %edx,%edi
+  800baa:	89 d6                	mov    %edx,%esi
+  800bac:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bae:	5b                   	pop    %ebx
+  800baf:	5e                   	pop    %esi
+  800bb0:	5f                   	pop    %edi
+  800bb1:	5d                   	pop    %ebp
+  800bb2:	c3                   	ret
+
+00800bb3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bb3:	55                   	push   %ebp
+  800bb4:	89 e5                	mov    %esp,%ebp
+  800bb6:	57                   	push   %edi
+  800bb7:	56                   	push   %esi
+  800bb8:	53                   	push   %ebx
+  800bb9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800bbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bcc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bcf:	55                   	push   %ebp
+  800bd0:	89 e5                	mov    %esp,%ebp
+  800bd2:	8d 35 da 0b 80 00    	lea    0x800bda,%esi
+  800bd8:	0f 34                	sysenter
+  800bda:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bdb:	85 c0                	test   %eax,%eax
+  800bdd:	7f 08                	jg     800be7 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800bdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be2:	5b                   	pop    %ebx
+  800be3:	5e                   	pop    %esi
+  800be4:	5f                   	pop    %edi
+  800be5:	5d                   	pop    %ebp
+  800be6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800be7:	83 ec 0c             	sub    $0xc,%esp
+  800bea:	50                   	push   %eax
+  800beb:	6a 04                	push   $0x4
+  800bed:	68 47 42 80 00       	push   $0x804247
+  800bf2:	6a 3d                	push   $0x3d
+  800bf4:	68 64 42 80 00       	push   $0x804264
+  800bf9:	e8 e0 f4 ff ff       	call   8000de <_panic>
+
+00800bfe <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	57                   	push   %edi
+  800c02:	56                   	push   %esi
+  800c03:	53                   	push   %ebx
+  800c04:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c0d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c15:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c18:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c1b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c1d:	85 c0                	test   %eax,%eax
+  800c1f:	7f 08                	jg     800c29 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c24:	5b                   	pop    %ebx
+  800c25:	5e                   	pop    %esi
+  800c26:	5f                   	pop    %edi
+  800c27:	5d                   	pop    %ebp
+  800c28:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c29:	83 ec 0c             	sub    $0xc,%esp
+  800c2c:	50                   	push   %eax
+  800c2d:	6a 05                	push   $0x5
+  800c2f:	68 47 42 80 00       	push   $0x804247
+  800c34:	6a 23                	push   $0x23
+  800c36:	68 64 42 80 00       	push   $0x804264
+  800c3b:	e8 9e f4 ff ff       	call   8000de <_panic>
+
+00800c40 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c40:	55                   	push   %ebp
+  800c41:	89 e5                	mov    %esp,%ebp
+  800c43:	57                   	push   %edi
+  800c44:	56                   	push   %esi
+  800c45:	53                   	push   %ebx
+  800c46:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c54:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c59:	89 df                	mov    %ebx,%edi
+  800c5b:	55                   	push   %ebp
+  800c5c:	89 e5                	mov    %esp,%ebp
+  800c5e:	8d 35 66 0c 80 00    	lea    0x800c66,%esi
+  800c64:	0f 34                	sysenter
+  800c66:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c67:	85 c0                	test   %eax,%eax
+  800c69:	7f 08                	jg     800c73 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800c6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6e:	5b                   	pop    %ebx
+  800c6f:	5e                   	pop    %esi
+  800c70:	5f                   	pop    %edi
+  800c71:	5d                   	pop    %ebp
+  800c72:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c73:	83 ec 0c             	sub    $0xc,%esp
+  800c76:	50                   	push   %eax
+  800c77:	6a 06                	push   $0x6
+  800c79:	68 47 42 80 00       	push   $0x804247
+  800c7e:	6a 3d                	push   $0x3d
+  800c80:	68 64 42 80 00       	push   $0x804264
+  800c85:	e8 54 f4 ff ff       	call   8000de <_panic>
+
+00800c8a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800c8a:	55                   	push   %ebp
+  800c8b:	89 e5                	mov    %esp,%ebp
+  800c8d:	57                   	push   %edi
+  800c8e:	56                   	push   %esi
+  800c8f:	53                   	push   %ebx
+  800c90:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c93:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ca3:	89 df                	mov    %ebx,%edi
+  800ca5:	55                   	push   %ebp
+  800ca6:	89 e5                	mov    %esp,%ebp
+  800ca8:	8d 35 b0 0c 80 00    	lea    0x800cb0,%esi
+  800cae:	0f 34                	sysenter
+  800cb0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cb1:	85 c0                	test   %eax,%eax
+  800cb3:	7f 08                	jg     800cbd <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800cb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb8:	5b                   	pop    %ebx
+  800cb9:	5e                   	pop    %esi
+  800cba:	5f                   	pop    %edi
+  800cbb:	5d                   	pop    %ebp
+  800cbc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cbd:	83 ec 0c             	sub    $0xc,%esp
+  800cc0:	50                   	push   %eax
+  800cc1:	6a 08                	push   $0x8
+  800cc3:	68 47 42 80 00       	push   $0x804247
+  800cc8:	6a 3d                	push   $0x3d
+  800cca:	68 64 42 80 00       	push   $0x804264
+  800ccf:	e8 0a f4 ff ff       	call   8000de <_panic>
+
+00800cd4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800cd4:	55                   	push   %ebp
+  800cd5:	89 e5                	mov    %esp,%ebp
+  800cd7:	57                   	push   %edi
+  800cd8:	56                   	push   %esi
+  800cd9:	53                   	push   %ebx
+  800cda:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce8:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ced:	89 df                	mov    %ebx,%edi
+  800cef:	55                   	push   %ebp
+  800cf0:	89 e5                	mov    %esp,%ebp
+  800cf2:	8d 35 fa 0c 80 00    	lea    0x800cfa,%esi
+  800cf8:	0f 34                	sysenter
+  800cfa:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cfb:	85 c0                	test   %eax,%eax
+  800cfd:	7f 08                	jg     800d07 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800cff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d02:	5b                   	pop    %ebx
+  800d03:	5e                   	pop    %esi
+  800d04:	5f                   	pop    %edi
+  800d05:	5d                   	pop    %ebp
+  800d06:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d07:	83 ec 0c             	sub    $0xc,%esp
+  800d0a:	50                   	push   %eax
+  800d0b:	6a 09                	push   $0x9
+  800d0d:	68 47 42 80 00       	push   $0x804247
+  800d12:	6a 3d                	push   $0x3d
+  800d14:	68 64 42 80 00       	push   $0x804264
+  800d19:	e8 c0 f3 ff ff       	call   8000de <_panic>
+
+00800d1e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d1e:	55                   	push   %ebp
+  800d1f:	89 e5                	mov    %esp,%ebp
+  800d21:	57                   	push   %edi
+  800d22:	56                   	push   %esi
+  800d23:	53                   	push   %ebx
+  800d24:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d32:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d37:	89 df                	mov    %ebx,%edi
+  800d39:	55                   	push   %ebp
+  800d3a:	89 e5                	mov    %esp,%ebp
+  800d3c:	8d 35 44 0d 80 00    	lea    0x800d44,%esi
+  800d42:	0f 34                	sysenter
+  800d44:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d45:	85 c0                	test   %eax,%eax
+  800d47:	7f 08                	jg     800d51 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800d49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4c:	5b                   	pop    %ebx
+  800d4d:	5e                   	pop    %esi
+  800d4e:	5f                   	pop    %edi
+  800d4f:	5d                   	pop    %ebp
+  800d50:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d51:	83 ec 0c             	sub    $0xc,%esp
+  800d54:	50                   	push   %eax
+  800d55:	6a 0a                	push   $0xa
+  800d57:	68 47 42 80 00       	push   $0x804247
+  800d5c:	6a 3d                	push   $0x3d
+  800d5e:	68 64 42 80 00       	push   $0x804264
+  800d63:	e8 76 f3 ff ff       	call   8000de <_panic>
+
+00800d68 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	57                   	push   %edi
+  800d6c:	56                   	push   %esi
+  800d6d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d74:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d7f:	55                   	push   %ebp
+  800d80:	89 e5                	mov    %esp,%ebp
+  800d82:	8d 35 8a 0d 80 00    	lea    0x800d8a,%esi
+  800d88:	0f 34                	sysenter
+  800d8a:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800d8b:	5b                   	pop    %ebx
+  800d8c:	5e                   	pop    %esi
+  800d8d:	5f                   	pop    %edi
+  800d8e:	5d                   	pop    %ebp
+  800d8f:	c3                   	ret
+
+00800d90 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800d90:	55                   	push   %ebp
+  800d91:	89 e5                	mov    %esp,%ebp
+  800d93:	57                   	push   %edi
+  800d94:	56                   	push   %esi
+  800d95:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9c:	b8 17 00 00 00       	mov    $0x17,%eax
+  800da1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800da7:	55                   	push   %ebp
+  800da8:	89 e5                	mov    %esp,%ebp
+  800daa:	8d 35 b2 0d 80 00    	lea    0x800db2,%esi
+  800db0:	0f 34                	sysenter
+  800db2:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800db3:	5b                   	pop    %ebx
+  800db4:	5e                   	pop    %esi
+  800db5:	5f                   	pop    %edi
+  800db6:	5d                   	pop    %ebp
+  800db7:	c3                   	ret
+
+00800db8 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800db8:	55                   	push   %ebp
+  800db9:	89 e5                	mov    %esp,%ebp
+  800dbb:	57                   	push   %edi
+  800dbc:	56                   	push   %esi
+  800dbd:	53                   	push   %ebx
+  800dbe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dc1:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800dd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd4:	89 f7                	mov    %esi,%edi
+  800dd6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dd8:	85 c0                	test   %eax,%eax
+  800dda:	7f 08                	jg     800de4 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800ddc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ddf:	5b                   	pop    %ebx
+  800de0:	5e                   	pop    %esi
+  800de1:	5f                   	pop    %edi
+  800de2:	5d                   	pop    %ebp
+  800de3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de4:	83 ec 0c             	sub    $0xc,%esp
+  800de7:	50                   	push   %eax
+  800de8:	6a 0d                	push   $0xd
+  800dea:	68 47 42 80 00       	push   $0x804247
+  800def:	6a 23                	push   $0x23
+  800df1:	68 64 42 80 00       	push   $0x804264
+  800df6:	e8 e3 f2 ff ff       	call   8000de <_panic>
+
+00800dfb <sys_ipc_recv>:
+{
+  800dfb:	55                   	push   %ebp
+  800dfc:	89 e5                	mov    %esp,%ebp
+  800dfe:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800e01:	6a 00                	push   $0x0
+  800e03:	6a 01                	push   $0x1
+  800e05:	ff 75 08             	push   0x8(%ebp)
+  800e08:	e8 ab ff ff ff       	call   800db8 <sys_ipc_recvv>
+}
+  800e0d:	c9                   	leave
+  800e0e:	c3                   	ret
+
+00800e0f <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800e0f:	55                   	push   %ebp
+  800e10:	89 e5                	mov    %esp,%ebp
+  800e12:	57                   	push   %edi
+  800e13:	56                   	push   %esi
+  800e14:	53                   	push   %ebx
+  800e15:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e18:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e23:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e28:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e2b:	89 de                	mov    %ebx,%esi
+  800e2d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e2f:	85 c0                	test   %eax,%eax
+  800e31:	7f 08                	jg     800e3b <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800e33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e36:	5b                   	pop    %ebx
+  800e37:	5e                   	pop    %esi
+  800e38:	5f                   	pop    %edi
+  800e39:	5d                   	pop    %ebp
+  800e3a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e3b:	83 ec 0c             	sub    $0xc,%esp
+  800e3e:	50                   	push   %eax
+  800e3f:	6a 0d                	push   $0xd
+  800e41:	68 47 42 80 00       	push   $0x804247
+  800e46:	6a 23                	push   $0x23
+  800e48:	68 64 42 80 00       	push   $0x804264
+  800e4d:	e8 8c f2 ff ff       	call   8000de <_panic>
+
+00800e52 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e52:	55                   	push   %ebp
+  800e53:	89 e5                	mov    %esp,%ebp
+  800e55:	57                   	push   %edi
+  800e56:	56                   	push   %esi
+  800e57:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e58:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e62:	89 d1                	mov    %edx,%ecx
+  800e64:	89 d3                	mov    %edx,%ebx
+  800e66:	89 d7                	mov    %edx,%edi
+  800e68:	55                   	push   %ebp
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	8d 35 73 0e 80 00    	lea    0x800e73,%esi
+  800e71:	0f 34                	sysenter
+  800e73:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800e74:	5b                   	pop    %ebx
+  800e75:	5e                   	pop    %esi
+  800e76:	5f                   	pop    %edi
+  800e77:	5d                   	pop    %ebp
+  800e78:	c3                   	ret
+
+00800e79 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800e79:	55                   	push   %ebp
+  800e7a:	89 e5                	mov    %esp,%ebp
+  800e7c:	57                   	push   %edi
+  800e7d:	56                   	push   %esi
+  800e7e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e8f:	89 df                	mov    %ebx,%edi
+  800e91:	55                   	push   %ebp
+  800e92:	89 e5                	mov    %esp,%ebp
+  800e94:	8d 35 9c 0e 80 00    	lea    0x800e9c,%esi
+  800e9a:	0f 34                	sysenter
+  800e9c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800e9d:	5b                   	pop    %ebx
+  800e9e:	5e                   	pop    %esi
+  800e9f:	5f                   	pop    %edi
+  800ea0:	5d                   	pop    %ebp
+  800ea1:	c3                   	ret
+
+00800ea2 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800ea2:	55                   	push   %ebp
+  800ea3:	89 e5                	mov    %esp,%ebp
+  800ea5:	57                   	push   %edi
+  800ea6:	56                   	push   %esi
+  800ea7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ea8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ead:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb0:	b8 10 00 00 00       	mov    $0x10,%eax
+  800eb5:	89 cb                	mov    %ecx,%ebx
+  800eb7:	89 cf                	mov    %ecx,%edi
+  800eb9:	55                   	push   %ebp
+  800eba:	89 e5                	mov    %esp,%ebp
+  800ebc:	8d 35 c4 0e 80 00    	lea    0x800ec4,%esi
+  800ec2:	0f 34                	sysenter
+  800ec4:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+
+00800eca <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	57                   	push   %edi
+  800ece:	56                   	push   %esi
+  800ecf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ed0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edb:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ee0:	89 df                	mov    %ebx,%edi
+  800ee2:	55                   	push   %ebp
+  800ee3:	89 e5                	mov    %esp,%ebp
+  800ee5:	8d 35 ed 0e 80 00    	lea    0x800eed,%esi
+  800eeb:	0f 34                	sysenter
+  800eed:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800eee:	5b                   	pop    %ebx
+  800eef:	5e                   	pop    %esi
+  800ef0:	5f                   	pop    %edi
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	c3                   	ret
+
+00800ef3 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800ef3:	55                   	push   %ebp
+  800ef4:	89 e5                	mov    %esp,%ebp
+  800ef6:	57                   	push   %edi
+  800ef7:	56                   	push   %esi
+  800ef8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ef9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f04:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f09:	89 df                	mov    %ebx,%edi
+  800f0b:	55                   	push   %ebp
+  800f0c:	89 e5                	mov    %esp,%ebp
+  800f0e:	8d 35 16 0f 80 00    	lea    0x800f16,%esi
+  800f14:	0f 34                	sysenter
+  800f16:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800f17:	5b                   	pop    %ebx
+  800f18:	5e                   	pop    %esi
+  800f19:	5f                   	pop    %edi
+  800f1a:	5d                   	pop    %ebp
+  800f1b:	c3                   	ret
+
+00800f1c <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800f1c:	55                   	push   %ebp
+  800f1d:	89 e5                	mov    %esp,%ebp
+  800f1f:	57                   	push   %edi
+  800f20:	56                   	push   %esi
+  800f21:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f28:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f30:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f33:	55                   	push   %ebp
+  800f34:	89 e5                	mov    %esp,%ebp
+  800f36:	8d 35 3e 0f 80 00    	lea    0x800f3e,%esi
+  800f3c:	0f 34                	sysenter
+  800f3e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800f3f:	5b                   	pop    %ebx
+  800f40:	5e                   	pop    %esi
+  800f41:	5f                   	pop    %edi
+  800f42:	5d                   	pop    %ebp
+  800f43:	c3                   	ret
+
+00800f44 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	57                   	push   %edi
+  800f48:	56                   	push   %esi
+  800f49:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f52:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f57:	89 cb                	mov    %ecx,%ebx
+  800f59:	89 cf                	mov    %ecx,%edi
+  800f5b:	89 ce                	mov    %ecx,%esi
+  800f5d:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800f5f:	5b                   	pop    %ebx
+  800f60:	5e                   	pop    %esi
+  800f61:	5f                   	pop    %edi
+  800f62:	5d                   	pop    %ebp
+  800f63:	c3                   	ret
+
+00800f64 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800f64:	55                   	push   %ebp
+  800f65:	89 e5                	mov    %esp,%ebp
+  800f67:	57                   	push   %edi
+  800f68:	56                   	push   %esi
+  800f69:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f72:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f77:	89 cb                	mov    %ecx,%ebx
+  800f79:	89 cf                	mov    %ecx,%edi
+  800f7b:	55                   	push   %ebp
+  800f7c:	89 e5                	mov    %esp,%ebp
+  800f7e:	8d 35 86 0f 80 00    	lea    0x800f86,%esi
+  800f84:	0f 34                	sysenter
+  800f86:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800f87:	5b                   	pop    %ebx
+  800f88:	5e                   	pop    %esi
+  800f89:	5f                   	pop    %edi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+
+00800f8c <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	57                   	push   %edi
+  800f90:	56                   	push   %esi
+  800f91:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f92:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9a:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f9f:	89 cb                	mov    %ecx,%ebx
+  800fa1:	89 cf                	mov    %ecx,%edi
+  800fa3:	55                   	push   %ebp
+  800fa4:	89 e5                	mov    %esp,%ebp
+  800fa6:	8d 35 ae 0f 80 00    	lea    0x800fae,%esi
+  800fac:	0f 34                	sysenter
+  800fae:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800faf:	5b                   	pop    %ebx
+  800fb0:	5e                   	pop    %esi
+  800fb1:	5f                   	pop    %edi
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	c3                   	ret
+
+00800fb4 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800fb4:	55                   	push   %ebp
+  800fb5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fba:	05 00 00 00 30       	add    $0x30000000,%eax
+  800fbf:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800fc2:	5d                   	pop    %ebp
+  800fc3:	c3                   	ret
+
+00800fc4 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800fc4:	55                   	push   %ebp
+  800fc5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fca:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800fcf:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800fd4:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800fd9:	5d                   	pop    %ebp
+  800fda:	c3                   	ret
+
+00800fdb <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800fdb:	55                   	push   %ebp
+  800fdc:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800fde:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800fe3:	eb 02                	jmp    800fe7 <fd_alloc+0xc>
+  800fe5:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800fe7:	89 c2                	mov    %eax,%edx
+  800fe9:	c1 ea 16             	shr    $0x16,%edx
+  800fec:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800ff3:	f6 c2 01             	test   $0x1,%dl
+  800ff6:	74 2b                	je     801023 <fd_alloc+0x48>
+  800ff8:	89 c2                	mov    %eax,%edx
+  800ffa:	c1 ea 0c             	shr    $0xc,%edx
+  800ffd:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801004:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80100a:	f6 c1 01             	test   $0x1,%cl
+  80100d:	74 14                	je     801023 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80100f:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801015:	75 ce                	jne    800fe5 <fd_alloc+0xa>
+  801017:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80101c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801021:	eb 05                	jmp    801028 <fd_alloc+0x4d>
+			return 0;
+  801023:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801028:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102b:	89 02                	mov    %eax,(%edx)
+}
+  80102d:	89 c8                	mov    %ecx,%eax
+  80102f:	5d                   	pop    %ebp
+  801030:	c3                   	ret
+
+00801031 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801031:	55                   	push   %ebp
+  801032:	89 e5                	mov    %esp,%ebp
+  801034:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801037:	83 f8 1f             	cmp    $0x1f,%eax
+  80103a:	77 30                	ja     80106c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80103c:	c1 e0 0c             	shl    $0xc,%eax
+  80103f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801044:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80104a:	f6 c2 01             	test   $0x1,%dl
+  80104d:	74 24                	je     801073 <fd_lookup+0x42>
+  80104f:	89 c2                	mov    %eax,%edx
+  801051:	c1 ea 0c             	shr    $0xc,%edx
+  801054:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80105b:	f6 c2 01             	test   $0x1,%dl
+  80105e:	74 1a                	je     80107a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801060:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801063:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801065:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80106a:	5d                   	pop    %ebp
+  80106b:	c3                   	ret
+		return -E_INVAL;
+  80106c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801071:	eb f7                	jmp    80106a <fd_lookup+0x39>
+		return -E_INVAL;
+  801073:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801078:	eb f0                	jmp    80106a <fd_lookup+0x39>
+  80107a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80107f:	eb e9                	jmp    80106a <fd_lookup+0x39>
+
+00801081 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801081:	55                   	push   %ebp
+  801082:	89 e5                	mov    %esp,%ebp
+  801084:	53                   	push   %ebx
+  801085:	83 ec 04             	sub    $0x4,%esp
+  801088:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80108b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801090:	eb 03                	jmp    801095 <dev_lookup+0x14>
+  801092:	83 c0 01             	add    $0x1,%eax
+  801095:	8b 1c 85 f0 42 80 00 	mov    0x8042f0(,%eax,4),%ebx
+  80109c:	85 db                	test   %ebx,%ebx
+  80109e:	74 0b                	je     8010ab <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8010a0:	39 13                	cmp    %edx,(%ebx)
+  8010a2:	75 ee                	jne    801092 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8010a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a9:	eb 1f                	jmp    8010ca <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8010ab:	a1 00 60 80 00       	mov    0x806000,%eax
+  8010b0:	8b 40 48             	mov    0x48(%eax),%eax
+  8010b3:	83 ec 04             	sub    $0x4,%esp
+  8010b6:	52                   	push   %edx
+  8010b7:	50                   	push   %eax
+  8010b8:	68 74 42 80 00       	push   $0x804274
+  8010bd:	e8 f7 f0 ff ff       	call   8001b9 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8010c2:	83 c4 10             	add    $0x10,%esp
+  8010c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8010ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010cd:	89 1a                	mov    %ebx,(%edx)
+}
+  8010cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010d2:	c9                   	leave
+  8010d3:	c3                   	ret
+
+008010d4 <fd_close>:
+{
+  8010d4:	55                   	push   %ebp
+  8010d5:	89 e5                	mov    %esp,%ebp
+  8010d7:	57                   	push   %edi
+  8010d8:	56                   	push   %esi
+  8010d9:	53                   	push   %ebx
+  8010da:	83 ec 24             	sub    $0x24,%esp
+  8010dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010e0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8010e3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8010e6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010e7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8010ed:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8010f0:	50                   	push   %eax
+  8010f1:	e8 3b ff ff ff       	call   801031 <fd_lookup>
+  8010f6:	89 c3                	mov    %eax,%ebx
+  8010f8:	83 c4 10             	add    $0x10,%esp
+  8010fb:	85 c0                	test   %eax,%eax
+  8010fd:	78 05                	js     801104 <fd_close+0x30>
+	    || fd != fd2)
+  8010ff:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801102:	74 16                	je     80111a <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801104:	89 f8                	mov    %edi,%eax
+  801106:	84 c0                	test   %al,%al
+  801108:	b8 00 00 00 00       	mov    $0x0,%eax
+  80110d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801110:	89 d8                	mov    %ebx,%eax
+  801112:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801115:	5b                   	pop    %ebx
+  801116:	5e                   	pop    %esi
+  801117:	5f                   	pop    %edi
+  801118:	5d                   	pop    %ebp
+  801119:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80111a:	83 ec 08             	sub    $0x8,%esp
+  80111d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801120:	50                   	push   %eax
+  801121:	ff 36                	push   (%esi)
+  801123:	e8 59 ff ff ff       	call   801081 <dev_lookup>
+  801128:	89 c3                	mov    %eax,%ebx
+  80112a:	83 c4 10             	add    $0x10,%esp
+  80112d:	85 c0                	test   %eax,%eax
+  80112f:	78 1a                	js     80114b <fd_close+0x77>
+		if (dev->dev_close)
+  801131:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801134:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801137:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80113c:	85 c0                	test   %eax,%eax
+  80113e:	74 0b                	je     80114b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801140:	83 ec 0c             	sub    $0xc,%esp
+  801143:	56                   	push   %esi
+  801144:	ff d0                	call   *%eax
+  801146:	89 c3                	mov    %eax,%ebx
+  801148:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80114b:	83 ec 08             	sub    $0x8,%esp
+  80114e:	56                   	push   %esi
+  80114f:	6a 00                	push   $0x0
+  801151:	e8 ea fa ff ff       	call   800c40 <sys_page_unmap>
+	return r;
+  801156:	83 c4 10             	add    $0x10,%esp
+  801159:	eb b5                	jmp    801110 <fd_close+0x3c>
+
+0080115b <close>:
+
+int
+close(int fdnum)
+{
+  80115b:	55                   	push   %ebp
+  80115c:	89 e5                	mov    %esp,%ebp
+  80115e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801161:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801164:	50                   	push   %eax
+  801165:	ff 75 08             	push   0x8(%ebp)
+  801168:	e8 c4 fe ff ff       	call   801031 <fd_lookup>
+  80116d:	83 c4 10             	add    $0x10,%esp
+  801170:	85 c0                	test   %eax,%eax
+  801172:	79 02                	jns    801176 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801174:	c9                   	leave
+  801175:	c3                   	ret
+		return fd_close(fd, 1);
+  801176:	83 ec 08             	sub    $0x8,%esp
+  801179:	6a 01                	push   $0x1
+  80117b:	ff 75 f4             	push   -0xc(%ebp)
+  80117e:	e8 51 ff ff ff       	call   8010d4 <fd_close>
+  801183:	83 c4 10             	add    $0x10,%esp
+  801186:	eb ec                	jmp    801174 <close+0x19>
+
+00801188 <close_all>:
+
+void
+close_all(void)
+{
+  801188:	55                   	push   %ebp
+  801189:	89 e5                	mov    %esp,%ebp
+  80118b:	53                   	push   %ebx
+  80118c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80118f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801194:	83 ec 0c             	sub    $0xc,%esp
+  801197:	53                   	push   %ebx
+  801198:	e8 be ff ff ff       	call   80115b <close>
+	for (i = 0; i < MAXFD; i++)
+  80119d:	83 c3 01             	add    $0x1,%ebx
+  8011a0:	83 c4 10             	add    $0x10,%esp
+  8011a3:	83 fb 20             	cmp    $0x20,%ebx
+  8011a6:	75 ec                	jne    801194 <close_all+0xc>
+}
+  8011a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011ab:	c9                   	leave
+  8011ac:	c3                   	ret
+
+008011ad <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8011ad:	55                   	push   %ebp
+  8011ae:	89 e5                	mov    %esp,%ebp
+  8011b0:	57                   	push   %edi
+  8011b1:	56                   	push   %esi
+  8011b2:	53                   	push   %ebx
+  8011b3:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8011b6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011b9:	50                   	push   %eax
+  8011ba:	ff 75 08             	push   0x8(%ebp)
+  8011bd:	e8 6f fe ff ff       	call   801031 <fd_lookup>
+  8011c2:	89 c3                	mov    %eax,%ebx
+  8011c4:	83 c4 10             	add    $0x10,%esp
+  8011c7:	85 c0                	test   %eax,%eax
+  8011c9:	78 7f                	js     80124a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8011cb:	83 ec 0c             	sub    $0xc,%esp
+  8011ce:	ff 75 0c             	push   0xc(%ebp)
+  8011d1:	e8 85 ff ff ff       	call   80115b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8011d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8011d9:	c1 e6 0c             	shl    $0xc,%esi
+  8011dc:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8011e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8011e5:	89 3c 24             	mov    %edi,(%esp)
+  8011e8:	e8 d7 fd ff ff       	call   800fc4 <fd2data>
+  8011ed:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8011ef:	89 34 24             	mov    %esi,(%esp)
+  8011f2:	e8 cd fd ff ff       	call   800fc4 <fd2data>
+  8011f7:	83 c4 10             	add    $0x10,%esp
+  8011fa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8011fd:	89 d8                	mov    %ebx,%eax
+  8011ff:	c1 e8 16             	shr    $0x16,%eax
+  801202:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801209:	a8 01                	test   $0x1,%al
+  80120b:	74 11                	je     80121e <dup+0x71>
+  80120d:	89 d8                	mov    %ebx,%eax
+  80120f:	c1 e8 0c             	shr    $0xc,%eax
+  801212:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801219:	f6 c2 01             	test   $0x1,%dl
+  80121c:	75 36                	jne    801254 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80121e:	89 f8                	mov    %edi,%eax
+  801220:	c1 e8 0c             	shr    $0xc,%eax
+  801223:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80122a:	83 ec 0c             	sub    $0xc,%esp
+  80122d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801232:	50                   	push   %eax
+  801233:	56                   	push   %esi
+  801234:	6a 00                	push   $0x0
+  801236:	57                   	push   %edi
+  801237:	6a 00                	push   $0x0
+  801239:	e8 c0 f9 ff ff       	call   800bfe <sys_page_map>
+  80123e:	89 c3                	mov    %eax,%ebx
+  801240:	83 c4 20             	add    $0x20,%esp
+  801243:	85 c0                	test   %eax,%eax
+  801245:	78 33                	js     80127a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801247:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80124a:	89 d8                	mov    %ebx,%eax
+  80124c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124f:	5b                   	pop    %ebx
+  801250:	5e                   	pop    %esi
+  801251:	5f                   	pop    %edi
+  801252:	5d                   	pop    %ebp
+  801253:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801254:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80125b:	83 ec 0c             	sub    $0xc,%esp
+  80125e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801263:	50                   	push   %eax
+  801264:	ff 75 d4             	push   -0x2c(%ebp)
+  801267:	6a 00                	push   $0x0
+  801269:	53                   	push   %ebx
+  80126a:	6a 00                	push   $0x0
+  80126c:	e8 8d f9 ff ff       	call   800bfe <sys_page_map>
+  801271:	89 c3                	mov    %eax,%ebx
+  801273:	83 c4 20             	add    $0x20,%esp
+  801276:	85 c0                	test   %eax,%eax
+  801278:	79 a4                	jns    80121e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80127a:	83 ec 08             	sub    $0x8,%esp
+  80127d:	56                   	push   %esi
+  80127e:	6a 00                	push   $0x0
+  801280:	e8 bb f9 ff ff       	call   800c40 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801285:	83 c4 08             	add    $0x8,%esp
+  801288:	ff 75 d4             	push   -0x2c(%ebp)
+  80128b:	6a 00                	push   $0x0
+  80128d:	e8 ae f9 ff ff       	call   800c40 <sys_page_unmap>
+	return r;
+  801292:	83 c4 10             	add    $0x10,%esp
+  801295:	eb b3                	jmp    80124a <dup+0x9d>
+
+00801297 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801297:	55                   	push   %ebp
+  801298:	89 e5                	mov    %esp,%ebp
+  80129a:	56                   	push   %esi
+  80129b:	53                   	push   %ebx
+  80129c:	83 ec 18             	sub    $0x18,%esp
+  80129f:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8012a2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8012a5:	50                   	push   %eax
+  8012a6:	56                   	push   %esi
+  8012a7:	e8 85 fd ff ff       	call   801031 <fd_lookup>
+  8012ac:	83 c4 10             	add    $0x10,%esp
+  8012af:	85 c0                	test   %eax,%eax
+  8012b1:	78 3c                	js     8012ef <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012b3:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8012b6:	83 ec 08             	sub    $0x8,%esp
+  8012b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012bc:	50                   	push   %eax
+  8012bd:	ff 33                	push   (%ebx)
+  8012bf:	e8 bd fd ff ff       	call   801081 <dev_lookup>
+  8012c4:	83 c4 10             	add    $0x10,%esp
+  8012c7:	85 c0                	test   %eax,%eax
+  8012c9:	78 24                	js     8012ef <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8012cb:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012ce:	83 e0 03             	and    $0x3,%eax
+  8012d1:	83 f8 01             	cmp    $0x1,%eax
+  8012d4:	74 20                	je     8012f6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8012d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012d9:	8b 40 08             	mov    0x8(%eax),%eax
+  8012dc:	85 c0                	test   %eax,%eax
+  8012de:	74 37                	je     801317 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8012e0:	83 ec 04             	sub    $0x4,%esp
+  8012e3:	ff 75 10             	push   0x10(%ebp)
+  8012e6:	ff 75 0c             	push   0xc(%ebp)
+  8012e9:	53                   	push   %ebx
+  8012ea:	ff d0                	call   *%eax
+  8012ec:	83 c4 10             	add    $0x10,%esp
+}
+  8012ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012f2:	5b                   	pop    %ebx
+  8012f3:	5e                   	pop    %esi
+  8012f4:	5d                   	pop    %ebp
+  8012f5:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8012f6:	a1 00 60 80 00       	mov    0x806000,%eax
+  8012fb:	8b 40 48             	mov    0x48(%eax),%eax
+  8012fe:	83 ec 04             	sub    $0x4,%esp
+  801301:	56                   	push   %esi
+  801302:	50                   	push   %eax
+  801303:	68 b5 42 80 00       	push   $0x8042b5
+  801308:	e8 ac ee ff ff       	call   8001b9 <cprintf>
+		return -E_INVAL;
+  80130d:	83 c4 10             	add    $0x10,%esp
+  801310:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801315:	eb d8                	jmp    8012ef <read+0x58>
+		return -E_NOT_SUPP;
+  801317:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80131c:	eb d1                	jmp    8012ef <read+0x58>
+
+0080131e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80131e:	55                   	push   %ebp
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	57                   	push   %edi
+  801322:	56                   	push   %esi
+  801323:	53                   	push   %ebx
+  801324:	83 ec 0c             	sub    $0xc,%esp
+  801327:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80132a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80132d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801332:	eb 02                	jmp    801336 <readn+0x18>
+  801334:	01 c3                	add    %eax,%ebx
+  801336:	39 f3                	cmp    %esi,%ebx
+  801338:	73 21                	jae    80135b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80133a:	83 ec 04             	sub    $0x4,%esp
+  80133d:	89 f0                	mov    %esi,%eax
+  80133f:	29 d8                	sub    %ebx,%eax
+  801341:	50                   	push   %eax
+  801342:	89 d8                	mov    %ebx,%eax
+  801344:	03 45 0c             	add    0xc(%ebp),%eax
+  801347:	50                   	push   %eax
+  801348:	57                   	push   %edi
+  801349:	e8 49 ff ff ff       	call   801297 <read>
+		if (m < 0)
+  80134e:	83 c4 10             	add    $0x10,%esp
+  801351:	85 c0                	test   %eax,%eax
+  801353:	78 04                	js     801359 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801355:	75 dd                	jne    801334 <readn+0x16>
+  801357:	eb 02                	jmp    80135b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801359:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80135b:	89 d8                	mov    %ebx,%eax
+  80135d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801360:	5b                   	pop    %ebx
+  801361:	5e                   	pop    %esi
+  801362:	5f                   	pop    %edi
+  801363:	5d                   	pop    %ebp
+  801364:	c3                   	ret
+
+00801365 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801365:	55                   	push   %ebp
+  801366:	89 e5                	mov    %esp,%ebp
+  801368:	56                   	push   %esi
+  801369:	53                   	push   %ebx
+  80136a:	83 ec 18             	sub    $0x18,%esp
+  80136d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801370:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801373:	50                   	push   %eax
+  801374:	53                   	push   %ebx
+  801375:	e8 b7 fc ff ff       	call   801031 <fd_lookup>
+  80137a:	83 c4 10             	add    $0x10,%esp
+  80137d:	85 c0                	test   %eax,%eax
+  80137f:	78 37                	js     8013b8 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801381:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801384:	83 ec 08             	sub    $0x8,%esp
+  801387:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80138a:	50                   	push   %eax
+  80138b:	ff 36                	push   (%esi)
+  80138d:	e8 ef fc ff ff       	call   801081 <dev_lookup>
+  801392:	83 c4 10             	add    $0x10,%esp
+  801395:	85 c0                	test   %eax,%eax
+  801397:	78 1f                	js     8013b8 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801399:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80139d:	74 20                	je     8013bf <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80139f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013a2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8013a5:	85 c0                	test   %eax,%eax
+  8013a7:	74 37                	je     8013e0 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8013a9:	83 ec 04             	sub    $0x4,%esp
+  8013ac:	ff 75 10             	push   0x10(%ebp)
+  8013af:	ff 75 0c             	push   0xc(%ebp)
+  8013b2:	56                   	push   %esi
+  8013b3:	ff d0                	call   *%eax
+  8013b5:	83 c4 10             	add    $0x10,%esp
+}
+  8013b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013bb:	5b                   	pop    %ebx
+  8013bc:	5e                   	pop    %esi
+  8013bd:	5d                   	pop    %ebp
+  8013be:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013bf:	a1 00 60 80 00       	mov    0x806000,%eax
+  8013c4:	8b 40 48             	mov    0x48(%eax),%eax
+  8013c7:	83 ec 04             	sub    $0x4,%esp
+  8013ca:	53                   	push   %ebx
+  8013cb:	50                   	push   %eax
+  8013cc:	68 d1 42 80 00       	push   $0x8042d1
+  8013d1:	e8 e3 ed ff ff       	call   8001b9 <cprintf>
+		return -E_INVAL;
+  8013d6:	83 c4 10             	add    $0x10,%esp
+  8013d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013de:	eb d8                	jmp    8013b8 <write+0x53>
+		return -E_NOT_SUPP;
+  8013e0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013e5:	eb d1                	jmp    8013b8 <write+0x53>
+
+008013e7 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8013e7:	55                   	push   %ebp
+  8013e8:	89 e5                	mov    %esp,%ebp
+  8013ea:	53                   	push   %ebx
+  8013eb:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013ee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013f1:	50                   	push   %eax
+  8013f2:	ff 75 08             	push   0x8(%ebp)
+  8013f5:	e8 37 fc ff ff       	call   801031 <fd_lookup>
+  8013fa:	83 c4 10             	add    $0x10,%esp
+  8013fd:	85 c0                	test   %eax,%eax
+  8013ff:	78 3a                	js     80143b <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801401:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801404:	83 ec 08             	sub    $0x8,%esp
+  801407:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80140a:	50                   	push   %eax
+  80140b:	ff 33                	push   (%ebx)
+  80140d:	e8 6f fc ff ff       	call   801081 <dev_lookup>
+  801412:	83 c4 10             	add    $0x10,%esp
+  801415:	85 c0                	test   %eax,%eax
+  801417:	78 22                	js     80143b <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801419:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80141c:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80141f:	85 c0                	test   %eax,%eax
+  801421:	74 0d                	je     801430 <seek+0x49>
+  801423:	83 ec 0c             	sub    $0xc,%esp
+  801426:	53                   	push   %ebx
+  801427:	ff d0                	call   *%eax
+  801429:	83 c4 10             	add    $0x10,%esp
+  80142c:	85 c0                	test   %eax,%eax
+  80142e:	78 0b                	js     80143b <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801430:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801433:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801436:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80143b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80143e:	c9                   	leave
+  80143f:	c3                   	ret
+
+00801440 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801440:	55                   	push   %ebp
+  801441:	89 e5                	mov    %esp,%ebp
+  801443:	53                   	push   %ebx
+  801444:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801447:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80144a:	50                   	push   %eax
+  80144b:	ff 75 08             	push   0x8(%ebp)
+  80144e:	e8 de fb ff ff       	call   801031 <fd_lookup>
+  801453:	83 c4 10             	add    $0x10,%esp
+  801456:	85 c0                	test   %eax,%eax
+  801458:	78 2b                	js     801485 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80145a:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80145d:	83 ec 08             	sub    $0x8,%esp
+  801460:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801463:	50                   	push   %eax
+  801464:	ff 33                	push   (%ebx)
+  801466:	e8 16 fc ff ff       	call   801081 <dev_lookup>
+  80146b:	83 c4 10             	add    $0x10,%esp
+  80146e:	85 c0                	test   %eax,%eax
+  801470:	78 13                	js     801485 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801472:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801475:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801478:	85 c0                	test   %eax,%eax
+  80147a:	74 0e                	je     80148a <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  80147c:	83 ec 0c             	sub    $0xc,%esp
+  80147f:	53                   	push   %ebx
+  801480:	ff d0                	call   *%eax
+  801482:	83 c4 10             	add    $0x10,%esp
+}
+  801485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801488:	c9                   	leave
+  801489:	c3                   	ret
+		return 0;
+  80148a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148f:	eb f4                	jmp    801485 <fsync+0x45>
+
+00801491 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801491:	55                   	push   %ebp
+  801492:	89 e5                	mov    %esp,%ebp
+  801494:	56                   	push   %esi
+  801495:	53                   	push   %ebx
+  801496:	83 ec 18             	sub    $0x18,%esp
+  801499:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80149c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80149f:	50                   	push   %eax
+  8014a0:	53                   	push   %ebx
+  8014a1:	e8 8b fb ff ff       	call   801031 <fd_lookup>
+  8014a6:	83 c4 10             	add    $0x10,%esp
+  8014a9:	85 c0                	test   %eax,%eax
+  8014ab:	78 34                	js     8014e1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014ad:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014b0:	83 ec 08             	sub    $0x8,%esp
+  8014b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014b6:	50                   	push   %eax
+  8014b7:	ff 36                	push   (%esi)
+  8014b9:	e8 c3 fb ff ff       	call   801081 <dev_lookup>
+  8014be:	83 c4 10             	add    $0x10,%esp
+  8014c1:	85 c0                	test   %eax,%eax
+  8014c3:	78 1c                	js     8014e1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014c5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014c9:	74 1d                	je     8014e8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8014cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014ce:	8b 40 18             	mov    0x18(%eax),%eax
+  8014d1:	85 c0                	test   %eax,%eax
+  8014d3:	74 34                	je     801509 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8014d5:	83 ec 08             	sub    $0x8,%esp
+  8014d8:	ff 75 0c             	push   0xc(%ebp)
+  8014db:	56                   	push   %esi
+  8014dc:	ff d0                	call   *%eax
+  8014de:	83 c4 10             	add    $0x10,%esp
+}
+  8014e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014e4:	5b                   	pop    %ebx
+  8014e5:	5e                   	pop    %esi
+  8014e6:	5d                   	pop    %ebp
+  8014e7:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8014e8:	a1 00 60 80 00       	mov    0x806000,%eax
+  8014ed:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8014f0:	83 ec 04             	sub    $0x4,%esp
+  8014f3:	53                   	push   %ebx
+  8014f4:	50                   	push   %eax
+  8014f5:	68 94 42 80 00       	push   $0x804294
+  8014fa:	e8 ba ec ff ff       	call   8001b9 <cprintf>
+		return -E_INVAL;
+  8014ff:	83 c4 10             	add    $0x10,%esp
+  801502:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801507:	eb d8                	jmp    8014e1 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801509:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80150e:	eb d1                	jmp    8014e1 <ftruncate+0x50>
+
+00801510 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801510:	55                   	push   %ebp
+  801511:	89 e5                	mov    %esp,%ebp
+  801513:	56                   	push   %esi
+  801514:	53                   	push   %ebx
+  801515:	83 ec 18             	sub    $0x18,%esp
+  801518:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80151b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80151e:	50                   	push   %eax
+  80151f:	ff 75 08             	push   0x8(%ebp)
+  801522:	e8 0a fb ff ff       	call   801031 <fd_lookup>
+  801527:	83 c4 10             	add    $0x10,%esp
+  80152a:	85 c0                	test   %eax,%eax
+  80152c:	78 49                	js     801577 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80152e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801531:	83 ec 08             	sub    $0x8,%esp
+  801534:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801537:	50                   	push   %eax
+  801538:	ff 36                	push   (%esi)
+  80153a:	e8 42 fb ff ff       	call   801081 <dev_lookup>
+  80153f:	83 c4 10             	add    $0x10,%esp
+  801542:	85 c0                	test   %eax,%eax
+  801544:	78 31                	js     801577 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801546:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801549:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80154d:	74 2f                	je     80157e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80154f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801552:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801559:	00 00 00 
+	stat->st_isdir = 0;
+  80155c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801563:	00 00 00 
+	stat->st_dev = dev;
+  801566:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80156c:	83 ec 08             	sub    $0x8,%esp
+  80156f:	53                   	push   %ebx
+  801570:	56                   	push   %esi
+  801571:	ff 50 14             	call   *0x14(%eax)
+  801574:	83 c4 10             	add    $0x10,%esp
+}
+  801577:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80157a:	5b                   	pop    %ebx
+  80157b:	5e                   	pop    %esi
+  80157c:	5d                   	pop    %ebp
+  80157d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80157e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801583:	eb f2                	jmp    801577 <fstat+0x67>
+
+00801585 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801585:	55                   	push   %ebp
+  801586:	89 e5                	mov    %esp,%ebp
+  801588:	56                   	push   %esi
+  801589:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  80158a:	83 ec 08             	sub    $0x8,%esp
+  80158d:	68 00 10 00 00       	push   $0x1000
+  801592:	ff 75 08             	push   0x8(%ebp)
+  801595:	e8 b3 07 00 00       	call   801d4d <open>
+  80159a:	89 c3                	mov    %eax,%ebx
+  80159c:	83 c4 10             	add    $0x10,%esp
+  80159f:	85 c0                	test   %eax,%eax
+  8015a1:	78 1b                	js     8015be <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  8015a3:	83 ec 08             	sub    $0x8,%esp
+  8015a6:	ff 75 0c             	push   0xc(%ebp)
+  8015a9:	50                   	push   %eax
+  8015aa:	e8 61 ff ff ff       	call   801510 <fstat>
+  8015af:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8015b1:	89 1c 24             	mov    %ebx,(%esp)
+  8015b4:	e8 a2 fb ff ff       	call   80115b <close>
+	return r;
+  8015b9:	83 c4 10             	add    $0x10,%esp
+  8015bc:	89 f3                	mov    %esi,%ebx
+}
+  8015be:	89 d8                	mov    %ebx,%eax
+  8015c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015c3:	5b                   	pop    %ebx
+  8015c4:	5e                   	pop    %esi
+  8015c5:	5d                   	pop    %ebp
+  8015c6:	c3                   	ret
+
+008015c7 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  8015c7:	55                   	push   %ebp
+  8015c8:	89 e5                	mov    %esp,%ebp
+  8015ca:	57                   	push   %edi
+  8015cb:	56                   	push   %esi
+  8015cc:	53                   	push   %ebx
+  8015cd:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  8015d3:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  8015d9:	89 d6                	mov    %edx,%esi
+  8015db:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  8015e1:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  8015e4:	89 d3                	mov    %edx,%ebx
+  8015e6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  8015ec:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  8015f3:	74 1d                	je     801612 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8015f5:	b8 00 70 80 00       	mov    $0x807000,%eax
+  8015fa:	83 c8 07             	or     $0x7,%eax
+  8015fd:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801603:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801608:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  80160e:	01 ce                	add    %ecx,%esi
+  801610:	eb 28                	jmp    80163a <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801612:	83 ec 0c             	sub    $0xc,%esp
+  801615:	6a 01                	push   $0x1
+  801617:	e8 23 25 00 00       	call   803b3f <ipc_find_env>
+  80161c:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801621:	83 c4 10             	add    $0x10,%esp
+  801624:	eb cf                	jmp    8015f5 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801626:	83 c0 01             	add    $0x1,%eax
+  801629:	89 fa                	mov    %edi,%edx
+  80162b:	09 da                	or     %ebx,%edx
+  80162d:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801634:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80163a:	39 f3                	cmp    %esi,%ebx
+  80163c:	72 e8                	jb     801626 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  80163e:	83 f8 41             	cmp    $0x41,%eax
+  801641:	77 2f                	ja     801672 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801643:	50                   	push   %eax
+  801644:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  80164a:	50                   	push   %eax
+  80164b:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801651:	ff 35 c8 80 80 00    	push   0x8080c8
+  801657:	e8 95 24 00 00       	call   803af1 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  80165c:	83 c4 0c             	add    $0xc,%esp
+  80165f:	6a 00                	push   $0x0
+  801661:	6a 00                	push   $0x0
+  801663:	6a 00                	push   $0x0
+  801665:	e8 31 23 00 00       	call   80399b <ipc_recv>
+}
+  80166a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80166d:	5b                   	pop    %ebx
+  80166e:	5e                   	pop    %esi
+  80166f:	5f                   	pop    %edi
+  801670:	5d                   	pop    %ebp
+  801671:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801672:	68 04 43 80 00       	push   $0x804304
+  801677:	68 20 43 80 00       	push   $0x804320
+  80167c:	6a 40                	push   $0x40
+  80167e:	68 35 43 80 00       	push   $0x804335
+  801683:	e8 56 ea ff ff       	call   8000de <_panic>
+
+00801688 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801688:	55                   	push   %ebp
+  801689:	89 e5                	mov    %esp,%ebp
+  80168b:	57                   	push   %edi
+  80168c:	56                   	push   %esi
+  80168d:	53                   	push   %ebx
+  80168e:	83 ec 1c             	sub    $0x1c,%esp
+  801691:	89 c3                	mov    %eax,%ebx
+  801693:	89 d6                	mov    %edx,%esi
+  801695:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801698:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  80169e:	89 ca                	mov    %ecx,%edx
+  8016a0:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  8016a3:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  8016aa:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8016ad:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  8016b4:	8b 76 0c             	mov    0xc(%esi),%esi
+  8016b7:	89 fb                	mov    %edi,%ebx
+  8016b9:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  8016c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8016c3:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  8016ca:	8b 75 08             	mov    0x8(%ebp),%esi
+  8016cd:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  8016d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016d7:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  8016de:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  8016e1:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  8016e8:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  8016ed:	39 c8                	cmp    %ecx,%eax
+  8016ef:	74 0d                	je     8016fe <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  8016f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f9:	5b                   	pop    %ebx
+  8016fa:	5e                   	pop    %esi
+  8016fb:	5f                   	pop    %edi
+  8016fc:	5d                   	pop    %ebp
+  8016fd:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016fe:	6a 07                	push   $0x7
+  801700:	68 00 70 80 00       	push   $0x807000
+  801705:	6a 0d                	push   $0xd
+  801707:	ff 35 c8 80 80 00    	push   0x8080c8
+  80170d:	e8 f4 22 00 00       	call   803a06 <ipc_send>
+  801712:	83 c4 10             	add    $0x10,%esp
+  801715:	eb da                	jmp    8016f1 <fsring_post+0x69>
+
+00801717 <fsipcv>:
+{
+  801717:	55                   	push   %ebp
+  801718:	89 e5                	mov    %esp,%ebp
+  80171a:	57                   	push   %edi
+  80171b:	56                   	push   %esi
+  80171c:	53                   	push   %ebx
+  80171d:	83 ec 0c             	sub    $0xc,%esp
+  801720:	89 c7                	mov    %eax,%edi
+  801722:	89 d3                	mov    %edx,%ebx
+  801724:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801726:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  80172d:	74 26                	je     801755 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80172f:	6a 07                	push   $0x7
+  801731:	68 00 70 80 00       	push   $0x807000
+  801736:	57                   	push   %edi
+  801737:	ff 35 c8 80 80 00    	push   0x8080c8
+  80173d:	e8 c4 22 00 00       	call   803a06 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801742:	6a 00                	push   $0x0
+  801744:	56                   	push   %esi
+  801745:	53                   	push   %ebx
+  801746:	6a 00                	push   $0x0
+  801748:	e8 11 23 00 00       	call   803a5e <ipc_recvv>
+}
+  80174d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801750:	5b                   	pop    %ebx
+  801751:	5e                   	pop    %esi
+  801752:	5f                   	pop    %edi
+  801753:	5d                   	pop    %ebp
+  801754:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801755:	83 ec 0c             	sub    $0xc,%esp
+  801758:	6a 01                	push   $0x1
+  80175a:	e8 e0 23 00 00       	call   803b3f <ipc_find_env>
+  80175f:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801764:	83 c4 10             	add    $0x10,%esp
+  801767:	eb c6                	jmp    80172f <fsipcv+0x18>
+
+00801769 <fsipc>:
+{
+  801769:	55                   	push   %ebp
+  80176a:	89 e5                	mov    %esp,%ebp
+  80176c:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  80176f:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801776:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801779:	e8 99 ff ff ff       	call   801717 <fsipcv>
+}
+  80177e:	c9                   	leave
+  80177f:	c3                   	ret
+
+00801780 <file_write_direct>:
+{
+  801780:	55                   	push   %ebp
+  801781:	89 e5                	mov    %esp,%ebp
+  801783:	56                   	push   %esi
+  801784:	53                   	push   %ebx
+  801785:	89 c3                	mov    %eax,%ebx
+  801787:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801789:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  80178f:	77 40                	ja     8017d1 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801791:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801796:	39 c8                	cmp    %ecx,%eax
+  801798:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80179b:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  80179e:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  8017a4:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8017a9:	83 ec 04             	sub    $0x4,%esp
+  8017ac:	50                   	push   %eax
+  8017ad:	52                   	push   %edx
+  8017ae:	68 08 70 80 00       	push   $0x807008
+  8017b3:	e8 75 f1 ff ff       	call   80092d <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8017b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017bd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8017c2:	e8 a2 ff ff ff       	call   801769 <fsipc>
+  8017c7:	83 c4 10             	add    $0x10,%esp
+}
+  8017ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017cd:	5b                   	pop    %ebx
+  8017ce:	5e                   	pop    %esi
+  8017cf:	5d                   	pop    %ebp
+  8017d0:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8017d1:	89 d6                	mov    %edx,%esi
+  8017d3:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8017d9:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8017de:	29 f1                	sub    %esi,%ecx
+  8017e0:	39 c1                	cmp    %eax,%ecx
+  8017e2:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  8017e5:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8017e8:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  8017ed:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8017f3:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  8017f9:	83 ec 0c             	sub    $0xc,%esp
+  8017fc:	6a 05                	push   $0x5
+  8017fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801803:	e8 bf fd ff ff       	call   8015c7 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801808:	83 c4 10             	add    $0x10,%esp
+  80180b:	eb bd                	jmp    8017ca <file_write_direct+0x4a>
+
+0080180d <devfile_sync>:
+{
+  80180d:	55                   	push   %ebp
+  80180e:	89 e5                	mov    %esp,%ebp
+  801810:	57                   	push   %edi
+  801811:	56                   	push   %esi
+  801812:	53                   	push   %ebx
+  801813:	83 ec 28             	sub    $0x28,%esp
+  801816:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801819:	56                   	push   %esi
+  80181a:	e8 a5 f7 ff ff       	call   800fc4 <fd2data>
+  80181f:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801821:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801824:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  80182b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80182e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801833:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801837:	74 45                	je     80187e <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801839:	8b 46 14             	mov    0x14(%esi),%eax
+  80183c:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80183f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801844:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801849:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  80184c:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  80184f:	39 cb                	cmp    %ecx,%ebx
+  801851:	73 14                	jae    801867 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801853:	29 d9                	sub    %ebx,%ecx
+  801855:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801858:	89 f0                	mov    %esi,%eax
+  80185a:	e8 21 ff ff ff       	call   801780 <file_write_direct>
+  80185f:	85 c0                	test   %eax,%eax
+  801861:	7e 04                	jle    801867 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801863:	01 c3                	add    %eax,%ebx
+  801865:	eb e5                	jmp    80184c <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801867:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80186a:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801871:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801874:	85 c0                	test   %eax,%eax
+  801876:	ba 00 00 00 00       	mov    $0x0,%edx
+  80187b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  80187e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801881:	5b                   	pop    %ebx
+  801882:	5e                   	pop    %esi
+  801883:	5f                   	pop    %edi
+  801884:	5d                   	pop    %ebp
+  801885:	c3                   	ret
+
+00801886 <devfile_write>:
+{
+  801886:	55                   	push   %ebp
+  801887:	89 e5                	mov    %esp,%ebp
+  801889:	57                   	push   %edi
+  80188a:	56                   	push   %esi
+  80188b:	53                   	push   %ebx
+  80188c:	83 ec 28             	sub    $0x28,%esp
+  80188f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801892:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801895:	53                   	push   %ebx
+  801896:	e8 29 f7 ff ff       	call   800fc4 <fd2data>
+  80189b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  80189e:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8018a1:	83 c4 10             	add    $0x10,%esp
+  8018a4:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8018a8:	74 43                	je     8018ed <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  8018aa:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  8018b1:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8018b4:	85 c0                	test   %eax,%eax
+  8018b6:	74 43                	je     8018fb <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  8018b8:	89 c2                	mov    %eax,%edx
+  8018ba:	03 53 14             	add    0x14(%ebx),%edx
+  8018bd:	39 fa                	cmp    %edi,%edx
+  8018bf:	75 0b                	jne    8018cc <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  8018c1:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  8018c4:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  8018ca:	76 66                	jbe    801932 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  8018cc:	83 ec 0c             	sub    $0xc,%esp
+  8018cf:	53                   	push   %ebx
+  8018d0:	e8 38 ff ff ff       	call   80180d <devfile_sync>
+  8018d5:	83 c4 10             	add    $0x10,%esp
+  8018d8:	85 c0                	test   %eax,%eax
+  8018da:	78 4e                	js     80192a <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8018dc:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8018e2:	77 56                	ja     80193a <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  8018e4:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8018e7:	85 c0                	test   %eax,%eax
+  8018e9:	75 20                	jne    80190b <devfile_write+0x85>
+  8018eb:	eb 16                	jmp    801903 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  8018ed:	89 f1                	mov    %esi,%ecx
+  8018ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018f2:	89 d8                	mov    %ebx,%eax
+  8018f4:	e8 87 fe ff ff       	call   801780 <file_write_direct>
+  8018f9:	eb 2f                	jmp    80192a <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8018fb:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801901:	77 37                	ja     80193a <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801903:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801906:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  80190b:	83 ec 04             	sub    $0x4,%esp
+  80190e:	56                   	push   %esi
+  80190f:	ff 75 0c             	push   0xc(%ebp)
+  801912:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801915:	01 c1                	add    %eax,%ecx
+  801917:	51                   	push   %ecx
+  801918:	e8 10 f0 ff ff       	call   80092d <memmove>
+	ff->buf_wlen += n;
+  80191d:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801920:	01 f7                	add    %esi,%edi
+  801922:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801925:	89 f0                	mov    %esi,%eax
+  801927:	83 c4 10             	add    $0x10,%esp
+}
+  80192a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80192d:	5b                   	pop    %ebx
+  80192e:	5e                   	pop    %esi
+  80192f:	5f                   	pop    %edi
+  801930:	5d                   	pop    %ebp
+  801931:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801932:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801938:	76 d1                	jbe    80190b <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  80193a:	89 f1                	mov    %esi,%ecx
+  80193c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80193f:	89 d8                	mov    %ebx,%eax
+  801941:	e8 3a fe ff ff       	call   801780 <file_write_direct>
+  801946:	eb e2                	jmp    80192a <devfile_write+0xa4>
+
+00801948 <devfile_trunc>:
+{
+  801948:	55                   	push   %ebp
+  801949:	89 e5                	mov    %esp,%ebp
+  80194b:	53                   	push   %ebx
+  80194c:	83 ec 10             	sub    $0x10,%esp
+  80194f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801952:	53                   	push   %ebx
+  801953:	e8 b5 fe ff ff       	call   80180d <devfile_sync>
+  801958:	83 c4 10             	add    $0x10,%esp
+  80195b:	85 c0                	test   %eax,%eax
+  80195d:	78 1f                	js     80197e <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80195f:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801962:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801967:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80196a:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80196f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801974:	b8 02 00 00 00       	mov    $0x2,%eax
+  801979:	e8 eb fd ff ff       	call   801769 <fsipc>
+}
+  80197e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801981:	c9                   	leave
+  801982:	c3                   	ret
+
+00801983 <devfile_stat>:
+{
+  801983:	55                   	push   %ebp
+  801984:	89 e5                	mov    %esp,%ebp
+  801986:	56                   	push   %esi
+  801987:	53                   	push   %ebx
+  801988:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80198b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  80198e:	83 ec 0c             	sub    $0xc,%esp
+  801991:	53                   	push   %ebx
+  801992:	e8 76 fe ff ff       	call   80180d <devfile_sync>
+  801997:	83 c4 10             	add    $0x10,%esp
+  80199a:	85 c0                	test   %eax,%eax
+  80199c:	78 47                	js     8019e5 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80199e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8019a1:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ab:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019b0:	e8 b4 fd ff ff       	call   801769 <fsipc>
+  8019b5:	85 c0                	test   %eax,%eax
+  8019b7:	78 2c                	js     8019e5 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019b9:	83 ec 08             	sub    $0x8,%esp
+  8019bc:	68 00 70 80 00       	push   $0x807000
+  8019c1:	56                   	push   %esi
+  8019c2:	e8 e0 ed ff ff       	call   8007a7 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019c7:	a1 80 70 80 00       	mov    0x807080,%eax
+  8019cc:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019d2:	a1 84 70 80 00       	mov    0x807084,%eax
+  8019d7:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  8019dd:	83 c4 10             	add    $0x10,%esp
+  8019e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019e8:	5b                   	pop    %ebx
+  8019e9:	5e                   	pop    %esi
+  8019ea:	5d                   	pop    %ebp
+  8019eb:	c3                   	ret
+
+008019ec <devfile_flush>:
+{
+  8019ec:	55                   	push   %ebp
+  8019ed:	89 e5                	mov    %esp,%ebp
+  8019ef:	56                   	push   %esi
+  8019f0:	53                   	push   %ebx
+  8019f1:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  8019f4:	83 ec 0c             	sub    $0xc,%esp
+  8019f7:	56                   	push   %esi
+  8019f8:	e8 10 fe ff ff       	call   80180d <devfile_sync>
+  8019fd:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  8019ff:	83 c4 10             	add    $0x10,%esp
+  801a02:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801a06:	75 25                	jne    801a2d <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a08:	8b 46 0c             	mov    0xc(%esi),%eax
+  801a0b:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801a10:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a15:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a1a:	e8 4a fd ff ff       	call   801769 <fsipc>
+  801a1f:	85 c0                	test   %eax,%eax
+  801a21:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801a24:	89 d8                	mov    %ebx,%eax
+  801a26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a29:	5b                   	pop    %ebx
+  801a2a:	5e                   	pop    %esi
+  801a2b:	5d                   	pop    %ebp
+  801a2c:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801a2d:	83 ec 0c             	sub    $0xc,%esp
+  801a30:	56                   	push   %esi
+  801a31:	e8 8e f5 ff ff       	call   800fc4 <fd2data>
+  801a36:	83 c4 08             	add    $0x8,%esp
+  801a39:	50                   	push   %eax
+  801a3a:	6a 00                	push   $0x0
+  801a3c:	e8 ff f1 ff ff       	call   800c40 <sys_page_unmap>
+  801a41:	83 c4 10             	add    $0x10,%esp
+  801a44:	eb c2                	jmp    801a08 <devfile_flush+0x1c>
+
+00801a46 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801a46:	55                   	push   %ebp
+  801a47:	89 e5                	mov    %esp,%ebp
+  801a49:	57                   	push   %edi
+  801a4a:	56                   	push   %esi
+  801a4b:	53                   	push   %ebx
+  801a4c:	83 ec 64             	sub    $0x64,%esp
+  801a4f:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801a51:	52                   	push   %edx
+  801a52:	50                   	push   %eax
+  801a53:	e8 d9 f5 ff ff       	call   801031 <fd_lookup>
+  801a58:	89 c1                	mov    %eax,%ecx
+  801a5a:	83 c4 10             	add    $0x10,%esp
+  801a5d:	85 c0                	test   %eax,%eax
+  801a5f:	0f 88 f2 00 00 00    	js     801b57 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801a65:	8b 07                	mov    (%edi),%eax
+  801a67:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801a6d:	39 10                	cmp    %edx,(%eax)
+  801a6f:	0f 85 03 01 00 00    	jne    801b78 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801a75:	a1 00 60 80 00       	mov    0x806000,%eax
+  801a7a:	8b 40 48             	mov    0x48(%eax),%eax
+  801a7d:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  801a83:	0f 84 96 00 00 00    	je     801b1f <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801a89:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801a90:	0f 84 cb 00 00 00    	je     801b61 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a96:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801a9b:	83 c8 07             	or     $0x7,%eax
+  801a9e:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801aa1:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801aa4:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801aa9:	83 ec 04             	sub    $0x4,%esp
+  801aac:	68 07 04 00 00       	push   $0x407
+  801ab1:	53                   	push   %ebx
+  801ab2:	6a 00                	push   $0x0
+  801ab4:	e8 fa f0 ff ff       	call   800bb3 <sys_page_alloc>
+  801ab9:	89 c1                	mov    %eax,%ecx
+  801abb:	83 c4 10             	add    $0x10,%esp
+  801abe:	85 c0                	test   %eax,%eax
+  801ac0:	0f 88 91 00 00 00    	js     801b57 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801ac6:	89 d8                	mov    %ebx,%eax
+  801ac8:	83 c8 07             	or     $0x7,%eax
+  801acb:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801acd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ad3:	83 c6 04             	add    $0x4,%esi
+  801ad6:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801adc:	75 cb                	jne    801aa9 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801ade:	6a 12                	push   $0x12
+  801ae0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801ae3:	50                   	push   %eax
+  801ae4:	6a 0c                	push   $0xc
+  801ae6:	ff 35 c8 80 80 00    	push   0x8080c8
+  801aec:	e8 00 20 00 00       	call   803af1 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801af1:	83 c4 0c             	add    $0xc,%esp
+  801af4:	6a 00                	push   $0x0
+  801af6:	6a 00                	push   $0x0
+  801af8:	6a 00                	push   $0x0
+  801afa:	e8 9c 1e 00 00       	call   80399b <ipc_recv>
+  801aff:	89 c1                	mov    %eax,%ecx
+  801b01:	83 c4 10             	add    $0x10,%esp
+  801b04:	85 c0                	test   %eax,%eax
+  801b06:	78 4f                	js     801b57 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801b08:	a1 00 60 80 00       	mov    0x806000,%eax
+  801b0d:	8b 40 48             	mov    0x48(%eax),%eax
+  801b10:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  801b15:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  801b1c:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801b1f:	83 ec 0c             	sub    $0xc,%esp
+  801b22:	ff 37                	push   (%edi)
+  801b24:	e8 e4 fc ff ff       	call   80180d <devfile_sync>
+  801b29:	89 c1                	mov    %eax,%ecx
+  801b2b:	83 c4 10             	add    $0x10,%esp
+  801b2e:	85 c0                	test   %eax,%eax
+  801b30:	78 25                	js     801b57 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801b32:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801b38:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801b3d:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b42:	89 d0                	mov    %edx,%eax
+  801b44:	d3 e0                	shl    %cl,%eax
+  801b46:	85 d8                	test   %ebx,%eax
+  801b48:	74 0d                	je     801b57 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801b4a:	83 c1 01             	add    $0x1,%ecx
+  801b4d:	83 f9 10             	cmp    $0x10,%ecx
+  801b50:	75 f0                	jne    801b42 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801b52:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801b57:	89 c8                	mov    %ecx,%eax
+  801b59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b5c:	5b                   	pop    %ebx
+  801b5d:	5e                   	pop    %esi
+  801b5e:	5f                   	pop    %edi
+  801b5f:	5d                   	pop    %ebp
+  801b60:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b61:	83 ec 0c             	sub    $0xc,%esp
+  801b64:	6a 01                	push   $0x1
+  801b66:	e8 d4 1f 00 00       	call   803b3f <ipc_find_env>
+  801b6b:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801b70:	83 c4 10             	add    $0x10,%esp
+  801b73:	e9 1e ff ff ff       	jmp    801a96 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801b78:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801b7d:	eb d8                	jmp    801b57 <fsring_slot+0x111>
+
+00801b7f <file_read_direct>:
+{
+  801b7f:	55                   	push   %ebp
+  801b80:	89 e5                	mov    %esp,%ebp
+  801b82:	57                   	push   %edi
+  801b83:	56                   	push   %esi
+  801b84:	53                   	push   %ebx
+  801b85:	83 ec 1c             	sub    $0x1c,%esp
+  801b88:	89 c7                	mov    %eax,%edi
+  801b8a:	89 d6                	mov    %edx,%esi
+  801b8c:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801b8e:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801b94:	77 52                	ja     801be8 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b96:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b99:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801b9e:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ba4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba9:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bae:	e8 b6 fb ff ff       	call   801769 <fsipc>
+  801bb3:	89 c7                	mov    %eax,%edi
+  801bb5:	85 c0                	test   %eax,%eax
+  801bb7:	78 25                	js     801bde <file_read_direct+0x5f>
+	assert(r <= n);
+  801bb9:	39 c3                	cmp    %eax,%ebx
+  801bbb:	0f 82 87 00 00 00    	jb     801c48 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801bc1:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801bc6:	0f 8f 95 00 00 00    	jg     801c61 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801bcc:	83 ec 04             	sub    $0x4,%esp
+  801bcf:	50                   	push   %eax
+  801bd0:	68 00 70 80 00       	push   $0x807000
+  801bd5:	56                   	push   %esi
+  801bd6:	e8 52 ed ff ff       	call   80092d <memmove>
+	return r;
+  801bdb:	83 c4 10             	add    $0x10,%esp
+}
+  801bde:	89 f8                	mov    %edi,%eax
+  801be0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801be3:	5b                   	pop    %ebx
+  801be4:	5e                   	pop    %esi
+  801be5:	5f                   	pop    %edi
+  801be6:	5d                   	pop    %ebp
+  801be7:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801be8:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801bee:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801bf3:	29 d1                	sub    %edx,%ecx
+  801bf5:	39 d9                	cmp    %ebx,%ecx
+  801bf7:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801bfa:	89 f0                	mov    %esi,%eax
+  801bfc:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801bff:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801c02:	eb 0f                	jmp    801c13 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801c04:	0f b6 10             	movzbl (%eax),%edx
+  801c07:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801c09:	05 00 10 00 00       	add    $0x1000,%eax
+  801c0e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c13:	39 c8                	cmp    %ecx,%eax
+  801c15:	72 ed                	jb     801c04 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801c17:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c1a:	8b 47 0c             	mov    0xc(%edi),%eax
+  801c1d:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801c22:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801c28:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801c2e:	83 ec 0c             	sub    $0xc,%esp
+  801c31:	6a 07                	push   $0x7
+  801c33:	89 d9                	mov    %ebx,%ecx
+  801c35:	89 f2                	mov    %esi,%edx
+  801c37:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c3c:	e8 86 f9 ff ff       	call   8015c7 <fsipc_pages>
+  801c41:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801c43:	83 c4 10             	add    $0x10,%esp
+  801c46:	eb 96                	jmp    801bde <file_read_direct+0x5f>
+	assert(r <= n);
+  801c48:	68 40 43 80 00       	push   $0x804340
+  801c4d:	68 20 43 80 00       	push   $0x804320
+  801c52:	68 dc 00 00 00       	push   $0xdc
+  801c57:	68 35 43 80 00       	push   $0x804335
+  801c5c:	e8 7d e4 ff ff       	call   8000de <_panic>
+	assert(r <= PGSIZE);
+  801c61:	68 51 43 80 00       	push   $0x804351
+  801c66:	68 20 43 80 00       	push   $0x804320
+  801c6b:	68 dd 00 00 00       	push   $0xdd
+  801c70:	68 35 43 80 00       	push   $0x804335
+  801c75:	e8 64 e4 ff ff       	call   8000de <_panic>
+
+00801c7a <devfile_read>:
+{
+  801c7a:	55                   	push   %ebp
+  801c7b:	89 e5                	mov    %esp,%ebp
+  801c7d:	57                   	push   %edi
+  801c7e:	56                   	push   %esi
+  801c7f:	53                   	push   %ebx
+  801c80:	83 ec 28             	sub    $0x28,%esp
+  801c83:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c86:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801c89:	53                   	push   %ebx
+  801c8a:	e8 35 f3 ff ff       	call   800fc4 <fd2data>
+  801c8f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801c92:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801c95:	83 c4 10             	add    $0x10,%esp
+  801c98:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801c9c:	74 7d                	je     801d1b <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801c9e:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801ca2:	0f 85 81 00 00 00    	jne    801d29 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801ca8:	8b 43 18             	mov    0x18(%ebx),%eax
+  801cab:	85 c0                	test   %eax,%eax
+  801cad:	74 0d                	je     801cbc <devfile_read+0x42>
+  801caf:	8b 53 14             	mov    0x14(%ebx),%edx
+  801cb2:	39 fa                	cmp    %edi,%edx
+  801cb4:	7f 06                	jg     801cbc <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801cb6:	01 c2                	add    %eax,%edx
+  801cb8:	39 d7                	cmp    %edx,%edi
+  801cba:	72 28                	jb     801ce4 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801cbc:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801cc3:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801cc9:	77 74                	ja     801d3f <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801ccb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801cd0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801cd3:	89 d8                	mov    %ebx,%eax
+  801cd5:	e8 a5 fe ff ff       	call   801b7f <file_read_direct>
+  801cda:	85 c0                	test   %eax,%eax
+  801cdc:	7e 35                	jle    801d13 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801cde:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801ce1:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801ce4:	8b 53 14             	mov    0x14(%ebx),%edx
+  801ce7:	89 d0                	mov    %edx,%eax
+  801ce9:	03 43 18             	add    0x18(%ebx),%eax
+  801cec:	29 f8                	sub    %edi,%eax
+  801cee:	39 f0                	cmp    %esi,%eax
+  801cf0:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801cf3:	83 ec 04             	sub    $0x4,%esp
+  801cf6:	56                   	push   %esi
+  801cf7:	89 f8                	mov    %edi,%eax
+  801cf9:	29 d0                	sub    %edx,%eax
+  801cfb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801cfe:	01 c1                	add    %eax,%ecx
+  801d00:	51                   	push   %ecx
+  801d01:	ff 75 0c             	push   0xc(%ebp)
+  801d04:	e8 24 ec ff ff       	call   80092d <memmove>
+	fd->fd_offset = pos + n;
+  801d09:	01 f7                	add    %esi,%edi
+  801d0b:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801d0e:	89 f0                	mov    %esi,%eax
+  801d10:	83 c4 10             	add    $0x10,%esp
+}
+  801d13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d16:	5b                   	pop    %ebx
+  801d17:	5e                   	pop    %esi
+  801d18:	5f                   	pop    %edi
+  801d19:	5d                   	pop    %ebp
+  801d1a:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801d1b:	89 f1                	mov    %esi,%ecx
+  801d1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d20:	89 d8                	mov    %ebx,%eax
+  801d22:	e8 58 fe ff ff       	call   801b7f <file_read_direct>
+  801d27:	eb ea                	jmp    801d13 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801d29:	83 ec 0c             	sub    $0xc,%esp
+  801d2c:	53                   	push   %ebx
+  801d2d:	e8 db fa ff ff       	call   80180d <devfile_sync>
+  801d32:	83 c4 10             	add    $0x10,%esp
+  801d35:	85 c0                	test   %eax,%eax
+  801d37:	0f 89 6b ff ff ff    	jns    801ca8 <devfile_read+0x2e>
+  801d3d:	eb d4                	jmp    801d13 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801d3f:	89 f1                	mov    %esi,%ecx
+  801d41:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d44:	89 d8                	mov    %ebx,%eax
+  801d46:	e8 34 fe ff ff       	call   801b7f <file_read_direct>
+  801d4b:	eb c6                	jmp    801d13 <devfile_read+0x99>
+
+00801d4d <open>:
+{
+  801d4d:	55                   	push   %ebp
+  801d4e:	89 e5                	mov    %esp,%ebp
+  801d50:	56                   	push   %esi
+  801d51:	53                   	push   %ebx
+  801d52:	83 ec 1c             	sub    $0x1c,%esp
+  801d55:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801d58:	56                   	push   %esi
+  801d59:	e8 0e ea ff ff       	call   80076c <strlen>
+  801d5e:	83 c4 10             	add    $0x10,%esp
+  801d61:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d66:	0f 8f a0 00 00 00    	jg     801e0c <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801d6c:	83 ec 0c             	sub    $0xc,%esp
+  801d6f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d72:	50                   	push   %eax
+  801d73:	e8 63 f2 ff ff       	call   800fdb <fd_alloc>
+  801d78:	89 c3                	mov    %eax,%ebx
+  801d7a:	83 c4 10             	add    $0x10,%esp
+  801d7d:	85 c0                	test   %eax,%eax
+  801d7f:	78 45                	js     801dc6 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801d81:	83 ec 08             	sub    $0x8,%esp
+  801d84:	56                   	push   %esi
+  801d85:	68 00 70 80 00       	push   $0x807000
+  801d8a:	e8 18 ea ff ff       	call   8007a7 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d92:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d97:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d9a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d9f:	e8 c5 f9 ff ff       	call   801769 <fsipc>
+  801da4:	89 c3                	mov    %eax,%ebx
+  801da6:	83 c4 10             	add    $0x10,%esp
+  801da9:	85 c0                	test   %eax,%eax
+  801dab:	78 22                	js     801dcf <open+0x82>
+	if (!(mode & O_NOBUF)
+  801dad:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801db4:	74 2b                	je     801de1 <open+0x94>
+	return fd2num(fd);
+  801db6:	83 ec 0c             	sub    $0xc,%esp
+  801db9:	ff 75 f4             	push   -0xc(%ebp)
+  801dbc:	e8 f3 f1 ff ff       	call   800fb4 <fd2num>
+  801dc1:	89 c3                	mov    %eax,%ebx
+  801dc3:	83 c4 10             	add    $0x10,%esp
+}
+  801dc6:	89 d8                	mov    %ebx,%eax
+  801dc8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dcb:	5b                   	pop    %ebx
+  801dcc:	5e                   	pop    %esi
+  801dcd:	5d                   	pop    %ebp
+  801dce:	c3                   	ret
+		fd_close(fd, 0);
+  801dcf:	83 ec 08             	sub    $0x8,%esp
+  801dd2:	6a 00                	push   $0x0
+  801dd4:	ff 75 f4             	push   -0xc(%ebp)
+  801dd7:	e8 f8 f2 ff ff       	call   8010d4 <fd_close>
+		return r;
+  801ddc:	83 c4 10             	add    $0x10,%esp
+  801ddf:	eb e5                	jmp    801dc6 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801de1:	83 ec 0c             	sub    $0xc,%esp
+  801de4:	ff 75 f4             	push   -0xc(%ebp)
+  801de7:	e8 d8 f1 ff ff       	call   800fc4 <fd2data>
+  801dec:	83 c4 0c             	add    $0xc,%esp
+  801def:	68 07 04 00 00       	push   $0x407
+  801df4:	50                   	push   %eax
+  801df5:	6a 00                	push   $0x0
+  801df7:	e8 b7 ed ff ff       	call   800bb3 <sys_page_alloc>
+  801dfc:	83 c4 10             	add    $0x10,%esp
+  801dff:	85 c0                	test   %eax,%eax
+  801e01:	75 b3                	jne    801db6 <open+0x69>
+		fd->fd_file.buffered = 1;
+  801e03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e06:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801e0a:	eb aa                	jmp    801db6 <open+0x69>
+		return -E_BAD_PATH;
+  801e0c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e11:	eb b3                	jmp    801dc6 <open+0x79>
+
+00801e13 <readdir>:
+{
+  801e13:	55                   	push   %ebp
+  801e14:	89 e5                	mov    %esp,%ebp
+  801e16:	53                   	push   %ebx
+  801e17:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e1a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e1d:	50                   	push   %eax
+  801e1e:	ff 75 08             	push   0x8(%ebp)
+  801e21:	e8 0b f2 ff ff       	call   801031 <fd_lookup>
+  801e26:	89 c3                	mov    %eax,%ebx
+  801e28:	83 c4 10             	add    $0x10,%esp
+  801e2b:	85 c0                	test   %eax,%eax
+  801e2d:	78 73                	js     801ea2 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801e2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e32:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  801e38:	39 08                	cmp    %ecx,(%eax)
+  801e3a:	0f 85 82 00 00 00    	jne    801ec2 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801e40:	83 ec 0c             	sub    $0xc,%esp
+  801e43:	50                   	push   %eax
+  801e44:	e8 c4 f9 ff ff       	call   80180d <devfile_sync>
+  801e49:	89 c3                	mov    %eax,%ebx
+  801e4b:	83 c4 10             	add    $0x10,%esp
+  801e4e:	85 c0                	test   %eax,%eax
+  801e50:	78 50                	js     801ea2 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801e52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e55:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e58:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  801e5d:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e60:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  801e65:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e68:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801e6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e72:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e77:	e8 ed f8 ff ff       	call   801769 <fsipc>
+  801e7c:	89 c3                	mov    %eax,%ebx
+  801e7e:	85 c0                	test   %eax,%eax
+  801e80:	7e 20                	jle    801ea2 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801e82:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801e85:	72 22                	jb     801ea9 <readdir+0x96>
+  801e87:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e8c:	7f 1b                	jg     801ea9 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e8e:	83 ec 04             	sub    $0x4,%esp
+  801e91:	50                   	push   %eax
+  801e92:	68 00 70 80 00       	push   $0x807000
+  801e97:	ff 75 0c             	push   0xc(%ebp)
+  801e9a:	e8 8e ea ff ff       	call   80092d <memmove>
+	return r;
+  801e9f:	83 c4 10             	add    $0x10,%esp
+}
+  801ea2:	89 d8                	mov    %ebx,%eax
+  801ea4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ea7:	c9                   	leave
+  801ea8:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801ea9:	68 47 43 80 00       	push   $0x804347
+  801eae:	68 20 43 80 00       	push   $0x804320
+  801eb3:	68 86 01 00 00       	push   $0x186
+  801eb8:	68 35 43 80 00       	push   $0x804335
+  801ebd:	e8 1c e2 ff ff       	call   8000de <_panic>
+		return -E_NOT_SUPP;
+  801ec2:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801ec7:	eb d9                	jmp    801ea2 <readdir+0x8f>
+
+00801ec9 <munmap>:
+{
+  801ec9:	55                   	push   %ebp
+  801eca:	89 e5                	mov    %esp,%ebp
+  801ecc:	56                   	push   %esi
+  801ecd:	53                   	push   %ebx
+  801ece:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ed1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801ed4:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801eda:	75 41                	jne    801f1d <munmap+0x54>
+  801edc:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801ee2:	77 39                	ja     801f1d <munmap+0x54>
+  801ee4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801ee9:	29 f0                	sub    %esi,%eax
+  801eeb:	39 d0                	cmp    %edx,%eax
+  801eed:	72 35                	jb     801f24 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801eef:	89 f3                	mov    %esi,%ebx
+  801ef1:	01 d6                	add    %edx,%esi
+  801ef3:	39 f3                	cmp    %esi,%ebx
+  801ef5:	73 1a                	jae    801f11 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801ef7:	83 ec 08             	sub    $0x8,%esp
+  801efa:	53                   	push   %ebx
+  801efb:	6a 00                	push   $0x0
+  801efd:	e8 3e ed ff ff       	call   800c40 <sys_page_unmap>
+  801f02:	83 c4 10             	add    $0x10,%esp
+  801f05:	85 c0                	test   %eax,%eax
+  801f07:	78 0d                	js     801f16 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801f09:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f0f:	eb e2                	jmp    801ef3 <munmap+0x2a>
+	return 0;
+  801f11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f19:	5b                   	pop    %ebx
+  801f1a:	5e                   	pop    %esi
+  801f1b:	5d                   	pop    %ebp
+  801f1c:	c3                   	ret
+		return -E_INVAL;
+  801f1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f22:	eb f2                	jmp    801f16 <munmap+0x4d>
+  801f24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f29:	eb eb                	jmp    801f16 <munmap+0x4d>
+
+00801f2b <mmap>:
+{
+  801f2b:	55                   	push   %ebp
+  801f2c:	89 e5                	mov    %esp,%ebp
+  801f2e:	57                   	push   %edi
+  801f2f:	56                   	push   %esi
+  801f30:	53                   	push   %ebx
+  801f31:	83 ec 34             	sub    $0x34,%esp
+  801f34:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f37:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f3a:	50                   	push   %eax
+  801f3b:	ff 75 18             	push   0x18(%ebp)
+  801f3e:	e8 ee f0 ff ff       	call   801031 <fd_lookup>
+  801f43:	89 c3                	mov    %eax,%ebx
+  801f45:	83 c4 10             	add    $0x10,%esp
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	0f 88 0e 01 00 00    	js     80205e <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801f50:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f53:	a1 20 50 80 00       	mov    0x805020,%eax
+  801f58:	39 02                	cmp    %eax,(%edx)
+  801f5a:	0f 85 50 01 00 00    	jne    8020b0 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801f60:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f63:	83 e0 02             	and    $0x2,%eax
+  801f66:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f69:	74 0a                	je     801f75 <mmap+0x4a>
+  801f6b:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801f6f:	0f 84 42 01 00 00    	je     8020b7 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801f75:	8b 42 08             	mov    0x8(%edx),%eax
+  801f78:	83 e0 03             	and    $0x3,%eax
+  801f7b:	83 f8 01             	cmp    $0x1,%eax
+  801f7e:	0f 84 3a 01 00 00    	je     8020be <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  801f84:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f87:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801f8a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f8f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801f92:	0f 85 2d 01 00 00    	jne    8020c5 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801f98:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801f9c:	0f 88 2a 01 00 00    	js     8020cc <mmap+0x1a1>
+  801fa2:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  801fa9:	0f 87 1d 01 00 00    	ja     8020cc <mmap+0x1a1>
+  801faf:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801fb4:	2b 45 08             	sub    0x8(%ebp),%eax
+  801fb7:	39 f8                	cmp    %edi,%eax
+  801fb9:	0f 82 14 01 00 00    	jb     8020d3 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  801fbf:	83 ec 0c             	sub    $0xc,%esp
+  801fc2:	52                   	push   %edx
+  801fc3:	e8 45 f8 ff ff       	call   80180d <devfile_sync>
+  801fc8:	89 c3                	mov    %eax,%ebx
+  801fca:	83 c4 10             	add    $0x10,%esp
+  801fcd:	85 c0                	test   %eax,%eax
+  801fcf:	0f 88 89 00 00 00    	js     80205e <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  801fd5:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  801fdb:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801fe1:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe6:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  801fe9:	39 fe                	cmp    %edi,%esi
+  801feb:	73 7b                	jae    802068 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  801fed:	89 f8                	mov    %edi,%eax
+  801fef:	29 f0                	sub    %esi,%eax
+  801ff1:	c1 e8 0c             	shr    $0xc,%eax
+  801ff4:	ba 40 00 00 00       	mov    $0x40,%edx
+  801ff9:	39 d0                	cmp    %edx,%eax
+  801ffb:	0f 47 c2             	cmova  %edx,%eax
+  801ffe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802001:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802004:	8b 52 0c             	mov    0xc(%edx),%edx
+  802007:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  80200d:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802010:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  802016:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  80201b:	89 f2                	mov    %esi,%edx
+  80201d:	03 55 08             	add    0x8(%ebp),%edx
+  802020:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802023:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802028:	e8 ea f6 ff ff       	call   801717 <fsipcv>
+  80202d:	85 c0                	test   %eax,%eax
+  80202f:	7e 12                	jle    802043 <mmap+0x118>
+  802031:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802034:	85 c0                	test   %eax,%eax
+  802036:	0f 84 9e 00 00 00    	je     8020da <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80203c:	c1 e0 0c             	shl    $0xc,%eax
+  80203f:	01 c6                	add    %eax,%esi
+  802041:	eb a6                	jmp    801fe9 <mmap+0xbe>
+			munmap(addr, done);
+  802043:	89 c3                	mov    %eax,%ebx
+  802045:	83 ec 08             	sub    $0x8,%esp
+  802048:	56                   	push   %esi
+  802049:	ff 75 08             	push   0x8(%ebp)
+  80204c:	e8 78 fe ff ff       	call   801ec9 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802051:	83 c4 10             	add    $0x10,%esp
+  802054:	85 db                	test   %ebx,%ebx
+  802056:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80205b:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80205e:	89 d8                	mov    %ebx,%eax
+  802060:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802063:	5b                   	pop    %ebx
+  802064:	5e                   	pop    %esi
+  802065:	5f                   	pop    %edi
+  802066:	5d                   	pop    %ebp
+  802067:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802068:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80206b:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80206d:	85 c0                	test   %eax,%eax
+  80206f:	74 ed                	je     80205e <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802071:	be 00 00 00 00       	mov    $0x0,%esi
+  802076:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802079:	39 fe                	cmp    %edi,%esi
+  80207b:	73 2e                	jae    8020ab <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80207d:	83 ec 0c             	sub    $0xc,%esp
+  802080:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802083:	50                   	push   %eax
+  802084:	e8 14 17 00 00       	call   80379d <cowpage>
+  802089:	83 c4 10             	add    $0x10,%esp
+  80208c:	85 c0                	test   %eax,%eax
+  80208e:	78 08                	js     802098 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802090:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802096:	eb e1                	jmp    802079 <mmap+0x14e>
+				munmap(addr, len);
+  802098:	89 c3                	mov    %eax,%ebx
+  80209a:	83 ec 08             	sub    $0x8,%esp
+  80209d:	57                   	push   %edi
+  80209e:	ff 75 08             	push   0x8(%ebp)
+  8020a1:	e8 23 fe ff ff       	call   801ec9 <munmap>
+				return r;
+  8020a6:	83 c4 10             	add    $0x10,%esp
+  8020a9:	eb b3                	jmp    80205e <mmap+0x133>
+	return 0;
+  8020ab:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8020ae:	eb ae                	jmp    80205e <mmap+0x133>
+		return -E_NOT_SUPP;
+  8020b0:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8020b5:	eb a7                	jmp    80205e <mmap+0x133>
+		return -E_NOT_SUPP;
+  8020b7:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8020bc:	eb a0                	jmp    80205e <mmap+0x133>
+		return -E_INVAL;
+  8020be:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8020c3:	eb 99                	jmp    80205e <mmap+0x133>
+  8020c5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8020ca:	eb 92                	jmp    80205e <mmap+0x133>
+  8020cc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8020d1:	eb 8b                	jmp    80205e <mmap+0x133>
+  8020d3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8020d8:	eb 84                	jmp    80205e <mmap+0x133>
+			munmap(addr, done);
+  8020da:	83 ec 08             	sub    $0x8,%esp
+  8020dd:	56                   	push   %esi
+  8020de:	ff 75 08             	push   0x8(%ebp)
+  8020e1:	e8 e3 fd ff ff       	call   801ec9 <munmap>
+  8020e6:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8020e9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8020ee:	e9 6b ff ff ff       	jmp    80205e <mmap+0x133>
+
+008020f3 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8020f3:	55                   	push   %ebp
+  8020f4:	89 e5                	mov    %esp,%ebp
+  8020f6:	56                   	push   %esi
+  8020f7:	53                   	push   %ebx
+  8020f8:	83 ec 10             	sub    $0x10,%esp
+  8020fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8020fe:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802101:	8b 45 08             	mov    0x8(%ebp),%eax
+  802104:	e8 3d f9 ff ff       	call   801a46 <fsring_slot>
+  802109:	85 c0                	test   %eax,%eax
+  80210b:	78 60                	js     80216d <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80210d:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802110:	8b 56 08             	mov    0x8(%esi),%edx
+  802113:	83 e2 03             	and    $0x3,%edx
+  802116:	83 fa 01             	cmp    $0x1,%edx
+  802119:	74 59                	je     802174 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  80211b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802120:	89 c1                	mov    %eax,%ecx
+  802122:	d3 e2                	shl    %cl,%edx
+  802124:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  80212a:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80212d:	c1 e2 02             	shl    $0x2,%edx
+  802130:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  802136:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  80213d:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802140:	8b 55 18             	mov    0x18(%ebp),%edx
+  802143:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802146:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802149:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80214c:	83 ec 08             	sub    $0x8,%esp
+  80214f:	50                   	push   %eax
+  802150:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802155:	39 c3                	cmp    %eax,%ebx
+  802157:	0f 47 d8             	cmova  %eax,%ebx
+  80215a:	53                   	push   %ebx
+  80215b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80215e:	89 f2                	mov    %esi,%edx
+  802160:	b8 03 00 00 00       	mov    $0x3,%eax
+  802165:	e8 1e f5 ff ff       	call   801688 <fsring_post>
+  80216a:	83 c4 10             	add    $0x10,%esp
+}
+  80216d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802170:	5b                   	pop    %ebx
+  802171:	5e                   	pop    %esi
+  802172:	5d                   	pop    %ebp
+  802173:	c3                   	ret
+		return -E_INVAL;
+  802174:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802179:	eb f2                	jmp    80216d <fsring_read+0x7a>
+
+0080217b <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80217b:	55                   	push   %ebp
+  80217c:	89 e5                	mov    %esp,%ebp
+  80217e:	56                   	push   %esi
+  80217f:	53                   	push   %ebx
+  802180:	83 ec 10             	sub    $0x10,%esp
+  802183:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802186:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802189:	8b 45 08             	mov    0x8(%ebp),%eax
+  80218c:	e8 b5 f8 ff ff       	call   801a46 <fsring_slot>
+  802191:	89 c3                	mov    %eax,%ebx
+  802193:	85 c0                	test   %eax,%eax
+  802195:	78 77                	js     80220e <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802197:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80219a:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80219e:	74 77                	je     802217 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8021a0:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8021a5:	39 c6                	cmp    %eax,%esi
+  8021a7:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8021aa:	83 ec 04             	sub    $0x4,%esp
+  8021ad:	56                   	push   %esi
+  8021ae:	ff 75 0c             	push   0xc(%ebp)
+  8021b1:	89 d8                	mov    %ebx,%eax
+  8021b3:	c1 e0 0c             	shl    $0xc,%eax
+  8021b6:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8021bc:	50                   	push   %eax
+  8021bd:	e8 6b e7 ff ff       	call   80092d <memmove>
+	fsring_busy |= 1 << slot;
+  8021c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021c7:	89 d9                	mov    %ebx,%ecx
+  8021c9:	d3 e0                	shl    %cl,%eax
+  8021cb:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8021d1:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8021d4:	c1 e0 02             	shl    $0x2,%eax
+  8021d7:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  8021dd:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  8021e4:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8021e7:	8b 45 18             	mov    0x18(%ebp),%eax
+  8021ea:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8021ed:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8021f4:	83 c4 08             	add    $0x8,%esp
+  8021f7:	53                   	push   %ebx
+  8021f8:	56                   	push   %esi
+  8021f9:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8021fc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021ff:	b8 04 00 00 00       	mov    $0x4,%eax
+  802204:	e8 7f f4 ff ff       	call   801688 <fsring_post>
+  802209:	89 c3                	mov    %eax,%ebx
+  80220b:	83 c4 10             	add    $0x10,%esp
+}
+  80220e:	89 d8                	mov    %ebx,%eax
+  802210:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802213:	5b                   	pop    %ebx
+  802214:	5e                   	pop    %esi
+  802215:	5d                   	pop    %ebp
+  802216:	c3                   	ret
+		return -E_INVAL;
+  802217:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80221c:	eb f0                	jmp    80220e <fsring_write+0x93>
+
+0080221e <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80221e:	55                   	push   %ebp
+  80221f:	89 e5                	mov    %esp,%ebp
+  802221:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802224:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802227:	8b 45 08             	mov    0x8(%ebp),%eax
+  80222a:	e8 17 f8 ff ff       	call   801a46 <fsring_slot>
+  80222f:	85 c0                	test   %eax,%eax
+  802231:	78 4c                	js     80227f <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802233:	ba 01 00 00 00       	mov    $0x1,%edx
+  802238:	89 c1                	mov    %eax,%ecx
+  80223a:	d3 e2                	shl    %cl,%edx
+  80223c:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802242:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802245:	c1 e2 02             	shl    $0x2,%edx
+  802248:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  80224e:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  802255:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802258:	8b 55 10             	mov    0x10(%ebp),%edx
+  80225b:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80225e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802261:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802264:	83 ec 08             	sub    $0x8,%esp
+  802267:	50                   	push   %eax
+  802268:	6a 00                	push   $0x0
+  80226a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80226f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802272:	b8 05 00 00 00       	mov    $0x5,%eax
+  802277:	e8 0c f4 ff ff       	call   801688 <fsring_post>
+  80227c:	83 c4 10             	add    $0x10,%esp
+}
+  80227f:	c9                   	leave
+  802280:	c3                   	ret
+
+00802281 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802281:	55                   	push   %ebp
+  802282:	89 e5                	mov    %esp,%ebp
+  802284:	57                   	push   %edi
+  802285:	56                   	push   %esi
+  802286:	53                   	push   %ebx
+  802287:	83 ec 1c             	sub    $0x1c,%esp
+  80228a:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80228e:	a1 00 60 80 00       	mov    0x806000,%eax
+  802293:	8b 40 48             	mov    0x48(%eax),%eax
+  802296:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  80229c:	74 12                	je     8022b0 <fsring_reap+0x2f>
+		return 0;
+  80229e:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8022a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022a6:	5b                   	pop    %ebx
+  8022a7:	5e                   	pop    %esi
+  8022a8:	5f                   	pop    %edi
+  8022a9:	5d                   	pop    %ebp
+  8022aa:	c3                   	ret
+		sys_yield();
+  8022ab:	e8 e4 e8 ff ff       	call   800b94 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8022b0:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8022b6:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8022bb:	39 c2                	cmp    %eax,%edx
+  8022bd:	75 18                	jne    8022d7 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8022bf:	84 db                	test   %bl,%bl
+  8022c1:	0f 84 21 01 00 00    	je     8023e8 <fsring_reap+0x167>
+  8022c7:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  8022ce:	75 db                	jne    8022ab <fsring_reap+0x2a>
+			return 0;
+  8022d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d5:	eb cc                	jmp    8022a3 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8022d7:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8022dc:	83 e0 0f             	and    $0xf,%eax
+  8022df:	83 c0 2a             	add    $0x2a,%eax
+  8022e2:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8022e9:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8022f0:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8022f5:	83 c0 01             	add    $0x1,%eax
+  8022f8:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8022fd:	83 fb 0f             	cmp    $0xf,%ebx
+  802300:	77 5b                	ja     80235d <fsring_reap+0xdc>
+  802302:	be 01 00 00 00       	mov    $0x1,%esi
+  802307:	89 d9                	mov    %ebx,%ecx
+  802309:	d3 e6                	shl    %cl,%esi
+  80230b:	89 f0                	mov    %esi,%eax
+  80230d:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  802313:	74 48                	je     80235d <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802315:	89 d8                	mov    %ebx,%eax
+  802317:	c1 e0 0c             	shl    $0xc,%eax
+  80231a:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802320:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802323:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802326:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  80232d:	83 f8 03             	cmp    $0x3,%eax
+  802330:	74 40                	je     802372 <fsring_reap+0xf1>
+  802332:	83 f8 05             	cmp    $0x5,%eax
+  802335:	74 64                	je     80239b <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802337:	f7 d6                	not    %esi
+  802339:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  80233f:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802342:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  802349:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234c:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  80234e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802351:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802353:	b8 01 00 00 00       	mov    $0x1,%eax
+  802358:	e9 46 ff ff ff       	jmp    8022a3 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80235d:	53                   	push   %ebx
+  80235e:	68 5d 43 80 00       	push   $0x80435d
+  802363:	68 8f 02 00 00       	push   $0x28f
+  802368:	68 35 43 80 00       	push   $0x804335
+  80236d:	e8 6c dd ff ff       	call   8000de <_panic>
+		if (cqe.cqe_result > 0)
+  802372:	85 ff                	test   %edi,%edi
+  802374:	7e c1                	jle    802337 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802376:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802379:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80237e:	39 c7                	cmp    %eax,%edi
+  802380:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802383:	50                   	push   %eax
+  802384:	ff 75 e4             	push   -0x1c(%ebp)
+  802387:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80238a:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  802391:	e8 97 e5 ff ff       	call   80092d <memmove>
+  802396:	83 c4 10             	add    $0x10,%esp
+  802399:	eb 9c                	jmp    802337 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80239b:	85 ff                	test   %edi,%edi
+  80239d:	75 98                	jne    802337 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80239f:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8023a2:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8023a9:	83 ec 08             	sub    $0x8,%esp
+  8023ac:	ff 75 e4             	push   -0x1c(%ebp)
+  8023af:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8023b2:	51                   	push   %ecx
+  8023b3:	e8 ef e3 ff ff       	call   8007a7 <strcpy>
+			st->st_size = ret->ret_size;
+  8023b8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8023bb:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8023c1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8023c4:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8023ca:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8023d0:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8023d6:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  8023dd:	50 80 00 
+  8023e0:	83 c4 10             	add    $0x10,%esp
+  8023e3:	e9 4f ff ff ff       	jmp    802337 <fsring_reap+0xb6>
+			return 0;
+  8023e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ed:	e9 b1 fe ff ff       	jmp    8022a3 <fsring_reap+0x22>
+
+008023f2 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8023f2:	55                   	push   %ebp
+  8023f3:	89 e5                	mov    %esp,%ebp
+  8023f5:	57                   	push   %edi
+  8023f6:	56                   	push   %esi
+  8023f7:	53                   	push   %ebx
+  8023f8:	83 ec 28             	sub    $0x28,%esp
+  8023fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8023fe:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802401:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802404:	53                   	push   %ebx
+  802405:	e8 62 e3 ff ff       	call   80076c <strlen>
+  80240a:	83 c4 10             	add    $0x10,%esp
+  80240d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802412:	0f 8f 02 01 00 00    	jg     80251a <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802418:	83 ec 08             	sub    $0x8,%esp
+  80241b:	53                   	push   %ebx
+  80241c:	68 00 70 80 00       	push   $0x807000
+  802421:	e8 81 e3 ff ff       	call   8007a7 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802426:	83 c4 10             	add    $0x10,%esp
+  802429:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  80242f:	76 69                	jbe    80249a <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802431:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802434:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80243a:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80243f:	29 d1                	sub    %edx,%ecx
+  802441:	39 f9                	cmp    %edi,%ecx
+  802443:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802446:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802449:	89 f9                	mov    %edi,%ecx
+  80244b:	01 c1                	add    %eax,%ecx
+  80244d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802450:	eb 0f                	jmp    802461 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802452:	0f b6 10             	movzbl (%eax),%edx
+  802455:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802457:	05 00 10 00 00       	add    $0x1000,%eax
+  80245c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802461:	39 c8                	cmp    %ecx,%eax
+  802463:	72 ed                	jb     802452 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802465:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802468:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  80246e:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802474:	83 ec 0c             	sub    $0xc,%esp
+  802477:	6a 07                	push   $0x7
+  802479:	89 f9                	mov    %edi,%ecx
+  80247b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80247e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802483:	e8 3f f1 ff ff       	call   8015c7 <fsipc_pages>
+  802488:	89 c7                	mov    %eax,%edi
+  80248a:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  80248d:	85 f6                	test   %esi,%esi
+  80248f:	74 7f                	je     802510 <file_slurp+0x11e>
+  802491:	8d 43 01             	lea    0x1(%ebx),%eax
+  802494:	85 ff                	test   %edi,%edi
+  802496:	79 3c                	jns    8024d4 <file_slurp+0xe2>
+  802498:	eb 76                	jmp    802510 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  80249a:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8024a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8024aa:	e8 ba f2 ff ff       	call   801769 <fsipc>
+  8024af:	89 c7                	mov    %eax,%edi
+  8024b1:	85 c0                	test   %eax,%eax
+  8024b3:	7e d8                	jle    80248d <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8024b5:	83 ec 04             	sub    $0x4,%esp
+  8024b8:	50                   	push   %eax
+  8024b9:	68 08 70 80 00       	push   $0x807008
+  8024be:	ff 75 0c             	push   0xc(%ebp)
+  8024c1:	e8 67 e4 ff ff       	call   80092d <memmove>
+  8024c6:	83 c4 10             	add    $0x10,%esp
+  8024c9:	eb c2                	jmp    80248d <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8024cb:	80 fa 2f             	cmp    $0x2f,%dl
+  8024ce:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8024d1:	83 c0 01             	add    $0x1,%eax
+  8024d4:	89 c1                	mov    %eax,%ecx
+  8024d6:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8024da:	84 d2                	test   %dl,%dl
+  8024dc:	75 ed                	jne    8024cb <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8024de:	83 ec 04             	sub    $0x4,%esp
+  8024e1:	68 80 00 00 00       	push   $0x80
+  8024e6:	53                   	push   %ebx
+  8024e7:	56                   	push   %esi
+  8024e8:	e8 30 e3 ff ff       	call   80081d <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8024ed:	a1 00 70 80 00       	mov    0x807000,%eax
+  8024f2:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8024f8:	a1 04 70 80 00       	mov    0x807004,%eax
+  8024fd:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802503:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  80250a:	50 80 00 
+  80250d:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802510:	89 f8                	mov    %edi,%eax
+  802512:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802515:	5b                   	pop    %ebx
+  802516:	5e                   	pop    %esi
+  802517:	5f                   	pop    %edi
+  802518:	5d                   	pop    %ebp
+  802519:	c3                   	ret
+		return -E_BAD_PATH;
+  80251a:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  80251f:	eb ef                	jmp    802510 <file_slurp+0x11e>
+
+00802521 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802521:	55                   	push   %ebp
+  802522:	89 e5                	mov    %esp,%ebp
+  802524:	53                   	push   %ebx
+  802525:	83 ec 10             	sub    $0x10,%esp
+  802528:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80252b:	53                   	push   %ebx
+  80252c:	e8 3b e2 ff ff       	call   80076c <strlen>
+  802531:	83 c4 10             	add    $0x10,%esp
+  802534:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802539:	7f 25                	jg     802560 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80253b:	83 ec 08             	sub    $0x8,%esp
+  80253e:	53                   	push   %ebx
+  80253f:	68 00 70 80 00       	push   $0x807000
+  802544:	e8 5e e2 ff ff       	call   8007a7 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802549:	ba 00 00 00 00       	mov    $0x0,%edx
+  80254e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802553:	e8 11 f2 ff ff       	call   801769 <fsipc>
+  802558:	83 c4 10             	add    $0x10,%esp
+}
+  80255b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80255e:	c9                   	leave
+  80255f:	c3                   	ret
+		return -E_BAD_PATH;
+  802560:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802565:	eb f4                	jmp    80255b <remove+0x3a>
+
+00802567 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802567:	55                   	push   %ebp
+  802568:	89 e5                	mov    %esp,%ebp
+  80256a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80256d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802572:	b8 08 00 00 00       	mov    $0x8,%eax
+  802577:	e8 ed f1 ff ff       	call   801769 <fsipc>
+}
+  80257c:	c9                   	leave
+  80257d:	c3                   	ret
+
+0080257e <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  80257e:	55                   	push   %ebp
+  80257f:	89 e5                	mov    %esp,%ebp
+  802581:	57                   	push   %edi
+  802582:	56                   	push   %esi
+  802583:	53                   	push   %ebx
+  802584:	83 ec 18             	sub    $0x18,%esp
+  802587:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80258a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80258d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802590:	57                   	push   %edi
+  802591:	e8 d6 e1 ff ff       	call   80076c <strlen>
+  802596:	83 c4 10             	add    $0x10,%esp
+  802599:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80259e:	7f 4c                	jg     8025ec <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  8025a0:	83 ec 08             	sub    $0x8,%esp
+  8025a3:	57                   	push   %edi
+  8025a4:	68 00 70 80 00       	push   $0x807000
+  8025a9:	e8 f9 e1 ff ff       	call   8007a7 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  8025ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025b3:	b8 10 00 00 00       	mov    $0x10,%eax
+  8025b8:	e8 ac f1 ff ff       	call   801769 <fsipc>
+  8025bd:	83 c4 10             	add    $0x10,%esp
+  8025c0:	85 c0                	test   %eax,%eax
+  8025c2:	78 20                	js     8025e4 <defrag+0x66>
+		return r;
+	if (before)
+  8025c4:	85 f6                	test   %esi,%esi
+  8025c6:	74 07                	je     8025cf <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  8025c8:	a1 00 70 80 00       	mov    0x807000,%eax
+  8025cd:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  8025cf:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  8025d4:	85 db                	test   %ebx,%ebx
+  8025d6:	74 0c                	je     8025e4 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  8025d8:	a1 04 70 80 00       	mov    0x807004,%eax
+  8025dd:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8025df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025e7:	5b                   	pop    %ebx
+  8025e8:	5e                   	pop    %esi
+  8025e9:	5f                   	pop    %edi
+  8025ea:	5d                   	pop    %ebp
+  8025eb:	c3                   	ret
+		return -E_BAD_PATH;
+  8025ec:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8025f1:	eb f1                	jmp    8025e4 <defrag+0x66>
+
+008025f3 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  8025f3:	55                   	push   %ebp
+  8025f4:	89 e5                	mov    %esp,%ebp
+  8025f6:	53                   	push   %ebx
+  8025f7:	83 ec 04             	sub    $0x4,%esp
+  8025fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  8025fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802602:	b8 11 00 00 00       	mov    $0x11,%eax
+  802607:	e8 5d f1 ff ff       	call   801769 <fsipc>
+  80260c:	85 c0                	test   %eax,%eax
+  80260e:	78 34                	js     802644 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802610:	a1 00 70 80 00       	mov    0x807000,%eax
+  802615:	89 03                	mov    %eax,(%ebx)
+  802617:	a1 04 70 80 00       	mov    0x807004,%eax
+  80261c:	89 43 04             	mov    %eax,0x4(%ebx)
+  80261f:	a1 08 70 80 00       	mov    0x807008,%eax
+  802624:	89 43 08             	mov    %eax,0x8(%ebx)
+  802627:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  80262c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80262f:	a1 10 70 80 00       	mov    0x807010,%eax
+  802634:	89 43 10             	mov    %eax,0x10(%ebx)
+  802637:	a1 14 70 80 00       	mov    0x807014,%eax
+  80263c:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  80263f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802644:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802647:	c9                   	leave
+  802648:	c3                   	ret
+
+00802649 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802649:	55                   	push   %ebp
+  80264a:	89 e5                	mov    %esp,%ebp
+  80264c:	57                   	push   %edi
+  80264d:	56                   	push   %esi
+  80264e:	53                   	push   %ebx
+  80264f:	81 ec a4 02 00 00    	sub    $0x2a4,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  802655:	6a 00                	push   $0x0
+  802657:	ff 75 08             	push   0x8(%ebp)
+  80265a:	e8 ee f6 ff ff       	call   801d4d <open>
+  80265f:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802665:	83 c4 10             	add    $0x10,%esp
+  802668:	85 c0                	test   %eax,%eax
+  80266a:	0f 88 39 06 00 00    	js     802ca9 <spawn+0x660>
+  802670:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802672:	83 ec 04             	sub    $0x4,%esp
+  802675:	68 00 02 00 00       	push   $0x200
+  80267a:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802680:	50                   	push   %eax
+  802681:	51                   	push   %ecx
+  802682:	e8 97 ec ff ff       	call   80131e <readn>
+  802687:	83 c4 10             	add    $0x10,%esp
+  80268a:	3d 00 02 00 00       	cmp    $0x200,%eax
+  80268f:	75 5a                	jne    8026eb <spawn+0xa2>
+	    || elf->e_magic != ELF_MAGIC) {
+  802691:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802698:	45 4c 46 
+  80269b:	75 4e                	jne    8026eb <spawn+0xa2>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80269d:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026a2:	cd 30                	int    $0x30
+  8026a4:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  8026aa:	85 c0                	test   %eax,%eax
+  8026ac:	0f 88 eb 05 00 00    	js     802c9d <spawn+0x654>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  8026b2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8026b7:	69 f0 8c 00 00 00    	imul   $0x8c,%eax,%esi
+  8026bd:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8026c3:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8026c9:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8026ce:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  8026d0:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8026d6:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  8026dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  8026e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8026e9:	eb 4b                	jmp    802736 <spawn+0xed>
+		close(fd);
+  8026eb:	83 ec 0c             	sub    $0xc,%esp
+  8026ee:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  8026f4:	e8 62 ea ff ff       	call   80115b <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8026f9:	83 c4 0c             	add    $0xc,%esp
+  8026fc:	68 7f 45 4c 46       	push   $0x464c457f
+  802701:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802707:	68 76 43 80 00       	push   $0x804376
+  80270c:	e8 a8 da ff ff       	call   8001b9 <cprintf>
+		return -E_NOT_EXEC;
+  802711:	83 c4 10             	add    $0x10,%esp
+  802714:	c7 85 7c fd ff ff f2 	movl   $0xfffffff2,-0x284(%ebp)
+  80271b:	ff ff ff 
+  80271e:	e9 86 05 00 00       	jmp    802ca9 <spawn+0x660>
+		string_size += strlen(argv[argc]) + 1;
+  802723:	83 ec 0c             	sub    $0xc,%esp
+  802726:	50                   	push   %eax
+  802727:	e8 40 e0 ff ff       	call   80076c <strlen>
+  80272c:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802730:	83 c3 01             	add    $0x1,%ebx
+  802733:	83 c4 10             	add    $0x10,%esp
+  802736:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802739:	85 c0                	test   %eax,%eax
+  80273b:	75 e6                	jne    802723 <spawn+0xda>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  80273d:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802743:	bf 00 10 40 00       	mov    $0x401000,%edi
+  802748:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  80274a:	89 fa                	mov    %edi,%edx
+  80274c:	83 e2 fc             	and    $0xfffffffc,%edx
+  80274f:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802756:	29 c2                	sub    %eax,%edx
+  802758:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  80275e:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802761:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802766:	0f 86 59 05 00 00    	jbe    802cc5 <spawn+0x67c>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  80276c:	83 ec 04             	sub    $0x4,%esp
+  80276f:	6a 07                	push   $0x7
+  802771:	68 00 00 40 00       	push   $0x400000
+  802776:	6a 00                	push   $0x0
+  802778:	e8 36 e4 ff ff       	call   800bb3 <sys_page_alloc>
+  80277d:	83 c4 10             	add    $0x10,%esp
+  802780:	85 c0                	test   %eax,%eax
+  802782:	0f 88 42 05 00 00    	js     802cca <spawn+0x681>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  802788:	be 00 00 00 00       	mov    $0x0,%esi
+  80278d:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  802793:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802796:	eb 30                	jmp    8027c8 <spawn+0x17f>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  802798:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  80279e:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+  8027a4:	89 04 b2             	mov    %eax,(%edx,%esi,4)
+		strcpy(string_store, argv[i]);
+  8027a7:	83 ec 08             	sub    $0x8,%esp
+  8027aa:	ff 34 b3             	push   (%ebx,%esi,4)
+  8027ad:	57                   	push   %edi
+  8027ae:	e8 f4 df ff ff       	call   8007a7 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  8027b3:	83 c4 04             	add    $0x4,%esp
+  8027b6:	ff 34 b3             	push   (%ebx,%esi,4)
+  8027b9:	e8 ae df ff ff       	call   80076c <strlen>
+  8027be:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  8027c2:	83 c6 01             	add    $0x1,%esi
+  8027c5:	83 c4 10             	add    $0x10,%esp
+  8027c8:	39 b5 90 fd ff ff    	cmp    %esi,-0x270(%ebp)
+  8027ce:	7f c8                	jg     802798 <spawn+0x14f>
+	}
+	argv_store[argc] = 0;
+  8027d0:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  8027d6:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  8027dc:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  8027e3:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  8027e9:	0f 85 83 00 00 00    	jne    802872 <spawn+0x229>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  8027ef:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+  8027f5:	8d 82 00 d0 7f ee    	lea    -0x11803000(%edx),%eax
+  8027fb:	89 42 fc             	mov    %eax,-0x4(%edx)
+	argv_store[-2] = argc;
+  8027fe:	89 d0                	mov    %edx,%eax
+  802800:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802806:	89 4a f8             	mov    %ecx,-0x8(%edx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802809:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  80280e:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802814:	83 ec 0c             	sub    $0xc,%esp
+  802817:	6a 07                	push   $0x7
+  802819:	68 00 d0 bf ee       	push   $0xeebfd000
+  80281e:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802824:	68 00 00 40 00       	push   $0x400000
+  802829:	6a 00                	push   $0x0
+  80282b:	e8 ce e3 ff ff       	call   800bfe <sys_page_map>
+  802830:	89 c3                	mov    %eax,%ebx
+  802832:	83 c4 20             	add    $0x20,%esp
+  802835:	85 c0                	test   %eax,%eax
+  802837:	0f 88 95 04 00 00    	js     802cd2 <spawn+0x689>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80283d:	83 ec 08             	sub    $0x8,%esp
+  802840:	68 00 00 40 00       	push   $0x400000
+  802845:	6a 00                	push   $0x0
+  802847:	e8 f4 e3 ff ff       	call   800c40 <sys_page_unmap>
+  80284c:	89 c3                	mov    %eax,%ebx
+  80284e:	83 c4 10             	add    $0x10,%esp
+  802851:	85 c0                	test   %eax,%eax
+  802853:	0f 88 79 04 00 00    	js     802cd2 <spawn+0x689>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802859:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  80285f:	8d b4 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802866:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80286b:	89 df                	mov    %ebx,%edi
+  80286d:	e9 7f 02 00 00       	jmp    802af1 <spawn+0x4a8>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802872:	68 00 44 80 00       	push   $0x804400
+  802877:	68 20 43 80 00       	push   $0x804320
+  80287c:	68 f0 00 00 00       	push   $0xf0
+  802881:	68 90 43 80 00       	push   $0x804390
+  802886:	e8 53 d8 ff ff       	call   8000de <_panic>
+
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+		if (i >= filesz) {
+			// allocate a blank page
+			n = 1;
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  80288b:	83 ec 04             	sub    $0x4,%esp
+  80288e:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802894:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  80289a:	01 f8                	add    %edi,%eax
+  80289c:	50                   	push   %eax
+  80289d:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  8028a3:	e8 0b e3 ff ff       	call   800bb3 <sys_page_alloc>
+  8028a8:	83 c4 10             	add    $0x10,%esp
+  8028ab:	85 c0                	test   %eax,%eax
+  8028ad:	0f 88 04 04 00 00    	js     802cb7 <spawn+0x66e>
+			n = 1;
+  8028b3:	be 01 00 00 00       	mov    $0x1,%esi
+  8028b8:	e9 99 01 00 00       	jmp    802a56 <spawn+0x40d>
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+			// read-only and all from file: map the file server's
+			// cached pages, so that every instance of the program
+			// shares one copy of its text
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  8028bd:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  8028c3:	8b 8d 80 fd ff ff    	mov    -0x280(%ebp),%ecx
+  8028c9:	39 c8                	cmp    %ecx,%eax
+  8028cb:	72 70                	jb     80293d <spawn+0x2f4>
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+  8028cd:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8028d2:	29 f8                	sub    %edi,%eax
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  8028d4:	c1 e8 0c             	shr    $0xc,%eax
+			n = MIN(n, FSBULK_MAXPAGES);
+  8028d7:	ba 40 00 00 00       	mov    $0x40,%edx
+  8028dc:	39 d0                	cmp    %edx,%eax
+  8028de:	0f 4e d0             	cmovle %eax,%edx
+  8028e1:	89 d6                	mov    %edx,%esi
+			if ((r = mmap(UTEMP, n * PGSIZE, PROT_READ, MAP_SHARED,
+  8028e3:	83 ec 08             	sub    $0x8,%esp
+  8028e6:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  8028ec:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  8028f2:	01 d0                	add    %edx,%eax
+  8028f4:	50                   	push   %eax
+  8028f5:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  8028fb:	6a 01                	push   $0x1
+  8028fd:	6a 01                	push   $0x1
+  8028ff:	89 f0                	mov    %esi,%eax
+  802901:	c1 e0 0c             	shl    $0xc,%eax
+  802904:	50                   	push   %eax
+  802905:	68 00 00 40 00       	push   $0x400000
+  80290a:	e8 1c f6 ff ff       	call   801f2b <mmap>
+  80290f:	83 c4 20             	add    $0x20,%esp
+  802912:	85 c0                	test   %eax,%eax
+  802914:	78 34                	js     80294a <spawn+0x301>
+			if ((r = seek(fd, fileoffset + i)) < 0)
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
+				return r;
+		}
+		for (j = 0; j < n; j++) {
+  802916:	8d 86 00 04 00 00    	lea    0x400(%esi),%eax
+  80291c:	c1 e0 0c             	shl    $0xc,%eax
+  80291f:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  802925:	bb 00 00 40 00       	mov    $0x400000,%ebx
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  80292a:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  802930:	01 c7                	add    %eax,%edi
+  802932:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+		for (j = 0; j < n; j++) {
+  802938:	e9 ca 00 00 00       	jmp    802a07 <spawn+0x3be>
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  80293d:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802943:	29 f8                	sub    %edi,%eax
+  802945:	c1 e8 0c             	shr    $0xc,%eax
+  802948:	eb 8d                	jmp    8028d7 <spawn+0x28e>
+  80294a:	89 c7                	mov    %eax,%edi
+  80294c:	eb 27                	jmp    802975 <spawn+0x32c>
+			for (j = 0; j < n; j++)
+  80294e:	83 c3 01             	add    $0x1,%ebx
+  802951:	39 de                	cmp    %ebx,%esi
+  802953:	7e 4a                	jle    80299f <spawn+0x356>
+				if ((r = sys_page_alloc(0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  802955:	83 ec 04             	sub    $0x4,%esp
+  802958:	6a 07                	push   $0x7
+  80295a:	89 d8                	mov    %ebx,%eax
+  80295c:	c1 e0 0c             	shl    $0xc,%eax
+  80295f:	05 00 00 40 00       	add    $0x400000,%eax
+  802964:	50                   	push   %eax
+  802965:	6a 00                	push   $0x0
+  802967:	e8 47 e2 ff ff       	call   800bb3 <sys_page_alloc>
+  80296c:	83 c4 10             	add    $0x10,%esp
+  80296f:	85 c0                	test   %eax,%eax
+  802971:	79 db                	jns    80294e <spawn+0x305>
+  802973:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  802975:	83 ec 0c             	sub    $0xc,%esp
+  802978:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  80297e:	e8 a1 e1 ff ff       	call   800b24 <sys_env_destroy>
+	close(fd);
+  802983:	83 c4 04             	add    $0x4,%esp
+  802986:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  80298c:	e8 ca e7 ff ff       	call   80115b <close>
+	return r;
+  802991:	83 c4 10             	add    $0x10,%esp
+  802994:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+  80299a:	e9 0a 03 00 00       	jmp    802ca9 <spawn+0x660>
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  80299f:	83 ec 08             	sub    $0x8,%esp
+  8029a2:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  8029a8:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  8029ae:	01 d0                	add    %edx,%eax
+  8029b0:	50                   	push   %eax
+  8029b1:	8b 9d 7c fd ff ff    	mov    -0x284(%ebp),%ebx
+  8029b7:	53                   	push   %ebx
+  8029b8:	e8 2a ea ff ff       	call   8013e7 <seek>
+  8029bd:	83 c4 10             	add    $0x10,%esp
+  8029c0:	85 c0                	test   %eax,%eax
+  8029c2:	0f 88 f6 02 00 00    	js     802cbe <spawn+0x675>
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
+  8029c8:	83 ec 04             	sub    $0x4,%esp
+  8029cb:	89 f0                	mov    %esi,%eax
+  8029cd:	c1 e0 0c             	shl    $0xc,%eax
+  8029d0:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  8029d6:	39 c8                	cmp    %ecx,%eax
+  8029d8:	0f 47 c1             	cmova  %ecx,%eax
+  8029db:	50                   	push   %eax
+  8029dc:	68 00 00 40 00       	push   $0x400000
+  8029e1:	53                   	push   %ebx
+  8029e2:	e8 37 e9 ff ff       	call   80131e <readn>
+  8029e7:	83 c4 10             	add    $0x10,%esp
+  8029ea:	85 c0                	test   %eax,%eax
+  8029ec:	0f 89 24 ff ff ff    	jns    802916 <spawn+0x2cd>
+  8029f2:	89 c7                	mov    %eax,%edi
+  8029f4:	e9 7c ff ff ff       	jmp    802975 <spawn+0x32c>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP + j * PGSIZE);
+  8029f9:	83 ec 08             	sub    $0x8,%esp
+  8029fc:	56                   	push   %esi
+  8029fd:	6a 00                	push   $0x0
+  8029ff:	e8 3c e2 ff ff       	call   800c40 <sys_page_unmap>
+  802a04:	83 c4 10             	add    $0x10,%esp
+		for (j = 0; j < n; j++) {
+  802a07:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802a0d:	39 c3                	cmp    %eax,%ebx
+  802a0f:	74 3f                	je     802a50 <spawn+0x407>
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  802a11:	89 de                	mov    %ebx,%esi
+  802a13:	83 ec 0c             	sub    $0xc,%esp
+  802a16:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802a1c:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  802a1f:	50                   	push   %eax
+  802a20:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802a26:	53                   	push   %ebx
+  802a27:	6a 00                	push   $0x0
+  802a29:	e8 d0 e1 ff ff       	call   800bfe <sys_page_map>
+  802a2e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802a34:	83 c4 20             	add    $0x20,%esp
+  802a37:	85 c0                	test   %eax,%eax
+  802a39:	79 be                	jns    8029f9 <spawn+0x3b0>
+				panic("spawn: sys_page_map data: %e", r);
+  802a3b:	50                   	push   %eax
+  802a3c:	68 9c 43 80 00       	push   $0x80439c
+  802a41:	68 36 01 00 00       	push   $0x136
+  802a46:	68 90 43 80 00       	push   $0x804390
+  802a4b:	e8 8e d6 ff ff       	call   8000de <_panic>
+  802a50:	8b b5 74 fd ff ff    	mov    -0x28c(%ebp),%esi
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  802a56:	c1 e6 0c             	shl    $0xc,%esi
+  802a59:	01 b5 88 fd ff ff    	add    %esi,-0x278(%ebp)
+  802a5f:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802a65:	89 c7                	mov    %eax,%edi
+  802a67:	8b 8d 80 fd ff ff    	mov    -0x280(%ebp),%ecx
+  802a6d:	39 c8                	cmp    %ecx,%eax
+  802a6f:	73 6e                	jae    802adf <spawn+0x496>
+		if (i >= filesz) {
+  802a71:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802a77:	39 8d 88 fd ff ff    	cmp    %ecx,-0x278(%ebp)
+  802a7d:	0f 83 08 fe ff ff    	jae    80288b <spawn+0x242>
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+  802a83:	f6 85 94 fd ff ff 02 	testb  $0x2,-0x26c(%ebp)
+  802a8a:	75 27                	jne    802ab3 <spawn+0x46a>
+  802a8c:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802a92:	05 00 10 00 00       	add    $0x1000,%eax
+  802a97:	8b 95 84 fd ff ff    	mov    -0x27c(%ebp),%edx
+  802a9d:	39 c2                	cmp    %eax,%edx
+  802a9f:	0f 83 18 fe ff ff    	jae    8028bd <spawn+0x274>
+  802aa5:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802aab:	39 c2                	cmp    %eax,%edx
+  802aad:	0f 83 0a fe ff ff    	jae    8028bd <spawn+0x274>
+			n = MIN(FSBULK_MAXPAGES, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  802ab3:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802ab9:	29 f8                	sub    %edi,%eax
+  802abb:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  802ac1:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802ac6:	c1 e8 0c             	shr    $0xc,%eax
+  802ac9:	89 c6                	mov    %eax,%esi
+  802acb:	b8 40 00 00 00       	mov    $0x40,%eax
+  802ad0:	39 c6                	cmp    %eax,%esi
+  802ad2:	0f 47 f0             	cmova  %eax,%esi
+			for (j = 0; j < n; j++)
+  802ad5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ada:	e9 72 fe ff ff       	jmp    802951 <spawn+0x308>
+  802adf:	8b bd 68 fd ff ff    	mov    -0x298(%ebp),%edi
+  802ae5:	8b b5 64 fd ff ff    	mov    -0x29c(%ebp),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802aeb:	83 c7 01             	add    $0x1,%edi
+  802aee:	83 c6 20             	add    $0x20,%esi
+  802af1:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802af8:	39 f8                	cmp    %edi,%eax
+  802afa:	0f 8e 88 00 00 00    	jle    802b88 <spawn+0x53f>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802b00:	83 3e 01             	cmpl   $0x1,(%esi)
+  802b03:	75 e6                	jne    802aeb <spawn+0x4a2>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802b05:	8b 46 18             	mov    0x18(%esi),%eax
+  802b08:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802b0b:	83 f8 01             	cmp    $0x1,%eax
+  802b0e:	19 c0                	sbb    %eax,%eax
+  802b10:	83 e0 fe             	and    $0xfffffffe,%eax
+  802b13:	83 c0 07             	add    $0x7,%eax
+  802b16:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802b1c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802b1f:	89 8d 78 fd ff ff    	mov    %ecx,-0x288(%ebp)
+  802b25:	8b 5e 10             	mov    0x10(%esi),%ebx
+  802b28:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  802b2e:	8b 46 14             	mov    0x14(%esi),%eax
+  802b31:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  802b37:	8b 56 08             	mov    0x8(%esi),%edx
+	if ((i = PGOFF(va))) {
+  802b3a:	89 d0                	mov    %edx,%eax
+  802b3c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802b41:	74 18                	je     802b5b <spawn+0x512>
+		va -= i;
+  802b43:	29 c2                	sub    %eax,%edx
+		memsz += i;
+  802b45:	01 85 80 fd ff ff    	add    %eax,-0x280(%ebp)
+		filesz += i;
+  802b4b:	01 c3                	add    %eax,%ebx
+  802b4d:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+		fileoffset -= i;
+  802b53:	29 c1                	sub    %eax,%ecx
+  802b55:	89 8d 78 fd ff ff    	mov    %ecx,-0x288(%ebp)
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  802b5b:	c7 85 88 fd ff ff 00 	movl   $0x0,-0x278(%ebp)
+  802b62:	00 00 00 
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  802b65:	8d 82 00 00 c0 ff    	lea    -0x400000(%edx),%eax
+  802b6b:	89 85 70 fd ff ff    	mov    %eax,-0x290(%ebp)
+  802b71:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+  802b77:	89 bd 68 fd ff ff    	mov    %edi,-0x298(%ebp)
+  802b7d:	89 b5 64 fd ff ff    	mov    %esi,-0x29c(%ebp)
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  802b83:	e9 d7 fe ff ff       	jmp    802a5f <spawn+0x416>
+	close(fd);
+  802b88:	83 ec 0c             	sub    $0xc,%esp
+  802b8b:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  802b91:	e8 c5 e5 ff ff       	call   80115b <close>
+  802b96:	83 c4 10             	add    $0x10,%esp
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+	// LAB 5: Your code here.
+	int r = 0;
+  802b99:	ba 00 00 00 00       	mov    $0x0,%edx
+
+	for (uintptr_t va = 0; va < UTOP; va += PGSIZE) {
+  802b9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ba3:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  802ba9:	eb 14                	jmp    802bbf <spawn+0x576>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+			va += PTSIZE - PGSIZE;
+  802bab:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t va = 0; va < UTOP; va += PGSIZE) {
+  802bb1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802bb7:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802bbd:	77 65                	ja     802c24 <spawn+0x5db>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  802bbf:	89 d8                	mov    %ebx,%eax
+  802bc1:	c1 e8 16             	shr    $0x16,%eax
+  802bc4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802bcb:	a8 01                	test   $0x1,%al
+  802bcd:	74 dc                	je     802bab <spawn+0x562>
+			continue;
+		}
+		if (!(uvpt[PGNUM(va)] & PTE_P) || !(uvpt[PGNUM(va)] & PTE_SHARE))
+  802bcf:	89 d8                	mov    %ebx,%eax
+  802bd1:	c1 e8 0c             	shr    $0xc,%eax
+  802bd4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802bdb:	f6 c1 01             	test   $0x1,%cl
+  802bde:	74 d1                	je     802bb1 <spawn+0x568>
+  802be0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802be7:	f6 c5 04             	test   $0x4,%ch
+  802bea:	74 c5                	je     802bb1 <spawn+0x568>
+			continue;
+		r = sys_page_map(0, (void *) va, child, (void *) va,
+				 uvpt[PGNUM(va)] & PTE_SYSCALL);
+  802bec:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+		r = sys_page_map(0, (void *) va, child, (void *) va,
+  802bf3:	83 ec 0c             	sub    $0xc,%esp
+  802bf6:	25 07 0e 00 00       	and    $0xe07,%eax
+  802bfb:	50                   	push   %eax
+  802bfc:	53                   	push   %ebx
+  802bfd:	56                   	push   %esi
+  802bfe:	53                   	push   %ebx
+  802bff:	6a 00                	push   $0x0
+  802c01:	e8 f8 df ff ff       	call   800bfe <sys_page_map>
+  802c06:	89 c2                	mov    %eax,%edx
+		if (r < 0)
+  802c08:	83 c4 20             	add    $0x20,%esp
+  802c0b:	85 c0                	test   %eax,%eax
+  802c0d:	79 a2                	jns    802bb1 <spawn+0x568>
+		panic("copy_shared_pages: %e", r);
+  802c0f:	52                   	push   %edx
+  802c10:	68 b9 43 80 00       	push   $0x8043b9
+  802c15:	68 80 00 00 00       	push   $0x80
+  802c1a:	68 90 43 80 00       	push   $0x804390
+  802c1f:	e8 ba d4 ff ff       	call   8000de <_panic>
+	if ((r = copy_shared_pages(child)) < 0)
+  802c24:	85 d2                	test   %edx,%edx
+  802c26:	78 e7                	js     802c0f <spawn+0x5c6>
+	child_tf.tf_eflags |= FL_IOPL_3;   // devious: see user/faultio.c
+  802c28:	81 8d dc fd ff ff 00 	orl    $0x3000,-0x224(%ebp)
+  802c2f:	30 00 00 
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802c32:	83 ec 08             	sub    $0x8,%esp
+  802c35:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802c3b:	50                   	push   %eax
+  802c3c:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802c42:	e8 8d e0 ff ff       	call   800cd4 <sys_env_set_trapframe>
+  802c47:	83 c4 10             	add    $0x10,%esp
+  802c4a:	85 c0                	test   %eax,%eax
+  802c4c:	78 25                	js     802c73 <spawn+0x62a>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802c4e:	83 ec 08             	sub    $0x8,%esp
+  802c51:	6a 02                	push   $0x2
+  802c53:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802c59:	e8 2c e0 ff ff       	call   800c8a <sys_env_set_status>
+  802c5e:	83 c4 10             	add    $0x10,%esp
+  802c61:	85 c0                	test   %eax,%eax
+  802c63:	78 23                	js     802c88 <spawn+0x63f>
+	return child;
+  802c65:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802c6b:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802c71:	eb 36                	jmp    802ca9 <spawn+0x660>
+		panic("sys_env_set_trapframe: %e", r);
+  802c73:	50                   	push   %eax
+  802c74:	68 cf 43 80 00       	push   $0x8043cf
+  802c79:	68 84 00 00 00       	push   $0x84
+  802c7e:	68 90 43 80 00       	push   $0x804390
+  802c83:	e8 56 d4 ff ff       	call   8000de <_panic>
+		panic("sys_env_set_status: %e", r);
+  802c88:	50                   	push   %eax
+  802c89:	68 e9 43 80 00       	push   $0x8043e9
+  802c8e:	68 87 00 00 00       	push   $0x87
+  802c93:	68 90 43 80 00       	push   $0x804390
+  802c98:	e8 41 d4 ff ff       	call   8000de <_panic>
+		return r;
+  802c9d:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802ca3:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+}
+  802ca9:	8b 85 7c fd ff ff    	mov    -0x284(%ebp),%eax
+  802caf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cb2:	5b                   	pop    %ebx
+  802cb3:	5e                   	pop    %esi
+  802cb4:	5f                   	pop    %edi
+  802cb5:	5d                   	pop    %ebp
+  802cb6:	c3                   	ret
+  802cb7:	89 c7                	mov    %eax,%edi
+  802cb9:	e9 b7 fc ff ff       	jmp    802975 <spawn+0x32c>
+  802cbe:	89 c7                	mov    %eax,%edi
+  802cc0:	e9 b0 fc ff ff       	jmp    802975 <spawn+0x32c>
+		return -E_NO_MEM;
+  802cc5:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802cca:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802cd0:	eb d7                	jmp    802ca9 <spawn+0x660>
+	sys_page_unmap(0, UTEMP);
+  802cd2:	83 ec 08             	sub    $0x8,%esp
+  802cd5:	68 00 00 40 00       	push   $0x400000
+  802cda:	6a 00                	push   $0x0
+  802cdc:	e8 5f df ff ff       	call   800c40 <sys_page_unmap>
+  802ce1:	83 c4 10             	add    $0x10,%esp
+  802ce4:	89 9d 7c fd ff ff    	mov    %ebx,-0x284(%ebp)
+  802cea:	eb bd                	jmp    802ca9 <spawn+0x660>
+
+00802cec <spawnl>:
+{
+  802cec:	55                   	push   %ebp
+  802ced:	89 e5                	mov    %esp,%ebp
+  802cef:	56                   	push   %esi
+  802cf0:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802cf1:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  802cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  802cf9:	eb 05                	jmp    802d00 <spawnl+0x14>
+		argc++;
+  802cfb:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  802cfe:	89 ca                	mov    %ecx,%edx
+  802d00:	8d 4a 04             	lea    0x4(%edx),%ecx
+  802d03:	83 3a 00             	cmpl   $0x0,(%edx)
+  802d06:	75 f3                	jne    802cfb <spawnl+0xf>
+	const char *argv[argc+2];
+  802d08:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  802d0f:	83 e2 f0             	and    $0xfffffff0,%edx
+  802d12:	29 d4                	sub    %edx,%esp
+  802d14:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802d18:	89 da                	mov    %ebx,%edx
+  802d1a:	c1 ea 02             	shr    $0x2,%edx
+  802d1d:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802d20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d23:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802d2a:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  802d31:	00 
+	va_start(vl, arg0);
+  802d32:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  802d35:	89 c2                	mov    %eax,%edx
+  802d37:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d3c:	eb 0b                	jmp    802d49 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  802d3e:	83 c0 01             	add    $0x1,%eax
+  802d41:	8b 31                	mov    (%ecx),%esi
+  802d43:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802d46:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802d49:	39 d0                	cmp    %edx,%eax
+  802d4b:	75 f1                	jne    802d3e <spawnl+0x52>
+	return spawn(prog, argv);
+  802d4d:	83 ec 08             	sub    $0x8,%esp
+  802d50:	53                   	push   %ebx
+  802d51:	ff 75 08             	push   0x8(%ebp)
+  802d54:	e8 f0 f8 ff ff       	call   802649 <spawn>
+}
+  802d59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d5c:	5b                   	pop    %ebx
+  802d5d:	5e                   	pop    %esi
+  802d5e:	5d                   	pop    %ebp
+  802d5f:	c3                   	ret
+
+00802d60 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d60:	55                   	push   %ebp
+  802d61:	89 e5                	mov    %esp,%ebp
+  802d63:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802d66:	68 26 44 80 00       	push   $0x804426
+  802d6b:	ff 75 0c             	push   0xc(%ebp)
+  802d6e:	e8 34 da ff ff       	call   8007a7 <strcpy>
+	return 0;
+}
+  802d73:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d78:	c9                   	leave
+  802d79:	c3                   	ret
+
+00802d7a <devsock_close>:
+{
+  802d7a:	55                   	push   %ebp
+  802d7b:	89 e5                	mov    %esp,%ebp
+  802d7d:	53                   	push   %ebx
+  802d7e:	83 ec 10             	sub    $0x10,%esp
+  802d81:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802d84:	53                   	push   %ebx
+  802d85:	e8 f4 0d 00 00       	call   803b7e <pageref>
+  802d8a:	89 c2                	mov    %eax,%edx
+  802d8c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802d8f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802d94:	83 fa 01             	cmp    $0x1,%edx
+  802d97:	74 05                	je     802d9e <devsock_close+0x24>
+}
+  802d99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d9c:	c9                   	leave
+  802d9d:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802d9e:	83 ec 0c             	sub    $0xc,%esp
+  802da1:	ff 73 0c             	push   0xc(%ebx)
+  802da4:	e8 b7 02 00 00       	call   803060 <nsipc_close>
+  802da9:	83 c4 10             	add    $0x10,%esp
+  802dac:	eb eb                	jmp    802d99 <devsock_close+0x1f>
+
+00802dae <devsock_write>:
+{
+  802dae:	55                   	push   %ebp
+  802daf:	89 e5                	mov    %esp,%ebp
+  802db1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802db4:	6a 00                	push   $0x0
+  802db6:	ff 75 10             	push   0x10(%ebp)
+  802db9:	ff 75 0c             	push   0xc(%ebp)
+  802dbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dbf:	ff 70 0c             	push   0xc(%eax)
+  802dc2:	e8 79 03 00 00       	call   803140 <nsipc_send>
+}
+  802dc7:	c9                   	leave
+  802dc8:	c3                   	ret
+
+00802dc9 <devsock_read>:
+{
+  802dc9:	55                   	push   %ebp
+  802dca:	89 e5                	mov    %esp,%ebp
+  802dcc:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802dcf:	6a 00                	push   $0x0
+  802dd1:	ff 75 10             	push   0x10(%ebp)
+  802dd4:	ff 75 0c             	push   0xc(%ebp)
+  802dd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dda:	ff 70 0c             	push   0xc(%eax)
+  802ddd:	e8 ef 02 00 00       	call   8030d1 <nsipc_recv>
+}
+  802de2:	c9                   	leave
+  802de3:	c3                   	ret
+
+00802de4 <fd2sockid>:
+{
+  802de4:	55                   	push   %ebp
+  802de5:	89 e5                	mov    %esp,%ebp
+  802de7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802dea:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802ded:	52                   	push   %edx
+  802dee:	50                   	push   %eax
+  802def:	e8 3d e2 ff ff       	call   801031 <fd_lookup>
+  802df4:	83 c4 10             	add    $0x10,%esp
+  802df7:	85 c0                	test   %eax,%eax
+  802df9:	78 10                	js     802e0b <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802dfb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dfe:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802e04:	39 08                	cmp    %ecx,(%eax)
+  802e06:	75 05                	jne    802e0d <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802e08:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802e0b:	c9                   	leave
+  802e0c:	c3                   	ret
+		return -E_NOT_SUPP;
+  802e0d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802e12:	eb f7                	jmp    802e0b <fd2sockid+0x27>
+
+00802e14 <alloc_sockfd>:
+{
+  802e14:	55                   	push   %ebp
+  802e15:	89 e5                	mov    %esp,%ebp
+  802e17:	56                   	push   %esi
+  802e18:	53                   	push   %ebx
+  802e19:	83 ec 1c             	sub    $0x1c,%esp
+  802e1c:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802e1e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e21:	50                   	push   %eax
+  802e22:	e8 b4 e1 ff ff       	call   800fdb <fd_alloc>
+  802e27:	89 c3                	mov    %eax,%ebx
+  802e29:	83 c4 10             	add    $0x10,%esp
+  802e2c:	85 c0                	test   %eax,%eax
+  802e2e:	78 43                	js     802e73 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802e30:	83 ec 04             	sub    $0x4,%esp
+  802e33:	68 07 04 00 00       	push   $0x407
+  802e38:	ff 75 f4             	push   -0xc(%ebp)
+  802e3b:	6a 00                	push   $0x0
+  802e3d:	e8 71 dd ff ff       	call   800bb3 <sys_page_alloc>
+  802e42:	89 c3                	mov    %eax,%ebx
+  802e44:	83 c4 10             	add    $0x10,%esp
+  802e47:	85 c0                	test   %eax,%eax
+  802e49:	78 28                	js     802e73 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802e4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e4e:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802e54:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802e56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e59:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802e60:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802e63:	83 ec 0c             	sub    $0xc,%esp
+  802e66:	50                   	push   %eax
+  802e67:	e8 48 e1 ff ff       	call   800fb4 <fd2num>
+  802e6c:	89 c3                	mov    %eax,%ebx
+  802e6e:	83 c4 10             	add    $0x10,%esp
+  802e71:	eb 0c                	jmp    802e7f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802e73:	83 ec 0c             	sub    $0xc,%esp
+  802e76:	56                   	push   %esi
+  802e77:	e8 e4 01 00 00       	call   803060 <nsipc_close>
+		return r;
+  802e7c:	83 c4 10             	add    $0x10,%esp
+}
+  802e7f:	89 d8                	mov    %ebx,%eax
+  802e81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e84:	5b                   	pop    %ebx
+  802e85:	5e                   	pop    %esi
+  802e86:	5d                   	pop    %ebp
+  802e87:	c3                   	ret
+
+00802e88 <accept>:
+{
+  802e88:	55                   	push   %ebp
+  802e89:	89 e5                	mov    %esp,%ebp
+  802e8b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e91:	e8 4e ff ff ff       	call   802de4 <fd2sockid>
+  802e96:	85 c0                	test   %eax,%eax
+  802e98:	78 1b                	js     802eb5 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802e9a:	83 ec 04             	sub    $0x4,%esp
+  802e9d:	ff 75 10             	push   0x10(%ebp)
+  802ea0:	ff 75 0c             	push   0xc(%ebp)
+  802ea3:	50                   	push   %eax
+  802ea4:	e8 0e 01 00 00       	call   802fb7 <nsipc_accept>
+  802ea9:	83 c4 10             	add    $0x10,%esp
+  802eac:	85 c0                	test   %eax,%eax
+  802eae:	78 05                	js     802eb5 <accept+0x2d>
+	return alloc_sockfd(r);
+  802eb0:	e8 5f ff ff ff       	call   802e14 <alloc_sockfd>
+}
+  802eb5:	c9                   	leave
+  802eb6:	c3                   	ret
+
+00802eb7 <bind>:
+{
+  802eb7:	55                   	push   %ebp
+  802eb8:	89 e5                	mov    %esp,%ebp
+  802eba:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ebd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ec0:	e8 1f ff ff ff       	call   802de4 <fd2sockid>
+  802ec5:	85 c0                	test   %eax,%eax
+  802ec7:	78 12                	js     802edb <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802ec9:	83 ec 04             	sub    $0x4,%esp
+  802ecc:	ff 75 10             	push   0x10(%ebp)
+  802ecf:	ff 75 0c             	push   0xc(%ebp)
+  802ed2:	50                   	push   %eax
+  802ed3:	e8 31 01 00 00       	call   803009 <nsipc_bind>
+  802ed8:	83 c4 10             	add    $0x10,%esp
+}
+  802edb:	c9                   	leave
+  802edc:	c3                   	ret
+
+00802edd <shutdown>:
+{
+  802edd:	55                   	push   %ebp
+  802ede:	89 e5                	mov    %esp,%ebp
+  802ee0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ee3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ee6:	e8 f9 fe ff ff       	call   802de4 <fd2sockid>
+  802eeb:	85 c0                	test   %eax,%eax
+  802eed:	78 0f                	js     802efe <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802eef:	83 ec 08             	sub    $0x8,%esp
+  802ef2:	ff 75 0c             	push   0xc(%ebp)
+  802ef5:	50                   	push   %eax
+  802ef6:	e8 43 01 00 00       	call   80303e <nsipc_shutdown>
+  802efb:	83 c4 10             	add    $0x10,%esp
+}
+  802efe:	c9                   	leave
+  802eff:	c3                   	ret
+
+00802f00 <connect>:
+{
+  802f00:	55                   	push   %ebp
+  802f01:	89 e5                	mov    %esp,%ebp
+  802f03:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f06:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f09:	e8 d6 fe ff ff       	call   802de4 <fd2sockid>
+  802f0e:	85 c0                	test   %eax,%eax
+  802f10:	78 12                	js     802f24 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802f12:	83 ec 04             	sub    $0x4,%esp
+  802f15:	ff 75 10             	push   0x10(%ebp)
+  802f18:	ff 75 0c             	push   0xc(%ebp)
+  802f1b:	50                   	push   %eax
+  802f1c:	e8 59 01 00 00       	call   80307a <nsipc_connect>
+  802f21:	83 c4 10             	add    $0x10,%esp
+}
+  802f24:	c9                   	leave
+  802f25:	c3                   	ret
+
+00802f26 <listen>:
+{
+  802f26:	55                   	push   %ebp
+  802f27:	89 e5                	mov    %esp,%ebp
+  802f29:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f2f:	e8 b0 fe ff ff       	call   802de4 <fd2sockid>
+  802f34:	85 c0                	test   %eax,%eax
+  802f36:	78 0f                	js     802f47 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802f38:	83 ec 08             	sub    $0x8,%esp
+  802f3b:	ff 75 0c             	push   0xc(%ebp)
+  802f3e:	50                   	push   %eax
+  802f3f:	e8 6b 01 00 00       	call   8030af <nsipc_listen>
+  802f44:	83 c4 10             	add    $0x10,%esp
+}
+  802f47:	c9                   	leave
+  802f48:	c3                   	ret
+
+00802f49 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802f49:	55                   	push   %ebp
+  802f4a:	89 e5                	mov    %esp,%ebp
+  802f4c:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802f4f:	ff 75 10             	push   0x10(%ebp)
+  802f52:	ff 75 0c             	push   0xc(%ebp)
+  802f55:	ff 75 08             	push   0x8(%ebp)
+  802f58:	e8 41 02 00 00       	call   80319e <nsipc_socket>
+  802f5d:	83 c4 10             	add    $0x10,%esp
+  802f60:	85 c0                	test   %eax,%eax
+  802f62:	78 05                	js     802f69 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802f64:	e8 ab fe ff ff       	call   802e14 <alloc_sockfd>
+}
+  802f69:	c9                   	leave
+  802f6a:	c3                   	ret
+
+00802f6b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802f6b:	55                   	push   %ebp
+  802f6c:	89 e5                	mov    %esp,%ebp
+  802f6e:	53                   	push   %ebx
+  802f6f:	83 ec 04             	sub    $0x4,%esp
+  802f72:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802f74:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802f7b:	74 26                	je     802fa3 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802f7d:	6a 07                	push   $0x7
+  802f7f:	68 00 90 80 00       	push   $0x809000
+  802f84:	53                   	push   %ebx
+  802f85:	ff 35 00 a0 80 00    	push   0x80a000
+  802f8b:	e8 76 0a 00 00       	call   803a06 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802f90:	83 c4 0c             	add    $0xc,%esp
+  802f93:	6a 00                	push   $0x0
+  802f95:	6a 00                	push   $0x0
+  802f97:	6a 00                	push   $0x0
+  802f99:	e8 fd 09 00 00       	call   80399b <ipc_recv>
+}
+  802f9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fa1:	c9                   	leave
+  802fa2:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802fa3:	83 ec 0c             	sub    $0xc,%esp
+  802fa6:	6a 02                	push   $0x2
+  802fa8:	e8 92 0b 00 00       	call   803b3f <ipc_find_env>
+  802fad:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  802fb2:	83 c4 10             	add    $0x10,%esp
+  802fb5:	eb c6                	jmp    802f7d <nsipc+0x12>
+
+00802fb7 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802fb7:	55                   	push   %ebp
+  802fb8:	89 e5                	mov    %esp,%ebp
+  802fba:	56                   	push   %esi
+  802fbb:	53                   	push   %ebx
+  802fbc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802fbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fc2:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802fc7:	8b 06                	mov    (%esi),%eax
+  802fc9:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802fce:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fd3:	e8 93 ff ff ff       	call   802f6b <nsipc>
+  802fd8:	89 c3                	mov    %eax,%ebx
+  802fda:	85 c0                	test   %eax,%eax
+  802fdc:	79 09                	jns    802fe7 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802fde:	89 d8                	mov    %ebx,%eax
+  802fe0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fe3:	5b                   	pop    %ebx
+  802fe4:	5e                   	pop    %esi
+  802fe5:	5d                   	pop    %ebp
+  802fe6:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802fe7:	83 ec 04             	sub    $0x4,%esp
+  802fea:	ff 35 10 90 80 00    	push   0x809010
+  802ff0:	68 00 90 80 00       	push   $0x809000
+  802ff5:	ff 75 0c             	push   0xc(%ebp)
+  802ff8:	e8 30 d9 ff ff       	call   80092d <memmove>
+		*addrlen = ret->ret_addrlen;
+  802ffd:	a1 10 90 80 00       	mov    0x809010,%eax
+  803002:	89 06                	mov    %eax,(%esi)
+  803004:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803007:	eb d5                	jmp    802fde <nsipc_accept+0x27>
+
+00803009 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803009:	55                   	push   %ebp
+  80300a:	89 e5                	mov    %esp,%ebp
+  80300c:	53                   	push   %ebx
+  80300d:	83 ec 08             	sub    $0x8,%esp
+  803010:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803013:	8b 45 08             	mov    0x8(%ebp),%eax
+  803016:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80301b:	53                   	push   %ebx
+  80301c:	ff 75 0c             	push   0xc(%ebp)
+  80301f:	68 04 90 80 00       	push   $0x809004
+  803024:	e8 04 d9 ff ff       	call   80092d <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803029:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  80302f:	b8 02 00 00 00       	mov    $0x2,%eax
+  803034:	e8 32 ff ff ff       	call   802f6b <nsipc>
+}
+  803039:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80303c:	c9                   	leave
+  80303d:	c3                   	ret
+
+0080303e <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80303e:	55                   	push   %ebp
+  80303f:	89 e5                	mov    %esp,%ebp
+  803041:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803044:	8b 45 08             	mov    0x8(%ebp),%eax
+  803047:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  80304c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80304f:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  803054:	b8 03 00 00 00       	mov    $0x3,%eax
+  803059:	e8 0d ff ff ff       	call   802f6b <nsipc>
+}
+  80305e:	c9                   	leave
+  80305f:	c3                   	ret
+
+00803060 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803060:	55                   	push   %ebp
+  803061:	89 e5                	mov    %esp,%ebp
+  803063:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803066:	8b 45 08             	mov    0x8(%ebp),%eax
+  803069:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  80306e:	b8 04 00 00 00       	mov    $0x4,%eax
+  803073:	e8 f3 fe ff ff       	call   802f6b <nsipc>
+}
+  803078:	c9                   	leave
+  803079:	c3                   	ret
+
+0080307a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80307a:	55                   	push   %ebp
+  80307b:	89 e5                	mov    %esp,%ebp
+  80307d:	53                   	push   %ebx
+  80307e:	83 ec 08             	sub    $0x8,%esp
+  803081:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803084:	8b 45 08             	mov    0x8(%ebp),%eax
+  803087:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80308c:	53                   	push   %ebx
+  80308d:	ff 75 0c             	push   0xc(%ebp)
+  803090:	68 04 90 80 00       	push   $0x809004
+  803095:	e8 93 d8 ff ff       	call   80092d <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80309a:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  8030a0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8030a5:	e8 c1 fe ff ff       	call   802f6b <nsipc>
+}
+  8030aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030ad:	c9                   	leave
+  8030ae:	c3                   	ret
+
+008030af <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8030af:	55                   	push   %ebp
+  8030b0:	89 e5                	mov    %esp,%ebp
+  8030b2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8030b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030b8:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8030bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8030c0:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8030c5:	b8 06 00 00 00       	mov    $0x6,%eax
+  8030ca:	e8 9c fe ff ff       	call   802f6b <nsipc>
+}
+  8030cf:	c9                   	leave
+  8030d0:	c3                   	ret
+
+008030d1 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8030d1:	55                   	push   %ebp
+  8030d2:	89 e5                	mov    %esp,%ebp
+  8030d4:	56                   	push   %esi
+  8030d5:	53                   	push   %ebx
+  8030d6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8030d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030dc:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  8030e1:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  8030e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030ea:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8030ef:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030f4:	e8 72 fe ff ff       	call   802f6b <nsipc>
+  8030f9:	89 c3                	mov    %eax,%ebx
+  8030fb:	85 c0                	test   %eax,%eax
+  8030fd:	78 22                	js     803121 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8030ff:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803104:	39 c6                	cmp    %eax,%esi
+  803106:	0f 4e c6             	cmovle %esi,%eax
+  803109:	39 c3                	cmp    %eax,%ebx
+  80310b:	7f 1d                	jg     80312a <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80310d:	83 ec 04             	sub    $0x4,%esp
+  803110:	53                   	push   %ebx
+  803111:	68 00 90 80 00       	push   $0x809000
+  803116:	ff 75 0c             	push   0xc(%ebp)
+  803119:	e8 0f d8 ff ff       	call   80092d <memmove>
+  80311e:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803121:	89 d8                	mov    %ebx,%eax
+  803123:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803126:	5b                   	pop    %ebx
+  803127:	5e                   	pop    %esi
+  803128:	5d                   	pop    %ebp
+  803129:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80312a:	68 32 44 80 00       	push   $0x804432
+  80312f:	68 20 43 80 00       	push   $0x804320
+  803134:	6a 62                	push   $0x62
+  803136:	68 47 44 80 00       	push   $0x804447
+  80313b:	e8 9e cf ff ff       	call   8000de <_panic>
+
+00803140 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803140:	55                   	push   %ebp
+  803141:	89 e5                	mov    %esp,%ebp
+  803143:	53                   	push   %ebx
+  803144:	83 ec 04             	sub    $0x4,%esp
+  803147:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80314a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80314d:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803152:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803158:	7f 2e                	jg     803188 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80315a:	83 ec 04             	sub    $0x4,%esp
+  80315d:	53                   	push   %ebx
+  80315e:	ff 75 0c             	push   0xc(%ebp)
+  803161:	68 0c 90 80 00       	push   $0x80900c
+  803166:	e8 c2 d7 ff ff       	call   80092d <memmove>
+	nsipcbuf.send.req_size = size;
+  80316b:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803171:	8b 45 14             	mov    0x14(%ebp),%eax
+  803174:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803179:	b8 08 00 00 00       	mov    $0x8,%eax
+  80317e:	e8 e8 fd ff ff       	call   802f6b <nsipc>
+}
+  803183:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803186:	c9                   	leave
+  803187:	c3                   	ret
+	assert(size < 1600);
+  803188:	68 53 44 80 00       	push   $0x804453
+  80318d:	68 20 43 80 00       	push   $0x804320
+  803192:	6a 6d                	push   $0x6d
+  803194:	68 47 44 80 00       	push   $0x804447
+  803199:	e8 40 cf ff ff       	call   8000de <_panic>
+
+0080319e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80319e:	55                   	push   %ebp
+  80319f:	89 e5                	mov    %esp,%ebp
+  8031a1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8031a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031a7:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  8031ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031af:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  8031b4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8031b7:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8031bc:	b8 09 00 00 00       	mov    $0x9,%eax
+  8031c1:	e8 a5 fd ff ff       	call   802f6b <nsipc>
+}
+  8031c6:	c9                   	leave
+  8031c7:	c3                   	ret
+
+008031c8 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8031c8:	55                   	push   %ebp
+  8031c9:	89 e5                	mov    %esp,%ebp
+  8031cb:	56                   	push   %esi
+  8031cc:	53                   	push   %ebx
+  8031cd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8031d0:	83 ec 0c             	sub    $0xc,%esp
+  8031d3:	ff 75 08             	push   0x8(%ebp)
+  8031d6:	e8 e9 dd ff ff       	call   800fc4 <fd2data>
+  8031db:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8031dd:	83 c4 08             	add    $0x8,%esp
+  8031e0:	68 5f 44 80 00       	push   $0x80445f
+  8031e5:	53                   	push   %ebx
+  8031e6:	e8 bc d5 ff ff       	call   8007a7 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8031eb:	8b 46 04             	mov    0x4(%esi),%eax
+  8031ee:	2b 06                	sub    (%esi),%eax
+  8031f0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8031f6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8031fd:	00 00 00 
+	stat->st_dev = &devpipe;
+  803200:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  803207:	50 80 00 
+	return 0;
+}
+  80320a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803212:	5b                   	pop    %ebx
+  803213:	5e                   	pop    %esi
+  803214:	5d                   	pop    %ebp
+  803215:	c3                   	ret
+
+00803216 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803216:	55                   	push   %ebp
+  803217:	89 e5                	mov    %esp,%ebp
+  803219:	53                   	push   %ebx
+  80321a:	83 ec 0c             	sub    $0xc,%esp
+  80321d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803220:	53                   	push   %ebx
+  803221:	6a 00                	push   $0x0
+  803223:	e8 18 da ff ff       	call   800c40 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803228:	89 1c 24             	mov    %ebx,(%esp)
+  80322b:	e8 94 dd ff ff       	call   800fc4 <fd2data>
+  803230:	83 c4 08             	add    $0x8,%esp
+  803233:	50                   	push   %eax
+  803234:	6a 00                	push   $0x0
+  803236:	e8 05 da ff ff       	call   800c40 <sys_page_unmap>
+}
+  80323b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80323e:	c9                   	leave
+  80323f:	c3                   	ret
+
+00803240 <_pipeisclosed>:
+{
+  803240:	55                   	push   %ebp
+  803241:	89 e5                	mov    %esp,%ebp
+  803243:	57                   	push   %edi
+  803244:	56                   	push   %esi
+  803245:	53                   	push   %ebx
+  803246:	83 ec 1c             	sub    $0x1c,%esp
+  803249:	89 c7                	mov    %eax,%edi
+  80324b:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80324d:	a1 00 60 80 00       	mov    0x806000,%eax
+  803252:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803255:	83 ec 0c             	sub    $0xc,%esp
+  803258:	57                   	push   %edi
+  803259:	e8 20 09 00 00       	call   803b7e <pageref>
+  80325e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803261:	89 34 24             	mov    %esi,(%esp)
+  803264:	e8 15 09 00 00       	call   803b7e <pageref>
+		nn = thisenv->env_runs;
+  803269:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80326f:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  803272:	83 c4 10             	add    $0x10,%esp
+  803275:	39 cb                	cmp    %ecx,%ebx
+  803277:	74 1b                	je     803294 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  803279:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80327c:	75 cf                	jne    80324d <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80327e:	8b 42 58             	mov    0x58(%edx),%eax
+  803281:	6a 01                	push   $0x1
+  803283:	50                   	push   %eax
+  803284:	53                   	push   %ebx
+  803285:	68 66 44 80 00       	push   $0x804466
+  80328a:	e8 2a cf ff ff       	call   8001b9 <cprintf>
+  80328f:	83 c4 10             	add    $0x10,%esp
+  803292:	eb b9                	jmp    80324d <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  803294:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803297:	0f 94 c0             	sete   %al
+  80329a:	0f b6 c0             	movzbl %al,%eax
+}
+  80329d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032a0:	5b                   	pop    %ebx
+  8032a1:	5e                   	pop    %esi
+  8032a2:	5f                   	pop    %edi
+  8032a3:	5d                   	pop    %ebp
+  8032a4:	c3                   	ret
+
+008032a5 <devpipe_write>:
+{
+  8032a5:	55                   	push   %ebp
+  8032a6:	89 e5                	mov    %esp,%ebp
+  8032a8:	57                   	push   %edi
+  8032a9:	56                   	push   %esi
+  8032aa:	53                   	push   %ebx
+  8032ab:	83 ec 28             	sub    $0x28,%esp
+  8032ae:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8032b1:	56                   	push   %esi
+  8032b2:	e8 0d dd ff ff       	call   800fc4 <fd2data>
+  8032b7:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8032b9:	83 c4 10             	add    $0x10,%esp
+  8032bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032c1:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8032c4:	75 09                	jne    8032cf <devpipe_write+0x2a>
+	return i;
+  8032c6:	89 f8                	mov    %edi,%eax
+  8032c8:	eb 23                	jmp    8032ed <devpipe_write+0x48>
+			sys_yield();
+  8032ca:	e8 c5 d8 ff ff       	call   800b94 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8032cf:	8b 43 04             	mov    0x4(%ebx),%eax
+  8032d2:	8b 0b                	mov    (%ebx),%ecx
+  8032d4:	8d 51 20             	lea    0x20(%ecx),%edx
+  8032d7:	39 d0                	cmp    %edx,%eax
+  8032d9:	72 1a                	jb     8032f5 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8032db:	89 da                	mov    %ebx,%edx
+  8032dd:	89 f0                	mov    %esi,%eax
+  8032df:	e8 5c ff ff ff       	call   803240 <_pipeisclosed>
+  8032e4:	85 c0                	test   %eax,%eax
+  8032e6:	74 e2                	je     8032ca <devpipe_write+0x25>
+				return 0;
+  8032e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032f0:	5b                   	pop    %ebx
+  8032f1:	5e                   	pop    %esi
+  8032f2:	5f                   	pop    %edi
+  8032f3:	5d                   	pop    %ebp
+  8032f4:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8032f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8032f8:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8032fc:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8032ff:	89 c2                	mov    %eax,%edx
+  803301:	c1 fa 1f             	sar    $0x1f,%edx
+  803304:	89 d1                	mov    %edx,%ecx
+  803306:	c1 e9 1b             	shr    $0x1b,%ecx
+  803309:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80330c:	83 e2 1f             	and    $0x1f,%edx
+  80330f:	29 ca                	sub    %ecx,%edx
+  803311:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803315:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803319:	83 c0 01             	add    $0x1,%eax
+  80331c:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80331f:	83 c7 01             	add    $0x1,%edi
+  803322:	eb 9d                	jmp    8032c1 <devpipe_write+0x1c>
+
+00803324 <devpipe_read>:
+{
+  803324:	55                   	push   %ebp
+  803325:	89 e5                	mov    %esp,%ebp
+  803327:	57                   	push   %edi
+  803328:	56                   	push   %esi
+  803329:	53                   	push   %ebx
+  80332a:	83 ec 18             	sub    $0x18,%esp
+  80332d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803330:	57                   	push   %edi
+  803331:	e8 8e dc ff ff       	call   800fc4 <fd2data>
+  803336:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803338:	83 c4 10             	add    $0x10,%esp
+  80333b:	be 00 00 00 00       	mov    $0x0,%esi
+  803340:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803343:	75 13                	jne    803358 <devpipe_read+0x34>
+	return i;
+  803345:	89 f0                	mov    %esi,%eax
+  803347:	eb 02                	jmp    80334b <devpipe_read+0x27>
+				return i;
+  803349:	89 f0                	mov    %esi,%eax
+}
+  80334b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80334e:	5b                   	pop    %ebx
+  80334f:	5e                   	pop    %esi
+  803350:	5f                   	pop    %edi
+  803351:	5d                   	pop    %ebp
+  803352:	c3                   	ret
+			sys_yield();
+  803353:	e8 3c d8 ff ff       	call   800b94 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803358:	8b 03                	mov    (%ebx),%eax
+  80335a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80335d:	75 18                	jne    803377 <devpipe_read+0x53>
+			if (i > 0)
+  80335f:	85 f6                	test   %esi,%esi
+  803361:	75 e6                	jne    803349 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803363:	89 da                	mov    %ebx,%edx
+  803365:	89 f8                	mov    %edi,%eax
+  803367:	e8 d4 fe ff ff       	call   803240 <_pipeisclosed>
+  80336c:	85 c0                	test   %eax,%eax
+  80336e:	74 e3                	je     803353 <devpipe_read+0x2f>
+				return 0;
+  803370:	b8 00 00 00 00       	mov    $0x0,%eax
+  803375:	eb d4                	jmp    80334b <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803377:	99                   	cltd
+  803378:	c1 ea 1b             	shr    $0x1b,%edx
+  80337b:	01 d0                	add    %edx,%eax
+  80337d:	83 e0 1f             	and    $0x1f,%eax
+  803380:	29 d0                	sub    %edx,%eax
+  803382:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803387:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80338a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80338d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803390:	83 c6 01             	add    $0x1,%esi
+  803393:	eb ab                	jmp    803340 <devpipe_read+0x1c>
+
+00803395 <pipe>:
+{
+  803395:	55                   	push   %ebp
+  803396:	89 e5                	mov    %esp,%ebp
+  803398:	56                   	push   %esi
+  803399:	53                   	push   %ebx
+  80339a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80339d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033a0:	50                   	push   %eax
+  8033a1:	e8 35 dc ff ff       	call   800fdb <fd_alloc>
+  8033a6:	89 c3                	mov    %eax,%ebx
+  8033a8:	83 c4 10             	add    $0x10,%esp
+  8033ab:	85 c0                	test   %eax,%eax
+  8033ad:	0f 88 23 01 00 00    	js     8034d6 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8033b3:	83 ec 04             	sub    $0x4,%esp
+  8033b6:	68 07 04 00 00       	push   $0x407
+  8033bb:	ff 75 f4             	push   -0xc(%ebp)
+  8033be:	6a 00                	push   $0x0
+  8033c0:	e8 ee d7 ff ff       	call   800bb3 <sys_page_alloc>
+  8033c5:	89 c3                	mov    %eax,%ebx
+  8033c7:	83 c4 10             	add    $0x10,%esp
+  8033ca:	85 c0                	test   %eax,%eax
+  8033cc:	0f 88 04 01 00 00    	js     8034d6 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8033d2:	83 ec 0c             	sub    $0xc,%esp
+  8033d5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8033d8:	50                   	push   %eax
+  8033d9:	e8 fd db ff ff       	call   800fdb <fd_alloc>
+  8033de:	89 c3                	mov    %eax,%ebx
+  8033e0:	83 c4 10             	add    $0x10,%esp
+  8033e3:	85 c0                	test   %eax,%eax
+  8033e5:	0f 88 db 00 00 00    	js     8034c6 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8033eb:	83 ec 04             	sub    $0x4,%esp
+  8033ee:	68 07 04 00 00       	push   $0x407
+  8033f3:	ff 75 f0             	push   -0x10(%ebp)
+  8033f6:	6a 00                	push   $0x0
+  8033f8:	e8 b6 d7 ff ff       	call   800bb3 <sys_page_alloc>
+  8033fd:	89 c3                	mov    %eax,%ebx
+  8033ff:	83 c4 10             	add    $0x10,%esp
+  803402:	85 c0                	test   %eax,%eax
+  803404:	0f 88 bc 00 00 00    	js     8034c6 <pipe+0x131>
+	va = fd2data(fd0);
+  80340a:	83 ec 0c             	sub    $0xc,%esp
+  80340d:	ff 75 f4             	push   -0xc(%ebp)
+  803410:	e8 af db ff ff       	call   800fc4 <fd2data>
+  803415:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803417:	83 c4 0c             	add    $0xc,%esp
+  80341a:	68 07 04 00 00       	push   $0x407
+  80341f:	50                   	push   %eax
+  803420:	6a 00                	push   $0x0
+  803422:	e8 8c d7 ff ff       	call   800bb3 <sys_page_alloc>
+  803427:	89 c3                	mov    %eax,%ebx
+  803429:	83 c4 10             	add    $0x10,%esp
+  80342c:	85 c0                	test   %eax,%eax
+  80342e:	0f 88 82 00 00 00    	js     8034b6 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803434:	83 ec 0c             	sub    $0xc,%esp
+  803437:	ff 75 f0             	push   -0x10(%ebp)
+  80343a:	e8 85 db ff ff       	call   800fc4 <fd2data>
+  80343f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803446:	50                   	push   %eax
+  803447:	6a 00                	push   $0x0
+  803449:	56                   	push   %esi
+  80344a:	6a 00                	push   $0x0
+  80344c:	e8 ad d7 ff ff       	call   800bfe <sys_page_map>
+  803451:	89 c3                	mov    %eax,%ebx
+  803453:	83 c4 20             	add    $0x20,%esp
+  803456:	85 c0                	test   %eax,%eax
+  803458:	78 4e                	js     8034a8 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80345a:	a1 60 50 80 00       	mov    0x805060,%eax
+  80345f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803462:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803464:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803467:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80346e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803471:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803473:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803476:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80347d:	83 ec 0c             	sub    $0xc,%esp
+  803480:	ff 75 f4             	push   -0xc(%ebp)
+  803483:	e8 2c db ff ff       	call   800fb4 <fd2num>
+  803488:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80348b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80348d:	83 c4 04             	add    $0x4,%esp
+  803490:	ff 75 f0             	push   -0x10(%ebp)
+  803493:	e8 1c db ff ff       	call   800fb4 <fd2num>
+  803498:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80349b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80349e:	83 c4 10             	add    $0x10,%esp
+  8034a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034a6:	eb 2e                	jmp    8034d6 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8034a8:	83 ec 08             	sub    $0x8,%esp
+  8034ab:	56                   	push   %esi
+  8034ac:	6a 00                	push   $0x0
+  8034ae:	e8 8d d7 ff ff       	call   800c40 <sys_page_unmap>
+  8034b3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8034b6:	83 ec 08             	sub    $0x8,%esp
+  8034b9:	ff 75 f0             	push   -0x10(%ebp)
+  8034bc:	6a 00                	push   $0x0
+  8034be:	e8 7d d7 ff ff       	call   800c40 <sys_page_unmap>
+  8034c3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8034c6:	83 ec 08             	sub    $0x8,%esp
+  8034c9:	ff 75 f4             	push   -0xc(%ebp)
+  8034cc:	6a 00                	push   $0x0
+  8034ce:	e8 6d d7 ff ff       	call   800c40 <sys_page_unmap>
+  8034d3:	83 c4 10             	add    $0x10,%esp
+}
+  8034d6:	89 d8                	mov    %ebx,%eax
+  8034d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034db:	5b                   	pop    %ebx
+  8034dc:	5e                   	pop    %esi
+  8034dd:	5d                   	pop    %ebp
+  8034de:	c3                   	ret
+
+008034df <pipeisclosed>:
+{
+  8034df:	55                   	push   %ebp
+  8034e0:	89 e5                	mov    %esp,%ebp
+  8034e2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8034e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034e8:	50                   	push   %eax
+  8034e9:	ff 75 08             	push   0x8(%ebp)
+  8034ec:	e8 40 db ff ff       	call   801031 <fd_lookup>
+  8034f1:	83 c4 10             	add    $0x10,%esp
+  8034f4:	85 c0                	test   %eax,%eax
+  8034f6:	78 18                	js     803510 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8034f8:	83 ec 0c             	sub    $0xc,%esp
+  8034fb:	ff 75 f4             	push   -0xc(%ebp)
+  8034fe:	e8 c1 da ff ff       	call   800fc4 <fd2data>
+  803503:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803505:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803508:	e8 33 fd ff ff       	call   803240 <_pipeisclosed>
+  80350d:	83 c4 10             	add    $0x10,%esp
+}
+  803510:	c9                   	leave
+  803511:	c3                   	ret
+
+00803512 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803512:	b8 00 00 00 00       	mov    $0x0,%eax
+  803517:	c3                   	ret
+
+00803518 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803518:	55                   	push   %ebp
+  803519:	89 e5                	mov    %esp,%ebp
+  80351b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80351e:	68 7e 44 80 00       	push   $0x80447e
+  803523:	ff 75 0c             	push   0xc(%ebp)
+  803526:	e8 7c d2 ff ff       	call   8007a7 <strcpy>
+	return 0;
+}
+  80352b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803530:	c9                   	leave
+  803531:	c3                   	ret
+
+00803532 <devcons_write>:
+{
+  803532:	55                   	push   %ebp
+  803533:	89 e5                	mov    %esp,%ebp
+  803535:	57                   	push   %edi
+  803536:	56                   	push   %esi
+  803537:	53                   	push   %ebx
+  803538:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80353e:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803543:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803549:	eb 2e                	jmp    803579 <devcons_write+0x47>
+		m = n - tot;
+  80354b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80354e:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803550:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803555:	39 c3                	cmp    %eax,%ebx
+  803557:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80355a:	83 ec 04             	sub    $0x4,%esp
+  80355d:	53                   	push   %ebx
+  80355e:	89 f0                	mov    %esi,%eax
+  803560:	03 45 0c             	add    0xc(%ebp),%eax
+  803563:	50                   	push   %eax
+  803564:	57                   	push   %edi
+  803565:	e8 c3 d3 ff ff       	call   80092d <memmove>
+		sys_cputs(buf, m);
+  80356a:	83 c4 08             	add    $0x8,%esp
+  80356d:	53                   	push   %ebx
+  80356e:	57                   	push   %edi
+  80356f:	e8 63 d5 ff ff       	call   800ad7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803574:	01 de                	add    %ebx,%esi
+  803576:	83 c4 10             	add    $0x10,%esp
+  803579:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80357c:	72 cd                	jb     80354b <devcons_write+0x19>
+}
+  80357e:	89 f0                	mov    %esi,%eax
+  803580:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803583:	5b                   	pop    %ebx
+  803584:	5e                   	pop    %esi
+  803585:	5f                   	pop    %edi
+  803586:	5d                   	pop    %ebp
+  803587:	c3                   	ret
+
+00803588 <devcons_read>:
+{
+  803588:	55                   	push   %ebp
+  803589:	89 e5                	mov    %esp,%ebp
+  80358b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80358e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803593:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803597:	75 07                	jne    8035a0 <devcons_read+0x18>
+  803599:	eb 1f                	jmp    8035ba <devcons_read+0x32>
+		sys_yield();
+  80359b:	e8 f4 d5 ff ff       	call   800b94 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8035a0:	e8 58 d5 ff ff       	call   800afd <sys_cgetc>
+  8035a5:	85 c0                	test   %eax,%eax
+  8035a7:	74 f2                	je     80359b <devcons_read+0x13>
+	if (c < 0)
+  8035a9:	78 0f                	js     8035ba <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8035ab:	83 f8 04             	cmp    $0x4,%eax
+  8035ae:	74 0c                	je     8035bc <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8035b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035b3:	88 02                	mov    %al,(%edx)
+	return 1;
+  8035b5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8035ba:	c9                   	leave
+  8035bb:	c3                   	ret
+		return 0;
+  8035bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c1:	eb f7                	jmp    8035ba <devcons_read+0x32>
+
+008035c3 <cputchar>:
+{
+  8035c3:	55                   	push   %ebp
+  8035c4:	89 e5                	mov    %esp,%ebp
+  8035c6:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8035c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035cc:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8035cf:	6a 01                	push   $0x1
+  8035d1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035d4:	50                   	push   %eax
+  8035d5:	e8 fd d4 ff ff       	call   800ad7 <sys_cputs>
+}
+  8035da:	83 c4 10             	add    $0x10,%esp
+  8035dd:	c9                   	leave
+  8035de:	c3                   	ret
+
+008035df <getchar>:
+{
+  8035df:	55                   	push   %ebp
+  8035e0:	89 e5                	mov    %esp,%ebp
+  8035e2:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8035e5:	6a 01                	push   $0x1
+  8035e7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035ea:	50                   	push   %eax
+  8035eb:	6a 00                	push   $0x0
+  8035ed:	e8 a5 dc ff ff       	call   801297 <read>
+	if (r < 0)
+  8035f2:	83 c4 10             	add    $0x10,%esp
+  8035f5:	85 c0                	test   %eax,%eax
+  8035f7:	78 06                	js     8035ff <getchar+0x20>
+	if (r < 1)
+  8035f9:	74 06                	je     803601 <getchar+0x22>
+	return c;
+  8035fb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8035ff:	c9                   	leave
+  803600:	c3                   	ret
+		return -E_EOF;
+  803601:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803606:	eb f7                	jmp    8035ff <getchar+0x20>
+
+00803608 <iscons>:
+{
+  803608:	55                   	push   %ebp
+  803609:	89 e5                	mov    %esp,%ebp
+  80360b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80360e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803611:	50                   	push   %eax
+  803612:	ff 75 08             	push   0x8(%ebp)
+  803615:	e8 17 da ff ff       	call   801031 <fd_lookup>
+  80361a:	83 c4 10             	add    $0x10,%esp
+  80361d:	85 c0                	test   %eax,%eax
+  80361f:	78 11                	js     803632 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803621:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803624:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80362a:	39 10                	cmp    %edx,(%eax)
+  80362c:	0f 94 c0             	sete   %al
+  80362f:	0f b6 c0             	movzbl %al,%eax
+}
+  803632:	c9                   	leave
+  803633:	c3                   	ret
+
+00803634 <opencons>:
+{
+  803634:	55                   	push   %ebp
+  803635:	89 e5                	mov    %esp,%ebp
+  803637:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80363a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80363d:	50                   	push   %eax
+  80363e:	e8 98 d9 ff ff       	call   800fdb <fd_alloc>
+  803643:	83 c4 10             	add    $0x10,%esp
+  803646:	85 c0                	test   %eax,%eax
+  803648:	78 3a                	js     803684 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80364a:	83 ec 04             	sub    $0x4,%esp
+  80364d:	68 07 04 00 00       	push   $0x407
+  803652:	ff 75 f4             	push   -0xc(%ebp)
+  803655:	6a 00                	push   $0x0
+  803657:	e8 57 d5 ff ff       	call   800bb3 <sys_page_alloc>
+  80365c:	83 c4 10             	add    $0x10,%esp
+  80365f:	85 c0                	test   %eax,%eax
+  803661:	78 21                	js     803684 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803663:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803666:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80366c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80366e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803671:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803678:	83 ec 0c             	sub    $0xc,%esp
+  80367b:	50                   	push   %eax
+  80367c:	e8 33 d9 ff ff       	call   800fb4 <fd2num>
+  803681:	83 c4 10             	add    $0x10,%esp
+}
+  803684:	c9                   	leave
+  803685:	c3                   	ret
+
+00803686 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  803686:	55                   	push   %ebp
+  803687:	89 e5                	mov    %esp,%ebp
+  803689:	57                   	push   %edi
+  80368a:	56                   	push   %esi
+  80368b:	53                   	push   %ebx
+  80368c:	83 ec 20             	sub    $0x20,%esp
+  80368f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803692:	89 d7                	mov    %edx,%edi
+  803694:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  803696:	51                   	push   %ecx
+  803697:	68 00 f0 7f 00       	push   $0x7ff000
+  80369c:	6a 00                	push   $0x0
+  80369e:	e8 10 d5 ff ff       	call   800bb3 <sys_page_alloc>
+  8036a3:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8036a5:	83 c4 10             	add    $0x10,%esp
+  8036a8:	85 c0                	test   %eax,%eax
+  8036aa:	78 45                	js     8036f1 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  8036ac:	83 ec 04             	sub    $0x4,%esp
+  8036af:	68 00 10 00 00       	push   $0x1000
+  8036b4:	57                   	push   %edi
+  8036b5:	68 00 f0 7f 00       	push   $0x7ff000
+  8036ba:	e8 6e d2 ff ff       	call   80092d <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8036bf:	89 34 24             	mov    %esi,(%esp)
+  8036c2:	57                   	push   %edi
+  8036c3:	ff 75 e4             	push   -0x1c(%ebp)
+  8036c6:	68 00 f0 7f 00       	push   $0x7ff000
+  8036cb:	6a 00                	push   $0x0
+  8036cd:	e8 2c d5 ff ff       	call   800bfe <sys_page_map>
+  8036d2:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8036d4:	83 c4 20             	add    $0x20,%esp
+  8036d7:	85 c0                	test   %eax,%eax
+  8036d9:	78 16                	js     8036f1 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8036db:	83 ec 08             	sub    $0x8,%esp
+  8036de:	68 00 f0 7f 00       	push   $0x7ff000
+  8036e3:	6a 00                	push   $0x0
+  8036e5:	e8 56 d5 ff ff       	call   800c40 <sys_page_unmap>
+  8036ea:	83 c4 10             	add    $0x10,%esp
+  8036ed:	85 c0                	test   %eax,%eax
+  8036ef:	75 0a                	jne    8036fb <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8036f1:	89 d8                	mov    %ebx,%eax
+  8036f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036f6:	5b                   	pop    %ebx
+  8036f7:	5e                   	pop    %esi
+  8036f8:	5f                   	pop    %edi
+  8036f9:	5d                   	pop    %ebp
+  8036fa:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8036fb:	68 8c 44 80 00       	push   $0x80448c
+  803700:	68 20 43 80 00       	push   $0x804320
+  803705:	6a 1b                	push   $0x1b
+  803707:	68 04 45 80 00       	push   $0x804504
+  80370c:	e8 cd c9 ff ff       	call   8000de <_panic>
+
+00803711 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803711:	55                   	push   %ebp
+  803712:	89 e5                	mov    %esp,%ebp
+  803714:	53                   	push   %ebx
+  803715:	83 ec 04             	sub    $0x4,%esp
+  803718:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  80371b:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80371d:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  803721:	74 21                	je     803744 <pgfault+0x33>
+  803723:	89 d0                	mov    %edx,%eax
+  803725:	c1 e8 16             	shr    $0x16,%eax
+  803728:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80372f:	a8 01                	test   $0x1,%al
+  803731:	74 11                	je     803744 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803733:	89 d0                	mov    %edx,%eax
+  803735:	c1 e8 0c             	shr    $0xc,%eax
+  803738:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80373f:	f6 c4 08             	test   $0x8,%ah
+  803742:	75 17                	jne    80375b <pgfault+0x4a>
+		if (pgfault_next) {
+  803744:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  803749:	85 c0                	test   %eax,%eax
+  80374b:	74 27                	je     803774 <pgfault+0x63>
+			pgfault_next(utf);
+  80374d:	83 ec 0c             	sub    $0xc,%esp
+  803750:	53                   	push   %ebx
+  803751:	ff d0                	call   *%eax
+			return;
+  803753:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803756:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803759:	c9                   	leave
+  80375a:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  80375b:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803761:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803766:	b8 00 00 00 00       	mov    $0x0,%eax
+  80376b:	e8 16 ff ff ff       	call   803686 <copy_page_to>
+  803770:	85 c0                	test   %eax,%eax
+  803772:	79 e2                	jns    803756 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803774:	a1 00 60 80 00       	mov    0x806000,%eax
+  803779:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  80377c:	ff 73 28             	push   0x28(%ebx)
+  80377f:	ff 33                	push   (%ebx)
+  803781:	50                   	push   %eax
+  803782:	68 b0 44 80 00       	push   $0x8044b0
+  803787:	e8 2d ca ff ff       	call   8001b9 <cprintf>
+	sys_env_destroy(0);
+  80378c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803793:	e8 8c d3 ff ff       	call   800b24 <sys_env_destroy>
+  803798:	83 c4 10             	add    $0x10,%esp
+  80379b:	eb b9                	jmp    803756 <pgfault+0x45>
+
+0080379d <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  80379d:	55                   	push   %ebp
+  80379e:	89 e5                	mov    %esp,%ebp
+  8037a0:	53                   	push   %ebx
+  8037a1:	83 ec 04             	sub    $0x4,%esp
+  8037a4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8037a7:	a1 08 a0 80 00       	mov    0x80a008,%eax
+  8037ac:	3d 11 37 80 00       	cmp    $0x803711,%eax
+  8037b1:	74 15                	je     8037c8 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8037b3:	a3 04 a0 80 00       	mov    %eax,0x80a004
+		set_pgfault_handler(pgfault);
+  8037b8:	83 ec 0c             	sub    $0xc,%esp
+  8037bb:	68 11 37 80 00       	push   $0x803711
+  8037c0:	e8 fb 03 00 00       	call   803bc0 <set_pgfault_handler>
+  8037c5:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8037c8:	83 ec 0c             	sub    $0xc,%esp
+  8037cb:	68 05 08 00 00       	push   $0x805
+  8037d0:	53                   	push   %ebx
+  8037d1:	6a 00                	push   $0x0
+  8037d3:	53                   	push   %ebx
+  8037d4:	6a 00                	push   $0x0
+  8037d6:	e8 23 d4 ff ff       	call   800bfe <sys_page_map>
+}
+  8037db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037de:	c9                   	leave
+  8037df:	c3                   	ret
+
+008037e0 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8037e0:	55                   	push   %ebp
+  8037e1:	89 e5                	mov    %esp,%ebp
+  8037e3:	57                   	push   %edi
+  8037e4:	56                   	push   %esi
+  8037e5:	53                   	push   %ebx
+  8037e6:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8037e9:	68 11 37 80 00       	push   $0x803711
+  8037ee:	e8 cd 03 00 00       	call   803bc0 <set_pgfault_handler>
+  8037f3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8037f8:	cd 30                	int    $0x30
+  8037fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8037fd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  803800:	83 c4 10             	add    $0x10,%esp
+  803803:	85 c0                	test   %eax,%eax
+  803805:	0f 88 6b 01 00 00    	js     803976 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80380b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803810:	75 37                	jne    803849 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803812:	e8 56 d3 ff ff       	call   800b6d <sys_getenvid>
+  803817:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80381c:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803822:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803827:	a3 00 60 80 00       	mov    %eax,0x806000
+		return 0;
+  80382c:	e9 45 01 00 00       	jmp    803976 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803831:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803837:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80383d:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803843:	0f 87 ba 00 00 00    	ja     803903 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803849:	89 d8                	mov    %ebx,%eax
+  80384b:	c1 e8 16             	shr    $0x16,%eax
+  80384e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803855:	a8 01                	test   $0x1,%al
+  803857:	74 d8                	je     803831 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803859:	89 d8                	mov    %ebx,%eax
+  80385b:	c1 e8 0c             	shr    $0xc,%eax
+  80385e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803865:	f6 c2 01             	test   $0x1,%dl
+  803868:	74 cd                	je     803837 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  80386a:	89 da                	mov    %ebx,%edx
+  80386c:	80 e6 df             	and    $0xdf,%dh
+  80386f:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803875:	74 c0                	je     803837 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803877:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803879:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803880:	f6 c6 04             	test   $0x4,%dh
+  803883:	75 53                	jne    8038d8 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803885:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80388c:	f6 c6 08             	test   $0x8,%dh
+  80388f:	75 0c                	jne    80389d <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803891:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803898:	f6 c2 02             	test   $0x2,%dl
+  80389b:	74 3b                	je     8038d8 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80389d:	83 ec 0c             	sub    $0xc,%esp
+  8038a0:	68 05 08 00 00       	push   $0x805
+  8038a5:	57                   	push   %edi
+  8038a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8038a9:	57                   	push   %edi
+  8038aa:	6a 00                	push   $0x0
+  8038ac:	e8 4d d3 ff ff       	call   800bfe <sys_page_map>
+  8038b1:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8038b3:	83 c4 20             	add    $0x20,%esp
+  8038b6:	85 c0                	test   %eax,%eax
+  8038b8:	0f 88 a7 00 00 00    	js     803965 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8038be:	83 ec 0c             	sub    $0xc,%esp
+  8038c1:	68 05 08 00 00       	push   $0x805
+  8038c6:	57                   	push   %edi
+  8038c7:	6a 00                	push   $0x0
+  8038c9:	57                   	push   %edi
+  8038ca:	6a 00                	push   $0x0
+  8038cc:	e8 2d d3 ff ff       	call   800bfe <sys_page_map>
+  8038d1:	89 c6                	mov    %eax,%esi
+	return r;
+  8038d3:	83 c4 20             	add    $0x20,%esp
+  8038d6:	eb 21                	jmp    8038f9 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8038d8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8038df:	83 ec 0c             	sub    $0xc,%esp
+  8038e2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8038e7:	50                   	push   %eax
+  8038e8:	57                   	push   %edi
+  8038e9:	ff 75 e4             	push   -0x1c(%ebp)
+  8038ec:	57                   	push   %edi
+  8038ed:	6a 00                	push   $0x0
+  8038ef:	e8 0a d3 ff ff       	call   800bfe <sys_page_map>
+  8038f4:	89 c6                	mov    %eax,%esi
+  8038f6:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8038f9:	85 f6                	test   %esi,%esi
+  8038fb:	0f 89 36 ff ff ff    	jns    803837 <fork+0x57>
+  803901:	eb 62                	jmp    803965 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803903:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803908:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  80390d:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803910:	89 f8                	mov    %edi,%eax
+  803912:	e8 6f fd ff ff       	call   803686 <copy_page_to>
+  803917:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803919:	85 c0                	test   %eax,%eax
+  80391b:	78 48                	js     803965 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80391d:	83 ec 04             	sub    $0x4,%esp
+  803920:	6a 07                	push   $0x7
+  803922:	68 00 f0 bf ee       	push   $0xeebff000
+  803927:	57                   	push   %edi
+  803928:	e8 86 d2 ff ff       	call   800bb3 <sys_page_alloc>
+  80392d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80392f:	83 c4 10             	add    $0x10,%esp
+  803932:	85 c0                	test   %eax,%eax
+  803934:	78 2f                	js     803965 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803936:	a1 00 60 80 00       	mov    0x806000,%eax
+  80393b:	8b 40 64             	mov    0x64(%eax),%eax
+  80393e:	83 ec 08             	sub    $0x8,%esp
+  803941:	50                   	push   %eax
+  803942:	57                   	push   %edi
+  803943:	e8 d6 d3 ff ff       	call   800d1e <sys_env_set_pgfault_upcall>
+  803948:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80394a:	83 c4 10             	add    $0x10,%esp
+  80394d:	85 c0                	test   %eax,%eax
+  80394f:	78 14                	js     803965 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803951:	83 ec 08             	sub    $0x8,%esp
+  803954:	6a 02                	push   $0x2
+  803956:	57                   	push   %edi
+  803957:	e8 2e d3 ff ff       	call   800c8a <sys_env_set_status>
+  80395c:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80395e:	83 c4 10             	add    $0x10,%esp
+  803961:	85 c0                	test   %eax,%eax
+  803963:	79 11                	jns    803976 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803965:	83 ec 0c             	sub    $0xc,%esp
+  803968:	ff 75 e0             	push   -0x20(%ebp)
+  80396b:	e8 b4 d1 ff ff       	call   800b24 <sys_env_destroy>
+	return r;
+  803970:	83 c4 10             	add    $0x10,%esp
+  803973:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803976:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803979:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80397c:	5b                   	pop    %ebx
+  80397d:	5e                   	pop    %esi
+  80397e:	5f                   	pop    %edi
+  80397f:	5d                   	pop    %ebp
+  803980:	c3                   	ret
+
+00803981 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803981:	55                   	push   %ebp
+  803982:	89 e5                	mov    %esp,%ebp
+  803984:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803987:	68 0f 45 80 00       	push   $0x80450f
+  80398c:	68 bf 00 00 00       	push   $0xbf
+  803991:	68 04 45 80 00       	push   $0x804504
+  803996:	e8 43 c7 ff ff       	call   8000de <_panic>
+
+0080399b <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80399b:	55                   	push   %ebp
+  80399c:	89 e5                	mov    %esp,%ebp
+  80399e:	56                   	push   %esi
+  80399f:	53                   	push   %ebx
+  8039a0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8039a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8039a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8039a9:	85 c0                	test   %eax,%eax
+  8039ab:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8039b0:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8039b3:	83 ec 0c             	sub    $0xc,%esp
+  8039b6:	50                   	push   %eax
+  8039b7:	e8 3f d4 ff ff       	call   800dfb <sys_ipc_recv>
+	if (from_env_store)
+  8039bc:	83 c4 10             	add    $0x10,%esp
+  8039bf:	85 f6                	test   %esi,%esi
+  8039c1:	74 14                	je     8039d7 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8039c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039c8:	85 c0                	test   %eax,%eax
+  8039ca:	75 09                	jne    8039d5 <ipc_recv+0x3a>
+  8039cc:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8039d2:	8b 52 74             	mov    0x74(%edx),%edx
+  8039d5:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8039d7:	85 db                	test   %ebx,%ebx
+  8039d9:	74 25                	je     803a00 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8039db:	85 c0                	test   %eax,%eax
+  8039dd:	74 0d                	je     8039ec <ipc_recv+0x51>
+  8039df:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8039e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8039e8:	5b                   	pop    %ebx
+  8039e9:	5e                   	pop    %esi
+  8039ea:	5d                   	pop    %ebp
+  8039eb:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8039ec:	a1 00 60 80 00       	mov    0x806000,%eax
+  8039f1:	8b 40 78             	mov    0x78(%eax),%eax
+  8039f4:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8039f6:	a1 00 60 80 00       	mov    0x806000,%eax
+  8039fb:	8b 40 70             	mov    0x70(%eax),%eax
+  8039fe:	eb e5                	jmp    8039e5 <ipc_recv+0x4a>
+  803a00:	85 c0                	test   %eax,%eax
+  803a02:	75 e1                	jne    8039e5 <ipc_recv+0x4a>
+  803a04:	eb f0                	jmp    8039f6 <ipc_recv+0x5b>
+
+00803a06 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803a06:	55                   	push   %ebp
+  803a07:	89 e5                	mov    %esp,%ebp
+  803a09:	57                   	push   %edi
+  803a0a:	56                   	push   %esi
+  803a0b:	53                   	push   %ebx
+  803a0c:	83 ec 0c             	sub    $0xc,%esp
+  803a0f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803a12:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803a15:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803a18:	85 db                	test   %ebx,%ebx
+  803a1a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803a1f:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803a22:	ff 75 14             	push   0x14(%ebp)
+  803a25:	53                   	push   %ebx
+  803a26:	56                   	push   %esi
+  803a27:	57                   	push   %edi
+  803a28:	e8 3b d3 ff ff       	call   800d68 <sys_ipc_try_send>
+  803a2d:	83 c4 10             	add    $0x10,%esp
+  803a30:	85 c0                	test   %eax,%eax
+  803a32:	74 22                	je     803a56 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803a34:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803a37:	75 07                	jne    803a40 <ipc_send+0x3a>
+		sys_yield();
+  803a39:	e8 56 d1 ff ff       	call   800b94 <sys_yield>
+  803a3e:	eb e2                	jmp    803a22 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803a40:	68 25 45 80 00       	push   $0x804525
+  803a45:	68 20 43 80 00       	push   $0x804320
+  803a4a:	6a 39                	push   $0x39
+  803a4c:	68 3a 45 80 00       	push   $0x80453a
+  803a51:	e8 88 c6 ff ff       	call   8000de <_panic>
+	}
+}
+  803a56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a59:	5b                   	pop    %ebx
+  803a5a:	5e                   	pop    %esi
+  803a5b:	5f                   	pop    %edi
+  803a5c:	5d                   	pop    %ebp
+  803a5d:	c3                   	ret
+
+00803a5e <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803a5e:	55                   	push   %ebp
+  803a5f:	89 e5                	mov    %esp,%ebp
+  803a61:	57                   	push   %edi
+  803a62:	56                   	push   %esi
+  803a63:	53                   	push   %ebx
+  803a64:	83 ec 10             	sub    $0x10,%esp
+  803a67:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803a6a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803a6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803a70:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803a73:	85 c0                	test   %eax,%eax
+  803a75:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803a7a:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803a7d:	6a 00                	push   $0x0
+  803a7f:	ff 33                	push   (%ebx)
+  803a81:	50                   	push   %eax
+  803a82:	e8 31 d3 ff ff       	call   800db8 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803a87:	83 c4 10             	add    $0x10,%esp
+  803a8a:	85 c0                	test   %eax,%eax
+  803a8c:	75 3c                	jne    803aca <ipc_recvv+0x6c>
+  803a8e:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803a94:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803a97:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803a99:	85 ff                	test   %edi,%edi
+  803a9b:	74 4e                	je     803aeb <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803a9d:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803aa3:	8b 52 74             	mov    0x74(%edx),%edx
+  803aa6:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803aa8:	85 f6                	test   %esi,%esi
+  803aaa:	74 18                	je     803ac4 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803aac:	85 c0                	test   %eax,%eax
+  803aae:	75 2d                	jne    803add <ipc_recvv+0x7f>
+  803ab0:	a1 00 60 80 00       	mov    0x806000,%eax
+  803ab5:	8b 40 78             	mov    0x78(%eax),%eax
+  803ab8:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803aba:	a1 00 60 80 00       	mov    0x806000,%eax
+  803abf:	8b 40 70             	mov    0x70(%eax),%eax
+  803ac2:	eb 1f                	jmp    803ae3 <ipc_recvv+0x85>
+  803ac4:	85 c0                	test   %eax,%eax
+  803ac6:	75 1b                	jne    803ae3 <ipc_recvv+0x85>
+  803ac8:	eb f0                	jmp    803aba <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803aca:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803ad0:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803ad5:	85 ff                	test   %edi,%edi
+  803ad7:	75 cd                	jne    803aa6 <ipc_recvv+0x48>
+	if (perm_store)
+  803ad9:	85 f6                	test   %esi,%esi
+  803adb:	74 e7                	je     803ac4 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803add:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803ae3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ae6:	5b                   	pop    %ebx
+  803ae7:	5e                   	pop    %esi
+  803ae8:	5f                   	pop    %edi
+  803ae9:	5d                   	pop    %ebp
+  803aea:	c3                   	ret
+	if (perm_store)
+  803aeb:	85 f6                	test   %esi,%esi
+  803aed:	75 bd                	jne    803aac <ipc_recvv+0x4e>
+  803aef:	eb c9                	jmp    803aba <ipc_recvv+0x5c>
+
+00803af1 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803af1:	55                   	push   %ebp
+  803af2:	89 e5                	mov    %esp,%ebp
+  803af4:	57                   	push   %edi
+  803af5:	56                   	push   %esi
+  803af6:	53                   	push   %ebx
+  803af7:	83 ec 0c             	sub    $0xc,%esp
+  803afa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803afd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803b00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  803b03:	ff 75 14             	push   0x14(%ebp)
+  803b06:	53                   	push   %ebx
+  803b07:	56                   	push   %esi
+  803b08:	57                   	push   %edi
+  803b09:	e8 82 d2 ff ff       	call   800d90 <sys_ipc_try_sendv>
+  803b0e:	83 c4 10             	add    $0x10,%esp
+  803b11:	85 c0                	test   %eax,%eax
+  803b13:	74 22                	je     803b37 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803b15:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803b18:	75 07                	jne    803b21 <ipc_sendv+0x30>
+		sys_yield();
+  803b1a:	e8 75 d0 ff ff       	call   800b94 <sys_yield>
+  803b1f:	eb e2                	jmp    803b03 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803b21:	68 25 45 80 00       	push   $0x804525
+  803b26:	68 20 43 80 00       	push   $0x804320
+  803b2b:	6a 5c                	push   $0x5c
+  803b2d:	68 3a 45 80 00       	push   $0x80453a
+  803b32:	e8 a7 c5 ff ff       	call   8000de <_panic>
+	}
+}
+  803b37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b3a:	5b                   	pop    %ebx
+  803b3b:	5e                   	pop    %esi
+  803b3c:	5f                   	pop    %edi
+  803b3d:	5d                   	pop    %ebp
+  803b3e:	c3                   	ret
+
+00803b3f <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803b3f:	55                   	push   %ebp
+  803b40:	89 e5                	mov    %esp,%ebp
+  803b42:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803b45:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803b4a:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803b50:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803b56:	8b 52 50             	mov    0x50(%edx),%edx
+  803b59:	39 ca                	cmp    %ecx,%edx
+  803b5b:	74 11                	je     803b6e <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803b5d:	83 c0 01             	add    $0x1,%eax
+  803b60:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803b65:	75 e3                	jne    803b4a <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803b67:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b6c:	eb 0e                	jmp    803b7c <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803b6e:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803b74:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b79:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803b7c:	5d                   	pop    %ebp
+  803b7d:	c3                   	ret
+
+00803b7e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803b7e:	55                   	push   %ebp
+  803b7f:	89 e5                	mov    %esp,%ebp
+  803b81:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803b84:	89 c2                	mov    %eax,%edx
+  803b86:	c1 ea 16             	shr    $0x16,%edx
+  803b89:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803b90:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803b95:	f6 c1 01             	test   $0x1,%cl
+  803b98:	74 22                	je     803bbc <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803b9a:	c1 e8 0c             	shr    $0xc,%eax
+  803b9d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803ba4:	a8 01                	test   $0x1,%al
+  803ba6:	74 14                	je     803bbc <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803ba8:	c1 e8 0c             	shr    $0xc,%eax
+  803bab:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803bae:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803bb5:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803bb9:	0f b7 d2             	movzwl %dx,%edx
+}
+  803bbc:	89 d0                	mov    %edx,%eax
+  803bbe:	5d                   	pop    %ebp
+  803bbf:	c3                   	ret
+
+00803bc0 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803bc0:	55                   	push   %ebp
+  803bc1:	89 e5                	mov    %esp,%ebp
+  803bc3:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803bc6:	83 3d 08 a0 80 00 00 	cmpl   $0x0,0x80a008
+  803bcd:	74 0a                	je     803bd9 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803bcf:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bd2:	a3 08 a0 80 00       	mov    %eax,0x80a008
+}
+  803bd7:	c9                   	leave
+  803bd8:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803bd9:	83 ec 04             	sub    $0x4,%esp
+  803bdc:	6a 07                	push   $0x7
+  803bde:	68 00 f0 bf ee       	push   $0xeebff000
+  803be3:	6a 00                	push   $0x0
+  803be5:	e8 c9 cf ff ff       	call   800bb3 <sys_page_alloc>
+  803bea:	83 c4 10             	add    $0x10,%esp
+  803bed:	85 c0                	test   %eax,%eax
+  803bef:	75 2c                	jne    803c1d <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803bf1:	83 ec 08             	sub    $0x8,%esp
+  803bf4:	68 33 3c 80 00       	push   $0x803c33
+  803bf9:	6a 00                	push   $0x0
+  803bfb:	e8 1e d1 ff ff       	call   800d1e <sys_env_set_pgfault_upcall>
+  803c00:	83 c4 10             	add    $0x10,%esp
+  803c03:	85 c0                	test   %eax,%eax
+  803c05:	74 c8                	je     803bcf <set_pgfault_handler+0xf>
+  803c07:	68 8c 45 80 00       	push   $0x80458c
+  803c0c:	68 20 43 80 00       	push   $0x804320
+  803c11:	6a 20                	push   $0x20
+  803c13:	68 bc 45 80 00       	push   $0x8045bc
+  803c18:	e8 c1 c4 ff ff       	call   8000de <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803c1d:	68 44 45 80 00       	push   $0x804544
+  803c22:	68 20 43 80 00       	push   $0x804320
+  803c27:	6a 1e                	push   $0x1e
+  803c29:	68 bc 45 80 00       	push   $0x8045bc
+  803c2e:	e8 ab c4 ff ff       	call   8000de <_panic>
+
+00803c33 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803c33:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803c34:	a1 08 a0 80 00       	mov    0x80a008,%eax
+	call *%eax
+  803c39:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803c3b:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803c3e:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803c43:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803c48:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803c4c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803c4f:	83 c4 08             	add    $0x8,%esp
+	popal
+  803c52:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803c53:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803c56:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803c57:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803c58:	c3                   	ret
+
+00803c59 <dm>:
+  803c59:	55                   	push   %ebp
+  803c5a:	57                   	push   %edi
+  803c5b:	56                   	push   %esi
+  803c5c:	53                   	push   %ebx
+  803c5d:	83 ec 24             	sub    $0x24,%esp
+  803c60:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803c64:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803c68:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803c6c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803c70:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803c74:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803c78:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803c7c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803c81:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c86:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c8b:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803c92:	00 
+  803c93:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803c9a:	00 
+  803c9b:	89 fb                	mov    %edi,%ebx
+  803c9d:	eb 08                	jmp    803ca7 <dm+0x4e>
+  803c9f:	83 e9 01             	sub    $0x1,%ecx
+  803ca2:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803ca5:	74 68                	je     803d0f <dm+0xb6>
+  803ca7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803cab:	01 c0                	add    %eax,%eax
+  803cad:	89 c6                	mov    %eax,%esi
+  803caf:	89 d7                	mov    %edx,%edi
+  803cb1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803cb5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803cb9:	0f ad d0             	shrd   %cl,%edx,%eax
+  803cbc:	d3 ea                	shr    %cl,%edx
+  803cbe:	f6 c1 20             	test   $0x20,%cl
+  803cc1:	74 04                	je     803cc7 <dm+0x6e>
+  803cc3:	89 d0                	mov    %edx,%eax
+  803cc5:	31 d2                	xor    %edx,%edx
+  803cc7:	83 e0 01             	and    $0x1,%eax
+  803cca:	89 04 24             	mov    %eax,(%esp)
+  803ccd:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803cd4:	00 
+  803cd5:	8b 04 24             	mov    (%esp),%eax
+  803cd8:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803cdc:	09 f0                	or     %esi,%eax
+  803cde:	09 fa                	or     %edi,%edx
+  803ce0:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803ce4:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803ce8:	39 f0                	cmp    %esi,%eax
+  803cea:	89 d5                	mov    %edx,%ebp
+  803cec:	19 fd                	sbb    %edi,%ebp
+  803cee:	72 af                	jb     803c9f <dm+0x46>
+  803cf0:	29 f0                	sub    %esi,%eax
+  803cf2:	19 fa                	sbb    %edi,%edx
+  803cf4:	89 cf                	mov    %ecx,%edi
+  803cf6:	c1 ef 05             	shr    $0x5,%edi
+  803cf9:	83 e7 01             	and    $0x1,%edi
+  803cfc:	89 fe                	mov    %edi,%esi
+  803cfe:	83 f6 01             	xor    $0x1,%esi
+  803d01:	d3 e6                	shl    %cl,%esi
+  803d03:	d3 e7                	shl    %cl,%edi
+  803d05:	09 74 24 18          	or     %esi,0x18(%esp)
+  803d09:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803d0d:	eb 90                	jmp    803c9f <dm+0x46>
+  803d0f:	85 db                	test   %ebx,%ebx
+  803d11:	74 05                	je     803d18 <dm+0xbf>
+  803d13:	89 03                	mov    %eax,(%ebx)
+  803d15:	89 53 04             	mov    %edx,0x4(%ebx)
+  803d18:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803d1c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803d20:	83 c4 24             	add    $0x24,%esp
+  803d23:	5b                   	pop    %ebx
+  803d24:	5e                   	pop    %esi
+  803d25:	5f                   	pop    %edi
+  803d26:	5d                   	pop    %ebp
+  803d27:	c3                   	ret
+
+00803d28 <__udivdi3>:
+  803d28:	83 ec 08             	sub    $0x8,%esp
+  803d2b:	6a 00                	push   $0x0
+  803d2d:	ff 74 24 1c          	push   0x1c(%esp)
+  803d31:	ff 74 24 1c          	push   0x1c(%esp)
+  803d35:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803d39:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803d3d:	e8 17 ff ff ff       	call   803c59 <dm>
+  803d42:	83 c4 14             	add    $0x14,%esp
+  803d45:	c3                   	ret
+
+00803d46 <__umoddi3>:
+  803d46:	83 ec 18             	sub    $0x18,%esp
+  803d49:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803d4d:	50                   	push   %eax
+  803d4e:	ff 74 24 2c          	push   0x2c(%esp)
+  803d52:	ff 74 24 2c          	push   0x2c(%esp)
+  803d56:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803d5a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803d5e:	e8 f6 fe ff ff       	call   803c59 <dm>
+  803d63:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803d67:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803d6b:	83 c4 24             	add    $0x24,%esp
+  803d6e:	c3                   	ret
+
+00803d6f <__divdi3>:
+  803d6f:	53                   	push   %ebx
+  803d70:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803d74:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803d78:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803d7c:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803d80:	85 d2                	test   %edx,%edx
+  803d82:	78 15                	js     803d99 <__divdi3+0x2a>
+  803d84:	85 db                	test   %ebx,%ebx
+  803d86:	78 34                	js     803dbc <__divdi3+0x4d>
+  803d88:	83 ec 04             	sub    $0x4,%esp
+  803d8b:	6a 00                	push   $0x0
+  803d8d:	53                   	push   %ebx
+  803d8e:	51                   	push   %ecx
+  803d8f:	e8 c5 fe ff ff       	call   803c59 <dm>
+  803d94:	83 c4 10             	add    $0x10,%esp
+  803d97:	eb 21                	jmp    803dba <__divdi3+0x4b>
+  803d99:	f7 d8                	neg    %eax
+  803d9b:	83 d2 00             	adc    $0x0,%edx
+  803d9e:	f7 da                	neg    %edx
+  803da0:	85 db                	test   %ebx,%ebx
+  803da2:	78 30                	js     803dd4 <__divdi3+0x65>
+  803da4:	83 ec 04             	sub    $0x4,%esp
+  803da7:	6a 00                	push   $0x0
+  803da9:	53                   	push   %ebx
+  803daa:	51                   	push   %ecx
+  803dab:	e8 a9 fe ff ff       	call   803c59 <dm>
+  803db0:	83 c4 10             	add    $0x10,%esp
+  803db3:	f7 d8                	neg    %eax
+  803db5:	83 d2 00             	adc    $0x0,%edx
+  803db8:	f7 da                	neg    %edx
+  803dba:	5b                   	pop    %ebx
+  803dbb:	c3                   	ret
+  803dbc:	83 ec 04             	sub    $0x4,%esp
+  803dbf:	6a 00                	push   $0x0
+  803dc1:	f7 d9                	neg    %ecx
+  803dc3:	83 d3 00             	adc    $0x0,%ebx
+  803dc6:	f7 db                	neg    %ebx
+  803dc8:	53                   	push   %ebx
+  803dc9:	51                   	push   %ecx
+  803dca:	e8 8a fe ff ff       	call   803c59 <dm>
+  803dcf:	83 c4 10             	add    $0x10,%esp
+  803dd2:	eb df                	jmp    803db3 <__divdi3+0x44>
+  803dd4:	83 ec 04             	sub    $0x4,%esp
+  803dd7:	6a 00                	push   $0x0
+  803dd9:	f7 d9                	neg    %ecx
+  803ddb:	83 d3 00             	adc    $0x0,%ebx
+  803dde:	f7 db                	neg    %ebx
+  803de0:	53                   	push   %ebx
+  803de1:	51                   	push   %ecx
+  803de2:	e8 72 fe ff ff       	call   803c59 <dm>
+  803de7:	83 c4 10             	add    $0x10,%esp
+  803dea:	eb ce                	jmp    803dba <__divdi3+0x4b>
+
+00803dec <__moddi3>:
+  803dec:	55                   	push   %ebp
+  803ded:	57                   	push   %edi
+  803dee:	56                   	push   %esi
+  803def:	53                   	push   %ebx
+  803df0:	83 ec 24             	sub    $0x24,%esp
+  803df3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803df7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803dfb:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803dff:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803e03:	85 d2                	test   %edx,%edx
+  803e05:	78 3b                	js     803e42 <__moddi3+0x56>
+  803e07:	83 ec 04             	sub    $0x4,%esp
+  803e0a:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803e0e:	56                   	push   %esi
+  803e0f:	89 ce                	mov    %ecx,%esi
+  803e11:	f7 de                	neg    %esi
+  803e13:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803e17:	89 de                	mov    %ebx,%esi
+  803e19:	83 d6 00             	adc    $0x0,%esi
+  803e1c:	f7 de                	neg    %esi
+  803e1e:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803e22:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803e26:	0f 48 f1             	cmovs  %ecx,%esi
+  803e29:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803e2e:	53                   	push   %ebx
+  803e2f:	56                   	push   %esi
+  803e30:	e8 24 fe ff ff       	call   803c59 <dm>
+  803e35:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803e39:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803e3d:	83 c4 10             	add    $0x10,%esp
+  803e40:	eb 47                	jmp    803e89 <__moddi3+0x9d>
+  803e42:	f7 d8                	neg    %eax
+  803e44:	83 d2 00             	adc    $0x0,%edx
+  803e47:	f7 da                	neg    %edx
+  803e49:	83 ec 04             	sub    $0x4,%esp
+  803e4c:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803e50:	56                   	push   %esi
+  803e51:	89 cf                	mov    %ecx,%edi
+  803e53:	f7 df                	neg    %edi
+  803e55:	89 de                	mov    %ebx,%esi
+  803e57:	83 d6 00             	adc    $0x0,%esi
+  803e5a:	f7 de                	neg    %esi
+  803e5c:	0f 49 cf             	cmovns %edi,%ecx
+  803e5f:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803e63:	0f 49 de             	cmovns %esi,%ebx
+  803e66:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803e6a:	ff 74 24 0c          	push   0xc(%esp)
+  803e6e:	ff 74 24 0c          	push   0xc(%esp)
+  803e72:	e8 e2 fd ff ff       	call   803c59 <dm>
+  803e77:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803e7b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803e7f:	f7 d8                	neg    %eax
+  803e81:	83 d2 00             	adc    $0x0,%edx
+  803e84:	f7 da                	neg    %edx
+  803e86:	83 c4 10             	add    $0x10,%esp
+  803e89:	83 c4 24             	add    $0x24,%esp
+  803e8c:	5b                   	pop    %ebx
+  803e8d:	5e                   	pop    %esi
+  803e8e:	5f                   	pop    %edi
+  803e8f:	5d                   	pop    %ebp
+  803e90:	c3                   	ret
@@ -0,0 +1,7674 @@
+
+obj/user/spin.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 10             	sub    $0x10,%esp
+	envid_t env;
+
+	cprintf("I am the parent.  Forking the child...\n");
+  80003a:	68 c0 37 80 00       	push   $0x8037c0
+  80003f:	e8 69 01 00 00       	call   8001ad <cprintf>
+	if ((env = fork()) == 0) {
+  800044:	e8 b9 10 00 00       	call   801102 <fork>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	85 c0                	test   %eax,%eax
+  80004e:	75 12                	jne    800062 <umain+0x2f>
+		cprintf("I am the child.  Spinning...\n");
+  800050:	83 ec 0c             	sub    $0xc,%esp
+  800053:	68 38 38 80 00       	push   $0x803838
+  800058:	e8 50 01 00 00       	call   8001ad <cprintf>
+  80005d:	83 c4 10             	add    $0x10,%esp
+		while (1)
+  800060:	eb fe                	jmp    800060 <umain+0x2d>
+  800062:	89 c3                	mov    %eax,%ebx
+			/* do nothing */;
+	}
+
+	cprintf("I am the parent.  Running the child...\n");
+  800064:	83 ec 0c             	sub    $0xc,%esp
+  800067:	68 e8 37 80 00       	push   $0x8037e8
+  80006c:	e8 3c 01 00 00       	call   8001ad <cprintf>
+	sys_yield();
+  800071:	e8 12 0b 00 00       	call   800b88 <sys_yield>
+	sys_yield();
+  800076:	e8 0d 0b 00 00       	call   800b88 <sys_yield>
+	sys_yield();
+  80007b:	e8 08 0b 00 00       	call   800b88 <sys_yield>
+	sys_yield();
+  800080:	e8 03 0b 00 00       	call   800b88 <sys_yield>
+	sys_yield();
+  800085:	e8 fe 0a 00 00       	call   800b88 <sys_yield>
+	sys_yield();
+  80008a:	e8 f9 0a 00 00       	call   800b88 <sys_yield>
+	sys_yield();
+  80008f:	e8 f4 0a 00 00       	call   800b88 <sys_yield>
+	sys_yield();
+  800094:	e8 ef 0a 00 00       	call   800b88 <sys_yield>
+
+	cprintf("I am the parent.  Killing the child...\n");
+  800099:	c7 04 24 10 38 80 00 	movl   $0x803810,(%esp)
+  8000a0:	e8 08 01 00 00       	call   8001ad <cprintf>
+	sys_env_destroy(env);
+  8000a5:	89 1c 24             	mov    %ebx,(%esp)
+  8000a8:	e8 6b 0a 00 00       	call   800b18 <sys_env_destroy>
+}
+  8000ad:	83 c4 10             	add    $0x10,%esp
+  8000b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000c0:	e8 9c 0a 00 00       	call   800b61 <sys_getenvid>
+  8000c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ca:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8000d0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d5:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000da:	85 db                	test   %ebx,%ebx
+  8000dc:	7e 07                	jle    8000e5 <libmain+0x30>
+		binaryname = argv[0];
+  8000de:	8b 06                	mov    (%esi),%eax
+  8000e0:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000e5:	83 ec 08             	sub    $0x8,%esp
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	e8 44 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000ef:	e8 0a 00 00 00       	call   8000fe <exit>
+}
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800104:	e8 88 13 00 00       	call   801491 <close_all>
+	sys_env_destroy(0);
+  800109:	83 ec 0c             	sub    $0xc,%esp
+  80010c:	6a 00                	push   $0x0
+  80010e:	e8 05 0a 00 00       	call   800b18 <sys_env_destroy>
+}
+  800113:	83 c4 10             	add    $0x10,%esp
+  800116:	c9                   	leave
+  800117:	c3                   	ret
+
+00800118 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800118:	55                   	push   %ebp
+  800119:	89 e5                	mov    %esp,%ebp
+  80011b:	53                   	push   %ebx
+  80011c:	83 ec 04             	sub    $0x4,%esp
+  80011f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800122:	8b 13                	mov    (%ebx),%edx
+  800124:	8d 42 01             	lea    0x1(%edx),%eax
+  800127:	89 03                	mov    %eax,(%ebx)
+  800129:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80012c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800130:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800135:	74 09                	je     800140 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800137:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80013b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80013e:	c9                   	leave
+  80013f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800140:	83 ec 08             	sub    $0x8,%esp
+  800143:	68 ff 00 00 00       	push   $0xff
+  800148:	8d 43 08             	lea    0x8(%ebx),%eax
+  80014b:	50                   	push   %eax
+  80014c:	e8 7a 09 00 00       	call   800acb <sys_cputs>
+		b->idx = 0;
+  800151:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800157:	83 c4 10             	add    $0x10,%esp
+  80015a:	eb db                	jmp    800137 <putch+0x1f>
+
+0080015c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80015c:	55                   	push   %ebp
+  80015d:	89 e5                	mov    %esp,%ebp
+  80015f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800165:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80016c:	00 00 00 
+	b.cnt = 0;
+  80016f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800176:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800179:	ff 75 0c             	push   0xc(%ebp)
+  80017c:	ff 75 08             	push   0x8(%ebp)
+  80017f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800185:	50                   	push   %eax
+  800186:	68 18 01 80 00       	push   $0x800118
+  80018b:	e8 14 01 00 00       	call   8002a4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800190:	83 c4 08             	add    $0x8,%esp
+  800193:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800199:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80019f:	50                   	push   %eax
+  8001a0:	e8 26 09 00 00       	call   800acb <sys_cputs>
+
+	return b.cnt;
+}
+  8001a5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001ab:	c9                   	leave
+  8001ac:	c3                   	ret
+
+008001ad <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001ad:	55                   	push   %ebp
+  8001ae:	89 e5                	mov    %esp,%ebp
+  8001b0:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001b3:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001b6:	50                   	push   %eax
+  8001b7:	ff 75 08             	push   0x8(%ebp)
+  8001ba:	e8 9d ff ff ff       	call   80015c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001bf:	c9                   	leave
+  8001c0:	c3                   	ret
+
+008001c1 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001c1:	55                   	push   %ebp
+  8001c2:	89 e5                	mov    %esp,%ebp
+  8001c4:	57                   	push   %edi
+  8001c5:	56                   	push   %esi
+  8001c6:	53                   	push   %ebx
+  8001c7:	83 ec 1c             	sub    $0x1c,%esp
+  8001ca:	89 c7                	mov    %eax,%edi
+  8001cc:	89 d6                	mov    %edx,%esi
+  8001ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001d4:	89 d1                	mov    %edx,%ecx
+  8001d6:	89 c2                	mov    %eax,%edx
+  8001d8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001db:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001de:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001e1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001e4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001e7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001ee:	39 c2                	cmp    %eax,%edx
+  8001f0:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001f3:	72 3e                	jb     800233 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001f5:	83 ec 0c             	sub    $0xc,%esp
+  8001f8:	ff 75 18             	push   0x18(%ebp)
+  8001fb:	83 eb 01             	sub    $0x1,%ebx
+  8001fe:	53                   	push   %ebx
+  8001ff:	50                   	push   %eax
+  800200:	83 ec 08             	sub    $0x8,%esp
+  800203:	ff 75 e4             	push   -0x1c(%ebp)
+  800206:	ff 75 e0             	push   -0x20(%ebp)
+  800209:	ff 75 dc             	push   -0x24(%ebp)
+  80020c:	ff 75 d8             	push   -0x28(%ebp)
+  80020f:	e8 37 34 00 00       	call   80364b <__udivdi3>
+  800214:	83 c4 18             	add    $0x18,%esp
+  800217:	52                   	push   %edx
+  800218:	50                   	push   %eax
+  800219:	89 f2                	mov    %esi,%edx
+  80021b:	89 f8                	mov    %edi,%eax
+  80021d:	e8 9f ff ff ff       	call   8001c1 <printnum>
+  800222:	83 c4 20             	add    $0x20,%esp
+  800225:	eb 13                	jmp    80023a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800227:	83 ec 08             	sub    $0x8,%esp
+  80022a:	56                   	push   %esi
+  80022b:	ff 75 18             	push   0x18(%ebp)
+  80022e:	ff d7                	call   *%edi
+  800230:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800233:	83 eb 01             	sub    $0x1,%ebx
+  800236:	85 db                	test   %ebx,%ebx
+  800238:	7f ed                	jg     800227 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80023a:	83 ec 08             	sub    $0x8,%esp
+  80023d:	56                   	push   %esi
+  80023e:	83 ec 04             	sub    $0x4,%esp
+  800241:	ff 75 e4             	push   -0x1c(%ebp)
+  800244:	ff 75 e0             	push   -0x20(%ebp)
+  800247:	ff 75 dc             	push   -0x24(%ebp)
+  80024a:	ff 75 d8             	push   -0x28(%ebp)
+  80024d:	e8 17 34 00 00       	call   803669 <__umoddi3>
+  800252:	83 c4 14             	add    $0x14,%esp
+  800255:	0f be 80 60 38 80 00 	movsbl 0x803860(%eax),%eax
+  80025c:	50                   	push   %eax
+  80025d:	ff d7                	call   *%edi
+}
+  80025f:	83 c4 10             	add    $0x10,%esp
+  800262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800265:	5b                   	pop    %ebx
+  800266:	5e                   	pop    %esi
+  800267:	5f                   	pop    %edi
+  800268:	5d                   	pop    %ebp
+  800269:	c3                   	ret
+
+0080026a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80026a:	55                   	push   %ebp
+  80026b:	89 e5                	mov    %esp,%ebp
+  80026d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800270:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800274:	8b 10                	mov    (%eax),%edx
+  800276:	3b 50 04             	cmp    0x4(%eax),%edx
+  800279:	73 0a                	jae    800285 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80027b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80027e:	89 08                	mov    %ecx,(%eax)
+  800280:	8b 45 08             	mov    0x8(%ebp),%eax
+  800283:	88 02                	mov    %al,(%edx)
+}
+  800285:	5d                   	pop    %ebp
+  800286:	c3                   	ret
+
+00800287 <printfmt>:
+{
+  800287:	55                   	push   %ebp
+  800288:	89 e5                	mov    %esp,%ebp
+  80028a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80028d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800290:	50                   	push   %eax
+  800291:	ff 75 10             	push   0x10(%ebp)
+  800294:	ff 75 0c             	push   0xc(%ebp)
+  800297:	ff 75 08             	push   0x8(%ebp)
+  80029a:	e8 05 00 00 00       	call   8002a4 <vprintfmt>
+}
+  80029f:	83 c4 10             	add    $0x10,%esp
+  8002a2:	c9                   	leave
+  8002a3:	c3                   	ret
+
+008002a4 <vprintfmt>:
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  8002a7:	57                   	push   %edi
+  8002a8:	56                   	push   %esi
+  8002a9:	53                   	push   %ebx
+  8002aa:	83 ec 2c             	sub    $0x2c,%esp
+  8002ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002b3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002b6:	eb 0a                	jmp    8002c2 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8002b8:	83 ec 08             	sub    $0x8,%esp
+  8002bb:	53                   	push   %ebx
+  8002bc:	50                   	push   %eax
+  8002bd:	ff d6                	call   *%esi
+  8002bf:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002c2:	83 c7 01             	add    $0x1,%edi
+  8002c5:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002c9:	83 f8 25             	cmp    $0x25,%eax
+  8002cc:	74 0c                	je     8002da <vprintfmt+0x36>
+			if (ch == '\0')
+  8002ce:	85 c0                	test   %eax,%eax
+  8002d0:	75 e6                	jne    8002b8 <vprintfmt+0x14>
+}
+  8002d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d5:	5b                   	pop    %ebx
+  8002d6:	5e                   	pop    %esi
+  8002d7:	5f                   	pop    %edi
+  8002d8:	5d                   	pop    %ebp
+  8002d9:	c3                   	ret
+		padc = ' ';
+  8002da:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002de:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002e5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002ec:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002f8:	8d 47 01             	lea    0x1(%edi),%eax
+  8002fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002fe:	0f b6 17             	movzbl (%edi),%edx
+  800301:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800304:	3c 55                	cmp    $0x55,%al
+  800306:	0f 87 cf 03 00 00    	ja     8006db <vprintfmt+0x437>
+  80030c:	0f b6 c0             	movzbl %al,%eax
+  80030f:	ff 24 85 c0 39 80 00 	jmp    *0x8039c0(,%eax,4)
+  800316:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800319:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80031d:	eb d9                	jmp    8002f8 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80031f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800322:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800326:	eb d0                	jmp    8002f8 <vprintfmt+0x54>
+  800328:	0f b6 d2             	movzbl %dl,%edx
+  80032b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80032e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800333:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800336:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800339:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80033d:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800340:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800343:	83 f9 09             	cmp    $0x9,%ecx
+  800346:	77 55                	ja     80039d <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800348:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80034b:	eb e9                	jmp    800336 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80034d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800350:	8b 00                	mov    (%eax),%eax
+  800352:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800355:	8b 45 14             	mov    0x14(%ebp),%eax
+  800358:	8d 40 04             	lea    0x4(%eax),%eax
+  80035b:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80035e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800361:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800365:	79 91                	jns    8002f8 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800367:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80036a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80036d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800374:	eb 82                	jmp    8002f8 <vprintfmt+0x54>
+			if (width < 0)
+  800376:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800379:	85 d2                	test   %edx,%edx
+  80037b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800380:	0f 49 c2             	cmovns %edx,%eax
+  800383:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800386:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800389:	e9 6a ff ff ff       	jmp    8002f8 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80038e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800391:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800398:	e9 5b ff ff ff       	jmp    8002f8 <vprintfmt+0x54>
+  80039d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003a0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a3:	eb bc                	jmp    800361 <vprintfmt+0xbd>
+			lflag++;
+  8003a5:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003ab:	e9 48 ff ff ff       	jmp    8002f8 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8003b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b3:	8d 78 04             	lea    0x4(%eax),%edi
+  8003b6:	83 ec 08             	sub    $0x8,%esp
+  8003b9:	53                   	push   %ebx
+  8003ba:	ff 30                	push   (%eax)
+  8003bc:	ff d6                	call   *%esi
+			break;
+  8003be:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003c1:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003c4:	e9 b1 02 00 00       	jmp    80067a <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cc:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003cf:	8b 10                	mov    (%eax),%edx
+  8003d1:	89 d0                	mov    %edx,%eax
+  8003d3:	f7 d8                	neg    %eax
+  8003d5:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003d8:	83 f8 11             	cmp    $0x11,%eax
+  8003db:	7f 23                	jg     800400 <vprintfmt+0x15c>
+  8003dd:	8b 14 85 20 3b 80 00 	mov    0x803b20(,%eax,4),%edx
+  8003e4:	85 d2                	test   %edx,%edx
+  8003e6:	74 18                	je     800400 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003e8:	52                   	push   %edx
+  8003e9:	68 3e 3c 80 00       	push   $0x803c3e
+  8003ee:	53                   	push   %ebx
+  8003ef:	56                   	push   %esi
+  8003f0:	e8 92 fe ff ff       	call   800287 <printfmt>
+  8003f5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003f8:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003fb:	e9 7a 02 00 00       	jmp    80067a <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800400:	50                   	push   %eax
+  800401:	68 78 38 80 00       	push   $0x803878
+  800406:	53                   	push   %ebx
+  800407:	56                   	push   %esi
+  800408:	e8 7a fe ff ff       	call   800287 <printfmt>
+  80040d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800410:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800413:	e9 62 02 00 00       	jmp    80067a <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800418:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041b:	83 c0 04             	add    $0x4,%eax
+  80041e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800421:	8b 45 14             	mov    0x14(%ebp),%eax
+  800424:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800426:	85 c9                	test   %ecx,%ecx
+  800428:	b8 71 38 80 00       	mov    $0x803871,%eax
+  80042d:	0f 45 c1             	cmovne %ecx,%eax
+  800430:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800433:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800437:	7e 06                	jle    80043f <vprintfmt+0x19b>
+  800439:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80043d:	75 0b                	jne    80044a <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80043f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800442:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800445:	89 75 08             	mov    %esi,0x8(%ebp)
+  800448:	eb 5c                	jmp    8004a6 <vprintfmt+0x202>
+  80044a:	83 ec 08             	sub    $0x8,%esp
+  80044d:	ff 75 d0             	push   -0x30(%ebp)
+  800450:	ff 75 cc             	push   -0x34(%ebp)
+  800453:	e8 20 03 00 00       	call   800778 <strnlen>
+  800458:	89 c2                	mov    %eax,%edx
+  80045a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80045d:	29 d0                	sub    %edx,%eax
+  80045f:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800462:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800466:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800469:	89 75 08             	mov    %esi,0x8(%ebp)
+  80046c:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80046e:	eb 0e                	jmp    80047e <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800470:	83 ec 08             	sub    $0x8,%esp
+  800473:	53                   	push   %ebx
+  800474:	57                   	push   %edi
+  800475:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800478:	83 ee 01             	sub    $0x1,%esi
+  80047b:	83 c4 10             	add    $0x10,%esp
+  80047e:	85 f6                	test   %esi,%esi
+  800480:	7f ee                	jg     800470 <vprintfmt+0x1cc>
+  800482:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800485:	8b 75 08             	mov    0x8(%ebp),%esi
+  800488:	85 c0                	test   %eax,%eax
+  80048a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80048f:	0f 49 d0             	cmovns %eax,%edx
+  800492:	29 d0                	sub    %edx,%eax
+  800494:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800497:	eb a6                	jmp    80043f <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800499:	83 ec 08             	sub    $0x8,%esp
+  80049c:	53                   	push   %ebx
+  80049d:	52                   	push   %edx
+  80049e:	ff 55 08             	call   *0x8(%ebp)
+  8004a1:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004a4:	89 f1                	mov    %esi,%ecx
+  8004a6:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004a9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004ad:	0f be d0             	movsbl %al,%edx
+  8004b0:	85 d2                	test   %edx,%edx
+  8004b2:	74 28                	je     8004dc <vprintfmt+0x238>
+  8004b4:	85 ff                	test   %edi,%edi
+  8004b6:	78 05                	js     8004bd <vprintfmt+0x219>
+  8004b8:	83 ef 01             	sub    $0x1,%edi
+  8004bb:	78 30                	js     8004ed <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004bd:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004c1:	74 d6                	je     800499 <vprintfmt+0x1f5>
+  8004c3:	0f be c0             	movsbl %al,%eax
+  8004c6:	83 e8 20             	sub    $0x20,%eax
+  8004c9:	83 f8 5e             	cmp    $0x5e,%eax
+  8004cc:	76 cb                	jbe    800499 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004ce:	83 ec 08             	sub    $0x8,%esp
+  8004d1:	53                   	push   %ebx
+  8004d2:	6a 3f                	push   $0x3f
+  8004d4:	ff 55 08             	call   *0x8(%ebp)
+  8004d7:	83 c4 10             	add    $0x10,%esp
+  8004da:	eb c8                	jmp    8004a4 <vprintfmt+0x200>
+  8004dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004df:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004e2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004e5:	01 d0                	add    %edx,%eax
+  8004e7:	29 c8                	sub    %ecx,%eax
+  8004e9:	89 c7                	mov    %eax,%edi
+  8004eb:	eb 13                	jmp    800500 <vprintfmt+0x25c>
+  8004ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f0:	eb ed                	jmp    8004df <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004f2:	83 ec 08             	sub    $0x8,%esp
+  8004f5:	53                   	push   %ebx
+  8004f6:	6a 20                	push   $0x20
+  8004f8:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004fa:	83 ef 01             	sub    $0x1,%edi
+  8004fd:	83 c4 10             	add    $0x10,%esp
+  800500:	85 ff                	test   %edi,%edi
+  800502:	7f ee                	jg     8004f2 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800504:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800507:	89 45 14             	mov    %eax,0x14(%ebp)
+  80050a:	e9 6b 01 00 00       	jmp    80067a <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80050f:	83 f9 01             	cmp    $0x1,%ecx
+  800512:	7f 1f                	jg     800533 <vprintfmt+0x28f>
+	else if (lflag)
+  800514:	85 c9                	test   %ecx,%ecx
+  800516:	74 67                	je     80057f <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051b:	8b 00                	mov    (%eax),%eax
+  80051d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800520:	89 c1                	mov    %eax,%ecx
+  800522:	c1 f9 1f             	sar    $0x1f,%ecx
+  800525:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8d 40 04             	lea    0x4(%eax),%eax
+  80052e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800531:	eb 17                	jmp    80054a <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800533:	8b 45 14             	mov    0x14(%ebp),%eax
+  800536:	8b 50 04             	mov    0x4(%eax),%edx
+  800539:	8b 00                	mov    (%eax),%eax
+  80053b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80053e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800541:	8b 45 14             	mov    0x14(%ebp),%eax
+  800544:	8d 40 08             	lea    0x8(%eax),%eax
+  800547:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80054a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80054d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800550:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800555:	85 c9                	test   %ecx,%ecx
+  800557:	0f 89 03 01 00 00    	jns    800660 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  80055d:	83 ec 08             	sub    $0x8,%esp
+  800560:	53                   	push   %ebx
+  800561:	6a 2d                	push   $0x2d
+  800563:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800565:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800568:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80056b:	f7 da                	neg    %edx
+  80056d:	83 d1 00             	adc    $0x0,%ecx
+  800570:	f7 d9                	neg    %ecx
+  800572:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800575:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80057a:	e9 e1 00 00 00       	jmp    800660 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80057f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800582:	8b 00                	mov    (%eax),%eax
+  800584:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800587:	89 c1                	mov    %eax,%ecx
+  800589:	c1 f9 1f             	sar    $0x1f,%ecx
+  80058c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8d 40 04             	lea    0x4(%eax),%eax
+  800595:	89 45 14             	mov    %eax,0x14(%ebp)
+  800598:	eb b0                	jmp    80054a <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80059a:	83 f9 01             	cmp    $0x1,%ecx
+  80059d:	7f 1e                	jg     8005bd <vprintfmt+0x319>
+	else if (lflag)
+  80059f:	85 c9                	test   %ecx,%ecx
+  8005a1:	74 32                	je     8005d5 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8005a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a6:	8b 10                	mov    (%eax),%edx
+  8005a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005b3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8005b8:	e9 a3 00 00 00       	jmp    800660 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c0:	8b 10                	mov    (%eax),%edx
+  8005c2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005c5:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005d0:	e9 8b 00 00 00       	jmp    800660 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d8:	8b 10                	mov    (%eax),%edx
+  8005da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005df:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005e5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005ea:	eb 74                	jmp    800660 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005ec:	83 f9 01             	cmp    $0x1,%ecx
+  8005ef:	7f 1b                	jg     80060c <vprintfmt+0x368>
+	else if (lflag)
+  8005f1:	85 c9                	test   %ecx,%ecx
+  8005f3:	74 2c                	je     800621 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f8:	8b 10                	mov    (%eax),%edx
+  8005fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800602:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800605:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80060a:	eb 54                	jmp    800660 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80060c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060f:	8b 10                	mov    (%eax),%edx
+  800611:	8b 48 04             	mov    0x4(%eax),%ecx
+  800614:	8d 40 08             	lea    0x8(%eax),%eax
+  800617:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80061a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80061f:	eb 3f                	jmp    800660 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800621:	8b 45 14             	mov    0x14(%ebp),%eax
+  800624:	8b 10                	mov    (%eax),%edx
+  800626:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062b:	8d 40 04             	lea    0x4(%eax),%eax
+  80062e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800631:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800636:	eb 28                	jmp    800660 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800638:	83 ec 08             	sub    $0x8,%esp
+  80063b:	53                   	push   %ebx
+  80063c:	6a 30                	push   $0x30
+  80063e:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800640:	83 c4 08             	add    $0x8,%esp
+  800643:	53                   	push   %ebx
+  800644:	6a 78                	push   $0x78
+  800646:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800648:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064b:	8b 10                	mov    (%eax),%edx
+  80064d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800652:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800655:	8d 40 04             	lea    0x4(%eax),%eax
+  800658:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80065b:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800660:	83 ec 0c             	sub    $0xc,%esp
+  800663:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800667:	50                   	push   %eax
+  800668:	ff 75 e0             	push   -0x20(%ebp)
+  80066b:	57                   	push   %edi
+  80066c:	51                   	push   %ecx
+  80066d:	52                   	push   %edx
+  80066e:	89 da                	mov    %ebx,%edx
+  800670:	89 f0                	mov    %esi,%eax
+  800672:	e8 4a fb ff ff       	call   8001c1 <printnum>
+			break;
+  800677:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80067a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80067d:	e9 40 fc ff ff       	jmp    8002c2 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800682:	83 f9 01             	cmp    $0x1,%ecx
+  800685:	7f 1b                	jg     8006a2 <vprintfmt+0x3fe>
+	else if (lflag)
+  800687:	85 c9                	test   %ecx,%ecx
+  800689:	74 2c                	je     8006b7 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  80068b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068e:	8b 10                	mov    (%eax),%edx
+  800690:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800695:	8d 40 04             	lea    0x4(%eax),%eax
+  800698:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80069b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8006a0:	eb be                	jmp    800660 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a5:	8b 10                	mov    (%eax),%edx
+  8006a7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006aa:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ad:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006b0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8006b5:	eb a9                	jmp    800660 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ba:	8b 10                	mov    (%eax),%edx
+  8006bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006cc:	eb 92                	jmp    800660 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006ce:	83 ec 08             	sub    $0x8,%esp
+  8006d1:	53                   	push   %ebx
+  8006d2:	6a 25                	push   $0x25
+  8006d4:	ff d6                	call   *%esi
+			break;
+  8006d6:	83 c4 10             	add    $0x10,%esp
+  8006d9:	eb 9f                	jmp    80067a <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006db:	83 ec 08             	sub    $0x8,%esp
+  8006de:	53                   	push   %ebx
+  8006df:	6a 25                	push   $0x25
+  8006e1:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006e3:	83 c4 10             	add    $0x10,%esp
+  8006e6:	89 f8                	mov    %edi,%eax
+  8006e8:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006ec:	74 05                	je     8006f3 <vprintfmt+0x44f>
+  8006ee:	83 e8 01             	sub    $0x1,%eax
+  8006f1:	eb f5                	jmp    8006e8 <vprintfmt+0x444>
+  8006f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006f6:	eb 82                	jmp    80067a <vprintfmt+0x3d6>
+
+008006f8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006f8:	55                   	push   %ebp
+  8006f9:	89 e5                	mov    %esp,%ebp
+  8006fb:	83 ec 18             	sub    $0x18,%esp
+  8006fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800701:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800704:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800707:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80070b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80070e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800715:	85 c0                	test   %eax,%eax
+  800717:	74 26                	je     80073f <vsnprintf+0x47>
+  800719:	85 d2                	test   %edx,%edx
+  80071b:	7e 22                	jle    80073f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80071d:	ff 75 14             	push   0x14(%ebp)
+  800720:	ff 75 10             	push   0x10(%ebp)
+  800723:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800726:	50                   	push   %eax
+  800727:	68 6a 02 80 00       	push   $0x80026a
+  80072c:	e8 73 fb ff ff       	call   8002a4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800731:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800734:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800737:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80073a:	83 c4 10             	add    $0x10,%esp
+}
+  80073d:	c9                   	leave
+  80073e:	c3                   	ret
+		return -E_INVAL;
+  80073f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800744:	eb f7                	jmp    80073d <vsnprintf+0x45>
+
+00800746 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800746:	55                   	push   %ebp
+  800747:	89 e5                	mov    %esp,%ebp
+  800749:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80074c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80074f:	50                   	push   %eax
+  800750:	ff 75 10             	push   0x10(%ebp)
+  800753:	ff 75 0c             	push   0xc(%ebp)
+  800756:	ff 75 08             	push   0x8(%ebp)
+  800759:	e8 9a ff ff ff       	call   8006f8 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80075e:	c9                   	leave
+  80075f:	c3                   	ret
+
+00800760 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800760:	55                   	push   %ebp
+  800761:	89 e5                	mov    %esp,%ebp
+  800763:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800766:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076b:	eb 03                	jmp    800770 <strlen+0x10>
+		n++;
+  80076d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800770:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800774:	75 f7                	jne    80076d <strlen+0xd>
+	return n;
+}
+  800776:	5d                   	pop    %ebp
+  800777:	c3                   	ret
+
+00800778 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800778:	55                   	push   %ebp
+  800779:	89 e5                	mov    %esp,%ebp
+  80077b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80077e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800781:	b8 00 00 00 00       	mov    $0x0,%eax
+  800786:	eb 03                	jmp    80078b <strnlen+0x13>
+		n++;
+  800788:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80078b:	39 d0                	cmp    %edx,%eax
+  80078d:	74 08                	je     800797 <strnlen+0x1f>
+  80078f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800793:	75 f3                	jne    800788 <strnlen+0x10>
+  800795:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800797:	89 d0                	mov    %edx,%eax
+  800799:	5d                   	pop    %ebp
+  80079a:	c3                   	ret
+
+0080079b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80079b:	55                   	push   %ebp
+  80079c:	89 e5                	mov    %esp,%ebp
+  80079e:	53                   	push   %ebx
+  80079f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8007a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007aa:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007ae:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007b1:	83 c0 01             	add    $0x1,%eax
+  8007b4:	84 d2                	test   %dl,%dl
+  8007b6:	75 f2                	jne    8007aa <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8007b8:	89 c8                	mov    %ecx,%eax
+  8007ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007bd:	c9                   	leave
+  8007be:	c3                   	ret
+
+008007bf <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007bf:	55                   	push   %ebp
+  8007c0:	89 e5                	mov    %esp,%ebp
+  8007c2:	53                   	push   %ebx
+  8007c3:	83 ec 10             	sub    $0x10,%esp
+  8007c6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007c9:	53                   	push   %ebx
+  8007ca:	e8 91 ff ff ff       	call   800760 <strlen>
+  8007cf:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007d2:	ff 75 0c             	push   0xc(%ebp)
+  8007d5:	01 d8                	add    %ebx,%eax
+  8007d7:	50                   	push   %eax
+  8007d8:	e8 be ff ff ff       	call   80079b <strcpy>
+	return dst;
+}
+  8007dd:	89 d8                	mov    %ebx,%eax
+  8007df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007e2:	c9                   	leave
+  8007e3:	c3                   	ret
+
+008007e4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007e4:	55                   	push   %ebp
+  8007e5:	89 e5                	mov    %esp,%ebp
+  8007e7:	56                   	push   %esi
+  8007e8:	53                   	push   %ebx
+  8007e9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007ef:	89 f3                	mov    %esi,%ebx
+  8007f1:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007f4:	89 f0                	mov    %esi,%eax
+  8007f6:	eb 0f                	jmp    800807 <strncpy+0x23>
+		*dst++ = *src;
+  8007f8:	83 c0 01             	add    $0x1,%eax
+  8007fb:	0f b6 0a             	movzbl (%edx),%ecx
+  8007fe:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800801:	80 f9 01             	cmp    $0x1,%cl
+  800804:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800807:	39 d8                	cmp    %ebx,%eax
+  800809:	75 ed                	jne    8007f8 <strncpy+0x14>
+	}
+	return ret;
+}
+  80080b:	89 f0                	mov    %esi,%eax
+  80080d:	5b                   	pop    %ebx
+  80080e:	5e                   	pop    %esi
+  80080f:	5d                   	pop    %ebp
+  800810:	c3                   	ret
+
+00800811 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800811:	55                   	push   %ebp
+  800812:	89 e5                	mov    %esp,%ebp
+  800814:	56                   	push   %esi
+  800815:	53                   	push   %ebx
+  800816:	8b 75 08             	mov    0x8(%ebp),%esi
+  800819:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80081c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80081f:	89 f0                	mov    %esi,%eax
+  800821:	85 d2                	test   %edx,%edx
+  800823:	74 21                	je     800846 <strlcpy+0x35>
+  800825:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800829:	89 f2                	mov    %esi,%edx
+  80082b:	eb 09                	jmp    800836 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80082d:	83 c1 01             	add    $0x1,%ecx
+  800830:	83 c2 01             	add    $0x1,%edx
+  800833:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800836:	39 c2                	cmp    %eax,%edx
+  800838:	74 09                	je     800843 <strlcpy+0x32>
+  80083a:	0f b6 19             	movzbl (%ecx),%ebx
+  80083d:	84 db                	test   %bl,%bl
+  80083f:	75 ec                	jne    80082d <strlcpy+0x1c>
+  800841:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800843:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800846:	29 f0                	sub    %esi,%eax
+}
+  800848:	5b                   	pop    %ebx
+  800849:	5e                   	pop    %esi
+  80084a:	5d                   	pop    %ebp
+  80084b:	c3                   	ret
+
+0080084c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80084c:	55                   	push   %ebp
+  80084d:	89 e5                	mov    %esp,%ebp
+  80084f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800852:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800855:	eb 06                	jmp    80085d <strcmp+0x11>
+		p++, q++;
+  800857:	83 c1 01             	add    $0x1,%ecx
+  80085a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80085d:	0f b6 01             	movzbl (%ecx),%eax
+  800860:	84 c0                	test   %al,%al
+  800862:	74 04                	je     800868 <strcmp+0x1c>
+  800864:	3a 02                	cmp    (%edx),%al
+  800866:	74 ef                	je     800857 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800868:	0f b6 c0             	movzbl %al,%eax
+  80086b:	0f b6 12             	movzbl (%edx),%edx
+  80086e:	29 d0                	sub    %edx,%eax
+}
+  800870:	5d                   	pop    %ebp
+  800871:	c3                   	ret
+
+00800872 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800872:	55                   	push   %ebp
+  800873:	89 e5                	mov    %esp,%ebp
+  800875:	53                   	push   %ebx
+  800876:	8b 45 08             	mov    0x8(%ebp),%eax
+  800879:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80087c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80087f:	eb 09                	jmp    80088a <strncmp+0x18>
+		n--, p++, q++;
+  800881:	83 ea 01             	sub    $0x1,%edx
+  800884:	83 c0 01             	add    $0x1,%eax
+  800887:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80088a:	85 d2                	test   %edx,%edx
+  80088c:	74 18                	je     8008a6 <strncmp+0x34>
+  80088e:	0f b6 18             	movzbl (%eax),%ebx
+  800891:	84 db                	test   %bl,%bl
+  800893:	74 04                	je     800899 <strncmp+0x27>
+  800895:	3a 19                	cmp    (%ecx),%bl
+  800897:	74 e8                	je     800881 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800899:	0f b6 00             	movzbl (%eax),%eax
+  80089c:	0f b6 11             	movzbl (%ecx),%edx
+  80089f:	29 d0                	sub    %edx,%eax
+}
+  8008a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a4:	c9                   	leave
+  8008a5:	c3                   	ret
+		return 0;
+  8008a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ab:	eb f4                	jmp    8008a1 <strncmp+0x2f>
+
+008008ad <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008ad:	55                   	push   %ebp
+  8008ae:	89 e5                	mov    %esp,%ebp
+  8008b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008b7:	eb 03                	jmp    8008bc <strchr+0xf>
+  8008b9:	83 c0 01             	add    $0x1,%eax
+  8008bc:	0f b6 10             	movzbl (%eax),%edx
+  8008bf:	84 d2                	test   %dl,%dl
+  8008c1:	74 06                	je     8008c9 <strchr+0x1c>
+		if (*s == c)
+  8008c3:	38 ca                	cmp    %cl,%dl
+  8008c5:	75 f2                	jne    8008b9 <strchr+0xc>
+  8008c7:	eb 05                	jmp    8008ce <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008ce:	5d                   	pop    %ebp
+  8008cf:	c3                   	ret
+
+008008d0 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008d0:	55                   	push   %ebp
+  8008d1:	89 e5                	mov    %esp,%ebp
+  8008d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008da:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008dd:	38 ca                	cmp    %cl,%dl
+  8008df:	74 09                	je     8008ea <strfind+0x1a>
+  8008e1:	84 d2                	test   %dl,%dl
+  8008e3:	74 05                	je     8008ea <strfind+0x1a>
+	for (; *s; s++)
+  8008e5:	83 c0 01             	add    $0x1,%eax
+  8008e8:	eb f0                	jmp    8008da <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008ea:	5d                   	pop    %ebp
+  8008eb:	c3                   	ret
+
+008008ec <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008ec:	55                   	push   %ebp
+  8008ed:	89 e5                	mov    %esp,%ebp
+  8008ef:	57                   	push   %edi
+  8008f0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008f3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008f6:	85 c9                	test   %ecx,%ecx
+  8008f8:	74 20                	je     80091a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008fa:	89 f8                	mov    %edi,%eax
+  8008fc:	09 c8                	or     %ecx,%eax
+  8008fe:	a8 03                	test   $0x3,%al
+  800900:	75 12                	jne    800914 <memset+0x28>
+		c &= 0xFF;
+  800902:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800906:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80090c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80090f:	fc                   	cld
+  800910:	f3 ab                	rep stos %eax,%es:(%edi)
+  800912:	eb 06                	jmp    80091a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800914:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800917:	fc                   	cld
+  800918:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80091a:	89 f8                	mov    %edi,%eax
+  80091c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80091f:	c9                   	leave
+  800920:	c3                   	ret
+
+00800921 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800921:	55                   	push   %ebp
+  800922:	89 e5                	mov    %esp,%ebp
+  800924:	57                   	push   %edi
+  800925:	56                   	push   %esi
+  800926:	8b 45 08             	mov    0x8(%ebp),%eax
+  800929:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80092c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80092f:	39 c6                	cmp    %eax,%esi
+  800931:	73 32                	jae    800965 <memmove+0x44>
+  800933:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800936:	39 d0                	cmp    %edx,%eax
+  800938:	73 2b                	jae    800965 <memmove+0x44>
+		s += n;
+		d += n;
+  80093a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80093d:	89 d6                	mov    %edx,%esi
+  80093f:	09 fe                	or     %edi,%esi
+  800941:	09 ce                	or     %ecx,%esi
+  800943:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800949:	75 0e                	jne    800959 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80094b:	83 ef 04             	sub    $0x4,%edi
+  80094e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800951:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800954:	fd                   	std
+  800955:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800957:	eb 09                	jmp    800962 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800959:	83 ef 01             	sub    $0x1,%edi
+  80095c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80095f:	fd                   	std
+  800960:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800962:	fc                   	cld
+  800963:	eb 1a                	jmp    80097f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800965:	89 f2                	mov    %esi,%edx
+  800967:	09 c2                	or     %eax,%edx
+  800969:	09 ca                	or     %ecx,%edx
+  80096b:	f6 c2 03             	test   $0x3,%dl
+  80096e:	75 0a                	jne    80097a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800970:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800973:	89 c7                	mov    %eax,%edi
+  800975:	fc                   	cld
+  800976:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800978:	eb 05                	jmp    80097f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80097a:	89 c7                	mov    %eax,%edi
+  80097c:	fc                   	cld
+  80097d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80097f:	5e                   	pop    %esi
+  800980:	5f                   	pop    %edi
+  800981:	5d                   	pop    %ebp
+  800982:	c3                   	ret
+
+00800983 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800983:	55                   	push   %ebp
+  800984:	89 e5                	mov    %esp,%ebp
+  800986:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800989:	ff 75 10             	push   0x10(%ebp)
+  80098c:	ff 75 0c             	push   0xc(%ebp)
+  80098f:	ff 75 08             	push   0x8(%ebp)
+  800992:	e8 8a ff ff ff       	call   800921 <memmove>
+}
+  800997:	c9                   	leave
+  800998:	c3                   	ret
+
+00800999 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800999:	55                   	push   %ebp
+  80099a:	89 e5                	mov    %esp,%ebp
+  80099c:	56                   	push   %esi
+  80099d:	53                   	push   %ebx
+  80099e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8009a4:	89 c6                	mov    %eax,%esi
+  8009a6:	03 75 10             	add    0x10(%ebp),%esi
+  8009a9:	eb 06                	jmp    8009b1 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8009ab:	83 c0 01             	add    $0x1,%eax
+  8009ae:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8009b1:	39 f0                	cmp    %esi,%eax
+  8009b3:	74 14                	je     8009c9 <memcmp+0x30>
+		if (*s1 != *s2)
+  8009b5:	0f b6 08             	movzbl (%eax),%ecx
+  8009b8:	0f b6 1a             	movzbl (%edx),%ebx
+  8009bb:	38 d9                	cmp    %bl,%cl
+  8009bd:	74 ec                	je     8009ab <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009bf:	0f b6 c1             	movzbl %cl,%eax
+  8009c2:	0f b6 db             	movzbl %bl,%ebx
+  8009c5:	29 d8                	sub    %ebx,%eax
+  8009c7:	eb 05                	jmp    8009ce <memcmp+0x35>
+	}
+
+	return 0;
+  8009c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009ce:	5b                   	pop    %ebx
+  8009cf:	5e                   	pop    %esi
+  8009d0:	5d                   	pop    %ebp
+  8009d1:	c3                   	ret
+
+008009d2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009d2:	55                   	push   %ebp
+  8009d3:	89 e5                	mov    %esp,%ebp
+  8009d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009db:	89 c2                	mov    %eax,%edx
+  8009dd:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009e0:	eb 03                	jmp    8009e5 <memfind+0x13>
+  8009e2:	83 c0 01             	add    $0x1,%eax
+  8009e5:	39 d0                	cmp    %edx,%eax
+  8009e7:	73 04                	jae    8009ed <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009e9:	38 08                	cmp    %cl,(%eax)
+  8009eb:	75 f5                	jne    8009e2 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009ed:	5d                   	pop    %ebp
+  8009ee:	c3                   	ret
+
+008009ef <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009ef:	55                   	push   %ebp
+  8009f0:	89 e5                	mov    %esp,%ebp
+  8009f2:	57                   	push   %edi
+  8009f3:	56                   	push   %esi
+  8009f4:	53                   	push   %ebx
+  8009f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009fb:	eb 03                	jmp    800a00 <strtol+0x11>
+		s++;
+  8009fd:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a00:	0f b6 02             	movzbl (%edx),%eax
+  800a03:	3c 20                	cmp    $0x20,%al
+  800a05:	74 f6                	je     8009fd <strtol+0xe>
+  800a07:	3c 09                	cmp    $0x9,%al
+  800a09:	74 f2                	je     8009fd <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a0b:	3c 2b                	cmp    $0x2b,%al
+  800a0d:	74 2a                	je     800a39 <strtol+0x4a>
+	int neg = 0;
+  800a0f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a14:	3c 2d                	cmp    $0x2d,%al
+  800a16:	74 2b                	je     800a43 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a18:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a1e:	75 0f                	jne    800a2f <strtol+0x40>
+  800a20:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a23:	74 28                	je     800a4d <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a25:	85 db                	test   %ebx,%ebx
+  800a27:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a2c:	0f 44 d8             	cmove  %eax,%ebx
+  800a2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a34:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a37:	eb 46                	jmp    800a7f <strtol+0x90>
+		s++;
+  800a39:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a41:	eb d5                	jmp    800a18 <strtol+0x29>
+		s++, neg = 1;
+  800a43:	83 c2 01             	add    $0x1,%edx
+  800a46:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a4b:	eb cb                	jmp    800a18 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a4d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a51:	74 0e                	je     800a61 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a53:	85 db                	test   %ebx,%ebx
+  800a55:	75 d8                	jne    800a2f <strtol+0x40>
+		s++, base = 8;
+  800a57:	83 c2 01             	add    $0x1,%edx
+  800a5a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a5f:	eb ce                	jmp    800a2f <strtol+0x40>
+		s += 2, base = 16;
+  800a61:	83 c2 02             	add    $0x2,%edx
+  800a64:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a69:	eb c4                	jmp    800a2f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a6b:	0f be c0             	movsbl %al,%eax
+  800a6e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a71:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a74:	7d 3a                	jge    800ab0 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a76:	83 c2 01             	add    $0x1,%edx
+  800a79:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a7d:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a7f:	0f b6 02             	movzbl (%edx),%eax
+  800a82:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a85:	89 f3                	mov    %esi,%ebx
+  800a87:	80 fb 09             	cmp    $0x9,%bl
+  800a8a:	76 df                	jbe    800a6b <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a8c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a8f:	89 f3                	mov    %esi,%ebx
+  800a91:	80 fb 19             	cmp    $0x19,%bl
+  800a94:	77 08                	ja     800a9e <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a96:	0f be c0             	movsbl %al,%eax
+  800a99:	83 e8 57             	sub    $0x57,%eax
+  800a9c:	eb d3                	jmp    800a71 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a9e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aa1:	89 f3                	mov    %esi,%ebx
+  800aa3:	80 fb 19             	cmp    $0x19,%bl
+  800aa6:	77 08                	ja     800ab0 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800aa8:	0f be c0             	movsbl %al,%eax
+  800aab:	83 e8 37             	sub    $0x37,%eax
+  800aae:	eb c1                	jmp    800a71 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ab0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ab4:	74 05                	je     800abb <strtol+0xcc>
+		*endptr = (char *) s;
+  800ab6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ab9:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800abb:	89 c8                	mov    %ecx,%eax
+  800abd:	f7 d8                	neg    %eax
+  800abf:	85 ff                	test   %edi,%edi
+  800ac1:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ac4:	89 c8                	mov    %ecx,%eax
+  800ac6:	5b                   	pop    %ebx
+  800ac7:	5e                   	pop    %esi
+  800ac8:	5f                   	pop    %edi
+  800ac9:	5d                   	pop    %ebp
+  800aca:	c3                   	ret
+
+00800acb <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800acb:	55                   	push   %ebp
+  800acc:	89 e5                	mov    %esp,%ebp
+  800ace:	57                   	push   %edi
+  800acf:	56                   	push   %esi
+  800ad0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ad9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800adc:	89 c3                	mov    %eax,%ebx
+  800ade:	89 c7                	mov    %eax,%edi
+  800ae0:	55                   	push   %ebp
+  800ae1:	89 e5                	mov    %esp,%ebp
+  800ae3:	8d 35 eb 0a 80 00    	lea    0x800aeb,%esi
+  800ae9:	0f 34                	sysenter
+  800aeb:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800aec:	5b                   	pop    %ebx
+  800aed:	5e                   	pop    %esi
+  800aee:	5f                   	pop    %edi
+  800aef:	5d                   	pop    %ebp
+  800af0:	c3                   	ret
+
+00800af1 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800af1:	55                   	push   %ebp
+  800af2:	89 e5                	mov    %esp,%ebp
+  800af4:	57                   	push   %edi
+  800af5:	56                   	push   %esi
+  800af6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800af7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800afc:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b01:	89 d1                	mov    %edx,%ecx
+  800b03:	89 d3                	mov    %edx,%ebx
+  800b05:	89 d7                	mov    %edx,%edi
+  800b07:	55                   	push   %ebp
+  800b08:	89 e5                	mov    %esp,%ebp
+  800b0a:	8d 35 12 0b 80 00    	lea    0x800b12,%esi
+  800b10:	0f 34                	sysenter
+  800b12:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800b13:	5b                   	pop    %ebx
+  800b14:	5e                   	pop    %esi
+  800b15:	5f                   	pop    %edi
+  800b16:	5d                   	pop    %ebp
+  800b17:	c3                   	ret
+
+00800b18 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b18:	55                   	push   %ebp
+  800b19:	89 e5                	mov    %esp,%ebp
+  800b1b:	57                   	push   %edi
+  800b1c:	56                   	push   %esi
+  800b1d:	53                   	push   %ebx
+  800b1e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b29:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b2e:	89 cb                	mov    %ecx,%ebx
+  800b30:	89 cf                	mov    %ecx,%edi
+  800b32:	55                   	push   %ebp
+  800b33:	89 e5                	mov    %esp,%ebp
+  800b35:	8d 35 3d 0b 80 00    	lea    0x800b3d,%esi
+  800b3b:	0f 34                	sysenter
+  800b3d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b3e:	85 c0                	test   %eax,%eax
+  800b40:	7f 08                	jg     800b4a <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800b42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b45:	5b                   	pop    %ebx
+  800b46:	5e                   	pop    %esi
+  800b47:	5f                   	pop    %edi
+  800b48:	5d                   	pop    %ebp
+  800b49:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b4a:	83 ec 0c             	sub    $0xc,%esp
+  800b4d:	50                   	push   %eax
+  800b4e:	6a 03                	push   $0x3
+  800b50:	68 87 3b 80 00       	push   $0x803b87
+  800b55:	6a 3d                	push   $0x3d
+  800b57:	68 a4 3b 80 00       	push   $0x803ba4
+  800b5c:	e8 17 27 00 00       	call   803278 <_panic>
+
+00800b61 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b61:	55                   	push   %ebp
+  800b62:	89 e5                	mov    %esp,%ebp
+  800b64:	57                   	push   %edi
+  800b65:	56                   	push   %esi
+  800b66:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b6c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b71:	89 d1                	mov    %edx,%ecx
+  800b73:	89 d3                	mov    %edx,%ebx
+  800b75:	89 d7                	mov    %edx,%edi
+  800b77:	55                   	push   %ebp
+  800b78:	89 e5                	mov    %esp,%ebp
+  800b7a:	8d 35 82 0b 80 00    	lea    0x800b82,%esi
+  800b80:	0f 34                	sysenter
+  800b82:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800b83:	5b                   	pop    %ebx
+  800b84:	5e                   	pop    %esi
+  800b85:	5f                   	pop    %edi
+  800b86:	5d                   	pop    %ebp
+  800b87:	c3                   	ret
+
+00800b88 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b88:	55                   	push   %ebp
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	57                   	push   %edi
+  800b8c:	56                   	push   %esi
+  800b8d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b93:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b98:	89 d1                	mov    %edx,%ecx
+  800b9a:	89 d3                	mov    %edx,%ebx
+  800b9c:	89 d7                	mov    %edx,%edi
+  800b9e:	89 d6                	mov    %edx,%esi
+  800ba0:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ba2:	5b                   	pop    %ebx
+  800ba3:	5e                   	pop    %esi
+  800ba4:	5f                   	pop    %edi
+  800ba5:	5d                   	pop    %ebp
+  800ba6:	c3                   	ret
+
+00800ba7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ba7:	55                   	push   %ebp
+  800ba8:	89 e5                	mov    %esp,%ebp
+  800baa:	57                   	push   %edi
+  800bab:	56                   	push   %esi
+  800bac:	53                   	push   %ebx
+  800bad:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800bb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bc0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bc3:	55                   	push   %ebp
+  800bc4:	89 e5                	mov    %esp,%ebp
+  800bc6:	8d 35 ce 0b 80 00    	lea    0x800bce,%esi
+  800bcc:	0f 34                	sysenter
+  800bce:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bcf:	85 c0                	test   %eax,%eax
+  800bd1:	7f 08                	jg     800bdb <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800bd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd6:	5b                   	pop    %ebx
+  800bd7:	5e                   	pop    %esi
+  800bd8:	5f                   	pop    %edi
+  800bd9:	5d                   	pop    %ebp
+  800bda:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bdb:	83 ec 0c             	sub    $0xc,%esp
+  800bde:	50                   	push   %eax
+  800bdf:	6a 04                	push   $0x4
+  800be1:	68 87 3b 80 00       	push   $0x803b87
+  800be6:	6a 3d                	push   $0x3d
+  800be8:	68 a4 3b 80 00       	push   $0x803ba4
+  800bed:	e8 86 26 00 00       	call   803278 <_panic>
+
+00800bf2 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	57                   	push   %edi
+  800bf6:	56                   	push   %esi
+  800bf7:	53                   	push   %ebx
+  800bf8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c01:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c06:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c09:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c0c:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c0f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c11:	85 c0                	test   %eax,%eax
+  800c13:	7f 08                	jg     800c1d <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c18:	5b                   	pop    %ebx
+  800c19:	5e                   	pop    %esi
+  800c1a:	5f                   	pop    %edi
+  800c1b:	5d                   	pop    %ebp
+  800c1c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c1d:	83 ec 0c             	sub    $0xc,%esp
+  800c20:	50                   	push   %eax
+  800c21:	6a 05                	push   $0x5
+  800c23:	68 87 3b 80 00       	push   $0x803b87
+  800c28:	6a 23                	push   $0x23
+  800c2a:	68 a4 3b 80 00       	push   $0x803ba4
+  800c2f:	e8 44 26 00 00       	call   803278 <_panic>
+
+00800c34 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	57                   	push   %edi
+  800c38:	56                   	push   %esi
+  800c39:	53                   	push   %ebx
+  800c3a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c48:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c4d:	89 df                	mov    %ebx,%edi
+  800c4f:	55                   	push   %ebp
+  800c50:	89 e5                	mov    %esp,%ebp
+  800c52:	8d 35 5a 0c 80 00    	lea    0x800c5a,%esi
+  800c58:	0f 34                	sysenter
+  800c5a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c5b:	85 c0                	test   %eax,%eax
+  800c5d:	7f 08                	jg     800c67 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800c5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c62:	5b                   	pop    %ebx
+  800c63:	5e                   	pop    %esi
+  800c64:	5f                   	pop    %edi
+  800c65:	5d                   	pop    %ebp
+  800c66:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c67:	83 ec 0c             	sub    $0xc,%esp
+  800c6a:	50                   	push   %eax
+  800c6b:	6a 06                	push   $0x6
+  800c6d:	68 87 3b 80 00       	push   $0x803b87
+  800c72:	6a 3d                	push   $0x3d
+  800c74:	68 a4 3b 80 00       	push   $0x803ba4
+  800c79:	e8 fa 25 00 00       	call   803278 <_panic>
+
+00800c7e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800c7e:	55                   	push   %ebp
+  800c7f:	89 e5                	mov    %esp,%ebp
+  800c81:	57                   	push   %edi
+  800c82:	56                   	push   %esi
+  800c83:	53                   	push   %ebx
+  800c84:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c92:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c97:	89 df                	mov    %ebx,%edi
+  800c99:	55                   	push   %ebp
+  800c9a:	89 e5                	mov    %esp,%ebp
+  800c9c:	8d 35 a4 0c 80 00    	lea    0x800ca4,%esi
+  800ca2:	0f 34                	sysenter
+  800ca4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ca5:	85 c0                	test   %eax,%eax
+  800ca7:	7f 08                	jg     800cb1 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800ca9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cac:	5b                   	pop    %ebx
+  800cad:	5e                   	pop    %esi
+  800cae:	5f                   	pop    %edi
+  800caf:	5d                   	pop    %ebp
+  800cb0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cb1:	83 ec 0c             	sub    $0xc,%esp
+  800cb4:	50                   	push   %eax
+  800cb5:	6a 08                	push   $0x8
+  800cb7:	68 87 3b 80 00       	push   $0x803b87
+  800cbc:	6a 3d                	push   $0x3d
+  800cbe:	68 a4 3b 80 00       	push   $0x803ba4
+  800cc3:	e8 b0 25 00 00       	call   803278 <_panic>
+
+00800cc8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800cc8:	55                   	push   %ebp
+  800cc9:	89 e5                	mov    %esp,%ebp
+  800ccb:	57                   	push   %edi
+  800ccc:	56                   	push   %esi
+  800ccd:	53                   	push   %ebx
+  800cce:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cdc:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ce1:	89 df                	mov    %ebx,%edi
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	8d 35 ee 0c 80 00    	lea    0x800cee,%esi
+  800cec:	0f 34                	sysenter
+  800cee:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cef:	85 c0                	test   %eax,%eax
+  800cf1:	7f 08                	jg     800cfb <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800cf3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf6:	5b                   	pop    %ebx
+  800cf7:	5e                   	pop    %esi
+  800cf8:	5f                   	pop    %edi
+  800cf9:	5d                   	pop    %ebp
+  800cfa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cfb:	83 ec 0c             	sub    $0xc,%esp
+  800cfe:	50                   	push   %eax
+  800cff:	6a 09                	push   $0x9
+  800d01:	68 87 3b 80 00       	push   $0x803b87
+  800d06:	6a 3d                	push   $0x3d
+  800d08:	68 a4 3b 80 00       	push   $0x803ba4
+  800d0d:	e8 66 25 00 00       	call   803278 <_panic>
+
+00800d12 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d12:	55                   	push   %ebp
+  800d13:	89 e5                	mov    %esp,%ebp
+  800d15:	57                   	push   %edi
+  800d16:	56                   	push   %esi
+  800d17:	53                   	push   %ebx
+  800d18:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d26:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d2b:	89 df                	mov    %ebx,%edi
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	8d 35 38 0d 80 00    	lea    0x800d38,%esi
+  800d36:	0f 34                	sysenter
+  800d38:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d39:	85 c0                	test   %eax,%eax
+  800d3b:	7f 08                	jg     800d45 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800d3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d40:	5b                   	pop    %ebx
+  800d41:	5e                   	pop    %esi
+  800d42:	5f                   	pop    %edi
+  800d43:	5d                   	pop    %ebp
+  800d44:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d45:	83 ec 0c             	sub    $0xc,%esp
+  800d48:	50                   	push   %eax
+  800d49:	6a 0a                	push   $0xa
+  800d4b:	68 87 3b 80 00       	push   $0x803b87
+  800d50:	6a 3d                	push   $0x3d
+  800d52:	68 a4 3b 80 00       	push   $0x803ba4
+  800d57:	e8 1c 25 00 00       	call   803278 <_panic>
+
+00800d5c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800d5c:	55                   	push   %ebp
+  800d5d:	89 e5                	mov    %esp,%ebp
+  800d5f:	57                   	push   %edi
+  800d60:	56                   	push   %esi
+  800d61:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d68:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d70:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d73:	55                   	push   %ebp
+  800d74:	89 e5                	mov    %esp,%ebp
+  800d76:	8d 35 7e 0d 80 00    	lea    0x800d7e,%esi
+  800d7c:	0f 34                	sysenter
+  800d7e:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800d7f:	5b                   	pop    %ebx
+  800d80:	5e                   	pop    %esi
+  800d81:	5f                   	pop    %edi
+  800d82:	5d                   	pop    %ebp
+  800d83:	c3                   	ret
+
+00800d84 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800d84:	55                   	push   %ebp
+  800d85:	89 e5                	mov    %esp,%ebp
+  800d87:	57                   	push   %edi
+  800d88:	56                   	push   %esi
+  800d89:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d90:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d98:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d9b:	55                   	push   %ebp
+  800d9c:	89 e5                	mov    %esp,%ebp
+  800d9e:	8d 35 a6 0d 80 00    	lea    0x800da6,%esi
+  800da4:	0f 34                	sysenter
+  800da6:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800da7:	5b                   	pop    %ebx
+  800da8:	5e                   	pop    %esi
+  800da9:	5f                   	pop    %edi
+  800daa:	5d                   	pop    %ebp
+  800dab:	c3                   	ret
+
+00800dac <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800dac:	55                   	push   %ebp
+  800dad:	89 e5                	mov    %esp,%ebp
+  800daf:	57                   	push   %edi
+  800db0:	56                   	push   %esi
+  800db1:	53                   	push   %ebx
+  800db2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800db5:	be 00 00 00 00       	mov    $0x0,%esi
+  800dba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800dc5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc8:	89 f7                	mov    %esi,%edi
+  800dca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dcc:	85 c0                	test   %eax,%eax
+  800dce:	7f 08                	jg     800dd8 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd3:	5b                   	pop    %ebx
+  800dd4:	5e                   	pop    %esi
+  800dd5:	5f                   	pop    %edi
+  800dd6:	5d                   	pop    %ebp
+  800dd7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd8:	83 ec 0c             	sub    $0xc,%esp
+  800ddb:	50                   	push   %eax
+  800ddc:	6a 0d                	push   $0xd
+  800dde:	68 87 3b 80 00       	push   $0x803b87
+  800de3:	6a 23                	push   $0x23
+  800de5:	68 a4 3b 80 00       	push   $0x803ba4
+  800dea:	e8 89 24 00 00       	call   803278 <_panic>
+
+00800def <sys_ipc_recv>:
+{
+  800def:	55                   	push   %ebp
+  800df0:	89 e5                	mov    %esp,%ebp
+  800df2:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800df5:	6a 00                	push   $0x0
+  800df7:	6a 01                	push   $0x1
+  800df9:	ff 75 08             	push   0x8(%ebp)
+  800dfc:	e8 ab ff ff ff       	call   800dac <sys_ipc_recvv>
+}
+  800e01:	c9                   	leave
+  800e02:	c3                   	ret
+
+00800e03 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800e03:	55                   	push   %ebp
+  800e04:	89 e5                	mov    %esp,%ebp
+  800e06:	57                   	push   %edi
+  800e07:	56                   	push   %esi
+  800e08:	53                   	push   %ebx
+  800e09:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e11:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e17:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e1c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e1f:	89 de                	mov    %ebx,%esi
+  800e21:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e23:	85 c0                	test   %eax,%eax
+  800e25:	7f 08                	jg     800e2f <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800e27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2a:	5b                   	pop    %ebx
+  800e2b:	5e                   	pop    %esi
+  800e2c:	5f                   	pop    %edi
+  800e2d:	5d                   	pop    %ebp
+  800e2e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e2f:	83 ec 0c             	sub    $0xc,%esp
+  800e32:	50                   	push   %eax
+  800e33:	6a 0d                	push   $0xd
+  800e35:	68 87 3b 80 00       	push   $0x803b87
+  800e3a:	6a 23                	push   $0x23
+  800e3c:	68 a4 3b 80 00       	push   $0x803ba4
+  800e41:	e8 32 24 00 00       	call   803278 <_panic>
+
+00800e46 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e46:	55                   	push   %ebp
+  800e47:	89 e5                	mov    %esp,%ebp
+  800e49:	57                   	push   %edi
+  800e4a:	56                   	push   %esi
+  800e4b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e51:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e56:	89 d1                	mov    %edx,%ecx
+  800e58:	89 d3                	mov    %edx,%ebx
+  800e5a:	89 d7                	mov    %edx,%edi
+  800e5c:	55                   	push   %ebp
+  800e5d:	89 e5                	mov    %esp,%ebp
+  800e5f:	8d 35 67 0e 80 00    	lea    0x800e67,%esi
+  800e65:	0f 34                	sysenter
+  800e67:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800e68:	5b                   	pop    %ebx
+  800e69:	5e                   	pop    %esi
+  800e6a:	5f                   	pop    %edi
+  800e6b:	5d                   	pop    %ebp
+  800e6c:	c3                   	ret
+
+00800e6d <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800e6d:	55                   	push   %ebp
+  800e6e:	89 e5                	mov    %esp,%ebp
+  800e70:	57                   	push   %edi
+  800e71:	56                   	push   %esi
+  800e72:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e83:	89 df                	mov    %ebx,%edi
+  800e85:	55                   	push   %ebp
+  800e86:	89 e5                	mov    %esp,%ebp
+  800e88:	8d 35 90 0e 80 00    	lea    0x800e90,%esi
+  800e8e:	0f 34                	sysenter
+  800e90:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800e91:	5b                   	pop    %ebx
+  800e92:	5e                   	pop    %esi
+  800e93:	5f                   	pop    %edi
+  800e94:	5d                   	pop    %ebp
+  800e95:	c3                   	ret
+
+00800e96 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800e96:	55                   	push   %ebp
+  800e97:	89 e5                	mov    %esp,%ebp
+  800e99:	57                   	push   %edi
+  800e9a:	56                   	push   %esi
+  800e9b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ea1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea4:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ea9:	89 cb                	mov    %ecx,%ebx
+  800eab:	89 cf                	mov    %ecx,%edi
+  800ead:	55                   	push   %ebp
+  800eae:	89 e5                	mov    %esp,%ebp
+  800eb0:	8d 35 b8 0e 80 00    	lea    0x800eb8,%esi
+  800eb6:	0f 34                	sysenter
+  800eb8:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800eb9:	5b                   	pop    %ebx
+  800eba:	5e                   	pop    %esi
+  800ebb:	5f                   	pop    %edi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	c3                   	ret
+
+00800ebe <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800ebe:	55                   	push   %ebp
+  800ebf:	89 e5                	mov    %esp,%ebp
+  800ec1:	57                   	push   %edi
+  800ec2:	56                   	push   %esi
+  800ec3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ec4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ecc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecf:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ed4:	89 df                	mov    %ebx,%edi
+  800ed6:	55                   	push   %ebp
+  800ed7:	89 e5                	mov    %esp,%ebp
+  800ed9:	8d 35 e1 0e 80 00    	lea    0x800ee1,%esi
+  800edf:	0f 34                	sysenter
+  800ee1:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800ee2:	5b                   	pop    %ebx
+  800ee3:	5e                   	pop    %esi
+  800ee4:	5f                   	pop    %edi
+  800ee5:	5d                   	pop    %ebp
+  800ee6:	c3                   	ret
+
+00800ee7 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800ee7:	55                   	push   %ebp
+  800ee8:	89 e5                	mov    %esp,%ebp
+  800eea:	57                   	push   %edi
+  800eeb:	56                   	push   %esi
+  800eec:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef8:	b8 14 00 00 00       	mov    $0x14,%eax
+  800efd:	89 df                	mov    %ebx,%edi
+  800eff:	55                   	push   %ebp
+  800f00:	89 e5                	mov    %esp,%ebp
+  800f02:	8d 35 0a 0f 80 00    	lea    0x800f0a,%esi
+  800f08:	0f 34                	sysenter
+  800f0a:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800f0b:	5b                   	pop    %ebx
+  800f0c:	5e                   	pop    %esi
+  800f0d:	5f                   	pop    %edi
+  800f0e:	5d                   	pop    %ebp
+  800f0f:	c3                   	ret
+
+00800f10 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800f10:	55                   	push   %ebp
+  800f11:	89 e5                	mov    %esp,%ebp
+  800f13:	57                   	push   %edi
+  800f14:	56                   	push   %esi
+  800f15:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1c:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f24:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f27:	55                   	push   %ebp
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	8d 35 32 0f 80 00    	lea    0x800f32,%esi
+  800f30:	0f 34                	sysenter
+  800f32:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800f33:	5b                   	pop    %ebx
+  800f34:	5e                   	pop    %esi
+  800f35:	5f                   	pop    %edi
+  800f36:	5d                   	pop    %ebp
+  800f37:	c3                   	ret
+
+00800f38 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800f38:	55                   	push   %ebp
+  800f39:	89 e5                	mov    %esp,%ebp
+  800f3b:	57                   	push   %edi
+  800f3c:	56                   	push   %esi
+  800f3d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f46:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f4b:	89 cb                	mov    %ecx,%ebx
+  800f4d:	89 cf                	mov    %ecx,%edi
+  800f4f:	89 ce                	mov    %ecx,%esi
+  800f51:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800f53:	5b                   	pop    %ebx
+  800f54:	5e                   	pop    %esi
+  800f55:	5f                   	pop    %edi
+  800f56:	5d                   	pop    %ebp
+  800f57:	c3                   	ret
+
+00800f58 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800f58:	55                   	push   %ebp
+  800f59:	89 e5                	mov    %esp,%ebp
+  800f5b:	57                   	push   %edi
+  800f5c:	56                   	push   %esi
+  800f5d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f66:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f6b:	89 cb                	mov    %ecx,%ebx
+  800f6d:	89 cf                	mov    %ecx,%edi
+  800f6f:	55                   	push   %ebp
+  800f70:	89 e5                	mov    %esp,%ebp
+  800f72:	8d 35 7a 0f 80 00    	lea    0x800f7a,%esi
+  800f78:	0f 34                	sysenter
+  800f7a:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800f7b:	5b                   	pop    %ebx
+  800f7c:	5e                   	pop    %esi
+  800f7d:	5f                   	pop    %edi
+  800f7e:	5d                   	pop    %ebp
+  800f7f:	c3                   	ret
+
+00800f80 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800f80:	55                   	push   %ebp
+  800f81:	89 e5                	mov    %esp,%ebp
+  800f83:	57                   	push   %edi
+  800f84:	56                   	push   %esi
+  800f85:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8e:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f93:	89 cb                	mov    %ecx,%ebx
+  800f95:	89 cf                	mov    %ecx,%edi
+  800f97:	55                   	push   %ebp
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	8d 35 a2 0f 80 00    	lea    0x800fa2,%esi
+  800fa0:	0f 34                	sysenter
+  800fa2:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800fa3:	5b                   	pop    %ebx
+  800fa4:	5e                   	pop    %esi
+  800fa5:	5f                   	pop    %edi
+  800fa6:	5d                   	pop    %ebp
+  800fa7:	c3                   	ret
+
+00800fa8 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  800fa8:	55                   	push   %ebp
+  800fa9:	89 e5                	mov    %esp,%ebp
+  800fab:	57                   	push   %edi
+  800fac:	56                   	push   %esi
+  800fad:	53                   	push   %ebx
+  800fae:	83 ec 20             	sub    $0x20,%esp
+  800fb1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800fb4:	89 d7                	mov    %edx,%edi
+  800fb6:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  800fb8:	51                   	push   %ecx
+  800fb9:	68 00 f0 7f 00       	push   $0x7ff000
+  800fbe:	6a 00                	push   $0x0
+  800fc0:	e8 e2 fb ff ff       	call   800ba7 <sys_page_alloc>
+  800fc5:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  800fc7:	83 c4 10             	add    $0x10,%esp
+  800fca:	85 c0                	test   %eax,%eax
+  800fcc:	78 45                	js     801013 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  800fce:	83 ec 04             	sub    $0x4,%esp
+  800fd1:	68 00 10 00 00       	push   $0x1000
+  800fd6:	57                   	push   %edi
+  800fd7:	68 00 f0 7f 00       	push   $0x7ff000
+  800fdc:	e8 40 f9 ff ff       	call   800921 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  800fe1:	89 34 24             	mov    %esi,(%esp)
+  800fe4:	57                   	push   %edi
+  800fe5:	ff 75 e4             	push   -0x1c(%ebp)
+  800fe8:	68 00 f0 7f 00       	push   $0x7ff000
+  800fed:	6a 00                	push   $0x0
+  800fef:	e8 fe fb ff ff       	call   800bf2 <sys_page_map>
+  800ff4:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  800ff6:	83 c4 20             	add    $0x20,%esp
+  800ff9:	85 c0                	test   %eax,%eax
+  800ffb:	78 16                	js     801013 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  800ffd:	83 ec 08             	sub    $0x8,%esp
+  801000:	68 00 f0 7f 00       	push   $0x7ff000
+  801005:	6a 00                	push   $0x0
+  801007:	e8 28 fc ff ff       	call   800c34 <sys_page_unmap>
+  80100c:	83 c4 10             	add    $0x10,%esp
+  80100f:	85 c0                	test   %eax,%eax
+  801011:	75 0a                	jne    80101d <copy_page_to+0x75>
+exit:
+	return r;
+}
+  801013:	89 d8                	mov    %ebx,%eax
+  801015:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801018:	5b                   	pop    %ebx
+  801019:	5e                   	pop    %esi
+  80101a:	5f                   	pop    %edi
+  80101b:	5d                   	pop    %ebp
+  80101c:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80101d:	68 b4 3b 80 00       	push   $0x803bb4
+  801022:	68 2c 3c 80 00       	push   $0x803c2c
+  801027:	6a 1b                	push   $0x1b
+  801029:	68 41 3c 80 00       	push   $0x803c41
+  80102e:	e8 45 22 00 00       	call   803278 <_panic>
+
+00801033 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801033:	55                   	push   %ebp
+  801034:	89 e5                	mov    %esp,%ebp
+  801036:	53                   	push   %ebx
+  801037:	83 ec 04             	sub    $0x4,%esp
+  80103a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  80103d:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80103f:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  801043:	74 21                	je     801066 <pgfault+0x33>
+  801045:	89 d0                	mov    %edx,%eax
+  801047:	c1 e8 16             	shr    $0x16,%eax
+  80104a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801051:	a8 01                	test   $0x1,%al
+  801053:	74 11                	je     801066 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  801055:	89 d0                	mov    %edx,%eax
+  801057:	c1 e8 0c             	shr    $0xc,%eax
+  80105a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801061:	f6 c4 08             	test   $0x8,%ah
+  801064:	75 17                	jne    80107d <pgfault+0x4a>
+		if (pgfault_next) {
+  801066:	a1 04 50 80 00       	mov    0x805004,%eax
+  80106b:	85 c0                	test   %eax,%eax
+  80106d:	74 27                	je     801096 <pgfault+0x63>
+			pgfault_next(utf);
+  80106f:	83 ec 0c             	sub    $0xc,%esp
+  801072:	53                   	push   %ebx
+  801073:	ff d0                	call   *%eax
+			return;
+  801075:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  801078:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80107b:	c9                   	leave
+  80107c:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  80107d:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  801083:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801088:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108d:	e8 16 ff ff ff       	call   800fa8 <copy_page_to>
+  801092:	85 c0                	test   %eax,%eax
+  801094:	79 e2                	jns    801078 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  801096:	a1 00 50 80 00       	mov    0x805000,%eax
+  80109b:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  80109e:	ff 73 28             	push   0x28(%ebx)
+  8010a1:	ff 33                	push   (%ebx)
+  8010a3:	50                   	push   %eax
+  8010a4:	68 d8 3b 80 00       	push   $0x803bd8
+  8010a9:	e8 ff f0 ff ff       	call   8001ad <cprintf>
+	sys_env_destroy(0);
+  8010ae:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8010b5:	e8 5e fa ff ff       	call   800b18 <sys_env_destroy>
+  8010ba:	83 c4 10             	add    $0x10,%esp
+  8010bd:	eb b9                	jmp    801078 <pgfault+0x45>
+
+008010bf <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8010bf:	55                   	push   %ebp
+  8010c0:	89 e5                	mov    %esp,%ebp
+  8010c2:	53                   	push   %ebx
+  8010c3:	83 ec 04             	sub    $0x4,%esp
+  8010c6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8010c9:	a1 04 90 80 00       	mov    0x809004,%eax
+  8010ce:	3d 33 10 80 00       	cmp    $0x801033,%eax
+  8010d3:	74 15                	je     8010ea <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8010d5:	a3 04 50 80 00       	mov    %eax,0x805004
+		set_pgfault_handler(pgfault);
+  8010da:	83 ec 0c             	sub    $0xc,%esp
+  8010dd:	68 33 10 80 00       	push   $0x801033
+  8010e2:	e8 d7 21 00 00       	call   8032be <set_pgfault_handler>
+  8010e7:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8010ea:	83 ec 0c             	sub    $0xc,%esp
+  8010ed:	68 05 08 00 00       	push   $0x805
+  8010f2:	53                   	push   %ebx
+  8010f3:	6a 00                	push   $0x0
+  8010f5:	53                   	push   %ebx
+  8010f6:	6a 00                	push   $0x0
+  8010f8:	e8 f5 fa ff ff       	call   800bf2 <sys_page_map>
+}
+  8010fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801100:	c9                   	leave
+  801101:	c3                   	ret
+
+00801102 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801102:	55                   	push   %ebp
+  801103:	89 e5                	mov    %esp,%ebp
+  801105:	57                   	push   %edi
+  801106:	56                   	push   %esi
+  801107:	53                   	push   %ebx
+  801108:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80110b:	68 33 10 80 00       	push   $0x801033
+  801110:	e8 a9 21 00 00       	call   8032be <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801115:	b8 07 00 00 00       	mov    $0x7,%eax
+  80111a:	cd 30                	int    $0x30
+  80111c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80111f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  801122:	83 c4 10             	add    $0x10,%esp
+  801125:	85 c0                	test   %eax,%eax
+  801127:	0f 88 6b 01 00 00    	js     801298 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80112d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  801132:	75 37                	jne    80116b <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801134:	e8 28 fa ff ff       	call   800b61 <sys_getenvid>
+  801139:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80113e:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  801144:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801149:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  80114e:	e9 45 01 00 00       	jmp    801298 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  801153:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801159:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80115f:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801165:	0f 87 ba 00 00 00    	ja     801225 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  80116b:	89 d8                	mov    %ebx,%eax
+  80116d:	c1 e8 16             	shr    $0x16,%eax
+  801170:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801177:	a8 01                	test   $0x1,%al
+  801179:	74 d8                	je     801153 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  80117b:	89 d8                	mov    %ebx,%eax
+  80117d:	c1 e8 0c             	shr    $0xc,%eax
+  801180:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801187:	f6 c2 01             	test   $0x1,%dl
+  80118a:	74 cd                	je     801159 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  80118c:	89 da                	mov    %ebx,%edx
+  80118e:	80 e6 df             	and    $0xdf,%dh
+  801191:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  801197:	74 c0                	je     801159 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  801199:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80119b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011a2:	f6 c6 04             	test   $0x4,%dh
+  8011a5:	75 53                	jne    8011fa <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8011a7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8011ae:	f6 c6 08             	test   $0x8,%dh
+  8011b1:	75 0c                	jne    8011bf <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8011b3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011ba:	f6 c2 02             	test   $0x2,%dl
+  8011bd:	74 3b                	je     8011fa <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8011bf:	83 ec 0c             	sub    $0xc,%esp
+  8011c2:	68 05 08 00 00       	push   $0x805
+  8011c7:	57                   	push   %edi
+  8011c8:	ff 75 e4             	push   -0x1c(%ebp)
+  8011cb:	57                   	push   %edi
+  8011cc:	6a 00                	push   $0x0
+  8011ce:	e8 1f fa ff ff       	call   800bf2 <sys_page_map>
+  8011d3:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8011d5:	83 c4 20             	add    $0x20,%esp
+  8011d8:	85 c0                	test   %eax,%eax
+  8011da:	0f 88 a7 00 00 00    	js     801287 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8011e0:	83 ec 0c             	sub    $0xc,%esp
+  8011e3:	68 05 08 00 00       	push   $0x805
+  8011e8:	57                   	push   %edi
+  8011e9:	6a 00                	push   $0x0
+  8011eb:	57                   	push   %edi
+  8011ec:	6a 00                	push   $0x0
+  8011ee:	e8 ff f9 ff ff       	call   800bf2 <sys_page_map>
+  8011f3:	89 c6                	mov    %eax,%esi
+	return r;
+  8011f5:	83 c4 20             	add    $0x20,%esp
+  8011f8:	eb 21                	jmp    80121b <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8011fa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801201:	83 ec 0c             	sub    $0xc,%esp
+  801204:	25 07 0e 00 00       	and    $0xe07,%eax
+  801209:	50                   	push   %eax
+  80120a:	57                   	push   %edi
+  80120b:	ff 75 e4             	push   -0x1c(%ebp)
+  80120e:	57                   	push   %edi
+  80120f:	6a 00                	push   $0x0
+  801211:	e8 dc f9 ff ff       	call   800bf2 <sys_page_map>
+  801216:	89 c6                	mov    %eax,%esi
+  801218:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  80121b:	85 f6                	test   %esi,%esi
+  80121d:	0f 89 36 ff ff ff    	jns    801159 <fork+0x57>
+  801223:	eb 62                	jmp    801287 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801225:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80122a:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  80122f:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801232:	89 f8                	mov    %edi,%eax
+  801234:	e8 6f fd ff ff       	call   800fa8 <copy_page_to>
+  801239:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80123b:	85 c0                	test   %eax,%eax
+  80123d:	78 48                	js     801287 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80123f:	83 ec 04             	sub    $0x4,%esp
+  801242:	6a 07                	push   $0x7
+  801244:	68 00 f0 bf ee       	push   $0xeebff000
+  801249:	57                   	push   %edi
+  80124a:	e8 58 f9 ff ff       	call   800ba7 <sys_page_alloc>
+  80124f:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801251:	83 c4 10             	add    $0x10,%esp
+  801254:	85 c0                	test   %eax,%eax
+  801256:	78 2f                	js     801287 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801258:	a1 00 50 80 00       	mov    0x805000,%eax
+  80125d:	8b 40 64             	mov    0x64(%eax),%eax
+  801260:	83 ec 08             	sub    $0x8,%esp
+  801263:	50                   	push   %eax
+  801264:	57                   	push   %edi
+  801265:	e8 a8 fa ff ff       	call   800d12 <sys_env_set_pgfault_upcall>
+  80126a:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80126c:	83 c4 10             	add    $0x10,%esp
+  80126f:	85 c0                	test   %eax,%eax
+  801271:	78 14                	js     801287 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  801273:	83 ec 08             	sub    $0x8,%esp
+  801276:	6a 02                	push   $0x2
+  801278:	57                   	push   %edi
+  801279:	e8 00 fa ff ff       	call   800c7e <sys_env_set_status>
+  80127e:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801280:	83 c4 10             	add    $0x10,%esp
+  801283:	85 c0                	test   %eax,%eax
+  801285:	79 11                	jns    801298 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  801287:	83 ec 0c             	sub    $0xc,%esp
+  80128a:	ff 75 e0             	push   -0x20(%ebp)
+  80128d:	e8 86 f8 ff ff       	call   800b18 <sys_env_destroy>
+	return r;
+  801292:	83 c4 10             	add    $0x10,%esp
+  801295:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  801298:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80129b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129e:	5b                   	pop    %ebx
+  80129f:	5e                   	pop    %esi
+  8012a0:	5f                   	pop    %edi
+  8012a1:	5d                   	pop    %ebp
+  8012a2:	c3                   	ret
+
+008012a3 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8012a3:	55                   	push   %ebp
+  8012a4:	89 e5                	mov    %esp,%ebp
+  8012a6:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8012a9:	68 4c 3c 80 00       	push   $0x803c4c
+  8012ae:	68 bf 00 00 00       	push   $0xbf
+  8012b3:	68 41 3c 80 00       	push   $0x803c41
+  8012b8:	e8 bb 1f 00 00       	call   803278 <_panic>
+
+008012bd <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012bd:	55                   	push   %ebp
+  8012be:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012c3:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012c8:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012cb:	5d                   	pop    %ebp
+  8012cc:	c3                   	ret
+
+008012cd <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012cd:	55                   	push   %ebp
+  8012ce:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012d3:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8012d8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012dd:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8012e2:	5d                   	pop    %ebp
+  8012e3:	c3                   	ret
+
+008012e4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012e4:	55                   	push   %ebp
+  8012e5:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8012e7:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8012ec:	eb 02                	jmp    8012f0 <fd_alloc+0xc>
+  8012ee:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8012f0:	89 c2                	mov    %eax,%edx
+  8012f2:	c1 ea 16             	shr    $0x16,%edx
+  8012f5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8012fc:	f6 c2 01             	test   $0x1,%dl
+  8012ff:	74 2b                	je     80132c <fd_alloc+0x48>
+  801301:	89 c2                	mov    %eax,%edx
+  801303:	c1 ea 0c             	shr    $0xc,%edx
+  801306:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80130d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801313:	f6 c1 01             	test   $0x1,%cl
+  801316:	74 14                	je     80132c <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801318:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80131e:	75 ce                	jne    8012ee <fd_alloc+0xa>
+  801320:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801325:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80132a:	eb 05                	jmp    801331 <fd_alloc+0x4d>
+			return 0;
+  80132c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801331:	8b 55 08             	mov    0x8(%ebp),%edx
+  801334:	89 02                	mov    %eax,(%edx)
+}
+  801336:	89 c8                	mov    %ecx,%eax
+  801338:	5d                   	pop    %ebp
+  801339:	c3                   	ret
+
+0080133a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80133a:	55                   	push   %ebp
+  80133b:	89 e5                	mov    %esp,%ebp
+  80133d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801340:	83 f8 1f             	cmp    $0x1f,%eax
+  801343:	77 30                	ja     801375 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801345:	c1 e0 0c             	shl    $0xc,%eax
+  801348:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80134d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801353:	f6 c2 01             	test   $0x1,%dl
+  801356:	74 24                	je     80137c <fd_lookup+0x42>
+  801358:	89 c2                	mov    %eax,%edx
+  80135a:	c1 ea 0c             	shr    $0xc,%edx
+  80135d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801364:	f6 c2 01             	test   $0x1,%dl
+  801367:	74 1a                	je     801383 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801369:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80136c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80136e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801373:	5d                   	pop    %ebp
+  801374:	c3                   	ret
+		return -E_INVAL;
+  801375:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80137a:	eb f7                	jmp    801373 <fd_lookup+0x39>
+		return -E_INVAL;
+  80137c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801381:	eb f0                	jmp    801373 <fd_lookup+0x39>
+  801383:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801388:	eb e9                	jmp    801373 <fd_lookup+0x39>
+
+0080138a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80138a:	55                   	push   %ebp
+  80138b:	89 e5                	mov    %esp,%ebp
+  80138d:	53                   	push   %ebx
+  80138e:	83 ec 04             	sub    $0x4,%esp
+  801391:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801394:	b8 00 00 00 00       	mov    $0x0,%eax
+  801399:	eb 03                	jmp    80139e <dev_lookup+0x14>
+  80139b:	83 c0 01             	add    $0x1,%eax
+  80139e:	8b 1c 85 e0 3c 80 00 	mov    0x803ce0(,%eax,4),%ebx
+  8013a5:	85 db                	test   %ebx,%ebx
+  8013a7:	74 0b                	je     8013b4 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8013a9:	39 13                	cmp    %edx,(%ebx)
+  8013ab:	75 ee                	jne    80139b <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8013ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b2:	eb 1f                	jmp    8013d3 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013b4:	a1 00 50 80 00       	mov    0x805000,%eax
+  8013b9:	8b 40 48             	mov    0x48(%eax),%eax
+  8013bc:	83 ec 04             	sub    $0x4,%esp
+  8013bf:	52                   	push   %edx
+  8013c0:	50                   	push   %eax
+  8013c1:	68 64 3c 80 00       	push   $0x803c64
+  8013c6:	e8 e2 ed ff ff       	call   8001ad <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8013cb:	83 c4 10             	add    $0x10,%esp
+  8013ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8013d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013d6:	89 1a                	mov    %ebx,(%edx)
+}
+  8013d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013db:	c9                   	leave
+  8013dc:	c3                   	ret
+
+008013dd <fd_close>:
+{
+  8013dd:	55                   	push   %ebp
+  8013de:	89 e5                	mov    %esp,%ebp
+  8013e0:	57                   	push   %edi
+  8013e1:	56                   	push   %esi
+  8013e2:	53                   	push   %ebx
+  8013e3:	83 ec 24             	sub    $0x24,%esp
+  8013e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013e9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013ec:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013ef:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013f0:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8013f6:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013f9:	50                   	push   %eax
+  8013fa:	e8 3b ff ff ff       	call   80133a <fd_lookup>
+  8013ff:	89 c3                	mov    %eax,%ebx
+  801401:	83 c4 10             	add    $0x10,%esp
+  801404:	85 c0                	test   %eax,%eax
+  801406:	78 05                	js     80140d <fd_close+0x30>
+	    || fd != fd2)
+  801408:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80140b:	74 16                	je     801423 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80140d:	89 f8                	mov    %edi,%eax
+  80140f:	84 c0                	test   %al,%al
+  801411:	b8 00 00 00 00       	mov    $0x0,%eax
+  801416:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801419:	89 d8                	mov    %ebx,%eax
+  80141b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141e:	5b                   	pop    %ebx
+  80141f:	5e                   	pop    %esi
+  801420:	5f                   	pop    %edi
+  801421:	5d                   	pop    %ebp
+  801422:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801423:	83 ec 08             	sub    $0x8,%esp
+  801426:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801429:	50                   	push   %eax
+  80142a:	ff 36                	push   (%esi)
+  80142c:	e8 59 ff ff ff       	call   80138a <dev_lookup>
+  801431:	89 c3                	mov    %eax,%ebx
+  801433:	83 c4 10             	add    $0x10,%esp
+  801436:	85 c0                	test   %eax,%eax
+  801438:	78 1a                	js     801454 <fd_close+0x77>
+		if (dev->dev_close)
+  80143a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80143d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801440:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801445:	85 c0                	test   %eax,%eax
+  801447:	74 0b                	je     801454 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801449:	83 ec 0c             	sub    $0xc,%esp
+  80144c:	56                   	push   %esi
+  80144d:	ff d0                	call   *%eax
+  80144f:	89 c3                	mov    %eax,%ebx
+  801451:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801454:	83 ec 08             	sub    $0x8,%esp
+  801457:	56                   	push   %esi
+  801458:	6a 00                	push   $0x0
+  80145a:	e8 d5 f7 ff ff       	call   800c34 <sys_page_unmap>
+	return r;
+  80145f:	83 c4 10             	add    $0x10,%esp
+  801462:	eb b5                	jmp    801419 <fd_close+0x3c>
+
+00801464 <close>:
+
+int
+close(int fdnum)
+{
+  801464:	55                   	push   %ebp
+  801465:	89 e5                	mov    %esp,%ebp
+  801467:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80146a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80146d:	50                   	push   %eax
+  80146e:	ff 75 08             	push   0x8(%ebp)
+  801471:	e8 c4 fe ff ff       	call   80133a <fd_lookup>
+  801476:	83 c4 10             	add    $0x10,%esp
+  801479:	85 c0                	test   %eax,%eax
+  80147b:	79 02                	jns    80147f <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80147d:	c9                   	leave
+  80147e:	c3                   	ret
+		return fd_close(fd, 1);
+  80147f:	83 ec 08             	sub    $0x8,%esp
+  801482:	6a 01                	push   $0x1
+  801484:	ff 75 f4             	push   -0xc(%ebp)
+  801487:	e8 51 ff ff ff       	call   8013dd <fd_close>
+  80148c:	83 c4 10             	add    $0x10,%esp
+  80148f:	eb ec                	jmp    80147d <close+0x19>
+
+00801491 <close_all>:
+
+void
+close_all(void)
+{
+  801491:	55                   	push   %ebp
+  801492:	89 e5                	mov    %esp,%ebp
+  801494:	53                   	push   %ebx
+  801495:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801498:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80149d:	83 ec 0c             	sub    $0xc,%esp
+  8014a0:	53                   	push   %ebx
+  8014a1:	e8 be ff ff ff       	call   801464 <close>
+	for (i = 0; i < MAXFD; i++)
+  8014a6:	83 c3 01             	add    $0x1,%ebx
+  8014a9:	83 c4 10             	add    $0x10,%esp
+  8014ac:	83 fb 20             	cmp    $0x20,%ebx
+  8014af:	75 ec                	jne    80149d <close_all+0xc>
+}
+  8014b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014b4:	c9                   	leave
+  8014b5:	c3                   	ret
+
+008014b6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014b6:	55                   	push   %ebp
+  8014b7:	89 e5                	mov    %esp,%ebp
+  8014b9:	57                   	push   %edi
+  8014ba:	56                   	push   %esi
+  8014bb:	53                   	push   %ebx
+  8014bc:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014bf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014c2:	50                   	push   %eax
+  8014c3:	ff 75 08             	push   0x8(%ebp)
+  8014c6:	e8 6f fe ff ff       	call   80133a <fd_lookup>
+  8014cb:	89 c3                	mov    %eax,%ebx
+  8014cd:	83 c4 10             	add    $0x10,%esp
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	78 7f                	js     801553 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8014d4:	83 ec 0c             	sub    $0xc,%esp
+  8014d7:	ff 75 0c             	push   0xc(%ebp)
+  8014da:	e8 85 ff ff ff       	call   801464 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014df:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014e2:	c1 e6 0c             	shl    $0xc,%esi
+  8014e5:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8014eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014ee:	89 3c 24             	mov    %edi,(%esp)
+  8014f1:	e8 d7 fd ff ff       	call   8012cd <fd2data>
+  8014f6:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8014f8:	89 34 24             	mov    %esi,(%esp)
+  8014fb:	e8 cd fd ff ff       	call   8012cd <fd2data>
+  801500:	83 c4 10             	add    $0x10,%esp
+  801503:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801506:	89 d8                	mov    %ebx,%eax
+  801508:	c1 e8 16             	shr    $0x16,%eax
+  80150b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801512:	a8 01                	test   $0x1,%al
+  801514:	74 11                	je     801527 <dup+0x71>
+  801516:	89 d8                	mov    %ebx,%eax
+  801518:	c1 e8 0c             	shr    $0xc,%eax
+  80151b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801522:	f6 c2 01             	test   $0x1,%dl
+  801525:	75 36                	jne    80155d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801527:	89 f8                	mov    %edi,%eax
+  801529:	c1 e8 0c             	shr    $0xc,%eax
+  80152c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801533:	83 ec 0c             	sub    $0xc,%esp
+  801536:	25 07 0e 00 00       	and    $0xe07,%eax
+  80153b:	50                   	push   %eax
+  80153c:	56                   	push   %esi
+  80153d:	6a 00                	push   $0x0
+  80153f:	57                   	push   %edi
+  801540:	6a 00                	push   $0x0
+  801542:	e8 ab f6 ff ff       	call   800bf2 <sys_page_map>
+  801547:	89 c3                	mov    %eax,%ebx
+  801549:	83 c4 20             	add    $0x20,%esp
+  80154c:	85 c0                	test   %eax,%eax
+  80154e:	78 33                	js     801583 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801550:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801553:	89 d8                	mov    %ebx,%eax
+  801555:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801558:	5b                   	pop    %ebx
+  801559:	5e                   	pop    %esi
+  80155a:	5f                   	pop    %edi
+  80155b:	5d                   	pop    %ebp
+  80155c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80155d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801564:	83 ec 0c             	sub    $0xc,%esp
+  801567:	25 07 0e 00 00       	and    $0xe07,%eax
+  80156c:	50                   	push   %eax
+  80156d:	ff 75 d4             	push   -0x2c(%ebp)
+  801570:	6a 00                	push   $0x0
+  801572:	53                   	push   %ebx
+  801573:	6a 00                	push   $0x0
+  801575:	e8 78 f6 ff ff       	call   800bf2 <sys_page_map>
+  80157a:	89 c3                	mov    %eax,%ebx
+  80157c:	83 c4 20             	add    $0x20,%esp
+  80157f:	85 c0                	test   %eax,%eax
+  801581:	79 a4                	jns    801527 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801583:	83 ec 08             	sub    $0x8,%esp
+  801586:	56                   	push   %esi
+  801587:	6a 00                	push   $0x0
+  801589:	e8 a6 f6 ff ff       	call   800c34 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80158e:	83 c4 08             	add    $0x8,%esp
+  801591:	ff 75 d4             	push   -0x2c(%ebp)
+  801594:	6a 00                	push   $0x0
+  801596:	e8 99 f6 ff ff       	call   800c34 <sys_page_unmap>
+	return r;
+  80159b:	83 c4 10             	add    $0x10,%esp
+  80159e:	eb b3                	jmp    801553 <dup+0x9d>
+
+008015a0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015a0:	55                   	push   %ebp
+  8015a1:	89 e5                	mov    %esp,%ebp
+  8015a3:	56                   	push   %esi
+  8015a4:	53                   	push   %ebx
+  8015a5:	83 ec 18             	sub    $0x18,%esp
+  8015a8:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ab:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015ae:	50                   	push   %eax
+  8015af:	56                   	push   %esi
+  8015b0:	e8 85 fd ff ff       	call   80133a <fd_lookup>
+  8015b5:	83 c4 10             	add    $0x10,%esp
+  8015b8:	85 c0                	test   %eax,%eax
+  8015ba:	78 3c                	js     8015f8 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015bc:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8015bf:	83 ec 08             	sub    $0x8,%esp
+  8015c2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015c5:	50                   	push   %eax
+  8015c6:	ff 33                	push   (%ebx)
+  8015c8:	e8 bd fd ff ff       	call   80138a <dev_lookup>
+  8015cd:	83 c4 10             	add    $0x10,%esp
+  8015d0:	85 c0                	test   %eax,%eax
+  8015d2:	78 24                	js     8015f8 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8015d4:	8b 43 08             	mov    0x8(%ebx),%eax
+  8015d7:	83 e0 03             	and    $0x3,%eax
+  8015da:	83 f8 01             	cmp    $0x1,%eax
+  8015dd:	74 20                	je     8015ff <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015e2:	8b 40 08             	mov    0x8(%eax),%eax
+  8015e5:	85 c0                	test   %eax,%eax
+  8015e7:	74 37                	je     801620 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8015e9:	83 ec 04             	sub    $0x4,%esp
+  8015ec:	ff 75 10             	push   0x10(%ebp)
+  8015ef:	ff 75 0c             	push   0xc(%ebp)
+  8015f2:	53                   	push   %ebx
+  8015f3:	ff d0                	call   *%eax
+  8015f5:	83 c4 10             	add    $0x10,%esp
+}
+  8015f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015fb:	5b                   	pop    %ebx
+  8015fc:	5e                   	pop    %esi
+  8015fd:	5d                   	pop    %ebp
+  8015fe:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015ff:	a1 00 50 80 00       	mov    0x805000,%eax
+  801604:	8b 40 48             	mov    0x48(%eax),%eax
+  801607:	83 ec 04             	sub    $0x4,%esp
+  80160a:	56                   	push   %esi
+  80160b:	50                   	push   %eax
+  80160c:	68 a5 3c 80 00       	push   $0x803ca5
+  801611:	e8 97 eb ff ff       	call   8001ad <cprintf>
+		return -E_INVAL;
+  801616:	83 c4 10             	add    $0x10,%esp
+  801619:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80161e:	eb d8                	jmp    8015f8 <read+0x58>
+		return -E_NOT_SUPP;
+  801620:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801625:	eb d1                	jmp    8015f8 <read+0x58>
+
+00801627 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801627:	55                   	push   %ebp
+  801628:	89 e5                	mov    %esp,%ebp
+  80162a:	57                   	push   %edi
+  80162b:	56                   	push   %esi
+  80162c:	53                   	push   %ebx
+  80162d:	83 ec 0c             	sub    $0xc,%esp
+  801630:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801633:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801636:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163b:	eb 02                	jmp    80163f <readn+0x18>
+  80163d:	01 c3                	add    %eax,%ebx
+  80163f:	39 f3                	cmp    %esi,%ebx
+  801641:	73 21                	jae    801664 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801643:	83 ec 04             	sub    $0x4,%esp
+  801646:	89 f0                	mov    %esi,%eax
+  801648:	29 d8                	sub    %ebx,%eax
+  80164a:	50                   	push   %eax
+  80164b:	89 d8                	mov    %ebx,%eax
+  80164d:	03 45 0c             	add    0xc(%ebp),%eax
+  801650:	50                   	push   %eax
+  801651:	57                   	push   %edi
+  801652:	e8 49 ff ff ff       	call   8015a0 <read>
+		if (m < 0)
+  801657:	83 c4 10             	add    $0x10,%esp
+  80165a:	85 c0                	test   %eax,%eax
+  80165c:	78 04                	js     801662 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80165e:	75 dd                	jne    80163d <readn+0x16>
+  801660:	eb 02                	jmp    801664 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801662:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801664:	89 d8                	mov    %ebx,%eax
+  801666:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801669:	5b                   	pop    %ebx
+  80166a:	5e                   	pop    %esi
+  80166b:	5f                   	pop    %edi
+  80166c:	5d                   	pop    %ebp
+  80166d:	c3                   	ret
+
+0080166e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80166e:	55                   	push   %ebp
+  80166f:	89 e5                	mov    %esp,%ebp
+  801671:	56                   	push   %esi
+  801672:	53                   	push   %ebx
+  801673:	83 ec 18             	sub    $0x18,%esp
+  801676:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801679:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80167c:	50                   	push   %eax
+  80167d:	53                   	push   %ebx
+  80167e:	e8 b7 fc ff ff       	call   80133a <fd_lookup>
+  801683:	83 c4 10             	add    $0x10,%esp
+  801686:	85 c0                	test   %eax,%eax
+  801688:	78 37                	js     8016c1 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80168a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80168d:	83 ec 08             	sub    $0x8,%esp
+  801690:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801693:	50                   	push   %eax
+  801694:	ff 36                	push   (%esi)
+  801696:	e8 ef fc ff ff       	call   80138a <dev_lookup>
+  80169b:	83 c4 10             	add    $0x10,%esp
+  80169e:	85 c0                	test   %eax,%eax
+  8016a0:	78 1f                	js     8016c1 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016a2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016a6:	74 20                	je     8016c8 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ab:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016ae:	85 c0                	test   %eax,%eax
+  8016b0:	74 37                	je     8016e9 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8016b2:	83 ec 04             	sub    $0x4,%esp
+  8016b5:	ff 75 10             	push   0x10(%ebp)
+  8016b8:	ff 75 0c             	push   0xc(%ebp)
+  8016bb:	56                   	push   %esi
+  8016bc:	ff d0                	call   *%eax
+  8016be:	83 c4 10             	add    $0x10,%esp
+}
+  8016c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016c4:	5b                   	pop    %ebx
+  8016c5:	5e                   	pop    %esi
+  8016c6:	5d                   	pop    %ebp
+  8016c7:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016c8:	a1 00 50 80 00       	mov    0x805000,%eax
+  8016cd:	8b 40 48             	mov    0x48(%eax),%eax
+  8016d0:	83 ec 04             	sub    $0x4,%esp
+  8016d3:	53                   	push   %ebx
+  8016d4:	50                   	push   %eax
+  8016d5:	68 c1 3c 80 00       	push   $0x803cc1
+  8016da:	e8 ce ea ff ff       	call   8001ad <cprintf>
+		return -E_INVAL;
+  8016df:	83 c4 10             	add    $0x10,%esp
+  8016e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e7:	eb d8                	jmp    8016c1 <write+0x53>
+		return -E_NOT_SUPP;
+  8016e9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016ee:	eb d1                	jmp    8016c1 <write+0x53>
+
+008016f0 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016f0:	55                   	push   %ebp
+  8016f1:	89 e5                	mov    %esp,%ebp
+  8016f3:	53                   	push   %ebx
+  8016f4:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016f7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016fa:	50                   	push   %eax
+  8016fb:	ff 75 08             	push   0x8(%ebp)
+  8016fe:	e8 37 fc ff ff       	call   80133a <fd_lookup>
+  801703:	83 c4 10             	add    $0x10,%esp
+  801706:	85 c0                	test   %eax,%eax
+  801708:	78 3a                	js     801744 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80170a:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80170d:	83 ec 08             	sub    $0x8,%esp
+  801710:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801713:	50                   	push   %eax
+  801714:	ff 33                	push   (%ebx)
+  801716:	e8 6f fc ff ff       	call   80138a <dev_lookup>
+  80171b:	83 c4 10             	add    $0x10,%esp
+  80171e:	85 c0                	test   %eax,%eax
+  801720:	78 22                	js     801744 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801722:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801725:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801728:	85 c0                	test   %eax,%eax
+  80172a:	74 0d                	je     801739 <seek+0x49>
+  80172c:	83 ec 0c             	sub    $0xc,%esp
+  80172f:	53                   	push   %ebx
+  801730:	ff d0                	call   *%eax
+  801732:	83 c4 10             	add    $0x10,%esp
+  801735:	85 c0                	test   %eax,%eax
+  801737:	78 0b                	js     801744 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801739:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80173c:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  80173f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801744:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801747:	c9                   	leave
+  801748:	c3                   	ret
+
+00801749 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801749:	55                   	push   %ebp
+  80174a:	89 e5                	mov    %esp,%ebp
+  80174c:	53                   	push   %ebx
+  80174d:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801750:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801753:	50                   	push   %eax
+  801754:	ff 75 08             	push   0x8(%ebp)
+  801757:	e8 de fb ff ff       	call   80133a <fd_lookup>
+  80175c:	83 c4 10             	add    $0x10,%esp
+  80175f:	85 c0                	test   %eax,%eax
+  801761:	78 2b                	js     80178e <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801763:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801766:	83 ec 08             	sub    $0x8,%esp
+  801769:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80176c:	50                   	push   %eax
+  80176d:	ff 33                	push   (%ebx)
+  80176f:	e8 16 fc ff ff       	call   80138a <dev_lookup>
+  801774:	83 c4 10             	add    $0x10,%esp
+  801777:	85 c0                	test   %eax,%eax
+  801779:	78 13                	js     80178e <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  80177b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80177e:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801781:	85 c0                	test   %eax,%eax
+  801783:	74 0e                	je     801793 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801785:	83 ec 0c             	sub    $0xc,%esp
+  801788:	53                   	push   %ebx
+  801789:	ff d0                	call   *%eax
+  80178b:	83 c4 10             	add    $0x10,%esp
+}
+  80178e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801791:	c9                   	leave
+  801792:	c3                   	ret
+		return 0;
+  801793:	b8 00 00 00 00       	mov    $0x0,%eax
+  801798:	eb f4                	jmp    80178e <fsync+0x45>
+
+0080179a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80179a:	55                   	push   %ebp
+  80179b:	89 e5                	mov    %esp,%ebp
+  80179d:	56                   	push   %esi
+  80179e:	53                   	push   %ebx
+  80179f:	83 ec 18             	sub    $0x18,%esp
+  8017a2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017a5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017a8:	50                   	push   %eax
+  8017a9:	53                   	push   %ebx
+  8017aa:	e8 8b fb ff ff       	call   80133a <fd_lookup>
+  8017af:	83 c4 10             	add    $0x10,%esp
+  8017b2:	85 c0                	test   %eax,%eax
+  8017b4:	78 34                	js     8017ea <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017b6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017b9:	83 ec 08             	sub    $0x8,%esp
+  8017bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017bf:	50                   	push   %eax
+  8017c0:	ff 36                	push   (%esi)
+  8017c2:	e8 c3 fb ff ff       	call   80138a <dev_lookup>
+  8017c7:	83 c4 10             	add    $0x10,%esp
+  8017ca:	85 c0                	test   %eax,%eax
+  8017cc:	78 1c                	js     8017ea <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017ce:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017d2:	74 1d                	je     8017f1 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8017d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017d7:	8b 40 18             	mov    0x18(%eax),%eax
+  8017da:	85 c0                	test   %eax,%eax
+  8017dc:	74 34                	je     801812 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8017de:	83 ec 08             	sub    $0x8,%esp
+  8017e1:	ff 75 0c             	push   0xc(%ebp)
+  8017e4:	56                   	push   %esi
+  8017e5:	ff d0                	call   *%eax
+  8017e7:	83 c4 10             	add    $0x10,%esp
+}
+  8017ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017ed:	5b                   	pop    %ebx
+  8017ee:	5e                   	pop    %esi
+  8017ef:	5d                   	pop    %ebp
+  8017f0:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8017f1:	a1 00 50 80 00       	mov    0x805000,%eax
+  8017f6:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017f9:	83 ec 04             	sub    $0x4,%esp
+  8017fc:	53                   	push   %ebx
+  8017fd:	50                   	push   %eax
+  8017fe:	68 84 3c 80 00       	push   $0x803c84
+  801803:	e8 a5 e9 ff ff       	call   8001ad <cprintf>
+		return -E_INVAL;
+  801808:	83 c4 10             	add    $0x10,%esp
+  80180b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801810:	eb d8                	jmp    8017ea <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801812:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801817:	eb d1                	jmp    8017ea <ftruncate+0x50>
+
+00801819 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801819:	55                   	push   %ebp
+  80181a:	89 e5                	mov    %esp,%ebp
+  80181c:	56                   	push   %esi
+  80181d:	53                   	push   %ebx
+  80181e:	83 ec 18             	sub    $0x18,%esp
+  801821:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801824:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801827:	50                   	push   %eax
+  801828:	ff 75 08             	push   0x8(%ebp)
+  80182b:	e8 0a fb ff ff       	call   80133a <fd_lookup>
+  801830:	83 c4 10             	add    $0x10,%esp
+  801833:	85 c0                	test   %eax,%eax
+  801835:	78 49                	js     801880 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801837:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80183a:	83 ec 08             	sub    $0x8,%esp
+  80183d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801840:	50                   	push   %eax
+  801841:	ff 36                	push   (%esi)
+  801843:	e8 42 fb ff ff       	call   80138a <dev_lookup>
+  801848:	83 c4 10             	add    $0x10,%esp
+  80184b:	85 c0                	test   %eax,%eax
+  80184d:	78 31                	js     801880 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80184f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801852:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801856:	74 2f                	je     801887 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801858:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80185b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801862:	00 00 00 
+	stat->st_isdir = 0;
+  801865:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80186c:	00 00 00 
+	stat->st_dev = dev;
+  80186f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801875:	83 ec 08             	sub    $0x8,%esp
+  801878:	53                   	push   %ebx
+  801879:	56                   	push   %esi
+  80187a:	ff 50 14             	call   *0x14(%eax)
+  80187d:	83 c4 10             	add    $0x10,%esp
+}
+  801880:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801883:	5b                   	pop    %ebx
+  801884:	5e                   	pop    %esi
+  801885:	5d                   	pop    %ebp
+  801886:	c3                   	ret
+		return -E_NOT_SUPP;
+  801887:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80188c:	eb f2                	jmp    801880 <fstat+0x67>
+
+0080188e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80188e:	55                   	push   %ebp
+  80188f:	89 e5                	mov    %esp,%ebp
+  801891:	56                   	push   %esi
+  801892:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801893:	83 ec 08             	sub    $0x8,%esp
+  801896:	68 00 10 00 00       	push   $0x1000
+  80189b:	ff 75 08             	push   0x8(%ebp)
+  80189e:	e8 b3 07 00 00       	call   802056 <open>
+  8018a3:	89 c3                	mov    %eax,%ebx
+  8018a5:	83 c4 10             	add    $0x10,%esp
+  8018a8:	85 c0                	test   %eax,%eax
+  8018aa:	78 1b                	js     8018c7 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  8018ac:	83 ec 08             	sub    $0x8,%esp
+  8018af:	ff 75 0c             	push   0xc(%ebp)
+  8018b2:	50                   	push   %eax
+  8018b3:	e8 61 ff ff ff       	call   801819 <fstat>
+  8018b8:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8018ba:	89 1c 24             	mov    %ebx,(%esp)
+  8018bd:	e8 a2 fb ff ff       	call   801464 <close>
+	return r;
+  8018c2:	83 c4 10             	add    $0x10,%esp
+  8018c5:	89 f3                	mov    %esi,%ebx
+}
+  8018c7:	89 d8                	mov    %ebx,%eax
+  8018c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018cc:	5b                   	pop    %ebx
+  8018cd:	5e                   	pop    %esi
+  8018ce:	5d                   	pop    %ebp
+  8018cf:	c3                   	ret
+
+008018d0 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  8018d0:	55                   	push   %ebp
+  8018d1:	89 e5                	mov    %esp,%ebp
+  8018d3:	57                   	push   %edi
+  8018d4:	56                   	push   %esi
+  8018d5:	53                   	push   %ebx
+  8018d6:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  8018dc:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  8018e2:	89 d6                	mov    %edx,%esi
+  8018e4:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  8018ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  8018ed:	89 d3                	mov    %edx,%ebx
+  8018ef:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  8018f5:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  8018fc:	74 1d                	je     80191b <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8018fe:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801903:	83 c8 07             	or     $0x7,%eax
+  801906:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  80190c:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801911:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801917:	01 ce                	add    %ecx,%esi
+  801919:	eb 28                	jmp    801943 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80191b:	83 ec 0c             	sub    $0xc,%esp
+  80191e:	6a 01                	push   $0x1
+  801920:	e8 d6 1b 00 00       	call   8034fb <ipc_find_env>
+  801925:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  80192a:	83 c4 10             	add    $0x10,%esp
+  80192d:	eb cf                	jmp    8018fe <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  80192f:	83 c0 01             	add    $0x1,%eax
+  801932:	89 fa                	mov    %edi,%edx
+  801934:	09 da                	or     %ebx,%edx
+  801936:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  80193d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801943:	39 f3                	cmp    %esi,%ebx
+  801945:	72 e8                	jb     80192f <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801947:	83 f8 41             	cmp    $0x41,%eax
+  80194a:	77 2f                	ja     80197b <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  80194c:	50                   	push   %eax
+  80194d:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801953:	50                   	push   %eax
+  801954:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  80195a:	ff 35 c8 70 80 00    	push   0x8070c8
+  801960:	e8 48 1b 00 00       	call   8034ad <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801965:	83 c4 0c             	add    $0xc,%esp
+  801968:	6a 00                	push   $0x0
+  80196a:	6a 00                	push   $0x0
+  80196c:	6a 00                	push   $0x0
+  80196e:	e8 e4 19 00 00       	call   803357 <ipc_recv>
+}
+  801973:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801976:	5b                   	pop    %ebx
+  801977:	5e                   	pop    %esi
+  801978:	5f                   	pop    %edi
+  801979:	5d                   	pop    %ebp
+  80197a:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  80197b:	68 f4 3c 80 00       	push   $0x803cf4
+  801980:	68 2c 3c 80 00       	push   $0x803c2c
+  801985:	6a 40                	push   $0x40
+  801987:	68 10 3d 80 00       	push   $0x803d10
+  80198c:	e8 e7 18 00 00       	call   803278 <_panic>
+
+00801991 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801991:	55                   	push   %ebp
+  801992:	89 e5                	mov    %esp,%ebp
+  801994:	57                   	push   %edi
+  801995:	56                   	push   %esi
+  801996:	53                   	push   %ebx
+  801997:	83 ec 1c             	sub    $0x1c,%esp
+  80199a:	89 c3                	mov    %eax,%ebx
+  80199c:	89 d6                	mov    %edx,%esi
+  80199e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  8019a1:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  8019a7:	89 ca                	mov    %ecx,%edx
+  8019a9:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  8019ac:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  8019b3:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8019b6:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  8019bd:	8b 76 0c             	mov    0xc(%esi),%esi
+  8019c0:	89 fb                	mov    %edi,%ebx
+  8019c2:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  8019c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019cc:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  8019d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019d6:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  8019dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019e0:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  8019e7:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  8019ea:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  8019f1:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  8019f6:	39 c8                	cmp    %ecx,%eax
+  8019f8:	74 0d                	je     801a07 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  8019fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a02:	5b                   	pop    %ebx
+  801a03:	5e                   	pop    %esi
+  801a04:	5f                   	pop    %edi
+  801a05:	5d                   	pop    %ebp
+  801a06:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a07:	6a 07                	push   $0x7
+  801a09:	68 00 60 80 00       	push   $0x806000
+  801a0e:	6a 0d                	push   $0xd
+  801a10:	ff 35 c8 70 80 00    	push   0x8070c8
+  801a16:	e8 a7 19 00 00       	call   8033c2 <ipc_send>
+  801a1b:	83 c4 10             	add    $0x10,%esp
+  801a1e:	eb da                	jmp    8019fa <fsring_post+0x69>
+
+00801a20 <fsipcv>:
+{
+  801a20:	55                   	push   %ebp
+  801a21:	89 e5                	mov    %esp,%ebp
+  801a23:	57                   	push   %edi
+  801a24:	56                   	push   %esi
+  801a25:	53                   	push   %ebx
+  801a26:	83 ec 0c             	sub    $0xc,%esp
+  801a29:	89 c7                	mov    %eax,%edi
+  801a2b:	89 d3                	mov    %edx,%ebx
+  801a2d:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801a2f:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801a36:	74 26                	je     801a5e <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a38:	6a 07                	push   $0x7
+  801a3a:	68 00 60 80 00       	push   $0x806000
+  801a3f:	57                   	push   %edi
+  801a40:	ff 35 c8 70 80 00    	push   0x8070c8
+  801a46:	e8 77 19 00 00       	call   8033c2 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801a4b:	6a 00                	push   $0x0
+  801a4d:	56                   	push   %esi
+  801a4e:	53                   	push   %ebx
+  801a4f:	6a 00                	push   $0x0
+  801a51:	e8 c4 19 00 00       	call   80341a <ipc_recvv>
+}
+  801a56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a59:	5b                   	pop    %ebx
+  801a5a:	5e                   	pop    %esi
+  801a5b:	5f                   	pop    %edi
+  801a5c:	5d                   	pop    %ebp
+  801a5d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a5e:	83 ec 0c             	sub    $0xc,%esp
+  801a61:	6a 01                	push   $0x1
+  801a63:	e8 93 1a 00 00       	call   8034fb <ipc_find_env>
+  801a68:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801a6d:	83 c4 10             	add    $0x10,%esp
+  801a70:	eb c6                	jmp    801a38 <fsipcv+0x18>
+
+00801a72 <fsipc>:
+{
+  801a72:	55                   	push   %ebp
+  801a73:	89 e5                	mov    %esp,%ebp
+  801a75:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801a78:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801a7f:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801a82:	e8 99 ff ff ff       	call   801a20 <fsipcv>
+}
+  801a87:	c9                   	leave
+  801a88:	c3                   	ret
+
+00801a89 <file_write_direct>:
+{
+  801a89:	55                   	push   %ebp
+  801a8a:	89 e5                	mov    %esp,%ebp
+  801a8c:	56                   	push   %esi
+  801a8d:	53                   	push   %ebx
+  801a8e:	89 c3                	mov    %eax,%ebx
+  801a90:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801a92:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801a98:	77 40                	ja     801ada <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a9a:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801a9f:	39 c8                	cmp    %ecx,%eax
+  801aa1:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801aa4:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801aa7:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  801aad:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801ab2:	83 ec 04             	sub    $0x4,%esp
+  801ab5:	50                   	push   %eax
+  801ab6:	52                   	push   %edx
+  801ab7:	68 08 60 80 00       	push   $0x806008
+  801abc:	e8 60 ee ff ff       	call   800921 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801ac1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac6:	b8 04 00 00 00       	mov    $0x4,%eax
+  801acb:	e8 a2 ff ff ff       	call   801a72 <fsipc>
+  801ad0:	83 c4 10             	add    $0x10,%esp
+}
+  801ad3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ad6:	5b                   	pop    %ebx
+  801ad7:	5e                   	pop    %esi
+  801ad8:	5d                   	pop    %ebp
+  801ad9:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801ada:	89 d6                	mov    %edx,%esi
+  801adc:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801ae2:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801ae7:	29 f1                	sub    %esi,%ecx
+  801ae9:	39 c1                	cmp    %eax,%ecx
+  801aeb:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801aee:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801af1:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801af6:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801afc:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801b02:	83 ec 0c             	sub    $0xc,%esp
+  801b05:	6a 05                	push   $0x5
+  801b07:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801b0c:	e8 bf fd ff ff       	call   8018d0 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801b11:	83 c4 10             	add    $0x10,%esp
+  801b14:	eb bd                	jmp    801ad3 <file_write_direct+0x4a>
+
+00801b16 <devfile_sync>:
+{
+  801b16:	55                   	push   %ebp
+  801b17:	89 e5                	mov    %esp,%ebp
+  801b19:	57                   	push   %edi
+  801b1a:	56                   	push   %esi
+  801b1b:	53                   	push   %ebx
+  801b1c:	83 ec 28             	sub    $0x28,%esp
+  801b1f:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801b22:	56                   	push   %esi
+  801b23:	e8 a5 f7 ff ff       	call   8012cd <fd2data>
+  801b28:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801b2a:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801b2d:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801b34:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801b37:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801b3c:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801b40:	74 45                	je     801b87 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801b42:	8b 46 14             	mov    0x14(%esi),%eax
+  801b45:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801b48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b52:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801b55:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801b58:	39 cb                	cmp    %ecx,%ebx
+  801b5a:	73 14                	jae    801b70 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801b5c:	29 d9                	sub    %ebx,%ecx
+  801b5e:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801b61:	89 f0                	mov    %esi,%eax
+  801b63:	e8 21 ff ff ff       	call   801a89 <file_write_direct>
+  801b68:	85 c0                	test   %eax,%eax
+  801b6a:	7e 04                	jle    801b70 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801b6c:	01 c3                	add    %eax,%ebx
+  801b6e:	eb e5                	jmp    801b55 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801b70:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801b73:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801b7a:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801b7d:	85 c0                	test   %eax,%eax
+  801b7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b84:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801b87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b8a:	5b                   	pop    %ebx
+  801b8b:	5e                   	pop    %esi
+  801b8c:	5f                   	pop    %edi
+  801b8d:	5d                   	pop    %ebp
+  801b8e:	c3                   	ret
+
+00801b8f <devfile_write>:
+{
+  801b8f:	55                   	push   %ebp
+  801b90:	89 e5                	mov    %esp,%ebp
+  801b92:	57                   	push   %edi
+  801b93:	56                   	push   %esi
+  801b94:	53                   	push   %ebx
+  801b95:	83 ec 28             	sub    $0x28,%esp
+  801b98:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801b9b:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801b9e:	53                   	push   %ebx
+  801b9f:	e8 29 f7 ff ff       	call   8012cd <fd2data>
+  801ba4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801ba7:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801baa:	83 c4 10             	add    $0x10,%esp
+  801bad:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801bb1:	74 43                	je     801bf6 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801bb3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801bba:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801bbd:	85 c0                	test   %eax,%eax
+  801bbf:	74 43                	je     801c04 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801bc1:	89 c2                	mov    %eax,%edx
+  801bc3:	03 53 14             	add    0x14(%ebx),%edx
+  801bc6:	39 fa                	cmp    %edi,%edx
+  801bc8:	75 0b                	jne    801bd5 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801bca:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801bcd:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801bd3:	76 66                	jbe    801c3b <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801bd5:	83 ec 0c             	sub    $0xc,%esp
+  801bd8:	53                   	push   %ebx
+  801bd9:	e8 38 ff ff ff       	call   801b16 <devfile_sync>
+  801bde:	83 c4 10             	add    $0x10,%esp
+  801be1:	85 c0                	test   %eax,%eax
+  801be3:	78 4e                	js     801c33 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801be5:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801beb:	77 56                	ja     801c43 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801bed:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801bf0:	85 c0                	test   %eax,%eax
+  801bf2:	75 20                	jne    801c14 <devfile_write+0x85>
+  801bf4:	eb 16                	jmp    801c0c <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801bf6:	89 f1                	mov    %esi,%ecx
+  801bf8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bfb:	89 d8                	mov    %ebx,%eax
+  801bfd:	e8 87 fe ff ff       	call   801a89 <file_write_direct>
+  801c02:	eb 2f                	jmp    801c33 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801c04:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801c0a:	77 37                	ja     801c43 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801c0c:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801c14:	83 ec 04             	sub    $0x4,%esp
+  801c17:	56                   	push   %esi
+  801c18:	ff 75 0c             	push   0xc(%ebp)
+  801c1b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801c1e:	01 c1                	add    %eax,%ecx
+  801c20:	51                   	push   %ecx
+  801c21:	e8 fb ec ff ff       	call   800921 <memmove>
+	ff->buf_wlen += n;
+  801c26:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801c29:	01 f7                	add    %esi,%edi
+  801c2b:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801c2e:	89 f0                	mov    %esi,%eax
+  801c30:	83 c4 10             	add    $0x10,%esp
+}
+  801c33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c36:	5b                   	pop    %ebx
+  801c37:	5e                   	pop    %esi
+  801c38:	5f                   	pop    %edi
+  801c39:	5d                   	pop    %ebp
+  801c3a:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801c3b:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801c41:	76 d1                	jbe    801c14 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801c43:	89 f1                	mov    %esi,%ecx
+  801c45:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c48:	89 d8                	mov    %ebx,%eax
+  801c4a:	e8 3a fe ff ff       	call   801a89 <file_write_direct>
+  801c4f:	eb e2                	jmp    801c33 <devfile_write+0xa4>
+
+00801c51 <devfile_trunc>:
+{
+  801c51:	55                   	push   %ebp
+  801c52:	89 e5                	mov    %esp,%ebp
+  801c54:	53                   	push   %ebx
+  801c55:	83 ec 10             	sub    $0x10,%esp
+  801c58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801c5b:	53                   	push   %ebx
+  801c5c:	e8 b5 fe ff ff       	call   801b16 <devfile_sync>
+  801c61:	83 c4 10             	add    $0x10,%esp
+  801c64:	85 c0                	test   %eax,%eax
+  801c66:	78 1f                	js     801c87 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801c68:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c6b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801c70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c73:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801c78:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c82:	e8 eb fd ff ff       	call   801a72 <fsipc>
+}
+  801c87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c8a:	c9                   	leave
+  801c8b:	c3                   	ret
+
+00801c8c <devfile_stat>:
+{
+  801c8c:	55                   	push   %ebp
+  801c8d:	89 e5                	mov    %esp,%ebp
+  801c8f:	56                   	push   %esi
+  801c90:	53                   	push   %ebx
+  801c91:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c94:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801c97:	83 ec 0c             	sub    $0xc,%esp
+  801c9a:	53                   	push   %ebx
+  801c9b:	e8 76 fe ff ff       	call   801b16 <devfile_sync>
+  801ca0:	83 c4 10             	add    $0x10,%esp
+  801ca3:	85 c0                	test   %eax,%eax
+  801ca5:	78 47                	js     801cee <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ca7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801caa:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801caf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cb4:	b8 05 00 00 00       	mov    $0x5,%eax
+  801cb9:	e8 b4 fd ff ff       	call   801a72 <fsipc>
+  801cbe:	85 c0                	test   %eax,%eax
+  801cc0:	78 2c                	js     801cee <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801cc2:	83 ec 08             	sub    $0x8,%esp
+  801cc5:	68 00 60 80 00       	push   $0x806000
+  801cca:	56                   	push   %esi
+  801ccb:	e8 cb ea ff ff       	call   80079b <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801cd0:	a1 80 60 80 00       	mov    0x806080,%eax
+  801cd5:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801cdb:	a1 84 60 80 00       	mov    0x806084,%eax
+  801ce0:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801ce6:	83 c4 10             	add    $0x10,%esp
+  801ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf1:	5b                   	pop    %ebx
+  801cf2:	5e                   	pop    %esi
+  801cf3:	5d                   	pop    %ebp
+  801cf4:	c3                   	ret
+
+00801cf5 <devfile_flush>:
+{
+  801cf5:	55                   	push   %ebp
+  801cf6:	89 e5                	mov    %esp,%ebp
+  801cf8:	56                   	push   %esi
+  801cf9:	53                   	push   %ebx
+  801cfa:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801cfd:	83 ec 0c             	sub    $0xc,%esp
+  801d00:	56                   	push   %esi
+  801d01:	e8 10 fe ff ff       	call   801b16 <devfile_sync>
+  801d06:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801d08:	83 c4 10             	add    $0x10,%esp
+  801d0b:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801d0f:	75 25                	jne    801d36 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d11:	8b 46 0c             	mov    0xc(%esi),%eax
+  801d14:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801d19:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d23:	e8 4a fd ff ff       	call   801a72 <fsipc>
+  801d28:	85 c0                	test   %eax,%eax
+  801d2a:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801d2d:	89 d8                	mov    %ebx,%eax
+  801d2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d32:	5b                   	pop    %ebx
+  801d33:	5e                   	pop    %esi
+  801d34:	5d                   	pop    %ebp
+  801d35:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801d36:	83 ec 0c             	sub    $0xc,%esp
+  801d39:	56                   	push   %esi
+  801d3a:	e8 8e f5 ff ff       	call   8012cd <fd2data>
+  801d3f:	83 c4 08             	add    $0x8,%esp
+  801d42:	50                   	push   %eax
+  801d43:	6a 00                	push   $0x0
+  801d45:	e8 ea ee ff ff       	call   800c34 <sys_page_unmap>
+  801d4a:	83 c4 10             	add    $0x10,%esp
+  801d4d:	eb c2                	jmp    801d11 <devfile_flush+0x1c>
+
+00801d4f <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801d4f:	55                   	push   %ebp
+  801d50:	89 e5                	mov    %esp,%ebp
+  801d52:	57                   	push   %edi
+  801d53:	56                   	push   %esi
+  801d54:	53                   	push   %ebx
+  801d55:	83 ec 64             	sub    $0x64,%esp
+  801d58:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801d5a:	52                   	push   %edx
+  801d5b:	50                   	push   %eax
+  801d5c:	e8 d9 f5 ff ff       	call   80133a <fd_lookup>
+  801d61:	89 c1                	mov    %eax,%ecx
+  801d63:	83 c4 10             	add    $0x10,%esp
+  801d66:	85 c0                	test   %eax,%eax
+  801d68:	0f 88 f2 00 00 00    	js     801e60 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801d6e:	8b 07                	mov    (%edi),%eax
+  801d70:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801d76:	39 10                	cmp    %edx,(%eax)
+  801d78:	0f 85 03 01 00 00    	jne    801e81 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801d7e:	a1 00 50 80 00       	mov    0x805000,%eax
+  801d83:	8b 40 48             	mov    0x48(%eax),%eax
+  801d86:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801d8c:	0f 84 96 00 00 00    	je     801e28 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801d92:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801d99:	0f 84 cb 00 00 00    	je     801e6a <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801d9f:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801da4:	83 c8 07             	or     $0x7,%eax
+  801da7:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801daa:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801dad:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801db2:	83 ec 04             	sub    $0x4,%esp
+  801db5:	68 07 04 00 00       	push   $0x407
+  801dba:	53                   	push   %ebx
+  801dbb:	6a 00                	push   $0x0
+  801dbd:	e8 e5 ed ff ff       	call   800ba7 <sys_page_alloc>
+  801dc2:	89 c1                	mov    %eax,%ecx
+  801dc4:	83 c4 10             	add    $0x10,%esp
+  801dc7:	85 c0                	test   %eax,%eax
+  801dc9:	0f 88 91 00 00 00    	js     801e60 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801dcf:	89 d8                	mov    %ebx,%eax
+  801dd1:	83 c8 07             	or     $0x7,%eax
+  801dd4:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801dd6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ddc:	83 c6 04             	add    $0x4,%esi
+  801ddf:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801de5:	75 cb                	jne    801db2 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801de7:	6a 12                	push   $0x12
+  801de9:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801dec:	50                   	push   %eax
+  801ded:	6a 0c                	push   $0xc
+  801def:	ff 35 c8 70 80 00    	push   0x8070c8
+  801df5:	e8 b3 16 00 00       	call   8034ad <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801dfa:	83 c4 0c             	add    $0xc,%esp
+  801dfd:	6a 00                	push   $0x0
+  801dff:	6a 00                	push   $0x0
+  801e01:	6a 00                	push   $0x0
+  801e03:	e8 4f 15 00 00       	call   803357 <ipc_recv>
+  801e08:	89 c1                	mov    %eax,%ecx
+  801e0a:	83 c4 10             	add    $0x10,%esp
+  801e0d:	85 c0                	test   %eax,%eax
+  801e0f:	78 4f                	js     801e60 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801e11:	a1 00 50 80 00       	mov    0x805000,%eax
+  801e16:	8b 40 48             	mov    0x48(%eax),%eax
+  801e19:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801e1e:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801e25:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801e28:	83 ec 0c             	sub    $0xc,%esp
+  801e2b:	ff 37                	push   (%edi)
+  801e2d:	e8 e4 fc ff ff       	call   801b16 <devfile_sync>
+  801e32:	89 c1                	mov    %eax,%ecx
+  801e34:	83 c4 10             	add    $0x10,%esp
+  801e37:	85 c0                	test   %eax,%eax
+  801e39:	78 25                	js     801e60 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801e3b:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801e41:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801e46:	ba 01 00 00 00       	mov    $0x1,%edx
+  801e4b:	89 d0                	mov    %edx,%eax
+  801e4d:	d3 e0                	shl    %cl,%eax
+  801e4f:	85 d8                	test   %ebx,%eax
+  801e51:	74 0d                	je     801e60 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801e53:	83 c1 01             	add    $0x1,%ecx
+  801e56:	83 f9 10             	cmp    $0x10,%ecx
+  801e59:	75 f0                	jne    801e4b <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801e5b:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801e60:	89 c8                	mov    %ecx,%eax
+  801e62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e65:	5b                   	pop    %ebx
+  801e66:	5e                   	pop    %esi
+  801e67:	5f                   	pop    %edi
+  801e68:	5d                   	pop    %ebp
+  801e69:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e6a:	83 ec 0c             	sub    $0xc,%esp
+  801e6d:	6a 01                	push   $0x1
+  801e6f:	e8 87 16 00 00       	call   8034fb <ipc_find_env>
+  801e74:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801e79:	83 c4 10             	add    $0x10,%esp
+  801e7c:	e9 1e ff ff ff       	jmp    801d9f <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801e81:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801e86:	eb d8                	jmp    801e60 <fsring_slot+0x111>
+
+00801e88 <file_read_direct>:
+{
+  801e88:	55                   	push   %ebp
+  801e89:	89 e5                	mov    %esp,%ebp
+  801e8b:	57                   	push   %edi
+  801e8c:	56                   	push   %esi
+  801e8d:	53                   	push   %ebx
+  801e8e:	83 ec 1c             	sub    $0x1c,%esp
+  801e91:	89 c7                	mov    %eax,%edi
+  801e93:	89 d6                	mov    %edx,%esi
+  801e95:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801e97:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801e9d:	77 52                	ja     801ef1 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801e9f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ea2:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801ea7:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ead:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb2:	b8 03 00 00 00       	mov    $0x3,%eax
+  801eb7:	e8 b6 fb ff ff       	call   801a72 <fsipc>
+  801ebc:	89 c7                	mov    %eax,%edi
+  801ebe:	85 c0                	test   %eax,%eax
+  801ec0:	78 25                	js     801ee7 <file_read_direct+0x5f>
+	assert(r <= n);
+  801ec2:	39 c3                	cmp    %eax,%ebx
+  801ec4:	0f 82 87 00 00 00    	jb     801f51 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801eca:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ecf:	0f 8f 95 00 00 00    	jg     801f6a <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801ed5:	83 ec 04             	sub    $0x4,%esp
+  801ed8:	50                   	push   %eax
+  801ed9:	68 00 60 80 00       	push   $0x806000
+  801ede:	56                   	push   %esi
+  801edf:	e8 3d ea ff ff       	call   800921 <memmove>
+	return r;
+  801ee4:	83 c4 10             	add    $0x10,%esp
+}
+  801ee7:	89 f8                	mov    %edi,%eax
+  801ee9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eec:	5b                   	pop    %ebx
+  801eed:	5e                   	pop    %esi
+  801eee:	5f                   	pop    %edi
+  801eef:	5d                   	pop    %ebp
+  801ef0:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801ef1:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801ef7:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801efc:	29 d1                	sub    %edx,%ecx
+  801efe:	39 d9                	cmp    %ebx,%ecx
+  801f00:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801f03:	89 f0                	mov    %esi,%eax
+  801f05:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801f08:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801f0b:	eb 0f                	jmp    801f1c <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801f0d:	0f b6 10             	movzbl (%eax),%edx
+  801f10:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801f12:	05 00 10 00 00       	add    $0x1000,%eax
+  801f17:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f1c:	39 c8                	cmp    %ecx,%eax
+  801f1e:	72 ed                	jb     801f0d <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801f20:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f23:	8b 47 0c             	mov    0xc(%edi),%eax
+  801f26:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801f2b:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801f31:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801f37:	83 ec 0c             	sub    $0xc,%esp
+  801f3a:	6a 07                	push   $0x7
+  801f3c:	89 d9                	mov    %ebx,%ecx
+  801f3e:	89 f2                	mov    %esi,%edx
+  801f40:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f45:	e8 86 f9 ff ff       	call   8018d0 <fsipc_pages>
+  801f4a:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801f4c:	83 c4 10             	add    $0x10,%esp
+  801f4f:	eb 96                	jmp    801ee7 <file_read_direct+0x5f>
+	assert(r <= n);
+  801f51:	68 1b 3d 80 00       	push   $0x803d1b
+  801f56:	68 2c 3c 80 00       	push   $0x803c2c
+  801f5b:	68 dc 00 00 00       	push   $0xdc
+  801f60:	68 10 3d 80 00       	push   $0x803d10
+  801f65:	e8 0e 13 00 00       	call   803278 <_panic>
+	assert(r <= PGSIZE);
+  801f6a:	68 2c 3d 80 00       	push   $0x803d2c
+  801f6f:	68 2c 3c 80 00       	push   $0x803c2c
+  801f74:	68 dd 00 00 00       	push   $0xdd
+  801f79:	68 10 3d 80 00       	push   $0x803d10
+  801f7e:	e8 f5 12 00 00       	call   803278 <_panic>
+
+00801f83 <devfile_read>:
+{
+  801f83:	55                   	push   %ebp
+  801f84:	89 e5                	mov    %esp,%ebp
+  801f86:	57                   	push   %edi
+  801f87:	56                   	push   %esi
+  801f88:	53                   	push   %ebx
+  801f89:	83 ec 28             	sub    $0x28,%esp
+  801f8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f8f:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801f92:	53                   	push   %ebx
+  801f93:	e8 35 f3 ff ff       	call   8012cd <fd2data>
+  801f98:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801f9b:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801f9e:	83 c4 10             	add    $0x10,%esp
+  801fa1:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801fa5:	74 7d                	je     802024 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801fa7:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801fab:	0f 85 81 00 00 00    	jne    802032 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801fb1:	8b 43 18             	mov    0x18(%ebx),%eax
+  801fb4:	85 c0                	test   %eax,%eax
+  801fb6:	74 0d                	je     801fc5 <devfile_read+0x42>
+  801fb8:	8b 53 14             	mov    0x14(%ebx),%edx
+  801fbb:	39 fa                	cmp    %edi,%edx
+  801fbd:	7f 06                	jg     801fc5 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801fbf:	01 c2                	add    %eax,%edx
+  801fc1:	39 d7                	cmp    %edx,%edi
+  801fc3:	72 28                	jb     801fed <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801fc5:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801fcc:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801fd2:	77 74                	ja     802048 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801fd4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801fd9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fdc:	89 d8                	mov    %ebx,%eax
+  801fde:	e8 a5 fe ff ff       	call   801e88 <file_read_direct>
+  801fe3:	85 c0                	test   %eax,%eax
+  801fe5:	7e 35                	jle    80201c <devfile_read+0x99>
+		ff->buf_base = pos;
+  801fe7:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801fea:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801fed:	8b 53 14             	mov    0x14(%ebx),%edx
+  801ff0:	89 d0                	mov    %edx,%eax
+  801ff2:	03 43 18             	add    0x18(%ebx),%eax
+  801ff5:	29 f8                	sub    %edi,%eax
+  801ff7:	39 f0                	cmp    %esi,%eax
+  801ff9:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801ffc:	83 ec 04             	sub    $0x4,%esp
+  801fff:	56                   	push   %esi
+  802000:	89 f8                	mov    %edi,%eax
+  802002:	29 d0                	sub    %edx,%eax
+  802004:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802007:	01 c1                	add    %eax,%ecx
+  802009:	51                   	push   %ecx
+  80200a:	ff 75 0c             	push   0xc(%ebp)
+  80200d:	e8 0f e9 ff ff       	call   800921 <memmove>
+	fd->fd_offset = pos + n;
+  802012:	01 f7                	add    %esi,%edi
+  802014:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802017:	89 f0                	mov    %esi,%eax
+  802019:	83 c4 10             	add    $0x10,%esp
+}
+  80201c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80201f:	5b                   	pop    %ebx
+  802020:	5e                   	pop    %esi
+  802021:	5f                   	pop    %edi
+  802022:	5d                   	pop    %ebp
+  802023:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802024:	89 f1                	mov    %esi,%ecx
+  802026:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802029:	89 d8                	mov    %ebx,%eax
+  80202b:	e8 58 fe ff ff       	call   801e88 <file_read_direct>
+  802030:	eb ea                	jmp    80201c <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802032:	83 ec 0c             	sub    $0xc,%esp
+  802035:	53                   	push   %ebx
+  802036:	e8 db fa ff ff       	call   801b16 <devfile_sync>
+  80203b:	83 c4 10             	add    $0x10,%esp
+  80203e:	85 c0                	test   %eax,%eax
+  802040:	0f 89 6b ff ff ff    	jns    801fb1 <devfile_read+0x2e>
+  802046:	eb d4                	jmp    80201c <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  802048:	89 f1                	mov    %esi,%ecx
+  80204a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80204d:	89 d8                	mov    %ebx,%eax
+  80204f:	e8 34 fe ff ff       	call   801e88 <file_read_direct>
+  802054:	eb c6                	jmp    80201c <devfile_read+0x99>
+
+00802056 <open>:
+{
+  802056:	55                   	push   %ebp
+  802057:	89 e5                	mov    %esp,%ebp
+  802059:	56                   	push   %esi
+  80205a:	53                   	push   %ebx
+  80205b:	83 ec 1c             	sub    $0x1c,%esp
+  80205e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802061:	56                   	push   %esi
+  802062:	e8 f9 e6 ff ff       	call   800760 <strlen>
+  802067:	83 c4 10             	add    $0x10,%esp
+  80206a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80206f:	0f 8f a0 00 00 00    	jg     802115 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  802075:	83 ec 0c             	sub    $0xc,%esp
+  802078:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80207b:	50                   	push   %eax
+  80207c:	e8 63 f2 ff ff       	call   8012e4 <fd_alloc>
+  802081:	89 c3                	mov    %eax,%ebx
+  802083:	83 c4 10             	add    $0x10,%esp
+  802086:	85 c0                	test   %eax,%eax
+  802088:	78 45                	js     8020cf <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  80208a:	83 ec 08             	sub    $0x8,%esp
+  80208d:	56                   	push   %esi
+  80208e:	68 00 60 80 00       	push   $0x806000
+  802093:	e8 03 e7 ff ff       	call   80079b <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802098:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80209b:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020a8:	e8 c5 f9 ff ff       	call   801a72 <fsipc>
+  8020ad:	89 c3                	mov    %eax,%ebx
+  8020af:	83 c4 10             	add    $0x10,%esp
+  8020b2:	85 c0                	test   %eax,%eax
+  8020b4:	78 22                	js     8020d8 <open+0x82>
+	if (!(mode & O_NOBUF)
+  8020b6:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8020bd:	74 2b                	je     8020ea <open+0x94>
+	return fd2num(fd);
+  8020bf:	83 ec 0c             	sub    $0xc,%esp
+  8020c2:	ff 75 f4             	push   -0xc(%ebp)
+  8020c5:	e8 f3 f1 ff ff       	call   8012bd <fd2num>
+  8020ca:	89 c3                	mov    %eax,%ebx
+  8020cc:	83 c4 10             	add    $0x10,%esp
+}
+  8020cf:	89 d8                	mov    %ebx,%eax
+  8020d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020d4:	5b                   	pop    %ebx
+  8020d5:	5e                   	pop    %esi
+  8020d6:	5d                   	pop    %ebp
+  8020d7:	c3                   	ret
+		fd_close(fd, 0);
+  8020d8:	83 ec 08             	sub    $0x8,%esp
+  8020db:	6a 00                	push   $0x0
+  8020dd:	ff 75 f4             	push   -0xc(%ebp)
+  8020e0:	e8 f8 f2 ff ff       	call   8013dd <fd_close>
+		return r;
+  8020e5:	83 c4 10             	add    $0x10,%esp
+  8020e8:	eb e5                	jmp    8020cf <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8020ea:	83 ec 0c             	sub    $0xc,%esp
+  8020ed:	ff 75 f4             	push   -0xc(%ebp)
+  8020f0:	e8 d8 f1 ff ff       	call   8012cd <fd2data>
+  8020f5:	83 c4 0c             	add    $0xc,%esp
+  8020f8:	68 07 04 00 00       	push   $0x407
+  8020fd:	50                   	push   %eax
+  8020fe:	6a 00                	push   $0x0
+  802100:	e8 a2 ea ff ff       	call   800ba7 <sys_page_alloc>
+  802105:	83 c4 10             	add    $0x10,%esp
+  802108:	85 c0                	test   %eax,%eax
+  80210a:	75 b3                	jne    8020bf <open+0x69>
+		fd->fd_file.buffered = 1;
+  80210c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80210f:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802113:	eb aa                	jmp    8020bf <open+0x69>
+		return -E_BAD_PATH;
+  802115:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80211a:	eb b3                	jmp    8020cf <open+0x79>
+
+0080211c <readdir>:
+{
+  80211c:	55                   	push   %ebp
+  80211d:	89 e5                	mov    %esp,%ebp
+  80211f:	53                   	push   %ebx
+  802120:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802123:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802126:	50                   	push   %eax
+  802127:	ff 75 08             	push   0x8(%ebp)
+  80212a:	e8 0b f2 ff ff       	call   80133a <fd_lookup>
+  80212f:	89 c3                	mov    %eax,%ebx
+  802131:	83 c4 10             	add    $0x10,%esp
+  802134:	85 c0                	test   %eax,%eax
+  802136:	78 73                	js     8021ab <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802138:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80213b:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802141:	39 08                	cmp    %ecx,(%eax)
+  802143:	0f 85 82 00 00 00    	jne    8021cb <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802149:	83 ec 0c             	sub    $0xc,%esp
+  80214c:	50                   	push   %eax
+  80214d:	e8 c4 f9 ff ff       	call   801b16 <devfile_sync>
+  802152:	89 c3                	mov    %eax,%ebx
+  802154:	83 c4 10             	add    $0x10,%esp
+  802157:	85 c0                	test   %eax,%eax
+  802159:	78 50                	js     8021ab <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  80215b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80215e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802161:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  802166:	8b 45 10             	mov    0x10(%ebp),%eax
+  802169:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  80216e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802171:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  802176:	ba 00 00 00 00       	mov    $0x0,%edx
+  80217b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802180:	e8 ed f8 ff ff       	call   801a72 <fsipc>
+  802185:	89 c3                	mov    %eax,%ebx
+  802187:	85 c0                	test   %eax,%eax
+  802189:	7e 20                	jle    8021ab <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  80218b:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80218e:	72 22                	jb     8021b2 <readdir+0x96>
+  802190:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802195:	7f 1b                	jg     8021b2 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802197:	83 ec 04             	sub    $0x4,%esp
+  80219a:	50                   	push   %eax
+  80219b:	68 00 60 80 00       	push   $0x806000
+  8021a0:	ff 75 0c             	push   0xc(%ebp)
+  8021a3:	e8 79 e7 ff ff       	call   800921 <memmove>
+	return r;
+  8021a8:	83 c4 10             	add    $0x10,%esp
+}
+  8021ab:	89 d8                	mov    %ebx,%eax
+  8021ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021b0:	c9                   	leave
+  8021b1:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8021b2:	68 22 3d 80 00       	push   $0x803d22
+  8021b7:	68 2c 3c 80 00       	push   $0x803c2c
+  8021bc:	68 86 01 00 00       	push   $0x186
+  8021c1:	68 10 3d 80 00       	push   $0x803d10
+  8021c6:	e8 ad 10 00 00       	call   803278 <_panic>
+		return -E_NOT_SUPP;
+  8021cb:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8021d0:	eb d9                	jmp    8021ab <readdir+0x8f>
+
+008021d2 <munmap>:
+{
+  8021d2:	55                   	push   %ebp
+  8021d3:	89 e5                	mov    %esp,%ebp
+  8021d5:	56                   	push   %esi
+  8021d6:	53                   	push   %ebx
+  8021d7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021da:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8021dd:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8021e3:	75 41                	jne    802226 <munmap+0x54>
+  8021e5:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8021eb:	77 39                	ja     802226 <munmap+0x54>
+  8021ed:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021f2:	29 f0                	sub    %esi,%eax
+  8021f4:	39 d0                	cmp    %edx,%eax
+  8021f6:	72 35                	jb     80222d <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8021f8:	89 f3                	mov    %esi,%ebx
+  8021fa:	01 d6                	add    %edx,%esi
+  8021fc:	39 f3                	cmp    %esi,%ebx
+  8021fe:	73 1a                	jae    80221a <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802200:	83 ec 08             	sub    $0x8,%esp
+  802203:	53                   	push   %ebx
+  802204:	6a 00                	push   $0x0
+  802206:	e8 29 ea ff ff       	call   800c34 <sys_page_unmap>
+  80220b:	83 c4 10             	add    $0x10,%esp
+  80220e:	85 c0                	test   %eax,%eax
+  802210:	78 0d                	js     80221f <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802212:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802218:	eb e2                	jmp    8021fc <munmap+0x2a>
+	return 0;
+  80221a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80221f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802222:	5b                   	pop    %ebx
+  802223:	5e                   	pop    %esi
+  802224:	5d                   	pop    %ebp
+  802225:	c3                   	ret
+		return -E_INVAL;
+  802226:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80222b:	eb f2                	jmp    80221f <munmap+0x4d>
+  80222d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802232:	eb eb                	jmp    80221f <munmap+0x4d>
+
+00802234 <mmap>:
+{
+  802234:	55                   	push   %ebp
+  802235:	89 e5                	mov    %esp,%ebp
+  802237:	57                   	push   %edi
+  802238:	56                   	push   %esi
+  802239:	53                   	push   %ebx
+  80223a:	83 ec 34             	sub    $0x34,%esp
+  80223d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802240:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802243:	50                   	push   %eax
+  802244:	ff 75 18             	push   0x18(%ebp)
+  802247:	e8 ee f0 ff ff       	call   80133a <fd_lookup>
+  80224c:	89 c3                	mov    %eax,%ebx
+  80224e:	83 c4 10             	add    $0x10,%esp
+  802251:	85 c0                	test   %eax,%eax
+  802253:	0f 88 0e 01 00 00    	js     802367 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802259:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80225c:	a1 20 40 80 00       	mov    0x804020,%eax
+  802261:	39 02                	cmp    %eax,(%edx)
+  802263:	0f 85 50 01 00 00    	jne    8023b9 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802269:	8b 45 10             	mov    0x10(%ebp),%eax
+  80226c:	83 e0 02             	and    $0x2,%eax
+  80226f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802272:	74 0a                	je     80227e <mmap+0x4a>
+  802274:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802278:	0f 84 42 01 00 00    	je     8023c0 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  80227e:	8b 42 08             	mov    0x8(%edx),%eax
+  802281:	83 e0 03             	and    $0x3,%eax
+  802284:	83 f8 01             	cmp    $0x1,%eax
+  802287:	0f 84 3a 01 00 00    	je     8023c7 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  80228d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802290:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802293:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802298:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80229b:	0f 85 2d 01 00 00    	jne    8023ce <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8022a1:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8022a5:	0f 88 2a 01 00 00    	js     8023d5 <mmap+0x1a1>
+  8022ab:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8022b2:	0f 87 1d 01 00 00    	ja     8023d5 <mmap+0x1a1>
+  8022b8:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8022bd:	2b 45 08             	sub    0x8(%ebp),%eax
+  8022c0:	39 f8                	cmp    %edi,%eax
+  8022c2:	0f 82 14 01 00 00    	jb     8023dc <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8022c8:	83 ec 0c             	sub    $0xc,%esp
+  8022cb:	52                   	push   %edx
+  8022cc:	e8 45 f8 ff ff       	call   801b16 <devfile_sync>
+  8022d1:	89 c3                	mov    %eax,%ebx
+  8022d3:	83 c4 10             	add    $0x10,%esp
+  8022d6:	85 c0                	test   %eax,%eax
+  8022d8:	0f 88 89 00 00 00    	js     802367 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8022de:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8022e4:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8022ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ef:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8022f2:	39 fe                	cmp    %edi,%esi
+  8022f4:	73 7b                	jae    802371 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8022f6:	89 f8                	mov    %edi,%eax
+  8022f8:	29 f0                	sub    %esi,%eax
+  8022fa:	c1 e8 0c             	shr    $0xc,%eax
+  8022fd:	ba 40 00 00 00       	mov    $0x40,%edx
+  802302:	39 d0                	cmp    %edx,%eax
+  802304:	0f 47 c2             	cmova  %edx,%eax
+  802307:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80230a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80230d:	8b 52 0c             	mov    0xc(%edx),%edx
+  802310:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  802316:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802319:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  80231f:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802324:	89 f2                	mov    %esi,%edx
+  802326:	03 55 08             	add    0x8(%ebp),%edx
+  802329:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80232c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802331:	e8 ea f6 ff ff       	call   801a20 <fsipcv>
+  802336:	85 c0                	test   %eax,%eax
+  802338:	7e 12                	jle    80234c <mmap+0x118>
+  80233a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80233d:	85 c0                	test   %eax,%eax
+  80233f:	0f 84 9e 00 00 00    	je     8023e3 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802345:	c1 e0 0c             	shl    $0xc,%eax
+  802348:	01 c6                	add    %eax,%esi
+  80234a:	eb a6                	jmp    8022f2 <mmap+0xbe>
+			munmap(addr, done);
+  80234c:	89 c3                	mov    %eax,%ebx
+  80234e:	83 ec 08             	sub    $0x8,%esp
+  802351:	56                   	push   %esi
+  802352:	ff 75 08             	push   0x8(%ebp)
+  802355:	e8 78 fe ff ff       	call   8021d2 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80235a:	83 c4 10             	add    $0x10,%esp
+  80235d:	85 db                	test   %ebx,%ebx
+  80235f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802364:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802367:	89 d8                	mov    %ebx,%eax
+  802369:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80236c:	5b                   	pop    %ebx
+  80236d:	5e                   	pop    %esi
+  80236e:	5f                   	pop    %edi
+  80236f:	5d                   	pop    %ebp
+  802370:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802371:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802374:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802376:	85 c0                	test   %eax,%eax
+  802378:	74 ed                	je     802367 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80237a:	be 00 00 00 00       	mov    $0x0,%esi
+  80237f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802382:	39 fe                	cmp    %edi,%esi
+  802384:	73 2e                	jae    8023b4 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802386:	83 ec 0c             	sub    $0xc,%esp
+  802389:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  80238c:	50                   	push   %eax
+  80238d:	e8 2d ed ff ff       	call   8010bf <cowpage>
+  802392:	83 c4 10             	add    $0x10,%esp
+  802395:	85 c0                	test   %eax,%eax
+  802397:	78 08                	js     8023a1 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802399:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80239f:	eb e1                	jmp    802382 <mmap+0x14e>
+				munmap(addr, len);
+  8023a1:	89 c3                	mov    %eax,%ebx
+  8023a3:	83 ec 08             	sub    $0x8,%esp
+  8023a6:	57                   	push   %edi
+  8023a7:	ff 75 08             	push   0x8(%ebp)
+  8023aa:	e8 23 fe ff ff       	call   8021d2 <munmap>
+				return r;
+  8023af:	83 c4 10             	add    $0x10,%esp
+  8023b2:	eb b3                	jmp    802367 <mmap+0x133>
+	return 0;
+  8023b4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8023b7:	eb ae                	jmp    802367 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8023b9:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8023be:	eb a7                	jmp    802367 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8023c0:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8023c5:	eb a0                	jmp    802367 <mmap+0x133>
+		return -E_INVAL;
+  8023c7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023cc:	eb 99                	jmp    802367 <mmap+0x133>
+  8023ce:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023d3:	eb 92                	jmp    802367 <mmap+0x133>
+  8023d5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023da:	eb 8b                	jmp    802367 <mmap+0x133>
+  8023dc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023e1:	eb 84                	jmp    802367 <mmap+0x133>
+			munmap(addr, done);
+  8023e3:	83 ec 08             	sub    $0x8,%esp
+  8023e6:	56                   	push   %esi
+  8023e7:	ff 75 08             	push   0x8(%ebp)
+  8023ea:	e8 e3 fd ff ff       	call   8021d2 <munmap>
+  8023ef:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8023f2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023f7:	e9 6b ff ff ff       	jmp    802367 <mmap+0x133>
+
+008023fc <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8023fc:	55                   	push   %ebp
+  8023fd:	89 e5                	mov    %esp,%ebp
+  8023ff:	56                   	push   %esi
+  802400:	53                   	push   %ebx
+  802401:	83 ec 10             	sub    $0x10,%esp
+  802404:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802407:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80240a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80240d:	e8 3d f9 ff ff       	call   801d4f <fsring_slot>
+  802412:	85 c0                	test   %eax,%eax
+  802414:	78 60                	js     802476 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802416:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802419:	8b 56 08             	mov    0x8(%esi),%edx
+  80241c:	83 e2 03             	and    $0x3,%edx
+  80241f:	83 fa 01             	cmp    $0x1,%edx
+  802422:	74 59                	je     80247d <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802424:	ba 01 00 00 00       	mov    $0x1,%edx
+  802429:	89 c1                	mov    %eax,%ecx
+  80242b:	d3 e2                	shl    %cl,%edx
+  80242d:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802433:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802436:	c1 e2 02             	shl    $0x2,%edx
+  802439:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  80243f:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  802446:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802449:	8b 55 18             	mov    0x18(%ebp),%edx
+  80244c:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80244f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802452:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802455:	83 ec 08             	sub    $0x8,%esp
+  802458:	50                   	push   %eax
+  802459:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80245e:	39 c3                	cmp    %eax,%ebx
+  802460:	0f 47 d8             	cmova  %eax,%ebx
+  802463:	53                   	push   %ebx
+  802464:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802467:	89 f2                	mov    %esi,%edx
+  802469:	b8 03 00 00 00       	mov    $0x3,%eax
+  80246e:	e8 1e f5 ff ff       	call   801991 <fsring_post>
+  802473:	83 c4 10             	add    $0x10,%esp
+}
+  802476:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802479:	5b                   	pop    %ebx
+  80247a:	5e                   	pop    %esi
+  80247b:	5d                   	pop    %ebp
+  80247c:	c3                   	ret
+		return -E_INVAL;
+  80247d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802482:	eb f2                	jmp    802476 <fsring_read+0x7a>
+
+00802484 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802484:	55                   	push   %ebp
+  802485:	89 e5                	mov    %esp,%ebp
+  802487:	56                   	push   %esi
+  802488:	53                   	push   %ebx
+  802489:	83 ec 10             	sub    $0x10,%esp
+  80248c:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80248f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802492:	8b 45 08             	mov    0x8(%ebp),%eax
+  802495:	e8 b5 f8 ff ff       	call   801d4f <fsring_slot>
+  80249a:	89 c3                	mov    %eax,%ebx
+  80249c:	85 c0                	test   %eax,%eax
+  80249e:	78 77                	js     802517 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8024a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024a3:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8024a7:	74 77                	je     802520 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8024a9:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8024ae:	39 c6                	cmp    %eax,%esi
+  8024b0:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8024b3:	83 ec 04             	sub    $0x4,%esp
+  8024b6:	56                   	push   %esi
+  8024b7:	ff 75 0c             	push   0xc(%ebp)
+  8024ba:	89 d8                	mov    %ebx,%eax
+  8024bc:	c1 e0 0c             	shl    $0xc,%eax
+  8024bf:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8024c5:	50                   	push   %eax
+  8024c6:	e8 56 e4 ff ff       	call   800921 <memmove>
+	fsring_busy |= 1 << slot;
+  8024cb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024d0:	89 d9                	mov    %ebx,%ecx
+  8024d2:	d3 e0                	shl    %cl,%eax
+  8024d4:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8024da:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8024dd:	c1 e0 02             	shl    $0x2,%eax
+  8024e0:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8024e6:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8024ed:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8024f0:	8b 45 18             	mov    0x18(%ebp),%eax
+  8024f3:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8024f6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8024fd:	83 c4 08             	add    $0x8,%esp
+  802500:	53                   	push   %ebx
+  802501:	56                   	push   %esi
+  802502:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802505:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802508:	b8 04 00 00 00       	mov    $0x4,%eax
+  80250d:	e8 7f f4 ff ff       	call   801991 <fsring_post>
+  802512:	89 c3                	mov    %eax,%ebx
+  802514:	83 c4 10             	add    $0x10,%esp
+}
+  802517:	89 d8                	mov    %ebx,%eax
+  802519:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80251c:	5b                   	pop    %ebx
+  80251d:	5e                   	pop    %esi
+  80251e:	5d                   	pop    %ebp
+  80251f:	c3                   	ret
+		return -E_INVAL;
+  802520:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802525:	eb f0                	jmp    802517 <fsring_write+0x93>
+
+00802527 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802527:	55                   	push   %ebp
+  802528:	89 e5                	mov    %esp,%ebp
+  80252a:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80252d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802530:	8b 45 08             	mov    0x8(%ebp),%eax
+  802533:	e8 17 f8 ff ff       	call   801d4f <fsring_slot>
+  802538:	85 c0                	test   %eax,%eax
+  80253a:	78 4c                	js     802588 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  80253c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802541:	89 c1                	mov    %eax,%ecx
+  802543:	d3 e2                	shl    %cl,%edx
+  802545:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  80254b:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80254e:	c1 e2 02             	shl    $0x2,%edx
+  802551:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  802557:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  80255e:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802561:	8b 55 10             	mov    0x10(%ebp),%edx
+  802564:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802567:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80256a:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80256d:	83 ec 08             	sub    $0x8,%esp
+  802570:	50                   	push   %eax
+  802571:	6a 00                	push   $0x0
+  802573:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802578:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80257b:	b8 05 00 00 00       	mov    $0x5,%eax
+  802580:	e8 0c f4 ff ff       	call   801991 <fsring_post>
+  802585:	83 c4 10             	add    $0x10,%esp
+}
+  802588:	c9                   	leave
+  802589:	c3                   	ret
+
+0080258a <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  80258a:	55                   	push   %ebp
+  80258b:	89 e5                	mov    %esp,%ebp
+  80258d:	57                   	push   %edi
+  80258e:	56                   	push   %esi
+  80258f:	53                   	push   %ebx
+  802590:	83 ec 1c             	sub    $0x1c,%esp
+  802593:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802597:	a1 00 50 80 00       	mov    0x805000,%eax
+  80259c:	8b 40 48             	mov    0x48(%eax),%eax
+  80259f:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  8025a5:	74 12                	je     8025b9 <fsring_reap+0x2f>
+		return 0;
+  8025a7:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8025ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025af:	5b                   	pop    %ebx
+  8025b0:	5e                   	pop    %esi
+  8025b1:	5f                   	pop    %edi
+  8025b2:	5d                   	pop    %ebp
+  8025b3:	c3                   	ret
+		sys_yield();
+  8025b4:	e8 cf e5 ff ff       	call   800b88 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8025b9:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8025bf:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8025c4:	39 c2                	cmp    %eax,%edx
+  8025c6:	75 18                	jne    8025e0 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8025c8:	84 db                	test   %bl,%bl
+  8025ca:	0f 84 21 01 00 00    	je     8026f1 <fsring_reap+0x167>
+  8025d0:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  8025d7:	75 db                	jne    8025b4 <fsring_reap+0x2a>
+			return 0;
+  8025d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025de:	eb cc                	jmp    8025ac <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8025e0:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8025e5:	83 e0 0f             	and    $0xf,%eax
+  8025e8:	83 c0 2a             	add    $0x2a,%eax
+  8025eb:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8025f2:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8025f9:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8025fe:	83 c0 01             	add    $0x1,%eax
+  802601:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802606:	83 fb 0f             	cmp    $0xf,%ebx
+  802609:	77 5b                	ja     802666 <fsring_reap+0xdc>
+  80260b:	be 01 00 00 00       	mov    $0x1,%esi
+  802610:	89 d9                	mov    %ebx,%ecx
+  802612:	d3 e6                	shl    %cl,%esi
+  802614:	89 f0                	mov    %esi,%eax
+  802616:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  80261c:	74 48                	je     802666 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  80261e:	89 d8                	mov    %ebx,%eax
+  802620:	c1 e0 0c             	shl    $0xc,%eax
+  802623:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802629:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  80262c:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80262f:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  802636:	83 f8 03             	cmp    $0x3,%eax
+  802639:	74 40                	je     80267b <fsring_reap+0xf1>
+  80263b:	83 f8 05             	cmp    $0x5,%eax
+  80263e:	74 64                	je     8026a4 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802640:	f7 d6                	not    %esi
+  802642:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802648:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80264b:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  802652:	8b 45 08             	mov    0x8(%ebp),%eax
+  802655:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802657:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80265a:	89 38                	mov    %edi,(%eax)
+	return 1;
+  80265c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802661:	e9 46 ff ff ff       	jmp    8025ac <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802666:	53                   	push   %ebx
+  802667:	68 38 3d 80 00       	push   $0x803d38
+  80266c:	68 8f 02 00 00       	push   $0x28f
+  802671:	68 10 3d 80 00       	push   $0x803d10
+  802676:	e8 fd 0b 00 00       	call   803278 <_panic>
+		if (cqe.cqe_result > 0)
+  80267b:	85 ff                	test   %edi,%edi
+  80267d:	7e c1                	jle    802640 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80267f:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802682:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802687:	39 c7                	cmp    %eax,%edi
+  802689:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80268c:	50                   	push   %eax
+  80268d:	ff 75 e4             	push   -0x1c(%ebp)
+  802690:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802693:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  80269a:	e8 82 e2 ff ff       	call   800921 <memmove>
+  80269f:	83 c4 10             	add    $0x10,%esp
+  8026a2:	eb 9c                	jmp    802640 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8026a4:	85 ff                	test   %edi,%edi
+  8026a6:	75 98                	jne    802640 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  8026a8:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8026ab:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8026b2:	83 ec 08             	sub    $0x8,%esp
+  8026b5:	ff 75 e4             	push   -0x1c(%ebp)
+  8026b8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8026bb:	51                   	push   %ecx
+  8026bc:	e8 da e0 ff ff       	call   80079b <strcpy>
+			st->st_size = ret->ret_size;
+  8026c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8026c4:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8026ca:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8026cd:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8026d3:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8026d9:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8026df:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8026e6:	40 80 00 
+  8026e9:	83 c4 10             	add    $0x10,%esp
+  8026ec:	e9 4f ff ff ff       	jmp    802640 <fsring_reap+0xb6>
+			return 0;
+  8026f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f6:	e9 b1 fe ff ff       	jmp    8025ac <fsring_reap+0x22>
+
+008026fb <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8026fb:	55                   	push   %ebp
+  8026fc:	89 e5                	mov    %esp,%ebp
+  8026fe:	57                   	push   %edi
+  8026ff:	56                   	push   %esi
+  802700:	53                   	push   %ebx
+  802701:	83 ec 28             	sub    $0x28,%esp
+  802704:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802707:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80270a:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80270d:	53                   	push   %ebx
+  80270e:	e8 4d e0 ff ff       	call   800760 <strlen>
+  802713:	83 c4 10             	add    $0x10,%esp
+  802716:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80271b:	0f 8f 02 01 00 00    	jg     802823 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802721:	83 ec 08             	sub    $0x8,%esp
+  802724:	53                   	push   %ebx
+  802725:	68 00 60 80 00       	push   $0x806000
+  80272a:	e8 6c e0 ff ff       	call   80079b <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  80272f:	83 c4 10             	add    $0x10,%esp
+  802732:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802738:	76 69                	jbe    8027a3 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80273a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80273d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802743:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802748:	29 d1                	sub    %edx,%ecx
+  80274a:	39 f9                	cmp    %edi,%ecx
+  80274c:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80274f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802752:	89 f9                	mov    %edi,%ecx
+  802754:	01 c1                	add    %eax,%ecx
+  802756:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802759:	eb 0f                	jmp    80276a <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  80275b:	0f b6 10             	movzbl (%eax),%edx
+  80275e:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802760:	05 00 10 00 00       	add    $0x1000,%eax
+  802765:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80276a:	39 c8                	cmp    %ecx,%eax
+  80276c:	72 ed                	jb     80275b <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  80276e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802771:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802777:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  80277d:	83 ec 0c             	sub    $0xc,%esp
+  802780:	6a 07                	push   $0x7
+  802782:	89 f9                	mov    %edi,%ecx
+  802784:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802787:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80278c:	e8 3f f1 ff ff       	call   8018d0 <fsipc_pages>
+  802791:	89 c7                	mov    %eax,%edi
+  802793:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802796:	85 f6                	test   %esi,%esi
+  802798:	74 7f                	je     802819 <file_slurp+0x11e>
+  80279a:	8d 43 01             	lea    0x1(%ebx),%eax
+  80279d:	85 ff                	test   %edi,%edi
+  80279f:	79 3c                	jns    8027dd <file_slurp+0xe2>
+  8027a1:	eb 76                	jmp    802819 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8027a3:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8027a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ae:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8027b3:	e8 ba f2 ff ff       	call   801a72 <fsipc>
+  8027b8:	89 c7                	mov    %eax,%edi
+  8027ba:	85 c0                	test   %eax,%eax
+  8027bc:	7e d8                	jle    802796 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8027be:	83 ec 04             	sub    $0x4,%esp
+  8027c1:	50                   	push   %eax
+  8027c2:	68 08 60 80 00       	push   $0x806008
+  8027c7:	ff 75 0c             	push   0xc(%ebp)
+  8027ca:	e8 52 e1 ff ff       	call   800921 <memmove>
+  8027cf:	83 c4 10             	add    $0x10,%esp
+  8027d2:	eb c2                	jmp    802796 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8027d4:	80 fa 2f             	cmp    $0x2f,%dl
+  8027d7:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8027da:	83 c0 01             	add    $0x1,%eax
+  8027dd:	89 c1                	mov    %eax,%ecx
+  8027df:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8027e3:	84 d2                	test   %dl,%dl
+  8027e5:	75 ed                	jne    8027d4 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8027e7:	83 ec 04             	sub    $0x4,%esp
+  8027ea:	68 80 00 00 00       	push   $0x80
+  8027ef:	53                   	push   %ebx
+  8027f0:	56                   	push   %esi
+  8027f1:	e8 1b e0 ff ff       	call   800811 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8027f6:	a1 00 60 80 00       	mov    0x806000,%eax
+  8027fb:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802801:	a1 04 60 80 00       	mov    0x806004,%eax
+  802806:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  80280c:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  802813:	40 80 00 
+  802816:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802819:	89 f8                	mov    %edi,%eax
+  80281b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80281e:	5b                   	pop    %ebx
+  80281f:	5e                   	pop    %esi
+  802820:	5f                   	pop    %edi
+  802821:	5d                   	pop    %ebp
+  802822:	c3                   	ret
+		return -E_BAD_PATH;
+  802823:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802828:	eb ef                	jmp    802819 <file_slurp+0x11e>
+
+0080282a <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80282a:	55                   	push   %ebp
+  80282b:	89 e5                	mov    %esp,%ebp
+  80282d:	53                   	push   %ebx
+  80282e:	83 ec 10             	sub    $0x10,%esp
+  802831:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802834:	53                   	push   %ebx
+  802835:	e8 26 df ff ff       	call   800760 <strlen>
+  80283a:	83 c4 10             	add    $0x10,%esp
+  80283d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802842:	7f 25                	jg     802869 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802844:	83 ec 08             	sub    $0x8,%esp
+  802847:	53                   	push   %ebx
+  802848:	68 00 60 80 00       	push   $0x806000
+  80284d:	e8 49 df ff ff       	call   80079b <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802852:	ba 00 00 00 00       	mov    $0x0,%edx
+  802857:	b8 07 00 00 00       	mov    $0x7,%eax
+  80285c:	e8 11 f2 ff ff       	call   801a72 <fsipc>
+  802861:	83 c4 10             	add    $0x10,%esp
+}
+  802864:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802867:	c9                   	leave
+  802868:	c3                   	ret
+		return -E_BAD_PATH;
+  802869:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80286e:	eb f4                	jmp    802864 <remove+0x3a>
+
+00802870 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802870:	55                   	push   %ebp
+  802871:	89 e5                	mov    %esp,%ebp
+  802873:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802876:	ba 00 00 00 00       	mov    $0x0,%edx
+  80287b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802880:	e8 ed f1 ff ff       	call   801a72 <fsipc>
+}
+  802885:	c9                   	leave
+  802886:	c3                   	ret
+
+00802887 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802887:	55                   	push   %ebp
+  802888:	89 e5                	mov    %esp,%ebp
+  80288a:	57                   	push   %edi
+  80288b:	56                   	push   %esi
+  80288c:	53                   	push   %ebx
+  80288d:	83 ec 18             	sub    $0x18,%esp
+  802890:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802893:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802896:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802899:	57                   	push   %edi
+  80289a:	e8 c1 de ff ff       	call   800760 <strlen>
+  80289f:	83 c4 10             	add    $0x10,%esp
+  8028a2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8028a7:	7f 4c                	jg     8028f5 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  8028a9:	83 ec 08             	sub    $0x8,%esp
+  8028ac:	57                   	push   %edi
+  8028ad:	68 00 60 80 00       	push   $0x806000
+  8028b2:	e8 e4 de ff ff       	call   80079b <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  8028b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028bc:	b8 10 00 00 00       	mov    $0x10,%eax
+  8028c1:	e8 ac f1 ff ff       	call   801a72 <fsipc>
+  8028c6:	83 c4 10             	add    $0x10,%esp
+  8028c9:	85 c0                	test   %eax,%eax
+  8028cb:	78 20                	js     8028ed <defrag+0x66>
+		return r;
+	if (before)
+  8028cd:	85 f6                	test   %esi,%esi
+  8028cf:	74 07                	je     8028d8 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  8028d1:	a1 00 60 80 00       	mov    0x806000,%eax
+  8028d6:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  8028d8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  8028dd:	85 db                	test   %ebx,%ebx
+  8028df:	74 0c                	je     8028ed <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  8028e1:	a1 04 60 80 00       	mov    0x806004,%eax
+  8028e6:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8028e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028f0:	5b                   	pop    %ebx
+  8028f1:	5e                   	pop    %esi
+  8028f2:	5f                   	pop    %edi
+  8028f3:	5d                   	pop    %ebp
+  8028f4:	c3                   	ret
+		return -E_BAD_PATH;
+  8028f5:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8028fa:	eb f1                	jmp    8028ed <defrag+0x66>
+
+008028fc <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  8028fc:	55                   	push   %ebp
+  8028fd:	89 e5                	mov    %esp,%ebp
+  8028ff:	53                   	push   %ebx
+  802900:	83 ec 04             	sub    $0x4,%esp
+  802903:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802906:	ba 00 00 00 00       	mov    $0x0,%edx
+  80290b:	b8 11 00 00 00       	mov    $0x11,%eax
+  802910:	e8 5d f1 ff ff       	call   801a72 <fsipc>
+  802915:	85 c0                	test   %eax,%eax
+  802917:	78 34                	js     80294d <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802919:	a1 00 60 80 00       	mov    0x806000,%eax
+  80291e:	89 03                	mov    %eax,(%ebx)
+  802920:	a1 04 60 80 00       	mov    0x806004,%eax
+  802925:	89 43 04             	mov    %eax,0x4(%ebx)
+  802928:	a1 08 60 80 00       	mov    0x806008,%eax
+  80292d:	89 43 08             	mov    %eax,0x8(%ebx)
+  802930:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  802935:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802938:	a1 10 60 80 00       	mov    0x806010,%eax
+  80293d:	89 43 10             	mov    %eax,0x10(%ebx)
+  802940:	a1 14 60 80 00       	mov    0x806014,%eax
+  802945:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802948:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80294d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802950:	c9                   	leave
+  802951:	c3                   	ret
+
+00802952 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802952:	55                   	push   %ebp
+  802953:	89 e5                	mov    %esp,%ebp
+  802955:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802958:	68 51 3d 80 00       	push   $0x803d51
+  80295d:	ff 75 0c             	push   0xc(%ebp)
+  802960:	e8 36 de ff ff       	call   80079b <strcpy>
+	return 0;
+}
+  802965:	b8 00 00 00 00       	mov    $0x0,%eax
+  80296a:	c9                   	leave
+  80296b:	c3                   	ret
+
+0080296c <devsock_close>:
+{
+  80296c:	55                   	push   %ebp
+  80296d:	89 e5                	mov    %esp,%ebp
+  80296f:	53                   	push   %ebx
+  802970:	83 ec 10             	sub    $0x10,%esp
+  802973:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802976:	53                   	push   %ebx
+  802977:	e8 be 0b 00 00       	call   80353a <pageref>
+  80297c:	89 c2                	mov    %eax,%edx
+  80297e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802981:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802986:	83 fa 01             	cmp    $0x1,%edx
+  802989:	74 05                	je     802990 <devsock_close+0x24>
+}
+  80298b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80298e:	c9                   	leave
+  80298f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802990:	83 ec 0c             	sub    $0xc,%esp
+  802993:	ff 73 0c             	push   0xc(%ebx)
+  802996:	e8 b7 02 00 00       	call   802c52 <nsipc_close>
+  80299b:	83 c4 10             	add    $0x10,%esp
+  80299e:	eb eb                	jmp    80298b <devsock_close+0x1f>
+
+008029a0 <devsock_write>:
+{
+  8029a0:	55                   	push   %ebp
+  8029a1:	89 e5                	mov    %esp,%ebp
+  8029a3:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8029a6:	6a 00                	push   $0x0
+  8029a8:	ff 75 10             	push   0x10(%ebp)
+  8029ab:	ff 75 0c             	push   0xc(%ebp)
+  8029ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b1:	ff 70 0c             	push   0xc(%eax)
+  8029b4:	e8 79 03 00 00       	call   802d32 <nsipc_send>
+}
+  8029b9:	c9                   	leave
+  8029ba:	c3                   	ret
+
+008029bb <devsock_read>:
+{
+  8029bb:	55                   	push   %ebp
+  8029bc:	89 e5                	mov    %esp,%ebp
+  8029be:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8029c1:	6a 00                	push   $0x0
+  8029c3:	ff 75 10             	push   0x10(%ebp)
+  8029c6:	ff 75 0c             	push   0xc(%ebp)
+  8029c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029cc:	ff 70 0c             	push   0xc(%eax)
+  8029cf:	e8 ef 02 00 00       	call   802cc3 <nsipc_recv>
+}
+  8029d4:	c9                   	leave
+  8029d5:	c3                   	ret
+
+008029d6 <fd2sockid>:
+{
+  8029d6:	55                   	push   %ebp
+  8029d7:	89 e5                	mov    %esp,%ebp
+  8029d9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8029dc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8029df:	52                   	push   %edx
+  8029e0:	50                   	push   %eax
+  8029e1:	e8 54 e9 ff ff       	call   80133a <fd_lookup>
+  8029e6:	83 c4 10             	add    $0x10,%esp
+  8029e9:	85 c0                	test   %eax,%eax
+  8029eb:	78 10                	js     8029fd <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8029ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029f0:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  8029f6:	39 08                	cmp    %ecx,(%eax)
+  8029f8:	75 05                	jne    8029ff <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8029fa:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8029fd:	c9                   	leave
+  8029fe:	c3                   	ret
+		return -E_NOT_SUPP;
+  8029ff:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a04:	eb f7                	jmp    8029fd <fd2sockid+0x27>
+
+00802a06 <alloc_sockfd>:
+{
+  802a06:	55                   	push   %ebp
+  802a07:	89 e5                	mov    %esp,%ebp
+  802a09:	56                   	push   %esi
+  802a0a:	53                   	push   %ebx
+  802a0b:	83 ec 1c             	sub    $0x1c,%esp
+  802a0e:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802a10:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a13:	50                   	push   %eax
+  802a14:	e8 cb e8 ff ff       	call   8012e4 <fd_alloc>
+  802a19:	89 c3                	mov    %eax,%ebx
+  802a1b:	83 c4 10             	add    $0x10,%esp
+  802a1e:	85 c0                	test   %eax,%eax
+  802a20:	78 43                	js     802a65 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802a22:	83 ec 04             	sub    $0x4,%esp
+  802a25:	68 07 04 00 00       	push   $0x407
+  802a2a:	ff 75 f4             	push   -0xc(%ebp)
+  802a2d:	6a 00                	push   $0x0
+  802a2f:	e8 73 e1 ff ff       	call   800ba7 <sys_page_alloc>
+  802a34:	89 c3                	mov    %eax,%ebx
+  802a36:	83 c4 10             	add    $0x10,%esp
+  802a39:	85 c0                	test   %eax,%eax
+  802a3b:	78 28                	js     802a65 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802a3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a40:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802a46:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802a48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a4b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802a52:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802a55:	83 ec 0c             	sub    $0xc,%esp
+  802a58:	50                   	push   %eax
+  802a59:	e8 5f e8 ff ff       	call   8012bd <fd2num>
+  802a5e:	89 c3                	mov    %eax,%ebx
+  802a60:	83 c4 10             	add    $0x10,%esp
+  802a63:	eb 0c                	jmp    802a71 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802a65:	83 ec 0c             	sub    $0xc,%esp
+  802a68:	56                   	push   %esi
+  802a69:	e8 e4 01 00 00       	call   802c52 <nsipc_close>
+		return r;
+  802a6e:	83 c4 10             	add    $0x10,%esp
+}
+  802a71:	89 d8                	mov    %ebx,%eax
+  802a73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a76:	5b                   	pop    %ebx
+  802a77:	5e                   	pop    %esi
+  802a78:	5d                   	pop    %ebp
+  802a79:	c3                   	ret
+
+00802a7a <accept>:
+{
+  802a7a:	55                   	push   %ebp
+  802a7b:	89 e5                	mov    %esp,%ebp
+  802a7d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a80:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a83:	e8 4e ff ff ff       	call   8029d6 <fd2sockid>
+  802a88:	85 c0                	test   %eax,%eax
+  802a8a:	78 1b                	js     802aa7 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802a8c:	83 ec 04             	sub    $0x4,%esp
+  802a8f:	ff 75 10             	push   0x10(%ebp)
+  802a92:	ff 75 0c             	push   0xc(%ebp)
+  802a95:	50                   	push   %eax
+  802a96:	e8 0e 01 00 00       	call   802ba9 <nsipc_accept>
+  802a9b:	83 c4 10             	add    $0x10,%esp
+  802a9e:	85 c0                	test   %eax,%eax
+  802aa0:	78 05                	js     802aa7 <accept+0x2d>
+	return alloc_sockfd(r);
+  802aa2:	e8 5f ff ff ff       	call   802a06 <alloc_sockfd>
+}
+  802aa7:	c9                   	leave
+  802aa8:	c3                   	ret
+
+00802aa9 <bind>:
+{
+  802aa9:	55                   	push   %ebp
+  802aaa:	89 e5                	mov    %esp,%ebp
+  802aac:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802aaf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ab2:	e8 1f ff ff ff       	call   8029d6 <fd2sockid>
+  802ab7:	85 c0                	test   %eax,%eax
+  802ab9:	78 12                	js     802acd <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802abb:	83 ec 04             	sub    $0x4,%esp
+  802abe:	ff 75 10             	push   0x10(%ebp)
+  802ac1:	ff 75 0c             	push   0xc(%ebp)
+  802ac4:	50                   	push   %eax
+  802ac5:	e8 31 01 00 00       	call   802bfb <nsipc_bind>
+  802aca:	83 c4 10             	add    $0x10,%esp
+}
+  802acd:	c9                   	leave
+  802ace:	c3                   	ret
+
+00802acf <shutdown>:
+{
+  802acf:	55                   	push   %ebp
+  802ad0:	89 e5                	mov    %esp,%ebp
+  802ad2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ad5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad8:	e8 f9 fe ff ff       	call   8029d6 <fd2sockid>
+  802add:	85 c0                	test   %eax,%eax
+  802adf:	78 0f                	js     802af0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802ae1:	83 ec 08             	sub    $0x8,%esp
+  802ae4:	ff 75 0c             	push   0xc(%ebp)
+  802ae7:	50                   	push   %eax
+  802ae8:	e8 43 01 00 00       	call   802c30 <nsipc_shutdown>
+  802aed:	83 c4 10             	add    $0x10,%esp
+}
+  802af0:	c9                   	leave
+  802af1:	c3                   	ret
+
+00802af2 <connect>:
+{
+  802af2:	55                   	push   %ebp
+  802af3:	89 e5                	mov    %esp,%ebp
+  802af5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802af8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802afb:	e8 d6 fe ff ff       	call   8029d6 <fd2sockid>
+  802b00:	85 c0                	test   %eax,%eax
+  802b02:	78 12                	js     802b16 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802b04:	83 ec 04             	sub    $0x4,%esp
+  802b07:	ff 75 10             	push   0x10(%ebp)
+  802b0a:	ff 75 0c             	push   0xc(%ebp)
+  802b0d:	50                   	push   %eax
+  802b0e:	e8 59 01 00 00       	call   802c6c <nsipc_connect>
+  802b13:	83 c4 10             	add    $0x10,%esp
+}
+  802b16:	c9                   	leave
+  802b17:	c3                   	ret
+
+00802b18 <listen>:
+{
+  802b18:	55                   	push   %ebp
+  802b19:	89 e5                	mov    %esp,%ebp
+  802b1b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b21:	e8 b0 fe ff ff       	call   8029d6 <fd2sockid>
+  802b26:	85 c0                	test   %eax,%eax
+  802b28:	78 0f                	js     802b39 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802b2a:	83 ec 08             	sub    $0x8,%esp
+  802b2d:	ff 75 0c             	push   0xc(%ebp)
+  802b30:	50                   	push   %eax
+  802b31:	e8 6b 01 00 00       	call   802ca1 <nsipc_listen>
+  802b36:	83 c4 10             	add    $0x10,%esp
+}
+  802b39:	c9                   	leave
+  802b3a:	c3                   	ret
+
+00802b3b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802b3b:	55                   	push   %ebp
+  802b3c:	89 e5                	mov    %esp,%ebp
+  802b3e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802b41:	ff 75 10             	push   0x10(%ebp)
+  802b44:	ff 75 0c             	push   0xc(%ebp)
+  802b47:	ff 75 08             	push   0x8(%ebp)
+  802b4a:	e8 41 02 00 00       	call   802d90 <nsipc_socket>
+  802b4f:	83 c4 10             	add    $0x10,%esp
+  802b52:	85 c0                	test   %eax,%eax
+  802b54:	78 05                	js     802b5b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802b56:	e8 ab fe ff ff       	call   802a06 <alloc_sockfd>
+}
+  802b5b:	c9                   	leave
+  802b5c:	c3                   	ret
+
+00802b5d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802b5d:	55                   	push   %ebp
+  802b5e:	89 e5                	mov    %esp,%ebp
+  802b60:	53                   	push   %ebx
+  802b61:	83 ec 04             	sub    $0x4,%esp
+  802b64:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802b66:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802b6d:	74 26                	je     802b95 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802b6f:	6a 07                	push   $0x7
+  802b71:	68 00 80 80 00       	push   $0x808000
+  802b76:	53                   	push   %ebx
+  802b77:	ff 35 00 90 80 00    	push   0x809000
+  802b7d:	e8 40 08 00 00       	call   8033c2 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802b82:	83 c4 0c             	add    $0xc,%esp
+  802b85:	6a 00                	push   $0x0
+  802b87:	6a 00                	push   $0x0
+  802b89:	6a 00                	push   $0x0
+  802b8b:	e8 c7 07 00 00       	call   803357 <ipc_recv>
+}
+  802b90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b93:	c9                   	leave
+  802b94:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802b95:	83 ec 0c             	sub    $0xc,%esp
+  802b98:	6a 02                	push   $0x2
+  802b9a:	e8 5c 09 00 00       	call   8034fb <ipc_find_env>
+  802b9f:	a3 00 90 80 00       	mov    %eax,0x809000
+  802ba4:	83 c4 10             	add    $0x10,%esp
+  802ba7:	eb c6                	jmp    802b6f <nsipc+0x12>
+
+00802ba9 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802ba9:	55                   	push   %ebp
+  802baa:	89 e5                	mov    %esp,%ebp
+  802bac:	56                   	push   %esi
+  802bad:	53                   	push   %ebx
+  802bae:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802bb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb4:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802bb9:	8b 06                	mov    (%esi),%eax
+  802bbb:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802bc0:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bc5:	e8 93 ff ff ff       	call   802b5d <nsipc>
+  802bca:	89 c3                	mov    %eax,%ebx
+  802bcc:	85 c0                	test   %eax,%eax
+  802bce:	79 09                	jns    802bd9 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802bd0:	89 d8                	mov    %ebx,%eax
+  802bd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bd5:	5b                   	pop    %ebx
+  802bd6:	5e                   	pop    %esi
+  802bd7:	5d                   	pop    %ebp
+  802bd8:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802bd9:	83 ec 04             	sub    $0x4,%esp
+  802bdc:	ff 35 10 80 80 00    	push   0x808010
+  802be2:	68 00 80 80 00       	push   $0x808000
+  802be7:	ff 75 0c             	push   0xc(%ebp)
+  802bea:	e8 32 dd ff ff       	call   800921 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802bef:	a1 10 80 80 00       	mov    0x808010,%eax
+  802bf4:	89 06                	mov    %eax,(%esi)
+  802bf6:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802bf9:	eb d5                	jmp    802bd0 <nsipc_accept+0x27>
+
+00802bfb <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802bfb:	55                   	push   %ebp
+  802bfc:	89 e5                	mov    %esp,%ebp
+  802bfe:	53                   	push   %ebx
+  802bff:	83 ec 08             	sub    $0x8,%esp
+  802c02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802c05:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c08:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802c0d:	53                   	push   %ebx
+  802c0e:	ff 75 0c             	push   0xc(%ebp)
+  802c11:	68 04 80 80 00       	push   $0x808004
+  802c16:	e8 06 dd ff ff       	call   800921 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802c1b:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802c21:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c26:	e8 32 ff ff ff       	call   802b5d <nsipc>
+}
+  802c2b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c2e:	c9                   	leave
+  802c2f:	c3                   	ret
+
+00802c30 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802c30:	55                   	push   %ebp
+  802c31:	89 e5                	mov    %esp,%ebp
+  802c33:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802c36:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c39:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802c3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c41:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802c46:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c4b:	e8 0d ff ff ff       	call   802b5d <nsipc>
+}
+  802c50:	c9                   	leave
+  802c51:	c3                   	ret
+
+00802c52 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802c52:	55                   	push   %ebp
+  802c53:	89 e5                	mov    %esp,%ebp
+  802c55:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802c58:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c5b:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802c60:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c65:	e8 f3 fe ff ff       	call   802b5d <nsipc>
+}
+  802c6a:	c9                   	leave
+  802c6b:	c3                   	ret
+
+00802c6c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802c6c:	55                   	push   %ebp
+  802c6d:	89 e5                	mov    %esp,%ebp
+  802c6f:	53                   	push   %ebx
+  802c70:	83 ec 08             	sub    $0x8,%esp
+  802c73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802c76:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c79:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802c7e:	53                   	push   %ebx
+  802c7f:	ff 75 0c             	push   0xc(%ebp)
+  802c82:	68 04 80 80 00       	push   $0x808004
+  802c87:	e8 95 dc ff ff       	call   800921 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802c8c:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802c92:	b8 05 00 00 00       	mov    $0x5,%eax
+  802c97:	e8 c1 fe ff ff       	call   802b5d <nsipc>
+}
+  802c9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c9f:	c9                   	leave
+  802ca0:	c3                   	ret
+
+00802ca1 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802ca1:	55                   	push   %ebp
+  802ca2:	89 e5                	mov    %esp,%ebp
+  802ca4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802ca7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802caa:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802caf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cb2:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802cb7:	b8 06 00 00 00       	mov    $0x6,%eax
+  802cbc:	e8 9c fe ff ff       	call   802b5d <nsipc>
+}
+  802cc1:	c9                   	leave
+  802cc2:	c3                   	ret
+
+00802cc3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802cc3:	55                   	push   %ebp
+  802cc4:	89 e5                	mov    %esp,%ebp
+  802cc6:	56                   	push   %esi
+  802cc7:	53                   	push   %ebx
+  802cc8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802ccb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cce:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802cd3:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802cd9:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cdc:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802ce1:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ce6:	e8 72 fe ff ff       	call   802b5d <nsipc>
+  802ceb:	89 c3                	mov    %eax,%ebx
+  802ced:	85 c0                	test   %eax,%eax
+  802cef:	78 22                	js     802d13 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802cf1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802cf6:	39 c6                	cmp    %eax,%esi
+  802cf8:	0f 4e c6             	cmovle %esi,%eax
+  802cfb:	39 c3                	cmp    %eax,%ebx
+  802cfd:	7f 1d                	jg     802d1c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802cff:	83 ec 04             	sub    $0x4,%esp
+  802d02:	53                   	push   %ebx
+  802d03:	68 00 80 80 00       	push   $0x808000
+  802d08:	ff 75 0c             	push   0xc(%ebp)
+  802d0b:	e8 11 dc ff ff       	call   800921 <memmove>
+  802d10:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802d13:	89 d8                	mov    %ebx,%eax
+  802d15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d18:	5b                   	pop    %ebx
+  802d19:	5e                   	pop    %esi
+  802d1a:	5d                   	pop    %ebp
+  802d1b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802d1c:	68 5d 3d 80 00       	push   $0x803d5d
+  802d21:	68 2c 3c 80 00       	push   $0x803c2c
+  802d26:	6a 62                	push   $0x62
+  802d28:	68 72 3d 80 00       	push   $0x803d72
+  802d2d:	e8 46 05 00 00       	call   803278 <_panic>
+
+00802d32 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802d32:	55                   	push   %ebp
+  802d33:	89 e5                	mov    %esp,%ebp
+  802d35:	53                   	push   %ebx
+  802d36:	83 ec 04             	sub    $0x4,%esp
+  802d39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802d3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d3f:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802d44:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d4a:	7f 2e                	jg     802d7a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802d4c:	83 ec 04             	sub    $0x4,%esp
+  802d4f:	53                   	push   %ebx
+  802d50:	ff 75 0c             	push   0xc(%ebp)
+  802d53:	68 0c 80 80 00       	push   $0x80800c
+  802d58:	e8 c4 db ff ff       	call   800921 <memmove>
+	nsipcbuf.send.req_size = size;
+  802d5d:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802d63:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d66:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802d6b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d70:	e8 e8 fd ff ff       	call   802b5d <nsipc>
+}
+  802d75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d78:	c9                   	leave
+  802d79:	c3                   	ret
+	assert(size < 1600);
+  802d7a:	68 7e 3d 80 00       	push   $0x803d7e
+  802d7f:	68 2c 3c 80 00       	push   $0x803c2c
+  802d84:	6a 6d                	push   $0x6d
+  802d86:	68 72 3d 80 00       	push   $0x803d72
+  802d8b:	e8 e8 04 00 00       	call   803278 <_panic>
+
+00802d90 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802d90:	55                   	push   %ebp
+  802d91:	89 e5                	mov    %esp,%ebp
+  802d93:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802d96:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d99:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802d9e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802da1:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802da6:	8b 45 10             	mov    0x10(%ebp),%eax
+  802da9:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802dae:	b8 09 00 00 00       	mov    $0x9,%eax
+  802db3:	e8 a5 fd ff ff       	call   802b5d <nsipc>
+}
+  802db8:	c9                   	leave
+  802db9:	c3                   	ret
+
+00802dba <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802dba:	55                   	push   %ebp
+  802dbb:	89 e5                	mov    %esp,%ebp
+  802dbd:	56                   	push   %esi
+  802dbe:	53                   	push   %ebx
+  802dbf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802dc2:	83 ec 0c             	sub    $0xc,%esp
+  802dc5:	ff 75 08             	push   0x8(%ebp)
+  802dc8:	e8 00 e5 ff ff       	call   8012cd <fd2data>
+  802dcd:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802dcf:	83 c4 08             	add    $0x8,%esp
+  802dd2:	68 8a 3d 80 00       	push   $0x803d8a
+  802dd7:	53                   	push   %ebx
+  802dd8:	e8 be d9 ff ff       	call   80079b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802ddd:	8b 46 04             	mov    0x4(%esi),%eax
+  802de0:	2b 06                	sub    (%esi),%eax
+  802de2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802de8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802def:	00 00 00 
+	stat->st_dev = &devpipe;
+  802df2:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802df9:	40 80 00 
+	return 0;
+}
+  802dfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e04:	5b                   	pop    %ebx
+  802e05:	5e                   	pop    %esi
+  802e06:	5d                   	pop    %ebp
+  802e07:	c3                   	ret
+
+00802e08 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e08:	55                   	push   %ebp
+  802e09:	89 e5                	mov    %esp,%ebp
+  802e0b:	53                   	push   %ebx
+  802e0c:	83 ec 0c             	sub    $0xc,%esp
+  802e0f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802e12:	53                   	push   %ebx
+  802e13:	6a 00                	push   $0x0
+  802e15:	e8 1a de ff ff       	call   800c34 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802e1a:	89 1c 24             	mov    %ebx,(%esp)
+  802e1d:	e8 ab e4 ff ff       	call   8012cd <fd2data>
+  802e22:	83 c4 08             	add    $0x8,%esp
+  802e25:	50                   	push   %eax
+  802e26:	6a 00                	push   $0x0
+  802e28:	e8 07 de ff ff       	call   800c34 <sys_page_unmap>
+}
+  802e2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e30:	c9                   	leave
+  802e31:	c3                   	ret
+
+00802e32 <_pipeisclosed>:
+{
+  802e32:	55                   	push   %ebp
+  802e33:	89 e5                	mov    %esp,%ebp
+  802e35:	57                   	push   %edi
+  802e36:	56                   	push   %esi
+  802e37:	53                   	push   %ebx
+  802e38:	83 ec 1c             	sub    $0x1c,%esp
+  802e3b:	89 c7                	mov    %eax,%edi
+  802e3d:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802e3f:	a1 00 50 80 00       	mov    0x805000,%eax
+  802e44:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802e47:	83 ec 0c             	sub    $0xc,%esp
+  802e4a:	57                   	push   %edi
+  802e4b:	e8 ea 06 00 00       	call   80353a <pageref>
+  802e50:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e53:	89 34 24             	mov    %esi,(%esp)
+  802e56:	e8 df 06 00 00       	call   80353a <pageref>
+		nn = thisenv->env_runs;
+  802e5b:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802e61:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802e64:	83 c4 10             	add    $0x10,%esp
+  802e67:	39 cb                	cmp    %ecx,%ebx
+  802e69:	74 1b                	je     802e86 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802e6b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e6e:	75 cf                	jne    802e3f <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802e70:	8b 42 58             	mov    0x58(%edx),%eax
+  802e73:	6a 01                	push   $0x1
+  802e75:	50                   	push   %eax
+  802e76:	53                   	push   %ebx
+  802e77:	68 91 3d 80 00       	push   $0x803d91
+  802e7c:	e8 2c d3 ff ff       	call   8001ad <cprintf>
+  802e81:	83 c4 10             	add    $0x10,%esp
+  802e84:	eb b9                	jmp    802e3f <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802e86:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802e89:	0f 94 c0             	sete   %al
+  802e8c:	0f b6 c0             	movzbl %al,%eax
+}
+  802e8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e92:	5b                   	pop    %ebx
+  802e93:	5e                   	pop    %esi
+  802e94:	5f                   	pop    %edi
+  802e95:	5d                   	pop    %ebp
+  802e96:	c3                   	ret
+
+00802e97 <devpipe_write>:
+{
+  802e97:	55                   	push   %ebp
+  802e98:	89 e5                	mov    %esp,%ebp
+  802e9a:	57                   	push   %edi
+  802e9b:	56                   	push   %esi
+  802e9c:	53                   	push   %ebx
+  802e9d:	83 ec 28             	sub    $0x28,%esp
+  802ea0:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802ea3:	56                   	push   %esi
+  802ea4:	e8 24 e4 ff ff       	call   8012cd <fd2data>
+  802ea9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802eab:	83 c4 10             	add    $0x10,%esp
+  802eae:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802eb6:	75 09                	jne    802ec1 <devpipe_write+0x2a>
+	return i;
+  802eb8:	89 f8                	mov    %edi,%eax
+  802eba:	eb 23                	jmp    802edf <devpipe_write+0x48>
+			sys_yield();
+  802ebc:	e8 c7 dc ff ff       	call   800b88 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802ec1:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ec4:	8b 0b                	mov    (%ebx),%ecx
+  802ec6:	8d 51 20             	lea    0x20(%ecx),%edx
+  802ec9:	39 d0                	cmp    %edx,%eax
+  802ecb:	72 1a                	jb     802ee7 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802ecd:	89 da                	mov    %ebx,%edx
+  802ecf:	89 f0                	mov    %esi,%eax
+  802ed1:	e8 5c ff ff ff       	call   802e32 <_pipeisclosed>
+  802ed6:	85 c0                	test   %eax,%eax
+  802ed8:	74 e2                	je     802ebc <devpipe_write+0x25>
+				return 0;
+  802eda:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802edf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ee2:	5b                   	pop    %ebx
+  802ee3:	5e                   	pop    %esi
+  802ee4:	5f                   	pop    %edi
+  802ee5:	5d                   	pop    %ebp
+  802ee6:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802ee7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802eea:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802eee:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802ef1:	89 c2                	mov    %eax,%edx
+  802ef3:	c1 fa 1f             	sar    $0x1f,%edx
+  802ef6:	89 d1                	mov    %edx,%ecx
+  802ef8:	c1 e9 1b             	shr    $0x1b,%ecx
+  802efb:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802efe:	83 e2 1f             	and    $0x1f,%edx
+  802f01:	29 ca                	sub    %ecx,%edx
+  802f03:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802f07:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802f0b:	83 c0 01             	add    $0x1,%eax
+  802f0e:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802f11:	83 c7 01             	add    $0x1,%edi
+  802f14:	eb 9d                	jmp    802eb3 <devpipe_write+0x1c>
+
+00802f16 <devpipe_read>:
+{
+  802f16:	55                   	push   %ebp
+  802f17:	89 e5                	mov    %esp,%ebp
+  802f19:	57                   	push   %edi
+  802f1a:	56                   	push   %esi
+  802f1b:	53                   	push   %ebx
+  802f1c:	83 ec 18             	sub    $0x18,%esp
+  802f1f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802f22:	57                   	push   %edi
+  802f23:	e8 a5 e3 ff ff       	call   8012cd <fd2data>
+  802f28:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f2a:	83 c4 10             	add    $0x10,%esp
+  802f2d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f32:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802f35:	75 13                	jne    802f4a <devpipe_read+0x34>
+	return i;
+  802f37:	89 f0                	mov    %esi,%eax
+  802f39:	eb 02                	jmp    802f3d <devpipe_read+0x27>
+				return i;
+  802f3b:	89 f0                	mov    %esi,%eax
+}
+  802f3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f40:	5b                   	pop    %ebx
+  802f41:	5e                   	pop    %esi
+  802f42:	5f                   	pop    %edi
+  802f43:	5d                   	pop    %ebp
+  802f44:	c3                   	ret
+			sys_yield();
+  802f45:	e8 3e dc ff ff       	call   800b88 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802f4a:	8b 03                	mov    (%ebx),%eax
+  802f4c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f4f:	75 18                	jne    802f69 <devpipe_read+0x53>
+			if (i > 0)
+  802f51:	85 f6                	test   %esi,%esi
+  802f53:	75 e6                	jne    802f3b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802f55:	89 da                	mov    %ebx,%edx
+  802f57:	89 f8                	mov    %edi,%eax
+  802f59:	e8 d4 fe ff ff       	call   802e32 <_pipeisclosed>
+  802f5e:	85 c0                	test   %eax,%eax
+  802f60:	74 e3                	je     802f45 <devpipe_read+0x2f>
+				return 0;
+  802f62:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f67:	eb d4                	jmp    802f3d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802f69:	99                   	cltd
+  802f6a:	c1 ea 1b             	shr    $0x1b,%edx
+  802f6d:	01 d0                	add    %edx,%eax
+  802f6f:	83 e0 1f             	and    $0x1f,%eax
+  802f72:	29 d0                	sub    %edx,%eax
+  802f74:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802f79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f7c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802f7f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802f82:	83 c6 01             	add    $0x1,%esi
+  802f85:	eb ab                	jmp    802f32 <devpipe_read+0x1c>
+
+00802f87 <pipe>:
+{
+  802f87:	55                   	push   %ebp
+  802f88:	89 e5                	mov    %esp,%ebp
+  802f8a:	56                   	push   %esi
+  802f8b:	53                   	push   %ebx
+  802f8c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802f8f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f92:	50                   	push   %eax
+  802f93:	e8 4c e3 ff ff       	call   8012e4 <fd_alloc>
+  802f98:	89 c3                	mov    %eax,%ebx
+  802f9a:	83 c4 10             	add    $0x10,%esp
+  802f9d:	85 c0                	test   %eax,%eax
+  802f9f:	0f 88 23 01 00 00    	js     8030c8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802fa5:	83 ec 04             	sub    $0x4,%esp
+  802fa8:	68 07 04 00 00       	push   $0x407
+  802fad:	ff 75 f4             	push   -0xc(%ebp)
+  802fb0:	6a 00                	push   $0x0
+  802fb2:	e8 f0 db ff ff       	call   800ba7 <sys_page_alloc>
+  802fb7:	89 c3                	mov    %eax,%ebx
+  802fb9:	83 c4 10             	add    $0x10,%esp
+  802fbc:	85 c0                	test   %eax,%eax
+  802fbe:	0f 88 04 01 00 00    	js     8030c8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802fc4:	83 ec 0c             	sub    $0xc,%esp
+  802fc7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802fca:	50                   	push   %eax
+  802fcb:	e8 14 e3 ff ff       	call   8012e4 <fd_alloc>
+  802fd0:	89 c3                	mov    %eax,%ebx
+  802fd2:	83 c4 10             	add    $0x10,%esp
+  802fd5:	85 c0                	test   %eax,%eax
+  802fd7:	0f 88 db 00 00 00    	js     8030b8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802fdd:	83 ec 04             	sub    $0x4,%esp
+  802fe0:	68 07 04 00 00       	push   $0x407
+  802fe5:	ff 75 f0             	push   -0x10(%ebp)
+  802fe8:	6a 00                	push   $0x0
+  802fea:	e8 b8 db ff ff       	call   800ba7 <sys_page_alloc>
+  802fef:	89 c3                	mov    %eax,%ebx
+  802ff1:	83 c4 10             	add    $0x10,%esp
+  802ff4:	85 c0                	test   %eax,%eax
+  802ff6:	0f 88 bc 00 00 00    	js     8030b8 <pipe+0x131>
+	va = fd2data(fd0);
+  802ffc:	83 ec 0c             	sub    $0xc,%esp
+  802fff:	ff 75 f4             	push   -0xc(%ebp)
+  803002:	e8 c6 e2 ff ff       	call   8012cd <fd2data>
+  803007:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803009:	83 c4 0c             	add    $0xc,%esp
+  80300c:	68 07 04 00 00       	push   $0x407
+  803011:	50                   	push   %eax
+  803012:	6a 00                	push   $0x0
+  803014:	e8 8e db ff ff       	call   800ba7 <sys_page_alloc>
+  803019:	89 c3                	mov    %eax,%ebx
+  80301b:	83 c4 10             	add    $0x10,%esp
+  80301e:	85 c0                	test   %eax,%eax
+  803020:	0f 88 82 00 00 00    	js     8030a8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803026:	83 ec 0c             	sub    $0xc,%esp
+  803029:	ff 75 f0             	push   -0x10(%ebp)
+  80302c:	e8 9c e2 ff ff       	call   8012cd <fd2data>
+  803031:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803038:	50                   	push   %eax
+  803039:	6a 00                	push   $0x0
+  80303b:	56                   	push   %esi
+  80303c:	6a 00                	push   $0x0
+  80303e:	e8 af db ff ff       	call   800bf2 <sys_page_map>
+  803043:	89 c3                	mov    %eax,%ebx
+  803045:	83 c4 20             	add    $0x20,%esp
+  803048:	85 c0                	test   %eax,%eax
+  80304a:	78 4e                	js     80309a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80304c:	a1 60 40 80 00       	mov    0x804060,%eax
+  803051:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803054:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803056:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803059:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803060:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803063:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803065:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803068:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80306f:	83 ec 0c             	sub    $0xc,%esp
+  803072:	ff 75 f4             	push   -0xc(%ebp)
+  803075:	e8 43 e2 ff ff       	call   8012bd <fd2num>
+  80307a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80307d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80307f:	83 c4 04             	add    $0x4,%esp
+  803082:	ff 75 f0             	push   -0x10(%ebp)
+  803085:	e8 33 e2 ff ff       	call   8012bd <fd2num>
+  80308a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80308d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803090:	83 c4 10             	add    $0x10,%esp
+  803093:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803098:	eb 2e                	jmp    8030c8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80309a:	83 ec 08             	sub    $0x8,%esp
+  80309d:	56                   	push   %esi
+  80309e:	6a 00                	push   $0x0
+  8030a0:	e8 8f db ff ff       	call   800c34 <sys_page_unmap>
+  8030a5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8030a8:	83 ec 08             	sub    $0x8,%esp
+  8030ab:	ff 75 f0             	push   -0x10(%ebp)
+  8030ae:	6a 00                	push   $0x0
+  8030b0:	e8 7f db ff ff       	call   800c34 <sys_page_unmap>
+  8030b5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8030b8:	83 ec 08             	sub    $0x8,%esp
+  8030bb:	ff 75 f4             	push   -0xc(%ebp)
+  8030be:	6a 00                	push   $0x0
+  8030c0:	e8 6f db ff ff       	call   800c34 <sys_page_unmap>
+  8030c5:	83 c4 10             	add    $0x10,%esp
+}
+  8030c8:	89 d8                	mov    %ebx,%eax
+  8030ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030cd:	5b                   	pop    %ebx
+  8030ce:	5e                   	pop    %esi
+  8030cf:	5d                   	pop    %ebp
+  8030d0:	c3                   	ret
+
+008030d1 <pipeisclosed>:
+{
+  8030d1:	55                   	push   %ebp
+  8030d2:	89 e5                	mov    %esp,%ebp
+  8030d4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8030d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030da:	50                   	push   %eax
+  8030db:	ff 75 08             	push   0x8(%ebp)
+  8030de:	e8 57 e2 ff ff       	call   80133a <fd_lookup>
+  8030e3:	83 c4 10             	add    $0x10,%esp
+  8030e6:	85 c0                	test   %eax,%eax
+  8030e8:	78 18                	js     803102 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8030ea:	83 ec 0c             	sub    $0xc,%esp
+  8030ed:	ff 75 f4             	push   -0xc(%ebp)
+  8030f0:	e8 d8 e1 ff ff       	call   8012cd <fd2data>
+  8030f5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8030f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030fa:	e8 33 fd ff ff       	call   802e32 <_pipeisclosed>
+  8030ff:	83 c4 10             	add    $0x10,%esp
+}
+  803102:	c9                   	leave
+  803103:	c3                   	ret
+
+00803104 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803104:	b8 00 00 00 00       	mov    $0x0,%eax
+  803109:	c3                   	ret
+
+0080310a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80310a:	55                   	push   %ebp
+  80310b:	89 e5                	mov    %esp,%ebp
+  80310d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803110:	68 a9 3d 80 00       	push   $0x803da9
+  803115:	ff 75 0c             	push   0xc(%ebp)
+  803118:	e8 7e d6 ff ff       	call   80079b <strcpy>
+	return 0;
+}
+  80311d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803122:	c9                   	leave
+  803123:	c3                   	ret
+
+00803124 <devcons_write>:
+{
+  803124:	55                   	push   %ebp
+  803125:	89 e5                	mov    %esp,%ebp
+  803127:	57                   	push   %edi
+  803128:	56                   	push   %esi
+  803129:	53                   	push   %ebx
+  80312a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803130:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803135:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80313b:	eb 2e                	jmp    80316b <devcons_write+0x47>
+		m = n - tot;
+  80313d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803140:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803142:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803147:	39 c3                	cmp    %eax,%ebx
+  803149:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80314c:	83 ec 04             	sub    $0x4,%esp
+  80314f:	53                   	push   %ebx
+  803150:	89 f0                	mov    %esi,%eax
+  803152:	03 45 0c             	add    0xc(%ebp),%eax
+  803155:	50                   	push   %eax
+  803156:	57                   	push   %edi
+  803157:	e8 c5 d7 ff ff       	call   800921 <memmove>
+		sys_cputs(buf, m);
+  80315c:	83 c4 08             	add    $0x8,%esp
+  80315f:	53                   	push   %ebx
+  803160:	57                   	push   %edi
+  803161:	e8 65 d9 ff ff       	call   800acb <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803166:	01 de                	add    %ebx,%esi
+  803168:	83 c4 10             	add    $0x10,%esp
+  80316b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80316e:	72 cd                	jb     80313d <devcons_write+0x19>
+}
+  803170:	89 f0                	mov    %esi,%eax
+  803172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803175:	5b                   	pop    %ebx
+  803176:	5e                   	pop    %esi
+  803177:	5f                   	pop    %edi
+  803178:	5d                   	pop    %ebp
+  803179:	c3                   	ret
+
+0080317a <devcons_read>:
+{
+  80317a:	55                   	push   %ebp
+  80317b:	89 e5                	mov    %esp,%ebp
+  80317d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803180:	b8 00 00 00 00       	mov    $0x0,%eax
+  803185:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803189:	75 07                	jne    803192 <devcons_read+0x18>
+  80318b:	eb 1f                	jmp    8031ac <devcons_read+0x32>
+		sys_yield();
+  80318d:	e8 f6 d9 ff ff       	call   800b88 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803192:	e8 5a d9 ff ff       	call   800af1 <sys_cgetc>
+  803197:	85 c0                	test   %eax,%eax
+  803199:	74 f2                	je     80318d <devcons_read+0x13>
+	if (c < 0)
+  80319b:	78 0f                	js     8031ac <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80319d:	83 f8 04             	cmp    $0x4,%eax
+  8031a0:	74 0c                	je     8031ae <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8031a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8031a5:	88 02                	mov    %al,(%edx)
+	return 1;
+  8031a7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8031ac:	c9                   	leave
+  8031ad:	c3                   	ret
+		return 0;
+  8031ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b3:	eb f7                	jmp    8031ac <devcons_read+0x32>
+
+008031b5 <cputchar>:
+{
+  8031b5:	55                   	push   %ebp
+  8031b6:	89 e5                	mov    %esp,%ebp
+  8031b8:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8031bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031be:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8031c1:	6a 01                	push   $0x1
+  8031c3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8031c6:	50                   	push   %eax
+  8031c7:	e8 ff d8 ff ff       	call   800acb <sys_cputs>
+}
+  8031cc:	83 c4 10             	add    $0x10,%esp
+  8031cf:	c9                   	leave
+  8031d0:	c3                   	ret
+
+008031d1 <getchar>:
+{
+  8031d1:	55                   	push   %ebp
+  8031d2:	89 e5                	mov    %esp,%ebp
+  8031d4:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8031d7:	6a 01                	push   $0x1
+  8031d9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8031dc:	50                   	push   %eax
+  8031dd:	6a 00                	push   $0x0
+  8031df:	e8 bc e3 ff ff       	call   8015a0 <read>
+	if (r < 0)
+  8031e4:	83 c4 10             	add    $0x10,%esp
+  8031e7:	85 c0                	test   %eax,%eax
+  8031e9:	78 06                	js     8031f1 <getchar+0x20>
+	if (r < 1)
+  8031eb:	74 06                	je     8031f3 <getchar+0x22>
+	return c;
+  8031ed:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8031f1:	c9                   	leave
+  8031f2:	c3                   	ret
+		return -E_EOF;
+  8031f3:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8031f8:	eb f7                	jmp    8031f1 <getchar+0x20>
+
+008031fa <iscons>:
+{
+  8031fa:	55                   	push   %ebp
+  8031fb:	89 e5                	mov    %esp,%ebp
+  8031fd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803200:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803203:	50                   	push   %eax
+  803204:	ff 75 08             	push   0x8(%ebp)
+  803207:	e8 2e e1 ff ff       	call   80133a <fd_lookup>
+  80320c:	83 c4 10             	add    $0x10,%esp
+  80320f:	85 c0                	test   %eax,%eax
+  803211:	78 11                	js     803224 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803213:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803216:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80321c:	39 10                	cmp    %edx,(%eax)
+  80321e:	0f 94 c0             	sete   %al
+  803221:	0f b6 c0             	movzbl %al,%eax
+}
+  803224:	c9                   	leave
+  803225:	c3                   	ret
+
+00803226 <opencons>:
+{
+  803226:	55                   	push   %ebp
+  803227:	89 e5                	mov    %esp,%ebp
+  803229:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80322c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80322f:	50                   	push   %eax
+  803230:	e8 af e0 ff ff       	call   8012e4 <fd_alloc>
+  803235:	83 c4 10             	add    $0x10,%esp
+  803238:	85 c0                	test   %eax,%eax
+  80323a:	78 3a                	js     803276 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80323c:	83 ec 04             	sub    $0x4,%esp
+  80323f:	68 07 04 00 00       	push   $0x407
+  803244:	ff 75 f4             	push   -0xc(%ebp)
+  803247:	6a 00                	push   $0x0
+  803249:	e8 59 d9 ff ff       	call   800ba7 <sys_page_alloc>
+  80324e:	83 c4 10             	add    $0x10,%esp
+  803251:	85 c0                	test   %eax,%eax
+  803253:	78 21                	js     803276 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803255:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803258:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80325e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803260:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803263:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80326a:	83 ec 0c             	sub    $0xc,%esp
+  80326d:	50                   	push   %eax
+  80326e:	e8 4a e0 ff ff       	call   8012bd <fd2num>
+  803273:	83 c4 10             	add    $0x10,%esp
+}
+  803276:	c9                   	leave
+  803277:	c3                   	ret
+
+00803278 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803278:	55                   	push   %ebp
+  803279:	89 e5                	mov    %esp,%ebp
+  80327b:	56                   	push   %esi
+  80327c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80327d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803280:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  803286:	e8 d6 d8 ff ff       	call   800b61 <sys_getenvid>
+  80328b:	83 ec 0c             	sub    $0xc,%esp
+  80328e:	ff 75 0c             	push   0xc(%ebp)
+  803291:	ff 75 08             	push   0x8(%ebp)
+  803294:	56                   	push   %esi
+  803295:	50                   	push   %eax
+  803296:	68 b8 3d 80 00       	push   $0x803db8
+  80329b:	e8 0d cf ff ff       	call   8001ad <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8032a0:	83 c4 18             	add    $0x18,%esp
+  8032a3:	53                   	push   %ebx
+  8032a4:	ff 75 10             	push   0x10(%ebp)
+  8032a7:	e8 b0 ce ff ff       	call   80015c <vcprintf>
+	cprintf("\n");
+  8032ac:	c7 04 24 54 38 80 00 	movl   $0x803854,(%esp)
+  8032b3:	e8 f5 ce ff ff       	call   8001ad <cprintf>
+  8032b8:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8032bb:	cc                   	int3
+	while (1)
+  8032bc:	eb fd                	jmp    8032bb <_panic+0x43>
+
+008032be <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8032be:	55                   	push   %ebp
+  8032bf:	89 e5                	mov    %esp,%ebp
+  8032c1:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8032c4:	83 3d 04 90 80 00 00 	cmpl   $0x0,0x809004
+  8032cb:	74 0a                	je     8032d7 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8032cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032d0:	a3 04 90 80 00       	mov    %eax,0x809004
+}
+  8032d5:	c9                   	leave
+  8032d6:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8032d7:	83 ec 04             	sub    $0x4,%esp
+  8032da:	6a 07                	push   $0x7
+  8032dc:	68 00 f0 bf ee       	push   $0xeebff000
+  8032e1:	6a 00                	push   $0x0
+  8032e3:	e8 bf d8 ff ff       	call   800ba7 <sys_page_alloc>
+  8032e8:	83 c4 10             	add    $0x10,%esp
+  8032eb:	85 c0                	test   %eax,%eax
+  8032ed:	75 2c                	jne    80331b <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8032ef:	83 ec 08             	sub    $0x8,%esp
+  8032f2:	68 31 33 80 00       	push   $0x803331
+  8032f7:	6a 00                	push   $0x0
+  8032f9:	e8 14 da ff ff       	call   800d12 <sys_env_set_pgfault_upcall>
+  8032fe:	83 c4 10             	add    $0x10,%esp
+  803301:	85 c0                	test   %eax,%eax
+  803303:	74 c8                	je     8032cd <set_pgfault_handler+0xf>
+  803305:	68 24 3e 80 00       	push   $0x803e24
+  80330a:	68 2c 3c 80 00       	push   $0x803c2c
+  80330f:	6a 20                	push   $0x20
+  803311:	68 54 3e 80 00       	push   $0x803e54
+  803316:	e8 5d ff ff ff       	call   803278 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80331b:	68 dc 3d 80 00       	push   $0x803ddc
+  803320:	68 2c 3c 80 00       	push   $0x803c2c
+  803325:	6a 1e                	push   $0x1e
+  803327:	68 54 3e 80 00       	push   $0x803e54
+  80332c:	e8 47 ff ff ff       	call   803278 <_panic>
+
+00803331 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803331:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803332:	a1 04 90 80 00       	mov    0x809004,%eax
+	call *%eax
+  803337:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803339:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80333c:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803341:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803346:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  80334a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80334d:	83 c4 08             	add    $0x8,%esp
+	popal
+  803350:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803351:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803354:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803355:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803356:	c3                   	ret
+
+00803357 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803357:	55                   	push   %ebp
+  803358:	89 e5                	mov    %esp,%ebp
+  80335a:	56                   	push   %esi
+  80335b:	53                   	push   %ebx
+  80335c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80335f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803362:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803365:	85 c0                	test   %eax,%eax
+  803367:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80336c:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80336f:	83 ec 0c             	sub    $0xc,%esp
+  803372:	50                   	push   %eax
+  803373:	e8 77 da ff ff       	call   800def <sys_ipc_recv>
+	if (from_env_store)
+  803378:	83 c4 10             	add    $0x10,%esp
+  80337b:	85 f6                	test   %esi,%esi
+  80337d:	74 14                	je     803393 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80337f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803384:	85 c0                	test   %eax,%eax
+  803386:	75 09                	jne    803391 <ipc_recv+0x3a>
+  803388:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80338e:	8b 52 74             	mov    0x74(%edx),%edx
+  803391:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803393:	85 db                	test   %ebx,%ebx
+  803395:	74 25                	je     8033bc <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803397:	85 c0                	test   %eax,%eax
+  803399:	74 0d                	je     8033a8 <ipc_recv+0x51>
+  80339b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8033a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033a4:	5b                   	pop    %ebx
+  8033a5:	5e                   	pop    %esi
+  8033a6:	5d                   	pop    %ebp
+  8033a7:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033a8:	a1 00 50 80 00       	mov    0x805000,%eax
+  8033ad:	8b 40 78             	mov    0x78(%eax),%eax
+  8033b0:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8033b2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8033b7:	8b 40 70             	mov    0x70(%eax),%eax
+  8033ba:	eb e5                	jmp    8033a1 <ipc_recv+0x4a>
+  8033bc:	85 c0                	test   %eax,%eax
+  8033be:	75 e1                	jne    8033a1 <ipc_recv+0x4a>
+  8033c0:	eb f0                	jmp    8033b2 <ipc_recv+0x5b>
+
+008033c2 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8033c2:	55                   	push   %ebp
+  8033c3:	89 e5                	mov    %esp,%ebp
+  8033c5:	57                   	push   %edi
+  8033c6:	56                   	push   %esi
+  8033c7:	53                   	push   %ebx
+  8033c8:	83 ec 0c             	sub    $0xc,%esp
+  8033cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033ce:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8033d4:	85 db                	test   %ebx,%ebx
+  8033d6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8033db:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8033de:	ff 75 14             	push   0x14(%ebp)
+  8033e1:	53                   	push   %ebx
+  8033e2:	56                   	push   %esi
+  8033e3:	57                   	push   %edi
+  8033e4:	e8 73 d9 ff ff       	call   800d5c <sys_ipc_try_send>
+  8033e9:	83 c4 10             	add    $0x10,%esp
+  8033ec:	85 c0                	test   %eax,%eax
+  8033ee:	74 22                	je     803412 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8033f0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033f3:	75 07                	jne    8033fc <ipc_send+0x3a>
+		sys_yield();
+  8033f5:	e8 8e d7 ff ff       	call   800b88 <sys_yield>
+  8033fa:	eb e2                	jmp    8033de <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8033fc:	68 62 3e 80 00       	push   $0x803e62
+  803401:	68 2c 3c 80 00       	push   $0x803c2c
+  803406:	6a 39                	push   $0x39
+  803408:	68 77 3e 80 00       	push   $0x803e77
+  80340d:	e8 66 fe ff ff       	call   803278 <_panic>
+	}
+}
+  803412:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803415:	5b                   	pop    %ebx
+  803416:	5e                   	pop    %esi
+  803417:	5f                   	pop    %edi
+  803418:	5d                   	pop    %ebp
+  803419:	c3                   	ret
+
+0080341a <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80341a:	55                   	push   %ebp
+  80341b:	89 e5                	mov    %esp,%ebp
+  80341d:	57                   	push   %edi
+  80341e:	56                   	push   %esi
+  80341f:	53                   	push   %ebx
+  803420:	83 ec 10             	sub    $0x10,%esp
+  803423:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803426:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803429:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80342c:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80342f:	85 c0                	test   %eax,%eax
+  803431:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803436:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803439:	6a 00                	push   $0x0
+  80343b:	ff 33                	push   (%ebx)
+  80343d:	50                   	push   %eax
+  80343e:	e8 69 d9 ff ff       	call   800dac <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803443:	83 c4 10             	add    $0x10,%esp
+  803446:	85 c0                	test   %eax,%eax
+  803448:	75 3c                	jne    803486 <ipc_recvv+0x6c>
+  80344a:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803450:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803453:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803455:	85 ff                	test   %edi,%edi
+  803457:	74 4e                	je     8034a7 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803459:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80345f:	8b 52 74             	mov    0x74(%edx),%edx
+  803462:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803464:	85 f6                	test   %esi,%esi
+  803466:	74 18                	je     803480 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803468:	85 c0                	test   %eax,%eax
+  80346a:	75 2d                	jne    803499 <ipc_recvv+0x7f>
+  80346c:	a1 00 50 80 00       	mov    0x805000,%eax
+  803471:	8b 40 78             	mov    0x78(%eax),%eax
+  803474:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803476:	a1 00 50 80 00       	mov    0x805000,%eax
+  80347b:	8b 40 70             	mov    0x70(%eax),%eax
+  80347e:	eb 1f                	jmp    80349f <ipc_recvv+0x85>
+  803480:	85 c0                	test   %eax,%eax
+  803482:	75 1b                	jne    80349f <ipc_recvv+0x85>
+  803484:	eb f0                	jmp    803476 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803486:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80348c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803491:	85 ff                	test   %edi,%edi
+  803493:	75 cd                	jne    803462 <ipc_recvv+0x48>
+	if (perm_store)
+  803495:	85 f6                	test   %esi,%esi
+  803497:	74 e7                	je     803480 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803499:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80349f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034a2:	5b                   	pop    %ebx
+  8034a3:	5e                   	pop    %esi
+  8034a4:	5f                   	pop    %edi
+  8034a5:	5d                   	pop    %ebp
+  8034a6:	c3                   	ret
+	if (perm_store)
+  8034a7:	85 f6                	test   %esi,%esi
+  8034a9:	75 bd                	jne    803468 <ipc_recvv+0x4e>
+  8034ab:	eb c9                	jmp    803476 <ipc_recvv+0x5c>
+
+008034ad <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8034ad:	55                   	push   %ebp
+  8034ae:	89 e5                	mov    %esp,%ebp
+  8034b0:	57                   	push   %edi
+  8034b1:	56                   	push   %esi
+  8034b2:	53                   	push   %ebx
+  8034b3:	83 ec 0c             	sub    $0xc,%esp
+  8034b6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8034b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8034bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8034bf:	ff 75 14             	push   0x14(%ebp)
+  8034c2:	53                   	push   %ebx
+  8034c3:	56                   	push   %esi
+  8034c4:	57                   	push   %edi
+  8034c5:	e8 ba d8 ff ff       	call   800d84 <sys_ipc_try_sendv>
+  8034ca:	83 c4 10             	add    $0x10,%esp
+  8034cd:	85 c0                	test   %eax,%eax
+  8034cf:	74 22                	je     8034f3 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8034d1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8034d4:	75 07                	jne    8034dd <ipc_sendv+0x30>
+		sys_yield();
+  8034d6:	e8 ad d6 ff ff       	call   800b88 <sys_yield>
+  8034db:	eb e2                	jmp    8034bf <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8034dd:	68 62 3e 80 00       	push   $0x803e62
+  8034e2:	68 2c 3c 80 00       	push   $0x803c2c
+  8034e7:	6a 5c                	push   $0x5c
+  8034e9:	68 77 3e 80 00       	push   $0x803e77
+  8034ee:	e8 85 fd ff ff       	call   803278 <_panic>
+	}
+}
+  8034f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034f6:	5b                   	pop    %ebx
+  8034f7:	5e                   	pop    %esi
+  8034f8:	5f                   	pop    %edi
+  8034f9:	5d                   	pop    %ebp
+  8034fa:	c3                   	ret
+
+008034fb <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8034fb:	55                   	push   %ebp
+  8034fc:	89 e5                	mov    %esp,%ebp
+  8034fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803501:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803506:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80350c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803512:	8b 52 50             	mov    0x50(%edx),%edx
+  803515:	39 ca                	cmp    %ecx,%edx
+  803517:	74 11                	je     80352a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803519:	83 c0 01             	add    $0x1,%eax
+  80351c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803521:	75 e3                	jne    803506 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803523:	b8 00 00 00 00       	mov    $0x0,%eax
+  803528:	eb 0e                	jmp    803538 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80352a:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803530:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803535:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803538:	5d                   	pop    %ebp
+  803539:	c3                   	ret
+
+0080353a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80353a:	55                   	push   %ebp
+  80353b:	89 e5                	mov    %esp,%ebp
+  80353d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803540:	89 c2                	mov    %eax,%edx
+  803542:	c1 ea 16             	shr    $0x16,%edx
+  803545:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80354c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803551:	f6 c1 01             	test   $0x1,%cl
+  803554:	74 22                	je     803578 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803556:	c1 e8 0c             	shr    $0xc,%eax
+  803559:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803560:	a8 01                	test   $0x1,%al
+  803562:	74 14                	je     803578 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803564:	c1 e8 0c             	shr    $0xc,%eax
+  803567:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80356a:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803571:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803575:	0f b7 d2             	movzwl %dx,%edx
+}
+  803578:	89 d0                	mov    %edx,%eax
+  80357a:	5d                   	pop    %ebp
+  80357b:	c3                   	ret
+
+0080357c <dm>:
+  80357c:	55                   	push   %ebp
+  80357d:	57                   	push   %edi
+  80357e:	56                   	push   %esi
+  80357f:	53                   	push   %ebx
+  803580:	83 ec 24             	sub    $0x24,%esp
+  803583:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803587:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80358b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80358f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803593:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803597:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80359b:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80359f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035ae:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035b5:	00 
+  8035b6:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035bd:	00 
+  8035be:	89 fb                	mov    %edi,%ebx
+  8035c0:	eb 08                	jmp    8035ca <dm+0x4e>
+  8035c2:	83 e9 01             	sub    $0x1,%ecx
+  8035c5:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8035c8:	74 68                	je     803632 <dm+0xb6>
+  8035ca:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8035ce:	01 c0                	add    %eax,%eax
+  8035d0:	89 c6                	mov    %eax,%esi
+  8035d2:	89 d7                	mov    %edx,%edi
+  8035d4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8035d8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8035dc:	0f ad d0             	shrd   %cl,%edx,%eax
+  8035df:	d3 ea                	shr    %cl,%edx
+  8035e1:	f6 c1 20             	test   $0x20,%cl
+  8035e4:	74 04                	je     8035ea <dm+0x6e>
+  8035e6:	89 d0                	mov    %edx,%eax
+  8035e8:	31 d2                	xor    %edx,%edx
+  8035ea:	83 e0 01             	and    $0x1,%eax
+  8035ed:	89 04 24             	mov    %eax,(%esp)
+  8035f0:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8035f7:	00 
+  8035f8:	8b 04 24             	mov    (%esp),%eax
+  8035fb:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8035ff:	09 f0                	or     %esi,%eax
+  803601:	09 fa                	or     %edi,%edx
+  803603:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803607:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80360b:	39 f0                	cmp    %esi,%eax
+  80360d:	89 d5                	mov    %edx,%ebp
+  80360f:	19 fd                	sbb    %edi,%ebp
+  803611:	72 af                	jb     8035c2 <dm+0x46>
+  803613:	29 f0                	sub    %esi,%eax
+  803615:	19 fa                	sbb    %edi,%edx
+  803617:	89 cf                	mov    %ecx,%edi
+  803619:	c1 ef 05             	shr    $0x5,%edi
+  80361c:	83 e7 01             	and    $0x1,%edi
+  80361f:	89 fe                	mov    %edi,%esi
+  803621:	83 f6 01             	xor    $0x1,%esi
+  803624:	d3 e6                	shl    %cl,%esi
+  803626:	d3 e7                	shl    %cl,%edi
+  803628:	09 74 24 18          	or     %esi,0x18(%esp)
+  80362c:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803630:	eb 90                	jmp    8035c2 <dm+0x46>
+  803632:	85 db                	test   %ebx,%ebx
+  803634:	74 05                	je     80363b <dm+0xbf>
+  803636:	89 03                	mov    %eax,(%ebx)
+  803638:	89 53 04             	mov    %edx,0x4(%ebx)
+  80363b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80363f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803643:	83 c4 24             	add    $0x24,%esp
+  803646:	5b                   	pop    %ebx
+  803647:	5e                   	pop    %esi
+  803648:	5f                   	pop    %edi
+  803649:	5d                   	pop    %ebp
+  80364a:	c3                   	ret
+
+0080364b <__udivdi3>:
+  80364b:	83 ec 08             	sub    $0x8,%esp
+  80364e:	6a 00                	push   $0x0
+  803650:	ff 74 24 1c          	push   0x1c(%esp)
+  803654:	ff 74 24 1c          	push   0x1c(%esp)
+  803658:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80365c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803660:	e8 17 ff ff ff       	call   80357c <dm>
+  803665:	83 c4 14             	add    $0x14,%esp
+  803668:	c3                   	ret
+
+00803669 <__umoddi3>:
+  803669:	83 ec 18             	sub    $0x18,%esp
+  80366c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803670:	50                   	push   %eax
+  803671:	ff 74 24 2c          	push   0x2c(%esp)
+  803675:	ff 74 24 2c          	push   0x2c(%esp)
+  803679:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80367d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803681:	e8 f6 fe ff ff       	call   80357c <dm>
+  803686:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80368a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80368e:	83 c4 24             	add    $0x24,%esp
+  803691:	c3                   	ret
+
+00803692 <__divdi3>:
+  803692:	53                   	push   %ebx
+  803693:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803697:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80369b:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80369f:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036a3:	85 d2                	test   %edx,%edx
+  8036a5:	78 15                	js     8036bc <__divdi3+0x2a>
+  8036a7:	85 db                	test   %ebx,%ebx
+  8036a9:	78 34                	js     8036df <__divdi3+0x4d>
+  8036ab:	83 ec 04             	sub    $0x4,%esp
+  8036ae:	6a 00                	push   $0x0
+  8036b0:	53                   	push   %ebx
+  8036b1:	51                   	push   %ecx
+  8036b2:	e8 c5 fe ff ff       	call   80357c <dm>
+  8036b7:	83 c4 10             	add    $0x10,%esp
+  8036ba:	eb 21                	jmp    8036dd <__divdi3+0x4b>
+  8036bc:	f7 d8                	neg    %eax
+  8036be:	83 d2 00             	adc    $0x0,%edx
+  8036c1:	f7 da                	neg    %edx
+  8036c3:	85 db                	test   %ebx,%ebx
+  8036c5:	78 30                	js     8036f7 <__divdi3+0x65>
+  8036c7:	83 ec 04             	sub    $0x4,%esp
+  8036ca:	6a 00                	push   $0x0
+  8036cc:	53                   	push   %ebx
+  8036cd:	51                   	push   %ecx
+  8036ce:	e8 a9 fe ff ff       	call   80357c <dm>
+  8036d3:	83 c4 10             	add    $0x10,%esp
+  8036d6:	f7 d8                	neg    %eax
+  8036d8:	83 d2 00             	adc    $0x0,%edx
+  8036db:	f7 da                	neg    %edx
+  8036dd:	5b                   	pop    %ebx
+  8036de:	c3                   	ret
+  8036df:	83 ec 04             	sub    $0x4,%esp
+  8036e2:	6a 00                	push   $0x0
+  8036e4:	f7 d9                	neg    %ecx
+  8036e6:	83 d3 00             	adc    $0x0,%ebx
+  8036e9:	f7 db                	neg    %ebx
+  8036eb:	53                   	push   %ebx
+  8036ec:	51                   	push   %ecx
+  8036ed:	e8 8a fe ff ff       	call   80357c <dm>
+  8036f2:	83 c4 10             	add    $0x10,%esp
+  8036f5:	eb df                	jmp    8036d6 <__divdi3+0x44>
+  8036f7:	83 ec 04             	sub    $0x4,%esp
+  8036fa:	6a 00                	push   $0x0
+  8036fc:	f7 d9                	neg    %ecx
+  8036fe:	83 d3 00             	adc    $0x0,%ebx
+  803701:	f7 db                	neg    %ebx
+  803703:	53                   	push   %ebx
+  803704:	51                   	push   %ecx
+  803705:	e8 72 fe ff ff       	call   80357c <dm>
+  80370a:	83 c4 10             	add    $0x10,%esp
+  80370d:	eb ce                	jmp    8036dd <__divdi3+0x4b>
+
+0080370f <__moddi3>:
+  80370f:	55                   	push   %ebp
+  803710:	57                   	push   %edi
+  803711:	56                   	push   %esi
+  803712:	53                   	push   %ebx
+  803713:	83 ec 24             	sub    $0x24,%esp
+  803716:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80371a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80371e:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803722:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803726:	85 d2                	test   %edx,%edx
+  803728:	78 3b                	js     803765 <__moddi3+0x56>
+  80372a:	83 ec 04             	sub    $0x4,%esp
+  80372d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803731:	56                   	push   %esi
+  803732:	89 ce                	mov    %ecx,%esi
+  803734:	f7 de                	neg    %esi
+  803736:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80373a:	89 de                	mov    %ebx,%esi
+  80373c:	83 d6 00             	adc    $0x0,%esi
+  80373f:	f7 de                	neg    %esi
+  803741:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803745:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803749:	0f 48 f1             	cmovs  %ecx,%esi
+  80374c:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803751:	53                   	push   %ebx
+  803752:	56                   	push   %esi
+  803753:	e8 24 fe ff ff       	call   80357c <dm>
+  803758:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80375c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803760:	83 c4 10             	add    $0x10,%esp
+  803763:	eb 47                	jmp    8037ac <__moddi3+0x9d>
+  803765:	f7 d8                	neg    %eax
+  803767:	83 d2 00             	adc    $0x0,%edx
+  80376a:	f7 da                	neg    %edx
+  80376c:	83 ec 04             	sub    $0x4,%esp
+  80376f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803773:	56                   	push   %esi
+  803774:	89 cf                	mov    %ecx,%edi
+  803776:	f7 df                	neg    %edi
+  803778:	89 de                	mov    %ebx,%esi
+  80377a:	83 d6 00             	adc    $0x0,%esi
+  80377d:	f7 de                	neg    %esi
+  80377f:	0f 49 cf             	cmovns %edi,%ecx
+  803782:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803786:	0f 49 de             	cmovns %esi,%ebx
+  803789:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80378d:	ff 74 24 0c          	push   0xc(%esp)
+  803791:	ff 74 24 0c          	push   0xc(%esp)
+  803795:	e8 e2 fd ff ff       	call   80357c <dm>
+  80379a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80379e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037a2:	f7 d8                	neg    %eax
+  8037a4:	83 d2 00             	adc    $0x0,%edx
+  8037a7:	f7 da                	neg    %edx
+  8037a9:	83 c4 10             	add    $0x10,%esp
+  8037ac:	83 c4 24             	add    $0x24,%esp
+  8037af:	5b                   	pop    %ebx
+  8037b0:	5e                   	pop    %esi
+  8037b1:	5f                   	pop    %edi
+  8037b2:	5d                   	pop    %ebp
+  8037b3:	c3                   	ret
@@ -0,0 +1,7714 @@
+
+obj/user/stresssched.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b9 00 00 00       	call   8000ea <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+volatile int counter;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	int i, j;
+	int seen;
+	envid_t parent = sys_getenvid();
+  800038:	e8 9f 0b 00 00       	call   800bdc <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+
+	// Fork several environments
+	for (i = 0; i < 20; i++)
+  80003f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fork() == 0)
+  800044:	e8 34 11 00 00       	call   80117d <fork>
+  800049:	85 c0                	test   %eax,%eax
+  80004b:	74 0f                	je     80005c <umain+0x29>
+	for (i = 0; i < 20; i++)
+  80004d:	83 c3 01             	add    $0x1,%ebx
+  800050:	83 fb 14             	cmp    $0x14,%ebx
+  800053:	75 ef                	jne    800044 <umain+0x11>
+			break;
+	if (i == 20) {
+		sys_yield();
+  800055:	e8 a9 0b 00 00       	call   800c03 <sys_yield>
+		return;
+  80005a:	eb 70                	jmp    8000cc <umain+0x99>
+	}
+
+	// Wait for the parent to finish forking
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  80005c:	89 f0                	mov    %esi,%eax
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800069:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80006e:	eb 02                	jmp    800072 <umain+0x3f>
+		asm volatile("pause");
+  800070:	f3 90                	pause
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  800072:	8b 50 54             	mov    0x54(%eax),%edx
+  800075:	85 d2                	test   %edx,%edx
+  800077:	75 f7                	jne    800070 <umain+0x3d>
+  800079:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  80007e:	eb 12                	jmp    800092 <umain+0x5f>
+
+	// Check that one environment doesn't run on two CPUs at once
+	for (i = 0; i < 10; i++) {
+		sys_yield();
+		for (j = 0; j < 10000; j++)
+			counter++;
+  800080:	a1 00 50 80 00       	mov    0x805000,%eax
+  800085:	83 c0 01             	add    $0x1,%eax
+  800088:	a3 00 50 80 00       	mov    %eax,0x805000
+		for (j = 0; j < 10000; j++)
+  80008d:	83 ea 01             	sub    $0x1,%edx
+  800090:	75 ee                	jne    800080 <umain+0x4d>
+	for (i = 0; i < 10; i++) {
+  800092:	83 eb 01             	sub    $0x1,%ebx
+  800095:	74 0c                	je     8000a3 <umain+0x70>
+		sys_yield();
+  800097:	e8 67 0b 00 00       	call   800c03 <sys_yield>
+		for (j = 0; j < 10000; j++)
+  80009c:	ba 11 27 00 00       	mov    $0x2711,%edx
+  8000a1:	eb ea                	jmp    80008d <umain+0x5a>
+	}
+
+	if (counter != 10*10000)
+  8000a3:	a1 00 50 80 00       	mov    0x805000,%eax
+  8000a8:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  8000ad:	75 24                	jne    8000d3 <umain+0xa0>
+		panic("ran on two CPUs at once (counter is %d)", counter);
+
+	// Check that we see environments running on different CPUs
+	cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+  8000af:	a1 04 50 80 00       	mov    0x805004,%eax
+  8000b4:	8b 50 5c             	mov    0x5c(%eax),%edx
+  8000b7:	8b 40 48             	mov    0x48(%eax),%eax
+  8000ba:	83 ec 04             	sub    $0x4,%esp
+  8000bd:	52                   	push   %edx
+  8000be:	50                   	push   %eax
+  8000bf:	68 3b 38 80 00       	push   $0x80383b
+  8000c4:	e8 5f 01 00 00       	call   800228 <cprintf>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+
+}
+  8000cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000cf:	5b                   	pop    %ebx
+  8000d0:	5e                   	pop    %esi
+  8000d1:	5d                   	pop    %ebp
+  8000d2:	c3                   	ret
+		panic("ran on two CPUs at once (counter is %d)", counter);
+  8000d3:	a1 00 50 80 00       	mov    0x805000,%eax
+  8000d8:	50                   	push   %eax
+  8000d9:	68 00 38 80 00       	push   $0x803800
+  8000de:	6a 21                	push   $0x21
+  8000e0:	68 28 38 80 00       	push   $0x803828
+  8000e5:	e8 63 00 00 00       	call   80014d <_panic>
+
+008000ea <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000ea:	55                   	push   %ebp
+  8000eb:	89 e5                	mov    %esp,%ebp
+  8000ed:	56                   	push   %esi
+  8000ee:	53                   	push   %ebx
+  8000ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000f2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000f5:	e8 e2 0a 00 00       	call   800bdc <sys_getenvid>
+  8000fa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000ff:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800105:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80010a:	a3 04 50 80 00       	mov    %eax,0x805004
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80010f:	85 db                	test   %ebx,%ebx
+  800111:	7e 07                	jle    80011a <libmain+0x30>
+		binaryname = argv[0];
+  800113:	8b 06                	mov    (%esi),%eax
+  800115:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80011a:	83 ec 08             	sub    $0x8,%esp
+  80011d:	56                   	push   %esi
+  80011e:	53                   	push   %ebx
+  80011f:	e8 0f ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800124:	e8 0a 00 00 00       	call   800133 <exit>
+}
+  800129:	83 c4 10             	add    $0x10,%esp
+  80012c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80012f:	5b                   	pop    %ebx
+  800130:	5e                   	pop    %esi
+  800131:	5d                   	pop    %ebp
+  800132:	c3                   	ret
+
+00800133 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800133:	55                   	push   %ebp
+  800134:	89 e5                	mov    %esp,%ebp
+  800136:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800139:	e8 ce 13 00 00       	call   80150c <close_all>
+	sys_env_destroy(0);
+  80013e:	83 ec 0c             	sub    $0xc,%esp
+  800141:	6a 00                	push   $0x0
+  800143:	e8 4b 0a 00 00       	call   800b93 <sys_env_destroy>
+}
+  800148:	83 c4 10             	add    $0x10,%esp
+  80014b:	c9                   	leave
+  80014c:	c3                   	ret
+
+0080014d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80014d:	55                   	push   %ebp
+  80014e:	89 e5                	mov    %esp,%ebp
+  800150:	56                   	push   %esi
+  800151:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800152:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800155:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80015b:	e8 7c 0a 00 00       	call   800bdc <sys_getenvid>
+  800160:	83 ec 0c             	sub    $0xc,%esp
+  800163:	ff 75 0c             	push   0xc(%ebp)
+  800166:	ff 75 08             	push   0x8(%ebp)
+  800169:	56                   	push   %esi
+  80016a:	50                   	push   %eax
+  80016b:	68 64 38 80 00       	push   $0x803864
+  800170:	e8 b3 00 00 00       	call   800228 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800175:	83 c4 18             	add    $0x18,%esp
+  800178:	53                   	push   %ebx
+  800179:	ff 75 10             	push   0x10(%ebp)
+  80017c:	e8 56 00 00 00       	call   8001d7 <vcprintf>
+	cprintf("\n");
+  800181:	c7 04 24 57 38 80 00 	movl   $0x803857,(%esp)
+  800188:	e8 9b 00 00 00       	call   800228 <cprintf>
+  80018d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800190:	cc                   	int3
+	while (1)
+  800191:	eb fd                	jmp    800190 <_panic+0x43>
+
+00800193 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800193:	55                   	push   %ebp
+  800194:	89 e5                	mov    %esp,%ebp
+  800196:	53                   	push   %ebx
+  800197:	83 ec 04             	sub    $0x4,%esp
+  80019a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80019d:	8b 13                	mov    (%ebx),%edx
+  80019f:	8d 42 01             	lea    0x1(%edx),%eax
+  8001a2:	89 03                	mov    %eax,(%ebx)
+  8001a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001a7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001ab:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001b0:	74 09                	je     8001bb <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001b2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001b9:	c9                   	leave
+  8001ba:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001bb:	83 ec 08             	sub    $0x8,%esp
+  8001be:	68 ff 00 00 00       	push   $0xff
+  8001c3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001c6:	50                   	push   %eax
+  8001c7:	e8 7a 09 00 00       	call   800b46 <sys_cputs>
+		b->idx = 0;
+  8001cc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001d2:	83 c4 10             	add    $0x10,%esp
+  8001d5:	eb db                	jmp    8001b2 <putch+0x1f>
+
+008001d7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001e0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001e7:	00 00 00 
+	b.cnt = 0;
+  8001ea:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001f1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001f4:	ff 75 0c             	push   0xc(%ebp)
+  8001f7:	ff 75 08             	push   0x8(%ebp)
+  8001fa:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800200:	50                   	push   %eax
+  800201:	68 93 01 80 00       	push   $0x800193
+  800206:	e8 14 01 00 00       	call   80031f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80020b:	83 c4 08             	add    $0x8,%esp
+  80020e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800214:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80021a:	50                   	push   %eax
+  80021b:	e8 26 09 00 00       	call   800b46 <sys_cputs>
+
+	return b.cnt;
+}
+  800220:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800226:	c9                   	leave
+  800227:	c3                   	ret
+
+00800228 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800228:	55                   	push   %ebp
+  800229:	89 e5                	mov    %esp,%ebp
+  80022b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80022e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800231:	50                   	push   %eax
+  800232:	ff 75 08             	push   0x8(%ebp)
+  800235:	e8 9d ff ff ff       	call   8001d7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	57                   	push   %edi
+  800240:	56                   	push   %esi
+  800241:	53                   	push   %ebx
+  800242:	83 ec 1c             	sub    $0x1c,%esp
+  800245:	89 c7                	mov    %eax,%edi
+  800247:	89 d6                	mov    %edx,%esi
+  800249:	8b 45 08             	mov    0x8(%ebp),%eax
+  80024c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80024f:	89 d1                	mov    %edx,%ecx
+  800251:	89 c2                	mov    %eax,%edx
+  800253:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800256:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800259:	8b 45 10             	mov    0x10(%ebp),%eax
+  80025c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80025f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800262:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800269:	39 c2                	cmp    %eax,%edx
+  80026b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80026e:	72 3e                	jb     8002ae <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800270:	83 ec 0c             	sub    $0xc,%esp
+  800273:	ff 75 18             	push   0x18(%ebp)
+  800276:	83 eb 01             	sub    $0x1,%ebx
+  800279:	53                   	push   %ebx
+  80027a:	50                   	push   %eax
+  80027b:	83 ec 08             	sub    $0x8,%esp
+  80027e:	ff 75 e4             	push   -0x1c(%ebp)
+  800281:	ff 75 e0             	push   -0x20(%ebp)
+  800284:	ff 75 dc             	push   -0x24(%ebp)
+  800287:	ff 75 d8             	push   -0x28(%ebp)
+  80028a:	e8 f1 33 00 00       	call   803680 <__udivdi3>
+  80028f:	83 c4 18             	add    $0x18,%esp
+  800292:	52                   	push   %edx
+  800293:	50                   	push   %eax
+  800294:	89 f2                	mov    %esi,%edx
+  800296:	89 f8                	mov    %edi,%eax
+  800298:	e8 9f ff ff ff       	call   80023c <printnum>
+  80029d:	83 c4 20             	add    $0x20,%esp
+  8002a0:	eb 13                	jmp    8002b5 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002a2:	83 ec 08             	sub    $0x8,%esp
+  8002a5:	56                   	push   %esi
+  8002a6:	ff 75 18             	push   0x18(%ebp)
+  8002a9:	ff d7                	call   *%edi
+  8002ab:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002ae:	83 eb 01             	sub    $0x1,%ebx
+  8002b1:	85 db                	test   %ebx,%ebx
+  8002b3:	7f ed                	jg     8002a2 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002b5:	83 ec 08             	sub    $0x8,%esp
+  8002b8:	56                   	push   %esi
+  8002b9:	83 ec 04             	sub    $0x4,%esp
+  8002bc:	ff 75 e4             	push   -0x1c(%ebp)
+  8002bf:	ff 75 e0             	push   -0x20(%ebp)
+  8002c2:	ff 75 dc             	push   -0x24(%ebp)
+  8002c5:	ff 75 d8             	push   -0x28(%ebp)
+  8002c8:	e8 d1 33 00 00       	call   80369e <__umoddi3>
+  8002cd:	83 c4 14             	add    $0x14,%esp
+  8002d0:	0f be 80 87 38 80 00 	movsbl 0x803887(%eax),%eax
+  8002d7:	50                   	push   %eax
+  8002d8:	ff d7                	call   *%edi
+}
+  8002da:	83 c4 10             	add    $0x10,%esp
+  8002dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e0:	5b                   	pop    %ebx
+  8002e1:	5e                   	pop    %esi
+  8002e2:	5f                   	pop    %edi
+  8002e3:	5d                   	pop    %ebp
+  8002e4:	c3                   	ret
+
+008002e5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002e5:	55                   	push   %ebp
+  8002e6:	89 e5                	mov    %esp,%ebp
+  8002e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002eb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002ef:	8b 10                	mov    (%eax),%edx
+  8002f1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002f4:	73 0a                	jae    800300 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002f6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002f9:	89 08                	mov    %ecx,(%eax)
+  8002fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002fe:	88 02                	mov    %al,(%edx)
+}
+  800300:	5d                   	pop    %ebp
+  800301:	c3                   	ret
+
+00800302 <printfmt>:
+{
+  800302:	55                   	push   %ebp
+  800303:	89 e5                	mov    %esp,%ebp
+  800305:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800308:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80030b:	50                   	push   %eax
+  80030c:	ff 75 10             	push   0x10(%ebp)
+  80030f:	ff 75 0c             	push   0xc(%ebp)
+  800312:	ff 75 08             	push   0x8(%ebp)
+  800315:	e8 05 00 00 00       	call   80031f <vprintfmt>
+}
+  80031a:	83 c4 10             	add    $0x10,%esp
+  80031d:	c9                   	leave
+  80031e:	c3                   	ret
+
+0080031f <vprintfmt>:
+{
+  80031f:	55                   	push   %ebp
+  800320:	89 e5                	mov    %esp,%ebp
+  800322:	57                   	push   %edi
+  800323:	56                   	push   %esi
+  800324:	53                   	push   %ebx
+  800325:	83 ec 2c             	sub    $0x2c,%esp
+  800328:	8b 75 08             	mov    0x8(%ebp),%esi
+  80032b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80032e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800331:	eb 0a                	jmp    80033d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800333:	83 ec 08             	sub    $0x8,%esp
+  800336:	53                   	push   %ebx
+  800337:	50                   	push   %eax
+  800338:	ff d6                	call   *%esi
+  80033a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80033d:	83 c7 01             	add    $0x1,%edi
+  800340:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800344:	83 f8 25             	cmp    $0x25,%eax
+  800347:	74 0c                	je     800355 <vprintfmt+0x36>
+			if (ch == '\0')
+  800349:	85 c0                	test   %eax,%eax
+  80034b:	75 e6                	jne    800333 <vprintfmt+0x14>
+}
+  80034d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800350:	5b                   	pop    %ebx
+  800351:	5e                   	pop    %esi
+  800352:	5f                   	pop    %edi
+  800353:	5d                   	pop    %ebp
+  800354:	c3                   	ret
+		padc = ' ';
+  800355:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800359:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800360:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800367:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80036e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800373:	8d 47 01             	lea    0x1(%edi),%eax
+  800376:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800379:	0f b6 17             	movzbl (%edi),%edx
+  80037c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80037f:	3c 55                	cmp    $0x55,%al
+  800381:	0f 87 cf 03 00 00    	ja     800756 <vprintfmt+0x437>
+  800387:	0f b6 c0             	movzbl %al,%eax
+  80038a:	ff 24 85 e0 39 80 00 	jmp    *0x8039e0(,%eax,4)
+  800391:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800394:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800398:	eb d9                	jmp    800373 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80039a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80039d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003a1:	eb d0                	jmp    800373 <vprintfmt+0x54>
+  8003a3:	0f b6 d2             	movzbl %dl,%edx
+  8003a6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ae:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003b1:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003b4:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003b8:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003bb:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003be:	83 f9 09             	cmp    $0x9,%ecx
+  8003c1:	77 55                	ja     800418 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003c3:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003c6:	eb e9                	jmp    8003b1 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cb:	8b 00                	mov    (%eax),%eax
+  8003cd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8003d6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003dc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003e0:	79 91                	jns    800373 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003e2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003e8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003ef:	eb 82                	jmp    800373 <vprintfmt+0x54>
+			if (width < 0)
+  8003f1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003f4:	85 d2                	test   %edx,%edx
+  8003f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003fb:	0f 49 c2             	cmovns %edx,%eax
+  8003fe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800401:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800404:	e9 6a ff ff ff       	jmp    800373 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800409:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80040c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800413:	e9 5b ff ff ff       	jmp    800373 <vprintfmt+0x54>
+  800418:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80041b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80041e:	eb bc                	jmp    8003dc <vprintfmt+0xbd>
+			lflag++;
+  800420:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800423:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800426:	e9 48 ff ff ff       	jmp    800373 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80042b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042e:	8d 78 04             	lea    0x4(%eax),%edi
+  800431:	83 ec 08             	sub    $0x8,%esp
+  800434:	53                   	push   %ebx
+  800435:	ff 30                	push   (%eax)
+  800437:	ff d6                	call   *%esi
+			break;
+  800439:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80043c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80043f:	e9 b1 02 00 00       	jmp    8006f5 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800444:	8b 45 14             	mov    0x14(%ebp),%eax
+  800447:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80044a:	8b 10                	mov    (%eax),%edx
+  80044c:	89 d0                	mov    %edx,%eax
+  80044e:	f7 d8                	neg    %eax
+  800450:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800453:	83 f8 11             	cmp    $0x11,%eax
+  800456:	7f 23                	jg     80047b <vprintfmt+0x15c>
+  800458:	8b 14 85 40 3b 80 00 	mov    0x803b40(,%eax,4),%edx
+  80045f:	85 d2                	test   %edx,%edx
+  800461:	74 18                	je     80047b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800463:	52                   	push   %edx
+  800464:	68 5e 3c 80 00       	push   $0x803c5e
+  800469:	53                   	push   %ebx
+  80046a:	56                   	push   %esi
+  80046b:	e8 92 fe ff ff       	call   800302 <printfmt>
+  800470:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800473:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800476:	e9 7a 02 00 00       	jmp    8006f5 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80047b:	50                   	push   %eax
+  80047c:	68 9f 38 80 00       	push   $0x80389f
+  800481:	53                   	push   %ebx
+  800482:	56                   	push   %esi
+  800483:	e8 7a fe ff ff       	call   800302 <printfmt>
+  800488:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80048b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80048e:	e9 62 02 00 00       	jmp    8006f5 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800493:	8b 45 14             	mov    0x14(%ebp),%eax
+  800496:	83 c0 04             	add    $0x4,%eax
+  800499:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80049c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004a1:	85 c9                	test   %ecx,%ecx
+  8004a3:	b8 98 38 80 00       	mov    $0x803898,%eax
+  8004a8:	0f 45 c1             	cmovne %ecx,%eax
+  8004ab:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004ae:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004b2:	7e 06                	jle    8004ba <vprintfmt+0x19b>
+  8004b4:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004b8:	75 0b                	jne    8004c5 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ba:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004bd:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004c0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004c3:	eb 5c                	jmp    800521 <vprintfmt+0x202>
+  8004c5:	83 ec 08             	sub    $0x8,%esp
+  8004c8:	ff 75 d0             	push   -0x30(%ebp)
+  8004cb:	ff 75 cc             	push   -0x34(%ebp)
+  8004ce:	e8 20 03 00 00       	call   8007f3 <strnlen>
+  8004d3:	89 c2                	mov    %eax,%edx
+  8004d5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d8:	29 d0                	sub    %edx,%eax
+  8004da:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004dd:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004e7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e9:	eb 0e                	jmp    8004f9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004eb:	83 ec 08             	sub    $0x8,%esp
+  8004ee:	53                   	push   %ebx
+  8004ef:	57                   	push   %edi
+  8004f0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f3:	83 ee 01             	sub    $0x1,%esi
+  8004f6:	83 c4 10             	add    $0x10,%esp
+  8004f9:	85 f6                	test   %esi,%esi
+  8004fb:	7f ee                	jg     8004eb <vprintfmt+0x1cc>
+  8004fd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800500:	8b 75 08             	mov    0x8(%ebp),%esi
+  800503:	85 c0                	test   %eax,%eax
+  800505:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050a:	0f 49 d0             	cmovns %eax,%edx
+  80050d:	29 d0                	sub    %edx,%eax
+  80050f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800512:	eb a6                	jmp    8004ba <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800514:	83 ec 08             	sub    $0x8,%esp
+  800517:	53                   	push   %ebx
+  800518:	52                   	push   %edx
+  800519:	ff 55 08             	call   *0x8(%ebp)
+  80051c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80051f:	89 f1                	mov    %esi,%ecx
+  800521:	8d 71 01             	lea    0x1(%ecx),%esi
+  800524:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800528:	0f be d0             	movsbl %al,%edx
+  80052b:	85 d2                	test   %edx,%edx
+  80052d:	74 28                	je     800557 <vprintfmt+0x238>
+  80052f:	85 ff                	test   %edi,%edi
+  800531:	78 05                	js     800538 <vprintfmt+0x219>
+  800533:	83 ef 01             	sub    $0x1,%edi
+  800536:	78 30                	js     800568 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800538:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80053c:	74 d6                	je     800514 <vprintfmt+0x1f5>
+  80053e:	0f be c0             	movsbl %al,%eax
+  800541:	83 e8 20             	sub    $0x20,%eax
+  800544:	83 f8 5e             	cmp    $0x5e,%eax
+  800547:	76 cb                	jbe    800514 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800549:	83 ec 08             	sub    $0x8,%esp
+  80054c:	53                   	push   %ebx
+  80054d:	6a 3f                	push   $0x3f
+  80054f:	ff 55 08             	call   *0x8(%ebp)
+  800552:	83 c4 10             	add    $0x10,%esp
+  800555:	eb c8                	jmp    80051f <vprintfmt+0x200>
+  800557:	8b 75 08             	mov    0x8(%ebp),%esi
+  80055a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80055d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800560:	01 d0                	add    %edx,%eax
+  800562:	29 c8                	sub    %ecx,%eax
+  800564:	89 c7                	mov    %eax,%edi
+  800566:	eb 13                	jmp    80057b <vprintfmt+0x25c>
+  800568:	8b 75 08             	mov    0x8(%ebp),%esi
+  80056b:	eb ed                	jmp    80055a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80056d:	83 ec 08             	sub    $0x8,%esp
+  800570:	53                   	push   %ebx
+  800571:	6a 20                	push   $0x20
+  800573:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800575:	83 ef 01             	sub    $0x1,%edi
+  800578:	83 c4 10             	add    $0x10,%esp
+  80057b:	85 ff                	test   %edi,%edi
+  80057d:	7f ee                	jg     80056d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80057f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800582:	89 45 14             	mov    %eax,0x14(%ebp)
+  800585:	e9 6b 01 00 00       	jmp    8006f5 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80058a:	83 f9 01             	cmp    $0x1,%ecx
+  80058d:	7f 1f                	jg     8005ae <vprintfmt+0x28f>
+	else if (lflag)
+  80058f:	85 c9                	test   %ecx,%ecx
+  800591:	74 67                	je     8005fa <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800593:	8b 45 14             	mov    0x14(%ebp),%eax
+  800596:	8b 00                	mov    (%eax),%eax
+  800598:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80059b:	89 c1                	mov    %eax,%ecx
+  80059d:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005a0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ac:	eb 17                	jmp    8005c5 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b1:	8b 50 04             	mov    0x4(%eax),%edx
+  8005b4:	8b 00                	mov    (%eax),%eax
+  8005b6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bf:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005c5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005d0:	85 c9                	test   %ecx,%ecx
+  8005d2:	0f 89 03 01 00 00    	jns    8006db <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005d8:	83 ec 08             	sub    $0x8,%esp
+  8005db:	53                   	push   %ebx
+  8005dc:	6a 2d                	push   $0x2d
+  8005de:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005e0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005e3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005e6:	f7 da                	neg    %edx
+  8005e8:	83 d1 00             	adc    $0x0,%ecx
+  8005eb:	f7 d9                	neg    %ecx
+  8005ed:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005f0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005f5:	e9 e1 00 00 00       	jmp    8006db <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fd:	8b 00                	mov    (%eax),%eax
+  8005ff:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800602:	89 c1                	mov    %eax,%ecx
+  800604:	c1 f9 1f             	sar    $0x1f,%ecx
+  800607:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80060a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060d:	8d 40 04             	lea    0x4(%eax),%eax
+  800610:	89 45 14             	mov    %eax,0x14(%ebp)
+  800613:	eb b0                	jmp    8005c5 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800615:	83 f9 01             	cmp    $0x1,%ecx
+  800618:	7f 1e                	jg     800638 <vprintfmt+0x319>
+	else if (lflag)
+  80061a:	85 c9                	test   %ecx,%ecx
+  80061c:	74 32                	je     800650 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80061e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800621:	8b 10                	mov    (%eax),%edx
+  800623:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800628:	8d 40 04             	lea    0x4(%eax),%eax
+  80062b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80062e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800633:	e9 a3 00 00 00       	jmp    8006db <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800638:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063b:	8b 10                	mov    (%eax),%edx
+  80063d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800640:	8d 40 08             	lea    0x8(%eax),%eax
+  800643:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800646:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80064b:	e9 8b 00 00 00       	jmp    8006db <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800650:	8b 45 14             	mov    0x14(%ebp),%eax
+  800653:	8b 10                	mov    (%eax),%edx
+  800655:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065a:	8d 40 04             	lea    0x4(%eax),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800660:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800665:	eb 74                	jmp    8006db <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800667:	83 f9 01             	cmp    $0x1,%ecx
+  80066a:	7f 1b                	jg     800687 <vprintfmt+0x368>
+	else if (lflag)
+  80066c:	85 c9                	test   %ecx,%ecx
+  80066e:	74 2c                	je     80069c <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800670:	8b 45 14             	mov    0x14(%ebp),%eax
+  800673:	8b 10                	mov    (%eax),%edx
+  800675:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067a:	8d 40 04             	lea    0x4(%eax),%eax
+  80067d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800680:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800685:	eb 54                	jmp    8006db <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800687:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068a:	8b 10                	mov    (%eax),%edx
+  80068c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80068f:	8d 40 08             	lea    0x8(%eax),%eax
+  800692:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800695:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80069a:	eb 3f                	jmp    8006db <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8b 10                	mov    (%eax),%edx
+  8006a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ac:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006b1:	eb 28                	jmp    8006db <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006b3:	83 ec 08             	sub    $0x8,%esp
+  8006b6:	53                   	push   %ebx
+  8006b7:	6a 30                	push   $0x30
+  8006b9:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006bb:	83 c4 08             	add    $0x8,%esp
+  8006be:	53                   	push   %ebx
+  8006bf:	6a 78                	push   $0x78
+  8006c1:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c6:	8b 10                	mov    (%eax),%edx
+  8006c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006cd:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006d0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d6:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006db:	83 ec 0c             	sub    $0xc,%esp
+  8006de:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006e2:	50                   	push   %eax
+  8006e3:	ff 75 e0             	push   -0x20(%ebp)
+  8006e6:	57                   	push   %edi
+  8006e7:	51                   	push   %ecx
+  8006e8:	52                   	push   %edx
+  8006e9:	89 da                	mov    %ebx,%edx
+  8006eb:	89 f0                	mov    %esi,%eax
+  8006ed:	e8 4a fb ff ff       	call   80023c <printnum>
+			break;
+  8006f2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006f5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006f8:	e9 40 fc ff ff       	jmp    80033d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006fd:	83 f9 01             	cmp    $0x1,%ecx
+  800700:	7f 1b                	jg     80071d <vprintfmt+0x3fe>
+	else if (lflag)
+  800702:	85 c9                	test   %ecx,%ecx
+  800704:	74 2c                	je     800732 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800706:	8b 45 14             	mov    0x14(%ebp),%eax
+  800709:	8b 10                	mov    (%eax),%edx
+  80070b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800710:	8d 40 04             	lea    0x4(%eax),%eax
+  800713:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800716:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80071b:	eb be                	jmp    8006db <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80071d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800720:	8b 10                	mov    (%eax),%edx
+  800722:	8b 48 04             	mov    0x4(%eax),%ecx
+  800725:	8d 40 08             	lea    0x8(%eax),%eax
+  800728:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80072b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800730:	eb a9                	jmp    8006db <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800732:	8b 45 14             	mov    0x14(%ebp),%eax
+  800735:	8b 10                	mov    (%eax),%edx
+  800737:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073c:	8d 40 04             	lea    0x4(%eax),%eax
+  80073f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800742:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800747:	eb 92                	jmp    8006db <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800749:	83 ec 08             	sub    $0x8,%esp
+  80074c:	53                   	push   %ebx
+  80074d:	6a 25                	push   $0x25
+  80074f:	ff d6                	call   *%esi
+			break;
+  800751:	83 c4 10             	add    $0x10,%esp
+  800754:	eb 9f                	jmp    8006f5 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800756:	83 ec 08             	sub    $0x8,%esp
+  800759:	53                   	push   %ebx
+  80075a:	6a 25                	push   $0x25
+  80075c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80075e:	83 c4 10             	add    $0x10,%esp
+  800761:	89 f8                	mov    %edi,%eax
+  800763:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800767:	74 05                	je     80076e <vprintfmt+0x44f>
+  800769:	83 e8 01             	sub    $0x1,%eax
+  80076c:	eb f5                	jmp    800763 <vprintfmt+0x444>
+  80076e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800771:	eb 82                	jmp    8006f5 <vprintfmt+0x3d6>
+
+00800773 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800773:	55                   	push   %ebp
+  800774:	89 e5                	mov    %esp,%ebp
+  800776:	83 ec 18             	sub    $0x18,%esp
+  800779:	8b 45 08             	mov    0x8(%ebp),%eax
+  80077c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80077f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800782:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800786:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800789:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800790:	85 c0                	test   %eax,%eax
+  800792:	74 26                	je     8007ba <vsnprintf+0x47>
+  800794:	85 d2                	test   %edx,%edx
+  800796:	7e 22                	jle    8007ba <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800798:	ff 75 14             	push   0x14(%ebp)
+  80079b:	ff 75 10             	push   0x10(%ebp)
+  80079e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007a1:	50                   	push   %eax
+  8007a2:	68 e5 02 80 00       	push   $0x8002e5
+  8007a7:	e8 73 fb ff ff       	call   80031f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007ac:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007af:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007b5:	83 c4 10             	add    $0x10,%esp
+}
+  8007b8:	c9                   	leave
+  8007b9:	c3                   	ret
+		return -E_INVAL;
+  8007ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007bf:	eb f7                	jmp    8007b8 <vsnprintf+0x45>
+
+008007c1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007c1:	55                   	push   %ebp
+  8007c2:	89 e5                	mov    %esp,%ebp
+  8007c4:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007c7:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007ca:	50                   	push   %eax
+  8007cb:	ff 75 10             	push   0x10(%ebp)
+  8007ce:	ff 75 0c             	push   0xc(%ebp)
+  8007d1:	ff 75 08             	push   0x8(%ebp)
+  8007d4:	e8 9a ff ff ff       	call   800773 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007d9:	c9                   	leave
+  8007da:	c3                   	ret
+
+008007db <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007db:	55                   	push   %ebp
+  8007dc:	89 e5                	mov    %esp,%ebp
+  8007de:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e6:	eb 03                	jmp    8007eb <strlen+0x10>
+		n++;
+  8007e8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007eb:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007ef:	75 f7                	jne    8007e8 <strlen+0xd>
+	return n;
+}
+  8007f1:	5d                   	pop    %ebp
+  8007f2:	c3                   	ret
+
+008007f3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007f3:	55                   	push   %ebp
+  8007f4:	89 e5                	mov    %esp,%ebp
+  8007f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800801:	eb 03                	jmp    800806 <strnlen+0x13>
+		n++;
+  800803:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800806:	39 d0                	cmp    %edx,%eax
+  800808:	74 08                	je     800812 <strnlen+0x1f>
+  80080a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80080e:	75 f3                	jne    800803 <strnlen+0x10>
+  800810:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800812:	89 d0                	mov    %edx,%eax
+  800814:	5d                   	pop    %ebp
+  800815:	c3                   	ret
+
+00800816 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800816:	55                   	push   %ebp
+  800817:	89 e5                	mov    %esp,%ebp
+  800819:	53                   	push   %ebx
+  80081a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80081d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800820:	b8 00 00 00 00       	mov    $0x0,%eax
+  800825:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800829:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80082c:	83 c0 01             	add    $0x1,%eax
+  80082f:	84 d2                	test   %dl,%dl
+  800831:	75 f2                	jne    800825 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800833:	89 c8                	mov    %ecx,%eax
+  800835:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800838:	c9                   	leave
+  800839:	c3                   	ret
+
+0080083a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80083a:	55                   	push   %ebp
+  80083b:	89 e5                	mov    %esp,%ebp
+  80083d:	53                   	push   %ebx
+  80083e:	83 ec 10             	sub    $0x10,%esp
+  800841:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800844:	53                   	push   %ebx
+  800845:	e8 91 ff ff ff       	call   8007db <strlen>
+  80084a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80084d:	ff 75 0c             	push   0xc(%ebp)
+  800850:	01 d8                	add    %ebx,%eax
+  800852:	50                   	push   %eax
+  800853:	e8 be ff ff ff       	call   800816 <strcpy>
+	return dst;
+}
+  800858:	89 d8                	mov    %ebx,%eax
+  80085a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80085d:	c9                   	leave
+  80085e:	c3                   	ret
+
+0080085f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80085f:	55                   	push   %ebp
+  800860:	89 e5                	mov    %esp,%ebp
+  800862:	56                   	push   %esi
+  800863:	53                   	push   %ebx
+  800864:	8b 75 08             	mov    0x8(%ebp),%esi
+  800867:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80086a:	89 f3                	mov    %esi,%ebx
+  80086c:	03 5d 10             	add    0x10(%ebp),%ebx
+  80086f:	89 f0                	mov    %esi,%eax
+  800871:	eb 0f                	jmp    800882 <strncpy+0x23>
+		*dst++ = *src;
+  800873:	83 c0 01             	add    $0x1,%eax
+  800876:	0f b6 0a             	movzbl (%edx),%ecx
+  800879:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80087c:	80 f9 01             	cmp    $0x1,%cl
+  80087f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800882:	39 d8                	cmp    %ebx,%eax
+  800884:	75 ed                	jne    800873 <strncpy+0x14>
+	}
+	return ret;
+}
+  800886:	89 f0                	mov    %esi,%eax
+  800888:	5b                   	pop    %ebx
+  800889:	5e                   	pop    %esi
+  80088a:	5d                   	pop    %ebp
+  80088b:	c3                   	ret
+
+0080088c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80088c:	55                   	push   %ebp
+  80088d:	89 e5                	mov    %esp,%ebp
+  80088f:	56                   	push   %esi
+  800890:	53                   	push   %ebx
+  800891:	8b 75 08             	mov    0x8(%ebp),%esi
+  800894:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800897:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80089a:	89 f0                	mov    %esi,%eax
+  80089c:	85 d2                	test   %edx,%edx
+  80089e:	74 21                	je     8008c1 <strlcpy+0x35>
+  8008a0:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008a4:	89 f2                	mov    %esi,%edx
+  8008a6:	eb 09                	jmp    8008b1 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008a8:	83 c1 01             	add    $0x1,%ecx
+  8008ab:	83 c2 01             	add    $0x1,%edx
+  8008ae:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008b1:	39 c2                	cmp    %eax,%edx
+  8008b3:	74 09                	je     8008be <strlcpy+0x32>
+  8008b5:	0f b6 19             	movzbl (%ecx),%ebx
+  8008b8:	84 db                	test   %bl,%bl
+  8008ba:	75 ec                	jne    8008a8 <strlcpy+0x1c>
+  8008bc:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008be:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008c1:	29 f0                	sub    %esi,%eax
+}
+  8008c3:	5b                   	pop    %ebx
+  8008c4:	5e                   	pop    %esi
+  8008c5:	5d                   	pop    %ebp
+  8008c6:	c3                   	ret
+
+008008c7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008c7:	55                   	push   %ebp
+  8008c8:	89 e5                	mov    %esp,%ebp
+  8008ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008d0:	eb 06                	jmp    8008d8 <strcmp+0x11>
+		p++, q++;
+  8008d2:	83 c1 01             	add    $0x1,%ecx
+  8008d5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008d8:	0f b6 01             	movzbl (%ecx),%eax
+  8008db:	84 c0                	test   %al,%al
+  8008dd:	74 04                	je     8008e3 <strcmp+0x1c>
+  8008df:	3a 02                	cmp    (%edx),%al
+  8008e1:	74 ef                	je     8008d2 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008e3:	0f b6 c0             	movzbl %al,%eax
+  8008e6:	0f b6 12             	movzbl (%edx),%edx
+  8008e9:	29 d0                	sub    %edx,%eax
+}
+  8008eb:	5d                   	pop    %ebp
+  8008ec:	c3                   	ret
+
+008008ed <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008ed:	55                   	push   %ebp
+  8008ee:	89 e5                	mov    %esp,%ebp
+  8008f0:	53                   	push   %ebx
+  8008f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008f7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008fa:	eb 09                	jmp    800905 <strncmp+0x18>
+		n--, p++, q++;
+  8008fc:	83 ea 01             	sub    $0x1,%edx
+  8008ff:	83 c0 01             	add    $0x1,%eax
+  800902:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800905:	85 d2                	test   %edx,%edx
+  800907:	74 18                	je     800921 <strncmp+0x34>
+  800909:	0f b6 18             	movzbl (%eax),%ebx
+  80090c:	84 db                	test   %bl,%bl
+  80090e:	74 04                	je     800914 <strncmp+0x27>
+  800910:	3a 19                	cmp    (%ecx),%bl
+  800912:	74 e8                	je     8008fc <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800914:	0f b6 00             	movzbl (%eax),%eax
+  800917:	0f b6 11             	movzbl (%ecx),%edx
+  80091a:	29 d0                	sub    %edx,%eax
+}
+  80091c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80091f:	c9                   	leave
+  800920:	c3                   	ret
+		return 0;
+  800921:	b8 00 00 00 00       	mov    $0x0,%eax
+  800926:	eb f4                	jmp    80091c <strncmp+0x2f>
+
+00800928 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800928:	55                   	push   %ebp
+  800929:	89 e5                	mov    %esp,%ebp
+  80092b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800932:	eb 03                	jmp    800937 <strchr+0xf>
+  800934:	83 c0 01             	add    $0x1,%eax
+  800937:	0f b6 10             	movzbl (%eax),%edx
+  80093a:	84 d2                	test   %dl,%dl
+  80093c:	74 06                	je     800944 <strchr+0x1c>
+		if (*s == c)
+  80093e:	38 ca                	cmp    %cl,%dl
+  800940:	75 f2                	jne    800934 <strchr+0xc>
+  800942:	eb 05                	jmp    800949 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800944:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800949:	5d                   	pop    %ebp
+  80094a:	c3                   	ret
+
+0080094b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80094b:	55                   	push   %ebp
+  80094c:	89 e5                	mov    %esp,%ebp
+  80094e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800951:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800955:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800958:	38 ca                	cmp    %cl,%dl
+  80095a:	74 09                	je     800965 <strfind+0x1a>
+  80095c:	84 d2                	test   %dl,%dl
+  80095e:	74 05                	je     800965 <strfind+0x1a>
+	for (; *s; s++)
+  800960:	83 c0 01             	add    $0x1,%eax
+  800963:	eb f0                	jmp    800955 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800965:	5d                   	pop    %ebp
+  800966:	c3                   	ret
+
+00800967 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800967:	55                   	push   %ebp
+  800968:	89 e5                	mov    %esp,%ebp
+  80096a:	57                   	push   %edi
+  80096b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80096e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800971:	85 c9                	test   %ecx,%ecx
+  800973:	74 20                	je     800995 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800975:	89 f8                	mov    %edi,%eax
+  800977:	09 c8                	or     %ecx,%eax
+  800979:	a8 03                	test   $0x3,%al
+  80097b:	75 12                	jne    80098f <memset+0x28>
+		c &= 0xFF;
+  80097d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800981:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800987:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80098a:	fc                   	cld
+  80098b:	f3 ab                	rep stos %eax,%es:(%edi)
+  80098d:	eb 06                	jmp    800995 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80098f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800992:	fc                   	cld
+  800993:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800995:	89 f8                	mov    %edi,%eax
+  800997:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80099a:	c9                   	leave
+  80099b:	c3                   	ret
+
+0080099c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80099c:	55                   	push   %ebp
+  80099d:	89 e5                	mov    %esp,%ebp
+  80099f:	57                   	push   %edi
+  8009a0:	56                   	push   %esi
+  8009a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009aa:	39 c6                	cmp    %eax,%esi
+  8009ac:	73 32                	jae    8009e0 <memmove+0x44>
+  8009ae:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009b1:	39 d0                	cmp    %edx,%eax
+  8009b3:	73 2b                	jae    8009e0 <memmove+0x44>
+		s += n;
+		d += n;
+  8009b5:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009b8:	89 d6                	mov    %edx,%esi
+  8009ba:	09 fe                	or     %edi,%esi
+  8009bc:	09 ce                	or     %ecx,%esi
+  8009be:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009c4:	75 0e                	jne    8009d4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009c6:	83 ef 04             	sub    $0x4,%edi
+  8009c9:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009cc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009cf:	fd                   	std
+  8009d0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009d2:	eb 09                	jmp    8009dd <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009d4:	83 ef 01             	sub    $0x1,%edi
+  8009d7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009da:	fd                   	std
+  8009db:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009dd:	fc                   	cld
+  8009de:	eb 1a                	jmp    8009fa <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009e0:	89 f2                	mov    %esi,%edx
+  8009e2:	09 c2                	or     %eax,%edx
+  8009e4:	09 ca                	or     %ecx,%edx
+  8009e6:	f6 c2 03             	test   $0x3,%dl
+  8009e9:	75 0a                	jne    8009f5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009eb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009ee:	89 c7                	mov    %eax,%edi
+  8009f0:	fc                   	cld
+  8009f1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009f3:	eb 05                	jmp    8009fa <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009f5:	89 c7                	mov    %eax,%edi
+  8009f7:	fc                   	cld
+  8009f8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009fa:	5e                   	pop    %esi
+  8009fb:	5f                   	pop    %edi
+  8009fc:	5d                   	pop    %ebp
+  8009fd:	c3                   	ret
+
+008009fe <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009fe:	55                   	push   %ebp
+  8009ff:	89 e5                	mov    %esp,%ebp
+  800a01:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a04:	ff 75 10             	push   0x10(%ebp)
+  800a07:	ff 75 0c             	push   0xc(%ebp)
+  800a0a:	ff 75 08             	push   0x8(%ebp)
+  800a0d:	e8 8a ff ff ff       	call   80099c <memmove>
+}
+  800a12:	c9                   	leave
+  800a13:	c3                   	ret
+
+00800a14 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a14:	55                   	push   %ebp
+  800a15:	89 e5                	mov    %esp,%ebp
+  800a17:	56                   	push   %esi
+  800a18:	53                   	push   %ebx
+  800a19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a1f:	89 c6                	mov    %eax,%esi
+  800a21:	03 75 10             	add    0x10(%ebp),%esi
+  800a24:	eb 06                	jmp    800a2c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a26:	83 c0 01             	add    $0x1,%eax
+  800a29:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a2c:	39 f0                	cmp    %esi,%eax
+  800a2e:	74 14                	je     800a44 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a30:	0f b6 08             	movzbl (%eax),%ecx
+  800a33:	0f b6 1a             	movzbl (%edx),%ebx
+  800a36:	38 d9                	cmp    %bl,%cl
+  800a38:	74 ec                	je     800a26 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a3a:	0f b6 c1             	movzbl %cl,%eax
+  800a3d:	0f b6 db             	movzbl %bl,%ebx
+  800a40:	29 d8                	sub    %ebx,%eax
+  800a42:	eb 05                	jmp    800a49 <memcmp+0x35>
+	}
+
+	return 0;
+  800a44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a49:	5b                   	pop    %ebx
+  800a4a:	5e                   	pop    %esi
+  800a4b:	5d                   	pop    %ebp
+  800a4c:	c3                   	ret
+
+00800a4d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a4d:	55                   	push   %ebp
+  800a4e:	89 e5                	mov    %esp,%ebp
+  800a50:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a56:	89 c2                	mov    %eax,%edx
+  800a58:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a5b:	eb 03                	jmp    800a60 <memfind+0x13>
+  800a5d:	83 c0 01             	add    $0x1,%eax
+  800a60:	39 d0                	cmp    %edx,%eax
+  800a62:	73 04                	jae    800a68 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a64:	38 08                	cmp    %cl,(%eax)
+  800a66:	75 f5                	jne    800a5d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a68:	5d                   	pop    %ebp
+  800a69:	c3                   	ret
+
+00800a6a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a6a:	55                   	push   %ebp
+  800a6b:	89 e5                	mov    %esp,%ebp
+  800a6d:	57                   	push   %edi
+  800a6e:	56                   	push   %esi
+  800a6f:	53                   	push   %ebx
+  800a70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a76:	eb 03                	jmp    800a7b <strtol+0x11>
+		s++;
+  800a78:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a7b:	0f b6 02             	movzbl (%edx),%eax
+  800a7e:	3c 20                	cmp    $0x20,%al
+  800a80:	74 f6                	je     800a78 <strtol+0xe>
+  800a82:	3c 09                	cmp    $0x9,%al
+  800a84:	74 f2                	je     800a78 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a86:	3c 2b                	cmp    $0x2b,%al
+  800a88:	74 2a                	je     800ab4 <strtol+0x4a>
+	int neg = 0;
+  800a8a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a8f:	3c 2d                	cmp    $0x2d,%al
+  800a91:	74 2b                	je     800abe <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a93:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a99:	75 0f                	jne    800aaa <strtol+0x40>
+  800a9b:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a9e:	74 28                	je     800ac8 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800aa0:	85 db                	test   %ebx,%ebx
+  800aa2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aa7:	0f 44 d8             	cmove  %eax,%ebx
+  800aaa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aaf:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ab2:	eb 46                	jmp    800afa <strtol+0x90>
+		s++;
+  800ab4:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ab7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800abc:	eb d5                	jmp    800a93 <strtol+0x29>
+		s++, neg = 1;
+  800abe:	83 c2 01             	add    $0x1,%edx
+  800ac1:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ac6:	eb cb                	jmp    800a93 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ac8:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800acc:	74 0e                	je     800adc <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ace:	85 db                	test   %ebx,%ebx
+  800ad0:	75 d8                	jne    800aaa <strtol+0x40>
+		s++, base = 8;
+  800ad2:	83 c2 01             	add    $0x1,%edx
+  800ad5:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ada:	eb ce                	jmp    800aaa <strtol+0x40>
+		s += 2, base = 16;
+  800adc:	83 c2 02             	add    $0x2,%edx
+  800adf:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ae4:	eb c4                	jmp    800aaa <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ae6:	0f be c0             	movsbl %al,%eax
+  800ae9:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800aec:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800aef:	7d 3a                	jge    800b2b <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800af1:	83 c2 01             	add    $0x1,%edx
+  800af4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800af8:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800afa:	0f b6 02             	movzbl (%edx),%eax
+  800afd:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b00:	89 f3                	mov    %esi,%ebx
+  800b02:	80 fb 09             	cmp    $0x9,%bl
+  800b05:	76 df                	jbe    800ae6 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b07:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b0a:	89 f3                	mov    %esi,%ebx
+  800b0c:	80 fb 19             	cmp    $0x19,%bl
+  800b0f:	77 08                	ja     800b19 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b11:	0f be c0             	movsbl %al,%eax
+  800b14:	83 e8 57             	sub    $0x57,%eax
+  800b17:	eb d3                	jmp    800aec <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b19:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b1c:	89 f3                	mov    %esi,%ebx
+  800b1e:	80 fb 19             	cmp    $0x19,%bl
+  800b21:	77 08                	ja     800b2b <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b23:	0f be c0             	movsbl %al,%eax
+  800b26:	83 e8 37             	sub    $0x37,%eax
+  800b29:	eb c1                	jmp    800aec <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b2b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b2f:	74 05                	je     800b36 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b34:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b36:	89 c8                	mov    %ecx,%eax
+  800b38:	f7 d8                	neg    %eax
+  800b3a:	85 ff                	test   %edi,%edi
+  800b3c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b3f:	89 c8                	mov    %ecx,%eax
+  800b41:	5b                   	pop    %ebx
+  800b42:	5e                   	pop    %esi
+  800b43:	5f                   	pop    %edi
+  800b44:	5d                   	pop    %ebp
+  800b45:	c3                   	ret
+
+00800b46 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b46:	55                   	push   %ebp
+  800b47:	89 e5                	mov    %esp,%ebp
+  800b49:	57                   	push   %edi
+  800b4a:	56                   	push   %esi
+  800b4b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b57:	89 c3                	mov    %eax,%ebx
+  800b59:	89 c7                	mov    %eax,%edi
+  800b5b:	55                   	push   %ebp
+  800b5c:	89 e5                	mov    %esp,%ebp
+  800b5e:	8d 35 66 0b 80 00    	lea    0x800b66,%esi
+  800b64:	0f 34                	sysenter
+  800b66:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800b67:	5b                   	pop    %ebx
+  800b68:	5e                   	pop    %esi
+  800b69:	5f                   	pop    %edi
+  800b6a:	5d                   	pop    %ebp
+  800b6b:	c3                   	ret
+
+00800b6c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b6c:	55                   	push   %ebp
+  800b6d:	89 e5                	mov    %esp,%ebp
+  800b6f:	57                   	push   %edi
+  800b70:	56                   	push   %esi
+  800b71:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b72:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b77:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b7c:	89 d1                	mov    %edx,%ecx
+  800b7e:	89 d3                	mov    %edx,%ebx
+  800b80:	89 d7                	mov    %edx,%edi
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	8d 35 8d 0b 80 00    	lea    0x800b8d,%esi
+  800b8b:	0f 34                	sysenter
+  800b8d:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800b8e:	5b                   	pop    %ebx
+  800b8f:	5e                   	pop    %esi
+  800b90:	5f                   	pop    %edi
+  800b91:	5d                   	pop    %ebp
+  800b92:	c3                   	ret
+
+00800b93 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b93:	55                   	push   %ebp
+  800b94:	89 e5                	mov    %esp,%ebp
+  800b96:	57                   	push   %edi
+  800b97:	56                   	push   %esi
+  800b98:	53                   	push   %ebx
+  800b99:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ba9:	89 cb                	mov    %ecx,%ebx
+  800bab:	89 cf                	mov    %ecx,%edi
+  800bad:	55                   	push   %ebp
+  800bae:	89 e5                	mov    %esp,%ebp
+  800bb0:	8d 35 b8 0b 80 00    	lea    0x800bb8,%esi
+  800bb6:	0f 34                	sysenter
+  800bb8:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bb9:	85 c0                	test   %eax,%eax
+  800bbb:	7f 08                	jg     800bc5 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800bbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc0:	5b                   	pop    %ebx
+  800bc1:	5e                   	pop    %esi
+  800bc2:	5f                   	pop    %edi
+  800bc3:	5d                   	pop    %ebp
+  800bc4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bc5:	83 ec 0c             	sub    $0xc,%esp
+  800bc8:	50                   	push   %eax
+  800bc9:	6a 03                	push   $0x3
+  800bcb:	68 a7 3b 80 00       	push   $0x803ba7
+  800bd0:	6a 3d                	push   $0x3d
+  800bd2:	68 c4 3b 80 00       	push   $0x803bc4
+  800bd7:	e8 71 f5 ff ff       	call   80014d <_panic>
+
+00800bdc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bdc:	55                   	push   %ebp
+  800bdd:	89 e5                	mov    %esp,%ebp
+  800bdf:	57                   	push   %edi
+  800be0:	56                   	push   %esi
+  800be1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800be2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800be7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bec:	89 d1                	mov    %edx,%ecx
+  800bee:	89 d3                	mov    %edx,%ebx
+  800bf0:	89 d7                	mov    %edx,%edi
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	8d 35 fd 0b 80 00    	lea    0x800bfd,%esi
+  800bfb:	0f 34                	sysenter
+  800bfd:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800bfe:	5b                   	pop    %ebx
+  800bff:	5e                   	pop    %esi
+  800c00:	5f                   	pop    %edi
+  800c01:	5d                   	pop    %ebp
+  800c02:	c3                   	ret
+
+00800c03 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c03:	55                   	push   %ebp
+  800c04:	89 e5                	mov    %esp,%ebp
+  800c06:	57                   	push   %edi
+  800c07:	56                   	push   %esi
+  800c08:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c09:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c13:	89 d1                	mov    %edx,%ecx
+  800c15:	89 d3                	mov    %edx,%ebx
+  800c17:	89 d7                	mov    %edx,%edi
+  800c19:	89 d6                	mov    %edx,%esi
+  800c1b:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c1d:	5b                   	pop    %ebx
+  800c1e:	5e                   	pop    %esi
+  800c1f:	5f                   	pop    %edi
+  800c20:	5d                   	pop    %ebp
+  800c21:	c3                   	ret
+
+00800c22 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c22:	55                   	push   %ebp
+  800c23:	89 e5                	mov    %esp,%ebp
+  800c25:	57                   	push   %edi
+  800c26:	56                   	push   %esi
+  800c27:	53                   	push   %ebx
+  800c28:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c31:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c36:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c3e:	55                   	push   %ebp
+  800c3f:	89 e5                	mov    %esp,%ebp
+  800c41:	8d 35 49 0c 80 00    	lea    0x800c49,%esi
+  800c47:	0f 34                	sysenter
+  800c49:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c4a:	85 c0                	test   %eax,%eax
+  800c4c:	7f 08                	jg     800c56 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800c4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c51:	5b                   	pop    %ebx
+  800c52:	5e                   	pop    %esi
+  800c53:	5f                   	pop    %edi
+  800c54:	5d                   	pop    %ebp
+  800c55:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c56:	83 ec 0c             	sub    $0xc,%esp
+  800c59:	50                   	push   %eax
+  800c5a:	6a 04                	push   $0x4
+  800c5c:	68 a7 3b 80 00       	push   $0x803ba7
+  800c61:	6a 3d                	push   $0x3d
+  800c63:	68 c4 3b 80 00       	push   $0x803bc4
+  800c68:	e8 e0 f4 ff ff       	call   80014d <_panic>
+
+00800c6d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c6d:	55                   	push   %ebp
+  800c6e:	89 e5                	mov    %esp,%ebp
+  800c70:	57                   	push   %edi
+  800c71:	56                   	push   %esi
+  800c72:	53                   	push   %ebx
+  800c73:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c7c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c84:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c87:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c8a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c8c:	85 c0                	test   %eax,%eax
+  800c8e:	7f 08                	jg     800c98 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c93:	5b                   	pop    %ebx
+  800c94:	5e                   	pop    %esi
+  800c95:	5f                   	pop    %edi
+  800c96:	5d                   	pop    %ebp
+  800c97:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c98:	83 ec 0c             	sub    $0xc,%esp
+  800c9b:	50                   	push   %eax
+  800c9c:	6a 05                	push   $0x5
+  800c9e:	68 a7 3b 80 00       	push   $0x803ba7
+  800ca3:	6a 23                	push   $0x23
+  800ca5:	68 c4 3b 80 00       	push   $0x803bc4
+  800caa:	e8 9e f4 ff ff       	call   80014d <_panic>
+
+00800caf <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800caf:	55                   	push   %ebp
+  800cb0:	89 e5                	mov    %esp,%ebp
+  800cb2:	57                   	push   %edi
+  800cb3:	56                   	push   %esi
+  800cb4:	53                   	push   %ebx
+  800cb5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc3:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cc8:	89 df                	mov    %ebx,%edi
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	8d 35 d5 0c 80 00    	lea    0x800cd5,%esi
+  800cd3:	0f 34                	sysenter
+  800cd5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cd6:	85 c0                	test   %eax,%eax
+  800cd8:	7f 08                	jg     800ce2 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800cda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdd:	5b                   	pop    %ebx
+  800cde:	5e                   	pop    %esi
+  800cdf:	5f                   	pop    %edi
+  800ce0:	5d                   	pop    %ebp
+  800ce1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce2:	83 ec 0c             	sub    $0xc,%esp
+  800ce5:	50                   	push   %eax
+  800ce6:	6a 06                	push   $0x6
+  800ce8:	68 a7 3b 80 00       	push   $0x803ba7
+  800ced:	6a 3d                	push   $0x3d
+  800cef:	68 c4 3b 80 00       	push   $0x803bc4
+  800cf4:	e8 54 f4 ff ff       	call   80014d <_panic>
+
+00800cf9 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800cf9:	55                   	push   %ebp
+  800cfa:	89 e5                	mov    %esp,%ebp
+  800cfc:	57                   	push   %edi
+  800cfd:	56                   	push   %esi
+  800cfe:	53                   	push   %ebx
+  800cff:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d12:	89 df                	mov    %ebx,%edi
+  800d14:	55                   	push   %ebp
+  800d15:	89 e5                	mov    %esp,%ebp
+  800d17:	8d 35 1f 0d 80 00    	lea    0x800d1f,%esi
+  800d1d:	0f 34                	sysenter
+  800d1f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d20:	85 c0                	test   %eax,%eax
+  800d22:	7f 08                	jg     800d2c <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800d24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d27:	5b                   	pop    %ebx
+  800d28:	5e                   	pop    %esi
+  800d29:	5f                   	pop    %edi
+  800d2a:	5d                   	pop    %ebp
+  800d2b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d2c:	83 ec 0c             	sub    $0xc,%esp
+  800d2f:	50                   	push   %eax
+  800d30:	6a 08                	push   $0x8
+  800d32:	68 a7 3b 80 00       	push   $0x803ba7
+  800d37:	6a 3d                	push   $0x3d
+  800d39:	68 c4 3b 80 00       	push   $0x803bc4
+  800d3e:	e8 0a f4 ff ff       	call   80014d <_panic>
+
+00800d43 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d43:	55                   	push   %ebp
+  800d44:	89 e5                	mov    %esp,%ebp
+  800d46:	57                   	push   %edi
+  800d47:	56                   	push   %esi
+  800d48:	53                   	push   %ebx
+  800d49:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d57:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d5c:	89 df                	mov    %ebx,%edi
+  800d5e:	55                   	push   %ebp
+  800d5f:	89 e5                	mov    %esp,%ebp
+  800d61:	8d 35 69 0d 80 00    	lea    0x800d69,%esi
+  800d67:	0f 34                	sysenter
+  800d69:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d6a:	85 c0                	test   %eax,%eax
+  800d6c:	7f 08                	jg     800d76 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800d6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d71:	5b                   	pop    %ebx
+  800d72:	5e                   	pop    %esi
+  800d73:	5f                   	pop    %edi
+  800d74:	5d                   	pop    %ebp
+  800d75:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d76:	83 ec 0c             	sub    $0xc,%esp
+  800d79:	50                   	push   %eax
+  800d7a:	6a 09                	push   $0x9
+  800d7c:	68 a7 3b 80 00       	push   $0x803ba7
+  800d81:	6a 3d                	push   $0x3d
+  800d83:	68 c4 3b 80 00       	push   $0x803bc4
+  800d88:	e8 c0 f3 ff ff       	call   80014d <_panic>
+
+00800d8d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d8d:	55                   	push   %ebp
+  800d8e:	89 e5                	mov    %esp,%ebp
+  800d90:	57                   	push   %edi
+  800d91:	56                   	push   %esi
+  800d92:	53                   	push   %ebx
+  800d93:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800da6:	89 df                	mov    %ebx,%edi
+  800da8:	55                   	push   %ebp
+  800da9:	89 e5                	mov    %esp,%ebp
+  800dab:	8d 35 b3 0d 80 00    	lea    0x800db3,%esi
+  800db1:	0f 34                	sysenter
+  800db3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800db4:	85 c0                	test   %eax,%eax
+  800db6:	7f 08                	jg     800dc0 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800db8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dbb:	5b                   	pop    %ebx
+  800dbc:	5e                   	pop    %esi
+  800dbd:	5f                   	pop    %edi
+  800dbe:	5d                   	pop    %ebp
+  800dbf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dc0:	83 ec 0c             	sub    $0xc,%esp
+  800dc3:	50                   	push   %eax
+  800dc4:	6a 0a                	push   $0xa
+  800dc6:	68 a7 3b 80 00       	push   $0x803ba7
+  800dcb:	6a 3d                	push   $0x3d
+  800dcd:	68 c4 3b 80 00       	push   $0x803bc4
+  800dd2:	e8 76 f3 ff ff       	call   80014d <_panic>
+
+00800dd7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800dd7:	55                   	push   %ebp
+  800dd8:	89 e5                	mov    %esp,%ebp
+  800dda:	57                   	push   %edi
+  800ddb:	56                   	push   %esi
+  800ddc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ddd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800de8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800deb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dee:	55                   	push   %ebp
+  800def:	89 e5                	mov    %esp,%ebp
+  800df1:	8d 35 f9 0d 80 00    	lea    0x800df9,%esi
+  800df7:	0f 34                	sysenter
+  800df9:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800dfa:	5b                   	pop    %ebx
+  800dfb:	5e                   	pop    %esi
+  800dfc:	5f                   	pop    %edi
+  800dfd:	5d                   	pop    %ebp
+  800dfe:	c3                   	ret
+
+00800dff <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800dff:	55                   	push   %ebp
+  800e00:	89 e5                	mov    %esp,%ebp
+  800e02:	57                   	push   %edi
+  800e03:	56                   	push   %esi
+  800e04:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0b:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e13:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e16:	55                   	push   %ebp
+  800e17:	89 e5                	mov    %esp,%ebp
+  800e19:	8d 35 21 0e 80 00    	lea    0x800e21,%esi
+  800e1f:	0f 34                	sysenter
+  800e21:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800e22:	5b                   	pop    %ebx
+  800e23:	5e                   	pop    %esi
+  800e24:	5f                   	pop    %edi
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+
+00800e27 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	56                   	push   %esi
+  800e2c:	53                   	push   %ebx
+  800e2d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e30:	be 00 00 00 00       	mov    $0x0,%esi
+  800e35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e43:	89 f7                	mov    %esi,%edi
+  800e45:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e47:	85 c0                	test   %eax,%eax
+  800e49:	7f 08                	jg     800e53 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800e4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+  800e56:	50                   	push   %eax
+  800e57:	6a 0d                	push   $0xd
+  800e59:	68 a7 3b 80 00       	push   $0x803ba7
+  800e5e:	6a 23                	push   $0x23
+  800e60:	68 c4 3b 80 00       	push   $0x803bc4
+  800e65:	e8 e3 f2 ff ff       	call   80014d <_panic>
+
+00800e6a <sys_ipc_recv>:
+{
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800e70:	6a 00                	push   $0x0
+  800e72:	6a 01                	push   $0x1
+  800e74:	ff 75 08             	push   0x8(%ebp)
+  800e77:	e8 ab ff ff ff       	call   800e27 <sys_ipc_recvv>
+}
+  800e7c:	c9                   	leave
+  800e7d:	c3                   	ret
+
+00800e7e <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800e7e:	55                   	push   %ebp
+  800e7f:	89 e5                	mov    %esp,%ebp
+  800e81:	57                   	push   %edi
+  800e82:	56                   	push   %esi
+  800e83:	53                   	push   %ebx
+  800e84:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e92:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e97:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e9a:	89 de                	mov    %ebx,%esi
+  800e9c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e9e:	85 c0                	test   %eax,%eax
+  800ea0:	7f 08                	jg     800eaa <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800ea2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea5:	5b                   	pop    %ebx
+  800ea6:	5e                   	pop    %esi
+  800ea7:	5f                   	pop    %edi
+  800ea8:	5d                   	pop    %ebp
+  800ea9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eaa:	83 ec 0c             	sub    $0xc,%esp
+  800ead:	50                   	push   %eax
+  800eae:	6a 0d                	push   $0xd
+  800eb0:	68 a7 3b 80 00       	push   $0x803ba7
+  800eb5:	6a 23                	push   $0x23
+  800eb7:	68 c4 3b 80 00       	push   $0x803bc4
+  800ebc:	e8 8c f2 ff ff       	call   80014d <_panic>
+
+00800ec1 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ec1:	55                   	push   %ebp
+  800ec2:	89 e5                	mov    %esp,%ebp
+  800ec4:	57                   	push   %edi
+  800ec5:	56                   	push   %esi
+  800ec6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ec7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ecc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ed1:	89 d1                	mov    %edx,%ecx
+  800ed3:	89 d3                	mov    %edx,%ebx
+  800ed5:	89 d7                	mov    %edx,%edi
+  800ed7:	55                   	push   %ebp
+  800ed8:	89 e5                	mov    %esp,%ebp
+  800eda:	8d 35 e2 0e 80 00    	lea    0x800ee2,%esi
+  800ee0:	0f 34                	sysenter
+  800ee2:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800ee3:	5b                   	pop    %ebx
+  800ee4:	5e                   	pop    %esi
+  800ee5:	5f                   	pop    %edi
+  800ee6:	5d                   	pop    %ebp
+  800ee7:	c3                   	ret
+
+00800ee8 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800ee8:	55                   	push   %ebp
+  800ee9:	89 e5                	mov    %esp,%ebp
+  800eeb:	57                   	push   %edi
+  800eec:	56                   	push   %esi
+  800eed:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800efe:	89 df                	mov    %ebx,%edi
+  800f00:	55                   	push   %ebp
+  800f01:	89 e5                	mov    %esp,%ebp
+  800f03:	8d 35 0b 0f 80 00    	lea    0x800f0b,%esi
+  800f09:	0f 34                	sysenter
+  800f0b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800f0c:	5b                   	pop    %ebx
+  800f0d:	5e                   	pop    %esi
+  800f0e:	5f                   	pop    %edi
+  800f0f:	5d                   	pop    %ebp
+  800f10:	c3                   	ret
+
+00800f11 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800f11:	55                   	push   %ebp
+  800f12:	89 e5                	mov    %esp,%ebp
+  800f14:	57                   	push   %edi
+  800f15:	56                   	push   %esi
+  800f16:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f24:	89 cb                	mov    %ecx,%ebx
+  800f26:	89 cf                	mov    %ecx,%edi
+  800f28:	55                   	push   %ebp
+  800f29:	89 e5                	mov    %esp,%ebp
+  800f2b:	8d 35 33 0f 80 00    	lea    0x800f33,%esi
+  800f31:	0f 34                	sysenter
+  800f33:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800f34:	5b                   	pop    %ebx
+  800f35:	5e                   	pop    %esi
+  800f36:	5f                   	pop    %edi
+  800f37:	5d                   	pop    %ebp
+  800f38:	c3                   	ret
+
+00800f39 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800f39:	55                   	push   %ebp
+  800f3a:	89 e5                	mov    %esp,%ebp
+  800f3c:	57                   	push   %edi
+  800f3d:	56                   	push   %esi
+  800f3e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4a:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f4f:	89 df                	mov    %ebx,%edi
+  800f51:	55                   	push   %ebp
+  800f52:	89 e5                	mov    %esp,%ebp
+  800f54:	8d 35 5c 0f 80 00    	lea    0x800f5c,%esi
+  800f5a:	0f 34                	sysenter
+  800f5c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800f5d:	5b                   	pop    %ebx
+  800f5e:	5e                   	pop    %esi
+  800f5f:	5f                   	pop    %edi
+  800f60:	5d                   	pop    %ebp
+  800f61:	c3                   	ret
+
+00800f62 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+  800f65:	57                   	push   %edi
+  800f66:	56                   	push   %esi
+  800f67:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f73:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f78:	89 df                	mov    %ebx,%edi
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	8d 35 85 0f 80 00    	lea    0x800f85,%esi
+  800f83:	0f 34                	sysenter
+  800f85:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800f86:	5b                   	pop    %ebx
+  800f87:	5e                   	pop    %esi
+  800f88:	5f                   	pop    %edi
+  800f89:	5d                   	pop    %ebp
+  800f8a:	c3                   	ret
+
+00800f8b <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800f8b:	55                   	push   %ebp
+  800f8c:	89 e5                	mov    %esp,%ebp
+  800f8e:	57                   	push   %edi
+  800f8f:	56                   	push   %esi
+  800f90:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f97:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f9f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fa2:	55                   	push   %ebp
+  800fa3:	89 e5                	mov    %esp,%ebp
+  800fa5:	8d 35 ad 0f 80 00    	lea    0x800fad,%esi
+  800fab:	0f 34                	sysenter
+  800fad:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800fae:	5b                   	pop    %ebx
+  800faf:	5e                   	pop    %esi
+  800fb0:	5f                   	pop    %edi
+  800fb1:	5d                   	pop    %ebp
+  800fb2:	c3                   	ret
+
+00800fb3 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800fb3:	55                   	push   %ebp
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	57                   	push   %edi
+  800fb7:	56                   	push   %esi
+  800fb8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc1:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fc6:	89 cb                	mov    %ecx,%ebx
+  800fc8:	89 cf                	mov    %ecx,%edi
+  800fca:	89 ce                	mov    %ecx,%esi
+  800fcc:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800fce:	5b                   	pop    %ebx
+  800fcf:	5e                   	pop    %esi
+  800fd0:	5f                   	pop    %edi
+  800fd1:	5d                   	pop    %ebp
+  800fd2:	c3                   	ret
+
+00800fd3 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800fd3:	55                   	push   %ebp
+  800fd4:	89 e5                	mov    %esp,%ebp
+  800fd6:	57                   	push   %edi
+  800fd7:	56                   	push   %esi
+  800fd8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe1:	b8 15 00 00 00       	mov    $0x15,%eax
+  800fe6:	89 cb                	mov    %ecx,%ebx
+  800fe8:	89 cf                	mov    %ecx,%edi
+  800fea:	55                   	push   %ebp
+  800feb:	89 e5                	mov    %esp,%ebp
+  800fed:	8d 35 f5 0f 80 00    	lea    0x800ff5,%esi
+  800ff3:	0f 34                	sysenter
+  800ff5:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800ff6:	5b                   	pop    %ebx
+  800ff7:	5e                   	pop    %esi
+  800ff8:	5f                   	pop    %edi
+  800ff9:	5d                   	pop    %ebp
+  800ffa:	c3                   	ret
+
+00800ffb <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800ffb:	55                   	push   %ebp
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	57                   	push   %edi
+  800fff:	56                   	push   %esi
+  801000:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801001:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801006:	8b 55 08             	mov    0x8(%ebp),%edx
+  801009:	b8 16 00 00 00       	mov    $0x16,%eax
+  80100e:	89 cb                	mov    %ecx,%ebx
+  801010:	89 cf                	mov    %ecx,%edi
+  801012:	55                   	push   %ebp
+  801013:	89 e5                	mov    %esp,%ebp
+  801015:	8d 35 1d 10 80 00    	lea    0x80101d,%esi
+  80101b:	0f 34                	sysenter
+  80101d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  80101e:	5b                   	pop    %ebx
+  80101f:	5e                   	pop    %esi
+  801020:	5f                   	pop    %edi
+  801021:	5d                   	pop    %ebp
+  801022:	c3                   	ret
+
+00801023 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  801023:	55                   	push   %ebp
+  801024:	89 e5                	mov    %esp,%ebp
+  801026:	57                   	push   %edi
+  801027:	56                   	push   %esi
+  801028:	53                   	push   %ebx
+  801029:	83 ec 20             	sub    $0x20,%esp
+  80102c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80102f:	89 d7                	mov    %edx,%edi
+  801031:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  801033:	51                   	push   %ecx
+  801034:	68 00 f0 7f 00       	push   $0x7ff000
+  801039:	6a 00                	push   $0x0
+  80103b:	e8 e2 fb ff ff       	call   800c22 <sys_page_alloc>
+  801040:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801042:	83 c4 10             	add    $0x10,%esp
+  801045:	85 c0                	test   %eax,%eax
+  801047:	78 45                	js     80108e <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  801049:	83 ec 04             	sub    $0x4,%esp
+  80104c:	68 00 10 00 00       	push   $0x1000
+  801051:	57                   	push   %edi
+  801052:	68 00 f0 7f 00       	push   $0x7ff000
+  801057:	e8 40 f9 ff ff       	call   80099c <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  80105c:	89 34 24             	mov    %esi,(%esp)
+  80105f:	57                   	push   %edi
+  801060:	ff 75 e4             	push   -0x1c(%ebp)
+  801063:	68 00 f0 7f 00       	push   $0x7ff000
+  801068:	6a 00                	push   $0x0
+  80106a:	e8 fe fb ff ff       	call   800c6d <sys_page_map>
+  80106f:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801071:	83 c4 20             	add    $0x20,%esp
+  801074:	85 c0                	test   %eax,%eax
+  801076:	78 16                	js     80108e <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801078:	83 ec 08             	sub    $0x8,%esp
+  80107b:	68 00 f0 7f 00       	push   $0x7ff000
+  801080:	6a 00                	push   $0x0
+  801082:	e8 28 fc ff ff       	call   800caf <sys_page_unmap>
+  801087:	83 c4 10             	add    $0x10,%esp
+  80108a:	85 c0                	test   %eax,%eax
+  80108c:	75 0a                	jne    801098 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  80108e:	89 d8                	mov    %ebx,%eax
+  801090:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801093:	5b                   	pop    %ebx
+  801094:	5e                   	pop    %esi
+  801095:	5f                   	pop    %edi
+  801096:	5d                   	pop    %ebp
+  801097:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801098:	68 d4 3b 80 00       	push   $0x803bd4
+  80109d:	68 4c 3c 80 00       	push   $0x803c4c
+  8010a2:	6a 1b                	push   $0x1b
+  8010a4:	68 61 3c 80 00       	push   $0x803c61
+  8010a9:	e8 9f f0 ff ff       	call   80014d <_panic>
+
+008010ae <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8010ae:	55                   	push   %ebp
+  8010af:	89 e5                	mov    %esp,%ebp
+  8010b1:	53                   	push   %ebx
+  8010b2:	83 ec 04             	sub    $0x4,%esp
+  8010b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8010b8:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8010ba:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  8010be:	74 21                	je     8010e1 <pgfault+0x33>
+  8010c0:	89 d0                	mov    %edx,%eax
+  8010c2:	c1 e8 16             	shr    $0x16,%eax
+  8010c5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8010cc:	a8 01                	test   $0x1,%al
+  8010ce:	74 11                	je     8010e1 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  8010d0:	89 d0                	mov    %edx,%eax
+  8010d2:	c1 e8 0c             	shr    $0xc,%eax
+  8010d5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010dc:	f6 c4 08             	test   $0x8,%ah
+  8010df:	75 17                	jne    8010f8 <pgfault+0x4a>
+		if (pgfault_next) {
+  8010e1:	a1 08 50 80 00       	mov    0x805008,%eax
+  8010e6:	85 c0                	test   %eax,%eax
+  8010e8:	74 27                	je     801111 <pgfault+0x63>
+			pgfault_next(utf);
+  8010ea:	83 ec 0c             	sub    $0xc,%esp
+  8010ed:	53                   	push   %ebx
+  8010ee:	ff d0                	call   *%eax
+			return;
+  8010f0:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8010f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010f6:	c9                   	leave
+  8010f7:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8010f8:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8010fe:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801103:	b8 00 00 00 00       	mov    $0x0,%eax
+  801108:	e8 16 ff ff ff       	call   801023 <copy_page_to>
+  80110d:	85 c0                	test   %eax,%eax
+  80110f:	79 e2                	jns    8010f3 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  801111:	a1 04 50 80 00       	mov    0x805004,%eax
+  801116:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  801119:	ff 73 28             	push   0x28(%ebx)
+  80111c:	ff 33                	push   (%ebx)
+  80111e:	50                   	push   %eax
+  80111f:	68 f8 3b 80 00       	push   $0x803bf8
+  801124:	e8 ff f0 ff ff       	call   800228 <cprintf>
+	sys_env_destroy(0);
+  801129:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801130:	e8 5e fa ff ff       	call   800b93 <sys_env_destroy>
+  801135:	83 c4 10             	add    $0x10,%esp
+  801138:	eb b9                	jmp    8010f3 <pgfault+0x45>
+
+0080113a <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  80113a:	55                   	push   %ebp
+  80113b:	89 e5                	mov    %esp,%ebp
+  80113d:	53                   	push   %ebx
+  80113e:	83 ec 04             	sub    $0x4,%esp
+  801141:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  801144:	a1 04 90 80 00       	mov    0x809004,%eax
+  801149:	3d ae 10 80 00       	cmp    $0x8010ae,%eax
+  80114e:	74 15                	je     801165 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  801150:	a3 08 50 80 00       	mov    %eax,0x805008
+		set_pgfault_handler(pgfault);
+  801155:	83 ec 0c             	sub    $0xc,%esp
+  801158:	68 ae 10 80 00       	push   $0x8010ae
+  80115d:	e8 91 21 00 00       	call   8032f3 <set_pgfault_handler>
+  801162:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801165:	83 ec 0c             	sub    $0xc,%esp
+  801168:	68 05 08 00 00       	push   $0x805
+  80116d:	53                   	push   %ebx
+  80116e:	6a 00                	push   $0x0
+  801170:	53                   	push   %ebx
+  801171:	6a 00                	push   $0x0
+  801173:	e8 f5 fa ff ff       	call   800c6d <sys_page_map>
+}
+  801178:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80117b:	c9                   	leave
+  80117c:	c3                   	ret
+
+0080117d <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	57                   	push   %edi
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+  801183:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801186:	68 ae 10 80 00       	push   $0x8010ae
+  80118b:	e8 63 21 00 00       	call   8032f3 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801190:	b8 07 00 00 00       	mov    $0x7,%eax
+  801195:	cd 30                	int    $0x30
+  801197:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80119a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  80119d:	83 c4 10             	add    $0x10,%esp
+  8011a0:	85 c0                	test   %eax,%eax
+  8011a2:	0f 88 6b 01 00 00    	js     801313 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8011a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8011ad:	75 37                	jne    8011e6 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8011af:	e8 28 fa ff ff       	call   800bdc <sys_getenvid>
+  8011b4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8011b9:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8011bf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8011c4:	a3 04 50 80 00       	mov    %eax,0x805004
+		return 0;
+  8011c9:	e9 45 01 00 00       	jmp    801313 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8011ce:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8011d4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8011da:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011e0:	0f 87 ba 00 00 00    	ja     8012a0 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8011e6:	89 d8                	mov    %ebx,%eax
+  8011e8:	c1 e8 16             	shr    $0x16,%eax
+  8011eb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8011f2:	a8 01                	test   $0x1,%al
+  8011f4:	74 d8                	je     8011ce <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8011f6:	89 d8                	mov    %ebx,%eax
+  8011f8:	c1 e8 0c             	shr    $0xc,%eax
+  8011fb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801202:	f6 c2 01             	test   $0x1,%dl
+  801205:	74 cd                	je     8011d4 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  801207:	89 da                	mov    %ebx,%edx
+  801209:	80 e6 df             	and    $0xdf,%dh
+  80120c:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  801212:	74 c0                	je     8011d4 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  801214:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801216:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80121d:	f6 c6 04             	test   $0x4,%dh
+  801220:	75 53                	jne    801275 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  801222:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801229:	f6 c6 08             	test   $0x8,%dh
+  80122c:	75 0c                	jne    80123a <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80122e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801235:	f6 c2 02             	test   $0x2,%dl
+  801238:	74 3b                	je     801275 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80123a:	83 ec 0c             	sub    $0xc,%esp
+  80123d:	68 05 08 00 00       	push   $0x805
+  801242:	57                   	push   %edi
+  801243:	ff 75 e4             	push   -0x1c(%ebp)
+  801246:	57                   	push   %edi
+  801247:	6a 00                	push   $0x0
+  801249:	e8 1f fa ff ff       	call   800c6d <sys_page_map>
+  80124e:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801250:	83 c4 20             	add    $0x20,%esp
+  801253:	85 c0                	test   %eax,%eax
+  801255:	0f 88 a7 00 00 00    	js     801302 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80125b:	83 ec 0c             	sub    $0xc,%esp
+  80125e:	68 05 08 00 00       	push   $0x805
+  801263:	57                   	push   %edi
+  801264:	6a 00                	push   $0x0
+  801266:	57                   	push   %edi
+  801267:	6a 00                	push   $0x0
+  801269:	e8 ff f9 ff ff       	call   800c6d <sys_page_map>
+  80126e:	89 c6                	mov    %eax,%esi
+	return r;
+  801270:	83 c4 20             	add    $0x20,%esp
+  801273:	eb 21                	jmp    801296 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  801275:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80127c:	83 ec 0c             	sub    $0xc,%esp
+  80127f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801284:	50                   	push   %eax
+  801285:	57                   	push   %edi
+  801286:	ff 75 e4             	push   -0x1c(%ebp)
+  801289:	57                   	push   %edi
+  80128a:	6a 00                	push   $0x0
+  80128c:	e8 dc f9 ff ff       	call   800c6d <sys_page_map>
+  801291:	89 c6                	mov    %eax,%esi
+  801293:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  801296:	85 f6                	test   %esi,%esi
+  801298:	0f 89 36 ff ff ff    	jns    8011d4 <fork+0x57>
+  80129e:	eb 62                	jmp    801302 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8012a0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8012a5:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8012aa:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8012ad:	89 f8                	mov    %edi,%eax
+  8012af:	e8 6f fd ff ff       	call   801023 <copy_page_to>
+  8012b4:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8012b6:	85 c0                	test   %eax,%eax
+  8012b8:	78 48                	js     801302 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8012ba:	83 ec 04             	sub    $0x4,%esp
+  8012bd:	6a 07                	push   $0x7
+  8012bf:	68 00 f0 bf ee       	push   $0xeebff000
+  8012c4:	57                   	push   %edi
+  8012c5:	e8 58 f9 ff ff       	call   800c22 <sys_page_alloc>
+  8012ca:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8012cc:	83 c4 10             	add    $0x10,%esp
+  8012cf:	85 c0                	test   %eax,%eax
+  8012d1:	78 2f                	js     801302 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8012d3:	a1 04 50 80 00       	mov    0x805004,%eax
+  8012d8:	8b 40 64             	mov    0x64(%eax),%eax
+  8012db:	83 ec 08             	sub    $0x8,%esp
+  8012de:	50                   	push   %eax
+  8012df:	57                   	push   %edi
+  8012e0:	e8 a8 fa ff ff       	call   800d8d <sys_env_set_pgfault_upcall>
+  8012e5:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8012e7:	83 c4 10             	add    $0x10,%esp
+  8012ea:	85 c0                	test   %eax,%eax
+  8012ec:	78 14                	js     801302 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8012ee:	83 ec 08             	sub    $0x8,%esp
+  8012f1:	6a 02                	push   $0x2
+  8012f3:	57                   	push   %edi
+  8012f4:	e8 00 fa ff ff       	call   800cf9 <sys_env_set_status>
+  8012f9:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8012fb:	83 c4 10             	add    $0x10,%esp
+  8012fe:	85 c0                	test   %eax,%eax
+  801300:	79 11                	jns    801313 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  801302:	83 ec 0c             	sub    $0xc,%esp
+  801305:	ff 75 e0             	push   -0x20(%ebp)
+  801308:	e8 86 f8 ff ff       	call   800b93 <sys_env_destroy>
+	return r;
+  80130d:	83 c4 10             	add    $0x10,%esp
+  801310:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  801313:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801316:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801319:	5b                   	pop    %ebx
+  80131a:	5e                   	pop    %esi
+  80131b:	5f                   	pop    %edi
+  80131c:	5d                   	pop    %ebp
+  80131d:	c3                   	ret
+
+0080131e <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80131e:	55                   	push   %ebp
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801324:	68 6c 3c 80 00       	push   $0x803c6c
+  801329:	68 bf 00 00 00       	push   $0xbf
+  80132e:	68 61 3c 80 00       	push   $0x803c61
+  801333:	e8 15 ee ff ff       	call   80014d <_panic>
+
+00801338 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801338:	55                   	push   %ebp
+  801339:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80133b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80133e:	05 00 00 00 30       	add    $0x30000000,%eax
+  801343:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801346:	5d                   	pop    %ebp
+  801347:	c3                   	ret
+
+00801348 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801348:	55                   	push   %ebp
+  801349:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80134b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80134e:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801353:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801358:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80135d:	5d                   	pop    %ebp
+  80135e:	c3                   	ret
+
+0080135f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80135f:	55                   	push   %ebp
+  801360:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801362:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801367:	eb 02                	jmp    80136b <fd_alloc+0xc>
+  801369:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80136b:	89 c2                	mov    %eax,%edx
+  80136d:	c1 ea 16             	shr    $0x16,%edx
+  801370:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801377:	f6 c2 01             	test   $0x1,%dl
+  80137a:	74 2b                	je     8013a7 <fd_alloc+0x48>
+  80137c:	89 c2                	mov    %eax,%edx
+  80137e:	c1 ea 0c             	shr    $0xc,%edx
+  801381:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801388:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80138e:	f6 c1 01             	test   $0x1,%cl
+  801391:	74 14                	je     8013a7 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801393:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801399:	75 ce                	jne    801369 <fd_alloc+0xa>
+  80139b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8013a0:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8013a5:	eb 05                	jmp    8013ac <fd_alloc+0x4d>
+			return 0;
+  8013a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8013ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013af:	89 02                	mov    %eax,(%edx)
+}
+  8013b1:	89 c8                	mov    %ecx,%eax
+  8013b3:	5d                   	pop    %ebp
+  8013b4:	c3                   	ret
+
+008013b5 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013b5:	55                   	push   %ebp
+  8013b6:	89 e5                	mov    %esp,%ebp
+  8013b8:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8013bb:	83 f8 1f             	cmp    $0x1f,%eax
+  8013be:	77 30                	ja     8013f0 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8013c0:	c1 e0 0c             	shl    $0xc,%eax
+  8013c3:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8013c8:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8013ce:	f6 c2 01             	test   $0x1,%dl
+  8013d1:	74 24                	je     8013f7 <fd_lookup+0x42>
+  8013d3:	89 c2                	mov    %eax,%edx
+  8013d5:	c1 ea 0c             	shr    $0xc,%edx
+  8013d8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013df:	f6 c2 01             	test   $0x1,%dl
+  8013e2:	74 1a                	je     8013fe <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8013e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013e7:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013ee:	5d                   	pop    %ebp
+  8013ef:	c3                   	ret
+		return -E_INVAL;
+  8013f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013f5:	eb f7                	jmp    8013ee <fd_lookup+0x39>
+		return -E_INVAL;
+  8013f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013fc:	eb f0                	jmp    8013ee <fd_lookup+0x39>
+  8013fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801403:	eb e9                	jmp    8013ee <fd_lookup+0x39>
+
+00801405 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801405:	55                   	push   %ebp
+  801406:	89 e5                	mov    %esp,%ebp
+  801408:	53                   	push   %ebx
+  801409:	83 ec 04             	sub    $0x4,%esp
+  80140c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80140f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801414:	eb 03                	jmp    801419 <dev_lookup+0x14>
+  801416:	83 c0 01             	add    $0x1,%eax
+  801419:	8b 1c 85 00 3d 80 00 	mov    0x803d00(,%eax,4),%ebx
+  801420:	85 db                	test   %ebx,%ebx
+  801422:	74 0b                	je     80142f <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801424:	39 13                	cmp    %edx,(%ebx)
+  801426:	75 ee                	jne    801416 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801428:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142d:	eb 1f                	jmp    80144e <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80142f:	a1 04 50 80 00       	mov    0x805004,%eax
+  801434:	8b 40 48             	mov    0x48(%eax),%eax
+  801437:	83 ec 04             	sub    $0x4,%esp
+  80143a:	52                   	push   %edx
+  80143b:	50                   	push   %eax
+  80143c:	68 84 3c 80 00       	push   $0x803c84
+  801441:	e8 e2 ed ff ff       	call   800228 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801446:	83 c4 10             	add    $0x10,%esp
+  801449:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80144e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801451:	89 1a                	mov    %ebx,(%edx)
+}
+  801453:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801456:	c9                   	leave
+  801457:	c3                   	ret
+
+00801458 <fd_close>:
+{
+  801458:	55                   	push   %ebp
+  801459:	89 e5                	mov    %esp,%ebp
+  80145b:	57                   	push   %edi
+  80145c:	56                   	push   %esi
+  80145d:	53                   	push   %ebx
+  80145e:	83 ec 24             	sub    $0x24,%esp
+  801461:	8b 75 08             	mov    0x8(%ebp),%esi
+  801464:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801467:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80146a:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80146b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801471:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801474:	50                   	push   %eax
+  801475:	e8 3b ff ff ff       	call   8013b5 <fd_lookup>
+  80147a:	89 c3                	mov    %eax,%ebx
+  80147c:	83 c4 10             	add    $0x10,%esp
+  80147f:	85 c0                	test   %eax,%eax
+  801481:	78 05                	js     801488 <fd_close+0x30>
+	    || fd != fd2)
+  801483:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801486:	74 16                	je     80149e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801488:	89 f8                	mov    %edi,%eax
+  80148a:	84 c0                	test   %al,%al
+  80148c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801491:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801494:	89 d8                	mov    %ebx,%eax
+  801496:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801499:	5b                   	pop    %ebx
+  80149a:	5e                   	pop    %esi
+  80149b:	5f                   	pop    %edi
+  80149c:	5d                   	pop    %ebp
+  80149d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80149e:	83 ec 08             	sub    $0x8,%esp
+  8014a1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014a4:	50                   	push   %eax
+  8014a5:	ff 36                	push   (%esi)
+  8014a7:	e8 59 ff ff ff       	call   801405 <dev_lookup>
+  8014ac:	89 c3                	mov    %eax,%ebx
+  8014ae:	83 c4 10             	add    $0x10,%esp
+  8014b1:	85 c0                	test   %eax,%eax
+  8014b3:	78 1a                	js     8014cf <fd_close+0x77>
+		if (dev->dev_close)
+  8014b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014b8:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014c0:	85 c0                	test   %eax,%eax
+  8014c2:	74 0b                	je     8014cf <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8014c4:	83 ec 0c             	sub    $0xc,%esp
+  8014c7:	56                   	push   %esi
+  8014c8:	ff d0                	call   *%eax
+  8014ca:	89 c3                	mov    %eax,%ebx
+  8014cc:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8014cf:	83 ec 08             	sub    $0x8,%esp
+  8014d2:	56                   	push   %esi
+  8014d3:	6a 00                	push   $0x0
+  8014d5:	e8 d5 f7 ff ff       	call   800caf <sys_page_unmap>
+	return r;
+  8014da:	83 c4 10             	add    $0x10,%esp
+  8014dd:	eb b5                	jmp    801494 <fd_close+0x3c>
+
+008014df <close>:
+
+int
+close(int fdnum)
+{
+  8014df:	55                   	push   %ebp
+  8014e0:	89 e5                	mov    %esp,%ebp
+  8014e2:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014e8:	50                   	push   %eax
+  8014e9:	ff 75 08             	push   0x8(%ebp)
+  8014ec:	e8 c4 fe ff ff       	call   8013b5 <fd_lookup>
+  8014f1:	83 c4 10             	add    $0x10,%esp
+  8014f4:	85 c0                	test   %eax,%eax
+  8014f6:	79 02                	jns    8014fa <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8014f8:	c9                   	leave
+  8014f9:	c3                   	ret
+		return fd_close(fd, 1);
+  8014fa:	83 ec 08             	sub    $0x8,%esp
+  8014fd:	6a 01                	push   $0x1
+  8014ff:	ff 75 f4             	push   -0xc(%ebp)
+  801502:	e8 51 ff ff ff       	call   801458 <fd_close>
+  801507:	83 c4 10             	add    $0x10,%esp
+  80150a:	eb ec                	jmp    8014f8 <close+0x19>
+
+0080150c <close_all>:
+
+void
+close_all(void)
+{
+  80150c:	55                   	push   %ebp
+  80150d:	89 e5                	mov    %esp,%ebp
+  80150f:	53                   	push   %ebx
+  801510:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801513:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801518:	83 ec 0c             	sub    $0xc,%esp
+  80151b:	53                   	push   %ebx
+  80151c:	e8 be ff ff ff       	call   8014df <close>
+	for (i = 0; i < MAXFD; i++)
+  801521:	83 c3 01             	add    $0x1,%ebx
+  801524:	83 c4 10             	add    $0x10,%esp
+  801527:	83 fb 20             	cmp    $0x20,%ebx
+  80152a:	75 ec                	jne    801518 <close_all+0xc>
+}
+  80152c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80152f:	c9                   	leave
+  801530:	c3                   	ret
+
+00801531 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	57                   	push   %edi
+  801535:	56                   	push   %esi
+  801536:	53                   	push   %ebx
+  801537:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80153a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80153d:	50                   	push   %eax
+  80153e:	ff 75 08             	push   0x8(%ebp)
+  801541:	e8 6f fe ff ff       	call   8013b5 <fd_lookup>
+  801546:	89 c3                	mov    %eax,%ebx
+  801548:	83 c4 10             	add    $0x10,%esp
+  80154b:	85 c0                	test   %eax,%eax
+  80154d:	78 7f                	js     8015ce <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80154f:	83 ec 0c             	sub    $0xc,%esp
+  801552:	ff 75 0c             	push   0xc(%ebp)
+  801555:	e8 85 ff ff ff       	call   8014df <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80155a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80155d:	c1 e6 0c             	shl    $0xc,%esi
+  801560:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801566:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801569:	89 3c 24             	mov    %edi,(%esp)
+  80156c:	e8 d7 fd ff ff       	call   801348 <fd2data>
+  801571:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801573:	89 34 24             	mov    %esi,(%esp)
+  801576:	e8 cd fd ff ff       	call   801348 <fd2data>
+  80157b:	83 c4 10             	add    $0x10,%esp
+  80157e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801581:	89 d8                	mov    %ebx,%eax
+  801583:	c1 e8 16             	shr    $0x16,%eax
+  801586:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80158d:	a8 01                	test   $0x1,%al
+  80158f:	74 11                	je     8015a2 <dup+0x71>
+  801591:	89 d8                	mov    %ebx,%eax
+  801593:	c1 e8 0c             	shr    $0xc,%eax
+  801596:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80159d:	f6 c2 01             	test   $0x1,%dl
+  8015a0:	75 36                	jne    8015d8 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015a2:	89 f8                	mov    %edi,%eax
+  8015a4:	c1 e8 0c             	shr    $0xc,%eax
+  8015a7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015ae:	83 ec 0c             	sub    $0xc,%esp
+  8015b1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015b6:	50                   	push   %eax
+  8015b7:	56                   	push   %esi
+  8015b8:	6a 00                	push   $0x0
+  8015ba:	57                   	push   %edi
+  8015bb:	6a 00                	push   $0x0
+  8015bd:	e8 ab f6 ff ff       	call   800c6d <sys_page_map>
+  8015c2:	89 c3                	mov    %eax,%ebx
+  8015c4:	83 c4 20             	add    $0x20,%esp
+  8015c7:	85 c0                	test   %eax,%eax
+  8015c9:	78 33                	js     8015fe <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8015cb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8015ce:	89 d8                	mov    %ebx,%eax
+  8015d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015d3:	5b                   	pop    %ebx
+  8015d4:	5e                   	pop    %esi
+  8015d5:	5f                   	pop    %edi
+  8015d6:	5d                   	pop    %ebp
+  8015d7:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015d8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015df:	83 ec 0c             	sub    $0xc,%esp
+  8015e2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015e7:	50                   	push   %eax
+  8015e8:	ff 75 d4             	push   -0x2c(%ebp)
+  8015eb:	6a 00                	push   $0x0
+  8015ed:	53                   	push   %ebx
+  8015ee:	6a 00                	push   $0x0
+  8015f0:	e8 78 f6 ff ff       	call   800c6d <sys_page_map>
+  8015f5:	89 c3                	mov    %eax,%ebx
+  8015f7:	83 c4 20             	add    $0x20,%esp
+  8015fa:	85 c0                	test   %eax,%eax
+  8015fc:	79 a4                	jns    8015a2 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8015fe:	83 ec 08             	sub    $0x8,%esp
+  801601:	56                   	push   %esi
+  801602:	6a 00                	push   $0x0
+  801604:	e8 a6 f6 ff ff       	call   800caf <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801609:	83 c4 08             	add    $0x8,%esp
+  80160c:	ff 75 d4             	push   -0x2c(%ebp)
+  80160f:	6a 00                	push   $0x0
+  801611:	e8 99 f6 ff ff       	call   800caf <sys_page_unmap>
+	return r;
+  801616:	83 c4 10             	add    $0x10,%esp
+  801619:	eb b3                	jmp    8015ce <dup+0x9d>
+
+0080161b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80161b:	55                   	push   %ebp
+  80161c:	89 e5                	mov    %esp,%ebp
+  80161e:	56                   	push   %esi
+  80161f:	53                   	push   %ebx
+  801620:	83 ec 18             	sub    $0x18,%esp
+  801623:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801626:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801629:	50                   	push   %eax
+  80162a:	56                   	push   %esi
+  80162b:	e8 85 fd ff ff       	call   8013b5 <fd_lookup>
+  801630:	83 c4 10             	add    $0x10,%esp
+  801633:	85 c0                	test   %eax,%eax
+  801635:	78 3c                	js     801673 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801637:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80163a:	83 ec 08             	sub    $0x8,%esp
+  80163d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801640:	50                   	push   %eax
+  801641:	ff 33                	push   (%ebx)
+  801643:	e8 bd fd ff ff       	call   801405 <dev_lookup>
+  801648:	83 c4 10             	add    $0x10,%esp
+  80164b:	85 c0                	test   %eax,%eax
+  80164d:	78 24                	js     801673 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80164f:	8b 43 08             	mov    0x8(%ebx),%eax
+  801652:	83 e0 03             	and    $0x3,%eax
+  801655:	83 f8 01             	cmp    $0x1,%eax
+  801658:	74 20                	je     80167a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80165a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80165d:	8b 40 08             	mov    0x8(%eax),%eax
+  801660:	85 c0                	test   %eax,%eax
+  801662:	74 37                	je     80169b <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801664:	83 ec 04             	sub    $0x4,%esp
+  801667:	ff 75 10             	push   0x10(%ebp)
+  80166a:	ff 75 0c             	push   0xc(%ebp)
+  80166d:	53                   	push   %ebx
+  80166e:	ff d0                	call   *%eax
+  801670:	83 c4 10             	add    $0x10,%esp
+}
+  801673:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801676:	5b                   	pop    %ebx
+  801677:	5e                   	pop    %esi
+  801678:	5d                   	pop    %ebp
+  801679:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80167a:	a1 04 50 80 00       	mov    0x805004,%eax
+  80167f:	8b 40 48             	mov    0x48(%eax),%eax
+  801682:	83 ec 04             	sub    $0x4,%esp
+  801685:	56                   	push   %esi
+  801686:	50                   	push   %eax
+  801687:	68 c5 3c 80 00       	push   $0x803cc5
+  80168c:	e8 97 eb ff ff       	call   800228 <cprintf>
+		return -E_INVAL;
+  801691:	83 c4 10             	add    $0x10,%esp
+  801694:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801699:	eb d8                	jmp    801673 <read+0x58>
+		return -E_NOT_SUPP;
+  80169b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016a0:	eb d1                	jmp    801673 <read+0x58>
+
+008016a2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016a2:	55                   	push   %ebp
+  8016a3:	89 e5                	mov    %esp,%ebp
+  8016a5:	57                   	push   %edi
+  8016a6:	56                   	push   %esi
+  8016a7:	53                   	push   %ebx
+  8016a8:	83 ec 0c             	sub    $0xc,%esp
+  8016ab:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016ae:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b6:	eb 02                	jmp    8016ba <readn+0x18>
+  8016b8:	01 c3                	add    %eax,%ebx
+  8016ba:	39 f3                	cmp    %esi,%ebx
+  8016bc:	73 21                	jae    8016df <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016be:	83 ec 04             	sub    $0x4,%esp
+  8016c1:	89 f0                	mov    %esi,%eax
+  8016c3:	29 d8                	sub    %ebx,%eax
+  8016c5:	50                   	push   %eax
+  8016c6:	89 d8                	mov    %ebx,%eax
+  8016c8:	03 45 0c             	add    0xc(%ebp),%eax
+  8016cb:	50                   	push   %eax
+  8016cc:	57                   	push   %edi
+  8016cd:	e8 49 ff ff ff       	call   80161b <read>
+		if (m < 0)
+  8016d2:	83 c4 10             	add    $0x10,%esp
+  8016d5:	85 c0                	test   %eax,%eax
+  8016d7:	78 04                	js     8016dd <readn+0x3b>
+			return m;
+		if (m == 0)
+  8016d9:	75 dd                	jne    8016b8 <readn+0x16>
+  8016db:	eb 02                	jmp    8016df <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016dd:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8016df:	89 d8                	mov    %ebx,%eax
+  8016e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e4:	5b                   	pop    %ebx
+  8016e5:	5e                   	pop    %esi
+  8016e6:	5f                   	pop    %edi
+  8016e7:	5d                   	pop    %ebp
+  8016e8:	c3                   	ret
+
+008016e9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016e9:	55                   	push   %ebp
+  8016ea:	89 e5                	mov    %esp,%ebp
+  8016ec:	56                   	push   %esi
+  8016ed:	53                   	push   %ebx
+  8016ee:	83 ec 18             	sub    $0x18,%esp
+  8016f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016f4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016f7:	50                   	push   %eax
+  8016f8:	53                   	push   %ebx
+  8016f9:	e8 b7 fc ff ff       	call   8013b5 <fd_lookup>
+  8016fe:	83 c4 10             	add    $0x10,%esp
+  801701:	85 c0                	test   %eax,%eax
+  801703:	78 37                	js     80173c <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801705:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801708:	83 ec 08             	sub    $0x8,%esp
+  80170b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80170e:	50                   	push   %eax
+  80170f:	ff 36                	push   (%esi)
+  801711:	e8 ef fc ff ff       	call   801405 <dev_lookup>
+  801716:	83 c4 10             	add    $0x10,%esp
+  801719:	85 c0                	test   %eax,%eax
+  80171b:	78 1f                	js     80173c <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80171d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801721:	74 20                	je     801743 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801723:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801726:	8b 40 0c             	mov    0xc(%eax),%eax
+  801729:	85 c0                	test   %eax,%eax
+  80172b:	74 37                	je     801764 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80172d:	83 ec 04             	sub    $0x4,%esp
+  801730:	ff 75 10             	push   0x10(%ebp)
+  801733:	ff 75 0c             	push   0xc(%ebp)
+  801736:	56                   	push   %esi
+  801737:	ff d0                	call   *%eax
+  801739:	83 c4 10             	add    $0x10,%esp
+}
+  80173c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80173f:	5b                   	pop    %ebx
+  801740:	5e                   	pop    %esi
+  801741:	5d                   	pop    %ebp
+  801742:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801743:	a1 04 50 80 00       	mov    0x805004,%eax
+  801748:	8b 40 48             	mov    0x48(%eax),%eax
+  80174b:	83 ec 04             	sub    $0x4,%esp
+  80174e:	53                   	push   %ebx
+  80174f:	50                   	push   %eax
+  801750:	68 e1 3c 80 00       	push   $0x803ce1
+  801755:	e8 ce ea ff ff       	call   800228 <cprintf>
+		return -E_INVAL;
+  80175a:	83 c4 10             	add    $0x10,%esp
+  80175d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801762:	eb d8                	jmp    80173c <write+0x53>
+		return -E_NOT_SUPP;
+  801764:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801769:	eb d1                	jmp    80173c <write+0x53>
+
+0080176b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80176b:	55                   	push   %ebp
+  80176c:	89 e5                	mov    %esp,%ebp
+  80176e:	53                   	push   %ebx
+  80176f:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801772:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801775:	50                   	push   %eax
+  801776:	ff 75 08             	push   0x8(%ebp)
+  801779:	e8 37 fc ff ff       	call   8013b5 <fd_lookup>
+  80177e:	83 c4 10             	add    $0x10,%esp
+  801781:	85 c0                	test   %eax,%eax
+  801783:	78 3a                	js     8017bf <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801785:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801788:	83 ec 08             	sub    $0x8,%esp
+  80178b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80178e:	50                   	push   %eax
+  80178f:	ff 33                	push   (%ebx)
+  801791:	e8 6f fc ff ff       	call   801405 <dev_lookup>
+  801796:	83 c4 10             	add    $0x10,%esp
+  801799:	85 c0                	test   %eax,%eax
+  80179b:	78 22                	js     8017bf <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  80179d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017a0:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8017a3:	85 c0                	test   %eax,%eax
+  8017a5:	74 0d                	je     8017b4 <seek+0x49>
+  8017a7:	83 ec 0c             	sub    $0xc,%esp
+  8017aa:	53                   	push   %ebx
+  8017ab:	ff d0                	call   *%eax
+  8017ad:	83 c4 10             	add    $0x10,%esp
+  8017b0:	85 c0                	test   %eax,%eax
+  8017b2:	78 0b                	js     8017bf <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8017b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017b7:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8017ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017c2:	c9                   	leave
+  8017c3:	c3                   	ret
+
+008017c4 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8017c4:	55                   	push   %ebp
+  8017c5:	89 e5                	mov    %esp,%ebp
+  8017c7:	53                   	push   %ebx
+  8017c8:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017cb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017ce:	50                   	push   %eax
+  8017cf:	ff 75 08             	push   0x8(%ebp)
+  8017d2:	e8 de fb ff ff       	call   8013b5 <fd_lookup>
+  8017d7:	83 c4 10             	add    $0x10,%esp
+  8017da:	85 c0                	test   %eax,%eax
+  8017dc:	78 2b                	js     801809 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017de:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8017e1:	83 ec 08             	sub    $0x8,%esp
+  8017e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017e7:	50                   	push   %eax
+  8017e8:	ff 33                	push   (%ebx)
+  8017ea:	e8 16 fc ff ff       	call   801405 <dev_lookup>
+  8017ef:	83 c4 10             	add    $0x10,%esp
+  8017f2:	85 c0                	test   %eax,%eax
+  8017f4:	78 13                	js     801809 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8017f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017f9:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8017fc:	85 c0                	test   %eax,%eax
+  8017fe:	74 0e                	je     80180e <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801800:	83 ec 0c             	sub    $0xc,%esp
+  801803:	53                   	push   %ebx
+  801804:	ff d0                	call   *%eax
+  801806:	83 c4 10             	add    $0x10,%esp
+}
+  801809:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80180c:	c9                   	leave
+  80180d:	c3                   	ret
+		return 0;
+  80180e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801813:	eb f4                	jmp    801809 <fsync+0x45>
+
+00801815 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801815:	55                   	push   %ebp
+  801816:	89 e5                	mov    %esp,%ebp
+  801818:	56                   	push   %esi
+  801819:	53                   	push   %ebx
+  80181a:	83 ec 18             	sub    $0x18,%esp
+  80181d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801820:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801823:	50                   	push   %eax
+  801824:	53                   	push   %ebx
+  801825:	e8 8b fb ff ff       	call   8013b5 <fd_lookup>
+  80182a:	83 c4 10             	add    $0x10,%esp
+  80182d:	85 c0                	test   %eax,%eax
+  80182f:	78 34                	js     801865 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801831:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801834:	83 ec 08             	sub    $0x8,%esp
+  801837:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80183a:	50                   	push   %eax
+  80183b:	ff 36                	push   (%esi)
+  80183d:	e8 c3 fb ff ff       	call   801405 <dev_lookup>
+  801842:	83 c4 10             	add    $0x10,%esp
+  801845:	85 c0                	test   %eax,%eax
+  801847:	78 1c                	js     801865 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801849:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80184d:	74 1d                	je     80186c <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80184f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801852:	8b 40 18             	mov    0x18(%eax),%eax
+  801855:	85 c0                	test   %eax,%eax
+  801857:	74 34                	je     80188d <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801859:	83 ec 08             	sub    $0x8,%esp
+  80185c:	ff 75 0c             	push   0xc(%ebp)
+  80185f:	56                   	push   %esi
+  801860:	ff d0                	call   *%eax
+  801862:	83 c4 10             	add    $0x10,%esp
+}
+  801865:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801868:	5b                   	pop    %ebx
+  801869:	5e                   	pop    %esi
+  80186a:	5d                   	pop    %ebp
+  80186b:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80186c:	a1 04 50 80 00       	mov    0x805004,%eax
+  801871:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801874:	83 ec 04             	sub    $0x4,%esp
+  801877:	53                   	push   %ebx
+  801878:	50                   	push   %eax
+  801879:	68 a4 3c 80 00       	push   $0x803ca4
+  80187e:	e8 a5 e9 ff ff       	call   800228 <cprintf>
+		return -E_INVAL;
+  801883:	83 c4 10             	add    $0x10,%esp
+  801886:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80188b:	eb d8                	jmp    801865 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80188d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801892:	eb d1                	jmp    801865 <ftruncate+0x50>
+
+00801894 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801894:	55                   	push   %ebp
+  801895:	89 e5                	mov    %esp,%ebp
+  801897:	56                   	push   %esi
+  801898:	53                   	push   %ebx
+  801899:	83 ec 18             	sub    $0x18,%esp
+  80189c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80189f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018a2:	50                   	push   %eax
+  8018a3:	ff 75 08             	push   0x8(%ebp)
+  8018a6:	e8 0a fb ff ff       	call   8013b5 <fd_lookup>
+  8018ab:	83 c4 10             	add    $0x10,%esp
+  8018ae:	85 c0                	test   %eax,%eax
+  8018b0:	78 49                	js     8018fb <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018b2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018b5:	83 ec 08             	sub    $0x8,%esp
+  8018b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018bb:	50                   	push   %eax
+  8018bc:	ff 36                	push   (%esi)
+  8018be:	e8 42 fb ff ff       	call   801405 <dev_lookup>
+  8018c3:	83 c4 10             	add    $0x10,%esp
+  8018c6:	85 c0                	test   %eax,%eax
+  8018c8:	78 31                	js     8018fb <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8018ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018cd:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018d1:	74 2f                	je     801902 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8018d3:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8018d6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018dd:	00 00 00 
+	stat->st_isdir = 0;
+  8018e0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018e7:	00 00 00 
+	stat->st_dev = dev;
+  8018ea:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8018f0:	83 ec 08             	sub    $0x8,%esp
+  8018f3:	53                   	push   %ebx
+  8018f4:	56                   	push   %esi
+  8018f5:	ff 50 14             	call   *0x14(%eax)
+  8018f8:	83 c4 10             	add    $0x10,%esp
+}
+  8018fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018fe:	5b                   	pop    %ebx
+  8018ff:	5e                   	pop    %esi
+  801900:	5d                   	pop    %ebp
+  801901:	c3                   	ret
+		return -E_NOT_SUPP;
+  801902:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801907:	eb f2                	jmp    8018fb <fstat+0x67>
+
+00801909 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801909:	55                   	push   %ebp
+  80190a:	89 e5                	mov    %esp,%ebp
+  80190c:	56                   	push   %esi
+  80190d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  80190e:	83 ec 08             	sub    $0x8,%esp
+  801911:	68 00 10 00 00       	push   $0x1000
+  801916:	ff 75 08             	push   0x8(%ebp)
+  801919:	e8 b3 07 00 00       	call   8020d1 <open>
+  80191e:	89 c3                	mov    %eax,%ebx
+  801920:	83 c4 10             	add    $0x10,%esp
+  801923:	85 c0                	test   %eax,%eax
+  801925:	78 1b                	js     801942 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801927:	83 ec 08             	sub    $0x8,%esp
+  80192a:	ff 75 0c             	push   0xc(%ebp)
+  80192d:	50                   	push   %eax
+  80192e:	e8 61 ff ff ff       	call   801894 <fstat>
+  801933:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801935:	89 1c 24             	mov    %ebx,(%esp)
+  801938:	e8 a2 fb ff ff       	call   8014df <close>
+	return r;
+  80193d:	83 c4 10             	add    $0x10,%esp
+  801940:	89 f3                	mov    %esi,%ebx
+}
+  801942:	89 d8                	mov    %ebx,%eax
+  801944:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801947:	5b                   	pop    %ebx
+  801948:	5e                   	pop    %esi
+  801949:	5d                   	pop    %ebp
+  80194a:	c3                   	ret
+
+0080194b <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  80194b:	55                   	push   %ebp
+  80194c:	89 e5                	mov    %esp,%ebp
+  80194e:	57                   	push   %edi
+  80194f:	56                   	push   %esi
+  801950:	53                   	push   %ebx
+  801951:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801957:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  80195d:	89 d6                	mov    %edx,%esi
+  80195f:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801965:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801968:	89 d3                	mov    %edx,%ebx
+  80196a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801970:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801977:	74 1d                	je     801996 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801979:	b8 00 60 80 00       	mov    $0x806000,%eax
+  80197e:	83 c8 07             	or     $0x7,%eax
+  801981:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801987:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  80198c:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801992:	01 ce                	add    %ecx,%esi
+  801994:	eb 28                	jmp    8019be <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801996:	83 ec 0c             	sub    $0xc,%esp
+  801999:	6a 01                	push   $0x1
+  80199b:	e8 90 1b 00 00       	call   803530 <ipc_find_env>
+  8019a0:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8019a5:	83 c4 10             	add    $0x10,%esp
+  8019a8:	eb cf                	jmp    801979 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  8019aa:	83 c0 01             	add    $0x1,%eax
+  8019ad:	89 fa                	mov    %edi,%edx
+  8019af:	09 da                	or     %ebx,%edx
+  8019b1:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8019b8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8019be:	39 f3                	cmp    %esi,%ebx
+  8019c0:	72 e8                	jb     8019aa <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  8019c2:	83 f8 41             	cmp    $0x41,%eax
+  8019c5:	77 2f                	ja     8019f6 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  8019c7:	50                   	push   %eax
+  8019c8:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  8019ce:	50                   	push   %eax
+  8019cf:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  8019d5:	ff 35 c8 70 80 00    	push   0x8070c8
+  8019db:	e8 02 1b 00 00       	call   8034e2 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  8019e0:	83 c4 0c             	add    $0xc,%esp
+  8019e3:	6a 00                	push   $0x0
+  8019e5:	6a 00                	push   $0x0
+  8019e7:	6a 00                	push   $0x0
+  8019e9:	e8 9e 19 00 00       	call   80338c <ipc_recv>
+}
+  8019ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019f1:	5b                   	pop    %ebx
+  8019f2:	5e                   	pop    %esi
+  8019f3:	5f                   	pop    %edi
+  8019f4:	5d                   	pop    %ebp
+  8019f5:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  8019f6:	68 14 3d 80 00       	push   $0x803d14
+  8019fb:	68 4c 3c 80 00       	push   $0x803c4c
+  801a00:	6a 40                	push   $0x40
+  801a02:	68 30 3d 80 00       	push   $0x803d30
+  801a07:	e8 41 e7 ff ff       	call   80014d <_panic>
+
+00801a0c <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801a0c:	55                   	push   %ebp
+  801a0d:	89 e5                	mov    %esp,%ebp
+  801a0f:	57                   	push   %edi
+  801a10:	56                   	push   %esi
+  801a11:	53                   	push   %ebx
+  801a12:	83 ec 1c             	sub    $0x1c,%esp
+  801a15:	89 c3                	mov    %eax,%ebx
+  801a17:	89 d6                	mov    %edx,%esi
+  801a19:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801a1c:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801a22:	89 ca                	mov    %ecx,%edx
+  801a24:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801a27:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801a2e:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801a31:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801a38:	8b 76 0c             	mov    0xc(%esi),%esi
+  801a3b:	89 fb                	mov    %edi,%ebx
+  801a3d:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801a44:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a47:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801a4e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a51:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801a58:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a5b:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801a62:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801a65:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801a6c:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801a71:	39 c8                	cmp    %ecx,%eax
+  801a73:	74 0d                	je     801a82 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801a75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a7d:	5b                   	pop    %ebx
+  801a7e:	5e                   	pop    %esi
+  801a7f:	5f                   	pop    %edi
+  801a80:	5d                   	pop    %ebp
+  801a81:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a82:	6a 07                	push   $0x7
+  801a84:	68 00 60 80 00       	push   $0x806000
+  801a89:	6a 0d                	push   $0xd
+  801a8b:	ff 35 c8 70 80 00    	push   0x8070c8
+  801a91:	e8 61 19 00 00       	call   8033f7 <ipc_send>
+  801a96:	83 c4 10             	add    $0x10,%esp
+  801a99:	eb da                	jmp    801a75 <fsring_post+0x69>
+
+00801a9b <fsipcv>:
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	57                   	push   %edi
+  801a9f:	56                   	push   %esi
+  801aa0:	53                   	push   %ebx
+  801aa1:	83 ec 0c             	sub    $0xc,%esp
+  801aa4:	89 c7                	mov    %eax,%edi
+  801aa6:	89 d3                	mov    %edx,%ebx
+  801aa8:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801aaa:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801ab1:	74 26                	je     801ad9 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ab3:	6a 07                	push   $0x7
+  801ab5:	68 00 60 80 00       	push   $0x806000
+  801aba:	57                   	push   %edi
+  801abb:	ff 35 c8 70 80 00    	push   0x8070c8
+  801ac1:	e8 31 19 00 00       	call   8033f7 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801ac6:	6a 00                	push   $0x0
+  801ac8:	56                   	push   %esi
+  801ac9:	53                   	push   %ebx
+  801aca:	6a 00                	push   $0x0
+  801acc:	e8 7e 19 00 00       	call   80344f <ipc_recvv>
+}
+  801ad1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ad4:	5b                   	pop    %ebx
+  801ad5:	5e                   	pop    %esi
+  801ad6:	5f                   	pop    %edi
+  801ad7:	5d                   	pop    %ebp
+  801ad8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ad9:	83 ec 0c             	sub    $0xc,%esp
+  801adc:	6a 01                	push   $0x1
+  801ade:	e8 4d 1a 00 00       	call   803530 <ipc_find_env>
+  801ae3:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801ae8:	83 c4 10             	add    $0x10,%esp
+  801aeb:	eb c6                	jmp    801ab3 <fsipcv+0x18>
+
+00801aed <fsipc>:
+{
+  801aed:	55                   	push   %ebp
+  801aee:	89 e5                	mov    %esp,%ebp
+  801af0:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801af3:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801afa:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801afd:	e8 99 ff ff ff       	call   801a9b <fsipcv>
+}
+  801b02:	c9                   	leave
+  801b03:	c3                   	ret
+
+00801b04 <file_write_direct>:
+{
+  801b04:	55                   	push   %ebp
+  801b05:	89 e5                	mov    %esp,%ebp
+  801b07:	56                   	push   %esi
+  801b08:	53                   	push   %ebx
+  801b09:	89 c3                	mov    %eax,%ebx
+  801b0b:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801b0d:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801b13:	77 40                	ja     801b55 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801b15:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801b1a:	39 c8                	cmp    %ecx,%eax
+  801b1c:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b1f:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801b22:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  801b28:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801b2d:	83 ec 04             	sub    $0x4,%esp
+  801b30:	50                   	push   %eax
+  801b31:	52                   	push   %edx
+  801b32:	68 08 60 80 00       	push   $0x806008
+  801b37:	e8 60 ee ff ff       	call   80099c <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801b3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b41:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b46:	e8 a2 ff ff ff       	call   801aed <fsipc>
+  801b4b:	83 c4 10             	add    $0x10,%esp
+}
+  801b4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b51:	5b                   	pop    %ebx
+  801b52:	5e                   	pop    %esi
+  801b53:	5d                   	pop    %ebp
+  801b54:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801b55:	89 d6                	mov    %edx,%esi
+  801b57:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801b5d:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b62:	29 f1                	sub    %esi,%ecx
+  801b64:	39 c1                	cmp    %eax,%ecx
+  801b66:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801b69:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b6c:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801b71:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801b77:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801b7d:	83 ec 0c             	sub    $0xc,%esp
+  801b80:	6a 05                	push   $0x5
+  801b82:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801b87:	e8 bf fd ff ff       	call   80194b <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801b8c:	83 c4 10             	add    $0x10,%esp
+  801b8f:	eb bd                	jmp    801b4e <file_write_direct+0x4a>
+
+00801b91 <devfile_sync>:
+{
+  801b91:	55                   	push   %ebp
+  801b92:	89 e5                	mov    %esp,%ebp
+  801b94:	57                   	push   %edi
+  801b95:	56                   	push   %esi
+  801b96:	53                   	push   %ebx
+  801b97:	83 ec 28             	sub    $0x28,%esp
+  801b9a:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801b9d:	56                   	push   %esi
+  801b9e:	e8 a5 f7 ff ff       	call   801348 <fd2data>
+  801ba3:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801ba5:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801ba8:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801baf:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801bb7:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801bbb:	74 45                	je     801c02 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801bbd:	8b 46 14             	mov    0x14(%esi),%eax
+  801bc0:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801bc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bcd:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801bd0:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801bd3:	39 cb                	cmp    %ecx,%ebx
+  801bd5:	73 14                	jae    801beb <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801bd7:	29 d9                	sub    %ebx,%ecx
+  801bd9:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801bdc:	89 f0                	mov    %esi,%eax
+  801bde:	e8 21 ff ff ff       	call   801b04 <file_write_direct>
+  801be3:	85 c0                	test   %eax,%eax
+  801be5:	7e 04                	jle    801beb <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801be7:	01 c3                	add    %eax,%ebx
+  801be9:	eb e5                	jmp    801bd0 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801beb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801bee:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801bf5:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801bf8:	85 c0                	test   %eax,%eax
+  801bfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bff:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801c02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c05:	5b                   	pop    %ebx
+  801c06:	5e                   	pop    %esi
+  801c07:	5f                   	pop    %edi
+  801c08:	5d                   	pop    %ebp
+  801c09:	c3                   	ret
+
+00801c0a <devfile_write>:
+{
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	57                   	push   %edi
+  801c0e:	56                   	push   %esi
+  801c0f:	53                   	push   %ebx
+  801c10:	83 ec 28             	sub    $0x28,%esp
+  801c13:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c16:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801c19:	53                   	push   %ebx
+  801c1a:	e8 29 f7 ff ff       	call   801348 <fd2data>
+  801c1f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801c22:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801c25:	83 c4 10             	add    $0x10,%esp
+  801c28:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801c2c:	74 43                	je     801c71 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801c2e:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801c35:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801c38:	85 c0                	test   %eax,%eax
+  801c3a:	74 43                	je     801c7f <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801c3c:	89 c2                	mov    %eax,%edx
+  801c3e:	03 53 14             	add    0x14(%ebx),%edx
+  801c41:	39 fa                	cmp    %edi,%edx
+  801c43:	75 0b                	jne    801c50 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801c45:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801c48:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801c4e:	76 66                	jbe    801cb6 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801c50:	83 ec 0c             	sub    $0xc,%esp
+  801c53:	53                   	push   %ebx
+  801c54:	e8 38 ff ff ff       	call   801b91 <devfile_sync>
+  801c59:	83 c4 10             	add    $0x10,%esp
+  801c5c:	85 c0                	test   %eax,%eax
+  801c5e:	78 4e                	js     801cae <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801c60:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801c66:	77 56                	ja     801cbe <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801c68:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801c6b:	85 c0                	test   %eax,%eax
+  801c6d:	75 20                	jne    801c8f <devfile_write+0x85>
+  801c6f:	eb 16                	jmp    801c87 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801c71:	89 f1                	mov    %esi,%ecx
+  801c73:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c76:	89 d8                	mov    %ebx,%eax
+  801c78:	e8 87 fe ff ff       	call   801b04 <file_write_direct>
+  801c7d:	eb 2f                	jmp    801cae <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801c7f:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801c85:	77 37                	ja     801cbe <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801c87:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801c8f:	83 ec 04             	sub    $0x4,%esp
+  801c92:	56                   	push   %esi
+  801c93:	ff 75 0c             	push   0xc(%ebp)
+  801c96:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801c99:	01 c1                	add    %eax,%ecx
+  801c9b:	51                   	push   %ecx
+  801c9c:	e8 fb ec ff ff       	call   80099c <memmove>
+	ff->buf_wlen += n;
+  801ca1:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801ca4:	01 f7                	add    %esi,%edi
+  801ca6:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801ca9:	89 f0                	mov    %esi,%eax
+  801cab:	83 c4 10             	add    $0x10,%esp
+}
+  801cae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cb1:	5b                   	pop    %ebx
+  801cb2:	5e                   	pop    %esi
+  801cb3:	5f                   	pop    %edi
+  801cb4:	5d                   	pop    %ebp
+  801cb5:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801cb6:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801cbc:	76 d1                	jbe    801c8f <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801cbe:	89 f1                	mov    %esi,%ecx
+  801cc0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cc3:	89 d8                	mov    %ebx,%eax
+  801cc5:	e8 3a fe ff ff       	call   801b04 <file_write_direct>
+  801cca:	eb e2                	jmp    801cae <devfile_write+0xa4>
+
+00801ccc <devfile_trunc>:
+{
+  801ccc:	55                   	push   %ebp
+  801ccd:	89 e5                	mov    %esp,%ebp
+  801ccf:	53                   	push   %ebx
+  801cd0:	83 ec 10             	sub    $0x10,%esp
+  801cd3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801cd6:	53                   	push   %ebx
+  801cd7:	e8 b5 fe ff ff       	call   801b91 <devfile_sync>
+  801cdc:	83 c4 10             	add    $0x10,%esp
+  801cdf:	85 c0                	test   %eax,%eax
+  801ce1:	78 1f                	js     801d02 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ce3:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801ce6:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801ceb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cee:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801cf3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf8:	b8 02 00 00 00       	mov    $0x2,%eax
+  801cfd:	e8 eb fd ff ff       	call   801aed <fsipc>
+}
+  801d02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d05:	c9                   	leave
+  801d06:	c3                   	ret
+
+00801d07 <devfile_stat>:
+{
+  801d07:	55                   	push   %ebp
+  801d08:	89 e5                	mov    %esp,%ebp
+  801d0a:	56                   	push   %esi
+  801d0b:	53                   	push   %ebx
+  801d0c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d0f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801d12:	83 ec 0c             	sub    $0xc,%esp
+  801d15:	53                   	push   %ebx
+  801d16:	e8 76 fe ff ff       	call   801b91 <devfile_sync>
+  801d1b:	83 c4 10             	add    $0x10,%esp
+  801d1e:	85 c0                	test   %eax,%eax
+  801d20:	78 47                	js     801d69 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d22:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801d25:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d2f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d34:	e8 b4 fd ff ff       	call   801aed <fsipc>
+  801d39:	85 c0                	test   %eax,%eax
+  801d3b:	78 2c                	js     801d69 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d3d:	83 ec 08             	sub    $0x8,%esp
+  801d40:	68 00 60 80 00       	push   $0x806000
+  801d45:	56                   	push   %esi
+  801d46:	e8 cb ea ff ff       	call   800816 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801d4b:	a1 80 60 80 00       	mov    0x806080,%eax
+  801d50:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d56:	a1 84 60 80 00       	mov    0x806084,%eax
+  801d5b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801d61:	83 c4 10             	add    $0x10,%esp
+  801d64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d6c:	5b                   	pop    %ebx
+  801d6d:	5e                   	pop    %esi
+  801d6e:	5d                   	pop    %ebp
+  801d6f:	c3                   	ret
+
+00801d70 <devfile_flush>:
+{
+  801d70:	55                   	push   %ebp
+  801d71:	89 e5                	mov    %esp,%ebp
+  801d73:	56                   	push   %esi
+  801d74:	53                   	push   %ebx
+  801d75:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801d78:	83 ec 0c             	sub    $0xc,%esp
+  801d7b:	56                   	push   %esi
+  801d7c:	e8 10 fe ff ff       	call   801b91 <devfile_sync>
+  801d81:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801d83:	83 c4 10             	add    $0x10,%esp
+  801d86:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801d8a:	75 25                	jne    801db1 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d8c:	8b 46 0c             	mov    0xc(%esi),%eax
+  801d8f:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801d94:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d99:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d9e:	e8 4a fd ff ff       	call   801aed <fsipc>
+  801da3:	85 c0                	test   %eax,%eax
+  801da5:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801da8:	89 d8                	mov    %ebx,%eax
+  801daa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dad:	5b                   	pop    %ebx
+  801dae:	5e                   	pop    %esi
+  801daf:	5d                   	pop    %ebp
+  801db0:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801db1:	83 ec 0c             	sub    $0xc,%esp
+  801db4:	56                   	push   %esi
+  801db5:	e8 8e f5 ff ff       	call   801348 <fd2data>
+  801dba:	83 c4 08             	add    $0x8,%esp
+  801dbd:	50                   	push   %eax
+  801dbe:	6a 00                	push   $0x0
+  801dc0:	e8 ea ee ff ff       	call   800caf <sys_page_unmap>
+  801dc5:	83 c4 10             	add    $0x10,%esp
+  801dc8:	eb c2                	jmp    801d8c <devfile_flush+0x1c>
+
+00801dca <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801dca:	55                   	push   %ebp
+  801dcb:	89 e5                	mov    %esp,%ebp
+  801dcd:	57                   	push   %edi
+  801dce:	56                   	push   %esi
+  801dcf:	53                   	push   %ebx
+  801dd0:	83 ec 64             	sub    $0x64,%esp
+  801dd3:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801dd5:	52                   	push   %edx
+  801dd6:	50                   	push   %eax
+  801dd7:	e8 d9 f5 ff ff       	call   8013b5 <fd_lookup>
+  801ddc:	89 c1                	mov    %eax,%ecx
+  801dde:	83 c4 10             	add    $0x10,%esp
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	0f 88 f2 00 00 00    	js     801edb <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801de9:	8b 07                	mov    (%edi),%eax
+  801deb:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801df1:	39 10                	cmp    %edx,(%eax)
+  801df3:	0f 85 03 01 00 00    	jne    801efc <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801df9:	a1 04 50 80 00       	mov    0x805004,%eax
+  801dfe:	8b 40 48             	mov    0x48(%eax),%eax
+  801e01:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801e07:	0f 84 96 00 00 00    	je     801ea3 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801e0d:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801e14:	0f 84 cb 00 00 00    	je     801ee5 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801e1a:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801e1f:	83 c8 07             	or     $0x7,%eax
+  801e22:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801e25:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801e28:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801e2d:	83 ec 04             	sub    $0x4,%esp
+  801e30:	68 07 04 00 00       	push   $0x407
+  801e35:	53                   	push   %ebx
+  801e36:	6a 00                	push   $0x0
+  801e38:	e8 e5 ed ff ff       	call   800c22 <sys_page_alloc>
+  801e3d:	89 c1                	mov    %eax,%ecx
+  801e3f:	83 c4 10             	add    $0x10,%esp
+  801e42:	85 c0                	test   %eax,%eax
+  801e44:	0f 88 91 00 00 00    	js     801edb <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801e4a:	89 d8                	mov    %ebx,%eax
+  801e4c:	83 c8 07             	or     $0x7,%eax
+  801e4f:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801e51:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e57:	83 c6 04             	add    $0x4,%esi
+  801e5a:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801e60:	75 cb                	jne    801e2d <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801e62:	6a 12                	push   $0x12
+  801e64:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801e67:	50                   	push   %eax
+  801e68:	6a 0c                	push   $0xc
+  801e6a:	ff 35 c8 70 80 00    	push   0x8070c8
+  801e70:	e8 6d 16 00 00       	call   8034e2 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801e75:	83 c4 0c             	add    $0xc,%esp
+  801e78:	6a 00                	push   $0x0
+  801e7a:	6a 00                	push   $0x0
+  801e7c:	6a 00                	push   $0x0
+  801e7e:	e8 09 15 00 00       	call   80338c <ipc_recv>
+  801e83:	89 c1                	mov    %eax,%ecx
+  801e85:	83 c4 10             	add    $0x10,%esp
+  801e88:	85 c0                	test   %eax,%eax
+  801e8a:	78 4f                	js     801edb <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801e8c:	a1 04 50 80 00       	mov    0x805004,%eax
+  801e91:	8b 40 48             	mov    0x48(%eax),%eax
+  801e94:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801e99:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801ea0:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801ea3:	83 ec 0c             	sub    $0xc,%esp
+  801ea6:	ff 37                	push   (%edi)
+  801ea8:	e8 e4 fc ff ff       	call   801b91 <devfile_sync>
+  801ead:	89 c1                	mov    %eax,%ecx
+  801eaf:	83 c4 10             	add    $0x10,%esp
+  801eb2:	85 c0                	test   %eax,%eax
+  801eb4:	78 25                	js     801edb <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801eb6:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801ebc:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801ec1:	ba 01 00 00 00       	mov    $0x1,%edx
+  801ec6:	89 d0                	mov    %edx,%eax
+  801ec8:	d3 e0                	shl    %cl,%eax
+  801eca:	85 d8                	test   %ebx,%eax
+  801ecc:	74 0d                	je     801edb <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801ece:	83 c1 01             	add    $0x1,%ecx
+  801ed1:	83 f9 10             	cmp    $0x10,%ecx
+  801ed4:	75 f0                	jne    801ec6 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801ed6:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801edb:	89 c8                	mov    %ecx,%eax
+  801edd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ee0:	5b                   	pop    %ebx
+  801ee1:	5e                   	pop    %esi
+  801ee2:	5f                   	pop    %edi
+  801ee3:	5d                   	pop    %ebp
+  801ee4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ee5:	83 ec 0c             	sub    $0xc,%esp
+  801ee8:	6a 01                	push   $0x1
+  801eea:	e8 41 16 00 00       	call   803530 <ipc_find_env>
+  801eef:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801ef4:	83 c4 10             	add    $0x10,%esp
+  801ef7:	e9 1e ff ff ff       	jmp    801e1a <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801efc:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801f01:	eb d8                	jmp    801edb <fsring_slot+0x111>
+
+00801f03 <file_read_direct>:
+{
+  801f03:	55                   	push   %ebp
+  801f04:	89 e5                	mov    %esp,%ebp
+  801f06:	57                   	push   %edi
+  801f07:	56                   	push   %esi
+  801f08:	53                   	push   %ebx
+  801f09:	83 ec 1c             	sub    $0x1c,%esp
+  801f0c:	89 c7                	mov    %eax,%edi
+  801f0e:	89 d6                	mov    %edx,%esi
+  801f10:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801f12:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801f18:	77 52                	ja     801f6c <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f1a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f1d:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801f22:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f28:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f2d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f32:	e8 b6 fb ff ff       	call   801aed <fsipc>
+  801f37:	89 c7                	mov    %eax,%edi
+  801f39:	85 c0                	test   %eax,%eax
+  801f3b:	78 25                	js     801f62 <file_read_direct+0x5f>
+	assert(r <= n);
+  801f3d:	39 c3                	cmp    %eax,%ebx
+  801f3f:	0f 82 87 00 00 00    	jb     801fcc <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801f45:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f4a:	0f 8f 95 00 00 00    	jg     801fe5 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f50:	83 ec 04             	sub    $0x4,%esp
+  801f53:	50                   	push   %eax
+  801f54:	68 00 60 80 00       	push   $0x806000
+  801f59:	56                   	push   %esi
+  801f5a:	e8 3d ea ff ff       	call   80099c <memmove>
+	return r;
+  801f5f:	83 c4 10             	add    $0x10,%esp
+}
+  801f62:	89 f8                	mov    %edi,%eax
+  801f64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f67:	5b                   	pop    %ebx
+  801f68:	5e                   	pop    %esi
+  801f69:	5f                   	pop    %edi
+  801f6a:	5d                   	pop    %ebp
+  801f6b:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801f6c:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801f72:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801f77:	29 d1                	sub    %edx,%ecx
+  801f79:	39 d9                	cmp    %ebx,%ecx
+  801f7b:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801f7e:	89 f0                	mov    %esi,%eax
+  801f80:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801f83:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801f86:	eb 0f                	jmp    801f97 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801f88:	0f b6 10             	movzbl (%eax),%edx
+  801f8b:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801f8d:	05 00 10 00 00       	add    $0x1000,%eax
+  801f92:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f97:	39 c8                	cmp    %ecx,%eax
+  801f99:	72 ed                	jb     801f88 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801f9b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f9e:	8b 47 0c             	mov    0xc(%edi),%eax
+  801fa1:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801fa6:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801fac:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801fb2:	83 ec 0c             	sub    $0xc,%esp
+  801fb5:	6a 07                	push   $0x7
+  801fb7:	89 d9                	mov    %ebx,%ecx
+  801fb9:	89 f2                	mov    %esi,%edx
+  801fbb:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fc0:	e8 86 f9 ff ff       	call   80194b <fsipc_pages>
+  801fc5:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801fc7:	83 c4 10             	add    $0x10,%esp
+  801fca:	eb 96                	jmp    801f62 <file_read_direct+0x5f>
+	assert(r <= n);
+  801fcc:	68 3b 3d 80 00       	push   $0x803d3b
+  801fd1:	68 4c 3c 80 00       	push   $0x803c4c
+  801fd6:	68 dc 00 00 00       	push   $0xdc
+  801fdb:	68 30 3d 80 00       	push   $0x803d30
+  801fe0:	e8 68 e1 ff ff       	call   80014d <_panic>
+	assert(r <= PGSIZE);
+  801fe5:	68 4c 3d 80 00       	push   $0x803d4c
+  801fea:	68 4c 3c 80 00       	push   $0x803c4c
+  801fef:	68 dd 00 00 00       	push   $0xdd
+  801ff4:	68 30 3d 80 00       	push   $0x803d30
+  801ff9:	e8 4f e1 ff ff       	call   80014d <_panic>
+
+00801ffe <devfile_read>:
+{
+  801ffe:	55                   	push   %ebp
+  801fff:	89 e5                	mov    %esp,%ebp
+  802001:	57                   	push   %edi
+  802002:	56                   	push   %esi
+  802003:	53                   	push   %ebx
+  802004:	83 ec 28             	sub    $0x28,%esp
+  802007:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80200a:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80200d:	53                   	push   %ebx
+  80200e:	e8 35 f3 ff ff       	call   801348 <fd2data>
+  802013:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  802016:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  802019:	83 c4 10             	add    $0x10,%esp
+  80201c:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  802020:	74 7d                	je     80209f <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802022:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802026:	0f 85 81 00 00 00    	jne    8020ad <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  80202c:	8b 43 18             	mov    0x18(%ebx),%eax
+  80202f:	85 c0                	test   %eax,%eax
+  802031:	74 0d                	je     802040 <devfile_read+0x42>
+  802033:	8b 53 14             	mov    0x14(%ebx),%edx
+  802036:	39 fa                	cmp    %edi,%edx
+  802038:	7f 06                	jg     802040 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  80203a:	01 c2                	add    %eax,%edx
+  80203c:	39 d7                	cmp    %edx,%edi
+  80203e:	72 28                	jb     802068 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  802040:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  802047:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80204d:	77 74                	ja     8020c3 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  80204f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802054:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802057:	89 d8                	mov    %ebx,%eax
+  802059:	e8 a5 fe ff ff       	call   801f03 <file_read_direct>
+  80205e:	85 c0                	test   %eax,%eax
+  802060:	7e 35                	jle    802097 <devfile_read+0x99>
+		ff->buf_base = pos;
+  802062:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  802065:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  802068:	8b 53 14             	mov    0x14(%ebx),%edx
+  80206b:	89 d0                	mov    %edx,%eax
+  80206d:	03 43 18             	add    0x18(%ebx),%eax
+  802070:	29 f8                	sub    %edi,%eax
+  802072:	39 f0                	cmp    %esi,%eax
+  802074:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  802077:	83 ec 04             	sub    $0x4,%esp
+  80207a:	56                   	push   %esi
+  80207b:	89 f8                	mov    %edi,%eax
+  80207d:	29 d0                	sub    %edx,%eax
+  80207f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802082:	01 c1                	add    %eax,%ecx
+  802084:	51                   	push   %ecx
+  802085:	ff 75 0c             	push   0xc(%ebp)
+  802088:	e8 0f e9 ff ff       	call   80099c <memmove>
+	fd->fd_offset = pos + n;
+  80208d:	01 f7                	add    %esi,%edi
+  80208f:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802092:	89 f0                	mov    %esi,%eax
+  802094:	83 c4 10             	add    $0x10,%esp
+}
+  802097:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80209a:	5b                   	pop    %ebx
+  80209b:	5e                   	pop    %esi
+  80209c:	5f                   	pop    %edi
+  80209d:	5d                   	pop    %ebp
+  80209e:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  80209f:	89 f1                	mov    %esi,%ecx
+  8020a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020a4:	89 d8                	mov    %ebx,%eax
+  8020a6:	e8 58 fe ff ff       	call   801f03 <file_read_direct>
+  8020ab:	eb ea                	jmp    802097 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8020ad:	83 ec 0c             	sub    $0xc,%esp
+  8020b0:	53                   	push   %ebx
+  8020b1:	e8 db fa ff ff       	call   801b91 <devfile_sync>
+  8020b6:	83 c4 10             	add    $0x10,%esp
+  8020b9:	85 c0                	test   %eax,%eax
+  8020bb:	0f 89 6b ff ff ff    	jns    80202c <devfile_read+0x2e>
+  8020c1:	eb d4                	jmp    802097 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  8020c3:	89 f1                	mov    %esi,%ecx
+  8020c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020c8:	89 d8                	mov    %ebx,%eax
+  8020ca:	e8 34 fe ff ff       	call   801f03 <file_read_direct>
+  8020cf:	eb c6                	jmp    802097 <devfile_read+0x99>
+
+008020d1 <open>:
+{
+  8020d1:	55                   	push   %ebp
+  8020d2:	89 e5                	mov    %esp,%ebp
+  8020d4:	56                   	push   %esi
+  8020d5:	53                   	push   %ebx
+  8020d6:	83 ec 1c             	sub    $0x1c,%esp
+  8020d9:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8020dc:	56                   	push   %esi
+  8020dd:	e8 f9 e6 ff ff       	call   8007db <strlen>
+  8020e2:	83 c4 10             	add    $0x10,%esp
+  8020e5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020ea:	0f 8f a0 00 00 00    	jg     802190 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  8020f0:	83 ec 0c             	sub    $0xc,%esp
+  8020f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020f6:	50                   	push   %eax
+  8020f7:	e8 63 f2 ff ff       	call   80135f <fd_alloc>
+  8020fc:	89 c3                	mov    %eax,%ebx
+  8020fe:	83 c4 10             	add    $0x10,%esp
+  802101:	85 c0                	test   %eax,%eax
+  802103:	78 45                	js     80214a <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  802105:	83 ec 08             	sub    $0x8,%esp
+  802108:	56                   	push   %esi
+  802109:	68 00 60 80 00       	push   $0x806000
+  80210e:	e8 03 e7 ff ff       	call   800816 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802113:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802116:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80211b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80211e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802123:	e8 c5 f9 ff ff       	call   801aed <fsipc>
+  802128:	89 c3                	mov    %eax,%ebx
+  80212a:	83 c4 10             	add    $0x10,%esp
+  80212d:	85 c0                	test   %eax,%eax
+  80212f:	78 22                	js     802153 <open+0x82>
+	if (!(mode & O_NOBUF)
+  802131:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  802138:	74 2b                	je     802165 <open+0x94>
+	return fd2num(fd);
+  80213a:	83 ec 0c             	sub    $0xc,%esp
+  80213d:	ff 75 f4             	push   -0xc(%ebp)
+  802140:	e8 f3 f1 ff ff       	call   801338 <fd2num>
+  802145:	89 c3                	mov    %eax,%ebx
+  802147:	83 c4 10             	add    $0x10,%esp
+}
+  80214a:	89 d8                	mov    %ebx,%eax
+  80214c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80214f:	5b                   	pop    %ebx
+  802150:	5e                   	pop    %esi
+  802151:	5d                   	pop    %ebp
+  802152:	c3                   	ret
+		fd_close(fd, 0);
+  802153:	83 ec 08             	sub    $0x8,%esp
+  802156:	6a 00                	push   $0x0
+  802158:	ff 75 f4             	push   -0xc(%ebp)
+  80215b:	e8 f8 f2 ff ff       	call   801458 <fd_close>
+		return r;
+  802160:	83 c4 10             	add    $0x10,%esp
+  802163:	eb e5                	jmp    80214a <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  802165:	83 ec 0c             	sub    $0xc,%esp
+  802168:	ff 75 f4             	push   -0xc(%ebp)
+  80216b:	e8 d8 f1 ff ff       	call   801348 <fd2data>
+  802170:	83 c4 0c             	add    $0xc,%esp
+  802173:	68 07 04 00 00       	push   $0x407
+  802178:	50                   	push   %eax
+  802179:	6a 00                	push   $0x0
+  80217b:	e8 a2 ea ff ff       	call   800c22 <sys_page_alloc>
+  802180:	83 c4 10             	add    $0x10,%esp
+  802183:	85 c0                	test   %eax,%eax
+  802185:	75 b3                	jne    80213a <open+0x69>
+		fd->fd_file.buffered = 1;
+  802187:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80218a:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  80218e:	eb aa                	jmp    80213a <open+0x69>
+		return -E_BAD_PATH;
+  802190:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802195:	eb b3                	jmp    80214a <open+0x79>
+
+00802197 <readdir>:
+{
+  802197:	55                   	push   %ebp
+  802198:	89 e5                	mov    %esp,%ebp
+  80219a:	53                   	push   %ebx
+  80219b:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80219e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021a1:	50                   	push   %eax
+  8021a2:	ff 75 08             	push   0x8(%ebp)
+  8021a5:	e8 0b f2 ff ff       	call   8013b5 <fd_lookup>
+  8021aa:	89 c3                	mov    %eax,%ebx
+  8021ac:	83 c4 10             	add    $0x10,%esp
+  8021af:	85 c0                	test   %eax,%eax
+  8021b1:	78 73                	js     802226 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8021b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021b6:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8021bc:	39 08                	cmp    %ecx,(%eax)
+  8021be:	0f 85 82 00 00 00    	jne    802246 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  8021c4:	83 ec 0c             	sub    $0xc,%esp
+  8021c7:	50                   	push   %eax
+  8021c8:	e8 c4 f9 ff ff       	call   801b91 <devfile_sync>
+  8021cd:	89 c3                	mov    %eax,%ebx
+  8021cf:	83 c4 10             	add    $0x10,%esp
+  8021d2:	85 c0                	test   %eax,%eax
+  8021d4:	78 50                	js     802226 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  8021d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021d9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021dc:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  8021e1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8021e4:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  8021e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021ec:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  8021f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8021fb:	e8 ed f8 ff ff       	call   801aed <fsipc>
+  802200:	89 c3                	mov    %eax,%ebx
+  802202:	85 c0                	test   %eax,%eax
+  802204:	7e 20                	jle    802226 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  802206:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802209:	72 22                	jb     80222d <readdir+0x96>
+  80220b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802210:	7f 1b                	jg     80222d <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802212:	83 ec 04             	sub    $0x4,%esp
+  802215:	50                   	push   %eax
+  802216:	68 00 60 80 00       	push   $0x806000
+  80221b:	ff 75 0c             	push   0xc(%ebp)
+  80221e:	e8 79 e7 ff ff       	call   80099c <memmove>
+	return r;
+  802223:	83 c4 10             	add    $0x10,%esp
+}
+  802226:	89 d8                	mov    %ebx,%eax
+  802228:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80222b:	c9                   	leave
+  80222c:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  80222d:	68 42 3d 80 00       	push   $0x803d42
+  802232:	68 4c 3c 80 00       	push   $0x803c4c
+  802237:	68 86 01 00 00       	push   $0x186
+  80223c:	68 30 3d 80 00       	push   $0x803d30
+  802241:	e8 07 df ff ff       	call   80014d <_panic>
+		return -E_NOT_SUPP;
+  802246:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80224b:	eb d9                	jmp    802226 <readdir+0x8f>
+
+0080224d <munmap>:
+{
+  80224d:	55                   	push   %ebp
+  80224e:	89 e5                	mov    %esp,%ebp
+  802250:	56                   	push   %esi
+  802251:	53                   	push   %ebx
+  802252:	8b 75 08             	mov    0x8(%ebp),%esi
+  802255:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802258:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  80225e:	75 41                	jne    8022a1 <munmap+0x54>
+  802260:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  802266:	77 39                	ja     8022a1 <munmap+0x54>
+  802268:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80226d:	29 f0                	sub    %esi,%eax
+  80226f:	39 d0                	cmp    %edx,%eax
+  802271:	72 35                	jb     8022a8 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802273:	89 f3                	mov    %esi,%ebx
+  802275:	01 d6                	add    %edx,%esi
+  802277:	39 f3                	cmp    %esi,%ebx
+  802279:	73 1a                	jae    802295 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  80227b:	83 ec 08             	sub    $0x8,%esp
+  80227e:	53                   	push   %ebx
+  80227f:	6a 00                	push   $0x0
+  802281:	e8 29 ea ff ff       	call   800caf <sys_page_unmap>
+  802286:	83 c4 10             	add    $0x10,%esp
+  802289:	85 c0                	test   %eax,%eax
+  80228b:	78 0d                	js     80229a <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80228d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802293:	eb e2                	jmp    802277 <munmap+0x2a>
+	return 0;
+  802295:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80229a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80229d:	5b                   	pop    %ebx
+  80229e:	5e                   	pop    %esi
+  80229f:	5d                   	pop    %ebp
+  8022a0:	c3                   	ret
+		return -E_INVAL;
+  8022a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022a6:	eb f2                	jmp    80229a <munmap+0x4d>
+  8022a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022ad:	eb eb                	jmp    80229a <munmap+0x4d>
+
+008022af <mmap>:
+{
+  8022af:	55                   	push   %ebp
+  8022b0:	89 e5                	mov    %esp,%ebp
+  8022b2:	57                   	push   %edi
+  8022b3:	56                   	push   %esi
+  8022b4:	53                   	push   %ebx
+  8022b5:	83 ec 34             	sub    $0x34,%esp
+  8022b8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022bb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022be:	50                   	push   %eax
+  8022bf:	ff 75 18             	push   0x18(%ebp)
+  8022c2:	e8 ee f0 ff ff       	call   8013b5 <fd_lookup>
+  8022c7:	89 c3                	mov    %eax,%ebx
+  8022c9:	83 c4 10             	add    $0x10,%esp
+  8022cc:	85 c0                	test   %eax,%eax
+  8022ce:	0f 88 0e 01 00 00    	js     8023e2 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8022d4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8022d7:	a1 20 40 80 00       	mov    0x804020,%eax
+  8022dc:	39 02                	cmp    %eax,(%edx)
+  8022de:	0f 85 50 01 00 00    	jne    802434 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  8022e4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022e7:	83 e0 02             	and    $0x2,%eax
+  8022ea:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8022ed:	74 0a                	je     8022f9 <mmap+0x4a>
+  8022ef:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8022f3:	0f 84 42 01 00 00    	je     80243b <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  8022f9:	8b 42 08             	mov    0x8(%edx),%eax
+  8022fc:	83 e0 03             	and    $0x3,%eax
+  8022ff:	83 f8 01             	cmp    $0x1,%eax
+  802302:	0f 84 3a 01 00 00    	je     802442 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802308:	8b 45 08             	mov    0x8(%ebp),%eax
+  80230b:	0b 45 1c             	or     0x1c(%ebp),%eax
+  80230e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802313:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802316:	0f 85 2d 01 00 00    	jne    802449 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80231c:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802320:	0f 88 2a 01 00 00    	js     802450 <mmap+0x1a1>
+  802326:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80232d:	0f 87 1d 01 00 00    	ja     802450 <mmap+0x1a1>
+  802333:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802338:	2b 45 08             	sub    0x8(%ebp),%eax
+  80233b:	39 f8                	cmp    %edi,%eax
+  80233d:	0f 82 14 01 00 00    	jb     802457 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802343:	83 ec 0c             	sub    $0xc,%esp
+  802346:	52                   	push   %edx
+  802347:	e8 45 f8 ff ff       	call   801b91 <devfile_sync>
+  80234c:	89 c3                	mov    %eax,%ebx
+  80234e:	83 c4 10             	add    $0x10,%esp
+  802351:	85 c0                	test   %eax,%eax
+  802353:	0f 88 89 00 00 00    	js     8023e2 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802359:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  80235f:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802365:	be 00 00 00 00       	mov    $0x0,%esi
+  80236a:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  80236d:	39 fe                	cmp    %edi,%esi
+  80236f:	73 7b                	jae    8023ec <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  802371:	89 f8                	mov    %edi,%eax
+  802373:	29 f0                	sub    %esi,%eax
+  802375:	c1 e8 0c             	shr    $0xc,%eax
+  802378:	ba 40 00 00 00       	mov    $0x40,%edx
+  80237d:	39 d0                	cmp    %edx,%eax
+  80237f:	0f 47 c2             	cmova  %edx,%eax
+  802382:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802385:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802388:	8b 52 0c             	mov    0xc(%edx),%edx
+  80238b:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  802391:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802394:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  80239a:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  80239f:	89 f2                	mov    %esi,%edx
+  8023a1:	03 55 08             	add    0x8(%ebp),%edx
+  8023a4:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8023a7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8023ac:	e8 ea f6 ff ff       	call   801a9b <fsipcv>
+  8023b1:	85 c0                	test   %eax,%eax
+  8023b3:	7e 12                	jle    8023c7 <mmap+0x118>
+  8023b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8023b8:	85 c0                	test   %eax,%eax
+  8023ba:	0f 84 9e 00 00 00    	je     80245e <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8023c0:	c1 e0 0c             	shl    $0xc,%eax
+  8023c3:	01 c6                	add    %eax,%esi
+  8023c5:	eb a6                	jmp    80236d <mmap+0xbe>
+			munmap(addr, done);
+  8023c7:	89 c3                	mov    %eax,%ebx
+  8023c9:	83 ec 08             	sub    $0x8,%esp
+  8023cc:	56                   	push   %esi
+  8023cd:	ff 75 08             	push   0x8(%ebp)
+  8023d0:	e8 78 fe ff ff       	call   80224d <munmap>
+			return r < 0 ? r : -E_INVAL;
+  8023d5:	83 c4 10             	add    $0x10,%esp
+  8023d8:	85 db                	test   %ebx,%ebx
+  8023da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023df:	0f 49 d8             	cmovns %eax,%ebx
+}
+  8023e2:	89 d8                	mov    %ebx,%eax
+  8023e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023e7:	5b                   	pop    %ebx
+  8023e8:	5e                   	pop    %esi
+  8023e9:	5f                   	pop    %edi
+  8023ea:	5d                   	pop    %ebp
+  8023eb:	c3                   	ret
+	if (prot & PROT_WRITE)
+  8023ec:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8023ef:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8023f1:	85 c0                	test   %eax,%eax
+  8023f3:	74 ed                	je     8023e2 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8023f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8023fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8023fd:	39 fe                	cmp    %edi,%esi
+  8023ff:	73 2e                	jae    80242f <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802401:	83 ec 0c             	sub    $0xc,%esp
+  802404:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802407:	50                   	push   %eax
+  802408:	e8 2d ed ff ff       	call   80113a <cowpage>
+  80240d:	83 c4 10             	add    $0x10,%esp
+  802410:	85 c0                	test   %eax,%eax
+  802412:	78 08                	js     80241c <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802414:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80241a:	eb e1                	jmp    8023fd <mmap+0x14e>
+				munmap(addr, len);
+  80241c:	89 c3                	mov    %eax,%ebx
+  80241e:	83 ec 08             	sub    $0x8,%esp
+  802421:	57                   	push   %edi
+  802422:	ff 75 08             	push   0x8(%ebp)
+  802425:	e8 23 fe ff ff       	call   80224d <munmap>
+				return r;
+  80242a:	83 c4 10             	add    $0x10,%esp
+  80242d:	eb b3                	jmp    8023e2 <mmap+0x133>
+	return 0;
+  80242f:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802432:	eb ae                	jmp    8023e2 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802434:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802439:	eb a7                	jmp    8023e2 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80243b:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802440:	eb a0                	jmp    8023e2 <mmap+0x133>
+		return -E_INVAL;
+  802442:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802447:	eb 99                	jmp    8023e2 <mmap+0x133>
+  802449:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80244e:	eb 92                	jmp    8023e2 <mmap+0x133>
+  802450:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802455:	eb 8b                	jmp    8023e2 <mmap+0x133>
+  802457:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80245c:	eb 84                	jmp    8023e2 <mmap+0x133>
+			munmap(addr, done);
+  80245e:	83 ec 08             	sub    $0x8,%esp
+  802461:	56                   	push   %esi
+  802462:	ff 75 08             	push   0x8(%ebp)
+  802465:	e8 e3 fd ff ff       	call   80224d <munmap>
+  80246a:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  80246d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802472:	e9 6b ff ff ff       	jmp    8023e2 <mmap+0x133>
+
+00802477 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802477:	55                   	push   %ebp
+  802478:	89 e5                	mov    %esp,%ebp
+  80247a:	56                   	push   %esi
+  80247b:	53                   	push   %ebx
+  80247c:	83 ec 10             	sub    $0x10,%esp
+  80247f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802482:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802485:	8b 45 08             	mov    0x8(%ebp),%eax
+  802488:	e8 3d f9 ff ff       	call   801dca <fsring_slot>
+  80248d:	85 c0                	test   %eax,%eax
+  80248f:	78 60                	js     8024f1 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802491:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802494:	8b 56 08             	mov    0x8(%esi),%edx
+  802497:	83 e2 03             	and    $0x3,%edx
+  80249a:	83 fa 01             	cmp    $0x1,%edx
+  80249d:	74 59                	je     8024f8 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  80249f:	ba 01 00 00 00       	mov    $0x1,%edx
+  8024a4:	89 c1                	mov    %eax,%ecx
+  8024a6:	d3 e2                	shl    %cl,%edx
+  8024a8:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8024ae:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8024b1:	c1 e2 02             	shl    $0x2,%edx
+  8024b4:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8024ba:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  8024c1:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8024c4:	8b 55 18             	mov    0x18(%ebp),%edx
+  8024c7:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8024ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024cd:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8024d0:	83 ec 08             	sub    $0x8,%esp
+  8024d3:	50                   	push   %eax
+  8024d4:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8024d9:	39 c3                	cmp    %eax,%ebx
+  8024db:	0f 47 d8             	cmova  %eax,%ebx
+  8024de:	53                   	push   %ebx
+  8024df:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8024e2:	89 f2                	mov    %esi,%edx
+  8024e4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024e9:	e8 1e f5 ff ff       	call   801a0c <fsring_post>
+  8024ee:	83 c4 10             	add    $0x10,%esp
+}
+  8024f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024f4:	5b                   	pop    %ebx
+  8024f5:	5e                   	pop    %esi
+  8024f6:	5d                   	pop    %ebp
+  8024f7:	c3                   	ret
+		return -E_INVAL;
+  8024f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024fd:	eb f2                	jmp    8024f1 <fsring_read+0x7a>
+
+008024ff <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8024ff:	55                   	push   %ebp
+  802500:	89 e5                	mov    %esp,%ebp
+  802502:	56                   	push   %esi
+  802503:	53                   	push   %ebx
+  802504:	83 ec 10             	sub    $0x10,%esp
+  802507:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80250a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80250d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802510:	e8 b5 f8 ff ff       	call   801dca <fsring_slot>
+  802515:	89 c3                	mov    %eax,%ebx
+  802517:	85 c0                	test   %eax,%eax
+  802519:	78 77                	js     802592 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80251b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80251e:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802522:	74 77                	je     80259b <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802524:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802529:	39 c6                	cmp    %eax,%esi
+  80252b:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80252e:	83 ec 04             	sub    $0x4,%esp
+  802531:	56                   	push   %esi
+  802532:	ff 75 0c             	push   0xc(%ebp)
+  802535:	89 d8                	mov    %ebx,%eax
+  802537:	c1 e0 0c             	shl    $0xc,%eax
+  80253a:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802540:	50                   	push   %eax
+  802541:	e8 56 e4 ff ff       	call   80099c <memmove>
+	fsring_busy |= 1 << slot;
+  802546:	b8 01 00 00 00       	mov    $0x1,%eax
+  80254b:	89 d9                	mov    %ebx,%ecx
+  80254d:	d3 e0                	shl    %cl,%eax
+  80254f:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802555:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802558:	c1 e0 02             	shl    $0x2,%eax
+  80255b:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  802561:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  802568:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80256b:	8b 45 18             	mov    0x18(%ebp),%eax
+  80256e:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  802571:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802578:	83 c4 08             	add    $0x8,%esp
+  80257b:	53                   	push   %ebx
+  80257c:	56                   	push   %esi
+  80257d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802580:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802583:	b8 04 00 00 00       	mov    $0x4,%eax
+  802588:	e8 7f f4 ff ff       	call   801a0c <fsring_post>
+  80258d:	89 c3                	mov    %eax,%ebx
+  80258f:	83 c4 10             	add    $0x10,%esp
+}
+  802592:	89 d8                	mov    %ebx,%eax
+  802594:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802597:	5b                   	pop    %ebx
+  802598:	5e                   	pop    %esi
+  802599:	5d                   	pop    %ebp
+  80259a:	c3                   	ret
+		return -E_INVAL;
+  80259b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025a0:	eb f0                	jmp    802592 <fsring_write+0x93>
+
+008025a2 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8025a2:	55                   	push   %ebp
+  8025a3:	89 e5                	mov    %esp,%ebp
+  8025a5:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8025a8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ae:	e8 17 f8 ff ff       	call   801dca <fsring_slot>
+  8025b3:	85 c0                	test   %eax,%eax
+  8025b5:	78 4c                	js     802603 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8025b7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8025bc:	89 c1                	mov    %eax,%ecx
+  8025be:	d3 e2                	shl    %cl,%edx
+  8025c0:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8025c6:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8025c9:	c1 e2 02             	shl    $0x2,%edx
+  8025cc:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8025d2:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  8025d9:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8025dc:	8b 55 10             	mov    0x10(%ebp),%edx
+  8025df:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8025e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025e5:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  8025e8:	83 ec 08             	sub    $0x8,%esp
+  8025eb:	50                   	push   %eax
+  8025ec:	6a 00                	push   $0x0
+  8025ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025f3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025f6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8025fb:	e8 0c f4 ff ff       	call   801a0c <fsring_post>
+  802600:	83 c4 10             	add    $0x10,%esp
+}
+  802603:	c9                   	leave
+  802604:	c3                   	ret
+
+00802605 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802605:	55                   	push   %ebp
+  802606:	89 e5                	mov    %esp,%ebp
+  802608:	57                   	push   %edi
+  802609:	56                   	push   %esi
+  80260a:	53                   	push   %ebx
+  80260b:	83 ec 1c             	sub    $0x1c,%esp
+  80260e:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802612:	a1 04 50 80 00       	mov    0x805004,%eax
+  802617:	8b 40 48             	mov    0x48(%eax),%eax
+  80261a:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  802620:	74 12                	je     802634 <fsring_reap+0x2f>
+		return 0;
+  802622:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802627:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80262a:	5b                   	pop    %ebx
+  80262b:	5e                   	pop    %esi
+  80262c:	5f                   	pop    %edi
+  80262d:	5d                   	pop    %ebp
+  80262e:	c3                   	ret
+		sys_yield();
+  80262f:	e8 cf e5 ff ff       	call   800c03 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802634:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  80263a:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80263f:	39 c2                	cmp    %eax,%edx
+  802641:	75 18                	jne    80265b <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802643:	84 db                	test   %bl,%bl
+  802645:	0f 84 21 01 00 00    	je     80276c <fsring_reap+0x167>
+  80264b:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  802652:	75 db                	jne    80262f <fsring_reap+0x2a>
+			return 0;
+  802654:	b8 00 00 00 00       	mov    $0x0,%eax
+  802659:	eb cc                	jmp    802627 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  80265b:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802660:	83 e0 0f             	and    $0xf,%eax
+  802663:	83 c0 2a             	add    $0x2a,%eax
+  802666:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  80266d:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802674:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802679:	83 c0 01             	add    $0x1,%eax
+  80267c:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802681:	83 fb 0f             	cmp    $0xf,%ebx
+  802684:	77 5b                	ja     8026e1 <fsring_reap+0xdc>
+  802686:	be 01 00 00 00       	mov    $0x1,%esi
+  80268b:	89 d9                	mov    %ebx,%ecx
+  80268d:	d3 e6                	shl    %cl,%esi
+  80268f:	89 f0                	mov    %esi,%eax
+  802691:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  802697:	74 48                	je     8026e1 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802699:	89 d8                	mov    %ebx,%eax
+  80269b:	c1 e0 0c             	shl    $0xc,%eax
+  80269e:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8026a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8026a7:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8026aa:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  8026b1:	83 f8 03             	cmp    $0x3,%eax
+  8026b4:	74 40                	je     8026f6 <fsring_reap+0xf1>
+  8026b6:	83 f8 05             	cmp    $0x5,%eax
+  8026b9:	74 64                	je     80271f <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8026bb:	f7 d6                	not    %esi
+  8026bd:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8026c3:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8026c6:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  8026cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026d0:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8026d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026d5:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8026d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026dc:	e9 46 ff ff ff       	jmp    802627 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8026e1:	53                   	push   %ebx
+  8026e2:	68 58 3d 80 00       	push   $0x803d58
+  8026e7:	68 8f 02 00 00       	push   $0x28f
+  8026ec:	68 30 3d 80 00       	push   $0x803d30
+  8026f1:	e8 57 da ff ff       	call   80014d <_panic>
+		if (cqe.cqe_result > 0)
+  8026f6:	85 ff                	test   %edi,%edi
+  8026f8:	7e c1                	jle    8026bb <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8026fa:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8026fd:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802702:	39 c7                	cmp    %eax,%edi
+  802704:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802707:	50                   	push   %eax
+  802708:	ff 75 e4             	push   -0x1c(%ebp)
+  80270b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80270e:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  802715:	e8 82 e2 ff ff       	call   80099c <memmove>
+  80271a:	83 c4 10             	add    $0x10,%esp
+  80271d:	eb 9c                	jmp    8026bb <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80271f:	85 ff                	test   %edi,%edi
+  802721:	75 98                	jne    8026bb <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802723:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802726:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80272d:	83 ec 08             	sub    $0x8,%esp
+  802730:	ff 75 e4             	push   -0x1c(%ebp)
+  802733:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802736:	51                   	push   %ecx
+  802737:	e8 da e0 ff ff       	call   800816 <strcpy>
+			st->st_size = ret->ret_size;
+  80273c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80273f:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802745:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802748:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80274e:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802754:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  80275a:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  802761:	40 80 00 
+  802764:	83 c4 10             	add    $0x10,%esp
+  802767:	e9 4f ff ff ff       	jmp    8026bb <fsring_reap+0xb6>
+			return 0;
+  80276c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802771:	e9 b1 fe ff ff       	jmp    802627 <fsring_reap+0x22>
+
+00802776 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802776:	55                   	push   %ebp
+  802777:	89 e5                	mov    %esp,%ebp
+  802779:	57                   	push   %edi
+  80277a:	56                   	push   %esi
+  80277b:	53                   	push   %ebx
+  80277c:	83 ec 28             	sub    $0x28,%esp
+  80277f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802782:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802785:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802788:	53                   	push   %ebx
+  802789:	e8 4d e0 ff ff       	call   8007db <strlen>
+  80278e:	83 c4 10             	add    $0x10,%esp
+  802791:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802796:	0f 8f 02 01 00 00    	jg     80289e <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  80279c:	83 ec 08             	sub    $0x8,%esp
+  80279f:	53                   	push   %ebx
+  8027a0:	68 00 60 80 00       	push   $0x806000
+  8027a5:	e8 6c e0 ff ff       	call   800816 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8027aa:	83 c4 10             	add    $0x10,%esp
+  8027ad:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8027b3:	76 69                	jbe    80281e <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8027b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027b8:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8027be:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8027c3:	29 d1                	sub    %edx,%ecx
+  8027c5:	39 f9                	cmp    %edi,%ecx
+  8027c7:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8027ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027cd:	89 f9                	mov    %edi,%ecx
+  8027cf:	01 c1                	add    %eax,%ecx
+  8027d1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8027d4:	eb 0f                	jmp    8027e5 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  8027d6:	0f b6 10             	movzbl (%eax),%edx
+  8027d9:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8027db:	05 00 10 00 00       	add    $0x1000,%eax
+  8027e0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8027e5:	39 c8                	cmp    %ecx,%eax
+  8027e7:	72 ed                	jb     8027d6 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  8027e9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8027ec:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  8027f2:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8027f8:	83 ec 0c             	sub    $0xc,%esp
+  8027fb:	6a 07                	push   $0x7
+  8027fd:	89 f9                	mov    %edi,%ecx
+  8027ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802802:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802807:	e8 3f f1 ff ff       	call   80194b <fsipc_pages>
+  80280c:	89 c7                	mov    %eax,%edi
+  80280e:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802811:	85 f6                	test   %esi,%esi
+  802813:	74 7f                	je     802894 <file_slurp+0x11e>
+  802815:	8d 43 01             	lea    0x1(%ebx),%eax
+  802818:	85 ff                	test   %edi,%edi
+  80281a:	79 3c                	jns    802858 <file_slurp+0xe2>
+  80281c:	eb 76                	jmp    802894 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  80281e:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802824:	ba 00 00 00 00       	mov    $0x0,%edx
+  802829:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80282e:	e8 ba f2 ff ff       	call   801aed <fsipc>
+  802833:	89 c7                	mov    %eax,%edi
+  802835:	85 c0                	test   %eax,%eax
+  802837:	7e d8                	jle    802811 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802839:	83 ec 04             	sub    $0x4,%esp
+  80283c:	50                   	push   %eax
+  80283d:	68 08 60 80 00       	push   $0x806008
+  802842:	ff 75 0c             	push   0xc(%ebp)
+  802845:	e8 52 e1 ff ff       	call   80099c <memmove>
+  80284a:	83 c4 10             	add    $0x10,%esp
+  80284d:	eb c2                	jmp    802811 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  80284f:	80 fa 2f             	cmp    $0x2f,%dl
+  802852:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802855:	83 c0 01             	add    $0x1,%eax
+  802858:	89 c1                	mov    %eax,%ecx
+  80285a:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  80285e:	84 d2                	test   %dl,%dl
+  802860:	75 ed                	jne    80284f <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802862:	83 ec 04             	sub    $0x4,%esp
+  802865:	68 80 00 00 00       	push   $0x80
+  80286a:	53                   	push   %ebx
+  80286b:	56                   	push   %esi
+  80286c:	e8 1b e0 ff ff       	call   80088c <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802871:	a1 00 60 80 00       	mov    0x806000,%eax
+  802876:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  80287c:	a1 04 60 80 00       	mov    0x806004,%eax
+  802881:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802887:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  80288e:	40 80 00 
+  802891:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802894:	89 f8                	mov    %edi,%eax
+  802896:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802899:	5b                   	pop    %ebx
+  80289a:	5e                   	pop    %esi
+  80289b:	5f                   	pop    %edi
+  80289c:	5d                   	pop    %ebp
+  80289d:	c3                   	ret
+		return -E_BAD_PATH;
+  80289e:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8028a3:	eb ef                	jmp    802894 <file_slurp+0x11e>
+
+008028a5 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8028a5:	55                   	push   %ebp
+  8028a6:	89 e5                	mov    %esp,%ebp
+  8028a8:	53                   	push   %ebx
+  8028a9:	83 ec 10             	sub    $0x10,%esp
+  8028ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8028af:	53                   	push   %ebx
+  8028b0:	e8 26 df ff ff       	call   8007db <strlen>
+  8028b5:	83 c4 10             	add    $0x10,%esp
+  8028b8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8028bd:	7f 25                	jg     8028e4 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8028bf:	83 ec 08             	sub    $0x8,%esp
+  8028c2:	53                   	push   %ebx
+  8028c3:	68 00 60 80 00       	push   $0x806000
+  8028c8:	e8 49 df ff ff       	call   800816 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8028cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028d2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8028d7:	e8 11 f2 ff ff       	call   801aed <fsipc>
+  8028dc:	83 c4 10             	add    $0x10,%esp
+}
+  8028df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028e2:	c9                   	leave
+  8028e3:	c3                   	ret
+		return -E_BAD_PATH;
+  8028e4:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8028e9:	eb f4                	jmp    8028df <remove+0x3a>
+
+008028eb <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8028eb:	55                   	push   %ebp
+  8028ec:	89 e5                	mov    %esp,%ebp
+  8028ee:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8028f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028f6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8028fb:	e8 ed f1 ff ff       	call   801aed <fsipc>
+}
+  802900:	c9                   	leave
+  802901:	c3                   	ret
+
+00802902 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802902:	55                   	push   %ebp
+  802903:	89 e5                	mov    %esp,%ebp
+  802905:	57                   	push   %edi
+  802906:	56                   	push   %esi
+  802907:	53                   	push   %ebx
+  802908:	83 ec 18             	sub    $0x18,%esp
+  80290b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80290e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802911:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802914:	57                   	push   %edi
+  802915:	e8 c1 de ff ff       	call   8007db <strlen>
+  80291a:	83 c4 10             	add    $0x10,%esp
+  80291d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802922:	7f 4c                	jg     802970 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802924:	83 ec 08             	sub    $0x8,%esp
+  802927:	57                   	push   %edi
+  802928:	68 00 60 80 00       	push   $0x806000
+  80292d:	e8 e4 de ff ff       	call   800816 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802932:	ba 00 00 00 00       	mov    $0x0,%edx
+  802937:	b8 10 00 00 00       	mov    $0x10,%eax
+  80293c:	e8 ac f1 ff ff       	call   801aed <fsipc>
+  802941:	83 c4 10             	add    $0x10,%esp
+  802944:	85 c0                	test   %eax,%eax
+  802946:	78 20                	js     802968 <defrag+0x66>
+		return r;
+	if (before)
+  802948:	85 f6                	test   %esi,%esi
+  80294a:	74 07                	je     802953 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  80294c:	a1 00 60 80 00       	mov    0x806000,%eax
+  802951:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802953:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802958:	85 db                	test   %ebx,%ebx
+  80295a:	74 0c                	je     802968 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  80295c:	a1 04 60 80 00       	mov    0x806004,%eax
+  802961:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802963:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802968:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80296b:	5b                   	pop    %ebx
+  80296c:	5e                   	pop    %esi
+  80296d:	5f                   	pop    %edi
+  80296e:	5d                   	pop    %ebp
+  80296f:	c3                   	ret
+		return -E_BAD_PATH;
+  802970:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802975:	eb f1                	jmp    802968 <defrag+0x66>
+
+00802977 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802977:	55                   	push   %ebp
+  802978:	89 e5                	mov    %esp,%ebp
+  80297a:	53                   	push   %ebx
+  80297b:	83 ec 04             	sub    $0x4,%esp
+  80297e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802981:	ba 00 00 00 00       	mov    $0x0,%edx
+  802986:	b8 11 00 00 00       	mov    $0x11,%eax
+  80298b:	e8 5d f1 ff ff       	call   801aed <fsipc>
+  802990:	85 c0                	test   %eax,%eax
+  802992:	78 34                	js     8029c8 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802994:	a1 00 60 80 00       	mov    0x806000,%eax
+  802999:	89 03                	mov    %eax,(%ebx)
+  80299b:	a1 04 60 80 00       	mov    0x806004,%eax
+  8029a0:	89 43 04             	mov    %eax,0x4(%ebx)
+  8029a3:	a1 08 60 80 00       	mov    0x806008,%eax
+  8029a8:	89 43 08             	mov    %eax,0x8(%ebx)
+  8029ab:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  8029b0:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8029b3:	a1 10 60 80 00       	mov    0x806010,%eax
+  8029b8:	89 43 10             	mov    %eax,0x10(%ebx)
+  8029bb:	a1 14 60 80 00       	mov    0x806014,%eax
+  8029c0:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  8029c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029cb:	c9                   	leave
+  8029cc:	c3                   	ret
+
+008029cd <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8029cd:	55                   	push   %ebp
+  8029ce:	89 e5                	mov    %esp,%ebp
+  8029d0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8029d3:	68 71 3d 80 00       	push   $0x803d71
+  8029d8:	ff 75 0c             	push   0xc(%ebp)
+  8029db:	e8 36 de ff ff       	call   800816 <strcpy>
+	return 0;
+}
+  8029e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e5:	c9                   	leave
+  8029e6:	c3                   	ret
+
+008029e7 <devsock_close>:
+{
+  8029e7:	55                   	push   %ebp
+  8029e8:	89 e5                	mov    %esp,%ebp
+  8029ea:	53                   	push   %ebx
+  8029eb:	83 ec 10             	sub    $0x10,%esp
+  8029ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8029f1:	53                   	push   %ebx
+  8029f2:	e8 78 0b 00 00       	call   80356f <pageref>
+  8029f7:	89 c2                	mov    %eax,%edx
+  8029f9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8029fc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802a01:	83 fa 01             	cmp    $0x1,%edx
+  802a04:	74 05                	je     802a0b <devsock_close+0x24>
+}
+  802a06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a09:	c9                   	leave
+  802a0a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802a0b:	83 ec 0c             	sub    $0xc,%esp
+  802a0e:	ff 73 0c             	push   0xc(%ebx)
+  802a11:	e8 b7 02 00 00       	call   802ccd <nsipc_close>
+  802a16:	83 c4 10             	add    $0x10,%esp
+  802a19:	eb eb                	jmp    802a06 <devsock_close+0x1f>
+
+00802a1b <devsock_write>:
+{
+  802a1b:	55                   	push   %ebp
+  802a1c:	89 e5                	mov    %esp,%ebp
+  802a1e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802a21:	6a 00                	push   $0x0
+  802a23:	ff 75 10             	push   0x10(%ebp)
+  802a26:	ff 75 0c             	push   0xc(%ebp)
+  802a29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a2c:	ff 70 0c             	push   0xc(%eax)
+  802a2f:	e8 79 03 00 00       	call   802dad <nsipc_send>
+}
+  802a34:	c9                   	leave
+  802a35:	c3                   	ret
+
+00802a36 <devsock_read>:
+{
+  802a36:	55                   	push   %ebp
+  802a37:	89 e5                	mov    %esp,%ebp
+  802a39:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802a3c:	6a 00                	push   $0x0
+  802a3e:	ff 75 10             	push   0x10(%ebp)
+  802a41:	ff 75 0c             	push   0xc(%ebp)
+  802a44:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a47:	ff 70 0c             	push   0xc(%eax)
+  802a4a:	e8 ef 02 00 00       	call   802d3e <nsipc_recv>
+}
+  802a4f:	c9                   	leave
+  802a50:	c3                   	ret
+
+00802a51 <fd2sockid>:
+{
+  802a51:	55                   	push   %ebp
+  802a52:	89 e5                	mov    %esp,%ebp
+  802a54:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802a57:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a5a:	52                   	push   %edx
+  802a5b:	50                   	push   %eax
+  802a5c:	e8 54 e9 ff ff       	call   8013b5 <fd_lookup>
+  802a61:	83 c4 10             	add    $0x10,%esp
+  802a64:	85 c0                	test   %eax,%eax
+  802a66:	78 10                	js     802a78 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802a68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a6b:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  802a71:	39 08                	cmp    %ecx,(%eax)
+  802a73:	75 05                	jne    802a7a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802a75:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802a78:	c9                   	leave
+  802a79:	c3                   	ret
+		return -E_NOT_SUPP;
+  802a7a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a7f:	eb f7                	jmp    802a78 <fd2sockid+0x27>
+
+00802a81 <alloc_sockfd>:
+{
+  802a81:	55                   	push   %ebp
+  802a82:	89 e5                	mov    %esp,%ebp
+  802a84:	56                   	push   %esi
+  802a85:	53                   	push   %ebx
+  802a86:	83 ec 1c             	sub    $0x1c,%esp
+  802a89:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802a8b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a8e:	50                   	push   %eax
+  802a8f:	e8 cb e8 ff ff       	call   80135f <fd_alloc>
+  802a94:	89 c3                	mov    %eax,%ebx
+  802a96:	83 c4 10             	add    $0x10,%esp
+  802a99:	85 c0                	test   %eax,%eax
+  802a9b:	78 43                	js     802ae0 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802a9d:	83 ec 04             	sub    $0x4,%esp
+  802aa0:	68 07 04 00 00       	push   $0x407
+  802aa5:	ff 75 f4             	push   -0xc(%ebp)
+  802aa8:	6a 00                	push   $0x0
+  802aaa:	e8 73 e1 ff ff       	call   800c22 <sys_page_alloc>
+  802aaf:	89 c3                	mov    %eax,%ebx
+  802ab1:	83 c4 10             	add    $0x10,%esp
+  802ab4:	85 c0                	test   %eax,%eax
+  802ab6:	78 28                	js     802ae0 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802ab8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802abb:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802ac1:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802ac3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ac6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802acd:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802ad0:	83 ec 0c             	sub    $0xc,%esp
+  802ad3:	50                   	push   %eax
+  802ad4:	e8 5f e8 ff ff       	call   801338 <fd2num>
+  802ad9:	89 c3                	mov    %eax,%ebx
+  802adb:	83 c4 10             	add    $0x10,%esp
+  802ade:	eb 0c                	jmp    802aec <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802ae0:	83 ec 0c             	sub    $0xc,%esp
+  802ae3:	56                   	push   %esi
+  802ae4:	e8 e4 01 00 00       	call   802ccd <nsipc_close>
+		return r;
+  802ae9:	83 c4 10             	add    $0x10,%esp
+}
+  802aec:	89 d8                	mov    %ebx,%eax
+  802aee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802af1:	5b                   	pop    %ebx
+  802af2:	5e                   	pop    %esi
+  802af3:	5d                   	pop    %ebp
+  802af4:	c3                   	ret
+
+00802af5 <accept>:
+{
+  802af5:	55                   	push   %ebp
+  802af6:	89 e5                	mov    %esp,%ebp
+  802af8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802afb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802afe:	e8 4e ff ff ff       	call   802a51 <fd2sockid>
+  802b03:	85 c0                	test   %eax,%eax
+  802b05:	78 1b                	js     802b22 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802b07:	83 ec 04             	sub    $0x4,%esp
+  802b0a:	ff 75 10             	push   0x10(%ebp)
+  802b0d:	ff 75 0c             	push   0xc(%ebp)
+  802b10:	50                   	push   %eax
+  802b11:	e8 0e 01 00 00       	call   802c24 <nsipc_accept>
+  802b16:	83 c4 10             	add    $0x10,%esp
+  802b19:	85 c0                	test   %eax,%eax
+  802b1b:	78 05                	js     802b22 <accept+0x2d>
+	return alloc_sockfd(r);
+  802b1d:	e8 5f ff ff ff       	call   802a81 <alloc_sockfd>
+}
+  802b22:	c9                   	leave
+  802b23:	c3                   	ret
+
+00802b24 <bind>:
+{
+  802b24:	55                   	push   %ebp
+  802b25:	89 e5                	mov    %esp,%ebp
+  802b27:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b2d:	e8 1f ff ff ff       	call   802a51 <fd2sockid>
+  802b32:	85 c0                	test   %eax,%eax
+  802b34:	78 12                	js     802b48 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802b36:	83 ec 04             	sub    $0x4,%esp
+  802b39:	ff 75 10             	push   0x10(%ebp)
+  802b3c:	ff 75 0c             	push   0xc(%ebp)
+  802b3f:	50                   	push   %eax
+  802b40:	e8 31 01 00 00       	call   802c76 <nsipc_bind>
+  802b45:	83 c4 10             	add    $0x10,%esp
+}
+  802b48:	c9                   	leave
+  802b49:	c3                   	ret
+
+00802b4a <shutdown>:
+{
+  802b4a:	55                   	push   %ebp
+  802b4b:	89 e5                	mov    %esp,%ebp
+  802b4d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b50:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b53:	e8 f9 fe ff ff       	call   802a51 <fd2sockid>
+  802b58:	85 c0                	test   %eax,%eax
+  802b5a:	78 0f                	js     802b6b <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802b5c:	83 ec 08             	sub    $0x8,%esp
+  802b5f:	ff 75 0c             	push   0xc(%ebp)
+  802b62:	50                   	push   %eax
+  802b63:	e8 43 01 00 00       	call   802cab <nsipc_shutdown>
+  802b68:	83 c4 10             	add    $0x10,%esp
+}
+  802b6b:	c9                   	leave
+  802b6c:	c3                   	ret
+
+00802b6d <connect>:
+{
+  802b6d:	55                   	push   %ebp
+  802b6e:	89 e5                	mov    %esp,%ebp
+  802b70:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b73:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b76:	e8 d6 fe ff ff       	call   802a51 <fd2sockid>
+  802b7b:	85 c0                	test   %eax,%eax
+  802b7d:	78 12                	js     802b91 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802b7f:	83 ec 04             	sub    $0x4,%esp
+  802b82:	ff 75 10             	push   0x10(%ebp)
+  802b85:	ff 75 0c             	push   0xc(%ebp)
+  802b88:	50                   	push   %eax
+  802b89:	e8 59 01 00 00       	call   802ce7 <nsipc_connect>
+  802b8e:	83 c4 10             	add    $0x10,%esp
+}
+  802b91:	c9                   	leave
+  802b92:	c3                   	ret
+
+00802b93 <listen>:
+{
+  802b93:	55                   	push   %ebp
+  802b94:	89 e5                	mov    %esp,%ebp
+  802b96:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b99:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b9c:	e8 b0 fe ff ff       	call   802a51 <fd2sockid>
+  802ba1:	85 c0                	test   %eax,%eax
+  802ba3:	78 0f                	js     802bb4 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802ba5:	83 ec 08             	sub    $0x8,%esp
+  802ba8:	ff 75 0c             	push   0xc(%ebp)
+  802bab:	50                   	push   %eax
+  802bac:	e8 6b 01 00 00       	call   802d1c <nsipc_listen>
+  802bb1:	83 c4 10             	add    $0x10,%esp
+}
+  802bb4:	c9                   	leave
+  802bb5:	c3                   	ret
+
+00802bb6 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802bb6:	55                   	push   %ebp
+  802bb7:	89 e5                	mov    %esp,%ebp
+  802bb9:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802bbc:	ff 75 10             	push   0x10(%ebp)
+  802bbf:	ff 75 0c             	push   0xc(%ebp)
+  802bc2:	ff 75 08             	push   0x8(%ebp)
+  802bc5:	e8 41 02 00 00       	call   802e0b <nsipc_socket>
+  802bca:	83 c4 10             	add    $0x10,%esp
+  802bcd:	85 c0                	test   %eax,%eax
+  802bcf:	78 05                	js     802bd6 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802bd1:	e8 ab fe ff ff       	call   802a81 <alloc_sockfd>
+}
+  802bd6:	c9                   	leave
+  802bd7:	c3                   	ret
+
+00802bd8 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802bd8:	55                   	push   %ebp
+  802bd9:	89 e5                	mov    %esp,%ebp
+  802bdb:	53                   	push   %ebx
+  802bdc:	83 ec 04             	sub    $0x4,%esp
+  802bdf:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802be1:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802be8:	74 26                	je     802c10 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802bea:	6a 07                	push   $0x7
+  802bec:	68 00 80 80 00       	push   $0x808000
+  802bf1:	53                   	push   %ebx
+  802bf2:	ff 35 00 90 80 00    	push   0x809000
+  802bf8:	e8 fa 07 00 00       	call   8033f7 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802bfd:	83 c4 0c             	add    $0xc,%esp
+  802c00:	6a 00                	push   $0x0
+  802c02:	6a 00                	push   $0x0
+  802c04:	6a 00                	push   $0x0
+  802c06:	e8 81 07 00 00       	call   80338c <ipc_recv>
+}
+  802c0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c0e:	c9                   	leave
+  802c0f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c10:	83 ec 0c             	sub    $0xc,%esp
+  802c13:	6a 02                	push   $0x2
+  802c15:	e8 16 09 00 00       	call   803530 <ipc_find_env>
+  802c1a:	a3 00 90 80 00       	mov    %eax,0x809000
+  802c1f:	83 c4 10             	add    $0x10,%esp
+  802c22:	eb c6                	jmp    802bea <nsipc+0x12>
+
+00802c24 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802c24:	55                   	push   %ebp
+  802c25:	89 e5                	mov    %esp,%ebp
+  802c27:	56                   	push   %esi
+  802c28:	53                   	push   %ebx
+  802c29:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802c2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c2f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802c34:	8b 06                	mov    (%esi),%eax
+  802c36:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802c3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c40:	e8 93 ff ff ff       	call   802bd8 <nsipc>
+  802c45:	89 c3                	mov    %eax,%ebx
+  802c47:	85 c0                	test   %eax,%eax
+  802c49:	79 09                	jns    802c54 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802c4b:	89 d8                	mov    %ebx,%eax
+  802c4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c50:	5b                   	pop    %ebx
+  802c51:	5e                   	pop    %esi
+  802c52:	5d                   	pop    %ebp
+  802c53:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802c54:	83 ec 04             	sub    $0x4,%esp
+  802c57:	ff 35 10 80 80 00    	push   0x808010
+  802c5d:	68 00 80 80 00       	push   $0x808000
+  802c62:	ff 75 0c             	push   0xc(%ebp)
+  802c65:	e8 32 dd ff ff       	call   80099c <memmove>
+		*addrlen = ret->ret_addrlen;
+  802c6a:	a1 10 80 80 00       	mov    0x808010,%eax
+  802c6f:	89 06                	mov    %eax,(%esi)
+  802c71:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802c74:	eb d5                	jmp    802c4b <nsipc_accept+0x27>
+
+00802c76 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802c76:	55                   	push   %ebp
+  802c77:	89 e5                	mov    %esp,%ebp
+  802c79:	53                   	push   %ebx
+  802c7a:	83 ec 08             	sub    $0x8,%esp
+  802c7d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802c80:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c83:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802c88:	53                   	push   %ebx
+  802c89:	ff 75 0c             	push   0xc(%ebp)
+  802c8c:	68 04 80 80 00       	push   $0x808004
+  802c91:	e8 06 dd ff ff       	call   80099c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802c96:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802c9c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802ca1:	e8 32 ff ff ff       	call   802bd8 <nsipc>
+}
+  802ca6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ca9:	c9                   	leave
+  802caa:	c3                   	ret
+
+00802cab <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802cab:	55                   	push   %ebp
+  802cac:	89 e5                	mov    %esp,%ebp
+  802cae:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802cb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb4:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802cb9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cbc:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802cc1:	b8 03 00 00 00       	mov    $0x3,%eax
+  802cc6:	e8 0d ff ff ff       	call   802bd8 <nsipc>
+}
+  802ccb:	c9                   	leave
+  802ccc:	c3                   	ret
+
+00802ccd <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802ccd:	55                   	push   %ebp
+  802cce:	89 e5                	mov    %esp,%ebp
+  802cd0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802cd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd6:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802cdb:	b8 04 00 00 00       	mov    $0x4,%eax
+  802ce0:	e8 f3 fe ff ff       	call   802bd8 <nsipc>
+}
+  802ce5:	c9                   	leave
+  802ce6:	c3                   	ret
+
+00802ce7 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802ce7:	55                   	push   %ebp
+  802ce8:	89 e5                	mov    %esp,%ebp
+  802cea:	53                   	push   %ebx
+  802ceb:	83 ec 08             	sub    $0x8,%esp
+  802cee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802cf1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf4:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802cf9:	53                   	push   %ebx
+  802cfa:	ff 75 0c             	push   0xc(%ebp)
+  802cfd:	68 04 80 80 00       	push   $0x808004
+  802d02:	e8 95 dc ff ff       	call   80099c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802d07:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802d0d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d12:	e8 c1 fe ff ff       	call   802bd8 <nsipc>
+}
+  802d17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d1a:	c9                   	leave
+  802d1b:	c3                   	ret
+
+00802d1c <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802d1c:	55                   	push   %ebp
+  802d1d:	89 e5                	mov    %esp,%ebp
+  802d1f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802d22:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d25:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802d2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d2d:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802d32:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d37:	e8 9c fe ff ff       	call   802bd8 <nsipc>
+}
+  802d3c:	c9                   	leave
+  802d3d:	c3                   	ret
+
+00802d3e <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802d3e:	55                   	push   %ebp
+  802d3f:	89 e5                	mov    %esp,%ebp
+  802d41:	56                   	push   %esi
+  802d42:	53                   	push   %ebx
+  802d43:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802d46:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d49:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802d4e:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802d54:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d57:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802d5c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d61:	e8 72 fe ff ff       	call   802bd8 <nsipc>
+  802d66:	89 c3                	mov    %eax,%ebx
+  802d68:	85 c0                	test   %eax,%eax
+  802d6a:	78 22                	js     802d8e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802d6c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d71:	39 c6                	cmp    %eax,%esi
+  802d73:	0f 4e c6             	cmovle %esi,%eax
+  802d76:	39 c3                	cmp    %eax,%ebx
+  802d78:	7f 1d                	jg     802d97 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802d7a:	83 ec 04             	sub    $0x4,%esp
+  802d7d:	53                   	push   %ebx
+  802d7e:	68 00 80 80 00       	push   $0x808000
+  802d83:	ff 75 0c             	push   0xc(%ebp)
+  802d86:	e8 11 dc ff ff       	call   80099c <memmove>
+  802d8b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802d8e:	89 d8                	mov    %ebx,%eax
+  802d90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d93:	5b                   	pop    %ebx
+  802d94:	5e                   	pop    %esi
+  802d95:	5d                   	pop    %ebp
+  802d96:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802d97:	68 7d 3d 80 00       	push   $0x803d7d
+  802d9c:	68 4c 3c 80 00       	push   $0x803c4c
+  802da1:	6a 62                	push   $0x62
+  802da3:	68 92 3d 80 00       	push   $0x803d92
+  802da8:	e8 a0 d3 ff ff       	call   80014d <_panic>
+
+00802dad <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802dad:	55                   	push   %ebp
+  802dae:	89 e5                	mov    %esp,%ebp
+  802db0:	53                   	push   %ebx
+  802db1:	83 ec 04             	sub    $0x4,%esp
+  802db4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802db7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dba:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802dbf:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802dc5:	7f 2e                	jg     802df5 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802dc7:	83 ec 04             	sub    $0x4,%esp
+  802dca:	53                   	push   %ebx
+  802dcb:	ff 75 0c             	push   0xc(%ebp)
+  802dce:	68 0c 80 80 00       	push   $0x80800c
+  802dd3:	e8 c4 db ff ff       	call   80099c <memmove>
+	nsipcbuf.send.req_size = size;
+  802dd8:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802dde:	8b 45 14             	mov    0x14(%ebp),%eax
+  802de1:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802de6:	b8 08 00 00 00       	mov    $0x8,%eax
+  802deb:	e8 e8 fd ff ff       	call   802bd8 <nsipc>
+}
+  802df0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802df3:	c9                   	leave
+  802df4:	c3                   	ret
+	assert(size < 1600);
+  802df5:	68 9e 3d 80 00       	push   $0x803d9e
+  802dfa:	68 4c 3c 80 00       	push   $0x803c4c
+  802dff:	6a 6d                	push   $0x6d
+  802e01:	68 92 3d 80 00       	push   $0x803d92
+  802e06:	e8 42 d3 ff ff       	call   80014d <_panic>
+
+00802e0b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802e0b:	55                   	push   %ebp
+  802e0c:	89 e5                	mov    %esp,%ebp
+  802e0e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802e11:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e14:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802e19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e1c:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802e21:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e24:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802e29:	b8 09 00 00 00       	mov    $0x9,%eax
+  802e2e:	e8 a5 fd ff ff       	call   802bd8 <nsipc>
+}
+  802e33:	c9                   	leave
+  802e34:	c3                   	ret
+
+00802e35 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e35:	55                   	push   %ebp
+  802e36:	89 e5                	mov    %esp,%ebp
+  802e38:	56                   	push   %esi
+  802e39:	53                   	push   %ebx
+  802e3a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e3d:	83 ec 0c             	sub    $0xc,%esp
+  802e40:	ff 75 08             	push   0x8(%ebp)
+  802e43:	e8 00 e5 ff ff       	call   801348 <fd2data>
+  802e48:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802e4a:	83 c4 08             	add    $0x8,%esp
+  802e4d:	68 aa 3d 80 00       	push   $0x803daa
+  802e52:	53                   	push   %ebx
+  802e53:	e8 be d9 ff ff       	call   800816 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802e58:	8b 46 04             	mov    0x4(%esi),%eax
+  802e5b:	2b 06                	sub    (%esi),%eax
+  802e5d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802e63:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e6a:	00 00 00 
+	stat->st_dev = &devpipe;
+  802e6d:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802e74:	40 80 00 
+	return 0;
+}
+  802e77:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e7f:	5b                   	pop    %ebx
+  802e80:	5e                   	pop    %esi
+  802e81:	5d                   	pop    %ebp
+  802e82:	c3                   	ret
+
+00802e83 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e83:	55                   	push   %ebp
+  802e84:	89 e5                	mov    %esp,%ebp
+  802e86:	53                   	push   %ebx
+  802e87:	83 ec 0c             	sub    $0xc,%esp
+  802e8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802e8d:	53                   	push   %ebx
+  802e8e:	6a 00                	push   $0x0
+  802e90:	e8 1a de ff ff       	call   800caf <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802e95:	89 1c 24             	mov    %ebx,(%esp)
+  802e98:	e8 ab e4 ff ff       	call   801348 <fd2data>
+  802e9d:	83 c4 08             	add    $0x8,%esp
+  802ea0:	50                   	push   %eax
+  802ea1:	6a 00                	push   $0x0
+  802ea3:	e8 07 de ff ff       	call   800caf <sys_page_unmap>
+}
+  802ea8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eab:	c9                   	leave
+  802eac:	c3                   	ret
+
+00802ead <_pipeisclosed>:
+{
+  802ead:	55                   	push   %ebp
+  802eae:	89 e5                	mov    %esp,%ebp
+  802eb0:	57                   	push   %edi
+  802eb1:	56                   	push   %esi
+  802eb2:	53                   	push   %ebx
+  802eb3:	83 ec 1c             	sub    $0x1c,%esp
+  802eb6:	89 c7                	mov    %eax,%edi
+  802eb8:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802eba:	a1 04 50 80 00       	mov    0x805004,%eax
+  802ebf:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802ec2:	83 ec 0c             	sub    $0xc,%esp
+  802ec5:	57                   	push   %edi
+  802ec6:	e8 a4 06 00 00       	call   80356f <pageref>
+  802ecb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ece:	89 34 24             	mov    %esi,(%esp)
+  802ed1:	e8 99 06 00 00       	call   80356f <pageref>
+		nn = thisenv->env_runs;
+  802ed6:	8b 15 04 50 80 00    	mov    0x805004,%edx
+  802edc:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802edf:	83 c4 10             	add    $0x10,%esp
+  802ee2:	39 cb                	cmp    %ecx,%ebx
+  802ee4:	74 1b                	je     802f01 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802ee6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ee9:	75 cf                	jne    802eba <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802eeb:	8b 42 58             	mov    0x58(%edx),%eax
+  802eee:	6a 01                	push   $0x1
+  802ef0:	50                   	push   %eax
+  802ef1:	53                   	push   %ebx
+  802ef2:	68 b1 3d 80 00       	push   $0x803db1
+  802ef7:	e8 2c d3 ff ff       	call   800228 <cprintf>
+  802efc:	83 c4 10             	add    $0x10,%esp
+  802eff:	eb b9                	jmp    802eba <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802f01:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f04:	0f 94 c0             	sete   %al
+  802f07:	0f b6 c0             	movzbl %al,%eax
+}
+  802f0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f0d:	5b                   	pop    %ebx
+  802f0e:	5e                   	pop    %esi
+  802f0f:	5f                   	pop    %edi
+  802f10:	5d                   	pop    %ebp
+  802f11:	c3                   	ret
+
+00802f12 <devpipe_write>:
+{
+  802f12:	55                   	push   %ebp
+  802f13:	89 e5                	mov    %esp,%ebp
+  802f15:	57                   	push   %edi
+  802f16:	56                   	push   %esi
+  802f17:	53                   	push   %ebx
+  802f18:	83 ec 28             	sub    $0x28,%esp
+  802f1b:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802f1e:	56                   	push   %esi
+  802f1f:	e8 24 e4 ff ff       	call   801348 <fd2data>
+  802f24:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f26:	83 c4 10             	add    $0x10,%esp
+  802f29:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f2e:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802f31:	75 09                	jne    802f3c <devpipe_write+0x2a>
+	return i;
+  802f33:	89 f8                	mov    %edi,%eax
+  802f35:	eb 23                	jmp    802f5a <devpipe_write+0x48>
+			sys_yield();
+  802f37:	e8 c7 dc ff ff       	call   800c03 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802f3c:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f3f:	8b 0b                	mov    (%ebx),%ecx
+  802f41:	8d 51 20             	lea    0x20(%ecx),%edx
+  802f44:	39 d0                	cmp    %edx,%eax
+  802f46:	72 1a                	jb     802f62 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802f48:	89 da                	mov    %ebx,%edx
+  802f4a:	89 f0                	mov    %esi,%eax
+  802f4c:	e8 5c ff ff ff       	call   802ead <_pipeisclosed>
+  802f51:	85 c0                	test   %eax,%eax
+  802f53:	74 e2                	je     802f37 <devpipe_write+0x25>
+				return 0;
+  802f55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f5d:	5b                   	pop    %ebx
+  802f5e:	5e                   	pop    %esi
+  802f5f:	5f                   	pop    %edi
+  802f60:	5d                   	pop    %ebp
+  802f61:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802f62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f65:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802f69:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802f6c:	89 c2                	mov    %eax,%edx
+  802f6e:	c1 fa 1f             	sar    $0x1f,%edx
+  802f71:	89 d1                	mov    %edx,%ecx
+  802f73:	c1 e9 1b             	shr    $0x1b,%ecx
+  802f76:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802f79:	83 e2 1f             	and    $0x1f,%edx
+  802f7c:	29 ca                	sub    %ecx,%edx
+  802f7e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802f82:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802f86:	83 c0 01             	add    $0x1,%eax
+  802f89:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802f8c:	83 c7 01             	add    $0x1,%edi
+  802f8f:	eb 9d                	jmp    802f2e <devpipe_write+0x1c>
+
+00802f91 <devpipe_read>:
+{
+  802f91:	55                   	push   %ebp
+  802f92:	89 e5                	mov    %esp,%ebp
+  802f94:	57                   	push   %edi
+  802f95:	56                   	push   %esi
+  802f96:	53                   	push   %ebx
+  802f97:	83 ec 18             	sub    $0x18,%esp
+  802f9a:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802f9d:	57                   	push   %edi
+  802f9e:	e8 a5 e3 ff ff       	call   801348 <fd2data>
+  802fa3:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802fa5:	83 c4 10             	add    $0x10,%esp
+  802fa8:	be 00 00 00 00       	mov    $0x0,%esi
+  802fad:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802fb0:	75 13                	jne    802fc5 <devpipe_read+0x34>
+	return i;
+  802fb2:	89 f0                	mov    %esi,%eax
+  802fb4:	eb 02                	jmp    802fb8 <devpipe_read+0x27>
+				return i;
+  802fb6:	89 f0                	mov    %esi,%eax
+}
+  802fb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fbb:	5b                   	pop    %ebx
+  802fbc:	5e                   	pop    %esi
+  802fbd:	5f                   	pop    %edi
+  802fbe:	5d                   	pop    %ebp
+  802fbf:	c3                   	ret
+			sys_yield();
+  802fc0:	e8 3e dc ff ff       	call   800c03 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802fc5:	8b 03                	mov    (%ebx),%eax
+  802fc7:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802fca:	75 18                	jne    802fe4 <devpipe_read+0x53>
+			if (i > 0)
+  802fcc:	85 f6                	test   %esi,%esi
+  802fce:	75 e6                	jne    802fb6 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802fd0:	89 da                	mov    %ebx,%edx
+  802fd2:	89 f8                	mov    %edi,%eax
+  802fd4:	e8 d4 fe ff ff       	call   802ead <_pipeisclosed>
+  802fd9:	85 c0                	test   %eax,%eax
+  802fdb:	74 e3                	je     802fc0 <devpipe_read+0x2f>
+				return 0;
+  802fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe2:	eb d4                	jmp    802fb8 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802fe4:	99                   	cltd
+  802fe5:	c1 ea 1b             	shr    $0x1b,%edx
+  802fe8:	01 d0                	add    %edx,%eax
+  802fea:	83 e0 1f             	and    $0x1f,%eax
+  802fed:	29 d0                	sub    %edx,%eax
+  802fef:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802ff4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ff7:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802ffa:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802ffd:	83 c6 01             	add    $0x1,%esi
+  803000:	eb ab                	jmp    802fad <devpipe_read+0x1c>
+
+00803002 <pipe>:
+{
+  803002:	55                   	push   %ebp
+  803003:	89 e5                	mov    %esp,%ebp
+  803005:	56                   	push   %esi
+  803006:	53                   	push   %ebx
+  803007:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80300a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80300d:	50                   	push   %eax
+  80300e:	e8 4c e3 ff ff       	call   80135f <fd_alloc>
+  803013:	89 c3                	mov    %eax,%ebx
+  803015:	83 c4 10             	add    $0x10,%esp
+  803018:	85 c0                	test   %eax,%eax
+  80301a:	0f 88 23 01 00 00    	js     803143 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803020:	83 ec 04             	sub    $0x4,%esp
+  803023:	68 07 04 00 00       	push   $0x407
+  803028:	ff 75 f4             	push   -0xc(%ebp)
+  80302b:	6a 00                	push   $0x0
+  80302d:	e8 f0 db ff ff       	call   800c22 <sys_page_alloc>
+  803032:	89 c3                	mov    %eax,%ebx
+  803034:	83 c4 10             	add    $0x10,%esp
+  803037:	85 c0                	test   %eax,%eax
+  803039:	0f 88 04 01 00 00    	js     803143 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80303f:	83 ec 0c             	sub    $0xc,%esp
+  803042:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803045:	50                   	push   %eax
+  803046:	e8 14 e3 ff ff       	call   80135f <fd_alloc>
+  80304b:	89 c3                	mov    %eax,%ebx
+  80304d:	83 c4 10             	add    $0x10,%esp
+  803050:	85 c0                	test   %eax,%eax
+  803052:	0f 88 db 00 00 00    	js     803133 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803058:	83 ec 04             	sub    $0x4,%esp
+  80305b:	68 07 04 00 00       	push   $0x407
+  803060:	ff 75 f0             	push   -0x10(%ebp)
+  803063:	6a 00                	push   $0x0
+  803065:	e8 b8 db ff ff       	call   800c22 <sys_page_alloc>
+  80306a:	89 c3                	mov    %eax,%ebx
+  80306c:	83 c4 10             	add    $0x10,%esp
+  80306f:	85 c0                	test   %eax,%eax
+  803071:	0f 88 bc 00 00 00    	js     803133 <pipe+0x131>
+	va = fd2data(fd0);
+  803077:	83 ec 0c             	sub    $0xc,%esp
+  80307a:	ff 75 f4             	push   -0xc(%ebp)
+  80307d:	e8 c6 e2 ff ff       	call   801348 <fd2data>
+  803082:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803084:	83 c4 0c             	add    $0xc,%esp
+  803087:	68 07 04 00 00       	push   $0x407
+  80308c:	50                   	push   %eax
+  80308d:	6a 00                	push   $0x0
+  80308f:	e8 8e db ff ff       	call   800c22 <sys_page_alloc>
+  803094:	89 c3                	mov    %eax,%ebx
+  803096:	83 c4 10             	add    $0x10,%esp
+  803099:	85 c0                	test   %eax,%eax
+  80309b:	0f 88 82 00 00 00    	js     803123 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030a1:	83 ec 0c             	sub    $0xc,%esp
+  8030a4:	ff 75 f0             	push   -0x10(%ebp)
+  8030a7:	e8 9c e2 ff ff       	call   801348 <fd2data>
+  8030ac:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8030b3:	50                   	push   %eax
+  8030b4:	6a 00                	push   $0x0
+  8030b6:	56                   	push   %esi
+  8030b7:	6a 00                	push   $0x0
+  8030b9:	e8 af db ff ff       	call   800c6d <sys_page_map>
+  8030be:	89 c3                	mov    %eax,%ebx
+  8030c0:	83 c4 20             	add    $0x20,%esp
+  8030c3:	85 c0                	test   %eax,%eax
+  8030c5:	78 4e                	js     803115 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8030c7:	a1 60 40 80 00       	mov    0x804060,%eax
+  8030cc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030cf:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8030d1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030d4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8030db:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8030de:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8030e0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8030e3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8030ea:	83 ec 0c             	sub    $0xc,%esp
+  8030ed:	ff 75 f4             	push   -0xc(%ebp)
+  8030f0:	e8 43 e2 ff ff       	call   801338 <fd2num>
+  8030f5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030f8:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8030fa:	83 c4 04             	add    $0x4,%esp
+  8030fd:	ff 75 f0             	push   -0x10(%ebp)
+  803100:	e8 33 e2 ff ff       	call   801338 <fd2num>
+  803105:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803108:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80310b:	83 c4 10             	add    $0x10,%esp
+  80310e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803113:	eb 2e                	jmp    803143 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803115:	83 ec 08             	sub    $0x8,%esp
+  803118:	56                   	push   %esi
+  803119:	6a 00                	push   $0x0
+  80311b:	e8 8f db ff ff       	call   800caf <sys_page_unmap>
+  803120:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803123:	83 ec 08             	sub    $0x8,%esp
+  803126:	ff 75 f0             	push   -0x10(%ebp)
+  803129:	6a 00                	push   $0x0
+  80312b:	e8 7f db ff ff       	call   800caf <sys_page_unmap>
+  803130:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803133:	83 ec 08             	sub    $0x8,%esp
+  803136:	ff 75 f4             	push   -0xc(%ebp)
+  803139:	6a 00                	push   $0x0
+  80313b:	e8 6f db ff ff       	call   800caf <sys_page_unmap>
+  803140:	83 c4 10             	add    $0x10,%esp
+}
+  803143:	89 d8                	mov    %ebx,%eax
+  803145:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803148:	5b                   	pop    %ebx
+  803149:	5e                   	pop    %esi
+  80314a:	5d                   	pop    %ebp
+  80314b:	c3                   	ret
+
+0080314c <pipeisclosed>:
+{
+  80314c:	55                   	push   %ebp
+  80314d:	89 e5                	mov    %esp,%ebp
+  80314f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803152:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803155:	50                   	push   %eax
+  803156:	ff 75 08             	push   0x8(%ebp)
+  803159:	e8 57 e2 ff ff       	call   8013b5 <fd_lookup>
+  80315e:	83 c4 10             	add    $0x10,%esp
+  803161:	85 c0                	test   %eax,%eax
+  803163:	78 18                	js     80317d <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803165:	83 ec 0c             	sub    $0xc,%esp
+  803168:	ff 75 f4             	push   -0xc(%ebp)
+  80316b:	e8 d8 e1 ff ff       	call   801348 <fd2data>
+  803170:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803172:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803175:	e8 33 fd ff ff       	call   802ead <_pipeisclosed>
+  80317a:	83 c4 10             	add    $0x10,%esp
+}
+  80317d:	c9                   	leave
+  80317e:	c3                   	ret
+
+0080317f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80317f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803184:	c3                   	ret
+
+00803185 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803185:	55                   	push   %ebp
+  803186:	89 e5                	mov    %esp,%ebp
+  803188:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80318b:	68 c9 3d 80 00       	push   $0x803dc9
+  803190:	ff 75 0c             	push   0xc(%ebp)
+  803193:	e8 7e d6 ff ff       	call   800816 <strcpy>
+	return 0;
+}
+  803198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80319d:	c9                   	leave
+  80319e:	c3                   	ret
+
+0080319f <devcons_write>:
+{
+  80319f:	55                   	push   %ebp
+  8031a0:	89 e5                	mov    %esp,%ebp
+  8031a2:	57                   	push   %edi
+  8031a3:	56                   	push   %esi
+  8031a4:	53                   	push   %ebx
+  8031a5:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8031ab:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8031b0:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8031b6:	eb 2e                	jmp    8031e6 <devcons_write+0x47>
+		m = n - tot;
+  8031b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8031bb:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8031bd:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8031c2:	39 c3                	cmp    %eax,%ebx
+  8031c4:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8031c7:	83 ec 04             	sub    $0x4,%esp
+  8031ca:	53                   	push   %ebx
+  8031cb:	89 f0                	mov    %esi,%eax
+  8031cd:	03 45 0c             	add    0xc(%ebp),%eax
+  8031d0:	50                   	push   %eax
+  8031d1:	57                   	push   %edi
+  8031d2:	e8 c5 d7 ff ff       	call   80099c <memmove>
+		sys_cputs(buf, m);
+  8031d7:	83 c4 08             	add    $0x8,%esp
+  8031da:	53                   	push   %ebx
+  8031db:	57                   	push   %edi
+  8031dc:	e8 65 d9 ff ff       	call   800b46 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8031e1:	01 de                	add    %ebx,%esi
+  8031e3:	83 c4 10             	add    $0x10,%esp
+  8031e6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8031e9:	72 cd                	jb     8031b8 <devcons_write+0x19>
+}
+  8031eb:	89 f0                	mov    %esi,%eax
+  8031ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031f0:	5b                   	pop    %ebx
+  8031f1:	5e                   	pop    %esi
+  8031f2:	5f                   	pop    %edi
+  8031f3:	5d                   	pop    %ebp
+  8031f4:	c3                   	ret
+
+008031f5 <devcons_read>:
+{
+  8031f5:	55                   	push   %ebp
+  8031f6:	89 e5                	mov    %esp,%ebp
+  8031f8:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8031fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803200:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803204:	75 07                	jne    80320d <devcons_read+0x18>
+  803206:	eb 1f                	jmp    803227 <devcons_read+0x32>
+		sys_yield();
+  803208:	e8 f6 d9 ff ff       	call   800c03 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80320d:	e8 5a d9 ff ff       	call   800b6c <sys_cgetc>
+  803212:	85 c0                	test   %eax,%eax
+  803214:	74 f2                	je     803208 <devcons_read+0x13>
+	if (c < 0)
+  803216:	78 0f                	js     803227 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803218:	83 f8 04             	cmp    $0x4,%eax
+  80321b:	74 0c                	je     803229 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80321d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803220:	88 02                	mov    %al,(%edx)
+	return 1;
+  803222:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803227:	c9                   	leave
+  803228:	c3                   	ret
+		return 0;
+  803229:	b8 00 00 00 00       	mov    $0x0,%eax
+  80322e:	eb f7                	jmp    803227 <devcons_read+0x32>
+
+00803230 <cputchar>:
+{
+  803230:	55                   	push   %ebp
+  803231:	89 e5                	mov    %esp,%ebp
+  803233:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803236:	8b 45 08             	mov    0x8(%ebp),%eax
+  803239:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80323c:	6a 01                	push   $0x1
+  80323e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803241:	50                   	push   %eax
+  803242:	e8 ff d8 ff ff       	call   800b46 <sys_cputs>
+}
+  803247:	83 c4 10             	add    $0x10,%esp
+  80324a:	c9                   	leave
+  80324b:	c3                   	ret
+
+0080324c <getchar>:
+{
+  80324c:	55                   	push   %ebp
+  80324d:	89 e5                	mov    %esp,%ebp
+  80324f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803252:	6a 01                	push   $0x1
+  803254:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803257:	50                   	push   %eax
+  803258:	6a 00                	push   $0x0
+  80325a:	e8 bc e3 ff ff       	call   80161b <read>
+	if (r < 0)
+  80325f:	83 c4 10             	add    $0x10,%esp
+  803262:	85 c0                	test   %eax,%eax
+  803264:	78 06                	js     80326c <getchar+0x20>
+	if (r < 1)
+  803266:	74 06                	je     80326e <getchar+0x22>
+	return c;
+  803268:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80326c:	c9                   	leave
+  80326d:	c3                   	ret
+		return -E_EOF;
+  80326e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803273:	eb f7                	jmp    80326c <getchar+0x20>
+
+00803275 <iscons>:
+{
+  803275:	55                   	push   %ebp
+  803276:	89 e5                	mov    %esp,%ebp
+  803278:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80327b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80327e:	50                   	push   %eax
+  80327f:	ff 75 08             	push   0x8(%ebp)
+  803282:	e8 2e e1 ff ff       	call   8013b5 <fd_lookup>
+  803287:	83 c4 10             	add    $0x10,%esp
+  80328a:	85 c0                	test   %eax,%eax
+  80328c:	78 11                	js     80329f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80328e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803291:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  803297:	39 10                	cmp    %edx,(%eax)
+  803299:	0f 94 c0             	sete   %al
+  80329c:	0f b6 c0             	movzbl %al,%eax
+}
+  80329f:	c9                   	leave
+  8032a0:	c3                   	ret
+
+008032a1 <opencons>:
+{
+  8032a1:	55                   	push   %ebp
+  8032a2:	89 e5                	mov    %esp,%ebp
+  8032a4:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8032a7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032aa:	50                   	push   %eax
+  8032ab:	e8 af e0 ff ff       	call   80135f <fd_alloc>
+  8032b0:	83 c4 10             	add    $0x10,%esp
+  8032b3:	85 c0                	test   %eax,%eax
+  8032b5:	78 3a                	js     8032f1 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8032b7:	83 ec 04             	sub    $0x4,%esp
+  8032ba:	68 07 04 00 00       	push   $0x407
+  8032bf:	ff 75 f4             	push   -0xc(%ebp)
+  8032c2:	6a 00                	push   $0x0
+  8032c4:	e8 59 d9 ff ff       	call   800c22 <sys_page_alloc>
+  8032c9:	83 c4 10             	add    $0x10,%esp
+  8032cc:	85 c0                	test   %eax,%eax
+  8032ce:	78 21                	js     8032f1 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8032d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032d3:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8032d9:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8032db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032de:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8032e5:	83 ec 0c             	sub    $0xc,%esp
+  8032e8:	50                   	push   %eax
+  8032e9:	e8 4a e0 ff ff       	call   801338 <fd2num>
+  8032ee:	83 c4 10             	add    $0x10,%esp
+}
+  8032f1:	c9                   	leave
+  8032f2:	c3                   	ret
+
+008032f3 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8032f3:	55                   	push   %ebp
+  8032f4:	89 e5                	mov    %esp,%ebp
+  8032f6:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8032f9:	83 3d 04 90 80 00 00 	cmpl   $0x0,0x809004
+  803300:	74 0a                	je     80330c <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803302:	8b 45 08             	mov    0x8(%ebp),%eax
+  803305:	a3 04 90 80 00       	mov    %eax,0x809004
+}
+  80330a:	c9                   	leave
+  80330b:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80330c:	83 ec 04             	sub    $0x4,%esp
+  80330f:	6a 07                	push   $0x7
+  803311:	68 00 f0 bf ee       	push   $0xeebff000
+  803316:	6a 00                	push   $0x0
+  803318:	e8 05 d9 ff ff       	call   800c22 <sys_page_alloc>
+  80331d:	83 c4 10             	add    $0x10,%esp
+  803320:	85 c0                	test   %eax,%eax
+  803322:	75 2c                	jne    803350 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803324:	83 ec 08             	sub    $0x8,%esp
+  803327:	68 66 33 80 00       	push   $0x803366
+  80332c:	6a 00                	push   $0x0
+  80332e:	e8 5a da ff ff       	call   800d8d <sys_env_set_pgfault_upcall>
+  803333:	83 c4 10             	add    $0x10,%esp
+  803336:	85 c0                	test   %eax,%eax
+  803338:	74 c8                	je     803302 <set_pgfault_handler+0xf>
+  80333a:	68 20 3e 80 00       	push   $0x803e20
+  80333f:	68 4c 3c 80 00       	push   $0x803c4c
+  803344:	6a 20                	push   $0x20
+  803346:	68 50 3e 80 00       	push   $0x803e50
+  80334b:	e8 fd cd ff ff       	call   80014d <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803350:	68 d8 3d 80 00       	push   $0x803dd8
+  803355:	68 4c 3c 80 00       	push   $0x803c4c
+  80335a:	6a 1e                	push   $0x1e
+  80335c:	68 50 3e 80 00       	push   $0x803e50
+  803361:	e8 e7 cd ff ff       	call   80014d <_panic>
+
+00803366 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803366:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803367:	a1 04 90 80 00       	mov    0x809004,%eax
+	call *%eax
+  80336c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80336e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803371:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803376:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  80337b:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  80337f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803382:	83 c4 08             	add    $0x8,%esp
+	popal
+  803385:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803386:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803389:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  80338a:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80338b:	c3                   	ret
+
+0080338c <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80338c:	55                   	push   %ebp
+  80338d:	89 e5                	mov    %esp,%ebp
+  80338f:	56                   	push   %esi
+  803390:	53                   	push   %ebx
+  803391:	8b 75 08             	mov    0x8(%ebp),%esi
+  803394:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803397:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80339a:	85 c0                	test   %eax,%eax
+  80339c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8033a1:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8033a4:	83 ec 0c             	sub    $0xc,%esp
+  8033a7:	50                   	push   %eax
+  8033a8:	e8 bd da ff ff       	call   800e6a <sys_ipc_recv>
+	if (from_env_store)
+  8033ad:	83 c4 10             	add    $0x10,%esp
+  8033b0:	85 f6                	test   %esi,%esi
+  8033b2:	74 14                	je     8033c8 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8033b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033b9:	85 c0                	test   %eax,%eax
+  8033bb:	75 09                	jne    8033c6 <ipc_recv+0x3a>
+  8033bd:	8b 15 04 50 80 00    	mov    0x805004,%edx
+  8033c3:	8b 52 74             	mov    0x74(%edx),%edx
+  8033c6:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8033c8:	85 db                	test   %ebx,%ebx
+  8033ca:	74 25                	je     8033f1 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033cc:	85 c0                	test   %eax,%eax
+  8033ce:	74 0d                	je     8033dd <ipc_recv+0x51>
+  8033d0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8033d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033d9:	5b                   	pop    %ebx
+  8033da:	5e                   	pop    %esi
+  8033db:	5d                   	pop    %ebp
+  8033dc:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033dd:	a1 04 50 80 00       	mov    0x805004,%eax
+  8033e2:	8b 40 78             	mov    0x78(%eax),%eax
+  8033e5:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8033e7:	a1 04 50 80 00       	mov    0x805004,%eax
+  8033ec:	8b 40 70             	mov    0x70(%eax),%eax
+  8033ef:	eb e5                	jmp    8033d6 <ipc_recv+0x4a>
+  8033f1:	85 c0                	test   %eax,%eax
+  8033f3:	75 e1                	jne    8033d6 <ipc_recv+0x4a>
+  8033f5:	eb f0                	jmp    8033e7 <ipc_recv+0x5b>
+
+008033f7 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8033f7:	55                   	push   %ebp
+  8033f8:	89 e5                	mov    %esp,%ebp
+  8033fa:	57                   	push   %edi
+  8033fb:	56                   	push   %esi
+  8033fc:	53                   	push   %ebx
+  8033fd:	83 ec 0c             	sub    $0xc,%esp
+  803400:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803403:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803406:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803409:	85 db                	test   %ebx,%ebx
+  80340b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803410:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803413:	ff 75 14             	push   0x14(%ebp)
+  803416:	53                   	push   %ebx
+  803417:	56                   	push   %esi
+  803418:	57                   	push   %edi
+  803419:	e8 b9 d9 ff ff       	call   800dd7 <sys_ipc_try_send>
+  80341e:	83 c4 10             	add    $0x10,%esp
+  803421:	85 c0                	test   %eax,%eax
+  803423:	74 22                	je     803447 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803425:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803428:	75 07                	jne    803431 <ipc_send+0x3a>
+		sys_yield();
+  80342a:	e8 d4 d7 ff ff       	call   800c03 <sys_yield>
+  80342f:	eb e2                	jmp    803413 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803431:	68 5e 3e 80 00       	push   $0x803e5e
+  803436:	68 4c 3c 80 00       	push   $0x803c4c
+  80343b:	6a 39                	push   $0x39
+  80343d:	68 73 3e 80 00       	push   $0x803e73
+  803442:	e8 06 cd ff ff       	call   80014d <_panic>
+	}
+}
+  803447:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80344a:	5b                   	pop    %ebx
+  80344b:	5e                   	pop    %esi
+  80344c:	5f                   	pop    %edi
+  80344d:	5d                   	pop    %ebp
+  80344e:	c3                   	ret
+
+0080344f <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80344f:	55                   	push   %ebp
+  803450:	89 e5                	mov    %esp,%ebp
+  803452:	57                   	push   %edi
+  803453:	56                   	push   %esi
+  803454:	53                   	push   %ebx
+  803455:	83 ec 10             	sub    $0x10,%esp
+  803458:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80345b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80345e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803461:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803464:	85 c0                	test   %eax,%eax
+  803466:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80346b:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  80346e:	6a 00                	push   $0x0
+  803470:	ff 33                	push   (%ebx)
+  803472:	50                   	push   %eax
+  803473:	e8 af d9 ff ff       	call   800e27 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803478:	83 c4 10             	add    $0x10,%esp
+  80347b:	85 c0                	test   %eax,%eax
+  80347d:	75 3c                	jne    8034bb <ipc_recvv+0x6c>
+  80347f:	8b 15 04 50 80 00    	mov    0x805004,%edx
+  803485:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803488:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  80348a:	85 ff                	test   %edi,%edi
+  80348c:	74 4e                	je     8034dc <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80348e:	8b 15 04 50 80 00    	mov    0x805004,%edx
+  803494:	8b 52 74             	mov    0x74(%edx),%edx
+  803497:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803499:	85 f6                	test   %esi,%esi
+  80349b:	74 18                	je     8034b5 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80349d:	85 c0                	test   %eax,%eax
+  80349f:	75 2d                	jne    8034ce <ipc_recvv+0x7f>
+  8034a1:	a1 04 50 80 00       	mov    0x805004,%eax
+  8034a6:	8b 40 78             	mov    0x78(%eax),%eax
+  8034a9:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8034ab:	a1 04 50 80 00       	mov    0x805004,%eax
+  8034b0:	8b 40 70             	mov    0x70(%eax),%eax
+  8034b3:	eb 1f                	jmp    8034d4 <ipc_recvv+0x85>
+  8034b5:	85 c0                	test   %eax,%eax
+  8034b7:	75 1b                	jne    8034d4 <ipc_recvv+0x85>
+  8034b9:	eb f0                	jmp    8034ab <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8034bb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8034c1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8034c6:	85 ff                	test   %edi,%edi
+  8034c8:	75 cd                	jne    803497 <ipc_recvv+0x48>
+	if (perm_store)
+  8034ca:	85 f6                	test   %esi,%esi
+  8034cc:	74 e7                	je     8034b5 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8034ce:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8034d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034d7:	5b                   	pop    %ebx
+  8034d8:	5e                   	pop    %esi
+  8034d9:	5f                   	pop    %edi
+  8034da:	5d                   	pop    %ebp
+  8034db:	c3                   	ret
+	if (perm_store)
+  8034dc:	85 f6                	test   %esi,%esi
+  8034de:	75 bd                	jne    80349d <ipc_recvv+0x4e>
+  8034e0:	eb c9                	jmp    8034ab <ipc_recvv+0x5c>
+
+008034e2 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8034e2:	55                   	push   %ebp
+  8034e3:	89 e5                	mov    %esp,%ebp
+  8034e5:	57                   	push   %edi
+  8034e6:	56                   	push   %esi
+  8034e7:	53                   	push   %ebx
+  8034e8:	83 ec 0c             	sub    $0xc,%esp
+  8034eb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8034ee:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8034f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8034f4:	ff 75 14             	push   0x14(%ebp)
+  8034f7:	53                   	push   %ebx
+  8034f8:	56                   	push   %esi
+  8034f9:	57                   	push   %edi
+  8034fa:	e8 00 d9 ff ff       	call   800dff <sys_ipc_try_sendv>
+  8034ff:	83 c4 10             	add    $0x10,%esp
+  803502:	85 c0                	test   %eax,%eax
+  803504:	74 22                	je     803528 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803506:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803509:	75 07                	jne    803512 <ipc_sendv+0x30>
+		sys_yield();
+  80350b:	e8 f3 d6 ff ff       	call   800c03 <sys_yield>
+  803510:	eb e2                	jmp    8034f4 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803512:	68 5e 3e 80 00       	push   $0x803e5e
+  803517:	68 4c 3c 80 00       	push   $0x803c4c
+  80351c:	6a 5c                	push   $0x5c
+  80351e:	68 73 3e 80 00       	push   $0x803e73
+  803523:	e8 25 cc ff ff       	call   80014d <_panic>
+	}
+}
+  803528:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80352b:	5b                   	pop    %ebx
+  80352c:	5e                   	pop    %esi
+  80352d:	5f                   	pop    %edi
+  80352e:	5d                   	pop    %ebp
+  80352f:	c3                   	ret
+
+00803530 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803530:	55                   	push   %ebp
+  803531:	89 e5                	mov    %esp,%ebp
+  803533:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803536:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80353b:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803541:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803547:	8b 52 50             	mov    0x50(%edx),%edx
+  80354a:	39 ca                	cmp    %ecx,%edx
+  80354c:	74 11                	je     80355f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80354e:	83 c0 01             	add    $0x1,%eax
+  803551:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803556:	75 e3                	jne    80353b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803558:	b8 00 00 00 00       	mov    $0x0,%eax
+  80355d:	eb 0e                	jmp    80356d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80355f:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803565:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80356a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80356d:	5d                   	pop    %ebp
+  80356e:	c3                   	ret
+
+0080356f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80356f:	55                   	push   %ebp
+  803570:	89 e5                	mov    %esp,%ebp
+  803572:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803575:	89 c2                	mov    %eax,%edx
+  803577:	c1 ea 16             	shr    $0x16,%edx
+  80357a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803581:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803586:	f6 c1 01             	test   $0x1,%cl
+  803589:	74 22                	je     8035ad <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  80358b:	c1 e8 0c             	shr    $0xc,%eax
+  80358e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803595:	a8 01                	test   $0x1,%al
+  803597:	74 14                	je     8035ad <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803599:	c1 e8 0c             	shr    $0xc,%eax
+  80359c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80359f:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8035a6:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8035aa:	0f b7 d2             	movzwl %dx,%edx
+}
+  8035ad:	89 d0                	mov    %edx,%eax
+  8035af:	5d                   	pop    %ebp
+  8035b0:	c3                   	ret
+
+008035b1 <dm>:
+  8035b1:	55                   	push   %ebp
+  8035b2:	57                   	push   %edi
+  8035b3:	56                   	push   %esi
+  8035b4:	53                   	push   %ebx
+  8035b5:	83 ec 24             	sub    $0x24,%esp
+  8035b8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8035bc:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035c0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035c4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035c8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035cc:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035d0:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8035d4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035e3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035ea:	00 
+  8035eb:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035f2:	00 
+  8035f3:	89 fb                	mov    %edi,%ebx
+  8035f5:	eb 08                	jmp    8035ff <dm+0x4e>
+  8035f7:	83 e9 01             	sub    $0x1,%ecx
+  8035fa:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8035fd:	74 68                	je     803667 <dm+0xb6>
+  8035ff:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803603:	01 c0                	add    %eax,%eax
+  803605:	89 c6                	mov    %eax,%esi
+  803607:	89 d7                	mov    %edx,%edi
+  803609:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80360d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803611:	0f ad d0             	shrd   %cl,%edx,%eax
+  803614:	d3 ea                	shr    %cl,%edx
+  803616:	f6 c1 20             	test   $0x20,%cl
+  803619:	74 04                	je     80361f <dm+0x6e>
+  80361b:	89 d0                	mov    %edx,%eax
+  80361d:	31 d2                	xor    %edx,%edx
+  80361f:	83 e0 01             	and    $0x1,%eax
+  803622:	89 04 24             	mov    %eax,(%esp)
+  803625:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80362c:	00 
+  80362d:	8b 04 24             	mov    (%esp),%eax
+  803630:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803634:	09 f0                	or     %esi,%eax
+  803636:	09 fa                	or     %edi,%edx
+  803638:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80363c:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803640:	39 f0                	cmp    %esi,%eax
+  803642:	89 d5                	mov    %edx,%ebp
+  803644:	19 fd                	sbb    %edi,%ebp
+  803646:	72 af                	jb     8035f7 <dm+0x46>
+  803648:	29 f0                	sub    %esi,%eax
+  80364a:	19 fa                	sbb    %edi,%edx
+  80364c:	89 cf                	mov    %ecx,%edi
+  80364e:	c1 ef 05             	shr    $0x5,%edi
+  803651:	83 e7 01             	and    $0x1,%edi
+  803654:	89 fe                	mov    %edi,%esi
+  803656:	83 f6 01             	xor    $0x1,%esi
+  803659:	d3 e6                	shl    %cl,%esi
+  80365b:	d3 e7                	shl    %cl,%edi
+  80365d:	09 74 24 18          	or     %esi,0x18(%esp)
+  803661:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803665:	eb 90                	jmp    8035f7 <dm+0x46>
+  803667:	85 db                	test   %ebx,%ebx
+  803669:	74 05                	je     803670 <dm+0xbf>
+  80366b:	89 03                	mov    %eax,(%ebx)
+  80366d:	89 53 04             	mov    %edx,0x4(%ebx)
+  803670:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803674:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803678:	83 c4 24             	add    $0x24,%esp
+  80367b:	5b                   	pop    %ebx
+  80367c:	5e                   	pop    %esi
+  80367d:	5f                   	pop    %edi
+  80367e:	5d                   	pop    %ebp
+  80367f:	c3                   	ret
+
+00803680 <__udivdi3>:
+  803680:	83 ec 08             	sub    $0x8,%esp
+  803683:	6a 00                	push   $0x0
+  803685:	ff 74 24 1c          	push   0x1c(%esp)
+  803689:	ff 74 24 1c          	push   0x1c(%esp)
+  80368d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803691:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803695:	e8 17 ff ff ff       	call   8035b1 <dm>
+  80369a:	83 c4 14             	add    $0x14,%esp
+  80369d:	c3                   	ret
+
+0080369e <__umoddi3>:
+  80369e:	83 ec 18             	sub    $0x18,%esp
+  8036a1:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036a5:	50                   	push   %eax
+  8036a6:	ff 74 24 2c          	push   0x2c(%esp)
+  8036aa:	ff 74 24 2c          	push   0x2c(%esp)
+  8036ae:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036b2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036b6:	e8 f6 fe ff ff       	call   8035b1 <dm>
+  8036bb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036bf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036c3:	83 c4 24             	add    $0x24,%esp
+  8036c6:	c3                   	ret
+
+008036c7 <__divdi3>:
+  8036c7:	53                   	push   %ebx
+  8036c8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036cc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036d0:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8036d4:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036d8:	85 d2                	test   %edx,%edx
+  8036da:	78 15                	js     8036f1 <__divdi3+0x2a>
+  8036dc:	85 db                	test   %ebx,%ebx
+  8036de:	78 34                	js     803714 <__divdi3+0x4d>
+  8036e0:	83 ec 04             	sub    $0x4,%esp
+  8036e3:	6a 00                	push   $0x0
+  8036e5:	53                   	push   %ebx
+  8036e6:	51                   	push   %ecx
+  8036e7:	e8 c5 fe ff ff       	call   8035b1 <dm>
+  8036ec:	83 c4 10             	add    $0x10,%esp
+  8036ef:	eb 21                	jmp    803712 <__divdi3+0x4b>
+  8036f1:	f7 d8                	neg    %eax
+  8036f3:	83 d2 00             	adc    $0x0,%edx
+  8036f6:	f7 da                	neg    %edx
+  8036f8:	85 db                	test   %ebx,%ebx
+  8036fa:	78 30                	js     80372c <__divdi3+0x65>
+  8036fc:	83 ec 04             	sub    $0x4,%esp
+  8036ff:	6a 00                	push   $0x0
+  803701:	53                   	push   %ebx
+  803702:	51                   	push   %ecx
+  803703:	e8 a9 fe ff ff       	call   8035b1 <dm>
+  803708:	83 c4 10             	add    $0x10,%esp
+  80370b:	f7 d8                	neg    %eax
+  80370d:	83 d2 00             	adc    $0x0,%edx
+  803710:	f7 da                	neg    %edx
+  803712:	5b                   	pop    %ebx
+  803713:	c3                   	ret
+  803714:	83 ec 04             	sub    $0x4,%esp
+  803717:	6a 00                	push   $0x0
+  803719:	f7 d9                	neg    %ecx
+  80371b:	83 d3 00             	adc    $0x0,%ebx
+  80371e:	f7 db                	neg    %ebx
+  803720:	53                   	push   %ebx
+  803721:	51                   	push   %ecx
+  803722:	e8 8a fe ff ff       	call   8035b1 <dm>
+  803727:	83 c4 10             	add    $0x10,%esp
+  80372a:	eb df                	jmp    80370b <__divdi3+0x44>
+  80372c:	83 ec 04             	sub    $0x4,%esp
+  80372f:	6a 00                	push   $0x0
+  803731:	f7 d9                	neg    %ecx
+  803733:	83 d3 00             	adc    $0x0,%ebx
+  803736:	f7 db                	neg    %ebx
+  803738:	53                   	push   %ebx
+  803739:	51                   	push   %ecx
+  80373a:	e8 72 fe ff ff       	call   8035b1 <dm>
+  80373f:	83 c4 10             	add    $0x10,%esp
+  803742:	eb ce                	jmp    803712 <__divdi3+0x4b>
+
+00803744 <__moddi3>:
+  803744:	55                   	push   %ebp
+  803745:	57                   	push   %edi
+  803746:	56                   	push   %esi
+  803747:	53                   	push   %ebx
+  803748:	83 ec 24             	sub    $0x24,%esp
+  80374b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80374f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803753:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803757:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80375b:	85 d2                	test   %edx,%edx
+  80375d:	78 3b                	js     80379a <__moddi3+0x56>
+  80375f:	83 ec 04             	sub    $0x4,%esp
+  803762:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803766:	56                   	push   %esi
+  803767:	89 ce                	mov    %ecx,%esi
+  803769:	f7 de                	neg    %esi
+  80376b:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80376f:	89 de                	mov    %ebx,%esi
+  803771:	83 d6 00             	adc    $0x0,%esi
+  803774:	f7 de                	neg    %esi
+  803776:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80377a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80377e:	0f 48 f1             	cmovs  %ecx,%esi
+  803781:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803786:	53                   	push   %ebx
+  803787:	56                   	push   %esi
+  803788:	e8 24 fe ff ff       	call   8035b1 <dm>
+  80378d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803791:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803795:	83 c4 10             	add    $0x10,%esp
+  803798:	eb 47                	jmp    8037e1 <__moddi3+0x9d>
+  80379a:	f7 d8                	neg    %eax
+  80379c:	83 d2 00             	adc    $0x0,%edx
+  80379f:	f7 da                	neg    %edx
+  8037a1:	83 ec 04             	sub    $0x4,%esp
+  8037a4:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8037a8:	56                   	push   %esi
+  8037a9:	89 cf                	mov    %ecx,%edi
+  8037ab:	f7 df                	neg    %edi
+  8037ad:	89 de                	mov    %ebx,%esi
+  8037af:	83 d6 00             	adc    $0x0,%esi
+  8037b2:	f7 de                	neg    %esi
+  8037b4:	0f 49 cf             	cmovns %edi,%ecx
+  8037b7:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8037bb:	0f 49 de             	cmovns %esi,%ebx
+  8037be:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8037c2:	ff 74 24 0c          	push   0xc(%esp)
+  8037c6:	ff 74 24 0c          	push   0xc(%esp)
+  8037ca:	e8 e2 fd ff ff       	call   8035b1 <dm>
+  8037cf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037d3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037d7:	f7 d8                	neg    %eax
+  8037d9:	83 d2 00             	adc    $0x0,%edx
+  8037dc:	f7 da                	neg    %edx
+  8037de:	83 c4 10             	add    $0x10,%esp
+  8037e1:	83 c4 24             	add    $0x24,%esp
+  8037e4:	5b                   	pop    %ebx
+  8037e5:	5e                   	pop    %esi
+  8037e6:	5f                   	pop    %edi
+  8037e7:	5d                   	pop    %ebp
+  8037e8:	c3                   	ret
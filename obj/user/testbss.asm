@@ -0,0 +1,7681 @@
+
+obj/user/testbss.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ab 00 00 00       	call   8000dc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	int i;
+
+	cprintf("Making sure bss works right...\n");
+  800039:	68 e0 37 80 00       	push   $0x8037e0
+  80003e:	e8 d7 01 00 00       	call   80021a <cprintf>
+  800043:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < ARRAYSIZE; i++)
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != 0)
+  80004b:	83 3c 85 00 50 80 00 	cmpl   $0x0,0x805000(,%eax,4)
+  800052:	00 
+  800053:	75 63                	jne    8000b8 <umain+0x85>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800055:	83 c0 01             	add    $0x1,%eax
+  800058:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80005d:	75 ec                	jne    80004b <umain+0x18>
+			panic("bigarray[%d] isn't cleared!\n", i);
+	for (i = 0; i < ARRAYSIZE; i++)
+  80005f:	b8 00 00 00 00       	mov    $0x0,%eax
+		bigarray[i] = i;
+  800064:	89 04 85 00 50 80 00 	mov    %eax,0x805000(,%eax,4)
+	for (i = 0; i < ARRAYSIZE; i++)
+  80006b:	83 c0 01             	add    $0x1,%eax
+  80006e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800073:	75 ef                	jne    800064 <umain+0x31>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != i)
+  80007a:	39 04 85 00 50 80 00 	cmp    %eax,0x805000(,%eax,4)
+  800081:	75 47                	jne    8000ca <umain+0x97>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800083:	83 c0 01             	add    $0x1,%eax
+  800086:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80008b:	75 ed                	jne    80007a <umain+0x47>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+
+	cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  80008d:	83 ec 0c             	sub    $0xc,%esp
+  800090:	68 28 38 80 00       	push   $0x803828
+  800095:	e8 80 01 00 00       	call   80021a <cprintf>
+	bigarray[ARRAYSIZE+1024] = 0;
+  80009a:	c7 05 00 60 c0 00 00 	movl   $0x0,0xc06000
+  8000a1:	00 00 00 
+	panic("SHOULD HAVE TRAPPED!!!");
+  8000a4:	83 c4 0c             	add    $0xc,%esp
+  8000a7:	68 87 38 80 00       	push   $0x803887
+  8000ac:	6a 1a                	push   $0x1a
+  8000ae:	68 78 38 80 00       	push   $0x803878
+  8000b3:	e8 87 00 00 00       	call   80013f <_panic>
+			panic("bigarray[%d] isn't cleared!\n", i);
+  8000b8:	50                   	push   %eax
+  8000b9:	68 5b 38 80 00       	push   $0x80385b
+  8000be:	6a 11                	push   $0x11
+  8000c0:	68 78 38 80 00       	push   $0x803878
+  8000c5:	e8 75 00 00 00       	call   80013f <_panic>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+  8000ca:	50                   	push   %eax
+  8000cb:	68 00 38 80 00       	push   $0x803800
+  8000d0:	6a 16                	push   $0x16
+  8000d2:	68 78 38 80 00       	push   $0x803878
+  8000d7:	e8 63 00 00 00       	call   80013f <_panic>
+
+008000dc <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000dc:	55                   	push   %ebp
+  8000dd:	89 e5                	mov    %esp,%ebp
+  8000df:	56                   	push   %esi
+  8000e0:	53                   	push   %ebx
+  8000e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000e7:	e8 e2 0a 00 00       	call   800bce <sys_getenvid>
+  8000ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f1:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8000f7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000fc:	a3 00 50 c0 00       	mov    %eax,0xc05000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800101:	85 db                	test   %ebx,%ebx
+  800103:	7e 07                	jle    80010c <libmain+0x30>
+		binaryname = argv[0];
+  800105:	8b 06                	mov    (%esi),%eax
+  800107:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80010c:	83 ec 08             	sub    $0x8,%esp
+  80010f:	56                   	push   %esi
+  800110:	53                   	push   %ebx
+  800111:	e8 1d ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800116:	e8 0a 00 00 00       	call   800125 <exit>
+}
+  80011b:	83 c4 10             	add    $0x10,%esp
+  80011e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800121:	5b                   	pop    %ebx
+  800122:	5e                   	pop    %esi
+  800123:	5d                   	pop    %ebp
+  800124:	c3                   	ret
+
+00800125 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800125:	55                   	push   %ebp
+  800126:	89 e5                	mov    %esp,%ebp
+  800128:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80012b:	e8 b9 10 00 00       	call   8011e9 <close_all>
+	sys_env_destroy(0);
+  800130:	83 ec 0c             	sub    $0xc,%esp
+  800133:	6a 00                	push   $0x0
+  800135:	e8 4b 0a 00 00       	call   800b85 <sys_env_destroy>
+}
+  80013a:	83 c4 10             	add    $0x10,%esp
+  80013d:	c9                   	leave
+  80013e:	c3                   	ret
+
+0080013f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80013f:	55                   	push   %ebp
+  800140:	89 e5                	mov    %esp,%ebp
+  800142:	56                   	push   %esi
+  800143:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800144:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800147:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80014d:	e8 7c 0a 00 00       	call   800bce <sys_getenvid>
+  800152:	83 ec 0c             	sub    $0xc,%esp
+  800155:	ff 75 0c             	push   0xc(%ebp)
+  800158:	ff 75 08             	push   0x8(%ebp)
+  80015b:	56                   	push   %esi
+  80015c:	50                   	push   %eax
+  80015d:	68 a8 38 80 00       	push   $0x8038a8
+  800162:	e8 b3 00 00 00       	call   80021a <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800167:	83 c4 18             	add    $0x18,%esp
+  80016a:	53                   	push   %ebx
+  80016b:	ff 75 10             	push   0x10(%ebp)
+  80016e:	e8 56 00 00 00       	call   8001c9 <vcprintf>
+	cprintf("\n");
+  800173:	c7 04 24 76 38 80 00 	movl   $0x803876,(%esp)
+  80017a:	e8 9b 00 00 00       	call   80021a <cprintf>
+  80017f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800182:	cc                   	int3
+	while (1)
+  800183:	eb fd                	jmp    800182 <_panic+0x43>
+
+00800185 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800185:	55                   	push   %ebp
+  800186:	89 e5                	mov    %esp,%ebp
+  800188:	53                   	push   %ebx
+  800189:	83 ec 04             	sub    $0x4,%esp
+  80018c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80018f:	8b 13                	mov    (%ebx),%edx
+  800191:	8d 42 01             	lea    0x1(%edx),%eax
+  800194:	89 03                	mov    %eax,(%ebx)
+  800196:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800199:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80019d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001a2:	74 09                	je     8001ad <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001a4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001ab:	c9                   	leave
+  8001ac:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001ad:	83 ec 08             	sub    $0x8,%esp
+  8001b0:	68 ff 00 00 00       	push   $0xff
+  8001b5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001b8:	50                   	push   %eax
+  8001b9:	e8 7a 09 00 00       	call   800b38 <sys_cputs>
+		b->idx = 0;
+  8001be:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001c4:	83 c4 10             	add    $0x10,%esp
+  8001c7:	eb db                	jmp    8001a4 <putch+0x1f>
+
+008001c9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001c9:	55                   	push   %ebp
+  8001ca:	89 e5                	mov    %esp,%ebp
+  8001cc:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001d2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001d9:	00 00 00 
+	b.cnt = 0;
+  8001dc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001e3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001e6:	ff 75 0c             	push   0xc(%ebp)
+  8001e9:	ff 75 08             	push   0x8(%ebp)
+  8001ec:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001f2:	50                   	push   %eax
+  8001f3:	68 85 01 80 00       	push   $0x800185
+  8001f8:	e8 14 01 00 00       	call   800311 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001fd:	83 c4 08             	add    $0x8,%esp
+  800200:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800206:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80020c:	50                   	push   %eax
+  80020d:	e8 26 09 00 00       	call   800b38 <sys_cputs>
+
+	return b.cnt;
+}
+  800212:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800218:	c9                   	leave
+  800219:	c3                   	ret
+
+0080021a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80021a:	55                   	push   %ebp
+  80021b:	89 e5                	mov    %esp,%ebp
+  80021d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800220:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800223:	50                   	push   %eax
+  800224:	ff 75 08             	push   0x8(%ebp)
+  800227:	e8 9d ff ff ff       	call   8001c9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80022c:	c9                   	leave
+  80022d:	c3                   	ret
+
+0080022e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80022e:	55                   	push   %ebp
+  80022f:	89 e5                	mov    %esp,%ebp
+  800231:	57                   	push   %edi
+  800232:	56                   	push   %esi
+  800233:	53                   	push   %ebx
+  800234:	83 ec 1c             	sub    $0x1c,%esp
+  800237:	89 c7                	mov    %eax,%edi
+  800239:	89 d6                	mov    %edx,%esi
+  80023b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80023e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800241:	89 d1                	mov    %edx,%ecx
+  800243:	89 c2                	mov    %eax,%edx
+  800245:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800248:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80024b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80024e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800251:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800254:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80025b:	39 c2                	cmp    %eax,%edx
+  80025d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800260:	72 3e                	jb     8002a0 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800262:	83 ec 0c             	sub    $0xc,%esp
+  800265:	ff 75 18             	push   0x18(%ebp)
+  800268:	83 eb 01             	sub    $0x1,%ebx
+  80026b:	53                   	push   %ebx
+  80026c:	50                   	push   %eax
+  80026d:	83 ec 08             	sub    $0x8,%esp
+  800270:	ff 75 e4             	push   -0x1c(%ebp)
+  800273:	ff 75 e0             	push   -0x20(%ebp)
+  800276:	ff 75 dc             	push   -0x24(%ebp)
+  800279:	ff 75 d8             	push   -0x28(%ebp)
+  80027c:	e8 f1 33 00 00       	call   803672 <__udivdi3>
+  800281:	83 c4 18             	add    $0x18,%esp
+  800284:	52                   	push   %edx
+  800285:	50                   	push   %eax
+  800286:	89 f2                	mov    %esi,%edx
+  800288:	89 f8                	mov    %edi,%eax
+  80028a:	e8 9f ff ff ff       	call   80022e <printnum>
+  80028f:	83 c4 20             	add    $0x20,%esp
+  800292:	eb 13                	jmp    8002a7 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800294:	83 ec 08             	sub    $0x8,%esp
+  800297:	56                   	push   %esi
+  800298:	ff 75 18             	push   0x18(%ebp)
+  80029b:	ff d7                	call   *%edi
+  80029d:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002a0:	83 eb 01             	sub    $0x1,%ebx
+  8002a3:	85 db                	test   %ebx,%ebx
+  8002a5:	7f ed                	jg     800294 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002a7:	83 ec 08             	sub    $0x8,%esp
+  8002aa:	56                   	push   %esi
+  8002ab:	83 ec 04             	sub    $0x4,%esp
+  8002ae:	ff 75 e4             	push   -0x1c(%ebp)
+  8002b1:	ff 75 e0             	push   -0x20(%ebp)
+  8002b4:	ff 75 dc             	push   -0x24(%ebp)
+  8002b7:	ff 75 d8             	push   -0x28(%ebp)
+  8002ba:	e8 d1 33 00 00       	call   803690 <__umoddi3>
+  8002bf:	83 c4 14             	add    $0x14,%esp
+  8002c2:	0f be 80 cb 38 80 00 	movsbl 0x8038cb(%eax),%eax
+  8002c9:	50                   	push   %eax
+  8002ca:	ff d7                	call   *%edi
+}
+  8002cc:	83 c4 10             	add    $0x10,%esp
+  8002cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d2:	5b                   	pop    %ebx
+  8002d3:	5e                   	pop    %esi
+  8002d4:	5f                   	pop    %edi
+  8002d5:	5d                   	pop    %ebp
+  8002d6:	c3                   	ret
+
+008002d7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002d7:	55                   	push   %ebp
+  8002d8:	89 e5                	mov    %esp,%ebp
+  8002da:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002dd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002e1:	8b 10                	mov    (%eax),%edx
+  8002e3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002e6:	73 0a                	jae    8002f2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002e8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002eb:	89 08                	mov    %ecx,(%eax)
+  8002ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002f0:	88 02                	mov    %al,(%edx)
+}
+  8002f2:	5d                   	pop    %ebp
+  8002f3:	c3                   	ret
+
+008002f4 <printfmt>:
+{
+  8002f4:	55                   	push   %ebp
+  8002f5:	89 e5                	mov    %esp,%ebp
+  8002f7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002fa:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002fd:	50                   	push   %eax
+  8002fe:	ff 75 10             	push   0x10(%ebp)
+  800301:	ff 75 0c             	push   0xc(%ebp)
+  800304:	ff 75 08             	push   0x8(%ebp)
+  800307:	e8 05 00 00 00       	call   800311 <vprintfmt>
+}
+  80030c:	83 c4 10             	add    $0x10,%esp
+  80030f:	c9                   	leave
+  800310:	c3                   	ret
+
+00800311 <vprintfmt>:
+{
+  800311:	55                   	push   %ebp
+  800312:	89 e5                	mov    %esp,%ebp
+  800314:	57                   	push   %edi
+  800315:	56                   	push   %esi
+  800316:	53                   	push   %ebx
+  800317:	83 ec 2c             	sub    $0x2c,%esp
+  80031a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80031d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800320:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800323:	eb 0a                	jmp    80032f <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800325:	83 ec 08             	sub    $0x8,%esp
+  800328:	53                   	push   %ebx
+  800329:	50                   	push   %eax
+  80032a:	ff d6                	call   *%esi
+  80032c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80032f:	83 c7 01             	add    $0x1,%edi
+  800332:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800336:	83 f8 25             	cmp    $0x25,%eax
+  800339:	74 0c                	je     800347 <vprintfmt+0x36>
+			if (ch == '\0')
+  80033b:	85 c0                	test   %eax,%eax
+  80033d:	75 e6                	jne    800325 <vprintfmt+0x14>
+}
+  80033f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800342:	5b                   	pop    %ebx
+  800343:	5e                   	pop    %esi
+  800344:	5f                   	pop    %edi
+  800345:	5d                   	pop    %ebp
+  800346:	c3                   	ret
+		padc = ' ';
+  800347:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80034b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800352:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800359:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800360:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800365:	8d 47 01             	lea    0x1(%edi),%eax
+  800368:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80036b:	0f b6 17             	movzbl (%edi),%edx
+  80036e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800371:	3c 55                	cmp    $0x55,%al
+  800373:	0f 87 cf 03 00 00    	ja     800748 <vprintfmt+0x437>
+  800379:	0f b6 c0             	movzbl %al,%eax
+  80037c:	ff 24 85 20 3a 80 00 	jmp    *0x803a20(,%eax,4)
+  800383:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800386:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80038a:	eb d9                	jmp    800365 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80038c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80038f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800393:	eb d0                	jmp    800365 <vprintfmt+0x54>
+  800395:	0f b6 d2             	movzbl %dl,%edx
+  800398:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80039b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003a3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003a6:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003aa:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003ad:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003b0:	83 f9 09             	cmp    $0x9,%ecx
+  8003b3:	77 55                	ja     80040a <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003b5:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003b8:	eb e9                	jmp    8003a3 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bd:	8b 00                	mov    (%eax),%eax
+  8003bf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8003c8:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003ce:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d2:	79 91                	jns    800365 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003d4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003da:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003e1:	eb 82                	jmp    800365 <vprintfmt+0x54>
+			if (width < 0)
+  8003e3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003e6:	85 d2                	test   %edx,%edx
+  8003e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ed:	0f 49 c2             	cmovns %edx,%eax
+  8003f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8003f6:	e9 6a ff ff ff       	jmp    800365 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8003fe:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800405:	e9 5b ff ff ff       	jmp    800365 <vprintfmt+0x54>
+  80040a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80040d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800410:	eb bc                	jmp    8003ce <vprintfmt+0xbd>
+			lflag++;
+  800412:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800415:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800418:	e9 48 ff ff ff       	jmp    800365 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80041d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800420:	8d 78 04             	lea    0x4(%eax),%edi
+  800423:	83 ec 08             	sub    $0x8,%esp
+  800426:	53                   	push   %ebx
+  800427:	ff 30                	push   (%eax)
+  800429:	ff d6                	call   *%esi
+			break;
+  80042b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80042e:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800431:	e9 b1 02 00 00       	jmp    8006e7 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800436:	8b 45 14             	mov    0x14(%ebp),%eax
+  800439:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80043c:	8b 10                	mov    (%eax),%edx
+  80043e:	89 d0                	mov    %edx,%eax
+  800440:	f7 d8                	neg    %eax
+  800442:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800445:	83 f8 11             	cmp    $0x11,%eax
+  800448:	7f 23                	jg     80046d <vprintfmt+0x15c>
+  80044a:	8b 14 85 80 3b 80 00 	mov    0x803b80(,%eax,4),%edx
+  800451:	85 d2                	test   %edx,%edx
+  800453:	74 18                	je     80046d <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800455:	52                   	push   %edx
+  800456:	68 d2 3c 80 00       	push   $0x803cd2
+  80045b:	53                   	push   %ebx
+  80045c:	56                   	push   %esi
+  80045d:	e8 92 fe ff ff       	call   8002f4 <printfmt>
+  800462:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800465:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800468:	e9 7a 02 00 00       	jmp    8006e7 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80046d:	50                   	push   %eax
+  80046e:	68 e3 38 80 00       	push   $0x8038e3
+  800473:	53                   	push   %ebx
+  800474:	56                   	push   %esi
+  800475:	e8 7a fe ff ff       	call   8002f4 <printfmt>
+  80047a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047d:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800480:	e9 62 02 00 00       	jmp    8006e7 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800485:	8b 45 14             	mov    0x14(%ebp),%eax
+  800488:	83 c0 04             	add    $0x4,%eax
+  80048b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80048e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800491:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800493:	85 c9                	test   %ecx,%ecx
+  800495:	b8 dc 38 80 00       	mov    $0x8038dc,%eax
+  80049a:	0f 45 c1             	cmovne %ecx,%eax
+  80049d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004a0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004a4:	7e 06                	jle    8004ac <vprintfmt+0x19b>
+  8004a6:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004aa:	75 0b                	jne    8004b7 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ac:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004af:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004b2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004b5:	eb 5c                	jmp    800513 <vprintfmt+0x202>
+  8004b7:	83 ec 08             	sub    $0x8,%esp
+  8004ba:	ff 75 d0             	push   -0x30(%ebp)
+  8004bd:	ff 75 cc             	push   -0x34(%ebp)
+  8004c0:	e8 20 03 00 00       	call   8007e5 <strnlen>
+  8004c5:	89 c2                	mov    %eax,%edx
+  8004c7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ca:	29 d0                	sub    %edx,%eax
+  8004cc:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004cf:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004d6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004d9:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004db:	eb 0e                	jmp    8004eb <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004dd:	83 ec 08             	sub    $0x8,%esp
+  8004e0:	53                   	push   %ebx
+  8004e1:	57                   	push   %edi
+  8004e2:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e5:	83 ee 01             	sub    $0x1,%esi
+  8004e8:	83 c4 10             	add    $0x10,%esp
+  8004eb:	85 f6                	test   %esi,%esi
+  8004ed:	7f ee                	jg     8004dd <vprintfmt+0x1cc>
+  8004ef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f5:	85 c0                	test   %eax,%eax
+  8004f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004fc:	0f 49 d0             	cmovns %eax,%edx
+  8004ff:	29 d0                	sub    %edx,%eax
+  800501:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800504:	eb a6                	jmp    8004ac <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800506:	83 ec 08             	sub    $0x8,%esp
+  800509:	53                   	push   %ebx
+  80050a:	52                   	push   %edx
+  80050b:	ff 55 08             	call   *0x8(%ebp)
+  80050e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800511:	89 f1                	mov    %esi,%ecx
+  800513:	8d 71 01             	lea    0x1(%ecx),%esi
+  800516:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80051a:	0f be d0             	movsbl %al,%edx
+  80051d:	85 d2                	test   %edx,%edx
+  80051f:	74 28                	je     800549 <vprintfmt+0x238>
+  800521:	85 ff                	test   %edi,%edi
+  800523:	78 05                	js     80052a <vprintfmt+0x219>
+  800525:	83 ef 01             	sub    $0x1,%edi
+  800528:	78 30                	js     80055a <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80052a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80052e:	74 d6                	je     800506 <vprintfmt+0x1f5>
+  800530:	0f be c0             	movsbl %al,%eax
+  800533:	83 e8 20             	sub    $0x20,%eax
+  800536:	83 f8 5e             	cmp    $0x5e,%eax
+  800539:	76 cb                	jbe    800506 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80053b:	83 ec 08             	sub    $0x8,%esp
+  80053e:	53                   	push   %ebx
+  80053f:	6a 3f                	push   $0x3f
+  800541:	ff 55 08             	call   *0x8(%ebp)
+  800544:	83 c4 10             	add    $0x10,%esp
+  800547:	eb c8                	jmp    800511 <vprintfmt+0x200>
+  800549:	8b 75 08             	mov    0x8(%ebp),%esi
+  80054c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80054f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800552:	01 d0                	add    %edx,%eax
+  800554:	29 c8                	sub    %ecx,%eax
+  800556:	89 c7                	mov    %eax,%edi
+  800558:	eb 13                	jmp    80056d <vprintfmt+0x25c>
+  80055a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80055d:	eb ed                	jmp    80054c <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80055f:	83 ec 08             	sub    $0x8,%esp
+  800562:	53                   	push   %ebx
+  800563:	6a 20                	push   $0x20
+  800565:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800567:	83 ef 01             	sub    $0x1,%edi
+  80056a:	83 c4 10             	add    $0x10,%esp
+  80056d:	85 ff                	test   %edi,%edi
+  80056f:	7f ee                	jg     80055f <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800571:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800574:	89 45 14             	mov    %eax,0x14(%ebp)
+  800577:	e9 6b 01 00 00       	jmp    8006e7 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80057c:	83 f9 01             	cmp    $0x1,%ecx
+  80057f:	7f 1f                	jg     8005a0 <vprintfmt+0x28f>
+	else if (lflag)
+  800581:	85 c9                	test   %ecx,%ecx
+  800583:	74 67                	je     8005ec <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800585:	8b 45 14             	mov    0x14(%ebp),%eax
+  800588:	8b 00                	mov    (%eax),%eax
+  80058a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80058d:	89 c1                	mov    %eax,%ecx
+  80058f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800592:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800595:	8b 45 14             	mov    0x14(%ebp),%eax
+  800598:	8d 40 04             	lea    0x4(%eax),%eax
+  80059b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059e:	eb 17                	jmp    8005b7 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a3:	8b 50 04             	mov    0x4(%eax),%edx
+  8005a6:	8b 00                	mov    (%eax),%eax
+  8005a8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ab:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b1:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005b7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ba:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005bd:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005c2:	85 c9                	test   %ecx,%ecx
+  8005c4:	0f 89 03 01 00 00    	jns    8006cd <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005ca:	83 ec 08             	sub    $0x8,%esp
+  8005cd:	53                   	push   %ebx
+  8005ce:	6a 2d                	push   $0x2d
+  8005d0:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005d2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005d8:	f7 da                	neg    %edx
+  8005da:	83 d1 00             	adc    $0x0,%ecx
+  8005dd:	f7 d9                	neg    %ecx
+  8005df:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005e2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005e7:	e9 e1 00 00 00       	jmp    8006cd <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8005ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ef:	8b 00                	mov    (%eax),%eax
+  8005f1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f4:	89 c1                	mov    %eax,%ecx
+  8005f6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005f9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800602:	89 45 14             	mov    %eax,0x14(%ebp)
+  800605:	eb b0                	jmp    8005b7 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800607:	83 f9 01             	cmp    $0x1,%ecx
+  80060a:	7f 1e                	jg     80062a <vprintfmt+0x319>
+	else if (lflag)
+  80060c:	85 c9                	test   %ecx,%ecx
+  80060e:	74 32                	je     800642 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800610:	8b 45 14             	mov    0x14(%ebp),%eax
+  800613:	8b 10                	mov    (%eax),%edx
+  800615:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061a:	8d 40 04             	lea    0x4(%eax),%eax
+  80061d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800620:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800625:	e9 a3 00 00 00       	jmp    8006cd <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80062a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062d:	8b 10                	mov    (%eax),%edx
+  80062f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800632:	8d 40 08             	lea    0x8(%eax),%eax
+  800635:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800638:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80063d:	e9 8b 00 00 00       	jmp    8006cd <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800642:	8b 45 14             	mov    0x14(%ebp),%eax
+  800645:	8b 10                	mov    (%eax),%edx
+  800647:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064c:	8d 40 04             	lea    0x4(%eax),%eax
+  80064f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800652:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800657:	eb 74                	jmp    8006cd <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800659:	83 f9 01             	cmp    $0x1,%ecx
+  80065c:	7f 1b                	jg     800679 <vprintfmt+0x368>
+	else if (lflag)
+  80065e:	85 c9                	test   %ecx,%ecx
+  800660:	74 2c                	je     80068e <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800662:	8b 45 14             	mov    0x14(%ebp),%eax
+  800665:	8b 10                	mov    (%eax),%edx
+  800667:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066c:	8d 40 04             	lea    0x4(%eax),%eax
+  80066f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800672:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800677:	eb 54                	jmp    8006cd <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800679:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067c:	8b 10                	mov    (%eax),%edx
+  80067e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800681:	8d 40 08             	lea    0x8(%eax),%eax
+  800684:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800687:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80068c:	eb 3f                	jmp    8006cd <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	8b 10                	mov    (%eax),%edx
+  800693:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800698:	8d 40 04             	lea    0x4(%eax),%eax
+  80069b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80069e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006a3:	eb 28                	jmp    8006cd <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006a5:	83 ec 08             	sub    $0x8,%esp
+  8006a8:	53                   	push   %ebx
+  8006a9:	6a 30                	push   $0x30
+  8006ab:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006ad:	83 c4 08             	add    $0x8,%esp
+  8006b0:	53                   	push   %ebx
+  8006b1:	6a 78                	push   $0x78
+  8006b3:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b8:	8b 10                	mov    (%eax),%edx
+  8006ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006bf:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006c8:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006cd:	83 ec 0c             	sub    $0xc,%esp
+  8006d0:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006d4:	50                   	push   %eax
+  8006d5:	ff 75 e0             	push   -0x20(%ebp)
+  8006d8:	57                   	push   %edi
+  8006d9:	51                   	push   %ecx
+  8006da:	52                   	push   %edx
+  8006db:	89 da                	mov    %ebx,%edx
+  8006dd:	89 f0                	mov    %esi,%eax
+  8006df:	e8 4a fb ff ff       	call   80022e <printnum>
+			break;
+  8006e4:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8006e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006ea:	e9 40 fc ff ff       	jmp    80032f <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8006ef:	83 f9 01             	cmp    $0x1,%ecx
+  8006f2:	7f 1b                	jg     80070f <vprintfmt+0x3fe>
+	else if (lflag)
+  8006f4:	85 c9                	test   %ecx,%ecx
+  8006f6:	74 2c                	je     800724 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8006f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fb:	8b 10                	mov    (%eax),%edx
+  8006fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800702:	8d 40 04             	lea    0x4(%eax),%eax
+  800705:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800708:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80070d:	eb be                	jmp    8006cd <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80070f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800712:	8b 10                	mov    (%eax),%edx
+  800714:	8b 48 04             	mov    0x4(%eax),%ecx
+  800717:	8d 40 08             	lea    0x8(%eax),%eax
+  80071a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80071d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800722:	eb a9                	jmp    8006cd <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800724:	8b 45 14             	mov    0x14(%ebp),%eax
+  800727:	8b 10                	mov    (%eax),%edx
+  800729:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80072e:	8d 40 04             	lea    0x4(%eax),%eax
+  800731:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800734:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800739:	eb 92                	jmp    8006cd <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  80073b:	83 ec 08             	sub    $0x8,%esp
+  80073e:	53                   	push   %ebx
+  80073f:	6a 25                	push   $0x25
+  800741:	ff d6                	call   *%esi
+			break;
+  800743:	83 c4 10             	add    $0x10,%esp
+  800746:	eb 9f                	jmp    8006e7 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800748:	83 ec 08             	sub    $0x8,%esp
+  80074b:	53                   	push   %ebx
+  80074c:	6a 25                	push   $0x25
+  80074e:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800750:	83 c4 10             	add    $0x10,%esp
+  800753:	89 f8                	mov    %edi,%eax
+  800755:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800759:	74 05                	je     800760 <vprintfmt+0x44f>
+  80075b:	83 e8 01             	sub    $0x1,%eax
+  80075e:	eb f5                	jmp    800755 <vprintfmt+0x444>
+  800760:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800763:	eb 82                	jmp    8006e7 <vprintfmt+0x3d6>
+
+00800765 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800765:	55                   	push   %ebp
+  800766:	89 e5                	mov    %esp,%ebp
+  800768:	83 ec 18             	sub    $0x18,%esp
+  80076b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80076e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800771:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800774:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800778:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80077b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800782:	85 c0                	test   %eax,%eax
+  800784:	74 26                	je     8007ac <vsnprintf+0x47>
+  800786:	85 d2                	test   %edx,%edx
+  800788:	7e 22                	jle    8007ac <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80078a:	ff 75 14             	push   0x14(%ebp)
+  80078d:	ff 75 10             	push   0x10(%ebp)
+  800790:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800793:	50                   	push   %eax
+  800794:	68 d7 02 80 00       	push   $0x8002d7
+  800799:	e8 73 fb ff ff       	call   800311 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80079e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007a1:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007a7:	83 c4 10             	add    $0x10,%esp
+}
+  8007aa:	c9                   	leave
+  8007ab:	c3                   	ret
+		return -E_INVAL;
+  8007ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007b1:	eb f7                	jmp    8007aa <vsnprintf+0x45>
+
+008007b3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007b3:	55                   	push   %ebp
+  8007b4:	89 e5                	mov    %esp,%ebp
+  8007b6:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007b9:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007bc:	50                   	push   %eax
+  8007bd:	ff 75 10             	push   0x10(%ebp)
+  8007c0:	ff 75 0c             	push   0xc(%ebp)
+  8007c3:	ff 75 08             	push   0x8(%ebp)
+  8007c6:	e8 9a ff ff ff       	call   800765 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007cb:	c9                   	leave
+  8007cc:	c3                   	ret
+
+008007cd <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007cd:	55                   	push   %ebp
+  8007ce:	89 e5                	mov    %esp,%ebp
+  8007d0:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d8:	eb 03                	jmp    8007dd <strlen+0x10>
+		n++;
+  8007da:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007dd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007e1:	75 f7                	jne    8007da <strlen+0xd>
+	return n;
+}
+  8007e3:	5d                   	pop    %ebp
+  8007e4:	c3                   	ret
+
+008007e5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007e5:	55                   	push   %ebp
+  8007e6:	89 e5                	mov    %esp,%ebp
+  8007e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f3:	eb 03                	jmp    8007f8 <strnlen+0x13>
+		n++;
+  8007f5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007f8:	39 d0                	cmp    %edx,%eax
+  8007fa:	74 08                	je     800804 <strnlen+0x1f>
+  8007fc:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800800:	75 f3                	jne    8007f5 <strnlen+0x10>
+  800802:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800804:	89 d0                	mov    %edx,%eax
+  800806:	5d                   	pop    %ebp
+  800807:	c3                   	ret
+
+00800808 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800808:	55                   	push   %ebp
+  800809:	89 e5                	mov    %esp,%ebp
+  80080b:	53                   	push   %ebx
+  80080c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80080f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800812:	b8 00 00 00 00       	mov    $0x0,%eax
+  800817:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80081b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80081e:	83 c0 01             	add    $0x1,%eax
+  800821:	84 d2                	test   %dl,%dl
+  800823:	75 f2                	jne    800817 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800825:	89 c8                	mov    %ecx,%eax
+  800827:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80082a:	c9                   	leave
+  80082b:	c3                   	ret
+
+0080082c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80082c:	55                   	push   %ebp
+  80082d:	89 e5                	mov    %esp,%ebp
+  80082f:	53                   	push   %ebx
+  800830:	83 ec 10             	sub    $0x10,%esp
+  800833:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800836:	53                   	push   %ebx
+  800837:	e8 91 ff ff ff       	call   8007cd <strlen>
+  80083c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80083f:	ff 75 0c             	push   0xc(%ebp)
+  800842:	01 d8                	add    %ebx,%eax
+  800844:	50                   	push   %eax
+  800845:	e8 be ff ff ff       	call   800808 <strcpy>
+	return dst;
+}
+  80084a:	89 d8                	mov    %ebx,%eax
+  80084c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80084f:	c9                   	leave
+  800850:	c3                   	ret
+
+00800851 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800851:	55                   	push   %ebp
+  800852:	89 e5                	mov    %esp,%ebp
+  800854:	56                   	push   %esi
+  800855:	53                   	push   %ebx
+  800856:	8b 75 08             	mov    0x8(%ebp),%esi
+  800859:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80085c:	89 f3                	mov    %esi,%ebx
+  80085e:	03 5d 10             	add    0x10(%ebp),%ebx
+  800861:	89 f0                	mov    %esi,%eax
+  800863:	eb 0f                	jmp    800874 <strncpy+0x23>
+		*dst++ = *src;
+  800865:	83 c0 01             	add    $0x1,%eax
+  800868:	0f b6 0a             	movzbl (%edx),%ecx
+  80086b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80086e:	80 f9 01             	cmp    $0x1,%cl
+  800871:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800874:	39 d8                	cmp    %ebx,%eax
+  800876:	75 ed                	jne    800865 <strncpy+0x14>
+	}
+	return ret;
+}
+  800878:	89 f0                	mov    %esi,%eax
+  80087a:	5b                   	pop    %ebx
+  80087b:	5e                   	pop    %esi
+  80087c:	5d                   	pop    %ebp
+  80087d:	c3                   	ret
+
+0080087e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80087e:	55                   	push   %ebp
+  80087f:	89 e5                	mov    %esp,%ebp
+  800881:	56                   	push   %esi
+  800882:	53                   	push   %ebx
+  800883:	8b 75 08             	mov    0x8(%ebp),%esi
+  800886:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800889:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80088c:	89 f0                	mov    %esi,%eax
+  80088e:	85 d2                	test   %edx,%edx
+  800890:	74 21                	je     8008b3 <strlcpy+0x35>
+  800892:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800896:	89 f2                	mov    %esi,%edx
+  800898:	eb 09                	jmp    8008a3 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80089a:	83 c1 01             	add    $0x1,%ecx
+  80089d:	83 c2 01             	add    $0x1,%edx
+  8008a0:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008a3:	39 c2                	cmp    %eax,%edx
+  8008a5:	74 09                	je     8008b0 <strlcpy+0x32>
+  8008a7:	0f b6 19             	movzbl (%ecx),%ebx
+  8008aa:	84 db                	test   %bl,%bl
+  8008ac:	75 ec                	jne    80089a <strlcpy+0x1c>
+  8008ae:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008b0:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008b3:	29 f0                	sub    %esi,%eax
+}
+  8008b5:	5b                   	pop    %ebx
+  8008b6:	5e                   	pop    %esi
+  8008b7:	5d                   	pop    %ebp
+  8008b8:	c3                   	ret
+
+008008b9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008b9:	55                   	push   %ebp
+  8008ba:	89 e5                	mov    %esp,%ebp
+  8008bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008c2:	eb 06                	jmp    8008ca <strcmp+0x11>
+		p++, q++;
+  8008c4:	83 c1 01             	add    $0x1,%ecx
+  8008c7:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008ca:	0f b6 01             	movzbl (%ecx),%eax
+  8008cd:	84 c0                	test   %al,%al
+  8008cf:	74 04                	je     8008d5 <strcmp+0x1c>
+  8008d1:	3a 02                	cmp    (%edx),%al
+  8008d3:	74 ef                	je     8008c4 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008d5:	0f b6 c0             	movzbl %al,%eax
+  8008d8:	0f b6 12             	movzbl (%edx),%edx
+  8008db:	29 d0                	sub    %edx,%eax
+}
+  8008dd:	5d                   	pop    %ebp
+  8008de:	c3                   	ret
+
+008008df <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008df:	55                   	push   %ebp
+  8008e0:	89 e5                	mov    %esp,%ebp
+  8008e2:	53                   	push   %ebx
+  8008e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008e9:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8008ec:	eb 09                	jmp    8008f7 <strncmp+0x18>
+		n--, p++, q++;
+  8008ee:	83 ea 01             	sub    $0x1,%edx
+  8008f1:	83 c0 01             	add    $0x1,%eax
+  8008f4:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8008f7:	85 d2                	test   %edx,%edx
+  8008f9:	74 18                	je     800913 <strncmp+0x34>
+  8008fb:	0f b6 18             	movzbl (%eax),%ebx
+  8008fe:	84 db                	test   %bl,%bl
+  800900:	74 04                	je     800906 <strncmp+0x27>
+  800902:	3a 19                	cmp    (%ecx),%bl
+  800904:	74 e8                	je     8008ee <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800906:	0f b6 00             	movzbl (%eax),%eax
+  800909:	0f b6 11             	movzbl (%ecx),%edx
+  80090c:	29 d0                	sub    %edx,%eax
+}
+  80090e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800911:	c9                   	leave
+  800912:	c3                   	ret
+		return 0;
+  800913:	b8 00 00 00 00       	mov    $0x0,%eax
+  800918:	eb f4                	jmp    80090e <strncmp+0x2f>
+
+0080091a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80091a:	55                   	push   %ebp
+  80091b:	89 e5                	mov    %esp,%ebp
+  80091d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800920:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800924:	eb 03                	jmp    800929 <strchr+0xf>
+  800926:	83 c0 01             	add    $0x1,%eax
+  800929:	0f b6 10             	movzbl (%eax),%edx
+  80092c:	84 d2                	test   %dl,%dl
+  80092e:	74 06                	je     800936 <strchr+0x1c>
+		if (*s == c)
+  800930:	38 ca                	cmp    %cl,%dl
+  800932:	75 f2                	jne    800926 <strchr+0xc>
+  800934:	eb 05                	jmp    80093b <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800936:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80093b:	5d                   	pop    %ebp
+  80093c:	c3                   	ret
+
+0080093d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80093d:	55                   	push   %ebp
+  80093e:	89 e5                	mov    %esp,%ebp
+  800940:	8b 45 08             	mov    0x8(%ebp),%eax
+  800943:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800947:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80094a:	38 ca                	cmp    %cl,%dl
+  80094c:	74 09                	je     800957 <strfind+0x1a>
+  80094e:	84 d2                	test   %dl,%dl
+  800950:	74 05                	je     800957 <strfind+0x1a>
+	for (; *s; s++)
+  800952:	83 c0 01             	add    $0x1,%eax
+  800955:	eb f0                	jmp    800947 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800957:	5d                   	pop    %ebp
+  800958:	c3                   	ret
+
+00800959 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800959:	55                   	push   %ebp
+  80095a:	89 e5                	mov    %esp,%ebp
+  80095c:	57                   	push   %edi
+  80095d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800960:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800963:	85 c9                	test   %ecx,%ecx
+  800965:	74 20                	je     800987 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800967:	89 f8                	mov    %edi,%eax
+  800969:	09 c8                	or     %ecx,%eax
+  80096b:	a8 03                	test   $0x3,%al
+  80096d:	75 12                	jne    800981 <memset+0x28>
+		c &= 0xFF;
+  80096f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800973:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800979:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80097c:	fc                   	cld
+  80097d:	f3 ab                	rep stos %eax,%es:(%edi)
+  80097f:	eb 06                	jmp    800987 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800981:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800984:	fc                   	cld
+  800985:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800987:	89 f8                	mov    %edi,%eax
+  800989:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80098c:	c9                   	leave
+  80098d:	c3                   	ret
+
+0080098e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80098e:	55                   	push   %ebp
+  80098f:	89 e5                	mov    %esp,%ebp
+  800991:	57                   	push   %edi
+  800992:	56                   	push   %esi
+  800993:	8b 45 08             	mov    0x8(%ebp),%eax
+  800996:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800999:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80099c:	39 c6                	cmp    %eax,%esi
+  80099e:	73 32                	jae    8009d2 <memmove+0x44>
+  8009a0:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009a3:	39 d0                	cmp    %edx,%eax
+  8009a5:	73 2b                	jae    8009d2 <memmove+0x44>
+		s += n;
+		d += n;
+  8009a7:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009aa:	89 d6                	mov    %edx,%esi
+  8009ac:	09 fe                	or     %edi,%esi
+  8009ae:	09 ce                	or     %ecx,%esi
+  8009b0:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009b6:	75 0e                	jne    8009c6 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009b8:	83 ef 04             	sub    $0x4,%edi
+  8009bb:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009be:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009c1:	fd                   	std
+  8009c2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009c4:	eb 09                	jmp    8009cf <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009c6:	83 ef 01             	sub    $0x1,%edi
+  8009c9:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009cc:	fd                   	std
+  8009cd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009cf:	fc                   	cld
+  8009d0:	eb 1a                	jmp    8009ec <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009d2:	89 f2                	mov    %esi,%edx
+  8009d4:	09 c2                	or     %eax,%edx
+  8009d6:	09 ca                	or     %ecx,%edx
+  8009d8:	f6 c2 03             	test   $0x3,%dl
+  8009db:	75 0a                	jne    8009e7 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009dd:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009e0:	89 c7                	mov    %eax,%edi
+  8009e2:	fc                   	cld
+  8009e3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009e5:	eb 05                	jmp    8009ec <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009e7:	89 c7                	mov    %eax,%edi
+  8009e9:	fc                   	cld
+  8009ea:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8009ec:	5e                   	pop    %esi
+  8009ed:	5f                   	pop    %edi
+  8009ee:	5d                   	pop    %ebp
+  8009ef:	c3                   	ret
+
+008009f0 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009f0:	55                   	push   %ebp
+  8009f1:	89 e5                	mov    %esp,%ebp
+  8009f3:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8009f6:	ff 75 10             	push   0x10(%ebp)
+  8009f9:	ff 75 0c             	push   0xc(%ebp)
+  8009fc:	ff 75 08             	push   0x8(%ebp)
+  8009ff:	e8 8a ff ff ff       	call   80098e <memmove>
+}
+  800a04:	c9                   	leave
+  800a05:	c3                   	ret
+
+00800a06 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a06:	55                   	push   %ebp
+  800a07:	89 e5                	mov    %esp,%ebp
+  800a09:	56                   	push   %esi
+  800a0a:	53                   	push   %ebx
+  800a0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a11:	89 c6                	mov    %eax,%esi
+  800a13:	03 75 10             	add    0x10(%ebp),%esi
+  800a16:	eb 06                	jmp    800a1e <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a18:	83 c0 01             	add    $0x1,%eax
+  800a1b:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a1e:	39 f0                	cmp    %esi,%eax
+  800a20:	74 14                	je     800a36 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a22:	0f b6 08             	movzbl (%eax),%ecx
+  800a25:	0f b6 1a             	movzbl (%edx),%ebx
+  800a28:	38 d9                	cmp    %bl,%cl
+  800a2a:	74 ec                	je     800a18 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a2c:	0f b6 c1             	movzbl %cl,%eax
+  800a2f:	0f b6 db             	movzbl %bl,%ebx
+  800a32:	29 d8                	sub    %ebx,%eax
+  800a34:	eb 05                	jmp    800a3b <memcmp+0x35>
+	}
+
+	return 0;
+  800a36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a3b:	5b                   	pop    %ebx
+  800a3c:	5e                   	pop    %esi
+  800a3d:	5d                   	pop    %ebp
+  800a3e:	c3                   	ret
+
+00800a3f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a3f:	55                   	push   %ebp
+  800a40:	89 e5                	mov    %esp,%ebp
+  800a42:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a48:	89 c2                	mov    %eax,%edx
+  800a4a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a4d:	eb 03                	jmp    800a52 <memfind+0x13>
+  800a4f:	83 c0 01             	add    $0x1,%eax
+  800a52:	39 d0                	cmp    %edx,%eax
+  800a54:	73 04                	jae    800a5a <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a56:	38 08                	cmp    %cl,(%eax)
+  800a58:	75 f5                	jne    800a4f <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a5a:	5d                   	pop    %ebp
+  800a5b:	c3                   	ret
+
+00800a5c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a5c:	55                   	push   %ebp
+  800a5d:	89 e5                	mov    %esp,%ebp
+  800a5f:	57                   	push   %edi
+  800a60:	56                   	push   %esi
+  800a61:	53                   	push   %ebx
+  800a62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a68:	eb 03                	jmp    800a6d <strtol+0x11>
+		s++;
+  800a6a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a6d:	0f b6 02             	movzbl (%edx),%eax
+  800a70:	3c 20                	cmp    $0x20,%al
+  800a72:	74 f6                	je     800a6a <strtol+0xe>
+  800a74:	3c 09                	cmp    $0x9,%al
+  800a76:	74 f2                	je     800a6a <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a78:	3c 2b                	cmp    $0x2b,%al
+  800a7a:	74 2a                	je     800aa6 <strtol+0x4a>
+	int neg = 0;
+  800a7c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a81:	3c 2d                	cmp    $0x2d,%al
+  800a83:	74 2b                	je     800ab0 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a85:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a8b:	75 0f                	jne    800a9c <strtol+0x40>
+  800a8d:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a90:	74 28                	je     800aba <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a92:	85 db                	test   %ebx,%ebx
+  800a94:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a99:	0f 44 d8             	cmove  %eax,%ebx
+  800a9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa1:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800aa4:	eb 46                	jmp    800aec <strtol+0x90>
+		s++;
+  800aa6:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800aa9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aae:	eb d5                	jmp    800a85 <strtol+0x29>
+		s++, neg = 1;
+  800ab0:	83 c2 01             	add    $0x1,%edx
+  800ab3:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ab8:	eb cb                	jmp    800a85 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aba:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800abe:	74 0e                	je     800ace <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ac0:	85 db                	test   %ebx,%ebx
+  800ac2:	75 d8                	jne    800a9c <strtol+0x40>
+		s++, base = 8;
+  800ac4:	83 c2 01             	add    $0x1,%edx
+  800ac7:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800acc:	eb ce                	jmp    800a9c <strtol+0x40>
+		s += 2, base = 16;
+  800ace:	83 c2 02             	add    $0x2,%edx
+  800ad1:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ad6:	eb c4                	jmp    800a9c <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ad8:	0f be c0             	movsbl %al,%eax
+  800adb:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ade:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ae1:	7d 3a                	jge    800b1d <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800ae3:	83 c2 01             	add    $0x1,%edx
+  800ae6:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800aea:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800aec:	0f b6 02             	movzbl (%edx),%eax
+  800aef:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800af2:	89 f3                	mov    %esi,%ebx
+  800af4:	80 fb 09             	cmp    $0x9,%bl
+  800af7:	76 df                	jbe    800ad8 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800af9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800afc:	89 f3                	mov    %esi,%ebx
+  800afe:	80 fb 19             	cmp    $0x19,%bl
+  800b01:	77 08                	ja     800b0b <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b03:	0f be c0             	movsbl %al,%eax
+  800b06:	83 e8 57             	sub    $0x57,%eax
+  800b09:	eb d3                	jmp    800ade <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b0b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b0e:	89 f3                	mov    %esi,%ebx
+  800b10:	80 fb 19             	cmp    $0x19,%bl
+  800b13:	77 08                	ja     800b1d <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b15:	0f be c0             	movsbl %al,%eax
+  800b18:	83 e8 37             	sub    $0x37,%eax
+  800b1b:	eb c1                	jmp    800ade <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b1d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b21:	74 05                	je     800b28 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b26:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b28:	89 c8                	mov    %ecx,%eax
+  800b2a:	f7 d8                	neg    %eax
+  800b2c:	85 ff                	test   %edi,%edi
+  800b2e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b31:	89 c8                	mov    %ecx,%eax
+  800b33:	5b                   	pop    %ebx
+  800b34:	5e                   	pop    %esi
+  800b35:	5f                   	pop    %edi
+  800b36:	5d                   	pop    %ebp
+  800b37:	c3                   	ret
+
+00800b38 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b38:	55                   	push   %ebp
+  800b39:	89 e5                	mov    %esp,%ebp
+  800b3b:	57                   	push   %edi
+  800b3c:	56                   	push   %esi
+  800b3d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b49:	89 c3                	mov    %eax,%ebx
+  800b4b:	89 c7                	mov    %eax,%edi
+  800b4d:	55                   	push   %ebp
+  800b4e:	89 e5                	mov    %esp,%ebp
+  800b50:	8d 35 58 0b 80 00    	lea    0x800b58,%esi
+  800b56:	0f 34                	sysenter
+  800b58:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800b59:	5b                   	pop    %ebx
+  800b5a:	5e                   	pop    %esi
+  800b5b:	5f                   	pop    %edi
+  800b5c:	5d                   	pop    %ebp
+  800b5d:	c3                   	ret
+
+00800b5e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b5e:	55                   	push   %ebp
+  800b5f:	89 e5                	mov    %esp,%ebp
+  800b61:	57                   	push   %edi
+  800b62:	56                   	push   %esi
+  800b63:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b64:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b69:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b6e:	89 d1                	mov    %edx,%ecx
+  800b70:	89 d3                	mov    %edx,%ebx
+  800b72:	89 d7                	mov    %edx,%edi
+  800b74:	55                   	push   %ebp
+  800b75:	89 e5                	mov    %esp,%ebp
+  800b77:	8d 35 7f 0b 80 00    	lea    0x800b7f,%esi
+  800b7d:	0f 34                	sysenter
+  800b7f:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800b80:	5b                   	pop    %ebx
+  800b81:	5e                   	pop    %esi
+  800b82:	5f                   	pop    %edi
+  800b83:	5d                   	pop    %ebp
+  800b84:	c3                   	ret
+
+00800b85 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b85:	55                   	push   %ebp
+  800b86:	89 e5                	mov    %esp,%ebp
+  800b88:	57                   	push   %edi
+  800b89:	56                   	push   %esi
+  800b8a:	53                   	push   %ebx
+  800b8b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b96:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b9b:	89 cb                	mov    %ecx,%ebx
+  800b9d:	89 cf                	mov    %ecx,%edi
+  800b9f:	55                   	push   %ebp
+  800ba0:	89 e5                	mov    %esp,%ebp
+  800ba2:	8d 35 aa 0b 80 00    	lea    0x800baa,%esi
+  800ba8:	0f 34                	sysenter
+  800baa:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bab:	85 c0                	test   %eax,%eax
+  800bad:	7f 08                	jg     800bb7 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800baf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bb2:	5b                   	pop    %ebx
+  800bb3:	5e                   	pop    %esi
+  800bb4:	5f                   	pop    %edi
+  800bb5:	5d                   	pop    %ebp
+  800bb6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bb7:	83 ec 0c             	sub    $0xc,%esp
+  800bba:	50                   	push   %eax
+  800bbb:	6a 03                	push   $0x3
+  800bbd:	68 e7 3b 80 00       	push   $0x803be7
+  800bc2:	6a 3d                	push   $0x3d
+  800bc4:	68 04 3c 80 00       	push   $0x803c04
+  800bc9:	e8 71 f5 ff ff       	call   80013f <_panic>
+
+00800bce <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	57                   	push   %edi
+  800bd2:	56                   	push   %esi
+  800bd3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800bd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bde:	89 d1                	mov    %edx,%ecx
+  800be0:	89 d3                	mov    %edx,%ebx
+  800be2:	89 d7                	mov    %edx,%edi
+  800be4:	55                   	push   %ebp
+  800be5:	89 e5                	mov    %esp,%ebp
+  800be7:	8d 35 ef 0b 80 00    	lea    0x800bef,%esi
+  800bed:	0f 34                	sysenter
+  800bef:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800bf0:	5b                   	pop    %ebx
+  800bf1:	5e                   	pop    %esi
+  800bf2:	5f                   	pop    %edi
+  800bf3:	5d                   	pop    %ebp
+  800bf4:	c3                   	ret
+
+00800bf5 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bf5:	55                   	push   %ebp
+  800bf6:	89 e5                	mov    %esp,%ebp
+  800bf8:	57                   	push   %edi
+  800bf9:	56                   	push   %esi
+  800bfa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c00:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c05:	89 d1                	mov    %edx,%ecx
+  800c07:	89 d3                	mov    %edx,%ebx
+  800c09:	89 d7                	mov    %edx,%edi
+  800c0b:	89 d6                	mov    %edx,%esi
+  800c0d:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c0f:	5b                   	pop    %ebx
+  800c10:	5e                   	pop    %esi
+  800c11:	5f                   	pop    %edi
+  800c12:	5d                   	pop    %ebp
+  800c13:	c3                   	ret
+
+00800c14 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c14:	55                   	push   %ebp
+  800c15:	89 e5                	mov    %esp,%ebp
+  800c17:	57                   	push   %edi
+  800c18:	56                   	push   %esi
+  800c19:	53                   	push   %ebx
+  800c1a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c23:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c28:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	8d 35 3b 0c 80 00    	lea    0x800c3b,%esi
+  800c39:	0f 34                	sysenter
+  800c3b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c3c:	85 c0                	test   %eax,%eax
+  800c3e:	7f 08                	jg     800c48 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800c40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c43:	5b                   	pop    %ebx
+  800c44:	5e                   	pop    %esi
+  800c45:	5f                   	pop    %edi
+  800c46:	5d                   	pop    %ebp
+  800c47:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c48:	83 ec 0c             	sub    $0xc,%esp
+  800c4b:	50                   	push   %eax
+  800c4c:	6a 04                	push   $0x4
+  800c4e:	68 e7 3b 80 00       	push   $0x803be7
+  800c53:	6a 3d                	push   $0x3d
+  800c55:	68 04 3c 80 00       	push   $0x803c04
+  800c5a:	e8 e0 f4 ff ff       	call   80013f <_panic>
+
+00800c5f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	57                   	push   %edi
+  800c63:	56                   	push   %esi
+  800c64:	53                   	push   %ebx
+  800c65:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c6e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c76:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c79:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c7c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c7e:	85 c0                	test   %eax,%eax
+  800c80:	7f 08                	jg     800c8a <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c85:	5b                   	pop    %ebx
+  800c86:	5e                   	pop    %esi
+  800c87:	5f                   	pop    %edi
+  800c88:	5d                   	pop    %ebp
+  800c89:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c8a:	83 ec 0c             	sub    $0xc,%esp
+  800c8d:	50                   	push   %eax
+  800c8e:	6a 05                	push   $0x5
+  800c90:	68 e7 3b 80 00       	push   $0x803be7
+  800c95:	6a 23                	push   $0x23
+  800c97:	68 04 3c 80 00       	push   $0x803c04
+  800c9c:	e8 9e f4 ff ff       	call   80013f <_panic>
+
+00800ca1 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ca1:	55                   	push   %ebp
+  800ca2:	89 e5                	mov    %esp,%ebp
+  800ca4:	57                   	push   %edi
+  800ca5:	56                   	push   %esi
+  800ca6:	53                   	push   %ebx
+  800ca7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800caa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800caf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cba:	89 df                	mov    %ebx,%edi
+  800cbc:	55                   	push   %ebp
+  800cbd:	89 e5                	mov    %esp,%ebp
+  800cbf:	8d 35 c7 0c 80 00    	lea    0x800cc7,%esi
+  800cc5:	0f 34                	sysenter
+  800cc7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cc8:	85 c0                	test   %eax,%eax
+  800cca:	7f 08                	jg     800cd4 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800ccc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ccf:	5b                   	pop    %ebx
+  800cd0:	5e                   	pop    %esi
+  800cd1:	5f                   	pop    %edi
+  800cd2:	5d                   	pop    %ebp
+  800cd3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cd4:	83 ec 0c             	sub    $0xc,%esp
+  800cd7:	50                   	push   %eax
+  800cd8:	6a 06                	push   $0x6
+  800cda:	68 e7 3b 80 00       	push   $0x803be7
+  800cdf:	6a 3d                	push   $0x3d
+  800ce1:	68 04 3c 80 00       	push   $0x803c04
+  800ce6:	e8 54 f4 ff ff       	call   80013f <_panic>
+
+00800ceb <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ceb:	55                   	push   %ebp
+  800cec:	89 e5                	mov    %esp,%ebp
+  800cee:	57                   	push   %edi
+  800cef:	56                   	push   %esi
+  800cf0:	53                   	push   %ebx
+  800cf1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cf4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cff:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d04:	89 df                	mov    %ebx,%edi
+  800d06:	55                   	push   %ebp
+  800d07:	89 e5                	mov    %esp,%ebp
+  800d09:	8d 35 11 0d 80 00    	lea    0x800d11,%esi
+  800d0f:	0f 34                	sysenter
+  800d11:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d12:	85 c0                	test   %eax,%eax
+  800d14:	7f 08                	jg     800d1e <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800d16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d19:	5b                   	pop    %ebx
+  800d1a:	5e                   	pop    %esi
+  800d1b:	5f                   	pop    %edi
+  800d1c:	5d                   	pop    %ebp
+  800d1d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d1e:	83 ec 0c             	sub    $0xc,%esp
+  800d21:	50                   	push   %eax
+  800d22:	6a 08                	push   $0x8
+  800d24:	68 e7 3b 80 00       	push   $0x803be7
+  800d29:	6a 3d                	push   $0x3d
+  800d2b:	68 04 3c 80 00       	push   $0x803c04
+  800d30:	e8 0a f4 ff ff       	call   80013f <_panic>
+
+00800d35 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d35:	55                   	push   %ebp
+  800d36:	89 e5                	mov    %esp,%ebp
+  800d38:	57                   	push   %edi
+  800d39:	56                   	push   %esi
+  800d3a:	53                   	push   %ebx
+  800d3b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d49:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d4e:	89 df                	mov    %ebx,%edi
+  800d50:	55                   	push   %ebp
+  800d51:	89 e5                	mov    %esp,%ebp
+  800d53:	8d 35 5b 0d 80 00    	lea    0x800d5b,%esi
+  800d59:	0f 34                	sysenter
+  800d5b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d5c:	85 c0                	test   %eax,%eax
+  800d5e:	7f 08                	jg     800d68 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d63:	5b                   	pop    %ebx
+  800d64:	5e                   	pop    %esi
+  800d65:	5f                   	pop    %edi
+  800d66:	5d                   	pop    %ebp
+  800d67:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d68:	83 ec 0c             	sub    $0xc,%esp
+  800d6b:	50                   	push   %eax
+  800d6c:	6a 09                	push   $0x9
+  800d6e:	68 e7 3b 80 00       	push   $0x803be7
+  800d73:	6a 3d                	push   $0x3d
+  800d75:	68 04 3c 80 00       	push   $0x803c04
+  800d7a:	e8 c0 f3 ff ff       	call   80013f <_panic>
+
+00800d7f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d7f:	55                   	push   %ebp
+  800d80:	89 e5                	mov    %esp,%ebp
+  800d82:	57                   	push   %edi
+  800d83:	56                   	push   %esi
+  800d84:	53                   	push   %ebx
+  800d85:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d93:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d98:	89 df                	mov    %ebx,%edi
+  800d9a:	55                   	push   %ebp
+  800d9b:	89 e5                	mov    %esp,%ebp
+  800d9d:	8d 35 a5 0d 80 00    	lea    0x800da5,%esi
+  800da3:	0f 34                	sysenter
+  800da5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800da6:	85 c0                	test   %eax,%eax
+  800da8:	7f 08                	jg     800db2 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800daa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dad:	5b                   	pop    %ebx
+  800dae:	5e                   	pop    %esi
+  800daf:	5f                   	pop    %edi
+  800db0:	5d                   	pop    %ebp
+  800db1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db2:	83 ec 0c             	sub    $0xc,%esp
+  800db5:	50                   	push   %eax
+  800db6:	6a 0a                	push   $0xa
+  800db8:	68 e7 3b 80 00       	push   $0x803be7
+  800dbd:	6a 3d                	push   $0x3d
+  800dbf:	68 04 3c 80 00       	push   $0x803c04
+  800dc4:	e8 76 f3 ff ff       	call   80013f <_panic>
+
+00800dc9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800dc9:	55                   	push   %ebp
+  800dca:	89 e5                	mov    %esp,%ebp
+  800dcc:	57                   	push   %edi
+  800dcd:	56                   	push   %esi
+  800dce:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800dcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800dda:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ddd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800de0:	55                   	push   %ebp
+  800de1:	89 e5                	mov    %esp,%ebp
+  800de3:	8d 35 eb 0d 80 00    	lea    0x800deb,%esi
+  800de9:	0f 34                	sysenter
+  800deb:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800dec:	5b                   	pop    %ebx
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+
+00800df1 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	57                   	push   %edi
+  800df5:	56                   	push   %esi
+  800df6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800df7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfd:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e05:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e08:	55                   	push   %ebp
+  800e09:	89 e5                	mov    %esp,%ebp
+  800e0b:	8d 35 13 0e 80 00    	lea    0x800e13,%esi
+  800e11:	0f 34                	sysenter
+  800e13:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800e14:	5b                   	pop    %ebx
+  800e15:	5e                   	pop    %esi
+  800e16:	5f                   	pop    %edi
+  800e17:	5d                   	pop    %ebp
+  800e18:	c3                   	ret
+
+00800e19 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800e19:	55                   	push   %ebp
+  800e1a:	89 e5                	mov    %esp,%ebp
+  800e1c:	57                   	push   %edi
+  800e1d:	56                   	push   %esi
+  800e1e:	53                   	push   %ebx
+  800e1f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e22:	be 00 00 00 00       	mov    $0x0,%esi
+  800e27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e35:	89 f7                	mov    %esi,%edi
+  800e37:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e39:	85 c0                	test   %eax,%eax
+  800e3b:	7f 08                	jg     800e45 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800e3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e40:	5b                   	pop    %ebx
+  800e41:	5e                   	pop    %esi
+  800e42:	5f                   	pop    %edi
+  800e43:	5d                   	pop    %ebp
+  800e44:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e45:	83 ec 0c             	sub    $0xc,%esp
+  800e48:	50                   	push   %eax
+  800e49:	6a 0d                	push   $0xd
+  800e4b:	68 e7 3b 80 00       	push   $0x803be7
+  800e50:	6a 23                	push   $0x23
+  800e52:	68 04 3c 80 00       	push   $0x803c04
+  800e57:	e8 e3 f2 ff ff       	call   80013f <_panic>
+
+00800e5c <sys_ipc_recv>:
+{
+  800e5c:	55                   	push   %ebp
+  800e5d:	89 e5                	mov    %esp,%ebp
+  800e5f:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800e62:	6a 00                	push   $0x0
+  800e64:	6a 01                	push   $0x1
+  800e66:	ff 75 08             	push   0x8(%ebp)
+  800e69:	e8 ab ff ff ff       	call   800e19 <sys_ipc_recvv>
+}
+  800e6e:	c9                   	leave
+  800e6f:	c3                   	ret
+
+00800e70 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800e70:	55                   	push   %ebp
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	57                   	push   %edi
+  800e74:	56                   	push   %esi
+  800e75:	53                   	push   %ebx
+  800e76:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e84:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e89:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e8c:	89 de                	mov    %ebx,%esi
+  800e8e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e90:	85 c0                	test   %eax,%eax
+  800e92:	7f 08                	jg     800e9c <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800e94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e97:	5b                   	pop    %ebx
+  800e98:	5e                   	pop    %esi
+  800e99:	5f                   	pop    %edi
+  800e9a:	5d                   	pop    %ebp
+  800e9b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9c:	83 ec 0c             	sub    $0xc,%esp
+  800e9f:	50                   	push   %eax
+  800ea0:	6a 0d                	push   $0xd
+  800ea2:	68 e7 3b 80 00       	push   $0x803be7
+  800ea7:	6a 23                	push   $0x23
+  800ea9:	68 04 3c 80 00       	push   $0x803c04
+  800eae:	e8 8c f2 ff ff       	call   80013f <_panic>
+
+00800eb3 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800eb3:	55                   	push   %ebp
+  800eb4:	89 e5                	mov    %esp,%ebp
+  800eb6:	57                   	push   %edi
+  800eb7:	56                   	push   %esi
+  800eb8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebe:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ec3:	89 d1                	mov    %edx,%ecx
+  800ec5:	89 d3                	mov    %edx,%ebx
+  800ec7:	89 d7                	mov    %edx,%edi
+  800ec9:	55                   	push   %ebp
+  800eca:	89 e5                	mov    %esp,%ebp
+  800ecc:	8d 35 d4 0e 80 00    	lea    0x800ed4,%esi
+  800ed2:	0f 34                	sysenter
+  800ed4:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800ed5:	5b                   	pop    %ebx
+  800ed6:	5e                   	pop    %esi
+  800ed7:	5f                   	pop    %edi
+  800ed8:	5d                   	pop    %ebp
+  800ed9:	c3                   	ret
+
+00800eda <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800eda:	55                   	push   %ebp
+  800edb:	89 e5                	mov    %esp,%ebp
+  800edd:	57                   	push   %edi
+  800ede:	56                   	push   %esi
+  800edf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ee0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eeb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ef0:	89 df                	mov    %ebx,%edi
+  800ef2:	55                   	push   %ebp
+  800ef3:	89 e5                	mov    %esp,%ebp
+  800ef5:	8d 35 fd 0e 80 00    	lea    0x800efd,%esi
+  800efb:	0f 34                	sysenter
+  800efd:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800efe:	5b                   	pop    %ebx
+  800eff:	5e                   	pop    %esi
+  800f00:	5f                   	pop    %edi
+  800f01:	5d                   	pop    %ebp
+  800f02:	c3                   	ret
+
+00800f03 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800f03:	55                   	push   %ebp
+  800f04:	89 e5                	mov    %esp,%ebp
+  800f06:	57                   	push   %edi
+  800f07:	56                   	push   %esi
+  800f08:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f09:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f11:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f16:	89 cb                	mov    %ecx,%ebx
+  800f18:	89 cf                	mov    %ecx,%edi
+  800f1a:	55                   	push   %ebp
+  800f1b:	89 e5                	mov    %esp,%ebp
+  800f1d:	8d 35 25 0f 80 00    	lea    0x800f25,%esi
+  800f23:	0f 34                	sysenter
+  800f25:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800f26:	5b                   	pop    %ebx
+  800f27:	5e                   	pop    %esi
+  800f28:	5f                   	pop    %edi
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+
+00800f2b <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	57                   	push   %edi
+  800f2f:	56                   	push   %esi
+  800f30:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3c:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f41:	89 df                	mov    %ebx,%edi
+  800f43:	55                   	push   %ebp
+  800f44:	89 e5                	mov    %esp,%ebp
+  800f46:	8d 35 4e 0f 80 00    	lea    0x800f4e,%esi
+  800f4c:	0f 34                	sysenter
+  800f4e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800f4f:	5b                   	pop    %ebx
+  800f50:	5e                   	pop    %esi
+  800f51:	5f                   	pop    %edi
+  800f52:	5d                   	pop    %ebp
+  800f53:	c3                   	ret
+
+00800f54 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800f54:	55                   	push   %ebp
+  800f55:	89 e5                	mov    %esp,%ebp
+  800f57:	57                   	push   %edi
+  800f58:	56                   	push   %esi
+  800f59:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f65:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f6a:	89 df                	mov    %ebx,%edi
+  800f6c:	55                   	push   %ebp
+  800f6d:	89 e5                	mov    %esp,%ebp
+  800f6f:	8d 35 77 0f 80 00    	lea    0x800f77,%esi
+  800f75:	0f 34                	sysenter
+  800f77:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800f78:	5b                   	pop    %ebx
+  800f79:	5e                   	pop    %esi
+  800f7a:	5f                   	pop    %edi
+  800f7b:	5d                   	pop    %ebp
+  800f7c:	c3                   	ret
+
+00800f7d <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800f7d:	55                   	push   %ebp
+  800f7e:	89 e5                	mov    %esp,%ebp
+  800f80:	57                   	push   %edi
+  800f81:	56                   	push   %esi
+  800f82:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f89:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f91:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f94:	55                   	push   %ebp
+  800f95:	89 e5                	mov    %esp,%ebp
+  800f97:	8d 35 9f 0f 80 00    	lea    0x800f9f,%esi
+  800f9d:	0f 34                	sysenter
+  800f9f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800fa0:	5b                   	pop    %ebx
+  800fa1:	5e                   	pop    %esi
+  800fa2:	5f                   	pop    %edi
+  800fa3:	5d                   	pop    %ebp
+  800fa4:	c3                   	ret
+
+00800fa5 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800fa5:	55                   	push   %ebp
+  800fa6:	89 e5                	mov    %esp,%ebp
+  800fa8:	57                   	push   %edi
+  800fa9:	56                   	push   %esi
+  800faa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb3:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fb8:	89 cb                	mov    %ecx,%ebx
+  800fba:	89 cf                	mov    %ecx,%edi
+  800fbc:	89 ce                	mov    %ecx,%esi
+  800fbe:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800fc0:	5b                   	pop    %ebx
+  800fc1:	5e                   	pop    %esi
+  800fc2:	5f                   	pop    %edi
+  800fc3:	5d                   	pop    %ebp
+  800fc4:	c3                   	ret
+
+00800fc5 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800fc5:	55                   	push   %ebp
+  800fc6:	89 e5                	mov    %esp,%ebp
+  800fc8:	57                   	push   %edi
+  800fc9:	56                   	push   %esi
+  800fca:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fcb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd3:	b8 15 00 00 00       	mov    $0x15,%eax
+  800fd8:	89 cb                	mov    %ecx,%ebx
+  800fda:	89 cf                	mov    %ecx,%edi
+  800fdc:	55                   	push   %ebp
+  800fdd:	89 e5                	mov    %esp,%ebp
+  800fdf:	8d 35 e7 0f 80 00    	lea    0x800fe7,%esi
+  800fe5:	0f 34                	sysenter
+  800fe7:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800fe8:	5b                   	pop    %ebx
+  800fe9:	5e                   	pop    %esi
+  800fea:	5f                   	pop    %edi
+  800feb:	5d                   	pop    %ebp
+  800fec:	c3                   	ret
+
+00800fed <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800fed:	55                   	push   %ebp
+  800fee:	89 e5                	mov    %esp,%ebp
+  800ff0:	57                   	push   %edi
+  800ff1:	56                   	push   %esi
+  800ff2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ff3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ff8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffb:	b8 16 00 00 00       	mov    $0x16,%eax
+  801000:	89 cb                	mov    %ecx,%ebx
+  801002:	89 cf                	mov    %ecx,%edi
+  801004:	55                   	push   %ebp
+  801005:	89 e5                	mov    %esp,%ebp
+  801007:	8d 35 0f 10 80 00    	lea    0x80100f,%esi
+  80100d:	0f 34                	sysenter
+  80100f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  801010:	5b                   	pop    %ebx
+  801011:	5e                   	pop    %esi
+  801012:	5f                   	pop    %edi
+  801013:	5d                   	pop    %ebp
+  801014:	c3                   	ret
+
+00801015 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801015:	55                   	push   %ebp
+  801016:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801018:	8b 45 08             	mov    0x8(%ebp),%eax
+  80101b:	05 00 00 00 30       	add    $0x30000000,%eax
+  801020:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801023:	5d                   	pop    %ebp
+  801024:	c3                   	ret
+
+00801025 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801025:	55                   	push   %ebp
+  801026:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801028:	8b 45 08             	mov    0x8(%ebp),%eax
+  80102b:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801030:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801035:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+
+0080103c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80103c:	55                   	push   %ebp
+  80103d:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80103f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801044:	eb 02                	jmp    801048 <fd_alloc+0xc>
+  801046:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801048:	89 c2                	mov    %eax,%edx
+  80104a:	c1 ea 16             	shr    $0x16,%edx
+  80104d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801054:	f6 c2 01             	test   $0x1,%dl
+  801057:	74 2b                	je     801084 <fd_alloc+0x48>
+  801059:	89 c2                	mov    %eax,%edx
+  80105b:	c1 ea 0c             	shr    $0xc,%edx
+  80105e:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801065:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80106b:	f6 c1 01             	test   $0x1,%cl
+  80106e:	74 14                	je     801084 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801070:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801076:	75 ce                	jne    801046 <fd_alloc+0xa>
+  801078:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80107d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801082:	eb 05                	jmp    801089 <fd_alloc+0x4d>
+			return 0;
+  801084:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801089:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108c:	89 02                	mov    %eax,(%edx)
+}
+  80108e:	89 c8                	mov    %ecx,%eax
+  801090:	5d                   	pop    %ebp
+  801091:	c3                   	ret
+
+00801092 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801092:	55                   	push   %ebp
+  801093:	89 e5                	mov    %esp,%ebp
+  801095:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801098:	83 f8 1f             	cmp    $0x1f,%eax
+  80109b:	77 30                	ja     8010cd <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80109d:	c1 e0 0c             	shl    $0xc,%eax
+  8010a0:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8010a5:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8010ab:	f6 c2 01             	test   $0x1,%dl
+  8010ae:	74 24                	je     8010d4 <fd_lookup+0x42>
+  8010b0:	89 c2                	mov    %eax,%edx
+  8010b2:	c1 ea 0c             	shr    $0xc,%edx
+  8010b5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8010bc:	f6 c2 01             	test   $0x1,%dl
+  8010bf:	74 1a                	je     8010db <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8010c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010c4:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8010c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010cb:	5d                   	pop    %ebp
+  8010cc:	c3                   	ret
+		return -E_INVAL;
+  8010cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010d2:	eb f7                	jmp    8010cb <fd_lookup+0x39>
+		return -E_INVAL;
+  8010d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010d9:	eb f0                	jmp    8010cb <fd_lookup+0x39>
+  8010db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010e0:	eb e9                	jmp    8010cb <fd_lookup+0x39>
+
+008010e2 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	53                   	push   %ebx
+  8010e6:	83 ec 04             	sub    $0x4,%esp
+  8010e9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8010ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f1:	eb 03                	jmp    8010f6 <dev_lookup+0x14>
+  8010f3:	83 c0 01             	add    $0x1,%eax
+  8010f6:	8b 1c 85 90 3c 80 00 	mov    0x803c90(,%eax,4),%ebx
+  8010fd:	85 db                	test   %ebx,%ebx
+  8010ff:	74 0b                	je     80110c <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801101:	39 13                	cmp    %edx,(%ebx)
+  801103:	75 ee                	jne    8010f3 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801105:	b8 00 00 00 00       	mov    $0x0,%eax
+  80110a:	eb 1f                	jmp    80112b <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80110c:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  801111:	8b 40 48             	mov    0x48(%eax),%eax
+  801114:	83 ec 04             	sub    $0x4,%esp
+  801117:	52                   	push   %edx
+  801118:	50                   	push   %eax
+  801119:	68 14 3c 80 00       	push   $0x803c14
+  80111e:	e8 f7 f0 ff ff       	call   80021a <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801123:	83 c4 10             	add    $0x10,%esp
+  801126:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80112b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80112e:	89 1a                	mov    %ebx,(%edx)
+}
+  801130:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801133:	c9                   	leave
+  801134:	c3                   	ret
+
+00801135 <fd_close>:
+{
+  801135:	55                   	push   %ebp
+  801136:	89 e5                	mov    %esp,%ebp
+  801138:	57                   	push   %edi
+  801139:	56                   	push   %esi
+  80113a:	53                   	push   %ebx
+  80113b:	83 ec 24             	sub    $0x24,%esp
+  80113e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801141:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801144:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801147:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801148:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80114e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801151:	50                   	push   %eax
+  801152:	e8 3b ff ff ff       	call   801092 <fd_lookup>
+  801157:	89 c3                	mov    %eax,%ebx
+  801159:	83 c4 10             	add    $0x10,%esp
+  80115c:	85 c0                	test   %eax,%eax
+  80115e:	78 05                	js     801165 <fd_close+0x30>
+	    || fd != fd2)
+  801160:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801163:	74 16                	je     80117b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801165:	89 f8                	mov    %edi,%eax
+  801167:	84 c0                	test   %al,%al
+  801169:	b8 00 00 00 00       	mov    $0x0,%eax
+  80116e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801171:	89 d8                	mov    %ebx,%eax
+  801173:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801176:	5b                   	pop    %ebx
+  801177:	5e                   	pop    %esi
+  801178:	5f                   	pop    %edi
+  801179:	5d                   	pop    %ebp
+  80117a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80117b:	83 ec 08             	sub    $0x8,%esp
+  80117e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801181:	50                   	push   %eax
+  801182:	ff 36                	push   (%esi)
+  801184:	e8 59 ff ff ff       	call   8010e2 <dev_lookup>
+  801189:	89 c3                	mov    %eax,%ebx
+  80118b:	83 c4 10             	add    $0x10,%esp
+  80118e:	85 c0                	test   %eax,%eax
+  801190:	78 1a                	js     8011ac <fd_close+0x77>
+		if (dev->dev_close)
+  801192:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801195:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801198:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80119d:	85 c0                	test   %eax,%eax
+  80119f:	74 0b                	je     8011ac <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8011a1:	83 ec 0c             	sub    $0xc,%esp
+  8011a4:	56                   	push   %esi
+  8011a5:	ff d0                	call   *%eax
+  8011a7:	89 c3                	mov    %eax,%ebx
+  8011a9:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8011ac:	83 ec 08             	sub    $0x8,%esp
+  8011af:	56                   	push   %esi
+  8011b0:	6a 00                	push   $0x0
+  8011b2:	e8 ea fa ff ff       	call   800ca1 <sys_page_unmap>
+	return r;
+  8011b7:	83 c4 10             	add    $0x10,%esp
+  8011ba:	eb b5                	jmp    801171 <fd_close+0x3c>
+
+008011bc <close>:
+
+int
+close(int fdnum)
+{
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8011c2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011c5:	50                   	push   %eax
+  8011c6:	ff 75 08             	push   0x8(%ebp)
+  8011c9:	e8 c4 fe ff ff       	call   801092 <fd_lookup>
+  8011ce:	83 c4 10             	add    $0x10,%esp
+  8011d1:	85 c0                	test   %eax,%eax
+  8011d3:	79 02                	jns    8011d7 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8011d5:	c9                   	leave
+  8011d6:	c3                   	ret
+		return fd_close(fd, 1);
+  8011d7:	83 ec 08             	sub    $0x8,%esp
+  8011da:	6a 01                	push   $0x1
+  8011dc:	ff 75 f4             	push   -0xc(%ebp)
+  8011df:	e8 51 ff ff ff       	call   801135 <fd_close>
+  8011e4:	83 c4 10             	add    $0x10,%esp
+  8011e7:	eb ec                	jmp    8011d5 <close+0x19>
+
+008011e9 <close_all>:
+
+void
+close_all(void)
+{
+  8011e9:	55                   	push   %ebp
+  8011ea:	89 e5                	mov    %esp,%ebp
+  8011ec:	53                   	push   %ebx
+  8011ed:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8011f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8011f5:	83 ec 0c             	sub    $0xc,%esp
+  8011f8:	53                   	push   %ebx
+  8011f9:	e8 be ff ff ff       	call   8011bc <close>
+	for (i = 0; i < MAXFD; i++)
+  8011fe:	83 c3 01             	add    $0x1,%ebx
+  801201:	83 c4 10             	add    $0x10,%esp
+  801204:	83 fb 20             	cmp    $0x20,%ebx
+  801207:	75 ec                	jne    8011f5 <close_all+0xc>
+}
+  801209:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80120c:	c9                   	leave
+  80120d:	c3                   	ret
+
+0080120e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80120e:	55                   	push   %ebp
+  80120f:	89 e5                	mov    %esp,%ebp
+  801211:	57                   	push   %edi
+  801212:	56                   	push   %esi
+  801213:	53                   	push   %ebx
+  801214:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801217:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80121a:	50                   	push   %eax
+  80121b:	ff 75 08             	push   0x8(%ebp)
+  80121e:	e8 6f fe ff ff       	call   801092 <fd_lookup>
+  801223:	89 c3                	mov    %eax,%ebx
+  801225:	83 c4 10             	add    $0x10,%esp
+  801228:	85 c0                	test   %eax,%eax
+  80122a:	78 7f                	js     8012ab <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80122c:	83 ec 0c             	sub    $0xc,%esp
+  80122f:	ff 75 0c             	push   0xc(%ebp)
+  801232:	e8 85 ff ff ff       	call   8011bc <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801237:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80123a:	c1 e6 0c             	shl    $0xc,%esi
+  80123d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801243:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801246:	89 3c 24             	mov    %edi,(%esp)
+  801249:	e8 d7 fd ff ff       	call   801025 <fd2data>
+  80124e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801250:	89 34 24             	mov    %esi,(%esp)
+  801253:	e8 cd fd ff ff       	call   801025 <fd2data>
+  801258:	83 c4 10             	add    $0x10,%esp
+  80125b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80125e:	89 d8                	mov    %ebx,%eax
+  801260:	c1 e8 16             	shr    $0x16,%eax
+  801263:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80126a:	a8 01                	test   $0x1,%al
+  80126c:	74 11                	je     80127f <dup+0x71>
+  80126e:	89 d8                	mov    %ebx,%eax
+  801270:	c1 e8 0c             	shr    $0xc,%eax
+  801273:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80127a:	f6 c2 01             	test   $0x1,%dl
+  80127d:	75 36                	jne    8012b5 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80127f:	89 f8                	mov    %edi,%eax
+  801281:	c1 e8 0c             	shr    $0xc,%eax
+  801284:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80128b:	83 ec 0c             	sub    $0xc,%esp
+  80128e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801293:	50                   	push   %eax
+  801294:	56                   	push   %esi
+  801295:	6a 00                	push   $0x0
+  801297:	57                   	push   %edi
+  801298:	6a 00                	push   $0x0
+  80129a:	e8 c0 f9 ff ff       	call   800c5f <sys_page_map>
+  80129f:	89 c3                	mov    %eax,%ebx
+  8012a1:	83 c4 20             	add    $0x20,%esp
+  8012a4:	85 c0                	test   %eax,%eax
+  8012a6:	78 33                	js     8012db <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8012a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8012ab:	89 d8                	mov    %ebx,%eax
+  8012ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b0:	5b                   	pop    %ebx
+  8012b1:	5e                   	pop    %esi
+  8012b2:	5f                   	pop    %edi
+  8012b3:	5d                   	pop    %ebp
+  8012b4:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8012b5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012bc:	83 ec 0c             	sub    $0xc,%esp
+  8012bf:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012c4:	50                   	push   %eax
+  8012c5:	ff 75 d4             	push   -0x2c(%ebp)
+  8012c8:	6a 00                	push   $0x0
+  8012ca:	53                   	push   %ebx
+  8012cb:	6a 00                	push   $0x0
+  8012cd:	e8 8d f9 ff ff       	call   800c5f <sys_page_map>
+  8012d2:	89 c3                	mov    %eax,%ebx
+  8012d4:	83 c4 20             	add    $0x20,%esp
+  8012d7:	85 c0                	test   %eax,%eax
+  8012d9:	79 a4                	jns    80127f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8012db:	83 ec 08             	sub    $0x8,%esp
+  8012de:	56                   	push   %esi
+  8012df:	6a 00                	push   $0x0
+  8012e1:	e8 bb f9 ff ff       	call   800ca1 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8012e6:	83 c4 08             	add    $0x8,%esp
+  8012e9:	ff 75 d4             	push   -0x2c(%ebp)
+  8012ec:	6a 00                	push   $0x0
+  8012ee:	e8 ae f9 ff ff       	call   800ca1 <sys_page_unmap>
+	return r;
+  8012f3:	83 c4 10             	add    $0x10,%esp
+  8012f6:	eb b3                	jmp    8012ab <dup+0x9d>
+
+008012f8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	56                   	push   %esi
+  8012fc:	53                   	push   %ebx
+  8012fd:	83 ec 18             	sub    $0x18,%esp
+  801300:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801303:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801306:	50                   	push   %eax
+  801307:	56                   	push   %esi
+  801308:	e8 85 fd ff ff       	call   801092 <fd_lookup>
+  80130d:	83 c4 10             	add    $0x10,%esp
+  801310:	85 c0                	test   %eax,%eax
+  801312:	78 3c                	js     801350 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801314:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801317:	83 ec 08             	sub    $0x8,%esp
+  80131a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80131d:	50                   	push   %eax
+  80131e:	ff 33                	push   (%ebx)
+  801320:	e8 bd fd ff ff       	call   8010e2 <dev_lookup>
+  801325:	83 c4 10             	add    $0x10,%esp
+  801328:	85 c0                	test   %eax,%eax
+  80132a:	78 24                	js     801350 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80132c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80132f:	83 e0 03             	and    $0x3,%eax
+  801332:	83 f8 01             	cmp    $0x1,%eax
+  801335:	74 20                	je     801357 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801337:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80133a:	8b 40 08             	mov    0x8(%eax),%eax
+  80133d:	85 c0                	test   %eax,%eax
+  80133f:	74 37                	je     801378 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801341:	83 ec 04             	sub    $0x4,%esp
+  801344:	ff 75 10             	push   0x10(%ebp)
+  801347:	ff 75 0c             	push   0xc(%ebp)
+  80134a:	53                   	push   %ebx
+  80134b:	ff d0                	call   *%eax
+  80134d:	83 c4 10             	add    $0x10,%esp
+}
+  801350:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801353:	5b                   	pop    %ebx
+  801354:	5e                   	pop    %esi
+  801355:	5d                   	pop    %ebp
+  801356:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801357:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  80135c:	8b 40 48             	mov    0x48(%eax),%eax
+  80135f:	83 ec 04             	sub    $0x4,%esp
+  801362:	56                   	push   %esi
+  801363:	50                   	push   %eax
+  801364:	68 55 3c 80 00       	push   $0x803c55
+  801369:	e8 ac ee ff ff       	call   80021a <cprintf>
+		return -E_INVAL;
+  80136e:	83 c4 10             	add    $0x10,%esp
+  801371:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801376:	eb d8                	jmp    801350 <read+0x58>
+		return -E_NOT_SUPP;
+  801378:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80137d:	eb d1                	jmp    801350 <read+0x58>
+
+0080137f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80137f:	55                   	push   %ebp
+  801380:	89 e5                	mov    %esp,%ebp
+  801382:	57                   	push   %edi
+  801383:	56                   	push   %esi
+  801384:	53                   	push   %ebx
+  801385:	83 ec 0c             	sub    $0xc,%esp
+  801388:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80138b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80138e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801393:	eb 02                	jmp    801397 <readn+0x18>
+  801395:	01 c3                	add    %eax,%ebx
+  801397:	39 f3                	cmp    %esi,%ebx
+  801399:	73 21                	jae    8013bc <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80139b:	83 ec 04             	sub    $0x4,%esp
+  80139e:	89 f0                	mov    %esi,%eax
+  8013a0:	29 d8                	sub    %ebx,%eax
+  8013a2:	50                   	push   %eax
+  8013a3:	89 d8                	mov    %ebx,%eax
+  8013a5:	03 45 0c             	add    0xc(%ebp),%eax
+  8013a8:	50                   	push   %eax
+  8013a9:	57                   	push   %edi
+  8013aa:	e8 49 ff ff ff       	call   8012f8 <read>
+		if (m < 0)
+  8013af:	83 c4 10             	add    $0x10,%esp
+  8013b2:	85 c0                	test   %eax,%eax
+  8013b4:	78 04                	js     8013ba <readn+0x3b>
+			return m;
+		if (m == 0)
+  8013b6:	75 dd                	jne    801395 <readn+0x16>
+  8013b8:	eb 02                	jmp    8013bc <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8013ba:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8013bc:	89 d8                	mov    %ebx,%eax
+  8013be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c1:	5b                   	pop    %ebx
+  8013c2:	5e                   	pop    %esi
+  8013c3:	5f                   	pop    %edi
+  8013c4:	5d                   	pop    %ebp
+  8013c5:	c3                   	ret
+
+008013c6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8013c6:	55                   	push   %ebp
+  8013c7:	89 e5                	mov    %esp,%ebp
+  8013c9:	56                   	push   %esi
+  8013ca:	53                   	push   %ebx
+  8013cb:	83 ec 18             	sub    $0x18,%esp
+  8013ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013d1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013d4:	50                   	push   %eax
+  8013d5:	53                   	push   %ebx
+  8013d6:	e8 b7 fc ff ff       	call   801092 <fd_lookup>
+  8013db:	83 c4 10             	add    $0x10,%esp
+  8013de:	85 c0                	test   %eax,%eax
+  8013e0:	78 37                	js     801419 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013e2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013e5:	83 ec 08             	sub    $0x8,%esp
+  8013e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013eb:	50                   	push   %eax
+  8013ec:	ff 36                	push   (%esi)
+  8013ee:	e8 ef fc ff ff       	call   8010e2 <dev_lookup>
+  8013f3:	83 c4 10             	add    $0x10,%esp
+  8013f6:	85 c0                	test   %eax,%eax
+  8013f8:	78 1f                	js     801419 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8013fa:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8013fe:	74 20                	je     801420 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801400:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801403:	8b 40 0c             	mov    0xc(%eax),%eax
+  801406:	85 c0                	test   %eax,%eax
+  801408:	74 37                	je     801441 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80140a:	83 ec 04             	sub    $0x4,%esp
+  80140d:	ff 75 10             	push   0x10(%ebp)
+  801410:	ff 75 0c             	push   0xc(%ebp)
+  801413:	56                   	push   %esi
+  801414:	ff d0                	call   *%eax
+  801416:	83 c4 10             	add    $0x10,%esp
+}
+  801419:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80141c:	5b                   	pop    %ebx
+  80141d:	5e                   	pop    %esi
+  80141e:	5d                   	pop    %ebp
+  80141f:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801420:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  801425:	8b 40 48             	mov    0x48(%eax),%eax
+  801428:	83 ec 04             	sub    $0x4,%esp
+  80142b:	53                   	push   %ebx
+  80142c:	50                   	push   %eax
+  80142d:	68 71 3c 80 00       	push   $0x803c71
+  801432:	e8 e3 ed ff ff       	call   80021a <cprintf>
+		return -E_INVAL;
+  801437:	83 c4 10             	add    $0x10,%esp
+  80143a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80143f:	eb d8                	jmp    801419 <write+0x53>
+		return -E_NOT_SUPP;
+  801441:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801446:	eb d1                	jmp    801419 <write+0x53>
+
+00801448 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801448:	55                   	push   %ebp
+  801449:	89 e5                	mov    %esp,%ebp
+  80144b:	53                   	push   %ebx
+  80144c:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80144f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801452:	50                   	push   %eax
+  801453:	ff 75 08             	push   0x8(%ebp)
+  801456:	e8 37 fc ff ff       	call   801092 <fd_lookup>
+  80145b:	83 c4 10             	add    $0x10,%esp
+  80145e:	85 c0                	test   %eax,%eax
+  801460:	78 3a                	js     80149c <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801462:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801465:	83 ec 08             	sub    $0x8,%esp
+  801468:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80146b:	50                   	push   %eax
+  80146c:	ff 33                	push   (%ebx)
+  80146e:	e8 6f fc ff ff       	call   8010e2 <dev_lookup>
+  801473:	83 c4 10             	add    $0x10,%esp
+  801476:	85 c0                	test   %eax,%eax
+  801478:	78 22                	js     80149c <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  80147a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80147d:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801480:	85 c0                	test   %eax,%eax
+  801482:	74 0d                	je     801491 <seek+0x49>
+  801484:	83 ec 0c             	sub    $0xc,%esp
+  801487:	53                   	push   %ebx
+  801488:	ff d0                	call   *%eax
+  80148a:	83 c4 10             	add    $0x10,%esp
+  80148d:	85 c0                	test   %eax,%eax
+  80148f:	78 0b                	js     80149c <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801491:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801494:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801497:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80149c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80149f:	c9                   	leave
+  8014a0:	c3                   	ret
+
+008014a1 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8014a1:	55                   	push   %ebp
+  8014a2:	89 e5                	mov    %esp,%ebp
+  8014a4:	53                   	push   %ebx
+  8014a5:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014a8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014ab:	50                   	push   %eax
+  8014ac:	ff 75 08             	push   0x8(%ebp)
+  8014af:	e8 de fb ff ff       	call   801092 <fd_lookup>
+  8014b4:	83 c4 10             	add    $0x10,%esp
+  8014b7:	85 c0                	test   %eax,%eax
+  8014b9:	78 2b                	js     8014e6 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014bb:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014be:	83 ec 08             	sub    $0x8,%esp
+  8014c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c4:	50                   	push   %eax
+  8014c5:	ff 33                	push   (%ebx)
+  8014c7:	e8 16 fc ff ff       	call   8010e2 <dev_lookup>
+  8014cc:	83 c4 10             	add    $0x10,%esp
+  8014cf:	85 c0                	test   %eax,%eax
+  8014d1:	78 13                	js     8014e6 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8014d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014d6:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8014d9:	85 c0                	test   %eax,%eax
+  8014db:	74 0e                	je     8014eb <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8014dd:	83 ec 0c             	sub    $0xc,%esp
+  8014e0:	53                   	push   %ebx
+  8014e1:	ff d0                	call   *%eax
+  8014e3:	83 c4 10             	add    $0x10,%esp
+}
+  8014e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014e9:	c9                   	leave
+  8014ea:	c3                   	ret
+		return 0;
+  8014eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f0:	eb f4                	jmp    8014e6 <fsync+0x45>
+
+008014f2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8014f2:	55                   	push   %ebp
+  8014f3:	89 e5                	mov    %esp,%ebp
+  8014f5:	56                   	push   %esi
+  8014f6:	53                   	push   %ebx
+  8014f7:	83 ec 18             	sub    $0x18,%esp
+  8014fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014fd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801500:	50                   	push   %eax
+  801501:	53                   	push   %ebx
+  801502:	e8 8b fb ff ff       	call   801092 <fd_lookup>
+  801507:	83 c4 10             	add    $0x10,%esp
+  80150a:	85 c0                	test   %eax,%eax
+  80150c:	78 34                	js     801542 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80150e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801511:	83 ec 08             	sub    $0x8,%esp
+  801514:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801517:	50                   	push   %eax
+  801518:	ff 36                	push   (%esi)
+  80151a:	e8 c3 fb ff ff       	call   8010e2 <dev_lookup>
+  80151f:	83 c4 10             	add    $0x10,%esp
+  801522:	85 c0                	test   %eax,%eax
+  801524:	78 1c                	js     801542 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801526:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80152a:	74 1d                	je     801549 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80152c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80152f:	8b 40 18             	mov    0x18(%eax),%eax
+  801532:	85 c0                	test   %eax,%eax
+  801534:	74 34                	je     80156a <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801536:	83 ec 08             	sub    $0x8,%esp
+  801539:	ff 75 0c             	push   0xc(%ebp)
+  80153c:	56                   	push   %esi
+  80153d:	ff d0                	call   *%eax
+  80153f:	83 c4 10             	add    $0x10,%esp
+}
+  801542:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801545:	5b                   	pop    %ebx
+  801546:	5e                   	pop    %esi
+  801547:	5d                   	pop    %ebp
+  801548:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801549:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  80154e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801551:	83 ec 04             	sub    $0x4,%esp
+  801554:	53                   	push   %ebx
+  801555:	50                   	push   %eax
+  801556:	68 34 3c 80 00       	push   $0x803c34
+  80155b:	e8 ba ec ff ff       	call   80021a <cprintf>
+		return -E_INVAL;
+  801560:	83 c4 10             	add    $0x10,%esp
+  801563:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801568:	eb d8                	jmp    801542 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80156a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80156f:	eb d1                	jmp    801542 <ftruncate+0x50>
+
+00801571 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801571:	55                   	push   %ebp
+  801572:	89 e5                	mov    %esp,%ebp
+  801574:	56                   	push   %esi
+  801575:	53                   	push   %ebx
+  801576:	83 ec 18             	sub    $0x18,%esp
+  801579:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80157c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80157f:	50                   	push   %eax
+  801580:	ff 75 08             	push   0x8(%ebp)
+  801583:	e8 0a fb ff ff       	call   801092 <fd_lookup>
+  801588:	83 c4 10             	add    $0x10,%esp
+  80158b:	85 c0                	test   %eax,%eax
+  80158d:	78 49                	js     8015d8 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80158f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801592:	83 ec 08             	sub    $0x8,%esp
+  801595:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801598:	50                   	push   %eax
+  801599:	ff 36                	push   (%esi)
+  80159b:	e8 42 fb ff ff       	call   8010e2 <dev_lookup>
+  8015a0:	83 c4 10             	add    $0x10,%esp
+  8015a3:	85 c0                	test   %eax,%eax
+  8015a5:	78 31                	js     8015d8 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8015a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015aa:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8015ae:	74 2f                	je     8015df <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8015b0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8015b3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8015ba:	00 00 00 
+	stat->st_isdir = 0;
+  8015bd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8015c4:	00 00 00 
+	stat->st_dev = dev;
+  8015c7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8015cd:	83 ec 08             	sub    $0x8,%esp
+  8015d0:	53                   	push   %ebx
+  8015d1:	56                   	push   %esi
+  8015d2:	ff 50 14             	call   *0x14(%eax)
+  8015d5:	83 c4 10             	add    $0x10,%esp
+}
+  8015d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015db:	5b                   	pop    %ebx
+  8015dc:	5e                   	pop    %esi
+  8015dd:	5d                   	pop    %ebp
+  8015de:	c3                   	ret
+		return -E_NOT_SUPP;
+  8015df:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015e4:	eb f2                	jmp    8015d8 <fstat+0x67>
+
+008015e6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8015e6:	55                   	push   %ebp
+  8015e7:	89 e5                	mov    %esp,%ebp
+  8015e9:	56                   	push   %esi
+  8015ea:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  8015eb:	83 ec 08             	sub    $0x8,%esp
+  8015ee:	68 00 10 00 00       	push   $0x1000
+  8015f3:	ff 75 08             	push   0x8(%ebp)
+  8015f6:	e8 b3 07 00 00       	call   801dae <open>
+  8015fb:	89 c3                	mov    %eax,%ebx
+  8015fd:	83 c4 10             	add    $0x10,%esp
+  801600:	85 c0                	test   %eax,%eax
+  801602:	78 1b                	js     80161f <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801604:	83 ec 08             	sub    $0x8,%esp
+  801607:	ff 75 0c             	push   0xc(%ebp)
+  80160a:	50                   	push   %eax
+  80160b:	e8 61 ff ff ff       	call   801571 <fstat>
+  801610:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801612:	89 1c 24             	mov    %ebx,(%esp)
+  801615:	e8 a2 fb ff ff       	call   8011bc <close>
+	return r;
+  80161a:	83 c4 10             	add    $0x10,%esp
+  80161d:	89 f3                	mov    %esi,%ebx
+}
+  80161f:	89 d8                	mov    %ebx,%eax
+  801621:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801624:	5b                   	pop    %ebx
+  801625:	5e                   	pop    %esi
+  801626:	5d                   	pop    %ebp
+  801627:	c3                   	ret
+
+00801628 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801628:	55                   	push   %ebp
+  801629:	89 e5                	mov    %esp,%ebp
+  80162b:	57                   	push   %edi
+  80162c:	56                   	push   %esi
+  80162d:	53                   	push   %ebx
+  80162e:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801634:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  80163a:	89 d6                	mov    %edx,%esi
+  80163c:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801642:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801645:	89 d3                	mov    %edx,%ebx
+  801647:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  80164d:	83 3d c8 70 c0 00 00 	cmpl   $0x0,0xc070c8
+  801654:	74 1d                	je     801673 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801656:	b8 00 60 c0 00       	mov    $0xc06000,%eax
+  80165b:	83 c8 07             	or     $0x7,%eax
+  80165e:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801664:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801669:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  80166f:	01 ce                	add    %ecx,%esi
+  801671:	eb 28                	jmp    80169b <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801673:	83 ec 0c             	sub    $0xc,%esp
+  801676:	6a 01                	push   $0x1
+  801678:	e8 0c 1e 00 00       	call   803489 <ipc_find_env>
+  80167d:	a3 c8 70 c0 00       	mov    %eax,0xc070c8
+  801682:	83 c4 10             	add    $0x10,%esp
+  801685:	eb cf                	jmp    801656 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801687:	83 c0 01             	add    $0x1,%eax
+  80168a:	89 fa                	mov    %edi,%edx
+  80168c:	09 da                	or     %ebx,%edx
+  80168e:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801695:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80169b:	39 f3                	cmp    %esi,%ebx
+  80169d:	72 e8                	jb     801687 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  80169f:	83 f8 41             	cmp    $0x41,%eax
+  8016a2:	77 2f                	ja     8016d3 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  8016a4:	50                   	push   %eax
+  8016a5:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  8016ab:	50                   	push   %eax
+  8016ac:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  8016b2:	ff 35 c8 70 c0 00    	push   0xc070c8
+  8016b8:	e8 7e 1d 00 00       	call   80343b <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  8016bd:	83 c4 0c             	add    $0xc,%esp
+  8016c0:	6a 00                	push   $0x0
+  8016c2:	6a 00                	push   $0x0
+  8016c4:	6a 00                	push   $0x0
+  8016c6:	e8 1a 1c 00 00       	call   8032e5 <ipc_recv>
+}
+  8016cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ce:	5b                   	pop    %ebx
+  8016cf:	5e                   	pop    %esi
+  8016d0:	5f                   	pop    %edi
+  8016d1:	5d                   	pop    %ebp
+  8016d2:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  8016d3:	68 a4 3c 80 00       	push   $0x803ca4
+  8016d8:	68 c0 3c 80 00       	push   $0x803cc0
+  8016dd:	6a 40                	push   $0x40
+  8016df:	68 d5 3c 80 00       	push   $0x803cd5
+  8016e4:	e8 56 ea ff ff       	call   80013f <_panic>
+
+008016e9 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  8016e9:	55                   	push   %ebp
+  8016ea:	89 e5                	mov    %esp,%ebp
+  8016ec:	57                   	push   %edi
+  8016ed:	56                   	push   %esi
+  8016ee:	53                   	push   %ebx
+  8016ef:	83 ec 1c             	sub    $0x1c,%esp
+  8016f2:	89 c3                	mov    %eax,%ebx
+  8016f4:	89 d6                	mov    %edx,%esi
+  8016f6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  8016f9:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  8016ff:	89 ca                	mov    %ecx,%edx
+  801701:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801704:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  80170b:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80170e:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801715:	8b 76 0c             	mov    0xc(%esi),%esi
+  801718:	89 fb                	mov    %edi,%ebx
+  80171a:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801721:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801724:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  80172b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80172e:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801735:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801738:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  80173f:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801742:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801749:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  80174e:	39 c8                	cmp    %ecx,%eax
+  801750:	74 0d                	je     80175f <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801752:	b8 00 00 00 00       	mov    $0x0,%eax
+  801757:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80175a:	5b                   	pop    %ebx
+  80175b:	5e                   	pop    %esi
+  80175c:	5f                   	pop    %edi
+  80175d:	5d                   	pop    %ebp
+  80175e:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80175f:	6a 07                	push   $0x7
+  801761:	68 00 60 c0 00       	push   $0xc06000
+  801766:	6a 0d                	push   $0xd
+  801768:	ff 35 c8 70 c0 00    	push   0xc070c8
+  80176e:	e8 dd 1b 00 00       	call   803350 <ipc_send>
+  801773:	83 c4 10             	add    $0x10,%esp
+  801776:	eb da                	jmp    801752 <fsring_post+0x69>
+
+00801778 <fsipcv>:
+{
+  801778:	55                   	push   %ebp
+  801779:	89 e5                	mov    %esp,%ebp
+  80177b:	57                   	push   %edi
+  80177c:	56                   	push   %esi
+  80177d:	53                   	push   %ebx
+  80177e:	83 ec 0c             	sub    $0xc,%esp
+  801781:	89 c7                	mov    %eax,%edi
+  801783:	89 d3                	mov    %edx,%ebx
+  801785:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801787:	83 3d c8 70 c0 00 00 	cmpl   $0x0,0xc070c8
+  80178e:	74 26                	je     8017b6 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801790:	6a 07                	push   $0x7
+  801792:	68 00 60 c0 00       	push   $0xc06000
+  801797:	57                   	push   %edi
+  801798:	ff 35 c8 70 c0 00    	push   0xc070c8
+  80179e:	e8 ad 1b 00 00       	call   803350 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  8017a3:	6a 00                	push   $0x0
+  8017a5:	56                   	push   %esi
+  8017a6:	53                   	push   %ebx
+  8017a7:	6a 00                	push   $0x0
+  8017a9:	e8 fa 1b 00 00       	call   8033a8 <ipc_recvv>
+}
+  8017ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017b1:	5b                   	pop    %ebx
+  8017b2:	5e                   	pop    %esi
+  8017b3:	5f                   	pop    %edi
+  8017b4:	5d                   	pop    %ebp
+  8017b5:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017b6:	83 ec 0c             	sub    $0xc,%esp
+  8017b9:	6a 01                	push   $0x1
+  8017bb:	e8 c9 1c 00 00       	call   803489 <ipc_find_env>
+  8017c0:	a3 c8 70 c0 00       	mov    %eax,0xc070c8
+  8017c5:	83 c4 10             	add    $0x10,%esp
+  8017c8:	eb c6                	jmp    801790 <fsipcv+0x18>
+
+008017ca <fsipc>:
+{
+  8017ca:	55                   	push   %ebp
+  8017cb:	89 e5                	mov    %esp,%ebp
+  8017cd:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  8017d0:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  8017d7:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8017da:	e8 99 ff ff ff       	call   801778 <fsipcv>
+}
+  8017df:	c9                   	leave
+  8017e0:	c3                   	ret
+
+008017e1 <file_write_direct>:
+{
+  8017e1:	55                   	push   %ebp
+  8017e2:	89 e5                	mov    %esp,%ebp
+  8017e4:	56                   	push   %esi
+  8017e5:	53                   	push   %ebx
+  8017e6:	89 c3                	mov    %eax,%ebx
+  8017e8:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8017ea:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  8017f0:	77 40                	ja     801832 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8017f2:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  8017f7:	39 c8                	cmp    %ecx,%eax
+  8017f9:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8017fc:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  8017ff:	89 0d 00 60 c0 00    	mov    %ecx,0xc06000
+	fsipcbuf.write.req_n = n;
+  801805:	a3 04 60 c0 00       	mov    %eax,0xc06004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  80180a:	83 ec 04             	sub    $0x4,%esp
+  80180d:	50                   	push   %eax
+  80180e:	52                   	push   %edx
+  80180f:	68 08 60 c0 00       	push   $0xc06008
+  801814:	e8 75 f1 ff ff       	call   80098e <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801819:	ba 00 00 00 00       	mov    $0x0,%edx
+  80181e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801823:	e8 a2 ff ff ff       	call   8017ca <fsipc>
+  801828:	83 c4 10             	add    $0x10,%esp
+}
+  80182b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80182e:	5b                   	pop    %ebx
+  80182f:	5e                   	pop    %esi
+  801830:	5d                   	pop    %ebp
+  801831:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801832:	89 d6                	mov    %edx,%esi
+  801834:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80183a:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80183f:	29 f1                	sub    %esi,%ecx
+  801841:	39 c1                	cmp    %eax,%ecx
+  801843:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801846:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801849:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	fsipcbuf.bulk.req_n = n;
+  80184e:	89 0d 04 60 c0 00    	mov    %ecx,0xc06004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801854:	89 35 08 60 c0 00    	mov    %esi,0xc06008
+	return fsipc_pages(type, buf, n, perm);
+  80185a:	83 ec 0c             	sub    $0xc,%esp
+  80185d:	6a 05                	push   $0x5
+  80185f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801864:	e8 bf fd ff ff       	call   801628 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801869:	83 c4 10             	add    $0x10,%esp
+  80186c:	eb bd                	jmp    80182b <file_write_direct+0x4a>
+
+0080186e <devfile_sync>:
+{
+  80186e:	55                   	push   %ebp
+  80186f:	89 e5                	mov    %esp,%ebp
+  801871:	57                   	push   %edi
+  801872:	56                   	push   %esi
+  801873:	53                   	push   %ebx
+  801874:	83 ec 28             	sub    $0x28,%esp
+  801877:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  80187a:	56                   	push   %esi
+  80187b:	e8 a5 f7 ff ff       	call   801025 <fd2data>
+  801880:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801882:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801885:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  80188c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80188f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801894:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801898:	74 45                	je     8018df <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  80189a:	8b 46 14             	mov    0x14(%esi),%eax
+  80189d:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8018a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018aa:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8018ad:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  8018b0:	39 cb                	cmp    %ecx,%ebx
+  8018b2:	73 14                	jae    8018c8 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  8018b4:	29 d9                	sub    %ebx,%ecx
+  8018b6:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8018b9:	89 f0                	mov    %esi,%eax
+  8018bb:	e8 21 ff ff ff       	call   8017e1 <file_write_direct>
+  8018c0:	85 c0                	test   %eax,%eax
+  8018c2:	7e 04                	jle    8018c8 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8018c4:	01 c3                	add    %eax,%ebx
+  8018c6:	eb e5                	jmp    8018ad <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  8018c8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8018cb:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  8018d2:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  8018d5:	85 c0                	test   %eax,%eax
+  8018d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018dc:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8018df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e2:	5b                   	pop    %ebx
+  8018e3:	5e                   	pop    %esi
+  8018e4:	5f                   	pop    %edi
+  8018e5:	5d                   	pop    %ebp
+  8018e6:	c3                   	ret
+
+008018e7 <devfile_write>:
+{
+  8018e7:	55                   	push   %ebp
+  8018e8:	89 e5                	mov    %esp,%ebp
+  8018ea:	57                   	push   %edi
+  8018eb:	56                   	push   %esi
+  8018ec:	53                   	push   %ebx
+  8018ed:	83 ec 28             	sub    $0x28,%esp
+  8018f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8018f3:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8018f6:	53                   	push   %ebx
+  8018f7:	e8 29 f7 ff ff       	call   801025 <fd2data>
+  8018fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8018ff:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801902:	83 c4 10             	add    $0x10,%esp
+  801905:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801909:	74 43                	je     80194e <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  80190b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801912:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801915:	85 c0                	test   %eax,%eax
+  801917:	74 43                	je     80195c <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801919:	89 c2                	mov    %eax,%edx
+  80191b:	03 53 14             	add    0x14(%ebx),%edx
+  80191e:	39 fa                	cmp    %edi,%edx
+  801920:	75 0b                	jne    80192d <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801922:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801925:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  80192b:	76 66                	jbe    801993 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  80192d:	83 ec 0c             	sub    $0xc,%esp
+  801930:	53                   	push   %ebx
+  801931:	e8 38 ff ff ff       	call   80186e <devfile_sync>
+  801936:	83 c4 10             	add    $0x10,%esp
+  801939:	85 c0                	test   %eax,%eax
+  80193b:	78 4e                	js     80198b <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  80193d:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801943:	77 56                	ja     80199b <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801945:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801948:	85 c0                	test   %eax,%eax
+  80194a:	75 20                	jne    80196c <devfile_write+0x85>
+  80194c:	eb 16                	jmp    801964 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  80194e:	89 f1                	mov    %esi,%ecx
+  801950:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801953:	89 d8                	mov    %ebx,%eax
+  801955:	e8 87 fe ff ff       	call   8017e1 <file_write_direct>
+  80195a:	eb 2f                	jmp    80198b <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  80195c:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801962:	77 37                	ja     80199b <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801964:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801967:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  80196c:	83 ec 04             	sub    $0x4,%esp
+  80196f:	56                   	push   %esi
+  801970:	ff 75 0c             	push   0xc(%ebp)
+  801973:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801976:	01 c1                	add    %eax,%ecx
+  801978:	51                   	push   %ecx
+  801979:	e8 10 f0 ff ff       	call   80098e <memmove>
+	ff->buf_wlen += n;
+  80197e:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801981:	01 f7                	add    %esi,%edi
+  801983:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801986:	89 f0                	mov    %esi,%eax
+  801988:	83 c4 10             	add    $0x10,%esp
+}
+  80198b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80198e:	5b                   	pop    %ebx
+  80198f:	5e                   	pop    %esi
+  801990:	5f                   	pop    %edi
+  801991:	5d                   	pop    %ebp
+  801992:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801993:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801999:	76 d1                	jbe    80196c <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  80199b:	89 f1                	mov    %esi,%ecx
+  80199d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019a0:	89 d8                	mov    %ebx,%eax
+  8019a2:	e8 3a fe ff ff       	call   8017e1 <file_write_direct>
+  8019a7:	eb e2                	jmp    80198b <devfile_write+0xa4>
+
+008019a9 <devfile_trunc>:
+{
+  8019a9:	55                   	push   %ebp
+  8019aa:	89 e5                	mov    %esp,%ebp
+  8019ac:	53                   	push   %ebx
+  8019ad:	83 ec 10             	sub    $0x10,%esp
+  8019b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  8019b3:	53                   	push   %ebx
+  8019b4:	e8 b5 fe ff ff       	call   80186e <devfile_sync>
+  8019b9:	83 c4 10             	add    $0x10,%esp
+  8019bc:	85 c0                	test   %eax,%eax
+  8019be:	78 1f                	js     8019df <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019c0:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8019c3:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	fsipcbuf.set_size.req_size = newsize;
+  8019c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019cb:	a3 04 60 c0 00       	mov    %eax,0xc06004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8019d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019d5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019da:	e8 eb fd ff ff       	call   8017ca <fsipc>
+}
+  8019df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019e2:	c9                   	leave
+  8019e3:	c3                   	ret
+
+008019e4 <devfile_stat>:
+{
+  8019e4:	55                   	push   %ebp
+  8019e5:	89 e5                	mov    %esp,%ebp
+  8019e7:	56                   	push   %esi
+  8019e8:	53                   	push   %ebx
+  8019e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8019ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  8019ef:	83 ec 0c             	sub    $0xc,%esp
+  8019f2:	53                   	push   %ebx
+  8019f3:	e8 76 fe ff ff       	call   80186e <devfile_sync>
+  8019f8:	83 c4 10             	add    $0x10,%esp
+  8019fb:	85 c0                	test   %eax,%eax
+  8019fd:	78 47                	js     801a46 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8019ff:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a02:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a07:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a0c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a11:	e8 b4 fd ff ff       	call   8017ca <fsipc>
+  801a16:	85 c0                	test   %eax,%eax
+  801a18:	78 2c                	js     801a46 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a1a:	83 ec 08             	sub    $0x8,%esp
+  801a1d:	68 00 60 c0 00       	push   $0xc06000
+  801a22:	56                   	push   %esi
+  801a23:	e8 e0 ed ff ff       	call   800808 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a28:	a1 80 60 c0 00       	mov    0xc06080,%eax
+  801a2d:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a33:	a1 84 60 c0 00       	mov    0xc06084,%eax
+  801a38:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801a3e:	83 c4 10             	add    $0x10,%esp
+  801a41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a46:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a49:	5b                   	pop    %ebx
+  801a4a:	5e                   	pop    %esi
+  801a4b:	5d                   	pop    %ebp
+  801a4c:	c3                   	ret
+
+00801a4d <devfile_flush>:
+{
+  801a4d:	55                   	push   %ebp
+  801a4e:	89 e5                	mov    %esp,%ebp
+  801a50:	56                   	push   %esi
+  801a51:	53                   	push   %ebx
+  801a52:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801a55:	83 ec 0c             	sub    $0xc,%esp
+  801a58:	56                   	push   %esi
+  801a59:	e8 10 fe ff ff       	call   80186e <devfile_sync>
+  801a5e:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801a60:	83 c4 10             	add    $0x10,%esp
+  801a63:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801a67:	75 25                	jne    801a8e <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a69:	8b 46 0c             	mov    0xc(%esi),%eax
+  801a6c:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801a71:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a76:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a7b:	e8 4a fd ff ff       	call   8017ca <fsipc>
+  801a80:	85 c0                	test   %eax,%eax
+  801a82:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801a85:	89 d8                	mov    %ebx,%eax
+  801a87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a8a:	5b                   	pop    %ebx
+  801a8b:	5e                   	pop    %esi
+  801a8c:	5d                   	pop    %ebp
+  801a8d:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801a8e:	83 ec 0c             	sub    $0xc,%esp
+  801a91:	56                   	push   %esi
+  801a92:	e8 8e f5 ff ff       	call   801025 <fd2data>
+  801a97:	83 c4 08             	add    $0x8,%esp
+  801a9a:	50                   	push   %eax
+  801a9b:	6a 00                	push   $0x0
+  801a9d:	e8 ff f1 ff ff       	call   800ca1 <sys_page_unmap>
+  801aa2:	83 c4 10             	add    $0x10,%esp
+  801aa5:	eb c2                	jmp    801a69 <devfile_flush+0x1c>
+
+00801aa7 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801aa7:	55                   	push   %ebp
+  801aa8:	89 e5                	mov    %esp,%ebp
+  801aaa:	57                   	push   %edi
+  801aab:	56                   	push   %esi
+  801aac:	53                   	push   %ebx
+  801aad:	83 ec 64             	sub    $0x64,%esp
+  801ab0:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801ab2:	52                   	push   %edx
+  801ab3:	50                   	push   %eax
+  801ab4:	e8 d9 f5 ff ff       	call   801092 <fd_lookup>
+  801ab9:	89 c1                	mov    %eax,%ecx
+  801abb:	83 c4 10             	add    $0x10,%esp
+  801abe:	85 c0                	test   %eax,%eax
+  801ac0:	0f 88 f2 00 00 00    	js     801bb8 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801ac6:	8b 07                	mov    (%edi),%eax
+  801ac8:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801ace:	39 10                	cmp    %edx,(%eax)
+  801ad0:	0f 85 03 01 00 00    	jne    801bd9 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801ad6:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  801adb:	8b 40 48             	mov    0x48(%eax),%eax
+  801ade:	3b 05 c4 70 c0 00    	cmp    0xc070c4,%eax
+  801ae4:	0f 84 96 00 00 00    	je     801b80 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801aea:	83 3d c8 70 c0 00 00 	cmpl   $0x0,0xc070c8
+  801af1:	0f 84 cb 00 00 00    	je     801bc2 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801af7:	b8 00 60 c0 00       	mov    $0xc06000,%eax
+  801afc:	83 c8 07             	or     $0x7,%eax
+  801aff:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801b02:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b05:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801b0a:	83 ec 04             	sub    $0x4,%esp
+  801b0d:	68 07 04 00 00       	push   $0x407
+  801b12:	53                   	push   %ebx
+  801b13:	6a 00                	push   $0x0
+  801b15:	e8 fa f0 ff ff       	call   800c14 <sys_page_alloc>
+  801b1a:	89 c1                	mov    %eax,%ecx
+  801b1c:	83 c4 10             	add    $0x10,%esp
+  801b1f:	85 c0                	test   %eax,%eax
+  801b21:	0f 88 91 00 00 00    	js     801bb8 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801b27:	89 d8                	mov    %ebx,%eax
+  801b29:	83 c8 07             	or     $0x7,%eax
+  801b2c:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801b2e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b34:	83 c6 04             	add    $0x4,%esi
+  801b37:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801b3d:	75 cb                	jne    801b0a <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801b3f:	6a 12                	push   $0x12
+  801b41:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801b44:	50                   	push   %eax
+  801b45:	6a 0c                	push   $0xc
+  801b47:	ff 35 c8 70 c0 00    	push   0xc070c8
+  801b4d:	e8 e9 18 00 00       	call   80343b <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801b52:	83 c4 0c             	add    $0xc,%esp
+  801b55:	6a 00                	push   $0x0
+  801b57:	6a 00                	push   $0x0
+  801b59:	6a 00                	push   $0x0
+  801b5b:	e8 85 17 00 00       	call   8032e5 <ipc_recv>
+  801b60:	89 c1                	mov    %eax,%ecx
+  801b62:	83 c4 10             	add    $0x10,%esp
+  801b65:	85 c0                	test   %eax,%eax
+  801b67:	78 4f                	js     801bb8 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801b69:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  801b6e:	8b 40 48             	mov    0x48(%eax),%eax
+  801b71:	a3 c4 70 c0 00       	mov    %eax,0xc070c4
+	fsring_busy = 0;
+  801b76:	c7 05 c0 70 c0 00 00 	movl   $0x0,0xc070c0
+  801b7d:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801b80:	83 ec 0c             	sub    $0xc,%esp
+  801b83:	ff 37                	push   (%edi)
+  801b85:	e8 e4 fc ff ff       	call   80186e <devfile_sync>
+  801b8a:	89 c1                	mov    %eax,%ecx
+  801b8c:	83 c4 10             	add    $0x10,%esp
+  801b8f:	85 c0                	test   %eax,%eax
+  801b91:	78 25                	js     801bb8 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801b93:	8b 1d c0 70 c0 00    	mov    0xc070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801b99:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801b9e:	ba 01 00 00 00       	mov    $0x1,%edx
+  801ba3:	89 d0                	mov    %edx,%eax
+  801ba5:	d3 e0                	shl    %cl,%eax
+  801ba7:	85 d8                	test   %ebx,%eax
+  801ba9:	74 0d                	je     801bb8 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801bab:	83 c1 01             	add    $0x1,%ecx
+  801bae:	83 f9 10             	cmp    $0x10,%ecx
+  801bb1:	75 f0                	jne    801ba3 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801bb3:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801bb8:	89 c8                	mov    %ecx,%eax
+  801bba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bbd:	5b                   	pop    %ebx
+  801bbe:	5e                   	pop    %esi
+  801bbf:	5f                   	pop    %edi
+  801bc0:	5d                   	pop    %ebp
+  801bc1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801bc2:	83 ec 0c             	sub    $0xc,%esp
+  801bc5:	6a 01                	push   $0x1
+  801bc7:	e8 bd 18 00 00       	call   803489 <ipc_find_env>
+  801bcc:	a3 c8 70 c0 00       	mov    %eax,0xc070c8
+  801bd1:	83 c4 10             	add    $0x10,%esp
+  801bd4:	e9 1e ff ff ff       	jmp    801af7 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801bd9:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801bde:	eb d8                	jmp    801bb8 <fsring_slot+0x111>
+
+00801be0 <file_read_direct>:
+{
+  801be0:	55                   	push   %ebp
+  801be1:	89 e5                	mov    %esp,%ebp
+  801be3:	57                   	push   %edi
+  801be4:	56                   	push   %esi
+  801be5:	53                   	push   %ebx
+  801be6:	83 ec 1c             	sub    $0x1c,%esp
+  801be9:	89 c7                	mov    %eax,%edi
+  801beb:	89 d6                	mov    %edx,%esi
+  801bed:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801bef:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801bf5:	77 52                	ja     801c49 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bf7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bfa:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	fsipcbuf.read.req_n = n;
+  801bff:	89 0d 04 60 c0 00    	mov    %ecx,0xc06004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c05:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0a:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c0f:	e8 b6 fb ff ff       	call   8017ca <fsipc>
+  801c14:	89 c7                	mov    %eax,%edi
+  801c16:	85 c0                	test   %eax,%eax
+  801c18:	78 25                	js     801c3f <file_read_direct+0x5f>
+	assert(r <= n);
+  801c1a:	39 c3                	cmp    %eax,%ebx
+  801c1c:	0f 82 87 00 00 00    	jb     801ca9 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801c22:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c27:	0f 8f 95 00 00 00    	jg     801cc2 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801c2d:	83 ec 04             	sub    $0x4,%esp
+  801c30:	50                   	push   %eax
+  801c31:	68 00 60 c0 00       	push   $0xc06000
+  801c36:	56                   	push   %esi
+  801c37:	e8 52 ed ff ff       	call   80098e <memmove>
+	return r;
+  801c3c:	83 c4 10             	add    $0x10,%esp
+}
+  801c3f:	89 f8                	mov    %edi,%eax
+  801c41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c44:	5b                   	pop    %ebx
+  801c45:	5e                   	pop    %esi
+  801c46:	5f                   	pop    %edi
+  801c47:	5d                   	pop    %ebp
+  801c48:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801c49:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801c4f:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801c54:	29 d1                	sub    %edx,%ecx
+  801c56:	39 d9                	cmp    %ebx,%ecx
+  801c58:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801c5b:	89 f0                	mov    %esi,%eax
+  801c5d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801c60:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801c63:	eb 0f                	jmp    801c74 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801c65:	0f b6 10             	movzbl (%eax),%edx
+  801c68:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801c6a:	05 00 10 00 00       	add    $0x1000,%eax
+  801c6f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c74:	39 c8                	cmp    %ecx,%eax
+  801c76:	72 ed                	jb     801c65 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801c78:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c7b:	8b 47 0c             	mov    0xc(%edi),%eax
+  801c7e:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	fsipcbuf.bulk.req_n = n;
+  801c83:	89 1d 04 60 c0 00    	mov    %ebx,0xc06004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801c89:	89 15 08 60 c0 00    	mov    %edx,0xc06008
+	return fsipc_pages(type, buf, n, perm);
+  801c8f:	83 ec 0c             	sub    $0xc,%esp
+  801c92:	6a 07                	push   $0x7
+  801c94:	89 d9                	mov    %ebx,%ecx
+  801c96:	89 f2                	mov    %esi,%edx
+  801c98:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c9d:	e8 86 f9 ff ff       	call   801628 <fsipc_pages>
+  801ca2:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801ca4:	83 c4 10             	add    $0x10,%esp
+  801ca7:	eb 96                	jmp    801c3f <file_read_direct+0x5f>
+	assert(r <= n);
+  801ca9:	68 e0 3c 80 00       	push   $0x803ce0
+  801cae:	68 c0 3c 80 00       	push   $0x803cc0
+  801cb3:	68 dc 00 00 00       	push   $0xdc
+  801cb8:	68 d5 3c 80 00       	push   $0x803cd5
+  801cbd:	e8 7d e4 ff ff       	call   80013f <_panic>
+	assert(r <= PGSIZE);
+  801cc2:	68 f1 3c 80 00       	push   $0x803cf1
+  801cc7:	68 c0 3c 80 00       	push   $0x803cc0
+  801ccc:	68 dd 00 00 00       	push   $0xdd
+  801cd1:	68 d5 3c 80 00       	push   $0x803cd5
+  801cd6:	e8 64 e4 ff ff       	call   80013f <_panic>
+
+00801cdb <devfile_read>:
+{
+  801cdb:	55                   	push   %ebp
+  801cdc:	89 e5                	mov    %esp,%ebp
+  801cde:	57                   	push   %edi
+  801cdf:	56                   	push   %esi
+  801ce0:	53                   	push   %ebx
+  801ce1:	83 ec 28             	sub    $0x28,%esp
+  801ce4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ce7:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801cea:	53                   	push   %ebx
+  801ceb:	e8 35 f3 ff ff       	call   801025 <fd2data>
+  801cf0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801cf3:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801cf6:	83 c4 10             	add    $0x10,%esp
+  801cf9:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801cfd:	74 7d                	je     801d7c <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801cff:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801d03:	0f 85 81 00 00 00    	jne    801d8a <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801d09:	8b 43 18             	mov    0x18(%ebx),%eax
+  801d0c:	85 c0                	test   %eax,%eax
+  801d0e:	74 0d                	je     801d1d <devfile_read+0x42>
+  801d10:	8b 53 14             	mov    0x14(%ebx),%edx
+  801d13:	39 fa                	cmp    %edi,%edx
+  801d15:	7f 06                	jg     801d1d <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801d17:	01 c2                	add    %eax,%edx
+  801d19:	39 d7                	cmp    %edx,%edi
+  801d1b:	72 28                	jb     801d45 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801d1d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801d24:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d2a:	77 74                	ja     801da0 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801d2c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d31:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d34:	89 d8                	mov    %ebx,%eax
+  801d36:	e8 a5 fe ff ff       	call   801be0 <file_read_direct>
+  801d3b:	85 c0                	test   %eax,%eax
+  801d3d:	7e 35                	jle    801d74 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801d3f:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801d42:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801d45:	8b 53 14             	mov    0x14(%ebx),%edx
+  801d48:	89 d0                	mov    %edx,%eax
+  801d4a:	03 43 18             	add    0x18(%ebx),%eax
+  801d4d:	29 f8                	sub    %edi,%eax
+  801d4f:	39 f0                	cmp    %esi,%eax
+  801d51:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801d54:	83 ec 04             	sub    $0x4,%esp
+  801d57:	56                   	push   %esi
+  801d58:	89 f8                	mov    %edi,%eax
+  801d5a:	29 d0                	sub    %edx,%eax
+  801d5c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d5f:	01 c1                	add    %eax,%ecx
+  801d61:	51                   	push   %ecx
+  801d62:	ff 75 0c             	push   0xc(%ebp)
+  801d65:	e8 24 ec ff ff       	call   80098e <memmove>
+	fd->fd_offset = pos + n;
+  801d6a:	01 f7                	add    %esi,%edi
+  801d6c:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801d6f:	89 f0                	mov    %esi,%eax
+  801d71:	83 c4 10             	add    $0x10,%esp
+}
+  801d74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d77:	5b                   	pop    %ebx
+  801d78:	5e                   	pop    %esi
+  801d79:	5f                   	pop    %edi
+  801d7a:	5d                   	pop    %ebp
+  801d7b:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801d7c:	89 f1                	mov    %esi,%ecx
+  801d7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d81:	89 d8                	mov    %ebx,%eax
+  801d83:	e8 58 fe ff ff       	call   801be0 <file_read_direct>
+  801d88:	eb ea                	jmp    801d74 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801d8a:	83 ec 0c             	sub    $0xc,%esp
+  801d8d:	53                   	push   %ebx
+  801d8e:	e8 db fa ff ff       	call   80186e <devfile_sync>
+  801d93:	83 c4 10             	add    $0x10,%esp
+  801d96:	85 c0                	test   %eax,%eax
+  801d98:	0f 89 6b ff ff ff    	jns    801d09 <devfile_read+0x2e>
+  801d9e:	eb d4                	jmp    801d74 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801da0:	89 f1                	mov    %esi,%ecx
+  801da2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801da5:	89 d8                	mov    %ebx,%eax
+  801da7:	e8 34 fe ff ff       	call   801be0 <file_read_direct>
+  801dac:	eb c6                	jmp    801d74 <devfile_read+0x99>
+
+00801dae <open>:
+{
+  801dae:	55                   	push   %ebp
+  801daf:	89 e5                	mov    %esp,%ebp
+  801db1:	56                   	push   %esi
+  801db2:	53                   	push   %ebx
+  801db3:	83 ec 1c             	sub    $0x1c,%esp
+  801db6:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801db9:	56                   	push   %esi
+  801dba:	e8 0e ea ff ff       	call   8007cd <strlen>
+  801dbf:	83 c4 10             	add    $0x10,%esp
+  801dc2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801dc7:	0f 8f a0 00 00 00    	jg     801e6d <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801dcd:	83 ec 0c             	sub    $0xc,%esp
+  801dd0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dd3:	50                   	push   %eax
+  801dd4:	e8 63 f2 ff ff       	call   80103c <fd_alloc>
+  801dd9:	89 c3                	mov    %eax,%ebx
+  801ddb:	83 c4 10             	add    $0x10,%esp
+  801dde:	85 c0                	test   %eax,%eax
+  801de0:	78 45                	js     801e27 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801de2:	83 ec 08             	sub    $0x8,%esp
+  801de5:	56                   	push   %esi
+  801de6:	68 00 60 c0 00       	push   $0xc06000
+  801deb:	e8 18 ea ff ff       	call   800808 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801df0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801df3:	a3 00 64 c0 00       	mov    %eax,0xc06400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801df8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801dfb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e00:	e8 c5 f9 ff ff       	call   8017ca <fsipc>
+  801e05:	89 c3                	mov    %eax,%ebx
+  801e07:	83 c4 10             	add    $0x10,%esp
+  801e0a:	85 c0                	test   %eax,%eax
+  801e0c:	78 22                	js     801e30 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801e0e:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801e15:	74 2b                	je     801e42 <open+0x94>
+	return fd2num(fd);
+  801e17:	83 ec 0c             	sub    $0xc,%esp
+  801e1a:	ff 75 f4             	push   -0xc(%ebp)
+  801e1d:	e8 f3 f1 ff ff       	call   801015 <fd2num>
+  801e22:	89 c3                	mov    %eax,%ebx
+  801e24:	83 c4 10             	add    $0x10,%esp
+}
+  801e27:	89 d8                	mov    %ebx,%eax
+  801e29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e2c:	5b                   	pop    %ebx
+  801e2d:	5e                   	pop    %esi
+  801e2e:	5d                   	pop    %ebp
+  801e2f:	c3                   	ret
+		fd_close(fd, 0);
+  801e30:	83 ec 08             	sub    $0x8,%esp
+  801e33:	6a 00                	push   $0x0
+  801e35:	ff 75 f4             	push   -0xc(%ebp)
+  801e38:	e8 f8 f2 ff ff       	call   801135 <fd_close>
+		return r;
+  801e3d:	83 c4 10             	add    $0x10,%esp
+  801e40:	eb e5                	jmp    801e27 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801e42:	83 ec 0c             	sub    $0xc,%esp
+  801e45:	ff 75 f4             	push   -0xc(%ebp)
+  801e48:	e8 d8 f1 ff ff       	call   801025 <fd2data>
+  801e4d:	83 c4 0c             	add    $0xc,%esp
+  801e50:	68 07 04 00 00       	push   $0x407
+  801e55:	50                   	push   %eax
+  801e56:	6a 00                	push   $0x0
+  801e58:	e8 b7 ed ff ff       	call   800c14 <sys_page_alloc>
+  801e5d:	83 c4 10             	add    $0x10,%esp
+  801e60:	85 c0                	test   %eax,%eax
+  801e62:	75 b3                	jne    801e17 <open+0x69>
+		fd->fd_file.buffered = 1;
+  801e64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e67:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801e6b:	eb aa                	jmp    801e17 <open+0x69>
+		return -E_BAD_PATH;
+  801e6d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e72:	eb b3                	jmp    801e27 <open+0x79>
+
+00801e74 <readdir>:
+{
+  801e74:	55                   	push   %ebp
+  801e75:	89 e5                	mov    %esp,%ebp
+  801e77:	53                   	push   %ebx
+  801e78:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e7b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e7e:	50                   	push   %eax
+  801e7f:	ff 75 08             	push   0x8(%ebp)
+  801e82:	e8 0b f2 ff ff       	call   801092 <fd_lookup>
+  801e87:	89 c3                	mov    %eax,%ebx
+  801e89:	83 c4 10             	add    $0x10,%esp
+  801e8c:	85 c0                	test   %eax,%eax
+  801e8e:	78 73                	js     801f03 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801e90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e93:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801e99:	39 08                	cmp    %ecx,(%eax)
+  801e9b:	0f 85 82 00 00 00    	jne    801f23 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801ea1:	83 ec 0c             	sub    $0xc,%esp
+  801ea4:	50                   	push   %eax
+  801ea5:	e8 c4 f9 ff ff       	call   80186e <devfile_sync>
+  801eaa:	89 c3                	mov    %eax,%ebx
+  801eac:	83 c4 10             	add    $0x10,%esp
+  801eaf:	85 c0                	test   %eax,%eax
+  801eb1:	78 50                	js     801f03 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801eb3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eb6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eb9:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	fsipcbuf.readdir.req_n = n;
+  801ebe:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ec1:	a3 04 60 c0 00       	mov    %eax,0xc06004
+	fsipcbuf.readdir.req_flags = flags;
+  801ec6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ec9:	a3 08 60 c0 00       	mov    %eax,0xc06008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801ece:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ed3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ed8:	e8 ed f8 ff ff       	call   8017ca <fsipc>
+  801edd:	89 c3                	mov    %eax,%ebx
+  801edf:	85 c0                	test   %eax,%eax
+  801ee1:	7e 20                	jle    801f03 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801ee3:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801ee6:	72 22                	jb     801f0a <readdir+0x96>
+  801ee8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801eed:	7f 1b                	jg     801f0a <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801eef:	83 ec 04             	sub    $0x4,%esp
+  801ef2:	50                   	push   %eax
+  801ef3:	68 00 60 c0 00       	push   $0xc06000
+  801ef8:	ff 75 0c             	push   0xc(%ebp)
+  801efb:	e8 8e ea ff ff       	call   80098e <memmove>
+	return r;
+  801f00:	83 c4 10             	add    $0x10,%esp
+}
+  801f03:	89 d8                	mov    %ebx,%eax
+  801f05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f08:	c9                   	leave
+  801f09:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801f0a:	68 e7 3c 80 00       	push   $0x803ce7
+  801f0f:	68 c0 3c 80 00       	push   $0x803cc0
+  801f14:	68 86 01 00 00       	push   $0x186
+  801f19:	68 d5 3c 80 00       	push   $0x803cd5
+  801f1e:	e8 1c e2 ff ff       	call   80013f <_panic>
+		return -E_NOT_SUPP;
+  801f23:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801f28:	eb d9                	jmp    801f03 <readdir+0x8f>
+
+00801f2a <munmap>:
+{
+  801f2a:	55                   	push   %ebp
+  801f2b:	89 e5                	mov    %esp,%ebp
+  801f2d:	56                   	push   %esi
+  801f2e:	53                   	push   %ebx
+  801f2f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f32:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801f35:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801f3b:	75 41                	jne    801f7e <munmap+0x54>
+  801f3d:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801f43:	77 39                	ja     801f7e <munmap+0x54>
+  801f45:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f4a:	29 f0                	sub    %esi,%eax
+  801f4c:	39 d0                	cmp    %edx,%eax
+  801f4e:	72 35                	jb     801f85 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801f50:	89 f3                	mov    %esi,%ebx
+  801f52:	01 d6                	add    %edx,%esi
+  801f54:	39 f3                	cmp    %esi,%ebx
+  801f56:	73 1a                	jae    801f72 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801f58:	83 ec 08             	sub    $0x8,%esp
+  801f5b:	53                   	push   %ebx
+  801f5c:	6a 00                	push   $0x0
+  801f5e:	e8 3e ed ff ff       	call   800ca1 <sys_page_unmap>
+  801f63:	83 c4 10             	add    $0x10,%esp
+  801f66:	85 c0                	test   %eax,%eax
+  801f68:	78 0d                	js     801f77 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801f6a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f70:	eb e2                	jmp    801f54 <munmap+0x2a>
+	return 0;
+  801f72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f7a:	5b                   	pop    %ebx
+  801f7b:	5e                   	pop    %esi
+  801f7c:	5d                   	pop    %ebp
+  801f7d:	c3                   	ret
+		return -E_INVAL;
+  801f7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f83:	eb f2                	jmp    801f77 <munmap+0x4d>
+  801f85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f8a:	eb eb                	jmp    801f77 <munmap+0x4d>
+
+00801f8c <mmap>:
+{
+  801f8c:	55                   	push   %ebp
+  801f8d:	89 e5                	mov    %esp,%ebp
+  801f8f:	57                   	push   %edi
+  801f90:	56                   	push   %esi
+  801f91:	53                   	push   %ebx
+  801f92:	83 ec 34             	sub    $0x34,%esp
+  801f95:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f98:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f9b:	50                   	push   %eax
+  801f9c:	ff 75 18             	push   0x18(%ebp)
+  801f9f:	e8 ee f0 ff ff       	call   801092 <fd_lookup>
+  801fa4:	89 c3                	mov    %eax,%ebx
+  801fa6:	83 c4 10             	add    $0x10,%esp
+  801fa9:	85 c0                	test   %eax,%eax
+  801fab:	0f 88 0e 01 00 00    	js     8020bf <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801fb1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fb4:	a1 20 40 80 00       	mov    0x804020,%eax
+  801fb9:	39 02                	cmp    %eax,(%edx)
+  801fbb:	0f 85 50 01 00 00    	jne    802111 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801fc1:	8b 45 10             	mov    0x10(%ebp),%eax
+  801fc4:	83 e0 02             	and    $0x2,%eax
+  801fc7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801fca:	74 0a                	je     801fd6 <mmap+0x4a>
+  801fcc:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801fd0:	0f 84 42 01 00 00    	je     802118 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801fd6:	8b 42 08             	mov    0x8(%edx),%eax
+  801fd9:	83 e0 03             	and    $0x3,%eax
+  801fdc:	83 f8 01             	cmp    $0x1,%eax
+  801fdf:	0f 84 3a 01 00 00    	je     80211f <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  801fe5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe8:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801feb:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ff0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801ff3:	0f 85 2d 01 00 00    	jne    802126 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801ff9:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801ffd:	0f 88 2a 01 00 00    	js     80212d <mmap+0x1a1>
+  802003:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80200a:	0f 87 1d 01 00 00    	ja     80212d <mmap+0x1a1>
+  802010:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802015:	2b 45 08             	sub    0x8(%ebp),%eax
+  802018:	39 f8                	cmp    %edi,%eax
+  80201a:	0f 82 14 01 00 00    	jb     802134 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802020:	83 ec 0c             	sub    $0xc,%esp
+  802023:	52                   	push   %edx
+  802024:	e8 45 f8 ff ff       	call   80186e <devfile_sync>
+  802029:	89 c3                	mov    %eax,%ebx
+  80202b:	83 c4 10             	add    $0x10,%esp
+  80202e:	85 c0                	test   %eax,%eax
+  802030:	0f 88 89 00 00 00    	js     8020bf <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802036:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  80203c:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802042:	be 00 00 00 00       	mov    $0x0,%esi
+  802047:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  80204a:	39 fe                	cmp    %edi,%esi
+  80204c:	73 7b                	jae    8020c9 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  80204e:	89 f8                	mov    %edi,%eax
+  802050:	29 f0                	sub    %esi,%eax
+  802052:	c1 e8 0c             	shr    $0xc,%eax
+  802055:	ba 40 00 00 00       	mov    $0x40,%edx
+  80205a:	39 d0                	cmp    %edx,%eax
+  80205c:	0f 47 c2             	cmova  %edx,%eax
+  80205f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802062:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802065:	8b 52 0c             	mov    0xc(%edx),%edx
+  802068:	89 15 00 60 c0 00    	mov    %edx,0xc06000
+		fsipcbuf.map.req_offset = offset + done;
+  80206e:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802071:	89 15 04 60 c0 00    	mov    %edx,0xc06004
+		fsipcbuf.map.req_npages = n;
+  802077:	a3 08 60 c0 00       	mov    %eax,0xc06008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  80207c:	89 f2                	mov    %esi,%edx
+  80207e:	03 55 08             	add    0x8(%ebp),%edx
+  802081:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802084:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802089:	e8 ea f6 ff ff       	call   801778 <fsipcv>
+  80208e:	85 c0                	test   %eax,%eax
+  802090:	7e 12                	jle    8020a4 <mmap+0x118>
+  802092:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802095:	85 c0                	test   %eax,%eax
+  802097:	0f 84 9e 00 00 00    	je     80213b <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80209d:	c1 e0 0c             	shl    $0xc,%eax
+  8020a0:	01 c6                	add    %eax,%esi
+  8020a2:	eb a6                	jmp    80204a <mmap+0xbe>
+			munmap(addr, done);
+  8020a4:	89 c3                	mov    %eax,%ebx
+  8020a6:	83 ec 08             	sub    $0x8,%esp
+  8020a9:	56                   	push   %esi
+  8020aa:	ff 75 08             	push   0x8(%ebp)
+  8020ad:	e8 78 fe ff ff       	call   801f2a <munmap>
+			return r < 0 ? r : -E_INVAL;
+  8020b2:	83 c4 10             	add    $0x10,%esp
+  8020b5:	85 db                	test   %ebx,%ebx
+  8020b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020bc:	0f 49 d8             	cmovns %eax,%ebx
+}
+  8020bf:	89 d8                	mov    %ebx,%eax
+  8020c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020c4:	5b                   	pop    %ebx
+  8020c5:	5e                   	pop    %esi
+  8020c6:	5f                   	pop    %edi
+  8020c7:	5d                   	pop    %ebp
+  8020c8:	c3                   	ret
+	if (prot & PROT_WRITE)
+  8020c9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8020cc:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8020ce:	85 c0                	test   %eax,%eax
+  8020d0:	74 ed                	je     8020bf <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8020d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020da:	39 fe                	cmp    %edi,%esi
+  8020dc:	73 2e                	jae    80210c <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8020de:	83 ec 0c             	sub    $0xc,%esp
+  8020e1:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8020e4:	50                   	push   %eax
+  8020e5:	e8 fd 0f 00 00       	call   8030e7 <cowpage>
+  8020ea:	83 c4 10             	add    $0x10,%esp
+  8020ed:	85 c0                	test   %eax,%eax
+  8020ef:	78 08                	js     8020f9 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8020f1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8020f7:	eb e1                	jmp    8020da <mmap+0x14e>
+				munmap(addr, len);
+  8020f9:	89 c3                	mov    %eax,%ebx
+  8020fb:	83 ec 08             	sub    $0x8,%esp
+  8020fe:	57                   	push   %edi
+  8020ff:	ff 75 08             	push   0x8(%ebp)
+  802102:	e8 23 fe ff ff       	call   801f2a <munmap>
+				return r;
+  802107:	83 c4 10             	add    $0x10,%esp
+  80210a:	eb b3                	jmp    8020bf <mmap+0x133>
+	return 0;
+  80210c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80210f:	eb ae                	jmp    8020bf <mmap+0x133>
+		return -E_NOT_SUPP;
+  802111:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802116:	eb a7                	jmp    8020bf <mmap+0x133>
+		return -E_NOT_SUPP;
+  802118:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80211d:	eb a0                	jmp    8020bf <mmap+0x133>
+		return -E_INVAL;
+  80211f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802124:	eb 99                	jmp    8020bf <mmap+0x133>
+  802126:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80212b:	eb 92                	jmp    8020bf <mmap+0x133>
+  80212d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802132:	eb 8b                	jmp    8020bf <mmap+0x133>
+  802134:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802139:	eb 84                	jmp    8020bf <mmap+0x133>
+			munmap(addr, done);
+  80213b:	83 ec 08             	sub    $0x8,%esp
+  80213e:	56                   	push   %esi
+  80213f:	ff 75 08             	push   0x8(%ebp)
+  802142:	e8 e3 fd ff ff       	call   801f2a <munmap>
+  802147:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  80214a:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80214f:	e9 6b ff ff ff       	jmp    8020bf <mmap+0x133>
+
+00802154 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802154:	55                   	push   %ebp
+  802155:	89 e5                	mov    %esp,%ebp
+  802157:	56                   	push   %esi
+  802158:	53                   	push   %ebx
+  802159:	83 ec 10             	sub    $0x10,%esp
+  80215c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80215f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802162:	8b 45 08             	mov    0x8(%ebp),%eax
+  802165:	e8 3d f9 ff ff       	call   801aa7 <fsring_slot>
+  80216a:	85 c0                	test   %eax,%eax
+  80216c:	78 60                	js     8021ce <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80216e:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802171:	8b 56 08             	mov    0x8(%esi),%edx
+  802174:	83 e2 03             	and    $0x3,%edx
+  802177:	83 fa 01             	cmp    $0x1,%edx
+  80217a:	74 59                	je     8021d5 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  80217c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802181:	89 c1                	mov    %eax,%ecx
+  802183:	d3 e2                	shl    %cl,%edx
+  802185:	09 15 c0 70 c0 00    	or     %edx,0xc070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  80218b:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80218e:	c1 e2 02             	shl    $0x2,%edx
+  802191:	8d 8a 00 70 c0 00    	lea    0xc07000(%edx),%ecx
+  802197:	c7 82 00 70 c0 00 03 	movl   $0x3,0xc07000(%edx)
+  80219e:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8021a1:	8b 55 18             	mov    0x18(%ebp),%edx
+  8021a4:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8021a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021aa:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8021ad:	83 ec 08             	sub    $0x8,%esp
+  8021b0:	50                   	push   %eax
+  8021b1:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8021b6:	39 c3                	cmp    %eax,%ebx
+  8021b8:	0f 47 d8             	cmova  %eax,%ebx
+  8021bb:	53                   	push   %ebx
+  8021bc:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8021bf:	89 f2                	mov    %esi,%edx
+  8021c1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021c6:	e8 1e f5 ff ff       	call   8016e9 <fsring_post>
+  8021cb:	83 c4 10             	add    $0x10,%esp
+}
+  8021ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021d1:	5b                   	pop    %ebx
+  8021d2:	5e                   	pop    %esi
+  8021d3:	5d                   	pop    %ebp
+  8021d4:	c3                   	ret
+		return -E_INVAL;
+  8021d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021da:	eb f2                	jmp    8021ce <fsring_read+0x7a>
+
+008021dc <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8021dc:	55                   	push   %ebp
+  8021dd:	89 e5                	mov    %esp,%ebp
+  8021df:	56                   	push   %esi
+  8021e0:	53                   	push   %ebx
+  8021e1:	83 ec 10             	sub    $0x10,%esp
+  8021e4:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8021e7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ed:	e8 b5 f8 ff ff       	call   801aa7 <fsring_slot>
+  8021f2:	89 c3                	mov    %eax,%ebx
+  8021f4:	85 c0                	test   %eax,%eax
+  8021f6:	78 77                	js     80226f <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8021f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021fb:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8021ff:	74 77                	je     802278 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802201:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802206:	39 c6                	cmp    %eax,%esi
+  802208:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80220b:	83 ec 04             	sub    $0x4,%esp
+  80220e:	56                   	push   %esi
+  80220f:	ff 75 0c             	push   0xc(%ebp)
+  802212:	89 d8                	mov    %ebx,%eax
+  802214:	c1 e0 0c             	shl    $0xc,%eax
+  802217:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80221d:	50                   	push   %eax
+  80221e:	e8 6b e7 ff ff       	call   80098e <memmove>
+	fsring_busy |= 1 << slot;
+  802223:	b8 01 00 00 00       	mov    $0x1,%eax
+  802228:	89 d9                	mov    %ebx,%ecx
+  80222a:	d3 e0                	shl    %cl,%eax
+  80222c:	09 05 c0 70 c0 00    	or     %eax,0xc070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802232:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802235:	c1 e0 02             	shl    $0x2,%eax
+  802238:	8d 90 00 70 c0 00    	lea    0xc07000(%eax),%edx
+  80223e:	c7 80 00 70 c0 00 04 	movl   $0x4,0xc07000(%eax)
+  802245:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802248:	8b 45 18             	mov    0x18(%ebp),%eax
+  80224b:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80224e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802255:	83 c4 08             	add    $0x8,%esp
+  802258:	53                   	push   %ebx
+  802259:	56                   	push   %esi
+  80225a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80225d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802260:	b8 04 00 00 00       	mov    $0x4,%eax
+  802265:	e8 7f f4 ff ff       	call   8016e9 <fsring_post>
+  80226a:	89 c3                	mov    %eax,%ebx
+  80226c:	83 c4 10             	add    $0x10,%esp
+}
+  80226f:	89 d8                	mov    %ebx,%eax
+  802271:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802274:	5b                   	pop    %ebx
+  802275:	5e                   	pop    %esi
+  802276:	5d                   	pop    %ebp
+  802277:	c3                   	ret
+		return -E_INVAL;
+  802278:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80227d:	eb f0                	jmp    80226f <fsring_write+0x93>
+
+0080227f <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80227f:	55                   	push   %ebp
+  802280:	89 e5                	mov    %esp,%ebp
+  802282:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802285:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802288:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228b:	e8 17 f8 ff ff       	call   801aa7 <fsring_slot>
+  802290:	85 c0                	test   %eax,%eax
+  802292:	78 4c                	js     8022e0 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802294:	ba 01 00 00 00       	mov    $0x1,%edx
+  802299:	89 c1                	mov    %eax,%ecx
+  80229b:	d3 e2                	shl    %cl,%edx
+  80229d:	09 15 c0 70 c0 00    	or     %edx,0xc070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8022a3:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8022a6:	c1 e2 02             	shl    $0x2,%edx
+  8022a9:	8d 8a 00 70 c0 00    	lea    0xc07000(%edx),%ecx
+  8022af:	c7 82 00 70 c0 00 05 	movl   $0x5,0xc07000(%edx)
+  8022b6:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8022b9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8022bc:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8022bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022c2:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  8022c5:	83 ec 08             	sub    $0x8,%esp
+  8022c8:	50                   	push   %eax
+  8022c9:	6a 00                	push   $0x0
+  8022cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022d0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022d3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022d8:	e8 0c f4 ff ff       	call   8016e9 <fsring_post>
+  8022dd:	83 c4 10             	add    $0x10,%esp
+}
+  8022e0:	c9                   	leave
+  8022e1:	c3                   	ret
+
+008022e2 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8022e2:	55                   	push   %ebp
+  8022e3:	89 e5                	mov    %esp,%ebp
+  8022e5:	57                   	push   %edi
+  8022e6:	56                   	push   %esi
+  8022e7:	53                   	push   %ebx
+  8022e8:	83 ec 1c             	sub    $0x1c,%esp
+  8022eb:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8022ef:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  8022f4:	8b 40 48             	mov    0x48(%eax),%eax
+  8022f7:	3b 05 c4 70 c0 00    	cmp    0xc070c4,%eax
+  8022fd:	74 12                	je     802311 <fsring_reap+0x2f>
+		return 0;
+  8022ff:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802304:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802307:	5b                   	pop    %ebx
+  802308:	5e                   	pop    %esi
+  802309:	5f                   	pop    %edi
+  80230a:	5d                   	pop    %ebp
+  80230b:	c3                   	ret
+		sys_yield();
+  80230c:	e8 e4 e8 ff ff       	call   800bf5 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802311:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802317:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80231c:	39 c2                	cmp    %eax,%edx
+  80231e:	75 18                	jne    802338 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802320:	84 db                	test   %bl,%bl
+  802322:	0f 84 21 01 00 00    	je     802449 <fsring_reap+0x167>
+  802328:	83 3d c0 70 c0 00 00 	cmpl   $0x0,0xc070c0
+  80232f:	75 db                	jne    80230c <fsring_reap+0x2a>
+			return 0;
+  802331:	b8 00 00 00 00       	mov    $0x0,%eax
+  802336:	eb cc                	jmp    802304 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802338:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80233d:	83 e0 0f             	and    $0xf,%eax
+  802340:	83 c0 2a             	add    $0x2a,%eax
+  802343:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  80234a:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802351:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802356:	83 c0 01             	add    $0x1,%eax
+  802359:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  80235e:	83 fb 0f             	cmp    $0xf,%ebx
+  802361:	77 5b                	ja     8023be <fsring_reap+0xdc>
+  802363:	be 01 00 00 00       	mov    $0x1,%esi
+  802368:	89 d9                	mov    %ebx,%ecx
+  80236a:	d3 e6                	shl    %cl,%esi
+  80236c:	89 f0                	mov    %esi,%eax
+  80236e:	23 05 c0 70 c0 00    	and    0xc070c0,%eax
+  802374:	74 48                	je     8023be <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802376:	89 d8                	mov    %ebx,%eax
+  802378:	c1 e0 0c             	shl    $0xc,%eax
+  80237b:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802381:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802384:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802387:	8b 04 85 00 70 c0 00 	mov    0xc07000(,%eax,4),%eax
+  80238e:	83 f8 03             	cmp    $0x3,%eax
+  802391:	74 40                	je     8023d3 <fsring_reap+0xf1>
+  802393:	83 f8 05             	cmp    $0x5,%eax
+  802396:	74 64                	je     8023fc <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802398:	f7 d6                	not    %esi
+  80239a:	21 35 c0 70 c0 00    	and    %esi,0xc070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8023a0:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8023a3:	8b 14 85 04 70 c0 00 	mov    0xc07004(,%eax,4),%edx
+  8023aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ad:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8023af:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023b2:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8023b4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023b9:	e9 46 ff ff ff       	jmp    802304 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8023be:	53                   	push   %ebx
+  8023bf:	68 fd 3c 80 00       	push   $0x803cfd
+  8023c4:	68 8f 02 00 00       	push   $0x28f
+  8023c9:	68 d5 3c 80 00       	push   $0x803cd5
+  8023ce:	e8 6c dd ff ff       	call   80013f <_panic>
+		if (cqe.cqe_result > 0)
+  8023d3:	85 ff                	test   %edi,%edi
+  8023d5:	7e c1                	jle    802398 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8023d7:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8023da:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8023df:	39 c7                	cmp    %eax,%edi
+  8023e1:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8023e4:	50                   	push   %eax
+  8023e5:	ff 75 e4             	push   -0x1c(%ebp)
+  8023e8:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8023eb:	ff 34 85 08 70 c0 00 	push   0xc07008(,%eax,4)
+  8023f2:	e8 97 e5 ff ff       	call   80098e <memmove>
+  8023f7:	83 c4 10             	add    $0x10,%esp
+  8023fa:	eb 9c                	jmp    802398 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8023fc:	85 ff                	test   %edi,%edi
+  8023fe:	75 98                	jne    802398 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802400:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802403:	8b 0c 85 08 70 c0 00 	mov    0xc07008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80240a:	83 ec 08             	sub    $0x8,%esp
+  80240d:	ff 75 e4             	push   -0x1c(%ebp)
+  802410:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802413:	51                   	push   %ecx
+  802414:	e8 ef e3 ff ff       	call   800808 <strcpy>
+			st->st_size = ret->ret_size;
+  802419:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80241c:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802422:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802425:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80242b:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802431:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802437:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  80243e:	40 80 00 
+  802441:	83 c4 10             	add    $0x10,%esp
+  802444:	e9 4f ff ff ff       	jmp    802398 <fsring_reap+0xb6>
+			return 0;
+  802449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244e:	e9 b1 fe ff ff       	jmp    802304 <fsring_reap+0x22>
+
+00802453 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802453:	55                   	push   %ebp
+  802454:	89 e5                	mov    %esp,%ebp
+  802456:	57                   	push   %edi
+  802457:	56                   	push   %esi
+  802458:	53                   	push   %ebx
+  802459:	83 ec 28             	sub    $0x28,%esp
+  80245c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80245f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802462:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802465:	53                   	push   %ebx
+  802466:	e8 62 e3 ff ff       	call   8007cd <strlen>
+  80246b:	83 c4 10             	add    $0x10,%esp
+  80246e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802473:	0f 8f 02 01 00 00    	jg     80257b <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802479:	83 ec 08             	sub    $0x8,%esp
+  80247c:	53                   	push   %ebx
+  80247d:	68 00 60 c0 00       	push   $0xc06000
+  802482:	e8 81 e3 ff ff       	call   800808 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802487:	83 c4 10             	add    $0x10,%esp
+  80248a:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802490:	76 69                	jbe    8024fb <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802492:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802495:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80249b:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8024a0:	29 d1                	sub    %edx,%ecx
+  8024a2:	39 f9                	cmp    %edi,%ecx
+  8024a4:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8024a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024aa:	89 f9                	mov    %edi,%ecx
+  8024ac:	01 c1                	add    %eax,%ecx
+  8024ae:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8024b1:	eb 0f                	jmp    8024c2 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  8024b3:	0f b6 10             	movzbl (%eax),%edx
+  8024b6:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8024b8:	05 00 10 00 00       	add    $0x1000,%eax
+  8024bd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8024c2:	39 c8                	cmp    %ecx,%eax
+  8024c4:	72 ed                	jb     8024b3 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  8024c6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024c9:	89 3d 00 64 c0 00    	mov    %edi,0xc06400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  8024cf:	89 15 04 64 c0 00    	mov    %edx,0xc06404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8024d5:	83 ec 0c             	sub    $0xc,%esp
+  8024d8:	6a 07                	push   $0x7
+  8024da:	89 f9                	mov    %edi,%ecx
+  8024dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024df:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8024e4:	e8 3f f1 ff ff       	call   801628 <fsipc_pages>
+  8024e9:	89 c7                	mov    %eax,%edi
+  8024eb:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8024ee:	85 f6                	test   %esi,%esi
+  8024f0:	74 7f                	je     802571 <file_slurp+0x11e>
+  8024f2:	8d 43 01             	lea    0x1(%ebx),%eax
+  8024f5:	85 ff                	test   %edi,%edi
+  8024f7:	79 3c                	jns    802535 <file_slurp+0xe2>
+  8024f9:	eb 76                	jmp    802571 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8024fb:	89 3d 00 64 c0 00    	mov    %edi,0xc06400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802501:	ba 00 00 00 00       	mov    $0x0,%edx
+  802506:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80250b:	e8 ba f2 ff ff       	call   8017ca <fsipc>
+  802510:	89 c7                	mov    %eax,%edi
+  802512:	85 c0                	test   %eax,%eax
+  802514:	7e d8                	jle    8024ee <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802516:	83 ec 04             	sub    $0x4,%esp
+  802519:	50                   	push   %eax
+  80251a:	68 08 60 c0 00       	push   $0xc06008
+  80251f:	ff 75 0c             	push   0xc(%ebp)
+  802522:	e8 67 e4 ff ff       	call   80098e <memmove>
+  802527:	83 c4 10             	add    $0x10,%esp
+  80252a:	eb c2                	jmp    8024ee <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  80252c:	80 fa 2f             	cmp    $0x2f,%dl
+  80252f:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802532:	83 c0 01             	add    $0x1,%eax
+  802535:	89 c1                	mov    %eax,%ecx
+  802537:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  80253b:	84 d2                	test   %dl,%dl
+  80253d:	75 ed                	jne    80252c <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  80253f:	83 ec 04             	sub    $0x4,%esp
+  802542:	68 80 00 00 00       	push   $0x80
+  802547:	53                   	push   %ebx
+  802548:	56                   	push   %esi
+  802549:	e8 30 e3 ff ff       	call   80087e <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  80254e:	a1 00 60 c0 00       	mov    0xc06000,%eax
+  802553:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802559:	a1 04 60 c0 00       	mov    0xc06004,%eax
+  80255e:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802564:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  80256b:	40 80 00 
+  80256e:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802571:	89 f8                	mov    %edi,%eax
+  802573:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802576:	5b                   	pop    %ebx
+  802577:	5e                   	pop    %esi
+  802578:	5f                   	pop    %edi
+  802579:	5d                   	pop    %ebp
+  80257a:	c3                   	ret
+		return -E_BAD_PATH;
+  80257b:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802580:	eb ef                	jmp    802571 <file_slurp+0x11e>
+
+00802582 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802582:	55                   	push   %ebp
+  802583:	89 e5                	mov    %esp,%ebp
+  802585:	53                   	push   %ebx
+  802586:	83 ec 10             	sub    $0x10,%esp
+  802589:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80258c:	53                   	push   %ebx
+  80258d:	e8 3b e2 ff ff       	call   8007cd <strlen>
+  802592:	83 c4 10             	add    $0x10,%esp
+  802595:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80259a:	7f 25                	jg     8025c1 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80259c:	83 ec 08             	sub    $0x8,%esp
+  80259f:	53                   	push   %ebx
+  8025a0:	68 00 60 c0 00       	push   $0xc06000
+  8025a5:	e8 5e e2 ff ff       	call   800808 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8025aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025af:	b8 07 00 00 00       	mov    $0x7,%eax
+  8025b4:	e8 11 f2 ff ff       	call   8017ca <fsipc>
+  8025b9:	83 c4 10             	add    $0x10,%esp
+}
+  8025bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025bf:	c9                   	leave
+  8025c0:	c3                   	ret
+		return -E_BAD_PATH;
+  8025c1:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8025c6:	eb f4                	jmp    8025bc <remove+0x3a>
+
+008025c8 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8025c8:	55                   	push   %ebp
+  8025c9:	89 e5                	mov    %esp,%ebp
+  8025cb:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8025ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8025d8:	e8 ed f1 ff ff       	call   8017ca <fsipc>
+}
+  8025dd:	c9                   	leave
+  8025de:	c3                   	ret
+
+008025df <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  8025df:	55                   	push   %ebp
+  8025e0:	89 e5                	mov    %esp,%ebp
+  8025e2:	57                   	push   %edi
+  8025e3:	56                   	push   %esi
+  8025e4:	53                   	push   %ebx
+  8025e5:	83 ec 18             	sub    $0x18,%esp
+  8025e8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8025ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8025f1:	57                   	push   %edi
+  8025f2:	e8 d6 e1 ff ff       	call   8007cd <strlen>
+  8025f7:	83 c4 10             	add    $0x10,%esp
+  8025fa:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025ff:	7f 4c                	jg     80264d <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802601:	83 ec 08             	sub    $0x8,%esp
+  802604:	57                   	push   %edi
+  802605:	68 00 60 c0 00       	push   $0xc06000
+  80260a:	e8 f9 e1 ff ff       	call   800808 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  80260f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802614:	b8 10 00 00 00       	mov    $0x10,%eax
+  802619:	e8 ac f1 ff ff       	call   8017ca <fsipc>
+  80261e:	83 c4 10             	add    $0x10,%esp
+  802621:	85 c0                	test   %eax,%eax
+  802623:	78 20                	js     802645 <defrag+0x66>
+		return r;
+	if (before)
+  802625:	85 f6                	test   %esi,%esi
+  802627:	74 07                	je     802630 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802629:	a1 00 60 c0 00       	mov    0xc06000,%eax
+  80262e:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802630:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802635:	85 db                	test   %ebx,%ebx
+  802637:	74 0c                	je     802645 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802639:	a1 04 60 c0 00       	mov    0xc06004,%eax
+  80263e:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802640:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802645:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802648:	5b                   	pop    %ebx
+  802649:	5e                   	pop    %esi
+  80264a:	5f                   	pop    %edi
+  80264b:	5d                   	pop    %ebp
+  80264c:	c3                   	ret
+		return -E_BAD_PATH;
+  80264d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802652:	eb f1                	jmp    802645 <defrag+0x66>
+
+00802654 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802654:	55                   	push   %ebp
+  802655:	89 e5                	mov    %esp,%ebp
+  802657:	53                   	push   %ebx
+  802658:	83 ec 04             	sub    $0x4,%esp
+  80265b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  80265e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802663:	b8 11 00 00 00       	mov    $0x11,%eax
+  802668:	e8 5d f1 ff ff       	call   8017ca <fsipc>
+  80266d:	85 c0                	test   %eax,%eax
+  80266f:	78 34                	js     8026a5 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802671:	a1 00 60 c0 00       	mov    0xc06000,%eax
+  802676:	89 03                	mov    %eax,(%ebx)
+  802678:	a1 04 60 c0 00       	mov    0xc06004,%eax
+  80267d:	89 43 04             	mov    %eax,0x4(%ebx)
+  802680:	a1 08 60 c0 00       	mov    0xc06008,%eax
+  802685:	89 43 08             	mov    %eax,0x8(%ebx)
+  802688:	a1 0c 60 c0 00       	mov    0xc0600c,%eax
+  80268d:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802690:	a1 10 60 c0 00       	mov    0xc06010,%eax
+  802695:	89 43 10             	mov    %eax,0x10(%ebx)
+  802698:	a1 14 60 c0 00       	mov    0xc06014,%eax
+  80269d:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  8026a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026a8:	c9                   	leave
+  8026a9:	c3                   	ret
+
+008026aa <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026aa:	55                   	push   %ebp
+  8026ab:	89 e5                	mov    %esp,%ebp
+  8026ad:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8026b0:	68 16 3d 80 00       	push   $0x803d16
+  8026b5:	ff 75 0c             	push   0xc(%ebp)
+  8026b8:	e8 4b e1 ff ff       	call   800808 <strcpy>
+	return 0;
+}
+  8026bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026c2:	c9                   	leave
+  8026c3:	c3                   	ret
+
+008026c4 <devsock_close>:
+{
+  8026c4:	55                   	push   %ebp
+  8026c5:	89 e5                	mov    %esp,%ebp
+  8026c7:	53                   	push   %ebx
+  8026c8:	83 ec 10             	sub    $0x10,%esp
+  8026cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8026ce:	53                   	push   %ebx
+  8026cf:	e8 f4 0d 00 00       	call   8034c8 <pageref>
+  8026d4:	89 c2                	mov    %eax,%edx
+  8026d6:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8026d9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8026de:	83 fa 01             	cmp    $0x1,%edx
+  8026e1:	74 05                	je     8026e8 <devsock_close+0x24>
+}
+  8026e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026e6:	c9                   	leave
+  8026e7:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8026e8:	83 ec 0c             	sub    $0xc,%esp
+  8026eb:	ff 73 0c             	push   0xc(%ebx)
+  8026ee:	e8 b7 02 00 00       	call   8029aa <nsipc_close>
+  8026f3:	83 c4 10             	add    $0x10,%esp
+  8026f6:	eb eb                	jmp    8026e3 <devsock_close+0x1f>
+
+008026f8 <devsock_write>:
+{
+  8026f8:	55                   	push   %ebp
+  8026f9:	89 e5                	mov    %esp,%ebp
+  8026fb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8026fe:	6a 00                	push   $0x0
+  802700:	ff 75 10             	push   0x10(%ebp)
+  802703:	ff 75 0c             	push   0xc(%ebp)
+  802706:	8b 45 08             	mov    0x8(%ebp),%eax
+  802709:	ff 70 0c             	push   0xc(%eax)
+  80270c:	e8 79 03 00 00       	call   802a8a <nsipc_send>
+}
+  802711:	c9                   	leave
+  802712:	c3                   	ret
+
+00802713 <devsock_read>:
+{
+  802713:	55                   	push   %ebp
+  802714:	89 e5                	mov    %esp,%ebp
+  802716:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802719:	6a 00                	push   $0x0
+  80271b:	ff 75 10             	push   0x10(%ebp)
+  80271e:	ff 75 0c             	push   0xc(%ebp)
+  802721:	8b 45 08             	mov    0x8(%ebp),%eax
+  802724:	ff 70 0c             	push   0xc(%eax)
+  802727:	e8 ef 02 00 00       	call   802a1b <nsipc_recv>
+}
+  80272c:	c9                   	leave
+  80272d:	c3                   	ret
+
+0080272e <fd2sockid>:
+{
+  80272e:	55                   	push   %ebp
+  80272f:	89 e5                	mov    %esp,%ebp
+  802731:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802734:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802737:	52                   	push   %edx
+  802738:	50                   	push   %eax
+  802739:	e8 54 e9 ff ff       	call   801092 <fd_lookup>
+  80273e:	83 c4 10             	add    $0x10,%esp
+  802741:	85 c0                	test   %eax,%eax
+  802743:	78 10                	js     802755 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802745:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802748:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  80274e:	39 08                	cmp    %ecx,(%eax)
+  802750:	75 05                	jne    802757 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802752:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802755:	c9                   	leave
+  802756:	c3                   	ret
+		return -E_NOT_SUPP;
+  802757:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80275c:	eb f7                	jmp    802755 <fd2sockid+0x27>
+
+0080275e <alloc_sockfd>:
+{
+  80275e:	55                   	push   %ebp
+  80275f:	89 e5                	mov    %esp,%ebp
+  802761:	56                   	push   %esi
+  802762:	53                   	push   %ebx
+  802763:	83 ec 1c             	sub    $0x1c,%esp
+  802766:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802768:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80276b:	50                   	push   %eax
+  80276c:	e8 cb e8 ff ff       	call   80103c <fd_alloc>
+  802771:	89 c3                	mov    %eax,%ebx
+  802773:	83 c4 10             	add    $0x10,%esp
+  802776:	85 c0                	test   %eax,%eax
+  802778:	78 43                	js     8027bd <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80277a:	83 ec 04             	sub    $0x4,%esp
+  80277d:	68 07 04 00 00       	push   $0x407
+  802782:	ff 75 f4             	push   -0xc(%ebp)
+  802785:	6a 00                	push   $0x0
+  802787:	e8 88 e4 ff ff       	call   800c14 <sys_page_alloc>
+  80278c:	89 c3                	mov    %eax,%ebx
+  80278e:	83 c4 10             	add    $0x10,%esp
+  802791:	85 c0                	test   %eax,%eax
+  802793:	78 28                	js     8027bd <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802795:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802798:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  80279e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8027a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027a3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8027aa:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8027ad:	83 ec 0c             	sub    $0xc,%esp
+  8027b0:	50                   	push   %eax
+  8027b1:	e8 5f e8 ff ff       	call   801015 <fd2num>
+  8027b6:	89 c3                	mov    %eax,%ebx
+  8027b8:	83 c4 10             	add    $0x10,%esp
+  8027bb:	eb 0c                	jmp    8027c9 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8027bd:	83 ec 0c             	sub    $0xc,%esp
+  8027c0:	56                   	push   %esi
+  8027c1:	e8 e4 01 00 00       	call   8029aa <nsipc_close>
+		return r;
+  8027c6:	83 c4 10             	add    $0x10,%esp
+}
+  8027c9:	89 d8                	mov    %ebx,%eax
+  8027cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ce:	5b                   	pop    %ebx
+  8027cf:	5e                   	pop    %esi
+  8027d0:	5d                   	pop    %ebp
+  8027d1:	c3                   	ret
+
+008027d2 <accept>:
+{
+  8027d2:	55                   	push   %ebp
+  8027d3:	89 e5                	mov    %esp,%ebp
+  8027d5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027db:	e8 4e ff ff ff       	call   80272e <fd2sockid>
+  8027e0:	85 c0                	test   %eax,%eax
+  8027e2:	78 1b                	js     8027ff <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8027e4:	83 ec 04             	sub    $0x4,%esp
+  8027e7:	ff 75 10             	push   0x10(%ebp)
+  8027ea:	ff 75 0c             	push   0xc(%ebp)
+  8027ed:	50                   	push   %eax
+  8027ee:	e8 0e 01 00 00       	call   802901 <nsipc_accept>
+  8027f3:	83 c4 10             	add    $0x10,%esp
+  8027f6:	85 c0                	test   %eax,%eax
+  8027f8:	78 05                	js     8027ff <accept+0x2d>
+	return alloc_sockfd(r);
+  8027fa:	e8 5f ff ff ff       	call   80275e <alloc_sockfd>
+}
+  8027ff:	c9                   	leave
+  802800:	c3                   	ret
+
+00802801 <bind>:
+{
+  802801:	55                   	push   %ebp
+  802802:	89 e5                	mov    %esp,%ebp
+  802804:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802807:	8b 45 08             	mov    0x8(%ebp),%eax
+  80280a:	e8 1f ff ff ff       	call   80272e <fd2sockid>
+  80280f:	85 c0                	test   %eax,%eax
+  802811:	78 12                	js     802825 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802813:	83 ec 04             	sub    $0x4,%esp
+  802816:	ff 75 10             	push   0x10(%ebp)
+  802819:	ff 75 0c             	push   0xc(%ebp)
+  80281c:	50                   	push   %eax
+  80281d:	e8 31 01 00 00       	call   802953 <nsipc_bind>
+  802822:	83 c4 10             	add    $0x10,%esp
+}
+  802825:	c9                   	leave
+  802826:	c3                   	ret
+
+00802827 <shutdown>:
+{
+  802827:	55                   	push   %ebp
+  802828:	89 e5                	mov    %esp,%ebp
+  80282a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80282d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802830:	e8 f9 fe ff ff       	call   80272e <fd2sockid>
+  802835:	85 c0                	test   %eax,%eax
+  802837:	78 0f                	js     802848 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802839:	83 ec 08             	sub    $0x8,%esp
+  80283c:	ff 75 0c             	push   0xc(%ebp)
+  80283f:	50                   	push   %eax
+  802840:	e8 43 01 00 00       	call   802988 <nsipc_shutdown>
+  802845:	83 c4 10             	add    $0x10,%esp
+}
+  802848:	c9                   	leave
+  802849:	c3                   	ret
+
+0080284a <connect>:
+{
+  80284a:	55                   	push   %ebp
+  80284b:	89 e5                	mov    %esp,%ebp
+  80284d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802850:	8b 45 08             	mov    0x8(%ebp),%eax
+  802853:	e8 d6 fe ff ff       	call   80272e <fd2sockid>
+  802858:	85 c0                	test   %eax,%eax
+  80285a:	78 12                	js     80286e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80285c:	83 ec 04             	sub    $0x4,%esp
+  80285f:	ff 75 10             	push   0x10(%ebp)
+  802862:	ff 75 0c             	push   0xc(%ebp)
+  802865:	50                   	push   %eax
+  802866:	e8 59 01 00 00       	call   8029c4 <nsipc_connect>
+  80286b:	83 c4 10             	add    $0x10,%esp
+}
+  80286e:	c9                   	leave
+  80286f:	c3                   	ret
+
+00802870 <listen>:
+{
+  802870:	55                   	push   %ebp
+  802871:	89 e5                	mov    %esp,%ebp
+  802873:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802876:	8b 45 08             	mov    0x8(%ebp),%eax
+  802879:	e8 b0 fe ff ff       	call   80272e <fd2sockid>
+  80287e:	85 c0                	test   %eax,%eax
+  802880:	78 0f                	js     802891 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802882:	83 ec 08             	sub    $0x8,%esp
+  802885:	ff 75 0c             	push   0xc(%ebp)
+  802888:	50                   	push   %eax
+  802889:	e8 6b 01 00 00       	call   8029f9 <nsipc_listen>
+  80288e:	83 c4 10             	add    $0x10,%esp
+}
+  802891:	c9                   	leave
+  802892:	c3                   	ret
+
+00802893 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802893:	55                   	push   %ebp
+  802894:	89 e5                	mov    %esp,%ebp
+  802896:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802899:	ff 75 10             	push   0x10(%ebp)
+  80289c:	ff 75 0c             	push   0xc(%ebp)
+  80289f:	ff 75 08             	push   0x8(%ebp)
+  8028a2:	e8 41 02 00 00       	call   802ae8 <nsipc_socket>
+  8028a7:	83 c4 10             	add    $0x10,%esp
+  8028aa:	85 c0                	test   %eax,%eax
+  8028ac:	78 05                	js     8028b3 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8028ae:	e8 ab fe ff ff       	call   80275e <alloc_sockfd>
+}
+  8028b3:	c9                   	leave
+  8028b4:	c3                   	ret
+
+008028b5 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8028b5:	55                   	push   %ebp
+  8028b6:	89 e5                	mov    %esp,%ebp
+  8028b8:	53                   	push   %ebx
+  8028b9:	83 ec 04             	sub    $0x4,%esp
+  8028bc:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8028be:	83 3d 00 90 c0 00 00 	cmpl   $0x0,0xc09000
+  8028c5:	74 26                	je     8028ed <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8028c7:	6a 07                	push   $0x7
+  8028c9:	68 00 80 c0 00       	push   $0xc08000
+  8028ce:	53                   	push   %ebx
+  8028cf:	ff 35 00 90 c0 00    	push   0xc09000
+  8028d5:	e8 76 0a 00 00       	call   803350 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8028da:	83 c4 0c             	add    $0xc,%esp
+  8028dd:	6a 00                	push   $0x0
+  8028df:	6a 00                	push   $0x0
+  8028e1:	6a 00                	push   $0x0
+  8028e3:	e8 fd 09 00 00       	call   8032e5 <ipc_recv>
+}
+  8028e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028eb:	c9                   	leave
+  8028ec:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8028ed:	83 ec 0c             	sub    $0xc,%esp
+  8028f0:	6a 02                	push   $0x2
+  8028f2:	e8 92 0b 00 00       	call   803489 <ipc_find_env>
+  8028f7:	a3 00 90 c0 00       	mov    %eax,0xc09000
+  8028fc:	83 c4 10             	add    $0x10,%esp
+  8028ff:	eb c6                	jmp    8028c7 <nsipc+0x12>
+
+00802901 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802901:	55                   	push   %ebp
+  802902:	89 e5                	mov    %esp,%ebp
+  802904:	56                   	push   %esi
+  802905:	53                   	push   %ebx
+  802906:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802909:	8b 45 08             	mov    0x8(%ebp),%eax
+  80290c:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802911:	8b 06                	mov    (%esi),%eax
+  802913:	a3 04 80 c0 00       	mov    %eax,0xc08004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802918:	b8 01 00 00 00       	mov    $0x1,%eax
+  80291d:	e8 93 ff ff ff       	call   8028b5 <nsipc>
+  802922:	89 c3                	mov    %eax,%ebx
+  802924:	85 c0                	test   %eax,%eax
+  802926:	79 09                	jns    802931 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802928:	89 d8                	mov    %ebx,%eax
+  80292a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80292d:	5b                   	pop    %ebx
+  80292e:	5e                   	pop    %esi
+  80292f:	5d                   	pop    %ebp
+  802930:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802931:	83 ec 04             	sub    $0x4,%esp
+  802934:	ff 35 10 80 c0 00    	push   0xc08010
+  80293a:	68 00 80 c0 00       	push   $0xc08000
+  80293f:	ff 75 0c             	push   0xc(%ebp)
+  802942:	e8 47 e0 ff ff       	call   80098e <memmove>
+		*addrlen = ret->ret_addrlen;
+  802947:	a1 10 80 c0 00       	mov    0xc08010,%eax
+  80294c:	89 06                	mov    %eax,(%esi)
+  80294e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802951:	eb d5                	jmp    802928 <nsipc_accept+0x27>
+
+00802953 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802953:	55                   	push   %ebp
+  802954:	89 e5                	mov    %esp,%ebp
+  802956:	53                   	push   %ebx
+  802957:	83 ec 08             	sub    $0x8,%esp
+  80295a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80295d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802960:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802965:	53                   	push   %ebx
+  802966:	ff 75 0c             	push   0xc(%ebp)
+  802969:	68 04 80 c0 00       	push   $0xc08004
+  80296e:	e8 1b e0 ff ff       	call   80098e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802973:	89 1d 14 80 c0 00    	mov    %ebx,0xc08014
+	return nsipc(NSREQ_BIND);
+  802979:	b8 02 00 00 00       	mov    $0x2,%eax
+  80297e:	e8 32 ff ff ff       	call   8028b5 <nsipc>
+}
+  802983:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802986:	c9                   	leave
+  802987:	c3                   	ret
+
+00802988 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802988:	55                   	push   %ebp
+  802989:	89 e5                	mov    %esp,%ebp
+  80298b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80298e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802991:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.shutdown.req_how = how;
+  802996:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802999:	a3 04 80 c0 00       	mov    %eax,0xc08004
+	return nsipc(NSREQ_SHUTDOWN);
+  80299e:	b8 03 00 00 00       	mov    $0x3,%eax
+  8029a3:	e8 0d ff ff ff       	call   8028b5 <nsipc>
+}
+  8029a8:	c9                   	leave
+  8029a9:	c3                   	ret
+
+008029aa <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8029aa:	55                   	push   %ebp
+  8029ab:	89 e5                	mov    %esp,%ebp
+  8029ad:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8029b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b3:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	return nsipc(NSREQ_CLOSE);
+  8029b8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8029bd:	e8 f3 fe ff ff       	call   8028b5 <nsipc>
+}
+  8029c2:	c9                   	leave
+  8029c3:	c3                   	ret
+
+008029c4 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8029c4:	55                   	push   %ebp
+  8029c5:	89 e5                	mov    %esp,%ebp
+  8029c7:	53                   	push   %ebx
+  8029c8:	83 ec 08             	sub    $0x8,%esp
+  8029cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8029ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029d1:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8029d6:	53                   	push   %ebx
+  8029d7:	ff 75 0c             	push   0xc(%ebp)
+  8029da:	68 04 80 c0 00       	push   $0xc08004
+  8029df:	e8 aa df ff ff       	call   80098e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8029e4:	89 1d 14 80 c0 00    	mov    %ebx,0xc08014
+	return nsipc(NSREQ_CONNECT);
+  8029ea:	b8 05 00 00 00       	mov    $0x5,%eax
+  8029ef:	e8 c1 fe ff ff       	call   8028b5 <nsipc>
+}
+  8029f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029f7:	c9                   	leave
+  8029f8:	c3                   	ret
+
+008029f9 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8029f9:	55                   	push   %ebp
+  8029fa:	89 e5                	mov    %esp,%ebp
+  8029fc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8029ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a02:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.listen.req_backlog = backlog;
+  802a07:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a0a:	a3 04 80 c0 00       	mov    %eax,0xc08004
+	return nsipc(NSREQ_LISTEN);
+  802a0f:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a14:	e8 9c fe ff ff       	call   8028b5 <nsipc>
+}
+  802a19:	c9                   	leave
+  802a1a:	c3                   	ret
+
+00802a1b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802a1b:	55                   	push   %ebp
+  802a1c:	89 e5                	mov    %esp,%ebp
+  802a1e:	56                   	push   %esi
+  802a1f:	53                   	push   %ebx
+  802a20:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802a23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a26:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.recv.req_len = len;
+  802a2b:	89 35 04 80 c0 00    	mov    %esi,0xc08004
+	nsipcbuf.recv.req_flags = flags;
+  802a31:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a34:	a3 08 80 c0 00       	mov    %eax,0xc08008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802a39:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a3e:	e8 72 fe ff ff       	call   8028b5 <nsipc>
+  802a43:	89 c3                	mov    %eax,%ebx
+  802a45:	85 c0                	test   %eax,%eax
+  802a47:	78 22                	js     802a6b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802a49:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802a4e:	39 c6                	cmp    %eax,%esi
+  802a50:	0f 4e c6             	cmovle %esi,%eax
+  802a53:	39 c3                	cmp    %eax,%ebx
+  802a55:	7f 1d                	jg     802a74 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802a57:	83 ec 04             	sub    $0x4,%esp
+  802a5a:	53                   	push   %ebx
+  802a5b:	68 00 80 c0 00       	push   $0xc08000
+  802a60:	ff 75 0c             	push   0xc(%ebp)
+  802a63:	e8 26 df ff ff       	call   80098e <memmove>
+  802a68:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802a6b:	89 d8                	mov    %ebx,%eax
+  802a6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a70:	5b                   	pop    %ebx
+  802a71:	5e                   	pop    %esi
+  802a72:	5d                   	pop    %ebp
+  802a73:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802a74:	68 22 3d 80 00       	push   $0x803d22
+  802a79:	68 c0 3c 80 00       	push   $0x803cc0
+  802a7e:	6a 62                	push   $0x62
+  802a80:	68 37 3d 80 00       	push   $0x803d37
+  802a85:	e8 b5 d6 ff ff       	call   80013f <_panic>
+
+00802a8a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802a8a:	55                   	push   %ebp
+  802a8b:	89 e5                	mov    %esp,%ebp
+  802a8d:	53                   	push   %ebx
+  802a8e:	83 ec 04             	sub    $0x4,%esp
+  802a91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802a94:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a97:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	assert(size < 1600);
+  802a9c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802aa2:	7f 2e                	jg     802ad2 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802aa4:	83 ec 04             	sub    $0x4,%esp
+  802aa7:	53                   	push   %ebx
+  802aa8:	ff 75 0c             	push   0xc(%ebp)
+  802aab:	68 0c 80 c0 00       	push   $0xc0800c
+  802ab0:	e8 d9 de ff ff       	call   80098e <memmove>
+	nsipcbuf.send.req_size = size;
+  802ab5:	89 1d 04 80 c0 00    	mov    %ebx,0xc08004
+	nsipcbuf.send.req_flags = flags;
+  802abb:	8b 45 14             	mov    0x14(%ebp),%eax
+  802abe:	a3 08 80 c0 00       	mov    %eax,0xc08008
+	return nsipc(NSREQ_SEND);
+  802ac3:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ac8:	e8 e8 fd ff ff       	call   8028b5 <nsipc>
+}
+  802acd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ad0:	c9                   	leave
+  802ad1:	c3                   	ret
+	assert(size < 1600);
+  802ad2:	68 43 3d 80 00       	push   $0x803d43
+  802ad7:	68 c0 3c 80 00       	push   $0x803cc0
+  802adc:	6a 6d                	push   $0x6d
+  802ade:	68 37 3d 80 00       	push   $0x803d37
+  802ae3:	e8 57 d6 ff ff       	call   80013f <_panic>
+
+00802ae8 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802ae8:	55                   	push   %ebp
+  802ae9:	89 e5                	mov    %esp,%ebp
+  802aeb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802aee:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af1:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.socket.req_type = type;
+  802af6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802af9:	a3 04 80 c0 00       	mov    %eax,0xc08004
+	nsipcbuf.socket.req_protocol = protocol;
+  802afe:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b01:	a3 08 80 c0 00       	mov    %eax,0xc08008
+	return nsipc(NSREQ_SOCKET);
+  802b06:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b0b:	e8 a5 fd ff ff       	call   8028b5 <nsipc>
+}
+  802b10:	c9                   	leave
+  802b11:	c3                   	ret
+
+00802b12 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b12:	55                   	push   %ebp
+  802b13:	89 e5                	mov    %esp,%ebp
+  802b15:	56                   	push   %esi
+  802b16:	53                   	push   %ebx
+  802b17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802b1a:	83 ec 0c             	sub    $0xc,%esp
+  802b1d:	ff 75 08             	push   0x8(%ebp)
+  802b20:	e8 00 e5 ff ff       	call   801025 <fd2data>
+  802b25:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802b27:	83 c4 08             	add    $0x8,%esp
+  802b2a:	68 4f 3d 80 00       	push   $0x803d4f
+  802b2f:	53                   	push   %ebx
+  802b30:	e8 d3 dc ff ff       	call   800808 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802b35:	8b 46 04             	mov    0x4(%esi),%eax
+  802b38:	2b 06                	sub    (%esi),%eax
+  802b3a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802b40:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802b47:	00 00 00 
+	stat->st_dev = &devpipe;
+  802b4a:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802b51:	40 80 00 
+	return 0;
+}
+  802b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b5c:	5b                   	pop    %ebx
+  802b5d:	5e                   	pop    %esi
+  802b5e:	5d                   	pop    %ebp
+  802b5f:	c3                   	ret
+
+00802b60 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802b60:	55                   	push   %ebp
+  802b61:	89 e5                	mov    %esp,%ebp
+  802b63:	53                   	push   %ebx
+  802b64:	83 ec 0c             	sub    $0xc,%esp
+  802b67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802b6a:	53                   	push   %ebx
+  802b6b:	6a 00                	push   $0x0
+  802b6d:	e8 2f e1 ff ff       	call   800ca1 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802b72:	89 1c 24             	mov    %ebx,(%esp)
+  802b75:	e8 ab e4 ff ff       	call   801025 <fd2data>
+  802b7a:	83 c4 08             	add    $0x8,%esp
+  802b7d:	50                   	push   %eax
+  802b7e:	6a 00                	push   $0x0
+  802b80:	e8 1c e1 ff ff       	call   800ca1 <sys_page_unmap>
+}
+  802b85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b88:	c9                   	leave
+  802b89:	c3                   	ret
+
+00802b8a <_pipeisclosed>:
+{
+  802b8a:	55                   	push   %ebp
+  802b8b:	89 e5                	mov    %esp,%ebp
+  802b8d:	57                   	push   %edi
+  802b8e:	56                   	push   %esi
+  802b8f:	53                   	push   %ebx
+  802b90:	83 ec 1c             	sub    $0x1c,%esp
+  802b93:	89 c7                	mov    %eax,%edi
+  802b95:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802b97:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  802b9c:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802b9f:	83 ec 0c             	sub    $0xc,%esp
+  802ba2:	57                   	push   %edi
+  802ba3:	e8 20 09 00 00       	call   8034c8 <pageref>
+  802ba8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802bab:	89 34 24             	mov    %esi,(%esp)
+  802bae:	e8 15 09 00 00       	call   8034c8 <pageref>
+		nn = thisenv->env_runs;
+  802bb3:	8b 15 00 50 c0 00    	mov    0xc05000,%edx
+  802bb9:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802bbc:	83 c4 10             	add    $0x10,%esp
+  802bbf:	39 cb                	cmp    %ecx,%ebx
+  802bc1:	74 1b                	je     802bde <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802bc3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802bc6:	75 cf                	jne    802b97 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802bc8:	8b 42 58             	mov    0x58(%edx),%eax
+  802bcb:	6a 01                	push   $0x1
+  802bcd:	50                   	push   %eax
+  802bce:	53                   	push   %ebx
+  802bcf:	68 56 3d 80 00       	push   $0x803d56
+  802bd4:	e8 41 d6 ff ff       	call   80021a <cprintf>
+  802bd9:	83 c4 10             	add    $0x10,%esp
+  802bdc:	eb b9                	jmp    802b97 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802bde:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802be1:	0f 94 c0             	sete   %al
+  802be4:	0f b6 c0             	movzbl %al,%eax
+}
+  802be7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bea:	5b                   	pop    %ebx
+  802beb:	5e                   	pop    %esi
+  802bec:	5f                   	pop    %edi
+  802bed:	5d                   	pop    %ebp
+  802bee:	c3                   	ret
+
+00802bef <devpipe_write>:
+{
+  802bef:	55                   	push   %ebp
+  802bf0:	89 e5                	mov    %esp,%ebp
+  802bf2:	57                   	push   %edi
+  802bf3:	56                   	push   %esi
+  802bf4:	53                   	push   %ebx
+  802bf5:	83 ec 28             	sub    $0x28,%esp
+  802bf8:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802bfb:	56                   	push   %esi
+  802bfc:	e8 24 e4 ff ff       	call   801025 <fd2data>
+  802c01:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802c03:	83 c4 10             	add    $0x10,%esp
+  802c06:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c0b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802c0e:	75 09                	jne    802c19 <devpipe_write+0x2a>
+	return i;
+  802c10:	89 f8                	mov    %edi,%eax
+  802c12:	eb 23                	jmp    802c37 <devpipe_write+0x48>
+			sys_yield();
+  802c14:	e8 dc df ff ff       	call   800bf5 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802c19:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c1c:	8b 0b                	mov    (%ebx),%ecx
+  802c1e:	8d 51 20             	lea    0x20(%ecx),%edx
+  802c21:	39 d0                	cmp    %edx,%eax
+  802c23:	72 1a                	jb     802c3f <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802c25:	89 da                	mov    %ebx,%edx
+  802c27:	89 f0                	mov    %esi,%eax
+  802c29:	e8 5c ff ff ff       	call   802b8a <_pipeisclosed>
+  802c2e:	85 c0                	test   %eax,%eax
+  802c30:	74 e2                	je     802c14 <devpipe_write+0x25>
+				return 0;
+  802c32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c3a:	5b                   	pop    %ebx
+  802c3b:	5e                   	pop    %esi
+  802c3c:	5f                   	pop    %edi
+  802c3d:	5d                   	pop    %ebp
+  802c3e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802c3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c42:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802c46:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802c49:	89 c2                	mov    %eax,%edx
+  802c4b:	c1 fa 1f             	sar    $0x1f,%edx
+  802c4e:	89 d1                	mov    %edx,%ecx
+  802c50:	c1 e9 1b             	shr    $0x1b,%ecx
+  802c53:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802c56:	83 e2 1f             	and    $0x1f,%edx
+  802c59:	29 ca                	sub    %ecx,%edx
+  802c5b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802c5f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802c63:	83 c0 01             	add    $0x1,%eax
+  802c66:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802c69:	83 c7 01             	add    $0x1,%edi
+  802c6c:	eb 9d                	jmp    802c0b <devpipe_write+0x1c>
+
+00802c6e <devpipe_read>:
+{
+  802c6e:	55                   	push   %ebp
+  802c6f:	89 e5                	mov    %esp,%ebp
+  802c71:	57                   	push   %edi
+  802c72:	56                   	push   %esi
+  802c73:	53                   	push   %ebx
+  802c74:	83 ec 18             	sub    $0x18,%esp
+  802c77:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802c7a:	57                   	push   %edi
+  802c7b:	e8 a5 e3 ff ff       	call   801025 <fd2data>
+  802c80:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802c82:	83 c4 10             	add    $0x10,%esp
+  802c85:	be 00 00 00 00       	mov    $0x0,%esi
+  802c8a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c8d:	75 13                	jne    802ca2 <devpipe_read+0x34>
+	return i;
+  802c8f:	89 f0                	mov    %esi,%eax
+  802c91:	eb 02                	jmp    802c95 <devpipe_read+0x27>
+				return i;
+  802c93:	89 f0                	mov    %esi,%eax
+}
+  802c95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c98:	5b                   	pop    %ebx
+  802c99:	5e                   	pop    %esi
+  802c9a:	5f                   	pop    %edi
+  802c9b:	5d                   	pop    %ebp
+  802c9c:	c3                   	ret
+			sys_yield();
+  802c9d:	e8 53 df ff ff       	call   800bf5 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802ca2:	8b 03                	mov    (%ebx),%eax
+  802ca4:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802ca7:	75 18                	jne    802cc1 <devpipe_read+0x53>
+			if (i > 0)
+  802ca9:	85 f6                	test   %esi,%esi
+  802cab:	75 e6                	jne    802c93 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802cad:	89 da                	mov    %ebx,%edx
+  802caf:	89 f8                	mov    %edi,%eax
+  802cb1:	e8 d4 fe ff ff       	call   802b8a <_pipeisclosed>
+  802cb6:	85 c0                	test   %eax,%eax
+  802cb8:	74 e3                	je     802c9d <devpipe_read+0x2f>
+				return 0;
+  802cba:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbf:	eb d4                	jmp    802c95 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802cc1:	99                   	cltd
+  802cc2:	c1 ea 1b             	shr    $0x1b,%edx
+  802cc5:	01 d0                	add    %edx,%eax
+  802cc7:	83 e0 1f             	and    $0x1f,%eax
+  802cca:	29 d0                	sub    %edx,%eax
+  802ccc:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802cd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cd4:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802cd7:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802cda:	83 c6 01             	add    $0x1,%esi
+  802cdd:	eb ab                	jmp    802c8a <devpipe_read+0x1c>
+
+00802cdf <pipe>:
+{
+  802cdf:	55                   	push   %ebp
+  802ce0:	89 e5                	mov    %esp,%ebp
+  802ce2:	56                   	push   %esi
+  802ce3:	53                   	push   %ebx
+  802ce4:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802ce7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cea:	50                   	push   %eax
+  802ceb:	e8 4c e3 ff ff       	call   80103c <fd_alloc>
+  802cf0:	89 c3                	mov    %eax,%ebx
+  802cf2:	83 c4 10             	add    $0x10,%esp
+  802cf5:	85 c0                	test   %eax,%eax
+  802cf7:	0f 88 23 01 00 00    	js     802e20 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cfd:	83 ec 04             	sub    $0x4,%esp
+  802d00:	68 07 04 00 00       	push   $0x407
+  802d05:	ff 75 f4             	push   -0xc(%ebp)
+  802d08:	6a 00                	push   $0x0
+  802d0a:	e8 05 df ff ff       	call   800c14 <sys_page_alloc>
+  802d0f:	89 c3                	mov    %eax,%ebx
+  802d11:	83 c4 10             	add    $0x10,%esp
+  802d14:	85 c0                	test   %eax,%eax
+  802d16:	0f 88 04 01 00 00    	js     802e20 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802d1c:	83 ec 0c             	sub    $0xc,%esp
+  802d1f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802d22:	50                   	push   %eax
+  802d23:	e8 14 e3 ff ff       	call   80103c <fd_alloc>
+  802d28:	89 c3                	mov    %eax,%ebx
+  802d2a:	83 c4 10             	add    $0x10,%esp
+  802d2d:	85 c0                	test   %eax,%eax
+  802d2f:	0f 88 db 00 00 00    	js     802e10 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d35:	83 ec 04             	sub    $0x4,%esp
+  802d38:	68 07 04 00 00       	push   $0x407
+  802d3d:	ff 75 f0             	push   -0x10(%ebp)
+  802d40:	6a 00                	push   $0x0
+  802d42:	e8 cd de ff ff       	call   800c14 <sys_page_alloc>
+  802d47:	89 c3                	mov    %eax,%ebx
+  802d49:	83 c4 10             	add    $0x10,%esp
+  802d4c:	85 c0                	test   %eax,%eax
+  802d4e:	0f 88 bc 00 00 00    	js     802e10 <pipe+0x131>
+	va = fd2data(fd0);
+  802d54:	83 ec 0c             	sub    $0xc,%esp
+  802d57:	ff 75 f4             	push   -0xc(%ebp)
+  802d5a:	e8 c6 e2 ff ff       	call   801025 <fd2data>
+  802d5f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d61:	83 c4 0c             	add    $0xc,%esp
+  802d64:	68 07 04 00 00       	push   $0x407
+  802d69:	50                   	push   %eax
+  802d6a:	6a 00                	push   $0x0
+  802d6c:	e8 a3 de ff ff       	call   800c14 <sys_page_alloc>
+  802d71:	89 c3                	mov    %eax,%ebx
+  802d73:	83 c4 10             	add    $0x10,%esp
+  802d76:	85 c0                	test   %eax,%eax
+  802d78:	0f 88 82 00 00 00    	js     802e00 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d7e:	83 ec 0c             	sub    $0xc,%esp
+  802d81:	ff 75 f0             	push   -0x10(%ebp)
+  802d84:	e8 9c e2 ff ff       	call   801025 <fd2data>
+  802d89:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802d90:	50                   	push   %eax
+  802d91:	6a 00                	push   $0x0
+  802d93:	56                   	push   %esi
+  802d94:	6a 00                	push   $0x0
+  802d96:	e8 c4 de ff ff       	call   800c5f <sys_page_map>
+  802d9b:	89 c3                	mov    %eax,%ebx
+  802d9d:	83 c4 20             	add    $0x20,%esp
+  802da0:	85 c0                	test   %eax,%eax
+  802da2:	78 4e                	js     802df2 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802da4:	a1 60 40 80 00       	mov    0x804060,%eax
+  802da9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802dac:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802dae:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802db1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802db8:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802dbb:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802dbd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802dc0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802dc7:	83 ec 0c             	sub    $0xc,%esp
+  802dca:	ff 75 f4             	push   -0xc(%ebp)
+  802dcd:	e8 43 e2 ff ff       	call   801015 <fd2num>
+  802dd2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802dd5:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802dd7:	83 c4 04             	add    $0x4,%esp
+  802dda:	ff 75 f0             	push   -0x10(%ebp)
+  802ddd:	e8 33 e2 ff ff       	call   801015 <fd2num>
+  802de2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802de5:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802de8:	83 c4 10             	add    $0x10,%esp
+  802deb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802df0:	eb 2e                	jmp    802e20 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802df2:	83 ec 08             	sub    $0x8,%esp
+  802df5:	56                   	push   %esi
+  802df6:	6a 00                	push   $0x0
+  802df8:	e8 a4 de ff ff       	call   800ca1 <sys_page_unmap>
+  802dfd:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802e00:	83 ec 08             	sub    $0x8,%esp
+  802e03:	ff 75 f0             	push   -0x10(%ebp)
+  802e06:	6a 00                	push   $0x0
+  802e08:	e8 94 de ff ff       	call   800ca1 <sys_page_unmap>
+  802e0d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802e10:	83 ec 08             	sub    $0x8,%esp
+  802e13:	ff 75 f4             	push   -0xc(%ebp)
+  802e16:	6a 00                	push   $0x0
+  802e18:	e8 84 de ff ff       	call   800ca1 <sys_page_unmap>
+  802e1d:	83 c4 10             	add    $0x10,%esp
+}
+  802e20:	89 d8                	mov    %ebx,%eax
+  802e22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e25:	5b                   	pop    %ebx
+  802e26:	5e                   	pop    %esi
+  802e27:	5d                   	pop    %ebp
+  802e28:	c3                   	ret
+
+00802e29 <pipeisclosed>:
+{
+  802e29:	55                   	push   %ebp
+  802e2a:	89 e5                	mov    %esp,%ebp
+  802e2c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e32:	50                   	push   %eax
+  802e33:	ff 75 08             	push   0x8(%ebp)
+  802e36:	e8 57 e2 ff ff       	call   801092 <fd_lookup>
+  802e3b:	83 c4 10             	add    $0x10,%esp
+  802e3e:	85 c0                	test   %eax,%eax
+  802e40:	78 18                	js     802e5a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802e42:	83 ec 0c             	sub    $0xc,%esp
+  802e45:	ff 75 f4             	push   -0xc(%ebp)
+  802e48:	e8 d8 e1 ff ff       	call   801025 <fd2data>
+  802e4d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802e4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e52:	e8 33 fd ff ff       	call   802b8a <_pipeisclosed>
+  802e57:	83 c4 10             	add    $0x10,%esp
+}
+  802e5a:	c9                   	leave
+  802e5b:	c3                   	ret
+
+00802e5c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e61:	c3                   	ret
+
+00802e62 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e62:	55                   	push   %ebp
+  802e63:	89 e5                	mov    %esp,%ebp
+  802e65:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802e68:	68 6e 3d 80 00       	push   $0x803d6e
+  802e6d:	ff 75 0c             	push   0xc(%ebp)
+  802e70:	e8 93 d9 ff ff       	call   800808 <strcpy>
+	return 0;
+}
+  802e75:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e7a:	c9                   	leave
+  802e7b:	c3                   	ret
+
+00802e7c <devcons_write>:
+{
+  802e7c:	55                   	push   %ebp
+  802e7d:	89 e5                	mov    %esp,%ebp
+  802e7f:	57                   	push   %edi
+  802e80:	56                   	push   %esi
+  802e81:	53                   	push   %ebx
+  802e82:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802e88:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802e8d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802e93:	eb 2e                	jmp    802ec3 <devcons_write+0x47>
+		m = n - tot;
+  802e95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e98:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802e9a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802e9f:	39 c3                	cmp    %eax,%ebx
+  802ea1:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802ea4:	83 ec 04             	sub    $0x4,%esp
+  802ea7:	53                   	push   %ebx
+  802ea8:	89 f0                	mov    %esi,%eax
+  802eaa:	03 45 0c             	add    0xc(%ebp),%eax
+  802ead:	50                   	push   %eax
+  802eae:	57                   	push   %edi
+  802eaf:	e8 da da ff ff       	call   80098e <memmove>
+		sys_cputs(buf, m);
+  802eb4:	83 c4 08             	add    $0x8,%esp
+  802eb7:	53                   	push   %ebx
+  802eb8:	57                   	push   %edi
+  802eb9:	e8 7a dc ff ff       	call   800b38 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802ebe:	01 de                	add    %ebx,%esi
+  802ec0:	83 c4 10             	add    $0x10,%esp
+  802ec3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ec6:	72 cd                	jb     802e95 <devcons_write+0x19>
+}
+  802ec8:	89 f0                	mov    %esi,%eax
+  802eca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ecd:	5b                   	pop    %ebx
+  802ece:	5e                   	pop    %esi
+  802ecf:	5f                   	pop    %edi
+  802ed0:	5d                   	pop    %ebp
+  802ed1:	c3                   	ret
+
+00802ed2 <devcons_read>:
+{
+  802ed2:	55                   	push   %ebp
+  802ed3:	89 e5                	mov    %esp,%ebp
+  802ed5:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802edd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ee1:	75 07                	jne    802eea <devcons_read+0x18>
+  802ee3:	eb 1f                	jmp    802f04 <devcons_read+0x32>
+		sys_yield();
+  802ee5:	e8 0b dd ff ff       	call   800bf5 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802eea:	e8 6f dc ff ff       	call   800b5e <sys_cgetc>
+  802eef:	85 c0                	test   %eax,%eax
+  802ef1:	74 f2                	je     802ee5 <devcons_read+0x13>
+	if (c < 0)
+  802ef3:	78 0f                	js     802f04 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802ef5:	83 f8 04             	cmp    $0x4,%eax
+  802ef8:	74 0c                	je     802f06 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802efa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802efd:	88 02                	mov    %al,(%edx)
+	return 1;
+  802eff:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802f04:	c9                   	leave
+  802f05:	c3                   	ret
+		return 0;
+  802f06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0b:	eb f7                	jmp    802f04 <devcons_read+0x32>
+
+00802f0d <cputchar>:
+{
+  802f0d:	55                   	push   %ebp
+  802f0e:	89 e5                	mov    %esp,%ebp
+  802f10:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802f13:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f16:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802f19:	6a 01                	push   $0x1
+  802f1b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802f1e:	50                   	push   %eax
+  802f1f:	e8 14 dc ff ff       	call   800b38 <sys_cputs>
+}
+  802f24:	83 c4 10             	add    $0x10,%esp
+  802f27:	c9                   	leave
+  802f28:	c3                   	ret
+
+00802f29 <getchar>:
+{
+  802f29:	55                   	push   %ebp
+  802f2a:	89 e5                	mov    %esp,%ebp
+  802f2c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802f2f:	6a 01                	push   $0x1
+  802f31:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802f34:	50                   	push   %eax
+  802f35:	6a 00                	push   $0x0
+  802f37:	e8 bc e3 ff ff       	call   8012f8 <read>
+	if (r < 0)
+  802f3c:	83 c4 10             	add    $0x10,%esp
+  802f3f:	85 c0                	test   %eax,%eax
+  802f41:	78 06                	js     802f49 <getchar+0x20>
+	if (r < 1)
+  802f43:	74 06                	je     802f4b <getchar+0x22>
+	return c;
+  802f45:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802f49:	c9                   	leave
+  802f4a:	c3                   	ret
+		return -E_EOF;
+  802f4b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802f50:	eb f7                	jmp    802f49 <getchar+0x20>
+
+00802f52 <iscons>:
+{
+  802f52:	55                   	push   %ebp
+  802f53:	89 e5                	mov    %esp,%ebp
+  802f55:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f5b:	50                   	push   %eax
+  802f5c:	ff 75 08             	push   0x8(%ebp)
+  802f5f:	e8 2e e1 ff ff       	call   801092 <fd_lookup>
+  802f64:	83 c4 10             	add    $0x10,%esp
+  802f67:	85 c0                	test   %eax,%eax
+  802f69:	78 11                	js     802f7c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802f6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f6e:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802f74:	39 10                	cmp    %edx,(%eax)
+  802f76:	0f 94 c0             	sete   %al
+  802f79:	0f b6 c0             	movzbl %al,%eax
+}
+  802f7c:	c9                   	leave
+  802f7d:	c3                   	ret
+
+00802f7e <opencons>:
+{
+  802f7e:	55                   	push   %ebp
+  802f7f:	89 e5                	mov    %esp,%ebp
+  802f81:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802f84:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f87:	50                   	push   %eax
+  802f88:	e8 af e0 ff ff       	call   80103c <fd_alloc>
+  802f8d:	83 c4 10             	add    $0x10,%esp
+  802f90:	85 c0                	test   %eax,%eax
+  802f92:	78 3a                	js     802fce <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802f94:	83 ec 04             	sub    $0x4,%esp
+  802f97:	68 07 04 00 00       	push   $0x407
+  802f9c:	ff 75 f4             	push   -0xc(%ebp)
+  802f9f:	6a 00                	push   $0x0
+  802fa1:	e8 6e dc ff ff       	call   800c14 <sys_page_alloc>
+  802fa6:	83 c4 10             	add    $0x10,%esp
+  802fa9:	85 c0                	test   %eax,%eax
+  802fab:	78 21                	js     802fce <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802fad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fb0:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802fb6:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802fb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fbb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802fc2:	83 ec 0c             	sub    $0xc,%esp
+  802fc5:	50                   	push   %eax
+  802fc6:	e8 4a e0 ff ff       	call   801015 <fd2num>
+  802fcb:	83 c4 10             	add    $0x10,%esp
+}
+  802fce:	c9                   	leave
+  802fcf:	c3                   	ret
+
+00802fd0 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802fd0:	55                   	push   %ebp
+  802fd1:	89 e5                	mov    %esp,%ebp
+  802fd3:	57                   	push   %edi
+  802fd4:	56                   	push   %esi
+  802fd5:	53                   	push   %ebx
+  802fd6:	83 ec 20             	sub    $0x20,%esp
+  802fd9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802fdc:	89 d7                	mov    %edx,%edi
+  802fde:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802fe0:	51                   	push   %ecx
+  802fe1:	68 00 f0 7f 00       	push   $0x7ff000
+  802fe6:	6a 00                	push   $0x0
+  802fe8:	e8 27 dc ff ff       	call   800c14 <sys_page_alloc>
+  802fed:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802fef:	83 c4 10             	add    $0x10,%esp
+  802ff2:	85 c0                	test   %eax,%eax
+  802ff4:	78 45                	js     80303b <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802ff6:	83 ec 04             	sub    $0x4,%esp
+  802ff9:	68 00 10 00 00       	push   $0x1000
+  802ffe:	57                   	push   %edi
+  802fff:	68 00 f0 7f 00       	push   $0x7ff000
+  803004:	e8 85 d9 ff ff       	call   80098e <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  803009:	89 34 24             	mov    %esi,(%esp)
+  80300c:	57                   	push   %edi
+  80300d:	ff 75 e4             	push   -0x1c(%ebp)
+  803010:	68 00 f0 7f 00       	push   $0x7ff000
+  803015:	6a 00                	push   $0x0
+  803017:	e8 43 dc ff ff       	call   800c5f <sys_page_map>
+  80301c:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80301e:	83 c4 20             	add    $0x20,%esp
+  803021:	85 c0                	test   %eax,%eax
+  803023:	78 16                	js     80303b <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803025:	83 ec 08             	sub    $0x8,%esp
+  803028:	68 00 f0 7f 00       	push   $0x7ff000
+  80302d:	6a 00                	push   $0x0
+  80302f:	e8 6d dc ff ff       	call   800ca1 <sys_page_unmap>
+  803034:	83 c4 10             	add    $0x10,%esp
+  803037:	85 c0                	test   %eax,%eax
+  803039:	75 0a                	jne    803045 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  80303b:	89 d8                	mov    %ebx,%eax
+  80303d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803040:	5b                   	pop    %ebx
+  803041:	5e                   	pop    %esi
+  803042:	5f                   	pop    %edi
+  803043:	5d                   	pop    %ebp
+  803044:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803045:	68 7c 3d 80 00       	push   $0x803d7c
+  80304a:	68 c0 3c 80 00       	push   $0x803cc0
+  80304f:	6a 1b                	push   $0x1b
+  803051:	68 f4 3d 80 00       	push   $0x803df4
+  803056:	e8 e4 d0 ff ff       	call   80013f <_panic>
+
+0080305b <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80305b:	55                   	push   %ebp
+  80305c:	89 e5                	mov    %esp,%ebp
+  80305e:	53                   	push   %ebx
+  80305f:	83 ec 04             	sub    $0x4,%esp
+  803062:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803065:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803067:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  80306b:	74 21                	je     80308e <pgfault+0x33>
+  80306d:	89 d0                	mov    %edx,%eax
+  80306f:	c1 e8 16             	shr    $0x16,%eax
+  803072:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803079:	a8 01                	test   $0x1,%al
+  80307b:	74 11                	je     80308e <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  80307d:	89 d0                	mov    %edx,%eax
+  80307f:	c1 e8 0c             	shr    $0xc,%eax
+  803082:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803089:	f6 c4 08             	test   $0x8,%ah
+  80308c:	75 17                	jne    8030a5 <pgfault+0x4a>
+		if (pgfault_next) {
+  80308e:	a1 04 90 c0 00       	mov    0xc09004,%eax
+  803093:	85 c0                	test   %eax,%eax
+  803095:	74 27                	je     8030be <pgfault+0x63>
+			pgfault_next(utf);
+  803097:	83 ec 0c             	sub    $0xc,%esp
+  80309a:	53                   	push   %ebx
+  80309b:	ff d0                	call   *%eax
+			return;
+  80309d:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8030a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030a3:	c9                   	leave
+  8030a4:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8030a5:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8030ab:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8030b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b5:	e8 16 ff ff ff       	call   802fd0 <copy_page_to>
+  8030ba:	85 c0                	test   %eax,%eax
+  8030bc:	79 e2                	jns    8030a0 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8030be:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  8030c3:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8030c6:	ff 73 28             	push   0x28(%ebx)
+  8030c9:	ff 33                	push   (%ebx)
+  8030cb:	50                   	push   %eax
+  8030cc:	68 a0 3d 80 00       	push   $0x803da0
+  8030d1:	e8 44 d1 ff ff       	call   80021a <cprintf>
+	sys_env_destroy(0);
+  8030d6:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8030dd:	e8 a3 da ff ff       	call   800b85 <sys_env_destroy>
+  8030e2:	83 c4 10             	add    $0x10,%esp
+  8030e5:	eb b9                	jmp    8030a0 <pgfault+0x45>
+
+008030e7 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8030e7:	55                   	push   %ebp
+  8030e8:	89 e5                	mov    %esp,%ebp
+  8030ea:	53                   	push   %ebx
+  8030eb:	83 ec 04             	sub    $0x4,%esp
+  8030ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8030f1:	a1 08 90 c0 00       	mov    0xc09008,%eax
+  8030f6:	3d 5b 30 80 00       	cmp    $0x80305b,%eax
+  8030fb:	74 15                	je     803112 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8030fd:	a3 04 90 c0 00       	mov    %eax,0xc09004
+		set_pgfault_handler(pgfault);
+  803102:	83 ec 0c             	sub    $0xc,%esp
+  803105:	68 5b 30 80 00       	push   $0x80305b
+  80310a:	e8 fb 03 00 00       	call   80350a <set_pgfault_handler>
+  80310f:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803112:	83 ec 0c             	sub    $0xc,%esp
+  803115:	68 05 08 00 00       	push   $0x805
+  80311a:	53                   	push   %ebx
+  80311b:	6a 00                	push   $0x0
+  80311d:	53                   	push   %ebx
+  80311e:	6a 00                	push   $0x0
+  803120:	e8 3a db ff ff       	call   800c5f <sys_page_map>
+}
+  803125:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803128:	c9                   	leave
+  803129:	c3                   	ret
+
+0080312a <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80312a:	55                   	push   %ebp
+  80312b:	89 e5                	mov    %esp,%ebp
+  80312d:	57                   	push   %edi
+  80312e:	56                   	push   %esi
+  80312f:	53                   	push   %ebx
+  803130:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  803133:	68 5b 30 80 00       	push   $0x80305b
+  803138:	e8 cd 03 00 00       	call   80350a <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80313d:	b8 07 00 00 00       	mov    $0x7,%eax
+  803142:	cd 30                	int    $0x30
+  803144:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803147:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  80314a:	83 c4 10             	add    $0x10,%esp
+  80314d:	85 c0                	test   %eax,%eax
+  80314f:	0f 88 6b 01 00 00    	js     8032c0 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803155:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  80315a:	75 37                	jne    803193 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80315c:	e8 6d da ff ff       	call   800bce <sys_getenvid>
+  803161:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803166:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80316c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803171:	a3 00 50 c0 00       	mov    %eax,0xc05000
+		return 0;
+  803176:	e9 45 01 00 00       	jmp    8032c0 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  80317b:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803181:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803187:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80318d:	0f 87 ba 00 00 00    	ja     80324d <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803193:	89 d8                	mov    %ebx,%eax
+  803195:	c1 e8 16             	shr    $0x16,%eax
+  803198:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80319f:	a8 01                	test   $0x1,%al
+  8031a1:	74 d8                	je     80317b <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8031a3:	89 d8                	mov    %ebx,%eax
+  8031a5:	c1 e8 0c             	shr    $0xc,%eax
+  8031a8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031af:	f6 c2 01             	test   $0x1,%dl
+  8031b2:	74 cd                	je     803181 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8031b4:	89 da                	mov    %ebx,%edx
+  8031b6:	80 e6 df             	and    $0xdf,%dh
+  8031b9:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8031bf:	74 c0                	je     803181 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8031c1:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8031c3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031ca:	f6 c6 04             	test   $0x4,%dh
+  8031cd:	75 53                	jne    803222 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8031cf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8031d6:	f6 c6 08             	test   $0x8,%dh
+  8031d9:	75 0c                	jne    8031e7 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8031db:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031e2:	f6 c2 02             	test   $0x2,%dl
+  8031e5:	74 3b                	je     803222 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8031e7:	83 ec 0c             	sub    $0xc,%esp
+  8031ea:	68 05 08 00 00       	push   $0x805
+  8031ef:	57                   	push   %edi
+  8031f0:	ff 75 e4             	push   -0x1c(%ebp)
+  8031f3:	57                   	push   %edi
+  8031f4:	6a 00                	push   $0x0
+  8031f6:	e8 64 da ff ff       	call   800c5f <sys_page_map>
+  8031fb:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031fd:	83 c4 20             	add    $0x20,%esp
+  803200:	85 c0                	test   %eax,%eax
+  803202:	0f 88 a7 00 00 00    	js     8032af <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803208:	83 ec 0c             	sub    $0xc,%esp
+  80320b:	68 05 08 00 00       	push   $0x805
+  803210:	57                   	push   %edi
+  803211:	6a 00                	push   $0x0
+  803213:	57                   	push   %edi
+  803214:	6a 00                	push   $0x0
+  803216:	e8 44 da ff ff       	call   800c5f <sys_page_map>
+  80321b:	89 c6                	mov    %eax,%esi
+	return r;
+  80321d:	83 c4 20             	add    $0x20,%esp
+  803220:	eb 21                	jmp    803243 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803222:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803229:	83 ec 0c             	sub    $0xc,%esp
+  80322c:	25 07 0e 00 00       	and    $0xe07,%eax
+  803231:	50                   	push   %eax
+  803232:	57                   	push   %edi
+  803233:	ff 75 e4             	push   -0x1c(%ebp)
+  803236:	57                   	push   %edi
+  803237:	6a 00                	push   $0x0
+  803239:	e8 21 da ff ff       	call   800c5f <sys_page_map>
+  80323e:	89 c6                	mov    %eax,%esi
+  803240:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  803243:	85 f6                	test   %esi,%esi
+  803245:	0f 89 36 ff ff ff    	jns    803181 <fork+0x57>
+  80324b:	eb 62                	jmp    8032af <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80324d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803252:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  803257:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80325a:	89 f8                	mov    %edi,%eax
+  80325c:	e8 6f fd ff ff       	call   802fd0 <copy_page_to>
+  803261:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803263:	85 c0                	test   %eax,%eax
+  803265:	78 48                	js     8032af <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803267:	83 ec 04             	sub    $0x4,%esp
+  80326a:	6a 07                	push   $0x7
+  80326c:	68 00 f0 bf ee       	push   $0xeebff000
+  803271:	57                   	push   %edi
+  803272:	e8 9d d9 ff ff       	call   800c14 <sys_page_alloc>
+  803277:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803279:	83 c4 10             	add    $0x10,%esp
+  80327c:	85 c0                	test   %eax,%eax
+  80327e:	78 2f                	js     8032af <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803280:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  803285:	8b 40 64             	mov    0x64(%eax),%eax
+  803288:	83 ec 08             	sub    $0x8,%esp
+  80328b:	50                   	push   %eax
+  80328c:	57                   	push   %edi
+  80328d:	e8 ed da ff ff       	call   800d7f <sys_env_set_pgfault_upcall>
+  803292:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803294:	83 c4 10             	add    $0x10,%esp
+  803297:	85 c0                	test   %eax,%eax
+  803299:	78 14                	js     8032af <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  80329b:	83 ec 08             	sub    $0x8,%esp
+  80329e:	6a 02                	push   $0x2
+  8032a0:	57                   	push   %edi
+  8032a1:	e8 45 da ff ff       	call   800ceb <sys_env_set_status>
+  8032a6:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032a8:	83 c4 10             	add    $0x10,%esp
+  8032ab:	85 c0                	test   %eax,%eax
+  8032ad:	79 11                	jns    8032c0 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8032af:	83 ec 0c             	sub    $0xc,%esp
+  8032b2:	ff 75 e0             	push   -0x20(%ebp)
+  8032b5:	e8 cb d8 ff ff       	call   800b85 <sys_env_destroy>
+	return r;
+  8032ba:	83 c4 10             	add    $0x10,%esp
+  8032bd:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8032c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032c6:	5b                   	pop    %ebx
+  8032c7:	5e                   	pop    %esi
+  8032c8:	5f                   	pop    %edi
+  8032c9:	5d                   	pop    %ebp
+  8032ca:	c3                   	ret
+
+008032cb <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8032cb:	55                   	push   %ebp
+  8032cc:	89 e5                	mov    %esp,%ebp
+  8032ce:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8032d1:	68 ff 3d 80 00       	push   $0x803dff
+  8032d6:	68 bf 00 00 00       	push   $0xbf
+  8032db:	68 f4 3d 80 00       	push   $0x803df4
+  8032e0:	e8 5a ce ff ff       	call   80013f <_panic>
+
+008032e5 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8032e5:	55                   	push   %ebp
+  8032e6:	89 e5                	mov    %esp,%ebp
+  8032e8:	56                   	push   %esi
+  8032e9:	53                   	push   %ebx
+  8032ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032f3:	85 c0                	test   %eax,%eax
+  8032f5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8032fa:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8032fd:	83 ec 0c             	sub    $0xc,%esp
+  803300:	50                   	push   %eax
+  803301:	e8 56 db ff ff       	call   800e5c <sys_ipc_recv>
+	if (from_env_store)
+  803306:	83 c4 10             	add    $0x10,%esp
+  803309:	85 f6                	test   %esi,%esi
+  80330b:	74 14                	je     803321 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80330d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803312:	85 c0                	test   %eax,%eax
+  803314:	75 09                	jne    80331f <ipc_recv+0x3a>
+  803316:	8b 15 00 50 c0 00    	mov    0xc05000,%edx
+  80331c:	8b 52 74             	mov    0x74(%edx),%edx
+  80331f:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803321:	85 db                	test   %ebx,%ebx
+  803323:	74 25                	je     80334a <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803325:	85 c0                	test   %eax,%eax
+  803327:	74 0d                	je     803336 <ipc_recv+0x51>
+  803329:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  80332f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803332:	5b                   	pop    %ebx
+  803333:	5e                   	pop    %esi
+  803334:	5d                   	pop    %ebp
+  803335:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803336:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  80333b:	8b 40 78             	mov    0x78(%eax),%eax
+  80333e:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803340:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  803345:	8b 40 70             	mov    0x70(%eax),%eax
+  803348:	eb e5                	jmp    80332f <ipc_recv+0x4a>
+  80334a:	85 c0                	test   %eax,%eax
+  80334c:	75 e1                	jne    80332f <ipc_recv+0x4a>
+  80334e:	eb f0                	jmp    803340 <ipc_recv+0x5b>
+
+00803350 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803350:	55                   	push   %ebp
+  803351:	89 e5                	mov    %esp,%ebp
+  803353:	57                   	push   %edi
+  803354:	56                   	push   %esi
+  803355:	53                   	push   %ebx
+  803356:	83 ec 0c             	sub    $0xc,%esp
+  803359:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80335c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80335f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803362:	85 db                	test   %ebx,%ebx
+  803364:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803369:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80336c:	ff 75 14             	push   0x14(%ebp)
+  80336f:	53                   	push   %ebx
+  803370:	56                   	push   %esi
+  803371:	57                   	push   %edi
+  803372:	e8 52 da ff ff       	call   800dc9 <sys_ipc_try_send>
+  803377:	83 c4 10             	add    $0x10,%esp
+  80337a:	85 c0                	test   %eax,%eax
+  80337c:	74 22                	je     8033a0 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  80337e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803381:	75 07                	jne    80338a <ipc_send+0x3a>
+		sys_yield();
+  803383:	e8 6d d8 ff ff       	call   800bf5 <sys_yield>
+  803388:	eb e2                	jmp    80336c <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80338a:	68 15 3e 80 00       	push   $0x803e15
+  80338f:	68 c0 3c 80 00       	push   $0x803cc0
+  803394:	6a 39                	push   $0x39
+  803396:	68 2a 3e 80 00       	push   $0x803e2a
+  80339b:	e8 9f cd ff ff       	call   80013f <_panic>
+	}
+}
+  8033a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033a3:	5b                   	pop    %ebx
+  8033a4:	5e                   	pop    %esi
+  8033a5:	5f                   	pop    %edi
+  8033a6:	5d                   	pop    %ebp
+  8033a7:	c3                   	ret
+
+008033a8 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  8033a8:	55                   	push   %ebp
+  8033a9:	89 e5                	mov    %esp,%ebp
+  8033ab:	57                   	push   %edi
+  8033ac:	56                   	push   %esi
+  8033ad:	53                   	push   %ebx
+  8033ae:	83 ec 10             	sub    $0x10,%esp
+  8033b1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033ba:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8033bd:	85 c0                	test   %eax,%eax
+  8033bf:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8033c4:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8033c7:	6a 00                	push   $0x0
+  8033c9:	ff 33                	push   (%ebx)
+  8033cb:	50                   	push   %eax
+  8033cc:	e8 48 da ff ff       	call   800e19 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8033d1:	83 c4 10             	add    $0x10,%esp
+  8033d4:	85 c0                	test   %eax,%eax
+  8033d6:	75 3c                	jne    803414 <ipc_recvv+0x6c>
+  8033d8:	8b 15 00 50 c0 00    	mov    0xc05000,%edx
+  8033de:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8033e1:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8033e3:	85 ff                	test   %edi,%edi
+  8033e5:	74 4e                	je     803435 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8033e7:	8b 15 00 50 c0 00    	mov    0xc05000,%edx
+  8033ed:	8b 52 74             	mov    0x74(%edx),%edx
+  8033f0:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8033f2:	85 f6                	test   %esi,%esi
+  8033f4:	74 18                	je     80340e <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033f6:	85 c0                	test   %eax,%eax
+  8033f8:	75 2d                	jne    803427 <ipc_recvv+0x7f>
+  8033fa:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  8033ff:	8b 40 78             	mov    0x78(%eax),%eax
+  803402:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803404:	a1 00 50 c0 00       	mov    0xc05000,%eax
+  803409:	8b 40 70             	mov    0x70(%eax),%eax
+  80340c:	eb 1f                	jmp    80342d <ipc_recvv+0x85>
+  80340e:	85 c0                	test   %eax,%eax
+  803410:	75 1b                	jne    80342d <ipc_recvv+0x85>
+  803412:	eb f0                	jmp    803404 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803414:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80341a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  80341f:	85 ff                	test   %edi,%edi
+  803421:	75 cd                	jne    8033f0 <ipc_recvv+0x48>
+	if (perm_store)
+  803423:	85 f6                	test   %esi,%esi
+  803425:	74 e7                	je     80340e <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803427:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80342d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803430:	5b                   	pop    %ebx
+  803431:	5e                   	pop    %esi
+  803432:	5f                   	pop    %edi
+  803433:	5d                   	pop    %ebp
+  803434:	c3                   	ret
+	if (perm_store)
+  803435:	85 f6                	test   %esi,%esi
+  803437:	75 bd                	jne    8033f6 <ipc_recvv+0x4e>
+  803439:	eb c9                	jmp    803404 <ipc_recvv+0x5c>
+
+0080343b <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  80343b:	55                   	push   %ebp
+  80343c:	89 e5                	mov    %esp,%ebp
+  80343e:	57                   	push   %edi
+  80343f:	56                   	push   %esi
+  803440:	53                   	push   %ebx
+  803441:	83 ec 0c             	sub    $0xc,%esp
+  803444:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803447:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80344a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  80344d:	ff 75 14             	push   0x14(%ebp)
+  803450:	53                   	push   %ebx
+  803451:	56                   	push   %esi
+  803452:	57                   	push   %edi
+  803453:	e8 99 d9 ff ff       	call   800df1 <sys_ipc_try_sendv>
+  803458:	83 c4 10             	add    $0x10,%esp
+  80345b:	85 c0                	test   %eax,%eax
+  80345d:	74 22                	je     803481 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  80345f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803462:	75 07                	jne    80346b <ipc_sendv+0x30>
+		sys_yield();
+  803464:	e8 8c d7 ff ff       	call   800bf5 <sys_yield>
+  803469:	eb e2                	jmp    80344d <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80346b:	68 15 3e 80 00       	push   $0x803e15
+  803470:	68 c0 3c 80 00       	push   $0x803cc0
+  803475:	6a 5c                	push   $0x5c
+  803477:	68 2a 3e 80 00       	push   $0x803e2a
+  80347c:	e8 be cc ff ff       	call   80013f <_panic>
+	}
+}
+  803481:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803484:	5b                   	pop    %ebx
+  803485:	5e                   	pop    %esi
+  803486:	5f                   	pop    %edi
+  803487:	5d                   	pop    %ebp
+  803488:	c3                   	ret
+
+00803489 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803489:	55                   	push   %ebp
+  80348a:	89 e5                	mov    %esp,%ebp
+  80348c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80348f:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803494:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80349a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8034a0:	8b 52 50             	mov    0x50(%edx),%edx
+  8034a3:	39 ca                	cmp    %ecx,%edx
+  8034a5:	74 11                	je     8034b8 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8034a7:	83 c0 01             	add    $0x1,%eax
+  8034aa:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8034af:	75 e3                	jne    803494 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8034b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b6:	eb 0e                	jmp    8034c6 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8034b8:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8034be:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8034c3:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8034c6:	5d                   	pop    %ebp
+  8034c7:	c3                   	ret
+
+008034c8 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8034c8:	55                   	push   %ebp
+  8034c9:	89 e5                	mov    %esp,%ebp
+  8034cb:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8034ce:	89 c2                	mov    %eax,%edx
+  8034d0:	c1 ea 16             	shr    $0x16,%edx
+  8034d3:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8034da:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8034df:	f6 c1 01             	test   $0x1,%cl
+  8034e2:	74 22                	je     803506 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8034e4:	c1 e8 0c             	shr    $0xc,%eax
+  8034e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8034ee:	a8 01                	test   $0x1,%al
+  8034f0:	74 14                	je     803506 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8034f2:	c1 e8 0c             	shr    $0xc,%eax
+  8034f5:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8034f8:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8034ff:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803503:	0f b7 d2             	movzwl %dx,%edx
+}
+  803506:	89 d0                	mov    %edx,%eax
+  803508:	5d                   	pop    %ebp
+  803509:	c3                   	ret
+
+0080350a <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80350a:	55                   	push   %ebp
+  80350b:	89 e5                	mov    %esp,%ebp
+  80350d:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803510:	83 3d 08 90 c0 00 00 	cmpl   $0x0,0xc09008
+  803517:	74 0a                	je     803523 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803519:	8b 45 08             	mov    0x8(%ebp),%eax
+  80351c:	a3 08 90 c0 00       	mov    %eax,0xc09008
+}
+  803521:	c9                   	leave
+  803522:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803523:	83 ec 04             	sub    $0x4,%esp
+  803526:	6a 07                	push   $0x7
+  803528:	68 00 f0 bf ee       	push   $0xeebff000
+  80352d:	6a 00                	push   $0x0
+  80352f:	e8 e0 d6 ff ff       	call   800c14 <sys_page_alloc>
+  803534:	83 c4 10             	add    $0x10,%esp
+  803537:	85 c0                	test   %eax,%eax
+  803539:	75 2c                	jne    803567 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80353b:	83 ec 08             	sub    $0x8,%esp
+  80353e:	68 7d 35 80 00       	push   $0x80357d
+  803543:	6a 00                	push   $0x0
+  803545:	e8 35 d8 ff ff       	call   800d7f <sys_env_set_pgfault_upcall>
+  80354a:	83 c4 10             	add    $0x10,%esp
+  80354d:	85 c0                	test   %eax,%eax
+  80354f:	74 c8                	je     803519 <set_pgfault_handler+0xf>
+  803551:	68 7c 3e 80 00       	push   $0x803e7c
+  803556:	68 c0 3c 80 00       	push   $0x803cc0
+  80355b:	6a 20                	push   $0x20
+  80355d:	68 ac 3e 80 00       	push   $0x803eac
+  803562:	e8 d8 cb ff ff       	call   80013f <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803567:	68 34 3e 80 00       	push   $0x803e34
+  80356c:	68 c0 3c 80 00       	push   $0x803cc0
+  803571:	6a 1e                	push   $0x1e
+  803573:	68 ac 3e 80 00       	push   $0x803eac
+  803578:	e8 c2 cb ff ff       	call   80013f <_panic>
+
+0080357d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80357d:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80357e:	a1 08 90 c0 00       	mov    0xc09008,%eax
+	call *%eax
+  803583:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803585:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803588:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  80358d:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803592:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803596:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803599:	83 c4 08             	add    $0x8,%esp
+	popal
+  80359c:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  80359d:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8035a0:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8035a1:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8035a2:	c3                   	ret
+
+008035a3 <dm>:
+  8035a3:	55                   	push   %ebp
+  8035a4:	57                   	push   %edi
+  8035a5:	56                   	push   %esi
+  8035a6:	53                   	push   %ebx
+  8035a7:	83 ec 24             	sub    $0x24,%esp
+  8035aa:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8035ae:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035b2:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035b6:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035ba:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035be:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035c2:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8035c6:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035d5:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035dc:	00 
+  8035dd:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035e4:	00 
+  8035e5:	89 fb                	mov    %edi,%ebx
+  8035e7:	eb 08                	jmp    8035f1 <dm+0x4e>
+  8035e9:	83 e9 01             	sub    $0x1,%ecx
+  8035ec:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8035ef:	74 68                	je     803659 <dm+0xb6>
+  8035f1:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8035f5:	01 c0                	add    %eax,%eax
+  8035f7:	89 c6                	mov    %eax,%esi
+  8035f9:	89 d7                	mov    %edx,%edi
+  8035fb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8035ff:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803603:	0f ad d0             	shrd   %cl,%edx,%eax
+  803606:	d3 ea                	shr    %cl,%edx
+  803608:	f6 c1 20             	test   $0x20,%cl
+  80360b:	74 04                	je     803611 <dm+0x6e>
+  80360d:	89 d0                	mov    %edx,%eax
+  80360f:	31 d2                	xor    %edx,%edx
+  803611:	83 e0 01             	and    $0x1,%eax
+  803614:	89 04 24             	mov    %eax,(%esp)
+  803617:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80361e:	00 
+  80361f:	8b 04 24             	mov    (%esp),%eax
+  803622:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803626:	09 f0                	or     %esi,%eax
+  803628:	09 fa                	or     %edi,%edx
+  80362a:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80362e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803632:	39 f0                	cmp    %esi,%eax
+  803634:	89 d5                	mov    %edx,%ebp
+  803636:	19 fd                	sbb    %edi,%ebp
+  803638:	72 af                	jb     8035e9 <dm+0x46>
+  80363a:	29 f0                	sub    %esi,%eax
+  80363c:	19 fa                	sbb    %edi,%edx
+  80363e:	89 cf                	mov    %ecx,%edi
+  803640:	c1 ef 05             	shr    $0x5,%edi
+  803643:	83 e7 01             	and    $0x1,%edi
+  803646:	89 fe                	mov    %edi,%esi
+  803648:	83 f6 01             	xor    $0x1,%esi
+  80364b:	d3 e6                	shl    %cl,%esi
+  80364d:	d3 e7                	shl    %cl,%edi
+  80364f:	09 74 24 18          	or     %esi,0x18(%esp)
+  803653:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803657:	eb 90                	jmp    8035e9 <dm+0x46>
+  803659:	85 db                	test   %ebx,%ebx
+  80365b:	74 05                	je     803662 <dm+0xbf>
+  80365d:	89 03                	mov    %eax,(%ebx)
+  80365f:	89 53 04             	mov    %edx,0x4(%ebx)
+  803662:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803666:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80366a:	83 c4 24             	add    $0x24,%esp
+  80366d:	5b                   	pop    %ebx
+  80366e:	5e                   	pop    %esi
+  80366f:	5f                   	pop    %edi
+  803670:	5d                   	pop    %ebp
+  803671:	c3                   	ret
+
+00803672 <__udivdi3>:
+  803672:	83 ec 08             	sub    $0x8,%esp
+  803675:	6a 00                	push   $0x0
+  803677:	ff 74 24 1c          	push   0x1c(%esp)
+  80367b:	ff 74 24 1c          	push   0x1c(%esp)
+  80367f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803683:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803687:	e8 17 ff ff ff       	call   8035a3 <dm>
+  80368c:	83 c4 14             	add    $0x14,%esp
+  80368f:	c3                   	ret
+
+00803690 <__umoddi3>:
+  803690:	83 ec 18             	sub    $0x18,%esp
+  803693:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803697:	50                   	push   %eax
+  803698:	ff 74 24 2c          	push   0x2c(%esp)
+  80369c:	ff 74 24 2c          	push   0x2c(%esp)
+  8036a0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036a4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036a8:	e8 f6 fe ff ff       	call   8035a3 <dm>
+  8036ad:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036b1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036b5:	83 c4 24             	add    $0x24,%esp
+  8036b8:	c3                   	ret
+
+008036b9 <__divdi3>:
+  8036b9:	53                   	push   %ebx
+  8036ba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036be:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036c2:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8036c6:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036ca:	85 d2                	test   %edx,%edx
+  8036cc:	78 15                	js     8036e3 <__divdi3+0x2a>
+  8036ce:	85 db                	test   %ebx,%ebx
+  8036d0:	78 34                	js     803706 <__divdi3+0x4d>
+  8036d2:	83 ec 04             	sub    $0x4,%esp
+  8036d5:	6a 00                	push   $0x0
+  8036d7:	53                   	push   %ebx
+  8036d8:	51                   	push   %ecx
+  8036d9:	e8 c5 fe ff ff       	call   8035a3 <dm>
+  8036de:	83 c4 10             	add    $0x10,%esp
+  8036e1:	eb 21                	jmp    803704 <__divdi3+0x4b>
+  8036e3:	f7 d8                	neg    %eax
+  8036e5:	83 d2 00             	adc    $0x0,%edx
+  8036e8:	f7 da                	neg    %edx
+  8036ea:	85 db                	test   %ebx,%ebx
+  8036ec:	78 30                	js     80371e <__divdi3+0x65>
+  8036ee:	83 ec 04             	sub    $0x4,%esp
+  8036f1:	6a 00                	push   $0x0
+  8036f3:	53                   	push   %ebx
+  8036f4:	51                   	push   %ecx
+  8036f5:	e8 a9 fe ff ff       	call   8035a3 <dm>
+  8036fa:	83 c4 10             	add    $0x10,%esp
+  8036fd:	f7 d8                	neg    %eax
+  8036ff:	83 d2 00             	adc    $0x0,%edx
+  803702:	f7 da                	neg    %edx
+  803704:	5b                   	pop    %ebx
+  803705:	c3                   	ret
+  803706:	83 ec 04             	sub    $0x4,%esp
+  803709:	6a 00                	push   $0x0
+  80370b:	f7 d9                	neg    %ecx
+  80370d:	83 d3 00             	adc    $0x0,%ebx
+  803710:	f7 db                	neg    %ebx
+  803712:	53                   	push   %ebx
+  803713:	51                   	push   %ecx
+  803714:	e8 8a fe ff ff       	call   8035a3 <dm>
+  803719:	83 c4 10             	add    $0x10,%esp
+  80371c:	eb df                	jmp    8036fd <__divdi3+0x44>
+  80371e:	83 ec 04             	sub    $0x4,%esp
+  803721:	6a 00                	push   $0x0
+  803723:	f7 d9                	neg    %ecx
+  803725:	83 d3 00             	adc    $0x0,%ebx
+  803728:	f7 db                	neg    %ebx
+  80372a:	53                   	push   %ebx
+  80372b:	51                   	push   %ecx
+  80372c:	e8 72 fe ff ff       	call   8035a3 <dm>
+  803731:	83 c4 10             	add    $0x10,%esp
+  803734:	eb ce                	jmp    803704 <__divdi3+0x4b>
+
+00803736 <__moddi3>:
+  803736:	55                   	push   %ebp
+  803737:	57                   	push   %edi
+  803738:	56                   	push   %esi
+  803739:	53                   	push   %ebx
+  80373a:	83 ec 24             	sub    $0x24,%esp
+  80373d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803741:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803745:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803749:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80374d:	85 d2                	test   %edx,%edx
+  80374f:	78 3b                	js     80378c <__moddi3+0x56>
+  803751:	83 ec 04             	sub    $0x4,%esp
+  803754:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803758:	56                   	push   %esi
+  803759:	89 ce                	mov    %ecx,%esi
+  80375b:	f7 de                	neg    %esi
+  80375d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803761:	89 de                	mov    %ebx,%esi
+  803763:	83 d6 00             	adc    $0x0,%esi
+  803766:	f7 de                	neg    %esi
+  803768:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80376c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803770:	0f 48 f1             	cmovs  %ecx,%esi
+  803773:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803778:	53                   	push   %ebx
+  803779:	56                   	push   %esi
+  80377a:	e8 24 fe ff ff       	call   8035a3 <dm>
+  80377f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803783:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803787:	83 c4 10             	add    $0x10,%esp
+  80378a:	eb 47                	jmp    8037d3 <__moddi3+0x9d>
+  80378c:	f7 d8                	neg    %eax
+  80378e:	83 d2 00             	adc    $0x0,%edx
+  803791:	f7 da                	neg    %edx
+  803793:	83 ec 04             	sub    $0x4,%esp
+  803796:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80379a:	56                   	push   %esi
+  80379b:	89 cf                	mov    %ecx,%edi
+  80379d:	f7 df                	neg    %edi
+  80379f:	89 de                	mov    %ebx,%esi
+  8037a1:	83 d6 00             	adc    $0x0,%esi
+  8037a4:	f7 de                	neg    %esi
+  8037a6:	0f 49 cf             	cmovns %edi,%ecx
+  8037a9:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8037ad:	0f 49 de             	cmovns %esi,%ebx
+  8037b0:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8037b4:	ff 74 24 0c          	push   0xc(%esp)
+  8037b8:	ff 74 24 0c          	push   0xc(%esp)
+  8037bc:	e8 e2 fd ff ff       	call   8035a3 <dm>
+  8037c1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037c5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037c9:	f7 d8                	neg    %eax
+  8037cb:	83 d2 00             	adc    $0x0,%edx
+  8037ce:	f7 da                	neg    %edx
+  8037d0:	83 c4 10             	add    $0x10,%esp
+  8037d3:	83 c4 24             	add    $0x24,%esp
+  8037d6:	5b                   	pop    %ebx
+  8037d7:	5e                   	pop    %esi
+  8037d8:	5f                   	pop    %edi
+  8037d9:	5d                   	pop    %ebp
+  8037da:	c3                   	ret
@@ -0,0 +1,7944 @@
+
+obj/user/testbulk.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8e 03 00 00       	call   8003bf <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+static char big[NBIG * PGSIZE] __attribute__((aligned(PGSIZE)));
+static char back[NBIG * PGSIZE] __attribute__((aligned(PGSIZE)));
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 14             	sub    $0x14,%esp
+	extern union Fsipc fsipcbuf;
+	uintptr_t pages[2];
+	struct Fd *fd;
+	int r, f, i, n;
+
+	for (i = 0; i < sizeof(big); i++)
+  80003a:	b8 00 00 00 00       	mov    $0x0,%eax
+		big[i] = i ^ (i >> 9);
+  80003f:	89 c2                	mov    %eax,%edx
+  800041:	c1 fa 09             	sar    $0x9,%edx
+  800044:	31 c2                	xor    %eax,%edx
+  800046:	88 90 00 80 84 00    	mov    %dl,0x848000(%eax)
+	for (i = 0; i < sizeof(big); i++)
+  80004c:	83 c0 01             	add    $0x1,%eax
+  80004f:	3d 00 20 04 00       	cmp    $0x42000,%eax
+  800054:	75 e9                	jne    80003f <umain+0xc>
+
+	if ((f = open("/bulk", O_RDWR|O_CREAT|O_TRUNC|O_NOBUF)) < 0)
+  800056:	83 ec 08             	sub    $0x8,%esp
+  800059:	68 02 13 00 00       	push   $0x1302
+  80005e:	68 c0 3a 80 00       	push   $0x803ac0
+  800063:	e8 0c 22 00 00       	call   802274 <open>
+  800068:	89 c3                	mov    %eax,%ebx
+  80006a:	83 c4 10             	add    $0x10,%esp
+  80006d:	85 c0                	test   %eax,%eax
+  80006f:	0f 88 50 02 00 00    	js     8002c5 <umain+0x292>
+		panic("open /bulk: %e", f);
+
+	// A few pages, starting and ending in the middle of a page
+	n = 3*PGSIZE + 500;
+	if ((r = write(f, big + 100, n)) != n)
+  800075:	83 ec 04             	sub    $0x4,%esp
+  800078:	68 f4 31 00 00       	push   $0x31f4
+  80007d:	68 64 80 84 00       	push   $0x848064
+  800082:	50                   	push   %eax
+  800083:	e8 04 18 00 00       	call   80188c <write>
+  800088:	83 c4 10             	add    $0x10,%esp
+  80008b:	3d f4 31 00 00       	cmp    $0x31f4,%eax
+  800090:	0f 85 41 02 00 00    	jne    8002d7 <umain+0x2a4>
+		panic("bulk write returned %d, wanted %d: %e", r, n, r);
+	cprintf("bulk write is good\n");
+  800096:	83 ec 0c             	sub    $0xc,%esp
+  800099:	68 e5 3a 80 00       	push   $0x803ae5
+  80009e:	e8 5a 04 00 00       	call   8004fd <cprintf>
+
+	seek(f, 0);
+  8000a3:	83 c4 08             	add    $0x8,%esp
+  8000a6:	6a 00                	push   $0x0
+  8000a8:	53                   	push   %ebx
+  8000a9:	e8 60 18 00 00       	call   80190e <seek>
+	memset(back, 0, sizeof(back));
+  8000ae:	83 c4 0c             	add    $0xc,%esp
+  8000b1:	68 00 20 04 00       	push   $0x42000
+  8000b6:	6a 00                	push   $0x0
+  8000b8:	68 00 60 80 00       	push   $0x806000
+  8000bd:	e8 7a 0b 00 00       	call   800c3c <memset>
+	if ((r = read(f, back + 100, n)) != n)
+  8000c2:	83 c4 0c             	add    $0xc,%esp
+  8000c5:	68 f4 31 00 00       	push   $0x31f4
+  8000ca:	68 64 60 80 00       	push   $0x806064
+  8000cf:	53                   	push   %ebx
+  8000d0:	e8 e9 16 00 00       	call   8017be <read>
+  8000d5:	83 c4 10             	add    $0x10,%esp
+  8000d8:	3d f4 31 00 00       	cmp    $0x31f4,%eax
+  8000dd:	0f 85 0f 02 00 00    	jne    8002f2 <umain+0x2bf>
+		panic("bulk read returned %d, wanted %d: %e", r, n, r);
+	if (memcmp(back + 100, big + 100, n) != 0)
+  8000e3:	83 ec 04             	sub    $0x4,%esp
+  8000e6:	68 f4 31 00 00       	push   $0x31f4
+  8000eb:	68 64 80 84 00       	push   $0x848064
+  8000f0:	68 64 60 80 00       	push   $0x806064
+  8000f5:	e8 ef 0b 00 00       	call   800ce9 <memcmp>
+  8000fa:	83 c4 10             	add    $0x10,%esp
+  8000fd:	85 c0                	test   %eax,%eax
+  8000ff:	0f 85 08 02 00 00    	jne    80030d <umain+0x2da>
+		panic("bulk read returned wrong data");
+	if (back[99] != 0 || back[100 + n] != 0)
+  800105:	0f b6 05 63 60 80 00 	movzbl 0x806063,%eax
+  80010c:	0a 05 58 92 80 00    	or     0x809258,%al
+  800112:	0f 85 09 02 00 00    	jne    800321 <umain+0x2ee>
+		panic("bulk read wrote outside the buffer");
+	cprintf("bulk read is good\n");
+  800118:	83 ec 0c             	sub    $0xc,%esp
+  80011b:	68 17 3b 80 00       	push   $0x803b17
+  800120:	e8 d8 03 00 00       	call   8004fd <cprintf>
+
+	// A single request carries at most FSBULK_MAXPAGES pages
+	seek(f, 0);
+  800125:	83 c4 08             	add    $0x8,%esp
+  800128:	6a 00                	push   $0x0
+  80012a:	53                   	push   %ebx
+  80012b:	e8 de 17 00 00       	call   80190e <seek>
+	if ((r = write(f, big, sizeof(big))) != FSBULK_MAXPAGES*PGSIZE)
+  800130:	83 c4 0c             	add    $0xc,%esp
+  800133:	68 00 20 04 00       	push   $0x42000
+  800138:	68 00 80 84 00       	push   $0x848000
+  80013d:	53                   	push   %ebx
+  80013e:	e8 49 17 00 00       	call   80188c <write>
+  800143:	83 c4 10             	add    $0x10,%esp
+  800146:	3d 00 00 04 00       	cmp    $0x40000,%eax
+  80014b:	0f 85 e4 01 00 00    	jne    800335 <umain+0x302>
+		panic("bulk write of %d pages returned %d", NBIG, r);
+	seek(f, 0);
+  800151:	83 ec 08             	sub    $0x8,%esp
+  800154:	6a 00                	push   $0x0
+  800156:	53                   	push   %ebx
+  800157:	e8 b2 17 00 00       	call   80190e <seek>
+	memset(back, 0, sizeof(back));
+  80015c:	83 c4 0c             	add    $0xc,%esp
+  80015f:	68 00 20 04 00       	push   $0x42000
+  800164:	6a 00                	push   $0x0
+  800166:	68 00 60 80 00       	push   $0x806000
+  80016b:	e8 cc 0a 00 00       	call   800c3c <memset>
+	if ((r = read(f, back + 100, sizeof(back) - 100)) != FSBULK_MAXPAGES*PGSIZE - 100)
+  800170:	83 c4 0c             	add    $0xc,%esp
+  800173:	68 9c 1f 04 00       	push   $0x41f9c
+  800178:	68 64 60 80 00       	push   $0x806064
+  80017d:	53                   	push   %ebx
+  80017e:	e8 3b 16 00 00       	call   8017be <read>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	3d 9c ff 03 00       	cmp    $0x3ff9c,%eax
+  80018b:	0f 85 bb 01 00 00    	jne    80034c <umain+0x319>
+		panic("bulk read of %d pages returned %d", NBIG, r);
+	if (memcmp(back + 100, big, r) != 0)
+  800191:	83 ec 04             	sub    $0x4,%esp
+  800194:	68 9c ff 03 00       	push   $0x3ff9c
+  800199:	68 00 80 84 00       	push   $0x848000
+  80019e:	68 64 60 80 00       	push   $0x806064
+  8001a3:	e8 41 0b 00 00       	call   800ce9 <memcmp>
+  8001a8:	83 c4 10             	add    $0x10,%esp
+  8001ab:	85 c0                	test   %eax,%eax
+  8001ad:	0f 85 b0 01 00 00    	jne    800363 <umain+0x330>
+		panic("clipped bulk read returned wrong data");
+	cprintf("bulk clipping is good\n");
+  8001b3:	83 ec 0c             	sub    $0xc,%esp
+  8001b6:	68 2a 3b 80 00       	push   $0x803b2a
+  8001bb:	e8 3d 03 00 00       	call   8004fd <cprintf>
+
+	// The server must not read into pages it cannot write, nor past
+	// the pages it was sent
+	if ((r = fd_lookup(f, &fd)) < 0)
+  8001c0:	83 c4 08             	add    $0x8,%esp
+  8001c3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8001c6:	50                   	push   %eax
+  8001c7:	53                   	push   %ebx
+  8001c8:	e8 8b 13 00 00       	call   801558 <fd_lookup>
+  8001cd:	83 c4 10             	add    $0x10,%esp
+  8001d0:	85 c0                	test   %eax,%eax
+  8001d2:	0f 88 9f 01 00 00    	js     800377 <umain+0x344>
+		panic("fd_lookup: %e", r);
+	if ((r = sys_page_alloc(0, ROVA, PTE_P|PTE_U)) < 0)
+  8001d8:	83 ec 04             	sub    $0x4,%esp
+  8001db:	6a 05                	push   $0x5
+  8001dd:	68 00 c0 cc cc       	push   $0xccccc000
+  8001e2:	6a 00                	push   $0x0
+  8001e4:	e8 0e 0d 00 00       	call   800ef7 <sys_page_alloc>
+  8001e9:	83 c4 10             	add    $0x10,%esp
+  8001ec:	85 c0                	test   %eax,%eax
+  8001ee:	0f 88 95 01 00 00    	js     800389 <umain+0x356>
+		panic("sys_page_alloc: %e", r);
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P|PTE_W|PTE_U;
+  8001f4:	b8 00 b0 88 00       	mov    $0x88b000,%eax
+  8001f9:	83 c8 07             	or     $0x7,%eax
+  8001fc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	pages[1] = (uintptr_t) ROVA | PTE_P|PTE_U;
+  8001ff:	c7 45 f4 05 c0 cc cc 	movl   $0xccccc005,-0xc(%ebp)
+
+	fsipcbuf.bulk.req_fileid = fd->fd_file.id;
+  800206:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800209:	8b 40 0c             	mov    0xc(%eax),%eax
+  80020c:	a3 00 b0 88 00       	mov    %eax,0x88b000
+	fsipcbuf.bulk.req_n = PGSIZE;
+  800211:	c7 05 04 b0 88 00 00 	movl   $0x1000,0x88b004
+  800218:	10 00 00 
+	fsipcbuf.bulk.req_off = 0;
+  80021b:	c7 05 08 b0 88 00 00 	movl   $0x0,0x88b008
+  800222:	00 00 00 
+	ipc_sendv(ipc_find_env(ENV_TYPE_FS), FSREQ_READ_BULK, pages, 2);
+  800225:	83 ec 0c             	sub    $0xc,%esp
+  800228:	6a 01                	push   $0x1
+  80022a:	e8 6d 12 00 00       	call   80149c <ipc_find_env>
+  80022f:	6a 02                	push   $0x2
+  800231:	8d 55 f0             	lea    -0x10(%ebp),%edx
+  800234:	52                   	push   %edx
+  800235:	6a 09                	push   $0x9
+  800237:	50                   	push   %eax
+  800238:	e8 11 12 00 00       	call   80144e <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) != -E_INVAL)
+  80023d:	83 c4 1c             	add    $0x1c,%esp
+  800240:	6a 00                	push   $0x0
+  800242:	6a 00                	push   $0x0
+  800244:	6a 00                	push   $0x0
+  800246:	e8 ad 10 00 00       	call   8012f8 <ipc_recv>
+  80024b:	83 c4 10             	add    $0x10,%esp
+  80024e:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800251:	0f 85 44 01 00 00    	jne    80039b <umain+0x368>
+		panic("bulk read into a read-only page returned %d", r);
+
+	fsipcbuf.bulk.req_fileid = fd->fd_file.id;
+  800257:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80025a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80025d:	a3 00 b0 88 00       	mov    %eax,0x88b000
+	fsipcbuf.bulk.req_n = PGSIZE;
+  800262:	c7 05 04 b0 88 00 00 	movl   $0x1000,0x88b004
+  800269:	10 00 00 
+	fsipcbuf.bulk.req_off = 100;
+  80026c:	c7 05 08 b0 88 00 64 	movl   $0x64,0x88b008
+  800273:	00 00 00 
+	ipc_sendv(ipc_find_env(ENV_TYPE_FS), FSREQ_WRITE_BULK, pages, 2);
+  800276:	83 ec 0c             	sub    $0xc,%esp
+  800279:	6a 01                	push   $0x1
+  80027b:	e8 1c 12 00 00       	call   80149c <ipc_find_env>
+  800280:	6a 02                	push   $0x2
+  800282:	8d 55 f0             	lea    -0x10(%ebp),%edx
+  800285:	52                   	push   %edx
+  800286:	6a 0a                	push   $0xa
+  800288:	50                   	push   %eax
+  800289:	e8 c0 11 00 00       	call   80144e <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) != -E_INVAL)
+  80028e:	83 c4 1c             	add    $0x1c,%esp
+  800291:	6a 00                	push   $0x0
+  800293:	6a 00                	push   $0x0
+  800295:	6a 00                	push   $0x0
+  800297:	e8 5c 10 00 00       	call   8012f8 <ipc_recv>
+  80029c:	83 c4 10             	add    $0x10,%esp
+  80029f:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8002a2:	0f 85 05 01 00 00    	jne    8003ad <umain+0x37a>
+		panic("bulk write past the pages sent returned %d", r);
+	cprintf("bulk page checks are good\n");
+  8002a8:	83 ec 0c             	sub    $0xc,%esp
+  8002ab:	68 62 3b 80 00       	push   $0x803b62
+  8002b0:	e8 48 02 00 00       	call   8004fd <cprintf>
+
+	close(f);
+  8002b5:	89 1c 24             	mov    %ebx,(%esp)
+  8002b8:	e8 c5 13 00 00       	call   801682 <close>
+}
+  8002bd:	83 c4 10             	add    $0x10,%esp
+  8002c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002c3:	c9                   	leave
+  8002c4:	c3                   	ret
+		panic("open /bulk: %e", f);
+  8002c5:	50                   	push   %eax
+  8002c6:	68 c6 3a 80 00       	push   $0x803ac6
+  8002cb:	6a 18                	push   $0x18
+  8002cd:	68 d5 3a 80 00       	push   $0x803ad5
+  8002d2:	e8 4b 01 00 00       	call   800422 <_panic>
+		panic("bulk write returned %d, wanted %d: %e", r, n, r);
+  8002d7:	83 ec 08             	sub    $0x8,%esp
+  8002da:	50                   	push   %eax
+  8002db:	68 f4 31 00 00       	push   $0x31f4
+  8002e0:	50                   	push   %eax
+  8002e1:	68 80 3b 80 00       	push   $0x803b80
+  8002e6:	6a 1d                	push   $0x1d
+  8002e8:	68 d5 3a 80 00       	push   $0x803ad5
+  8002ed:	e8 30 01 00 00       	call   800422 <_panic>
+		panic("bulk read returned %d, wanted %d: %e", r, n, r);
+  8002f2:	83 ec 08             	sub    $0x8,%esp
+  8002f5:	50                   	push   %eax
+  8002f6:	68 f4 31 00 00       	push   $0x31f4
+  8002fb:	50                   	push   %eax
+  8002fc:	68 a8 3b 80 00       	push   $0x803ba8
+  800301:	6a 23                	push   $0x23
+  800303:	68 d5 3a 80 00       	push   $0x803ad5
+  800308:	e8 15 01 00 00       	call   800422 <_panic>
+		panic("bulk read returned wrong data");
+  80030d:	83 ec 04             	sub    $0x4,%esp
+  800310:	68 f9 3a 80 00       	push   $0x803af9
+  800315:	6a 25                	push   $0x25
+  800317:	68 d5 3a 80 00       	push   $0x803ad5
+  80031c:	e8 01 01 00 00       	call   800422 <_panic>
+		panic("bulk read wrote outside the buffer");
+  800321:	83 ec 04             	sub    $0x4,%esp
+  800324:	68 d0 3b 80 00       	push   $0x803bd0
+  800329:	6a 27                	push   $0x27
+  80032b:	68 d5 3a 80 00       	push   $0x803ad5
+  800330:	e8 ed 00 00 00       	call   800422 <_panic>
+		panic("bulk write of %d pages returned %d", NBIG, r);
+  800335:	83 ec 0c             	sub    $0xc,%esp
+  800338:	50                   	push   %eax
+  800339:	6a 42                	push   $0x42
+  80033b:	68 f4 3b 80 00       	push   $0x803bf4
+  800340:	6a 2d                	push   $0x2d
+  800342:	68 d5 3a 80 00       	push   $0x803ad5
+  800347:	e8 d6 00 00 00       	call   800422 <_panic>
+		panic("bulk read of %d pages returned %d", NBIG, r);
+  80034c:	83 ec 0c             	sub    $0xc,%esp
+  80034f:	50                   	push   %eax
+  800350:	6a 42                	push   $0x42
+  800352:	68 18 3c 80 00       	push   $0x803c18
+  800357:	6a 31                	push   $0x31
+  800359:	68 d5 3a 80 00       	push   $0x803ad5
+  80035e:	e8 bf 00 00 00       	call   800422 <_panic>
+		panic("clipped bulk read returned wrong data");
+  800363:	83 ec 04             	sub    $0x4,%esp
+  800366:	68 3c 3c 80 00       	push   $0x803c3c
+  80036b:	6a 33                	push   $0x33
+  80036d:	68 d5 3a 80 00       	push   $0x803ad5
+  800372:	e8 ab 00 00 00       	call   800422 <_panic>
+		panic("fd_lookup: %e", r);
+  800377:	50                   	push   %eax
+  800378:	68 41 3b 80 00       	push   $0x803b41
+  80037d:	6a 39                	push   $0x39
+  80037f:	68 d5 3a 80 00       	push   $0x803ad5
+  800384:	e8 99 00 00 00       	call   800422 <_panic>
+		panic("sys_page_alloc: %e", r);
+  800389:	50                   	push   %eax
+  80038a:	68 4f 3b 80 00       	push   $0x803b4f
+  80038f:	6a 3b                	push   $0x3b
+  800391:	68 d5 3a 80 00       	push   $0x803ad5
+  800396:	e8 87 00 00 00       	call   800422 <_panic>
+		panic("bulk read into a read-only page returned %d", r);
+  80039b:	50                   	push   %eax
+  80039c:	68 64 3c 80 00       	push   $0x803c64
+  8003a1:	6a 44                	push   $0x44
+  8003a3:	68 d5 3a 80 00       	push   $0x803ad5
+  8003a8:	e8 75 00 00 00       	call   800422 <_panic>
+		panic("bulk write past the pages sent returned %d", r);
+  8003ad:	50                   	push   %eax
+  8003ae:	68 90 3c 80 00       	push   $0x803c90
+  8003b3:	6a 4b                	push   $0x4b
+  8003b5:	68 d5 3a 80 00       	push   $0x803ad5
+  8003ba:	e8 63 00 00 00       	call   800422 <_panic>
+
+008003bf <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8003bf:	55                   	push   %ebp
+  8003c0:	89 e5                	mov    %esp,%ebp
+  8003c2:	56                   	push   %esi
+  8003c3:	53                   	push   %ebx
+  8003c4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003c7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8003ca:	e8 e2 0a 00 00       	call   800eb1 <sys_getenvid>
+  8003cf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003d4:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8003da:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003df:	a3 00 a0 88 00       	mov    %eax,0x88a000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003e4:	85 db                	test   %ebx,%ebx
+  8003e6:	7e 07                	jle    8003ef <libmain+0x30>
+		binaryname = argv[0];
+  8003e8:	8b 06                	mov    (%esi),%eax
+  8003ea:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8003ef:	83 ec 08             	sub    $0x8,%esp
+  8003f2:	56                   	push   %esi
+  8003f3:	53                   	push   %ebx
+  8003f4:	e8 3a fc ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8003f9:	e8 0a 00 00 00       	call   800408 <exit>
+}
+  8003fe:	83 c4 10             	add    $0x10,%esp
+  800401:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800404:	5b                   	pop    %ebx
+  800405:	5e                   	pop    %esi
+  800406:	5d                   	pop    %ebp
+  800407:	c3                   	ret
+
+00800408 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800408:	55                   	push   %ebp
+  800409:	89 e5                	mov    %esp,%ebp
+  80040b:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80040e:	e8 9c 12 00 00       	call   8016af <close_all>
+	sys_env_destroy(0);
+  800413:	83 ec 0c             	sub    $0xc,%esp
+  800416:	6a 00                	push   $0x0
+  800418:	e8 4b 0a 00 00       	call   800e68 <sys_env_destroy>
+}
+  80041d:	83 c4 10             	add    $0x10,%esp
+  800420:	c9                   	leave
+  800421:	c3                   	ret
+
+00800422 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800422:	55                   	push   %ebp
+  800423:	89 e5                	mov    %esp,%ebp
+  800425:	56                   	push   %esi
+  800426:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800427:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80042a:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800430:	e8 7c 0a 00 00       	call   800eb1 <sys_getenvid>
+  800435:	83 ec 0c             	sub    $0xc,%esp
+  800438:	ff 75 0c             	push   0xc(%ebp)
+  80043b:	ff 75 08             	push   0x8(%ebp)
+  80043e:	56                   	push   %esi
+  80043f:	50                   	push   %eax
+  800440:	68 c8 3c 80 00       	push   $0x803cc8
+  800445:	e8 b3 00 00 00       	call   8004fd <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80044a:	83 c4 18             	add    $0x18,%esp
+  80044d:	53                   	push   %ebx
+  80044e:	ff 75 10             	push   0x10(%ebp)
+  800451:	e8 56 00 00 00       	call   8004ac <vcprintf>
+	cprintf("\n");
+  800456:	c7 04 24 a6 41 80 00 	movl   $0x8041a6,(%esp)
+  80045d:	e8 9b 00 00 00       	call   8004fd <cprintf>
+  800462:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800465:	cc                   	int3
+	while (1)
+  800466:	eb fd                	jmp    800465 <_panic+0x43>
+
+00800468 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800468:	55                   	push   %ebp
+  800469:	89 e5                	mov    %esp,%ebp
+  80046b:	53                   	push   %ebx
+  80046c:	83 ec 04             	sub    $0x4,%esp
+  80046f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800472:	8b 13                	mov    (%ebx),%edx
+  800474:	8d 42 01             	lea    0x1(%edx),%eax
+  800477:	89 03                	mov    %eax,(%ebx)
+  800479:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80047c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800480:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800485:	74 09                	je     800490 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800487:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80048b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80048e:	c9                   	leave
+  80048f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800490:	83 ec 08             	sub    $0x8,%esp
+  800493:	68 ff 00 00 00       	push   $0xff
+  800498:	8d 43 08             	lea    0x8(%ebx),%eax
+  80049b:	50                   	push   %eax
+  80049c:	e8 7a 09 00 00       	call   800e1b <sys_cputs>
+		b->idx = 0;
+  8004a1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004a7:	83 c4 10             	add    $0x10,%esp
+  8004aa:	eb db                	jmp    800487 <putch+0x1f>
+
+008004ac <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004ac:	55                   	push   %ebp
+  8004ad:	89 e5                	mov    %esp,%ebp
+  8004af:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8004b5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004bc:	00 00 00 
+	b.cnt = 0;
+  8004bf:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004c6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8004c9:	ff 75 0c             	push   0xc(%ebp)
+  8004cc:	ff 75 08             	push   0x8(%ebp)
+  8004cf:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004d5:	50                   	push   %eax
+  8004d6:	68 68 04 80 00       	push   $0x800468
+  8004db:	e8 14 01 00 00       	call   8005f4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004e0:	83 c4 08             	add    $0x8,%esp
+  8004e3:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004e9:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004ef:	50                   	push   %eax
+  8004f0:	e8 26 09 00 00       	call   800e1b <sys_cputs>
+
+	return b.cnt;
+}
+  8004f5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004fb:	c9                   	leave
+  8004fc:	c3                   	ret
+
+008004fd <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004fd:	55                   	push   %ebp
+  8004fe:	89 e5                	mov    %esp,%ebp
+  800500:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800503:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800506:	50                   	push   %eax
+  800507:	ff 75 08             	push   0x8(%ebp)
+  80050a:	e8 9d ff ff ff       	call   8004ac <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80050f:	c9                   	leave
+  800510:	c3                   	ret
+
+00800511 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800511:	55                   	push   %ebp
+  800512:	89 e5                	mov    %esp,%ebp
+  800514:	57                   	push   %edi
+  800515:	56                   	push   %esi
+  800516:	53                   	push   %ebx
+  800517:	83 ec 1c             	sub    $0x1c,%esp
+  80051a:	89 c7                	mov    %eax,%edi
+  80051c:	89 d6                	mov    %edx,%esi
+  80051e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800521:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800524:	89 d1                	mov    %edx,%ecx
+  800526:	89 c2                	mov    %eax,%edx
+  800528:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80052e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800531:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800534:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800537:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80053e:	39 c2                	cmp    %eax,%edx
+  800540:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800543:	72 3e                	jb     800583 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800545:	83 ec 0c             	sub    $0xc,%esp
+  800548:	ff 75 18             	push   0x18(%ebp)
+  80054b:	83 eb 01             	sub    $0x1,%ebx
+  80054e:	53                   	push   %ebx
+  80054f:	50                   	push   %eax
+  800550:	83 ec 08             	sub    $0x8,%esp
+  800553:	ff 75 e4             	push   -0x1c(%ebp)
+  800556:	ff 75 e0             	push   -0x20(%ebp)
+  800559:	ff 75 dc             	push   -0x24(%ebp)
+  80055c:	ff 75 d8             	push   -0x28(%ebp)
+  80055f:	e8 f1 33 00 00       	call   803955 <__udivdi3>
+  800564:	83 c4 18             	add    $0x18,%esp
+  800567:	52                   	push   %edx
+  800568:	50                   	push   %eax
+  800569:	89 f2                	mov    %esi,%edx
+  80056b:	89 f8                	mov    %edi,%eax
+  80056d:	e8 9f ff ff ff       	call   800511 <printnum>
+  800572:	83 c4 20             	add    $0x20,%esp
+  800575:	eb 13                	jmp    80058a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800577:	83 ec 08             	sub    $0x8,%esp
+  80057a:	56                   	push   %esi
+  80057b:	ff 75 18             	push   0x18(%ebp)
+  80057e:	ff d7                	call   *%edi
+  800580:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800583:	83 eb 01             	sub    $0x1,%ebx
+  800586:	85 db                	test   %ebx,%ebx
+  800588:	7f ed                	jg     800577 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80058a:	83 ec 08             	sub    $0x8,%esp
+  80058d:	56                   	push   %esi
+  80058e:	83 ec 04             	sub    $0x4,%esp
+  800591:	ff 75 e4             	push   -0x1c(%ebp)
+  800594:	ff 75 e0             	push   -0x20(%ebp)
+  800597:	ff 75 dc             	push   -0x24(%ebp)
+  80059a:	ff 75 d8             	push   -0x28(%ebp)
+  80059d:	e8 d1 33 00 00       	call   803973 <__umoddi3>
+  8005a2:	83 c4 14             	add    $0x14,%esp
+  8005a5:	0f be 80 eb 3c 80 00 	movsbl 0x803ceb(%eax),%eax
+  8005ac:	50                   	push   %eax
+  8005ad:	ff d7                	call   *%edi
+}
+  8005af:	83 c4 10             	add    $0x10,%esp
+  8005b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005b5:	5b                   	pop    %ebx
+  8005b6:	5e                   	pop    %esi
+  8005b7:	5f                   	pop    %edi
+  8005b8:	5d                   	pop    %ebp
+  8005b9:	c3                   	ret
+
+008005ba <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005ba:	55                   	push   %ebp
+  8005bb:	89 e5                	mov    %esp,%ebp
+  8005bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8005c0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8005c4:	8b 10                	mov    (%eax),%edx
+  8005c6:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005c9:	73 0a                	jae    8005d5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005cb:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005ce:	89 08                	mov    %ecx,(%eax)
+  8005d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005d3:	88 02                	mov    %al,(%edx)
+}
+  8005d5:	5d                   	pop    %ebp
+  8005d6:	c3                   	ret
+
+008005d7 <printfmt>:
+{
+  8005d7:	55                   	push   %ebp
+  8005d8:	89 e5                	mov    %esp,%ebp
+  8005da:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005dd:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005e0:	50                   	push   %eax
+  8005e1:	ff 75 10             	push   0x10(%ebp)
+  8005e4:	ff 75 0c             	push   0xc(%ebp)
+  8005e7:	ff 75 08             	push   0x8(%ebp)
+  8005ea:	e8 05 00 00 00       	call   8005f4 <vprintfmt>
+}
+  8005ef:	83 c4 10             	add    $0x10,%esp
+  8005f2:	c9                   	leave
+  8005f3:	c3                   	ret
+
+008005f4 <vprintfmt>:
+{
+  8005f4:	55                   	push   %ebp
+  8005f5:	89 e5                	mov    %esp,%ebp
+  8005f7:	57                   	push   %edi
+  8005f8:	56                   	push   %esi
+  8005f9:	53                   	push   %ebx
+  8005fa:	83 ec 2c             	sub    $0x2c,%esp
+  8005fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800600:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800603:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800606:	eb 0a                	jmp    800612 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800608:	83 ec 08             	sub    $0x8,%esp
+  80060b:	53                   	push   %ebx
+  80060c:	50                   	push   %eax
+  80060d:	ff d6                	call   *%esi
+  80060f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800612:	83 c7 01             	add    $0x1,%edi
+  800615:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800619:	83 f8 25             	cmp    $0x25,%eax
+  80061c:	74 0c                	je     80062a <vprintfmt+0x36>
+			if (ch == '\0')
+  80061e:	85 c0                	test   %eax,%eax
+  800620:	75 e6                	jne    800608 <vprintfmt+0x14>
+}
+  800622:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800625:	5b                   	pop    %ebx
+  800626:	5e                   	pop    %esi
+  800627:	5f                   	pop    %edi
+  800628:	5d                   	pop    %ebp
+  800629:	c3                   	ret
+		padc = ' ';
+  80062a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80062e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800635:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80063c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800643:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800648:	8d 47 01             	lea    0x1(%edi),%eax
+  80064b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80064e:	0f b6 17             	movzbl (%edi),%edx
+  800651:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800654:	3c 55                	cmp    $0x55,%al
+  800656:	0f 87 cf 03 00 00    	ja     800a2b <vprintfmt+0x437>
+  80065c:	0f b6 c0             	movzbl %al,%eax
+  80065f:	ff 24 85 40 3e 80 00 	jmp    *0x803e40(,%eax,4)
+  800666:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800669:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80066d:	eb d9                	jmp    800648 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80066f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800672:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800676:	eb d0                	jmp    800648 <vprintfmt+0x54>
+  800678:	0f b6 d2             	movzbl %dl,%edx
+  80067b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80067e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800683:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800686:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800689:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80068d:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800690:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800693:	83 f9 09             	cmp    $0x9,%ecx
+  800696:	77 55                	ja     8006ed <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800698:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80069b:	eb e9                	jmp    800686 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80069d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a0:	8b 00                	mov    (%eax),%eax
+  8006a2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ab:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006ae:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8006b1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006b5:	79 91                	jns    800648 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8006b7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006ba:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006bd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8006c4:	eb 82                	jmp    800648 <vprintfmt+0x54>
+			if (width < 0)
+  8006c6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006c9:	85 d2                	test   %edx,%edx
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d0:	0f 49 c2             	cmovns %edx,%eax
+  8006d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006d6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006d9:	e9 6a ff ff ff       	jmp    800648 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8006e1:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006e8:	e9 5b ff ff ff       	jmp    800648 <vprintfmt+0x54>
+  8006ed:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006f0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006f3:	eb bc                	jmp    8006b1 <vprintfmt+0xbd>
+			lflag++;
+  8006f5:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8006fb:	e9 48 ff ff ff       	jmp    800648 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800700:	8b 45 14             	mov    0x14(%ebp),%eax
+  800703:	8d 78 04             	lea    0x4(%eax),%edi
+  800706:	83 ec 08             	sub    $0x8,%esp
+  800709:	53                   	push   %ebx
+  80070a:	ff 30                	push   (%eax)
+  80070c:	ff d6                	call   *%esi
+			break;
+  80070e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800711:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800714:	e9 b1 02 00 00       	jmp    8009ca <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80071f:	8b 10                	mov    (%eax),%edx
+  800721:	89 d0                	mov    %edx,%eax
+  800723:	f7 d8                	neg    %eax
+  800725:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800728:	83 f8 11             	cmp    $0x11,%eax
+  80072b:	7f 23                	jg     800750 <vprintfmt+0x15c>
+  80072d:	8b 14 85 a0 3f 80 00 	mov    0x803fa0(,%eax,4),%edx
+  800734:	85 d2                	test   %edx,%edx
+  800736:	74 18                	je     800750 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800738:	52                   	push   %edx
+  800739:	68 59 40 80 00       	push   $0x804059
+  80073e:	53                   	push   %ebx
+  80073f:	56                   	push   %esi
+  800740:	e8 92 fe ff ff       	call   8005d7 <printfmt>
+  800745:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800748:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80074b:	e9 7a 02 00 00       	jmp    8009ca <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800750:	50                   	push   %eax
+  800751:	68 03 3d 80 00       	push   $0x803d03
+  800756:	53                   	push   %ebx
+  800757:	56                   	push   %esi
+  800758:	e8 7a fe ff ff       	call   8005d7 <printfmt>
+  80075d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800760:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800763:	e9 62 02 00 00       	jmp    8009ca <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800768:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076b:	83 c0 04             	add    $0x4,%eax
+  80076e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800771:	8b 45 14             	mov    0x14(%ebp),%eax
+  800774:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800776:	85 c9                	test   %ecx,%ecx
+  800778:	b8 fc 3c 80 00       	mov    $0x803cfc,%eax
+  80077d:	0f 45 c1             	cmovne %ecx,%eax
+  800780:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800783:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800787:	7e 06                	jle    80078f <vprintfmt+0x19b>
+  800789:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80078d:	75 0b                	jne    80079a <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80078f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800792:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800795:	89 75 08             	mov    %esi,0x8(%ebp)
+  800798:	eb 5c                	jmp    8007f6 <vprintfmt+0x202>
+  80079a:	83 ec 08             	sub    $0x8,%esp
+  80079d:	ff 75 d0             	push   -0x30(%ebp)
+  8007a0:	ff 75 cc             	push   -0x34(%ebp)
+  8007a3:	e8 20 03 00 00       	call   800ac8 <strnlen>
+  8007a8:	89 c2                	mov    %eax,%edx
+  8007aa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007ad:	29 d0                	sub    %edx,%eax
+  8007af:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8007b2:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8007b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007b9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8007bc:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007be:	eb 0e                	jmp    8007ce <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8007c0:	83 ec 08             	sub    $0x8,%esp
+  8007c3:	53                   	push   %ebx
+  8007c4:	57                   	push   %edi
+  8007c5:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007c8:	83 ee 01             	sub    $0x1,%esi
+  8007cb:	83 c4 10             	add    $0x10,%esp
+  8007ce:	85 f6                	test   %esi,%esi
+  8007d0:	7f ee                	jg     8007c0 <vprintfmt+0x1cc>
+  8007d2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007d8:	85 c0                	test   %eax,%eax
+  8007da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007df:	0f 49 d0             	cmovns %eax,%edx
+  8007e2:	29 d0                	sub    %edx,%eax
+  8007e4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007e7:	eb a6                	jmp    80078f <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8007e9:	83 ec 08             	sub    $0x8,%esp
+  8007ec:	53                   	push   %ebx
+  8007ed:	52                   	push   %edx
+  8007ee:	ff 55 08             	call   *0x8(%ebp)
+  8007f1:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007f4:	89 f1                	mov    %esi,%ecx
+  8007f6:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007f9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007fd:	0f be d0             	movsbl %al,%edx
+  800800:	85 d2                	test   %edx,%edx
+  800802:	74 28                	je     80082c <vprintfmt+0x238>
+  800804:	85 ff                	test   %edi,%edi
+  800806:	78 05                	js     80080d <vprintfmt+0x219>
+  800808:	83 ef 01             	sub    $0x1,%edi
+  80080b:	78 30                	js     80083d <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80080d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800811:	74 d6                	je     8007e9 <vprintfmt+0x1f5>
+  800813:	0f be c0             	movsbl %al,%eax
+  800816:	83 e8 20             	sub    $0x20,%eax
+  800819:	83 f8 5e             	cmp    $0x5e,%eax
+  80081c:	76 cb                	jbe    8007e9 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80081e:	83 ec 08             	sub    $0x8,%esp
+  800821:	53                   	push   %ebx
+  800822:	6a 3f                	push   $0x3f
+  800824:	ff 55 08             	call   *0x8(%ebp)
+  800827:	83 c4 10             	add    $0x10,%esp
+  80082a:	eb c8                	jmp    8007f4 <vprintfmt+0x200>
+  80082c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80082f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800832:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800835:	01 d0                	add    %edx,%eax
+  800837:	29 c8                	sub    %ecx,%eax
+  800839:	89 c7                	mov    %eax,%edi
+  80083b:	eb 13                	jmp    800850 <vprintfmt+0x25c>
+  80083d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800840:	eb ed                	jmp    80082f <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800842:	83 ec 08             	sub    $0x8,%esp
+  800845:	53                   	push   %ebx
+  800846:	6a 20                	push   $0x20
+  800848:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80084a:	83 ef 01             	sub    $0x1,%edi
+  80084d:	83 c4 10             	add    $0x10,%esp
+  800850:	85 ff                	test   %edi,%edi
+  800852:	7f ee                	jg     800842 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800854:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800857:	89 45 14             	mov    %eax,0x14(%ebp)
+  80085a:	e9 6b 01 00 00       	jmp    8009ca <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80085f:	83 f9 01             	cmp    $0x1,%ecx
+  800862:	7f 1f                	jg     800883 <vprintfmt+0x28f>
+	else if (lflag)
+  800864:	85 c9                	test   %ecx,%ecx
+  800866:	74 67                	je     8008cf <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800868:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086b:	8b 00                	mov    (%eax),%eax
+  80086d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800870:	89 c1                	mov    %eax,%ecx
+  800872:	c1 f9 1f             	sar    $0x1f,%ecx
+  800875:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800878:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087b:	8d 40 04             	lea    0x4(%eax),%eax
+  80087e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800881:	eb 17                	jmp    80089a <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800883:	8b 45 14             	mov    0x14(%ebp),%eax
+  800886:	8b 50 04             	mov    0x4(%eax),%edx
+  800889:	8b 00                	mov    (%eax),%eax
+  80088b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80088e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800891:	8b 45 14             	mov    0x14(%ebp),%eax
+  800894:	8d 40 08             	lea    0x8(%eax),%eax
+  800897:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80089a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80089d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8008a0:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8008a5:	85 c9                	test   %ecx,%ecx
+  8008a7:	0f 89 03 01 00 00    	jns    8009b0 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8008ad:	83 ec 08             	sub    $0x8,%esp
+  8008b0:	53                   	push   %ebx
+  8008b1:	6a 2d                	push   $0x2d
+  8008b3:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8008b5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008b8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008bb:	f7 da                	neg    %edx
+  8008bd:	83 d1 00             	adc    $0x0,%ecx
+  8008c0:	f7 d9                	neg    %ecx
+  8008c2:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8008c5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8008ca:	e9 e1 00 00 00       	jmp    8009b0 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8008cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d2:	8b 00                	mov    (%eax),%eax
+  8008d4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008d7:	89 c1                	mov    %eax,%ecx
+  8008d9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008dc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008e8:	eb b0                	jmp    80089a <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8008ea:	83 f9 01             	cmp    $0x1,%ecx
+  8008ed:	7f 1e                	jg     80090d <vprintfmt+0x319>
+	else if (lflag)
+  8008ef:	85 c9                	test   %ecx,%ecx
+  8008f1:	74 32                	je     800925 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8008f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f6:	8b 10                	mov    (%eax),%edx
+  8008f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008fd:	8d 40 04             	lea    0x4(%eax),%eax
+  800900:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800903:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800908:	e9 a3 00 00 00       	jmp    8009b0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80090d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800910:	8b 10                	mov    (%eax),%edx
+  800912:	8b 48 04             	mov    0x4(%eax),%ecx
+  800915:	8d 40 08             	lea    0x8(%eax),%eax
+  800918:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80091b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800920:	e9 8b 00 00 00       	jmp    8009b0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800925:	8b 45 14             	mov    0x14(%ebp),%eax
+  800928:	8b 10                	mov    (%eax),%edx
+  80092a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80092f:	8d 40 04             	lea    0x4(%eax),%eax
+  800932:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800935:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80093a:	eb 74                	jmp    8009b0 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80093c:	83 f9 01             	cmp    $0x1,%ecx
+  80093f:	7f 1b                	jg     80095c <vprintfmt+0x368>
+	else if (lflag)
+  800941:	85 c9                	test   %ecx,%ecx
+  800943:	74 2c                	je     800971 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800945:	8b 45 14             	mov    0x14(%ebp),%eax
+  800948:	8b 10                	mov    (%eax),%edx
+  80094a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094f:	8d 40 04             	lea    0x4(%eax),%eax
+  800952:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800955:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80095a:	eb 54                	jmp    8009b0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80095c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095f:	8b 10                	mov    (%eax),%edx
+  800961:	8b 48 04             	mov    0x4(%eax),%ecx
+  800964:	8d 40 08             	lea    0x8(%eax),%eax
+  800967:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80096a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80096f:	eb 3f                	jmp    8009b0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800971:	8b 45 14             	mov    0x14(%ebp),%eax
+  800974:	8b 10                	mov    (%eax),%edx
+  800976:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80097b:	8d 40 04             	lea    0x4(%eax),%eax
+  80097e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800981:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800986:	eb 28                	jmp    8009b0 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800988:	83 ec 08             	sub    $0x8,%esp
+  80098b:	53                   	push   %ebx
+  80098c:	6a 30                	push   $0x30
+  80098e:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800990:	83 c4 08             	add    $0x8,%esp
+  800993:	53                   	push   %ebx
+  800994:	6a 78                	push   $0x78
+  800996:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800998:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099b:	8b 10                	mov    (%eax),%edx
+  80099d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8009a2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8009a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009ab:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8009b0:	83 ec 0c             	sub    $0xc,%esp
+  8009b3:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8009b7:	50                   	push   %eax
+  8009b8:	ff 75 e0             	push   -0x20(%ebp)
+  8009bb:	57                   	push   %edi
+  8009bc:	51                   	push   %ecx
+  8009bd:	52                   	push   %edx
+  8009be:	89 da                	mov    %ebx,%edx
+  8009c0:	89 f0                	mov    %esi,%eax
+  8009c2:	e8 4a fb ff ff       	call   800511 <printnum>
+			break;
+  8009c7:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8009ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8009cd:	e9 40 fc ff ff       	jmp    800612 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8009d2:	83 f9 01             	cmp    $0x1,%ecx
+  8009d5:	7f 1b                	jg     8009f2 <vprintfmt+0x3fe>
+	else if (lflag)
+  8009d7:	85 c9                	test   %ecx,%ecx
+  8009d9:	74 2c                	je     800a07 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8009db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009de:	8b 10                	mov    (%eax),%edx
+  8009e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009eb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8009f0:	eb be                	jmp    8009b0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f5:	8b 10                	mov    (%eax),%edx
+  8009f7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009fa:	8d 40 08             	lea    0x8(%eax),%eax
+  8009fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a00:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800a05:	eb a9                	jmp    8009b0 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800a07:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0a:	8b 10                	mov    (%eax),%edx
+  800a0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a11:	8d 40 04             	lea    0x4(%eax),%eax
+  800a14:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a17:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800a1c:	eb 92                	jmp    8009b0 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800a1e:	83 ec 08             	sub    $0x8,%esp
+  800a21:	53                   	push   %ebx
+  800a22:	6a 25                	push   $0x25
+  800a24:	ff d6                	call   *%esi
+			break;
+  800a26:	83 c4 10             	add    $0x10,%esp
+  800a29:	eb 9f                	jmp    8009ca <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800a2b:	83 ec 08             	sub    $0x8,%esp
+  800a2e:	53                   	push   %ebx
+  800a2f:	6a 25                	push   $0x25
+  800a31:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a33:	83 c4 10             	add    $0x10,%esp
+  800a36:	89 f8                	mov    %edi,%eax
+  800a38:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a3c:	74 05                	je     800a43 <vprintfmt+0x44f>
+  800a3e:	83 e8 01             	sub    $0x1,%eax
+  800a41:	eb f5                	jmp    800a38 <vprintfmt+0x444>
+  800a43:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a46:	eb 82                	jmp    8009ca <vprintfmt+0x3d6>
+
+00800a48 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a48:	55                   	push   %ebp
+  800a49:	89 e5                	mov    %esp,%ebp
+  800a4b:	83 ec 18             	sub    $0x18,%esp
+  800a4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a51:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a54:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a57:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a5b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a5e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a65:	85 c0                	test   %eax,%eax
+  800a67:	74 26                	je     800a8f <vsnprintf+0x47>
+  800a69:	85 d2                	test   %edx,%edx
+  800a6b:	7e 22                	jle    800a8f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a6d:	ff 75 14             	push   0x14(%ebp)
+  800a70:	ff 75 10             	push   0x10(%ebp)
+  800a73:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a76:	50                   	push   %eax
+  800a77:	68 ba 05 80 00       	push   $0x8005ba
+  800a7c:	e8 73 fb ff ff       	call   8005f4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a81:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a84:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a8a:	83 c4 10             	add    $0x10,%esp
+}
+  800a8d:	c9                   	leave
+  800a8e:	c3                   	ret
+		return -E_INVAL;
+  800a8f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a94:	eb f7                	jmp    800a8d <vsnprintf+0x45>
+
+00800a96 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a96:	55                   	push   %ebp
+  800a97:	89 e5                	mov    %esp,%ebp
+  800a99:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a9c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a9f:	50                   	push   %eax
+  800aa0:	ff 75 10             	push   0x10(%ebp)
+  800aa3:	ff 75 0c             	push   0xc(%ebp)
+  800aa6:	ff 75 08             	push   0x8(%ebp)
+  800aa9:	e8 9a ff ff ff       	call   800a48 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800aae:	c9                   	leave
+  800aaf:	c3                   	ret
+
+00800ab0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800ab0:	55                   	push   %ebp
+  800ab1:	89 e5                	mov    %esp,%ebp
+  800ab3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ab6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abb:	eb 03                	jmp    800ac0 <strlen+0x10>
+		n++;
+  800abd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800ac0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800ac4:	75 f7                	jne    800abd <strlen+0xd>
+	return n;
+}
+  800ac6:	5d                   	pop    %ebp
+  800ac7:	c3                   	ret
+
+00800ac8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800ac8:	55                   	push   %ebp
+  800ac9:	89 e5                	mov    %esp,%ebp
+  800acb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ace:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad6:	eb 03                	jmp    800adb <strnlen+0x13>
+		n++;
+  800ad8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800adb:	39 d0                	cmp    %edx,%eax
+  800add:	74 08                	je     800ae7 <strnlen+0x1f>
+  800adf:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ae3:	75 f3                	jne    800ad8 <strnlen+0x10>
+  800ae5:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800ae7:	89 d0                	mov    %edx,%eax
+  800ae9:	5d                   	pop    %ebp
+  800aea:	c3                   	ret
+
+00800aeb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800aeb:	55                   	push   %ebp
+  800aec:	89 e5                	mov    %esp,%ebp
+  800aee:	53                   	push   %ebx
+  800aef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800af2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800af5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800afa:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800afe:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b01:	83 c0 01             	add    $0x1,%eax
+  800b04:	84 d2                	test   %dl,%dl
+  800b06:	75 f2                	jne    800afa <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b08:	89 c8                	mov    %ecx,%eax
+  800b0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b0d:	c9                   	leave
+  800b0e:	c3                   	ret
+
+00800b0f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b0f:	55                   	push   %ebp
+  800b10:	89 e5                	mov    %esp,%ebp
+  800b12:	53                   	push   %ebx
+  800b13:	83 ec 10             	sub    $0x10,%esp
+  800b16:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b19:	53                   	push   %ebx
+  800b1a:	e8 91 ff ff ff       	call   800ab0 <strlen>
+  800b1f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b22:	ff 75 0c             	push   0xc(%ebp)
+  800b25:	01 d8                	add    %ebx,%eax
+  800b27:	50                   	push   %eax
+  800b28:	e8 be ff ff ff       	call   800aeb <strcpy>
+	return dst;
+}
+  800b2d:	89 d8                	mov    %ebx,%eax
+  800b2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b32:	c9                   	leave
+  800b33:	c3                   	ret
+
+00800b34 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b34:	55                   	push   %ebp
+  800b35:	89 e5                	mov    %esp,%ebp
+  800b37:	56                   	push   %esi
+  800b38:	53                   	push   %ebx
+  800b39:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b3c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b3f:	89 f3                	mov    %esi,%ebx
+  800b41:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b44:	89 f0                	mov    %esi,%eax
+  800b46:	eb 0f                	jmp    800b57 <strncpy+0x23>
+		*dst++ = *src;
+  800b48:	83 c0 01             	add    $0x1,%eax
+  800b4b:	0f b6 0a             	movzbl (%edx),%ecx
+  800b4e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b51:	80 f9 01             	cmp    $0x1,%cl
+  800b54:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b57:	39 d8                	cmp    %ebx,%eax
+  800b59:	75 ed                	jne    800b48 <strncpy+0x14>
+	}
+	return ret;
+}
+  800b5b:	89 f0                	mov    %esi,%eax
+  800b5d:	5b                   	pop    %ebx
+  800b5e:	5e                   	pop    %esi
+  800b5f:	5d                   	pop    %ebp
+  800b60:	c3                   	ret
+
+00800b61 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b61:	55                   	push   %ebp
+  800b62:	89 e5                	mov    %esp,%ebp
+  800b64:	56                   	push   %esi
+  800b65:	53                   	push   %ebx
+  800b66:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b6c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b6f:	89 f0                	mov    %esi,%eax
+  800b71:	85 d2                	test   %edx,%edx
+  800b73:	74 21                	je     800b96 <strlcpy+0x35>
+  800b75:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b79:	89 f2                	mov    %esi,%edx
+  800b7b:	eb 09                	jmp    800b86 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b7d:	83 c1 01             	add    $0x1,%ecx
+  800b80:	83 c2 01             	add    $0x1,%edx
+  800b83:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b86:	39 c2                	cmp    %eax,%edx
+  800b88:	74 09                	je     800b93 <strlcpy+0x32>
+  800b8a:	0f b6 19             	movzbl (%ecx),%ebx
+  800b8d:	84 db                	test   %bl,%bl
+  800b8f:	75 ec                	jne    800b7d <strlcpy+0x1c>
+  800b91:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b93:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b96:	29 f0                	sub    %esi,%eax
+}
+  800b98:	5b                   	pop    %ebx
+  800b99:	5e                   	pop    %esi
+  800b9a:	5d                   	pop    %ebp
+  800b9b:	c3                   	ret
+
+00800b9c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b9c:	55                   	push   %ebp
+  800b9d:	89 e5                	mov    %esp,%ebp
+  800b9f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ba2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ba5:	eb 06                	jmp    800bad <strcmp+0x11>
+		p++, q++;
+  800ba7:	83 c1 01             	add    $0x1,%ecx
+  800baa:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800bad:	0f b6 01             	movzbl (%ecx),%eax
+  800bb0:	84 c0                	test   %al,%al
+  800bb2:	74 04                	je     800bb8 <strcmp+0x1c>
+  800bb4:	3a 02                	cmp    (%edx),%al
+  800bb6:	74 ef                	je     800ba7 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bb8:	0f b6 c0             	movzbl %al,%eax
+  800bbb:	0f b6 12             	movzbl (%edx),%edx
+  800bbe:	29 d0                	sub    %edx,%eax
+}
+  800bc0:	5d                   	pop    %ebp
+  800bc1:	c3                   	ret
+
+00800bc2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800bc2:	55                   	push   %ebp
+  800bc3:	89 e5                	mov    %esp,%ebp
+  800bc5:	53                   	push   %ebx
+  800bc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bcc:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800bcf:	eb 09                	jmp    800bda <strncmp+0x18>
+		n--, p++, q++;
+  800bd1:	83 ea 01             	sub    $0x1,%edx
+  800bd4:	83 c0 01             	add    $0x1,%eax
+  800bd7:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800bda:	85 d2                	test   %edx,%edx
+  800bdc:	74 18                	je     800bf6 <strncmp+0x34>
+  800bde:	0f b6 18             	movzbl (%eax),%ebx
+  800be1:	84 db                	test   %bl,%bl
+  800be3:	74 04                	je     800be9 <strncmp+0x27>
+  800be5:	3a 19                	cmp    (%ecx),%bl
+  800be7:	74 e8                	je     800bd1 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800be9:	0f b6 00             	movzbl (%eax),%eax
+  800bec:	0f b6 11             	movzbl (%ecx),%edx
+  800bef:	29 d0                	sub    %edx,%eax
+}
+  800bf1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bf4:	c9                   	leave
+  800bf5:	c3                   	ret
+		return 0;
+  800bf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfb:	eb f4                	jmp    800bf1 <strncmp+0x2f>
+
+00800bfd <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c03:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c07:	eb 03                	jmp    800c0c <strchr+0xf>
+  800c09:	83 c0 01             	add    $0x1,%eax
+  800c0c:	0f b6 10             	movzbl (%eax),%edx
+  800c0f:	84 d2                	test   %dl,%dl
+  800c11:	74 06                	je     800c19 <strchr+0x1c>
+		if (*s == c)
+  800c13:	38 ca                	cmp    %cl,%dl
+  800c15:	75 f2                	jne    800c09 <strchr+0xc>
+  800c17:	eb 05                	jmp    800c1e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800c19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c1e:	5d                   	pop    %ebp
+  800c1f:	c3                   	ret
+
+00800c20 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c20:	55                   	push   %ebp
+  800c21:	89 e5                	mov    %esp,%ebp
+  800c23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c26:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c2a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800c2d:	38 ca                	cmp    %cl,%dl
+  800c2f:	74 09                	je     800c3a <strfind+0x1a>
+  800c31:	84 d2                	test   %dl,%dl
+  800c33:	74 05                	je     800c3a <strfind+0x1a>
+	for (; *s; s++)
+  800c35:	83 c0 01             	add    $0x1,%eax
+  800c38:	eb f0                	jmp    800c2a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c3a:	5d                   	pop    %ebp
+  800c3b:	c3                   	ret
+
+00800c3c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c3c:	55                   	push   %ebp
+  800c3d:	89 e5                	mov    %esp,%ebp
+  800c3f:	57                   	push   %edi
+  800c40:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c43:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c46:	85 c9                	test   %ecx,%ecx
+  800c48:	74 20                	je     800c6a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c4a:	89 f8                	mov    %edi,%eax
+  800c4c:	09 c8                	or     %ecx,%eax
+  800c4e:	a8 03                	test   $0x3,%al
+  800c50:	75 12                	jne    800c64 <memset+0x28>
+		c &= 0xFF;
+  800c52:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c56:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c5c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c5f:	fc                   	cld
+  800c60:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c62:	eb 06                	jmp    800c6a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c64:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c67:	fc                   	cld
+  800c68:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c6a:	89 f8                	mov    %edi,%eax
+  800c6c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c6f:	c9                   	leave
+  800c70:	c3                   	ret
+
+00800c71 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c71:	55                   	push   %ebp
+  800c72:	89 e5                	mov    %esp,%ebp
+  800c74:	57                   	push   %edi
+  800c75:	56                   	push   %esi
+  800c76:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c79:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c7c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c7f:	39 c6                	cmp    %eax,%esi
+  800c81:	73 32                	jae    800cb5 <memmove+0x44>
+  800c83:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c86:	39 d0                	cmp    %edx,%eax
+  800c88:	73 2b                	jae    800cb5 <memmove+0x44>
+		s += n;
+		d += n;
+  800c8a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c8d:	89 d6                	mov    %edx,%esi
+  800c8f:	09 fe                	or     %edi,%esi
+  800c91:	09 ce                	or     %ecx,%esi
+  800c93:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c99:	75 0e                	jne    800ca9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c9b:	83 ef 04             	sub    $0x4,%edi
+  800c9e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ca1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ca4:	fd                   	std
+  800ca5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ca7:	eb 09                	jmp    800cb2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ca9:	83 ef 01             	sub    $0x1,%edi
+  800cac:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800caf:	fd                   	std
+  800cb0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800cb2:	fc                   	cld
+  800cb3:	eb 1a                	jmp    800ccf <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800cb5:	89 f2                	mov    %esi,%edx
+  800cb7:	09 c2                	or     %eax,%edx
+  800cb9:	09 ca                	or     %ecx,%edx
+  800cbb:	f6 c2 03             	test   $0x3,%dl
+  800cbe:	75 0a                	jne    800cca <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800cc0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800cc3:	89 c7                	mov    %eax,%edi
+  800cc5:	fc                   	cld
+  800cc6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800cc8:	eb 05                	jmp    800ccf <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800cca:	89 c7                	mov    %eax,%edi
+  800ccc:	fc                   	cld
+  800ccd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ccf:	5e                   	pop    %esi
+  800cd0:	5f                   	pop    %edi
+  800cd1:	5d                   	pop    %ebp
+  800cd2:	c3                   	ret
+
+00800cd3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800cd3:	55                   	push   %ebp
+  800cd4:	89 e5                	mov    %esp,%ebp
+  800cd6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800cd9:	ff 75 10             	push   0x10(%ebp)
+  800cdc:	ff 75 0c             	push   0xc(%ebp)
+  800cdf:	ff 75 08             	push   0x8(%ebp)
+  800ce2:	e8 8a ff ff ff       	call   800c71 <memmove>
+}
+  800ce7:	c9                   	leave
+  800ce8:	c3                   	ret
+
+00800ce9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ce9:	55                   	push   %ebp
+  800cea:	89 e5                	mov    %esp,%ebp
+  800cec:	56                   	push   %esi
+  800ced:	53                   	push   %ebx
+  800cee:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800cf4:	89 c6                	mov    %eax,%esi
+  800cf6:	03 75 10             	add    0x10(%ebp),%esi
+  800cf9:	eb 06                	jmp    800d01 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cfb:	83 c0 01             	add    $0x1,%eax
+  800cfe:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d01:	39 f0                	cmp    %esi,%eax
+  800d03:	74 14                	je     800d19 <memcmp+0x30>
+		if (*s1 != *s2)
+  800d05:	0f b6 08             	movzbl (%eax),%ecx
+  800d08:	0f b6 1a             	movzbl (%edx),%ebx
+  800d0b:	38 d9                	cmp    %bl,%cl
+  800d0d:	74 ec                	je     800cfb <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800d0f:	0f b6 c1             	movzbl %cl,%eax
+  800d12:	0f b6 db             	movzbl %bl,%ebx
+  800d15:	29 d8                	sub    %ebx,%eax
+  800d17:	eb 05                	jmp    800d1e <memcmp+0x35>
+	}
+
+	return 0;
+  800d19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d1e:	5b                   	pop    %ebx
+  800d1f:	5e                   	pop    %esi
+  800d20:	5d                   	pop    %ebp
+  800d21:	c3                   	ret
+
+00800d22 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800d22:	55                   	push   %ebp
+  800d23:	89 e5                	mov    %esp,%ebp
+  800d25:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800d2b:	89 c2                	mov    %eax,%edx
+  800d2d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800d30:	eb 03                	jmp    800d35 <memfind+0x13>
+  800d32:	83 c0 01             	add    $0x1,%eax
+  800d35:	39 d0                	cmp    %edx,%eax
+  800d37:	73 04                	jae    800d3d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d39:	38 08                	cmp    %cl,(%eax)
+  800d3b:	75 f5                	jne    800d32 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d3d:	5d                   	pop    %ebp
+  800d3e:	c3                   	ret
+
+00800d3f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d3f:	55                   	push   %ebp
+  800d40:	89 e5                	mov    %esp,%ebp
+  800d42:	57                   	push   %edi
+  800d43:	56                   	push   %esi
+  800d44:	53                   	push   %ebx
+  800d45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d4b:	eb 03                	jmp    800d50 <strtol+0x11>
+		s++;
+  800d4d:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d50:	0f b6 02             	movzbl (%edx),%eax
+  800d53:	3c 20                	cmp    $0x20,%al
+  800d55:	74 f6                	je     800d4d <strtol+0xe>
+  800d57:	3c 09                	cmp    $0x9,%al
+  800d59:	74 f2                	je     800d4d <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d5b:	3c 2b                	cmp    $0x2b,%al
+  800d5d:	74 2a                	je     800d89 <strtol+0x4a>
+	int neg = 0;
+  800d5f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d64:	3c 2d                	cmp    $0x2d,%al
+  800d66:	74 2b                	je     800d93 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d68:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d6e:	75 0f                	jne    800d7f <strtol+0x40>
+  800d70:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d73:	74 28                	je     800d9d <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d75:	85 db                	test   %ebx,%ebx
+  800d77:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d7c:	0f 44 d8             	cmove  %eax,%ebx
+  800d7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d84:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d87:	eb 46                	jmp    800dcf <strtol+0x90>
+		s++;
+  800d89:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d91:	eb d5                	jmp    800d68 <strtol+0x29>
+		s++, neg = 1;
+  800d93:	83 c2 01             	add    $0x1,%edx
+  800d96:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d9b:	eb cb                	jmp    800d68 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d9d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800da1:	74 0e                	je     800db1 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800da3:	85 db                	test   %ebx,%ebx
+  800da5:	75 d8                	jne    800d7f <strtol+0x40>
+		s++, base = 8;
+  800da7:	83 c2 01             	add    $0x1,%edx
+  800daa:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800daf:	eb ce                	jmp    800d7f <strtol+0x40>
+		s += 2, base = 16;
+  800db1:	83 c2 02             	add    $0x2,%edx
+  800db4:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800db9:	eb c4                	jmp    800d7f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800dbb:	0f be c0             	movsbl %al,%eax
+  800dbe:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800dc1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800dc4:	7d 3a                	jge    800e00 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800dc6:	83 c2 01             	add    $0x1,%edx
+  800dc9:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800dcd:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800dcf:	0f b6 02             	movzbl (%edx),%eax
+  800dd2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800dd5:	89 f3                	mov    %esi,%ebx
+  800dd7:	80 fb 09             	cmp    $0x9,%bl
+  800dda:	76 df                	jbe    800dbb <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ddc:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ddf:	89 f3                	mov    %esi,%ebx
+  800de1:	80 fb 19             	cmp    $0x19,%bl
+  800de4:	77 08                	ja     800dee <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800de6:	0f be c0             	movsbl %al,%eax
+  800de9:	83 e8 57             	sub    $0x57,%eax
+  800dec:	eb d3                	jmp    800dc1 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800dee:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800df1:	89 f3                	mov    %esi,%ebx
+  800df3:	80 fb 19             	cmp    $0x19,%bl
+  800df6:	77 08                	ja     800e00 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800df8:	0f be c0             	movsbl %al,%eax
+  800dfb:	83 e8 37             	sub    $0x37,%eax
+  800dfe:	eb c1                	jmp    800dc1 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800e00:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e04:	74 05                	je     800e0b <strtol+0xcc>
+		*endptr = (char *) s;
+  800e06:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e09:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800e0b:	89 c8                	mov    %ecx,%eax
+  800e0d:	f7 d8                	neg    %eax
+  800e0f:	85 ff                	test   %edi,%edi
+  800e11:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800e14:	89 c8                	mov    %ecx,%eax
+  800e16:	5b                   	pop    %ebx
+  800e17:	5e                   	pop    %esi
+  800e18:	5f                   	pop    %edi
+  800e19:	5d                   	pop    %ebp
+  800e1a:	c3                   	ret
+
+00800e1b <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e1b:	55                   	push   %ebp
+  800e1c:	89 e5                	mov    %esp,%ebp
+  800e1e:	57                   	push   %edi
+  800e1f:	56                   	push   %esi
+  800e20:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2c:	89 c3                	mov    %eax,%ebx
+  800e2e:	89 c7                	mov    %eax,%edi
+  800e30:	55                   	push   %ebp
+  800e31:	89 e5                	mov    %esp,%ebp
+  800e33:	8d 35 3b 0e 80 00    	lea    0x800e3b,%esi
+  800e39:	0f 34                	sysenter
+  800e3b:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800e3c:	5b                   	pop    %ebx
+  800e3d:	5e                   	pop    %esi
+  800e3e:	5f                   	pop    %edi
+  800e3f:	5d                   	pop    %ebp
+  800e40:	c3                   	ret
+
+00800e41 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e41:	55                   	push   %ebp
+  800e42:	89 e5                	mov    %esp,%ebp
+  800e44:	57                   	push   %edi
+  800e45:	56                   	push   %esi
+  800e46:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e51:	89 d1                	mov    %edx,%ecx
+  800e53:	89 d3                	mov    %edx,%ebx
+  800e55:	89 d7                	mov    %edx,%edi
+  800e57:	55                   	push   %ebp
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	8d 35 62 0e 80 00    	lea    0x800e62,%esi
+  800e60:	0f 34                	sysenter
+  800e62:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800e63:	5b                   	pop    %ebx
+  800e64:	5e                   	pop    %esi
+  800e65:	5f                   	pop    %edi
+  800e66:	5d                   	pop    %ebp
+  800e67:	c3                   	ret
+
+00800e68 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e68:	55                   	push   %ebp
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	57                   	push   %edi
+  800e6c:	56                   	push   %esi
+  800e6d:	53                   	push   %ebx
+  800e6e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e71:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e79:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e7e:	89 cb                	mov    %ecx,%ebx
+  800e80:	89 cf                	mov    %ecx,%edi
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	8d 35 8d 0e 80 00    	lea    0x800e8d,%esi
+  800e8b:	0f 34                	sysenter
+  800e8d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e8e:	85 c0                	test   %eax,%eax
+  800e90:	7f 08                	jg     800e9a <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800e92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e95:	5b                   	pop    %ebx
+  800e96:	5e                   	pop    %esi
+  800e97:	5f                   	pop    %edi
+  800e98:	5d                   	pop    %ebp
+  800e99:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9a:	83 ec 0c             	sub    $0xc,%esp
+  800e9d:	50                   	push   %eax
+  800e9e:	6a 03                	push   $0x3
+  800ea0:	68 07 40 80 00       	push   $0x804007
+  800ea5:	6a 3d                	push   $0x3d
+  800ea7:	68 24 40 80 00       	push   $0x804024
+  800eac:	e8 71 f5 ff ff       	call   800422 <_panic>
+
+00800eb1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800eb1:	55                   	push   %ebp
+  800eb2:	89 e5                	mov    %esp,%ebp
+  800eb4:	57                   	push   %edi
+  800eb5:	56                   	push   %esi
+  800eb6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebc:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ec1:	89 d1                	mov    %edx,%ecx
+  800ec3:	89 d3                	mov    %edx,%ebx
+  800ec5:	89 d7                	mov    %edx,%edi
+  800ec7:	55                   	push   %ebp
+  800ec8:	89 e5                	mov    %esp,%ebp
+  800eca:	8d 35 d2 0e 80 00    	lea    0x800ed2,%esi
+  800ed0:	0f 34                	sysenter
+  800ed2:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800ed3:	5b                   	pop    %ebx
+  800ed4:	5e                   	pop    %esi
+  800ed5:	5f                   	pop    %edi
+  800ed6:	5d                   	pop    %ebp
+  800ed7:	c3                   	ret
+
+00800ed8 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ed8:	55                   	push   %ebp
+  800ed9:	89 e5                	mov    %esp,%ebp
+  800edb:	57                   	push   %edi
+  800edc:	56                   	push   %esi
+  800edd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ede:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ee8:	89 d1                	mov    %edx,%ecx
+  800eea:	89 d3                	mov    %edx,%ebx
+  800eec:	89 d7                	mov    %edx,%edi
+  800eee:	89 d6                	mov    %edx,%esi
+  800ef0:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ef2:	5b                   	pop    %ebx
+  800ef3:	5e                   	pop    %esi
+  800ef4:	5f                   	pop    %edi
+  800ef5:	5d                   	pop    %ebp
+  800ef6:	c3                   	ret
+
+00800ef7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ef7:	55                   	push   %ebp
+  800ef8:	89 e5                	mov    %esp,%ebp
+  800efa:	57                   	push   %edi
+  800efb:	56                   	push   %esi
+  800efc:	53                   	push   %ebx
+  800efd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f06:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	8d 35 1e 0f 80 00    	lea    0x800f1e,%esi
+  800f1c:	0f 34                	sysenter
+  800f1e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f1f:	85 c0                	test   %eax,%eax
+  800f21:	7f 08                	jg     800f2b <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800f23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f26:	5b                   	pop    %ebx
+  800f27:	5e                   	pop    %esi
+  800f28:	5f                   	pop    %edi
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f2b:	83 ec 0c             	sub    $0xc,%esp
+  800f2e:	50                   	push   %eax
+  800f2f:	6a 04                	push   $0x4
+  800f31:	68 07 40 80 00       	push   $0x804007
+  800f36:	6a 3d                	push   $0x3d
+  800f38:	68 24 40 80 00       	push   $0x804024
+  800f3d:	e8 e0 f4 ff ff       	call   800422 <_panic>
+
+00800f42 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f42:	55                   	push   %ebp
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	57                   	push   %edi
+  800f46:	56                   	push   %esi
+  800f47:	53                   	push   %ebx
+  800f48:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f51:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f56:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f59:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f5c:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f5f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f61:	85 c0                	test   %eax,%eax
+  800f63:	7f 08                	jg     800f6d <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f68:	5b                   	pop    %ebx
+  800f69:	5e                   	pop    %esi
+  800f6a:	5f                   	pop    %edi
+  800f6b:	5d                   	pop    %ebp
+  800f6c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6d:	83 ec 0c             	sub    $0xc,%esp
+  800f70:	50                   	push   %eax
+  800f71:	6a 05                	push   $0x5
+  800f73:	68 07 40 80 00       	push   $0x804007
+  800f78:	6a 23                	push   $0x23
+  800f7a:	68 24 40 80 00       	push   $0x804024
+  800f7f:	e8 9e f4 ff ff       	call   800422 <_panic>
+
+00800f84 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	57                   	push   %edi
+  800f88:	56                   	push   %esi
+  800f89:	53                   	push   %ebx
+  800f8a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f92:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f98:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f9d:	89 df                	mov    %ebx,%edi
+  800f9f:	55                   	push   %ebp
+  800fa0:	89 e5                	mov    %esp,%ebp
+  800fa2:	8d 35 aa 0f 80 00    	lea    0x800faa,%esi
+  800fa8:	0f 34                	sysenter
+  800faa:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800fab:	85 c0                	test   %eax,%eax
+  800fad:	7f 08                	jg     800fb7 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800faf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb2:	5b                   	pop    %ebx
+  800fb3:	5e                   	pop    %esi
+  800fb4:	5f                   	pop    %edi
+  800fb5:	5d                   	pop    %ebp
+  800fb6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb7:	83 ec 0c             	sub    $0xc,%esp
+  800fba:	50                   	push   %eax
+  800fbb:	6a 06                	push   $0x6
+  800fbd:	68 07 40 80 00       	push   $0x804007
+  800fc2:	6a 3d                	push   $0x3d
+  800fc4:	68 24 40 80 00       	push   $0x804024
+  800fc9:	e8 54 f4 ff ff       	call   800422 <_panic>
+
+00800fce <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	57                   	push   %edi
+  800fd2:	56                   	push   %esi
+  800fd3:	53                   	push   %ebx
+  800fd4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800fd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe2:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fe7:	89 df                	mov    %ebx,%edi
+  800fe9:	55                   	push   %ebp
+  800fea:	89 e5                	mov    %esp,%ebp
+  800fec:	8d 35 f4 0f 80 00    	lea    0x800ff4,%esi
+  800ff2:	0f 34                	sysenter
+  800ff4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ff5:	85 c0                	test   %eax,%eax
+  800ff7:	7f 08                	jg     801001 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800ff9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ffc:	5b                   	pop    %ebx
+  800ffd:	5e                   	pop    %esi
+  800ffe:	5f                   	pop    %edi
+  800fff:	5d                   	pop    %ebp
+  801000:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801001:	83 ec 0c             	sub    $0xc,%esp
+  801004:	50                   	push   %eax
+  801005:	6a 08                	push   $0x8
+  801007:	68 07 40 80 00       	push   $0x804007
+  80100c:	6a 3d                	push   $0x3d
+  80100e:	68 24 40 80 00       	push   $0x804024
+  801013:	e8 0a f4 ff ff       	call   800422 <_panic>
+
+00801018 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801018:	55                   	push   %ebp
+  801019:	89 e5                	mov    %esp,%ebp
+  80101b:	57                   	push   %edi
+  80101c:	56                   	push   %esi
+  80101d:	53                   	push   %ebx
+  80101e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801021:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801026:	8b 55 08             	mov    0x8(%ebp),%edx
+  801029:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801031:	89 df                	mov    %ebx,%edi
+  801033:	55                   	push   %ebp
+  801034:	89 e5                	mov    %esp,%ebp
+  801036:	8d 35 3e 10 80 00    	lea    0x80103e,%esi
+  80103c:	0f 34                	sysenter
+  80103e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80103f:	85 c0                	test   %eax,%eax
+  801041:	7f 08                	jg     80104b <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  801043:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801046:	5b                   	pop    %ebx
+  801047:	5e                   	pop    %esi
+  801048:	5f                   	pop    %edi
+  801049:	5d                   	pop    %ebp
+  80104a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80104b:	83 ec 0c             	sub    $0xc,%esp
+  80104e:	50                   	push   %eax
+  80104f:	6a 09                	push   $0x9
+  801051:	68 07 40 80 00       	push   $0x804007
+  801056:	6a 3d                	push   $0x3d
+  801058:	68 24 40 80 00       	push   $0x804024
+  80105d:	e8 c0 f3 ff ff       	call   800422 <_panic>
+
+00801062 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801062:	55                   	push   %ebp
+  801063:	89 e5                	mov    %esp,%ebp
+  801065:	57                   	push   %edi
+  801066:	56                   	push   %esi
+  801067:	53                   	push   %ebx
+  801068:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80106b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801070:	8b 55 08             	mov    0x8(%ebp),%edx
+  801073:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801076:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80107b:	89 df                	mov    %ebx,%edi
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+  801080:	8d 35 88 10 80 00    	lea    0x801088,%esi
+  801086:	0f 34                	sysenter
+  801088:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801089:	85 c0                	test   %eax,%eax
+  80108b:	7f 08                	jg     801095 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  80108d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801090:	5b                   	pop    %ebx
+  801091:	5e                   	pop    %esi
+  801092:	5f                   	pop    %edi
+  801093:	5d                   	pop    %ebp
+  801094:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801095:	83 ec 0c             	sub    $0xc,%esp
+  801098:	50                   	push   %eax
+  801099:	6a 0a                	push   $0xa
+  80109b:	68 07 40 80 00       	push   $0x804007
+  8010a0:	6a 3d                	push   $0x3d
+  8010a2:	68 24 40 80 00       	push   $0x804024
+  8010a7:	e8 76 f3 ff ff       	call   800422 <_panic>
+
+008010ac <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	57                   	push   %edi
+  8010b0:	56                   	push   %esi
+  8010b1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c3:	55                   	push   %ebp
+  8010c4:	89 e5                	mov    %esp,%ebp
+  8010c6:	8d 35 ce 10 80 00    	lea    0x8010ce,%esi
+  8010cc:	0f 34                	sysenter
+  8010ce:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  8010cf:	5b                   	pop    %ebx
+  8010d0:	5e                   	pop    %esi
+  8010d1:	5f                   	pop    %edi
+  8010d2:	5d                   	pop    %ebp
+  8010d3:	c3                   	ret
+
+008010d4 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  8010d4:	55                   	push   %ebp
+  8010d5:	89 e5                	mov    %esp,%ebp
+  8010d7:	57                   	push   %edi
+  8010d8:	56                   	push   %esi
+  8010d9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010eb:	55                   	push   %ebp
+  8010ec:	89 e5                	mov    %esp,%ebp
+  8010ee:	8d 35 f6 10 80 00    	lea    0x8010f6,%esi
+  8010f4:	0f 34                	sysenter
+  8010f6:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  8010f7:	5b                   	pop    %ebx
+  8010f8:	5e                   	pop    %esi
+  8010f9:	5f                   	pop    %edi
+  8010fa:	5d                   	pop    %ebp
+  8010fb:	c3                   	ret
+
+008010fc <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  8010fc:	55                   	push   %ebp
+  8010fd:	89 e5                	mov    %esp,%ebp
+  8010ff:	57                   	push   %edi
+  801100:	56                   	push   %esi
+  801101:	53                   	push   %ebx
+  801102:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801105:	be 00 00 00 00       	mov    $0x0,%esi
+  80110a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801110:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801115:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801118:	89 f7                	mov    %esi,%edi
+  80111a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80111c:	85 c0                	test   %eax,%eax
+  80111e:	7f 08                	jg     801128 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  801120:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801123:	5b                   	pop    %ebx
+  801124:	5e                   	pop    %esi
+  801125:	5f                   	pop    %edi
+  801126:	5d                   	pop    %ebp
+  801127:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801128:	83 ec 0c             	sub    $0xc,%esp
+  80112b:	50                   	push   %eax
+  80112c:	6a 0d                	push   $0xd
+  80112e:	68 07 40 80 00       	push   $0x804007
+  801133:	6a 23                	push   $0x23
+  801135:	68 24 40 80 00       	push   $0x804024
+  80113a:	e8 e3 f2 ff ff       	call   800422 <_panic>
+
+0080113f <sys_ipc_recv>:
+{
+  80113f:	55                   	push   %ebp
+  801140:	89 e5                	mov    %esp,%ebp
+  801142:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  801145:	6a 00                	push   $0x0
+  801147:	6a 01                	push   $0x1
+  801149:	ff 75 08             	push   0x8(%ebp)
+  80114c:	e8 ab ff ff ff       	call   8010fc <sys_ipc_recvv>
+}
+  801151:	c9                   	leave
+  801152:	c3                   	ret
+
+00801153 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  801153:	55                   	push   %ebp
+  801154:	89 e5                	mov    %esp,%ebp
+  801156:	57                   	push   %edi
+  801157:	56                   	push   %esi
+  801158:	53                   	push   %ebx
+  801159:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80115c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801161:	8b 55 08             	mov    0x8(%ebp),%edx
+  801164:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801167:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80116c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80116f:	89 de                	mov    %ebx,%esi
+  801171:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801173:	85 c0                	test   %eax,%eax
+  801175:	7f 08                	jg     80117f <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  801177:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117a:	5b                   	pop    %ebx
+  80117b:	5e                   	pop    %esi
+  80117c:	5f                   	pop    %edi
+  80117d:	5d                   	pop    %ebp
+  80117e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80117f:	83 ec 0c             	sub    $0xc,%esp
+  801182:	50                   	push   %eax
+  801183:	6a 0d                	push   $0xd
+  801185:	68 07 40 80 00       	push   $0x804007
+  80118a:	6a 23                	push   $0x23
+  80118c:	68 24 40 80 00       	push   $0x804024
+  801191:	e8 8c f2 ff ff       	call   800422 <_panic>
+
+00801196 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801196:	55                   	push   %ebp
+  801197:	89 e5                	mov    %esp,%ebp
+  801199:	57                   	push   %edi
+  80119a:	56                   	push   %esi
+  80119b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80119c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011a6:	89 d1                	mov    %edx,%ecx
+  8011a8:	89 d3                	mov    %edx,%ebx
+  8011aa:	89 d7                	mov    %edx,%edi
+  8011ac:	55                   	push   %ebp
+  8011ad:	89 e5                	mov    %esp,%ebp
+  8011af:	8d 35 b7 11 80 00    	lea    0x8011b7,%esi
+  8011b5:	0f 34                	sysenter
+  8011b7:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  8011b8:	5b                   	pop    %ebx
+  8011b9:	5e                   	pop    %esi
+  8011ba:	5f                   	pop    %edi
+  8011bb:	5d                   	pop    %ebp
+  8011bc:	c3                   	ret
+
+008011bd <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  8011bd:	55                   	push   %ebp
+  8011be:	89 e5                	mov    %esp,%ebp
+  8011c0:	57                   	push   %edi
+  8011c1:	56                   	push   %esi
+  8011c2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ce:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011d3:	89 df                	mov    %ebx,%edi
+  8011d5:	55                   	push   %ebp
+  8011d6:	89 e5                	mov    %esp,%ebp
+  8011d8:	8d 35 e0 11 80 00    	lea    0x8011e0,%esi
+  8011de:	0f 34                	sysenter
+  8011e0:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  8011e1:	5b                   	pop    %ebx
+  8011e2:	5e                   	pop    %esi
+  8011e3:	5f                   	pop    %edi
+  8011e4:	5d                   	pop    %ebp
+  8011e5:	c3                   	ret
+
+008011e6 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	57                   	push   %edi
+  8011ea:	56                   	push   %esi
+  8011eb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f4:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011f9:	89 cb                	mov    %ecx,%ebx
+  8011fb:	89 cf                	mov    %ecx,%edi
+  8011fd:	55                   	push   %ebp
+  8011fe:	89 e5                	mov    %esp,%ebp
+  801200:	8d 35 08 12 80 00    	lea    0x801208,%esi
+  801206:	0f 34                	sysenter
+  801208:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  801209:	5b                   	pop    %ebx
+  80120a:	5e                   	pop    %esi
+  80120b:	5f                   	pop    %edi
+  80120c:	5d                   	pop    %ebp
+  80120d:	c3                   	ret
+
+0080120e <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  80120e:	55                   	push   %ebp
+  80120f:	89 e5                	mov    %esp,%ebp
+  801211:	57                   	push   %edi
+  801212:	56                   	push   %esi
+  801213:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801214:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801219:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801224:	89 df                	mov    %ebx,%edi
+  801226:	55                   	push   %ebp
+  801227:	89 e5                	mov    %esp,%ebp
+  801229:	8d 35 31 12 80 00    	lea    0x801231,%esi
+  80122f:	0f 34                	sysenter
+  801231:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  801232:	5b                   	pop    %ebx
+  801233:	5e                   	pop    %esi
+  801234:	5f                   	pop    %edi
+  801235:	5d                   	pop    %ebp
+  801236:	c3                   	ret
+
+00801237 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  801237:	55                   	push   %ebp
+  801238:	89 e5                	mov    %esp,%ebp
+  80123a:	57                   	push   %edi
+  80123b:	56                   	push   %esi
+  80123c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80123d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801242:	8b 55 08             	mov    0x8(%ebp),%edx
+  801245:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801248:	b8 14 00 00 00       	mov    $0x14,%eax
+  80124d:	89 df                	mov    %ebx,%edi
+  80124f:	55                   	push   %ebp
+  801250:	89 e5                	mov    %esp,%ebp
+  801252:	8d 35 5a 12 80 00    	lea    0x80125a,%esi
+  801258:	0f 34                	sysenter
+  80125a:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  80125b:	5b                   	pop    %ebx
+  80125c:	5e                   	pop    %esi
+  80125d:	5f                   	pop    %edi
+  80125e:	5d                   	pop    %ebp
+  80125f:	c3                   	ret
+
+00801260 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  801260:	55                   	push   %ebp
+  801261:	89 e5                	mov    %esp,%ebp
+  801263:	57                   	push   %edi
+  801264:	56                   	push   %esi
+  801265:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801266:	8b 55 08             	mov    0x8(%ebp),%edx
+  801269:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126c:	b8 13 00 00 00       	mov    $0x13,%eax
+  801271:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801274:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801277:	55                   	push   %ebp
+  801278:	89 e5                	mov    %esp,%ebp
+  80127a:	8d 35 82 12 80 00    	lea    0x801282,%esi
+  801280:	0f 34                	sysenter
+  801282:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  801283:	5b                   	pop    %ebx
+  801284:	5e                   	pop    %esi
+  801285:	5f                   	pop    %edi
+  801286:	5d                   	pop    %ebp
+  801287:	c3                   	ret
+
+00801288 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801288:	55                   	push   %ebp
+  801289:	89 e5                	mov    %esp,%ebp
+  80128b:	57                   	push   %edi
+  80128c:	56                   	push   %esi
+  80128d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80128e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801293:	8b 55 08             	mov    0x8(%ebp),%edx
+  801296:	b8 11 00 00 00       	mov    $0x11,%eax
+  80129b:	89 cb                	mov    %ecx,%ebx
+  80129d:	89 cf                	mov    %ecx,%edi
+  80129f:	89 ce                	mov    %ecx,%esi
+  8012a1:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  8012a3:	5b                   	pop    %ebx
+  8012a4:	5e                   	pop    %esi
+  8012a5:	5f                   	pop    %edi
+  8012a6:	5d                   	pop    %ebp
+  8012a7:	c3                   	ret
+
+008012a8 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  8012a8:	55                   	push   %ebp
+  8012a9:	89 e5                	mov    %esp,%ebp
+  8012ab:	57                   	push   %edi
+  8012ac:	56                   	push   %esi
+  8012ad:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b6:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012bb:	89 cb                	mov    %ecx,%ebx
+  8012bd:	89 cf                	mov    %ecx,%edi
+  8012bf:	55                   	push   %ebp
+  8012c0:	89 e5                	mov    %esp,%ebp
+  8012c2:	8d 35 ca 12 80 00    	lea    0x8012ca,%esi
+  8012c8:	0f 34                	sysenter
+  8012ca:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8012cb:	5b                   	pop    %ebx
+  8012cc:	5e                   	pop    %esi
+  8012cd:	5f                   	pop    %edi
+  8012ce:	5d                   	pop    %ebp
+  8012cf:	c3                   	ret
+
+008012d0 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8012d0:	55                   	push   %ebp
+  8012d1:	89 e5                	mov    %esp,%ebp
+  8012d3:	57                   	push   %edi
+  8012d4:	56                   	push   %esi
+  8012d5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012de:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012e3:	89 cb                	mov    %ecx,%ebx
+  8012e5:	89 cf                	mov    %ecx,%edi
+  8012e7:	55                   	push   %ebp
+  8012e8:	89 e5                	mov    %esp,%ebp
+  8012ea:	8d 35 f2 12 80 00    	lea    0x8012f2,%esi
+  8012f0:	0f 34                	sysenter
+  8012f2:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8012f3:	5b                   	pop    %ebx
+  8012f4:	5e                   	pop    %esi
+  8012f5:	5f                   	pop    %edi
+  8012f6:	5d                   	pop    %ebp
+  8012f7:	c3                   	ret
+
+008012f8 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	56                   	push   %esi
+  8012fc:	53                   	push   %ebx
+  8012fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  801300:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801303:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801306:	85 c0                	test   %eax,%eax
+  801308:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80130d:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  801310:	83 ec 0c             	sub    $0xc,%esp
+  801313:	50                   	push   %eax
+  801314:	e8 26 fe ff ff       	call   80113f <sys_ipc_recv>
+	if (from_env_store)
+  801319:	83 c4 10             	add    $0x10,%esp
+  80131c:	85 f6                	test   %esi,%esi
+  80131e:	74 14                	je     801334 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801320:	ba 00 00 00 00       	mov    $0x0,%edx
+  801325:	85 c0                	test   %eax,%eax
+  801327:	75 09                	jne    801332 <ipc_recv+0x3a>
+  801329:	8b 15 00 a0 88 00    	mov    0x88a000,%edx
+  80132f:	8b 52 74             	mov    0x74(%edx),%edx
+  801332:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  801334:	85 db                	test   %ebx,%ebx
+  801336:	74 25                	je     80135d <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801338:	85 c0                	test   %eax,%eax
+  80133a:	74 0d                	je     801349 <ipc_recv+0x51>
+  80133c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  801342:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801345:	5b                   	pop    %ebx
+  801346:	5e                   	pop    %esi
+  801347:	5d                   	pop    %ebp
+  801348:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801349:	a1 00 a0 88 00       	mov    0x88a000,%eax
+  80134e:	8b 40 78             	mov    0x78(%eax),%eax
+  801351:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  801353:	a1 00 a0 88 00       	mov    0x88a000,%eax
+  801358:	8b 40 70             	mov    0x70(%eax),%eax
+  80135b:	eb e5                	jmp    801342 <ipc_recv+0x4a>
+  80135d:	85 c0                	test   %eax,%eax
+  80135f:	75 e1                	jne    801342 <ipc_recv+0x4a>
+  801361:	eb f0                	jmp    801353 <ipc_recv+0x5b>
+
+00801363 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801363:	55                   	push   %ebp
+  801364:	89 e5                	mov    %esp,%ebp
+  801366:	57                   	push   %edi
+  801367:	56                   	push   %esi
+  801368:	53                   	push   %ebx
+  801369:	83 ec 0c             	sub    $0xc,%esp
+  80136c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80136f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801372:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801375:	85 db                	test   %ebx,%ebx
+  801377:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80137c:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80137f:	ff 75 14             	push   0x14(%ebp)
+  801382:	53                   	push   %ebx
+  801383:	56                   	push   %esi
+  801384:	57                   	push   %edi
+  801385:	e8 22 fd ff ff       	call   8010ac <sys_ipc_try_send>
+  80138a:	83 c4 10             	add    $0x10,%esp
+  80138d:	85 c0                	test   %eax,%eax
+  80138f:	74 22                	je     8013b3 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  801391:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801394:	75 07                	jne    80139d <ipc_send+0x3a>
+		sys_yield();
+  801396:	e8 3d fb ff ff       	call   800ed8 <sys_yield>
+  80139b:	eb e2                	jmp    80137f <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80139d:	68 32 40 80 00       	push   $0x804032
+  8013a2:	68 47 40 80 00       	push   $0x804047
+  8013a7:	6a 39                	push   $0x39
+  8013a9:	68 5c 40 80 00       	push   $0x80405c
+  8013ae:	e8 6f f0 ff ff       	call   800422 <_panic>
+	}
+}
+  8013b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b6:	5b                   	pop    %ebx
+  8013b7:	5e                   	pop    %esi
+  8013b8:	5f                   	pop    %edi
+  8013b9:	5d                   	pop    %ebp
+  8013ba:	c3                   	ret
+
+008013bb <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  8013bb:	55                   	push   %ebp
+  8013bc:	89 e5                	mov    %esp,%ebp
+  8013be:	57                   	push   %edi
+  8013bf:	56                   	push   %esi
+  8013c0:	53                   	push   %ebx
+  8013c1:	83 ec 10             	sub    $0x10,%esp
+  8013c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013cd:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8013d0:	85 c0                	test   %eax,%eax
+  8013d2:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8013d7:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8013da:	6a 00                	push   $0x0
+  8013dc:	ff 33                	push   (%ebx)
+  8013de:	50                   	push   %eax
+  8013df:	e8 18 fd ff ff       	call   8010fc <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8013e4:	83 c4 10             	add    $0x10,%esp
+  8013e7:	85 c0                	test   %eax,%eax
+  8013e9:	75 3c                	jne    801427 <ipc_recvv+0x6c>
+  8013eb:	8b 15 00 a0 88 00    	mov    0x88a000,%edx
+  8013f1:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8013f4:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8013f6:	85 ff                	test   %edi,%edi
+  8013f8:	74 4e                	je     801448 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8013fa:	8b 15 00 a0 88 00    	mov    0x88a000,%edx
+  801400:	8b 52 74             	mov    0x74(%edx),%edx
+  801403:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  801405:	85 f6                	test   %esi,%esi
+  801407:	74 18                	je     801421 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801409:	85 c0                	test   %eax,%eax
+  80140b:	75 2d                	jne    80143a <ipc_recvv+0x7f>
+  80140d:	a1 00 a0 88 00       	mov    0x88a000,%eax
+  801412:	8b 40 78             	mov    0x78(%eax),%eax
+  801415:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  801417:	a1 00 a0 88 00       	mov    0x88a000,%eax
+  80141c:	8b 40 70             	mov    0x70(%eax),%eax
+  80141f:	eb 1f                	jmp    801440 <ipc_recvv+0x85>
+  801421:	85 c0                	test   %eax,%eax
+  801423:	75 1b                	jne    801440 <ipc_recvv+0x85>
+  801425:	eb f0                	jmp    801417 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  801427:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80142d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  801432:	85 ff                	test   %edi,%edi
+  801434:	75 cd                	jne    801403 <ipc_recvv+0x48>
+	if (perm_store)
+  801436:	85 f6                	test   %esi,%esi
+  801438:	74 e7                	je     801421 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80143a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  801440:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801443:	5b                   	pop    %ebx
+  801444:	5e                   	pop    %esi
+  801445:	5f                   	pop    %edi
+  801446:	5d                   	pop    %ebp
+  801447:	c3                   	ret
+	if (perm_store)
+  801448:	85 f6                	test   %esi,%esi
+  80144a:	75 bd                	jne    801409 <ipc_recvv+0x4e>
+  80144c:	eb c9                	jmp    801417 <ipc_recvv+0x5c>
+
+0080144e <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  80144e:	55                   	push   %ebp
+  80144f:	89 e5                	mov    %esp,%ebp
+  801451:	57                   	push   %edi
+  801452:	56                   	push   %esi
+  801453:	53                   	push   %ebx
+  801454:	83 ec 0c             	sub    $0xc,%esp
+  801457:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80145a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80145d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  801460:	ff 75 14             	push   0x14(%ebp)
+  801463:	53                   	push   %ebx
+  801464:	56                   	push   %esi
+  801465:	57                   	push   %edi
+  801466:	e8 69 fc ff ff       	call   8010d4 <sys_ipc_try_sendv>
+  80146b:	83 c4 10             	add    $0x10,%esp
+  80146e:	85 c0                	test   %eax,%eax
+  801470:	74 22                	je     801494 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  801472:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801475:	75 07                	jne    80147e <ipc_sendv+0x30>
+		sys_yield();
+  801477:	e8 5c fa ff ff       	call   800ed8 <sys_yield>
+  80147c:	eb e2                	jmp    801460 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80147e:	68 32 40 80 00       	push   $0x804032
+  801483:	68 47 40 80 00       	push   $0x804047
+  801488:	6a 5c                	push   $0x5c
+  80148a:	68 5c 40 80 00       	push   $0x80405c
+  80148f:	e8 8e ef ff ff       	call   800422 <_panic>
+	}
+}
+  801494:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801497:	5b                   	pop    %ebx
+  801498:	5e                   	pop    %esi
+  801499:	5f                   	pop    %edi
+  80149a:	5d                   	pop    %ebp
+  80149b:	c3                   	ret
+
+0080149c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80149c:	55                   	push   %ebp
+  80149d:	89 e5                	mov    %esp,%ebp
+  80149f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8014a2:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8014a7:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8014ad:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8014b3:	8b 52 50             	mov    0x50(%edx),%edx
+  8014b6:	39 ca                	cmp    %ecx,%edx
+  8014b8:	74 11                	je     8014cb <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8014ba:	83 c0 01             	add    $0x1,%eax
+  8014bd:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8014c2:	75 e3                	jne    8014a7 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8014c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c9:	eb 0e                	jmp    8014d9 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8014cb:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8014d1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8014d6:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8014d9:	5d                   	pop    %ebp
+  8014da:	c3                   	ret
+
+008014db <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014db:	55                   	push   %ebp
+  8014dc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014e1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014e6:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014e9:	5d                   	pop    %ebp
+  8014ea:	c3                   	ret
+
+008014eb <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014eb:	55                   	push   %ebp
+  8014ec:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014f1:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8014f6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8014fb:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801500:	5d                   	pop    %ebp
+  801501:	c3                   	ret
+
+00801502 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801502:	55                   	push   %ebp
+  801503:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801505:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80150a:	eb 02                	jmp    80150e <fd_alloc+0xc>
+  80150c:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80150e:	89 c2                	mov    %eax,%edx
+  801510:	c1 ea 16             	shr    $0x16,%edx
+  801513:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80151a:	f6 c2 01             	test   $0x1,%dl
+  80151d:	74 2b                	je     80154a <fd_alloc+0x48>
+  80151f:	89 c2                	mov    %eax,%edx
+  801521:	c1 ea 0c             	shr    $0xc,%edx
+  801524:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80152b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801531:	f6 c1 01             	test   $0x1,%cl
+  801534:	74 14                	je     80154a <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801536:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80153c:	75 ce                	jne    80150c <fd_alloc+0xa>
+  80153e:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801543:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801548:	eb 05                	jmp    80154f <fd_alloc+0x4d>
+			return 0;
+  80154a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80154f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801552:	89 02                	mov    %eax,(%edx)
+}
+  801554:	89 c8                	mov    %ecx,%eax
+  801556:	5d                   	pop    %ebp
+  801557:	c3                   	ret
+
+00801558 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801558:	55                   	push   %ebp
+  801559:	89 e5                	mov    %esp,%ebp
+  80155b:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80155e:	83 f8 1f             	cmp    $0x1f,%eax
+  801561:	77 30                	ja     801593 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801563:	c1 e0 0c             	shl    $0xc,%eax
+  801566:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80156b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801571:	f6 c2 01             	test   $0x1,%dl
+  801574:	74 24                	je     80159a <fd_lookup+0x42>
+  801576:	89 c2                	mov    %eax,%edx
+  801578:	c1 ea 0c             	shr    $0xc,%edx
+  80157b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801582:	f6 c2 01             	test   $0x1,%dl
+  801585:	74 1a                	je     8015a1 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801587:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80158a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80158c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801591:	5d                   	pop    %ebp
+  801592:	c3                   	ret
+		return -E_INVAL;
+  801593:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801598:	eb f7                	jmp    801591 <fd_lookup+0x39>
+		return -E_INVAL;
+  80159a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80159f:	eb f0                	jmp    801591 <fd_lookup+0x39>
+  8015a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015a6:	eb e9                	jmp    801591 <fd_lookup+0x39>
+
+008015a8 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8015a8:	55                   	push   %ebp
+  8015a9:	89 e5                	mov    %esp,%ebp
+  8015ab:	53                   	push   %ebx
+  8015ac:	83 ec 04             	sub    $0x4,%esp
+  8015af:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8015b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b7:	eb 03                	jmp    8015bc <dev_lookup+0x14>
+  8015b9:	83 c0 01             	add    $0x1,%eax
+  8015bc:	8b 1c 85 e4 40 80 00 	mov    0x8040e4(,%eax,4),%ebx
+  8015c3:	85 db                	test   %ebx,%ebx
+  8015c5:	74 0b                	je     8015d2 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8015c7:	39 13                	cmp    %edx,(%ebx)
+  8015c9:	75 ee                	jne    8015b9 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8015cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d0:	eb 1f                	jmp    8015f1 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015d2:	a1 00 a0 88 00       	mov    0x88a000,%eax
+  8015d7:	8b 40 48             	mov    0x48(%eax),%eax
+  8015da:	83 ec 04             	sub    $0x4,%esp
+  8015dd:	52                   	push   %edx
+  8015de:	50                   	push   %eax
+  8015df:	68 68 40 80 00       	push   $0x804068
+  8015e4:	e8 14 ef ff ff       	call   8004fd <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8015e9:	83 c4 10             	add    $0x10,%esp
+  8015ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8015f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015f4:	89 1a                	mov    %ebx,(%edx)
+}
+  8015f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015f9:	c9                   	leave
+  8015fa:	c3                   	ret
+
+008015fb <fd_close>:
+{
+  8015fb:	55                   	push   %ebp
+  8015fc:	89 e5                	mov    %esp,%ebp
+  8015fe:	57                   	push   %edi
+  8015ff:	56                   	push   %esi
+  801600:	53                   	push   %ebx
+  801601:	83 ec 24             	sub    $0x24,%esp
+  801604:	8b 75 08             	mov    0x8(%ebp),%esi
+  801607:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80160a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80160d:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80160e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801614:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801617:	50                   	push   %eax
+  801618:	e8 3b ff ff ff       	call   801558 <fd_lookup>
+  80161d:	89 c3                	mov    %eax,%ebx
+  80161f:	83 c4 10             	add    $0x10,%esp
+  801622:	85 c0                	test   %eax,%eax
+  801624:	78 05                	js     80162b <fd_close+0x30>
+	    || fd != fd2)
+  801626:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801629:	74 16                	je     801641 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80162b:	89 f8                	mov    %edi,%eax
+  80162d:	84 c0                	test   %al,%al
+  80162f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801634:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801637:	89 d8                	mov    %ebx,%eax
+  801639:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163c:	5b                   	pop    %ebx
+  80163d:	5e                   	pop    %esi
+  80163e:	5f                   	pop    %edi
+  80163f:	5d                   	pop    %ebp
+  801640:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801641:	83 ec 08             	sub    $0x8,%esp
+  801644:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801647:	50                   	push   %eax
+  801648:	ff 36                	push   (%esi)
+  80164a:	e8 59 ff ff ff       	call   8015a8 <dev_lookup>
+  80164f:	89 c3                	mov    %eax,%ebx
+  801651:	83 c4 10             	add    $0x10,%esp
+  801654:	85 c0                	test   %eax,%eax
+  801656:	78 1a                	js     801672 <fd_close+0x77>
+		if (dev->dev_close)
+  801658:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80165b:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80165e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801663:	85 c0                	test   %eax,%eax
+  801665:	74 0b                	je     801672 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801667:	83 ec 0c             	sub    $0xc,%esp
+  80166a:	56                   	push   %esi
+  80166b:	ff d0                	call   *%eax
+  80166d:	89 c3                	mov    %eax,%ebx
+  80166f:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801672:	83 ec 08             	sub    $0x8,%esp
+  801675:	56                   	push   %esi
+  801676:	6a 00                	push   $0x0
+  801678:	e8 07 f9 ff ff       	call   800f84 <sys_page_unmap>
+	return r;
+  80167d:	83 c4 10             	add    $0x10,%esp
+  801680:	eb b5                	jmp    801637 <fd_close+0x3c>
+
+00801682 <close>:
+
+int
+close(int fdnum)
+{
+  801682:	55                   	push   %ebp
+  801683:	89 e5                	mov    %esp,%ebp
+  801685:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801688:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80168b:	50                   	push   %eax
+  80168c:	ff 75 08             	push   0x8(%ebp)
+  80168f:	e8 c4 fe ff ff       	call   801558 <fd_lookup>
+  801694:	83 c4 10             	add    $0x10,%esp
+  801697:	85 c0                	test   %eax,%eax
+  801699:	79 02                	jns    80169d <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80169b:	c9                   	leave
+  80169c:	c3                   	ret
+		return fd_close(fd, 1);
+  80169d:	83 ec 08             	sub    $0x8,%esp
+  8016a0:	6a 01                	push   $0x1
+  8016a2:	ff 75 f4             	push   -0xc(%ebp)
+  8016a5:	e8 51 ff ff ff       	call   8015fb <fd_close>
+  8016aa:	83 c4 10             	add    $0x10,%esp
+  8016ad:	eb ec                	jmp    80169b <close+0x19>
+
+008016af <close_all>:
+
+void
+close_all(void)
+{
+  8016af:	55                   	push   %ebp
+  8016b0:	89 e5                	mov    %esp,%ebp
+  8016b2:	53                   	push   %ebx
+  8016b3:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8016b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8016bb:	83 ec 0c             	sub    $0xc,%esp
+  8016be:	53                   	push   %ebx
+  8016bf:	e8 be ff ff ff       	call   801682 <close>
+	for (i = 0; i < MAXFD; i++)
+  8016c4:	83 c3 01             	add    $0x1,%ebx
+  8016c7:	83 c4 10             	add    $0x10,%esp
+  8016ca:	83 fb 20             	cmp    $0x20,%ebx
+  8016cd:	75 ec                	jne    8016bb <close_all+0xc>
+}
+  8016cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016d2:	c9                   	leave
+  8016d3:	c3                   	ret
+
+008016d4 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016d4:	55                   	push   %ebp
+  8016d5:	89 e5                	mov    %esp,%ebp
+  8016d7:	57                   	push   %edi
+  8016d8:	56                   	push   %esi
+  8016d9:	53                   	push   %ebx
+  8016da:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016dd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016e0:	50                   	push   %eax
+  8016e1:	ff 75 08             	push   0x8(%ebp)
+  8016e4:	e8 6f fe ff ff       	call   801558 <fd_lookup>
+  8016e9:	89 c3                	mov    %eax,%ebx
+  8016eb:	83 c4 10             	add    $0x10,%esp
+  8016ee:	85 c0                	test   %eax,%eax
+  8016f0:	78 7f                	js     801771 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8016f2:	83 ec 0c             	sub    $0xc,%esp
+  8016f5:	ff 75 0c             	push   0xc(%ebp)
+  8016f8:	e8 85 ff ff ff       	call   801682 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8016fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801700:	c1 e6 0c             	shl    $0xc,%esi
+  801703:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801709:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80170c:	89 3c 24             	mov    %edi,(%esp)
+  80170f:	e8 d7 fd ff ff       	call   8014eb <fd2data>
+  801714:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801716:	89 34 24             	mov    %esi,(%esp)
+  801719:	e8 cd fd ff ff       	call   8014eb <fd2data>
+  80171e:	83 c4 10             	add    $0x10,%esp
+  801721:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801724:	89 d8                	mov    %ebx,%eax
+  801726:	c1 e8 16             	shr    $0x16,%eax
+  801729:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801730:	a8 01                	test   $0x1,%al
+  801732:	74 11                	je     801745 <dup+0x71>
+  801734:	89 d8                	mov    %ebx,%eax
+  801736:	c1 e8 0c             	shr    $0xc,%eax
+  801739:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801740:	f6 c2 01             	test   $0x1,%dl
+  801743:	75 36                	jne    80177b <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801745:	89 f8                	mov    %edi,%eax
+  801747:	c1 e8 0c             	shr    $0xc,%eax
+  80174a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801751:	83 ec 0c             	sub    $0xc,%esp
+  801754:	25 07 0e 00 00       	and    $0xe07,%eax
+  801759:	50                   	push   %eax
+  80175a:	56                   	push   %esi
+  80175b:	6a 00                	push   $0x0
+  80175d:	57                   	push   %edi
+  80175e:	6a 00                	push   $0x0
+  801760:	e8 dd f7 ff ff       	call   800f42 <sys_page_map>
+  801765:	89 c3                	mov    %eax,%ebx
+  801767:	83 c4 20             	add    $0x20,%esp
+  80176a:	85 c0                	test   %eax,%eax
+  80176c:	78 33                	js     8017a1 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80176e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801771:	89 d8                	mov    %ebx,%eax
+  801773:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801776:	5b                   	pop    %ebx
+  801777:	5e                   	pop    %esi
+  801778:	5f                   	pop    %edi
+  801779:	5d                   	pop    %ebp
+  80177a:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80177b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801782:	83 ec 0c             	sub    $0xc,%esp
+  801785:	25 07 0e 00 00       	and    $0xe07,%eax
+  80178a:	50                   	push   %eax
+  80178b:	ff 75 d4             	push   -0x2c(%ebp)
+  80178e:	6a 00                	push   $0x0
+  801790:	53                   	push   %ebx
+  801791:	6a 00                	push   $0x0
+  801793:	e8 aa f7 ff ff       	call   800f42 <sys_page_map>
+  801798:	89 c3                	mov    %eax,%ebx
+  80179a:	83 c4 20             	add    $0x20,%esp
+  80179d:	85 c0                	test   %eax,%eax
+  80179f:	79 a4                	jns    801745 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8017a1:	83 ec 08             	sub    $0x8,%esp
+  8017a4:	56                   	push   %esi
+  8017a5:	6a 00                	push   $0x0
+  8017a7:	e8 d8 f7 ff ff       	call   800f84 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8017ac:	83 c4 08             	add    $0x8,%esp
+  8017af:	ff 75 d4             	push   -0x2c(%ebp)
+  8017b2:	6a 00                	push   $0x0
+  8017b4:	e8 cb f7 ff ff       	call   800f84 <sys_page_unmap>
+	return r;
+  8017b9:	83 c4 10             	add    $0x10,%esp
+  8017bc:	eb b3                	jmp    801771 <dup+0x9d>
+
+008017be <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8017be:	55                   	push   %ebp
+  8017bf:	89 e5                	mov    %esp,%ebp
+  8017c1:	56                   	push   %esi
+  8017c2:	53                   	push   %ebx
+  8017c3:	83 ec 18             	sub    $0x18,%esp
+  8017c6:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017c9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017cc:	50                   	push   %eax
+  8017cd:	56                   	push   %esi
+  8017ce:	e8 85 fd ff ff       	call   801558 <fd_lookup>
+  8017d3:	83 c4 10             	add    $0x10,%esp
+  8017d6:	85 c0                	test   %eax,%eax
+  8017d8:	78 3c                	js     801816 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017da:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8017dd:	83 ec 08             	sub    $0x8,%esp
+  8017e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017e3:	50                   	push   %eax
+  8017e4:	ff 33                	push   (%ebx)
+  8017e6:	e8 bd fd ff ff       	call   8015a8 <dev_lookup>
+  8017eb:	83 c4 10             	add    $0x10,%esp
+  8017ee:	85 c0                	test   %eax,%eax
+  8017f0:	78 24                	js     801816 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8017f2:	8b 43 08             	mov    0x8(%ebx),%eax
+  8017f5:	83 e0 03             	and    $0x3,%eax
+  8017f8:	83 f8 01             	cmp    $0x1,%eax
+  8017fb:	74 20                	je     80181d <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8017fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801800:	8b 40 08             	mov    0x8(%eax),%eax
+  801803:	85 c0                	test   %eax,%eax
+  801805:	74 37                	je     80183e <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801807:	83 ec 04             	sub    $0x4,%esp
+  80180a:	ff 75 10             	push   0x10(%ebp)
+  80180d:	ff 75 0c             	push   0xc(%ebp)
+  801810:	53                   	push   %ebx
+  801811:	ff d0                	call   *%eax
+  801813:	83 c4 10             	add    $0x10,%esp
+}
+  801816:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801819:	5b                   	pop    %ebx
+  80181a:	5e                   	pop    %esi
+  80181b:	5d                   	pop    %ebp
+  80181c:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80181d:	a1 00 a0 88 00       	mov    0x88a000,%eax
+  801822:	8b 40 48             	mov    0x48(%eax),%eax
+  801825:	83 ec 04             	sub    $0x4,%esp
+  801828:	56                   	push   %esi
+  801829:	50                   	push   %eax
+  80182a:	68 a9 40 80 00       	push   $0x8040a9
+  80182f:	e8 c9 ec ff ff       	call   8004fd <cprintf>
+		return -E_INVAL;
+  801834:	83 c4 10             	add    $0x10,%esp
+  801837:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80183c:	eb d8                	jmp    801816 <read+0x58>
+		return -E_NOT_SUPP;
+  80183e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801843:	eb d1                	jmp    801816 <read+0x58>
+
+00801845 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801845:	55                   	push   %ebp
+  801846:	89 e5                	mov    %esp,%ebp
+  801848:	57                   	push   %edi
+  801849:	56                   	push   %esi
+  80184a:	53                   	push   %ebx
+  80184b:	83 ec 0c             	sub    $0xc,%esp
+  80184e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801851:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801854:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801859:	eb 02                	jmp    80185d <readn+0x18>
+  80185b:	01 c3                	add    %eax,%ebx
+  80185d:	39 f3                	cmp    %esi,%ebx
+  80185f:	73 21                	jae    801882 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801861:	83 ec 04             	sub    $0x4,%esp
+  801864:	89 f0                	mov    %esi,%eax
+  801866:	29 d8                	sub    %ebx,%eax
+  801868:	50                   	push   %eax
+  801869:	89 d8                	mov    %ebx,%eax
+  80186b:	03 45 0c             	add    0xc(%ebp),%eax
+  80186e:	50                   	push   %eax
+  80186f:	57                   	push   %edi
+  801870:	e8 49 ff ff ff       	call   8017be <read>
+		if (m < 0)
+  801875:	83 c4 10             	add    $0x10,%esp
+  801878:	85 c0                	test   %eax,%eax
+  80187a:	78 04                	js     801880 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80187c:	75 dd                	jne    80185b <readn+0x16>
+  80187e:	eb 02                	jmp    801882 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801880:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801882:	89 d8                	mov    %ebx,%eax
+  801884:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801887:	5b                   	pop    %ebx
+  801888:	5e                   	pop    %esi
+  801889:	5f                   	pop    %edi
+  80188a:	5d                   	pop    %ebp
+  80188b:	c3                   	ret
+
+0080188c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80188c:	55                   	push   %ebp
+  80188d:	89 e5                	mov    %esp,%ebp
+  80188f:	56                   	push   %esi
+  801890:	53                   	push   %ebx
+  801891:	83 ec 18             	sub    $0x18,%esp
+  801894:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801897:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80189a:	50                   	push   %eax
+  80189b:	53                   	push   %ebx
+  80189c:	e8 b7 fc ff ff       	call   801558 <fd_lookup>
+  8018a1:	83 c4 10             	add    $0x10,%esp
+  8018a4:	85 c0                	test   %eax,%eax
+  8018a6:	78 37                	js     8018df <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018a8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018ab:	83 ec 08             	sub    $0x8,%esp
+  8018ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018b1:	50                   	push   %eax
+  8018b2:	ff 36                	push   (%esi)
+  8018b4:	e8 ef fc ff ff       	call   8015a8 <dev_lookup>
+  8018b9:	83 c4 10             	add    $0x10,%esp
+  8018bc:	85 c0                	test   %eax,%eax
+  8018be:	78 1f                	js     8018df <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018c0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018c4:	74 20                	je     8018e6 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8018c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018cc:	85 c0                	test   %eax,%eax
+  8018ce:	74 37                	je     801907 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8018d0:	83 ec 04             	sub    $0x4,%esp
+  8018d3:	ff 75 10             	push   0x10(%ebp)
+  8018d6:	ff 75 0c             	push   0xc(%ebp)
+  8018d9:	56                   	push   %esi
+  8018da:	ff d0                	call   *%eax
+  8018dc:	83 c4 10             	add    $0x10,%esp
+}
+  8018df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018e2:	5b                   	pop    %ebx
+  8018e3:	5e                   	pop    %esi
+  8018e4:	5d                   	pop    %ebp
+  8018e5:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018e6:	a1 00 a0 88 00       	mov    0x88a000,%eax
+  8018eb:	8b 40 48             	mov    0x48(%eax),%eax
+  8018ee:	83 ec 04             	sub    $0x4,%esp
+  8018f1:	53                   	push   %ebx
+  8018f2:	50                   	push   %eax
+  8018f3:	68 c5 40 80 00       	push   $0x8040c5
+  8018f8:	e8 00 ec ff ff       	call   8004fd <cprintf>
+		return -E_INVAL;
+  8018fd:	83 c4 10             	add    $0x10,%esp
+  801900:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801905:	eb d8                	jmp    8018df <write+0x53>
+		return -E_NOT_SUPP;
+  801907:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80190c:	eb d1                	jmp    8018df <write+0x53>
+
+0080190e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80190e:	55                   	push   %ebp
+  80190f:	89 e5                	mov    %esp,%ebp
+  801911:	53                   	push   %ebx
+  801912:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801915:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801918:	50                   	push   %eax
+  801919:	ff 75 08             	push   0x8(%ebp)
+  80191c:	e8 37 fc ff ff       	call   801558 <fd_lookup>
+  801921:	83 c4 10             	add    $0x10,%esp
+  801924:	85 c0                	test   %eax,%eax
+  801926:	78 3a                	js     801962 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801928:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80192b:	83 ec 08             	sub    $0x8,%esp
+  80192e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801931:	50                   	push   %eax
+  801932:	ff 33                	push   (%ebx)
+  801934:	e8 6f fc ff ff       	call   8015a8 <dev_lookup>
+  801939:	83 c4 10             	add    $0x10,%esp
+  80193c:	85 c0                	test   %eax,%eax
+  80193e:	78 22                	js     801962 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801940:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801943:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801946:	85 c0                	test   %eax,%eax
+  801948:	74 0d                	je     801957 <seek+0x49>
+  80194a:	83 ec 0c             	sub    $0xc,%esp
+  80194d:	53                   	push   %ebx
+  80194e:	ff d0                	call   *%eax
+  801950:	83 c4 10             	add    $0x10,%esp
+  801953:	85 c0                	test   %eax,%eax
+  801955:	78 0b                	js     801962 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801957:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80195a:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  80195d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801962:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801965:	c9                   	leave
+  801966:	c3                   	ret
+
+00801967 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801967:	55                   	push   %ebp
+  801968:	89 e5                	mov    %esp,%ebp
+  80196a:	53                   	push   %ebx
+  80196b:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80196e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801971:	50                   	push   %eax
+  801972:	ff 75 08             	push   0x8(%ebp)
+  801975:	e8 de fb ff ff       	call   801558 <fd_lookup>
+  80197a:	83 c4 10             	add    $0x10,%esp
+  80197d:	85 c0                	test   %eax,%eax
+  80197f:	78 2b                	js     8019ac <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801981:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801984:	83 ec 08             	sub    $0x8,%esp
+  801987:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80198a:	50                   	push   %eax
+  80198b:	ff 33                	push   (%ebx)
+  80198d:	e8 16 fc ff ff       	call   8015a8 <dev_lookup>
+  801992:	83 c4 10             	add    $0x10,%esp
+  801995:	85 c0                	test   %eax,%eax
+  801997:	78 13                	js     8019ac <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801999:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80199c:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80199f:	85 c0                	test   %eax,%eax
+  8019a1:	74 0e                	je     8019b1 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8019a3:	83 ec 0c             	sub    $0xc,%esp
+  8019a6:	53                   	push   %ebx
+  8019a7:	ff d0                	call   *%eax
+  8019a9:	83 c4 10             	add    $0x10,%esp
+}
+  8019ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019af:	c9                   	leave
+  8019b0:	c3                   	ret
+		return 0;
+  8019b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b6:	eb f4                	jmp    8019ac <fsync+0x45>
+
+008019b8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8019b8:	55                   	push   %ebp
+  8019b9:	89 e5                	mov    %esp,%ebp
+  8019bb:	56                   	push   %esi
+  8019bc:	53                   	push   %ebx
+  8019bd:	83 ec 18             	sub    $0x18,%esp
+  8019c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019c3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019c6:	50                   	push   %eax
+  8019c7:	53                   	push   %ebx
+  8019c8:	e8 8b fb ff ff       	call   801558 <fd_lookup>
+  8019cd:	83 c4 10             	add    $0x10,%esp
+  8019d0:	85 c0                	test   %eax,%eax
+  8019d2:	78 34                	js     801a08 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019d4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019d7:	83 ec 08             	sub    $0x8,%esp
+  8019da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019dd:	50                   	push   %eax
+  8019de:	ff 36                	push   (%esi)
+  8019e0:	e8 c3 fb ff ff       	call   8015a8 <dev_lookup>
+  8019e5:	83 c4 10             	add    $0x10,%esp
+  8019e8:	85 c0                	test   %eax,%eax
+  8019ea:	78 1c                	js     801a08 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019ec:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019f0:	74 1d                	je     801a0f <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8019f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019f5:	8b 40 18             	mov    0x18(%eax),%eax
+  8019f8:	85 c0                	test   %eax,%eax
+  8019fa:	74 34                	je     801a30 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8019fc:	83 ec 08             	sub    $0x8,%esp
+  8019ff:	ff 75 0c             	push   0xc(%ebp)
+  801a02:	56                   	push   %esi
+  801a03:	ff d0                	call   *%eax
+  801a05:	83 c4 10             	add    $0x10,%esp
+}
+  801a08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a0b:	5b                   	pop    %ebx
+  801a0c:	5e                   	pop    %esi
+  801a0d:	5d                   	pop    %ebp
+  801a0e:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801a0f:	a1 00 a0 88 00       	mov    0x88a000,%eax
+  801a14:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a17:	83 ec 04             	sub    $0x4,%esp
+  801a1a:	53                   	push   %ebx
+  801a1b:	50                   	push   %eax
+  801a1c:	68 88 40 80 00       	push   $0x804088
+  801a21:	e8 d7 ea ff ff       	call   8004fd <cprintf>
+		return -E_INVAL;
+  801a26:	83 c4 10             	add    $0x10,%esp
+  801a29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a2e:	eb d8                	jmp    801a08 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a30:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a35:	eb d1                	jmp    801a08 <ftruncate+0x50>
+
+00801a37 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a37:	55                   	push   %ebp
+  801a38:	89 e5                	mov    %esp,%ebp
+  801a3a:	56                   	push   %esi
+  801a3b:	53                   	push   %ebx
+  801a3c:	83 ec 18             	sub    $0x18,%esp
+  801a3f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a42:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a45:	50                   	push   %eax
+  801a46:	ff 75 08             	push   0x8(%ebp)
+  801a49:	e8 0a fb ff ff       	call   801558 <fd_lookup>
+  801a4e:	83 c4 10             	add    $0x10,%esp
+  801a51:	85 c0                	test   %eax,%eax
+  801a53:	78 49                	js     801a9e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a55:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a58:	83 ec 08             	sub    $0x8,%esp
+  801a5b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a5e:	50                   	push   %eax
+  801a5f:	ff 36                	push   (%esi)
+  801a61:	e8 42 fb ff ff       	call   8015a8 <dev_lookup>
+  801a66:	83 c4 10             	add    $0x10,%esp
+  801a69:	85 c0                	test   %eax,%eax
+  801a6b:	78 31                	js     801a9e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801a6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a70:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a74:	74 2f                	je     801aa5 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a76:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a79:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a80:	00 00 00 
+	stat->st_isdir = 0;
+  801a83:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a8a:	00 00 00 
+	stat->st_dev = dev;
+  801a8d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a93:	83 ec 08             	sub    $0x8,%esp
+  801a96:	53                   	push   %ebx
+  801a97:	56                   	push   %esi
+  801a98:	ff 50 14             	call   *0x14(%eax)
+  801a9b:	83 c4 10             	add    $0x10,%esp
+}
+  801a9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aa1:	5b                   	pop    %ebx
+  801aa2:	5e                   	pop    %esi
+  801aa3:	5d                   	pop    %ebp
+  801aa4:	c3                   	ret
+		return -E_NOT_SUPP;
+  801aa5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aaa:	eb f2                	jmp    801a9e <fstat+0x67>
+
+00801aac <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801aac:	55                   	push   %ebp
+  801aad:	89 e5                	mov    %esp,%ebp
+  801aaf:	56                   	push   %esi
+  801ab0:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801ab1:	83 ec 08             	sub    $0x8,%esp
+  801ab4:	68 00 10 00 00       	push   $0x1000
+  801ab9:	ff 75 08             	push   0x8(%ebp)
+  801abc:	e8 b3 07 00 00       	call   802274 <open>
+  801ac1:	89 c3                	mov    %eax,%ebx
+  801ac3:	83 c4 10             	add    $0x10,%esp
+  801ac6:	85 c0                	test   %eax,%eax
+  801ac8:	78 1b                	js     801ae5 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801aca:	83 ec 08             	sub    $0x8,%esp
+  801acd:	ff 75 0c             	push   0xc(%ebp)
+  801ad0:	50                   	push   %eax
+  801ad1:	e8 61 ff ff ff       	call   801a37 <fstat>
+  801ad6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ad8:	89 1c 24             	mov    %ebx,(%esp)
+  801adb:	e8 a2 fb ff ff       	call   801682 <close>
+	return r;
+  801ae0:	83 c4 10             	add    $0x10,%esp
+  801ae3:	89 f3                	mov    %esi,%ebx
+}
+  801ae5:	89 d8                	mov    %ebx,%eax
+  801ae7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aea:	5b                   	pop    %ebx
+  801aeb:	5e                   	pop    %esi
+  801aec:	5d                   	pop    %ebp
+  801aed:	c3                   	ret
+
+00801aee <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801aee:	55                   	push   %ebp
+  801aef:	89 e5                	mov    %esp,%ebp
+  801af1:	57                   	push   %edi
+  801af2:	56                   	push   %esi
+  801af3:	53                   	push   %ebx
+  801af4:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801afa:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801b00:	89 d6                	mov    %edx,%esi
+  801b02:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801b08:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801b0b:	89 d3                	mov    %edx,%ebx
+  801b0d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801b13:	83 3d c8 c0 88 00 00 	cmpl   $0x0,0x88c0c8
+  801b1a:	74 1d                	je     801b39 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b1c:	b8 00 b0 88 00       	mov    $0x88b000,%eax
+  801b21:	83 c8 07             	or     $0x7,%eax
+  801b24:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801b2a:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801b2f:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801b35:	01 ce                	add    %ecx,%esi
+  801b37:	eb 28                	jmp    801b61 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b39:	83 ec 0c             	sub    $0xc,%esp
+  801b3c:	6a 01                	push   $0x1
+  801b3e:	e8 59 f9 ff ff       	call   80149c <ipc_find_env>
+  801b43:	a3 c8 c0 88 00       	mov    %eax,0x88c0c8
+  801b48:	83 c4 10             	add    $0x10,%esp
+  801b4b:	eb cf                	jmp    801b1c <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801b4d:	83 c0 01             	add    $0x1,%eax
+  801b50:	89 fa                	mov    %edi,%edx
+  801b52:	09 da                	or     %ebx,%edx
+  801b54:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801b5b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b61:	39 f3                	cmp    %esi,%ebx
+  801b63:	72 e8                	jb     801b4d <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801b65:	83 f8 41             	cmp    $0x41,%eax
+  801b68:	77 2f                	ja     801b99 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801b6a:	50                   	push   %eax
+  801b6b:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801b71:	50                   	push   %eax
+  801b72:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801b78:	ff 35 c8 c0 88 00    	push   0x88c0c8
+  801b7e:	e8 cb f8 ff ff       	call   80144e <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801b83:	83 c4 0c             	add    $0xc,%esp
+  801b86:	6a 00                	push   $0x0
+  801b88:	6a 00                	push   $0x0
+  801b8a:	6a 00                	push   $0x0
+  801b8c:	e8 67 f7 ff ff       	call   8012f8 <ipc_recv>
+}
+  801b91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b94:	5b                   	pop    %ebx
+  801b95:	5e                   	pop    %esi
+  801b96:	5f                   	pop    %edi
+  801b97:	5d                   	pop    %ebp
+  801b98:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801b99:	68 f8 40 80 00       	push   $0x8040f8
+  801b9e:	68 47 40 80 00       	push   $0x804047
+  801ba3:	6a 40                	push   $0x40
+  801ba5:	68 14 41 80 00       	push   $0x804114
+  801baa:	e8 73 e8 ff ff       	call   800422 <_panic>
+
+00801baf <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801baf:	55                   	push   %ebp
+  801bb0:	89 e5                	mov    %esp,%ebp
+  801bb2:	57                   	push   %edi
+  801bb3:	56                   	push   %esi
+  801bb4:	53                   	push   %ebx
+  801bb5:	83 ec 1c             	sub    $0x1c,%esp
+  801bb8:	89 c3                	mov    %eax,%ebx
+  801bba:	89 d6                	mov    %edx,%esi
+  801bbc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801bbf:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801bc5:	89 ca                	mov    %ecx,%edx
+  801bc7:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801bca:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801bd1:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801bd4:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801bdb:	8b 76 0c             	mov    0xc(%esi),%esi
+  801bde:	89 fb                	mov    %edi,%ebx
+  801be0:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801be7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801bea:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801bf1:	8b 75 08             	mov    0x8(%ebp),%esi
+  801bf4:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801bfb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bfe:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801c05:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801c08:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801c0f:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801c14:	39 c8                	cmp    %ecx,%eax
+  801c16:	74 0d                	je     801c25 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c20:	5b                   	pop    %ebx
+  801c21:	5e                   	pop    %esi
+  801c22:	5f                   	pop    %edi
+  801c23:	5d                   	pop    %ebp
+  801c24:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801c25:	6a 07                	push   $0x7
+  801c27:	68 00 b0 88 00       	push   $0x88b000
+  801c2c:	6a 0d                	push   $0xd
+  801c2e:	ff 35 c8 c0 88 00    	push   0x88c0c8
+  801c34:	e8 2a f7 ff ff       	call   801363 <ipc_send>
+  801c39:	83 c4 10             	add    $0x10,%esp
+  801c3c:	eb da                	jmp    801c18 <fsring_post+0x69>
+
+00801c3e <fsipcv>:
+{
+  801c3e:	55                   	push   %ebp
+  801c3f:	89 e5                	mov    %esp,%ebp
+  801c41:	57                   	push   %edi
+  801c42:	56                   	push   %esi
+  801c43:	53                   	push   %ebx
+  801c44:	83 ec 0c             	sub    $0xc,%esp
+  801c47:	89 c7                	mov    %eax,%edi
+  801c49:	89 d3                	mov    %edx,%ebx
+  801c4b:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801c4d:	83 3d c8 c0 88 00 00 	cmpl   $0x0,0x88c0c8
+  801c54:	74 26                	je     801c7c <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801c56:	6a 07                	push   $0x7
+  801c58:	68 00 b0 88 00       	push   $0x88b000
+  801c5d:	57                   	push   %edi
+  801c5e:	ff 35 c8 c0 88 00    	push   0x88c0c8
+  801c64:	e8 fa f6 ff ff       	call   801363 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801c69:	6a 00                	push   $0x0
+  801c6b:	56                   	push   %esi
+  801c6c:	53                   	push   %ebx
+  801c6d:	6a 00                	push   $0x0
+  801c6f:	e8 47 f7 ff ff       	call   8013bb <ipc_recvv>
+}
+  801c74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c77:	5b                   	pop    %ebx
+  801c78:	5e                   	pop    %esi
+  801c79:	5f                   	pop    %edi
+  801c7a:	5d                   	pop    %ebp
+  801c7b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c7c:	83 ec 0c             	sub    $0xc,%esp
+  801c7f:	6a 01                	push   $0x1
+  801c81:	e8 16 f8 ff ff       	call   80149c <ipc_find_env>
+  801c86:	a3 c8 c0 88 00       	mov    %eax,0x88c0c8
+  801c8b:	83 c4 10             	add    $0x10,%esp
+  801c8e:	eb c6                	jmp    801c56 <fsipcv+0x18>
+
+00801c90 <fsipc>:
+{
+  801c90:	55                   	push   %ebp
+  801c91:	89 e5                	mov    %esp,%ebp
+  801c93:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801c96:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801c9d:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801ca0:	e8 99 ff ff ff       	call   801c3e <fsipcv>
+}
+  801ca5:	c9                   	leave
+  801ca6:	c3                   	ret
+
+00801ca7 <file_write_direct>:
+{
+  801ca7:	55                   	push   %ebp
+  801ca8:	89 e5                	mov    %esp,%ebp
+  801caa:	56                   	push   %esi
+  801cab:	53                   	push   %ebx
+  801cac:	89 c3                	mov    %eax,%ebx
+  801cae:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801cb0:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801cb6:	77 40                	ja     801cf8 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801cb8:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801cbd:	39 c8                	cmp    %ecx,%eax
+  801cbf:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801cc2:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801cc5:	89 0d 00 b0 88 00    	mov    %ecx,0x88b000
+	fsipcbuf.write.req_n = n;
+  801ccb:	a3 04 b0 88 00       	mov    %eax,0x88b004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801cd0:	83 ec 04             	sub    $0x4,%esp
+  801cd3:	50                   	push   %eax
+  801cd4:	52                   	push   %edx
+  801cd5:	68 08 b0 88 00       	push   $0x88b008
+  801cda:	e8 92 ef ff ff       	call   800c71 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801cdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce4:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ce9:	e8 a2 ff ff ff       	call   801c90 <fsipc>
+  801cee:	83 c4 10             	add    $0x10,%esp
+}
+  801cf1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf4:	5b                   	pop    %ebx
+  801cf5:	5e                   	pop    %esi
+  801cf6:	5d                   	pop    %ebp
+  801cf7:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801cf8:	89 d6                	mov    %edx,%esi
+  801cfa:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801d00:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801d05:	29 f1                	sub    %esi,%ecx
+  801d07:	39 c1                	cmp    %eax,%ecx
+  801d09:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801d0c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801d0f:	a3 00 b0 88 00       	mov    %eax,0x88b000
+	fsipcbuf.bulk.req_n = n;
+  801d14:	89 0d 04 b0 88 00    	mov    %ecx,0x88b004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801d1a:	89 35 08 b0 88 00    	mov    %esi,0x88b008
+	return fsipc_pages(type, buf, n, perm);
+  801d20:	83 ec 0c             	sub    $0xc,%esp
+  801d23:	6a 05                	push   $0x5
+  801d25:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801d2a:	e8 bf fd ff ff       	call   801aee <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801d2f:	83 c4 10             	add    $0x10,%esp
+  801d32:	eb bd                	jmp    801cf1 <file_write_direct+0x4a>
+
+00801d34 <devfile_sync>:
+{
+  801d34:	55                   	push   %ebp
+  801d35:	89 e5                	mov    %esp,%ebp
+  801d37:	57                   	push   %edi
+  801d38:	56                   	push   %esi
+  801d39:	53                   	push   %ebx
+  801d3a:	83 ec 28             	sub    $0x28,%esp
+  801d3d:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801d40:	56                   	push   %esi
+  801d41:	e8 a5 f7 ff ff       	call   8014eb <fd2data>
+  801d46:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801d48:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801d4b:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801d52:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d55:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801d5a:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801d5e:	74 45                	je     801da5 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801d60:	8b 46 14             	mov    0x14(%esi),%eax
+  801d63:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801d66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d70:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801d73:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801d76:	39 cb                	cmp    %ecx,%ebx
+  801d78:	73 14                	jae    801d8e <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801d7a:	29 d9                	sub    %ebx,%ecx
+  801d7c:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801d7f:	89 f0                	mov    %esi,%eax
+  801d81:	e8 21 ff ff ff       	call   801ca7 <file_write_direct>
+  801d86:	85 c0                	test   %eax,%eax
+  801d88:	7e 04                	jle    801d8e <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801d8a:	01 c3                	add    %eax,%ebx
+  801d8c:	eb e5                	jmp    801d73 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801d8e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d91:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801d98:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801da2:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801da5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801da8:	5b                   	pop    %ebx
+  801da9:	5e                   	pop    %esi
+  801daa:	5f                   	pop    %edi
+  801dab:	5d                   	pop    %ebp
+  801dac:	c3                   	ret
+
+00801dad <devfile_write>:
+{
+  801dad:	55                   	push   %ebp
+  801dae:	89 e5                	mov    %esp,%ebp
+  801db0:	57                   	push   %edi
+  801db1:	56                   	push   %esi
+  801db2:	53                   	push   %ebx
+  801db3:	83 ec 28             	sub    $0x28,%esp
+  801db6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801db9:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801dbc:	53                   	push   %ebx
+  801dbd:	e8 29 f7 ff ff       	call   8014eb <fd2data>
+  801dc2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801dc5:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801dc8:	83 c4 10             	add    $0x10,%esp
+  801dcb:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801dcf:	74 43                	je     801e14 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801dd1:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801dd8:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801ddb:	85 c0                	test   %eax,%eax
+  801ddd:	74 43                	je     801e22 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801ddf:	89 c2                	mov    %eax,%edx
+  801de1:	03 53 14             	add    0x14(%ebx),%edx
+  801de4:	39 fa                	cmp    %edi,%edx
+  801de6:	75 0b                	jne    801df3 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801de8:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801deb:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801df1:	76 66                	jbe    801e59 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801df3:	83 ec 0c             	sub    $0xc,%esp
+  801df6:	53                   	push   %ebx
+  801df7:	e8 38 ff ff ff       	call   801d34 <devfile_sync>
+  801dfc:	83 c4 10             	add    $0x10,%esp
+  801dff:	85 c0                	test   %eax,%eax
+  801e01:	78 4e                	js     801e51 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801e03:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e09:	77 56                	ja     801e61 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801e0b:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	75 20                	jne    801e32 <devfile_write+0x85>
+  801e12:	eb 16                	jmp    801e2a <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801e14:	89 f1                	mov    %esi,%ecx
+  801e16:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e19:	89 d8                	mov    %ebx,%eax
+  801e1b:	e8 87 fe ff ff       	call   801ca7 <file_write_direct>
+  801e20:	eb 2f                	jmp    801e51 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801e22:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e28:	77 37                	ja     801e61 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801e2a:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801e32:	83 ec 04             	sub    $0x4,%esp
+  801e35:	56                   	push   %esi
+  801e36:	ff 75 0c             	push   0xc(%ebp)
+  801e39:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e3c:	01 c1                	add    %eax,%ecx
+  801e3e:	51                   	push   %ecx
+  801e3f:	e8 2d ee ff ff       	call   800c71 <memmove>
+	ff->buf_wlen += n;
+  801e44:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801e47:	01 f7                	add    %esi,%edi
+  801e49:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801e4c:	89 f0                	mov    %esi,%eax
+  801e4e:	83 c4 10             	add    $0x10,%esp
+}
+  801e51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e54:	5b                   	pop    %ebx
+  801e55:	5e                   	pop    %esi
+  801e56:	5f                   	pop    %edi
+  801e57:	5d                   	pop    %ebp
+  801e58:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801e59:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e5f:	76 d1                	jbe    801e32 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801e61:	89 f1                	mov    %esi,%ecx
+  801e63:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e66:	89 d8                	mov    %ebx,%eax
+  801e68:	e8 3a fe ff ff       	call   801ca7 <file_write_direct>
+  801e6d:	eb e2                	jmp    801e51 <devfile_write+0xa4>
+
+00801e6f <devfile_trunc>:
+{
+  801e6f:	55                   	push   %ebp
+  801e70:	89 e5                	mov    %esp,%ebp
+  801e72:	53                   	push   %ebx
+  801e73:	83 ec 10             	sub    $0x10,%esp
+  801e76:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801e79:	53                   	push   %ebx
+  801e7a:	e8 b5 fe ff ff       	call   801d34 <devfile_sync>
+  801e7f:	83 c4 10             	add    $0x10,%esp
+  801e82:	85 c0                	test   %eax,%eax
+  801e84:	78 1f                	js     801ea5 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e86:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801e89:	a3 00 b0 88 00       	mov    %eax,0x88b000
+	fsipcbuf.set_size.req_size = newsize;
+  801e8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e91:	a3 04 b0 88 00       	mov    %eax,0x88b004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e96:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e9b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ea0:	e8 eb fd ff ff       	call   801c90 <fsipc>
+}
+  801ea5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ea8:	c9                   	leave
+  801ea9:	c3                   	ret
+
+00801eaa <devfile_stat>:
+{
+  801eaa:	55                   	push   %ebp
+  801eab:	89 e5                	mov    %esp,%ebp
+  801ead:	56                   	push   %esi
+  801eae:	53                   	push   %ebx
+  801eaf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801eb2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801eb5:	83 ec 0c             	sub    $0xc,%esp
+  801eb8:	53                   	push   %ebx
+  801eb9:	e8 76 fe ff ff       	call   801d34 <devfile_sync>
+  801ebe:	83 c4 10             	add    $0x10,%esp
+  801ec1:	85 c0                	test   %eax,%eax
+  801ec3:	78 47                	js     801f0c <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ec5:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801ec8:	a3 00 b0 88 00       	mov    %eax,0x88b000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ecd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ed2:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ed7:	e8 b4 fd ff ff       	call   801c90 <fsipc>
+  801edc:	85 c0                	test   %eax,%eax
+  801ede:	78 2c                	js     801f0c <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ee0:	83 ec 08             	sub    $0x8,%esp
+  801ee3:	68 00 b0 88 00       	push   $0x88b000
+  801ee8:	56                   	push   %esi
+  801ee9:	e8 fd eb ff ff       	call   800aeb <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801eee:	a1 80 b0 88 00       	mov    0x88b080,%eax
+  801ef3:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ef9:	a1 84 b0 88 00       	mov    0x88b084,%eax
+  801efe:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801f04:	83 c4 10             	add    $0x10,%esp
+  801f07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f0f:	5b                   	pop    %ebx
+  801f10:	5e                   	pop    %esi
+  801f11:	5d                   	pop    %ebp
+  801f12:	c3                   	ret
+
+00801f13 <devfile_flush>:
+{
+  801f13:	55                   	push   %ebp
+  801f14:	89 e5                	mov    %esp,%ebp
+  801f16:	56                   	push   %esi
+  801f17:	53                   	push   %ebx
+  801f18:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801f1b:	83 ec 0c             	sub    $0xc,%esp
+  801f1e:	56                   	push   %esi
+  801f1f:	e8 10 fe ff ff       	call   801d34 <devfile_sync>
+  801f24:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801f26:	83 c4 10             	add    $0x10,%esp
+  801f29:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801f2d:	75 25                	jne    801f54 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f2f:	8b 46 0c             	mov    0xc(%esi),%eax
+  801f32:	a3 00 b0 88 00       	mov    %eax,0x88b000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801f37:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f41:	e8 4a fd ff ff       	call   801c90 <fsipc>
+  801f46:	85 c0                	test   %eax,%eax
+  801f48:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801f4b:	89 d8                	mov    %ebx,%eax
+  801f4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f50:	5b                   	pop    %ebx
+  801f51:	5e                   	pop    %esi
+  801f52:	5d                   	pop    %ebp
+  801f53:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801f54:	83 ec 0c             	sub    $0xc,%esp
+  801f57:	56                   	push   %esi
+  801f58:	e8 8e f5 ff ff       	call   8014eb <fd2data>
+  801f5d:	83 c4 08             	add    $0x8,%esp
+  801f60:	50                   	push   %eax
+  801f61:	6a 00                	push   $0x0
+  801f63:	e8 1c f0 ff ff       	call   800f84 <sys_page_unmap>
+  801f68:	83 c4 10             	add    $0x10,%esp
+  801f6b:	eb c2                	jmp    801f2f <devfile_flush+0x1c>
+
+00801f6d <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801f6d:	55                   	push   %ebp
+  801f6e:	89 e5                	mov    %esp,%ebp
+  801f70:	57                   	push   %edi
+  801f71:	56                   	push   %esi
+  801f72:	53                   	push   %ebx
+  801f73:	83 ec 64             	sub    $0x64,%esp
+  801f76:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801f78:	52                   	push   %edx
+  801f79:	50                   	push   %eax
+  801f7a:	e8 d9 f5 ff ff       	call   801558 <fd_lookup>
+  801f7f:	89 c1                	mov    %eax,%ecx
+  801f81:	83 c4 10             	add    $0x10,%esp
+  801f84:	85 c0                	test   %eax,%eax
+  801f86:	0f 88 f2 00 00 00    	js     80207e <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801f8c:	8b 07                	mov    (%edi),%eax
+  801f8e:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801f94:	39 10                	cmp    %edx,(%eax)
+  801f96:	0f 85 03 01 00 00    	jne    80209f <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801f9c:	a1 00 a0 88 00       	mov    0x88a000,%eax
+  801fa1:	8b 40 48             	mov    0x48(%eax),%eax
+  801fa4:	3b 05 c4 c0 88 00    	cmp    0x88c0c4,%eax
+  801faa:	0f 84 96 00 00 00    	je     802046 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801fb0:	83 3d c8 c0 88 00 00 	cmpl   $0x0,0x88c0c8
+  801fb7:	0f 84 cb 00 00 00    	je     802088 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801fbd:	b8 00 b0 88 00       	mov    $0x88b000,%eax
+  801fc2:	83 c8 07             	or     $0x7,%eax
+  801fc5:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801fc8:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801fcb:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801fd0:	83 ec 04             	sub    $0x4,%esp
+  801fd3:	68 07 04 00 00       	push   $0x407
+  801fd8:	53                   	push   %ebx
+  801fd9:	6a 00                	push   $0x0
+  801fdb:	e8 17 ef ff ff       	call   800ef7 <sys_page_alloc>
+  801fe0:	89 c1                	mov    %eax,%ecx
+  801fe2:	83 c4 10             	add    $0x10,%esp
+  801fe5:	85 c0                	test   %eax,%eax
+  801fe7:	0f 88 91 00 00 00    	js     80207e <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801fed:	89 d8                	mov    %ebx,%eax
+  801fef:	83 c8 07             	or     $0x7,%eax
+  801ff2:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801ff4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ffa:	83 c6 04             	add    $0x4,%esi
+  801ffd:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  802003:	75 cb                	jne    801fd0 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  802005:	6a 12                	push   $0x12
+  802007:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80200a:	50                   	push   %eax
+  80200b:	6a 0c                	push   $0xc
+  80200d:	ff 35 c8 c0 88 00    	push   0x88c0c8
+  802013:	e8 36 f4 ff ff       	call   80144e <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802018:	83 c4 0c             	add    $0xc,%esp
+  80201b:	6a 00                	push   $0x0
+  80201d:	6a 00                	push   $0x0
+  80201f:	6a 00                	push   $0x0
+  802021:	e8 d2 f2 ff ff       	call   8012f8 <ipc_recv>
+  802026:	89 c1                	mov    %eax,%ecx
+  802028:	83 c4 10             	add    $0x10,%esp
+  80202b:	85 c0                	test   %eax,%eax
+  80202d:	78 4f                	js     80207e <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  80202f:	a1 00 a0 88 00       	mov    0x88a000,%eax
+  802034:	8b 40 48             	mov    0x48(%eax),%eax
+  802037:	a3 c4 c0 88 00       	mov    %eax,0x88c0c4
+	fsring_busy = 0;
+  80203c:	c7 05 c0 c0 88 00 00 	movl   $0x0,0x88c0c0
+  802043:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  802046:	83 ec 0c             	sub    $0xc,%esp
+  802049:	ff 37                	push   (%edi)
+  80204b:	e8 e4 fc ff ff       	call   801d34 <devfile_sync>
+  802050:	89 c1                	mov    %eax,%ecx
+  802052:	83 c4 10             	add    $0x10,%esp
+  802055:	85 c0                	test   %eax,%eax
+  802057:	78 25                	js     80207e <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  802059:	8b 1d c0 c0 88 00    	mov    0x88c0c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  80205f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  802064:	ba 01 00 00 00       	mov    $0x1,%edx
+  802069:	89 d0                	mov    %edx,%eax
+  80206b:	d3 e0                	shl    %cl,%eax
+  80206d:	85 d8                	test   %ebx,%eax
+  80206f:	74 0d                	je     80207e <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802071:	83 c1 01             	add    $0x1,%ecx
+  802074:	83 f9 10             	cmp    $0x10,%ecx
+  802077:	75 f0                	jne    802069 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  802079:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  80207e:	89 c8                	mov    %ecx,%eax
+  802080:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802083:	5b                   	pop    %ebx
+  802084:	5e                   	pop    %esi
+  802085:	5f                   	pop    %edi
+  802086:	5d                   	pop    %ebp
+  802087:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802088:	83 ec 0c             	sub    $0xc,%esp
+  80208b:	6a 01                	push   $0x1
+  80208d:	e8 0a f4 ff ff       	call   80149c <ipc_find_env>
+  802092:	a3 c8 c0 88 00       	mov    %eax,0x88c0c8
+  802097:	83 c4 10             	add    $0x10,%esp
+  80209a:	e9 1e ff ff ff       	jmp    801fbd <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  80209f:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  8020a4:	eb d8                	jmp    80207e <fsring_slot+0x111>
+
+008020a6 <file_read_direct>:
+{
+  8020a6:	55                   	push   %ebp
+  8020a7:	89 e5                	mov    %esp,%ebp
+  8020a9:	57                   	push   %edi
+  8020aa:	56                   	push   %esi
+  8020ab:	53                   	push   %ebx
+  8020ac:	83 ec 1c             	sub    $0x1c,%esp
+  8020af:	89 c7                	mov    %eax,%edi
+  8020b1:	89 d6                	mov    %edx,%esi
+  8020b3:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  8020b5:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  8020bb:	77 52                	ja     80210f <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020bd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020c0:	a3 00 b0 88 00       	mov    %eax,0x88b000
+	fsipcbuf.read.req_n = n;
+  8020c5:	89 0d 04 b0 88 00    	mov    %ecx,0x88b004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8020cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020d5:	e8 b6 fb ff ff       	call   801c90 <fsipc>
+  8020da:	89 c7                	mov    %eax,%edi
+  8020dc:	85 c0                	test   %eax,%eax
+  8020de:	78 25                	js     802105 <file_read_direct+0x5f>
+	assert(r <= n);
+  8020e0:	39 c3                	cmp    %eax,%ebx
+  8020e2:	0f 82 87 00 00 00    	jb     80216f <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  8020e8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8020ed:	0f 8f 95 00 00 00    	jg     802188 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8020f3:	83 ec 04             	sub    $0x4,%esp
+  8020f6:	50                   	push   %eax
+  8020f7:	68 00 b0 88 00       	push   $0x88b000
+  8020fc:	56                   	push   %esi
+  8020fd:	e8 6f eb ff ff       	call   800c71 <memmove>
+	return r;
+  802102:	83 c4 10             	add    $0x10,%esp
+}
+  802105:	89 f8                	mov    %edi,%eax
+  802107:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80210a:	5b                   	pop    %ebx
+  80210b:	5e                   	pop    %esi
+  80210c:	5f                   	pop    %edi
+  80210d:	5d                   	pop    %ebp
+  80210e:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80210f:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802115:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80211a:	29 d1                	sub    %edx,%ecx
+  80211c:	39 d9                	cmp    %ebx,%ecx
+  80211e:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802121:	89 f0                	mov    %esi,%eax
+  802123:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  802126:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802129:	eb 0f                	jmp    80213a <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  80212b:	0f b6 10             	movzbl (%eax),%edx
+  80212e:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802130:	05 00 10 00 00       	add    $0x1000,%eax
+  802135:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80213a:	39 c8                	cmp    %ecx,%eax
+  80213c:	72 ed                	jb     80212b <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  80213e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802141:	8b 47 0c             	mov    0xc(%edi),%eax
+  802144:	a3 00 b0 88 00       	mov    %eax,0x88b000
+	fsipcbuf.bulk.req_n = n;
+  802149:	89 1d 04 b0 88 00    	mov    %ebx,0x88b004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  80214f:	89 15 08 b0 88 00    	mov    %edx,0x88b008
+	return fsipc_pages(type, buf, n, perm);
+  802155:	83 ec 0c             	sub    $0xc,%esp
+  802158:	6a 07                	push   $0x7
+  80215a:	89 d9                	mov    %ebx,%ecx
+  80215c:	89 f2                	mov    %esi,%edx
+  80215e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802163:	e8 86 f9 ff ff       	call   801aee <fsipc_pages>
+  802168:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  80216a:	83 c4 10             	add    $0x10,%esp
+  80216d:	eb 96                	jmp    802105 <file_read_direct+0x5f>
+	assert(r <= n);
+  80216f:	68 1f 41 80 00       	push   $0x80411f
+  802174:	68 47 40 80 00       	push   $0x804047
+  802179:	68 dc 00 00 00       	push   $0xdc
+  80217e:	68 14 41 80 00       	push   $0x804114
+  802183:	e8 9a e2 ff ff       	call   800422 <_panic>
+	assert(r <= PGSIZE);
+  802188:	68 30 41 80 00       	push   $0x804130
+  80218d:	68 47 40 80 00       	push   $0x804047
+  802192:	68 dd 00 00 00       	push   $0xdd
+  802197:	68 14 41 80 00       	push   $0x804114
+  80219c:	e8 81 e2 ff ff       	call   800422 <_panic>
+
+008021a1 <devfile_read>:
+{
+  8021a1:	55                   	push   %ebp
+  8021a2:	89 e5                	mov    %esp,%ebp
+  8021a4:	57                   	push   %edi
+  8021a5:	56                   	push   %esi
+  8021a6:	53                   	push   %ebx
+  8021a7:	83 ec 28             	sub    $0x28,%esp
+  8021aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8021ad:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8021b0:	53                   	push   %ebx
+  8021b1:	e8 35 f3 ff ff       	call   8014eb <fd2data>
+  8021b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8021b9:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8021bc:	83 c4 10             	add    $0x10,%esp
+  8021bf:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8021c3:	74 7d                	je     802242 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8021c5:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8021c9:	0f 85 81 00 00 00    	jne    802250 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  8021cf:	8b 43 18             	mov    0x18(%ebx),%eax
+  8021d2:	85 c0                	test   %eax,%eax
+  8021d4:	74 0d                	je     8021e3 <devfile_read+0x42>
+  8021d6:	8b 53 14             	mov    0x14(%ebx),%edx
+  8021d9:	39 fa                	cmp    %edi,%edx
+  8021db:	7f 06                	jg     8021e3 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8021dd:	01 c2                	add    %eax,%edx
+  8021df:	39 d7                	cmp    %edx,%edi
+  8021e1:	72 28                	jb     80220b <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8021e3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8021ea:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8021f0:	77 74                	ja     802266 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8021f2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021f7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8021fa:	89 d8                	mov    %ebx,%eax
+  8021fc:	e8 a5 fe ff ff       	call   8020a6 <file_read_direct>
+  802201:	85 c0                	test   %eax,%eax
+  802203:	7e 35                	jle    80223a <devfile_read+0x99>
+		ff->buf_base = pos;
+  802205:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  802208:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  80220b:	8b 53 14             	mov    0x14(%ebx),%edx
+  80220e:	89 d0                	mov    %edx,%eax
+  802210:	03 43 18             	add    0x18(%ebx),%eax
+  802213:	29 f8                	sub    %edi,%eax
+  802215:	39 f0                	cmp    %esi,%eax
+  802217:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  80221a:	83 ec 04             	sub    $0x4,%esp
+  80221d:	56                   	push   %esi
+  80221e:	89 f8                	mov    %edi,%eax
+  802220:	29 d0                	sub    %edx,%eax
+  802222:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802225:	01 c1                	add    %eax,%ecx
+  802227:	51                   	push   %ecx
+  802228:	ff 75 0c             	push   0xc(%ebp)
+  80222b:	e8 41 ea ff ff       	call   800c71 <memmove>
+	fd->fd_offset = pos + n;
+  802230:	01 f7                	add    %esi,%edi
+  802232:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802235:	89 f0                	mov    %esi,%eax
+  802237:	83 c4 10             	add    $0x10,%esp
+}
+  80223a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80223d:	5b                   	pop    %ebx
+  80223e:	5e                   	pop    %esi
+  80223f:	5f                   	pop    %edi
+  802240:	5d                   	pop    %ebp
+  802241:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802242:	89 f1                	mov    %esi,%ecx
+  802244:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802247:	89 d8                	mov    %ebx,%eax
+  802249:	e8 58 fe ff ff       	call   8020a6 <file_read_direct>
+  80224e:	eb ea                	jmp    80223a <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802250:	83 ec 0c             	sub    $0xc,%esp
+  802253:	53                   	push   %ebx
+  802254:	e8 db fa ff ff       	call   801d34 <devfile_sync>
+  802259:	83 c4 10             	add    $0x10,%esp
+  80225c:	85 c0                	test   %eax,%eax
+  80225e:	0f 89 6b ff ff ff    	jns    8021cf <devfile_read+0x2e>
+  802264:	eb d4                	jmp    80223a <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  802266:	89 f1                	mov    %esi,%ecx
+  802268:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80226b:	89 d8                	mov    %ebx,%eax
+  80226d:	e8 34 fe ff ff       	call   8020a6 <file_read_direct>
+  802272:	eb c6                	jmp    80223a <devfile_read+0x99>
+
+00802274 <open>:
+{
+  802274:	55                   	push   %ebp
+  802275:	89 e5                	mov    %esp,%ebp
+  802277:	56                   	push   %esi
+  802278:	53                   	push   %ebx
+  802279:	83 ec 1c             	sub    $0x1c,%esp
+  80227c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80227f:	56                   	push   %esi
+  802280:	e8 2b e8 ff ff       	call   800ab0 <strlen>
+  802285:	83 c4 10             	add    $0x10,%esp
+  802288:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80228d:	0f 8f a0 00 00 00    	jg     802333 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  802293:	83 ec 0c             	sub    $0xc,%esp
+  802296:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802299:	50                   	push   %eax
+  80229a:	e8 63 f2 ff ff       	call   801502 <fd_alloc>
+  80229f:	89 c3                	mov    %eax,%ebx
+  8022a1:	83 c4 10             	add    $0x10,%esp
+  8022a4:	85 c0                	test   %eax,%eax
+  8022a6:	78 45                	js     8022ed <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  8022a8:	83 ec 08             	sub    $0x8,%esp
+  8022ab:	56                   	push   %esi
+  8022ac:	68 00 b0 88 00       	push   $0x88b000
+  8022b1:	e8 35 e8 ff ff       	call   800aeb <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8022b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022b9:	a3 00 b4 88 00       	mov    %eax,0x88b400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8022be:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022c6:	e8 c5 f9 ff ff       	call   801c90 <fsipc>
+  8022cb:	89 c3                	mov    %eax,%ebx
+  8022cd:	83 c4 10             	add    $0x10,%esp
+  8022d0:	85 c0                	test   %eax,%eax
+  8022d2:	78 22                	js     8022f6 <open+0x82>
+	if (!(mode & O_NOBUF)
+  8022d4:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8022db:	74 2b                	je     802308 <open+0x94>
+	return fd2num(fd);
+  8022dd:	83 ec 0c             	sub    $0xc,%esp
+  8022e0:	ff 75 f4             	push   -0xc(%ebp)
+  8022e3:	e8 f3 f1 ff ff       	call   8014db <fd2num>
+  8022e8:	89 c3                	mov    %eax,%ebx
+  8022ea:	83 c4 10             	add    $0x10,%esp
+}
+  8022ed:	89 d8                	mov    %ebx,%eax
+  8022ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022f2:	5b                   	pop    %ebx
+  8022f3:	5e                   	pop    %esi
+  8022f4:	5d                   	pop    %ebp
+  8022f5:	c3                   	ret
+		fd_close(fd, 0);
+  8022f6:	83 ec 08             	sub    $0x8,%esp
+  8022f9:	6a 00                	push   $0x0
+  8022fb:	ff 75 f4             	push   -0xc(%ebp)
+  8022fe:	e8 f8 f2 ff ff       	call   8015fb <fd_close>
+		return r;
+  802303:	83 c4 10             	add    $0x10,%esp
+  802306:	eb e5                	jmp    8022ed <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  802308:	83 ec 0c             	sub    $0xc,%esp
+  80230b:	ff 75 f4             	push   -0xc(%ebp)
+  80230e:	e8 d8 f1 ff ff       	call   8014eb <fd2data>
+  802313:	83 c4 0c             	add    $0xc,%esp
+  802316:	68 07 04 00 00       	push   $0x407
+  80231b:	50                   	push   %eax
+  80231c:	6a 00                	push   $0x0
+  80231e:	e8 d4 eb ff ff       	call   800ef7 <sys_page_alloc>
+  802323:	83 c4 10             	add    $0x10,%esp
+  802326:	85 c0                	test   %eax,%eax
+  802328:	75 b3                	jne    8022dd <open+0x69>
+		fd->fd_file.buffered = 1;
+  80232a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80232d:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802331:	eb aa                	jmp    8022dd <open+0x69>
+		return -E_BAD_PATH;
+  802333:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802338:	eb b3                	jmp    8022ed <open+0x79>
+
+0080233a <readdir>:
+{
+  80233a:	55                   	push   %ebp
+  80233b:	89 e5                	mov    %esp,%ebp
+  80233d:	53                   	push   %ebx
+  80233e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802341:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802344:	50                   	push   %eax
+  802345:	ff 75 08             	push   0x8(%ebp)
+  802348:	e8 0b f2 ff ff       	call   801558 <fd_lookup>
+  80234d:	89 c3                	mov    %eax,%ebx
+  80234f:	83 c4 10             	add    $0x10,%esp
+  802352:	85 c0                	test   %eax,%eax
+  802354:	78 73                	js     8023c9 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802356:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802359:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  80235f:	39 08                	cmp    %ecx,(%eax)
+  802361:	0f 85 82 00 00 00    	jne    8023e9 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802367:	83 ec 0c             	sub    $0xc,%esp
+  80236a:	50                   	push   %eax
+  80236b:	e8 c4 f9 ff ff       	call   801d34 <devfile_sync>
+  802370:	89 c3                	mov    %eax,%ebx
+  802372:	83 c4 10             	add    $0x10,%esp
+  802375:	85 c0                	test   %eax,%eax
+  802377:	78 50                	js     8023c9 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802379:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80237c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80237f:	a3 00 b0 88 00       	mov    %eax,0x88b000
+	fsipcbuf.readdir.req_n = n;
+  802384:	8b 45 10             	mov    0x10(%ebp),%eax
+  802387:	a3 04 b0 88 00       	mov    %eax,0x88b004
+	fsipcbuf.readdir.req_flags = flags;
+  80238c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80238f:	a3 08 b0 88 00       	mov    %eax,0x88b008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  802394:	ba 00 00 00 00       	mov    $0x0,%edx
+  802399:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80239e:	e8 ed f8 ff ff       	call   801c90 <fsipc>
+  8023a3:	89 c3                	mov    %eax,%ebx
+  8023a5:	85 c0                	test   %eax,%eax
+  8023a7:	7e 20                	jle    8023c9 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  8023a9:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8023ac:	72 22                	jb     8023d0 <readdir+0x96>
+  8023ae:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8023b3:	7f 1b                	jg     8023d0 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8023b5:	83 ec 04             	sub    $0x4,%esp
+  8023b8:	50                   	push   %eax
+  8023b9:	68 00 b0 88 00       	push   $0x88b000
+  8023be:	ff 75 0c             	push   0xc(%ebp)
+  8023c1:	e8 ab e8 ff ff       	call   800c71 <memmove>
+	return r;
+  8023c6:	83 c4 10             	add    $0x10,%esp
+}
+  8023c9:	89 d8                	mov    %ebx,%eax
+  8023cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ce:	c9                   	leave
+  8023cf:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8023d0:	68 26 41 80 00       	push   $0x804126
+  8023d5:	68 47 40 80 00       	push   $0x804047
+  8023da:	68 86 01 00 00       	push   $0x186
+  8023df:	68 14 41 80 00       	push   $0x804114
+  8023e4:	e8 39 e0 ff ff       	call   800422 <_panic>
+		return -E_NOT_SUPP;
+  8023e9:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8023ee:	eb d9                	jmp    8023c9 <readdir+0x8f>
+
+008023f0 <munmap>:
+{
+  8023f0:	55                   	push   %ebp
+  8023f1:	89 e5                	mov    %esp,%ebp
+  8023f3:	56                   	push   %esi
+  8023f4:	53                   	push   %ebx
+  8023f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8023f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8023fb:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  802401:	75 41                	jne    802444 <munmap+0x54>
+  802403:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  802409:	77 39                	ja     802444 <munmap+0x54>
+  80240b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802410:	29 f0                	sub    %esi,%eax
+  802412:	39 d0                	cmp    %edx,%eax
+  802414:	72 35                	jb     80244b <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802416:	89 f3                	mov    %esi,%ebx
+  802418:	01 d6                	add    %edx,%esi
+  80241a:	39 f3                	cmp    %esi,%ebx
+  80241c:	73 1a                	jae    802438 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  80241e:	83 ec 08             	sub    $0x8,%esp
+  802421:	53                   	push   %ebx
+  802422:	6a 00                	push   $0x0
+  802424:	e8 5b eb ff ff       	call   800f84 <sys_page_unmap>
+  802429:	83 c4 10             	add    $0x10,%esp
+  80242c:	85 c0                	test   %eax,%eax
+  80242e:	78 0d                	js     80243d <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802430:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802436:	eb e2                	jmp    80241a <munmap+0x2a>
+	return 0;
+  802438:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80243d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802440:	5b                   	pop    %ebx
+  802441:	5e                   	pop    %esi
+  802442:	5d                   	pop    %ebp
+  802443:	c3                   	ret
+		return -E_INVAL;
+  802444:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802449:	eb f2                	jmp    80243d <munmap+0x4d>
+  80244b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802450:	eb eb                	jmp    80243d <munmap+0x4d>
+
+00802452 <mmap>:
+{
+  802452:	55                   	push   %ebp
+  802453:	89 e5                	mov    %esp,%ebp
+  802455:	57                   	push   %edi
+  802456:	56                   	push   %esi
+  802457:	53                   	push   %ebx
+  802458:	83 ec 34             	sub    $0x34,%esp
+  80245b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80245e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802461:	50                   	push   %eax
+  802462:	ff 75 18             	push   0x18(%ebp)
+  802465:	e8 ee f0 ff ff       	call   801558 <fd_lookup>
+  80246a:	89 c3                	mov    %eax,%ebx
+  80246c:	83 c4 10             	add    $0x10,%esp
+  80246f:	85 c0                	test   %eax,%eax
+  802471:	0f 88 0e 01 00 00    	js     802585 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802477:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80247a:	a1 20 50 80 00       	mov    0x805020,%eax
+  80247f:	39 02                	cmp    %eax,(%edx)
+  802481:	0f 85 50 01 00 00    	jne    8025d7 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802487:	8b 45 10             	mov    0x10(%ebp),%eax
+  80248a:	83 e0 02             	and    $0x2,%eax
+  80248d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802490:	74 0a                	je     80249c <mmap+0x4a>
+  802492:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802496:	0f 84 42 01 00 00    	je     8025de <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  80249c:	8b 42 08             	mov    0x8(%edx),%eax
+  80249f:	83 e0 03             	and    $0x3,%eax
+  8024a2:	83 f8 01             	cmp    $0x1,%eax
+  8024a5:	0f 84 3a 01 00 00    	je     8025e5 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8024ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ae:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8024b1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8024b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8024b9:	0f 85 2d 01 00 00    	jne    8025ec <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8024bf:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8024c3:	0f 88 2a 01 00 00    	js     8025f3 <mmap+0x1a1>
+  8024c9:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8024d0:	0f 87 1d 01 00 00    	ja     8025f3 <mmap+0x1a1>
+  8024d6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8024db:	2b 45 08             	sub    0x8(%ebp),%eax
+  8024de:	39 f8                	cmp    %edi,%eax
+  8024e0:	0f 82 14 01 00 00    	jb     8025fa <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8024e6:	83 ec 0c             	sub    $0xc,%esp
+  8024e9:	52                   	push   %edx
+  8024ea:	e8 45 f8 ff ff       	call   801d34 <devfile_sync>
+  8024ef:	89 c3                	mov    %eax,%ebx
+  8024f1:	83 c4 10             	add    $0x10,%esp
+  8024f4:	85 c0                	test   %eax,%eax
+  8024f6:	0f 88 89 00 00 00    	js     802585 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8024fc:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802502:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802508:	be 00 00 00 00       	mov    $0x0,%esi
+  80250d:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802510:	39 fe                	cmp    %edi,%esi
+  802512:	73 7b                	jae    80258f <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  802514:	89 f8                	mov    %edi,%eax
+  802516:	29 f0                	sub    %esi,%eax
+  802518:	c1 e8 0c             	shr    $0xc,%eax
+  80251b:	ba 40 00 00 00       	mov    $0x40,%edx
+  802520:	39 d0                	cmp    %edx,%eax
+  802522:	0f 47 c2             	cmova  %edx,%eax
+  802525:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802528:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80252b:	8b 52 0c             	mov    0xc(%edx),%edx
+  80252e:	89 15 00 b0 88 00    	mov    %edx,0x88b000
+		fsipcbuf.map.req_offset = offset + done;
+  802534:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802537:	89 15 04 b0 88 00    	mov    %edx,0x88b004
+		fsipcbuf.map.req_npages = n;
+  80253d:	a3 08 b0 88 00       	mov    %eax,0x88b008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802542:	89 f2                	mov    %esi,%edx
+  802544:	03 55 08             	add    0x8(%ebp),%edx
+  802547:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80254a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80254f:	e8 ea f6 ff ff       	call   801c3e <fsipcv>
+  802554:	85 c0                	test   %eax,%eax
+  802556:	7e 12                	jle    80256a <mmap+0x118>
+  802558:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80255b:	85 c0                	test   %eax,%eax
+  80255d:	0f 84 9e 00 00 00    	je     802601 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802563:	c1 e0 0c             	shl    $0xc,%eax
+  802566:	01 c6                	add    %eax,%esi
+  802568:	eb a6                	jmp    802510 <mmap+0xbe>
+			munmap(addr, done);
+  80256a:	89 c3                	mov    %eax,%ebx
+  80256c:	83 ec 08             	sub    $0x8,%esp
+  80256f:	56                   	push   %esi
+  802570:	ff 75 08             	push   0x8(%ebp)
+  802573:	e8 78 fe ff ff       	call   8023f0 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802578:	83 c4 10             	add    $0x10,%esp
+  80257b:	85 db                	test   %ebx,%ebx
+  80257d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802582:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802585:	89 d8                	mov    %ebx,%eax
+  802587:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80258a:	5b                   	pop    %ebx
+  80258b:	5e                   	pop    %esi
+  80258c:	5f                   	pop    %edi
+  80258d:	5d                   	pop    %ebp
+  80258e:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80258f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802592:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802594:	85 c0                	test   %eax,%eax
+  802596:	74 ed                	je     802585 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802598:	be 00 00 00 00       	mov    $0x0,%esi
+  80259d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8025a0:	39 fe                	cmp    %edi,%esi
+  8025a2:	73 2e                	jae    8025d2 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8025a4:	83 ec 0c             	sub    $0xc,%esp
+  8025a7:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8025aa:	50                   	push   %eax
+  8025ab:	e8 fd 0f 00 00       	call   8035ad <cowpage>
+  8025b0:	83 c4 10             	add    $0x10,%esp
+  8025b3:	85 c0                	test   %eax,%eax
+  8025b5:	78 08                	js     8025bf <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8025b7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8025bd:	eb e1                	jmp    8025a0 <mmap+0x14e>
+				munmap(addr, len);
+  8025bf:	89 c3                	mov    %eax,%ebx
+  8025c1:	83 ec 08             	sub    $0x8,%esp
+  8025c4:	57                   	push   %edi
+  8025c5:	ff 75 08             	push   0x8(%ebp)
+  8025c8:	e8 23 fe ff ff       	call   8023f0 <munmap>
+				return r;
+  8025cd:	83 c4 10             	add    $0x10,%esp
+  8025d0:	eb b3                	jmp    802585 <mmap+0x133>
+	return 0;
+  8025d2:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8025d5:	eb ae                	jmp    802585 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8025d7:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8025dc:	eb a7                	jmp    802585 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8025de:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8025e3:	eb a0                	jmp    802585 <mmap+0x133>
+		return -E_INVAL;
+  8025e5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025ea:	eb 99                	jmp    802585 <mmap+0x133>
+  8025ec:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025f1:	eb 92                	jmp    802585 <mmap+0x133>
+  8025f3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025f8:	eb 8b                	jmp    802585 <mmap+0x133>
+  8025fa:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025ff:	eb 84                	jmp    802585 <mmap+0x133>
+			munmap(addr, done);
+  802601:	83 ec 08             	sub    $0x8,%esp
+  802604:	56                   	push   %esi
+  802605:	ff 75 08             	push   0x8(%ebp)
+  802608:	e8 e3 fd ff ff       	call   8023f0 <munmap>
+  80260d:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802610:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802615:	e9 6b ff ff ff       	jmp    802585 <mmap+0x133>
+
+0080261a <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80261a:	55                   	push   %ebp
+  80261b:	89 e5                	mov    %esp,%ebp
+  80261d:	56                   	push   %esi
+  80261e:	53                   	push   %ebx
+  80261f:	83 ec 10             	sub    $0x10,%esp
+  802622:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802625:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802628:	8b 45 08             	mov    0x8(%ebp),%eax
+  80262b:	e8 3d f9 ff ff       	call   801f6d <fsring_slot>
+  802630:	85 c0                	test   %eax,%eax
+  802632:	78 60                	js     802694 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802634:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802637:	8b 56 08             	mov    0x8(%esi),%edx
+  80263a:	83 e2 03             	and    $0x3,%edx
+  80263d:	83 fa 01             	cmp    $0x1,%edx
+  802640:	74 59                	je     80269b <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802642:	ba 01 00 00 00       	mov    $0x1,%edx
+  802647:	89 c1                	mov    %eax,%ecx
+  802649:	d3 e2                	shl    %cl,%edx
+  80264b:	09 15 c0 c0 88 00    	or     %edx,0x88c0c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802651:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802654:	c1 e2 02             	shl    $0x2,%edx
+  802657:	8d 8a 00 c0 88 00    	lea    0x88c000(%edx),%ecx
+  80265d:	c7 82 00 c0 88 00 03 	movl   $0x3,0x88c000(%edx)
+  802664:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802667:	8b 55 18             	mov    0x18(%ebp),%edx
+  80266a:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80266d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802670:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802673:	83 ec 08             	sub    $0x8,%esp
+  802676:	50                   	push   %eax
+  802677:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80267c:	39 c3                	cmp    %eax,%ebx
+  80267e:	0f 47 d8             	cmova  %eax,%ebx
+  802681:	53                   	push   %ebx
+  802682:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802685:	89 f2                	mov    %esi,%edx
+  802687:	b8 03 00 00 00       	mov    $0x3,%eax
+  80268c:	e8 1e f5 ff ff       	call   801baf <fsring_post>
+  802691:	83 c4 10             	add    $0x10,%esp
+}
+  802694:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802697:	5b                   	pop    %ebx
+  802698:	5e                   	pop    %esi
+  802699:	5d                   	pop    %ebp
+  80269a:	c3                   	ret
+		return -E_INVAL;
+  80269b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026a0:	eb f2                	jmp    802694 <fsring_read+0x7a>
+
+008026a2 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8026a2:	55                   	push   %ebp
+  8026a3:	89 e5                	mov    %esp,%ebp
+  8026a5:	56                   	push   %esi
+  8026a6:	53                   	push   %ebx
+  8026a7:	83 ec 10             	sub    $0x10,%esp
+  8026aa:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8026ad:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026b3:	e8 b5 f8 ff ff       	call   801f6d <fsring_slot>
+  8026b8:	89 c3                	mov    %eax,%ebx
+  8026ba:	85 c0                	test   %eax,%eax
+  8026bc:	78 77                	js     802735 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8026be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026c1:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8026c5:	74 77                	je     80273e <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8026c7:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8026cc:	39 c6                	cmp    %eax,%esi
+  8026ce:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8026d1:	83 ec 04             	sub    $0x4,%esp
+  8026d4:	56                   	push   %esi
+  8026d5:	ff 75 0c             	push   0xc(%ebp)
+  8026d8:	89 d8                	mov    %ebx,%eax
+  8026da:	c1 e0 0c             	shl    $0xc,%eax
+  8026dd:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8026e3:	50                   	push   %eax
+  8026e4:	e8 88 e5 ff ff       	call   800c71 <memmove>
+	fsring_busy |= 1 << slot;
+  8026e9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026ee:	89 d9                	mov    %ebx,%ecx
+  8026f0:	d3 e0                	shl    %cl,%eax
+  8026f2:	09 05 c0 c0 88 00    	or     %eax,0x88c0c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8026f8:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8026fb:	c1 e0 02             	shl    $0x2,%eax
+  8026fe:	8d 90 00 c0 88 00    	lea    0x88c000(%eax),%edx
+  802704:	c7 80 00 c0 88 00 04 	movl   $0x4,0x88c000(%eax)
+  80270b:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80270e:	8b 45 18             	mov    0x18(%ebp),%eax
+  802711:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  802714:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  80271b:	83 c4 08             	add    $0x8,%esp
+  80271e:	53                   	push   %ebx
+  80271f:	56                   	push   %esi
+  802720:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802723:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802726:	b8 04 00 00 00       	mov    $0x4,%eax
+  80272b:	e8 7f f4 ff ff       	call   801baf <fsring_post>
+  802730:	89 c3                	mov    %eax,%ebx
+  802732:	83 c4 10             	add    $0x10,%esp
+}
+  802735:	89 d8                	mov    %ebx,%eax
+  802737:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80273a:	5b                   	pop    %ebx
+  80273b:	5e                   	pop    %esi
+  80273c:	5d                   	pop    %ebp
+  80273d:	c3                   	ret
+		return -E_INVAL;
+  80273e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802743:	eb f0                	jmp    802735 <fsring_write+0x93>
+
+00802745 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802745:	55                   	push   %ebp
+  802746:	89 e5                	mov    %esp,%ebp
+  802748:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80274b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80274e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802751:	e8 17 f8 ff ff       	call   801f6d <fsring_slot>
+  802756:	85 c0                	test   %eax,%eax
+  802758:	78 4c                	js     8027a6 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  80275a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80275f:	89 c1                	mov    %eax,%ecx
+  802761:	d3 e2                	shl    %cl,%edx
+  802763:	09 15 c0 c0 88 00    	or     %edx,0x88c0c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802769:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80276c:	c1 e2 02             	shl    $0x2,%edx
+  80276f:	8d 8a 00 c0 88 00    	lea    0x88c000(%edx),%ecx
+  802775:	c7 82 00 c0 88 00 05 	movl   $0x5,0x88c000(%edx)
+  80277c:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80277f:	8b 55 10             	mov    0x10(%ebp),%edx
+  802782:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802785:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802788:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80278b:	83 ec 08             	sub    $0x8,%esp
+  80278e:	50                   	push   %eax
+  80278f:	6a 00                	push   $0x0
+  802791:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802796:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802799:	b8 05 00 00 00       	mov    $0x5,%eax
+  80279e:	e8 0c f4 ff ff       	call   801baf <fsring_post>
+  8027a3:	83 c4 10             	add    $0x10,%esp
+}
+  8027a6:	c9                   	leave
+  8027a7:	c3                   	ret
+
+008027a8 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8027a8:	55                   	push   %ebp
+  8027a9:	89 e5                	mov    %esp,%ebp
+  8027ab:	57                   	push   %edi
+  8027ac:	56                   	push   %esi
+  8027ad:	53                   	push   %ebx
+  8027ae:	83 ec 1c             	sub    $0x1c,%esp
+  8027b1:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8027b5:	a1 00 a0 88 00       	mov    0x88a000,%eax
+  8027ba:	8b 40 48             	mov    0x48(%eax),%eax
+  8027bd:	3b 05 c4 c0 88 00    	cmp    0x88c0c4,%eax
+  8027c3:	74 12                	je     8027d7 <fsring_reap+0x2f>
+		return 0;
+  8027c5:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8027ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027cd:	5b                   	pop    %ebx
+  8027ce:	5e                   	pop    %esi
+  8027cf:	5f                   	pop    %edi
+  8027d0:	5d                   	pop    %ebp
+  8027d1:	c3                   	ret
+		sys_yield();
+  8027d2:	e8 01 e7 ff ff       	call   800ed8 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8027d7:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8027dd:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8027e2:	39 c2                	cmp    %eax,%edx
+  8027e4:	75 18                	jne    8027fe <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8027e6:	84 db                	test   %bl,%bl
+  8027e8:	0f 84 21 01 00 00    	je     80290f <fsring_reap+0x167>
+  8027ee:	83 3d c0 c0 88 00 00 	cmpl   $0x0,0x88c0c0
+  8027f5:	75 db                	jne    8027d2 <fsring_reap+0x2a>
+			return 0;
+  8027f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027fc:	eb cc                	jmp    8027ca <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8027fe:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802803:	83 e0 0f             	and    $0xf,%eax
+  802806:	83 c0 2a             	add    $0x2a,%eax
+  802809:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802810:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802817:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80281c:	83 c0 01             	add    $0x1,%eax
+  80281f:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802824:	83 fb 0f             	cmp    $0xf,%ebx
+  802827:	77 5b                	ja     802884 <fsring_reap+0xdc>
+  802829:	be 01 00 00 00       	mov    $0x1,%esi
+  80282e:	89 d9                	mov    %ebx,%ecx
+  802830:	d3 e6                	shl    %cl,%esi
+  802832:	89 f0                	mov    %esi,%eax
+  802834:	23 05 c0 c0 88 00    	and    0x88c0c0,%eax
+  80283a:	74 48                	je     802884 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  80283c:	89 d8                	mov    %ebx,%eax
+  80283e:	c1 e0 0c             	shl    $0xc,%eax
+  802841:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802847:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  80284a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80284d:	8b 04 85 00 c0 88 00 	mov    0x88c000(,%eax,4),%eax
+  802854:	83 f8 03             	cmp    $0x3,%eax
+  802857:	74 40                	je     802899 <fsring_reap+0xf1>
+  802859:	83 f8 05             	cmp    $0x5,%eax
+  80285c:	74 64                	je     8028c2 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  80285e:	f7 d6                	not    %esi
+  802860:	21 35 c0 c0 88 00    	and    %esi,0x88c0c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802866:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802869:	8b 14 85 04 c0 88 00 	mov    0x88c004(,%eax,4),%edx
+  802870:	8b 45 08             	mov    0x8(%ebp),%eax
+  802873:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802875:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802878:	89 38                	mov    %edi,(%eax)
+	return 1;
+  80287a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80287f:	e9 46 ff ff ff       	jmp    8027ca <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802884:	53                   	push   %ebx
+  802885:	68 3c 41 80 00       	push   $0x80413c
+  80288a:	68 8f 02 00 00       	push   $0x28f
+  80288f:	68 14 41 80 00       	push   $0x804114
+  802894:	e8 89 db ff ff       	call   800422 <_panic>
+		if (cqe.cqe_result > 0)
+  802899:	85 ff                	test   %edi,%edi
+  80289b:	7e c1                	jle    80285e <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80289d:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8028a0:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8028a5:	39 c7                	cmp    %eax,%edi
+  8028a7:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8028aa:	50                   	push   %eax
+  8028ab:	ff 75 e4             	push   -0x1c(%ebp)
+  8028ae:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8028b1:	ff 34 85 08 c0 88 00 	push   0x88c008(,%eax,4)
+  8028b8:	e8 b4 e3 ff ff       	call   800c71 <memmove>
+  8028bd:	83 c4 10             	add    $0x10,%esp
+  8028c0:	eb 9c                	jmp    80285e <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8028c2:	85 ff                	test   %edi,%edi
+  8028c4:	75 98                	jne    80285e <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  8028c6:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8028c9:	8b 0c 85 08 c0 88 00 	mov    0x88c008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8028d0:	83 ec 08             	sub    $0x8,%esp
+  8028d3:	ff 75 e4             	push   -0x1c(%ebp)
+  8028d6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8028d9:	51                   	push   %ecx
+  8028da:	e8 0c e2 ff ff       	call   800aeb <strcpy>
+			st->st_size = ret->ret_size;
+  8028df:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028e2:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8028e8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8028eb:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8028f1:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8028f7:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8028fd:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  802904:	50 80 00 
+  802907:	83 c4 10             	add    $0x10,%esp
+  80290a:	e9 4f ff ff ff       	jmp    80285e <fsring_reap+0xb6>
+			return 0;
+  80290f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802914:	e9 b1 fe ff ff       	jmp    8027ca <fsring_reap+0x22>
+
+00802919 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802919:	55                   	push   %ebp
+  80291a:	89 e5                	mov    %esp,%ebp
+  80291c:	57                   	push   %edi
+  80291d:	56                   	push   %esi
+  80291e:	53                   	push   %ebx
+  80291f:	83 ec 28             	sub    $0x28,%esp
+  802922:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802925:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802928:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80292b:	53                   	push   %ebx
+  80292c:	e8 7f e1 ff ff       	call   800ab0 <strlen>
+  802931:	83 c4 10             	add    $0x10,%esp
+  802934:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802939:	0f 8f 02 01 00 00    	jg     802a41 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  80293f:	83 ec 08             	sub    $0x8,%esp
+  802942:	53                   	push   %ebx
+  802943:	68 00 b0 88 00       	push   $0x88b000
+  802948:	e8 9e e1 ff ff       	call   800aeb <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  80294d:	83 c4 10             	add    $0x10,%esp
+  802950:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802956:	76 69                	jbe    8029c1 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802958:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80295b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802961:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802966:	29 d1                	sub    %edx,%ecx
+  802968:	39 f9                	cmp    %edi,%ecx
+  80296a:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80296d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802970:	89 f9                	mov    %edi,%ecx
+  802972:	01 c1                	add    %eax,%ecx
+  802974:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802977:	eb 0f                	jmp    802988 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802979:	0f b6 10             	movzbl (%eax),%edx
+  80297c:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80297e:	05 00 10 00 00       	add    $0x1000,%eax
+  802983:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802988:	39 c8                	cmp    %ecx,%eax
+  80298a:	72 ed                	jb     802979 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  80298c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80298f:	89 3d 00 b4 88 00    	mov    %edi,0x88b400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802995:	89 15 04 b4 88 00    	mov    %edx,0x88b404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  80299b:	83 ec 0c             	sub    $0xc,%esp
+  80299e:	6a 07                	push   $0x7
+  8029a0:	89 f9                	mov    %edi,%ecx
+  8029a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029a5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8029aa:	e8 3f f1 ff ff       	call   801aee <fsipc_pages>
+  8029af:	89 c7                	mov    %eax,%edi
+  8029b1:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8029b4:	85 f6                	test   %esi,%esi
+  8029b6:	74 7f                	je     802a37 <file_slurp+0x11e>
+  8029b8:	8d 43 01             	lea    0x1(%ebx),%eax
+  8029bb:	85 ff                	test   %edi,%edi
+  8029bd:	79 3c                	jns    8029fb <file_slurp+0xe2>
+  8029bf:	eb 76                	jmp    802a37 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8029c1:	89 3d 00 b4 88 00    	mov    %edi,0x88b400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8029c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029cc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8029d1:	e8 ba f2 ff ff       	call   801c90 <fsipc>
+  8029d6:	89 c7                	mov    %eax,%edi
+  8029d8:	85 c0                	test   %eax,%eax
+  8029da:	7e d8                	jle    8029b4 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8029dc:	83 ec 04             	sub    $0x4,%esp
+  8029df:	50                   	push   %eax
+  8029e0:	68 08 b0 88 00       	push   $0x88b008
+  8029e5:	ff 75 0c             	push   0xc(%ebp)
+  8029e8:	e8 84 e2 ff ff       	call   800c71 <memmove>
+  8029ed:	83 c4 10             	add    $0x10,%esp
+  8029f0:	eb c2                	jmp    8029b4 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8029f2:	80 fa 2f             	cmp    $0x2f,%dl
+  8029f5:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8029f8:	83 c0 01             	add    $0x1,%eax
+  8029fb:	89 c1                	mov    %eax,%ecx
+  8029fd:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802a01:	84 d2                	test   %dl,%dl
+  802a03:	75 ed                	jne    8029f2 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802a05:	83 ec 04             	sub    $0x4,%esp
+  802a08:	68 80 00 00 00       	push   $0x80
+  802a0d:	53                   	push   %ebx
+  802a0e:	56                   	push   %esi
+  802a0f:	e8 4d e1 ff ff       	call   800b61 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802a14:	a1 00 b0 88 00       	mov    0x88b000,%eax
+  802a19:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802a1f:	a1 04 b0 88 00       	mov    0x88b004,%eax
+  802a24:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802a2a:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  802a31:	50 80 00 
+  802a34:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802a37:	89 f8                	mov    %edi,%eax
+  802a39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a3c:	5b                   	pop    %ebx
+  802a3d:	5e                   	pop    %esi
+  802a3e:	5f                   	pop    %edi
+  802a3f:	5d                   	pop    %ebp
+  802a40:	c3                   	ret
+		return -E_BAD_PATH;
+  802a41:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802a46:	eb ef                	jmp    802a37 <file_slurp+0x11e>
+
+00802a48 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802a48:	55                   	push   %ebp
+  802a49:	89 e5                	mov    %esp,%ebp
+  802a4b:	53                   	push   %ebx
+  802a4c:	83 ec 10             	sub    $0x10,%esp
+  802a4f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802a52:	53                   	push   %ebx
+  802a53:	e8 58 e0 ff ff       	call   800ab0 <strlen>
+  802a58:	83 c4 10             	add    $0x10,%esp
+  802a5b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a60:	7f 25                	jg     802a87 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802a62:	83 ec 08             	sub    $0x8,%esp
+  802a65:	53                   	push   %ebx
+  802a66:	68 00 b0 88 00       	push   $0x88b000
+  802a6b:	e8 7b e0 ff ff       	call   800aeb <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802a70:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a75:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a7a:	e8 11 f2 ff ff       	call   801c90 <fsipc>
+  802a7f:	83 c4 10             	add    $0x10,%esp
+}
+  802a82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a85:	c9                   	leave
+  802a86:	c3                   	ret
+		return -E_BAD_PATH;
+  802a87:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802a8c:	eb f4                	jmp    802a82 <remove+0x3a>
+
+00802a8e <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802a8e:	55                   	push   %ebp
+  802a8f:	89 e5                	mov    %esp,%ebp
+  802a91:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802a94:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a99:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a9e:	e8 ed f1 ff ff       	call   801c90 <fsipc>
+}
+  802aa3:	c9                   	leave
+  802aa4:	c3                   	ret
+
+00802aa5 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802aa5:	55                   	push   %ebp
+  802aa6:	89 e5                	mov    %esp,%ebp
+  802aa8:	57                   	push   %edi
+  802aa9:	56                   	push   %esi
+  802aaa:	53                   	push   %ebx
+  802aab:	83 ec 18             	sub    $0x18,%esp
+  802aae:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ab1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802ab4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802ab7:	57                   	push   %edi
+  802ab8:	e8 f3 df ff ff       	call   800ab0 <strlen>
+  802abd:	83 c4 10             	add    $0x10,%esp
+  802ac0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802ac5:	7f 4c                	jg     802b13 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802ac7:	83 ec 08             	sub    $0x8,%esp
+  802aca:	57                   	push   %edi
+  802acb:	68 00 b0 88 00       	push   $0x88b000
+  802ad0:	e8 16 e0 ff ff       	call   800aeb <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802ad5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ada:	b8 10 00 00 00       	mov    $0x10,%eax
+  802adf:	e8 ac f1 ff ff       	call   801c90 <fsipc>
+  802ae4:	83 c4 10             	add    $0x10,%esp
+  802ae7:	85 c0                	test   %eax,%eax
+  802ae9:	78 20                	js     802b0b <defrag+0x66>
+		return r;
+	if (before)
+  802aeb:	85 f6                	test   %esi,%esi
+  802aed:	74 07                	je     802af6 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802aef:	a1 00 b0 88 00       	mov    0x88b000,%eax
+  802af4:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802af6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802afb:	85 db                	test   %ebx,%ebx
+  802afd:	74 0c                	je     802b0b <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802aff:	a1 04 b0 88 00       	mov    0x88b004,%eax
+  802b04:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802b06:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b0e:	5b                   	pop    %ebx
+  802b0f:	5e                   	pop    %esi
+  802b10:	5f                   	pop    %edi
+  802b11:	5d                   	pop    %ebp
+  802b12:	c3                   	ret
+		return -E_BAD_PATH;
+  802b13:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802b18:	eb f1                	jmp    802b0b <defrag+0x66>
+
+00802b1a <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802b1a:	55                   	push   %ebp
+  802b1b:	89 e5                	mov    %esp,%ebp
+  802b1d:	53                   	push   %ebx
+  802b1e:	83 ec 04             	sub    $0x4,%esp
+  802b21:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802b24:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b29:	b8 11 00 00 00       	mov    $0x11,%eax
+  802b2e:	e8 5d f1 ff ff       	call   801c90 <fsipc>
+  802b33:	85 c0                	test   %eax,%eax
+  802b35:	78 34                	js     802b6b <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802b37:	a1 00 b0 88 00       	mov    0x88b000,%eax
+  802b3c:	89 03                	mov    %eax,(%ebx)
+  802b3e:	a1 04 b0 88 00       	mov    0x88b004,%eax
+  802b43:	89 43 04             	mov    %eax,0x4(%ebx)
+  802b46:	a1 08 b0 88 00       	mov    0x88b008,%eax
+  802b4b:	89 43 08             	mov    %eax,0x8(%ebx)
+  802b4e:	a1 0c b0 88 00       	mov    0x88b00c,%eax
+  802b53:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802b56:	a1 10 b0 88 00       	mov    0x88b010,%eax
+  802b5b:	89 43 10             	mov    %eax,0x10(%ebx)
+  802b5e:	a1 14 b0 88 00       	mov    0x88b014,%eax
+  802b63:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802b66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b6e:	c9                   	leave
+  802b6f:	c3                   	ret
+
+00802b70 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b70:	55                   	push   %ebp
+  802b71:	89 e5                	mov    %esp,%ebp
+  802b73:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802b76:	68 55 41 80 00       	push   $0x804155
+  802b7b:	ff 75 0c             	push   0xc(%ebp)
+  802b7e:	e8 68 df ff ff       	call   800aeb <strcpy>
+	return 0;
+}
+  802b83:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b88:	c9                   	leave
+  802b89:	c3                   	ret
+
+00802b8a <devsock_close>:
+{
+  802b8a:	55                   	push   %ebp
+  802b8b:	89 e5                	mov    %esp,%ebp
+  802b8d:	53                   	push   %ebx
+  802b8e:	83 ec 10             	sub    $0x10,%esp
+  802b91:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802b94:	53                   	push   %ebx
+  802b95:	e8 11 0c 00 00       	call   8037ab <pageref>
+  802b9a:	89 c2                	mov    %eax,%edx
+  802b9c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802b9f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802ba4:	83 fa 01             	cmp    $0x1,%edx
+  802ba7:	74 05                	je     802bae <devsock_close+0x24>
+}
+  802ba9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bac:	c9                   	leave
+  802bad:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802bae:	83 ec 0c             	sub    $0xc,%esp
+  802bb1:	ff 73 0c             	push   0xc(%ebx)
+  802bb4:	e8 b7 02 00 00       	call   802e70 <nsipc_close>
+  802bb9:	83 c4 10             	add    $0x10,%esp
+  802bbc:	eb eb                	jmp    802ba9 <devsock_close+0x1f>
+
+00802bbe <devsock_write>:
+{
+  802bbe:	55                   	push   %ebp
+  802bbf:	89 e5                	mov    %esp,%ebp
+  802bc1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802bc4:	6a 00                	push   $0x0
+  802bc6:	ff 75 10             	push   0x10(%ebp)
+  802bc9:	ff 75 0c             	push   0xc(%ebp)
+  802bcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bcf:	ff 70 0c             	push   0xc(%eax)
+  802bd2:	e8 79 03 00 00       	call   802f50 <nsipc_send>
+}
+  802bd7:	c9                   	leave
+  802bd8:	c3                   	ret
+
+00802bd9 <devsock_read>:
+{
+  802bd9:	55                   	push   %ebp
+  802bda:	89 e5                	mov    %esp,%ebp
+  802bdc:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802bdf:	6a 00                	push   $0x0
+  802be1:	ff 75 10             	push   0x10(%ebp)
+  802be4:	ff 75 0c             	push   0xc(%ebp)
+  802be7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bea:	ff 70 0c             	push   0xc(%eax)
+  802bed:	e8 ef 02 00 00       	call   802ee1 <nsipc_recv>
+}
+  802bf2:	c9                   	leave
+  802bf3:	c3                   	ret
+
+00802bf4 <fd2sockid>:
+{
+  802bf4:	55                   	push   %ebp
+  802bf5:	89 e5                	mov    %esp,%ebp
+  802bf7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802bfa:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802bfd:	52                   	push   %edx
+  802bfe:	50                   	push   %eax
+  802bff:	e8 54 e9 ff ff       	call   801558 <fd_lookup>
+  802c04:	83 c4 10             	add    $0x10,%esp
+  802c07:	85 c0                	test   %eax,%eax
+  802c09:	78 10                	js     802c1b <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802c0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c0e:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802c14:	39 08                	cmp    %ecx,(%eax)
+  802c16:	75 05                	jne    802c1d <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802c18:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802c1b:	c9                   	leave
+  802c1c:	c3                   	ret
+		return -E_NOT_SUPP;
+  802c1d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802c22:	eb f7                	jmp    802c1b <fd2sockid+0x27>
+
+00802c24 <alloc_sockfd>:
+{
+  802c24:	55                   	push   %ebp
+  802c25:	89 e5                	mov    %esp,%ebp
+  802c27:	56                   	push   %esi
+  802c28:	53                   	push   %ebx
+  802c29:	83 ec 1c             	sub    $0x1c,%esp
+  802c2c:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802c2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c31:	50                   	push   %eax
+  802c32:	e8 cb e8 ff ff       	call   801502 <fd_alloc>
+  802c37:	89 c3                	mov    %eax,%ebx
+  802c39:	83 c4 10             	add    $0x10,%esp
+  802c3c:	85 c0                	test   %eax,%eax
+  802c3e:	78 43                	js     802c83 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802c40:	83 ec 04             	sub    $0x4,%esp
+  802c43:	68 07 04 00 00       	push   $0x407
+  802c48:	ff 75 f4             	push   -0xc(%ebp)
+  802c4b:	6a 00                	push   $0x0
+  802c4d:	e8 a5 e2 ff ff       	call   800ef7 <sys_page_alloc>
+  802c52:	89 c3                	mov    %eax,%ebx
+  802c54:	83 c4 10             	add    $0x10,%esp
+  802c57:	85 c0                	test   %eax,%eax
+  802c59:	78 28                	js     802c83 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802c5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c5e:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802c64:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802c66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c69:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802c70:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802c73:	83 ec 0c             	sub    $0xc,%esp
+  802c76:	50                   	push   %eax
+  802c77:	e8 5f e8 ff ff       	call   8014db <fd2num>
+  802c7c:	89 c3                	mov    %eax,%ebx
+  802c7e:	83 c4 10             	add    $0x10,%esp
+  802c81:	eb 0c                	jmp    802c8f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802c83:	83 ec 0c             	sub    $0xc,%esp
+  802c86:	56                   	push   %esi
+  802c87:	e8 e4 01 00 00       	call   802e70 <nsipc_close>
+		return r;
+  802c8c:	83 c4 10             	add    $0x10,%esp
+}
+  802c8f:	89 d8                	mov    %ebx,%eax
+  802c91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c94:	5b                   	pop    %ebx
+  802c95:	5e                   	pop    %esi
+  802c96:	5d                   	pop    %ebp
+  802c97:	c3                   	ret
+
+00802c98 <accept>:
+{
+  802c98:	55                   	push   %ebp
+  802c99:	89 e5                	mov    %esp,%ebp
+  802c9b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca1:	e8 4e ff ff ff       	call   802bf4 <fd2sockid>
+  802ca6:	85 c0                	test   %eax,%eax
+  802ca8:	78 1b                	js     802cc5 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802caa:	83 ec 04             	sub    $0x4,%esp
+  802cad:	ff 75 10             	push   0x10(%ebp)
+  802cb0:	ff 75 0c             	push   0xc(%ebp)
+  802cb3:	50                   	push   %eax
+  802cb4:	e8 0e 01 00 00       	call   802dc7 <nsipc_accept>
+  802cb9:	83 c4 10             	add    $0x10,%esp
+  802cbc:	85 c0                	test   %eax,%eax
+  802cbe:	78 05                	js     802cc5 <accept+0x2d>
+	return alloc_sockfd(r);
+  802cc0:	e8 5f ff ff ff       	call   802c24 <alloc_sockfd>
+}
+  802cc5:	c9                   	leave
+  802cc6:	c3                   	ret
+
+00802cc7 <bind>:
+{
+  802cc7:	55                   	push   %ebp
+  802cc8:	89 e5                	mov    %esp,%ebp
+  802cca:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ccd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd0:	e8 1f ff ff ff       	call   802bf4 <fd2sockid>
+  802cd5:	85 c0                	test   %eax,%eax
+  802cd7:	78 12                	js     802ceb <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802cd9:	83 ec 04             	sub    $0x4,%esp
+  802cdc:	ff 75 10             	push   0x10(%ebp)
+  802cdf:	ff 75 0c             	push   0xc(%ebp)
+  802ce2:	50                   	push   %eax
+  802ce3:	e8 31 01 00 00       	call   802e19 <nsipc_bind>
+  802ce8:	83 c4 10             	add    $0x10,%esp
+}
+  802ceb:	c9                   	leave
+  802cec:	c3                   	ret
+
+00802ced <shutdown>:
+{
+  802ced:	55                   	push   %ebp
+  802cee:	89 e5                	mov    %esp,%ebp
+  802cf0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802cf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf6:	e8 f9 fe ff ff       	call   802bf4 <fd2sockid>
+  802cfb:	85 c0                	test   %eax,%eax
+  802cfd:	78 0f                	js     802d0e <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802cff:	83 ec 08             	sub    $0x8,%esp
+  802d02:	ff 75 0c             	push   0xc(%ebp)
+  802d05:	50                   	push   %eax
+  802d06:	e8 43 01 00 00       	call   802e4e <nsipc_shutdown>
+  802d0b:	83 c4 10             	add    $0x10,%esp
+}
+  802d0e:	c9                   	leave
+  802d0f:	c3                   	ret
+
+00802d10 <connect>:
+{
+  802d10:	55                   	push   %ebp
+  802d11:	89 e5                	mov    %esp,%ebp
+  802d13:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d16:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d19:	e8 d6 fe ff ff       	call   802bf4 <fd2sockid>
+  802d1e:	85 c0                	test   %eax,%eax
+  802d20:	78 12                	js     802d34 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802d22:	83 ec 04             	sub    $0x4,%esp
+  802d25:	ff 75 10             	push   0x10(%ebp)
+  802d28:	ff 75 0c             	push   0xc(%ebp)
+  802d2b:	50                   	push   %eax
+  802d2c:	e8 59 01 00 00       	call   802e8a <nsipc_connect>
+  802d31:	83 c4 10             	add    $0x10,%esp
+}
+  802d34:	c9                   	leave
+  802d35:	c3                   	ret
+
+00802d36 <listen>:
+{
+  802d36:	55                   	push   %ebp
+  802d37:	89 e5                	mov    %esp,%ebp
+  802d39:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d3f:	e8 b0 fe ff ff       	call   802bf4 <fd2sockid>
+  802d44:	85 c0                	test   %eax,%eax
+  802d46:	78 0f                	js     802d57 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802d48:	83 ec 08             	sub    $0x8,%esp
+  802d4b:	ff 75 0c             	push   0xc(%ebp)
+  802d4e:	50                   	push   %eax
+  802d4f:	e8 6b 01 00 00       	call   802ebf <nsipc_listen>
+  802d54:	83 c4 10             	add    $0x10,%esp
+}
+  802d57:	c9                   	leave
+  802d58:	c3                   	ret
+
+00802d59 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802d59:	55                   	push   %ebp
+  802d5a:	89 e5                	mov    %esp,%ebp
+  802d5c:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802d5f:	ff 75 10             	push   0x10(%ebp)
+  802d62:	ff 75 0c             	push   0xc(%ebp)
+  802d65:	ff 75 08             	push   0x8(%ebp)
+  802d68:	e8 41 02 00 00       	call   802fae <nsipc_socket>
+  802d6d:	83 c4 10             	add    $0x10,%esp
+  802d70:	85 c0                	test   %eax,%eax
+  802d72:	78 05                	js     802d79 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802d74:	e8 ab fe ff ff       	call   802c24 <alloc_sockfd>
+}
+  802d79:	c9                   	leave
+  802d7a:	c3                   	ret
+
+00802d7b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802d7b:	55                   	push   %ebp
+  802d7c:	89 e5                	mov    %esp,%ebp
+  802d7e:	53                   	push   %ebx
+  802d7f:	83 ec 04             	sub    $0x4,%esp
+  802d82:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802d84:	83 3d 00 e0 88 00 00 	cmpl   $0x0,0x88e000
+  802d8b:	74 26                	je     802db3 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802d8d:	6a 07                	push   $0x7
+  802d8f:	68 00 d0 88 00       	push   $0x88d000
+  802d94:	53                   	push   %ebx
+  802d95:	ff 35 00 e0 88 00    	push   0x88e000
+  802d9b:	e8 c3 e5 ff ff       	call   801363 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802da0:	83 c4 0c             	add    $0xc,%esp
+  802da3:	6a 00                	push   $0x0
+  802da5:	6a 00                	push   $0x0
+  802da7:	6a 00                	push   $0x0
+  802da9:	e8 4a e5 ff ff       	call   8012f8 <ipc_recv>
+}
+  802dae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802db1:	c9                   	leave
+  802db2:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802db3:	83 ec 0c             	sub    $0xc,%esp
+  802db6:	6a 02                	push   $0x2
+  802db8:	e8 df e6 ff ff       	call   80149c <ipc_find_env>
+  802dbd:	a3 00 e0 88 00       	mov    %eax,0x88e000
+  802dc2:	83 c4 10             	add    $0x10,%esp
+  802dc5:	eb c6                	jmp    802d8d <nsipc+0x12>
+
+00802dc7 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802dc7:	55                   	push   %ebp
+  802dc8:	89 e5                	mov    %esp,%ebp
+  802dca:	56                   	push   %esi
+  802dcb:	53                   	push   %ebx
+  802dcc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802dcf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dd2:	a3 00 d0 88 00       	mov    %eax,0x88d000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802dd7:	8b 06                	mov    (%esi),%eax
+  802dd9:	a3 04 d0 88 00       	mov    %eax,0x88d004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802dde:	b8 01 00 00 00       	mov    $0x1,%eax
+  802de3:	e8 93 ff ff ff       	call   802d7b <nsipc>
+  802de8:	89 c3                	mov    %eax,%ebx
+  802dea:	85 c0                	test   %eax,%eax
+  802dec:	79 09                	jns    802df7 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802dee:	89 d8                	mov    %ebx,%eax
+  802df0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802df3:	5b                   	pop    %ebx
+  802df4:	5e                   	pop    %esi
+  802df5:	5d                   	pop    %ebp
+  802df6:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802df7:	83 ec 04             	sub    $0x4,%esp
+  802dfa:	ff 35 10 d0 88 00    	push   0x88d010
+  802e00:	68 00 d0 88 00       	push   $0x88d000
+  802e05:	ff 75 0c             	push   0xc(%ebp)
+  802e08:	e8 64 de ff ff       	call   800c71 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802e0d:	a1 10 d0 88 00       	mov    0x88d010,%eax
+  802e12:	89 06                	mov    %eax,(%esi)
+  802e14:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802e17:	eb d5                	jmp    802dee <nsipc_accept+0x27>
+
+00802e19 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802e19:	55                   	push   %ebp
+  802e1a:	89 e5                	mov    %esp,%ebp
+  802e1c:	53                   	push   %ebx
+  802e1d:	83 ec 08             	sub    $0x8,%esp
+  802e20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802e23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e26:	a3 00 d0 88 00       	mov    %eax,0x88d000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802e2b:	53                   	push   %ebx
+  802e2c:	ff 75 0c             	push   0xc(%ebp)
+  802e2f:	68 04 d0 88 00       	push   $0x88d004
+  802e34:	e8 38 de ff ff       	call   800c71 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802e39:	89 1d 14 d0 88 00    	mov    %ebx,0x88d014
+	return nsipc(NSREQ_BIND);
+  802e3f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802e44:	e8 32 ff ff ff       	call   802d7b <nsipc>
+}
+  802e49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e4c:	c9                   	leave
+  802e4d:	c3                   	ret
+
+00802e4e <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802e4e:	55                   	push   %ebp
+  802e4f:	89 e5                	mov    %esp,%ebp
+  802e51:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802e54:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e57:	a3 00 d0 88 00       	mov    %eax,0x88d000
+	nsipcbuf.shutdown.req_how = how;
+  802e5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e5f:	a3 04 d0 88 00       	mov    %eax,0x88d004
+	return nsipc(NSREQ_SHUTDOWN);
+  802e64:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e69:	e8 0d ff ff ff       	call   802d7b <nsipc>
+}
+  802e6e:	c9                   	leave
+  802e6f:	c3                   	ret
+
+00802e70 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802e70:	55                   	push   %ebp
+  802e71:	89 e5                	mov    %esp,%ebp
+  802e73:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802e76:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e79:	a3 00 d0 88 00       	mov    %eax,0x88d000
+	return nsipc(NSREQ_CLOSE);
+  802e7e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e83:	e8 f3 fe ff ff       	call   802d7b <nsipc>
+}
+  802e88:	c9                   	leave
+  802e89:	c3                   	ret
+
+00802e8a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802e8a:	55                   	push   %ebp
+  802e8b:	89 e5                	mov    %esp,%ebp
+  802e8d:	53                   	push   %ebx
+  802e8e:	83 ec 08             	sub    $0x8,%esp
+  802e91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802e94:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e97:	a3 00 d0 88 00       	mov    %eax,0x88d000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802e9c:	53                   	push   %ebx
+  802e9d:	ff 75 0c             	push   0xc(%ebp)
+  802ea0:	68 04 d0 88 00       	push   $0x88d004
+  802ea5:	e8 c7 dd ff ff       	call   800c71 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802eaa:	89 1d 14 d0 88 00    	mov    %ebx,0x88d014
+	return nsipc(NSREQ_CONNECT);
+  802eb0:	b8 05 00 00 00       	mov    $0x5,%eax
+  802eb5:	e8 c1 fe ff ff       	call   802d7b <nsipc>
+}
+  802eba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ebd:	c9                   	leave
+  802ebe:	c3                   	ret
+
+00802ebf <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802ebf:	55                   	push   %ebp
+  802ec0:	89 e5                	mov    %esp,%ebp
+  802ec2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802ec5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ec8:	a3 00 d0 88 00       	mov    %eax,0x88d000
+	nsipcbuf.listen.req_backlog = backlog;
+  802ecd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ed0:	a3 04 d0 88 00       	mov    %eax,0x88d004
+	return nsipc(NSREQ_LISTEN);
+  802ed5:	b8 06 00 00 00       	mov    $0x6,%eax
+  802eda:	e8 9c fe ff ff       	call   802d7b <nsipc>
+}
+  802edf:	c9                   	leave
+  802ee0:	c3                   	ret
+
+00802ee1 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802ee1:	55                   	push   %ebp
+  802ee2:	89 e5                	mov    %esp,%ebp
+  802ee4:	56                   	push   %esi
+  802ee5:	53                   	push   %ebx
+  802ee6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802ee9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eec:	a3 00 d0 88 00       	mov    %eax,0x88d000
+	nsipcbuf.recv.req_len = len;
+  802ef1:	89 35 04 d0 88 00    	mov    %esi,0x88d004
+	nsipcbuf.recv.req_flags = flags;
+  802ef7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802efa:	a3 08 d0 88 00       	mov    %eax,0x88d008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802eff:	b8 07 00 00 00       	mov    $0x7,%eax
+  802f04:	e8 72 fe ff ff       	call   802d7b <nsipc>
+  802f09:	89 c3                	mov    %eax,%ebx
+  802f0b:	85 c0                	test   %eax,%eax
+  802f0d:	78 22                	js     802f31 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802f0f:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802f14:	39 c6                	cmp    %eax,%esi
+  802f16:	0f 4e c6             	cmovle %esi,%eax
+  802f19:	39 c3                	cmp    %eax,%ebx
+  802f1b:	7f 1d                	jg     802f3a <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802f1d:	83 ec 04             	sub    $0x4,%esp
+  802f20:	53                   	push   %ebx
+  802f21:	68 00 d0 88 00       	push   $0x88d000
+  802f26:	ff 75 0c             	push   0xc(%ebp)
+  802f29:	e8 43 dd ff ff       	call   800c71 <memmove>
+  802f2e:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802f31:	89 d8                	mov    %ebx,%eax
+  802f33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f36:	5b                   	pop    %ebx
+  802f37:	5e                   	pop    %esi
+  802f38:	5d                   	pop    %ebp
+  802f39:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802f3a:	68 61 41 80 00       	push   $0x804161
+  802f3f:	68 47 40 80 00       	push   $0x804047
+  802f44:	6a 62                	push   $0x62
+  802f46:	68 76 41 80 00       	push   $0x804176
+  802f4b:	e8 d2 d4 ff ff       	call   800422 <_panic>
+
+00802f50 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802f50:	55                   	push   %ebp
+  802f51:	89 e5                	mov    %esp,%ebp
+  802f53:	53                   	push   %ebx
+  802f54:	83 ec 04             	sub    $0x4,%esp
+  802f57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802f5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f5d:	a3 00 d0 88 00       	mov    %eax,0x88d000
+	assert(size < 1600);
+  802f62:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f68:	7f 2e                	jg     802f98 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802f6a:	83 ec 04             	sub    $0x4,%esp
+  802f6d:	53                   	push   %ebx
+  802f6e:	ff 75 0c             	push   0xc(%ebp)
+  802f71:	68 0c d0 88 00       	push   $0x88d00c
+  802f76:	e8 f6 dc ff ff       	call   800c71 <memmove>
+	nsipcbuf.send.req_size = size;
+  802f7b:	89 1d 04 d0 88 00    	mov    %ebx,0x88d004
+	nsipcbuf.send.req_flags = flags;
+  802f81:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f84:	a3 08 d0 88 00       	mov    %eax,0x88d008
+	return nsipc(NSREQ_SEND);
+  802f89:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f8e:	e8 e8 fd ff ff       	call   802d7b <nsipc>
+}
+  802f93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f96:	c9                   	leave
+  802f97:	c3                   	ret
+	assert(size < 1600);
+  802f98:	68 82 41 80 00       	push   $0x804182
+  802f9d:	68 47 40 80 00       	push   $0x804047
+  802fa2:	6a 6d                	push   $0x6d
+  802fa4:	68 76 41 80 00       	push   $0x804176
+  802fa9:	e8 74 d4 ff ff       	call   800422 <_panic>
+
+00802fae <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802fae:	55                   	push   %ebp
+  802faf:	89 e5                	mov    %esp,%ebp
+  802fb1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802fb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fb7:	a3 00 d0 88 00       	mov    %eax,0x88d000
+	nsipcbuf.socket.req_type = type;
+  802fbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fbf:	a3 04 d0 88 00       	mov    %eax,0x88d004
+	nsipcbuf.socket.req_protocol = protocol;
+  802fc4:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fc7:	a3 08 d0 88 00       	mov    %eax,0x88d008
+	return nsipc(NSREQ_SOCKET);
+  802fcc:	b8 09 00 00 00       	mov    $0x9,%eax
+  802fd1:	e8 a5 fd ff ff       	call   802d7b <nsipc>
+}
+  802fd6:	c9                   	leave
+  802fd7:	c3                   	ret
+
+00802fd8 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802fd8:	55                   	push   %ebp
+  802fd9:	89 e5                	mov    %esp,%ebp
+  802fdb:	56                   	push   %esi
+  802fdc:	53                   	push   %ebx
+  802fdd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802fe0:	83 ec 0c             	sub    $0xc,%esp
+  802fe3:	ff 75 08             	push   0x8(%ebp)
+  802fe6:	e8 00 e5 ff ff       	call   8014eb <fd2data>
+  802feb:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802fed:	83 c4 08             	add    $0x8,%esp
+  802ff0:	68 8e 41 80 00       	push   $0x80418e
+  802ff5:	53                   	push   %ebx
+  802ff6:	e8 f0 da ff ff       	call   800aeb <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802ffb:	8b 46 04             	mov    0x4(%esi),%eax
+  802ffe:	2b 06                	sub    (%esi),%eax
+  803000:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803006:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80300d:	00 00 00 
+	stat->st_dev = &devpipe;
+  803010:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  803017:	50 80 00 
+	return 0;
+}
+  80301a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80301f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803022:	5b                   	pop    %ebx
+  803023:	5e                   	pop    %esi
+  803024:	5d                   	pop    %ebp
+  803025:	c3                   	ret
+
+00803026 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803026:	55                   	push   %ebp
+  803027:	89 e5                	mov    %esp,%ebp
+  803029:	53                   	push   %ebx
+  80302a:	83 ec 0c             	sub    $0xc,%esp
+  80302d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803030:	53                   	push   %ebx
+  803031:	6a 00                	push   $0x0
+  803033:	e8 4c df ff ff       	call   800f84 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803038:	89 1c 24             	mov    %ebx,(%esp)
+  80303b:	e8 ab e4 ff ff       	call   8014eb <fd2data>
+  803040:	83 c4 08             	add    $0x8,%esp
+  803043:	50                   	push   %eax
+  803044:	6a 00                	push   $0x0
+  803046:	e8 39 df ff ff       	call   800f84 <sys_page_unmap>
+}
+  80304b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80304e:	c9                   	leave
+  80304f:	c3                   	ret
+
+00803050 <_pipeisclosed>:
+{
+  803050:	55                   	push   %ebp
+  803051:	89 e5                	mov    %esp,%ebp
+  803053:	57                   	push   %edi
+  803054:	56                   	push   %esi
+  803055:	53                   	push   %ebx
+  803056:	83 ec 1c             	sub    $0x1c,%esp
+  803059:	89 c7                	mov    %eax,%edi
+  80305b:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80305d:	a1 00 a0 88 00       	mov    0x88a000,%eax
+  803062:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803065:	83 ec 0c             	sub    $0xc,%esp
+  803068:	57                   	push   %edi
+  803069:	e8 3d 07 00 00       	call   8037ab <pageref>
+  80306e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803071:	89 34 24             	mov    %esi,(%esp)
+  803074:	e8 32 07 00 00       	call   8037ab <pageref>
+		nn = thisenv->env_runs;
+  803079:	8b 15 00 a0 88 00    	mov    0x88a000,%edx
+  80307f:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  803082:	83 c4 10             	add    $0x10,%esp
+  803085:	39 cb                	cmp    %ecx,%ebx
+  803087:	74 1b                	je     8030a4 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  803089:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80308c:	75 cf                	jne    80305d <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80308e:	8b 42 58             	mov    0x58(%edx),%eax
+  803091:	6a 01                	push   $0x1
+  803093:	50                   	push   %eax
+  803094:	53                   	push   %ebx
+  803095:	68 95 41 80 00       	push   $0x804195
+  80309a:	e8 5e d4 ff ff       	call   8004fd <cprintf>
+  80309f:	83 c4 10             	add    $0x10,%esp
+  8030a2:	eb b9                	jmp    80305d <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8030a4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8030a7:	0f 94 c0             	sete   %al
+  8030aa:	0f b6 c0             	movzbl %al,%eax
+}
+  8030ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030b0:	5b                   	pop    %ebx
+  8030b1:	5e                   	pop    %esi
+  8030b2:	5f                   	pop    %edi
+  8030b3:	5d                   	pop    %ebp
+  8030b4:	c3                   	ret
+
+008030b5 <devpipe_write>:
+{
+  8030b5:	55                   	push   %ebp
+  8030b6:	89 e5                	mov    %esp,%ebp
+  8030b8:	57                   	push   %edi
+  8030b9:	56                   	push   %esi
+  8030ba:	53                   	push   %ebx
+  8030bb:	83 ec 28             	sub    $0x28,%esp
+  8030be:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8030c1:	56                   	push   %esi
+  8030c2:	e8 24 e4 ff ff       	call   8014eb <fd2data>
+  8030c7:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8030c9:	83 c4 10             	add    $0x10,%esp
+  8030cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030d1:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8030d4:	75 09                	jne    8030df <devpipe_write+0x2a>
+	return i;
+  8030d6:	89 f8                	mov    %edi,%eax
+  8030d8:	eb 23                	jmp    8030fd <devpipe_write+0x48>
+			sys_yield();
+  8030da:	e8 f9 dd ff ff       	call   800ed8 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8030df:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030e2:	8b 0b                	mov    (%ebx),%ecx
+  8030e4:	8d 51 20             	lea    0x20(%ecx),%edx
+  8030e7:	39 d0                	cmp    %edx,%eax
+  8030e9:	72 1a                	jb     803105 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8030eb:	89 da                	mov    %ebx,%edx
+  8030ed:	89 f0                	mov    %esi,%eax
+  8030ef:	e8 5c ff ff ff       	call   803050 <_pipeisclosed>
+  8030f4:	85 c0                	test   %eax,%eax
+  8030f6:	74 e2                	je     8030da <devpipe_write+0x25>
+				return 0;
+  8030f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803100:	5b                   	pop    %ebx
+  803101:	5e                   	pop    %esi
+  803102:	5f                   	pop    %edi
+  803103:	5d                   	pop    %ebp
+  803104:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803105:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803108:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80310c:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80310f:	89 c2                	mov    %eax,%edx
+  803111:	c1 fa 1f             	sar    $0x1f,%edx
+  803114:	89 d1                	mov    %edx,%ecx
+  803116:	c1 e9 1b             	shr    $0x1b,%ecx
+  803119:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80311c:	83 e2 1f             	and    $0x1f,%edx
+  80311f:	29 ca                	sub    %ecx,%edx
+  803121:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803125:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803129:	83 c0 01             	add    $0x1,%eax
+  80312c:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80312f:	83 c7 01             	add    $0x1,%edi
+  803132:	eb 9d                	jmp    8030d1 <devpipe_write+0x1c>
+
+00803134 <devpipe_read>:
+{
+  803134:	55                   	push   %ebp
+  803135:	89 e5                	mov    %esp,%ebp
+  803137:	57                   	push   %edi
+  803138:	56                   	push   %esi
+  803139:	53                   	push   %ebx
+  80313a:	83 ec 18             	sub    $0x18,%esp
+  80313d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803140:	57                   	push   %edi
+  803141:	e8 a5 e3 ff ff       	call   8014eb <fd2data>
+  803146:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803148:	83 c4 10             	add    $0x10,%esp
+  80314b:	be 00 00 00 00       	mov    $0x0,%esi
+  803150:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803153:	75 13                	jne    803168 <devpipe_read+0x34>
+	return i;
+  803155:	89 f0                	mov    %esi,%eax
+  803157:	eb 02                	jmp    80315b <devpipe_read+0x27>
+				return i;
+  803159:	89 f0                	mov    %esi,%eax
+}
+  80315b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80315e:	5b                   	pop    %ebx
+  80315f:	5e                   	pop    %esi
+  803160:	5f                   	pop    %edi
+  803161:	5d                   	pop    %ebp
+  803162:	c3                   	ret
+			sys_yield();
+  803163:	e8 70 dd ff ff       	call   800ed8 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803168:	8b 03                	mov    (%ebx),%eax
+  80316a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80316d:	75 18                	jne    803187 <devpipe_read+0x53>
+			if (i > 0)
+  80316f:	85 f6                	test   %esi,%esi
+  803171:	75 e6                	jne    803159 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803173:	89 da                	mov    %ebx,%edx
+  803175:	89 f8                	mov    %edi,%eax
+  803177:	e8 d4 fe ff ff       	call   803050 <_pipeisclosed>
+  80317c:	85 c0                	test   %eax,%eax
+  80317e:	74 e3                	je     803163 <devpipe_read+0x2f>
+				return 0;
+  803180:	b8 00 00 00 00       	mov    $0x0,%eax
+  803185:	eb d4                	jmp    80315b <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803187:	99                   	cltd
+  803188:	c1 ea 1b             	shr    $0x1b,%edx
+  80318b:	01 d0                	add    %edx,%eax
+  80318d:	83 e0 1f             	and    $0x1f,%eax
+  803190:	29 d0                	sub    %edx,%eax
+  803192:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803197:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80319a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80319d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8031a0:	83 c6 01             	add    $0x1,%esi
+  8031a3:	eb ab                	jmp    803150 <devpipe_read+0x1c>
+
+008031a5 <pipe>:
+{
+  8031a5:	55                   	push   %ebp
+  8031a6:	89 e5                	mov    %esp,%ebp
+  8031a8:	56                   	push   %esi
+  8031a9:	53                   	push   %ebx
+  8031aa:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8031ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031b0:	50                   	push   %eax
+  8031b1:	e8 4c e3 ff ff       	call   801502 <fd_alloc>
+  8031b6:	89 c3                	mov    %eax,%ebx
+  8031b8:	83 c4 10             	add    $0x10,%esp
+  8031bb:	85 c0                	test   %eax,%eax
+  8031bd:	0f 88 23 01 00 00    	js     8032e6 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031c3:	83 ec 04             	sub    $0x4,%esp
+  8031c6:	68 07 04 00 00       	push   $0x407
+  8031cb:	ff 75 f4             	push   -0xc(%ebp)
+  8031ce:	6a 00                	push   $0x0
+  8031d0:	e8 22 dd ff ff       	call   800ef7 <sys_page_alloc>
+  8031d5:	89 c3                	mov    %eax,%ebx
+  8031d7:	83 c4 10             	add    $0x10,%esp
+  8031da:	85 c0                	test   %eax,%eax
+  8031dc:	0f 88 04 01 00 00    	js     8032e6 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8031e2:	83 ec 0c             	sub    $0xc,%esp
+  8031e5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031e8:	50                   	push   %eax
+  8031e9:	e8 14 e3 ff ff       	call   801502 <fd_alloc>
+  8031ee:	89 c3                	mov    %eax,%ebx
+  8031f0:	83 c4 10             	add    $0x10,%esp
+  8031f3:	85 c0                	test   %eax,%eax
+  8031f5:	0f 88 db 00 00 00    	js     8032d6 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031fb:	83 ec 04             	sub    $0x4,%esp
+  8031fe:	68 07 04 00 00       	push   $0x407
+  803203:	ff 75 f0             	push   -0x10(%ebp)
+  803206:	6a 00                	push   $0x0
+  803208:	e8 ea dc ff ff       	call   800ef7 <sys_page_alloc>
+  80320d:	89 c3                	mov    %eax,%ebx
+  80320f:	83 c4 10             	add    $0x10,%esp
+  803212:	85 c0                	test   %eax,%eax
+  803214:	0f 88 bc 00 00 00    	js     8032d6 <pipe+0x131>
+	va = fd2data(fd0);
+  80321a:	83 ec 0c             	sub    $0xc,%esp
+  80321d:	ff 75 f4             	push   -0xc(%ebp)
+  803220:	e8 c6 e2 ff ff       	call   8014eb <fd2data>
+  803225:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803227:	83 c4 0c             	add    $0xc,%esp
+  80322a:	68 07 04 00 00       	push   $0x407
+  80322f:	50                   	push   %eax
+  803230:	6a 00                	push   $0x0
+  803232:	e8 c0 dc ff ff       	call   800ef7 <sys_page_alloc>
+  803237:	89 c3                	mov    %eax,%ebx
+  803239:	83 c4 10             	add    $0x10,%esp
+  80323c:	85 c0                	test   %eax,%eax
+  80323e:	0f 88 82 00 00 00    	js     8032c6 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803244:	83 ec 0c             	sub    $0xc,%esp
+  803247:	ff 75 f0             	push   -0x10(%ebp)
+  80324a:	e8 9c e2 ff ff       	call   8014eb <fd2data>
+  80324f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803256:	50                   	push   %eax
+  803257:	6a 00                	push   $0x0
+  803259:	56                   	push   %esi
+  80325a:	6a 00                	push   $0x0
+  80325c:	e8 e1 dc ff ff       	call   800f42 <sys_page_map>
+  803261:	89 c3                	mov    %eax,%ebx
+  803263:	83 c4 20             	add    $0x20,%esp
+  803266:	85 c0                	test   %eax,%eax
+  803268:	78 4e                	js     8032b8 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80326a:	a1 60 50 80 00       	mov    0x805060,%eax
+  80326f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803272:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803274:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803277:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80327e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803281:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803283:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803286:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80328d:	83 ec 0c             	sub    $0xc,%esp
+  803290:	ff 75 f4             	push   -0xc(%ebp)
+  803293:	e8 43 e2 ff ff       	call   8014db <fd2num>
+  803298:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80329b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80329d:	83 c4 04             	add    $0x4,%esp
+  8032a0:	ff 75 f0             	push   -0x10(%ebp)
+  8032a3:	e8 33 e2 ff ff       	call   8014db <fd2num>
+  8032a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032ab:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8032ae:	83 c4 10             	add    $0x10,%esp
+  8032b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032b6:	eb 2e                	jmp    8032e6 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8032b8:	83 ec 08             	sub    $0x8,%esp
+  8032bb:	56                   	push   %esi
+  8032bc:	6a 00                	push   $0x0
+  8032be:	e8 c1 dc ff ff       	call   800f84 <sys_page_unmap>
+  8032c3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8032c6:	83 ec 08             	sub    $0x8,%esp
+  8032c9:	ff 75 f0             	push   -0x10(%ebp)
+  8032cc:	6a 00                	push   $0x0
+  8032ce:	e8 b1 dc ff ff       	call   800f84 <sys_page_unmap>
+  8032d3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8032d6:	83 ec 08             	sub    $0x8,%esp
+  8032d9:	ff 75 f4             	push   -0xc(%ebp)
+  8032dc:	6a 00                	push   $0x0
+  8032de:	e8 a1 dc ff ff       	call   800f84 <sys_page_unmap>
+  8032e3:	83 c4 10             	add    $0x10,%esp
+}
+  8032e6:	89 d8                	mov    %ebx,%eax
+  8032e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032eb:	5b                   	pop    %ebx
+  8032ec:	5e                   	pop    %esi
+  8032ed:	5d                   	pop    %ebp
+  8032ee:	c3                   	ret
+
+008032ef <pipeisclosed>:
+{
+  8032ef:	55                   	push   %ebp
+  8032f0:	89 e5                	mov    %esp,%ebp
+  8032f2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032f8:	50                   	push   %eax
+  8032f9:	ff 75 08             	push   0x8(%ebp)
+  8032fc:	e8 57 e2 ff ff       	call   801558 <fd_lookup>
+  803301:	83 c4 10             	add    $0x10,%esp
+  803304:	85 c0                	test   %eax,%eax
+  803306:	78 18                	js     803320 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803308:	83 ec 0c             	sub    $0xc,%esp
+  80330b:	ff 75 f4             	push   -0xc(%ebp)
+  80330e:	e8 d8 e1 ff ff       	call   8014eb <fd2data>
+  803313:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803315:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803318:	e8 33 fd ff ff       	call   803050 <_pipeisclosed>
+  80331d:	83 c4 10             	add    $0x10,%esp
+}
+  803320:	c9                   	leave
+  803321:	c3                   	ret
+
+00803322 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803322:	b8 00 00 00 00       	mov    $0x0,%eax
+  803327:	c3                   	ret
+
+00803328 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803328:	55                   	push   %ebp
+  803329:	89 e5                	mov    %esp,%ebp
+  80332b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80332e:	68 ad 41 80 00       	push   $0x8041ad
+  803333:	ff 75 0c             	push   0xc(%ebp)
+  803336:	e8 b0 d7 ff ff       	call   800aeb <strcpy>
+	return 0;
+}
+  80333b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803340:	c9                   	leave
+  803341:	c3                   	ret
+
+00803342 <devcons_write>:
+{
+  803342:	55                   	push   %ebp
+  803343:	89 e5                	mov    %esp,%ebp
+  803345:	57                   	push   %edi
+  803346:	56                   	push   %esi
+  803347:	53                   	push   %ebx
+  803348:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80334e:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803353:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803359:	eb 2e                	jmp    803389 <devcons_write+0x47>
+		m = n - tot;
+  80335b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80335e:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803360:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803365:	39 c3                	cmp    %eax,%ebx
+  803367:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80336a:	83 ec 04             	sub    $0x4,%esp
+  80336d:	53                   	push   %ebx
+  80336e:	89 f0                	mov    %esi,%eax
+  803370:	03 45 0c             	add    0xc(%ebp),%eax
+  803373:	50                   	push   %eax
+  803374:	57                   	push   %edi
+  803375:	e8 f7 d8 ff ff       	call   800c71 <memmove>
+		sys_cputs(buf, m);
+  80337a:	83 c4 08             	add    $0x8,%esp
+  80337d:	53                   	push   %ebx
+  80337e:	57                   	push   %edi
+  80337f:	e8 97 da ff ff       	call   800e1b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803384:	01 de                	add    %ebx,%esi
+  803386:	83 c4 10             	add    $0x10,%esp
+  803389:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80338c:	72 cd                	jb     80335b <devcons_write+0x19>
+}
+  80338e:	89 f0                	mov    %esi,%eax
+  803390:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803393:	5b                   	pop    %ebx
+  803394:	5e                   	pop    %esi
+  803395:	5f                   	pop    %edi
+  803396:	5d                   	pop    %ebp
+  803397:	c3                   	ret
+
+00803398 <devcons_read>:
+{
+  803398:	55                   	push   %ebp
+  803399:	89 e5                	mov    %esp,%ebp
+  80339b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80339e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033a7:	75 07                	jne    8033b0 <devcons_read+0x18>
+  8033a9:	eb 1f                	jmp    8033ca <devcons_read+0x32>
+		sys_yield();
+  8033ab:	e8 28 db ff ff       	call   800ed8 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8033b0:	e8 8c da ff ff       	call   800e41 <sys_cgetc>
+  8033b5:	85 c0                	test   %eax,%eax
+  8033b7:	74 f2                	je     8033ab <devcons_read+0x13>
+	if (c < 0)
+  8033b9:	78 0f                	js     8033ca <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8033bb:	83 f8 04             	cmp    $0x4,%eax
+  8033be:	74 0c                	je     8033cc <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8033c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033c3:	88 02                	mov    %al,(%edx)
+	return 1;
+  8033c5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8033ca:	c9                   	leave
+  8033cb:	c3                   	ret
+		return 0;
+  8033cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d1:	eb f7                	jmp    8033ca <devcons_read+0x32>
+
+008033d3 <cputchar>:
+{
+  8033d3:	55                   	push   %ebp
+  8033d4:	89 e5                	mov    %esp,%ebp
+  8033d6:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8033d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033dc:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8033df:	6a 01                	push   $0x1
+  8033e1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033e4:	50                   	push   %eax
+  8033e5:	e8 31 da ff ff       	call   800e1b <sys_cputs>
+}
+  8033ea:	83 c4 10             	add    $0x10,%esp
+  8033ed:	c9                   	leave
+  8033ee:	c3                   	ret
+
+008033ef <getchar>:
+{
+  8033ef:	55                   	push   %ebp
+  8033f0:	89 e5                	mov    %esp,%ebp
+  8033f2:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8033f5:	6a 01                	push   $0x1
+  8033f7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033fa:	50                   	push   %eax
+  8033fb:	6a 00                	push   $0x0
+  8033fd:	e8 bc e3 ff ff       	call   8017be <read>
+	if (r < 0)
+  803402:	83 c4 10             	add    $0x10,%esp
+  803405:	85 c0                	test   %eax,%eax
+  803407:	78 06                	js     80340f <getchar+0x20>
+	if (r < 1)
+  803409:	74 06                	je     803411 <getchar+0x22>
+	return c;
+  80340b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80340f:	c9                   	leave
+  803410:	c3                   	ret
+		return -E_EOF;
+  803411:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803416:	eb f7                	jmp    80340f <getchar+0x20>
+
+00803418 <iscons>:
+{
+  803418:	55                   	push   %ebp
+  803419:	89 e5                	mov    %esp,%ebp
+  80341b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80341e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803421:	50                   	push   %eax
+  803422:	ff 75 08             	push   0x8(%ebp)
+  803425:	e8 2e e1 ff ff       	call   801558 <fd_lookup>
+  80342a:	83 c4 10             	add    $0x10,%esp
+  80342d:	85 c0                	test   %eax,%eax
+  80342f:	78 11                	js     803442 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803431:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803434:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80343a:	39 10                	cmp    %edx,(%eax)
+  80343c:	0f 94 c0             	sete   %al
+  80343f:	0f b6 c0             	movzbl %al,%eax
+}
+  803442:	c9                   	leave
+  803443:	c3                   	ret
+
+00803444 <opencons>:
+{
+  803444:	55                   	push   %ebp
+  803445:	89 e5                	mov    %esp,%ebp
+  803447:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80344a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80344d:	50                   	push   %eax
+  80344e:	e8 af e0 ff ff       	call   801502 <fd_alloc>
+  803453:	83 c4 10             	add    $0x10,%esp
+  803456:	85 c0                	test   %eax,%eax
+  803458:	78 3a                	js     803494 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80345a:	83 ec 04             	sub    $0x4,%esp
+  80345d:	68 07 04 00 00       	push   $0x407
+  803462:	ff 75 f4             	push   -0xc(%ebp)
+  803465:	6a 00                	push   $0x0
+  803467:	e8 8b da ff ff       	call   800ef7 <sys_page_alloc>
+  80346c:	83 c4 10             	add    $0x10,%esp
+  80346f:	85 c0                	test   %eax,%eax
+  803471:	78 21                	js     803494 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803473:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803476:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80347c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80347e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803481:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803488:	83 ec 0c             	sub    $0xc,%esp
+  80348b:	50                   	push   %eax
+  80348c:	e8 4a e0 ff ff       	call   8014db <fd2num>
+  803491:	83 c4 10             	add    $0x10,%esp
+}
+  803494:	c9                   	leave
+  803495:	c3                   	ret
+
+00803496 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  803496:	55                   	push   %ebp
+  803497:	89 e5                	mov    %esp,%ebp
+  803499:	57                   	push   %edi
+  80349a:	56                   	push   %esi
+  80349b:	53                   	push   %ebx
+  80349c:	83 ec 20             	sub    $0x20,%esp
+  80349f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8034a2:	89 d7                	mov    %edx,%edi
+  8034a4:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  8034a6:	51                   	push   %ecx
+  8034a7:	68 00 f0 7f 00       	push   $0x7ff000
+  8034ac:	6a 00                	push   $0x0
+  8034ae:	e8 44 da ff ff       	call   800ef7 <sys_page_alloc>
+  8034b3:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8034b5:	83 c4 10             	add    $0x10,%esp
+  8034b8:	85 c0                	test   %eax,%eax
+  8034ba:	78 45                	js     803501 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  8034bc:	83 ec 04             	sub    $0x4,%esp
+  8034bf:	68 00 10 00 00       	push   $0x1000
+  8034c4:	57                   	push   %edi
+  8034c5:	68 00 f0 7f 00       	push   $0x7ff000
+  8034ca:	e8 a2 d7 ff ff       	call   800c71 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8034cf:	89 34 24             	mov    %esi,(%esp)
+  8034d2:	57                   	push   %edi
+  8034d3:	ff 75 e4             	push   -0x1c(%ebp)
+  8034d6:	68 00 f0 7f 00       	push   $0x7ff000
+  8034db:	6a 00                	push   $0x0
+  8034dd:	e8 60 da ff ff       	call   800f42 <sys_page_map>
+  8034e2:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8034e4:	83 c4 20             	add    $0x20,%esp
+  8034e7:	85 c0                	test   %eax,%eax
+  8034e9:	78 16                	js     803501 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8034eb:	83 ec 08             	sub    $0x8,%esp
+  8034ee:	68 00 f0 7f 00       	push   $0x7ff000
+  8034f3:	6a 00                	push   $0x0
+  8034f5:	e8 8a da ff ff       	call   800f84 <sys_page_unmap>
+  8034fa:	83 c4 10             	add    $0x10,%esp
+  8034fd:	85 c0                	test   %eax,%eax
+  8034ff:	75 0a                	jne    80350b <copy_page_to+0x75>
+exit:
+	return r;
+}
+  803501:	89 d8                	mov    %ebx,%eax
+  803503:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803506:	5b                   	pop    %ebx
+  803507:	5e                   	pop    %esi
+  803508:	5f                   	pop    %edi
+  803509:	5d                   	pop    %ebp
+  80350a:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80350b:	68 bc 41 80 00       	push   $0x8041bc
+  803510:	68 47 40 80 00       	push   $0x804047
+  803515:	6a 1b                	push   $0x1b
+  803517:	68 34 42 80 00       	push   $0x804234
+  80351c:	e8 01 cf ff ff       	call   800422 <_panic>
+
+00803521 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803521:	55                   	push   %ebp
+  803522:	89 e5                	mov    %esp,%ebp
+  803524:	53                   	push   %ebx
+  803525:	83 ec 04             	sub    $0x4,%esp
+  803528:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  80352b:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80352d:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  803531:	74 21                	je     803554 <pgfault+0x33>
+  803533:	89 d0                	mov    %edx,%eax
+  803535:	c1 e8 16             	shr    $0x16,%eax
+  803538:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80353f:	a8 01                	test   $0x1,%al
+  803541:	74 11                	je     803554 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803543:	89 d0                	mov    %edx,%eax
+  803545:	c1 e8 0c             	shr    $0xc,%eax
+  803548:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80354f:	f6 c4 08             	test   $0x8,%ah
+  803552:	75 17                	jne    80356b <pgfault+0x4a>
+		if (pgfault_next) {
+  803554:	a1 04 e0 88 00       	mov    0x88e004,%eax
+  803559:	85 c0                	test   %eax,%eax
+  80355b:	74 27                	je     803584 <pgfault+0x63>
+			pgfault_next(utf);
+  80355d:	83 ec 0c             	sub    $0xc,%esp
+  803560:	53                   	push   %ebx
+  803561:	ff d0                	call   *%eax
+			return;
+  803563:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803566:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803569:	c9                   	leave
+  80356a:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  80356b:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803571:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803576:	b8 00 00 00 00       	mov    $0x0,%eax
+  80357b:	e8 16 ff ff ff       	call   803496 <copy_page_to>
+  803580:	85 c0                	test   %eax,%eax
+  803582:	79 e2                	jns    803566 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803584:	a1 00 a0 88 00       	mov    0x88a000,%eax
+  803589:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  80358c:	ff 73 28             	push   0x28(%ebx)
+  80358f:	ff 33                	push   (%ebx)
+  803591:	50                   	push   %eax
+  803592:	68 e0 41 80 00       	push   $0x8041e0
+  803597:	e8 61 cf ff ff       	call   8004fd <cprintf>
+	sys_env_destroy(0);
+  80359c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8035a3:	e8 c0 d8 ff ff       	call   800e68 <sys_env_destroy>
+  8035a8:	83 c4 10             	add    $0x10,%esp
+  8035ab:	eb b9                	jmp    803566 <pgfault+0x45>
+
+008035ad <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8035ad:	55                   	push   %ebp
+  8035ae:	89 e5                	mov    %esp,%ebp
+  8035b0:	53                   	push   %ebx
+  8035b1:	83 ec 04             	sub    $0x4,%esp
+  8035b4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8035b7:	a1 08 e0 88 00       	mov    0x88e008,%eax
+  8035bc:	3d 21 35 80 00       	cmp    $0x803521,%eax
+  8035c1:	74 15                	je     8035d8 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8035c3:	a3 04 e0 88 00       	mov    %eax,0x88e004
+		set_pgfault_handler(pgfault);
+  8035c8:	83 ec 0c             	sub    $0xc,%esp
+  8035cb:	68 21 35 80 00       	push   $0x803521
+  8035d0:	e8 18 02 00 00       	call   8037ed <set_pgfault_handler>
+  8035d5:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8035d8:	83 ec 0c             	sub    $0xc,%esp
+  8035db:	68 05 08 00 00       	push   $0x805
+  8035e0:	53                   	push   %ebx
+  8035e1:	6a 00                	push   $0x0
+  8035e3:	53                   	push   %ebx
+  8035e4:	6a 00                	push   $0x0
+  8035e6:	e8 57 d9 ff ff       	call   800f42 <sys_page_map>
+}
+  8035eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035ee:	c9                   	leave
+  8035ef:	c3                   	ret
+
+008035f0 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8035f0:	55                   	push   %ebp
+  8035f1:	89 e5                	mov    %esp,%ebp
+  8035f3:	57                   	push   %edi
+  8035f4:	56                   	push   %esi
+  8035f5:	53                   	push   %ebx
+  8035f6:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8035f9:	68 21 35 80 00       	push   $0x803521
+  8035fe:	e8 ea 01 00 00       	call   8037ed <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803603:	b8 07 00 00 00       	mov    $0x7,%eax
+  803608:	cd 30                	int    $0x30
+  80360a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80360d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  803610:	83 c4 10             	add    $0x10,%esp
+  803613:	85 c0                	test   %eax,%eax
+  803615:	0f 88 6b 01 00 00    	js     803786 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80361b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803620:	75 37                	jne    803659 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803622:	e8 8a d8 ff ff       	call   800eb1 <sys_getenvid>
+  803627:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80362c:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803632:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803637:	a3 00 a0 88 00       	mov    %eax,0x88a000
+		return 0;
+  80363c:	e9 45 01 00 00       	jmp    803786 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803641:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803647:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80364d:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803653:	0f 87 ba 00 00 00    	ja     803713 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803659:	89 d8                	mov    %ebx,%eax
+  80365b:	c1 e8 16             	shr    $0x16,%eax
+  80365e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803665:	a8 01                	test   $0x1,%al
+  803667:	74 d8                	je     803641 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803669:	89 d8                	mov    %ebx,%eax
+  80366b:	c1 e8 0c             	shr    $0xc,%eax
+  80366e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803675:	f6 c2 01             	test   $0x1,%dl
+  803678:	74 cd                	je     803647 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  80367a:	89 da                	mov    %ebx,%edx
+  80367c:	80 e6 df             	and    $0xdf,%dh
+  80367f:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803685:	74 c0                	je     803647 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803687:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803689:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803690:	f6 c6 04             	test   $0x4,%dh
+  803693:	75 53                	jne    8036e8 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803695:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80369c:	f6 c6 08             	test   $0x8,%dh
+  80369f:	75 0c                	jne    8036ad <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8036a1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8036a8:	f6 c2 02             	test   $0x2,%dl
+  8036ab:	74 3b                	je     8036e8 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8036ad:	83 ec 0c             	sub    $0xc,%esp
+  8036b0:	68 05 08 00 00       	push   $0x805
+  8036b5:	57                   	push   %edi
+  8036b6:	ff 75 e4             	push   -0x1c(%ebp)
+  8036b9:	57                   	push   %edi
+  8036ba:	6a 00                	push   $0x0
+  8036bc:	e8 81 d8 ff ff       	call   800f42 <sys_page_map>
+  8036c1:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8036c3:	83 c4 20             	add    $0x20,%esp
+  8036c6:	85 c0                	test   %eax,%eax
+  8036c8:	0f 88 a7 00 00 00    	js     803775 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8036ce:	83 ec 0c             	sub    $0xc,%esp
+  8036d1:	68 05 08 00 00       	push   $0x805
+  8036d6:	57                   	push   %edi
+  8036d7:	6a 00                	push   $0x0
+  8036d9:	57                   	push   %edi
+  8036da:	6a 00                	push   $0x0
+  8036dc:	e8 61 d8 ff ff       	call   800f42 <sys_page_map>
+  8036e1:	89 c6                	mov    %eax,%esi
+	return r;
+  8036e3:	83 c4 20             	add    $0x20,%esp
+  8036e6:	eb 21                	jmp    803709 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8036e8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8036ef:	83 ec 0c             	sub    $0xc,%esp
+  8036f2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8036f7:	50                   	push   %eax
+  8036f8:	57                   	push   %edi
+  8036f9:	ff 75 e4             	push   -0x1c(%ebp)
+  8036fc:	57                   	push   %edi
+  8036fd:	6a 00                	push   $0x0
+  8036ff:	e8 3e d8 ff ff       	call   800f42 <sys_page_map>
+  803704:	89 c6                	mov    %eax,%esi
+  803706:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  803709:	85 f6                	test   %esi,%esi
+  80370b:	0f 89 36 ff ff ff    	jns    803647 <fork+0x57>
+  803711:	eb 62                	jmp    803775 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803713:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803718:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  80371d:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803720:	89 f8                	mov    %edi,%eax
+  803722:	e8 6f fd ff ff       	call   803496 <copy_page_to>
+  803727:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803729:	85 c0                	test   %eax,%eax
+  80372b:	78 48                	js     803775 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80372d:	83 ec 04             	sub    $0x4,%esp
+  803730:	6a 07                	push   $0x7
+  803732:	68 00 f0 bf ee       	push   $0xeebff000
+  803737:	57                   	push   %edi
+  803738:	e8 ba d7 ff ff       	call   800ef7 <sys_page_alloc>
+  80373d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80373f:	83 c4 10             	add    $0x10,%esp
+  803742:	85 c0                	test   %eax,%eax
+  803744:	78 2f                	js     803775 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803746:	a1 00 a0 88 00       	mov    0x88a000,%eax
+  80374b:	8b 40 64             	mov    0x64(%eax),%eax
+  80374e:	83 ec 08             	sub    $0x8,%esp
+  803751:	50                   	push   %eax
+  803752:	57                   	push   %edi
+  803753:	e8 0a d9 ff ff       	call   801062 <sys_env_set_pgfault_upcall>
+  803758:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80375a:	83 c4 10             	add    $0x10,%esp
+  80375d:	85 c0                	test   %eax,%eax
+  80375f:	78 14                	js     803775 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803761:	83 ec 08             	sub    $0x8,%esp
+  803764:	6a 02                	push   $0x2
+  803766:	57                   	push   %edi
+  803767:	e8 62 d8 ff ff       	call   800fce <sys_env_set_status>
+  80376c:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80376e:	83 c4 10             	add    $0x10,%esp
+  803771:	85 c0                	test   %eax,%eax
+  803773:	79 11                	jns    803786 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803775:	83 ec 0c             	sub    $0xc,%esp
+  803778:	ff 75 e0             	push   -0x20(%ebp)
+  80377b:	e8 e8 d6 ff ff       	call   800e68 <sys_env_destroy>
+	return r;
+  803780:	83 c4 10             	add    $0x10,%esp
+  803783:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803786:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803789:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80378c:	5b                   	pop    %ebx
+  80378d:	5e                   	pop    %esi
+  80378e:	5f                   	pop    %edi
+  80378f:	5d                   	pop    %ebp
+  803790:	c3                   	ret
+
+00803791 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803791:	55                   	push   %ebp
+  803792:	89 e5                	mov    %esp,%ebp
+  803794:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803797:	68 3f 42 80 00       	push   $0x80423f
+  80379c:	68 bf 00 00 00       	push   $0xbf
+  8037a1:	68 34 42 80 00       	push   $0x804234
+  8037a6:	e8 77 cc ff ff       	call   800422 <_panic>
+
+008037ab <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8037ab:	55                   	push   %ebp
+  8037ac:	89 e5                	mov    %esp,%ebp
+  8037ae:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8037b1:	89 c2                	mov    %eax,%edx
+  8037b3:	c1 ea 16             	shr    $0x16,%edx
+  8037b6:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8037bd:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8037c2:	f6 c1 01             	test   $0x1,%cl
+  8037c5:	74 22                	je     8037e9 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8037c7:	c1 e8 0c             	shr    $0xc,%eax
+  8037ca:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8037d1:	a8 01                	test   $0x1,%al
+  8037d3:	74 14                	je     8037e9 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8037d5:	c1 e8 0c             	shr    $0xc,%eax
+  8037d8:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8037db:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8037e2:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8037e6:	0f b7 d2             	movzwl %dx,%edx
+}
+  8037e9:	89 d0                	mov    %edx,%eax
+  8037eb:	5d                   	pop    %ebp
+  8037ec:	c3                   	ret
+
+008037ed <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8037ed:	55                   	push   %ebp
+  8037ee:	89 e5                	mov    %esp,%ebp
+  8037f0:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8037f3:	83 3d 08 e0 88 00 00 	cmpl   $0x0,0x88e008
+  8037fa:	74 0a                	je     803806 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8037fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037ff:	a3 08 e0 88 00       	mov    %eax,0x88e008
+}
+  803804:	c9                   	leave
+  803805:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803806:	83 ec 04             	sub    $0x4,%esp
+  803809:	6a 07                	push   $0x7
+  80380b:	68 00 f0 bf ee       	push   $0xeebff000
+  803810:	6a 00                	push   $0x0
+  803812:	e8 e0 d6 ff ff       	call   800ef7 <sys_page_alloc>
+  803817:	83 c4 10             	add    $0x10,%esp
+  80381a:	85 c0                	test   %eax,%eax
+  80381c:	75 2c                	jne    80384a <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80381e:	83 ec 08             	sub    $0x8,%esp
+  803821:	68 60 38 80 00       	push   $0x803860
+  803826:	6a 00                	push   $0x0
+  803828:	e8 35 d8 ff ff       	call   801062 <sys_env_set_pgfault_upcall>
+  80382d:	83 c4 10             	add    $0x10,%esp
+  803830:	85 c0                	test   %eax,%eax
+  803832:	74 c8                	je     8037fc <set_pgfault_handler+0xf>
+  803834:	68 a0 42 80 00       	push   $0x8042a0
+  803839:	68 47 40 80 00       	push   $0x804047
+  80383e:	6a 20                	push   $0x20
+  803840:	68 d0 42 80 00       	push   $0x8042d0
+  803845:	e8 d8 cb ff ff       	call   800422 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80384a:	68 58 42 80 00       	push   $0x804258
+  80384f:	68 47 40 80 00       	push   $0x804047
+  803854:	6a 1e                	push   $0x1e
+  803856:	68 d0 42 80 00       	push   $0x8042d0
+  80385b:	e8 c2 cb ff ff       	call   800422 <_panic>
+
+00803860 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803860:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803861:	a1 08 e0 88 00       	mov    0x88e008,%eax
+	call *%eax
+  803866:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803868:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80386b:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803870:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803875:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803879:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80387c:	83 c4 08             	add    $0x8,%esp
+	popal
+  80387f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803880:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803883:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803884:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803885:	c3                   	ret
+
+00803886 <dm>:
+  803886:	55                   	push   %ebp
+  803887:	57                   	push   %edi
+  803888:	56                   	push   %esi
+  803889:	53                   	push   %ebx
+  80388a:	83 ec 24             	sub    $0x24,%esp
+  80388d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803891:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803895:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803899:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80389d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8038a1:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8038a5:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8038a9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038b8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8038bf:	00 
+  8038c0:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8038c7:	00 
+  8038c8:	89 fb                	mov    %edi,%ebx
+  8038ca:	eb 08                	jmp    8038d4 <dm+0x4e>
+  8038cc:	83 e9 01             	sub    $0x1,%ecx
+  8038cf:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8038d2:	74 68                	je     80393c <dm+0xb6>
+  8038d4:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8038d8:	01 c0                	add    %eax,%eax
+  8038da:	89 c6                	mov    %eax,%esi
+  8038dc:	89 d7                	mov    %edx,%edi
+  8038de:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8038e2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8038e6:	0f ad d0             	shrd   %cl,%edx,%eax
+  8038e9:	d3 ea                	shr    %cl,%edx
+  8038eb:	f6 c1 20             	test   $0x20,%cl
+  8038ee:	74 04                	je     8038f4 <dm+0x6e>
+  8038f0:	89 d0                	mov    %edx,%eax
+  8038f2:	31 d2                	xor    %edx,%edx
+  8038f4:	83 e0 01             	and    $0x1,%eax
+  8038f7:	89 04 24             	mov    %eax,(%esp)
+  8038fa:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803901:	00 
+  803902:	8b 04 24             	mov    (%esp),%eax
+  803905:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803909:	09 f0                	or     %esi,%eax
+  80390b:	09 fa                	or     %edi,%edx
+  80390d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803911:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803915:	39 f0                	cmp    %esi,%eax
+  803917:	89 d5                	mov    %edx,%ebp
+  803919:	19 fd                	sbb    %edi,%ebp
+  80391b:	72 af                	jb     8038cc <dm+0x46>
+  80391d:	29 f0                	sub    %esi,%eax
+  80391f:	19 fa                	sbb    %edi,%edx
+  803921:	89 cf                	mov    %ecx,%edi
+  803923:	c1 ef 05             	shr    $0x5,%edi
+  803926:	83 e7 01             	and    $0x1,%edi
+  803929:	89 fe                	mov    %edi,%esi
+  80392b:	83 f6 01             	xor    $0x1,%esi
+  80392e:	d3 e6                	shl    %cl,%esi
+  803930:	d3 e7                	shl    %cl,%edi
+  803932:	09 74 24 18          	or     %esi,0x18(%esp)
+  803936:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80393a:	eb 90                	jmp    8038cc <dm+0x46>
+  80393c:	85 db                	test   %ebx,%ebx
+  80393e:	74 05                	je     803945 <dm+0xbf>
+  803940:	89 03                	mov    %eax,(%ebx)
+  803942:	89 53 04             	mov    %edx,0x4(%ebx)
+  803945:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803949:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80394d:	83 c4 24             	add    $0x24,%esp
+  803950:	5b                   	pop    %ebx
+  803951:	5e                   	pop    %esi
+  803952:	5f                   	pop    %edi
+  803953:	5d                   	pop    %ebp
+  803954:	c3                   	ret
+
+00803955 <__udivdi3>:
+  803955:	83 ec 08             	sub    $0x8,%esp
+  803958:	6a 00                	push   $0x0
+  80395a:	ff 74 24 1c          	push   0x1c(%esp)
+  80395e:	ff 74 24 1c          	push   0x1c(%esp)
+  803962:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803966:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80396a:	e8 17 ff ff ff       	call   803886 <dm>
+  80396f:	83 c4 14             	add    $0x14,%esp
+  803972:	c3                   	ret
+
+00803973 <__umoddi3>:
+  803973:	83 ec 18             	sub    $0x18,%esp
+  803976:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80397a:	50                   	push   %eax
+  80397b:	ff 74 24 2c          	push   0x2c(%esp)
+  80397f:	ff 74 24 2c          	push   0x2c(%esp)
+  803983:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803987:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80398b:	e8 f6 fe ff ff       	call   803886 <dm>
+  803990:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803994:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803998:	83 c4 24             	add    $0x24,%esp
+  80399b:	c3                   	ret
+
+0080399c <__divdi3>:
+  80399c:	53                   	push   %ebx
+  80399d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039a1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039a5:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8039a9:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8039ad:	85 d2                	test   %edx,%edx
+  8039af:	78 15                	js     8039c6 <__divdi3+0x2a>
+  8039b1:	85 db                	test   %ebx,%ebx
+  8039b3:	78 34                	js     8039e9 <__divdi3+0x4d>
+  8039b5:	83 ec 04             	sub    $0x4,%esp
+  8039b8:	6a 00                	push   $0x0
+  8039ba:	53                   	push   %ebx
+  8039bb:	51                   	push   %ecx
+  8039bc:	e8 c5 fe ff ff       	call   803886 <dm>
+  8039c1:	83 c4 10             	add    $0x10,%esp
+  8039c4:	eb 21                	jmp    8039e7 <__divdi3+0x4b>
+  8039c6:	f7 d8                	neg    %eax
+  8039c8:	83 d2 00             	adc    $0x0,%edx
+  8039cb:	f7 da                	neg    %edx
+  8039cd:	85 db                	test   %ebx,%ebx
+  8039cf:	78 30                	js     803a01 <__divdi3+0x65>
+  8039d1:	83 ec 04             	sub    $0x4,%esp
+  8039d4:	6a 00                	push   $0x0
+  8039d6:	53                   	push   %ebx
+  8039d7:	51                   	push   %ecx
+  8039d8:	e8 a9 fe ff ff       	call   803886 <dm>
+  8039dd:	83 c4 10             	add    $0x10,%esp
+  8039e0:	f7 d8                	neg    %eax
+  8039e2:	83 d2 00             	adc    $0x0,%edx
+  8039e5:	f7 da                	neg    %edx
+  8039e7:	5b                   	pop    %ebx
+  8039e8:	c3                   	ret
+  8039e9:	83 ec 04             	sub    $0x4,%esp
+  8039ec:	6a 00                	push   $0x0
+  8039ee:	f7 d9                	neg    %ecx
+  8039f0:	83 d3 00             	adc    $0x0,%ebx
+  8039f3:	f7 db                	neg    %ebx
+  8039f5:	53                   	push   %ebx
+  8039f6:	51                   	push   %ecx
+  8039f7:	e8 8a fe ff ff       	call   803886 <dm>
+  8039fc:	83 c4 10             	add    $0x10,%esp
+  8039ff:	eb df                	jmp    8039e0 <__divdi3+0x44>
+  803a01:	83 ec 04             	sub    $0x4,%esp
+  803a04:	6a 00                	push   $0x0
+  803a06:	f7 d9                	neg    %ecx
+  803a08:	83 d3 00             	adc    $0x0,%ebx
+  803a0b:	f7 db                	neg    %ebx
+  803a0d:	53                   	push   %ebx
+  803a0e:	51                   	push   %ecx
+  803a0f:	e8 72 fe ff ff       	call   803886 <dm>
+  803a14:	83 c4 10             	add    $0x10,%esp
+  803a17:	eb ce                	jmp    8039e7 <__divdi3+0x4b>
+
+00803a19 <__moddi3>:
+  803a19:	55                   	push   %ebp
+  803a1a:	57                   	push   %edi
+  803a1b:	56                   	push   %esi
+  803a1c:	53                   	push   %ebx
+  803a1d:	83 ec 24             	sub    $0x24,%esp
+  803a20:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803a24:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803a28:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803a2c:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803a30:	85 d2                	test   %edx,%edx
+  803a32:	78 3b                	js     803a6f <__moddi3+0x56>
+  803a34:	83 ec 04             	sub    $0x4,%esp
+  803a37:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803a3b:	56                   	push   %esi
+  803a3c:	89 ce                	mov    %ecx,%esi
+  803a3e:	f7 de                	neg    %esi
+  803a40:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803a44:	89 de                	mov    %ebx,%esi
+  803a46:	83 d6 00             	adc    $0x0,%esi
+  803a49:	f7 de                	neg    %esi
+  803a4b:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803a4f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803a53:	0f 48 f1             	cmovs  %ecx,%esi
+  803a56:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803a5b:	53                   	push   %ebx
+  803a5c:	56                   	push   %esi
+  803a5d:	e8 24 fe ff ff       	call   803886 <dm>
+  803a62:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a66:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a6a:	83 c4 10             	add    $0x10,%esp
+  803a6d:	eb 47                	jmp    803ab6 <__moddi3+0x9d>
+  803a6f:	f7 d8                	neg    %eax
+  803a71:	83 d2 00             	adc    $0x0,%edx
+  803a74:	f7 da                	neg    %edx
+  803a76:	83 ec 04             	sub    $0x4,%esp
+  803a79:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803a7d:	56                   	push   %esi
+  803a7e:	89 cf                	mov    %ecx,%edi
+  803a80:	f7 df                	neg    %edi
+  803a82:	89 de                	mov    %ebx,%esi
+  803a84:	83 d6 00             	adc    $0x0,%esi
+  803a87:	f7 de                	neg    %esi
+  803a89:	0f 49 cf             	cmovns %edi,%ecx
+  803a8c:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803a90:	0f 49 de             	cmovns %esi,%ebx
+  803a93:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803a97:	ff 74 24 0c          	push   0xc(%esp)
+  803a9b:	ff 74 24 0c          	push   0xc(%esp)
+  803a9f:	e8 e2 fd ff ff       	call   803886 <dm>
+  803aa4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803aa8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803aac:	f7 d8                	neg    %eax
+  803aae:	83 d2 00             	adc    $0x0,%edx
+  803ab1:	f7 da                	neg    %edx
+  803ab3:	83 c4 10             	add    $0x10,%esp
+  803ab6:	83 c4 24             	add    $0x24,%esp
+  803ab9:	5b                   	pop    %ebx
+  803aba:	5e                   	pop    %esi
+  803abb:	5f                   	pop    %edi
+  803abc:	5d                   	pop    %ebp
+  803abd:	c3                   	ret
@@ -0,0 +1,7827 @@
+
+obj/user/testfdsharing.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 01 00 00       	call   8001ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 14             	sub    $0x14,%esp
+	int fd, r, n, n2;
+
+	if ((fd = open("motd", O_RDONLY)) < 0)
+  80003c:	6a 00                	push   $0x0
+  80003e:	68 20 39 80 00       	push   $0x803920
+  800043:	e8 69 21 00 00       	call   8021b1 <open>
+  800048:	89 c3                	mov    %eax,%ebx
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 ff 00 00 00    	js     800154 <umain+0x121>
+		panic("open motd: %e", fd);
+	seek(fd, 0);
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	6a 00                	push   $0x0
+  80005a:	50                   	push   %eax
+  80005b:	e8 eb 17 00 00       	call   80184b <seek>
+	if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  800060:	83 c4 0c             	add    $0xc,%esp
+  800063:	68 00 02 00 00       	push   $0x200
+  800068:	68 00 62 80 00       	push   $0x806200
+  80006d:	53                   	push   %ebx
+  80006e:	e8 0f 17 00 00       	call   801782 <readn>
+  800073:	89 c6                	mov    %eax,%esi
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 8e e6 00 00 00    	jle    800166 <umain+0x133>
+		panic("readn: %e", n);
+
+	if ((r = fork()) < 0)
+  800080:	e8 d8 11 00 00       	call   80125d <fork>
+  800085:	89 c7                	mov    %eax,%edi
+  800087:	85 c0                	test   %eax,%eax
+  800089:	0f 88 e9 00 00 00    	js     800178 <umain+0x145>
+		panic("fork: %e", r);
+	if (r == 0) {
+  80008f:	75 7b                	jne    80010c <umain+0xd9>
+		seek(fd, 0);
+  800091:	83 ec 08             	sub    $0x8,%esp
+  800094:	6a 00                	push   $0x0
+  800096:	53                   	push   %ebx
+  800097:	e8 af 17 00 00       	call   80184b <seek>
+		cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  80009c:	c7 04 24 90 39 80 00 	movl   $0x803990,(%esp)
+  8000a3:	e8 60 02 00 00       	call   800308 <cprintf>
+		if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8000a8:	83 c4 0c             	add    $0xc,%esp
+  8000ab:	68 00 02 00 00       	push   $0x200
+  8000b0:	68 00 60 80 00       	push   $0x806000
+  8000b5:	53                   	push   %ebx
+  8000b6:	e8 c7 16 00 00       	call   801782 <readn>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	39 c6                	cmp    %eax,%esi
+  8000c0:	0f 85 c4 00 00 00    	jne    80018a <umain+0x157>
+			panic("read in parent got %d, read in child got %d", n, n2);
+		if (memcmp(buf, buf2, n) != 0)
+  8000c6:	83 ec 04             	sub    $0x4,%esp
+  8000c9:	56                   	push   %esi
+  8000ca:	68 00 60 80 00       	push   $0x806000
+  8000cf:	68 00 62 80 00       	push   $0x806200
+  8000d4:	e8 1b 0a 00 00       	call   800af4 <memcmp>
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	85 c0                	test   %eax,%eax
+  8000de:	0f 85 bc 00 00 00    	jne    8001a0 <umain+0x16d>
+			panic("read in parent got different bytes from read in child");
+		cprintf("read in child succeeded\n");
+  8000e4:	83 ec 0c             	sub    $0xc,%esp
+  8000e7:	68 5b 39 80 00       	push   $0x80395b
+  8000ec:	e8 17 02 00 00       	call   800308 <cprintf>
+		seek(fd, 0);
+  8000f1:	83 c4 08             	add    $0x8,%esp
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	53                   	push   %ebx
+  8000f7:	e8 4f 17 00 00       	call   80184b <seek>
+		close(fd);
+  8000fc:	89 1c 24             	mov    %ebx,(%esp)
+  8000ff:	e8 bb 14 00 00       	call   8015bf <close>
+		exit();
+  800104:	e8 0a 01 00 00       	call   800213 <exit>
+  800109:	83 c4 10             	add    $0x10,%esp
+	}
+	wait(r);
+  80010c:	83 ec 0c             	sub    $0xc,%esp
+  80010f:	57                   	push   %edi
+  800110:	e8 4a 31 00 00       	call   80325f <wait>
+	if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800115:	83 c4 0c             	add    $0xc,%esp
+  800118:	68 00 02 00 00       	push   $0x200
+  80011d:	68 00 60 80 00       	push   $0x806000
+  800122:	53                   	push   %ebx
+  800123:	e8 5a 16 00 00       	call   801782 <readn>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	39 c6                	cmp    %eax,%esi
+  80012d:	0f 85 81 00 00 00    	jne    8001b4 <umain+0x181>
+		panic("read in parent got %d, then got %d", n, n2);
+	cprintf("read in parent succeeded\n");
+  800133:	83 ec 0c             	sub    $0xc,%esp
+  800136:	68 74 39 80 00       	push   $0x803974
+  80013b:	e8 c8 01 00 00       	call   800308 <cprintf>
+	close(fd);
+  800140:	89 1c 24             	mov    %ebx,(%esp)
+  800143:	e8 77 14 00 00       	call   8015bf <close>
+#include <inc/types.h>
+
+static inline void
+breakpoint(void)
+{
+	asm volatile("int3");
+  800148:	cc                   	int3
+
+	breakpoint();
+}
+  800149:	83 c4 10             	add    $0x10,%esp
+  80014c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80014f:	5b                   	pop    %ebx
+  800150:	5e                   	pop    %esi
+  800151:	5f                   	pop    %edi
+  800152:	5d                   	pop    %ebp
+  800153:	c3                   	ret
+		panic("open motd: %e", fd);
+  800154:	50                   	push   %eax
+  800155:	68 25 39 80 00       	push   $0x803925
+  80015a:	6a 0c                	push   $0xc
+  80015c:	68 33 39 80 00       	push   $0x803933
+  800161:	e8 c7 00 00 00       	call   80022d <_panic>
+		panic("readn: %e", n);
+  800166:	50                   	push   %eax
+  800167:	68 48 39 80 00       	push   $0x803948
+  80016c:	6a 0f                	push   $0xf
+  80016e:	68 33 39 80 00       	push   $0x803933
+  800173:	e8 b5 00 00 00       	call   80022d <_panic>
+		panic("fork: %e", r);
+  800178:	50                   	push   %eax
+  800179:	68 52 39 80 00       	push   $0x803952
+  80017e:	6a 12                	push   $0x12
+  800180:	68 33 39 80 00       	push   $0x803933
+  800185:	e8 a3 00 00 00       	call   80022d <_panic>
+			panic("read in parent got %d, read in child got %d", n, n2);
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	50                   	push   %eax
+  80018e:	56                   	push   %esi
+  80018f:	68 d4 39 80 00       	push   $0x8039d4
+  800194:	6a 17                	push   $0x17
+  800196:	68 33 39 80 00       	push   $0x803933
+  80019b:	e8 8d 00 00 00       	call   80022d <_panic>
+			panic("read in parent got different bytes from read in child");
+  8001a0:	83 ec 04             	sub    $0x4,%esp
+  8001a3:	68 00 3a 80 00       	push   $0x803a00
+  8001a8:	6a 19                	push   $0x19
+  8001aa:	68 33 39 80 00       	push   $0x803933
+  8001af:	e8 79 00 00 00       	call   80022d <_panic>
+		panic("read in parent got %d, then got %d", n, n2);
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	50                   	push   %eax
+  8001b8:	56                   	push   %esi
+  8001b9:	68 38 3a 80 00       	push   $0x803a38
+  8001be:	6a 21                	push   $0x21
+  8001c0:	68 33 39 80 00       	push   $0x803933
+  8001c5:	e8 63 00 00 00       	call   80022d <_panic>
+
+008001ca <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ca:	55                   	push   %ebp
+  8001cb:	89 e5                	mov    %esp,%ebp
+  8001cd:	56                   	push   %esi
+  8001ce:	53                   	push   %ebx
+  8001cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001d5:	e8 e2 0a 00 00       	call   800cbc <sys_getenvid>
+  8001da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001df:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8001e5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001ea:	a3 00 64 80 00       	mov    %eax,0x806400
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001ef:	85 db                	test   %ebx,%ebx
+  8001f1:	7e 07                	jle    8001fa <libmain+0x30>
+		binaryname = argv[0];
+  8001f3:	8b 06                	mov    (%esi),%eax
+  8001f5:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8001fa:	83 ec 08             	sub    $0x8,%esp
+  8001fd:	56                   	push   %esi
+  8001fe:	53                   	push   %ebx
+  8001ff:	e8 2f fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800204:	e8 0a 00 00 00       	call   800213 <exit>
+}
+  800209:	83 c4 10             	add    $0x10,%esp
+  80020c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80020f:	5b                   	pop    %ebx
+  800210:	5e                   	pop    %esi
+  800211:	5d                   	pop    %ebp
+  800212:	c3                   	ret
+
+00800213 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800213:	55                   	push   %ebp
+  800214:	89 e5                	mov    %esp,%ebp
+  800216:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800219:	e8 ce 13 00 00       	call   8015ec <close_all>
+	sys_env_destroy(0);
+  80021e:	83 ec 0c             	sub    $0xc,%esp
+  800221:	6a 00                	push   $0x0
+  800223:	e8 4b 0a 00 00       	call   800c73 <sys_env_destroy>
+}
+  800228:	83 c4 10             	add    $0x10,%esp
+  80022b:	c9                   	leave
+  80022c:	c3                   	ret
+
+0080022d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80022d:	55                   	push   %ebp
+  80022e:	89 e5                	mov    %esp,%ebp
+  800230:	56                   	push   %esi
+  800231:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800232:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800235:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80023b:	e8 7c 0a 00 00       	call   800cbc <sys_getenvid>
+  800240:	83 ec 0c             	sub    $0xc,%esp
+  800243:	ff 75 0c             	push   0xc(%ebp)
+  800246:	ff 75 08             	push   0x8(%ebp)
+  800249:	56                   	push   %esi
+  80024a:	50                   	push   %eax
+  80024b:	68 68 3a 80 00       	push   $0x803a68
+  800250:	e8 b3 00 00 00       	call   800308 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800255:	83 c4 18             	add    $0x18,%esp
+  800258:	53                   	push   %ebx
+  800259:	ff 75 10             	push   0x10(%ebp)
+  80025c:	e8 56 00 00 00       	call   8002b7 <vcprintf>
+	cprintf("\n");
+  800261:	c7 04 24 72 39 80 00 	movl   $0x803972,(%esp)
+  800268:	e8 9b 00 00 00       	call   800308 <cprintf>
+  80026d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800270:	cc                   	int3
+	while (1)
+  800271:	eb fd                	jmp    800270 <_panic+0x43>
+
+00800273 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800273:	55                   	push   %ebp
+  800274:	89 e5                	mov    %esp,%ebp
+  800276:	53                   	push   %ebx
+  800277:	83 ec 04             	sub    $0x4,%esp
+  80027a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80027d:	8b 13                	mov    (%ebx),%edx
+  80027f:	8d 42 01             	lea    0x1(%edx),%eax
+  800282:	89 03                	mov    %eax,(%ebx)
+  800284:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800287:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80028b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800290:	74 09                	je     80029b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800292:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800296:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800299:	c9                   	leave
+  80029a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80029b:	83 ec 08             	sub    $0x8,%esp
+  80029e:	68 ff 00 00 00       	push   $0xff
+  8002a3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002a6:	50                   	push   %eax
+  8002a7:	e8 7a 09 00 00       	call   800c26 <sys_cputs>
+		b->idx = 0;
+  8002ac:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002b2:	83 c4 10             	add    $0x10,%esp
+  8002b5:	eb db                	jmp    800292 <putch+0x1f>
+
+008002b7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002b7:	55                   	push   %ebp
+  8002b8:	89 e5                	mov    %esp,%ebp
+  8002ba:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002c0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002c7:	00 00 00 
+	b.cnt = 0;
+  8002ca:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002d1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002d4:	ff 75 0c             	push   0xc(%ebp)
+  8002d7:	ff 75 08             	push   0x8(%ebp)
+  8002da:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002e0:	50                   	push   %eax
+  8002e1:	68 73 02 80 00       	push   $0x800273
+  8002e6:	e8 14 01 00 00       	call   8003ff <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002eb:	83 c4 08             	add    $0x8,%esp
+  8002ee:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002f4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002fa:	50                   	push   %eax
+  8002fb:	e8 26 09 00 00       	call   800c26 <sys_cputs>
+
+	return b.cnt;
+}
+  800300:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800306:	c9                   	leave
+  800307:	c3                   	ret
+
+00800308 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800308:	55                   	push   %ebp
+  800309:	89 e5                	mov    %esp,%ebp
+  80030b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80030e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800311:	50                   	push   %eax
+  800312:	ff 75 08             	push   0x8(%ebp)
+  800315:	e8 9d ff ff ff       	call   8002b7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80031a:	c9                   	leave
+  80031b:	c3                   	ret
+
+0080031c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80031c:	55                   	push   %ebp
+  80031d:	89 e5                	mov    %esp,%ebp
+  80031f:	57                   	push   %edi
+  800320:	56                   	push   %esi
+  800321:	53                   	push   %ebx
+  800322:	83 ec 1c             	sub    $0x1c,%esp
+  800325:	89 c7                	mov    %eax,%edi
+  800327:	89 d6                	mov    %edx,%esi
+  800329:	8b 45 08             	mov    0x8(%ebp),%eax
+  80032c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80032f:	89 d1                	mov    %edx,%ecx
+  800331:	89 c2                	mov    %eax,%edx
+  800333:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800336:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800339:	8b 45 10             	mov    0x10(%ebp),%eax
+  80033c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80033f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800342:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800349:	39 c2                	cmp    %eax,%edx
+  80034b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80034e:	72 3e                	jb     80038e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800350:	83 ec 0c             	sub    $0xc,%esp
+  800353:	ff 75 18             	push   0x18(%ebp)
+  800356:	83 eb 01             	sub    $0x1,%ebx
+  800359:	53                   	push   %ebx
+  80035a:	50                   	push   %eax
+  80035b:	83 ec 08             	sub    $0x8,%esp
+  80035e:	ff 75 e4             	push   -0x1c(%ebp)
+  800361:	ff 75 e0             	push   -0x20(%ebp)
+  800364:	ff 75 dc             	push   -0x24(%ebp)
+  800367:	ff 75 d8             	push   -0x28(%ebp)
+  80036a:	e8 43 34 00 00       	call   8037b2 <__udivdi3>
+  80036f:	83 c4 18             	add    $0x18,%esp
+  800372:	52                   	push   %edx
+  800373:	50                   	push   %eax
+  800374:	89 f2                	mov    %esi,%edx
+  800376:	89 f8                	mov    %edi,%eax
+  800378:	e8 9f ff ff ff       	call   80031c <printnum>
+  80037d:	83 c4 20             	add    $0x20,%esp
+  800380:	eb 13                	jmp    800395 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800382:	83 ec 08             	sub    $0x8,%esp
+  800385:	56                   	push   %esi
+  800386:	ff 75 18             	push   0x18(%ebp)
+  800389:	ff d7                	call   *%edi
+  80038b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80038e:	83 eb 01             	sub    $0x1,%ebx
+  800391:	85 db                	test   %ebx,%ebx
+  800393:	7f ed                	jg     800382 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800395:	83 ec 08             	sub    $0x8,%esp
+  800398:	56                   	push   %esi
+  800399:	83 ec 04             	sub    $0x4,%esp
+  80039c:	ff 75 e4             	push   -0x1c(%ebp)
+  80039f:	ff 75 e0             	push   -0x20(%ebp)
+  8003a2:	ff 75 dc             	push   -0x24(%ebp)
+  8003a5:	ff 75 d8             	push   -0x28(%ebp)
+  8003a8:	e8 23 34 00 00       	call   8037d0 <__umoddi3>
+  8003ad:	83 c4 14             	add    $0x14,%esp
+  8003b0:	0f be 80 8b 3a 80 00 	movsbl 0x803a8b(%eax),%eax
+  8003b7:	50                   	push   %eax
+  8003b8:	ff d7                	call   *%edi
+}
+  8003ba:	83 c4 10             	add    $0x10,%esp
+  8003bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c0:	5b                   	pop    %ebx
+  8003c1:	5e                   	pop    %esi
+  8003c2:	5f                   	pop    %edi
+  8003c3:	5d                   	pop    %ebp
+  8003c4:	c3                   	ret
+
+008003c5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003c5:	55                   	push   %ebp
+  8003c6:	89 e5                	mov    %esp,%ebp
+  8003c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003cb:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003cf:	8b 10                	mov    (%eax),%edx
+  8003d1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003d4:	73 0a                	jae    8003e0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003d6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003d9:	89 08                	mov    %ecx,(%eax)
+  8003db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003de:	88 02                	mov    %al,(%edx)
+}
+  8003e0:	5d                   	pop    %ebp
+  8003e1:	c3                   	ret
+
+008003e2 <printfmt>:
+{
+  8003e2:	55                   	push   %ebp
+  8003e3:	89 e5                	mov    %esp,%ebp
+  8003e5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003e8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003eb:	50                   	push   %eax
+  8003ec:	ff 75 10             	push   0x10(%ebp)
+  8003ef:	ff 75 0c             	push   0xc(%ebp)
+  8003f2:	ff 75 08             	push   0x8(%ebp)
+  8003f5:	e8 05 00 00 00       	call   8003ff <vprintfmt>
+}
+  8003fa:	83 c4 10             	add    $0x10,%esp
+  8003fd:	c9                   	leave
+  8003fe:	c3                   	ret
+
+008003ff <vprintfmt>:
+{
+  8003ff:	55                   	push   %ebp
+  800400:	89 e5                	mov    %esp,%ebp
+  800402:	57                   	push   %edi
+  800403:	56                   	push   %esi
+  800404:	53                   	push   %ebx
+  800405:	83 ec 2c             	sub    $0x2c,%esp
+  800408:	8b 75 08             	mov    0x8(%ebp),%esi
+  80040b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80040e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800411:	eb 0a                	jmp    80041d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800413:	83 ec 08             	sub    $0x8,%esp
+  800416:	53                   	push   %ebx
+  800417:	50                   	push   %eax
+  800418:	ff d6                	call   *%esi
+  80041a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80041d:	83 c7 01             	add    $0x1,%edi
+  800420:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800424:	83 f8 25             	cmp    $0x25,%eax
+  800427:	74 0c                	je     800435 <vprintfmt+0x36>
+			if (ch == '\0')
+  800429:	85 c0                	test   %eax,%eax
+  80042b:	75 e6                	jne    800413 <vprintfmt+0x14>
+}
+  80042d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800430:	5b                   	pop    %ebx
+  800431:	5e                   	pop    %esi
+  800432:	5f                   	pop    %edi
+  800433:	5d                   	pop    %ebp
+  800434:	c3                   	ret
+		padc = ' ';
+  800435:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800439:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800440:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800447:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80044e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800453:	8d 47 01             	lea    0x1(%edi),%eax
+  800456:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800459:	0f b6 17             	movzbl (%edi),%edx
+  80045c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80045f:	3c 55                	cmp    $0x55,%al
+  800461:	0f 87 cf 03 00 00    	ja     800836 <vprintfmt+0x437>
+  800467:	0f b6 c0             	movzbl %al,%eax
+  80046a:	ff 24 85 e0 3b 80 00 	jmp    *0x803be0(,%eax,4)
+  800471:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800474:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800478:	eb d9                	jmp    800453 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80047d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800481:	eb d0                	jmp    800453 <vprintfmt+0x54>
+  800483:	0f b6 d2             	movzbl %dl,%edx
+  800486:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800491:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800494:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800498:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80049b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80049e:	83 f9 09             	cmp    $0x9,%ecx
+  8004a1:	77 55                	ja     8004f8 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004a3:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004a6:	eb e9                	jmp    800491 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ab:	8b 00                	mov    (%eax),%eax
+  8004ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8004b6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004bc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c0:	79 91                	jns    800453 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004c2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004cf:	eb 82                	jmp    800453 <vprintfmt+0x54>
+			if (width < 0)
+  8004d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d4:	85 d2                	test   %edx,%edx
+  8004d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004db:	0f 49 c2             	cmovns %edx,%eax
+  8004de:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004e4:	e9 6a ff ff ff       	jmp    800453 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004ec:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004f3:	e9 5b ff ff ff       	jmp    800453 <vprintfmt+0x54>
+  8004f8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004fe:	eb bc                	jmp    8004bc <vprintfmt+0xbd>
+			lflag++;
+  800500:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800503:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800506:	e9 48 ff ff ff       	jmp    800453 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80050b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050e:	8d 78 04             	lea    0x4(%eax),%edi
+  800511:	83 ec 08             	sub    $0x8,%esp
+  800514:	53                   	push   %ebx
+  800515:	ff 30                	push   (%eax)
+  800517:	ff d6                	call   *%esi
+			break;
+  800519:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80051c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80051f:	e9 b1 02 00 00       	jmp    8007d5 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80052a:	8b 10                	mov    (%eax),%edx
+  80052c:	89 d0                	mov    %edx,%eax
+  80052e:	f7 d8                	neg    %eax
+  800530:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800533:	83 f8 11             	cmp    $0x11,%eax
+  800536:	7f 23                	jg     80055b <vprintfmt+0x15c>
+  800538:	8b 14 85 40 3d 80 00 	mov    0x803d40(,%eax,4),%edx
+  80053f:	85 d2                	test   %edx,%edx
+  800541:	74 18                	je     80055b <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800543:	52                   	push   %edx
+  800544:	68 5e 3e 80 00       	push   $0x803e5e
+  800549:	53                   	push   %ebx
+  80054a:	56                   	push   %esi
+  80054b:	e8 92 fe ff ff       	call   8003e2 <printfmt>
+  800550:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800553:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800556:	e9 7a 02 00 00       	jmp    8007d5 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  80055b:	50                   	push   %eax
+  80055c:	68 a3 3a 80 00       	push   $0x803aa3
+  800561:	53                   	push   %ebx
+  800562:	56                   	push   %esi
+  800563:	e8 7a fe ff ff       	call   8003e2 <printfmt>
+  800568:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80056b:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80056e:	e9 62 02 00 00       	jmp    8007d5 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800573:	8b 45 14             	mov    0x14(%ebp),%eax
+  800576:	83 c0 04             	add    $0x4,%eax
+  800579:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80057c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800581:	85 c9                	test   %ecx,%ecx
+  800583:	b8 9c 3a 80 00       	mov    $0x803a9c,%eax
+  800588:	0f 45 c1             	cmovne %ecx,%eax
+  80058b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80058e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800592:	7e 06                	jle    80059a <vprintfmt+0x19b>
+  800594:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800598:	75 0b                	jne    8005a5 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80059d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005a0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005a3:	eb 5c                	jmp    800601 <vprintfmt+0x202>
+  8005a5:	83 ec 08             	sub    $0x8,%esp
+  8005a8:	ff 75 d0             	push   -0x30(%ebp)
+  8005ab:	ff 75 cc             	push   -0x34(%ebp)
+  8005ae:	e8 20 03 00 00       	call   8008d3 <strnlen>
+  8005b3:	89 c2                	mov    %eax,%edx
+  8005b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b8:	29 d0                	sub    %edx,%eax
+  8005ba:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005bd:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005c7:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c9:	eb 0e                	jmp    8005d9 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005cb:	83 ec 08             	sub    $0x8,%esp
+  8005ce:	53                   	push   %ebx
+  8005cf:	57                   	push   %edi
+  8005d0:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d3:	83 ee 01             	sub    $0x1,%esi
+  8005d6:	83 c4 10             	add    $0x10,%esp
+  8005d9:	85 f6                	test   %esi,%esi
+  8005db:	7f ee                	jg     8005cb <vprintfmt+0x1cc>
+  8005dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e3:	85 c0                	test   %eax,%eax
+  8005e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ea:	0f 49 d0             	cmovns %eax,%edx
+  8005ed:	29 d0                	sub    %edx,%eax
+  8005ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f2:	eb a6                	jmp    80059a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005f4:	83 ec 08             	sub    $0x8,%esp
+  8005f7:	53                   	push   %ebx
+  8005f8:	52                   	push   %edx
+  8005f9:	ff 55 08             	call   *0x8(%ebp)
+  8005fc:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ff:	89 f1                	mov    %esi,%ecx
+  800601:	8d 71 01             	lea    0x1(%ecx),%esi
+  800604:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800608:	0f be d0             	movsbl %al,%edx
+  80060b:	85 d2                	test   %edx,%edx
+  80060d:	74 28                	je     800637 <vprintfmt+0x238>
+  80060f:	85 ff                	test   %edi,%edi
+  800611:	78 05                	js     800618 <vprintfmt+0x219>
+  800613:	83 ef 01             	sub    $0x1,%edi
+  800616:	78 30                	js     800648 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800618:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80061c:	74 d6                	je     8005f4 <vprintfmt+0x1f5>
+  80061e:	0f be c0             	movsbl %al,%eax
+  800621:	83 e8 20             	sub    $0x20,%eax
+  800624:	83 f8 5e             	cmp    $0x5e,%eax
+  800627:	76 cb                	jbe    8005f4 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800629:	83 ec 08             	sub    $0x8,%esp
+  80062c:	53                   	push   %ebx
+  80062d:	6a 3f                	push   $0x3f
+  80062f:	ff 55 08             	call   *0x8(%ebp)
+  800632:	83 c4 10             	add    $0x10,%esp
+  800635:	eb c8                	jmp    8005ff <vprintfmt+0x200>
+  800637:	8b 75 08             	mov    0x8(%ebp),%esi
+  80063a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80063d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800640:	01 d0                	add    %edx,%eax
+  800642:	29 c8                	sub    %ecx,%eax
+  800644:	89 c7                	mov    %eax,%edi
+  800646:	eb 13                	jmp    80065b <vprintfmt+0x25c>
+  800648:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064b:	eb ed                	jmp    80063a <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80064d:	83 ec 08             	sub    $0x8,%esp
+  800650:	53                   	push   %ebx
+  800651:	6a 20                	push   $0x20
+  800653:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800655:	83 ef 01             	sub    $0x1,%edi
+  800658:	83 c4 10             	add    $0x10,%esp
+  80065b:	85 ff                	test   %edi,%edi
+  80065d:	7f ee                	jg     80064d <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80065f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800662:	89 45 14             	mov    %eax,0x14(%ebp)
+  800665:	e9 6b 01 00 00       	jmp    8007d5 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  80066a:	83 f9 01             	cmp    $0x1,%ecx
+  80066d:	7f 1f                	jg     80068e <vprintfmt+0x28f>
+	else if (lflag)
+  80066f:	85 c9                	test   %ecx,%ecx
+  800671:	74 67                	je     8006da <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	8b 00                	mov    (%eax),%eax
+  800678:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067b:	89 c1                	mov    %eax,%ecx
+  80067d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800680:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800683:	8b 45 14             	mov    0x14(%ebp),%eax
+  800686:	8d 40 04             	lea    0x4(%eax),%eax
+  800689:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068c:	eb 17                	jmp    8006a5 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	8b 50 04             	mov    0x4(%eax),%edx
+  800694:	8b 00                	mov    (%eax),%eax
+  800696:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800699:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006a5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006a8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006ab:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006b0:	85 c9                	test   %ecx,%ecx
+  8006b2:	0f 89 03 01 00 00    	jns    8007bb <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8006b8:	83 ec 08             	sub    $0x8,%esp
+  8006bb:	53                   	push   %ebx
+  8006bc:	6a 2d                	push   $0x2d
+  8006be:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006c0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006c3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006c6:	f7 da                	neg    %edx
+  8006c8:	83 d1 00             	adc    $0x0,%ecx
+  8006cb:	f7 d9                	neg    %ecx
+  8006cd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006d0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006d5:	e9 e1 00 00 00       	jmp    8007bb <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8006da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dd:	8b 00                	mov    (%eax),%eax
+  8006df:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e2:	89 c1                	mov    %eax,%ecx
+  8006e4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f3:	eb b0                	jmp    8006a5 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006f5:	83 f9 01             	cmp    $0x1,%ecx
+  8006f8:	7f 1e                	jg     800718 <vprintfmt+0x319>
+	else if (lflag)
+  8006fa:	85 c9                	test   %ecx,%ecx
+  8006fc:	74 32                	je     800730 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 10                	mov    (%eax),%edx
+  800703:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800708:	8d 40 04             	lea    0x4(%eax),%eax
+  80070b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80070e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800713:	e9 a3 00 00 00       	jmp    8007bb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800718:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071b:	8b 10                	mov    (%eax),%edx
+  80071d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800720:	8d 40 08             	lea    0x8(%eax),%eax
+  800723:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800726:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  80072b:	e9 8b 00 00 00       	jmp    8007bb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800730:	8b 45 14             	mov    0x14(%ebp),%eax
+  800733:	8b 10                	mov    (%eax),%edx
+  800735:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80073a:	8d 40 04             	lea    0x4(%eax),%eax
+  80073d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800740:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800745:	eb 74                	jmp    8007bb <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800747:	83 f9 01             	cmp    $0x1,%ecx
+  80074a:	7f 1b                	jg     800767 <vprintfmt+0x368>
+	else if (lflag)
+  80074c:	85 c9                	test   %ecx,%ecx
+  80074e:	74 2c                	je     80077c <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800750:	8b 45 14             	mov    0x14(%ebp),%eax
+  800753:	8b 10                	mov    (%eax),%edx
+  800755:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075a:	8d 40 04             	lea    0x4(%eax),%eax
+  80075d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800760:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800765:	eb 54                	jmp    8007bb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800767:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076a:	8b 10                	mov    (%eax),%edx
+  80076c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80076f:	8d 40 08             	lea    0x8(%eax),%eax
+  800772:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800775:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80077a:	eb 3f                	jmp    8007bb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80077c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077f:	8b 10                	mov    (%eax),%edx
+  800781:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800786:	8d 40 04             	lea    0x4(%eax),%eax
+  800789:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80078c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800791:	eb 28                	jmp    8007bb <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800793:	83 ec 08             	sub    $0x8,%esp
+  800796:	53                   	push   %ebx
+  800797:	6a 30                	push   $0x30
+  800799:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80079b:	83 c4 08             	add    $0x8,%esp
+  80079e:	53                   	push   %ebx
+  80079f:	6a 78                	push   $0x78
+  8007a1:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a6:	8b 10                	mov    (%eax),%edx
+  8007a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007ad:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b6:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007bb:	83 ec 0c             	sub    $0xc,%esp
+  8007be:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007c2:	50                   	push   %eax
+  8007c3:	ff 75 e0             	push   -0x20(%ebp)
+  8007c6:	57                   	push   %edi
+  8007c7:	51                   	push   %ecx
+  8007c8:	52                   	push   %edx
+  8007c9:	89 da                	mov    %ebx,%edx
+  8007cb:	89 f0                	mov    %esi,%eax
+  8007cd:	e8 4a fb ff ff       	call   80031c <printnum>
+			break;
+  8007d2:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007d8:	e9 40 fc ff ff       	jmp    80041d <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007dd:	83 f9 01             	cmp    $0x1,%ecx
+  8007e0:	7f 1b                	jg     8007fd <vprintfmt+0x3fe>
+	else if (lflag)
+  8007e2:	85 c9                	test   %ecx,%ecx
+  8007e4:	74 2c                	je     800812 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8007e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e9:	8b 10                	mov    (%eax),%edx
+  8007eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007fb:	eb be                	jmp    8007bb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800800:	8b 10                	mov    (%eax),%edx
+  800802:	8b 48 04             	mov    0x4(%eax),%ecx
+  800805:	8d 40 08             	lea    0x8(%eax),%eax
+  800808:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80080b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800810:	eb a9                	jmp    8007bb <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800812:	8b 45 14             	mov    0x14(%ebp),%eax
+  800815:	8b 10                	mov    (%eax),%edx
+  800817:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80081c:	8d 40 04             	lea    0x4(%eax),%eax
+  80081f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800822:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800827:	eb 92                	jmp    8007bb <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800829:	83 ec 08             	sub    $0x8,%esp
+  80082c:	53                   	push   %ebx
+  80082d:	6a 25                	push   $0x25
+  80082f:	ff d6                	call   *%esi
+			break;
+  800831:	83 c4 10             	add    $0x10,%esp
+  800834:	eb 9f                	jmp    8007d5 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800836:	83 ec 08             	sub    $0x8,%esp
+  800839:	53                   	push   %ebx
+  80083a:	6a 25                	push   $0x25
+  80083c:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80083e:	83 c4 10             	add    $0x10,%esp
+  800841:	89 f8                	mov    %edi,%eax
+  800843:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800847:	74 05                	je     80084e <vprintfmt+0x44f>
+  800849:	83 e8 01             	sub    $0x1,%eax
+  80084c:	eb f5                	jmp    800843 <vprintfmt+0x444>
+  80084e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800851:	eb 82                	jmp    8007d5 <vprintfmt+0x3d6>
+
+00800853 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800853:	55                   	push   %ebp
+  800854:	89 e5                	mov    %esp,%ebp
+  800856:	83 ec 18             	sub    $0x18,%esp
+  800859:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80085f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800862:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800866:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800869:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800870:	85 c0                	test   %eax,%eax
+  800872:	74 26                	je     80089a <vsnprintf+0x47>
+  800874:	85 d2                	test   %edx,%edx
+  800876:	7e 22                	jle    80089a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800878:	ff 75 14             	push   0x14(%ebp)
+  80087b:	ff 75 10             	push   0x10(%ebp)
+  80087e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800881:	50                   	push   %eax
+  800882:	68 c5 03 80 00       	push   $0x8003c5
+  800887:	e8 73 fb ff ff       	call   8003ff <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80088c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80088f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800892:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800895:	83 c4 10             	add    $0x10,%esp
+}
+  800898:	c9                   	leave
+  800899:	c3                   	ret
+		return -E_INVAL;
+  80089a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80089f:	eb f7                	jmp    800898 <vsnprintf+0x45>
+
+008008a1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008a1:	55                   	push   %ebp
+  8008a2:	89 e5                	mov    %esp,%ebp
+  8008a4:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008a7:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008aa:	50                   	push   %eax
+  8008ab:	ff 75 10             	push   0x10(%ebp)
+  8008ae:	ff 75 0c             	push   0xc(%ebp)
+  8008b1:	ff 75 08             	push   0x8(%ebp)
+  8008b4:	e8 9a ff ff ff       	call   800853 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008b9:	c9                   	leave
+  8008ba:	c3                   	ret
+
+008008bb <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008bb:	55                   	push   %ebp
+  8008bc:	89 e5                	mov    %esp,%ebp
+  8008be:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c6:	eb 03                	jmp    8008cb <strlen+0x10>
+		n++;
+  8008c8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008cb:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008cf:	75 f7                	jne    8008c8 <strlen+0xd>
+	return n;
+}
+  8008d1:	5d                   	pop    %ebp
+  8008d2:	c3                   	ret
+
+008008d3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008d3:	55                   	push   %ebp
+  8008d4:	89 e5                	mov    %esp,%ebp
+  8008d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e1:	eb 03                	jmp    8008e6 <strnlen+0x13>
+		n++;
+  8008e3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e6:	39 d0                	cmp    %edx,%eax
+  8008e8:	74 08                	je     8008f2 <strnlen+0x1f>
+  8008ea:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008ee:	75 f3                	jne    8008e3 <strnlen+0x10>
+  8008f0:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008f2:	89 d0                	mov    %edx,%eax
+  8008f4:	5d                   	pop    %ebp
+  8008f5:	c3                   	ret
+
+008008f6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008f6:	55                   	push   %ebp
+  8008f7:	89 e5                	mov    %esp,%ebp
+  8008f9:	53                   	push   %ebx
+  8008fa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800900:	b8 00 00 00 00       	mov    $0x0,%eax
+  800905:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800909:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80090c:	83 c0 01             	add    $0x1,%eax
+  80090f:	84 d2                	test   %dl,%dl
+  800911:	75 f2                	jne    800905 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800913:	89 c8                	mov    %ecx,%eax
+  800915:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800918:	c9                   	leave
+  800919:	c3                   	ret
+
+0080091a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80091a:	55                   	push   %ebp
+  80091b:	89 e5                	mov    %esp,%ebp
+  80091d:	53                   	push   %ebx
+  80091e:	83 ec 10             	sub    $0x10,%esp
+  800921:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800924:	53                   	push   %ebx
+  800925:	e8 91 ff ff ff       	call   8008bb <strlen>
+  80092a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80092d:	ff 75 0c             	push   0xc(%ebp)
+  800930:	01 d8                	add    %ebx,%eax
+  800932:	50                   	push   %eax
+  800933:	e8 be ff ff ff       	call   8008f6 <strcpy>
+	return dst;
+}
+  800938:	89 d8                	mov    %ebx,%eax
+  80093a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80093d:	c9                   	leave
+  80093e:	c3                   	ret
+
+0080093f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	56                   	push   %esi
+  800943:	53                   	push   %ebx
+  800944:	8b 75 08             	mov    0x8(%ebp),%esi
+  800947:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80094a:	89 f3                	mov    %esi,%ebx
+  80094c:	03 5d 10             	add    0x10(%ebp),%ebx
+  80094f:	89 f0                	mov    %esi,%eax
+  800951:	eb 0f                	jmp    800962 <strncpy+0x23>
+		*dst++ = *src;
+  800953:	83 c0 01             	add    $0x1,%eax
+  800956:	0f b6 0a             	movzbl (%edx),%ecx
+  800959:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80095c:	80 f9 01             	cmp    $0x1,%cl
+  80095f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800962:	39 d8                	cmp    %ebx,%eax
+  800964:	75 ed                	jne    800953 <strncpy+0x14>
+	}
+	return ret;
+}
+  800966:	89 f0                	mov    %esi,%eax
+  800968:	5b                   	pop    %ebx
+  800969:	5e                   	pop    %esi
+  80096a:	5d                   	pop    %ebp
+  80096b:	c3                   	ret
+
+0080096c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80096c:	55                   	push   %ebp
+  80096d:	89 e5                	mov    %esp,%ebp
+  80096f:	56                   	push   %esi
+  800970:	53                   	push   %ebx
+  800971:	8b 75 08             	mov    0x8(%ebp),%esi
+  800974:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800977:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80097a:	89 f0                	mov    %esi,%eax
+  80097c:	85 d2                	test   %edx,%edx
+  80097e:	74 21                	je     8009a1 <strlcpy+0x35>
+  800980:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800984:	89 f2                	mov    %esi,%edx
+  800986:	eb 09                	jmp    800991 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800988:	83 c1 01             	add    $0x1,%ecx
+  80098b:	83 c2 01             	add    $0x1,%edx
+  80098e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800991:	39 c2                	cmp    %eax,%edx
+  800993:	74 09                	je     80099e <strlcpy+0x32>
+  800995:	0f b6 19             	movzbl (%ecx),%ebx
+  800998:	84 db                	test   %bl,%bl
+  80099a:	75 ec                	jne    800988 <strlcpy+0x1c>
+  80099c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80099e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009a1:	29 f0                	sub    %esi,%eax
+}
+  8009a3:	5b                   	pop    %ebx
+  8009a4:	5e                   	pop    %esi
+  8009a5:	5d                   	pop    %ebp
+  8009a6:	c3                   	ret
+
+008009a7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009a7:	55                   	push   %ebp
+  8009a8:	89 e5                	mov    %esp,%ebp
+  8009aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009b0:	eb 06                	jmp    8009b8 <strcmp+0x11>
+		p++, q++;
+  8009b2:	83 c1 01             	add    $0x1,%ecx
+  8009b5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009b8:	0f b6 01             	movzbl (%ecx),%eax
+  8009bb:	84 c0                	test   %al,%al
+  8009bd:	74 04                	je     8009c3 <strcmp+0x1c>
+  8009bf:	3a 02                	cmp    (%edx),%al
+  8009c1:	74 ef                	je     8009b2 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c3:	0f b6 c0             	movzbl %al,%eax
+  8009c6:	0f b6 12             	movzbl (%edx),%edx
+  8009c9:	29 d0                	sub    %edx,%eax
+}
+  8009cb:	5d                   	pop    %ebp
+  8009cc:	c3                   	ret
+
+008009cd <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009cd:	55                   	push   %ebp
+  8009ce:	89 e5                	mov    %esp,%ebp
+  8009d0:	53                   	push   %ebx
+  8009d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009da:	eb 09                	jmp    8009e5 <strncmp+0x18>
+		n--, p++, q++;
+  8009dc:	83 ea 01             	sub    $0x1,%edx
+  8009df:	83 c0 01             	add    $0x1,%eax
+  8009e2:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009e5:	85 d2                	test   %edx,%edx
+  8009e7:	74 18                	je     800a01 <strncmp+0x34>
+  8009e9:	0f b6 18             	movzbl (%eax),%ebx
+  8009ec:	84 db                	test   %bl,%bl
+  8009ee:	74 04                	je     8009f4 <strncmp+0x27>
+  8009f0:	3a 19                	cmp    (%ecx),%bl
+  8009f2:	74 e8                	je     8009dc <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009f4:	0f b6 00             	movzbl (%eax),%eax
+  8009f7:	0f b6 11             	movzbl (%ecx),%edx
+  8009fa:	29 d0                	sub    %edx,%eax
+}
+  8009fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ff:	c9                   	leave
+  800a00:	c3                   	ret
+		return 0;
+  800a01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a06:	eb f4                	jmp    8009fc <strncmp+0x2f>
+
+00800a08 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a08:	55                   	push   %ebp
+  800a09:	89 e5                	mov    %esp,%ebp
+  800a0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a12:	eb 03                	jmp    800a17 <strchr+0xf>
+  800a14:	83 c0 01             	add    $0x1,%eax
+  800a17:	0f b6 10             	movzbl (%eax),%edx
+  800a1a:	84 d2                	test   %dl,%dl
+  800a1c:	74 06                	je     800a24 <strchr+0x1c>
+		if (*s == c)
+  800a1e:	38 ca                	cmp    %cl,%dl
+  800a20:	75 f2                	jne    800a14 <strchr+0xc>
+  800a22:	eb 05                	jmp    800a29 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a29:	5d                   	pop    %ebp
+  800a2a:	c3                   	ret
+
+00800a2b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a31:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a35:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a38:	38 ca                	cmp    %cl,%dl
+  800a3a:	74 09                	je     800a45 <strfind+0x1a>
+  800a3c:	84 d2                	test   %dl,%dl
+  800a3e:	74 05                	je     800a45 <strfind+0x1a>
+	for (; *s; s++)
+  800a40:	83 c0 01             	add    $0x1,%eax
+  800a43:	eb f0                	jmp    800a35 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a45:	5d                   	pop    %ebp
+  800a46:	c3                   	ret
+
+00800a47 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a47:	55                   	push   %ebp
+  800a48:	89 e5                	mov    %esp,%ebp
+  800a4a:	57                   	push   %edi
+  800a4b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a4e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a51:	85 c9                	test   %ecx,%ecx
+  800a53:	74 20                	je     800a75 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a55:	89 f8                	mov    %edi,%eax
+  800a57:	09 c8                	or     %ecx,%eax
+  800a59:	a8 03                	test   $0x3,%al
+  800a5b:	75 12                	jne    800a6f <memset+0x28>
+		c &= 0xFF;
+  800a5d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a61:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a67:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a6a:	fc                   	cld
+  800a6b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a6d:	eb 06                	jmp    800a75 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a72:	fc                   	cld
+  800a73:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a75:	89 f8                	mov    %edi,%eax
+  800a77:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a7a:	c9                   	leave
+  800a7b:	c3                   	ret
+
+00800a7c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a7c:	55                   	push   %ebp
+  800a7d:	89 e5                	mov    %esp,%ebp
+  800a7f:	57                   	push   %edi
+  800a80:	56                   	push   %esi
+  800a81:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a84:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a87:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a8a:	39 c6                	cmp    %eax,%esi
+  800a8c:	73 32                	jae    800ac0 <memmove+0x44>
+  800a8e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a91:	39 d0                	cmp    %edx,%eax
+  800a93:	73 2b                	jae    800ac0 <memmove+0x44>
+		s += n;
+		d += n;
+  800a95:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a98:	89 d6                	mov    %edx,%esi
+  800a9a:	09 fe                	or     %edi,%esi
+  800a9c:	09 ce                	or     %ecx,%esi
+  800a9e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aa4:	75 0e                	jne    800ab4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800aa6:	83 ef 04             	sub    $0x4,%edi
+  800aa9:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aac:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800aaf:	fd                   	std
+  800ab0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ab2:	eb 09                	jmp    800abd <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ab4:	83 ef 01             	sub    $0x1,%edi
+  800ab7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800aba:	fd                   	std
+  800abb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800abd:	fc                   	cld
+  800abe:	eb 1a                	jmp    800ada <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ac0:	89 f2                	mov    %esi,%edx
+  800ac2:	09 c2                	or     %eax,%edx
+  800ac4:	09 ca                	or     %ecx,%edx
+  800ac6:	f6 c2 03             	test   $0x3,%dl
+  800ac9:	75 0a                	jne    800ad5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800acb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ace:	89 c7                	mov    %eax,%edi
+  800ad0:	fc                   	cld
+  800ad1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad3:	eb 05                	jmp    800ada <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ad5:	89 c7                	mov    %eax,%edi
+  800ad7:	fc                   	cld
+  800ad8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ada:	5e                   	pop    %esi
+  800adb:	5f                   	pop    %edi
+  800adc:	5d                   	pop    %ebp
+  800add:	c3                   	ret
+
+00800ade <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ae4:	ff 75 10             	push   0x10(%ebp)
+  800ae7:	ff 75 0c             	push   0xc(%ebp)
+  800aea:	ff 75 08             	push   0x8(%ebp)
+  800aed:	e8 8a ff ff ff       	call   800a7c <memmove>
+}
+  800af2:	c9                   	leave
+  800af3:	c3                   	ret
+
+00800af4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800af4:	55                   	push   %ebp
+  800af5:	89 e5                	mov    %esp,%ebp
+  800af7:	56                   	push   %esi
+  800af8:	53                   	push   %ebx
+  800af9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800aff:	89 c6                	mov    %eax,%esi
+  800b01:	03 75 10             	add    0x10(%ebp),%esi
+  800b04:	eb 06                	jmp    800b0c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b06:	83 c0 01             	add    $0x1,%eax
+  800b09:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b0c:	39 f0                	cmp    %esi,%eax
+  800b0e:	74 14                	je     800b24 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b10:	0f b6 08             	movzbl (%eax),%ecx
+  800b13:	0f b6 1a             	movzbl (%edx),%ebx
+  800b16:	38 d9                	cmp    %bl,%cl
+  800b18:	74 ec                	je     800b06 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b1a:	0f b6 c1             	movzbl %cl,%eax
+  800b1d:	0f b6 db             	movzbl %bl,%ebx
+  800b20:	29 d8                	sub    %ebx,%eax
+  800b22:	eb 05                	jmp    800b29 <memcmp+0x35>
+	}
+
+	return 0;
+  800b24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b29:	5b                   	pop    %ebx
+  800b2a:	5e                   	pop    %esi
+  800b2b:	5d                   	pop    %ebp
+  800b2c:	c3                   	ret
+
+00800b2d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b2d:	55                   	push   %ebp
+  800b2e:	89 e5                	mov    %esp,%ebp
+  800b30:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b36:	89 c2                	mov    %eax,%edx
+  800b38:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b3b:	eb 03                	jmp    800b40 <memfind+0x13>
+  800b3d:	83 c0 01             	add    $0x1,%eax
+  800b40:	39 d0                	cmp    %edx,%eax
+  800b42:	73 04                	jae    800b48 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b44:	38 08                	cmp    %cl,(%eax)
+  800b46:	75 f5                	jne    800b3d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b48:	5d                   	pop    %ebp
+  800b49:	c3                   	ret
+
+00800b4a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b4a:	55                   	push   %ebp
+  800b4b:	89 e5                	mov    %esp,%ebp
+  800b4d:	57                   	push   %edi
+  800b4e:	56                   	push   %esi
+  800b4f:	53                   	push   %ebx
+  800b50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b56:	eb 03                	jmp    800b5b <strtol+0x11>
+		s++;
+  800b58:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b5b:	0f b6 02             	movzbl (%edx),%eax
+  800b5e:	3c 20                	cmp    $0x20,%al
+  800b60:	74 f6                	je     800b58 <strtol+0xe>
+  800b62:	3c 09                	cmp    $0x9,%al
+  800b64:	74 f2                	je     800b58 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b66:	3c 2b                	cmp    $0x2b,%al
+  800b68:	74 2a                	je     800b94 <strtol+0x4a>
+	int neg = 0;
+  800b6a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b6f:	3c 2d                	cmp    $0x2d,%al
+  800b71:	74 2b                	je     800b9e <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b73:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b79:	75 0f                	jne    800b8a <strtol+0x40>
+  800b7b:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b7e:	74 28                	je     800ba8 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b80:	85 db                	test   %ebx,%ebx
+  800b82:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b87:	0f 44 d8             	cmove  %eax,%ebx
+  800b8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b8f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b92:	eb 46                	jmp    800bda <strtol+0x90>
+		s++;
+  800b94:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b97:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b9c:	eb d5                	jmp    800b73 <strtol+0x29>
+		s++, neg = 1;
+  800b9e:	83 c2 01             	add    $0x1,%edx
+  800ba1:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ba6:	eb cb                	jmp    800b73 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ba8:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bac:	74 0e                	je     800bbc <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bae:	85 db                	test   %ebx,%ebx
+  800bb0:	75 d8                	jne    800b8a <strtol+0x40>
+		s++, base = 8;
+  800bb2:	83 c2 01             	add    $0x1,%edx
+  800bb5:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bba:	eb ce                	jmp    800b8a <strtol+0x40>
+		s += 2, base = 16;
+  800bbc:	83 c2 02             	add    $0x2,%edx
+  800bbf:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bc4:	eb c4                	jmp    800b8a <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bc6:	0f be c0             	movsbl %al,%eax
+  800bc9:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bcc:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bcf:	7d 3a                	jge    800c0b <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bd1:	83 c2 01             	add    $0x1,%edx
+  800bd4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bd8:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bda:	0f b6 02             	movzbl (%edx),%eax
+  800bdd:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800be0:	89 f3                	mov    %esi,%ebx
+  800be2:	80 fb 09             	cmp    $0x9,%bl
+  800be5:	76 df                	jbe    800bc6 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800be7:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bea:	89 f3                	mov    %esi,%ebx
+  800bec:	80 fb 19             	cmp    $0x19,%bl
+  800bef:	77 08                	ja     800bf9 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bf1:	0f be c0             	movsbl %al,%eax
+  800bf4:	83 e8 57             	sub    $0x57,%eax
+  800bf7:	eb d3                	jmp    800bcc <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bf9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bfc:	89 f3                	mov    %esi,%ebx
+  800bfe:	80 fb 19             	cmp    $0x19,%bl
+  800c01:	77 08                	ja     800c0b <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c03:	0f be c0             	movsbl %al,%eax
+  800c06:	83 e8 37             	sub    $0x37,%eax
+  800c09:	eb c1                	jmp    800bcc <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c0b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c0f:	74 05                	je     800c16 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c11:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c14:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c16:	89 c8                	mov    %ecx,%eax
+  800c18:	f7 d8                	neg    %eax
+  800c1a:	85 ff                	test   %edi,%edi
+  800c1c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c1f:	89 c8                	mov    %ecx,%eax
+  800c21:	5b                   	pop    %ebx
+  800c22:	5e                   	pop    %esi
+  800c23:	5f                   	pop    %edi
+  800c24:	5d                   	pop    %ebp
+  800c25:	c3                   	ret
+
+00800c26 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c26:	55                   	push   %ebp
+  800c27:	89 e5                	mov    %esp,%ebp
+  800c29:	57                   	push   %edi
+  800c2a:	56                   	push   %esi
+  800c2b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c37:	89 c3                	mov    %eax,%ebx
+  800c39:	89 c7                	mov    %eax,%edi
+  800c3b:	55                   	push   %ebp
+  800c3c:	89 e5                	mov    %esp,%ebp
+  800c3e:	8d 35 46 0c 80 00    	lea    0x800c46,%esi
+  800c44:	0f 34                	sysenter
+  800c46:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800c47:	5b                   	pop    %ebx
+  800c48:	5e                   	pop    %esi
+  800c49:	5f                   	pop    %edi
+  800c4a:	5d                   	pop    %ebp
+  800c4b:	c3                   	ret
+
+00800c4c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c4c:	55                   	push   %ebp
+  800c4d:	89 e5                	mov    %esp,%ebp
+  800c4f:	57                   	push   %edi
+  800c50:	56                   	push   %esi
+  800c51:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c52:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c57:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c5c:	89 d1                	mov    %edx,%ecx
+  800c5e:	89 d3                	mov    %edx,%ebx
+  800c60:	89 d7                	mov    %edx,%edi
+  800c62:	55                   	push   %ebp
+  800c63:	89 e5                	mov    %esp,%ebp
+  800c65:	8d 35 6d 0c 80 00    	lea    0x800c6d,%esi
+  800c6b:	0f 34                	sysenter
+  800c6d:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800c6e:	5b                   	pop    %ebx
+  800c6f:	5e                   	pop    %esi
+  800c70:	5f                   	pop    %edi
+  800c71:	5d                   	pop    %ebp
+  800c72:	c3                   	ret
+
+00800c73 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c73:	55                   	push   %ebp
+  800c74:	89 e5                	mov    %esp,%ebp
+  800c76:	57                   	push   %edi
+  800c77:	56                   	push   %esi
+  800c78:	53                   	push   %ebx
+  800c79:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c84:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c89:	89 cb                	mov    %ecx,%ebx
+  800c8b:	89 cf                	mov    %ecx,%edi
+  800c8d:	55                   	push   %ebp
+  800c8e:	89 e5                	mov    %esp,%ebp
+  800c90:	8d 35 98 0c 80 00    	lea    0x800c98,%esi
+  800c96:	0f 34                	sysenter
+  800c98:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c99:	85 c0                	test   %eax,%eax
+  800c9b:	7f 08                	jg     800ca5 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800c9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca0:	5b                   	pop    %ebx
+  800ca1:	5e                   	pop    %esi
+  800ca2:	5f                   	pop    %edi
+  800ca3:	5d                   	pop    %ebp
+  800ca4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca5:	83 ec 0c             	sub    $0xc,%esp
+  800ca8:	50                   	push   %eax
+  800ca9:	6a 03                	push   $0x3
+  800cab:	68 a7 3d 80 00       	push   $0x803da7
+  800cb0:	6a 3d                	push   $0x3d
+  800cb2:	68 c4 3d 80 00       	push   $0x803dc4
+  800cb7:	e8 71 f5 ff ff       	call   80022d <_panic>
+
+00800cbc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cbc:	55                   	push   %ebp
+  800cbd:	89 e5                	mov    %esp,%ebp
+  800cbf:	57                   	push   %edi
+  800cc0:	56                   	push   %esi
+  800cc1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800cc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ccc:	89 d1                	mov    %edx,%ecx
+  800cce:	89 d3                	mov    %edx,%ebx
+  800cd0:	89 d7                	mov    %edx,%edi
+  800cd2:	55                   	push   %ebp
+  800cd3:	89 e5                	mov    %esp,%ebp
+  800cd5:	8d 35 dd 0c 80 00    	lea    0x800cdd,%esi
+  800cdb:	0f 34                	sysenter
+  800cdd:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800cde:	5b                   	pop    %ebx
+  800cdf:	5e                   	pop    %esi
+  800ce0:	5f                   	pop    %edi
+  800ce1:	5d                   	pop    %ebp
+  800ce2:	c3                   	ret
+
+00800ce3 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	57                   	push   %edi
+  800ce7:	56                   	push   %esi
+  800ce8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ce9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cee:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cf3:	89 d1                	mov    %edx,%ecx
+  800cf5:	89 d3                	mov    %edx,%ebx
+  800cf7:	89 d7                	mov    %edx,%edi
+  800cf9:	89 d6                	mov    %edx,%esi
+  800cfb:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cfd:	5b                   	pop    %ebx
+  800cfe:	5e                   	pop    %esi
+  800cff:	5f                   	pop    %edi
+  800d00:	5d                   	pop    %ebp
+  800d01:	c3                   	ret
+
+00800d02 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d02:	55                   	push   %ebp
+  800d03:	89 e5                	mov    %esp,%ebp
+  800d05:	57                   	push   %edi
+  800d06:	56                   	push   %esi
+  800d07:	53                   	push   %ebx
+  800d08:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d11:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d16:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d1e:	55                   	push   %ebp
+  800d1f:	89 e5                	mov    %esp,%ebp
+  800d21:	8d 35 29 0d 80 00    	lea    0x800d29,%esi
+  800d27:	0f 34                	sysenter
+  800d29:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d2a:	85 c0                	test   %eax,%eax
+  800d2c:	7f 08                	jg     800d36 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800d2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d31:	5b                   	pop    %ebx
+  800d32:	5e                   	pop    %esi
+  800d33:	5f                   	pop    %edi
+  800d34:	5d                   	pop    %ebp
+  800d35:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d36:	83 ec 0c             	sub    $0xc,%esp
+  800d39:	50                   	push   %eax
+  800d3a:	6a 04                	push   $0x4
+  800d3c:	68 a7 3d 80 00       	push   $0x803da7
+  800d41:	6a 3d                	push   $0x3d
+  800d43:	68 c4 3d 80 00       	push   $0x803dc4
+  800d48:	e8 e0 f4 ff ff       	call   80022d <_panic>
+
+00800d4d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d4d:	55                   	push   %ebp
+  800d4e:	89 e5                	mov    %esp,%ebp
+  800d50:	57                   	push   %edi
+  800d51:	56                   	push   %esi
+  800d52:	53                   	push   %ebx
+  800d53:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d64:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d67:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d6a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d6c:	85 c0                	test   %eax,%eax
+  800d6e:	7f 08                	jg     800d78 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d73:	5b                   	pop    %ebx
+  800d74:	5e                   	pop    %esi
+  800d75:	5f                   	pop    %edi
+  800d76:	5d                   	pop    %ebp
+  800d77:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d78:	83 ec 0c             	sub    $0xc,%esp
+  800d7b:	50                   	push   %eax
+  800d7c:	6a 05                	push   $0x5
+  800d7e:	68 a7 3d 80 00       	push   $0x803da7
+  800d83:	6a 23                	push   $0x23
+  800d85:	68 c4 3d 80 00       	push   $0x803dc4
+  800d8a:	e8 9e f4 ff ff       	call   80022d <_panic>
+
+00800d8f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d8f:	55                   	push   %ebp
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	57                   	push   %edi
+  800d93:	56                   	push   %esi
+  800d94:	53                   	push   %ebx
+  800d95:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da3:	b8 06 00 00 00       	mov    $0x6,%eax
+  800da8:	89 df                	mov    %ebx,%edi
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	8d 35 b5 0d 80 00    	lea    0x800db5,%esi
+  800db3:	0f 34                	sysenter
+  800db5:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800db6:	85 c0                	test   %eax,%eax
+  800db8:	7f 08                	jg     800dc2 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800dba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dbd:	5b                   	pop    %ebx
+  800dbe:	5e                   	pop    %esi
+  800dbf:	5f                   	pop    %edi
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dc2:	83 ec 0c             	sub    $0xc,%esp
+  800dc5:	50                   	push   %eax
+  800dc6:	6a 06                	push   $0x6
+  800dc8:	68 a7 3d 80 00       	push   $0x803da7
+  800dcd:	6a 3d                	push   $0x3d
+  800dcf:	68 c4 3d 80 00       	push   $0x803dc4
+  800dd4:	e8 54 f4 ff ff       	call   80022d <_panic>
+
+00800dd9 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800dd9:	55                   	push   %ebp
+  800dda:	89 e5                	mov    %esp,%ebp
+  800ddc:	57                   	push   %edi
+  800ddd:	56                   	push   %esi
+  800dde:	53                   	push   %ebx
+  800ddf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800de2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800de7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ded:	b8 08 00 00 00       	mov    $0x8,%eax
+  800df2:	89 df                	mov    %ebx,%edi
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	8d 35 ff 0d 80 00    	lea    0x800dff,%esi
+  800dfd:	0f 34                	sysenter
+  800dff:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e00:	85 c0                	test   %eax,%eax
+  800e02:	7f 08                	jg     800e0c <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800e04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e07:	5b                   	pop    %ebx
+  800e08:	5e                   	pop    %esi
+  800e09:	5f                   	pop    %edi
+  800e0a:	5d                   	pop    %ebp
+  800e0b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e0c:	83 ec 0c             	sub    $0xc,%esp
+  800e0f:	50                   	push   %eax
+  800e10:	6a 08                	push   $0x8
+  800e12:	68 a7 3d 80 00       	push   $0x803da7
+  800e17:	6a 3d                	push   $0x3d
+  800e19:	68 c4 3d 80 00       	push   $0x803dc4
+  800e1e:	e8 0a f4 ff ff       	call   80022d <_panic>
+
+00800e23 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e23:	55                   	push   %ebp
+  800e24:	89 e5                	mov    %esp,%ebp
+  800e26:	57                   	push   %edi
+  800e27:	56                   	push   %esi
+  800e28:	53                   	push   %ebx
+  800e29:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e37:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e3c:	89 df                	mov    %ebx,%edi
+  800e3e:	55                   	push   %ebp
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	8d 35 49 0e 80 00    	lea    0x800e49,%esi
+  800e47:	0f 34                	sysenter
+  800e49:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e4a:	85 c0                	test   %eax,%eax
+  800e4c:	7f 08                	jg     800e56 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800e4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e51:	5b                   	pop    %ebx
+  800e52:	5e                   	pop    %esi
+  800e53:	5f                   	pop    %edi
+  800e54:	5d                   	pop    %ebp
+  800e55:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e56:	83 ec 0c             	sub    $0xc,%esp
+  800e59:	50                   	push   %eax
+  800e5a:	6a 09                	push   $0x9
+  800e5c:	68 a7 3d 80 00       	push   $0x803da7
+  800e61:	6a 3d                	push   $0x3d
+  800e63:	68 c4 3d 80 00       	push   $0x803dc4
+  800e68:	e8 c0 f3 ff ff       	call   80022d <_panic>
+
+00800e6d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e6d:	55                   	push   %ebp
+  800e6e:	89 e5                	mov    %esp,%ebp
+  800e70:	57                   	push   %edi
+  800e71:	56                   	push   %esi
+  800e72:	53                   	push   %ebx
+  800e73:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e81:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e86:	89 df                	mov    %ebx,%edi
+  800e88:	55                   	push   %ebp
+  800e89:	89 e5                	mov    %esp,%ebp
+  800e8b:	8d 35 93 0e 80 00    	lea    0x800e93,%esi
+  800e91:	0f 34                	sysenter
+  800e93:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e94:	85 c0                	test   %eax,%eax
+  800e96:	7f 08                	jg     800ea0 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800e98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9b:	5b                   	pop    %ebx
+  800e9c:	5e                   	pop    %esi
+  800e9d:	5f                   	pop    %edi
+  800e9e:	5d                   	pop    %ebp
+  800e9f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea0:	83 ec 0c             	sub    $0xc,%esp
+  800ea3:	50                   	push   %eax
+  800ea4:	6a 0a                	push   $0xa
+  800ea6:	68 a7 3d 80 00       	push   $0x803da7
+  800eab:	6a 3d                	push   $0x3d
+  800ead:	68 c4 3d 80 00       	push   $0x803dc4
+  800eb2:	e8 76 f3 ff ff       	call   80022d <_panic>
+
+00800eb7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800eb7:	55                   	push   %ebp
+  800eb8:	89 e5                	mov    %esp,%ebp
+  800eba:	57                   	push   %edi
+  800ebb:	56                   	push   %esi
+  800ebc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ebd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ec8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ece:	55                   	push   %ebp
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	8d 35 d9 0e 80 00    	lea    0x800ed9,%esi
+  800ed7:	0f 34                	sysenter
+  800ed9:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800eda:	5b                   	pop    %ebx
+  800edb:	5e                   	pop    %esi
+  800edc:	5f                   	pop    %edi
+  800edd:	5d                   	pop    %ebp
+  800ede:	c3                   	ret
+
+00800edf <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800edf:	55                   	push   %ebp
+  800ee0:	89 e5                	mov    %esp,%ebp
+  800ee2:	57                   	push   %edi
+  800ee3:	56                   	push   %esi
+  800ee4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ee5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eeb:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ef0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef6:	55                   	push   %ebp
+  800ef7:	89 e5                	mov    %esp,%ebp
+  800ef9:	8d 35 01 0f 80 00    	lea    0x800f01,%esi
+  800eff:	0f 34                	sysenter
+  800f01:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800f02:	5b                   	pop    %ebx
+  800f03:	5e                   	pop    %esi
+  800f04:	5f                   	pop    %edi
+  800f05:	5d                   	pop    %ebp
+  800f06:	c3                   	ret
+
+00800f07 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800f07:	55                   	push   %ebp
+  800f08:	89 e5                	mov    %esp,%ebp
+  800f0a:	57                   	push   %edi
+  800f0b:	56                   	push   %esi
+  800f0c:	53                   	push   %ebx
+  800f0d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f10:	be 00 00 00 00       	mov    $0x0,%esi
+  800f15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f23:	89 f7                	mov    %esi,%edi
+  800f25:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f27:	85 c0                	test   %eax,%eax
+  800f29:	7f 08                	jg     800f33 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800f2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2e:	5b                   	pop    %ebx
+  800f2f:	5e                   	pop    %esi
+  800f30:	5f                   	pop    %edi
+  800f31:	5d                   	pop    %ebp
+  800f32:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f33:	83 ec 0c             	sub    $0xc,%esp
+  800f36:	50                   	push   %eax
+  800f37:	6a 0d                	push   $0xd
+  800f39:	68 a7 3d 80 00       	push   $0x803da7
+  800f3e:	6a 23                	push   $0x23
+  800f40:	68 c4 3d 80 00       	push   $0x803dc4
+  800f45:	e8 e3 f2 ff ff       	call   80022d <_panic>
+
+00800f4a <sys_ipc_recv>:
+{
+  800f4a:	55                   	push   %ebp
+  800f4b:	89 e5                	mov    %esp,%ebp
+  800f4d:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800f50:	6a 00                	push   $0x0
+  800f52:	6a 01                	push   $0x1
+  800f54:	ff 75 08             	push   0x8(%ebp)
+  800f57:	e8 ab ff ff ff       	call   800f07 <sys_ipc_recvv>
+}
+  800f5c:	c9                   	leave
+  800f5d:	c3                   	ret
+
+00800f5e <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f72:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f77:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800f7a:	89 de                	mov    %ebx,%esi
+  800f7c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7e:	85 c0                	test   %eax,%eax
+  800f80:	7f 08                	jg     800f8a <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800f82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f85:	5b                   	pop    %ebx
+  800f86:	5e                   	pop    %esi
+  800f87:	5f                   	pop    %edi
+  800f88:	5d                   	pop    %ebp
+  800f89:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8a:	83 ec 0c             	sub    $0xc,%esp
+  800f8d:	50                   	push   %eax
+  800f8e:	6a 0d                	push   $0xd
+  800f90:	68 a7 3d 80 00       	push   $0x803da7
+  800f95:	6a 23                	push   $0x23
+  800f97:	68 c4 3d 80 00       	push   $0x803dc4
+  800f9c:	e8 8c f2 ff ff       	call   80022d <_panic>
+
+00800fa1 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fa1:	55                   	push   %ebp
+  800fa2:	89 e5                	mov    %esp,%ebp
+  800fa4:	57                   	push   %edi
+  800fa5:	56                   	push   %esi
+  800fa6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fa7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fac:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fb1:	89 d1                	mov    %edx,%ecx
+  800fb3:	89 d3                	mov    %edx,%ebx
+  800fb5:	89 d7                	mov    %edx,%edi
+  800fb7:	55                   	push   %ebp
+  800fb8:	89 e5                	mov    %esp,%ebp
+  800fba:	8d 35 c2 0f 80 00    	lea    0x800fc2,%esi
+  800fc0:	0f 34                	sysenter
+  800fc2:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800fc3:	5b                   	pop    %ebx
+  800fc4:	5e                   	pop    %esi
+  800fc5:	5f                   	pop    %edi
+  800fc6:	5d                   	pop    %ebp
+  800fc7:	c3                   	ret
+
+00800fc8 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800fc8:	55                   	push   %ebp
+  800fc9:	89 e5                	mov    %esp,%ebp
+  800fcb:	57                   	push   %edi
+  800fcc:	56                   	push   %esi
+  800fcd:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fde:	89 df                	mov    %ebx,%edi
+  800fe0:	55                   	push   %ebp
+  800fe1:	89 e5                	mov    %esp,%ebp
+  800fe3:	8d 35 eb 0f 80 00    	lea    0x800feb,%esi
+  800fe9:	0f 34                	sysenter
+  800feb:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800fec:	5b                   	pop    %ebx
+  800fed:	5e                   	pop    %esi
+  800fee:	5f                   	pop    %edi
+  800fef:	5d                   	pop    %ebp
+  800ff0:	c3                   	ret
+
+00800ff1 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800ff1:	55                   	push   %ebp
+  800ff2:	89 e5                	mov    %esp,%ebp
+  800ff4:	57                   	push   %edi
+  800ff5:	56                   	push   %esi
+  800ff6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ff7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ffc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fff:	b8 10 00 00 00       	mov    $0x10,%eax
+  801004:	89 cb                	mov    %ecx,%ebx
+  801006:	89 cf                	mov    %ecx,%edi
+  801008:	55                   	push   %ebp
+  801009:	89 e5                	mov    %esp,%ebp
+  80100b:	8d 35 13 10 80 00    	lea    0x801013,%esi
+  801011:	0f 34                	sysenter
+  801013:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  801014:	5b                   	pop    %ebx
+  801015:	5e                   	pop    %esi
+  801016:	5f                   	pop    %edi
+  801017:	5d                   	pop    %ebp
+  801018:	c3                   	ret
+
+00801019 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  801019:	55                   	push   %ebp
+  80101a:	89 e5                	mov    %esp,%ebp
+  80101c:	57                   	push   %edi
+  80101d:	56                   	push   %esi
+  80101e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80101f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801024:	8b 55 08             	mov    0x8(%ebp),%edx
+  801027:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80102f:	89 df                	mov    %ebx,%edi
+  801031:	55                   	push   %ebp
+  801032:	89 e5                	mov    %esp,%ebp
+  801034:	8d 35 3c 10 80 00    	lea    0x80103c,%esi
+  80103a:	0f 34                	sysenter
+  80103c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  80103d:	5b                   	pop    %ebx
+  80103e:	5e                   	pop    %esi
+  80103f:	5f                   	pop    %edi
+  801040:	5d                   	pop    %ebp
+  801041:	c3                   	ret
+
+00801042 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  801042:	55                   	push   %ebp
+  801043:	89 e5                	mov    %esp,%ebp
+  801045:	57                   	push   %edi
+  801046:	56                   	push   %esi
+  801047:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801048:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801050:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801053:	b8 14 00 00 00       	mov    $0x14,%eax
+  801058:	89 df                	mov    %ebx,%edi
+  80105a:	55                   	push   %ebp
+  80105b:	89 e5                	mov    %esp,%ebp
+  80105d:	8d 35 65 10 80 00    	lea    0x801065,%esi
+  801063:	0f 34                	sysenter
+  801065:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  801066:	5b                   	pop    %ebx
+  801067:	5e                   	pop    %esi
+  801068:	5f                   	pop    %edi
+  801069:	5d                   	pop    %ebp
+  80106a:	c3                   	ret
+
+0080106b <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  80106b:	55                   	push   %ebp
+  80106c:	89 e5                	mov    %esp,%ebp
+  80106e:	57                   	push   %edi
+  80106f:	56                   	push   %esi
+  801070:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801071:	8b 55 08             	mov    0x8(%ebp),%edx
+  801074:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801077:	b8 13 00 00 00       	mov    $0x13,%eax
+  80107c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80107f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801082:	55                   	push   %ebp
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	8d 35 8d 10 80 00    	lea    0x80108d,%esi
+  80108b:	0f 34                	sysenter
+  80108d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  80108e:	5b                   	pop    %ebx
+  80108f:	5e                   	pop    %esi
+  801090:	5f                   	pop    %edi
+  801091:	5d                   	pop    %ebp
+  801092:	c3                   	ret
+
+00801093 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	57                   	push   %edi
+  801097:	56                   	push   %esi
+  801098:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801099:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80109e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a1:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010a6:	89 cb                	mov    %ecx,%ebx
+  8010a8:	89 cf                	mov    %ecx,%edi
+  8010aa:	89 ce                	mov    %ecx,%esi
+  8010ac:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  8010ae:	5b                   	pop    %ebx
+  8010af:	5e                   	pop    %esi
+  8010b0:	5f                   	pop    %edi
+  8010b1:	5d                   	pop    %ebp
+  8010b2:	c3                   	ret
+
+008010b3 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  8010b3:	55                   	push   %ebp
+  8010b4:	89 e5                	mov    %esp,%ebp
+  8010b6:	57                   	push   %edi
+  8010b7:	56                   	push   %esi
+  8010b8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c1:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010c6:	89 cb                	mov    %ecx,%ebx
+  8010c8:	89 cf                	mov    %ecx,%edi
+  8010ca:	55                   	push   %ebp
+  8010cb:	89 e5                	mov    %esp,%ebp
+  8010cd:	8d 35 d5 10 80 00    	lea    0x8010d5,%esi
+  8010d3:	0f 34                	sysenter
+  8010d5:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8010d6:	5b                   	pop    %ebx
+  8010d7:	5e                   	pop    %esi
+  8010d8:	5f                   	pop    %edi
+  8010d9:	5d                   	pop    %ebp
+  8010da:	c3                   	ret
+
+008010db <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8010db:	55                   	push   %ebp
+  8010dc:	89 e5                	mov    %esp,%ebp
+  8010de:	57                   	push   %edi
+  8010df:	56                   	push   %esi
+  8010e0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e9:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010ee:	89 cb                	mov    %ecx,%ebx
+  8010f0:	89 cf                	mov    %ecx,%edi
+  8010f2:	55                   	push   %ebp
+  8010f3:	89 e5                	mov    %esp,%ebp
+  8010f5:	8d 35 fd 10 80 00    	lea    0x8010fd,%esi
+  8010fb:	0f 34                	sysenter
+  8010fd:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8010fe:	5b                   	pop    %ebx
+  8010ff:	5e                   	pop    %esi
+  801100:	5f                   	pop    %edi
+  801101:	5d                   	pop    %ebp
+  801102:	c3                   	ret
+
+00801103 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  801103:	55                   	push   %ebp
+  801104:	89 e5                	mov    %esp,%ebp
+  801106:	57                   	push   %edi
+  801107:	56                   	push   %esi
+  801108:	53                   	push   %ebx
+  801109:	83 ec 20             	sub    $0x20,%esp
+  80110c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80110f:	89 d7                	mov    %edx,%edi
+  801111:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  801113:	51                   	push   %ecx
+  801114:	68 00 f0 7f 00       	push   $0x7ff000
+  801119:	6a 00                	push   $0x0
+  80111b:	e8 e2 fb ff ff       	call   800d02 <sys_page_alloc>
+  801120:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801122:	83 c4 10             	add    $0x10,%esp
+  801125:	85 c0                	test   %eax,%eax
+  801127:	78 45                	js     80116e <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  801129:	83 ec 04             	sub    $0x4,%esp
+  80112c:	68 00 10 00 00       	push   $0x1000
+  801131:	57                   	push   %edi
+  801132:	68 00 f0 7f 00       	push   $0x7ff000
+  801137:	e8 40 f9 ff ff       	call   800a7c <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  80113c:	89 34 24             	mov    %esi,(%esp)
+  80113f:	57                   	push   %edi
+  801140:	ff 75 e4             	push   -0x1c(%ebp)
+  801143:	68 00 f0 7f 00       	push   $0x7ff000
+  801148:	6a 00                	push   $0x0
+  80114a:	e8 fe fb ff ff       	call   800d4d <sys_page_map>
+  80114f:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801151:	83 c4 20             	add    $0x20,%esp
+  801154:	85 c0                	test   %eax,%eax
+  801156:	78 16                	js     80116e <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801158:	83 ec 08             	sub    $0x8,%esp
+  80115b:	68 00 f0 7f 00       	push   $0x7ff000
+  801160:	6a 00                	push   $0x0
+  801162:	e8 28 fc ff ff       	call   800d8f <sys_page_unmap>
+  801167:	83 c4 10             	add    $0x10,%esp
+  80116a:	85 c0                	test   %eax,%eax
+  80116c:	75 0a                	jne    801178 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  80116e:	89 d8                	mov    %ebx,%eax
+  801170:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801173:	5b                   	pop    %ebx
+  801174:	5e                   	pop    %esi
+  801175:	5f                   	pop    %edi
+  801176:	5d                   	pop    %ebp
+  801177:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801178:	68 d4 3d 80 00       	push   $0x803dd4
+  80117d:	68 4c 3e 80 00       	push   $0x803e4c
+  801182:	6a 1b                	push   $0x1b
+  801184:	68 61 3e 80 00       	push   $0x803e61
+  801189:	e8 9f f0 ff ff       	call   80022d <_panic>
+
+0080118e <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80118e:	55                   	push   %ebp
+  80118f:	89 e5                	mov    %esp,%ebp
+  801191:	53                   	push   %ebx
+  801192:	83 ec 04             	sub    $0x4,%esp
+  801195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  801198:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80119a:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  80119e:	74 21                	je     8011c1 <pgfault+0x33>
+  8011a0:	89 d0                	mov    %edx,%eax
+  8011a2:	c1 e8 16             	shr    $0x16,%eax
+  8011a5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8011ac:	a8 01                	test   $0x1,%al
+  8011ae:	74 11                	je     8011c1 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  8011b0:	89 d0                	mov    %edx,%eax
+  8011b2:	c1 e8 0c             	shr    $0xc,%eax
+  8011b5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011bc:	f6 c4 08             	test   $0x8,%ah
+  8011bf:	75 17                	jne    8011d8 <pgfault+0x4a>
+		if (pgfault_next) {
+  8011c1:	a1 04 64 80 00       	mov    0x806404,%eax
+  8011c6:	85 c0                	test   %eax,%eax
+  8011c8:	74 27                	je     8011f1 <pgfault+0x63>
+			pgfault_next(utf);
+  8011ca:	83 ec 0c             	sub    $0xc,%esp
+  8011cd:	53                   	push   %ebx
+  8011ce:	ff d0                	call   *%eax
+			return;
+  8011d0:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8011d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011d6:	c9                   	leave
+  8011d7:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8011d8:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8011de:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8011e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e8:	e8 16 ff ff ff       	call   801103 <copy_page_to>
+  8011ed:	85 c0                	test   %eax,%eax
+  8011ef:	79 e2                	jns    8011d3 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8011f1:	a1 00 64 80 00       	mov    0x806400,%eax
+  8011f6:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8011f9:	ff 73 28             	push   0x28(%ebx)
+  8011fc:	ff 33                	push   (%ebx)
+  8011fe:	50                   	push   %eax
+  8011ff:	68 f8 3d 80 00       	push   $0x803df8
+  801204:	e8 ff f0 ff ff       	call   800308 <cprintf>
+	sys_env_destroy(0);
+  801209:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801210:	e8 5e fa ff ff       	call   800c73 <sys_env_destroy>
+  801215:	83 c4 10             	add    $0x10,%esp
+  801218:	eb b9                	jmp    8011d3 <pgfault+0x45>
+
+0080121a <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  80121a:	55                   	push   %ebp
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	53                   	push   %ebx
+  80121e:	83 ec 04             	sub    $0x4,%esp
+  801221:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  801224:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  801229:	3d 8e 11 80 00       	cmp    $0x80118e,%eax
+  80122e:	74 15                	je     801245 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  801230:	a3 04 64 80 00       	mov    %eax,0x806404
+		set_pgfault_handler(pgfault);
+  801235:	83 ec 0c             	sub    $0xc,%esp
+  801238:	68 8e 11 80 00       	push   $0x80118e
+  80123d:	e8 e3 21 00 00       	call   803425 <set_pgfault_handler>
+  801242:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801245:	83 ec 0c             	sub    $0xc,%esp
+  801248:	68 05 08 00 00       	push   $0x805
+  80124d:	53                   	push   %ebx
+  80124e:	6a 00                	push   $0x0
+  801250:	53                   	push   %ebx
+  801251:	6a 00                	push   $0x0
+  801253:	e8 f5 fa ff ff       	call   800d4d <sys_page_map>
+}
+  801258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80125b:	c9                   	leave
+  80125c:	c3                   	ret
+
+0080125d <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  80125d:	55                   	push   %ebp
+  80125e:	89 e5                	mov    %esp,%ebp
+  801260:	57                   	push   %edi
+  801261:	56                   	push   %esi
+  801262:	53                   	push   %ebx
+  801263:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801266:	68 8e 11 80 00       	push   $0x80118e
+  80126b:	e8 b5 21 00 00       	call   803425 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801270:	b8 07 00 00 00       	mov    $0x7,%eax
+  801275:	cd 30                	int    $0x30
+  801277:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80127a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  80127d:	83 c4 10             	add    $0x10,%esp
+  801280:	85 c0                	test   %eax,%eax
+  801282:	0f 88 6b 01 00 00    	js     8013f3 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801288:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  80128d:	75 37                	jne    8012c6 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80128f:	e8 28 fa ff ff       	call   800cbc <sys_getenvid>
+  801294:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801299:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80129f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8012a4:	a3 00 64 80 00       	mov    %eax,0x806400
+		return 0;
+  8012a9:	e9 45 01 00 00       	jmp    8013f3 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8012ae:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8012b4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8012ba:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8012c0:	0f 87 ba 00 00 00    	ja     801380 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8012c6:	89 d8                	mov    %ebx,%eax
+  8012c8:	c1 e8 16             	shr    $0x16,%eax
+  8012cb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012d2:	a8 01                	test   $0x1,%al
+  8012d4:	74 d8                	je     8012ae <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8012d6:	89 d8                	mov    %ebx,%eax
+  8012d8:	c1 e8 0c             	shr    $0xc,%eax
+  8012db:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012e2:	f6 c2 01             	test   $0x1,%dl
+  8012e5:	74 cd                	je     8012b4 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8012e7:	89 da                	mov    %ebx,%edx
+  8012e9:	80 e6 df             	and    $0xdf,%dh
+  8012ec:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8012f2:	74 c0                	je     8012b4 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8012f4:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8012f6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012fd:	f6 c6 04             	test   $0x4,%dh
+  801300:	75 53                	jne    801355 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  801302:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801309:	f6 c6 08             	test   $0x8,%dh
+  80130c:	75 0c                	jne    80131a <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80130e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801315:	f6 c2 02             	test   $0x2,%dl
+  801318:	74 3b                	je     801355 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80131a:	83 ec 0c             	sub    $0xc,%esp
+  80131d:	68 05 08 00 00       	push   $0x805
+  801322:	57                   	push   %edi
+  801323:	ff 75 e4             	push   -0x1c(%ebp)
+  801326:	57                   	push   %edi
+  801327:	6a 00                	push   $0x0
+  801329:	e8 1f fa ff ff       	call   800d4d <sys_page_map>
+  80132e:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801330:	83 c4 20             	add    $0x20,%esp
+  801333:	85 c0                	test   %eax,%eax
+  801335:	0f 88 a7 00 00 00    	js     8013e2 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80133b:	83 ec 0c             	sub    $0xc,%esp
+  80133e:	68 05 08 00 00       	push   $0x805
+  801343:	57                   	push   %edi
+  801344:	6a 00                	push   $0x0
+  801346:	57                   	push   %edi
+  801347:	6a 00                	push   $0x0
+  801349:	e8 ff f9 ff ff       	call   800d4d <sys_page_map>
+  80134e:	89 c6                	mov    %eax,%esi
+	return r;
+  801350:	83 c4 20             	add    $0x20,%esp
+  801353:	eb 21                	jmp    801376 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  801355:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80135c:	83 ec 0c             	sub    $0xc,%esp
+  80135f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801364:	50                   	push   %eax
+  801365:	57                   	push   %edi
+  801366:	ff 75 e4             	push   -0x1c(%ebp)
+  801369:	57                   	push   %edi
+  80136a:	6a 00                	push   $0x0
+  80136c:	e8 dc f9 ff ff       	call   800d4d <sys_page_map>
+  801371:	89 c6                	mov    %eax,%esi
+  801373:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  801376:	85 f6                	test   %esi,%esi
+  801378:	0f 89 36 ff ff ff    	jns    8012b4 <fork+0x57>
+  80137e:	eb 62                	jmp    8013e2 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801380:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801385:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  80138a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80138d:	89 f8                	mov    %edi,%eax
+  80138f:	e8 6f fd ff ff       	call   801103 <copy_page_to>
+  801394:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801396:	85 c0                	test   %eax,%eax
+  801398:	78 48                	js     8013e2 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80139a:	83 ec 04             	sub    $0x4,%esp
+  80139d:	6a 07                	push   $0x7
+  80139f:	68 00 f0 bf ee       	push   $0xeebff000
+  8013a4:	57                   	push   %edi
+  8013a5:	e8 58 f9 ff ff       	call   800d02 <sys_page_alloc>
+  8013aa:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8013ac:	83 c4 10             	add    $0x10,%esp
+  8013af:	85 c0                	test   %eax,%eax
+  8013b1:	78 2f                	js     8013e2 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8013b3:	a1 00 64 80 00       	mov    0x806400,%eax
+  8013b8:	8b 40 64             	mov    0x64(%eax),%eax
+  8013bb:	83 ec 08             	sub    $0x8,%esp
+  8013be:	50                   	push   %eax
+  8013bf:	57                   	push   %edi
+  8013c0:	e8 a8 fa ff ff       	call   800e6d <sys_env_set_pgfault_upcall>
+  8013c5:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8013c7:	83 c4 10             	add    $0x10,%esp
+  8013ca:	85 c0                	test   %eax,%eax
+  8013cc:	78 14                	js     8013e2 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8013ce:	83 ec 08             	sub    $0x8,%esp
+  8013d1:	6a 02                	push   $0x2
+  8013d3:	57                   	push   %edi
+  8013d4:	e8 00 fa ff ff       	call   800dd9 <sys_env_set_status>
+  8013d9:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8013db:	83 c4 10             	add    $0x10,%esp
+  8013de:	85 c0                	test   %eax,%eax
+  8013e0:	79 11                	jns    8013f3 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8013e2:	83 ec 0c             	sub    $0xc,%esp
+  8013e5:	ff 75 e0             	push   -0x20(%ebp)
+  8013e8:	e8 86 f8 ff ff       	call   800c73 <sys_env_destroy>
+	return r;
+  8013ed:	83 c4 10             	add    $0x10,%esp
+  8013f0:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8013f3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8013f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f9:	5b                   	pop    %ebx
+  8013fa:	5e                   	pop    %esi
+  8013fb:	5f                   	pop    %edi
+  8013fc:	5d                   	pop    %ebp
+  8013fd:	c3                   	ret
+
+008013fe <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8013fe:	55                   	push   %ebp
+  8013ff:	89 e5                	mov    %esp,%ebp
+  801401:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801404:	68 6c 3e 80 00       	push   $0x803e6c
+  801409:	68 bf 00 00 00       	push   $0xbf
+  80140e:	68 61 3e 80 00       	push   $0x803e61
+  801413:	e8 15 ee ff ff       	call   80022d <_panic>
+
+00801418 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801418:	55                   	push   %ebp
+  801419:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80141b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80141e:	05 00 00 00 30       	add    $0x30000000,%eax
+  801423:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801426:	5d                   	pop    %ebp
+  801427:	c3                   	ret
+
+00801428 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801428:	55                   	push   %ebp
+  801429:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80142b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80142e:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801433:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801438:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80143d:	5d                   	pop    %ebp
+  80143e:	c3                   	ret
+
+0080143f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80143f:	55                   	push   %ebp
+  801440:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801442:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801447:	eb 02                	jmp    80144b <fd_alloc+0xc>
+  801449:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80144b:	89 c2                	mov    %eax,%edx
+  80144d:	c1 ea 16             	shr    $0x16,%edx
+  801450:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801457:	f6 c2 01             	test   $0x1,%dl
+  80145a:	74 2b                	je     801487 <fd_alloc+0x48>
+  80145c:	89 c2                	mov    %eax,%edx
+  80145e:	c1 ea 0c             	shr    $0xc,%edx
+  801461:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801468:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80146e:	f6 c1 01             	test   $0x1,%cl
+  801471:	74 14                	je     801487 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801473:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801479:	75 ce                	jne    801449 <fd_alloc+0xa>
+  80147b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801480:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801485:	eb 05                	jmp    80148c <fd_alloc+0x4d>
+			return 0;
+  801487:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80148c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148f:	89 02                	mov    %eax,(%edx)
+}
+  801491:	89 c8                	mov    %ecx,%eax
+  801493:	5d                   	pop    %ebp
+  801494:	c3                   	ret
+
+00801495 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801495:	55                   	push   %ebp
+  801496:	89 e5                	mov    %esp,%ebp
+  801498:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80149b:	83 f8 1f             	cmp    $0x1f,%eax
+  80149e:	77 30                	ja     8014d0 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8014a0:	c1 e0 0c             	shl    $0xc,%eax
+  8014a3:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8014a8:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8014ae:	f6 c2 01             	test   $0x1,%dl
+  8014b1:	74 24                	je     8014d7 <fd_lookup+0x42>
+  8014b3:	89 c2                	mov    %eax,%edx
+  8014b5:	c1 ea 0c             	shr    $0xc,%edx
+  8014b8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8014bf:	f6 c2 01             	test   $0x1,%dl
+  8014c2:	74 1a                	je     8014de <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8014c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014c7:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8014c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014ce:	5d                   	pop    %ebp
+  8014cf:	c3                   	ret
+		return -E_INVAL;
+  8014d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014d5:	eb f7                	jmp    8014ce <fd_lookup+0x39>
+		return -E_INVAL;
+  8014d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014dc:	eb f0                	jmp    8014ce <fd_lookup+0x39>
+  8014de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014e3:	eb e9                	jmp    8014ce <fd_lookup+0x39>
+
+008014e5 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8014e5:	55                   	push   %ebp
+  8014e6:	89 e5                	mov    %esp,%ebp
+  8014e8:	53                   	push   %ebx
+  8014e9:	83 ec 04             	sub    $0x4,%esp
+  8014ec:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8014ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f4:	eb 03                	jmp    8014f9 <dev_lookup+0x14>
+  8014f6:	83 c0 01             	add    $0x1,%eax
+  8014f9:	8b 1c 85 00 3f 80 00 	mov    0x803f00(,%eax,4),%ebx
+  801500:	85 db                	test   %ebx,%ebx
+  801502:	74 0b                	je     80150f <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801504:	39 13                	cmp    %edx,(%ebx)
+  801506:	75 ee                	jne    8014f6 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801508:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150d:	eb 1f                	jmp    80152e <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80150f:	a1 00 64 80 00       	mov    0x806400,%eax
+  801514:	8b 40 48             	mov    0x48(%eax),%eax
+  801517:	83 ec 04             	sub    $0x4,%esp
+  80151a:	52                   	push   %edx
+  80151b:	50                   	push   %eax
+  80151c:	68 84 3e 80 00       	push   $0x803e84
+  801521:	e8 e2 ed ff ff       	call   800308 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801526:	83 c4 10             	add    $0x10,%esp
+  801529:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80152e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801531:	89 1a                	mov    %ebx,(%edx)
+}
+  801533:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801536:	c9                   	leave
+  801537:	c3                   	ret
+
+00801538 <fd_close>:
+{
+  801538:	55                   	push   %ebp
+  801539:	89 e5                	mov    %esp,%ebp
+  80153b:	57                   	push   %edi
+  80153c:	56                   	push   %esi
+  80153d:	53                   	push   %ebx
+  80153e:	83 ec 24             	sub    $0x24,%esp
+  801541:	8b 75 08             	mov    0x8(%ebp),%esi
+  801544:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801547:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80154a:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80154b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801551:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801554:	50                   	push   %eax
+  801555:	e8 3b ff ff ff       	call   801495 <fd_lookup>
+  80155a:	89 c3                	mov    %eax,%ebx
+  80155c:	83 c4 10             	add    $0x10,%esp
+  80155f:	85 c0                	test   %eax,%eax
+  801561:	78 05                	js     801568 <fd_close+0x30>
+	    || fd != fd2)
+  801563:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801566:	74 16                	je     80157e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801568:	89 f8                	mov    %edi,%eax
+  80156a:	84 c0                	test   %al,%al
+  80156c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801571:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801574:	89 d8                	mov    %ebx,%eax
+  801576:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801579:	5b                   	pop    %ebx
+  80157a:	5e                   	pop    %esi
+  80157b:	5f                   	pop    %edi
+  80157c:	5d                   	pop    %ebp
+  80157d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80157e:	83 ec 08             	sub    $0x8,%esp
+  801581:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801584:	50                   	push   %eax
+  801585:	ff 36                	push   (%esi)
+  801587:	e8 59 ff ff ff       	call   8014e5 <dev_lookup>
+  80158c:	89 c3                	mov    %eax,%ebx
+  80158e:	83 c4 10             	add    $0x10,%esp
+  801591:	85 c0                	test   %eax,%eax
+  801593:	78 1a                	js     8015af <fd_close+0x77>
+		if (dev->dev_close)
+  801595:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801598:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80159b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8015a0:	85 c0                	test   %eax,%eax
+  8015a2:	74 0b                	je     8015af <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8015a4:	83 ec 0c             	sub    $0xc,%esp
+  8015a7:	56                   	push   %esi
+  8015a8:	ff d0                	call   *%eax
+  8015aa:	89 c3                	mov    %eax,%ebx
+  8015ac:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8015af:	83 ec 08             	sub    $0x8,%esp
+  8015b2:	56                   	push   %esi
+  8015b3:	6a 00                	push   $0x0
+  8015b5:	e8 d5 f7 ff ff       	call   800d8f <sys_page_unmap>
+	return r;
+  8015ba:	83 c4 10             	add    $0x10,%esp
+  8015bd:	eb b5                	jmp    801574 <fd_close+0x3c>
+
+008015bf <close>:
+
+int
+close(int fdnum)
+{
+  8015bf:	55                   	push   %ebp
+  8015c0:	89 e5                	mov    %esp,%ebp
+  8015c2:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015c8:	50                   	push   %eax
+  8015c9:	ff 75 08             	push   0x8(%ebp)
+  8015cc:	e8 c4 fe ff ff       	call   801495 <fd_lookup>
+  8015d1:	83 c4 10             	add    $0x10,%esp
+  8015d4:	85 c0                	test   %eax,%eax
+  8015d6:	79 02                	jns    8015da <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8015d8:	c9                   	leave
+  8015d9:	c3                   	ret
+		return fd_close(fd, 1);
+  8015da:	83 ec 08             	sub    $0x8,%esp
+  8015dd:	6a 01                	push   $0x1
+  8015df:	ff 75 f4             	push   -0xc(%ebp)
+  8015e2:	e8 51 ff ff ff       	call   801538 <fd_close>
+  8015e7:	83 c4 10             	add    $0x10,%esp
+  8015ea:	eb ec                	jmp    8015d8 <close+0x19>
+
+008015ec <close_all>:
+
+void
+close_all(void)
+{
+  8015ec:	55                   	push   %ebp
+  8015ed:	89 e5                	mov    %esp,%ebp
+  8015ef:	53                   	push   %ebx
+  8015f0:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8015f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8015f8:	83 ec 0c             	sub    $0xc,%esp
+  8015fb:	53                   	push   %ebx
+  8015fc:	e8 be ff ff ff       	call   8015bf <close>
+	for (i = 0; i < MAXFD; i++)
+  801601:	83 c3 01             	add    $0x1,%ebx
+  801604:	83 c4 10             	add    $0x10,%esp
+  801607:	83 fb 20             	cmp    $0x20,%ebx
+  80160a:	75 ec                	jne    8015f8 <close_all+0xc>
+}
+  80160c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80160f:	c9                   	leave
+  801610:	c3                   	ret
+
+00801611 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801611:	55                   	push   %ebp
+  801612:	89 e5                	mov    %esp,%ebp
+  801614:	57                   	push   %edi
+  801615:	56                   	push   %esi
+  801616:	53                   	push   %ebx
+  801617:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80161a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80161d:	50                   	push   %eax
+  80161e:	ff 75 08             	push   0x8(%ebp)
+  801621:	e8 6f fe ff ff       	call   801495 <fd_lookup>
+  801626:	89 c3                	mov    %eax,%ebx
+  801628:	83 c4 10             	add    $0x10,%esp
+  80162b:	85 c0                	test   %eax,%eax
+  80162d:	78 7f                	js     8016ae <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80162f:	83 ec 0c             	sub    $0xc,%esp
+  801632:	ff 75 0c             	push   0xc(%ebp)
+  801635:	e8 85 ff ff ff       	call   8015bf <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80163a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80163d:	c1 e6 0c             	shl    $0xc,%esi
+  801640:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801646:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801649:	89 3c 24             	mov    %edi,(%esp)
+  80164c:	e8 d7 fd ff ff       	call   801428 <fd2data>
+  801651:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801653:	89 34 24             	mov    %esi,(%esp)
+  801656:	e8 cd fd ff ff       	call   801428 <fd2data>
+  80165b:	83 c4 10             	add    $0x10,%esp
+  80165e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801661:	89 d8                	mov    %ebx,%eax
+  801663:	c1 e8 16             	shr    $0x16,%eax
+  801666:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80166d:	a8 01                	test   $0x1,%al
+  80166f:	74 11                	je     801682 <dup+0x71>
+  801671:	89 d8                	mov    %ebx,%eax
+  801673:	c1 e8 0c             	shr    $0xc,%eax
+  801676:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80167d:	f6 c2 01             	test   $0x1,%dl
+  801680:	75 36                	jne    8016b8 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801682:	89 f8                	mov    %edi,%eax
+  801684:	c1 e8 0c             	shr    $0xc,%eax
+  801687:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80168e:	83 ec 0c             	sub    $0xc,%esp
+  801691:	25 07 0e 00 00       	and    $0xe07,%eax
+  801696:	50                   	push   %eax
+  801697:	56                   	push   %esi
+  801698:	6a 00                	push   $0x0
+  80169a:	57                   	push   %edi
+  80169b:	6a 00                	push   $0x0
+  80169d:	e8 ab f6 ff ff       	call   800d4d <sys_page_map>
+  8016a2:	89 c3                	mov    %eax,%ebx
+  8016a4:	83 c4 20             	add    $0x20,%esp
+  8016a7:	85 c0                	test   %eax,%eax
+  8016a9:	78 33                	js     8016de <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8016ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8016ae:	89 d8                	mov    %ebx,%eax
+  8016b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b3:	5b                   	pop    %ebx
+  8016b4:	5e                   	pop    %esi
+  8016b5:	5f                   	pop    %edi
+  8016b6:	5d                   	pop    %ebp
+  8016b7:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8016b8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016bf:	83 ec 0c             	sub    $0xc,%esp
+  8016c2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016c7:	50                   	push   %eax
+  8016c8:	ff 75 d4             	push   -0x2c(%ebp)
+  8016cb:	6a 00                	push   $0x0
+  8016cd:	53                   	push   %ebx
+  8016ce:	6a 00                	push   $0x0
+  8016d0:	e8 78 f6 ff ff       	call   800d4d <sys_page_map>
+  8016d5:	89 c3                	mov    %eax,%ebx
+  8016d7:	83 c4 20             	add    $0x20,%esp
+  8016da:	85 c0                	test   %eax,%eax
+  8016dc:	79 a4                	jns    801682 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8016de:	83 ec 08             	sub    $0x8,%esp
+  8016e1:	56                   	push   %esi
+  8016e2:	6a 00                	push   $0x0
+  8016e4:	e8 a6 f6 ff ff       	call   800d8f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8016e9:	83 c4 08             	add    $0x8,%esp
+  8016ec:	ff 75 d4             	push   -0x2c(%ebp)
+  8016ef:	6a 00                	push   $0x0
+  8016f1:	e8 99 f6 ff ff       	call   800d8f <sys_page_unmap>
+	return r;
+  8016f6:	83 c4 10             	add    $0x10,%esp
+  8016f9:	eb b3                	jmp    8016ae <dup+0x9d>
+
+008016fb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016fb:	55                   	push   %ebp
+  8016fc:	89 e5                	mov    %esp,%ebp
+  8016fe:	56                   	push   %esi
+  8016ff:	53                   	push   %ebx
+  801700:	83 ec 18             	sub    $0x18,%esp
+  801703:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801706:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801709:	50                   	push   %eax
+  80170a:	56                   	push   %esi
+  80170b:	e8 85 fd ff ff       	call   801495 <fd_lookup>
+  801710:	83 c4 10             	add    $0x10,%esp
+  801713:	85 c0                	test   %eax,%eax
+  801715:	78 3c                	js     801753 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801717:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80171a:	83 ec 08             	sub    $0x8,%esp
+  80171d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801720:	50                   	push   %eax
+  801721:	ff 33                	push   (%ebx)
+  801723:	e8 bd fd ff ff       	call   8014e5 <dev_lookup>
+  801728:	83 c4 10             	add    $0x10,%esp
+  80172b:	85 c0                	test   %eax,%eax
+  80172d:	78 24                	js     801753 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80172f:	8b 43 08             	mov    0x8(%ebx),%eax
+  801732:	83 e0 03             	and    $0x3,%eax
+  801735:	83 f8 01             	cmp    $0x1,%eax
+  801738:	74 20                	je     80175a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80173a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80173d:	8b 40 08             	mov    0x8(%eax),%eax
+  801740:	85 c0                	test   %eax,%eax
+  801742:	74 37                	je     80177b <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801744:	83 ec 04             	sub    $0x4,%esp
+  801747:	ff 75 10             	push   0x10(%ebp)
+  80174a:	ff 75 0c             	push   0xc(%ebp)
+  80174d:	53                   	push   %ebx
+  80174e:	ff d0                	call   *%eax
+  801750:	83 c4 10             	add    $0x10,%esp
+}
+  801753:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801756:	5b                   	pop    %ebx
+  801757:	5e                   	pop    %esi
+  801758:	5d                   	pop    %ebp
+  801759:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80175a:	a1 00 64 80 00       	mov    0x806400,%eax
+  80175f:	8b 40 48             	mov    0x48(%eax),%eax
+  801762:	83 ec 04             	sub    $0x4,%esp
+  801765:	56                   	push   %esi
+  801766:	50                   	push   %eax
+  801767:	68 c5 3e 80 00       	push   $0x803ec5
+  80176c:	e8 97 eb ff ff       	call   800308 <cprintf>
+		return -E_INVAL;
+  801771:	83 c4 10             	add    $0x10,%esp
+  801774:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801779:	eb d8                	jmp    801753 <read+0x58>
+		return -E_NOT_SUPP;
+  80177b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801780:	eb d1                	jmp    801753 <read+0x58>
+
+00801782 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801782:	55                   	push   %ebp
+  801783:	89 e5                	mov    %esp,%ebp
+  801785:	57                   	push   %edi
+  801786:	56                   	push   %esi
+  801787:	53                   	push   %ebx
+  801788:	83 ec 0c             	sub    $0xc,%esp
+  80178b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80178e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801791:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801796:	eb 02                	jmp    80179a <readn+0x18>
+  801798:	01 c3                	add    %eax,%ebx
+  80179a:	39 f3                	cmp    %esi,%ebx
+  80179c:	73 21                	jae    8017bf <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80179e:	83 ec 04             	sub    $0x4,%esp
+  8017a1:	89 f0                	mov    %esi,%eax
+  8017a3:	29 d8                	sub    %ebx,%eax
+  8017a5:	50                   	push   %eax
+  8017a6:	89 d8                	mov    %ebx,%eax
+  8017a8:	03 45 0c             	add    0xc(%ebp),%eax
+  8017ab:	50                   	push   %eax
+  8017ac:	57                   	push   %edi
+  8017ad:	e8 49 ff ff ff       	call   8016fb <read>
+		if (m < 0)
+  8017b2:	83 c4 10             	add    $0x10,%esp
+  8017b5:	85 c0                	test   %eax,%eax
+  8017b7:	78 04                	js     8017bd <readn+0x3b>
+			return m;
+		if (m == 0)
+  8017b9:	75 dd                	jne    801798 <readn+0x16>
+  8017bb:	eb 02                	jmp    8017bf <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017bd:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8017bf:	89 d8                	mov    %ebx,%eax
+  8017c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c4:	5b                   	pop    %ebx
+  8017c5:	5e                   	pop    %esi
+  8017c6:	5f                   	pop    %edi
+  8017c7:	5d                   	pop    %ebp
+  8017c8:	c3                   	ret
+
+008017c9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8017c9:	55                   	push   %ebp
+  8017ca:	89 e5                	mov    %esp,%ebp
+  8017cc:	56                   	push   %esi
+  8017cd:	53                   	push   %ebx
+  8017ce:	83 ec 18             	sub    $0x18,%esp
+  8017d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017d4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017d7:	50                   	push   %eax
+  8017d8:	53                   	push   %ebx
+  8017d9:	e8 b7 fc ff ff       	call   801495 <fd_lookup>
+  8017de:	83 c4 10             	add    $0x10,%esp
+  8017e1:	85 c0                	test   %eax,%eax
+  8017e3:	78 37                	js     80181c <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017e5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017e8:	83 ec 08             	sub    $0x8,%esp
+  8017eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017ee:	50                   	push   %eax
+  8017ef:	ff 36                	push   (%esi)
+  8017f1:	e8 ef fc ff ff       	call   8014e5 <dev_lookup>
+  8017f6:	83 c4 10             	add    $0x10,%esp
+  8017f9:	85 c0                	test   %eax,%eax
+  8017fb:	78 1f                	js     80181c <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017fd:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801801:	74 20                	je     801823 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801803:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801806:	8b 40 0c             	mov    0xc(%eax),%eax
+  801809:	85 c0                	test   %eax,%eax
+  80180b:	74 37                	je     801844 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80180d:	83 ec 04             	sub    $0x4,%esp
+  801810:	ff 75 10             	push   0x10(%ebp)
+  801813:	ff 75 0c             	push   0xc(%ebp)
+  801816:	56                   	push   %esi
+  801817:	ff d0                	call   *%eax
+  801819:	83 c4 10             	add    $0x10,%esp
+}
+  80181c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80181f:	5b                   	pop    %ebx
+  801820:	5e                   	pop    %esi
+  801821:	5d                   	pop    %ebp
+  801822:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801823:	a1 00 64 80 00       	mov    0x806400,%eax
+  801828:	8b 40 48             	mov    0x48(%eax),%eax
+  80182b:	83 ec 04             	sub    $0x4,%esp
+  80182e:	53                   	push   %ebx
+  80182f:	50                   	push   %eax
+  801830:	68 e1 3e 80 00       	push   $0x803ee1
+  801835:	e8 ce ea ff ff       	call   800308 <cprintf>
+		return -E_INVAL;
+  80183a:	83 c4 10             	add    $0x10,%esp
+  80183d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801842:	eb d8                	jmp    80181c <write+0x53>
+		return -E_NOT_SUPP;
+  801844:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801849:	eb d1                	jmp    80181c <write+0x53>
+
+0080184b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80184b:	55                   	push   %ebp
+  80184c:	89 e5                	mov    %esp,%ebp
+  80184e:	53                   	push   %ebx
+  80184f:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801852:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801855:	50                   	push   %eax
+  801856:	ff 75 08             	push   0x8(%ebp)
+  801859:	e8 37 fc ff ff       	call   801495 <fd_lookup>
+  80185e:	83 c4 10             	add    $0x10,%esp
+  801861:	85 c0                	test   %eax,%eax
+  801863:	78 3a                	js     80189f <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801865:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801868:	83 ec 08             	sub    $0x8,%esp
+  80186b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80186e:	50                   	push   %eax
+  80186f:	ff 33                	push   (%ebx)
+  801871:	e8 6f fc ff ff       	call   8014e5 <dev_lookup>
+  801876:	83 c4 10             	add    $0x10,%esp
+  801879:	85 c0                	test   %eax,%eax
+  80187b:	78 22                	js     80189f <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  80187d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801880:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801883:	85 c0                	test   %eax,%eax
+  801885:	74 0d                	je     801894 <seek+0x49>
+  801887:	83 ec 0c             	sub    $0xc,%esp
+  80188a:	53                   	push   %ebx
+  80188b:	ff d0                	call   *%eax
+  80188d:	83 c4 10             	add    $0x10,%esp
+  801890:	85 c0                	test   %eax,%eax
+  801892:	78 0b                	js     80189f <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801894:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801897:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  80189a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80189f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018a2:	c9                   	leave
+  8018a3:	c3                   	ret
+
+008018a4 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8018a4:	55                   	push   %ebp
+  8018a5:	89 e5                	mov    %esp,%ebp
+  8018a7:	53                   	push   %ebx
+  8018a8:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018ab:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018ae:	50                   	push   %eax
+  8018af:	ff 75 08             	push   0x8(%ebp)
+  8018b2:	e8 de fb ff ff       	call   801495 <fd_lookup>
+  8018b7:	83 c4 10             	add    $0x10,%esp
+  8018ba:	85 c0                	test   %eax,%eax
+  8018bc:	78 2b                	js     8018e9 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018be:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8018c1:	83 ec 08             	sub    $0x8,%esp
+  8018c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c7:	50                   	push   %eax
+  8018c8:	ff 33                	push   (%ebx)
+  8018ca:	e8 16 fc ff ff       	call   8014e5 <dev_lookup>
+  8018cf:	83 c4 10             	add    $0x10,%esp
+  8018d2:	85 c0                	test   %eax,%eax
+  8018d4:	78 13                	js     8018e9 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8018d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018d9:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8018dc:	85 c0                	test   %eax,%eax
+  8018de:	74 0e                	je     8018ee <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8018e0:	83 ec 0c             	sub    $0xc,%esp
+  8018e3:	53                   	push   %ebx
+  8018e4:	ff d0                	call   *%eax
+  8018e6:	83 c4 10             	add    $0x10,%esp
+}
+  8018e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ec:	c9                   	leave
+  8018ed:	c3                   	ret
+		return 0;
+  8018ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f3:	eb f4                	jmp    8018e9 <fsync+0x45>
+
+008018f5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018f5:	55                   	push   %ebp
+  8018f6:	89 e5                	mov    %esp,%ebp
+  8018f8:	56                   	push   %esi
+  8018f9:	53                   	push   %ebx
+  8018fa:	83 ec 18             	sub    $0x18,%esp
+  8018fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801900:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801903:	50                   	push   %eax
+  801904:	53                   	push   %ebx
+  801905:	e8 8b fb ff ff       	call   801495 <fd_lookup>
+  80190a:	83 c4 10             	add    $0x10,%esp
+  80190d:	85 c0                	test   %eax,%eax
+  80190f:	78 34                	js     801945 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801911:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801914:	83 ec 08             	sub    $0x8,%esp
+  801917:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80191a:	50                   	push   %eax
+  80191b:	ff 36                	push   (%esi)
+  80191d:	e8 c3 fb ff ff       	call   8014e5 <dev_lookup>
+  801922:	83 c4 10             	add    $0x10,%esp
+  801925:	85 c0                	test   %eax,%eax
+  801927:	78 1c                	js     801945 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801929:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80192d:	74 1d                	je     80194c <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80192f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801932:	8b 40 18             	mov    0x18(%eax),%eax
+  801935:	85 c0                	test   %eax,%eax
+  801937:	74 34                	je     80196d <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801939:	83 ec 08             	sub    $0x8,%esp
+  80193c:	ff 75 0c             	push   0xc(%ebp)
+  80193f:	56                   	push   %esi
+  801940:	ff d0                	call   *%eax
+  801942:	83 c4 10             	add    $0x10,%esp
+}
+  801945:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801948:	5b                   	pop    %ebx
+  801949:	5e                   	pop    %esi
+  80194a:	5d                   	pop    %ebp
+  80194b:	c3                   	ret
+			thisenv->env_id, fdnum);
+  80194c:	a1 00 64 80 00       	mov    0x806400,%eax
+  801951:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801954:	83 ec 04             	sub    $0x4,%esp
+  801957:	53                   	push   %ebx
+  801958:	50                   	push   %eax
+  801959:	68 a4 3e 80 00       	push   $0x803ea4
+  80195e:	e8 a5 e9 ff ff       	call   800308 <cprintf>
+		return -E_INVAL;
+  801963:	83 c4 10             	add    $0x10,%esp
+  801966:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80196b:	eb d8                	jmp    801945 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80196d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801972:	eb d1                	jmp    801945 <ftruncate+0x50>
+
+00801974 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801974:	55                   	push   %ebp
+  801975:	89 e5                	mov    %esp,%ebp
+  801977:	56                   	push   %esi
+  801978:	53                   	push   %ebx
+  801979:	83 ec 18             	sub    $0x18,%esp
+  80197c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80197f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801982:	50                   	push   %eax
+  801983:	ff 75 08             	push   0x8(%ebp)
+  801986:	e8 0a fb ff ff       	call   801495 <fd_lookup>
+  80198b:	83 c4 10             	add    $0x10,%esp
+  80198e:	85 c0                	test   %eax,%eax
+  801990:	78 49                	js     8019db <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801992:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801995:	83 ec 08             	sub    $0x8,%esp
+  801998:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80199b:	50                   	push   %eax
+  80199c:	ff 36                	push   (%esi)
+  80199e:	e8 42 fb ff ff       	call   8014e5 <dev_lookup>
+  8019a3:	83 c4 10             	add    $0x10,%esp
+  8019a6:	85 c0                	test   %eax,%eax
+  8019a8:	78 31                	js     8019db <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8019aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019ad:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8019b1:	74 2f                	je     8019e2 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8019b3:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8019b6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8019bd:	00 00 00 
+	stat->st_isdir = 0;
+  8019c0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8019c7:	00 00 00 
+	stat->st_dev = dev;
+  8019ca:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8019d0:	83 ec 08             	sub    $0x8,%esp
+  8019d3:	53                   	push   %ebx
+  8019d4:	56                   	push   %esi
+  8019d5:	ff 50 14             	call   *0x14(%eax)
+  8019d8:	83 c4 10             	add    $0x10,%esp
+}
+  8019db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019de:	5b                   	pop    %ebx
+  8019df:	5e                   	pop    %esi
+  8019e0:	5d                   	pop    %ebp
+  8019e1:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019e2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019e7:	eb f2                	jmp    8019db <fstat+0x67>
+
+008019e9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8019e9:	55                   	push   %ebp
+  8019ea:	89 e5                	mov    %esp,%ebp
+  8019ec:	56                   	push   %esi
+  8019ed:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  8019ee:	83 ec 08             	sub    $0x8,%esp
+  8019f1:	68 00 10 00 00       	push   $0x1000
+  8019f6:	ff 75 08             	push   0x8(%ebp)
+  8019f9:	e8 b3 07 00 00       	call   8021b1 <open>
+  8019fe:	89 c3                	mov    %eax,%ebx
+  801a00:	83 c4 10             	add    $0x10,%esp
+  801a03:	85 c0                	test   %eax,%eax
+  801a05:	78 1b                	js     801a22 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801a07:	83 ec 08             	sub    $0x8,%esp
+  801a0a:	ff 75 0c             	push   0xc(%ebp)
+  801a0d:	50                   	push   %eax
+  801a0e:	e8 61 ff ff ff       	call   801974 <fstat>
+  801a13:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a15:	89 1c 24             	mov    %ebx,(%esp)
+  801a18:	e8 a2 fb ff ff       	call   8015bf <close>
+	return r;
+  801a1d:	83 c4 10             	add    $0x10,%esp
+  801a20:	89 f3                	mov    %esi,%ebx
+}
+  801a22:	89 d8                	mov    %ebx,%eax
+  801a24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a27:	5b                   	pop    %ebx
+  801a28:	5e                   	pop    %esi
+  801a29:	5d                   	pop    %ebp
+  801a2a:	c3                   	ret
+
+00801a2b <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801a2b:	55                   	push   %ebp
+  801a2c:	89 e5                	mov    %esp,%ebp
+  801a2e:	57                   	push   %edi
+  801a2f:	56                   	push   %esi
+  801a30:	53                   	push   %ebx
+  801a31:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801a37:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801a3d:	89 d6                	mov    %edx,%esi
+  801a3f:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801a45:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801a48:	89 d3                	mov    %edx,%ebx
+  801a4a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801a50:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801a57:	74 1d                	je     801a76 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a59:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801a5e:	83 c8 07             	or     $0x7,%eax
+  801a61:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801a67:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801a6c:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801a72:	01 ce                	add    %ecx,%esi
+  801a74:	eb 28                	jmp    801a9e <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a76:	83 ec 0c             	sub    $0xc,%esp
+  801a79:	6a 01                	push   $0x1
+  801a7b:	e8 e2 1b 00 00       	call   803662 <ipc_find_env>
+  801a80:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801a85:	83 c4 10             	add    $0x10,%esp
+  801a88:	eb cf                	jmp    801a59 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801a8a:	83 c0 01             	add    $0x1,%eax
+  801a8d:	89 fa                	mov    %edi,%edx
+  801a8f:	09 da                	or     %ebx,%edx
+  801a91:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801a98:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a9e:	39 f3                	cmp    %esi,%ebx
+  801aa0:	72 e8                	jb     801a8a <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801aa2:	83 f8 41             	cmp    $0x41,%eax
+  801aa5:	77 2f                	ja     801ad6 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801aa7:	50                   	push   %eax
+  801aa8:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801aae:	50                   	push   %eax
+  801aaf:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801ab5:	ff 35 c8 80 80 00    	push   0x8080c8
+  801abb:	e8 54 1b 00 00       	call   803614 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801ac0:	83 c4 0c             	add    $0xc,%esp
+  801ac3:	6a 00                	push   $0x0
+  801ac5:	6a 00                	push   $0x0
+  801ac7:	6a 00                	push   $0x0
+  801ac9:	e8 f0 19 00 00       	call   8034be <ipc_recv>
+}
+  801ace:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ad1:	5b                   	pop    %ebx
+  801ad2:	5e                   	pop    %esi
+  801ad3:	5f                   	pop    %edi
+  801ad4:	5d                   	pop    %ebp
+  801ad5:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801ad6:	68 14 3f 80 00       	push   $0x803f14
+  801adb:	68 4c 3e 80 00       	push   $0x803e4c
+  801ae0:	6a 40                	push   $0x40
+  801ae2:	68 30 3f 80 00       	push   $0x803f30
+  801ae7:	e8 41 e7 ff ff       	call   80022d <_panic>
+
+00801aec <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801aec:	55                   	push   %ebp
+  801aed:	89 e5                	mov    %esp,%ebp
+  801aef:	57                   	push   %edi
+  801af0:	56                   	push   %esi
+  801af1:	53                   	push   %ebx
+  801af2:	83 ec 1c             	sub    $0x1c,%esp
+  801af5:	89 c3                	mov    %eax,%ebx
+  801af7:	89 d6                	mov    %edx,%esi
+  801af9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801afc:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801b02:	89 ca                	mov    %ecx,%edx
+  801b04:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801b07:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801b0e:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801b11:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801b18:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b1b:	89 fb                	mov    %edi,%ebx
+  801b1d:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801b24:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b27:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801b2e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b31:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801b38:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b3b:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801b42:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801b45:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801b4c:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801b51:	39 c8                	cmp    %ecx,%eax
+  801b53:	74 0d                	je     801b62 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801b55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b5d:	5b                   	pop    %ebx
+  801b5e:	5e                   	pop    %esi
+  801b5f:	5f                   	pop    %edi
+  801b60:	5d                   	pop    %ebp
+  801b61:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b62:	6a 07                	push   $0x7
+  801b64:	68 00 70 80 00       	push   $0x807000
+  801b69:	6a 0d                	push   $0xd
+  801b6b:	ff 35 c8 80 80 00    	push   0x8080c8
+  801b71:	e8 b3 19 00 00       	call   803529 <ipc_send>
+  801b76:	83 c4 10             	add    $0x10,%esp
+  801b79:	eb da                	jmp    801b55 <fsring_post+0x69>
+
+00801b7b <fsipcv>:
+{
+  801b7b:	55                   	push   %ebp
+  801b7c:	89 e5                	mov    %esp,%ebp
+  801b7e:	57                   	push   %edi
+  801b7f:	56                   	push   %esi
+  801b80:	53                   	push   %ebx
+  801b81:	83 ec 0c             	sub    $0xc,%esp
+  801b84:	89 c7                	mov    %eax,%edi
+  801b86:	89 d3                	mov    %edx,%ebx
+  801b88:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801b8a:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801b91:	74 26                	je     801bb9 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b93:	6a 07                	push   $0x7
+  801b95:	68 00 70 80 00       	push   $0x807000
+  801b9a:	57                   	push   %edi
+  801b9b:	ff 35 c8 80 80 00    	push   0x8080c8
+  801ba1:	e8 83 19 00 00       	call   803529 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801ba6:	6a 00                	push   $0x0
+  801ba8:	56                   	push   %esi
+  801ba9:	53                   	push   %ebx
+  801baa:	6a 00                	push   $0x0
+  801bac:	e8 d0 19 00 00       	call   803581 <ipc_recvv>
+}
+  801bb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bb4:	5b                   	pop    %ebx
+  801bb5:	5e                   	pop    %esi
+  801bb6:	5f                   	pop    %edi
+  801bb7:	5d                   	pop    %ebp
+  801bb8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801bb9:	83 ec 0c             	sub    $0xc,%esp
+  801bbc:	6a 01                	push   $0x1
+  801bbe:	e8 9f 1a 00 00       	call   803662 <ipc_find_env>
+  801bc3:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801bc8:	83 c4 10             	add    $0x10,%esp
+  801bcb:	eb c6                	jmp    801b93 <fsipcv+0x18>
+
+00801bcd <fsipc>:
+{
+  801bcd:	55                   	push   %ebp
+  801bce:	89 e5                	mov    %esp,%ebp
+  801bd0:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801bd3:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801bda:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801bdd:	e8 99 ff ff ff       	call   801b7b <fsipcv>
+}
+  801be2:	c9                   	leave
+  801be3:	c3                   	ret
+
+00801be4 <file_write_direct>:
+{
+  801be4:	55                   	push   %ebp
+  801be5:	89 e5                	mov    %esp,%ebp
+  801be7:	56                   	push   %esi
+  801be8:	53                   	push   %ebx
+  801be9:	89 c3                	mov    %eax,%ebx
+  801beb:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801bed:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801bf3:	77 40                	ja     801c35 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801bf5:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801bfa:	39 c8                	cmp    %ecx,%eax
+  801bfc:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801bff:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801c02:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  801c08:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801c0d:	83 ec 04             	sub    $0x4,%esp
+  801c10:	50                   	push   %eax
+  801c11:	52                   	push   %edx
+  801c12:	68 08 70 80 00       	push   $0x807008
+  801c17:	e8 60 ee ff ff       	call   800a7c <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801c1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c21:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c26:	e8 a2 ff ff ff       	call   801bcd <fsipc>
+  801c2b:	83 c4 10             	add    $0x10,%esp
+}
+  801c2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c31:	5b                   	pop    %ebx
+  801c32:	5e                   	pop    %esi
+  801c33:	5d                   	pop    %ebp
+  801c34:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801c35:	89 d6                	mov    %edx,%esi
+  801c37:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801c3d:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801c42:	29 f1                	sub    %esi,%ecx
+  801c44:	39 c1                	cmp    %eax,%ecx
+  801c46:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801c49:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c4c:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801c51:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801c57:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801c5d:	83 ec 0c             	sub    $0xc,%esp
+  801c60:	6a 05                	push   $0x5
+  801c62:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c67:	e8 bf fd ff ff       	call   801a2b <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801c6c:	83 c4 10             	add    $0x10,%esp
+  801c6f:	eb bd                	jmp    801c2e <file_write_direct+0x4a>
+
+00801c71 <devfile_sync>:
+{
+  801c71:	55                   	push   %ebp
+  801c72:	89 e5                	mov    %esp,%ebp
+  801c74:	57                   	push   %edi
+  801c75:	56                   	push   %esi
+  801c76:	53                   	push   %ebx
+  801c77:	83 ec 28             	sub    $0x28,%esp
+  801c7a:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801c7d:	56                   	push   %esi
+  801c7e:	e8 a5 f7 ff ff       	call   801428 <fd2data>
+  801c83:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801c85:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801c88:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801c8f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c92:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801c97:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801c9b:	74 45                	je     801ce2 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801c9d:	8b 46 14             	mov    0x14(%esi),%eax
+  801ca0:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cad:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801cb0:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801cb3:	39 cb                	cmp    %ecx,%ebx
+  801cb5:	73 14                	jae    801ccb <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801cb7:	29 d9                	sub    %ebx,%ecx
+  801cb9:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801cbc:	89 f0                	mov    %esi,%eax
+  801cbe:	e8 21 ff ff ff       	call   801be4 <file_write_direct>
+  801cc3:	85 c0                	test   %eax,%eax
+  801cc5:	7e 04                	jle    801ccb <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801cc7:	01 c3                	add    %eax,%ebx
+  801cc9:	eb e5                	jmp    801cb0 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801ccb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801cce:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801cd5:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801cd8:	85 c0                	test   %eax,%eax
+  801cda:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cdf:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801ce2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ce5:	5b                   	pop    %ebx
+  801ce6:	5e                   	pop    %esi
+  801ce7:	5f                   	pop    %edi
+  801ce8:	5d                   	pop    %ebp
+  801ce9:	c3                   	ret
+
+00801cea <devfile_write>:
+{
+  801cea:	55                   	push   %ebp
+  801ceb:	89 e5                	mov    %esp,%ebp
+  801ced:	57                   	push   %edi
+  801cee:	56                   	push   %esi
+  801cef:	53                   	push   %ebx
+  801cf0:	83 ec 28             	sub    $0x28,%esp
+  801cf3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801cf6:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801cf9:	53                   	push   %ebx
+  801cfa:	e8 29 f7 ff ff       	call   801428 <fd2data>
+  801cff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801d02:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801d05:	83 c4 10             	add    $0x10,%esp
+  801d08:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801d0c:	74 43                	je     801d51 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801d0e:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801d15:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801d18:	85 c0                	test   %eax,%eax
+  801d1a:	74 43                	je     801d5f <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801d1c:	89 c2                	mov    %eax,%edx
+  801d1e:	03 53 14             	add    0x14(%ebx),%edx
+  801d21:	39 fa                	cmp    %edi,%edx
+  801d23:	75 0b                	jne    801d30 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801d25:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801d28:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801d2e:	76 66                	jbe    801d96 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801d30:	83 ec 0c             	sub    $0xc,%esp
+  801d33:	53                   	push   %ebx
+  801d34:	e8 38 ff ff ff       	call   801c71 <devfile_sync>
+  801d39:	83 c4 10             	add    $0x10,%esp
+  801d3c:	85 c0                	test   %eax,%eax
+  801d3e:	78 4e                	js     801d8e <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801d40:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d46:	77 56                	ja     801d9e <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801d48:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801d4b:	85 c0                	test   %eax,%eax
+  801d4d:	75 20                	jne    801d6f <devfile_write+0x85>
+  801d4f:	eb 16                	jmp    801d67 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801d51:	89 f1                	mov    %esi,%ecx
+  801d53:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d56:	89 d8                	mov    %ebx,%eax
+  801d58:	e8 87 fe ff ff       	call   801be4 <file_write_direct>
+  801d5d:	eb 2f                	jmp    801d8e <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801d5f:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d65:	77 37                	ja     801d9e <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801d67:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801d6a:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801d6f:	83 ec 04             	sub    $0x4,%esp
+  801d72:	56                   	push   %esi
+  801d73:	ff 75 0c             	push   0xc(%ebp)
+  801d76:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d79:	01 c1                	add    %eax,%ecx
+  801d7b:	51                   	push   %ecx
+  801d7c:	e8 fb ec ff ff       	call   800a7c <memmove>
+	ff->buf_wlen += n;
+  801d81:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801d84:	01 f7                	add    %esi,%edi
+  801d86:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801d89:	89 f0                	mov    %esi,%eax
+  801d8b:	83 c4 10             	add    $0x10,%esp
+}
+  801d8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d91:	5b                   	pop    %ebx
+  801d92:	5e                   	pop    %esi
+  801d93:	5f                   	pop    %edi
+  801d94:	5d                   	pop    %ebp
+  801d95:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801d96:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d9c:	76 d1                	jbe    801d6f <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801d9e:	89 f1                	mov    %esi,%ecx
+  801da0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801da3:	89 d8                	mov    %ebx,%eax
+  801da5:	e8 3a fe ff ff       	call   801be4 <file_write_direct>
+  801daa:	eb e2                	jmp    801d8e <devfile_write+0xa4>
+
+00801dac <devfile_trunc>:
+{
+  801dac:	55                   	push   %ebp
+  801dad:	89 e5                	mov    %esp,%ebp
+  801daf:	53                   	push   %ebx
+  801db0:	83 ec 10             	sub    $0x10,%esp
+  801db3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801db6:	53                   	push   %ebx
+  801db7:	e8 b5 fe ff ff       	call   801c71 <devfile_sync>
+  801dbc:	83 c4 10             	add    $0x10,%esp
+  801dbf:	85 c0                	test   %eax,%eax
+  801dc1:	78 1f                	js     801de2 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801dc3:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801dc6:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801dcb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dce:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801dd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd8:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ddd:	e8 eb fd ff ff       	call   801bcd <fsipc>
+}
+  801de2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801de5:	c9                   	leave
+  801de6:	c3                   	ret
+
+00801de7 <devfile_stat>:
+{
+  801de7:	55                   	push   %ebp
+  801de8:	89 e5                	mov    %esp,%ebp
+  801dea:	56                   	push   %esi
+  801deb:	53                   	push   %ebx
+  801dec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801def:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801df2:	83 ec 0c             	sub    $0xc,%esp
+  801df5:	53                   	push   %ebx
+  801df6:	e8 76 fe ff ff       	call   801c71 <devfile_sync>
+  801dfb:	83 c4 10             	add    $0x10,%esp
+  801dfe:	85 c0                	test   %eax,%eax
+  801e00:	78 47                	js     801e49 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e02:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801e05:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e0f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e14:	e8 b4 fd ff ff       	call   801bcd <fsipc>
+  801e19:	85 c0                	test   %eax,%eax
+  801e1b:	78 2c                	js     801e49 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e1d:	83 ec 08             	sub    $0x8,%esp
+  801e20:	68 00 70 80 00       	push   $0x807000
+  801e25:	56                   	push   %esi
+  801e26:	e8 cb ea ff ff       	call   8008f6 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e2b:	a1 80 70 80 00       	mov    0x807080,%eax
+  801e30:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e36:	a1 84 70 80 00       	mov    0x807084,%eax
+  801e3b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801e41:	83 c4 10             	add    $0x10,%esp
+  801e44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e4c:	5b                   	pop    %ebx
+  801e4d:	5e                   	pop    %esi
+  801e4e:	5d                   	pop    %ebp
+  801e4f:	c3                   	ret
+
+00801e50 <devfile_flush>:
+{
+  801e50:	55                   	push   %ebp
+  801e51:	89 e5                	mov    %esp,%ebp
+  801e53:	56                   	push   %esi
+  801e54:	53                   	push   %ebx
+  801e55:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801e58:	83 ec 0c             	sub    $0xc,%esp
+  801e5b:	56                   	push   %esi
+  801e5c:	e8 10 fe ff ff       	call   801c71 <devfile_sync>
+  801e61:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801e63:	83 c4 10             	add    $0x10,%esp
+  801e66:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801e6a:	75 25                	jne    801e91 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e6c:	8b 46 0c             	mov    0xc(%esi),%eax
+  801e6f:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801e74:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e79:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e7e:	e8 4a fd ff ff       	call   801bcd <fsipc>
+  801e83:	85 c0                	test   %eax,%eax
+  801e85:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801e88:	89 d8                	mov    %ebx,%eax
+  801e8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e8d:	5b                   	pop    %ebx
+  801e8e:	5e                   	pop    %esi
+  801e8f:	5d                   	pop    %ebp
+  801e90:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801e91:	83 ec 0c             	sub    $0xc,%esp
+  801e94:	56                   	push   %esi
+  801e95:	e8 8e f5 ff ff       	call   801428 <fd2data>
+  801e9a:	83 c4 08             	add    $0x8,%esp
+  801e9d:	50                   	push   %eax
+  801e9e:	6a 00                	push   $0x0
+  801ea0:	e8 ea ee ff ff       	call   800d8f <sys_page_unmap>
+  801ea5:	83 c4 10             	add    $0x10,%esp
+  801ea8:	eb c2                	jmp    801e6c <devfile_flush+0x1c>
+
+00801eaa <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801eaa:	55                   	push   %ebp
+  801eab:	89 e5                	mov    %esp,%ebp
+  801ead:	57                   	push   %edi
+  801eae:	56                   	push   %esi
+  801eaf:	53                   	push   %ebx
+  801eb0:	83 ec 64             	sub    $0x64,%esp
+  801eb3:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801eb5:	52                   	push   %edx
+  801eb6:	50                   	push   %eax
+  801eb7:	e8 d9 f5 ff ff       	call   801495 <fd_lookup>
+  801ebc:	89 c1                	mov    %eax,%ecx
+  801ebe:	83 c4 10             	add    $0x10,%esp
+  801ec1:	85 c0                	test   %eax,%eax
+  801ec3:	0f 88 f2 00 00 00    	js     801fbb <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801ec9:	8b 07                	mov    (%edi),%eax
+  801ecb:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801ed1:	39 10                	cmp    %edx,(%eax)
+  801ed3:	0f 85 03 01 00 00    	jne    801fdc <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801ed9:	a1 00 64 80 00       	mov    0x806400,%eax
+  801ede:	8b 40 48             	mov    0x48(%eax),%eax
+  801ee1:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  801ee7:	0f 84 96 00 00 00    	je     801f83 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801eed:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801ef4:	0f 84 cb 00 00 00    	je     801fc5 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801efa:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801eff:	83 c8 07             	or     $0x7,%eax
+  801f02:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801f05:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801f08:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801f0d:	83 ec 04             	sub    $0x4,%esp
+  801f10:	68 07 04 00 00       	push   $0x407
+  801f15:	53                   	push   %ebx
+  801f16:	6a 00                	push   $0x0
+  801f18:	e8 e5 ed ff ff       	call   800d02 <sys_page_alloc>
+  801f1d:	89 c1                	mov    %eax,%ecx
+  801f1f:	83 c4 10             	add    $0x10,%esp
+  801f22:	85 c0                	test   %eax,%eax
+  801f24:	0f 88 91 00 00 00    	js     801fbb <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801f2a:	89 d8                	mov    %ebx,%eax
+  801f2c:	83 c8 07             	or     $0x7,%eax
+  801f2f:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801f31:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f37:	83 c6 04             	add    $0x4,%esi
+  801f3a:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801f40:	75 cb                	jne    801f0d <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801f42:	6a 12                	push   $0x12
+  801f44:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801f47:	50                   	push   %eax
+  801f48:	6a 0c                	push   $0xc
+  801f4a:	ff 35 c8 80 80 00    	push   0x8080c8
+  801f50:	e8 bf 16 00 00       	call   803614 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801f55:	83 c4 0c             	add    $0xc,%esp
+  801f58:	6a 00                	push   $0x0
+  801f5a:	6a 00                	push   $0x0
+  801f5c:	6a 00                	push   $0x0
+  801f5e:	e8 5b 15 00 00       	call   8034be <ipc_recv>
+  801f63:	89 c1                	mov    %eax,%ecx
+  801f65:	83 c4 10             	add    $0x10,%esp
+  801f68:	85 c0                	test   %eax,%eax
+  801f6a:	78 4f                	js     801fbb <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801f6c:	a1 00 64 80 00       	mov    0x806400,%eax
+  801f71:	8b 40 48             	mov    0x48(%eax),%eax
+  801f74:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  801f79:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  801f80:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801f83:	83 ec 0c             	sub    $0xc,%esp
+  801f86:	ff 37                	push   (%edi)
+  801f88:	e8 e4 fc ff ff       	call   801c71 <devfile_sync>
+  801f8d:	89 c1                	mov    %eax,%ecx
+  801f8f:	83 c4 10             	add    $0x10,%esp
+  801f92:	85 c0                	test   %eax,%eax
+  801f94:	78 25                	js     801fbb <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801f96:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801f9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801fa1:	ba 01 00 00 00       	mov    $0x1,%edx
+  801fa6:	89 d0                	mov    %edx,%eax
+  801fa8:	d3 e0                	shl    %cl,%eax
+  801faa:	85 d8                	test   %ebx,%eax
+  801fac:	74 0d                	je     801fbb <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801fae:	83 c1 01             	add    $0x1,%ecx
+  801fb1:	83 f9 10             	cmp    $0x10,%ecx
+  801fb4:	75 f0                	jne    801fa6 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801fb6:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801fbb:	89 c8                	mov    %ecx,%eax
+  801fbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc0:	5b                   	pop    %ebx
+  801fc1:	5e                   	pop    %esi
+  801fc2:	5f                   	pop    %edi
+  801fc3:	5d                   	pop    %ebp
+  801fc4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fc5:	83 ec 0c             	sub    $0xc,%esp
+  801fc8:	6a 01                	push   $0x1
+  801fca:	e8 93 16 00 00       	call   803662 <ipc_find_env>
+  801fcf:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801fd4:	83 c4 10             	add    $0x10,%esp
+  801fd7:	e9 1e ff ff ff       	jmp    801efa <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801fdc:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801fe1:	eb d8                	jmp    801fbb <fsring_slot+0x111>
+
+00801fe3 <file_read_direct>:
+{
+  801fe3:	55                   	push   %ebp
+  801fe4:	89 e5                	mov    %esp,%ebp
+  801fe6:	57                   	push   %edi
+  801fe7:	56                   	push   %esi
+  801fe8:	53                   	push   %ebx
+  801fe9:	83 ec 1c             	sub    $0x1c,%esp
+  801fec:	89 c7                	mov    %eax,%edi
+  801fee:	89 d6                	mov    %edx,%esi
+  801ff0:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801ff2:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801ff8:	77 52                	ja     80204c <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ffa:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ffd:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802002:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802008:	ba 00 00 00 00       	mov    $0x0,%edx
+  80200d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802012:	e8 b6 fb ff ff       	call   801bcd <fsipc>
+  802017:	89 c7                	mov    %eax,%edi
+  802019:	85 c0                	test   %eax,%eax
+  80201b:	78 25                	js     802042 <file_read_direct+0x5f>
+	assert(r <= n);
+  80201d:	39 c3                	cmp    %eax,%ebx
+  80201f:	0f 82 87 00 00 00    	jb     8020ac <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  802025:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80202a:	0f 8f 95 00 00 00    	jg     8020c5 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802030:	83 ec 04             	sub    $0x4,%esp
+  802033:	50                   	push   %eax
+  802034:	68 00 70 80 00       	push   $0x807000
+  802039:	56                   	push   %esi
+  80203a:	e8 3d ea ff ff       	call   800a7c <memmove>
+	return r;
+  80203f:	83 c4 10             	add    $0x10,%esp
+}
+  802042:	89 f8                	mov    %edi,%eax
+  802044:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802047:	5b                   	pop    %ebx
+  802048:	5e                   	pop    %esi
+  802049:	5f                   	pop    %edi
+  80204a:	5d                   	pop    %ebp
+  80204b:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80204c:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802052:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802057:	29 d1                	sub    %edx,%ecx
+  802059:	39 d9                	cmp    %ebx,%ecx
+  80205b:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80205e:	89 f0                	mov    %esi,%eax
+  802060:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  802063:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802066:	eb 0f                	jmp    802077 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  802068:	0f b6 10             	movzbl (%eax),%edx
+  80206b:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80206d:	05 00 10 00 00       	add    $0x1000,%eax
+  802072:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802077:	39 c8                	cmp    %ecx,%eax
+  802079:	72 ed                	jb     802068 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  80207b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80207e:	8b 47 0c             	mov    0xc(%edi),%eax
+  802081:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  802086:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  80208c:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  802092:	83 ec 0c             	sub    $0xc,%esp
+  802095:	6a 07                	push   $0x7
+  802097:	89 d9                	mov    %ebx,%ecx
+  802099:	89 f2                	mov    %esi,%edx
+  80209b:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020a0:	e8 86 f9 ff ff       	call   801a2b <fsipc_pages>
+  8020a5:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  8020a7:	83 c4 10             	add    $0x10,%esp
+  8020aa:	eb 96                	jmp    802042 <file_read_direct+0x5f>
+	assert(r <= n);
+  8020ac:	68 3b 3f 80 00       	push   $0x803f3b
+  8020b1:	68 4c 3e 80 00       	push   $0x803e4c
+  8020b6:	68 dc 00 00 00       	push   $0xdc
+  8020bb:	68 30 3f 80 00       	push   $0x803f30
+  8020c0:	e8 68 e1 ff ff       	call   80022d <_panic>
+	assert(r <= PGSIZE);
+  8020c5:	68 4c 3f 80 00       	push   $0x803f4c
+  8020ca:	68 4c 3e 80 00       	push   $0x803e4c
+  8020cf:	68 dd 00 00 00       	push   $0xdd
+  8020d4:	68 30 3f 80 00       	push   $0x803f30
+  8020d9:	e8 4f e1 ff ff       	call   80022d <_panic>
+
+008020de <devfile_read>:
+{
+  8020de:	55                   	push   %ebp
+  8020df:	89 e5                	mov    %esp,%ebp
+  8020e1:	57                   	push   %edi
+  8020e2:	56                   	push   %esi
+  8020e3:	53                   	push   %ebx
+  8020e4:	83 ec 28             	sub    $0x28,%esp
+  8020e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020ea:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8020ed:	53                   	push   %ebx
+  8020ee:	e8 35 f3 ff ff       	call   801428 <fd2data>
+  8020f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8020f6:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8020f9:	83 c4 10             	add    $0x10,%esp
+  8020fc:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  802100:	74 7d                	je     80217f <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802102:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802106:	0f 85 81 00 00 00    	jne    80218d <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  80210c:	8b 43 18             	mov    0x18(%ebx),%eax
+  80210f:	85 c0                	test   %eax,%eax
+  802111:	74 0d                	je     802120 <devfile_read+0x42>
+  802113:	8b 53 14             	mov    0x14(%ebx),%edx
+  802116:	39 fa                	cmp    %edi,%edx
+  802118:	7f 06                	jg     802120 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  80211a:	01 c2                	add    %eax,%edx
+  80211c:	39 d7                	cmp    %edx,%edi
+  80211e:	72 28                	jb     802148 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  802120:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  802127:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80212d:	77 74                	ja     8021a3 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  80212f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802134:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802137:	89 d8                	mov    %ebx,%eax
+  802139:	e8 a5 fe ff ff       	call   801fe3 <file_read_direct>
+  80213e:	85 c0                	test   %eax,%eax
+  802140:	7e 35                	jle    802177 <devfile_read+0x99>
+		ff->buf_base = pos;
+  802142:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  802145:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  802148:	8b 53 14             	mov    0x14(%ebx),%edx
+  80214b:	89 d0                	mov    %edx,%eax
+  80214d:	03 43 18             	add    0x18(%ebx),%eax
+  802150:	29 f8                	sub    %edi,%eax
+  802152:	39 f0                	cmp    %esi,%eax
+  802154:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  802157:	83 ec 04             	sub    $0x4,%esp
+  80215a:	56                   	push   %esi
+  80215b:	89 f8                	mov    %edi,%eax
+  80215d:	29 d0                	sub    %edx,%eax
+  80215f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802162:	01 c1                	add    %eax,%ecx
+  802164:	51                   	push   %ecx
+  802165:	ff 75 0c             	push   0xc(%ebp)
+  802168:	e8 0f e9 ff ff       	call   800a7c <memmove>
+	fd->fd_offset = pos + n;
+  80216d:	01 f7                	add    %esi,%edi
+  80216f:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802172:	89 f0                	mov    %esi,%eax
+  802174:	83 c4 10             	add    $0x10,%esp
+}
+  802177:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80217a:	5b                   	pop    %ebx
+  80217b:	5e                   	pop    %esi
+  80217c:	5f                   	pop    %edi
+  80217d:	5d                   	pop    %ebp
+  80217e:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  80217f:	89 f1                	mov    %esi,%ecx
+  802181:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802184:	89 d8                	mov    %ebx,%eax
+  802186:	e8 58 fe ff ff       	call   801fe3 <file_read_direct>
+  80218b:	eb ea                	jmp    802177 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80218d:	83 ec 0c             	sub    $0xc,%esp
+  802190:	53                   	push   %ebx
+  802191:	e8 db fa ff ff       	call   801c71 <devfile_sync>
+  802196:	83 c4 10             	add    $0x10,%esp
+  802199:	85 c0                	test   %eax,%eax
+  80219b:	0f 89 6b ff ff ff    	jns    80210c <devfile_read+0x2e>
+  8021a1:	eb d4                	jmp    802177 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  8021a3:	89 f1                	mov    %esi,%ecx
+  8021a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021a8:	89 d8                	mov    %ebx,%eax
+  8021aa:	e8 34 fe ff ff       	call   801fe3 <file_read_direct>
+  8021af:	eb c6                	jmp    802177 <devfile_read+0x99>
+
+008021b1 <open>:
+{
+  8021b1:	55                   	push   %ebp
+  8021b2:	89 e5                	mov    %esp,%ebp
+  8021b4:	56                   	push   %esi
+  8021b5:	53                   	push   %ebx
+  8021b6:	83 ec 1c             	sub    $0x1c,%esp
+  8021b9:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8021bc:	56                   	push   %esi
+  8021bd:	e8 f9 e6 ff ff       	call   8008bb <strlen>
+  8021c2:	83 c4 10             	add    $0x10,%esp
+  8021c5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021ca:	0f 8f a0 00 00 00    	jg     802270 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  8021d0:	83 ec 0c             	sub    $0xc,%esp
+  8021d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021d6:	50                   	push   %eax
+  8021d7:	e8 63 f2 ff ff       	call   80143f <fd_alloc>
+  8021dc:	89 c3                	mov    %eax,%ebx
+  8021de:	83 c4 10             	add    $0x10,%esp
+  8021e1:	85 c0                	test   %eax,%eax
+  8021e3:	78 45                	js     80222a <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  8021e5:	83 ec 08             	sub    $0x8,%esp
+  8021e8:	56                   	push   %esi
+  8021e9:	68 00 70 80 00       	push   $0x807000
+  8021ee:	e8 03 e7 ff ff       	call   8008f6 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021f6:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021fb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021fe:	b8 01 00 00 00       	mov    $0x1,%eax
+  802203:	e8 c5 f9 ff ff       	call   801bcd <fsipc>
+  802208:	89 c3                	mov    %eax,%ebx
+  80220a:	83 c4 10             	add    $0x10,%esp
+  80220d:	85 c0                	test   %eax,%eax
+  80220f:	78 22                	js     802233 <open+0x82>
+	if (!(mode & O_NOBUF)
+  802211:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  802218:	74 2b                	je     802245 <open+0x94>
+	return fd2num(fd);
+  80221a:	83 ec 0c             	sub    $0xc,%esp
+  80221d:	ff 75 f4             	push   -0xc(%ebp)
+  802220:	e8 f3 f1 ff ff       	call   801418 <fd2num>
+  802225:	89 c3                	mov    %eax,%ebx
+  802227:	83 c4 10             	add    $0x10,%esp
+}
+  80222a:	89 d8                	mov    %ebx,%eax
+  80222c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80222f:	5b                   	pop    %ebx
+  802230:	5e                   	pop    %esi
+  802231:	5d                   	pop    %ebp
+  802232:	c3                   	ret
+		fd_close(fd, 0);
+  802233:	83 ec 08             	sub    $0x8,%esp
+  802236:	6a 00                	push   $0x0
+  802238:	ff 75 f4             	push   -0xc(%ebp)
+  80223b:	e8 f8 f2 ff ff       	call   801538 <fd_close>
+		return r;
+  802240:	83 c4 10             	add    $0x10,%esp
+  802243:	eb e5                	jmp    80222a <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  802245:	83 ec 0c             	sub    $0xc,%esp
+  802248:	ff 75 f4             	push   -0xc(%ebp)
+  80224b:	e8 d8 f1 ff ff       	call   801428 <fd2data>
+  802250:	83 c4 0c             	add    $0xc,%esp
+  802253:	68 07 04 00 00       	push   $0x407
+  802258:	50                   	push   %eax
+  802259:	6a 00                	push   $0x0
+  80225b:	e8 a2 ea ff ff       	call   800d02 <sys_page_alloc>
+  802260:	83 c4 10             	add    $0x10,%esp
+  802263:	85 c0                	test   %eax,%eax
+  802265:	75 b3                	jne    80221a <open+0x69>
+		fd->fd_file.buffered = 1;
+  802267:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80226a:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  80226e:	eb aa                	jmp    80221a <open+0x69>
+		return -E_BAD_PATH;
+  802270:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802275:	eb b3                	jmp    80222a <open+0x79>
+
+00802277 <readdir>:
+{
+  802277:	55                   	push   %ebp
+  802278:	89 e5                	mov    %esp,%ebp
+  80227a:	53                   	push   %ebx
+  80227b:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80227e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802281:	50                   	push   %eax
+  802282:	ff 75 08             	push   0x8(%ebp)
+  802285:	e8 0b f2 ff ff       	call   801495 <fd_lookup>
+  80228a:	89 c3                	mov    %eax,%ebx
+  80228c:	83 c4 10             	add    $0x10,%esp
+  80228f:	85 c0                	test   %eax,%eax
+  802291:	78 73                	js     802306 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802293:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802296:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  80229c:	39 08                	cmp    %ecx,(%eax)
+  80229e:	0f 85 82 00 00 00    	jne    802326 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  8022a4:	83 ec 0c             	sub    $0xc,%esp
+  8022a7:	50                   	push   %eax
+  8022a8:	e8 c4 f9 ff ff       	call   801c71 <devfile_sync>
+  8022ad:	89 c3                	mov    %eax,%ebx
+  8022af:	83 c4 10             	add    $0x10,%esp
+  8022b2:	85 c0                	test   %eax,%eax
+  8022b4:	78 50                	js     802306 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  8022b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022b9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022bc:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  8022c1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022c4:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  8022c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022cc:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  8022d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8022db:	e8 ed f8 ff ff       	call   801bcd <fsipc>
+  8022e0:	89 c3                	mov    %eax,%ebx
+  8022e2:	85 c0                	test   %eax,%eax
+  8022e4:	7e 20                	jle    802306 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  8022e6:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8022e9:	72 22                	jb     80230d <readdir+0x96>
+  8022eb:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8022f0:	7f 1b                	jg     80230d <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8022f2:	83 ec 04             	sub    $0x4,%esp
+  8022f5:	50                   	push   %eax
+  8022f6:	68 00 70 80 00       	push   $0x807000
+  8022fb:	ff 75 0c             	push   0xc(%ebp)
+  8022fe:	e8 79 e7 ff ff       	call   800a7c <memmove>
+	return r;
+  802303:	83 c4 10             	add    $0x10,%esp
+}
+  802306:	89 d8                	mov    %ebx,%eax
+  802308:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80230b:	c9                   	leave
+  80230c:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  80230d:	68 42 3f 80 00       	push   $0x803f42
+  802312:	68 4c 3e 80 00       	push   $0x803e4c
+  802317:	68 86 01 00 00       	push   $0x186
+  80231c:	68 30 3f 80 00       	push   $0x803f30
+  802321:	e8 07 df ff ff       	call   80022d <_panic>
+		return -E_NOT_SUPP;
+  802326:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80232b:	eb d9                	jmp    802306 <readdir+0x8f>
+
+0080232d <munmap>:
+{
+  80232d:	55                   	push   %ebp
+  80232e:	89 e5                	mov    %esp,%ebp
+  802330:	56                   	push   %esi
+  802331:	53                   	push   %ebx
+  802332:	8b 75 08             	mov    0x8(%ebp),%esi
+  802335:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802338:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  80233e:	75 41                	jne    802381 <munmap+0x54>
+  802340:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  802346:	77 39                	ja     802381 <munmap+0x54>
+  802348:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80234d:	29 f0                	sub    %esi,%eax
+  80234f:	39 d0                	cmp    %edx,%eax
+  802351:	72 35                	jb     802388 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802353:	89 f3                	mov    %esi,%ebx
+  802355:	01 d6                	add    %edx,%esi
+  802357:	39 f3                	cmp    %esi,%ebx
+  802359:	73 1a                	jae    802375 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  80235b:	83 ec 08             	sub    $0x8,%esp
+  80235e:	53                   	push   %ebx
+  80235f:	6a 00                	push   $0x0
+  802361:	e8 29 ea ff ff       	call   800d8f <sys_page_unmap>
+  802366:	83 c4 10             	add    $0x10,%esp
+  802369:	85 c0                	test   %eax,%eax
+  80236b:	78 0d                	js     80237a <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80236d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802373:	eb e2                	jmp    802357 <munmap+0x2a>
+	return 0;
+  802375:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80237a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80237d:	5b                   	pop    %ebx
+  80237e:	5e                   	pop    %esi
+  80237f:	5d                   	pop    %ebp
+  802380:	c3                   	ret
+		return -E_INVAL;
+  802381:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802386:	eb f2                	jmp    80237a <munmap+0x4d>
+  802388:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80238d:	eb eb                	jmp    80237a <munmap+0x4d>
+
+0080238f <mmap>:
+{
+  80238f:	55                   	push   %ebp
+  802390:	89 e5                	mov    %esp,%ebp
+  802392:	57                   	push   %edi
+  802393:	56                   	push   %esi
+  802394:	53                   	push   %ebx
+  802395:	83 ec 34             	sub    $0x34,%esp
+  802398:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80239b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80239e:	50                   	push   %eax
+  80239f:	ff 75 18             	push   0x18(%ebp)
+  8023a2:	e8 ee f0 ff ff       	call   801495 <fd_lookup>
+  8023a7:	89 c3                	mov    %eax,%ebx
+  8023a9:	83 c4 10             	add    $0x10,%esp
+  8023ac:	85 c0                	test   %eax,%eax
+  8023ae:	0f 88 0e 01 00 00    	js     8024c2 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8023b4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8023b7:	a1 20 50 80 00       	mov    0x805020,%eax
+  8023bc:	39 02                	cmp    %eax,(%edx)
+  8023be:	0f 85 50 01 00 00    	jne    802514 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  8023c4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023c7:	83 e0 02             	and    $0x2,%eax
+  8023ca:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8023cd:	74 0a                	je     8023d9 <mmap+0x4a>
+  8023cf:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8023d3:	0f 84 42 01 00 00    	je     80251b <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  8023d9:	8b 42 08             	mov    0x8(%edx),%eax
+  8023dc:	83 e0 03             	and    $0x3,%eax
+  8023df:	83 f8 01             	cmp    $0x1,%eax
+  8023e2:	0f 84 3a 01 00 00    	je     802522 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8023e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023eb:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8023ee:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8023f3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8023f6:	0f 85 2d 01 00 00    	jne    802529 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8023fc:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802400:	0f 88 2a 01 00 00    	js     802530 <mmap+0x1a1>
+  802406:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80240d:	0f 87 1d 01 00 00    	ja     802530 <mmap+0x1a1>
+  802413:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802418:	2b 45 08             	sub    0x8(%ebp),%eax
+  80241b:	39 f8                	cmp    %edi,%eax
+  80241d:	0f 82 14 01 00 00    	jb     802537 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802423:	83 ec 0c             	sub    $0xc,%esp
+  802426:	52                   	push   %edx
+  802427:	e8 45 f8 ff ff       	call   801c71 <devfile_sync>
+  80242c:	89 c3                	mov    %eax,%ebx
+  80242e:	83 c4 10             	add    $0x10,%esp
+  802431:	85 c0                	test   %eax,%eax
+  802433:	0f 88 89 00 00 00    	js     8024c2 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802439:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  80243f:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802445:	be 00 00 00 00       	mov    $0x0,%esi
+  80244a:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  80244d:	39 fe                	cmp    %edi,%esi
+  80244f:	73 7b                	jae    8024cc <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  802451:	89 f8                	mov    %edi,%eax
+  802453:	29 f0                	sub    %esi,%eax
+  802455:	c1 e8 0c             	shr    $0xc,%eax
+  802458:	ba 40 00 00 00       	mov    $0x40,%edx
+  80245d:	39 d0                	cmp    %edx,%eax
+  80245f:	0f 47 c2             	cmova  %edx,%eax
+  802462:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802465:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802468:	8b 52 0c             	mov    0xc(%edx),%edx
+  80246b:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  802471:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802474:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  80247a:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  80247f:	89 f2                	mov    %esi,%edx
+  802481:	03 55 08             	add    0x8(%ebp),%edx
+  802484:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802487:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80248c:	e8 ea f6 ff ff       	call   801b7b <fsipcv>
+  802491:	85 c0                	test   %eax,%eax
+  802493:	7e 12                	jle    8024a7 <mmap+0x118>
+  802495:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802498:	85 c0                	test   %eax,%eax
+  80249a:	0f 84 9e 00 00 00    	je     80253e <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8024a0:	c1 e0 0c             	shl    $0xc,%eax
+  8024a3:	01 c6                	add    %eax,%esi
+  8024a5:	eb a6                	jmp    80244d <mmap+0xbe>
+			munmap(addr, done);
+  8024a7:	89 c3                	mov    %eax,%ebx
+  8024a9:	83 ec 08             	sub    $0x8,%esp
+  8024ac:	56                   	push   %esi
+  8024ad:	ff 75 08             	push   0x8(%ebp)
+  8024b0:	e8 78 fe ff ff       	call   80232d <munmap>
+			return r < 0 ? r : -E_INVAL;
+  8024b5:	83 c4 10             	add    $0x10,%esp
+  8024b8:	85 db                	test   %ebx,%ebx
+  8024ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024bf:	0f 49 d8             	cmovns %eax,%ebx
+}
+  8024c2:	89 d8                	mov    %ebx,%eax
+  8024c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024c7:	5b                   	pop    %ebx
+  8024c8:	5e                   	pop    %esi
+  8024c9:	5f                   	pop    %edi
+  8024ca:	5d                   	pop    %ebp
+  8024cb:	c3                   	ret
+	if (prot & PROT_WRITE)
+  8024cc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8024cf:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8024d1:	85 c0                	test   %eax,%eax
+  8024d3:	74 ed                	je     8024c2 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8024d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8024da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8024dd:	39 fe                	cmp    %edi,%esi
+  8024df:	73 2e                	jae    80250f <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8024e1:	83 ec 0c             	sub    $0xc,%esp
+  8024e4:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8024e7:	50                   	push   %eax
+  8024e8:	e8 2d ed ff ff       	call   80121a <cowpage>
+  8024ed:	83 c4 10             	add    $0x10,%esp
+  8024f0:	85 c0                	test   %eax,%eax
+  8024f2:	78 08                	js     8024fc <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8024f4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8024fa:	eb e1                	jmp    8024dd <mmap+0x14e>
+				munmap(addr, len);
+  8024fc:	89 c3                	mov    %eax,%ebx
+  8024fe:	83 ec 08             	sub    $0x8,%esp
+  802501:	57                   	push   %edi
+  802502:	ff 75 08             	push   0x8(%ebp)
+  802505:	e8 23 fe ff ff       	call   80232d <munmap>
+				return r;
+  80250a:	83 c4 10             	add    $0x10,%esp
+  80250d:	eb b3                	jmp    8024c2 <mmap+0x133>
+	return 0;
+  80250f:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802512:	eb ae                	jmp    8024c2 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802514:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802519:	eb a7                	jmp    8024c2 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80251b:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802520:	eb a0                	jmp    8024c2 <mmap+0x133>
+		return -E_INVAL;
+  802522:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802527:	eb 99                	jmp    8024c2 <mmap+0x133>
+  802529:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80252e:	eb 92                	jmp    8024c2 <mmap+0x133>
+  802530:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802535:	eb 8b                	jmp    8024c2 <mmap+0x133>
+  802537:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80253c:	eb 84                	jmp    8024c2 <mmap+0x133>
+			munmap(addr, done);
+  80253e:	83 ec 08             	sub    $0x8,%esp
+  802541:	56                   	push   %esi
+  802542:	ff 75 08             	push   0x8(%ebp)
+  802545:	e8 e3 fd ff ff       	call   80232d <munmap>
+  80254a:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  80254d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802552:	e9 6b ff ff ff       	jmp    8024c2 <mmap+0x133>
+
+00802557 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802557:	55                   	push   %ebp
+  802558:	89 e5                	mov    %esp,%ebp
+  80255a:	56                   	push   %esi
+  80255b:	53                   	push   %ebx
+  80255c:	83 ec 10             	sub    $0x10,%esp
+  80255f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802562:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802565:	8b 45 08             	mov    0x8(%ebp),%eax
+  802568:	e8 3d f9 ff ff       	call   801eaa <fsring_slot>
+  80256d:	85 c0                	test   %eax,%eax
+  80256f:	78 60                	js     8025d1 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802571:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802574:	8b 56 08             	mov    0x8(%esi),%edx
+  802577:	83 e2 03             	and    $0x3,%edx
+  80257a:	83 fa 01             	cmp    $0x1,%edx
+  80257d:	74 59                	je     8025d8 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  80257f:	ba 01 00 00 00       	mov    $0x1,%edx
+  802584:	89 c1                	mov    %eax,%ecx
+  802586:	d3 e2                	shl    %cl,%edx
+  802588:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  80258e:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802591:	c1 e2 02             	shl    $0x2,%edx
+  802594:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  80259a:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  8025a1:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8025a4:	8b 55 18             	mov    0x18(%ebp),%edx
+  8025a7:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8025aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025ad:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8025b0:	83 ec 08             	sub    $0x8,%esp
+  8025b3:	50                   	push   %eax
+  8025b4:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8025b9:	39 c3                	cmp    %eax,%ebx
+  8025bb:	0f 47 d8             	cmova  %eax,%ebx
+  8025be:	53                   	push   %ebx
+  8025bf:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8025c2:	89 f2                	mov    %esi,%edx
+  8025c4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8025c9:	e8 1e f5 ff ff       	call   801aec <fsring_post>
+  8025ce:	83 c4 10             	add    $0x10,%esp
+}
+  8025d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025d4:	5b                   	pop    %ebx
+  8025d5:	5e                   	pop    %esi
+  8025d6:	5d                   	pop    %ebp
+  8025d7:	c3                   	ret
+		return -E_INVAL;
+  8025d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025dd:	eb f2                	jmp    8025d1 <fsring_read+0x7a>
+
+008025df <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8025df:	55                   	push   %ebp
+  8025e0:	89 e5                	mov    %esp,%ebp
+  8025e2:	56                   	push   %esi
+  8025e3:	53                   	push   %ebx
+  8025e4:	83 ec 10             	sub    $0x10,%esp
+  8025e7:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8025ea:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f0:	e8 b5 f8 ff ff       	call   801eaa <fsring_slot>
+  8025f5:	89 c3                	mov    %eax,%ebx
+  8025f7:	85 c0                	test   %eax,%eax
+  8025f9:	78 77                	js     802672 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8025fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025fe:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802602:	74 77                	je     80267b <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802604:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802609:	39 c6                	cmp    %eax,%esi
+  80260b:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80260e:	83 ec 04             	sub    $0x4,%esp
+  802611:	56                   	push   %esi
+  802612:	ff 75 0c             	push   0xc(%ebp)
+  802615:	89 d8                	mov    %ebx,%eax
+  802617:	c1 e0 0c             	shl    $0xc,%eax
+  80261a:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802620:	50                   	push   %eax
+  802621:	e8 56 e4 ff ff       	call   800a7c <memmove>
+	fsring_busy |= 1 << slot;
+  802626:	b8 01 00 00 00       	mov    $0x1,%eax
+  80262b:	89 d9                	mov    %ebx,%ecx
+  80262d:	d3 e0                	shl    %cl,%eax
+  80262f:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802635:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802638:	c1 e0 02             	shl    $0x2,%eax
+  80263b:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  802641:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  802648:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80264b:	8b 45 18             	mov    0x18(%ebp),%eax
+  80264e:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  802651:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802658:	83 c4 08             	add    $0x8,%esp
+  80265b:	53                   	push   %ebx
+  80265c:	56                   	push   %esi
+  80265d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802660:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802663:	b8 04 00 00 00       	mov    $0x4,%eax
+  802668:	e8 7f f4 ff ff       	call   801aec <fsring_post>
+  80266d:	89 c3                	mov    %eax,%ebx
+  80266f:	83 c4 10             	add    $0x10,%esp
+}
+  802672:	89 d8                	mov    %ebx,%eax
+  802674:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802677:	5b                   	pop    %ebx
+  802678:	5e                   	pop    %esi
+  802679:	5d                   	pop    %ebp
+  80267a:	c3                   	ret
+		return -E_INVAL;
+  80267b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802680:	eb f0                	jmp    802672 <fsring_write+0x93>
+
+00802682 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802682:	55                   	push   %ebp
+  802683:	89 e5                	mov    %esp,%ebp
+  802685:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802688:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80268b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80268e:	e8 17 f8 ff ff       	call   801eaa <fsring_slot>
+  802693:	85 c0                	test   %eax,%eax
+  802695:	78 4c                	js     8026e3 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802697:	ba 01 00 00 00       	mov    $0x1,%edx
+  80269c:	89 c1                	mov    %eax,%ecx
+  80269e:	d3 e2                	shl    %cl,%edx
+  8026a0:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8026a6:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8026a9:	c1 e2 02             	shl    $0x2,%edx
+  8026ac:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  8026b2:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  8026b9:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8026bc:	8b 55 10             	mov    0x10(%ebp),%edx
+  8026bf:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8026c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8026c5:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  8026c8:	83 ec 08             	sub    $0x8,%esp
+  8026cb:	50                   	push   %eax
+  8026cc:	6a 00                	push   $0x0
+  8026ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026d3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026d6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8026db:	e8 0c f4 ff ff       	call   801aec <fsring_post>
+  8026e0:	83 c4 10             	add    $0x10,%esp
+}
+  8026e3:	c9                   	leave
+  8026e4:	c3                   	ret
+
+008026e5 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8026e5:	55                   	push   %ebp
+  8026e6:	89 e5                	mov    %esp,%ebp
+  8026e8:	57                   	push   %edi
+  8026e9:	56                   	push   %esi
+  8026ea:	53                   	push   %ebx
+  8026eb:	83 ec 1c             	sub    $0x1c,%esp
+  8026ee:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8026f2:	a1 00 64 80 00       	mov    0x806400,%eax
+  8026f7:	8b 40 48             	mov    0x48(%eax),%eax
+  8026fa:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  802700:	74 12                	je     802714 <fsring_reap+0x2f>
+		return 0;
+  802702:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802707:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80270a:	5b                   	pop    %ebx
+  80270b:	5e                   	pop    %esi
+  80270c:	5f                   	pop    %edi
+  80270d:	5d                   	pop    %ebp
+  80270e:	c3                   	ret
+		sys_yield();
+  80270f:	e8 cf e5 ff ff       	call   800ce3 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802714:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  80271a:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80271f:	39 c2                	cmp    %eax,%edx
+  802721:	75 18                	jne    80273b <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802723:	84 db                	test   %bl,%bl
+  802725:	0f 84 21 01 00 00    	je     80284c <fsring_reap+0x167>
+  80272b:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  802732:	75 db                	jne    80270f <fsring_reap+0x2a>
+			return 0;
+  802734:	b8 00 00 00 00       	mov    $0x0,%eax
+  802739:	eb cc                	jmp    802707 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  80273b:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802740:	83 e0 0f             	and    $0xf,%eax
+  802743:	83 c0 2a             	add    $0x2a,%eax
+  802746:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  80274d:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802754:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802759:	83 c0 01             	add    $0x1,%eax
+  80275c:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802761:	83 fb 0f             	cmp    $0xf,%ebx
+  802764:	77 5b                	ja     8027c1 <fsring_reap+0xdc>
+  802766:	be 01 00 00 00       	mov    $0x1,%esi
+  80276b:	89 d9                	mov    %ebx,%ecx
+  80276d:	d3 e6                	shl    %cl,%esi
+  80276f:	89 f0                	mov    %esi,%eax
+  802771:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  802777:	74 48                	je     8027c1 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802779:	89 d8                	mov    %ebx,%eax
+  80277b:	c1 e0 0c             	shl    $0xc,%eax
+  80277e:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802784:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802787:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80278a:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  802791:	83 f8 03             	cmp    $0x3,%eax
+  802794:	74 40                	je     8027d6 <fsring_reap+0xf1>
+  802796:	83 f8 05             	cmp    $0x5,%eax
+  802799:	74 64                	je     8027ff <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  80279b:	f7 d6                	not    %esi
+  80279d:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8027a3:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8027a6:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  8027ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027b0:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8027b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027b5:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8027b7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027bc:	e9 46 ff ff ff       	jmp    802707 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8027c1:	53                   	push   %ebx
+  8027c2:	68 58 3f 80 00       	push   $0x803f58
+  8027c7:	68 8f 02 00 00       	push   $0x28f
+  8027cc:	68 30 3f 80 00       	push   $0x803f30
+  8027d1:	e8 57 da ff ff       	call   80022d <_panic>
+		if (cqe.cqe_result > 0)
+  8027d6:	85 ff                	test   %edi,%edi
+  8027d8:	7e c1                	jle    80279b <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8027da:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8027dd:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8027e2:	39 c7                	cmp    %eax,%edi
+  8027e4:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8027e7:	50                   	push   %eax
+  8027e8:	ff 75 e4             	push   -0x1c(%ebp)
+  8027eb:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8027ee:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  8027f5:	e8 82 e2 ff ff       	call   800a7c <memmove>
+  8027fa:	83 c4 10             	add    $0x10,%esp
+  8027fd:	eb 9c                	jmp    80279b <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8027ff:	85 ff                	test   %edi,%edi
+  802801:	75 98                	jne    80279b <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802803:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802806:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  80280d:	83 ec 08             	sub    $0x8,%esp
+  802810:	ff 75 e4             	push   -0x1c(%ebp)
+  802813:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802816:	51                   	push   %ecx
+  802817:	e8 da e0 ff ff       	call   8008f6 <strcpy>
+			st->st_size = ret->ret_size;
+  80281c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80281f:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802825:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802828:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80282e:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802834:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  80283a:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  802841:	50 80 00 
+  802844:	83 c4 10             	add    $0x10,%esp
+  802847:	e9 4f ff ff ff       	jmp    80279b <fsring_reap+0xb6>
+			return 0;
+  80284c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802851:	e9 b1 fe ff ff       	jmp    802707 <fsring_reap+0x22>
+
+00802856 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802856:	55                   	push   %ebp
+  802857:	89 e5                	mov    %esp,%ebp
+  802859:	57                   	push   %edi
+  80285a:	56                   	push   %esi
+  80285b:	53                   	push   %ebx
+  80285c:	83 ec 28             	sub    $0x28,%esp
+  80285f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802862:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802865:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802868:	53                   	push   %ebx
+  802869:	e8 4d e0 ff ff       	call   8008bb <strlen>
+  80286e:	83 c4 10             	add    $0x10,%esp
+  802871:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802876:	0f 8f 02 01 00 00    	jg     80297e <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  80287c:	83 ec 08             	sub    $0x8,%esp
+  80287f:	53                   	push   %ebx
+  802880:	68 00 70 80 00       	push   $0x807000
+  802885:	e8 6c e0 ff ff       	call   8008f6 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  80288a:	83 c4 10             	add    $0x10,%esp
+  80288d:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802893:	76 69                	jbe    8028fe <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802895:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802898:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80289e:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8028a3:	29 d1                	sub    %edx,%ecx
+  8028a5:	39 f9                	cmp    %edi,%ecx
+  8028a7:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8028aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028ad:	89 f9                	mov    %edi,%ecx
+  8028af:	01 c1                	add    %eax,%ecx
+  8028b1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8028b4:	eb 0f                	jmp    8028c5 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  8028b6:	0f b6 10             	movzbl (%eax),%edx
+  8028b9:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8028bb:	05 00 10 00 00       	add    $0x1000,%eax
+  8028c0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8028c5:	39 c8                	cmp    %ecx,%eax
+  8028c7:	72 ed                	jb     8028b6 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  8028c9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028cc:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  8028d2:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8028d8:	83 ec 0c             	sub    $0xc,%esp
+  8028db:	6a 07                	push   $0x7
+  8028dd:	89 f9                	mov    %edi,%ecx
+  8028df:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028e2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8028e7:	e8 3f f1 ff ff       	call   801a2b <fsipc_pages>
+  8028ec:	89 c7                	mov    %eax,%edi
+  8028ee:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8028f1:	85 f6                	test   %esi,%esi
+  8028f3:	74 7f                	je     802974 <file_slurp+0x11e>
+  8028f5:	8d 43 01             	lea    0x1(%ebx),%eax
+  8028f8:	85 ff                	test   %edi,%edi
+  8028fa:	79 3c                	jns    802938 <file_slurp+0xe2>
+  8028fc:	eb 76                	jmp    802974 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8028fe:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802904:	ba 00 00 00 00       	mov    $0x0,%edx
+  802909:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80290e:	e8 ba f2 ff ff       	call   801bcd <fsipc>
+  802913:	89 c7                	mov    %eax,%edi
+  802915:	85 c0                	test   %eax,%eax
+  802917:	7e d8                	jle    8028f1 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802919:	83 ec 04             	sub    $0x4,%esp
+  80291c:	50                   	push   %eax
+  80291d:	68 08 70 80 00       	push   $0x807008
+  802922:	ff 75 0c             	push   0xc(%ebp)
+  802925:	e8 52 e1 ff ff       	call   800a7c <memmove>
+  80292a:	83 c4 10             	add    $0x10,%esp
+  80292d:	eb c2                	jmp    8028f1 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  80292f:	80 fa 2f             	cmp    $0x2f,%dl
+  802932:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802935:	83 c0 01             	add    $0x1,%eax
+  802938:	89 c1                	mov    %eax,%ecx
+  80293a:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  80293e:	84 d2                	test   %dl,%dl
+  802940:	75 ed                	jne    80292f <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802942:	83 ec 04             	sub    $0x4,%esp
+  802945:	68 80 00 00 00       	push   $0x80
+  80294a:	53                   	push   %ebx
+  80294b:	56                   	push   %esi
+  80294c:	e8 1b e0 ff ff       	call   80096c <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802951:	a1 00 70 80 00       	mov    0x807000,%eax
+  802956:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  80295c:	a1 04 70 80 00       	mov    0x807004,%eax
+  802961:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802967:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  80296e:	50 80 00 
+  802971:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802974:	89 f8                	mov    %edi,%eax
+  802976:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802979:	5b                   	pop    %ebx
+  80297a:	5e                   	pop    %esi
+  80297b:	5f                   	pop    %edi
+  80297c:	5d                   	pop    %ebp
+  80297d:	c3                   	ret
+		return -E_BAD_PATH;
+  80297e:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802983:	eb ef                	jmp    802974 <file_slurp+0x11e>
+
+00802985 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802985:	55                   	push   %ebp
+  802986:	89 e5                	mov    %esp,%ebp
+  802988:	53                   	push   %ebx
+  802989:	83 ec 10             	sub    $0x10,%esp
+  80298c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80298f:	53                   	push   %ebx
+  802990:	e8 26 df ff ff       	call   8008bb <strlen>
+  802995:	83 c4 10             	add    $0x10,%esp
+  802998:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80299d:	7f 25                	jg     8029c4 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80299f:	83 ec 08             	sub    $0x8,%esp
+  8029a2:	53                   	push   %ebx
+  8029a3:	68 00 70 80 00       	push   $0x807000
+  8029a8:	e8 49 df ff ff       	call   8008f6 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8029ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8029b7:	e8 11 f2 ff ff       	call   801bcd <fsipc>
+  8029bc:	83 c4 10             	add    $0x10,%esp
+}
+  8029bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029c2:	c9                   	leave
+  8029c3:	c3                   	ret
+		return -E_BAD_PATH;
+  8029c4:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8029c9:	eb f4                	jmp    8029bf <remove+0x3a>
+
+008029cb <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8029cb:	55                   	push   %ebp
+  8029cc:	89 e5                	mov    %esp,%ebp
+  8029ce:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8029d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029d6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8029db:	e8 ed f1 ff ff       	call   801bcd <fsipc>
+}
+  8029e0:	c9                   	leave
+  8029e1:	c3                   	ret
+
+008029e2 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  8029e2:	55                   	push   %ebp
+  8029e3:	89 e5                	mov    %esp,%ebp
+  8029e5:	57                   	push   %edi
+  8029e6:	56                   	push   %esi
+  8029e7:	53                   	push   %ebx
+  8029e8:	83 ec 18             	sub    $0x18,%esp
+  8029eb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8029ee:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8029f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8029f4:	57                   	push   %edi
+  8029f5:	e8 c1 de ff ff       	call   8008bb <strlen>
+  8029fa:	83 c4 10             	add    $0x10,%esp
+  8029fd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a02:	7f 4c                	jg     802a50 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802a04:	83 ec 08             	sub    $0x8,%esp
+  802a07:	57                   	push   %edi
+  802a08:	68 00 70 80 00       	push   $0x807000
+  802a0d:	e8 e4 de ff ff       	call   8008f6 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802a12:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a17:	b8 10 00 00 00       	mov    $0x10,%eax
+  802a1c:	e8 ac f1 ff ff       	call   801bcd <fsipc>
+  802a21:	83 c4 10             	add    $0x10,%esp
+  802a24:	85 c0                	test   %eax,%eax
+  802a26:	78 20                	js     802a48 <defrag+0x66>
+		return r;
+	if (before)
+  802a28:	85 f6                	test   %esi,%esi
+  802a2a:	74 07                	je     802a33 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802a2c:	a1 00 70 80 00       	mov    0x807000,%eax
+  802a31:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802a33:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802a38:	85 db                	test   %ebx,%ebx
+  802a3a:	74 0c                	je     802a48 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802a3c:	a1 04 70 80 00       	mov    0x807004,%eax
+  802a41:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802a43:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a4b:	5b                   	pop    %ebx
+  802a4c:	5e                   	pop    %esi
+  802a4d:	5f                   	pop    %edi
+  802a4e:	5d                   	pop    %ebp
+  802a4f:	c3                   	ret
+		return -E_BAD_PATH;
+  802a50:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802a55:	eb f1                	jmp    802a48 <defrag+0x66>
+
+00802a57 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802a57:	55                   	push   %ebp
+  802a58:	89 e5                	mov    %esp,%ebp
+  802a5a:	53                   	push   %ebx
+  802a5b:	83 ec 04             	sub    $0x4,%esp
+  802a5e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802a61:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a66:	b8 11 00 00 00       	mov    $0x11,%eax
+  802a6b:	e8 5d f1 ff ff       	call   801bcd <fsipc>
+  802a70:	85 c0                	test   %eax,%eax
+  802a72:	78 34                	js     802aa8 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802a74:	a1 00 70 80 00       	mov    0x807000,%eax
+  802a79:	89 03                	mov    %eax,(%ebx)
+  802a7b:	a1 04 70 80 00       	mov    0x807004,%eax
+  802a80:	89 43 04             	mov    %eax,0x4(%ebx)
+  802a83:	a1 08 70 80 00       	mov    0x807008,%eax
+  802a88:	89 43 08             	mov    %eax,0x8(%ebx)
+  802a8b:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  802a90:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802a93:	a1 10 70 80 00       	mov    0x807010,%eax
+  802a98:	89 43 10             	mov    %eax,0x10(%ebx)
+  802a9b:	a1 14 70 80 00       	mov    0x807014,%eax
+  802aa0:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802aa3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802aa8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aab:	c9                   	leave
+  802aac:	c3                   	ret
+
+00802aad <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802aad:	55                   	push   %ebp
+  802aae:	89 e5                	mov    %esp,%ebp
+  802ab0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802ab3:	68 71 3f 80 00       	push   $0x803f71
+  802ab8:	ff 75 0c             	push   0xc(%ebp)
+  802abb:	e8 36 de ff ff       	call   8008f6 <strcpy>
+	return 0;
+}
+  802ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac5:	c9                   	leave
+  802ac6:	c3                   	ret
+
+00802ac7 <devsock_close>:
+{
+  802ac7:	55                   	push   %ebp
+  802ac8:	89 e5                	mov    %esp,%ebp
+  802aca:	53                   	push   %ebx
+  802acb:	83 ec 10             	sub    $0x10,%esp
+  802ace:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802ad1:	53                   	push   %ebx
+  802ad2:	e8 ca 0b 00 00       	call   8036a1 <pageref>
+  802ad7:	89 c2                	mov    %eax,%edx
+  802ad9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802adc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802ae1:	83 fa 01             	cmp    $0x1,%edx
+  802ae4:	74 05                	je     802aeb <devsock_close+0x24>
+}
+  802ae6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ae9:	c9                   	leave
+  802aea:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802aeb:	83 ec 0c             	sub    $0xc,%esp
+  802aee:	ff 73 0c             	push   0xc(%ebx)
+  802af1:	e8 b7 02 00 00       	call   802dad <nsipc_close>
+  802af6:	83 c4 10             	add    $0x10,%esp
+  802af9:	eb eb                	jmp    802ae6 <devsock_close+0x1f>
+
+00802afb <devsock_write>:
+{
+  802afb:	55                   	push   %ebp
+  802afc:	89 e5                	mov    %esp,%ebp
+  802afe:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802b01:	6a 00                	push   $0x0
+  802b03:	ff 75 10             	push   0x10(%ebp)
+  802b06:	ff 75 0c             	push   0xc(%ebp)
+  802b09:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b0c:	ff 70 0c             	push   0xc(%eax)
+  802b0f:	e8 79 03 00 00       	call   802e8d <nsipc_send>
+}
+  802b14:	c9                   	leave
+  802b15:	c3                   	ret
+
+00802b16 <devsock_read>:
+{
+  802b16:	55                   	push   %ebp
+  802b17:	89 e5                	mov    %esp,%ebp
+  802b19:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802b1c:	6a 00                	push   $0x0
+  802b1e:	ff 75 10             	push   0x10(%ebp)
+  802b21:	ff 75 0c             	push   0xc(%ebp)
+  802b24:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b27:	ff 70 0c             	push   0xc(%eax)
+  802b2a:	e8 ef 02 00 00       	call   802e1e <nsipc_recv>
+}
+  802b2f:	c9                   	leave
+  802b30:	c3                   	ret
+
+00802b31 <fd2sockid>:
+{
+  802b31:	55                   	push   %ebp
+  802b32:	89 e5                	mov    %esp,%ebp
+  802b34:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802b37:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b3a:	52                   	push   %edx
+  802b3b:	50                   	push   %eax
+  802b3c:	e8 54 e9 ff ff       	call   801495 <fd_lookup>
+  802b41:	83 c4 10             	add    $0x10,%esp
+  802b44:	85 c0                	test   %eax,%eax
+  802b46:	78 10                	js     802b58 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802b48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b4b:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802b51:	39 08                	cmp    %ecx,(%eax)
+  802b53:	75 05                	jne    802b5a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802b55:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802b58:	c9                   	leave
+  802b59:	c3                   	ret
+		return -E_NOT_SUPP;
+  802b5a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802b5f:	eb f7                	jmp    802b58 <fd2sockid+0x27>
+
+00802b61 <alloc_sockfd>:
+{
+  802b61:	55                   	push   %ebp
+  802b62:	89 e5                	mov    %esp,%ebp
+  802b64:	56                   	push   %esi
+  802b65:	53                   	push   %ebx
+  802b66:	83 ec 1c             	sub    $0x1c,%esp
+  802b69:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802b6b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b6e:	50                   	push   %eax
+  802b6f:	e8 cb e8 ff ff       	call   80143f <fd_alloc>
+  802b74:	89 c3                	mov    %eax,%ebx
+  802b76:	83 c4 10             	add    $0x10,%esp
+  802b79:	85 c0                	test   %eax,%eax
+  802b7b:	78 43                	js     802bc0 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802b7d:	83 ec 04             	sub    $0x4,%esp
+  802b80:	68 07 04 00 00       	push   $0x407
+  802b85:	ff 75 f4             	push   -0xc(%ebp)
+  802b88:	6a 00                	push   $0x0
+  802b8a:	e8 73 e1 ff ff       	call   800d02 <sys_page_alloc>
+  802b8f:	89 c3                	mov    %eax,%ebx
+  802b91:	83 c4 10             	add    $0x10,%esp
+  802b94:	85 c0                	test   %eax,%eax
+  802b96:	78 28                	js     802bc0 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802b98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b9b:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802ba1:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802ba3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ba6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802bad:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802bb0:	83 ec 0c             	sub    $0xc,%esp
+  802bb3:	50                   	push   %eax
+  802bb4:	e8 5f e8 ff ff       	call   801418 <fd2num>
+  802bb9:	89 c3                	mov    %eax,%ebx
+  802bbb:	83 c4 10             	add    $0x10,%esp
+  802bbe:	eb 0c                	jmp    802bcc <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802bc0:	83 ec 0c             	sub    $0xc,%esp
+  802bc3:	56                   	push   %esi
+  802bc4:	e8 e4 01 00 00       	call   802dad <nsipc_close>
+		return r;
+  802bc9:	83 c4 10             	add    $0x10,%esp
+}
+  802bcc:	89 d8                	mov    %ebx,%eax
+  802bce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bd1:	5b                   	pop    %ebx
+  802bd2:	5e                   	pop    %esi
+  802bd3:	5d                   	pop    %ebp
+  802bd4:	c3                   	ret
+
+00802bd5 <accept>:
+{
+  802bd5:	55                   	push   %ebp
+  802bd6:	89 e5                	mov    %esp,%ebp
+  802bd8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bde:	e8 4e ff ff ff       	call   802b31 <fd2sockid>
+  802be3:	85 c0                	test   %eax,%eax
+  802be5:	78 1b                	js     802c02 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802be7:	83 ec 04             	sub    $0x4,%esp
+  802bea:	ff 75 10             	push   0x10(%ebp)
+  802bed:	ff 75 0c             	push   0xc(%ebp)
+  802bf0:	50                   	push   %eax
+  802bf1:	e8 0e 01 00 00       	call   802d04 <nsipc_accept>
+  802bf6:	83 c4 10             	add    $0x10,%esp
+  802bf9:	85 c0                	test   %eax,%eax
+  802bfb:	78 05                	js     802c02 <accept+0x2d>
+	return alloc_sockfd(r);
+  802bfd:	e8 5f ff ff ff       	call   802b61 <alloc_sockfd>
+}
+  802c02:	c9                   	leave
+  802c03:	c3                   	ret
+
+00802c04 <bind>:
+{
+  802c04:	55                   	push   %ebp
+  802c05:	89 e5                	mov    %esp,%ebp
+  802c07:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c0d:	e8 1f ff ff ff       	call   802b31 <fd2sockid>
+  802c12:	85 c0                	test   %eax,%eax
+  802c14:	78 12                	js     802c28 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802c16:	83 ec 04             	sub    $0x4,%esp
+  802c19:	ff 75 10             	push   0x10(%ebp)
+  802c1c:	ff 75 0c             	push   0xc(%ebp)
+  802c1f:	50                   	push   %eax
+  802c20:	e8 31 01 00 00       	call   802d56 <nsipc_bind>
+  802c25:	83 c4 10             	add    $0x10,%esp
+}
+  802c28:	c9                   	leave
+  802c29:	c3                   	ret
+
+00802c2a <shutdown>:
+{
+  802c2a:	55                   	push   %ebp
+  802c2b:	89 e5                	mov    %esp,%ebp
+  802c2d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c30:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c33:	e8 f9 fe ff ff       	call   802b31 <fd2sockid>
+  802c38:	85 c0                	test   %eax,%eax
+  802c3a:	78 0f                	js     802c4b <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802c3c:	83 ec 08             	sub    $0x8,%esp
+  802c3f:	ff 75 0c             	push   0xc(%ebp)
+  802c42:	50                   	push   %eax
+  802c43:	e8 43 01 00 00       	call   802d8b <nsipc_shutdown>
+  802c48:	83 c4 10             	add    $0x10,%esp
+}
+  802c4b:	c9                   	leave
+  802c4c:	c3                   	ret
+
+00802c4d <connect>:
+{
+  802c4d:	55                   	push   %ebp
+  802c4e:	89 e5                	mov    %esp,%ebp
+  802c50:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c53:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c56:	e8 d6 fe ff ff       	call   802b31 <fd2sockid>
+  802c5b:	85 c0                	test   %eax,%eax
+  802c5d:	78 12                	js     802c71 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802c5f:	83 ec 04             	sub    $0x4,%esp
+  802c62:	ff 75 10             	push   0x10(%ebp)
+  802c65:	ff 75 0c             	push   0xc(%ebp)
+  802c68:	50                   	push   %eax
+  802c69:	e8 59 01 00 00       	call   802dc7 <nsipc_connect>
+  802c6e:	83 c4 10             	add    $0x10,%esp
+}
+  802c71:	c9                   	leave
+  802c72:	c3                   	ret
+
+00802c73 <listen>:
+{
+  802c73:	55                   	push   %ebp
+  802c74:	89 e5                	mov    %esp,%ebp
+  802c76:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c79:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c7c:	e8 b0 fe ff ff       	call   802b31 <fd2sockid>
+  802c81:	85 c0                	test   %eax,%eax
+  802c83:	78 0f                	js     802c94 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c85:	83 ec 08             	sub    $0x8,%esp
+  802c88:	ff 75 0c             	push   0xc(%ebp)
+  802c8b:	50                   	push   %eax
+  802c8c:	e8 6b 01 00 00       	call   802dfc <nsipc_listen>
+  802c91:	83 c4 10             	add    $0x10,%esp
+}
+  802c94:	c9                   	leave
+  802c95:	c3                   	ret
+
+00802c96 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802c96:	55                   	push   %ebp
+  802c97:	89 e5                	mov    %esp,%ebp
+  802c99:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802c9c:	ff 75 10             	push   0x10(%ebp)
+  802c9f:	ff 75 0c             	push   0xc(%ebp)
+  802ca2:	ff 75 08             	push   0x8(%ebp)
+  802ca5:	e8 41 02 00 00       	call   802eeb <nsipc_socket>
+  802caa:	83 c4 10             	add    $0x10,%esp
+  802cad:	85 c0                	test   %eax,%eax
+  802caf:	78 05                	js     802cb6 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802cb1:	e8 ab fe ff ff       	call   802b61 <alloc_sockfd>
+}
+  802cb6:	c9                   	leave
+  802cb7:	c3                   	ret
+
+00802cb8 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802cb8:	55                   	push   %ebp
+  802cb9:	89 e5                	mov    %esp,%ebp
+  802cbb:	53                   	push   %ebx
+  802cbc:	83 ec 04             	sub    $0x4,%esp
+  802cbf:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802cc1:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802cc8:	74 26                	je     802cf0 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802cca:	6a 07                	push   $0x7
+  802ccc:	68 00 90 80 00       	push   $0x809000
+  802cd1:	53                   	push   %ebx
+  802cd2:	ff 35 00 a0 80 00    	push   0x80a000
+  802cd8:	e8 4c 08 00 00       	call   803529 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802cdd:	83 c4 0c             	add    $0xc,%esp
+  802ce0:	6a 00                	push   $0x0
+  802ce2:	6a 00                	push   $0x0
+  802ce4:	6a 00                	push   $0x0
+  802ce6:	e8 d3 07 00 00       	call   8034be <ipc_recv>
+}
+  802ceb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cee:	c9                   	leave
+  802cef:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802cf0:	83 ec 0c             	sub    $0xc,%esp
+  802cf3:	6a 02                	push   $0x2
+  802cf5:	e8 68 09 00 00       	call   803662 <ipc_find_env>
+  802cfa:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  802cff:	83 c4 10             	add    $0x10,%esp
+  802d02:	eb c6                	jmp    802cca <nsipc+0x12>
+
+00802d04 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802d04:	55                   	push   %ebp
+  802d05:	89 e5                	mov    %esp,%ebp
+  802d07:	56                   	push   %esi
+  802d08:	53                   	push   %ebx
+  802d09:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802d0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d0f:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802d14:	8b 06                	mov    (%esi),%eax
+  802d16:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802d1b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d20:	e8 93 ff ff ff       	call   802cb8 <nsipc>
+  802d25:	89 c3                	mov    %eax,%ebx
+  802d27:	85 c0                	test   %eax,%eax
+  802d29:	79 09                	jns    802d34 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802d2b:	89 d8                	mov    %ebx,%eax
+  802d2d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d30:	5b                   	pop    %ebx
+  802d31:	5e                   	pop    %esi
+  802d32:	5d                   	pop    %ebp
+  802d33:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802d34:	83 ec 04             	sub    $0x4,%esp
+  802d37:	ff 35 10 90 80 00    	push   0x809010
+  802d3d:	68 00 90 80 00       	push   $0x809000
+  802d42:	ff 75 0c             	push   0xc(%ebp)
+  802d45:	e8 32 dd ff ff       	call   800a7c <memmove>
+		*addrlen = ret->ret_addrlen;
+  802d4a:	a1 10 90 80 00       	mov    0x809010,%eax
+  802d4f:	89 06                	mov    %eax,(%esi)
+  802d51:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802d54:	eb d5                	jmp    802d2b <nsipc_accept+0x27>
+
+00802d56 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802d56:	55                   	push   %ebp
+  802d57:	89 e5                	mov    %esp,%ebp
+  802d59:	53                   	push   %ebx
+  802d5a:	83 ec 08             	sub    $0x8,%esp
+  802d5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802d60:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d63:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802d68:	53                   	push   %ebx
+  802d69:	ff 75 0c             	push   0xc(%ebp)
+  802d6c:	68 04 90 80 00       	push   $0x809004
+  802d71:	e8 06 dd ff ff       	call   800a7c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d76:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802d7c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d81:	e8 32 ff ff ff       	call   802cb8 <nsipc>
+}
+  802d86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d89:	c9                   	leave
+  802d8a:	c3                   	ret
+
+00802d8b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d8b:	55                   	push   %ebp
+  802d8c:	89 e5                	mov    %esp,%ebp
+  802d8e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802d91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d94:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802d99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d9c:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802da1:	b8 03 00 00 00       	mov    $0x3,%eax
+  802da6:	e8 0d ff ff ff       	call   802cb8 <nsipc>
+}
+  802dab:	c9                   	leave
+  802dac:	c3                   	ret
+
+00802dad <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802dad:	55                   	push   %ebp
+  802dae:	89 e5                	mov    %esp,%ebp
+  802db0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802db3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802db6:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802dbb:	b8 04 00 00 00       	mov    $0x4,%eax
+  802dc0:	e8 f3 fe ff ff       	call   802cb8 <nsipc>
+}
+  802dc5:	c9                   	leave
+  802dc6:	c3                   	ret
+
+00802dc7 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802dc7:	55                   	push   %ebp
+  802dc8:	89 e5                	mov    %esp,%ebp
+  802dca:	53                   	push   %ebx
+  802dcb:	83 ec 08             	sub    $0x8,%esp
+  802dce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802dd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dd4:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802dd9:	53                   	push   %ebx
+  802dda:	ff 75 0c             	push   0xc(%ebp)
+  802ddd:	68 04 90 80 00       	push   $0x809004
+  802de2:	e8 95 dc ff ff       	call   800a7c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802de7:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802ded:	b8 05 00 00 00       	mov    $0x5,%eax
+  802df2:	e8 c1 fe ff ff       	call   802cb8 <nsipc>
+}
+  802df7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dfa:	c9                   	leave
+  802dfb:	c3                   	ret
+
+00802dfc <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802dfc:	55                   	push   %ebp
+  802dfd:	89 e5                	mov    %esp,%ebp
+  802dff:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802e02:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e05:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802e0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e0d:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802e12:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e17:	e8 9c fe ff ff       	call   802cb8 <nsipc>
+}
+  802e1c:	c9                   	leave
+  802e1d:	c3                   	ret
+
+00802e1e <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802e1e:	55                   	push   %ebp
+  802e1f:	89 e5                	mov    %esp,%ebp
+  802e21:	56                   	push   %esi
+  802e22:	53                   	push   %ebx
+  802e23:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802e26:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e29:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802e2e:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802e34:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e37:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802e3c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802e41:	e8 72 fe ff ff       	call   802cb8 <nsipc>
+  802e46:	89 c3                	mov    %eax,%ebx
+  802e48:	85 c0                	test   %eax,%eax
+  802e4a:	78 22                	js     802e6e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802e4c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802e51:	39 c6                	cmp    %eax,%esi
+  802e53:	0f 4e c6             	cmovle %esi,%eax
+  802e56:	39 c3                	cmp    %eax,%ebx
+  802e58:	7f 1d                	jg     802e77 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802e5a:	83 ec 04             	sub    $0x4,%esp
+  802e5d:	53                   	push   %ebx
+  802e5e:	68 00 90 80 00       	push   $0x809000
+  802e63:	ff 75 0c             	push   0xc(%ebp)
+  802e66:	e8 11 dc ff ff       	call   800a7c <memmove>
+  802e6b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e6e:	89 d8                	mov    %ebx,%eax
+  802e70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e73:	5b                   	pop    %ebx
+  802e74:	5e                   	pop    %esi
+  802e75:	5d                   	pop    %ebp
+  802e76:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e77:	68 7d 3f 80 00       	push   $0x803f7d
+  802e7c:	68 4c 3e 80 00       	push   $0x803e4c
+  802e81:	6a 62                	push   $0x62
+  802e83:	68 92 3f 80 00       	push   $0x803f92
+  802e88:	e8 a0 d3 ff ff       	call   80022d <_panic>
+
+00802e8d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e8d:	55                   	push   %ebp
+  802e8e:	89 e5                	mov    %esp,%ebp
+  802e90:	53                   	push   %ebx
+  802e91:	83 ec 04             	sub    $0x4,%esp
+  802e94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802e97:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e9a:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802e9f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802ea5:	7f 2e                	jg     802ed5 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802ea7:	83 ec 04             	sub    $0x4,%esp
+  802eaa:	53                   	push   %ebx
+  802eab:	ff 75 0c             	push   0xc(%ebp)
+  802eae:	68 0c 90 80 00       	push   $0x80900c
+  802eb3:	e8 c4 db ff ff       	call   800a7c <memmove>
+	nsipcbuf.send.req_size = size;
+  802eb8:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802ebe:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ec1:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802ec6:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ecb:	e8 e8 fd ff ff       	call   802cb8 <nsipc>
+}
+  802ed0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ed3:	c9                   	leave
+  802ed4:	c3                   	ret
+	assert(size < 1600);
+  802ed5:	68 9e 3f 80 00       	push   $0x803f9e
+  802eda:	68 4c 3e 80 00       	push   $0x803e4c
+  802edf:	6a 6d                	push   $0x6d
+  802ee1:	68 92 3f 80 00       	push   $0x803f92
+  802ee6:	e8 42 d3 ff ff       	call   80022d <_panic>
+
+00802eeb <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802eeb:	55                   	push   %ebp
+  802eec:	89 e5                	mov    %esp,%ebp
+  802eee:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802ef1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ef4:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802ef9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802efc:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802f01:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f04:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802f09:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f0e:	e8 a5 fd ff ff       	call   802cb8 <nsipc>
+}
+  802f13:	c9                   	leave
+  802f14:	c3                   	ret
+
+00802f15 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f15:	55                   	push   %ebp
+  802f16:	89 e5                	mov    %esp,%ebp
+  802f18:	56                   	push   %esi
+  802f19:	53                   	push   %ebx
+  802f1a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f1d:	83 ec 0c             	sub    $0xc,%esp
+  802f20:	ff 75 08             	push   0x8(%ebp)
+  802f23:	e8 00 e5 ff ff       	call   801428 <fd2data>
+  802f28:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f2a:	83 c4 08             	add    $0x8,%esp
+  802f2d:	68 aa 3f 80 00       	push   $0x803faa
+  802f32:	53                   	push   %ebx
+  802f33:	e8 be d9 ff ff       	call   8008f6 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802f38:	8b 46 04             	mov    0x4(%esi),%eax
+  802f3b:	2b 06                	sub    (%esi),%eax
+  802f3d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802f43:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f4a:	00 00 00 
+	stat->st_dev = &devpipe;
+  802f4d:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  802f54:	50 80 00 
+	return 0;
+}
+  802f57:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f5c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f5f:	5b                   	pop    %ebx
+  802f60:	5e                   	pop    %esi
+  802f61:	5d                   	pop    %ebp
+  802f62:	c3                   	ret
+
+00802f63 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802f63:	55                   	push   %ebp
+  802f64:	89 e5                	mov    %esp,%ebp
+  802f66:	53                   	push   %ebx
+  802f67:	83 ec 0c             	sub    $0xc,%esp
+  802f6a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802f6d:	53                   	push   %ebx
+  802f6e:	6a 00                	push   $0x0
+  802f70:	e8 1a de ff ff       	call   800d8f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802f75:	89 1c 24             	mov    %ebx,(%esp)
+  802f78:	e8 ab e4 ff ff       	call   801428 <fd2data>
+  802f7d:	83 c4 08             	add    $0x8,%esp
+  802f80:	50                   	push   %eax
+  802f81:	6a 00                	push   $0x0
+  802f83:	e8 07 de ff ff       	call   800d8f <sys_page_unmap>
+}
+  802f88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f8b:	c9                   	leave
+  802f8c:	c3                   	ret
+
+00802f8d <_pipeisclosed>:
+{
+  802f8d:	55                   	push   %ebp
+  802f8e:	89 e5                	mov    %esp,%ebp
+  802f90:	57                   	push   %edi
+  802f91:	56                   	push   %esi
+  802f92:	53                   	push   %ebx
+  802f93:	83 ec 1c             	sub    $0x1c,%esp
+  802f96:	89 c7                	mov    %eax,%edi
+  802f98:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802f9a:	a1 00 64 80 00       	mov    0x806400,%eax
+  802f9f:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802fa2:	83 ec 0c             	sub    $0xc,%esp
+  802fa5:	57                   	push   %edi
+  802fa6:	e8 f6 06 00 00       	call   8036a1 <pageref>
+  802fab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802fae:	89 34 24             	mov    %esi,(%esp)
+  802fb1:	e8 eb 06 00 00       	call   8036a1 <pageref>
+		nn = thisenv->env_runs;
+  802fb6:	8b 15 00 64 80 00    	mov    0x806400,%edx
+  802fbc:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802fbf:	83 c4 10             	add    $0x10,%esp
+  802fc2:	39 cb                	cmp    %ecx,%ebx
+  802fc4:	74 1b                	je     802fe1 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802fc6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802fc9:	75 cf                	jne    802f9a <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802fcb:	8b 42 58             	mov    0x58(%edx),%eax
+  802fce:	6a 01                	push   $0x1
+  802fd0:	50                   	push   %eax
+  802fd1:	53                   	push   %ebx
+  802fd2:	68 b1 3f 80 00       	push   $0x803fb1
+  802fd7:	e8 2c d3 ff ff       	call   800308 <cprintf>
+  802fdc:	83 c4 10             	add    $0x10,%esp
+  802fdf:	eb b9                	jmp    802f9a <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802fe1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802fe4:	0f 94 c0             	sete   %al
+  802fe7:	0f b6 c0             	movzbl %al,%eax
+}
+  802fea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fed:	5b                   	pop    %ebx
+  802fee:	5e                   	pop    %esi
+  802fef:	5f                   	pop    %edi
+  802ff0:	5d                   	pop    %ebp
+  802ff1:	c3                   	ret
+
+00802ff2 <devpipe_write>:
+{
+  802ff2:	55                   	push   %ebp
+  802ff3:	89 e5                	mov    %esp,%ebp
+  802ff5:	57                   	push   %edi
+  802ff6:	56                   	push   %esi
+  802ff7:	53                   	push   %ebx
+  802ff8:	83 ec 28             	sub    $0x28,%esp
+  802ffb:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802ffe:	56                   	push   %esi
+  802fff:	e8 24 e4 ff ff       	call   801428 <fd2data>
+  803004:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803006:	83 c4 10             	add    $0x10,%esp
+  803009:	bf 00 00 00 00       	mov    $0x0,%edi
+  80300e:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803011:	75 09                	jne    80301c <devpipe_write+0x2a>
+	return i;
+  803013:	89 f8                	mov    %edi,%eax
+  803015:	eb 23                	jmp    80303a <devpipe_write+0x48>
+			sys_yield();
+  803017:	e8 c7 dc ff ff       	call   800ce3 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80301c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80301f:	8b 0b                	mov    (%ebx),%ecx
+  803021:	8d 51 20             	lea    0x20(%ecx),%edx
+  803024:	39 d0                	cmp    %edx,%eax
+  803026:	72 1a                	jb     803042 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803028:	89 da                	mov    %ebx,%edx
+  80302a:	89 f0                	mov    %esi,%eax
+  80302c:	e8 5c ff ff ff       	call   802f8d <_pipeisclosed>
+  803031:	85 c0                	test   %eax,%eax
+  803033:	74 e2                	je     803017 <devpipe_write+0x25>
+				return 0;
+  803035:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80303a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80303d:	5b                   	pop    %ebx
+  80303e:	5e                   	pop    %esi
+  80303f:	5f                   	pop    %edi
+  803040:	5d                   	pop    %ebp
+  803041:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803042:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803045:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803049:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80304c:	89 c2                	mov    %eax,%edx
+  80304e:	c1 fa 1f             	sar    $0x1f,%edx
+  803051:	89 d1                	mov    %edx,%ecx
+  803053:	c1 e9 1b             	shr    $0x1b,%ecx
+  803056:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803059:	83 e2 1f             	and    $0x1f,%edx
+  80305c:	29 ca                	sub    %ecx,%edx
+  80305e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803062:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803066:	83 c0 01             	add    $0x1,%eax
+  803069:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80306c:	83 c7 01             	add    $0x1,%edi
+  80306f:	eb 9d                	jmp    80300e <devpipe_write+0x1c>
+
+00803071 <devpipe_read>:
+{
+  803071:	55                   	push   %ebp
+  803072:	89 e5                	mov    %esp,%ebp
+  803074:	57                   	push   %edi
+  803075:	56                   	push   %esi
+  803076:	53                   	push   %ebx
+  803077:	83 ec 18             	sub    $0x18,%esp
+  80307a:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80307d:	57                   	push   %edi
+  80307e:	e8 a5 e3 ff ff       	call   801428 <fd2data>
+  803083:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803085:	83 c4 10             	add    $0x10,%esp
+  803088:	be 00 00 00 00       	mov    $0x0,%esi
+  80308d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803090:	75 13                	jne    8030a5 <devpipe_read+0x34>
+	return i;
+  803092:	89 f0                	mov    %esi,%eax
+  803094:	eb 02                	jmp    803098 <devpipe_read+0x27>
+				return i;
+  803096:	89 f0                	mov    %esi,%eax
+}
+  803098:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80309b:	5b                   	pop    %ebx
+  80309c:	5e                   	pop    %esi
+  80309d:	5f                   	pop    %edi
+  80309e:	5d                   	pop    %ebp
+  80309f:	c3                   	ret
+			sys_yield();
+  8030a0:	e8 3e dc ff ff       	call   800ce3 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8030a5:	8b 03                	mov    (%ebx),%eax
+  8030a7:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8030aa:	75 18                	jne    8030c4 <devpipe_read+0x53>
+			if (i > 0)
+  8030ac:	85 f6                	test   %esi,%esi
+  8030ae:	75 e6                	jne    803096 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8030b0:	89 da                	mov    %ebx,%edx
+  8030b2:	89 f8                	mov    %edi,%eax
+  8030b4:	e8 d4 fe ff ff       	call   802f8d <_pipeisclosed>
+  8030b9:	85 c0                	test   %eax,%eax
+  8030bb:	74 e3                	je     8030a0 <devpipe_read+0x2f>
+				return 0;
+  8030bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c2:	eb d4                	jmp    803098 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8030c4:	99                   	cltd
+  8030c5:	c1 ea 1b             	shr    $0x1b,%edx
+  8030c8:	01 d0                	add    %edx,%eax
+  8030ca:	83 e0 1f             	and    $0x1f,%eax
+  8030cd:	29 d0                	sub    %edx,%eax
+  8030cf:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8030d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030d7:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8030da:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8030dd:	83 c6 01             	add    $0x1,%esi
+  8030e0:	eb ab                	jmp    80308d <devpipe_read+0x1c>
+
+008030e2 <pipe>:
+{
+  8030e2:	55                   	push   %ebp
+  8030e3:	89 e5                	mov    %esp,%ebp
+  8030e5:	56                   	push   %esi
+  8030e6:	53                   	push   %ebx
+  8030e7:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8030ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030ed:	50                   	push   %eax
+  8030ee:	e8 4c e3 ff ff       	call   80143f <fd_alloc>
+  8030f3:	89 c3                	mov    %eax,%ebx
+  8030f5:	83 c4 10             	add    $0x10,%esp
+  8030f8:	85 c0                	test   %eax,%eax
+  8030fa:	0f 88 23 01 00 00    	js     803223 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803100:	83 ec 04             	sub    $0x4,%esp
+  803103:	68 07 04 00 00       	push   $0x407
+  803108:	ff 75 f4             	push   -0xc(%ebp)
+  80310b:	6a 00                	push   $0x0
+  80310d:	e8 f0 db ff ff       	call   800d02 <sys_page_alloc>
+  803112:	89 c3                	mov    %eax,%ebx
+  803114:	83 c4 10             	add    $0x10,%esp
+  803117:	85 c0                	test   %eax,%eax
+  803119:	0f 88 04 01 00 00    	js     803223 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80311f:	83 ec 0c             	sub    $0xc,%esp
+  803122:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803125:	50                   	push   %eax
+  803126:	e8 14 e3 ff ff       	call   80143f <fd_alloc>
+  80312b:	89 c3                	mov    %eax,%ebx
+  80312d:	83 c4 10             	add    $0x10,%esp
+  803130:	85 c0                	test   %eax,%eax
+  803132:	0f 88 db 00 00 00    	js     803213 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803138:	83 ec 04             	sub    $0x4,%esp
+  80313b:	68 07 04 00 00       	push   $0x407
+  803140:	ff 75 f0             	push   -0x10(%ebp)
+  803143:	6a 00                	push   $0x0
+  803145:	e8 b8 db ff ff       	call   800d02 <sys_page_alloc>
+  80314a:	89 c3                	mov    %eax,%ebx
+  80314c:	83 c4 10             	add    $0x10,%esp
+  80314f:	85 c0                	test   %eax,%eax
+  803151:	0f 88 bc 00 00 00    	js     803213 <pipe+0x131>
+	va = fd2data(fd0);
+  803157:	83 ec 0c             	sub    $0xc,%esp
+  80315a:	ff 75 f4             	push   -0xc(%ebp)
+  80315d:	e8 c6 e2 ff ff       	call   801428 <fd2data>
+  803162:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803164:	83 c4 0c             	add    $0xc,%esp
+  803167:	68 07 04 00 00       	push   $0x407
+  80316c:	50                   	push   %eax
+  80316d:	6a 00                	push   $0x0
+  80316f:	e8 8e db ff ff       	call   800d02 <sys_page_alloc>
+  803174:	89 c3                	mov    %eax,%ebx
+  803176:	83 c4 10             	add    $0x10,%esp
+  803179:	85 c0                	test   %eax,%eax
+  80317b:	0f 88 82 00 00 00    	js     803203 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803181:	83 ec 0c             	sub    $0xc,%esp
+  803184:	ff 75 f0             	push   -0x10(%ebp)
+  803187:	e8 9c e2 ff ff       	call   801428 <fd2data>
+  80318c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803193:	50                   	push   %eax
+  803194:	6a 00                	push   $0x0
+  803196:	56                   	push   %esi
+  803197:	6a 00                	push   $0x0
+  803199:	e8 af db ff ff       	call   800d4d <sys_page_map>
+  80319e:	89 c3                	mov    %eax,%ebx
+  8031a0:	83 c4 20             	add    $0x20,%esp
+  8031a3:	85 c0                	test   %eax,%eax
+  8031a5:	78 4e                	js     8031f5 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8031a7:	a1 60 50 80 00       	mov    0x805060,%eax
+  8031ac:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031af:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8031b1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031b4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8031bb:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8031be:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8031c0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8031c3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8031ca:	83 ec 0c             	sub    $0xc,%esp
+  8031cd:	ff 75 f4             	push   -0xc(%ebp)
+  8031d0:	e8 43 e2 ff ff       	call   801418 <fd2num>
+  8031d5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031d8:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8031da:	83 c4 04             	add    $0x4,%esp
+  8031dd:	ff 75 f0             	push   -0x10(%ebp)
+  8031e0:	e8 33 e2 ff ff       	call   801418 <fd2num>
+  8031e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031e8:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8031eb:	83 c4 10             	add    $0x10,%esp
+  8031ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031f3:	eb 2e                	jmp    803223 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031f5:	83 ec 08             	sub    $0x8,%esp
+  8031f8:	56                   	push   %esi
+  8031f9:	6a 00                	push   $0x0
+  8031fb:	e8 8f db ff ff       	call   800d8f <sys_page_unmap>
+  803200:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803203:	83 ec 08             	sub    $0x8,%esp
+  803206:	ff 75 f0             	push   -0x10(%ebp)
+  803209:	6a 00                	push   $0x0
+  80320b:	e8 7f db ff ff       	call   800d8f <sys_page_unmap>
+  803210:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803213:	83 ec 08             	sub    $0x8,%esp
+  803216:	ff 75 f4             	push   -0xc(%ebp)
+  803219:	6a 00                	push   $0x0
+  80321b:	e8 6f db ff ff       	call   800d8f <sys_page_unmap>
+  803220:	83 c4 10             	add    $0x10,%esp
+}
+  803223:	89 d8                	mov    %ebx,%eax
+  803225:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803228:	5b                   	pop    %ebx
+  803229:	5e                   	pop    %esi
+  80322a:	5d                   	pop    %ebp
+  80322b:	c3                   	ret
+
+0080322c <pipeisclosed>:
+{
+  80322c:	55                   	push   %ebp
+  80322d:	89 e5                	mov    %esp,%ebp
+  80322f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803232:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803235:	50                   	push   %eax
+  803236:	ff 75 08             	push   0x8(%ebp)
+  803239:	e8 57 e2 ff ff       	call   801495 <fd_lookup>
+  80323e:	83 c4 10             	add    $0x10,%esp
+  803241:	85 c0                	test   %eax,%eax
+  803243:	78 18                	js     80325d <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803245:	83 ec 0c             	sub    $0xc,%esp
+  803248:	ff 75 f4             	push   -0xc(%ebp)
+  80324b:	e8 d8 e1 ff ff       	call   801428 <fd2data>
+  803250:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803252:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803255:	e8 33 fd ff ff       	call   802f8d <_pipeisclosed>
+  80325a:	83 c4 10             	add    $0x10,%esp
+}
+  80325d:	c9                   	leave
+  80325e:	c3                   	ret
+
+0080325f <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  80325f:	55                   	push   %ebp
+  803260:	89 e5                	mov    %esp,%ebp
+  803262:	56                   	push   %esi
+  803263:	53                   	push   %ebx
+  803264:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803267:	85 f6                	test   %esi,%esi
+  803269:	74 16                	je     803281 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  80326b:	89 f3                	mov    %esi,%ebx
+  80326d:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803273:	69 db 8c 00 00 00    	imul   $0x8c,%ebx,%ebx
+  803279:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  80327f:	eb 1b                	jmp    80329c <wait+0x3d>
+	assert(envid != 0);
+  803281:	68 c9 3f 80 00       	push   $0x803fc9
+  803286:	68 4c 3e 80 00       	push   $0x803e4c
+  80328b:	6a 09                	push   $0x9
+  80328d:	68 d4 3f 80 00       	push   $0x803fd4
+  803292:	e8 96 cf ff ff       	call   80022d <_panic>
+		sys_yield();
+  803297:	e8 47 da ff ff       	call   800ce3 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80329c:	8b 43 48             	mov    0x48(%ebx),%eax
+  80329f:	39 f0                	cmp    %esi,%eax
+  8032a1:	75 07                	jne    8032aa <wait+0x4b>
+  8032a3:	8b 43 54             	mov    0x54(%ebx),%eax
+  8032a6:	85 c0                	test   %eax,%eax
+  8032a8:	75 ed                	jne    803297 <wait+0x38>
+}
+  8032aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032ad:	5b                   	pop    %ebx
+  8032ae:	5e                   	pop    %esi
+  8032af:	5d                   	pop    %ebp
+  8032b0:	c3                   	ret
+
+008032b1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8032b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b6:	c3                   	ret
+
+008032b7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8032b7:	55                   	push   %ebp
+  8032b8:	89 e5                	mov    %esp,%ebp
+  8032ba:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8032bd:	68 df 3f 80 00       	push   $0x803fdf
+  8032c2:	ff 75 0c             	push   0xc(%ebp)
+  8032c5:	e8 2c d6 ff ff       	call   8008f6 <strcpy>
+	return 0;
+}
+  8032ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032cf:	c9                   	leave
+  8032d0:	c3                   	ret
+
+008032d1 <devcons_write>:
+{
+  8032d1:	55                   	push   %ebp
+  8032d2:	89 e5                	mov    %esp,%ebp
+  8032d4:	57                   	push   %edi
+  8032d5:	56                   	push   %esi
+  8032d6:	53                   	push   %ebx
+  8032d7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8032dd:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8032e2:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8032e8:	eb 2e                	jmp    803318 <devcons_write+0x47>
+		m = n - tot;
+  8032ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8032ed:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8032ef:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8032f4:	39 c3                	cmp    %eax,%ebx
+  8032f6:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8032f9:	83 ec 04             	sub    $0x4,%esp
+  8032fc:	53                   	push   %ebx
+  8032fd:	89 f0                	mov    %esi,%eax
+  8032ff:	03 45 0c             	add    0xc(%ebp),%eax
+  803302:	50                   	push   %eax
+  803303:	57                   	push   %edi
+  803304:	e8 73 d7 ff ff       	call   800a7c <memmove>
+		sys_cputs(buf, m);
+  803309:	83 c4 08             	add    $0x8,%esp
+  80330c:	53                   	push   %ebx
+  80330d:	57                   	push   %edi
+  80330e:	e8 13 d9 ff ff       	call   800c26 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803313:	01 de                	add    %ebx,%esi
+  803315:	83 c4 10             	add    $0x10,%esp
+  803318:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80331b:	72 cd                	jb     8032ea <devcons_write+0x19>
+}
+  80331d:	89 f0                	mov    %esi,%eax
+  80331f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803322:	5b                   	pop    %ebx
+  803323:	5e                   	pop    %esi
+  803324:	5f                   	pop    %edi
+  803325:	5d                   	pop    %ebp
+  803326:	c3                   	ret
+
+00803327 <devcons_read>:
+{
+  803327:	55                   	push   %ebp
+  803328:	89 e5                	mov    %esp,%ebp
+  80332a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80332d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803332:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803336:	75 07                	jne    80333f <devcons_read+0x18>
+  803338:	eb 1f                	jmp    803359 <devcons_read+0x32>
+		sys_yield();
+  80333a:	e8 a4 d9 ff ff       	call   800ce3 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80333f:	e8 08 d9 ff ff       	call   800c4c <sys_cgetc>
+  803344:	85 c0                	test   %eax,%eax
+  803346:	74 f2                	je     80333a <devcons_read+0x13>
+	if (c < 0)
+  803348:	78 0f                	js     803359 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80334a:	83 f8 04             	cmp    $0x4,%eax
+  80334d:	74 0c                	je     80335b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80334f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803352:	88 02                	mov    %al,(%edx)
+	return 1;
+  803354:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803359:	c9                   	leave
+  80335a:	c3                   	ret
+		return 0;
+  80335b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803360:	eb f7                	jmp    803359 <devcons_read+0x32>
+
+00803362 <cputchar>:
+{
+  803362:	55                   	push   %ebp
+  803363:	89 e5                	mov    %esp,%ebp
+  803365:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803368:	8b 45 08             	mov    0x8(%ebp),%eax
+  80336b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80336e:	6a 01                	push   $0x1
+  803370:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803373:	50                   	push   %eax
+  803374:	e8 ad d8 ff ff       	call   800c26 <sys_cputs>
+}
+  803379:	83 c4 10             	add    $0x10,%esp
+  80337c:	c9                   	leave
+  80337d:	c3                   	ret
+
+0080337e <getchar>:
+{
+  80337e:	55                   	push   %ebp
+  80337f:	89 e5                	mov    %esp,%ebp
+  803381:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803384:	6a 01                	push   $0x1
+  803386:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803389:	50                   	push   %eax
+  80338a:	6a 00                	push   $0x0
+  80338c:	e8 6a e3 ff ff       	call   8016fb <read>
+	if (r < 0)
+  803391:	83 c4 10             	add    $0x10,%esp
+  803394:	85 c0                	test   %eax,%eax
+  803396:	78 06                	js     80339e <getchar+0x20>
+	if (r < 1)
+  803398:	74 06                	je     8033a0 <getchar+0x22>
+	return c;
+  80339a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80339e:	c9                   	leave
+  80339f:	c3                   	ret
+		return -E_EOF;
+  8033a0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8033a5:	eb f7                	jmp    80339e <getchar+0x20>
+
+008033a7 <iscons>:
+{
+  8033a7:	55                   	push   %ebp
+  8033a8:	89 e5                	mov    %esp,%ebp
+  8033aa:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033b0:	50                   	push   %eax
+  8033b1:	ff 75 08             	push   0x8(%ebp)
+  8033b4:	e8 dc e0 ff ff       	call   801495 <fd_lookup>
+  8033b9:	83 c4 10             	add    $0x10,%esp
+  8033bc:	85 c0                	test   %eax,%eax
+  8033be:	78 11                	js     8033d1 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8033c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033c3:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8033c9:	39 10                	cmp    %edx,(%eax)
+  8033cb:	0f 94 c0             	sete   %al
+  8033ce:	0f b6 c0             	movzbl %al,%eax
+}
+  8033d1:	c9                   	leave
+  8033d2:	c3                   	ret
+
+008033d3 <opencons>:
+{
+  8033d3:	55                   	push   %ebp
+  8033d4:	89 e5                	mov    %esp,%ebp
+  8033d6:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8033d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033dc:	50                   	push   %eax
+  8033dd:	e8 5d e0 ff ff       	call   80143f <fd_alloc>
+  8033e2:	83 c4 10             	add    $0x10,%esp
+  8033e5:	85 c0                	test   %eax,%eax
+  8033e7:	78 3a                	js     803423 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8033e9:	83 ec 04             	sub    $0x4,%esp
+  8033ec:	68 07 04 00 00       	push   $0x407
+  8033f1:	ff 75 f4             	push   -0xc(%ebp)
+  8033f4:	6a 00                	push   $0x0
+  8033f6:	e8 07 d9 ff ff       	call   800d02 <sys_page_alloc>
+  8033fb:	83 c4 10             	add    $0x10,%esp
+  8033fe:	85 c0                	test   %eax,%eax
+  803400:	78 21                	js     803423 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803402:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803405:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80340b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80340d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803410:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803417:	83 ec 0c             	sub    $0xc,%esp
+  80341a:	50                   	push   %eax
+  80341b:	e8 f8 df ff ff       	call   801418 <fd2num>
+  803420:	83 c4 10             	add    $0x10,%esp
+}
+  803423:	c9                   	leave
+  803424:	c3                   	ret
+
+00803425 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803425:	55                   	push   %ebp
+  803426:	89 e5                	mov    %esp,%ebp
+  803428:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  80342b:	83 3d 04 a0 80 00 00 	cmpl   $0x0,0x80a004
+  803432:	74 0a                	je     80343e <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803434:	8b 45 08             	mov    0x8(%ebp),%eax
+  803437:	a3 04 a0 80 00       	mov    %eax,0x80a004
+}
+  80343c:	c9                   	leave
+  80343d:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80343e:	83 ec 04             	sub    $0x4,%esp
+  803441:	6a 07                	push   $0x7
+  803443:	68 00 f0 bf ee       	push   $0xeebff000
+  803448:	6a 00                	push   $0x0
+  80344a:	e8 b3 d8 ff ff       	call   800d02 <sys_page_alloc>
+  80344f:	83 c4 10             	add    $0x10,%esp
+  803452:	85 c0                	test   %eax,%eax
+  803454:	75 2c                	jne    803482 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803456:	83 ec 08             	sub    $0x8,%esp
+  803459:	68 98 34 80 00       	push   $0x803498
+  80345e:	6a 00                	push   $0x0
+  803460:	e8 08 da ff ff       	call   800e6d <sys_env_set_pgfault_upcall>
+  803465:	83 c4 10             	add    $0x10,%esp
+  803468:	85 c0                	test   %eax,%eax
+  80346a:	74 c8                	je     803434 <set_pgfault_handler+0xf>
+  80346c:	68 34 40 80 00       	push   $0x804034
+  803471:	68 4c 3e 80 00       	push   $0x803e4c
+  803476:	6a 20                	push   $0x20
+  803478:	68 64 40 80 00       	push   $0x804064
+  80347d:	e8 ab cd ff ff       	call   80022d <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803482:	68 ec 3f 80 00       	push   $0x803fec
+  803487:	68 4c 3e 80 00       	push   $0x803e4c
+  80348c:	6a 1e                	push   $0x1e
+  80348e:	68 64 40 80 00       	push   $0x804064
+  803493:	e8 95 cd ff ff       	call   80022d <_panic>
+
+00803498 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803498:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803499:	a1 04 a0 80 00       	mov    0x80a004,%eax
+	call *%eax
+  80349e:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8034a0:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8034a3:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8034a8:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8034ad:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8034b1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8034b4:	83 c4 08             	add    $0x8,%esp
+	popal
+  8034b7:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8034b8:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8034bb:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8034bc:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8034bd:	c3                   	ret
+
+008034be <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8034be:	55                   	push   %ebp
+  8034bf:	89 e5                	mov    %esp,%ebp
+  8034c1:	56                   	push   %esi
+  8034c2:	53                   	push   %ebx
+  8034c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8034cc:	85 c0                	test   %eax,%eax
+  8034ce:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8034d3:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8034d6:	83 ec 0c             	sub    $0xc,%esp
+  8034d9:	50                   	push   %eax
+  8034da:	e8 6b da ff ff       	call   800f4a <sys_ipc_recv>
+	if (from_env_store)
+  8034df:	83 c4 10             	add    $0x10,%esp
+  8034e2:	85 f6                	test   %esi,%esi
+  8034e4:	74 14                	je     8034fa <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8034e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034eb:	85 c0                	test   %eax,%eax
+  8034ed:	75 09                	jne    8034f8 <ipc_recv+0x3a>
+  8034ef:	8b 15 00 64 80 00    	mov    0x806400,%edx
+  8034f5:	8b 52 74             	mov    0x74(%edx),%edx
+  8034f8:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8034fa:	85 db                	test   %ebx,%ebx
+  8034fc:	74 25                	je     803523 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8034fe:	85 c0                	test   %eax,%eax
+  803500:	74 0d                	je     80350f <ipc_recv+0x51>
+  803502:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803508:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80350b:	5b                   	pop    %ebx
+  80350c:	5e                   	pop    %esi
+  80350d:	5d                   	pop    %ebp
+  80350e:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80350f:	a1 00 64 80 00       	mov    0x806400,%eax
+  803514:	8b 40 78             	mov    0x78(%eax),%eax
+  803517:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803519:	a1 00 64 80 00       	mov    0x806400,%eax
+  80351e:	8b 40 70             	mov    0x70(%eax),%eax
+  803521:	eb e5                	jmp    803508 <ipc_recv+0x4a>
+  803523:	85 c0                	test   %eax,%eax
+  803525:	75 e1                	jne    803508 <ipc_recv+0x4a>
+  803527:	eb f0                	jmp    803519 <ipc_recv+0x5b>
+
+00803529 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803529:	55                   	push   %ebp
+  80352a:	89 e5                	mov    %esp,%ebp
+  80352c:	57                   	push   %edi
+  80352d:	56                   	push   %esi
+  80352e:	53                   	push   %ebx
+  80352f:	83 ec 0c             	sub    $0xc,%esp
+  803532:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803535:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803538:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80353b:	85 db                	test   %ebx,%ebx
+  80353d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803542:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803545:	ff 75 14             	push   0x14(%ebp)
+  803548:	53                   	push   %ebx
+  803549:	56                   	push   %esi
+  80354a:	57                   	push   %edi
+  80354b:	e8 67 d9 ff ff       	call   800eb7 <sys_ipc_try_send>
+  803550:	83 c4 10             	add    $0x10,%esp
+  803553:	85 c0                	test   %eax,%eax
+  803555:	74 22                	je     803579 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803557:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80355a:	75 07                	jne    803563 <ipc_send+0x3a>
+		sys_yield();
+  80355c:	e8 82 d7 ff ff       	call   800ce3 <sys_yield>
+  803561:	eb e2                	jmp    803545 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803563:	68 72 40 80 00       	push   $0x804072
+  803568:	68 4c 3e 80 00       	push   $0x803e4c
+  80356d:	6a 39                	push   $0x39
+  80356f:	68 87 40 80 00       	push   $0x804087
+  803574:	e8 b4 cc ff ff       	call   80022d <_panic>
+	}
+}
+  803579:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80357c:	5b                   	pop    %ebx
+  80357d:	5e                   	pop    %esi
+  80357e:	5f                   	pop    %edi
+  80357f:	5d                   	pop    %ebp
+  803580:	c3                   	ret
+
+00803581 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803581:	55                   	push   %ebp
+  803582:	89 e5                	mov    %esp,%ebp
+  803584:	57                   	push   %edi
+  803585:	56                   	push   %esi
+  803586:	53                   	push   %ebx
+  803587:	83 ec 10             	sub    $0x10,%esp
+  80358a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80358d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803590:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803593:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803596:	85 c0                	test   %eax,%eax
+  803598:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80359d:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8035a0:	6a 00                	push   $0x0
+  8035a2:	ff 33                	push   (%ebx)
+  8035a4:	50                   	push   %eax
+  8035a5:	e8 5d d9 ff ff       	call   800f07 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8035aa:	83 c4 10             	add    $0x10,%esp
+  8035ad:	85 c0                	test   %eax,%eax
+  8035af:	75 3c                	jne    8035ed <ipc_recvv+0x6c>
+  8035b1:	8b 15 00 64 80 00    	mov    0x806400,%edx
+  8035b7:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8035ba:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8035bc:	85 ff                	test   %edi,%edi
+  8035be:	74 4e                	je     80360e <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8035c0:	8b 15 00 64 80 00    	mov    0x806400,%edx
+  8035c6:	8b 52 74             	mov    0x74(%edx),%edx
+  8035c9:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8035cb:	85 f6                	test   %esi,%esi
+  8035cd:	74 18                	je     8035e7 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8035cf:	85 c0                	test   %eax,%eax
+  8035d1:	75 2d                	jne    803600 <ipc_recvv+0x7f>
+  8035d3:	a1 00 64 80 00       	mov    0x806400,%eax
+  8035d8:	8b 40 78             	mov    0x78(%eax),%eax
+  8035db:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8035dd:	a1 00 64 80 00       	mov    0x806400,%eax
+  8035e2:	8b 40 70             	mov    0x70(%eax),%eax
+  8035e5:	eb 1f                	jmp    803606 <ipc_recvv+0x85>
+  8035e7:	85 c0                	test   %eax,%eax
+  8035e9:	75 1b                	jne    803606 <ipc_recvv+0x85>
+  8035eb:	eb f0                	jmp    8035dd <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8035ed:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8035f3:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8035f8:	85 ff                	test   %edi,%edi
+  8035fa:	75 cd                	jne    8035c9 <ipc_recvv+0x48>
+	if (perm_store)
+  8035fc:	85 f6                	test   %esi,%esi
+  8035fe:	74 e7                	je     8035e7 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803600:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803606:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803609:	5b                   	pop    %ebx
+  80360a:	5e                   	pop    %esi
+  80360b:	5f                   	pop    %edi
+  80360c:	5d                   	pop    %ebp
+  80360d:	c3                   	ret
+	if (perm_store)
+  80360e:	85 f6                	test   %esi,%esi
+  803610:	75 bd                	jne    8035cf <ipc_recvv+0x4e>
+  803612:	eb c9                	jmp    8035dd <ipc_recvv+0x5c>
+
+00803614 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803614:	55                   	push   %ebp
+  803615:	89 e5                	mov    %esp,%ebp
+  803617:	57                   	push   %edi
+  803618:	56                   	push   %esi
+  803619:	53                   	push   %ebx
+  80361a:	83 ec 0c             	sub    $0xc,%esp
+  80361d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803620:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803623:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  803626:	ff 75 14             	push   0x14(%ebp)
+  803629:	53                   	push   %ebx
+  80362a:	56                   	push   %esi
+  80362b:	57                   	push   %edi
+  80362c:	e8 ae d8 ff ff       	call   800edf <sys_ipc_try_sendv>
+  803631:	83 c4 10             	add    $0x10,%esp
+  803634:	85 c0                	test   %eax,%eax
+  803636:	74 22                	je     80365a <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803638:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80363b:	75 07                	jne    803644 <ipc_sendv+0x30>
+		sys_yield();
+  80363d:	e8 a1 d6 ff ff       	call   800ce3 <sys_yield>
+  803642:	eb e2                	jmp    803626 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803644:	68 72 40 80 00       	push   $0x804072
+  803649:	68 4c 3e 80 00       	push   $0x803e4c
+  80364e:	6a 5c                	push   $0x5c
+  803650:	68 87 40 80 00       	push   $0x804087
+  803655:	e8 d3 cb ff ff       	call   80022d <_panic>
+	}
+}
+  80365a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80365d:	5b                   	pop    %ebx
+  80365e:	5e                   	pop    %esi
+  80365f:	5f                   	pop    %edi
+  803660:	5d                   	pop    %ebp
+  803661:	c3                   	ret
+
+00803662 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803662:	55                   	push   %ebp
+  803663:	89 e5                	mov    %esp,%ebp
+  803665:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803668:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80366d:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803673:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803679:	8b 52 50             	mov    0x50(%edx),%edx
+  80367c:	39 ca                	cmp    %ecx,%edx
+  80367e:	74 11                	je     803691 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803680:	83 c0 01             	add    $0x1,%eax
+  803683:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803688:	75 e3                	jne    80366d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80368a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80368f:	eb 0e                	jmp    80369f <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803691:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803697:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80369c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80369f:	5d                   	pop    %ebp
+  8036a0:	c3                   	ret
+
+008036a1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8036a1:	55                   	push   %ebp
+  8036a2:	89 e5                	mov    %esp,%ebp
+  8036a4:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8036a7:	89 c2                	mov    %eax,%edx
+  8036a9:	c1 ea 16             	shr    $0x16,%edx
+  8036ac:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8036b3:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8036b8:	f6 c1 01             	test   $0x1,%cl
+  8036bb:	74 22                	je     8036df <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8036bd:	c1 e8 0c             	shr    $0xc,%eax
+  8036c0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8036c7:	a8 01                	test   $0x1,%al
+  8036c9:	74 14                	je     8036df <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8036cb:	c1 e8 0c             	shr    $0xc,%eax
+  8036ce:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8036d1:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8036d8:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8036dc:	0f b7 d2             	movzwl %dx,%edx
+}
+  8036df:	89 d0                	mov    %edx,%eax
+  8036e1:	5d                   	pop    %ebp
+  8036e2:	c3                   	ret
+
+008036e3 <dm>:
+  8036e3:	55                   	push   %ebp
+  8036e4:	57                   	push   %edi
+  8036e5:	56                   	push   %esi
+  8036e6:	53                   	push   %ebx
+  8036e7:	83 ec 24             	sub    $0x24,%esp
+  8036ea:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8036ee:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8036f2:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036f6:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036fa:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8036fe:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803702:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803706:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80370b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803710:	ba 00 00 00 00       	mov    $0x0,%edx
+  803715:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80371c:	00 
+  80371d:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803724:	00 
+  803725:	89 fb                	mov    %edi,%ebx
+  803727:	eb 08                	jmp    803731 <dm+0x4e>
+  803729:	83 e9 01             	sub    $0x1,%ecx
+  80372c:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80372f:	74 68                	je     803799 <dm+0xb6>
+  803731:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803735:	01 c0                	add    %eax,%eax
+  803737:	89 c6                	mov    %eax,%esi
+  803739:	89 d7                	mov    %edx,%edi
+  80373b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80373f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803743:	0f ad d0             	shrd   %cl,%edx,%eax
+  803746:	d3 ea                	shr    %cl,%edx
+  803748:	f6 c1 20             	test   $0x20,%cl
+  80374b:	74 04                	je     803751 <dm+0x6e>
+  80374d:	89 d0                	mov    %edx,%eax
+  80374f:	31 d2                	xor    %edx,%edx
+  803751:	83 e0 01             	and    $0x1,%eax
+  803754:	89 04 24             	mov    %eax,(%esp)
+  803757:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80375e:	00 
+  80375f:	8b 04 24             	mov    (%esp),%eax
+  803762:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803766:	09 f0                	or     %esi,%eax
+  803768:	09 fa                	or     %edi,%edx
+  80376a:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80376e:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803772:	39 f0                	cmp    %esi,%eax
+  803774:	89 d5                	mov    %edx,%ebp
+  803776:	19 fd                	sbb    %edi,%ebp
+  803778:	72 af                	jb     803729 <dm+0x46>
+  80377a:	29 f0                	sub    %esi,%eax
+  80377c:	19 fa                	sbb    %edi,%edx
+  80377e:	89 cf                	mov    %ecx,%edi
+  803780:	c1 ef 05             	shr    $0x5,%edi
+  803783:	83 e7 01             	and    $0x1,%edi
+  803786:	89 fe                	mov    %edi,%esi
+  803788:	83 f6 01             	xor    $0x1,%esi
+  80378b:	d3 e6                	shl    %cl,%esi
+  80378d:	d3 e7                	shl    %cl,%edi
+  80378f:	09 74 24 18          	or     %esi,0x18(%esp)
+  803793:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803797:	eb 90                	jmp    803729 <dm+0x46>
+  803799:	85 db                	test   %ebx,%ebx
+  80379b:	74 05                	je     8037a2 <dm+0xbf>
+  80379d:	89 03                	mov    %eax,(%ebx)
+  80379f:	89 53 04             	mov    %edx,0x4(%ebx)
+  8037a2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8037a6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8037aa:	83 c4 24             	add    $0x24,%esp
+  8037ad:	5b                   	pop    %ebx
+  8037ae:	5e                   	pop    %esi
+  8037af:	5f                   	pop    %edi
+  8037b0:	5d                   	pop    %ebp
+  8037b1:	c3                   	ret
+
+008037b2 <__udivdi3>:
+  8037b2:	83 ec 08             	sub    $0x8,%esp
+  8037b5:	6a 00                	push   $0x0
+  8037b7:	ff 74 24 1c          	push   0x1c(%esp)
+  8037bb:	ff 74 24 1c          	push   0x1c(%esp)
+  8037bf:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8037c3:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8037c7:	e8 17 ff ff ff       	call   8036e3 <dm>
+  8037cc:	83 c4 14             	add    $0x14,%esp
+  8037cf:	c3                   	ret
+
+008037d0 <__umoddi3>:
+  8037d0:	83 ec 18             	sub    $0x18,%esp
+  8037d3:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8037d7:	50                   	push   %eax
+  8037d8:	ff 74 24 2c          	push   0x2c(%esp)
+  8037dc:	ff 74 24 2c          	push   0x2c(%esp)
+  8037e0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037e4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037e8:	e8 f6 fe ff ff       	call   8036e3 <dm>
+  8037ed:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8037f1:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8037f5:	83 c4 24             	add    $0x24,%esp
+  8037f8:	c3                   	ret
+
+008037f9 <__divdi3>:
+  8037f9:	53                   	push   %ebx
+  8037fa:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8037fe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803802:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803806:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80380a:	85 d2                	test   %edx,%edx
+  80380c:	78 15                	js     803823 <__divdi3+0x2a>
+  80380e:	85 db                	test   %ebx,%ebx
+  803810:	78 34                	js     803846 <__divdi3+0x4d>
+  803812:	83 ec 04             	sub    $0x4,%esp
+  803815:	6a 00                	push   $0x0
+  803817:	53                   	push   %ebx
+  803818:	51                   	push   %ecx
+  803819:	e8 c5 fe ff ff       	call   8036e3 <dm>
+  80381e:	83 c4 10             	add    $0x10,%esp
+  803821:	eb 21                	jmp    803844 <__divdi3+0x4b>
+  803823:	f7 d8                	neg    %eax
+  803825:	83 d2 00             	adc    $0x0,%edx
+  803828:	f7 da                	neg    %edx
+  80382a:	85 db                	test   %ebx,%ebx
+  80382c:	78 30                	js     80385e <__divdi3+0x65>
+  80382e:	83 ec 04             	sub    $0x4,%esp
+  803831:	6a 00                	push   $0x0
+  803833:	53                   	push   %ebx
+  803834:	51                   	push   %ecx
+  803835:	e8 a9 fe ff ff       	call   8036e3 <dm>
+  80383a:	83 c4 10             	add    $0x10,%esp
+  80383d:	f7 d8                	neg    %eax
+  80383f:	83 d2 00             	adc    $0x0,%edx
+  803842:	f7 da                	neg    %edx
+  803844:	5b                   	pop    %ebx
+  803845:	c3                   	ret
+  803846:	83 ec 04             	sub    $0x4,%esp
+  803849:	6a 00                	push   $0x0
+  80384b:	f7 d9                	neg    %ecx
+  80384d:	83 d3 00             	adc    $0x0,%ebx
+  803850:	f7 db                	neg    %ebx
+  803852:	53                   	push   %ebx
+  803853:	51                   	push   %ecx
+  803854:	e8 8a fe ff ff       	call   8036e3 <dm>
+  803859:	83 c4 10             	add    $0x10,%esp
+  80385c:	eb df                	jmp    80383d <__divdi3+0x44>
+  80385e:	83 ec 04             	sub    $0x4,%esp
+  803861:	6a 00                	push   $0x0
+  803863:	f7 d9                	neg    %ecx
+  803865:	83 d3 00             	adc    $0x0,%ebx
+  803868:	f7 db                	neg    %ebx
+  80386a:	53                   	push   %ebx
+  80386b:	51                   	push   %ecx
+  80386c:	e8 72 fe ff ff       	call   8036e3 <dm>
+  803871:	83 c4 10             	add    $0x10,%esp
+  803874:	eb ce                	jmp    803844 <__divdi3+0x4b>
+
+00803876 <__moddi3>:
+  803876:	55                   	push   %ebp
+  803877:	57                   	push   %edi
+  803878:	56                   	push   %esi
+  803879:	53                   	push   %ebx
+  80387a:	83 ec 24             	sub    $0x24,%esp
+  80387d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803881:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803885:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803889:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80388d:	85 d2                	test   %edx,%edx
+  80388f:	78 3b                	js     8038cc <__moddi3+0x56>
+  803891:	83 ec 04             	sub    $0x4,%esp
+  803894:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803898:	56                   	push   %esi
+  803899:	89 ce                	mov    %ecx,%esi
+  80389b:	f7 de                	neg    %esi
+  80389d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8038a1:	89 de                	mov    %ebx,%esi
+  8038a3:	83 d6 00             	adc    $0x0,%esi
+  8038a6:	f7 de                	neg    %esi
+  8038a8:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8038ac:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8038b0:	0f 48 f1             	cmovs  %ecx,%esi
+  8038b3:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8038b8:	53                   	push   %ebx
+  8038b9:	56                   	push   %esi
+  8038ba:	e8 24 fe ff ff       	call   8036e3 <dm>
+  8038bf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8038c3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038c7:	83 c4 10             	add    $0x10,%esp
+  8038ca:	eb 47                	jmp    803913 <__moddi3+0x9d>
+  8038cc:	f7 d8                	neg    %eax
+  8038ce:	83 d2 00             	adc    $0x0,%edx
+  8038d1:	f7 da                	neg    %edx
+  8038d3:	83 ec 04             	sub    $0x4,%esp
+  8038d6:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8038da:	56                   	push   %esi
+  8038db:	89 cf                	mov    %ecx,%edi
+  8038dd:	f7 df                	neg    %edi
+  8038df:	89 de                	mov    %ebx,%esi
+  8038e1:	83 d6 00             	adc    $0x0,%esi
+  8038e4:	f7 de                	neg    %esi
+  8038e6:	0f 49 cf             	cmovns %edi,%ecx
+  8038e9:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8038ed:	0f 49 de             	cmovns %esi,%ebx
+  8038f0:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8038f4:	ff 74 24 0c          	push   0xc(%esp)
+  8038f8:	ff 74 24 0c          	push   0xc(%esp)
+  8038fc:	e8 e2 fd ff ff       	call   8036e3 <dm>
+  803901:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803905:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803909:	f7 d8                	neg    %eax
+  80390b:	83 d2 00             	adc    $0x0,%edx
+  80390e:	f7 da                	neg    %edx
+  803910:	83 c4 10             	add    $0x10,%esp
+  803913:	83 c4 24             	add    $0x24,%esp
+  803916:	5b                   	pop    %ebx
+  803917:	5e                   	pop    %esi
+  803918:	5f                   	pop    %edi
+  803919:	5d                   	pop    %ebp
+  80391a:	c3                   	ret
@@ -0,0 +1,8194 @@
+
+obj/user/testfile.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 6e 06 00 00       	call   80069f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <xopen>:
+
+#define FVA ((struct Fd*)0xCCCCC000)
+
+static int
+xopen(const char *path, int mode)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	89 d3                	mov    %edx,%ebx
+	extern union Fsipc fsipcbuf;
+	envid_t fsenv;
+	
+	strcpy(fsipcbuf.open.req_path, path);
+  80003c:	50                   	push   %eax
+  80003d:	68 00 70 80 00       	push   $0x807000
+  800042:	e8 84 0d 00 00       	call   800dcb <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800047:	89 1d 00 74 80 00    	mov    %ebx,0x807400
+
+	fsenv = ipc_find_env(ENV_TYPE_FS);
+  80004d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800054:	e8 23 17 00 00       	call   80177c <ipc_find_env>
+	ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800059:	6a 07                	push   $0x7
+  80005b:	68 00 70 80 00       	push   $0x807000
+  800060:	6a 01                	push   $0x1
+  800062:	50                   	push   %eax
+  800063:	e8 db 15 00 00       	call   801643 <ipc_send>
+	return ipc_recv(NULL, FVA, NULL);
+  800068:	83 c4 1c             	add    $0x1c,%esp
+  80006b:	6a 00                	push   $0x0
+  80006d:	68 00 c0 cc cc       	push   $0xccccc000
+  800072:	6a 00                	push   $0x0
+  800074:	e8 5f 15 00 00       	call   8015d8 <ipc_recv>
+}
+  800079:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80007c:	c9                   	leave
+  80007d:	c3                   	ret
+
+0080007e <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80007e:	55                   	push   %ebp
+  80007f:	89 e5                	mov    %esp,%ebp
+  800081:	57                   	push   %edi
+  800082:	56                   	push   %esi
+  800083:	53                   	push   %ebx
+  800084:	81 ec bc 02 00 00    	sub    $0x2bc,%esp
+	struct Fd fdcopy;
+	struct Stat st;
+	char buf[512];
+
+	// We open files manually first, to avoid the FD layer
+	if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  80008a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80008f:	b8 a0 3d 80 00       	mov    $0x803da0,%eax
+  800094:	e8 9a ff ff ff       	call   800033 <xopen>
+  800099:	85 c0                	test   %eax,%eax
+  80009b:	0f 89 1a 04 00 00    	jns    8004bb <umain+0x43d>
+  8000a1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8000a4:	0f 85 ff 03 00 00    	jne    8004a9 <umain+0x42b>
+		panic("serve_open /not-found: %e", r);
+	else if (r >= 0)
+		panic("serve_open /not-found succeeded!");
+
+	if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  8000aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000af:	b8 d5 3d 80 00       	mov    $0x803dd5,%eax
+  8000b4:	e8 7a ff ff ff       	call   800033 <xopen>
+  8000b9:	85 c0                	test   %eax,%eax
+  8000bb:	0f 88 0e 04 00 00    	js     8004cf <umain+0x451>
+		panic("serve_open /newmotd: %e", r);
+	if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  8000c1:	83 3d 00 c0 cc cc 66 	cmpl   $0x66,0xccccc000
+  8000c8:	0f 85 13 04 00 00    	jne    8004e1 <umain+0x463>
+  8000ce:	83 3d 04 c0 cc cc 00 	cmpl   $0x0,0xccccc004
+  8000d5:	0f 85 06 04 00 00    	jne    8004e1 <umain+0x463>
+  8000db:	83 3d 08 c0 cc cc 00 	cmpl   $0x0,0xccccc008
+  8000e2:	0f 85 f9 03 00 00    	jne    8004e1 <umain+0x463>
+		panic("serve_open did not fill struct Fd correctly\n");
+	cprintf("serve_open is good\n");
+  8000e8:	83 ec 0c             	sub    $0xc,%esp
+  8000eb:	68 f6 3d 80 00       	push   $0x803df6
+  8000f0:	e8 e8 06 00 00       	call   8007dd <cprintf>
+
+	if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  8000f5:	83 c4 08             	add    $0x8,%esp
+  8000f8:	8d 85 3c ff ff ff    	lea    -0xc4(%ebp),%eax
+  8000fe:	50                   	push   %eax
+  8000ff:	68 00 c0 cc cc       	push   $0xccccc000
+  800104:	ff 15 34 50 80 00    	call   *0x805034
+  80010a:	83 c4 10             	add    $0x10,%esp
+  80010d:	85 c0                	test   %eax,%eax
+  80010f:	0f 88 e0 03 00 00    	js     8004f5 <umain+0x477>
+		panic("file_stat: %e", r);
+	if (strlen(msg) != st.st_size)
+  800115:	83 ec 0c             	sub    $0xc,%esp
+  800118:	ff 35 00 50 80 00    	push   0x805000
+  80011e:	e8 6d 0c 00 00       	call   800d90 <strlen>
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	3b 45 bc             	cmp    -0x44(%ebp),%eax
+  800129:	0f 85 d8 03 00 00    	jne    800507 <umain+0x489>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+	cprintf("file_stat is good\n");
+  80012f:	83 ec 0c             	sub    $0xc,%esp
+  800132:	68 18 3e 80 00       	push   $0x803e18
+  800137:	e8 a1 06 00 00       	call   8007dd <cprintf>
+
+	memset(buf, 0, sizeof buf);
+  80013c:	83 c4 0c             	add    $0xc,%esp
+  80013f:	68 00 02 00 00       	push   $0x200
+  800144:	6a 00                	push   $0x0
+  800146:	8d 9d 3c fd ff ff    	lea    -0x2c4(%ebp),%ebx
+  80014c:	53                   	push   %ebx
+  80014d:	e8 ca 0d 00 00       	call   800f1c <memset>
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  800152:	83 c4 0c             	add    $0xc,%esp
+  800155:	68 00 02 00 00       	push   $0x200
+  80015a:	53                   	push   %ebx
+  80015b:	68 00 c0 cc cc       	push   $0xccccc000
+  800160:	ff 15 28 50 80 00    	call   *0x805028
+  800166:	83 c4 10             	add    $0x10,%esp
+  800169:	85 c0                	test   %eax,%eax
+  80016b:	0f 88 bb 03 00 00    	js     80052c <umain+0x4ae>
+		panic("file_read: %e", r);
+	if (strcmp(buf, msg) != 0)
+  800171:	83 ec 08             	sub    $0x8,%esp
+  800174:	ff 35 00 50 80 00    	push   0x805000
+  80017a:	8d 85 3c fd ff ff    	lea    -0x2c4(%ebp),%eax
+  800180:	50                   	push   %eax
+  800181:	e8 f6 0c 00 00       	call   800e7c <strcmp>
+  800186:	83 c4 10             	add    $0x10,%esp
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	0f 85 ad 03 00 00    	jne    80053e <umain+0x4c0>
+		panic("file_read returned wrong data");
+	cprintf("file_read is good\n");
+  800191:	83 ec 0c             	sub    $0xc,%esp
+  800194:	68 57 3e 80 00       	push   $0x803e57
+  800199:	e8 3f 06 00 00       	call   8007dd <cprintf>
+
+	if ((r = devfile.dev_close(FVA)) < 0)
+  80019e:	c7 04 24 00 c0 cc cc 	movl   $0xccccc000,(%esp)
+  8001a5:	ff 15 30 50 80 00    	call   *0x805030
+  8001ab:	83 c4 10             	add    $0x10,%esp
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	0f 88 9c 03 00 00    	js     800552 <umain+0x4d4>
+		panic("file_close: %e", r);
+	cprintf("file_close is good\n");
+  8001b6:	83 ec 0c             	sub    $0xc,%esp
+  8001b9:	68 79 3e 80 00       	push   $0x803e79
+  8001be:	e8 1a 06 00 00       	call   8007dd <cprintf>
+
+	// We're about to unmap the FD, but still need a way to get
+	// the stale filenum to serve_read, so we make a local copy.
+	// The file server won't think it's stale until we unmap the
+	// FD page.
+	fdcopy = *FVA;
+  8001c3:	a1 00 c0 cc cc       	mov    0xccccc000,%eax
+  8001c8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8001cb:	a1 04 c0 cc cc       	mov    0xccccc004,%eax
+  8001d0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8001d3:	a1 08 c0 cc cc       	mov    0xccccc008,%eax
+  8001d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8001db:	a1 0c c0 cc cc       	mov    0xccccc00c,%eax
+  8001e0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8001e3:	a1 10 c0 cc cc       	mov    0xccccc010,%eax
+  8001e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001eb:	a1 14 c0 cc cc       	mov    0xccccc014,%eax
+  8001f0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8001f3:	a1 18 c0 cc cc       	mov    0xccccc018,%eax
+  8001f8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001fb:	a1 1c c0 cc cc       	mov    0xccccc01c,%eax
+  800200:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	sys_page_unmap(0, FVA);
+  800203:	83 c4 08             	add    $0x8,%esp
+  800206:	68 00 c0 cc cc       	push   $0xccccc000
+  80020b:	6a 00                	push   $0x0
+  80020d:	e8 52 10 00 00       	call   801264 <sys_page_unmap>
+
+	if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  800212:	83 c4 0c             	add    $0xc,%esp
+  800215:	68 00 02 00 00       	push   $0x200
+  80021a:	8d 85 3c fd ff ff    	lea    -0x2c4(%ebp),%eax
+  800220:	50                   	push   %eax
+  800221:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  800224:	50                   	push   %eax
+  800225:	ff 15 28 50 80 00    	call   *0x805028
+  80022b:	83 c4 10             	add    $0x10,%esp
+  80022e:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800231:	0f 85 2d 03 00 00    	jne    800564 <umain+0x4e6>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+	cprintf("stale fileid is good\n");
+  800237:	83 ec 0c             	sub    $0xc,%esp
+  80023a:	68 8d 3e 80 00       	push   $0x803e8d
+  80023f:	e8 99 05 00 00       	call   8007dd <cprintf>
+
+	// Try writing
+	if ((r = xopen("/new-file", O_RDWR|O_CREAT)) < 0)
+  800244:	ba 02 01 00 00       	mov    $0x102,%edx
+  800249:	b8 a3 3e 80 00       	mov    $0x803ea3,%eax
+  80024e:	e8 e0 fd ff ff       	call   800033 <xopen>
+  800253:	83 c4 10             	add    $0x10,%esp
+  800256:	85 c0                	test   %eax,%eax
+  800258:	0f 88 18 03 00 00    	js     800576 <umain+0x4f8>
+		panic("serve_open /new-file: %e", r);
+
+	if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  80025e:	8b 1d 2c 50 80 00    	mov    0x80502c,%ebx
+  800264:	83 ec 0c             	sub    $0xc,%esp
+  800267:	ff 35 00 50 80 00    	push   0x805000
+  80026d:	e8 1e 0b 00 00       	call   800d90 <strlen>
+  800272:	83 c4 0c             	add    $0xc,%esp
+  800275:	50                   	push   %eax
+  800276:	ff 35 00 50 80 00    	push   0x805000
+  80027c:	68 00 c0 cc cc       	push   $0xccccc000
+  800281:	ff d3                	call   *%ebx
+  800283:	89 c3                	mov    %eax,%ebx
+  800285:	83 c4 04             	add    $0x4,%esp
+  800288:	ff 35 00 50 80 00    	push   0x805000
+  80028e:	e8 fd 0a 00 00       	call   800d90 <strlen>
+  800293:	83 c4 10             	add    $0x10,%esp
+  800296:	39 d8                	cmp    %ebx,%eax
+  800298:	0f 85 ea 02 00 00    	jne    800588 <umain+0x50a>
+		panic("file_write: %e", r);
+	cprintf("file_write is good\n");
+  80029e:	83 ec 0c             	sub    $0xc,%esp
+  8002a1:	68 d5 3e 80 00       	push   $0x803ed5
+  8002a6:	e8 32 05 00 00       	call   8007dd <cprintf>
+
+	FVA->fd_offset = 0;
+  8002ab:	c7 05 04 c0 cc cc 00 	movl   $0x0,0xccccc004
+  8002b2:	00 00 00 
+	memset(buf, 0, sizeof buf);
+  8002b5:	83 c4 0c             	add    $0xc,%esp
+  8002b8:	68 00 02 00 00       	push   $0x200
+  8002bd:	6a 00                	push   $0x0
+  8002bf:	8d 9d 3c fd ff ff    	lea    -0x2c4(%ebp),%ebx
+  8002c5:	53                   	push   %ebx
+  8002c6:	e8 51 0c 00 00       	call   800f1c <memset>
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8002cb:	83 c4 0c             	add    $0xc,%esp
+  8002ce:	68 00 02 00 00       	push   $0x200
+  8002d3:	53                   	push   %ebx
+  8002d4:	68 00 c0 cc cc       	push   $0xccccc000
+  8002d9:	ff 15 28 50 80 00    	call   *0x805028
+  8002df:	89 c3                	mov    %eax,%ebx
+  8002e1:	83 c4 10             	add    $0x10,%esp
+  8002e4:	85 c0                	test   %eax,%eax
+  8002e6:	0f 88 ae 02 00 00    	js     80059a <umain+0x51c>
+		panic("file_read after file_write: %e", r);
+	if (r != strlen(msg))
+  8002ec:	83 ec 0c             	sub    $0xc,%esp
+  8002ef:	ff 35 00 50 80 00    	push   0x805000
+  8002f5:	e8 96 0a 00 00       	call   800d90 <strlen>
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	39 d8                	cmp    %ebx,%eax
+  8002ff:	0f 85 a7 02 00 00    	jne    8005ac <umain+0x52e>
+		panic("file_read after file_write returned wrong length: %d", r);
+	if (strcmp(buf, msg) != 0)
+  800305:	83 ec 08             	sub    $0x8,%esp
+  800308:	ff 35 00 50 80 00    	push   0x805000
+  80030e:	8d 85 3c fd ff ff    	lea    -0x2c4(%ebp),%eax
+  800314:	50                   	push   %eax
+  800315:	e8 62 0b 00 00       	call   800e7c <strcmp>
+  80031a:	83 c4 10             	add    $0x10,%esp
+  80031d:	85 c0                	test   %eax,%eax
+  80031f:	0f 85 99 02 00 00    	jne    8005be <umain+0x540>
+		panic("file_read after file_write returned wrong data");
+	cprintf("file_read after file_write is good\n");
+  800325:	83 ec 0c             	sub    $0xc,%esp
+  800328:	68 9c 40 80 00       	push   $0x80409c
+  80032d:	e8 ab 04 00 00       	call   8007dd <cprintf>
+
+	// Now we'll try out open
+	if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800332:	83 c4 08             	add    $0x8,%esp
+  800335:	6a 00                	push   $0x0
+  800337:	68 a0 3d 80 00       	push   $0x803da0
+  80033c:	e8 13 22 00 00       	call   802554 <open>
+  800341:	83 c4 10             	add    $0x10,%esp
+  800344:	85 c0                	test   %eax,%eax
+  800346:	0f 89 98 02 00 00    	jns    8005e4 <umain+0x566>
+  80034c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80034f:	0f 85 7d 02 00 00    	jne    8005d2 <umain+0x554>
+		panic("open /not-found: %e", r);
+	else if (r >= 0)
+		panic("open /not-found succeeded!");
+
+	if ((r = open("/newmotd", O_RDONLY)) < 0)
+  800355:	83 ec 08             	sub    $0x8,%esp
+  800358:	6a 00                	push   $0x0
+  80035a:	68 d5 3d 80 00       	push   $0x803dd5
+  80035f:	e8 f0 21 00 00       	call   802554 <open>
+  800364:	83 c4 10             	add    $0x10,%esp
+  800367:	85 c0                	test   %eax,%eax
+  800369:	0f 88 89 02 00 00    	js     8005f8 <umain+0x57a>
+		panic("open /newmotd: %e", r);
+	fd = (struct Fd*) (0xD0000000 + r*PGSIZE);
+  80036f:	c1 e0 0c             	shl    $0xc,%eax
+	if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  800372:	83 b8 00 00 00 d0 66 	cmpl   $0x66,-0x30000000(%eax)
+  800379:	0f 85 8b 02 00 00    	jne    80060a <umain+0x58c>
+  80037f:	83 b8 04 00 00 d0 00 	cmpl   $0x0,-0x2ffffffc(%eax)
+  800386:	0f 85 7e 02 00 00    	jne    80060a <umain+0x58c>
+  80038c:	8b 98 08 00 00 d0    	mov    -0x2ffffff8(%eax),%ebx
+  800392:	85 db                	test   %ebx,%ebx
+  800394:	0f 85 70 02 00 00    	jne    80060a <umain+0x58c>
+		panic("open did not fill struct Fd correctly\n");
+	cprintf("open is good\n");
+  80039a:	83 ec 0c             	sub    $0xc,%esp
+  80039d:	68 fc 3d 80 00       	push   $0x803dfc
+  8003a2:	e8 36 04 00 00       	call   8007dd <cprintf>
+
+	// Try files with indirect blocks
+	if ((f = open("/big", O_WRONLY|O_CREAT)) < 0)
+  8003a7:	83 c4 08             	add    $0x8,%esp
+  8003aa:	68 01 01 00 00       	push   $0x101
+  8003af:	68 04 3f 80 00       	push   $0x803f04
+  8003b4:	e8 9b 21 00 00       	call   802554 <open>
+  8003b9:	89 c7                	mov    %eax,%edi
+  8003bb:	83 c4 10             	add    $0x10,%esp
+  8003be:	85 c0                	test   %eax,%eax
+  8003c0:	0f 88 58 02 00 00    	js     80061e <umain+0x5a0>
+		panic("creat /big: %e", f);
+	memset(buf, 0, sizeof(buf));
+  8003c6:	83 ec 04             	sub    $0x4,%esp
+  8003c9:	68 00 02 00 00       	push   $0x200
+  8003ce:	6a 00                	push   $0x0
+  8003d0:	8d 85 3c fd ff ff    	lea    -0x2c4(%ebp),%eax
+  8003d6:	50                   	push   %eax
+  8003d7:	e8 40 0b 00 00       	call   800f1c <memset>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003df:	89 de                	mov    %ebx,%esi
+		*(int*)buf = i;
+  8003e1:	89 b5 3c fd ff ff    	mov    %esi,-0x2c4(%ebp)
+		if ((r = write(f, buf, sizeof(buf))) < 0)
+  8003e7:	83 ec 04             	sub    $0x4,%esp
+  8003ea:	68 00 02 00 00       	push   $0x200
+  8003ef:	8d 85 3c fd ff ff    	lea    -0x2c4(%ebp),%eax
+  8003f5:	50                   	push   %eax
+  8003f6:	57                   	push   %edi
+  8003f7:	e8 70 17 00 00       	call   801b6c <write>
+  8003fc:	83 c4 10             	add    $0x10,%esp
+  8003ff:	85 c0                	test   %eax,%eax
+  800401:	0f 88 29 02 00 00    	js     800630 <umain+0x5b2>
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  800407:	8d 86 00 02 00 00    	lea    0x200(%esi),%eax
+  80040d:	89 c6                	mov    %eax,%esi
+  80040f:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  800414:	75 cb                	jne    8003e1 <umain+0x363>
+			panic("write /big@%d: %e", i, r);
+	}
+	close(f);
+  800416:	83 ec 0c             	sub    $0xc,%esp
+  800419:	57                   	push   %edi
+  80041a:	e8 43 15 00 00       	call   801962 <close>
+
+	if ((f = open("/big", O_RDONLY)) < 0)
+  80041f:	83 c4 08             	add    $0x8,%esp
+  800422:	6a 00                	push   $0x0
+  800424:	68 04 3f 80 00       	push   $0x803f04
+  800429:	e8 26 21 00 00       	call   802554 <open>
+  80042e:	89 c6                	mov    %eax,%esi
+  800430:	83 c4 10             	add    $0x10,%esp
+  800433:	85 c0                	test   %eax,%eax
+  800435:	0f 88 0b 02 00 00    	js     800646 <umain+0x5c8>
+		panic("open /big: %e", f);
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+		*(int*)buf = i;
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  80043b:	8d bd 3c fd ff ff    	lea    -0x2c4(%ebp),%edi
+		*(int*)buf = i;
+  800441:	89 9d 3c fd ff ff    	mov    %ebx,-0x2c4(%ebp)
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  800447:	83 ec 04             	sub    $0x4,%esp
+  80044a:	68 00 02 00 00       	push   $0x200
+  80044f:	57                   	push   %edi
+  800450:	56                   	push   %esi
+  800451:	e8 cf 16 00 00       	call   801b25 <readn>
+  800456:	83 c4 10             	add    $0x10,%esp
+  800459:	85 c0                	test   %eax,%eax
+  80045b:	0f 88 f7 01 00 00    	js     800658 <umain+0x5da>
+			panic("read /big@%d: %e", i, r);
+		if (r != sizeof(buf))
+  800461:	3d 00 02 00 00       	cmp    $0x200,%eax
+  800466:	0f 85 02 02 00 00    	jne    80066e <umain+0x5f0>
+			panic("read /big from %d returned %d < %d bytes",
+			      i, r, sizeof(buf));
+		if (*(int*)buf != i)
+  80046c:	8b 85 3c fd ff ff    	mov    -0x2c4(%ebp),%eax
+  800472:	39 d8                	cmp    %ebx,%eax
+  800474:	0f 85 0f 02 00 00    	jne    800689 <umain+0x60b>
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  80047a:	8d 83 00 02 00 00    	lea    0x200(%ebx),%eax
+  800480:	89 c3                	mov    %eax,%ebx
+  800482:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  800487:	75 b8                	jne    800441 <umain+0x3c3>
+			panic("read /big from %d returned bad data %d",
+			      i, *(int*)buf);
+	}
+	close(f);
+  800489:	83 ec 0c             	sub    $0xc,%esp
+  80048c:	56                   	push   %esi
+  80048d:	e8 d0 14 00 00       	call   801962 <close>
+	cprintf("large file is good\n");
+  800492:	c7 04 24 49 3f 80 00 	movl   $0x803f49,(%esp)
+  800499:	e8 3f 03 00 00       	call   8007dd <cprintf>
+}
+  80049e:	83 c4 10             	add    $0x10,%esp
+  8004a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004a4:	5b                   	pop    %ebx
+  8004a5:	5e                   	pop    %esi
+  8004a6:	5f                   	pop    %edi
+  8004a7:	5d                   	pop    %ebp
+  8004a8:	c3                   	ret
+		panic("serve_open /not-found: %e", r);
+  8004a9:	50                   	push   %eax
+  8004aa:	68 ab 3d 80 00       	push   $0x803dab
+  8004af:	6a 20                	push   $0x20
+  8004b1:	68 c5 3d 80 00       	push   $0x803dc5
+  8004b6:	e8 47 02 00 00       	call   800702 <_panic>
+		panic("serve_open /not-found succeeded!");
+  8004bb:	83 ec 04             	sub    $0x4,%esp
+  8004be:	68 60 3f 80 00       	push   $0x803f60
+  8004c3:	6a 22                	push   $0x22
+  8004c5:	68 c5 3d 80 00       	push   $0x803dc5
+  8004ca:	e8 33 02 00 00       	call   800702 <_panic>
+		panic("serve_open /newmotd: %e", r);
+  8004cf:	50                   	push   %eax
+  8004d0:	68 de 3d 80 00       	push   $0x803dde
+  8004d5:	6a 25                	push   $0x25
+  8004d7:	68 c5 3d 80 00       	push   $0x803dc5
+  8004dc:	e8 21 02 00 00       	call   800702 <_panic>
+		panic("serve_open did not fill struct Fd correctly\n");
+  8004e1:	83 ec 04             	sub    $0x4,%esp
+  8004e4:	68 84 3f 80 00       	push   $0x803f84
+  8004e9:	6a 27                	push   $0x27
+  8004eb:	68 c5 3d 80 00       	push   $0x803dc5
+  8004f0:	e8 0d 02 00 00       	call   800702 <_panic>
+		panic("file_stat: %e", r);
+  8004f5:	50                   	push   %eax
+  8004f6:	68 0a 3e 80 00       	push   $0x803e0a
+  8004fb:	6a 2b                	push   $0x2b
+  8004fd:	68 c5 3d 80 00       	push   $0x803dc5
+  800502:	e8 fb 01 00 00       	call   800702 <_panic>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+  800507:	83 ec 0c             	sub    $0xc,%esp
+  80050a:	ff 35 00 50 80 00    	push   0x805000
+  800510:	e8 7b 08 00 00       	call   800d90 <strlen>
+  800515:	89 04 24             	mov    %eax,(%esp)
+  800518:	ff 75 bc             	push   -0x44(%ebp)
+  80051b:	68 b4 3f 80 00       	push   $0x803fb4
+  800520:	6a 2d                	push   $0x2d
+  800522:	68 c5 3d 80 00       	push   $0x803dc5
+  800527:	e8 d6 01 00 00       	call   800702 <_panic>
+		panic("file_read: %e", r);
+  80052c:	50                   	push   %eax
+  80052d:	68 2b 3e 80 00       	push   $0x803e2b
+  800532:	6a 32                	push   $0x32
+  800534:	68 c5 3d 80 00       	push   $0x803dc5
+  800539:	e8 c4 01 00 00       	call   800702 <_panic>
+		panic("file_read returned wrong data");
+  80053e:	83 ec 04             	sub    $0x4,%esp
+  800541:	68 39 3e 80 00       	push   $0x803e39
+  800546:	6a 34                	push   $0x34
+  800548:	68 c5 3d 80 00       	push   $0x803dc5
+  80054d:	e8 b0 01 00 00       	call   800702 <_panic>
+		panic("file_close: %e", r);
+  800552:	50                   	push   %eax
+  800553:	68 6a 3e 80 00       	push   $0x803e6a
+  800558:	6a 38                	push   $0x38
+  80055a:	68 c5 3d 80 00       	push   $0x803dc5
+  80055f:	e8 9e 01 00 00       	call   800702 <_panic>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+  800564:	50                   	push   %eax
+  800565:	68 dc 3f 80 00       	push   $0x803fdc
+  80056a:	6a 43                	push   $0x43
+  80056c:	68 c5 3d 80 00       	push   $0x803dc5
+  800571:	e8 8c 01 00 00       	call   800702 <_panic>
+		panic("serve_open /new-file: %e", r);
+  800576:	50                   	push   %eax
+  800577:	68 ad 3e 80 00       	push   $0x803ead
+  80057c:	6a 48                	push   $0x48
+  80057e:	68 c5 3d 80 00       	push   $0x803dc5
+  800583:	e8 7a 01 00 00       	call   800702 <_panic>
+		panic("file_write: %e", r);
+  800588:	53                   	push   %ebx
+  800589:	68 c6 3e 80 00       	push   $0x803ec6
+  80058e:	6a 4b                	push   $0x4b
+  800590:	68 c5 3d 80 00       	push   $0x803dc5
+  800595:	e8 68 01 00 00       	call   800702 <_panic>
+		panic("file_read after file_write: %e", r);
+  80059a:	50                   	push   %eax
+  80059b:	68 14 40 80 00       	push   $0x804014
+  8005a0:	6a 51                	push   $0x51
+  8005a2:	68 c5 3d 80 00       	push   $0x803dc5
+  8005a7:	e8 56 01 00 00       	call   800702 <_panic>
+		panic("file_read after file_write returned wrong length: %d", r);
+  8005ac:	53                   	push   %ebx
+  8005ad:	68 34 40 80 00       	push   $0x804034
+  8005b2:	6a 53                	push   $0x53
+  8005b4:	68 c5 3d 80 00       	push   $0x803dc5
+  8005b9:	e8 44 01 00 00       	call   800702 <_panic>
+		panic("file_read after file_write returned wrong data");
+  8005be:	83 ec 04             	sub    $0x4,%esp
+  8005c1:	68 6c 40 80 00       	push   $0x80406c
+  8005c6:	6a 55                	push   $0x55
+  8005c8:	68 c5 3d 80 00       	push   $0x803dc5
+  8005cd:	e8 30 01 00 00       	call   800702 <_panic>
+		panic("open /not-found: %e", r);
+  8005d2:	50                   	push   %eax
+  8005d3:	68 b1 3d 80 00       	push   $0x803db1
+  8005d8:	6a 5a                	push   $0x5a
+  8005da:	68 c5 3d 80 00       	push   $0x803dc5
+  8005df:	e8 1e 01 00 00       	call   800702 <_panic>
+		panic("open /not-found succeeded!");
+  8005e4:	83 ec 04             	sub    $0x4,%esp
+  8005e7:	68 e9 3e 80 00       	push   $0x803ee9
+  8005ec:	6a 5c                	push   $0x5c
+  8005ee:	68 c5 3d 80 00       	push   $0x803dc5
+  8005f3:	e8 0a 01 00 00       	call   800702 <_panic>
+		panic("open /newmotd: %e", r);
+  8005f8:	50                   	push   %eax
+  8005f9:	68 e4 3d 80 00       	push   $0x803de4
+  8005fe:	6a 5f                	push   $0x5f
+  800600:	68 c5 3d 80 00       	push   $0x803dc5
+  800605:	e8 f8 00 00 00       	call   800702 <_panic>
+		panic("open did not fill struct Fd correctly\n");
+  80060a:	83 ec 04             	sub    $0x4,%esp
+  80060d:	68 c0 40 80 00       	push   $0x8040c0
+  800612:	6a 62                	push   $0x62
+  800614:	68 c5 3d 80 00       	push   $0x803dc5
+  800619:	e8 e4 00 00 00       	call   800702 <_panic>
+		panic("creat /big: %e", f);
+  80061e:	50                   	push   %eax
+  80061f:	68 09 3f 80 00       	push   $0x803f09
+  800624:	6a 67                	push   $0x67
+  800626:	68 c5 3d 80 00       	push   $0x803dc5
+  80062b:	e8 d2 00 00 00       	call   800702 <_panic>
+			panic("write /big@%d: %e", i, r);
+  800630:	83 ec 0c             	sub    $0xc,%esp
+  800633:	50                   	push   %eax
+  800634:	56                   	push   %esi
+  800635:	68 18 3f 80 00       	push   $0x803f18
+  80063a:	6a 6c                	push   $0x6c
+  80063c:	68 c5 3d 80 00       	push   $0x803dc5
+  800641:	e8 bc 00 00 00       	call   800702 <_panic>
+		panic("open /big: %e", f);
+  800646:	50                   	push   %eax
+  800647:	68 2a 3f 80 00       	push   $0x803f2a
+  80064c:	6a 71                	push   $0x71
+  80064e:	68 c5 3d 80 00       	push   $0x803dc5
+  800653:	e8 aa 00 00 00       	call   800702 <_panic>
+			panic("read /big@%d: %e", i, r);
+  800658:	83 ec 0c             	sub    $0xc,%esp
+  80065b:	50                   	push   %eax
+  80065c:	53                   	push   %ebx
+  80065d:	68 38 3f 80 00       	push   $0x803f38
+  800662:	6a 75                	push   $0x75
+  800664:	68 c5 3d 80 00       	push   $0x803dc5
+  800669:	e8 94 00 00 00       	call   800702 <_panic>
+			panic("read /big from %d returned %d < %d bytes",
+  80066e:	83 ec 08             	sub    $0x8,%esp
+  800671:	68 00 02 00 00       	push   $0x200
+  800676:	50                   	push   %eax
+  800677:	53                   	push   %ebx
+  800678:	68 e8 40 80 00       	push   $0x8040e8
+  80067d:	6a 77                	push   $0x77
+  80067f:	68 c5 3d 80 00       	push   $0x803dc5
+  800684:	e8 79 00 00 00       	call   800702 <_panic>
+			panic("read /big from %d returned bad data %d",
+  800689:	83 ec 0c             	sub    $0xc,%esp
+  80068c:	50                   	push   %eax
+  80068d:	53                   	push   %ebx
+  80068e:	68 14 41 80 00       	push   $0x804114
+  800693:	6a 7a                	push   $0x7a
+  800695:	68 c5 3d 80 00       	push   $0x803dc5
+  80069a:	e8 63 00 00 00       	call   800702 <_panic>
+
+0080069f <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80069f:	55                   	push   %ebp
+  8006a0:	89 e5                	mov    %esp,%ebp
+  8006a2:	56                   	push   %esi
+  8006a3:	53                   	push   %ebx
+  8006a4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8006a7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8006aa:	e8 e2 0a 00 00       	call   801191 <sys_getenvid>
+  8006af:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8006b4:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8006ba:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8006bf:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8006c4:	85 db                	test   %ebx,%ebx
+  8006c6:	7e 07                	jle    8006cf <libmain+0x30>
+		binaryname = argv[0];
+  8006c8:	8b 06                	mov    (%esi),%eax
+  8006ca:	a3 04 50 80 00       	mov    %eax,0x805004
+
+	// call user main routine
+	umain(argc, argv);
+  8006cf:	83 ec 08             	sub    $0x8,%esp
+  8006d2:	56                   	push   %esi
+  8006d3:	53                   	push   %ebx
+  8006d4:	e8 a5 f9 ff ff       	call   80007e <umain>
+
+	// exit gracefully
+	exit();
+  8006d9:	e8 0a 00 00 00       	call   8006e8 <exit>
+}
+  8006de:	83 c4 10             	add    $0x10,%esp
+  8006e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8006e4:	5b                   	pop    %ebx
+  8006e5:	5e                   	pop    %esi
+  8006e6:	5d                   	pop    %ebp
+  8006e7:	c3                   	ret
+
+008006e8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8006e8:	55                   	push   %ebp
+  8006e9:	89 e5                	mov    %esp,%ebp
+  8006eb:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8006ee:	e8 9c 12 00 00       	call   80198f <close_all>
+	sys_env_destroy(0);
+  8006f3:	83 ec 0c             	sub    $0xc,%esp
+  8006f6:	6a 00                	push   $0x0
+  8006f8:	e8 4b 0a 00 00       	call   801148 <sys_env_destroy>
+}
+  8006fd:	83 c4 10             	add    $0x10,%esp
+  800700:	c9                   	leave
+  800701:	c3                   	ret
+
+00800702 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800702:	55                   	push   %ebp
+  800703:	89 e5                	mov    %esp,%ebp
+  800705:	56                   	push   %esi
+  800706:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800707:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80070a:	8b 35 04 50 80 00    	mov    0x805004,%esi
+  800710:	e8 7c 0a 00 00       	call   801191 <sys_getenvid>
+  800715:	83 ec 0c             	sub    $0xc,%esp
+  800718:	ff 75 0c             	push   0xc(%ebp)
+  80071b:	ff 75 08             	push   0x8(%ebp)
+  80071e:	56                   	push   %esi
+  80071f:	50                   	push   %eax
+  800720:	68 6c 41 80 00       	push   $0x80416c
+  800725:	e8 b3 00 00 00       	call   8007dd <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80072a:	83 c4 18             	add    $0x18,%esp
+  80072d:	53                   	push   %ebx
+  80072e:	ff 75 10             	push   0x10(%ebp)
+  800731:	e8 56 00 00 00       	call   80078c <vcprintf>
+	cprintf("\n");
+  800736:	c7 04 24 46 46 80 00 	movl   $0x804646,(%esp)
+  80073d:	e8 9b 00 00 00       	call   8007dd <cprintf>
+  800742:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800745:	cc                   	int3
+	while (1)
+  800746:	eb fd                	jmp    800745 <_panic+0x43>
+
+00800748 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800748:	55                   	push   %ebp
+  800749:	89 e5                	mov    %esp,%ebp
+  80074b:	53                   	push   %ebx
+  80074c:	83 ec 04             	sub    $0x4,%esp
+  80074f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800752:	8b 13                	mov    (%ebx),%edx
+  800754:	8d 42 01             	lea    0x1(%edx),%eax
+  800757:	89 03                	mov    %eax,(%ebx)
+  800759:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80075c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800760:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800765:	74 09                	je     800770 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800767:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80076b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80076e:	c9                   	leave
+  80076f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800770:	83 ec 08             	sub    $0x8,%esp
+  800773:	68 ff 00 00 00       	push   $0xff
+  800778:	8d 43 08             	lea    0x8(%ebx),%eax
+  80077b:	50                   	push   %eax
+  80077c:	e8 7a 09 00 00       	call   8010fb <sys_cputs>
+		b->idx = 0;
+  800781:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800787:	83 c4 10             	add    $0x10,%esp
+  80078a:	eb db                	jmp    800767 <putch+0x1f>
+
+0080078c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80078c:	55                   	push   %ebp
+  80078d:	89 e5                	mov    %esp,%ebp
+  80078f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800795:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80079c:	00 00 00 
+	b.cnt = 0;
+  80079f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8007a6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8007a9:	ff 75 0c             	push   0xc(%ebp)
+  8007ac:	ff 75 08             	push   0x8(%ebp)
+  8007af:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8007b5:	50                   	push   %eax
+  8007b6:	68 48 07 80 00       	push   $0x800748
+  8007bb:	e8 14 01 00 00       	call   8008d4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8007c0:	83 c4 08             	add    $0x8,%esp
+  8007c3:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8007c9:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8007cf:	50                   	push   %eax
+  8007d0:	e8 26 09 00 00       	call   8010fb <sys_cputs>
+
+	return b.cnt;
+}
+  8007d5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8007db:	c9                   	leave
+  8007dc:	c3                   	ret
+
+008007dd <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8007dd:	55                   	push   %ebp
+  8007de:	89 e5                	mov    %esp,%ebp
+  8007e0:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8007e3:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8007e6:	50                   	push   %eax
+  8007e7:	ff 75 08             	push   0x8(%ebp)
+  8007ea:	e8 9d ff ff ff       	call   80078c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8007ef:	c9                   	leave
+  8007f0:	c3                   	ret
+
+008007f1 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8007f1:	55                   	push   %ebp
+  8007f2:	89 e5                	mov    %esp,%ebp
+  8007f4:	57                   	push   %edi
+  8007f5:	56                   	push   %esi
+  8007f6:	53                   	push   %ebx
+  8007f7:	83 ec 1c             	sub    $0x1c,%esp
+  8007fa:	89 c7                	mov    %eax,%edi
+  8007fc:	89 d6                	mov    %edx,%esi
+  8007fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800801:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800804:	89 d1                	mov    %edx,%ecx
+  800806:	89 c2                	mov    %eax,%edx
+  800808:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80080b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80080e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800811:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800814:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800817:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80081e:	39 c2                	cmp    %eax,%edx
+  800820:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800823:	72 3e                	jb     800863 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800825:	83 ec 0c             	sub    $0xc,%esp
+  800828:	ff 75 18             	push   0x18(%ebp)
+  80082b:	83 eb 01             	sub    $0x1,%ebx
+  80082e:	53                   	push   %ebx
+  80082f:	50                   	push   %eax
+  800830:	83 ec 08             	sub    $0x8,%esp
+  800833:	ff 75 e4             	push   -0x1c(%ebp)
+  800836:	ff 75 e0             	push   -0x20(%ebp)
+  800839:	ff 75 dc             	push   -0x24(%ebp)
+  80083c:	ff 75 d8             	push   -0x28(%ebp)
+  80083f:	e8 f1 33 00 00       	call   803c35 <__udivdi3>
+  800844:	83 c4 18             	add    $0x18,%esp
+  800847:	52                   	push   %edx
+  800848:	50                   	push   %eax
+  800849:	89 f2                	mov    %esi,%edx
+  80084b:	89 f8                	mov    %edi,%eax
+  80084d:	e8 9f ff ff ff       	call   8007f1 <printnum>
+  800852:	83 c4 20             	add    $0x20,%esp
+  800855:	eb 13                	jmp    80086a <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800857:	83 ec 08             	sub    $0x8,%esp
+  80085a:	56                   	push   %esi
+  80085b:	ff 75 18             	push   0x18(%ebp)
+  80085e:	ff d7                	call   *%edi
+  800860:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800863:	83 eb 01             	sub    $0x1,%ebx
+  800866:	85 db                	test   %ebx,%ebx
+  800868:	7f ed                	jg     800857 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80086a:	83 ec 08             	sub    $0x8,%esp
+  80086d:	56                   	push   %esi
+  80086e:	83 ec 04             	sub    $0x4,%esp
+  800871:	ff 75 e4             	push   -0x1c(%ebp)
+  800874:	ff 75 e0             	push   -0x20(%ebp)
+  800877:	ff 75 dc             	push   -0x24(%ebp)
+  80087a:	ff 75 d8             	push   -0x28(%ebp)
+  80087d:	e8 d1 33 00 00       	call   803c53 <__umoddi3>
+  800882:	83 c4 14             	add    $0x14,%esp
+  800885:	0f be 80 8f 41 80 00 	movsbl 0x80418f(%eax),%eax
+  80088c:	50                   	push   %eax
+  80088d:	ff d7                	call   *%edi
+}
+  80088f:	83 c4 10             	add    $0x10,%esp
+  800892:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800895:	5b                   	pop    %ebx
+  800896:	5e                   	pop    %esi
+  800897:	5f                   	pop    %edi
+  800898:	5d                   	pop    %ebp
+  800899:	c3                   	ret
+
+0080089a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80089a:	55                   	push   %ebp
+  80089b:	89 e5                	mov    %esp,%ebp
+  80089d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8008a0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8008a4:	8b 10                	mov    (%eax),%edx
+  8008a6:	3b 50 04             	cmp    0x4(%eax),%edx
+  8008a9:	73 0a                	jae    8008b5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8008ab:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8008ae:	89 08                	mov    %ecx,(%eax)
+  8008b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b3:	88 02                	mov    %al,(%edx)
+}
+  8008b5:	5d                   	pop    %ebp
+  8008b6:	c3                   	ret
+
+008008b7 <printfmt>:
+{
+  8008b7:	55                   	push   %ebp
+  8008b8:	89 e5                	mov    %esp,%ebp
+  8008ba:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8008bd:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8008c0:	50                   	push   %eax
+  8008c1:	ff 75 10             	push   0x10(%ebp)
+  8008c4:	ff 75 0c             	push   0xc(%ebp)
+  8008c7:	ff 75 08             	push   0x8(%ebp)
+  8008ca:	e8 05 00 00 00       	call   8008d4 <vprintfmt>
+}
+  8008cf:	83 c4 10             	add    $0x10,%esp
+  8008d2:	c9                   	leave
+  8008d3:	c3                   	ret
+
+008008d4 <vprintfmt>:
+{
+  8008d4:	55                   	push   %ebp
+  8008d5:	89 e5                	mov    %esp,%ebp
+  8008d7:	57                   	push   %edi
+  8008d8:	56                   	push   %esi
+  8008d9:	53                   	push   %ebx
+  8008da:	83 ec 2c             	sub    $0x2c,%esp
+  8008dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008e0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008e3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8008e6:	eb 0a                	jmp    8008f2 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8008e8:	83 ec 08             	sub    $0x8,%esp
+  8008eb:	53                   	push   %ebx
+  8008ec:	50                   	push   %eax
+  8008ed:	ff d6                	call   *%esi
+  8008ef:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008f2:	83 c7 01             	add    $0x1,%edi
+  8008f5:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8008f9:	83 f8 25             	cmp    $0x25,%eax
+  8008fc:	74 0c                	je     80090a <vprintfmt+0x36>
+			if (ch == '\0')
+  8008fe:	85 c0                	test   %eax,%eax
+  800900:	75 e6                	jne    8008e8 <vprintfmt+0x14>
+}
+  800902:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800905:	5b                   	pop    %ebx
+  800906:	5e                   	pop    %esi
+  800907:	5f                   	pop    %edi
+  800908:	5d                   	pop    %ebp
+  800909:	c3                   	ret
+		padc = ' ';
+  80090a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80090e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800915:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80091c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800923:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800928:	8d 47 01             	lea    0x1(%edi),%eax
+  80092b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80092e:	0f b6 17             	movzbl (%edi),%edx
+  800931:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800934:	3c 55                	cmp    $0x55,%al
+  800936:	0f 87 cf 03 00 00    	ja     800d0b <vprintfmt+0x437>
+  80093c:	0f b6 c0             	movzbl %al,%eax
+  80093f:	ff 24 85 e0 42 80 00 	jmp    *0x8042e0(,%eax,4)
+  800946:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800949:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80094d:	eb d9                	jmp    800928 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80094f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800952:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800956:	eb d0                	jmp    800928 <vprintfmt+0x54>
+  800958:	0f b6 d2             	movzbl %dl,%edx
+  80095b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80095e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800963:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800966:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800969:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80096d:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800970:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800973:	83 f9 09             	cmp    $0x9,%ecx
+  800976:	77 55                	ja     8009cd <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800978:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80097b:	eb e9                	jmp    800966 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  80097d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800980:	8b 00                	mov    (%eax),%eax
+  800982:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800985:	8b 45 14             	mov    0x14(%ebp),%eax
+  800988:	8d 40 04             	lea    0x4(%eax),%eax
+  80098b:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80098e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800991:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800995:	79 91                	jns    800928 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800997:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80099a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80099d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8009a4:	eb 82                	jmp    800928 <vprintfmt+0x54>
+			if (width < 0)
+  8009a6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8009a9:	85 d2                	test   %edx,%edx
+  8009ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b0:	0f 49 c2             	cmovns %edx,%eax
+  8009b3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8009b9:	e9 6a ff ff ff       	jmp    800928 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8009c1:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8009c8:	e9 5b ff ff ff       	jmp    800928 <vprintfmt+0x54>
+  8009cd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8009d0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8009d3:	eb bc                	jmp    800991 <vprintfmt+0xbd>
+			lflag++;
+  8009d5:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8009d8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8009db:	e9 48 ff ff ff       	jmp    800928 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8009e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e3:	8d 78 04             	lea    0x4(%eax),%edi
+  8009e6:	83 ec 08             	sub    $0x8,%esp
+  8009e9:	53                   	push   %ebx
+  8009ea:	ff 30                	push   (%eax)
+  8009ec:	ff d6                	call   *%esi
+			break;
+  8009ee:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8009f1:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8009f4:	e9 b1 02 00 00       	jmp    800caa <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8009f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009fc:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8009ff:	8b 10                	mov    (%eax),%edx
+  800a01:	89 d0                	mov    %edx,%eax
+  800a03:	f7 d8                	neg    %eax
+  800a05:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a08:	83 f8 11             	cmp    $0x11,%eax
+  800a0b:	7f 23                	jg     800a30 <vprintfmt+0x15c>
+  800a0d:	8b 14 85 40 44 80 00 	mov    0x804440(,%eax,4),%edx
+  800a14:	85 d2                	test   %edx,%edx
+  800a16:	74 18                	je     800a30 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800a18:	52                   	push   %edx
+  800a19:	68 f9 44 80 00       	push   $0x8044f9
+  800a1e:	53                   	push   %ebx
+  800a1f:	56                   	push   %esi
+  800a20:	e8 92 fe ff ff       	call   8008b7 <printfmt>
+  800a25:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800a28:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800a2b:	e9 7a 02 00 00       	jmp    800caa <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800a30:	50                   	push   %eax
+  800a31:	68 a7 41 80 00       	push   $0x8041a7
+  800a36:	53                   	push   %ebx
+  800a37:	56                   	push   %esi
+  800a38:	e8 7a fe ff ff       	call   8008b7 <printfmt>
+  800a3d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800a40:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800a43:	e9 62 02 00 00       	jmp    800caa <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a48:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a4b:	83 c0 04             	add    $0x4,%eax
+  800a4e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800a51:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a54:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800a56:	85 c9                	test   %ecx,%ecx
+  800a58:	b8 a0 41 80 00       	mov    $0x8041a0,%eax
+  800a5d:	0f 45 c1             	cmovne %ecx,%eax
+  800a60:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800a63:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800a67:	7e 06                	jle    800a6f <vprintfmt+0x19b>
+  800a69:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800a6d:	75 0b                	jne    800a7a <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a6f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800a72:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800a75:	89 75 08             	mov    %esi,0x8(%ebp)
+  800a78:	eb 5c                	jmp    800ad6 <vprintfmt+0x202>
+  800a7a:	83 ec 08             	sub    $0x8,%esp
+  800a7d:	ff 75 d0             	push   -0x30(%ebp)
+  800a80:	ff 75 cc             	push   -0x34(%ebp)
+  800a83:	e8 20 03 00 00       	call   800da8 <strnlen>
+  800a88:	89 c2                	mov    %eax,%edx
+  800a8a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a8d:	29 d0                	sub    %edx,%eax
+  800a8f:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800a92:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800a96:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a99:	89 75 08             	mov    %esi,0x8(%ebp)
+  800a9c:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a9e:	eb 0e                	jmp    800aae <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800aa0:	83 ec 08             	sub    $0x8,%esp
+  800aa3:	53                   	push   %ebx
+  800aa4:	57                   	push   %edi
+  800aa5:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800aa8:	83 ee 01             	sub    $0x1,%esi
+  800aab:	83 c4 10             	add    $0x10,%esp
+  800aae:	85 f6                	test   %esi,%esi
+  800ab0:	7f ee                	jg     800aa0 <vprintfmt+0x1cc>
+  800ab2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800ab5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ab8:	85 c0                	test   %eax,%eax
+  800aba:	ba 00 00 00 00       	mov    $0x0,%edx
+  800abf:	0f 49 d0             	cmovns %eax,%edx
+  800ac2:	29 d0                	sub    %edx,%eax
+  800ac4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800ac7:	eb a6                	jmp    800a6f <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800ac9:	83 ec 08             	sub    $0x8,%esp
+  800acc:	53                   	push   %ebx
+  800acd:	52                   	push   %edx
+  800ace:	ff 55 08             	call   *0x8(%ebp)
+  800ad1:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ad4:	89 f1                	mov    %esi,%ecx
+  800ad6:	8d 71 01             	lea    0x1(%ecx),%esi
+  800ad9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800add:	0f be d0             	movsbl %al,%edx
+  800ae0:	85 d2                	test   %edx,%edx
+  800ae2:	74 28                	je     800b0c <vprintfmt+0x238>
+  800ae4:	85 ff                	test   %edi,%edi
+  800ae6:	78 05                	js     800aed <vprintfmt+0x219>
+  800ae8:	83 ef 01             	sub    $0x1,%edi
+  800aeb:	78 30                	js     800b1d <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800aed:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800af1:	74 d6                	je     800ac9 <vprintfmt+0x1f5>
+  800af3:	0f be c0             	movsbl %al,%eax
+  800af6:	83 e8 20             	sub    $0x20,%eax
+  800af9:	83 f8 5e             	cmp    $0x5e,%eax
+  800afc:	76 cb                	jbe    800ac9 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800afe:	83 ec 08             	sub    $0x8,%esp
+  800b01:	53                   	push   %ebx
+  800b02:	6a 3f                	push   $0x3f
+  800b04:	ff 55 08             	call   *0x8(%ebp)
+  800b07:	83 c4 10             	add    $0x10,%esp
+  800b0a:	eb c8                	jmp    800ad4 <vprintfmt+0x200>
+  800b0c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b0f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800b12:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800b15:	01 d0                	add    %edx,%eax
+  800b17:	29 c8                	sub    %ecx,%eax
+  800b19:	89 c7                	mov    %eax,%edi
+  800b1b:	eb 13                	jmp    800b30 <vprintfmt+0x25c>
+  800b1d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b20:	eb ed                	jmp    800b0f <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800b22:	83 ec 08             	sub    $0x8,%esp
+  800b25:	53                   	push   %ebx
+  800b26:	6a 20                	push   $0x20
+  800b28:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800b2a:	83 ef 01             	sub    $0x1,%edi
+  800b2d:	83 c4 10             	add    $0x10,%esp
+  800b30:	85 ff                	test   %edi,%edi
+  800b32:	7f ee                	jg     800b22 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800b34:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800b37:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b3a:	e9 6b 01 00 00       	jmp    800caa <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800b3f:	83 f9 01             	cmp    $0x1,%ecx
+  800b42:	7f 1f                	jg     800b63 <vprintfmt+0x28f>
+	else if (lflag)
+  800b44:	85 c9                	test   %ecx,%ecx
+  800b46:	74 67                	je     800baf <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800b48:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b4b:	8b 00                	mov    (%eax),%eax
+  800b4d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b50:	89 c1                	mov    %eax,%ecx
+  800b52:	c1 f9 1f             	sar    $0x1f,%ecx
+  800b55:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b58:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b5b:	8d 40 04             	lea    0x4(%eax),%eax
+  800b5e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b61:	eb 17                	jmp    800b7a <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800b63:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b66:	8b 50 04             	mov    0x4(%eax),%edx
+  800b69:	8b 00                	mov    (%eax),%eax
+  800b6b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b6e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800b71:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b74:	8d 40 08             	lea    0x8(%eax),%eax
+  800b77:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800b7a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b7d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800b80:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800b85:	85 c9                	test   %ecx,%ecx
+  800b87:	0f 89 03 01 00 00    	jns    800c90 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800b8d:	83 ec 08             	sub    $0x8,%esp
+  800b90:	53                   	push   %ebx
+  800b91:	6a 2d                	push   $0x2d
+  800b93:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800b95:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b98:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b9b:	f7 da                	neg    %edx
+  800b9d:	83 d1 00             	adc    $0x0,%ecx
+  800ba0:	f7 d9                	neg    %ecx
+  800ba2:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800ba5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800baa:	e9 e1 00 00 00       	jmp    800c90 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800baf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb2:	8b 00                	mov    (%eax),%eax
+  800bb4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800bb7:	89 c1                	mov    %eax,%ecx
+  800bb9:	c1 f9 1f             	sar    $0x1f,%ecx
+  800bbc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800bbf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc2:	8d 40 04             	lea    0x4(%eax),%eax
+  800bc5:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bc8:	eb b0                	jmp    800b7a <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800bca:	83 f9 01             	cmp    $0x1,%ecx
+  800bcd:	7f 1e                	jg     800bed <vprintfmt+0x319>
+	else if (lflag)
+  800bcf:	85 c9                	test   %ecx,%ecx
+  800bd1:	74 32                	je     800c05 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800bd3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bd6:	8b 10                	mov    (%eax),%edx
+  800bd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bdd:	8d 40 04             	lea    0x4(%eax),%eax
+  800be0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800be3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800be8:	e9 a3 00 00 00       	jmp    800c90 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800bed:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bf0:	8b 10                	mov    (%eax),%edx
+  800bf2:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bf5:	8d 40 08             	lea    0x8(%eax),%eax
+  800bf8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bfb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800c00:	e9 8b 00 00 00       	jmp    800c90 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800c05:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c08:	8b 10                	mov    (%eax),%edx
+  800c0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c0f:	8d 40 04             	lea    0x4(%eax),%eax
+  800c12:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800c15:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800c1a:	eb 74                	jmp    800c90 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800c1c:	83 f9 01             	cmp    $0x1,%ecx
+  800c1f:	7f 1b                	jg     800c3c <vprintfmt+0x368>
+	else if (lflag)
+  800c21:	85 c9                	test   %ecx,%ecx
+  800c23:	74 2c                	je     800c51 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800c25:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c28:	8b 10                	mov    (%eax),%edx
+  800c2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c2f:	8d 40 04             	lea    0x4(%eax),%eax
+  800c32:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c35:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800c3a:	eb 54                	jmp    800c90 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800c3c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c3f:	8b 10                	mov    (%eax),%edx
+  800c41:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c44:	8d 40 08             	lea    0x8(%eax),%eax
+  800c47:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c4a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800c4f:	eb 3f                	jmp    800c90 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800c51:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c54:	8b 10                	mov    (%eax),%edx
+  800c56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c5b:	8d 40 04             	lea    0x4(%eax),%eax
+  800c5e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c61:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800c66:	eb 28                	jmp    800c90 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800c68:	83 ec 08             	sub    $0x8,%esp
+  800c6b:	53                   	push   %ebx
+  800c6c:	6a 30                	push   $0x30
+  800c6e:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800c70:	83 c4 08             	add    $0x8,%esp
+  800c73:	53                   	push   %ebx
+  800c74:	6a 78                	push   $0x78
+  800c76:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800c78:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c7b:	8b 10                	mov    (%eax),%edx
+  800c7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800c82:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800c85:	8d 40 04             	lea    0x4(%eax),%eax
+  800c88:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c8b:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800c90:	83 ec 0c             	sub    $0xc,%esp
+  800c93:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800c97:	50                   	push   %eax
+  800c98:	ff 75 e0             	push   -0x20(%ebp)
+  800c9b:	57                   	push   %edi
+  800c9c:	51                   	push   %ecx
+  800c9d:	52                   	push   %edx
+  800c9e:	89 da                	mov    %ebx,%edx
+  800ca0:	89 f0                	mov    %esi,%eax
+  800ca2:	e8 4a fb ff ff       	call   8007f1 <printnum>
+			break;
+  800ca7:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800caa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800cad:	e9 40 fc ff ff       	jmp    8008f2 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800cb2:	83 f9 01             	cmp    $0x1,%ecx
+  800cb5:	7f 1b                	jg     800cd2 <vprintfmt+0x3fe>
+	else if (lflag)
+  800cb7:	85 c9                	test   %ecx,%ecx
+  800cb9:	74 2c                	je     800ce7 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800cbb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cbe:	8b 10                	mov    (%eax),%edx
+  800cc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cc5:	8d 40 04             	lea    0x4(%eax),%eax
+  800cc8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ccb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800cd0:	eb be                	jmp    800c90 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800cd2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cd5:	8b 10                	mov    (%eax),%edx
+  800cd7:	8b 48 04             	mov    0x4(%eax),%ecx
+  800cda:	8d 40 08             	lea    0x8(%eax),%eax
+  800cdd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ce0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800ce5:	eb a9                	jmp    800c90 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800ce7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cea:	8b 10                	mov    (%eax),%edx
+  800cec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf1:	8d 40 04             	lea    0x4(%eax),%eax
+  800cf4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800cf7:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800cfc:	eb 92                	jmp    800c90 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800cfe:	83 ec 08             	sub    $0x8,%esp
+  800d01:	53                   	push   %ebx
+  800d02:	6a 25                	push   $0x25
+  800d04:	ff d6                	call   *%esi
+			break;
+  800d06:	83 c4 10             	add    $0x10,%esp
+  800d09:	eb 9f                	jmp    800caa <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800d0b:	83 ec 08             	sub    $0x8,%esp
+  800d0e:	53                   	push   %ebx
+  800d0f:	6a 25                	push   $0x25
+  800d11:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800d13:	83 c4 10             	add    $0x10,%esp
+  800d16:	89 f8                	mov    %edi,%eax
+  800d18:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800d1c:	74 05                	je     800d23 <vprintfmt+0x44f>
+  800d1e:	83 e8 01             	sub    $0x1,%eax
+  800d21:	eb f5                	jmp    800d18 <vprintfmt+0x444>
+  800d23:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800d26:	eb 82                	jmp    800caa <vprintfmt+0x3d6>
+
+00800d28 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800d28:	55                   	push   %ebp
+  800d29:	89 e5                	mov    %esp,%ebp
+  800d2b:	83 ec 18             	sub    $0x18,%esp
+  800d2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d31:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800d34:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800d37:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800d3b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800d3e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800d45:	85 c0                	test   %eax,%eax
+  800d47:	74 26                	je     800d6f <vsnprintf+0x47>
+  800d49:	85 d2                	test   %edx,%edx
+  800d4b:	7e 22                	jle    800d6f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800d4d:	ff 75 14             	push   0x14(%ebp)
+  800d50:	ff 75 10             	push   0x10(%ebp)
+  800d53:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800d56:	50                   	push   %eax
+  800d57:	68 9a 08 80 00       	push   $0x80089a
+  800d5c:	e8 73 fb ff ff       	call   8008d4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d61:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800d64:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800d67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d6a:	83 c4 10             	add    $0x10,%esp
+}
+  800d6d:	c9                   	leave
+  800d6e:	c3                   	ret
+		return -E_INVAL;
+  800d6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d74:	eb f7                	jmp    800d6d <vsnprintf+0x45>
+
+00800d76 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d76:	55                   	push   %ebp
+  800d77:	89 e5                	mov    %esp,%ebp
+  800d79:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800d7c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800d7f:	50                   	push   %eax
+  800d80:	ff 75 10             	push   0x10(%ebp)
+  800d83:	ff 75 0c             	push   0xc(%ebp)
+  800d86:	ff 75 08             	push   0x8(%ebp)
+  800d89:	e8 9a ff ff ff       	call   800d28 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800d8e:	c9                   	leave
+  800d8f:	c3                   	ret
+
+00800d90 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800d90:	55                   	push   %ebp
+  800d91:	89 e5                	mov    %esp,%ebp
+  800d93:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800d96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d9b:	eb 03                	jmp    800da0 <strlen+0x10>
+		n++;
+  800d9d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800da0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800da4:	75 f7                	jne    800d9d <strlen+0xd>
+	return n;
+}
+  800da6:	5d                   	pop    %ebp
+  800da7:	c3                   	ret
+
+00800da8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800da8:	55                   	push   %ebp
+  800da9:	89 e5                	mov    %esp,%ebp
+  800dab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800dae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800db1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db6:	eb 03                	jmp    800dbb <strnlen+0x13>
+		n++;
+  800db8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800dbb:	39 d0                	cmp    %edx,%eax
+  800dbd:	74 08                	je     800dc7 <strnlen+0x1f>
+  800dbf:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800dc3:	75 f3                	jne    800db8 <strnlen+0x10>
+  800dc5:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800dc7:	89 d0                	mov    %edx,%eax
+  800dc9:	5d                   	pop    %ebp
+  800dca:	c3                   	ret
+
+00800dcb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800dcb:	55                   	push   %ebp
+  800dcc:	89 e5                	mov    %esp,%ebp
+  800dce:	53                   	push   %ebx
+  800dcf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dd2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800dd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dda:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800dde:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800de1:	83 c0 01             	add    $0x1,%eax
+  800de4:	84 d2                	test   %dl,%dl
+  800de6:	75 f2                	jne    800dda <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800de8:	89 c8                	mov    %ecx,%eax
+  800dea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ded:	c9                   	leave
+  800dee:	c3                   	ret
+
+00800def <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800def:	55                   	push   %ebp
+  800df0:	89 e5                	mov    %esp,%ebp
+  800df2:	53                   	push   %ebx
+  800df3:	83 ec 10             	sub    $0x10,%esp
+  800df6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800df9:	53                   	push   %ebx
+  800dfa:	e8 91 ff ff ff       	call   800d90 <strlen>
+  800dff:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800e02:	ff 75 0c             	push   0xc(%ebp)
+  800e05:	01 d8                	add    %ebx,%eax
+  800e07:	50                   	push   %eax
+  800e08:	e8 be ff ff ff       	call   800dcb <strcpy>
+	return dst;
+}
+  800e0d:	89 d8                	mov    %ebx,%eax
+  800e0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e12:	c9                   	leave
+  800e13:	c3                   	ret
+
+00800e14 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e14:	55                   	push   %ebp
+  800e15:	89 e5                	mov    %esp,%ebp
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+  800e19:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e1c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800e1f:	89 f3                	mov    %esi,%ebx
+  800e21:	03 5d 10             	add    0x10(%ebp),%ebx
+  800e24:	89 f0                	mov    %esi,%eax
+  800e26:	eb 0f                	jmp    800e37 <strncpy+0x23>
+		*dst++ = *src;
+  800e28:	83 c0 01             	add    $0x1,%eax
+  800e2b:	0f b6 0a             	movzbl (%edx),%ecx
+  800e2e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800e31:	80 f9 01             	cmp    $0x1,%cl
+  800e34:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800e37:	39 d8                	cmp    %ebx,%eax
+  800e39:	75 ed                	jne    800e28 <strncpy+0x14>
+	}
+	return ret;
+}
+  800e3b:	89 f0                	mov    %esi,%eax
+  800e3d:	5b                   	pop    %ebx
+  800e3e:	5e                   	pop    %esi
+  800e3f:	5d                   	pop    %ebp
+  800e40:	c3                   	ret
+
+00800e41 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800e41:	55                   	push   %ebp
+  800e42:	89 e5                	mov    %esp,%ebp
+  800e44:	56                   	push   %esi
+  800e45:	53                   	push   %ebx
+  800e46:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800e4f:	89 f0                	mov    %esi,%eax
+  800e51:	85 d2                	test   %edx,%edx
+  800e53:	74 21                	je     800e76 <strlcpy+0x35>
+  800e55:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800e59:	89 f2                	mov    %esi,%edx
+  800e5b:	eb 09                	jmp    800e66 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800e5d:	83 c1 01             	add    $0x1,%ecx
+  800e60:	83 c2 01             	add    $0x1,%edx
+  800e63:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800e66:	39 c2                	cmp    %eax,%edx
+  800e68:	74 09                	je     800e73 <strlcpy+0x32>
+  800e6a:	0f b6 19             	movzbl (%ecx),%ebx
+  800e6d:	84 db                	test   %bl,%bl
+  800e6f:	75 ec                	jne    800e5d <strlcpy+0x1c>
+  800e71:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800e73:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800e76:	29 f0                	sub    %esi,%eax
+}
+  800e78:	5b                   	pop    %ebx
+  800e79:	5e                   	pop    %esi
+  800e7a:	5d                   	pop    %ebp
+  800e7b:	c3                   	ret
+
+00800e7c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800e7c:	55                   	push   %ebp
+  800e7d:	89 e5                	mov    %esp,%ebp
+  800e7f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e82:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800e85:	eb 06                	jmp    800e8d <strcmp+0x11>
+		p++, q++;
+  800e87:	83 c1 01             	add    $0x1,%ecx
+  800e8a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800e8d:	0f b6 01             	movzbl (%ecx),%eax
+  800e90:	84 c0                	test   %al,%al
+  800e92:	74 04                	je     800e98 <strcmp+0x1c>
+  800e94:	3a 02                	cmp    (%edx),%al
+  800e96:	74 ef                	je     800e87 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e98:	0f b6 c0             	movzbl %al,%eax
+  800e9b:	0f b6 12             	movzbl (%edx),%edx
+  800e9e:	29 d0                	sub    %edx,%eax
+}
+  800ea0:	5d                   	pop    %ebp
+  800ea1:	c3                   	ret
+
+00800ea2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ea2:	55                   	push   %ebp
+  800ea3:	89 e5                	mov    %esp,%ebp
+  800ea5:	53                   	push   %ebx
+  800ea6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ea9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eac:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800eaf:	eb 09                	jmp    800eba <strncmp+0x18>
+		n--, p++, q++;
+  800eb1:	83 ea 01             	sub    $0x1,%edx
+  800eb4:	83 c0 01             	add    $0x1,%eax
+  800eb7:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800eba:	85 d2                	test   %edx,%edx
+  800ebc:	74 18                	je     800ed6 <strncmp+0x34>
+  800ebe:	0f b6 18             	movzbl (%eax),%ebx
+  800ec1:	84 db                	test   %bl,%bl
+  800ec3:	74 04                	je     800ec9 <strncmp+0x27>
+  800ec5:	3a 19                	cmp    (%ecx),%bl
+  800ec7:	74 e8                	je     800eb1 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ec9:	0f b6 00             	movzbl (%eax),%eax
+  800ecc:	0f b6 11             	movzbl (%ecx),%edx
+  800ecf:	29 d0                	sub    %edx,%eax
+}
+  800ed1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ed4:	c9                   	leave
+  800ed5:	c3                   	ret
+		return 0;
+  800ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800edb:	eb f4                	jmp    800ed1 <strncmp+0x2f>
+
+00800edd <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800edd:	55                   	push   %ebp
+  800ede:	89 e5                	mov    %esp,%ebp
+  800ee0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ee3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ee7:	eb 03                	jmp    800eec <strchr+0xf>
+  800ee9:	83 c0 01             	add    $0x1,%eax
+  800eec:	0f b6 10             	movzbl (%eax),%edx
+  800eef:	84 d2                	test   %dl,%dl
+  800ef1:	74 06                	je     800ef9 <strchr+0x1c>
+		if (*s == c)
+  800ef3:	38 ca                	cmp    %cl,%dl
+  800ef5:	75 f2                	jne    800ee9 <strchr+0xc>
+  800ef7:	eb 05                	jmp    800efe <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ef9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800efe:	5d                   	pop    %ebp
+  800eff:	c3                   	ret
+
+00800f00 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800f00:	55                   	push   %ebp
+  800f01:	89 e5                	mov    %esp,%ebp
+  800f03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f06:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800f0a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800f0d:	38 ca                	cmp    %cl,%dl
+  800f0f:	74 09                	je     800f1a <strfind+0x1a>
+  800f11:	84 d2                	test   %dl,%dl
+  800f13:	74 05                	je     800f1a <strfind+0x1a>
+	for (; *s; s++)
+  800f15:	83 c0 01             	add    $0x1,%eax
+  800f18:	eb f0                	jmp    800f0a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800f1a:	5d                   	pop    %ebp
+  800f1b:	c3                   	ret
+
+00800f1c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800f1c:	55                   	push   %ebp
+  800f1d:	89 e5                	mov    %esp,%ebp
+  800f1f:	57                   	push   %edi
+  800f20:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800f23:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800f26:	85 c9                	test   %ecx,%ecx
+  800f28:	74 20                	je     800f4a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800f2a:	89 f8                	mov    %edi,%eax
+  800f2c:	09 c8                	or     %ecx,%eax
+  800f2e:	a8 03                	test   $0x3,%al
+  800f30:	75 12                	jne    800f44 <memset+0x28>
+		c &= 0xFF;
+  800f32:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800f36:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800f3c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800f3f:	fc                   	cld
+  800f40:	f3 ab                	rep stos %eax,%es:(%edi)
+  800f42:	eb 06                	jmp    800f4a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800f44:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f47:	fc                   	cld
+  800f48:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800f4a:	89 f8                	mov    %edi,%eax
+  800f4c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800f4f:	c9                   	leave
+  800f50:	c3                   	ret
+
+00800f51 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800f51:	55                   	push   %ebp
+  800f52:	89 e5                	mov    %esp,%ebp
+  800f54:	57                   	push   %edi
+  800f55:	56                   	push   %esi
+  800f56:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f59:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800f5c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800f5f:	39 c6                	cmp    %eax,%esi
+  800f61:	73 32                	jae    800f95 <memmove+0x44>
+  800f63:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800f66:	39 d0                	cmp    %edx,%eax
+  800f68:	73 2b                	jae    800f95 <memmove+0x44>
+		s += n;
+		d += n;
+  800f6a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f6d:	89 d6                	mov    %edx,%esi
+  800f6f:	09 fe                	or     %edi,%esi
+  800f71:	09 ce                	or     %ecx,%esi
+  800f73:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800f79:	75 0e                	jne    800f89 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800f7b:	83 ef 04             	sub    $0x4,%edi
+  800f7e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800f81:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800f84:	fd                   	std
+  800f85:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f87:	eb 09                	jmp    800f92 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800f89:	83 ef 01             	sub    $0x1,%edi
+  800f8c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800f8f:	fd                   	std
+  800f90:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800f92:	fc                   	cld
+  800f93:	eb 1a                	jmp    800faf <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f95:	89 f2                	mov    %esi,%edx
+  800f97:	09 c2                	or     %eax,%edx
+  800f99:	09 ca                	or     %ecx,%edx
+  800f9b:	f6 c2 03             	test   $0x3,%dl
+  800f9e:	75 0a                	jne    800faa <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800fa0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800fa3:	89 c7                	mov    %eax,%edi
+  800fa5:	fc                   	cld
+  800fa6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800fa8:	eb 05                	jmp    800faf <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800faa:	89 c7                	mov    %eax,%edi
+  800fac:	fc                   	cld
+  800fad:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800faf:	5e                   	pop    %esi
+  800fb0:	5f                   	pop    %edi
+  800fb1:	5d                   	pop    %ebp
+  800fb2:	c3                   	ret
+
+00800fb3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800fb3:	55                   	push   %ebp
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800fb9:	ff 75 10             	push   0x10(%ebp)
+  800fbc:	ff 75 0c             	push   0xc(%ebp)
+  800fbf:	ff 75 08             	push   0x8(%ebp)
+  800fc2:	e8 8a ff ff ff       	call   800f51 <memmove>
+}
+  800fc7:	c9                   	leave
+  800fc8:	c3                   	ret
+
+00800fc9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800fc9:	55                   	push   %ebp
+  800fca:	89 e5                	mov    %esp,%ebp
+  800fcc:	56                   	push   %esi
+  800fcd:	53                   	push   %ebx
+  800fce:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fd1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800fd4:	89 c6                	mov    %eax,%esi
+  800fd6:	03 75 10             	add    0x10(%ebp),%esi
+  800fd9:	eb 06                	jmp    800fe1 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800fdb:	83 c0 01             	add    $0x1,%eax
+  800fde:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800fe1:	39 f0                	cmp    %esi,%eax
+  800fe3:	74 14                	je     800ff9 <memcmp+0x30>
+		if (*s1 != *s2)
+  800fe5:	0f b6 08             	movzbl (%eax),%ecx
+  800fe8:	0f b6 1a             	movzbl (%edx),%ebx
+  800feb:	38 d9                	cmp    %bl,%cl
+  800fed:	74 ec                	je     800fdb <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800fef:	0f b6 c1             	movzbl %cl,%eax
+  800ff2:	0f b6 db             	movzbl %bl,%ebx
+  800ff5:	29 d8                	sub    %ebx,%eax
+  800ff7:	eb 05                	jmp    800ffe <memcmp+0x35>
+	}
+
+	return 0;
+  800ff9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ffe:	5b                   	pop    %ebx
+  800fff:	5e                   	pop    %esi
+  801000:	5d                   	pop    %ebp
+  801001:	c3                   	ret
+
+00801002 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801002:	55                   	push   %ebp
+  801003:	89 e5                	mov    %esp,%ebp
+  801005:	8b 45 08             	mov    0x8(%ebp),%eax
+  801008:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80100b:	89 c2                	mov    %eax,%edx
+  80100d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801010:	eb 03                	jmp    801015 <memfind+0x13>
+  801012:	83 c0 01             	add    $0x1,%eax
+  801015:	39 d0                	cmp    %edx,%eax
+  801017:	73 04                	jae    80101d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801019:	38 08                	cmp    %cl,(%eax)
+  80101b:	75 f5                	jne    801012 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80101d:	5d                   	pop    %ebp
+  80101e:	c3                   	ret
+
+0080101f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80101f:	55                   	push   %ebp
+  801020:	89 e5                	mov    %esp,%ebp
+  801022:	57                   	push   %edi
+  801023:	56                   	push   %esi
+  801024:	53                   	push   %ebx
+  801025:	8b 55 08             	mov    0x8(%ebp),%edx
+  801028:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80102b:	eb 03                	jmp    801030 <strtol+0x11>
+		s++;
+  80102d:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801030:	0f b6 02             	movzbl (%edx),%eax
+  801033:	3c 20                	cmp    $0x20,%al
+  801035:	74 f6                	je     80102d <strtol+0xe>
+  801037:	3c 09                	cmp    $0x9,%al
+  801039:	74 f2                	je     80102d <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  80103b:	3c 2b                	cmp    $0x2b,%al
+  80103d:	74 2a                	je     801069 <strtol+0x4a>
+	int neg = 0;
+  80103f:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801044:	3c 2d                	cmp    $0x2d,%al
+  801046:	74 2b                	je     801073 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801048:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80104e:	75 0f                	jne    80105f <strtol+0x40>
+  801050:	80 3a 30             	cmpb   $0x30,(%edx)
+  801053:	74 28                	je     80107d <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801055:	85 db                	test   %ebx,%ebx
+  801057:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80105c:	0f 44 d8             	cmove  %eax,%ebx
+  80105f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801064:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801067:	eb 46                	jmp    8010af <strtol+0x90>
+		s++;
+  801069:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  80106c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801071:	eb d5                	jmp    801048 <strtol+0x29>
+		s++, neg = 1;
+  801073:	83 c2 01             	add    $0x1,%edx
+  801076:	bf 01 00 00 00       	mov    $0x1,%edi
+  80107b:	eb cb                	jmp    801048 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80107d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801081:	74 0e                	je     801091 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801083:	85 db                	test   %ebx,%ebx
+  801085:	75 d8                	jne    80105f <strtol+0x40>
+		s++, base = 8;
+  801087:	83 c2 01             	add    $0x1,%edx
+  80108a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80108f:	eb ce                	jmp    80105f <strtol+0x40>
+		s += 2, base = 16;
+  801091:	83 c2 02             	add    $0x2,%edx
+  801094:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801099:	eb c4                	jmp    80105f <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80109b:	0f be c0             	movsbl %al,%eax
+  80109e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8010a1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8010a4:	7d 3a                	jge    8010e0 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8010a6:	83 c2 01             	add    $0x1,%edx
+  8010a9:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8010ad:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8010af:	0f b6 02             	movzbl (%edx),%eax
+  8010b2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8010b5:	89 f3                	mov    %esi,%ebx
+  8010b7:	80 fb 09             	cmp    $0x9,%bl
+  8010ba:	76 df                	jbe    80109b <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8010bc:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8010bf:	89 f3                	mov    %esi,%ebx
+  8010c1:	80 fb 19             	cmp    $0x19,%bl
+  8010c4:	77 08                	ja     8010ce <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8010c6:	0f be c0             	movsbl %al,%eax
+  8010c9:	83 e8 57             	sub    $0x57,%eax
+  8010cc:	eb d3                	jmp    8010a1 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8010ce:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8010d1:	89 f3                	mov    %esi,%ebx
+  8010d3:	80 fb 19             	cmp    $0x19,%bl
+  8010d6:	77 08                	ja     8010e0 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  8010d8:	0f be c0             	movsbl %al,%eax
+  8010db:	83 e8 37             	sub    $0x37,%eax
+  8010de:	eb c1                	jmp    8010a1 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8010e0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8010e4:	74 05                	je     8010eb <strtol+0xcc>
+		*endptr = (char *) s;
+  8010e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010e9:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8010eb:	89 c8                	mov    %ecx,%eax
+  8010ed:	f7 d8                	neg    %eax
+  8010ef:	85 ff                	test   %edi,%edi
+  8010f1:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8010f4:	89 c8                	mov    %ecx,%eax
+  8010f6:	5b                   	pop    %ebx
+  8010f7:	5e                   	pop    %esi
+  8010f8:	5f                   	pop    %edi
+  8010f9:	5d                   	pop    %ebp
+  8010fa:	c3                   	ret
+
+008010fb <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8010fb:	55                   	push   %ebp
+  8010fc:	89 e5                	mov    %esp,%ebp
+  8010fe:	57                   	push   %edi
+  8010ff:	56                   	push   %esi
+  801100:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801101:	b8 00 00 00 00       	mov    $0x0,%eax
+  801106:	8b 55 08             	mov    0x8(%ebp),%edx
+  801109:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110c:	89 c3                	mov    %eax,%ebx
+  80110e:	89 c7                	mov    %eax,%edi
+  801110:	55                   	push   %ebp
+  801111:	89 e5                	mov    %esp,%ebp
+  801113:	8d 35 1b 11 80 00    	lea    0x80111b,%esi
+  801119:	0f 34                	sysenter
+  80111b:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  80111c:	5b                   	pop    %ebx
+  80111d:	5e                   	pop    %esi
+  80111e:	5f                   	pop    %edi
+  80111f:	5d                   	pop    %ebp
+  801120:	c3                   	ret
+
+00801121 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801121:	55                   	push   %ebp
+  801122:	89 e5                	mov    %esp,%ebp
+  801124:	57                   	push   %edi
+  801125:	56                   	push   %esi
+  801126:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801127:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801131:	89 d1                	mov    %edx,%ecx
+  801133:	89 d3                	mov    %edx,%ebx
+  801135:	89 d7                	mov    %edx,%edi
+  801137:	55                   	push   %ebp
+  801138:	89 e5                	mov    %esp,%ebp
+  80113a:	8d 35 42 11 80 00    	lea    0x801142,%esi
+  801140:	0f 34                	sysenter
+  801142:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  801143:	5b                   	pop    %ebx
+  801144:	5e                   	pop    %esi
+  801145:	5f                   	pop    %edi
+  801146:	5d                   	pop    %ebp
+  801147:	c3                   	ret
+
+00801148 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	57                   	push   %edi
+  80114c:	56                   	push   %esi
+  80114d:	53                   	push   %ebx
+  80114e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801151:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801156:	8b 55 08             	mov    0x8(%ebp),%edx
+  801159:	b8 03 00 00 00       	mov    $0x3,%eax
+  80115e:	89 cb                	mov    %ecx,%ebx
+  801160:	89 cf                	mov    %ecx,%edi
+  801162:	55                   	push   %ebp
+  801163:	89 e5                	mov    %esp,%ebp
+  801165:	8d 35 6d 11 80 00    	lea    0x80116d,%esi
+  80116b:	0f 34                	sysenter
+  80116d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	7f 08                	jg     80117a <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  801172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80117a:	83 ec 0c             	sub    $0xc,%esp
+  80117d:	50                   	push   %eax
+  80117e:	6a 03                	push   $0x3
+  801180:	68 a7 44 80 00       	push   $0x8044a7
+  801185:	6a 3d                	push   $0x3d
+  801187:	68 c4 44 80 00       	push   $0x8044c4
+  80118c:	e8 71 f5 ff ff       	call   800702 <_panic>
+
+00801191 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	57                   	push   %edi
+  801195:	56                   	push   %esi
+  801196:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801197:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119c:	b8 02 00 00 00       	mov    $0x2,%eax
+  8011a1:	89 d1                	mov    %edx,%ecx
+  8011a3:	89 d3                	mov    %edx,%ebx
+  8011a5:	89 d7                	mov    %edx,%edi
+  8011a7:	55                   	push   %ebp
+  8011a8:	89 e5                	mov    %esp,%ebp
+  8011aa:	8d 35 b2 11 80 00    	lea    0x8011b2,%esi
+  8011b0:	0f 34                	sysenter
+  8011b2:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  8011b3:	5b                   	pop    %ebx
+  8011b4:	5e                   	pop    %esi
+  8011b5:	5f                   	pop    %edi
+  8011b6:	5d                   	pop    %ebp
+  8011b7:	c3                   	ret
+
+008011b8 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8011b8:	55                   	push   %ebp
+  8011b9:	89 e5                	mov    %esp,%ebp
+  8011bb:	57                   	push   %edi
+  8011bc:	56                   	push   %esi
+  8011bd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8011c8:	89 d1                	mov    %edx,%ecx
+  8011ca:	89 d3                	mov    %edx,%ebx
+  8011cc:	89 d7                	mov    %edx,%edi
+  8011ce:	89 d6                	mov    %edx,%esi
+  8011d0:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8011d2:	5b                   	pop    %ebx
+  8011d3:	5e                   	pop    %esi
+  8011d4:	5f                   	pop    %edi
+  8011d5:	5d                   	pop    %ebp
+  8011d6:	c3                   	ret
+
+008011d7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8011d7:	55                   	push   %ebp
+  8011d8:	89 e5                	mov    %esp,%ebp
+  8011da:	57                   	push   %edi
+  8011db:	56                   	push   %esi
+  8011dc:	53                   	push   %ebx
+  8011dd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8011e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f3:	55                   	push   %ebp
+  8011f4:	89 e5                	mov    %esp,%ebp
+  8011f6:	8d 35 fe 11 80 00    	lea    0x8011fe,%esi
+  8011fc:	0f 34                	sysenter
+  8011fe:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011ff:	85 c0                	test   %eax,%eax
+  801201:	7f 08                	jg     80120b <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  801203:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801206:	5b                   	pop    %ebx
+  801207:	5e                   	pop    %esi
+  801208:	5f                   	pop    %edi
+  801209:	5d                   	pop    %ebp
+  80120a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80120b:	83 ec 0c             	sub    $0xc,%esp
+  80120e:	50                   	push   %eax
+  80120f:	6a 04                	push   $0x4
+  801211:	68 a7 44 80 00       	push   $0x8044a7
+  801216:	6a 3d                	push   $0x3d
+  801218:	68 c4 44 80 00       	push   $0x8044c4
+  80121d:	e8 e0 f4 ff ff       	call   800702 <_panic>
+
+00801222 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801222:	55                   	push   %ebp
+  801223:	89 e5                	mov    %esp,%ebp
+  801225:	57                   	push   %edi
+  801226:	56                   	push   %esi
+  801227:	53                   	push   %ebx
+  801228:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80122b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801231:	b8 05 00 00 00       	mov    $0x5,%eax
+  801236:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801239:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80123c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80123f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801241:	85 c0                	test   %eax,%eax
+  801243:	7f 08                	jg     80124d <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801245:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801248:	5b                   	pop    %ebx
+  801249:	5e                   	pop    %esi
+  80124a:	5f                   	pop    %edi
+  80124b:	5d                   	pop    %ebp
+  80124c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80124d:	83 ec 0c             	sub    $0xc,%esp
+  801250:	50                   	push   %eax
+  801251:	6a 05                	push   $0x5
+  801253:	68 a7 44 80 00       	push   $0x8044a7
+  801258:	6a 23                	push   $0x23
+  80125a:	68 c4 44 80 00       	push   $0x8044c4
+  80125f:	e8 9e f4 ff ff       	call   800702 <_panic>
+
+00801264 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801264:	55                   	push   %ebp
+  801265:	89 e5                	mov    %esp,%ebp
+  801267:	57                   	push   %edi
+  801268:	56                   	push   %esi
+  801269:	53                   	push   %ebx
+  80126a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80126d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801272:	8b 55 08             	mov    0x8(%ebp),%edx
+  801275:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801278:	b8 06 00 00 00       	mov    $0x6,%eax
+  80127d:	89 df                	mov    %ebx,%edi
+  80127f:	55                   	push   %ebp
+  801280:	89 e5                	mov    %esp,%ebp
+  801282:	8d 35 8a 12 80 00    	lea    0x80128a,%esi
+  801288:	0f 34                	sysenter
+  80128a:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80128b:	85 c0                	test   %eax,%eax
+  80128d:	7f 08                	jg     801297 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  80128f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801292:	5b                   	pop    %ebx
+  801293:	5e                   	pop    %esi
+  801294:	5f                   	pop    %edi
+  801295:	5d                   	pop    %ebp
+  801296:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801297:	83 ec 0c             	sub    $0xc,%esp
+  80129a:	50                   	push   %eax
+  80129b:	6a 06                	push   $0x6
+  80129d:	68 a7 44 80 00       	push   $0x8044a7
+  8012a2:	6a 3d                	push   $0x3d
+  8012a4:	68 c4 44 80 00       	push   $0x8044c4
+  8012a9:	e8 54 f4 ff ff       	call   800702 <_panic>
+
+008012ae <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8012ae:	55                   	push   %ebp
+  8012af:	89 e5                	mov    %esp,%ebp
+  8012b1:	57                   	push   %edi
+  8012b2:	56                   	push   %esi
+  8012b3:	53                   	push   %ebx
+  8012b4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8012b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012c7:	89 df                	mov    %ebx,%edi
+  8012c9:	55                   	push   %ebp
+  8012ca:	89 e5                	mov    %esp,%ebp
+  8012cc:	8d 35 d4 12 80 00    	lea    0x8012d4,%esi
+  8012d2:	0f 34                	sysenter
+  8012d4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8012d5:	85 c0                	test   %eax,%eax
+  8012d7:	7f 08                	jg     8012e1 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  8012d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012dc:	5b                   	pop    %ebx
+  8012dd:	5e                   	pop    %esi
+  8012de:	5f                   	pop    %edi
+  8012df:	5d                   	pop    %ebp
+  8012e0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012e1:	83 ec 0c             	sub    $0xc,%esp
+  8012e4:	50                   	push   %eax
+  8012e5:	6a 08                	push   $0x8
+  8012e7:	68 a7 44 80 00       	push   $0x8044a7
+  8012ec:	6a 3d                	push   $0x3d
+  8012ee:	68 c4 44 80 00       	push   $0x8044c4
+  8012f3:	e8 0a f4 ff ff       	call   800702 <_panic>
+
+008012f8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	57                   	push   %edi
+  8012fc:	56                   	push   %esi
+  8012fd:	53                   	push   %ebx
+  8012fe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801301:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801306:	8b 55 08             	mov    0x8(%ebp),%edx
+  801309:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801311:	89 df                	mov    %ebx,%edi
+  801313:	55                   	push   %ebp
+  801314:	89 e5                	mov    %esp,%ebp
+  801316:	8d 35 1e 13 80 00    	lea    0x80131e,%esi
+  80131c:	0f 34                	sysenter
+  80131e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80131f:	85 c0                	test   %eax,%eax
+  801321:	7f 08                	jg     80132b <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  801323:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801326:	5b                   	pop    %ebx
+  801327:	5e                   	pop    %esi
+  801328:	5f                   	pop    %edi
+  801329:	5d                   	pop    %ebp
+  80132a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80132b:	83 ec 0c             	sub    $0xc,%esp
+  80132e:	50                   	push   %eax
+  80132f:	6a 09                	push   $0x9
+  801331:	68 a7 44 80 00       	push   $0x8044a7
+  801336:	6a 3d                	push   $0x3d
+  801338:	68 c4 44 80 00       	push   $0x8044c4
+  80133d:	e8 c0 f3 ff ff       	call   800702 <_panic>
+
+00801342 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801342:	55                   	push   %ebp
+  801343:	89 e5                	mov    %esp,%ebp
+  801345:	57                   	push   %edi
+  801346:	56                   	push   %esi
+  801347:	53                   	push   %ebx
+  801348:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80134b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801350:	8b 55 08             	mov    0x8(%ebp),%edx
+  801353:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801356:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80135b:	89 df                	mov    %ebx,%edi
+  80135d:	55                   	push   %ebp
+  80135e:	89 e5                	mov    %esp,%ebp
+  801360:	8d 35 68 13 80 00    	lea    0x801368,%esi
+  801366:	0f 34                	sysenter
+  801368:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801369:	85 c0                	test   %eax,%eax
+  80136b:	7f 08                	jg     801375 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  80136d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801370:	5b                   	pop    %ebx
+  801371:	5e                   	pop    %esi
+  801372:	5f                   	pop    %edi
+  801373:	5d                   	pop    %ebp
+  801374:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801375:	83 ec 0c             	sub    $0xc,%esp
+  801378:	50                   	push   %eax
+  801379:	6a 0a                	push   $0xa
+  80137b:	68 a7 44 80 00       	push   $0x8044a7
+  801380:	6a 3d                	push   $0x3d
+  801382:	68 c4 44 80 00       	push   $0x8044c4
+  801387:	e8 76 f3 ff ff       	call   800702 <_panic>
+
+0080138c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80138c:	55                   	push   %ebp
+  80138d:	89 e5                	mov    %esp,%ebp
+  80138f:	57                   	push   %edi
+  801390:	56                   	push   %esi
+  801391:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801392:	8b 55 08             	mov    0x8(%ebp),%edx
+  801395:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801398:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80139d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013a3:	55                   	push   %ebp
+  8013a4:	89 e5                	mov    %esp,%ebp
+  8013a6:	8d 35 ae 13 80 00    	lea    0x8013ae,%esi
+  8013ac:	0f 34                	sysenter
+  8013ae:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  8013af:	5b                   	pop    %ebx
+  8013b0:	5e                   	pop    %esi
+  8013b1:	5f                   	pop    %edi
+  8013b2:	5d                   	pop    %ebp
+  8013b3:	c3                   	ret
+
+008013b4 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  8013b4:	55                   	push   %ebp
+  8013b5:	89 e5                	mov    %esp,%ebp
+  8013b7:	57                   	push   %edi
+  8013b8:	56                   	push   %esi
+  8013b9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8013ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8013c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013cb:	55                   	push   %ebp
+  8013cc:	89 e5                	mov    %esp,%ebp
+  8013ce:	8d 35 d6 13 80 00    	lea    0x8013d6,%esi
+  8013d4:	0f 34                	sysenter
+  8013d6:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  8013d7:	5b                   	pop    %ebx
+  8013d8:	5e                   	pop    %esi
+  8013d9:	5f                   	pop    %edi
+  8013da:	5d                   	pop    %ebp
+  8013db:	c3                   	ret
+
+008013dc <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  8013dc:	55                   	push   %ebp
+  8013dd:	89 e5                	mov    %esp,%ebp
+  8013df:	57                   	push   %edi
+  8013e0:	56                   	push   %esi
+  8013e1:	53                   	push   %ebx
+  8013e2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f8:	89 f7                	mov    %esi,%edi
+  8013fa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013fc:	85 c0                	test   %eax,%eax
+  8013fe:	7f 08                	jg     801408 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  801400:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801403:	5b                   	pop    %ebx
+  801404:	5e                   	pop    %esi
+  801405:	5f                   	pop    %edi
+  801406:	5d                   	pop    %ebp
+  801407:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801408:	83 ec 0c             	sub    $0xc,%esp
+  80140b:	50                   	push   %eax
+  80140c:	6a 0d                	push   $0xd
+  80140e:	68 a7 44 80 00       	push   $0x8044a7
+  801413:	6a 23                	push   $0x23
+  801415:	68 c4 44 80 00       	push   $0x8044c4
+  80141a:	e8 e3 f2 ff ff       	call   800702 <_panic>
+
+0080141f <sys_ipc_recv>:
+{
+  80141f:	55                   	push   %ebp
+  801420:	89 e5                	mov    %esp,%ebp
+  801422:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  801425:	6a 00                	push   $0x0
+  801427:	6a 01                	push   $0x1
+  801429:	ff 75 08             	push   0x8(%ebp)
+  80142c:	e8 ab ff ff ff       	call   8013dc <sys_ipc_recvv>
+}
+  801431:	c9                   	leave
+  801432:	c3                   	ret
+
+00801433 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  801433:	55                   	push   %ebp
+  801434:	89 e5                	mov    %esp,%ebp
+  801436:	57                   	push   %edi
+  801437:	56                   	push   %esi
+  801438:	53                   	push   %ebx
+  801439:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80143c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801441:	8b 55 08             	mov    0x8(%ebp),%edx
+  801444:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801447:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80144c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80144f:	89 de                	mov    %ebx,%esi
+  801451:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801453:	85 c0                	test   %eax,%eax
+  801455:	7f 08                	jg     80145f <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  801457:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80145a:	5b                   	pop    %ebx
+  80145b:	5e                   	pop    %esi
+  80145c:	5f                   	pop    %edi
+  80145d:	5d                   	pop    %ebp
+  80145e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80145f:	83 ec 0c             	sub    $0xc,%esp
+  801462:	50                   	push   %eax
+  801463:	6a 0d                	push   $0xd
+  801465:	68 a7 44 80 00       	push   $0x8044a7
+  80146a:	6a 23                	push   $0x23
+  80146c:	68 c4 44 80 00       	push   $0x8044c4
+  801471:	e8 8c f2 ff ff       	call   800702 <_panic>
+
+00801476 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801476:	55                   	push   %ebp
+  801477:	89 e5                	mov    %esp,%ebp
+  801479:	57                   	push   %edi
+  80147a:	56                   	push   %esi
+  80147b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80147c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801481:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801486:	89 d1                	mov    %edx,%ecx
+  801488:	89 d3                	mov    %edx,%ebx
+  80148a:	89 d7                	mov    %edx,%edi
+  80148c:	55                   	push   %ebp
+  80148d:	89 e5                	mov    %esp,%ebp
+  80148f:	8d 35 97 14 80 00    	lea    0x801497,%esi
+  801495:	0f 34                	sysenter
+  801497:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  801498:	5b                   	pop    %ebx
+  801499:	5e                   	pop    %esi
+  80149a:	5f                   	pop    %edi
+  80149b:	5d                   	pop    %ebp
+  80149c:	c3                   	ret
+
+0080149d <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  80149d:	55                   	push   %ebp
+  80149e:	89 e5                	mov    %esp,%ebp
+  8014a0:	57                   	push   %edi
+  8014a1:	56                   	push   %esi
+  8014a2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8014a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ae:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8014b3:	89 df                	mov    %ebx,%edi
+  8014b5:	55                   	push   %ebp
+  8014b6:	89 e5                	mov    %esp,%ebp
+  8014b8:	8d 35 c0 14 80 00    	lea    0x8014c0,%esi
+  8014be:	0f 34                	sysenter
+  8014c0:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  8014c1:	5b                   	pop    %ebx
+  8014c2:	5e                   	pop    %esi
+  8014c3:	5f                   	pop    %edi
+  8014c4:	5d                   	pop    %ebp
+  8014c5:	c3                   	ret
+
+008014c6 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  8014c6:	55                   	push   %ebp
+  8014c7:	89 e5                	mov    %esp,%ebp
+  8014c9:	57                   	push   %edi
+  8014ca:	56                   	push   %esi
+  8014cb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8014cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d4:	b8 10 00 00 00       	mov    $0x10,%eax
+  8014d9:	89 cb                	mov    %ecx,%ebx
+  8014db:	89 cf                	mov    %ecx,%edi
+  8014dd:	55                   	push   %ebp
+  8014de:	89 e5                	mov    %esp,%ebp
+  8014e0:	8d 35 e8 14 80 00    	lea    0x8014e8,%esi
+  8014e6:	0f 34                	sysenter
+  8014e8:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  8014e9:	5b                   	pop    %ebx
+  8014ea:	5e                   	pop    %esi
+  8014eb:	5f                   	pop    %edi
+  8014ec:	5d                   	pop    %ebp
+  8014ed:	c3                   	ret
+
+008014ee <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  8014ee:	55                   	push   %ebp
+  8014ef:	89 e5                	mov    %esp,%ebp
+  8014f1:	57                   	push   %edi
+  8014f2:	56                   	push   %esi
+  8014f3:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8014f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ff:	b8 12 00 00 00       	mov    $0x12,%eax
+  801504:	89 df                	mov    %ebx,%edi
+  801506:	55                   	push   %ebp
+  801507:	89 e5                	mov    %esp,%ebp
+  801509:	8d 35 11 15 80 00    	lea    0x801511,%esi
+  80150f:	0f 34                	sysenter
+  801511:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  801512:	5b                   	pop    %ebx
+  801513:	5e                   	pop    %esi
+  801514:	5f                   	pop    %edi
+  801515:	5d                   	pop    %ebp
+  801516:	c3                   	ret
+
+00801517 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  801517:	55                   	push   %ebp
+  801518:	89 e5                	mov    %esp,%ebp
+  80151a:	57                   	push   %edi
+  80151b:	56                   	push   %esi
+  80151c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80151d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801522:	8b 55 08             	mov    0x8(%ebp),%edx
+  801525:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801528:	b8 14 00 00 00       	mov    $0x14,%eax
+  80152d:	89 df                	mov    %ebx,%edi
+  80152f:	55                   	push   %ebp
+  801530:	89 e5                	mov    %esp,%ebp
+  801532:	8d 35 3a 15 80 00    	lea    0x80153a,%esi
+  801538:	0f 34                	sysenter
+  80153a:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  80153b:	5b                   	pop    %ebx
+  80153c:	5e                   	pop    %esi
+  80153d:	5f                   	pop    %edi
+  80153e:	5d                   	pop    %ebp
+  80153f:	c3                   	ret
+
+00801540 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  801540:	55                   	push   %ebp
+  801541:	89 e5                	mov    %esp,%ebp
+  801543:	57                   	push   %edi
+  801544:	56                   	push   %esi
+  801545:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801546:	8b 55 08             	mov    0x8(%ebp),%edx
+  801549:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154c:	b8 13 00 00 00       	mov    $0x13,%eax
+  801551:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801554:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801557:	55                   	push   %ebp
+  801558:	89 e5                	mov    %esp,%ebp
+  80155a:	8d 35 62 15 80 00    	lea    0x801562,%esi
+  801560:	0f 34                	sysenter
+  801562:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  801563:	5b                   	pop    %ebx
+  801564:	5e                   	pop    %esi
+  801565:	5f                   	pop    %edi
+  801566:	5d                   	pop    %ebp
+  801567:	c3                   	ret
+
+00801568 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	57                   	push   %edi
+  80156c:	56                   	push   %esi
+  80156d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80156e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801573:	8b 55 08             	mov    0x8(%ebp),%edx
+  801576:	b8 11 00 00 00       	mov    $0x11,%eax
+  80157b:	89 cb                	mov    %ecx,%ebx
+  80157d:	89 cf                	mov    %ecx,%edi
+  80157f:	89 ce                	mov    %ecx,%esi
+  801581:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  801583:	5b                   	pop    %ebx
+  801584:	5e                   	pop    %esi
+  801585:	5f                   	pop    %edi
+  801586:	5d                   	pop    %ebp
+  801587:	c3                   	ret
+
+00801588 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  801588:	55                   	push   %ebp
+  801589:	89 e5                	mov    %esp,%ebp
+  80158b:	57                   	push   %edi
+  80158c:	56                   	push   %esi
+  80158d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80158e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801593:	8b 55 08             	mov    0x8(%ebp),%edx
+  801596:	b8 15 00 00 00       	mov    $0x15,%eax
+  80159b:	89 cb                	mov    %ecx,%ebx
+  80159d:	89 cf                	mov    %ecx,%edi
+  80159f:	55                   	push   %ebp
+  8015a0:	89 e5                	mov    %esp,%ebp
+  8015a2:	8d 35 aa 15 80 00    	lea    0x8015aa,%esi
+  8015a8:	0f 34                	sysenter
+  8015aa:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8015ab:	5b                   	pop    %ebx
+  8015ac:	5e                   	pop    %esi
+  8015ad:	5f                   	pop    %edi
+  8015ae:	5d                   	pop    %ebp
+  8015af:	c3                   	ret
+
+008015b0 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8015b0:	55                   	push   %ebp
+  8015b1:	89 e5                	mov    %esp,%ebp
+  8015b3:	57                   	push   %edi
+  8015b4:	56                   	push   %esi
+  8015b5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8015b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015be:	b8 16 00 00 00       	mov    $0x16,%eax
+  8015c3:	89 cb                	mov    %ecx,%ebx
+  8015c5:	89 cf                	mov    %ecx,%edi
+  8015c7:	55                   	push   %ebp
+  8015c8:	89 e5                	mov    %esp,%ebp
+  8015ca:	8d 35 d2 15 80 00    	lea    0x8015d2,%esi
+  8015d0:	0f 34                	sysenter
+  8015d2:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8015d3:	5b                   	pop    %ebx
+  8015d4:	5e                   	pop    %esi
+  8015d5:	5f                   	pop    %edi
+  8015d6:	5d                   	pop    %ebp
+  8015d7:	c3                   	ret
+
+008015d8 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8015d8:	55                   	push   %ebp
+  8015d9:	89 e5                	mov    %esp,%ebp
+  8015db:	56                   	push   %esi
+  8015dc:	53                   	push   %ebx
+  8015dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8015e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8015e6:	85 c0                	test   %eax,%eax
+  8015e8:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8015ed:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8015f0:	83 ec 0c             	sub    $0xc,%esp
+  8015f3:	50                   	push   %eax
+  8015f4:	e8 26 fe ff ff       	call   80141f <sys_ipc_recv>
+	if (from_env_store)
+  8015f9:	83 c4 10             	add    $0x10,%esp
+  8015fc:	85 f6                	test   %esi,%esi
+  8015fe:	74 14                	je     801614 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801600:	ba 00 00 00 00       	mov    $0x0,%edx
+  801605:	85 c0                	test   %eax,%eax
+  801607:	75 09                	jne    801612 <ipc_recv+0x3a>
+  801609:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80160f:	8b 52 74             	mov    0x74(%edx),%edx
+  801612:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  801614:	85 db                	test   %ebx,%ebx
+  801616:	74 25                	je     80163d <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801618:	85 c0                	test   %eax,%eax
+  80161a:	74 0d                	je     801629 <ipc_recv+0x51>
+  80161c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  801622:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801625:	5b                   	pop    %ebx
+  801626:	5e                   	pop    %esi
+  801627:	5d                   	pop    %ebp
+  801628:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801629:	a1 00 60 80 00       	mov    0x806000,%eax
+  80162e:	8b 40 78             	mov    0x78(%eax),%eax
+  801631:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  801633:	a1 00 60 80 00       	mov    0x806000,%eax
+  801638:	8b 40 70             	mov    0x70(%eax),%eax
+  80163b:	eb e5                	jmp    801622 <ipc_recv+0x4a>
+  80163d:	85 c0                	test   %eax,%eax
+  80163f:	75 e1                	jne    801622 <ipc_recv+0x4a>
+  801641:	eb f0                	jmp    801633 <ipc_recv+0x5b>
+
+00801643 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801643:	55                   	push   %ebp
+  801644:	89 e5                	mov    %esp,%ebp
+  801646:	57                   	push   %edi
+  801647:	56                   	push   %esi
+  801648:	53                   	push   %ebx
+  801649:	83 ec 0c             	sub    $0xc,%esp
+  80164c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80164f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801652:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801655:	85 db                	test   %ebx,%ebx
+  801657:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80165c:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80165f:	ff 75 14             	push   0x14(%ebp)
+  801662:	53                   	push   %ebx
+  801663:	56                   	push   %esi
+  801664:	57                   	push   %edi
+  801665:	e8 22 fd ff ff       	call   80138c <sys_ipc_try_send>
+  80166a:	83 c4 10             	add    $0x10,%esp
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	74 22                	je     801693 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  801671:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801674:	75 07                	jne    80167d <ipc_send+0x3a>
+		sys_yield();
+  801676:	e8 3d fb ff ff       	call   8011b8 <sys_yield>
+  80167b:	eb e2                	jmp    80165f <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80167d:	68 d2 44 80 00       	push   $0x8044d2
+  801682:	68 e7 44 80 00       	push   $0x8044e7
+  801687:	6a 39                	push   $0x39
+  801689:	68 fc 44 80 00       	push   $0x8044fc
+  80168e:	e8 6f f0 ff ff       	call   800702 <_panic>
+	}
+}
+  801693:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801696:	5b                   	pop    %ebx
+  801697:	5e                   	pop    %esi
+  801698:	5f                   	pop    %edi
+  801699:	5d                   	pop    %ebp
+  80169a:	c3                   	ret
+
+0080169b <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  80169b:	55                   	push   %ebp
+  80169c:	89 e5                	mov    %esp,%ebp
+  80169e:	57                   	push   %edi
+  80169f:	56                   	push   %esi
+  8016a0:	53                   	push   %ebx
+  8016a1:	83 ec 10             	sub    $0x10,%esp
+  8016a4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016ad:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8016b0:	85 c0                	test   %eax,%eax
+  8016b2:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8016b7:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8016ba:	6a 00                	push   $0x0
+  8016bc:	ff 33                	push   (%ebx)
+  8016be:	50                   	push   %eax
+  8016bf:	e8 18 fd ff ff       	call   8013dc <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8016c4:	83 c4 10             	add    $0x10,%esp
+  8016c7:	85 c0                	test   %eax,%eax
+  8016c9:	75 3c                	jne    801707 <ipc_recvv+0x6c>
+  8016cb:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8016d1:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8016d4:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8016d6:	85 ff                	test   %edi,%edi
+  8016d8:	74 4e                	je     801728 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8016da:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8016e0:	8b 52 74             	mov    0x74(%edx),%edx
+  8016e3:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8016e5:	85 f6                	test   %esi,%esi
+  8016e7:	74 18                	je     801701 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8016e9:	85 c0                	test   %eax,%eax
+  8016eb:	75 2d                	jne    80171a <ipc_recvv+0x7f>
+  8016ed:	a1 00 60 80 00       	mov    0x806000,%eax
+  8016f2:	8b 40 78             	mov    0x78(%eax),%eax
+  8016f5:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8016f7:	a1 00 60 80 00       	mov    0x806000,%eax
+  8016fc:	8b 40 70             	mov    0x70(%eax),%eax
+  8016ff:	eb 1f                	jmp    801720 <ipc_recvv+0x85>
+  801701:	85 c0                	test   %eax,%eax
+  801703:	75 1b                	jne    801720 <ipc_recvv+0x85>
+  801705:	eb f0                	jmp    8016f7 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  801707:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80170d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  801712:	85 ff                	test   %edi,%edi
+  801714:	75 cd                	jne    8016e3 <ipc_recvv+0x48>
+	if (perm_store)
+  801716:	85 f6                	test   %esi,%esi
+  801718:	74 e7                	je     801701 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80171a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  801720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801723:	5b                   	pop    %ebx
+  801724:	5e                   	pop    %esi
+  801725:	5f                   	pop    %edi
+  801726:	5d                   	pop    %ebp
+  801727:	c3                   	ret
+	if (perm_store)
+  801728:	85 f6                	test   %esi,%esi
+  80172a:	75 bd                	jne    8016e9 <ipc_recvv+0x4e>
+  80172c:	eb c9                	jmp    8016f7 <ipc_recvv+0x5c>
+
+0080172e <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  80172e:	55                   	push   %ebp
+  80172f:	89 e5                	mov    %esp,%ebp
+  801731:	57                   	push   %edi
+  801732:	56                   	push   %esi
+  801733:	53                   	push   %ebx
+  801734:	83 ec 0c             	sub    $0xc,%esp
+  801737:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80173a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80173d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  801740:	ff 75 14             	push   0x14(%ebp)
+  801743:	53                   	push   %ebx
+  801744:	56                   	push   %esi
+  801745:	57                   	push   %edi
+  801746:	e8 69 fc ff ff       	call   8013b4 <sys_ipc_try_sendv>
+  80174b:	83 c4 10             	add    $0x10,%esp
+  80174e:	85 c0                	test   %eax,%eax
+  801750:	74 22                	je     801774 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  801752:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801755:	75 07                	jne    80175e <ipc_sendv+0x30>
+		sys_yield();
+  801757:	e8 5c fa ff ff       	call   8011b8 <sys_yield>
+  80175c:	eb e2                	jmp    801740 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80175e:	68 d2 44 80 00       	push   $0x8044d2
+  801763:	68 e7 44 80 00       	push   $0x8044e7
+  801768:	6a 5c                	push   $0x5c
+  80176a:	68 fc 44 80 00       	push   $0x8044fc
+  80176f:	e8 8e ef ff ff       	call   800702 <_panic>
+	}
+}
+  801774:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801777:	5b                   	pop    %ebx
+  801778:	5e                   	pop    %esi
+  801779:	5f                   	pop    %edi
+  80177a:	5d                   	pop    %ebp
+  80177b:	c3                   	ret
+
+0080177c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80177c:	55                   	push   %ebp
+  80177d:	89 e5                	mov    %esp,%ebp
+  80177f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801782:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801787:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80178d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801793:	8b 52 50             	mov    0x50(%edx),%edx
+  801796:	39 ca                	cmp    %ecx,%edx
+  801798:	74 11                	je     8017ab <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80179a:	83 c0 01             	add    $0x1,%eax
+  80179d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8017a2:	75 e3                	jne    801787 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8017a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a9:	eb 0e                	jmp    8017b9 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8017ab:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8017b1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017b6:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8017b9:	5d                   	pop    %ebp
+  8017ba:	c3                   	ret
+
+008017bb <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8017bb:	55                   	push   %ebp
+  8017bc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017c1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017c6:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017c9:	5d                   	pop    %ebp
+  8017ca:	c3                   	ret
+
+008017cb <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017cb:	55                   	push   %ebp
+  8017cc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017d1:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017d6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017db:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017e0:	5d                   	pop    %ebp
+  8017e1:	c3                   	ret
+
+008017e2 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017e2:	55                   	push   %ebp
+  8017e3:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8017e5:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8017ea:	eb 02                	jmp    8017ee <fd_alloc+0xc>
+  8017ec:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8017ee:	89 c2                	mov    %eax,%edx
+  8017f0:	c1 ea 16             	shr    $0x16,%edx
+  8017f3:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017fa:	f6 c2 01             	test   $0x1,%dl
+  8017fd:	74 2b                	je     80182a <fd_alloc+0x48>
+  8017ff:	89 c2                	mov    %eax,%edx
+  801801:	c1 ea 0c             	shr    $0xc,%edx
+  801804:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80180b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801811:	f6 c1 01             	test   $0x1,%cl
+  801814:	74 14                	je     80182a <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801816:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80181c:	75 ce                	jne    8017ec <fd_alloc+0xa>
+  80181e:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801823:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801828:	eb 05                	jmp    80182f <fd_alloc+0x4d>
+			return 0;
+  80182a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80182f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801832:	89 02                	mov    %eax,(%edx)
+}
+  801834:	89 c8                	mov    %ecx,%eax
+  801836:	5d                   	pop    %ebp
+  801837:	c3                   	ret
+
+00801838 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80183e:	83 f8 1f             	cmp    $0x1f,%eax
+  801841:	77 30                	ja     801873 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801843:	c1 e0 0c             	shl    $0xc,%eax
+  801846:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80184b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801851:	f6 c2 01             	test   $0x1,%dl
+  801854:	74 24                	je     80187a <fd_lookup+0x42>
+  801856:	89 c2                	mov    %eax,%edx
+  801858:	c1 ea 0c             	shr    $0xc,%edx
+  80185b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801862:	f6 c2 01             	test   $0x1,%dl
+  801865:	74 1a                	je     801881 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801867:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80186a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80186c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801871:	5d                   	pop    %ebp
+  801872:	c3                   	ret
+		return -E_INVAL;
+  801873:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801878:	eb f7                	jmp    801871 <fd_lookup+0x39>
+		return -E_INVAL;
+  80187a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80187f:	eb f0                	jmp    801871 <fd_lookup+0x39>
+  801881:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801886:	eb e9                	jmp    801871 <fd_lookup+0x39>
+
+00801888 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801888:	55                   	push   %ebp
+  801889:	89 e5                	mov    %esp,%ebp
+  80188b:	53                   	push   %ebx
+  80188c:	83 ec 04             	sub    $0x4,%esp
+  80188f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801892:	b8 00 00 00 00       	mov    $0x0,%eax
+  801897:	eb 03                	jmp    80189c <dev_lookup+0x14>
+  801899:	83 c0 01             	add    $0x1,%eax
+  80189c:	8b 1c 85 84 45 80 00 	mov    0x804584(,%eax,4),%ebx
+  8018a3:	85 db                	test   %ebx,%ebx
+  8018a5:	74 0b                	je     8018b2 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8018a7:	39 13                	cmp    %edx,(%ebx)
+  8018a9:	75 ee                	jne    801899 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8018ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b0:	eb 1f                	jmp    8018d1 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018b2:	a1 00 60 80 00       	mov    0x806000,%eax
+  8018b7:	8b 40 48             	mov    0x48(%eax),%eax
+  8018ba:	83 ec 04             	sub    $0x4,%esp
+  8018bd:	52                   	push   %edx
+  8018be:	50                   	push   %eax
+  8018bf:	68 08 45 80 00       	push   $0x804508
+  8018c4:	e8 14 ef ff ff       	call   8007dd <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018c9:	83 c4 10             	add    $0x10,%esp
+  8018cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018d4:	89 1a                	mov    %ebx,(%edx)
+}
+  8018d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d9:	c9                   	leave
+  8018da:	c3                   	ret
+
+008018db <fd_close>:
+{
+  8018db:	55                   	push   %ebp
+  8018dc:	89 e5                	mov    %esp,%ebp
+  8018de:	57                   	push   %edi
+  8018df:	56                   	push   %esi
+  8018e0:	53                   	push   %ebx
+  8018e1:	83 ec 24             	sub    $0x24,%esp
+  8018e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018e7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018ea:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018ed:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018ee:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018f4:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018f7:	50                   	push   %eax
+  8018f8:	e8 3b ff ff ff       	call   801838 <fd_lookup>
+  8018fd:	89 c3                	mov    %eax,%ebx
+  8018ff:	83 c4 10             	add    $0x10,%esp
+  801902:	85 c0                	test   %eax,%eax
+  801904:	78 05                	js     80190b <fd_close+0x30>
+	    || fd != fd2)
+  801906:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801909:	74 16                	je     801921 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80190b:	89 f8                	mov    %edi,%eax
+  80190d:	84 c0                	test   %al,%al
+  80190f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801914:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801917:	89 d8                	mov    %ebx,%eax
+  801919:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80191c:	5b                   	pop    %ebx
+  80191d:	5e                   	pop    %esi
+  80191e:	5f                   	pop    %edi
+  80191f:	5d                   	pop    %ebp
+  801920:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801921:	83 ec 08             	sub    $0x8,%esp
+  801924:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801927:	50                   	push   %eax
+  801928:	ff 36                	push   (%esi)
+  80192a:	e8 59 ff ff ff       	call   801888 <dev_lookup>
+  80192f:	89 c3                	mov    %eax,%ebx
+  801931:	83 c4 10             	add    $0x10,%esp
+  801934:	85 c0                	test   %eax,%eax
+  801936:	78 1a                	js     801952 <fd_close+0x77>
+		if (dev->dev_close)
+  801938:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80193b:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80193e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801943:	85 c0                	test   %eax,%eax
+  801945:	74 0b                	je     801952 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801947:	83 ec 0c             	sub    $0xc,%esp
+  80194a:	56                   	push   %esi
+  80194b:	ff d0                	call   *%eax
+  80194d:	89 c3                	mov    %eax,%ebx
+  80194f:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801952:	83 ec 08             	sub    $0x8,%esp
+  801955:	56                   	push   %esi
+  801956:	6a 00                	push   $0x0
+  801958:	e8 07 f9 ff ff       	call   801264 <sys_page_unmap>
+	return r;
+  80195d:	83 c4 10             	add    $0x10,%esp
+  801960:	eb b5                	jmp    801917 <fd_close+0x3c>
+
+00801962 <close>:
+
+int
+close(int fdnum)
+{
+  801962:	55                   	push   %ebp
+  801963:	89 e5                	mov    %esp,%ebp
+  801965:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801968:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80196b:	50                   	push   %eax
+  80196c:	ff 75 08             	push   0x8(%ebp)
+  80196f:	e8 c4 fe ff ff       	call   801838 <fd_lookup>
+  801974:	83 c4 10             	add    $0x10,%esp
+  801977:	85 c0                	test   %eax,%eax
+  801979:	79 02                	jns    80197d <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80197b:	c9                   	leave
+  80197c:	c3                   	ret
+		return fd_close(fd, 1);
+  80197d:	83 ec 08             	sub    $0x8,%esp
+  801980:	6a 01                	push   $0x1
+  801982:	ff 75 f4             	push   -0xc(%ebp)
+  801985:	e8 51 ff ff ff       	call   8018db <fd_close>
+  80198a:	83 c4 10             	add    $0x10,%esp
+  80198d:	eb ec                	jmp    80197b <close+0x19>
+
+0080198f <close_all>:
+
+void
+close_all(void)
+{
+  80198f:	55                   	push   %ebp
+  801990:	89 e5                	mov    %esp,%ebp
+  801992:	53                   	push   %ebx
+  801993:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801996:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80199b:	83 ec 0c             	sub    $0xc,%esp
+  80199e:	53                   	push   %ebx
+  80199f:	e8 be ff ff ff       	call   801962 <close>
+	for (i = 0; i < MAXFD; i++)
+  8019a4:	83 c3 01             	add    $0x1,%ebx
+  8019a7:	83 c4 10             	add    $0x10,%esp
+  8019aa:	83 fb 20             	cmp    $0x20,%ebx
+  8019ad:	75 ec                	jne    80199b <close_all+0xc>
+}
+  8019af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019b2:	c9                   	leave
+  8019b3:	c3                   	ret
+
+008019b4 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019b4:	55                   	push   %ebp
+  8019b5:	89 e5                	mov    %esp,%ebp
+  8019b7:	57                   	push   %edi
+  8019b8:	56                   	push   %esi
+  8019b9:	53                   	push   %ebx
+  8019ba:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019bd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019c0:	50                   	push   %eax
+  8019c1:	ff 75 08             	push   0x8(%ebp)
+  8019c4:	e8 6f fe ff ff       	call   801838 <fd_lookup>
+  8019c9:	89 c3                	mov    %eax,%ebx
+  8019cb:	83 c4 10             	add    $0x10,%esp
+  8019ce:	85 c0                	test   %eax,%eax
+  8019d0:	78 7f                	js     801a51 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8019d2:	83 ec 0c             	sub    $0xc,%esp
+  8019d5:	ff 75 0c             	push   0xc(%ebp)
+  8019d8:	e8 85 ff ff ff       	call   801962 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019dd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019e0:	c1 e6 0c             	shl    $0xc,%esi
+  8019e3:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8019e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019ec:	89 3c 24             	mov    %edi,(%esp)
+  8019ef:	e8 d7 fd ff ff       	call   8017cb <fd2data>
+  8019f4:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8019f6:	89 34 24             	mov    %esi,(%esp)
+  8019f9:	e8 cd fd ff ff       	call   8017cb <fd2data>
+  8019fe:	83 c4 10             	add    $0x10,%esp
+  801a01:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a04:	89 d8                	mov    %ebx,%eax
+  801a06:	c1 e8 16             	shr    $0x16,%eax
+  801a09:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a10:	a8 01                	test   $0x1,%al
+  801a12:	74 11                	je     801a25 <dup+0x71>
+  801a14:	89 d8                	mov    %ebx,%eax
+  801a16:	c1 e8 0c             	shr    $0xc,%eax
+  801a19:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a20:	f6 c2 01             	test   $0x1,%dl
+  801a23:	75 36                	jne    801a5b <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a25:	89 f8                	mov    %edi,%eax
+  801a27:	c1 e8 0c             	shr    $0xc,%eax
+  801a2a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a31:	83 ec 0c             	sub    $0xc,%esp
+  801a34:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a39:	50                   	push   %eax
+  801a3a:	56                   	push   %esi
+  801a3b:	6a 00                	push   $0x0
+  801a3d:	57                   	push   %edi
+  801a3e:	6a 00                	push   $0x0
+  801a40:	e8 dd f7 ff ff       	call   801222 <sys_page_map>
+  801a45:	89 c3                	mov    %eax,%ebx
+  801a47:	83 c4 20             	add    $0x20,%esp
+  801a4a:	85 c0                	test   %eax,%eax
+  801a4c:	78 33                	js     801a81 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a4e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a51:	89 d8                	mov    %ebx,%eax
+  801a53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a56:	5b                   	pop    %ebx
+  801a57:	5e                   	pop    %esi
+  801a58:	5f                   	pop    %edi
+  801a59:	5d                   	pop    %ebp
+  801a5a:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a5b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a62:	83 ec 0c             	sub    $0xc,%esp
+  801a65:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a6a:	50                   	push   %eax
+  801a6b:	ff 75 d4             	push   -0x2c(%ebp)
+  801a6e:	6a 00                	push   $0x0
+  801a70:	53                   	push   %ebx
+  801a71:	6a 00                	push   $0x0
+  801a73:	e8 aa f7 ff ff       	call   801222 <sys_page_map>
+  801a78:	89 c3                	mov    %eax,%ebx
+  801a7a:	83 c4 20             	add    $0x20,%esp
+  801a7d:	85 c0                	test   %eax,%eax
+  801a7f:	79 a4                	jns    801a25 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a81:	83 ec 08             	sub    $0x8,%esp
+  801a84:	56                   	push   %esi
+  801a85:	6a 00                	push   $0x0
+  801a87:	e8 d8 f7 ff ff       	call   801264 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a8c:	83 c4 08             	add    $0x8,%esp
+  801a8f:	ff 75 d4             	push   -0x2c(%ebp)
+  801a92:	6a 00                	push   $0x0
+  801a94:	e8 cb f7 ff ff       	call   801264 <sys_page_unmap>
+	return r;
+  801a99:	83 c4 10             	add    $0x10,%esp
+  801a9c:	eb b3                	jmp    801a51 <dup+0x9d>
+
+00801a9e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a9e:	55                   	push   %ebp
+  801a9f:	89 e5                	mov    %esp,%ebp
+  801aa1:	56                   	push   %esi
+  801aa2:	53                   	push   %ebx
+  801aa3:	83 ec 18             	sub    $0x18,%esp
+  801aa6:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801aa9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801aac:	50                   	push   %eax
+  801aad:	56                   	push   %esi
+  801aae:	e8 85 fd ff ff       	call   801838 <fd_lookup>
+  801ab3:	83 c4 10             	add    $0x10,%esp
+  801ab6:	85 c0                	test   %eax,%eax
+  801ab8:	78 3c                	js     801af6 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801aba:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801abd:	83 ec 08             	sub    $0x8,%esp
+  801ac0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ac3:	50                   	push   %eax
+  801ac4:	ff 33                	push   (%ebx)
+  801ac6:	e8 bd fd ff ff       	call   801888 <dev_lookup>
+  801acb:	83 c4 10             	add    $0x10,%esp
+  801ace:	85 c0                	test   %eax,%eax
+  801ad0:	78 24                	js     801af6 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ad2:	8b 43 08             	mov    0x8(%ebx),%eax
+  801ad5:	83 e0 03             	and    $0x3,%eax
+  801ad8:	83 f8 01             	cmp    $0x1,%eax
+  801adb:	74 20                	je     801afd <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801add:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ae0:	8b 40 08             	mov    0x8(%eax),%eax
+  801ae3:	85 c0                	test   %eax,%eax
+  801ae5:	74 37                	je     801b1e <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801ae7:	83 ec 04             	sub    $0x4,%esp
+  801aea:	ff 75 10             	push   0x10(%ebp)
+  801aed:	ff 75 0c             	push   0xc(%ebp)
+  801af0:	53                   	push   %ebx
+  801af1:	ff d0                	call   *%eax
+  801af3:	83 c4 10             	add    $0x10,%esp
+}
+  801af6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801af9:	5b                   	pop    %ebx
+  801afa:	5e                   	pop    %esi
+  801afb:	5d                   	pop    %ebp
+  801afc:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801afd:	a1 00 60 80 00       	mov    0x806000,%eax
+  801b02:	8b 40 48             	mov    0x48(%eax),%eax
+  801b05:	83 ec 04             	sub    $0x4,%esp
+  801b08:	56                   	push   %esi
+  801b09:	50                   	push   %eax
+  801b0a:	68 49 45 80 00       	push   $0x804549
+  801b0f:	e8 c9 ec ff ff       	call   8007dd <cprintf>
+		return -E_INVAL;
+  801b14:	83 c4 10             	add    $0x10,%esp
+  801b17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b1c:	eb d8                	jmp    801af6 <read+0x58>
+		return -E_NOT_SUPP;
+  801b1e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b23:	eb d1                	jmp    801af6 <read+0x58>
+
+00801b25 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b25:	55                   	push   %ebp
+  801b26:	89 e5                	mov    %esp,%ebp
+  801b28:	57                   	push   %edi
+  801b29:	56                   	push   %esi
+  801b2a:	53                   	push   %ebx
+  801b2b:	83 ec 0c             	sub    $0xc,%esp
+  801b2e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b31:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b39:	eb 02                	jmp    801b3d <readn+0x18>
+  801b3b:	01 c3                	add    %eax,%ebx
+  801b3d:	39 f3                	cmp    %esi,%ebx
+  801b3f:	73 21                	jae    801b62 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b41:	83 ec 04             	sub    $0x4,%esp
+  801b44:	89 f0                	mov    %esi,%eax
+  801b46:	29 d8                	sub    %ebx,%eax
+  801b48:	50                   	push   %eax
+  801b49:	89 d8                	mov    %ebx,%eax
+  801b4b:	03 45 0c             	add    0xc(%ebp),%eax
+  801b4e:	50                   	push   %eax
+  801b4f:	57                   	push   %edi
+  801b50:	e8 49 ff ff ff       	call   801a9e <read>
+		if (m < 0)
+  801b55:	83 c4 10             	add    $0x10,%esp
+  801b58:	85 c0                	test   %eax,%eax
+  801b5a:	78 04                	js     801b60 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b5c:	75 dd                	jne    801b3b <readn+0x16>
+  801b5e:	eb 02                	jmp    801b62 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b60:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b62:	89 d8                	mov    %ebx,%eax
+  801b64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b67:	5b                   	pop    %ebx
+  801b68:	5e                   	pop    %esi
+  801b69:	5f                   	pop    %edi
+  801b6a:	5d                   	pop    %ebp
+  801b6b:	c3                   	ret
+
+00801b6c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b6c:	55                   	push   %ebp
+  801b6d:	89 e5                	mov    %esp,%ebp
+  801b6f:	56                   	push   %esi
+  801b70:	53                   	push   %ebx
+  801b71:	83 ec 18             	sub    $0x18,%esp
+  801b74:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b77:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b7a:	50                   	push   %eax
+  801b7b:	53                   	push   %ebx
+  801b7c:	e8 b7 fc ff ff       	call   801838 <fd_lookup>
+  801b81:	83 c4 10             	add    $0x10,%esp
+  801b84:	85 c0                	test   %eax,%eax
+  801b86:	78 37                	js     801bbf <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b88:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b8b:	83 ec 08             	sub    $0x8,%esp
+  801b8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b91:	50                   	push   %eax
+  801b92:	ff 36                	push   (%esi)
+  801b94:	e8 ef fc ff ff       	call   801888 <dev_lookup>
+  801b99:	83 c4 10             	add    $0x10,%esp
+  801b9c:	85 c0                	test   %eax,%eax
+  801b9e:	78 1f                	js     801bbf <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ba0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ba4:	74 20                	je     801bc6 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801ba6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ba9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bac:	85 c0                	test   %eax,%eax
+  801bae:	74 37                	je     801be7 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801bb0:	83 ec 04             	sub    $0x4,%esp
+  801bb3:	ff 75 10             	push   0x10(%ebp)
+  801bb6:	ff 75 0c             	push   0xc(%ebp)
+  801bb9:	56                   	push   %esi
+  801bba:	ff d0                	call   *%eax
+  801bbc:	83 c4 10             	add    $0x10,%esp
+}
+  801bbf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bc2:	5b                   	pop    %ebx
+  801bc3:	5e                   	pop    %esi
+  801bc4:	5d                   	pop    %ebp
+  801bc5:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bc6:	a1 00 60 80 00       	mov    0x806000,%eax
+  801bcb:	8b 40 48             	mov    0x48(%eax),%eax
+  801bce:	83 ec 04             	sub    $0x4,%esp
+  801bd1:	53                   	push   %ebx
+  801bd2:	50                   	push   %eax
+  801bd3:	68 65 45 80 00       	push   $0x804565
+  801bd8:	e8 00 ec ff ff       	call   8007dd <cprintf>
+		return -E_INVAL;
+  801bdd:	83 c4 10             	add    $0x10,%esp
+  801be0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801be5:	eb d8                	jmp    801bbf <write+0x53>
+		return -E_NOT_SUPP;
+  801be7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bec:	eb d1                	jmp    801bbf <write+0x53>
+
+00801bee <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801bee:	55                   	push   %ebp
+  801bef:	89 e5                	mov    %esp,%ebp
+  801bf1:	53                   	push   %ebx
+  801bf2:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bf5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bf8:	50                   	push   %eax
+  801bf9:	ff 75 08             	push   0x8(%ebp)
+  801bfc:	e8 37 fc ff ff       	call   801838 <fd_lookup>
+  801c01:	83 c4 10             	add    $0x10,%esp
+  801c04:	85 c0                	test   %eax,%eax
+  801c06:	78 3a                	js     801c42 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c08:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801c0b:	83 ec 08             	sub    $0x8,%esp
+  801c0e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c11:	50                   	push   %eax
+  801c12:	ff 33                	push   (%ebx)
+  801c14:	e8 6f fc ff ff       	call   801888 <dev_lookup>
+  801c19:	83 c4 10             	add    $0x10,%esp
+  801c1c:	85 c0                	test   %eax,%eax
+  801c1e:	78 22                	js     801c42 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801c20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c23:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801c26:	85 c0                	test   %eax,%eax
+  801c28:	74 0d                	je     801c37 <seek+0x49>
+  801c2a:	83 ec 0c             	sub    $0xc,%esp
+  801c2d:	53                   	push   %ebx
+  801c2e:	ff d0                	call   *%eax
+  801c30:	83 c4 10             	add    $0x10,%esp
+  801c33:	85 c0                	test   %eax,%eax
+  801c35:	78 0b                	js     801c42 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801c37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c3a:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c45:	c9                   	leave
+  801c46:	c3                   	ret
+
+00801c47 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801c47:	55                   	push   %ebp
+  801c48:	89 e5                	mov    %esp,%ebp
+  801c4a:	53                   	push   %ebx
+  801c4b:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c4e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c51:	50                   	push   %eax
+  801c52:	ff 75 08             	push   0x8(%ebp)
+  801c55:	e8 de fb ff ff       	call   801838 <fd_lookup>
+  801c5a:	83 c4 10             	add    $0x10,%esp
+  801c5d:	85 c0                	test   %eax,%eax
+  801c5f:	78 2b                	js     801c8c <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c61:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801c64:	83 ec 08             	sub    $0x8,%esp
+  801c67:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c6a:	50                   	push   %eax
+  801c6b:	ff 33                	push   (%ebx)
+  801c6d:	e8 16 fc ff ff       	call   801888 <dev_lookup>
+  801c72:	83 c4 10             	add    $0x10,%esp
+  801c75:	85 c0                	test   %eax,%eax
+  801c77:	78 13                	js     801c8c <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801c79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c7c:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801c7f:	85 c0                	test   %eax,%eax
+  801c81:	74 0e                	je     801c91 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801c83:	83 ec 0c             	sub    $0xc,%esp
+  801c86:	53                   	push   %ebx
+  801c87:	ff d0                	call   *%eax
+  801c89:	83 c4 10             	add    $0x10,%esp
+}
+  801c8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c8f:	c9                   	leave
+  801c90:	c3                   	ret
+		return 0;
+  801c91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c96:	eb f4                	jmp    801c8c <fsync+0x45>
+
+00801c98 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c98:	55                   	push   %ebp
+  801c99:	89 e5                	mov    %esp,%ebp
+  801c9b:	56                   	push   %esi
+  801c9c:	53                   	push   %ebx
+  801c9d:	83 ec 18             	sub    $0x18,%esp
+  801ca0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ca3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ca6:	50                   	push   %eax
+  801ca7:	53                   	push   %ebx
+  801ca8:	e8 8b fb ff ff       	call   801838 <fd_lookup>
+  801cad:	83 c4 10             	add    $0x10,%esp
+  801cb0:	85 c0                	test   %eax,%eax
+  801cb2:	78 34                	js     801ce8 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cb4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cb7:	83 ec 08             	sub    $0x8,%esp
+  801cba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cbd:	50                   	push   %eax
+  801cbe:	ff 36                	push   (%esi)
+  801cc0:	e8 c3 fb ff ff       	call   801888 <dev_lookup>
+  801cc5:	83 c4 10             	add    $0x10,%esp
+  801cc8:	85 c0                	test   %eax,%eax
+  801cca:	78 1c                	js     801ce8 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ccc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cd0:	74 1d                	je     801cef <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801cd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cd5:	8b 40 18             	mov    0x18(%eax),%eax
+  801cd8:	85 c0                	test   %eax,%eax
+  801cda:	74 34                	je     801d10 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801cdc:	83 ec 08             	sub    $0x8,%esp
+  801cdf:	ff 75 0c             	push   0xc(%ebp)
+  801ce2:	56                   	push   %esi
+  801ce3:	ff d0                	call   *%eax
+  801ce5:	83 c4 10             	add    $0x10,%esp
+}
+  801ce8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ceb:	5b                   	pop    %ebx
+  801cec:	5e                   	pop    %esi
+  801ced:	5d                   	pop    %ebp
+  801cee:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801cef:	a1 00 60 80 00       	mov    0x806000,%eax
+  801cf4:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cf7:	83 ec 04             	sub    $0x4,%esp
+  801cfa:	53                   	push   %ebx
+  801cfb:	50                   	push   %eax
+  801cfc:	68 28 45 80 00       	push   $0x804528
+  801d01:	e8 d7 ea ff ff       	call   8007dd <cprintf>
+		return -E_INVAL;
+  801d06:	83 c4 10             	add    $0x10,%esp
+  801d09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d0e:	eb d8                	jmp    801ce8 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801d10:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d15:	eb d1                	jmp    801ce8 <ftruncate+0x50>
+
+00801d17 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d17:	55                   	push   %ebp
+  801d18:	89 e5                	mov    %esp,%ebp
+  801d1a:	56                   	push   %esi
+  801d1b:	53                   	push   %ebx
+  801d1c:	83 ec 18             	sub    $0x18,%esp
+  801d1f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d22:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d25:	50                   	push   %eax
+  801d26:	ff 75 08             	push   0x8(%ebp)
+  801d29:	e8 0a fb ff ff       	call   801838 <fd_lookup>
+  801d2e:	83 c4 10             	add    $0x10,%esp
+  801d31:	85 c0                	test   %eax,%eax
+  801d33:	78 49                	js     801d7e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d35:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d38:	83 ec 08             	sub    $0x8,%esp
+  801d3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d3e:	50                   	push   %eax
+  801d3f:	ff 36                	push   (%esi)
+  801d41:	e8 42 fb ff ff       	call   801888 <dev_lookup>
+  801d46:	83 c4 10             	add    $0x10,%esp
+  801d49:	85 c0                	test   %eax,%eax
+  801d4b:	78 31                	js     801d7e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d50:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d54:	74 2f                	je     801d85 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d56:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d59:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d60:	00 00 00 
+	stat->st_isdir = 0;
+  801d63:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d6a:	00 00 00 
+	stat->st_dev = dev;
+  801d6d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d73:	83 ec 08             	sub    $0x8,%esp
+  801d76:	53                   	push   %ebx
+  801d77:	56                   	push   %esi
+  801d78:	ff 50 14             	call   *0x14(%eax)
+  801d7b:	83 c4 10             	add    $0x10,%esp
+}
+  801d7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d81:	5b                   	pop    %ebx
+  801d82:	5e                   	pop    %esi
+  801d83:	5d                   	pop    %ebp
+  801d84:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d85:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d8a:	eb f2                	jmp    801d7e <fstat+0x67>
+
+00801d8c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d8c:	55                   	push   %ebp
+  801d8d:	89 e5                	mov    %esp,%ebp
+  801d8f:	56                   	push   %esi
+  801d90:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801d91:	83 ec 08             	sub    $0x8,%esp
+  801d94:	68 00 10 00 00       	push   $0x1000
+  801d99:	ff 75 08             	push   0x8(%ebp)
+  801d9c:	e8 b3 07 00 00       	call   802554 <open>
+  801da1:	89 c3                	mov    %eax,%ebx
+  801da3:	83 c4 10             	add    $0x10,%esp
+  801da6:	85 c0                	test   %eax,%eax
+  801da8:	78 1b                	js     801dc5 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801daa:	83 ec 08             	sub    $0x8,%esp
+  801dad:	ff 75 0c             	push   0xc(%ebp)
+  801db0:	50                   	push   %eax
+  801db1:	e8 61 ff ff ff       	call   801d17 <fstat>
+  801db6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801db8:	89 1c 24             	mov    %ebx,(%esp)
+  801dbb:	e8 a2 fb ff ff       	call   801962 <close>
+	return r;
+  801dc0:	83 c4 10             	add    $0x10,%esp
+  801dc3:	89 f3                	mov    %esi,%ebx
+}
+  801dc5:	89 d8                	mov    %ebx,%eax
+  801dc7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dca:	5b                   	pop    %ebx
+  801dcb:	5e                   	pop    %esi
+  801dcc:	5d                   	pop    %ebp
+  801dcd:	c3                   	ret
+
+00801dce <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801dce:	55                   	push   %ebp
+  801dcf:	89 e5                	mov    %esp,%ebp
+  801dd1:	57                   	push   %edi
+  801dd2:	56                   	push   %esi
+  801dd3:	53                   	push   %ebx
+  801dd4:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801dda:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801de0:	89 d6                	mov    %edx,%esi
+  801de2:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801de8:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801deb:	89 d3                	mov    %edx,%ebx
+  801ded:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801df3:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801dfa:	74 1d                	je     801e19 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801dfc:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801e01:	83 c8 07             	or     $0x7,%eax
+  801e04:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801e0a:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801e0f:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801e15:	01 ce                	add    %ecx,%esi
+  801e17:	eb 28                	jmp    801e41 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e19:	83 ec 0c             	sub    $0xc,%esp
+  801e1c:	6a 01                	push   $0x1
+  801e1e:	e8 59 f9 ff ff       	call   80177c <ipc_find_env>
+  801e23:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801e28:	83 c4 10             	add    $0x10,%esp
+  801e2b:	eb cf                	jmp    801dfc <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801e2d:	83 c0 01             	add    $0x1,%eax
+  801e30:	89 fa                	mov    %edi,%edx
+  801e32:	09 da                	or     %ebx,%edx
+  801e34:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801e3b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801e41:	39 f3                	cmp    %esi,%ebx
+  801e43:	72 e8                	jb     801e2d <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801e45:	83 f8 41             	cmp    $0x41,%eax
+  801e48:	77 2f                	ja     801e79 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801e4a:	50                   	push   %eax
+  801e4b:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801e51:	50                   	push   %eax
+  801e52:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801e58:	ff 35 c8 80 80 00    	push   0x8080c8
+  801e5e:	e8 cb f8 ff ff       	call   80172e <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801e63:	83 c4 0c             	add    $0xc,%esp
+  801e66:	6a 00                	push   $0x0
+  801e68:	6a 00                	push   $0x0
+  801e6a:	6a 00                	push   $0x0
+  801e6c:	e8 67 f7 ff ff       	call   8015d8 <ipc_recv>
+}
+  801e71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e74:	5b                   	pop    %ebx
+  801e75:	5e                   	pop    %esi
+  801e76:	5f                   	pop    %edi
+  801e77:	5d                   	pop    %ebp
+  801e78:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801e79:	68 98 45 80 00       	push   $0x804598
+  801e7e:	68 e7 44 80 00       	push   $0x8044e7
+  801e83:	6a 40                	push   $0x40
+  801e85:	68 b4 45 80 00       	push   $0x8045b4
+  801e8a:	e8 73 e8 ff ff       	call   800702 <_panic>
+
+00801e8f <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801e8f:	55                   	push   %ebp
+  801e90:	89 e5                	mov    %esp,%ebp
+  801e92:	57                   	push   %edi
+  801e93:	56                   	push   %esi
+  801e94:	53                   	push   %ebx
+  801e95:	83 ec 1c             	sub    $0x1c,%esp
+  801e98:	89 c3                	mov    %eax,%ebx
+  801e9a:	89 d6                	mov    %edx,%esi
+  801e9c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801e9f:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801ea5:	89 ca                	mov    %ecx,%edx
+  801ea7:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801eaa:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801eb1:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801eb4:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801ebb:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ebe:	89 fb                	mov    %edi,%ebx
+  801ec0:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801ec7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801eca:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801ed1:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ed4:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801edb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ede:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801ee5:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801ee8:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801eef:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801ef4:	39 c8                	cmp    %ecx,%eax
+  801ef6:	74 0d                	je     801f05 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801ef8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f00:	5b                   	pop    %ebx
+  801f01:	5e                   	pop    %esi
+  801f02:	5f                   	pop    %edi
+  801f03:	5d                   	pop    %ebp
+  801f04:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f05:	6a 07                	push   $0x7
+  801f07:	68 00 70 80 00       	push   $0x807000
+  801f0c:	6a 0d                	push   $0xd
+  801f0e:	ff 35 c8 80 80 00    	push   0x8080c8
+  801f14:	e8 2a f7 ff ff       	call   801643 <ipc_send>
+  801f19:	83 c4 10             	add    $0x10,%esp
+  801f1c:	eb da                	jmp    801ef8 <fsring_post+0x69>
+
+00801f1e <fsipcv>:
+{
+  801f1e:	55                   	push   %ebp
+  801f1f:	89 e5                	mov    %esp,%ebp
+  801f21:	57                   	push   %edi
+  801f22:	56                   	push   %esi
+  801f23:	53                   	push   %ebx
+  801f24:	83 ec 0c             	sub    $0xc,%esp
+  801f27:	89 c7                	mov    %eax,%edi
+  801f29:	89 d3                	mov    %edx,%ebx
+  801f2b:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801f2d:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801f34:	74 26                	je     801f5c <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f36:	6a 07                	push   $0x7
+  801f38:	68 00 70 80 00       	push   $0x807000
+  801f3d:	57                   	push   %edi
+  801f3e:	ff 35 c8 80 80 00    	push   0x8080c8
+  801f44:	e8 fa f6 ff ff       	call   801643 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801f49:	6a 00                	push   $0x0
+  801f4b:	56                   	push   %esi
+  801f4c:	53                   	push   %ebx
+  801f4d:	6a 00                	push   $0x0
+  801f4f:	e8 47 f7 ff ff       	call   80169b <ipc_recvv>
+}
+  801f54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f57:	5b                   	pop    %ebx
+  801f58:	5e                   	pop    %esi
+  801f59:	5f                   	pop    %edi
+  801f5a:	5d                   	pop    %ebp
+  801f5b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f5c:	83 ec 0c             	sub    $0xc,%esp
+  801f5f:	6a 01                	push   $0x1
+  801f61:	e8 16 f8 ff ff       	call   80177c <ipc_find_env>
+  801f66:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801f6b:	83 c4 10             	add    $0x10,%esp
+  801f6e:	eb c6                	jmp    801f36 <fsipcv+0x18>
+
+00801f70 <fsipc>:
+{
+  801f70:	55                   	push   %ebp
+  801f71:	89 e5                	mov    %esp,%ebp
+  801f73:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801f76:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801f7d:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801f80:	e8 99 ff ff ff       	call   801f1e <fsipcv>
+}
+  801f85:	c9                   	leave
+  801f86:	c3                   	ret
+
+00801f87 <file_write_direct>:
+{
+  801f87:	55                   	push   %ebp
+  801f88:	89 e5                	mov    %esp,%ebp
+  801f8a:	56                   	push   %esi
+  801f8b:	53                   	push   %ebx
+  801f8c:	89 c3                	mov    %eax,%ebx
+  801f8e:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801f90:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801f96:	77 40                	ja     801fd8 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801f98:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801f9d:	39 c8                	cmp    %ecx,%eax
+  801f9f:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fa2:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801fa5:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  801fab:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801fb0:	83 ec 04             	sub    $0x4,%esp
+  801fb3:	50                   	push   %eax
+  801fb4:	52                   	push   %edx
+  801fb5:	68 08 70 80 00       	push   $0x807008
+  801fba:	e8 92 ef ff ff       	call   800f51 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801fbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc4:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fc9:	e8 a2 ff ff ff       	call   801f70 <fsipc>
+  801fce:	83 c4 10             	add    $0x10,%esp
+}
+  801fd1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd4:	5b                   	pop    %ebx
+  801fd5:	5e                   	pop    %esi
+  801fd6:	5d                   	pop    %ebp
+  801fd7:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801fd8:	89 d6                	mov    %edx,%esi
+  801fda:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801fe0:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801fe5:	29 f1                	sub    %esi,%ecx
+  801fe7:	39 c1                	cmp    %eax,%ecx
+  801fe9:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801fec:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801fef:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801ff4:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801ffa:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  802000:	83 ec 0c             	sub    $0xc,%esp
+  802003:	6a 05                	push   $0x5
+  802005:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80200a:	e8 bf fd ff ff       	call   801dce <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  80200f:	83 c4 10             	add    $0x10,%esp
+  802012:	eb bd                	jmp    801fd1 <file_write_direct+0x4a>
+
+00802014 <devfile_sync>:
+{
+  802014:	55                   	push   %ebp
+  802015:	89 e5                	mov    %esp,%ebp
+  802017:	57                   	push   %edi
+  802018:	56                   	push   %esi
+  802019:	53                   	push   %ebx
+  80201a:	83 ec 28             	sub    $0x28,%esp
+  80201d:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  802020:	56                   	push   %esi
+  802021:	e8 a5 f7 ff ff       	call   8017cb <fd2data>
+  802026:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  802028:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  80202b:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  802032:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802035:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  80203a:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  80203e:	74 45                	je     802085 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  802040:	8b 46 14             	mov    0x14(%esi),%eax
+  802043:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  802046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80204b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802050:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  802053:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  802056:	39 cb                	cmp    %ecx,%ebx
+  802058:	73 14                	jae    80206e <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  80205a:	29 d9                	sub    %ebx,%ecx
+  80205c:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  80205f:	89 f0                	mov    %esi,%eax
+  802061:	e8 21 ff ff ff       	call   801f87 <file_write_direct>
+  802066:	85 c0                	test   %eax,%eax
+  802068:	7e 04                	jle    80206e <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80206a:	01 c3                	add    %eax,%ebx
+  80206c:	eb e5                	jmp    802053 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  80206e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802071:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  802078:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  80207b:	85 c0                	test   %eax,%eax
+  80207d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802082:	0f 4f c2             	cmovg  %edx,%eax
+}
+  802085:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802088:	5b                   	pop    %ebx
+  802089:	5e                   	pop    %esi
+  80208a:	5f                   	pop    %edi
+  80208b:	5d                   	pop    %ebp
+  80208c:	c3                   	ret
+
+0080208d <devfile_write>:
+{
+  80208d:	55                   	push   %ebp
+  80208e:	89 e5                	mov    %esp,%ebp
+  802090:	57                   	push   %edi
+  802091:	56                   	push   %esi
+  802092:	53                   	push   %ebx
+  802093:	83 ec 28             	sub    $0x28,%esp
+  802096:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802099:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80209c:	53                   	push   %ebx
+  80209d:	e8 29 f7 ff ff       	call   8017cb <fd2data>
+  8020a2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8020a5:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8020a8:	83 c4 10             	add    $0x10,%esp
+  8020ab:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8020af:	74 43                	je     8020f4 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  8020b1:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  8020b8:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8020bb:	85 c0                	test   %eax,%eax
+  8020bd:	74 43                	je     802102 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  8020bf:	89 c2                	mov    %eax,%edx
+  8020c1:	03 53 14             	add    0x14(%ebx),%edx
+  8020c4:	39 fa                	cmp    %edi,%edx
+  8020c6:	75 0b                	jne    8020d3 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  8020c8:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  8020cb:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  8020d1:	76 66                	jbe    802139 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  8020d3:	83 ec 0c             	sub    $0xc,%esp
+  8020d6:	53                   	push   %ebx
+  8020d7:	e8 38 ff ff ff       	call   802014 <devfile_sync>
+  8020dc:	83 c4 10             	add    $0x10,%esp
+  8020df:	85 c0                	test   %eax,%eax
+  8020e1:	78 4e                	js     802131 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8020e3:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8020e9:	77 56                	ja     802141 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  8020eb:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8020ee:	85 c0                	test   %eax,%eax
+  8020f0:	75 20                	jne    802112 <devfile_write+0x85>
+  8020f2:	eb 16                	jmp    80210a <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  8020f4:	89 f1                	mov    %esi,%ecx
+  8020f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020f9:	89 d8                	mov    %ebx,%eax
+  8020fb:	e8 87 fe ff ff       	call   801f87 <file_write_direct>
+  802100:	eb 2f                	jmp    802131 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  802102:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802108:	77 37                	ja     802141 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  80210a:	89 7b 14             	mov    %edi,0x14(%ebx)
+  80210d:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  802112:	83 ec 04             	sub    $0x4,%esp
+  802115:	56                   	push   %esi
+  802116:	ff 75 0c             	push   0xc(%ebp)
+  802119:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80211c:	01 c1                	add    %eax,%ecx
+  80211e:	51                   	push   %ecx
+  80211f:	e8 2d ee ff ff       	call   800f51 <memmove>
+	ff->buf_wlen += n;
+  802124:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  802127:	01 f7                	add    %esi,%edi
+  802129:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80212c:	89 f0                	mov    %esi,%eax
+  80212e:	83 c4 10             	add    $0x10,%esp
+}
+  802131:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802134:	5b                   	pop    %ebx
+  802135:	5e                   	pop    %esi
+  802136:	5f                   	pop    %edi
+  802137:	5d                   	pop    %ebp
+  802138:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  802139:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80213f:	76 d1                	jbe    802112 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  802141:	89 f1                	mov    %esi,%ecx
+  802143:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802146:	89 d8                	mov    %ebx,%eax
+  802148:	e8 3a fe ff ff       	call   801f87 <file_write_direct>
+  80214d:	eb e2                	jmp    802131 <devfile_write+0xa4>
+
+0080214f <devfile_trunc>:
+{
+  80214f:	55                   	push   %ebp
+  802150:	89 e5                	mov    %esp,%ebp
+  802152:	53                   	push   %ebx
+  802153:	83 ec 10             	sub    $0x10,%esp
+  802156:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  802159:	53                   	push   %ebx
+  80215a:	e8 b5 fe ff ff       	call   802014 <devfile_sync>
+  80215f:	83 c4 10             	add    $0x10,%esp
+  802162:	85 c0                	test   %eax,%eax
+  802164:	78 1f                	js     802185 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802166:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802169:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  80216e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802171:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802176:	ba 00 00 00 00       	mov    $0x0,%edx
+  80217b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802180:	e8 eb fd ff ff       	call   801f70 <fsipc>
+}
+  802185:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802188:	c9                   	leave
+  802189:	c3                   	ret
+
+0080218a <devfile_stat>:
+{
+  80218a:	55                   	push   %ebp
+  80218b:	89 e5                	mov    %esp,%ebp
+  80218d:	56                   	push   %esi
+  80218e:	53                   	push   %ebx
+  80218f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802192:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  802195:	83 ec 0c             	sub    $0xc,%esp
+  802198:	53                   	push   %ebx
+  802199:	e8 76 fe ff ff       	call   802014 <devfile_sync>
+  80219e:	83 c4 10             	add    $0x10,%esp
+  8021a1:	85 c0                	test   %eax,%eax
+  8021a3:	78 47                	js     8021ec <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021a5:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8021a8:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8021ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8021b7:	e8 b4 fd ff ff       	call   801f70 <fsipc>
+  8021bc:	85 c0                	test   %eax,%eax
+  8021be:	78 2c                	js     8021ec <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021c0:	83 ec 08             	sub    $0x8,%esp
+  8021c3:	68 00 70 80 00       	push   $0x807000
+  8021c8:	56                   	push   %esi
+  8021c9:	e8 fd eb ff ff       	call   800dcb <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8021ce:	a1 80 70 80 00       	mov    0x807080,%eax
+  8021d3:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021d9:	a1 84 70 80 00       	mov    0x807084,%eax
+  8021de:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  8021e4:	83 c4 10             	add    $0x10,%esp
+  8021e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021ef:	5b                   	pop    %ebx
+  8021f0:	5e                   	pop    %esi
+  8021f1:	5d                   	pop    %ebp
+  8021f2:	c3                   	ret
+
+008021f3 <devfile_flush>:
+{
+  8021f3:	55                   	push   %ebp
+  8021f4:	89 e5                	mov    %esp,%ebp
+  8021f6:	56                   	push   %esi
+  8021f7:	53                   	push   %ebx
+  8021f8:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  8021fb:	83 ec 0c             	sub    $0xc,%esp
+  8021fe:	56                   	push   %esi
+  8021ff:	e8 10 fe ff ff       	call   802014 <devfile_sync>
+  802204:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  802206:	83 c4 10             	add    $0x10,%esp
+  802209:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  80220d:	75 25                	jne    802234 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80220f:	8b 46 0c             	mov    0xc(%esi),%eax
+  802212:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  802217:	ba 00 00 00 00       	mov    $0x0,%edx
+  80221c:	b8 06 00 00 00       	mov    $0x6,%eax
+  802221:	e8 4a fd ff ff       	call   801f70 <fsipc>
+  802226:	85 c0                	test   %eax,%eax
+  802228:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80222b:	89 d8                	mov    %ebx,%eax
+  80222d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802230:	5b                   	pop    %ebx
+  802231:	5e                   	pop    %esi
+  802232:	5d                   	pop    %ebp
+  802233:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  802234:	83 ec 0c             	sub    $0xc,%esp
+  802237:	56                   	push   %esi
+  802238:	e8 8e f5 ff ff       	call   8017cb <fd2data>
+  80223d:	83 c4 08             	add    $0x8,%esp
+  802240:	50                   	push   %eax
+  802241:	6a 00                	push   $0x0
+  802243:	e8 1c f0 ff ff       	call   801264 <sys_page_unmap>
+  802248:	83 c4 10             	add    $0x10,%esp
+  80224b:	eb c2                	jmp    80220f <devfile_flush+0x1c>
+
+0080224d <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  80224d:	55                   	push   %ebp
+  80224e:	89 e5                	mov    %esp,%ebp
+  802250:	57                   	push   %edi
+  802251:	56                   	push   %esi
+  802252:	53                   	push   %ebx
+  802253:	83 ec 64             	sub    $0x64,%esp
+  802256:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  802258:	52                   	push   %edx
+  802259:	50                   	push   %eax
+  80225a:	e8 d9 f5 ff ff       	call   801838 <fd_lookup>
+  80225f:	89 c1                	mov    %eax,%ecx
+  802261:	83 c4 10             	add    $0x10,%esp
+  802264:	85 c0                	test   %eax,%eax
+  802266:	0f 88 f2 00 00 00    	js     80235e <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  80226c:	8b 07                	mov    (%edi),%eax
+  80226e:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802274:	39 10                	cmp    %edx,(%eax)
+  802276:	0f 85 03 01 00 00    	jne    80237f <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  80227c:	a1 00 60 80 00       	mov    0x806000,%eax
+  802281:	8b 40 48             	mov    0x48(%eax),%eax
+  802284:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  80228a:	0f 84 96 00 00 00    	je     802326 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  802290:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  802297:	0f 84 cb 00 00 00    	je     802368 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  80229d:	b8 00 70 80 00       	mov    $0x807000,%eax
+  8022a2:	83 c8 07             	or     $0x7,%eax
+  8022a5:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8022a8:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8022ab:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  8022b0:	83 ec 04             	sub    $0x4,%esp
+  8022b3:	68 07 04 00 00       	push   $0x407
+  8022b8:	53                   	push   %ebx
+  8022b9:	6a 00                	push   $0x0
+  8022bb:	e8 17 ef ff ff       	call   8011d7 <sys_page_alloc>
+  8022c0:	89 c1                	mov    %eax,%ecx
+  8022c2:	83 c4 10             	add    $0x10,%esp
+  8022c5:	85 c0                	test   %eax,%eax
+  8022c7:	0f 88 91 00 00 00    	js     80235e <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  8022cd:	89 d8                	mov    %ebx,%eax
+  8022cf:	83 c8 07             	or     $0x7,%eax
+  8022d2:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8022d4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022da:	83 c6 04             	add    $0x4,%esi
+  8022dd:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8022e3:	75 cb                	jne    8022b0 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8022e5:	6a 12                	push   $0x12
+  8022e7:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8022ea:	50                   	push   %eax
+  8022eb:	6a 0c                	push   $0xc
+  8022ed:	ff 35 c8 80 80 00    	push   0x8080c8
+  8022f3:	e8 36 f4 ff ff       	call   80172e <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8022f8:	83 c4 0c             	add    $0xc,%esp
+  8022fb:	6a 00                	push   $0x0
+  8022fd:	6a 00                	push   $0x0
+  8022ff:	6a 00                	push   $0x0
+  802301:	e8 d2 f2 ff ff       	call   8015d8 <ipc_recv>
+  802306:	89 c1                	mov    %eax,%ecx
+  802308:	83 c4 10             	add    $0x10,%esp
+  80230b:	85 c0                	test   %eax,%eax
+  80230d:	78 4f                	js     80235e <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  80230f:	a1 00 60 80 00       	mov    0x806000,%eax
+  802314:	8b 40 48             	mov    0x48(%eax),%eax
+  802317:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  80231c:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  802323:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  802326:	83 ec 0c             	sub    $0xc,%esp
+  802329:	ff 37                	push   (%edi)
+  80232b:	e8 e4 fc ff ff       	call   802014 <devfile_sync>
+  802330:	89 c1                	mov    %eax,%ecx
+  802332:	83 c4 10             	add    $0x10,%esp
+  802335:	85 c0                	test   %eax,%eax
+  802337:	78 25                	js     80235e <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  802339:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  80233f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  802344:	ba 01 00 00 00       	mov    $0x1,%edx
+  802349:	89 d0                	mov    %edx,%eax
+  80234b:	d3 e0                	shl    %cl,%eax
+  80234d:	85 d8                	test   %ebx,%eax
+  80234f:	74 0d                	je     80235e <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802351:	83 c1 01             	add    $0x1,%ecx
+  802354:	83 f9 10             	cmp    $0x10,%ecx
+  802357:	75 f0                	jne    802349 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  802359:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  80235e:	89 c8                	mov    %ecx,%eax
+  802360:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802363:	5b                   	pop    %ebx
+  802364:	5e                   	pop    %esi
+  802365:	5f                   	pop    %edi
+  802366:	5d                   	pop    %ebp
+  802367:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802368:	83 ec 0c             	sub    $0xc,%esp
+  80236b:	6a 01                	push   $0x1
+  80236d:	e8 0a f4 ff ff       	call   80177c <ipc_find_env>
+  802372:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  802377:	83 c4 10             	add    $0x10,%esp
+  80237a:	e9 1e ff ff ff       	jmp    80229d <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  80237f:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  802384:	eb d8                	jmp    80235e <fsring_slot+0x111>
+
+00802386 <file_read_direct>:
+{
+  802386:	55                   	push   %ebp
+  802387:	89 e5                	mov    %esp,%ebp
+  802389:	57                   	push   %edi
+  80238a:	56                   	push   %esi
+  80238b:	53                   	push   %ebx
+  80238c:	83 ec 1c             	sub    $0x1c,%esp
+  80238f:	89 c7                	mov    %eax,%edi
+  802391:	89 d6                	mov    %edx,%esi
+  802393:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  802395:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  80239b:	77 52                	ja     8023ef <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80239d:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023a0:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8023a5:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8023ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023b0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023b5:	e8 b6 fb ff ff       	call   801f70 <fsipc>
+  8023ba:	89 c7                	mov    %eax,%edi
+  8023bc:	85 c0                	test   %eax,%eax
+  8023be:	78 25                	js     8023e5 <file_read_direct+0x5f>
+	assert(r <= n);
+  8023c0:	39 c3                	cmp    %eax,%ebx
+  8023c2:	0f 82 87 00 00 00    	jb     80244f <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  8023c8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8023cd:	0f 8f 95 00 00 00    	jg     802468 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8023d3:	83 ec 04             	sub    $0x4,%esp
+  8023d6:	50                   	push   %eax
+  8023d7:	68 00 70 80 00       	push   $0x807000
+  8023dc:	56                   	push   %esi
+  8023dd:	e8 6f eb ff ff       	call   800f51 <memmove>
+	return r;
+  8023e2:	83 c4 10             	add    $0x10,%esp
+}
+  8023e5:	89 f8                	mov    %edi,%eax
+  8023e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023ea:	5b                   	pop    %ebx
+  8023eb:	5e                   	pop    %esi
+  8023ec:	5f                   	pop    %edi
+  8023ed:	5d                   	pop    %ebp
+  8023ee:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8023ef:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8023f5:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8023fa:	29 d1                	sub    %edx,%ecx
+  8023fc:	39 d9                	cmp    %ebx,%ecx
+  8023fe:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802401:	89 f0                	mov    %esi,%eax
+  802403:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  802406:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802409:	eb 0f                	jmp    80241a <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  80240b:	0f b6 10             	movzbl (%eax),%edx
+  80240e:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802410:	05 00 10 00 00       	add    $0x1000,%eax
+  802415:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80241a:	39 c8                	cmp    %ecx,%eax
+  80241c:	72 ed                	jb     80240b <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  80241e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802421:	8b 47 0c             	mov    0xc(%edi),%eax
+  802424:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  802429:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  80242f:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  802435:	83 ec 0c             	sub    $0xc,%esp
+  802438:	6a 07                	push   $0x7
+  80243a:	89 d9                	mov    %ebx,%ecx
+  80243c:	89 f2                	mov    %esi,%edx
+  80243e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802443:	e8 86 f9 ff ff       	call   801dce <fsipc_pages>
+  802448:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  80244a:	83 c4 10             	add    $0x10,%esp
+  80244d:	eb 96                	jmp    8023e5 <file_read_direct+0x5f>
+	assert(r <= n);
+  80244f:	68 bf 45 80 00       	push   $0x8045bf
+  802454:	68 e7 44 80 00       	push   $0x8044e7
+  802459:	68 dc 00 00 00       	push   $0xdc
+  80245e:	68 b4 45 80 00       	push   $0x8045b4
+  802463:	e8 9a e2 ff ff       	call   800702 <_panic>
+	assert(r <= PGSIZE);
+  802468:	68 d0 45 80 00       	push   $0x8045d0
+  80246d:	68 e7 44 80 00       	push   $0x8044e7
+  802472:	68 dd 00 00 00       	push   $0xdd
+  802477:	68 b4 45 80 00       	push   $0x8045b4
+  80247c:	e8 81 e2 ff ff       	call   800702 <_panic>
+
+00802481 <devfile_read>:
+{
+  802481:	55                   	push   %ebp
+  802482:	89 e5                	mov    %esp,%ebp
+  802484:	57                   	push   %edi
+  802485:	56                   	push   %esi
+  802486:	53                   	push   %ebx
+  802487:	83 ec 28             	sub    $0x28,%esp
+  80248a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80248d:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  802490:	53                   	push   %ebx
+  802491:	e8 35 f3 ff ff       	call   8017cb <fd2data>
+  802496:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  802499:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80249c:	83 c4 10             	add    $0x10,%esp
+  80249f:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8024a3:	74 7d                	je     802522 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8024a5:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8024a9:	0f 85 81 00 00 00    	jne    802530 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  8024af:	8b 43 18             	mov    0x18(%ebx),%eax
+  8024b2:	85 c0                	test   %eax,%eax
+  8024b4:	74 0d                	je     8024c3 <devfile_read+0x42>
+  8024b6:	8b 53 14             	mov    0x14(%ebx),%edx
+  8024b9:	39 fa                	cmp    %edi,%edx
+  8024bb:	7f 06                	jg     8024c3 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8024bd:	01 c2                	add    %eax,%edx
+  8024bf:	39 d7                	cmp    %edx,%edi
+  8024c1:	72 28                	jb     8024eb <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8024c3:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8024ca:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8024d0:	77 74                	ja     802546 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8024d2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024da:	89 d8                	mov    %ebx,%eax
+  8024dc:	e8 a5 fe ff ff       	call   802386 <file_read_direct>
+  8024e1:	85 c0                	test   %eax,%eax
+  8024e3:	7e 35                	jle    80251a <devfile_read+0x99>
+		ff->buf_base = pos;
+  8024e5:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8024e8:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8024eb:	8b 53 14             	mov    0x14(%ebx),%edx
+  8024ee:	89 d0                	mov    %edx,%eax
+  8024f0:	03 43 18             	add    0x18(%ebx),%eax
+  8024f3:	29 f8                	sub    %edi,%eax
+  8024f5:	39 f0                	cmp    %esi,%eax
+  8024f7:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8024fa:	83 ec 04             	sub    $0x4,%esp
+  8024fd:	56                   	push   %esi
+  8024fe:	89 f8                	mov    %edi,%eax
+  802500:	29 d0                	sub    %edx,%eax
+  802502:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802505:	01 c1                	add    %eax,%ecx
+  802507:	51                   	push   %ecx
+  802508:	ff 75 0c             	push   0xc(%ebp)
+  80250b:	e8 41 ea ff ff       	call   800f51 <memmove>
+	fd->fd_offset = pos + n;
+  802510:	01 f7                	add    %esi,%edi
+  802512:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802515:	89 f0                	mov    %esi,%eax
+  802517:	83 c4 10             	add    $0x10,%esp
+}
+  80251a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80251d:	5b                   	pop    %ebx
+  80251e:	5e                   	pop    %esi
+  80251f:	5f                   	pop    %edi
+  802520:	5d                   	pop    %ebp
+  802521:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802522:	89 f1                	mov    %esi,%ecx
+  802524:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802527:	89 d8                	mov    %ebx,%eax
+  802529:	e8 58 fe ff ff       	call   802386 <file_read_direct>
+  80252e:	eb ea                	jmp    80251a <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802530:	83 ec 0c             	sub    $0xc,%esp
+  802533:	53                   	push   %ebx
+  802534:	e8 db fa ff ff       	call   802014 <devfile_sync>
+  802539:	83 c4 10             	add    $0x10,%esp
+  80253c:	85 c0                	test   %eax,%eax
+  80253e:	0f 89 6b ff ff ff    	jns    8024af <devfile_read+0x2e>
+  802544:	eb d4                	jmp    80251a <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  802546:	89 f1                	mov    %esi,%ecx
+  802548:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80254b:	89 d8                	mov    %ebx,%eax
+  80254d:	e8 34 fe ff ff       	call   802386 <file_read_direct>
+  802552:	eb c6                	jmp    80251a <devfile_read+0x99>
+
+00802554 <open>:
+{
+  802554:	55                   	push   %ebp
+  802555:	89 e5                	mov    %esp,%ebp
+  802557:	56                   	push   %esi
+  802558:	53                   	push   %ebx
+  802559:	83 ec 1c             	sub    $0x1c,%esp
+  80255c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80255f:	56                   	push   %esi
+  802560:	e8 2b e8 ff ff       	call   800d90 <strlen>
+  802565:	83 c4 10             	add    $0x10,%esp
+  802568:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80256d:	0f 8f a0 00 00 00    	jg     802613 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  802573:	83 ec 0c             	sub    $0xc,%esp
+  802576:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802579:	50                   	push   %eax
+  80257a:	e8 63 f2 ff ff       	call   8017e2 <fd_alloc>
+  80257f:	89 c3                	mov    %eax,%ebx
+  802581:	83 c4 10             	add    $0x10,%esp
+  802584:	85 c0                	test   %eax,%eax
+  802586:	78 45                	js     8025cd <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  802588:	83 ec 08             	sub    $0x8,%esp
+  80258b:	56                   	push   %esi
+  80258c:	68 00 70 80 00       	push   $0x807000
+  802591:	e8 35 e8 ff ff       	call   800dcb <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802596:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802599:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80259e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025a6:	e8 c5 f9 ff ff       	call   801f70 <fsipc>
+  8025ab:	89 c3                	mov    %eax,%ebx
+  8025ad:	83 c4 10             	add    $0x10,%esp
+  8025b0:	85 c0                	test   %eax,%eax
+  8025b2:	78 22                	js     8025d6 <open+0x82>
+	if (!(mode & O_NOBUF)
+  8025b4:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8025bb:	74 2b                	je     8025e8 <open+0x94>
+	return fd2num(fd);
+  8025bd:	83 ec 0c             	sub    $0xc,%esp
+  8025c0:	ff 75 f4             	push   -0xc(%ebp)
+  8025c3:	e8 f3 f1 ff ff       	call   8017bb <fd2num>
+  8025c8:	89 c3                	mov    %eax,%ebx
+  8025ca:	83 c4 10             	add    $0x10,%esp
+}
+  8025cd:	89 d8                	mov    %ebx,%eax
+  8025cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025d2:	5b                   	pop    %ebx
+  8025d3:	5e                   	pop    %esi
+  8025d4:	5d                   	pop    %ebp
+  8025d5:	c3                   	ret
+		fd_close(fd, 0);
+  8025d6:	83 ec 08             	sub    $0x8,%esp
+  8025d9:	6a 00                	push   $0x0
+  8025db:	ff 75 f4             	push   -0xc(%ebp)
+  8025de:	e8 f8 f2 ff ff       	call   8018db <fd_close>
+		return r;
+  8025e3:	83 c4 10             	add    $0x10,%esp
+  8025e6:	eb e5                	jmp    8025cd <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8025e8:	83 ec 0c             	sub    $0xc,%esp
+  8025eb:	ff 75 f4             	push   -0xc(%ebp)
+  8025ee:	e8 d8 f1 ff ff       	call   8017cb <fd2data>
+  8025f3:	83 c4 0c             	add    $0xc,%esp
+  8025f6:	68 07 04 00 00       	push   $0x407
+  8025fb:	50                   	push   %eax
+  8025fc:	6a 00                	push   $0x0
+  8025fe:	e8 d4 eb ff ff       	call   8011d7 <sys_page_alloc>
+  802603:	83 c4 10             	add    $0x10,%esp
+  802606:	85 c0                	test   %eax,%eax
+  802608:	75 b3                	jne    8025bd <open+0x69>
+		fd->fd_file.buffered = 1;
+  80260a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80260d:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802611:	eb aa                	jmp    8025bd <open+0x69>
+		return -E_BAD_PATH;
+  802613:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802618:	eb b3                	jmp    8025cd <open+0x79>
+
+0080261a <readdir>:
+{
+  80261a:	55                   	push   %ebp
+  80261b:	89 e5                	mov    %esp,%ebp
+  80261d:	53                   	push   %ebx
+  80261e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802621:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802624:	50                   	push   %eax
+  802625:	ff 75 08             	push   0x8(%ebp)
+  802628:	e8 0b f2 ff ff       	call   801838 <fd_lookup>
+  80262d:	89 c3                	mov    %eax,%ebx
+  80262f:	83 c4 10             	add    $0x10,%esp
+  802632:	85 c0                	test   %eax,%eax
+  802634:	78 73                	js     8026a9 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802636:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802639:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  80263f:	39 08                	cmp    %ecx,(%eax)
+  802641:	0f 85 82 00 00 00    	jne    8026c9 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802647:	83 ec 0c             	sub    $0xc,%esp
+  80264a:	50                   	push   %eax
+  80264b:	e8 c4 f9 ff ff       	call   802014 <devfile_sync>
+  802650:	89 c3                	mov    %eax,%ebx
+  802652:	83 c4 10             	add    $0x10,%esp
+  802655:	85 c0                	test   %eax,%eax
+  802657:	78 50                	js     8026a9 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802659:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80265c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80265f:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  802664:	8b 45 10             	mov    0x10(%ebp),%eax
+  802667:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  80266c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80266f:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  802674:	ba 00 00 00 00       	mov    $0x0,%edx
+  802679:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80267e:	e8 ed f8 ff ff       	call   801f70 <fsipc>
+  802683:	89 c3                	mov    %eax,%ebx
+  802685:	85 c0                	test   %eax,%eax
+  802687:	7e 20                	jle    8026a9 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  802689:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80268c:	72 22                	jb     8026b0 <readdir+0x96>
+  80268e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802693:	7f 1b                	jg     8026b0 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802695:	83 ec 04             	sub    $0x4,%esp
+  802698:	50                   	push   %eax
+  802699:	68 00 70 80 00       	push   $0x807000
+  80269e:	ff 75 0c             	push   0xc(%ebp)
+  8026a1:	e8 ab e8 ff ff       	call   800f51 <memmove>
+	return r;
+  8026a6:	83 c4 10             	add    $0x10,%esp
+}
+  8026a9:	89 d8                	mov    %ebx,%eax
+  8026ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026ae:	c9                   	leave
+  8026af:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8026b0:	68 c6 45 80 00       	push   $0x8045c6
+  8026b5:	68 e7 44 80 00       	push   $0x8044e7
+  8026ba:	68 86 01 00 00       	push   $0x186
+  8026bf:	68 b4 45 80 00       	push   $0x8045b4
+  8026c4:	e8 39 e0 ff ff       	call   800702 <_panic>
+		return -E_NOT_SUPP;
+  8026c9:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8026ce:	eb d9                	jmp    8026a9 <readdir+0x8f>
+
+008026d0 <munmap>:
+{
+  8026d0:	55                   	push   %ebp
+  8026d1:	89 e5                	mov    %esp,%ebp
+  8026d3:	56                   	push   %esi
+  8026d4:	53                   	push   %ebx
+  8026d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8026d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8026db:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8026e1:	75 41                	jne    802724 <munmap+0x54>
+  8026e3:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8026e9:	77 39                	ja     802724 <munmap+0x54>
+  8026eb:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8026f0:	29 f0                	sub    %esi,%eax
+  8026f2:	39 d0                	cmp    %edx,%eax
+  8026f4:	72 35                	jb     80272b <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8026f6:	89 f3                	mov    %esi,%ebx
+  8026f8:	01 d6                	add    %edx,%esi
+  8026fa:	39 f3                	cmp    %esi,%ebx
+  8026fc:	73 1a                	jae    802718 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8026fe:	83 ec 08             	sub    $0x8,%esp
+  802701:	53                   	push   %ebx
+  802702:	6a 00                	push   $0x0
+  802704:	e8 5b eb ff ff       	call   801264 <sys_page_unmap>
+  802709:	83 c4 10             	add    $0x10,%esp
+  80270c:	85 c0                	test   %eax,%eax
+  80270e:	78 0d                	js     80271d <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802710:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802716:	eb e2                	jmp    8026fa <munmap+0x2a>
+	return 0;
+  802718:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80271d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802720:	5b                   	pop    %ebx
+  802721:	5e                   	pop    %esi
+  802722:	5d                   	pop    %ebp
+  802723:	c3                   	ret
+		return -E_INVAL;
+  802724:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802729:	eb f2                	jmp    80271d <munmap+0x4d>
+  80272b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802730:	eb eb                	jmp    80271d <munmap+0x4d>
+
+00802732 <mmap>:
+{
+  802732:	55                   	push   %ebp
+  802733:	89 e5                	mov    %esp,%ebp
+  802735:	57                   	push   %edi
+  802736:	56                   	push   %esi
+  802737:	53                   	push   %ebx
+  802738:	83 ec 34             	sub    $0x34,%esp
+  80273b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80273e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802741:	50                   	push   %eax
+  802742:	ff 75 18             	push   0x18(%ebp)
+  802745:	e8 ee f0 ff ff       	call   801838 <fd_lookup>
+  80274a:	89 c3                	mov    %eax,%ebx
+  80274c:	83 c4 10             	add    $0x10,%esp
+  80274f:	85 c0                	test   %eax,%eax
+  802751:	0f 88 0e 01 00 00    	js     802865 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802757:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80275a:	a1 20 50 80 00       	mov    0x805020,%eax
+  80275f:	39 02                	cmp    %eax,(%edx)
+  802761:	0f 85 50 01 00 00    	jne    8028b7 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802767:	8b 45 10             	mov    0x10(%ebp),%eax
+  80276a:	83 e0 02             	and    $0x2,%eax
+  80276d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802770:	74 0a                	je     80277c <mmap+0x4a>
+  802772:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  802776:	0f 84 42 01 00 00    	je     8028be <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  80277c:	8b 42 08             	mov    0x8(%edx),%eax
+  80277f:	83 e0 03             	and    $0x3,%eax
+  802782:	83 f8 01             	cmp    $0x1,%eax
+  802785:	0f 84 3a 01 00 00    	je     8028c5 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  80278b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80278e:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802791:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802796:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802799:	0f 85 2d 01 00 00    	jne    8028cc <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  80279f:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8027a3:	0f 88 2a 01 00 00    	js     8028d3 <mmap+0x1a1>
+  8027a9:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8027b0:	0f 87 1d 01 00 00    	ja     8028d3 <mmap+0x1a1>
+  8027b6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8027bb:	2b 45 08             	sub    0x8(%ebp),%eax
+  8027be:	39 f8                	cmp    %edi,%eax
+  8027c0:	0f 82 14 01 00 00    	jb     8028da <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8027c6:	83 ec 0c             	sub    $0xc,%esp
+  8027c9:	52                   	push   %edx
+  8027ca:	e8 45 f8 ff ff       	call   802014 <devfile_sync>
+  8027cf:	89 c3                	mov    %eax,%ebx
+  8027d1:	83 c4 10             	add    $0x10,%esp
+  8027d4:	85 c0                	test   %eax,%eax
+  8027d6:	0f 88 89 00 00 00    	js     802865 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8027dc:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8027e2:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8027e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ed:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8027f0:	39 fe                	cmp    %edi,%esi
+  8027f2:	73 7b                	jae    80286f <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8027f4:	89 f8                	mov    %edi,%eax
+  8027f6:	29 f0                	sub    %esi,%eax
+  8027f8:	c1 e8 0c             	shr    $0xc,%eax
+  8027fb:	ba 40 00 00 00       	mov    $0x40,%edx
+  802800:	39 d0                	cmp    %edx,%eax
+  802802:	0f 47 c2             	cmova  %edx,%eax
+  802805:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802808:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80280b:	8b 52 0c             	mov    0xc(%edx),%edx
+  80280e:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  802814:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802817:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  80281d:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802822:	89 f2                	mov    %esi,%edx
+  802824:	03 55 08             	add    0x8(%ebp),%edx
+  802827:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80282a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80282f:	e8 ea f6 ff ff       	call   801f1e <fsipcv>
+  802834:	85 c0                	test   %eax,%eax
+  802836:	7e 12                	jle    80284a <mmap+0x118>
+  802838:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80283b:	85 c0                	test   %eax,%eax
+  80283d:	0f 84 9e 00 00 00    	je     8028e1 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802843:	c1 e0 0c             	shl    $0xc,%eax
+  802846:	01 c6                	add    %eax,%esi
+  802848:	eb a6                	jmp    8027f0 <mmap+0xbe>
+			munmap(addr, done);
+  80284a:	89 c3                	mov    %eax,%ebx
+  80284c:	83 ec 08             	sub    $0x8,%esp
+  80284f:	56                   	push   %esi
+  802850:	ff 75 08             	push   0x8(%ebp)
+  802853:	e8 78 fe ff ff       	call   8026d0 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802858:	83 c4 10             	add    $0x10,%esp
+  80285b:	85 db                	test   %ebx,%ebx
+  80285d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802862:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802865:	89 d8                	mov    %ebx,%eax
+  802867:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80286a:	5b                   	pop    %ebx
+  80286b:	5e                   	pop    %esi
+  80286c:	5f                   	pop    %edi
+  80286d:	5d                   	pop    %ebp
+  80286e:	c3                   	ret
+	if (prot & PROT_WRITE)
+  80286f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802872:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802874:	85 c0                	test   %eax,%eax
+  802876:	74 ed                	je     802865 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802878:	be 00 00 00 00       	mov    $0x0,%esi
+  80287d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802880:	39 fe                	cmp    %edi,%esi
+  802882:	73 2e                	jae    8028b2 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802884:	83 ec 0c             	sub    $0xc,%esp
+  802887:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  80288a:	50                   	push   %eax
+  80288b:	e8 fd 0f 00 00       	call   80388d <cowpage>
+  802890:	83 c4 10             	add    $0x10,%esp
+  802893:	85 c0                	test   %eax,%eax
+  802895:	78 08                	js     80289f <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802897:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80289d:	eb e1                	jmp    802880 <mmap+0x14e>
+				munmap(addr, len);
+  80289f:	89 c3                	mov    %eax,%ebx
+  8028a1:	83 ec 08             	sub    $0x8,%esp
+  8028a4:	57                   	push   %edi
+  8028a5:	ff 75 08             	push   0x8(%ebp)
+  8028a8:	e8 23 fe ff ff       	call   8026d0 <munmap>
+				return r;
+  8028ad:	83 c4 10             	add    $0x10,%esp
+  8028b0:	eb b3                	jmp    802865 <mmap+0x133>
+	return 0;
+  8028b2:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8028b5:	eb ae                	jmp    802865 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8028b7:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8028bc:	eb a7                	jmp    802865 <mmap+0x133>
+		return -E_NOT_SUPP;
+  8028be:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8028c3:	eb a0                	jmp    802865 <mmap+0x133>
+		return -E_INVAL;
+  8028c5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8028ca:	eb 99                	jmp    802865 <mmap+0x133>
+  8028cc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8028d1:	eb 92                	jmp    802865 <mmap+0x133>
+  8028d3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8028d8:	eb 8b                	jmp    802865 <mmap+0x133>
+  8028da:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8028df:	eb 84                	jmp    802865 <mmap+0x133>
+			munmap(addr, done);
+  8028e1:	83 ec 08             	sub    $0x8,%esp
+  8028e4:	56                   	push   %esi
+  8028e5:	ff 75 08             	push   0x8(%ebp)
+  8028e8:	e8 e3 fd ff ff       	call   8026d0 <munmap>
+  8028ed:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8028f0:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8028f5:	e9 6b ff ff ff       	jmp    802865 <mmap+0x133>
+
+008028fa <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8028fa:	55                   	push   %ebp
+  8028fb:	89 e5                	mov    %esp,%ebp
+  8028fd:	56                   	push   %esi
+  8028fe:	53                   	push   %ebx
+  8028ff:	83 ec 10             	sub    $0x10,%esp
+  802902:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802905:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802908:	8b 45 08             	mov    0x8(%ebp),%eax
+  80290b:	e8 3d f9 ff ff       	call   80224d <fsring_slot>
+  802910:	85 c0                	test   %eax,%eax
+  802912:	78 60                	js     802974 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802914:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802917:	8b 56 08             	mov    0x8(%esi),%edx
+  80291a:	83 e2 03             	and    $0x3,%edx
+  80291d:	83 fa 01             	cmp    $0x1,%edx
+  802920:	74 59                	je     80297b <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802922:	ba 01 00 00 00       	mov    $0x1,%edx
+  802927:	89 c1                	mov    %eax,%ecx
+  802929:	d3 e2                	shl    %cl,%edx
+  80292b:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802931:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802934:	c1 e2 02             	shl    $0x2,%edx
+  802937:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  80293d:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  802944:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802947:	8b 55 18             	mov    0x18(%ebp),%edx
+  80294a:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80294d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802950:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802953:	83 ec 08             	sub    $0x8,%esp
+  802956:	50                   	push   %eax
+  802957:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80295c:	39 c3                	cmp    %eax,%ebx
+  80295e:	0f 47 d8             	cmova  %eax,%ebx
+  802961:	53                   	push   %ebx
+  802962:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802965:	89 f2                	mov    %esi,%edx
+  802967:	b8 03 00 00 00       	mov    $0x3,%eax
+  80296c:	e8 1e f5 ff ff       	call   801e8f <fsring_post>
+  802971:	83 c4 10             	add    $0x10,%esp
+}
+  802974:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802977:	5b                   	pop    %ebx
+  802978:	5e                   	pop    %esi
+  802979:	5d                   	pop    %ebp
+  80297a:	c3                   	ret
+		return -E_INVAL;
+  80297b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802980:	eb f2                	jmp    802974 <fsring_read+0x7a>
+
+00802982 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802982:	55                   	push   %ebp
+  802983:	89 e5                	mov    %esp,%ebp
+  802985:	56                   	push   %esi
+  802986:	53                   	push   %ebx
+  802987:	83 ec 10             	sub    $0x10,%esp
+  80298a:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80298d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802990:	8b 45 08             	mov    0x8(%ebp),%eax
+  802993:	e8 b5 f8 ff ff       	call   80224d <fsring_slot>
+  802998:	89 c3                	mov    %eax,%ebx
+  80299a:	85 c0                	test   %eax,%eax
+  80299c:	78 77                	js     802a15 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  80299e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029a1:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8029a5:	74 77                	je     802a1e <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8029a7:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8029ac:	39 c6                	cmp    %eax,%esi
+  8029ae:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8029b1:	83 ec 04             	sub    $0x4,%esp
+  8029b4:	56                   	push   %esi
+  8029b5:	ff 75 0c             	push   0xc(%ebp)
+  8029b8:	89 d8                	mov    %ebx,%eax
+  8029ba:	c1 e0 0c             	shl    $0xc,%eax
+  8029bd:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8029c3:	50                   	push   %eax
+  8029c4:	e8 88 e5 ff ff       	call   800f51 <memmove>
+	fsring_busy |= 1 << slot;
+  8029c9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029ce:	89 d9                	mov    %ebx,%ecx
+  8029d0:	d3 e0                	shl    %cl,%eax
+  8029d2:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8029d8:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8029db:	c1 e0 02             	shl    $0x2,%eax
+  8029de:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  8029e4:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  8029eb:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8029ee:	8b 45 18             	mov    0x18(%ebp),%eax
+  8029f1:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8029f4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8029fb:	83 c4 08             	add    $0x8,%esp
+  8029fe:	53                   	push   %ebx
+  8029ff:	56                   	push   %esi
+  802a00:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802a03:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a06:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a0b:	e8 7f f4 ff ff       	call   801e8f <fsring_post>
+  802a10:	89 c3                	mov    %eax,%ebx
+  802a12:	83 c4 10             	add    $0x10,%esp
+}
+  802a15:	89 d8                	mov    %ebx,%eax
+  802a17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a1a:	5b                   	pop    %ebx
+  802a1b:	5e                   	pop    %esi
+  802a1c:	5d                   	pop    %ebp
+  802a1d:	c3                   	ret
+		return -E_INVAL;
+  802a1e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802a23:	eb f0                	jmp    802a15 <fsring_write+0x93>
+
+00802a25 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802a25:	55                   	push   %ebp
+  802a26:	89 e5                	mov    %esp,%ebp
+  802a28:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802a2b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a31:	e8 17 f8 ff ff       	call   80224d <fsring_slot>
+  802a36:	85 c0                	test   %eax,%eax
+  802a38:	78 4c                	js     802a86 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802a3a:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a3f:	89 c1                	mov    %eax,%ecx
+  802a41:	d3 e2                	shl    %cl,%edx
+  802a43:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802a49:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802a4c:	c1 e2 02             	shl    $0x2,%edx
+  802a4f:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  802a55:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  802a5c:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802a5f:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a62:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802a65:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a68:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802a6b:	83 ec 08             	sub    $0x8,%esp
+  802a6e:	50                   	push   %eax
+  802a6f:	6a 00                	push   $0x0
+  802a71:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a76:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a79:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a7e:	e8 0c f4 ff ff       	call   801e8f <fsring_post>
+  802a83:	83 c4 10             	add    $0x10,%esp
+}
+  802a86:	c9                   	leave
+  802a87:	c3                   	ret
+
+00802a88 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802a88:	55                   	push   %ebp
+  802a89:	89 e5                	mov    %esp,%ebp
+  802a8b:	57                   	push   %edi
+  802a8c:	56                   	push   %esi
+  802a8d:	53                   	push   %ebx
+  802a8e:	83 ec 1c             	sub    $0x1c,%esp
+  802a91:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802a95:	a1 00 60 80 00       	mov    0x806000,%eax
+  802a9a:	8b 40 48             	mov    0x48(%eax),%eax
+  802a9d:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  802aa3:	74 12                	je     802ab7 <fsring_reap+0x2f>
+		return 0;
+  802aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802aaa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aad:	5b                   	pop    %ebx
+  802aae:	5e                   	pop    %esi
+  802aaf:	5f                   	pop    %edi
+  802ab0:	5d                   	pop    %ebp
+  802ab1:	c3                   	ret
+		sys_yield();
+  802ab2:	e8 01 e7 ff ff       	call   8011b8 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802ab7:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802abd:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802ac2:	39 c2                	cmp    %eax,%edx
+  802ac4:	75 18                	jne    802ade <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802ac6:	84 db                	test   %bl,%bl
+  802ac8:	0f 84 21 01 00 00    	je     802bef <fsring_reap+0x167>
+  802ace:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  802ad5:	75 db                	jne    802ab2 <fsring_reap+0x2a>
+			return 0;
+  802ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802adc:	eb cc                	jmp    802aaa <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802ade:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802ae3:	83 e0 0f             	and    $0xf,%eax
+  802ae6:	83 c0 2a             	add    $0x2a,%eax
+  802ae9:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802af0:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802af7:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802afc:	83 c0 01             	add    $0x1,%eax
+  802aff:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802b04:	83 fb 0f             	cmp    $0xf,%ebx
+  802b07:	77 5b                	ja     802b64 <fsring_reap+0xdc>
+  802b09:	be 01 00 00 00       	mov    $0x1,%esi
+  802b0e:	89 d9                	mov    %ebx,%ecx
+  802b10:	d3 e6                	shl    %cl,%esi
+  802b12:	89 f0                	mov    %esi,%eax
+  802b14:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  802b1a:	74 48                	je     802b64 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802b1c:	89 d8                	mov    %ebx,%eax
+  802b1e:	c1 e0 0c             	shl    $0xc,%eax
+  802b21:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802b27:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802b2a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802b2d:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  802b34:	83 f8 03             	cmp    $0x3,%eax
+  802b37:	74 40                	je     802b79 <fsring_reap+0xf1>
+  802b39:	83 f8 05             	cmp    $0x5,%eax
+  802b3c:	74 64                	je     802ba2 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802b3e:	f7 d6                	not    %esi
+  802b40:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802b46:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802b49:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  802b50:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b53:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802b55:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b58:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802b5a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b5f:	e9 46 ff ff ff       	jmp    802aaa <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802b64:	53                   	push   %ebx
+  802b65:	68 dc 45 80 00       	push   $0x8045dc
+  802b6a:	68 8f 02 00 00       	push   $0x28f
+  802b6f:	68 b4 45 80 00       	push   $0x8045b4
+  802b74:	e8 89 db ff ff       	call   800702 <_panic>
+		if (cqe.cqe_result > 0)
+  802b79:	85 ff                	test   %edi,%edi
+  802b7b:	7e c1                	jle    802b3e <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802b7d:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802b80:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802b85:	39 c7                	cmp    %eax,%edi
+  802b87:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802b8a:	50                   	push   %eax
+  802b8b:	ff 75 e4             	push   -0x1c(%ebp)
+  802b8e:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802b91:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  802b98:	e8 b4 e3 ff ff       	call   800f51 <memmove>
+  802b9d:	83 c4 10             	add    $0x10,%esp
+  802ba0:	eb 9c                	jmp    802b3e <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802ba2:	85 ff                	test   %edi,%edi
+  802ba4:	75 98                	jne    802b3e <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802ba6:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802ba9:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802bb0:	83 ec 08             	sub    $0x8,%esp
+  802bb3:	ff 75 e4             	push   -0x1c(%ebp)
+  802bb6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802bb9:	51                   	push   %ecx
+  802bba:	e8 0c e2 ff ff       	call   800dcb <strcpy>
+			st->st_size = ret->ret_size;
+  802bbf:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802bc2:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802bc8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802bcb:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802bd1:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802bd7:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802bdd:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  802be4:	50 80 00 
+  802be7:	83 c4 10             	add    $0x10,%esp
+  802bea:	e9 4f ff ff ff       	jmp    802b3e <fsring_reap+0xb6>
+			return 0;
+  802bef:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf4:	e9 b1 fe ff ff       	jmp    802aaa <fsring_reap+0x22>
+
+00802bf9 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802bf9:	55                   	push   %ebp
+  802bfa:	89 e5                	mov    %esp,%ebp
+  802bfc:	57                   	push   %edi
+  802bfd:	56                   	push   %esi
+  802bfe:	53                   	push   %ebx
+  802bff:	83 ec 28             	sub    $0x28,%esp
+  802c02:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802c05:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802c08:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802c0b:	53                   	push   %ebx
+  802c0c:	e8 7f e1 ff ff       	call   800d90 <strlen>
+  802c11:	83 c4 10             	add    $0x10,%esp
+  802c14:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802c19:	0f 8f 02 01 00 00    	jg     802d21 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802c1f:	83 ec 08             	sub    $0x8,%esp
+  802c22:	53                   	push   %ebx
+  802c23:	68 00 70 80 00       	push   $0x807000
+  802c28:	e8 9e e1 ff ff       	call   800dcb <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802c2d:	83 c4 10             	add    $0x10,%esp
+  802c30:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802c36:	76 69                	jbe    802ca1 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802c38:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c3b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802c41:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802c46:	29 d1                	sub    %edx,%ecx
+  802c48:	39 f9                	cmp    %edi,%ecx
+  802c4a:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802c4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c50:	89 f9                	mov    %edi,%ecx
+  802c52:	01 c1                	add    %eax,%ecx
+  802c54:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802c57:	eb 0f                	jmp    802c68 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802c59:	0f b6 10             	movzbl (%eax),%edx
+  802c5c:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802c5e:	05 00 10 00 00       	add    $0x1000,%eax
+  802c63:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802c68:	39 c8                	cmp    %ecx,%eax
+  802c6a:	72 ed                	jb     802c59 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802c6c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802c6f:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802c75:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802c7b:	83 ec 0c             	sub    $0xc,%esp
+  802c7e:	6a 07                	push   $0x7
+  802c80:	89 f9                	mov    %edi,%ecx
+  802c82:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c85:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802c8a:	e8 3f f1 ff ff       	call   801dce <fsipc_pages>
+  802c8f:	89 c7                	mov    %eax,%edi
+  802c91:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802c94:	85 f6                	test   %esi,%esi
+  802c96:	74 7f                	je     802d17 <file_slurp+0x11e>
+  802c98:	8d 43 01             	lea    0x1(%ebx),%eax
+  802c9b:	85 ff                	test   %edi,%edi
+  802c9d:	79 3c                	jns    802cdb <file_slurp+0xe2>
+  802c9f:	eb 76                	jmp    802d17 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802ca1:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802ca7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cac:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802cb1:	e8 ba f2 ff ff       	call   801f70 <fsipc>
+  802cb6:	89 c7                	mov    %eax,%edi
+  802cb8:	85 c0                	test   %eax,%eax
+  802cba:	7e d8                	jle    802c94 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802cbc:	83 ec 04             	sub    $0x4,%esp
+  802cbf:	50                   	push   %eax
+  802cc0:	68 08 70 80 00       	push   $0x807008
+  802cc5:	ff 75 0c             	push   0xc(%ebp)
+  802cc8:	e8 84 e2 ff ff       	call   800f51 <memmove>
+  802ccd:	83 c4 10             	add    $0x10,%esp
+  802cd0:	eb c2                	jmp    802c94 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802cd2:	80 fa 2f             	cmp    $0x2f,%dl
+  802cd5:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802cd8:	83 c0 01             	add    $0x1,%eax
+  802cdb:	89 c1                	mov    %eax,%ecx
+  802cdd:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802ce1:	84 d2                	test   %dl,%dl
+  802ce3:	75 ed                	jne    802cd2 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802ce5:	83 ec 04             	sub    $0x4,%esp
+  802ce8:	68 80 00 00 00       	push   $0x80
+  802ced:	53                   	push   %ebx
+  802cee:	56                   	push   %esi
+  802cef:	e8 4d e1 ff ff       	call   800e41 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802cf4:	a1 00 70 80 00       	mov    0x807000,%eax
+  802cf9:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802cff:	a1 04 70 80 00       	mov    0x807004,%eax
+  802d04:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802d0a:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  802d11:	50 80 00 
+  802d14:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802d17:	89 f8                	mov    %edi,%eax
+  802d19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d1c:	5b                   	pop    %ebx
+  802d1d:	5e                   	pop    %esi
+  802d1e:	5f                   	pop    %edi
+  802d1f:	5d                   	pop    %ebp
+  802d20:	c3                   	ret
+		return -E_BAD_PATH;
+  802d21:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802d26:	eb ef                	jmp    802d17 <file_slurp+0x11e>
+
+00802d28 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802d28:	55                   	push   %ebp
+  802d29:	89 e5                	mov    %esp,%ebp
+  802d2b:	53                   	push   %ebx
+  802d2c:	83 ec 10             	sub    $0x10,%esp
+  802d2f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802d32:	53                   	push   %ebx
+  802d33:	e8 58 e0 ff ff       	call   800d90 <strlen>
+  802d38:	83 c4 10             	add    $0x10,%esp
+  802d3b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802d40:	7f 25                	jg     802d67 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802d42:	83 ec 08             	sub    $0x8,%esp
+  802d45:	53                   	push   %ebx
+  802d46:	68 00 70 80 00       	push   $0x807000
+  802d4b:	e8 7b e0 ff ff       	call   800dcb <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802d50:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d55:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d5a:	e8 11 f2 ff ff       	call   801f70 <fsipc>
+  802d5f:	83 c4 10             	add    $0x10,%esp
+}
+  802d62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d65:	c9                   	leave
+  802d66:	c3                   	ret
+		return -E_BAD_PATH;
+  802d67:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802d6c:	eb f4                	jmp    802d62 <remove+0x3a>
+
+00802d6e <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802d6e:	55                   	push   %ebp
+  802d6f:	89 e5                	mov    %esp,%ebp
+  802d71:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802d74:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d79:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d7e:	e8 ed f1 ff ff       	call   801f70 <fsipc>
+}
+  802d83:	c9                   	leave
+  802d84:	c3                   	ret
+
+00802d85 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802d85:	55                   	push   %ebp
+  802d86:	89 e5                	mov    %esp,%ebp
+  802d88:	57                   	push   %edi
+  802d89:	56                   	push   %esi
+  802d8a:	53                   	push   %ebx
+  802d8b:	83 ec 18             	sub    $0x18,%esp
+  802d8e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d91:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802d97:	57                   	push   %edi
+  802d98:	e8 f3 df ff ff       	call   800d90 <strlen>
+  802d9d:	83 c4 10             	add    $0x10,%esp
+  802da0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802da5:	7f 4c                	jg     802df3 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802da7:	83 ec 08             	sub    $0x8,%esp
+  802daa:	57                   	push   %edi
+  802dab:	68 00 70 80 00       	push   $0x807000
+  802db0:	e8 16 e0 ff ff       	call   800dcb <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802db5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dba:	b8 10 00 00 00       	mov    $0x10,%eax
+  802dbf:	e8 ac f1 ff ff       	call   801f70 <fsipc>
+  802dc4:	83 c4 10             	add    $0x10,%esp
+  802dc7:	85 c0                	test   %eax,%eax
+  802dc9:	78 20                	js     802deb <defrag+0x66>
+		return r;
+	if (before)
+  802dcb:	85 f6                	test   %esi,%esi
+  802dcd:	74 07                	je     802dd6 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802dcf:	a1 00 70 80 00       	mov    0x807000,%eax
+  802dd4:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802dd6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802ddb:	85 db                	test   %ebx,%ebx
+  802ddd:	74 0c                	je     802deb <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802ddf:	a1 04 70 80 00       	mov    0x807004,%eax
+  802de4:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802de6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802deb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dee:	5b                   	pop    %ebx
+  802def:	5e                   	pop    %esi
+  802df0:	5f                   	pop    %edi
+  802df1:	5d                   	pop    %ebp
+  802df2:	c3                   	ret
+		return -E_BAD_PATH;
+  802df3:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802df8:	eb f1                	jmp    802deb <defrag+0x66>
+
+00802dfa <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802dfa:	55                   	push   %ebp
+  802dfb:	89 e5                	mov    %esp,%ebp
+  802dfd:	53                   	push   %ebx
+  802dfe:	83 ec 04             	sub    $0x4,%esp
+  802e01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802e04:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e09:	b8 11 00 00 00       	mov    $0x11,%eax
+  802e0e:	e8 5d f1 ff ff       	call   801f70 <fsipc>
+  802e13:	85 c0                	test   %eax,%eax
+  802e15:	78 34                	js     802e4b <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802e17:	a1 00 70 80 00       	mov    0x807000,%eax
+  802e1c:	89 03                	mov    %eax,(%ebx)
+  802e1e:	a1 04 70 80 00       	mov    0x807004,%eax
+  802e23:	89 43 04             	mov    %eax,0x4(%ebx)
+  802e26:	a1 08 70 80 00       	mov    0x807008,%eax
+  802e2b:	89 43 08             	mov    %eax,0x8(%ebx)
+  802e2e:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  802e33:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802e36:	a1 10 70 80 00       	mov    0x807010,%eax
+  802e3b:	89 43 10             	mov    %eax,0x10(%ebx)
+  802e3e:	a1 14 70 80 00       	mov    0x807014,%eax
+  802e43:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802e46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e4e:	c9                   	leave
+  802e4f:	c3                   	ret
+
+00802e50 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e50:	55                   	push   %ebp
+  802e51:	89 e5                	mov    %esp,%ebp
+  802e53:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802e56:	68 f5 45 80 00       	push   $0x8045f5
+  802e5b:	ff 75 0c             	push   0xc(%ebp)
+  802e5e:	e8 68 df ff ff       	call   800dcb <strcpy>
+	return 0;
+}
+  802e63:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e68:	c9                   	leave
+  802e69:	c3                   	ret
+
+00802e6a <devsock_close>:
+{
+  802e6a:	55                   	push   %ebp
+  802e6b:	89 e5                	mov    %esp,%ebp
+  802e6d:	53                   	push   %ebx
+  802e6e:	83 ec 10             	sub    $0x10,%esp
+  802e71:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802e74:	53                   	push   %ebx
+  802e75:	e8 11 0c 00 00       	call   803a8b <pageref>
+  802e7a:	89 c2                	mov    %eax,%edx
+  802e7c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802e7f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802e84:	83 fa 01             	cmp    $0x1,%edx
+  802e87:	74 05                	je     802e8e <devsock_close+0x24>
+}
+  802e89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e8c:	c9                   	leave
+  802e8d:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802e8e:	83 ec 0c             	sub    $0xc,%esp
+  802e91:	ff 73 0c             	push   0xc(%ebx)
+  802e94:	e8 b7 02 00 00       	call   803150 <nsipc_close>
+  802e99:	83 c4 10             	add    $0x10,%esp
+  802e9c:	eb eb                	jmp    802e89 <devsock_close+0x1f>
+
+00802e9e <devsock_write>:
+{
+  802e9e:	55                   	push   %ebp
+  802e9f:	89 e5                	mov    %esp,%ebp
+  802ea1:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802ea4:	6a 00                	push   $0x0
+  802ea6:	ff 75 10             	push   0x10(%ebp)
+  802ea9:	ff 75 0c             	push   0xc(%ebp)
+  802eac:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eaf:	ff 70 0c             	push   0xc(%eax)
+  802eb2:	e8 79 03 00 00       	call   803230 <nsipc_send>
+}
+  802eb7:	c9                   	leave
+  802eb8:	c3                   	ret
+
+00802eb9 <devsock_read>:
+{
+  802eb9:	55                   	push   %ebp
+  802eba:	89 e5                	mov    %esp,%ebp
+  802ebc:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802ebf:	6a 00                	push   $0x0
+  802ec1:	ff 75 10             	push   0x10(%ebp)
+  802ec4:	ff 75 0c             	push   0xc(%ebp)
+  802ec7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eca:	ff 70 0c             	push   0xc(%eax)
+  802ecd:	e8 ef 02 00 00       	call   8031c1 <nsipc_recv>
+}
+  802ed2:	c9                   	leave
+  802ed3:	c3                   	ret
+
+00802ed4 <fd2sockid>:
+{
+  802ed4:	55                   	push   %ebp
+  802ed5:	89 e5                	mov    %esp,%ebp
+  802ed7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802eda:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802edd:	52                   	push   %edx
+  802ede:	50                   	push   %eax
+  802edf:	e8 54 e9 ff ff       	call   801838 <fd_lookup>
+  802ee4:	83 c4 10             	add    $0x10,%esp
+  802ee7:	85 c0                	test   %eax,%eax
+  802ee9:	78 10                	js     802efb <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802eeb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802eee:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802ef4:	39 08                	cmp    %ecx,(%eax)
+  802ef6:	75 05                	jne    802efd <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802ef8:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802efb:	c9                   	leave
+  802efc:	c3                   	ret
+		return -E_NOT_SUPP;
+  802efd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802f02:	eb f7                	jmp    802efb <fd2sockid+0x27>
+
+00802f04 <alloc_sockfd>:
+{
+  802f04:	55                   	push   %ebp
+  802f05:	89 e5                	mov    %esp,%ebp
+  802f07:	56                   	push   %esi
+  802f08:	53                   	push   %ebx
+  802f09:	83 ec 1c             	sub    $0x1c,%esp
+  802f0c:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802f0e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f11:	50                   	push   %eax
+  802f12:	e8 cb e8 ff ff       	call   8017e2 <fd_alloc>
+  802f17:	89 c3                	mov    %eax,%ebx
+  802f19:	83 c4 10             	add    $0x10,%esp
+  802f1c:	85 c0                	test   %eax,%eax
+  802f1e:	78 43                	js     802f63 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802f20:	83 ec 04             	sub    $0x4,%esp
+  802f23:	68 07 04 00 00       	push   $0x407
+  802f28:	ff 75 f4             	push   -0xc(%ebp)
+  802f2b:	6a 00                	push   $0x0
+  802f2d:	e8 a5 e2 ff ff       	call   8011d7 <sys_page_alloc>
+  802f32:	89 c3                	mov    %eax,%ebx
+  802f34:	83 c4 10             	add    $0x10,%esp
+  802f37:	85 c0                	test   %eax,%eax
+  802f39:	78 28                	js     802f63 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802f3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f3e:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802f44:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802f46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f49:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802f50:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802f53:	83 ec 0c             	sub    $0xc,%esp
+  802f56:	50                   	push   %eax
+  802f57:	e8 5f e8 ff ff       	call   8017bb <fd2num>
+  802f5c:	89 c3                	mov    %eax,%ebx
+  802f5e:	83 c4 10             	add    $0x10,%esp
+  802f61:	eb 0c                	jmp    802f6f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802f63:	83 ec 0c             	sub    $0xc,%esp
+  802f66:	56                   	push   %esi
+  802f67:	e8 e4 01 00 00       	call   803150 <nsipc_close>
+		return r;
+  802f6c:	83 c4 10             	add    $0x10,%esp
+}
+  802f6f:	89 d8                	mov    %ebx,%eax
+  802f71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f74:	5b                   	pop    %ebx
+  802f75:	5e                   	pop    %esi
+  802f76:	5d                   	pop    %ebp
+  802f77:	c3                   	ret
+
+00802f78 <accept>:
+{
+  802f78:	55                   	push   %ebp
+  802f79:	89 e5                	mov    %esp,%ebp
+  802f7b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f81:	e8 4e ff ff ff       	call   802ed4 <fd2sockid>
+  802f86:	85 c0                	test   %eax,%eax
+  802f88:	78 1b                	js     802fa5 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802f8a:	83 ec 04             	sub    $0x4,%esp
+  802f8d:	ff 75 10             	push   0x10(%ebp)
+  802f90:	ff 75 0c             	push   0xc(%ebp)
+  802f93:	50                   	push   %eax
+  802f94:	e8 0e 01 00 00       	call   8030a7 <nsipc_accept>
+  802f99:	83 c4 10             	add    $0x10,%esp
+  802f9c:	85 c0                	test   %eax,%eax
+  802f9e:	78 05                	js     802fa5 <accept+0x2d>
+	return alloc_sockfd(r);
+  802fa0:	e8 5f ff ff ff       	call   802f04 <alloc_sockfd>
+}
+  802fa5:	c9                   	leave
+  802fa6:	c3                   	ret
+
+00802fa7 <bind>:
+{
+  802fa7:	55                   	push   %ebp
+  802fa8:	89 e5                	mov    %esp,%ebp
+  802faa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fad:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fb0:	e8 1f ff ff ff       	call   802ed4 <fd2sockid>
+  802fb5:	85 c0                	test   %eax,%eax
+  802fb7:	78 12                	js     802fcb <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802fb9:	83 ec 04             	sub    $0x4,%esp
+  802fbc:	ff 75 10             	push   0x10(%ebp)
+  802fbf:	ff 75 0c             	push   0xc(%ebp)
+  802fc2:	50                   	push   %eax
+  802fc3:	e8 31 01 00 00       	call   8030f9 <nsipc_bind>
+  802fc8:	83 c4 10             	add    $0x10,%esp
+}
+  802fcb:	c9                   	leave
+  802fcc:	c3                   	ret
+
+00802fcd <shutdown>:
+{
+  802fcd:	55                   	push   %ebp
+  802fce:	89 e5                	mov    %esp,%ebp
+  802fd0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802fd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fd6:	e8 f9 fe ff ff       	call   802ed4 <fd2sockid>
+  802fdb:	85 c0                	test   %eax,%eax
+  802fdd:	78 0f                	js     802fee <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802fdf:	83 ec 08             	sub    $0x8,%esp
+  802fe2:	ff 75 0c             	push   0xc(%ebp)
+  802fe5:	50                   	push   %eax
+  802fe6:	e8 43 01 00 00       	call   80312e <nsipc_shutdown>
+  802feb:	83 c4 10             	add    $0x10,%esp
+}
+  802fee:	c9                   	leave
+  802fef:	c3                   	ret
+
+00802ff0 <connect>:
+{
+  802ff0:	55                   	push   %ebp
+  802ff1:	89 e5                	mov    %esp,%ebp
+  802ff3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ff6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ff9:	e8 d6 fe ff ff       	call   802ed4 <fd2sockid>
+  802ffe:	85 c0                	test   %eax,%eax
+  803000:	78 12                	js     803014 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803002:	83 ec 04             	sub    $0x4,%esp
+  803005:	ff 75 10             	push   0x10(%ebp)
+  803008:	ff 75 0c             	push   0xc(%ebp)
+  80300b:	50                   	push   %eax
+  80300c:	e8 59 01 00 00       	call   80316a <nsipc_connect>
+  803011:	83 c4 10             	add    $0x10,%esp
+}
+  803014:	c9                   	leave
+  803015:	c3                   	ret
+
+00803016 <listen>:
+{
+  803016:	55                   	push   %ebp
+  803017:	89 e5                	mov    %esp,%ebp
+  803019:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80301c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80301f:	e8 b0 fe ff ff       	call   802ed4 <fd2sockid>
+  803024:	85 c0                	test   %eax,%eax
+  803026:	78 0f                	js     803037 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803028:	83 ec 08             	sub    $0x8,%esp
+  80302b:	ff 75 0c             	push   0xc(%ebp)
+  80302e:	50                   	push   %eax
+  80302f:	e8 6b 01 00 00       	call   80319f <nsipc_listen>
+  803034:	83 c4 10             	add    $0x10,%esp
+}
+  803037:	c9                   	leave
+  803038:	c3                   	ret
+
+00803039 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803039:	55                   	push   %ebp
+  80303a:	89 e5                	mov    %esp,%ebp
+  80303c:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80303f:	ff 75 10             	push   0x10(%ebp)
+  803042:	ff 75 0c             	push   0xc(%ebp)
+  803045:	ff 75 08             	push   0x8(%ebp)
+  803048:	e8 41 02 00 00       	call   80328e <nsipc_socket>
+  80304d:	83 c4 10             	add    $0x10,%esp
+  803050:	85 c0                	test   %eax,%eax
+  803052:	78 05                	js     803059 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803054:	e8 ab fe ff ff       	call   802f04 <alloc_sockfd>
+}
+  803059:	c9                   	leave
+  80305a:	c3                   	ret
+
+0080305b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80305b:	55                   	push   %ebp
+  80305c:	89 e5                	mov    %esp,%ebp
+  80305e:	53                   	push   %ebx
+  80305f:	83 ec 04             	sub    $0x4,%esp
+  803062:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803064:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80306b:	74 26                	je     803093 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80306d:	6a 07                	push   $0x7
+  80306f:	68 00 90 80 00       	push   $0x809000
+  803074:	53                   	push   %ebx
+  803075:	ff 35 00 a0 80 00    	push   0x80a000
+  80307b:	e8 c3 e5 ff ff       	call   801643 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803080:	83 c4 0c             	add    $0xc,%esp
+  803083:	6a 00                	push   $0x0
+  803085:	6a 00                	push   $0x0
+  803087:	6a 00                	push   $0x0
+  803089:	e8 4a e5 ff ff       	call   8015d8 <ipc_recv>
+}
+  80308e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803091:	c9                   	leave
+  803092:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803093:	83 ec 0c             	sub    $0xc,%esp
+  803096:	6a 02                	push   $0x2
+  803098:	e8 df e6 ff ff       	call   80177c <ipc_find_env>
+  80309d:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  8030a2:	83 c4 10             	add    $0x10,%esp
+  8030a5:	eb c6                	jmp    80306d <nsipc+0x12>
+
+008030a7 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8030a7:	55                   	push   %ebp
+  8030a8:	89 e5                	mov    %esp,%ebp
+  8030aa:	56                   	push   %esi
+  8030ab:	53                   	push   %ebx
+  8030ac:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8030af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030b2:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8030b7:	8b 06                	mov    (%esi),%eax
+  8030b9:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8030be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030c3:	e8 93 ff ff ff       	call   80305b <nsipc>
+  8030c8:	89 c3                	mov    %eax,%ebx
+  8030ca:	85 c0                	test   %eax,%eax
+  8030cc:	79 09                	jns    8030d7 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8030ce:	89 d8                	mov    %ebx,%eax
+  8030d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030d3:	5b                   	pop    %ebx
+  8030d4:	5e                   	pop    %esi
+  8030d5:	5d                   	pop    %ebp
+  8030d6:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8030d7:	83 ec 04             	sub    $0x4,%esp
+  8030da:	ff 35 10 90 80 00    	push   0x809010
+  8030e0:	68 00 90 80 00       	push   $0x809000
+  8030e5:	ff 75 0c             	push   0xc(%ebp)
+  8030e8:	e8 64 de ff ff       	call   800f51 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8030ed:	a1 10 90 80 00       	mov    0x809010,%eax
+  8030f2:	89 06                	mov    %eax,(%esi)
+  8030f4:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8030f7:	eb d5                	jmp    8030ce <nsipc_accept+0x27>
+
+008030f9 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8030f9:	55                   	push   %ebp
+  8030fa:	89 e5                	mov    %esp,%ebp
+  8030fc:	53                   	push   %ebx
+  8030fd:	83 ec 08             	sub    $0x8,%esp
+  803100:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803103:	8b 45 08             	mov    0x8(%ebp),%eax
+  803106:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80310b:	53                   	push   %ebx
+  80310c:	ff 75 0c             	push   0xc(%ebp)
+  80310f:	68 04 90 80 00       	push   $0x809004
+  803114:	e8 38 de ff ff       	call   800f51 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803119:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  80311f:	b8 02 00 00 00       	mov    $0x2,%eax
+  803124:	e8 32 ff ff ff       	call   80305b <nsipc>
+}
+  803129:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80312c:	c9                   	leave
+  80312d:	c3                   	ret
+
+0080312e <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80312e:	55                   	push   %ebp
+  80312f:	89 e5                	mov    %esp,%ebp
+  803131:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803134:	8b 45 08             	mov    0x8(%ebp),%eax
+  803137:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  80313c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80313f:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  803144:	b8 03 00 00 00       	mov    $0x3,%eax
+  803149:	e8 0d ff ff ff       	call   80305b <nsipc>
+}
+  80314e:	c9                   	leave
+  80314f:	c3                   	ret
+
+00803150 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803150:	55                   	push   %ebp
+  803151:	89 e5                	mov    %esp,%ebp
+  803153:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803156:	8b 45 08             	mov    0x8(%ebp),%eax
+  803159:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  80315e:	b8 04 00 00 00       	mov    $0x4,%eax
+  803163:	e8 f3 fe ff ff       	call   80305b <nsipc>
+}
+  803168:	c9                   	leave
+  803169:	c3                   	ret
+
+0080316a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80316a:	55                   	push   %ebp
+  80316b:	89 e5                	mov    %esp,%ebp
+  80316d:	53                   	push   %ebx
+  80316e:	83 ec 08             	sub    $0x8,%esp
+  803171:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803174:	8b 45 08             	mov    0x8(%ebp),%eax
+  803177:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80317c:	53                   	push   %ebx
+  80317d:	ff 75 0c             	push   0xc(%ebp)
+  803180:	68 04 90 80 00       	push   $0x809004
+  803185:	e8 c7 dd ff ff       	call   800f51 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80318a:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  803190:	b8 05 00 00 00       	mov    $0x5,%eax
+  803195:	e8 c1 fe ff ff       	call   80305b <nsipc>
+}
+  80319a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80319d:	c9                   	leave
+  80319e:	c3                   	ret
+
+0080319f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80319f:	55                   	push   %ebp
+  8031a0:	89 e5                	mov    %esp,%ebp
+  8031a2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8031a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031a8:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8031ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031b0:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8031b5:	b8 06 00 00 00       	mov    $0x6,%eax
+  8031ba:	e8 9c fe ff ff       	call   80305b <nsipc>
+}
+  8031bf:	c9                   	leave
+  8031c0:	c3                   	ret
+
+008031c1 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8031c1:	55                   	push   %ebp
+  8031c2:	89 e5                	mov    %esp,%ebp
+  8031c4:	56                   	push   %esi
+  8031c5:	53                   	push   %ebx
+  8031c6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8031c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031cc:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  8031d1:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  8031d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031da:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8031df:	b8 07 00 00 00       	mov    $0x7,%eax
+  8031e4:	e8 72 fe ff ff       	call   80305b <nsipc>
+  8031e9:	89 c3                	mov    %eax,%ebx
+  8031eb:	85 c0                	test   %eax,%eax
+  8031ed:	78 22                	js     803211 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8031ef:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8031f4:	39 c6                	cmp    %eax,%esi
+  8031f6:	0f 4e c6             	cmovle %esi,%eax
+  8031f9:	39 c3                	cmp    %eax,%ebx
+  8031fb:	7f 1d                	jg     80321a <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8031fd:	83 ec 04             	sub    $0x4,%esp
+  803200:	53                   	push   %ebx
+  803201:	68 00 90 80 00       	push   $0x809000
+  803206:	ff 75 0c             	push   0xc(%ebp)
+  803209:	e8 43 dd ff ff       	call   800f51 <memmove>
+  80320e:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803211:	89 d8                	mov    %ebx,%eax
+  803213:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803216:	5b                   	pop    %ebx
+  803217:	5e                   	pop    %esi
+  803218:	5d                   	pop    %ebp
+  803219:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80321a:	68 01 46 80 00       	push   $0x804601
+  80321f:	68 e7 44 80 00       	push   $0x8044e7
+  803224:	6a 62                	push   $0x62
+  803226:	68 16 46 80 00       	push   $0x804616
+  80322b:	e8 d2 d4 ff ff       	call   800702 <_panic>
+
+00803230 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803230:	55                   	push   %ebp
+  803231:	89 e5                	mov    %esp,%ebp
+  803233:	53                   	push   %ebx
+  803234:	83 ec 04             	sub    $0x4,%esp
+  803237:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80323a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80323d:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803242:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803248:	7f 2e                	jg     803278 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80324a:	83 ec 04             	sub    $0x4,%esp
+  80324d:	53                   	push   %ebx
+  80324e:	ff 75 0c             	push   0xc(%ebp)
+  803251:	68 0c 90 80 00       	push   $0x80900c
+  803256:	e8 f6 dc ff ff       	call   800f51 <memmove>
+	nsipcbuf.send.req_size = size;
+  80325b:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803261:	8b 45 14             	mov    0x14(%ebp),%eax
+  803264:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803269:	b8 08 00 00 00       	mov    $0x8,%eax
+  80326e:	e8 e8 fd ff ff       	call   80305b <nsipc>
+}
+  803273:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803276:	c9                   	leave
+  803277:	c3                   	ret
+	assert(size < 1600);
+  803278:	68 22 46 80 00       	push   $0x804622
+  80327d:	68 e7 44 80 00       	push   $0x8044e7
+  803282:	6a 6d                	push   $0x6d
+  803284:	68 16 46 80 00       	push   $0x804616
+  803289:	e8 74 d4 ff ff       	call   800702 <_panic>
+
+0080328e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80328e:	55                   	push   %ebp
+  80328f:	89 e5                	mov    %esp,%ebp
+  803291:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803294:	8b 45 08             	mov    0x8(%ebp),%eax
+  803297:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  80329c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80329f:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  8032a4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032a7:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8032ac:	b8 09 00 00 00       	mov    $0x9,%eax
+  8032b1:	e8 a5 fd ff ff       	call   80305b <nsipc>
+}
+  8032b6:	c9                   	leave
+  8032b7:	c3                   	ret
+
+008032b8 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8032b8:	55                   	push   %ebp
+  8032b9:	89 e5                	mov    %esp,%ebp
+  8032bb:	56                   	push   %esi
+  8032bc:	53                   	push   %ebx
+  8032bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8032c0:	83 ec 0c             	sub    $0xc,%esp
+  8032c3:	ff 75 08             	push   0x8(%ebp)
+  8032c6:	e8 00 e5 ff ff       	call   8017cb <fd2data>
+  8032cb:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8032cd:	83 c4 08             	add    $0x8,%esp
+  8032d0:	68 2e 46 80 00       	push   $0x80462e
+  8032d5:	53                   	push   %ebx
+  8032d6:	e8 f0 da ff ff       	call   800dcb <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8032db:	8b 46 04             	mov    0x4(%esi),%eax
+  8032de:	2b 06                	sub    (%esi),%eax
+  8032e0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8032e6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8032ed:	00 00 00 
+	stat->st_dev = &devpipe;
+  8032f0:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  8032f7:	50 80 00 
+	return 0;
+}
+  8032fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803302:	5b                   	pop    %ebx
+  803303:	5e                   	pop    %esi
+  803304:	5d                   	pop    %ebp
+  803305:	c3                   	ret
+
+00803306 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803306:	55                   	push   %ebp
+  803307:	89 e5                	mov    %esp,%ebp
+  803309:	53                   	push   %ebx
+  80330a:	83 ec 0c             	sub    $0xc,%esp
+  80330d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803310:	53                   	push   %ebx
+  803311:	6a 00                	push   $0x0
+  803313:	e8 4c df ff ff       	call   801264 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803318:	89 1c 24             	mov    %ebx,(%esp)
+  80331b:	e8 ab e4 ff ff       	call   8017cb <fd2data>
+  803320:	83 c4 08             	add    $0x8,%esp
+  803323:	50                   	push   %eax
+  803324:	6a 00                	push   $0x0
+  803326:	e8 39 df ff ff       	call   801264 <sys_page_unmap>
+}
+  80332b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80332e:	c9                   	leave
+  80332f:	c3                   	ret
+
+00803330 <_pipeisclosed>:
+{
+  803330:	55                   	push   %ebp
+  803331:	89 e5                	mov    %esp,%ebp
+  803333:	57                   	push   %edi
+  803334:	56                   	push   %esi
+  803335:	53                   	push   %ebx
+  803336:	83 ec 1c             	sub    $0x1c,%esp
+  803339:	89 c7                	mov    %eax,%edi
+  80333b:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80333d:	a1 00 60 80 00       	mov    0x806000,%eax
+  803342:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803345:	83 ec 0c             	sub    $0xc,%esp
+  803348:	57                   	push   %edi
+  803349:	e8 3d 07 00 00       	call   803a8b <pageref>
+  80334e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803351:	89 34 24             	mov    %esi,(%esp)
+  803354:	e8 32 07 00 00       	call   803a8b <pageref>
+		nn = thisenv->env_runs;
+  803359:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80335f:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  803362:	83 c4 10             	add    $0x10,%esp
+  803365:	39 cb                	cmp    %ecx,%ebx
+  803367:	74 1b                	je     803384 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  803369:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80336c:	75 cf                	jne    80333d <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80336e:	8b 42 58             	mov    0x58(%edx),%eax
+  803371:	6a 01                	push   $0x1
+  803373:	50                   	push   %eax
+  803374:	53                   	push   %ebx
+  803375:	68 35 46 80 00       	push   $0x804635
+  80337a:	e8 5e d4 ff ff       	call   8007dd <cprintf>
+  80337f:	83 c4 10             	add    $0x10,%esp
+  803382:	eb b9                	jmp    80333d <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  803384:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803387:	0f 94 c0             	sete   %al
+  80338a:	0f b6 c0             	movzbl %al,%eax
+}
+  80338d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803390:	5b                   	pop    %ebx
+  803391:	5e                   	pop    %esi
+  803392:	5f                   	pop    %edi
+  803393:	5d                   	pop    %ebp
+  803394:	c3                   	ret
+
+00803395 <devpipe_write>:
+{
+  803395:	55                   	push   %ebp
+  803396:	89 e5                	mov    %esp,%ebp
+  803398:	57                   	push   %edi
+  803399:	56                   	push   %esi
+  80339a:	53                   	push   %ebx
+  80339b:	83 ec 28             	sub    $0x28,%esp
+  80339e:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8033a1:	56                   	push   %esi
+  8033a2:	e8 24 e4 ff ff       	call   8017cb <fd2data>
+  8033a7:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8033a9:	83 c4 10             	add    $0x10,%esp
+  8033ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033b1:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8033b4:	75 09                	jne    8033bf <devpipe_write+0x2a>
+	return i;
+  8033b6:	89 f8                	mov    %edi,%eax
+  8033b8:	eb 23                	jmp    8033dd <devpipe_write+0x48>
+			sys_yield();
+  8033ba:	e8 f9 dd ff ff       	call   8011b8 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8033bf:	8b 43 04             	mov    0x4(%ebx),%eax
+  8033c2:	8b 0b                	mov    (%ebx),%ecx
+  8033c4:	8d 51 20             	lea    0x20(%ecx),%edx
+  8033c7:	39 d0                	cmp    %edx,%eax
+  8033c9:	72 1a                	jb     8033e5 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8033cb:	89 da                	mov    %ebx,%edx
+  8033cd:	89 f0                	mov    %esi,%eax
+  8033cf:	e8 5c ff ff ff       	call   803330 <_pipeisclosed>
+  8033d4:	85 c0                	test   %eax,%eax
+  8033d6:	74 e2                	je     8033ba <devpipe_write+0x25>
+				return 0;
+  8033d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033e0:	5b                   	pop    %ebx
+  8033e1:	5e                   	pop    %esi
+  8033e2:	5f                   	pop    %edi
+  8033e3:	5d                   	pop    %ebp
+  8033e4:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8033e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8033e8:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8033ec:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8033ef:	89 c2                	mov    %eax,%edx
+  8033f1:	c1 fa 1f             	sar    $0x1f,%edx
+  8033f4:	89 d1                	mov    %edx,%ecx
+  8033f6:	c1 e9 1b             	shr    $0x1b,%ecx
+  8033f9:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8033fc:	83 e2 1f             	and    $0x1f,%edx
+  8033ff:	29 ca                	sub    %ecx,%edx
+  803401:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803405:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803409:	83 c0 01             	add    $0x1,%eax
+  80340c:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80340f:	83 c7 01             	add    $0x1,%edi
+  803412:	eb 9d                	jmp    8033b1 <devpipe_write+0x1c>
+
+00803414 <devpipe_read>:
+{
+  803414:	55                   	push   %ebp
+  803415:	89 e5                	mov    %esp,%ebp
+  803417:	57                   	push   %edi
+  803418:	56                   	push   %esi
+  803419:	53                   	push   %ebx
+  80341a:	83 ec 18             	sub    $0x18,%esp
+  80341d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803420:	57                   	push   %edi
+  803421:	e8 a5 e3 ff ff       	call   8017cb <fd2data>
+  803426:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803428:	83 c4 10             	add    $0x10,%esp
+  80342b:	be 00 00 00 00       	mov    $0x0,%esi
+  803430:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803433:	75 13                	jne    803448 <devpipe_read+0x34>
+	return i;
+  803435:	89 f0                	mov    %esi,%eax
+  803437:	eb 02                	jmp    80343b <devpipe_read+0x27>
+				return i;
+  803439:	89 f0                	mov    %esi,%eax
+}
+  80343b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80343e:	5b                   	pop    %ebx
+  80343f:	5e                   	pop    %esi
+  803440:	5f                   	pop    %edi
+  803441:	5d                   	pop    %ebp
+  803442:	c3                   	ret
+			sys_yield();
+  803443:	e8 70 dd ff ff       	call   8011b8 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803448:	8b 03                	mov    (%ebx),%eax
+  80344a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80344d:	75 18                	jne    803467 <devpipe_read+0x53>
+			if (i > 0)
+  80344f:	85 f6                	test   %esi,%esi
+  803451:	75 e6                	jne    803439 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803453:	89 da                	mov    %ebx,%edx
+  803455:	89 f8                	mov    %edi,%eax
+  803457:	e8 d4 fe ff ff       	call   803330 <_pipeisclosed>
+  80345c:	85 c0                	test   %eax,%eax
+  80345e:	74 e3                	je     803443 <devpipe_read+0x2f>
+				return 0;
+  803460:	b8 00 00 00 00       	mov    $0x0,%eax
+  803465:	eb d4                	jmp    80343b <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803467:	99                   	cltd
+  803468:	c1 ea 1b             	shr    $0x1b,%edx
+  80346b:	01 d0                	add    %edx,%eax
+  80346d:	83 e0 1f             	and    $0x1f,%eax
+  803470:	29 d0                	sub    %edx,%eax
+  803472:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803477:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80347a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80347d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803480:	83 c6 01             	add    $0x1,%esi
+  803483:	eb ab                	jmp    803430 <devpipe_read+0x1c>
+
+00803485 <pipe>:
+{
+  803485:	55                   	push   %ebp
+  803486:	89 e5                	mov    %esp,%ebp
+  803488:	56                   	push   %esi
+  803489:	53                   	push   %ebx
+  80348a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80348d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803490:	50                   	push   %eax
+  803491:	e8 4c e3 ff ff       	call   8017e2 <fd_alloc>
+  803496:	89 c3                	mov    %eax,%ebx
+  803498:	83 c4 10             	add    $0x10,%esp
+  80349b:	85 c0                	test   %eax,%eax
+  80349d:	0f 88 23 01 00 00    	js     8035c6 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8034a3:	83 ec 04             	sub    $0x4,%esp
+  8034a6:	68 07 04 00 00       	push   $0x407
+  8034ab:	ff 75 f4             	push   -0xc(%ebp)
+  8034ae:	6a 00                	push   $0x0
+  8034b0:	e8 22 dd ff ff       	call   8011d7 <sys_page_alloc>
+  8034b5:	89 c3                	mov    %eax,%ebx
+  8034b7:	83 c4 10             	add    $0x10,%esp
+  8034ba:	85 c0                	test   %eax,%eax
+  8034bc:	0f 88 04 01 00 00    	js     8035c6 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8034c2:	83 ec 0c             	sub    $0xc,%esp
+  8034c5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8034c8:	50                   	push   %eax
+  8034c9:	e8 14 e3 ff ff       	call   8017e2 <fd_alloc>
+  8034ce:	89 c3                	mov    %eax,%ebx
+  8034d0:	83 c4 10             	add    $0x10,%esp
+  8034d3:	85 c0                	test   %eax,%eax
+  8034d5:	0f 88 db 00 00 00    	js     8035b6 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8034db:	83 ec 04             	sub    $0x4,%esp
+  8034de:	68 07 04 00 00       	push   $0x407
+  8034e3:	ff 75 f0             	push   -0x10(%ebp)
+  8034e6:	6a 00                	push   $0x0
+  8034e8:	e8 ea dc ff ff       	call   8011d7 <sys_page_alloc>
+  8034ed:	89 c3                	mov    %eax,%ebx
+  8034ef:	83 c4 10             	add    $0x10,%esp
+  8034f2:	85 c0                	test   %eax,%eax
+  8034f4:	0f 88 bc 00 00 00    	js     8035b6 <pipe+0x131>
+	va = fd2data(fd0);
+  8034fa:	83 ec 0c             	sub    $0xc,%esp
+  8034fd:	ff 75 f4             	push   -0xc(%ebp)
+  803500:	e8 c6 e2 ff ff       	call   8017cb <fd2data>
+  803505:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803507:	83 c4 0c             	add    $0xc,%esp
+  80350a:	68 07 04 00 00       	push   $0x407
+  80350f:	50                   	push   %eax
+  803510:	6a 00                	push   $0x0
+  803512:	e8 c0 dc ff ff       	call   8011d7 <sys_page_alloc>
+  803517:	89 c3                	mov    %eax,%ebx
+  803519:	83 c4 10             	add    $0x10,%esp
+  80351c:	85 c0                	test   %eax,%eax
+  80351e:	0f 88 82 00 00 00    	js     8035a6 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803524:	83 ec 0c             	sub    $0xc,%esp
+  803527:	ff 75 f0             	push   -0x10(%ebp)
+  80352a:	e8 9c e2 ff ff       	call   8017cb <fd2data>
+  80352f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803536:	50                   	push   %eax
+  803537:	6a 00                	push   $0x0
+  803539:	56                   	push   %esi
+  80353a:	6a 00                	push   $0x0
+  80353c:	e8 e1 dc ff ff       	call   801222 <sys_page_map>
+  803541:	89 c3                	mov    %eax,%ebx
+  803543:	83 c4 20             	add    $0x20,%esp
+  803546:	85 c0                	test   %eax,%eax
+  803548:	78 4e                	js     803598 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80354a:	a1 60 50 80 00       	mov    0x805060,%eax
+  80354f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803552:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803554:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803557:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80355e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803561:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803563:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803566:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80356d:	83 ec 0c             	sub    $0xc,%esp
+  803570:	ff 75 f4             	push   -0xc(%ebp)
+  803573:	e8 43 e2 ff ff       	call   8017bb <fd2num>
+  803578:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80357b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80357d:	83 c4 04             	add    $0x4,%esp
+  803580:	ff 75 f0             	push   -0x10(%ebp)
+  803583:	e8 33 e2 ff ff       	call   8017bb <fd2num>
+  803588:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80358b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80358e:	83 c4 10             	add    $0x10,%esp
+  803591:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803596:	eb 2e                	jmp    8035c6 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803598:	83 ec 08             	sub    $0x8,%esp
+  80359b:	56                   	push   %esi
+  80359c:	6a 00                	push   $0x0
+  80359e:	e8 c1 dc ff ff       	call   801264 <sys_page_unmap>
+  8035a3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8035a6:	83 ec 08             	sub    $0x8,%esp
+  8035a9:	ff 75 f0             	push   -0x10(%ebp)
+  8035ac:	6a 00                	push   $0x0
+  8035ae:	e8 b1 dc ff ff       	call   801264 <sys_page_unmap>
+  8035b3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8035b6:	83 ec 08             	sub    $0x8,%esp
+  8035b9:	ff 75 f4             	push   -0xc(%ebp)
+  8035bc:	6a 00                	push   $0x0
+  8035be:	e8 a1 dc ff ff       	call   801264 <sys_page_unmap>
+  8035c3:	83 c4 10             	add    $0x10,%esp
+}
+  8035c6:	89 d8                	mov    %ebx,%eax
+  8035c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035cb:	5b                   	pop    %ebx
+  8035cc:	5e                   	pop    %esi
+  8035cd:	5d                   	pop    %ebp
+  8035ce:	c3                   	ret
+
+008035cf <pipeisclosed>:
+{
+  8035cf:	55                   	push   %ebp
+  8035d0:	89 e5                	mov    %esp,%ebp
+  8035d2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8035d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035d8:	50                   	push   %eax
+  8035d9:	ff 75 08             	push   0x8(%ebp)
+  8035dc:	e8 57 e2 ff ff       	call   801838 <fd_lookup>
+  8035e1:	83 c4 10             	add    $0x10,%esp
+  8035e4:	85 c0                	test   %eax,%eax
+  8035e6:	78 18                	js     803600 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8035e8:	83 ec 0c             	sub    $0xc,%esp
+  8035eb:	ff 75 f4             	push   -0xc(%ebp)
+  8035ee:	e8 d8 e1 ff ff       	call   8017cb <fd2data>
+  8035f3:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8035f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035f8:	e8 33 fd ff ff       	call   803330 <_pipeisclosed>
+  8035fd:	83 c4 10             	add    $0x10,%esp
+}
+  803600:	c9                   	leave
+  803601:	c3                   	ret
+
+00803602 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803602:	b8 00 00 00 00       	mov    $0x0,%eax
+  803607:	c3                   	ret
+
+00803608 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803608:	55                   	push   %ebp
+  803609:	89 e5                	mov    %esp,%ebp
+  80360b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80360e:	68 4d 46 80 00       	push   $0x80464d
+  803613:	ff 75 0c             	push   0xc(%ebp)
+  803616:	e8 b0 d7 ff ff       	call   800dcb <strcpy>
+	return 0;
+}
+  80361b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803620:	c9                   	leave
+  803621:	c3                   	ret
+
+00803622 <devcons_write>:
+{
+  803622:	55                   	push   %ebp
+  803623:	89 e5                	mov    %esp,%ebp
+  803625:	57                   	push   %edi
+  803626:	56                   	push   %esi
+  803627:	53                   	push   %ebx
+  803628:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80362e:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803633:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803639:	eb 2e                	jmp    803669 <devcons_write+0x47>
+		m = n - tot;
+  80363b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80363e:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803640:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803645:	39 c3                	cmp    %eax,%ebx
+  803647:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80364a:	83 ec 04             	sub    $0x4,%esp
+  80364d:	53                   	push   %ebx
+  80364e:	89 f0                	mov    %esi,%eax
+  803650:	03 45 0c             	add    0xc(%ebp),%eax
+  803653:	50                   	push   %eax
+  803654:	57                   	push   %edi
+  803655:	e8 f7 d8 ff ff       	call   800f51 <memmove>
+		sys_cputs(buf, m);
+  80365a:	83 c4 08             	add    $0x8,%esp
+  80365d:	53                   	push   %ebx
+  80365e:	57                   	push   %edi
+  80365f:	e8 97 da ff ff       	call   8010fb <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803664:	01 de                	add    %ebx,%esi
+  803666:	83 c4 10             	add    $0x10,%esp
+  803669:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80366c:	72 cd                	jb     80363b <devcons_write+0x19>
+}
+  80366e:	89 f0                	mov    %esi,%eax
+  803670:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803673:	5b                   	pop    %ebx
+  803674:	5e                   	pop    %esi
+  803675:	5f                   	pop    %edi
+  803676:	5d                   	pop    %ebp
+  803677:	c3                   	ret
+
+00803678 <devcons_read>:
+{
+  803678:	55                   	push   %ebp
+  803679:	89 e5                	mov    %esp,%ebp
+  80367b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80367e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803683:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803687:	75 07                	jne    803690 <devcons_read+0x18>
+  803689:	eb 1f                	jmp    8036aa <devcons_read+0x32>
+		sys_yield();
+  80368b:	e8 28 db ff ff       	call   8011b8 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803690:	e8 8c da ff ff       	call   801121 <sys_cgetc>
+  803695:	85 c0                	test   %eax,%eax
+  803697:	74 f2                	je     80368b <devcons_read+0x13>
+	if (c < 0)
+  803699:	78 0f                	js     8036aa <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80369b:	83 f8 04             	cmp    $0x4,%eax
+  80369e:	74 0c                	je     8036ac <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8036a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8036a3:	88 02                	mov    %al,(%edx)
+	return 1;
+  8036a5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8036aa:	c9                   	leave
+  8036ab:	c3                   	ret
+		return 0;
+  8036ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b1:	eb f7                	jmp    8036aa <devcons_read+0x32>
+
+008036b3 <cputchar>:
+{
+  8036b3:	55                   	push   %ebp
+  8036b4:	89 e5                	mov    %esp,%ebp
+  8036b6:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8036b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036bc:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8036bf:	6a 01                	push   $0x1
+  8036c1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8036c4:	50                   	push   %eax
+  8036c5:	e8 31 da ff ff       	call   8010fb <sys_cputs>
+}
+  8036ca:	83 c4 10             	add    $0x10,%esp
+  8036cd:	c9                   	leave
+  8036ce:	c3                   	ret
+
+008036cf <getchar>:
+{
+  8036cf:	55                   	push   %ebp
+  8036d0:	89 e5                	mov    %esp,%ebp
+  8036d2:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8036d5:	6a 01                	push   $0x1
+  8036d7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8036da:	50                   	push   %eax
+  8036db:	6a 00                	push   $0x0
+  8036dd:	e8 bc e3 ff ff       	call   801a9e <read>
+	if (r < 0)
+  8036e2:	83 c4 10             	add    $0x10,%esp
+  8036e5:	85 c0                	test   %eax,%eax
+  8036e7:	78 06                	js     8036ef <getchar+0x20>
+	if (r < 1)
+  8036e9:	74 06                	je     8036f1 <getchar+0x22>
+	return c;
+  8036eb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8036ef:	c9                   	leave
+  8036f0:	c3                   	ret
+		return -E_EOF;
+  8036f1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8036f6:	eb f7                	jmp    8036ef <getchar+0x20>
+
+008036f8 <iscons>:
+{
+  8036f8:	55                   	push   %ebp
+  8036f9:	89 e5                	mov    %esp,%ebp
+  8036fb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8036fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803701:	50                   	push   %eax
+  803702:	ff 75 08             	push   0x8(%ebp)
+  803705:	e8 2e e1 ff ff       	call   801838 <fd_lookup>
+  80370a:	83 c4 10             	add    $0x10,%esp
+  80370d:	85 c0                	test   %eax,%eax
+  80370f:	78 11                	js     803722 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803711:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803714:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80371a:	39 10                	cmp    %edx,(%eax)
+  80371c:	0f 94 c0             	sete   %al
+  80371f:	0f b6 c0             	movzbl %al,%eax
+}
+  803722:	c9                   	leave
+  803723:	c3                   	ret
+
+00803724 <opencons>:
+{
+  803724:	55                   	push   %ebp
+  803725:	89 e5                	mov    %esp,%ebp
+  803727:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80372a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80372d:	50                   	push   %eax
+  80372e:	e8 af e0 ff ff       	call   8017e2 <fd_alloc>
+  803733:	83 c4 10             	add    $0x10,%esp
+  803736:	85 c0                	test   %eax,%eax
+  803738:	78 3a                	js     803774 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80373a:	83 ec 04             	sub    $0x4,%esp
+  80373d:	68 07 04 00 00       	push   $0x407
+  803742:	ff 75 f4             	push   -0xc(%ebp)
+  803745:	6a 00                	push   $0x0
+  803747:	e8 8b da ff ff       	call   8011d7 <sys_page_alloc>
+  80374c:	83 c4 10             	add    $0x10,%esp
+  80374f:	85 c0                	test   %eax,%eax
+  803751:	78 21                	js     803774 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803753:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803756:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80375c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80375e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803761:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803768:	83 ec 0c             	sub    $0xc,%esp
+  80376b:	50                   	push   %eax
+  80376c:	e8 4a e0 ff ff       	call   8017bb <fd2num>
+  803771:	83 c4 10             	add    $0x10,%esp
+}
+  803774:	c9                   	leave
+  803775:	c3                   	ret
+
+00803776 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  803776:	55                   	push   %ebp
+  803777:	89 e5                	mov    %esp,%ebp
+  803779:	57                   	push   %edi
+  80377a:	56                   	push   %esi
+  80377b:	53                   	push   %ebx
+  80377c:	83 ec 20             	sub    $0x20,%esp
+  80377f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803782:	89 d7                	mov    %edx,%edi
+  803784:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  803786:	51                   	push   %ecx
+  803787:	68 00 f0 7f 00       	push   $0x7ff000
+  80378c:	6a 00                	push   $0x0
+  80378e:	e8 44 da ff ff       	call   8011d7 <sys_page_alloc>
+  803793:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803795:	83 c4 10             	add    $0x10,%esp
+  803798:	85 c0                	test   %eax,%eax
+  80379a:	78 45                	js     8037e1 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  80379c:	83 ec 04             	sub    $0x4,%esp
+  80379f:	68 00 10 00 00       	push   $0x1000
+  8037a4:	57                   	push   %edi
+  8037a5:	68 00 f0 7f 00       	push   $0x7ff000
+  8037aa:	e8 a2 d7 ff ff       	call   800f51 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8037af:	89 34 24             	mov    %esi,(%esp)
+  8037b2:	57                   	push   %edi
+  8037b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8037b6:	68 00 f0 7f 00       	push   $0x7ff000
+  8037bb:	6a 00                	push   $0x0
+  8037bd:	e8 60 da ff ff       	call   801222 <sys_page_map>
+  8037c2:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8037c4:	83 c4 20             	add    $0x20,%esp
+  8037c7:	85 c0                	test   %eax,%eax
+  8037c9:	78 16                	js     8037e1 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8037cb:	83 ec 08             	sub    $0x8,%esp
+  8037ce:	68 00 f0 7f 00       	push   $0x7ff000
+  8037d3:	6a 00                	push   $0x0
+  8037d5:	e8 8a da ff ff       	call   801264 <sys_page_unmap>
+  8037da:	83 c4 10             	add    $0x10,%esp
+  8037dd:	85 c0                	test   %eax,%eax
+  8037df:	75 0a                	jne    8037eb <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8037e1:	89 d8                	mov    %ebx,%eax
+  8037e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037e6:	5b                   	pop    %ebx
+  8037e7:	5e                   	pop    %esi
+  8037e8:	5f                   	pop    %edi
+  8037e9:	5d                   	pop    %ebp
+  8037ea:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8037eb:	68 5c 46 80 00       	push   $0x80465c
+  8037f0:	68 e7 44 80 00       	push   $0x8044e7
+  8037f5:	6a 1b                	push   $0x1b
+  8037f7:	68 d4 46 80 00       	push   $0x8046d4
+  8037fc:	e8 01 cf ff ff       	call   800702 <_panic>
+
+00803801 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803801:	55                   	push   %ebp
+  803802:	89 e5                	mov    %esp,%ebp
+  803804:	53                   	push   %ebx
+  803805:	83 ec 04             	sub    $0x4,%esp
+  803808:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  80380b:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  80380d:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  803811:	74 21                	je     803834 <pgfault+0x33>
+  803813:	89 d0                	mov    %edx,%eax
+  803815:	c1 e8 16             	shr    $0x16,%eax
+  803818:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80381f:	a8 01                	test   $0x1,%al
+  803821:	74 11                	je     803834 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803823:	89 d0                	mov    %edx,%eax
+  803825:	c1 e8 0c             	shr    $0xc,%eax
+  803828:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80382f:	f6 c4 08             	test   $0x8,%ah
+  803832:	75 17                	jne    80384b <pgfault+0x4a>
+		if (pgfault_next) {
+  803834:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  803839:	85 c0                	test   %eax,%eax
+  80383b:	74 27                	je     803864 <pgfault+0x63>
+			pgfault_next(utf);
+  80383d:	83 ec 0c             	sub    $0xc,%esp
+  803840:	53                   	push   %ebx
+  803841:	ff d0                	call   *%eax
+			return;
+  803843:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803846:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803849:	c9                   	leave
+  80384a:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  80384b:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803851:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385b:	e8 16 ff ff ff       	call   803776 <copy_page_to>
+  803860:	85 c0                	test   %eax,%eax
+  803862:	79 e2                	jns    803846 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803864:	a1 00 60 80 00       	mov    0x806000,%eax
+  803869:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  80386c:	ff 73 28             	push   0x28(%ebx)
+  80386f:	ff 33                	push   (%ebx)
+  803871:	50                   	push   %eax
+  803872:	68 80 46 80 00       	push   $0x804680
+  803877:	e8 61 cf ff ff       	call   8007dd <cprintf>
+	sys_env_destroy(0);
+  80387c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803883:	e8 c0 d8 ff ff       	call   801148 <sys_env_destroy>
+  803888:	83 c4 10             	add    $0x10,%esp
+  80388b:	eb b9                	jmp    803846 <pgfault+0x45>
+
+0080388d <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  80388d:	55                   	push   %ebp
+  80388e:	89 e5                	mov    %esp,%ebp
+  803890:	53                   	push   %ebx
+  803891:	83 ec 04             	sub    $0x4,%esp
+  803894:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803897:	a1 08 a0 80 00       	mov    0x80a008,%eax
+  80389c:	3d 01 38 80 00       	cmp    $0x803801,%eax
+  8038a1:	74 15                	je     8038b8 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8038a3:	a3 04 a0 80 00       	mov    %eax,0x80a004
+		set_pgfault_handler(pgfault);
+  8038a8:	83 ec 0c             	sub    $0xc,%esp
+  8038ab:	68 01 38 80 00       	push   $0x803801
+  8038b0:	e8 18 02 00 00       	call   803acd <set_pgfault_handler>
+  8038b5:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8038b8:	83 ec 0c             	sub    $0xc,%esp
+  8038bb:	68 05 08 00 00       	push   $0x805
+  8038c0:	53                   	push   %ebx
+  8038c1:	6a 00                	push   $0x0
+  8038c3:	53                   	push   %ebx
+  8038c4:	6a 00                	push   $0x0
+  8038c6:	e8 57 d9 ff ff       	call   801222 <sys_page_map>
+}
+  8038cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038ce:	c9                   	leave
+  8038cf:	c3                   	ret
+
+008038d0 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8038d0:	55                   	push   %ebp
+  8038d1:	89 e5                	mov    %esp,%ebp
+  8038d3:	57                   	push   %edi
+  8038d4:	56                   	push   %esi
+  8038d5:	53                   	push   %ebx
+  8038d6:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8038d9:	68 01 38 80 00       	push   $0x803801
+  8038de:	e8 ea 01 00 00       	call   803acd <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8038e3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8038e8:	cd 30                	int    $0x30
+  8038ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8038ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8038f0:	83 c4 10             	add    $0x10,%esp
+  8038f3:	85 c0                	test   %eax,%eax
+  8038f5:	0f 88 6b 01 00 00    	js     803a66 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8038fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803900:	75 37                	jne    803939 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803902:	e8 8a d8 ff ff       	call   801191 <sys_getenvid>
+  803907:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80390c:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803912:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803917:	a3 00 60 80 00       	mov    %eax,0x806000
+		return 0;
+  80391c:	e9 45 01 00 00       	jmp    803a66 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803921:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803927:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80392d:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803933:	0f 87 ba 00 00 00    	ja     8039f3 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803939:	89 d8                	mov    %ebx,%eax
+  80393b:	c1 e8 16             	shr    $0x16,%eax
+  80393e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803945:	a8 01                	test   $0x1,%al
+  803947:	74 d8                	je     803921 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803949:	89 d8                	mov    %ebx,%eax
+  80394b:	c1 e8 0c             	shr    $0xc,%eax
+  80394e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803955:	f6 c2 01             	test   $0x1,%dl
+  803958:	74 cd                	je     803927 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  80395a:	89 da                	mov    %ebx,%edx
+  80395c:	80 e6 df             	and    $0xdf,%dh
+  80395f:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803965:	74 c0                	je     803927 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803967:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803969:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803970:	f6 c6 04             	test   $0x4,%dh
+  803973:	75 53                	jne    8039c8 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803975:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80397c:	f6 c6 08             	test   $0x8,%dh
+  80397f:	75 0c                	jne    80398d <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803981:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803988:	f6 c2 02             	test   $0x2,%dl
+  80398b:	74 3b                	je     8039c8 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80398d:	83 ec 0c             	sub    $0xc,%esp
+  803990:	68 05 08 00 00       	push   $0x805
+  803995:	57                   	push   %edi
+  803996:	ff 75 e4             	push   -0x1c(%ebp)
+  803999:	57                   	push   %edi
+  80399a:	6a 00                	push   $0x0
+  80399c:	e8 81 d8 ff ff       	call   801222 <sys_page_map>
+  8039a1:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8039a3:	83 c4 20             	add    $0x20,%esp
+  8039a6:	85 c0                	test   %eax,%eax
+  8039a8:	0f 88 a7 00 00 00    	js     803a55 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8039ae:	83 ec 0c             	sub    $0xc,%esp
+  8039b1:	68 05 08 00 00       	push   $0x805
+  8039b6:	57                   	push   %edi
+  8039b7:	6a 00                	push   $0x0
+  8039b9:	57                   	push   %edi
+  8039ba:	6a 00                	push   $0x0
+  8039bc:	e8 61 d8 ff ff       	call   801222 <sys_page_map>
+  8039c1:	89 c6                	mov    %eax,%esi
+	return r;
+  8039c3:	83 c4 20             	add    $0x20,%esp
+  8039c6:	eb 21                	jmp    8039e9 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8039c8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8039cf:	83 ec 0c             	sub    $0xc,%esp
+  8039d2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8039d7:	50                   	push   %eax
+  8039d8:	57                   	push   %edi
+  8039d9:	ff 75 e4             	push   -0x1c(%ebp)
+  8039dc:	57                   	push   %edi
+  8039dd:	6a 00                	push   $0x0
+  8039df:	e8 3e d8 ff ff       	call   801222 <sys_page_map>
+  8039e4:	89 c6                	mov    %eax,%esi
+  8039e6:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8039e9:	85 f6                	test   %esi,%esi
+  8039eb:	0f 89 36 ff ff ff    	jns    803927 <fork+0x57>
+  8039f1:	eb 62                	jmp    803a55 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8039f3:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8039f8:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8039fd:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803a00:	89 f8                	mov    %edi,%eax
+  803a02:	e8 6f fd ff ff       	call   803776 <copy_page_to>
+  803a07:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803a09:	85 c0                	test   %eax,%eax
+  803a0b:	78 48                	js     803a55 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803a0d:	83 ec 04             	sub    $0x4,%esp
+  803a10:	6a 07                	push   $0x7
+  803a12:	68 00 f0 bf ee       	push   $0xeebff000
+  803a17:	57                   	push   %edi
+  803a18:	e8 ba d7 ff ff       	call   8011d7 <sys_page_alloc>
+  803a1d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803a1f:	83 c4 10             	add    $0x10,%esp
+  803a22:	85 c0                	test   %eax,%eax
+  803a24:	78 2f                	js     803a55 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803a26:	a1 00 60 80 00       	mov    0x806000,%eax
+  803a2b:	8b 40 64             	mov    0x64(%eax),%eax
+  803a2e:	83 ec 08             	sub    $0x8,%esp
+  803a31:	50                   	push   %eax
+  803a32:	57                   	push   %edi
+  803a33:	e8 0a d9 ff ff       	call   801342 <sys_env_set_pgfault_upcall>
+  803a38:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803a3a:	83 c4 10             	add    $0x10,%esp
+  803a3d:	85 c0                	test   %eax,%eax
+  803a3f:	78 14                	js     803a55 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803a41:	83 ec 08             	sub    $0x8,%esp
+  803a44:	6a 02                	push   $0x2
+  803a46:	57                   	push   %edi
+  803a47:	e8 62 d8 ff ff       	call   8012ae <sys_env_set_status>
+  803a4c:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803a4e:	83 c4 10             	add    $0x10,%esp
+  803a51:	85 c0                	test   %eax,%eax
+  803a53:	79 11                	jns    803a66 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803a55:	83 ec 0c             	sub    $0xc,%esp
+  803a58:	ff 75 e0             	push   -0x20(%ebp)
+  803a5b:	e8 e8 d6 ff ff       	call   801148 <sys_env_destroy>
+	return r;
+  803a60:	83 c4 10             	add    $0x10,%esp
+  803a63:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803a66:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803a69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a6c:	5b                   	pop    %ebx
+  803a6d:	5e                   	pop    %esi
+  803a6e:	5f                   	pop    %edi
+  803a6f:	5d                   	pop    %ebp
+  803a70:	c3                   	ret
+
+00803a71 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803a71:	55                   	push   %ebp
+  803a72:	89 e5                	mov    %esp,%ebp
+  803a74:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803a77:	68 df 46 80 00       	push   $0x8046df
+  803a7c:	68 bf 00 00 00       	push   $0xbf
+  803a81:	68 d4 46 80 00       	push   $0x8046d4
+  803a86:	e8 77 cc ff ff       	call   800702 <_panic>
+
+00803a8b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803a8b:	55                   	push   %ebp
+  803a8c:	89 e5                	mov    %esp,%ebp
+  803a8e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803a91:	89 c2                	mov    %eax,%edx
+  803a93:	c1 ea 16             	shr    $0x16,%edx
+  803a96:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803a9d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803aa2:	f6 c1 01             	test   $0x1,%cl
+  803aa5:	74 22                	je     803ac9 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803aa7:	c1 e8 0c             	shr    $0xc,%eax
+  803aaa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803ab1:	a8 01                	test   $0x1,%al
+  803ab3:	74 14                	je     803ac9 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803ab5:	c1 e8 0c             	shr    $0xc,%eax
+  803ab8:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803abb:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803ac2:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803ac6:	0f b7 d2             	movzwl %dx,%edx
+}
+  803ac9:	89 d0                	mov    %edx,%eax
+  803acb:	5d                   	pop    %ebp
+  803acc:	c3                   	ret
+
+00803acd <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803acd:	55                   	push   %ebp
+  803ace:	89 e5                	mov    %esp,%ebp
+  803ad0:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803ad3:	83 3d 08 a0 80 00 00 	cmpl   $0x0,0x80a008
+  803ada:	74 0a                	je     803ae6 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803adc:	8b 45 08             	mov    0x8(%ebp),%eax
+  803adf:	a3 08 a0 80 00       	mov    %eax,0x80a008
+}
+  803ae4:	c9                   	leave
+  803ae5:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803ae6:	83 ec 04             	sub    $0x4,%esp
+  803ae9:	6a 07                	push   $0x7
+  803aeb:	68 00 f0 bf ee       	push   $0xeebff000
+  803af0:	6a 00                	push   $0x0
+  803af2:	e8 e0 d6 ff ff       	call   8011d7 <sys_page_alloc>
+  803af7:	83 c4 10             	add    $0x10,%esp
+  803afa:	85 c0                	test   %eax,%eax
+  803afc:	75 2c                	jne    803b2a <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803afe:	83 ec 08             	sub    $0x8,%esp
+  803b01:	68 40 3b 80 00       	push   $0x803b40
+  803b06:	6a 00                	push   $0x0
+  803b08:	e8 35 d8 ff ff       	call   801342 <sys_env_set_pgfault_upcall>
+  803b0d:	83 c4 10             	add    $0x10,%esp
+  803b10:	85 c0                	test   %eax,%eax
+  803b12:	74 c8                	je     803adc <set_pgfault_handler+0xf>
+  803b14:	68 40 47 80 00       	push   $0x804740
+  803b19:	68 e7 44 80 00       	push   $0x8044e7
+  803b1e:	6a 20                	push   $0x20
+  803b20:	68 70 47 80 00       	push   $0x804770
+  803b25:	e8 d8 cb ff ff       	call   800702 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803b2a:	68 f8 46 80 00       	push   $0x8046f8
+  803b2f:	68 e7 44 80 00       	push   $0x8044e7
+  803b34:	6a 1e                	push   $0x1e
+  803b36:	68 70 47 80 00       	push   $0x804770
+  803b3b:	e8 c2 cb ff ff       	call   800702 <_panic>
+
+00803b40 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803b40:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803b41:	a1 08 a0 80 00       	mov    0x80a008,%eax
+	call *%eax
+  803b46:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803b48:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803b4b:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803b50:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803b55:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803b59:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803b5c:	83 c4 08             	add    $0x8,%esp
+	popal
+  803b5f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803b60:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803b63:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803b64:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803b65:	c3                   	ret
+
+00803b66 <dm>:
+  803b66:	55                   	push   %ebp
+  803b67:	57                   	push   %edi
+  803b68:	56                   	push   %esi
+  803b69:	53                   	push   %ebx
+  803b6a:	83 ec 24             	sub    $0x24,%esp
+  803b6d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803b71:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803b75:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803b79:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803b7d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803b81:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803b85:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803b89:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b93:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b98:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803b9f:	00 
+  803ba0:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803ba7:	00 
+  803ba8:	89 fb                	mov    %edi,%ebx
+  803baa:	eb 08                	jmp    803bb4 <dm+0x4e>
+  803bac:	83 e9 01             	sub    $0x1,%ecx
+  803baf:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803bb2:	74 68                	je     803c1c <dm+0xb6>
+  803bb4:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803bb8:	01 c0                	add    %eax,%eax
+  803bba:	89 c6                	mov    %eax,%esi
+  803bbc:	89 d7                	mov    %edx,%edi
+  803bbe:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803bc2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803bc6:	0f ad d0             	shrd   %cl,%edx,%eax
+  803bc9:	d3 ea                	shr    %cl,%edx
+  803bcb:	f6 c1 20             	test   $0x20,%cl
+  803bce:	74 04                	je     803bd4 <dm+0x6e>
+  803bd0:	89 d0                	mov    %edx,%eax
+  803bd2:	31 d2                	xor    %edx,%edx
+  803bd4:	83 e0 01             	and    $0x1,%eax
+  803bd7:	89 04 24             	mov    %eax,(%esp)
+  803bda:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803be1:	00 
+  803be2:	8b 04 24             	mov    (%esp),%eax
+  803be5:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803be9:	09 f0                	or     %esi,%eax
+  803beb:	09 fa                	or     %edi,%edx
+  803bed:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803bf1:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803bf5:	39 f0                	cmp    %esi,%eax
+  803bf7:	89 d5                	mov    %edx,%ebp
+  803bf9:	19 fd                	sbb    %edi,%ebp
+  803bfb:	72 af                	jb     803bac <dm+0x46>
+  803bfd:	29 f0                	sub    %esi,%eax
+  803bff:	19 fa                	sbb    %edi,%edx
+  803c01:	89 cf                	mov    %ecx,%edi
+  803c03:	c1 ef 05             	shr    $0x5,%edi
+  803c06:	83 e7 01             	and    $0x1,%edi
+  803c09:	89 fe                	mov    %edi,%esi
+  803c0b:	83 f6 01             	xor    $0x1,%esi
+  803c0e:	d3 e6                	shl    %cl,%esi
+  803c10:	d3 e7                	shl    %cl,%edi
+  803c12:	09 74 24 18          	or     %esi,0x18(%esp)
+  803c16:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803c1a:	eb 90                	jmp    803bac <dm+0x46>
+  803c1c:	85 db                	test   %ebx,%ebx
+  803c1e:	74 05                	je     803c25 <dm+0xbf>
+  803c20:	89 03                	mov    %eax,(%ebx)
+  803c22:	89 53 04             	mov    %edx,0x4(%ebx)
+  803c25:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803c29:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803c2d:	83 c4 24             	add    $0x24,%esp
+  803c30:	5b                   	pop    %ebx
+  803c31:	5e                   	pop    %esi
+  803c32:	5f                   	pop    %edi
+  803c33:	5d                   	pop    %ebp
+  803c34:	c3                   	ret
+
+00803c35 <__udivdi3>:
+  803c35:	83 ec 08             	sub    $0x8,%esp
+  803c38:	6a 00                	push   $0x0
+  803c3a:	ff 74 24 1c          	push   0x1c(%esp)
+  803c3e:	ff 74 24 1c          	push   0x1c(%esp)
+  803c42:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803c46:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803c4a:	e8 17 ff ff ff       	call   803b66 <dm>
+  803c4f:	83 c4 14             	add    $0x14,%esp
+  803c52:	c3                   	ret
+
+00803c53 <__umoddi3>:
+  803c53:	83 ec 18             	sub    $0x18,%esp
+  803c56:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803c5a:	50                   	push   %eax
+  803c5b:	ff 74 24 2c          	push   0x2c(%esp)
+  803c5f:	ff 74 24 2c          	push   0x2c(%esp)
+  803c63:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803c67:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803c6b:	e8 f6 fe ff ff       	call   803b66 <dm>
+  803c70:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803c74:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803c78:	83 c4 24             	add    $0x24,%esp
+  803c7b:	c3                   	ret
+
+00803c7c <__divdi3>:
+  803c7c:	53                   	push   %ebx
+  803c7d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803c81:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803c85:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803c89:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803c8d:	85 d2                	test   %edx,%edx
+  803c8f:	78 15                	js     803ca6 <__divdi3+0x2a>
+  803c91:	85 db                	test   %ebx,%ebx
+  803c93:	78 34                	js     803cc9 <__divdi3+0x4d>
+  803c95:	83 ec 04             	sub    $0x4,%esp
+  803c98:	6a 00                	push   $0x0
+  803c9a:	53                   	push   %ebx
+  803c9b:	51                   	push   %ecx
+  803c9c:	e8 c5 fe ff ff       	call   803b66 <dm>
+  803ca1:	83 c4 10             	add    $0x10,%esp
+  803ca4:	eb 21                	jmp    803cc7 <__divdi3+0x4b>
+  803ca6:	f7 d8                	neg    %eax
+  803ca8:	83 d2 00             	adc    $0x0,%edx
+  803cab:	f7 da                	neg    %edx
+  803cad:	85 db                	test   %ebx,%ebx
+  803caf:	78 30                	js     803ce1 <__divdi3+0x65>
+  803cb1:	83 ec 04             	sub    $0x4,%esp
+  803cb4:	6a 00                	push   $0x0
+  803cb6:	53                   	push   %ebx
+  803cb7:	51                   	push   %ecx
+  803cb8:	e8 a9 fe ff ff       	call   803b66 <dm>
+  803cbd:	83 c4 10             	add    $0x10,%esp
+  803cc0:	f7 d8                	neg    %eax
+  803cc2:	83 d2 00             	adc    $0x0,%edx
+  803cc5:	f7 da                	neg    %edx
+  803cc7:	5b                   	pop    %ebx
+  803cc8:	c3                   	ret
+  803cc9:	83 ec 04             	sub    $0x4,%esp
+  803ccc:	6a 00                	push   $0x0
+  803cce:	f7 d9                	neg    %ecx
+  803cd0:	83 d3 00             	adc    $0x0,%ebx
+  803cd3:	f7 db                	neg    %ebx
+  803cd5:	53                   	push   %ebx
+  803cd6:	51                   	push   %ecx
+  803cd7:	e8 8a fe ff ff       	call   803b66 <dm>
+  803cdc:	83 c4 10             	add    $0x10,%esp
+  803cdf:	eb df                	jmp    803cc0 <__divdi3+0x44>
+  803ce1:	83 ec 04             	sub    $0x4,%esp
+  803ce4:	6a 00                	push   $0x0
+  803ce6:	f7 d9                	neg    %ecx
+  803ce8:	83 d3 00             	adc    $0x0,%ebx
+  803ceb:	f7 db                	neg    %ebx
+  803ced:	53                   	push   %ebx
+  803cee:	51                   	push   %ecx
+  803cef:	e8 72 fe ff ff       	call   803b66 <dm>
+  803cf4:	83 c4 10             	add    $0x10,%esp
+  803cf7:	eb ce                	jmp    803cc7 <__divdi3+0x4b>
+
+00803cf9 <__moddi3>:
+  803cf9:	55                   	push   %ebp
+  803cfa:	57                   	push   %edi
+  803cfb:	56                   	push   %esi
+  803cfc:	53                   	push   %ebx
+  803cfd:	83 ec 24             	sub    $0x24,%esp
+  803d00:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803d04:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803d08:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803d0c:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803d10:	85 d2                	test   %edx,%edx
+  803d12:	78 3b                	js     803d4f <__moddi3+0x56>
+  803d14:	83 ec 04             	sub    $0x4,%esp
+  803d17:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803d1b:	56                   	push   %esi
+  803d1c:	89 ce                	mov    %ecx,%esi
+  803d1e:	f7 de                	neg    %esi
+  803d20:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803d24:	89 de                	mov    %ebx,%esi
+  803d26:	83 d6 00             	adc    $0x0,%esi
+  803d29:	f7 de                	neg    %esi
+  803d2b:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803d2f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803d33:	0f 48 f1             	cmovs  %ecx,%esi
+  803d36:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803d3b:	53                   	push   %ebx
+  803d3c:	56                   	push   %esi
+  803d3d:	e8 24 fe ff ff       	call   803b66 <dm>
+  803d42:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803d46:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803d4a:	83 c4 10             	add    $0x10,%esp
+  803d4d:	eb 47                	jmp    803d96 <__moddi3+0x9d>
+  803d4f:	f7 d8                	neg    %eax
+  803d51:	83 d2 00             	adc    $0x0,%edx
+  803d54:	f7 da                	neg    %edx
+  803d56:	83 ec 04             	sub    $0x4,%esp
+  803d59:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803d5d:	56                   	push   %esi
+  803d5e:	89 cf                	mov    %ecx,%edi
+  803d60:	f7 df                	neg    %edi
+  803d62:	89 de                	mov    %ebx,%esi
+  803d64:	83 d6 00             	adc    $0x0,%esi
+  803d67:	f7 de                	neg    %esi
+  803d69:	0f 49 cf             	cmovns %edi,%ecx
+  803d6c:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803d70:	0f 49 de             	cmovns %esi,%ebx
+  803d73:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803d77:	ff 74 24 0c          	push   0xc(%esp)
+  803d7b:	ff 74 24 0c          	push   0xc(%esp)
+  803d7f:	e8 e2 fd ff ff       	call   803b66 <dm>
+  803d84:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803d88:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803d8c:	f7 d8                	neg    %eax
+  803d8e:	83 d2 00             	adc    $0x0,%edx
+  803d91:	f7 da                	neg    %edx
+  803d93:	83 c4 10             	add    $0x10,%esp
+  803d96:	83 c4 24             	add    $0x24,%esp
+  803d99:	5b                   	pop    %ebx
+  803d9a:	5e                   	pop    %esi
+  803d9b:	5f                   	pop    %edi
+  803d9c:	5d                   	pop    %ebp
+  803d9d:	c3                   	ret
@@ -0,0 +1,8010 @@
+
+obj/user/testkbd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2a 02 00 00       	call   80025b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	int i, r;
+
+	// Spin for a bit to let the console quiet
+	for (i = 0; i < 10; ++i)
+  80003a:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  80003f:	eb 05                	jmp    800046 <umain+0x13>
+		sys_yield();
+  800041:	e8 1e 0e 00 00       	call   800e64 <sys_yield>
+	for (i = 0; i < 10; ++i)
+  800046:	83 eb 01             	sub    $0x1,%ebx
+  800049:	75 f6                	jne    800041 <umain+0xe>
+
+	close(0);
+  80004b:	83 ec 0c             	sub    $0xc,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	e8 d6 13 00 00       	call   80142b <close>
+	if ((r = opencons()) < 0)
+  800055:	e8 af 01 00 00       	call   800209 <opencons>
+  80005a:	83 c4 10             	add    $0x10,%esp
+  80005d:	85 c0                	test   %eax,%eax
+  80005f:	78 14                	js     800075 <umain+0x42>
+		panic("opencons: %e", r);
+	if (r != 0)
+  800061:	74 24                	je     800087 <umain+0x54>
+		panic("first opencons used fd %d", r);
+  800063:	50                   	push   %eax
+  800064:	68 1c 3a 80 00       	push   $0x803a1c
+  800069:	6a 11                	push   $0x11
+  80006b:	68 0d 3a 80 00       	push   $0x803a0d
+  800070:	e8 49 02 00 00       	call   8002be <_panic>
+		panic("opencons: %e", r);
+  800075:	50                   	push   %eax
+  800076:	68 00 3a 80 00       	push   $0x803a00
+  80007b:	6a 0f                	push   $0xf
+  80007d:	68 0d 3a 80 00       	push   $0x803a0d
+  800082:	e8 37 02 00 00       	call   8002be <_panic>
+	if ((r = dup(0, 1)) < 0)
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	6a 01                	push   $0x1
+  80008c:	6a 00                	push   $0x0
+  80008e:	e8 ea 13 00 00       	call   80147d <dup>
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	85 c0                	test   %eax,%eax
+  800098:	79 25                	jns    8000bf <umain+0x8c>
+		panic("dup: %e", r);
+  80009a:	50                   	push   %eax
+  80009b:	68 36 3a 80 00       	push   $0x803a36
+  8000a0:	6a 13                	push   $0x13
+  8000a2:	68 0d 3a 80 00       	push   $0x803a0d
+  8000a7:	e8 12 02 00 00       	call   8002be <_panic>
+	for(;;){
+		char *buf;
+
+		buf = readline("Type a line: ");
+		if (buf != NULL)
+			fprintf(1, "%s\n", buf);
+  8000ac:	83 ec 04             	sub    $0x4,%esp
+  8000af:	50                   	push   %eax
+  8000b0:	68 4c 3a 80 00       	push   $0x803a4c
+  8000b5:	6a 01                	push   $0x1
+  8000b7:	e8 44 29 00 00       	call   802a00 <fprintf>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+		buf = readline("Type a line: ");
+  8000bf:	83 ec 0c             	sub    $0xc,%esp
+  8000c2:	68 3e 3a 80 00       	push   $0x803a3e
+  8000c7:	e8 80 08 00 00       	call   80094c <readline>
+		if (buf != NULL)
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	85 c0                	test   %eax,%eax
+  8000d1:	75 d9                	jne    8000ac <umain+0x79>
+		else
+			fprintf(1, "(end of file received)\n");
+  8000d3:	83 ec 08             	sub    $0x8,%esp
+  8000d6:	68 50 3a 80 00       	push   $0x803a50
+  8000db:	6a 01                	push   $0x1
+  8000dd:	e8 1e 29 00 00       	call   802a00 <fprintf>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	eb d8                	jmp    8000bf <umain+0x8c>
+
+008000e7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8000e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ec:	c3                   	ret
+
+008000ed <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8000f3:	68 68 3a 80 00       	push   $0x803a68
+  8000f8:	ff 75 0c             	push   0xc(%ebp)
+  8000fb:	e8 77 09 00 00       	call   800a77 <strcpy>
+	return 0;
+}
+  800100:	b8 00 00 00 00       	mov    $0x0,%eax
+  800105:	c9                   	leave
+  800106:	c3                   	ret
+
+00800107 <devcons_write>:
+{
+  800107:	55                   	push   %ebp
+  800108:	89 e5                	mov    %esp,%ebp
+  80010a:	57                   	push   %edi
+  80010b:	56                   	push   %esi
+  80010c:	53                   	push   %ebx
+  80010d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  800113:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  800118:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80011e:	eb 2e                	jmp    80014e <devcons_write+0x47>
+		m = n - tot;
+  800120:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800123:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  800125:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80012a:	39 c3                	cmp    %eax,%ebx
+  80012c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80012f:	83 ec 04             	sub    $0x4,%esp
+  800132:	53                   	push   %ebx
+  800133:	89 f0                	mov    %esi,%eax
+  800135:	03 45 0c             	add    0xc(%ebp),%eax
+  800138:	50                   	push   %eax
+  800139:	57                   	push   %edi
+  80013a:	e8 be 0a 00 00       	call   800bfd <memmove>
+		sys_cputs(buf, m);
+  80013f:	83 c4 08             	add    $0x8,%esp
+  800142:	53                   	push   %ebx
+  800143:	57                   	push   %edi
+  800144:	e8 5e 0c 00 00       	call   800da7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800149:	01 de                	add    %ebx,%esi
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800151:	72 cd                	jb     800120 <devcons_write+0x19>
+}
+  800153:	89 f0                	mov    %esi,%eax
+  800155:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800158:	5b                   	pop    %ebx
+  800159:	5e                   	pop    %esi
+  80015a:	5f                   	pop    %edi
+  80015b:	5d                   	pop    %ebp
+  80015c:	c3                   	ret
+
+0080015d <devcons_read>:
+{
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+  800168:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80016c:	75 07                	jne    800175 <devcons_read+0x18>
+  80016e:	eb 1f                	jmp    80018f <devcons_read+0x32>
+		sys_yield();
+  800170:	e8 ef 0c 00 00       	call   800e64 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  800175:	e8 53 0c 00 00       	call   800dcd <sys_cgetc>
+  80017a:	85 c0                	test   %eax,%eax
+  80017c:	74 f2                	je     800170 <devcons_read+0x13>
+	if (c < 0)
+  80017e:	78 0f                	js     80018f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  800180:	83 f8 04             	cmp    $0x4,%eax
+  800183:	74 0c                	je     800191 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  800185:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800188:	88 02                	mov    %al,(%edx)
+	return 1;
+  80018a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80018f:	c9                   	leave
+  800190:	c3                   	ret
+		return 0;
+  800191:	b8 00 00 00 00       	mov    $0x0,%eax
+  800196:	eb f7                	jmp    80018f <devcons_read+0x32>
+
+00800198 <cputchar>:
+{
+  800198:	55                   	push   %ebp
+  800199:	89 e5                	mov    %esp,%ebp
+  80019b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80019e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001a1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8001a4:	6a 01                	push   $0x1
+  8001a6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 f8 0b 00 00       	call   800da7 <sys_cputs>
+}
+  8001af:	83 c4 10             	add    $0x10,%esp
+  8001b2:	c9                   	leave
+  8001b3:	c3                   	ret
+
+008001b4 <getchar>:
+{
+  8001b4:	55                   	push   %ebp
+  8001b5:	89 e5                	mov    %esp,%ebp
+  8001b7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8001ba:	6a 01                	push   $0x1
+  8001bc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001bf:	50                   	push   %eax
+  8001c0:	6a 00                	push   $0x0
+  8001c2:	e8 a0 13 00 00       	call   801567 <read>
+	if (r < 0)
+  8001c7:	83 c4 10             	add    $0x10,%esp
+  8001ca:	85 c0                	test   %eax,%eax
+  8001cc:	78 06                	js     8001d4 <getchar+0x20>
+	if (r < 1)
+  8001ce:	74 06                	je     8001d6 <getchar+0x22>
+	return c;
+  8001d0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8001d4:	c9                   	leave
+  8001d5:	c3                   	ret
+		return -E_EOF;
+  8001d6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8001db:	eb f7                	jmp    8001d4 <getchar+0x20>
+
+008001dd <iscons>:
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8001e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8001e6:	50                   	push   %eax
+  8001e7:	ff 75 08             	push   0x8(%ebp)
+  8001ea:	e8 12 11 00 00       	call   801301 <fd_lookup>
+  8001ef:	83 c4 10             	add    $0x10,%esp
+  8001f2:	85 c0                	test   %eax,%eax
+  8001f4:	78 11                	js     800207 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8001f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001f9:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8001ff:	39 10                	cmp    %edx,(%eax)
+  800201:	0f 94 c0             	sete   %al
+  800204:	0f b6 c0             	movzbl %al,%eax
+}
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+00800209 <opencons>:
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80020f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800212:	50                   	push   %eax
+  800213:	e8 93 10 00 00       	call   8012ab <fd_alloc>
+  800218:	83 c4 10             	add    $0x10,%esp
+  80021b:	85 c0                	test   %eax,%eax
+  80021d:	78 3a                	js     800259 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80021f:	83 ec 04             	sub    $0x4,%esp
+  800222:	68 07 04 00 00       	push   $0x407
+  800227:	ff 75 f4             	push   -0xc(%ebp)
+  80022a:	6a 00                	push   $0x0
+  80022c:	e8 52 0c 00 00       	call   800e83 <sys_page_alloc>
+  800231:	83 c4 10             	add    $0x10,%esp
+  800234:	85 c0                	test   %eax,%eax
+  800236:	78 21                	js     800259 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800238:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80023b:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  800241:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800243:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800246:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80024d:	83 ec 0c             	sub    $0xc,%esp
+  800250:	50                   	push   %eax
+  800251:	e8 2e 10 00 00       	call   801284 <fd2num>
+  800256:	83 c4 10             	add    $0x10,%esp
+}
+  800259:	c9                   	leave
+  80025a:	c3                   	ret
+
+0080025b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80025b:	55                   	push   %ebp
+  80025c:	89 e5                	mov    %esp,%ebp
+  80025e:	56                   	push   %esi
+  80025f:	53                   	push   %ebx
+  800260:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800263:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800266:	e8 d2 0b 00 00       	call   800e3d <sys_getenvid>
+  80026b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800270:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800276:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80027b:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800280:	85 db                	test   %ebx,%ebx
+  800282:	7e 07                	jle    80028b <libmain+0x30>
+		binaryname = argv[0];
+  800284:	8b 06                	mov    (%esi),%eax
+  800286:	a3 20 50 80 00       	mov    %eax,0x805020
+
+	// call user main routine
+	umain(argc, argv);
+  80028b:	83 ec 08             	sub    $0x8,%esp
+  80028e:	56                   	push   %esi
+  80028f:	53                   	push   %ebx
+  800290:	e8 9e fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800295:	e8 0a 00 00 00       	call   8002a4 <exit>
+}
+  80029a:	83 c4 10             	add    $0x10,%esp
+  80029d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002a0:	5b                   	pop    %ebx
+  8002a1:	5e                   	pop    %esi
+  8002a2:	5d                   	pop    %ebp
+  8002a3:	c3                   	ret
+
+008002a4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  8002a7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8002aa:	e8 a9 11 00 00       	call   801458 <close_all>
+	sys_env_destroy(0);
+  8002af:	83 ec 0c             	sub    $0xc,%esp
+  8002b2:	6a 00                	push   $0x0
+  8002b4:	e8 3b 0b 00 00       	call   800df4 <sys_env_destroy>
+}
+  8002b9:	83 c4 10             	add    $0x10,%esp
+  8002bc:	c9                   	leave
+  8002bd:	c3                   	ret
+
+008002be <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002be:	55                   	push   %ebp
+  8002bf:	89 e5                	mov    %esp,%ebp
+  8002c1:	56                   	push   %esi
+  8002c2:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002c3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002c6:	8b 35 20 50 80 00    	mov    0x805020,%esi
+  8002cc:	e8 6c 0b 00 00       	call   800e3d <sys_getenvid>
+  8002d1:	83 ec 0c             	sub    $0xc,%esp
+  8002d4:	ff 75 0c             	push   0xc(%ebp)
+  8002d7:	ff 75 08             	push   0x8(%ebp)
+  8002da:	56                   	push   %esi
+  8002db:	50                   	push   %eax
+  8002dc:	68 80 3a 80 00       	push   $0x803a80
+  8002e1:	e8 b3 00 00 00       	call   800399 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002e6:	83 c4 18             	add    $0x18,%esp
+  8002e9:	53                   	push   %ebx
+  8002ea:	ff 75 10             	push   0x10(%ebp)
+  8002ed:	e8 56 00 00 00       	call   800348 <vcprintf>
+	cprintf("\n");
+  8002f2:	c7 04 24 66 3a 80 00 	movl   $0x803a66,(%esp)
+  8002f9:	e8 9b 00 00 00       	call   800399 <cprintf>
+  8002fe:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800301:	cc                   	int3
+	while (1)
+  800302:	eb fd                	jmp    800301 <_panic+0x43>
+
+00800304 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800304:	55                   	push   %ebp
+  800305:	89 e5                	mov    %esp,%ebp
+  800307:	53                   	push   %ebx
+  800308:	83 ec 04             	sub    $0x4,%esp
+  80030b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80030e:	8b 13                	mov    (%ebx),%edx
+  800310:	8d 42 01             	lea    0x1(%edx),%eax
+  800313:	89 03                	mov    %eax,(%ebx)
+  800315:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800318:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80031c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800321:	74 09                	je     80032c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800323:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800327:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80032a:	c9                   	leave
+  80032b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80032c:	83 ec 08             	sub    $0x8,%esp
+  80032f:	68 ff 00 00 00       	push   $0xff
+  800334:	8d 43 08             	lea    0x8(%ebx),%eax
+  800337:	50                   	push   %eax
+  800338:	e8 6a 0a 00 00       	call   800da7 <sys_cputs>
+		b->idx = 0;
+  80033d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800343:	83 c4 10             	add    $0x10,%esp
+  800346:	eb db                	jmp    800323 <putch+0x1f>
+
+00800348 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800348:	55                   	push   %ebp
+  800349:	89 e5                	mov    %esp,%ebp
+  80034b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800351:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800358:	00 00 00 
+	b.cnt = 0;
+  80035b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800362:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800365:	ff 75 0c             	push   0xc(%ebp)
+  800368:	ff 75 08             	push   0x8(%ebp)
+  80036b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800371:	50                   	push   %eax
+  800372:	68 04 03 80 00       	push   $0x800304
+  800377:	e8 14 01 00 00       	call   800490 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80037c:	83 c4 08             	add    $0x8,%esp
+  80037f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800385:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80038b:	50                   	push   %eax
+  80038c:	e8 16 0a 00 00       	call   800da7 <sys_cputs>
+
+	return b.cnt;
+}
+  800391:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800397:	c9                   	leave
+  800398:	c3                   	ret
+
+00800399 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800399:	55                   	push   %ebp
+  80039a:	89 e5                	mov    %esp,%ebp
+  80039c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80039f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8003a2:	50                   	push   %eax
+  8003a3:	ff 75 08             	push   0x8(%ebp)
+  8003a6:	e8 9d ff ff ff       	call   800348 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003ab:	c9                   	leave
+  8003ac:	c3                   	ret
+
+008003ad <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003ad:	55                   	push   %ebp
+  8003ae:	89 e5                	mov    %esp,%ebp
+  8003b0:	57                   	push   %edi
+  8003b1:	56                   	push   %esi
+  8003b2:	53                   	push   %ebx
+  8003b3:	83 ec 1c             	sub    $0x1c,%esp
+  8003b6:	89 c7                	mov    %eax,%edi
+  8003b8:	89 d6                	mov    %edx,%esi
+  8003ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003c0:	89 d1                	mov    %edx,%ecx
+  8003c2:	89 c2                	mov    %eax,%edx
+  8003c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003c7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003ca:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003cd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003d3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003da:	39 c2                	cmp    %eax,%edx
+  8003dc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003df:	72 3e                	jb     80041f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003e1:	83 ec 0c             	sub    $0xc,%esp
+  8003e4:	ff 75 18             	push   0x18(%ebp)
+  8003e7:	83 eb 01             	sub    $0x1,%ebx
+  8003ea:	53                   	push   %ebx
+  8003eb:	50                   	push   %eax
+  8003ec:	83 ec 08             	sub    $0x8,%esp
+  8003ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8003f2:	ff 75 e0             	push   -0x20(%ebp)
+  8003f5:	ff 75 dc             	push   -0x24(%ebp)
+  8003f8:	ff 75 d8             	push   -0x28(%ebp)
+  8003fb:	e8 81 34 00 00       	call   803881 <__udivdi3>
+  800400:	83 c4 18             	add    $0x18,%esp
+  800403:	52                   	push   %edx
+  800404:	50                   	push   %eax
+  800405:	89 f2                	mov    %esi,%edx
+  800407:	89 f8                	mov    %edi,%eax
+  800409:	e8 9f ff ff ff       	call   8003ad <printnum>
+  80040e:	83 c4 20             	add    $0x20,%esp
+  800411:	eb 13                	jmp    800426 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800413:	83 ec 08             	sub    $0x8,%esp
+  800416:	56                   	push   %esi
+  800417:	ff 75 18             	push   0x18(%ebp)
+  80041a:	ff d7                	call   *%edi
+  80041c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80041f:	83 eb 01             	sub    $0x1,%ebx
+  800422:	85 db                	test   %ebx,%ebx
+  800424:	7f ed                	jg     800413 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800426:	83 ec 08             	sub    $0x8,%esp
+  800429:	56                   	push   %esi
+  80042a:	83 ec 04             	sub    $0x4,%esp
+  80042d:	ff 75 e4             	push   -0x1c(%ebp)
+  800430:	ff 75 e0             	push   -0x20(%ebp)
+  800433:	ff 75 dc             	push   -0x24(%ebp)
+  800436:	ff 75 d8             	push   -0x28(%ebp)
+  800439:	e8 61 34 00 00       	call   80389f <__umoddi3>
+  80043e:	83 c4 14             	add    $0x14,%esp
+  800441:	0f be 80 a3 3a 80 00 	movsbl 0x803aa3(%eax),%eax
+  800448:	50                   	push   %eax
+  800449:	ff d7                	call   *%edi
+}
+  80044b:	83 c4 10             	add    $0x10,%esp
+  80044e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800451:	5b                   	pop    %ebx
+  800452:	5e                   	pop    %esi
+  800453:	5f                   	pop    %edi
+  800454:	5d                   	pop    %ebp
+  800455:	c3                   	ret
+
+00800456 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800456:	55                   	push   %ebp
+  800457:	89 e5                	mov    %esp,%ebp
+  800459:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80045c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800460:	8b 10                	mov    (%eax),%edx
+  800462:	3b 50 04             	cmp    0x4(%eax),%edx
+  800465:	73 0a                	jae    800471 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800467:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80046a:	89 08                	mov    %ecx,(%eax)
+  80046c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80046f:	88 02                	mov    %al,(%edx)
+}
+  800471:	5d                   	pop    %ebp
+  800472:	c3                   	ret
+
+00800473 <printfmt>:
+{
+  800473:	55                   	push   %ebp
+  800474:	89 e5                	mov    %esp,%ebp
+  800476:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800479:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80047c:	50                   	push   %eax
+  80047d:	ff 75 10             	push   0x10(%ebp)
+  800480:	ff 75 0c             	push   0xc(%ebp)
+  800483:	ff 75 08             	push   0x8(%ebp)
+  800486:	e8 05 00 00 00       	call   800490 <vprintfmt>
+}
+  80048b:	83 c4 10             	add    $0x10,%esp
+  80048e:	c9                   	leave
+  80048f:	c3                   	ret
+
+00800490 <vprintfmt>:
+{
+  800490:	55                   	push   %ebp
+  800491:	89 e5                	mov    %esp,%ebp
+  800493:	57                   	push   %edi
+  800494:	56                   	push   %esi
+  800495:	53                   	push   %ebx
+  800496:	83 ec 2c             	sub    $0x2c,%esp
+  800499:	8b 75 08             	mov    0x8(%ebp),%esi
+  80049c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80049f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8004a2:	eb 0a                	jmp    8004ae <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8004a4:	83 ec 08             	sub    $0x8,%esp
+  8004a7:	53                   	push   %ebx
+  8004a8:	50                   	push   %eax
+  8004a9:	ff d6                	call   *%esi
+  8004ab:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004ae:	83 c7 01             	add    $0x1,%edi
+  8004b1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8004b5:	83 f8 25             	cmp    $0x25,%eax
+  8004b8:	74 0c                	je     8004c6 <vprintfmt+0x36>
+			if (ch == '\0')
+  8004ba:	85 c0                	test   %eax,%eax
+  8004bc:	75 e6                	jne    8004a4 <vprintfmt+0x14>
+}
+  8004be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c1:	5b                   	pop    %ebx
+  8004c2:	5e                   	pop    %esi
+  8004c3:	5f                   	pop    %edi
+  8004c4:	5d                   	pop    %ebp
+  8004c5:	c3                   	ret
+		padc = ' ';
+  8004c6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004ca:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004d1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004d8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004df:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e4:	8d 47 01             	lea    0x1(%edi),%eax
+  8004e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004ea:	0f b6 17             	movzbl (%edi),%edx
+  8004ed:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004f0:	3c 55                	cmp    $0x55,%al
+  8004f2:	0f 87 cf 03 00 00    	ja     8008c7 <vprintfmt+0x437>
+  8004f8:	0f b6 c0             	movzbl %al,%eax
+  8004fb:	ff 24 85 00 3c 80 00 	jmp    *0x803c00(,%eax,4)
+  800502:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800505:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800509:	eb d9                	jmp    8004e4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80050b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80050e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800512:	eb d0                	jmp    8004e4 <vprintfmt+0x54>
+  800514:	0f b6 d2             	movzbl %dl,%edx
+  800517:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80051a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800522:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800525:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800529:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80052c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80052f:	83 f9 09             	cmp    $0x9,%ecx
+  800532:	77 55                	ja     800589 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800534:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800537:	eb e9                	jmp    800522 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800539:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053c:	8b 00                	mov    (%eax),%eax
+  80053e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800541:	8b 45 14             	mov    0x14(%ebp),%eax
+  800544:	8d 40 04             	lea    0x4(%eax),%eax
+  800547:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80054a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80054d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800551:	79 91                	jns    8004e4 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800553:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800556:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800559:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800560:	eb 82                	jmp    8004e4 <vprintfmt+0x54>
+			if (width < 0)
+  800562:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800565:	85 d2                	test   %edx,%edx
+  800567:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056c:	0f 49 c2             	cmovns %edx,%eax
+  80056f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800572:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800575:	e9 6a ff ff ff       	jmp    8004e4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80057a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80057d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800584:	e9 5b ff ff ff       	jmp    8004e4 <vprintfmt+0x54>
+  800589:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80058c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80058f:	eb bc                	jmp    80054d <vprintfmt+0xbd>
+			lflag++;
+  800591:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800594:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800597:	e9 48 ff ff ff       	jmp    8004e4 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80059c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059f:	8d 78 04             	lea    0x4(%eax),%edi
+  8005a2:	83 ec 08             	sub    $0x8,%esp
+  8005a5:	53                   	push   %ebx
+  8005a6:	ff 30                	push   (%eax)
+  8005a8:	ff d6                	call   *%esi
+			break;
+  8005aa:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8005ad:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8005b0:	e9 b1 02 00 00       	jmp    800866 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8005bb:	8b 10                	mov    (%eax),%edx
+  8005bd:	89 d0                	mov    %edx,%eax
+  8005bf:	f7 d8                	neg    %eax
+  8005c1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005c4:	83 f8 11             	cmp    $0x11,%eax
+  8005c7:	7f 23                	jg     8005ec <vprintfmt+0x15c>
+  8005c9:	8b 14 85 60 3d 80 00 	mov    0x803d60(,%eax,4),%edx
+  8005d0:	85 d2                	test   %edx,%edx
+  8005d2:	74 18                	je     8005ec <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8005d4:	52                   	push   %edx
+  8005d5:	68 c2 3e 80 00       	push   $0x803ec2
+  8005da:	53                   	push   %ebx
+  8005db:	56                   	push   %esi
+  8005dc:	e8 92 fe ff ff       	call   800473 <printfmt>
+  8005e1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005e4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005e7:	e9 7a 02 00 00       	jmp    800866 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8005ec:	50                   	push   %eax
+  8005ed:	68 bb 3a 80 00       	push   $0x803abb
+  8005f2:	53                   	push   %ebx
+  8005f3:	56                   	push   %esi
+  8005f4:	e8 7a fe ff ff       	call   800473 <printfmt>
+  8005f9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005fc:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005ff:	e9 62 02 00 00       	jmp    800866 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800604:	8b 45 14             	mov    0x14(%ebp),%eax
+  800607:	83 c0 04             	add    $0x4,%eax
+  80060a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80060d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800610:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800612:	85 c9                	test   %ecx,%ecx
+  800614:	b8 b4 3a 80 00       	mov    $0x803ab4,%eax
+  800619:	0f 45 c1             	cmovne %ecx,%eax
+  80061c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80061f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800623:	7e 06                	jle    80062b <vprintfmt+0x19b>
+  800625:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800629:	75 0b                	jne    800636 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80062b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80062e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800631:	89 75 08             	mov    %esi,0x8(%ebp)
+  800634:	eb 5c                	jmp    800692 <vprintfmt+0x202>
+  800636:	83 ec 08             	sub    $0x8,%esp
+  800639:	ff 75 d0             	push   -0x30(%ebp)
+  80063c:	ff 75 cc             	push   -0x34(%ebp)
+  80063f:	e8 10 04 00 00       	call   800a54 <strnlen>
+  800644:	89 c2                	mov    %eax,%edx
+  800646:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800649:	29 d0                	sub    %edx,%eax
+  80064b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80064e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800652:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800655:	89 75 08             	mov    %esi,0x8(%ebp)
+  800658:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80065a:	eb 0e                	jmp    80066a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80065c:	83 ec 08             	sub    $0x8,%esp
+  80065f:	53                   	push   %ebx
+  800660:	57                   	push   %edi
+  800661:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800664:	83 ee 01             	sub    $0x1,%esi
+  800667:	83 c4 10             	add    $0x10,%esp
+  80066a:	85 f6                	test   %esi,%esi
+  80066c:	7f ee                	jg     80065c <vprintfmt+0x1cc>
+  80066e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800671:	8b 75 08             	mov    0x8(%ebp),%esi
+  800674:	85 c0                	test   %eax,%eax
+  800676:	ba 00 00 00 00       	mov    $0x0,%edx
+  80067b:	0f 49 d0             	cmovns %eax,%edx
+  80067e:	29 d0                	sub    %edx,%eax
+  800680:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800683:	eb a6                	jmp    80062b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800685:	83 ec 08             	sub    $0x8,%esp
+  800688:	53                   	push   %ebx
+  800689:	52                   	push   %edx
+  80068a:	ff 55 08             	call   *0x8(%ebp)
+  80068d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800690:	89 f1                	mov    %esi,%ecx
+  800692:	8d 71 01             	lea    0x1(%ecx),%esi
+  800695:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800699:	0f be d0             	movsbl %al,%edx
+  80069c:	85 d2                	test   %edx,%edx
+  80069e:	74 28                	je     8006c8 <vprintfmt+0x238>
+  8006a0:	85 ff                	test   %edi,%edi
+  8006a2:	78 05                	js     8006a9 <vprintfmt+0x219>
+  8006a4:	83 ef 01             	sub    $0x1,%edi
+  8006a7:	78 30                	js     8006d9 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006a9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006ad:	74 d6                	je     800685 <vprintfmt+0x1f5>
+  8006af:	0f be c0             	movsbl %al,%eax
+  8006b2:	83 e8 20             	sub    $0x20,%eax
+  8006b5:	83 f8 5e             	cmp    $0x5e,%eax
+  8006b8:	76 cb                	jbe    800685 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8006ba:	83 ec 08             	sub    $0x8,%esp
+  8006bd:	53                   	push   %ebx
+  8006be:	6a 3f                	push   $0x3f
+  8006c0:	ff 55 08             	call   *0x8(%ebp)
+  8006c3:	83 c4 10             	add    $0x10,%esp
+  8006c6:	eb c8                	jmp    800690 <vprintfmt+0x200>
+  8006c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006cb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006d1:	01 d0                	add    %edx,%eax
+  8006d3:	29 c8                	sub    %ecx,%eax
+  8006d5:	89 c7                	mov    %eax,%edi
+  8006d7:	eb 13                	jmp    8006ec <vprintfmt+0x25c>
+  8006d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006dc:	eb ed                	jmp    8006cb <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8006de:	83 ec 08             	sub    $0x8,%esp
+  8006e1:	53                   	push   %ebx
+  8006e2:	6a 20                	push   $0x20
+  8006e4:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006e6:	83 ef 01             	sub    $0x1,%edi
+  8006e9:	83 c4 10             	add    $0x10,%esp
+  8006ec:	85 ff                	test   %edi,%edi
+  8006ee:	7f ee                	jg     8006de <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006f0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f6:	e9 6b 01 00 00       	jmp    800866 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8006fb:	83 f9 01             	cmp    $0x1,%ecx
+  8006fe:	7f 1f                	jg     80071f <vprintfmt+0x28f>
+	else if (lflag)
+  800700:	85 c9                	test   %ecx,%ecx
+  800702:	74 67                	je     80076b <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800704:	8b 45 14             	mov    0x14(%ebp),%eax
+  800707:	8b 00                	mov    (%eax),%eax
+  800709:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80070c:	89 c1                	mov    %eax,%ecx
+  80070e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800711:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800714:	8b 45 14             	mov    0x14(%ebp),%eax
+  800717:	8d 40 04             	lea    0x4(%eax),%eax
+  80071a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80071d:	eb 17                	jmp    800736 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  80071f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800722:	8b 50 04             	mov    0x4(%eax),%edx
+  800725:	8b 00                	mov    (%eax),%eax
+  800727:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80072a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80072d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800730:	8d 40 08             	lea    0x8(%eax),%eax
+  800733:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800736:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800739:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80073c:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800741:	85 c9                	test   %ecx,%ecx
+  800743:	0f 89 03 01 00 00    	jns    80084c <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800749:	83 ec 08             	sub    $0x8,%esp
+  80074c:	53                   	push   %ebx
+  80074d:	6a 2d                	push   $0x2d
+  80074f:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800751:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800754:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800757:	f7 da                	neg    %edx
+  800759:	83 d1 00             	adc    $0x0,%ecx
+  80075c:	f7 d9                	neg    %ecx
+  80075e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800761:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800766:	e9 e1 00 00 00       	jmp    80084c <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  80076b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076e:	8b 00                	mov    (%eax),%eax
+  800770:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800773:	89 c1                	mov    %eax,%ecx
+  800775:	c1 f9 1f             	sar    $0x1f,%ecx
+  800778:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80077b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077e:	8d 40 04             	lea    0x4(%eax),%eax
+  800781:	89 45 14             	mov    %eax,0x14(%ebp)
+  800784:	eb b0                	jmp    800736 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800786:	83 f9 01             	cmp    $0x1,%ecx
+  800789:	7f 1e                	jg     8007a9 <vprintfmt+0x319>
+	else if (lflag)
+  80078b:	85 c9                	test   %ecx,%ecx
+  80078d:	74 32                	je     8007c1 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8b 10                	mov    (%eax),%edx
+  800794:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800799:	8d 40 04             	lea    0x4(%eax),%eax
+  80079c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80079f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8007a4:	e9 a3 00 00 00       	jmp    80084c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ac:	8b 10                	mov    (%eax),%edx
+  8007ae:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007b1:	8d 40 08             	lea    0x8(%eax),%eax
+  8007b4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007b7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8007bc:	e9 8b 00 00 00       	jmp    80084c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c4:	8b 10                	mov    (%eax),%edx
+  8007c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007d6:	eb 74                	jmp    80084c <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8007d8:	83 f9 01             	cmp    $0x1,%ecx
+  8007db:	7f 1b                	jg     8007f8 <vprintfmt+0x368>
+	else if (lflag)
+  8007dd:	85 c9                	test   %ecx,%ecx
+  8007df:	74 2c                	je     80080d <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8007e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e4:	8b 10                	mov    (%eax),%edx
+  8007e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007f1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8007f6:	eb 54                	jmp    80084c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fb:	8b 10                	mov    (%eax),%edx
+  8007fd:	8b 48 04             	mov    0x4(%eax),%ecx
+  800800:	8d 40 08             	lea    0x8(%eax),%eax
+  800803:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800806:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  80080b:	eb 3f                	jmp    80084c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80080d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800810:	8b 10                	mov    (%eax),%edx
+  800812:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800817:	8d 40 04             	lea    0x4(%eax),%eax
+  80081a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80081d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800822:	eb 28                	jmp    80084c <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800824:	83 ec 08             	sub    $0x8,%esp
+  800827:	53                   	push   %ebx
+  800828:	6a 30                	push   $0x30
+  80082a:	ff d6                	call   *%esi
+			putch('x', putdat);
+  80082c:	83 c4 08             	add    $0x8,%esp
+  80082f:	53                   	push   %ebx
+  800830:	6a 78                	push   $0x78
+  800832:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800834:	8b 45 14             	mov    0x14(%ebp),%eax
+  800837:	8b 10                	mov    (%eax),%edx
+  800839:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80083e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800841:	8d 40 04             	lea    0x4(%eax),%eax
+  800844:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800847:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80084c:	83 ec 0c             	sub    $0xc,%esp
+  80084f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800853:	50                   	push   %eax
+  800854:	ff 75 e0             	push   -0x20(%ebp)
+  800857:	57                   	push   %edi
+  800858:	51                   	push   %ecx
+  800859:	52                   	push   %edx
+  80085a:	89 da                	mov    %ebx,%edx
+  80085c:	89 f0                	mov    %esi,%eax
+  80085e:	e8 4a fb ff ff       	call   8003ad <printnum>
+			break;
+  800863:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800866:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800869:	e9 40 fc ff ff       	jmp    8004ae <vprintfmt+0x1e>
+	if (lflag >= 2)
+  80086e:	83 f9 01             	cmp    $0x1,%ecx
+  800871:	7f 1b                	jg     80088e <vprintfmt+0x3fe>
+	else if (lflag)
+  800873:	85 c9                	test   %ecx,%ecx
+  800875:	74 2c                	je     8008a3 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800877:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087a:	8b 10                	mov    (%eax),%edx
+  80087c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800881:	8d 40 04             	lea    0x4(%eax),%eax
+  800884:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800887:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80088c:	eb be                	jmp    80084c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80088e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800891:	8b 10                	mov    (%eax),%edx
+  800893:	8b 48 04             	mov    0x4(%eax),%ecx
+  800896:	8d 40 08             	lea    0x8(%eax),%eax
+  800899:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80089c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8008a1:	eb a9                	jmp    80084c <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8008a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a6:	8b 10                	mov    (%eax),%edx
+  8008a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008b3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8008b8:	eb 92                	jmp    80084c <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8008ba:	83 ec 08             	sub    $0x8,%esp
+  8008bd:	53                   	push   %ebx
+  8008be:	6a 25                	push   $0x25
+  8008c0:	ff d6                	call   *%esi
+			break;
+  8008c2:	83 c4 10             	add    $0x10,%esp
+  8008c5:	eb 9f                	jmp    800866 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8008c7:	83 ec 08             	sub    $0x8,%esp
+  8008ca:	53                   	push   %ebx
+  8008cb:	6a 25                	push   $0x25
+  8008cd:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008cf:	83 c4 10             	add    $0x10,%esp
+  8008d2:	89 f8                	mov    %edi,%eax
+  8008d4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008d8:	74 05                	je     8008df <vprintfmt+0x44f>
+  8008da:	83 e8 01             	sub    $0x1,%eax
+  8008dd:	eb f5                	jmp    8008d4 <vprintfmt+0x444>
+  8008df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008e2:	eb 82                	jmp    800866 <vprintfmt+0x3d6>
+
+008008e4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008e4:	55                   	push   %ebp
+  8008e5:	89 e5                	mov    %esp,%ebp
+  8008e7:	83 ec 18             	sub    $0x18,%esp
+  8008ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008f0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008f3:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008f7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008fa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800901:	85 c0                	test   %eax,%eax
+  800903:	74 26                	je     80092b <vsnprintf+0x47>
+  800905:	85 d2                	test   %edx,%edx
+  800907:	7e 22                	jle    80092b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800909:	ff 75 14             	push   0x14(%ebp)
+  80090c:	ff 75 10             	push   0x10(%ebp)
+  80090f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800912:	50                   	push   %eax
+  800913:	68 56 04 80 00       	push   $0x800456
+  800918:	e8 73 fb ff ff       	call   800490 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80091d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800920:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800923:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800926:	83 c4 10             	add    $0x10,%esp
+}
+  800929:	c9                   	leave
+  80092a:	c3                   	ret
+		return -E_INVAL;
+  80092b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800930:	eb f7                	jmp    800929 <vsnprintf+0x45>
+
+00800932 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800932:	55                   	push   %ebp
+  800933:	89 e5                	mov    %esp,%ebp
+  800935:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800938:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80093b:	50                   	push   %eax
+  80093c:	ff 75 10             	push   0x10(%ebp)
+  80093f:	ff 75 0c             	push   0xc(%ebp)
+  800942:	ff 75 08             	push   0x8(%ebp)
+  800945:	e8 9a ff ff ff       	call   8008e4 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80094a:	c9                   	leave
+  80094b:	c3                   	ret
+
+0080094c <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  80094c:	55                   	push   %ebp
+  80094d:	89 e5                	mov    %esp,%ebp
+  80094f:	57                   	push   %edi
+  800950:	56                   	push   %esi
+  800951:	53                   	push   %ebx
+  800952:	83 ec 0c             	sub    $0xc,%esp
+  800955:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  800958:	85 c0                	test   %eax,%eax
+  80095a:	74 13                	je     80096f <readline+0x23>
+		fprintf(1, "%s", prompt);
+  80095c:	83 ec 04             	sub    $0x4,%esp
+  80095f:	50                   	push   %eax
+  800960:	68 c2 3e 80 00       	push   $0x803ec2
+  800965:	6a 01                	push   $0x1
+  800967:	e8 94 20 00 00       	call   802a00 <fprintf>
+  80096c:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  80096f:	83 ec 0c             	sub    $0xc,%esp
+  800972:	6a 00                	push   $0x0
+  800974:	e8 64 f8 ff ff       	call   8001dd <iscons>
+  800979:	89 c7                	mov    %eax,%edi
+  80097b:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  80097e:	be 00 00 00 00       	mov    $0x0,%esi
+  800983:	eb 4b                	jmp    8009d0 <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  800985:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  80098a:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  80098d:	75 08                	jne    800997 <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  80098f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800992:	5b                   	pop    %ebx
+  800993:	5e                   	pop    %esi
+  800994:	5f                   	pop    %edi
+  800995:	5d                   	pop    %ebp
+  800996:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  800997:	83 ec 08             	sub    $0x8,%esp
+  80099a:	53                   	push   %ebx
+  80099b:	68 c7 3d 80 00       	push   $0x803dc7
+  8009a0:	e8 f4 f9 ff ff       	call   800399 <cprintf>
+  8009a5:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  8009a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ad:	eb e0                	jmp    80098f <readline+0x43>
+			if (echoing)
+  8009af:	85 ff                	test   %edi,%edi
+  8009b1:	75 05                	jne    8009b8 <readline+0x6c>
+			i--;
+  8009b3:	83 ee 01             	sub    $0x1,%esi
+  8009b6:	eb 18                	jmp    8009d0 <readline+0x84>
+				cputchar('\b');
+  8009b8:	83 ec 0c             	sub    $0xc,%esp
+  8009bb:	6a 08                	push   $0x8
+  8009bd:	e8 d6 f7 ff ff       	call   800198 <cputchar>
+  8009c2:	83 c4 10             	add    $0x10,%esp
+  8009c5:	eb ec                	jmp    8009b3 <readline+0x67>
+			buf[i++] = c;
+  8009c7:	88 9e 20 60 80 00    	mov    %bl,0x806020(%esi)
+  8009cd:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  8009d0:	e8 df f7 ff ff       	call   8001b4 <getchar>
+  8009d5:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  8009d7:	85 c0                	test   %eax,%eax
+  8009d9:	78 aa                	js     800985 <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  8009db:	83 f8 08             	cmp    $0x8,%eax
+  8009de:	0f 94 c0             	sete   %al
+  8009e1:	83 fb 7f             	cmp    $0x7f,%ebx
+  8009e4:	0f 94 c2             	sete   %dl
+  8009e7:	08 d0                	or     %dl,%al
+  8009e9:	74 04                	je     8009ef <readline+0xa3>
+  8009eb:	85 f6                	test   %esi,%esi
+  8009ed:	7f c0                	jg     8009af <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  8009ef:	83 fb 1f             	cmp    $0x1f,%ebx
+  8009f2:	7e 1a                	jle    800a0e <readline+0xc2>
+  8009f4:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  8009fa:	7f 12                	jg     800a0e <readline+0xc2>
+			if (echoing)
+  8009fc:	85 ff                	test   %edi,%edi
+  8009fe:	74 c7                	je     8009c7 <readline+0x7b>
+				cputchar(c);
+  800a00:	83 ec 0c             	sub    $0xc,%esp
+  800a03:	53                   	push   %ebx
+  800a04:	e8 8f f7 ff ff       	call   800198 <cputchar>
+  800a09:	83 c4 10             	add    $0x10,%esp
+  800a0c:	eb b9                	jmp    8009c7 <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  800a0e:	83 fb 0a             	cmp    $0xa,%ebx
+  800a11:	74 05                	je     800a18 <readline+0xcc>
+  800a13:	83 fb 0d             	cmp    $0xd,%ebx
+  800a16:	75 b8                	jne    8009d0 <readline+0x84>
+			if (echoing)
+  800a18:	85 ff                	test   %edi,%edi
+  800a1a:	75 11                	jne    800a2d <readline+0xe1>
+			buf[i] = 0;
+  800a1c:	c6 86 20 60 80 00 00 	movb   $0x0,0x806020(%esi)
+			return buf;
+  800a23:	b8 20 60 80 00       	mov    $0x806020,%eax
+  800a28:	e9 62 ff ff ff       	jmp    80098f <readline+0x43>
+				cputchar('\n');
+  800a2d:	83 ec 0c             	sub    $0xc,%esp
+  800a30:	6a 0a                	push   $0xa
+  800a32:	e8 61 f7 ff ff       	call   800198 <cputchar>
+  800a37:	83 c4 10             	add    $0x10,%esp
+  800a3a:	eb e0                	jmp    800a1c <readline+0xd0>
+
+00800a3c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a3c:	55                   	push   %ebp
+  800a3d:	89 e5                	mov    %esp,%ebp
+  800a3f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a47:	eb 03                	jmp    800a4c <strlen+0x10>
+		n++;
+  800a49:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a4c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a50:	75 f7                	jne    800a49 <strlen+0xd>
+	return n;
+}
+  800a52:	5d                   	pop    %ebp
+  800a53:	c3                   	ret
+
+00800a54 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a54:	55                   	push   %ebp
+  800a55:	89 e5                	mov    %esp,%ebp
+  800a57:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a62:	eb 03                	jmp    800a67 <strnlen+0x13>
+		n++;
+  800a64:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a67:	39 d0                	cmp    %edx,%eax
+  800a69:	74 08                	je     800a73 <strnlen+0x1f>
+  800a6b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a6f:	75 f3                	jne    800a64 <strnlen+0x10>
+  800a71:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a73:	89 d0                	mov    %edx,%eax
+  800a75:	5d                   	pop    %ebp
+  800a76:	c3                   	ret
+
+00800a77 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a77:	55                   	push   %ebp
+  800a78:	89 e5                	mov    %esp,%ebp
+  800a7a:	53                   	push   %ebx
+  800a7b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a7e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a86:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a8a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a8d:	83 c0 01             	add    $0x1,%eax
+  800a90:	84 d2                	test   %dl,%dl
+  800a92:	75 f2                	jne    800a86 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a94:	89 c8                	mov    %ecx,%eax
+  800a96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a99:	c9                   	leave
+  800a9a:	c3                   	ret
+
+00800a9b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a9b:	55                   	push   %ebp
+  800a9c:	89 e5                	mov    %esp,%ebp
+  800a9e:	53                   	push   %ebx
+  800a9f:	83 ec 10             	sub    $0x10,%esp
+  800aa2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800aa5:	53                   	push   %ebx
+  800aa6:	e8 91 ff ff ff       	call   800a3c <strlen>
+  800aab:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800aae:	ff 75 0c             	push   0xc(%ebp)
+  800ab1:	01 d8                	add    %ebx,%eax
+  800ab3:	50                   	push   %eax
+  800ab4:	e8 be ff ff ff       	call   800a77 <strcpy>
+	return dst;
+}
+  800ab9:	89 d8                	mov    %ebx,%eax
+  800abb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800abe:	c9                   	leave
+  800abf:	c3                   	ret
+
+00800ac0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ac0:	55                   	push   %ebp
+  800ac1:	89 e5                	mov    %esp,%ebp
+  800ac3:	56                   	push   %esi
+  800ac4:	53                   	push   %ebx
+  800ac5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ac8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800acb:	89 f3                	mov    %esi,%ebx
+  800acd:	03 5d 10             	add    0x10(%ebp),%ebx
+  800ad0:	89 f0                	mov    %esi,%eax
+  800ad2:	eb 0f                	jmp    800ae3 <strncpy+0x23>
+		*dst++ = *src;
+  800ad4:	83 c0 01             	add    $0x1,%eax
+  800ad7:	0f b6 0a             	movzbl (%edx),%ecx
+  800ada:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800add:	80 f9 01             	cmp    $0x1,%cl
+  800ae0:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800ae3:	39 d8                	cmp    %ebx,%eax
+  800ae5:	75 ed                	jne    800ad4 <strncpy+0x14>
+	}
+	return ret;
+}
+  800ae7:	89 f0                	mov    %esi,%eax
+  800ae9:	5b                   	pop    %ebx
+  800aea:	5e                   	pop    %esi
+  800aeb:	5d                   	pop    %ebp
+  800aec:	c3                   	ret
+
+00800aed <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800aed:	55                   	push   %ebp
+  800aee:	89 e5                	mov    %esp,%ebp
+  800af0:	56                   	push   %esi
+  800af1:	53                   	push   %ebx
+  800af2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800af5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af8:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800afb:	89 f0                	mov    %esi,%eax
+  800afd:	85 d2                	test   %edx,%edx
+  800aff:	74 21                	je     800b22 <strlcpy+0x35>
+  800b01:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b05:	89 f2                	mov    %esi,%edx
+  800b07:	eb 09                	jmp    800b12 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b09:	83 c1 01             	add    $0x1,%ecx
+  800b0c:	83 c2 01             	add    $0x1,%edx
+  800b0f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b12:	39 c2                	cmp    %eax,%edx
+  800b14:	74 09                	je     800b1f <strlcpy+0x32>
+  800b16:	0f b6 19             	movzbl (%ecx),%ebx
+  800b19:	84 db                	test   %bl,%bl
+  800b1b:	75 ec                	jne    800b09 <strlcpy+0x1c>
+  800b1d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b1f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b22:	29 f0                	sub    %esi,%eax
+}
+  800b24:	5b                   	pop    %ebx
+  800b25:	5e                   	pop    %esi
+  800b26:	5d                   	pop    %ebp
+  800b27:	c3                   	ret
+
+00800b28 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b28:	55                   	push   %ebp
+  800b29:	89 e5                	mov    %esp,%ebp
+  800b2b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b2e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b31:	eb 06                	jmp    800b39 <strcmp+0x11>
+		p++, q++;
+  800b33:	83 c1 01             	add    $0x1,%ecx
+  800b36:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b39:	0f b6 01             	movzbl (%ecx),%eax
+  800b3c:	84 c0                	test   %al,%al
+  800b3e:	74 04                	je     800b44 <strcmp+0x1c>
+  800b40:	3a 02                	cmp    (%edx),%al
+  800b42:	74 ef                	je     800b33 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b44:	0f b6 c0             	movzbl %al,%eax
+  800b47:	0f b6 12             	movzbl (%edx),%edx
+  800b4a:	29 d0                	sub    %edx,%eax
+}
+  800b4c:	5d                   	pop    %ebp
+  800b4d:	c3                   	ret
+
+00800b4e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b4e:	55                   	push   %ebp
+  800b4f:	89 e5                	mov    %esp,%ebp
+  800b51:	53                   	push   %ebx
+  800b52:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b58:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b5b:	eb 09                	jmp    800b66 <strncmp+0x18>
+		n--, p++, q++;
+  800b5d:	83 ea 01             	sub    $0x1,%edx
+  800b60:	83 c0 01             	add    $0x1,%eax
+  800b63:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b66:	85 d2                	test   %edx,%edx
+  800b68:	74 18                	je     800b82 <strncmp+0x34>
+  800b6a:	0f b6 18             	movzbl (%eax),%ebx
+  800b6d:	84 db                	test   %bl,%bl
+  800b6f:	74 04                	je     800b75 <strncmp+0x27>
+  800b71:	3a 19                	cmp    (%ecx),%bl
+  800b73:	74 e8                	je     800b5d <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b75:	0f b6 00             	movzbl (%eax),%eax
+  800b78:	0f b6 11             	movzbl (%ecx),%edx
+  800b7b:	29 d0                	sub    %edx,%eax
+}
+  800b7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b80:	c9                   	leave
+  800b81:	c3                   	ret
+		return 0;
+  800b82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b87:	eb f4                	jmp    800b7d <strncmp+0x2f>
+
+00800b89 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b89:	55                   	push   %ebp
+  800b8a:	89 e5                	mov    %esp,%ebp
+  800b8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b93:	eb 03                	jmp    800b98 <strchr+0xf>
+  800b95:	83 c0 01             	add    $0x1,%eax
+  800b98:	0f b6 10             	movzbl (%eax),%edx
+  800b9b:	84 d2                	test   %dl,%dl
+  800b9d:	74 06                	je     800ba5 <strchr+0x1c>
+		if (*s == c)
+  800b9f:	38 ca                	cmp    %cl,%dl
+  800ba1:	75 f2                	jne    800b95 <strchr+0xc>
+  800ba3:	eb 05                	jmp    800baa <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800baa:	5d                   	pop    %ebp
+  800bab:	c3                   	ret
+
+00800bac <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bac:	55                   	push   %ebp
+  800bad:	89 e5                	mov    %esp,%ebp
+  800baf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bb6:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bb9:	38 ca                	cmp    %cl,%dl
+  800bbb:	74 09                	je     800bc6 <strfind+0x1a>
+  800bbd:	84 d2                	test   %dl,%dl
+  800bbf:	74 05                	je     800bc6 <strfind+0x1a>
+	for (; *s; s++)
+  800bc1:	83 c0 01             	add    $0x1,%eax
+  800bc4:	eb f0                	jmp    800bb6 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800bc6:	5d                   	pop    %ebp
+  800bc7:	c3                   	ret
+
+00800bc8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bc8:	55                   	push   %ebp
+  800bc9:	89 e5                	mov    %esp,%ebp
+  800bcb:	57                   	push   %edi
+  800bcc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bcf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bd2:	85 c9                	test   %ecx,%ecx
+  800bd4:	74 20                	je     800bf6 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800bd6:	89 f8                	mov    %edi,%eax
+  800bd8:	09 c8                	or     %ecx,%eax
+  800bda:	a8 03                	test   $0x3,%al
+  800bdc:	75 12                	jne    800bf0 <memset+0x28>
+		c &= 0xFF;
+  800bde:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800be2:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800be8:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800beb:	fc                   	cld
+  800bec:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bee:	eb 06                	jmp    800bf6 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800bf0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bf3:	fc                   	cld
+  800bf4:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bf6:	89 f8                	mov    %edi,%eax
+  800bf8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bfb:	c9                   	leave
+  800bfc:	c3                   	ret
+
+00800bfd <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	57                   	push   %edi
+  800c01:	56                   	push   %esi
+  800c02:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c05:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c08:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c0b:	39 c6                	cmp    %eax,%esi
+  800c0d:	73 32                	jae    800c41 <memmove+0x44>
+  800c0f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c12:	39 d0                	cmp    %edx,%eax
+  800c14:	73 2b                	jae    800c41 <memmove+0x44>
+		s += n;
+		d += n;
+  800c16:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c19:	89 d6                	mov    %edx,%esi
+  800c1b:	09 fe                	or     %edi,%esi
+  800c1d:	09 ce                	or     %ecx,%esi
+  800c1f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c25:	75 0e                	jne    800c35 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c27:	83 ef 04             	sub    $0x4,%edi
+  800c2a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c2d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c30:	fd                   	std
+  800c31:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c33:	eb 09                	jmp    800c3e <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c35:	83 ef 01             	sub    $0x1,%edi
+  800c38:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c3b:	fd                   	std
+  800c3c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c3e:	fc                   	cld
+  800c3f:	eb 1a                	jmp    800c5b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c41:	89 f2                	mov    %esi,%edx
+  800c43:	09 c2                	or     %eax,%edx
+  800c45:	09 ca                	or     %ecx,%edx
+  800c47:	f6 c2 03             	test   $0x3,%dl
+  800c4a:	75 0a                	jne    800c56 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c4c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c4f:	89 c7                	mov    %eax,%edi
+  800c51:	fc                   	cld
+  800c52:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c54:	eb 05                	jmp    800c5b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c56:	89 c7                	mov    %eax,%edi
+  800c58:	fc                   	cld
+  800c59:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c5b:	5e                   	pop    %esi
+  800c5c:	5f                   	pop    %edi
+  800c5d:	5d                   	pop    %ebp
+  800c5e:	c3                   	ret
+
+00800c5f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c65:	ff 75 10             	push   0x10(%ebp)
+  800c68:	ff 75 0c             	push   0xc(%ebp)
+  800c6b:	ff 75 08             	push   0x8(%ebp)
+  800c6e:	e8 8a ff ff ff       	call   800bfd <memmove>
+}
+  800c73:	c9                   	leave
+  800c74:	c3                   	ret
+
+00800c75 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c75:	55                   	push   %ebp
+  800c76:	89 e5                	mov    %esp,%ebp
+  800c78:	56                   	push   %esi
+  800c79:	53                   	push   %ebx
+  800c7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c80:	89 c6                	mov    %eax,%esi
+  800c82:	03 75 10             	add    0x10(%ebp),%esi
+  800c85:	eb 06                	jmp    800c8d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c87:	83 c0 01             	add    $0x1,%eax
+  800c8a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c8d:	39 f0                	cmp    %esi,%eax
+  800c8f:	74 14                	je     800ca5 <memcmp+0x30>
+		if (*s1 != *s2)
+  800c91:	0f b6 08             	movzbl (%eax),%ecx
+  800c94:	0f b6 1a             	movzbl (%edx),%ebx
+  800c97:	38 d9                	cmp    %bl,%cl
+  800c99:	74 ec                	je     800c87 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c9b:	0f b6 c1             	movzbl %cl,%eax
+  800c9e:	0f b6 db             	movzbl %bl,%ebx
+  800ca1:	29 d8                	sub    %ebx,%eax
+  800ca3:	eb 05                	jmp    800caa <memcmp+0x35>
+	}
+
+	return 0;
+  800ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800caa:	5b                   	pop    %ebx
+  800cab:	5e                   	pop    %esi
+  800cac:	5d                   	pop    %ebp
+  800cad:	c3                   	ret
+
+00800cae <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cae:	55                   	push   %ebp
+  800caf:	89 e5                	mov    %esp,%ebp
+  800cb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cb7:	89 c2                	mov    %eax,%edx
+  800cb9:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cbc:	eb 03                	jmp    800cc1 <memfind+0x13>
+  800cbe:	83 c0 01             	add    $0x1,%eax
+  800cc1:	39 d0                	cmp    %edx,%eax
+  800cc3:	73 04                	jae    800cc9 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cc5:	38 08                	cmp    %cl,(%eax)
+  800cc7:	75 f5                	jne    800cbe <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800cc9:	5d                   	pop    %ebp
+  800cca:	c3                   	ret
+
+00800ccb <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ccb:	55                   	push   %ebp
+  800ccc:	89 e5                	mov    %esp,%ebp
+  800cce:	57                   	push   %edi
+  800ccf:	56                   	push   %esi
+  800cd0:	53                   	push   %ebx
+  800cd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cd7:	eb 03                	jmp    800cdc <strtol+0x11>
+		s++;
+  800cd9:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800cdc:	0f b6 02             	movzbl (%edx),%eax
+  800cdf:	3c 20                	cmp    $0x20,%al
+  800ce1:	74 f6                	je     800cd9 <strtol+0xe>
+  800ce3:	3c 09                	cmp    $0x9,%al
+  800ce5:	74 f2                	je     800cd9 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ce7:	3c 2b                	cmp    $0x2b,%al
+  800ce9:	74 2a                	je     800d15 <strtol+0x4a>
+	int neg = 0;
+  800ceb:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800cf0:	3c 2d                	cmp    $0x2d,%al
+  800cf2:	74 2b                	je     800d1f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cf4:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cfa:	75 0f                	jne    800d0b <strtol+0x40>
+  800cfc:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cff:	74 28                	je     800d29 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d01:	85 db                	test   %ebx,%ebx
+  800d03:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d08:	0f 44 d8             	cmove  %eax,%ebx
+  800d0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d10:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d13:	eb 46                	jmp    800d5b <strtol+0x90>
+		s++;
+  800d15:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d18:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d1d:	eb d5                	jmp    800cf4 <strtol+0x29>
+		s++, neg = 1;
+  800d1f:	83 c2 01             	add    $0x1,%edx
+  800d22:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d27:	eb cb                	jmp    800cf4 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d29:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d2d:	74 0e                	je     800d3d <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d2f:	85 db                	test   %ebx,%ebx
+  800d31:	75 d8                	jne    800d0b <strtol+0x40>
+		s++, base = 8;
+  800d33:	83 c2 01             	add    $0x1,%edx
+  800d36:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d3b:	eb ce                	jmp    800d0b <strtol+0x40>
+		s += 2, base = 16;
+  800d3d:	83 c2 02             	add    $0x2,%edx
+  800d40:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d45:	eb c4                	jmp    800d0b <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d47:	0f be c0             	movsbl %al,%eax
+  800d4a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d4d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d50:	7d 3a                	jge    800d8c <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d52:	83 c2 01             	add    $0x1,%edx
+  800d55:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d59:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d5b:	0f b6 02             	movzbl (%edx),%eax
+  800d5e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d61:	89 f3                	mov    %esi,%ebx
+  800d63:	80 fb 09             	cmp    $0x9,%bl
+  800d66:	76 df                	jbe    800d47 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d68:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d6b:	89 f3                	mov    %esi,%ebx
+  800d6d:	80 fb 19             	cmp    $0x19,%bl
+  800d70:	77 08                	ja     800d7a <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d72:	0f be c0             	movsbl %al,%eax
+  800d75:	83 e8 57             	sub    $0x57,%eax
+  800d78:	eb d3                	jmp    800d4d <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d7a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d7d:	89 f3                	mov    %esi,%ebx
+  800d7f:	80 fb 19             	cmp    $0x19,%bl
+  800d82:	77 08                	ja     800d8c <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d84:	0f be c0             	movsbl %al,%eax
+  800d87:	83 e8 37             	sub    $0x37,%eax
+  800d8a:	eb c1                	jmp    800d4d <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d8c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d90:	74 05                	je     800d97 <strtol+0xcc>
+		*endptr = (char *) s;
+  800d92:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d95:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d97:	89 c8                	mov    %ecx,%eax
+  800d99:	f7 d8                	neg    %eax
+  800d9b:	85 ff                	test   %edi,%edi
+  800d9d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800da0:	89 c8                	mov    %ecx,%eax
+  800da2:	5b                   	pop    %ebx
+  800da3:	5e                   	pop    %esi
+  800da4:	5f                   	pop    %edi
+  800da5:	5d                   	pop    %ebp
+  800da6:	c3                   	ret
+
+00800da7 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800da7:	55                   	push   %ebp
+  800da8:	89 e5                	mov    %esp,%ebp
+  800daa:	57                   	push   %edi
+  800dab:	56                   	push   %esi
+  800dac:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800dad:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db8:	89 c3                	mov    %eax,%ebx
+  800dba:	89 c7                	mov    %eax,%edi
+  800dbc:	55                   	push   %ebp
+  800dbd:	89 e5                	mov    %esp,%ebp
+  800dbf:	8d 35 c7 0d 80 00    	lea    0x800dc7,%esi
+  800dc5:	0f 34                	sysenter
+  800dc7:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800dc8:	5b                   	pop    %ebx
+  800dc9:	5e                   	pop    %esi
+  800dca:	5f                   	pop    %edi
+  800dcb:	5d                   	pop    %ebp
+  800dcc:	c3                   	ret
+
+00800dcd <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800dcd:	55                   	push   %ebp
+  800dce:	89 e5                	mov    %esp,%ebp
+  800dd0:	57                   	push   %edi
+  800dd1:	56                   	push   %esi
+  800dd2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800dd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ddd:	89 d1                	mov    %edx,%ecx
+  800ddf:	89 d3                	mov    %edx,%ebx
+  800de1:	89 d7                	mov    %edx,%edi
+  800de3:	55                   	push   %ebp
+  800de4:	89 e5                	mov    %esp,%ebp
+  800de6:	8d 35 ee 0d 80 00    	lea    0x800dee,%esi
+  800dec:	0f 34                	sysenter
+  800dee:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800def:	5b                   	pop    %ebx
+  800df0:	5e                   	pop    %esi
+  800df1:	5f                   	pop    %edi
+  800df2:	5d                   	pop    %ebp
+  800df3:	c3                   	ret
+
+00800df4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	57                   	push   %edi
+  800df8:	56                   	push   %esi
+  800df9:	53                   	push   %ebx
+  800dfa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800dfd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e05:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e0a:	89 cb                	mov    %ecx,%ebx
+  800e0c:	89 cf                	mov    %ecx,%edi
+  800e0e:	55                   	push   %ebp
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	8d 35 19 0e 80 00    	lea    0x800e19,%esi
+  800e17:	0f 34                	sysenter
+  800e19:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e1a:	85 c0                	test   %eax,%eax
+  800e1c:	7f 08                	jg     800e26 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800e1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e21:	5b                   	pop    %ebx
+  800e22:	5e                   	pop    %esi
+  800e23:	5f                   	pop    %edi
+  800e24:	5d                   	pop    %ebp
+  800e25:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e26:	83 ec 0c             	sub    $0xc,%esp
+  800e29:	50                   	push   %eax
+  800e2a:	6a 03                	push   $0x3
+  800e2c:	68 d7 3d 80 00       	push   $0x803dd7
+  800e31:	6a 3d                	push   $0x3d
+  800e33:	68 f4 3d 80 00       	push   $0x803df4
+  800e38:	e8 81 f4 ff ff       	call   8002be <_panic>
+
+00800e3d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e3d:	55                   	push   %ebp
+  800e3e:	89 e5                	mov    %esp,%ebp
+  800e40:	57                   	push   %edi
+  800e41:	56                   	push   %esi
+  800e42:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e43:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e48:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e4d:	89 d1                	mov    %edx,%ecx
+  800e4f:	89 d3                	mov    %edx,%ebx
+  800e51:	89 d7                	mov    %edx,%edi
+  800e53:	55                   	push   %ebp
+  800e54:	89 e5                	mov    %esp,%ebp
+  800e56:	8d 35 5e 0e 80 00    	lea    0x800e5e,%esi
+  800e5c:	0f 34                	sysenter
+  800e5e:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800e5f:	5b                   	pop    %ebx
+  800e60:	5e                   	pop    %esi
+  800e61:	5f                   	pop    %edi
+  800e62:	5d                   	pop    %ebp
+  800e63:	c3                   	ret
+
+00800e64 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e64:	55                   	push   %ebp
+  800e65:	89 e5                	mov    %esp,%ebp
+  800e67:	57                   	push   %edi
+  800e68:	56                   	push   %esi
+  800e69:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e74:	89 d1                	mov    %edx,%ecx
+  800e76:	89 d3                	mov    %edx,%ebx
+  800e78:	89 d7                	mov    %edx,%edi
+  800e7a:	89 d6                	mov    %edx,%esi
+  800e7c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e7e:	5b                   	pop    %ebx
+  800e7f:	5e                   	pop    %esi
+  800e80:	5f                   	pop    %edi
+  800e81:	5d                   	pop    %ebp
+  800e82:	c3                   	ret
+
+00800e83 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e83:	55                   	push   %ebp
+  800e84:	89 e5                	mov    %esp,%ebp
+  800e86:	57                   	push   %edi
+  800e87:	56                   	push   %esi
+  800e88:	53                   	push   %ebx
+  800e89:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e92:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e97:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9f:	55                   	push   %ebp
+  800ea0:	89 e5                	mov    %esp,%ebp
+  800ea2:	8d 35 aa 0e 80 00    	lea    0x800eaa,%esi
+  800ea8:	0f 34                	sysenter
+  800eaa:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800eab:	85 c0                	test   %eax,%eax
+  800ead:	7f 08                	jg     800eb7 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800eaf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb2:	5b                   	pop    %ebx
+  800eb3:	5e                   	pop    %esi
+  800eb4:	5f                   	pop    %edi
+  800eb5:	5d                   	pop    %ebp
+  800eb6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb7:	83 ec 0c             	sub    $0xc,%esp
+  800eba:	50                   	push   %eax
+  800ebb:	6a 04                	push   $0x4
+  800ebd:	68 d7 3d 80 00       	push   $0x803dd7
+  800ec2:	6a 3d                	push   $0x3d
+  800ec4:	68 f4 3d 80 00       	push   $0x803df4
+  800ec9:	e8 f0 f3 ff ff       	call   8002be <_panic>
+
+00800ece <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ece:	55                   	push   %ebp
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	57                   	push   %edi
+  800ed2:	56                   	push   %esi
+  800ed3:	53                   	push   %ebx
+  800ed4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edd:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ee2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ee5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ee8:	8b 75 18             	mov    0x18(%ebp),%esi
+  800eeb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eed:	85 c0                	test   %eax,%eax
+  800eef:	7f 08                	jg     800ef9 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ef1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef4:	5b                   	pop    %ebx
+  800ef5:	5e                   	pop    %esi
+  800ef6:	5f                   	pop    %edi
+  800ef7:	5d                   	pop    %ebp
+  800ef8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef9:	83 ec 0c             	sub    $0xc,%esp
+  800efc:	50                   	push   %eax
+  800efd:	6a 05                	push   $0x5
+  800eff:	68 d7 3d 80 00       	push   $0x803dd7
+  800f04:	6a 23                	push   $0x23
+  800f06:	68 f4 3d 80 00       	push   $0x803df4
+  800f0b:	e8 ae f3 ff ff       	call   8002be <_panic>
+
+00800f10 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f10:	55                   	push   %ebp
+  800f11:	89 e5                	mov    %esp,%ebp
+  800f13:	57                   	push   %edi
+  800f14:	56                   	push   %esi
+  800f15:	53                   	push   %ebx
+  800f16:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f24:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f29:	89 df                	mov    %ebx,%edi
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	8d 35 36 0f 80 00    	lea    0x800f36,%esi
+  800f34:	0f 34                	sysenter
+  800f36:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f37:	85 c0                	test   %eax,%eax
+  800f39:	7f 08                	jg     800f43 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800f3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3e:	5b                   	pop    %ebx
+  800f3f:	5e                   	pop    %esi
+  800f40:	5f                   	pop    %edi
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f43:	83 ec 0c             	sub    $0xc,%esp
+  800f46:	50                   	push   %eax
+  800f47:	6a 06                	push   $0x6
+  800f49:	68 d7 3d 80 00       	push   $0x803dd7
+  800f4e:	6a 3d                	push   $0x3d
+  800f50:	68 f4 3d 80 00       	push   $0x803df4
+  800f55:	e8 64 f3 ff ff       	call   8002be <_panic>
+
+00800f5a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f5a:	55                   	push   %ebp
+  800f5b:	89 e5                	mov    %esp,%ebp
+  800f5d:	57                   	push   %edi
+  800f5e:	56                   	push   %esi
+  800f5f:	53                   	push   %ebx
+  800f60:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f73:	89 df                	mov    %ebx,%edi
+  800f75:	55                   	push   %ebp
+  800f76:	89 e5                	mov    %esp,%ebp
+  800f78:	8d 35 80 0f 80 00    	lea    0x800f80,%esi
+  800f7e:	0f 34                	sysenter
+  800f80:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f81:	85 c0                	test   %eax,%eax
+  800f83:	7f 08                	jg     800f8d <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800f85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f88:	5b                   	pop    %ebx
+  800f89:	5e                   	pop    %esi
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8d:	83 ec 0c             	sub    $0xc,%esp
+  800f90:	50                   	push   %eax
+  800f91:	6a 08                	push   $0x8
+  800f93:	68 d7 3d 80 00       	push   $0x803dd7
+  800f98:	6a 3d                	push   $0x3d
+  800f9a:	68 f4 3d 80 00       	push   $0x803df4
+  800f9f:	e8 1a f3 ff ff       	call   8002be <_panic>
+
+00800fa4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fa4:	55                   	push   %ebp
+  800fa5:	89 e5                	mov    %esp,%ebp
+  800fa7:	57                   	push   %edi
+  800fa8:	56                   	push   %esi
+  800fa9:	53                   	push   %ebx
+  800faa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800fad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb8:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fbd:	89 df                	mov    %ebx,%edi
+  800fbf:	55                   	push   %ebp
+  800fc0:	89 e5                	mov    %esp,%ebp
+  800fc2:	8d 35 ca 0f 80 00    	lea    0x800fca,%esi
+  800fc8:	0f 34                	sysenter
+  800fca:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800fcb:	85 c0                	test   %eax,%eax
+  800fcd:	7f 08                	jg     800fd7 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800fcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd2:	5b                   	pop    %ebx
+  800fd3:	5e                   	pop    %esi
+  800fd4:	5f                   	pop    %edi
+  800fd5:	5d                   	pop    %ebp
+  800fd6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd7:	83 ec 0c             	sub    $0xc,%esp
+  800fda:	50                   	push   %eax
+  800fdb:	6a 09                	push   $0x9
+  800fdd:	68 d7 3d 80 00       	push   $0x803dd7
+  800fe2:	6a 3d                	push   $0x3d
+  800fe4:	68 f4 3d 80 00       	push   $0x803df4
+  800fe9:	e8 d0 f2 ff ff       	call   8002be <_panic>
+
+00800fee <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	57                   	push   %edi
+  800ff2:	56                   	push   %esi
+  800ff3:	53                   	push   %ebx
+  800ff4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ff7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801002:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801007:	89 df                	mov    %ebx,%edi
+  801009:	55                   	push   %ebp
+  80100a:	89 e5                	mov    %esp,%ebp
+  80100c:	8d 35 14 10 80 00    	lea    0x801014,%esi
+  801012:	0f 34                	sysenter
+  801014:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801015:	85 c0                	test   %eax,%eax
+  801017:	7f 08                	jg     801021 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  801019:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101c:	5b                   	pop    %ebx
+  80101d:	5e                   	pop    %esi
+  80101e:	5f                   	pop    %edi
+  80101f:	5d                   	pop    %ebp
+  801020:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801021:	83 ec 0c             	sub    $0xc,%esp
+  801024:	50                   	push   %eax
+  801025:	6a 0a                	push   $0xa
+  801027:	68 d7 3d 80 00       	push   $0x803dd7
+  80102c:	6a 3d                	push   $0x3d
+  80102e:	68 f4 3d 80 00       	push   $0x803df4
+  801033:	e8 86 f2 ff ff       	call   8002be <_panic>
+
+00801038 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801038:	55                   	push   %ebp
+  801039:	89 e5                	mov    %esp,%ebp
+  80103b:	57                   	push   %edi
+  80103c:	56                   	push   %esi
+  80103d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80103e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801041:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801044:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801049:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80104c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80104f:	55                   	push   %ebp
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	8d 35 5a 10 80 00    	lea    0x80105a,%esi
+  801058:	0f 34                	sysenter
+  80105a:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  80105b:	5b                   	pop    %ebx
+  80105c:	5e                   	pop    %esi
+  80105d:	5f                   	pop    %edi
+  80105e:	5d                   	pop    %ebp
+  80105f:	c3                   	ret
+
+00801060 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  801060:	55                   	push   %ebp
+  801061:	89 e5                	mov    %esp,%ebp
+  801063:	57                   	push   %edi
+  801064:	56                   	push   %esi
+  801065:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801066:	8b 55 08             	mov    0x8(%ebp),%edx
+  801069:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106c:	b8 17 00 00 00       	mov    $0x17,%eax
+  801071:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801074:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801077:	55                   	push   %ebp
+  801078:	89 e5                	mov    %esp,%ebp
+  80107a:	8d 35 82 10 80 00    	lea    0x801082,%esi
+  801080:	0f 34                	sysenter
+  801082:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  801083:	5b                   	pop    %ebx
+  801084:	5e                   	pop    %esi
+  801085:	5f                   	pop    %edi
+  801086:	5d                   	pop    %ebp
+  801087:	c3                   	ret
+
+00801088 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  801088:	55                   	push   %ebp
+  801089:	89 e5                	mov    %esp,%ebp
+  80108b:	57                   	push   %edi
+  80108c:	56                   	push   %esi
+  80108d:	53                   	push   %ebx
+  80108e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801091:	be 00 00 00 00       	mov    $0x0,%esi
+  801096:	8b 55 08             	mov    0x8(%ebp),%edx
+  801099:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a4:	89 f7                	mov    %esi,%edi
+  8010a6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010a8:	85 c0                	test   %eax,%eax
+  8010aa:	7f 08                	jg     8010b4 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8010ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010af:	5b                   	pop    %ebx
+  8010b0:	5e                   	pop    %esi
+  8010b1:	5f                   	pop    %edi
+  8010b2:	5d                   	pop    %ebp
+  8010b3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b4:	83 ec 0c             	sub    $0xc,%esp
+  8010b7:	50                   	push   %eax
+  8010b8:	6a 0d                	push   $0xd
+  8010ba:	68 d7 3d 80 00       	push   $0x803dd7
+  8010bf:	6a 23                	push   $0x23
+  8010c1:	68 f4 3d 80 00       	push   $0x803df4
+  8010c6:	e8 f3 f1 ff ff       	call   8002be <_panic>
+
+008010cb <sys_ipc_recv>:
+{
+  8010cb:	55                   	push   %ebp
+  8010cc:	89 e5                	mov    %esp,%ebp
+  8010ce:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  8010d1:	6a 00                	push   $0x0
+  8010d3:	6a 01                	push   $0x1
+  8010d5:	ff 75 08             	push   0x8(%ebp)
+  8010d8:	e8 ab ff ff ff       	call   801088 <sys_ipc_recvv>
+}
+  8010dd:	c9                   	leave
+  8010de:	c3                   	ret
+
+008010df <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  8010df:	55                   	push   %ebp
+  8010e0:	89 e5                	mov    %esp,%ebp
+  8010e2:	57                   	push   %edi
+  8010e3:	56                   	push   %esi
+  8010e4:	53                   	push   %ebx
+  8010e5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010f8:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8010fb:	89 de                	mov    %ebx,%esi
+  8010fd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ff:	85 c0                	test   %eax,%eax
+  801101:	7f 08                	jg     80110b <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  801103:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801106:	5b                   	pop    %ebx
+  801107:	5e                   	pop    %esi
+  801108:	5f                   	pop    %edi
+  801109:	5d                   	pop    %ebp
+  80110a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110b:	83 ec 0c             	sub    $0xc,%esp
+  80110e:	50                   	push   %eax
+  80110f:	6a 0d                	push   $0xd
+  801111:	68 d7 3d 80 00       	push   $0x803dd7
+  801116:	6a 23                	push   $0x23
+  801118:	68 f4 3d 80 00       	push   $0x803df4
+  80111d:	e8 9c f1 ff ff       	call   8002be <_panic>
+
+00801122 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801122:	55                   	push   %ebp
+  801123:	89 e5                	mov    %esp,%ebp
+  801125:	57                   	push   %edi
+  801126:	56                   	push   %esi
+  801127:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801128:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801132:	89 d1                	mov    %edx,%ecx
+  801134:	89 d3                	mov    %edx,%ebx
+  801136:	89 d7                	mov    %edx,%edi
+  801138:	55                   	push   %ebp
+  801139:	89 e5                	mov    %esp,%ebp
+  80113b:	8d 35 43 11 80 00    	lea    0x801143,%esi
+  801141:	0f 34                	sysenter
+  801143:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  801144:	5b                   	pop    %ebx
+  801145:	5e                   	pop    %esi
+  801146:	5f                   	pop    %edi
+  801147:	5d                   	pop    %ebp
+  801148:	c3                   	ret
+
+00801149 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	57                   	push   %edi
+  80114d:	56                   	push   %esi
+  80114e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80114f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801154:	8b 55 08             	mov    0x8(%ebp),%edx
+  801157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80115f:	89 df                	mov    %ebx,%edi
+  801161:	55                   	push   %ebp
+  801162:	89 e5                	mov    %esp,%ebp
+  801164:	8d 35 6c 11 80 00    	lea    0x80116c,%esi
+  80116a:	0f 34                	sysenter
+  80116c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  80116d:	5b                   	pop    %ebx
+  80116e:	5e                   	pop    %esi
+  80116f:	5f                   	pop    %edi
+  801170:	5d                   	pop    %ebp
+  801171:	c3                   	ret
+
+00801172 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  801172:	55                   	push   %ebp
+  801173:	89 e5                	mov    %esp,%ebp
+  801175:	57                   	push   %edi
+  801176:	56                   	push   %esi
+  801177:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801178:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80117d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801180:	b8 10 00 00 00       	mov    $0x10,%eax
+  801185:	89 cb                	mov    %ecx,%ebx
+  801187:	89 cf                	mov    %ecx,%edi
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	8d 35 94 11 80 00    	lea    0x801194,%esi
+  801192:	0f 34                	sysenter
+  801194:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+
+0080119a <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  80119a:	55                   	push   %ebp
+  80119b:	89 e5                	mov    %esp,%ebp
+  80119d:	57                   	push   %edi
+  80119e:	56                   	push   %esi
+  80119f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ab:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011b0:	89 df                	mov    %ebx,%edi
+  8011b2:	55                   	push   %ebp
+  8011b3:	89 e5                	mov    %esp,%ebp
+  8011b5:	8d 35 bd 11 80 00    	lea    0x8011bd,%esi
+  8011bb:	0f 34                	sysenter
+  8011bd:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8011be:	5b                   	pop    %ebx
+  8011bf:	5e                   	pop    %esi
+  8011c0:	5f                   	pop    %edi
+  8011c1:	5d                   	pop    %ebp
+  8011c2:	c3                   	ret
+
+008011c3 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8011c3:	55                   	push   %ebp
+  8011c4:	89 e5                	mov    %esp,%ebp
+  8011c6:	57                   	push   %edi
+  8011c7:	56                   	push   %esi
+  8011c8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d4:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011d9:	89 df                	mov    %ebx,%edi
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	8d 35 e6 11 80 00    	lea    0x8011e6,%esi
+  8011e4:	0f 34                	sysenter
+  8011e6:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  8011e7:	5b                   	pop    %ebx
+  8011e8:	5e                   	pop    %esi
+  8011e9:	5f                   	pop    %edi
+  8011ea:	5d                   	pop    %ebp
+  8011eb:	c3                   	ret
+
+008011ec <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  8011ec:	55                   	push   %ebp
+  8011ed:	89 e5                	mov    %esp,%ebp
+  8011ef:	57                   	push   %edi
+  8011f0:	56                   	push   %esi
+  8011f1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801200:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801203:	55                   	push   %ebp
+  801204:	89 e5                	mov    %esp,%ebp
+  801206:	8d 35 0e 12 80 00    	lea    0x80120e,%esi
+  80120c:	0f 34                	sysenter
+  80120e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  80120f:	5b                   	pop    %ebx
+  801210:	5e                   	pop    %esi
+  801211:	5f                   	pop    %edi
+  801212:	5d                   	pop    %ebp
+  801213:	c3                   	ret
+
+00801214 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801214:	55                   	push   %ebp
+  801215:	89 e5                	mov    %esp,%ebp
+  801217:	57                   	push   %edi
+  801218:	56                   	push   %esi
+  801219:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80121a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80121f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801222:	b8 11 00 00 00       	mov    $0x11,%eax
+  801227:	89 cb                	mov    %ecx,%ebx
+  801229:	89 cf                	mov    %ecx,%edi
+  80122b:	89 ce                	mov    %ecx,%esi
+  80122d:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  80122f:	5b                   	pop    %ebx
+  801230:	5e                   	pop    %esi
+  801231:	5f                   	pop    %edi
+  801232:	5d                   	pop    %ebp
+  801233:	c3                   	ret
+
+00801234 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  801234:	55                   	push   %ebp
+  801235:	89 e5                	mov    %esp,%ebp
+  801237:	57                   	push   %edi
+  801238:	56                   	push   %esi
+  801239:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80123a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80123f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801242:	b8 15 00 00 00       	mov    $0x15,%eax
+  801247:	89 cb                	mov    %ecx,%ebx
+  801249:	89 cf                	mov    %ecx,%edi
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	8d 35 56 12 80 00    	lea    0x801256,%esi
+  801254:	0f 34                	sysenter
+  801256:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  801257:	5b                   	pop    %ebx
+  801258:	5e                   	pop    %esi
+  801259:	5f                   	pop    %edi
+  80125a:	5d                   	pop    %ebp
+  80125b:	c3                   	ret
+
+0080125c <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  80125c:	55                   	push   %ebp
+  80125d:	89 e5                	mov    %esp,%ebp
+  80125f:	57                   	push   %edi
+  801260:	56                   	push   %esi
+  801261:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801262:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801267:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126a:	b8 16 00 00 00       	mov    $0x16,%eax
+  80126f:	89 cb                	mov    %ecx,%ebx
+  801271:	89 cf                	mov    %ecx,%edi
+  801273:	55                   	push   %ebp
+  801274:	89 e5                	mov    %esp,%ebp
+  801276:	8d 35 7e 12 80 00    	lea    0x80127e,%esi
+  80127c:	0f 34                	sysenter
+  80127e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  80127f:	5b                   	pop    %ebx
+  801280:	5e                   	pop    %esi
+  801281:	5f                   	pop    %edi
+  801282:	5d                   	pop    %ebp
+  801283:	c3                   	ret
+
+00801284 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801284:	55                   	push   %ebp
+  801285:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801287:	8b 45 08             	mov    0x8(%ebp),%eax
+  80128a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80128f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801292:	5d                   	pop    %ebp
+  801293:	c3                   	ret
+
+00801294 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801294:	55                   	push   %ebp
+  801295:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801297:	8b 45 08             	mov    0x8(%ebp),%eax
+  80129a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80129f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8012a4:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8012a9:	5d                   	pop    %ebp
+  8012aa:	c3                   	ret
+
+008012ab <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012ab:	55                   	push   %ebp
+  8012ac:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8012ae:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8012b3:	eb 02                	jmp    8012b7 <fd_alloc+0xc>
+  8012b5:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8012b7:	89 c2                	mov    %eax,%edx
+  8012b9:	c1 ea 16             	shr    $0x16,%edx
+  8012bc:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8012c3:	f6 c2 01             	test   $0x1,%dl
+  8012c6:	74 2b                	je     8012f3 <fd_alloc+0x48>
+  8012c8:	89 c2                	mov    %eax,%edx
+  8012ca:	c1 ea 0c             	shr    $0xc,%edx
+  8012cd:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8012d4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8012da:	f6 c1 01             	test   $0x1,%cl
+  8012dd:	74 14                	je     8012f3 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8012df:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8012e5:	75 ce                	jne    8012b5 <fd_alloc+0xa>
+  8012e7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8012ec:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8012f1:	eb 05                	jmp    8012f8 <fd_alloc+0x4d>
+			return 0;
+  8012f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8012f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fb:	89 02                	mov    %eax,(%edx)
+}
+  8012fd:	89 c8                	mov    %ecx,%eax
+  8012ff:	5d                   	pop    %ebp
+  801300:	c3                   	ret
+
+00801301 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801301:	55                   	push   %ebp
+  801302:	89 e5                	mov    %esp,%ebp
+  801304:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801307:	83 f8 1f             	cmp    $0x1f,%eax
+  80130a:	77 30                	ja     80133c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80130c:	c1 e0 0c             	shl    $0xc,%eax
+  80130f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801314:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80131a:	f6 c2 01             	test   $0x1,%dl
+  80131d:	74 24                	je     801343 <fd_lookup+0x42>
+  80131f:	89 c2                	mov    %eax,%edx
+  801321:	c1 ea 0c             	shr    $0xc,%edx
+  801324:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80132b:	f6 c2 01             	test   $0x1,%dl
+  80132e:	74 1a                	je     80134a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801330:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801333:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801335:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80133a:	5d                   	pop    %ebp
+  80133b:	c3                   	ret
+		return -E_INVAL;
+  80133c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801341:	eb f7                	jmp    80133a <fd_lookup+0x39>
+		return -E_INVAL;
+  801343:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801348:	eb f0                	jmp    80133a <fd_lookup+0x39>
+  80134a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80134f:	eb e9                	jmp    80133a <fd_lookup+0x39>
+
+00801351 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801351:	55                   	push   %ebp
+  801352:	89 e5                	mov    %esp,%ebp
+  801354:	53                   	push   %ebx
+  801355:	83 ec 04             	sub    $0x4,%esp
+  801358:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80135b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801360:	eb 03                	jmp    801365 <dev_lookup+0x14>
+  801362:	83 c0 01             	add    $0x1,%eax
+  801365:	8b 1c 85 80 3e 80 00 	mov    0x803e80(,%eax,4),%ebx
+  80136c:	85 db                	test   %ebx,%ebx
+  80136e:	74 0b                	je     80137b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801370:	39 13                	cmp    %edx,(%ebx)
+  801372:	75 ee                	jne    801362 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801374:	b8 00 00 00 00       	mov    $0x0,%eax
+  801379:	eb 1f                	jmp    80139a <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80137b:	a1 00 60 80 00       	mov    0x806000,%eax
+  801380:	8b 40 48             	mov    0x48(%eax),%eax
+  801383:	83 ec 04             	sub    $0x4,%esp
+  801386:	52                   	push   %edx
+  801387:	50                   	push   %eax
+  801388:	68 04 3e 80 00       	push   $0x803e04
+  80138d:	e8 07 f0 ff ff       	call   800399 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801392:	83 c4 10             	add    $0x10,%esp
+  801395:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80139a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80139d:	89 1a                	mov    %ebx,(%edx)
+}
+  80139f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013a2:	c9                   	leave
+  8013a3:	c3                   	ret
+
+008013a4 <fd_close>:
+{
+  8013a4:	55                   	push   %ebp
+  8013a5:	89 e5                	mov    %esp,%ebp
+  8013a7:	57                   	push   %edi
+  8013a8:	56                   	push   %esi
+  8013a9:	53                   	push   %ebx
+  8013aa:	83 ec 24             	sub    $0x24,%esp
+  8013ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013b0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013b3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013b6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013b7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8013bd:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013c0:	50                   	push   %eax
+  8013c1:	e8 3b ff ff ff       	call   801301 <fd_lookup>
+  8013c6:	89 c3                	mov    %eax,%ebx
+  8013c8:	83 c4 10             	add    $0x10,%esp
+  8013cb:	85 c0                	test   %eax,%eax
+  8013cd:	78 05                	js     8013d4 <fd_close+0x30>
+	    || fd != fd2)
+  8013cf:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8013d2:	74 16                	je     8013ea <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8013d4:	89 f8                	mov    %edi,%eax
+  8013d6:	84 c0                	test   %al,%al
+  8013d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013dd:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8013e0:	89 d8                	mov    %ebx,%eax
+  8013e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e5:	5b                   	pop    %ebx
+  8013e6:	5e                   	pop    %esi
+  8013e7:	5f                   	pop    %edi
+  8013e8:	5d                   	pop    %ebp
+  8013e9:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013ea:	83 ec 08             	sub    $0x8,%esp
+  8013ed:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013f0:	50                   	push   %eax
+  8013f1:	ff 36                	push   (%esi)
+  8013f3:	e8 59 ff ff ff       	call   801351 <dev_lookup>
+  8013f8:	89 c3                	mov    %eax,%ebx
+  8013fa:	83 c4 10             	add    $0x10,%esp
+  8013fd:	85 c0                	test   %eax,%eax
+  8013ff:	78 1a                	js     80141b <fd_close+0x77>
+		if (dev->dev_close)
+  801401:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801404:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801407:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80140c:	85 c0                	test   %eax,%eax
+  80140e:	74 0b                	je     80141b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801410:	83 ec 0c             	sub    $0xc,%esp
+  801413:	56                   	push   %esi
+  801414:	ff d0                	call   *%eax
+  801416:	89 c3                	mov    %eax,%ebx
+  801418:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80141b:	83 ec 08             	sub    $0x8,%esp
+  80141e:	56                   	push   %esi
+  80141f:	6a 00                	push   $0x0
+  801421:	e8 ea fa ff ff       	call   800f10 <sys_page_unmap>
+	return r;
+  801426:	83 c4 10             	add    $0x10,%esp
+  801429:	eb b5                	jmp    8013e0 <fd_close+0x3c>
+
+0080142b <close>:
+
+int
+close(int fdnum)
+{
+  80142b:	55                   	push   %ebp
+  80142c:	89 e5                	mov    %esp,%ebp
+  80142e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801431:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801434:	50                   	push   %eax
+  801435:	ff 75 08             	push   0x8(%ebp)
+  801438:	e8 c4 fe ff ff       	call   801301 <fd_lookup>
+  80143d:	83 c4 10             	add    $0x10,%esp
+  801440:	85 c0                	test   %eax,%eax
+  801442:	79 02                	jns    801446 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801444:	c9                   	leave
+  801445:	c3                   	ret
+		return fd_close(fd, 1);
+  801446:	83 ec 08             	sub    $0x8,%esp
+  801449:	6a 01                	push   $0x1
+  80144b:	ff 75 f4             	push   -0xc(%ebp)
+  80144e:	e8 51 ff ff ff       	call   8013a4 <fd_close>
+  801453:	83 c4 10             	add    $0x10,%esp
+  801456:	eb ec                	jmp    801444 <close+0x19>
+
+00801458 <close_all>:
+
+void
+close_all(void)
+{
+  801458:	55                   	push   %ebp
+  801459:	89 e5                	mov    %esp,%ebp
+  80145b:	53                   	push   %ebx
+  80145c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80145f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801464:	83 ec 0c             	sub    $0xc,%esp
+  801467:	53                   	push   %ebx
+  801468:	e8 be ff ff ff       	call   80142b <close>
+	for (i = 0; i < MAXFD; i++)
+  80146d:	83 c3 01             	add    $0x1,%ebx
+  801470:	83 c4 10             	add    $0x10,%esp
+  801473:	83 fb 20             	cmp    $0x20,%ebx
+  801476:	75 ec                	jne    801464 <close_all+0xc>
+}
+  801478:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80147b:	c9                   	leave
+  80147c:	c3                   	ret
+
+0080147d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80147d:	55                   	push   %ebp
+  80147e:	89 e5                	mov    %esp,%ebp
+  801480:	57                   	push   %edi
+  801481:	56                   	push   %esi
+  801482:	53                   	push   %ebx
+  801483:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801486:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801489:	50                   	push   %eax
+  80148a:	ff 75 08             	push   0x8(%ebp)
+  80148d:	e8 6f fe ff ff       	call   801301 <fd_lookup>
+  801492:	89 c3                	mov    %eax,%ebx
+  801494:	83 c4 10             	add    $0x10,%esp
+  801497:	85 c0                	test   %eax,%eax
+  801499:	78 7f                	js     80151a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80149b:	83 ec 0c             	sub    $0xc,%esp
+  80149e:	ff 75 0c             	push   0xc(%ebp)
+  8014a1:	e8 85 ff ff ff       	call   80142b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8014a6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014a9:	c1 e6 0c             	shl    $0xc,%esi
+  8014ac:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8014b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8014b5:	89 3c 24             	mov    %edi,(%esp)
+  8014b8:	e8 d7 fd ff ff       	call   801294 <fd2data>
+  8014bd:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8014bf:	89 34 24             	mov    %esi,(%esp)
+  8014c2:	e8 cd fd ff ff       	call   801294 <fd2data>
+  8014c7:	83 c4 10             	add    $0x10,%esp
+  8014ca:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8014cd:	89 d8                	mov    %ebx,%eax
+  8014cf:	c1 e8 16             	shr    $0x16,%eax
+  8014d2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014d9:	a8 01                	test   $0x1,%al
+  8014db:	74 11                	je     8014ee <dup+0x71>
+  8014dd:	89 d8                	mov    %ebx,%eax
+  8014df:	c1 e8 0c             	shr    $0xc,%eax
+  8014e2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014e9:	f6 c2 01             	test   $0x1,%dl
+  8014ec:	75 36                	jne    801524 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014ee:	89 f8                	mov    %edi,%eax
+  8014f0:	c1 e8 0c             	shr    $0xc,%eax
+  8014f3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014fa:	83 ec 0c             	sub    $0xc,%esp
+  8014fd:	25 07 0e 00 00       	and    $0xe07,%eax
+  801502:	50                   	push   %eax
+  801503:	56                   	push   %esi
+  801504:	6a 00                	push   $0x0
+  801506:	57                   	push   %edi
+  801507:	6a 00                	push   $0x0
+  801509:	e8 c0 f9 ff ff       	call   800ece <sys_page_map>
+  80150e:	89 c3                	mov    %eax,%ebx
+  801510:	83 c4 20             	add    $0x20,%esp
+  801513:	85 c0                	test   %eax,%eax
+  801515:	78 33                	js     80154a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801517:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80151a:	89 d8                	mov    %ebx,%eax
+  80151c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80151f:	5b                   	pop    %ebx
+  801520:	5e                   	pop    %esi
+  801521:	5f                   	pop    %edi
+  801522:	5d                   	pop    %ebp
+  801523:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801524:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80152b:	83 ec 0c             	sub    $0xc,%esp
+  80152e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801533:	50                   	push   %eax
+  801534:	ff 75 d4             	push   -0x2c(%ebp)
+  801537:	6a 00                	push   $0x0
+  801539:	53                   	push   %ebx
+  80153a:	6a 00                	push   $0x0
+  80153c:	e8 8d f9 ff ff       	call   800ece <sys_page_map>
+  801541:	89 c3                	mov    %eax,%ebx
+  801543:	83 c4 20             	add    $0x20,%esp
+  801546:	85 c0                	test   %eax,%eax
+  801548:	79 a4                	jns    8014ee <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80154a:	83 ec 08             	sub    $0x8,%esp
+  80154d:	56                   	push   %esi
+  80154e:	6a 00                	push   $0x0
+  801550:	e8 bb f9 ff ff       	call   800f10 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801555:	83 c4 08             	add    $0x8,%esp
+  801558:	ff 75 d4             	push   -0x2c(%ebp)
+  80155b:	6a 00                	push   $0x0
+  80155d:	e8 ae f9 ff ff       	call   800f10 <sys_page_unmap>
+	return r;
+  801562:	83 c4 10             	add    $0x10,%esp
+  801565:	eb b3                	jmp    80151a <dup+0x9d>
+
+00801567 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801567:	55                   	push   %ebp
+  801568:	89 e5                	mov    %esp,%ebp
+  80156a:	56                   	push   %esi
+  80156b:	53                   	push   %ebx
+  80156c:	83 ec 18             	sub    $0x18,%esp
+  80156f:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801572:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801575:	50                   	push   %eax
+  801576:	56                   	push   %esi
+  801577:	e8 85 fd ff ff       	call   801301 <fd_lookup>
+  80157c:	83 c4 10             	add    $0x10,%esp
+  80157f:	85 c0                	test   %eax,%eax
+  801581:	78 3c                	js     8015bf <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801583:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801586:	83 ec 08             	sub    $0x8,%esp
+  801589:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80158c:	50                   	push   %eax
+  80158d:	ff 33                	push   (%ebx)
+  80158f:	e8 bd fd ff ff       	call   801351 <dev_lookup>
+  801594:	83 c4 10             	add    $0x10,%esp
+  801597:	85 c0                	test   %eax,%eax
+  801599:	78 24                	js     8015bf <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80159b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80159e:	83 e0 03             	and    $0x3,%eax
+  8015a1:	83 f8 01             	cmp    $0x1,%eax
+  8015a4:	74 20                	je     8015c6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8015a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015a9:	8b 40 08             	mov    0x8(%eax),%eax
+  8015ac:	85 c0                	test   %eax,%eax
+  8015ae:	74 37                	je     8015e7 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8015b0:	83 ec 04             	sub    $0x4,%esp
+  8015b3:	ff 75 10             	push   0x10(%ebp)
+  8015b6:	ff 75 0c             	push   0xc(%ebp)
+  8015b9:	53                   	push   %ebx
+  8015ba:	ff d0                	call   *%eax
+  8015bc:	83 c4 10             	add    $0x10,%esp
+}
+  8015bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015c2:	5b                   	pop    %ebx
+  8015c3:	5e                   	pop    %esi
+  8015c4:	5d                   	pop    %ebp
+  8015c5:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015c6:	a1 00 60 80 00       	mov    0x806000,%eax
+  8015cb:	8b 40 48             	mov    0x48(%eax),%eax
+  8015ce:	83 ec 04             	sub    $0x4,%esp
+  8015d1:	56                   	push   %esi
+  8015d2:	50                   	push   %eax
+  8015d3:	68 45 3e 80 00       	push   $0x803e45
+  8015d8:	e8 bc ed ff ff       	call   800399 <cprintf>
+		return -E_INVAL;
+  8015dd:	83 c4 10             	add    $0x10,%esp
+  8015e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e5:	eb d8                	jmp    8015bf <read+0x58>
+		return -E_NOT_SUPP;
+  8015e7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015ec:	eb d1                	jmp    8015bf <read+0x58>
+
+008015ee <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015ee:	55                   	push   %ebp
+  8015ef:	89 e5                	mov    %esp,%ebp
+  8015f1:	57                   	push   %edi
+  8015f2:	56                   	push   %esi
+  8015f3:	53                   	push   %ebx
+  8015f4:	83 ec 0c             	sub    $0xc,%esp
+  8015f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015fa:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801602:	eb 02                	jmp    801606 <readn+0x18>
+  801604:	01 c3                	add    %eax,%ebx
+  801606:	39 f3                	cmp    %esi,%ebx
+  801608:	73 21                	jae    80162b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80160a:	83 ec 04             	sub    $0x4,%esp
+  80160d:	89 f0                	mov    %esi,%eax
+  80160f:	29 d8                	sub    %ebx,%eax
+  801611:	50                   	push   %eax
+  801612:	89 d8                	mov    %ebx,%eax
+  801614:	03 45 0c             	add    0xc(%ebp),%eax
+  801617:	50                   	push   %eax
+  801618:	57                   	push   %edi
+  801619:	e8 49 ff ff ff       	call   801567 <read>
+		if (m < 0)
+  80161e:	83 c4 10             	add    $0x10,%esp
+  801621:	85 c0                	test   %eax,%eax
+  801623:	78 04                	js     801629 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801625:	75 dd                	jne    801604 <readn+0x16>
+  801627:	eb 02                	jmp    80162b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801629:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80162b:	89 d8                	mov    %ebx,%eax
+  80162d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801630:	5b                   	pop    %ebx
+  801631:	5e                   	pop    %esi
+  801632:	5f                   	pop    %edi
+  801633:	5d                   	pop    %ebp
+  801634:	c3                   	ret
+
+00801635 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801635:	55                   	push   %ebp
+  801636:	89 e5                	mov    %esp,%ebp
+  801638:	56                   	push   %esi
+  801639:	53                   	push   %ebx
+  80163a:	83 ec 18             	sub    $0x18,%esp
+  80163d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801640:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801643:	50                   	push   %eax
+  801644:	53                   	push   %ebx
+  801645:	e8 b7 fc ff ff       	call   801301 <fd_lookup>
+  80164a:	83 c4 10             	add    $0x10,%esp
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	78 37                	js     801688 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801651:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801654:	83 ec 08             	sub    $0x8,%esp
+  801657:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80165a:	50                   	push   %eax
+  80165b:	ff 36                	push   (%esi)
+  80165d:	e8 ef fc ff ff       	call   801351 <dev_lookup>
+  801662:	83 c4 10             	add    $0x10,%esp
+  801665:	85 c0                	test   %eax,%eax
+  801667:	78 1f                	js     801688 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801669:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80166d:	74 20                	je     80168f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80166f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801672:	8b 40 0c             	mov    0xc(%eax),%eax
+  801675:	85 c0                	test   %eax,%eax
+  801677:	74 37                	je     8016b0 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801679:	83 ec 04             	sub    $0x4,%esp
+  80167c:	ff 75 10             	push   0x10(%ebp)
+  80167f:	ff 75 0c             	push   0xc(%ebp)
+  801682:	56                   	push   %esi
+  801683:	ff d0                	call   *%eax
+  801685:	83 c4 10             	add    $0x10,%esp
+}
+  801688:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80168b:	5b                   	pop    %ebx
+  80168c:	5e                   	pop    %esi
+  80168d:	5d                   	pop    %ebp
+  80168e:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80168f:	a1 00 60 80 00       	mov    0x806000,%eax
+  801694:	8b 40 48             	mov    0x48(%eax),%eax
+  801697:	83 ec 04             	sub    $0x4,%esp
+  80169a:	53                   	push   %ebx
+  80169b:	50                   	push   %eax
+  80169c:	68 61 3e 80 00       	push   $0x803e61
+  8016a1:	e8 f3 ec ff ff       	call   800399 <cprintf>
+		return -E_INVAL;
+  8016a6:	83 c4 10             	add    $0x10,%esp
+  8016a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ae:	eb d8                	jmp    801688 <write+0x53>
+		return -E_NOT_SUPP;
+  8016b0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016b5:	eb d1                	jmp    801688 <write+0x53>
+
+008016b7 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016b7:	55                   	push   %ebp
+  8016b8:	89 e5                	mov    %esp,%ebp
+  8016ba:	53                   	push   %ebx
+  8016bb:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016be:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016c1:	50                   	push   %eax
+  8016c2:	ff 75 08             	push   0x8(%ebp)
+  8016c5:	e8 37 fc ff ff       	call   801301 <fd_lookup>
+  8016ca:	83 c4 10             	add    $0x10,%esp
+  8016cd:	85 c0                	test   %eax,%eax
+  8016cf:	78 3a                	js     80170b <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016d1:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016d4:	83 ec 08             	sub    $0x8,%esp
+  8016d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016da:	50                   	push   %eax
+  8016db:	ff 33                	push   (%ebx)
+  8016dd:	e8 6f fc ff ff       	call   801351 <dev_lookup>
+  8016e2:	83 c4 10             	add    $0x10,%esp
+  8016e5:	85 c0                	test   %eax,%eax
+  8016e7:	78 22                	js     80170b <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8016e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ec:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8016ef:	85 c0                	test   %eax,%eax
+  8016f1:	74 0d                	je     801700 <seek+0x49>
+  8016f3:	83 ec 0c             	sub    $0xc,%esp
+  8016f6:	53                   	push   %ebx
+  8016f7:	ff d0                	call   *%eax
+  8016f9:	83 c4 10             	add    $0x10,%esp
+  8016fc:	85 c0                	test   %eax,%eax
+  8016fe:	78 0b                	js     80170b <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801700:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801703:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801706:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80170b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80170e:	c9                   	leave
+  80170f:	c3                   	ret
+
+00801710 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801710:	55                   	push   %ebp
+  801711:	89 e5                	mov    %esp,%ebp
+  801713:	53                   	push   %ebx
+  801714:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801717:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80171a:	50                   	push   %eax
+  80171b:	ff 75 08             	push   0x8(%ebp)
+  80171e:	e8 de fb ff ff       	call   801301 <fd_lookup>
+  801723:	83 c4 10             	add    $0x10,%esp
+  801726:	85 c0                	test   %eax,%eax
+  801728:	78 2b                	js     801755 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80172a:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80172d:	83 ec 08             	sub    $0x8,%esp
+  801730:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801733:	50                   	push   %eax
+  801734:	ff 33                	push   (%ebx)
+  801736:	e8 16 fc ff ff       	call   801351 <dev_lookup>
+  80173b:	83 c4 10             	add    $0x10,%esp
+  80173e:	85 c0                	test   %eax,%eax
+  801740:	78 13                	js     801755 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801742:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801745:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801748:	85 c0                	test   %eax,%eax
+  80174a:	74 0e                	je     80175a <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  80174c:	83 ec 0c             	sub    $0xc,%esp
+  80174f:	53                   	push   %ebx
+  801750:	ff d0                	call   *%eax
+  801752:	83 c4 10             	add    $0x10,%esp
+}
+  801755:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801758:	c9                   	leave
+  801759:	c3                   	ret
+		return 0;
+  80175a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175f:	eb f4                	jmp    801755 <fsync+0x45>
+
+00801761 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801761:	55                   	push   %ebp
+  801762:	89 e5                	mov    %esp,%ebp
+  801764:	56                   	push   %esi
+  801765:	53                   	push   %ebx
+  801766:	83 ec 18             	sub    $0x18,%esp
+  801769:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80176c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80176f:	50                   	push   %eax
+  801770:	53                   	push   %ebx
+  801771:	e8 8b fb ff ff       	call   801301 <fd_lookup>
+  801776:	83 c4 10             	add    $0x10,%esp
+  801779:	85 c0                	test   %eax,%eax
+  80177b:	78 34                	js     8017b1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80177d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801780:	83 ec 08             	sub    $0x8,%esp
+  801783:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801786:	50                   	push   %eax
+  801787:	ff 36                	push   (%esi)
+  801789:	e8 c3 fb ff ff       	call   801351 <dev_lookup>
+  80178e:	83 c4 10             	add    $0x10,%esp
+  801791:	85 c0                	test   %eax,%eax
+  801793:	78 1c                	js     8017b1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801795:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801799:	74 1d                	je     8017b8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80179b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80179e:	8b 40 18             	mov    0x18(%eax),%eax
+  8017a1:	85 c0                	test   %eax,%eax
+  8017a3:	74 34                	je     8017d9 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8017a5:	83 ec 08             	sub    $0x8,%esp
+  8017a8:	ff 75 0c             	push   0xc(%ebp)
+  8017ab:	56                   	push   %esi
+  8017ac:	ff d0                	call   *%eax
+  8017ae:	83 c4 10             	add    $0x10,%esp
+}
+  8017b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017b4:	5b                   	pop    %ebx
+  8017b5:	5e                   	pop    %esi
+  8017b6:	5d                   	pop    %ebp
+  8017b7:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8017b8:	a1 00 60 80 00       	mov    0x806000,%eax
+  8017bd:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017c0:	83 ec 04             	sub    $0x4,%esp
+  8017c3:	53                   	push   %ebx
+  8017c4:	50                   	push   %eax
+  8017c5:	68 24 3e 80 00       	push   $0x803e24
+  8017ca:	e8 ca eb ff ff       	call   800399 <cprintf>
+		return -E_INVAL;
+  8017cf:	83 c4 10             	add    $0x10,%esp
+  8017d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d7:	eb d8                	jmp    8017b1 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017d9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017de:	eb d1                	jmp    8017b1 <ftruncate+0x50>
+
+008017e0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017e0:	55                   	push   %ebp
+  8017e1:	89 e5                	mov    %esp,%ebp
+  8017e3:	56                   	push   %esi
+  8017e4:	53                   	push   %ebx
+  8017e5:	83 ec 18             	sub    $0x18,%esp
+  8017e8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017eb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017ee:	50                   	push   %eax
+  8017ef:	ff 75 08             	push   0x8(%ebp)
+  8017f2:	e8 0a fb ff ff       	call   801301 <fd_lookup>
+  8017f7:	83 c4 10             	add    $0x10,%esp
+  8017fa:	85 c0                	test   %eax,%eax
+  8017fc:	78 49                	js     801847 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017fe:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801801:	83 ec 08             	sub    $0x8,%esp
+  801804:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801807:	50                   	push   %eax
+  801808:	ff 36                	push   (%esi)
+  80180a:	e8 42 fb ff ff       	call   801351 <dev_lookup>
+  80180f:	83 c4 10             	add    $0x10,%esp
+  801812:	85 c0                	test   %eax,%eax
+  801814:	78 31                	js     801847 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801816:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801819:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80181d:	74 2f                	je     80184e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80181f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801822:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801829:	00 00 00 
+	stat->st_isdir = 0;
+  80182c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801833:	00 00 00 
+	stat->st_dev = dev;
+  801836:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80183c:	83 ec 08             	sub    $0x8,%esp
+  80183f:	53                   	push   %ebx
+  801840:	56                   	push   %esi
+  801841:	ff 50 14             	call   *0x14(%eax)
+  801844:	83 c4 10             	add    $0x10,%esp
+}
+  801847:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80184a:	5b                   	pop    %ebx
+  80184b:	5e                   	pop    %esi
+  80184c:	5d                   	pop    %ebp
+  80184d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80184e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801853:	eb f2                	jmp    801847 <fstat+0x67>
+
+00801855 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801855:	55                   	push   %ebp
+  801856:	89 e5                	mov    %esp,%ebp
+  801858:	56                   	push   %esi
+  801859:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  80185a:	83 ec 08             	sub    $0x8,%esp
+  80185d:	68 00 10 00 00       	push   $0x1000
+  801862:	ff 75 08             	push   0x8(%ebp)
+  801865:	e8 b3 07 00 00       	call   80201d <open>
+  80186a:	89 c3                	mov    %eax,%ebx
+  80186c:	83 c4 10             	add    $0x10,%esp
+  80186f:	85 c0                	test   %eax,%eax
+  801871:	78 1b                	js     80188e <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801873:	83 ec 08             	sub    $0x8,%esp
+  801876:	ff 75 0c             	push   0xc(%ebp)
+  801879:	50                   	push   %eax
+  80187a:	e8 61 ff ff ff       	call   8017e0 <fstat>
+  80187f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801881:	89 1c 24             	mov    %ebx,(%esp)
+  801884:	e8 a2 fb ff ff       	call   80142b <close>
+	return r;
+  801889:	83 c4 10             	add    $0x10,%esp
+  80188c:	89 f3                	mov    %esi,%ebx
+}
+  80188e:	89 d8                	mov    %ebx,%eax
+  801890:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801893:	5b                   	pop    %ebx
+  801894:	5e                   	pop    %esi
+  801895:	5d                   	pop    %ebp
+  801896:	c3                   	ret
+
+00801897 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801897:	55                   	push   %ebp
+  801898:	89 e5                	mov    %esp,%ebp
+  80189a:	57                   	push   %edi
+  80189b:	56                   	push   %esi
+  80189c:	53                   	push   %ebx
+  80189d:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  8018a3:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  8018a9:	89 d6                	mov    %edx,%esi
+  8018ab:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  8018b1:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  8018b4:	89 d3                	mov    %edx,%ebx
+  8018b6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  8018bc:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  8018c3:	74 1d                	je     8018e2 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8018c5:	b8 00 70 80 00       	mov    $0x807000,%eax
+  8018ca:	83 c8 07             	or     $0x7,%eax
+  8018cd:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  8018d3:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8018d8:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  8018de:	01 ce                	add    %ecx,%esi
+  8018e0:	eb 28                	jmp    80190a <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018e2:	83 ec 0c             	sub    $0xc,%esp
+  8018e5:	6a 01                	push   $0x1
+  8018e7:	e8 ac 1d 00 00       	call   803698 <ipc_find_env>
+  8018ec:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  8018f1:	83 c4 10             	add    $0x10,%esp
+  8018f4:	eb cf                	jmp    8018c5 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  8018f6:	83 c0 01             	add    $0x1,%eax
+  8018f9:	89 fa                	mov    %edi,%edx
+  8018fb:	09 da                	or     %ebx,%edx
+  8018fd:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801904:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80190a:	39 f3                	cmp    %esi,%ebx
+  80190c:	72 e8                	jb     8018f6 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  80190e:	83 f8 41             	cmp    $0x41,%eax
+  801911:	77 2f                	ja     801942 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801913:	50                   	push   %eax
+  801914:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  80191a:	50                   	push   %eax
+  80191b:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801921:	ff 35 c8 80 80 00    	push   0x8080c8
+  801927:	e8 1e 1d 00 00       	call   80364a <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  80192c:	83 c4 0c             	add    $0xc,%esp
+  80192f:	6a 00                	push   $0x0
+  801931:	6a 00                	push   $0x0
+  801933:	6a 00                	push   $0x0
+  801935:	e8 ba 1b 00 00       	call   8034f4 <ipc_recv>
+}
+  80193a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80193d:	5b                   	pop    %ebx
+  80193e:	5e                   	pop    %esi
+  80193f:	5f                   	pop    %edi
+  801940:	5d                   	pop    %ebp
+  801941:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801942:	68 94 3e 80 00       	push   $0x803e94
+  801947:	68 b0 3e 80 00       	push   $0x803eb0
+  80194c:	6a 40                	push   $0x40
+  80194e:	68 c5 3e 80 00       	push   $0x803ec5
+  801953:	e8 66 e9 ff ff       	call   8002be <_panic>
+
+00801958 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801958:	55                   	push   %ebp
+  801959:	89 e5                	mov    %esp,%ebp
+  80195b:	57                   	push   %edi
+  80195c:	56                   	push   %esi
+  80195d:	53                   	push   %ebx
+  80195e:	83 ec 1c             	sub    $0x1c,%esp
+  801961:	89 c3                	mov    %eax,%ebx
+  801963:	89 d6                	mov    %edx,%esi
+  801965:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801968:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  80196e:	89 ca                	mov    %ecx,%edx
+  801970:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801973:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  80197a:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80197d:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801984:	8b 76 0c             	mov    0xc(%esi),%esi
+  801987:	89 fb                	mov    %edi,%ebx
+  801989:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801990:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801993:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  80199a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80199d:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  8019a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019a7:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  8019ae:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  8019b1:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  8019b8:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  8019bd:	39 c8                	cmp    %ecx,%eax
+  8019bf:	74 0d                	je     8019ce <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  8019c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019c9:	5b                   	pop    %ebx
+  8019ca:	5e                   	pop    %esi
+  8019cb:	5f                   	pop    %edi
+  8019cc:	5d                   	pop    %ebp
+  8019cd:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8019ce:	6a 07                	push   $0x7
+  8019d0:	68 00 70 80 00       	push   $0x807000
+  8019d5:	6a 0d                	push   $0xd
+  8019d7:	ff 35 c8 80 80 00    	push   0x8080c8
+  8019dd:	e8 7d 1b 00 00       	call   80355f <ipc_send>
+  8019e2:	83 c4 10             	add    $0x10,%esp
+  8019e5:	eb da                	jmp    8019c1 <fsring_post+0x69>
+
+008019e7 <fsipcv>:
+{
+  8019e7:	55                   	push   %ebp
+  8019e8:	89 e5                	mov    %esp,%ebp
+  8019ea:	57                   	push   %edi
+  8019eb:	56                   	push   %esi
+  8019ec:	53                   	push   %ebx
+  8019ed:	83 ec 0c             	sub    $0xc,%esp
+  8019f0:	89 c7                	mov    %eax,%edi
+  8019f2:	89 d3                	mov    %edx,%ebx
+  8019f4:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  8019f6:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  8019fd:	74 26                	je     801a25 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8019ff:	6a 07                	push   $0x7
+  801a01:	68 00 70 80 00       	push   $0x807000
+  801a06:	57                   	push   %edi
+  801a07:	ff 35 c8 80 80 00    	push   0x8080c8
+  801a0d:	e8 4d 1b 00 00       	call   80355f <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801a12:	6a 00                	push   $0x0
+  801a14:	56                   	push   %esi
+  801a15:	53                   	push   %ebx
+  801a16:	6a 00                	push   $0x0
+  801a18:	e8 9a 1b 00 00       	call   8035b7 <ipc_recvv>
+}
+  801a1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a20:	5b                   	pop    %ebx
+  801a21:	5e                   	pop    %esi
+  801a22:	5f                   	pop    %edi
+  801a23:	5d                   	pop    %ebp
+  801a24:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a25:	83 ec 0c             	sub    $0xc,%esp
+  801a28:	6a 01                	push   $0x1
+  801a2a:	e8 69 1c 00 00       	call   803698 <ipc_find_env>
+  801a2f:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801a34:	83 c4 10             	add    $0x10,%esp
+  801a37:	eb c6                	jmp    8019ff <fsipcv+0x18>
+
+00801a39 <fsipc>:
+{
+  801a39:	55                   	push   %ebp
+  801a3a:	89 e5                	mov    %esp,%ebp
+  801a3c:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801a3f:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801a46:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801a49:	e8 99 ff ff ff       	call   8019e7 <fsipcv>
+}
+  801a4e:	c9                   	leave
+  801a4f:	c3                   	ret
+
+00801a50 <file_write_direct>:
+{
+  801a50:	55                   	push   %ebp
+  801a51:	89 e5                	mov    %esp,%ebp
+  801a53:	56                   	push   %esi
+  801a54:	53                   	push   %ebx
+  801a55:	89 c3                	mov    %eax,%ebx
+  801a57:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801a59:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801a5f:	77 40                	ja     801aa1 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801a61:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801a66:	39 c8                	cmp    %ecx,%eax
+  801a68:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a6b:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801a6e:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  801a74:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801a79:	83 ec 04             	sub    $0x4,%esp
+  801a7c:	50                   	push   %eax
+  801a7d:	52                   	push   %edx
+  801a7e:	68 08 70 80 00       	push   $0x807008
+  801a83:	e8 75 f1 ff ff       	call   800bfd <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801a88:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a8d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a92:	e8 a2 ff ff ff       	call   801a39 <fsipc>
+  801a97:	83 c4 10             	add    $0x10,%esp
+}
+  801a9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a9d:	5b                   	pop    %ebx
+  801a9e:	5e                   	pop    %esi
+  801a9f:	5d                   	pop    %ebp
+  801aa0:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801aa1:	89 d6                	mov    %edx,%esi
+  801aa3:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801aa9:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801aae:	29 f1                	sub    %esi,%ecx
+  801ab0:	39 c1                	cmp    %eax,%ecx
+  801ab2:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801ab5:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801ab8:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801abd:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801ac3:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801ac9:	83 ec 0c             	sub    $0xc,%esp
+  801acc:	6a 05                	push   $0x5
+  801ace:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801ad3:	e8 bf fd ff ff       	call   801897 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801ad8:	83 c4 10             	add    $0x10,%esp
+  801adb:	eb bd                	jmp    801a9a <file_write_direct+0x4a>
+
+00801add <devfile_sync>:
+{
+  801add:	55                   	push   %ebp
+  801ade:	89 e5                	mov    %esp,%ebp
+  801ae0:	57                   	push   %edi
+  801ae1:	56                   	push   %esi
+  801ae2:	53                   	push   %ebx
+  801ae3:	83 ec 28             	sub    $0x28,%esp
+  801ae6:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801ae9:	56                   	push   %esi
+  801aea:	e8 a5 f7 ff ff       	call   801294 <fd2data>
+  801aef:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801af1:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801af4:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801afb:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801afe:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801b03:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801b07:	74 45                	je     801b4e <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801b09:	8b 46 14             	mov    0x14(%esi),%eax
+  801b0c:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b14:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b19:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801b1c:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801b1f:	39 cb                	cmp    %ecx,%ebx
+  801b21:	73 14                	jae    801b37 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801b23:	29 d9                	sub    %ebx,%ecx
+  801b25:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801b28:	89 f0                	mov    %esi,%eax
+  801b2a:	e8 21 ff ff ff       	call   801a50 <file_write_direct>
+  801b2f:	85 c0                	test   %eax,%eax
+  801b31:	7e 04                	jle    801b37 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801b33:	01 c3                	add    %eax,%ebx
+  801b35:	eb e5                	jmp    801b1c <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801b37:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801b3a:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801b41:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801b44:	85 c0                	test   %eax,%eax
+  801b46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b4b:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801b4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b51:	5b                   	pop    %ebx
+  801b52:	5e                   	pop    %esi
+  801b53:	5f                   	pop    %edi
+  801b54:	5d                   	pop    %ebp
+  801b55:	c3                   	ret
+
+00801b56 <devfile_write>:
+{
+  801b56:	55                   	push   %ebp
+  801b57:	89 e5                	mov    %esp,%ebp
+  801b59:	57                   	push   %edi
+  801b5a:	56                   	push   %esi
+  801b5b:	53                   	push   %ebx
+  801b5c:	83 ec 28             	sub    $0x28,%esp
+  801b5f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801b62:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801b65:	53                   	push   %ebx
+  801b66:	e8 29 f7 ff ff       	call   801294 <fd2data>
+  801b6b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801b6e:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801b71:	83 c4 10             	add    $0x10,%esp
+  801b74:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801b78:	74 43                	je     801bbd <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801b7a:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801b81:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801b84:	85 c0                	test   %eax,%eax
+  801b86:	74 43                	je     801bcb <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801b88:	89 c2                	mov    %eax,%edx
+  801b8a:	03 53 14             	add    0x14(%ebx),%edx
+  801b8d:	39 fa                	cmp    %edi,%edx
+  801b8f:	75 0b                	jne    801b9c <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801b91:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801b94:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801b9a:	76 66                	jbe    801c02 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801b9c:	83 ec 0c             	sub    $0xc,%esp
+  801b9f:	53                   	push   %ebx
+  801ba0:	e8 38 ff ff ff       	call   801add <devfile_sync>
+  801ba5:	83 c4 10             	add    $0x10,%esp
+  801ba8:	85 c0                	test   %eax,%eax
+  801baa:	78 4e                	js     801bfa <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801bac:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801bb2:	77 56                	ja     801c0a <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801bb4:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801bb7:	85 c0                	test   %eax,%eax
+  801bb9:	75 20                	jne    801bdb <devfile_write+0x85>
+  801bbb:	eb 16                	jmp    801bd3 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801bbd:	89 f1                	mov    %esi,%ecx
+  801bbf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bc2:	89 d8                	mov    %ebx,%eax
+  801bc4:	e8 87 fe ff ff       	call   801a50 <file_write_direct>
+  801bc9:	eb 2f                	jmp    801bfa <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801bcb:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801bd1:	77 37                	ja     801c0a <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801bd3:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801bdb:	83 ec 04             	sub    $0x4,%esp
+  801bde:	56                   	push   %esi
+  801bdf:	ff 75 0c             	push   0xc(%ebp)
+  801be2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801be5:	01 c1                	add    %eax,%ecx
+  801be7:	51                   	push   %ecx
+  801be8:	e8 10 f0 ff ff       	call   800bfd <memmove>
+	ff->buf_wlen += n;
+  801bed:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801bf0:	01 f7                	add    %esi,%edi
+  801bf2:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801bf5:	89 f0                	mov    %esi,%eax
+  801bf7:	83 c4 10             	add    $0x10,%esp
+}
+  801bfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bfd:	5b                   	pop    %ebx
+  801bfe:	5e                   	pop    %esi
+  801bff:	5f                   	pop    %edi
+  801c00:	5d                   	pop    %ebp
+  801c01:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801c02:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801c08:	76 d1                	jbe    801bdb <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801c0a:	89 f1                	mov    %esi,%ecx
+  801c0c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c0f:	89 d8                	mov    %ebx,%eax
+  801c11:	e8 3a fe ff ff       	call   801a50 <file_write_direct>
+  801c16:	eb e2                	jmp    801bfa <devfile_write+0xa4>
+
+00801c18 <devfile_trunc>:
+{
+  801c18:	55                   	push   %ebp
+  801c19:	89 e5                	mov    %esp,%ebp
+  801c1b:	53                   	push   %ebx
+  801c1c:	83 ec 10             	sub    $0x10,%esp
+  801c1f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801c22:	53                   	push   %ebx
+  801c23:	e8 b5 fe ff ff       	call   801add <devfile_sync>
+  801c28:	83 c4 10             	add    $0x10,%esp
+  801c2b:	85 c0                	test   %eax,%eax
+  801c2d:	78 1f                	js     801c4e <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801c2f:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c32:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801c37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c3a:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801c3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c44:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c49:	e8 eb fd ff ff       	call   801a39 <fsipc>
+}
+  801c4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c51:	c9                   	leave
+  801c52:	c3                   	ret
+
+00801c53 <devfile_stat>:
+{
+  801c53:	55                   	push   %ebp
+  801c54:	89 e5                	mov    %esp,%ebp
+  801c56:	56                   	push   %esi
+  801c57:	53                   	push   %ebx
+  801c58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c5b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801c5e:	83 ec 0c             	sub    $0xc,%esp
+  801c61:	53                   	push   %ebx
+  801c62:	e8 76 fe ff ff       	call   801add <devfile_sync>
+  801c67:	83 c4 10             	add    $0x10,%esp
+  801c6a:	85 c0                	test   %eax,%eax
+  801c6c:	78 47                	js     801cb5 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801c6e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c71:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801c76:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c80:	e8 b4 fd ff ff       	call   801a39 <fsipc>
+  801c85:	85 c0                	test   %eax,%eax
+  801c87:	78 2c                	js     801cb5 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c89:	83 ec 08             	sub    $0x8,%esp
+  801c8c:	68 00 70 80 00       	push   $0x807000
+  801c91:	56                   	push   %esi
+  801c92:	e8 e0 ed ff ff       	call   800a77 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801c97:	a1 80 70 80 00       	mov    0x807080,%eax
+  801c9c:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ca2:	a1 84 70 80 00       	mov    0x807084,%eax
+  801ca7:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801cad:	83 c4 10             	add    $0x10,%esp
+  801cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cb5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cb8:	5b                   	pop    %ebx
+  801cb9:	5e                   	pop    %esi
+  801cba:	5d                   	pop    %ebp
+  801cbb:	c3                   	ret
+
+00801cbc <devfile_flush>:
+{
+  801cbc:	55                   	push   %ebp
+  801cbd:	89 e5                	mov    %esp,%ebp
+  801cbf:	56                   	push   %esi
+  801cc0:	53                   	push   %ebx
+  801cc1:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801cc4:	83 ec 0c             	sub    $0xc,%esp
+  801cc7:	56                   	push   %esi
+  801cc8:	e8 10 fe ff ff       	call   801add <devfile_sync>
+  801ccd:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801ccf:	83 c4 10             	add    $0x10,%esp
+  801cd2:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801cd6:	75 25                	jne    801cfd <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801cd8:	8b 46 0c             	mov    0xc(%esi),%eax
+  801cdb:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801ce0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce5:	b8 06 00 00 00       	mov    $0x6,%eax
+  801cea:	e8 4a fd ff ff       	call   801a39 <fsipc>
+  801cef:	85 c0                	test   %eax,%eax
+  801cf1:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801cf4:	89 d8                	mov    %ebx,%eax
+  801cf6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf9:	5b                   	pop    %ebx
+  801cfa:	5e                   	pop    %esi
+  801cfb:	5d                   	pop    %ebp
+  801cfc:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801cfd:	83 ec 0c             	sub    $0xc,%esp
+  801d00:	56                   	push   %esi
+  801d01:	e8 8e f5 ff ff       	call   801294 <fd2data>
+  801d06:	83 c4 08             	add    $0x8,%esp
+  801d09:	50                   	push   %eax
+  801d0a:	6a 00                	push   $0x0
+  801d0c:	e8 ff f1 ff ff       	call   800f10 <sys_page_unmap>
+  801d11:	83 c4 10             	add    $0x10,%esp
+  801d14:	eb c2                	jmp    801cd8 <devfile_flush+0x1c>
+
+00801d16 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801d16:	55                   	push   %ebp
+  801d17:	89 e5                	mov    %esp,%ebp
+  801d19:	57                   	push   %edi
+  801d1a:	56                   	push   %esi
+  801d1b:	53                   	push   %ebx
+  801d1c:	83 ec 64             	sub    $0x64,%esp
+  801d1f:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801d21:	52                   	push   %edx
+  801d22:	50                   	push   %eax
+  801d23:	e8 d9 f5 ff ff       	call   801301 <fd_lookup>
+  801d28:	89 c1                	mov    %eax,%ecx
+  801d2a:	83 c4 10             	add    $0x10,%esp
+  801d2d:	85 c0                	test   %eax,%eax
+  801d2f:	0f 88 f2 00 00 00    	js     801e27 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801d35:	8b 07                	mov    (%edi),%eax
+  801d37:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801d3d:	39 10                	cmp    %edx,(%eax)
+  801d3f:	0f 85 03 01 00 00    	jne    801e48 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801d45:	a1 00 60 80 00       	mov    0x806000,%eax
+  801d4a:	8b 40 48             	mov    0x48(%eax),%eax
+  801d4d:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  801d53:	0f 84 96 00 00 00    	je     801def <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801d59:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801d60:	0f 84 cb 00 00 00    	je     801e31 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801d66:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801d6b:	83 c8 07             	or     $0x7,%eax
+  801d6e:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801d71:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801d74:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801d79:	83 ec 04             	sub    $0x4,%esp
+  801d7c:	68 07 04 00 00       	push   $0x407
+  801d81:	53                   	push   %ebx
+  801d82:	6a 00                	push   $0x0
+  801d84:	e8 fa f0 ff ff       	call   800e83 <sys_page_alloc>
+  801d89:	89 c1                	mov    %eax,%ecx
+  801d8b:	83 c4 10             	add    $0x10,%esp
+  801d8e:	85 c0                	test   %eax,%eax
+  801d90:	0f 88 91 00 00 00    	js     801e27 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801d96:	89 d8                	mov    %ebx,%eax
+  801d98:	83 c8 07             	or     $0x7,%eax
+  801d9b:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801d9d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801da3:	83 c6 04             	add    $0x4,%esi
+  801da6:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801dac:	75 cb                	jne    801d79 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801dae:	6a 12                	push   $0x12
+  801db0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801db3:	50                   	push   %eax
+  801db4:	6a 0c                	push   $0xc
+  801db6:	ff 35 c8 80 80 00    	push   0x8080c8
+  801dbc:	e8 89 18 00 00       	call   80364a <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801dc1:	83 c4 0c             	add    $0xc,%esp
+  801dc4:	6a 00                	push   $0x0
+  801dc6:	6a 00                	push   $0x0
+  801dc8:	6a 00                	push   $0x0
+  801dca:	e8 25 17 00 00       	call   8034f4 <ipc_recv>
+  801dcf:	89 c1                	mov    %eax,%ecx
+  801dd1:	83 c4 10             	add    $0x10,%esp
+  801dd4:	85 c0                	test   %eax,%eax
+  801dd6:	78 4f                	js     801e27 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801dd8:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ddd:	8b 40 48             	mov    0x48(%eax),%eax
+  801de0:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  801de5:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  801dec:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801def:	83 ec 0c             	sub    $0xc,%esp
+  801df2:	ff 37                	push   (%edi)
+  801df4:	e8 e4 fc ff ff       	call   801add <devfile_sync>
+  801df9:	89 c1                	mov    %eax,%ecx
+  801dfb:	83 c4 10             	add    $0x10,%esp
+  801dfe:	85 c0                	test   %eax,%eax
+  801e00:	78 25                	js     801e27 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801e02:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801e08:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801e0d:	ba 01 00 00 00       	mov    $0x1,%edx
+  801e12:	89 d0                	mov    %edx,%eax
+  801e14:	d3 e0                	shl    %cl,%eax
+  801e16:	85 d8                	test   %ebx,%eax
+  801e18:	74 0d                	je     801e27 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801e1a:	83 c1 01             	add    $0x1,%ecx
+  801e1d:	83 f9 10             	cmp    $0x10,%ecx
+  801e20:	75 f0                	jne    801e12 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801e22:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801e27:	89 c8                	mov    %ecx,%eax
+  801e29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e2c:	5b                   	pop    %ebx
+  801e2d:	5e                   	pop    %esi
+  801e2e:	5f                   	pop    %edi
+  801e2f:	5d                   	pop    %ebp
+  801e30:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e31:	83 ec 0c             	sub    $0xc,%esp
+  801e34:	6a 01                	push   $0x1
+  801e36:	e8 5d 18 00 00       	call   803698 <ipc_find_env>
+  801e3b:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801e40:	83 c4 10             	add    $0x10,%esp
+  801e43:	e9 1e ff ff ff       	jmp    801d66 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801e48:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801e4d:	eb d8                	jmp    801e27 <fsring_slot+0x111>
+
+00801e4f <file_read_direct>:
+{
+  801e4f:	55                   	push   %ebp
+  801e50:	89 e5                	mov    %esp,%ebp
+  801e52:	57                   	push   %edi
+  801e53:	56                   	push   %esi
+  801e54:	53                   	push   %ebx
+  801e55:	83 ec 1c             	sub    $0x1c,%esp
+  801e58:	89 c7                	mov    %eax,%edi
+  801e5a:	89 d6                	mov    %edx,%esi
+  801e5c:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801e5e:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801e64:	77 52                	ja     801eb8 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801e66:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e69:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801e6e:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801e74:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e79:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e7e:	e8 b6 fb ff ff       	call   801a39 <fsipc>
+  801e83:	89 c7                	mov    %eax,%edi
+  801e85:	85 c0                	test   %eax,%eax
+  801e87:	78 25                	js     801eae <file_read_direct+0x5f>
+	assert(r <= n);
+  801e89:	39 c3                	cmp    %eax,%ebx
+  801e8b:	0f 82 87 00 00 00    	jb     801f18 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801e91:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e96:	0f 8f 95 00 00 00    	jg     801f31 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e9c:	83 ec 04             	sub    $0x4,%esp
+  801e9f:	50                   	push   %eax
+  801ea0:	68 00 70 80 00       	push   $0x807000
+  801ea5:	56                   	push   %esi
+  801ea6:	e8 52 ed ff ff       	call   800bfd <memmove>
+	return r;
+  801eab:	83 c4 10             	add    $0x10,%esp
+}
+  801eae:	89 f8                	mov    %edi,%eax
+  801eb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eb3:	5b                   	pop    %ebx
+  801eb4:	5e                   	pop    %esi
+  801eb5:	5f                   	pop    %edi
+  801eb6:	5d                   	pop    %ebp
+  801eb7:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801eb8:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801ebe:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801ec3:	29 d1                	sub    %edx,%ecx
+  801ec5:	39 d9                	cmp    %ebx,%ecx
+  801ec7:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801eca:	89 f0                	mov    %esi,%eax
+  801ecc:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801ecf:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801ed2:	eb 0f                	jmp    801ee3 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801ed4:	0f b6 10             	movzbl (%eax),%edx
+  801ed7:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801ed9:	05 00 10 00 00       	add    $0x1000,%eax
+  801ede:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ee3:	39 c8                	cmp    %ecx,%eax
+  801ee5:	72 ed                	jb     801ed4 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801ee7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801eea:	8b 47 0c             	mov    0xc(%edi),%eax
+  801eed:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801ef2:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801ef8:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801efe:	83 ec 0c             	sub    $0xc,%esp
+  801f01:	6a 07                	push   $0x7
+  801f03:	89 d9                	mov    %ebx,%ecx
+  801f05:	89 f2                	mov    %esi,%edx
+  801f07:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f0c:	e8 86 f9 ff ff       	call   801897 <fsipc_pages>
+  801f11:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801f13:	83 c4 10             	add    $0x10,%esp
+  801f16:	eb 96                	jmp    801eae <file_read_direct+0x5f>
+	assert(r <= n);
+  801f18:	68 d0 3e 80 00       	push   $0x803ed0
+  801f1d:	68 b0 3e 80 00       	push   $0x803eb0
+  801f22:	68 dc 00 00 00       	push   $0xdc
+  801f27:	68 c5 3e 80 00       	push   $0x803ec5
+  801f2c:	e8 8d e3 ff ff       	call   8002be <_panic>
+	assert(r <= PGSIZE);
+  801f31:	68 e1 3e 80 00       	push   $0x803ee1
+  801f36:	68 b0 3e 80 00       	push   $0x803eb0
+  801f3b:	68 dd 00 00 00       	push   $0xdd
+  801f40:	68 c5 3e 80 00       	push   $0x803ec5
+  801f45:	e8 74 e3 ff ff       	call   8002be <_panic>
+
+00801f4a <devfile_read>:
+{
+  801f4a:	55                   	push   %ebp
+  801f4b:	89 e5                	mov    %esp,%ebp
+  801f4d:	57                   	push   %edi
+  801f4e:	56                   	push   %esi
+  801f4f:	53                   	push   %ebx
+  801f50:	83 ec 28             	sub    $0x28,%esp
+  801f53:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f56:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801f59:	53                   	push   %ebx
+  801f5a:	e8 35 f3 ff ff       	call   801294 <fd2data>
+  801f5f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801f62:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801f65:	83 c4 10             	add    $0x10,%esp
+  801f68:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801f6c:	74 7d                	je     801feb <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801f6e:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801f72:	0f 85 81 00 00 00    	jne    801ff9 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801f78:	8b 43 18             	mov    0x18(%ebx),%eax
+  801f7b:	85 c0                	test   %eax,%eax
+  801f7d:	74 0d                	je     801f8c <devfile_read+0x42>
+  801f7f:	8b 53 14             	mov    0x14(%ebx),%edx
+  801f82:	39 fa                	cmp    %edi,%edx
+  801f84:	7f 06                	jg     801f8c <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801f86:	01 c2                	add    %eax,%edx
+  801f88:	39 d7                	cmp    %edx,%edi
+  801f8a:	72 28                	jb     801fb4 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801f8c:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801f93:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801f99:	77 74                	ja     80200f <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801f9b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801fa0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fa3:	89 d8                	mov    %ebx,%eax
+  801fa5:	e8 a5 fe ff ff       	call   801e4f <file_read_direct>
+  801faa:	85 c0                	test   %eax,%eax
+  801fac:	7e 35                	jle    801fe3 <devfile_read+0x99>
+		ff->buf_base = pos;
+  801fae:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801fb1:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801fb4:	8b 53 14             	mov    0x14(%ebx),%edx
+  801fb7:	89 d0                	mov    %edx,%eax
+  801fb9:	03 43 18             	add    0x18(%ebx),%eax
+  801fbc:	29 f8                	sub    %edi,%eax
+  801fbe:	39 f0                	cmp    %esi,%eax
+  801fc0:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801fc3:	83 ec 04             	sub    $0x4,%esp
+  801fc6:	56                   	push   %esi
+  801fc7:	89 f8                	mov    %edi,%eax
+  801fc9:	29 d0                	sub    %edx,%eax
+  801fcb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801fce:	01 c1                	add    %eax,%ecx
+  801fd0:	51                   	push   %ecx
+  801fd1:	ff 75 0c             	push   0xc(%ebp)
+  801fd4:	e8 24 ec ff ff       	call   800bfd <memmove>
+	fd->fd_offset = pos + n;
+  801fd9:	01 f7                	add    %esi,%edi
+  801fdb:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801fde:	89 f0                	mov    %esi,%eax
+  801fe0:	83 c4 10             	add    $0x10,%esp
+}
+  801fe3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fe6:	5b                   	pop    %ebx
+  801fe7:	5e                   	pop    %esi
+  801fe8:	5f                   	pop    %edi
+  801fe9:	5d                   	pop    %ebp
+  801fea:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801feb:	89 f1                	mov    %esi,%ecx
+  801fed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ff0:	89 d8                	mov    %ebx,%eax
+  801ff2:	e8 58 fe ff ff       	call   801e4f <file_read_direct>
+  801ff7:	eb ea                	jmp    801fe3 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801ff9:	83 ec 0c             	sub    $0xc,%esp
+  801ffc:	53                   	push   %ebx
+  801ffd:	e8 db fa ff ff       	call   801add <devfile_sync>
+  802002:	83 c4 10             	add    $0x10,%esp
+  802005:	85 c0                	test   %eax,%eax
+  802007:	0f 89 6b ff ff ff    	jns    801f78 <devfile_read+0x2e>
+  80200d:	eb d4                	jmp    801fe3 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  80200f:	89 f1                	mov    %esi,%ecx
+  802011:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802014:	89 d8                	mov    %ebx,%eax
+  802016:	e8 34 fe ff ff       	call   801e4f <file_read_direct>
+  80201b:	eb c6                	jmp    801fe3 <devfile_read+0x99>
+
+0080201d <open>:
+{
+  80201d:	55                   	push   %ebp
+  80201e:	89 e5                	mov    %esp,%ebp
+  802020:	56                   	push   %esi
+  802021:	53                   	push   %ebx
+  802022:	83 ec 1c             	sub    $0x1c,%esp
+  802025:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802028:	56                   	push   %esi
+  802029:	e8 0e ea ff ff       	call   800a3c <strlen>
+  80202e:	83 c4 10             	add    $0x10,%esp
+  802031:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802036:	0f 8f a0 00 00 00    	jg     8020dc <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  80203c:	83 ec 0c             	sub    $0xc,%esp
+  80203f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802042:	50                   	push   %eax
+  802043:	e8 63 f2 ff ff       	call   8012ab <fd_alloc>
+  802048:	89 c3                	mov    %eax,%ebx
+  80204a:	83 c4 10             	add    $0x10,%esp
+  80204d:	85 c0                	test   %eax,%eax
+  80204f:	78 45                	js     802096 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  802051:	83 ec 08             	sub    $0x8,%esp
+  802054:	56                   	push   %esi
+  802055:	68 00 70 80 00       	push   $0x807000
+  80205a:	e8 18 ea ff ff       	call   800a77 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80205f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802062:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802067:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80206a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80206f:	e8 c5 f9 ff ff       	call   801a39 <fsipc>
+  802074:	89 c3                	mov    %eax,%ebx
+  802076:	83 c4 10             	add    $0x10,%esp
+  802079:	85 c0                	test   %eax,%eax
+  80207b:	78 22                	js     80209f <open+0x82>
+	if (!(mode & O_NOBUF)
+  80207d:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  802084:	74 2b                	je     8020b1 <open+0x94>
+	return fd2num(fd);
+  802086:	83 ec 0c             	sub    $0xc,%esp
+  802089:	ff 75 f4             	push   -0xc(%ebp)
+  80208c:	e8 f3 f1 ff ff       	call   801284 <fd2num>
+  802091:	89 c3                	mov    %eax,%ebx
+  802093:	83 c4 10             	add    $0x10,%esp
+}
+  802096:	89 d8                	mov    %ebx,%eax
+  802098:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80209b:	5b                   	pop    %ebx
+  80209c:	5e                   	pop    %esi
+  80209d:	5d                   	pop    %ebp
+  80209e:	c3                   	ret
+		fd_close(fd, 0);
+  80209f:	83 ec 08             	sub    $0x8,%esp
+  8020a2:	6a 00                	push   $0x0
+  8020a4:	ff 75 f4             	push   -0xc(%ebp)
+  8020a7:	e8 f8 f2 ff ff       	call   8013a4 <fd_close>
+		return r;
+  8020ac:	83 c4 10             	add    $0x10,%esp
+  8020af:	eb e5                	jmp    802096 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8020b1:	83 ec 0c             	sub    $0xc,%esp
+  8020b4:	ff 75 f4             	push   -0xc(%ebp)
+  8020b7:	e8 d8 f1 ff ff       	call   801294 <fd2data>
+  8020bc:	83 c4 0c             	add    $0xc,%esp
+  8020bf:	68 07 04 00 00       	push   $0x407
+  8020c4:	50                   	push   %eax
+  8020c5:	6a 00                	push   $0x0
+  8020c7:	e8 b7 ed ff ff       	call   800e83 <sys_page_alloc>
+  8020cc:	83 c4 10             	add    $0x10,%esp
+  8020cf:	85 c0                	test   %eax,%eax
+  8020d1:	75 b3                	jne    802086 <open+0x69>
+		fd->fd_file.buffered = 1;
+  8020d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020d6:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8020da:	eb aa                	jmp    802086 <open+0x69>
+		return -E_BAD_PATH;
+  8020dc:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8020e1:	eb b3                	jmp    802096 <open+0x79>
+
+008020e3 <readdir>:
+{
+  8020e3:	55                   	push   %ebp
+  8020e4:	89 e5                	mov    %esp,%ebp
+  8020e6:	53                   	push   %ebx
+  8020e7:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020ed:	50                   	push   %eax
+  8020ee:	ff 75 08             	push   0x8(%ebp)
+  8020f1:	e8 0b f2 ff ff       	call   801301 <fd_lookup>
+  8020f6:	89 c3                	mov    %eax,%ebx
+  8020f8:	83 c4 10             	add    $0x10,%esp
+  8020fb:	85 c0                	test   %eax,%eax
+  8020fd:	78 73                	js     802172 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8020ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802102:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802108:	39 08                	cmp    %ecx,(%eax)
+  80210a:	0f 85 82 00 00 00    	jne    802192 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  802110:	83 ec 0c             	sub    $0xc,%esp
+  802113:	50                   	push   %eax
+  802114:	e8 c4 f9 ff ff       	call   801add <devfile_sync>
+  802119:	89 c3                	mov    %eax,%ebx
+  80211b:	83 c4 10             	add    $0x10,%esp
+  80211e:	85 c0                	test   %eax,%eax
+  802120:	78 50                	js     802172 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802122:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802125:	8b 40 0c             	mov    0xc(%eax),%eax
+  802128:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  80212d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802130:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  802135:	8b 45 14             	mov    0x14(%ebp),%eax
+  802138:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  80213d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802142:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802147:	e8 ed f8 ff ff       	call   801a39 <fsipc>
+  80214c:	89 c3                	mov    %eax,%ebx
+  80214e:	85 c0                	test   %eax,%eax
+  802150:	7e 20                	jle    802172 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  802152:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802155:	72 22                	jb     802179 <readdir+0x96>
+  802157:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80215c:	7f 1b                	jg     802179 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80215e:	83 ec 04             	sub    $0x4,%esp
+  802161:	50                   	push   %eax
+  802162:	68 00 70 80 00       	push   $0x807000
+  802167:	ff 75 0c             	push   0xc(%ebp)
+  80216a:	e8 8e ea ff ff       	call   800bfd <memmove>
+	return r;
+  80216f:	83 c4 10             	add    $0x10,%esp
+}
+  802172:	89 d8                	mov    %ebx,%eax
+  802174:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802177:	c9                   	leave
+  802178:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  802179:	68 d7 3e 80 00       	push   $0x803ed7
+  80217e:	68 b0 3e 80 00       	push   $0x803eb0
+  802183:	68 86 01 00 00       	push   $0x186
+  802188:	68 c5 3e 80 00       	push   $0x803ec5
+  80218d:	e8 2c e1 ff ff       	call   8002be <_panic>
+		return -E_NOT_SUPP;
+  802192:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802197:	eb d9                	jmp    802172 <readdir+0x8f>
+
+00802199 <munmap>:
+{
+  802199:	55                   	push   %ebp
+  80219a:	89 e5                	mov    %esp,%ebp
+  80219c:	56                   	push   %esi
+  80219d:	53                   	push   %ebx
+  80219e:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8021a4:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8021aa:	75 41                	jne    8021ed <munmap+0x54>
+  8021ac:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8021b2:	77 39                	ja     8021ed <munmap+0x54>
+  8021b4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8021b9:	29 f0                	sub    %esi,%eax
+  8021bb:	39 d0                	cmp    %edx,%eax
+  8021bd:	72 35                	jb     8021f4 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8021bf:	89 f3                	mov    %esi,%ebx
+  8021c1:	01 d6                	add    %edx,%esi
+  8021c3:	39 f3                	cmp    %esi,%ebx
+  8021c5:	73 1a                	jae    8021e1 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8021c7:	83 ec 08             	sub    $0x8,%esp
+  8021ca:	53                   	push   %ebx
+  8021cb:	6a 00                	push   $0x0
+  8021cd:	e8 3e ed ff ff       	call   800f10 <sys_page_unmap>
+  8021d2:	83 c4 10             	add    $0x10,%esp
+  8021d5:	85 c0                	test   %eax,%eax
+  8021d7:	78 0d                	js     8021e6 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8021d9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8021df:	eb e2                	jmp    8021c3 <munmap+0x2a>
+	return 0;
+  8021e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021e9:	5b                   	pop    %ebx
+  8021ea:	5e                   	pop    %esi
+  8021eb:	5d                   	pop    %ebp
+  8021ec:	c3                   	ret
+		return -E_INVAL;
+  8021ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021f2:	eb f2                	jmp    8021e6 <munmap+0x4d>
+  8021f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021f9:	eb eb                	jmp    8021e6 <munmap+0x4d>
+
+008021fb <mmap>:
+{
+  8021fb:	55                   	push   %ebp
+  8021fc:	89 e5                	mov    %esp,%ebp
+  8021fe:	57                   	push   %edi
+  8021ff:	56                   	push   %esi
+  802200:	53                   	push   %ebx
+  802201:	83 ec 34             	sub    $0x34,%esp
+  802204:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802207:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80220a:	50                   	push   %eax
+  80220b:	ff 75 18             	push   0x18(%ebp)
+  80220e:	e8 ee f0 ff ff       	call   801301 <fd_lookup>
+  802213:	89 c3                	mov    %eax,%ebx
+  802215:	83 c4 10             	add    $0x10,%esp
+  802218:	85 c0                	test   %eax,%eax
+  80221a:	0f 88 0e 01 00 00    	js     80232e <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  802220:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802223:	a1 40 50 80 00       	mov    0x805040,%eax
+  802228:	39 02                	cmp    %eax,(%edx)
+  80222a:	0f 85 50 01 00 00    	jne    802380 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  802230:	8b 45 10             	mov    0x10(%ebp),%eax
+  802233:	83 e0 02             	and    $0x2,%eax
+  802236:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802239:	74 0a                	je     802245 <mmap+0x4a>
+  80223b:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80223f:	0f 84 42 01 00 00    	je     802387 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802245:	8b 42 08             	mov    0x8(%edx),%eax
+  802248:	83 e0 03             	and    $0x3,%eax
+  80224b:	83 f8 01             	cmp    $0x1,%eax
+  80224e:	0f 84 3a 01 00 00    	je     80238e <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802254:	8b 45 08             	mov    0x8(%ebp),%eax
+  802257:	0b 45 1c             	or     0x1c(%ebp),%eax
+  80225a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80225f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802262:	0f 85 2d 01 00 00    	jne    802395 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802268:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80226c:	0f 88 2a 01 00 00    	js     80239c <mmap+0x1a1>
+  802272:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  802279:	0f 87 1d 01 00 00    	ja     80239c <mmap+0x1a1>
+  80227f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802284:	2b 45 08             	sub    0x8(%ebp),%eax
+  802287:	39 f8                	cmp    %edi,%eax
+  802289:	0f 82 14 01 00 00    	jb     8023a3 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  80228f:	83 ec 0c             	sub    $0xc,%esp
+  802292:	52                   	push   %edx
+  802293:	e8 45 f8 ff ff       	call   801add <devfile_sync>
+  802298:	89 c3                	mov    %eax,%ebx
+  80229a:	83 c4 10             	add    $0x10,%esp
+  80229d:	85 c0                	test   %eax,%eax
+  80229f:	0f 88 89 00 00 00    	js     80232e <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8022a5:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8022ab:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8022b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b6:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8022b9:	39 fe                	cmp    %edi,%esi
+  8022bb:	73 7b                	jae    802338 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8022bd:	89 f8                	mov    %edi,%eax
+  8022bf:	29 f0                	sub    %esi,%eax
+  8022c1:	c1 e8 0c             	shr    $0xc,%eax
+  8022c4:	ba 40 00 00 00       	mov    $0x40,%edx
+  8022c9:	39 d0                	cmp    %edx,%eax
+  8022cb:	0f 47 c2             	cmova  %edx,%eax
+  8022ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8022d1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8022d4:	8b 52 0c             	mov    0xc(%edx),%edx
+  8022d7:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  8022dd:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8022e0:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  8022e6:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  8022eb:	89 f2                	mov    %esi,%edx
+  8022ed:	03 55 08             	add    0x8(%ebp),%edx
+  8022f0:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  8022f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8022f8:	e8 ea f6 ff ff       	call   8019e7 <fsipcv>
+  8022fd:	85 c0                	test   %eax,%eax
+  8022ff:	7e 12                	jle    802313 <mmap+0x118>
+  802301:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802304:	85 c0                	test   %eax,%eax
+  802306:	0f 84 9e 00 00 00    	je     8023aa <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80230c:	c1 e0 0c             	shl    $0xc,%eax
+  80230f:	01 c6                	add    %eax,%esi
+  802311:	eb a6                	jmp    8022b9 <mmap+0xbe>
+			munmap(addr, done);
+  802313:	89 c3                	mov    %eax,%ebx
+  802315:	83 ec 08             	sub    $0x8,%esp
+  802318:	56                   	push   %esi
+  802319:	ff 75 08             	push   0x8(%ebp)
+  80231c:	e8 78 fe ff ff       	call   802199 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802321:	83 c4 10             	add    $0x10,%esp
+  802324:	85 db                	test   %ebx,%ebx
+  802326:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80232b:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80232e:	89 d8                	mov    %ebx,%eax
+  802330:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802333:	5b                   	pop    %ebx
+  802334:	5e                   	pop    %esi
+  802335:	5f                   	pop    %edi
+  802336:	5d                   	pop    %ebp
+  802337:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802338:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80233b:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80233d:	85 c0                	test   %eax,%eax
+  80233f:	74 ed                	je     80232e <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802341:	be 00 00 00 00       	mov    $0x0,%esi
+  802346:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802349:	39 fe                	cmp    %edi,%esi
+  80234b:	73 2e                	jae    80237b <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80234d:	83 ec 0c             	sub    $0xc,%esp
+  802350:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802353:	50                   	push   %eax
+  802354:	e8 9d 0f 00 00       	call   8032f6 <cowpage>
+  802359:	83 c4 10             	add    $0x10,%esp
+  80235c:	85 c0                	test   %eax,%eax
+  80235e:	78 08                	js     802368 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802360:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802366:	eb e1                	jmp    802349 <mmap+0x14e>
+				munmap(addr, len);
+  802368:	89 c3                	mov    %eax,%ebx
+  80236a:	83 ec 08             	sub    $0x8,%esp
+  80236d:	57                   	push   %edi
+  80236e:	ff 75 08             	push   0x8(%ebp)
+  802371:	e8 23 fe ff ff       	call   802199 <munmap>
+				return r;
+  802376:	83 c4 10             	add    $0x10,%esp
+  802379:	eb b3                	jmp    80232e <mmap+0x133>
+	return 0;
+  80237b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80237e:	eb ae                	jmp    80232e <mmap+0x133>
+		return -E_NOT_SUPP;
+  802380:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802385:	eb a7                	jmp    80232e <mmap+0x133>
+		return -E_NOT_SUPP;
+  802387:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80238c:	eb a0                	jmp    80232e <mmap+0x133>
+		return -E_INVAL;
+  80238e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802393:	eb 99                	jmp    80232e <mmap+0x133>
+  802395:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80239a:	eb 92                	jmp    80232e <mmap+0x133>
+  80239c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023a1:	eb 8b                	jmp    80232e <mmap+0x133>
+  8023a3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023a8:	eb 84                	jmp    80232e <mmap+0x133>
+			munmap(addr, done);
+  8023aa:	83 ec 08             	sub    $0x8,%esp
+  8023ad:	56                   	push   %esi
+  8023ae:	ff 75 08             	push   0x8(%ebp)
+  8023b1:	e8 e3 fd ff ff       	call   802199 <munmap>
+  8023b6:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8023b9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8023be:	e9 6b ff ff ff       	jmp    80232e <mmap+0x133>
+
+008023c3 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8023c3:	55                   	push   %ebp
+  8023c4:	89 e5                	mov    %esp,%ebp
+  8023c6:	56                   	push   %esi
+  8023c7:	53                   	push   %ebx
+  8023c8:	83 ec 10             	sub    $0x10,%esp
+  8023cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8023ce:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8023d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d4:	e8 3d f9 ff ff       	call   801d16 <fsring_slot>
+  8023d9:	85 c0                	test   %eax,%eax
+  8023db:	78 60                	js     80243d <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8023dd:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8023e0:	8b 56 08             	mov    0x8(%esi),%edx
+  8023e3:	83 e2 03             	and    $0x3,%edx
+  8023e6:	83 fa 01             	cmp    $0x1,%edx
+  8023e9:	74 59                	je     802444 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8023eb:	ba 01 00 00 00       	mov    $0x1,%edx
+  8023f0:	89 c1                	mov    %eax,%ecx
+  8023f2:	d3 e2                	shl    %cl,%edx
+  8023f4:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8023fa:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8023fd:	c1 e2 02             	shl    $0x2,%edx
+  802400:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  802406:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  80240d:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802410:	8b 55 18             	mov    0x18(%ebp),%edx
+  802413:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802416:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802419:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80241c:	83 ec 08             	sub    $0x8,%esp
+  80241f:	50                   	push   %eax
+  802420:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802425:	39 c3                	cmp    %eax,%ebx
+  802427:	0f 47 d8             	cmova  %eax,%ebx
+  80242a:	53                   	push   %ebx
+  80242b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80242e:	89 f2                	mov    %esi,%edx
+  802430:	b8 03 00 00 00       	mov    $0x3,%eax
+  802435:	e8 1e f5 ff ff       	call   801958 <fsring_post>
+  80243a:	83 c4 10             	add    $0x10,%esp
+}
+  80243d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802440:	5b                   	pop    %ebx
+  802441:	5e                   	pop    %esi
+  802442:	5d                   	pop    %ebp
+  802443:	c3                   	ret
+		return -E_INVAL;
+  802444:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802449:	eb f2                	jmp    80243d <fsring_read+0x7a>
+
+0080244b <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80244b:	55                   	push   %ebp
+  80244c:	89 e5                	mov    %esp,%ebp
+  80244e:	56                   	push   %esi
+  80244f:	53                   	push   %ebx
+  802450:	83 ec 10             	sub    $0x10,%esp
+  802453:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802456:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802459:	8b 45 08             	mov    0x8(%ebp),%eax
+  80245c:	e8 b5 f8 ff ff       	call   801d16 <fsring_slot>
+  802461:	89 c3                	mov    %eax,%ebx
+  802463:	85 c0                	test   %eax,%eax
+  802465:	78 77                	js     8024de <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802467:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80246a:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80246e:	74 77                	je     8024e7 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802470:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802475:	39 c6                	cmp    %eax,%esi
+  802477:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80247a:	83 ec 04             	sub    $0x4,%esp
+  80247d:	56                   	push   %esi
+  80247e:	ff 75 0c             	push   0xc(%ebp)
+  802481:	89 d8                	mov    %ebx,%eax
+  802483:	c1 e0 0c             	shl    $0xc,%eax
+  802486:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80248c:	50                   	push   %eax
+  80248d:	e8 6b e7 ff ff       	call   800bfd <memmove>
+	fsring_busy |= 1 << slot;
+  802492:	b8 01 00 00 00       	mov    $0x1,%eax
+  802497:	89 d9                	mov    %ebx,%ecx
+  802499:	d3 e0                	shl    %cl,%eax
+  80249b:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8024a1:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8024a4:	c1 e0 02             	shl    $0x2,%eax
+  8024a7:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  8024ad:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  8024b4:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8024b7:	8b 45 18             	mov    0x18(%ebp),%eax
+  8024ba:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8024bd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8024c4:	83 c4 08             	add    $0x8,%esp
+  8024c7:	53                   	push   %ebx
+  8024c8:	56                   	push   %esi
+  8024c9:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8024cc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8024cf:	b8 04 00 00 00       	mov    $0x4,%eax
+  8024d4:	e8 7f f4 ff ff       	call   801958 <fsring_post>
+  8024d9:	89 c3                	mov    %eax,%ebx
+  8024db:	83 c4 10             	add    $0x10,%esp
+}
+  8024de:	89 d8                	mov    %ebx,%eax
+  8024e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024e3:	5b                   	pop    %ebx
+  8024e4:	5e                   	pop    %esi
+  8024e5:	5d                   	pop    %ebp
+  8024e6:	c3                   	ret
+		return -E_INVAL;
+  8024e7:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024ec:	eb f0                	jmp    8024de <fsring_write+0x93>
+
+008024ee <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8024ee:	55                   	push   %ebp
+  8024ef:	89 e5                	mov    %esp,%ebp
+  8024f1:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8024f4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8024f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024fa:	e8 17 f8 ff ff       	call   801d16 <fsring_slot>
+  8024ff:	85 c0                	test   %eax,%eax
+  802501:	78 4c                	js     80254f <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802503:	ba 01 00 00 00       	mov    $0x1,%edx
+  802508:	89 c1                	mov    %eax,%ecx
+  80250a:	d3 e2                	shl    %cl,%edx
+  80250c:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802512:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802515:	c1 e2 02             	shl    $0x2,%edx
+  802518:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  80251e:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  802525:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802528:	8b 55 10             	mov    0x10(%ebp),%edx
+  80252b:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80252e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802531:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802534:	83 ec 08             	sub    $0x8,%esp
+  802537:	50                   	push   %eax
+  802538:	6a 00                	push   $0x0
+  80253a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80253f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802542:	b8 05 00 00 00       	mov    $0x5,%eax
+  802547:	e8 0c f4 ff ff       	call   801958 <fsring_post>
+  80254c:	83 c4 10             	add    $0x10,%esp
+}
+  80254f:	c9                   	leave
+  802550:	c3                   	ret
+
+00802551 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802551:	55                   	push   %ebp
+  802552:	89 e5                	mov    %esp,%ebp
+  802554:	57                   	push   %edi
+  802555:	56                   	push   %esi
+  802556:	53                   	push   %ebx
+  802557:	83 ec 1c             	sub    $0x1c,%esp
+  80255a:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80255e:	a1 00 60 80 00       	mov    0x806000,%eax
+  802563:	8b 40 48             	mov    0x48(%eax),%eax
+  802566:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  80256c:	74 12                	je     802580 <fsring_reap+0x2f>
+		return 0;
+  80256e:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802573:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802576:	5b                   	pop    %ebx
+  802577:	5e                   	pop    %esi
+  802578:	5f                   	pop    %edi
+  802579:	5d                   	pop    %ebp
+  80257a:	c3                   	ret
+		sys_yield();
+  80257b:	e8 e4 e8 ff ff       	call   800e64 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802580:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802586:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80258b:	39 c2                	cmp    %eax,%edx
+  80258d:	75 18                	jne    8025a7 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  80258f:	84 db                	test   %bl,%bl
+  802591:	0f 84 21 01 00 00    	je     8026b8 <fsring_reap+0x167>
+  802597:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  80259e:	75 db                	jne    80257b <fsring_reap+0x2a>
+			return 0;
+  8025a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a5:	eb cc                	jmp    802573 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8025a7:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8025ac:	83 e0 0f             	and    $0xf,%eax
+  8025af:	83 c0 2a             	add    $0x2a,%eax
+  8025b2:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8025b9:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8025c0:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8025c5:	83 c0 01             	add    $0x1,%eax
+  8025c8:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8025cd:	83 fb 0f             	cmp    $0xf,%ebx
+  8025d0:	77 5b                	ja     80262d <fsring_reap+0xdc>
+  8025d2:	be 01 00 00 00       	mov    $0x1,%esi
+  8025d7:	89 d9                	mov    %ebx,%ecx
+  8025d9:	d3 e6                	shl    %cl,%esi
+  8025db:	89 f0                	mov    %esi,%eax
+  8025dd:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  8025e3:	74 48                	je     80262d <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8025e5:	89 d8                	mov    %ebx,%eax
+  8025e7:	c1 e0 0c             	shl    $0xc,%eax
+  8025ea:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8025f0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8025f3:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8025f6:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  8025fd:	83 f8 03             	cmp    $0x3,%eax
+  802600:	74 40                	je     802642 <fsring_reap+0xf1>
+  802602:	83 f8 05             	cmp    $0x5,%eax
+  802605:	74 64                	je     80266b <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802607:	f7 d6                	not    %esi
+  802609:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  80260f:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802612:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  802619:	8b 45 08             	mov    0x8(%ebp),%eax
+  80261c:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  80261e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802621:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802623:	b8 01 00 00 00       	mov    $0x1,%eax
+  802628:	e9 46 ff ff ff       	jmp    802573 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80262d:	53                   	push   %ebx
+  80262e:	68 ed 3e 80 00       	push   $0x803eed
+  802633:	68 8f 02 00 00       	push   $0x28f
+  802638:	68 c5 3e 80 00       	push   $0x803ec5
+  80263d:	e8 7c dc ff ff       	call   8002be <_panic>
+		if (cqe.cqe_result > 0)
+  802642:	85 ff                	test   %edi,%edi
+  802644:	7e c1                	jle    802607 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802646:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802649:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80264e:	39 c7                	cmp    %eax,%edi
+  802650:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802653:	50                   	push   %eax
+  802654:	ff 75 e4             	push   -0x1c(%ebp)
+  802657:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80265a:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  802661:	e8 97 e5 ff ff       	call   800bfd <memmove>
+  802666:	83 c4 10             	add    $0x10,%esp
+  802669:	eb 9c                	jmp    802607 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  80266b:	85 ff                	test   %edi,%edi
+  80266d:	75 98                	jne    802607 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80266f:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802672:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802679:	83 ec 08             	sub    $0x8,%esp
+  80267c:	ff 75 e4             	push   -0x1c(%ebp)
+  80267f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802682:	51                   	push   %ecx
+  802683:	e8 ef e3 ff ff       	call   800a77 <strcpy>
+			st->st_size = ret->ret_size;
+  802688:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80268b:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802691:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802694:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  80269a:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8026a0:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8026a6:	c7 81 88 00 00 00 40 	movl   $0x805040,0x88(%ecx)
+  8026ad:	50 80 00 
+  8026b0:	83 c4 10             	add    $0x10,%esp
+  8026b3:	e9 4f ff ff ff       	jmp    802607 <fsring_reap+0xb6>
+			return 0;
+  8026b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026bd:	e9 b1 fe ff ff       	jmp    802573 <fsring_reap+0x22>
+
+008026c2 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8026c2:	55                   	push   %ebp
+  8026c3:	89 e5                	mov    %esp,%ebp
+  8026c5:	57                   	push   %edi
+  8026c6:	56                   	push   %esi
+  8026c7:	53                   	push   %ebx
+  8026c8:	83 ec 28             	sub    $0x28,%esp
+  8026cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8026ce:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8026d1:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8026d4:	53                   	push   %ebx
+  8026d5:	e8 62 e3 ff ff       	call   800a3c <strlen>
+  8026da:	83 c4 10             	add    $0x10,%esp
+  8026dd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8026e2:	0f 8f 02 01 00 00    	jg     8027ea <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8026e8:	83 ec 08             	sub    $0x8,%esp
+  8026eb:	53                   	push   %ebx
+  8026ec:	68 00 70 80 00       	push   $0x807000
+  8026f1:	e8 81 e3 ff ff       	call   800a77 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8026f6:	83 c4 10             	add    $0x10,%esp
+  8026f9:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8026ff:	76 69                	jbe    80276a <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802701:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802704:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80270a:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80270f:	29 d1                	sub    %edx,%ecx
+  802711:	39 f9                	cmp    %edi,%ecx
+  802713:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802716:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802719:	89 f9                	mov    %edi,%ecx
+  80271b:	01 c1                	add    %eax,%ecx
+  80271d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802720:	eb 0f                	jmp    802731 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802722:	0f b6 10             	movzbl (%eax),%edx
+  802725:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802727:	05 00 10 00 00       	add    $0x1000,%eax
+  80272c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802731:	39 c8                	cmp    %ecx,%eax
+  802733:	72 ed                	jb     802722 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802735:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802738:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  80273e:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802744:	83 ec 0c             	sub    $0xc,%esp
+  802747:	6a 07                	push   $0x7
+  802749:	89 f9                	mov    %edi,%ecx
+  80274b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80274e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802753:	e8 3f f1 ff ff       	call   801897 <fsipc_pages>
+  802758:	89 c7                	mov    %eax,%edi
+  80275a:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  80275d:	85 f6                	test   %esi,%esi
+  80275f:	74 7f                	je     8027e0 <file_slurp+0x11e>
+  802761:	8d 43 01             	lea    0x1(%ebx),%eax
+  802764:	85 ff                	test   %edi,%edi
+  802766:	79 3c                	jns    8027a4 <file_slurp+0xe2>
+  802768:	eb 76                	jmp    8027e0 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  80276a:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802770:	ba 00 00 00 00       	mov    $0x0,%edx
+  802775:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80277a:	e8 ba f2 ff ff       	call   801a39 <fsipc>
+  80277f:	89 c7                	mov    %eax,%edi
+  802781:	85 c0                	test   %eax,%eax
+  802783:	7e d8                	jle    80275d <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802785:	83 ec 04             	sub    $0x4,%esp
+  802788:	50                   	push   %eax
+  802789:	68 08 70 80 00       	push   $0x807008
+  80278e:	ff 75 0c             	push   0xc(%ebp)
+  802791:	e8 67 e4 ff ff       	call   800bfd <memmove>
+  802796:	83 c4 10             	add    $0x10,%esp
+  802799:	eb c2                	jmp    80275d <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  80279b:	80 fa 2f             	cmp    $0x2f,%dl
+  80279e:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8027a1:	83 c0 01             	add    $0x1,%eax
+  8027a4:	89 c1                	mov    %eax,%ecx
+  8027a6:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8027aa:	84 d2                	test   %dl,%dl
+  8027ac:	75 ed                	jne    80279b <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8027ae:	83 ec 04             	sub    $0x4,%esp
+  8027b1:	68 80 00 00 00       	push   $0x80
+  8027b6:	53                   	push   %ebx
+  8027b7:	56                   	push   %esi
+  8027b8:	e8 30 e3 ff ff       	call   800aed <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8027bd:	a1 00 70 80 00       	mov    0x807000,%eax
+  8027c2:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8027c8:	a1 04 70 80 00       	mov    0x807004,%eax
+  8027cd:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8027d3:	c7 86 88 00 00 00 40 	movl   $0x805040,0x88(%esi)
+  8027da:	50 80 00 
+  8027dd:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8027e0:	89 f8                	mov    %edi,%eax
+  8027e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027e5:	5b                   	pop    %ebx
+  8027e6:	5e                   	pop    %esi
+  8027e7:	5f                   	pop    %edi
+  8027e8:	5d                   	pop    %ebp
+  8027e9:	c3                   	ret
+		return -E_BAD_PATH;
+  8027ea:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8027ef:	eb ef                	jmp    8027e0 <file_slurp+0x11e>
+
+008027f1 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8027f1:	55                   	push   %ebp
+  8027f2:	89 e5                	mov    %esp,%ebp
+  8027f4:	53                   	push   %ebx
+  8027f5:	83 ec 10             	sub    $0x10,%esp
+  8027f8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8027fb:	53                   	push   %ebx
+  8027fc:	e8 3b e2 ff ff       	call   800a3c <strlen>
+  802801:	83 c4 10             	add    $0x10,%esp
+  802804:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802809:	7f 25                	jg     802830 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80280b:	83 ec 08             	sub    $0x8,%esp
+  80280e:	53                   	push   %ebx
+  80280f:	68 00 70 80 00       	push   $0x807000
+  802814:	e8 5e e2 ff ff       	call   800a77 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802819:	ba 00 00 00 00       	mov    $0x0,%edx
+  80281e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802823:	e8 11 f2 ff ff       	call   801a39 <fsipc>
+  802828:	83 c4 10             	add    $0x10,%esp
+}
+  80282b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80282e:	c9                   	leave
+  80282f:	c3                   	ret
+		return -E_BAD_PATH;
+  802830:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802835:	eb f4                	jmp    80282b <remove+0x3a>
+
+00802837 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802837:	55                   	push   %ebp
+  802838:	89 e5                	mov    %esp,%ebp
+  80283a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80283d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802842:	b8 08 00 00 00       	mov    $0x8,%eax
+  802847:	e8 ed f1 ff ff       	call   801a39 <fsipc>
+}
+  80284c:	c9                   	leave
+  80284d:	c3                   	ret
+
+0080284e <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  80284e:	55                   	push   %ebp
+  80284f:	89 e5                	mov    %esp,%ebp
+  802851:	57                   	push   %edi
+  802852:	56                   	push   %esi
+  802853:	53                   	push   %ebx
+  802854:	83 ec 18             	sub    $0x18,%esp
+  802857:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80285a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80285d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802860:	57                   	push   %edi
+  802861:	e8 d6 e1 ff ff       	call   800a3c <strlen>
+  802866:	83 c4 10             	add    $0x10,%esp
+  802869:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80286e:	7f 4c                	jg     8028bc <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802870:	83 ec 08             	sub    $0x8,%esp
+  802873:	57                   	push   %edi
+  802874:	68 00 70 80 00       	push   $0x807000
+  802879:	e8 f9 e1 ff ff       	call   800a77 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  80287e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802883:	b8 10 00 00 00       	mov    $0x10,%eax
+  802888:	e8 ac f1 ff ff       	call   801a39 <fsipc>
+  80288d:	83 c4 10             	add    $0x10,%esp
+  802890:	85 c0                	test   %eax,%eax
+  802892:	78 20                	js     8028b4 <defrag+0x66>
+		return r;
+	if (before)
+  802894:	85 f6                	test   %esi,%esi
+  802896:	74 07                	je     80289f <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802898:	a1 00 70 80 00       	mov    0x807000,%eax
+  80289d:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  80289f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  8028a4:	85 db                	test   %ebx,%ebx
+  8028a6:	74 0c                	je     8028b4 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  8028a8:	a1 04 70 80 00       	mov    0x807004,%eax
+  8028ad:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8028af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028b7:	5b                   	pop    %ebx
+  8028b8:	5e                   	pop    %esi
+  8028b9:	5f                   	pop    %edi
+  8028ba:	5d                   	pop    %ebp
+  8028bb:	c3                   	ret
+		return -E_BAD_PATH;
+  8028bc:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8028c1:	eb f1                	jmp    8028b4 <defrag+0x66>
+
+008028c3 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  8028c3:	55                   	push   %ebp
+  8028c4:	89 e5                	mov    %esp,%ebp
+  8028c6:	53                   	push   %ebx
+  8028c7:	83 ec 04             	sub    $0x4,%esp
+  8028ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  8028cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028d2:	b8 11 00 00 00       	mov    $0x11,%eax
+  8028d7:	e8 5d f1 ff ff       	call   801a39 <fsipc>
+  8028dc:	85 c0                	test   %eax,%eax
+  8028de:	78 34                	js     802914 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  8028e0:	a1 00 70 80 00       	mov    0x807000,%eax
+  8028e5:	89 03                	mov    %eax,(%ebx)
+  8028e7:	a1 04 70 80 00       	mov    0x807004,%eax
+  8028ec:	89 43 04             	mov    %eax,0x4(%ebx)
+  8028ef:	a1 08 70 80 00       	mov    0x807008,%eax
+  8028f4:	89 43 08             	mov    %eax,0x8(%ebx)
+  8028f7:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  8028fc:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8028ff:	a1 10 70 80 00       	mov    0x807010,%eax
+  802904:	89 43 10             	mov    %eax,0x10(%ebx)
+  802907:	a1 14 70 80 00       	mov    0x807014,%eax
+  80290c:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  80290f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802914:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802917:	c9                   	leave
+  802918:	c3                   	ret
+
+00802919 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  802919:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80291d:	7f 01                	jg     802920 <writebuf+0x7>
+  80291f:	c3                   	ret
+{
+  802920:	55                   	push   %ebp
+  802921:	89 e5                	mov    %esp,%ebp
+  802923:	53                   	push   %ebx
+  802924:	83 ec 08             	sub    $0x8,%esp
+  802927:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  802929:	ff 70 04             	push   0x4(%eax)
+  80292c:	8d 40 10             	lea    0x10(%eax),%eax
+  80292f:	50                   	push   %eax
+  802930:	ff 33                	push   (%ebx)
+  802932:	e8 fe ec ff ff       	call   801635 <write>
+		if (result > 0)
+  802937:	83 c4 10             	add    $0x10,%esp
+  80293a:	85 c0                	test   %eax,%eax
+  80293c:	7e 03                	jle    802941 <writebuf+0x28>
+			b->result += result;
+  80293e:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802941:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802944:	74 0d                	je     802953 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802946:	85 c0                	test   %eax,%eax
+  802948:	ba 00 00 00 00       	mov    $0x0,%edx
+  80294d:	0f 4f c2             	cmovg  %edx,%eax
+  802950:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802953:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802956:	c9                   	leave
+  802957:	c3                   	ret
+
+00802958 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802958:	55                   	push   %ebp
+  802959:	89 e5                	mov    %esp,%ebp
+  80295b:	53                   	push   %ebx
+  80295c:	83 ec 04             	sub    $0x4,%esp
+  80295f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802962:	8b 53 04             	mov    0x4(%ebx),%edx
+  802965:	8d 42 01             	lea    0x1(%edx),%eax
+  802968:	89 43 04             	mov    %eax,0x4(%ebx)
+  80296b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80296e:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802972:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802977:	74 05                	je     80297e <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  802979:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80297c:	c9                   	leave
+  80297d:	c3                   	ret
+		writebuf(b);
+  80297e:	89 d8                	mov    %ebx,%eax
+  802980:	e8 94 ff ff ff       	call   802919 <writebuf>
+		b->idx = 0;
+  802985:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  80298c:	eb eb                	jmp    802979 <putch+0x21>
+
+0080298e <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  80298e:	55                   	push   %ebp
+  80298f:	89 e5                	mov    %esp,%ebp
+  802991:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  802997:	8b 45 08             	mov    0x8(%ebp),%eax
+  80299a:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  8029a0:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8029a7:	00 00 00 
+	b.result = 0;
+  8029aa:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8029b1:	00 00 00 
+	b.error = 1;
+  8029b4:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8029bb:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8029be:	ff 75 10             	push   0x10(%ebp)
+  8029c1:	ff 75 0c             	push   0xc(%ebp)
+  8029c4:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8029ca:	50                   	push   %eax
+  8029cb:	68 58 29 80 00       	push   $0x802958
+  8029d0:	e8 bb da ff ff       	call   800490 <vprintfmt>
+	if (b.idx > 0)
+  8029d5:	83 c4 10             	add    $0x10,%esp
+  8029d8:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8029df:	7f 12                	jg     8029f3 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8029e1:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8029e7:	85 c0                	test   %eax,%eax
+  8029e9:	75 06                	jne    8029f1 <vfprintf+0x63>
+  8029eb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8029f1:	c9                   	leave
+  8029f2:	c3                   	ret
+		writebuf(&b);
+  8029f3:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8029f9:	e8 1b ff ff ff       	call   802919 <writebuf>
+  8029fe:	eb e1                	jmp    8029e1 <vfprintf+0x53>
+
+00802a00 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802a00:	55                   	push   %ebp
+  802a01:	89 e5                	mov    %esp,%ebp
+  802a03:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802a06:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  802a09:	50                   	push   %eax
+  802a0a:	ff 75 0c             	push   0xc(%ebp)
+  802a0d:	ff 75 08             	push   0x8(%ebp)
+  802a10:	e8 79 ff ff ff       	call   80298e <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802a15:	c9                   	leave
+  802a16:	c3                   	ret
+
+00802a17 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802a17:	55                   	push   %ebp
+  802a18:	89 e5                	mov    %esp,%ebp
+  802a1a:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802a1d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  802a20:	50                   	push   %eax
+  802a21:	ff 75 08             	push   0x8(%ebp)
+  802a24:	6a 01                	push   $0x1
+  802a26:	e8 63 ff ff ff       	call   80298e <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802a2b:	c9                   	leave
+  802a2c:	c3                   	ret
+
+00802a2d <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a2d:	55                   	push   %ebp
+  802a2e:	89 e5                	mov    %esp,%ebp
+  802a30:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802a33:	68 06 3f 80 00       	push   $0x803f06
+  802a38:	ff 75 0c             	push   0xc(%ebp)
+  802a3b:	e8 37 e0 ff ff       	call   800a77 <strcpy>
+	return 0;
+}
+  802a40:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a45:	c9                   	leave
+  802a46:	c3                   	ret
+
+00802a47 <devsock_close>:
+{
+  802a47:	55                   	push   %ebp
+  802a48:	89 e5                	mov    %esp,%ebp
+  802a4a:	53                   	push   %ebx
+  802a4b:	83 ec 10             	sub    $0x10,%esp
+  802a4e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802a51:	53                   	push   %ebx
+  802a52:	e8 80 0c 00 00       	call   8036d7 <pageref>
+  802a57:	89 c2                	mov    %eax,%edx
+  802a59:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802a61:	83 fa 01             	cmp    $0x1,%edx
+  802a64:	74 05                	je     802a6b <devsock_close+0x24>
+}
+  802a66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a69:	c9                   	leave
+  802a6a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802a6b:	83 ec 0c             	sub    $0xc,%esp
+  802a6e:	ff 73 0c             	push   0xc(%ebx)
+  802a71:	e8 b7 02 00 00       	call   802d2d <nsipc_close>
+  802a76:	83 c4 10             	add    $0x10,%esp
+  802a79:	eb eb                	jmp    802a66 <devsock_close+0x1f>
+
+00802a7b <devsock_write>:
+{
+  802a7b:	55                   	push   %ebp
+  802a7c:	89 e5                	mov    %esp,%ebp
+  802a7e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802a81:	6a 00                	push   $0x0
+  802a83:	ff 75 10             	push   0x10(%ebp)
+  802a86:	ff 75 0c             	push   0xc(%ebp)
+  802a89:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8c:	ff 70 0c             	push   0xc(%eax)
+  802a8f:	e8 79 03 00 00       	call   802e0d <nsipc_send>
+}
+  802a94:	c9                   	leave
+  802a95:	c3                   	ret
+
+00802a96 <devsock_read>:
+{
+  802a96:	55                   	push   %ebp
+  802a97:	89 e5                	mov    %esp,%ebp
+  802a99:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802a9c:	6a 00                	push   $0x0
+  802a9e:	ff 75 10             	push   0x10(%ebp)
+  802aa1:	ff 75 0c             	push   0xc(%ebp)
+  802aa4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa7:	ff 70 0c             	push   0xc(%eax)
+  802aaa:	e8 ef 02 00 00       	call   802d9e <nsipc_recv>
+}
+  802aaf:	c9                   	leave
+  802ab0:	c3                   	ret
+
+00802ab1 <fd2sockid>:
+{
+  802ab1:	55                   	push   %ebp
+  802ab2:	89 e5                	mov    %esp,%ebp
+  802ab4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802ab7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802aba:	52                   	push   %edx
+  802abb:	50                   	push   %eax
+  802abc:	e8 40 e8 ff ff       	call   801301 <fd_lookup>
+  802ac1:	83 c4 10             	add    $0x10,%esp
+  802ac4:	85 c0                	test   %eax,%eax
+  802ac6:	78 10                	js     802ad8 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802ac8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802acb:	8b 0d 60 50 80 00    	mov    0x805060,%ecx
+  802ad1:	39 08                	cmp    %ecx,(%eax)
+  802ad3:	75 05                	jne    802ada <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802ad5:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802ad8:	c9                   	leave
+  802ad9:	c3                   	ret
+		return -E_NOT_SUPP;
+  802ada:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802adf:	eb f7                	jmp    802ad8 <fd2sockid+0x27>
+
+00802ae1 <alloc_sockfd>:
+{
+  802ae1:	55                   	push   %ebp
+  802ae2:	89 e5                	mov    %esp,%ebp
+  802ae4:	56                   	push   %esi
+  802ae5:	53                   	push   %ebx
+  802ae6:	83 ec 1c             	sub    $0x1c,%esp
+  802ae9:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802aeb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802aee:	50                   	push   %eax
+  802aef:	e8 b7 e7 ff ff       	call   8012ab <fd_alloc>
+  802af4:	89 c3                	mov    %eax,%ebx
+  802af6:	83 c4 10             	add    $0x10,%esp
+  802af9:	85 c0                	test   %eax,%eax
+  802afb:	78 43                	js     802b40 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802afd:	83 ec 04             	sub    $0x4,%esp
+  802b00:	68 07 04 00 00       	push   $0x407
+  802b05:	ff 75 f4             	push   -0xc(%ebp)
+  802b08:	6a 00                	push   $0x0
+  802b0a:	e8 74 e3 ff ff       	call   800e83 <sys_page_alloc>
+  802b0f:	89 c3                	mov    %eax,%ebx
+  802b11:	83 c4 10             	add    $0x10,%esp
+  802b14:	85 c0                	test   %eax,%eax
+  802b16:	78 28                	js     802b40 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802b18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b1b:	8b 15 60 50 80 00    	mov    0x805060,%edx
+  802b21:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802b23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b26:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802b2d:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802b30:	83 ec 0c             	sub    $0xc,%esp
+  802b33:	50                   	push   %eax
+  802b34:	e8 4b e7 ff ff       	call   801284 <fd2num>
+  802b39:	89 c3                	mov    %eax,%ebx
+  802b3b:	83 c4 10             	add    $0x10,%esp
+  802b3e:	eb 0c                	jmp    802b4c <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802b40:	83 ec 0c             	sub    $0xc,%esp
+  802b43:	56                   	push   %esi
+  802b44:	e8 e4 01 00 00       	call   802d2d <nsipc_close>
+		return r;
+  802b49:	83 c4 10             	add    $0x10,%esp
+}
+  802b4c:	89 d8                	mov    %ebx,%eax
+  802b4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b51:	5b                   	pop    %ebx
+  802b52:	5e                   	pop    %esi
+  802b53:	5d                   	pop    %ebp
+  802b54:	c3                   	ret
+
+00802b55 <accept>:
+{
+  802b55:	55                   	push   %ebp
+  802b56:	89 e5                	mov    %esp,%ebp
+  802b58:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b5e:	e8 4e ff ff ff       	call   802ab1 <fd2sockid>
+  802b63:	85 c0                	test   %eax,%eax
+  802b65:	78 1b                	js     802b82 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802b67:	83 ec 04             	sub    $0x4,%esp
+  802b6a:	ff 75 10             	push   0x10(%ebp)
+  802b6d:	ff 75 0c             	push   0xc(%ebp)
+  802b70:	50                   	push   %eax
+  802b71:	e8 0e 01 00 00       	call   802c84 <nsipc_accept>
+  802b76:	83 c4 10             	add    $0x10,%esp
+  802b79:	85 c0                	test   %eax,%eax
+  802b7b:	78 05                	js     802b82 <accept+0x2d>
+	return alloc_sockfd(r);
+  802b7d:	e8 5f ff ff ff       	call   802ae1 <alloc_sockfd>
+}
+  802b82:	c9                   	leave
+  802b83:	c3                   	ret
+
+00802b84 <bind>:
+{
+  802b84:	55                   	push   %ebp
+  802b85:	89 e5                	mov    %esp,%ebp
+  802b87:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b8d:	e8 1f ff ff ff       	call   802ab1 <fd2sockid>
+  802b92:	85 c0                	test   %eax,%eax
+  802b94:	78 12                	js     802ba8 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802b96:	83 ec 04             	sub    $0x4,%esp
+  802b99:	ff 75 10             	push   0x10(%ebp)
+  802b9c:	ff 75 0c             	push   0xc(%ebp)
+  802b9f:	50                   	push   %eax
+  802ba0:	e8 31 01 00 00       	call   802cd6 <nsipc_bind>
+  802ba5:	83 c4 10             	add    $0x10,%esp
+}
+  802ba8:	c9                   	leave
+  802ba9:	c3                   	ret
+
+00802baa <shutdown>:
+{
+  802baa:	55                   	push   %ebp
+  802bab:	89 e5                	mov    %esp,%ebp
+  802bad:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb3:	e8 f9 fe ff ff       	call   802ab1 <fd2sockid>
+  802bb8:	85 c0                	test   %eax,%eax
+  802bba:	78 0f                	js     802bcb <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802bbc:	83 ec 08             	sub    $0x8,%esp
+  802bbf:	ff 75 0c             	push   0xc(%ebp)
+  802bc2:	50                   	push   %eax
+  802bc3:	e8 43 01 00 00       	call   802d0b <nsipc_shutdown>
+  802bc8:	83 c4 10             	add    $0x10,%esp
+}
+  802bcb:	c9                   	leave
+  802bcc:	c3                   	ret
+
+00802bcd <connect>:
+{
+  802bcd:	55                   	push   %ebp
+  802bce:	89 e5                	mov    %esp,%ebp
+  802bd0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd6:	e8 d6 fe ff ff       	call   802ab1 <fd2sockid>
+  802bdb:	85 c0                	test   %eax,%eax
+  802bdd:	78 12                	js     802bf1 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802bdf:	83 ec 04             	sub    $0x4,%esp
+  802be2:	ff 75 10             	push   0x10(%ebp)
+  802be5:	ff 75 0c             	push   0xc(%ebp)
+  802be8:	50                   	push   %eax
+  802be9:	e8 59 01 00 00       	call   802d47 <nsipc_connect>
+  802bee:	83 c4 10             	add    $0x10,%esp
+}
+  802bf1:	c9                   	leave
+  802bf2:	c3                   	ret
+
+00802bf3 <listen>:
+{
+  802bf3:	55                   	push   %ebp
+  802bf4:	89 e5                	mov    %esp,%ebp
+  802bf6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bfc:	e8 b0 fe ff ff       	call   802ab1 <fd2sockid>
+  802c01:	85 c0                	test   %eax,%eax
+  802c03:	78 0f                	js     802c14 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c05:	83 ec 08             	sub    $0x8,%esp
+  802c08:	ff 75 0c             	push   0xc(%ebp)
+  802c0b:	50                   	push   %eax
+  802c0c:	e8 6b 01 00 00       	call   802d7c <nsipc_listen>
+  802c11:	83 c4 10             	add    $0x10,%esp
+}
+  802c14:	c9                   	leave
+  802c15:	c3                   	ret
+
+00802c16 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802c16:	55                   	push   %ebp
+  802c17:	89 e5                	mov    %esp,%ebp
+  802c19:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802c1c:	ff 75 10             	push   0x10(%ebp)
+  802c1f:	ff 75 0c             	push   0xc(%ebp)
+  802c22:	ff 75 08             	push   0x8(%ebp)
+  802c25:	e8 41 02 00 00       	call   802e6b <nsipc_socket>
+  802c2a:	83 c4 10             	add    $0x10,%esp
+  802c2d:	85 c0                	test   %eax,%eax
+  802c2f:	78 05                	js     802c36 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802c31:	e8 ab fe ff ff       	call   802ae1 <alloc_sockfd>
+}
+  802c36:	c9                   	leave
+  802c37:	c3                   	ret
+
+00802c38 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802c38:	55                   	push   %ebp
+  802c39:	89 e5                	mov    %esp,%ebp
+  802c3b:	53                   	push   %ebx
+  802c3c:	83 ec 04             	sub    $0x4,%esp
+  802c3f:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802c41:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802c48:	74 26                	je     802c70 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802c4a:	6a 07                	push   $0x7
+  802c4c:	68 00 90 80 00       	push   $0x809000
+  802c51:	53                   	push   %ebx
+  802c52:	ff 35 00 a0 80 00    	push   0x80a000
+  802c58:	e8 02 09 00 00       	call   80355f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802c5d:	83 c4 0c             	add    $0xc,%esp
+  802c60:	6a 00                	push   $0x0
+  802c62:	6a 00                	push   $0x0
+  802c64:	6a 00                	push   $0x0
+  802c66:	e8 89 08 00 00       	call   8034f4 <ipc_recv>
+}
+  802c6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c6e:	c9                   	leave
+  802c6f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c70:	83 ec 0c             	sub    $0xc,%esp
+  802c73:	6a 02                	push   $0x2
+  802c75:	e8 1e 0a 00 00       	call   803698 <ipc_find_env>
+  802c7a:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  802c7f:	83 c4 10             	add    $0x10,%esp
+  802c82:	eb c6                	jmp    802c4a <nsipc+0x12>
+
+00802c84 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802c84:	55                   	push   %ebp
+  802c85:	89 e5                	mov    %esp,%ebp
+  802c87:	56                   	push   %esi
+  802c88:	53                   	push   %ebx
+  802c89:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802c8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c8f:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802c94:	8b 06                	mov    (%esi),%eax
+  802c96:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802c9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ca0:	e8 93 ff ff ff       	call   802c38 <nsipc>
+  802ca5:	89 c3                	mov    %eax,%ebx
+  802ca7:	85 c0                	test   %eax,%eax
+  802ca9:	79 09                	jns    802cb4 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802cab:	89 d8                	mov    %ebx,%eax
+  802cad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cb0:	5b                   	pop    %ebx
+  802cb1:	5e                   	pop    %esi
+  802cb2:	5d                   	pop    %ebp
+  802cb3:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802cb4:	83 ec 04             	sub    $0x4,%esp
+  802cb7:	ff 35 10 90 80 00    	push   0x809010
+  802cbd:	68 00 90 80 00       	push   $0x809000
+  802cc2:	ff 75 0c             	push   0xc(%ebp)
+  802cc5:	e8 33 df ff ff       	call   800bfd <memmove>
+		*addrlen = ret->ret_addrlen;
+  802cca:	a1 10 90 80 00       	mov    0x809010,%eax
+  802ccf:	89 06                	mov    %eax,(%esi)
+  802cd1:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802cd4:	eb d5                	jmp    802cab <nsipc_accept+0x27>
+
+00802cd6 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802cd6:	55                   	push   %ebp
+  802cd7:	89 e5                	mov    %esp,%ebp
+  802cd9:	53                   	push   %ebx
+  802cda:	83 ec 08             	sub    $0x8,%esp
+  802cdd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802ce0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce3:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802ce8:	53                   	push   %ebx
+  802ce9:	ff 75 0c             	push   0xc(%ebp)
+  802cec:	68 04 90 80 00       	push   $0x809004
+  802cf1:	e8 07 df ff ff       	call   800bfd <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802cf6:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802cfc:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d01:	e8 32 ff ff ff       	call   802c38 <nsipc>
+}
+  802d06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d09:	c9                   	leave
+  802d0a:	c3                   	ret
+
+00802d0b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d0b:	55                   	push   %ebp
+  802d0c:	89 e5                	mov    %esp,%ebp
+  802d0e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802d11:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d14:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802d19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d1c:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802d21:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d26:	e8 0d ff ff ff       	call   802c38 <nsipc>
+}
+  802d2b:	c9                   	leave
+  802d2c:	c3                   	ret
+
+00802d2d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d2d:	55                   	push   %ebp
+  802d2e:	89 e5                	mov    %esp,%ebp
+  802d30:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802d33:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d36:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802d3b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d40:	e8 f3 fe ff ff       	call   802c38 <nsipc>
+}
+  802d45:	c9                   	leave
+  802d46:	c3                   	ret
+
+00802d47 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802d47:	55                   	push   %ebp
+  802d48:	89 e5                	mov    %esp,%ebp
+  802d4a:	53                   	push   %ebx
+  802d4b:	83 ec 08             	sub    $0x8,%esp
+  802d4e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802d51:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d54:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802d59:	53                   	push   %ebx
+  802d5a:	ff 75 0c             	push   0xc(%ebp)
+  802d5d:	68 04 90 80 00       	push   $0x809004
+  802d62:	e8 96 de ff ff       	call   800bfd <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802d67:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802d6d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d72:	e8 c1 fe ff ff       	call   802c38 <nsipc>
+}
+  802d77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d7a:	c9                   	leave
+  802d7b:	c3                   	ret
+
+00802d7c <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802d7c:	55                   	push   %ebp
+  802d7d:	89 e5                	mov    %esp,%ebp
+  802d7f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802d82:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d85:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802d8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d8d:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802d92:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d97:	e8 9c fe ff ff       	call   802c38 <nsipc>
+}
+  802d9c:	c9                   	leave
+  802d9d:	c3                   	ret
+
+00802d9e <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802d9e:	55                   	push   %ebp
+  802d9f:	89 e5                	mov    %esp,%ebp
+  802da1:	56                   	push   %esi
+  802da2:	53                   	push   %ebx
+  802da3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802da6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da9:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802dae:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802db4:	8b 45 14             	mov    0x14(%ebp),%eax
+  802db7:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802dbc:	b8 07 00 00 00       	mov    $0x7,%eax
+  802dc1:	e8 72 fe ff ff       	call   802c38 <nsipc>
+  802dc6:	89 c3                	mov    %eax,%ebx
+  802dc8:	85 c0                	test   %eax,%eax
+  802dca:	78 22                	js     802dee <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802dcc:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802dd1:	39 c6                	cmp    %eax,%esi
+  802dd3:	0f 4e c6             	cmovle %esi,%eax
+  802dd6:	39 c3                	cmp    %eax,%ebx
+  802dd8:	7f 1d                	jg     802df7 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802dda:	83 ec 04             	sub    $0x4,%esp
+  802ddd:	53                   	push   %ebx
+  802dde:	68 00 90 80 00       	push   $0x809000
+  802de3:	ff 75 0c             	push   0xc(%ebp)
+  802de6:	e8 12 de ff ff       	call   800bfd <memmove>
+  802deb:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802dee:	89 d8                	mov    %ebx,%eax
+  802df0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802df3:	5b                   	pop    %ebx
+  802df4:	5e                   	pop    %esi
+  802df5:	5d                   	pop    %ebp
+  802df6:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802df7:	68 12 3f 80 00       	push   $0x803f12
+  802dfc:	68 b0 3e 80 00       	push   $0x803eb0
+  802e01:	6a 62                	push   $0x62
+  802e03:	68 27 3f 80 00       	push   $0x803f27
+  802e08:	e8 b1 d4 ff ff       	call   8002be <_panic>
+
+00802e0d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e0d:	55                   	push   %ebp
+  802e0e:	89 e5                	mov    %esp,%ebp
+  802e10:	53                   	push   %ebx
+  802e11:	83 ec 04             	sub    $0x4,%esp
+  802e14:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802e17:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e1a:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802e1f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802e25:	7f 2e                	jg     802e55 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802e27:	83 ec 04             	sub    $0x4,%esp
+  802e2a:	53                   	push   %ebx
+  802e2b:	ff 75 0c             	push   0xc(%ebp)
+  802e2e:	68 0c 90 80 00       	push   $0x80900c
+  802e33:	e8 c5 dd ff ff       	call   800bfd <memmove>
+	nsipcbuf.send.req_size = size;
+  802e38:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802e3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e41:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802e46:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e4b:	e8 e8 fd ff ff       	call   802c38 <nsipc>
+}
+  802e50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e53:	c9                   	leave
+  802e54:	c3                   	ret
+	assert(size < 1600);
+  802e55:	68 33 3f 80 00       	push   $0x803f33
+  802e5a:	68 b0 3e 80 00       	push   $0x803eb0
+  802e5f:	6a 6d                	push   $0x6d
+  802e61:	68 27 3f 80 00       	push   $0x803f27
+  802e66:	e8 53 d4 ff ff       	call   8002be <_panic>
+
+00802e6b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802e6b:	55                   	push   %ebp
+  802e6c:	89 e5                	mov    %esp,%ebp
+  802e6e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802e71:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e74:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802e79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e7c:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802e81:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e84:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802e89:	b8 09 00 00 00       	mov    $0x9,%eax
+  802e8e:	e8 a5 fd ff ff       	call   802c38 <nsipc>
+}
+  802e93:	c9                   	leave
+  802e94:	c3                   	ret
+
+00802e95 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e95:	55                   	push   %ebp
+  802e96:	89 e5                	mov    %esp,%ebp
+  802e98:	56                   	push   %esi
+  802e99:	53                   	push   %ebx
+  802e9a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e9d:	83 ec 0c             	sub    $0xc,%esp
+  802ea0:	ff 75 08             	push   0x8(%ebp)
+  802ea3:	e8 ec e3 ff ff       	call   801294 <fd2data>
+  802ea8:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802eaa:	83 c4 08             	add    $0x8,%esp
+  802ead:	68 3f 3f 80 00       	push   $0x803f3f
+  802eb2:	53                   	push   %ebx
+  802eb3:	e8 bf db ff ff       	call   800a77 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802eb8:	8b 46 04             	mov    0x4(%esi),%eax
+  802ebb:	2b 06                	sub    (%esi),%eax
+  802ebd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802ec3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802eca:	00 00 00 
+	stat->st_dev = &devpipe;
+  802ecd:	c7 83 88 00 00 00 80 	movl   $0x805080,0x88(%ebx)
+  802ed4:	50 80 00 
+	return 0;
+}
+  802ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802edc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802edf:	5b                   	pop    %ebx
+  802ee0:	5e                   	pop    %esi
+  802ee1:	5d                   	pop    %ebp
+  802ee2:	c3                   	ret
+
+00802ee3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ee3:	55                   	push   %ebp
+  802ee4:	89 e5                	mov    %esp,%ebp
+  802ee6:	53                   	push   %ebx
+  802ee7:	83 ec 0c             	sub    $0xc,%esp
+  802eea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802eed:	53                   	push   %ebx
+  802eee:	6a 00                	push   $0x0
+  802ef0:	e8 1b e0 ff ff       	call   800f10 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802ef5:	89 1c 24             	mov    %ebx,(%esp)
+  802ef8:	e8 97 e3 ff ff       	call   801294 <fd2data>
+  802efd:	83 c4 08             	add    $0x8,%esp
+  802f00:	50                   	push   %eax
+  802f01:	6a 00                	push   $0x0
+  802f03:	e8 08 e0 ff ff       	call   800f10 <sys_page_unmap>
+}
+  802f08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f0b:	c9                   	leave
+  802f0c:	c3                   	ret
+
+00802f0d <_pipeisclosed>:
+{
+  802f0d:	55                   	push   %ebp
+  802f0e:	89 e5                	mov    %esp,%ebp
+  802f10:	57                   	push   %edi
+  802f11:	56                   	push   %esi
+  802f12:	53                   	push   %ebx
+  802f13:	83 ec 1c             	sub    $0x1c,%esp
+  802f16:	89 c7                	mov    %eax,%edi
+  802f18:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802f1a:	a1 00 60 80 00       	mov    0x806000,%eax
+  802f1f:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802f22:	83 ec 0c             	sub    $0xc,%esp
+  802f25:	57                   	push   %edi
+  802f26:	e8 ac 07 00 00       	call   8036d7 <pageref>
+  802f2b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f2e:	89 34 24             	mov    %esi,(%esp)
+  802f31:	e8 a1 07 00 00       	call   8036d7 <pageref>
+		nn = thisenv->env_runs;
+  802f36:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  802f3c:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802f3f:	83 c4 10             	add    $0x10,%esp
+  802f42:	39 cb                	cmp    %ecx,%ebx
+  802f44:	74 1b                	je     802f61 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802f46:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f49:	75 cf                	jne    802f1a <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802f4b:	8b 42 58             	mov    0x58(%edx),%eax
+  802f4e:	6a 01                	push   $0x1
+  802f50:	50                   	push   %eax
+  802f51:	53                   	push   %ebx
+  802f52:	68 46 3f 80 00       	push   $0x803f46
+  802f57:	e8 3d d4 ff ff       	call   800399 <cprintf>
+  802f5c:	83 c4 10             	add    $0x10,%esp
+  802f5f:	eb b9                	jmp    802f1a <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802f61:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f64:	0f 94 c0             	sete   %al
+  802f67:	0f b6 c0             	movzbl %al,%eax
+}
+  802f6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f6d:	5b                   	pop    %ebx
+  802f6e:	5e                   	pop    %esi
+  802f6f:	5f                   	pop    %edi
+  802f70:	5d                   	pop    %ebp
+  802f71:	c3                   	ret
+
+00802f72 <devpipe_write>:
+{
+  802f72:	55                   	push   %ebp
+  802f73:	89 e5                	mov    %esp,%ebp
+  802f75:	57                   	push   %edi
+  802f76:	56                   	push   %esi
+  802f77:	53                   	push   %ebx
+  802f78:	83 ec 28             	sub    $0x28,%esp
+  802f7b:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802f7e:	56                   	push   %esi
+  802f7f:	e8 10 e3 ff ff       	call   801294 <fd2data>
+  802f84:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f86:	83 c4 10             	add    $0x10,%esp
+  802f89:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f8e:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802f91:	75 09                	jne    802f9c <devpipe_write+0x2a>
+	return i;
+  802f93:	89 f8                	mov    %edi,%eax
+  802f95:	eb 23                	jmp    802fba <devpipe_write+0x48>
+			sys_yield();
+  802f97:	e8 c8 de ff ff       	call   800e64 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802f9c:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f9f:	8b 0b                	mov    (%ebx),%ecx
+  802fa1:	8d 51 20             	lea    0x20(%ecx),%edx
+  802fa4:	39 d0                	cmp    %edx,%eax
+  802fa6:	72 1a                	jb     802fc2 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802fa8:	89 da                	mov    %ebx,%edx
+  802faa:	89 f0                	mov    %esi,%eax
+  802fac:	e8 5c ff ff ff       	call   802f0d <_pipeisclosed>
+  802fb1:	85 c0                	test   %eax,%eax
+  802fb3:	74 e2                	je     802f97 <devpipe_write+0x25>
+				return 0;
+  802fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fbd:	5b                   	pop    %ebx
+  802fbe:	5e                   	pop    %esi
+  802fbf:	5f                   	pop    %edi
+  802fc0:	5d                   	pop    %ebp
+  802fc1:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802fc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802fc5:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802fc9:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802fcc:	89 c2                	mov    %eax,%edx
+  802fce:	c1 fa 1f             	sar    $0x1f,%edx
+  802fd1:	89 d1                	mov    %edx,%ecx
+  802fd3:	c1 e9 1b             	shr    $0x1b,%ecx
+  802fd6:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802fd9:	83 e2 1f             	and    $0x1f,%edx
+  802fdc:	29 ca                	sub    %ecx,%edx
+  802fde:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802fe2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802fe6:	83 c0 01             	add    $0x1,%eax
+  802fe9:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802fec:	83 c7 01             	add    $0x1,%edi
+  802fef:	eb 9d                	jmp    802f8e <devpipe_write+0x1c>
+
+00802ff1 <devpipe_read>:
+{
+  802ff1:	55                   	push   %ebp
+  802ff2:	89 e5                	mov    %esp,%ebp
+  802ff4:	57                   	push   %edi
+  802ff5:	56                   	push   %esi
+  802ff6:	53                   	push   %ebx
+  802ff7:	83 ec 18             	sub    $0x18,%esp
+  802ffa:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802ffd:	57                   	push   %edi
+  802ffe:	e8 91 e2 ff ff       	call   801294 <fd2data>
+  803003:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803005:	83 c4 10             	add    $0x10,%esp
+  803008:	be 00 00 00 00       	mov    $0x0,%esi
+  80300d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803010:	75 13                	jne    803025 <devpipe_read+0x34>
+	return i;
+  803012:	89 f0                	mov    %esi,%eax
+  803014:	eb 02                	jmp    803018 <devpipe_read+0x27>
+				return i;
+  803016:	89 f0                	mov    %esi,%eax
+}
+  803018:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80301b:	5b                   	pop    %ebx
+  80301c:	5e                   	pop    %esi
+  80301d:	5f                   	pop    %edi
+  80301e:	5d                   	pop    %ebp
+  80301f:	c3                   	ret
+			sys_yield();
+  803020:	e8 3f de ff ff       	call   800e64 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803025:	8b 03                	mov    (%ebx),%eax
+  803027:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80302a:	75 18                	jne    803044 <devpipe_read+0x53>
+			if (i > 0)
+  80302c:	85 f6                	test   %esi,%esi
+  80302e:	75 e6                	jne    803016 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803030:	89 da                	mov    %ebx,%edx
+  803032:	89 f8                	mov    %edi,%eax
+  803034:	e8 d4 fe ff ff       	call   802f0d <_pipeisclosed>
+  803039:	85 c0                	test   %eax,%eax
+  80303b:	74 e3                	je     803020 <devpipe_read+0x2f>
+				return 0;
+  80303d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803042:	eb d4                	jmp    803018 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803044:	99                   	cltd
+  803045:	c1 ea 1b             	shr    $0x1b,%edx
+  803048:	01 d0                	add    %edx,%eax
+  80304a:	83 e0 1f             	and    $0x1f,%eax
+  80304d:	29 d0                	sub    %edx,%eax
+  80304f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803054:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803057:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80305a:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80305d:	83 c6 01             	add    $0x1,%esi
+  803060:	eb ab                	jmp    80300d <devpipe_read+0x1c>
+
+00803062 <pipe>:
+{
+  803062:	55                   	push   %ebp
+  803063:	89 e5                	mov    %esp,%ebp
+  803065:	56                   	push   %esi
+  803066:	53                   	push   %ebx
+  803067:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80306a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80306d:	50                   	push   %eax
+  80306e:	e8 38 e2 ff ff       	call   8012ab <fd_alloc>
+  803073:	89 c3                	mov    %eax,%ebx
+  803075:	83 c4 10             	add    $0x10,%esp
+  803078:	85 c0                	test   %eax,%eax
+  80307a:	0f 88 23 01 00 00    	js     8031a3 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803080:	83 ec 04             	sub    $0x4,%esp
+  803083:	68 07 04 00 00       	push   $0x407
+  803088:	ff 75 f4             	push   -0xc(%ebp)
+  80308b:	6a 00                	push   $0x0
+  80308d:	e8 f1 dd ff ff       	call   800e83 <sys_page_alloc>
+  803092:	89 c3                	mov    %eax,%ebx
+  803094:	83 c4 10             	add    $0x10,%esp
+  803097:	85 c0                	test   %eax,%eax
+  803099:	0f 88 04 01 00 00    	js     8031a3 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80309f:	83 ec 0c             	sub    $0xc,%esp
+  8030a2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030a5:	50                   	push   %eax
+  8030a6:	e8 00 e2 ff ff       	call   8012ab <fd_alloc>
+  8030ab:	89 c3                	mov    %eax,%ebx
+  8030ad:	83 c4 10             	add    $0x10,%esp
+  8030b0:	85 c0                	test   %eax,%eax
+  8030b2:	0f 88 db 00 00 00    	js     803193 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030b8:	83 ec 04             	sub    $0x4,%esp
+  8030bb:	68 07 04 00 00       	push   $0x407
+  8030c0:	ff 75 f0             	push   -0x10(%ebp)
+  8030c3:	6a 00                	push   $0x0
+  8030c5:	e8 b9 dd ff ff       	call   800e83 <sys_page_alloc>
+  8030ca:	89 c3                	mov    %eax,%ebx
+  8030cc:	83 c4 10             	add    $0x10,%esp
+  8030cf:	85 c0                	test   %eax,%eax
+  8030d1:	0f 88 bc 00 00 00    	js     803193 <pipe+0x131>
+	va = fd2data(fd0);
+  8030d7:	83 ec 0c             	sub    $0xc,%esp
+  8030da:	ff 75 f4             	push   -0xc(%ebp)
+  8030dd:	e8 b2 e1 ff ff       	call   801294 <fd2data>
+  8030e2:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030e4:	83 c4 0c             	add    $0xc,%esp
+  8030e7:	68 07 04 00 00       	push   $0x407
+  8030ec:	50                   	push   %eax
+  8030ed:	6a 00                	push   $0x0
+  8030ef:	e8 8f dd ff ff       	call   800e83 <sys_page_alloc>
+  8030f4:	89 c3                	mov    %eax,%ebx
+  8030f6:	83 c4 10             	add    $0x10,%esp
+  8030f9:	85 c0                	test   %eax,%eax
+  8030fb:	0f 88 82 00 00 00    	js     803183 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803101:	83 ec 0c             	sub    $0xc,%esp
+  803104:	ff 75 f0             	push   -0x10(%ebp)
+  803107:	e8 88 e1 ff ff       	call   801294 <fd2data>
+  80310c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803113:	50                   	push   %eax
+  803114:	6a 00                	push   $0x0
+  803116:	56                   	push   %esi
+  803117:	6a 00                	push   $0x0
+  803119:	e8 b0 dd ff ff       	call   800ece <sys_page_map>
+  80311e:	89 c3                	mov    %eax,%ebx
+  803120:	83 c4 20             	add    $0x20,%esp
+  803123:	85 c0                	test   %eax,%eax
+  803125:	78 4e                	js     803175 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803127:	a1 80 50 80 00       	mov    0x805080,%eax
+  80312c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80312f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803131:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803134:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80313b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80313e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803140:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803143:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80314a:	83 ec 0c             	sub    $0xc,%esp
+  80314d:	ff 75 f4             	push   -0xc(%ebp)
+  803150:	e8 2f e1 ff ff       	call   801284 <fd2num>
+  803155:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803158:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80315a:	83 c4 04             	add    $0x4,%esp
+  80315d:	ff 75 f0             	push   -0x10(%ebp)
+  803160:	e8 1f e1 ff ff       	call   801284 <fd2num>
+  803165:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803168:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80316b:	83 c4 10             	add    $0x10,%esp
+  80316e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803173:	eb 2e                	jmp    8031a3 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803175:	83 ec 08             	sub    $0x8,%esp
+  803178:	56                   	push   %esi
+  803179:	6a 00                	push   $0x0
+  80317b:	e8 90 dd ff ff       	call   800f10 <sys_page_unmap>
+  803180:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803183:	83 ec 08             	sub    $0x8,%esp
+  803186:	ff 75 f0             	push   -0x10(%ebp)
+  803189:	6a 00                	push   $0x0
+  80318b:	e8 80 dd ff ff       	call   800f10 <sys_page_unmap>
+  803190:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803193:	83 ec 08             	sub    $0x8,%esp
+  803196:	ff 75 f4             	push   -0xc(%ebp)
+  803199:	6a 00                	push   $0x0
+  80319b:	e8 70 dd ff ff       	call   800f10 <sys_page_unmap>
+  8031a0:	83 c4 10             	add    $0x10,%esp
+}
+  8031a3:	89 d8                	mov    %ebx,%eax
+  8031a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031a8:	5b                   	pop    %ebx
+  8031a9:	5e                   	pop    %esi
+  8031aa:	5d                   	pop    %ebp
+  8031ab:	c3                   	ret
+
+008031ac <pipeisclosed>:
+{
+  8031ac:	55                   	push   %ebp
+  8031ad:	89 e5                	mov    %esp,%ebp
+  8031af:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031b5:	50                   	push   %eax
+  8031b6:	ff 75 08             	push   0x8(%ebp)
+  8031b9:	e8 43 e1 ff ff       	call   801301 <fd_lookup>
+  8031be:	83 c4 10             	add    $0x10,%esp
+  8031c1:	85 c0                	test   %eax,%eax
+  8031c3:	78 18                	js     8031dd <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8031c5:	83 ec 0c             	sub    $0xc,%esp
+  8031c8:	ff 75 f4             	push   -0xc(%ebp)
+  8031cb:	e8 c4 e0 ff ff       	call   801294 <fd2data>
+  8031d0:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8031d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031d5:	e8 33 fd ff ff       	call   802f0d <_pipeisclosed>
+  8031da:	83 c4 10             	add    $0x10,%esp
+}
+  8031dd:	c9                   	leave
+  8031de:	c3                   	ret
+
+008031df <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  8031df:	55                   	push   %ebp
+  8031e0:	89 e5                	mov    %esp,%ebp
+  8031e2:	57                   	push   %edi
+  8031e3:	56                   	push   %esi
+  8031e4:	53                   	push   %ebx
+  8031e5:	83 ec 20             	sub    $0x20,%esp
+  8031e8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8031eb:	89 d7                	mov    %edx,%edi
+  8031ed:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  8031ef:	51                   	push   %ecx
+  8031f0:	68 00 f0 7f 00       	push   $0x7ff000
+  8031f5:	6a 00                	push   $0x0
+  8031f7:	e8 87 dc ff ff       	call   800e83 <sys_page_alloc>
+  8031fc:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8031fe:	83 c4 10             	add    $0x10,%esp
+  803201:	85 c0                	test   %eax,%eax
+  803203:	78 45                	js     80324a <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  803205:	83 ec 04             	sub    $0x4,%esp
+  803208:	68 00 10 00 00       	push   $0x1000
+  80320d:	57                   	push   %edi
+  80320e:	68 00 f0 7f 00       	push   $0x7ff000
+  803213:	e8 e5 d9 ff ff       	call   800bfd <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  803218:	89 34 24             	mov    %esi,(%esp)
+  80321b:	57                   	push   %edi
+  80321c:	ff 75 e4             	push   -0x1c(%ebp)
+  80321f:	68 00 f0 7f 00       	push   $0x7ff000
+  803224:	6a 00                	push   $0x0
+  803226:	e8 a3 dc ff ff       	call   800ece <sys_page_map>
+  80322b:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80322d:	83 c4 20             	add    $0x20,%esp
+  803230:	85 c0                	test   %eax,%eax
+  803232:	78 16                	js     80324a <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803234:	83 ec 08             	sub    $0x8,%esp
+  803237:	68 00 f0 7f 00       	push   $0x7ff000
+  80323c:	6a 00                	push   $0x0
+  80323e:	e8 cd dc ff ff       	call   800f10 <sys_page_unmap>
+  803243:	83 c4 10             	add    $0x10,%esp
+  803246:	85 c0                	test   %eax,%eax
+  803248:	75 0a                	jne    803254 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  80324a:	89 d8                	mov    %ebx,%eax
+  80324c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80324f:	5b                   	pop    %ebx
+  803250:	5e                   	pop    %esi
+  803251:	5f                   	pop    %edi
+  803252:	5d                   	pop    %ebp
+  803253:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803254:	68 60 3f 80 00       	push   $0x803f60
+  803259:	68 b0 3e 80 00       	push   $0x803eb0
+  80325e:	6a 1b                	push   $0x1b
+  803260:	68 d8 3f 80 00       	push   $0x803fd8
+  803265:	e8 54 d0 ff ff       	call   8002be <_panic>
+
+0080326a <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80326a:	55                   	push   %ebp
+  80326b:	89 e5                	mov    %esp,%ebp
+  80326d:	53                   	push   %ebx
+  80326e:	83 ec 04             	sub    $0x4,%esp
+  803271:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803274:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803276:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  80327a:	74 21                	je     80329d <pgfault+0x33>
+  80327c:	89 d0                	mov    %edx,%eax
+  80327e:	c1 e8 16             	shr    $0x16,%eax
+  803281:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803288:	a8 01                	test   $0x1,%al
+  80328a:	74 11                	je     80329d <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  80328c:	89 d0                	mov    %edx,%eax
+  80328e:	c1 e8 0c             	shr    $0xc,%eax
+  803291:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803298:	f6 c4 08             	test   $0x8,%ah
+  80329b:	75 17                	jne    8032b4 <pgfault+0x4a>
+		if (pgfault_next) {
+  80329d:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  8032a2:	85 c0                	test   %eax,%eax
+  8032a4:	74 27                	je     8032cd <pgfault+0x63>
+			pgfault_next(utf);
+  8032a6:	83 ec 0c             	sub    $0xc,%esp
+  8032a9:	53                   	push   %ebx
+  8032aa:	ff d0                	call   *%eax
+			return;
+  8032ac:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8032af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032b2:	c9                   	leave
+  8032b3:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8032b4:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8032ba:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8032bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c4:	e8 16 ff ff ff       	call   8031df <copy_page_to>
+  8032c9:	85 c0                	test   %eax,%eax
+  8032cb:	79 e2                	jns    8032af <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8032cd:	a1 00 60 80 00       	mov    0x806000,%eax
+  8032d2:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8032d5:	ff 73 28             	push   0x28(%ebx)
+  8032d8:	ff 33                	push   (%ebx)
+  8032da:	50                   	push   %eax
+  8032db:	68 84 3f 80 00       	push   $0x803f84
+  8032e0:	e8 b4 d0 ff ff       	call   800399 <cprintf>
+	sys_env_destroy(0);
+  8032e5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8032ec:	e8 03 db ff ff       	call   800df4 <sys_env_destroy>
+  8032f1:	83 c4 10             	add    $0x10,%esp
+  8032f4:	eb b9                	jmp    8032af <pgfault+0x45>
+
+008032f6 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8032f6:	55                   	push   %ebp
+  8032f7:	89 e5                	mov    %esp,%ebp
+  8032f9:	53                   	push   %ebx
+  8032fa:	83 ec 04             	sub    $0x4,%esp
+  8032fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803300:	a1 08 a0 80 00       	mov    0x80a008,%eax
+  803305:	3d 6a 32 80 00       	cmp    $0x80326a,%eax
+  80330a:	74 15                	je     803321 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80330c:	a3 04 a0 80 00       	mov    %eax,0x80a004
+		set_pgfault_handler(pgfault);
+  803311:	83 ec 0c             	sub    $0xc,%esp
+  803314:	68 6a 32 80 00       	push   $0x80326a
+  803319:	e8 fb 03 00 00       	call   803719 <set_pgfault_handler>
+  80331e:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803321:	83 ec 0c             	sub    $0xc,%esp
+  803324:	68 05 08 00 00       	push   $0x805
+  803329:	53                   	push   %ebx
+  80332a:	6a 00                	push   $0x0
+  80332c:	53                   	push   %ebx
+  80332d:	6a 00                	push   $0x0
+  80332f:	e8 9a db ff ff       	call   800ece <sys_page_map>
+}
+  803334:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803337:	c9                   	leave
+  803338:	c3                   	ret
+
+00803339 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803339:	55                   	push   %ebp
+  80333a:	89 e5                	mov    %esp,%ebp
+  80333c:	57                   	push   %edi
+  80333d:	56                   	push   %esi
+  80333e:	53                   	push   %ebx
+  80333f:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  803342:	68 6a 32 80 00       	push   $0x80326a
+  803347:	e8 cd 03 00 00       	call   803719 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80334c:	b8 07 00 00 00       	mov    $0x7,%eax
+  803351:	cd 30                	int    $0x30
+  803353:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803356:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  803359:	83 c4 10             	add    $0x10,%esp
+  80335c:	85 c0                	test   %eax,%eax
+  80335e:	0f 88 6b 01 00 00    	js     8034cf <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803364:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803369:	75 37                	jne    8033a2 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80336b:	e8 cd da ff ff       	call   800e3d <sys_getenvid>
+  803370:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803375:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80337b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803380:	a3 00 60 80 00       	mov    %eax,0x806000
+		return 0;
+  803385:	e9 45 01 00 00       	jmp    8034cf <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  80338a:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803390:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803396:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80339c:	0f 87 ba 00 00 00    	ja     80345c <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8033a2:	89 d8                	mov    %ebx,%eax
+  8033a4:	c1 e8 16             	shr    $0x16,%eax
+  8033a7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8033ae:	a8 01                	test   $0x1,%al
+  8033b0:	74 d8                	je     80338a <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8033b2:	89 d8                	mov    %ebx,%eax
+  8033b4:	c1 e8 0c             	shr    $0xc,%eax
+  8033b7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8033be:	f6 c2 01             	test   $0x1,%dl
+  8033c1:	74 cd                	je     803390 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8033c3:	89 da                	mov    %ebx,%edx
+  8033c5:	80 e6 df             	and    $0xdf,%dh
+  8033c8:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8033ce:	74 c0                	je     803390 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8033d0:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8033d2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8033d9:	f6 c6 04             	test   $0x4,%dh
+  8033dc:	75 53                	jne    803431 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8033de:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8033e5:	f6 c6 08             	test   $0x8,%dh
+  8033e8:	75 0c                	jne    8033f6 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8033ea:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8033f1:	f6 c2 02             	test   $0x2,%dl
+  8033f4:	74 3b                	je     803431 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8033f6:	83 ec 0c             	sub    $0xc,%esp
+  8033f9:	68 05 08 00 00       	push   $0x805
+  8033fe:	57                   	push   %edi
+  8033ff:	ff 75 e4             	push   -0x1c(%ebp)
+  803402:	57                   	push   %edi
+  803403:	6a 00                	push   $0x0
+  803405:	e8 c4 da ff ff       	call   800ece <sys_page_map>
+  80340a:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80340c:	83 c4 20             	add    $0x20,%esp
+  80340f:	85 c0                	test   %eax,%eax
+  803411:	0f 88 a7 00 00 00    	js     8034be <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803417:	83 ec 0c             	sub    $0xc,%esp
+  80341a:	68 05 08 00 00       	push   $0x805
+  80341f:	57                   	push   %edi
+  803420:	6a 00                	push   $0x0
+  803422:	57                   	push   %edi
+  803423:	6a 00                	push   $0x0
+  803425:	e8 a4 da ff ff       	call   800ece <sys_page_map>
+  80342a:	89 c6                	mov    %eax,%esi
+	return r;
+  80342c:	83 c4 20             	add    $0x20,%esp
+  80342f:	eb 21                	jmp    803452 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803431:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803438:	83 ec 0c             	sub    $0xc,%esp
+  80343b:	25 07 0e 00 00       	and    $0xe07,%eax
+  803440:	50                   	push   %eax
+  803441:	57                   	push   %edi
+  803442:	ff 75 e4             	push   -0x1c(%ebp)
+  803445:	57                   	push   %edi
+  803446:	6a 00                	push   $0x0
+  803448:	e8 81 da ff ff       	call   800ece <sys_page_map>
+  80344d:	89 c6                	mov    %eax,%esi
+  80344f:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  803452:	85 f6                	test   %esi,%esi
+  803454:	0f 89 36 ff ff ff    	jns    803390 <fork+0x57>
+  80345a:	eb 62                	jmp    8034be <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80345c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803461:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  803466:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803469:	89 f8                	mov    %edi,%eax
+  80346b:	e8 6f fd ff ff       	call   8031df <copy_page_to>
+  803470:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803472:	85 c0                	test   %eax,%eax
+  803474:	78 48                	js     8034be <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803476:	83 ec 04             	sub    $0x4,%esp
+  803479:	6a 07                	push   $0x7
+  80347b:	68 00 f0 bf ee       	push   $0xeebff000
+  803480:	57                   	push   %edi
+  803481:	e8 fd d9 ff ff       	call   800e83 <sys_page_alloc>
+  803486:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803488:	83 c4 10             	add    $0x10,%esp
+  80348b:	85 c0                	test   %eax,%eax
+  80348d:	78 2f                	js     8034be <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  80348f:	a1 00 60 80 00       	mov    0x806000,%eax
+  803494:	8b 40 64             	mov    0x64(%eax),%eax
+  803497:	83 ec 08             	sub    $0x8,%esp
+  80349a:	50                   	push   %eax
+  80349b:	57                   	push   %edi
+  80349c:	e8 4d db ff ff       	call   800fee <sys_env_set_pgfault_upcall>
+  8034a1:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8034a3:	83 c4 10             	add    $0x10,%esp
+  8034a6:	85 c0                	test   %eax,%eax
+  8034a8:	78 14                	js     8034be <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8034aa:	83 ec 08             	sub    $0x8,%esp
+  8034ad:	6a 02                	push   $0x2
+  8034af:	57                   	push   %edi
+  8034b0:	e8 a5 da ff ff       	call   800f5a <sys_env_set_status>
+  8034b5:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8034b7:	83 c4 10             	add    $0x10,%esp
+  8034ba:	85 c0                	test   %eax,%eax
+  8034bc:	79 11                	jns    8034cf <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8034be:	83 ec 0c             	sub    $0xc,%esp
+  8034c1:	ff 75 e0             	push   -0x20(%ebp)
+  8034c4:	e8 2b d9 ff ff       	call   800df4 <sys_env_destroy>
+	return r;
+  8034c9:	83 c4 10             	add    $0x10,%esp
+  8034cc:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8034cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8034d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034d5:	5b                   	pop    %ebx
+  8034d6:	5e                   	pop    %esi
+  8034d7:	5f                   	pop    %edi
+  8034d8:	5d                   	pop    %ebp
+  8034d9:	c3                   	ret
+
+008034da <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8034da:	55                   	push   %ebp
+  8034db:	89 e5                	mov    %esp,%ebp
+  8034dd:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8034e0:	68 e3 3f 80 00       	push   $0x803fe3
+  8034e5:	68 bf 00 00 00       	push   $0xbf
+  8034ea:	68 d8 3f 80 00       	push   $0x803fd8
+  8034ef:	e8 ca cd ff ff       	call   8002be <_panic>
+
+008034f4 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8034f4:	55                   	push   %ebp
+  8034f5:	89 e5                	mov    %esp,%ebp
+  8034f7:	56                   	push   %esi
+  8034f8:	53                   	push   %ebx
+  8034f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803502:	85 c0                	test   %eax,%eax
+  803504:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803509:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80350c:	83 ec 0c             	sub    $0xc,%esp
+  80350f:	50                   	push   %eax
+  803510:	e8 b6 db ff ff       	call   8010cb <sys_ipc_recv>
+	if (from_env_store)
+  803515:	83 c4 10             	add    $0x10,%esp
+  803518:	85 f6                	test   %esi,%esi
+  80351a:	74 14                	je     803530 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80351c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803521:	85 c0                	test   %eax,%eax
+  803523:	75 09                	jne    80352e <ipc_recv+0x3a>
+  803525:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80352b:	8b 52 74             	mov    0x74(%edx),%edx
+  80352e:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803530:	85 db                	test   %ebx,%ebx
+  803532:	74 25                	je     803559 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803534:	85 c0                	test   %eax,%eax
+  803536:	74 0d                	je     803545 <ipc_recv+0x51>
+  803538:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  80353e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803541:	5b                   	pop    %ebx
+  803542:	5e                   	pop    %esi
+  803543:	5d                   	pop    %ebp
+  803544:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803545:	a1 00 60 80 00       	mov    0x806000,%eax
+  80354a:	8b 40 78             	mov    0x78(%eax),%eax
+  80354d:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  80354f:	a1 00 60 80 00       	mov    0x806000,%eax
+  803554:	8b 40 70             	mov    0x70(%eax),%eax
+  803557:	eb e5                	jmp    80353e <ipc_recv+0x4a>
+  803559:	85 c0                	test   %eax,%eax
+  80355b:	75 e1                	jne    80353e <ipc_recv+0x4a>
+  80355d:	eb f0                	jmp    80354f <ipc_recv+0x5b>
+
+0080355f <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80355f:	55                   	push   %ebp
+  803560:	89 e5                	mov    %esp,%ebp
+  803562:	57                   	push   %edi
+  803563:	56                   	push   %esi
+  803564:	53                   	push   %ebx
+  803565:	83 ec 0c             	sub    $0xc,%esp
+  803568:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80356b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80356e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803571:	85 db                	test   %ebx,%ebx
+  803573:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803578:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80357b:	ff 75 14             	push   0x14(%ebp)
+  80357e:	53                   	push   %ebx
+  80357f:	56                   	push   %esi
+  803580:	57                   	push   %edi
+  803581:	e8 b2 da ff ff       	call   801038 <sys_ipc_try_send>
+  803586:	83 c4 10             	add    $0x10,%esp
+  803589:	85 c0                	test   %eax,%eax
+  80358b:	74 22                	je     8035af <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  80358d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803590:	75 07                	jne    803599 <ipc_send+0x3a>
+		sys_yield();
+  803592:	e8 cd d8 ff ff       	call   800e64 <sys_yield>
+  803597:	eb e2                	jmp    80357b <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803599:	68 f9 3f 80 00       	push   $0x803ff9
+  80359e:	68 b0 3e 80 00       	push   $0x803eb0
+  8035a3:	6a 39                	push   $0x39
+  8035a5:	68 0e 40 80 00       	push   $0x80400e
+  8035aa:	e8 0f cd ff ff       	call   8002be <_panic>
+	}
+}
+  8035af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035b2:	5b                   	pop    %ebx
+  8035b3:	5e                   	pop    %esi
+  8035b4:	5f                   	pop    %edi
+  8035b5:	5d                   	pop    %ebp
+  8035b6:	c3                   	ret
+
+008035b7 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  8035b7:	55                   	push   %ebp
+  8035b8:	89 e5                	mov    %esp,%ebp
+  8035ba:	57                   	push   %edi
+  8035bb:	56                   	push   %esi
+  8035bc:	53                   	push   %ebx
+  8035bd:	83 ec 10             	sub    $0x10,%esp
+  8035c0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8035c9:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8035cc:	85 c0                	test   %eax,%eax
+  8035ce:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8035d3:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8035d6:	6a 00                	push   $0x0
+  8035d8:	ff 33                	push   (%ebx)
+  8035da:	50                   	push   %eax
+  8035db:	e8 a8 da ff ff       	call   801088 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8035e0:	83 c4 10             	add    $0x10,%esp
+  8035e3:	85 c0                	test   %eax,%eax
+  8035e5:	75 3c                	jne    803623 <ipc_recvv+0x6c>
+  8035e7:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8035ed:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8035f0:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8035f2:	85 ff                	test   %edi,%edi
+  8035f4:	74 4e                	je     803644 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8035f6:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8035fc:	8b 52 74             	mov    0x74(%edx),%edx
+  8035ff:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803601:	85 f6                	test   %esi,%esi
+  803603:	74 18                	je     80361d <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803605:	85 c0                	test   %eax,%eax
+  803607:	75 2d                	jne    803636 <ipc_recvv+0x7f>
+  803609:	a1 00 60 80 00       	mov    0x806000,%eax
+  80360e:	8b 40 78             	mov    0x78(%eax),%eax
+  803611:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803613:	a1 00 60 80 00       	mov    0x806000,%eax
+  803618:	8b 40 70             	mov    0x70(%eax),%eax
+  80361b:	eb 1f                	jmp    80363c <ipc_recvv+0x85>
+  80361d:	85 c0                	test   %eax,%eax
+  80361f:	75 1b                	jne    80363c <ipc_recvv+0x85>
+  803621:	eb f0                	jmp    803613 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803623:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803629:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  80362e:	85 ff                	test   %edi,%edi
+  803630:	75 cd                	jne    8035ff <ipc_recvv+0x48>
+	if (perm_store)
+  803632:	85 f6                	test   %esi,%esi
+  803634:	74 e7                	je     80361d <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803636:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80363c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80363f:	5b                   	pop    %ebx
+  803640:	5e                   	pop    %esi
+  803641:	5f                   	pop    %edi
+  803642:	5d                   	pop    %ebp
+  803643:	c3                   	ret
+	if (perm_store)
+  803644:	85 f6                	test   %esi,%esi
+  803646:	75 bd                	jne    803605 <ipc_recvv+0x4e>
+  803648:	eb c9                	jmp    803613 <ipc_recvv+0x5c>
+
+0080364a <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  80364a:	55                   	push   %ebp
+  80364b:	89 e5                	mov    %esp,%ebp
+  80364d:	57                   	push   %edi
+  80364e:	56                   	push   %esi
+  80364f:	53                   	push   %ebx
+  803650:	83 ec 0c             	sub    $0xc,%esp
+  803653:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803656:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803659:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  80365c:	ff 75 14             	push   0x14(%ebp)
+  80365f:	53                   	push   %ebx
+  803660:	56                   	push   %esi
+  803661:	57                   	push   %edi
+  803662:	e8 f9 d9 ff ff       	call   801060 <sys_ipc_try_sendv>
+  803667:	83 c4 10             	add    $0x10,%esp
+  80366a:	85 c0                	test   %eax,%eax
+  80366c:	74 22                	je     803690 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  80366e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803671:	75 07                	jne    80367a <ipc_sendv+0x30>
+		sys_yield();
+  803673:	e8 ec d7 ff ff       	call   800e64 <sys_yield>
+  803678:	eb e2                	jmp    80365c <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80367a:	68 f9 3f 80 00       	push   $0x803ff9
+  80367f:	68 b0 3e 80 00       	push   $0x803eb0
+  803684:	6a 5c                	push   $0x5c
+  803686:	68 0e 40 80 00       	push   $0x80400e
+  80368b:	e8 2e cc ff ff       	call   8002be <_panic>
+	}
+}
+  803690:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803693:	5b                   	pop    %ebx
+  803694:	5e                   	pop    %esi
+  803695:	5f                   	pop    %edi
+  803696:	5d                   	pop    %ebp
+  803697:	c3                   	ret
+
+00803698 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803698:	55                   	push   %ebp
+  803699:	89 e5                	mov    %esp,%ebp
+  80369b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80369e:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8036a3:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8036a9:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8036af:	8b 52 50             	mov    0x50(%edx),%edx
+  8036b2:	39 ca                	cmp    %ecx,%edx
+  8036b4:	74 11                	je     8036c7 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8036b6:	83 c0 01             	add    $0x1,%eax
+  8036b9:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8036be:	75 e3                	jne    8036a3 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8036c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036c5:	eb 0e                	jmp    8036d5 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8036c7:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8036cd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8036d2:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8036d5:	5d                   	pop    %ebp
+  8036d6:	c3                   	ret
+
+008036d7 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8036d7:	55                   	push   %ebp
+  8036d8:	89 e5                	mov    %esp,%ebp
+  8036da:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8036dd:	89 c2                	mov    %eax,%edx
+  8036df:	c1 ea 16             	shr    $0x16,%edx
+  8036e2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8036e9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8036ee:	f6 c1 01             	test   $0x1,%cl
+  8036f1:	74 22                	je     803715 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8036f3:	c1 e8 0c             	shr    $0xc,%eax
+  8036f6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8036fd:	a8 01                	test   $0x1,%al
+  8036ff:	74 14                	je     803715 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803701:	c1 e8 0c             	shr    $0xc,%eax
+  803704:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803707:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80370e:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803712:	0f b7 d2             	movzwl %dx,%edx
+}
+  803715:	89 d0                	mov    %edx,%eax
+  803717:	5d                   	pop    %ebp
+  803718:	c3                   	ret
+
+00803719 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803719:	55                   	push   %ebp
+  80371a:	89 e5                	mov    %esp,%ebp
+  80371c:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  80371f:	83 3d 08 a0 80 00 00 	cmpl   $0x0,0x80a008
+  803726:	74 0a                	je     803732 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803728:	8b 45 08             	mov    0x8(%ebp),%eax
+  80372b:	a3 08 a0 80 00       	mov    %eax,0x80a008
+}
+  803730:	c9                   	leave
+  803731:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803732:	83 ec 04             	sub    $0x4,%esp
+  803735:	6a 07                	push   $0x7
+  803737:	68 00 f0 bf ee       	push   $0xeebff000
+  80373c:	6a 00                	push   $0x0
+  80373e:	e8 40 d7 ff ff       	call   800e83 <sys_page_alloc>
+  803743:	83 c4 10             	add    $0x10,%esp
+  803746:	85 c0                	test   %eax,%eax
+  803748:	75 2c                	jne    803776 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80374a:	83 ec 08             	sub    $0x8,%esp
+  80374d:	68 8c 37 80 00       	push   $0x80378c
+  803752:	6a 00                	push   $0x0
+  803754:	e8 95 d8 ff ff       	call   800fee <sys_env_set_pgfault_upcall>
+  803759:	83 c4 10             	add    $0x10,%esp
+  80375c:	85 c0                	test   %eax,%eax
+  80375e:	74 c8                	je     803728 <set_pgfault_handler+0xf>
+  803760:	68 60 40 80 00       	push   $0x804060
+  803765:	68 b0 3e 80 00       	push   $0x803eb0
+  80376a:	6a 20                	push   $0x20
+  80376c:	68 90 40 80 00       	push   $0x804090
+  803771:	e8 48 cb ff ff       	call   8002be <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803776:	68 18 40 80 00       	push   $0x804018
+  80377b:	68 b0 3e 80 00       	push   $0x803eb0
+  803780:	6a 1e                	push   $0x1e
+  803782:	68 90 40 80 00       	push   $0x804090
+  803787:	e8 32 cb ff ff       	call   8002be <_panic>
+
+0080378c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80378c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80378d:	a1 08 a0 80 00       	mov    0x80a008,%eax
+	call *%eax
+  803792:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803794:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803797:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  80379c:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8037a1:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8037a5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8037a8:	83 c4 08             	add    $0x8,%esp
+	popal
+  8037ab:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8037ac:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8037af:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8037b0:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8037b1:	c3                   	ret
+
+008037b2 <dm>:
+  8037b2:	55                   	push   %ebp
+  8037b3:	57                   	push   %edi
+  8037b4:	56                   	push   %esi
+  8037b5:	53                   	push   %ebx
+  8037b6:	83 ec 24             	sub    $0x24,%esp
+  8037b9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8037bd:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8037c1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8037c5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8037c9:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8037cd:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8037d1:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8037d5:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8037da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037e4:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8037eb:	00 
+  8037ec:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8037f3:	00 
+  8037f4:	89 fb                	mov    %edi,%ebx
+  8037f6:	eb 08                	jmp    803800 <dm+0x4e>
+  8037f8:	83 e9 01             	sub    $0x1,%ecx
+  8037fb:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8037fe:	74 68                	je     803868 <dm+0xb6>
+  803800:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803804:	01 c0                	add    %eax,%eax
+  803806:	89 c6                	mov    %eax,%esi
+  803808:	89 d7                	mov    %edx,%edi
+  80380a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80380e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803812:	0f ad d0             	shrd   %cl,%edx,%eax
+  803815:	d3 ea                	shr    %cl,%edx
+  803817:	f6 c1 20             	test   $0x20,%cl
+  80381a:	74 04                	je     803820 <dm+0x6e>
+  80381c:	89 d0                	mov    %edx,%eax
+  80381e:	31 d2                	xor    %edx,%edx
+  803820:	83 e0 01             	and    $0x1,%eax
+  803823:	89 04 24             	mov    %eax,(%esp)
+  803826:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80382d:	00 
+  80382e:	8b 04 24             	mov    (%esp),%eax
+  803831:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803835:	09 f0                	or     %esi,%eax
+  803837:	09 fa                	or     %edi,%edx
+  803839:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80383d:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803841:	39 f0                	cmp    %esi,%eax
+  803843:	89 d5                	mov    %edx,%ebp
+  803845:	19 fd                	sbb    %edi,%ebp
+  803847:	72 af                	jb     8037f8 <dm+0x46>
+  803849:	29 f0                	sub    %esi,%eax
+  80384b:	19 fa                	sbb    %edi,%edx
+  80384d:	89 cf                	mov    %ecx,%edi
+  80384f:	c1 ef 05             	shr    $0x5,%edi
+  803852:	83 e7 01             	and    $0x1,%edi
+  803855:	89 fe                	mov    %edi,%esi
+  803857:	83 f6 01             	xor    $0x1,%esi
+  80385a:	d3 e6                	shl    %cl,%esi
+  80385c:	d3 e7                	shl    %cl,%edi
+  80385e:	09 74 24 18          	or     %esi,0x18(%esp)
+  803862:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803866:	eb 90                	jmp    8037f8 <dm+0x46>
+  803868:	85 db                	test   %ebx,%ebx
+  80386a:	74 05                	je     803871 <dm+0xbf>
+  80386c:	89 03                	mov    %eax,(%ebx)
+  80386e:	89 53 04             	mov    %edx,0x4(%ebx)
+  803871:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803875:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803879:	83 c4 24             	add    $0x24,%esp
+  80387c:	5b                   	pop    %ebx
+  80387d:	5e                   	pop    %esi
+  80387e:	5f                   	pop    %edi
+  80387f:	5d                   	pop    %ebp
+  803880:	c3                   	ret
+
+00803881 <__udivdi3>:
+  803881:	83 ec 08             	sub    $0x8,%esp
+  803884:	6a 00                	push   $0x0
+  803886:	ff 74 24 1c          	push   0x1c(%esp)
+  80388a:	ff 74 24 1c          	push   0x1c(%esp)
+  80388e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803892:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803896:	e8 17 ff ff ff       	call   8037b2 <dm>
+  80389b:	83 c4 14             	add    $0x14,%esp
+  80389e:	c3                   	ret
+
+0080389f <__umoddi3>:
+  80389f:	83 ec 18             	sub    $0x18,%esp
+  8038a2:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8038a6:	50                   	push   %eax
+  8038a7:	ff 74 24 2c          	push   0x2c(%esp)
+  8038ab:	ff 74 24 2c          	push   0x2c(%esp)
+  8038af:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8038b3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038b7:	e8 f6 fe ff ff       	call   8037b2 <dm>
+  8038bc:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8038c0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8038c4:	83 c4 24             	add    $0x24,%esp
+  8038c7:	c3                   	ret
+
+008038c8 <__divdi3>:
+  8038c8:	53                   	push   %ebx
+  8038c9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8038cd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8038d1:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8038d5:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8038d9:	85 d2                	test   %edx,%edx
+  8038db:	78 15                	js     8038f2 <__divdi3+0x2a>
+  8038dd:	85 db                	test   %ebx,%ebx
+  8038df:	78 34                	js     803915 <__divdi3+0x4d>
+  8038e1:	83 ec 04             	sub    $0x4,%esp
+  8038e4:	6a 00                	push   $0x0
+  8038e6:	53                   	push   %ebx
+  8038e7:	51                   	push   %ecx
+  8038e8:	e8 c5 fe ff ff       	call   8037b2 <dm>
+  8038ed:	83 c4 10             	add    $0x10,%esp
+  8038f0:	eb 21                	jmp    803913 <__divdi3+0x4b>
+  8038f2:	f7 d8                	neg    %eax
+  8038f4:	83 d2 00             	adc    $0x0,%edx
+  8038f7:	f7 da                	neg    %edx
+  8038f9:	85 db                	test   %ebx,%ebx
+  8038fb:	78 30                	js     80392d <__divdi3+0x65>
+  8038fd:	83 ec 04             	sub    $0x4,%esp
+  803900:	6a 00                	push   $0x0
+  803902:	53                   	push   %ebx
+  803903:	51                   	push   %ecx
+  803904:	e8 a9 fe ff ff       	call   8037b2 <dm>
+  803909:	83 c4 10             	add    $0x10,%esp
+  80390c:	f7 d8                	neg    %eax
+  80390e:	83 d2 00             	adc    $0x0,%edx
+  803911:	f7 da                	neg    %edx
+  803913:	5b                   	pop    %ebx
+  803914:	c3                   	ret
+  803915:	83 ec 04             	sub    $0x4,%esp
+  803918:	6a 00                	push   $0x0
+  80391a:	f7 d9                	neg    %ecx
+  80391c:	83 d3 00             	adc    $0x0,%ebx
+  80391f:	f7 db                	neg    %ebx
+  803921:	53                   	push   %ebx
+  803922:	51                   	push   %ecx
+  803923:	e8 8a fe ff ff       	call   8037b2 <dm>
+  803928:	83 c4 10             	add    $0x10,%esp
+  80392b:	eb df                	jmp    80390c <__divdi3+0x44>
+  80392d:	83 ec 04             	sub    $0x4,%esp
+  803930:	6a 00                	push   $0x0
+  803932:	f7 d9                	neg    %ecx
+  803934:	83 d3 00             	adc    $0x0,%ebx
+  803937:	f7 db                	neg    %ebx
+  803939:	53                   	push   %ebx
+  80393a:	51                   	push   %ecx
+  80393b:	e8 72 fe ff ff       	call   8037b2 <dm>
+  803940:	83 c4 10             	add    $0x10,%esp
+  803943:	eb ce                	jmp    803913 <__divdi3+0x4b>
+
+00803945 <__moddi3>:
+  803945:	55                   	push   %ebp
+  803946:	57                   	push   %edi
+  803947:	56                   	push   %esi
+  803948:	53                   	push   %ebx
+  803949:	83 ec 24             	sub    $0x24,%esp
+  80394c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803950:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803954:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803958:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80395c:	85 d2                	test   %edx,%edx
+  80395e:	78 3b                	js     80399b <__moddi3+0x56>
+  803960:	83 ec 04             	sub    $0x4,%esp
+  803963:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803967:	56                   	push   %esi
+  803968:	89 ce                	mov    %ecx,%esi
+  80396a:	f7 de                	neg    %esi
+  80396c:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803970:	89 de                	mov    %ebx,%esi
+  803972:	83 d6 00             	adc    $0x0,%esi
+  803975:	f7 de                	neg    %esi
+  803977:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80397b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80397f:	0f 48 f1             	cmovs  %ecx,%esi
+  803982:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803987:	53                   	push   %ebx
+  803988:	56                   	push   %esi
+  803989:	e8 24 fe ff ff       	call   8037b2 <dm>
+  80398e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803992:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803996:	83 c4 10             	add    $0x10,%esp
+  803999:	eb 47                	jmp    8039e2 <__moddi3+0x9d>
+  80399b:	f7 d8                	neg    %eax
+  80399d:	83 d2 00             	adc    $0x0,%edx
+  8039a0:	f7 da                	neg    %edx
+  8039a2:	83 ec 04             	sub    $0x4,%esp
+  8039a5:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8039a9:	56                   	push   %esi
+  8039aa:	89 cf                	mov    %ecx,%edi
+  8039ac:	f7 df                	neg    %edi
+  8039ae:	89 de                	mov    %ebx,%esi
+  8039b0:	83 d6 00             	adc    $0x0,%esi
+  8039b3:	f7 de                	neg    %esi
+  8039b5:	0f 49 cf             	cmovns %edi,%ecx
+  8039b8:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8039bc:	0f 49 de             	cmovns %esi,%ebx
+  8039bf:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8039c3:	ff 74 24 0c          	push   0xc(%esp)
+  8039c7:	ff 74 24 0c          	push   0xc(%esp)
+  8039cb:	e8 e2 fd ff ff       	call   8037b2 <dm>
+  8039d0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8039d4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8039d8:	f7 d8                	neg    %eax
+  8039da:	83 d2 00             	adc    $0x0,%edx
+  8039dd:	f7 da                	neg    %edx
+  8039df:	83 c4 10             	add    $0x10,%esp
+  8039e2:	83 c4 24             	add    $0x24,%esp
+  8039e5:	5b                   	pop    %ebx
+  8039e6:	5e                   	pop    %esi
+  8039e7:	5f                   	pop    %edi
+  8039e8:	5d                   	pop    %ebp
+  8039e9:	c3                   	ret
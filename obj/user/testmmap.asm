@@ -0,0 +1,8823 @@
+
+obj/user/testmmap.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 63 05 00 00       	call   800594 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+static void childofspawn(char *what);
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	envid_t waiter, checker;
+	int r, f, i;
+
+	if (argc > 1)
+  80003a:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  80003e:	0f 8f 55 03 00 00    	jg     800399 <umain+0x366>
+{
+  800044:	b9 00 00 00 00       	mov    $0x0,%ecx
+		childofspawn(argv[1]);
+
+	for (i = 0; i < LEN; i++)
+		data[i] = 'a' + i % 26;
+  800049:	bb 4f ec c4 4e       	mov    $0x4ec4ec4f,%ebx
+  80004e:	89 c8                	mov    %ecx,%eax
+  800050:	f7 eb                	imul   %ebx
+  800052:	c1 fa 03             	sar    $0x3,%edx
+  800055:	89 c8                	mov    %ecx,%eax
+  800057:	c1 f8 1f             	sar    $0x1f,%eax
+  80005a:	29 c2                	sub    %eax,%edx
+  80005c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  80005f:	89 c8                	mov    %ecx,%eax
+  800061:	29 d0                	sub    %edx,%eax
+  800063:	83 c0 61             	add    $0x61,%eax
+  800066:	88 81 80 80 80 00    	mov    %al,0x808080(%ecx)
+	for (i = 0; i < LEN; i++)
+  80006c:	83 c1 01             	add    $0x1,%ecx
+  80006f:	81 f9 64 20 00 00    	cmp    $0x2064,%ecx
+  800075:	75 d7                	jne    80004e <umain+0x1b>
+	if ((f = open("/mmapfile", O_RDWR|O_CREAT|O_TRUNC)) < 0)
+  800077:	83 ec 08             	sub    $0x8,%esp
+  80007a:	68 02 03 00 00       	push   $0x302
+  80007f:	68 47 44 80 00       	push   $0x804447
+  800084:	e8 c0 23 00 00       	call   802449 <open>
+  800089:	89 c3                	mov    %eax,%ebx
+  80008b:	83 c4 10             	add    $0x10,%esp
+  80008e:	85 c0                	test   %eax,%eax
+  800090:	0f 88 aa 03 00 00    	js     800440 <umain+0x40d>
+		panic("open /mmapfile: %e", f);
+	if ((r = write(f, data, LEN)) != LEN)
+  800096:	83 ec 04             	sub    $0x4,%esp
+  800099:	68 64 20 00 00       	push   $0x2064
+  80009e:	68 80 80 80 00       	push   $0x808080
+  8000a3:	50                   	push   %eax
+  8000a4:	e8 b8 19 00 00       	call   801a61 <write>
+  8000a9:	83 c4 10             	add    $0x10,%esp
+  8000ac:	3d 64 20 00 00       	cmp    $0x2064,%eax
+  8000b1:	0f 85 9b 03 00 00    	jne    800452 <umain+0x41f>
+		panic("write /mmapfile: %e", r);
+	close(f);
+  8000b7:	83 ec 0c             	sub    $0xc,%esp
+  8000ba:	53                   	push   %ebx
+  8000bb:	e8 97 17 00 00       	call   801857 <close>
+
+	if ((f = open("/mmapfile", O_RDONLY)) < 0)
+  8000c0:	83 c4 08             	add    $0x8,%esp
+  8000c3:	6a 00                	push   $0x0
+  8000c5:	68 47 44 80 00       	push   $0x804447
+  8000ca:	e8 7a 23 00 00       	call   802449 <open>
+  8000cf:	89 c3                	mov    %eax,%ebx
+  8000d1:	83 c4 10             	add    $0x10,%esp
+  8000d4:	85 c0                	test   %eax,%eax
+  8000d6:	0f 88 88 03 00 00    	js     800464 <umain+0x431>
+		panic("open /mmapfile: %e", f);
+
+	// Shared mappings are read-only, and share the cached pages
+	if ((r = mmap(VA, LEN, PROT_READ|PROT_WRITE, MAP_SHARED, f, 0)) != -E_NOT_SUPP)
+  8000dc:	83 ec 08             	sub    $0x8,%esp
+  8000df:	6a 00                	push   $0x0
+  8000e1:	50                   	push   %eax
+  8000e2:	6a 01                	push   $0x1
+  8000e4:	6a 03                	push   $0x3
+  8000e6:	68 64 20 00 00       	push   $0x2064
+  8000eb:	68 00 00 00 a0       	push   $0xa0000000
+  8000f0:	e8 32 25 00 00       	call   802627 <mmap>
+  8000f5:	83 c4 20             	add    $0x20,%esp
+  8000f8:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8000fb:	0f 85 75 03 00 00    	jne    800476 <umain+0x443>
+		panic("writable shared mmap returned %d", r);
+	if ((r = mmap(VA, LEN, PROT_READ, MAP_SHARED, f, 0)) < 0)
+  800101:	83 ec 08             	sub    $0x8,%esp
+  800104:	6a 00                	push   $0x0
+  800106:	53                   	push   %ebx
+  800107:	6a 01                	push   $0x1
+  800109:	6a 01                	push   $0x1
+  80010b:	68 64 20 00 00       	push   $0x2064
+  800110:	68 00 00 00 a0       	push   $0xa0000000
+  800115:	e8 0d 25 00 00       	call   802627 <mmap>
+  80011a:	83 c4 20             	add    $0x20,%esp
+  80011d:	85 c0                	test   %eax,%eax
+  80011f:	0f 88 63 03 00 00    	js     800488 <umain+0x455>
+		panic("mmap shared: %e", r);
+	if ((r = mmap(VA2, LEN, PROT_READ, MAP_SHARED, f, 0)) < 0)
+  800125:	83 ec 08             	sub    $0x8,%esp
+  800128:	6a 00                	push   $0x0
+  80012a:	53                   	push   %ebx
+  80012b:	6a 01                	push   $0x1
+  80012d:	6a 01                	push   $0x1
+  80012f:	68 64 20 00 00       	push   $0x2064
+  800134:	68 00 00 00 a1       	push   $0xa1000000
+  800139:	e8 e9 24 00 00       	call   802627 <mmap>
+  80013e:	83 c4 20             	add    $0x20,%esp
+  800141:	85 c0                	test   %eax,%eax
+  800143:	0f 88 51 03 00 00    	js     80049a <umain+0x467>
+		panic("mmap shared 2: %e", r);
+	if (memcmp(VA, data, LEN) != 0)
+  800149:	83 ec 04             	sub    $0x4,%esp
+  80014c:	68 64 20 00 00       	push   $0x2064
+  800151:	68 80 80 80 00       	push   $0x808080
+  800156:	68 00 00 00 a0       	push   $0xa0000000
+  80015b:	e8 5e 0d 00 00       	call   800ebe <memcmp>
+  800160:	83 c4 10             	add    $0x10,%esp
+  800163:	85 c0                	test   %eax,%eax
+  800165:	0f 85 41 03 00 00    	jne    8004ac <umain+0x479>
+		panic("shared mapping holds wrong data");
+	for (i = 0; i < LEN; i += PGSIZE) {
+		if (uvpt[PGNUM(VA + i)] & PTE_W)
+  80016b:	a1 00 00 68 ef       	mov    0xef680000,%eax
+  800170:	a8 02                	test   $0x2,%al
+  800172:	0f 85 48 03 00 00    	jne    8004c0 <umain+0x48d>
+			panic("shared mapping is writable");
+		if (PTE_ADDR(uvpt[PGNUM(VA + i)]) != PTE_ADDR(uvpt[PGNUM(VA2 + i)]))
+  800178:	a1 00 00 68 ef       	mov    0xef680000,%eax
+  80017d:	8b 15 00 40 68 ef    	mov    0xef684000,%edx
+  800183:	31 d0                	xor    %edx,%eax
+  800185:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80018a:	0f 87 44 03 00 00    	ja     8004d4 <umain+0x4a1>
+		if (uvpt[PGNUM(VA + i)] & PTE_W)
+  800190:	a1 04 00 68 ef       	mov    0xef680004,%eax
+  800195:	a8 02                	test   $0x2,%al
+  800197:	0f 85 23 03 00 00    	jne    8004c0 <umain+0x48d>
+		if (PTE_ADDR(uvpt[PGNUM(VA + i)]) != PTE_ADDR(uvpt[PGNUM(VA2 + i)]))
+  80019d:	a1 04 00 68 ef       	mov    0xef680004,%eax
+  8001a2:	8b 15 04 40 68 ef    	mov    0xef684004,%edx
+  8001a8:	31 d0                	xor    %edx,%eax
+  8001aa:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8001af:	0f 87 1f 03 00 00    	ja     8004d4 <umain+0x4a1>
+		if (uvpt[PGNUM(VA + i)] & PTE_W)
+  8001b5:	a1 08 00 68 ef       	mov    0xef680008,%eax
+  8001ba:	a8 02                	test   $0x2,%al
+  8001bc:	0f 85 fe 02 00 00    	jne    8004c0 <umain+0x48d>
+		if (PTE_ADDR(uvpt[PGNUM(VA + i)]) != PTE_ADDR(uvpt[PGNUM(VA2 + i)]))
+  8001c2:	a1 08 00 68 ef       	mov    0xef680008,%eax
+  8001c7:	8b 15 08 40 68 ef    	mov    0xef684008,%edx
+  8001cd:	31 d0                	xor    %edx,%eax
+  8001cf:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8001d4:	0f 87 fa 02 00 00    	ja     8004d4 <umain+0x4a1>
+			panic("shared mappings do not share pages");
+	}
+	cprintf("mmap shared is good\n");
+  8001da:	83 ec 0c             	sub    $0xc,%esp
+  8001dd:	68 9a 44 80 00       	push   $0x80449a
+  8001e2:	e8 eb 04 00 00       	call   8006d2 <cprintf>
+
+	// Writes to a private mapping go to a copy, never to the file
+	if ((r = mmap(VA3, LEN, PROT_READ|PROT_WRITE, MAP_PRIVATE, f, 0)) < 0)
+  8001e7:	83 c4 08             	add    $0x8,%esp
+  8001ea:	6a 00                	push   $0x0
+  8001ec:	53                   	push   %ebx
+  8001ed:	6a 02                	push   $0x2
+  8001ef:	6a 03                	push   $0x3
+  8001f1:	68 64 20 00 00       	push   $0x2064
+  8001f6:	68 00 00 00 a2       	push   $0xa2000000
+  8001fb:	e8 27 24 00 00       	call   802627 <mmap>
+  800200:	83 c4 20             	add    $0x20,%esp
+  800203:	85 c0                	test   %eax,%eax
+  800205:	0f 88 dd 02 00 00    	js     8004e8 <umain+0x4b5>
+		panic("mmap private: %e", r);
+	if (memcmp(VA3, data, LEN) != 0)
+  80020b:	83 ec 04             	sub    $0x4,%esp
+  80020e:	68 64 20 00 00       	push   $0x2064
+  800213:	68 80 80 80 00       	push   $0x808080
+  800218:	68 00 00 00 a2       	push   $0xa2000000
+  80021d:	e8 9c 0c 00 00       	call   800ebe <memcmp>
+  800222:	83 c4 10             	add    $0x10,%esp
+  800225:	85 c0                	test   %eax,%eax
+  800227:	0f 85 cd 02 00 00    	jne    8004fa <umain+0x4c7>
+		panic("private mapping holds wrong data");
+	strcpy(VA3 + PGSIZE, "private");
+  80022d:	83 ec 08             	sub    $0x8,%esp
+  800230:	68 db 44 80 00       	push   $0x8044db
+  800235:	68 00 10 00 a2       	push   $0xa2001000
+  80023a:	e8 81 0a 00 00       	call   800cc0 <strcpy>
+	if (strcmp(VA3 + PGSIZE, "private") != 0)
+  80023f:	83 c4 08             	add    $0x8,%esp
+  800242:	68 db 44 80 00       	push   $0x8044db
+  800247:	68 00 10 00 a2       	push   $0xa2001000
+  80024c:	e8 20 0b 00 00       	call   800d71 <strcmp>
+  800251:	83 c4 10             	add    $0x10,%esp
+  800254:	85 c0                	test   %eax,%eax
+  800256:	0f 85 b2 02 00 00    	jne    80050e <umain+0x4db>
+		panic("private mapping did not take the write");
+	if (PTE_ADDR(uvpt[PGNUM(VA3 + PGSIZE)]) == PTE_ADDR(uvpt[PGNUM(VA + PGSIZE)]))
+  80025c:	a1 04 80 68 ef       	mov    0xef688004,%eax
+  800261:	8b 15 04 00 68 ef    	mov    0xef680004,%edx
+  800267:	31 d0                	xor    %edx,%eax
+  800269:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80026e:	0f 86 ae 02 00 00    	jbe    800522 <umain+0x4ef>
+		panic("private write went to the shared page");
+	if (memcmp(VA, data, LEN) != 0)
+  800274:	83 ec 04             	sub    $0x4,%esp
+  800277:	68 64 20 00 00       	push   $0x2064
+  80027c:	68 80 80 80 00       	push   $0x808080
+  800281:	68 00 00 00 a0       	push   $0xa0000000
+  800286:	e8 33 0c 00 00       	call   800ebe <memcmp>
+  80028b:	83 c4 10             	add    $0x10,%esp
+  80028e:	85 c0                	test   %eax,%eax
+  800290:	0f 85 a0 02 00 00    	jne    800536 <umain+0x503>
+		panic("private write showed in the shared mapping");
+	munmap(VA3, LEN);
+  800296:	83 ec 08             	sub    $0x8,%esp
+  800299:	68 64 20 00 00       	push   $0x2064
+  80029e:	68 00 00 00 a2       	push   $0xa2000000
+  8002a3:	e8 1d 23 00 00       	call   8025c5 <munmap>
+	seek(f, 0);
+  8002a8:	83 c4 08             	add    $0x8,%esp
+  8002ab:	6a 00                	push   $0x0
+  8002ad:	53                   	push   %ebx
+  8002ae:	e8 30 18 00 00       	call   801ae3 <seek>
+	if ((r = readn(f, buf, LEN)) != LEN)
+  8002b3:	83 c4 0c             	add    $0xc,%esp
+  8002b6:	68 64 20 00 00       	push   $0x2064
+  8002bb:	68 00 60 80 00       	push   $0x806000
+  8002c0:	53                   	push   %ebx
+  8002c1:	e8 54 17 00 00       	call   801a1a <readn>
+  8002c6:	83 c4 10             	add    $0x10,%esp
+  8002c9:	3d 64 20 00 00       	cmp    $0x2064,%eax
+  8002ce:	0f 85 76 02 00 00    	jne    80054a <umain+0x517>
+		panic("read /mmapfile: %e", r);
+	if (memcmp(buf, data, LEN) != 0)
+  8002d4:	83 ec 04             	sub    $0x4,%esp
+  8002d7:	68 64 20 00 00       	push   $0x2064
+  8002dc:	68 80 80 80 00       	push   $0x808080
+  8002e1:	68 00 60 80 00       	push   $0x806000
+  8002e6:	e8 d3 0b 00 00       	call   800ebe <memcmp>
+  8002eb:	83 c4 10             	add    $0x10,%esp
+  8002ee:	85 c0                	test   %eax,%eax
+  8002f0:	0f 85 66 02 00 00    	jne    80055c <umain+0x529>
+		panic("private write changed the file");
+	cprintf("mmap private is good\n");
+  8002f6:	83 ec 0c             	sub    $0xc,%esp
+  8002f9:	68 f6 44 80 00       	push   $0x8044f6
+  8002fe:	e8 cf 03 00 00       	call   8006d2 <cprintf>
+
+	munmap(VA, LEN);
+  800303:	83 c4 08             	add    $0x8,%esp
+  800306:	68 64 20 00 00       	push   $0x2064
+  80030b:	68 00 00 00 a0       	push   $0xa0000000
+  800310:	e8 b0 22 00 00       	call   8025c5 <munmap>
+	munmap(VA2, LEN);
+  800315:	83 c4 08             	add    $0x8,%esp
+  800318:	68 64 20 00 00       	push   $0x2064
+  80031d:	68 00 00 00 a1       	push   $0xa1000000
+  800322:	e8 9e 22 00 00       	call   8025c5 <munmap>
+	close(f);
+  800327:	89 1c 24             	mov    %ebx,(%esp)
+  80032a:	e8 28 15 00 00       	call   801857 <close>
+
+	// Two instances of a program share its text: the waiter keeps
+	// its copy mapped while the checker counts the references.
+	if ((waiter = spawnl("/testmmap", "testmmap", "wait", 0)) < 0)
+  80032f:	6a 00                	push   $0x0
+  800331:	68 00 44 80 00       	push   $0x804400
+  800336:	68 0d 45 80 00       	push   $0x80450d
+  80033b:	68 0c 45 80 00       	push   $0x80450c
+  800340:	e8 e5 30 00 00       	call   80342a <spawnl>
+  800345:	89 c3                	mov    %eax,%ebx
+  800347:	83 c4 20             	add    $0x20,%esp
+  80034a:	85 c0                	test   %eax,%eax
+  80034c:	0f 88 1e 02 00 00    	js     800570 <umain+0x53d>
+		panic("spawn: %e", waiter);
+	if ((checker = spawnl("/testmmap", "testmmap", "check", 0)) < 0)
+  800352:	6a 00                	push   $0x0
+  800354:	68 20 45 80 00       	push   $0x804520
+  800359:	68 0d 45 80 00       	push   $0x80450d
+  80035e:	68 0c 45 80 00       	push   $0x80450c
+  800363:	e8 c2 30 00 00       	call   80342a <spawnl>
+  800368:	83 c4 10             	add    $0x10,%esp
+  80036b:	85 c0                	test   %eax,%eax
+  80036d:	0f 88 0f 02 00 00    	js     800582 <umain+0x54f>
+		panic("spawn: %e", checker);
+	wait(checker);
+  800373:	83 ec 0c             	sub    $0xc,%esp
+  800376:	50                   	push   %eax
+  800377:	e8 d4 38 00 00       	call   803c50 <wait>
+	ipc_send(waiter, 0, NULL, 0);
+  80037c:	6a 00                	push   $0x0
+  80037e:	6a 00                	push   $0x0
+  800380:	6a 00                	push   $0x0
+  800382:	53                   	push   %ebx
+  800383:	e8 b0 11 00 00       	call   801538 <ipc_send>
+	wait(waiter);
+  800388:	83 c4 14             	add    $0x14,%esp
+  80038b:	53                   	push   %ebx
+  80038c:	e8 bf 38 00 00       	call   803c50 <wait>
+}
+  800391:	83 c4 10             	add    $0x10,%esp
+  800394:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800397:	c9                   	leave
+  800398:	c3                   	ret
+
+static void
+childofspawn(char *what)
+{
+	if (strcmp(what, "wait") == 0) {
+  800399:	83 ec 08             	sub    $0x8,%esp
+  80039c:	68 00 44 80 00       	push   $0x804400
+  8003a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8003a4:	ff 70 04             	push   0x4(%eax)
+  8003a7:	e8 c5 09 00 00       	call   800d71 <strcmp>
+  8003ac:	83 c4 10             	add    $0x10,%esp
+  8003af:	85 c0                	test   %eax,%eax
+  8003b1:	74 42                	je     8003f5 <umain+0x3c2>
+		ipc_recv(NULL, NULL, NULL);
+		exit();
+	}
+
+	// The file server's cached page, the waiter's and ours
+	if (uvpt[PGNUM(umain)] & PTE_W)
+  8003b3:	b8 33 00 80 00       	mov    $0x800033,%eax
+  8003b8:	c1 e8 0c             	shr    $0xc,%eax
+  8003bb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8003c2:	a8 02                	test   $0x2,%al
+  8003c4:	75 47                	jne    80040d <umain+0x3da>
+		panic("spawned text is writable");
+	if (pageref((void *) umain) < 3)
+  8003c6:	83 ec 0c             	sub    $0xc,%esp
+  8003c9:	68 33 00 80 00       	push   $0x800033
+  8003ce:	e8 72 29 00 00       	call   802d45 <pageref>
+  8003d3:	83 c4 10             	add    $0x10,%esp
+  8003d6:	83 f8 02             	cmp    $0x2,%eax
+  8003d9:	7e 46                	jle    800421 <umain+0x3ee>
+		panic("spawned text has %d references", pageref((void *) umain));
+	cprintf("spawn shares text pages\n");
+  8003db:	83 ec 0c             	sub    $0xc,%esp
+  8003de:	68 2e 44 80 00       	push   $0x80442e
+  8003e3:	e8 ea 02 00 00       	call   8006d2 <cprintf>
+	exit();
+  8003e8:	e8 f0 01 00 00       	call   8005dd <exit>
+}
+  8003ed:	83 c4 10             	add    $0x10,%esp
+  8003f0:	e9 4f fc ff ff       	jmp    800044 <umain+0x11>
+		ipc_recv(NULL, NULL, NULL);
+  8003f5:	83 ec 04             	sub    $0x4,%esp
+  8003f8:	6a 00                	push   $0x0
+  8003fa:	6a 00                	push   $0x0
+  8003fc:	6a 00                	push   $0x0
+  8003fe:	e8 ca 10 00 00       	call   8014cd <ipc_recv>
+		exit();
+  800403:	e8 d5 01 00 00       	call   8005dd <exit>
+  800408:	83 c4 10             	add    $0x10,%esp
+  80040b:	eb a6                	jmp    8003b3 <umain+0x380>
+		panic("spawned text is writable");
+  80040d:	83 ec 04             	sub    $0x4,%esp
+  800410:	68 05 44 80 00       	push   $0x804405
+  800415:	6a 62                	push   $0x62
+  800417:	68 1e 44 80 00       	push   $0x80441e
+  80041c:	e8 d6 01 00 00       	call   8005f7 <_panic>
+		panic("spawned text has %d references", pageref((void *) umain));
+  800421:	83 ec 0c             	sub    $0xc,%esp
+  800424:	68 33 00 80 00       	push   $0x800033
+  800429:	e8 17 29 00 00       	call   802d45 <pageref>
+  80042e:	50                   	push   %eax
+  80042f:	68 28 45 80 00       	push   $0x804528
+  800434:	6a 64                	push   $0x64
+  800436:	68 1e 44 80 00       	push   $0x80441e
+  80043b:	e8 b7 01 00 00       	call   8005f7 <_panic>
+		panic("open /mmapfile: %e", f);
+  800440:	50                   	push   %eax
+  800441:	68 51 44 80 00       	push   $0x804451
+  800446:	6a 1c                	push   $0x1c
+  800448:	68 1e 44 80 00       	push   $0x80441e
+  80044d:	e8 a5 01 00 00       	call   8005f7 <_panic>
+		panic("write /mmapfile: %e", r);
+  800452:	50                   	push   %eax
+  800453:	68 64 44 80 00       	push   $0x804464
+  800458:	6a 1e                	push   $0x1e
+  80045a:	68 1e 44 80 00       	push   $0x80441e
+  80045f:	e8 93 01 00 00       	call   8005f7 <_panic>
+		panic("open /mmapfile: %e", f);
+  800464:	50                   	push   %eax
+  800465:	68 51 44 80 00       	push   $0x804451
+  80046a:	6a 22                	push   $0x22
+  80046c:	68 1e 44 80 00       	push   $0x80441e
+  800471:	e8 81 01 00 00       	call   8005f7 <_panic>
+		panic("writable shared mmap returned %d", r);
+  800476:	50                   	push   %eax
+  800477:	68 48 45 80 00       	push   $0x804548
+  80047c:	6a 26                	push   $0x26
+  80047e:	68 1e 44 80 00       	push   $0x80441e
+  800483:	e8 6f 01 00 00       	call   8005f7 <_panic>
+		panic("mmap shared: %e", r);
+  800488:	50                   	push   %eax
+  800489:	68 78 44 80 00       	push   $0x804478
+  80048e:	6a 28                	push   $0x28
+  800490:	68 1e 44 80 00       	push   $0x80441e
+  800495:	e8 5d 01 00 00       	call   8005f7 <_panic>
+		panic("mmap shared 2: %e", r);
+  80049a:	50                   	push   %eax
+  80049b:	68 88 44 80 00       	push   $0x804488
+  8004a0:	6a 2a                	push   $0x2a
+  8004a2:	68 1e 44 80 00       	push   $0x80441e
+  8004a7:	e8 4b 01 00 00       	call   8005f7 <_panic>
+		panic("shared mapping holds wrong data");
+  8004ac:	83 ec 04             	sub    $0x4,%esp
+  8004af:	68 6c 45 80 00       	push   $0x80456c
+  8004b4:	6a 2c                	push   $0x2c
+  8004b6:	68 1e 44 80 00       	push   $0x80441e
+  8004bb:	e8 37 01 00 00       	call   8005f7 <_panic>
+			panic("shared mapping is writable");
+  8004c0:	83 ec 04             	sub    $0x4,%esp
+  8004c3:	68 af 44 80 00       	push   $0x8044af
+  8004c8:	6a 2f                	push   $0x2f
+  8004ca:	68 1e 44 80 00       	push   $0x80441e
+  8004cf:	e8 23 01 00 00       	call   8005f7 <_panic>
+			panic("shared mappings do not share pages");
+  8004d4:	83 ec 04             	sub    $0x4,%esp
+  8004d7:	68 8c 45 80 00       	push   $0x80458c
+  8004dc:	6a 31                	push   $0x31
+  8004de:	68 1e 44 80 00       	push   $0x80441e
+  8004e3:	e8 0f 01 00 00       	call   8005f7 <_panic>
+		panic("mmap private: %e", r);
+  8004e8:	50                   	push   %eax
+  8004e9:	68 ca 44 80 00       	push   $0x8044ca
+  8004ee:	6a 37                	push   $0x37
+  8004f0:	68 1e 44 80 00       	push   $0x80441e
+  8004f5:	e8 fd 00 00 00       	call   8005f7 <_panic>
+		panic("private mapping holds wrong data");
+  8004fa:	83 ec 04             	sub    $0x4,%esp
+  8004fd:	68 b0 45 80 00       	push   $0x8045b0
+  800502:	6a 39                	push   $0x39
+  800504:	68 1e 44 80 00       	push   $0x80441e
+  800509:	e8 e9 00 00 00       	call   8005f7 <_panic>
+		panic("private mapping did not take the write");
+  80050e:	83 ec 04             	sub    $0x4,%esp
+  800511:	68 d4 45 80 00       	push   $0x8045d4
+  800516:	6a 3c                	push   $0x3c
+  800518:	68 1e 44 80 00       	push   $0x80441e
+  80051d:	e8 d5 00 00 00       	call   8005f7 <_panic>
+		panic("private write went to the shared page");
+  800522:	83 ec 04             	sub    $0x4,%esp
+  800525:	68 fc 45 80 00       	push   $0x8045fc
+  80052a:	6a 3e                	push   $0x3e
+  80052c:	68 1e 44 80 00       	push   $0x80441e
+  800531:	e8 c1 00 00 00       	call   8005f7 <_panic>
+		panic("private write showed in the shared mapping");
+  800536:	83 ec 04             	sub    $0x4,%esp
+  800539:	68 24 46 80 00       	push   $0x804624
+  80053e:	6a 40                	push   $0x40
+  800540:	68 1e 44 80 00       	push   $0x80441e
+  800545:	e8 ad 00 00 00       	call   8005f7 <_panic>
+		panic("read /mmapfile: %e", r);
+  80054a:	50                   	push   %eax
+  80054b:	68 e3 44 80 00       	push   $0x8044e3
+  800550:	6a 44                	push   $0x44
+  800552:	68 1e 44 80 00       	push   $0x80441e
+  800557:	e8 9b 00 00 00       	call   8005f7 <_panic>
+		panic("private write changed the file");
+  80055c:	83 ec 04             	sub    $0x4,%esp
+  80055f:	68 50 46 80 00       	push   $0x804650
+  800564:	6a 46                	push   $0x46
+  800566:	68 1e 44 80 00       	push   $0x80441e
+  80056b:	e8 87 00 00 00       	call   8005f7 <_panic>
+		panic("spawn: %e", waiter);
+  800570:	50                   	push   %eax
+  800571:	68 16 45 80 00       	push   $0x804516
+  800576:	6a 50                	push   $0x50
+  800578:	68 1e 44 80 00       	push   $0x80441e
+  80057d:	e8 75 00 00 00       	call   8005f7 <_panic>
+		panic("spawn: %e", checker);
+  800582:	50                   	push   %eax
+  800583:	68 16 45 80 00       	push   $0x804516
+  800588:	6a 52                	push   $0x52
+  80058a:	68 1e 44 80 00       	push   $0x80441e
+  80058f:	e8 63 00 00 00       	call   8005f7 <_panic>
+
+00800594 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800594:	55                   	push   %ebp
+  800595:	89 e5                	mov    %esp,%ebp
+  800597:	56                   	push   %esi
+  800598:	53                   	push   %ebx
+  800599:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80059c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80059f:	e8 e2 0a 00 00       	call   801086 <sys_getenvid>
+  8005a4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005a9:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8005af:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8005b4:	a3 e4 a0 80 00       	mov    %eax,0x80a0e4
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8005b9:	85 db                	test   %ebx,%ebx
+  8005bb:	7e 07                	jle    8005c4 <libmain+0x30>
+		binaryname = argv[0];
+  8005bd:	8b 06                	mov    (%esi),%eax
+  8005bf:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8005c4:	83 ec 08             	sub    $0x8,%esp
+  8005c7:	56                   	push   %esi
+  8005c8:	53                   	push   %ebx
+  8005c9:	e8 65 fa ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8005ce:	e8 0a 00 00 00       	call   8005dd <exit>
+}
+  8005d3:	83 c4 10             	add    $0x10,%esp
+  8005d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005d9:	5b                   	pop    %ebx
+  8005da:	5e                   	pop    %esi
+  8005db:	5d                   	pop    %ebp
+  8005dc:	c3                   	ret
+
+008005dd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8005dd:	55                   	push   %ebp
+  8005de:	89 e5                	mov    %esp,%ebp
+  8005e0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8005e3:	e8 9c 12 00 00       	call   801884 <close_all>
+	sys_env_destroy(0);
+  8005e8:	83 ec 0c             	sub    $0xc,%esp
+  8005eb:	6a 00                	push   $0x0
+  8005ed:	e8 4b 0a 00 00       	call   80103d <sys_env_destroy>
+}
+  8005f2:	83 c4 10             	add    $0x10,%esp
+  8005f5:	c9                   	leave
+  8005f6:	c3                   	ret
+
+008005f7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8005f7:	55                   	push   %ebp
+  8005f8:	89 e5                	mov    %esp,%ebp
+  8005fa:	56                   	push   %esi
+  8005fb:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8005fc:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005ff:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800605:	e8 7c 0a 00 00       	call   801086 <sys_getenvid>
+  80060a:	83 ec 0c             	sub    $0xc,%esp
+  80060d:	ff 75 0c             	push   0xc(%ebp)
+  800610:	ff 75 08             	push   0x8(%ebp)
+  800613:	56                   	push   %esi
+  800614:	50                   	push   %eax
+  800615:	68 7c 46 80 00       	push   $0x80467c
+  80061a:	e8 b3 00 00 00       	call   8006d2 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80061f:	83 c4 18             	add    $0x18,%esp
+  800622:	53                   	push   %ebx
+  800623:	ff 75 10             	push   0x10(%ebp)
+  800626:	e8 56 00 00 00       	call   800681 <vcprintf>
+	cprintf("\n");
+  80062b:	c7 04 24 17 4c 80 00 	movl   $0x804c17,(%esp)
+  800632:	e8 9b 00 00 00       	call   8006d2 <cprintf>
+  800637:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80063a:	cc                   	int3
+	while (1)
+  80063b:	eb fd                	jmp    80063a <_panic+0x43>
+
+0080063d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80063d:	55                   	push   %ebp
+  80063e:	89 e5                	mov    %esp,%ebp
+  800640:	53                   	push   %ebx
+  800641:	83 ec 04             	sub    $0x4,%esp
+  800644:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800647:	8b 13                	mov    (%ebx),%edx
+  800649:	8d 42 01             	lea    0x1(%edx),%eax
+  80064c:	89 03                	mov    %eax,(%ebx)
+  80064e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800651:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800655:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80065a:	74 09                	je     800665 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80065c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800660:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800663:	c9                   	leave
+  800664:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800665:	83 ec 08             	sub    $0x8,%esp
+  800668:	68 ff 00 00 00       	push   $0xff
+  80066d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800670:	50                   	push   %eax
+  800671:	e8 7a 09 00 00       	call   800ff0 <sys_cputs>
+		b->idx = 0;
+  800676:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80067c:	83 c4 10             	add    $0x10,%esp
+  80067f:	eb db                	jmp    80065c <putch+0x1f>
+
+00800681 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800681:	55                   	push   %ebp
+  800682:	89 e5                	mov    %esp,%ebp
+  800684:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80068a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800691:	00 00 00 
+	b.cnt = 0;
+  800694:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80069b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80069e:	ff 75 0c             	push   0xc(%ebp)
+  8006a1:	ff 75 08             	push   0x8(%ebp)
+  8006a4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8006aa:	50                   	push   %eax
+  8006ab:	68 3d 06 80 00       	push   $0x80063d
+  8006b0:	e8 14 01 00 00       	call   8007c9 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8006b5:	83 c4 08             	add    $0x8,%esp
+  8006b8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8006be:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8006c4:	50                   	push   %eax
+  8006c5:	e8 26 09 00 00       	call   800ff0 <sys_cputs>
+
+	return b.cnt;
+}
+  8006ca:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8006d0:	c9                   	leave
+  8006d1:	c3                   	ret
+
+008006d2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8006d2:	55                   	push   %ebp
+  8006d3:	89 e5                	mov    %esp,%ebp
+  8006d5:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8006d8:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8006db:	50                   	push   %eax
+  8006dc:	ff 75 08             	push   0x8(%ebp)
+  8006df:	e8 9d ff ff ff       	call   800681 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8006e4:	c9                   	leave
+  8006e5:	c3                   	ret
+
+008006e6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8006e6:	55                   	push   %ebp
+  8006e7:	89 e5                	mov    %esp,%ebp
+  8006e9:	57                   	push   %edi
+  8006ea:	56                   	push   %esi
+  8006eb:	53                   	push   %ebx
+  8006ec:	83 ec 1c             	sub    $0x1c,%esp
+  8006ef:	89 c7                	mov    %eax,%edi
+  8006f1:	89 d6                	mov    %edx,%esi
+  8006f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006f9:	89 d1                	mov    %edx,%ecx
+  8006fb:	89 c2                	mov    %eax,%edx
+  8006fd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800700:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800703:	8b 45 10             	mov    0x10(%ebp),%eax
+  800706:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800709:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80070c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800713:	39 c2                	cmp    %eax,%edx
+  800715:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800718:	72 3e                	jb     800758 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80071a:	83 ec 0c             	sub    $0xc,%esp
+  80071d:	ff 75 18             	push   0x18(%ebp)
+  800720:	83 eb 01             	sub    $0x1,%ebx
+  800723:	53                   	push   %ebx
+  800724:	50                   	push   %eax
+  800725:	83 ec 08             	sub    $0x8,%esp
+  800728:	ff 75 e4             	push   -0x1c(%ebp)
+  80072b:	ff 75 e0             	push   -0x20(%ebp)
+  80072e:	ff 75 dc             	push   -0x24(%ebp)
+  800731:	ff 75 d8             	push   -0x28(%ebp)
+  800734:	e8 5a 3b 00 00       	call   804293 <__udivdi3>
+  800739:	83 c4 18             	add    $0x18,%esp
+  80073c:	52                   	push   %edx
+  80073d:	50                   	push   %eax
+  80073e:	89 f2                	mov    %esi,%edx
+  800740:	89 f8                	mov    %edi,%eax
+  800742:	e8 9f ff ff ff       	call   8006e6 <printnum>
+  800747:	83 c4 20             	add    $0x20,%esp
+  80074a:	eb 13                	jmp    80075f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80074c:	83 ec 08             	sub    $0x8,%esp
+  80074f:	56                   	push   %esi
+  800750:	ff 75 18             	push   0x18(%ebp)
+  800753:	ff d7                	call   *%edi
+  800755:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800758:	83 eb 01             	sub    $0x1,%ebx
+  80075b:	85 db                	test   %ebx,%ebx
+  80075d:	7f ed                	jg     80074c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80075f:	83 ec 08             	sub    $0x8,%esp
+  800762:	56                   	push   %esi
+  800763:	83 ec 04             	sub    $0x4,%esp
+  800766:	ff 75 e4             	push   -0x1c(%ebp)
+  800769:	ff 75 e0             	push   -0x20(%ebp)
+  80076c:	ff 75 dc             	push   -0x24(%ebp)
+  80076f:	ff 75 d8             	push   -0x28(%ebp)
+  800772:	e8 3a 3b 00 00       	call   8042b1 <__umoddi3>
+  800777:	83 c4 14             	add    $0x14,%esp
+  80077a:	0f be 80 9f 46 80 00 	movsbl 0x80469f(%eax),%eax
+  800781:	50                   	push   %eax
+  800782:	ff d7                	call   *%edi
+}
+  800784:	83 c4 10             	add    $0x10,%esp
+  800787:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80078a:	5b                   	pop    %ebx
+  80078b:	5e                   	pop    %esi
+  80078c:	5f                   	pop    %edi
+  80078d:	5d                   	pop    %ebp
+  80078e:	c3                   	ret
+
+0080078f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80078f:	55                   	push   %ebp
+  800790:	89 e5                	mov    %esp,%ebp
+  800792:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800795:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800799:	8b 10                	mov    (%eax),%edx
+  80079b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80079e:	73 0a                	jae    8007aa <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8007a0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8007a3:	89 08                	mov    %ecx,(%eax)
+  8007a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007a8:	88 02                	mov    %al,(%edx)
+}
+  8007aa:	5d                   	pop    %ebp
+  8007ab:	c3                   	ret
+
+008007ac <printfmt>:
+{
+  8007ac:	55                   	push   %ebp
+  8007ad:	89 e5                	mov    %esp,%ebp
+  8007af:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8007b2:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8007b5:	50                   	push   %eax
+  8007b6:	ff 75 10             	push   0x10(%ebp)
+  8007b9:	ff 75 0c             	push   0xc(%ebp)
+  8007bc:	ff 75 08             	push   0x8(%ebp)
+  8007bf:	e8 05 00 00 00       	call   8007c9 <vprintfmt>
+}
+  8007c4:	83 c4 10             	add    $0x10,%esp
+  8007c7:	c9                   	leave
+  8007c8:	c3                   	ret
+
+008007c9 <vprintfmt>:
+{
+  8007c9:	55                   	push   %ebp
+  8007ca:	89 e5                	mov    %esp,%ebp
+  8007cc:	57                   	push   %edi
+  8007cd:	56                   	push   %esi
+  8007ce:	53                   	push   %ebx
+  8007cf:	83 ec 2c             	sub    $0x2c,%esp
+  8007d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007d8:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8007db:	eb 0a                	jmp    8007e7 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8007dd:	83 ec 08             	sub    $0x8,%esp
+  8007e0:	53                   	push   %ebx
+  8007e1:	50                   	push   %eax
+  8007e2:	ff d6                	call   *%esi
+  8007e4:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007e7:	83 c7 01             	add    $0x1,%edi
+  8007ea:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8007ee:	83 f8 25             	cmp    $0x25,%eax
+  8007f1:	74 0c                	je     8007ff <vprintfmt+0x36>
+			if (ch == '\0')
+  8007f3:	85 c0                	test   %eax,%eax
+  8007f5:	75 e6                	jne    8007dd <vprintfmt+0x14>
+}
+  8007f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007fa:	5b                   	pop    %ebx
+  8007fb:	5e                   	pop    %esi
+  8007fc:	5f                   	pop    %edi
+  8007fd:	5d                   	pop    %ebp
+  8007fe:	c3                   	ret
+		padc = ' ';
+  8007ff:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800803:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80080a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800811:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800818:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80081d:	8d 47 01             	lea    0x1(%edi),%eax
+  800820:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800823:	0f b6 17             	movzbl (%edi),%edx
+  800826:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800829:	3c 55                	cmp    $0x55,%al
+  80082b:	0f 87 cf 03 00 00    	ja     800c00 <vprintfmt+0x437>
+  800831:	0f b6 c0             	movzbl %al,%eax
+  800834:	ff 24 85 00 48 80 00 	jmp    *0x804800(,%eax,4)
+  80083b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80083e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800842:	eb d9                	jmp    80081d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800844:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800847:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80084b:	eb d0                	jmp    80081d <vprintfmt+0x54>
+  80084d:	0f b6 d2             	movzbl %dl,%edx
+  800850:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800853:	b8 00 00 00 00       	mov    $0x0,%eax
+  800858:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80085b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80085e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800862:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800865:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800868:	83 f9 09             	cmp    $0x9,%ecx
+  80086b:	77 55                	ja     8008c2 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80086d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800870:	eb e9                	jmp    80085b <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800872:	8b 45 14             	mov    0x14(%ebp),%eax
+  800875:	8b 00                	mov    (%eax),%eax
+  800877:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80087a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087d:	8d 40 04             	lea    0x4(%eax),%eax
+  800880:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800883:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800886:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80088a:	79 91                	jns    80081d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80088c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80088f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800892:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800899:	eb 82                	jmp    80081d <vprintfmt+0x54>
+			if (width < 0)
+  80089b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80089e:	85 d2                	test   %edx,%edx
+  8008a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a5:	0f 49 c2             	cmovns %edx,%eax
+  8008a8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008ab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8008ae:	e9 6a ff ff ff       	jmp    80081d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008b3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8008b6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8008bd:	e9 5b ff ff ff       	jmp    80081d <vprintfmt+0x54>
+  8008c2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8008c5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008c8:	eb bc                	jmp    800886 <vprintfmt+0xbd>
+			lflag++;
+  8008ca:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8008cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8008d0:	e9 48 ff ff ff       	jmp    80081d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8008d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d8:	8d 78 04             	lea    0x4(%eax),%edi
+  8008db:	83 ec 08             	sub    $0x8,%esp
+  8008de:	53                   	push   %ebx
+  8008df:	ff 30                	push   (%eax)
+  8008e1:	ff d6                	call   *%esi
+			break;
+  8008e3:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8008e6:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8008e9:	e9 b1 02 00 00       	jmp    800b9f <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8008ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f1:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8008f4:	8b 10                	mov    (%eax),%edx
+  8008f6:	89 d0                	mov    %edx,%eax
+  8008f8:	f7 d8                	neg    %eax
+  8008fa:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8008fd:	83 f8 11             	cmp    $0x11,%eax
+  800900:	7f 23                	jg     800925 <vprintfmt+0x15c>
+  800902:	8b 14 85 60 49 80 00 	mov    0x804960(,%eax,4),%edx
+  800909:	85 d2                	test   %edx,%edx
+  80090b:	74 18                	je     800925 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80090d:	52                   	push   %edx
+  80090e:	68 19 4a 80 00       	push   $0x804a19
+  800913:	53                   	push   %ebx
+  800914:	56                   	push   %esi
+  800915:	e8 92 fe ff ff       	call   8007ac <printfmt>
+  80091a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80091d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800920:	e9 7a 02 00 00       	jmp    800b9f <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800925:	50                   	push   %eax
+  800926:	68 b7 46 80 00       	push   $0x8046b7
+  80092b:	53                   	push   %ebx
+  80092c:	56                   	push   %esi
+  80092d:	e8 7a fe ff ff       	call   8007ac <printfmt>
+  800932:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800935:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800938:	e9 62 02 00 00       	jmp    800b9f <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80093d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800940:	83 c0 04             	add    $0x4,%eax
+  800943:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800946:	8b 45 14             	mov    0x14(%ebp),%eax
+  800949:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80094b:	85 c9                	test   %ecx,%ecx
+  80094d:	b8 b0 46 80 00       	mov    $0x8046b0,%eax
+  800952:	0f 45 c1             	cmovne %ecx,%eax
+  800955:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800958:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80095c:	7e 06                	jle    800964 <vprintfmt+0x19b>
+  80095e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800962:	75 0b                	jne    80096f <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800964:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800967:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80096a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80096d:	eb 5c                	jmp    8009cb <vprintfmt+0x202>
+  80096f:	83 ec 08             	sub    $0x8,%esp
+  800972:	ff 75 d0             	push   -0x30(%ebp)
+  800975:	ff 75 cc             	push   -0x34(%ebp)
+  800978:	e8 20 03 00 00       	call   800c9d <strnlen>
+  80097d:	89 c2                	mov    %eax,%edx
+  80097f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800982:	29 d0                	sub    %edx,%eax
+  800984:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800987:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80098b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80098e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800991:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800993:	eb 0e                	jmp    8009a3 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800995:	83 ec 08             	sub    $0x8,%esp
+  800998:	53                   	push   %ebx
+  800999:	57                   	push   %edi
+  80099a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80099d:	83 ee 01             	sub    $0x1,%esi
+  8009a0:	83 c4 10             	add    $0x10,%esp
+  8009a3:	85 f6                	test   %esi,%esi
+  8009a5:	7f ee                	jg     800995 <vprintfmt+0x1cc>
+  8009a7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009aa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ad:	85 c0                	test   %eax,%eax
+  8009af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009b4:	0f 49 d0             	cmovns %eax,%edx
+  8009b7:	29 d0                	sub    %edx,%eax
+  8009b9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009bc:	eb a6                	jmp    800964 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8009be:	83 ec 08             	sub    $0x8,%esp
+  8009c1:	53                   	push   %ebx
+  8009c2:	52                   	push   %edx
+  8009c3:	ff 55 08             	call   *0x8(%ebp)
+  8009c6:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009c9:	89 f1                	mov    %esi,%ecx
+  8009cb:	8d 71 01             	lea    0x1(%ecx),%esi
+  8009ce:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8009d2:	0f be d0             	movsbl %al,%edx
+  8009d5:	85 d2                	test   %edx,%edx
+  8009d7:	74 28                	je     800a01 <vprintfmt+0x238>
+  8009d9:	85 ff                	test   %edi,%edi
+  8009db:	78 05                	js     8009e2 <vprintfmt+0x219>
+  8009dd:	83 ef 01             	sub    $0x1,%edi
+  8009e0:	78 30                	js     800a12 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8009e2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8009e6:	74 d6                	je     8009be <vprintfmt+0x1f5>
+  8009e8:	0f be c0             	movsbl %al,%eax
+  8009eb:	83 e8 20             	sub    $0x20,%eax
+  8009ee:	83 f8 5e             	cmp    $0x5e,%eax
+  8009f1:	76 cb                	jbe    8009be <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8009f3:	83 ec 08             	sub    $0x8,%esp
+  8009f6:	53                   	push   %ebx
+  8009f7:	6a 3f                	push   $0x3f
+  8009f9:	ff 55 08             	call   *0x8(%ebp)
+  8009fc:	83 c4 10             	add    $0x10,%esp
+  8009ff:	eb c8                	jmp    8009c9 <vprintfmt+0x200>
+  800a01:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a04:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a07:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800a0a:	01 d0                	add    %edx,%eax
+  800a0c:	29 c8                	sub    %ecx,%eax
+  800a0e:	89 c7                	mov    %eax,%edi
+  800a10:	eb 13                	jmp    800a25 <vprintfmt+0x25c>
+  800a12:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a15:	eb ed                	jmp    800a04 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800a17:	83 ec 08             	sub    $0x8,%esp
+  800a1a:	53                   	push   %ebx
+  800a1b:	6a 20                	push   $0x20
+  800a1d:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800a1f:	83 ef 01             	sub    $0x1,%edi
+  800a22:	83 c4 10             	add    $0x10,%esp
+  800a25:	85 ff                	test   %edi,%edi
+  800a27:	7f ee                	jg     800a17 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a29:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800a2c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a2f:	e9 6b 01 00 00       	jmp    800b9f <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800a34:	83 f9 01             	cmp    $0x1,%ecx
+  800a37:	7f 1f                	jg     800a58 <vprintfmt+0x28f>
+	else if (lflag)
+  800a39:	85 c9                	test   %ecx,%ecx
+  800a3b:	74 67                	je     800aa4 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800a3d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a40:	8b 00                	mov    (%eax),%eax
+  800a42:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a45:	89 c1                	mov    %eax,%ecx
+  800a47:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a4a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a50:	8d 40 04             	lea    0x4(%eax),%eax
+  800a53:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a56:	eb 17                	jmp    800a6f <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800a58:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5b:	8b 50 04             	mov    0x4(%eax),%edx
+  800a5e:	8b 00                	mov    (%eax),%eax
+  800a60:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a63:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a66:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a69:	8d 40 08             	lea    0x8(%eax),%eax
+  800a6c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800a6f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a72:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800a75:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800a7a:	85 c9                	test   %ecx,%ecx
+  800a7c:	0f 89 03 01 00 00    	jns    800b85 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800a82:	83 ec 08             	sub    $0x8,%esp
+  800a85:	53                   	push   %ebx
+  800a86:	6a 2d                	push   $0x2d
+  800a88:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800a8a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a8d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800a90:	f7 da                	neg    %edx
+  800a92:	83 d1 00             	adc    $0x0,%ecx
+  800a95:	f7 d9                	neg    %ecx
+  800a97:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800a9a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800a9f:	e9 e1 00 00 00       	jmp    800b85 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800aa4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa7:	8b 00                	mov    (%eax),%eax
+  800aa9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800aac:	89 c1                	mov    %eax,%ecx
+  800aae:	c1 f9 1f             	sar    $0x1f,%ecx
+  800ab1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ab4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ab7:	8d 40 04             	lea    0x4(%eax),%eax
+  800aba:	89 45 14             	mov    %eax,0x14(%ebp)
+  800abd:	eb b0                	jmp    800a6f <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800abf:	83 f9 01             	cmp    $0x1,%ecx
+  800ac2:	7f 1e                	jg     800ae2 <vprintfmt+0x319>
+	else if (lflag)
+  800ac4:	85 c9                	test   %ecx,%ecx
+  800ac6:	74 32                	je     800afa <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800ac8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800acb:	8b 10                	mov    (%eax),%edx
+  800acd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad2:	8d 40 04             	lea    0x4(%eax),%eax
+  800ad5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800ad8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800add:	e9 a3 00 00 00       	jmp    800b85 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800ae2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ae5:	8b 10                	mov    (%eax),%edx
+  800ae7:	8b 48 04             	mov    0x4(%eax),%ecx
+  800aea:	8d 40 08             	lea    0x8(%eax),%eax
+  800aed:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800af0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800af5:	e9 8b 00 00 00       	jmp    800b85 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800afa:	8b 45 14             	mov    0x14(%ebp),%eax
+  800afd:	8b 10                	mov    (%eax),%edx
+  800aff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b04:	8d 40 04             	lea    0x4(%eax),%eax
+  800b07:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b0a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800b0f:	eb 74                	jmp    800b85 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800b11:	83 f9 01             	cmp    $0x1,%ecx
+  800b14:	7f 1b                	jg     800b31 <vprintfmt+0x368>
+	else if (lflag)
+  800b16:	85 c9                	test   %ecx,%ecx
+  800b18:	74 2c                	je     800b46 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800b1a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b1d:	8b 10                	mov    (%eax),%edx
+  800b1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b24:	8d 40 04             	lea    0x4(%eax),%eax
+  800b27:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b2a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800b2f:	eb 54                	jmp    800b85 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800b31:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b34:	8b 10                	mov    (%eax),%edx
+  800b36:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b39:	8d 40 08             	lea    0x8(%eax),%eax
+  800b3c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b3f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800b44:	eb 3f                	jmp    800b85 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800b46:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b49:	8b 10                	mov    (%eax),%edx
+  800b4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b50:	8d 40 04             	lea    0x4(%eax),%eax
+  800b53:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b56:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800b5b:	eb 28                	jmp    800b85 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800b5d:	83 ec 08             	sub    $0x8,%esp
+  800b60:	53                   	push   %ebx
+  800b61:	6a 30                	push   $0x30
+  800b63:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800b65:	83 c4 08             	add    $0x8,%esp
+  800b68:	53                   	push   %ebx
+  800b69:	6a 78                	push   $0x78
+  800b6b:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800b6d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b70:	8b 10                	mov    (%eax),%edx
+  800b72:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800b77:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800b7a:	8d 40 04             	lea    0x4(%eax),%eax
+  800b7d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b80:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800b85:	83 ec 0c             	sub    $0xc,%esp
+  800b88:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800b8c:	50                   	push   %eax
+  800b8d:	ff 75 e0             	push   -0x20(%ebp)
+  800b90:	57                   	push   %edi
+  800b91:	51                   	push   %ecx
+  800b92:	52                   	push   %edx
+  800b93:	89 da                	mov    %ebx,%edx
+  800b95:	89 f0                	mov    %esi,%eax
+  800b97:	e8 4a fb ff ff       	call   8006e6 <printnum>
+			break;
+  800b9c:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800b9f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ba2:	e9 40 fc ff ff       	jmp    8007e7 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800ba7:	83 f9 01             	cmp    $0x1,%ecx
+  800baa:	7f 1b                	jg     800bc7 <vprintfmt+0x3fe>
+	else if (lflag)
+  800bac:	85 c9                	test   %ecx,%ecx
+  800bae:	74 2c                	je     800bdc <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800bb0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb3:	8b 10                	mov    (%eax),%edx
+  800bb5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bba:	8d 40 04             	lea    0x4(%eax),%eax
+  800bbd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bc0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800bc5:	eb be                	jmp    800b85 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800bc7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bca:	8b 10                	mov    (%eax),%edx
+  800bcc:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bcf:	8d 40 08             	lea    0x8(%eax),%eax
+  800bd2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bd5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800bda:	eb a9                	jmp    800b85 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800bdc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bdf:	8b 10                	mov    (%eax),%edx
+  800be1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800be6:	8d 40 04             	lea    0x4(%eax),%eax
+  800be9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bec:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800bf1:	eb 92                	jmp    800b85 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800bf3:	83 ec 08             	sub    $0x8,%esp
+  800bf6:	53                   	push   %ebx
+  800bf7:	6a 25                	push   $0x25
+  800bf9:	ff d6                	call   *%esi
+			break;
+  800bfb:	83 c4 10             	add    $0x10,%esp
+  800bfe:	eb 9f                	jmp    800b9f <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800c00:	83 ec 08             	sub    $0x8,%esp
+  800c03:	53                   	push   %ebx
+  800c04:	6a 25                	push   $0x25
+  800c06:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c08:	83 c4 10             	add    $0x10,%esp
+  800c0b:	89 f8                	mov    %edi,%eax
+  800c0d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c11:	74 05                	je     800c18 <vprintfmt+0x44f>
+  800c13:	83 e8 01             	sub    $0x1,%eax
+  800c16:	eb f5                	jmp    800c0d <vprintfmt+0x444>
+  800c18:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800c1b:	eb 82                	jmp    800b9f <vprintfmt+0x3d6>
+
+00800c1d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c1d:	55                   	push   %ebp
+  800c1e:	89 e5                	mov    %esp,%ebp
+  800c20:	83 ec 18             	sub    $0x18,%esp
+  800c23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c26:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800c29:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c2c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c30:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c33:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800c3a:	85 c0                	test   %eax,%eax
+  800c3c:	74 26                	je     800c64 <vsnprintf+0x47>
+  800c3e:	85 d2                	test   %edx,%edx
+  800c40:	7e 22                	jle    800c64 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c42:	ff 75 14             	push   0x14(%ebp)
+  800c45:	ff 75 10             	push   0x10(%ebp)
+  800c48:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c4b:	50                   	push   %eax
+  800c4c:	68 8f 07 80 00       	push   $0x80078f
+  800c51:	e8 73 fb ff ff       	call   8007c9 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800c56:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800c59:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800c5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c5f:	83 c4 10             	add    $0x10,%esp
+}
+  800c62:	c9                   	leave
+  800c63:	c3                   	ret
+		return -E_INVAL;
+  800c64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c69:	eb f7                	jmp    800c62 <vsnprintf+0x45>
+
+00800c6b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800c6b:	55                   	push   %ebp
+  800c6c:	89 e5                	mov    %esp,%ebp
+  800c6e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800c71:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800c74:	50                   	push   %eax
+  800c75:	ff 75 10             	push   0x10(%ebp)
+  800c78:	ff 75 0c             	push   0xc(%ebp)
+  800c7b:	ff 75 08             	push   0x8(%ebp)
+  800c7e:	e8 9a ff ff ff       	call   800c1d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800c83:	c9                   	leave
+  800c84:	c3                   	ret
+
+00800c85 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800c85:	55                   	push   %ebp
+  800c86:	89 e5                	mov    %esp,%ebp
+  800c88:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c90:	eb 03                	jmp    800c95 <strlen+0x10>
+		n++;
+  800c92:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800c95:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800c99:	75 f7                	jne    800c92 <strlen+0xd>
+	return n;
+}
+  800c9b:	5d                   	pop    %ebp
+  800c9c:	c3                   	ret
+
+00800c9d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800c9d:	55                   	push   %ebp
+  800c9e:	89 e5                	mov    %esp,%ebp
+  800ca0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ca3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cab:	eb 03                	jmp    800cb0 <strnlen+0x13>
+		n++;
+  800cad:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cb0:	39 d0                	cmp    %edx,%eax
+  800cb2:	74 08                	je     800cbc <strnlen+0x1f>
+  800cb4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800cb8:	75 f3                	jne    800cad <strnlen+0x10>
+  800cba:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800cbc:	89 d0                	mov    %edx,%eax
+  800cbe:	5d                   	pop    %ebp
+  800cbf:	c3                   	ret
+
+00800cc0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800cc0:	55                   	push   %ebp
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	53                   	push   %ebx
+  800cc4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cc7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800cca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccf:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800cd3:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800cd6:	83 c0 01             	add    $0x1,%eax
+  800cd9:	84 d2                	test   %dl,%dl
+  800cdb:	75 f2                	jne    800ccf <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800cdd:	89 c8                	mov    %ecx,%eax
+  800cdf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ce2:	c9                   	leave
+  800ce3:	c3                   	ret
+
+00800ce4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ce4:	55                   	push   %ebp
+  800ce5:	89 e5                	mov    %esp,%ebp
+  800ce7:	53                   	push   %ebx
+  800ce8:	83 ec 10             	sub    $0x10,%esp
+  800ceb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800cee:	53                   	push   %ebx
+  800cef:	e8 91 ff ff ff       	call   800c85 <strlen>
+  800cf4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800cf7:	ff 75 0c             	push   0xc(%ebp)
+  800cfa:	01 d8                	add    %ebx,%eax
+  800cfc:	50                   	push   %eax
+  800cfd:	e8 be ff ff ff       	call   800cc0 <strcpy>
+	return dst;
+}
+  800d02:	89 d8                	mov    %ebx,%eax
+  800d04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d07:	c9                   	leave
+  800d08:	c3                   	ret
+
+00800d09 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d09:	55                   	push   %ebp
+  800d0a:	89 e5                	mov    %esp,%ebp
+  800d0c:	56                   	push   %esi
+  800d0d:	53                   	push   %ebx
+  800d0e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d11:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d14:	89 f3                	mov    %esi,%ebx
+  800d16:	03 5d 10             	add    0x10(%ebp),%ebx
+  800d19:	89 f0                	mov    %esi,%eax
+  800d1b:	eb 0f                	jmp    800d2c <strncpy+0x23>
+		*dst++ = *src;
+  800d1d:	83 c0 01             	add    $0x1,%eax
+  800d20:	0f b6 0a             	movzbl (%edx),%ecx
+  800d23:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800d26:	80 f9 01             	cmp    $0x1,%cl
+  800d29:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800d2c:	39 d8                	cmp    %ebx,%eax
+  800d2e:	75 ed                	jne    800d1d <strncpy+0x14>
+	}
+	return ret;
+}
+  800d30:	89 f0                	mov    %esi,%eax
+  800d32:	5b                   	pop    %ebx
+  800d33:	5e                   	pop    %esi
+  800d34:	5d                   	pop    %ebp
+  800d35:	c3                   	ret
+
+00800d36 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800d36:	55                   	push   %ebp
+  800d37:	89 e5                	mov    %esp,%ebp
+  800d39:	56                   	push   %esi
+  800d3a:	53                   	push   %ebx
+  800d3b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d41:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800d44:	89 f0                	mov    %esi,%eax
+  800d46:	85 d2                	test   %edx,%edx
+  800d48:	74 21                	je     800d6b <strlcpy+0x35>
+  800d4a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800d4e:	89 f2                	mov    %esi,%edx
+  800d50:	eb 09                	jmp    800d5b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800d52:	83 c1 01             	add    $0x1,%ecx
+  800d55:	83 c2 01             	add    $0x1,%edx
+  800d58:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800d5b:	39 c2                	cmp    %eax,%edx
+  800d5d:	74 09                	je     800d68 <strlcpy+0x32>
+  800d5f:	0f b6 19             	movzbl (%ecx),%ebx
+  800d62:	84 db                	test   %bl,%bl
+  800d64:	75 ec                	jne    800d52 <strlcpy+0x1c>
+  800d66:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800d68:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800d6b:	29 f0                	sub    %esi,%eax
+}
+  800d6d:	5b                   	pop    %ebx
+  800d6e:	5e                   	pop    %esi
+  800d6f:	5d                   	pop    %ebp
+  800d70:	c3                   	ret
+
+00800d71 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800d71:	55                   	push   %ebp
+  800d72:	89 e5                	mov    %esp,%ebp
+  800d74:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d77:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800d7a:	eb 06                	jmp    800d82 <strcmp+0x11>
+		p++, q++;
+  800d7c:	83 c1 01             	add    $0x1,%ecx
+  800d7f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800d82:	0f b6 01             	movzbl (%ecx),%eax
+  800d85:	84 c0                	test   %al,%al
+  800d87:	74 04                	je     800d8d <strcmp+0x1c>
+  800d89:	3a 02                	cmp    (%edx),%al
+  800d8b:	74 ef                	je     800d7c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d8d:	0f b6 c0             	movzbl %al,%eax
+  800d90:	0f b6 12             	movzbl (%edx),%edx
+  800d93:	29 d0                	sub    %edx,%eax
+}
+  800d95:	5d                   	pop    %ebp
+  800d96:	c3                   	ret
+
+00800d97 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800d97:	55                   	push   %ebp
+  800d98:	89 e5                	mov    %esp,%ebp
+  800d9a:	53                   	push   %ebx
+  800d9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800da4:	eb 09                	jmp    800daf <strncmp+0x18>
+		n--, p++, q++;
+  800da6:	83 ea 01             	sub    $0x1,%edx
+  800da9:	83 c0 01             	add    $0x1,%eax
+  800dac:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800daf:	85 d2                	test   %edx,%edx
+  800db1:	74 18                	je     800dcb <strncmp+0x34>
+  800db3:	0f b6 18             	movzbl (%eax),%ebx
+  800db6:	84 db                	test   %bl,%bl
+  800db8:	74 04                	je     800dbe <strncmp+0x27>
+  800dba:	3a 19                	cmp    (%ecx),%bl
+  800dbc:	74 e8                	je     800da6 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800dbe:	0f b6 00             	movzbl (%eax),%eax
+  800dc1:	0f b6 11             	movzbl (%ecx),%edx
+  800dc4:	29 d0                	sub    %edx,%eax
+}
+  800dc6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dc9:	c9                   	leave
+  800dca:	c3                   	ret
+		return 0;
+  800dcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd0:	eb f4                	jmp    800dc6 <strncmp+0x2f>
+
+00800dd2 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800dd2:	55                   	push   %ebp
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dd8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ddc:	eb 03                	jmp    800de1 <strchr+0xf>
+  800dde:	83 c0 01             	add    $0x1,%eax
+  800de1:	0f b6 10             	movzbl (%eax),%edx
+  800de4:	84 d2                	test   %dl,%dl
+  800de6:	74 06                	je     800dee <strchr+0x1c>
+		if (*s == c)
+  800de8:	38 ca                	cmp    %cl,%dl
+  800dea:	75 f2                	jne    800dde <strchr+0xc>
+  800dec:	eb 05                	jmp    800df3 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800dee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800df3:	5d                   	pop    %ebp
+  800df4:	c3                   	ret
+
+00800df5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800df5:	55                   	push   %ebp
+  800df6:	89 e5                	mov    %esp,%ebp
+  800df8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dfb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800dff:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800e02:	38 ca                	cmp    %cl,%dl
+  800e04:	74 09                	je     800e0f <strfind+0x1a>
+  800e06:	84 d2                	test   %dl,%dl
+  800e08:	74 05                	je     800e0f <strfind+0x1a>
+	for (; *s; s++)
+  800e0a:	83 c0 01             	add    $0x1,%eax
+  800e0d:	eb f0                	jmp    800dff <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800e0f:	5d                   	pop    %ebp
+  800e10:	c3                   	ret
+
+00800e11 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	57                   	push   %edi
+  800e15:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e18:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800e1b:	85 c9                	test   %ecx,%ecx
+  800e1d:	74 20                	je     800e3f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800e1f:	89 f8                	mov    %edi,%eax
+  800e21:	09 c8                	or     %ecx,%eax
+  800e23:	a8 03                	test   $0x3,%al
+  800e25:	75 12                	jne    800e39 <memset+0x28>
+		c &= 0xFF;
+  800e27:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800e2b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800e31:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800e34:	fc                   	cld
+  800e35:	f3 ab                	rep stos %eax,%es:(%edi)
+  800e37:	eb 06                	jmp    800e3f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800e39:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e3c:	fc                   	cld
+  800e3d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800e3f:	89 f8                	mov    %edi,%eax
+  800e41:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800e44:	c9                   	leave
+  800e45:	c3                   	ret
+
+00800e46 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800e46:	55                   	push   %ebp
+  800e47:	89 e5                	mov    %esp,%ebp
+  800e49:	57                   	push   %edi
+  800e4a:	56                   	push   %esi
+  800e4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e4e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e51:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800e54:	39 c6                	cmp    %eax,%esi
+  800e56:	73 32                	jae    800e8a <memmove+0x44>
+  800e58:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800e5b:	39 d0                	cmp    %edx,%eax
+  800e5d:	73 2b                	jae    800e8a <memmove+0x44>
+		s += n;
+		d += n;
+  800e5f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e62:	89 d6                	mov    %edx,%esi
+  800e64:	09 fe                	or     %edi,%esi
+  800e66:	09 ce                	or     %ecx,%esi
+  800e68:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800e6e:	75 0e                	jne    800e7e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800e70:	83 ef 04             	sub    $0x4,%edi
+  800e73:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800e76:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800e79:	fd                   	std
+  800e7a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e7c:	eb 09                	jmp    800e87 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800e7e:	83 ef 01             	sub    $0x1,%edi
+  800e81:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800e84:	fd                   	std
+  800e85:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800e87:	fc                   	cld
+  800e88:	eb 1a                	jmp    800ea4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e8a:	89 f2                	mov    %esi,%edx
+  800e8c:	09 c2                	or     %eax,%edx
+  800e8e:	09 ca                	or     %ecx,%edx
+  800e90:	f6 c2 03             	test   $0x3,%dl
+  800e93:	75 0a                	jne    800e9f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800e95:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800e98:	89 c7                	mov    %eax,%edi
+  800e9a:	fc                   	cld
+  800e9b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e9d:	eb 05                	jmp    800ea4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800e9f:	89 c7                	mov    %eax,%edi
+  800ea1:	fc                   	cld
+  800ea2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ea4:	5e                   	pop    %esi
+  800ea5:	5f                   	pop    %edi
+  800ea6:	5d                   	pop    %ebp
+  800ea7:	c3                   	ret
+
+00800ea8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ea8:	55                   	push   %ebp
+  800ea9:	89 e5                	mov    %esp,%ebp
+  800eab:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800eae:	ff 75 10             	push   0x10(%ebp)
+  800eb1:	ff 75 0c             	push   0xc(%ebp)
+  800eb4:	ff 75 08             	push   0x8(%ebp)
+  800eb7:	e8 8a ff ff ff       	call   800e46 <memmove>
+}
+  800ebc:	c9                   	leave
+  800ebd:	c3                   	ret
+
+00800ebe <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ebe:	55                   	push   %ebp
+  800ebf:	89 e5                	mov    %esp,%ebp
+  800ec1:	56                   	push   %esi
+  800ec2:	53                   	push   %ebx
+  800ec3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ec6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ec9:	89 c6                	mov    %eax,%esi
+  800ecb:	03 75 10             	add    0x10(%ebp),%esi
+  800ece:	eb 06                	jmp    800ed6 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ed0:	83 c0 01             	add    $0x1,%eax
+  800ed3:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ed6:	39 f0                	cmp    %esi,%eax
+  800ed8:	74 14                	je     800eee <memcmp+0x30>
+		if (*s1 != *s2)
+  800eda:	0f b6 08             	movzbl (%eax),%ecx
+  800edd:	0f b6 1a             	movzbl (%edx),%ebx
+  800ee0:	38 d9                	cmp    %bl,%cl
+  800ee2:	74 ec                	je     800ed0 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ee4:	0f b6 c1             	movzbl %cl,%eax
+  800ee7:	0f b6 db             	movzbl %bl,%ebx
+  800eea:	29 d8                	sub    %ebx,%eax
+  800eec:	eb 05                	jmp    800ef3 <memcmp+0x35>
+	}
+
+	return 0;
+  800eee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ef3:	5b                   	pop    %ebx
+  800ef4:	5e                   	pop    %esi
+  800ef5:	5d                   	pop    %ebp
+  800ef6:	c3                   	ret
+
+00800ef7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ef7:	55                   	push   %ebp
+  800ef8:	89 e5                	mov    %esp,%ebp
+  800efa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800efd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800f00:	89 c2                	mov    %eax,%edx
+  800f02:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800f05:	eb 03                	jmp    800f0a <memfind+0x13>
+  800f07:	83 c0 01             	add    $0x1,%eax
+  800f0a:	39 d0                	cmp    %edx,%eax
+  800f0c:	73 04                	jae    800f12 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f0e:	38 08                	cmp    %cl,(%eax)
+  800f10:	75 f5                	jne    800f07 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800f12:	5d                   	pop    %ebp
+  800f13:	c3                   	ret
+
+00800f14 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800f14:	55                   	push   %ebp
+  800f15:	89 e5                	mov    %esp,%ebp
+  800f17:	57                   	push   %edi
+  800f18:	56                   	push   %esi
+  800f19:	53                   	push   %ebx
+  800f1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800f20:	eb 03                	jmp    800f25 <strtol+0x11>
+		s++;
+  800f22:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800f25:	0f b6 02             	movzbl (%edx),%eax
+  800f28:	3c 20                	cmp    $0x20,%al
+  800f2a:	74 f6                	je     800f22 <strtol+0xe>
+  800f2c:	3c 09                	cmp    $0x9,%al
+  800f2e:	74 f2                	je     800f22 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800f30:	3c 2b                	cmp    $0x2b,%al
+  800f32:	74 2a                	je     800f5e <strtol+0x4a>
+	int neg = 0;
+  800f34:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800f39:	3c 2d                	cmp    $0x2d,%al
+  800f3b:	74 2b                	je     800f68 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f3d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800f43:	75 0f                	jne    800f54 <strtol+0x40>
+  800f45:	80 3a 30             	cmpb   $0x30,(%edx)
+  800f48:	74 28                	je     800f72 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800f4a:	85 db                	test   %ebx,%ebx
+  800f4c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f51:	0f 44 d8             	cmove  %eax,%ebx
+  800f54:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f59:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800f5c:	eb 46                	jmp    800fa4 <strtol+0x90>
+		s++;
+  800f5e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800f61:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f66:	eb d5                	jmp    800f3d <strtol+0x29>
+		s++, neg = 1;
+  800f68:	83 c2 01             	add    $0x1,%edx
+  800f6b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f70:	eb cb                	jmp    800f3d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f72:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800f76:	74 0e                	je     800f86 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800f78:	85 db                	test   %ebx,%ebx
+  800f7a:	75 d8                	jne    800f54 <strtol+0x40>
+		s++, base = 8;
+  800f7c:	83 c2 01             	add    $0x1,%edx
+  800f7f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800f84:	eb ce                	jmp    800f54 <strtol+0x40>
+		s += 2, base = 16;
+  800f86:	83 c2 02             	add    $0x2,%edx
+  800f89:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800f8e:	eb c4                	jmp    800f54 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800f90:	0f be c0             	movsbl %al,%eax
+  800f93:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800f96:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800f99:	7d 3a                	jge    800fd5 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800f9b:	83 c2 01             	add    $0x1,%edx
+  800f9e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800fa2:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800fa4:	0f b6 02             	movzbl (%edx),%eax
+  800fa7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800faa:	89 f3                	mov    %esi,%ebx
+  800fac:	80 fb 09             	cmp    $0x9,%bl
+  800faf:	76 df                	jbe    800f90 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800fb1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800fb4:	89 f3                	mov    %esi,%ebx
+  800fb6:	80 fb 19             	cmp    $0x19,%bl
+  800fb9:	77 08                	ja     800fc3 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800fbb:	0f be c0             	movsbl %al,%eax
+  800fbe:	83 e8 57             	sub    $0x57,%eax
+  800fc1:	eb d3                	jmp    800f96 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800fc3:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800fc6:	89 f3                	mov    %esi,%ebx
+  800fc8:	80 fb 19             	cmp    $0x19,%bl
+  800fcb:	77 08                	ja     800fd5 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800fcd:	0f be c0             	movsbl %al,%eax
+  800fd0:	83 e8 37             	sub    $0x37,%eax
+  800fd3:	eb c1                	jmp    800f96 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800fd5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800fd9:	74 05                	je     800fe0 <strtol+0xcc>
+		*endptr = (char *) s;
+  800fdb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fde:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800fe0:	89 c8                	mov    %ecx,%eax
+  800fe2:	f7 d8                	neg    %eax
+  800fe4:	85 ff                	test   %edi,%edi
+  800fe6:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800fe9:	89 c8                	mov    %ecx,%eax
+  800feb:	5b                   	pop    %ebx
+  800fec:	5e                   	pop    %esi
+  800fed:	5f                   	pop    %edi
+  800fee:	5d                   	pop    %ebp
+  800fef:	c3                   	ret
+
+00800ff0 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ff0:	55                   	push   %ebp
+  800ff1:	89 e5                	mov    %esp,%ebp
+  800ff3:	57                   	push   %edi
+  800ff4:	56                   	push   %esi
+  800ff5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ff6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ffb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801001:	89 c3                	mov    %eax,%ebx
+  801003:	89 c7                	mov    %eax,%edi
+  801005:	55                   	push   %ebp
+  801006:	89 e5                	mov    %esp,%ebp
+  801008:	8d 35 10 10 80 00    	lea    0x801010,%esi
+  80100e:	0f 34                	sysenter
+  801010:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  801011:	5b                   	pop    %ebx
+  801012:	5e                   	pop    %esi
+  801013:	5f                   	pop    %edi
+  801014:	5d                   	pop    %ebp
+  801015:	c3                   	ret
+
+00801016 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801016:	55                   	push   %ebp
+  801017:	89 e5                	mov    %esp,%ebp
+  801019:	57                   	push   %edi
+  80101a:	56                   	push   %esi
+  80101b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80101c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801021:	b8 01 00 00 00       	mov    $0x1,%eax
+  801026:	89 d1                	mov    %edx,%ecx
+  801028:	89 d3                	mov    %edx,%ebx
+  80102a:	89 d7                	mov    %edx,%edi
+  80102c:	55                   	push   %ebp
+  80102d:	89 e5                	mov    %esp,%ebp
+  80102f:	8d 35 37 10 80 00    	lea    0x801037,%esi
+  801035:	0f 34                	sysenter
+  801037:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  801038:	5b                   	pop    %ebx
+  801039:	5e                   	pop    %esi
+  80103a:	5f                   	pop    %edi
+  80103b:	5d                   	pop    %ebp
+  80103c:	c3                   	ret
+
+0080103d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80103d:	55                   	push   %ebp
+  80103e:	89 e5                	mov    %esp,%ebp
+  801040:	57                   	push   %edi
+  801041:	56                   	push   %esi
+  801042:	53                   	push   %ebx
+  801043:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801046:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80104b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801053:	89 cb                	mov    %ecx,%ebx
+  801055:	89 cf                	mov    %ecx,%edi
+  801057:	55                   	push   %ebp
+  801058:	89 e5                	mov    %esp,%ebp
+  80105a:	8d 35 62 10 80 00    	lea    0x801062,%esi
+  801060:	0f 34                	sysenter
+  801062:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801063:	85 c0                	test   %eax,%eax
+  801065:	7f 08                	jg     80106f <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  801067:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80106a:	5b                   	pop    %ebx
+  80106b:	5e                   	pop    %esi
+  80106c:	5f                   	pop    %edi
+  80106d:	5d                   	pop    %ebp
+  80106e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106f:	83 ec 0c             	sub    $0xc,%esp
+  801072:	50                   	push   %eax
+  801073:	6a 03                	push   $0x3
+  801075:	68 c7 49 80 00       	push   $0x8049c7
+  80107a:	6a 3d                	push   $0x3d
+  80107c:	68 e4 49 80 00       	push   $0x8049e4
+  801081:	e8 71 f5 ff ff       	call   8005f7 <_panic>
+
+00801086 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	57                   	push   %edi
+  80108a:	56                   	push   %esi
+  80108b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80108c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801091:	b8 02 00 00 00       	mov    $0x2,%eax
+  801096:	89 d1                	mov    %edx,%ecx
+  801098:	89 d3                	mov    %edx,%ebx
+  80109a:	89 d7                	mov    %edx,%edi
+  80109c:	55                   	push   %ebp
+  80109d:	89 e5                	mov    %esp,%ebp
+  80109f:	8d 35 a7 10 80 00    	lea    0x8010a7,%esi
+  8010a5:	0f 34                	sysenter
+  8010a7:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  8010a8:	5b                   	pop    %ebx
+  8010a9:	5e                   	pop    %esi
+  8010aa:	5f                   	pop    %edi
+  8010ab:	5d                   	pop    %ebp
+  8010ac:	c3                   	ret
+
+008010ad <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8010ad:	55                   	push   %ebp
+  8010ae:	89 e5                	mov    %esp,%ebp
+  8010b0:	57                   	push   %edi
+  8010b1:	56                   	push   %esi
+  8010b2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010bd:	89 d1                	mov    %edx,%ecx
+  8010bf:	89 d3                	mov    %edx,%ebx
+  8010c1:	89 d7                	mov    %edx,%edi
+  8010c3:	89 d6                	mov    %edx,%esi
+  8010c5:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8010c7:	5b                   	pop    %ebx
+  8010c8:	5e                   	pop    %esi
+  8010c9:	5f                   	pop    %edi
+  8010ca:	5d                   	pop    %ebp
+  8010cb:	c3                   	ret
+
+008010cc <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8010cc:	55                   	push   %ebp
+  8010cd:	89 e5                	mov    %esp,%ebp
+  8010cf:	57                   	push   %edi
+  8010d0:	56                   	push   %esi
+  8010d1:	53                   	push   %ebx
+  8010d2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8010d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010db:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	8d 35 f3 10 80 00    	lea    0x8010f3,%esi
+  8010f1:	0f 34                	sysenter
+  8010f3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010f4:	85 c0                	test   %eax,%eax
+  8010f6:	7f 08                	jg     801100 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  8010f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010fb:	5b                   	pop    %ebx
+  8010fc:	5e                   	pop    %esi
+  8010fd:	5f                   	pop    %edi
+  8010fe:	5d                   	pop    %ebp
+  8010ff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801100:	83 ec 0c             	sub    $0xc,%esp
+  801103:	50                   	push   %eax
+  801104:	6a 04                	push   $0x4
+  801106:	68 c7 49 80 00       	push   $0x8049c7
+  80110b:	6a 3d                	push   $0x3d
+  80110d:	68 e4 49 80 00       	push   $0x8049e4
+  801112:	e8 e0 f4 ff ff       	call   8005f7 <_panic>
+
+00801117 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801117:	55                   	push   %ebp
+  801118:	89 e5                	mov    %esp,%ebp
+  80111a:	57                   	push   %edi
+  80111b:	56                   	push   %esi
+  80111c:	53                   	push   %ebx
+  80111d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801120:	8b 55 08             	mov    0x8(%ebp),%edx
+  801123:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801126:	b8 05 00 00 00       	mov    $0x5,%eax
+  80112b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80112e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801131:	8b 75 18             	mov    0x18(%ebp),%esi
+  801134:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801136:	85 c0                	test   %eax,%eax
+  801138:	7f 08                	jg     801142 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80113a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113d:	5b                   	pop    %ebx
+  80113e:	5e                   	pop    %esi
+  80113f:	5f                   	pop    %edi
+  801140:	5d                   	pop    %ebp
+  801141:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801142:	83 ec 0c             	sub    $0xc,%esp
+  801145:	50                   	push   %eax
+  801146:	6a 05                	push   $0x5
+  801148:	68 c7 49 80 00       	push   $0x8049c7
+  80114d:	6a 23                	push   $0x23
+  80114f:	68 e4 49 80 00       	push   $0x8049e4
+  801154:	e8 9e f4 ff ff       	call   8005f7 <_panic>
+
+00801159 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801159:	55                   	push   %ebp
+  80115a:	89 e5                	mov    %esp,%ebp
+  80115c:	57                   	push   %edi
+  80115d:	56                   	push   %esi
+  80115e:	53                   	push   %ebx
+  80115f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801162:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801167:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801172:	89 df                	mov    %ebx,%edi
+  801174:	55                   	push   %ebp
+  801175:	89 e5                	mov    %esp,%ebp
+  801177:	8d 35 7f 11 80 00    	lea    0x80117f,%esi
+  80117d:	0f 34                	sysenter
+  80117f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801180:	85 c0                	test   %eax,%eax
+  801182:	7f 08                	jg     80118c <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  801184:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801187:	5b                   	pop    %ebx
+  801188:	5e                   	pop    %esi
+  801189:	5f                   	pop    %edi
+  80118a:	5d                   	pop    %ebp
+  80118b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118c:	83 ec 0c             	sub    $0xc,%esp
+  80118f:	50                   	push   %eax
+  801190:	6a 06                	push   $0x6
+  801192:	68 c7 49 80 00       	push   $0x8049c7
+  801197:	6a 3d                	push   $0x3d
+  801199:	68 e4 49 80 00       	push   $0x8049e4
+  80119e:	e8 54 f4 ff ff       	call   8005f7 <_panic>
+
+008011a3 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8011a3:	55                   	push   %ebp
+  8011a4:	89 e5                	mov    %esp,%ebp
+  8011a6:	57                   	push   %edi
+  8011a7:	56                   	push   %esi
+  8011a8:	53                   	push   %ebx
+  8011a9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8011ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011bc:	89 df                	mov    %ebx,%edi
+  8011be:	55                   	push   %ebp
+  8011bf:	89 e5                	mov    %esp,%ebp
+  8011c1:	8d 35 c9 11 80 00    	lea    0x8011c9,%esi
+  8011c7:	0f 34                	sysenter
+  8011c9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011ca:	85 c0                	test   %eax,%eax
+  8011cc:	7f 08                	jg     8011d6 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  8011ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d1:	5b                   	pop    %ebx
+  8011d2:	5e                   	pop    %esi
+  8011d3:	5f                   	pop    %edi
+  8011d4:	5d                   	pop    %ebp
+  8011d5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011d6:	83 ec 0c             	sub    $0xc,%esp
+  8011d9:	50                   	push   %eax
+  8011da:	6a 08                	push   $0x8
+  8011dc:	68 c7 49 80 00       	push   $0x8049c7
+  8011e1:	6a 3d                	push   $0x3d
+  8011e3:	68 e4 49 80 00       	push   $0x8049e4
+  8011e8:	e8 0a f4 ff ff       	call   8005f7 <_panic>
+
+008011ed <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8011ed:	55                   	push   %ebp
+  8011ee:	89 e5                	mov    %esp,%ebp
+  8011f0:	57                   	push   %edi
+  8011f1:	56                   	push   %esi
+  8011f2:	53                   	push   %ebx
+  8011f3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8011f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801201:	b8 09 00 00 00       	mov    $0x9,%eax
+  801206:	89 df                	mov    %ebx,%edi
+  801208:	55                   	push   %ebp
+  801209:	89 e5                	mov    %esp,%ebp
+  80120b:	8d 35 13 12 80 00    	lea    0x801213,%esi
+  801211:	0f 34                	sysenter
+  801213:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801214:	85 c0                	test   %eax,%eax
+  801216:	7f 08                	jg     801220 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  801218:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80121b:	5b                   	pop    %ebx
+  80121c:	5e                   	pop    %esi
+  80121d:	5f                   	pop    %edi
+  80121e:	5d                   	pop    %ebp
+  80121f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801220:	83 ec 0c             	sub    $0xc,%esp
+  801223:	50                   	push   %eax
+  801224:	6a 09                	push   $0x9
+  801226:	68 c7 49 80 00       	push   $0x8049c7
+  80122b:	6a 3d                	push   $0x3d
+  80122d:	68 e4 49 80 00       	push   $0x8049e4
+  801232:	e8 c0 f3 ff ff       	call   8005f7 <_panic>
+
+00801237 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801237:	55                   	push   %ebp
+  801238:	89 e5                	mov    %esp,%ebp
+  80123a:	57                   	push   %edi
+  80123b:	56                   	push   %esi
+  80123c:	53                   	push   %ebx
+  80123d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801240:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801245:	8b 55 08             	mov    0x8(%ebp),%edx
+  801248:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801250:	89 df                	mov    %ebx,%edi
+  801252:	55                   	push   %ebp
+  801253:	89 e5                	mov    %esp,%ebp
+  801255:	8d 35 5d 12 80 00    	lea    0x80125d,%esi
+  80125b:	0f 34                	sysenter
+  80125d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80125e:	85 c0                	test   %eax,%eax
+  801260:	7f 08                	jg     80126a <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  801262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801265:	5b                   	pop    %ebx
+  801266:	5e                   	pop    %esi
+  801267:	5f                   	pop    %edi
+  801268:	5d                   	pop    %ebp
+  801269:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80126a:	83 ec 0c             	sub    $0xc,%esp
+  80126d:	50                   	push   %eax
+  80126e:	6a 0a                	push   $0xa
+  801270:	68 c7 49 80 00       	push   $0x8049c7
+  801275:	6a 3d                	push   $0x3d
+  801277:	68 e4 49 80 00       	push   $0x8049e4
+  80127c:	e8 76 f3 ff ff       	call   8005f7 <_panic>
+
+00801281 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801281:	55                   	push   %ebp
+  801282:	89 e5                	mov    %esp,%ebp
+  801284:	57                   	push   %edi
+  801285:	56                   	push   %esi
+  801286:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801287:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801292:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801295:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801298:	55                   	push   %ebp
+  801299:	89 e5                	mov    %esp,%ebp
+  80129b:	8d 35 a3 12 80 00    	lea    0x8012a3,%esi
+  8012a1:	0f 34                	sysenter
+  8012a3:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  8012a4:	5b                   	pop    %ebx
+  8012a5:	5e                   	pop    %esi
+  8012a6:	5f                   	pop    %edi
+  8012a7:	5d                   	pop    %ebp
+  8012a8:	c3                   	ret
+
+008012a9 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  8012a9:	55                   	push   %ebp
+  8012aa:	89 e5                	mov    %esp,%ebp
+  8012ac:	57                   	push   %edi
+  8012ad:	56                   	push   %esi
+  8012ae:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b5:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012bd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012c0:	55                   	push   %ebp
+  8012c1:	89 e5                	mov    %esp,%ebp
+  8012c3:	8d 35 cb 12 80 00    	lea    0x8012cb,%esi
+  8012c9:	0f 34                	sysenter
+  8012cb:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  8012cc:	5b                   	pop    %ebx
+  8012cd:	5e                   	pop    %esi
+  8012ce:	5f                   	pop    %edi
+  8012cf:	5d                   	pop    %ebp
+  8012d0:	c3                   	ret
+
+008012d1 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  8012d1:	55                   	push   %ebp
+  8012d2:	89 e5                	mov    %esp,%ebp
+  8012d4:	57                   	push   %edi
+  8012d5:	56                   	push   %esi
+  8012d6:	53                   	push   %ebx
+  8012d7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012da:	be 00 00 00 00       	mov    $0x0,%esi
+  8012df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ed:	89 f7                	mov    %esi,%edi
+  8012ef:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012f1:	85 c0                	test   %eax,%eax
+  8012f3:	7f 08                	jg     8012fd <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8012f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f8:	5b                   	pop    %ebx
+  8012f9:	5e                   	pop    %esi
+  8012fa:	5f                   	pop    %edi
+  8012fb:	5d                   	pop    %ebp
+  8012fc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012fd:	83 ec 0c             	sub    $0xc,%esp
+  801300:	50                   	push   %eax
+  801301:	6a 0d                	push   $0xd
+  801303:	68 c7 49 80 00       	push   $0x8049c7
+  801308:	6a 23                	push   $0x23
+  80130a:	68 e4 49 80 00       	push   $0x8049e4
+  80130f:	e8 e3 f2 ff ff       	call   8005f7 <_panic>
+
+00801314 <sys_ipc_recv>:
+{
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  80131a:	6a 00                	push   $0x0
+  80131c:	6a 01                	push   $0x1
+  80131e:	ff 75 08             	push   0x8(%ebp)
+  801321:	e8 ab ff ff ff       	call   8012d1 <sys_ipc_recvv>
+}
+  801326:	c9                   	leave
+  801327:	c3                   	ret
+
+00801328 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  801328:	55                   	push   %ebp
+  801329:	89 e5                	mov    %esp,%ebp
+  80132b:	57                   	push   %edi
+  80132c:	56                   	push   %esi
+  80132d:	53                   	push   %ebx
+  80132e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801331:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801336:	8b 55 08             	mov    0x8(%ebp),%edx
+  801339:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801341:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801344:	89 de                	mov    %ebx,%esi
+  801346:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801348:	85 c0                	test   %eax,%eax
+  80134a:	7f 08                	jg     801354 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  80134c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80134f:	5b                   	pop    %ebx
+  801350:	5e                   	pop    %esi
+  801351:	5f                   	pop    %edi
+  801352:	5d                   	pop    %ebp
+  801353:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801354:	83 ec 0c             	sub    $0xc,%esp
+  801357:	50                   	push   %eax
+  801358:	6a 0d                	push   $0xd
+  80135a:	68 c7 49 80 00       	push   $0x8049c7
+  80135f:	6a 23                	push   $0x23
+  801361:	68 e4 49 80 00       	push   $0x8049e4
+  801366:	e8 8c f2 ff ff       	call   8005f7 <_panic>
+
+0080136b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80136b:	55                   	push   %ebp
+  80136c:	89 e5                	mov    %esp,%ebp
+  80136e:	57                   	push   %edi
+  80136f:	56                   	push   %esi
+  801370:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801371:	ba 00 00 00 00       	mov    $0x0,%edx
+  801376:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80137b:	89 d1                	mov    %edx,%ecx
+  80137d:	89 d3                	mov    %edx,%ebx
+  80137f:	89 d7                	mov    %edx,%edi
+  801381:	55                   	push   %ebp
+  801382:	89 e5                	mov    %esp,%ebp
+  801384:	8d 35 8c 13 80 00    	lea    0x80138c,%esi
+  80138a:	0f 34                	sysenter
+  80138c:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  80138d:	5b                   	pop    %ebx
+  80138e:	5e                   	pop    %esi
+  80138f:	5f                   	pop    %edi
+  801390:	5d                   	pop    %ebp
+  801391:	c3                   	ret
+
+00801392 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  801392:	55                   	push   %ebp
+  801393:	89 e5                	mov    %esp,%ebp
+  801395:	57                   	push   %edi
+  801396:	56                   	push   %esi
+  801397:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801398:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8013a8:	89 df                	mov    %ebx,%edi
+  8013aa:	55                   	push   %ebp
+  8013ab:	89 e5                	mov    %esp,%ebp
+  8013ad:	8d 35 b5 13 80 00    	lea    0x8013b5,%esi
+  8013b3:	0f 34                	sysenter
+  8013b5:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  8013b6:	5b                   	pop    %ebx
+  8013b7:	5e                   	pop    %esi
+  8013b8:	5f                   	pop    %edi
+  8013b9:	5d                   	pop    %ebp
+  8013ba:	c3                   	ret
+
+008013bb <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  8013bb:	55                   	push   %ebp
+  8013bc:	89 e5                	mov    %esp,%ebp
+  8013be:	57                   	push   %edi
+  8013bf:	56                   	push   %esi
+  8013c0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8013c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c9:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013ce:	89 cb                	mov    %ecx,%ebx
+  8013d0:	89 cf                	mov    %ecx,%edi
+  8013d2:	55                   	push   %ebp
+  8013d3:	89 e5                	mov    %esp,%ebp
+  8013d5:	8d 35 dd 13 80 00    	lea    0x8013dd,%esi
+  8013db:	0f 34                	sysenter
+  8013dd:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  8013de:	5b                   	pop    %ebx
+  8013df:	5e                   	pop    %esi
+  8013e0:	5f                   	pop    %edi
+  8013e1:	5d                   	pop    %ebp
+  8013e2:	c3                   	ret
+
+008013e3 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  8013e3:	55                   	push   %ebp
+  8013e4:	89 e5                	mov    %esp,%ebp
+  8013e6:	57                   	push   %edi
+  8013e7:	56                   	push   %esi
+  8013e8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8013e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f4:	b8 12 00 00 00       	mov    $0x12,%eax
+  8013f9:	89 df                	mov    %ebx,%edi
+  8013fb:	55                   	push   %ebp
+  8013fc:	89 e5                	mov    %esp,%ebp
+  8013fe:	8d 35 06 14 80 00    	lea    0x801406,%esi
+  801404:	0f 34                	sysenter
+  801406:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  801407:	5b                   	pop    %ebx
+  801408:	5e                   	pop    %esi
+  801409:	5f                   	pop    %edi
+  80140a:	5d                   	pop    %ebp
+  80140b:	c3                   	ret
+
+0080140c <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  80140c:	55                   	push   %ebp
+  80140d:	89 e5                	mov    %esp,%ebp
+  80140f:	57                   	push   %edi
+  801410:	56                   	push   %esi
+  801411:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801412:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801417:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801422:	89 df                	mov    %ebx,%edi
+  801424:	55                   	push   %ebp
+  801425:	89 e5                	mov    %esp,%ebp
+  801427:	8d 35 2f 14 80 00    	lea    0x80142f,%esi
+  80142d:	0f 34                	sysenter
+  80142f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  801430:	5b                   	pop    %ebx
+  801431:	5e                   	pop    %esi
+  801432:	5f                   	pop    %edi
+  801433:	5d                   	pop    %ebp
+  801434:	c3                   	ret
+
+00801435 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  801435:	55                   	push   %ebp
+  801436:	89 e5                	mov    %esp,%ebp
+  801438:	57                   	push   %edi
+  801439:	56                   	push   %esi
+  80143a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80143b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801441:	b8 13 00 00 00       	mov    $0x13,%eax
+  801446:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801449:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80144c:	55                   	push   %ebp
+  80144d:	89 e5                	mov    %esp,%ebp
+  80144f:	8d 35 57 14 80 00    	lea    0x801457,%esi
+  801455:	0f 34                	sysenter
+  801457:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  801458:	5b                   	pop    %ebx
+  801459:	5e                   	pop    %esi
+  80145a:	5f                   	pop    %edi
+  80145b:	5d                   	pop    %ebp
+  80145c:	c3                   	ret
+
+0080145d <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  80145d:	55                   	push   %ebp
+  80145e:	89 e5                	mov    %esp,%ebp
+  801460:	57                   	push   %edi
+  801461:	56                   	push   %esi
+  801462:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801463:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801468:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801470:	89 cb                	mov    %ecx,%ebx
+  801472:	89 cf                	mov    %ecx,%edi
+  801474:	89 ce                	mov    %ecx,%esi
+  801476:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  801478:	5b                   	pop    %ebx
+  801479:	5e                   	pop    %esi
+  80147a:	5f                   	pop    %edi
+  80147b:	5d                   	pop    %ebp
+  80147c:	c3                   	ret
+
+0080147d <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  80147d:	55                   	push   %ebp
+  80147e:	89 e5                	mov    %esp,%ebp
+  801480:	57                   	push   %edi
+  801481:	56                   	push   %esi
+  801482:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801483:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801488:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801490:	89 cb                	mov    %ecx,%ebx
+  801492:	89 cf                	mov    %ecx,%edi
+  801494:	55                   	push   %ebp
+  801495:	89 e5                	mov    %esp,%ebp
+  801497:	8d 35 9f 14 80 00    	lea    0x80149f,%esi
+  80149d:	0f 34                	sysenter
+  80149f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8014a0:	5b                   	pop    %ebx
+  8014a1:	5e                   	pop    %esi
+  8014a2:	5f                   	pop    %edi
+  8014a3:	5d                   	pop    %ebp
+  8014a4:	c3                   	ret
+
+008014a5 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8014a5:	55                   	push   %ebp
+  8014a6:	89 e5                	mov    %esp,%ebp
+  8014a8:	57                   	push   %edi
+  8014a9:	56                   	push   %esi
+  8014aa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8014ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b3:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014b8:	89 cb                	mov    %ecx,%ebx
+  8014ba:	89 cf                	mov    %ecx,%edi
+  8014bc:	55                   	push   %ebp
+  8014bd:	89 e5                	mov    %esp,%ebp
+  8014bf:	8d 35 c7 14 80 00    	lea    0x8014c7,%esi
+  8014c5:	0f 34                	sysenter
+  8014c7:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8014c8:	5b                   	pop    %ebx
+  8014c9:	5e                   	pop    %esi
+  8014ca:	5f                   	pop    %edi
+  8014cb:	5d                   	pop    %ebp
+  8014cc:	c3                   	ret
+
+008014cd <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8014cd:	55                   	push   %ebp
+  8014ce:	89 e5                	mov    %esp,%ebp
+  8014d0:	56                   	push   %esi
+  8014d1:	53                   	push   %ebx
+  8014d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014d5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8014db:	85 c0                	test   %eax,%eax
+  8014dd:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8014e2:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8014e5:	83 ec 0c             	sub    $0xc,%esp
+  8014e8:	50                   	push   %eax
+  8014e9:	e8 26 fe ff ff       	call   801314 <sys_ipc_recv>
+	if (from_env_store)
+  8014ee:	83 c4 10             	add    $0x10,%esp
+  8014f1:	85 f6                	test   %esi,%esi
+  8014f3:	74 14                	je     801509 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8014f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014fa:	85 c0                	test   %eax,%eax
+  8014fc:	75 09                	jne    801507 <ipc_recv+0x3a>
+  8014fe:	8b 15 e4 a0 80 00    	mov    0x80a0e4,%edx
+  801504:	8b 52 74             	mov    0x74(%edx),%edx
+  801507:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  801509:	85 db                	test   %ebx,%ebx
+  80150b:	74 25                	je     801532 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80150d:	85 c0                	test   %eax,%eax
+  80150f:	74 0d                	je     80151e <ipc_recv+0x51>
+  801511:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  801517:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80151a:	5b                   	pop    %ebx
+  80151b:	5e                   	pop    %esi
+  80151c:	5d                   	pop    %ebp
+  80151d:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80151e:	a1 e4 a0 80 00       	mov    0x80a0e4,%eax
+  801523:	8b 40 78             	mov    0x78(%eax),%eax
+  801526:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  801528:	a1 e4 a0 80 00       	mov    0x80a0e4,%eax
+  80152d:	8b 40 70             	mov    0x70(%eax),%eax
+  801530:	eb e5                	jmp    801517 <ipc_recv+0x4a>
+  801532:	85 c0                	test   %eax,%eax
+  801534:	75 e1                	jne    801517 <ipc_recv+0x4a>
+  801536:	eb f0                	jmp    801528 <ipc_recv+0x5b>
+
+00801538 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801538:	55                   	push   %ebp
+  801539:	89 e5                	mov    %esp,%ebp
+  80153b:	57                   	push   %edi
+  80153c:	56                   	push   %esi
+  80153d:	53                   	push   %ebx
+  80153e:	83 ec 0c             	sub    $0xc,%esp
+  801541:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801544:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801547:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80154a:	85 db                	test   %ebx,%ebx
+  80154c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801551:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  801554:	ff 75 14             	push   0x14(%ebp)
+  801557:	53                   	push   %ebx
+  801558:	56                   	push   %esi
+  801559:	57                   	push   %edi
+  80155a:	e8 22 fd ff ff       	call   801281 <sys_ipc_try_send>
+  80155f:	83 c4 10             	add    $0x10,%esp
+  801562:	85 c0                	test   %eax,%eax
+  801564:	74 22                	je     801588 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  801566:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801569:	75 07                	jne    801572 <ipc_send+0x3a>
+		sys_yield();
+  80156b:	e8 3d fb ff ff       	call   8010ad <sys_yield>
+  801570:	eb e2                	jmp    801554 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  801572:	68 f2 49 80 00       	push   $0x8049f2
+  801577:	68 07 4a 80 00       	push   $0x804a07
+  80157c:	6a 39                	push   $0x39
+  80157e:	68 1c 4a 80 00       	push   $0x804a1c
+  801583:	e8 6f f0 ff ff       	call   8005f7 <_panic>
+	}
+}
+  801588:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80158b:	5b                   	pop    %ebx
+  80158c:	5e                   	pop    %esi
+  80158d:	5f                   	pop    %edi
+  80158e:	5d                   	pop    %ebp
+  80158f:	c3                   	ret
+
+00801590 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  801590:	55                   	push   %ebp
+  801591:	89 e5                	mov    %esp,%ebp
+  801593:	57                   	push   %edi
+  801594:	56                   	push   %esi
+  801595:	53                   	push   %ebx
+  801596:	83 ec 10             	sub    $0x10,%esp
+  801599:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80159c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80159f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a2:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8015a5:	85 c0                	test   %eax,%eax
+  8015a7:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8015ac:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8015af:	6a 00                	push   $0x0
+  8015b1:	ff 33                	push   (%ebx)
+  8015b3:	50                   	push   %eax
+  8015b4:	e8 18 fd ff ff       	call   8012d1 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8015b9:	83 c4 10             	add    $0x10,%esp
+  8015bc:	85 c0                	test   %eax,%eax
+  8015be:	75 3c                	jne    8015fc <ipc_recvv+0x6c>
+  8015c0:	8b 15 e4 a0 80 00    	mov    0x80a0e4,%edx
+  8015c6:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8015c9:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8015cb:	85 ff                	test   %edi,%edi
+  8015cd:	74 4e                	je     80161d <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8015cf:	8b 15 e4 a0 80 00    	mov    0x80a0e4,%edx
+  8015d5:	8b 52 74             	mov    0x74(%edx),%edx
+  8015d8:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8015da:	85 f6                	test   %esi,%esi
+  8015dc:	74 18                	je     8015f6 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8015de:	85 c0                	test   %eax,%eax
+  8015e0:	75 2d                	jne    80160f <ipc_recvv+0x7f>
+  8015e2:	a1 e4 a0 80 00       	mov    0x80a0e4,%eax
+  8015e7:	8b 40 78             	mov    0x78(%eax),%eax
+  8015ea:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8015ec:	a1 e4 a0 80 00       	mov    0x80a0e4,%eax
+  8015f1:	8b 40 70             	mov    0x70(%eax),%eax
+  8015f4:	eb 1f                	jmp    801615 <ipc_recvv+0x85>
+  8015f6:	85 c0                	test   %eax,%eax
+  8015f8:	75 1b                	jne    801615 <ipc_recvv+0x85>
+  8015fa:	eb f0                	jmp    8015ec <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8015fc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801602:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  801607:	85 ff                	test   %edi,%edi
+  801609:	75 cd                	jne    8015d8 <ipc_recvv+0x48>
+	if (perm_store)
+  80160b:	85 f6                	test   %esi,%esi
+  80160d:	74 e7                	je     8015f6 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80160f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  801615:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801618:	5b                   	pop    %ebx
+  801619:	5e                   	pop    %esi
+  80161a:	5f                   	pop    %edi
+  80161b:	5d                   	pop    %ebp
+  80161c:	c3                   	ret
+	if (perm_store)
+  80161d:	85 f6                	test   %esi,%esi
+  80161f:	75 bd                	jne    8015de <ipc_recvv+0x4e>
+  801621:	eb c9                	jmp    8015ec <ipc_recvv+0x5c>
+
+00801623 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  801623:	55                   	push   %ebp
+  801624:	89 e5                	mov    %esp,%ebp
+  801626:	57                   	push   %edi
+  801627:	56                   	push   %esi
+  801628:	53                   	push   %ebx
+  801629:	83 ec 0c             	sub    $0xc,%esp
+  80162c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80162f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801632:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  801635:	ff 75 14             	push   0x14(%ebp)
+  801638:	53                   	push   %ebx
+  801639:	56                   	push   %esi
+  80163a:	57                   	push   %edi
+  80163b:	e8 69 fc ff ff       	call   8012a9 <sys_ipc_try_sendv>
+  801640:	83 c4 10             	add    $0x10,%esp
+  801643:	85 c0                	test   %eax,%eax
+  801645:	74 22                	je     801669 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  801647:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80164a:	75 07                	jne    801653 <ipc_sendv+0x30>
+		sys_yield();
+  80164c:	e8 5c fa ff ff       	call   8010ad <sys_yield>
+  801651:	eb e2                	jmp    801635 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  801653:	68 f2 49 80 00       	push   $0x8049f2
+  801658:	68 07 4a 80 00       	push   $0x804a07
+  80165d:	6a 5c                	push   $0x5c
+  80165f:	68 1c 4a 80 00       	push   $0x804a1c
+  801664:	e8 8e ef ff ff       	call   8005f7 <_panic>
+	}
+}
+  801669:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80166c:	5b                   	pop    %ebx
+  80166d:	5e                   	pop    %esi
+  80166e:	5f                   	pop    %edi
+  80166f:	5d                   	pop    %ebp
+  801670:	c3                   	ret
+
+00801671 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801671:	55                   	push   %ebp
+  801672:	89 e5                	mov    %esp,%ebp
+  801674:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801677:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80167c:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  801682:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801688:	8b 52 50             	mov    0x50(%edx),%edx
+  80168b:	39 ca                	cmp    %ecx,%edx
+  80168d:	74 11                	je     8016a0 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80168f:	83 c0 01             	add    $0x1,%eax
+  801692:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801697:	75 e3                	jne    80167c <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801699:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169e:	eb 0e                	jmp    8016ae <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8016a0:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8016a6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8016ab:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8016ae:	5d                   	pop    %ebp
+  8016af:	c3                   	ret
+
+008016b0 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8016b0:	55                   	push   %ebp
+  8016b1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8016b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016b6:	05 00 00 00 30       	add    $0x30000000,%eax
+  8016bb:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8016be:	5d                   	pop    %ebp
+  8016bf:	c3                   	ret
+
+008016c0 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8016c0:	55                   	push   %ebp
+  8016c1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8016c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016c6:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8016cb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8016d0:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8016d5:	5d                   	pop    %ebp
+  8016d6:	c3                   	ret
+
+008016d7 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8016d7:	55                   	push   %ebp
+  8016d8:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8016da:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8016df:	eb 02                	jmp    8016e3 <fd_alloc+0xc>
+  8016e1:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8016e3:	89 c2                	mov    %eax,%edx
+  8016e5:	c1 ea 16             	shr    $0x16,%edx
+  8016e8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8016ef:	f6 c2 01             	test   $0x1,%dl
+  8016f2:	74 2b                	je     80171f <fd_alloc+0x48>
+  8016f4:	89 c2                	mov    %eax,%edx
+  8016f6:	c1 ea 0c             	shr    $0xc,%edx
+  8016f9:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801700:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801706:	f6 c1 01             	test   $0x1,%cl
+  801709:	74 14                	je     80171f <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80170b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801711:	75 ce                	jne    8016e1 <fd_alloc+0xa>
+  801713:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801718:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80171d:	eb 05                	jmp    801724 <fd_alloc+0x4d>
+			return 0;
+  80171f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801724:	8b 55 08             	mov    0x8(%ebp),%edx
+  801727:	89 02                	mov    %eax,(%edx)
+}
+  801729:	89 c8                	mov    %ecx,%eax
+  80172b:	5d                   	pop    %ebp
+  80172c:	c3                   	ret
+
+0080172d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80172d:	55                   	push   %ebp
+  80172e:	89 e5                	mov    %esp,%ebp
+  801730:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801733:	83 f8 1f             	cmp    $0x1f,%eax
+  801736:	77 30                	ja     801768 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801738:	c1 e0 0c             	shl    $0xc,%eax
+  80173b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801740:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801746:	f6 c2 01             	test   $0x1,%dl
+  801749:	74 24                	je     80176f <fd_lookup+0x42>
+  80174b:	89 c2                	mov    %eax,%edx
+  80174d:	c1 ea 0c             	shr    $0xc,%edx
+  801750:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801757:	f6 c2 01             	test   $0x1,%dl
+  80175a:	74 1a                	je     801776 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80175c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80175f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801761:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801766:	5d                   	pop    %ebp
+  801767:	c3                   	ret
+		return -E_INVAL;
+  801768:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80176d:	eb f7                	jmp    801766 <fd_lookup+0x39>
+		return -E_INVAL;
+  80176f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801774:	eb f0                	jmp    801766 <fd_lookup+0x39>
+  801776:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80177b:	eb e9                	jmp    801766 <fd_lookup+0x39>
+
+0080177d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80177d:	55                   	push   %ebp
+  80177e:	89 e5                	mov    %esp,%ebp
+  801780:	53                   	push   %ebx
+  801781:	83 ec 04             	sub    $0x4,%esp
+  801784:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178c:	eb 03                	jmp    801791 <dev_lookup+0x14>
+  80178e:	83 c0 01             	add    $0x1,%eax
+  801791:	8b 1c 85 a4 4a 80 00 	mov    0x804aa4(,%eax,4),%ebx
+  801798:	85 db                	test   %ebx,%ebx
+  80179a:	74 0b                	je     8017a7 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80179c:	39 13                	cmp    %edx,(%ebx)
+  80179e:	75 ee                	jne    80178e <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8017a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a5:	eb 1f                	jmp    8017c6 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8017a7:	a1 e4 a0 80 00       	mov    0x80a0e4,%eax
+  8017ac:	8b 40 48             	mov    0x48(%eax),%eax
+  8017af:	83 ec 04             	sub    $0x4,%esp
+  8017b2:	52                   	push   %edx
+  8017b3:	50                   	push   %eax
+  8017b4:	68 28 4a 80 00       	push   $0x804a28
+  8017b9:	e8 14 ef ff ff       	call   8006d2 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8017be:	83 c4 10             	add    $0x10,%esp
+  8017c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8017c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017c9:	89 1a                	mov    %ebx,(%edx)
+}
+  8017cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017ce:	c9                   	leave
+  8017cf:	c3                   	ret
+
+008017d0 <fd_close>:
+{
+  8017d0:	55                   	push   %ebp
+  8017d1:	89 e5                	mov    %esp,%ebp
+  8017d3:	57                   	push   %edi
+  8017d4:	56                   	push   %esi
+  8017d5:	53                   	push   %ebx
+  8017d6:	83 ec 24             	sub    $0x24,%esp
+  8017d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017dc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8017df:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017e2:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017e3:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8017e9:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8017ec:	50                   	push   %eax
+  8017ed:	e8 3b ff ff ff       	call   80172d <fd_lookup>
+  8017f2:	89 c3                	mov    %eax,%ebx
+  8017f4:	83 c4 10             	add    $0x10,%esp
+  8017f7:	85 c0                	test   %eax,%eax
+  8017f9:	78 05                	js     801800 <fd_close+0x30>
+	    || fd != fd2)
+  8017fb:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8017fe:	74 16                	je     801816 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801800:	89 f8                	mov    %edi,%eax
+  801802:	84 c0                	test   %al,%al
+  801804:	b8 00 00 00 00       	mov    $0x0,%eax
+  801809:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80180c:	89 d8                	mov    %ebx,%eax
+  80180e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801811:	5b                   	pop    %ebx
+  801812:	5e                   	pop    %esi
+  801813:	5f                   	pop    %edi
+  801814:	5d                   	pop    %ebp
+  801815:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801816:	83 ec 08             	sub    $0x8,%esp
+  801819:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80181c:	50                   	push   %eax
+  80181d:	ff 36                	push   (%esi)
+  80181f:	e8 59 ff ff ff       	call   80177d <dev_lookup>
+  801824:	89 c3                	mov    %eax,%ebx
+  801826:	83 c4 10             	add    $0x10,%esp
+  801829:	85 c0                	test   %eax,%eax
+  80182b:	78 1a                	js     801847 <fd_close+0x77>
+		if (dev->dev_close)
+  80182d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801830:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801833:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801838:	85 c0                	test   %eax,%eax
+  80183a:	74 0b                	je     801847 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80183c:	83 ec 0c             	sub    $0xc,%esp
+  80183f:	56                   	push   %esi
+  801840:	ff d0                	call   *%eax
+  801842:	89 c3                	mov    %eax,%ebx
+  801844:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801847:	83 ec 08             	sub    $0x8,%esp
+  80184a:	56                   	push   %esi
+  80184b:	6a 00                	push   $0x0
+  80184d:	e8 07 f9 ff ff       	call   801159 <sys_page_unmap>
+	return r;
+  801852:	83 c4 10             	add    $0x10,%esp
+  801855:	eb b5                	jmp    80180c <fd_close+0x3c>
+
+00801857 <close>:
+
+int
+close(int fdnum)
+{
+  801857:	55                   	push   %ebp
+  801858:	89 e5                	mov    %esp,%ebp
+  80185a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80185d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801860:	50                   	push   %eax
+  801861:	ff 75 08             	push   0x8(%ebp)
+  801864:	e8 c4 fe ff ff       	call   80172d <fd_lookup>
+  801869:	83 c4 10             	add    $0x10,%esp
+  80186c:	85 c0                	test   %eax,%eax
+  80186e:	79 02                	jns    801872 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801870:	c9                   	leave
+  801871:	c3                   	ret
+		return fd_close(fd, 1);
+  801872:	83 ec 08             	sub    $0x8,%esp
+  801875:	6a 01                	push   $0x1
+  801877:	ff 75 f4             	push   -0xc(%ebp)
+  80187a:	e8 51 ff ff ff       	call   8017d0 <fd_close>
+  80187f:	83 c4 10             	add    $0x10,%esp
+  801882:	eb ec                	jmp    801870 <close+0x19>
+
+00801884 <close_all>:
+
+void
+close_all(void)
+{
+  801884:	55                   	push   %ebp
+  801885:	89 e5                	mov    %esp,%ebp
+  801887:	53                   	push   %ebx
+  801888:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80188b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801890:	83 ec 0c             	sub    $0xc,%esp
+  801893:	53                   	push   %ebx
+  801894:	e8 be ff ff ff       	call   801857 <close>
+	for (i = 0; i < MAXFD; i++)
+  801899:	83 c3 01             	add    $0x1,%ebx
+  80189c:	83 c4 10             	add    $0x10,%esp
+  80189f:	83 fb 20             	cmp    $0x20,%ebx
+  8018a2:	75 ec                	jne    801890 <close_all+0xc>
+}
+  8018a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018a7:	c9                   	leave
+  8018a8:	c3                   	ret
+
+008018a9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8018a9:	55                   	push   %ebp
+  8018aa:	89 e5                	mov    %esp,%ebp
+  8018ac:	57                   	push   %edi
+  8018ad:	56                   	push   %esi
+  8018ae:	53                   	push   %ebx
+  8018af:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8018b2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018b5:	50                   	push   %eax
+  8018b6:	ff 75 08             	push   0x8(%ebp)
+  8018b9:	e8 6f fe ff ff       	call   80172d <fd_lookup>
+  8018be:	89 c3                	mov    %eax,%ebx
+  8018c0:	83 c4 10             	add    $0x10,%esp
+  8018c3:	85 c0                	test   %eax,%eax
+  8018c5:	78 7f                	js     801946 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8018c7:	83 ec 0c             	sub    $0xc,%esp
+  8018ca:	ff 75 0c             	push   0xc(%ebp)
+  8018cd:	e8 85 ff ff ff       	call   801857 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8018d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8018d5:	c1 e6 0c             	shl    $0xc,%esi
+  8018d8:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8018de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8018e1:	89 3c 24             	mov    %edi,(%esp)
+  8018e4:	e8 d7 fd ff ff       	call   8016c0 <fd2data>
+  8018e9:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8018eb:	89 34 24             	mov    %esi,(%esp)
+  8018ee:	e8 cd fd ff ff       	call   8016c0 <fd2data>
+  8018f3:	83 c4 10             	add    $0x10,%esp
+  8018f6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8018f9:	89 d8                	mov    %ebx,%eax
+  8018fb:	c1 e8 16             	shr    $0x16,%eax
+  8018fe:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801905:	a8 01                	test   $0x1,%al
+  801907:	74 11                	je     80191a <dup+0x71>
+  801909:	89 d8                	mov    %ebx,%eax
+  80190b:	c1 e8 0c             	shr    $0xc,%eax
+  80190e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801915:	f6 c2 01             	test   $0x1,%dl
+  801918:	75 36                	jne    801950 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80191a:	89 f8                	mov    %edi,%eax
+  80191c:	c1 e8 0c             	shr    $0xc,%eax
+  80191f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801926:	83 ec 0c             	sub    $0xc,%esp
+  801929:	25 07 0e 00 00       	and    $0xe07,%eax
+  80192e:	50                   	push   %eax
+  80192f:	56                   	push   %esi
+  801930:	6a 00                	push   $0x0
+  801932:	57                   	push   %edi
+  801933:	6a 00                	push   $0x0
+  801935:	e8 dd f7 ff ff       	call   801117 <sys_page_map>
+  80193a:	89 c3                	mov    %eax,%ebx
+  80193c:	83 c4 20             	add    $0x20,%esp
+  80193f:	85 c0                	test   %eax,%eax
+  801941:	78 33                	js     801976 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801943:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801946:	89 d8                	mov    %ebx,%eax
+  801948:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80194b:	5b                   	pop    %ebx
+  80194c:	5e                   	pop    %esi
+  80194d:	5f                   	pop    %edi
+  80194e:	5d                   	pop    %ebp
+  80194f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801950:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801957:	83 ec 0c             	sub    $0xc,%esp
+  80195a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80195f:	50                   	push   %eax
+  801960:	ff 75 d4             	push   -0x2c(%ebp)
+  801963:	6a 00                	push   $0x0
+  801965:	53                   	push   %ebx
+  801966:	6a 00                	push   $0x0
+  801968:	e8 aa f7 ff ff       	call   801117 <sys_page_map>
+  80196d:	89 c3                	mov    %eax,%ebx
+  80196f:	83 c4 20             	add    $0x20,%esp
+  801972:	85 c0                	test   %eax,%eax
+  801974:	79 a4                	jns    80191a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801976:	83 ec 08             	sub    $0x8,%esp
+  801979:	56                   	push   %esi
+  80197a:	6a 00                	push   $0x0
+  80197c:	e8 d8 f7 ff ff       	call   801159 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801981:	83 c4 08             	add    $0x8,%esp
+  801984:	ff 75 d4             	push   -0x2c(%ebp)
+  801987:	6a 00                	push   $0x0
+  801989:	e8 cb f7 ff ff       	call   801159 <sys_page_unmap>
+	return r;
+  80198e:	83 c4 10             	add    $0x10,%esp
+  801991:	eb b3                	jmp    801946 <dup+0x9d>
+
+00801993 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801993:	55                   	push   %ebp
+  801994:	89 e5                	mov    %esp,%ebp
+  801996:	56                   	push   %esi
+  801997:	53                   	push   %ebx
+  801998:	83 ec 18             	sub    $0x18,%esp
+  80199b:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80199e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019a1:	50                   	push   %eax
+  8019a2:	56                   	push   %esi
+  8019a3:	e8 85 fd ff ff       	call   80172d <fd_lookup>
+  8019a8:	83 c4 10             	add    $0x10,%esp
+  8019ab:	85 c0                	test   %eax,%eax
+  8019ad:	78 3c                	js     8019eb <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019af:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8019b2:	83 ec 08             	sub    $0x8,%esp
+  8019b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019b8:	50                   	push   %eax
+  8019b9:	ff 33                	push   (%ebx)
+  8019bb:	e8 bd fd ff ff       	call   80177d <dev_lookup>
+  8019c0:	83 c4 10             	add    $0x10,%esp
+  8019c3:	85 c0                	test   %eax,%eax
+  8019c5:	78 24                	js     8019eb <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019c7:	8b 43 08             	mov    0x8(%ebx),%eax
+  8019ca:	83 e0 03             	and    $0x3,%eax
+  8019cd:	83 f8 01             	cmp    $0x1,%eax
+  8019d0:	74 20                	je     8019f2 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8019d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019d5:	8b 40 08             	mov    0x8(%eax),%eax
+  8019d8:	85 c0                	test   %eax,%eax
+  8019da:	74 37                	je     801a13 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8019dc:	83 ec 04             	sub    $0x4,%esp
+  8019df:	ff 75 10             	push   0x10(%ebp)
+  8019e2:	ff 75 0c             	push   0xc(%ebp)
+  8019e5:	53                   	push   %ebx
+  8019e6:	ff d0                	call   *%eax
+  8019e8:	83 c4 10             	add    $0x10,%esp
+}
+  8019eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ee:	5b                   	pop    %ebx
+  8019ef:	5e                   	pop    %esi
+  8019f0:	5d                   	pop    %ebp
+  8019f1:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019f2:	a1 e4 a0 80 00       	mov    0x80a0e4,%eax
+  8019f7:	8b 40 48             	mov    0x48(%eax),%eax
+  8019fa:	83 ec 04             	sub    $0x4,%esp
+  8019fd:	56                   	push   %esi
+  8019fe:	50                   	push   %eax
+  8019ff:	68 69 4a 80 00       	push   $0x804a69
+  801a04:	e8 c9 ec ff ff       	call   8006d2 <cprintf>
+		return -E_INVAL;
+  801a09:	83 c4 10             	add    $0x10,%esp
+  801a0c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a11:	eb d8                	jmp    8019eb <read+0x58>
+		return -E_NOT_SUPP;
+  801a13:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a18:	eb d1                	jmp    8019eb <read+0x58>
+
+00801a1a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801a1a:	55                   	push   %ebp
+  801a1b:	89 e5                	mov    %esp,%ebp
+  801a1d:	57                   	push   %edi
+  801a1e:	56                   	push   %esi
+  801a1f:	53                   	push   %ebx
+  801a20:	83 ec 0c             	sub    $0xc,%esp
+  801a23:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801a26:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801a29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a2e:	eb 02                	jmp    801a32 <readn+0x18>
+  801a30:	01 c3                	add    %eax,%ebx
+  801a32:	39 f3                	cmp    %esi,%ebx
+  801a34:	73 21                	jae    801a57 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801a36:	83 ec 04             	sub    $0x4,%esp
+  801a39:	89 f0                	mov    %esi,%eax
+  801a3b:	29 d8                	sub    %ebx,%eax
+  801a3d:	50                   	push   %eax
+  801a3e:	89 d8                	mov    %ebx,%eax
+  801a40:	03 45 0c             	add    0xc(%ebp),%eax
+  801a43:	50                   	push   %eax
+  801a44:	57                   	push   %edi
+  801a45:	e8 49 ff ff ff       	call   801993 <read>
+		if (m < 0)
+  801a4a:	83 c4 10             	add    $0x10,%esp
+  801a4d:	85 c0                	test   %eax,%eax
+  801a4f:	78 04                	js     801a55 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801a51:	75 dd                	jne    801a30 <readn+0x16>
+  801a53:	eb 02                	jmp    801a57 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801a55:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801a57:	89 d8                	mov    %ebx,%eax
+  801a59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a5c:	5b                   	pop    %ebx
+  801a5d:	5e                   	pop    %esi
+  801a5e:	5f                   	pop    %edi
+  801a5f:	5d                   	pop    %ebp
+  801a60:	c3                   	ret
+
+00801a61 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801a61:	55                   	push   %ebp
+  801a62:	89 e5                	mov    %esp,%ebp
+  801a64:	56                   	push   %esi
+  801a65:	53                   	push   %ebx
+  801a66:	83 ec 18             	sub    $0x18,%esp
+  801a69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a6c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a6f:	50                   	push   %eax
+  801a70:	53                   	push   %ebx
+  801a71:	e8 b7 fc ff ff       	call   80172d <fd_lookup>
+  801a76:	83 c4 10             	add    $0x10,%esp
+  801a79:	85 c0                	test   %eax,%eax
+  801a7b:	78 37                	js     801ab4 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a7d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a80:	83 ec 08             	sub    $0x8,%esp
+  801a83:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a86:	50                   	push   %eax
+  801a87:	ff 36                	push   (%esi)
+  801a89:	e8 ef fc ff ff       	call   80177d <dev_lookup>
+  801a8e:	83 c4 10             	add    $0x10,%esp
+  801a91:	85 c0                	test   %eax,%eax
+  801a93:	78 1f                	js     801ab4 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a95:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a99:	74 20                	je     801abb <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801a9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a9e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aa1:	85 c0                	test   %eax,%eax
+  801aa3:	74 37                	je     801adc <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801aa5:	83 ec 04             	sub    $0x4,%esp
+  801aa8:	ff 75 10             	push   0x10(%ebp)
+  801aab:	ff 75 0c             	push   0xc(%ebp)
+  801aae:	56                   	push   %esi
+  801aaf:	ff d0                	call   *%eax
+  801ab1:	83 c4 10             	add    $0x10,%esp
+}
+  801ab4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab7:	5b                   	pop    %ebx
+  801ab8:	5e                   	pop    %esi
+  801ab9:	5d                   	pop    %ebp
+  801aba:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801abb:	a1 e4 a0 80 00       	mov    0x80a0e4,%eax
+  801ac0:	8b 40 48             	mov    0x48(%eax),%eax
+  801ac3:	83 ec 04             	sub    $0x4,%esp
+  801ac6:	53                   	push   %ebx
+  801ac7:	50                   	push   %eax
+  801ac8:	68 85 4a 80 00       	push   $0x804a85
+  801acd:	e8 00 ec ff ff       	call   8006d2 <cprintf>
+		return -E_INVAL;
+  801ad2:	83 c4 10             	add    $0x10,%esp
+  801ad5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ada:	eb d8                	jmp    801ab4 <write+0x53>
+		return -E_NOT_SUPP;
+  801adc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ae1:	eb d1                	jmp    801ab4 <write+0x53>
+
+00801ae3 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801ae3:	55                   	push   %ebp
+  801ae4:	89 e5                	mov    %esp,%ebp
+  801ae6:	53                   	push   %ebx
+  801ae7:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801aea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801aed:	50                   	push   %eax
+  801aee:	ff 75 08             	push   0x8(%ebp)
+  801af1:	e8 37 fc ff ff       	call   80172d <fd_lookup>
+  801af6:	83 c4 10             	add    $0x10,%esp
+  801af9:	85 c0                	test   %eax,%eax
+  801afb:	78 3a                	js     801b37 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801afd:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801b00:	83 ec 08             	sub    $0x8,%esp
+  801b03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b06:	50                   	push   %eax
+  801b07:	ff 33                	push   (%ebx)
+  801b09:	e8 6f fc ff ff       	call   80177d <dev_lookup>
+  801b0e:	83 c4 10             	add    $0x10,%esp
+  801b11:	85 c0                	test   %eax,%eax
+  801b13:	78 22                	js     801b37 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801b15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b18:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801b1b:	85 c0                	test   %eax,%eax
+  801b1d:	74 0d                	je     801b2c <seek+0x49>
+  801b1f:	83 ec 0c             	sub    $0xc,%esp
+  801b22:	53                   	push   %ebx
+  801b23:	ff d0                	call   *%eax
+  801b25:	83 c4 10             	add    $0x10,%esp
+  801b28:	85 c0                	test   %eax,%eax
+  801b2a:	78 0b                	js     801b37 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801b2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b2f:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801b32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b3a:	c9                   	leave
+  801b3b:	c3                   	ret
+
+00801b3c <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801b3c:	55                   	push   %ebp
+  801b3d:	89 e5                	mov    %esp,%ebp
+  801b3f:	53                   	push   %ebx
+  801b40:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b43:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b46:	50                   	push   %eax
+  801b47:	ff 75 08             	push   0x8(%ebp)
+  801b4a:	e8 de fb ff ff       	call   80172d <fd_lookup>
+  801b4f:	83 c4 10             	add    $0x10,%esp
+  801b52:	85 c0                	test   %eax,%eax
+  801b54:	78 2b                	js     801b81 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b56:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801b59:	83 ec 08             	sub    $0x8,%esp
+  801b5c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b5f:	50                   	push   %eax
+  801b60:	ff 33                	push   (%ebx)
+  801b62:	e8 16 fc ff ff       	call   80177d <dev_lookup>
+  801b67:	83 c4 10             	add    $0x10,%esp
+  801b6a:	85 c0                	test   %eax,%eax
+  801b6c:	78 13                	js     801b81 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801b6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b71:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801b74:	85 c0                	test   %eax,%eax
+  801b76:	74 0e                	je     801b86 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801b78:	83 ec 0c             	sub    $0xc,%esp
+  801b7b:	53                   	push   %ebx
+  801b7c:	ff d0                	call   *%eax
+  801b7e:	83 c4 10             	add    $0x10,%esp
+}
+  801b81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b84:	c9                   	leave
+  801b85:	c3                   	ret
+		return 0;
+  801b86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b8b:	eb f4                	jmp    801b81 <fsync+0x45>
+
+00801b8d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801b8d:	55                   	push   %ebp
+  801b8e:	89 e5                	mov    %esp,%ebp
+  801b90:	56                   	push   %esi
+  801b91:	53                   	push   %ebx
+  801b92:	83 ec 18             	sub    $0x18,%esp
+  801b95:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b98:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b9b:	50                   	push   %eax
+  801b9c:	53                   	push   %ebx
+  801b9d:	e8 8b fb ff ff       	call   80172d <fd_lookup>
+  801ba2:	83 c4 10             	add    $0x10,%esp
+  801ba5:	85 c0                	test   %eax,%eax
+  801ba7:	78 34                	js     801bdd <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ba9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bac:	83 ec 08             	sub    $0x8,%esp
+  801baf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb2:	50                   	push   %eax
+  801bb3:	ff 36                	push   (%esi)
+  801bb5:	e8 c3 fb ff ff       	call   80177d <dev_lookup>
+  801bba:	83 c4 10             	add    $0x10,%esp
+  801bbd:	85 c0                	test   %eax,%eax
+  801bbf:	78 1c                	js     801bdd <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bc1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bc5:	74 1d                	je     801be4 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801bc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bca:	8b 40 18             	mov    0x18(%eax),%eax
+  801bcd:	85 c0                	test   %eax,%eax
+  801bcf:	74 34                	je     801c05 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801bd1:	83 ec 08             	sub    $0x8,%esp
+  801bd4:	ff 75 0c             	push   0xc(%ebp)
+  801bd7:	56                   	push   %esi
+  801bd8:	ff d0                	call   *%eax
+  801bda:	83 c4 10             	add    $0x10,%esp
+}
+  801bdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be0:	5b                   	pop    %ebx
+  801be1:	5e                   	pop    %esi
+  801be2:	5d                   	pop    %ebp
+  801be3:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801be4:	a1 e4 a0 80 00       	mov    0x80a0e4,%eax
+  801be9:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801bec:	83 ec 04             	sub    $0x4,%esp
+  801bef:	53                   	push   %ebx
+  801bf0:	50                   	push   %eax
+  801bf1:	68 48 4a 80 00       	push   $0x804a48
+  801bf6:	e8 d7 ea ff ff       	call   8006d2 <cprintf>
+		return -E_INVAL;
+  801bfb:	83 c4 10             	add    $0x10,%esp
+  801bfe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c03:	eb d8                	jmp    801bdd <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801c05:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c0a:	eb d1                	jmp    801bdd <ftruncate+0x50>
+
+00801c0c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801c0c:	55                   	push   %ebp
+  801c0d:	89 e5                	mov    %esp,%ebp
+  801c0f:	56                   	push   %esi
+  801c10:	53                   	push   %ebx
+  801c11:	83 ec 18             	sub    $0x18,%esp
+  801c14:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c17:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c1a:	50                   	push   %eax
+  801c1b:	ff 75 08             	push   0x8(%ebp)
+  801c1e:	e8 0a fb ff ff       	call   80172d <fd_lookup>
+  801c23:	83 c4 10             	add    $0x10,%esp
+  801c26:	85 c0                	test   %eax,%eax
+  801c28:	78 49                	js     801c73 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c2a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c2d:	83 ec 08             	sub    $0x8,%esp
+  801c30:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c33:	50                   	push   %eax
+  801c34:	ff 36                	push   (%esi)
+  801c36:	e8 42 fb ff ff       	call   80177d <dev_lookup>
+  801c3b:	83 c4 10             	add    $0x10,%esp
+  801c3e:	85 c0                	test   %eax,%eax
+  801c40:	78 31                	js     801c73 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801c42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c45:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801c49:	74 2f                	je     801c7a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801c4b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801c4e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801c55:	00 00 00 
+	stat->st_isdir = 0;
+  801c58:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c5f:	00 00 00 
+	stat->st_dev = dev;
+  801c62:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801c68:	83 ec 08             	sub    $0x8,%esp
+  801c6b:	53                   	push   %ebx
+  801c6c:	56                   	push   %esi
+  801c6d:	ff 50 14             	call   *0x14(%eax)
+  801c70:	83 c4 10             	add    $0x10,%esp
+}
+  801c73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c76:	5b                   	pop    %ebx
+  801c77:	5e                   	pop    %esi
+  801c78:	5d                   	pop    %ebp
+  801c79:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c7a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c7f:	eb f2                	jmp    801c73 <fstat+0x67>
+
+00801c81 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801c81:	55                   	push   %ebp
+  801c82:	89 e5                	mov    %esp,%ebp
+  801c84:	56                   	push   %esi
+  801c85:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801c86:	83 ec 08             	sub    $0x8,%esp
+  801c89:	68 00 10 00 00       	push   $0x1000
+  801c8e:	ff 75 08             	push   0x8(%ebp)
+  801c91:	e8 b3 07 00 00       	call   802449 <open>
+  801c96:	89 c3                	mov    %eax,%ebx
+  801c98:	83 c4 10             	add    $0x10,%esp
+  801c9b:	85 c0                	test   %eax,%eax
+  801c9d:	78 1b                	js     801cba <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801c9f:	83 ec 08             	sub    $0x8,%esp
+  801ca2:	ff 75 0c             	push   0xc(%ebp)
+  801ca5:	50                   	push   %eax
+  801ca6:	e8 61 ff ff ff       	call   801c0c <fstat>
+  801cab:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801cad:	89 1c 24             	mov    %ebx,(%esp)
+  801cb0:	e8 a2 fb ff ff       	call   801857 <close>
+	return r;
+  801cb5:	83 c4 10             	add    $0x10,%esp
+  801cb8:	89 f3                	mov    %esi,%ebx
+}
+  801cba:	89 d8                	mov    %ebx,%eax
+  801cbc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cbf:	5b                   	pop    %ebx
+  801cc0:	5e                   	pop    %esi
+  801cc1:	5d                   	pop    %ebp
+  801cc2:	c3                   	ret
+
+00801cc3 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801cc3:	55                   	push   %ebp
+  801cc4:	89 e5                	mov    %esp,%ebp
+  801cc6:	57                   	push   %edi
+  801cc7:	56                   	push   %esi
+  801cc8:	53                   	push   %ebx
+  801cc9:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801ccf:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801cd5:	89 d6                	mov    %edx,%esi
+  801cd7:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801cdd:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801ce0:	89 d3                	mov    %edx,%ebx
+  801ce2:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801ce8:	83 3d c8 c0 80 00 00 	cmpl   $0x0,0x80c0c8
+  801cef:	74 1d                	je     801d0e <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801cf1:	b8 00 b0 80 00       	mov    $0x80b000,%eax
+  801cf6:	83 c8 07             	or     $0x7,%eax
+  801cf9:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801cff:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801d04:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801d0a:	01 ce                	add    %ecx,%esi
+  801d0c:	eb 28                	jmp    801d36 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d0e:	83 ec 0c             	sub    $0xc,%esp
+  801d11:	6a 01                	push   $0x1
+  801d13:	e8 59 f9 ff ff       	call   801671 <ipc_find_env>
+  801d18:	a3 c8 c0 80 00       	mov    %eax,0x80c0c8
+  801d1d:	83 c4 10             	add    $0x10,%esp
+  801d20:	eb cf                	jmp    801cf1 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801d22:	83 c0 01             	add    $0x1,%eax
+  801d25:	89 fa                	mov    %edi,%edx
+  801d27:	09 da                	or     %ebx,%edx
+  801d29:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801d30:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d36:	39 f3                	cmp    %esi,%ebx
+  801d38:	72 e8                	jb     801d22 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801d3a:	83 f8 41             	cmp    $0x41,%eax
+  801d3d:	77 2f                	ja     801d6e <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801d3f:	50                   	push   %eax
+  801d40:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801d46:	50                   	push   %eax
+  801d47:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801d4d:	ff 35 c8 c0 80 00    	push   0x80c0c8
+  801d53:	e8 cb f8 ff ff       	call   801623 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801d58:	83 c4 0c             	add    $0xc,%esp
+  801d5b:	6a 00                	push   $0x0
+  801d5d:	6a 00                	push   $0x0
+  801d5f:	6a 00                	push   $0x0
+  801d61:	e8 67 f7 ff ff       	call   8014cd <ipc_recv>
+}
+  801d66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d69:	5b                   	pop    %ebx
+  801d6a:	5e                   	pop    %esi
+  801d6b:	5f                   	pop    %edi
+  801d6c:	5d                   	pop    %ebp
+  801d6d:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801d6e:	68 b8 4a 80 00       	push   $0x804ab8
+  801d73:	68 07 4a 80 00       	push   $0x804a07
+  801d78:	6a 40                	push   $0x40
+  801d7a:	68 d4 4a 80 00       	push   $0x804ad4
+  801d7f:	e8 73 e8 ff ff       	call   8005f7 <_panic>
+
+00801d84 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801d84:	55                   	push   %ebp
+  801d85:	89 e5                	mov    %esp,%ebp
+  801d87:	57                   	push   %edi
+  801d88:	56                   	push   %esi
+  801d89:	53                   	push   %ebx
+  801d8a:	83 ec 1c             	sub    $0x1c,%esp
+  801d8d:	89 c3                	mov    %eax,%ebx
+  801d8f:	89 d6                	mov    %edx,%esi
+  801d91:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801d94:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801d9a:	89 ca                	mov    %ecx,%edx
+  801d9c:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801d9f:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801da6:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801da9:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801db0:	8b 76 0c             	mov    0xc(%esi),%esi
+  801db3:	89 fb                	mov    %edi,%ebx
+  801db5:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801dbc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801dbf:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801dc6:	8b 75 08             	mov    0x8(%ebp),%esi
+  801dc9:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801dd0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dd3:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801dda:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801ddd:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801de4:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801de9:	39 c8                	cmp    %ecx,%eax
+  801deb:	74 0d                	je     801dfa <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801ded:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801df5:	5b                   	pop    %ebx
+  801df6:	5e                   	pop    %esi
+  801df7:	5f                   	pop    %edi
+  801df8:	5d                   	pop    %ebp
+  801df9:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801dfa:	6a 07                	push   $0x7
+  801dfc:	68 00 b0 80 00       	push   $0x80b000
+  801e01:	6a 0d                	push   $0xd
+  801e03:	ff 35 c8 c0 80 00    	push   0x80c0c8
+  801e09:	e8 2a f7 ff ff       	call   801538 <ipc_send>
+  801e0e:	83 c4 10             	add    $0x10,%esp
+  801e11:	eb da                	jmp    801ded <fsring_post+0x69>
+
+00801e13 <fsipcv>:
+{
+  801e13:	55                   	push   %ebp
+  801e14:	89 e5                	mov    %esp,%ebp
+  801e16:	57                   	push   %edi
+  801e17:	56                   	push   %esi
+  801e18:	53                   	push   %ebx
+  801e19:	83 ec 0c             	sub    $0xc,%esp
+  801e1c:	89 c7                	mov    %eax,%edi
+  801e1e:	89 d3                	mov    %edx,%ebx
+  801e20:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801e22:	83 3d c8 c0 80 00 00 	cmpl   $0x0,0x80c0c8
+  801e29:	74 26                	je     801e51 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e2b:	6a 07                	push   $0x7
+  801e2d:	68 00 b0 80 00       	push   $0x80b000
+  801e32:	57                   	push   %edi
+  801e33:	ff 35 c8 c0 80 00    	push   0x80c0c8
+  801e39:	e8 fa f6 ff ff       	call   801538 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801e3e:	6a 00                	push   $0x0
+  801e40:	56                   	push   %esi
+  801e41:	53                   	push   %ebx
+  801e42:	6a 00                	push   $0x0
+  801e44:	e8 47 f7 ff ff       	call   801590 <ipc_recvv>
+}
+  801e49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e4c:	5b                   	pop    %ebx
+  801e4d:	5e                   	pop    %esi
+  801e4e:	5f                   	pop    %edi
+  801e4f:	5d                   	pop    %ebp
+  801e50:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e51:	83 ec 0c             	sub    $0xc,%esp
+  801e54:	6a 01                	push   $0x1
+  801e56:	e8 16 f8 ff ff       	call   801671 <ipc_find_env>
+  801e5b:	a3 c8 c0 80 00       	mov    %eax,0x80c0c8
+  801e60:	83 c4 10             	add    $0x10,%esp
+  801e63:	eb c6                	jmp    801e2b <fsipcv+0x18>
+
+00801e65 <fsipc>:
+{
+  801e65:	55                   	push   %ebp
+  801e66:	89 e5                	mov    %esp,%ebp
+  801e68:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801e6b:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801e72:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801e75:	e8 99 ff ff ff       	call   801e13 <fsipcv>
+}
+  801e7a:	c9                   	leave
+  801e7b:	c3                   	ret
+
+00801e7c <file_write_direct>:
+{
+  801e7c:	55                   	push   %ebp
+  801e7d:	89 e5                	mov    %esp,%ebp
+  801e7f:	56                   	push   %esi
+  801e80:	53                   	push   %ebx
+  801e81:	89 c3                	mov    %eax,%ebx
+  801e83:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801e85:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801e8b:	77 40                	ja     801ecd <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801e8d:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801e92:	39 c8                	cmp    %ecx,%eax
+  801e94:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e97:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801e9a:	89 0d 00 b0 80 00    	mov    %ecx,0x80b000
+	fsipcbuf.write.req_n = n;
+  801ea0:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801ea5:	83 ec 04             	sub    $0x4,%esp
+  801ea8:	50                   	push   %eax
+  801ea9:	52                   	push   %edx
+  801eaa:	68 08 b0 80 00       	push   $0x80b008
+  801eaf:	e8 92 ef ff ff       	call   800e46 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801eb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb9:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ebe:	e8 a2 ff ff ff       	call   801e65 <fsipc>
+  801ec3:	83 c4 10             	add    $0x10,%esp
+}
+  801ec6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ec9:	5b                   	pop    %ebx
+  801eca:	5e                   	pop    %esi
+  801ecb:	5d                   	pop    %ebp
+  801ecc:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801ecd:	89 d6                	mov    %edx,%esi
+  801ecf:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801ed5:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801eda:	29 f1                	sub    %esi,%ecx
+  801edc:	39 c1                	cmp    %eax,%ecx
+  801ede:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801ee1:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801ee4:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	fsipcbuf.bulk.req_n = n;
+  801ee9:	89 0d 04 b0 80 00    	mov    %ecx,0x80b004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801eef:	89 35 08 b0 80 00    	mov    %esi,0x80b008
+	return fsipc_pages(type, buf, n, perm);
+  801ef5:	83 ec 0c             	sub    $0xc,%esp
+  801ef8:	6a 05                	push   $0x5
+  801efa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801eff:	e8 bf fd ff ff       	call   801cc3 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801f04:	83 c4 10             	add    $0x10,%esp
+  801f07:	eb bd                	jmp    801ec6 <file_write_direct+0x4a>
+
+00801f09 <devfile_sync>:
+{
+  801f09:	55                   	push   %ebp
+  801f0a:	89 e5                	mov    %esp,%ebp
+  801f0c:	57                   	push   %edi
+  801f0d:	56                   	push   %esi
+  801f0e:	53                   	push   %ebx
+  801f0f:	83 ec 28             	sub    $0x28,%esp
+  801f12:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801f15:	56                   	push   %esi
+  801f16:	e8 a5 f7 ff ff       	call   8016c0 <fd2data>
+  801f1b:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801f1d:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801f20:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801f27:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801f2a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801f2f:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801f33:	74 45                	je     801f7a <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801f35:	8b 46 14             	mov    0x14(%esi),%eax
+  801f38:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f45:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801f48:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801f4b:	39 cb                	cmp    %ecx,%ebx
+  801f4d:	73 14                	jae    801f63 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801f4f:	29 d9                	sub    %ebx,%ecx
+  801f51:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801f54:	89 f0                	mov    %esi,%eax
+  801f56:	e8 21 ff ff ff       	call   801e7c <file_write_direct>
+  801f5b:	85 c0                	test   %eax,%eax
+  801f5d:	7e 04                	jle    801f63 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801f5f:	01 c3                	add    %eax,%ebx
+  801f61:	eb e5                	jmp    801f48 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801f63:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801f66:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801f6d:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801f70:	85 c0                	test   %eax,%eax
+  801f72:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f77:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801f7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f7d:	5b                   	pop    %ebx
+  801f7e:	5e                   	pop    %esi
+  801f7f:	5f                   	pop    %edi
+  801f80:	5d                   	pop    %ebp
+  801f81:	c3                   	ret
+
+00801f82 <devfile_write>:
+{
+  801f82:	55                   	push   %ebp
+  801f83:	89 e5                	mov    %esp,%ebp
+  801f85:	57                   	push   %edi
+  801f86:	56                   	push   %esi
+  801f87:	53                   	push   %ebx
+  801f88:	83 ec 28             	sub    $0x28,%esp
+  801f8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f8e:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801f91:	53                   	push   %ebx
+  801f92:	e8 29 f7 ff ff       	call   8016c0 <fd2data>
+  801f97:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801f9a:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801f9d:	83 c4 10             	add    $0x10,%esp
+  801fa0:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801fa4:	74 43                	je     801fe9 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801fa6:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801fad:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801fb0:	85 c0                	test   %eax,%eax
+  801fb2:	74 43                	je     801ff7 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801fb4:	89 c2                	mov    %eax,%edx
+  801fb6:	03 53 14             	add    0x14(%ebx),%edx
+  801fb9:	39 fa                	cmp    %edi,%edx
+  801fbb:	75 0b                	jne    801fc8 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801fbd:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801fc0:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801fc6:	76 66                	jbe    80202e <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801fc8:	83 ec 0c             	sub    $0xc,%esp
+  801fcb:	53                   	push   %ebx
+  801fcc:	e8 38 ff ff ff       	call   801f09 <devfile_sync>
+  801fd1:	83 c4 10             	add    $0x10,%esp
+  801fd4:	85 c0                	test   %eax,%eax
+  801fd6:	78 4e                	js     802026 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801fd8:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801fde:	77 56                	ja     802036 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801fe0:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801fe3:	85 c0                	test   %eax,%eax
+  801fe5:	75 20                	jne    802007 <devfile_write+0x85>
+  801fe7:	eb 16                	jmp    801fff <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801fe9:	89 f1                	mov    %esi,%ecx
+  801feb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fee:	89 d8                	mov    %ebx,%eax
+  801ff0:	e8 87 fe ff ff       	call   801e7c <file_write_direct>
+  801ff5:	eb 2f                	jmp    802026 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801ff7:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801ffd:	77 37                	ja     802036 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801fff:	89 7b 14             	mov    %edi,0x14(%ebx)
+  802002:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  802007:	83 ec 04             	sub    $0x4,%esp
+  80200a:	56                   	push   %esi
+  80200b:	ff 75 0c             	push   0xc(%ebp)
+  80200e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802011:	01 c1                	add    %eax,%ecx
+  802013:	51                   	push   %ecx
+  802014:	e8 2d ee ff ff       	call   800e46 <memmove>
+	ff->buf_wlen += n;
+  802019:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  80201c:	01 f7                	add    %esi,%edi
+  80201e:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802021:	89 f0                	mov    %esi,%eax
+  802023:	83 c4 10             	add    $0x10,%esp
+}
+  802026:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802029:	5b                   	pop    %ebx
+  80202a:	5e                   	pop    %esi
+  80202b:	5f                   	pop    %edi
+  80202c:	5d                   	pop    %ebp
+  80202d:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  80202e:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802034:	76 d1                	jbe    802007 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  802036:	89 f1                	mov    %esi,%ecx
+  802038:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80203b:	89 d8                	mov    %ebx,%eax
+  80203d:	e8 3a fe ff ff       	call   801e7c <file_write_direct>
+  802042:	eb e2                	jmp    802026 <devfile_write+0xa4>
+
+00802044 <devfile_trunc>:
+{
+  802044:	55                   	push   %ebp
+  802045:	89 e5                	mov    %esp,%ebp
+  802047:	53                   	push   %ebx
+  802048:	83 ec 10             	sub    $0x10,%esp
+  80204b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  80204e:	53                   	push   %ebx
+  80204f:	e8 b5 fe ff ff       	call   801f09 <devfile_sync>
+  802054:	83 c4 10             	add    $0x10,%esp
+  802057:	85 c0                	test   %eax,%eax
+  802059:	78 1f                	js     80207a <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80205b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80205e:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	fsipcbuf.set_size.req_size = newsize;
+  802063:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802066:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80206b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802070:	b8 02 00 00 00       	mov    $0x2,%eax
+  802075:	e8 eb fd ff ff       	call   801e65 <fsipc>
+}
+  80207a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80207d:	c9                   	leave
+  80207e:	c3                   	ret
+
+0080207f <devfile_stat>:
+{
+  80207f:	55                   	push   %ebp
+  802080:	89 e5                	mov    %esp,%ebp
+  802082:	56                   	push   %esi
+  802083:	53                   	push   %ebx
+  802084:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802087:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  80208a:	83 ec 0c             	sub    $0xc,%esp
+  80208d:	53                   	push   %ebx
+  80208e:	e8 76 fe ff ff       	call   801f09 <devfile_sync>
+  802093:	83 c4 10             	add    $0x10,%esp
+  802096:	85 c0                	test   %eax,%eax
+  802098:	78 47                	js     8020e1 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80209a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80209d:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8020a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8020ac:	e8 b4 fd ff ff       	call   801e65 <fsipc>
+  8020b1:	85 c0                	test   %eax,%eax
+  8020b3:	78 2c                	js     8020e1 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020b5:	83 ec 08             	sub    $0x8,%esp
+  8020b8:	68 00 b0 80 00       	push   $0x80b000
+  8020bd:	56                   	push   %esi
+  8020be:	e8 fd eb ff ff       	call   800cc0 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8020c3:	a1 80 b0 80 00       	mov    0x80b080,%eax
+  8020c8:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020ce:	a1 84 b0 80 00       	mov    0x80b084,%eax
+  8020d3:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  8020d9:	83 c4 10             	add    $0x10,%esp
+  8020dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020e4:	5b                   	pop    %ebx
+  8020e5:	5e                   	pop    %esi
+  8020e6:	5d                   	pop    %ebp
+  8020e7:	c3                   	ret
+
+008020e8 <devfile_flush>:
+{
+  8020e8:	55                   	push   %ebp
+  8020e9:	89 e5                	mov    %esp,%ebp
+  8020eb:	56                   	push   %esi
+  8020ec:	53                   	push   %ebx
+  8020ed:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  8020f0:	83 ec 0c             	sub    $0xc,%esp
+  8020f3:	56                   	push   %esi
+  8020f4:	e8 10 fe ff ff       	call   801f09 <devfile_sync>
+  8020f9:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  8020fb:	83 c4 10             	add    $0x10,%esp
+  8020fe:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  802102:	75 25                	jne    802129 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802104:	8b 46 0c             	mov    0xc(%esi),%eax
+  802107:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  80210c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802111:	b8 06 00 00 00       	mov    $0x6,%eax
+  802116:	e8 4a fd ff ff       	call   801e65 <fsipc>
+  80211b:	85 c0                	test   %eax,%eax
+  80211d:	0f 45 d8             	cmovne %eax,%ebx
+}
+  802120:	89 d8                	mov    %ebx,%eax
+  802122:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802125:	5b                   	pop    %ebx
+  802126:	5e                   	pop    %esi
+  802127:	5d                   	pop    %ebp
+  802128:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  802129:	83 ec 0c             	sub    $0xc,%esp
+  80212c:	56                   	push   %esi
+  80212d:	e8 8e f5 ff ff       	call   8016c0 <fd2data>
+  802132:	83 c4 08             	add    $0x8,%esp
+  802135:	50                   	push   %eax
+  802136:	6a 00                	push   $0x0
+  802138:	e8 1c f0 ff ff       	call   801159 <sys_page_unmap>
+  80213d:	83 c4 10             	add    $0x10,%esp
+  802140:	eb c2                	jmp    802104 <devfile_flush+0x1c>
+
+00802142 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  802142:	55                   	push   %ebp
+  802143:	89 e5                	mov    %esp,%ebp
+  802145:	57                   	push   %edi
+  802146:	56                   	push   %esi
+  802147:	53                   	push   %ebx
+  802148:	83 ec 64             	sub    $0x64,%esp
+  80214b:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  80214d:	52                   	push   %edx
+  80214e:	50                   	push   %eax
+  80214f:	e8 d9 f5 ff ff       	call   80172d <fd_lookup>
+  802154:	89 c1                	mov    %eax,%ecx
+  802156:	83 c4 10             	add    $0x10,%esp
+  802159:	85 c0                	test   %eax,%eax
+  80215b:	0f 88 f2 00 00 00    	js     802253 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  802161:	8b 07                	mov    (%edi),%eax
+  802163:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802169:	39 10                	cmp    %edx,(%eax)
+  80216b:	0f 85 03 01 00 00    	jne    802274 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  802171:	a1 e4 a0 80 00       	mov    0x80a0e4,%eax
+  802176:	8b 40 48             	mov    0x48(%eax),%eax
+  802179:	3b 05 c4 c0 80 00    	cmp    0x80c0c4,%eax
+  80217f:	0f 84 96 00 00 00    	je     80221b <fsring_slot+0xd9>
+	if (fsenv == 0)
+  802185:	83 3d c8 c0 80 00 00 	cmpl   $0x0,0x80c0c8
+  80218c:	0f 84 cb 00 00 00    	je     80225d <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  802192:	b8 00 b0 80 00       	mov    $0x80b000,%eax
+  802197:	83 c8 07             	or     $0x7,%eax
+  80219a:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  80219d:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8021a0:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  8021a5:	83 ec 04             	sub    $0x4,%esp
+  8021a8:	68 07 04 00 00       	push   $0x407
+  8021ad:	53                   	push   %ebx
+  8021ae:	6a 00                	push   $0x0
+  8021b0:	e8 17 ef ff ff       	call   8010cc <sys_page_alloc>
+  8021b5:	89 c1                	mov    %eax,%ecx
+  8021b7:	83 c4 10             	add    $0x10,%esp
+  8021ba:	85 c0                	test   %eax,%eax
+  8021bc:	0f 88 91 00 00 00    	js     802253 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  8021c2:	89 d8                	mov    %ebx,%eax
+  8021c4:	83 c8 07             	or     $0x7,%eax
+  8021c7:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8021c9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8021cf:	83 c6 04             	add    $0x4,%esi
+  8021d2:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8021d8:	75 cb                	jne    8021a5 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8021da:	6a 12                	push   $0x12
+  8021dc:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8021df:	50                   	push   %eax
+  8021e0:	6a 0c                	push   $0xc
+  8021e2:	ff 35 c8 c0 80 00    	push   0x80c0c8
+  8021e8:	e8 36 f4 ff ff       	call   801623 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8021ed:	83 c4 0c             	add    $0xc,%esp
+  8021f0:	6a 00                	push   $0x0
+  8021f2:	6a 00                	push   $0x0
+  8021f4:	6a 00                	push   $0x0
+  8021f6:	e8 d2 f2 ff ff       	call   8014cd <ipc_recv>
+  8021fb:	89 c1                	mov    %eax,%ecx
+  8021fd:	83 c4 10             	add    $0x10,%esp
+  802200:	85 c0                	test   %eax,%eax
+  802202:	78 4f                	js     802253 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  802204:	a1 e4 a0 80 00       	mov    0x80a0e4,%eax
+  802209:	8b 40 48             	mov    0x48(%eax),%eax
+  80220c:	a3 c4 c0 80 00       	mov    %eax,0x80c0c4
+	fsring_busy = 0;
+  802211:	c7 05 c0 c0 80 00 00 	movl   $0x0,0x80c0c0
+  802218:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  80221b:	83 ec 0c             	sub    $0xc,%esp
+  80221e:	ff 37                	push   (%edi)
+  802220:	e8 e4 fc ff ff       	call   801f09 <devfile_sync>
+  802225:	89 c1                	mov    %eax,%ecx
+  802227:	83 c4 10             	add    $0x10,%esp
+  80222a:	85 c0                	test   %eax,%eax
+  80222c:	78 25                	js     802253 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  80222e:	8b 1d c0 c0 80 00    	mov    0x80c0c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802234:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  802239:	ba 01 00 00 00       	mov    $0x1,%edx
+  80223e:	89 d0                	mov    %edx,%eax
+  802240:	d3 e0                	shl    %cl,%eax
+  802242:	85 d8                	test   %ebx,%eax
+  802244:	74 0d                	je     802253 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802246:	83 c1 01             	add    $0x1,%ecx
+  802249:	83 f9 10             	cmp    $0x10,%ecx
+  80224c:	75 f0                	jne    80223e <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  80224e:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  802253:	89 c8                	mov    %ecx,%eax
+  802255:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802258:	5b                   	pop    %ebx
+  802259:	5e                   	pop    %esi
+  80225a:	5f                   	pop    %edi
+  80225b:	5d                   	pop    %ebp
+  80225c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80225d:	83 ec 0c             	sub    $0xc,%esp
+  802260:	6a 01                	push   $0x1
+  802262:	e8 0a f4 ff ff       	call   801671 <ipc_find_env>
+  802267:	a3 c8 c0 80 00       	mov    %eax,0x80c0c8
+  80226c:	83 c4 10             	add    $0x10,%esp
+  80226f:	e9 1e ff ff ff       	jmp    802192 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  802274:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  802279:	eb d8                	jmp    802253 <fsring_slot+0x111>
+
+0080227b <file_read_direct>:
+{
+  80227b:	55                   	push   %ebp
+  80227c:	89 e5                	mov    %esp,%ebp
+  80227e:	57                   	push   %edi
+  80227f:	56                   	push   %esi
+  802280:	53                   	push   %ebx
+  802281:	83 ec 1c             	sub    $0x1c,%esp
+  802284:	89 c7                	mov    %eax,%edi
+  802286:	89 d6                	mov    %edx,%esi
+  802288:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  80228a:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  802290:	77 52                	ja     8022e4 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802292:	8b 40 0c             	mov    0xc(%eax),%eax
+  802295:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	fsipcbuf.read.req_n = n;
+  80229a:	89 0d 04 b0 80 00    	mov    %ecx,0x80b004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8022a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022aa:	e8 b6 fb ff ff       	call   801e65 <fsipc>
+  8022af:	89 c7                	mov    %eax,%edi
+  8022b1:	85 c0                	test   %eax,%eax
+  8022b3:	78 25                	js     8022da <file_read_direct+0x5f>
+	assert(r <= n);
+  8022b5:	39 c3                	cmp    %eax,%ebx
+  8022b7:	0f 82 87 00 00 00    	jb     802344 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  8022bd:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8022c2:	0f 8f 95 00 00 00    	jg     80235d <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8022c8:	83 ec 04             	sub    $0x4,%esp
+  8022cb:	50                   	push   %eax
+  8022cc:	68 00 b0 80 00       	push   $0x80b000
+  8022d1:	56                   	push   %esi
+  8022d2:	e8 6f eb ff ff       	call   800e46 <memmove>
+	return r;
+  8022d7:	83 c4 10             	add    $0x10,%esp
+}
+  8022da:	89 f8                	mov    %edi,%eax
+  8022dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022df:	5b                   	pop    %ebx
+  8022e0:	5e                   	pop    %esi
+  8022e1:	5f                   	pop    %edi
+  8022e2:	5d                   	pop    %ebp
+  8022e3:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8022e4:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8022ea:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8022ef:	29 d1                	sub    %edx,%ecx
+  8022f1:	39 d9                	cmp    %ebx,%ecx
+  8022f3:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8022f6:	89 f0                	mov    %esi,%eax
+  8022f8:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8022fb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8022fe:	eb 0f                	jmp    80230f <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  802300:	0f b6 10             	movzbl (%eax),%edx
+  802303:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802305:	05 00 10 00 00       	add    $0x1000,%eax
+  80230a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80230f:	39 c8                	cmp    %ecx,%eax
+  802311:	72 ed                	jb     802300 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802313:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802316:	8b 47 0c             	mov    0xc(%edi),%eax
+  802319:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	fsipcbuf.bulk.req_n = n;
+  80231e:	89 1d 04 b0 80 00    	mov    %ebx,0x80b004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802324:	89 15 08 b0 80 00    	mov    %edx,0x80b008
+	return fsipc_pages(type, buf, n, perm);
+  80232a:	83 ec 0c             	sub    $0xc,%esp
+  80232d:	6a 07                	push   $0x7
+  80232f:	89 d9                	mov    %ebx,%ecx
+  802331:	89 f2                	mov    %esi,%edx
+  802333:	b8 09 00 00 00       	mov    $0x9,%eax
+  802338:	e8 86 f9 ff ff       	call   801cc3 <fsipc_pages>
+  80233d:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  80233f:	83 c4 10             	add    $0x10,%esp
+  802342:	eb 96                	jmp    8022da <file_read_direct+0x5f>
+	assert(r <= n);
+  802344:	68 df 4a 80 00       	push   $0x804adf
+  802349:	68 07 4a 80 00       	push   $0x804a07
+  80234e:	68 dc 00 00 00       	push   $0xdc
+  802353:	68 d4 4a 80 00       	push   $0x804ad4
+  802358:	e8 9a e2 ff ff       	call   8005f7 <_panic>
+	assert(r <= PGSIZE);
+  80235d:	68 f0 4a 80 00       	push   $0x804af0
+  802362:	68 07 4a 80 00       	push   $0x804a07
+  802367:	68 dd 00 00 00       	push   $0xdd
+  80236c:	68 d4 4a 80 00       	push   $0x804ad4
+  802371:	e8 81 e2 ff ff       	call   8005f7 <_panic>
+
+00802376 <devfile_read>:
+{
+  802376:	55                   	push   %ebp
+  802377:	89 e5                	mov    %esp,%ebp
+  802379:	57                   	push   %edi
+  80237a:	56                   	push   %esi
+  80237b:	53                   	push   %ebx
+  80237c:	83 ec 28             	sub    $0x28,%esp
+  80237f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802382:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  802385:	53                   	push   %ebx
+  802386:	e8 35 f3 ff ff       	call   8016c0 <fd2data>
+  80238b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  80238e:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  802391:	83 c4 10             	add    $0x10,%esp
+  802394:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  802398:	74 7d                	je     802417 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80239a:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80239e:	0f 85 81 00 00 00    	jne    802425 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  8023a4:	8b 43 18             	mov    0x18(%ebx),%eax
+  8023a7:	85 c0                	test   %eax,%eax
+  8023a9:	74 0d                	je     8023b8 <devfile_read+0x42>
+  8023ab:	8b 53 14             	mov    0x14(%ebx),%edx
+  8023ae:	39 fa                	cmp    %edi,%edx
+  8023b0:	7f 06                	jg     8023b8 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8023b2:	01 c2                	add    %eax,%edx
+  8023b4:	39 d7                	cmp    %edx,%edi
+  8023b6:	72 28                	jb     8023e0 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8023b8:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8023bf:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8023c5:	77 74                	ja     80243b <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8023c7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8023cc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8023cf:	89 d8                	mov    %ebx,%eax
+  8023d1:	e8 a5 fe ff ff       	call   80227b <file_read_direct>
+  8023d6:	85 c0                	test   %eax,%eax
+  8023d8:	7e 35                	jle    80240f <devfile_read+0x99>
+		ff->buf_base = pos;
+  8023da:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8023dd:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8023e0:	8b 53 14             	mov    0x14(%ebx),%edx
+  8023e3:	89 d0                	mov    %edx,%eax
+  8023e5:	03 43 18             	add    0x18(%ebx),%eax
+  8023e8:	29 f8                	sub    %edi,%eax
+  8023ea:	39 f0                	cmp    %esi,%eax
+  8023ec:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8023ef:	83 ec 04             	sub    $0x4,%esp
+  8023f2:	56                   	push   %esi
+  8023f3:	89 f8                	mov    %edi,%eax
+  8023f5:	29 d0                	sub    %edx,%eax
+  8023f7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8023fa:	01 c1                	add    %eax,%ecx
+  8023fc:	51                   	push   %ecx
+  8023fd:	ff 75 0c             	push   0xc(%ebp)
+  802400:	e8 41 ea ff ff       	call   800e46 <memmove>
+	fd->fd_offset = pos + n;
+  802405:	01 f7                	add    %esi,%edi
+  802407:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80240a:	89 f0                	mov    %esi,%eax
+  80240c:	83 c4 10             	add    $0x10,%esp
+}
+  80240f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802412:	5b                   	pop    %ebx
+  802413:	5e                   	pop    %esi
+  802414:	5f                   	pop    %edi
+  802415:	5d                   	pop    %ebp
+  802416:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802417:	89 f1                	mov    %esi,%ecx
+  802419:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80241c:	89 d8                	mov    %ebx,%eax
+  80241e:	e8 58 fe ff ff       	call   80227b <file_read_direct>
+  802423:	eb ea                	jmp    80240f <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802425:	83 ec 0c             	sub    $0xc,%esp
+  802428:	53                   	push   %ebx
+  802429:	e8 db fa ff ff       	call   801f09 <devfile_sync>
+  80242e:	83 c4 10             	add    $0x10,%esp
+  802431:	85 c0                	test   %eax,%eax
+  802433:	0f 89 6b ff ff ff    	jns    8023a4 <devfile_read+0x2e>
+  802439:	eb d4                	jmp    80240f <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  80243b:	89 f1                	mov    %esi,%ecx
+  80243d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802440:	89 d8                	mov    %ebx,%eax
+  802442:	e8 34 fe ff ff       	call   80227b <file_read_direct>
+  802447:	eb c6                	jmp    80240f <devfile_read+0x99>
+
+00802449 <open>:
+{
+  802449:	55                   	push   %ebp
+  80244a:	89 e5                	mov    %esp,%ebp
+  80244c:	56                   	push   %esi
+  80244d:	53                   	push   %ebx
+  80244e:	83 ec 1c             	sub    $0x1c,%esp
+  802451:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802454:	56                   	push   %esi
+  802455:	e8 2b e8 ff ff       	call   800c85 <strlen>
+  80245a:	83 c4 10             	add    $0x10,%esp
+  80245d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802462:	0f 8f a0 00 00 00    	jg     802508 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  802468:	83 ec 0c             	sub    $0xc,%esp
+  80246b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80246e:	50                   	push   %eax
+  80246f:	e8 63 f2 ff ff       	call   8016d7 <fd_alloc>
+  802474:	89 c3                	mov    %eax,%ebx
+  802476:	83 c4 10             	add    $0x10,%esp
+  802479:	85 c0                	test   %eax,%eax
+  80247b:	78 45                	js     8024c2 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  80247d:	83 ec 08             	sub    $0x8,%esp
+  802480:	56                   	push   %esi
+  802481:	68 00 b0 80 00       	push   $0x80b000
+  802486:	e8 35 e8 ff ff       	call   800cc0 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80248b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80248e:	a3 00 b4 80 00       	mov    %eax,0x80b400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802493:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802496:	b8 01 00 00 00       	mov    $0x1,%eax
+  80249b:	e8 c5 f9 ff ff       	call   801e65 <fsipc>
+  8024a0:	89 c3                	mov    %eax,%ebx
+  8024a2:	83 c4 10             	add    $0x10,%esp
+  8024a5:	85 c0                	test   %eax,%eax
+  8024a7:	78 22                	js     8024cb <open+0x82>
+	if (!(mode & O_NOBUF)
+  8024a9:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8024b0:	74 2b                	je     8024dd <open+0x94>
+	return fd2num(fd);
+  8024b2:	83 ec 0c             	sub    $0xc,%esp
+  8024b5:	ff 75 f4             	push   -0xc(%ebp)
+  8024b8:	e8 f3 f1 ff ff       	call   8016b0 <fd2num>
+  8024bd:	89 c3                	mov    %eax,%ebx
+  8024bf:	83 c4 10             	add    $0x10,%esp
+}
+  8024c2:	89 d8                	mov    %ebx,%eax
+  8024c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024c7:	5b                   	pop    %ebx
+  8024c8:	5e                   	pop    %esi
+  8024c9:	5d                   	pop    %ebp
+  8024ca:	c3                   	ret
+		fd_close(fd, 0);
+  8024cb:	83 ec 08             	sub    $0x8,%esp
+  8024ce:	6a 00                	push   $0x0
+  8024d0:	ff 75 f4             	push   -0xc(%ebp)
+  8024d3:	e8 f8 f2 ff ff       	call   8017d0 <fd_close>
+		return r;
+  8024d8:	83 c4 10             	add    $0x10,%esp
+  8024db:	eb e5                	jmp    8024c2 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8024dd:	83 ec 0c             	sub    $0xc,%esp
+  8024e0:	ff 75 f4             	push   -0xc(%ebp)
+  8024e3:	e8 d8 f1 ff ff       	call   8016c0 <fd2data>
+  8024e8:	83 c4 0c             	add    $0xc,%esp
+  8024eb:	68 07 04 00 00       	push   $0x407
+  8024f0:	50                   	push   %eax
+  8024f1:	6a 00                	push   $0x0
+  8024f3:	e8 d4 eb ff ff       	call   8010cc <sys_page_alloc>
+  8024f8:	83 c4 10             	add    $0x10,%esp
+  8024fb:	85 c0                	test   %eax,%eax
+  8024fd:	75 b3                	jne    8024b2 <open+0x69>
+		fd->fd_file.buffered = 1;
+  8024ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802502:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802506:	eb aa                	jmp    8024b2 <open+0x69>
+		return -E_BAD_PATH;
+  802508:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80250d:	eb b3                	jmp    8024c2 <open+0x79>
+
+0080250f <readdir>:
+{
+  80250f:	55                   	push   %ebp
+  802510:	89 e5                	mov    %esp,%ebp
+  802512:	53                   	push   %ebx
+  802513:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802516:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802519:	50                   	push   %eax
+  80251a:	ff 75 08             	push   0x8(%ebp)
+  80251d:	e8 0b f2 ff ff       	call   80172d <fd_lookup>
+  802522:	89 c3                	mov    %eax,%ebx
+  802524:	83 c4 10             	add    $0x10,%esp
+  802527:	85 c0                	test   %eax,%eax
+  802529:	78 73                	js     80259e <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80252b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80252e:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802534:	39 08                	cmp    %ecx,(%eax)
+  802536:	0f 85 82 00 00 00    	jne    8025be <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  80253c:	83 ec 0c             	sub    $0xc,%esp
+  80253f:	50                   	push   %eax
+  802540:	e8 c4 f9 ff ff       	call   801f09 <devfile_sync>
+  802545:	89 c3                	mov    %eax,%ebx
+  802547:	83 c4 10             	add    $0x10,%esp
+  80254a:	85 c0                	test   %eax,%eax
+  80254c:	78 50                	js     80259e <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  80254e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802551:	8b 40 0c             	mov    0xc(%eax),%eax
+  802554:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	fsipcbuf.readdir.req_n = n;
+  802559:	8b 45 10             	mov    0x10(%ebp),%eax
+  80255c:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	fsipcbuf.readdir.req_flags = flags;
+  802561:	8b 45 14             	mov    0x14(%ebp),%eax
+  802564:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  802569:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802573:	e8 ed f8 ff ff       	call   801e65 <fsipc>
+  802578:	89 c3                	mov    %eax,%ebx
+  80257a:	85 c0                	test   %eax,%eax
+  80257c:	7e 20                	jle    80259e <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  80257e:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802581:	72 22                	jb     8025a5 <readdir+0x96>
+  802583:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802588:	7f 1b                	jg     8025a5 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80258a:	83 ec 04             	sub    $0x4,%esp
+  80258d:	50                   	push   %eax
+  80258e:	68 00 b0 80 00       	push   $0x80b000
+  802593:	ff 75 0c             	push   0xc(%ebp)
+  802596:	e8 ab e8 ff ff       	call   800e46 <memmove>
+	return r;
+  80259b:	83 c4 10             	add    $0x10,%esp
+}
+  80259e:	89 d8                	mov    %ebx,%eax
+  8025a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025a3:	c9                   	leave
+  8025a4:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8025a5:	68 e6 4a 80 00       	push   $0x804ae6
+  8025aa:	68 07 4a 80 00       	push   $0x804a07
+  8025af:	68 86 01 00 00       	push   $0x186
+  8025b4:	68 d4 4a 80 00       	push   $0x804ad4
+  8025b9:	e8 39 e0 ff ff       	call   8005f7 <_panic>
+		return -E_NOT_SUPP;
+  8025be:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8025c3:	eb d9                	jmp    80259e <readdir+0x8f>
+
+008025c5 <munmap>:
+{
+  8025c5:	55                   	push   %ebp
+  8025c6:	89 e5                	mov    %esp,%ebp
+  8025c8:	56                   	push   %esi
+  8025c9:	53                   	push   %ebx
+  8025ca:	8b 75 08             	mov    0x8(%ebp),%esi
+  8025cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8025d0:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8025d6:	75 41                	jne    802619 <munmap+0x54>
+  8025d8:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8025de:	77 39                	ja     802619 <munmap+0x54>
+  8025e0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8025e5:	29 f0                	sub    %esi,%eax
+  8025e7:	39 d0                	cmp    %edx,%eax
+  8025e9:	72 35                	jb     802620 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8025eb:	89 f3                	mov    %esi,%ebx
+  8025ed:	01 d6                	add    %edx,%esi
+  8025ef:	39 f3                	cmp    %esi,%ebx
+  8025f1:	73 1a                	jae    80260d <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8025f3:	83 ec 08             	sub    $0x8,%esp
+  8025f6:	53                   	push   %ebx
+  8025f7:	6a 00                	push   $0x0
+  8025f9:	e8 5b eb ff ff       	call   801159 <sys_page_unmap>
+  8025fe:	83 c4 10             	add    $0x10,%esp
+  802601:	85 c0                	test   %eax,%eax
+  802603:	78 0d                	js     802612 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802605:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80260b:	eb e2                	jmp    8025ef <munmap+0x2a>
+	return 0;
+  80260d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802612:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802615:	5b                   	pop    %ebx
+  802616:	5e                   	pop    %esi
+  802617:	5d                   	pop    %ebp
+  802618:	c3                   	ret
+		return -E_INVAL;
+  802619:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80261e:	eb f2                	jmp    802612 <munmap+0x4d>
+  802620:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802625:	eb eb                	jmp    802612 <munmap+0x4d>
+
+00802627 <mmap>:
+{
+  802627:	55                   	push   %ebp
+  802628:	89 e5                	mov    %esp,%ebp
+  80262a:	57                   	push   %edi
+  80262b:	56                   	push   %esi
+  80262c:	53                   	push   %ebx
+  80262d:	83 ec 34             	sub    $0x34,%esp
+  802630:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802633:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802636:	50                   	push   %eax
+  802637:	ff 75 18             	push   0x18(%ebp)
+  80263a:	e8 ee f0 ff ff       	call   80172d <fd_lookup>
+  80263f:	89 c3                	mov    %eax,%ebx
+  802641:	83 c4 10             	add    $0x10,%esp
+  802644:	85 c0                	test   %eax,%eax
+  802646:	0f 88 0e 01 00 00    	js     80275a <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80264c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80264f:	a1 20 50 80 00       	mov    0x805020,%eax
+  802654:	39 02                	cmp    %eax,(%edx)
+  802656:	0f 85 50 01 00 00    	jne    8027ac <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  80265c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80265f:	83 e0 02             	and    $0x2,%eax
+  802662:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802665:	74 0a                	je     802671 <mmap+0x4a>
+  802667:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80266b:	0f 84 42 01 00 00    	je     8027b3 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802671:	8b 42 08             	mov    0x8(%edx),%eax
+  802674:	83 e0 03             	and    $0x3,%eax
+  802677:	83 f8 01             	cmp    $0x1,%eax
+  80267a:	0f 84 3a 01 00 00    	je     8027ba <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802680:	8b 45 08             	mov    0x8(%ebp),%eax
+  802683:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802686:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80268b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80268e:	0f 85 2d 01 00 00    	jne    8027c1 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802694:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802698:	0f 88 2a 01 00 00    	js     8027c8 <mmap+0x1a1>
+  80269e:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8026a5:	0f 87 1d 01 00 00    	ja     8027c8 <mmap+0x1a1>
+  8026ab:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8026b0:	2b 45 08             	sub    0x8(%ebp),%eax
+  8026b3:	39 f8                	cmp    %edi,%eax
+  8026b5:	0f 82 14 01 00 00    	jb     8027cf <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8026bb:	83 ec 0c             	sub    $0xc,%esp
+  8026be:	52                   	push   %edx
+  8026bf:	e8 45 f8 ff ff       	call   801f09 <devfile_sync>
+  8026c4:	89 c3                	mov    %eax,%ebx
+  8026c6:	83 c4 10             	add    $0x10,%esp
+  8026c9:	85 c0                	test   %eax,%eax
+  8026cb:	0f 88 89 00 00 00    	js     80275a <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8026d1:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8026d7:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8026dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e2:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8026e5:	39 fe                	cmp    %edi,%esi
+  8026e7:	73 7b                	jae    802764 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8026e9:	89 f8                	mov    %edi,%eax
+  8026eb:	29 f0                	sub    %esi,%eax
+  8026ed:	c1 e8 0c             	shr    $0xc,%eax
+  8026f0:	ba 40 00 00 00       	mov    $0x40,%edx
+  8026f5:	39 d0                	cmp    %edx,%eax
+  8026f7:	0f 47 c2             	cmova  %edx,%eax
+  8026fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8026fd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802700:	8b 52 0c             	mov    0xc(%edx),%edx
+  802703:	89 15 00 b0 80 00    	mov    %edx,0x80b000
+		fsipcbuf.map.req_offset = offset + done;
+  802709:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  80270c:	89 15 04 b0 80 00    	mov    %edx,0x80b004
+		fsipcbuf.map.req_npages = n;
+  802712:	a3 08 b0 80 00       	mov    %eax,0x80b008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802717:	89 f2                	mov    %esi,%edx
+  802719:	03 55 08             	add    0x8(%ebp),%edx
+  80271c:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80271f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802724:	e8 ea f6 ff ff       	call   801e13 <fsipcv>
+  802729:	85 c0                	test   %eax,%eax
+  80272b:	7e 12                	jle    80273f <mmap+0x118>
+  80272d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802730:	85 c0                	test   %eax,%eax
+  802732:	0f 84 9e 00 00 00    	je     8027d6 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802738:	c1 e0 0c             	shl    $0xc,%eax
+  80273b:	01 c6                	add    %eax,%esi
+  80273d:	eb a6                	jmp    8026e5 <mmap+0xbe>
+			munmap(addr, done);
+  80273f:	89 c3                	mov    %eax,%ebx
+  802741:	83 ec 08             	sub    $0x8,%esp
+  802744:	56                   	push   %esi
+  802745:	ff 75 08             	push   0x8(%ebp)
+  802748:	e8 78 fe ff ff       	call   8025c5 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80274d:	83 c4 10             	add    $0x10,%esp
+  802750:	85 db                	test   %ebx,%ebx
+  802752:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802757:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80275a:	89 d8                	mov    %ebx,%eax
+  80275c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80275f:	5b                   	pop    %ebx
+  802760:	5e                   	pop    %esi
+  802761:	5f                   	pop    %edi
+  802762:	5d                   	pop    %ebp
+  802763:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802764:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802767:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802769:	85 c0                	test   %eax,%eax
+  80276b:	74 ed                	je     80275a <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80276d:	be 00 00 00 00       	mov    $0x0,%esi
+  802772:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802775:	39 fe                	cmp    %edi,%esi
+  802777:	73 2e                	jae    8027a7 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802779:	83 ec 0c             	sub    $0xc,%esp
+  80277c:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  80277f:	50                   	push   %eax
+  802780:	e8 a8 17 00 00       	call   803f2d <cowpage>
+  802785:	83 c4 10             	add    $0x10,%esp
+  802788:	85 c0                	test   %eax,%eax
+  80278a:	78 08                	js     802794 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  80278c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802792:	eb e1                	jmp    802775 <mmap+0x14e>
+				munmap(addr, len);
+  802794:	89 c3                	mov    %eax,%ebx
+  802796:	83 ec 08             	sub    $0x8,%esp
+  802799:	57                   	push   %edi
+  80279a:	ff 75 08             	push   0x8(%ebp)
+  80279d:	e8 23 fe ff ff       	call   8025c5 <munmap>
+				return r;
+  8027a2:	83 c4 10             	add    $0x10,%esp
+  8027a5:	eb b3                	jmp    80275a <mmap+0x133>
+	return 0;
+  8027a7:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8027aa:	eb ae                	jmp    80275a <mmap+0x133>
+		return -E_NOT_SUPP;
+  8027ac:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8027b1:	eb a7                	jmp    80275a <mmap+0x133>
+		return -E_NOT_SUPP;
+  8027b3:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8027b8:	eb a0                	jmp    80275a <mmap+0x133>
+		return -E_INVAL;
+  8027ba:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8027bf:	eb 99                	jmp    80275a <mmap+0x133>
+  8027c1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8027c6:	eb 92                	jmp    80275a <mmap+0x133>
+  8027c8:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8027cd:	eb 8b                	jmp    80275a <mmap+0x133>
+  8027cf:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8027d4:	eb 84                	jmp    80275a <mmap+0x133>
+			munmap(addr, done);
+  8027d6:	83 ec 08             	sub    $0x8,%esp
+  8027d9:	56                   	push   %esi
+  8027da:	ff 75 08             	push   0x8(%ebp)
+  8027dd:	e8 e3 fd ff ff       	call   8025c5 <munmap>
+  8027e2:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8027e5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8027ea:	e9 6b ff ff ff       	jmp    80275a <mmap+0x133>
+
+008027ef <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8027ef:	55                   	push   %ebp
+  8027f0:	89 e5                	mov    %esp,%ebp
+  8027f2:	56                   	push   %esi
+  8027f3:	53                   	push   %ebx
+  8027f4:	83 ec 10             	sub    $0x10,%esp
+  8027f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8027fa:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802800:	e8 3d f9 ff ff       	call   802142 <fsring_slot>
+  802805:	85 c0                	test   %eax,%eax
+  802807:	78 60                	js     802869 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802809:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80280c:	8b 56 08             	mov    0x8(%esi),%edx
+  80280f:	83 e2 03             	and    $0x3,%edx
+  802812:	83 fa 01             	cmp    $0x1,%edx
+  802815:	74 59                	je     802870 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802817:	ba 01 00 00 00       	mov    $0x1,%edx
+  80281c:	89 c1                	mov    %eax,%ecx
+  80281e:	d3 e2                	shl    %cl,%edx
+  802820:	09 15 c0 c0 80 00    	or     %edx,0x80c0c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802826:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802829:	c1 e2 02             	shl    $0x2,%edx
+  80282c:	8d 8a 00 c0 80 00    	lea    0x80c000(%edx),%ecx
+  802832:	c7 82 00 c0 80 00 03 	movl   $0x3,0x80c000(%edx)
+  802839:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80283c:	8b 55 18             	mov    0x18(%ebp),%edx
+  80283f:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802842:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802845:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802848:	83 ec 08             	sub    $0x8,%esp
+  80284b:	50                   	push   %eax
+  80284c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802851:	39 c3                	cmp    %eax,%ebx
+  802853:	0f 47 d8             	cmova  %eax,%ebx
+  802856:	53                   	push   %ebx
+  802857:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80285a:	89 f2                	mov    %esi,%edx
+  80285c:	b8 03 00 00 00       	mov    $0x3,%eax
+  802861:	e8 1e f5 ff ff       	call   801d84 <fsring_post>
+  802866:	83 c4 10             	add    $0x10,%esp
+}
+  802869:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80286c:	5b                   	pop    %ebx
+  80286d:	5e                   	pop    %esi
+  80286e:	5d                   	pop    %ebp
+  80286f:	c3                   	ret
+		return -E_INVAL;
+  802870:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802875:	eb f2                	jmp    802869 <fsring_read+0x7a>
+
+00802877 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802877:	55                   	push   %ebp
+  802878:	89 e5                	mov    %esp,%ebp
+  80287a:	56                   	push   %esi
+  80287b:	53                   	push   %ebx
+  80287c:	83 ec 10             	sub    $0x10,%esp
+  80287f:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802882:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802885:	8b 45 08             	mov    0x8(%ebp),%eax
+  802888:	e8 b5 f8 ff ff       	call   802142 <fsring_slot>
+  80288d:	89 c3                	mov    %eax,%ebx
+  80288f:	85 c0                	test   %eax,%eax
+  802891:	78 77                	js     80290a <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802893:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802896:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80289a:	74 77                	je     802913 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80289c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8028a1:	39 c6                	cmp    %eax,%esi
+  8028a3:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8028a6:	83 ec 04             	sub    $0x4,%esp
+  8028a9:	56                   	push   %esi
+  8028aa:	ff 75 0c             	push   0xc(%ebp)
+  8028ad:	89 d8                	mov    %ebx,%eax
+  8028af:	c1 e0 0c             	shl    $0xc,%eax
+  8028b2:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8028b8:	50                   	push   %eax
+  8028b9:	e8 88 e5 ff ff       	call   800e46 <memmove>
+	fsring_busy |= 1 << slot;
+  8028be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028c3:	89 d9                	mov    %ebx,%ecx
+  8028c5:	d3 e0                	shl    %cl,%eax
+  8028c7:	09 05 c0 c0 80 00    	or     %eax,0x80c0c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8028cd:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8028d0:	c1 e0 02             	shl    $0x2,%eax
+  8028d3:	8d 90 00 c0 80 00    	lea    0x80c000(%eax),%edx
+  8028d9:	c7 80 00 c0 80 00 04 	movl   $0x4,0x80c000(%eax)
+  8028e0:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8028e3:	8b 45 18             	mov    0x18(%ebp),%eax
+  8028e6:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8028e9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8028f0:	83 c4 08             	add    $0x8,%esp
+  8028f3:	53                   	push   %ebx
+  8028f4:	56                   	push   %esi
+  8028f5:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8028f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028fb:	b8 04 00 00 00       	mov    $0x4,%eax
+  802900:	e8 7f f4 ff ff       	call   801d84 <fsring_post>
+  802905:	89 c3                	mov    %eax,%ebx
+  802907:	83 c4 10             	add    $0x10,%esp
+}
+  80290a:	89 d8                	mov    %ebx,%eax
+  80290c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80290f:	5b                   	pop    %ebx
+  802910:	5e                   	pop    %esi
+  802911:	5d                   	pop    %ebp
+  802912:	c3                   	ret
+		return -E_INVAL;
+  802913:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802918:	eb f0                	jmp    80290a <fsring_write+0x93>
+
+0080291a <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80291a:	55                   	push   %ebp
+  80291b:	89 e5                	mov    %esp,%ebp
+  80291d:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802920:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802923:	8b 45 08             	mov    0x8(%ebp),%eax
+  802926:	e8 17 f8 ff ff       	call   802142 <fsring_slot>
+  80292b:	85 c0                	test   %eax,%eax
+  80292d:	78 4c                	js     80297b <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  80292f:	ba 01 00 00 00       	mov    $0x1,%edx
+  802934:	89 c1                	mov    %eax,%ecx
+  802936:	d3 e2                	shl    %cl,%edx
+  802938:	09 15 c0 c0 80 00    	or     %edx,0x80c0c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  80293e:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802941:	c1 e2 02             	shl    $0x2,%edx
+  802944:	8d 8a 00 c0 80 00    	lea    0x80c000(%edx),%ecx
+  80294a:	c7 82 00 c0 80 00 05 	movl   $0x5,0x80c000(%edx)
+  802951:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802954:	8b 55 10             	mov    0x10(%ebp),%edx
+  802957:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80295a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80295d:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802960:	83 ec 08             	sub    $0x8,%esp
+  802963:	50                   	push   %eax
+  802964:	6a 00                	push   $0x0
+  802966:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80296b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80296e:	b8 05 00 00 00       	mov    $0x5,%eax
+  802973:	e8 0c f4 ff ff       	call   801d84 <fsring_post>
+  802978:	83 c4 10             	add    $0x10,%esp
+}
+  80297b:	c9                   	leave
+  80297c:	c3                   	ret
+
+0080297d <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  80297d:	55                   	push   %ebp
+  80297e:	89 e5                	mov    %esp,%ebp
+  802980:	57                   	push   %edi
+  802981:	56                   	push   %esi
+  802982:	53                   	push   %ebx
+  802983:	83 ec 1c             	sub    $0x1c,%esp
+  802986:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80298a:	a1 e4 a0 80 00       	mov    0x80a0e4,%eax
+  80298f:	8b 40 48             	mov    0x48(%eax),%eax
+  802992:	3b 05 c4 c0 80 00    	cmp    0x80c0c4,%eax
+  802998:	74 12                	je     8029ac <fsring_reap+0x2f>
+		return 0;
+  80299a:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  80299f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029a2:	5b                   	pop    %ebx
+  8029a3:	5e                   	pop    %esi
+  8029a4:	5f                   	pop    %edi
+  8029a5:	5d                   	pop    %ebp
+  8029a6:	c3                   	ret
+		sys_yield();
+  8029a7:	e8 01 e7 ff ff       	call   8010ad <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8029ac:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8029b2:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8029b7:	39 c2                	cmp    %eax,%edx
+  8029b9:	75 18                	jne    8029d3 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8029bb:	84 db                	test   %bl,%bl
+  8029bd:	0f 84 21 01 00 00    	je     802ae4 <fsring_reap+0x167>
+  8029c3:	83 3d c0 c0 80 00 00 	cmpl   $0x0,0x80c0c0
+  8029ca:	75 db                	jne    8029a7 <fsring_reap+0x2a>
+			return 0;
+  8029cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d1:	eb cc                	jmp    80299f <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8029d3:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8029d8:	83 e0 0f             	and    $0xf,%eax
+  8029db:	83 c0 2a             	add    $0x2a,%eax
+  8029de:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8029e5:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8029ec:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8029f1:	83 c0 01             	add    $0x1,%eax
+  8029f4:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8029f9:	83 fb 0f             	cmp    $0xf,%ebx
+  8029fc:	77 5b                	ja     802a59 <fsring_reap+0xdc>
+  8029fe:	be 01 00 00 00       	mov    $0x1,%esi
+  802a03:	89 d9                	mov    %ebx,%ecx
+  802a05:	d3 e6                	shl    %cl,%esi
+  802a07:	89 f0                	mov    %esi,%eax
+  802a09:	23 05 c0 c0 80 00    	and    0x80c0c0,%eax
+  802a0f:	74 48                	je     802a59 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802a11:	89 d8                	mov    %ebx,%eax
+  802a13:	c1 e0 0c             	shl    $0xc,%eax
+  802a16:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802a1c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802a1f:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802a22:	8b 04 85 00 c0 80 00 	mov    0x80c000(,%eax,4),%eax
+  802a29:	83 f8 03             	cmp    $0x3,%eax
+  802a2c:	74 40                	je     802a6e <fsring_reap+0xf1>
+  802a2e:	83 f8 05             	cmp    $0x5,%eax
+  802a31:	74 64                	je     802a97 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802a33:	f7 d6                	not    %esi
+  802a35:	21 35 c0 c0 80 00    	and    %esi,0x80c0c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802a3b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802a3e:	8b 14 85 04 c0 80 00 	mov    0x80c004(,%eax,4),%edx
+  802a45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a48:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802a4a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a4d:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802a4f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a54:	e9 46 ff ff ff       	jmp    80299f <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802a59:	53                   	push   %ebx
+  802a5a:	68 fc 4a 80 00       	push   $0x804afc
+  802a5f:	68 8f 02 00 00       	push   $0x28f
+  802a64:	68 d4 4a 80 00       	push   $0x804ad4
+  802a69:	e8 89 db ff ff       	call   8005f7 <_panic>
+		if (cqe.cqe_result > 0)
+  802a6e:	85 ff                	test   %edi,%edi
+  802a70:	7e c1                	jle    802a33 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802a72:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802a75:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802a7a:	39 c7                	cmp    %eax,%edi
+  802a7c:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802a7f:	50                   	push   %eax
+  802a80:	ff 75 e4             	push   -0x1c(%ebp)
+  802a83:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802a86:	ff 34 85 08 c0 80 00 	push   0x80c008(,%eax,4)
+  802a8d:	e8 b4 e3 ff ff       	call   800e46 <memmove>
+  802a92:	83 c4 10             	add    $0x10,%esp
+  802a95:	eb 9c                	jmp    802a33 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802a97:	85 ff                	test   %edi,%edi
+  802a99:	75 98                	jne    802a33 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802a9b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802a9e:	8b 0c 85 08 c0 80 00 	mov    0x80c008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802aa5:	83 ec 08             	sub    $0x8,%esp
+  802aa8:	ff 75 e4             	push   -0x1c(%ebp)
+  802aab:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802aae:	51                   	push   %ecx
+  802aaf:	e8 0c e2 ff ff       	call   800cc0 <strcpy>
+			st->st_size = ret->ret_size;
+  802ab4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ab7:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802abd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802ac0:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802ac6:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802acc:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802ad2:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  802ad9:	50 80 00 
+  802adc:	83 c4 10             	add    $0x10,%esp
+  802adf:	e9 4f ff ff ff       	jmp    802a33 <fsring_reap+0xb6>
+			return 0;
+  802ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae9:	e9 b1 fe ff ff       	jmp    80299f <fsring_reap+0x22>
+
+00802aee <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802aee:	55                   	push   %ebp
+  802aef:	89 e5                	mov    %esp,%ebp
+  802af1:	57                   	push   %edi
+  802af2:	56                   	push   %esi
+  802af3:	53                   	push   %ebx
+  802af4:	83 ec 28             	sub    $0x28,%esp
+  802af7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802afa:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802afd:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802b00:	53                   	push   %ebx
+  802b01:	e8 7f e1 ff ff       	call   800c85 <strlen>
+  802b06:	83 c4 10             	add    $0x10,%esp
+  802b09:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802b0e:	0f 8f 02 01 00 00    	jg     802c16 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802b14:	83 ec 08             	sub    $0x8,%esp
+  802b17:	53                   	push   %ebx
+  802b18:	68 00 b0 80 00       	push   $0x80b000
+  802b1d:	e8 9e e1 ff ff       	call   800cc0 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802b22:	83 c4 10             	add    $0x10,%esp
+  802b25:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802b2b:	76 69                	jbe    802b96 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802b2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b30:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b36:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802b3b:	29 d1                	sub    %edx,%ecx
+  802b3d:	39 f9                	cmp    %edi,%ecx
+  802b3f:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802b42:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b45:	89 f9                	mov    %edi,%ecx
+  802b47:	01 c1                	add    %eax,%ecx
+  802b49:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802b4c:	eb 0f                	jmp    802b5d <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802b4e:	0f b6 10             	movzbl (%eax),%edx
+  802b51:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802b53:	05 00 10 00 00       	add    $0x1000,%eax
+  802b58:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802b5d:	39 c8                	cmp    %ecx,%eax
+  802b5f:	72 ed                	jb     802b4e <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802b61:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802b64:	89 3d 00 b4 80 00    	mov    %edi,0x80b400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802b6a:	89 15 04 b4 80 00    	mov    %edx,0x80b404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802b70:	83 ec 0c             	sub    $0xc,%esp
+  802b73:	6a 07                	push   $0x7
+  802b75:	89 f9                	mov    %edi,%ecx
+  802b77:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b7a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802b7f:	e8 3f f1 ff ff       	call   801cc3 <fsipc_pages>
+  802b84:	89 c7                	mov    %eax,%edi
+  802b86:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802b89:	85 f6                	test   %esi,%esi
+  802b8b:	74 7f                	je     802c0c <file_slurp+0x11e>
+  802b8d:	8d 43 01             	lea    0x1(%ebx),%eax
+  802b90:	85 ff                	test   %edi,%edi
+  802b92:	79 3c                	jns    802bd0 <file_slurp+0xe2>
+  802b94:	eb 76                	jmp    802c0c <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802b96:	89 3d 00 b4 80 00    	mov    %edi,0x80b400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802b9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ba1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802ba6:	e8 ba f2 ff ff       	call   801e65 <fsipc>
+  802bab:	89 c7                	mov    %eax,%edi
+  802bad:	85 c0                	test   %eax,%eax
+  802baf:	7e d8                	jle    802b89 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802bb1:	83 ec 04             	sub    $0x4,%esp
+  802bb4:	50                   	push   %eax
+  802bb5:	68 08 b0 80 00       	push   $0x80b008
+  802bba:	ff 75 0c             	push   0xc(%ebp)
+  802bbd:	e8 84 e2 ff ff       	call   800e46 <memmove>
+  802bc2:	83 c4 10             	add    $0x10,%esp
+  802bc5:	eb c2                	jmp    802b89 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802bc7:	80 fa 2f             	cmp    $0x2f,%dl
+  802bca:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802bcd:	83 c0 01             	add    $0x1,%eax
+  802bd0:	89 c1                	mov    %eax,%ecx
+  802bd2:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802bd6:	84 d2                	test   %dl,%dl
+  802bd8:	75 ed                	jne    802bc7 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802bda:	83 ec 04             	sub    $0x4,%esp
+  802bdd:	68 80 00 00 00       	push   $0x80
+  802be2:	53                   	push   %ebx
+  802be3:	56                   	push   %esi
+  802be4:	e8 4d e1 ff ff       	call   800d36 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802be9:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  802bee:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802bf4:	a1 04 b0 80 00       	mov    0x80b004,%eax
+  802bf9:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802bff:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  802c06:	50 80 00 
+  802c09:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802c0c:	89 f8                	mov    %edi,%eax
+  802c0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c11:	5b                   	pop    %ebx
+  802c12:	5e                   	pop    %esi
+  802c13:	5f                   	pop    %edi
+  802c14:	5d                   	pop    %ebp
+  802c15:	c3                   	ret
+		return -E_BAD_PATH;
+  802c16:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802c1b:	eb ef                	jmp    802c0c <file_slurp+0x11e>
+
+00802c1d <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802c1d:	55                   	push   %ebp
+  802c1e:	89 e5                	mov    %esp,%ebp
+  802c20:	53                   	push   %ebx
+  802c21:	83 ec 10             	sub    $0x10,%esp
+  802c24:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802c27:	53                   	push   %ebx
+  802c28:	e8 58 e0 ff ff       	call   800c85 <strlen>
+  802c2d:	83 c4 10             	add    $0x10,%esp
+  802c30:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802c35:	7f 25                	jg     802c5c <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802c37:	83 ec 08             	sub    $0x8,%esp
+  802c3a:	53                   	push   %ebx
+  802c3b:	68 00 b0 80 00       	push   $0x80b000
+  802c40:	e8 7b e0 ff ff       	call   800cc0 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802c45:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c4a:	b8 07 00 00 00       	mov    $0x7,%eax
+  802c4f:	e8 11 f2 ff ff       	call   801e65 <fsipc>
+  802c54:	83 c4 10             	add    $0x10,%esp
+}
+  802c57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c5a:	c9                   	leave
+  802c5b:	c3                   	ret
+		return -E_BAD_PATH;
+  802c5c:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802c61:	eb f4                	jmp    802c57 <remove+0x3a>
+
+00802c63 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802c63:	55                   	push   %ebp
+  802c64:	89 e5                	mov    %esp,%ebp
+  802c66:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802c69:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c6e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c73:	e8 ed f1 ff ff       	call   801e65 <fsipc>
+}
+  802c78:	c9                   	leave
+  802c79:	c3                   	ret
+
+00802c7a <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802c7a:	55                   	push   %ebp
+  802c7b:	89 e5                	mov    %esp,%ebp
+  802c7d:	57                   	push   %edi
+  802c7e:	56                   	push   %esi
+  802c7f:	53                   	push   %ebx
+  802c80:	83 ec 18             	sub    $0x18,%esp
+  802c83:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802c86:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802c89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802c8c:	57                   	push   %edi
+  802c8d:	e8 f3 df ff ff       	call   800c85 <strlen>
+  802c92:	83 c4 10             	add    $0x10,%esp
+  802c95:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802c9a:	7f 4c                	jg     802ce8 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802c9c:	83 ec 08             	sub    $0x8,%esp
+  802c9f:	57                   	push   %edi
+  802ca0:	68 00 b0 80 00       	push   $0x80b000
+  802ca5:	e8 16 e0 ff ff       	call   800cc0 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802caa:	ba 00 00 00 00       	mov    $0x0,%edx
+  802caf:	b8 10 00 00 00       	mov    $0x10,%eax
+  802cb4:	e8 ac f1 ff ff       	call   801e65 <fsipc>
+  802cb9:	83 c4 10             	add    $0x10,%esp
+  802cbc:	85 c0                	test   %eax,%eax
+  802cbe:	78 20                	js     802ce0 <defrag+0x66>
+		return r;
+	if (before)
+  802cc0:	85 f6                	test   %esi,%esi
+  802cc2:	74 07                	je     802ccb <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802cc4:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  802cc9:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802ccb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802cd0:	85 db                	test   %ebx,%ebx
+  802cd2:	74 0c                	je     802ce0 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802cd4:	a1 04 b0 80 00       	mov    0x80b004,%eax
+  802cd9:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802cdb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ce0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ce3:	5b                   	pop    %ebx
+  802ce4:	5e                   	pop    %esi
+  802ce5:	5f                   	pop    %edi
+  802ce6:	5d                   	pop    %ebp
+  802ce7:	c3                   	ret
+		return -E_BAD_PATH;
+  802ce8:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802ced:	eb f1                	jmp    802ce0 <defrag+0x66>
+
+00802cef <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802cef:	55                   	push   %ebp
+  802cf0:	89 e5                	mov    %esp,%ebp
+  802cf2:	53                   	push   %ebx
+  802cf3:	83 ec 04             	sub    $0x4,%esp
+  802cf6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802cf9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cfe:	b8 11 00 00 00       	mov    $0x11,%eax
+  802d03:	e8 5d f1 ff ff       	call   801e65 <fsipc>
+  802d08:	85 c0                	test   %eax,%eax
+  802d0a:	78 34                	js     802d40 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802d0c:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  802d11:	89 03                	mov    %eax,(%ebx)
+  802d13:	a1 04 b0 80 00       	mov    0x80b004,%eax
+  802d18:	89 43 04             	mov    %eax,0x4(%ebx)
+  802d1b:	a1 08 b0 80 00       	mov    0x80b008,%eax
+  802d20:	89 43 08             	mov    %eax,0x8(%ebx)
+  802d23:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  802d28:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802d2b:	a1 10 b0 80 00       	mov    0x80b010,%eax
+  802d30:	89 43 10             	mov    %eax,0x10(%ebx)
+  802d33:	a1 14 b0 80 00       	mov    0x80b014,%eax
+  802d38:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802d3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d43:	c9                   	leave
+  802d44:	c3                   	ret
+
+00802d45 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802d45:	55                   	push   %ebp
+  802d46:	89 e5                	mov    %esp,%ebp
+  802d48:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d4b:	89 c2                	mov    %eax,%edx
+  802d4d:	c1 ea 16             	shr    $0x16,%edx
+  802d50:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802d57:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d5c:	f6 c1 01             	test   $0x1,%cl
+  802d5f:	74 22                	je     802d83 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802d61:	c1 e8 0c             	shr    $0xc,%eax
+  802d64:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802d6b:	a8 01                	test   $0x1,%al
+  802d6d:	74 14                	je     802d83 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802d6f:	c1 e8 0c             	shr    $0xc,%eax
+  802d72:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802d75:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802d7c:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  802d80:	0f b7 d2             	movzwl %dx,%edx
+}
+  802d83:	89 d0                	mov    %edx,%eax
+  802d85:	5d                   	pop    %ebp
+  802d86:	c3                   	ret
+
+00802d87 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802d87:	55                   	push   %ebp
+  802d88:	89 e5                	mov    %esp,%ebp
+  802d8a:	57                   	push   %edi
+  802d8b:	56                   	push   %esi
+  802d8c:	53                   	push   %ebx
+  802d8d:	81 ec a4 02 00 00    	sub    $0x2a4,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  802d93:	6a 00                	push   $0x0
+  802d95:	ff 75 08             	push   0x8(%ebp)
+  802d98:	e8 ac f6 ff ff       	call   802449 <open>
+  802d9d:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802da3:	83 c4 10             	add    $0x10,%esp
+  802da6:	85 c0                	test   %eax,%eax
+  802da8:	0f 88 39 06 00 00    	js     8033e7 <spawn+0x660>
+  802dae:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802db0:	83 ec 04             	sub    $0x4,%esp
+  802db3:	68 00 02 00 00       	push   $0x200
+  802db8:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802dbe:	50                   	push   %eax
+  802dbf:	51                   	push   %ecx
+  802dc0:	e8 55 ec ff ff       	call   801a1a <readn>
+  802dc5:	83 c4 10             	add    $0x10,%esp
+  802dc8:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802dcd:	75 5a                	jne    802e29 <spawn+0xa2>
+	    || elf->e_magic != ELF_MAGIC) {
+  802dcf:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802dd6:	45 4c 46 
+  802dd9:	75 4e                	jne    802e29 <spawn+0xa2>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  802ddb:	b8 07 00 00 00       	mov    $0x7,%eax
+  802de0:	cd 30                	int    $0x30
+  802de2:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  802de8:	85 c0                	test   %eax,%eax
+  802dea:	0f 88 eb 05 00 00    	js     8033db <spawn+0x654>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  802df0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802df5:	69 f0 8c 00 00 00    	imul   $0x8c,%eax,%esi
+  802dfb:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802e01:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802e07:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802e0c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802e0e:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802e14:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  802e1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802e1f:	be 00 00 00 00       	mov    $0x0,%esi
+  802e24:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802e27:	eb 4b                	jmp    802e74 <spawn+0xed>
+		close(fd);
+  802e29:	83 ec 0c             	sub    $0xc,%esp
+  802e2c:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  802e32:	e8 20 ea ff ff       	call   801857 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802e37:	83 c4 0c             	add    $0xc,%esp
+  802e3a:	68 7f 45 4c 46       	push   $0x464c457f
+  802e3f:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802e45:	68 15 4b 80 00       	push   $0x804b15
+  802e4a:	e8 83 d8 ff ff       	call   8006d2 <cprintf>
+		return -E_NOT_EXEC;
+  802e4f:	83 c4 10             	add    $0x10,%esp
+  802e52:	c7 85 7c fd ff ff f2 	movl   $0xfffffff2,-0x284(%ebp)
+  802e59:	ff ff ff 
+  802e5c:	e9 86 05 00 00       	jmp    8033e7 <spawn+0x660>
+		string_size += strlen(argv[argc]) + 1;
+  802e61:	83 ec 0c             	sub    $0xc,%esp
+  802e64:	50                   	push   %eax
+  802e65:	e8 1b de ff ff       	call   800c85 <strlen>
+  802e6a:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802e6e:	83 c3 01             	add    $0x1,%ebx
+  802e71:	83 c4 10             	add    $0x10,%esp
+  802e74:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802e77:	85 c0                	test   %eax,%eax
+  802e79:	75 e6                	jne    802e61 <spawn+0xda>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802e7b:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802e81:	bf 00 10 40 00       	mov    $0x401000,%edi
+  802e86:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802e88:	89 fa                	mov    %edi,%edx
+  802e8a:	83 e2 fc             	and    $0xfffffffc,%edx
+  802e8d:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802e94:	29 c2                	sub    %eax,%edx
+  802e96:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802e9c:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802e9f:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802ea4:	0f 86 59 05 00 00    	jbe    803403 <spawn+0x67c>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802eaa:	83 ec 04             	sub    $0x4,%esp
+  802ead:	6a 07                	push   $0x7
+  802eaf:	68 00 00 40 00       	push   $0x400000
+  802eb4:	6a 00                	push   $0x0
+  802eb6:	e8 11 e2 ff ff       	call   8010cc <sys_page_alloc>
+  802ebb:	83 c4 10             	add    $0x10,%esp
+  802ebe:	85 c0                	test   %eax,%eax
+  802ec0:	0f 88 42 05 00 00    	js     803408 <spawn+0x681>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  802ec6:	be 00 00 00 00       	mov    $0x0,%esi
+  802ecb:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  802ed1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802ed4:	eb 30                	jmp    802f06 <spawn+0x17f>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  802ed6:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802edc:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+  802ee2:	89 04 b2             	mov    %eax,(%edx,%esi,4)
+		strcpy(string_store, argv[i]);
+  802ee5:	83 ec 08             	sub    $0x8,%esp
+  802ee8:	ff 34 b3             	push   (%ebx,%esi,4)
+  802eeb:	57                   	push   %edi
+  802eec:	e8 cf dd ff ff       	call   800cc0 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  802ef1:	83 c4 04             	add    $0x4,%esp
+  802ef4:	ff 34 b3             	push   (%ebx,%esi,4)
+  802ef7:	e8 89 dd ff ff       	call   800c85 <strlen>
+  802efc:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  802f00:	83 c6 01             	add    $0x1,%esi
+  802f03:	83 c4 10             	add    $0x10,%esp
+  802f06:	39 b5 90 fd ff ff    	cmp    %esi,-0x270(%ebp)
+  802f0c:	7f c8                	jg     802ed6 <spawn+0x14f>
+	}
+	argv_store[argc] = 0;
+  802f0e:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802f14:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802f1a:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802f21:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802f27:	0f 85 83 00 00 00    	jne    802fb0 <spawn+0x229>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802f2d:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+  802f33:	8d 82 00 d0 7f ee    	lea    -0x11803000(%edx),%eax
+  802f39:	89 42 fc             	mov    %eax,-0x4(%edx)
+	argv_store[-2] = argc;
+  802f3c:	89 d0                	mov    %edx,%eax
+  802f3e:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802f44:	89 4a f8             	mov    %ecx,-0x8(%edx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802f47:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  802f4c:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802f52:	83 ec 0c             	sub    $0xc,%esp
+  802f55:	6a 07                	push   $0x7
+  802f57:	68 00 d0 bf ee       	push   $0xeebfd000
+  802f5c:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802f62:	68 00 00 40 00       	push   $0x400000
+  802f67:	6a 00                	push   $0x0
+  802f69:	e8 a9 e1 ff ff       	call   801117 <sys_page_map>
+  802f6e:	89 c3                	mov    %eax,%ebx
+  802f70:	83 c4 20             	add    $0x20,%esp
+  802f73:	85 c0                	test   %eax,%eax
+  802f75:	0f 88 95 04 00 00    	js     803410 <spawn+0x689>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802f7b:	83 ec 08             	sub    $0x8,%esp
+  802f7e:	68 00 00 40 00       	push   $0x400000
+  802f83:	6a 00                	push   $0x0
+  802f85:	e8 cf e1 ff ff       	call   801159 <sys_page_unmap>
+  802f8a:	89 c3                	mov    %eax,%ebx
+  802f8c:	83 c4 10             	add    $0x10,%esp
+  802f8f:	85 c0                	test   %eax,%eax
+  802f91:	0f 88 79 04 00 00    	js     803410 <spawn+0x689>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802f97:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802f9d:	8d b4 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802fa4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fa9:	89 df                	mov    %ebx,%edi
+  802fab:	e9 7f 02 00 00       	jmp    80322f <spawn+0x4a8>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802fb0:	68 a0 4b 80 00       	push   $0x804ba0
+  802fb5:	68 07 4a 80 00       	push   $0x804a07
+  802fba:	68 f0 00 00 00       	push   $0xf0
+  802fbf:	68 2f 4b 80 00       	push   $0x804b2f
+  802fc4:	e8 2e d6 ff ff       	call   8005f7 <_panic>
+
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+		if (i >= filesz) {
+			// allocate a blank page
+			n = 1;
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  802fc9:	83 ec 04             	sub    $0x4,%esp
+  802fcc:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802fd2:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802fd8:	01 f8                	add    %edi,%eax
+  802fda:	50                   	push   %eax
+  802fdb:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802fe1:	e8 e6 e0 ff ff       	call   8010cc <sys_page_alloc>
+  802fe6:	83 c4 10             	add    $0x10,%esp
+  802fe9:	85 c0                	test   %eax,%eax
+  802feb:	0f 88 04 04 00 00    	js     8033f5 <spawn+0x66e>
+			n = 1;
+  802ff1:	be 01 00 00 00       	mov    $0x1,%esi
+  802ff6:	e9 99 01 00 00       	jmp    803194 <spawn+0x40d>
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+			// read-only and all from file: map the file server's
+			// cached pages, so that every instance of the program
+			// shares one copy of its text
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  802ffb:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  803001:	8b 8d 80 fd ff ff    	mov    -0x280(%ebp),%ecx
+  803007:	39 c8                	cmp    %ecx,%eax
+  803009:	72 70                	jb     80307b <spawn+0x2f4>
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+  80300b:	05 ff 0f 00 00       	add    $0xfff,%eax
+  803010:	29 f8                	sub    %edi,%eax
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  803012:	c1 e8 0c             	shr    $0xc,%eax
+			n = MIN(n, FSBULK_MAXPAGES);
+  803015:	ba 40 00 00 00       	mov    $0x40,%edx
+  80301a:	39 d0                	cmp    %edx,%eax
+  80301c:	0f 4e d0             	cmovle %eax,%edx
+  80301f:	89 d6                	mov    %edx,%esi
+			if ((r = mmap(UTEMP, n * PGSIZE, PROT_READ, MAP_SHARED,
+  803021:	83 ec 08             	sub    $0x8,%esp
+  803024:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  80302a:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  803030:	01 d0                	add    %edx,%eax
+  803032:	50                   	push   %eax
+  803033:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  803039:	6a 01                	push   $0x1
+  80303b:	6a 01                	push   $0x1
+  80303d:	89 f0                	mov    %esi,%eax
+  80303f:	c1 e0 0c             	shl    $0xc,%eax
+  803042:	50                   	push   %eax
+  803043:	68 00 00 40 00       	push   $0x400000
+  803048:	e8 da f5 ff ff       	call   802627 <mmap>
+  80304d:	83 c4 20             	add    $0x20,%esp
+  803050:	85 c0                	test   %eax,%eax
+  803052:	78 34                	js     803088 <spawn+0x301>
+			if ((r = seek(fd, fileoffset + i)) < 0)
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
+				return r;
+		}
+		for (j = 0; j < n; j++) {
+  803054:	8d 86 00 04 00 00    	lea    0x400(%esi),%eax
+  80305a:	c1 e0 0c             	shl    $0xc,%eax
+  80305d:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  803063:	bb 00 00 40 00       	mov    $0x400000,%ebx
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  803068:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  80306e:	01 c7                	add    %eax,%edi
+  803070:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+		for (j = 0; j < n; j++) {
+  803076:	e9 ca 00 00 00       	jmp    803145 <spawn+0x3be>
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  80307b:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  803081:	29 f8                	sub    %edi,%eax
+  803083:	c1 e8 0c             	shr    $0xc,%eax
+  803086:	eb 8d                	jmp    803015 <spawn+0x28e>
+  803088:	89 c7                	mov    %eax,%edi
+  80308a:	eb 27                	jmp    8030b3 <spawn+0x32c>
+			for (j = 0; j < n; j++)
+  80308c:	83 c3 01             	add    $0x1,%ebx
+  80308f:	39 de                	cmp    %ebx,%esi
+  803091:	7e 4a                	jle    8030dd <spawn+0x356>
+				if ((r = sys_page_alloc(0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  803093:	83 ec 04             	sub    $0x4,%esp
+  803096:	6a 07                	push   $0x7
+  803098:	89 d8                	mov    %ebx,%eax
+  80309a:	c1 e0 0c             	shl    $0xc,%eax
+  80309d:	05 00 00 40 00       	add    $0x400000,%eax
+  8030a2:	50                   	push   %eax
+  8030a3:	6a 00                	push   $0x0
+  8030a5:	e8 22 e0 ff ff       	call   8010cc <sys_page_alloc>
+  8030aa:	83 c4 10             	add    $0x10,%esp
+  8030ad:	85 c0                	test   %eax,%eax
+  8030af:	79 db                	jns    80308c <spawn+0x305>
+  8030b1:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  8030b3:	83 ec 0c             	sub    $0xc,%esp
+  8030b6:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  8030bc:	e8 7c df ff ff       	call   80103d <sys_env_destroy>
+	close(fd);
+  8030c1:	83 c4 04             	add    $0x4,%esp
+  8030c4:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  8030ca:	e8 88 e7 ff ff       	call   801857 <close>
+	return r;
+  8030cf:	83 c4 10             	add    $0x10,%esp
+  8030d2:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+  8030d8:	e9 0a 03 00 00       	jmp    8033e7 <spawn+0x660>
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  8030dd:	83 ec 08             	sub    $0x8,%esp
+  8030e0:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  8030e6:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  8030ec:	01 d0                	add    %edx,%eax
+  8030ee:	50                   	push   %eax
+  8030ef:	8b 9d 7c fd ff ff    	mov    -0x284(%ebp),%ebx
+  8030f5:	53                   	push   %ebx
+  8030f6:	e8 e8 e9 ff ff       	call   801ae3 <seek>
+  8030fb:	83 c4 10             	add    $0x10,%esp
+  8030fe:	85 c0                	test   %eax,%eax
+  803100:	0f 88 f6 02 00 00    	js     8033fc <spawn+0x675>
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
+  803106:	83 ec 04             	sub    $0x4,%esp
+  803109:	89 f0                	mov    %esi,%eax
+  80310b:	c1 e0 0c             	shl    $0xc,%eax
+  80310e:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  803114:	39 c8                	cmp    %ecx,%eax
+  803116:	0f 47 c1             	cmova  %ecx,%eax
+  803119:	50                   	push   %eax
+  80311a:	68 00 00 40 00       	push   $0x400000
+  80311f:	53                   	push   %ebx
+  803120:	e8 f5 e8 ff ff       	call   801a1a <readn>
+  803125:	83 c4 10             	add    $0x10,%esp
+  803128:	85 c0                	test   %eax,%eax
+  80312a:	0f 89 24 ff ff ff    	jns    803054 <spawn+0x2cd>
+  803130:	89 c7                	mov    %eax,%edi
+  803132:	e9 7c ff ff ff       	jmp    8030b3 <spawn+0x32c>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP + j * PGSIZE);
+  803137:	83 ec 08             	sub    $0x8,%esp
+  80313a:	56                   	push   %esi
+  80313b:	6a 00                	push   $0x0
+  80313d:	e8 17 e0 ff ff       	call   801159 <sys_page_unmap>
+  803142:	83 c4 10             	add    $0x10,%esp
+		for (j = 0; j < n; j++) {
+  803145:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  80314b:	39 c3                	cmp    %eax,%ebx
+  80314d:	74 3f                	je     80318e <spawn+0x407>
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  80314f:	89 de                	mov    %ebx,%esi
+  803151:	83 ec 0c             	sub    $0xc,%esp
+  803154:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  80315a:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  80315d:	50                   	push   %eax
+  80315e:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  803164:	53                   	push   %ebx
+  803165:	6a 00                	push   $0x0
+  803167:	e8 ab df ff ff       	call   801117 <sys_page_map>
+  80316c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803172:	83 c4 20             	add    $0x20,%esp
+  803175:	85 c0                	test   %eax,%eax
+  803177:	79 be                	jns    803137 <spawn+0x3b0>
+				panic("spawn: sys_page_map data: %e", r);
+  803179:	50                   	push   %eax
+  80317a:	68 3b 4b 80 00       	push   $0x804b3b
+  80317f:	68 36 01 00 00       	push   $0x136
+  803184:	68 2f 4b 80 00       	push   $0x804b2f
+  803189:	e8 69 d4 ff ff       	call   8005f7 <_panic>
+  80318e:	8b b5 74 fd ff ff    	mov    -0x28c(%ebp),%esi
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  803194:	c1 e6 0c             	shl    $0xc,%esi
+  803197:	01 b5 88 fd ff ff    	add    %esi,-0x278(%ebp)
+  80319d:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  8031a3:	89 c7                	mov    %eax,%edi
+  8031a5:	8b 8d 80 fd ff ff    	mov    -0x280(%ebp),%ecx
+  8031ab:	39 c8                	cmp    %ecx,%eax
+  8031ad:	73 6e                	jae    80321d <spawn+0x496>
+		if (i >= filesz) {
+  8031af:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8031b5:	39 8d 88 fd ff ff    	cmp    %ecx,-0x278(%ebp)
+  8031bb:	0f 83 08 fe ff ff    	jae    802fc9 <spawn+0x242>
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+  8031c1:	f6 85 94 fd ff ff 02 	testb  $0x2,-0x26c(%ebp)
+  8031c8:	75 27                	jne    8031f1 <spawn+0x46a>
+  8031ca:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  8031d0:	05 00 10 00 00       	add    $0x1000,%eax
+  8031d5:	8b 95 84 fd ff ff    	mov    -0x27c(%ebp),%edx
+  8031db:	39 c2                	cmp    %eax,%edx
+  8031dd:	0f 83 18 fe ff ff    	jae    802ffb <spawn+0x274>
+  8031e3:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  8031e9:	39 c2                	cmp    %eax,%edx
+  8031eb:	0f 83 0a fe ff ff    	jae    802ffb <spawn+0x274>
+			n = MIN(FSBULK_MAXPAGES, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  8031f1:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  8031f7:	29 f8                	sub    %edi,%eax
+  8031f9:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  8031ff:	05 ff 0f 00 00       	add    $0xfff,%eax
+  803204:	c1 e8 0c             	shr    $0xc,%eax
+  803207:	89 c6                	mov    %eax,%esi
+  803209:	b8 40 00 00 00       	mov    $0x40,%eax
+  80320e:	39 c6                	cmp    %eax,%esi
+  803210:	0f 47 f0             	cmova  %eax,%esi
+			for (j = 0; j < n; j++)
+  803213:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803218:	e9 72 fe ff ff       	jmp    80308f <spawn+0x308>
+  80321d:	8b bd 68 fd ff ff    	mov    -0x298(%ebp),%edi
+  803223:	8b b5 64 fd ff ff    	mov    -0x29c(%ebp),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  803229:	83 c7 01             	add    $0x1,%edi
+  80322c:	83 c6 20             	add    $0x20,%esi
+  80322f:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  803236:	39 f8                	cmp    %edi,%eax
+  803238:	0f 8e 88 00 00 00    	jle    8032c6 <spawn+0x53f>
+		if (ph->p_type != ELF_PROG_LOAD)
+  80323e:	83 3e 01             	cmpl   $0x1,(%esi)
+  803241:	75 e6                	jne    803229 <spawn+0x4a2>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  803243:	8b 46 18             	mov    0x18(%esi),%eax
+  803246:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  803249:	83 f8 01             	cmp    $0x1,%eax
+  80324c:	19 c0                	sbb    %eax,%eax
+  80324e:	83 e0 fe             	and    $0xfffffffe,%eax
+  803251:	83 c0 07             	add    $0x7,%eax
+  803254:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  80325a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80325d:	89 8d 78 fd ff ff    	mov    %ecx,-0x288(%ebp)
+  803263:	8b 5e 10             	mov    0x10(%esi),%ebx
+  803266:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  80326c:	8b 46 14             	mov    0x14(%esi),%eax
+  80326f:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  803275:	8b 56 08             	mov    0x8(%esi),%edx
+	if ((i = PGOFF(va))) {
+  803278:	89 d0                	mov    %edx,%eax
+  80327a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80327f:	74 18                	je     803299 <spawn+0x512>
+		va -= i;
+  803281:	29 c2                	sub    %eax,%edx
+		memsz += i;
+  803283:	01 85 80 fd ff ff    	add    %eax,-0x280(%ebp)
+		filesz += i;
+  803289:	01 c3                	add    %eax,%ebx
+  80328b:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+		fileoffset -= i;
+  803291:	29 c1                	sub    %eax,%ecx
+  803293:	89 8d 78 fd ff ff    	mov    %ecx,-0x288(%ebp)
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  803299:	c7 85 88 fd ff ff 00 	movl   $0x0,-0x278(%ebp)
+  8032a0:	00 00 00 
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  8032a3:	8d 82 00 00 c0 ff    	lea    -0x400000(%edx),%eax
+  8032a9:	89 85 70 fd ff ff    	mov    %eax,-0x290(%ebp)
+  8032af:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+  8032b5:	89 bd 68 fd ff ff    	mov    %edi,-0x298(%ebp)
+  8032bb:	89 b5 64 fd ff ff    	mov    %esi,-0x29c(%ebp)
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  8032c1:	e9 d7 fe ff ff       	jmp    80319d <spawn+0x416>
+	close(fd);
+  8032c6:	83 ec 0c             	sub    $0xc,%esp
+  8032c9:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  8032cf:	e8 83 e5 ff ff       	call   801857 <close>
+  8032d4:	83 c4 10             	add    $0x10,%esp
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+	// LAB 5: Your code here.
+	int r = 0;
+  8032d7:	ba 00 00 00 00       	mov    $0x0,%edx
+
+	for (uintptr_t va = 0; va < UTOP; va += PGSIZE) {
+  8032dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032e1:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  8032e7:	eb 14                	jmp    8032fd <spawn+0x576>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+			va += PTSIZE - PGSIZE;
+  8032e9:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t va = 0; va < UTOP; va += PGSIZE) {
+  8032ef:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8032f5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8032fb:	77 65                	ja     803362 <spawn+0x5db>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8032fd:	89 d8                	mov    %ebx,%eax
+  8032ff:	c1 e8 16             	shr    $0x16,%eax
+  803302:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803309:	a8 01                	test   $0x1,%al
+  80330b:	74 dc                	je     8032e9 <spawn+0x562>
+			continue;
+		}
+		if (!(uvpt[PGNUM(va)] & PTE_P) || !(uvpt[PGNUM(va)] & PTE_SHARE))
+  80330d:	89 d8                	mov    %ebx,%eax
+  80330f:	c1 e8 0c             	shr    $0xc,%eax
+  803312:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803319:	f6 c1 01             	test   $0x1,%cl
+  80331c:	74 d1                	je     8032ef <spawn+0x568>
+  80331e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803325:	f6 c5 04             	test   $0x4,%ch
+  803328:	74 c5                	je     8032ef <spawn+0x568>
+			continue;
+		r = sys_page_map(0, (void *) va, child, (void *) va,
+				 uvpt[PGNUM(va)] & PTE_SYSCALL);
+  80332a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+		r = sys_page_map(0, (void *) va, child, (void *) va,
+  803331:	83 ec 0c             	sub    $0xc,%esp
+  803334:	25 07 0e 00 00       	and    $0xe07,%eax
+  803339:	50                   	push   %eax
+  80333a:	53                   	push   %ebx
+  80333b:	56                   	push   %esi
+  80333c:	53                   	push   %ebx
+  80333d:	6a 00                	push   $0x0
+  80333f:	e8 d3 dd ff ff       	call   801117 <sys_page_map>
+  803344:	89 c2                	mov    %eax,%edx
+		if (r < 0)
+  803346:	83 c4 20             	add    $0x20,%esp
+  803349:	85 c0                	test   %eax,%eax
+  80334b:	79 a2                	jns    8032ef <spawn+0x568>
+		panic("copy_shared_pages: %e", r);
+  80334d:	52                   	push   %edx
+  80334e:	68 58 4b 80 00       	push   $0x804b58
+  803353:	68 80 00 00 00       	push   $0x80
+  803358:	68 2f 4b 80 00       	push   $0x804b2f
+  80335d:	e8 95 d2 ff ff       	call   8005f7 <_panic>
+	if ((r = copy_shared_pages(child)) < 0)
+  803362:	85 d2                	test   %edx,%edx
+  803364:	78 e7                	js     80334d <spawn+0x5c6>
+	child_tf.tf_eflags |= FL_IOPL_3;   // devious: see user/faultio.c
+  803366:	81 8d dc fd ff ff 00 	orl    $0x3000,-0x224(%ebp)
+  80336d:	30 00 00 
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  803370:	83 ec 08             	sub    $0x8,%esp
+  803373:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  803379:	50                   	push   %eax
+  80337a:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  803380:	e8 68 de ff ff       	call   8011ed <sys_env_set_trapframe>
+  803385:	83 c4 10             	add    $0x10,%esp
+  803388:	85 c0                	test   %eax,%eax
+  80338a:	78 25                	js     8033b1 <spawn+0x62a>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  80338c:	83 ec 08             	sub    $0x8,%esp
+  80338f:	6a 02                	push   $0x2
+  803391:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  803397:	e8 07 de ff ff       	call   8011a3 <sys_env_set_status>
+  80339c:	83 c4 10             	add    $0x10,%esp
+  80339f:	85 c0                	test   %eax,%eax
+  8033a1:	78 23                	js     8033c6 <spawn+0x63f>
+	return child;
+  8033a3:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  8033a9:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  8033af:	eb 36                	jmp    8033e7 <spawn+0x660>
+		panic("sys_env_set_trapframe: %e", r);
+  8033b1:	50                   	push   %eax
+  8033b2:	68 6e 4b 80 00       	push   $0x804b6e
+  8033b7:	68 84 00 00 00       	push   $0x84
+  8033bc:	68 2f 4b 80 00       	push   $0x804b2f
+  8033c1:	e8 31 d2 ff ff       	call   8005f7 <_panic>
+		panic("sys_env_set_status: %e", r);
+  8033c6:	50                   	push   %eax
+  8033c7:	68 88 4b 80 00       	push   $0x804b88
+  8033cc:	68 87 00 00 00       	push   $0x87
+  8033d1:	68 2f 4b 80 00       	push   $0x804b2f
+  8033d6:	e8 1c d2 ff ff       	call   8005f7 <_panic>
+		return r;
+  8033db:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  8033e1:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+}
+  8033e7:	8b 85 7c fd ff ff    	mov    -0x284(%ebp),%eax
+  8033ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033f0:	5b                   	pop    %ebx
+  8033f1:	5e                   	pop    %esi
+  8033f2:	5f                   	pop    %edi
+  8033f3:	5d                   	pop    %ebp
+  8033f4:	c3                   	ret
+  8033f5:	89 c7                	mov    %eax,%edi
+  8033f7:	e9 b7 fc ff ff       	jmp    8030b3 <spawn+0x32c>
+  8033fc:	89 c7                	mov    %eax,%edi
+  8033fe:	e9 b0 fc ff ff       	jmp    8030b3 <spawn+0x32c>
+		return -E_NO_MEM;
+  803403:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  803408:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  80340e:	eb d7                	jmp    8033e7 <spawn+0x660>
+	sys_page_unmap(0, UTEMP);
+  803410:	83 ec 08             	sub    $0x8,%esp
+  803413:	68 00 00 40 00       	push   $0x400000
+  803418:	6a 00                	push   $0x0
+  80341a:	e8 3a dd ff ff       	call   801159 <sys_page_unmap>
+  80341f:	83 c4 10             	add    $0x10,%esp
+  803422:	89 9d 7c fd ff ff    	mov    %ebx,-0x284(%ebp)
+  803428:	eb bd                	jmp    8033e7 <spawn+0x660>
+
+0080342a <spawnl>:
+{
+  80342a:	55                   	push   %ebp
+  80342b:	89 e5                	mov    %esp,%ebp
+  80342d:	56                   	push   %esi
+  80342e:	53                   	push   %ebx
+	va_start(vl, arg0);
+  80342f:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  803432:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  803437:	eb 05                	jmp    80343e <spawnl+0x14>
+		argc++;
+  803439:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  80343c:	89 ca                	mov    %ecx,%edx
+  80343e:	8d 4a 04             	lea    0x4(%edx),%ecx
+  803441:	83 3a 00             	cmpl   $0x0,(%edx)
+  803444:	75 f3                	jne    803439 <spawnl+0xf>
+	const char *argv[argc+2];
+  803446:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  80344d:	83 e2 f0             	and    $0xfffffff0,%edx
+  803450:	29 d4                	sub    %edx,%esp
+  803452:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  803456:	89 da                	mov    %ebx,%edx
+  803458:	c1 ea 02             	shr    $0x2,%edx
+  80345b:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  80345e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803461:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  803468:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  80346f:	00 
+	va_start(vl, arg0);
+  803470:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  803473:	89 c2                	mov    %eax,%edx
+  803475:	b8 00 00 00 00       	mov    $0x0,%eax
+  80347a:	eb 0b                	jmp    803487 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  80347c:	83 c0 01             	add    $0x1,%eax
+  80347f:	8b 31                	mov    (%ecx),%esi
+  803481:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  803484:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  803487:	39 d0                	cmp    %edx,%eax
+  803489:	75 f1                	jne    80347c <spawnl+0x52>
+	return spawn(prog, argv);
+  80348b:	83 ec 08             	sub    $0x8,%esp
+  80348e:	53                   	push   %ebx
+  80348f:	ff 75 08             	push   0x8(%ebp)
+  803492:	e8 f0 f8 ff ff       	call   802d87 <spawn>
+}
+  803497:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80349a:	5b                   	pop    %ebx
+  80349b:	5e                   	pop    %esi
+  80349c:	5d                   	pop    %ebp
+  80349d:	c3                   	ret
+
+0080349e <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80349e:	55                   	push   %ebp
+  80349f:	89 e5                	mov    %esp,%ebp
+  8034a1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8034a4:	68 c6 4b 80 00       	push   $0x804bc6
+  8034a9:	ff 75 0c             	push   0xc(%ebp)
+  8034ac:	e8 0f d8 ff ff       	call   800cc0 <strcpy>
+	return 0;
+}
+  8034b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b6:	c9                   	leave
+  8034b7:	c3                   	ret
+
+008034b8 <devsock_close>:
+{
+  8034b8:	55                   	push   %ebp
+  8034b9:	89 e5                	mov    %esp,%ebp
+  8034bb:	53                   	push   %ebx
+  8034bc:	83 ec 10             	sub    $0x10,%esp
+  8034bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8034c2:	53                   	push   %ebx
+  8034c3:	e8 7d f8 ff ff       	call   802d45 <pageref>
+  8034c8:	89 c2                	mov    %eax,%edx
+  8034ca:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8034cd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8034d2:	83 fa 01             	cmp    $0x1,%edx
+  8034d5:	74 05                	je     8034dc <devsock_close+0x24>
+}
+  8034d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034da:	c9                   	leave
+  8034db:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8034dc:	83 ec 0c             	sub    $0xc,%esp
+  8034df:	ff 73 0c             	push   0xc(%ebx)
+  8034e2:	e8 b7 02 00 00       	call   80379e <nsipc_close>
+  8034e7:	83 c4 10             	add    $0x10,%esp
+  8034ea:	eb eb                	jmp    8034d7 <devsock_close+0x1f>
+
+008034ec <devsock_write>:
+{
+  8034ec:	55                   	push   %ebp
+  8034ed:	89 e5                	mov    %esp,%ebp
+  8034ef:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8034f2:	6a 00                	push   $0x0
+  8034f4:	ff 75 10             	push   0x10(%ebp)
+  8034f7:	ff 75 0c             	push   0xc(%ebp)
+  8034fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034fd:	ff 70 0c             	push   0xc(%eax)
+  803500:	e8 79 03 00 00       	call   80387e <nsipc_send>
+}
+  803505:	c9                   	leave
+  803506:	c3                   	ret
+
+00803507 <devsock_read>:
+{
+  803507:	55                   	push   %ebp
+  803508:	89 e5                	mov    %esp,%ebp
+  80350a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80350d:	6a 00                	push   $0x0
+  80350f:	ff 75 10             	push   0x10(%ebp)
+  803512:	ff 75 0c             	push   0xc(%ebp)
+  803515:	8b 45 08             	mov    0x8(%ebp),%eax
+  803518:	ff 70 0c             	push   0xc(%eax)
+  80351b:	e8 ef 02 00 00       	call   80380f <nsipc_recv>
+}
+  803520:	c9                   	leave
+  803521:	c3                   	ret
+
+00803522 <fd2sockid>:
+{
+  803522:	55                   	push   %ebp
+  803523:	89 e5                	mov    %esp,%ebp
+  803525:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803528:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80352b:	52                   	push   %edx
+  80352c:	50                   	push   %eax
+  80352d:	e8 fb e1 ff ff       	call   80172d <fd_lookup>
+  803532:	83 c4 10             	add    $0x10,%esp
+  803535:	85 c0                	test   %eax,%eax
+  803537:	78 10                	js     803549 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803539:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80353c:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  803542:	39 08                	cmp    %ecx,(%eax)
+  803544:	75 05                	jne    80354b <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803546:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803549:	c9                   	leave
+  80354a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80354b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803550:	eb f7                	jmp    803549 <fd2sockid+0x27>
+
+00803552 <alloc_sockfd>:
+{
+  803552:	55                   	push   %ebp
+  803553:	89 e5                	mov    %esp,%ebp
+  803555:	56                   	push   %esi
+  803556:	53                   	push   %ebx
+  803557:	83 ec 1c             	sub    $0x1c,%esp
+  80355a:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80355c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80355f:	50                   	push   %eax
+  803560:	e8 72 e1 ff ff       	call   8016d7 <fd_alloc>
+  803565:	89 c3                	mov    %eax,%ebx
+  803567:	83 c4 10             	add    $0x10,%esp
+  80356a:	85 c0                	test   %eax,%eax
+  80356c:	78 43                	js     8035b1 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80356e:	83 ec 04             	sub    $0x4,%esp
+  803571:	68 07 04 00 00       	push   $0x407
+  803576:	ff 75 f4             	push   -0xc(%ebp)
+  803579:	6a 00                	push   $0x0
+  80357b:	e8 4c db ff ff       	call   8010cc <sys_page_alloc>
+  803580:	89 c3                	mov    %eax,%ebx
+  803582:	83 c4 10             	add    $0x10,%esp
+  803585:	85 c0                	test   %eax,%eax
+  803587:	78 28                	js     8035b1 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803589:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80358c:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  803592:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803594:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803597:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80359e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8035a1:	83 ec 0c             	sub    $0xc,%esp
+  8035a4:	50                   	push   %eax
+  8035a5:	e8 06 e1 ff ff       	call   8016b0 <fd2num>
+  8035aa:	89 c3                	mov    %eax,%ebx
+  8035ac:	83 c4 10             	add    $0x10,%esp
+  8035af:	eb 0c                	jmp    8035bd <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8035b1:	83 ec 0c             	sub    $0xc,%esp
+  8035b4:	56                   	push   %esi
+  8035b5:	e8 e4 01 00 00       	call   80379e <nsipc_close>
+		return r;
+  8035ba:	83 c4 10             	add    $0x10,%esp
+}
+  8035bd:	89 d8                	mov    %ebx,%eax
+  8035bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035c2:	5b                   	pop    %ebx
+  8035c3:	5e                   	pop    %esi
+  8035c4:	5d                   	pop    %ebp
+  8035c5:	c3                   	ret
+
+008035c6 <accept>:
+{
+  8035c6:	55                   	push   %ebp
+  8035c7:	89 e5                	mov    %esp,%ebp
+  8035c9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8035cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035cf:	e8 4e ff ff ff       	call   803522 <fd2sockid>
+  8035d4:	85 c0                	test   %eax,%eax
+  8035d6:	78 1b                	js     8035f3 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8035d8:	83 ec 04             	sub    $0x4,%esp
+  8035db:	ff 75 10             	push   0x10(%ebp)
+  8035de:	ff 75 0c             	push   0xc(%ebp)
+  8035e1:	50                   	push   %eax
+  8035e2:	e8 0e 01 00 00       	call   8036f5 <nsipc_accept>
+  8035e7:	83 c4 10             	add    $0x10,%esp
+  8035ea:	85 c0                	test   %eax,%eax
+  8035ec:	78 05                	js     8035f3 <accept+0x2d>
+	return alloc_sockfd(r);
+  8035ee:	e8 5f ff ff ff       	call   803552 <alloc_sockfd>
+}
+  8035f3:	c9                   	leave
+  8035f4:	c3                   	ret
+
+008035f5 <bind>:
+{
+  8035f5:	55                   	push   %ebp
+  8035f6:	89 e5                	mov    %esp,%ebp
+  8035f8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8035fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035fe:	e8 1f ff ff ff       	call   803522 <fd2sockid>
+  803603:	85 c0                	test   %eax,%eax
+  803605:	78 12                	js     803619 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  803607:	83 ec 04             	sub    $0x4,%esp
+  80360a:	ff 75 10             	push   0x10(%ebp)
+  80360d:	ff 75 0c             	push   0xc(%ebp)
+  803610:	50                   	push   %eax
+  803611:	e8 31 01 00 00       	call   803747 <nsipc_bind>
+  803616:	83 c4 10             	add    $0x10,%esp
+}
+  803619:	c9                   	leave
+  80361a:	c3                   	ret
+
+0080361b <shutdown>:
+{
+  80361b:	55                   	push   %ebp
+  80361c:	89 e5                	mov    %esp,%ebp
+  80361e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803621:	8b 45 08             	mov    0x8(%ebp),%eax
+  803624:	e8 f9 fe ff ff       	call   803522 <fd2sockid>
+  803629:	85 c0                	test   %eax,%eax
+  80362b:	78 0f                	js     80363c <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80362d:	83 ec 08             	sub    $0x8,%esp
+  803630:	ff 75 0c             	push   0xc(%ebp)
+  803633:	50                   	push   %eax
+  803634:	e8 43 01 00 00       	call   80377c <nsipc_shutdown>
+  803639:	83 c4 10             	add    $0x10,%esp
+}
+  80363c:	c9                   	leave
+  80363d:	c3                   	ret
+
+0080363e <connect>:
+{
+  80363e:	55                   	push   %ebp
+  80363f:	89 e5                	mov    %esp,%ebp
+  803641:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803644:	8b 45 08             	mov    0x8(%ebp),%eax
+  803647:	e8 d6 fe ff ff       	call   803522 <fd2sockid>
+  80364c:	85 c0                	test   %eax,%eax
+  80364e:	78 12                	js     803662 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803650:	83 ec 04             	sub    $0x4,%esp
+  803653:	ff 75 10             	push   0x10(%ebp)
+  803656:	ff 75 0c             	push   0xc(%ebp)
+  803659:	50                   	push   %eax
+  80365a:	e8 59 01 00 00       	call   8037b8 <nsipc_connect>
+  80365f:	83 c4 10             	add    $0x10,%esp
+}
+  803662:	c9                   	leave
+  803663:	c3                   	ret
+
+00803664 <listen>:
+{
+  803664:	55                   	push   %ebp
+  803665:	89 e5                	mov    %esp,%ebp
+  803667:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80366a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80366d:	e8 b0 fe ff ff       	call   803522 <fd2sockid>
+  803672:	85 c0                	test   %eax,%eax
+  803674:	78 0f                	js     803685 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803676:	83 ec 08             	sub    $0x8,%esp
+  803679:	ff 75 0c             	push   0xc(%ebp)
+  80367c:	50                   	push   %eax
+  80367d:	e8 6b 01 00 00       	call   8037ed <nsipc_listen>
+  803682:	83 c4 10             	add    $0x10,%esp
+}
+  803685:	c9                   	leave
+  803686:	c3                   	ret
+
+00803687 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803687:	55                   	push   %ebp
+  803688:	89 e5                	mov    %esp,%ebp
+  80368a:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80368d:	ff 75 10             	push   0x10(%ebp)
+  803690:	ff 75 0c             	push   0xc(%ebp)
+  803693:	ff 75 08             	push   0x8(%ebp)
+  803696:	e8 41 02 00 00       	call   8038dc <nsipc_socket>
+  80369b:	83 c4 10             	add    $0x10,%esp
+  80369e:	85 c0                	test   %eax,%eax
+  8036a0:	78 05                	js     8036a7 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8036a2:	e8 ab fe ff ff       	call   803552 <alloc_sockfd>
+}
+  8036a7:	c9                   	leave
+  8036a8:	c3                   	ret
+
+008036a9 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8036a9:	55                   	push   %ebp
+  8036aa:	89 e5                	mov    %esp,%ebp
+  8036ac:	53                   	push   %ebx
+  8036ad:	83 ec 04             	sub    $0x4,%esp
+  8036b0:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8036b2:	83 3d 00 e0 80 00 00 	cmpl   $0x0,0x80e000
+  8036b9:	74 26                	je     8036e1 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8036bb:	6a 07                	push   $0x7
+  8036bd:	68 00 d0 80 00       	push   $0x80d000
+  8036c2:	53                   	push   %ebx
+  8036c3:	ff 35 00 e0 80 00    	push   0x80e000
+  8036c9:	e8 6a de ff ff       	call   801538 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8036ce:	83 c4 0c             	add    $0xc,%esp
+  8036d1:	6a 00                	push   $0x0
+  8036d3:	6a 00                	push   $0x0
+  8036d5:	6a 00                	push   $0x0
+  8036d7:	e8 f1 dd ff ff       	call   8014cd <ipc_recv>
+}
+  8036dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036df:	c9                   	leave
+  8036e0:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8036e1:	83 ec 0c             	sub    $0xc,%esp
+  8036e4:	6a 02                	push   $0x2
+  8036e6:	e8 86 df ff ff       	call   801671 <ipc_find_env>
+  8036eb:	a3 00 e0 80 00       	mov    %eax,0x80e000
+  8036f0:	83 c4 10             	add    $0x10,%esp
+  8036f3:	eb c6                	jmp    8036bb <nsipc+0x12>
+
+008036f5 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8036f5:	55                   	push   %ebp
+  8036f6:	89 e5                	mov    %esp,%ebp
+  8036f8:	56                   	push   %esi
+  8036f9:	53                   	push   %ebx
+  8036fa:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8036fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803700:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  803705:	8b 06                	mov    (%esi),%eax
+  803707:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80370c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803711:	e8 93 ff ff ff       	call   8036a9 <nsipc>
+  803716:	89 c3                	mov    %eax,%ebx
+  803718:	85 c0                	test   %eax,%eax
+  80371a:	79 09                	jns    803725 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80371c:	89 d8                	mov    %ebx,%eax
+  80371e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803721:	5b                   	pop    %ebx
+  803722:	5e                   	pop    %esi
+  803723:	5d                   	pop    %ebp
+  803724:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803725:	83 ec 04             	sub    $0x4,%esp
+  803728:	ff 35 10 d0 80 00    	push   0x80d010
+  80372e:	68 00 d0 80 00       	push   $0x80d000
+  803733:	ff 75 0c             	push   0xc(%ebp)
+  803736:	e8 0b d7 ff ff       	call   800e46 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80373b:	a1 10 d0 80 00       	mov    0x80d010,%eax
+  803740:	89 06                	mov    %eax,(%esi)
+  803742:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803745:	eb d5                	jmp    80371c <nsipc_accept+0x27>
+
+00803747 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803747:	55                   	push   %ebp
+  803748:	89 e5                	mov    %esp,%ebp
+  80374a:	53                   	push   %ebx
+  80374b:	83 ec 08             	sub    $0x8,%esp
+  80374e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803751:	8b 45 08             	mov    0x8(%ebp),%eax
+  803754:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803759:	53                   	push   %ebx
+  80375a:	ff 75 0c             	push   0xc(%ebp)
+  80375d:	68 04 d0 80 00       	push   $0x80d004
+  803762:	e8 df d6 ff ff       	call   800e46 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803767:	89 1d 14 d0 80 00    	mov    %ebx,0x80d014
+	return nsipc(NSREQ_BIND);
+  80376d:	b8 02 00 00 00       	mov    $0x2,%eax
+  803772:	e8 32 ff ff ff       	call   8036a9 <nsipc>
+}
+  803777:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80377a:	c9                   	leave
+  80377b:	c3                   	ret
+
+0080377c <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80377c:	55                   	push   %ebp
+  80377d:	89 e5                	mov    %esp,%ebp
+  80377f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803782:	8b 45 08             	mov    0x8(%ebp),%eax
+  803785:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	nsipcbuf.shutdown.req_how = how;
+  80378a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80378d:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	return nsipc(NSREQ_SHUTDOWN);
+  803792:	b8 03 00 00 00       	mov    $0x3,%eax
+  803797:	e8 0d ff ff ff       	call   8036a9 <nsipc>
+}
+  80379c:	c9                   	leave
+  80379d:	c3                   	ret
+
+0080379e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80379e:	55                   	push   %ebp
+  80379f:	89 e5                	mov    %esp,%ebp
+  8037a1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8037a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037a7:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	return nsipc(NSREQ_CLOSE);
+  8037ac:	b8 04 00 00 00       	mov    $0x4,%eax
+  8037b1:	e8 f3 fe ff ff       	call   8036a9 <nsipc>
+}
+  8037b6:	c9                   	leave
+  8037b7:	c3                   	ret
+
+008037b8 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8037b8:	55                   	push   %ebp
+  8037b9:	89 e5                	mov    %esp,%ebp
+  8037bb:	53                   	push   %ebx
+  8037bc:	83 ec 08             	sub    $0x8,%esp
+  8037bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8037c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037c5:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8037ca:	53                   	push   %ebx
+  8037cb:	ff 75 0c             	push   0xc(%ebp)
+  8037ce:	68 04 d0 80 00       	push   $0x80d004
+  8037d3:	e8 6e d6 ff ff       	call   800e46 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8037d8:	89 1d 14 d0 80 00    	mov    %ebx,0x80d014
+	return nsipc(NSREQ_CONNECT);
+  8037de:	b8 05 00 00 00       	mov    $0x5,%eax
+  8037e3:	e8 c1 fe ff ff       	call   8036a9 <nsipc>
+}
+  8037e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037eb:	c9                   	leave
+  8037ec:	c3                   	ret
+
+008037ed <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8037ed:	55                   	push   %ebp
+  8037ee:	89 e5                	mov    %esp,%ebp
+  8037f0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8037f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037f6:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	nsipcbuf.listen.req_backlog = backlog;
+  8037fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037fe:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	return nsipc(NSREQ_LISTEN);
+  803803:	b8 06 00 00 00       	mov    $0x6,%eax
+  803808:	e8 9c fe ff ff       	call   8036a9 <nsipc>
+}
+  80380d:	c9                   	leave
+  80380e:	c3                   	ret
+
+0080380f <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80380f:	55                   	push   %ebp
+  803810:	89 e5                	mov    %esp,%ebp
+  803812:	56                   	push   %esi
+  803813:	53                   	push   %ebx
+  803814:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803817:	8b 45 08             	mov    0x8(%ebp),%eax
+  80381a:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	nsipcbuf.recv.req_len = len;
+  80381f:	89 35 04 d0 80 00    	mov    %esi,0x80d004
+	nsipcbuf.recv.req_flags = flags;
+  803825:	8b 45 14             	mov    0x14(%ebp),%eax
+  803828:	a3 08 d0 80 00       	mov    %eax,0x80d008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80382d:	b8 07 00 00 00       	mov    $0x7,%eax
+  803832:	e8 72 fe ff ff       	call   8036a9 <nsipc>
+  803837:	89 c3                	mov    %eax,%ebx
+  803839:	85 c0                	test   %eax,%eax
+  80383b:	78 22                	js     80385f <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80383d:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803842:	39 c6                	cmp    %eax,%esi
+  803844:	0f 4e c6             	cmovle %esi,%eax
+  803847:	39 c3                	cmp    %eax,%ebx
+  803849:	7f 1d                	jg     803868 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80384b:	83 ec 04             	sub    $0x4,%esp
+  80384e:	53                   	push   %ebx
+  80384f:	68 00 d0 80 00       	push   $0x80d000
+  803854:	ff 75 0c             	push   0xc(%ebp)
+  803857:	e8 ea d5 ff ff       	call   800e46 <memmove>
+  80385c:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80385f:	89 d8                	mov    %ebx,%eax
+  803861:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803864:	5b                   	pop    %ebx
+  803865:	5e                   	pop    %esi
+  803866:	5d                   	pop    %ebp
+  803867:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803868:	68 d2 4b 80 00       	push   $0x804bd2
+  80386d:	68 07 4a 80 00       	push   $0x804a07
+  803872:	6a 62                	push   $0x62
+  803874:	68 e7 4b 80 00       	push   $0x804be7
+  803879:	e8 79 cd ff ff       	call   8005f7 <_panic>
+
+0080387e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80387e:	55                   	push   %ebp
+  80387f:	89 e5                	mov    %esp,%ebp
+  803881:	53                   	push   %ebx
+  803882:	83 ec 04             	sub    $0x4,%esp
+  803885:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803888:	8b 45 08             	mov    0x8(%ebp),%eax
+  80388b:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	assert(size < 1600);
+  803890:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803896:	7f 2e                	jg     8038c6 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803898:	83 ec 04             	sub    $0x4,%esp
+  80389b:	53                   	push   %ebx
+  80389c:	ff 75 0c             	push   0xc(%ebp)
+  80389f:	68 0c d0 80 00       	push   $0x80d00c
+  8038a4:	e8 9d d5 ff ff       	call   800e46 <memmove>
+	nsipcbuf.send.req_size = size;
+  8038a9:	89 1d 04 d0 80 00    	mov    %ebx,0x80d004
+	nsipcbuf.send.req_flags = flags;
+  8038af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8038b2:	a3 08 d0 80 00       	mov    %eax,0x80d008
+	return nsipc(NSREQ_SEND);
+  8038b7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8038bc:	e8 e8 fd ff ff       	call   8036a9 <nsipc>
+}
+  8038c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038c4:	c9                   	leave
+  8038c5:	c3                   	ret
+	assert(size < 1600);
+  8038c6:	68 f3 4b 80 00       	push   $0x804bf3
+  8038cb:	68 07 4a 80 00       	push   $0x804a07
+  8038d0:	6a 6d                	push   $0x6d
+  8038d2:	68 e7 4b 80 00       	push   $0x804be7
+  8038d7:	e8 1b cd ff ff       	call   8005f7 <_panic>
+
+008038dc <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8038dc:	55                   	push   %ebp
+  8038dd:	89 e5                	mov    %esp,%ebp
+  8038df:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8038e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038e5:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	nsipcbuf.socket.req_type = type;
+  8038ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8038ed:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	nsipcbuf.socket.req_protocol = protocol;
+  8038f2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8038f5:	a3 08 d0 80 00       	mov    %eax,0x80d008
+	return nsipc(NSREQ_SOCKET);
+  8038fa:	b8 09 00 00 00       	mov    $0x9,%eax
+  8038ff:	e8 a5 fd ff ff       	call   8036a9 <nsipc>
+}
+  803904:	c9                   	leave
+  803905:	c3                   	ret
+
+00803906 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803906:	55                   	push   %ebp
+  803907:	89 e5                	mov    %esp,%ebp
+  803909:	56                   	push   %esi
+  80390a:	53                   	push   %ebx
+  80390b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80390e:	83 ec 0c             	sub    $0xc,%esp
+  803911:	ff 75 08             	push   0x8(%ebp)
+  803914:	e8 a7 dd ff ff       	call   8016c0 <fd2data>
+  803919:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80391b:	83 c4 08             	add    $0x8,%esp
+  80391e:	68 ff 4b 80 00       	push   $0x804bff
+  803923:	53                   	push   %ebx
+  803924:	e8 97 d3 ff ff       	call   800cc0 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803929:	8b 46 04             	mov    0x4(%esi),%eax
+  80392c:	2b 06                	sub    (%esi),%eax
+  80392e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803934:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80393b:	00 00 00 
+	stat->st_dev = &devpipe;
+  80393e:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  803945:	50 80 00 
+	return 0;
+}
+  803948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803950:	5b                   	pop    %ebx
+  803951:	5e                   	pop    %esi
+  803952:	5d                   	pop    %ebp
+  803953:	c3                   	ret
+
+00803954 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803954:	55                   	push   %ebp
+  803955:	89 e5                	mov    %esp,%ebp
+  803957:	53                   	push   %ebx
+  803958:	83 ec 0c             	sub    $0xc,%esp
+  80395b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80395e:	53                   	push   %ebx
+  80395f:	6a 00                	push   $0x0
+  803961:	e8 f3 d7 ff ff       	call   801159 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803966:	89 1c 24             	mov    %ebx,(%esp)
+  803969:	e8 52 dd ff ff       	call   8016c0 <fd2data>
+  80396e:	83 c4 08             	add    $0x8,%esp
+  803971:	50                   	push   %eax
+  803972:	6a 00                	push   $0x0
+  803974:	e8 e0 d7 ff ff       	call   801159 <sys_page_unmap>
+}
+  803979:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80397c:	c9                   	leave
+  80397d:	c3                   	ret
+
+0080397e <_pipeisclosed>:
+{
+  80397e:	55                   	push   %ebp
+  80397f:	89 e5                	mov    %esp,%ebp
+  803981:	57                   	push   %edi
+  803982:	56                   	push   %esi
+  803983:	53                   	push   %ebx
+  803984:	83 ec 1c             	sub    $0x1c,%esp
+  803987:	89 c7                	mov    %eax,%edi
+  803989:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80398b:	a1 e4 a0 80 00       	mov    0x80a0e4,%eax
+  803990:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803993:	83 ec 0c             	sub    $0xc,%esp
+  803996:	57                   	push   %edi
+  803997:	e8 a9 f3 ff ff       	call   802d45 <pageref>
+  80399c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80399f:	89 34 24             	mov    %esi,(%esp)
+  8039a2:	e8 9e f3 ff ff       	call   802d45 <pageref>
+		nn = thisenv->env_runs;
+  8039a7:	8b 15 e4 a0 80 00    	mov    0x80a0e4,%edx
+  8039ad:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8039b0:	83 c4 10             	add    $0x10,%esp
+  8039b3:	39 cb                	cmp    %ecx,%ebx
+  8039b5:	74 1b                	je     8039d2 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8039b7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8039ba:	75 cf                	jne    80398b <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8039bc:	8b 42 58             	mov    0x58(%edx),%eax
+  8039bf:	6a 01                	push   $0x1
+  8039c1:	50                   	push   %eax
+  8039c2:	53                   	push   %ebx
+  8039c3:	68 06 4c 80 00       	push   $0x804c06
+  8039c8:	e8 05 cd ff ff       	call   8006d2 <cprintf>
+  8039cd:	83 c4 10             	add    $0x10,%esp
+  8039d0:	eb b9                	jmp    80398b <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8039d2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8039d5:	0f 94 c0             	sete   %al
+  8039d8:	0f b6 c0             	movzbl %al,%eax
+}
+  8039db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039de:	5b                   	pop    %ebx
+  8039df:	5e                   	pop    %esi
+  8039e0:	5f                   	pop    %edi
+  8039e1:	5d                   	pop    %ebp
+  8039e2:	c3                   	ret
+
+008039e3 <devpipe_write>:
+{
+  8039e3:	55                   	push   %ebp
+  8039e4:	89 e5                	mov    %esp,%ebp
+  8039e6:	57                   	push   %edi
+  8039e7:	56                   	push   %esi
+  8039e8:	53                   	push   %ebx
+  8039e9:	83 ec 28             	sub    $0x28,%esp
+  8039ec:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8039ef:	56                   	push   %esi
+  8039f0:	e8 cb dc ff ff       	call   8016c0 <fd2data>
+  8039f5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8039f7:	83 c4 10             	add    $0x10,%esp
+  8039fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039ff:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803a02:	75 09                	jne    803a0d <devpipe_write+0x2a>
+	return i;
+  803a04:	89 f8                	mov    %edi,%eax
+  803a06:	eb 23                	jmp    803a2b <devpipe_write+0x48>
+			sys_yield();
+  803a08:	e8 a0 d6 ff ff       	call   8010ad <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803a0d:	8b 43 04             	mov    0x4(%ebx),%eax
+  803a10:	8b 0b                	mov    (%ebx),%ecx
+  803a12:	8d 51 20             	lea    0x20(%ecx),%edx
+  803a15:	39 d0                	cmp    %edx,%eax
+  803a17:	72 1a                	jb     803a33 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803a19:	89 da                	mov    %ebx,%edx
+  803a1b:	89 f0                	mov    %esi,%eax
+  803a1d:	e8 5c ff ff ff       	call   80397e <_pipeisclosed>
+  803a22:	85 c0                	test   %eax,%eax
+  803a24:	74 e2                	je     803a08 <devpipe_write+0x25>
+				return 0;
+  803a26:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a2e:	5b                   	pop    %ebx
+  803a2f:	5e                   	pop    %esi
+  803a30:	5f                   	pop    %edi
+  803a31:	5d                   	pop    %ebp
+  803a32:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803a33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803a36:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803a3a:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803a3d:	89 c2                	mov    %eax,%edx
+  803a3f:	c1 fa 1f             	sar    $0x1f,%edx
+  803a42:	89 d1                	mov    %edx,%ecx
+  803a44:	c1 e9 1b             	shr    $0x1b,%ecx
+  803a47:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803a4a:	83 e2 1f             	and    $0x1f,%edx
+  803a4d:	29 ca                	sub    %ecx,%edx
+  803a4f:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803a53:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803a57:	83 c0 01             	add    $0x1,%eax
+  803a5a:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803a5d:	83 c7 01             	add    $0x1,%edi
+  803a60:	eb 9d                	jmp    8039ff <devpipe_write+0x1c>
+
+00803a62 <devpipe_read>:
+{
+  803a62:	55                   	push   %ebp
+  803a63:	89 e5                	mov    %esp,%ebp
+  803a65:	57                   	push   %edi
+  803a66:	56                   	push   %esi
+  803a67:	53                   	push   %ebx
+  803a68:	83 ec 18             	sub    $0x18,%esp
+  803a6b:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803a6e:	57                   	push   %edi
+  803a6f:	e8 4c dc ff ff       	call   8016c0 <fd2data>
+  803a74:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803a76:	83 c4 10             	add    $0x10,%esp
+  803a79:	be 00 00 00 00       	mov    $0x0,%esi
+  803a7e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803a81:	75 13                	jne    803a96 <devpipe_read+0x34>
+	return i;
+  803a83:	89 f0                	mov    %esi,%eax
+  803a85:	eb 02                	jmp    803a89 <devpipe_read+0x27>
+				return i;
+  803a87:	89 f0                	mov    %esi,%eax
+}
+  803a89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a8c:	5b                   	pop    %ebx
+  803a8d:	5e                   	pop    %esi
+  803a8e:	5f                   	pop    %edi
+  803a8f:	5d                   	pop    %ebp
+  803a90:	c3                   	ret
+			sys_yield();
+  803a91:	e8 17 d6 ff ff       	call   8010ad <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803a96:	8b 03                	mov    (%ebx),%eax
+  803a98:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803a9b:	75 18                	jne    803ab5 <devpipe_read+0x53>
+			if (i > 0)
+  803a9d:	85 f6                	test   %esi,%esi
+  803a9f:	75 e6                	jne    803a87 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803aa1:	89 da                	mov    %ebx,%edx
+  803aa3:	89 f8                	mov    %edi,%eax
+  803aa5:	e8 d4 fe ff ff       	call   80397e <_pipeisclosed>
+  803aaa:	85 c0                	test   %eax,%eax
+  803aac:	74 e3                	je     803a91 <devpipe_read+0x2f>
+				return 0;
+  803aae:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ab3:	eb d4                	jmp    803a89 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803ab5:	99                   	cltd
+  803ab6:	c1 ea 1b             	shr    $0x1b,%edx
+  803ab9:	01 d0                	add    %edx,%eax
+  803abb:	83 e0 1f             	and    $0x1f,%eax
+  803abe:	29 d0                	sub    %edx,%eax
+  803ac0:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803ac5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803ac8:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803acb:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803ace:	83 c6 01             	add    $0x1,%esi
+  803ad1:	eb ab                	jmp    803a7e <devpipe_read+0x1c>
+
+00803ad3 <pipe>:
+{
+  803ad3:	55                   	push   %ebp
+  803ad4:	89 e5                	mov    %esp,%ebp
+  803ad6:	56                   	push   %esi
+  803ad7:	53                   	push   %ebx
+  803ad8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803adb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ade:	50                   	push   %eax
+  803adf:	e8 f3 db ff ff       	call   8016d7 <fd_alloc>
+  803ae4:	89 c3                	mov    %eax,%ebx
+  803ae6:	83 c4 10             	add    $0x10,%esp
+  803ae9:	85 c0                	test   %eax,%eax
+  803aeb:	0f 88 23 01 00 00    	js     803c14 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803af1:	83 ec 04             	sub    $0x4,%esp
+  803af4:	68 07 04 00 00       	push   $0x407
+  803af9:	ff 75 f4             	push   -0xc(%ebp)
+  803afc:	6a 00                	push   $0x0
+  803afe:	e8 c9 d5 ff ff       	call   8010cc <sys_page_alloc>
+  803b03:	89 c3                	mov    %eax,%ebx
+  803b05:	83 c4 10             	add    $0x10,%esp
+  803b08:	85 c0                	test   %eax,%eax
+  803b0a:	0f 88 04 01 00 00    	js     803c14 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803b10:	83 ec 0c             	sub    $0xc,%esp
+  803b13:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803b16:	50                   	push   %eax
+  803b17:	e8 bb db ff ff       	call   8016d7 <fd_alloc>
+  803b1c:	89 c3                	mov    %eax,%ebx
+  803b1e:	83 c4 10             	add    $0x10,%esp
+  803b21:	85 c0                	test   %eax,%eax
+  803b23:	0f 88 db 00 00 00    	js     803c04 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b29:	83 ec 04             	sub    $0x4,%esp
+  803b2c:	68 07 04 00 00       	push   $0x407
+  803b31:	ff 75 f0             	push   -0x10(%ebp)
+  803b34:	6a 00                	push   $0x0
+  803b36:	e8 91 d5 ff ff       	call   8010cc <sys_page_alloc>
+  803b3b:	89 c3                	mov    %eax,%ebx
+  803b3d:	83 c4 10             	add    $0x10,%esp
+  803b40:	85 c0                	test   %eax,%eax
+  803b42:	0f 88 bc 00 00 00    	js     803c04 <pipe+0x131>
+	va = fd2data(fd0);
+  803b48:	83 ec 0c             	sub    $0xc,%esp
+  803b4b:	ff 75 f4             	push   -0xc(%ebp)
+  803b4e:	e8 6d db ff ff       	call   8016c0 <fd2data>
+  803b53:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b55:	83 c4 0c             	add    $0xc,%esp
+  803b58:	68 07 04 00 00       	push   $0x407
+  803b5d:	50                   	push   %eax
+  803b5e:	6a 00                	push   $0x0
+  803b60:	e8 67 d5 ff ff       	call   8010cc <sys_page_alloc>
+  803b65:	89 c3                	mov    %eax,%ebx
+  803b67:	83 c4 10             	add    $0x10,%esp
+  803b6a:	85 c0                	test   %eax,%eax
+  803b6c:	0f 88 82 00 00 00    	js     803bf4 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b72:	83 ec 0c             	sub    $0xc,%esp
+  803b75:	ff 75 f0             	push   -0x10(%ebp)
+  803b78:	e8 43 db ff ff       	call   8016c0 <fd2data>
+  803b7d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803b84:	50                   	push   %eax
+  803b85:	6a 00                	push   $0x0
+  803b87:	56                   	push   %esi
+  803b88:	6a 00                	push   $0x0
+  803b8a:	e8 88 d5 ff ff       	call   801117 <sys_page_map>
+  803b8f:	89 c3                	mov    %eax,%ebx
+  803b91:	83 c4 20             	add    $0x20,%esp
+  803b94:	85 c0                	test   %eax,%eax
+  803b96:	78 4e                	js     803be6 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803b98:	a1 60 50 80 00       	mov    0x805060,%eax
+  803b9d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803ba0:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803ba2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803ba5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803bac:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803baf:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803bb1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803bb4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803bbb:	83 ec 0c             	sub    $0xc,%esp
+  803bbe:	ff 75 f4             	push   -0xc(%ebp)
+  803bc1:	e8 ea da ff ff       	call   8016b0 <fd2num>
+  803bc6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803bc9:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803bcb:	83 c4 04             	add    $0x4,%esp
+  803bce:	ff 75 f0             	push   -0x10(%ebp)
+  803bd1:	e8 da da ff ff       	call   8016b0 <fd2num>
+  803bd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803bd9:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803bdc:	83 c4 10             	add    $0x10,%esp
+  803bdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803be4:	eb 2e                	jmp    803c14 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803be6:	83 ec 08             	sub    $0x8,%esp
+  803be9:	56                   	push   %esi
+  803bea:	6a 00                	push   $0x0
+  803bec:	e8 68 d5 ff ff       	call   801159 <sys_page_unmap>
+  803bf1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803bf4:	83 ec 08             	sub    $0x8,%esp
+  803bf7:	ff 75 f0             	push   -0x10(%ebp)
+  803bfa:	6a 00                	push   $0x0
+  803bfc:	e8 58 d5 ff ff       	call   801159 <sys_page_unmap>
+  803c01:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803c04:	83 ec 08             	sub    $0x8,%esp
+  803c07:	ff 75 f4             	push   -0xc(%ebp)
+  803c0a:	6a 00                	push   $0x0
+  803c0c:	e8 48 d5 ff ff       	call   801159 <sys_page_unmap>
+  803c11:	83 c4 10             	add    $0x10,%esp
+}
+  803c14:	89 d8                	mov    %ebx,%eax
+  803c16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c19:	5b                   	pop    %ebx
+  803c1a:	5e                   	pop    %esi
+  803c1b:	5d                   	pop    %ebp
+  803c1c:	c3                   	ret
+
+00803c1d <pipeisclosed>:
+{
+  803c1d:	55                   	push   %ebp
+  803c1e:	89 e5                	mov    %esp,%ebp
+  803c20:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c26:	50                   	push   %eax
+  803c27:	ff 75 08             	push   0x8(%ebp)
+  803c2a:	e8 fe da ff ff       	call   80172d <fd_lookup>
+  803c2f:	83 c4 10             	add    $0x10,%esp
+  803c32:	85 c0                	test   %eax,%eax
+  803c34:	78 18                	js     803c4e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803c36:	83 ec 0c             	sub    $0xc,%esp
+  803c39:	ff 75 f4             	push   -0xc(%ebp)
+  803c3c:	e8 7f da ff ff       	call   8016c0 <fd2data>
+  803c41:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803c43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c46:	e8 33 fd ff ff       	call   80397e <_pipeisclosed>
+  803c4b:	83 c4 10             	add    $0x10,%esp
+}
+  803c4e:	c9                   	leave
+  803c4f:	c3                   	ret
+
+00803c50 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803c50:	55                   	push   %ebp
+  803c51:	89 e5                	mov    %esp,%ebp
+  803c53:	56                   	push   %esi
+  803c54:	53                   	push   %ebx
+  803c55:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803c58:	85 f6                	test   %esi,%esi
+  803c5a:	74 16                	je     803c72 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  803c5c:	89 f3                	mov    %esi,%ebx
+  803c5e:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803c64:	69 db 8c 00 00 00    	imul   $0x8c,%ebx,%ebx
+  803c6a:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803c70:	eb 1b                	jmp    803c8d <wait+0x3d>
+	assert(envid != 0);
+  803c72:	68 1e 4c 80 00       	push   $0x804c1e
+  803c77:	68 07 4a 80 00       	push   $0x804a07
+  803c7c:	6a 09                	push   $0x9
+  803c7e:	68 29 4c 80 00       	push   $0x804c29
+  803c83:	e8 6f c9 ff ff       	call   8005f7 <_panic>
+		sys_yield();
+  803c88:	e8 20 d4 ff ff       	call   8010ad <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803c8d:	8b 43 48             	mov    0x48(%ebx),%eax
+  803c90:	39 f0                	cmp    %esi,%eax
+  803c92:	75 07                	jne    803c9b <wait+0x4b>
+  803c94:	8b 43 54             	mov    0x54(%ebx),%eax
+  803c97:	85 c0                	test   %eax,%eax
+  803c99:	75 ed                	jne    803c88 <wait+0x38>
+}
+  803c9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c9e:	5b                   	pop    %ebx
+  803c9f:	5e                   	pop    %esi
+  803ca0:	5d                   	pop    %ebp
+  803ca1:	c3                   	ret
+
+00803ca2 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ca7:	c3                   	ret
+
+00803ca8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803ca8:	55                   	push   %ebp
+  803ca9:	89 e5                	mov    %esp,%ebp
+  803cab:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803cae:	68 34 4c 80 00       	push   $0x804c34
+  803cb3:	ff 75 0c             	push   0xc(%ebp)
+  803cb6:	e8 05 d0 ff ff       	call   800cc0 <strcpy>
+	return 0;
+}
+  803cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cc0:	c9                   	leave
+  803cc1:	c3                   	ret
+
+00803cc2 <devcons_write>:
+{
+  803cc2:	55                   	push   %ebp
+  803cc3:	89 e5                	mov    %esp,%ebp
+  803cc5:	57                   	push   %edi
+  803cc6:	56                   	push   %esi
+  803cc7:	53                   	push   %ebx
+  803cc8:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803cce:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803cd3:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803cd9:	eb 2e                	jmp    803d09 <devcons_write+0x47>
+		m = n - tot;
+  803cdb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803cde:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803ce0:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803ce5:	39 c3                	cmp    %eax,%ebx
+  803ce7:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803cea:	83 ec 04             	sub    $0x4,%esp
+  803ced:	53                   	push   %ebx
+  803cee:	89 f0                	mov    %esi,%eax
+  803cf0:	03 45 0c             	add    0xc(%ebp),%eax
+  803cf3:	50                   	push   %eax
+  803cf4:	57                   	push   %edi
+  803cf5:	e8 4c d1 ff ff       	call   800e46 <memmove>
+		sys_cputs(buf, m);
+  803cfa:	83 c4 08             	add    $0x8,%esp
+  803cfd:	53                   	push   %ebx
+  803cfe:	57                   	push   %edi
+  803cff:	e8 ec d2 ff ff       	call   800ff0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803d04:	01 de                	add    %ebx,%esi
+  803d06:	83 c4 10             	add    $0x10,%esp
+  803d09:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803d0c:	72 cd                	jb     803cdb <devcons_write+0x19>
+}
+  803d0e:	89 f0                	mov    %esi,%eax
+  803d10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d13:	5b                   	pop    %ebx
+  803d14:	5e                   	pop    %esi
+  803d15:	5f                   	pop    %edi
+  803d16:	5d                   	pop    %ebp
+  803d17:	c3                   	ret
+
+00803d18 <devcons_read>:
+{
+  803d18:	55                   	push   %ebp
+  803d19:	89 e5                	mov    %esp,%ebp
+  803d1b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803d1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d23:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803d27:	75 07                	jne    803d30 <devcons_read+0x18>
+  803d29:	eb 1f                	jmp    803d4a <devcons_read+0x32>
+		sys_yield();
+  803d2b:	e8 7d d3 ff ff       	call   8010ad <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803d30:	e8 e1 d2 ff ff       	call   801016 <sys_cgetc>
+  803d35:	85 c0                	test   %eax,%eax
+  803d37:	74 f2                	je     803d2b <devcons_read+0x13>
+	if (c < 0)
+  803d39:	78 0f                	js     803d4a <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803d3b:	83 f8 04             	cmp    $0x4,%eax
+  803d3e:	74 0c                	je     803d4c <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803d40:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d43:	88 02                	mov    %al,(%edx)
+	return 1;
+  803d45:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803d4a:	c9                   	leave
+  803d4b:	c3                   	ret
+		return 0;
+  803d4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d51:	eb f7                	jmp    803d4a <devcons_read+0x32>
+
+00803d53 <cputchar>:
+{
+  803d53:	55                   	push   %ebp
+  803d54:	89 e5                	mov    %esp,%ebp
+  803d56:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803d59:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d5c:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803d5f:	6a 01                	push   $0x1
+  803d61:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803d64:	50                   	push   %eax
+  803d65:	e8 86 d2 ff ff       	call   800ff0 <sys_cputs>
+}
+  803d6a:	83 c4 10             	add    $0x10,%esp
+  803d6d:	c9                   	leave
+  803d6e:	c3                   	ret
+
+00803d6f <getchar>:
+{
+  803d6f:	55                   	push   %ebp
+  803d70:	89 e5                	mov    %esp,%ebp
+  803d72:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803d75:	6a 01                	push   $0x1
+  803d77:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803d7a:	50                   	push   %eax
+  803d7b:	6a 00                	push   $0x0
+  803d7d:	e8 11 dc ff ff       	call   801993 <read>
+	if (r < 0)
+  803d82:	83 c4 10             	add    $0x10,%esp
+  803d85:	85 c0                	test   %eax,%eax
+  803d87:	78 06                	js     803d8f <getchar+0x20>
+	if (r < 1)
+  803d89:	74 06                	je     803d91 <getchar+0x22>
+	return c;
+  803d8b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803d8f:	c9                   	leave
+  803d90:	c3                   	ret
+		return -E_EOF;
+  803d91:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803d96:	eb f7                	jmp    803d8f <getchar+0x20>
+
+00803d98 <iscons>:
+{
+  803d98:	55                   	push   %ebp
+  803d99:	89 e5                	mov    %esp,%ebp
+  803d9b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803d9e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803da1:	50                   	push   %eax
+  803da2:	ff 75 08             	push   0x8(%ebp)
+  803da5:	e8 83 d9 ff ff       	call   80172d <fd_lookup>
+  803daa:	83 c4 10             	add    $0x10,%esp
+  803dad:	85 c0                	test   %eax,%eax
+  803daf:	78 11                	js     803dc2 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803db1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803db4:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803dba:	39 10                	cmp    %edx,(%eax)
+  803dbc:	0f 94 c0             	sete   %al
+  803dbf:	0f b6 c0             	movzbl %al,%eax
+}
+  803dc2:	c9                   	leave
+  803dc3:	c3                   	ret
+
+00803dc4 <opencons>:
+{
+  803dc4:	55                   	push   %ebp
+  803dc5:	89 e5                	mov    %esp,%ebp
+  803dc7:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803dca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803dcd:	50                   	push   %eax
+  803dce:	e8 04 d9 ff ff       	call   8016d7 <fd_alloc>
+  803dd3:	83 c4 10             	add    $0x10,%esp
+  803dd6:	85 c0                	test   %eax,%eax
+  803dd8:	78 3a                	js     803e14 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803dda:	83 ec 04             	sub    $0x4,%esp
+  803ddd:	68 07 04 00 00       	push   $0x407
+  803de2:	ff 75 f4             	push   -0xc(%ebp)
+  803de5:	6a 00                	push   $0x0
+  803de7:	e8 e0 d2 ff ff       	call   8010cc <sys_page_alloc>
+  803dec:	83 c4 10             	add    $0x10,%esp
+  803def:	85 c0                	test   %eax,%eax
+  803df1:	78 21                	js     803e14 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803df3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803df6:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803dfc:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803dfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e01:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803e08:	83 ec 0c             	sub    $0xc,%esp
+  803e0b:	50                   	push   %eax
+  803e0c:	e8 9f d8 ff ff       	call   8016b0 <fd2num>
+  803e11:	83 c4 10             	add    $0x10,%esp
+}
+  803e14:	c9                   	leave
+  803e15:	c3                   	ret
+
+00803e16 <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  803e16:	55                   	push   %ebp
+  803e17:	89 e5                	mov    %esp,%ebp
+  803e19:	57                   	push   %edi
+  803e1a:	56                   	push   %esi
+  803e1b:	53                   	push   %ebx
+  803e1c:	83 ec 20             	sub    $0x20,%esp
+  803e1f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803e22:	89 d7                	mov    %edx,%edi
+  803e24:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  803e26:	51                   	push   %ecx
+  803e27:	68 00 f0 7f 00       	push   $0x7ff000
+  803e2c:	6a 00                	push   $0x0
+  803e2e:	e8 99 d2 ff ff       	call   8010cc <sys_page_alloc>
+  803e33:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803e35:	83 c4 10             	add    $0x10,%esp
+  803e38:	85 c0                	test   %eax,%eax
+  803e3a:	78 45                	js     803e81 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  803e3c:	83 ec 04             	sub    $0x4,%esp
+  803e3f:	68 00 10 00 00       	push   $0x1000
+  803e44:	57                   	push   %edi
+  803e45:	68 00 f0 7f 00       	push   $0x7ff000
+  803e4a:	e8 f7 cf ff ff       	call   800e46 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  803e4f:	89 34 24             	mov    %esi,(%esp)
+  803e52:	57                   	push   %edi
+  803e53:	ff 75 e4             	push   -0x1c(%ebp)
+  803e56:	68 00 f0 7f 00       	push   $0x7ff000
+  803e5b:	6a 00                	push   $0x0
+  803e5d:	e8 b5 d2 ff ff       	call   801117 <sys_page_map>
+  803e62:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803e64:	83 c4 20             	add    $0x20,%esp
+  803e67:	85 c0                	test   %eax,%eax
+  803e69:	78 16                	js     803e81 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803e6b:	83 ec 08             	sub    $0x8,%esp
+  803e6e:	68 00 f0 7f 00       	push   $0x7ff000
+  803e73:	6a 00                	push   $0x0
+  803e75:	e8 df d2 ff ff       	call   801159 <sys_page_unmap>
+  803e7a:	83 c4 10             	add    $0x10,%esp
+  803e7d:	85 c0                	test   %eax,%eax
+  803e7f:	75 0a                	jne    803e8b <copy_page_to+0x75>
+exit:
+	return r;
+}
+  803e81:	89 d8                	mov    %ebx,%eax
+  803e83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e86:	5b                   	pop    %ebx
+  803e87:	5e                   	pop    %esi
+  803e88:	5f                   	pop    %edi
+  803e89:	5d                   	pop    %ebp
+  803e8a:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803e8b:	68 40 4c 80 00       	push   $0x804c40
+  803e90:	68 07 4a 80 00       	push   $0x804a07
+  803e95:	6a 1b                	push   $0x1b
+  803e97:	68 b8 4c 80 00       	push   $0x804cb8
+  803e9c:	e8 56 c7 ff ff       	call   8005f7 <_panic>
+
+00803ea1 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803ea1:	55                   	push   %ebp
+  803ea2:	89 e5                	mov    %esp,%ebp
+  803ea4:	53                   	push   %ebx
+  803ea5:	83 ec 04             	sub    $0x4,%esp
+  803ea8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803eab:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803ead:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  803eb1:	74 21                	je     803ed4 <pgfault+0x33>
+  803eb3:	89 d0                	mov    %edx,%eax
+  803eb5:	c1 e8 16             	shr    $0x16,%eax
+  803eb8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803ebf:	a8 01                	test   $0x1,%al
+  803ec1:	74 11                	je     803ed4 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803ec3:	89 d0                	mov    %edx,%eax
+  803ec5:	c1 e8 0c             	shr    $0xc,%eax
+  803ec8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803ecf:	f6 c4 08             	test   $0x8,%ah
+  803ed2:	75 17                	jne    803eeb <pgfault+0x4a>
+		if (pgfault_next) {
+  803ed4:	a1 04 e0 80 00       	mov    0x80e004,%eax
+  803ed9:	85 c0                	test   %eax,%eax
+  803edb:	74 27                	je     803f04 <pgfault+0x63>
+			pgfault_next(utf);
+  803edd:	83 ec 0c             	sub    $0xc,%esp
+  803ee0:	53                   	push   %ebx
+  803ee1:	ff d0                	call   *%eax
+			return;
+  803ee3:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  803ee6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ee9:	c9                   	leave
+  803eea:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803eeb:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803ef1:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803efb:	e8 16 ff ff ff       	call   803e16 <copy_page_to>
+  803f00:	85 c0                	test   %eax,%eax
+  803f02:	79 e2                	jns    803ee6 <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  803f04:	a1 e4 a0 80 00       	mov    0x80a0e4,%eax
+  803f09:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803f0c:	ff 73 28             	push   0x28(%ebx)
+  803f0f:	ff 33                	push   (%ebx)
+  803f11:	50                   	push   %eax
+  803f12:	68 64 4c 80 00       	push   $0x804c64
+  803f17:	e8 b6 c7 ff ff       	call   8006d2 <cprintf>
+	sys_env_destroy(0);
+  803f1c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803f23:	e8 15 d1 ff ff       	call   80103d <sys_env_destroy>
+  803f28:	83 c4 10             	add    $0x10,%esp
+  803f2b:	eb b9                	jmp    803ee6 <pgfault+0x45>
+
+00803f2d <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803f2d:	55                   	push   %ebp
+  803f2e:	89 e5                	mov    %esp,%ebp
+  803f30:	53                   	push   %ebx
+  803f31:	83 ec 04             	sub    $0x4,%esp
+  803f34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  803f37:	a1 08 e0 80 00       	mov    0x80e008,%eax
+  803f3c:	3d a1 3e 80 00       	cmp    $0x803ea1,%eax
+  803f41:	74 15                	je     803f58 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803f43:	a3 04 e0 80 00       	mov    %eax,0x80e004
+		set_pgfault_handler(pgfault);
+  803f48:	83 ec 0c             	sub    $0xc,%esp
+  803f4b:	68 a1 3e 80 00       	push   $0x803ea1
+  803f50:	e8 d6 01 00 00       	call   80412b <set_pgfault_handler>
+  803f55:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803f58:	83 ec 0c             	sub    $0xc,%esp
+  803f5b:	68 05 08 00 00       	push   $0x805
+  803f60:	53                   	push   %ebx
+  803f61:	6a 00                	push   $0x0
+  803f63:	53                   	push   %ebx
+  803f64:	6a 00                	push   $0x0
+  803f66:	e8 ac d1 ff ff       	call   801117 <sys_page_map>
+}
+  803f6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803f6e:	c9                   	leave
+  803f6f:	c3                   	ret
+
+00803f70 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803f70:	55                   	push   %ebp
+  803f71:	89 e5                	mov    %esp,%ebp
+  803f73:	57                   	push   %edi
+  803f74:	56                   	push   %esi
+  803f75:	53                   	push   %ebx
+  803f76:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  803f79:	68 a1 3e 80 00       	push   $0x803ea1
+  803f7e:	e8 a8 01 00 00       	call   80412b <set_pgfault_handler>
+  803f83:	b8 07 00 00 00       	mov    $0x7,%eax
+  803f88:	cd 30                	int    $0x30
+  803f8a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803f8d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  803f90:	83 c4 10             	add    $0x10,%esp
+  803f93:	85 c0                	test   %eax,%eax
+  803f95:	0f 88 6b 01 00 00    	js     804106 <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803f9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803fa0:	75 37                	jne    803fd9 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803fa2:	e8 df d0 ff ff       	call   801086 <sys_getenvid>
+  803fa7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803fac:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803fb2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803fb7:	a3 e4 a0 80 00       	mov    %eax,0x80a0e4
+		return 0;
+  803fbc:	e9 45 01 00 00       	jmp    804106 <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803fc1:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803fc7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803fcd:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803fd3:	0f 87 ba 00 00 00    	ja     804093 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803fd9:	89 d8                	mov    %ebx,%eax
+  803fdb:	c1 e8 16             	shr    $0x16,%eax
+  803fde:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803fe5:	a8 01                	test   $0x1,%al
+  803fe7:	74 d8                	je     803fc1 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803fe9:	89 d8                	mov    %ebx,%eax
+  803feb:	c1 e8 0c             	shr    $0xc,%eax
+  803fee:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803ff5:	f6 c2 01             	test   $0x1,%dl
+  803ff8:	74 cd                	je     803fc7 <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803ffa:	89 da                	mov    %ebx,%edx
+  803ffc:	80 e6 df             	and    $0xdf,%dh
+  803fff:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  804005:	74 c0                	je     803fc7 <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  804007:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  804009:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  804010:	f6 c6 04             	test   $0x4,%dh
+  804013:	75 53                	jne    804068 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  804015:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80401c:	f6 c6 08             	test   $0x8,%dh
+  80401f:	75 0c                	jne    80402d <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  804021:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  804028:	f6 c2 02             	test   $0x2,%dl
+  80402b:	74 3b                	je     804068 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  80402d:	83 ec 0c             	sub    $0xc,%esp
+  804030:	68 05 08 00 00       	push   $0x805
+  804035:	57                   	push   %edi
+  804036:	ff 75 e4             	push   -0x1c(%ebp)
+  804039:	57                   	push   %edi
+  80403a:	6a 00                	push   $0x0
+  80403c:	e8 d6 d0 ff ff       	call   801117 <sys_page_map>
+  804041:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  804043:	83 c4 20             	add    $0x20,%esp
+  804046:	85 c0                	test   %eax,%eax
+  804048:	0f 88 a7 00 00 00    	js     8040f5 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80404e:	83 ec 0c             	sub    $0xc,%esp
+  804051:	68 05 08 00 00       	push   $0x805
+  804056:	57                   	push   %edi
+  804057:	6a 00                	push   $0x0
+  804059:	57                   	push   %edi
+  80405a:	6a 00                	push   $0x0
+  80405c:	e8 b6 d0 ff ff       	call   801117 <sys_page_map>
+  804061:	89 c6                	mov    %eax,%esi
+	return r;
+  804063:	83 c4 20             	add    $0x20,%esp
+  804066:	eb 21                	jmp    804089 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  804068:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80406f:	83 ec 0c             	sub    $0xc,%esp
+  804072:	25 07 0e 00 00       	and    $0xe07,%eax
+  804077:	50                   	push   %eax
+  804078:	57                   	push   %edi
+  804079:	ff 75 e4             	push   -0x1c(%ebp)
+  80407c:	57                   	push   %edi
+  80407d:	6a 00                	push   $0x0
+  80407f:	e8 93 d0 ff ff       	call   801117 <sys_page_map>
+  804084:	89 c6                	mov    %eax,%esi
+  804086:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  804089:	85 f6                	test   %esi,%esi
+  80408b:	0f 89 36 ff ff ff    	jns    803fc7 <fork+0x57>
+  804091:	eb 62                	jmp    8040f5 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  804093:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804098:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  80409d:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8040a0:	89 f8                	mov    %edi,%eax
+  8040a2:	e8 6f fd ff ff       	call   803e16 <copy_page_to>
+  8040a7:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8040a9:	85 c0                	test   %eax,%eax
+  8040ab:	78 48                	js     8040f5 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8040ad:	83 ec 04             	sub    $0x4,%esp
+  8040b0:	6a 07                	push   $0x7
+  8040b2:	68 00 f0 bf ee       	push   $0xeebff000
+  8040b7:	57                   	push   %edi
+  8040b8:	e8 0f d0 ff ff       	call   8010cc <sys_page_alloc>
+  8040bd:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8040bf:	83 c4 10             	add    $0x10,%esp
+  8040c2:	85 c0                	test   %eax,%eax
+  8040c4:	78 2f                	js     8040f5 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8040c6:	a1 e4 a0 80 00       	mov    0x80a0e4,%eax
+  8040cb:	8b 40 64             	mov    0x64(%eax),%eax
+  8040ce:	83 ec 08             	sub    $0x8,%esp
+  8040d1:	50                   	push   %eax
+  8040d2:	57                   	push   %edi
+  8040d3:	e8 5f d1 ff ff       	call   801237 <sys_env_set_pgfault_upcall>
+  8040d8:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8040da:	83 c4 10             	add    $0x10,%esp
+  8040dd:	85 c0                	test   %eax,%eax
+  8040df:	78 14                	js     8040f5 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8040e1:	83 ec 08             	sub    $0x8,%esp
+  8040e4:	6a 02                	push   $0x2
+  8040e6:	57                   	push   %edi
+  8040e7:	e8 b7 d0 ff ff       	call   8011a3 <sys_env_set_status>
+  8040ec:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8040ee:	83 c4 10             	add    $0x10,%esp
+  8040f1:	85 c0                	test   %eax,%eax
+  8040f3:	79 11                	jns    804106 <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8040f5:	83 ec 0c             	sub    $0xc,%esp
+  8040f8:	ff 75 e0             	push   -0x20(%ebp)
+  8040fb:	e8 3d cf ff ff       	call   80103d <sys_env_destroy>
+	return r;
+  804100:	83 c4 10             	add    $0x10,%esp
+  804103:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  804106:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80410c:	5b                   	pop    %ebx
+  80410d:	5e                   	pop    %esi
+  80410e:	5f                   	pop    %edi
+  80410f:	5d                   	pop    %ebp
+  804110:	c3                   	ret
+
+00804111 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  804111:	55                   	push   %ebp
+  804112:	89 e5                	mov    %esp,%ebp
+  804114:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  804117:	68 c3 4c 80 00       	push   $0x804cc3
+  80411c:	68 bf 00 00 00       	push   $0xbf
+  804121:	68 b8 4c 80 00       	push   $0x804cb8
+  804126:	e8 cc c4 ff ff       	call   8005f7 <_panic>
+
+0080412b <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80412b:	55                   	push   %ebp
+  80412c:	89 e5                	mov    %esp,%ebp
+  80412e:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  804131:	83 3d 08 e0 80 00 00 	cmpl   $0x0,0x80e008
+  804138:	74 0a                	je     804144 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80413a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80413d:	a3 08 e0 80 00       	mov    %eax,0x80e008
+}
+  804142:	c9                   	leave
+  804143:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  804144:	83 ec 04             	sub    $0x4,%esp
+  804147:	6a 07                	push   $0x7
+  804149:	68 00 f0 bf ee       	push   $0xeebff000
+  80414e:	6a 00                	push   $0x0
+  804150:	e8 77 cf ff ff       	call   8010cc <sys_page_alloc>
+  804155:	83 c4 10             	add    $0x10,%esp
+  804158:	85 c0                	test   %eax,%eax
+  80415a:	75 2c                	jne    804188 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80415c:	83 ec 08             	sub    $0x8,%esp
+  80415f:	68 9e 41 80 00       	push   $0x80419e
+  804164:	6a 00                	push   $0x0
+  804166:	e8 cc d0 ff ff       	call   801237 <sys_env_set_pgfault_upcall>
+  80416b:	83 c4 10             	add    $0x10,%esp
+  80416e:	85 c0                	test   %eax,%eax
+  804170:	74 c8                	je     80413a <set_pgfault_handler+0xf>
+  804172:	68 24 4d 80 00       	push   $0x804d24
+  804177:	68 07 4a 80 00       	push   $0x804a07
+  80417c:	6a 20                	push   $0x20
+  80417e:	68 54 4d 80 00       	push   $0x804d54
+  804183:	e8 6f c4 ff ff       	call   8005f7 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  804188:	68 dc 4c 80 00       	push   $0x804cdc
+  80418d:	68 07 4a 80 00       	push   $0x804a07
+  804192:	6a 1e                	push   $0x1e
+  804194:	68 54 4d 80 00       	push   $0x804d54
+  804199:	e8 59 c4 ff ff       	call   8005f7 <_panic>
+
+0080419e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80419e:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80419f:	a1 08 e0 80 00       	mov    0x80e008,%eax
+	call *%eax
+  8041a4:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8041a6:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8041a9:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8041ae:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8041b3:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8041b7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8041ba:	83 c4 08             	add    $0x8,%esp
+	popal
+  8041bd:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8041be:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8041c1:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8041c2:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8041c3:	c3                   	ret
+
+008041c4 <dm>:
+  8041c4:	55                   	push   %ebp
+  8041c5:	57                   	push   %edi
+  8041c6:	56                   	push   %esi
+  8041c7:	53                   	push   %ebx
+  8041c8:	83 ec 24             	sub    $0x24,%esp
+  8041cb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8041cf:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8041d3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8041d7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8041db:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8041df:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8041e3:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8041e7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8041ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041f6:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8041fd:	00 
+  8041fe:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804205:	00 
+  804206:	89 fb                	mov    %edi,%ebx
+  804208:	eb 08                	jmp    804212 <dm+0x4e>
+  80420a:	83 e9 01             	sub    $0x1,%ecx
+  80420d:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804210:	74 68                	je     80427a <dm+0xb6>
+  804212:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804216:	01 c0                	add    %eax,%eax
+  804218:	89 c6                	mov    %eax,%esi
+  80421a:	89 d7                	mov    %edx,%edi
+  80421c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804220:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804224:	0f ad d0             	shrd   %cl,%edx,%eax
+  804227:	d3 ea                	shr    %cl,%edx
+  804229:	f6 c1 20             	test   $0x20,%cl
+  80422c:	74 04                	je     804232 <dm+0x6e>
+  80422e:	89 d0                	mov    %edx,%eax
+  804230:	31 d2                	xor    %edx,%edx
+  804232:	83 e0 01             	and    $0x1,%eax
+  804235:	89 04 24             	mov    %eax,(%esp)
+  804238:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  80423f:	00 
+  804240:	8b 04 24             	mov    (%esp),%eax
+  804243:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804247:	09 f0                	or     %esi,%eax
+  804249:	09 fa                	or     %edi,%edx
+  80424b:	8b 74 24 10          	mov    0x10(%esp),%esi
+  80424f:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804253:	39 f0                	cmp    %esi,%eax
+  804255:	89 d5                	mov    %edx,%ebp
+  804257:	19 fd                	sbb    %edi,%ebp
+  804259:	72 af                	jb     80420a <dm+0x46>
+  80425b:	29 f0                	sub    %esi,%eax
+  80425d:	19 fa                	sbb    %edi,%edx
+  80425f:	89 cf                	mov    %ecx,%edi
+  804261:	c1 ef 05             	shr    $0x5,%edi
+  804264:	83 e7 01             	and    $0x1,%edi
+  804267:	89 fe                	mov    %edi,%esi
+  804269:	83 f6 01             	xor    $0x1,%esi
+  80426c:	d3 e6                	shl    %cl,%esi
+  80426e:	d3 e7                	shl    %cl,%edi
+  804270:	09 74 24 18          	or     %esi,0x18(%esp)
+  804274:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804278:	eb 90                	jmp    80420a <dm+0x46>
+  80427a:	85 db                	test   %ebx,%ebx
+  80427c:	74 05                	je     804283 <dm+0xbf>
+  80427e:	89 03                	mov    %eax,(%ebx)
+  804280:	89 53 04             	mov    %edx,0x4(%ebx)
+  804283:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804287:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80428b:	83 c4 24             	add    $0x24,%esp
+  80428e:	5b                   	pop    %ebx
+  80428f:	5e                   	pop    %esi
+  804290:	5f                   	pop    %edi
+  804291:	5d                   	pop    %ebp
+  804292:	c3                   	ret
+
+00804293 <__udivdi3>:
+  804293:	83 ec 08             	sub    $0x8,%esp
+  804296:	6a 00                	push   $0x0
+  804298:	ff 74 24 1c          	push   0x1c(%esp)
+  80429c:	ff 74 24 1c          	push   0x1c(%esp)
+  8042a0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8042a4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8042a8:	e8 17 ff ff ff       	call   8041c4 <dm>
+  8042ad:	83 c4 14             	add    $0x14,%esp
+  8042b0:	c3                   	ret
+
+008042b1 <__umoddi3>:
+  8042b1:	83 ec 18             	sub    $0x18,%esp
+  8042b4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8042b8:	50                   	push   %eax
+  8042b9:	ff 74 24 2c          	push   0x2c(%esp)
+  8042bd:	ff 74 24 2c          	push   0x2c(%esp)
+  8042c1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8042c5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8042c9:	e8 f6 fe ff ff       	call   8041c4 <dm>
+  8042ce:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8042d2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8042d6:	83 c4 24             	add    $0x24,%esp
+  8042d9:	c3                   	ret
+
+008042da <__divdi3>:
+  8042da:	53                   	push   %ebx
+  8042db:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8042df:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8042e3:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8042e7:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8042eb:	85 d2                	test   %edx,%edx
+  8042ed:	78 15                	js     804304 <__divdi3+0x2a>
+  8042ef:	85 db                	test   %ebx,%ebx
+  8042f1:	78 34                	js     804327 <__divdi3+0x4d>
+  8042f3:	83 ec 04             	sub    $0x4,%esp
+  8042f6:	6a 00                	push   $0x0
+  8042f8:	53                   	push   %ebx
+  8042f9:	51                   	push   %ecx
+  8042fa:	e8 c5 fe ff ff       	call   8041c4 <dm>
+  8042ff:	83 c4 10             	add    $0x10,%esp
+  804302:	eb 21                	jmp    804325 <__divdi3+0x4b>
+  804304:	f7 d8                	neg    %eax
+  804306:	83 d2 00             	adc    $0x0,%edx
+  804309:	f7 da                	neg    %edx
+  80430b:	85 db                	test   %ebx,%ebx
+  80430d:	78 30                	js     80433f <__divdi3+0x65>
+  80430f:	83 ec 04             	sub    $0x4,%esp
+  804312:	6a 00                	push   $0x0
+  804314:	53                   	push   %ebx
+  804315:	51                   	push   %ecx
+  804316:	e8 a9 fe ff ff       	call   8041c4 <dm>
+  80431b:	83 c4 10             	add    $0x10,%esp
+  80431e:	f7 d8                	neg    %eax
+  804320:	83 d2 00             	adc    $0x0,%edx
+  804323:	f7 da                	neg    %edx
+  804325:	5b                   	pop    %ebx
+  804326:	c3                   	ret
+  804327:	83 ec 04             	sub    $0x4,%esp
+  80432a:	6a 00                	push   $0x0
+  80432c:	f7 d9                	neg    %ecx
+  80432e:	83 d3 00             	adc    $0x0,%ebx
+  804331:	f7 db                	neg    %ebx
+  804333:	53                   	push   %ebx
+  804334:	51                   	push   %ecx
+  804335:	e8 8a fe ff ff       	call   8041c4 <dm>
+  80433a:	83 c4 10             	add    $0x10,%esp
+  80433d:	eb df                	jmp    80431e <__divdi3+0x44>
+  80433f:	83 ec 04             	sub    $0x4,%esp
+  804342:	6a 00                	push   $0x0
+  804344:	f7 d9                	neg    %ecx
+  804346:	83 d3 00             	adc    $0x0,%ebx
+  804349:	f7 db                	neg    %ebx
+  80434b:	53                   	push   %ebx
+  80434c:	51                   	push   %ecx
+  80434d:	e8 72 fe ff ff       	call   8041c4 <dm>
+  804352:	83 c4 10             	add    $0x10,%esp
+  804355:	eb ce                	jmp    804325 <__divdi3+0x4b>
+
+00804357 <__moddi3>:
+  804357:	55                   	push   %ebp
+  804358:	57                   	push   %edi
+  804359:	56                   	push   %esi
+  80435a:	53                   	push   %ebx
+  80435b:	83 ec 24             	sub    $0x24,%esp
+  80435e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804362:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804366:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80436a:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80436e:	85 d2                	test   %edx,%edx
+  804370:	78 3b                	js     8043ad <__moddi3+0x56>
+  804372:	83 ec 04             	sub    $0x4,%esp
+  804375:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804379:	56                   	push   %esi
+  80437a:	89 ce                	mov    %ecx,%esi
+  80437c:	f7 de                	neg    %esi
+  80437e:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804382:	89 de                	mov    %ebx,%esi
+  804384:	83 d6 00             	adc    $0x0,%esi
+  804387:	f7 de                	neg    %esi
+  804389:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80438d:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804391:	0f 48 f1             	cmovs  %ecx,%esi
+  804394:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804399:	53                   	push   %ebx
+  80439a:	56                   	push   %esi
+  80439b:	e8 24 fe ff ff       	call   8041c4 <dm>
+  8043a0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8043a4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8043a8:	83 c4 10             	add    $0x10,%esp
+  8043ab:	eb 47                	jmp    8043f4 <__moddi3+0x9d>
+  8043ad:	f7 d8                	neg    %eax
+  8043af:	83 d2 00             	adc    $0x0,%edx
+  8043b2:	f7 da                	neg    %edx
+  8043b4:	83 ec 04             	sub    $0x4,%esp
+  8043b7:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8043bb:	56                   	push   %esi
+  8043bc:	89 cf                	mov    %ecx,%edi
+  8043be:	f7 df                	neg    %edi
+  8043c0:	89 de                	mov    %ebx,%esi
+  8043c2:	83 d6 00             	adc    $0x0,%esi
+  8043c5:	f7 de                	neg    %esi
+  8043c7:	0f 49 cf             	cmovns %edi,%ecx
+  8043ca:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8043ce:	0f 49 de             	cmovns %esi,%ebx
+  8043d1:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8043d5:	ff 74 24 0c          	push   0xc(%esp)
+  8043d9:	ff 74 24 0c          	push   0xc(%esp)
+  8043dd:	e8 e2 fd ff ff       	call   8041c4 <dm>
+  8043e2:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8043e6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8043ea:	f7 d8                	neg    %eax
+  8043ec:	83 d2 00             	adc    $0x0,%edx
+  8043ef:	f7 da                	neg    %edx
+  8043f1:	83 c4 10             	add    $0x10,%esp
+  8043f4:	83 c4 24             	add    $0x24,%esp
+  8043f7:	5b                   	pop    %ebx
+  8043f8:	5e                   	pop    %esi
+  8043f9:	5f                   	pop    %edi
+  8043fa:	5d                   	pop    %ebp
+  8043fb:	c3                   	ret
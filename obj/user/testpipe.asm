@@ -0,0 +1,7919 @@
+
+obj/user/testpipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a1 02 00 00       	call   8002d2 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 7c             	sub    $0x7c,%esp
+	char buf[100];
+	int i, pid, p[2];
+
+	binaryname = "pipereadeof";
+  80003b:	c7 05 04 50 80 00 40 	movl   $0x803a40,0x805004
+  800042:	3a 80 00 
+
+	if ((i = pipe(p)) < 0)
+  800045:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800048:	50                   	push   %eax
+  800049:	e8 9c 31 00 00       	call   8031ea <pipe>
+  80004e:	89 c6                	mov    %eax,%esi
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 1b 01 00 00    	js     800176 <umain+0x143>
+		panic("pipe: %e", i);
+
+	if ((pid = fork()) < 0)
+  80005b:	e8 05 13 00 00       	call   801365 <fork>
+  800060:	89 c3                	mov    %eax,%ebx
+  800062:	85 c0                	test   %eax,%eax
+  800064:	0f 88 1e 01 00 00    	js     800188 <umain+0x155>
+		panic("fork: %e", i);
+
+	if (pid == 0) {
+  80006a:	0f 85 56 01 00 00    	jne    8001c6 <umain+0x193>
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  800070:	a1 00 60 80 00       	mov    0x806000,%eax
+  800075:	8b 40 48             	mov    0x48(%eax),%eax
+  800078:	83 ec 04             	sub    $0x4,%esp
+  80007b:	ff 75 90             	push   -0x70(%ebp)
+  80007e:	50                   	push   %eax
+  80007f:	68 6e 3a 80 00       	push   $0x803a6e
+  800084:	e8 87 03 00 00       	call   800410 <cprintf>
+		close(p[1]);
+  800089:	83 c4 04             	add    $0x4,%esp
+  80008c:	ff 75 90             	push   -0x70(%ebp)
+  80008f:	e8 33 16 00 00       	call   8016c7 <close>
+		cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  800094:	a1 00 60 80 00       	mov    0x806000,%eax
+  800099:	8b 40 48             	mov    0x48(%eax),%eax
+  80009c:	83 c4 0c             	add    $0xc,%esp
+  80009f:	ff 75 8c             	push   -0x74(%ebp)
+  8000a2:	50                   	push   %eax
+  8000a3:	68 8b 3a 80 00       	push   $0x803a8b
+  8000a8:	e8 63 03 00 00       	call   800410 <cprintf>
+		i = readn(p[0], buf, sizeof buf-1);
+  8000ad:	83 c4 0c             	add    $0xc,%esp
+  8000b0:	6a 63                	push   $0x63
+  8000b2:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8000b5:	50                   	push   %eax
+  8000b6:	ff 75 8c             	push   -0x74(%ebp)
+  8000b9:	e8 cc 17 00 00       	call   80188a <readn>
+  8000be:	89 c6                	mov    %eax,%esi
+		if (i < 0)
+  8000c0:	83 c4 10             	add    $0x10,%esp
+  8000c3:	85 c0                	test   %eax,%eax
+  8000c5:	0f 88 cf 00 00 00    	js     80019a <umain+0x167>
+			panic("read: %e", i);
+		buf[i] = 0;
+  8000cb:	c6 44 05 94 00       	movb   $0x0,-0x6c(%ebp,%eax,1)
+		if (strcmp(buf, msg) == 0)
+  8000d0:	83 ec 08             	sub    $0x8,%esp
+  8000d3:	ff 35 00 50 80 00    	push   0x805000
+  8000d9:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8000dc:	50                   	push   %eax
+  8000dd:	e8 cd 09 00 00       	call   800aaf <strcmp>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	85 c0                	test   %eax,%eax
+  8000e7:	0f 85 bf 00 00 00    	jne    8001ac <umain+0x179>
+			cprintf("\npipe read closed properly\n");
+  8000ed:	83 ec 0c             	sub    $0xc,%esp
+  8000f0:	68 b1 3a 80 00       	push   $0x803ab1
+  8000f5:	e8 16 03 00 00       	call   800410 <cprintf>
+  8000fa:	83 c4 10             	add    $0x10,%esp
+		else
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+		exit();
+  8000fd:	e8 19 02 00 00       	call   80031b <exit>
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+			panic("write: %e", i);
+		close(p[1]);
+	}
+	wait(pid);
+  800102:	83 ec 0c             	sub    $0xc,%esp
+  800105:	53                   	push   %ebx
+  800106:	e8 5c 32 00 00       	call   803367 <wait>
+
+	binaryname = "pipewriteeof";
+  80010b:	c7 05 04 50 80 00 07 	movl   $0x803b07,0x805004
+  800112:	3b 80 00 
+	if ((i = pipe(p)) < 0)
+  800115:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800118:	89 04 24             	mov    %eax,(%esp)
+  80011b:	e8 ca 30 00 00       	call   8031ea <pipe>
+  800120:	89 c6                	mov    %eax,%esi
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	0f 88 32 01 00 00    	js     80025f <umain+0x22c>
+		panic("pipe: %e", i);
+
+	if ((pid = fork()) < 0)
+  80012d:	e8 33 12 00 00       	call   801365 <fork>
+  800132:	89 c3                	mov    %eax,%ebx
+  800134:	85 c0                	test   %eax,%eax
+  800136:	0f 88 35 01 00 00    	js     800271 <umain+0x23e>
+		panic("fork: %e", i);
+
+	if (pid == 0) {
+  80013c:	0f 84 41 01 00 00    	je     800283 <umain+0x250>
+				break;
+		}
+		cprintf("\npipe write closed properly\n");
+		exit();
+	}
+	close(p[0]);
+  800142:	83 ec 0c             	sub    $0xc,%esp
+  800145:	ff 75 8c             	push   -0x74(%ebp)
+  800148:	e8 7a 15 00 00       	call   8016c7 <close>
+	close(p[1]);
+  80014d:	83 c4 04             	add    $0x4,%esp
+  800150:	ff 75 90             	push   -0x70(%ebp)
+  800153:	e8 6f 15 00 00       	call   8016c7 <close>
+	wait(pid);
+  800158:	89 1c 24             	mov    %ebx,(%esp)
+  80015b:	e8 07 32 00 00       	call   803367 <wait>
+
+	cprintf("pipe tests passed\n");
+  800160:	c7 04 24 35 3b 80 00 	movl   $0x803b35,(%esp)
+  800167:	e8 a4 02 00 00       	call   800410 <cprintf>
+}
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800172:	5b                   	pop    %ebx
+  800173:	5e                   	pop    %esi
+  800174:	5d                   	pop    %ebp
+  800175:	c3                   	ret
+		panic("pipe: %e", i);
+  800176:	50                   	push   %eax
+  800177:	68 4c 3a 80 00       	push   $0x803a4c
+  80017c:	6a 0e                	push   $0xe
+  80017e:	68 55 3a 80 00       	push   $0x803a55
+  800183:	e8 ad 01 00 00       	call   800335 <_panic>
+		panic("fork: %e", i);
+  800188:	56                   	push   %esi
+  800189:	68 65 3a 80 00       	push   $0x803a65
+  80018e:	6a 11                	push   $0x11
+  800190:	68 55 3a 80 00       	push   $0x803a55
+  800195:	e8 9b 01 00 00       	call   800335 <_panic>
+			panic("read: %e", i);
+  80019a:	50                   	push   %eax
+  80019b:	68 a8 3a 80 00       	push   $0x803aa8
+  8001a0:	6a 19                	push   $0x19
+  8001a2:	68 55 3a 80 00       	push   $0x803a55
+  8001a7:	e8 89 01 00 00       	call   800335 <_panic>
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+  8001ac:	83 ec 04             	sub    $0x4,%esp
+  8001af:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8001b2:	50                   	push   %eax
+  8001b3:	56                   	push   %esi
+  8001b4:	68 cd 3a 80 00       	push   $0x803acd
+  8001b9:	e8 52 02 00 00       	call   800410 <cprintf>
+  8001be:	83 c4 10             	add    $0x10,%esp
+  8001c1:	e9 37 ff ff ff       	jmp    8000fd <umain+0xca>
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  8001c6:	a1 00 60 80 00       	mov    0x806000,%eax
+  8001cb:	8b 40 48             	mov    0x48(%eax),%eax
+  8001ce:	83 ec 04             	sub    $0x4,%esp
+  8001d1:	ff 75 8c             	push   -0x74(%ebp)
+  8001d4:	50                   	push   %eax
+  8001d5:	68 6e 3a 80 00       	push   $0x803a6e
+  8001da:	e8 31 02 00 00       	call   800410 <cprintf>
+		close(p[0]);
+  8001df:	83 c4 04             	add    $0x4,%esp
+  8001e2:	ff 75 8c             	push   -0x74(%ebp)
+  8001e5:	e8 dd 14 00 00       	call   8016c7 <close>
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  8001ea:	a1 00 60 80 00       	mov    0x806000,%eax
+  8001ef:	8b 40 48             	mov    0x48(%eax),%eax
+  8001f2:	83 c4 0c             	add    $0xc,%esp
+  8001f5:	ff 75 90             	push   -0x70(%ebp)
+  8001f8:	50                   	push   %eax
+  8001f9:	68 e0 3a 80 00       	push   $0x803ae0
+  8001fe:	e8 0d 02 00 00       	call   800410 <cprintf>
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  800203:	83 c4 04             	add    $0x4,%esp
+  800206:	ff 35 00 50 80 00    	push   0x805000
+  80020c:	e8 b2 07 00 00       	call   8009c3 <strlen>
+  800211:	83 c4 0c             	add    $0xc,%esp
+  800214:	50                   	push   %eax
+  800215:	ff 35 00 50 80 00    	push   0x805000
+  80021b:	ff 75 90             	push   -0x70(%ebp)
+  80021e:	e8 ae 16 00 00       	call   8018d1 <write>
+  800223:	89 c6                	mov    %eax,%esi
+  800225:	83 c4 04             	add    $0x4,%esp
+  800228:	ff 35 00 50 80 00    	push   0x805000
+  80022e:	e8 90 07 00 00       	call   8009c3 <strlen>
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	39 f0                	cmp    %esi,%eax
+  800238:	75 13                	jne    80024d <umain+0x21a>
+		close(p[1]);
+  80023a:	83 ec 0c             	sub    $0xc,%esp
+  80023d:	ff 75 90             	push   -0x70(%ebp)
+  800240:	e8 82 14 00 00       	call   8016c7 <close>
+  800245:	83 c4 10             	add    $0x10,%esp
+  800248:	e9 b5 fe ff ff       	jmp    800102 <umain+0xcf>
+			panic("write: %e", i);
+  80024d:	56                   	push   %esi
+  80024e:	68 fd 3a 80 00       	push   $0x803afd
+  800253:	6a 25                	push   $0x25
+  800255:	68 55 3a 80 00       	push   $0x803a55
+  80025a:	e8 d6 00 00 00       	call   800335 <_panic>
+		panic("pipe: %e", i);
+  80025f:	50                   	push   %eax
+  800260:	68 4c 3a 80 00       	push   $0x803a4c
+  800265:	6a 2c                	push   $0x2c
+  800267:	68 55 3a 80 00       	push   $0x803a55
+  80026c:	e8 c4 00 00 00       	call   800335 <_panic>
+		panic("fork: %e", i);
+  800271:	56                   	push   %esi
+  800272:	68 65 3a 80 00       	push   $0x803a65
+  800277:	6a 2f                	push   $0x2f
+  800279:	68 55 3a 80 00       	push   $0x803a55
+  80027e:	e8 b2 00 00 00       	call   800335 <_panic>
+		close(p[0]);
+  800283:	83 ec 0c             	sub    $0xc,%esp
+  800286:	ff 75 8c             	push   -0x74(%ebp)
+  800289:	e8 39 14 00 00       	call   8016c7 <close>
+  80028e:	83 c4 10             	add    $0x10,%esp
+			cprintf(".");
+  800291:	83 ec 0c             	sub    $0xc,%esp
+  800294:	68 14 3b 80 00       	push   $0x803b14
+  800299:	e8 72 01 00 00       	call   800410 <cprintf>
+			if (write(p[1], "x", 1) != 1)
+  80029e:	83 c4 0c             	add    $0xc,%esp
+  8002a1:	6a 01                	push   $0x1
+  8002a3:	68 16 3b 80 00       	push   $0x803b16
+  8002a8:	ff 75 90             	push   -0x70(%ebp)
+  8002ab:	e8 21 16 00 00       	call   8018d1 <write>
+  8002b0:	83 c4 10             	add    $0x10,%esp
+  8002b3:	83 f8 01             	cmp    $0x1,%eax
+  8002b6:	74 d9                	je     800291 <umain+0x25e>
+		cprintf("\npipe write closed properly\n");
+  8002b8:	83 ec 0c             	sub    $0xc,%esp
+  8002bb:	68 18 3b 80 00       	push   $0x803b18
+  8002c0:	e8 4b 01 00 00       	call   800410 <cprintf>
+		exit();
+  8002c5:	e8 51 00 00 00       	call   80031b <exit>
+  8002ca:	83 c4 10             	add    $0x10,%esp
+  8002cd:	e9 70 fe ff ff       	jmp    800142 <umain+0x10f>
+
+008002d2 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	56                   	push   %esi
+  8002d6:	53                   	push   %ebx
+  8002d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002da:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8002dd:	e8 e2 0a 00 00       	call   800dc4 <sys_getenvid>
+  8002e2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002e7:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8002ed:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002f2:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002f7:	85 db                	test   %ebx,%ebx
+  8002f9:	7e 07                	jle    800302 <libmain+0x30>
+		binaryname = argv[0];
+  8002fb:	8b 06                	mov    (%esi),%eax
+  8002fd:	a3 04 50 80 00       	mov    %eax,0x805004
+
+	// call user main routine
+	umain(argc, argv);
+  800302:	83 ec 08             	sub    $0x8,%esp
+  800305:	56                   	push   %esi
+  800306:	53                   	push   %ebx
+  800307:	e8 27 fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80030c:	e8 0a 00 00 00       	call   80031b <exit>
+}
+  800311:	83 c4 10             	add    $0x10,%esp
+  800314:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800317:	5b                   	pop    %ebx
+  800318:	5e                   	pop    %esi
+  800319:	5d                   	pop    %ebp
+  80031a:	c3                   	ret
+
+0080031b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80031b:	55                   	push   %ebp
+  80031c:	89 e5                	mov    %esp,%ebp
+  80031e:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800321:	e8 ce 13 00 00       	call   8016f4 <close_all>
+	sys_env_destroy(0);
+  800326:	83 ec 0c             	sub    $0xc,%esp
+  800329:	6a 00                	push   $0x0
+  80032b:	e8 4b 0a 00 00       	call   800d7b <sys_env_destroy>
+}
+  800330:	83 c4 10             	add    $0x10,%esp
+  800333:	c9                   	leave
+  800334:	c3                   	ret
+
+00800335 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800335:	55                   	push   %ebp
+  800336:	89 e5                	mov    %esp,%ebp
+  800338:	56                   	push   %esi
+  800339:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80033a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80033d:	8b 35 04 50 80 00    	mov    0x805004,%esi
+  800343:	e8 7c 0a 00 00       	call   800dc4 <sys_getenvid>
+  800348:	83 ec 0c             	sub    $0xc,%esp
+  80034b:	ff 75 0c             	push   0xc(%ebp)
+  80034e:	ff 75 08             	push   0x8(%ebp)
+  800351:	56                   	push   %esi
+  800352:	50                   	push   %eax
+  800353:	68 98 3b 80 00       	push   $0x803b98
+  800358:	e8 b3 00 00 00       	call   800410 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80035d:	83 c4 18             	add    $0x18,%esp
+  800360:	53                   	push   %ebx
+  800361:	ff 75 10             	push   0x10(%ebp)
+  800364:	e8 56 00 00 00       	call   8003bf <vcprintf>
+	cprintf("\n");
+  800369:	c7 04 24 89 3a 80 00 	movl   $0x803a89,(%esp)
+  800370:	e8 9b 00 00 00       	call   800410 <cprintf>
+  800375:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800378:	cc                   	int3
+	while (1)
+  800379:	eb fd                	jmp    800378 <_panic+0x43>
+
+0080037b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80037b:	55                   	push   %ebp
+  80037c:	89 e5                	mov    %esp,%ebp
+  80037e:	53                   	push   %ebx
+  80037f:	83 ec 04             	sub    $0x4,%esp
+  800382:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800385:	8b 13                	mov    (%ebx),%edx
+  800387:	8d 42 01             	lea    0x1(%edx),%eax
+  80038a:	89 03                	mov    %eax,(%ebx)
+  80038c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80038f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800393:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800398:	74 09                	je     8003a3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80039a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80039e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003a1:	c9                   	leave
+  8003a2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003a3:	83 ec 08             	sub    $0x8,%esp
+  8003a6:	68 ff 00 00 00       	push   $0xff
+  8003ab:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003ae:	50                   	push   %eax
+  8003af:	e8 7a 09 00 00       	call   800d2e <sys_cputs>
+		b->idx = 0;
+  8003b4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003ba:	83 c4 10             	add    $0x10,%esp
+  8003bd:	eb db                	jmp    80039a <putch+0x1f>
+
+008003bf <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003bf:	55                   	push   %ebp
+  8003c0:	89 e5                	mov    %esp,%ebp
+  8003c2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003c8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003cf:	00 00 00 
+	b.cnt = 0;
+  8003d2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003d9:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003dc:	ff 75 0c             	push   0xc(%ebp)
+  8003df:	ff 75 08             	push   0x8(%ebp)
+  8003e2:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003e8:	50                   	push   %eax
+  8003e9:	68 7b 03 80 00       	push   $0x80037b
+  8003ee:	e8 14 01 00 00       	call   800507 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003f3:	83 c4 08             	add    $0x8,%esp
+  8003f6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003fc:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800402:	50                   	push   %eax
+  800403:	e8 26 09 00 00       	call   800d2e <sys_cputs>
+
+	return b.cnt;
+}
+  800408:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80040e:	c9                   	leave
+  80040f:	c3                   	ret
+
+00800410 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800410:	55                   	push   %ebp
+  800411:	89 e5                	mov    %esp,%ebp
+  800413:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800416:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800419:	50                   	push   %eax
+  80041a:	ff 75 08             	push   0x8(%ebp)
+  80041d:	e8 9d ff ff ff       	call   8003bf <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800422:	c9                   	leave
+  800423:	c3                   	ret
+
+00800424 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800424:	55                   	push   %ebp
+  800425:	89 e5                	mov    %esp,%ebp
+  800427:	57                   	push   %edi
+  800428:	56                   	push   %esi
+  800429:	53                   	push   %ebx
+  80042a:	83 ec 1c             	sub    $0x1c,%esp
+  80042d:	89 c7                	mov    %eax,%edi
+  80042f:	89 d6                	mov    %edx,%esi
+  800431:	8b 45 08             	mov    0x8(%ebp),%eax
+  800434:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800437:	89 d1                	mov    %edx,%ecx
+  800439:	89 c2                	mov    %eax,%edx
+  80043b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80043e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800441:	8b 45 10             	mov    0x10(%ebp),%eax
+  800444:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800447:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800451:	39 c2                	cmp    %eax,%edx
+  800453:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800456:	72 3e                	jb     800496 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800458:	83 ec 0c             	sub    $0xc,%esp
+  80045b:	ff 75 18             	push   0x18(%ebp)
+  80045e:	83 eb 01             	sub    $0x1,%ebx
+  800461:	53                   	push   %ebx
+  800462:	50                   	push   %eax
+  800463:	83 ec 08             	sub    $0x8,%esp
+  800466:	ff 75 e4             	push   -0x1c(%ebp)
+  800469:	ff 75 e0             	push   -0x20(%ebp)
+  80046c:	ff 75 dc             	push   -0x24(%ebp)
+  80046f:	ff 75 d8             	push   -0x28(%ebp)
+  800472:	e8 43 34 00 00       	call   8038ba <__udivdi3>
+  800477:	83 c4 18             	add    $0x18,%esp
+  80047a:	52                   	push   %edx
+  80047b:	50                   	push   %eax
+  80047c:	89 f2                	mov    %esi,%edx
+  80047e:	89 f8                	mov    %edi,%eax
+  800480:	e8 9f ff ff ff       	call   800424 <printnum>
+  800485:	83 c4 20             	add    $0x20,%esp
+  800488:	eb 13                	jmp    80049d <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80048a:	83 ec 08             	sub    $0x8,%esp
+  80048d:	56                   	push   %esi
+  80048e:	ff 75 18             	push   0x18(%ebp)
+  800491:	ff d7                	call   *%edi
+  800493:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800496:	83 eb 01             	sub    $0x1,%ebx
+  800499:	85 db                	test   %ebx,%ebx
+  80049b:	7f ed                	jg     80048a <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80049d:	83 ec 08             	sub    $0x8,%esp
+  8004a0:	56                   	push   %esi
+  8004a1:	83 ec 04             	sub    $0x4,%esp
+  8004a4:	ff 75 e4             	push   -0x1c(%ebp)
+  8004a7:	ff 75 e0             	push   -0x20(%ebp)
+  8004aa:	ff 75 dc             	push   -0x24(%ebp)
+  8004ad:	ff 75 d8             	push   -0x28(%ebp)
+  8004b0:	e8 23 34 00 00       	call   8038d8 <__umoddi3>
+  8004b5:	83 c4 14             	add    $0x14,%esp
+  8004b8:	0f be 80 bb 3b 80 00 	movsbl 0x803bbb(%eax),%eax
+  8004bf:	50                   	push   %eax
+  8004c0:	ff d7                	call   *%edi
+}
+  8004c2:	83 c4 10             	add    $0x10,%esp
+  8004c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c8:	5b                   	pop    %ebx
+  8004c9:	5e                   	pop    %esi
+  8004ca:	5f                   	pop    %edi
+  8004cb:	5d                   	pop    %ebp
+  8004cc:	c3                   	ret
+
+008004cd <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004cd:	55                   	push   %ebp
+  8004ce:	89 e5                	mov    %esp,%ebp
+  8004d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8004d3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8004d7:	8b 10                	mov    (%eax),%edx
+  8004d9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004dc:	73 0a                	jae    8004e8 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8004de:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004e1:	89 08                	mov    %ecx,(%eax)
+  8004e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004e6:	88 02                	mov    %al,(%edx)
+}
+  8004e8:	5d                   	pop    %ebp
+  8004e9:	c3                   	ret
+
+008004ea <printfmt>:
+{
+  8004ea:	55                   	push   %ebp
+  8004eb:	89 e5                	mov    %esp,%ebp
+  8004ed:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004f0:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004f3:	50                   	push   %eax
+  8004f4:	ff 75 10             	push   0x10(%ebp)
+  8004f7:	ff 75 0c             	push   0xc(%ebp)
+  8004fa:	ff 75 08             	push   0x8(%ebp)
+  8004fd:	e8 05 00 00 00       	call   800507 <vprintfmt>
+}
+  800502:	83 c4 10             	add    $0x10,%esp
+  800505:	c9                   	leave
+  800506:	c3                   	ret
+
+00800507 <vprintfmt>:
+{
+  800507:	55                   	push   %ebp
+  800508:	89 e5                	mov    %esp,%ebp
+  80050a:	57                   	push   %edi
+  80050b:	56                   	push   %esi
+  80050c:	53                   	push   %ebx
+  80050d:	83 ec 2c             	sub    $0x2c,%esp
+  800510:	8b 75 08             	mov    0x8(%ebp),%esi
+  800513:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800516:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800519:	eb 0a                	jmp    800525 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80051b:	83 ec 08             	sub    $0x8,%esp
+  80051e:	53                   	push   %ebx
+  80051f:	50                   	push   %eax
+  800520:	ff d6                	call   *%esi
+  800522:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800525:	83 c7 01             	add    $0x1,%edi
+  800528:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80052c:	83 f8 25             	cmp    $0x25,%eax
+  80052f:	74 0c                	je     80053d <vprintfmt+0x36>
+			if (ch == '\0')
+  800531:	85 c0                	test   %eax,%eax
+  800533:	75 e6                	jne    80051b <vprintfmt+0x14>
+}
+  800535:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800538:	5b                   	pop    %ebx
+  800539:	5e                   	pop    %esi
+  80053a:	5f                   	pop    %edi
+  80053b:	5d                   	pop    %ebp
+  80053c:	c3                   	ret
+		padc = ' ';
+  80053d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800541:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800548:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80054f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800556:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80055b:	8d 47 01             	lea    0x1(%edi),%eax
+  80055e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800561:	0f b6 17             	movzbl (%edi),%edx
+  800564:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800567:	3c 55                	cmp    $0x55,%al
+  800569:	0f 87 cf 03 00 00    	ja     80093e <vprintfmt+0x437>
+  80056f:	0f b6 c0             	movzbl %al,%eax
+  800572:	ff 24 85 20 3d 80 00 	jmp    *0x803d20(,%eax,4)
+  800579:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80057c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800580:	eb d9                	jmp    80055b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800582:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800585:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800589:	eb d0                	jmp    80055b <vprintfmt+0x54>
+  80058b:	0f b6 d2             	movzbl %dl,%edx
+  80058e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800591:	b8 00 00 00 00       	mov    $0x0,%eax
+  800596:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800599:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80059c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8005a0:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8005a3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005a6:	83 f9 09             	cmp    $0x9,%ecx
+  8005a9:	77 55                	ja     800600 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8005ab:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005ae:	eb e9                	jmp    800599 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8005b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b3:	8b 00                	mov    (%eax),%eax
+  8005b5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005be:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8005c4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c8:	79 91                	jns    80055b <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8005ca:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005d7:	eb 82                	jmp    80055b <vprintfmt+0x54>
+			if (width < 0)
+  8005d9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005dc:	85 d2                	test   %edx,%edx
+  8005de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e3:	0f 49 c2             	cmovns %edx,%eax
+  8005e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005ec:	e9 6a ff ff ff       	jmp    80055b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8005f4:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005fb:	e9 5b ff ff ff       	jmp    80055b <vprintfmt+0x54>
+  800600:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800603:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800606:	eb bc                	jmp    8005c4 <vprintfmt+0xbd>
+			lflag++;
+  800608:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80060b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80060e:	e9 48 ff ff ff       	jmp    80055b <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800613:	8b 45 14             	mov    0x14(%ebp),%eax
+  800616:	8d 78 04             	lea    0x4(%eax),%edi
+  800619:	83 ec 08             	sub    $0x8,%esp
+  80061c:	53                   	push   %ebx
+  80061d:	ff 30                	push   (%eax)
+  80061f:	ff d6                	call   *%esi
+			break;
+  800621:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800624:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800627:	e9 b1 02 00 00       	jmp    8008dd <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80062c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800632:	8b 10                	mov    (%eax),%edx
+  800634:	89 d0                	mov    %edx,%eax
+  800636:	f7 d8                	neg    %eax
+  800638:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80063b:	83 f8 11             	cmp    $0x11,%eax
+  80063e:	7f 23                	jg     800663 <vprintfmt+0x15c>
+  800640:	8b 14 85 80 3e 80 00 	mov    0x803e80(,%eax,4),%edx
+  800647:	85 d2                	test   %edx,%edx
+  800649:	74 18                	je     800663 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80064b:	52                   	push   %edx
+  80064c:	68 9e 3f 80 00       	push   $0x803f9e
+  800651:	53                   	push   %ebx
+  800652:	56                   	push   %esi
+  800653:	e8 92 fe ff ff       	call   8004ea <printfmt>
+  800658:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80065b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80065e:	e9 7a 02 00 00       	jmp    8008dd <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800663:	50                   	push   %eax
+  800664:	68 d3 3b 80 00       	push   $0x803bd3
+  800669:	53                   	push   %ebx
+  80066a:	56                   	push   %esi
+  80066b:	e8 7a fe ff ff       	call   8004ea <printfmt>
+  800670:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800673:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800676:	e9 62 02 00 00       	jmp    8008dd <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	83 c0 04             	add    $0x4,%eax
+  800681:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800689:	85 c9                	test   %ecx,%ecx
+  80068b:	b8 cc 3b 80 00       	mov    $0x803bcc,%eax
+  800690:	0f 45 c1             	cmovne %ecx,%eax
+  800693:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800696:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80069a:	7e 06                	jle    8006a2 <vprintfmt+0x19b>
+  80069c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006a0:	75 0b                	jne    8006ad <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006a2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006a5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006a8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006ab:	eb 5c                	jmp    800709 <vprintfmt+0x202>
+  8006ad:	83 ec 08             	sub    $0x8,%esp
+  8006b0:	ff 75 d0             	push   -0x30(%ebp)
+  8006b3:	ff 75 cc             	push   -0x34(%ebp)
+  8006b6:	e8 20 03 00 00       	call   8009db <strnlen>
+  8006bb:	89 c2                	mov    %eax,%edx
+  8006bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006c0:	29 d0                	sub    %edx,%eax
+  8006c2:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8006c5:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006cc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006cf:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006d1:	eb 0e                	jmp    8006e1 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8006d3:	83 ec 08             	sub    $0x8,%esp
+  8006d6:	53                   	push   %ebx
+  8006d7:	57                   	push   %edi
+  8006d8:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006db:	83 ee 01             	sub    $0x1,%esi
+  8006de:	83 c4 10             	add    $0x10,%esp
+  8006e1:	85 f6                	test   %esi,%esi
+  8006e3:	7f ee                	jg     8006d3 <vprintfmt+0x1cc>
+  8006e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006eb:	85 c0                	test   %eax,%eax
+  8006ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006f2:	0f 49 d0             	cmovns %eax,%edx
+  8006f5:	29 d0                	sub    %edx,%eax
+  8006f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006fa:	eb a6                	jmp    8006a2 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8006fc:	83 ec 08             	sub    $0x8,%esp
+  8006ff:	53                   	push   %ebx
+  800700:	52                   	push   %edx
+  800701:	ff 55 08             	call   *0x8(%ebp)
+  800704:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800707:	89 f1                	mov    %esi,%ecx
+  800709:	8d 71 01             	lea    0x1(%ecx),%esi
+  80070c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800710:	0f be d0             	movsbl %al,%edx
+  800713:	85 d2                	test   %edx,%edx
+  800715:	74 28                	je     80073f <vprintfmt+0x238>
+  800717:	85 ff                	test   %edi,%edi
+  800719:	78 05                	js     800720 <vprintfmt+0x219>
+  80071b:	83 ef 01             	sub    $0x1,%edi
+  80071e:	78 30                	js     800750 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800720:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800724:	74 d6                	je     8006fc <vprintfmt+0x1f5>
+  800726:	0f be c0             	movsbl %al,%eax
+  800729:	83 e8 20             	sub    $0x20,%eax
+  80072c:	83 f8 5e             	cmp    $0x5e,%eax
+  80072f:	76 cb                	jbe    8006fc <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800731:	83 ec 08             	sub    $0x8,%esp
+  800734:	53                   	push   %ebx
+  800735:	6a 3f                	push   $0x3f
+  800737:	ff 55 08             	call   *0x8(%ebp)
+  80073a:	83 c4 10             	add    $0x10,%esp
+  80073d:	eb c8                	jmp    800707 <vprintfmt+0x200>
+  80073f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800742:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800745:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800748:	01 d0                	add    %edx,%eax
+  80074a:	29 c8                	sub    %ecx,%eax
+  80074c:	89 c7                	mov    %eax,%edi
+  80074e:	eb 13                	jmp    800763 <vprintfmt+0x25c>
+  800750:	8b 75 08             	mov    0x8(%ebp),%esi
+  800753:	eb ed                	jmp    800742 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800755:	83 ec 08             	sub    $0x8,%esp
+  800758:	53                   	push   %ebx
+  800759:	6a 20                	push   $0x20
+  80075b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80075d:	83 ef 01             	sub    $0x1,%edi
+  800760:	83 c4 10             	add    $0x10,%esp
+  800763:	85 ff                	test   %edi,%edi
+  800765:	7f ee                	jg     800755 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800767:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80076a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076d:	e9 6b 01 00 00       	jmp    8008dd <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800772:	83 f9 01             	cmp    $0x1,%ecx
+  800775:	7f 1f                	jg     800796 <vprintfmt+0x28f>
+	else if (lflag)
+  800777:	85 c9                	test   %ecx,%ecx
+  800779:	74 67                	je     8007e2 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80077b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077e:	8b 00                	mov    (%eax),%eax
+  800780:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800783:	89 c1                	mov    %eax,%ecx
+  800785:	c1 f9 1f             	sar    $0x1f,%ecx
+  800788:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80078b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078e:	8d 40 04             	lea    0x4(%eax),%eax
+  800791:	89 45 14             	mov    %eax,0x14(%ebp)
+  800794:	eb 17                	jmp    8007ad <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800796:	8b 45 14             	mov    0x14(%ebp),%eax
+  800799:	8b 50 04             	mov    0x4(%eax),%edx
+  80079c:	8b 00                	mov    (%eax),%eax
+  80079e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007a1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a7:	8d 40 08             	lea    0x8(%eax),%eax
+  8007aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007ad:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007b0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007b3:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007b8:	85 c9                	test   %ecx,%ecx
+  8007ba:	0f 89 03 01 00 00    	jns    8008c3 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8007c0:	83 ec 08             	sub    $0x8,%esp
+  8007c3:	53                   	push   %ebx
+  8007c4:	6a 2d                	push   $0x2d
+  8007c6:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8007c8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007cb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007ce:	f7 da                	neg    %edx
+  8007d0:	83 d1 00             	adc    $0x0,%ecx
+  8007d3:	f7 d9                	neg    %ecx
+  8007d5:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007d8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007dd:	e9 e1 00 00 00       	jmp    8008c3 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8007e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e5:	8b 00                	mov    (%eax),%eax
+  8007e7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ea:	89 c1                	mov    %eax,%ecx
+  8007ec:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007ef:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007fb:	eb b0                	jmp    8007ad <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8007fd:	83 f9 01             	cmp    $0x1,%ecx
+  800800:	7f 1e                	jg     800820 <vprintfmt+0x319>
+	else if (lflag)
+  800802:	85 c9                	test   %ecx,%ecx
+  800804:	74 32                	je     800838 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800806:	8b 45 14             	mov    0x14(%ebp),%eax
+  800809:	8b 10                	mov    (%eax),%edx
+  80080b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800810:	8d 40 04             	lea    0x4(%eax),%eax
+  800813:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800816:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80081b:	e9 a3 00 00 00       	jmp    8008c3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800820:	8b 45 14             	mov    0x14(%ebp),%eax
+  800823:	8b 10                	mov    (%eax),%edx
+  800825:	8b 48 04             	mov    0x4(%eax),%ecx
+  800828:	8d 40 08             	lea    0x8(%eax),%eax
+  80082b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80082e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800833:	e9 8b 00 00 00       	jmp    8008c3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800838:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083b:	8b 10                	mov    (%eax),%edx
+  80083d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800842:	8d 40 04             	lea    0x4(%eax),%eax
+  800845:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800848:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80084d:	eb 74                	jmp    8008c3 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  80084f:	83 f9 01             	cmp    $0x1,%ecx
+  800852:	7f 1b                	jg     80086f <vprintfmt+0x368>
+	else if (lflag)
+  800854:	85 c9                	test   %ecx,%ecx
+  800856:	74 2c                	je     800884 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800858:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085b:	8b 10                	mov    (%eax),%edx
+  80085d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800862:	8d 40 04             	lea    0x4(%eax),%eax
+  800865:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800868:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80086d:	eb 54                	jmp    8008c3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  80086f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800872:	8b 10                	mov    (%eax),%edx
+  800874:	8b 48 04             	mov    0x4(%eax),%ecx
+  800877:	8d 40 08             	lea    0x8(%eax),%eax
+  80087a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80087d:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800882:	eb 3f                	jmp    8008c3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800884:	8b 45 14             	mov    0x14(%ebp),%eax
+  800887:	8b 10                	mov    (%eax),%edx
+  800889:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80088e:	8d 40 04             	lea    0x4(%eax),%eax
+  800891:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800894:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800899:	eb 28                	jmp    8008c3 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80089b:	83 ec 08             	sub    $0x8,%esp
+  80089e:	53                   	push   %ebx
+  80089f:	6a 30                	push   $0x30
+  8008a1:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8008a3:	83 c4 08             	add    $0x8,%esp
+  8008a6:	53                   	push   %ebx
+  8008a7:	6a 78                	push   $0x78
+  8008a9:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ae:	8b 10                	mov    (%eax),%edx
+  8008b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8008b5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008be:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8008c3:	83 ec 0c             	sub    $0xc,%esp
+  8008c6:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008ca:	50                   	push   %eax
+  8008cb:	ff 75 e0             	push   -0x20(%ebp)
+  8008ce:	57                   	push   %edi
+  8008cf:	51                   	push   %ecx
+  8008d0:	52                   	push   %edx
+  8008d1:	89 da                	mov    %ebx,%edx
+  8008d3:	89 f0                	mov    %esi,%eax
+  8008d5:	e8 4a fb ff ff       	call   800424 <printnum>
+			break;
+  8008da:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8008dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008e0:	e9 40 fc ff ff       	jmp    800525 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8008e5:	83 f9 01             	cmp    $0x1,%ecx
+  8008e8:	7f 1b                	jg     800905 <vprintfmt+0x3fe>
+	else if (lflag)
+  8008ea:	85 c9                	test   %ecx,%ecx
+  8008ec:	74 2c                	je     80091a <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8008ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f1:	8b 10                	mov    (%eax),%edx
+  8008f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008fe:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800903:	eb be                	jmp    8008c3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800905:	8b 45 14             	mov    0x14(%ebp),%eax
+  800908:	8b 10                	mov    (%eax),%edx
+  80090a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80090d:	8d 40 08             	lea    0x8(%eax),%eax
+  800910:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800913:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800918:	eb a9                	jmp    8008c3 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80091a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091d:	8b 10                	mov    (%eax),%edx
+  80091f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800924:	8d 40 04             	lea    0x4(%eax),%eax
+  800927:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80092a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80092f:	eb 92                	jmp    8008c3 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800931:	83 ec 08             	sub    $0x8,%esp
+  800934:	53                   	push   %ebx
+  800935:	6a 25                	push   $0x25
+  800937:	ff d6                	call   *%esi
+			break;
+  800939:	83 c4 10             	add    $0x10,%esp
+  80093c:	eb 9f                	jmp    8008dd <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80093e:	83 ec 08             	sub    $0x8,%esp
+  800941:	53                   	push   %ebx
+  800942:	6a 25                	push   $0x25
+  800944:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800946:	83 c4 10             	add    $0x10,%esp
+  800949:	89 f8                	mov    %edi,%eax
+  80094b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80094f:	74 05                	je     800956 <vprintfmt+0x44f>
+  800951:	83 e8 01             	sub    $0x1,%eax
+  800954:	eb f5                	jmp    80094b <vprintfmt+0x444>
+  800956:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800959:	eb 82                	jmp    8008dd <vprintfmt+0x3d6>
+
+0080095b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80095b:	55                   	push   %ebp
+  80095c:	89 e5                	mov    %esp,%ebp
+  80095e:	83 ec 18             	sub    $0x18,%esp
+  800961:	8b 45 08             	mov    0x8(%ebp),%eax
+  800964:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800967:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80096a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80096e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800971:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800978:	85 c0                	test   %eax,%eax
+  80097a:	74 26                	je     8009a2 <vsnprintf+0x47>
+  80097c:	85 d2                	test   %edx,%edx
+  80097e:	7e 22                	jle    8009a2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800980:	ff 75 14             	push   0x14(%ebp)
+  800983:	ff 75 10             	push   0x10(%ebp)
+  800986:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800989:	50                   	push   %eax
+  80098a:	68 cd 04 80 00       	push   $0x8004cd
+  80098f:	e8 73 fb ff ff       	call   800507 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800994:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800997:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80099a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80099d:	83 c4 10             	add    $0x10,%esp
+}
+  8009a0:	c9                   	leave
+  8009a1:	c3                   	ret
+		return -E_INVAL;
+  8009a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009a7:	eb f7                	jmp    8009a0 <vsnprintf+0x45>
+
+008009a9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009af:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009b2:	50                   	push   %eax
+  8009b3:	ff 75 10             	push   0x10(%ebp)
+  8009b6:	ff 75 0c             	push   0xc(%ebp)
+  8009b9:	ff 75 08             	push   0x8(%ebp)
+  8009bc:	e8 9a ff ff ff       	call   80095b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009c1:	c9                   	leave
+  8009c2:	c3                   	ret
+
+008009c3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009c3:	55                   	push   %ebp
+  8009c4:	89 e5                	mov    %esp,%ebp
+  8009c6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ce:	eb 03                	jmp    8009d3 <strlen+0x10>
+		n++;
+  8009d0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009d7:	75 f7                	jne    8009d0 <strlen+0xd>
+	return n;
+}
+  8009d9:	5d                   	pop    %ebp
+  8009da:	c3                   	ret
+
+008009db <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e9:	eb 03                	jmp    8009ee <strnlen+0x13>
+		n++;
+  8009eb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009ee:	39 d0                	cmp    %edx,%eax
+  8009f0:	74 08                	je     8009fa <strnlen+0x1f>
+  8009f2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009f6:	75 f3                	jne    8009eb <strnlen+0x10>
+  8009f8:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009fa:	89 d0                	mov    %edx,%eax
+  8009fc:	5d                   	pop    %ebp
+  8009fd:	c3                   	ret
+
+008009fe <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009fe:	55                   	push   %ebp
+  8009ff:	89 e5                	mov    %esp,%ebp
+  800a01:	53                   	push   %ebx
+  800a02:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a05:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a11:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a14:	83 c0 01             	add    $0x1,%eax
+  800a17:	84 d2                	test   %dl,%dl
+  800a19:	75 f2                	jne    800a0d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a1b:	89 c8                	mov    %ecx,%eax
+  800a1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a20:	c9                   	leave
+  800a21:	c3                   	ret
+
+00800a22 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a22:	55                   	push   %ebp
+  800a23:	89 e5                	mov    %esp,%ebp
+  800a25:	53                   	push   %ebx
+  800a26:	83 ec 10             	sub    $0x10,%esp
+  800a29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a2c:	53                   	push   %ebx
+  800a2d:	e8 91 ff ff ff       	call   8009c3 <strlen>
+  800a32:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a35:	ff 75 0c             	push   0xc(%ebp)
+  800a38:	01 d8                	add    %ebx,%eax
+  800a3a:	50                   	push   %eax
+  800a3b:	e8 be ff ff ff       	call   8009fe <strcpy>
+	return dst;
+}
+  800a40:	89 d8                	mov    %ebx,%eax
+  800a42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a45:	c9                   	leave
+  800a46:	c3                   	ret
+
+00800a47 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a47:	55                   	push   %ebp
+  800a48:	89 e5                	mov    %esp,%ebp
+  800a4a:	56                   	push   %esi
+  800a4b:	53                   	push   %ebx
+  800a4c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a4f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a52:	89 f3                	mov    %esi,%ebx
+  800a54:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a57:	89 f0                	mov    %esi,%eax
+  800a59:	eb 0f                	jmp    800a6a <strncpy+0x23>
+		*dst++ = *src;
+  800a5b:	83 c0 01             	add    $0x1,%eax
+  800a5e:	0f b6 0a             	movzbl (%edx),%ecx
+  800a61:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a64:	80 f9 01             	cmp    $0x1,%cl
+  800a67:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a6a:	39 d8                	cmp    %ebx,%eax
+  800a6c:	75 ed                	jne    800a5b <strncpy+0x14>
+	}
+	return ret;
+}
+  800a6e:	89 f0                	mov    %esi,%eax
+  800a70:	5b                   	pop    %ebx
+  800a71:	5e                   	pop    %esi
+  800a72:	5d                   	pop    %ebp
+  800a73:	c3                   	ret
+
+00800a74 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a74:	55                   	push   %ebp
+  800a75:	89 e5                	mov    %esp,%ebp
+  800a77:	56                   	push   %esi
+  800a78:	53                   	push   %ebx
+  800a79:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a7f:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a82:	89 f0                	mov    %esi,%eax
+  800a84:	85 d2                	test   %edx,%edx
+  800a86:	74 21                	je     800aa9 <strlcpy+0x35>
+  800a88:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a8c:	89 f2                	mov    %esi,%edx
+  800a8e:	eb 09                	jmp    800a99 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a90:	83 c1 01             	add    $0x1,%ecx
+  800a93:	83 c2 01             	add    $0x1,%edx
+  800a96:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a99:	39 c2                	cmp    %eax,%edx
+  800a9b:	74 09                	je     800aa6 <strlcpy+0x32>
+  800a9d:	0f b6 19             	movzbl (%ecx),%ebx
+  800aa0:	84 db                	test   %bl,%bl
+  800aa2:	75 ec                	jne    800a90 <strlcpy+0x1c>
+  800aa4:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800aa6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800aa9:	29 f0                	sub    %esi,%eax
+}
+  800aab:	5b                   	pop    %ebx
+  800aac:	5e                   	pop    %esi
+  800aad:	5d                   	pop    %ebp
+  800aae:	c3                   	ret
+
+00800aaf <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800aaf:	55                   	push   %ebp
+  800ab0:	89 e5                	mov    %esp,%ebp
+  800ab2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ab5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ab8:	eb 06                	jmp    800ac0 <strcmp+0x11>
+		p++, q++;
+  800aba:	83 c1 01             	add    $0x1,%ecx
+  800abd:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ac0:	0f b6 01             	movzbl (%ecx),%eax
+  800ac3:	84 c0                	test   %al,%al
+  800ac5:	74 04                	je     800acb <strcmp+0x1c>
+  800ac7:	3a 02                	cmp    (%edx),%al
+  800ac9:	74 ef                	je     800aba <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800acb:	0f b6 c0             	movzbl %al,%eax
+  800ace:	0f b6 12             	movzbl (%edx),%edx
+  800ad1:	29 d0                	sub    %edx,%eax
+}
+  800ad3:	5d                   	pop    %ebp
+  800ad4:	c3                   	ret
+
+00800ad5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ad5:	55                   	push   %ebp
+  800ad6:	89 e5                	mov    %esp,%ebp
+  800ad8:	53                   	push   %ebx
+  800ad9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800adc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800adf:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800ae2:	eb 09                	jmp    800aed <strncmp+0x18>
+		n--, p++, q++;
+  800ae4:	83 ea 01             	sub    $0x1,%edx
+  800ae7:	83 c0 01             	add    $0x1,%eax
+  800aea:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800aed:	85 d2                	test   %edx,%edx
+  800aef:	74 18                	je     800b09 <strncmp+0x34>
+  800af1:	0f b6 18             	movzbl (%eax),%ebx
+  800af4:	84 db                	test   %bl,%bl
+  800af6:	74 04                	je     800afc <strncmp+0x27>
+  800af8:	3a 19                	cmp    (%ecx),%bl
+  800afa:	74 e8                	je     800ae4 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800afc:	0f b6 00             	movzbl (%eax),%eax
+  800aff:	0f b6 11             	movzbl (%ecx),%edx
+  800b02:	29 d0                	sub    %edx,%eax
+}
+  800b04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b07:	c9                   	leave
+  800b08:	c3                   	ret
+		return 0;
+  800b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0e:	eb f4                	jmp    800b04 <strncmp+0x2f>
+
+00800b10 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b10:	55                   	push   %ebp
+  800b11:	89 e5                	mov    %esp,%ebp
+  800b13:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b16:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b1a:	eb 03                	jmp    800b1f <strchr+0xf>
+  800b1c:	83 c0 01             	add    $0x1,%eax
+  800b1f:	0f b6 10             	movzbl (%eax),%edx
+  800b22:	84 d2                	test   %dl,%dl
+  800b24:	74 06                	je     800b2c <strchr+0x1c>
+		if (*s == c)
+  800b26:	38 ca                	cmp    %cl,%dl
+  800b28:	75 f2                	jne    800b1c <strchr+0xc>
+  800b2a:	eb 05                	jmp    800b31 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b31:	5d                   	pop    %ebp
+  800b32:	c3                   	ret
+
+00800b33 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b33:	55                   	push   %ebp
+  800b34:	89 e5                	mov    %esp,%ebp
+  800b36:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b39:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b3d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b40:	38 ca                	cmp    %cl,%dl
+  800b42:	74 09                	je     800b4d <strfind+0x1a>
+  800b44:	84 d2                	test   %dl,%dl
+  800b46:	74 05                	je     800b4d <strfind+0x1a>
+	for (; *s; s++)
+  800b48:	83 c0 01             	add    $0x1,%eax
+  800b4b:	eb f0                	jmp    800b3d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b4d:	5d                   	pop    %ebp
+  800b4e:	c3                   	ret
+
+00800b4f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b4f:	55                   	push   %ebp
+  800b50:	89 e5                	mov    %esp,%ebp
+  800b52:	57                   	push   %edi
+  800b53:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b56:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b59:	85 c9                	test   %ecx,%ecx
+  800b5b:	74 20                	je     800b7d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b5d:	89 f8                	mov    %edi,%eax
+  800b5f:	09 c8                	or     %ecx,%eax
+  800b61:	a8 03                	test   $0x3,%al
+  800b63:	75 12                	jne    800b77 <memset+0x28>
+		c &= 0xFF;
+  800b65:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b69:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b6f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b72:	fc                   	cld
+  800b73:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b75:	eb 06                	jmp    800b7d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b77:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b7a:	fc                   	cld
+  800b7b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b7d:	89 f8                	mov    %edi,%eax
+  800b7f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b82:	c9                   	leave
+  800b83:	c3                   	ret
+
+00800b84 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b84:	55                   	push   %ebp
+  800b85:	89 e5                	mov    %esp,%ebp
+  800b87:	57                   	push   %edi
+  800b88:	56                   	push   %esi
+  800b89:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b8f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b92:	39 c6                	cmp    %eax,%esi
+  800b94:	73 32                	jae    800bc8 <memmove+0x44>
+  800b96:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b99:	39 d0                	cmp    %edx,%eax
+  800b9b:	73 2b                	jae    800bc8 <memmove+0x44>
+		s += n;
+		d += n;
+  800b9d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ba0:	89 d6                	mov    %edx,%esi
+  800ba2:	09 fe                	or     %edi,%esi
+  800ba4:	09 ce                	or     %ecx,%esi
+  800ba6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bac:	75 0e                	jne    800bbc <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bae:	83 ef 04             	sub    $0x4,%edi
+  800bb1:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bb4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bb7:	fd                   	std
+  800bb8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bba:	eb 09                	jmp    800bc5 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bbc:	83 ef 01             	sub    $0x1,%edi
+  800bbf:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bc2:	fd                   	std
+  800bc3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bc5:	fc                   	cld
+  800bc6:	eb 1a                	jmp    800be2 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bc8:	89 f2                	mov    %esi,%edx
+  800bca:	09 c2                	or     %eax,%edx
+  800bcc:	09 ca                	or     %ecx,%edx
+  800bce:	f6 c2 03             	test   $0x3,%dl
+  800bd1:	75 0a                	jne    800bdd <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bd3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bd6:	89 c7                	mov    %eax,%edi
+  800bd8:	fc                   	cld
+  800bd9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bdb:	eb 05                	jmp    800be2 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bdd:	89 c7                	mov    %eax,%edi
+  800bdf:	fc                   	cld
+  800be0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800be2:	5e                   	pop    %esi
+  800be3:	5f                   	pop    %edi
+  800be4:	5d                   	pop    %ebp
+  800be5:	c3                   	ret
+
+00800be6 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800be6:	55                   	push   %ebp
+  800be7:	89 e5                	mov    %esp,%ebp
+  800be9:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800bec:	ff 75 10             	push   0x10(%ebp)
+  800bef:	ff 75 0c             	push   0xc(%ebp)
+  800bf2:	ff 75 08             	push   0x8(%ebp)
+  800bf5:	e8 8a ff ff ff       	call   800b84 <memmove>
+}
+  800bfa:	c9                   	leave
+  800bfb:	c3                   	ret
+
+00800bfc <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bfc:	55                   	push   %ebp
+  800bfd:	89 e5                	mov    %esp,%ebp
+  800bff:	56                   	push   %esi
+  800c00:	53                   	push   %ebx
+  800c01:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c04:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c07:	89 c6                	mov    %eax,%esi
+  800c09:	03 75 10             	add    0x10(%ebp),%esi
+  800c0c:	eb 06                	jmp    800c14 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c0e:	83 c0 01             	add    $0x1,%eax
+  800c11:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c14:	39 f0                	cmp    %esi,%eax
+  800c16:	74 14                	je     800c2c <memcmp+0x30>
+		if (*s1 != *s2)
+  800c18:	0f b6 08             	movzbl (%eax),%ecx
+  800c1b:	0f b6 1a             	movzbl (%edx),%ebx
+  800c1e:	38 d9                	cmp    %bl,%cl
+  800c20:	74 ec                	je     800c0e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c22:	0f b6 c1             	movzbl %cl,%eax
+  800c25:	0f b6 db             	movzbl %bl,%ebx
+  800c28:	29 d8                	sub    %ebx,%eax
+  800c2a:	eb 05                	jmp    800c31 <memcmp+0x35>
+	}
+
+	return 0;
+  800c2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c31:	5b                   	pop    %ebx
+  800c32:	5e                   	pop    %esi
+  800c33:	5d                   	pop    %ebp
+  800c34:	c3                   	ret
+
+00800c35 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c35:	55                   	push   %ebp
+  800c36:	89 e5                	mov    %esp,%ebp
+  800c38:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c3e:	89 c2                	mov    %eax,%edx
+  800c40:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c43:	eb 03                	jmp    800c48 <memfind+0x13>
+  800c45:	83 c0 01             	add    $0x1,%eax
+  800c48:	39 d0                	cmp    %edx,%eax
+  800c4a:	73 04                	jae    800c50 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c4c:	38 08                	cmp    %cl,(%eax)
+  800c4e:	75 f5                	jne    800c45 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c50:	5d                   	pop    %ebp
+  800c51:	c3                   	ret
+
+00800c52 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c52:	55                   	push   %ebp
+  800c53:	89 e5                	mov    %esp,%ebp
+  800c55:	57                   	push   %edi
+  800c56:	56                   	push   %esi
+  800c57:	53                   	push   %ebx
+  800c58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c5e:	eb 03                	jmp    800c63 <strtol+0x11>
+		s++;
+  800c60:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c63:	0f b6 02             	movzbl (%edx),%eax
+  800c66:	3c 20                	cmp    $0x20,%al
+  800c68:	74 f6                	je     800c60 <strtol+0xe>
+  800c6a:	3c 09                	cmp    $0x9,%al
+  800c6c:	74 f2                	je     800c60 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c6e:	3c 2b                	cmp    $0x2b,%al
+  800c70:	74 2a                	je     800c9c <strtol+0x4a>
+	int neg = 0;
+  800c72:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c77:	3c 2d                	cmp    $0x2d,%al
+  800c79:	74 2b                	je     800ca6 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c7b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c81:	75 0f                	jne    800c92 <strtol+0x40>
+  800c83:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c86:	74 28                	je     800cb0 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c88:	85 db                	test   %ebx,%ebx
+  800c8a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c8f:	0f 44 d8             	cmove  %eax,%ebx
+  800c92:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c97:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c9a:	eb 46                	jmp    800ce2 <strtol+0x90>
+		s++;
+  800c9c:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ca4:	eb d5                	jmp    800c7b <strtol+0x29>
+		s++, neg = 1;
+  800ca6:	83 c2 01             	add    $0x1,%edx
+  800ca9:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cae:	eb cb                	jmp    800c7b <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cb0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cb4:	74 0e                	je     800cc4 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800cb6:	85 db                	test   %ebx,%ebx
+  800cb8:	75 d8                	jne    800c92 <strtol+0x40>
+		s++, base = 8;
+  800cba:	83 c2 01             	add    $0x1,%edx
+  800cbd:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cc2:	eb ce                	jmp    800c92 <strtol+0x40>
+		s += 2, base = 16;
+  800cc4:	83 c2 02             	add    $0x2,%edx
+  800cc7:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ccc:	eb c4                	jmp    800c92 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800cce:	0f be c0             	movsbl %al,%eax
+  800cd1:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800cd4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cd7:	7d 3a                	jge    800d13 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800cd9:	83 c2 01             	add    $0x1,%edx
+  800cdc:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ce0:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ce2:	0f b6 02             	movzbl (%edx),%eax
+  800ce5:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ce8:	89 f3                	mov    %esi,%ebx
+  800cea:	80 fb 09             	cmp    $0x9,%bl
+  800ced:	76 df                	jbe    800cce <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800cef:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cf2:	89 f3                	mov    %esi,%ebx
+  800cf4:	80 fb 19             	cmp    $0x19,%bl
+  800cf7:	77 08                	ja     800d01 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800cf9:	0f be c0             	movsbl %al,%eax
+  800cfc:	83 e8 57             	sub    $0x57,%eax
+  800cff:	eb d3                	jmp    800cd4 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d01:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d04:	89 f3                	mov    %esi,%ebx
+  800d06:	80 fb 19             	cmp    $0x19,%bl
+  800d09:	77 08                	ja     800d13 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d0b:	0f be c0             	movsbl %al,%eax
+  800d0e:	83 e8 37             	sub    $0x37,%eax
+  800d11:	eb c1                	jmp    800cd4 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d13:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d17:	74 05                	je     800d1e <strtol+0xcc>
+		*endptr = (char *) s;
+  800d19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d1c:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d1e:	89 c8                	mov    %ecx,%eax
+  800d20:	f7 d8                	neg    %eax
+  800d22:	85 ff                	test   %edi,%edi
+  800d24:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d27:	89 c8                	mov    %ecx,%eax
+  800d29:	5b                   	pop    %ebx
+  800d2a:	5e                   	pop    %esi
+  800d2b:	5f                   	pop    %edi
+  800d2c:	5d                   	pop    %ebp
+  800d2d:	c3                   	ret
+
+00800d2e <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d2e:	55                   	push   %ebp
+  800d2f:	89 e5                	mov    %esp,%ebp
+  800d31:	57                   	push   %edi
+  800d32:	56                   	push   %esi
+  800d33:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d34:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3f:	89 c3                	mov    %eax,%ebx
+  800d41:	89 c7                	mov    %eax,%edi
+  800d43:	55                   	push   %ebp
+  800d44:	89 e5                	mov    %esp,%ebp
+  800d46:	8d 35 4e 0d 80 00    	lea    0x800d4e,%esi
+  800d4c:	0f 34                	sysenter
+  800d4e:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800d4f:	5b                   	pop    %ebx
+  800d50:	5e                   	pop    %esi
+  800d51:	5f                   	pop    %edi
+  800d52:	5d                   	pop    %ebp
+  800d53:	c3                   	ret
+
+00800d54 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d54:	55                   	push   %ebp
+  800d55:	89 e5                	mov    %esp,%ebp
+  800d57:	57                   	push   %edi
+  800d58:	56                   	push   %esi
+  800d59:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d64:	89 d1                	mov    %edx,%ecx
+  800d66:	89 d3                	mov    %edx,%ebx
+  800d68:	89 d7                	mov    %edx,%edi
+  800d6a:	55                   	push   %ebp
+  800d6b:	89 e5                	mov    %esp,%ebp
+  800d6d:	8d 35 75 0d 80 00    	lea    0x800d75,%esi
+  800d73:	0f 34                	sysenter
+  800d75:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800d76:	5b                   	pop    %ebx
+  800d77:	5e                   	pop    %esi
+  800d78:	5f                   	pop    %edi
+  800d79:	5d                   	pop    %ebp
+  800d7a:	c3                   	ret
+
+00800d7b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d7b:	55                   	push   %ebp
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	57                   	push   %edi
+  800d7f:	56                   	push   %esi
+  800d80:	53                   	push   %ebx
+  800d81:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d91:	89 cb                	mov    %ecx,%ebx
+  800d93:	89 cf                	mov    %ecx,%edi
+  800d95:	55                   	push   %ebp
+  800d96:	89 e5                	mov    %esp,%ebp
+  800d98:	8d 35 a0 0d 80 00    	lea    0x800da0,%esi
+  800d9e:	0f 34                	sysenter
+  800da0:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800da1:	85 c0                	test   %eax,%eax
+  800da3:	7f 08                	jg     800dad <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800da5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da8:	5b                   	pop    %ebx
+  800da9:	5e                   	pop    %esi
+  800daa:	5f                   	pop    %edi
+  800dab:	5d                   	pop    %ebp
+  800dac:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dad:	83 ec 0c             	sub    $0xc,%esp
+  800db0:	50                   	push   %eax
+  800db1:	6a 03                	push   $0x3
+  800db3:	68 e7 3e 80 00       	push   $0x803ee7
+  800db8:	6a 3d                	push   $0x3d
+  800dba:	68 04 3f 80 00       	push   $0x803f04
+  800dbf:	e8 71 f5 ff ff       	call   800335 <_panic>
+
+00800dc4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+  800dc7:	57                   	push   %edi
+  800dc8:	56                   	push   %esi
+  800dc9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800dca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcf:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dd4:	89 d1                	mov    %edx,%ecx
+  800dd6:	89 d3                	mov    %edx,%ebx
+  800dd8:	89 d7                	mov    %edx,%edi
+  800dda:	55                   	push   %ebp
+  800ddb:	89 e5                	mov    %esp,%ebp
+  800ddd:	8d 35 e5 0d 80 00    	lea    0x800de5,%esi
+  800de3:	0f 34                	sysenter
+  800de5:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800de6:	5b                   	pop    %ebx
+  800de7:	5e                   	pop    %esi
+  800de8:	5f                   	pop    %edi
+  800de9:	5d                   	pop    %ebp
+  800dea:	c3                   	ret
+
+00800deb <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800deb:	55                   	push   %ebp
+  800dec:	89 e5                	mov    %esp,%ebp
+  800dee:	57                   	push   %edi
+  800def:	56                   	push   %esi
+  800df0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800df1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dfb:	89 d1                	mov    %edx,%ecx
+  800dfd:	89 d3                	mov    %edx,%ebx
+  800dff:	89 d7                	mov    %edx,%edi
+  800e01:	89 d6                	mov    %edx,%esi
+  800e03:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e05:	5b                   	pop    %ebx
+  800e06:	5e                   	pop    %esi
+  800e07:	5f                   	pop    %edi
+  800e08:	5d                   	pop    %ebp
+  800e09:	c3                   	ret
+
+00800e0a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e0a:	55                   	push   %ebp
+  800e0b:	89 e5                	mov    %esp,%ebp
+  800e0d:	57                   	push   %edi
+  800e0e:	56                   	push   %esi
+  800e0f:	53                   	push   %ebx
+  800e10:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e19:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	8d 35 31 0e 80 00    	lea    0x800e31,%esi
+  800e2f:	0f 34                	sysenter
+  800e31:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e32:	85 c0                	test   %eax,%eax
+  800e34:	7f 08                	jg     800e3e <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800e36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e39:	5b                   	pop    %ebx
+  800e3a:	5e                   	pop    %esi
+  800e3b:	5f                   	pop    %edi
+  800e3c:	5d                   	pop    %ebp
+  800e3d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e3e:	83 ec 0c             	sub    $0xc,%esp
+  800e41:	50                   	push   %eax
+  800e42:	6a 04                	push   $0x4
+  800e44:	68 e7 3e 80 00       	push   $0x803ee7
+  800e49:	6a 3d                	push   $0x3d
+  800e4b:	68 04 3f 80 00       	push   $0x803f04
+  800e50:	e8 e0 f4 ff ff       	call   800335 <_panic>
+
+00800e55 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	57                   	push   %edi
+  800e59:	56                   	push   %esi
+  800e5a:	53                   	push   %ebx
+  800e5b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e64:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e69:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e6c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e6f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e72:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e74:	85 c0                	test   %eax,%eax
+  800e76:	7f 08                	jg     800e80 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7b:	5b                   	pop    %ebx
+  800e7c:	5e                   	pop    %esi
+  800e7d:	5f                   	pop    %edi
+  800e7e:	5d                   	pop    %ebp
+  800e7f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e80:	83 ec 0c             	sub    $0xc,%esp
+  800e83:	50                   	push   %eax
+  800e84:	6a 05                	push   $0x5
+  800e86:	68 e7 3e 80 00       	push   $0x803ee7
+  800e8b:	6a 23                	push   $0x23
+  800e8d:	68 04 3f 80 00       	push   $0x803f04
+  800e92:	e8 9e f4 ff ff       	call   800335 <_panic>
+
+00800e97 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	57                   	push   %edi
+  800e9b:	56                   	push   %esi
+  800e9c:	53                   	push   %ebx
+  800e9d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ea0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eab:	b8 06 00 00 00       	mov    $0x6,%eax
+  800eb0:	89 df                	mov    %ebx,%edi
+  800eb2:	55                   	push   %ebp
+  800eb3:	89 e5                	mov    %esp,%ebp
+  800eb5:	8d 35 bd 0e 80 00    	lea    0x800ebd,%esi
+  800ebb:	0f 34                	sysenter
+  800ebd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ebe:	85 c0                	test   %eax,%eax
+  800ec0:	7f 08                	jg     800eca <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800ec2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eca:	83 ec 0c             	sub    $0xc,%esp
+  800ecd:	50                   	push   %eax
+  800ece:	6a 06                	push   $0x6
+  800ed0:	68 e7 3e 80 00       	push   $0x803ee7
+  800ed5:	6a 3d                	push   $0x3d
+  800ed7:	68 04 3f 80 00       	push   $0x803f04
+  800edc:	e8 54 f4 ff ff       	call   800335 <_panic>
+
+00800ee1 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	57                   	push   %edi
+  800ee5:	56                   	push   %esi
+  800ee6:	53                   	push   %ebx
+  800ee7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800eea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef5:	b8 08 00 00 00       	mov    $0x8,%eax
+  800efa:	89 df                	mov    %ebx,%edi
+  800efc:	55                   	push   %ebp
+  800efd:	89 e5                	mov    %esp,%ebp
+  800eff:	8d 35 07 0f 80 00    	lea    0x800f07,%esi
+  800f05:	0f 34                	sysenter
+  800f07:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f08:	85 c0                	test   %eax,%eax
+  800f0a:	7f 08                	jg     800f14 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800f0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0f:	5b                   	pop    %ebx
+  800f10:	5e                   	pop    %esi
+  800f11:	5f                   	pop    %edi
+  800f12:	5d                   	pop    %ebp
+  800f13:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f14:	83 ec 0c             	sub    $0xc,%esp
+  800f17:	50                   	push   %eax
+  800f18:	6a 08                	push   $0x8
+  800f1a:	68 e7 3e 80 00       	push   $0x803ee7
+  800f1f:	6a 3d                	push   $0x3d
+  800f21:	68 04 3f 80 00       	push   $0x803f04
+  800f26:	e8 0a f4 ff ff       	call   800335 <_panic>
+
+00800f2b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	57                   	push   %edi
+  800f2f:	56                   	push   %esi
+  800f30:	53                   	push   %ebx
+  800f31:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f44:	89 df                	mov    %ebx,%edi
+  800f46:	55                   	push   %ebp
+  800f47:	89 e5                	mov    %esp,%ebp
+  800f49:	8d 35 51 0f 80 00    	lea    0x800f51,%esi
+  800f4f:	0f 34                	sysenter
+  800f51:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f52:	85 c0                	test   %eax,%eax
+  800f54:	7f 08                	jg     800f5e <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800f56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f59:	5b                   	pop    %ebx
+  800f5a:	5e                   	pop    %esi
+  800f5b:	5f                   	pop    %edi
+  800f5c:	5d                   	pop    %ebp
+  800f5d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5e:	83 ec 0c             	sub    $0xc,%esp
+  800f61:	50                   	push   %eax
+  800f62:	6a 09                	push   $0x9
+  800f64:	68 e7 3e 80 00       	push   $0x803ee7
+  800f69:	6a 3d                	push   $0x3d
+  800f6b:	68 04 3f 80 00       	push   $0x803f04
+  800f70:	e8 c0 f3 ff ff       	call   800335 <_panic>
+
+00800f75 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f75:	55                   	push   %ebp
+  800f76:	89 e5                	mov    %esp,%ebp
+  800f78:	57                   	push   %edi
+  800f79:	56                   	push   %esi
+  800f7a:	53                   	push   %ebx
+  800f7b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f89:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f8e:	89 df                	mov    %ebx,%edi
+  800f90:	55                   	push   %ebp
+  800f91:	89 e5                	mov    %esp,%ebp
+  800f93:	8d 35 9b 0f 80 00    	lea    0x800f9b,%esi
+  800f99:	0f 34                	sysenter
+  800f9b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f9c:	85 c0                	test   %eax,%eax
+  800f9e:	7f 08                	jg     800fa8 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800fa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa3:	5b                   	pop    %ebx
+  800fa4:	5e                   	pop    %esi
+  800fa5:	5f                   	pop    %edi
+  800fa6:	5d                   	pop    %ebp
+  800fa7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa8:	83 ec 0c             	sub    $0xc,%esp
+  800fab:	50                   	push   %eax
+  800fac:	6a 0a                	push   $0xa
+  800fae:	68 e7 3e 80 00       	push   $0x803ee7
+  800fb3:	6a 3d                	push   $0x3d
+  800fb5:	68 04 3f 80 00       	push   $0x803f04
+  800fba:	e8 76 f3 ff ff       	call   800335 <_panic>
+
+00800fbf <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fbf:	55                   	push   %ebp
+  800fc0:	89 e5                	mov    %esp,%ebp
+  800fc2:	57                   	push   %edi
+  800fc3:	56                   	push   %esi
+  800fc4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fd0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fd6:	55                   	push   %ebp
+  800fd7:	89 e5                	mov    %esp,%ebp
+  800fd9:	8d 35 e1 0f 80 00    	lea    0x800fe1,%esi
+  800fdf:	0f 34                	sysenter
+  800fe1:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800fe2:	5b                   	pop    %ebx
+  800fe3:	5e                   	pop    %esi
+  800fe4:	5f                   	pop    %edi
+  800fe5:	5d                   	pop    %ebp
+  800fe6:	c3                   	ret
+
+00800fe7 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800fe7:	55                   	push   %ebp
+  800fe8:	89 e5                	mov    %esp,%ebp
+  800fea:	57                   	push   %edi
+  800feb:	56                   	push   %esi
+  800fec:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fed:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff3:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ff8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ffb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ffe:	55                   	push   %ebp
+  800fff:	89 e5                	mov    %esp,%ebp
+  801001:	8d 35 09 10 80 00    	lea    0x801009,%esi
+  801007:	0f 34                	sysenter
+  801009:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  80100a:	5b                   	pop    %ebx
+  80100b:	5e                   	pop    %esi
+  80100c:	5f                   	pop    %edi
+  80100d:	5d                   	pop    %ebp
+  80100e:	c3                   	ret
+
+0080100f <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	57                   	push   %edi
+  801013:	56                   	push   %esi
+  801014:	53                   	push   %ebx
+  801015:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801018:	be 00 00 00 00       	mov    $0x0,%esi
+  80101d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801020:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801023:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801028:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80102b:	89 f7                	mov    %esi,%edi
+  80102d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80102f:	85 c0                	test   %eax,%eax
+  801031:	7f 08                	jg     80103b <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  801033:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801036:	5b                   	pop    %ebx
+  801037:	5e                   	pop    %esi
+  801038:	5f                   	pop    %edi
+  801039:	5d                   	pop    %ebp
+  80103a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80103b:	83 ec 0c             	sub    $0xc,%esp
+  80103e:	50                   	push   %eax
+  80103f:	6a 0d                	push   $0xd
+  801041:	68 e7 3e 80 00       	push   $0x803ee7
+  801046:	6a 23                	push   $0x23
+  801048:	68 04 3f 80 00       	push   $0x803f04
+  80104d:	e8 e3 f2 ff ff       	call   800335 <_panic>
+
+00801052 <sys_ipc_recv>:
+{
+  801052:	55                   	push   %ebp
+  801053:	89 e5                	mov    %esp,%ebp
+  801055:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  801058:	6a 00                	push   $0x0
+  80105a:	6a 01                	push   $0x1
+  80105c:	ff 75 08             	push   0x8(%ebp)
+  80105f:	e8 ab ff ff ff       	call   80100f <sys_ipc_recvv>
+}
+  801064:	c9                   	leave
+  801065:	c3                   	ret
+
+00801066 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  801066:	55                   	push   %ebp
+  801067:	89 e5                	mov    %esp,%ebp
+  801069:	57                   	push   %edi
+  80106a:	56                   	push   %esi
+  80106b:	53                   	push   %ebx
+  80106c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80106f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801074:	8b 55 08             	mov    0x8(%ebp),%edx
+  801077:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80107f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801082:	89 de                	mov    %ebx,%esi
+  801084:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801086:	85 c0                	test   %eax,%eax
+  801088:	7f 08                	jg     801092 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  80108a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108d:	5b                   	pop    %ebx
+  80108e:	5e                   	pop    %esi
+  80108f:	5f                   	pop    %edi
+  801090:	5d                   	pop    %ebp
+  801091:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801092:	83 ec 0c             	sub    $0xc,%esp
+  801095:	50                   	push   %eax
+  801096:	6a 0d                	push   $0xd
+  801098:	68 e7 3e 80 00       	push   $0x803ee7
+  80109d:	6a 23                	push   $0x23
+  80109f:	68 04 3f 80 00       	push   $0x803f04
+  8010a4:	e8 8c f2 ff ff       	call   800335 <_panic>
+
+008010a9 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8010a9:	55                   	push   %ebp
+  8010aa:	89 e5                	mov    %esp,%ebp
+  8010ac:	57                   	push   %edi
+  8010ad:	56                   	push   %esi
+  8010ae:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010b9:	89 d1                	mov    %edx,%ecx
+  8010bb:	89 d3                	mov    %edx,%ebx
+  8010bd:	89 d7                	mov    %edx,%edi
+  8010bf:	55                   	push   %ebp
+  8010c0:	89 e5                	mov    %esp,%ebp
+  8010c2:	8d 35 ca 10 80 00    	lea    0x8010ca,%esi
+  8010c8:	0f 34                	sysenter
+  8010ca:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  8010cb:	5b                   	pop    %ebx
+  8010cc:	5e                   	pop    %esi
+  8010cd:	5f                   	pop    %edi
+  8010ce:	5d                   	pop    %ebp
+  8010cf:	c3                   	ret
+
+008010d0 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  8010d0:	55                   	push   %ebp
+  8010d1:	89 e5                	mov    %esp,%ebp
+  8010d3:	57                   	push   %edi
+  8010d4:	56                   	push   %esi
+  8010d5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010e6:	89 df                	mov    %ebx,%edi
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	8d 35 f3 10 80 00    	lea    0x8010f3,%esi
+  8010f1:	0f 34                	sysenter
+  8010f3:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  8010f4:	5b                   	pop    %ebx
+  8010f5:	5e                   	pop    %esi
+  8010f6:	5f                   	pop    %edi
+  8010f7:	5d                   	pop    %ebp
+  8010f8:	c3                   	ret
+
+008010f9 <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  8010f9:	55                   	push   %ebp
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	57                   	push   %edi
+  8010fd:	56                   	push   %esi
+  8010fe:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801104:	8b 55 08             	mov    0x8(%ebp),%edx
+  801107:	b8 10 00 00 00       	mov    $0x10,%eax
+  80110c:	89 cb                	mov    %ecx,%ebx
+  80110e:	89 cf                	mov    %ecx,%edi
+  801110:	55                   	push   %ebp
+  801111:	89 e5                	mov    %esp,%ebp
+  801113:	8d 35 1b 11 80 00    	lea    0x80111b,%esi
+  801119:	0f 34                	sysenter
+  80111b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  80111c:	5b                   	pop    %ebx
+  80111d:	5e                   	pop    %esi
+  80111e:	5f                   	pop    %edi
+  80111f:	5d                   	pop    %ebp
+  801120:	c3                   	ret
+
+00801121 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  801121:	55                   	push   %ebp
+  801122:	89 e5                	mov    %esp,%ebp
+  801124:	57                   	push   %edi
+  801125:	56                   	push   %esi
+  801126:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801127:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801132:	b8 12 00 00 00       	mov    $0x12,%eax
+  801137:	89 df                	mov    %ebx,%edi
+  801139:	55                   	push   %ebp
+  80113a:	89 e5                	mov    %esp,%ebp
+  80113c:	8d 35 44 11 80 00    	lea    0x801144,%esi
+  801142:	0f 34                	sysenter
+  801144:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  801145:	5b                   	pop    %ebx
+  801146:	5e                   	pop    %esi
+  801147:	5f                   	pop    %edi
+  801148:	5d                   	pop    %ebp
+  801149:	c3                   	ret
+
+0080114a <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  80114a:	55                   	push   %ebp
+  80114b:	89 e5                	mov    %esp,%ebp
+  80114d:	57                   	push   %edi
+  80114e:	56                   	push   %esi
+  80114f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801150:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801155:	8b 55 08             	mov    0x8(%ebp),%edx
+  801158:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801160:	89 df                	mov    %ebx,%edi
+  801162:	55                   	push   %ebp
+  801163:	89 e5                	mov    %esp,%ebp
+  801165:	8d 35 6d 11 80 00    	lea    0x80116d,%esi
+  80116b:	0f 34                	sysenter
+  80116d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  80116e:	5b                   	pop    %ebx
+  80116f:	5e                   	pop    %esi
+  801170:	5f                   	pop    %edi
+  801171:	5d                   	pop    %ebp
+  801172:	c3                   	ret
+
+00801173 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  801173:	55                   	push   %ebp
+  801174:	89 e5                	mov    %esp,%ebp
+  801176:	57                   	push   %edi
+  801177:	56                   	push   %esi
+  801178:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801179:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801184:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801187:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80118a:	55                   	push   %ebp
+  80118b:	89 e5                	mov    %esp,%ebp
+  80118d:	8d 35 95 11 80 00    	lea    0x801195,%esi
+  801193:	0f 34                	sysenter
+  801195:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  801196:	5b                   	pop    %ebx
+  801197:	5e                   	pop    %esi
+  801198:	5f                   	pop    %edi
+  801199:	5d                   	pop    %ebp
+  80119a:	c3                   	ret
+
+0080119b <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  80119b:	55                   	push   %ebp
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	57                   	push   %edi
+  80119f:	56                   	push   %esi
+  8011a0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a9:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011ae:	89 cb                	mov    %ecx,%ebx
+  8011b0:	89 cf                	mov    %ecx,%edi
+  8011b2:	89 ce                	mov    %ecx,%esi
+  8011b4:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  8011b6:	5b                   	pop    %ebx
+  8011b7:	5e                   	pop    %esi
+  8011b8:	5f                   	pop    %edi
+  8011b9:	5d                   	pop    %ebp
+  8011ba:	c3                   	ret
+
+008011bb <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+  8011be:	57                   	push   %edi
+  8011bf:	56                   	push   %esi
+  8011c0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011ce:	89 cb                	mov    %ecx,%ebx
+  8011d0:	89 cf                	mov    %ecx,%edi
+  8011d2:	55                   	push   %ebp
+  8011d3:	89 e5                	mov    %esp,%ebp
+  8011d5:	8d 35 dd 11 80 00    	lea    0x8011dd,%esi
+  8011db:	0f 34                	sysenter
+  8011dd:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8011de:	5b                   	pop    %ebx
+  8011df:	5e                   	pop    %esi
+  8011e0:	5f                   	pop    %edi
+  8011e1:	5d                   	pop    %ebp
+  8011e2:	c3                   	ret
+
+008011e3 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8011e3:	55                   	push   %ebp
+  8011e4:	89 e5                	mov    %esp,%ebp
+  8011e6:	57                   	push   %edi
+  8011e7:	56                   	push   %esi
+  8011e8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f1:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011f6:	89 cb                	mov    %ecx,%ebx
+  8011f8:	89 cf                	mov    %ecx,%edi
+  8011fa:	55                   	push   %ebp
+  8011fb:	89 e5                	mov    %esp,%ebp
+  8011fd:	8d 35 05 12 80 00    	lea    0x801205,%esi
+  801203:	0f 34                	sysenter
+  801205:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  801206:	5b                   	pop    %ebx
+  801207:	5e                   	pop    %esi
+  801208:	5f                   	pop    %edi
+  801209:	5d                   	pop    %ebp
+  80120a:	c3                   	ret
+
+0080120b <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  80120b:	55                   	push   %ebp
+  80120c:	89 e5                	mov    %esp,%ebp
+  80120e:	57                   	push   %edi
+  80120f:	56                   	push   %esi
+  801210:	53                   	push   %ebx
+  801211:	83 ec 20             	sub    $0x20,%esp
+  801214:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801217:	89 d7                	mov    %edx,%edi
+  801219:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  80121b:	51                   	push   %ecx
+  80121c:	68 00 f0 7f 00       	push   $0x7ff000
+  801221:	6a 00                	push   $0x0
+  801223:	e8 e2 fb ff ff       	call   800e0a <sys_page_alloc>
+  801228:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80122a:	83 c4 10             	add    $0x10,%esp
+  80122d:	85 c0                	test   %eax,%eax
+  80122f:	78 45                	js     801276 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  801231:	83 ec 04             	sub    $0x4,%esp
+  801234:	68 00 10 00 00       	push   $0x1000
+  801239:	57                   	push   %edi
+  80123a:	68 00 f0 7f 00       	push   $0x7ff000
+  80123f:	e8 40 f9 ff ff       	call   800b84 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  801244:	89 34 24             	mov    %esi,(%esp)
+  801247:	57                   	push   %edi
+  801248:	ff 75 e4             	push   -0x1c(%ebp)
+  80124b:	68 00 f0 7f 00       	push   $0x7ff000
+  801250:	6a 00                	push   $0x0
+  801252:	e8 fe fb ff ff       	call   800e55 <sys_page_map>
+  801257:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  801259:	83 c4 20             	add    $0x20,%esp
+  80125c:	85 c0                	test   %eax,%eax
+  80125e:	78 16                	js     801276 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801260:	83 ec 08             	sub    $0x8,%esp
+  801263:	68 00 f0 7f 00       	push   $0x7ff000
+  801268:	6a 00                	push   $0x0
+  80126a:	e8 28 fc ff ff       	call   800e97 <sys_page_unmap>
+  80126f:	83 c4 10             	add    $0x10,%esp
+  801272:	85 c0                	test   %eax,%eax
+  801274:	75 0a                	jne    801280 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  801276:	89 d8                	mov    %ebx,%eax
+  801278:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127b:	5b                   	pop    %ebx
+  80127c:	5e                   	pop    %esi
+  80127d:	5f                   	pop    %edi
+  80127e:	5d                   	pop    %ebp
+  80127f:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801280:	68 14 3f 80 00       	push   $0x803f14
+  801285:	68 8c 3f 80 00       	push   $0x803f8c
+  80128a:	6a 1b                	push   $0x1b
+  80128c:	68 a1 3f 80 00       	push   $0x803fa1
+  801291:	e8 9f f0 ff ff       	call   800335 <_panic>
+
+00801296 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801296:	55                   	push   %ebp
+  801297:	89 e5                	mov    %esp,%ebp
+  801299:	53                   	push   %ebx
+  80129a:	83 ec 04             	sub    $0x4,%esp
+  80129d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8012a0:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8012a2:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  8012a6:	74 21                	je     8012c9 <pgfault+0x33>
+  8012a8:	89 d0                	mov    %edx,%eax
+  8012aa:	c1 e8 16             	shr    $0x16,%eax
+  8012ad:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012b4:	a8 01                	test   $0x1,%al
+  8012b6:	74 11                	je     8012c9 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  8012b8:	89 d0                	mov    %edx,%eax
+  8012ba:	c1 e8 0c             	shr    $0xc,%eax
+  8012bd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012c4:	f6 c4 08             	test   $0x8,%ah
+  8012c7:	75 17                	jne    8012e0 <pgfault+0x4a>
+		if (pgfault_next) {
+  8012c9:	a1 04 60 80 00       	mov    0x806004,%eax
+  8012ce:	85 c0                	test   %eax,%eax
+  8012d0:	74 27                	je     8012f9 <pgfault+0x63>
+			pgfault_next(utf);
+  8012d2:	83 ec 0c             	sub    $0xc,%esp
+  8012d5:	53                   	push   %ebx
+  8012d6:	ff d0                	call   *%eax
+			return;
+  8012d8:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8012db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012de:	c9                   	leave
+  8012df:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8012e0:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8012e6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8012eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f0:	e8 16 ff ff ff       	call   80120b <copy_page_to>
+  8012f5:	85 c0                	test   %eax,%eax
+  8012f7:	79 e2                	jns    8012db <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8012f9:	a1 00 60 80 00       	mov    0x806000,%eax
+  8012fe:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  801301:	ff 73 28             	push   0x28(%ebx)
+  801304:	ff 33                	push   (%ebx)
+  801306:	50                   	push   %eax
+  801307:	68 38 3f 80 00       	push   $0x803f38
+  80130c:	e8 ff f0 ff ff       	call   800410 <cprintf>
+	sys_env_destroy(0);
+  801311:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801318:	e8 5e fa ff ff       	call   800d7b <sys_env_destroy>
+  80131d:	83 c4 10             	add    $0x10,%esp
+  801320:	eb b9                	jmp    8012db <pgfault+0x45>
+
+00801322 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  801322:	55                   	push   %ebp
+  801323:	89 e5                	mov    %esp,%ebp
+  801325:	53                   	push   %ebx
+  801326:	83 ec 04             	sub    $0x4,%esp
+  801329:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80132c:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  801331:	3d 96 12 80 00       	cmp    $0x801296,%eax
+  801336:	74 15                	je     80134d <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  801338:	a3 04 60 80 00       	mov    %eax,0x806004
+		set_pgfault_handler(pgfault);
+  80133d:	83 ec 0c             	sub    $0xc,%esp
+  801340:	68 96 12 80 00       	push   $0x801296
+  801345:	e8 e3 21 00 00       	call   80352d <set_pgfault_handler>
+  80134a:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80134d:	83 ec 0c             	sub    $0xc,%esp
+  801350:	68 05 08 00 00       	push   $0x805
+  801355:	53                   	push   %ebx
+  801356:	6a 00                	push   $0x0
+  801358:	53                   	push   %ebx
+  801359:	6a 00                	push   $0x0
+  80135b:	e8 f5 fa ff ff       	call   800e55 <sys_page_map>
+}
+  801360:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801363:	c9                   	leave
+  801364:	c3                   	ret
+
+00801365 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801365:	55                   	push   %ebp
+  801366:	89 e5                	mov    %esp,%ebp
+  801368:	57                   	push   %edi
+  801369:	56                   	push   %esi
+  80136a:	53                   	push   %ebx
+  80136b:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80136e:	68 96 12 80 00       	push   $0x801296
+  801373:	e8 b5 21 00 00       	call   80352d <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801378:	b8 07 00 00 00       	mov    $0x7,%eax
+  80137d:	cd 30                	int    $0x30
+  80137f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801382:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  801385:	83 c4 10             	add    $0x10,%esp
+  801388:	85 c0                	test   %eax,%eax
+  80138a:	0f 88 6b 01 00 00    	js     8014fb <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801390:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  801395:	75 37                	jne    8013ce <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801397:	e8 28 fa ff ff       	call   800dc4 <sys_getenvid>
+  80139c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8013a1:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8013a7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8013ac:	a3 00 60 80 00       	mov    %eax,0x806000
+		return 0;
+  8013b1:	e9 45 01 00 00       	jmp    8014fb <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8013b6:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8013bc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013c2:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8013c8:	0f 87 ba 00 00 00    	ja     801488 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8013ce:	89 d8                	mov    %ebx,%eax
+  8013d0:	c1 e8 16             	shr    $0x16,%eax
+  8013d3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013da:	a8 01                	test   $0x1,%al
+  8013dc:	74 d8                	je     8013b6 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8013de:	89 d8                	mov    %ebx,%eax
+  8013e0:	c1 e8 0c             	shr    $0xc,%eax
+  8013e3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013ea:	f6 c2 01             	test   $0x1,%dl
+  8013ed:	74 cd                	je     8013bc <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8013ef:	89 da                	mov    %ebx,%edx
+  8013f1:	80 e6 df             	and    $0xdf,%dh
+  8013f4:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8013fa:	74 c0                	je     8013bc <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8013fc:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8013fe:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801405:	f6 c6 04             	test   $0x4,%dh
+  801408:	75 53                	jne    80145d <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80140a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801411:	f6 c6 08             	test   $0x8,%dh
+  801414:	75 0c                	jne    801422 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  801416:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80141d:	f6 c2 02             	test   $0x2,%dl
+  801420:	74 3b                	je     80145d <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  801422:	83 ec 0c             	sub    $0xc,%esp
+  801425:	68 05 08 00 00       	push   $0x805
+  80142a:	57                   	push   %edi
+  80142b:	ff 75 e4             	push   -0x1c(%ebp)
+  80142e:	57                   	push   %edi
+  80142f:	6a 00                	push   $0x0
+  801431:	e8 1f fa ff ff       	call   800e55 <sys_page_map>
+  801436:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801438:	83 c4 20             	add    $0x20,%esp
+  80143b:	85 c0                	test   %eax,%eax
+  80143d:	0f 88 a7 00 00 00    	js     8014ea <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801443:	83 ec 0c             	sub    $0xc,%esp
+  801446:	68 05 08 00 00       	push   $0x805
+  80144b:	57                   	push   %edi
+  80144c:	6a 00                	push   $0x0
+  80144e:	57                   	push   %edi
+  80144f:	6a 00                	push   $0x0
+  801451:	e8 ff f9 ff ff       	call   800e55 <sys_page_map>
+  801456:	89 c6                	mov    %eax,%esi
+	return r;
+  801458:	83 c4 20             	add    $0x20,%esp
+  80145b:	eb 21                	jmp    80147e <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  80145d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801464:	83 ec 0c             	sub    $0xc,%esp
+  801467:	25 07 0e 00 00       	and    $0xe07,%eax
+  80146c:	50                   	push   %eax
+  80146d:	57                   	push   %edi
+  80146e:	ff 75 e4             	push   -0x1c(%ebp)
+  801471:	57                   	push   %edi
+  801472:	6a 00                	push   $0x0
+  801474:	e8 dc f9 ff ff       	call   800e55 <sys_page_map>
+  801479:	89 c6                	mov    %eax,%esi
+  80147b:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  80147e:	85 f6                	test   %esi,%esi
+  801480:	0f 89 36 ff ff ff    	jns    8013bc <fork+0x57>
+  801486:	eb 62                	jmp    8014ea <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801488:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80148d:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  801492:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801495:	89 f8                	mov    %edi,%eax
+  801497:	e8 6f fd ff ff       	call   80120b <copy_page_to>
+  80149c:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80149e:	85 c0                	test   %eax,%eax
+  8014a0:	78 48                	js     8014ea <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8014a2:	83 ec 04             	sub    $0x4,%esp
+  8014a5:	6a 07                	push   $0x7
+  8014a7:	68 00 f0 bf ee       	push   $0xeebff000
+  8014ac:	57                   	push   %edi
+  8014ad:	e8 58 f9 ff ff       	call   800e0a <sys_page_alloc>
+  8014b2:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8014b4:	83 c4 10             	add    $0x10,%esp
+  8014b7:	85 c0                	test   %eax,%eax
+  8014b9:	78 2f                	js     8014ea <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8014bb:	a1 00 60 80 00       	mov    0x806000,%eax
+  8014c0:	8b 40 64             	mov    0x64(%eax),%eax
+  8014c3:	83 ec 08             	sub    $0x8,%esp
+  8014c6:	50                   	push   %eax
+  8014c7:	57                   	push   %edi
+  8014c8:	e8 a8 fa ff ff       	call   800f75 <sys_env_set_pgfault_upcall>
+  8014cd:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8014cf:	83 c4 10             	add    $0x10,%esp
+  8014d2:	85 c0                	test   %eax,%eax
+  8014d4:	78 14                	js     8014ea <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8014d6:	83 ec 08             	sub    $0x8,%esp
+  8014d9:	6a 02                	push   $0x2
+  8014db:	57                   	push   %edi
+  8014dc:	e8 00 fa ff ff       	call   800ee1 <sys_env_set_status>
+  8014e1:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8014e3:	83 c4 10             	add    $0x10,%esp
+  8014e6:	85 c0                	test   %eax,%eax
+  8014e8:	79 11                	jns    8014fb <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8014ea:	83 ec 0c             	sub    $0xc,%esp
+  8014ed:	ff 75 e0             	push   -0x20(%ebp)
+  8014f0:	e8 86 f8 ff ff       	call   800d7b <sys_env_destroy>
+	return r;
+  8014f5:	83 c4 10             	add    $0x10,%esp
+  8014f8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8014fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8014fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801501:	5b                   	pop    %ebx
+  801502:	5e                   	pop    %esi
+  801503:	5f                   	pop    %edi
+  801504:	5d                   	pop    %ebp
+  801505:	c3                   	ret
+
+00801506 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801506:	55                   	push   %ebp
+  801507:	89 e5                	mov    %esp,%ebp
+  801509:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80150c:	68 ac 3f 80 00       	push   $0x803fac
+  801511:	68 bf 00 00 00       	push   $0xbf
+  801516:	68 a1 3f 80 00       	push   $0x803fa1
+  80151b:	e8 15 ee ff ff       	call   800335 <_panic>
+
+00801520 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801520:	55                   	push   %ebp
+  801521:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801523:	8b 45 08             	mov    0x8(%ebp),%eax
+  801526:	05 00 00 00 30       	add    $0x30000000,%eax
+  80152b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80152e:	5d                   	pop    %ebp
+  80152f:	c3                   	ret
+
+00801530 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801530:	55                   	push   %ebp
+  801531:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801533:	8b 45 08             	mov    0x8(%ebp),%eax
+  801536:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80153b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801540:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801545:	5d                   	pop    %ebp
+  801546:	c3                   	ret
+
+00801547 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801547:	55                   	push   %ebp
+  801548:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80154a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80154f:	eb 02                	jmp    801553 <fd_alloc+0xc>
+  801551:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801553:	89 c2                	mov    %eax,%edx
+  801555:	c1 ea 16             	shr    $0x16,%edx
+  801558:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80155f:	f6 c2 01             	test   $0x1,%dl
+  801562:	74 2b                	je     80158f <fd_alloc+0x48>
+  801564:	89 c2                	mov    %eax,%edx
+  801566:	c1 ea 0c             	shr    $0xc,%edx
+  801569:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801570:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801576:	f6 c1 01             	test   $0x1,%cl
+  801579:	74 14                	je     80158f <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80157b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801581:	75 ce                	jne    801551 <fd_alloc+0xa>
+  801583:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801588:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80158d:	eb 05                	jmp    801594 <fd_alloc+0x4d>
+			return 0;
+  80158f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801594:	8b 55 08             	mov    0x8(%ebp),%edx
+  801597:	89 02                	mov    %eax,(%edx)
+}
+  801599:	89 c8                	mov    %ecx,%eax
+  80159b:	5d                   	pop    %ebp
+  80159c:	c3                   	ret
+
+0080159d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80159d:	55                   	push   %ebp
+  80159e:	89 e5                	mov    %esp,%ebp
+  8015a0:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8015a3:	83 f8 1f             	cmp    $0x1f,%eax
+  8015a6:	77 30                	ja     8015d8 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8015a8:	c1 e0 0c             	shl    $0xc,%eax
+  8015ab:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8015b0:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8015b6:	f6 c2 01             	test   $0x1,%dl
+  8015b9:	74 24                	je     8015df <fd_lookup+0x42>
+  8015bb:	89 c2                	mov    %eax,%edx
+  8015bd:	c1 ea 0c             	shr    $0xc,%edx
+  8015c0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015c7:	f6 c2 01             	test   $0x1,%dl
+  8015ca:	74 1a                	je     8015e6 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8015cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015cf:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8015d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015d6:	5d                   	pop    %ebp
+  8015d7:	c3                   	ret
+		return -E_INVAL;
+  8015d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015dd:	eb f7                	jmp    8015d6 <fd_lookup+0x39>
+		return -E_INVAL;
+  8015df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e4:	eb f0                	jmp    8015d6 <fd_lookup+0x39>
+  8015e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015eb:	eb e9                	jmp    8015d6 <fd_lookup+0x39>
+
+008015ed <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8015ed:	55                   	push   %ebp
+  8015ee:	89 e5                	mov    %esp,%ebp
+  8015f0:	53                   	push   %ebx
+  8015f1:	83 ec 04             	sub    $0x4,%esp
+  8015f4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8015f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fc:	eb 03                	jmp    801601 <dev_lookup+0x14>
+  8015fe:	83 c0 01             	add    $0x1,%eax
+  801601:	8b 1c 85 40 40 80 00 	mov    0x804040(,%eax,4),%ebx
+  801608:	85 db                	test   %ebx,%ebx
+  80160a:	74 0b                	je     801617 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80160c:	39 13                	cmp    %edx,(%ebx)
+  80160e:	75 ee                	jne    8015fe <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801610:	b8 00 00 00 00       	mov    $0x0,%eax
+  801615:	eb 1f                	jmp    801636 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801617:	a1 00 60 80 00       	mov    0x806000,%eax
+  80161c:	8b 40 48             	mov    0x48(%eax),%eax
+  80161f:	83 ec 04             	sub    $0x4,%esp
+  801622:	52                   	push   %edx
+  801623:	50                   	push   %eax
+  801624:	68 c4 3f 80 00       	push   $0x803fc4
+  801629:	e8 e2 ed ff ff       	call   800410 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80162e:	83 c4 10             	add    $0x10,%esp
+  801631:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801636:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801639:	89 1a                	mov    %ebx,(%edx)
+}
+  80163b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80163e:	c9                   	leave
+  80163f:	c3                   	ret
+
+00801640 <fd_close>:
+{
+  801640:	55                   	push   %ebp
+  801641:	89 e5                	mov    %esp,%ebp
+  801643:	57                   	push   %edi
+  801644:	56                   	push   %esi
+  801645:	53                   	push   %ebx
+  801646:	83 ec 24             	sub    $0x24,%esp
+  801649:	8b 75 08             	mov    0x8(%ebp),%esi
+  80164c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80164f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801652:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801653:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801659:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80165c:	50                   	push   %eax
+  80165d:	e8 3b ff ff ff       	call   80159d <fd_lookup>
+  801662:	89 c3                	mov    %eax,%ebx
+  801664:	83 c4 10             	add    $0x10,%esp
+  801667:	85 c0                	test   %eax,%eax
+  801669:	78 05                	js     801670 <fd_close+0x30>
+	    || fd != fd2)
+  80166b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80166e:	74 16                	je     801686 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801670:	89 f8                	mov    %edi,%eax
+  801672:	84 c0                	test   %al,%al
+  801674:	b8 00 00 00 00       	mov    $0x0,%eax
+  801679:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80167c:	89 d8                	mov    %ebx,%eax
+  80167e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801681:	5b                   	pop    %ebx
+  801682:	5e                   	pop    %esi
+  801683:	5f                   	pop    %edi
+  801684:	5d                   	pop    %ebp
+  801685:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801686:	83 ec 08             	sub    $0x8,%esp
+  801689:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80168c:	50                   	push   %eax
+  80168d:	ff 36                	push   (%esi)
+  80168f:	e8 59 ff ff ff       	call   8015ed <dev_lookup>
+  801694:	89 c3                	mov    %eax,%ebx
+  801696:	83 c4 10             	add    $0x10,%esp
+  801699:	85 c0                	test   %eax,%eax
+  80169b:	78 1a                	js     8016b7 <fd_close+0x77>
+		if (dev->dev_close)
+  80169d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016a0:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8016a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8016a8:	85 c0                	test   %eax,%eax
+  8016aa:	74 0b                	je     8016b7 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8016ac:	83 ec 0c             	sub    $0xc,%esp
+  8016af:	56                   	push   %esi
+  8016b0:	ff d0                	call   *%eax
+  8016b2:	89 c3                	mov    %eax,%ebx
+  8016b4:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8016b7:	83 ec 08             	sub    $0x8,%esp
+  8016ba:	56                   	push   %esi
+  8016bb:	6a 00                	push   $0x0
+  8016bd:	e8 d5 f7 ff ff       	call   800e97 <sys_page_unmap>
+	return r;
+  8016c2:	83 c4 10             	add    $0x10,%esp
+  8016c5:	eb b5                	jmp    80167c <fd_close+0x3c>
+
+008016c7 <close>:
+
+int
+close(int fdnum)
+{
+  8016c7:	55                   	push   %ebp
+  8016c8:	89 e5                	mov    %esp,%ebp
+  8016ca:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d0:	50                   	push   %eax
+  8016d1:	ff 75 08             	push   0x8(%ebp)
+  8016d4:	e8 c4 fe ff ff       	call   80159d <fd_lookup>
+  8016d9:	83 c4 10             	add    $0x10,%esp
+  8016dc:	85 c0                	test   %eax,%eax
+  8016de:	79 02                	jns    8016e2 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8016e0:	c9                   	leave
+  8016e1:	c3                   	ret
+		return fd_close(fd, 1);
+  8016e2:	83 ec 08             	sub    $0x8,%esp
+  8016e5:	6a 01                	push   $0x1
+  8016e7:	ff 75 f4             	push   -0xc(%ebp)
+  8016ea:	e8 51 ff ff ff       	call   801640 <fd_close>
+  8016ef:	83 c4 10             	add    $0x10,%esp
+  8016f2:	eb ec                	jmp    8016e0 <close+0x19>
+
+008016f4 <close_all>:
+
+void
+close_all(void)
+{
+  8016f4:	55                   	push   %ebp
+  8016f5:	89 e5                	mov    %esp,%ebp
+  8016f7:	53                   	push   %ebx
+  8016f8:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8016fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801700:	83 ec 0c             	sub    $0xc,%esp
+  801703:	53                   	push   %ebx
+  801704:	e8 be ff ff ff       	call   8016c7 <close>
+	for (i = 0; i < MAXFD; i++)
+  801709:	83 c3 01             	add    $0x1,%ebx
+  80170c:	83 c4 10             	add    $0x10,%esp
+  80170f:	83 fb 20             	cmp    $0x20,%ebx
+  801712:	75 ec                	jne    801700 <close_all+0xc>
+}
+  801714:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801717:	c9                   	leave
+  801718:	c3                   	ret
+
+00801719 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801719:	55                   	push   %ebp
+  80171a:	89 e5                	mov    %esp,%ebp
+  80171c:	57                   	push   %edi
+  80171d:	56                   	push   %esi
+  80171e:	53                   	push   %ebx
+  80171f:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801722:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801725:	50                   	push   %eax
+  801726:	ff 75 08             	push   0x8(%ebp)
+  801729:	e8 6f fe ff ff       	call   80159d <fd_lookup>
+  80172e:	89 c3                	mov    %eax,%ebx
+  801730:	83 c4 10             	add    $0x10,%esp
+  801733:	85 c0                	test   %eax,%eax
+  801735:	78 7f                	js     8017b6 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801737:	83 ec 0c             	sub    $0xc,%esp
+  80173a:	ff 75 0c             	push   0xc(%ebp)
+  80173d:	e8 85 ff ff ff       	call   8016c7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801742:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801745:	c1 e6 0c             	shl    $0xc,%esi
+  801748:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80174e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801751:	89 3c 24             	mov    %edi,(%esp)
+  801754:	e8 d7 fd ff ff       	call   801530 <fd2data>
+  801759:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80175b:	89 34 24             	mov    %esi,(%esp)
+  80175e:	e8 cd fd ff ff       	call   801530 <fd2data>
+  801763:	83 c4 10             	add    $0x10,%esp
+  801766:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801769:	89 d8                	mov    %ebx,%eax
+  80176b:	c1 e8 16             	shr    $0x16,%eax
+  80176e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801775:	a8 01                	test   $0x1,%al
+  801777:	74 11                	je     80178a <dup+0x71>
+  801779:	89 d8                	mov    %ebx,%eax
+  80177b:	c1 e8 0c             	shr    $0xc,%eax
+  80177e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801785:	f6 c2 01             	test   $0x1,%dl
+  801788:	75 36                	jne    8017c0 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80178a:	89 f8                	mov    %edi,%eax
+  80178c:	c1 e8 0c             	shr    $0xc,%eax
+  80178f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801796:	83 ec 0c             	sub    $0xc,%esp
+  801799:	25 07 0e 00 00       	and    $0xe07,%eax
+  80179e:	50                   	push   %eax
+  80179f:	56                   	push   %esi
+  8017a0:	6a 00                	push   $0x0
+  8017a2:	57                   	push   %edi
+  8017a3:	6a 00                	push   $0x0
+  8017a5:	e8 ab f6 ff ff       	call   800e55 <sys_page_map>
+  8017aa:	89 c3                	mov    %eax,%ebx
+  8017ac:	83 c4 20             	add    $0x20,%esp
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	78 33                	js     8017e6 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8017b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8017b6:	89 d8                	mov    %ebx,%eax
+  8017b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017bb:	5b                   	pop    %ebx
+  8017bc:	5e                   	pop    %esi
+  8017bd:	5f                   	pop    %edi
+  8017be:	5d                   	pop    %ebp
+  8017bf:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8017c0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017c7:	83 ec 0c             	sub    $0xc,%esp
+  8017ca:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017cf:	50                   	push   %eax
+  8017d0:	ff 75 d4             	push   -0x2c(%ebp)
+  8017d3:	6a 00                	push   $0x0
+  8017d5:	53                   	push   %ebx
+  8017d6:	6a 00                	push   $0x0
+  8017d8:	e8 78 f6 ff ff       	call   800e55 <sys_page_map>
+  8017dd:	89 c3                	mov    %eax,%ebx
+  8017df:	83 c4 20             	add    $0x20,%esp
+  8017e2:	85 c0                	test   %eax,%eax
+  8017e4:	79 a4                	jns    80178a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8017e6:	83 ec 08             	sub    $0x8,%esp
+  8017e9:	56                   	push   %esi
+  8017ea:	6a 00                	push   $0x0
+  8017ec:	e8 a6 f6 ff ff       	call   800e97 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8017f1:	83 c4 08             	add    $0x8,%esp
+  8017f4:	ff 75 d4             	push   -0x2c(%ebp)
+  8017f7:	6a 00                	push   $0x0
+  8017f9:	e8 99 f6 ff ff       	call   800e97 <sys_page_unmap>
+	return r;
+  8017fe:	83 c4 10             	add    $0x10,%esp
+  801801:	eb b3                	jmp    8017b6 <dup+0x9d>
+
+00801803 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801803:	55                   	push   %ebp
+  801804:	89 e5                	mov    %esp,%ebp
+  801806:	56                   	push   %esi
+  801807:	53                   	push   %ebx
+  801808:	83 ec 18             	sub    $0x18,%esp
+  80180b:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80180e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801811:	50                   	push   %eax
+  801812:	56                   	push   %esi
+  801813:	e8 85 fd ff ff       	call   80159d <fd_lookup>
+  801818:	83 c4 10             	add    $0x10,%esp
+  80181b:	85 c0                	test   %eax,%eax
+  80181d:	78 3c                	js     80185b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80181f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801822:	83 ec 08             	sub    $0x8,%esp
+  801825:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801828:	50                   	push   %eax
+  801829:	ff 33                	push   (%ebx)
+  80182b:	e8 bd fd ff ff       	call   8015ed <dev_lookup>
+  801830:	83 c4 10             	add    $0x10,%esp
+  801833:	85 c0                	test   %eax,%eax
+  801835:	78 24                	js     80185b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801837:	8b 43 08             	mov    0x8(%ebx),%eax
+  80183a:	83 e0 03             	and    $0x3,%eax
+  80183d:	83 f8 01             	cmp    $0x1,%eax
+  801840:	74 20                	je     801862 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801842:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801845:	8b 40 08             	mov    0x8(%eax),%eax
+  801848:	85 c0                	test   %eax,%eax
+  80184a:	74 37                	je     801883 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80184c:	83 ec 04             	sub    $0x4,%esp
+  80184f:	ff 75 10             	push   0x10(%ebp)
+  801852:	ff 75 0c             	push   0xc(%ebp)
+  801855:	53                   	push   %ebx
+  801856:	ff d0                	call   *%eax
+  801858:	83 c4 10             	add    $0x10,%esp
+}
+  80185b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80185e:	5b                   	pop    %ebx
+  80185f:	5e                   	pop    %esi
+  801860:	5d                   	pop    %ebp
+  801861:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801862:	a1 00 60 80 00       	mov    0x806000,%eax
+  801867:	8b 40 48             	mov    0x48(%eax),%eax
+  80186a:	83 ec 04             	sub    $0x4,%esp
+  80186d:	56                   	push   %esi
+  80186e:	50                   	push   %eax
+  80186f:	68 05 40 80 00       	push   $0x804005
+  801874:	e8 97 eb ff ff       	call   800410 <cprintf>
+		return -E_INVAL;
+  801879:	83 c4 10             	add    $0x10,%esp
+  80187c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801881:	eb d8                	jmp    80185b <read+0x58>
+		return -E_NOT_SUPP;
+  801883:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801888:	eb d1                	jmp    80185b <read+0x58>
+
+0080188a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80188a:	55                   	push   %ebp
+  80188b:	89 e5                	mov    %esp,%ebp
+  80188d:	57                   	push   %edi
+  80188e:	56                   	push   %esi
+  80188f:	53                   	push   %ebx
+  801890:	83 ec 0c             	sub    $0xc,%esp
+  801893:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801896:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801899:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189e:	eb 02                	jmp    8018a2 <readn+0x18>
+  8018a0:	01 c3                	add    %eax,%ebx
+  8018a2:	39 f3                	cmp    %esi,%ebx
+  8018a4:	73 21                	jae    8018c7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018a6:	83 ec 04             	sub    $0x4,%esp
+  8018a9:	89 f0                	mov    %esi,%eax
+  8018ab:	29 d8                	sub    %ebx,%eax
+  8018ad:	50                   	push   %eax
+  8018ae:	89 d8                	mov    %ebx,%eax
+  8018b0:	03 45 0c             	add    0xc(%ebp),%eax
+  8018b3:	50                   	push   %eax
+  8018b4:	57                   	push   %edi
+  8018b5:	e8 49 ff ff ff       	call   801803 <read>
+		if (m < 0)
+  8018ba:	83 c4 10             	add    $0x10,%esp
+  8018bd:	85 c0                	test   %eax,%eax
+  8018bf:	78 04                	js     8018c5 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8018c1:	75 dd                	jne    8018a0 <readn+0x16>
+  8018c3:	eb 02                	jmp    8018c7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8018c5:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8018c7:	89 d8                	mov    %ebx,%eax
+  8018c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018cc:	5b                   	pop    %ebx
+  8018cd:	5e                   	pop    %esi
+  8018ce:	5f                   	pop    %edi
+  8018cf:	5d                   	pop    %ebp
+  8018d0:	c3                   	ret
+
+008018d1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8018d1:	55                   	push   %ebp
+  8018d2:	89 e5                	mov    %esp,%ebp
+  8018d4:	56                   	push   %esi
+  8018d5:	53                   	push   %ebx
+  8018d6:	83 ec 18             	sub    $0x18,%esp
+  8018d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018dc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018df:	50                   	push   %eax
+  8018e0:	53                   	push   %ebx
+  8018e1:	e8 b7 fc ff ff       	call   80159d <fd_lookup>
+  8018e6:	83 c4 10             	add    $0x10,%esp
+  8018e9:	85 c0                	test   %eax,%eax
+  8018eb:	78 37                	js     801924 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018ed:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018f0:	83 ec 08             	sub    $0x8,%esp
+  8018f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018f6:	50                   	push   %eax
+  8018f7:	ff 36                	push   (%esi)
+  8018f9:	e8 ef fc ff ff       	call   8015ed <dev_lookup>
+  8018fe:	83 c4 10             	add    $0x10,%esp
+  801901:	85 c0                	test   %eax,%eax
+  801903:	78 1f                	js     801924 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801905:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801909:	74 20                	je     80192b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80190b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80190e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801911:	85 c0                	test   %eax,%eax
+  801913:	74 37                	je     80194c <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801915:	83 ec 04             	sub    $0x4,%esp
+  801918:	ff 75 10             	push   0x10(%ebp)
+  80191b:	ff 75 0c             	push   0xc(%ebp)
+  80191e:	56                   	push   %esi
+  80191f:	ff d0                	call   *%eax
+  801921:	83 c4 10             	add    $0x10,%esp
+}
+  801924:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801927:	5b                   	pop    %ebx
+  801928:	5e                   	pop    %esi
+  801929:	5d                   	pop    %ebp
+  80192a:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80192b:	a1 00 60 80 00       	mov    0x806000,%eax
+  801930:	8b 40 48             	mov    0x48(%eax),%eax
+  801933:	83 ec 04             	sub    $0x4,%esp
+  801936:	53                   	push   %ebx
+  801937:	50                   	push   %eax
+  801938:	68 21 40 80 00       	push   $0x804021
+  80193d:	e8 ce ea ff ff       	call   800410 <cprintf>
+		return -E_INVAL;
+  801942:	83 c4 10             	add    $0x10,%esp
+  801945:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194a:	eb d8                	jmp    801924 <write+0x53>
+		return -E_NOT_SUPP;
+  80194c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801951:	eb d1                	jmp    801924 <write+0x53>
+
+00801953 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801953:	55                   	push   %ebp
+  801954:	89 e5                	mov    %esp,%ebp
+  801956:	53                   	push   %ebx
+  801957:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80195a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80195d:	50                   	push   %eax
+  80195e:	ff 75 08             	push   0x8(%ebp)
+  801961:	e8 37 fc ff ff       	call   80159d <fd_lookup>
+  801966:	83 c4 10             	add    $0x10,%esp
+  801969:	85 c0                	test   %eax,%eax
+  80196b:	78 3a                	js     8019a7 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80196d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801970:	83 ec 08             	sub    $0x8,%esp
+  801973:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801976:	50                   	push   %eax
+  801977:	ff 33                	push   (%ebx)
+  801979:	e8 6f fc ff ff       	call   8015ed <dev_lookup>
+  80197e:	83 c4 10             	add    $0x10,%esp
+  801981:	85 c0                	test   %eax,%eax
+  801983:	78 22                	js     8019a7 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801985:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801988:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80198b:	85 c0                	test   %eax,%eax
+  80198d:	74 0d                	je     80199c <seek+0x49>
+  80198f:	83 ec 0c             	sub    $0xc,%esp
+  801992:	53                   	push   %ebx
+  801993:	ff d0                	call   *%eax
+  801995:	83 c4 10             	add    $0x10,%esp
+  801998:	85 c0                	test   %eax,%eax
+  80199a:	78 0b                	js     8019a7 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  80199c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80199f:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8019a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019aa:	c9                   	leave
+  8019ab:	c3                   	ret
+
+008019ac <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8019ac:	55                   	push   %ebp
+  8019ad:	89 e5                	mov    %esp,%ebp
+  8019af:	53                   	push   %ebx
+  8019b0:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019b3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019b6:	50                   	push   %eax
+  8019b7:	ff 75 08             	push   0x8(%ebp)
+  8019ba:	e8 de fb ff ff       	call   80159d <fd_lookup>
+  8019bf:	83 c4 10             	add    $0x10,%esp
+  8019c2:	85 c0                	test   %eax,%eax
+  8019c4:	78 2b                	js     8019f1 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019c6:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8019c9:	83 ec 08             	sub    $0x8,%esp
+  8019cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019cf:	50                   	push   %eax
+  8019d0:	ff 33                	push   (%ebx)
+  8019d2:	e8 16 fc ff ff       	call   8015ed <dev_lookup>
+  8019d7:	83 c4 10             	add    $0x10,%esp
+  8019da:	85 c0                	test   %eax,%eax
+  8019dc:	78 13                	js     8019f1 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8019de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019e1:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8019e4:	85 c0                	test   %eax,%eax
+  8019e6:	74 0e                	je     8019f6 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8019e8:	83 ec 0c             	sub    $0xc,%esp
+  8019eb:	53                   	push   %ebx
+  8019ec:	ff d0                	call   *%eax
+  8019ee:	83 c4 10             	add    $0x10,%esp
+}
+  8019f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019f4:	c9                   	leave
+  8019f5:	c3                   	ret
+		return 0;
+  8019f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fb:	eb f4                	jmp    8019f1 <fsync+0x45>
+
+008019fd <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8019fd:	55                   	push   %ebp
+  8019fe:	89 e5                	mov    %esp,%ebp
+  801a00:	56                   	push   %esi
+  801a01:	53                   	push   %ebx
+  801a02:	83 ec 18             	sub    $0x18,%esp
+  801a05:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a08:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a0b:	50                   	push   %eax
+  801a0c:	53                   	push   %ebx
+  801a0d:	e8 8b fb ff ff       	call   80159d <fd_lookup>
+  801a12:	83 c4 10             	add    $0x10,%esp
+  801a15:	85 c0                	test   %eax,%eax
+  801a17:	78 34                	js     801a4d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a19:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a1c:	83 ec 08             	sub    $0x8,%esp
+  801a1f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a22:	50                   	push   %eax
+  801a23:	ff 36                	push   (%esi)
+  801a25:	e8 c3 fb ff ff       	call   8015ed <dev_lookup>
+  801a2a:	83 c4 10             	add    $0x10,%esp
+  801a2d:	85 c0                	test   %eax,%eax
+  801a2f:	78 1c                	js     801a4d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a31:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a35:	74 1d                	je     801a54 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801a37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a3a:	8b 40 18             	mov    0x18(%eax),%eax
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	74 34                	je     801a75 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801a41:	83 ec 08             	sub    $0x8,%esp
+  801a44:	ff 75 0c             	push   0xc(%ebp)
+  801a47:	56                   	push   %esi
+  801a48:	ff d0                	call   *%eax
+  801a4a:	83 c4 10             	add    $0x10,%esp
+}
+  801a4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a50:	5b                   	pop    %ebx
+  801a51:	5e                   	pop    %esi
+  801a52:	5d                   	pop    %ebp
+  801a53:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801a54:	a1 00 60 80 00       	mov    0x806000,%eax
+  801a59:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a5c:	83 ec 04             	sub    $0x4,%esp
+  801a5f:	53                   	push   %ebx
+  801a60:	50                   	push   %eax
+  801a61:	68 e4 3f 80 00       	push   $0x803fe4
+  801a66:	e8 a5 e9 ff ff       	call   800410 <cprintf>
+		return -E_INVAL;
+  801a6b:	83 c4 10             	add    $0x10,%esp
+  801a6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a73:	eb d8                	jmp    801a4d <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a75:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a7a:	eb d1                	jmp    801a4d <ftruncate+0x50>
+
+00801a7c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a7c:	55                   	push   %ebp
+  801a7d:	89 e5                	mov    %esp,%ebp
+  801a7f:	56                   	push   %esi
+  801a80:	53                   	push   %ebx
+  801a81:	83 ec 18             	sub    $0x18,%esp
+  801a84:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a87:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a8a:	50                   	push   %eax
+  801a8b:	ff 75 08             	push   0x8(%ebp)
+  801a8e:	e8 0a fb ff ff       	call   80159d <fd_lookup>
+  801a93:	83 c4 10             	add    $0x10,%esp
+  801a96:	85 c0                	test   %eax,%eax
+  801a98:	78 49                	js     801ae3 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a9a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a9d:	83 ec 08             	sub    $0x8,%esp
+  801aa0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aa3:	50                   	push   %eax
+  801aa4:	ff 36                	push   (%esi)
+  801aa6:	e8 42 fb ff ff       	call   8015ed <dev_lookup>
+  801aab:	83 c4 10             	add    $0x10,%esp
+  801aae:	85 c0                	test   %eax,%eax
+  801ab0:	78 31                	js     801ae3 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801ab2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ab5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801ab9:	74 2f                	je     801aea <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801abb:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801abe:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801ac5:	00 00 00 
+	stat->st_isdir = 0;
+  801ac8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801acf:	00 00 00 
+	stat->st_dev = dev;
+  801ad2:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801ad8:	83 ec 08             	sub    $0x8,%esp
+  801adb:	53                   	push   %ebx
+  801adc:	56                   	push   %esi
+  801add:	ff 50 14             	call   *0x14(%eax)
+  801ae0:	83 c4 10             	add    $0x10,%esp
+}
+  801ae3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae6:	5b                   	pop    %ebx
+  801ae7:	5e                   	pop    %esi
+  801ae8:	5d                   	pop    %ebp
+  801ae9:	c3                   	ret
+		return -E_NOT_SUPP;
+  801aea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aef:	eb f2                	jmp    801ae3 <fstat+0x67>
+
+00801af1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801af1:	55                   	push   %ebp
+  801af2:	89 e5                	mov    %esp,%ebp
+  801af4:	56                   	push   %esi
+  801af5:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801af6:	83 ec 08             	sub    $0x8,%esp
+  801af9:	68 00 10 00 00       	push   $0x1000
+  801afe:	ff 75 08             	push   0x8(%ebp)
+  801b01:	e8 b3 07 00 00       	call   8022b9 <open>
+  801b06:	89 c3                	mov    %eax,%ebx
+  801b08:	83 c4 10             	add    $0x10,%esp
+  801b0b:	85 c0                	test   %eax,%eax
+  801b0d:	78 1b                	js     801b2a <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801b0f:	83 ec 08             	sub    $0x8,%esp
+  801b12:	ff 75 0c             	push   0xc(%ebp)
+  801b15:	50                   	push   %eax
+  801b16:	e8 61 ff ff ff       	call   801a7c <fstat>
+  801b1b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801b1d:	89 1c 24             	mov    %ebx,(%esp)
+  801b20:	e8 a2 fb ff ff       	call   8016c7 <close>
+	return r;
+  801b25:	83 c4 10             	add    $0x10,%esp
+  801b28:	89 f3                	mov    %esi,%ebx
+}
+  801b2a:	89 d8                	mov    %ebx,%eax
+  801b2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b2f:	5b                   	pop    %ebx
+  801b30:	5e                   	pop    %esi
+  801b31:	5d                   	pop    %ebp
+  801b32:	c3                   	ret
+
+00801b33 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801b33:	55                   	push   %ebp
+  801b34:	89 e5                	mov    %esp,%ebp
+  801b36:	57                   	push   %edi
+  801b37:	56                   	push   %esi
+  801b38:	53                   	push   %ebx
+  801b39:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801b3f:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801b45:	89 d6                	mov    %edx,%esi
+  801b47:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801b4d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801b50:	89 d3                	mov    %edx,%ebx
+  801b52:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801b58:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801b5f:	74 1d                	je     801b7e <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b61:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801b66:	83 c8 07             	or     $0x7,%eax
+  801b69:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801b6f:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801b74:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801b7a:	01 ce                	add    %ecx,%esi
+  801b7c:	eb 28                	jmp    801ba6 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b7e:	83 ec 0c             	sub    $0xc,%esp
+  801b81:	6a 01                	push   $0x1
+  801b83:	e8 e2 1b 00 00       	call   80376a <ipc_find_env>
+  801b88:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801b8d:	83 c4 10             	add    $0x10,%esp
+  801b90:	eb cf                	jmp    801b61 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801b92:	83 c0 01             	add    $0x1,%eax
+  801b95:	89 fa                	mov    %edi,%edx
+  801b97:	09 da                	or     %ebx,%edx
+  801b99:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801ba0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ba6:	39 f3                	cmp    %esi,%ebx
+  801ba8:	72 e8                	jb     801b92 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801baa:	83 f8 41             	cmp    $0x41,%eax
+  801bad:	77 2f                	ja     801bde <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801baf:	50                   	push   %eax
+  801bb0:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801bb6:	50                   	push   %eax
+  801bb7:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801bbd:	ff 35 c8 80 80 00    	push   0x8080c8
+  801bc3:	e8 54 1b 00 00       	call   80371c <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801bc8:	83 c4 0c             	add    $0xc,%esp
+  801bcb:	6a 00                	push   $0x0
+  801bcd:	6a 00                	push   $0x0
+  801bcf:	6a 00                	push   $0x0
+  801bd1:	e8 f0 19 00 00       	call   8035c6 <ipc_recv>
+}
+  801bd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd9:	5b                   	pop    %ebx
+  801bda:	5e                   	pop    %esi
+  801bdb:	5f                   	pop    %edi
+  801bdc:	5d                   	pop    %ebp
+  801bdd:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801bde:	68 54 40 80 00       	push   $0x804054
+  801be3:	68 8c 3f 80 00       	push   $0x803f8c
+  801be8:	6a 40                	push   $0x40
+  801bea:	68 70 40 80 00       	push   $0x804070
+  801bef:	e8 41 e7 ff ff       	call   800335 <_panic>
+
+00801bf4 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801bf4:	55                   	push   %ebp
+  801bf5:	89 e5                	mov    %esp,%ebp
+  801bf7:	57                   	push   %edi
+  801bf8:	56                   	push   %esi
+  801bf9:	53                   	push   %ebx
+  801bfa:	83 ec 1c             	sub    $0x1c,%esp
+  801bfd:	89 c3                	mov    %eax,%ebx
+  801bff:	89 d6                	mov    %edx,%esi
+  801c01:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801c04:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801c0a:	89 ca                	mov    %ecx,%edx
+  801c0c:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801c0f:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801c16:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801c19:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801c20:	8b 76 0c             	mov    0xc(%esi),%esi
+  801c23:	89 fb                	mov    %edi,%ebx
+  801c25:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801c2c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c2f:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801c36:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c39:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801c40:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c43:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801c4a:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801c4d:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801c54:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801c59:	39 c8                	cmp    %ecx,%eax
+  801c5b:	74 0d                	je     801c6a <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c65:	5b                   	pop    %ebx
+  801c66:	5e                   	pop    %esi
+  801c67:	5f                   	pop    %edi
+  801c68:	5d                   	pop    %ebp
+  801c69:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801c6a:	6a 07                	push   $0x7
+  801c6c:	68 00 70 80 00       	push   $0x807000
+  801c71:	6a 0d                	push   $0xd
+  801c73:	ff 35 c8 80 80 00    	push   0x8080c8
+  801c79:	e8 b3 19 00 00       	call   803631 <ipc_send>
+  801c7e:	83 c4 10             	add    $0x10,%esp
+  801c81:	eb da                	jmp    801c5d <fsring_post+0x69>
+
+00801c83 <fsipcv>:
+{
+  801c83:	55                   	push   %ebp
+  801c84:	89 e5                	mov    %esp,%ebp
+  801c86:	57                   	push   %edi
+  801c87:	56                   	push   %esi
+  801c88:	53                   	push   %ebx
+  801c89:	83 ec 0c             	sub    $0xc,%esp
+  801c8c:	89 c7                	mov    %eax,%edi
+  801c8e:	89 d3                	mov    %edx,%ebx
+  801c90:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801c92:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801c99:	74 26                	je     801cc1 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801c9b:	6a 07                	push   $0x7
+  801c9d:	68 00 70 80 00       	push   $0x807000
+  801ca2:	57                   	push   %edi
+  801ca3:	ff 35 c8 80 80 00    	push   0x8080c8
+  801ca9:	e8 83 19 00 00       	call   803631 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801cae:	6a 00                	push   $0x0
+  801cb0:	56                   	push   %esi
+  801cb1:	53                   	push   %ebx
+  801cb2:	6a 00                	push   $0x0
+  801cb4:	e8 d0 19 00 00       	call   803689 <ipc_recvv>
+}
+  801cb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cbc:	5b                   	pop    %ebx
+  801cbd:	5e                   	pop    %esi
+  801cbe:	5f                   	pop    %edi
+  801cbf:	5d                   	pop    %ebp
+  801cc0:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801cc1:	83 ec 0c             	sub    $0xc,%esp
+  801cc4:	6a 01                	push   $0x1
+  801cc6:	e8 9f 1a 00 00       	call   80376a <ipc_find_env>
+  801ccb:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801cd0:	83 c4 10             	add    $0x10,%esp
+  801cd3:	eb c6                	jmp    801c9b <fsipcv+0x18>
+
+00801cd5 <fsipc>:
+{
+  801cd5:	55                   	push   %ebp
+  801cd6:	89 e5                	mov    %esp,%ebp
+  801cd8:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801cdb:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801ce2:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801ce5:	e8 99 ff ff ff       	call   801c83 <fsipcv>
+}
+  801cea:	c9                   	leave
+  801ceb:	c3                   	ret
+
+00801cec <file_write_direct>:
+{
+  801cec:	55                   	push   %ebp
+  801ced:	89 e5                	mov    %esp,%ebp
+  801cef:	56                   	push   %esi
+  801cf0:	53                   	push   %ebx
+  801cf1:	89 c3                	mov    %eax,%ebx
+  801cf3:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801cf5:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801cfb:	77 40                	ja     801d3d <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801cfd:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801d02:	39 c8                	cmp    %ecx,%eax
+  801d04:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d07:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801d0a:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  801d10:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801d15:	83 ec 04             	sub    $0x4,%esp
+  801d18:	50                   	push   %eax
+  801d19:	52                   	push   %edx
+  801d1a:	68 08 70 80 00       	push   $0x807008
+  801d1f:	e8 60 ee ff ff       	call   800b84 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801d24:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d29:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d2e:	e8 a2 ff ff ff       	call   801cd5 <fsipc>
+  801d33:	83 c4 10             	add    $0x10,%esp
+}
+  801d36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d39:	5b                   	pop    %ebx
+  801d3a:	5e                   	pop    %esi
+  801d3b:	5d                   	pop    %ebp
+  801d3c:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801d3d:	89 d6                	mov    %edx,%esi
+  801d3f:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801d45:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801d4a:	29 f1                	sub    %esi,%ecx
+  801d4c:	39 c1                	cmp    %eax,%ecx
+  801d4e:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801d51:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801d54:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801d59:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801d5f:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801d65:	83 ec 0c             	sub    $0xc,%esp
+  801d68:	6a 05                	push   $0x5
+  801d6a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801d6f:	e8 bf fd ff ff       	call   801b33 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801d74:	83 c4 10             	add    $0x10,%esp
+  801d77:	eb bd                	jmp    801d36 <file_write_direct+0x4a>
+
+00801d79 <devfile_sync>:
+{
+  801d79:	55                   	push   %ebp
+  801d7a:	89 e5                	mov    %esp,%ebp
+  801d7c:	57                   	push   %edi
+  801d7d:	56                   	push   %esi
+  801d7e:	53                   	push   %ebx
+  801d7f:	83 ec 28             	sub    $0x28,%esp
+  801d82:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801d85:	56                   	push   %esi
+  801d86:	e8 a5 f7 ff ff       	call   801530 <fd2data>
+  801d8b:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801d8d:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801d90:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801d97:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801d9f:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801da3:	74 45                	je     801dea <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801da5:	8b 46 14             	mov    0x14(%esi),%eax
+  801da8:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801dab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801db5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801db8:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801dbb:	39 cb                	cmp    %ecx,%ebx
+  801dbd:	73 14                	jae    801dd3 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801dbf:	29 d9                	sub    %ebx,%ecx
+  801dc1:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801dc4:	89 f0                	mov    %esi,%eax
+  801dc6:	e8 21 ff ff ff       	call   801cec <file_write_direct>
+  801dcb:	85 c0                	test   %eax,%eax
+  801dcd:	7e 04                	jle    801dd3 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801dcf:	01 c3                	add    %eax,%ebx
+  801dd1:	eb e5                	jmp    801db8 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801dd3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801dd6:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801ddd:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801de0:	85 c0                	test   %eax,%eax
+  801de2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801de7:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801dea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ded:	5b                   	pop    %ebx
+  801dee:	5e                   	pop    %esi
+  801def:	5f                   	pop    %edi
+  801df0:	5d                   	pop    %ebp
+  801df1:	c3                   	ret
+
+00801df2 <devfile_write>:
+{
+  801df2:	55                   	push   %ebp
+  801df3:	89 e5                	mov    %esp,%ebp
+  801df5:	57                   	push   %edi
+  801df6:	56                   	push   %esi
+  801df7:	53                   	push   %ebx
+  801df8:	83 ec 28             	sub    $0x28,%esp
+  801dfb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801dfe:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801e01:	53                   	push   %ebx
+  801e02:	e8 29 f7 ff ff       	call   801530 <fd2data>
+  801e07:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801e0a:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801e0d:	83 c4 10             	add    $0x10,%esp
+  801e10:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801e14:	74 43                	je     801e59 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801e16:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801e1d:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801e20:	85 c0                	test   %eax,%eax
+  801e22:	74 43                	je     801e67 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801e24:	89 c2                	mov    %eax,%edx
+  801e26:	03 53 14             	add    0x14(%ebx),%edx
+  801e29:	39 fa                	cmp    %edi,%edx
+  801e2b:	75 0b                	jne    801e38 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801e2d:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801e30:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801e36:	76 66                	jbe    801e9e <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801e38:	83 ec 0c             	sub    $0xc,%esp
+  801e3b:	53                   	push   %ebx
+  801e3c:	e8 38 ff ff ff       	call   801d79 <devfile_sync>
+  801e41:	83 c4 10             	add    $0x10,%esp
+  801e44:	85 c0                	test   %eax,%eax
+  801e46:	78 4e                	js     801e96 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801e48:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e4e:	77 56                	ja     801ea6 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801e50:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801e53:	85 c0                	test   %eax,%eax
+  801e55:	75 20                	jne    801e77 <devfile_write+0x85>
+  801e57:	eb 16                	jmp    801e6f <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801e59:	89 f1                	mov    %esi,%ecx
+  801e5b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e5e:	89 d8                	mov    %ebx,%eax
+  801e60:	e8 87 fe ff ff       	call   801cec <file_write_direct>
+  801e65:	eb 2f                	jmp    801e96 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801e67:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e6d:	77 37                	ja     801ea6 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801e6f:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801e72:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801e77:	83 ec 04             	sub    $0x4,%esp
+  801e7a:	56                   	push   %esi
+  801e7b:	ff 75 0c             	push   0xc(%ebp)
+  801e7e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e81:	01 c1                	add    %eax,%ecx
+  801e83:	51                   	push   %ecx
+  801e84:	e8 fb ec ff ff       	call   800b84 <memmove>
+	ff->buf_wlen += n;
+  801e89:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801e8c:	01 f7                	add    %esi,%edi
+  801e8e:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801e91:	89 f0                	mov    %esi,%eax
+  801e93:	83 c4 10             	add    $0x10,%esp
+}
+  801e96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e99:	5b                   	pop    %ebx
+  801e9a:	5e                   	pop    %esi
+  801e9b:	5f                   	pop    %edi
+  801e9c:	5d                   	pop    %ebp
+  801e9d:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801e9e:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801ea4:	76 d1                	jbe    801e77 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801ea6:	89 f1                	mov    %esi,%ecx
+  801ea8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801eab:	89 d8                	mov    %ebx,%eax
+  801ead:	e8 3a fe ff ff       	call   801cec <file_write_direct>
+  801eb2:	eb e2                	jmp    801e96 <devfile_write+0xa4>
+
+00801eb4 <devfile_trunc>:
+{
+  801eb4:	55                   	push   %ebp
+  801eb5:	89 e5                	mov    %esp,%ebp
+  801eb7:	53                   	push   %ebx
+  801eb8:	83 ec 10             	sub    $0x10,%esp
+  801ebb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801ebe:	53                   	push   %ebx
+  801ebf:	e8 b5 fe ff ff       	call   801d79 <devfile_sync>
+  801ec4:	83 c4 10             	add    $0x10,%esp
+  801ec7:	85 c0                	test   %eax,%eax
+  801ec9:	78 1f                	js     801eea <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ecb:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801ece:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801ed3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ed6:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801edb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee0:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ee5:	e8 eb fd ff ff       	call   801cd5 <fsipc>
+}
+  801eea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eed:	c9                   	leave
+  801eee:	c3                   	ret
+
+00801eef <devfile_stat>:
+{
+  801eef:	55                   	push   %ebp
+  801ef0:	89 e5                	mov    %esp,%ebp
+  801ef2:	56                   	push   %esi
+  801ef3:	53                   	push   %ebx
+  801ef4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ef7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801efa:	83 ec 0c             	sub    $0xc,%esp
+  801efd:	53                   	push   %ebx
+  801efe:	e8 76 fe ff ff       	call   801d79 <devfile_sync>
+  801f03:	83 c4 10             	add    $0x10,%esp
+  801f06:	85 c0                	test   %eax,%eax
+  801f08:	78 47                	js     801f51 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f0a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801f0d:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f12:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f17:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f1c:	e8 b4 fd ff ff       	call   801cd5 <fsipc>
+  801f21:	85 c0                	test   %eax,%eax
+  801f23:	78 2c                	js     801f51 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f25:	83 ec 08             	sub    $0x8,%esp
+  801f28:	68 00 70 80 00       	push   $0x807000
+  801f2d:	56                   	push   %esi
+  801f2e:	e8 cb ea ff ff       	call   8009fe <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f33:	a1 80 70 80 00       	mov    0x807080,%eax
+  801f38:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f3e:	a1 84 70 80 00       	mov    0x807084,%eax
+  801f43:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801f49:	83 c4 10             	add    $0x10,%esp
+  801f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f54:	5b                   	pop    %ebx
+  801f55:	5e                   	pop    %esi
+  801f56:	5d                   	pop    %ebp
+  801f57:	c3                   	ret
+
+00801f58 <devfile_flush>:
+{
+  801f58:	55                   	push   %ebp
+  801f59:	89 e5                	mov    %esp,%ebp
+  801f5b:	56                   	push   %esi
+  801f5c:	53                   	push   %ebx
+  801f5d:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801f60:	83 ec 0c             	sub    $0xc,%esp
+  801f63:	56                   	push   %esi
+  801f64:	e8 10 fe ff ff       	call   801d79 <devfile_sync>
+  801f69:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801f6b:	83 c4 10             	add    $0x10,%esp
+  801f6e:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801f72:	75 25                	jne    801f99 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f74:	8b 46 0c             	mov    0xc(%esi),%eax
+  801f77:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801f7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f81:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f86:	e8 4a fd ff ff       	call   801cd5 <fsipc>
+  801f8b:	85 c0                	test   %eax,%eax
+  801f8d:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801f90:	89 d8                	mov    %ebx,%eax
+  801f92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f95:	5b                   	pop    %ebx
+  801f96:	5e                   	pop    %esi
+  801f97:	5d                   	pop    %ebp
+  801f98:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801f99:	83 ec 0c             	sub    $0xc,%esp
+  801f9c:	56                   	push   %esi
+  801f9d:	e8 8e f5 ff ff       	call   801530 <fd2data>
+  801fa2:	83 c4 08             	add    $0x8,%esp
+  801fa5:	50                   	push   %eax
+  801fa6:	6a 00                	push   $0x0
+  801fa8:	e8 ea ee ff ff       	call   800e97 <sys_page_unmap>
+  801fad:	83 c4 10             	add    $0x10,%esp
+  801fb0:	eb c2                	jmp    801f74 <devfile_flush+0x1c>
+
+00801fb2 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801fb2:	55                   	push   %ebp
+  801fb3:	89 e5                	mov    %esp,%ebp
+  801fb5:	57                   	push   %edi
+  801fb6:	56                   	push   %esi
+  801fb7:	53                   	push   %ebx
+  801fb8:	83 ec 64             	sub    $0x64,%esp
+  801fbb:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801fbd:	52                   	push   %edx
+  801fbe:	50                   	push   %eax
+  801fbf:	e8 d9 f5 ff ff       	call   80159d <fd_lookup>
+  801fc4:	89 c1                	mov    %eax,%ecx
+  801fc6:	83 c4 10             	add    $0x10,%esp
+  801fc9:	85 c0                	test   %eax,%eax
+  801fcb:	0f 88 f2 00 00 00    	js     8020c3 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801fd1:	8b 07                	mov    (%edi),%eax
+  801fd3:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801fd9:	39 10                	cmp    %edx,(%eax)
+  801fdb:	0f 85 03 01 00 00    	jne    8020e4 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801fe1:	a1 00 60 80 00       	mov    0x806000,%eax
+  801fe6:	8b 40 48             	mov    0x48(%eax),%eax
+  801fe9:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  801fef:	0f 84 96 00 00 00    	je     80208b <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801ff5:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801ffc:	0f 84 cb 00 00 00    	je     8020cd <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  802002:	b8 00 70 80 00       	mov    $0x807000,%eax
+  802007:	83 c8 07             	or     $0x7,%eax
+  80200a:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  80200d:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  802010:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  802015:	83 ec 04             	sub    $0x4,%esp
+  802018:	68 07 04 00 00       	push   $0x407
+  80201d:	53                   	push   %ebx
+  80201e:	6a 00                	push   $0x0
+  802020:	e8 e5 ed ff ff       	call   800e0a <sys_page_alloc>
+  802025:	89 c1                	mov    %eax,%ecx
+  802027:	83 c4 10             	add    $0x10,%esp
+  80202a:	85 c0                	test   %eax,%eax
+  80202c:	0f 88 91 00 00 00    	js     8020c3 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  802032:	89 d8                	mov    %ebx,%eax
+  802034:	83 c8 07             	or     $0x7,%eax
+  802037:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  802039:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80203f:	83 c6 04             	add    $0x4,%esi
+  802042:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  802048:	75 cb                	jne    802015 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  80204a:	6a 12                	push   $0x12
+  80204c:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80204f:	50                   	push   %eax
+  802050:	6a 0c                	push   $0xc
+  802052:	ff 35 c8 80 80 00    	push   0x8080c8
+  802058:	e8 bf 16 00 00       	call   80371c <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80205d:	83 c4 0c             	add    $0xc,%esp
+  802060:	6a 00                	push   $0x0
+  802062:	6a 00                	push   $0x0
+  802064:	6a 00                	push   $0x0
+  802066:	e8 5b 15 00 00       	call   8035c6 <ipc_recv>
+  80206b:	89 c1                	mov    %eax,%ecx
+  80206d:	83 c4 10             	add    $0x10,%esp
+  802070:	85 c0                	test   %eax,%eax
+  802072:	78 4f                	js     8020c3 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  802074:	a1 00 60 80 00       	mov    0x806000,%eax
+  802079:	8b 40 48             	mov    0x48(%eax),%eax
+  80207c:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  802081:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  802088:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  80208b:	83 ec 0c             	sub    $0xc,%esp
+  80208e:	ff 37                	push   (%edi)
+  802090:	e8 e4 fc ff ff       	call   801d79 <devfile_sync>
+  802095:	89 c1                	mov    %eax,%ecx
+  802097:	83 c4 10             	add    $0x10,%esp
+  80209a:	85 c0                	test   %eax,%eax
+  80209c:	78 25                	js     8020c3 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  80209e:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  8020a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  8020a9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8020ae:	89 d0                	mov    %edx,%eax
+  8020b0:	d3 e0                	shl    %cl,%eax
+  8020b2:	85 d8                	test   %ebx,%eax
+  8020b4:	74 0d                	je     8020c3 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  8020b6:	83 c1 01             	add    $0x1,%ecx
+  8020b9:	83 f9 10             	cmp    $0x10,%ecx
+  8020bc:	75 f0                	jne    8020ae <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  8020be:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  8020c3:	89 c8                	mov    %ecx,%eax
+  8020c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020c8:	5b                   	pop    %ebx
+  8020c9:	5e                   	pop    %esi
+  8020ca:	5f                   	pop    %edi
+  8020cb:	5d                   	pop    %ebp
+  8020cc:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020cd:	83 ec 0c             	sub    $0xc,%esp
+  8020d0:	6a 01                	push   $0x1
+  8020d2:	e8 93 16 00 00       	call   80376a <ipc_find_env>
+  8020d7:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  8020dc:	83 c4 10             	add    $0x10,%esp
+  8020df:	e9 1e ff ff ff       	jmp    802002 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  8020e4:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  8020e9:	eb d8                	jmp    8020c3 <fsring_slot+0x111>
+
+008020eb <file_read_direct>:
+{
+  8020eb:	55                   	push   %ebp
+  8020ec:	89 e5                	mov    %esp,%ebp
+  8020ee:	57                   	push   %edi
+  8020ef:	56                   	push   %esi
+  8020f0:	53                   	push   %ebx
+  8020f1:	83 ec 1c             	sub    $0x1c,%esp
+  8020f4:	89 c7                	mov    %eax,%edi
+  8020f6:	89 d6                	mov    %edx,%esi
+  8020f8:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  8020fa:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  802100:	77 52                	ja     802154 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802102:	8b 40 0c             	mov    0xc(%eax),%eax
+  802105:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  80210a:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802110:	ba 00 00 00 00       	mov    $0x0,%edx
+  802115:	b8 03 00 00 00       	mov    $0x3,%eax
+  80211a:	e8 b6 fb ff ff       	call   801cd5 <fsipc>
+  80211f:	89 c7                	mov    %eax,%edi
+  802121:	85 c0                	test   %eax,%eax
+  802123:	78 25                	js     80214a <file_read_direct+0x5f>
+	assert(r <= n);
+  802125:	39 c3                	cmp    %eax,%ebx
+  802127:	0f 82 87 00 00 00    	jb     8021b4 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  80212d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802132:	0f 8f 95 00 00 00    	jg     8021cd <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802138:	83 ec 04             	sub    $0x4,%esp
+  80213b:	50                   	push   %eax
+  80213c:	68 00 70 80 00       	push   $0x807000
+  802141:	56                   	push   %esi
+  802142:	e8 3d ea ff ff       	call   800b84 <memmove>
+	return r;
+  802147:	83 c4 10             	add    $0x10,%esp
+}
+  80214a:	89 f8                	mov    %edi,%eax
+  80214c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80214f:	5b                   	pop    %ebx
+  802150:	5e                   	pop    %esi
+  802151:	5f                   	pop    %edi
+  802152:	5d                   	pop    %ebp
+  802153:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802154:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80215a:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80215f:	29 d1                	sub    %edx,%ecx
+  802161:	39 d9                	cmp    %ebx,%ecx
+  802163:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802166:	89 f0                	mov    %esi,%eax
+  802168:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  80216b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80216e:	eb 0f                	jmp    80217f <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  802170:	0f b6 10             	movzbl (%eax),%edx
+  802173:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802175:	05 00 10 00 00       	add    $0x1000,%eax
+  80217a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80217f:	39 c8                	cmp    %ecx,%eax
+  802181:	72 ed                	jb     802170 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802183:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802186:	8b 47 0c             	mov    0xc(%edi),%eax
+  802189:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  80218e:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802194:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  80219a:	83 ec 0c             	sub    $0xc,%esp
+  80219d:	6a 07                	push   $0x7
+  80219f:	89 d9                	mov    %ebx,%ecx
+  8021a1:	89 f2                	mov    %esi,%edx
+  8021a3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021a8:	e8 86 f9 ff ff       	call   801b33 <fsipc_pages>
+  8021ad:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  8021af:	83 c4 10             	add    $0x10,%esp
+  8021b2:	eb 96                	jmp    80214a <file_read_direct+0x5f>
+	assert(r <= n);
+  8021b4:	68 7b 40 80 00       	push   $0x80407b
+  8021b9:	68 8c 3f 80 00       	push   $0x803f8c
+  8021be:	68 dc 00 00 00       	push   $0xdc
+  8021c3:	68 70 40 80 00       	push   $0x804070
+  8021c8:	e8 68 e1 ff ff       	call   800335 <_panic>
+	assert(r <= PGSIZE);
+  8021cd:	68 8c 40 80 00       	push   $0x80408c
+  8021d2:	68 8c 3f 80 00       	push   $0x803f8c
+  8021d7:	68 dd 00 00 00       	push   $0xdd
+  8021dc:	68 70 40 80 00       	push   $0x804070
+  8021e1:	e8 4f e1 ff ff       	call   800335 <_panic>
+
+008021e6 <devfile_read>:
+{
+  8021e6:	55                   	push   %ebp
+  8021e7:	89 e5                	mov    %esp,%ebp
+  8021e9:	57                   	push   %edi
+  8021ea:	56                   	push   %esi
+  8021eb:	53                   	push   %ebx
+  8021ec:	83 ec 28             	sub    $0x28,%esp
+  8021ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8021f2:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8021f5:	53                   	push   %ebx
+  8021f6:	e8 35 f3 ff ff       	call   801530 <fd2data>
+  8021fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8021fe:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  802201:	83 c4 10             	add    $0x10,%esp
+  802204:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  802208:	74 7d                	je     802287 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80220a:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80220e:	0f 85 81 00 00 00    	jne    802295 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  802214:	8b 43 18             	mov    0x18(%ebx),%eax
+  802217:	85 c0                	test   %eax,%eax
+  802219:	74 0d                	je     802228 <devfile_read+0x42>
+  80221b:	8b 53 14             	mov    0x14(%ebx),%edx
+  80221e:	39 fa                	cmp    %edi,%edx
+  802220:	7f 06                	jg     802228 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  802222:	01 c2                	add    %eax,%edx
+  802224:	39 d7                	cmp    %edx,%edi
+  802226:	72 28                	jb     802250 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  802228:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  80222f:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802235:	77 74                	ja     8022ab <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  802237:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80223c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80223f:	89 d8                	mov    %ebx,%eax
+  802241:	e8 a5 fe ff ff       	call   8020eb <file_read_direct>
+  802246:	85 c0                	test   %eax,%eax
+  802248:	7e 35                	jle    80227f <devfile_read+0x99>
+		ff->buf_base = pos;
+  80224a:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  80224d:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  802250:	8b 53 14             	mov    0x14(%ebx),%edx
+  802253:	89 d0                	mov    %edx,%eax
+  802255:	03 43 18             	add    0x18(%ebx),%eax
+  802258:	29 f8                	sub    %edi,%eax
+  80225a:	39 f0                	cmp    %esi,%eax
+  80225c:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  80225f:	83 ec 04             	sub    $0x4,%esp
+  802262:	56                   	push   %esi
+  802263:	89 f8                	mov    %edi,%eax
+  802265:	29 d0                	sub    %edx,%eax
+  802267:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80226a:	01 c1                	add    %eax,%ecx
+  80226c:	51                   	push   %ecx
+  80226d:	ff 75 0c             	push   0xc(%ebp)
+  802270:	e8 0f e9 ff ff       	call   800b84 <memmove>
+	fd->fd_offset = pos + n;
+  802275:	01 f7                	add    %esi,%edi
+  802277:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80227a:	89 f0                	mov    %esi,%eax
+  80227c:	83 c4 10             	add    $0x10,%esp
+}
+  80227f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802282:	5b                   	pop    %ebx
+  802283:	5e                   	pop    %esi
+  802284:	5f                   	pop    %edi
+  802285:	5d                   	pop    %ebp
+  802286:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802287:	89 f1                	mov    %esi,%ecx
+  802289:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80228c:	89 d8                	mov    %ebx,%eax
+  80228e:	e8 58 fe ff ff       	call   8020eb <file_read_direct>
+  802293:	eb ea                	jmp    80227f <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802295:	83 ec 0c             	sub    $0xc,%esp
+  802298:	53                   	push   %ebx
+  802299:	e8 db fa ff ff       	call   801d79 <devfile_sync>
+  80229e:	83 c4 10             	add    $0x10,%esp
+  8022a1:	85 c0                	test   %eax,%eax
+  8022a3:	0f 89 6b ff ff ff    	jns    802214 <devfile_read+0x2e>
+  8022a9:	eb d4                	jmp    80227f <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  8022ab:	89 f1                	mov    %esi,%ecx
+  8022ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022b0:	89 d8                	mov    %ebx,%eax
+  8022b2:	e8 34 fe ff ff       	call   8020eb <file_read_direct>
+  8022b7:	eb c6                	jmp    80227f <devfile_read+0x99>
+
+008022b9 <open>:
+{
+  8022b9:	55                   	push   %ebp
+  8022ba:	89 e5                	mov    %esp,%ebp
+  8022bc:	56                   	push   %esi
+  8022bd:	53                   	push   %ebx
+  8022be:	83 ec 1c             	sub    $0x1c,%esp
+  8022c1:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8022c4:	56                   	push   %esi
+  8022c5:	e8 f9 e6 ff ff       	call   8009c3 <strlen>
+  8022ca:	83 c4 10             	add    $0x10,%esp
+  8022cd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022d2:	0f 8f a0 00 00 00    	jg     802378 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  8022d8:	83 ec 0c             	sub    $0xc,%esp
+  8022db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022de:	50                   	push   %eax
+  8022df:	e8 63 f2 ff ff       	call   801547 <fd_alloc>
+  8022e4:	89 c3                	mov    %eax,%ebx
+  8022e6:	83 c4 10             	add    $0x10,%esp
+  8022e9:	85 c0                	test   %eax,%eax
+  8022eb:	78 45                	js     802332 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  8022ed:	83 ec 08             	sub    $0x8,%esp
+  8022f0:	56                   	push   %esi
+  8022f1:	68 00 70 80 00       	push   $0x807000
+  8022f6:	e8 03 e7 ff ff       	call   8009fe <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8022fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022fe:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802303:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802306:	b8 01 00 00 00       	mov    $0x1,%eax
+  80230b:	e8 c5 f9 ff ff       	call   801cd5 <fsipc>
+  802310:	89 c3                	mov    %eax,%ebx
+  802312:	83 c4 10             	add    $0x10,%esp
+  802315:	85 c0                	test   %eax,%eax
+  802317:	78 22                	js     80233b <open+0x82>
+	if (!(mode & O_NOBUF)
+  802319:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  802320:	74 2b                	je     80234d <open+0x94>
+	return fd2num(fd);
+  802322:	83 ec 0c             	sub    $0xc,%esp
+  802325:	ff 75 f4             	push   -0xc(%ebp)
+  802328:	e8 f3 f1 ff ff       	call   801520 <fd2num>
+  80232d:	89 c3                	mov    %eax,%ebx
+  80232f:	83 c4 10             	add    $0x10,%esp
+}
+  802332:	89 d8                	mov    %ebx,%eax
+  802334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802337:	5b                   	pop    %ebx
+  802338:	5e                   	pop    %esi
+  802339:	5d                   	pop    %ebp
+  80233a:	c3                   	ret
+		fd_close(fd, 0);
+  80233b:	83 ec 08             	sub    $0x8,%esp
+  80233e:	6a 00                	push   $0x0
+  802340:	ff 75 f4             	push   -0xc(%ebp)
+  802343:	e8 f8 f2 ff ff       	call   801640 <fd_close>
+		return r;
+  802348:	83 c4 10             	add    $0x10,%esp
+  80234b:	eb e5                	jmp    802332 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  80234d:	83 ec 0c             	sub    $0xc,%esp
+  802350:	ff 75 f4             	push   -0xc(%ebp)
+  802353:	e8 d8 f1 ff ff       	call   801530 <fd2data>
+  802358:	83 c4 0c             	add    $0xc,%esp
+  80235b:	68 07 04 00 00       	push   $0x407
+  802360:	50                   	push   %eax
+  802361:	6a 00                	push   $0x0
+  802363:	e8 a2 ea ff ff       	call   800e0a <sys_page_alloc>
+  802368:	83 c4 10             	add    $0x10,%esp
+  80236b:	85 c0                	test   %eax,%eax
+  80236d:	75 b3                	jne    802322 <open+0x69>
+		fd->fd_file.buffered = 1;
+  80236f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802372:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802376:	eb aa                	jmp    802322 <open+0x69>
+		return -E_BAD_PATH;
+  802378:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80237d:	eb b3                	jmp    802332 <open+0x79>
+
+0080237f <readdir>:
+{
+  80237f:	55                   	push   %ebp
+  802380:	89 e5                	mov    %esp,%ebp
+  802382:	53                   	push   %ebx
+  802383:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802386:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802389:	50                   	push   %eax
+  80238a:	ff 75 08             	push   0x8(%ebp)
+  80238d:	e8 0b f2 ff ff       	call   80159d <fd_lookup>
+  802392:	89 c3                	mov    %eax,%ebx
+  802394:	83 c4 10             	add    $0x10,%esp
+  802397:	85 c0                	test   %eax,%eax
+  802399:	78 73                	js     80240e <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80239b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80239e:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  8023a4:	39 08                	cmp    %ecx,(%eax)
+  8023a6:	0f 85 82 00 00 00    	jne    80242e <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  8023ac:	83 ec 0c             	sub    $0xc,%esp
+  8023af:	50                   	push   %eax
+  8023b0:	e8 c4 f9 ff ff       	call   801d79 <devfile_sync>
+  8023b5:	89 c3                	mov    %eax,%ebx
+  8023b7:	83 c4 10             	add    $0x10,%esp
+  8023ba:	85 c0                	test   %eax,%eax
+  8023bc:	78 50                	js     80240e <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  8023be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023c1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023c4:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  8023c9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023cc:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  8023d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023d4:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  8023d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023de:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8023e3:	e8 ed f8 ff ff       	call   801cd5 <fsipc>
+  8023e8:	89 c3                	mov    %eax,%ebx
+  8023ea:	85 c0                	test   %eax,%eax
+  8023ec:	7e 20                	jle    80240e <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  8023ee:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8023f1:	72 22                	jb     802415 <readdir+0x96>
+  8023f3:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8023f8:	7f 1b                	jg     802415 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8023fa:	83 ec 04             	sub    $0x4,%esp
+  8023fd:	50                   	push   %eax
+  8023fe:	68 00 70 80 00       	push   $0x807000
+  802403:	ff 75 0c             	push   0xc(%ebp)
+  802406:	e8 79 e7 ff ff       	call   800b84 <memmove>
+	return r;
+  80240b:	83 c4 10             	add    $0x10,%esp
+}
+  80240e:	89 d8                	mov    %ebx,%eax
+  802410:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802413:	c9                   	leave
+  802414:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  802415:	68 82 40 80 00       	push   $0x804082
+  80241a:	68 8c 3f 80 00       	push   $0x803f8c
+  80241f:	68 86 01 00 00       	push   $0x186
+  802424:	68 70 40 80 00       	push   $0x804070
+  802429:	e8 07 df ff ff       	call   800335 <_panic>
+		return -E_NOT_SUPP;
+  80242e:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802433:	eb d9                	jmp    80240e <readdir+0x8f>
+
+00802435 <munmap>:
+{
+  802435:	55                   	push   %ebp
+  802436:	89 e5                	mov    %esp,%ebp
+  802438:	56                   	push   %esi
+  802439:	53                   	push   %ebx
+  80243a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80243d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802440:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  802446:	75 41                	jne    802489 <munmap+0x54>
+  802448:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  80244e:	77 39                	ja     802489 <munmap+0x54>
+  802450:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802455:	29 f0                	sub    %esi,%eax
+  802457:	39 d0                	cmp    %edx,%eax
+  802459:	72 35                	jb     802490 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80245b:	89 f3                	mov    %esi,%ebx
+  80245d:	01 d6                	add    %edx,%esi
+  80245f:	39 f3                	cmp    %esi,%ebx
+  802461:	73 1a                	jae    80247d <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802463:	83 ec 08             	sub    $0x8,%esp
+  802466:	53                   	push   %ebx
+  802467:	6a 00                	push   $0x0
+  802469:	e8 29 ea ff ff       	call   800e97 <sys_page_unmap>
+  80246e:	83 c4 10             	add    $0x10,%esp
+  802471:	85 c0                	test   %eax,%eax
+  802473:	78 0d                	js     802482 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802475:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80247b:	eb e2                	jmp    80245f <munmap+0x2a>
+	return 0;
+  80247d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802482:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802485:	5b                   	pop    %ebx
+  802486:	5e                   	pop    %esi
+  802487:	5d                   	pop    %ebp
+  802488:	c3                   	ret
+		return -E_INVAL;
+  802489:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80248e:	eb f2                	jmp    802482 <munmap+0x4d>
+  802490:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802495:	eb eb                	jmp    802482 <munmap+0x4d>
+
+00802497 <mmap>:
+{
+  802497:	55                   	push   %ebp
+  802498:	89 e5                	mov    %esp,%ebp
+  80249a:	57                   	push   %edi
+  80249b:	56                   	push   %esi
+  80249c:	53                   	push   %ebx
+  80249d:	83 ec 34             	sub    $0x34,%esp
+  8024a0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024a3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024a6:	50                   	push   %eax
+  8024a7:	ff 75 18             	push   0x18(%ebp)
+  8024aa:	e8 ee f0 ff ff       	call   80159d <fd_lookup>
+  8024af:	89 c3                	mov    %eax,%ebx
+  8024b1:	83 c4 10             	add    $0x10,%esp
+  8024b4:	85 c0                	test   %eax,%eax
+  8024b6:	0f 88 0e 01 00 00    	js     8025ca <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8024bc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024bf:	a1 20 50 80 00       	mov    0x805020,%eax
+  8024c4:	39 02                	cmp    %eax,(%edx)
+  8024c6:	0f 85 50 01 00 00    	jne    80261c <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  8024cc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024cf:	83 e0 02             	and    $0x2,%eax
+  8024d2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8024d5:	74 0a                	je     8024e1 <mmap+0x4a>
+  8024d7:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8024db:	0f 84 42 01 00 00    	je     802623 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  8024e1:	8b 42 08             	mov    0x8(%edx),%eax
+  8024e4:	83 e0 03             	and    $0x3,%eax
+  8024e7:	83 f8 01             	cmp    $0x1,%eax
+  8024ea:	0f 84 3a 01 00 00    	je     80262a <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8024f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f3:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8024f6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8024fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8024fe:	0f 85 2d 01 00 00    	jne    802631 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802504:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802508:	0f 88 2a 01 00 00    	js     802638 <mmap+0x1a1>
+  80250e:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  802515:	0f 87 1d 01 00 00    	ja     802638 <mmap+0x1a1>
+  80251b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802520:	2b 45 08             	sub    0x8(%ebp),%eax
+  802523:	39 f8                	cmp    %edi,%eax
+  802525:	0f 82 14 01 00 00    	jb     80263f <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  80252b:	83 ec 0c             	sub    $0xc,%esp
+  80252e:	52                   	push   %edx
+  80252f:	e8 45 f8 ff ff       	call   801d79 <devfile_sync>
+  802534:	89 c3                	mov    %eax,%ebx
+  802536:	83 c4 10             	add    $0x10,%esp
+  802539:	85 c0                	test   %eax,%eax
+  80253b:	0f 88 89 00 00 00    	js     8025ca <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802541:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802547:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80254d:	be 00 00 00 00       	mov    $0x0,%esi
+  802552:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802555:	39 fe                	cmp    %edi,%esi
+  802557:	73 7b                	jae    8025d4 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  802559:	89 f8                	mov    %edi,%eax
+  80255b:	29 f0                	sub    %esi,%eax
+  80255d:	c1 e8 0c             	shr    $0xc,%eax
+  802560:	ba 40 00 00 00       	mov    $0x40,%edx
+  802565:	39 d0                	cmp    %edx,%eax
+  802567:	0f 47 c2             	cmova  %edx,%eax
+  80256a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80256d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802570:	8b 52 0c             	mov    0xc(%edx),%edx
+  802573:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  802579:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  80257c:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  802582:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802587:	89 f2                	mov    %esi,%edx
+  802589:	03 55 08             	add    0x8(%ebp),%edx
+  80258c:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80258f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802594:	e8 ea f6 ff ff       	call   801c83 <fsipcv>
+  802599:	85 c0                	test   %eax,%eax
+  80259b:	7e 12                	jle    8025af <mmap+0x118>
+  80259d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8025a0:	85 c0                	test   %eax,%eax
+  8025a2:	0f 84 9e 00 00 00    	je     802646 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8025a8:	c1 e0 0c             	shl    $0xc,%eax
+  8025ab:	01 c6                	add    %eax,%esi
+  8025ad:	eb a6                	jmp    802555 <mmap+0xbe>
+			munmap(addr, done);
+  8025af:	89 c3                	mov    %eax,%ebx
+  8025b1:	83 ec 08             	sub    $0x8,%esp
+  8025b4:	56                   	push   %esi
+  8025b5:	ff 75 08             	push   0x8(%ebp)
+  8025b8:	e8 78 fe ff ff       	call   802435 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  8025bd:	83 c4 10             	add    $0x10,%esp
+  8025c0:	85 db                	test   %ebx,%ebx
+  8025c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025c7:	0f 49 d8             	cmovns %eax,%ebx
+}
+  8025ca:	89 d8                	mov    %ebx,%eax
+  8025cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025cf:	5b                   	pop    %ebx
+  8025d0:	5e                   	pop    %esi
+  8025d1:	5f                   	pop    %edi
+  8025d2:	5d                   	pop    %ebp
+  8025d3:	c3                   	ret
+	if (prot & PROT_WRITE)
+  8025d4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8025d7:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8025d9:	85 c0                	test   %eax,%eax
+  8025db:	74 ed                	je     8025ca <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8025dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8025e5:	39 fe                	cmp    %edi,%esi
+  8025e7:	73 2e                	jae    802617 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8025e9:	83 ec 0c             	sub    $0xc,%esp
+  8025ec:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8025ef:	50                   	push   %eax
+  8025f0:	e8 2d ed ff ff       	call   801322 <cowpage>
+  8025f5:	83 c4 10             	add    $0x10,%esp
+  8025f8:	85 c0                	test   %eax,%eax
+  8025fa:	78 08                	js     802604 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8025fc:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802602:	eb e1                	jmp    8025e5 <mmap+0x14e>
+				munmap(addr, len);
+  802604:	89 c3                	mov    %eax,%ebx
+  802606:	83 ec 08             	sub    $0x8,%esp
+  802609:	57                   	push   %edi
+  80260a:	ff 75 08             	push   0x8(%ebp)
+  80260d:	e8 23 fe ff ff       	call   802435 <munmap>
+				return r;
+  802612:	83 c4 10             	add    $0x10,%esp
+  802615:	eb b3                	jmp    8025ca <mmap+0x133>
+	return 0;
+  802617:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80261a:	eb ae                	jmp    8025ca <mmap+0x133>
+		return -E_NOT_SUPP;
+  80261c:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802621:	eb a7                	jmp    8025ca <mmap+0x133>
+		return -E_NOT_SUPP;
+  802623:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802628:	eb a0                	jmp    8025ca <mmap+0x133>
+		return -E_INVAL;
+  80262a:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80262f:	eb 99                	jmp    8025ca <mmap+0x133>
+  802631:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802636:	eb 92                	jmp    8025ca <mmap+0x133>
+  802638:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80263d:	eb 8b                	jmp    8025ca <mmap+0x133>
+  80263f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802644:	eb 84                	jmp    8025ca <mmap+0x133>
+			munmap(addr, done);
+  802646:	83 ec 08             	sub    $0x8,%esp
+  802649:	56                   	push   %esi
+  80264a:	ff 75 08             	push   0x8(%ebp)
+  80264d:	e8 e3 fd ff ff       	call   802435 <munmap>
+  802652:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802655:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80265a:	e9 6b ff ff ff       	jmp    8025ca <mmap+0x133>
+
+0080265f <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80265f:	55                   	push   %ebp
+  802660:	89 e5                	mov    %esp,%ebp
+  802662:	56                   	push   %esi
+  802663:	53                   	push   %ebx
+  802664:	83 ec 10             	sub    $0x10,%esp
+  802667:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80266a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80266d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802670:	e8 3d f9 ff ff       	call   801fb2 <fsring_slot>
+  802675:	85 c0                	test   %eax,%eax
+  802677:	78 60                	js     8026d9 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802679:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80267c:	8b 56 08             	mov    0x8(%esi),%edx
+  80267f:	83 e2 03             	and    $0x3,%edx
+  802682:	83 fa 01             	cmp    $0x1,%edx
+  802685:	74 59                	je     8026e0 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802687:	ba 01 00 00 00       	mov    $0x1,%edx
+  80268c:	89 c1                	mov    %eax,%ecx
+  80268e:	d3 e2                	shl    %cl,%edx
+  802690:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802696:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802699:	c1 e2 02             	shl    $0x2,%edx
+  80269c:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  8026a2:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  8026a9:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8026ac:	8b 55 18             	mov    0x18(%ebp),%edx
+  8026af:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8026b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8026b5:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8026b8:	83 ec 08             	sub    $0x8,%esp
+  8026bb:	50                   	push   %eax
+  8026bc:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8026c1:	39 c3                	cmp    %eax,%ebx
+  8026c3:	0f 47 d8             	cmova  %eax,%ebx
+  8026c6:	53                   	push   %ebx
+  8026c7:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8026ca:	89 f2                	mov    %esi,%edx
+  8026cc:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026d1:	e8 1e f5 ff ff       	call   801bf4 <fsring_post>
+  8026d6:	83 c4 10             	add    $0x10,%esp
+}
+  8026d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026dc:	5b                   	pop    %ebx
+  8026dd:	5e                   	pop    %esi
+  8026de:	5d                   	pop    %ebp
+  8026df:	c3                   	ret
+		return -E_INVAL;
+  8026e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026e5:	eb f2                	jmp    8026d9 <fsring_read+0x7a>
+
+008026e7 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8026e7:	55                   	push   %ebp
+  8026e8:	89 e5                	mov    %esp,%ebp
+  8026ea:	56                   	push   %esi
+  8026eb:	53                   	push   %ebx
+  8026ec:	83 ec 10             	sub    $0x10,%esp
+  8026ef:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8026f2:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f8:	e8 b5 f8 ff ff       	call   801fb2 <fsring_slot>
+  8026fd:	89 c3                	mov    %eax,%ebx
+  8026ff:	85 c0                	test   %eax,%eax
+  802701:	78 77                	js     80277a <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802703:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802706:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80270a:	74 77                	je     802783 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80270c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802711:	39 c6                	cmp    %eax,%esi
+  802713:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802716:	83 ec 04             	sub    $0x4,%esp
+  802719:	56                   	push   %esi
+  80271a:	ff 75 0c             	push   0xc(%ebp)
+  80271d:	89 d8                	mov    %ebx,%eax
+  80271f:	c1 e0 0c             	shl    $0xc,%eax
+  802722:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802728:	50                   	push   %eax
+  802729:	e8 56 e4 ff ff       	call   800b84 <memmove>
+	fsring_busy |= 1 << slot;
+  80272e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802733:	89 d9                	mov    %ebx,%ecx
+  802735:	d3 e0                	shl    %cl,%eax
+  802737:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  80273d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802740:	c1 e0 02             	shl    $0x2,%eax
+  802743:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  802749:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  802750:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802753:	8b 45 18             	mov    0x18(%ebp),%eax
+  802756:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  802759:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802760:	83 c4 08             	add    $0x8,%esp
+  802763:	53                   	push   %ebx
+  802764:	56                   	push   %esi
+  802765:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802768:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80276b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802770:	e8 7f f4 ff ff       	call   801bf4 <fsring_post>
+  802775:	89 c3                	mov    %eax,%ebx
+  802777:	83 c4 10             	add    $0x10,%esp
+}
+  80277a:	89 d8                	mov    %ebx,%eax
+  80277c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80277f:	5b                   	pop    %ebx
+  802780:	5e                   	pop    %esi
+  802781:	5d                   	pop    %ebp
+  802782:	c3                   	ret
+		return -E_INVAL;
+  802783:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802788:	eb f0                	jmp    80277a <fsring_write+0x93>
+
+0080278a <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80278a:	55                   	push   %ebp
+  80278b:	89 e5                	mov    %esp,%ebp
+  80278d:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802790:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802793:	8b 45 08             	mov    0x8(%ebp),%eax
+  802796:	e8 17 f8 ff ff       	call   801fb2 <fsring_slot>
+  80279b:	85 c0                	test   %eax,%eax
+  80279d:	78 4c                	js     8027eb <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  80279f:	ba 01 00 00 00       	mov    $0x1,%edx
+  8027a4:	89 c1                	mov    %eax,%ecx
+  8027a6:	d3 e2                	shl    %cl,%edx
+  8027a8:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8027ae:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8027b1:	c1 e2 02             	shl    $0x2,%edx
+  8027b4:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  8027ba:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  8027c1:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8027c4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027c7:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8027ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027cd:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  8027d0:	83 ec 08             	sub    $0x8,%esp
+  8027d3:	50                   	push   %eax
+  8027d4:	6a 00                	push   $0x0
+  8027d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027db:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027de:	b8 05 00 00 00       	mov    $0x5,%eax
+  8027e3:	e8 0c f4 ff ff       	call   801bf4 <fsring_post>
+  8027e8:	83 c4 10             	add    $0x10,%esp
+}
+  8027eb:	c9                   	leave
+  8027ec:	c3                   	ret
+
+008027ed <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8027ed:	55                   	push   %ebp
+  8027ee:	89 e5                	mov    %esp,%ebp
+  8027f0:	57                   	push   %edi
+  8027f1:	56                   	push   %esi
+  8027f2:	53                   	push   %ebx
+  8027f3:	83 ec 1c             	sub    $0x1c,%esp
+  8027f6:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8027fa:	a1 00 60 80 00       	mov    0x806000,%eax
+  8027ff:	8b 40 48             	mov    0x48(%eax),%eax
+  802802:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  802808:	74 12                	je     80281c <fsring_reap+0x2f>
+		return 0;
+  80280a:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  80280f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802812:	5b                   	pop    %ebx
+  802813:	5e                   	pop    %esi
+  802814:	5f                   	pop    %edi
+  802815:	5d                   	pop    %ebp
+  802816:	c3                   	ret
+		sys_yield();
+  802817:	e8 cf e5 ff ff       	call   800deb <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  80281c:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802822:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802827:	39 c2                	cmp    %eax,%edx
+  802829:	75 18                	jne    802843 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  80282b:	84 db                	test   %bl,%bl
+  80282d:	0f 84 21 01 00 00    	je     802954 <fsring_reap+0x167>
+  802833:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  80283a:	75 db                	jne    802817 <fsring_reap+0x2a>
+			return 0;
+  80283c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802841:	eb cc                	jmp    80280f <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802843:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802848:	83 e0 0f             	and    $0xf,%eax
+  80284b:	83 c0 2a             	add    $0x2a,%eax
+  80284e:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802855:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  80285c:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802861:	83 c0 01             	add    $0x1,%eax
+  802864:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802869:	83 fb 0f             	cmp    $0xf,%ebx
+  80286c:	77 5b                	ja     8028c9 <fsring_reap+0xdc>
+  80286e:	be 01 00 00 00       	mov    $0x1,%esi
+  802873:	89 d9                	mov    %ebx,%ecx
+  802875:	d3 e6                	shl    %cl,%esi
+  802877:	89 f0                	mov    %esi,%eax
+  802879:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  80287f:	74 48                	je     8028c9 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802881:	89 d8                	mov    %ebx,%eax
+  802883:	c1 e0 0c             	shl    $0xc,%eax
+  802886:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80288c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  80288f:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802892:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  802899:	83 f8 03             	cmp    $0x3,%eax
+  80289c:	74 40                	je     8028de <fsring_reap+0xf1>
+  80289e:	83 f8 05             	cmp    $0x5,%eax
+  8028a1:	74 64                	je     802907 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8028a3:	f7 d6                	not    %esi
+  8028a5:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8028ab:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8028ae:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  8028b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028b8:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8028ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028bd:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8028bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028c4:	e9 46 ff ff ff       	jmp    80280f <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8028c9:	53                   	push   %ebx
+  8028ca:	68 98 40 80 00       	push   $0x804098
+  8028cf:	68 8f 02 00 00       	push   $0x28f
+  8028d4:	68 70 40 80 00       	push   $0x804070
+  8028d9:	e8 57 da ff ff       	call   800335 <_panic>
+		if (cqe.cqe_result > 0)
+  8028de:	85 ff                	test   %edi,%edi
+  8028e0:	7e c1                	jle    8028a3 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8028e2:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8028e5:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8028ea:	39 c7                	cmp    %eax,%edi
+  8028ec:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8028ef:	50                   	push   %eax
+  8028f0:	ff 75 e4             	push   -0x1c(%ebp)
+  8028f3:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8028f6:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  8028fd:	e8 82 e2 ff ff       	call   800b84 <memmove>
+  802902:	83 c4 10             	add    $0x10,%esp
+  802905:	eb 9c                	jmp    8028a3 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802907:	85 ff                	test   %edi,%edi
+  802909:	75 98                	jne    8028a3 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80290b:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80290e:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802915:	83 ec 08             	sub    $0x8,%esp
+  802918:	ff 75 e4             	push   -0x1c(%ebp)
+  80291b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80291e:	51                   	push   %ecx
+  80291f:	e8 da e0 ff ff       	call   8009fe <strcpy>
+			st->st_size = ret->ret_size;
+  802924:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802927:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  80292d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802930:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802936:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  80293c:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802942:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  802949:	50 80 00 
+  80294c:	83 c4 10             	add    $0x10,%esp
+  80294f:	e9 4f ff ff ff       	jmp    8028a3 <fsring_reap+0xb6>
+			return 0;
+  802954:	b8 00 00 00 00       	mov    $0x0,%eax
+  802959:	e9 b1 fe ff ff       	jmp    80280f <fsring_reap+0x22>
+
+0080295e <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  80295e:	55                   	push   %ebp
+  80295f:	89 e5                	mov    %esp,%ebp
+  802961:	57                   	push   %edi
+  802962:	56                   	push   %esi
+  802963:	53                   	push   %ebx
+  802964:	83 ec 28             	sub    $0x28,%esp
+  802967:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80296a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80296d:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802970:	53                   	push   %ebx
+  802971:	e8 4d e0 ff ff       	call   8009c3 <strlen>
+  802976:	83 c4 10             	add    $0x10,%esp
+  802979:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80297e:	0f 8f 02 01 00 00    	jg     802a86 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802984:	83 ec 08             	sub    $0x8,%esp
+  802987:	53                   	push   %ebx
+  802988:	68 00 70 80 00       	push   $0x807000
+  80298d:	e8 6c e0 ff ff       	call   8009fe <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802992:	83 c4 10             	add    $0x10,%esp
+  802995:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  80299b:	76 69                	jbe    802a06 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80299d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029a0:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8029a6:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8029ab:	29 d1                	sub    %edx,%ecx
+  8029ad:	39 f9                	cmp    %edi,%ecx
+  8029af:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8029b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029b5:	89 f9                	mov    %edi,%ecx
+  8029b7:	01 c1                	add    %eax,%ecx
+  8029b9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8029bc:	eb 0f                	jmp    8029cd <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  8029be:	0f b6 10             	movzbl (%eax),%edx
+  8029c1:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8029c3:	05 00 10 00 00       	add    $0x1000,%eax
+  8029c8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8029cd:	39 c8                	cmp    %ecx,%eax
+  8029cf:	72 ed                	jb     8029be <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  8029d1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8029d4:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  8029da:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8029e0:	83 ec 0c             	sub    $0xc,%esp
+  8029e3:	6a 07                	push   $0x7
+  8029e5:	89 f9                	mov    %edi,%ecx
+  8029e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029ea:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8029ef:	e8 3f f1 ff ff       	call   801b33 <fsipc_pages>
+  8029f4:	89 c7                	mov    %eax,%edi
+  8029f6:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8029f9:	85 f6                	test   %esi,%esi
+  8029fb:	74 7f                	je     802a7c <file_slurp+0x11e>
+  8029fd:	8d 43 01             	lea    0x1(%ebx),%eax
+  802a00:	85 ff                	test   %edi,%edi
+  802a02:	79 3c                	jns    802a40 <file_slurp+0xe2>
+  802a04:	eb 76                	jmp    802a7c <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802a06:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802a0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a11:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802a16:	e8 ba f2 ff ff       	call   801cd5 <fsipc>
+  802a1b:	89 c7                	mov    %eax,%edi
+  802a1d:	85 c0                	test   %eax,%eax
+  802a1f:	7e d8                	jle    8029f9 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802a21:	83 ec 04             	sub    $0x4,%esp
+  802a24:	50                   	push   %eax
+  802a25:	68 08 70 80 00       	push   $0x807008
+  802a2a:	ff 75 0c             	push   0xc(%ebp)
+  802a2d:	e8 52 e1 ff ff       	call   800b84 <memmove>
+  802a32:	83 c4 10             	add    $0x10,%esp
+  802a35:	eb c2                	jmp    8029f9 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802a37:	80 fa 2f             	cmp    $0x2f,%dl
+  802a3a:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802a3d:	83 c0 01             	add    $0x1,%eax
+  802a40:	89 c1                	mov    %eax,%ecx
+  802a42:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802a46:	84 d2                	test   %dl,%dl
+  802a48:	75 ed                	jne    802a37 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802a4a:	83 ec 04             	sub    $0x4,%esp
+  802a4d:	68 80 00 00 00       	push   $0x80
+  802a52:	53                   	push   %ebx
+  802a53:	56                   	push   %esi
+  802a54:	e8 1b e0 ff ff       	call   800a74 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802a59:	a1 00 70 80 00       	mov    0x807000,%eax
+  802a5e:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802a64:	a1 04 70 80 00       	mov    0x807004,%eax
+  802a69:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802a6f:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  802a76:	50 80 00 
+  802a79:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802a7c:	89 f8                	mov    %edi,%eax
+  802a7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a81:	5b                   	pop    %ebx
+  802a82:	5e                   	pop    %esi
+  802a83:	5f                   	pop    %edi
+  802a84:	5d                   	pop    %ebp
+  802a85:	c3                   	ret
+		return -E_BAD_PATH;
+  802a86:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802a8b:	eb ef                	jmp    802a7c <file_slurp+0x11e>
+
+00802a8d <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802a8d:	55                   	push   %ebp
+  802a8e:	89 e5                	mov    %esp,%ebp
+  802a90:	53                   	push   %ebx
+  802a91:	83 ec 10             	sub    $0x10,%esp
+  802a94:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802a97:	53                   	push   %ebx
+  802a98:	e8 26 df ff ff       	call   8009c3 <strlen>
+  802a9d:	83 c4 10             	add    $0x10,%esp
+  802aa0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802aa5:	7f 25                	jg     802acc <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802aa7:	83 ec 08             	sub    $0x8,%esp
+  802aaa:	53                   	push   %ebx
+  802aab:	68 00 70 80 00       	push   $0x807000
+  802ab0:	e8 49 df ff ff       	call   8009fe <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802ab5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aba:	b8 07 00 00 00       	mov    $0x7,%eax
+  802abf:	e8 11 f2 ff ff       	call   801cd5 <fsipc>
+  802ac4:	83 c4 10             	add    $0x10,%esp
+}
+  802ac7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aca:	c9                   	leave
+  802acb:	c3                   	ret
+		return -E_BAD_PATH;
+  802acc:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802ad1:	eb f4                	jmp    802ac7 <remove+0x3a>
+
+00802ad3 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802ad3:	55                   	push   %ebp
+  802ad4:	89 e5                	mov    %esp,%ebp
+  802ad6:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802ad9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ade:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ae3:	e8 ed f1 ff ff       	call   801cd5 <fsipc>
+}
+  802ae8:	c9                   	leave
+  802ae9:	c3                   	ret
+
+00802aea <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802aea:	55                   	push   %ebp
+  802aeb:	89 e5                	mov    %esp,%ebp
+  802aed:	57                   	push   %edi
+  802aee:	56                   	push   %esi
+  802aef:	53                   	push   %ebx
+  802af0:	83 ec 18             	sub    $0x18,%esp
+  802af3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802af6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802af9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802afc:	57                   	push   %edi
+  802afd:	e8 c1 de ff ff       	call   8009c3 <strlen>
+  802b02:	83 c4 10             	add    $0x10,%esp
+  802b05:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802b0a:	7f 4c                	jg     802b58 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802b0c:	83 ec 08             	sub    $0x8,%esp
+  802b0f:	57                   	push   %edi
+  802b10:	68 00 70 80 00       	push   $0x807000
+  802b15:	e8 e4 de ff ff       	call   8009fe <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802b1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b1f:	b8 10 00 00 00       	mov    $0x10,%eax
+  802b24:	e8 ac f1 ff ff       	call   801cd5 <fsipc>
+  802b29:	83 c4 10             	add    $0x10,%esp
+  802b2c:	85 c0                	test   %eax,%eax
+  802b2e:	78 20                	js     802b50 <defrag+0x66>
+		return r;
+	if (before)
+  802b30:	85 f6                	test   %esi,%esi
+  802b32:	74 07                	je     802b3b <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802b34:	a1 00 70 80 00       	mov    0x807000,%eax
+  802b39:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802b40:	85 db                	test   %ebx,%ebx
+  802b42:	74 0c                	je     802b50 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802b44:	a1 04 70 80 00       	mov    0x807004,%eax
+  802b49:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b53:	5b                   	pop    %ebx
+  802b54:	5e                   	pop    %esi
+  802b55:	5f                   	pop    %edi
+  802b56:	5d                   	pop    %ebp
+  802b57:	c3                   	ret
+		return -E_BAD_PATH;
+  802b58:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802b5d:	eb f1                	jmp    802b50 <defrag+0x66>
+
+00802b5f <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802b5f:	55                   	push   %ebp
+  802b60:	89 e5                	mov    %esp,%ebp
+  802b62:	53                   	push   %ebx
+  802b63:	83 ec 04             	sub    $0x4,%esp
+  802b66:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802b69:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b6e:	b8 11 00 00 00       	mov    $0x11,%eax
+  802b73:	e8 5d f1 ff ff       	call   801cd5 <fsipc>
+  802b78:	85 c0                	test   %eax,%eax
+  802b7a:	78 34                	js     802bb0 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802b7c:	a1 00 70 80 00       	mov    0x807000,%eax
+  802b81:	89 03                	mov    %eax,(%ebx)
+  802b83:	a1 04 70 80 00       	mov    0x807004,%eax
+  802b88:	89 43 04             	mov    %eax,0x4(%ebx)
+  802b8b:	a1 08 70 80 00       	mov    0x807008,%eax
+  802b90:	89 43 08             	mov    %eax,0x8(%ebx)
+  802b93:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  802b98:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802b9b:	a1 10 70 80 00       	mov    0x807010,%eax
+  802ba0:	89 43 10             	mov    %eax,0x10(%ebx)
+  802ba3:	a1 14 70 80 00       	mov    0x807014,%eax
+  802ba8:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802bab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bb3:	c9                   	leave
+  802bb4:	c3                   	ret
+
+00802bb5 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802bb5:	55                   	push   %ebp
+  802bb6:	89 e5                	mov    %esp,%ebp
+  802bb8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802bbb:	68 b1 40 80 00       	push   $0x8040b1
+  802bc0:	ff 75 0c             	push   0xc(%ebp)
+  802bc3:	e8 36 de ff ff       	call   8009fe <strcpy>
+	return 0;
+}
+  802bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bcd:	c9                   	leave
+  802bce:	c3                   	ret
+
+00802bcf <devsock_close>:
+{
+  802bcf:	55                   	push   %ebp
+  802bd0:	89 e5                	mov    %esp,%ebp
+  802bd2:	53                   	push   %ebx
+  802bd3:	83 ec 10             	sub    $0x10,%esp
+  802bd6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802bd9:	53                   	push   %ebx
+  802bda:	e8 ca 0b 00 00       	call   8037a9 <pageref>
+  802bdf:	89 c2                	mov    %eax,%edx
+  802be1:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802be4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802be9:	83 fa 01             	cmp    $0x1,%edx
+  802bec:	74 05                	je     802bf3 <devsock_close+0x24>
+}
+  802bee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bf1:	c9                   	leave
+  802bf2:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802bf3:	83 ec 0c             	sub    $0xc,%esp
+  802bf6:	ff 73 0c             	push   0xc(%ebx)
+  802bf9:	e8 b7 02 00 00       	call   802eb5 <nsipc_close>
+  802bfe:	83 c4 10             	add    $0x10,%esp
+  802c01:	eb eb                	jmp    802bee <devsock_close+0x1f>
+
+00802c03 <devsock_write>:
+{
+  802c03:	55                   	push   %ebp
+  802c04:	89 e5                	mov    %esp,%ebp
+  802c06:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802c09:	6a 00                	push   $0x0
+  802c0b:	ff 75 10             	push   0x10(%ebp)
+  802c0e:	ff 75 0c             	push   0xc(%ebp)
+  802c11:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c14:	ff 70 0c             	push   0xc(%eax)
+  802c17:	e8 79 03 00 00       	call   802f95 <nsipc_send>
+}
+  802c1c:	c9                   	leave
+  802c1d:	c3                   	ret
+
+00802c1e <devsock_read>:
+{
+  802c1e:	55                   	push   %ebp
+  802c1f:	89 e5                	mov    %esp,%ebp
+  802c21:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802c24:	6a 00                	push   $0x0
+  802c26:	ff 75 10             	push   0x10(%ebp)
+  802c29:	ff 75 0c             	push   0xc(%ebp)
+  802c2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c2f:	ff 70 0c             	push   0xc(%eax)
+  802c32:	e8 ef 02 00 00       	call   802f26 <nsipc_recv>
+}
+  802c37:	c9                   	leave
+  802c38:	c3                   	ret
+
+00802c39 <fd2sockid>:
+{
+  802c39:	55                   	push   %ebp
+  802c3a:	89 e5                	mov    %esp,%ebp
+  802c3c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802c3f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802c42:	52                   	push   %edx
+  802c43:	50                   	push   %eax
+  802c44:	e8 54 e9 ff ff       	call   80159d <fd_lookup>
+  802c49:	83 c4 10             	add    $0x10,%esp
+  802c4c:	85 c0                	test   %eax,%eax
+  802c4e:	78 10                	js     802c60 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802c50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c53:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802c59:	39 08                	cmp    %ecx,(%eax)
+  802c5b:	75 05                	jne    802c62 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802c5d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802c60:	c9                   	leave
+  802c61:	c3                   	ret
+		return -E_NOT_SUPP;
+  802c62:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802c67:	eb f7                	jmp    802c60 <fd2sockid+0x27>
+
+00802c69 <alloc_sockfd>:
+{
+  802c69:	55                   	push   %ebp
+  802c6a:	89 e5                	mov    %esp,%ebp
+  802c6c:	56                   	push   %esi
+  802c6d:	53                   	push   %ebx
+  802c6e:	83 ec 1c             	sub    $0x1c,%esp
+  802c71:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802c73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c76:	50                   	push   %eax
+  802c77:	e8 cb e8 ff ff       	call   801547 <fd_alloc>
+  802c7c:	89 c3                	mov    %eax,%ebx
+  802c7e:	83 c4 10             	add    $0x10,%esp
+  802c81:	85 c0                	test   %eax,%eax
+  802c83:	78 43                	js     802cc8 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802c85:	83 ec 04             	sub    $0x4,%esp
+  802c88:	68 07 04 00 00       	push   $0x407
+  802c8d:	ff 75 f4             	push   -0xc(%ebp)
+  802c90:	6a 00                	push   $0x0
+  802c92:	e8 73 e1 ff ff       	call   800e0a <sys_page_alloc>
+  802c97:	89 c3                	mov    %eax,%ebx
+  802c99:	83 c4 10             	add    $0x10,%esp
+  802c9c:	85 c0                	test   %eax,%eax
+  802c9e:	78 28                	js     802cc8 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802ca0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ca3:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802ca9:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802cab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cae:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802cb5:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802cb8:	83 ec 0c             	sub    $0xc,%esp
+  802cbb:	50                   	push   %eax
+  802cbc:	e8 5f e8 ff ff       	call   801520 <fd2num>
+  802cc1:	89 c3                	mov    %eax,%ebx
+  802cc3:	83 c4 10             	add    $0x10,%esp
+  802cc6:	eb 0c                	jmp    802cd4 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802cc8:	83 ec 0c             	sub    $0xc,%esp
+  802ccb:	56                   	push   %esi
+  802ccc:	e8 e4 01 00 00       	call   802eb5 <nsipc_close>
+		return r;
+  802cd1:	83 c4 10             	add    $0x10,%esp
+}
+  802cd4:	89 d8                	mov    %ebx,%eax
+  802cd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cd9:	5b                   	pop    %ebx
+  802cda:	5e                   	pop    %esi
+  802cdb:	5d                   	pop    %ebp
+  802cdc:	c3                   	ret
+
+00802cdd <accept>:
+{
+  802cdd:	55                   	push   %ebp
+  802cde:	89 e5                	mov    %esp,%ebp
+  802ce0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ce3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce6:	e8 4e ff ff ff       	call   802c39 <fd2sockid>
+  802ceb:	85 c0                	test   %eax,%eax
+  802ced:	78 1b                	js     802d0a <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802cef:	83 ec 04             	sub    $0x4,%esp
+  802cf2:	ff 75 10             	push   0x10(%ebp)
+  802cf5:	ff 75 0c             	push   0xc(%ebp)
+  802cf8:	50                   	push   %eax
+  802cf9:	e8 0e 01 00 00       	call   802e0c <nsipc_accept>
+  802cfe:	83 c4 10             	add    $0x10,%esp
+  802d01:	85 c0                	test   %eax,%eax
+  802d03:	78 05                	js     802d0a <accept+0x2d>
+	return alloc_sockfd(r);
+  802d05:	e8 5f ff ff ff       	call   802c69 <alloc_sockfd>
+}
+  802d0a:	c9                   	leave
+  802d0b:	c3                   	ret
+
+00802d0c <bind>:
+{
+  802d0c:	55                   	push   %ebp
+  802d0d:	89 e5                	mov    %esp,%ebp
+  802d0f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d12:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d15:	e8 1f ff ff ff       	call   802c39 <fd2sockid>
+  802d1a:	85 c0                	test   %eax,%eax
+  802d1c:	78 12                	js     802d30 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802d1e:	83 ec 04             	sub    $0x4,%esp
+  802d21:	ff 75 10             	push   0x10(%ebp)
+  802d24:	ff 75 0c             	push   0xc(%ebp)
+  802d27:	50                   	push   %eax
+  802d28:	e8 31 01 00 00       	call   802e5e <nsipc_bind>
+  802d2d:	83 c4 10             	add    $0x10,%esp
+}
+  802d30:	c9                   	leave
+  802d31:	c3                   	ret
+
+00802d32 <shutdown>:
+{
+  802d32:	55                   	push   %ebp
+  802d33:	89 e5                	mov    %esp,%ebp
+  802d35:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d38:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d3b:	e8 f9 fe ff ff       	call   802c39 <fd2sockid>
+  802d40:	85 c0                	test   %eax,%eax
+  802d42:	78 0f                	js     802d53 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802d44:	83 ec 08             	sub    $0x8,%esp
+  802d47:	ff 75 0c             	push   0xc(%ebp)
+  802d4a:	50                   	push   %eax
+  802d4b:	e8 43 01 00 00       	call   802e93 <nsipc_shutdown>
+  802d50:	83 c4 10             	add    $0x10,%esp
+}
+  802d53:	c9                   	leave
+  802d54:	c3                   	ret
+
+00802d55 <connect>:
+{
+  802d55:	55                   	push   %ebp
+  802d56:	89 e5                	mov    %esp,%ebp
+  802d58:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d5e:	e8 d6 fe ff ff       	call   802c39 <fd2sockid>
+  802d63:	85 c0                	test   %eax,%eax
+  802d65:	78 12                	js     802d79 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802d67:	83 ec 04             	sub    $0x4,%esp
+  802d6a:	ff 75 10             	push   0x10(%ebp)
+  802d6d:	ff 75 0c             	push   0xc(%ebp)
+  802d70:	50                   	push   %eax
+  802d71:	e8 59 01 00 00       	call   802ecf <nsipc_connect>
+  802d76:	83 c4 10             	add    $0x10,%esp
+}
+  802d79:	c9                   	leave
+  802d7a:	c3                   	ret
+
+00802d7b <listen>:
+{
+  802d7b:	55                   	push   %ebp
+  802d7c:	89 e5                	mov    %esp,%ebp
+  802d7e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d81:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d84:	e8 b0 fe ff ff       	call   802c39 <fd2sockid>
+  802d89:	85 c0                	test   %eax,%eax
+  802d8b:	78 0f                	js     802d9c <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802d8d:	83 ec 08             	sub    $0x8,%esp
+  802d90:	ff 75 0c             	push   0xc(%ebp)
+  802d93:	50                   	push   %eax
+  802d94:	e8 6b 01 00 00       	call   802f04 <nsipc_listen>
+  802d99:	83 c4 10             	add    $0x10,%esp
+}
+  802d9c:	c9                   	leave
+  802d9d:	c3                   	ret
+
+00802d9e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802d9e:	55                   	push   %ebp
+  802d9f:	89 e5                	mov    %esp,%ebp
+  802da1:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802da4:	ff 75 10             	push   0x10(%ebp)
+  802da7:	ff 75 0c             	push   0xc(%ebp)
+  802daa:	ff 75 08             	push   0x8(%ebp)
+  802dad:	e8 41 02 00 00       	call   802ff3 <nsipc_socket>
+  802db2:	83 c4 10             	add    $0x10,%esp
+  802db5:	85 c0                	test   %eax,%eax
+  802db7:	78 05                	js     802dbe <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802db9:	e8 ab fe ff ff       	call   802c69 <alloc_sockfd>
+}
+  802dbe:	c9                   	leave
+  802dbf:	c3                   	ret
+
+00802dc0 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802dc0:	55                   	push   %ebp
+  802dc1:	89 e5                	mov    %esp,%ebp
+  802dc3:	53                   	push   %ebx
+  802dc4:	83 ec 04             	sub    $0x4,%esp
+  802dc7:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802dc9:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802dd0:	74 26                	je     802df8 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802dd2:	6a 07                	push   $0x7
+  802dd4:	68 00 90 80 00       	push   $0x809000
+  802dd9:	53                   	push   %ebx
+  802dda:	ff 35 00 a0 80 00    	push   0x80a000
+  802de0:	e8 4c 08 00 00       	call   803631 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802de5:	83 c4 0c             	add    $0xc,%esp
+  802de8:	6a 00                	push   $0x0
+  802dea:	6a 00                	push   $0x0
+  802dec:	6a 00                	push   $0x0
+  802dee:	e8 d3 07 00 00       	call   8035c6 <ipc_recv>
+}
+  802df3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802df6:	c9                   	leave
+  802df7:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802df8:	83 ec 0c             	sub    $0xc,%esp
+  802dfb:	6a 02                	push   $0x2
+  802dfd:	e8 68 09 00 00       	call   80376a <ipc_find_env>
+  802e02:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  802e07:	83 c4 10             	add    $0x10,%esp
+  802e0a:	eb c6                	jmp    802dd2 <nsipc+0x12>
+
+00802e0c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802e0c:	55                   	push   %ebp
+  802e0d:	89 e5                	mov    %esp,%ebp
+  802e0f:	56                   	push   %esi
+  802e10:	53                   	push   %ebx
+  802e11:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802e14:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e17:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802e1c:	8b 06                	mov    (%esi),%eax
+  802e1e:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802e23:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e28:	e8 93 ff ff ff       	call   802dc0 <nsipc>
+  802e2d:	89 c3                	mov    %eax,%ebx
+  802e2f:	85 c0                	test   %eax,%eax
+  802e31:	79 09                	jns    802e3c <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802e33:	89 d8                	mov    %ebx,%eax
+  802e35:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e38:	5b                   	pop    %ebx
+  802e39:	5e                   	pop    %esi
+  802e3a:	5d                   	pop    %ebp
+  802e3b:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802e3c:	83 ec 04             	sub    $0x4,%esp
+  802e3f:	ff 35 10 90 80 00    	push   0x809010
+  802e45:	68 00 90 80 00       	push   $0x809000
+  802e4a:	ff 75 0c             	push   0xc(%ebp)
+  802e4d:	e8 32 dd ff ff       	call   800b84 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802e52:	a1 10 90 80 00       	mov    0x809010,%eax
+  802e57:	89 06                	mov    %eax,(%esi)
+  802e59:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802e5c:	eb d5                	jmp    802e33 <nsipc_accept+0x27>
+
+00802e5e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802e5e:	55                   	push   %ebp
+  802e5f:	89 e5                	mov    %esp,%ebp
+  802e61:	53                   	push   %ebx
+  802e62:	83 ec 08             	sub    $0x8,%esp
+  802e65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802e68:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e6b:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802e70:	53                   	push   %ebx
+  802e71:	ff 75 0c             	push   0xc(%ebp)
+  802e74:	68 04 90 80 00       	push   $0x809004
+  802e79:	e8 06 dd ff ff       	call   800b84 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802e7e:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802e84:	b8 02 00 00 00       	mov    $0x2,%eax
+  802e89:	e8 32 ff ff ff       	call   802dc0 <nsipc>
+}
+  802e8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e91:	c9                   	leave
+  802e92:	c3                   	ret
+
+00802e93 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802e93:	55                   	push   %ebp
+  802e94:	89 e5                	mov    %esp,%ebp
+  802e96:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802e99:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e9c:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802ea1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ea4:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802ea9:	b8 03 00 00 00       	mov    $0x3,%eax
+  802eae:	e8 0d ff ff ff       	call   802dc0 <nsipc>
+}
+  802eb3:	c9                   	leave
+  802eb4:	c3                   	ret
+
+00802eb5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802eb5:	55                   	push   %ebp
+  802eb6:	89 e5                	mov    %esp,%ebp
+  802eb8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802ebb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ebe:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802ec3:	b8 04 00 00 00       	mov    $0x4,%eax
+  802ec8:	e8 f3 fe ff ff       	call   802dc0 <nsipc>
+}
+  802ecd:	c9                   	leave
+  802ece:	c3                   	ret
+
+00802ecf <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802ecf:	55                   	push   %ebp
+  802ed0:	89 e5                	mov    %esp,%ebp
+  802ed2:	53                   	push   %ebx
+  802ed3:	83 ec 08             	sub    $0x8,%esp
+  802ed6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802ed9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802edc:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802ee1:	53                   	push   %ebx
+  802ee2:	ff 75 0c             	push   0xc(%ebp)
+  802ee5:	68 04 90 80 00       	push   $0x809004
+  802eea:	e8 95 dc ff ff       	call   800b84 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802eef:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802ef5:	b8 05 00 00 00       	mov    $0x5,%eax
+  802efa:	e8 c1 fe ff ff       	call   802dc0 <nsipc>
+}
+  802eff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f02:	c9                   	leave
+  802f03:	c3                   	ret
+
+00802f04 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802f04:	55                   	push   %ebp
+  802f05:	89 e5                	mov    %esp,%ebp
+  802f07:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802f0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f0d:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802f12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f15:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802f1a:	b8 06 00 00 00       	mov    $0x6,%eax
+  802f1f:	e8 9c fe ff ff       	call   802dc0 <nsipc>
+}
+  802f24:	c9                   	leave
+  802f25:	c3                   	ret
+
+00802f26 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802f26:	55                   	push   %ebp
+  802f27:	89 e5                	mov    %esp,%ebp
+  802f29:	56                   	push   %esi
+  802f2a:	53                   	push   %ebx
+  802f2b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802f2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f31:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802f36:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802f3c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f3f:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802f44:	b8 07 00 00 00       	mov    $0x7,%eax
+  802f49:	e8 72 fe ff ff       	call   802dc0 <nsipc>
+  802f4e:	89 c3                	mov    %eax,%ebx
+  802f50:	85 c0                	test   %eax,%eax
+  802f52:	78 22                	js     802f76 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802f54:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802f59:	39 c6                	cmp    %eax,%esi
+  802f5b:	0f 4e c6             	cmovle %esi,%eax
+  802f5e:	39 c3                	cmp    %eax,%ebx
+  802f60:	7f 1d                	jg     802f7f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802f62:	83 ec 04             	sub    $0x4,%esp
+  802f65:	53                   	push   %ebx
+  802f66:	68 00 90 80 00       	push   $0x809000
+  802f6b:	ff 75 0c             	push   0xc(%ebp)
+  802f6e:	e8 11 dc ff ff       	call   800b84 <memmove>
+  802f73:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802f76:	89 d8                	mov    %ebx,%eax
+  802f78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f7b:	5b                   	pop    %ebx
+  802f7c:	5e                   	pop    %esi
+  802f7d:	5d                   	pop    %ebp
+  802f7e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802f7f:	68 bd 40 80 00       	push   $0x8040bd
+  802f84:	68 8c 3f 80 00       	push   $0x803f8c
+  802f89:	6a 62                	push   $0x62
+  802f8b:	68 d2 40 80 00       	push   $0x8040d2
+  802f90:	e8 a0 d3 ff ff       	call   800335 <_panic>
+
+00802f95 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802f95:	55                   	push   %ebp
+  802f96:	89 e5                	mov    %esp,%ebp
+  802f98:	53                   	push   %ebx
+  802f99:	83 ec 04             	sub    $0x4,%esp
+  802f9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802f9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fa2:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802fa7:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802fad:	7f 2e                	jg     802fdd <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802faf:	83 ec 04             	sub    $0x4,%esp
+  802fb2:	53                   	push   %ebx
+  802fb3:	ff 75 0c             	push   0xc(%ebp)
+  802fb6:	68 0c 90 80 00       	push   $0x80900c
+  802fbb:	e8 c4 db ff ff       	call   800b84 <memmove>
+	nsipcbuf.send.req_size = size;
+  802fc0:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802fc6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fc9:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802fce:	b8 08 00 00 00       	mov    $0x8,%eax
+  802fd3:	e8 e8 fd ff ff       	call   802dc0 <nsipc>
+}
+  802fd8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fdb:	c9                   	leave
+  802fdc:	c3                   	ret
+	assert(size < 1600);
+  802fdd:	68 de 40 80 00       	push   $0x8040de
+  802fe2:	68 8c 3f 80 00       	push   $0x803f8c
+  802fe7:	6a 6d                	push   $0x6d
+  802fe9:	68 d2 40 80 00       	push   $0x8040d2
+  802fee:	e8 42 d3 ff ff       	call   800335 <_panic>
+
+00802ff3 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802ff3:	55                   	push   %ebp
+  802ff4:	89 e5                	mov    %esp,%ebp
+  802ff6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802ff9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ffc:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  803001:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803004:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  803009:	8b 45 10             	mov    0x10(%ebp),%eax
+  80300c:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  803011:	b8 09 00 00 00       	mov    $0x9,%eax
+  803016:	e8 a5 fd ff ff       	call   802dc0 <nsipc>
+}
+  80301b:	c9                   	leave
+  80301c:	c3                   	ret
+
+0080301d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80301d:	55                   	push   %ebp
+  80301e:	89 e5                	mov    %esp,%ebp
+  803020:	56                   	push   %esi
+  803021:	53                   	push   %ebx
+  803022:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803025:	83 ec 0c             	sub    $0xc,%esp
+  803028:	ff 75 08             	push   0x8(%ebp)
+  80302b:	e8 00 e5 ff ff       	call   801530 <fd2data>
+  803030:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803032:	83 c4 08             	add    $0x8,%esp
+  803035:	68 ea 40 80 00       	push   $0x8040ea
+  80303a:	53                   	push   %ebx
+  80303b:	e8 be d9 ff ff       	call   8009fe <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803040:	8b 46 04             	mov    0x4(%esi),%eax
+  803043:	2b 06                	sub    (%esi),%eax
+  803045:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80304b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803052:	00 00 00 
+	stat->st_dev = &devpipe;
+  803055:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  80305c:	50 80 00 
+	return 0;
+}
+  80305f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803064:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803067:	5b                   	pop    %ebx
+  803068:	5e                   	pop    %esi
+  803069:	5d                   	pop    %ebp
+  80306a:	c3                   	ret
+
+0080306b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80306b:	55                   	push   %ebp
+  80306c:	89 e5                	mov    %esp,%ebp
+  80306e:	53                   	push   %ebx
+  80306f:	83 ec 0c             	sub    $0xc,%esp
+  803072:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803075:	53                   	push   %ebx
+  803076:	6a 00                	push   $0x0
+  803078:	e8 1a de ff ff       	call   800e97 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80307d:	89 1c 24             	mov    %ebx,(%esp)
+  803080:	e8 ab e4 ff ff       	call   801530 <fd2data>
+  803085:	83 c4 08             	add    $0x8,%esp
+  803088:	50                   	push   %eax
+  803089:	6a 00                	push   $0x0
+  80308b:	e8 07 de ff ff       	call   800e97 <sys_page_unmap>
+}
+  803090:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803093:	c9                   	leave
+  803094:	c3                   	ret
+
+00803095 <_pipeisclosed>:
+{
+  803095:	55                   	push   %ebp
+  803096:	89 e5                	mov    %esp,%ebp
+  803098:	57                   	push   %edi
+  803099:	56                   	push   %esi
+  80309a:	53                   	push   %ebx
+  80309b:	83 ec 1c             	sub    $0x1c,%esp
+  80309e:	89 c7                	mov    %eax,%edi
+  8030a0:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8030a2:	a1 00 60 80 00       	mov    0x806000,%eax
+  8030a7:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8030aa:	83 ec 0c             	sub    $0xc,%esp
+  8030ad:	57                   	push   %edi
+  8030ae:	e8 f6 06 00 00       	call   8037a9 <pageref>
+  8030b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030b6:	89 34 24             	mov    %esi,(%esp)
+  8030b9:	e8 eb 06 00 00       	call   8037a9 <pageref>
+		nn = thisenv->env_runs;
+  8030be:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8030c4:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8030c7:	83 c4 10             	add    $0x10,%esp
+  8030ca:	39 cb                	cmp    %ecx,%ebx
+  8030cc:	74 1b                	je     8030e9 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8030ce:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8030d1:	75 cf                	jne    8030a2 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8030d3:	8b 42 58             	mov    0x58(%edx),%eax
+  8030d6:	6a 01                	push   $0x1
+  8030d8:	50                   	push   %eax
+  8030d9:	53                   	push   %ebx
+  8030da:	68 f1 40 80 00       	push   $0x8040f1
+  8030df:	e8 2c d3 ff ff       	call   800410 <cprintf>
+  8030e4:	83 c4 10             	add    $0x10,%esp
+  8030e7:	eb b9                	jmp    8030a2 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8030e9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8030ec:	0f 94 c0             	sete   %al
+  8030ef:	0f b6 c0             	movzbl %al,%eax
+}
+  8030f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030f5:	5b                   	pop    %ebx
+  8030f6:	5e                   	pop    %esi
+  8030f7:	5f                   	pop    %edi
+  8030f8:	5d                   	pop    %ebp
+  8030f9:	c3                   	ret
+
+008030fa <devpipe_write>:
+{
+  8030fa:	55                   	push   %ebp
+  8030fb:	89 e5                	mov    %esp,%ebp
+  8030fd:	57                   	push   %edi
+  8030fe:	56                   	push   %esi
+  8030ff:	53                   	push   %ebx
+  803100:	83 ec 28             	sub    $0x28,%esp
+  803103:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  803106:	56                   	push   %esi
+  803107:	e8 24 e4 ff ff       	call   801530 <fd2data>
+  80310c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80310e:	83 c4 10             	add    $0x10,%esp
+  803111:	bf 00 00 00 00       	mov    $0x0,%edi
+  803116:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803119:	75 09                	jne    803124 <devpipe_write+0x2a>
+	return i;
+  80311b:	89 f8                	mov    %edi,%eax
+  80311d:	eb 23                	jmp    803142 <devpipe_write+0x48>
+			sys_yield();
+  80311f:	e8 c7 dc ff ff       	call   800deb <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803124:	8b 43 04             	mov    0x4(%ebx),%eax
+  803127:	8b 0b                	mov    (%ebx),%ecx
+  803129:	8d 51 20             	lea    0x20(%ecx),%edx
+  80312c:	39 d0                	cmp    %edx,%eax
+  80312e:	72 1a                	jb     80314a <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803130:	89 da                	mov    %ebx,%edx
+  803132:	89 f0                	mov    %esi,%eax
+  803134:	e8 5c ff ff ff       	call   803095 <_pipeisclosed>
+  803139:	85 c0                	test   %eax,%eax
+  80313b:	74 e2                	je     80311f <devpipe_write+0x25>
+				return 0;
+  80313d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803142:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803145:	5b                   	pop    %ebx
+  803146:	5e                   	pop    %esi
+  803147:	5f                   	pop    %edi
+  803148:	5d                   	pop    %ebp
+  803149:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80314a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80314d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803151:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803154:	89 c2                	mov    %eax,%edx
+  803156:	c1 fa 1f             	sar    $0x1f,%edx
+  803159:	89 d1                	mov    %edx,%ecx
+  80315b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80315e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803161:	83 e2 1f             	and    $0x1f,%edx
+  803164:	29 ca                	sub    %ecx,%edx
+  803166:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80316a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80316e:	83 c0 01             	add    $0x1,%eax
+  803171:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803174:	83 c7 01             	add    $0x1,%edi
+  803177:	eb 9d                	jmp    803116 <devpipe_write+0x1c>
+
+00803179 <devpipe_read>:
+{
+  803179:	55                   	push   %ebp
+  80317a:	89 e5                	mov    %esp,%ebp
+  80317c:	57                   	push   %edi
+  80317d:	56                   	push   %esi
+  80317e:	53                   	push   %ebx
+  80317f:	83 ec 18             	sub    $0x18,%esp
+  803182:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803185:	57                   	push   %edi
+  803186:	e8 a5 e3 ff ff       	call   801530 <fd2data>
+  80318b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80318d:	83 c4 10             	add    $0x10,%esp
+  803190:	be 00 00 00 00       	mov    $0x0,%esi
+  803195:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803198:	75 13                	jne    8031ad <devpipe_read+0x34>
+	return i;
+  80319a:	89 f0                	mov    %esi,%eax
+  80319c:	eb 02                	jmp    8031a0 <devpipe_read+0x27>
+				return i;
+  80319e:	89 f0                	mov    %esi,%eax
+}
+  8031a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031a3:	5b                   	pop    %ebx
+  8031a4:	5e                   	pop    %esi
+  8031a5:	5f                   	pop    %edi
+  8031a6:	5d                   	pop    %ebp
+  8031a7:	c3                   	ret
+			sys_yield();
+  8031a8:	e8 3e dc ff ff       	call   800deb <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8031ad:	8b 03                	mov    (%ebx),%eax
+  8031af:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8031b2:	75 18                	jne    8031cc <devpipe_read+0x53>
+			if (i > 0)
+  8031b4:	85 f6                	test   %esi,%esi
+  8031b6:	75 e6                	jne    80319e <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8031b8:	89 da                	mov    %ebx,%edx
+  8031ba:	89 f8                	mov    %edi,%eax
+  8031bc:	e8 d4 fe ff ff       	call   803095 <_pipeisclosed>
+  8031c1:	85 c0                	test   %eax,%eax
+  8031c3:	74 e3                	je     8031a8 <devpipe_read+0x2f>
+				return 0;
+  8031c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ca:	eb d4                	jmp    8031a0 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8031cc:	99                   	cltd
+  8031cd:	c1 ea 1b             	shr    $0x1b,%edx
+  8031d0:	01 d0                	add    %edx,%eax
+  8031d2:	83 e0 1f             	and    $0x1f,%eax
+  8031d5:	29 d0                	sub    %edx,%eax
+  8031d7:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8031dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031df:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8031e2:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8031e5:	83 c6 01             	add    $0x1,%esi
+  8031e8:	eb ab                	jmp    803195 <devpipe_read+0x1c>
+
+008031ea <pipe>:
+{
+  8031ea:	55                   	push   %ebp
+  8031eb:	89 e5                	mov    %esp,%ebp
+  8031ed:	56                   	push   %esi
+  8031ee:	53                   	push   %ebx
+  8031ef:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8031f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031f5:	50                   	push   %eax
+  8031f6:	e8 4c e3 ff ff       	call   801547 <fd_alloc>
+  8031fb:	89 c3                	mov    %eax,%ebx
+  8031fd:	83 c4 10             	add    $0x10,%esp
+  803200:	85 c0                	test   %eax,%eax
+  803202:	0f 88 23 01 00 00    	js     80332b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803208:	83 ec 04             	sub    $0x4,%esp
+  80320b:	68 07 04 00 00       	push   $0x407
+  803210:	ff 75 f4             	push   -0xc(%ebp)
+  803213:	6a 00                	push   $0x0
+  803215:	e8 f0 db ff ff       	call   800e0a <sys_page_alloc>
+  80321a:	89 c3                	mov    %eax,%ebx
+  80321c:	83 c4 10             	add    $0x10,%esp
+  80321f:	85 c0                	test   %eax,%eax
+  803221:	0f 88 04 01 00 00    	js     80332b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803227:	83 ec 0c             	sub    $0xc,%esp
+  80322a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80322d:	50                   	push   %eax
+  80322e:	e8 14 e3 ff ff       	call   801547 <fd_alloc>
+  803233:	89 c3                	mov    %eax,%ebx
+  803235:	83 c4 10             	add    $0x10,%esp
+  803238:	85 c0                	test   %eax,%eax
+  80323a:	0f 88 db 00 00 00    	js     80331b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803240:	83 ec 04             	sub    $0x4,%esp
+  803243:	68 07 04 00 00       	push   $0x407
+  803248:	ff 75 f0             	push   -0x10(%ebp)
+  80324b:	6a 00                	push   $0x0
+  80324d:	e8 b8 db ff ff       	call   800e0a <sys_page_alloc>
+  803252:	89 c3                	mov    %eax,%ebx
+  803254:	83 c4 10             	add    $0x10,%esp
+  803257:	85 c0                	test   %eax,%eax
+  803259:	0f 88 bc 00 00 00    	js     80331b <pipe+0x131>
+	va = fd2data(fd0);
+  80325f:	83 ec 0c             	sub    $0xc,%esp
+  803262:	ff 75 f4             	push   -0xc(%ebp)
+  803265:	e8 c6 e2 ff ff       	call   801530 <fd2data>
+  80326a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80326c:	83 c4 0c             	add    $0xc,%esp
+  80326f:	68 07 04 00 00       	push   $0x407
+  803274:	50                   	push   %eax
+  803275:	6a 00                	push   $0x0
+  803277:	e8 8e db ff ff       	call   800e0a <sys_page_alloc>
+  80327c:	89 c3                	mov    %eax,%ebx
+  80327e:	83 c4 10             	add    $0x10,%esp
+  803281:	85 c0                	test   %eax,%eax
+  803283:	0f 88 82 00 00 00    	js     80330b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803289:	83 ec 0c             	sub    $0xc,%esp
+  80328c:	ff 75 f0             	push   -0x10(%ebp)
+  80328f:	e8 9c e2 ff ff       	call   801530 <fd2data>
+  803294:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80329b:	50                   	push   %eax
+  80329c:	6a 00                	push   $0x0
+  80329e:	56                   	push   %esi
+  80329f:	6a 00                	push   $0x0
+  8032a1:	e8 af db ff ff       	call   800e55 <sys_page_map>
+  8032a6:	89 c3                	mov    %eax,%ebx
+  8032a8:	83 c4 20             	add    $0x20,%esp
+  8032ab:	85 c0                	test   %eax,%eax
+  8032ad:	78 4e                	js     8032fd <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8032af:	a1 60 50 80 00       	mov    0x805060,%eax
+  8032b4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032b7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8032b9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032bc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8032c3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8032c6:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8032c8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8032cb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8032d2:	83 ec 0c             	sub    $0xc,%esp
+  8032d5:	ff 75 f4             	push   -0xc(%ebp)
+  8032d8:	e8 43 e2 ff ff       	call   801520 <fd2num>
+  8032dd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032e0:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8032e2:	83 c4 04             	add    $0x4,%esp
+  8032e5:	ff 75 f0             	push   -0x10(%ebp)
+  8032e8:	e8 33 e2 ff ff       	call   801520 <fd2num>
+  8032ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032f0:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8032f3:	83 c4 10             	add    $0x10,%esp
+  8032f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032fb:	eb 2e                	jmp    80332b <pipe+0x141>
+	sys_page_unmap(0, va);
+  8032fd:	83 ec 08             	sub    $0x8,%esp
+  803300:	56                   	push   %esi
+  803301:	6a 00                	push   $0x0
+  803303:	e8 8f db ff ff       	call   800e97 <sys_page_unmap>
+  803308:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80330b:	83 ec 08             	sub    $0x8,%esp
+  80330e:	ff 75 f0             	push   -0x10(%ebp)
+  803311:	6a 00                	push   $0x0
+  803313:	e8 7f db ff ff       	call   800e97 <sys_page_unmap>
+  803318:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80331b:	83 ec 08             	sub    $0x8,%esp
+  80331e:	ff 75 f4             	push   -0xc(%ebp)
+  803321:	6a 00                	push   $0x0
+  803323:	e8 6f db ff ff       	call   800e97 <sys_page_unmap>
+  803328:	83 c4 10             	add    $0x10,%esp
+}
+  80332b:	89 d8                	mov    %ebx,%eax
+  80332d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803330:	5b                   	pop    %ebx
+  803331:	5e                   	pop    %esi
+  803332:	5d                   	pop    %ebp
+  803333:	c3                   	ret
+
+00803334 <pipeisclosed>:
+{
+  803334:	55                   	push   %ebp
+  803335:	89 e5                	mov    %esp,%ebp
+  803337:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80333a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80333d:	50                   	push   %eax
+  80333e:	ff 75 08             	push   0x8(%ebp)
+  803341:	e8 57 e2 ff ff       	call   80159d <fd_lookup>
+  803346:	83 c4 10             	add    $0x10,%esp
+  803349:	85 c0                	test   %eax,%eax
+  80334b:	78 18                	js     803365 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80334d:	83 ec 0c             	sub    $0xc,%esp
+  803350:	ff 75 f4             	push   -0xc(%ebp)
+  803353:	e8 d8 e1 ff ff       	call   801530 <fd2data>
+  803358:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80335a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80335d:	e8 33 fd ff ff       	call   803095 <_pipeisclosed>
+  803362:	83 c4 10             	add    $0x10,%esp
+}
+  803365:	c9                   	leave
+  803366:	c3                   	ret
+
+00803367 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803367:	55                   	push   %ebp
+  803368:	89 e5                	mov    %esp,%ebp
+  80336a:	56                   	push   %esi
+  80336b:	53                   	push   %ebx
+  80336c:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  80336f:	85 f6                	test   %esi,%esi
+  803371:	74 16                	je     803389 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  803373:	89 f3                	mov    %esi,%ebx
+  803375:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80337b:	69 db 8c 00 00 00    	imul   $0x8c,%ebx,%ebx
+  803381:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803387:	eb 1b                	jmp    8033a4 <wait+0x3d>
+	assert(envid != 0);
+  803389:	68 09 41 80 00       	push   $0x804109
+  80338e:	68 8c 3f 80 00       	push   $0x803f8c
+  803393:	6a 09                	push   $0x9
+  803395:	68 14 41 80 00       	push   $0x804114
+  80339a:	e8 96 cf ff ff       	call   800335 <_panic>
+		sys_yield();
+  80339f:	e8 47 da ff ff       	call   800deb <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8033a4:	8b 43 48             	mov    0x48(%ebx),%eax
+  8033a7:	39 f0                	cmp    %esi,%eax
+  8033a9:	75 07                	jne    8033b2 <wait+0x4b>
+  8033ab:	8b 43 54             	mov    0x54(%ebx),%eax
+  8033ae:	85 c0                	test   %eax,%eax
+  8033b0:	75 ed                	jne    80339f <wait+0x38>
+}
+  8033b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033b5:	5b                   	pop    %ebx
+  8033b6:	5e                   	pop    %esi
+  8033b7:	5d                   	pop    %ebp
+  8033b8:	c3                   	ret
+
+008033b9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8033b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033be:	c3                   	ret
+
+008033bf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8033bf:	55                   	push   %ebp
+  8033c0:	89 e5                	mov    %esp,%ebp
+  8033c2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8033c5:	68 1f 41 80 00       	push   $0x80411f
+  8033ca:	ff 75 0c             	push   0xc(%ebp)
+  8033cd:	e8 2c d6 ff ff       	call   8009fe <strcpy>
+	return 0;
+}
+  8033d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d7:	c9                   	leave
+  8033d8:	c3                   	ret
+
+008033d9 <devcons_write>:
+{
+  8033d9:	55                   	push   %ebp
+  8033da:	89 e5                	mov    %esp,%ebp
+  8033dc:	57                   	push   %edi
+  8033dd:	56                   	push   %esi
+  8033de:	53                   	push   %ebx
+  8033df:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8033e5:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8033ea:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8033f0:	eb 2e                	jmp    803420 <devcons_write+0x47>
+		m = n - tot;
+  8033f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033f5:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8033f7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8033fc:	39 c3                	cmp    %eax,%ebx
+  8033fe:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803401:	83 ec 04             	sub    $0x4,%esp
+  803404:	53                   	push   %ebx
+  803405:	89 f0                	mov    %esi,%eax
+  803407:	03 45 0c             	add    0xc(%ebp),%eax
+  80340a:	50                   	push   %eax
+  80340b:	57                   	push   %edi
+  80340c:	e8 73 d7 ff ff       	call   800b84 <memmove>
+		sys_cputs(buf, m);
+  803411:	83 c4 08             	add    $0x8,%esp
+  803414:	53                   	push   %ebx
+  803415:	57                   	push   %edi
+  803416:	e8 13 d9 ff ff       	call   800d2e <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80341b:	01 de                	add    %ebx,%esi
+  80341d:	83 c4 10             	add    $0x10,%esp
+  803420:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803423:	72 cd                	jb     8033f2 <devcons_write+0x19>
+}
+  803425:	89 f0                	mov    %esi,%eax
+  803427:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80342a:	5b                   	pop    %ebx
+  80342b:	5e                   	pop    %esi
+  80342c:	5f                   	pop    %edi
+  80342d:	5d                   	pop    %ebp
+  80342e:	c3                   	ret
+
+0080342f <devcons_read>:
+{
+  80342f:	55                   	push   %ebp
+  803430:	89 e5                	mov    %esp,%ebp
+  803432:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803435:	b8 00 00 00 00       	mov    $0x0,%eax
+  80343a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80343e:	75 07                	jne    803447 <devcons_read+0x18>
+  803440:	eb 1f                	jmp    803461 <devcons_read+0x32>
+		sys_yield();
+  803442:	e8 a4 d9 ff ff       	call   800deb <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803447:	e8 08 d9 ff ff       	call   800d54 <sys_cgetc>
+  80344c:	85 c0                	test   %eax,%eax
+  80344e:	74 f2                	je     803442 <devcons_read+0x13>
+	if (c < 0)
+  803450:	78 0f                	js     803461 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803452:	83 f8 04             	cmp    $0x4,%eax
+  803455:	74 0c                	je     803463 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803457:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80345a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80345c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803461:	c9                   	leave
+  803462:	c3                   	ret
+		return 0;
+  803463:	b8 00 00 00 00       	mov    $0x0,%eax
+  803468:	eb f7                	jmp    803461 <devcons_read+0x32>
+
+0080346a <cputchar>:
+{
+  80346a:	55                   	push   %ebp
+  80346b:	89 e5                	mov    %esp,%ebp
+  80346d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803470:	8b 45 08             	mov    0x8(%ebp),%eax
+  803473:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803476:	6a 01                	push   $0x1
+  803478:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80347b:	50                   	push   %eax
+  80347c:	e8 ad d8 ff ff       	call   800d2e <sys_cputs>
+}
+  803481:	83 c4 10             	add    $0x10,%esp
+  803484:	c9                   	leave
+  803485:	c3                   	ret
+
+00803486 <getchar>:
+{
+  803486:	55                   	push   %ebp
+  803487:	89 e5                	mov    %esp,%ebp
+  803489:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80348c:	6a 01                	push   $0x1
+  80348e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803491:	50                   	push   %eax
+  803492:	6a 00                	push   $0x0
+  803494:	e8 6a e3 ff ff       	call   801803 <read>
+	if (r < 0)
+  803499:	83 c4 10             	add    $0x10,%esp
+  80349c:	85 c0                	test   %eax,%eax
+  80349e:	78 06                	js     8034a6 <getchar+0x20>
+	if (r < 1)
+  8034a0:	74 06                	je     8034a8 <getchar+0x22>
+	return c;
+  8034a2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8034a6:	c9                   	leave
+  8034a7:	c3                   	ret
+		return -E_EOF;
+  8034a8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8034ad:	eb f7                	jmp    8034a6 <getchar+0x20>
+
+008034af <iscons>:
+{
+  8034af:	55                   	push   %ebp
+  8034b0:	89 e5                	mov    %esp,%ebp
+  8034b2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8034b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034b8:	50                   	push   %eax
+  8034b9:	ff 75 08             	push   0x8(%ebp)
+  8034bc:	e8 dc e0 ff ff       	call   80159d <fd_lookup>
+  8034c1:	83 c4 10             	add    $0x10,%esp
+  8034c4:	85 c0                	test   %eax,%eax
+  8034c6:	78 11                	js     8034d9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8034c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034cb:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8034d1:	39 10                	cmp    %edx,(%eax)
+  8034d3:	0f 94 c0             	sete   %al
+  8034d6:	0f b6 c0             	movzbl %al,%eax
+}
+  8034d9:	c9                   	leave
+  8034da:	c3                   	ret
+
+008034db <opencons>:
+{
+  8034db:	55                   	push   %ebp
+  8034dc:	89 e5                	mov    %esp,%ebp
+  8034de:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8034e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034e4:	50                   	push   %eax
+  8034e5:	e8 5d e0 ff ff       	call   801547 <fd_alloc>
+  8034ea:	83 c4 10             	add    $0x10,%esp
+  8034ed:	85 c0                	test   %eax,%eax
+  8034ef:	78 3a                	js     80352b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8034f1:	83 ec 04             	sub    $0x4,%esp
+  8034f4:	68 07 04 00 00       	push   $0x407
+  8034f9:	ff 75 f4             	push   -0xc(%ebp)
+  8034fc:	6a 00                	push   $0x0
+  8034fe:	e8 07 d9 ff ff       	call   800e0a <sys_page_alloc>
+  803503:	83 c4 10             	add    $0x10,%esp
+  803506:	85 c0                	test   %eax,%eax
+  803508:	78 21                	js     80352b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80350a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80350d:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803513:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803515:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803518:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80351f:	83 ec 0c             	sub    $0xc,%esp
+  803522:	50                   	push   %eax
+  803523:	e8 f8 df ff ff       	call   801520 <fd2num>
+  803528:	83 c4 10             	add    $0x10,%esp
+}
+  80352b:	c9                   	leave
+  80352c:	c3                   	ret
+
+0080352d <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80352d:	55                   	push   %ebp
+  80352e:	89 e5                	mov    %esp,%ebp
+  803530:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803533:	83 3d 04 a0 80 00 00 	cmpl   $0x0,0x80a004
+  80353a:	74 0a                	je     803546 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80353c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80353f:	a3 04 a0 80 00       	mov    %eax,0x80a004
+}
+  803544:	c9                   	leave
+  803545:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803546:	83 ec 04             	sub    $0x4,%esp
+  803549:	6a 07                	push   $0x7
+  80354b:	68 00 f0 bf ee       	push   $0xeebff000
+  803550:	6a 00                	push   $0x0
+  803552:	e8 b3 d8 ff ff       	call   800e0a <sys_page_alloc>
+  803557:	83 c4 10             	add    $0x10,%esp
+  80355a:	85 c0                	test   %eax,%eax
+  80355c:	75 2c                	jne    80358a <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80355e:	83 ec 08             	sub    $0x8,%esp
+  803561:	68 a0 35 80 00       	push   $0x8035a0
+  803566:	6a 00                	push   $0x0
+  803568:	e8 08 da ff ff       	call   800f75 <sys_env_set_pgfault_upcall>
+  80356d:	83 c4 10             	add    $0x10,%esp
+  803570:	85 c0                	test   %eax,%eax
+  803572:	74 c8                	je     80353c <set_pgfault_handler+0xf>
+  803574:	68 74 41 80 00       	push   $0x804174
+  803579:	68 8c 3f 80 00       	push   $0x803f8c
+  80357e:	6a 20                	push   $0x20
+  803580:	68 a4 41 80 00       	push   $0x8041a4
+  803585:	e8 ab cd ff ff       	call   800335 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80358a:	68 2c 41 80 00       	push   $0x80412c
+  80358f:	68 8c 3f 80 00       	push   $0x803f8c
+  803594:	6a 1e                	push   $0x1e
+  803596:	68 a4 41 80 00       	push   $0x8041a4
+  80359b:	e8 95 cd ff ff       	call   800335 <_panic>
+
+008035a0 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8035a0:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8035a1:	a1 04 a0 80 00       	mov    0x80a004,%eax
+	call *%eax
+  8035a6:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8035a8:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8035ab:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8035b0:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8035b5:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8035b9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8035bc:	83 c4 08             	add    $0x8,%esp
+	popal
+  8035bf:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8035c0:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8035c3:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8035c4:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8035c5:	c3                   	ret
+
+008035c6 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8035c6:	55                   	push   %ebp
+  8035c7:	89 e5                	mov    %esp,%ebp
+  8035c9:	56                   	push   %esi
+  8035ca:	53                   	push   %ebx
+  8035cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8035d4:	85 c0                	test   %eax,%eax
+  8035d6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8035db:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8035de:	83 ec 0c             	sub    $0xc,%esp
+  8035e1:	50                   	push   %eax
+  8035e2:	e8 6b da ff ff       	call   801052 <sys_ipc_recv>
+	if (from_env_store)
+  8035e7:	83 c4 10             	add    $0x10,%esp
+  8035ea:	85 f6                	test   %esi,%esi
+  8035ec:	74 14                	je     803602 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8035ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035f3:	85 c0                	test   %eax,%eax
+  8035f5:	75 09                	jne    803600 <ipc_recv+0x3a>
+  8035f7:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8035fd:	8b 52 74             	mov    0x74(%edx),%edx
+  803600:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803602:	85 db                	test   %ebx,%ebx
+  803604:	74 25                	je     80362b <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803606:	85 c0                	test   %eax,%eax
+  803608:	74 0d                	je     803617 <ipc_recv+0x51>
+  80360a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803610:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803613:	5b                   	pop    %ebx
+  803614:	5e                   	pop    %esi
+  803615:	5d                   	pop    %ebp
+  803616:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803617:	a1 00 60 80 00       	mov    0x806000,%eax
+  80361c:	8b 40 78             	mov    0x78(%eax),%eax
+  80361f:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803621:	a1 00 60 80 00       	mov    0x806000,%eax
+  803626:	8b 40 70             	mov    0x70(%eax),%eax
+  803629:	eb e5                	jmp    803610 <ipc_recv+0x4a>
+  80362b:	85 c0                	test   %eax,%eax
+  80362d:	75 e1                	jne    803610 <ipc_recv+0x4a>
+  80362f:	eb f0                	jmp    803621 <ipc_recv+0x5b>
+
+00803631 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803631:	55                   	push   %ebp
+  803632:	89 e5                	mov    %esp,%ebp
+  803634:	57                   	push   %edi
+  803635:	56                   	push   %esi
+  803636:	53                   	push   %ebx
+  803637:	83 ec 0c             	sub    $0xc,%esp
+  80363a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80363d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803640:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803643:	85 db                	test   %ebx,%ebx
+  803645:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80364a:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80364d:	ff 75 14             	push   0x14(%ebp)
+  803650:	53                   	push   %ebx
+  803651:	56                   	push   %esi
+  803652:	57                   	push   %edi
+  803653:	e8 67 d9 ff ff       	call   800fbf <sys_ipc_try_send>
+  803658:	83 c4 10             	add    $0x10,%esp
+  80365b:	85 c0                	test   %eax,%eax
+  80365d:	74 22                	je     803681 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  80365f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803662:	75 07                	jne    80366b <ipc_send+0x3a>
+		sys_yield();
+  803664:	e8 82 d7 ff ff       	call   800deb <sys_yield>
+  803669:	eb e2                	jmp    80364d <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80366b:	68 b2 41 80 00       	push   $0x8041b2
+  803670:	68 8c 3f 80 00       	push   $0x803f8c
+  803675:	6a 39                	push   $0x39
+  803677:	68 c7 41 80 00       	push   $0x8041c7
+  80367c:	e8 b4 cc ff ff       	call   800335 <_panic>
+	}
+}
+  803681:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803684:	5b                   	pop    %ebx
+  803685:	5e                   	pop    %esi
+  803686:	5f                   	pop    %edi
+  803687:	5d                   	pop    %ebp
+  803688:	c3                   	ret
+
+00803689 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803689:	55                   	push   %ebp
+  80368a:	89 e5                	mov    %esp,%ebp
+  80368c:	57                   	push   %edi
+  80368d:	56                   	push   %esi
+  80368e:	53                   	push   %ebx
+  80368f:	83 ec 10             	sub    $0x10,%esp
+  803692:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803695:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803698:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80369b:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80369e:	85 c0                	test   %eax,%eax
+  8036a0:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8036a5:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8036a8:	6a 00                	push   $0x0
+  8036aa:	ff 33                	push   (%ebx)
+  8036ac:	50                   	push   %eax
+  8036ad:	e8 5d d9 ff ff       	call   80100f <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8036b2:	83 c4 10             	add    $0x10,%esp
+  8036b5:	85 c0                	test   %eax,%eax
+  8036b7:	75 3c                	jne    8036f5 <ipc_recvv+0x6c>
+  8036b9:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8036bf:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8036c2:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8036c4:	85 ff                	test   %edi,%edi
+  8036c6:	74 4e                	je     803716 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8036c8:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8036ce:	8b 52 74             	mov    0x74(%edx),%edx
+  8036d1:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8036d3:	85 f6                	test   %esi,%esi
+  8036d5:	74 18                	je     8036ef <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8036d7:	85 c0                	test   %eax,%eax
+  8036d9:	75 2d                	jne    803708 <ipc_recvv+0x7f>
+  8036db:	a1 00 60 80 00       	mov    0x806000,%eax
+  8036e0:	8b 40 78             	mov    0x78(%eax),%eax
+  8036e3:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8036e5:	a1 00 60 80 00       	mov    0x806000,%eax
+  8036ea:	8b 40 70             	mov    0x70(%eax),%eax
+  8036ed:	eb 1f                	jmp    80370e <ipc_recvv+0x85>
+  8036ef:	85 c0                	test   %eax,%eax
+  8036f1:	75 1b                	jne    80370e <ipc_recvv+0x85>
+  8036f3:	eb f0                	jmp    8036e5 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8036f5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8036fb:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803700:	85 ff                	test   %edi,%edi
+  803702:	75 cd                	jne    8036d1 <ipc_recvv+0x48>
+	if (perm_store)
+  803704:	85 f6                	test   %esi,%esi
+  803706:	74 e7                	je     8036ef <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803708:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80370e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803711:	5b                   	pop    %ebx
+  803712:	5e                   	pop    %esi
+  803713:	5f                   	pop    %edi
+  803714:	5d                   	pop    %ebp
+  803715:	c3                   	ret
+	if (perm_store)
+  803716:	85 f6                	test   %esi,%esi
+  803718:	75 bd                	jne    8036d7 <ipc_recvv+0x4e>
+  80371a:	eb c9                	jmp    8036e5 <ipc_recvv+0x5c>
+
+0080371c <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  80371c:	55                   	push   %ebp
+  80371d:	89 e5                	mov    %esp,%ebp
+  80371f:	57                   	push   %edi
+  803720:	56                   	push   %esi
+  803721:	53                   	push   %ebx
+  803722:	83 ec 0c             	sub    $0xc,%esp
+  803725:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803728:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80372b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  80372e:	ff 75 14             	push   0x14(%ebp)
+  803731:	53                   	push   %ebx
+  803732:	56                   	push   %esi
+  803733:	57                   	push   %edi
+  803734:	e8 ae d8 ff ff       	call   800fe7 <sys_ipc_try_sendv>
+  803739:	83 c4 10             	add    $0x10,%esp
+  80373c:	85 c0                	test   %eax,%eax
+  80373e:	74 22                	je     803762 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803740:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803743:	75 07                	jne    80374c <ipc_sendv+0x30>
+		sys_yield();
+  803745:	e8 a1 d6 ff ff       	call   800deb <sys_yield>
+  80374a:	eb e2                	jmp    80372e <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  80374c:	68 b2 41 80 00       	push   $0x8041b2
+  803751:	68 8c 3f 80 00       	push   $0x803f8c
+  803756:	6a 5c                	push   $0x5c
+  803758:	68 c7 41 80 00       	push   $0x8041c7
+  80375d:	e8 d3 cb ff ff       	call   800335 <_panic>
+	}
+}
+  803762:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803765:	5b                   	pop    %ebx
+  803766:	5e                   	pop    %esi
+  803767:	5f                   	pop    %edi
+  803768:	5d                   	pop    %ebp
+  803769:	c3                   	ret
+
+0080376a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80376a:	55                   	push   %ebp
+  80376b:	89 e5                	mov    %esp,%ebp
+  80376d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803770:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803775:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80377b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803781:	8b 52 50             	mov    0x50(%edx),%edx
+  803784:	39 ca                	cmp    %ecx,%edx
+  803786:	74 11                	je     803799 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803788:	83 c0 01             	add    $0x1,%eax
+  80378b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803790:	75 e3                	jne    803775 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803792:	b8 00 00 00 00       	mov    $0x0,%eax
+  803797:	eb 0e                	jmp    8037a7 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803799:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80379f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8037a4:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8037a7:	5d                   	pop    %ebp
+  8037a8:	c3                   	ret
+
+008037a9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8037a9:	55                   	push   %ebp
+  8037aa:	89 e5                	mov    %esp,%ebp
+  8037ac:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8037af:	89 c2                	mov    %eax,%edx
+  8037b1:	c1 ea 16             	shr    $0x16,%edx
+  8037b4:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8037bb:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8037c0:	f6 c1 01             	test   $0x1,%cl
+  8037c3:	74 22                	je     8037e7 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8037c5:	c1 e8 0c             	shr    $0xc,%eax
+  8037c8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8037cf:	a8 01                	test   $0x1,%al
+  8037d1:	74 14                	je     8037e7 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8037d3:	c1 e8 0c             	shr    $0xc,%eax
+  8037d6:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8037d9:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8037e0:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8037e4:	0f b7 d2             	movzwl %dx,%edx
+}
+  8037e7:	89 d0                	mov    %edx,%eax
+  8037e9:	5d                   	pop    %ebp
+  8037ea:	c3                   	ret
+
+008037eb <dm>:
+  8037eb:	55                   	push   %ebp
+  8037ec:	57                   	push   %edi
+  8037ed:	56                   	push   %esi
+  8037ee:	53                   	push   %ebx
+  8037ef:	83 ec 24             	sub    $0x24,%esp
+  8037f2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8037f6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8037fa:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8037fe:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803802:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803806:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80380a:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80380e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803813:	b8 00 00 00 00       	mov    $0x0,%eax
+  803818:	ba 00 00 00 00       	mov    $0x0,%edx
+  80381d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803824:	00 
+  803825:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80382c:	00 
+  80382d:	89 fb                	mov    %edi,%ebx
+  80382f:	eb 08                	jmp    803839 <dm+0x4e>
+  803831:	83 e9 01             	sub    $0x1,%ecx
+  803834:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803837:	74 68                	je     8038a1 <dm+0xb6>
+  803839:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80383d:	01 c0                	add    %eax,%eax
+  80383f:	89 c6                	mov    %eax,%esi
+  803841:	89 d7                	mov    %edx,%edi
+  803843:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803847:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80384b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80384e:	d3 ea                	shr    %cl,%edx
+  803850:	f6 c1 20             	test   $0x20,%cl
+  803853:	74 04                	je     803859 <dm+0x6e>
+  803855:	89 d0                	mov    %edx,%eax
+  803857:	31 d2                	xor    %edx,%edx
+  803859:	83 e0 01             	and    $0x1,%eax
+  80385c:	89 04 24             	mov    %eax,(%esp)
+  80385f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803866:	00 
+  803867:	8b 04 24             	mov    (%esp),%eax
+  80386a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80386e:	09 f0                	or     %esi,%eax
+  803870:	09 fa                	or     %edi,%edx
+  803872:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803876:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80387a:	39 f0                	cmp    %esi,%eax
+  80387c:	89 d5                	mov    %edx,%ebp
+  80387e:	19 fd                	sbb    %edi,%ebp
+  803880:	72 af                	jb     803831 <dm+0x46>
+  803882:	29 f0                	sub    %esi,%eax
+  803884:	19 fa                	sbb    %edi,%edx
+  803886:	89 cf                	mov    %ecx,%edi
+  803888:	c1 ef 05             	shr    $0x5,%edi
+  80388b:	83 e7 01             	and    $0x1,%edi
+  80388e:	89 fe                	mov    %edi,%esi
+  803890:	83 f6 01             	xor    $0x1,%esi
+  803893:	d3 e6                	shl    %cl,%esi
+  803895:	d3 e7                	shl    %cl,%edi
+  803897:	09 74 24 18          	or     %esi,0x18(%esp)
+  80389b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80389f:	eb 90                	jmp    803831 <dm+0x46>
+  8038a1:	85 db                	test   %ebx,%ebx
+  8038a3:	74 05                	je     8038aa <dm+0xbf>
+  8038a5:	89 03                	mov    %eax,(%ebx)
+  8038a7:	89 53 04             	mov    %edx,0x4(%ebx)
+  8038aa:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8038ae:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8038b2:	83 c4 24             	add    $0x24,%esp
+  8038b5:	5b                   	pop    %ebx
+  8038b6:	5e                   	pop    %esi
+  8038b7:	5f                   	pop    %edi
+  8038b8:	5d                   	pop    %ebp
+  8038b9:	c3                   	ret
+
+008038ba <__udivdi3>:
+  8038ba:	83 ec 08             	sub    $0x8,%esp
+  8038bd:	6a 00                	push   $0x0
+  8038bf:	ff 74 24 1c          	push   0x1c(%esp)
+  8038c3:	ff 74 24 1c          	push   0x1c(%esp)
+  8038c7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8038cb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8038cf:	e8 17 ff ff ff       	call   8037eb <dm>
+  8038d4:	83 c4 14             	add    $0x14,%esp
+  8038d7:	c3                   	ret
+
+008038d8 <__umoddi3>:
+  8038d8:	83 ec 18             	sub    $0x18,%esp
+  8038db:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8038df:	50                   	push   %eax
+  8038e0:	ff 74 24 2c          	push   0x2c(%esp)
+  8038e4:	ff 74 24 2c          	push   0x2c(%esp)
+  8038e8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8038ec:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038f0:	e8 f6 fe ff ff       	call   8037eb <dm>
+  8038f5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8038f9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8038fd:	83 c4 24             	add    $0x24,%esp
+  803900:	c3                   	ret
+
+00803901 <__divdi3>:
+  803901:	53                   	push   %ebx
+  803902:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803906:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80390a:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80390e:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803912:	85 d2                	test   %edx,%edx
+  803914:	78 15                	js     80392b <__divdi3+0x2a>
+  803916:	85 db                	test   %ebx,%ebx
+  803918:	78 34                	js     80394e <__divdi3+0x4d>
+  80391a:	83 ec 04             	sub    $0x4,%esp
+  80391d:	6a 00                	push   $0x0
+  80391f:	53                   	push   %ebx
+  803920:	51                   	push   %ecx
+  803921:	e8 c5 fe ff ff       	call   8037eb <dm>
+  803926:	83 c4 10             	add    $0x10,%esp
+  803929:	eb 21                	jmp    80394c <__divdi3+0x4b>
+  80392b:	f7 d8                	neg    %eax
+  80392d:	83 d2 00             	adc    $0x0,%edx
+  803930:	f7 da                	neg    %edx
+  803932:	85 db                	test   %ebx,%ebx
+  803934:	78 30                	js     803966 <__divdi3+0x65>
+  803936:	83 ec 04             	sub    $0x4,%esp
+  803939:	6a 00                	push   $0x0
+  80393b:	53                   	push   %ebx
+  80393c:	51                   	push   %ecx
+  80393d:	e8 a9 fe ff ff       	call   8037eb <dm>
+  803942:	83 c4 10             	add    $0x10,%esp
+  803945:	f7 d8                	neg    %eax
+  803947:	83 d2 00             	adc    $0x0,%edx
+  80394a:	f7 da                	neg    %edx
+  80394c:	5b                   	pop    %ebx
+  80394d:	c3                   	ret
+  80394e:	83 ec 04             	sub    $0x4,%esp
+  803951:	6a 00                	push   $0x0
+  803953:	f7 d9                	neg    %ecx
+  803955:	83 d3 00             	adc    $0x0,%ebx
+  803958:	f7 db                	neg    %ebx
+  80395a:	53                   	push   %ebx
+  80395b:	51                   	push   %ecx
+  80395c:	e8 8a fe ff ff       	call   8037eb <dm>
+  803961:	83 c4 10             	add    $0x10,%esp
+  803964:	eb df                	jmp    803945 <__divdi3+0x44>
+  803966:	83 ec 04             	sub    $0x4,%esp
+  803969:	6a 00                	push   $0x0
+  80396b:	f7 d9                	neg    %ecx
+  80396d:	83 d3 00             	adc    $0x0,%ebx
+  803970:	f7 db                	neg    %ebx
+  803972:	53                   	push   %ebx
+  803973:	51                   	push   %ecx
+  803974:	e8 72 fe ff ff       	call   8037eb <dm>
+  803979:	83 c4 10             	add    $0x10,%esp
+  80397c:	eb ce                	jmp    80394c <__divdi3+0x4b>
+
+0080397e <__moddi3>:
+  80397e:	55                   	push   %ebp
+  80397f:	57                   	push   %edi
+  803980:	56                   	push   %esi
+  803981:	53                   	push   %ebx
+  803982:	83 ec 24             	sub    $0x24,%esp
+  803985:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803989:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80398d:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803991:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803995:	85 d2                	test   %edx,%edx
+  803997:	78 3b                	js     8039d4 <__moddi3+0x56>
+  803999:	83 ec 04             	sub    $0x4,%esp
+  80399c:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8039a0:	56                   	push   %esi
+  8039a1:	89 ce                	mov    %ecx,%esi
+  8039a3:	f7 de                	neg    %esi
+  8039a5:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8039a9:	89 de                	mov    %ebx,%esi
+  8039ab:	83 d6 00             	adc    $0x0,%esi
+  8039ae:	f7 de                	neg    %esi
+  8039b0:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8039b4:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8039b8:	0f 48 f1             	cmovs  %ecx,%esi
+  8039bb:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8039c0:	53                   	push   %ebx
+  8039c1:	56                   	push   %esi
+  8039c2:	e8 24 fe ff ff       	call   8037eb <dm>
+  8039c7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8039cb:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8039cf:	83 c4 10             	add    $0x10,%esp
+  8039d2:	eb 47                	jmp    803a1b <__moddi3+0x9d>
+  8039d4:	f7 d8                	neg    %eax
+  8039d6:	83 d2 00             	adc    $0x0,%edx
+  8039d9:	f7 da                	neg    %edx
+  8039db:	83 ec 04             	sub    $0x4,%esp
+  8039de:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8039e2:	56                   	push   %esi
+  8039e3:	89 cf                	mov    %ecx,%edi
+  8039e5:	f7 df                	neg    %edi
+  8039e7:	89 de                	mov    %ebx,%esi
+  8039e9:	83 d6 00             	adc    $0x0,%esi
+  8039ec:	f7 de                	neg    %esi
+  8039ee:	0f 49 cf             	cmovns %edi,%ecx
+  8039f1:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8039f5:	0f 49 de             	cmovns %esi,%ebx
+  8039f8:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8039fc:	ff 74 24 0c          	push   0xc(%esp)
+  803a00:	ff 74 24 0c          	push   0xc(%esp)
+  803a04:	e8 e2 fd ff ff       	call   8037eb <dm>
+  803a09:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a0d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a11:	f7 d8                	neg    %eax
+  803a13:	83 d2 00             	adc    $0x0,%edx
+  803a16:	f7 da                	neg    %edx
+  803a18:	83 c4 10             	add    $0x10,%esp
+  803a1b:	83 c4 24             	add    $0x24,%esp
+  803a1e:	5b                   	pop    %ebx
+  803a1f:	5e                   	pop    %esi
+  803a20:	5f                   	pop    %edi
+  803a21:	5d                   	pop    %ebp
+  803a22:	c3                   	ret
@@ -0,0 +1,7801 @@
+
+obj/user/testpiperace.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c3 01 00 00       	call   8001f4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 1c             	sub    $0x1c,%esp
+	int p[2], r, pid, i, max;
+	void *va;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for dup race...\n");
+  80003b:	68 00 39 80 00       	push   $0x803900
+  800040:	e8 ed 02 00 00       	call   800332 <cprintf>
+	if ((r = pipe(p)) < 0)
+  800045:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800048:	89 04 24             	mov    %eax,(%esp)
+  80004b:	e8 e1 32 00 00       	call   803331 <pipe>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	78 5f                	js     8000b6 <umain+0x83>
+		panic("pipe: %e", r);
+	max = 200;
+	if ((r = fork()) < 0)
+  800057:	e8 2b 12 00 00       	call   801287 <fork>
+  80005c:	89 c6                	mov    %eax,%esi
+  80005e:	85 c0                	test   %eax,%eax
+  800060:	78 66                	js     8000c8 <umain+0x95>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800062:	74 76                	je     8000da <umain+0xa7>
+		}
+		// do something to be not runnable besides exiting
+		ipc_recv(0,0,0);
+	}
+	pid = r;
+	cprintf("pid is %d\n", pid);
+  800064:	83 ec 08             	sub    $0x8,%esp
+  800067:	56                   	push   %esi
+  800068:	68 5a 39 80 00       	push   $0x80395a
+  80006d:	e8 c0 02 00 00       	call   800332 <cprintf>
+	va = 0;
+	kid = &envs[ENVX(pid)];
+  800072:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	cprintf("kid is %d\n", kid-envs);
+  800078:	83 c4 08             	add    $0x8,%esp
+  80007b:	69 c6 8c 00 00 00    	imul   $0x8c,%esi,%eax
+  800081:	c1 f8 02             	sar    $0x2,%eax
+  800084:	69 c0 8b af f8 8a    	imul   $0x8af8af8b,%eax,%eax
+  80008a:	50                   	push   %eax
+  80008b:	68 65 39 80 00       	push   $0x803965
+  800090:	e8 9d 02 00 00       	call   800332 <cprintf>
+	dup(p[0], 10);
+  800095:	83 c4 08             	add    $0x8,%esp
+  800098:	6a 0a                	push   $0xa
+  80009a:	ff 75 f0             	push   -0x10(%ebp)
+  80009d:	e8 7c 17 00 00       	call   80181e <dup>
+	while (kid->env_status == ENV_RUNNABLE)
+  8000a2:	83 c4 10             	add    $0x10,%esp
+  8000a5:	69 de 8c 00 00 00    	imul   $0x8c,%esi,%ebx
+  8000ab:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8000b1:	e9 92 00 00 00       	jmp    800148 <umain+0x115>
+		panic("pipe: %e", r);
+  8000b6:	50                   	push   %eax
+  8000b7:	68 19 39 80 00       	push   $0x803919
+  8000bc:	6a 0d                	push   $0xd
+  8000be:	68 22 39 80 00       	push   $0x803922
+  8000c3:	e8 8f 01 00 00       	call   800257 <_panic>
+		panic("fork: %e", r);
+  8000c8:	50                   	push   %eax
+  8000c9:	68 36 39 80 00       	push   $0x803936
+  8000ce:	6a 10                	push   $0x10
+  8000d0:	68 22 39 80 00       	push   $0x803922
+  8000d5:	e8 7d 01 00 00       	call   800257 <_panic>
+		close(p[1]);
+  8000da:	83 ec 0c             	sub    $0xc,%esp
+  8000dd:	ff 75 f4             	push   -0xc(%ebp)
+  8000e0:	e8 e7 16 00 00       	call   8017cc <close>
+		for (i=0; i<max; i++) {
+  8000e5:	83 c4 10             	add    $0x10,%esp
+  8000e8:	bb c9 00 00 00       	mov    $0xc9,%ebx
+  8000ed:	eb 05                	jmp    8000f4 <umain+0xc1>
+			sys_yield();
+  8000ef:	e8 19 0c 00 00       	call   800d0d <sys_yield>
+		for (i=0; i<max; i++) {
+  8000f4:	83 eb 01             	sub    $0x1,%ebx
+  8000f7:	74 29                	je     800122 <umain+0xef>
+			if(pipeisclosed(p[0])){
+  8000f9:	83 ec 0c             	sub    $0xc,%esp
+  8000fc:	ff 75 f0             	push   -0x10(%ebp)
+  8000ff:	e8 77 33 00 00       	call   80347b <pipeisclosed>
+  800104:	83 c4 10             	add    $0x10,%esp
+  800107:	85 c0                	test   %eax,%eax
+  800109:	74 e4                	je     8000ef <umain+0xbc>
+				cprintf("RACE: pipe appears closed\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 3f 39 80 00       	push   $0x80393f
+  800113:	e8 1a 02 00 00       	call   800332 <cprintf>
+				exit();
+  800118:	e8 20 01 00 00       	call   80023d <exit>
+  80011d:	83 c4 10             	add    $0x10,%esp
+  800120:	eb cd                	jmp    8000ef <umain+0xbc>
+		ipc_recv(0,0,0);
+  800122:	83 ec 04             	sub    $0x4,%esp
+  800125:	6a 00                	push   $0x0
+  800127:	6a 00                	push   $0x0
+  800129:	6a 00                	push   $0x0
+  80012b:	e8 12 13 00 00       	call   801442 <ipc_recv>
+  800130:	83 c4 10             	add    $0x10,%esp
+  800133:	e9 2c ff ff ff       	jmp    800064 <umain+0x31>
+		dup(p[0], 10);
+  800138:	83 ec 08             	sub    $0x8,%esp
+  80013b:	6a 0a                	push   $0xa
+  80013d:	ff 75 f0             	push   -0x10(%ebp)
+  800140:	e8 d9 16 00 00       	call   80181e <dup>
+  800145:	83 c4 10             	add    $0x10,%esp
+	while (kid->env_status == ENV_RUNNABLE)
+  800148:	8b 43 54             	mov    0x54(%ebx),%eax
+  80014b:	83 f8 02             	cmp    $0x2,%eax
+  80014e:	74 e8                	je     800138 <umain+0x105>
+
+	cprintf("child done with loop\n");
+  800150:	83 ec 0c             	sub    $0xc,%esp
+  800153:	68 70 39 80 00       	push   $0x803970
+  800158:	e8 d5 01 00 00       	call   800332 <cprintf>
+	if (pipeisclosed(p[0]))
+  80015d:	83 c4 04             	add    $0x4,%esp
+  800160:	ff 75 f0             	push   -0x10(%ebp)
+  800163:	e8 13 33 00 00       	call   80347b <pipeisclosed>
+  800168:	83 c4 10             	add    $0x10,%esp
+  80016b:	85 c0                	test   %eax,%eax
+  80016d:	75 48                	jne    8001b7 <umain+0x184>
+		panic("somehow the other end of p[0] got closed!");
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  80016f:	83 ec 08             	sub    $0x8,%esp
+  800172:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800175:	50                   	push   %eax
+  800176:	ff 75 f0             	push   -0x10(%ebp)
+  800179:	e8 24 15 00 00       	call   8016a2 <fd_lookup>
+  80017e:	83 c4 10             	add    $0x10,%esp
+  800181:	85 c0                	test   %eax,%eax
+  800183:	78 46                	js     8001cb <umain+0x198>
+		panic("cannot look up p[0]: %e", r);
+	va = fd2data(fd);
+  800185:	83 ec 0c             	sub    $0xc,%esp
+  800188:	ff 75 ec             	push   -0x14(%ebp)
+  80018b:	e8 a5 14 00 00       	call   801635 <fd2data>
+	if (pageref(va) != 3+1)
+  800190:	89 04 24             	mov    %eax,(%esp)
+  800193:	e8 22 2b 00 00       	call   802cba <pageref>
+  800198:	83 c4 10             	add    $0x10,%esp
+  80019b:	83 f8 04             	cmp    $0x4,%eax
+  80019e:	74 3d                	je     8001dd <umain+0x1aa>
+		cprintf("\nchild detected race\n");
+  8001a0:	83 ec 0c             	sub    $0xc,%esp
+  8001a3:	68 9e 39 80 00       	push   $0x80399e
+  8001a8:	e8 85 01 00 00       	call   800332 <cprintf>
+  8001ad:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("\nrace didn't happen\n", max);
+}
+  8001b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001b3:	5b                   	pop    %ebx
+  8001b4:	5e                   	pop    %esi
+  8001b5:	5d                   	pop    %ebp
+  8001b6:	c3                   	ret
+		panic("somehow the other end of p[0] got closed!");
+  8001b7:	83 ec 04             	sub    $0x4,%esp
+  8001ba:	68 cc 39 80 00       	push   $0x8039cc
+  8001bf:	6a 3a                	push   $0x3a
+  8001c1:	68 22 39 80 00       	push   $0x803922
+  8001c6:	e8 8c 00 00 00       	call   800257 <_panic>
+		panic("cannot look up p[0]: %e", r);
+  8001cb:	50                   	push   %eax
+  8001cc:	68 86 39 80 00       	push   $0x803986
+  8001d1:	6a 3c                	push   $0x3c
+  8001d3:	68 22 39 80 00       	push   $0x803922
+  8001d8:	e8 7a 00 00 00       	call   800257 <_panic>
+		cprintf("\nrace didn't happen\n", max);
+  8001dd:	83 ec 08             	sub    $0x8,%esp
+  8001e0:	68 c8 00 00 00       	push   $0xc8
+  8001e5:	68 b4 39 80 00       	push   $0x8039b4
+  8001ea:	e8 43 01 00 00       	call   800332 <cprintf>
+  8001ef:	83 c4 10             	add    $0x10,%esp
+}
+  8001f2:	eb bc                	jmp    8001b0 <umain+0x17d>
+
+008001f4 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001f4:	55                   	push   %ebp
+  8001f5:	89 e5                	mov    %esp,%ebp
+  8001f7:	56                   	push   %esi
+  8001f8:	53                   	push   %ebx
+  8001f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001ff:	e8 e2 0a 00 00       	call   800ce6 <sys_getenvid>
+  800204:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800209:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80020f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800214:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800219:	85 db                	test   %ebx,%ebx
+  80021b:	7e 07                	jle    800224 <libmain+0x30>
+		binaryname = argv[0];
+  80021d:	8b 06                	mov    (%esi),%eax
+  80021f:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800224:	83 ec 08             	sub    $0x8,%esp
+  800227:	56                   	push   %esi
+  800228:	53                   	push   %ebx
+  800229:	e8 05 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80022e:	e8 0a 00 00 00       	call   80023d <exit>
+}
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800239:	5b                   	pop    %ebx
+  80023a:	5e                   	pop    %esi
+  80023b:	5d                   	pop    %ebp
+  80023c:	c3                   	ret
+
+0080023d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800243:	e8 b1 15 00 00       	call   8017f9 <close_all>
+	sys_env_destroy(0);
+  800248:	83 ec 0c             	sub    $0xc,%esp
+  80024b:	6a 00                	push   $0x0
+  80024d:	e8 4b 0a 00 00       	call   800c9d <sys_env_destroy>
+}
+  800252:	83 c4 10             	add    $0x10,%esp
+  800255:	c9                   	leave
+  800256:	c3                   	ret
+
+00800257 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800257:	55                   	push   %ebp
+  800258:	89 e5                	mov    %esp,%ebp
+  80025a:	56                   	push   %esi
+  80025b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80025c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80025f:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800265:	e8 7c 0a 00 00       	call   800ce6 <sys_getenvid>
+  80026a:	83 ec 0c             	sub    $0xc,%esp
+  80026d:	ff 75 0c             	push   0xc(%ebp)
+  800270:	ff 75 08             	push   0x8(%ebp)
+  800273:	56                   	push   %esi
+  800274:	50                   	push   %eax
+  800275:	68 00 3a 80 00       	push   $0x803a00
+  80027a:	e8 b3 00 00 00       	call   800332 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80027f:	83 c4 18             	add    $0x18,%esp
+  800282:	53                   	push   %ebx
+  800283:	ff 75 10             	push   0x10(%ebp)
+  800286:	e8 56 00 00 00       	call   8002e1 <vcprintf>
+	cprintf("\n");
+  80028b:	c7 04 24 17 39 80 00 	movl   $0x803917,(%esp)
+  800292:	e8 9b 00 00 00       	call   800332 <cprintf>
+  800297:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80029a:	cc                   	int3
+	while (1)
+  80029b:	eb fd                	jmp    80029a <_panic+0x43>
+
+0080029d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80029d:	55                   	push   %ebp
+  80029e:	89 e5                	mov    %esp,%ebp
+  8002a0:	53                   	push   %ebx
+  8002a1:	83 ec 04             	sub    $0x4,%esp
+  8002a4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002a7:	8b 13                	mov    (%ebx),%edx
+  8002a9:	8d 42 01             	lea    0x1(%edx),%eax
+  8002ac:	89 03                	mov    %eax,(%ebx)
+  8002ae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002b1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002b5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002ba:	74 09                	je     8002c5 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002bc:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002c3:	c9                   	leave
+  8002c4:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002c5:	83 ec 08             	sub    $0x8,%esp
+  8002c8:	68 ff 00 00 00       	push   $0xff
+  8002cd:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002d0:	50                   	push   %eax
+  8002d1:	e8 7a 09 00 00       	call   800c50 <sys_cputs>
+		b->idx = 0;
+  8002d6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002dc:	83 c4 10             	add    $0x10,%esp
+  8002df:	eb db                	jmp    8002bc <putch+0x1f>
+
+008002e1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002e1:	55                   	push   %ebp
+  8002e2:	89 e5                	mov    %esp,%ebp
+  8002e4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002ea:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002f1:	00 00 00 
+	b.cnt = 0;
+  8002f4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002fb:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002fe:	ff 75 0c             	push   0xc(%ebp)
+  800301:	ff 75 08             	push   0x8(%ebp)
+  800304:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80030a:	50                   	push   %eax
+  80030b:	68 9d 02 80 00       	push   $0x80029d
+  800310:	e8 14 01 00 00       	call   800429 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800315:	83 c4 08             	add    $0x8,%esp
+  800318:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80031e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800324:	50                   	push   %eax
+  800325:	e8 26 09 00 00       	call   800c50 <sys_cputs>
+
+	return b.cnt;
+}
+  80032a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800330:	c9                   	leave
+  800331:	c3                   	ret
+
+00800332 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800332:	55                   	push   %ebp
+  800333:	89 e5                	mov    %esp,%ebp
+  800335:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800338:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80033b:	50                   	push   %eax
+  80033c:	ff 75 08             	push   0x8(%ebp)
+  80033f:	e8 9d ff ff ff       	call   8002e1 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800344:	c9                   	leave
+  800345:	c3                   	ret
+
+00800346 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800346:	55                   	push   %ebp
+  800347:	89 e5                	mov    %esp,%ebp
+  800349:	57                   	push   %edi
+  80034a:	56                   	push   %esi
+  80034b:	53                   	push   %ebx
+  80034c:	83 ec 1c             	sub    $0x1c,%esp
+  80034f:	89 c7                	mov    %eax,%edi
+  800351:	89 d6                	mov    %edx,%esi
+  800353:	8b 45 08             	mov    0x8(%ebp),%eax
+  800356:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800359:	89 d1                	mov    %edx,%ecx
+  80035b:	89 c2                	mov    %eax,%edx
+  80035d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800360:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800363:	8b 45 10             	mov    0x10(%ebp),%eax
+  800366:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800369:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80036c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800373:	39 c2                	cmp    %eax,%edx
+  800375:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800378:	72 3e                	jb     8003b8 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80037a:	83 ec 0c             	sub    $0xc,%esp
+  80037d:	ff 75 18             	push   0x18(%ebp)
+  800380:	83 eb 01             	sub    $0x1,%ebx
+  800383:	53                   	push   %ebx
+  800384:	50                   	push   %eax
+  800385:	83 ec 08             	sub    $0x8,%esp
+  800388:	ff 75 e4             	push   -0x1c(%ebp)
+  80038b:	ff 75 e0             	push   -0x20(%ebp)
+  80038e:	ff 75 dc             	push   -0x24(%ebp)
+  800391:	ff 75 d8             	push   -0x28(%ebp)
+  800394:	e8 f1 33 00 00       	call   80378a <__udivdi3>
+  800399:	83 c4 18             	add    $0x18,%esp
+  80039c:	52                   	push   %edx
+  80039d:	50                   	push   %eax
+  80039e:	89 f2                	mov    %esi,%edx
+  8003a0:	89 f8                	mov    %edi,%eax
+  8003a2:	e8 9f ff ff ff       	call   800346 <printnum>
+  8003a7:	83 c4 20             	add    $0x20,%esp
+  8003aa:	eb 13                	jmp    8003bf <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003ac:	83 ec 08             	sub    $0x8,%esp
+  8003af:	56                   	push   %esi
+  8003b0:	ff 75 18             	push   0x18(%ebp)
+  8003b3:	ff d7                	call   *%edi
+  8003b5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003b8:	83 eb 01             	sub    $0x1,%ebx
+  8003bb:	85 db                	test   %ebx,%ebx
+  8003bd:	7f ed                	jg     8003ac <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003bf:	83 ec 08             	sub    $0x8,%esp
+  8003c2:	56                   	push   %esi
+  8003c3:	83 ec 04             	sub    $0x4,%esp
+  8003c6:	ff 75 e4             	push   -0x1c(%ebp)
+  8003c9:	ff 75 e0             	push   -0x20(%ebp)
+  8003cc:	ff 75 dc             	push   -0x24(%ebp)
+  8003cf:	ff 75 d8             	push   -0x28(%ebp)
+  8003d2:	e8 d1 33 00 00       	call   8037a8 <__umoddi3>
+  8003d7:	83 c4 14             	add    $0x14,%esp
+  8003da:	0f be 80 23 3a 80 00 	movsbl 0x803a23(%eax),%eax
+  8003e1:	50                   	push   %eax
+  8003e2:	ff d7                	call   *%edi
+}
+  8003e4:	83 c4 10             	add    $0x10,%esp
+  8003e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ea:	5b                   	pop    %ebx
+  8003eb:	5e                   	pop    %esi
+  8003ec:	5f                   	pop    %edi
+  8003ed:	5d                   	pop    %ebp
+  8003ee:	c3                   	ret
+
+008003ef <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003ef:	55                   	push   %ebp
+  8003f0:	89 e5                	mov    %esp,%ebp
+  8003f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003f5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003f9:	8b 10                	mov    (%eax),%edx
+  8003fb:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003fe:	73 0a                	jae    80040a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800400:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800403:	89 08                	mov    %ecx,(%eax)
+  800405:	8b 45 08             	mov    0x8(%ebp),%eax
+  800408:	88 02                	mov    %al,(%edx)
+}
+  80040a:	5d                   	pop    %ebp
+  80040b:	c3                   	ret
+
+0080040c <printfmt>:
+{
+  80040c:	55                   	push   %ebp
+  80040d:	89 e5                	mov    %esp,%ebp
+  80040f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800412:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800415:	50                   	push   %eax
+  800416:	ff 75 10             	push   0x10(%ebp)
+  800419:	ff 75 0c             	push   0xc(%ebp)
+  80041c:	ff 75 08             	push   0x8(%ebp)
+  80041f:	e8 05 00 00 00       	call   800429 <vprintfmt>
+}
+  800424:	83 c4 10             	add    $0x10,%esp
+  800427:	c9                   	leave
+  800428:	c3                   	ret
+
+00800429 <vprintfmt>:
+{
+  800429:	55                   	push   %ebp
+  80042a:	89 e5                	mov    %esp,%ebp
+  80042c:	57                   	push   %edi
+  80042d:	56                   	push   %esi
+  80042e:	53                   	push   %ebx
+  80042f:	83 ec 2c             	sub    $0x2c,%esp
+  800432:	8b 75 08             	mov    0x8(%ebp),%esi
+  800435:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800438:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80043b:	eb 0a                	jmp    800447 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80043d:	83 ec 08             	sub    $0x8,%esp
+  800440:	53                   	push   %ebx
+  800441:	50                   	push   %eax
+  800442:	ff d6                	call   *%esi
+  800444:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800447:	83 c7 01             	add    $0x1,%edi
+  80044a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80044e:	83 f8 25             	cmp    $0x25,%eax
+  800451:	74 0c                	je     80045f <vprintfmt+0x36>
+			if (ch == '\0')
+  800453:	85 c0                	test   %eax,%eax
+  800455:	75 e6                	jne    80043d <vprintfmt+0x14>
+}
+  800457:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80045a:	5b                   	pop    %ebx
+  80045b:	5e                   	pop    %esi
+  80045c:	5f                   	pop    %edi
+  80045d:	5d                   	pop    %ebp
+  80045e:	c3                   	ret
+		padc = ' ';
+  80045f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800463:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80046a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800471:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800478:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80047d:	8d 47 01             	lea    0x1(%edi),%eax
+  800480:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800483:	0f b6 17             	movzbl (%edi),%edx
+  800486:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800489:	3c 55                	cmp    $0x55,%al
+  80048b:	0f 87 cf 03 00 00    	ja     800860 <vprintfmt+0x437>
+  800491:	0f b6 c0             	movzbl %al,%eax
+  800494:	ff 24 85 80 3b 80 00 	jmp    *0x803b80(,%eax,4)
+  80049b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80049e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004a2:	eb d9                	jmp    80047d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004a7:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004ab:	eb d0                	jmp    80047d <vprintfmt+0x54>
+  8004ad:	0f b6 d2             	movzbl %dl,%edx
+  8004b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004bb:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004be:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004c2:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004c5:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004c8:	83 f9 09             	cmp    $0x9,%ecx
+  8004cb:	77 55                	ja     800522 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004cd:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004d0:	eb e9                	jmp    8004bb <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d5:	8b 00                	mov    (%eax),%eax
+  8004d7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8004e0:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004e6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004ea:	79 91                	jns    80047d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004ec:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004f9:	eb 82                	jmp    80047d <vprintfmt+0x54>
+			if (width < 0)
+  8004fb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004fe:	85 d2                	test   %edx,%edx
+  800500:	b8 00 00 00 00       	mov    $0x0,%eax
+  800505:	0f 49 c2             	cmovns %edx,%eax
+  800508:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80050b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80050e:	e9 6a ff ff ff       	jmp    80047d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800513:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800516:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80051d:	e9 5b ff ff ff       	jmp    80047d <vprintfmt+0x54>
+  800522:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800525:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800528:	eb bc                	jmp    8004e6 <vprintfmt+0xbd>
+			lflag++;
+  80052a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80052d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800530:	e9 48 ff ff ff       	jmp    80047d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800535:	8b 45 14             	mov    0x14(%ebp),%eax
+  800538:	8d 78 04             	lea    0x4(%eax),%edi
+  80053b:	83 ec 08             	sub    $0x8,%esp
+  80053e:	53                   	push   %ebx
+  80053f:	ff 30                	push   (%eax)
+  800541:	ff d6                	call   *%esi
+			break;
+  800543:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800546:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800549:	e9 b1 02 00 00       	jmp    8007ff <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80054e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800551:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800554:	8b 10                	mov    (%eax),%edx
+  800556:	89 d0                	mov    %edx,%eax
+  800558:	f7 d8                	neg    %eax
+  80055a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80055d:	83 f8 11             	cmp    $0x11,%eax
+  800560:	7f 23                	jg     800585 <vprintfmt+0x15c>
+  800562:	8b 14 85 e0 3c 80 00 	mov    0x803ce0(,%eax,4),%edx
+  800569:	85 d2                	test   %edx,%edx
+  80056b:	74 18                	je     800585 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80056d:	52                   	push   %edx
+  80056e:	68 fe 3d 80 00       	push   $0x803dfe
+  800573:	53                   	push   %ebx
+  800574:	56                   	push   %esi
+  800575:	e8 92 fe ff ff       	call   80040c <printfmt>
+  80057a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80057d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800580:	e9 7a 02 00 00       	jmp    8007ff <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800585:	50                   	push   %eax
+  800586:	68 3b 3a 80 00       	push   $0x803a3b
+  80058b:	53                   	push   %ebx
+  80058c:	56                   	push   %esi
+  80058d:	e8 7a fe ff ff       	call   80040c <printfmt>
+  800592:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800595:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800598:	e9 62 02 00 00       	jmp    8007ff <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80059d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a0:	83 c0 04             	add    $0x4,%eax
+  8005a3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005ab:	85 c9                	test   %ecx,%ecx
+  8005ad:	b8 34 3a 80 00       	mov    $0x803a34,%eax
+  8005b2:	0f 45 c1             	cmovne %ecx,%eax
+  8005b5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005b8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005bc:	7e 06                	jle    8005c4 <vprintfmt+0x19b>
+  8005be:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005c2:	75 0b                	jne    8005cf <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c4:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005c7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005ca:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005cd:	eb 5c                	jmp    80062b <vprintfmt+0x202>
+  8005cf:	83 ec 08             	sub    $0x8,%esp
+  8005d2:	ff 75 d0             	push   -0x30(%ebp)
+  8005d5:	ff 75 cc             	push   -0x34(%ebp)
+  8005d8:	e8 20 03 00 00       	call   8008fd <strnlen>
+  8005dd:	89 c2                	mov    %eax,%edx
+  8005df:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e2:	29 d0                	sub    %edx,%eax
+  8005e4:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005e7:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005eb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005ee:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005f1:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005f3:	eb 0e                	jmp    800603 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005f5:	83 ec 08             	sub    $0x8,%esp
+  8005f8:	53                   	push   %ebx
+  8005f9:	57                   	push   %edi
+  8005fa:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005fd:	83 ee 01             	sub    $0x1,%esi
+  800600:	83 c4 10             	add    $0x10,%esp
+  800603:	85 f6                	test   %esi,%esi
+  800605:	7f ee                	jg     8005f5 <vprintfmt+0x1cc>
+  800607:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80060a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80060d:	85 c0                	test   %eax,%eax
+  80060f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800614:	0f 49 d0             	cmovns %eax,%edx
+  800617:	29 d0                	sub    %edx,%eax
+  800619:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80061c:	eb a6                	jmp    8005c4 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80061e:	83 ec 08             	sub    $0x8,%esp
+  800621:	53                   	push   %ebx
+  800622:	52                   	push   %edx
+  800623:	ff 55 08             	call   *0x8(%ebp)
+  800626:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800629:	89 f1                	mov    %esi,%ecx
+  80062b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80062e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800632:	0f be d0             	movsbl %al,%edx
+  800635:	85 d2                	test   %edx,%edx
+  800637:	74 28                	je     800661 <vprintfmt+0x238>
+  800639:	85 ff                	test   %edi,%edi
+  80063b:	78 05                	js     800642 <vprintfmt+0x219>
+  80063d:	83 ef 01             	sub    $0x1,%edi
+  800640:	78 30                	js     800672 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800642:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800646:	74 d6                	je     80061e <vprintfmt+0x1f5>
+  800648:	0f be c0             	movsbl %al,%eax
+  80064b:	83 e8 20             	sub    $0x20,%eax
+  80064e:	83 f8 5e             	cmp    $0x5e,%eax
+  800651:	76 cb                	jbe    80061e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800653:	83 ec 08             	sub    $0x8,%esp
+  800656:	53                   	push   %ebx
+  800657:	6a 3f                	push   $0x3f
+  800659:	ff 55 08             	call   *0x8(%ebp)
+  80065c:	83 c4 10             	add    $0x10,%esp
+  80065f:	eb c8                	jmp    800629 <vprintfmt+0x200>
+  800661:	8b 75 08             	mov    0x8(%ebp),%esi
+  800664:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800667:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80066a:	01 d0                	add    %edx,%eax
+  80066c:	29 c8                	sub    %ecx,%eax
+  80066e:	89 c7                	mov    %eax,%edi
+  800670:	eb 13                	jmp    800685 <vprintfmt+0x25c>
+  800672:	8b 75 08             	mov    0x8(%ebp),%esi
+  800675:	eb ed                	jmp    800664 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800677:	83 ec 08             	sub    $0x8,%esp
+  80067a:	53                   	push   %ebx
+  80067b:	6a 20                	push   $0x20
+  80067d:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80067f:	83 ef 01             	sub    $0x1,%edi
+  800682:	83 c4 10             	add    $0x10,%esp
+  800685:	85 ff                	test   %edi,%edi
+  800687:	7f ee                	jg     800677 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800689:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80068c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068f:	e9 6b 01 00 00       	jmp    8007ff <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800694:	83 f9 01             	cmp    $0x1,%ecx
+  800697:	7f 1f                	jg     8006b8 <vprintfmt+0x28f>
+	else if (lflag)
+  800699:	85 c9                	test   %ecx,%ecx
+  80069b:	74 67                	je     800704 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80069d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a0:	8b 00                	mov    (%eax),%eax
+  8006a2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006a5:	89 c1                	mov    %eax,%ecx
+  8006a7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006aa:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b6:	eb 17                	jmp    8006cf <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8006b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bb:	8b 50 04             	mov    0x4(%eax),%edx
+  8006be:	8b 00                	mov    (%eax),%eax
+  8006c0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006c3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c9:	8d 40 08             	lea    0x8(%eax),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006cf:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006d2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006d5:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006da:	85 c9                	test   %ecx,%ecx
+  8006dc:	0f 89 03 01 00 00    	jns    8007e5 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8006e2:	83 ec 08             	sub    $0x8,%esp
+  8006e5:	53                   	push   %ebx
+  8006e6:	6a 2d                	push   $0x2d
+  8006e8:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006ea:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006ed:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006f0:	f7 da                	neg    %edx
+  8006f2:	83 d1 00             	adc    $0x0,%ecx
+  8006f5:	f7 d9                	neg    %ecx
+  8006f7:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006fa:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006ff:	e9 e1 00 00 00       	jmp    8007e5 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800704:	8b 45 14             	mov    0x14(%ebp),%eax
+  800707:	8b 00                	mov    (%eax),%eax
+  800709:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80070c:	89 c1                	mov    %eax,%ecx
+  80070e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800711:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800714:	8b 45 14             	mov    0x14(%ebp),%eax
+  800717:	8d 40 04             	lea    0x4(%eax),%eax
+  80071a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80071d:	eb b0                	jmp    8006cf <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80071f:	83 f9 01             	cmp    $0x1,%ecx
+  800722:	7f 1e                	jg     800742 <vprintfmt+0x319>
+	else if (lflag)
+  800724:	85 c9                	test   %ecx,%ecx
+  800726:	74 32                	je     80075a <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800728:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072b:	8b 10                	mov    (%eax),%edx
+  80072d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800732:	8d 40 04             	lea    0x4(%eax),%eax
+  800735:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800738:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80073d:	e9 a3 00 00 00       	jmp    8007e5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800742:	8b 45 14             	mov    0x14(%ebp),%eax
+  800745:	8b 10                	mov    (%eax),%edx
+  800747:	8b 48 04             	mov    0x4(%eax),%ecx
+  80074a:	8d 40 08             	lea    0x8(%eax),%eax
+  80074d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800750:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800755:	e9 8b 00 00 00       	jmp    8007e5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80075a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075d:	8b 10                	mov    (%eax),%edx
+  80075f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800764:	8d 40 04             	lea    0x4(%eax),%eax
+  800767:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80076a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80076f:	eb 74                	jmp    8007e5 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800771:	83 f9 01             	cmp    $0x1,%ecx
+  800774:	7f 1b                	jg     800791 <vprintfmt+0x368>
+	else if (lflag)
+  800776:	85 c9                	test   %ecx,%ecx
+  800778:	74 2c                	je     8007a6 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80077a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077d:	8b 10                	mov    (%eax),%edx
+  80077f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800784:	8d 40 04             	lea    0x4(%eax),%eax
+  800787:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80078a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80078f:	eb 54                	jmp    8007e5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800791:	8b 45 14             	mov    0x14(%ebp),%eax
+  800794:	8b 10                	mov    (%eax),%edx
+  800796:	8b 48 04             	mov    0x4(%eax),%ecx
+  800799:	8d 40 08             	lea    0x8(%eax),%eax
+  80079c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80079f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8007a4:	eb 3f                	jmp    8007e5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a9:	8b 10                	mov    (%eax),%edx
+  8007ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007b6:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8007bb:	eb 28                	jmp    8007e5 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8007bd:	83 ec 08             	sub    $0x8,%esp
+  8007c0:	53                   	push   %ebx
+  8007c1:	6a 30                	push   $0x30
+  8007c3:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007c5:	83 c4 08             	add    $0x8,%esp
+  8007c8:	53                   	push   %ebx
+  8007c9:	6a 78                	push   $0x78
+  8007cb:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d0:	8b 10                	mov    (%eax),%edx
+  8007d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007d7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007da:	8d 40 04             	lea    0x4(%eax),%eax
+  8007dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e0:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007e5:	83 ec 0c             	sub    $0xc,%esp
+  8007e8:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007ec:	50                   	push   %eax
+  8007ed:	ff 75 e0             	push   -0x20(%ebp)
+  8007f0:	57                   	push   %edi
+  8007f1:	51                   	push   %ecx
+  8007f2:	52                   	push   %edx
+  8007f3:	89 da                	mov    %ebx,%edx
+  8007f5:	89 f0                	mov    %esi,%eax
+  8007f7:	e8 4a fb ff ff       	call   800346 <printnum>
+			break;
+  8007fc:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007ff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800802:	e9 40 fc ff ff       	jmp    800447 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800807:	83 f9 01             	cmp    $0x1,%ecx
+  80080a:	7f 1b                	jg     800827 <vprintfmt+0x3fe>
+	else if (lflag)
+  80080c:	85 c9                	test   %ecx,%ecx
+  80080e:	74 2c                	je     80083c <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800810:	8b 45 14             	mov    0x14(%ebp),%eax
+  800813:	8b 10                	mov    (%eax),%edx
+  800815:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80081a:	8d 40 04             	lea    0x4(%eax),%eax
+  80081d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800820:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800825:	eb be                	jmp    8007e5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800827:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082a:	8b 10                	mov    (%eax),%edx
+  80082c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80082f:	8d 40 08             	lea    0x8(%eax),%eax
+  800832:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800835:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80083a:	eb a9                	jmp    8007e5 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80083c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083f:	8b 10                	mov    (%eax),%edx
+  800841:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800846:	8d 40 04             	lea    0x4(%eax),%eax
+  800849:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80084c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800851:	eb 92                	jmp    8007e5 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800853:	83 ec 08             	sub    $0x8,%esp
+  800856:	53                   	push   %ebx
+  800857:	6a 25                	push   $0x25
+  800859:	ff d6                	call   *%esi
+			break;
+  80085b:	83 c4 10             	add    $0x10,%esp
+  80085e:	eb 9f                	jmp    8007ff <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800860:	83 ec 08             	sub    $0x8,%esp
+  800863:	53                   	push   %ebx
+  800864:	6a 25                	push   $0x25
+  800866:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800868:	83 c4 10             	add    $0x10,%esp
+  80086b:	89 f8                	mov    %edi,%eax
+  80086d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800871:	74 05                	je     800878 <vprintfmt+0x44f>
+  800873:	83 e8 01             	sub    $0x1,%eax
+  800876:	eb f5                	jmp    80086d <vprintfmt+0x444>
+  800878:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80087b:	eb 82                	jmp    8007ff <vprintfmt+0x3d6>
+
+0080087d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80087d:	55                   	push   %ebp
+  80087e:	89 e5                	mov    %esp,%ebp
+  800880:	83 ec 18             	sub    $0x18,%esp
+  800883:	8b 45 08             	mov    0x8(%ebp),%eax
+  800886:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800889:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80088c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800890:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800893:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80089a:	85 c0                	test   %eax,%eax
+  80089c:	74 26                	je     8008c4 <vsnprintf+0x47>
+  80089e:	85 d2                	test   %edx,%edx
+  8008a0:	7e 22                	jle    8008c4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008a2:	ff 75 14             	push   0x14(%ebp)
+  8008a5:	ff 75 10             	push   0x10(%ebp)
+  8008a8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008ab:	50                   	push   %eax
+  8008ac:	68 ef 03 80 00       	push   $0x8003ef
+  8008b1:	e8 73 fb ff ff       	call   800429 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008b6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008b9:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008bf:	83 c4 10             	add    $0x10,%esp
+}
+  8008c2:	c9                   	leave
+  8008c3:	c3                   	ret
+		return -E_INVAL;
+  8008c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008c9:	eb f7                	jmp    8008c2 <vsnprintf+0x45>
+
+008008cb <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008cb:	55                   	push   %ebp
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008d1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008d4:	50                   	push   %eax
+  8008d5:	ff 75 10             	push   0x10(%ebp)
+  8008d8:	ff 75 0c             	push   0xc(%ebp)
+  8008db:	ff 75 08             	push   0x8(%ebp)
+  8008de:	e8 9a ff ff ff       	call   80087d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008e3:	c9                   	leave
+  8008e4:	c3                   	ret
+
+008008e5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008e5:	55                   	push   %ebp
+  8008e6:	89 e5                	mov    %esp,%ebp
+  8008e8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f0:	eb 03                	jmp    8008f5 <strlen+0x10>
+		n++;
+  8008f2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008f5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008f9:	75 f7                	jne    8008f2 <strlen+0xd>
+	return n;
+}
+  8008fb:	5d                   	pop    %ebp
+  8008fc:	c3                   	ret
+
+008008fd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008fd:	55                   	push   %ebp
+  8008fe:	89 e5                	mov    %esp,%ebp
+  800900:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800903:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800906:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090b:	eb 03                	jmp    800910 <strnlen+0x13>
+		n++;
+  80090d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800910:	39 d0                	cmp    %edx,%eax
+  800912:	74 08                	je     80091c <strnlen+0x1f>
+  800914:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800918:	75 f3                	jne    80090d <strnlen+0x10>
+  80091a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80091c:	89 d0                	mov    %edx,%eax
+  80091e:	5d                   	pop    %ebp
+  80091f:	c3                   	ret
+
+00800920 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800920:	55                   	push   %ebp
+  800921:	89 e5                	mov    %esp,%ebp
+  800923:	53                   	push   %ebx
+  800924:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800927:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80092a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800933:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800936:	83 c0 01             	add    $0x1,%eax
+  800939:	84 d2                	test   %dl,%dl
+  80093b:	75 f2                	jne    80092f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80093d:	89 c8                	mov    %ecx,%eax
+  80093f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800942:	c9                   	leave
+  800943:	c3                   	ret
+
+00800944 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800944:	55                   	push   %ebp
+  800945:	89 e5                	mov    %esp,%ebp
+  800947:	53                   	push   %ebx
+  800948:	83 ec 10             	sub    $0x10,%esp
+  80094b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80094e:	53                   	push   %ebx
+  80094f:	e8 91 ff ff ff       	call   8008e5 <strlen>
+  800954:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800957:	ff 75 0c             	push   0xc(%ebp)
+  80095a:	01 d8                	add    %ebx,%eax
+  80095c:	50                   	push   %eax
+  80095d:	e8 be ff ff ff       	call   800920 <strcpy>
+	return dst;
+}
+  800962:	89 d8                	mov    %ebx,%eax
+  800964:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800967:	c9                   	leave
+  800968:	c3                   	ret
+
+00800969 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800969:	55                   	push   %ebp
+  80096a:	89 e5                	mov    %esp,%ebp
+  80096c:	56                   	push   %esi
+  80096d:	53                   	push   %ebx
+  80096e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800971:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800974:	89 f3                	mov    %esi,%ebx
+  800976:	03 5d 10             	add    0x10(%ebp),%ebx
+  800979:	89 f0                	mov    %esi,%eax
+  80097b:	eb 0f                	jmp    80098c <strncpy+0x23>
+		*dst++ = *src;
+  80097d:	83 c0 01             	add    $0x1,%eax
+  800980:	0f b6 0a             	movzbl (%edx),%ecx
+  800983:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800986:	80 f9 01             	cmp    $0x1,%cl
+  800989:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80098c:	39 d8                	cmp    %ebx,%eax
+  80098e:	75 ed                	jne    80097d <strncpy+0x14>
+	}
+	return ret;
+}
+  800990:	89 f0                	mov    %esi,%eax
+  800992:	5b                   	pop    %ebx
+  800993:	5e                   	pop    %esi
+  800994:	5d                   	pop    %ebp
+  800995:	c3                   	ret
+
+00800996 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800996:	55                   	push   %ebp
+  800997:	89 e5                	mov    %esp,%ebp
+  800999:	56                   	push   %esi
+  80099a:	53                   	push   %ebx
+  80099b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80099e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009a1:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009a4:	89 f0                	mov    %esi,%eax
+  8009a6:	85 d2                	test   %edx,%edx
+  8009a8:	74 21                	je     8009cb <strlcpy+0x35>
+  8009aa:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009ae:	89 f2                	mov    %esi,%edx
+  8009b0:	eb 09                	jmp    8009bb <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009b2:	83 c1 01             	add    $0x1,%ecx
+  8009b5:	83 c2 01             	add    $0x1,%edx
+  8009b8:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009bb:	39 c2                	cmp    %eax,%edx
+  8009bd:	74 09                	je     8009c8 <strlcpy+0x32>
+  8009bf:	0f b6 19             	movzbl (%ecx),%ebx
+  8009c2:	84 db                	test   %bl,%bl
+  8009c4:	75 ec                	jne    8009b2 <strlcpy+0x1c>
+  8009c6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009c8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009cb:	29 f0                	sub    %esi,%eax
+}
+  8009cd:	5b                   	pop    %ebx
+  8009ce:	5e                   	pop    %esi
+  8009cf:	5d                   	pop    %ebp
+  8009d0:	c3                   	ret
+
+008009d1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009da:	eb 06                	jmp    8009e2 <strcmp+0x11>
+		p++, q++;
+  8009dc:	83 c1 01             	add    $0x1,%ecx
+  8009df:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009e2:	0f b6 01             	movzbl (%ecx),%eax
+  8009e5:	84 c0                	test   %al,%al
+  8009e7:	74 04                	je     8009ed <strcmp+0x1c>
+  8009e9:	3a 02                	cmp    (%edx),%al
+  8009eb:	74 ef                	je     8009dc <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009ed:	0f b6 c0             	movzbl %al,%eax
+  8009f0:	0f b6 12             	movzbl (%edx),%edx
+  8009f3:	29 d0                	sub    %edx,%eax
+}
+  8009f5:	5d                   	pop    %ebp
+  8009f6:	c3                   	ret
+
+008009f7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009f7:	55                   	push   %ebp
+  8009f8:	89 e5                	mov    %esp,%ebp
+  8009fa:	53                   	push   %ebx
+  8009fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a01:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a04:	eb 09                	jmp    800a0f <strncmp+0x18>
+		n--, p++, q++;
+  800a06:	83 ea 01             	sub    $0x1,%edx
+  800a09:	83 c0 01             	add    $0x1,%eax
+  800a0c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a0f:	85 d2                	test   %edx,%edx
+  800a11:	74 18                	je     800a2b <strncmp+0x34>
+  800a13:	0f b6 18             	movzbl (%eax),%ebx
+  800a16:	84 db                	test   %bl,%bl
+  800a18:	74 04                	je     800a1e <strncmp+0x27>
+  800a1a:	3a 19                	cmp    (%ecx),%bl
+  800a1c:	74 e8                	je     800a06 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a1e:	0f b6 00             	movzbl (%eax),%eax
+  800a21:	0f b6 11             	movzbl (%ecx),%edx
+  800a24:	29 d0                	sub    %edx,%eax
+}
+  800a26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a29:	c9                   	leave
+  800a2a:	c3                   	ret
+		return 0;
+  800a2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a30:	eb f4                	jmp    800a26 <strncmp+0x2f>
+
+00800a32 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a32:	55                   	push   %ebp
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a38:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a3c:	eb 03                	jmp    800a41 <strchr+0xf>
+  800a3e:	83 c0 01             	add    $0x1,%eax
+  800a41:	0f b6 10             	movzbl (%eax),%edx
+  800a44:	84 d2                	test   %dl,%dl
+  800a46:	74 06                	je     800a4e <strchr+0x1c>
+		if (*s == c)
+  800a48:	38 ca                	cmp    %cl,%dl
+  800a4a:	75 f2                	jne    800a3e <strchr+0xc>
+  800a4c:	eb 05                	jmp    800a53 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a53:	5d                   	pop    %ebp
+  800a54:	c3                   	ret
+
+00800a55 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a55:	55                   	push   %ebp
+  800a56:	89 e5                	mov    %esp,%ebp
+  800a58:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a5f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a62:	38 ca                	cmp    %cl,%dl
+  800a64:	74 09                	je     800a6f <strfind+0x1a>
+  800a66:	84 d2                	test   %dl,%dl
+  800a68:	74 05                	je     800a6f <strfind+0x1a>
+	for (; *s; s++)
+  800a6a:	83 c0 01             	add    $0x1,%eax
+  800a6d:	eb f0                	jmp    800a5f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a6f:	5d                   	pop    %ebp
+  800a70:	c3                   	ret
+
+00800a71 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a71:	55                   	push   %ebp
+  800a72:	89 e5                	mov    %esp,%ebp
+  800a74:	57                   	push   %edi
+  800a75:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a78:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a7b:	85 c9                	test   %ecx,%ecx
+  800a7d:	74 20                	je     800a9f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a7f:	89 f8                	mov    %edi,%eax
+  800a81:	09 c8                	or     %ecx,%eax
+  800a83:	a8 03                	test   $0x3,%al
+  800a85:	75 12                	jne    800a99 <memset+0x28>
+		c &= 0xFF;
+  800a87:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a8b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a91:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a94:	fc                   	cld
+  800a95:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a97:	eb 06                	jmp    800a9f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a9c:	fc                   	cld
+  800a9d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a9f:	89 f8                	mov    %edi,%eax
+  800aa1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800aa4:	c9                   	leave
+  800aa5:	c3                   	ret
+
+00800aa6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800aa6:	55                   	push   %ebp
+  800aa7:	89 e5                	mov    %esp,%ebp
+  800aa9:	57                   	push   %edi
+  800aaa:	56                   	push   %esi
+  800aab:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aae:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ab1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ab4:	39 c6                	cmp    %eax,%esi
+  800ab6:	73 32                	jae    800aea <memmove+0x44>
+  800ab8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800abb:	39 d0                	cmp    %edx,%eax
+  800abd:	73 2b                	jae    800aea <memmove+0x44>
+		s += n;
+		d += n;
+  800abf:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ac2:	89 d6                	mov    %edx,%esi
+  800ac4:	09 fe                	or     %edi,%esi
+  800ac6:	09 ce                	or     %ecx,%esi
+  800ac8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ace:	75 0e                	jne    800ade <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ad0:	83 ef 04             	sub    $0x4,%edi
+  800ad3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ad6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ad9:	fd                   	std
+  800ada:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800adc:	eb 09                	jmp    800ae7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ade:	83 ef 01             	sub    $0x1,%edi
+  800ae1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ae4:	fd                   	std
+  800ae5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ae7:	fc                   	cld
+  800ae8:	eb 1a                	jmp    800b04 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aea:	89 f2                	mov    %esi,%edx
+  800aec:	09 c2                	or     %eax,%edx
+  800aee:	09 ca                	or     %ecx,%edx
+  800af0:	f6 c2 03             	test   $0x3,%dl
+  800af3:	75 0a                	jne    800aff <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800af5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800af8:	89 c7                	mov    %eax,%edi
+  800afa:	fc                   	cld
+  800afb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800afd:	eb 05                	jmp    800b04 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800aff:	89 c7                	mov    %eax,%edi
+  800b01:	fc                   	cld
+  800b02:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b04:	5e                   	pop    %esi
+  800b05:	5f                   	pop    %edi
+  800b06:	5d                   	pop    %ebp
+  800b07:	c3                   	ret
+
+00800b08 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b08:	55                   	push   %ebp
+  800b09:	89 e5                	mov    %esp,%ebp
+  800b0b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b0e:	ff 75 10             	push   0x10(%ebp)
+  800b11:	ff 75 0c             	push   0xc(%ebp)
+  800b14:	ff 75 08             	push   0x8(%ebp)
+  800b17:	e8 8a ff ff ff       	call   800aa6 <memmove>
+}
+  800b1c:	c9                   	leave
+  800b1d:	c3                   	ret
+
+00800b1e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b1e:	55                   	push   %ebp
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	56                   	push   %esi
+  800b22:	53                   	push   %ebx
+  800b23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b26:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b29:	89 c6                	mov    %eax,%esi
+  800b2b:	03 75 10             	add    0x10(%ebp),%esi
+  800b2e:	eb 06                	jmp    800b36 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b30:	83 c0 01             	add    $0x1,%eax
+  800b33:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b36:	39 f0                	cmp    %esi,%eax
+  800b38:	74 14                	je     800b4e <memcmp+0x30>
+		if (*s1 != *s2)
+  800b3a:	0f b6 08             	movzbl (%eax),%ecx
+  800b3d:	0f b6 1a             	movzbl (%edx),%ebx
+  800b40:	38 d9                	cmp    %bl,%cl
+  800b42:	74 ec                	je     800b30 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b44:	0f b6 c1             	movzbl %cl,%eax
+  800b47:	0f b6 db             	movzbl %bl,%ebx
+  800b4a:	29 d8                	sub    %ebx,%eax
+  800b4c:	eb 05                	jmp    800b53 <memcmp+0x35>
+	}
+
+	return 0;
+  800b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b53:	5b                   	pop    %ebx
+  800b54:	5e                   	pop    %esi
+  800b55:	5d                   	pop    %ebp
+  800b56:	c3                   	ret
+
+00800b57 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b57:	55                   	push   %ebp
+  800b58:	89 e5                	mov    %esp,%ebp
+  800b5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b60:	89 c2                	mov    %eax,%edx
+  800b62:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b65:	eb 03                	jmp    800b6a <memfind+0x13>
+  800b67:	83 c0 01             	add    $0x1,%eax
+  800b6a:	39 d0                	cmp    %edx,%eax
+  800b6c:	73 04                	jae    800b72 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b6e:	38 08                	cmp    %cl,(%eax)
+  800b70:	75 f5                	jne    800b67 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b72:	5d                   	pop    %ebp
+  800b73:	c3                   	ret
+
+00800b74 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b74:	55                   	push   %ebp
+  800b75:	89 e5                	mov    %esp,%ebp
+  800b77:	57                   	push   %edi
+  800b78:	56                   	push   %esi
+  800b79:	53                   	push   %ebx
+  800b7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b7d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b80:	eb 03                	jmp    800b85 <strtol+0x11>
+		s++;
+  800b82:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b85:	0f b6 02             	movzbl (%edx),%eax
+  800b88:	3c 20                	cmp    $0x20,%al
+  800b8a:	74 f6                	je     800b82 <strtol+0xe>
+  800b8c:	3c 09                	cmp    $0x9,%al
+  800b8e:	74 f2                	je     800b82 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b90:	3c 2b                	cmp    $0x2b,%al
+  800b92:	74 2a                	je     800bbe <strtol+0x4a>
+	int neg = 0;
+  800b94:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b99:	3c 2d                	cmp    $0x2d,%al
+  800b9b:	74 2b                	je     800bc8 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b9d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ba3:	75 0f                	jne    800bb4 <strtol+0x40>
+  800ba5:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ba8:	74 28                	je     800bd2 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800baa:	85 db                	test   %ebx,%ebx
+  800bac:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bb1:	0f 44 d8             	cmove  %eax,%ebx
+  800bb4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bb9:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bbc:	eb 46                	jmp    800c04 <strtol+0x90>
+		s++;
+  800bbe:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bc6:	eb d5                	jmp    800b9d <strtol+0x29>
+		s++, neg = 1;
+  800bc8:	83 c2 01             	add    $0x1,%edx
+  800bcb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bd0:	eb cb                	jmp    800b9d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bd2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bd6:	74 0e                	je     800be6 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bd8:	85 db                	test   %ebx,%ebx
+  800bda:	75 d8                	jne    800bb4 <strtol+0x40>
+		s++, base = 8;
+  800bdc:	83 c2 01             	add    $0x1,%edx
+  800bdf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800be4:	eb ce                	jmp    800bb4 <strtol+0x40>
+		s += 2, base = 16;
+  800be6:	83 c2 02             	add    $0x2,%edx
+  800be9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bee:	eb c4                	jmp    800bb4 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bf0:	0f be c0             	movsbl %al,%eax
+  800bf3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bf6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bf9:	7d 3a                	jge    800c35 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bfb:	83 c2 01             	add    $0x1,%edx
+  800bfe:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c02:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c04:	0f b6 02             	movzbl (%edx),%eax
+  800c07:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c0a:	89 f3                	mov    %esi,%ebx
+  800c0c:	80 fb 09             	cmp    $0x9,%bl
+  800c0f:	76 df                	jbe    800bf0 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c11:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c14:	89 f3                	mov    %esi,%ebx
+  800c16:	80 fb 19             	cmp    $0x19,%bl
+  800c19:	77 08                	ja     800c23 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c1b:	0f be c0             	movsbl %al,%eax
+  800c1e:	83 e8 57             	sub    $0x57,%eax
+  800c21:	eb d3                	jmp    800bf6 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c23:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c26:	89 f3                	mov    %esi,%ebx
+  800c28:	80 fb 19             	cmp    $0x19,%bl
+  800c2b:	77 08                	ja     800c35 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c2d:	0f be c0             	movsbl %al,%eax
+  800c30:	83 e8 37             	sub    $0x37,%eax
+  800c33:	eb c1                	jmp    800bf6 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c35:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c39:	74 05                	je     800c40 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c3b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c3e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c40:	89 c8                	mov    %ecx,%eax
+  800c42:	f7 d8                	neg    %eax
+  800c44:	85 ff                	test   %edi,%edi
+  800c46:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c49:	89 c8                	mov    %ecx,%eax
+  800c4b:	5b                   	pop    %ebx
+  800c4c:	5e                   	pop    %esi
+  800c4d:	5f                   	pop    %edi
+  800c4e:	5d                   	pop    %ebp
+  800c4f:	c3                   	ret
+
+00800c50 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c50:	55                   	push   %ebp
+  800c51:	89 e5                	mov    %esp,%ebp
+  800c53:	57                   	push   %edi
+  800c54:	56                   	push   %esi
+  800c55:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c61:	89 c3                	mov    %eax,%ebx
+  800c63:	89 c7                	mov    %eax,%edi
+  800c65:	55                   	push   %ebp
+  800c66:	89 e5                	mov    %esp,%ebp
+  800c68:	8d 35 70 0c 80 00    	lea    0x800c70,%esi
+  800c6e:	0f 34                	sysenter
+  800c70:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800c71:	5b                   	pop    %ebx
+  800c72:	5e                   	pop    %esi
+  800c73:	5f                   	pop    %edi
+  800c74:	5d                   	pop    %ebp
+  800c75:	c3                   	ret
+
+00800c76 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c76:	55                   	push   %ebp
+  800c77:	89 e5                	mov    %esp,%ebp
+  800c79:	57                   	push   %edi
+  800c7a:	56                   	push   %esi
+  800c7b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c81:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c86:	89 d1                	mov    %edx,%ecx
+  800c88:	89 d3                	mov    %edx,%ebx
+  800c8a:	89 d7                	mov    %edx,%edi
+  800c8c:	55                   	push   %ebp
+  800c8d:	89 e5                	mov    %esp,%ebp
+  800c8f:	8d 35 97 0c 80 00    	lea    0x800c97,%esi
+  800c95:	0f 34                	sysenter
+  800c97:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800c98:	5b                   	pop    %ebx
+  800c99:	5e                   	pop    %esi
+  800c9a:	5f                   	pop    %edi
+  800c9b:	5d                   	pop    %ebp
+  800c9c:	c3                   	ret
+
+00800c9d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c9d:	55                   	push   %ebp
+  800c9e:	89 e5                	mov    %esp,%ebp
+  800ca0:	57                   	push   %edi
+  800ca1:	56                   	push   %esi
+  800ca2:	53                   	push   %ebx
+  800ca3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ca6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cae:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cb3:	89 cb                	mov    %ecx,%ebx
+  800cb5:	89 cf                	mov    %ecx,%edi
+  800cb7:	55                   	push   %ebp
+  800cb8:	89 e5                	mov    %esp,%ebp
+  800cba:	8d 35 c2 0c 80 00    	lea    0x800cc2,%esi
+  800cc0:	0f 34                	sysenter
+  800cc2:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cc3:	85 c0                	test   %eax,%eax
+  800cc5:	7f 08                	jg     800ccf <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800cc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cca:	5b                   	pop    %ebx
+  800ccb:	5e                   	pop    %esi
+  800ccc:	5f                   	pop    %edi
+  800ccd:	5d                   	pop    %ebp
+  800cce:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ccf:	83 ec 0c             	sub    $0xc,%esp
+  800cd2:	50                   	push   %eax
+  800cd3:	6a 03                	push   $0x3
+  800cd5:	68 47 3d 80 00       	push   $0x803d47
+  800cda:	6a 3d                	push   $0x3d
+  800cdc:	68 64 3d 80 00       	push   $0x803d64
+  800ce1:	e8 71 f5 ff ff       	call   800257 <_panic>
+
+00800ce6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ce6:	55                   	push   %ebp
+  800ce7:	89 e5                	mov    %esp,%ebp
+  800ce9:	57                   	push   %edi
+  800cea:	56                   	push   %esi
+  800ceb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800cec:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf1:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cf6:	89 d1                	mov    %edx,%ecx
+  800cf8:	89 d3                	mov    %edx,%ebx
+  800cfa:	89 d7                	mov    %edx,%edi
+  800cfc:	55                   	push   %ebp
+  800cfd:	89 e5                	mov    %esp,%ebp
+  800cff:	8d 35 07 0d 80 00    	lea    0x800d07,%esi
+  800d05:	0f 34                	sysenter
+  800d07:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800d08:	5b                   	pop    %ebx
+  800d09:	5e                   	pop    %esi
+  800d0a:	5f                   	pop    %edi
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+
+00800d0d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	57                   	push   %edi
+  800d11:	56                   	push   %esi
+  800d12:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d13:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d18:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d1d:	89 d1                	mov    %edx,%ecx
+  800d1f:	89 d3                	mov    %edx,%ebx
+  800d21:	89 d7                	mov    %edx,%edi
+  800d23:	89 d6                	mov    %edx,%esi
+  800d25:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d27:	5b                   	pop    %ebx
+  800d28:	5e                   	pop    %esi
+  800d29:	5f                   	pop    %edi
+  800d2a:	5d                   	pop    %ebp
+  800d2b:	c3                   	ret
+
+00800d2c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d2c:	55                   	push   %ebp
+  800d2d:	89 e5                	mov    %esp,%ebp
+  800d2f:	57                   	push   %edi
+  800d30:	56                   	push   %esi
+  800d31:	53                   	push   %ebx
+  800d32:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d40:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d48:	55                   	push   %ebp
+  800d49:	89 e5                	mov    %esp,%ebp
+  800d4b:	8d 35 53 0d 80 00    	lea    0x800d53,%esi
+  800d51:	0f 34                	sysenter
+  800d53:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d54:	85 c0                	test   %eax,%eax
+  800d56:	7f 08                	jg     800d60 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800d58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d5b:	5b                   	pop    %ebx
+  800d5c:	5e                   	pop    %esi
+  800d5d:	5f                   	pop    %edi
+  800d5e:	5d                   	pop    %ebp
+  800d5f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d60:	83 ec 0c             	sub    $0xc,%esp
+  800d63:	50                   	push   %eax
+  800d64:	6a 04                	push   $0x4
+  800d66:	68 47 3d 80 00       	push   $0x803d47
+  800d6b:	6a 3d                	push   $0x3d
+  800d6d:	68 64 3d 80 00       	push   $0x803d64
+  800d72:	e8 e0 f4 ff ff       	call   800257 <_panic>
+
+00800d77 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d77:	55                   	push   %ebp
+  800d78:	89 e5                	mov    %esp,%ebp
+  800d7a:	57                   	push   %edi
+  800d7b:	56                   	push   %esi
+  800d7c:	53                   	push   %ebx
+  800d7d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d86:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d8b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d8e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d91:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d94:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d96:	85 c0                	test   %eax,%eax
+  800d98:	7f 08                	jg     800da2 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9d:	5b                   	pop    %ebx
+  800d9e:	5e                   	pop    %esi
+  800d9f:	5f                   	pop    %edi
+  800da0:	5d                   	pop    %ebp
+  800da1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800da2:	83 ec 0c             	sub    $0xc,%esp
+  800da5:	50                   	push   %eax
+  800da6:	6a 05                	push   $0x5
+  800da8:	68 47 3d 80 00       	push   $0x803d47
+  800dad:	6a 23                	push   $0x23
+  800daf:	68 64 3d 80 00       	push   $0x803d64
+  800db4:	e8 9e f4 ff ff       	call   800257 <_panic>
+
+00800db9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800db9:	55                   	push   %ebp
+  800dba:	89 e5                	mov    %esp,%ebp
+  800dbc:	57                   	push   %edi
+  800dbd:	56                   	push   %esi
+  800dbe:	53                   	push   %ebx
+  800dbf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800dc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcd:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dd2:	89 df                	mov    %ebx,%edi
+  800dd4:	55                   	push   %ebp
+  800dd5:	89 e5                	mov    %esp,%ebp
+  800dd7:	8d 35 df 0d 80 00    	lea    0x800ddf,%esi
+  800ddd:	0f 34                	sysenter
+  800ddf:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800de0:	85 c0                	test   %eax,%eax
+  800de2:	7f 08                	jg     800dec <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800de4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de7:	5b                   	pop    %ebx
+  800de8:	5e                   	pop    %esi
+  800de9:	5f                   	pop    %edi
+  800dea:	5d                   	pop    %ebp
+  800deb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dec:	83 ec 0c             	sub    $0xc,%esp
+  800def:	50                   	push   %eax
+  800df0:	6a 06                	push   $0x6
+  800df2:	68 47 3d 80 00       	push   $0x803d47
+  800df7:	6a 3d                	push   $0x3d
+  800df9:	68 64 3d 80 00       	push   $0x803d64
+  800dfe:	e8 54 f4 ff ff       	call   800257 <_panic>
+
+00800e03 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e03:	55                   	push   %ebp
+  800e04:	89 e5                	mov    %esp,%ebp
+  800e06:	57                   	push   %edi
+  800e07:	56                   	push   %esi
+  800e08:	53                   	push   %ebx
+  800e09:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e11:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e17:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e1c:	89 df                	mov    %ebx,%edi
+  800e1e:	55                   	push   %ebp
+  800e1f:	89 e5                	mov    %esp,%ebp
+  800e21:	8d 35 29 0e 80 00    	lea    0x800e29,%esi
+  800e27:	0f 34                	sysenter
+  800e29:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e2a:	85 c0                	test   %eax,%eax
+  800e2c:	7f 08                	jg     800e36 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800e2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e31:	5b                   	pop    %ebx
+  800e32:	5e                   	pop    %esi
+  800e33:	5f                   	pop    %edi
+  800e34:	5d                   	pop    %ebp
+  800e35:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e36:	83 ec 0c             	sub    $0xc,%esp
+  800e39:	50                   	push   %eax
+  800e3a:	6a 08                	push   $0x8
+  800e3c:	68 47 3d 80 00       	push   $0x803d47
+  800e41:	6a 3d                	push   $0x3d
+  800e43:	68 64 3d 80 00       	push   $0x803d64
+  800e48:	e8 0a f4 ff ff       	call   800257 <_panic>
+
+00800e4d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e4d:	55                   	push   %ebp
+  800e4e:	89 e5                	mov    %esp,%ebp
+  800e50:	57                   	push   %edi
+  800e51:	56                   	push   %esi
+  800e52:	53                   	push   %ebx
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e61:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e66:	89 df                	mov    %ebx,%edi
+  800e68:	55                   	push   %ebp
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	8d 35 73 0e 80 00    	lea    0x800e73,%esi
+  800e71:	0f 34                	sysenter
+  800e73:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e74:	85 c0                	test   %eax,%eax
+  800e76:	7f 08                	jg     800e80 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800e78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7b:	5b                   	pop    %ebx
+  800e7c:	5e                   	pop    %esi
+  800e7d:	5f                   	pop    %edi
+  800e7e:	5d                   	pop    %ebp
+  800e7f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e80:	83 ec 0c             	sub    $0xc,%esp
+  800e83:	50                   	push   %eax
+  800e84:	6a 09                	push   $0x9
+  800e86:	68 47 3d 80 00       	push   $0x803d47
+  800e8b:	6a 3d                	push   $0x3d
+  800e8d:	68 64 3d 80 00       	push   $0x803d64
+  800e92:	e8 c0 f3 ff ff       	call   800257 <_panic>
+
+00800e97 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	57                   	push   %edi
+  800e9b:	56                   	push   %esi
+  800e9c:	53                   	push   %ebx
+  800e9d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ea0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eab:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eb0:	89 df                	mov    %ebx,%edi
+  800eb2:	55                   	push   %ebp
+  800eb3:	89 e5                	mov    %esp,%ebp
+  800eb5:	8d 35 bd 0e 80 00    	lea    0x800ebd,%esi
+  800ebb:	0f 34                	sysenter
+  800ebd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ebe:	85 c0                	test   %eax,%eax
+  800ec0:	7f 08                	jg     800eca <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800ec2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eca:	83 ec 0c             	sub    $0xc,%esp
+  800ecd:	50                   	push   %eax
+  800ece:	6a 0a                	push   $0xa
+  800ed0:	68 47 3d 80 00       	push   $0x803d47
+  800ed5:	6a 3d                	push   $0x3d
+  800ed7:	68 64 3d 80 00       	push   $0x803d64
+  800edc:	e8 76 f3 ff ff       	call   800257 <_panic>
+
+00800ee1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	57                   	push   %edi
+  800ee5:	56                   	push   %esi
+  800ee6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ee7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eed:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ef2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef8:	55                   	push   %ebp
+  800ef9:	89 e5                	mov    %esp,%ebp
+  800efb:	8d 35 03 0f 80 00    	lea    0x800f03,%esi
+  800f01:	0f 34                	sysenter
+  800f03:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800f04:	5b                   	pop    %ebx
+  800f05:	5e                   	pop    %esi
+  800f06:	5f                   	pop    %edi
+  800f07:	5d                   	pop    %ebp
+  800f08:	c3                   	ret
+
+00800f09 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800f09:	55                   	push   %ebp
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	57                   	push   %edi
+  800f0d:	56                   	push   %esi
+  800f0e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f15:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f1a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f1d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f20:	55                   	push   %ebp
+  800f21:	89 e5                	mov    %esp,%ebp
+  800f23:	8d 35 2b 0f 80 00    	lea    0x800f2b,%esi
+  800f29:	0f 34                	sysenter
+  800f2b:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800f2c:	5b                   	pop    %ebx
+  800f2d:	5e                   	pop    %esi
+  800f2e:	5f                   	pop    %edi
+  800f2f:	5d                   	pop    %ebp
+  800f30:	c3                   	ret
+
+00800f31 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800f31:	55                   	push   %ebp
+  800f32:	89 e5                	mov    %esp,%ebp
+  800f34:	57                   	push   %edi
+  800f35:	56                   	push   %esi
+  800f36:	53                   	push   %ebx
+  800f37:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f3a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f42:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f45:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f4d:	89 f7                	mov    %esi,%edi
+  800f4f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f51:	85 c0                	test   %eax,%eax
+  800f53:	7f 08                	jg     800f5d <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800f55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f58:	5b                   	pop    %ebx
+  800f59:	5e                   	pop    %esi
+  800f5a:	5f                   	pop    %edi
+  800f5b:	5d                   	pop    %ebp
+  800f5c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5d:	83 ec 0c             	sub    $0xc,%esp
+  800f60:	50                   	push   %eax
+  800f61:	6a 0d                	push   $0xd
+  800f63:	68 47 3d 80 00       	push   $0x803d47
+  800f68:	6a 23                	push   $0x23
+  800f6a:	68 64 3d 80 00       	push   $0x803d64
+  800f6f:	e8 e3 f2 ff ff       	call   800257 <_panic>
+
+00800f74 <sys_ipc_recv>:
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800f7a:	6a 00                	push   $0x0
+  800f7c:	6a 01                	push   $0x1
+  800f7e:	ff 75 08             	push   0x8(%ebp)
+  800f81:	e8 ab ff ff ff       	call   800f31 <sys_ipc_recvv>
+}
+  800f86:	c9                   	leave
+  800f87:	c3                   	ret
+
+00800f88 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	57                   	push   %edi
+  800f8c:	56                   	push   %esi
+  800f8d:	53                   	push   %ebx
+  800f8e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fa1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800fa4:	89 de                	mov    %ebx,%esi
+  800fa6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa8:	85 c0                	test   %eax,%eax
+  800faa:	7f 08                	jg     800fb4 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800fac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800faf:	5b                   	pop    %ebx
+  800fb0:	5e                   	pop    %esi
+  800fb1:	5f                   	pop    %edi
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb4:	83 ec 0c             	sub    $0xc,%esp
+  800fb7:	50                   	push   %eax
+  800fb8:	6a 0d                	push   $0xd
+  800fba:	68 47 3d 80 00       	push   $0x803d47
+  800fbf:	6a 23                	push   $0x23
+  800fc1:	68 64 3d 80 00       	push   $0x803d64
+  800fc6:	e8 8c f2 ff ff       	call   800257 <_panic>
+
+00800fcb <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fcb:	55                   	push   %ebp
+  800fcc:	89 e5                	mov    %esp,%ebp
+  800fce:	57                   	push   %edi
+  800fcf:	56                   	push   %esi
+  800fd0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fdb:	89 d1                	mov    %edx,%ecx
+  800fdd:	89 d3                	mov    %edx,%ebx
+  800fdf:	89 d7                	mov    %edx,%edi
+  800fe1:	55                   	push   %ebp
+  800fe2:	89 e5                	mov    %esp,%ebp
+  800fe4:	8d 35 ec 0f 80 00    	lea    0x800fec,%esi
+  800fea:	0f 34                	sysenter
+  800fec:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800fed:	5b                   	pop    %ebx
+  800fee:	5e                   	pop    %esi
+  800fef:	5f                   	pop    %edi
+  800ff0:	5d                   	pop    %ebp
+  800ff1:	c3                   	ret
+
+00800ff2 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	57                   	push   %edi
+  800ff6:	56                   	push   %esi
+  800ff7:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ff8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801000:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801003:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801008:	89 df                	mov    %ebx,%edi
+  80100a:	55                   	push   %ebp
+  80100b:	89 e5                	mov    %esp,%ebp
+  80100d:	8d 35 15 10 80 00    	lea    0x801015,%esi
+  801013:	0f 34                	sysenter
+  801015:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  801016:	5b                   	pop    %ebx
+  801017:	5e                   	pop    %esi
+  801018:	5f                   	pop    %edi
+  801019:	5d                   	pop    %ebp
+  80101a:	c3                   	ret
+
+0080101b <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	56                   	push   %esi
+  801020:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801021:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801026:	8b 55 08             	mov    0x8(%ebp),%edx
+  801029:	b8 10 00 00 00       	mov    $0x10,%eax
+  80102e:	89 cb                	mov    %ecx,%ebx
+  801030:	89 cf                	mov    %ecx,%edi
+  801032:	55                   	push   %ebp
+  801033:	89 e5                	mov    %esp,%ebp
+  801035:	8d 35 3d 10 80 00    	lea    0x80103d,%esi
+  80103b:	0f 34                	sysenter
+  80103d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  80103e:	5b                   	pop    %ebx
+  80103f:	5e                   	pop    %esi
+  801040:	5f                   	pop    %edi
+  801041:	5d                   	pop    %ebp
+  801042:	c3                   	ret
+
+00801043 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  801043:	55                   	push   %ebp
+  801044:	89 e5                	mov    %esp,%ebp
+  801046:	57                   	push   %edi
+  801047:	56                   	push   %esi
+  801048:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801049:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801051:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801054:	b8 12 00 00 00       	mov    $0x12,%eax
+  801059:	89 df                	mov    %ebx,%edi
+  80105b:	55                   	push   %ebp
+  80105c:	89 e5                	mov    %esp,%ebp
+  80105e:	8d 35 66 10 80 00    	lea    0x801066,%esi
+  801064:	0f 34                	sysenter
+  801066:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  801067:	5b                   	pop    %ebx
+  801068:	5e                   	pop    %esi
+  801069:	5f                   	pop    %edi
+  80106a:	5d                   	pop    %ebp
+  80106b:	c3                   	ret
+
+0080106c <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  80106c:	55                   	push   %ebp
+  80106d:	89 e5                	mov    %esp,%ebp
+  80106f:	57                   	push   %edi
+  801070:	56                   	push   %esi
+  801071:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801072:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801077:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801082:	89 df                	mov    %ebx,%edi
+  801084:	55                   	push   %ebp
+  801085:	89 e5                	mov    %esp,%ebp
+  801087:	8d 35 8f 10 80 00    	lea    0x80108f,%esi
+  80108d:	0f 34                	sysenter
+  80108f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  801090:	5b                   	pop    %ebx
+  801091:	5e                   	pop    %esi
+  801092:	5f                   	pop    %edi
+  801093:	5d                   	pop    %ebp
+  801094:	c3                   	ret
+
+00801095 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  801095:	55                   	push   %ebp
+  801096:	89 e5                	mov    %esp,%ebp
+  801098:	57                   	push   %edi
+  801099:	56                   	push   %esi
+  80109a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80109b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a1:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	8d 35 b7 10 80 00    	lea    0x8010b7,%esi
+  8010b5:	0f 34                	sysenter
+  8010b7:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  8010b8:	5b                   	pop    %ebx
+  8010b9:	5e                   	pop    %esi
+  8010ba:	5f                   	pop    %edi
+  8010bb:	5d                   	pop    %ebp
+  8010bc:	c3                   	ret
+
+008010bd <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  8010bd:	55                   	push   %ebp
+  8010be:	89 e5                	mov    %esp,%ebp
+  8010c0:	57                   	push   %edi
+  8010c1:	56                   	push   %esi
+  8010c2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cb:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010d0:	89 cb                	mov    %ecx,%ebx
+  8010d2:	89 cf                	mov    %ecx,%edi
+  8010d4:	89 ce                	mov    %ecx,%esi
+  8010d6:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  8010d8:	5b                   	pop    %ebx
+  8010d9:	5e                   	pop    %esi
+  8010da:	5f                   	pop    %edi
+  8010db:	5d                   	pop    %ebp
+  8010dc:	c3                   	ret
+
+008010dd <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  8010dd:	55                   	push   %ebp
+  8010de:	89 e5                	mov    %esp,%ebp
+  8010e0:	57                   	push   %edi
+  8010e1:	56                   	push   %esi
+  8010e2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010eb:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010f0:	89 cb                	mov    %ecx,%ebx
+  8010f2:	89 cf                	mov    %ecx,%edi
+  8010f4:	55                   	push   %ebp
+  8010f5:	89 e5                	mov    %esp,%ebp
+  8010f7:	8d 35 ff 10 80 00    	lea    0x8010ff,%esi
+  8010fd:	0f 34                	sysenter
+  8010ff:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  801100:	5b                   	pop    %ebx
+  801101:	5e                   	pop    %esi
+  801102:	5f                   	pop    %edi
+  801103:	5d                   	pop    %ebp
+  801104:	c3                   	ret
+
+00801105 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	57                   	push   %edi
+  801109:	56                   	push   %esi
+  80110a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80110b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801110:	8b 55 08             	mov    0x8(%ebp),%edx
+  801113:	b8 16 00 00 00       	mov    $0x16,%eax
+  801118:	89 cb                	mov    %ecx,%ebx
+  80111a:	89 cf                	mov    %ecx,%edi
+  80111c:	55                   	push   %ebp
+  80111d:	89 e5                	mov    %esp,%ebp
+  80111f:	8d 35 27 11 80 00    	lea    0x801127,%esi
+  801125:	0f 34                	sysenter
+  801127:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  801128:	5b                   	pop    %ebx
+  801129:	5e                   	pop    %esi
+  80112a:	5f                   	pop    %edi
+  80112b:	5d                   	pop    %ebp
+  80112c:	c3                   	ret
+
+0080112d <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  80112d:	55                   	push   %ebp
+  80112e:	89 e5                	mov    %esp,%ebp
+  801130:	57                   	push   %edi
+  801131:	56                   	push   %esi
+  801132:	53                   	push   %ebx
+  801133:	83 ec 20             	sub    $0x20,%esp
+  801136:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801139:	89 d7                	mov    %edx,%edi
+  80113b:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  80113d:	51                   	push   %ecx
+  80113e:	68 00 f0 7f 00       	push   $0x7ff000
+  801143:	6a 00                	push   $0x0
+  801145:	e8 e2 fb ff ff       	call   800d2c <sys_page_alloc>
+  80114a:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80114c:	83 c4 10             	add    $0x10,%esp
+  80114f:	85 c0                	test   %eax,%eax
+  801151:	78 45                	js     801198 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  801153:	83 ec 04             	sub    $0x4,%esp
+  801156:	68 00 10 00 00       	push   $0x1000
+  80115b:	57                   	push   %edi
+  80115c:	68 00 f0 7f 00       	push   $0x7ff000
+  801161:	e8 40 f9 ff ff       	call   800aa6 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  801166:	89 34 24             	mov    %esi,(%esp)
+  801169:	57                   	push   %edi
+  80116a:	ff 75 e4             	push   -0x1c(%ebp)
+  80116d:	68 00 f0 7f 00       	push   $0x7ff000
+  801172:	6a 00                	push   $0x0
+  801174:	e8 fe fb ff ff       	call   800d77 <sys_page_map>
+  801179:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80117b:	83 c4 20             	add    $0x20,%esp
+  80117e:	85 c0                	test   %eax,%eax
+  801180:	78 16                	js     801198 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801182:	83 ec 08             	sub    $0x8,%esp
+  801185:	68 00 f0 7f 00       	push   $0x7ff000
+  80118a:	6a 00                	push   $0x0
+  80118c:	e8 28 fc ff ff       	call   800db9 <sys_page_unmap>
+  801191:	83 c4 10             	add    $0x10,%esp
+  801194:	85 c0                	test   %eax,%eax
+  801196:	75 0a                	jne    8011a2 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  801198:	89 d8                	mov    %ebx,%eax
+  80119a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80119d:	5b                   	pop    %ebx
+  80119e:	5e                   	pop    %esi
+  80119f:	5f                   	pop    %edi
+  8011a0:	5d                   	pop    %ebp
+  8011a1:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8011a2:	68 74 3d 80 00       	push   $0x803d74
+  8011a7:	68 ec 3d 80 00       	push   $0x803dec
+  8011ac:	6a 1b                	push   $0x1b
+  8011ae:	68 01 3e 80 00       	push   $0x803e01
+  8011b3:	e8 9f f0 ff ff       	call   800257 <_panic>
+
+008011b8 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8011b8:	55                   	push   %ebp
+  8011b9:	89 e5                	mov    %esp,%ebp
+  8011bb:	53                   	push   %ebx
+  8011bc:	83 ec 04             	sub    $0x4,%esp
+  8011bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8011c2:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8011c4:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  8011c8:	74 21                	je     8011eb <pgfault+0x33>
+  8011ca:	89 d0                	mov    %edx,%eax
+  8011cc:	c1 e8 16             	shr    $0x16,%eax
+  8011cf:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8011d6:	a8 01                	test   $0x1,%al
+  8011d8:	74 11                	je     8011eb <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  8011da:	89 d0                	mov    %edx,%eax
+  8011dc:	c1 e8 0c             	shr    $0xc,%eax
+  8011df:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011e6:	f6 c4 08             	test   $0x8,%ah
+  8011e9:	75 17                	jne    801202 <pgfault+0x4a>
+		if (pgfault_next) {
+  8011eb:	a1 04 60 80 00       	mov    0x806004,%eax
+  8011f0:	85 c0                	test   %eax,%eax
+  8011f2:	74 27                	je     80121b <pgfault+0x63>
+			pgfault_next(utf);
+  8011f4:	83 ec 0c             	sub    $0xc,%esp
+  8011f7:	53                   	push   %ebx
+  8011f8:	ff d0                	call   *%eax
+			return;
+  8011fa:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8011fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801200:	c9                   	leave
+  801201:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  801202:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  801208:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80120d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801212:	e8 16 ff ff ff       	call   80112d <copy_page_to>
+  801217:	85 c0                	test   %eax,%eax
+  801219:	79 e2                	jns    8011fd <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  80121b:	a1 00 60 80 00       	mov    0x806000,%eax
+  801220:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  801223:	ff 73 28             	push   0x28(%ebx)
+  801226:	ff 33                	push   (%ebx)
+  801228:	50                   	push   %eax
+  801229:	68 98 3d 80 00       	push   $0x803d98
+  80122e:	e8 ff f0 ff ff       	call   800332 <cprintf>
+	sys_env_destroy(0);
+  801233:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80123a:	e8 5e fa ff ff       	call   800c9d <sys_env_destroy>
+  80123f:	83 c4 10             	add    $0x10,%esp
+  801242:	eb b9                	jmp    8011fd <pgfault+0x45>
+
+00801244 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  801244:	55                   	push   %ebp
+  801245:	89 e5                	mov    %esp,%ebp
+  801247:	53                   	push   %ebx
+  801248:	83 ec 04             	sub    $0x4,%esp
+  80124b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80124e:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  801253:	3d b8 11 80 00       	cmp    $0x8011b8,%eax
+  801258:	74 15                	je     80126f <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  80125a:	a3 04 60 80 00       	mov    %eax,0x806004
+		set_pgfault_handler(pgfault);
+  80125f:	83 ec 0c             	sub    $0xc,%esp
+  801262:	68 b8 11 80 00       	push   $0x8011b8
+  801267:	e8 b6 23 00 00       	call   803622 <set_pgfault_handler>
+  80126c:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80126f:	83 ec 0c             	sub    $0xc,%esp
+  801272:	68 05 08 00 00       	push   $0x805
+  801277:	53                   	push   %ebx
+  801278:	6a 00                	push   $0x0
+  80127a:	53                   	push   %ebx
+  80127b:	6a 00                	push   $0x0
+  80127d:	e8 f5 fa ff ff       	call   800d77 <sys_page_map>
+}
+  801282:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801285:	c9                   	leave
+  801286:	c3                   	ret
+
+00801287 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801287:	55                   	push   %ebp
+  801288:	89 e5                	mov    %esp,%ebp
+  80128a:	57                   	push   %edi
+  80128b:	56                   	push   %esi
+  80128c:	53                   	push   %ebx
+  80128d:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801290:	68 b8 11 80 00       	push   $0x8011b8
+  801295:	e8 88 23 00 00       	call   803622 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80129a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80129f:	cd 30                	int    $0x30
+  8012a1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8012a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8012a7:	83 c4 10             	add    $0x10,%esp
+  8012aa:	85 c0                	test   %eax,%eax
+  8012ac:	0f 88 6b 01 00 00    	js     80141d <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8012b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8012b7:	75 37                	jne    8012f0 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8012b9:	e8 28 fa ff ff       	call   800ce6 <sys_getenvid>
+  8012be:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8012c3:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8012c9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8012ce:	a3 00 60 80 00       	mov    %eax,0x806000
+		return 0;
+  8012d3:	e9 45 01 00 00       	jmp    80141d <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8012d8:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8012de:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8012e4:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8012ea:	0f 87 ba 00 00 00    	ja     8013aa <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8012f0:	89 d8                	mov    %ebx,%eax
+  8012f2:	c1 e8 16             	shr    $0x16,%eax
+  8012f5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012fc:	a8 01                	test   $0x1,%al
+  8012fe:	74 d8                	je     8012d8 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  801300:	89 d8                	mov    %ebx,%eax
+  801302:	c1 e8 0c             	shr    $0xc,%eax
+  801305:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80130c:	f6 c2 01             	test   $0x1,%dl
+  80130f:	74 cd                	je     8012de <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  801311:	89 da                	mov    %ebx,%edx
+  801313:	80 e6 df             	and    $0xdf,%dh
+  801316:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  80131c:	74 c0                	je     8012de <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  80131e:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801320:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801327:	f6 c6 04             	test   $0x4,%dh
+  80132a:	75 53                	jne    80137f <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80132c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801333:	f6 c6 08             	test   $0x8,%dh
+  801336:	75 0c                	jne    801344 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  801338:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80133f:	f6 c2 02             	test   $0x2,%dl
+  801342:	74 3b                	je     80137f <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  801344:	83 ec 0c             	sub    $0xc,%esp
+  801347:	68 05 08 00 00       	push   $0x805
+  80134c:	57                   	push   %edi
+  80134d:	ff 75 e4             	push   -0x1c(%ebp)
+  801350:	57                   	push   %edi
+  801351:	6a 00                	push   $0x0
+  801353:	e8 1f fa ff ff       	call   800d77 <sys_page_map>
+  801358:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80135a:	83 c4 20             	add    $0x20,%esp
+  80135d:	85 c0                	test   %eax,%eax
+  80135f:	0f 88 a7 00 00 00    	js     80140c <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801365:	83 ec 0c             	sub    $0xc,%esp
+  801368:	68 05 08 00 00       	push   $0x805
+  80136d:	57                   	push   %edi
+  80136e:	6a 00                	push   $0x0
+  801370:	57                   	push   %edi
+  801371:	6a 00                	push   $0x0
+  801373:	e8 ff f9 ff ff       	call   800d77 <sys_page_map>
+  801378:	89 c6                	mov    %eax,%esi
+	return r;
+  80137a:	83 c4 20             	add    $0x20,%esp
+  80137d:	eb 21                	jmp    8013a0 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  80137f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801386:	83 ec 0c             	sub    $0xc,%esp
+  801389:	25 07 0e 00 00       	and    $0xe07,%eax
+  80138e:	50                   	push   %eax
+  80138f:	57                   	push   %edi
+  801390:	ff 75 e4             	push   -0x1c(%ebp)
+  801393:	57                   	push   %edi
+  801394:	6a 00                	push   $0x0
+  801396:	e8 dc f9 ff ff       	call   800d77 <sys_page_map>
+  80139b:	89 c6                	mov    %eax,%esi
+  80139d:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8013a0:	85 f6                	test   %esi,%esi
+  8013a2:	0f 89 36 ff ff ff    	jns    8012de <fork+0x57>
+  8013a8:	eb 62                	jmp    80140c <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8013aa:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8013af:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8013b4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8013b7:	89 f8                	mov    %edi,%eax
+  8013b9:	e8 6f fd ff ff       	call   80112d <copy_page_to>
+  8013be:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8013c0:	85 c0                	test   %eax,%eax
+  8013c2:	78 48                	js     80140c <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8013c4:	83 ec 04             	sub    $0x4,%esp
+  8013c7:	6a 07                	push   $0x7
+  8013c9:	68 00 f0 bf ee       	push   $0xeebff000
+  8013ce:	57                   	push   %edi
+  8013cf:	e8 58 f9 ff ff       	call   800d2c <sys_page_alloc>
+  8013d4:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8013d6:	83 c4 10             	add    $0x10,%esp
+  8013d9:	85 c0                	test   %eax,%eax
+  8013db:	78 2f                	js     80140c <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8013dd:	a1 00 60 80 00       	mov    0x806000,%eax
+  8013e2:	8b 40 64             	mov    0x64(%eax),%eax
+  8013e5:	83 ec 08             	sub    $0x8,%esp
+  8013e8:	50                   	push   %eax
+  8013e9:	57                   	push   %edi
+  8013ea:	e8 a8 fa ff ff       	call   800e97 <sys_env_set_pgfault_upcall>
+  8013ef:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8013f1:	83 c4 10             	add    $0x10,%esp
+  8013f4:	85 c0                	test   %eax,%eax
+  8013f6:	78 14                	js     80140c <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8013f8:	83 ec 08             	sub    $0x8,%esp
+  8013fb:	6a 02                	push   $0x2
+  8013fd:	57                   	push   %edi
+  8013fe:	e8 00 fa ff ff       	call   800e03 <sys_env_set_status>
+  801403:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801405:	83 c4 10             	add    $0x10,%esp
+  801408:	85 c0                	test   %eax,%eax
+  80140a:	79 11                	jns    80141d <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  80140c:	83 ec 0c             	sub    $0xc,%esp
+  80140f:	ff 75 e0             	push   -0x20(%ebp)
+  801412:	e8 86 f8 ff ff       	call   800c9d <sys_env_destroy>
+	return r;
+  801417:	83 c4 10             	add    $0x10,%esp
+  80141a:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  80141d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801420:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801423:	5b                   	pop    %ebx
+  801424:	5e                   	pop    %esi
+  801425:	5f                   	pop    %edi
+  801426:	5d                   	pop    %ebp
+  801427:	c3                   	ret
+
+00801428 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801428:	55                   	push   %ebp
+  801429:	89 e5                	mov    %esp,%ebp
+  80142b:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80142e:	68 0c 3e 80 00       	push   $0x803e0c
+  801433:	68 bf 00 00 00       	push   $0xbf
+  801438:	68 01 3e 80 00       	push   $0x803e01
+  80143d:	e8 15 ee ff ff       	call   800257 <_panic>
+
+00801442 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801442:	55                   	push   %ebp
+  801443:	89 e5                	mov    %esp,%ebp
+  801445:	56                   	push   %esi
+  801446:	53                   	push   %ebx
+  801447:	8b 75 08             	mov    0x8(%ebp),%esi
+  80144a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80144d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  801450:	85 c0                	test   %eax,%eax
+  801452:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801457:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80145a:	83 ec 0c             	sub    $0xc,%esp
+  80145d:	50                   	push   %eax
+  80145e:	e8 11 fb ff ff       	call   800f74 <sys_ipc_recv>
+	if (from_env_store)
+  801463:	83 c4 10             	add    $0x10,%esp
+  801466:	85 f6                	test   %esi,%esi
+  801468:	74 14                	je     80147e <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80146a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80146f:	85 c0                	test   %eax,%eax
+  801471:	75 09                	jne    80147c <ipc_recv+0x3a>
+  801473:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  801479:	8b 52 74             	mov    0x74(%edx),%edx
+  80147c:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  80147e:	85 db                	test   %ebx,%ebx
+  801480:	74 25                	je     8014a7 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801482:	85 c0                	test   %eax,%eax
+  801484:	74 0d                	je     801493 <ipc_recv+0x51>
+  801486:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  80148c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80148f:	5b                   	pop    %ebx
+  801490:	5e                   	pop    %esi
+  801491:	5d                   	pop    %ebp
+  801492:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801493:	a1 00 60 80 00       	mov    0x806000,%eax
+  801498:	8b 40 78             	mov    0x78(%eax),%eax
+  80149b:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  80149d:	a1 00 60 80 00       	mov    0x806000,%eax
+  8014a2:	8b 40 70             	mov    0x70(%eax),%eax
+  8014a5:	eb e5                	jmp    80148c <ipc_recv+0x4a>
+  8014a7:	85 c0                	test   %eax,%eax
+  8014a9:	75 e1                	jne    80148c <ipc_recv+0x4a>
+  8014ab:	eb f0                	jmp    80149d <ipc_recv+0x5b>
+
+008014ad <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8014ad:	55                   	push   %ebp
+  8014ae:	89 e5                	mov    %esp,%ebp
+  8014b0:	57                   	push   %edi
+  8014b1:	56                   	push   %esi
+  8014b2:	53                   	push   %ebx
+  8014b3:	83 ec 0c             	sub    $0xc,%esp
+  8014b6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8014bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8014bf:	85 db                	test   %ebx,%ebx
+  8014c1:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8014c6:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8014c9:	ff 75 14             	push   0x14(%ebp)
+  8014cc:	53                   	push   %ebx
+  8014cd:	56                   	push   %esi
+  8014ce:	57                   	push   %edi
+  8014cf:	e8 0d fa ff ff       	call   800ee1 <sys_ipc_try_send>
+  8014d4:	83 c4 10             	add    $0x10,%esp
+  8014d7:	85 c0                	test   %eax,%eax
+  8014d9:	74 22                	je     8014fd <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  8014db:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8014de:	75 07                	jne    8014e7 <ipc_send+0x3a>
+		sys_yield();
+  8014e0:	e8 28 f8 ff ff       	call   800d0d <sys_yield>
+  8014e5:	eb e2                	jmp    8014c9 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8014e7:	68 22 3e 80 00       	push   $0x803e22
+  8014ec:	68 ec 3d 80 00       	push   $0x803dec
+  8014f1:	6a 39                	push   $0x39
+  8014f3:	68 37 3e 80 00       	push   $0x803e37
+  8014f8:	e8 5a ed ff ff       	call   800257 <_panic>
+	}
+}
+  8014fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801500:	5b                   	pop    %ebx
+  801501:	5e                   	pop    %esi
+  801502:	5f                   	pop    %edi
+  801503:	5d                   	pop    %ebp
+  801504:	c3                   	ret
+
+00801505 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  801505:	55                   	push   %ebp
+  801506:	89 e5                	mov    %esp,%ebp
+  801508:	57                   	push   %edi
+  801509:	56                   	push   %esi
+  80150a:	53                   	push   %ebx
+  80150b:	83 ec 10             	sub    $0x10,%esp
+  80150e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801511:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801514:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801517:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80151a:	85 c0                	test   %eax,%eax
+  80151c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801521:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  801524:	6a 00                	push   $0x0
+  801526:	ff 33                	push   (%ebx)
+  801528:	50                   	push   %eax
+  801529:	e8 03 fa ff ff       	call   800f31 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80152e:	83 c4 10             	add    $0x10,%esp
+  801531:	85 c0                	test   %eax,%eax
+  801533:	75 3c                	jne    801571 <ipc_recvv+0x6c>
+  801535:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80153b:	8b 52 7c             	mov    0x7c(%edx),%edx
+  80153e:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  801540:	85 ff                	test   %edi,%edi
+  801542:	74 4e                	je     801592 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801544:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80154a:	8b 52 74             	mov    0x74(%edx),%edx
+  80154d:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  80154f:	85 f6                	test   %esi,%esi
+  801551:	74 18                	je     80156b <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801553:	85 c0                	test   %eax,%eax
+  801555:	75 2d                	jne    801584 <ipc_recvv+0x7f>
+  801557:	a1 00 60 80 00       	mov    0x806000,%eax
+  80155c:	8b 40 78             	mov    0x78(%eax),%eax
+  80155f:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  801561:	a1 00 60 80 00       	mov    0x806000,%eax
+  801566:	8b 40 70             	mov    0x70(%eax),%eax
+  801569:	eb 1f                	jmp    80158a <ipc_recvv+0x85>
+  80156b:	85 c0                	test   %eax,%eax
+  80156d:	75 1b                	jne    80158a <ipc_recvv+0x85>
+  80156f:	eb f0                	jmp    801561 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  801571:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  801577:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  80157c:	85 ff                	test   %edi,%edi
+  80157e:	75 cd                	jne    80154d <ipc_recvv+0x48>
+	if (perm_store)
+  801580:	85 f6                	test   %esi,%esi
+  801582:	74 e7                	je     80156b <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  801584:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  80158a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80158d:	5b                   	pop    %ebx
+  80158e:	5e                   	pop    %esi
+  80158f:	5f                   	pop    %edi
+  801590:	5d                   	pop    %ebp
+  801591:	c3                   	ret
+	if (perm_store)
+  801592:	85 f6                	test   %esi,%esi
+  801594:	75 bd                	jne    801553 <ipc_recvv+0x4e>
+  801596:	eb c9                	jmp    801561 <ipc_recvv+0x5c>
+
+00801598 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  801598:	55                   	push   %ebp
+  801599:	89 e5                	mov    %esp,%ebp
+  80159b:	57                   	push   %edi
+  80159c:	56                   	push   %esi
+  80159d:	53                   	push   %ebx
+  80159e:	83 ec 0c             	sub    $0xc,%esp
+  8015a1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015a4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8015a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8015aa:	ff 75 14             	push   0x14(%ebp)
+  8015ad:	53                   	push   %ebx
+  8015ae:	56                   	push   %esi
+  8015af:	57                   	push   %edi
+  8015b0:	e8 54 f9 ff ff       	call   800f09 <sys_ipc_try_sendv>
+  8015b5:	83 c4 10             	add    $0x10,%esp
+  8015b8:	85 c0                	test   %eax,%eax
+  8015ba:	74 22                	je     8015de <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8015bc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8015bf:	75 07                	jne    8015c8 <ipc_sendv+0x30>
+		sys_yield();
+  8015c1:	e8 47 f7 ff ff       	call   800d0d <sys_yield>
+  8015c6:	eb e2                	jmp    8015aa <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8015c8:	68 22 3e 80 00       	push   $0x803e22
+  8015cd:	68 ec 3d 80 00       	push   $0x803dec
+  8015d2:	6a 5c                	push   $0x5c
+  8015d4:	68 37 3e 80 00       	push   $0x803e37
+  8015d9:	e8 79 ec ff ff       	call   800257 <_panic>
+	}
+}
+  8015de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e1:	5b                   	pop    %ebx
+  8015e2:	5e                   	pop    %esi
+  8015e3:	5f                   	pop    %edi
+  8015e4:	5d                   	pop    %ebp
+  8015e5:	c3                   	ret
+
+008015e6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8015e6:	55                   	push   %ebp
+  8015e7:	89 e5                	mov    %esp,%ebp
+  8015e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8015ec:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8015f1:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8015f7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8015fd:	8b 52 50             	mov    0x50(%edx),%edx
+  801600:	39 ca                	cmp    %ecx,%edx
+  801602:	74 11                	je     801615 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801604:	83 c0 01             	add    $0x1,%eax
+  801607:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80160c:	75 e3                	jne    8015f1 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80160e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801613:	eb 0e                	jmp    801623 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801615:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80161b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801620:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801623:	5d                   	pop    %ebp
+  801624:	c3                   	ret
+
+00801625 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801625:	55                   	push   %ebp
+  801626:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801628:	8b 45 08             	mov    0x8(%ebp),%eax
+  80162b:	05 00 00 00 30       	add    $0x30000000,%eax
+  801630:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801633:	5d                   	pop    %ebp
+  801634:	c3                   	ret
+
+00801635 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801635:	55                   	push   %ebp
+  801636:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801638:	8b 45 08             	mov    0x8(%ebp),%eax
+  80163b:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801640:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801645:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80164a:	5d                   	pop    %ebp
+  80164b:	c3                   	ret
+
+0080164c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80164c:	55                   	push   %ebp
+  80164d:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80164f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801654:	eb 02                	jmp    801658 <fd_alloc+0xc>
+  801656:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801658:	89 c2                	mov    %eax,%edx
+  80165a:	c1 ea 16             	shr    $0x16,%edx
+  80165d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801664:	f6 c2 01             	test   $0x1,%dl
+  801667:	74 2b                	je     801694 <fd_alloc+0x48>
+  801669:	89 c2                	mov    %eax,%edx
+  80166b:	c1 ea 0c             	shr    $0xc,%edx
+  80166e:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801675:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80167b:	f6 c1 01             	test   $0x1,%cl
+  80167e:	74 14                	je     801694 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801680:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801686:	75 ce                	jne    801656 <fd_alloc+0xa>
+  801688:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80168d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801692:	eb 05                	jmp    801699 <fd_alloc+0x4d>
+			return 0;
+  801694:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801699:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169c:	89 02                	mov    %eax,(%edx)
+}
+  80169e:	89 c8                	mov    %ecx,%eax
+  8016a0:	5d                   	pop    %ebp
+  8016a1:	c3                   	ret
+
+008016a2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8016a2:	55                   	push   %ebp
+  8016a3:	89 e5                	mov    %esp,%ebp
+  8016a5:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8016a8:	83 f8 1f             	cmp    $0x1f,%eax
+  8016ab:	77 30                	ja     8016dd <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8016ad:	c1 e0 0c             	shl    $0xc,%eax
+  8016b0:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8016b5:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8016bb:	f6 c2 01             	test   $0x1,%dl
+  8016be:	74 24                	je     8016e4 <fd_lookup+0x42>
+  8016c0:	89 c2                	mov    %eax,%edx
+  8016c2:	c1 ea 0c             	shr    $0xc,%edx
+  8016c5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016cc:	f6 c2 01             	test   $0x1,%dl
+  8016cf:	74 1a                	je     8016eb <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8016d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016d4:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8016d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016db:	5d                   	pop    %ebp
+  8016dc:	c3                   	ret
+		return -E_INVAL;
+  8016dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e2:	eb f7                	jmp    8016db <fd_lookup+0x39>
+		return -E_INVAL;
+  8016e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e9:	eb f0                	jmp    8016db <fd_lookup+0x39>
+  8016eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016f0:	eb e9                	jmp    8016db <fd_lookup+0x39>
+
+008016f2 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8016f2:	55                   	push   %ebp
+  8016f3:	89 e5                	mov    %esp,%ebp
+  8016f5:	53                   	push   %ebx
+  8016f6:	83 ec 04             	sub    $0x4,%esp
+  8016f9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8016fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801701:	eb 03                	jmp    801706 <dev_lookup+0x14>
+  801703:	83 c0 01             	add    $0x1,%eax
+  801706:	8b 1c 85 c0 3e 80 00 	mov    0x803ec0(,%eax,4),%ebx
+  80170d:	85 db                	test   %ebx,%ebx
+  80170f:	74 0b                	je     80171c <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801711:	39 13                	cmp    %edx,(%ebx)
+  801713:	75 ee                	jne    801703 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801715:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171a:	eb 1f                	jmp    80173b <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80171c:	a1 00 60 80 00       	mov    0x806000,%eax
+  801721:	8b 40 48             	mov    0x48(%eax),%eax
+  801724:	83 ec 04             	sub    $0x4,%esp
+  801727:	52                   	push   %edx
+  801728:	50                   	push   %eax
+  801729:	68 44 3e 80 00       	push   $0x803e44
+  80172e:	e8 ff eb ff ff       	call   800332 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801733:	83 c4 10             	add    $0x10,%esp
+  801736:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80173b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80173e:	89 1a                	mov    %ebx,(%edx)
+}
+  801740:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801743:	c9                   	leave
+  801744:	c3                   	ret
+
+00801745 <fd_close>:
+{
+  801745:	55                   	push   %ebp
+  801746:	89 e5                	mov    %esp,%ebp
+  801748:	57                   	push   %edi
+  801749:	56                   	push   %esi
+  80174a:	53                   	push   %ebx
+  80174b:	83 ec 24             	sub    $0x24,%esp
+  80174e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801751:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801754:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801757:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801758:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80175e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801761:	50                   	push   %eax
+  801762:	e8 3b ff ff ff       	call   8016a2 <fd_lookup>
+  801767:	89 c3                	mov    %eax,%ebx
+  801769:	83 c4 10             	add    $0x10,%esp
+  80176c:	85 c0                	test   %eax,%eax
+  80176e:	78 05                	js     801775 <fd_close+0x30>
+	    || fd != fd2)
+  801770:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801773:	74 16                	je     80178b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801775:	89 f8                	mov    %edi,%eax
+  801777:	84 c0                	test   %al,%al
+  801779:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801781:	89 d8                	mov    %ebx,%eax
+  801783:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801786:	5b                   	pop    %ebx
+  801787:	5e                   	pop    %esi
+  801788:	5f                   	pop    %edi
+  801789:	5d                   	pop    %ebp
+  80178a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80178b:	83 ec 08             	sub    $0x8,%esp
+  80178e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801791:	50                   	push   %eax
+  801792:	ff 36                	push   (%esi)
+  801794:	e8 59 ff ff ff       	call   8016f2 <dev_lookup>
+  801799:	89 c3                	mov    %eax,%ebx
+  80179b:	83 c4 10             	add    $0x10,%esp
+  80179e:	85 c0                	test   %eax,%eax
+  8017a0:	78 1a                	js     8017bc <fd_close+0x77>
+		if (dev->dev_close)
+  8017a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017a5:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8017a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8017ad:	85 c0                	test   %eax,%eax
+  8017af:	74 0b                	je     8017bc <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8017b1:	83 ec 0c             	sub    $0xc,%esp
+  8017b4:	56                   	push   %esi
+  8017b5:	ff d0                	call   *%eax
+  8017b7:	89 c3                	mov    %eax,%ebx
+  8017b9:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8017bc:	83 ec 08             	sub    $0x8,%esp
+  8017bf:	56                   	push   %esi
+  8017c0:	6a 00                	push   $0x0
+  8017c2:	e8 f2 f5 ff ff       	call   800db9 <sys_page_unmap>
+	return r;
+  8017c7:	83 c4 10             	add    $0x10,%esp
+  8017ca:	eb b5                	jmp    801781 <fd_close+0x3c>
+
+008017cc <close>:
+
+int
+close(int fdnum)
+{
+  8017cc:	55                   	push   %ebp
+  8017cd:	89 e5                	mov    %esp,%ebp
+  8017cf:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017d5:	50                   	push   %eax
+  8017d6:	ff 75 08             	push   0x8(%ebp)
+  8017d9:	e8 c4 fe ff ff       	call   8016a2 <fd_lookup>
+  8017de:	83 c4 10             	add    $0x10,%esp
+  8017e1:	85 c0                	test   %eax,%eax
+  8017e3:	79 02                	jns    8017e7 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8017e5:	c9                   	leave
+  8017e6:	c3                   	ret
+		return fd_close(fd, 1);
+  8017e7:	83 ec 08             	sub    $0x8,%esp
+  8017ea:	6a 01                	push   $0x1
+  8017ec:	ff 75 f4             	push   -0xc(%ebp)
+  8017ef:	e8 51 ff ff ff       	call   801745 <fd_close>
+  8017f4:	83 c4 10             	add    $0x10,%esp
+  8017f7:	eb ec                	jmp    8017e5 <close+0x19>
+
+008017f9 <close_all>:
+
+void
+close_all(void)
+{
+  8017f9:	55                   	push   %ebp
+  8017fa:	89 e5                	mov    %esp,%ebp
+  8017fc:	53                   	push   %ebx
+  8017fd:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801800:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801805:	83 ec 0c             	sub    $0xc,%esp
+  801808:	53                   	push   %ebx
+  801809:	e8 be ff ff ff       	call   8017cc <close>
+	for (i = 0; i < MAXFD; i++)
+  80180e:	83 c3 01             	add    $0x1,%ebx
+  801811:	83 c4 10             	add    $0x10,%esp
+  801814:	83 fb 20             	cmp    $0x20,%ebx
+  801817:	75 ec                	jne    801805 <close_all+0xc>
+}
+  801819:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80181c:	c9                   	leave
+  80181d:	c3                   	ret
+
+0080181e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80181e:	55                   	push   %ebp
+  80181f:	89 e5                	mov    %esp,%ebp
+  801821:	57                   	push   %edi
+  801822:	56                   	push   %esi
+  801823:	53                   	push   %ebx
+  801824:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801827:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80182a:	50                   	push   %eax
+  80182b:	ff 75 08             	push   0x8(%ebp)
+  80182e:	e8 6f fe ff ff       	call   8016a2 <fd_lookup>
+  801833:	89 c3                	mov    %eax,%ebx
+  801835:	83 c4 10             	add    $0x10,%esp
+  801838:	85 c0                	test   %eax,%eax
+  80183a:	78 7f                	js     8018bb <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80183c:	83 ec 0c             	sub    $0xc,%esp
+  80183f:	ff 75 0c             	push   0xc(%ebp)
+  801842:	e8 85 ff ff ff       	call   8017cc <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801847:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80184a:	c1 e6 0c             	shl    $0xc,%esi
+  80184d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801853:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801856:	89 3c 24             	mov    %edi,(%esp)
+  801859:	e8 d7 fd ff ff       	call   801635 <fd2data>
+  80185e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801860:	89 34 24             	mov    %esi,(%esp)
+  801863:	e8 cd fd ff ff       	call   801635 <fd2data>
+  801868:	83 c4 10             	add    $0x10,%esp
+  80186b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80186e:	89 d8                	mov    %ebx,%eax
+  801870:	c1 e8 16             	shr    $0x16,%eax
+  801873:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80187a:	a8 01                	test   $0x1,%al
+  80187c:	74 11                	je     80188f <dup+0x71>
+  80187e:	89 d8                	mov    %ebx,%eax
+  801880:	c1 e8 0c             	shr    $0xc,%eax
+  801883:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80188a:	f6 c2 01             	test   $0x1,%dl
+  80188d:	75 36                	jne    8018c5 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80188f:	89 f8                	mov    %edi,%eax
+  801891:	c1 e8 0c             	shr    $0xc,%eax
+  801894:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80189b:	83 ec 0c             	sub    $0xc,%esp
+  80189e:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018a3:	50                   	push   %eax
+  8018a4:	56                   	push   %esi
+  8018a5:	6a 00                	push   $0x0
+  8018a7:	57                   	push   %edi
+  8018a8:	6a 00                	push   $0x0
+  8018aa:	e8 c8 f4 ff ff       	call   800d77 <sys_page_map>
+  8018af:	89 c3                	mov    %eax,%ebx
+  8018b1:	83 c4 20             	add    $0x20,%esp
+  8018b4:	85 c0                	test   %eax,%eax
+  8018b6:	78 33                	js     8018eb <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8018b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8018bb:	89 d8                	mov    %ebx,%eax
+  8018bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018c0:	5b                   	pop    %ebx
+  8018c1:	5e                   	pop    %esi
+  8018c2:	5f                   	pop    %edi
+  8018c3:	5d                   	pop    %ebp
+  8018c4:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8018c5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018cc:	83 ec 0c             	sub    $0xc,%esp
+  8018cf:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018d4:	50                   	push   %eax
+  8018d5:	ff 75 d4             	push   -0x2c(%ebp)
+  8018d8:	6a 00                	push   $0x0
+  8018da:	53                   	push   %ebx
+  8018db:	6a 00                	push   $0x0
+  8018dd:	e8 95 f4 ff ff       	call   800d77 <sys_page_map>
+  8018e2:	89 c3                	mov    %eax,%ebx
+  8018e4:	83 c4 20             	add    $0x20,%esp
+  8018e7:	85 c0                	test   %eax,%eax
+  8018e9:	79 a4                	jns    80188f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8018eb:	83 ec 08             	sub    $0x8,%esp
+  8018ee:	56                   	push   %esi
+  8018ef:	6a 00                	push   $0x0
+  8018f1:	e8 c3 f4 ff ff       	call   800db9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8018f6:	83 c4 08             	add    $0x8,%esp
+  8018f9:	ff 75 d4             	push   -0x2c(%ebp)
+  8018fc:	6a 00                	push   $0x0
+  8018fe:	e8 b6 f4 ff ff       	call   800db9 <sys_page_unmap>
+	return r;
+  801903:	83 c4 10             	add    $0x10,%esp
+  801906:	eb b3                	jmp    8018bb <dup+0x9d>
+
+00801908 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801908:	55                   	push   %ebp
+  801909:	89 e5                	mov    %esp,%ebp
+  80190b:	56                   	push   %esi
+  80190c:	53                   	push   %ebx
+  80190d:	83 ec 18             	sub    $0x18,%esp
+  801910:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801913:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801916:	50                   	push   %eax
+  801917:	56                   	push   %esi
+  801918:	e8 85 fd ff ff       	call   8016a2 <fd_lookup>
+  80191d:	83 c4 10             	add    $0x10,%esp
+  801920:	85 c0                	test   %eax,%eax
+  801922:	78 3c                	js     801960 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801924:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801927:	83 ec 08             	sub    $0x8,%esp
+  80192a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80192d:	50                   	push   %eax
+  80192e:	ff 33                	push   (%ebx)
+  801930:	e8 bd fd ff ff       	call   8016f2 <dev_lookup>
+  801935:	83 c4 10             	add    $0x10,%esp
+  801938:	85 c0                	test   %eax,%eax
+  80193a:	78 24                	js     801960 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80193c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80193f:	83 e0 03             	and    $0x3,%eax
+  801942:	83 f8 01             	cmp    $0x1,%eax
+  801945:	74 20                	je     801967 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801947:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80194a:	8b 40 08             	mov    0x8(%eax),%eax
+  80194d:	85 c0                	test   %eax,%eax
+  80194f:	74 37                	je     801988 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801951:	83 ec 04             	sub    $0x4,%esp
+  801954:	ff 75 10             	push   0x10(%ebp)
+  801957:	ff 75 0c             	push   0xc(%ebp)
+  80195a:	53                   	push   %ebx
+  80195b:	ff d0                	call   *%eax
+  80195d:	83 c4 10             	add    $0x10,%esp
+}
+  801960:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801963:	5b                   	pop    %ebx
+  801964:	5e                   	pop    %esi
+  801965:	5d                   	pop    %ebp
+  801966:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801967:	a1 00 60 80 00       	mov    0x806000,%eax
+  80196c:	8b 40 48             	mov    0x48(%eax),%eax
+  80196f:	83 ec 04             	sub    $0x4,%esp
+  801972:	56                   	push   %esi
+  801973:	50                   	push   %eax
+  801974:	68 85 3e 80 00       	push   $0x803e85
+  801979:	e8 b4 e9 ff ff       	call   800332 <cprintf>
+		return -E_INVAL;
+  80197e:	83 c4 10             	add    $0x10,%esp
+  801981:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801986:	eb d8                	jmp    801960 <read+0x58>
+		return -E_NOT_SUPP;
+  801988:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80198d:	eb d1                	jmp    801960 <read+0x58>
+
+0080198f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80198f:	55                   	push   %ebp
+  801990:	89 e5                	mov    %esp,%ebp
+  801992:	57                   	push   %edi
+  801993:	56                   	push   %esi
+  801994:	53                   	push   %ebx
+  801995:	83 ec 0c             	sub    $0xc,%esp
+  801998:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80199b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80199e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019a3:	eb 02                	jmp    8019a7 <readn+0x18>
+  8019a5:	01 c3                	add    %eax,%ebx
+  8019a7:	39 f3                	cmp    %esi,%ebx
+  8019a9:	73 21                	jae    8019cc <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8019ab:	83 ec 04             	sub    $0x4,%esp
+  8019ae:	89 f0                	mov    %esi,%eax
+  8019b0:	29 d8                	sub    %ebx,%eax
+  8019b2:	50                   	push   %eax
+  8019b3:	89 d8                	mov    %ebx,%eax
+  8019b5:	03 45 0c             	add    0xc(%ebp),%eax
+  8019b8:	50                   	push   %eax
+  8019b9:	57                   	push   %edi
+  8019ba:	e8 49 ff ff ff       	call   801908 <read>
+		if (m < 0)
+  8019bf:	83 c4 10             	add    $0x10,%esp
+  8019c2:	85 c0                	test   %eax,%eax
+  8019c4:	78 04                	js     8019ca <readn+0x3b>
+			return m;
+		if (m == 0)
+  8019c6:	75 dd                	jne    8019a5 <readn+0x16>
+  8019c8:	eb 02                	jmp    8019cc <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8019ca:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8019cc:	89 d8                	mov    %ebx,%eax
+  8019ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d1:	5b                   	pop    %ebx
+  8019d2:	5e                   	pop    %esi
+  8019d3:	5f                   	pop    %edi
+  8019d4:	5d                   	pop    %ebp
+  8019d5:	c3                   	ret
+
+008019d6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8019d6:	55                   	push   %ebp
+  8019d7:	89 e5                	mov    %esp,%ebp
+  8019d9:	56                   	push   %esi
+  8019da:	53                   	push   %ebx
+  8019db:	83 ec 18             	sub    $0x18,%esp
+  8019de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019e1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019e4:	50                   	push   %eax
+  8019e5:	53                   	push   %ebx
+  8019e6:	e8 b7 fc ff ff       	call   8016a2 <fd_lookup>
+  8019eb:	83 c4 10             	add    $0x10,%esp
+  8019ee:	85 c0                	test   %eax,%eax
+  8019f0:	78 37                	js     801a29 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019f2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019f5:	83 ec 08             	sub    $0x8,%esp
+  8019f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019fb:	50                   	push   %eax
+  8019fc:	ff 36                	push   (%esi)
+  8019fe:	e8 ef fc ff ff       	call   8016f2 <dev_lookup>
+  801a03:	83 c4 10             	add    $0x10,%esp
+  801a06:	85 c0                	test   %eax,%eax
+  801a08:	78 1f                	js     801a29 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a0a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a0e:	74 20                	je     801a30 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801a10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a13:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a16:	85 c0                	test   %eax,%eax
+  801a18:	74 37                	je     801a51 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801a1a:	83 ec 04             	sub    $0x4,%esp
+  801a1d:	ff 75 10             	push   0x10(%ebp)
+  801a20:	ff 75 0c             	push   0xc(%ebp)
+  801a23:	56                   	push   %esi
+  801a24:	ff d0                	call   *%eax
+  801a26:	83 c4 10             	add    $0x10,%esp
+}
+  801a29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a2c:	5b                   	pop    %ebx
+  801a2d:	5e                   	pop    %esi
+  801a2e:	5d                   	pop    %ebp
+  801a2f:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a30:	a1 00 60 80 00       	mov    0x806000,%eax
+  801a35:	8b 40 48             	mov    0x48(%eax),%eax
+  801a38:	83 ec 04             	sub    $0x4,%esp
+  801a3b:	53                   	push   %ebx
+  801a3c:	50                   	push   %eax
+  801a3d:	68 a1 3e 80 00       	push   $0x803ea1
+  801a42:	e8 eb e8 ff ff       	call   800332 <cprintf>
+		return -E_INVAL;
+  801a47:	83 c4 10             	add    $0x10,%esp
+  801a4a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a4f:	eb d8                	jmp    801a29 <write+0x53>
+		return -E_NOT_SUPP;
+  801a51:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a56:	eb d1                	jmp    801a29 <write+0x53>
+
+00801a58 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801a58:	55                   	push   %ebp
+  801a59:	89 e5                	mov    %esp,%ebp
+  801a5b:	53                   	push   %ebx
+  801a5c:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a5f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a62:	50                   	push   %eax
+  801a63:	ff 75 08             	push   0x8(%ebp)
+  801a66:	e8 37 fc ff ff       	call   8016a2 <fd_lookup>
+  801a6b:	83 c4 10             	add    $0x10,%esp
+  801a6e:	85 c0                	test   %eax,%eax
+  801a70:	78 3a                	js     801aac <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a72:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801a75:	83 ec 08             	sub    $0x8,%esp
+  801a78:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a7b:	50                   	push   %eax
+  801a7c:	ff 33                	push   (%ebx)
+  801a7e:	e8 6f fc ff ff       	call   8016f2 <dev_lookup>
+  801a83:	83 c4 10             	add    $0x10,%esp
+  801a86:	85 c0                	test   %eax,%eax
+  801a88:	78 22                	js     801aac <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801a8a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a8d:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801a90:	85 c0                	test   %eax,%eax
+  801a92:	74 0d                	je     801aa1 <seek+0x49>
+  801a94:	83 ec 0c             	sub    $0xc,%esp
+  801a97:	53                   	push   %ebx
+  801a98:	ff d0                	call   *%eax
+  801a9a:	83 c4 10             	add    $0x10,%esp
+  801a9d:	85 c0                	test   %eax,%eax
+  801a9f:	78 0b                	js     801aac <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801aa1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aa4:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801aa7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aaf:	c9                   	leave
+  801ab0:	c3                   	ret
+
+00801ab1 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801ab1:	55                   	push   %ebp
+  801ab2:	89 e5                	mov    %esp,%ebp
+  801ab4:	53                   	push   %ebx
+  801ab5:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ab8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801abb:	50                   	push   %eax
+  801abc:	ff 75 08             	push   0x8(%ebp)
+  801abf:	e8 de fb ff ff       	call   8016a2 <fd_lookup>
+  801ac4:	83 c4 10             	add    $0x10,%esp
+  801ac7:	85 c0                	test   %eax,%eax
+  801ac9:	78 2b                	js     801af6 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801acb:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801ace:	83 ec 08             	sub    $0x8,%esp
+  801ad1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad4:	50                   	push   %eax
+  801ad5:	ff 33                	push   (%ebx)
+  801ad7:	e8 16 fc ff ff       	call   8016f2 <dev_lookup>
+  801adc:	83 c4 10             	add    $0x10,%esp
+  801adf:	85 c0                	test   %eax,%eax
+  801ae1:	78 13                	js     801af6 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801ae3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ae6:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801ae9:	85 c0                	test   %eax,%eax
+  801aeb:	74 0e                	je     801afb <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801aed:	83 ec 0c             	sub    $0xc,%esp
+  801af0:	53                   	push   %ebx
+  801af1:	ff d0                	call   *%eax
+  801af3:	83 c4 10             	add    $0x10,%esp
+}
+  801af6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801af9:	c9                   	leave
+  801afa:	c3                   	ret
+		return 0;
+  801afb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b00:	eb f4                	jmp    801af6 <fsync+0x45>
+
+00801b02 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801b02:	55                   	push   %ebp
+  801b03:	89 e5                	mov    %esp,%ebp
+  801b05:	56                   	push   %esi
+  801b06:	53                   	push   %ebx
+  801b07:	83 ec 18             	sub    $0x18,%esp
+  801b0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b0d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b10:	50                   	push   %eax
+  801b11:	53                   	push   %ebx
+  801b12:	e8 8b fb ff ff       	call   8016a2 <fd_lookup>
+  801b17:	83 c4 10             	add    $0x10,%esp
+  801b1a:	85 c0                	test   %eax,%eax
+  801b1c:	78 34                	js     801b52 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b1e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b21:	83 ec 08             	sub    $0x8,%esp
+  801b24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b27:	50                   	push   %eax
+  801b28:	ff 36                	push   (%esi)
+  801b2a:	e8 c3 fb ff ff       	call   8016f2 <dev_lookup>
+  801b2f:	83 c4 10             	add    $0x10,%esp
+  801b32:	85 c0                	test   %eax,%eax
+  801b34:	78 1c                	js     801b52 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b36:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b3a:	74 1d                	je     801b59 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801b3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b3f:	8b 40 18             	mov    0x18(%eax),%eax
+  801b42:	85 c0                	test   %eax,%eax
+  801b44:	74 34                	je     801b7a <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801b46:	83 ec 08             	sub    $0x8,%esp
+  801b49:	ff 75 0c             	push   0xc(%ebp)
+  801b4c:	56                   	push   %esi
+  801b4d:	ff d0                	call   *%eax
+  801b4f:	83 c4 10             	add    $0x10,%esp
+}
+  801b52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b55:	5b                   	pop    %ebx
+  801b56:	5e                   	pop    %esi
+  801b57:	5d                   	pop    %ebp
+  801b58:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801b59:	a1 00 60 80 00       	mov    0x806000,%eax
+  801b5e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b61:	83 ec 04             	sub    $0x4,%esp
+  801b64:	53                   	push   %ebx
+  801b65:	50                   	push   %eax
+  801b66:	68 64 3e 80 00       	push   $0x803e64
+  801b6b:	e8 c2 e7 ff ff       	call   800332 <cprintf>
+		return -E_INVAL;
+  801b70:	83 c4 10             	add    $0x10,%esp
+  801b73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b78:	eb d8                	jmp    801b52 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801b7a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b7f:	eb d1                	jmp    801b52 <ftruncate+0x50>
+
+00801b81 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801b81:	55                   	push   %ebp
+  801b82:	89 e5                	mov    %esp,%ebp
+  801b84:	56                   	push   %esi
+  801b85:	53                   	push   %ebx
+  801b86:	83 ec 18             	sub    $0x18,%esp
+  801b89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b8c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b8f:	50                   	push   %eax
+  801b90:	ff 75 08             	push   0x8(%ebp)
+  801b93:	e8 0a fb ff ff       	call   8016a2 <fd_lookup>
+  801b98:	83 c4 10             	add    $0x10,%esp
+  801b9b:	85 c0                	test   %eax,%eax
+  801b9d:	78 49                	js     801be8 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b9f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ba2:	83 ec 08             	sub    $0x8,%esp
+  801ba5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ba8:	50                   	push   %eax
+  801ba9:	ff 36                	push   (%esi)
+  801bab:	e8 42 fb ff ff       	call   8016f2 <dev_lookup>
+  801bb0:	83 c4 10             	add    $0x10,%esp
+  801bb3:	85 c0                	test   %eax,%eax
+  801bb5:	78 31                	js     801be8 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801bb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bba:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801bbe:	74 2f                	je     801bef <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801bc0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801bc3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801bca:	00 00 00 
+	stat->st_isdir = 0;
+  801bcd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801bd4:	00 00 00 
+	stat->st_dev = dev;
+  801bd7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801bdd:	83 ec 08             	sub    $0x8,%esp
+  801be0:	53                   	push   %ebx
+  801be1:	56                   	push   %esi
+  801be2:	ff 50 14             	call   *0x14(%eax)
+  801be5:	83 c4 10             	add    $0x10,%esp
+}
+  801be8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801beb:	5b                   	pop    %ebx
+  801bec:	5e                   	pop    %esi
+  801bed:	5d                   	pop    %ebp
+  801bee:	c3                   	ret
+		return -E_NOT_SUPP;
+  801bef:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bf4:	eb f2                	jmp    801be8 <fstat+0x67>
+
+00801bf6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801bf6:	55                   	push   %ebp
+  801bf7:	89 e5                	mov    %esp,%ebp
+  801bf9:	56                   	push   %esi
+  801bfa:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801bfb:	83 ec 08             	sub    $0x8,%esp
+  801bfe:	68 00 10 00 00       	push   $0x1000
+  801c03:	ff 75 08             	push   0x8(%ebp)
+  801c06:	e8 b3 07 00 00       	call   8023be <open>
+  801c0b:	89 c3                	mov    %eax,%ebx
+  801c0d:	83 c4 10             	add    $0x10,%esp
+  801c10:	85 c0                	test   %eax,%eax
+  801c12:	78 1b                	js     801c2f <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801c14:	83 ec 08             	sub    $0x8,%esp
+  801c17:	ff 75 0c             	push   0xc(%ebp)
+  801c1a:	50                   	push   %eax
+  801c1b:	e8 61 ff ff ff       	call   801b81 <fstat>
+  801c20:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801c22:	89 1c 24             	mov    %ebx,(%esp)
+  801c25:	e8 a2 fb ff ff       	call   8017cc <close>
+	return r;
+  801c2a:	83 c4 10             	add    $0x10,%esp
+  801c2d:	89 f3                	mov    %esi,%ebx
+}
+  801c2f:	89 d8                	mov    %ebx,%eax
+  801c31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c34:	5b                   	pop    %ebx
+  801c35:	5e                   	pop    %esi
+  801c36:	5d                   	pop    %ebp
+  801c37:	c3                   	ret
+
+00801c38 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801c38:	55                   	push   %ebp
+  801c39:	89 e5                	mov    %esp,%ebp
+  801c3b:	57                   	push   %edi
+  801c3c:	56                   	push   %esi
+  801c3d:	53                   	push   %ebx
+  801c3e:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801c44:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801c4a:	89 d6                	mov    %edx,%esi
+  801c4c:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801c52:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801c55:	89 d3                	mov    %edx,%ebx
+  801c57:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801c5d:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801c64:	74 1d                	je     801c83 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801c66:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801c6b:	83 c8 07             	or     $0x7,%eax
+  801c6e:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801c74:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801c79:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801c7f:	01 ce                	add    %ecx,%esi
+  801c81:	eb 28                	jmp    801cab <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c83:	83 ec 0c             	sub    $0xc,%esp
+  801c86:	6a 01                	push   $0x1
+  801c88:	e8 59 f9 ff ff       	call   8015e6 <ipc_find_env>
+  801c8d:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801c92:	83 c4 10             	add    $0x10,%esp
+  801c95:	eb cf                	jmp    801c66 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801c97:	83 c0 01             	add    $0x1,%eax
+  801c9a:	89 fa                	mov    %edi,%edx
+  801c9c:	09 da                	or     %ebx,%edx
+  801c9e:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801ca5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801cab:	39 f3                	cmp    %esi,%ebx
+  801cad:	72 e8                	jb     801c97 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801caf:	83 f8 41             	cmp    $0x41,%eax
+  801cb2:	77 2f                	ja     801ce3 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801cb4:	50                   	push   %eax
+  801cb5:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801cbb:	50                   	push   %eax
+  801cbc:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801cc2:	ff 35 c8 80 80 00    	push   0x8080c8
+  801cc8:	e8 cb f8 ff ff       	call   801598 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801ccd:	83 c4 0c             	add    $0xc,%esp
+  801cd0:	6a 00                	push   $0x0
+  801cd2:	6a 00                	push   $0x0
+  801cd4:	6a 00                	push   $0x0
+  801cd6:	e8 67 f7 ff ff       	call   801442 <ipc_recv>
+}
+  801cdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cde:	5b                   	pop    %ebx
+  801cdf:	5e                   	pop    %esi
+  801ce0:	5f                   	pop    %edi
+  801ce1:	5d                   	pop    %ebp
+  801ce2:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801ce3:	68 d4 3e 80 00       	push   $0x803ed4
+  801ce8:	68 ec 3d 80 00       	push   $0x803dec
+  801ced:	6a 40                	push   $0x40
+  801cef:	68 f0 3e 80 00       	push   $0x803ef0
+  801cf4:	e8 5e e5 ff ff       	call   800257 <_panic>
+
+00801cf9 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801cf9:	55                   	push   %ebp
+  801cfa:	89 e5                	mov    %esp,%ebp
+  801cfc:	57                   	push   %edi
+  801cfd:	56                   	push   %esi
+  801cfe:	53                   	push   %ebx
+  801cff:	83 ec 1c             	sub    $0x1c,%esp
+  801d02:	89 c3                	mov    %eax,%ebx
+  801d04:	89 d6                	mov    %edx,%esi
+  801d06:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801d09:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801d0f:	89 ca                	mov    %ecx,%edx
+  801d11:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801d14:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801d1b:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801d1e:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801d25:	8b 76 0c             	mov    0xc(%esi),%esi
+  801d28:	89 fb                	mov    %edi,%ebx
+  801d2a:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801d31:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801d34:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801d3b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d3e:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801d45:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d48:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801d4f:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801d52:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801d59:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801d5e:	39 c8                	cmp    %ecx,%eax
+  801d60:	74 0d                	je     801d6f <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801d62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d6a:	5b                   	pop    %ebx
+  801d6b:	5e                   	pop    %esi
+  801d6c:	5f                   	pop    %edi
+  801d6d:	5d                   	pop    %ebp
+  801d6e:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801d6f:	6a 07                	push   $0x7
+  801d71:	68 00 70 80 00       	push   $0x807000
+  801d76:	6a 0d                	push   $0xd
+  801d78:	ff 35 c8 80 80 00    	push   0x8080c8
+  801d7e:	e8 2a f7 ff ff       	call   8014ad <ipc_send>
+  801d83:	83 c4 10             	add    $0x10,%esp
+  801d86:	eb da                	jmp    801d62 <fsring_post+0x69>
+
+00801d88 <fsipcv>:
+{
+  801d88:	55                   	push   %ebp
+  801d89:	89 e5                	mov    %esp,%ebp
+  801d8b:	57                   	push   %edi
+  801d8c:	56                   	push   %esi
+  801d8d:	53                   	push   %ebx
+  801d8e:	83 ec 0c             	sub    $0xc,%esp
+  801d91:	89 c7                	mov    %eax,%edi
+  801d93:	89 d3                	mov    %edx,%ebx
+  801d95:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801d97:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801d9e:	74 26                	je     801dc6 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801da0:	6a 07                	push   $0x7
+  801da2:	68 00 70 80 00       	push   $0x807000
+  801da7:	57                   	push   %edi
+  801da8:	ff 35 c8 80 80 00    	push   0x8080c8
+  801dae:	e8 fa f6 ff ff       	call   8014ad <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801db3:	6a 00                	push   $0x0
+  801db5:	56                   	push   %esi
+  801db6:	53                   	push   %ebx
+  801db7:	6a 00                	push   $0x0
+  801db9:	e8 47 f7 ff ff       	call   801505 <ipc_recvv>
+}
+  801dbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc1:	5b                   	pop    %ebx
+  801dc2:	5e                   	pop    %esi
+  801dc3:	5f                   	pop    %edi
+  801dc4:	5d                   	pop    %ebp
+  801dc5:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801dc6:	83 ec 0c             	sub    $0xc,%esp
+  801dc9:	6a 01                	push   $0x1
+  801dcb:	e8 16 f8 ff ff       	call   8015e6 <ipc_find_env>
+  801dd0:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801dd5:	83 c4 10             	add    $0x10,%esp
+  801dd8:	eb c6                	jmp    801da0 <fsipcv+0x18>
+
+00801dda <fsipc>:
+{
+  801dda:	55                   	push   %ebp
+  801ddb:	89 e5                	mov    %esp,%ebp
+  801ddd:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801de0:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801de7:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801dea:	e8 99 ff ff ff       	call   801d88 <fsipcv>
+}
+  801def:	c9                   	leave
+  801df0:	c3                   	ret
+
+00801df1 <file_write_direct>:
+{
+  801df1:	55                   	push   %ebp
+  801df2:	89 e5                	mov    %esp,%ebp
+  801df4:	56                   	push   %esi
+  801df5:	53                   	push   %ebx
+  801df6:	89 c3                	mov    %eax,%ebx
+  801df8:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801dfa:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801e00:	77 40                	ja     801e42 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801e02:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801e07:	39 c8                	cmp    %ecx,%eax
+  801e09:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e0c:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801e0f:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  801e15:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801e1a:	83 ec 04             	sub    $0x4,%esp
+  801e1d:	50                   	push   %eax
+  801e1e:	52                   	push   %edx
+  801e1f:	68 08 70 80 00       	push   $0x807008
+  801e24:	e8 7d ec ff ff       	call   800aa6 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801e29:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e2e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e33:	e8 a2 ff ff ff       	call   801dda <fsipc>
+  801e38:	83 c4 10             	add    $0x10,%esp
+}
+  801e3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e3e:	5b                   	pop    %ebx
+  801e3f:	5e                   	pop    %esi
+  801e40:	5d                   	pop    %ebp
+  801e41:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801e42:	89 d6                	mov    %edx,%esi
+  801e44:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801e4a:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801e4f:	29 f1                	sub    %esi,%ecx
+  801e51:	39 c1                	cmp    %eax,%ecx
+  801e53:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801e56:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801e59:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801e5e:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801e64:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801e6a:	83 ec 0c             	sub    $0xc,%esp
+  801e6d:	6a 05                	push   $0x5
+  801e6f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e74:	e8 bf fd ff ff       	call   801c38 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801e79:	83 c4 10             	add    $0x10,%esp
+  801e7c:	eb bd                	jmp    801e3b <file_write_direct+0x4a>
+
+00801e7e <devfile_sync>:
+{
+  801e7e:	55                   	push   %ebp
+  801e7f:	89 e5                	mov    %esp,%ebp
+  801e81:	57                   	push   %edi
+  801e82:	56                   	push   %esi
+  801e83:	53                   	push   %ebx
+  801e84:	83 ec 28             	sub    $0x28,%esp
+  801e87:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801e8a:	56                   	push   %esi
+  801e8b:	e8 a5 f7 ff ff       	call   801635 <fd2data>
+  801e90:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801e92:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801e95:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801e9c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801ea4:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801ea8:	74 45                	je     801eef <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801eaa:	8b 46 14             	mov    0x14(%esi),%eax
+  801ead:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801eb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eba:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801ebd:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801ec0:	39 cb                	cmp    %ecx,%ebx
+  801ec2:	73 14                	jae    801ed8 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801ec4:	29 d9                	sub    %ebx,%ecx
+  801ec6:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801ec9:	89 f0                	mov    %esi,%eax
+  801ecb:	e8 21 ff ff ff       	call   801df1 <file_write_direct>
+  801ed0:	85 c0                	test   %eax,%eax
+  801ed2:	7e 04                	jle    801ed8 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801ed4:	01 c3                	add    %eax,%ebx
+  801ed6:	eb e5                	jmp    801ebd <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801ed8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801edb:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801ee2:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801ee5:	85 c0                	test   %eax,%eax
+  801ee7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eec:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801eef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ef2:	5b                   	pop    %ebx
+  801ef3:	5e                   	pop    %esi
+  801ef4:	5f                   	pop    %edi
+  801ef5:	5d                   	pop    %ebp
+  801ef6:	c3                   	ret
+
+00801ef7 <devfile_write>:
+{
+  801ef7:	55                   	push   %ebp
+  801ef8:	89 e5                	mov    %esp,%ebp
+  801efa:	57                   	push   %edi
+  801efb:	56                   	push   %esi
+  801efc:	53                   	push   %ebx
+  801efd:	83 ec 28             	sub    $0x28,%esp
+  801f00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801f03:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801f06:	53                   	push   %ebx
+  801f07:	e8 29 f7 ff ff       	call   801635 <fd2data>
+  801f0c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801f0f:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801f12:	83 c4 10             	add    $0x10,%esp
+  801f15:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801f19:	74 43                	je     801f5e <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801f1b:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801f22:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801f25:	85 c0                	test   %eax,%eax
+  801f27:	74 43                	je     801f6c <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801f29:	89 c2                	mov    %eax,%edx
+  801f2b:	03 53 14             	add    0x14(%ebx),%edx
+  801f2e:	39 fa                	cmp    %edi,%edx
+  801f30:	75 0b                	jne    801f3d <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801f32:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801f35:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801f3b:	76 66                	jbe    801fa3 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801f3d:	83 ec 0c             	sub    $0xc,%esp
+  801f40:	53                   	push   %ebx
+  801f41:	e8 38 ff ff ff       	call   801e7e <devfile_sync>
+  801f46:	83 c4 10             	add    $0x10,%esp
+  801f49:	85 c0                	test   %eax,%eax
+  801f4b:	78 4e                	js     801f9b <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801f4d:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801f53:	77 56                	ja     801fab <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801f55:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	75 20                	jne    801f7c <devfile_write+0x85>
+  801f5c:	eb 16                	jmp    801f74 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801f5e:	89 f1                	mov    %esi,%ecx
+  801f60:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f63:	89 d8                	mov    %ebx,%eax
+  801f65:	e8 87 fe ff ff       	call   801df1 <file_write_direct>
+  801f6a:	eb 2f                	jmp    801f9b <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801f6c:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801f72:	77 37                	ja     801fab <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801f74:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801f77:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801f7c:	83 ec 04             	sub    $0x4,%esp
+  801f7f:	56                   	push   %esi
+  801f80:	ff 75 0c             	push   0xc(%ebp)
+  801f83:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801f86:	01 c1                	add    %eax,%ecx
+  801f88:	51                   	push   %ecx
+  801f89:	e8 18 eb ff ff       	call   800aa6 <memmove>
+	ff->buf_wlen += n;
+  801f8e:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801f91:	01 f7                	add    %esi,%edi
+  801f93:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801f96:	89 f0                	mov    %esi,%eax
+  801f98:	83 c4 10             	add    $0x10,%esp
+}
+  801f9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f9e:	5b                   	pop    %ebx
+  801f9f:	5e                   	pop    %esi
+  801fa0:	5f                   	pop    %edi
+  801fa1:	5d                   	pop    %ebp
+  801fa2:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801fa3:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801fa9:	76 d1                	jbe    801f7c <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801fab:	89 f1                	mov    %esi,%ecx
+  801fad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fb0:	89 d8                	mov    %ebx,%eax
+  801fb2:	e8 3a fe ff ff       	call   801df1 <file_write_direct>
+  801fb7:	eb e2                	jmp    801f9b <devfile_write+0xa4>
+
+00801fb9 <devfile_trunc>:
+{
+  801fb9:	55                   	push   %ebp
+  801fba:	89 e5                	mov    %esp,%ebp
+  801fbc:	53                   	push   %ebx
+  801fbd:	83 ec 10             	sub    $0x10,%esp
+  801fc0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801fc3:	53                   	push   %ebx
+  801fc4:	e8 b5 fe ff ff       	call   801e7e <devfile_sync>
+  801fc9:	83 c4 10             	add    $0x10,%esp
+  801fcc:	85 c0                	test   %eax,%eax
+  801fce:	78 1f                	js     801fef <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801fd0:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801fd3:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801fd8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fdb:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801fe0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe5:	b8 02 00 00 00       	mov    $0x2,%eax
+  801fea:	e8 eb fd ff ff       	call   801dda <fsipc>
+}
+  801fef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ff2:	c9                   	leave
+  801ff3:	c3                   	ret
+
+00801ff4 <devfile_stat>:
+{
+  801ff4:	55                   	push   %ebp
+  801ff5:	89 e5                	mov    %esp,%ebp
+  801ff7:	56                   	push   %esi
+  801ff8:	53                   	push   %ebx
+  801ff9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801ffc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801fff:	83 ec 0c             	sub    $0xc,%esp
+  802002:	53                   	push   %ebx
+  802003:	e8 76 fe ff ff       	call   801e7e <devfile_sync>
+  802008:	83 c4 10             	add    $0x10,%esp
+  80200b:	85 c0                	test   %eax,%eax
+  80200d:	78 47                	js     802056 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80200f:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802012:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802017:	ba 00 00 00 00       	mov    $0x0,%edx
+  80201c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802021:	e8 b4 fd ff ff       	call   801dda <fsipc>
+  802026:	85 c0                	test   %eax,%eax
+  802028:	78 2c                	js     802056 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80202a:	83 ec 08             	sub    $0x8,%esp
+  80202d:	68 00 70 80 00       	push   $0x807000
+  802032:	56                   	push   %esi
+  802033:	e8 e8 e8 ff ff       	call   800920 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802038:	a1 80 70 80 00       	mov    0x807080,%eax
+  80203d:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802043:	a1 84 70 80 00       	mov    0x807084,%eax
+  802048:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  80204e:	83 c4 10             	add    $0x10,%esp
+  802051:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802056:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802059:	5b                   	pop    %ebx
+  80205a:	5e                   	pop    %esi
+  80205b:	5d                   	pop    %ebp
+  80205c:	c3                   	ret
+
+0080205d <devfile_flush>:
+{
+  80205d:	55                   	push   %ebp
+  80205e:	89 e5                	mov    %esp,%ebp
+  802060:	56                   	push   %esi
+  802061:	53                   	push   %ebx
+  802062:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  802065:	83 ec 0c             	sub    $0xc,%esp
+  802068:	56                   	push   %esi
+  802069:	e8 10 fe ff ff       	call   801e7e <devfile_sync>
+  80206e:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  802070:	83 c4 10             	add    $0x10,%esp
+  802073:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  802077:	75 25                	jne    80209e <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802079:	8b 46 0c             	mov    0xc(%esi),%eax
+  80207c:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  802081:	ba 00 00 00 00       	mov    $0x0,%edx
+  802086:	b8 06 00 00 00       	mov    $0x6,%eax
+  80208b:	e8 4a fd ff ff       	call   801dda <fsipc>
+  802090:	85 c0                	test   %eax,%eax
+  802092:	0f 45 d8             	cmovne %eax,%ebx
+}
+  802095:	89 d8                	mov    %ebx,%eax
+  802097:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80209a:	5b                   	pop    %ebx
+  80209b:	5e                   	pop    %esi
+  80209c:	5d                   	pop    %ebp
+  80209d:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  80209e:	83 ec 0c             	sub    $0xc,%esp
+  8020a1:	56                   	push   %esi
+  8020a2:	e8 8e f5 ff ff       	call   801635 <fd2data>
+  8020a7:	83 c4 08             	add    $0x8,%esp
+  8020aa:	50                   	push   %eax
+  8020ab:	6a 00                	push   $0x0
+  8020ad:	e8 07 ed ff ff       	call   800db9 <sys_page_unmap>
+  8020b2:	83 c4 10             	add    $0x10,%esp
+  8020b5:	eb c2                	jmp    802079 <devfile_flush+0x1c>
+
+008020b7 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  8020b7:	55                   	push   %ebp
+  8020b8:	89 e5                	mov    %esp,%ebp
+  8020ba:	57                   	push   %edi
+  8020bb:	56                   	push   %esi
+  8020bc:	53                   	push   %ebx
+  8020bd:	83 ec 64             	sub    $0x64,%esp
+  8020c0:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  8020c2:	52                   	push   %edx
+  8020c3:	50                   	push   %eax
+  8020c4:	e8 d9 f5 ff ff       	call   8016a2 <fd_lookup>
+  8020c9:	89 c1                	mov    %eax,%ecx
+  8020cb:	83 c4 10             	add    $0x10,%esp
+  8020ce:	85 c0                	test   %eax,%eax
+  8020d0:	0f 88 f2 00 00 00    	js     8021c8 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  8020d6:	8b 07                	mov    (%edi),%eax
+  8020d8:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8020de:	39 10                	cmp    %edx,(%eax)
+  8020e0:	0f 85 03 01 00 00    	jne    8021e9 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  8020e6:	a1 00 60 80 00       	mov    0x806000,%eax
+  8020eb:	8b 40 48             	mov    0x48(%eax),%eax
+  8020ee:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  8020f4:	0f 84 96 00 00 00    	je     802190 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  8020fa:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  802101:	0f 84 cb 00 00 00    	je     8021d2 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  802107:	b8 00 70 80 00       	mov    $0x807000,%eax
+  80210c:	83 c8 07             	or     $0x7,%eax
+  80210f:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  802112:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  802115:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  80211a:	83 ec 04             	sub    $0x4,%esp
+  80211d:	68 07 04 00 00       	push   $0x407
+  802122:	53                   	push   %ebx
+  802123:	6a 00                	push   $0x0
+  802125:	e8 02 ec ff ff       	call   800d2c <sys_page_alloc>
+  80212a:	89 c1                	mov    %eax,%ecx
+  80212c:	83 c4 10             	add    $0x10,%esp
+  80212f:	85 c0                	test   %eax,%eax
+  802131:	0f 88 91 00 00 00    	js     8021c8 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  802137:	89 d8                	mov    %ebx,%eax
+  802139:	83 c8 07             	or     $0x7,%eax
+  80213c:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  80213e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802144:	83 c6 04             	add    $0x4,%esi
+  802147:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  80214d:	75 cb                	jne    80211a <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  80214f:	6a 12                	push   $0x12
+  802151:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802154:	50                   	push   %eax
+  802155:	6a 0c                	push   $0xc
+  802157:	ff 35 c8 80 80 00    	push   0x8080c8
+  80215d:	e8 36 f4 ff ff       	call   801598 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802162:	83 c4 0c             	add    $0xc,%esp
+  802165:	6a 00                	push   $0x0
+  802167:	6a 00                	push   $0x0
+  802169:	6a 00                	push   $0x0
+  80216b:	e8 d2 f2 ff ff       	call   801442 <ipc_recv>
+  802170:	89 c1                	mov    %eax,%ecx
+  802172:	83 c4 10             	add    $0x10,%esp
+  802175:	85 c0                	test   %eax,%eax
+  802177:	78 4f                	js     8021c8 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  802179:	a1 00 60 80 00       	mov    0x806000,%eax
+  80217e:	8b 40 48             	mov    0x48(%eax),%eax
+  802181:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  802186:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  80218d:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  802190:	83 ec 0c             	sub    $0xc,%esp
+  802193:	ff 37                	push   (%edi)
+  802195:	e8 e4 fc ff ff       	call   801e7e <devfile_sync>
+  80219a:	89 c1                	mov    %eax,%ecx
+  80219c:	83 c4 10             	add    $0x10,%esp
+  80219f:	85 c0                	test   %eax,%eax
+  8021a1:	78 25                	js     8021c8 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  8021a3:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  8021a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  8021ae:	ba 01 00 00 00       	mov    $0x1,%edx
+  8021b3:	89 d0                	mov    %edx,%eax
+  8021b5:	d3 e0                	shl    %cl,%eax
+  8021b7:	85 d8                	test   %ebx,%eax
+  8021b9:	74 0d                	je     8021c8 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  8021bb:	83 c1 01             	add    $0x1,%ecx
+  8021be:	83 f9 10             	cmp    $0x10,%ecx
+  8021c1:	75 f0                	jne    8021b3 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  8021c3:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  8021c8:	89 c8                	mov    %ecx,%eax
+  8021ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021cd:	5b                   	pop    %ebx
+  8021ce:	5e                   	pop    %esi
+  8021cf:	5f                   	pop    %edi
+  8021d0:	5d                   	pop    %ebp
+  8021d1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021d2:	83 ec 0c             	sub    $0xc,%esp
+  8021d5:	6a 01                	push   $0x1
+  8021d7:	e8 0a f4 ff ff       	call   8015e6 <ipc_find_env>
+  8021dc:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  8021e1:	83 c4 10             	add    $0x10,%esp
+  8021e4:	e9 1e ff ff ff       	jmp    802107 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  8021e9:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  8021ee:	eb d8                	jmp    8021c8 <fsring_slot+0x111>
+
+008021f0 <file_read_direct>:
+{
+  8021f0:	55                   	push   %ebp
+  8021f1:	89 e5                	mov    %esp,%ebp
+  8021f3:	57                   	push   %edi
+  8021f4:	56                   	push   %esi
+  8021f5:	53                   	push   %ebx
+  8021f6:	83 ec 1c             	sub    $0x1c,%esp
+  8021f9:	89 c7                	mov    %eax,%edi
+  8021fb:	89 d6                	mov    %edx,%esi
+  8021fd:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  8021ff:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  802205:	77 52                	ja     802259 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802207:	8b 40 0c             	mov    0xc(%eax),%eax
+  80220a:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  80220f:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802215:	ba 00 00 00 00       	mov    $0x0,%edx
+  80221a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80221f:	e8 b6 fb ff ff       	call   801dda <fsipc>
+  802224:	89 c7                	mov    %eax,%edi
+  802226:	85 c0                	test   %eax,%eax
+  802228:	78 25                	js     80224f <file_read_direct+0x5f>
+	assert(r <= n);
+  80222a:	39 c3                	cmp    %eax,%ebx
+  80222c:	0f 82 87 00 00 00    	jb     8022b9 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  802232:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802237:	0f 8f 95 00 00 00    	jg     8022d2 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80223d:	83 ec 04             	sub    $0x4,%esp
+  802240:	50                   	push   %eax
+  802241:	68 00 70 80 00       	push   $0x807000
+  802246:	56                   	push   %esi
+  802247:	e8 5a e8 ff ff       	call   800aa6 <memmove>
+	return r;
+  80224c:	83 c4 10             	add    $0x10,%esp
+}
+  80224f:	89 f8                	mov    %edi,%eax
+  802251:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802254:	5b                   	pop    %ebx
+  802255:	5e                   	pop    %esi
+  802256:	5f                   	pop    %edi
+  802257:	5d                   	pop    %ebp
+  802258:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802259:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80225f:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802264:	29 d1                	sub    %edx,%ecx
+  802266:	39 d9                	cmp    %ebx,%ecx
+  802268:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80226b:	89 f0                	mov    %esi,%eax
+  80226d:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  802270:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802273:	eb 0f                	jmp    802284 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  802275:	0f b6 10             	movzbl (%eax),%edx
+  802278:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80227a:	05 00 10 00 00       	add    $0x1000,%eax
+  80227f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802284:	39 c8                	cmp    %ecx,%eax
+  802286:	72 ed                	jb     802275 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802288:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80228b:	8b 47 0c             	mov    0xc(%edi),%eax
+  80228e:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  802293:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802299:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  80229f:	83 ec 0c             	sub    $0xc,%esp
+  8022a2:	6a 07                	push   $0x7
+  8022a4:	89 d9                	mov    %ebx,%ecx
+  8022a6:	89 f2                	mov    %esi,%edx
+  8022a8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022ad:	e8 86 f9 ff ff       	call   801c38 <fsipc_pages>
+  8022b2:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  8022b4:	83 c4 10             	add    $0x10,%esp
+  8022b7:	eb 96                	jmp    80224f <file_read_direct+0x5f>
+	assert(r <= n);
+  8022b9:	68 fb 3e 80 00       	push   $0x803efb
+  8022be:	68 ec 3d 80 00       	push   $0x803dec
+  8022c3:	68 dc 00 00 00       	push   $0xdc
+  8022c8:	68 f0 3e 80 00       	push   $0x803ef0
+  8022cd:	e8 85 df ff ff       	call   800257 <_panic>
+	assert(r <= PGSIZE);
+  8022d2:	68 0c 3f 80 00       	push   $0x803f0c
+  8022d7:	68 ec 3d 80 00       	push   $0x803dec
+  8022dc:	68 dd 00 00 00       	push   $0xdd
+  8022e1:	68 f0 3e 80 00       	push   $0x803ef0
+  8022e6:	e8 6c df ff ff       	call   800257 <_panic>
+
+008022eb <devfile_read>:
+{
+  8022eb:	55                   	push   %ebp
+  8022ec:	89 e5                	mov    %esp,%ebp
+  8022ee:	57                   	push   %edi
+  8022ef:	56                   	push   %esi
+  8022f0:	53                   	push   %ebx
+  8022f1:	83 ec 28             	sub    $0x28,%esp
+  8022f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022f7:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8022fa:	53                   	push   %ebx
+  8022fb:	e8 35 f3 ff ff       	call   801635 <fd2data>
+  802300:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  802303:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  802306:	83 c4 10             	add    $0x10,%esp
+  802309:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  80230d:	74 7d                	je     80238c <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80230f:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  802313:	0f 85 81 00 00 00    	jne    80239a <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  802319:	8b 43 18             	mov    0x18(%ebx),%eax
+  80231c:	85 c0                	test   %eax,%eax
+  80231e:	74 0d                	je     80232d <devfile_read+0x42>
+  802320:	8b 53 14             	mov    0x14(%ebx),%edx
+  802323:	39 fa                	cmp    %edi,%edx
+  802325:	7f 06                	jg     80232d <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  802327:	01 c2                	add    %eax,%edx
+  802329:	39 d7                	cmp    %edx,%edi
+  80232b:	72 28                	jb     802355 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  80232d:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  802334:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80233a:	77 74                	ja     8023b0 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  80233c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802341:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802344:	89 d8                	mov    %ebx,%eax
+  802346:	e8 a5 fe ff ff       	call   8021f0 <file_read_direct>
+  80234b:	85 c0                	test   %eax,%eax
+  80234d:	7e 35                	jle    802384 <devfile_read+0x99>
+		ff->buf_base = pos;
+  80234f:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  802352:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  802355:	8b 53 14             	mov    0x14(%ebx),%edx
+  802358:	89 d0                	mov    %edx,%eax
+  80235a:	03 43 18             	add    0x18(%ebx),%eax
+  80235d:	29 f8                	sub    %edi,%eax
+  80235f:	39 f0                	cmp    %esi,%eax
+  802361:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  802364:	83 ec 04             	sub    $0x4,%esp
+  802367:	56                   	push   %esi
+  802368:	89 f8                	mov    %edi,%eax
+  80236a:	29 d0                	sub    %edx,%eax
+  80236c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80236f:	01 c1                	add    %eax,%ecx
+  802371:	51                   	push   %ecx
+  802372:	ff 75 0c             	push   0xc(%ebp)
+  802375:	e8 2c e7 ff ff       	call   800aa6 <memmove>
+	fd->fd_offset = pos + n;
+  80237a:	01 f7                	add    %esi,%edi
+  80237c:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80237f:	89 f0                	mov    %esi,%eax
+  802381:	83 c4 10             	add    $0x10,%esp
+}
+  802384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802387:	5b                   	pop    %ebx
+  802388:	5e                   	pop    %esi
+  802389:	5f                   	pop    %edi
+  80238a:	5d                   	pop    %ebp
+  80238b:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  80238c:	89 f1                	mov    %esi,%ecx
+  80238e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802391:	89 d8                	mov    %ebx,%eax
+  802393:	e8 58 fe ff ff       	call   8021f0 <file_read_direct>
+  802398:	eb ea                	jmp    802384 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80239a:	83 ec 0c             	sub    $0xc,%esp
+  80239d:	53                   	push   %ebx
+  80239e:	e8 db fa ff ff       	call   801e7e <devfile_sync>
+  8023a3:	83 c4 10             	add    $0x10,%esp
+  8023a6:	85 c0                	test   %eax,%eax
+  8023a8:	0f 89 6b ff ff ff    	jns    802319 <devfile_read+0x2e>
+  8023ae:	eb d4                	jmp    802384 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  8023b0:	89 f1                	mov    %esi,%ecx
+  8023b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023b5:	89 d8                	mov    %ebx,%eax
+  8023b7:	e8 34 fe ff ff       	call   8021f0 <file_read_direct>
+  8023bc:	eb c6                	jmp    802384 <devfile_read+0x99>
+
+008023be <open>:
+{
+  8023be:	55                   	push   %ebp
+  8023bf:	89 e5                	mov    %esp,%ebp
+  8023c1:	56                   	push   %esi
+  8023c2:	53                   	push   %ebx
+  8023c3:	83 ec 1c             	sub    $0x1c,%esp
+  8023c6:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8023c9:	56                   	push   %esi
+  8023ca:	e8 16 e5 ff ff       	call   8008e5 <strlen>
+  8023cf:	83 c4 10             	add    $0x10,%esp
+  8023d2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8023d7:	0f 8f a0 00 00 00    	jg     80247d <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  8023dd:	83 ec 0c             	sub    $0xc,%esp
+  8023e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023e3:	50                   	push   %eax
+  8023e4:	e8 63 f2 ff ff       	call   80164c <fd_alloc>
+  8023e9:	89 c3                	mov    %eax,%ebx
+  8023eb:	83 c4 10             	add    $0x10,%esp
+  8023ee:	85 c0                	test   %eax,%eax
+  8023f0:	78 45                	js     802437 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  8023f2:	83 ec 08             	sub    $0x8,%esp
+  8023f5:	56                   	push   %esi
+  8023f6:	68 00 70 80 00       	push   $0x807000
+  8023fb:	e8 20 e5 ff ff       	call   800920 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802400:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802403:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802408:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80240b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802410:	e8 c5 f9 ff ff       	call   801dda <fsipc>
+  802415:	89 c3                	mov    %eax,%ebx
+  802417:	83 c4 10             	add    $0x10,%esp
+  80241a:	85 c0                	test   %eax,%eax
+  80241c:	78 22                	js     802440 <open+0x82>
+	if (!(mode & O_NOBUF)
+  80241e:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  802425:	74 2b                	je     802452 <open+0x94>
+	return fd2num(fd);
+  802427:	83 ec 0c             	sub    $0xc,%esp
+  80242a:	ff 75 f4             	push   -0xc(%ebp)
+  80242d:	e8 f3 f1 ff ff       	call   801625 <fd2num>
+  802432:	89 c3                	mov    %eax,%ebx
+  802434:	83 c4 10             	add    $0x10,%esp
+}
+  802437:	89 d8                	mov    %ebx,%eax
+  802439:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80243c:	5b                   	pop    %ebx
+  80243d:	5e                   	pop    %esi
+  80243e:	5d                   	pop    %ebp
+  80243f:	c3                   	ret
+		fd_close(fd, 0);
+  802440:	83 ec 08             	sub    $0x8,%esp
+  802443:	6a 00                	push   $0x0
+  802445:	ff 75 f4             	push   -0xc(%ebp)
+  802448:	e8 f8 f2 ff ff       	call   801745 <fd_close>
+		return r;
+  80244d:	83 c4 10             	add    $0x10,%esp
+  802450:	eb e5                	jmp    802437 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  802452:	83 ec 0c             	sub    $0xc,%esp
+  802455:	ff 75 f4             	push   -0xc(%ebp)
+  802458:	e8 d8 f1 ff ff       	call   801635 <fd2data>
+  80245d:	83 c4 0c             	add    $0xc,%esp
+  802460:	68 07 04 00 00       	push   $0x407
+  802465:	50                   	push   %eax
+  802466:	6a 00                	push   $0x0
+  802468:	e8 bf e8 ff ff       	call   800d2c <sys_page_alloc>
+  80246d:	83 c4 10             	add    $0x10,%esp
+  802470:	85 c0                	test   %eax,%eax
+  802472:	75 b3                	jne    802427 <open+0x69>
+		fd->fd_file.buffered = 1;
+  802474:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802477:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  80247b:	eb aa                	jmp    802427 <open+0x69>
+		return -E_BAD_PATH;
+  80247d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802482:	eb b3                	jmp    802437 <open+0x79>
+
+00802484 <readdir>:
+{
+  802484:	55                   	push   %ebp
+  802485:	89 e5                	mov    %esp,%ebp
+  802487:	53                   	push   %ebx
+  802488:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80248b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80248e:	50                   	push   %eax
+  80248f:	ff 75 08             	push   0x8(%ebp)
+  802492:	e8 0b f2 ff ff       	call   8016a2 <fd_lookup>
+  802497:	89 c3                	mov    %eax,%ebx
+  802499:	83 c4 10             	add    $0x10,%esp
+  80249c:	85 c0                	test   %eax,%eax
+  80249e:	78 73                	js     802513 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8024a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024a3:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  8024a9:	39 08                	cmp    %ecx,(%eax)
+  8024ab:	0f 85 82 00 00 00    	jne    802533 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  8024b1:	83 ec 0c             	sub    $0xc,%esp
+  8024b4:	50                   	push   %eax
+  8024b5:	e8 c4 f9 ff ff       	call   801e7e <devfile_sync>
+  8024ba:	89 c3                	mov    %eax,%ebx
+  8024bc:	83 c4 10             	add    $0x10,%esp
+  8024bf:	85 c0                	test   %eax,%eax
+  8024c1:	78 50                	js     802513 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  8024c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024c6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024c9:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  8024ce:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024d1:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  8024d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024d9:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  8024de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024e3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8024e8:	e8 ed f8 ff ff       	call   801dda <fsipc>
+  8024ed:	89 c3                	mov    %eax,%ebx
+  8024ef:	85 c0                	test   %eax,%eax
+  8024f1:	7e 20                	jle    802513 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  8024f3:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8024f6:	72 22                	jb     80251a <readdir+0x96>
+  8024f8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8024fd:	7f 1b                	jg     80251a <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8024ff:	83 ec 04             	sub    $0x4,%esp
+  802502:	50                   	push   %eax
+  802503:	68 00 70 80 00       	push   $0x807000
+  802508:	ff 75 0c             	push   0xc(%ebp)
+  80250b:	e8 96 e5 ff ff       	call   800aa6 <memmove>
+	return r;
+  802510:	83 c4 10             	add    $0x10,%esp
+}
+  802513:	89 d8                	mov    %ebx,%eax
+  802515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802518:	c9                   	leave
+  802519:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  80251a:	68 02 3f 80 00       	push   $0x803f02
+  80251f:	68 ec 3d 80 00       	push   $0x803dec
+  802524:	68 86 01 00 00       	push   $0x186
+  802529:	68 f0 3e 80 00       	push   $0x803ef0
+  80252e:	e8 24 dd ff ff       	call   800257 <_panic>
+		return -E_NOT_SUPP;
+  802533:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802538:	eb d9                	jmp    802513 <readdir+0x8f>
+
+0080253a <munmap>:
+{
+  80253a:	55                   	push   %ebp
+  80253b:	89 e5                	mov    %esp,%ebp
+  80253d:	56                   	push   %esi
+  80253e:	53                   	push   %ebx
+  80253f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802542:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802545:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  80254b:	75 41                	jne    80258e <munmap+0x54>
+  80254d:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  802553:	77 39                	ja     80258e <munmap+0x54>
+  802555:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80255a:	29 f0                	sub    %esi,%eax
+  80255c:	39 d0                	cmp    %edx,%eax
+  80255e:	72 35                	jb     802595 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802560:	89 f3                	mov    %esi,%ebx
+  802562:	01 d6                	add    %edx,%esi
+  802564:	39 f3                	cmp    %esi,%ebx
+  802566:	73 1a                	jae    802582 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802568:	83 ec 08             	sub    $0x8,%esp
+  80256b:	53                   	push   %ebx
+  80256c:	6a 00                	push   $0x0
+  80256e:	e8 46 e8 ff ff       	call   800db9 <sys_page_unmap>
+  802573:	83 c4 10             	add    $0x10,%esp
+  802576:	85 c0                	test   %eax,%eax
+  802578:	78 0d                	js     802587 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80257a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802580:	eb e2                	jmp    802564 <munmap+0x2a>
+	return 0;
+  802582:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802587:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80258a:	5b                   	pop    %ebx
+  80258b:	5e                   	pop    %esi
+  80258c:	5d                   	pop    %ebp
+  80258d:	c3                   	ret
+		return -E_INVAL;
+  80258e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802593:	eb f2                	jmp    802587 <munmap+0x4d>
+  802595:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80259a:	eb eb                	jmp    802587 <munmap+0x4d>
+
+0080259c <mmap>:
+{
+  80259c:	55                   	push   %ebp
+  80259d:	89 e5                	mov    %esp,%ebp
+  80259f:	57                   	push   %edi
+  8025a0:	56                   	push   %esi
+  8025a1:	53                   	push   %ebx
+  8025a2:	83 ec 34             	sub    $0x34,%esp
+  8025a5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025a8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8025ab:	50                   	push   %eax
+  8025ac:	ff 75 18             	push   0x18(%ebp)
+  8025af:	e8 ee f0 ff ff       	call   8016a2 <fd_lookup>
+  8025b4:	89 c3                	mov    %eax,%ebx
+  8025b6:	83 c4 10             	add    $0x10,%esp
+  8025b9:	85 c0                	test   %eax,%eax
+  8025bb:	0f 88 0e 01 00 00    	js     8026cf <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8025c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025c4:	a1 20 50 80 00       	mov    0x805020,%eax
+  8025c9:	39 02                	cmp    %eax,(%edx)
+  8025cb:	0f 85 50 01 00 00    	jne    802721 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  8025d1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8025d4:	83 e0 02             	and    $0x2,%eax
+  8025d7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8025da:	74 0a                	je     8025e6 <mmap+0x4a>
+  8025dc:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8025e0:	0f 84 42 01 00 00    	je     802728 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  8025e6:	8b 42 08             	mov    0x8(%edx),%eax
+  8025e9:	83 e0 03             	and    $0x3,%eax
+  8025ec:	83 f8 01             	cmp    $0x1,%eax
+  8025ef:	0f 84 3a 01 00 00    	je     80272f <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8025f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f8:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8025fb:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802600:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802603:	0f 85 2d 01 00 00    	jne    802736 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802609:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  80260d:	0f 88 2a 01 00 00    	js     80273d <mmap+0x1a1>
+  802613:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  80261a:	0f 87 1d 01 00 00    	ja     80273d <mmap+0x1a1>
+  802620:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802625:	2b 45 08             	sub    0x8(%ebp),%eax
+  802628:	39 f8                	cmp    %edi,%eax
+  80262a:	0f 82 14 01 00 00    	jb     802744 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  802630:	83 ec 0c             	sub    $0xc,%esp
+  802633:	52                   	push   %edx
+  802634:	e8 45 f8 ff ff       	call   801e7e <devfile_sync>
+  802639:	89 c3                	mov    %eax,%ebx
+  80263b:	83 c4 10             	add    $0x10,%esp
+  80263e:	85 c0                	test   %eax,%eax
+  802640:	0f 88 89 00 00 00    	js     8026cf <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802646:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  80264c:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802652:	be 00 00 00 00       	mov    $0x0,%esi
+  802657:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  80265a:	39 fe                	cmp    %edi,%esi
+  80265c:	73 7b                	jae    8026d9 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  80265e:	89 f8                	mov    %edi,%eax
+  802660:	29 f0                	sub    %esi,%eax
+  802662:	c1 e8 0c             	shr    $0xc,%eax
+  802665:	ba 40 00 00 00       	mov    $0x40,%edx
+  80266a:	39 d0                	cmp    %edx,%eax
+  80266c:	0f 47 c2             	cmova  %edx,%eax
+  80266f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802672:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802675:	8b 52 0c             	mov    0xc(%edx),%edx
+  802678:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  80267e:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  802681:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  802687:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  80268c:	89 f2                	mov    %esi,%edx
+  80268e:	03 55 08             	add    0x8(%ebp),%edx
+  802691:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802694:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802699:	e8 ea f6 ff ff       	call   801d88 <fsipcv>
+  80269e:	85 c0                	test   %eax,%eax
+  8026a0:	7e 12                	jle    8026b4 <mmap+0x118>
+  8026a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8026a5:	85 c0                	test   %eax,%eax
+  8026a7:	0f 84 9e 00 00 00    	je     80274b <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8026ad:	c1 e0 0c             	shl    $0xc,%eax
+  8026b0:	01 c6                	add    %eax,%esi
+  8026b2:	eb a6                	jmp    80265a <mmap+0xbe>
+			munmap(addr, done);
+  8026b4:	89 c3                	mov    %eax,%ebx
+  8026b6:	83 ec 08             	sub    $0x8,%esp
+  8026b9:	56                   	push   %esi
+  8026ba:	ff 75 08             	push   0x8(%ebp)
+  8026bd:	e8 78 fe ff ff       	call   80253a <munmap>
+			return r < 0 ? r : -E_INVAL;
+  8026c2:	83 c4 10             	add    $0x10,%esp
+  8026c5:	85 db                	test   %ebx,%ebx
+  8026c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026cc:	0f 49 d8             	cmovns %eax,%ebx
+}
+  8026cf:	89 d8                	mov    %ebx,%eax
+  8026d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026d4:	5b                   	pop    %ebx
+  8026d5:	5e                   	pop    %esi
+  8026d6:	5f                   	pop    %edi
+  8026d7:	5d                   	pop    %ebp
+  8026d8:	c3                   	ret
+	if (prot & PROT_WRITE)
+  8026d9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8026dc:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8026de:	85 c0                	test   %eax,%eax
+  8026e0:	74 ed                	je     8026cf <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8026e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8026ea:	39 fe                	cmp    %edi,%esi
+  8026ec:	73 2e                	jae    80271c <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8026ee:	83 ec 0c             	sub    $0xc,%esp
+  8026f1:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8026f4:	50                   	push   %eax
+  8026f5:	e8 4a eb ff ff       	call   801244 <cowpage>
+  8026fa:	83 c4 10             	add    $0x10,%esp
+  8026fd:	85 c0                	test   %eax,%eax
+  8026ff:	78 08                	js     802709 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802701:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802707:	eb e1                	jmp    8026ea <mmap+0x14e>
+				munmap(addr, len);
+  802709:	89 c3                	mov    %eax,%ebx
+  80270b:	83 ec 08             	sub    $0x8,%esp
+  80270e:	57                   	push   %edi
+  80270f:	ff 75 08             	push   0x8(%ebp)
+  802712:	e8 23 fe ff ff       	call   80253a <munmap>
+				return r;
+  802717:	83 c4 10             	add    $0x10,%esp
+  80271a:	eb b3                	jmp    8026cf <mmap+0x133>
+	return 0;
+  80271c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80271f:	eb ae                	jmp    8026cf <mmap+0x133>
+		return -E_NOT_SUPP;
+  802721:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802726:	eb a7                	jmp    8026cf <mmap+0x133>
+		return -E_NOT_SUPP;
+  802728:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80272d:	eb a0                	jmp    8026cf <mmap+0x133>
+		return -E_INVAL;
+  80272f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802734:	eb 99                	jmp    8026cf <mmap+0x133>
+  802736:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80273b:	eb 92                	jmp    8026cf <mmap+0x133>
+  80273d:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802742:	eb 8b                	jmp    8026cf <mmap+0x133>
+  802744:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802749:	eb 84                	jmp    8026cf <mmap+0x133>
+			munmap(addr, done);
+  80274b:	83 ec 08             	sub    $0x8,%esp
+  80274e:	56                   	push   %esi
+  80274f:	ff 75 08             	push   0x8(%ebp)
+  802752:	e8 e3 fd ff ff       	call   80253a <munmap>
+  802757:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  80275a:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80275f:	e9 6b ff ff ff       	jmp    8026cf <mmap+0x133>
+
+00802764 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802764:	55                   	push   %ebp
+  802765:	89 e5                	mov    %esp,%ebp
+  802767:	56                   	push   %esi
+  802768:	53                   	push   %ebx
+  802769:	83 ec 10             	sub    $0x10,%esp
+  80276c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80276f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802772:	8b 45 08             	mov    0x8(%ebp),%eax
+  802775:	e8 3d f9 ff ff       	call   8020b7 <fsring_slot>
+  80277a:	85 c0                	test   %eax,%eax
+  80277c:	78 60                	js     8027de <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80277e:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802781:	8b 56 08             	mov    0x8(%esi),%edx
+  802784:	83 e2 03             	and    $0x3,%edx
+  802787:	83 fa 01             	cmp    $0x1,%edx
+  80278a:	74 59                	je     8027e5 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  80278c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802791:	89 c1                	mov    %eax,%ecx
+  802793:	d3 e2                	shl    %cl,%edx
+  802795:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  80279b:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80279e:	c1 e2 02             	shl    $0x2,%edx
+  8027a1:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  8027a7:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  8027ae:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8027b1:	8b 55 18             	mov    0x18(%ebp),%edx
+  8027b4:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8027b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027ba:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8027bd:	83 ec 08             	sub    $0x8,%esp
+  8027c0:	50                   	push   %eax
+  8027c1:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8027c6:	39 c3                	cmp    %eax,%ebx
+  8027c8:	0f 47 d8             	cmova  %eax,%ebx
+  8027cb:	53                   	push   %ebx
+  8027cc:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8027cf:	89 f2                	mov    %esi,%edx
+  8027d1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8027d6:	e8 1e f5 ff ff       	call   801cf9 <fsring_post>
+  8027db:	83 c4 10             	add    $0x10,%esp
+}
+  8027de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027e1:	5b                   	pop    %ebx
+  8027e2:	5e                   	pop    %esi
+  8027e3:	5d                   	pop    %ebp
+  8027e4:	c3                   	ret
+		return -E_INVAL;
+  8027e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027ea:	eb f2                	jmp    8027de <fsring_read+0x7a>
+
+008027ec <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8027ec:	55                   	push   %ebp
+  8027ed:	89 e5                	mov    %esp,%ebp
+  8027ef:	56                   	push   %esi
+  8027f0:	53                   	push   %ebx
+  8027f1:	83 ec 10             	sub    $0x10,%esp
+  8027f4:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8027f7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027fd:	e8 b5 f8 ff ff       	call   8020b7 <fsring_slot>
+  802802:	89 c3                	mov    %eax,%ebx
+  802804:	85 c0                	test   %eax,%eax
+  802806:	78 77                	js     80287f <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802808:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80280b:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80280f:	74 77                	je     802888 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802811:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802816:	39 c6                	cmp    %eax,%esi
+  802818:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  80281b:	83 ec 04             	sub    $0x4,%esp
+  80281e:	56                   	push   %esi
+  80281f:	ff 75 0c             	push   0xc(%ebp)
+  802822:	89 d8                	mov    %ebx,%eax
+  802824:	c1 e0 0c             	shl    $0xc,%eax
+  802827:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80282d:	50                   	push   %eax
+  80282e:	e8 73 e2 ff ff       	call   800aa6 <memmove>
+	fsring_busy |= 1 << slot;
+  802833:	b8 01 00 00 00       	mov    $0x1,%eax
+  802838:	89 d9                	mov    %ebx,%ecx
+  80283a:	d3 e0                	shl    %cl,%eax
+  80283c:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802842:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802845:	c1 e0 02             	shl    $0x2,%eax
+  802848:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  80284e:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  802855:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802858:	8b 45 18             	mov    0x18(%ebp),%eax
+  80285b:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80285e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802865:	83 c4 08             	add    $0x8,%esp
+  802868:	53                   	push   %ebx
+  802869:	56                   	push   %esi
+  80286a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80286d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802870:	b8 04 00 00 00       	mov    $0x4,%eax
+  802875:	e8 7f f4 ff ff       	call   801cf9 <fsring_post>
+  80287a:	89 c3                	mov    %eax,%ebx
+  80287c:	83 c4 10             	add    $0x10,%esp
+}
+  80287f:	89 d8                	mov    %ebx,%eax
+  802881:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802884:	5b                   	pop    %ebx
+  802885:	5e                   	pop    %esi
+  802886:	5d                   	pop    %ebp
+  802887:	c3                   	ret
+		return -E_INVAL;
+  802888:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80288d:	eb f0                	jmp    80287f <fsring_write+0x93>
+
+0080288f <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80288f:	55                   	push   %ebp
+  802890:	89 e5                	mov    %esp,%ebp
+  802892:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802895:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802898:	8b 45 08             	mov    0x8(%ebp),%eax
+  80289b:	e8 17 f8 ff ff       	call   8020b7 <fsring_slot>
+  8028a0:	85 c0                	test   %eax,%eax
+  8028a2:	78 4c                	js     8028f0 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8028a4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8028a9:	89 c1                	mov    %eax,%ecx
+  8028ab:	d3 e2                	shl    %cl,%edx
+  8028ad:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8028b3:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8028b6:	c1 e2 02             	shl    $0x2,%edx
+  8028b9:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  8028bf:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  8028c6:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8028c9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8028cc:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8028cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028d2:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  8028d5:	83 ec 08             	sub    $0x8,%esp
+  8028d8:	50                   	push   %eax
+  8028d9:	6a 00                	push   $0x0
+  8028db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028e0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028e3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8028e8:	e8 0c f4 ff ff       	call   801cf9 <fsring_post>
+  8028ed:	83 c4 10             	add    $0x10,%esp
+}
+  8028f0:	c9                   	leave
+  8028f1:	c3                   	ret
+
+008028f2 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8028f2:	55                   	push   %ebp
+  8028f3:	89 e5                	mov    %esp,%ebp
+  8028f5:	57                   	push   %edi
+  8028f6:	56                   	push   %esi
+  8028f7:	53                   	push   %ebx
+  8028f8:	83 ec 1c             	sub    $0x1c,%esp
+  8028fb:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8028ff:	a1 00 60 80 00       	mov    0x806000,%eax
+  802904:	8b 40 48             	mov    0x48(%eax),%eax
+  802907:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  80290d:	74 12                	je     802921 <fsring_reap+0x2f>
+		return 0;
+  80290f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802914:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802917:	5b                   	pop    %ebx
+  802918:	5e                   	pop    %esi
+  802919:	5f                   	pop    %edi
+  80291a:	5d                   	pop    %ebp
+  80291b:	c3                   	ret
+		sys_yield();
+  80291c:	e8 ec e3 ff ff       	call   800d0d <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802921:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802927:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  80292c:	39 c2                	cmp    %eax,%edx
+  80292e:	75 18                	jne    802948 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802930:	84 db                	test   %bl,%bl
+  802932:	0f 84 21 01 00 00    	je     802a59 <fsring_reap+0x167>
+  802938:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  80293f:	75 db                	jne    80291c <fsring_reap+0x2a>
+			return 0;
+  802941:	b8 00 00 00 00       	mov    $0x0,%eax
+  802946:	eb cc                	jmp    802914 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802948:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80294d:	83 e0 0f             	and    $0xf,%eax
+  802950:	83 c0 2a             	add    $0x2a,%eax
+  802953:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  80295a:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802961:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802966:	83 c0 01             	add    $0x1,%eax
+  802969:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  80296e:	83 fb 0f             	cmp    $0xf,%ebx
+  802971:	77 5b                	ja     8029ce <fsring_reap+0xdc>
+  802973:	be 01 00 00 00       	mov    $0x1,%esi
+  802978:	89 d9                	mov    %ebx,%ecx
+  80297a:	d3 e6                	shl    %cl,%esi
+  80297c:	89 f0                	mov    %esi,%eax
+  80297e:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  802984:	74 48                	je     8029ce <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802986:	89 d8                	mov    %ebx,%eax
+  802988:	c1 e0 0c             	shl    $0xc,%eax
+  80298b:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802991:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802994:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802997:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  80299e:	83 f8 03             	cmp    $0x3,%eax
+  8029a1:	74 40                	je     8029e3 <fsring_reap+0xf1>
+  8029a3:	83 f8 05             	cmp    $0x5,%eax
+  8029a6:	74 64                	je     802a0c <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8029a8:	f7 d6                	not    %esi
+  8029aa:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8029b0:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8029b3:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  8029ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029bd:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8029bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029c2:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8029c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029c9:	e9 46 ff ff ff       	jmp    802914 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8029ce:	53                   	push   %ebx
+  8029cf:	68 18 3f 80 00       	push   $0x803f18
+  8029d4:	68 8f 02 00 00       	push   $0x28f
+  8029d9:	68 f0 3e 80 00       	push   $0x803ef0
+  8029de:	e8 74 d8 ff ff       	call   800257 <_panic>
+		if (cqe.cqe_result > 0)
+  8029e3:	85 ff                	test   %edi,%edi
+  8029e5:	7e c1                	jle    8029a8 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8029e7:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8029ea:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8029ef:	39 c7                	cmp    %eax,%edi
+  8029f1:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8029f4:	50                   	push   %eax
+  8029f5:	ff 75 e4             	push   -0x1c(%ebp)
+  8029f8:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8029fb:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  802a02:	e8 9f e0 ff ff       	call   800aa6 <memmove>
+  802a07:	83 c4 10             	add    $0x10,%esp
+  802a0a:	eb 9c                	jmp    8029a8 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802a0c:	85 ff                	test   %edi,%edi
+  802a0e:	75 98                	jne    8029a8 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802a10:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802a13:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802a1a:	83 ec 08             	sub    $0x8,%esp
+  802a1d:	ff 75 e4             	push   -0x1c(%ebp)
+  802a20:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802a23:	51                   	push   %ecx
+  802a24:	e8 f7 de ff ff       	call   800920 <strcpy>
+			st->st_size = ret->ret_size;
+  802a29:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a2c:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802a32:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802a35:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802a3b:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802a41:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802a47:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  802a4e:	50 80 00 
+  802a51:	83 c4 10             	add    $0x10,%esp
+  802a54:	e9 4f ff ff ff       	jmp    8029a8 <fsring_reap+0xb6>
+			return 0;
+  802a59:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a5e:	e9 b1 fe ff ff       	jmp    802914 <fsring_reap+0x22>
+
+00802a63 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802a63:	55                   	push   %ebp
+  802a64:	89 e5                	mov    %esp,%ebp
+  802a66:	57                   	push   %edi
+  802a67:	56                   	push   %esi
+  802a68:	53                   	push   %ebx
+  802a69:	83 ec 28             	sub    $0x28,%esp
+  802a6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802a6f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802a72:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802a75:	53                   	push   %ebx
+  802a76:	e8 6a de ff ff       	call   8008e5 <strlen>
+  802a7b:	83 c4 10             	add    $0x10,%esp
+  802a7e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a83:	0f 8f 02 01 00 00    	jg     802b8b <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802a89:	83 ec 08             	sub    $0x8,%esp
+  802a8c:	53                   	push   %ebx
+  802a8d:	68 00 70 80 00       	push   $0x807000
+  802a92:	e8 89 de ff ff       	call   800920 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802a97:	83 c4 10             	add    $0x10,%esp
+  802a9a:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802aa0:	76 69                	jbe    802b0b <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802aa2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802aa5:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802aab:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802ab0:	29 d1                	sub    %edx,%ecx
+  802ab2:	39 f9                	cmp    %edi,%ecx
+  802ab4:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802ab7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802aba:	89 f9                	mov    %edi,%ecx
+  802abc:	01 c1                	add    %eax,%ecx
+  802abe:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802ac1:	eb 0f                	jmp    802ad2 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802ac3:	0f b6 10             	movzbl (%eax),%edx
+  802ac6:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802ac8:	05 00 10 00 00       	add    $0x1000,%eax
+  802acd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802ad2:	39 c8                	cmp    %ecx,%eax
+  802ad4:	72 ed                	jb     802ac3 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802ad6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ad9:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802adf:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802ae5:	83 ec 0c             	sub    $0xc,%esp
+  802ae8:	6a 07                	push   $0x7
+  802aea:	89 f9                	mov    %edi,%ecx
+  802aec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802aef:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802af4:	e8 3f f1 ff ff       	call   801c38 <fsipc_pages>
+  802af9:	89 c7                	mov    %eax,%edi
+  802afb:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802afe:	85 f6                	test   %esi,%esi
+  802b00:	74 7f                	je     802b81 <file_slurp+0x11e>
+  802b02:	8d 43 01             	lea    0x1(%ebx),%eax
+  802b05:	85 ff                	test   %edi,%edi
+  802b07:	79 3c                	jns    802b45 <file_slurp+0xe2>
+  802b09:	eb 76                	jmp    802b81 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802b0b:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802b11:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b16:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802b1b:	e8 ba f2 ff ff       	call   801dda <fsipc>
+  802b20:	89 c7                	mov    %eax,%edi
+  802b22:	85 c0                	test   %eax,%eax
+  802b24:	7e d8                	jle    802afe <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802b26:	83 ec 04             	sub    $0x4,%esp
+  802b29:	50                   	push   %eax
+  802b2a:	68 08 70 80 00       	push   $0x807008
+  802b2f:	ff 75 0c             	push   0xc(%ebp)
+  802b32:	e8 6f df ff ff       	call   800aa6 <memmove>
+  802b37:	83 c4 10             	add    $0x10,%esp
+  802b3a:	eb c2                	jmp    802afe <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802b3c:	80 fa 2f             	cmp    $0x2f,%dl
+  802b3f:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802b42:	83 c0 01             	add    $0x1,%eax
+  802b45:	89 c1                	mov    %eax,%ecx
+  802b47:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802b4b:	84 d2                	test   %dl,%dl
+  802b4d:	75 ed                	jne    802b3c <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802b4f:	83 ec 04             	sub    $0x4,%esp
+  802b52:	68 80 00 00 00       	push   $0x80
+  802b57:	53                   	push   %ebx
+  802b58:	56                   	push   %esi
+  802b59:	e8 38 de ff ff       	call   800996 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802b5e:	a1 00 70 80 00       	mov    0x807000,%eax
+  802b63:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802b69:	a1 04 70 80 00       	mov    0x807004,%eax
+  802b6e:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802b74:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  802b7b:	50 80 00 
+  802b7e:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802b81:	89 f8                	mov    %edi,%eax
+  802b83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b86:	5b                   	pop    %ebx
+  802b87:	5e                   	pop    %esi
+  802b88:	5f                   	pop    %edi
+  802b89:	5d                   	pop    %ebp
+  802b8a:	c3                   	ret
+		return -E_BAD_PATH;
+  802b8b:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802b90:	eb ef                	jmp    802b81 <file_slurp+0x11e>
+
+00802b92 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802b92:	55                   	push   %ebp
+  802b93:	89 e5                	mov    %esp,%ebp
+  802b95:	53                   	push   %ebx
+  802b96:	83 ec 10             	sub    $0x10,%esp
+  802b99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802b9c:	53                   	push   %ebx
+  802b9d:	e8 43 dd ff ff       	call   8008e5 <strlen>
+  802ba2:	83 c4 10             	add    $0x10,%esp
+  802ba5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802baa:	7f 25                	jg     802bd1 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802bac:	83 ec 08             	sub    $0x8,%esp
+  802baf:	53                   	push   %ebx
+  802bb0:	68 00 70 80 00       	push   $0x807000
+  802bb5:	e8 66 dd ff ff       	call   800920 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802bba:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bbf:	b8 07 00 00 00       	mov    $0x7,%eax
+  802bc4:	e8 11 f2 ff ff       	call   801dda <fsipc>
+  802bc9:	83 c4 10             	add    $0x10,%esp
+}
+  802bcc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bcf:	c9                   	leave
+  802bd0:	c3                   	ret
+		return -E_BAD_PATH;
+  802bd1:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802bd6:	eb f4                	jmp    802bcc <remove+0x3a>
+
+00802bd8 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802bd8:	55                   	push   %ebp
+  802bd9:	89 e5                	mov    %esp,%ebp
+  802bdb:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802bde:	ba 00 00 00 00       	mov    $0x0,%edx
+  802be3:	b8 08 00 00 00       	mov    $0x8,%eax
+  802be8:	e8 ed f1 ff ff       	call   801dda <fsipc>
+}
+  802bed:	c9                   	leave
+  802bee:	c3                   	ret
+
+00802bef <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802bef:	55                   	push   %ebp
+  802bf0:	89 e5                	mov    %esp,%ebp
+  802bf2:	57                   	push   %edi
+  802bf3:	56                   	push   %esi
+  802bf4:	53                   	push   %ebx
+  802bf5:	83 ec 18             	sub    $0x18,%esp
+  802bf8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802bfb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802bfe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802c01:	57                   	push   %edi
+  802c02:	e8 de dc ff ff       	call   8008e5 <strlen>
+  802c07:	83 c4 10             	add    $0x10,%esp
+  802c0a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802c0f:	7f 4c                	jg     802c5d <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802c11:	83 ec 08             	sub    $0x8,%esp
+  802c14:	57                   	push   %edi
+  802c15:	68 00 70 80 00       	push   $0x807000
+  802c1a:	e8 01 dd ff ff       	call   800920 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802c1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c24:	b8 10 00 00 00       	mov    $0x10,%eax
+  802c29:	e8 ac f1 ff ff       	call   801dda <fsipc>
+  802c2e:	83 c4 10             	add    $0x10,%esp
+  802c31:	85 c0                	test   %eax,%eax
+  802c33:	78 20                	js     802c55 <defrag+0x66>
+		return r;
+	if (before)
+  802c35:	85 f6                	test   %esi,%esi
+  802c37:	74 07                	je     802c40 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802c39:	a1 00 70 80 00       	mov    0x807000,%eax
+  802c3e:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802c40:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802c45:	85 db                	test   %ebx,%ebx
+  802c47:	74 0c                	je     802c55 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802c49:	a1 04 70 80 00       	mov    0x807004,%eax
+  802c4e:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802c50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c58:	5b                   	pop    %ebx
+  802c59:	5e                   	pop    %esi
+  802c5a:	5f                   	pop    %edi
+  802c5b:	5d                   	pop    %ebp
+  802c5c:	c3                   	ret
+		return -E_BAD_PATH;
+  802c5d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802c62:	eb f1                	jmp    802c55 <defrag+0x66>
+
+00802c64 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802c64:	55                   	push   %ebp
+  802c65:	89 e5                	mov    %esp,%ebp
+  802c67:	53                   	push   %ebx
+  802c68:	83 ec 04             	sub    $0x4,%esp
+  802c6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802c6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c73:	b8 11 00 00 00       	mov    $0x11,%eax
+  802c78:	e8 5d f1 ff ff       	call   801dda <fsipc>
+  802c7d:	85 c0                	test   %eax,%eax
+  802c7f:	78 34                	js     802cb5 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802c81:	a1 00 70 80 00       	mov    0x807000,%eax
+  802c86:	89 03                	mov    %eax,(%ebx)
+  802c88:	a1 04 70 80 00       	mov    0x807004,%eax
+  802c8d:	89 43 04             	mov    %eax,0x4(%ebx)
+  802c90:	a1 08 70 80 00       	mov    0x807008,%eax
+  802c95:	89 43 08             	mov    %eax,0x8(%ebx)
+  802c98:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  802c9d:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802ca0:	a1 10 70 80 00       	mov    0x807010,%eax
+  802ca5:	89 43 10             	mov    %eax,0x10(%ebx)
+  802ca8:	a1 14 70 80 00       	mov    0x807014,%eax
+  802cad:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cb8:	c9                   	leave
+  802cb9:	c3                   	ret
+
+00802cba <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802cba:	55                   	push   %ebp
+  802cbb:	89 e5                	mov    %esp,%ebp
+  802cbd:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802cc0:	89 c2                	mov    %eax,%edx
+  802cc2:	c1 ea 16             	shr    $0x16,%edx
+  802cc5:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802ccc:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802cd1:	f6 c1 01             	test   $0x1,%cl
+  802cd4:	74 22                	je     802cf8 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  802cd6:	c1 e8 0c             	shr    $0xc,%eax
+  802cd9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802ce0:	a8 01                	test   $0x1,%al
+  802ce2:	74 14                	je     802cf8 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802ce4:	c1 e8 0c             	shr    $0xc,%eax
+  802ce7:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  802cea:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  802cf1:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  802cf5:	0f b7 d2             	movzwl %dx,%edx
+}
+  802cf8:	89 d0                	mov    %edx,%eax
+  802cfa:	5d                   	pop    %ebp
+  802cfb:	c3                   	ret
+
+00802cfc <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802cfc:	55                   	push   %ebp
+  802cfd:	89 e5                	mov    %esp,%ebp
+  802cff:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802d02:	68 31 3f 80 00       	push   $0x803f31
+  802d07:	ff 75 0c             	push   0xc(%ebp)
+  802d0a:	e8 11 dc ff ff       	call   800920 <strcpy>
+	return 0;
+}
+  802d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d14:	c9                   	leave
+  802d15:	c3                   	ret
+
+00802d16 <devsock_close>:
+{
+  802d16:	55                   	push   %ebp
+  802d17:	89 e5                	mov    %esp,%ebp
+  802d19:	53                   	push   %ebx
+  802d1a:	83 ec 10             	sub    $0x10,%esp
+  802d1d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802d20:	53                   	push   %ebx
+  802d21:	e8 94 ff ff ff       	call   802cba <pageref>
+  802d26:	89 c2                	mov    %eax,%edx
+  802d28:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802d2b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802d30:	83 fa 01             	cmp    $0x1,%edx
+  802d33:	74 05                	je     802d3a <devsock_close+0x24>
+}
+  802d35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d38:	c9                   	leave
+  802d39:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802d3a:	83 ec 0c             	sub    $0xc,%esp
+  802d3d:	ff 73 0c             	push   0xc(%ebx)
+  802d40:	e8 b7 02 00 00       	call   802ffc <nsipc_close>
+  802d45:	83 c4 10             	add    $0x10,%esp
+  802d48:	eb eb                	jmp    802d35 <devsock_close+0x1f>
+
+00802d4a <devsock_write>:
+{
+  802d4a:	55                   	push   %ebp
+  802d4b:	89 e5                	mov    %esp,%ebp
+  802d4d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802d50:	6a 00                	push   $0x0
+  802d52:	ff 75 10             	push   0x10(%ebp)
+  802d55:	ff 75 0c             	push   0xc(%ebp)
+  802d58:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d5b:	ff 70 0c             	push   0xc(%eax)
+  802d5e:	e8 79 03 00 00       	call   8030dc <nsipc_send>
+}
+  802d63:	c9                   	leave
+  802d64:	c3                   	ret
+
+00802d65 <devsock_read>:
+{
+  802d65:	55                   	push   %ebp
+  802d66:	89 e5                	mov    %esp,%ebp
+  802d68:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802d6b:	6a 00                	push   $0x0
+  802d6d:	ff 75 10             	push   0x10(%ebp)
+  802d70:	ff 75 0c             	push   0xc(%ebp)
+  802d73:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d76:	ff 70 0c             	push   0xc(%eax)
+  802d79:	e8 ef 02 00 00       	call   80306d <nsipc_recv>
+}
+  802d7e:	c9                   	leave
+  802d7f:	c3                   	ret
+
+00802d80 <fd2sockid>:
+{
+  802d80:	55                   	push   %ebp
+  802d81:	89 e5                	mov    %esp,%ebp
+  802d83:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802d86:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802d89:	52                   	push   %edx
+  802d8a:	50                   	push   %eax
+  802d8b:	e8 12 e9 ff ff       	call   8016a2 <fd_lookup>
+  802d90:	83 c4 10             	add    $0x10,%esp
+  802d93:	85 c0                	test   %eax,%eax
+  802d95:	78 10                	js     802da7 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802d97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d9a:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802da0:	39 08                	cmp    %ecx,(%eax)
+  802da2:	75 05                	jne    802da9 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802da4:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802da7:	c9                   	leave
+  802da8:	c3                   	ret
+		return -E_NOT_SUPP;
+  802da9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802dae:	eb f7                	jmp    802da7 <fd2sockid+0x27>
+
+00802db0 <alloc_sockfd>:
+{
+  802db0:	55                   	push   %ebp
+  802db1:	89 e5                	mov    %esp,%ebp
+  802db3:	56                   	push   %esi
+  802db4:	53                   	push   %ebx
+  802db5:	83 ec 1c             	sub    $0x1c,%esp
+  802db8:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802dba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dbd:	50                   	push   %eax
+  802dbe:	e8 89 e8 ff ff       	call   80164c <fd_alloc>
+  802dc3:	89 c3                	mov    %eax,%ebx
+  802dc5:	83 c4 10             	add    $0x10,%esp
+  802dc8:	85 c0                	test   %eax,%eax
+  802dca:	78 43                	js     802e0f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802dcc:	83 ec 04             	sub    $0x4,%esp
+  802dcf:	68 07 04 00 00       	push   $0x407
+  802dd4:	ff 75 f4             	push   -0xc(%ebp)
+  802dd7:	6a 00                	push   $0x0
+  802dd9:	e8 4e df ff ff       	call   800d2c <sys_page_alloc>
+  802dde:	89 c3                	mov    %eax,%ebx
+  802de0:	83 c4 10             	add    $0x10,%esp
+  802de3:	85 c0                	test   %eax,%eax
+  802de5:	78 28                	js     802e0f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802de7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dea:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802df0:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802df2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802df5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802dfc:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802dff:	83 ec 0c             	sub    $0xc,%esp
+  802e02:	50                   	push   %eax
+  802e03:	e8 1d e8 ff ff       	call   801625 <fd2num>
+  802e08:	89 c3                	mov    %eax,%ebx
+  802e0a:	83 c4 10             	add    $0x10,%esp
+  802e0d:	eb 0c                	jmp    802e1b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802e0f:	83 ec 0c             	sub    $0xc,%esp
+  802e12:	56                   	push   %esi
+  802e13:	e8 e4 01 00 00       	call   802ffc <nsipc_close>
+		return r;
+  802e18:	83 c4 10             	add    $0x10,%esp
+}
+  802e1b:	89 d8                	mov    %ebx,%eax
+  802e1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e20:	5b                   	pop    %ebx
+  802e21:	5e                   	pop    %esi
+  802e22:	5d                   	pop    %ebp
+  802e23:	c3                   	ret
+
+00802e24 <accept>:
+{
+  802e24:	55                   	push   %ebp
+  802e25:	89 e5                	mov    %esp,%ebp
+  802e27:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e2d:	e8 4e ff ff ff       	call   802d80 <fd2sockid>
+  802e32:	85 c0                	test   %eax,%eax
+  802e34:	78 1b                	js     802e51 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802e36:	83 ec 04             	sub    $0x4,%esp
+  802e39:	ff 75 10             	push   0x10(%ebp)
+  802e3c:	ff 75 0c             	push   0xc(%ebp)
+  802e3f:	50                   	push   %eax
+  802e40:	e8 0e 01 00 00       	call   802f53 <nsipc_accept>
+  802e45:	83 c4 10             	add    $0x10,%esp
+  802e48:	85 c0                	test   %eax,%eax
+  802e4a:	78 05                	js     802e51 <accept+0x2d>
+	return alloc_sockfd(r);
+  802e4c:	e8 5f ff ff ff       	call   802db0 <alloc_sockfd>
+}
+  802e51:	c9                   	leave
+  802e52:	c3                   	ret
+
+00802e53 <bind>:
+{
+  802e53:	55                   	push   %ebp
+  802e54:	89 e5                	mov    %esp,%ebp
+  802e56:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e59:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e5c:	e8 1f ff ff ff       	call   802d80 <fd2sockid>
+  802e61:	85 c0                	test   %eax,%eax
+  802e63:	78 12                	js     802e77 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802e65:	83 ec 04             	sub    $0x4,%esp
+  802e68:	ff 75 10             	push   0x10(%ebp)
+  802e6b:	ff 75 0c             	push   0xc(%ebp)
+  802e6e:	50                   	push   %eax
+  802e6f:	e8 31 01 00 00       	call   802fa5 <nsipc_bind>
+  802e74:	83 c4 10             	add    $0x10,%esp
+}
+  802e77:	c9                   	leave
+  802e78:	c3                   	ret
+
+00802e79 <shutdown>:
+{
+  802e79:	55                   	push   %ebp
+  802e7a:	89 e5                	mov    %esp,%ebp
+  802e7c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e82:	e8 f9 fe ff ff       	call   802d80 <fd2sockid>
+  802e87:	85 c0                	test   %eax,%eax
+  802e89:	78 0f                	js     802e9a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802e8b:	83 ec 08             	sub    $0x8,%esp
+  802e8e:	ff 75 0c             	push   0xc(%ebp)
+  802e91:	50                   	push   %eax
+  802e92:	e8 43 01 00 00       	call   802fda <nsipc_shutdown>
+  802e97:	83 c4 10             	add    $0x10,%esp
+}
+  802e9a:	c9                   	leave
+  802e9b:	c3                   	ret
+
+00802e9c <connect>:
+{
+  802e9c:	55                   	push   %ebp
+  802e9d:	89 e5                	mov    %esp,%ebp
+  802e9f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ea2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ea5:	e8 d6 fe ff ff       	call   802d80 <fd2sockid>
+  802eaa:	85 c0                	test   %eax,%eax
+  802eac:	78 12                	js     802ec0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802eae:	83 ec 04             	sub    $0x4,%esp
+  802eb1:	ff 75 10             	push   0x10(%ebp)
+  802eb4:	ff 75 0c             	push   0xc(%ebp)
+  802eb7:	50                   	push   %eax
+  802eb8:	e8 59 01 00 00       	call   803016 <nsipc_connect>
+  802ebd:	83 c4 10             	add    $0x10,%esp
+}
+  802ec0:	c9                   	leave
+  802ec1:	c3                   	ret
+
+00802ec2 <listen>:
+{
+  802ec2:	55                   	push   %ebp
+  802ec3:	89 e5                	mov    %esp,%ebp
+  802ec5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ec8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ecb:	e8 b0 fe ff ff       	call   802d80 <fd2sockid>
+  802ed0:	85 c0                	test   %eax,%eax
+  802ed2:	78 0f                	js     802ee3 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802ed4:	83 ec 08             	sub    $0x8,%esp
+  802ed7:	ff 75 0c             	push   0xc(%ebp)
+  802eda:	50                   	push   %eax
+  802edb:	e8 6b 01 00 00       	call   80304b <nsipc_listen>
+  802ee0:	83 c4 10             	add    $0x10,%esp
+}
+  802ee3:	c9                   	leave
+  802ee4:	c3                   	ret
+
+00802ee5 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802ee5:	55                   	push   %ebp
+  802ee6:	89 e5                	mov    %esp,%ebp
+  802ee8:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802eeb:	ff 75 10             	push   0x10(%ebp)
+  802eee:	ff 75 0c             	push   0xc(%ebp)
+  802ef1:	ff 75 08             	push   0x8(%ebp)
+  802ef4:	e8 41 02 00 00       	call   80313a <nsipc_socket>
+  802ef9:	83 c4 10             	add    $0x10,%esp
+  802efc:	85 c0                	test   %eax,%eax
+  802efe:	78 05                	js     802f05 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802f00:	e8 ab fe ff ff       	call   802db0 <alloc_sockfd>
+}
+  802f05:	c9                   	leave
+  802f06:	c3                   	ret
+
+00802f07 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802f07:	55                   	push   %ebp
+  802f08:	89 e5                	mov    %esp,%ebp
+  802f0a:	53                   	push   %ebx
+  802f0b:	83 ec 04             	sub    $0x4,%esp
+  802f0e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802f10:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  802f17:	74 26                	je     802f3f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802f19:	6a 07                	push   $0x7
+  802f1b:	68 00 90 80 00       	push   $0x809000
+  802f20:	53                   	push   %ebx
+  802f21:	ff 35 00 a0 80 00    	push   0x80a000
+  802f27:	e8 81 e5 ff ff       	call   8014ad <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802f2c:	83 c4 0c             	add    $0xc,%esp
+  802f2f:	6a 00                	push   $0x0
+  802f31:	6a 00                	push   $0x0
+  802f33:	6a 00                	push   $0x0
+  802f35:	e8 08 e5 ff ff       	call   801442 <ipc_recv>
+}
+  802f3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f3d:	c9                   	leave
+  802f3e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802f3f:	83 ec 0c             	sub    $0xc,%esp
+  802f42:	6a 02                	push   $0x2
+  802f44:	e8 9d e6 ff ff       	call   8015e6 <ipc_find_env>
+  802f49:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  802f4e:	83 c4 10             	add    $0x10,%esp
+  802f51:	eb c6                	jmp    802f19 <nsipc+0x12>
+
+00802f53 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802f53:	55                   	push   %ebp
+  802f54:	89 e5                	mov    %esp,%ebp
+  802f56:	56                   	push   %esi
+  802f57:	53                   	push   %ebx
+  802f58:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802f5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f5e:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802f63:	8b 06                	mov    (%esi),%eax
+  802f65:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802f6a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f6f:	e8 93 ff ff ff       	call   802f07 <nsipc>
+  802f74:	89 c3                	mov    %eax,%ebx
+  802f76:	85 c0                	test   %eax,%eax
+  802f78:	79 09                	jns    802f83 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802f7a:	89 d8                	mov    %ebx,%eax
+  802f7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f7f:	5b                   	pop    %ebx
+  802f80:	5e                   	pop    %esi
+  802f81:	5d                   	pop    %ebp
+  802f82:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802f83:	83 ec 04             	sub    $0x4,%esp
+  802f86:	ff 35 10 90 80 00    	push   0x809010
+  802f8c:	68 00 90 80 00       	push   $0x809000
+  802f91:	ff 75 0c             	push   0xc(%ebp)
+  802f94:	e8 0d db ff ff       	call   800aa6 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802f99:	a1 10 90 80 00       	mov    0x809010,%eax
+  802f9e:	89 06                	mov    %eax,(%esi)
+  802fa0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802fa3:	eb d5                	jmp    802f7a <nsipc_accept+0x27>
+
+00802fa5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802fa5:	55                   	push   %ebp
+  802fa6:	89 e5                	mov    %esp,%ebp
+  802fa8:	53                   	push   %ebx
+  802fa9:	83 ec 08             	sub    $0x8,%esp
+  802fac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802faf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fb2:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802fb7:	53                   	push   %ebx
+  802fb8:	ff 75 0c             	push   0xc(%ebp)
+  802fbb:	68 04 90 80 00       	push   $0x809004
+  802fc0:	e8 e1 da ff ff       	call   800aa6 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802fc5:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802fcb:	b8 02 00 00 00       	mov    $0x2,%eax
+  802fd0:	e8 32 ff ff ff       	call   802f07 <nsipc>
+}
+  802fd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fd8:	c9                   	leave
+  802fd9:	c3                   	ret
+
+00802fda <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802fda:	55                   	push   %ebp
+  802fdb:	89 e5                	mov    %esp,%ebp
+  802fdd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802fe0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fe3:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802fe8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802feb:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802ff0:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ff5:	e8 0d ff ff ff       	call   802f07 <nsipc>
+}
+  802ffa:	c9                   	leave
+  802ffb:	c3                   	ret
+
+00802ffc <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802ffc:	55                   	push   %ebp
+  802ffd:	89 e5                	mov    %esp,%ebp
+  802fff:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803002:	8b 45 08             	mov    0x8(%ebp),%eax
+  803005:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  80300a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80300f:	e8 f3 fe ff ff       	call   802f07 <nsipc>
+}
+  803014:	c9                   	leave
+  803015:	c3                   	ret
+
+00803016 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803016:	55                   	push   %ebp
+  803017:	89 e5                	mov    %esp,%ebp
+  803019:	53                   	push   %ebx
+  80301a:	83 ec 08             	sub    $0x8,%esp
+  80301d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803020:	8b 45 08             	mov    0x8(%ebp),%eax
+  803023:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803028:	53                   	push   %ebx
+  803029:	ff 75 0c             	push   0xc(%ebp)
+  80302c:	68 04 90 80 00       	push   $0x809004
+  803031:	e8 70 da ff ff       	call   800aa6 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803036:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  80303c:	b8 05 00 00 00       	mov    $0x5,%eax
+  803041:	e8 c1 fe ff ff       	call   802f07 <nsipc>
+}
+  803046:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803049:	c9                   	leave
+  80304a:	c3                   	ret
+
+0080304b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80304b:	55                   	push   %ebp
+  80304c:	89 e5                	mov    %esp,%ebp
+  80304e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803051:	8b 45 08             	mov    0x8(%ebp),%eax
+  803054:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  803059:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80305c:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  803061:	b8 06 00 00 00       	mov    $0x6,%eax
+  803066:	e8 9c fe ff ff       	call   802f07 <nsipc>
+}
+  80306b:	c9                   	leave
+  80306c:	c3                   	ret
+
+0080306d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80306d:	55                   	push   %ebp
+  80306e:	89 e5                	mov    %esp,%ebp
+  803070:	56                   	push   %esi
+  803071:	53                   	push   %ebx
+  803072:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803075:	8b 45 08             	mov    0x8(%ebp),%eax
+  803078:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  80307d:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  803083:	8b 45 14             	mov    0x14(%ebp),%eax
+  803086:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80308b:	b8 07 00 00 00       	mov    $0x7,%eax
+  803090:	e8 72 fe ff ff       	call   802f07 <nsipc>
+  803095:	89 c3                	mov    %eax,%ebx
+  803097:	85 c0                	test   %eax,%eax
+  803099:	78 22                	js     8030bd <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80309b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8030a0:	39 c6                	cmp    %eax,%esi
+  8030a2:	0f 4e c6             	cmovle %esi,%eax
+  8030a5:	39 c3                	cmp    %eax,%ebx
+  8030a7:	7f 1d                	jg     8030c6 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8030a9:	83 ec 04             	sub    $0x4,%esp
+  8030ac:	53                   	push   %ebx
+  8030ad:	68 00 90 80 00       	push   $0x809000
+  8030b2:	ff 75 0c             	push   0xc(%ebp)
+  8030b5:	e8 ec d9 ff ff       	call   800aa6 <memmove>
+  8030ba:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8030bd:	89 d8                	mov    %ebx,%eax
+  8030bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030c2:	5b                   	pop    %ebx
+  8030c3:	5e                   	pop    %esi
+  8030c4:	5d                   	pop    %ebp
+  8030c5:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8030c6:	68 3d 3f 80 00       	push   $0x803f3d
+  8030cb:	68 ec 3d 80 00       	push   $0x803dec
+  8030d0:	6a 62                	push   $0x62
+  8030d2:	68 52 3f 80 00       	push   $0x803f52
+  8030d7:	e8 7b d1 ff ff       	call   800257 <_panic>
+
+008030dc <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8030dc:	55                   	push   %ebp
+  8030dd:	89 e5                	mov    %esp,%ebp
+  8030df:	53                   	push   %ebx
+  8030e0:	83 ec 04             	sub    $0x4,%esp
+  8030e3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8030e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030e9:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  8030ee:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8030f4:	7f 2e                	jg     803124 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8030f6:	83 ec 04             	sub    $0x4,%esp
+  8030f9:	53                   	push   %ebx
+  8030fa:	ff 75 0c             	push   0xc(%ebp)
+  8030fd:	68 0c 90 80 00       	push   $0x80900c
+  803102:	e8 9f d9 ff ff       	call   800aa6 <memmove>
+	nsipcbuf.send.req_size = size;
+  803107:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  80310d:	8b 45 14             	mov    0x14(%ebp),%eax
+  803110:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803115:	b8 08 00 00 00       	mov    $0x8,%eax
+  80311a:	e8 e8 fd ff ff       	call   802f07 <nsipc>
+}
+  80311f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803122:	c9                   	leave
+  803123:	c3                   	ret
+	assert(size < 1600);
+  803124:	68 5e 3f 80 00       	push   $0x803f5e
+  803129:	68 ec 3d 80 00       	push   $0x803dec
+  80312e:	6a 6d                	push   $0x6d
+  803130:	68 52 3f 80 00       	push   $0x803f52
+  803135:	e8 1d d1 ff ff       	call   800257 <_panic>
+
+0080313a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80313a:	55                   	push   %ebp
+  80313b:	89 e5                	mov    %esp,%ebp
+  80313d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803140:	8b 45 08             	mov    0x8(%ebp),%eax
+  803143:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  803148:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80314b:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  803150:	8b 45 10             	mov    0x10(%ebp),%eax
+  803153:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  803158:	b8 09 00 00 00       	mov    $0x9,%eax
+  80315d:	e8 a5 fd ff ff       	call   802f07 <nsipc>
+}
+  803162:	c9                   	leave
+  803163:	c3                   	ret
+
+00803164 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803164:	55                   	push   %ebp
+  803165:	89 e5                	mov    %esp,%ebp
+  803167:	56                   	push   %esi
+  803168:	53                   	push   %ebx
+  803169:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80316c:	83 ec 0c             	sub    $0xc,%esp
+  80316f:	ff 75 08             	push   0x8(%ebp)
+  803172:	e8 be e4 ff ff       	call   801635 <fd2data>
+  803177:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803179:	83 c4 08             	add    $0x8,%esp
+  80317c:	68 6a 3f 80 00       	push   $0x803f6a
+  803181:	53                   	push   %ebx
+  803182:	e8 99 d7 ff ff       	call   800920 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803187:	8b 46 04             	mov    0x4(%esi),%eax
+  80318a:	2b 06                	sub    (%esi),%eax
+  80318c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803192:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803199:	00 00 00 
+	stat->st_dev = &devpipe;
+  80319c:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  8031a3:	50 80 00 
+	return 0;
+}
+  8031a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031ae:	5b                   	pop    %ebx
+  8031af:	5e                   	pop    %esi
+  8031b0:	5d                   	pop    %ebp
+  8031b1:	c3                   	ret
+
+008031b2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8031b2:	55                   	push   %ebp
+  8031b3:	89 e5                	mov    %esp,%ebp
+  8031b5:	53                   	push   %ebx
+  8031b6:	83 ec 0c             	sub    $0xc,%esp
+  8031b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8031bc:	53                   	push   %ebx
+  8031bd:	6a 00                	push   $0x0
+  8031bf:	e8 f5 db ff ff       	call   800db9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8031c4:	89 1c 24             	mov    %ebx,(%esp)
+  8031c7:	e8 69 e4 ff ff       	call   801635 <fd2data>
+  8031cc:	83 c4 08             	add    $0x8,%esp
+  8031cf:	50                   	push   %eax
+  8031d0:	6a 00                	push   $0x0
+  8031d2:	e8 e2 db ff ff       	call   800db9 <sys_page_unmap>
+}
+  8031d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031da:	c9                   	leave
+  8031db:	c3                   	ret
+
+008031dc <_pipeisclosed>:
+{
+  8031dc:	55                   	push   %ebp
+  8031dd:	89 e5                	mov    %esp,%ebp
+  8031df:	57                   	push   %edi
+  8031e0:	56                   	push   %esi
+  8031e1:	53                   	push   %ebx
+  8031e2:	83 ec 1c             	sub    $0x1c,%esp
+  8031e5:	89 c7                	mov    %eax,%edi
+  8031e7:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8031e9:	a1 00 60 80 00       	mov    0x806000,%eax
+  8031ee:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8031f1:	83 ec 0c             	sub    $0xc,%esp
+  8031f4:	57                   	push   %edi
+  8031f5:	e8 c0 fa ff ff       	call   802cba <pageref>
+  8031fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8031fd:	89 34 24             	mov    %esi,(%esp)
+  803200:	e8 b5 fa ff ff       	call   802cba <pageref>
+		nn = thisenv->env_runs;
+  803205:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80320b:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80320e:	83 c4 10             	add    $0x10,%esp
+  803211:	39 cb                	cmp    %ecx,%ebx
+  803213:	74 1b                	je     803230 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  803215:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803218:	75 cf                	jne    8031e9 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80321a:	8b 42 58             	mov    0x58(%edx),%eax
+  80321d:	6a 01                	push   $0x1
+  80321f:	50                   	push   %eax
+  803220:	53                   	push   %ebx
+  803221:	68 71 3f 80 00       	push   $0x803f71
+  803226:	e8 07 d1 ff ff       	call   800332 <cprintf>
+  80322b:	83 c4 10             	add    $0x10,%esp
+  80322e:	eb b9                	jmp    8031e9 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  803230:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803233:	0f 94 c0             	sete   %al
+  803236:	0f b6 c0             	movzbl %al,%eax
+}
+  803239:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80323c:	5b                   	pop    %ebx
+  80323d:	5e                   	pop    %esi
+  80323e:	5f                   	pop    %edi
+  80323f:	5d                   	pop    %ebp
+  803240:	c3                   	ret
+
+00803241 <devpipe_write>:
+{
+  803241:	55                   	push   %ebp
+  803242:	89 e5                	mov    %esp,%ebp
+  803244:	57                   	push   %edi
+  803245:	56                   	push   %esi
+  803246:	53                   	push   %ebx
+  803247:	83 ec 28             	sub    $0x28,%esp
+  80324a:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80324d:	56                   	push   %esi
+  80324e:	e8 e2 e3 ff ff       	call   801635 <fd2data>
+  803253:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803255:	83 c4 10             	add    $0x10,%esp
+  803258:	bf 00 00 00 00       	mov    $0x0,%edi
+  80325d:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803260:	75 09                	jne    80326b <devpipe_write+0x2a>
+	return i;
+  803262:	89 f8                	mov    %edi,%eax
+  803264:	eb 23                	jmp    803289 <devpipe_write+0x48>
+			sys_yield();
+  803266:	e8 a2 da ff ff       	call   800d0d <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80326b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80326e:	8b 0b                	mov    (%ebx),%ecx
+  803270:	8d 51 20             	lea    0x20(%ecx),%edx
+  803273:	39 d0                	cmp    %edx,%eax
+  803275:	72 1a                	jb     803291 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803277:	89 da                	mov    %ebx,%edx
+  803279:	89 f0                	mov    %esi,%eax
+  80327b:	e8 5c ff ff ff       	call   8031dc <_pipeisclosed>
+  803280:	85 c0                	test   %eax,%eax
+  803282:	74 e2                	je     803266 <devpipe_write+0x25>
+				return 0;
+  803284:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803289:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80328c:	5b                   	pop    %ebx
+  80328d:	5e                   	pop    %esi
+  80328e:	5f                   	pop    %edi
+  80328f:	5d                   	pop    %ebp
+  803290:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803291:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803294:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803298:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80329b:	89 c2                	mov    %eax,%edx
+  80329d:	c1 fa 1f             	sar    $0x1f,%edx
+  8032a0:	89 d1                	mov    %edx,%ecx
+  8032a2:	c1 e9 1b             	shr    $0x1b,%ecx
+  8032a5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8032a8:	83 e2 1f             	and    $0x1f,%edx
+  8032ab:	29 ca                	sub    %ecx,%edx
+  8032ad:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8032b1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8032b5:	83 c0 01             	add    $0x1,%eax
+  8032b8:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8032bb:	83 c7 01             	add    $0x1,%edi
+  8032be:	eb 9d                	jmp    80325d <devpipe_write+0x1c>
+
+008032c0 <devpipe_read>:
+{
+  8032c0:	55                   	push   %ebp
+  8032c1:	89 e5                	mov    %esp,%ebp
+  8032c3:	57                   	push   %edi
+  8032c4:	56                   	push   %esi
+  8032c5:	53                   	push   %ebx
+  8032c6:	83 ec 18             	sub    $0x18,%esp
+  8032c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8032cc:	57                   	push   %edi
+  8032cd:	e8 63 e3 ff ff       	call   801635 <fd2data>
+  8032d2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8032d4:	83 c4 10             	add    $0x10,%esp
+  8032d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8032dc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8032df:	75 13                	jne    8032f4 <devpipe_read+0x34>
+	return i;
+  8032e1:	89 f0                	mov    %esi,%eax
+  8032e3:	eb 02                	jmp    8032e7 <devpipe_read+0x27>
+				return i;
+  8032e5:	89 f0                	mov    %esi,%eax
+}
+  8032e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032ea:	5b                   	pop    %ebx
+  8032eb:	5e                   	pop    %esi
+  8032ec:	5f                   	pop    %edi
+  8032ed:	5d                   	pop    %ebp
+  8032ee:	c3                   	ret
+			sys_yield();
+  8032ef:	e8 19 da ff ff       	call   800d0d <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8032f4:	8b 03                	mov    (%ebx),%eax
+  8032f6:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8032f9:	75 18                	jne    803313 <devpipe_read+0x53>
+			if (i > 0)
+  8032fb:	85 f6                	test   %esi,%esi
+  8032fd:	75 e6                	jne    8032e5 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8032ff:	89 da                	mov    %ebx,%edx
+  803301:	89 f8                	mov    %edi,%eax
+  803303:	e8 d4 fe ff ff       	call   8031dc <_pipeisclosed>
+  803308:	85 c0                	test   %eax,%eax
+  80330a:	74 e3                	je     8032ef <devpipe_read+0x2f>
+				return 0;
+  80330c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803311:	eb d4                	jmp    8032e7 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803313:	99                   	cltd
+  803314:	c1 ea 1b             	shr    $0x1b,%edx
+  803317:	01 d0                	add    %edx,%eax
+  803319:	83 e0 1f             	and    $0x1f,%eax
+  80331c:	29 d0                	sub    %edx,%eax
+  80331e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803323:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803326:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803329:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80332c:	83 c6 01             	add    $0x1,%esi
+  80332f:	eb ab                	jmp    8032dc <devpipe_read+0x1c>
+
+00803331 <pipe>:
+{
+  803331:	55                   	push   %ebp
+  803332:	89 e5                	mov    %esp,%ebp
+  803334:	56                   	push   %esi
+  803335:	53                   	push   %ebx
+  803336:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803339:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80333c:	50                   	push   %eax
+  80333d:	e8 0a e3 ff ff       	call   80164c <fd_alloc>
+  803342:	89 c3                	mov    %eax,%ebx
+  803344:	83 c4 10             	add    $0x10,%esp
+  803347:	85 c0                	test   %eax,%eax
+  803349:	0f 88 23 01 00 00    	js     803472 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80334f:	83 ec 04             	sub    $0x4,%esp
+  803352:	68 07 04 00 00       	push   $0x407
+  803357:	ff 75 f4             	push   -0xc(%ebp)
+  80335a:	6a 00                	push   $0x0
+  80335c:	e8 cb d9 ff ff       	call   800d2c <sys_page_alloc>
+  803361:	89 c3                	mov    %eax,%ebx
+  803363:	83 c4 10             	add    $0x10,%esp
+  803366:	85 c0                	test   %eax,%eax
+  803368:	0f 88 04 01 00 00    	js     803472 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80336e:	83 ec 0c             	sub    $0xc,%esp
+  803371:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803374:	50                   	push   %eax
+  803375:	e8 d2 e2 ff ff       	call   80164c <fd_alloc>
+  80337a:	89 c3                	mov    %eax,%ebx
+  80337c:	83 c4 10             	add    $0x10,%esp
+  80337f:	85 c0                	test   %eax,%eax
+  803381:	0f 88 db 00 00 00    	js     803462 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803387:	83 ec 04             	sub    $0x4,%esp
+  80338a:	68 07 04 00 00       	push   $0x407
+  80338f:	ff 75 f0             	push   -0x10(%ebp)
+  803392:	6a 00                	push   $0x0
+  803394:	e8 93 d9 ff ff       	call   800d2c <sys_page_alloc>
+  803399:	89 c3                	mov    %eax,%ebx
+  80339b:	83 c4 10             	add    $0x10,%esp
+  80339e:	85 c0                	test   %eax,%eax
+  8033a0:	0f 88 bc 00 00 00    	js     803462 <pipe+0x131>
+	va = fd2data(fd0);
+  8033a6:	83 ec 0c             	sub    $0xc,%esp
+  8033a9:	ff 75 f4             	push   -0xc(%ebp)
+  8033ac:	e8 84 e2 ff ff       	call   801635 <fd2data>
+  8033b1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8033b3:	83 c4 0c             	add    $0xc,%esp
+  8033b6:	68 07 04 00 00       	push   $0x407
+  8033bb:	50                   	push   %eax
+  8033bc:	6a 00                	push   $0x0
+  8033be:	e8 69 d9 ff ff       	call   800d2c <sys_page_alloc>
+  8033c3:	89 c3                	mov    %eax,%ebx
+  8033c5:	83 c4 10             	add    $0x10,%esp
+  8033c8:	85 c0                	test   %eax,%eax
+  8033ca:	0f 88 82 00 00 00    	js     803452 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8033d0:	83 ec 0c             	sub    $0xc,%esp
+  8033d3:	ff 75 f0             	push   -0x10(%ebp)
+  8033d6:	e8 5a e2 ff ff       	call   801635 <fd2data>
+  8033db:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8033e2:	50                   	push   %eax
+  8033e3:	6a 00                	push   $0x0
+  8033e5:	56                   	push   %esi
+  8033e6:	6a 00                	push   $0x0
+  8033e8:	e8 8a d9 ff ff       	call   800d77 <sys_page_map>
+  8033ed:	89 c3                	mov    %eax,%ebx
+  8033ef:	83 c4 20             	add    $0x20,%esp
+  8033f2:	85 c0                	test   %eax,%eax
+  8033f4:	78 4e                	js     803444 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8033f6:	a1 60 50 80 00       	mov    0x805060,%eax
+  8033fb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8033fe:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803400:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803403:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80340a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80340d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80340f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803412:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803419:	83 ec 0c             	sub    $0xc,%esp
+  80341c:	ff 75 f4             	push   -0xc(%ebp)
+  80341f:	e8 01 e2 ff ff       	call   801625 <fd2num>
+  803424:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803427:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803429:	83 c4 04             	add    $0x4,%esp
+  80342c:	ff 75 f0             	push   -0x10(%ebp)
+  80342f:	e8 f1 e1 ff ff       	call   801625 <fd2num>
+  803434:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803437:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80343a:	83 c4 10             	add    $0x10,%esp
+  80343d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803442:	eb 2e                	jmp    803472 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803444:	83 ec 08             	sub    $0x8,%esp
+  803447:	56                   	push   %esi
+  803448:	6a 00                	push   $0x0
+  80344a:	e8 6a d9 ff ff       	call   800db9 <sys_page_unmap>
+  80344f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803452:	83 ec 08             	sub    $0x8,%esp
+  803455:	ff 75 f0             	push   -0x10(%ebp)
+  803458:	6a 00                	push   $0x0
+  80345a:	e8 5a d9 ff ff       	call   800db9 <sys_page_unmap>
+  80345f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803462:	83 ec 08             	sub    $0x8,%esp
+  803465:	ff 75 f4             	push   -0xc(%ebp)
+  803468:	6a 00                	push   $0x0
+  80346a:	e8 4a d9 ff ff       	call   800db9 <sys_page_unmap>
+  80346f:	83 c4 10             	add    $0x10,%esp
+}
+  803472:	89 d8                	mov    %ebx,%eax
+  803474:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803477:	5b                   	pop    %ebx
+  803478:	5e                   	pop    %esi
+  803479:	5d                   	pop    %ebp
+  80347a:	c3                   	ret
+
+0080347b <pipeisclosed>:
+{
+  80347b:	55                   	push   %ebp
+  80347c:	89 e5                	mov    %esp,%ebp
+  80347e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803481:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803484:	50                   	push   %eax
+  803485:	ff 75 08             	push   0x8(%ebp)
+  803488:	e8 15 e2 ff ff       	call   8016a2 <fd_lookup>
+  80348d:	83 c4 10             	add    $0x10,%esp
+  803490:	85 c0                	test   %eax,%eax
+  803492:	78 18                	js     8034ac <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803494:	83 ec 0c             	sub    $0xc,%esp
+  803497:	ff 75 f4             	push   -0xc(%ebp)
+  80349a:	e8 96 e1 ff ff       	call   801635 <fd2data>
+  80349f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8034a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034a4:	e8 33 fd ff ff       	call   8031dc <_pipeisclosed>
+  8034a9:	83 c4 10             	add    $0x10,%esp
+}
+  8034ac:	c9                   	leave
+  8034ad:	c3                   	ret
+
+008034ae <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8034ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b3:	c3                   	ret
+
+008034b4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8034b4:	55                   	push   %ebp
+  8034b5:	89 e5                	mov    %esp,%ebp
+  8034b7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8034ba:	68 89 3f 80 00       	push   $0x803f89
+  8034bf:	ff 75 0c             	push   0xc(%ebp)
+  8034c2:	e8 59 d4 ff ff       	call   800920 <strcpy>
+	return 0;
+}
+  8034c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034cc:	c9                   	leave
+  8034cd:	c3                   	ret
+
+008034ce <devcons_write>:
+{
+  8034ce:	55                   	push   %ebp
+  8034cf:	89 e5                	mov    %esp,%ebp
+  8034d1:	57                   	push   %edi
+  8034d2:	56                   	push   %esi
+  8034d3:	53                   	push   %ebx
+  8034d4:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8034da:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8034df:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8034e5:	eb 2e                	jmp    803515 <devcons_write+0x47>
+		m = n - tot;
+  8034e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8034ea:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8034ec:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8034f1:	39 c3                	cmp    %eax,%ebx
+  8034f3:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8034f6:	83 ec 04             	sub    $0x4,%esp
+  8034f9:	53                   	push   %ebx
+  8034fa:	89 f0                	mov    %esi,%eax
+  8034fc:	03 45 0c             	add    0xc(%ebp),%eax
+  8034ff:	50                   	push   %eax
+  803500:	57                   	push   %edi
+  803501:	e8 a0 d5 ff ff       	call   800aa6 <memmove>
+		sys_cputs(buf, m);
+  803506:	83 c4 08             	add    $0x8,%esp
+  803509:	53                   	push   %ebx
+  80350a:	57                   	push   %edi
+  80350b:	e8 40 d7 ff ff       	call   800c50 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803510:	01 de                	add    %ebx,%esi
+  803512:	83 c4 10             	add    $0x10,%esp
+  803515:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803518:	72 cd                	jb     8034e7 <devcons_write+0x19>
+}
+  80351a:	89 f0                	mov    %esi,%eax
+  80351c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80351f:	5b                   	pop    %ebx
+  803520:	5e                   	pop    %esi
+  803521:	5f                   	pop    %edi
+  803522:	5d                   	pop    %ebp
+  803523:	c3                   	ret
+
+00803524 <devcons_read>:
+{
+  803524:	55                   	push   %ebp
+  803525:	89 e5                	mov    %esp,%ebp
+  803527:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80352a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803533:	75 07                	jne    80353c <devcons_read+0x18>
+  803535:	eb 1f                	jmp    803556 <devcons_read+0x32>
+		sys_yield();
+  803537:	e8 d1 d7 ff ff       	call   800d0d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80353c:	e8 35 d7 ff ff       	call   800c76 <sys_cgetc>
+  803541:	85 c0                	test   %eax,%eax
+  803543:	74 f2                	je     803537 <devcons_read+0x13>
+	if (c < 0)
+  803545:	78 0f                	js     803556 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803547:	83 f8 04             	cmp    $0x4,%eax
+  80354a:	74 0c                	je     803558 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80354c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80354f:	88 02                	mov    %al,(%edx)
+	return 1;
+  803551:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803556:	c9                   	leave
+  803557:	c3                   	ret
+		return 0;
+  803558:	b8 00 00 00 00       	mov    $0x0,%eax
+  80355d:	eb f7                	jmp    803556 <devcons_read+0x32>
+
+0080355f <cputchar>:
+{
+  80355f:	55                   	push   %ebp
+  803560:	89 e5                	mov    %esp,%ebp
+  803562:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803565:	8b 45 08             	mov    0x8(%ebp),%eax
+  803568:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80356b:	6a 01                	push   $0x1
+  80356d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803570:	50                   	push   %eax
+  803571:	e8 da d6 ff ff       	call   800c50 <sys_cputs>
+}
+  803576:	83 c4 10             	add    $0x10,%esp
+  803579:	c9                   	leave
+  80357a:	c3                   	ret
+
+0080357b <getchar>:
+{
+  80357b:	55                   	push   %ebp
+  80357c:	89 e5                	mov    %esp,%ebp
+  80357e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803581:	6a 01                	push   $0x1
+  803583:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803586:	50                   	push   %eax
+  803587:	6a 00                	push   $0x0
+  803589:	e8 7a e3 ff ff       	call   801908 <read>
+	if (r < 0)
+  80358e:	83 c4 10             	add    $0x10,%esp
+  803591:	85 c0                	test   %eax,%eax
+  803593:	78 06                	js     80359b <getchar+0x20>
+	if (r < 1)
+  803595:	74 06                	je     80359d <getchar+0x22>
+	return c;
+  803597:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80359b:	c9                   	leave
+  80359c:	c3                   	ret
+		return -E_EOF;
+  80359d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8035a2:	eb f7                	jmp    80359b <getchar+0x20>
+
+008035a4 <iscons>:
+{
+  8035a4:	55                   	push   %ebp
+  8035a5:	89 e5                	mov    %esp,%ebp
+  8035a7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8035aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035ad:	50                   	push   %eax
+  8035ae:	ff 75 08             	push   0x8(%ebp)
+  8035b1:	e8 ec e0 ff ff       	call   8016a2 <fd_lookup>
+  8035b6:	83 c4 10             	add    $0x10,%esp
+  8035b9:	85 c0                	test   %eax,%eax
+  8035bb:	78 11                	js     8035ce <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8035bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035c0:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8035c6:	39 10                	cmp    %edx,(%eax)
+  8035c8:	0f 94 c0             	sete   %al
+  8035cb:	0f b6 c0             	movzbl %al,%eax
+}
+  8035ce:	c9                   	leave
+  8035cf:	c3                   	ret
+
+008035d0 <opencons>:
+{
+  8035d0:	55                   	push   %ebp
+  8035d1:	89 e5                	mov    %esp,%ebp
+  8035d3:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8035d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035d9:	50                   	push   %eax
+  8035da:	e8 6d e0 ff ff       	call   80164c <fd_alloc>
+  8035df:	83 c4 10             	add    $0x10,%esp
+  8035e2:	85 c0                	test   %eax,%eax
+  8035e4:	78 3a                	js     803620 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8035e6:	83 ec 04             	sub    $0x4,%esp
+  8035e9:	68 07 04 00 00       	push   $0x407
+  8035ee:	ff 75 f4             	push   -0xc(%ebp)
+  8035f1:	6a 00                	push   $0x0
+  8035f3:	e8 34 d7 ff ff       	call   800d2c <sys_page_alloc>
+  8035f8:	83 c4 10             	add    $0x10,%esp
+  8035fb:	85 c0                	test   %eax,%eax
+  8035fd:	78 21                	js     803620 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8035ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803602:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803608:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80360a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80360d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803614:	83 ec 0c             	sub    $0xc,%esp
+  803617:	50                   	push   %eax
+  803618:	e8 08 e0 ff ff       	call   801625 <fd2num>
+  80361d:	83 c4 10             	add    $0x10,%esp
+}
+  803620:	c9                   	leave
+  803621:	c3                   	ret
+
+00803622 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803622:	55                   	push   %ebp
+  803623:	89 e5                	mov    %esp,%ebp
+  803625:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803628:	83 3d 04 a0 80 00 00 	cmpl   $0x0,0x80a004
+  80362f:	74 0a                	je     80363b <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803631:	8b 45 08             	mov    0x8(%ebp),%eax
+  803634:	a3 04 a0 80 00       	mov    %eax,0x80a004
+}
+  803639:	c9                   	leave
+  80363a:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80363b:	83 ec 04             	sub    $0x4,%esp
+  80363e:	6a 07                	push   $0x7
+  803640:	68 00 f0 bf ee       	push   $0xeebff000
+  803645:	6a 00                	push   $0x0
+  803647:	e8 e0 d6 ff ff       	call   800d2c <sys_page_alloc>
+  80364c:	83 c4 10             	add    $0x10,%esp
+  80364f:	85 c0                	test   %eax,%eax
+  803651:	75 2c                	jne    80367f <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803653:	83 ec 08             	sub    $0x8,%esp
+  803656:	68 95 36 80 00       	push   $0x803695
+  80365b:	6a 00                	push   $0x0
+  80365d:	e8 35 d8 ff ff       	call   800e97 <sys_env_set_pgfault_upcall>
+  803662:	83 c4 10             	add    $0x10,%esp
+  803665:	85 c0                	test   %eax,%eax
+  803667:	74 c8                	je     803631 <set_pgfault_handler+0xf>
+  803669:	68 e0 3f 80 00       	push   $0x803fe0
+  80366e:	68 ec 3d 80 00       	push   $0x803dec
+  803673:	6a 20                	push   $0x20
+  803675:	68 10 40 80 00       	push   $0x804010
+  80367a:	e8 d8 cb ff ff       	call   800257 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80367f:	68 98 3f 80 00       	push   $0x803f98
+  803684:	68 ec 3d 80 00       	push   $0x803dec
+  803689:	6a 1e                	push   $0x1e
+  80368b:	68 10 40 80 00       	push   $0x804010
+  803690:	e8 c2 cb ff ff       	call   800257 <_panic>
+
+00803695 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803695:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803696:	a1 04 a0 80 00       	mov    0x80a004,%eax
+	call *%eax
+  80369b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80369d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8036a0:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8036a5:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8036aa:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8036ae:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8036b1:	83 c4 08             	add    $0x8,%esp
+	popal
+  8036b4:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8036b5:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8036b8:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8036b9:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8036ba:	c3                   	ret
+
+008036bb <dm>:
+  8036bb:	55                   	push   %ebp
+  8036bc:	57                   	push   %edi
+  8036bd:	56                   	push   %esi
+  8036be:	53                   	push   %ebx
+  8036bf:	83 ec 24             	sub    $0x24,%esp
+  8036c2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8036c6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8036ca:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036ce:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036d2:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8036d6:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8036da:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8036de:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8036e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036ed:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8036f4:	00 
+  8036f5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8036fc:	00 
+  8036fd:	89 fb                	mov    %edi,%ebx
+  8036ff:	eb 08                	jmp    803709 <dm+0x4e>
+  803701:	83 e9 01             	sub    $0x1,%ecx
+  803704:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803707:	74 68                	je     803771 <dm+0xb6>
+  803709:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80370d:	01 c0                	add    %eax,%eax
+  80370f:	89 c6                	mov    %eax,%esi
+  803711:	89 d7                	mov    %edx,%edi
+  803713:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803717:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80371b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80371e:	d3 ea                	shr    %cl,%edx
+  803720:	f6 c1 20             	test   $0x20,%cl
+  803723:	74 04                	je     803729 <dm+0x6e>
+  803725:	89 d0                	mov    %edx,%eax
+  803727:	31 d2                	xor    %edx,%edx
+  803729:	83 e0 01             	and    $0x1,%eax
+  80372c:	89 04 24             	mov    %eax,(%esp)
+  80372f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803736:	00 
+  803737:	8b 04 24             	mov    (%esp),%eax
+  80373a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80373e:	09 f0                	or     %esi,%eax
+  803740:	09 fa                	or     %edi,%edx
+  803742:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803746:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80374a:	39 f0                	cmp    %esi,%eax
+  80374c:	89 d5                	mov    %edx,%ebp
+  80374e:	19 fd                	sbb    %edi,%ebp
+  803750:	72 af                	jb     803701 <dm+0x46>
+  803752:	29 f0                	sub    %esi,%eax
+  803754:	19 fa                	sbb    %edi,%edx
+  803756:	89 cf                	mov    %ecx,%edi
+  803758:	c1 ef 05             	shr    $0x5,%edi
+  80375b:	83 e7 01             	and    $0x1,%edi
+  80375e:	89 fe                	mov    %edi,%esi
+  803760:	83 f6 01             	xor    $0x1,%esi
+  803763:	d3 e6                	shl    %cl,%esi
+  803765:	d3 e7                	shl    %cl,%edi
+  803767:	09 74 24 18          	or     %esi,0x18(%esp)
+  80376b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80376f:	eb 90                	jmp    803701 <dm+0x46>
+  803771:	85 db                	test   %ebx,%ebx
+  803773:	74 05                	je     80377a <dm+0xbf>
+  803775:	89 03                	mov    %eax,(%ebx)
+  803777:	89 53 04             	mov    %edx,0x4(%ebx)
+  80377a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80377e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803782:	83 c4 24             	add    $0x24,%esp
+  803785:	5b                   	pop    %ebx
+  803786:	5e                   	pop    %esi
+  803787:	5f                   	pop    %edi
+  803788:	5d                   	pop    %ebp
+  803789:	c3                   	ret
+
+0080378a <__udivdi3>:
+  80378a:	83 ec 08             	sub    $0x8,%esp
+  80378d:	6a 00                	push   $0x0
+  80378f:	ff 74 24 1c          	push   0x1c(%esp)
+  803793:	ff 74 24 1c          	push   0x1c(%esp)
+  803797:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80379b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80379f:	e8 17 ff ff ff       	call   8036bb <dm>
+  8037a4:	83 c4 14             	add    $0x14,%esp
+  8037a7:	c3                   	ret
+
+008037a8 <__umoddi3>:
+  8037a8:	83 ec 18             	sub    $0x18,%esp
+  8037ab:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8037af:	50                   	push   %eax
+  8037b0:	ff 74 24 2c          	push   0x2c(%esp)
+  8037b4:	ff 74 24 2c          	push   0x2c(%esp)
+  8037b8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037bc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037c0:	e8 f6 fe ff ff       	call   8036bb <dm>
+  8037c5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8037c9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8037cd:	83 c4 24             	add    $0x24,%esp
+  8037d0:	c3                   	ret
+
+008037d1 <__divdi3>:
+  8037d1:	53                   	push   %ebx
+  8037d2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8037d6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8037da:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8037de:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8037e2:	85 d2                	test   %edx,%edx
+  8037e4:	78 15                	js     8037fb <__divdi3+0x2a>
+  8037e6:	85 db                	test   %ebx,%ebx
+  8037e8:	78 34                	js     80381e <__divdi3+0x4d>
+  8037ea:	83 ec 04             	sub    $0x4,%esp
+  8037ed:	6a 00                	push   $0x0
+  8037ef:	53                   	push   %ebx
+  8037f0:	51                   	push   %ecx
+  8037f1:	e8 c5 fe ff ff       	call   8036bb <dm>
+  8037f6:	83 c4 10             	add    $0x10,%esp
+  8037f9:	eb 21                	jmp    80381c <__divdi3+0x4b>
+  8037fb:	f7 d8                	neg    %eax
+  8037fd:	83 d2 00             	adc    $0x0,%edx
+  803800:	f7 da                	neg    %edx
+  803802:	85 db                	test   %ebx,%ebx
+  803804:	78 30                	js     803836 <__divdi3+0x65>
+  803806:	83 ec 04             	sub    $0x4,%esp
+  803809:	6a 00                	push   $0x0
+  80380b:	53                   	push   %ebx
+  80380c:	51                   	push   %ecx
+  80380d:	e8 a9 fe ff ff       	call   8036bb <dm>
+  803812:	83 c4 10             	add    $0x10,%esp
+  803815:	f7 d8                	neg    %eax
+  803817:	83 d2 00             	adc    $0x0,%edx
+  80381a:	f7 da                	neg    %edx
+  80381c:	5b                   	pop    %ebx
+  80381d:	c3                   	ret
+  80381e:	83 ec 04             	sub    $0x4,%esp
+  803821:	6a 00                	push   $0x0
+  803823:	f7 d9                	neg    %ecx
+  803825:	83 d3 00             	adc    $0x0,%ebx
+  803828:	f7 db                	neg    %ebx
+  80382a:	53                   	push   %ebx
+  80382b:	51                   	push   %ecx
+  80382c:	e8 8a fe ff ff       	call   8036bb <dm>
+  803831:	83 c4 10             	add    $0x10,%esp
+  803834:	eb df                	jmp    803815 <__divdi3+0x44>
+  803836:	83 ec 04             	sub    $0x4,%esp
+  803839:	6a 00                	push   $0x0
+  80383b:	f7 d9                	neg    %ecx
+  80383d:	83 d3 00             	adc    $0x0,%ebx
+  803840:	f7 db                	neg    %ebx
+  803842:	53                   	push   %ebx
+  803843:	51                   	push   %ecx
+  803844:	e8 72 fe ff ff       	call   8036bb <dm>
+  803849:	83 c4 10             	add    $0x10,%esp
+  80384c:	eb ce                	jmp    80381c <__divdi3+0x4b>
+
+0080384e <__moddi3>:
+  80384e:	55                   	push   %ebp
+  80384f:	57                   	push   %edi
+  803850:	56                   	push   %esi
+  803851:	53                   	push   %ebx
+  803852:	83 ec 24             	sub    $0x24,%esp
+  803855:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803859:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80385d:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803861:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803865:	85 d2                	test   %edx,%edx
+  803867:	78 3b                	js     8038a4 <__moddi3+0x56>
+  803869:	83 ec 04             	sub    $0x4,%esp
+  80386c:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803870:	56                   	push   %esi
+  803871:	89 ce                	mov    %ecx,%esi
+  803873:	f7 de                	neg    %esi
+  803875:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803879:	89 de                	mov    %ebx,%esi
+  80387b:	83 d6 00             	adc    $0x0,%esi
+  80387e:	f7 de                	neg    %esi
+  803880:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803884:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803888:	0f 48 f1             	cmovs  %ecx,%esi
+  80388b:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803890:	53                   	push   %ebx
+  803891:	56                   	push   %esi
+  803892:	e8 24 fe ff ff       	call   8036bb <dm>
+  803897:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80389b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80389f:	83 c4 10             	add    $0x10,%esp
+  8038a2:	eb 47                	jmp    8038eb <__moddi3+0x9d>
+  8038a4:	f7 d8                	neg    %eax
+  8038a6:	83 d2 00             	adc    $0x0,%edx
+  8038a9:	f7 da                	neg    %edx
+  8038ab:	83 ec 04             	sub    $0x4,%esp
+  8038ae:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8038b2:	56                   	push   %esi
+  8038b3:	89 cf                	mov    %ecx,%edi
+  8038b5:	f7 df                	neg    %edi
+  8038b7:	89 de                	mov    %ebx,%esi
+  8038b9:	83 d6 00             	adc    $0x0,%esi
+  8038bc:	f7 de                	neg    %esi
+  8038be:	0f 49 cf             	cmovns %edi,%ecx
+  8038c1:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8038c5:	0f 49 de             	cmovns %esi,%ebx
+  8038c8:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8038cc:	ff 74 24 0c          	push   0xc(%esp)
+  8038d0:	ff 74 24 0c          	push   0xc(%esp)
+  8038d4:	e8 e2 fd ff ff       	call   8036bb <dm>
+  8038d9:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8038dd:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038e1:	f7 d8                	neg    %eax
+  8038e3:	83 d2 00             	adc    $0x0,%edx
+  8038e6:	f7 da                	neg    %edx
+  8038e8:	83 c4 10             	add    $0x10,%esp
+  8038eb:	83 c4 24             	add    $0x24,%esp
+  8038ee:	5b                   	pop    %ebx
+  8038ef:	5e                   	pop    %esi
+  8038f0:	5f                   	pop    %edi
+  8038f1:	5d                   	pop    %ebp
+  8038f2:	c3                   	ret
@@ -0,0 +1,7788 @@
+
+obj/user/testpiperace2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a2 01 00 00       	call   8001d3 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 28             	sub    $0x28,%esp
+	int p[2], r, i;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for pipeisclosed race...\n");
+  80003c:	68 e0 38 80 00       	push   $0x8038e0
+  800041:	e8 cb 02 00 00       	call   800311 <cprintf>
+	if ((r = pipe(p)) < 0)
+  800046:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800049:	89 04 24             	mov    %eax,(%esp)
+  80004c:	e8 9a 30 00 00       	call   8030eb <pipe>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	85 c0                	test   %eax,%eax
+  800056:	78 5e                	js     8000b6 <umain+0x83>
+		panic("pipe: %e", r);
+	if ((r = fork()) < 0)
+  800058:	e8 09 12 00 00       	call   801266 <fork>
+  80005d:	89 c7                	mov    %eax,%edi
+  80005f:	85 c0                	test   %eax,%eax
+  800061:	78 65                	js     8000c8 <umain+0x95>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800063:	74 75                	je     8000da <umain+0xa7>
+	// pageref(p[0]) and gets 3, then it will return true when
+	// it shouldn't.
+	//
+	// So either way, pipeisclosed is going give a wrong answer.
+	//
+	kid = &envs[ENVX(r)];
+  800065:	89 fb                	mov    %edi,%ebx
+  800067:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (kid->env_status == ENV_RUNNABLE)
+  80006d:	69 db 8c 00 00 00    	imul   $0x8c,%ebx,%ebx
+  800073:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  800079:	8b 43 54             	mov    0x54(%ebx),%eax
+  80007c:	83 f8 02             	cmp    $0x2,%eax
+  80007f:	0f 85 d1 00 00 00    	jne    800156 <umain+0x123>
+		if (pipeisclosed(p[0]) != 0) {
+  800085:	83 ec 0c             	sub    $0xc,%esp
+  800088:	ff 75 e0             	push   -0x20(%ebp)
+  80008b:	e8 a5 31 00 00       	call   803235 <pipeisclosed>
+  800090:	83 c4 10             	add    $0x10,%esp
+  800093:	85 c0                	test   %eax,%eax
+  800095:	74 e2                	je     800079 <umain+0x46>
+			cprintf("\nRACE: pipe appears closed\n");
+  800097:	83 ec 0c             	sub    $0xc,%esp
+  80009a:	68 59 39 80 00       	push   $0x803959
+  80009f:	e8 6d 02 00 00       	call   800311 <cprintf>
+			sys_env_destroy(r);
+  8000a4:	89 3c 24             	mov    %edi,(%esp)
+  8000a7:	e8 d0 0b 00 00       	call   800c7c <sys_env_destroy>
+			exit();
+  8000ac:	e8 6b 01 00 00       	call   80021c <exit>
+  8000b1:	83 c4 10             	add    $0x10,%esp
+  8000b4:	eb c3                	jmp    800079 <umain+0x46>
+		panic("pipe: %e", r);
+  8000b6:	50                   	push   %eax
+  8000b7:	68 2e 39 80 00       	push   $0x80392e
+  8000bc:	6a 0d                	push   $0xd
+  8000be:	68 37 39 80 00       	push   $0x803937
+  8000c3:	e8 6e 01 00 00       	call   800236 <_panic>
+		panic("fork: %e", r);
+  8000c8:	50                   	push   %eax
+  8000c9:	68 4c 39 80 00       	push   $0x80394c
+  8000ce:	6a 0f                	push   $0xf
+  8000d0:	68 37 39 80 00       	push   $0x803937
+  8000d5:	e8 5c 01 00 00       	call   800236 <_panic>
+		close(p[1]);
+  8000da:	83 ec 0c             	sub    $0xc,%esp
+  8000dd:	ff 75 e4             	push   -0x1c(%ebp)
+  8000e0:	e8 e3 14 00 00       	call   8015c8 <close>
+  8000e5:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < 200; i++) {
+  8000e8:	89 fb                	mov    %edi,%ebx
+			if (i % 10 == 0)
+  8000ea:	be 67 66 66 66       	mov    $0x66666667,%esi
+  8000ef:	eb 31                	jmp    800122 <umain+0xef>
+			dup(p[0], 10);
+  8000f1:	83 ec 08             	sub    $0x8,%esp
+  8000f4:	6a 0a                	push   $0xa
+  8000f6:	ff 75 e0             	push   -0x20(%ebp)
+  8000f9:	e8 1c 15 00 00       	call   80161a <dup>
+			sys_yield();
+  8000fe:	e8 e9 0b 00 00       	call   800cec <sys_yield>
+			close(10);
+  800103:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+  80010a:	e8 b9 14 00 00       	call   8015c8 <close>
+			sys_yield();
+  80010f:	e8 d8 0b 00 00       	call   800cec <sys_yield>
+		for (i = 0; i < 200; i++) {
+  800114:	83 c3 01             	add    $0x1,%ebx
+  800117:	83 c4 10             	add    $0x10,%esp
+  80011a:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  800120:	74 2a                	je     80014c <umain+0x119>
+			if (i % 10 == 0)
+  800122:	89 d8                	mov    %ebx,%eax
+  800124:	f7 ee                	imul   %esi
+  800126:	c1 fa 02             	sar    $0x2,%edx
+  800129:	89 d8                	mov    %ebx,%eax
+  80012b:	c1 f8 1f             	sar    $0x1f,%eax
+  80012e:	29 c2                	sub    %eax,%edx
+  800130:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  800133:	01 c0                	add    %eax,%eax
+  800135:	39 c3                	cmp    %eax,%ebx
+  800137:	75 b8                	jne    8000f1 <umain+0xbe>
+				cprintf("%d.", i);
+  800139:	83 ec 08             	sub    $0x8,%esp
+  80013c:	53                   	push   %ebx
+  80013d:	68 55 39 80 00       	push   $0x803955
+  800142:	e8 ca 01 00 00       	call   800311 <cprintf>
+  800147:	83 c4 10             	add    $0x10,%esp
+  80014a:	eb a5                	jmp    8000f1 <umain+0xbe>
+		exit();
+  80014c:	e8 cb 00 00 00       	call   80021c <exit>
+  800151:	e9 0f ff ff ff       	jmp    800065 <umain+0x32>
+		}
+	cprintf("child done with loop\n");
+  800156:	83 ec 0c             	sub    $0xc,%esp
+  800159:	68 75 39 80 00       	push   $0x803975
+  80015e:	e8 ae 01 00 00       	call   800311 <cprintf>
+	if (pipeisclosed(p[0]))
+  800163:	83 c4 04             	add    $0x4,%esp
+  800166:	ff 75 e0             	push   -0x20(%ebp)
+  800169:	e8 c7 30 00 00       	call   803235 <pipeisclosed>
+  80016e:	83 c4 10             	add    $0x10,%esp
+  800171:	85 c0                	test   %eax,%eax
+  800173:	75 38                	jne    8001ad <umain+0x17a>
+		panic("somehow the other end of p[0] got closed!");
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  800175:	83 ec 08             	sub    $0x8,%esp
+  800178:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80017b:	50                   	push   %eax
+  80017c:	ff 75 e0             	push   -0x20(%ebp)
+  80017f:	e8 1a 13 00 00       	call   80149e <fd_lookup>
+  800184:	83 c4 10             	add    $0x10,%esp
+  800187:	85 c0                	test   %eax,%eax
+  800189:	78 36                	js     8001c1 <umain+0x18e>
+		panic("cannot look up p[0]: %e", r);
+	(void) fd2data(fd);
+  80018b:	83 ec 0c             	sub    $0xc,%esp
+  80018e:	ff 75 dc             	push   -0x24(%ebp)
+  800191:	e8 9b 12 00 00       	call   801431 <fd2data>
+	cprintf("race didn't happen\n");
+  800196:	c7 04 24 a3 39 80 00 	movl   $0x8039a3,(%esp)
+  80019d:	e8 6f 01 00 00       	call   800311 <cprintf>
+}
+  8001a2:	83 c4 10             	add    $0x10,%esp
+  8001a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a8:	5b                   	pop    %ebx
+  8001a9:	5e                   	pop    %esi
+  8001aa:	5f                   	pop    %edi
+  8001ab:	5d                   	pop    %ebp
+  8001ac:	c3                   	ret
+		panic("somehow the other end of p[0] got closed!");
+  8001ad:	83 ec 04             	sub    $0x4,%esp
+  8001b0:	68 04 39 80 00       	push   $0x803904
+  8001b5:	6a 40                	push   $0x40
+  8001b7:	68 37 39 80 00       	push   $0x803937
+  8001bc:	e8 75 00 00 00       	call   800236 <_panic>
+		panic("cannot look up p[0]: %e", r);
+  8001c1:	50                   	push   %eax
+  8001c2:	68 8b 39 80 00       	push   $0x80398b
+  8001c7:	6a 42                	push   $0x42
+  8001c9:	68 37 39 80 00       	push   $0x803937
+  8001ce:	e8 63 00 00 00       	call   800236 <_panic>
+
+008001d3 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001d3:	55                   	push   %ebp
+  8001d4:	89 e5                	mov    %esp,%ebp
+  8001d6:	56                   	push   %esi
+  8001d7:	53                   	push   %ebx
+  8001d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001db:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001de:	e8 e2 0a 00 00       	call   800cc5 <sys_getenvid>
+  8001e3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001e8:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8001ee:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001f3:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001f8:	85 db                	test   %ebx,%ebx
+  8001fa:	7e 07                	jle    800203 <libmain+0x30>
+		binaryname = argv[0];
+  8001fc:	8b 06                	mov    (%esi),%eax
+  8001fe:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800203:	83 ec 08             	sub    $0x8,%esp
+  800206:	56                   	push   %esi
+  800207:	53                   	push   %ebx
+  800208:	e8 26 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80020d:	e8 0a 00 00 00       	call   80021c <exit>
+}
+  800212:	83 c4 10             	add    $0x10,%esp
+  800215:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800218:	5b                   	pop    %ebx
+  800219:	5e                   	pop    %esi
+  80021a:	5d                   	pop    %ebp
+  80021b:	c3                   	ret
+
+0080021c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80021c:	55                   	push   %ebp
+  80021d:	89 e5                	mov    %esp,%ebp
+  80021f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800222:	e8 ce 13 00 00       	call   8015f5 <close_all>
+	sys_env_destroy(0);
+  800227:	83 ec 0c             	sub    $0xc,%esp
+  80022a:	6a 00                	push   $0x0
+  80022c:	e8 4b 0a 00 00       	call   800c7c <sys_env_destroy>
+}
+  800231:	83 c4 10             	add    $0x10,%esp
+  800234:	c9                   	leave
+  800235:	c3                   	ret
+
+00800236 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800236:	55                   	push   %ebp
+  800237:	89 e5                	mov    %esp,%ebp
+  800239:	56                   	push   %esi
+  80023a:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80023b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80023e:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800244:	e8 7c 0a 00 00       	call   800cc5 <sys_getenvid>
+  800249:	83 ec 0c             	sub    $0xc,%esp
+  80024c:	ff 75 0c             	push   0xc(%ebp)
+  80024f:	ff 75 08             	push   0x8(%ebp)
+  800252:	56                   	push   %esi
+  800253:	50                   	push   %eax
+  800254:	68 c4 39 80 00       	push   $0x8039c4
+  800259:	e8 b3 00 00 00       	call   800311 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80025e:	83 c4 18             	add    $0x18,%esp
+  800261:	53                   	push   %ebx
+  800262:	ff 75 10             	push   0x10(%ebp)
+  800265:	e8 56 00 00 00       	call   8002c0 <vcprintf>
+	cprintf("\n");
+  80026a:	c7 04 24 22 3f 80 00 	movl   $0x803f22,(%esp)
+  800271:	e8 9b 00 00 00       	call   800311 <cprintf>
+  800276:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800279:	cc                   	int3
+	while (1)
+  80027a:	eb fd                	jmp    800279 <_panic+0x43>
+
+0080027c <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80027c:	55                   	push   %ebp
+  80027d:	89 e5                	mov    %esp,%ebp
+  80027f:	53                   	push   %ebx
+  800280:	83 ec 04             	sub    $0x4,%esp
+  800283:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800286:	8b 13                	mov    (%ebx),%edx
+  800288:	8d 42 01             	lea    0x1(%edx),%eax
+  80028b:	89 03                	mov    %eax,(%ebx)
+  80028d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800290:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800294:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800299:	74 09                	je     8002a4 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80029b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80029f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002a2:	c9                   	leave
+  8002a3:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002a4:	83 ec 08             	sub    $0x8,%esp
+  8002a7:	68 ff 00 00 00       	push   $0xff
+  8002ac:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002af:	50                   	push   %eax
+  8002b0:	e8 7a 09 00 00       	call   800c2f <sys_cputs>
+		b->idx = 0;
+  8002b5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002bb:	83 c4 10             	add    $0x10,%esp
+  8002be:	eb db                	jmp    80029b <putch+0x1f>
+
+008002c0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002c0:	55                   	push   %ebp
+  8002c1:	89 e5                	mov    %esp,%ebp
+  8002c3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002c9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002d0:	00 00 00 
+	b.cnt = 0;
+  8002d3:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002da:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002dd:	ff 75 0c             	push   0xc(%ebp)
+  8002e0:	ff 75 08             	push   0x8(%ebp)
+  8002e3:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002e9:	50                   	push   %eax
+  8002ea:	68 7c 02 80 00       	push   $0x80027c
+  8002ef:	e8 14 01 00 00       	call   800408 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002f4:	83 c4 08             	add    $0x8,%esp
+  8002f7:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002fd:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800303:	50                   	push   %eax
+  800304:	e8 26 09 00 00       	call   800c2f <sys_cputs>
+
+	return b.cnt;
+}
+  800309:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80030f:	c9                   	leave
+  800310:	c3                   	ret
+
+00800311 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800311:	55                   	push   %ebp
+  800312:	89 e5                	mov    %esp,%ebp
+  800314:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800317:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80031a:	50                   	push   %eax
+  80031b:	ff 75 08             	push   0x8(%ebp)
+  80031e:	e8 9d ff ff ff       	call   8002c0 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800323:	c9                   	leave
+  800324:	c3                   	ret
+
+00800325 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800325:	55                   	push   %ebp
+  800326:	89 e5                	mov    %esp,%ebp
+  800328:	57                   	push   %edi
+  800329:	56                   	push   %esi
+  80032a:	53                   	push   %ebx
+  80032b:	83 ec 1c             	sub    $0x1c,%esp
+  80032e:	89 c7                	mov    %eax,%edi
+  800330:	89 d6                	mov    %edx,%esi
+  800332:	8b 45 08             	mov    0x8(%ebp),%eax
+  800335:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800338:	89 d1                	mov    %edx,%ecx
+  80033a:	89 c2                	mov    %eax,%edx
+  80033c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80033f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800342:	8b 45 10             	mov    0x10(%ebp),%eax
+  800345:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800348:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80034b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800352:	39 c2                	cmp    %eax,%edx
+  800354:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800357:	72 3e                	jb     800397 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800359:	83 ec 0c             	sub    $0xc,%esp
+  80035c:	ff 75 18             	push   0x18(%ebp)
+  80035f:	83 eb 01             	sub    $0x1,%ebx
+  800362:	53                   	push   %ebx
+  800363:	50                   	push   %eax
+  800364:	83 ec 08             	sub    $0x8,%esp
+  800367:	ff 75 e4             	push   -0x1c(%ebp)
+  80036a:	ff 75 e0             	push   -0x20(%ebp)
+  80036d:	ff 75 dc             	push   -0x24(%ebp)
+  800370:	ff 75 d8             	push   -0x28(%ebp)
+  800373:	e8 f1 33 00 00       	call   803769 <__udivdi3>
+  800378:	83 c4 18             	add    $0x18,%esp
+  80037b:	52                   	push   %edx
+  80037c:	50                   	push   %eax
+  80037d:	89 f2                	mov    %esi,%edx
+  80037f:	89 f8                	mov    %edi,%eax
+  800381:	e8 9f ff ff ff       	call   800325 <printnum>
+  800386:	83 c4 20             	add    $0x20,%esp
+  800389:	eb 13                	jmp    80039e <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80038b:	83 ec 08             	sub    $0x8,%esp
+  80038e:	56                   	push   %esi
+  80038f:	ff 75 18             	push   0x18(%ebp)
+  800392:	ff d7                	call   *%edi
+  800394:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800397:	83 eb 01             	sub    $0x1,%ebx
+  80039a:	85 db                	test   %ebx,%ebx
+  80039c:	7f ed                	jg     80038b <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80039e:	83 ec 08             	sub    $0x8,%esp
+  8003a1:	56                   	push   %esi
+  8003a2:	83 ec 04             	sub    $0x4,%esp
+  8003a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a8:	ff 75 e0             	push   -0x20(%ebp)
+  8003ab:	ff 75 dc             	push   -0x24(%ebp)
+  8003ae:	ff 75 d8             	push   -0x28(%ebp)
+  8003b1:	e8 d1 33 00 00       	call   803787 <__umoddi3>
+  8003b6:	83 c4 14             	add    $0x14,%esp
+  8003b9:	0f be 80 e7 39 80 00 	movsbl 0x8039e7(%eax),%eax
+  8003c0:	50                   	push   %eax
+  8003c1:	ff d7                	call   *%edi
+}
+  8003c3:	83 c4 10             	add    $0x10,%esp
+  8003c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c9:	5b                   	pop    %ebx
+  8003ca:	5e                   	pop    %esi
+  8003cb:	5f                   	pop    %edi
+  8003cc:	5d                   	pop    %ebp
+  8003cd:	c3                   	ret
+
+008003ce <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003ce:	55                   	push   %ebp
+  8003cf:	89 e5                	mov    %esp,%ebp
+  8003d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003d4:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003d8:	8b 10                	mov    (%eax),%edx
+  8003da:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003dd:	73 0a                	jae    8003e9 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003df:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003e2:	89 08                	mov    %ecx,(%eax)
+  8003e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003e7:	88 02                	mov    %al,(%edx)
+}
+  8003e9:	5d                   	pop    %ebp
+  8003ea:	c3                   	ret
+
+008003eb <printfmt>:
+{
+  8003eb:	55                   	push   %ebp
+  8003ec:	89 e5                	mov    %esp,%ebp
+  8003ee:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003f1:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003f4:	50                   	push   %eax
+  8003f5:	ff 75 10             	push   0x10(%ebp)
+  8003f8:	ff 75 0c             	push   0xc(%ebp)
+  8003fb:	ff 75 08             	push   0x8(%ebp)
+  8003fe:	e8 05 00 00 00       	call   800408 <vprintfmt>
+}
+  800403:	83 c4 10             	add    $0x10,%esp
+  800406:	c9                   	leave
+  800407:	c3                   	ret
+
+00800408 <vprintfmt>:
+{
+  800408:	55                   	push   %ebp
+  800409:	89 e5                	mov    %esp,%ebp
+  80040b:	57                   	push   %edi
+  80040c:	56                   	push   %esi
+  80040d:	53                   	push   %ebx
+  80040e:	83 ec 2c             	sub    $0x2c,%esp
+  800411:	8b 75 08             	mov    0x8(%ebp),%esi
+  800414:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800417:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80041a:	eb 0a                	jmp    800426 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80041c:	83 ec 08             	sub    $0x8,%esp
+  80041f:	53                   	push   %ebx
+  800420:	50                   	push   %eax
+  800421:	ff d6                	call   *%esi
+  800423:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800426:	83 c7 01             	add    $0x1,%edi
+  800429:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80042d:	83 f8 25             	cmp    $0x25,%eax
+  800430:	74 0c                	je     80043e <vprintfmt+0x36>
+			if (ch == '\0')
+  800432:	85 c0                	test   %eax,%eax
+  800434:	75 e6                	jne    80041c <vprintfmt+0x14>
+}
+  800436:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800439:	5b                   	pop    %ebx
+  80043a:	5e                   	pop    %esi
+  80043b:	5f                   	pop    %edi
+  80043c:	5d                   	pop    %ebp
+  80043d:	c3                   	ret
+		padc = ' ';
+  80043e:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800442:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800449:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800450:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800457:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80045c:	8d 47 01             	lea    0x1(%edi),%eax
+  80045f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800462:	0f b6 17             	movzbl (%edi),%edx
+  800465:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800468:	3c 55                	cmp    $0x55,%al
+  80046a:	0f 87 cf 03 00 00    	ja     80083f <vprintfmt+0x437>
+  800470:	0f b6 c0             	movzbl %al,%eax
+  800473:	ff 24 85 40 3b 80 00 	jmp    *0x803b40(,%eax,4)
+  80047a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80047d:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800481:	eb d9                	jmp    80045c <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800483:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800486:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80048a:	eb d0                	jmp    80045c <vprintfmt+0x54>
+  80048c:	0f b6 d2             	movzbl %dl,%edx
+  80048f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800492:	b8 00 00 00 00       	mov    $0x0,%eax
+  800497:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80049a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80049d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004a1:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004a4:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004a7:	83 f9 09             	cmp    $0x9,%ecx
+  8004aa:	77 55                	ja     800501 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004ac:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004af:	eb e9                	jmp    80049a <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b4:	8b 00                	mov    (%eax),%eax
+  8004b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8004bf:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004c5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c9:	79 91                	jns    80045c <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004cb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004d1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004d8:	eb 82                	jmp    80045c <vprintfmt+0x54>
+			if (width < 0)
+  8004da:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004dd:	85 d2                	test   %edx,%edx
+  8004df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e4:	0f 49 c2             	cmovns %edx,%eax
+  8004e7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004ed:	e9 6a ff ff ff       	jmp    80045c <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004f2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004f5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004fc:	e9 5b ff ff ff       	jmp    80045c <vprintfmt+0x54>
+  800501:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800504:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800507:	eb bc                	jmp    8004c5 <vprintfmt+0xbd>
+			lflag++;
+  800509:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80050c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80050f:	e9 48 ff ff ff       	jmp    80045c <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800514:	8b 45 14             	mov    0x14(%ebp),%eax
+  800517:	8d 78 04             	lea    0x4(%eax),%edi
+  80051a:	83 ec 08             	sub    $0x8,%esp
+  80051d:	53                   	push   %ebx
+  80051e:	ff 30                	push   (%eax)
+  800520:	ff d6                	call   *%esi
+			break;
+  800522:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800525:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800528:	e9 b1 02 00 00       	jmp    8007de <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  80052d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800530:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800533:	8b 10                	mov    (%eax),%edx
+  800535:	89 d0                	mov    %edx,%eax
+  800537:	f7 d8                	neg    %eax
+  800539:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80053c:	83 f8 11             	cmp    $0x11,%eax
+  80053f:	7f 23                	jg     800564 <vprintfmt+0x15c>
+  800541:	8b 14 85 a0 3c 80 00 	mov    0x803ca0(,%eax,4),%edx
+  800548:	85 d2                	test   %edx,%edx
+  80054a:	74 18                	je     800564 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80054c:	52                   	push   %edx
+  80054d:	68 be 3d 80 00       	push   $0x803dbe
+  800552:	53                   	push   %ebx
+  800553:	56                   	push   %esi
+  800554:	e8 92 fe ff ff       	call   8003eb <printfmt>
+  800559:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80055c:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80055f:	e9 7a 02 00 00       	jmp    8007de <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800564:	50                   	push   %eax
+  800565:	68 ff 39 80 00       	push   $0x8039ff
+  80056a:	53                   	push   %ebx
+  80056b:	56                   	push   %esi
+  80056c:	e8 7a fe ff ff       	call   8003eb <printfmt>
+  800571:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800574:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800577:	e9 62 02 00 00       	jmp    8007de <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80057c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057f:	83 c0 04             	add    $0x4,%eax
+  800582:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800585:	8b 45 14             	mov    0x14(%ebp),%eax
+  800588:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80058a:	85 c9                	test   %ecx,%ecx
+  80058c:	b8 f8 39 80 00       	mov    $0x8039f8,%eax
+  800591:	0f 45 c1             	cmovne %ecx,%eax
+  800594:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800597:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80059b:	7e 06                	jle    8005a3 <vprintfmt+0x19b>
+  80059d:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005a1:	75 0b                	jne    8005ae <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005a3:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005a6:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005a9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005ac:	eb 5c                	jmp    80060a <vprintfmt+0x202>
+  8005ae:	83 ec 08             	sub    $0x8,%esp
+  8005b1:	ff 75 d0             	push   -0x30(%ebp)
+  8005b4:	ff 75 cc             	push   -0x34(%ebp)
+  8005b7:	e8 20 03 00 00       	call   8008dc <strnlen>
+  8005bc:	89 c2                	mov    %eax,%edx
+  8005be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005c1:	29 d0                	sub    %edx,%eax
+  8005c3:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005c6:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005cd:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005d0:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d2:	eb 0e                	jmp    8005e2 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005d4:	83 ec 08             	sub    $0x8,%esp
+  8005d7:	53                   	push   %ebx
+  8005d8:	57                   	push   %edi
+  8005d9:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005dc:	83 ee 01             	sub    $0x1,%esi
+  8005df:	83 c4 10             	add    $0x10,%esp
+  8005e2:	85 f6                	test   %esi,%esi
+  8005e4:	7f ee                	jg     8005d4 <vprintfmt+0x1cc>
+  8005e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ec:	85 c0                	test   %eax,%eax
+  8005ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f3:	0f 49 d0             	cmovns %eax,%edx
+  8005f6:	29 d0                	sub    %edx,%eax
+  8005f8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005fb:	eb a6                	jmp    8005a3 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005fd:	83 ec 08             	sub    $0x8,%esp
+  800600:	53                   	push   %ebx
+  800601:	52                   	push   %edx
+  800602:	ff 55 08             	call   *0x8(%ebp)
+  800605:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800608:	89 f1                	mov    %esi,%ecx
+  80060a:	8d 71 01             	lea    0x1(%ecx),%esi
+  80060d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800611:	0f be d0             	movsbl %al,%edx
+  800614:	85 d2                	test   %edx,%edx
+  800616:	74 28                	je     800640 <vprintfmt+0x238>
+  800618:	85 ff                	test   %edi,%edi
+  80061a:	78 05                	js     800621 <vprintfmt+0x219>
+  80061c:	83 ef 01             	sub    $0x1,%edi
+  80061f:	78 30                	js     800651 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800621:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800625:	74 d6                	je     8005fd <vprintfmt+0x1f5>
+  800627:	0f be c0             	movsbl %al,%eax
+  80062a:	83 e8 20             	sub    $0x20,%eax
+  80062d:	83 f8 5e             	cmp    $0x5e,%eax
+  800630:	76 cb                	jbe    8005fd <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800632:	83 ec 08             	sub    $0x8,%esp
+  800635:	53                   	push   %ebx
+  800636:	6a 3f                	push   $0x3f
+  800638:	ff 55 08             	call   *0x8(%ebp)
+  80063b:	83 c4 10             	add    $0x10,%esp
+  80063e:	eb c8                	jmp    800608 <vprintfmt+0x200>
+  800640:	8b 75 08             	mov    0x8(%ebp),%esi
+  800643:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800646:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800649:	01 d0                	add    %edx,%eax
+  80064b:	29 c8                	sub    %ecx,%eax
+  80064d:	89 c7                	mov    %eax,%edi
+  80064f:	eb 13                	jmp    800664 <vprintfmt+0x25c>
+  800651:	8b 75 08             	mov    0x8(%ebp),%esi
+  800654:	eb ed                	jmp    800643 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800656:	83 ec 08             	sub    $0x8,%esp
+  800659:	53                   	push   %ebx
+  80065a:	6a 20                	push   $0x20
+  80065c:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80065e:	83 ef 01             	sub    $0x1,%edi
+  800661:	83 c4 10             	add    $0x10,%esp
+  800664:	85 ff                	test   %edi,%edi
+  800666:	7f ee                	jg     800656 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800668:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80066b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066e:	e9 6b 01 00 00       	jmp    8007de <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800673:	83 f9 01             	cmp    $0x1,%ecx
+  800676:	7f 1f                	jg     800697 <vprintfmt+0x28f>
+	else if (lflag)
+  800678:	85 c9                	test   %ecx,%ecx
+  80067a:	74 67                	je     8006e3 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80067c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067f:	8b 00                	mov    (%eax),%eax
+  800681:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800684:	89 c1                	mov    %eax,%ecx
+  800686:	c1 f9 1f             	sar    $0x1f,%ecx
+  800689:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80068c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068f:	8d 40 04             	lea    0x4(%eax),%eax
+  800692:	89 45 14             	mov    %eax,0x14(%ebp)
+  800695:	eb 17                	jmp    8006ae <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	8b 50 04             	mov    0x4(%eax),%edx
+  80069d:	8b 00                	mov    (%eax),%eax
+  80069f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006a2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006ae:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006b1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006b4:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006b9:	85 c9                	test   %ecx,%ecx
+  8006bb:	0f 89 03 01 00 00    	jns    8007c4 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8006c1:	83 ec 08             	sub    $0x8,%esp
+  8006c4:	53                   	push   %ebx
+  8006c5:	6a 2d                	push   $0x2d
+  8006c7:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006c9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006cc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006cf:	f7 da                	neg    %edx
+  8006d1:	83 d1 00             	adc    $0x0,%ecx
+  8006d4:	f7 d9                	neg    %ecx
+  8006d6:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006d9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006de:	e9 e1 00 00 00       	jmp    8007c4 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8006e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e6:	8b 00                	mov    (%eax),%eax
+  8006e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006eb:	89 c1                	mov    %eax,%ecx
+  8006ed:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006f0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006fc:	eb b0                	jmp    8006ae <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006fe:	83 f9 01             	cmp    $0x1,%ecx
+  800701:	7f 1e                	jg     800721 <vprintfmt+0x319>
+	else if (lflag)
+  800703:	85 c9                	test   %ecx,%ecx
+  800705:	74 32                	je     800739 <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8b 10                	mov    (%eax),%edx
+  80070c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800711:	8d 40 04             	lea    0x4(%eax),%eax
+  800714:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800717:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80071c:	e9 a3 00 00 00       	jmp    8007c4 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800721:	8b 45 14             	mov    0x14(%ebp),%eax
+  800724:	8b 10                	mov    (%eax),%edx
+  800726:	8b 48 04             	mov    0x4(%eax),%ecx
+  800729:	8d 40 08             	lea    0x8(%eax),%eax
+  80072c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80072f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800734:	e9 8b 00 00 00       	jmp    8007c4 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800739:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073c:	8b 10                	mov    (%eax),%edx
+  80073e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800743:	8d 40 04             	lea    0x4(%eax),%eax
+  800746:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800749:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80074e:	eb 74                	jmp    8007c4 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800750:	83 f9 01             	cmp    $0x1,%ecx
+  800753:	7f 1b                	jg     800770 <vprintfmt+0x368>
+	else if (lflag)
+  800755:	85 c9                	test   %ecx,%ecx
+  800757:	74 2c                	je     800785 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800759:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075c:	8b 10                	mov    (%eax),%edx
+  80075e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800763:	8d 40 04             	lea    0x4(%eax),%eax
+  800766:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800769:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80076e:	eb 54                	jmp    8007c4 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800770:	8b 45 14             	mov    0x14(%ebp),%eax
+  800773:	8b 10                	mov    (%eax),%edx
+  800775:	8b 48 04             	mov    0x4(%eax),%ecx
+  800778:	8d 40 08             	lea    0x8(%eax),%eax
+  80077b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80077e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800783:	eb 3f                	jmp    8007c4 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800785:	8b 45 14             	mov    0x14(%ebp),%eax
+  800788:	8b 10                	mov    (%eax),%edx
+  80078a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80078f:	8d 40 04             	lea    0x4(%eax),%eax
+  800792:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800795:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80079a:	eb 28                	jmp    8007c4 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80079c:	83 ec 08             	sub    $0x8,%esp
+  80079f:	53                   	push   %ebx
+  8007a0:	6a 30                	push   $0x30
+  8007a2:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007a4:	83 c4 08             	add    $0x8,%esp
+  8007a7:	53                   	push   %ebx
+  8007a8:	6a 78                	push   $0x78
+  8007aa:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007af:	8b 10                	mov    (%eax),%edx
+  8007b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007b6:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007bf:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007c4:	83 ec 0c             	sub    $0xc,%esp
+  8007c7:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007cb:	50                   	push   %eax
+  8007cc:	ff 75 e0             	push   -0x20(%ebp)
+  8007cf:	57                   	push   %edi
+  8007d0:	51                   	push   %ecx
+  8007d1:	52                   	push   %edx
+  8007d2:	89 da                	mov    %ebx,%edx
+  8007d4:	89 f0                	mov    %esi,%eax
+  8007d6:	e8 4a fb ff ff       	call   800325 <printnum>
+			break;
+  8007db:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007e1:	e9 40 fc ff ff       	jmp    800426 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007e6:	83 f9 01             	cmp    $0x1,%ecx
+  8007e9:	7f 1b                	jg     800806 <vprintfmt+0x3fe>
+	else if (lflag)
+  8007eb:	85 c9                	test   %ecx,%ecx
+  8007ed:	74 2c                	je     80081b <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8007ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f2:	8b 10                	mov    (%eax),%edx
+  8007f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ff:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800804:	eb be                	jmp    8007c4 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800806:	8b 45 14             	mov    0x14(%ebp),%eax
+  800809:	8b 10                	mov    (%eax),%edx
+  80080b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80080e:	8d 40 08             	lea    0x8(%eax),%eax
+  800811:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800814:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800819:	eb a9                	jmp    8007c4 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80081b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081e:	8b 10                	mov    (%eax),%edx
+  800820:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800825:	8d 40 04             	lea    0x4(%eax),%eax
+  800828:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80082b:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800830:	eb 92                	jmp    8007c4 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800832:	83 ec 08             	sub    $0x8,%esp
+  800835:	53                   	push   %ebx
+  800836:	6a 25                	push   $0x25
+  800838:	ff d6                	call   *%esi
+			break;
+  80083a:	83 c4 10             	add    $0x10,%esp
+  80083d:	eb 9f                	jmp    8007de <vprintfmt+0x3d6>
+			putch('%', putdat);
+  80083f:	83 ec 08             	sub    $0x8,%esp
+  800842:	53                   	push   %ebx
+  800843:	6a 25                	push   $0x25
+  800845:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800847:	83 c4 10             	add    $0x10,%esp
+  80084a:	89 f8                	mov    %edi,%eax
+  80084c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800850:	74 05                	je     800857 <vprintfmt+0x44f>
+  800852:	83 e8 01             	sub    $0x1,%eax
+  800855:	eb f5                	jmp    80084c <vprintfmt+0x444>
+  800857:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80085a:	eb 82                	jmp    8007de <vprintfmt+0x3d6>
+
+0080085c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80085c:	55                   	push   %ebp
+  80085d:	89 e5                	mov    %esp,%ebp
+  80085f:	83 ec 18             	sub    $0x18,%esp
+  800862:	8b 45 08             	mov    0x8(%ebp),%eax
+  800865:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800868:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80086b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80086f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800872:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800879:	85 c0                	test   %eax,%eax
+  80087b:	74 26                	je     8008a3 <vsnprintf+0x47>
+  80087d:	85 d2                	test   %edx,%edx
+  80087f:	7e 22                	jle    8008a3 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800881:	ff 75 14             	push   0x14(%ebp)
+  800884:	ff 75 10             	push   0x10(%ebp)
+  800887:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80088a:	50                   	push   %eax
+  80088b:	68 ce 03 80 00       	push   $0x8003ce
+  800890:	e8 73 fb ff ff       	call   800408 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800895:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800898:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80089b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80089e:	83 c4 10             	add    $0x10,%esp
+}
+  8008a1:	c9                   	leave
+  8008a2:	c3                   	ret
+		return -E_INVAL;
+  8008a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008a8:	eb f7                	jmp    8008a1 <vsnprintf+0x45>
+
+008008aa <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008aa:	55                   	push   %ebp
+  8008ab:	89 e5                	mov    %esp,%ebp
+  8008ad:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008b0:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008b3:	50                   	push   %eax
+  8008b4:	ff 75 10             	push   0x10(%ebp)
+  8008b7:	ff 75 0c             	push   0xc(%ebp)
+  8008ba:	ff 75 08             	push   0x8(%ebp)
+  8008bd:	e8 9a ff ff ff       	call   80085c <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008c2:	c9                   	leave
+  8008c3:	c3                   	ret
+
+008008c4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008c4:	55                   	push   %ebp
+  8008c5:	89 e5                	mov    %esp,%ebp
+  8008c7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cf:	eb 03                	jmp    8008d4 <strlen+0x10>
+		n++;
+  8008d1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008d4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008d8:	75 f7                	jne    8008d1 <strlen+0xd>
+	return n;
+}
+  8008da:	5d                   	pop    %ebp
+  8008db:	c3                   	ret
+
+008008dc <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008dc:	55                   	push   %ebp
+  8008dd:	89 e5                	mov    %esp,%ebp
+  8008df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ea:	eb 03                	jmp    8008ef <strnlen+0x13>
+		n++;
+  8008ec:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008ef:	39 d0                	cmp    %edx,%eax
+  8008f1:	74 08                	je     8008fb <strnlen+0x1f>
+  8008f3:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008f7:	75 f3                	jne    8008ec <strnlen+0x10>
+  8008f9:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008fb:	89 d0                	mov    %edx,%eax
+  8008fd:	5d                   	pop    %ebp
+  8008fe:	c3                   	ret
+
+008008ff <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008ff:	55                   	push   %ebp
+  800900:	89 e5                	mov    %esp,%ebp
+  800902:	53                   	push   %ebx
+  800903:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800906:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800909:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800912:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800915:	83 c0 01             	add    $0x1,%eax
+  800918:	84 d2                	test   %dl,%dl
+  80091a:	75 f2                	jne    80090e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80091c:	89 c8                	mov    %ecx,%eax
+  80091e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800921:	c9                   	leave
+  800922:	c3                   	ret
+
+00800923 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800923:	55                   	push   %ebp
+  800924:	89 e5                	mov    %esp,%ebp
+  800926:	53                   	push   %ebx
+  800927:	83 ec 10             	sub    $0x10,%esp
+  80092a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80092d:	53                   	push   %ebx
+  80092e:	e8 91 ff ff ff       	call   8008c4 <strlen>
+  800933:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800936:	ff 75 0c             	push   0xc(%ebp)
+  800939:	01 d8                	add    %ebx,%eax
+  80093b:	50                   	push   %eax
+  80093c:	e8 be ff ff ff       	call   8008ff <strcpy>
+	return dst;
+}
+  800941:	89 d8                	mov    %ebx,%eax
+  800943:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800946:	c9                   	leave
+  800947:	c3                   	ret
+
+00800948 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800948:	55                   	push   %ebp
+  800949:	89 e5                	mov    %esp,%ebp
+  80094b:	56                   	push   %esi
+  80094c:	53                   	push   %ebx
+  80094d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800950:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800953:	89 f3                	mov    %esi,%ebx
+  800955:	03 5d 10             	add    0x10(%ebp),%ebx
+  800958:	89 f0                	mov    %esi,%eax
+  80095a:	eb 0f                	jmp    80096b <strncpy+0x23>
+		*dst++ = *src;
+  80095c:	83 c0 01             	add    $0x1,%eax
+  80095f:	0f b6 0a             	movzbl (%edx),%ecx
+  800962:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800965:	80 f9 01             	cmp    $0x1,%cl
+  800968:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80096b:	39 d8                	cmp    %ebx,%eax
+  80096d:	75 ed                	jne    80095c <strncpy+0x14>
+	}
+	return ret;
+}
+  80096f:	89 f0                	mov    %esi,%eax
+  800971:	5b                   	pop    %ebx
+  800972:	5e                   	pop    %esi
+  800973:	5d                   	pop    %ebp
+  800974:	c3                   	ret
+
+00800975 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800975:	55                   	push   %ebp
+  800976:	89 e5                	mov    %esp,%ebp
+  800978:	56                   	push   %esi
+  800979:	53                   	push   %ebx
+  80097a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80097d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800980:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800983:	89 f0                	mov    %esi,%eax
+  800985:	85 d2                	test   %edx,%edx
+  800987:	74 21                	je     8009aa <strlcpy+0x35>
+  800989:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80098d:	89 f2                	mov    %esi,%edx
+  80098f:	eb 09                	jmp    80099a <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800991:	83 c1 01             	add    $0x1,%ecx
+  800994:	83 c2 01             	add    $0x1,%edx
+  800997:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80099a:	39 c2                	cmp    %eax,%edx
+  80099c:	74 09                	je     8009a7 <strlcpy+0x32>
+  80099e:	0f b6 19             	movzbl (%ecx),%ebx
+  8009a1:	84 db                	test   %bl,%bl
+  8009a3:	75 ec                	jne    800991 <strlcpy+0x1c>
+  8009a5:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009a7:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009aa:	29 f0                	sub    %esi,%eax
+}
+  8009ac:	5b                   	pop    %ebx
+  8009ad:	5e                   	pop    %esi
+  8009ae:	5d                   	pop    %ebp
+  8009af:	c3                   	ret
+
+008009b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009b0:	55                   	push   %ebp
+  8009b1:	89 e5                	mov    %esp,%ebp
+  8009b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009b9:	eb 06                	jmp    8009c1 <strcmp+0x11>
+		p++, q++;
+  8009bb:	83 c1 01             	add    $0x1,%ecx
+  8009be:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009c1:	0f b6 01             	movzbl (%ecx),%eax
+  8009c4:	84 c0                	test   %al,%al
+  8009c6:	74 04                	je     8009cc <strcmp+0x1c>
+  8009c8:	3a 02                	cmp    (%edx),%al
+  8009ca:	74 ef                	je     8009bb <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009cc:	0f b6 c0             	movzbl %al,%eax
+  8009cf:	0f b6 12             	movzbl (%edx),%edx
+  8009d2:	29 d0                	sub    %edx,%eax
+}
+  8009d4:	5d                   	pop    %ebp
+  8009d5:	c3                   	ret
+
+008009d6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009d6:	55                   	push   %ebp
+  8009d7:	89 e5                	mov    %esp,%ebp
+  8009d9:	53                   	push   %ebx
+  8009da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e0:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009e3:	eb 09                	jmp    8009ee <strncmp+0x18>
+		n--, p++, q++;
+  8009e5:	83 ea 01             	sub    $0x1,%edx
+  8009e8:	83 c0 01             	add    $0x1,%eax
+  8009eb:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009ee:	85 d2                	test   %edx,%edx
+  8009f0:	74 18                	je     800a0a <strncmp+0x34>
+  8009f2:	0f b6 18             	movzbl (%eax),%ebx
+  8009f5:	84 db                	test   %bl,%bl
+  8009f7:	74 04                	je     8009fd <strncmp+0x27>
+  8009f9:	3a 19                	cmp    (%ecx),%bl
+  8009fb:	74 e8                	je     8009e5 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009fd:	0f b6 00             	movzbl (%eax),%eax
+  800a00:	0f b6 11             	movzbl (%ecx),%edx
+  800a03:	29 d0                	sub    %edx,%eax
+}
+  800a05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a08:	c9                   	leave
+  800a09:	c3                   	ret
+		return 0;
+  800a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0f:	eb f4                	jmp    800a05 <strncmp+0x2f>
+
+00800a11 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a11:	55                   	push   %ebp
+  800a12:	89 e5                	mov    %esp,%ebp
+  800a14:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a17:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a1b:	eb 03                	jmp    800a20 <strchr+0xf>
+  800a1d:	83 c0 01             	add    $0x1,%eax
+  800a20:	0f b6 10             	movzbl (%eax),%edx
+  800a23:	84 d2                	test   %dl,%dl
+  800a25:	74 06                	je     800a2d <strchr+0x1c>
+		if (*s == c)
+  800a27:	38 ca                	cmp    %cl,%dl
+  800a29:	75 f2                	jne    800a1d <strchr+0xc>
+  800a2b:	eb 05                	jmp    800a32 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a32:	5d                   	pop    %ebp
+  800a33:	c3                   	ret
+
+00800a34 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a34:	55                   	push   %ebp
+  800a35:	89 e5                	mov    %esp,%ebp
+  800a37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a3e:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a41:	38 ca                	cmp    %cl,%dl
+  800a43:	74 09                	je     800a4e <strfind+0x1a>
+  800a45:	84 d2                	test   %dl,%dl
+  800a47:	74 05                	je     800a4e <strfind+0x1a>
+	for (; *s; s++)
+  800a49:	83 c0 01             	add    $0x1,%eax
+  800a4c:	eb f0                	jmp    800a3e <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a4e:	5d                   	pop    %ebp
+  800a4f:	c3                   	ret
+
+00800a50 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a50:	55                   	push   %ebp
+  800a51:	89 e5                	mov    %esp,%ebp
+  800a53:	57                   	push   %edi
+  800a54:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a57:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a5a:	85 c9                	test   %ecx,%ecx
+  800a5c:	74 20                	je     800a7e <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a5e:	89 f8                	mov    %edi,%eax
+  800a60:	09 c8                	or     %ecx,%eax
+  800a62:	a8 03                	test   $0x3,%al
+  800a64:	75 12                	jne    800a78 <memset+0x28>
+		c &= 0xFF;
+  800a66:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a6a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a70:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a73:	fc                   	cld
+  800a74:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a76:	eb 06                	jmp    800a7e <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a78:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a7b:	fc                   	cld
+  800a7c:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a7e:	89 f8                	mov    %edi,%eax
+  800a80:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a83:	c9                   	leave
+  800a84:	c3                   	ret
+
+00800a85 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a85:	55                   	push   %ebp
+  800a86:	89 e5                	mov    %esp,%ebp
+  800a88:	57                   	push   %edi
+  800a89:	56                   	push   %esi
+  800a8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a90:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a93:	39 c6                	cmp    %eax,%esi
+  800a95:	73 32                	jae    800ac9 <memmove+0x44>
+  800a97:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a9a:	39 d0                	cmp    %edx,%eax
+  800a9c:	73 2b                	jae    800ac9 <memmove+0x44>
+		s += n;
+		d += n;
+  800a9e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aa1:	89 d6                	mov    %edx,%esi
+  800aa3:	09 fe                	or     %edi,%esi
+  800aa5:	09 ce                	or     %ecx,%esi
+  800aa7:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aad:	75 0e                	jne    800abd <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800aaf:	83 ef 04             	sub    $0x4,%edi
+  800ab2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ab5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ab8:	fd                   	std
+  800ab9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800abb:	eb 09                	jmp    800ac6 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800abd:	83 ef 01             	sub    $0x1,%edi
+  800ac0:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ac3:	fd                   	std
+  800ac4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ac6:	fc                   	cld
+  800ac7:	eb 1a                	jmp    800ae3 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ac9:	89 f2                	mov    %esi,%edx
+  800acb:	09 c2                	or     %eax,%edx
+  800acd:	09 ca                	or     %ecx,%edx
+  800acf:	f6 c2 03             	test   $0x3,%dl
+  800ad2:	75 0a                	jne    800ade <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ad4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ad7:	89 c7                	mov    %eax,%edi
+  800ad9:	fc                   	cld
+  800ada:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800adc:	eb 05                	jmp    800ae3 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ade:	89 c7                	mov    %eax,%edi
+  800ae0:	fc                   	cld
+  800ae1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ae3:	5e                   	pop    %esi
+  800ae4:	5f                   	pop    %edi
+  800ae5:	5d                   	pop    %ebp
+  800ae6:	c3                   	ret
+
+00800ae7 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ae7:	55                   	push   %ebp
+  800ae8:	89 e5                	mov    %esp,%ebp
+  800aea:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800aed:	ff 75 10             	push   0x10(%ebp)
+  800af0:	ff 75 0c             	push   0xc(%ebp)
+  800af3:	ff 75 08             	push   0x8(%ebp)
+  800af6:	e8 8a ff ff ff       	call   800a85 <memmove>
+}
+  800afb:	c9                   	leave
+  800afc:	c3                   	ret
+
+00800afd <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800afd:	55                   	push   %ebp
+  800afe:	89 e5                	mov    %esp,%ebp
+  800b00:	56                   	push   %esi
+  800b01:	53                   	push   %ebx
+  800b02:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b05:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b08:	89 c6                	mov    %eax,%esi
+  800b0a:	03 75 10             	add    0x10(%ebp),%esi
+  800b0d:	eb 06                	jmp    800b15 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b0f:	83 c0 01             	add    $0x1,%eax
+  800b12:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b15:	39 f0                	cmp    %esi,%eax
+  800b17:	74 14                	je     800b2d <memcmp+0x30>
+		if (*s1 != *s2)
+  800b19:	0f b6 08             	movzbl (%eax),%ecx
+  800b1c:	0f b6 1a             	movzbl (%edx),%ebx
+  800b1f:	38 d9                	cmp    %bl,%cl
+  800b21:	74 ec                	je     800b0f <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b23:	0f b6 c1             	movzbl %cl,%eax
+  800b26:	0f b6 db             	movzbl %bl,%ebx
+  800b29:	29 d8                	sub    %ebx,%eax
+  800b2b:	eb 05                	jmp    800b32 <memcmp+0x35>
+	}
+
+	return 0;
+  800b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b32:	5b                   	pop    %ebx
+  800b33:	5e                   	pop    %esi
+  800b34:	5d                   	pop    %ebp
+  800b35:	c3                   	ret
+
+00800b36 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b36:	55                   	push   %ebp
+  800b37:	89 e5                	mov    %esp,%ebp
+  800b39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b3f:	89 c2                	mov    %eax,%edx
+  800b41:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b44:	eb 03                	jmp    800b49 <memfind+0x13>
+  800b46:	83 c0 01             	add    $0x1,%eax
+  800b49:	39 d0                	cmp    %edx,%eax
+  800b4b:	73 04                	jae    800b51 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b4d:	38 08                	cmp    %cl,(%eax)
+  800b4f:	75 f5                	jne    800b46 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b51:	5d                   	pop    %ebp
+  800b52:	c3                   	ret
+
+00800b53 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b53:	55                   	push   %ebp
+  800b54:	89 e5                	mov    %esp,%ebp
+  800b56:	57                   	push   %edi
+  800b57:	56                   	push   %esi
+  800b58:	53                   	push   %ebx
+  800b59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b5f:	eb 03                	jmp    800b64 <strtol+0x11>
+		s++;
+  800b61:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b64:	0f b6 02             	movzbl (%edx),%eax
+  800b67:	3c 20                	cmp    $0x20,%al
+  800b69:	74 f6                	je     800b61 <strtol+0xe>
+  800b6b:	3c 09                	cmp    $0x9,%al
+  800b6d:	74 f2                	je     800b61 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b6f:	3c 2b                	cmp    $0x2b,%al
+  800b71:	74 2a                	je     800b9d <strtol+0x4a>
+	int neg = 0;
+  800b73:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b78:	3c 2d                	cmp    $0x2d,%al
+  800b7a:	74 2b                	je     800ba7 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b7c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b82:	75 0f                	jne    800b93 <strtol+0x40>
+  800b84:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b87:	74 28                	je     800bb1 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b89:	85 db                	test   %ebx,%ebx
+  800b8b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b90:	0f 44 d8             	cmove  %eax,%ebx
+  800b93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b98:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b9b:	eb 46                	jmp    800be3 <strtol+0x90>
+		s++;
+  800b9d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ba0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ba5:	eb d5                	jmp    800b7c <strtol+0x29>
+		s++, neg = 1;
+  800ba7:	83 c2 01             	add    $0x1,%edx
+  800baa:	bf 01 00 00 00       	mov    $0x1,%edi
+  800baf:	eb cb                	jmp    800b7c <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bb1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bb5:	74 0e                	je     800bc5 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bb7:	85 db                	test   %ebx,%ebx
+  800bb9:	75 d8                	jne    800b93 <strtol+0x40>
+		s++, base = 8;
+  800bbb:	83 c2 01             	add    $0x1,%edx
+  800bbe:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bc3:	eb ce                	jmp    800b93 <strtol+0x40>
+		s += 2, base = 16;
+  800bc5:	83 c2 02             	add    $0x2,%edx
+  800bc8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bcd:	eb c4                	jmp    800b93 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bcf:	0f be c0             	movsbl %al,%eax
+  800bd2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bd5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bd8:	7d 3a                	jge    800c14 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bda:	83 c2 01             	add    $0x1,%edx
+  800bdd:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800be1:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800be3:	0f b6 02             	movzbl (%edx),%eax
+  800be6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800be9:	89 f3                	mov    %esi,%ebx
+  800beb:	80 fb 09             	cmp    $0x9,%bl
+  800bee:	76 df                	jbe    800bcf <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bf0:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bf3:	89 f3                	mov    %esi,%ebx
+  800bf5:	80 fb 19             	cmp    $0x19,%bl
+  800bf8:	77 08                	ja     800c02 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bfa:	0f be c0             	movsbl %al,%eax
+  800bfd:	83 e8 57             	sub    $0x57,%eax
+  800c00:	eb d3                	jmp    800bd5 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c02:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c05:	89 f3                	mov    %esi,%ebx
+  800c07:	80 fb 19             	cmp    $0x19,%bl
+  800c0a:	77 08                	ja     800c14 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c0c:	0f be c0             	movsbl %al,%eax
+  800c0f:	83 e8 37             	sub    $0x37,%eax
+  800c12:	eb c1                	jmp    800bd5 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c14:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c18:	74 05                	je     800c1f <strtol+0xcc>
+		*endptr = (char *) s;
+  800c1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c1d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c1f:	89 c8                	mov    %ecx,%eax
+  800c21:	f7 d8                	neg    %eax
+  800c23:	85 ff                	test   %edi,%edi
+  800c25:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c28:	89 c8                	mov    %ecx,%eax
+  800c2a:	5b                   	pop    %ebx
+  800c2b:	5e                   	pop    %esi
+  800c2c:	5f                   	pop    %edi
+  800c2d:	5d                   	pop    %ebp
+  800c2e:	c3                   	ret
+
+00800c2f <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c2f:	55                   	push   %ebp
+  800c30:	89 e5                	mov    %esp,%ebp
+  800c32:	57                   	push   %edi
+  800c33:	56                   	push   %esi
+  800c34:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c40:	89 c3                	mov    %eax,%ebx
+  800c42:	89 c7                	mov    %eax,%edi
+  800c44:	55                   	push   %ebp
+  800c45:	89 e5                	mov    %esp,%ebp
+  800c47:	8d 35 4f 0c 80 00    	lea    0x800c4f,%esi
+  800c4d:	0f 34                	sysenter
+  800c4f:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800c50:	5b                   	pop    %ebx
+  800c51:	5e                   	pop    %esi
+  800c52:	5f                   	pop    %edi
+  800c53:	5d                   	pop    %ebp
+  800c54:	c3                   	ret
+
+00800c55 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c55:	55                   	push   %ebp
+  800c56:	89 e5                	mov    %esp,%ebp
+  800c58:	57                   	push   %edi
+  800c59:	56                   	push   %esi
+  800c5a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c60:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c65:	89 d1                	mov    %edx,%ecx
+  800c67:	89 d3                	mov    %edx,%ebx
+  800c69:	89 d7                	mov    %edx,%edi
+  800c6b:	55                   	push   %ebp
+  800c6c:	89 e5                	mov    %esp,%ebp
+  800c6e:	8d 35 76 0c 80 00    	lea    0x800c76,%esi
+  800c74:	0f 34                	sysenter
+  800c76:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800c77:	5b                   	pop    %ebx
+  800c78:	5e                   	pop    %esi
+  800c79:	5f                   	pop    %edi
+  800c7a:	5d                   	pop    %ebp
+  800c7b:	c3                   	ret
+
+00800c7c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c7c:	55                   	push   %ebp
+  800c7d:	89 e5                	mov    %esp,%ebp
+  800c7f:	57                   	push   %edi
+  800c80:	56                   	push   %esi
+  800c81:	53                   	push   %ebx
+  800c82:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c92:	89 cb                	mov    %ecx,%ebx
+  800c94:	89 cf                	mov    %ecx,%edi
+  800c96:	55                   	push   %ebp
+  800c97:	89 e5                	mov    %esp,%ebp
+  800c99:	8d 35 a1 0c 80 00    	lea    0x800ca1,%esi
+  800c9f:	0f 34                	sysenter
+  800ca1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ca2:	85 c0                	test   %eax,%eax
+  800ca4:	7f 08                	jg     800cae <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800ca6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca9:	5b                   	pop    %ebx
+  800caa:	5e                   	pop    %esi
+  800cab:	5f                   	pop    %edi
+  800cac:	5d                   	pop    %ebp
+  800cad:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cae:	83 ec 0c             	sub    $0xc,%esp
+  800cb1:	50                   	push   %eax
+  800cb2:	6a 03                	push   $0x3
+  800cb4:	68 07 3d 80 00       	push   $0x803d07
+  800cb9:	6a 3d                	push   $0x3d
+  800cbb:	68 24 3d 80 00       	push   $0x803d24
+  800cc0:	e8 71 f5 ff ff       	call   800236 <_panic>
+
+00800cc5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cc5:	55                   	push   %ebp
+  800cc6:	89 e5                	mov    %esp,%ebp
+  800cc8:	57                   	push   %edi
+  800cc9:	56                   	push   %esi
+  800cca:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ccb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd0:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cd5:	89 d1                	mov    %edx,%ecx
+  800cd7:	89 d3                	mov    %edx,%ebx
+  800cd9:	89 d7                	mov    %edx,%edi
+  800cdb:	55                   	push   %ebp
+  800cdc:	89 e5                	mov    %esp,%ebp
+  800cde:	8d 35 e6 0c 80 00    	lea    0x800ce6,%esi
+  800ce4:	0f 34                	sysenter
+  800ce6:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800ce7:	5b                   	pop    %ebx
+  800ce8:	5e                   	pop    %esi
+  800ce9:	5f                   	pop    %edi
+  800cea:	5d                   	pop    %ebp
+  800ceb:	c3                   	ret
+
+00800cec <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cec:	55                   	push   %ebp
+  800ced:	89 e5                	mov    %esp,%ebp
+  800cef:	57                   	push   %edi
+  800cf0:	56                   	push   %esi
+  800cf1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cf2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cfc:	89 d1                	mov    %edx,%ecx
+  800cfe:	89 d3                	mov    %edx,%ebx
+  800d00:	89 d7                	mov    %edx,%edi
+  800d02:	89 d6                	mov    %edx,%esi
+  800d04:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d06:	5b                   	pop    %ebx
+  800d07:	5e                   	pop    %esi
+  800d08:	5f                   	pop    %edi
+  800d09:	5d                   	pop    %ebp
+  800d0a:	c3                   	ret
+
+00800d0b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d0b:	55                   	push   %ebp
+  800d0c:	89 e5                	mov    %esp,%ebp
+  800d0e:	57                   	push   %edi
+  800d0f:	56                   	push   %esi
+  800d10:	53                   	push   %ebx
+  800d11:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d27:	55                   	push   %ebp
+  800d28:	89 e5                	mov    %esp,%ebp
+  800d2a:	8d 35 32 0d 80 00    	lea    0x800d32,%esi
+  800d30:	0f 34                	sysenter
+  800d32:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d33:	85 c0                	test   %eax,%eax
+  800d35:	7f 08                	jg     800d3f <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800d37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3a:	5b                   	pop    %ebx
+  800d3b:	5e                   	pop    %esi
+  800d3c:	5f                   	pop    %edi
+  800d3d:	5d                   	pop    %ebp
+  800d3e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d3f:	83 ec 0c             	sub    $0xc,%esp
+  800d42:	50                   	push   %eax
+  800d43:	6a 04                	push   $0x4
+  800d45:	68 07 3d 80 00       	push   $0x803d07
+  800d4a:	6a 3d                	push   $0x3d
+  800d4c:	68 24 3d 80 00       	push   $0x803d24
+  800d51:	e8 e0 f4 ff ff       	call   800236 <_panic>
+
+00800d56 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d56:	55                   	push   %ebp
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	57                   	push   %edi
+  800d5a:	56                   	push   %esi
+  800d5b:	53                   	push   %ebx
+  800d5c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d65:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d6d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d70:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d73:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d75:	85 c0                	test   %eax,%eax
+  800d77:	7f 08                	jg     800d81 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d7c:	5b                   	pop    %ebx
+  800d7d:	5e                   	pop    %esi
+  800d7e:	5f                   	pop    %edi
+  800d7f:	5d                   	pop    %ebp
+  800d80:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d81:	83 ec 0c             	sub    $0xc,%esp
+  800d84:	50                   	push   %eax
+  800d85:	6a 05                	push   $0x5
+  800d87:	68 07 3d 80 00       	push   $0x803d07
+  800d8c:	6a 23                	push   $0x23
+  800d8e:	68 24 3d 80 00       	push   $0x803d24
+  800d93:	e8 9e f4 ff ff       	call   800236 <_panic>
+
+00800d98 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d98:	55                   	push   %ebp
+  800d99:	89 e5                	mov    %esp,%ebp
+  800d9b:	57                   	push   %edi
+  800d9c:	56                   	push   %esi
+  800d9d:	53                   	push   %ebx
+  800d9e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800da1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800da6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dac:	b8 06 00 00 00       	mov    $0x6,%eax
+  800db1:	89 df                	mov    %ebx,%edi
+  800db3:	55                   	push   %ebp
+  800db4:	89 e5                	mov    %esp,%ebp
+  800db6:	8d 35 be 0d 80 00    	lea    0x800dbe,%esi
+  800dbc:	0f 34                	sysenter
+  800dbe:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800dbf:	85 c0                	test   %eax,%eax
+  800dc1:	7f 08                	jg     800dcb <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800dc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc6:	5b                   	pop    %ebx
+  800dc7:	5e                   	pop    %esi
+  800dc8:	5f                   	pop    %edi
+  800dc9:	5d                   	pop    %ebp
+  800dca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dcb:	83 ec 0c             	sub    $0xc,%esp
+  800dce:	50                   	push   %eax
+  800dcf:	6a 06                	push   $0x6
+  800dd1:	68 07 3d 80 00       	push   $0x803d07
+  800dd6:	6a 3d                	push   $0x3d
+  800dd8:	68 24 3d 80 00       	push   $0x803d24
+  800ddd:	e8 54 f4 ff ff       	call   800236 <_panic>
+
+00800de2 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800de2:	55                   	push   %ebp
+  800de3:	89 e5                	mov    %esp,%ebp
+  800de5:	57                   	push   %edi
+  800de6:	56                   	push   %esi
+  800de7:	53                   	push   %ebx
+  800de8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800deb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df6:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dfb:	89 df                	mov    %ebx,%edi
+  800dfd:	55                   	push   %ebp
+  800dfe:	89 e5                	mov    %esp,%ebp
+  800e00:	8d 35 08 0e 80 00    	lea    0x800e08,%esi
+  800e06:	0f 34                	sysenter
+  800e08:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e09:	85 c0                	test   %eax,%eax
+  800e0b:	7f 08                	jg     800e15 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800e0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e10:	5b                   	pop    %ebx
+  800e11:	5e                   	pop    %esi
+  800e12:	5f                   	pop    %edi
+  800e13:	5d                   	pop    %ebp
+  800e14:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e15:	83 ec 0c             	sub    $0xc,%esp
+  800e18:	50                   	push   %eax
+  800e19:	6a 08                	push   $0x8
+  800e1b:	68 07 3d 80 00       	push   $0x803d07
+  800e20:	6a 3d                	push   $0x3d
+  800e22:	68 24 3d 80 00       	push   $0x803d24
+  800e27:	e8 0a f4 ff ff       	call   800236 <_panic>
+
+00800e2c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e2c:	55                   	push   %ebp
+  800e2d:	89 e5                	mov    %esp,%ebp
+  800e2f:	57                   	push   %edi
+  800e30:	56                   	push   %esi
+  800e31:	53                   	push   %ebx
+  800e32:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e40:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e45:	89 df                	mov    %ebx,%edi
+  800e47:	55                   	push   %ebp
+  800e48:	89 e5                	mov    %esp,%ebp
+  800e4a:	8d 35 52 0e 80 00    	lea    0x800e52,%esi
+  800e50:	0f 34                	sysenter
+  800e52:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e53:	85 c0                	test   %eax,%eax
+  800e55:	7f 08                	jg     800e5f <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800e57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5a:	5b                   	pop    %ebx
+  800e5b:	5e                   	pop    %esi
+  800e5c:	5f                   	pop    %edi
+  800e5d:	5d                   	pop    %ebp
+  800e5e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5f:	83 ec 0c             	sub    $0xc,%esp
+  800e62:	50                   	push   %eax
+  800e63:	6a 09                	push   $0x9
+  800e65:	68 07 3d 80 00       	push   $0x803d07
+  800e6a:	6a 3d                	push   $0x3d
+  800e6c:	68 24 3d 80 00       	push   $0x803d24
+  800e71:	e8 c0 f3 ff ff       	call   800236 <_panic>
+
+00800e76 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e76:	55                   	push   %ebp
+  800e77:	89 e5                	mov    %esp,%ebp
+  800e79:	57                   	push   %edi
+  800e7a:	56                   	push   %esi
+  800e7b:	53                   	push   %ebx
+  800e7c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e8f:	89 df                	mov    %ebx,%edi
+  800e91:	55                   	push   %ebp
+  800e92:	89 e5                	mov    %esp,%ebp
+  800e94:	8d 35 9c 0e 80 00    	lea    0x800e9c,%esi
+  800e9a:	0f 34                	sysenter
+  800e9c:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e9d:	85 c0                	test   %eax,%eax
+  800e9f:	7f 08                	jg     800ea9 <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800ea1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea4:	5b                   	pop    %ebx
+  800ea5:	5e                   	pop    %esi
+  800ea6:	5f                   	pop    %edi
+  800ea7:	5d                   	pop    %ebp
+  800ea8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea9:	83 ec 0c             	sub    $0xc,%esp
+  800eac:	50                   	push   %eax
+  800ead:	6a 0a                	push   $0xa
+  800eaf:	68 07 3d 80 00       	push   $0x803d07
+  800eb4:	6a 3d                	push   $0x3d
+  800eb6:	68 24 3d 80 00       	push   $0x803d24
+  800ebb:	e8 76 f3 ff ff       	call   800236 <_panic>
+
+00800ec0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800ec0:	55                   	push   %ebp
+  800ec1:	89 e5                	mov    %esp,%ebp
+  800ec3:	57                   	push   %edi
+  800ec4:	56                   	push   %esi
+  800ec5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ec6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ed1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ed4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ed7:	55                   	push   %ebp
+  800ed8:	89 e5                	mov    %esp,%ebp
+  800eda:	8d 35 e2 0e 80 00    	lea    0x800ee2,%esi
+  800ee0:	0f 34                	sysenter
+  800ee2:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800ee3:	5b                   	pop    %ebx
+  800ee4:	5e                   	pop    %esi
+  800ee5:	5f                   	pop    %edi
+  800ee6:	5d                   	pop    %ebp
+  800ee7:	c3                   	ret
+
+00800ee8 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800ee8:	55                   	push   %ebp
+  800ee9:	89 e5                	mov    %esp,%ebp
+  800eeb:	57                   	push   %edi
+  800eec:	56                   	push   %esi
+  800eed:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef4:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ef9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eff:	55                   	push   %ebp
+  800f00:	89 e5                	mov    %esp,%ebp
+  800f02:	8d 35 0a 0f 80 00    	lea    0x800f0a,%esi
+  800f08:	0f 34                	sysenter
+  800f0a:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800f0b:	5b                   	pop    %ebx
+  800f0c:	5e                   	pop    %esi
+  800f0d:	5f                   	pop    %edi
+  800f0e:	5d                   	pop    %ebp
+  800f0f:	c3                   	ret
+
+00800f10 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800f10:	55                   	push   %ebp
+  800f11:	89 e5                	mov    %esp,%ebp
+  800f13:	57                   	push   %edi
+  800f14:	56                   	push   %esi
+  800f15:	53                   	push   %ebx
+  800f16:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f19:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f24:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2c:	89 f7                	mov    %esi,%edi
+  800f2e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f30:	85 c0                	test   %eax,%eax
+  800f32:	7f 08                	jg     800f3c <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800f34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f37:	5b                   	pop    %ebx
+  800f38:	5e                   	pop    %esi
+  800f39:	5f                   	pop    %edi
+  800f3a:	5d                   	pop    %ebp
+  800f3b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f3c:	83 ec 0c             	sub    $0xc,%esp
+  800f3f:	50                   	push   %eax
+  800f40:	6a 0d                	push   $0xd
+  800f42:	68 07 3d 80 00       	push   $0x803d07
+  800f47:	6a 23                	push   $0x23
+  800f49:	68 24 3d 80 00       	push   $0x803d24
+  800f4e:	e8 e3 f2 ff ff       	call   800236 <_panic>
+
+00800f53 <sys_ipc_recv>:
+{
+  800f53:	55                   	push   %ebp
+  800f54:	89 e5                	mov    %esp,%ebp
+  800f56:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800f59:	6a 00                	push   $0x0
+  800f5b:	6a 01                	push   $0x1
+  800f5d:	ff 75 08             	push   0x8(%ebp)
+  800f60:	e8 ab ff ff ff       	call   800f10 <sys_ipc_recvv>
+}
+  800f65:	c9                   	leave
+  800f66:	c3                   	ret
+
+00800f67 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800f67:	55                   	push   %ebp
+  800f68:	89 e5                	mov    %esp,%ebp
+  800f6a:	57                   	push   %edi
+  800f6b:	56                   	push   %esi
+  800f6c:	53                   	push   %ebx
+  800f6d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f80:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800f83:	89 de                	mov    %ebx,%esi
+  800f85:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f87:	85 c0                	test   %eax,%eax
+  800f89:	7f 08                	jg     800f93 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800f8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8e:	5b                   	pop    %ebx
+  800f8f:	5e                   	pop    %esi
+  800f90:	5f                   	pop    %edi
+  800f91:	5d                   	pop    %ebp
+  800f92:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f93:	83 ec 0c             	sub    $0xc,%esp
+  800f96:	50                   	push   %eax
+  800f97:	6a 0d                	push   $0xd
+  800f99:	68 07 3d 80 00       	push   $0x803d07
+  800f9e:	6a 23                	push   $0x23
+  800fa0:	68 24 3d 80 00       	push   $0x803d24
+  800fa5:	e8 8c f2 ff ff       	call   800236 <_panic>
+
+00800faa <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800faa:	55                   	push   %ebp
+  800fab:	89 e5                	mov    %esp,%ebp
+  800fad:	57                   	push   %edi
+  800fae:	56                   	push   %esi
+  800faf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fba:	89 d1                	mov    %edx,%ecx
+  800fbc:	89 d3                	mov    %edx,%ebx
+  800fbe:	89 d7                	mov    %edx,%edi
+  800fc0:	55                   	push   %ebp
+  800fc1:	89 e5                	mov    %esp,%ebp
+  800fc3:	8d 35 cb 0f 80 00    	lea    0x800fcb,%esi
+  800fc9:	0f 34                	sysenter
+  800fcb:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800fcc:	5b                   	pop    %ebx
+  800fcd:	5e                   	pop    %esi
+  800fce:	5f                   	pop    %edi
+  800fcf:	5d                   	pop    %ebp
+  800fd0:	c3                   	ret
+
+00800fd1 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800fd1:	55                   	push   %ebp
+  800fd2:	89 e5                	mov    %esp,%ebp
+  800fd4:	57                   	push   %edi
+  800fd5:	56                   	push   %esi
+  800fd6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fe7:	89 df                	mov    %ebx,%edi
+  800fe9:	55                   	push   %ebp
+  800fea:	89 e5                	mov    %esp,%ebp
+  800fec:	8d 35 f4 0f 80 00    	lea    0x800ff4,%esi
+  800ff2:	0f 34                	sysenter
+  800ff4:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800ff5:	5b                   	pop    %ebx
+  800ff6:	5e                   	pop    %esi
+  800ff7:	5f                   	pop    %edi
+  800ff8:	5d                   	pop    %ebp
+  800ff9:	c3                   	ret
+
+00800ffa <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800ffa:	55                   	push   %ebp
+  800ffb:	89 e5                	mov    %esp,%ebp
+  800ffd:	57                   	push   %edi
+  800ffe:	56                   	push   %esi
+  800fff:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801000:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801005:	8b 55 08             	mov    0x8(%ebp),%edx
+  801008:	b8 10 00 00 00       	mov    $0x10,%eax
+  80100d:	89 cb                	mov    %ecx,%ebx
+  80100f:	89 cf                	mov    %ecx,%edi
+  801011:	55                   	push   %ebp
+  801012:	89 e5                	mov    %esp,%ebp
+  801014:	8d 35 1c 10 80 00    	lea    0x80101c,%esi
+  80101a:	0f 34                	sysenter
+  80101c:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  80101d:	5b                   	pop    %ebx
+  80101e:	5e                   	pop    %esi
+  80101f:	5f                   	pop    %edi
+  801020:	5d                   	pop    %ebp
+  801021:	c3                   	ret
+
+00801022 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  801022:	55                   	push   %ebp
+  801023:	89 e5                	mov    %esp,%ebp
+  801025:	57                   	push   %edi
+  801026:	56                   	push   %esi
+  801027:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801028:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801030:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801033:	b8 12 00 00 00       	mov    $0x12,%eax
+  801038:	89 df                	mov    %ebx,%edi
+  80103a:	55                   	push   %ebp
+  80103b:	89 e5                	mov    %esp,%ebp
+  80103d:	8d 35 45 10 80 00    	lea    0x801045,%esi
+  801043:	0f 34                	sysenter
+  801045:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  801046:	5b                   	pop    %ebx
+  801047:	5e                   	pop    %esi
+  801048:	5f                   	pop    %edi
+  801049:	5d                   	pop    %ebp
+  80104a:	c3                   	ret
+
+0080104b <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  80104b:	55                   	push   %ebp
+  80104c:	89 e5                	mov    %esp,%ebp
+  80104e:	57                   	push   %edi
+  80104f:	56                   	push   %esi
+  801050:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801051:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801056:	8b 55 08             	mov    0x8(%ebp),%edx
+  801059:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801061:	89 df                	mov    %ebx,%edi
+  801063:	55                   	push   %ebp
+  801064:	89 e5                	mov    %esp,%ebp
+  801066:	8d 35 6e 10 80 00    	lea    0x80106e,%esi
+  80106c:	0f 34                	sysenter
+  80106e:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  80106f:	5b                   	pop    %ebx
+  801070:	5e                   	pop    %esi
+  801071:	5f                   	pop    %edi
+  801072:	5d                   	pop    %ebp
+  801073:	c3                   	ret
+
+00801074 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  801074:	55                   	push   %ebp
+  801075:	89 e5                	mov    %esp,%ebp
+  801077:	57                   	push   %edi
+  801078:	56                   	push   %esi
+  801079:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80107a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801080:	b8 13 00 00 00       	mov    $0x13,%eax
+  801085:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801088:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80108b:	55                   	push   %ebp
+  80108c:	89 e5                	mov    %esp,%ebp
+  80108e:	8d 35 96 10 80 00    	lea    0x801096,%esi
+  801094:	0f 34                	sysenter
+  801096:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  801097:	5b                   	pop    %ebx
+  801098:	5e                   	pop    %esi
+  801099:	5f                   	pop    %edi
+  80109a:	5d                   	pop    %ebp
+  80109b:	c3                   	ret
+
+0080109c <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  80109c:	55                   	push   %ebp
+  80109d:	89 e5                	mov    %esp,%ebp
+  80109f:	57                   	push   %edi
+  8010a0:	56                   	push   %esi
+  8010a1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010aa:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010af:	89 cb                	mov    %ecx,%ebx
+  8010b1:	89 cf                	mov    %ecx,%edi
+  8010b3:	89 ce                	mov    %ecx,%esi
+  8010b5:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  8010b7:	5b                   	pop    %ebx
+  8010b8:	5e                   	pop    %esi
+  8010b9:	5f                   	pop    %edi
+  8010ba:	5d                   	pop    %ebp
+  8010bb:	c3                   	ret
+
+008010bc <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	57                   	push   %edi
+  8010c0:	56                   	push   %esi
+  8010c1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ca:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010cf:	89 cb                	mov    %ecx,%ebx
+  8010d1:	89 cf                	mov    %ecx,%edi
+  8010d3:	55                   	push   %ebp
+  8010d4:	89 e5                	mov    %esp,%ebp
+  8010d6:	8d 35 de 10 80 00    	lea    0x8010de,%esi
+  8010dc:	0f 34                	sysenter
+  8010de:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8010df:	5b                   	pop    %ebx
+  8010e0:	5e                   	pop    %esi
+  8010e1:	5f                   	pop    %edi
+  8010e2:	5d                   	pop    %ebp
+  8010e3:	c3                   	ret
+
+008010e4 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8010e4:	55                   	push   %ebp
+  8010e5:	89 e5                	mov    %esp,%ebp
+  8010e7:	57                   	push   %edi
+  8010e8:	56                   	push   %esi
+  8010e9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f2:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010f7:	89 cb                	mov    %ecx,%ebx
+  8010f9:	89 cf                	mov    %ecx,%edi
+  8010fb:	55                   	push   %ebp
+  8010fc:	89 e5                	mov    %esp,%ebp
+  8010fe:	8d 35 06 11 80 00    	lea    0x801106,%esi
+  801104:	0f 34                	sysenter
+  801106:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  801107:	5b                   	pop    %ebx
+  801108:	5e                   	pop    %esi
+  801109:	5f                   	pop    %edi
+  80110a:	5d                   	pop    %ebp
+  80110b:	c3                   	ret
+
+0080110c <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  80110c:	55                   	push   %ebp
+  80110d:	89 e5                	mov    %esp,%ebp
+  80110f:	57                   	push   %edi
+  801110:	56                   	push   %esi
+  801111:	53                   	push   %ebx
+  801112:	83 ec 20             	sub    $0x20,%esp
+  801115:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801118:	89 d7                	mov    %edx,%edi
+  80111a:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  80111c:	51                   	push   %ecx
+  80111d:	68 00 f0 7f 00       	push   $0x7ff000
+  801122:	6a 00                	push   $0x0
+  801124:	e8 e2 fb ff ff       	call   800d0b <sys_page_alloc>
+  801129:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80112b:	83 c4 10             	add    $0x10,%esp
+  80112e:	85 c0                	test   %eax,%eax
+  801130:	78 45                	js     801177 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  801132:	83 ec 04             	sub    $0x4,%esp
+  801135:	68 00 10 00 00       	push   $0x1000
+  80113a:	57                   	push   %edi
+  80113b:	68 00 f0 7f 00       	push   $0x7ff000
+  801140:	e8 40 f9 ff ff       	call   800a85 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  801145:	89 34 24             	mov    %esi,(%esp)
+  801148:	57                   	push   %edi
+  801149:	ff 75 e4             	push   -0x1c(%ebp)
+  80114c:	68 00 f0 7f 00       	push   $0x7ff000
+  801151:	6a 00                	push   $0x0
+  801153:	e8 fe fb ff ff       	call   800d56 <sys_page_map>
+  801158:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80115a:	83 c4 20             	add    $0x20,%esp
+  80115d:	85 c0                	test   %eax,%eax
+  80115f:	78 16                	js     801177 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801161:	83 ec 08             	sub    $0x8,%esp
+  801164:	68 00 f0 7f 00       	push   $0x7ff000
+  801169:	6a 00                	push   $0x0
+  80116b:	e8 28 fc ff ff       	call   800d98 <sys_page_unmap>
+  801170:	83 c4 10             	add    $0x10,%esp
+  801173:	85 c0                	test   %eax,%eax
+  801175:	75 0a                	jne    801181 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  801177:	89 d8                	mov    %ebx,%eax
+  801179:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117c:	5b                   	pop    %ebx
+  80117d:	5e                   	pop    %esi
+  80117e:	5f                   	pop    %edi
+  80117f:	5d                   	pop    %ebp
+  801180:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801181:	68 34 3d 80 00       	push   $0x803d34
+  801186:	68 ac 3d 80 00       	push   $0x803dac
+  80118b:	6a 1b                	push   $0x1b
+  80118d:	68 c1 3d 80 00       	push   $0x803dc1
+  801192:	e8 9f f0 ff ff       	call   800236 <_panic>
+
+00801197 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801197:	55                   	push   %ebp
+  801198:	89 e5                	mov    %esp,%ebp
+  80119a:	53                   	push   %ebx
+  80119b:	83 ec 04             	sub    $0x4,%esp
+  80119e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8011a1:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8011a3:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  8011a7:	74 21                	je     8011ca <pgfault+0x33>
+  8011a9:	89 d0                	mov    %edx,%eax
+  8011ab:	c1 e8 16             	shr    $0x16,%eax
+  8011ae:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8011b5:	a8 01                	test   $0x1,%al
+  8011b7:	74 11                	je     8011ca <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  8011b9:	89 d0                	mov    %edx,%eax
+  8011bb:	c1 e8 0c             	shr    $0xc,%eax
+  8011be:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011c5:	f6 c4 08             	test   $0x8,%ah
+  8011c8:	75 17                	jne    8011e1 <pgfault+0x4a>
+		if (pgfault_next) {
+  8011ca:	a1 04 50 80 00       	mov    0x805004,%eax
+  8011cf:	85 c0                	test   %eax,%eax
+  8011d1:	74 27                	je     8011fa <pgfault+0x63>
+			pgfault_next(utf);
+  8011d3:	83 ec 0c             	sub    $0xc,%esp
+  8011d6:	53                   	push   %ebx
+  8011d7:	ff d0                	call   *%eax
+			return;
+  8011d9:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8011dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011df:	c9                   	leave
+  8011e0:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8011e1:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8011e7:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8011ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f1:	e8 16 ff ff ff       	call   80110c <copy_page_to>
+  8011f6:	85 c0                	test   %eax,%eax
+  8011f8:	79 e2                	jns    8011dc <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8011fa:	a1 00 50 80 00       	mov    0x805000,%eax
+  8011ff:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  801202:	ff 73 28             	push   0x28(%ebx)
+  801205:	ff 33                	push   (%ebx)
+  801207:	50                   	push   %eax
+  801208:	68 58 3d 80 00       	push   $0x803d58
+  80120d:	e8 ff f0 ff ff       	call   800311 <cprintf>
+	sys_env_destroy(0);
+  801212:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801219:	e8 5e fa ff ff       	call   800c7c <sys_env_destroy>
+  80121e:	83 c4 10             	add    $0x10,%esp
+  801221:	eb b9                	jmp    8011dc <pgfault+0x45>
+
+00801223 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  801223:	55                   	push   %ebp
+  801224:	89 e5                	mov    %esp,%ebp
+  801226:	53                   	push   %ebx
+  801227:	83 ec 04             	sub    $0x4,%esp
+  80122a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80122d:	a1 04 90 80 00       	mov    0x809004,%eax
+  801232:	3d 97 11 80 00       	cmp    $0x801197,%eax
+  801237:	74 15                	je     80124e <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  801239:	a3 04 50 80 00       	mov    %eax,0x805004
+		set_pgfault_handler(pgfault);
+  80123e:	83 ec 0c             	sub    $0xc,%esp
+  801241:	68 97 11 80 00       	push   $0x801197
+  801246:	e8 91 21 00 00       	call   8033dc <set_pgfault_handler>
+  80124b:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80124e:	83 ec 0c             	sub    $0xc,%esp
+  801251:	68 05 08 00 00       	push   $0x805
+  801256:	53                   	push   %ebx
+  801257:	6a 00                	push   $0x0
+  801259:	53                   	push   %ebx
+  80125a:	6a 00                	push   $0x0
+  80125c:	e8 f5 fa ff ff       	call   800d56 <sys_page_map>
+}
+  801261:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801264:	c9                   	leave
+  801265:	c3                   	ret
+
+00801266 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	57                   	push   %edi
+  80126a:	56                   	push   %esi
+  80126b:	53                   	push   %ebx
+  80126c:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80126f:	68 97 11 80 00       	push   $0x801197
+  801274:	e8 63 21 00 00       	call   8033dc <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  801279:	b8 07 00 00 00       	mov    $0x7,%eax
+  80127e:	cd 30                	int    $0x30
+  801280:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801283:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  801286:	83 c4 10             	add    $0x10,%esp
+  801289:	85 c0                	test   %eax,%eax
+  80128b:	0f 88 6b 01 00 00    	js     8013fc <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801291:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  801296:	75 37                	jne    8012cf <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801298:	e8 28 fa ff ff       	call   800cc5 <sys_getenvid>
+  80129d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8012a2:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8012a8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8012ad:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  8012b2:	e9 45 01 00 00       	jmp    8013fc <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  8012b7:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8012bd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8012c3:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8012c9:	0f 87 ba 00 00 00    	ja     801389 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8012cf:	89 d8                	mov    %ebx,%eax
+  8012d1:	c1 e8 16             	shr    $0x16,%eax
+  8012d4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012db:	a8 01                	test   $0x1,%al
+  8012dd:	74 d8                	je     8012b7 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8012df:	89 d8                	mov    %ebx,%eax
+  8012e1:	c1 e8 0c             	shr    $0xc,%eax
+  8012e4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012eb:	f6 c2 01             	test   $0x1,%dl
+  8012ee:	74 cd                	je     8012bd <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8012f0:	89 da                	mov    %ebx,%edx
+  8012f2:	80 e6 df             	and    $0xdf,%dh
+  8012f5:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8012fb:	74 c0                	je     8012bd <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8012fd:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8012ff:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801306:	f6 c6 04             	test   $0x4,%dh
+  801309:	75 53                	jne    80135e <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80130b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  801312:	f6 c6 08             	test   $0x8,%dh
+  801315:	75 0c                	jne    801323 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  801317:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80131e:	f6 c2 02             	test   $0x2,%dl
+  801321:	74 3b                	je     80135e <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  801323:	83 ec 0c             	sub    $0xc,%esp
+  801326:	68 05 08 00 00       	push   $0x805
+  80132b:	57                   	push   %edi
+  80132c:	ff 75 e4             	push   -0x1c(%ebp)
+  80132f:	57                   	push   %edi
+  801330:	6a 00                	push   $0x0
+  801332:	e8 1f fa ff ff       	call   800d56 <sys_page_map>
+  801337:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801339:	83 c4 20             	add    $0x20,%esp
+  80133c:	85 c0                	test   %eax,%eax
+  80133e:	0f 88 a7 00 00 00    	js     8013eb <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801344:	83 ec 0c             	sub    $0xc,%esp
+  801347:	68 05 08 00 00       	push   $0x805
+  80134c:	57                   	push   %edi
+  80134d:	6a 00                	push   $0x0
+  80134f:	57                   	push   %edi
+  801350:	6a 00                	push   $0x0
+  801352:	e8 ff f9 ff ff       	call   800d56 <sys_page_map>
+  801357:	89 c6                	mov    %eax,%esi
+	return r;
+  801359:	83 c4 20             	add    $0x20,%esp
+  80135c:	eb 21                	jmp    80137f <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  80135e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801365:	83 ec 0c             	sub    $0xc,%esp
+  801368:	25 07 0e 00 00       	and    $0xe07,%eax
+  80136d:	50                   	push   %eax
+  80136e:	57                   	push   %edi
+  80136f:	ff 75 e4             	push   -0x1c(%ebp)
+  801372:	57                   	push   %edi
+  801373:	6a 00                	push   $0x0
+  801375:	e8 dc f9 ff ff       	call   800d56 <sys_page_map>
+  80137a:	89 c6                	mov    %eax,%esi
+  80137c:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  80137f:	85 f6                	test   %esi,%esi
+  801381:	0f 89 36 ff ff ff    	jns    8012bd <fork+0x57>
+  801387:	eb 62                	jmp    8013eb <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801389:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80138e:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  801393:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801396:	89 f8                	mov    %edi,%eax
+  801398:	e8 6f fd ff ff       	call   80110c <copy_page_to>
+  80139d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80139f:	85 c0                	test   %eax,%eax
+  8013a1:	78 48                	js     8013eb <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8013a3:	83 ec 04             	sub    $0x4,%esp
+  8013a6:	6a 07                	push   $0x7
+  8013a8:	68 00 f0 bf ee       	push   $0xeebff000
+  8013ad:	57                   	push   %edi
+  8013ae:	e8 58 f9 ff ff       	call   800d0b <sys_page_alloc>
+  8013b3:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8013b5:	83 c4 10             	add    $0x10,%esp
+  8013b8:	85 c0                	test   %eax,%eax
+  8013ba:	78 2f                	js     8013eb <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8013bc:	a1 00 50 80 00       	mov    0x805000,%eax
+  8013c1:	8b 40 64             	mov    0x64(%eax),%eax
+  8013c4:	83 ec 08             	sub    $0x8,%esp
+  8013c7:	50                   	push   %eax
+  8013c8:	57                   	push   %edi
+  8013c9:	e8 a8 fa ff ff       	call   800e76 <sys_env_set_pgfault_upcall>
+  8013ce:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8013d0:	83 c4 10             	add    $0x10,%esp
+  8013d3:	85 c0                	test   %eax,%eax
+  8013d5:	78 14                	js     8013eb <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8013d7:	83 ec 08             	sub    $0x8,%esp
+  8013da:	6a 02                	push   $0x2
+  8013dc:	57                   	push   %edi
+  8013dd:	e8 00 fa ff ff       	call   800de2 <sys_env_set_status>
+  8013e2:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8013e4:	83 c4 10             	add    $0x10,%esp
+  8013e7:	85 c0                	test   %eax,%eax
+  8013e9:	79 11                	jns    8013fc <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8013eb:	83 ec 0c             	sub    $0xc,%esp
+  8013ee:	ff 75 e0             	push   -0x20(%ebp)
+  8013f1:	e8 86 f8 ff ff       	call   800c7c <sys_env_destroy>
+	return r;
+  8013f6:	83 c4 10             	add    $0x10,%esp
+  8013f9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8013fc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8013ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801402:	5b                   	pop    %ebx
+  801403:	5e                   	pop    %esi
+  801404:	5f                   	pop    %edi
+  801405:	5d                   	pop    %ebp
+  801406:	c3                   	ret
+
+00801407 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801407:	55                   	push   %ebp
+  801408:	89 e5                	mov    %esp,%ebp
+  80140a:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80140d:	68 cc 3d 80 00       	push   $0x803dcc
+  801412:	68 bf 00 00 00       	push   $0xbf
+  801417:	68 c1 3d 80 00       	push   $0x803dc1
+  80141c:	e8 15 ee ff ff       	call   800236 <_panic>
+
+00801421 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801421:	55                   	push   %ebp
+  801422:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801424:	8b 45 08             	mov    0x8(%ebp),%eax
+  801427:	05 00 00 00 30       	add    $0x30000000,%eax
+  80142c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80142f:	5d                   	pop    %ebp
+  801430:	c3                   	ret
+
+00801431 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801431:	55                   	push   %ebp
+  801432:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801434:	8b 45 08             	mov    0x8(%ebp),%eax
+  801437:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80143c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801441:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801446:	5d                   	pop    %ebp
+  801447:	c3                   	ret
+
+00801448 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801448:	55                   	push   %ebp
+  801449:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80144b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801450:	eb 02                	jmp    801454 <fd_alloc+0xc>
+  801452:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801454:	89 c2                	mov    %eax,%edx
+  801456:	c1 ea 16             	shr    $0x16,%edx
+  801459:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801460:	f6 c2 01             	test   $0x1,%dl
+  801463:	74 2b                	je     801490 <fd_alloc+0x48>
+  801465:	89 c2                	mov    %eax,%edx
+  801467:	c1 ea 0c             	shr    $0xc,%edx
+  80146a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801471:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801477:	f6 c1 01             	test   $0x1,%cl
+  80147a:	74 14                	je     801490 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80147c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801482:	75 ce                	jne    801452 <fd_alloc+0xa>
+  801484:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801489:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80148e:	eb 05                	jmp    801495 <fd_alloc+0x4d>
+			return 0;
+  801490:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801495:	8b 55 08             	mov    0x8(%ebp),%edx
+  801498:	89 02                	mov    %eax,(%edx)
+}
+  80149a:	89 c8                	mov    %ecx,%eax
+  80149c:	5d                   	pop    %ebp
+  80149d:	c3                   	ret
+
+0080149e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80149e:	55                   	push   %ebp
+  80149f:	89 e5                	mov    %esp,%ebp
+  8014a1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8014a4:	83 f8 1f             	cmp    $0x1f,%eax
+  8014a7:	77 30                	ja     8014d9 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8014a9:	c1 e0 0c             	shl    $0xc,%eax
+  8014ac:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8014b1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8014b7:	f6 c2 01             	test   $0x1,%dl
+  8014ba:	74 24                	je     8014e0 <fd_lookup+0x42>
+  8014bc:	89 c2                	mov    %eax,%edx
+  8014be:	c1 ea 0c             	shr    $0xc,%edx
+  8014c1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8014c8:	f6 c2 01             	test   $0x1,%dl
+  8014cb:	74 1a                	je     8014e7 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8014cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014d0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8014d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014d7:	5d                   	pop    %ebp
+  8014d8:	c3                   	ret
+		return -E_INVAL;
+  8014d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014de:	eb f7                	jmp    8014d7 <fd_lookup+0x39>
+		return -E_INVAL;
+  8014e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014e5:	eb f0                	jmp    8014d7 <fd_lookup+0x39>
+  8014e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014ec:	eb e9                	jmp    8014d7 <fd_lookup+0x39>
+
+008014ee <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8014ee:	55                   	push   %ebp
+  8014ef:	89 e5                	mov    %esp,%ebp
+  8014f1:	53                   	push   %ebx
+  8014f2:	83 ec 04             	sub    $0x4,%esp
+  8014f5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8014f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014fd:	eb 03                	jmp    801502 <dev_lookup+0x14>
+  8014ff:	83 c0 01             	add    $0x1,%eax
+  801502:	8b 1c 85 60 3e 80 00 	mov    0x803e60(,%eax,4),%ebx
+  801509:	85 db                	test   %ebx,%ebx
+  80150b:	74 0b                	je     801518 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80150d:	39 13                	cmp    %edx,(%ebx)
+  80150f:	75 ee                	jne    8014ff <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801511:	b8 00 00 00 00       	mov    $0x0,%eax
+  801516:	eb 1f                	jmp    801537 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801518:	a1 00 50 80 00       	mov    0x805000,%eax
+  80151d:	8b 40 48             	mov    0x48(%eax),%eax
+  801520:	83 ec 04             	sub    $0x4,%esp
+  801523:	52                   	push   %edx
+  801524:	50                   	push   %eax
+  801525:	68 e4 3d 80 00       	push   $0x803de4
+  80152a:	e8 e2 ed ff ff       	call   800311 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80152f:	83 c4 10             	add    $0x10,%esp
+  801532:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801537:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80153a:	89 1a                	mov    %ebx,(%edx)
+}
+  80153c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80153f:	c9                   	leave
+  801540:	c3                   	ret
+
+00801541 <fd_close>:
+{
+  801541:	55                   	push   %ebp
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	57                   	push   %edi
+  801545:	56                   	push   %esi
+  801546:	53                   	push   %ebx
+  801547:	83 ec 24             	sub    $0x24,%esp
+  80154a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80154d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801550:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801553:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801554:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80155a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80155d:	50                   	push   %eax
+  80155e:	e8 3b ff ff ff       	call   80149e <fd_lookup>
+  801563:	89 c3                	mov    %eax,%ebx
+  801565:	83 c4 10             	add    $0x10,%esp
+  801568:	85 c0                	test   %eax,%eax
+  80156a:	78 05                	js     801571 <fd_close+0x30>
+	    || fd != fd2)
+  80156c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80156f:	74 16                	je     801587 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801571:	89 f8                	mov    %edi,%eax
+  801573:	84 c0                	test   %al,%al
+  801575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80157d:	89 d8                	mov    %ebx,%eax
+  80157f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801582:	5b                   	pop    %ebx
+  801583:	5e                   	pop    %esi
+  801584:	5f                   	pop    %edi
+  801585:	5d                   	pop    %ebp
+  801586:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801587:	83 ec 08             	sub    $0x8,%esp
+  80158a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80158d:	50                   	push   %eax
+  80158e:	ff 36                	push   (%esi)
+  801590:	e8 59 ff ff ff       	call   8014ee <dev_lookup>
+  801595:	89 c3                	mov    %eax,%ebx
+  801597:	83 c4 10             	add    $0x10,%esp
+  80159a:	85 c0                	test   %eax,%eax
+  80159c:	78 1a                	js     8015b8 <fd_close+0x77>
+		if (dev->dev_close)
+  80159e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015a1:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8015a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8015a9:	85 c0                	test   %eax,%eax
+  8015ab:	74 0b                	je     8015b8 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8015ad:	83 ec 0c             	sub    $0xc,%esp
+  8015b0:	56                   	push   %esi
+  8015b1:	ff d0                	call   *%eax
+  8015b3:	89 c3                	mov    %eax,%ebx
+  8015b5:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8015b8:	83 ec 08             	sub    $0x8,%esp
+  8015bb:	56                   	push   %esi
+  8015bc:	6a 00                	push   $0x0
+  8015be:	e8 d5 f7 ff ff       	call   800d98 <sys_page_unmap>
+	return r;
+  8015c3:	83 c4 10             	add    $0x10,%esp
+  8015c6:	eb b5                	jmp    80157d <fd_close+0x3c>
+
+008015c8 <close>:
+
+int
+close(int fdnum)
+{
+  8015c8:	55                   	push   %ebp
+  8015c9:	89 e5                	mov    %esp,%ebp
+  8015cb:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015d1:	50                   	push   %eax
+  8015d2:	ff 75 08             	push   0x8(%ebp)
+  8015d5:	e8 c4 fe ff ff       	call   80149e <fd_lookup>
+  8015da:	83 c4 10             	add    $0x10,%esp
+  8015dd:	85 c0                	test   %eax,%eax
+  8015df:	79 02                	jns    8015e3 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8015e1:	c9                   	leave
+  8015e2:	c3                   	ret
+		return fd_close(fd, 1);
+  8015e3:	83 ec 08             	sub    $0x8,%esp
+  8015e6:	6a 01                	push   $0x1
+  8015e8:	ff 75 f4             	push   -0xc(%ebp)
+  8015eb:	e8 51 ff ff ff       	call   801541 <fd_close>
+  8015f0:	83 c4 10             	add    $0x10,%esp
+  8015f3:	eb ec                	jmp    8015e1 <close+0x19>
+
+008015f5 <close_all>:
+
+void
+close_all(void)
+{
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	53                   	push   %ebx
+  8015f9:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8015fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801601:	83 ec 0c             	sub    $0xc,%esp
+  801604:	53                   	push   %ebx
+  801605:	e8 be ff ff ff       	call   8015c8 <close>
+	for (i = 0; i < MAXFD; i++)
+  80160a:	83 c3 01             	add    $0x1,%ebx
+  80160d:	83 c4 10             	add    $0x10,%esp
+  801610:	83 fb 20             	cmp    $0x20,%ebx
+  801613:	75 ec                	jne    801601 <close_all+0xc>
+}
+  801615:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801618:	c9                   	leave
+  801619:	c3                   	ret
+
+0080161a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80161a:	55                   	push   %ebp
+  80161b:	89 e5                	mov    %esp,%ebp
+  80161d:	57                   	push   %edi
+  80161e:	56                   	push   %esi
+  80161f:	53                   	push   %ebx
+  801620:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801623:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801626:	50                   	push   %eax
+  801627:	ff 75 08             	push   0x8(%ebp)
+  80162a:	e8 6f fe ff ff       	call   80149e <fd_lookup>
+  80162f:	89 c3                	mov    %eax,%ebx
+  801631:	83 c4 10             	add    $0x10,%esp
+  801634:	85 c0                	test   %eax,%eax
+  801636:	78 7f                	js     8016b7 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801638:	83 ec 0c             	sub    $0xc,%esp
+  80163b:	ff 75 0c             	push   0xc(%ebp)
+  80163e:	e8 85 ff ff ff       	call   8015c8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801643:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801646:	c1 e6 0c             	shl    $0xc,%esi
+  801649:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80164f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801652:	89 3c 24             	mov    %edi,(%esp)
+  801655:	e8 d7 fd ff ff       	call   801431 <fd2data>
+  80165a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80165c:	89 34 24             	mov    %esi,(%esp)
+  80165f:	e8 cd fd ff ff       	call   801431 <fd2data>
+  801664:	83 c4 10             	add    $0x10,%esp
+  801667:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80166a:	89 d8                	mov    %ebx,%eax
+  80166c:	c1 e8 16             	shr    $0x16,%eax
+  80166f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801676:	a8 01                	test   $0x1,%al
+  801678:	74 11                	je     80168b <dup+0x71>
+  80167a:	89 d8                	mov    %ebx,%eax
+  80167c:	c1 e8 0c             	shr    $0xc,%eax
+  80167f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801686:	f6 c2 01             	test   $0x1,%dl
+  801689:	75 36                	jne    8016c1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80168b:	89 f8                	mov    %edi,%eax
+  80168d:	c1 e8 0c             	shr    $0xc,%eax
+  801690:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801697:	83 ec 0c             	sub    $0xc,%esp
+  80169a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80169f:	50                   	push   %eax
+  8016a0:	56                   	push   %esi
+  8016a1:	6a 00                	push   $0x0
+  8016a3:	57                   	push   %edi
+  8016a4:	6a 00                	push   $0x0
+  8016a6:	e8 ab f6 ff ff       	call   800d56 <sys_page_map>
+  8016ab:	89 c3                	mov    %eax,%ebx
+  8016ad:	83 c4 20             	add    $0x20,%esp
+  8016b0:	85 c0                	test   %eax,%eax
+  8016b2:	78 33                	js     8016e7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8016b4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8016b7:	89 d8                	mov    %ebx,%eax
+  8016b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016bc:	5b                   	pop    %ebx
+  8016bd:	5e                   	pop    %esi
+  8016be:	5f                   	pop    %edi
+  8016bf:	5d                   	pop    %ebp
+  8016c0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8016c1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016c8:	83 ec 0c             	sub    $0xc,%esp
+  8016cb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016d0:	50                   	push   %eax
+  8016d1:	ff 75 d4             	push   -0x2c(%ebp)
+  8016d4:	6a 00                	push   $0x0
+  8016d6:	53                   	push   %ebx
+  8016d7:	6a 00                	push   $0x0
+  8016d9:	e8 78 f6 ff ff       	call   800d56 <sys_page_map>
+  8016de:	89 c3                	mov    %eax,%ebx
+  8016e0:	83 c4 20             	add    $0x20,%esp
+  8016e3:	85 c0                	test   %eax,%eax
+  8016e5:	79 a4                	jns    80168b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8016e7:	83 ec 08             	sub    $0x8,%esp
+  8016ea:	56                   	push   %esi
+  8016eb:	6a 00                	push   $0x0
+  8016ed:	e8 a6 f6 ff ff       	call   800d98 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8016f2:	83 c4 08             	add    $0x8,%esp
+  8016f5:	ff 75 d4             	push   -0x2c(%ebp)
+  8016f8:	6a 00                	push   $0x0
+  8016fa:	e8 99 f6 ff ff       	call   800d98 <sys_page_unmap>
+	return r;
+  8016ff:	83 c4 10             	add    $0x10,%esp
+  801702:	eb b3                	jmp    8016b7 <dup+0x9d>
+
+00801704 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801704:	55                   	push   %ebp
+  801705:	89 e5                	mov    %esp,%ebp
+  801707:	56                   	push   %esi
+  801708:	53                   	push   %ebx
+  801709:	83 ec 18             	sub    $0x18,%esp
+  80170c:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80170f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801712:	50                   	push   %eax
+  801713:	56                   	push   %esi
+  801714:	e8 85 fd ff ff       	call   80149e <fd_lookup>
+  801719:	83 c4 10             	add    $0x10,%esp
+  80171c:	85 c0                	test   %eax,%eax
+  80171e:	78 3c                	js     80175c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801720:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801723:	83 ec 08             	sub    $0x8,%esp
+  801726:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801729:	50                   	push   %eax
+  80172a:	ff 33                	push   (%ebx)
+  80172c:	e8 bd fd ff ff       	call   8014ee <dev_lookup>
+  801731:	83 c4 10             	add    $0x10,%esp
+  801734:	85 c0                	test   %eax,%eax
+  801736:	78 24                	js     80175c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801738:	8b 43 08             	mov    0x8(%ebx),%eax
+  80173b:	83 e0 03             	and    $0x3,%eax
+  80173e:	83 f8 01             	cmp    $0x1,%eax
+  801741:	74 20                	je     801763 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801743:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801746:	8b 40 08             	mov    0x8(%eax),%eax
+  801749:	85 c0                	test   %eax,%eax
+  80174b:	74 37                	je     801784 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80174d:	83 ec 04             	sub    $0x4,%esp
+  801750:	ff 75 10             	push   0x10(%ebp)
+  801753:	ff 75 0c             	push   0xc(%ebp)
+  801756:	53                   	push   %ebx
+  801757:	ff d0                	call   *%eax
+  801759:	83 c4 10             	add    $0x10,%esp
+}
+  80175c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80175f:	5b                   	pop    %ebx
+  801760:	5e                   	pop    %esi
+  801761:	5d                   	pop    %ebp
+  801762:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801763:	a1 00 50 80 00       	mov    0x805000,%eax
+  801768:	8b 40 48             	mov    0x48(%eax),%eax
+  80176b:	83 ec 04             	sub    $0x4,%esp
+  80176e:	56                   	push   %esi
+  80176f:	50                   	push   %eax
+  801770:	68 25 3e 80 00       	push   $0x803e25
+  801775:	e8 97 eb ff ff       	call   800311 <cprintf>
+		return -E_INVAL;
+  80177a:	83 c4 10             	add    $0x10,%esp
+  80177d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801782:	eb d8                	jmp    80175c <read+0x58>
+		return -E_NOT_SUPP;
+  801784:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801789:	eb d1                	jmp    80175c <read+0x58>
+
+0080178b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80178b:	55                   	push   %ebp
+  80178c:	89 e5                	mov    %esp,%ebp
+  80178e:	57                   	push   %edi
+  80178f:	56                   	push   %esi
+  801790:	53                   	push   %ebx
+  801791:	83 ec 0c             	sub    $0xc,%esp
+  801794:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801797:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80179a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179f:	eb 02                	jmp    8017a3 <readn+0x18>
+  8017a1:	01 c3                	add    %eax,%ebx
+  8017a3:	39 f3                	cmp    %esi,%ebx
+  8017a5:	73 21                	jae    8017c8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017a7:	83 ec 04             	sub    $0x4,%esp
+  8017aa:	89 f0                	mov    %esi,%eax
+  8017ac:	29 d8                	sub    %ebx,%eax
+  8017ae:	50                   	push   %eax
+  8017af:	89 d8                	mov    %ebx,%eax
+  8017b1:	03 45 0c             	add    0xc(%ebp),%eax
+  8017b4:	50                   	push   %eax
+  8017b5:	57                   	push   %edi
+  8017b6:	e8 49 ff ff ff       	call   801704 <read>
+		if (m < 0)
+  8017bb:	83 c4 10             	add    $0x10,%esp
+  8017be:	85 c0                	test   %eax,%eax
+  8017c0:	78 04                	js     8017c6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8017c2:	75 dd                	jne    8017a1 <readn+0x16>
+  8017c4:	eb 02                	jmp    8017c8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017c6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8017c8:	89 d8                	mov    %ebx,%eax
+  8017ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017cd:	5b                   	pop    %ebx
+  8017ce:	5e                   	pop    %esi
+  8017cf:	5f                   	pop    %edi
+  8017d0:	5d                   	pop    %ebp
+  8017d1:	c3                   	ret
+
+008017d2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8017d2:	55                   	push   %ebp
+  8017d3:	89 e5                	mov    %esp,%ebp
+  8017d5:	56                   	push   %esi
+  8017d6:	53                   	push   %ebx
+  8017d7:	83 ec 18             	sub    $0x18,%esp
+  8017da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017dd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017e0:	50                   	push   %eax
+  8017e1:	53                   	push   %ebx
+  8017e2:	e8 b7 fc ff ff       	call   80149e <fd_lookup>
+  8017e7:	83 c4 10             	add    $0x10,%esp
+  8017ea:	85 c0                	test   %eax,%eax
+  8017ec:	78 37                	js     801825 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017ee:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017f1:	83 ec 08             	sub    $0x8,%esp
+  8017f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017f7:	50                   	push   %eax
+  8017f8:	ff 36                	push   (%esi)
+  8017fa:	e8 ef fc ff ff       	call   8014ee <dev_lookup>
+  8017ff:	83 c4 10             	add    $0x10,%esp
+  801802:	85 c0                	test   %eax,%eax
+  801804:	78 1f                	js     801825 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801806:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80180a:	74 20                	je     80182c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80180c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80180f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801812:	85 c0                	test   %eax,%eax
+  801814:	74 37                	je     80184d <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801816:	83 ec 04             	sub    $0x4,%esp
+  801819:	ff 75 10             	push   0x10(%ebp)
+  80181c:	ff 75 0c             	push   0xc(%ebp)
+  80181f:	56                   	push   %esi
+  801820:	ff d0                	call   *%eax
+  801822:	83 c4 10             	add    $0x10,%esp
+}
+  801825:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801828:	5b                   	pop    %ebx
+  801829:	5e                   	pop    %esi
+  80182a:	5d                   	pop    %ebp
+  80182b:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80182c:	a1 00 50 80 00       	mov    0x805000,%eax
+  801831:	8b 40 48             	mov    0x48(%eax),%eax
+  801834:	83 ec 04             	sub    $0x4,%esp
+  801837:	53                   	push   %ebx
+  801838:	50                   	push   %eax
+  801839:	68 41 3e 80 00       	push   $0x803e41
+  80183e:	e8 ce ea ff ff       	call   800311 <cprintf>
+		return -E_INVAL;
+  801843:	83 c4 10             	add    $0x10,%esp
+  801846:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80184b:	eb d8                	jmp    801825 <write+0x53>
+		return -E_NOT_SUPP;
+  80184d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801852:	eb d1                	jmp    801825 <write+0x53>
+
+00801854 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801854:	55                   	push   %ebp
+  801855:	89 e5                	mov    %esp,%ebp
+  801857:	53                   	push   %ebx
+  801858:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80185b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80185e:	50                   	push   %eax
+  80185f:	ff 75 08             	push   0x8(%ebp)
+  801862:	e8 37 fc ff ff       	call   80149e <fd_lookup>
+  801867:	83 c4 10             	add    $0x10,%esp
+  80186a:	85 c0                	test   %eax,%eax
+  80186c:	78 3a                	js     8018a8 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80186e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801871:	83 ec 08             	sub    $0x8,%esp
+  801874:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801877:	50                   	push   %eax
+  801878:	ff 33                	push   (%ebx)
+  80187a:	e8 6f fc ff ff       	call   8014ee <dev_lookup>
+  80187f:	83 c4 10             	add    $0x10,%esp
+  801882:	85 c0                	test   %eax,%eax
+  801884:	78 22                	js     8018a8 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801886:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801889:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80188c:	85 c0                	test   %eax,%eax
+  80188e:	74 0d                	je     80189d <seek+0x49>
+  801890:	83 ec 0c             	sub    $0xc,%esp
+  801893:	53                   	push   %ebx
+  801894:	ff d0                	call   *%eax
+  801896:	83 c4 10             	add    $0x10,%esp
+  801899:	85 c0                	test   %eax,%eax
+  80189b:	78 0b                	js     8018a8 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  80189d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018a0:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8018a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ab:	c9                   	leave
+  8018ac:	c3                   	ret
+
+008018ad <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8018ad:	55                   	push   %ebp
+  8018ae:	89 e5                	mov    %esp,%ebp
+  8018b0:	53                   	push   %ebx
+  8018b1:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018b4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018b7:	50                   	push   %eax
+  8018b8:	ff 75 08             	push   0x8(%ebp)
+  8018bb:	e8 de fb ff ff       	call   80149e <fd_lookup>
+  8018c0:	83 c4 10             	add    $0x10,%esp
+  8018c3:	85 c0                	test   %eax,%eax
+  8018c5:	78 2b                	js     8018f2 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018c7:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8018ca:	83 ec 08             	sub    $0x8,%esp
+  8018cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018d0:	50                   	push   %eax
+  8018d1:	ff 33                	push   (%ebx)
+  8018d3:	e8 16 fc ff ff       	call   8014ee <dev_lookup>
+  8018d8:	83 c4 10             	add    $0x10,%esp
+  8018db:	85 c0                	test   %eax,%eax
+  8018dd:	78 13                	js     8018f2 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8018df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018e2:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8018e5:	85 c0                	test   %eax,%eax
+  8018e7:	74 0e                	je     8018f7 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8018e9:	83 ec 0c             	sub    $0xc,%esp
+  8018ec:	53                   	push   %ebx
+  8018ed:	ff d0                	call   *%eax
+  8018ef:	83 c4 10             	add    $0x10,%esp
+}
+  8018f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018f5:	c9                   	leave
+  8018f6:	c3                   	ret
+		return 0;
+  8018f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fc:	eb f4                	jmp    8018f2 <fsync+0x45>
+
+008018fe <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018fe:	55                   	push   %ebp
+  8018ff:	89 e5                	mov    %esp,%ebp
+  801901:	56                   	push   %esi
+  801902:	53                   	push   %ebx
+  801903:	83 ec 18             	sub    $0x18,%esp
+  801906:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801909:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80190c:	50                   	push   %eax
+  80190d:	53                   	push   %ebx
+  80190e:	e8 8b fb ff ff       	call   80149e <fd_lookup>
+  801913:	83 c4 10             	add    $0x10,%esp
+  801916:	85 c0                	test   %eax,%eax
+  801918:	78 34                	js     80194e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80191a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80191d:	83 ec 08             	sub    $0x8,%esp
+  801920:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801923:	50                   	push   %eax
+  801924:	ff 36                	push   (%esi)
+  801926:	e8 c3 fb ff ff       	call   8014ee <dev_lookup>
+  80192b:	83 c4 10             	add    $0x10,%esp
+  80192e:	85 c0                	test   %eax,%eax
+  801930:	78 1c                	js     80194e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801932:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801936:	74 1d                	je     801955 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801938:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80193b:	8b 40 18             	mov    0x18(%eax),%eax
+  80193e:	85 c0                	test   %eax,%eax
+  801940:	74 34                	je     801976 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801942:	83 ec 08             	sub    $0x8,%esp
+  801945:	ff 75 0c             	push   0xc(%ebp)
+  801948:	56                   	push   %esi
+  801949:	ff d0                	call   *%eax
+  80194b:	83 c4 10             	add    $0x10,%esp
+}
+  80194e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801951:	5b                   	pop    %ebx
+  801952:	5e                   	pop    %esi
+  801953:	5d                   	pop    %ebp
+  801954:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801955:	a1 00 50 80 00       	mov    0x805000,%eax
+  80195a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80195d:	83 ec 04             	sub    $0x4,%esp
+  801960:	53                   	push   %ebx
+  801961:	50                   	push   %eax
+  801962:	68 04 3e 80 00       	push   $0x803e04
+  801967:	e8 a5 e9 ff ff       	call   800311 <cprintf>
+		return -E_INVAL;
+  80196c:	83 c4 10             	add    $0x10,%esp
+  80196f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801974:	eb d8                	jmp    80194e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801976:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80197b:	eb d1                	jmp    80194e <ftruncate+0x50>
+
+0080197d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80197d:	55                   	push   %ebp
+  80197e:	89 e5                	mov    %esp,%ebp
+  801980:	56                   	push   %esi
+  801981:	53                   	push   %ebx
+  801982:	83 ec 18             	sub    $0x18,%esp
+  801985:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801988:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80198b:	50                   	push   %eax
+  80198c:	ff 75 08             	push   0x8(%ebp)
+  80198f:	e8 0a fb ff ff       	call   80149e <fd_lookup>
+  801994:	83 c4 10             	add    $0x10,%esp
+  801997:	85 c0                	test   %eax,%eax
+  801999:	78 49                	js     8019e4 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80199b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80199e:	83 ec 08             	sub    $0x8,%esp
+  8019a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019a4:	50                   	push   %eax
+  8019a5:	ff 36                	push   (%esi)
+  8019a7:	e8 42 fb ff ff       	call   8014ee <dev_lookup>
+  8019ac:	83 c4 10             	add    $0x10,%esp
+  8019af:	85 c0                	test   %eax,%eax
+  8019b1:	78 31                	js     8019e4 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8019b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019b6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8019ba:	74 2f                	je     8019eb <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8019bc:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8019bf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8019c6:	00 00 00 
+	stat->st_isdir = 0;
+  8019c9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8019d0:	00 00 00 
+	stat->st_dev = dev;
+  8019d3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8019d9:	83 ec 08             	sub    $0x8,%esp
+  8019dc:	53                   	push   %ebx
+  8019dd:	56                   	push   %esi
+  8019de:	ff 50 14             	call   *0x14(%eax)
+  8019e1:	83 c4 10             	add    $0x10,%esp
+}
+  8019e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019e7:	5b                   	pop    %ebx
+  8019e8:	5e                   	pop    %esi
+  8019e9:	5d                   	pop    %ebp
+  8019ea:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019eb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019f0:	eb f2                	jmp    8019e4 <fstat+0x67>
+
+008019f2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8019f2:	55                   	push   %ebp
+  8019f3:	89 e5                	mov    %esp,%ebp
+  8019f5:	56                   	push   %esi
+  8019f6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  8019f7:	83 ec 08             	sub    $0x8,%esp
+  8019fa:	68 00 10 00 00       	push   $0x1000
+  8019ff:	ff 75 08             	push   0x8(%ebp)
+  801a02:	e8 b3 07 00 00       	call   8021ba <open>
+  801a07:	89 c3                	mov    %eax,%ebx
+  801a09:	83 c4 10             	add    $0x10,%esp
+  801a0c:	85 c0                	test   %eax,%eax
+  801a0e:	78 1b                	js     801a2b <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801a10:	83 ec 08             	sub    $0x8,%esp
+  801a13:	ff 75 0c             	push   0xc(%ebp)
+  801a16:	50                   	push   %eax
+  801a17:	e8 61 ff ff ff       	call   80197d <fstat>
+  801a1c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a1e:	89 1c 24             	mov    %ebx,(%esp)
+  801a21:	e8 a2 fb ff ff       	call   8015c8 <close>
+	return r;
+  801a26:	83 c4 10             	add    $0x10,%esp
+  801a29:	89 f3                	mov    %esi,%ebx
+}
+  801a2b:	89 d8                	mov    %ebx,%eax
+  801a2d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a30:	5b                   	pop    %ebx
+  801a31:	5e                   	pop    %esi
+  801a32:	5d                   	pop    %ebp
+  801a33:	c3                   	ret
+
+00801a34 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801a34:	55                   	push   %ebp
+  801a35:	89 e5                	mov    %esp,%ebp
+  801a37:	57                   	push   %edi
+  801a38:	56                   	push   %esi
+  801a39:	53                   	push   %ebx
+  801a3a:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801a40:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801a46:	89 d6                	mov    %edx,%esi
+  801a48:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801a4e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801a51:	89 d3                	mov    %edx,%ebx
+  801a53:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801a59:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801a60:	74 1d                	je     801a7f <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a62:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801a67:	83 c8 07             	or     $0x7,%eax
+  801a6a:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801a70:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801a75:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801a7b:	01 ce                	add    %ecx,%esi
+  801a7d:	eb 28                	jmp    801aa7 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a7f:	83 ec 0c             	sub    $0xc,%esp
+  801a82:	6a 01                	push   $0x1
+  801a84:	e8 90 1b 00 00       	call   803619 <ipc_find_env>
+  801a89:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801a8e:	83 c4 10             	add    $0x10,%esp
+  801a91:	eb cf                	jmp    801a62 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801a93:	83 c0 01             	add    $0x1,%eax
+  801a96:	89 fa                	mov    %edi,%edx
+  801a98:	09 da                	or     %ebx,%edx
+  801a9a:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801aa1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801aa7:	39 f3                	cmp    %esi,%ebx
+  801aa9:	72 e8                	jb     801a93 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801aab:	83 f8 41             	cmp    $0x41,%eax
+  801aae:	77 2f                	ja     801adf <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801ab0:	50                   	push   %eax
+  801ab1:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801ab7:	50                   	push   %eax
+  801ab8:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801abe:	ff 35 c8 70 80 00    	push   0x8070c8
+  801ac4:	e8 02 1b 00 00       	call   8035cb <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801ac9:	83 c4 0c             	add    $0xc,%esp
+  801acc:	6a 00                	push   $0x0
+  801ace:	6a 00                	push   $0x0
+  801ad0:	6a 00                	push   $0x0
+  801ad2:	e8 9e 19 00 00       	call   803475 <ipc_recv>
+}
+  801ad7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ada:	5b                   	pop    %ebx
+  801adb:	5e                   	pop    %esi
+  801adc:	5f                   	pop    %edi
+  801add:	5d                   	pop    %ebp
+  801ade:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801adf:	68 74 3e 80 00       	push   $0x803e74
+  801ae4:	68 ac 3d 80 00       	push   $0x803dac
+  801ae9:	6a 40                	push   $0x40
+  801aeb:	68 90 3e 80 00       	push   $0x803e90
+  801af0:	e8 41 e7 ff ff       	call   800236 <_panic>
+
+00801af5 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801af5:	55                   	push   %ebp
+  801af6:	89 e5                	mov    %esp,%ebp
+  801af8:	57                   	push   %edi
+  801af9:	56                   	push   %esi
+  801afa:	53                   	push   %ebx
+  801afb:	83 ec 1c             	sub    $0x1c,%esp
+  801afe:	89 c3                	mov    %eax,%ebx
+  801b00:	89 d6                	mov    %edx,%esi
+  801b02:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801b05:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801b0b:	89 ca                	mov    %ecx,%edx
+  801b0d:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801b10:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801b17:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801b1a:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801b21:	8b 76 0c             	mov    0xc(%esi),%esi
+  801b24:	89 fb                	mov    %edi,%ebx
+  801b26:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801b2d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b30:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801b37:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b3a:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801b41:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b44:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801b4b:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801b4e:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801b55:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801b5a:	39 c8                	cmp    %ecx,%eax
+  801b5c:	74 0d                	je     801b6b <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801b5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b66:	5b                   	pop    %ebx
+  801b67:	5e                   	pop    %esi
+  801b68:	5f                   	pop    %edi
+  801b69:	5d                   	pop    %ebp
+  801b6a:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b6b:	6a 07                	push   $0x7
+  801b6d:	68 00 60 80 00       	push   $0x806000
+  801b72:	6a 0d                	push   $0xd
+  801b74:	ff 35 c8 70 80 00    	push   0x8070c8
+  801b7a:	e8 61 19 00 00       	call   8034e0 <ipc_send>
+  801b7f:	83 c4 10             	add    $0x10,%esp
+  801b82:	eb da                	jmp    801b5e <fsring_post+0x69>
+
+00801b84 <fsipcv>:
+{
+  801b84:	55                   	push   %ebp
+  801b85:	89 e5                	mov    %esp,%ebp
+  801b87:	57                   	push   %edi
+  801b88:	56                   	push   %esi
+  801b89:	53                   	push   %ebx
+  801b8a:	83 ec 0c             	sub    $0xc,%esp
+  801b8d:	89 c7                	mov    %eax,%edi
+  801b8f:	89 d3                	mov    %edx,%ebx
+  801b91:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801b93:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801b9a:	74 26                	je     801bc2 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b9c:	6a 07                	push   $0x7
+  801b9e:	68 00 60 80 00       	push   $0x806000
+  801ba3:	57                   	push   %edi
+  801ba4:	ff 35 c8 70 80 00    	push   0x8070c8
+  801baa:	e8 31 19 00 00       	call   8034e0 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801baf:	6a 00                	push   $0x0
+  801bb1:	56                   	push   %esi
+  801bb2:	53                   	push   %ebx
+  801bb3:	6a 00                	push   $0x0
+  801bb5:	e8 7e 19 00 00       	call   803538 <ipc_recvv>
+}
+  801bba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bbd:	5b                   	pop    %ebx
+  801bbe:	5e                   	pop    %esi
+  801bbf:	5f                   	pop    %edi
+  801bc0:	5d                   	pop    %ebp
+  801bc1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801bc2:	83 ec 0c             	sub    $0xc,%esp
+  801bc5:	6a 01                	push   $0x1
+  801bc7:	e8 4d 1a 00 00       	call   803619 <ipc_find_env>
+  801bcc:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801bd1:	83 c4 10             	add    $0x10,%esp
+  801bd4:	eb c6                	jmp    801b9c <fsipcv+0x18>
+
+00801bd6 <fsipc>:
+{
+  801bd6:	55                   	push   %ebp
+  801bd7:	89 e5                	mov    %esp,%ebp
+  801bd9:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801bdc:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801be3:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801be6:	e8 99 ff ff ff       	call   801b84 <fsipcv>
+}
+  801beb:	c9                   	leave
+  801bec:	c3                   	ret
+
+00801bed <file_write_direct>:
+{
+  801bed:	55                   	push   %ebp
+  801bee:	89 e5                	mov    %esp,%ebp
+  801bf0:	56                   	push   %esi
+  801bf1:	53                   	push   %ebx
+  801bf2:	89 c3                	mov    %eax,%ebx
+  801bf4:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801bf6:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801bfc:	77 40                	ja     801c3e <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801bfe:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801c03:	39 c8                	cmp    %ecx,%eax
+  801c05:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c08:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801c0b:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  801c11:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801c16:	83 ec 04             	sub    $0x4,%esp
+  801c19:	50                   	push   %eax
+  801c1a:	52                   	push   %edx
+  801c1b:	68 08 60 80 00       	push   $0x806008
+  801c20:	e8 60 ee ff ff       	call   800a85 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801c25:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c2a:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c2f:	e8 a2 ff ff ff       	call   801bd6 <fsipc>
+  801c34:	83 c4 10             	add    $0x10,%esp
+}
+  801c37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c3a:	5b                   	pop    %ebx
+  801c3b:	5e                   	pop    %esi
+  801c3c:	5d                   	pop    %ebp
+  801c3d:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801c3e:	89 d6                	mov    %edx,%esi
+  801c40:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801c46:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801c4b:	29 f1                	sub    %esi,%ecx
+  801c4d:	39 c1                	cmp    %eax,%ecx
+  801c4f:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801c52:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c55:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801c5a:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801c60:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801c66:	83 ec 0c             	sub    $0xc,%esp
+  801c69:	6a 05                	push   $0x5
+  801c6b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c70:	e8 bf fd ff ff       	call   801a34 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801c75:	83 c4 10             	add    $0x10,%esp
+  801c78:	eb bd                	jmp    801c37 <file_write_direct+0x4a>
+
+00801c7a <devfile_sync>:
+{
+  801c7a:	55                   	push   %ebp
+  801c7b:	89 e5                	mov    %esp,%ebp
+  801c7d:	57                   	push   %edi
+  801c7e:	56                   	push   %esi
+  801c7f:	53                   	push   %ebx
+  801c80:	83 ec 28             	sub    $0x28,%esp
+  801c83:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801c86:	56                   	push   %esi
+  801c87:	e8 a5 f7 ff ff       	call   801431 <fd2data>
+  801c8c:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801c8e:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801c91:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801c98:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801ca0:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801ca4:	74 45                	je     801ceb <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801ca6:	8b 46 14             	mov    0x14(%esi),%eax
+  801ca9:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801cac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cb6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801cb9:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801cbc:	39 cb                	cmp    %ecx,%ebx
+  801cbe:	73 14                	jae    801cd4 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801cc0:	29 d9                	sub    %ebx,%ecx
+  801cc2:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801cc5:	89 f0                	mov    %esi,%eax
+  801cc7:	e8 21 ff ff ff       	call   801bed <file_write_direct>
+  801ccc:	85 c0                	test   %eax,%eax
+  801cce:	7e 04                	jle    801cd4 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801cd0:	01 c3                	add    %eax,%ebx
+  801cd2:	eb e5                	jmp    801cb9 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801cd4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801cd7:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801cde:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801ce1:	85 c0                	test   %eax,%eax
+  801ce3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce8:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801ceb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cee:	5b                   	pop    %ebx
+  801cef:	5e                   	pop    %esi
+  801cf0:	5f                   	pop    %edi
+  801cf1:	5d                   	pop    %ebp
+  801cf2:	c3                   	ret
+
+00801cf3 <devfile_write>:
+{
+  801cf3:	55                   	push   %ebp
+  801cf4:	89 e5                	mov    %esp,%ebp
+  801cf6:	57                   	push   %edi
+  801cf7:	56                   	push   %esi
+  801cf8:	53                   	push   %ebx
+  801cf9:	83 ec 28             	sub    $0x28,%esp
+  801cfc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801cff:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801d02:	53                   	push   %ebx
+  801d03:	e8 29 f7 ff ff       	call   801431 <fd2data>
+  801d08:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801d0b:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801d0e:	83 c4 10             	add    $0x10,%esp
+  801d11:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801d15:	74 43                	je     801d5a <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801d17:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801d1e:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801d21:	85 c0                	test   %eax,%eax
+  801d23:	74 43                	je     801d68 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801d25:	89 c2                	mov    %eax,%edx
+  801d27:	03 53 14             	add    0x14(%ebx),%edx
+  801d2a:	39 fa                	cmp    %edi,%edx
+  801d2c:	75 0b                	jne    801d39 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801d2e:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801d31:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801d37:	76 66                	jbe    801d9f <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801d39:	83 ec 0c             	sub    $0xc,%esp
+  801d3c:	53                   	push   %ebx
+  801d3d:	e8 38 ff ff ff       	call   801c7a <devfile_sync>
+  801d42:	83 c4 10             	add    $0x10,%esp
+  801d45:	85 c0                	test   %eax,%eax
+  801d47:	78 4e                	js     801d97 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801d49:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d4f:	77 56                	ja     801da7 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801d51:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801d54:	85 c0                	test   %eax,%eax
+  801d56:	75 20                	jne    801d78 <devfile_write+0x85>
+  801d58:	eb 16                	jmp    801d70 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801d5a:	89 f1                	mov    %esi,%ecx
+  801d5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d5f:	89 d8                	mov    %ebx,%eax
+  801d61:	e8 87 fe ff ff       	call   801bed <file_write_direct>
+  801d66:	eb 2f                	jmp    801d97 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801d68:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d6e:	77 37                	ja     801da7 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801d70:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801d73:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801d78:	83 ec 04             	sub    $0x4,%esp
+  801d7b:	56                   	push   %esi
+  801d7c:	ff 75 0c             	push   0xc(%ebp)
+  801d7f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d82:	01 c1                	add    %eax,%ecx
+  801d84:	51                   	push   %ecx
+  801d85:	e8 fb ec ff ff       	call   800a85 <memmove>
+	ff->buf_wlen += n;
+  801d8a:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801d8d:	01 f7                	add    %esi,%edi
+  801d8f:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801d92:	89 f0                	mov    %esi,%eax
+  801d94:	83 c4 10             	add    $0x10,%esp
+}
+  801d97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d9a:	5b                   	pop    %ebx
+  801d9b:	5e                   	pop    %esi
+  801d9c:	5f                   	pop    %edi
+  801d9d:	5d                   	pop    %ebp
+  801d9e:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801d9f:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801da5:	76 d1                	jbe    801d78 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801da7:	89 f1                	mov    %esi,%ecx
+  801da9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dac:	89 d8                	mov    %ebx,%eax
+  801dae:	e8 3a fe ff ff       	call   801bed <file_write_direct>
+  801db3:	eb e2                	jmp    801d97 <devfile_write+0xa4>
+
+00801db5 <devfile_trunc>:
+{
+  801db5:	55                   	push   %ebp
+  801db6:	89 e5                	mov    %esp,%ebp
+  801db8:	53                   	push   %ebx
+  801db9:	83 ec 10             	sub    $0x10,%esp
+  801dbc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801dbf:	53                   	push   %ebx
+  801dc0:	e8 b5 fe ff ff       	call   801c7a <devfile_sync>
+  801dc5:	83 c4 10             	add    $0x10,%esp
+  801dc8:	85 c0                	test   %eax,%eax
+  801dca:	78 1f                	js     801deb <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801dcc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801dcf:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801dd4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dd7:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ddc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801de1:	b8 02 00 00 00       	mov    $0x2,%eax
+  801de6:	e8 eb fd ff ff       	call   801bd6 <fsipc>
+}
+  801deb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dee:	c9                   	leave
+  801def:	c3                   	ret
+
+00801df0 <devfile_stat>:
+{
+  801df0:	55                   	push   %ebp
+  801df1:	89 e5                	mov    %esp,%ebp
+  801df3:	56                   	push   %esi
+  801df4:	53                   	push   %ebx
+  801df5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801df8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801dfb:	83 ec 0c             	sub    $0xc,%esp
+  801dfe:	53                   	push   %ebx
+  801dff:	e8 76 fe ff ff       	call   801c7a <devfile_sync>
+  801e04:	83 c4 10             	add    $0x10,%esp
+  801e07:	85 c0                	test   %eax,%eax
+  801e09:	78 47                	js     801e52 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e0b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801e0e:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e13:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e18:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e1d:	e8 b4 fd ff ff       	call   801bd6 <fsipc>
+  801e22:	85 c0                	test   %eax,%eax
+  801e24:	78 2c                	js     801e52 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e26:	83 ec 08             	sub    $0x8,%esp
+  801e29:	68 00 60 80 00       	push   $0x806000
+  801e2e:	56                   	push   %esi
+  801e2f:	e8 cb ea ff ff       	call   8008ff <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e34:	a1 80 60 80 00       	mov    0x806080,%eax
+  801e39:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e3f:	a1 84 60 80 00       	mov    0x806084,%eax
+  801e44:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801e4a:	83 c4 10             	add    $0x10,%esp
+  801e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e55:	5b                   	pop    %ebx
+  801e56:	5e                   	pop    %esi
+  801e57:	5d                   	pop    %ebp
+  801e58:	c3                   	ret
+
+00801e59 <devfile_flush>:
+{
+  801e59:	55                   	push   %ebp
+  801e5a:	89 e5                	mov    %esp,%ebp
+  801e5c:	56                   	push   %esi
+  801e5d:	53                   	push   %ebx
+  801e5e:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801e61:	83 ec 0c             	sub    $0xc,%esp
+  801e64:	56                   	push   %esi
+  801e65:	e8 10 fe ff ff       	call   801c7a <devfile_sync>
+  801e6a:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801e6c:	83 c4 10             	add    $0x10,%esp
+  801e6f:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801e73:	75 25                	jne    801e9a <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e75:	8b 46 0c             	mov    0xc(%esi),%eax
+  801e78:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801e7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e82:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e87:	e8 4a fd ff ff       	call   801bd6 <fsipc>
+  801e8c:	85 c0                	test   %eax,%eax
+  801e8e:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801e91:	89 d8                	mov    %ebx,%eax
+  801e93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e96:	5b                   	pop    %ebx
+  801e97:	5e                   	pop    %esi
+  801e98:	5d                   	pop    %ebp
+  801e99:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801e9a:	83 ec 0c             	sub    $0xc,%esp
+  801e9d:	56                   	push   %esi
+  801e9e:	e8 8e f5 ff ff       	call   801431 <fd2data>
+  801ea3:	83 c4 08             	add    $0x8,%esp
+  801ea6:	50                   	push   %eax
+  801ea7:	6a 00                	push   $0x0
+  801ea9:	e8 ea ee ff ff       	call   800d98 <sys_page_unmap>
+  801eae:	83 c4 10             	add    $0x10,%esp
+  801eb1:	eb c2                	jmp    801e75 <devfile_flush+0x1c>
+
+00801eb3 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801eb3:	55                   	push   %ebp
+  801eb4:	89 e5                	mov    %esp,%ebp
+  801eb6:	57                   	push   %edi
+  801eb7:	56                   	push   %esi
+  801eb8:	53                   	push   %ebx
+  801eb9:	83 ec 64             	sub    $0x64,%esp
+  801ebc:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801ebe:	52                   	push   %edx
+  801ebf:	50                   	push   %eax
+  801ec0:	e8 d9 f5 ff ff       	call   80149e <fd_lookup>
+  801ec5:	89 c1                	mov    %eax,%ecx
+  801ec7:	83 c4 10             	add    $0x10,%esp
+  801eca:	85 c0                	test   %eax,%eax
+  801ecc:	0f 88 f2 00 00 00    	js     801fc4 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801ed2:	8b 07                	mov    (%edi),%eax
+  801ed4:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801eda:	39 10                	cmp    %edx,(%eax)
+  801edc:	0f 85 03 01 00 00    	jne    801fe5 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801ee2:	a1 00 50 80 00       	mov    0x805000,%eax
+  801ee7:	8b 40 48             	mov    0x48(%eax),%eax
+  801eea:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801ef0:	0f 84 96 00 00 00    	je     801f8c <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801ef6:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801efd:	0f 84 cb 00 00 00    	je     801fce <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801f03:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801f08:	83 c8 07             	or     $0x7,%eax
+  801f0b:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801f0e:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801f11:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801f16:	83 ec 04             	sub    $0x4,%esp
+  801f19:	68 07 04 00 00       	push   $0x407
+  801f1e:	53                   	push   %ebx
+  801f1f:	6a 00                	push   $0x0
+  801f21:	e8 e5 ed ff ff       	call   800d0b <sys_page_alloc>
+  801f26:	89 c1                	mov    %eax,%ecx
+  801f28:	83 c4 10             	add    $0x10,%esp
+  801f2b:	85 c0                	test   %eax,%eax
+  801f2d:	0f 88 91 00 00 00    	js     801fc4 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801f33:	89 d8                	mov    %ebx,%eax
+  801f35:	83 c8 07             	or     $0x7,%eax
+  801f38:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801f3a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f40:	83 c6 04             	add    $0x4,%esi
+  801f43:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801f49:	75 cb                	jne    801f16 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801f4b:	6a 12                	push   $0x12
+  801f4d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801f50:	50                   	push   %eax
+  801f51:	6a 0c                	push   $0xc
+  801f53:	ff 35 c8 70 80 00    	push   0x8070c8
+  801f59:	e8 6d 16 00 00       	call   8035cb <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801f5e:	83 c4 0c             	add    $0xc,%esp
+  801f61:	6a 00                	push   $0x0
+  801f63:	6a 00                	push   $0x0
+  801f65:	6a 00                	push   $0x0
+  801f67:	e8 09 15 00 00       	call   803475 <ipc_recv>
+  801f6c:	89 c1                	mov    %eax,%ecx
+  801f6e:	83 c4 10             	add    $0x10,%esp
+  801f71:	85 c0                	test   %eax,%eax
+  801f73:	78 4f                	js     801fc4 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801f75:	a1 00 50 80 00       	mov    0x805000,%eax
+  801f7a:	8b 40 48             	mov    0x48(%eax),%eax
+  801f7d:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801f82:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801f89:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801f8c:	83 ec 0c             	sub    $0xc,%esp
+  801f8f:	ff 37                	push   (%edi)
+  801f91:	e8 e4 fc ff ff       	call   801c7a <devfile_sync>
+  801f96:	89 c1                	mov    %eax,%ecx
+  801f98:	83 c4 10             	add    $0x10,%esp
+  801f9b:	85 c0                	test   %eax,%eax
+  801f9d:	78 25                	js     801fc4 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801f9f:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801fa5:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801faa:	ba 01 00 00 00       	mov    $0x1,%edx
+  801faf:	89 d0                	mov    %edx,%eax
+  801fb1:	d3 e0                	shl    %cl,%eax
+  801fb3:	85 d8                	test   %ebx,%eax
+  801fb5:	74 0d                	je     801fc4 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801fb7:	83 c1 01             	add    $0x1,%ecx
+  801fba:	83 f9 10             	cmp    $0x10,%ecx
+  801fbd:	75 f0                	jne    801faf <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801fbf:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801fc4:	89 c8                	mov    %ecx,%eax
+  801fc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc9:	5b                   	pop    %ebx
+  801fca:	5e                   	pop    %esi
+  801fcb:	5f                   	pop    %edi
+  801fcc:	5d                   	pop    %ebp
+  801fcd:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fce:	83 ec 0c             	sub    $0xc,%esp
+  801fd1:	6a 01                	push   $0x1
+  801fd3:	e8 41 16 00 00       	call   803619 <ipc_find_env>
+  801fd8:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801fdd:	83 c4 10             	add    $0x10,%esp
+  801fe0:	e9 1e ff ff ff       	jmp    801f03 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801fe5:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801fea:	eb d8                	jmp    801fc4 <fsring_slot+0x111>
+
+00801fec <file_read_direct>:
+{
+  801fec:	55                   	push   %ebp
+  801fed:	89 e5                	mov    %esp,%ebp
+  801fef:	57                   	push   %edi
+  801ff0:	56                   	push   %esi
+  801ff1:	53                   	push   %ebx
+  801ff2:	83 ec 1c             	sub    $0x1c,%esp
+  801ff5:	89 c7                	mov    %eax,%edi
+  801ff7:	89 d6                	mov    %edx,%esi
+  801ff9:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801ffb:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  802001:	77 52                	ja     802055 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802003:	8b 40 0c             	mov    0xc(%eax),%eax
+  802006:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  80200b:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802011:	ba 00 00 00 00       	mov    $0x0,%edx
+  802016:	b8 03 00 00 00       	mov    $0x3,%eax
+  80201b:	e8 b6 fb ff ff       	call   801bd6 <fsipc>
+  802020:	89 c7                	mov    %eax,%edi
+  802022:	85 c0                	test   %eax,%eax
+  802024:	78 25                	js     80204b <file_read_direct+0x5f>
+	assert(r <= n);
+  802026:	39 c3                	cmp    %eax,%ebx
+  802028:	0f 82 87 00 00 00    	jb     8020b5 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  80202e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802033:	0f 8f 95 00 00 00    	jg     8020ce <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802039:	83 ec 04             	sub    $0x4,%esp
+  80203c:	50                   	push   %eax
+  80203d:	68 00 60 80 00       	push   $0x806000
+  802042:	56                   	push   %esi
+  802043:	e8 3d ea ff ff       	call   800a85 <memmove>
+	return r;
+  802048:	83 c4 10             	add    $0x10,%esp
+}
+  80204b:	89 f8                	mov    %edi,%eax
+  80204d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802050:	5b                   	pop    %ebx
+  802051:	5e                   	pop    %esi
+  802052:	5f                   	pop    %edi
+  802053:	5d                   	pop    %ebp
+  802054:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802055:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80205b:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802060:	29 d1                	sub    %edx,%ecx
+  802062:	39 d9                	cmp    %ebx,%ecx
+  802064:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802067:	89 f0                	mov    %esi,%eax
+  802069:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  80206c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80206f:	eb 0f                	jmp    802080 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  802071:	0f b6 10             	movzbl (%eax),%edx
+  802074:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802076:	05 00 10 00 00       	add    $0x1000,%eax
+  80207b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802080:	39 c8                	cmp    %ecx,%eax
+  802082:	72 ed                	jb     802071 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802084:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802087:	8b 47 0c             	mov    0xc(%edi),%eax
+  80208a:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  80208f:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802095:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  80209b:	83 ec 0c             	sub    $0xc,%esp
+  80209e:	6a 07                	push   $0x7
+  8020a0:	89 d9                	mov    %ebx,%ecx
+  8020a2:	89 f2                	mov    %esi,%edx
+  8020a4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020a9:	e8 86 f9 ff ff       	call   801a34 <fsipc_pages>
+  8020ae:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  8020b0:	83 c4 10             	add    $0x10,%esp
+  8020b3:	eb 96                	jmp    80204b <file_read_direct+0x5f>
+	assert(r <= n);
+  8020b5:	68 9b 3e 80 00       	push   $0x803e9b
+  8020ba:	68 ac 3d 80 00       	push   $0x803dac
+  8020bf:	68 dc 00 00 00       	push   $0xdc
+  8020c4:	68 90 3e 80 00       	push   $0x803e90
+  8020c9:	e8 68 e1 ff ff       	call   800236 <_panic>
+	assert(r <= PGSIZE);
+  8020ce:	68 ac 3e 80 00       	push   $0x803eac
+  8020d3:	68 ac 3d 80 00       	push   $0x803dac
+  8020d8:	68 dd 00 00 00       	push   $0xdd
+  8020dd:	68 90 3e 80 00       	push   $0x803e90
+  8020e2:	e8 4f e1 ff ff       	call   800236 <_panic>
+
+008020e7 <devfile_read>:
+{
+  8020e7:	55                   	push   %ebp
+  8020e8:	89 e5                	mov    %esp,%ebp
+  8020ea:	57                   	push   %edi
+  8020eb:	56                   	push   %esi
+  8020ec:	53                   	push   %ebx
+  8020ed:	83 ec 28             	sub    $0x28,%esp
+  8020f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020f3:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8020f6:	53                   	push   %ebx
+  8020f7:	e8 35 f3 ff ff       	call   801431 <fd2data>
+  8020fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8020ff:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  802102:	83 c4 10             	add    $0x10,%esp
+  802105:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  802109:	74 7d                	je     802188 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80210b:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80210f:	0f 85 81 00 00 00    	jne    802196 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  802115:	8b 43 18             	mov    0x18(%ebx),%eax
+  802118:	85 c0                	test   %eax,%eax
+  80211a:	74 0d                	je     802129 <devfile_read+0x42>
+  80211c:	8b 53 14             	mov    0x14(%ebx),%edx
+  80211f:	39 fa                	cmp    %edi,%edx
+  802121:	7f 06                	jg     802129 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  802123:	01 c2                	add    %eax,%edx
+  802125:	39 d7                	cmp    %edx,%edi
+  802127:	72 28                	jb     802151 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  802129:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  802130:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802136:	77 74                	ja     8021ac <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  802138:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80213d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802140:	89 d8                	mov    %ebx,%eax
+  802142:	e8 a5 fe ff ff       	call   801fec <file_read_direct>
+  802147:	85 c0                	test   %eax,%eax
+  802149:	7e 35                	jle    802180 <devfile_read+0x99>
+		ff->buf_base = pos;
+  80214b:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  80214e:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  802151:	8b 53 14             	mov    0x14(%ebx),%edx
+  802154:	89 d0                	mov    %edx,%eax
+  802156:	03 43 18             	add    0x18(%ebx),%eax
+  802159:	29 f8                	sub    %edi,%eax
+  80215b:	39 f0                	cmp    %esi,%eax
+  80215d:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  802160:	83 ec 04             	sub    $0x4,%esp
+  802163:	56                   	push   %esi
+  802164:	89 f8                	mov    %edi,%eax
+  802166:	29 d0                	sub    %edx,%eax
+  802168:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80216b:	01 c1                	add    %eax,%ecx
+  80216d:	51                   	push   %ecx
+  80216e:	ff 75 0c             	push   0xc(%ebp)
+  802171:	e8 0f e9 ff ff       	call   800a85 <memmove>
+	fd->fd_offset = pos + n;
+  802176:	01 f7                	add    %esi,%edi
+  802178:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80217b:	89 f0                	mov    %esi,%eax
+  80217d:	83 c4 10             	add    $0x10,%esp
+}
+  802180:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802183:	5b                   	pop    %ebx
+  802184:	5e                   	pop    %esi
+  802185:	5f                   	pop    %edi
+  802186:	5d                   	pop    %ebp
+  802187:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802188:	89 f1                	mov    %esi,%ecx
+  80218a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80218d:	89 d8                	mov    %ebx,%eax
+  80218f:	e8 58 fe ff ff       	call   801fec <file_read_direct>
+  802194:	eb ea                	jmp    802180 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802196:	83 ec 0c             	sub    $0xc,%esp
+  802199:	53                   	push   %ebx
+  80219a:	e8 db fa ff ff       	call   801c7a <devfile_sync>
+  80219f:	83 c4 10             	add    $0x10,%esp
+  8021a2:	85 c0                	test   %eax,%eax
+  8021a4:	0f 89 6b ff ff ff    	jns    802115 <devfile_read+0x2e>
+  8021aa:	eb d4                	jmp    802180 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  8021ac:	89 f1                	mov    %esi,%ecx
+  8021ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021b1:	89 d8                	mov    %ebx,%eax
+  8021b3:	e8 34 fe ff ff       	call   801fec <file_read_direct>
+  8021b8:	eb c6                	jmp    802180 <devfile_read+0x99>
+
+008021ba <open>:
+{
+  8021ba:	55                   	push   %ebp
+  8021bb:	89 e5                	mov    %esp,%ebp
+  8021bd:	56                   	push   %esi
+  8021be:	53                   	push   %ebx
+  8021bf:	83 ec 1c             	sub    $0x1c,%esp
+  8021c2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8021c5:	56                   	push   %esi
+  8021c6:	e8 f9 e6 ff ff       	call   8008c4 <strlen>
+  8021cb:	83 c4 10             	add    $0x10,%esp
+  8021ce:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021d3:	0f 8f a0 00 00 00    	jg     802279 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  8021d9:	83 ec 0c             	sub    $0xc,%esp
+  8021dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021df:	50                   	push   %eax
+  8021e0:	e8 63 f2 ff ff       	call   801448 <fd_alloc>
+  8021e5:	89 c3                	mov    %eax,%ebx
+  8021e7:	83 c4 10             	add    $0x10,%esp
+  8021ea:	85 c0                	test   %eax,%eax
+  8021ec:	78 45                	js     802233 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  8021ee:	83 ec 08             	sub    $0x8,%esp
+  8021f1:	56                   	push   %esi
+  8021f2:	68 00 60 80 00       	push   $0x806000
+  8021f7:	e8 03 e7 ff ff       	call   8008ff <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021ff:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802204:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802207:	b8 01 00 00 00       	mov    $0x1,%eax
+  80220c:	e8 c5 f9 ff ff       	call   801bd6 <fsipc>
+  802211:	89 c3                	mov    %eax,%ebx
+  802213:	83 c4 10             	add    $0x10,%esp
+  802216:	85 c0                	test   %eax,%eax
+  802218:	78 22                	js     80223c <open+0x82>
+	if (!(mode & O_NOBUF)
+  80221a:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  802221:	74 2b                	je     80224e <open+0x94>
+	return fd2num(fd);
+  802223:	83 ec 0c             	sub    $0xc,%esp
+  802226:	ff 75 f4             	push   -0xc(%ebp)
+  802229:	e8 f3 f1 ff ff       	call   801421 <fd2num>
+  80222e:	89 c3                	mov    %eax,%ebx
+  802230:	83 c4 10             	add    $0x10,%esp
+}
+  802233:	89 d8                	mov    %ebx,%eax
+  802235:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802238:	5b                   	pop    %ebx
+  802239:	5e                   	pop    %esi
+  80223a:	5d                   	pop    %ebp
+  80223b:	c3                   	ret
+		fd_close(fd, 0);
+  80223c:	83 ec 08             	sub    $0x8,%esp
+  80223f:	6a 00                	push   $0x0
+  802241:	ff 75 f4             	push   -0xc(%ebp)
+  802244:	e8 f8 f2 ff ff       	call   801541 <fd_close>
+		return r;
+  802249:	83 c4 10             	add    $0x10,%esp
+  80224c:	eb e5                	jmp    802233 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  80224e:	83 ec 0c             	sub    $0xc,%esp
+  802251:	ff 75 f4             	push   -0xc(%ebp)
+  802254:	e8 d8 f1 ff ff       	call   801431 <fd2data>
+  802259:	83 c4 0c             	add    $0xc,%esp
+  80225c:	68 07 04 00 00       	push   $0x407
+  802261:	50                   	push   %eax
+  802262:	6a 00                	push   $0x0
+  802264:	e8 a2 ea ff ff       	call   800d0b <sys_page_alloc>
+  802269:	83 c4 10             	add    $0x10,%esp
+  80226c:	85 c0                	test   %eax,%eax
+  80226e:	75 b3                	jne    802223 <open+0x69>
+		fd->fd_file.buffered = 1;
+  802270:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802273:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802277:	eb aa                	jmp    802223 <open+0x69>
+		return -E_BAD_PATH;
+  802279:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80227e:	eb b3                	jmp    802233 <open+0x79>
+
+00802280 <readdir>:
+{
+  802280:	55                   	push   %ebp
+  802281:	89 e5                	mov    %esp,%ebp
+  802283:	53                   	push   %ebx
+  802284:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802287:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80228a:	50                   	push   %eax
+  80228b:	ff 75 08             	push   0x8(%ebp)
+  80228e:	e8 0b f2 ff ff       	call   80149e <fd_lookup>
+  802293:	89 c3                	mov    %eax,%ebx
+  802295:	83 c4 10             	add    $0x10,%esp
+  802298:	85 c0                	test   %eax,%eax
+  80229a:	78 73                	js     80230f <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80229c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80229f:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8022a5:	39 08                	cmp    %ecx,(%eax)
+  8022a7:	0f 85 82 00 00 00    	jne    80232f <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  8022ad:	83 ec 0c             	sub    $0xc,%esp
+  8022b0:	50                   	push   %eax
+  8022b1:	e8 c4 f9 ff ff       	call   801c7a <devfile_sync>
+  8022b6:	89 c3                	mov    %eax,%ebx
+  8022b8:	83 c4 10             	add    $0x10,%esp
+  8022bb:	85 c0                	test   %eax,%eax
+  8022bd:	78 50                	js     80230f <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  8022bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022c2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022c5:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  8022ca:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022cd:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  8022d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022d5:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  8022da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022df:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8022e4:	e8 ed f8 ff ff       	call   801bd6 <fsipc>
+  8022e9:	89 c3                	mov    %eax,%ebx
+  8022eb:	85 c0                	test   %eax,%eax
+  8022ed:	7e 20                	jle    80230f <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  8022ef:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8022f2:	72 22                	jb     802316 <readdir+0x96>
+  8022f4:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8022f9:	7f 1b                	jg     802316 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8022fb:	83 ec 04             	sub    $0x4,%esp
+  8022fe:	50                   	push   %eax
+  8022ff:	68 00 60 80 00       	push   $0x806000
+  802304:	ff 75 0c             	push   0xc(%ebp)
+  802307:	e8 79 e7 ff ff       	call   800a85 <memmove>
+	return r;
+  80230c:	83 c4 10             	add    $0x10,%esp
+}
+  80230f:	89 d8                	mov    %ebx,%eax
+  802311:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802314:	c9                   	leave
+  802315:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  802316:	68 a2 3e 80 00       	push   $0x803ea2
+  80231b:	68 ac 3d 80 00       	push   $0x803dac
+  802320:	68 86 01 00 00       	push   $0x186
+  802325:	68 90 3e 80 00       	push   $0x803e90
+  80232a:	e8 07 df ff ff       	call   800236 <_panic>
+		return -E_NOT_SUPP;
+  80232f:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802334:	eb d9                	jmp    80230f <readdir+0x8f>
+
+00802336 <munmap>:
+{
+  802336:	55                   	push   %ebp
+  802337:	89 e5                	mov    %esp,%ebp
+  802339:	56                   	push   %esi
+  80233a:	53                   	push   %ebx
+  80233b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80233e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802341:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  802347:	75 41                	jne    80238a <munmap+0x54>
+  802349:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  80234f:	77 39                	ja     80238a <munmap+0x54>
+  802351:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802356:	29 f0                	sub    %esi,%eax
+  802358:	39 d0                	cmp    %edx,%eax
+  80235a:	72 35                	jb     802391 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80235c:	89 f3                	mov    %esi,%ebx
+  80235e:	01 d6                	add    %edx,%esi
+  802360:	39 f3                	cmp    %esi,%ebx
+  802362:	73 1a                	jae    80237e <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802364:	83 ec 08             	sub    $0x8,%esp
+  802367:	53                   	push   %ebx
+  802368:	6a 00                	push   $0x0
+  80236a:	e8 29 ea ff ff       	call   800d98 <sys_page_unmap>
+  80236f:	83 c4 10             	add    $0x10,%esp
+  802372:	85 c0                	test   %eax,%eax
+  802374:	78 0d                	js     802383 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802376:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80237c:	eb e2                	jmp    802360 <munmap+0x2a>
+	return 0;
+  80237e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802383:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802386:	5b                   	pop    %ebx
+  802387:	5e                   	pop    %esi
+  802388:	5d                   	pop    %ebp
+  802389:	c3                   	ret
+		return -E_INVAL;
+  80238a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80238f:	eb f2                	jmp    802383 <munmap+0x4d>
+  802391:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802396:	eb eb                	jmp    802383 <munmap+0x4d>
+
+00802398 <mmap>:
+{
+  802398:	55                   	push   %ebp
+  802399:	89 e5                	mov    %esp,%ebp
+  80239b:	57                   	push   %edi
+  80239c:	56                   	push   %esi
+  80239d:	53                   	push   %ebx
+  80239e:	83 ec 34             	sub    $0x34,%esp
+  8023a1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023a4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8023a7:	50                   	push   %eax
+  8023a8:	ff 75 18             	push   0x18(%ebp)
+  8023ab:	e8 ee f0 ff ff       	call   80149e <fd_lookup>
+  8023b0:	89 c3                	mov    %eax,%ebx
+  8023b2:	83 c4 10             	add    $0x10,%esp
+  8023b5:	85 c0                	test   %eax,%eax
+  8023b7:	0f 88 0e 01 00 00    	js     8024cb <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  8023bd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8023c0:	a1 20 40 80 00       	mov    0x804020,%eax
+  8023c5:	39 02                	cmp    %eax,(%edx)
+  8023c7:	0f 85 50 01 00 00    	jne    80251d <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  8023cd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023d0:	83 e0 02             	and    $0x2,%eax
+  8023d3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8023d6:	74 0a                	je     8023e2 <mmap+0x4a>
+  8023d8:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8023dc:	0f 84 42 01 00 00    	je     802524 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  8023e2:	8b 42 08             	mov    0x8(%edx),%eax
+  8023e5:	83 e0 03             	and    $0x3,%eax
+  8023e8:	83 f8 01             	cmp    $0x1,%eax
+  8023eb:	0f 84 3a 01 00 00    	je     80252b <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8023f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f4:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8023f7:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8023fc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8023ff:	0f 85 2d 01 00 00    	jne    802532 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802405:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802409:	0f 88 2a 01 00 00    	js     802539 <mmap+0x1a1>
+  80240f:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  802416:	0f 87 1d 01 00 00    	ja     802539 <mmap+0x1a1>
+  80241c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802421:	2b 45 08             	sub    0x8(%ebp),%eax
+  802424:	39 f8                	cmp    %edi,%eax
+  802426:	0f 82 14 01 00 00    	jb     802540 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  80242c:	83 ec 0c             	sub    $0xc,%esp
+  80242f:	52                   	push   %edx
+  802430:	e8 45 f8 ff ff       	call   801c7a <devfile_sync>
+  802435:	89 c3                	mov    %eax,%ebx
+  802437:	83 c4 10             	add    $0x10,%esp
+  80243a:	85 c0                	test   %eax,%eax
+  80243c:	0f 88 89 00 00 00    	js     8024cb <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802442:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802448:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80244e:	be 00 00 00 00       	mov    $0x0,%esi
+  802453:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802456:	39 fe                	cmp    %edi,%esi
+  802458:	73 7b                	jae    8024d5 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  80245a:	89 f8                	mov    %edi,%eax
+  80245c:	29 f0                	sub    %esi,%eax
+  80245e:	c1 e8 0c             	shr    $0xc,%eax
+  802461:	ba 40 00 00 00       	mov    $0x40,%edx
+  802466:	39 d0                	cmp    %edx,%eax
+  802468:	0f 47 c2             	cmova  %edx,%eax
+  80246b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80246e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802471:	8b 52 0c             	mov    0xc(%edx),%edx
+  802474:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  80247a:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  80247d:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  802483:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802488:	89 f2                	mov    %esi,%edx
+  80248a:	03 55 08             	add    0x8(%ebp),%edx
+  80248d:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802490:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802495:	e8 ea f6 ff ff       	call   801b84 <fsipcv>
+  80249a:	85 c0                	test   %eax,%eax
+  80249c:	7e 12                	jle    8024b0 <mmap+0x118>
+  80249e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8024a1:	85 c0                	test   %eax,%eax
+  8024a3:	0f 84 9e 00 00 00    	je     802547 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8024a9:	c1 e0 0c             	shl    $0xc,%eax
+  8024ac:	01 c6                	add    %eax,%esi
+  8024ae:	eb a6                	jmp    802456 <mmap+0xbe>
+			munmap(addr, done);
+  8024b0:	89 c3                	mov    %eax,%ebx
+  8024b2:	83 ec 08             	sub    $0x8,%esp
+  8024b5:	56                   	push   %esi
+  8024b6:	ff 75 08             	push   0x8(%ebp)
+  8024b9:	e8 78 fe ff ff       	call   802336 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  8024be:	83 c4 10             	add    $0x10,%esp
+  8024c1:	85 db                	test   %ebx,%ebx
+  8024c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024c8:	0f 49 d8             	cmovns %eax,%ebx
+}
+  8024cb:	89 d8                	mov    %ebx,%eax
+  8024cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024d0:	5b                   	pop    %ebx
+  8024d1:	5e                   	pop    %esi
+  8024d2:	5f                   	pop    %edi
+  8024d3:	5d                   	pop    %ebp
+  8024d4:	c3                   	ret
+	if (prot & PROT_WRITE)
+  8024d5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8024d8:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8024da:	85 c0                	test   %eax,%eax
+  8024dc:	74 ed                	je     8024cb <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8024de:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8024e6:	39 fe                	cmp    %edi,%esi
+  8024e8:	73 2e                	jae    802518 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8024ea:	83 ec 0c             	sub    $0xc,%esp
+  8024ed:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8024f0:	50                   	push   %eax
+  8024f1:	e8 2d ed ff ff       	call   801223 <cowpage>
+  8024f6:	83 c4 10             	add    $0x10,%esp
+  8024f9:	85 c0                	test   %eax,%eax
+  8024fb:	78 08                	js     802505 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8024fd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802503:	eb e1                	jmp    8024e6 <mmap+0x14e>
+				munmap(addr, len);
+  802505:	89 c3                	mov    %eax,%ebx
+  802507:	83 ec 08             	sub    $0x8,%esp
+  80250a:	57                   	push   %edi
+  80250b:	ff 75 08             	push   0x8(%ebp)
+  80250e:	e8 23 fe ff ff       	call   802336 <munmap>
+				return r;
+  802513:	83 c4 10             	add    $0x10,%esp
+  802516:	eb b3                	jmp    8024cb <mmap+0x133>
+	return 0;
+  802518:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80251b:	eb ae                	jmp    8024cb <mmap+0x133>
+		return -E_NOT_SUPP;
+  80251d:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802522:	eb a7                	jmp    8024cb <mmap+0x133>
+		return -E_NOT_SUPP;
+  802524:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802529:	eb a0                	jmp    8024cb <mmap+0x133>
+		return -E_INVAL;
+  80252b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802530:	eb 99                	jmp    8024cb <mmap+0x133>
+  802532:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802537:	eb 92                	jmp    8024cb <mmap+0x133>
+  802539:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80253e:	eb 8b                	jmp    8024cb <mmap+0x133>
+  802540:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802545:	eb 84                	jmp    8024cb <mmap+0x133>
+			munmap(addr, done);
+  802547:	83 ec 08             	sub    $0x8,%esp
+  80254a:	56                   	push   %esi
+  80254b:	ff 75 08             	push   0x8(%ebp)
+  80254e:	e8 e3 fd ff ff       	call   802336 <munmap>
+  802553:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802556:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80255b:	e9 6b ff ff ff       	jmp    8024cb <mmap+0x133>
+
+00802560 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802560:	55                   	push   %ebp
+  802561:	89 e5                	mov    %esp,%ebp
+  802563:	56                   	push   %esi
+  802564:	53                   	push   %ebx
+  802565:	83 ec 10             	sub    $0x10,%esp
+  802568:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80256b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80256e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802571:	e8 3d f9 ff ff       	call   801eb3 <fsring_slot>
+  802576:	85 c0                	test   %eax,%eax
+  802578:	78 60                	js     8025da <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80257a:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80257d:	8b 56 08             	mov    0x8(%esi),%edx
+  802580:	83 e2 03             	and    $0x3,%edx
+  802583:	83 fa 01             	cmp    $0x1,%edx
+  802586:	74 59                	je     8025e1 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802588:	ba 01 00 00 00       	mov    $0x1,%edx
+  80258d:	89 c1                	mov    %eax,%ecx
+  80258f:	d3 e2                	shl    %cl,%edx
+  802591:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802597:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80259a:	c1 e2 02             	shl    $0x2,%edx
+  80259d:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8025a3:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  8025aa:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8025ad:	8b 55 18             	mov    0x18(%ebp),%edx
+  8025b0:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8025b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025b6:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8025b9:	83 ec 08             	sub    $0x8,%esp
+  8025bc:	50                   	push   %eax
+  8025bd:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8025c2:	39 c3                	cmp    %eax,%ebx
+  8025c4:	0f 47 d8             	cmova  %eax,%ebx
+  8025c7:	53                   	push   %ebx
+  8025c8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8025cb:	89 f2                	mov    %esi,%edx
+  8025cd:	b8 03 00 00 00       	mov    $0x3,%eax
+  8025d2:	e8 1e f5 ff ff       	call   801af5 <fsring_post>
+  8025d7:	83 c4 10             	add    $0x10,%esp
+}
+  8025da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025dd:	5b                   	pop    %ebx
+  8025de:	5e                   	pop    %esi
+  8025df:	5d                   	pop    %ebp
+  8025e0:	c3                   	ret
+		return -E_INVAL;
+  8025e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025e6:	eb f2                	jmp    8025da <fsring_read+0x7a>
+
+008025e8 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8025e8:	55                   	push   %ebp
+  8025e9:	89 e5                	mov    %esp,%ebp
+  8025eb:	56                   	push   %esi
+  8025ec:	53                   	push   %ebx
+  8025ed:	83 ec 10             	sub    $0x10,%esp
+  8025f0:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8025f3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f9:	e8 b5 f8 ff ff       	call   801eb3 <fsring_slot>
+  8025fe:	89 c3                	mov    %eax,%ebx
+  802600:	85 c0                	test   %eax,%eax
+  802602:	78 77                	js     80267b <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802604:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802607:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80260b:	74 77                	je     802684 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80260d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802612:	39 c6                	cmp    %eax,%esi
+  802614:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802617:	83 ec 04             	sub    $0x4,%esp
+  80261a:	56                   	push   %esi
+  80261b:	ff 75 0c             	push   0xc(%ebp)
+  80261e:	89 d8                	mov    %ebx,%eax
+  802620:	c1 e0 0c             	shl    $0xc,%eax
+  802623:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802629:	50                   	push   %eax
+  80262a:	e8 56 e4 ff ff       	call   800a85 <memmove>
+	fsring_busy |= 1 << slot;
+  80262f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802634:	89 d9                	mov    %ebx,%ecx
+  802636:	d3 e0                	shl    %cl,%eax
+  802638:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  80263e:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802641:	c1 e0 02             	shl    $0x2,%eax
+  802644:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  80264a:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  802651:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802654:	8b 45 18             	mov    0x18(%ebp),%eax
+  802657:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80265a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802661:	83 c4 08             	add    $0x8,%esp
+  802664:	53                   	push   %ebx
+  802665:	56                   	push   %esi
+  802666:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802669:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80266c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802671:	e8 7f f4 ff ff       	call   801af5 <fsring_post>
+  802676:	89 c3                	mov    %eax,%ebx
+  802678:	83 c4 10             	add    $0x10,%esp
+}
+  80267b:	89 d8                	mov    %ebx,%eax
+  80267d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802680:	5b                   	pop    %ebx
+  802681:	5e                   	pop    %esi
+  802682:	5d                   	pop    %ebp
+  802683:	c3                   	ret
+		return -E_INVAL;
+  802684:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802689:	eb f0                	jmp    80267b <fsring_write+0x93>
+
+0080268b <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80268b:	55                   	push   %ebp
+  80268c:	89 e5                	mov    %esp,%ebp
+  80268e:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802691:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802694:	8b 45 08             	mov    0x8(%ebp),%eax
+  802697:	e8 17 f8 ff ff       	call   801eb3 <fsring_slot>
+  80269c:	85 c0                	test   %eax,%eax
+  80269e:	78 4c                	js     8026ec <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8026a0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8026a5:	89 c1                	mov    %eax,%ecx
+  8026a7:	d3 e2                	shl    %cl,%edx
+  8026a9:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8026af:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8026b2:	c1 e2 02             	shl    $0x2,%edx
+  8026b5:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8026bb:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  8026c2:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8026c5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8026c8:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8026cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8026ce:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  8026d1:	83 ec 08             	sub    $0x8,%esp
+  8026d4:	50                   	push   %eax
+  8026d5:	6a 00                	push   $0x0
+  8026d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026df:	b8 05 00 00 00       	mov    $0x5,%eax
+  8026e4:	e8 0c f4 ff ff       	call   801af5 <fsring_post>
+  8026e9:	83 c4 10             	add    $0x10,%esp
+}
+  8026ec:	c9                   	leave
+  8026ed:	c3                   	ret
+
+008026ee <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8026ee:	55                   	push   %ebp
+  8026ef:	89 e5                	mov    %esp,%ebp
+  8026f1:	57                   	push   %edi
+  8026f2:	56                   	push   %esi
+  8026f3:	53                   	push   %ebx
+  8026f4:	83 ec 1c             	sub    $0x1c,%esp
+  8026f7:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8026fb:	a1 00 50 80 00       	mov    0x805000,%eax
+  802700:	8b 40 48             	mov    0x48(%eax),%eax
+  802703:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  802709:	74 12                	je     80271d <fsring_reap+0x2f>
+		return 0;
+  80270b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802710:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802713:	5b                   	pop    %ebx
+  802714:	5e                   	pop    %esi
+  802715:	5f                   	pop    %edi
+  802716:	5d                   	pop    %ebp
+  802717:	c3                   	ret
+		sys_yield();
+  802718:	e8 cf e5 ff ff       	call   800cec <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  80271d:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802723:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802728:	39 c2                	cmp    %eax,%edx
+  80272a:	75 18                	jne    802744 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  80272c:	84 db                	test   %bl,%bl
+  80272e:	0f 84 21 01 00 00    	je     802855 <fsring_reap+0x167>
+  802734:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  80273b:	75 db                	jne    802718 <fsring_reap+0x2a>
+			return 0;
+  80273d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802742:	eb cc                	jmp    802710 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802744:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802749:	83 e0 0f             	and    $0xf,%eax
+  80274c:	83 c0 2a             	add    $0x2a,%eax
+  80274f:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802756:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  80275d:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802762:	83 c0 01             	add    $0x1,%eax
+  802765:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  80276a:	83 fb 0f             	cmp    $0xf,%ebx
+  80276d:	77 5b                	ja     8027ca <fsring_reap+0xdc>
+  80276f:	be 01 00 00 00       	mov    $0x1,%esi
+  802774:	89 d9                	mov    %ebx,%ecx
+  802776:	d3 e6                	shl    %cl,%esi
+  802778:	89 f0                	mov    %esi,%eax
+  80277a:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  802780:	74 48                	je     8027ca <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802782:	89 d8                	mov    %ebx,%eax
+  802784:	c1 e0 0c             	shl    $0xc,%eax
+  802787:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80278d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802790:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802793:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  80279a:	83 f8 03             	cmp    $0x3,%eax
+  80279d:	74 40                	je     8027df <fsring_reap+0xf1>
+  80279f:	83 f8 05             	cmp    $0x5,%eax
+  8027a2:	74 64                	je     802808 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8027a4:	f7 d6                	not    %esi
+  8027a6:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8027ac:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8027af:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  8027b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027b9:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8027bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027be:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8027c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027c5:	e9 46 ff ff ff       	jmp    802710 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8027ca:	53                   	push   %ebx
+  8027cb:	68 b8 3e 80 00       	push   $0x803eb8
+  8027d0:	68 8f 02 00 00       	push   $0x28f
+  8027d5:	68 90 3e 80 00       	push   $0x803e90
+  8027da:	e8 57 da ff ff       	call   800236 <_panic>
+		if (cqe.cqe_result > 0)
+  8027df:	85 ff                	test   %edi,%edi
+  8027e1:	7e c1                	jle    8027a4 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8027e3:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8027e6:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8027eb:	39 c7                	cmp    %eax,%edi
+  8027ed:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8027f0:	50                   	push   %eax
+  8027f1:	ff 75 e4             	push   -0x1c(%ebp)
+  8027f4:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8027f7:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  8027fe:	e8 82 e2 ff ff       	call   800a85 <memmove>
+  802803:	83 c4 10             	add    $0x10,%esp
+  802806:	eb 9c                	jmp    8027a4 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802808:	85 ff                	test   %edi,%edi
+  80280a:	75 98                	jne    8027a4 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80280c:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80280f:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802816:	83 ec 08             	sub    $0x8,%esp
+  802819:	ff 75 e4             	push   -0x1c(%ebp)
+  80281c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80281f:	51                   	push   %ecx
+  802820:	e8 da e0 ff ff       	call   8008ff <strcpy>
+			st->st_size = ret->ret_size;
+  802825:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802828:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  80282e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802831:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802837:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  80283d:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802843:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  80284a:	40 80 00 
+  80284d:	83 c4 10             	add    $0x10,%esp
+  802850:	e9 4f ff ff ff       	jmp    8027a4 <fsring_reap+0xb6>
+			return 0;
+  802855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285a:	e9 b1 fe ff ff       	jmp    802710 <fsring_reap+0x22>
+
+0080285f <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  80285f:	55                   	push   %ebp
+  802860:	89 e5                	mov    %esp,%ebp
+  802862:	57                   	push   %edi
+  802863:	56                   	push   %esi
+  802864:	53                   	push   %ebx
+  802865:	83 ec 28             	sub    $0x28,%esp
+  802868:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80286b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80286e:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802871:	53                   	push   %ebx
+  802872:	e8 4d e0 ff ff       	call   8008c4 <strlen>
+  802877:	83 c4 10             	add    $0x10,%esp
+  80287a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80287f:	0f 8f 02 01 00 00    	jg     802987 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802885:	83 ec 08             	sub    $0x8,%esp
+  802888:	53                   	push   %ebx
+  802889:	68 00 60 80 00       	push   $0x806000
+  80288e:	e8 6c e0 ff ff       	call   8008ff <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802893:	83 c4 10             	add    $0x10,%esp
+  802896:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  80289c:	76 69                	jbe    802907 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80289e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028a1:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8028a7:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8028ac:	29 d1                	sub    %edx,%ecx
+  8028ae:	39 f9                	cmp    %edi,%ecx
+  8028b0:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8028b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028b6:	89 f9                	mov    %edi,%ecx
+  8028b8:	01 c1                	add    %eax,%ecx
+  8028ba:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8028bd:	eb 0f                	jmp    8028ce <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  8028bf:	0f b6 10             	movzbl (%eax),%edx
+  8028c2:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8028c4:	05 00 10 00 00       	add    $0x1000,%eax
+  8028c9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8028ce:	39 c8                	cmp    %ecx,%eax
+  8028d0:	72 ed                	jb     8028bf <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  8028d2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028d5:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  8028db:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8028e1:	83 ec 0c             	sub    $0xc,%esp
+  8028e4:	6a 07                	push   $0x7
+  8028e6:	89 f9                	mov    %edi,%ecx
+  8028e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028eb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8028f0:	e8 3f f1 ff ff       	call   801a34 <fsipc_pages>
+  8028f5:	89 c7                	mov    %eax,%edi
+  8028f7:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8028fa:	85 f6                	test   %esi,%esi
+  8028fc:	74 7f                	je     80297d <file_slurp+0x11e>
+  8028fe:	8d 43 01             	lea    0x1(%ebx),%eax
+  802901:	85 ff                	test   %edi,%edi
+  802903:	79 3c                	jns    802941 <file_slurp+0xe2>
+  802905:	eb 76                	jmp    80297d <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802907:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  80290d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802912:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802917:	e8 ba f2 ff ff       	call   801bd6 <fsipc>
+  80291c:	89 c7                	mov    %eax,%edi
+  80291e:	85 c0                	test   %eax,%eax
+  802920:	7e d8                	jle    8028fa <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802922:	83 ec 04             	sub    $0x4,%esp
+  802925:	50                   	push   %eax
+  802926:	68 08 60 80 00       	push   $0x806008
+  80292b:	ff 75 0c             	push   0xc(%ebp)
+  80292e:	e8 52 e1 ff ff       	call   800a85 <memmove>
+  802933:	83 c4 10             	add    $0x10,%esp
+  802936:	eb c2                	jmp    8028fa <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802938:	80 fa 2f             	cmp    $0x2f,%dl
+  80293b:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  80293e:	83 c0 01             	add    $0x1,%eax
+  802941:	89 c1                	mov    %eax,%ecx
+  802943:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802947:	84 d2                	test   %dl,%dl
+  802949:	75 ed                	jne    802938 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  80294b:	83 ec 04             	sub    $0x4,%esp
+  80294e:	68 80 00 00 00       	push   $0x80
+  802953:	53                   	push   %ebx
+  802954:	56                   	push   %esi
+  802955:	e8 1b e0 ff ff       	call   800975 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  80295a:	a1 00 60 80 00       	mov    0x806000,%eax
+  80295f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802965:	a1 04 60 80 00       	mov    0x806004,%eax
+  80296a:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802970:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  802977:	40 80 00 
+  80297a:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80297d:	89 f8                	mov    %edi,%eax
+  80297f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802982:	5b                   	pop    %ebx
+  802983:	5e                   	pop    %esi
+  802984:	5f                   	pop    %edi
+  802985:	5d                   	pop    %ebp
+  802986:	c3                   	ret
+		return -E_BAD_PATH;
+  802987:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  80298c:	eb ef                	jmp    80297d <file_slurp+0x11e>
+
+0080298e <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80298e:	55                   	push   %ebp
+  80298f:	89 e5                	mov    %esp,%ebp
+  802991:	53                   	push   %ebx
+  802992:	83 ec 10             	sub    $0x10,%esp
+  802995:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802998:	53                   	push   %ebx
+  802999:	e8 26 df ff ff       	call   8008c4 <strlen>
+  80299e:	83 c4 10             	add    $0x10,%esp
+  8029a1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8029a6:	7f 25                	jg     8029cd <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8029a8:	83 ec 08             	sub    $0x8,%esp
+  8029ab:	53                   	push   %ebx
+  8029ac:	68 00 60 80 00       	push   $0x806000
+  8029b1:	e8 49 df ff ff       	call   8008ff <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8029b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029bb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8029c0:	e8 11 f2 ff ff       	call   801bd6 <fsipc>
+  8029c5:	83 c4 10             	add    $0x10,%esp
+}
+  8029c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029cb:	c9                   	leave
+  8029cc:	c3                   	ret
+		return -E_BAD_PATH;
+  8029cd:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8029d2:	eb f4                	jmp    8029c8 <remove+0x3a>
+
+008029d4 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8029d4:	55                   	push   %ebp
+  8029d5:	89 e5                	mov    %esp,%ebp
+  8029d7:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8029da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029df:	b8 08 00 00 00       	mov    $0x8,%eax
+  8029e4:	e8 ed f1 ff ff       	call   801bd6 <fsipc>
+}
+  8029e9:	c9                   	leave
+  8029ea:	c3                   	ret
+
+008029eb <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  8029eb:	55                   	push   %ebp
+  8029ec:	89 e5                	mov    %esp,%ebp
+  8029ee:	57                   	push   %edi
+  8029ef:	56                   	push   %esi
+  8029f0:	53                   	push   %ebx
+  8029f1:	83 ec 18             	sub    $0x18,%esp
+  8029f4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8029f7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8029fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8029fd:	57                   	push   %edi
+  8029fe:	e8 c1 de ff ff       	call   8008c4 <strlen>
+  802a03:	83 c4 10             	add    $0x10,%esp
+  802a06:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a0b:	7f 4c                	jg     802a59 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802a0d:	83 ec 08             	sub    $0x8,%esp
+  802a10:	57                   	push   %edi
+  802a11:	68 00 60 80 00       	push   $0x806000
+  802a16:	e8 e4 de ff ff       	call   8008ff <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802a1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a20:	b8 10 00 00 00       	mov    $0x10,%eax
+  802a25:	e8 ac f1 ff ff       	call   801bd6 <fsipc>
+  802a2a:	83 c4 10             	add    $0x10,%esp
+  802a2d:	85 c0                	test   %eax,%eax
+  802a2f:	78 20                	js     802a51 <defrag+0x66>
+		return r;
+	if (before)
+  802a31:	85 f6                	test   %esi,%esi
+  802a33:	74 07                	je     802a3c <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802a35:	a1 00 60 80 00       	mov    0x806000,%eax
+  802a3a:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802a41:	85 db                	test   %ebx,%ebx
+  802a43:	74 0c                	je     802a51 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802a45:	a1 04 60 80 00       	mov    0x806004,%eax
+  802a4a:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a54:	5b                   	pop    %ebx
+  802a55:	5e                   	pop    %esi
+  802a56:	5f                   	pop    %edi
+  802a57:	5d                   	pop    %ebp
+  802a58:	c3                   	ret
+		return -E_BAD_PATH;
+  802a59:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802a5e:	eb f1                	jmp    802a51 <defrag+0x66>
+
+00802a60 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802a60:	55                   	push   %ebp
+  802a61:	89 e5                	mov    %esp,%ebp
+  802a63:	53                   	push   %ebx
+  802a64:	83 ec 04             	sub    $0x4,%esp
+  802a67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802a6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a6f:	b8 11 00 00 00       	mov    $0x11,%eax
+  802a74:	e8 5d f1 ff ff       	call   801bd6 <fsipc>
+  802a79:	85 c0                	test   %eax,%eax
+  802a7b:	78 34                	js     802ab1 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802a7d:	a1 00 60 80 00       	mov    0x806000,%eax
+  802a82:	89 03                	mov    %eax,(%ebx)
+  802a84:	a1 04 60 80 00       	mov    0x806004,%eax
+  802a89:	89 43 04             	mov    %eax,0x4(%ebx)
+  802a8c:	a1 08 60 80 00       	mov    0x806008,%eax
+  802a91:	89 43 08             	mov    %eax,0x8(%ebx)
+  802a94:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  802a99:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802a9c:	a1 10 60 80 00       	mov    0x806010,%eax
+  802aa1:	89 43 10             	mov    %eax,0x10(%ebx)
+  802aa4:	a1 14 60 80 00       	mov    0x806014,%eax
+  802aa9:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802aac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ab1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ab4:	c9                   	leave
+  802ab5:	c3                   	ret
+
+00802ab6 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802ab6:	55                   	push   %ebp
+  802ab7:	89 e5                	mov    %esp,%ebp
+  802ab9:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802abc:	68 d1 3e 80 00       	push   $0x803ed1
+  802ac1:	ff 75 0c             	push   0xc(%ebp)
+  802ac4:	e8 36 de ff ff       	call   8008ff <strcpy>
+	return 0;
+}
+  802ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ace:	c9                   	leave
+  802acf:	c3                   	ret
+
+00802ad0 <devsock_close>:
+{
+  802ad0:	55                   	push   %ebp
+  802ad1:	89 e5                	mov    %esp,%ebp
+  802ad3:	53                   	push   %ebx
+  802ad4:	83 ec 10             	sub    $0x10,%esp
+  802ad7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802ada:	53                   	push   %ebx
+  802adb:	e8 78 0b 00 00       	call   803658 <pageref>
+  802ae0:	89 c2                	mov    %eax,%edx
+  802ae2:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802aea:	83 fa 01             	cmp    $0x1,%edx
+  802aed:	74 05                	je     802af4 <devsock_close+0x24>
+}
+  802aef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802af2:	c9                   	leave
+  802af3:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802af4:	83 ec 0c             	sub    $0xc,%esp
+  802af7:	ff 73 0c             	push   0xc(%ebx)
+  802afa:	e8 b7 02 00 00       	call   802db6 <nsipc_close>
+  802aff:	83 c4 10             	add    $0x10,%esp
+  802b02:	eb eb                	jmp    802aef <devsock_close+0x1f>
+
+00802b04 <devsock_write>:
+{
+  802b04:	55                   	push   %ebp
+  802b05:	89 e5                	mov    %esp,%ebp
+  802b07:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802b0a:	6a 00                	push   $0x0
+  802b0c:	ff 75 10             	push   0x10(%ebp)
+  802b0f:	ff 75 0c             	push   0xc(%ebp)
+  802b12:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b15:	ff 70 0c             	push   0xc(%eax)
+  802b18:	e8 79 03 00 00       	call   802e96 <nsipc_send>
+}
+  802b1d:	c9                   	leave
+  802b1e:	c3                   	ret
+
+00802b1f <devsock_read>:
+{
+  802b1f:	55                   	push   %ebp
+  802b20:	89 e5                	mov    %esp,%ebp
+  802b22:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802b25:	6a 00                	push   $0x0
+  802b27:	ff 75 10             	push   0x10(%ebp)
+  802b2a:	ff 75 0c             	push   0xc(%ebp)
+  802b2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b30:	ff 70 0c             	push   0xc(%eax)
+  802b33:	e8 ef 02 00 00       	call   802e27 <nsipc_recv>
+}
+  802b38:	c9                   	leave
+  802b39:	c3                   	ret
+
+00802b3a <fd2sockid>:
+{
+  802b3a:	55                   	push   %ebp
+  802b3b:	89 e5                	mov    %esp,%ebp
+  802b3d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802b40:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b43:	52                   	push   %edx
+  802b44:	50                   	push   %eax
+  802b45:	e8 54 e9 ff ff       	call   80149e <fd_lookup>
+  802b4a:	83 c4 10             	add    $0x10,%esp
+  802b4d:	85 c0                	test   %eax,%eax
+  802b4f:	78 10                	js     802b61 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802b51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b54:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  802b5a:	39 08                	cmp    %ecx,(%eax)
+  802b5c:	75 05                	jne    802b63 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802b5e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802b61:	c9                   	leave
+  802b62:	c3                   	ret
+		return -E_NOT_SUPP;
+  802b63:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802b68:	eb f7                	jmp    802b61 <fd2sockid+0x27>
+
+00802b6a <alloc_sockfd>:
+{
+  802b6a:	55                   	push   %ebp
+  802b6b:	89 e5                	mov    %esp,%ebp
+  802b6d:	56                   	push   %esi
+  802b6e:	53                   	push   %ebx
+  802b6f:	83 ec 1c             	sub    $0x1c,%esp
+  802b72:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802b74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b77:	50                   	push   %eax
+  802b78:	e8 cb e8 ff ff       	call   801448 <fd_alloc>
+  802b7d:	89 c3                	mov    %eax,%ebx
+  802b7f:	83 c4 10             	add    $0x10,%esp
+  802b82:	85 c0                	test   %eax,%eax
+  802b84:	78 43                	js     802bc9 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802b86:	83 ec 04             	sub    $0x4,%esp
+  802b89:	68 07 04 00 00       	push   $0x407
+  802b8e:	ff 75 f4             	push   -0xc(%ebp)
+  802b91:	6a 00                	push   $0x0
+  802b93:	e8 73 e1 ff ff       	call   800d0b <sys_page_alloc>
+  802b98:	89 c3                	mov    %eax,%ebx
+  802b9a:	83 c4 10             	add    $0x10,%esp
+  802b9d:	85 c0                	test   %eax,%eax
+  802b9f:	78 28                	js     802bc9 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802ba1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ba4:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802baa:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802bac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802baf:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802bb6:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802bb9:	83 ec 0c             	sub    $0xc,%esp
+  802bbc:	50                   	push   %eax
+  802bbd:	e8 5f e8 ff ff       	call   801421 <fd2num>
+  802bc2:	89 c3                	mov    %eax,%ebx
+  802bc4:	83 c4 10             	add    $0x10,%esp
+  802bc7:	eb 0c                	jmp    802bd5 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802bc9:	83 ec 0c             	sub    $0xc,%esp
+  802bcc:	56                   	push   %esi
+  802bcd:	e8 e4 01 00 00       	call   802db6 <nsipc_close>
+		return r;
+  802bd2:	83 c4 10             	add    $0x10,%esp
+}
+  802bd5:	89 d8                	mov    %ebx,%eax
+  802bd7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bda:	5b                   	pop    %ebx
+  802bdb:	5e                   	pop    %esi
+  802bdc:	5d                   	pop    %ebp
+  802bdd:	c3                   	ret
+
+00802bde <accept>:
+{
+  802bde:	55                   	push   %ebp
+  802bdf:	89 e5                	mov    %esp,%ebp
+  802be1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802be4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be7:	e8 4e ff ff ff       	call   802b3a <fd2sockid>
+  802bec:	85 c0                	test   %eax,%eax
+  802bee:	78 1b                	js     802c0b <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802bf0:	83 ec 04             	sub    $0x4,%esp
+  802bf3:	ff 75 10             	push   0x10(%ebp)
+  802bf6:	ff 75 0c             	push   0xc(%ebp)
+  802bf9:	50                   	push   %eax
+  802bfa:	e8 0e 01 00 00       	call   802d0d <nsipc_accept>
+  802bff:	83 c4 10             	add    $0x10,%esp
+  802c02:	85 c0                	test   %eax,%eax
+  802c04:	78 05                	js     802c0b <accept+0x2d>
+	return alloc_sockfd(r);
+  802c06:	e8 5f ff ff ff       	call   802b6a <alloc_sockfd>
+}
+  802c0b:	c9                   	leave
+  802c0c:	c3                   	ret
+
+00802c0d <bind>:
+{
+  802c0d:	55                   	push   %ebp
+  802c0e:	89 e5                	mov    %esp,%ebp
+  802c10:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c13:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c16:	e8 1f ff ff ff       	call   802b3a <fd2sockid>
+  802c1b:	85 c0                	test   %eax,%eax
+  802c1d:	78 12                	js     802c31 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802c1f:	83 ec 04             	sub    $0x4,%esp
+  802c22:	ff 75 10             	push   0x10(%ebp)
+  802c25:	ff 75 0c             	push   0xc(%ebp)
+  802c28:	50                   	push   %eax
+  802c29:	e8 31 01 00 00       	call   802d5f <nsipc_bind>
+  802c2e:	83 c4 10             	add    $0x10,%esp
+}
+  802c31:	c9                   	leave
+  802c32:	c3                   	ret
+
+00802c33 <shutdown>:
+{
+  802c33:	55                   	push   %ebp
+  802c34:	89 e5                	mov    %esp,%ebp
+  802c36:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c39:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c3c:	e8 f9 fe ff ff       	call   802b3a <fd2sockid>
+  802c41:	85 c0                	test   %eax,%eax
+  802c43:	78 0f                	js     802c54 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802c45:	83 ec 08             	sub    $0x8,%esp
+  802c48:	ff 75 0c             	push   0xc(%ebp)
+  802c4b:	50                   	push   %eax
+  802c4c:	e8 43 01 00 00       	call   802d94 <nsipc_shutdown>
+  802c51:	83 c4 10             	add    $0x10,%esp
+}
+  802c54:	c9                   	leave
+  802c55:	c3                   	ret
+
+00802c56 <connect>:
+{
+  802c56:	55                   	push   %ebp
+  802c57:	89 e5                	mov    %esp,%ebp
+  802c59:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c5f:	e8 d6 fe ff ff       	call   802b3a <fd2sockid>
+  802c64:	85 c0                	test   %eax,%eax
+  802c66:	78 12                	js     802c7a <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802c68:	83 ec 04             	sub    $0x4,%esp
+  802c6b:	ff 75 10             	push   0x10(%ebp)
+  802c6e:	ff 75 0c             	push   0xc(%ebp)
+  802c71:	50                   	push   %eax
+  802c72:	e8 59 01 00 00       	call   802dd0 <nsipc_connect>
+  802c77:	83 c4 10             	add    $0x10,%esp
+}
+  802c7a:	c9                   	leave
+  802c7b:	c3                   	ret
+
+00802c7c <listen>:
+{
+  802c7c:	55                   	push   %ebp
+  802c7d:	89 e5                	mov    %esp,%ebp
+  802c7f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c82:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c85:	e8 b0 fe ff ff       	call   802b3a <fd2sockid>
+  802c8a:	85 c0                	test   %eax,%eax
+  802c8c:	78 0f                	js     802c9d <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c8e:	83 ec 08             	sub    $0x8,%esp
+  802c91:	ff 75 0c             	push   0xc(%ebp)
+  802c94:	50                   	push   %eax
+  802c95:	e8 6b 01 00 00       	call   802e05 <nsipc_listen>
+  802c9a:	83 c4 10             	add    $0x10,%esp
+}
+  802c9d:	c9                   	leave
+  802c9e:	c3                   	ret
+
+00802c9f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802c9f:	55                   	push   %ebp
+  802ca0:	89 e5                	mov    %esp,%ebp
+  802ca2:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802ca5:	ff 75 10             	push   0x10(%ebp)
+  802ca8:	ff 75 0c             	push   0xc(%ebp)
+  802cab:	ff 75 08             	push   0x8(%ebp)
+  802cae:	e8 41 02 00 00       	call   802ef4 <nsipc_socket>
+  802cb3:	83 c4 10             	add    $0x10,%esp
+  802cb6:	85 c0                	test   %eax,%eax
+  802cb8:	78 05                	js     802cbf <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802cba:	e8 ab fe ff ff       	call   802b6a <alloc_sockfd>
+}
+  802cbf:	c9                   	leave
+  802cc0:	c3                   	ret
+
+00802cc1 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802cc1:	55                   	push   %ebp
+  802cc2:	89 e5                	mov    %esp,%ebp
+  802cc4:	53                   	push   %ebx
+  802cc5:	83 ec 04             	sub    $0x4,%esp
+  802cc8:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802cca:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  802cd1:	74 26                	je     802cf9 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802cd3:	6a 07                	push   $0x7
+  802cd5:	68 00 80 80 00       	push   $0x808000
+  802cda:	53                   	push   %ebx
+  802cdb:	ff 35 00 90 80 00    	push   0x809000
+  802ce1:	e8 fa 07 00 00       	call   8034e0 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802ce6:	83 c4 0c             	add    $0xc,%esp
+  802ce9:	6a 00                	push   $0x0
+  802ceb:	6a 00                	push   $0x0
+  802ced:	6a 00                	push   $0x0
+  802cef:	e8 81 07 00 00       	call   803475 <ipc_recv>
+}
+  802cf4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cf7:	c9                   	leave
+  802cf8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802cf9:	83 ec 0c             	sub    $0xc,%esp
+  802cfc:	6a 02                	push   $0x2
+  802cfe:	e8 16 09 00 00       	call   803619 <ipc_find_env>
+  802d03:	a3 00 90 80 00       	mov    %eax,0x809000
+  802d08:	83 c4 10             	add    $0x10,%esp
+  802d0b:	eb c6                	jmp    802cd3 <nsipc+0x12>
+
+00802d0d <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802d0d:	55                   	push   %ebp
+  802d0e:	89 e5                	mov    %esp,%ebp
+  802d10:	56                   	push   %esi
+  802d11:	53                   	push   %ebx
+  802d12:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802d15:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d18:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802d1d:	8b 06                	mov    (%esi),%eax
+  802d1f:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802d24:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d29:	e8 93 ff ff ff       	call   802cc1 <nsipc>
+  802d2e:	89 c3                	mov    %eax,%ebx
+  802d30:	85 c0                	test   %eax,%eax
+  802d32:	79 09                	jns    802d3d <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802d34:	89 d8                	mov    %ebx,%eax
+  802d36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d39:	5b                   	pop    %ebx
+  802d3a:	5e                   	pop    %esi
+  802d3b:	5d                   	pop    %ebp
+  802d3c:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802d3d:	83 ec 04             	sub    $0x4,%esp
+  802d40:	ff 35 10 80 80 00    	push   0x808010
+  802d46:	68 00 80 80 00       	push   $0x808000
+  802d4b:	ff 75 0c             	push   0xc(%ebp)
+  802d4e:	e8 32 dd ff ff       	call   800a85 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802d53:	a1 10 80 80 00       	mov    0x808010,%eax
+  802d58:	89 06                	mov    %eax,(%esi)
+  802d5a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802d5d:	eb d5                	jmp    802d34 <nsipc_accept+0x27>
+
+00802d5f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802d5f:	55                   	push   %ebp
+  802d60:	89 e5                	mov    %esp,%ebp
+  802d62:	53                   	push   %ebx
+  802d63:	83 ec 08             	sub    $0x8,%esp
+  802d66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802d69:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d6c:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802d71:	53                   	push   %ebx
+  802d72:	ff 75 0c             	push   0xc(%ebp)
+  802d75:	68 04 80 80 00       	push   $0x808004
+  802d7a:	e8 06 dd ff ff       	call   800a85 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d7f:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802d85:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d8a:	e8 32 ff ff ff       	call   802cc1 <nsipc>
+}
+  802d8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d92:	c9                   	leave
+  802d93:	c3                   	ret
+
+00802d94 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d94:	55                   	push   %ebp
+  802d95:	89 e5                	mov    %esp,%ebp
+  802d97:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802d9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d9d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802da2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802da5:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802daa:	b8 03 00 00 00       	mov    $0x3,%eax
+  802daf:	e8 0d ff ff ff       	call   802cc1 <nsipc>
+}
+  802db4:	c9                   	leave
+  802db5:	c3                   	ret
+
+00802db6 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802db6:	55                   	push   %ebp
+  802db7:	89 e5                	mov    %esp,%ebp
+  802db9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802dbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dbf:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802dc4:	b8 04 00 00 00       	mov    $0x4,%eax
+  802dc9:	e8 f3 fe ff ff       	call   802cc1 <nsipc>
+}
+  802dce:	c9                   	leave
+  802dcf:	c3                   	ret
+
+00802dd0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802dd0:	55                   	push   %ebp
+  802dd1:	89 e5                	mov    %esp,%ebp
+  802dd3:	53                   	push   %ebx
+  802dd4:	83 ec 08             	sub    $0x8,%esp
+  802dd7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802dda:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ddd:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802de2:	53                   	push   %ebx
+  802de3:	ff 75 0c             	push   0xc(%ebp)
+  802de6:	68 04 80 80 00       	push   $0x808004
+  802deb:	e8 95 dc ff ff       	call   800a85 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802df0:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802df6:	b8 05 00 00 00       	mov    $0x5,%eax
+  802dfb:	e8 c1 fe ff ff       	call   802cc1 <nsipc>
+}
+  802e00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e03:	c9                   	leave
+  802e04:	c3                   	ret
+
+00802e05 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802e05:	55                   	push   %ebp
+  802e06:	89 e5                	mov    %esp,%ebp
+  802e08:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802e0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e0e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802e13:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e16:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802e1b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e20:	e8 9c fe ff ff       	call   802cc1 <nsipc>
+}
+  802e25:	c9                   	leave
+  802e26:	c3                   	ret
+
+00802e27 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802e27:	55                   	push   %ebp
+  802e28:	89 e5                	mov    %esp,%ebp
+  802e2a:	56                   	push   %esi
+  802e2b:	53                   	push   %ebx
+  802e2c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802e2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e32:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802e37:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802e3d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e40:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802e45:	b8 07 00 00 00       	mov    $0x7,%eax
+  802e4a:	e8 72 fe ff ff       	call   802cc1 <nsipc>
+  802e4f:	89 c3                	mov    %eax,%ebx
+  802e51:	85 c0                	test   %eax,%eax
+  802e53:	78 22                	js     802e77 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802e55:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802e5a:	39 c6                	cmp    %eax,%esi
+  802e5c:	0f 4e c6             	cmovle %esi,%eax
+  802e5f:	39 c3                	cmp    %eax,%ebx
+  802e61:	7f 1d                	jg     802e80 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802e63:	83 ec 04             	sub    $0x4,%esp
+  802e66:	53                   	push   %ebx
+  802e67:	68 00 80 80 00       	push   $0x808000
+  802e6c:	ff 75 0c             	push   0xc(%ebp)
+  802e6f:	e8 11 dc ff ff       	call   800a85 <memmove>
+  802e74:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e77:	89 d8                	mov    %ebx,%eax
+  802e79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e7c:	5b                   	pop    %ebx
+  802e7d:	5e                   	pop    %esi
+  802e7e:	5d                   	pop    %ebp
+  802e7f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e80:	68 dd 3e 80 00       	push   $0x803edd
+  802e85:	68 ac 3d 80 00       	push   $0x803dac
+  802e8a:	6a 62                	push   $0x62
+  802e8c:	68 f2 3e 80 00       	push   $0x803ef2
+  802e91:	e8 a0 d3 ff ff       	call   800236 <_panic>
+
+00802e96 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e96:	55                   	push   %ebp
+  802e97:	89 e5                	mov    %esp,%ebp
+  802e99:	53                   	push   %ebx
+  802e9a:	83 ec 04             	sub    $0x4,%esp
+  802e9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802ea0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ea3:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802ea8:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802eae:	7f 2e                	jg     802ede <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802eb0:	83 ec 04             	sub    $0x4,%esp
+  802eb3:	53                   	push   %ebx
+  802eb4:	ff 75 0c             	push   0xc(%ebp)
+  802eb7:	68 0c 80 80 00       	push   $0x80800c
+  802ebc:	e8 c4 db ff ff       	call   800a85 <memmove>
+	nsipcbuf.send.req_size = size;
+  802ec1:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802ec7:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eca:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802ecf:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ed4:	e8 e8 fd ff ff       	call   802cc1 <nsipc>
+}
+  802ed9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802edc:	c9                   	leave
+  802edd:	c3                   	ret
+	assert(size < 1600);
+  802ede:	68 fe 3e 80 00       	push   $0x803efe
+  802ee3:	68 ac 3d 80 00       	push   $0x803dac
+  802ee8:	6a 6d                	push   $0x6d
+  802eea:	68 f2 3e 80 00       	push   $0x803ef2
+  802eef:	e8 42 d3 ff ff       	call   800236 <_panic>
+
+00802ef4 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802ef4:	55                   	push   %ebp
+  802ef5:	89 e5                	mov    %esp,%ebp
+  802ef7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802efa:	8b 45 08             	mov    0x8(%ebp),%eax
+  802efd:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802f02:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f05:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802f0a:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f0d:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802f12:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f17:	e8 a5 fd ff ff       	call   802cc1 <nsipc>
+}
+  802f1c:	c9                   	leave
+  802f1d:	c3                   	ret
+
+00802f1e <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f1e:	55                   	push   %ebp
+  802f1f:	89 e5                	mov    %esp,%ebp
+  802f21:	56                   	push   %esi
+  802f22:	53                   	push   %ebx
+  802f23:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f26:	83 ec 0c             	sub    $0xc,%esp
+  802f29:	ff 75 08             	push   0x8(%ebp)
+  802f2c:	e8 00 e5 ff ff       	call   801431 <fd2data>
+  802f31:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f33:	83 c4 08             	add    $0x8,%esp
+  802f36:	68 0a 3f 80 00       	push   $0x803f0a
+  802f3b:	53                   	push   %ebx
+  802f3c:	e8 be d9 ff ff       	call   8008ff <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802f41:	8b 46 04             	mov    0x4(%esi),%eax
+  802f44:	2b 06                	sub    (%esi),%eax
+  802f46:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802f4c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f53:	00 00 00 
+	stat->st_dev = &devpipe;
+  802f56:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802f5d:	40 80 00 
+	return 0;
+}
+  802f60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f68:	5b                   	pop    %ebx
+  802f69:	5e                   	pop    %esi
+  802f6a:	5d                   	pop    %ebp
+  802f6b:	c3                   	ret
+
+00802f6c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802f6c:	55                   	push   %ebp
+  802f6d:	89 e5                	mov    %esp,%ebp
+  802f6f:	53                   	push   %ebx
+  802f70:	83 ec 0c             	sub    $0xc,%esp
+  802f73:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802f76:	53                   	push   %ebx
+  802f77:	6a 00                	push   $0x0
+  802f79:	e8 1a de ff ff       	call   800d98 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802f7e:	89 1c 24             	mov    %ebx,(%esp)
+  802f81:	e8 ab e4 ff ff       	call   801431 <fd2data>
+  802f86:	83 c4 08             	add    $0x8,%esp
+  802f89:	50                   	push   %eax
+  802f8a:	6a 00                	push   $0x0
+  802f8c:	e8 07 de ff ff       	call   800d98 <sys_page_unmap>
+}
+  802f91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f94:	c9                   	leave
+  802f95:	c3                   	ret
+
+00802f96 <_pipeisclosed>:
+{
+  802f96:	55                   	push   %ebp
+  802f97:	89 e5                	mov    %esp,%ebp
+  802f99:	57                   	push   %edi
+  802f9a:	56                   	push   %esi
+  802f9b:	53                   	push   %ebx
+  802f9c:	83 ec 1c             	sub    $0x1c,%esp
+  802f9f:	89 c7                	mov    %eax,%edi
+  802fa1:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802fa3:	a1 00 50 80 00       	mov    0x805000,%eax
+  802fa8:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802fab:	83 ec 0c             	sub    $0xc,%esp
+  802fae:	57                   	push   %edi
+  802faf:	e8 a4 06 00 00       	call   803658 <pageref>
+  802fb4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802fb7:	89 34 24             	mov    %esi,(%esp)
+  802fba:	e8 99 06 00 00       	call   803658 <pageref>
+		nn = thisenv->env_runs;
+  802fbf:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802fc5:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802fc8:	83 c4 10             	add    $0x10,%esp
+  802fcb:	39 cb                	cmp    %ecx,%ebx
+  802fcd:	74 1b                	je     802fea <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802fcf:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802fd2:	75 cf                	jne    802fa3 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802fd4:	8b 42 58             	mov    0x58(%edx),%eax
+  802fd7:	6a 01                	push   $0x1
+  802fd9:	50                   	push   %eax
+  802fda:	53                   	push   %ebx
+  802fdb:	68 11 3f 80 00       	push   $0x803f11
+  802fe0:	e8 2c d3 ff ff       	call   800311 <cprintf>
+  802fe5:	83 c4 10             	add    $0x10,%esp
+  802fe8:	eb b9                	jmp    802fa3 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802fea:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802fed:	0f 94 c0             	sete   %al
+  802ff0:	0f b6 c0             	movzbl %al,%eax
+}
+  802ff3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ff6:	5b                   	pop    %ebx
+  802ff7:	5e                   	pop    %esi
+  802ff8:	5f                   	pop    %edi
+  802ff9:	5d                   	pop    %ebp
+  802ffa:	c3                   	ret
+
+00802ffb <devpipe_write>:
+{
+  802ffb:	55                   	push   %ebp
+  802ffc:	89 e5                	mov    %esp,%ebp
+  802ffe:	57                   	push   %edi
+  802fff:	56                   	push   %esi
+  803000:	53                   	push   %ebx
+  803001:	83 ec 28             	sub    $0x28,%esp
+  803004:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  803007:	56                   	push   %esi
+  803008:	e8 24 e4 ff ff       	call   801431 <fd2data>
+  80300d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80300f:	83 c4 10             	add    $0x10,%esp
+  803012:	bf 00 00 00 00       	mov    $0x0,%edi
+  803017:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80301a:	75 09                	jne    803025 <devpipe_write+0x2a>
+	return i;
+  80301c:	89 f8                	mov    %edi,%eax
+  80301e:	eb 23                	jmp    803043 <devpipe_write+0x48>
+			sys_yield();
+  803020:	e8 c7 dc ff ff       	call   800cec <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803025:	8b 43 04             	mov    0x4(%ebx),%eax
+  803028:	8b 0b                	mov    (%ebx),%ecx
+  80302a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80302d:	39 d0                	cmp    %edx,%eax
+  80302f:	72 1a                	jb     80304b <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803031:	89 da                	mov    %ebx,%edx
+  803033:	89 f0                	mov    %esi,%eax
+  803035:	e8 5c ff ff ff       	call   802f96 <_pipeisclosed>
+  80303a:	85 c0                	test   %eax,%eax
+  80303c:	74 e2                	je     803020 <devpipe_write+0x25>
+				return 0;
+  80303e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803043:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803046:	5b                   	pop    %ebx
+  803047:	5e                   	pop    %esi
+  803048:	5f                   	pop    %edi
+  803049:	5d                   	pop    %ebp
+  80304a:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80304b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80304e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803052:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803055:	89 c2                	mov    %eax,%edx
+  803057:	c1 fa 1f             	sar    $0x1f,%edx
+  80305a:	89 d1                	mov    %edx,%ecx
+  80305c:	c1 e9 1b             	shr    $0x1b,%ecx
+  80305f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803062:	83 e2 1f             	and    $0x1f,%edx
+  803065:	29 ca                	sub    %ecx,%edx
+  803067:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80306b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80306f:	83 c0 01             	add    $0x1,%eax
+  803072:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803075:	83 c7 01             	add    $0x1,%edi
+  803078:	eb 9d                	jmp    803017 <devpipe_write+0x1c>
+
+0080307a <devpipe_read>:
+{
+  80307a:	55                   	push   %ebp
+  80307b:	89 e5                	mov    %esp,%ebp
+  80307d:	57                   	push   %edi
+  80307e:	56                   	push   %esi
+  80307f:	53                   	push   %ebx
+  803080:	83 ec 18             	sub    $0x18,%esp
+  803083:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803086:	57                   	push   %edi
+  803087:	e8 a5 e3 ff ff       	call   801431 <fd2data>
+  80308c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80308e:	83 c4 10             	add    $0x10,%esp
+  803091:	be 00 00 00 00       	mov    $0x0,%esi
+  803096:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803099:	75 13                	jne    8030ae <devpipe_read+0x34>
+	return i;
+  80309b:	89 f0                	mov    %esi,%eax
+  80309d:	eb 02                	jmp    8030a1 <devpipe_read+0x27>
+				return i;
+  80309f:	89 f0                	mov    %esi,%eax
+}
+  8030a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030a4:	5b                   	pop    %ebx
+  8030a5:	5e                   	pop    %esi
+  8030a6:	5f                   	pop    %edi
+  8030a7:	5d                   	pop    %ebp
+  8030a8:	c3                   	ret
+			sys_yield();
+  8030a9:	e8 3e dc ff ff       	call   800cec <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8030ae:	8b 03                	mov    (%ebx),%eax
+  8030b0:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8030b3:	75 18                	jne    8030cd <devpipe_read+0x53>
+			if (i > 0)
+  8030b5:	85 f6                	test   %esi,%esi
+  8030b7:	75 e6                	jne    80309f <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8030b9:	89 da                	mov    %ebx,%edx
+  8030bb:	89 f8                	mov    %edi,%eax
+  8030bd:	e8 d4 fe ff ff       	call   802f96 <_pipeisclosed>
+  8030c2:	85 c0                	test   %eax,%eax
+  8030c4:	74 e3                	je     8030a9 <devpipe_read+0x2f>
+				return 0;
+  8030c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030cb:	eb d4                	jmp    8030a1 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8030cd:	99                   	cltd
+  8030ce:	c1 ea 1b             	shr    $0x1b,%edx
+  8030d1:	01 d0                	add    %edx,%eax
+  8030d3:	83 e0 1f             	and    $0x1f,%eax
+  8030d6:	29 d0                	sub    %edx,%eax
+  8030d8:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8030dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030e0:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8030e3:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8030e6:	83 c6 01             	add    $0x1,%esi
+  8030e9:	eb ab                	jmp    803096 <devpipe_read+0x1c>
+
+008030eb <pipe>:
+{
+  8030eb:	55                   	push   %ebp
+  8030ec:	89 e5                	mov    %esp,%ebp
+  8030ee:	56                   	push   %esi
+  8030ef:	53                   	push   %ebx
+  8030f0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8030f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030f6:	50                   	push   %eax
+  8030f7:	e8 4c e3 ff ff       	call   801448 <fd_alloc>
+  8030fc:	89 c3                	mov    %eax,%ebx
+  8030fe:	83 c4 10             	add    $0x10,%esp
+  803101:	85 c0                	test   %eax,%eax
+  803103:	0f 88 23 01 00 00    	js     80322c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803109:	83 ec 04             	sub    $0x4,%esp
+  80310c:	68 07 04 00 00       	push   $0x407
+  803111:	ff 75 f4             	push   -0xc(%ebp)
+  803114:	6a 00                	push   $0x0
+  803116:	e8 f0 db ff ff       	call   800d0b <sys_page_alloc>
+  80311b:	89 c3                	mov    %eax,%ebx
+  80311d:	83 c4 10             	add    $0x10,%esp
+  803120:	85 c0                	test   %eax,%eax
+  803122:	0f 88 04 01 00 00    	js     80322c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803128:	83 ec 0c             	sub    $0xc,%esp
+  80312b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80312e:	50                   	push   %eax
+  80312f:	e8 14 e3 ff ff       	call   801448 <fd_alloc>
+  803134:	89 c3                	mov    %eax,%ebx
+  803136:	83 c4 10             	add    $0x10,%esp
+  803139:	85 c0                	test   %eax,%eax
+  80313b:	0f 88 db 00 00 00    	js     80321c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803141:	83 ec 04             	sub    $0x4,%esp
+  803144:	68 07 04 00 00       	push   $0x407
+  803149:	ff 75 f0             	push   -0x10(%ebp)
+  80314c:	6a 00                	push   $0x0
+  80314e:	e8 b8 db ff ff       	call   800d0b <sys_page_alloc>
+  803153:	89 c3                	mov    %eax,%ebx
+  803155:	83 c4 10             	add    $0x10,%esp
+  803158:	85 c0                	test   %eax,%eax
+  80315a:	0f 88 bc 00 00 00    	js     80321c <pipe+0x131>
+	va = fd2data(fd0);
+  803160:	83 ec 0c             	sub    $0xc,%esp
+  803163:	ff 75 f4             	push   -0xc(%ebp)
+  803166:	e8 c6 e2 ff ff       	call   801431 <fd2data>
+  80316b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80316d:	83 c4 0c             	add    $0xc,%esp
+  803170:	68 07 04 00 00       	push   $0x407
+  803175:	50                   	push   %eax
+  803176:	6a 00                	push   $0x0
+  803178:	e8 8e db ff ff       	call   800d0b <sys_page_alloc>
+  80317d:	89 c3                	mov    %eax,%ebx
+  80317f:	83 c4 10             	add    $0x10,%esp
+  803182:	85 c0                	test   %eax,%eax
+  803184:	0f 88 82 00 00 00    	js     80320c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80318a:	83 ec 0c             	sub    $0xc,%esp
+  80318d:	ff 75 f0             	push   -0x10(%ebp)
+  803190:	e8 9c e2 ff ff       	call   801431 <fd2data>
+  803195:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80319c:	50                   	push   %eax
+  80319d:	6a 00                	push   $0x0
+  80319f:	56                   	push   %esi
+  8031a0:	6a 00                	push   $0x0
+  8031a2:	e8 af db ff ff       	call   800d56 <sys_page_map>
+  8031a7:	89 c3                	mov    %eax,%ebx
+  8031a9:	83 c4 20             	add    $0x20,%esp
+  8031ac:	85 c0                	test   %eax,%eax
+  8031ae:	78 4e                	js     8031fe <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8031b0:	a1 60 40 80 00       	mov    0x804060,%eax
+  8031b5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031b8:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8031ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031bd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8031c4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8031c7:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8031c9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8031cc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8031d3:	83 ec 0c             	sub    $0xc,%esp
+  8031d6:	ff 75 f4             	push   -0xc(%ebp)
+  8031d9:	e8 43 e2 ff ff       	call   801421 <fd2num>
+  8031de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031e1:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8031e3:	83 c4 04             	add    $0x4,%esp
+  8031e6:	ff 75 f0             	push   -0x10(%ebp)
+  8031e9:	e8 33 e2 ff ff       	call   801421 <fd2num>
+  8031ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031f1:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8031f4:	83 c4 10             	add    $0x10,%esp
+  8031f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031fc:	eb 2e                	jmp    80322c <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031fe:	83 ec 08             	sub    $0x8,%esp
+  803201:	56                   	push   %esi
+  803202:	6a 00                	push   $0x0
+  803204:	e8 8f db ff ff       	call   800d98 <sys_page_unmap>
+  803209:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80320c:	83 ec 08             	sub    $0x8,%esp
+  80320f:	ff 75 f0             	push   -0x10(%ebp)
+  803212:	6a 00                	push   $0x0
+  803214:	e8 7f db ff ff       	call   800d98 <sys_page_unmap>
+  803219:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80321c:	83 ec 08             	sub    $0x8,%esp
+  80321f:	ff 75 f4             	push   -0xc(%ebp)
+  803222:	6a 00                	push   $0x0
+  803224:	e8 6f db ff ff       	call   800d98 <sys_page_unmap>
+  803229:	83 c4 10             	add    $0x10,%esp
+}
+  80322c:	89 d8                	mov    %ebx,%eax
+  80322e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803231:	5b                   	pop    %ebx
+  803232:	5e                   	pop    %esi
+  803233:	5d                   	pop    %ebp
+  803234:	c3                   	ret
+
+00803235 <pipeisclosed>:
+{
+  803235:	55                   	push   %ebp
+  803236:	89 e5                	mov    %esp,%ebp
+  803238:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80323b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80323e:	50                   	push   %eax
+  80323f:	ff 75 08             	push   0x8(%ebp)
+  803242:	e8 57 e2 ff ff       	call   80149e <fd_lookup>
+  803247:	83 c4 10             	add    $0x10,%esp
+  80324a:	85 c0                	test   %eax,%eax
+  80324c:	78 18                	js     803266 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80324e:	83 ec 0c             	sub    $0xc,%esp
+  803251:	ff 75 f4             	push   -0xc(%ebp)
+  803254:	e8 d8 e1 ff ff       	call   801431 <fd2data>
+  803259:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80325b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80325e:	e8 33 fd ff ff       	call   802f96 <_pipeisclosed>
+  803263:	83 c4 10             	add    $0x10,%esp
+}
+  803266:	c9                   	leave
+  803267:	c3                   	ret
+
+00803268 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803268:	b8 00 00 00 00       	mov    $0x0,%eax
+  80326d:	c3                   	ret
+
+0080326e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80326e:	55                   	push   %ebp
+  80326f:	89 e5                	mov    %esp,%ebp
+  803271:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803274:	68 29 3f 80 00       	push   $0x803f29
+  803279:	ff 75 0c             	push   0xc(%ebp)
+  80327c:	e8 7e d6 ff ff       	call   8008ff <strcpy>
+	return 0;
+}
+  803281:	b8 00 00 00 00       	mov    $0x0,%eax
+  803286:	c9                   	leave
+  803287:	c3                   	ret
+
+00803288 <devcons_write>:
+{
+  803288:	55                   	push   %ebp
+  803289:	89 e5                	mov    %esp,%ebp
+  80328b:	57                   	push   %edi
+  80328c:	56                   	push   %esi
+  80328d:	53                   	push   %ebx
+  80328e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803294:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803299:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80329f:	eb 2e                	jmp    8032cf <devcons_write+0x47>
+		m = n - tot;
+  8032a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8032a4:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8032a6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8032ab:	39 c3                	cmp    %eax,%ebx
+  8032ad:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8032b0:	83 ec 04             	sub    $0x4,%esp
+  8032b3:	53                   	push   %ebx
+  8032b4:	89 f0                	mov    %esi,%eax
+  8032b6:	03 45 0c             	add    0xc(%ebp),%eax
+  8032b9:	50                   	push   %eax
+  8032ba:	57                   	push   %edi
+  8032bb:	e8 c5 d7 ff ff       	call   800a85 <memmove>
+		sys_cputs(buf, m);
+  8032c0:	83 c4 08             	add    $0x8,%esp
+  8032c3:	53                   	push   %ebx
+  8032c4:	57                   	push   %edi
+  8032c5:	e8 65 d9 ff ff       	call   800c2f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8032ca:	01 de                	add    %ebx,%esi
+  8032cc:	83 c4 10             	add    $0x10,%esp
+  8032cf:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8032d2:	72 cd                	jb     8032a1 <devcons_write+0x19>
+}
+  8032d4:	89 f0                	mov    %esi,%eax
+  8032d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032d9:	5b                   	pop    %ebx
+  8032da:	5e                   	pop    %esi
+  8032db:	5f                   	pop    %edi
+  8032dc:	5d                   	pop    %ebp
+  8032dd:	c3                   	ret
+
+008032de <devcons_read>:
+{
+  8032de:	55                   	push   %ebp
+  8032df:	89 e5                	mov    %esp,%ebp
+  8032e1:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8032e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032e9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8032ed:	75 07                	jne    8032f6 <devcons_read+0x18>
+  8032ef:	eb 1f                	jmp    803310 <devcons_read+0x32>
+		sys_yield();
+  8032f1:	e8 f6 d9 ff ff       	call   800cec <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8032f6:	e8 5a d9 ff ff       	call   800c55 <sys_cgetc>
+  8032fb:	85 c0                	test   %eax,%eax
+  8032fd:	74 f2                	je     8032f1 <devcons_read+0x13>
+	if (c < 0)
+  8032ff:	78 0f                	js     803310 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803301:	83 f8 04             	cmp    $0x4,%eax
+  803304:	74 0c                	je     803312 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803306:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803309:	88 02                	mov    %al,(%edx)
+	return 1;
+  80330b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803310:	c9                   	leave
+  803311:	c3                   	ret
+		return 0;
+  803312:	b8 00 00 00 00       	mov    $0x0,%eax
+  803317:	eb f7                	jmp    803310 <devcons_read+0x32>
+
+00803319 <cputchar>:
+{
+  803319:	55                   	push   %ebp
+  80331a:	89 e5                	mov    %esp,%ebp
+  80331c:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80331f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803322:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803325:	6a 01                	push   $0x1
+  803327:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80332a:	50                   	push   %eax
+  80332b:	e8 ff d8 ff ff       	call   800c2f <sys_cputs>
+}
+  803330:	83 c4 10             	add    $0x10,%esp
+  803333:	c9                   	leave
+  803334:	c3                   	ret
+
+00803335 <getchar>:
+{
+  803335:	55                   	push   %ebp
+  803336:	89 e5                	mov    %esp,%ebp
+  803338:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80333b:	6a 01                	push   $0x1
+  80333d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803340:	50                   	push   %eax
+  803341:	6a 00                	push   $0x0
+  803343:	e8 bc e3 ff ff       	call   801704 <read>
+	if (r < 0)
+  803348:	83 c4 10             	add    $0x10,%esp
+  80334b:	85 c0                	test   %eax,%eax
+  80334d:	78 06                	js     803355 <getchar+0x20>
+	if (r < 1)
+  80334f:	74 06                	je     803357 <getchar+0x22>
+	return c;
+  803351:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803355:	c9                   	leave
+  803356:	c3                   	ret
+		return -E_EOF;
+  803357:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80335c:	eb f7                	jmp    803355 <getchar+0x20>
+
+0080335e <iscons>:
+{
+  80335e:	55                   	push   %ebp
+  80335f:	89 e5                	mov    %esp,%ebp
+  803361:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803364:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803367:	50                   	push   %eax
+  803368:	ff 75 08             	push   0x8(%ebp)
+  80336b:	e8 2e e1 ff ff       	call   80149e <fd_lookup>
+  803370:	83 c4 10             	add    $0x10,%esp
+  803373:	85 c0                	test   %eax,%eax
+  803375:	78 11                	js     803388 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803377:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80337a:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  803380:	39 10                	cmp    %edx,(%eax)
+  803382:	0f 94 c0             	sete   %al
+  803385:	0f b6 c0             	movzbl %al,%eax
+}
+  803388:	c9                   	leave
+  803389:	c3                   	ret
+
+0080338a <opencons>:
+{
+  80338a:	55                   	push   %ebp
+  80338b:	89 e5                	mov    %esp,%ebp
+  80338d:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803390:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803393:	50                   	push   %eax
+  803394:	e8 af e0 ff ff       	call   801448 <fd_alloc>
+  803399:	83 c4 10             	add    $0x10,%esp
+  80339c:	85 c0                	test   %eax,%eax
+  80339e:	78 3a                	js     8033da <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8033a0:	83 ec 04             	sub    $0x4,%esp
+  8033a3:	68 07 04 00 00       	push   $0x407
+  8033a8:	ff 75 f4             	push   -0xc(%ebp)
+  8033ab:	6a 00                	push   $0x0
+  8033ad:	e8 59 d9 ff ff       	call   800d0b <sys_page_alloc>
+  8033b2:	83 c4 10             	add    $0x10,%esp
+  8033b5:	85 c0                	test   %eax,%eax
+  8033b7:	78 21                	js     8033da <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8033b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033bc:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8033c2:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8033c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033c7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8033ce:	83 ec 0c             	sub    $0xc,%esp
+  8033d1:	50                   	push   %eax
+  8033d2:	e8 4a e0 ff ff       	call   801421 <fd2num>
+  8033d7:	83 c4 10             	add    $0x10,%esp
+}
+  8033da:	c9                   	leave
+  8033db:	c3                   	ret
+
+008033dc <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8033dc:	55                   	push   %ebp
+  8033dd:	89 e5                	mov    %esp,%ebp
+  8033df:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8033e2:	83 3d 04 90 80 00 00 	cmpl   $0x0,0x809004
+  8033e9:	74 0a                	je     8033f5 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8033eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033ee:	a3 04 90 80 00       	mov    %eax,0x809004
+}
+  8033f3:	c9                   	leave
+  8033f4:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8033f5:	83 ec 04             	sub    $0x4,%esp
+  8033f8:	6a 07                	push   $0x7
+  8033fa:	68 00 f0 bf ee       	push   $0xeebff000
+  8033ff:	6a 00                	push   $0x0
+  803401:	e8 05 d9 ff ff       	call   800d0b <sys_page_alloc>
+  803406:	83 c4 10             	add    $0x10,%esp
+  803409:	85 c0                	test   %eax,%eax
+  80340b:	75 2c                	jne    803439 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  80340d:	83 ec 08             	sub    $0x8,%esp
+  803410:	68 4f 34 80 00       	push   $0x80344f
+  803415:	6a 00                	push   $0x0
+  803417:	e8 5a da ff ff       	call   800e76 <sys_env_set_pgfault_upcall>
+  80341c:	83 c4 10             	add    $0x10,%esp
+  80341f:	85 c0                	test   %eax,%eax
+  803421:	74 c8                	je     8033eb <set_pgfault_handler+0xf>
+  803423:	68 80 3f 80 00       	push   $0x803f80
+  803428:	68 ac 3d 80 00       	push   $0x803dac
+  80342d:	6a 20                	push   $0x20
+  80342f:	68 b0 3f 80 00       	push   $0x803fb0
+  803434:	e8 fd cd ff ff       	call   800236 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803439:	68 38 3f 80 00       	push   $0x803f38
+  80343e:	68 ac 3d 80 00       	push   $0x803dac
+  803443:	6a 1e                	push   $0x1e
+  803445:	68 b0 3f 80 00       	push   $0x803fb0
+  80344a:	e8 e7 cd ff ff       	call   800236 <_panic>
+
+0080344f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80344f:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803450:	a1 04 90 80 00       	mov    0x809004,%eax
+	call *%eax
+  803455:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803457:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  80345a:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  80345f:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803464:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803468:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  80346b:	83 c4 08             	add    $0x8,%esp
+	popal
+  80346e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  80346f:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803472:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803473:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803474:	c3                   	ret
+
+00803475 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803475:	55                   	push   %ebp
+  803476:	89 e5                	mov    %esp,%ebp
+  803478:	56                   	push   %esi
+  803479:	53                   	push   %ebx
+  80347a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80347d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803480:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803483:	85 c0                	test   %eax,%eax
+  803485:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80348a:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  80348d:	83 ec 0c             	sub    $0xc,%esp
+  803490:	50                   	push   %eax
+  803491:	e8 bd da ff ff       	call   800f53 <sys_ipc_recv>
+	if (from_env_store)
+  803496:	83 c4 10             	add    $0x10,%esp
+  803499:	85 f6                	test   %esi,%esi
+  80349b:	74 14                	je     8034b1 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80349d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034a2:	85 c0                	test   %eax,%eax
+  8034a4:	75 09                	jne    8034af <ipc_recv+0x3a>
+  8034a6:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8034ac:	8b 52 74             	mov    0x74(%edx),%edx
+  8034af:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8034b1:	85 db                	test   %ebx,%ebx
+  8034b3:	74 25                	je     8034da <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8034b5:	85 c0                	test   %eax,%eax
+  8034b7:	74 0d                	je     8034c6 <ipc_recv+0x51>
+  8034b9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8034bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034c2:	5b                   	pop    %ebx
+  8034c3:	5e                   	pop    %esi
+  8034c4:	5d                   	pop    %ebp
+  8034c5:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8034c6:	a1 00 50 80 00       	mov    0x805000,%eax
+  8034cb:	8b 40 78             	mov    0x78(%eax),%eax
+  8034ce:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8034d0:	a1 00 50 80 00       	mov    0x805000,%eax
+  8034d5:	8b 40 70             	mov    0x70(%eax),%eax
+  8034d8:	eb e5                	jmp    8034bf <ipc_recv+0x4a>
+  8034da:	85 c0                	test   %eax,%eax
+  8034dc:	75 e1                	jne    8034bf <ipc_recv+0x4a>
+  8034de:	eb f0                	jmp    8034d0 <ipc_recv+0x5b>
+
+008034e0 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8034e0:	55                   	push   %ebp
+  8034e1:	89 e5                	mov    %esp,%ebp
+  8034e3:	57                   	push   %edi
+  8034e4:	56                   	push   %esi
+  8034e5:	53                   	push   %ebx
+  8034e6:	83 ec 0c             	sub    $0xc,%esp
+  8034e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8034ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8034ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8034f2:	85 db                	test   %ebx,%ebx
+  8034f4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8034f9:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8034fc:	ff 75 14             	push   0x14(%ebp)
+  8034ff:	53                   	push   %ebx
+  803500:	56                   	push   %esi
+  803501:	57                   	push   %edi
+  803502:	e8 b9 d9 ff ff       	call   800ec0 <sys_ipc_try_send>
+  803507:	83 c4 10             	add    $0x10,%esp
+  80350a:	85 c0                	test   %eax,%eax
+  80350c:	74 22                	je     803530 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  80350e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803511:	75 07                	jne    80351a <ipc_send+0x3a>
+		sys_yield();
+  803513:	e8 d4 d7 ff ff       	call   800cec <sys_yield>
+  803518:	eb e2                	jmp    8034fc <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  80351a:	68 be 3f 80 00       	push   $0x803fbe
+  80351f:	68 ac 3d 80 00       	push   $0x803dac
+  803524:	6a 39                	push   $0x39
+  803526:	68 d3 3f 80 00       	push   $0x803fd3
+  80352b:	e8 06 cd ff ff       	call   800236 <_panic>
+	}
+}
+  803530:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803533:	5b                   	pop    %ebx
+  803534:	5e                   	pop    %esi
+  803535:	5f                   	pop    %edi
+  803536:	5d                   	pop    %ebp
+  803537:	c3                   	ret
+
+00803538 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803538:	55                   	push   %ebp
+  803539:	89 e5                	mov    %esp,%ebp
+  80353b:	57                   	push   %edi
+  80353c:	56                   	push   %esi
+  80353d:	53                   	push   %ebx
+  80353e:	83 ec 10             	sub    $0x10,%esp
+  803541:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803544:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803547:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80354a:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80354d:	85 c0                	test   %eax,%eax
+  80354f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803554:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803557:	6a 00                	push   $0x0
+  803559:	ff 33                	push   (%ebx)
+  80355b:	50                   	push   %eax
+  80355c:	e8 af d9 ff ff       	call   800f10 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803561:	83 c4 10             	add    $0x10,%esp
+  803564:	85 c0                	test   %eax,%eax
+  803566:	75 3c                	jne    8035a4 <ipc_recvv+0x6c>
+  803568:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80356e:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803571:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803573:	85 ff                	test   %edi,%edi
+  803575:	74 4e                	je     8035c5 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803577:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80357d:	8b 52 74             	mov    0x74(%edx),%edx
+  803580:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803582:	85 f6                	test   %esi,%esi
+  803584:	74 18                	je     80359e <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803586:	85 c0                	test   %eax,%eax
+  803588:	75 2d                	jne    8035b7 <ipc_recvv+0x7f>
+  80358a:	a1 00 50 80 00       	mov    0x805000,%eax
+  80358f:	8b 40 78             	mov    0x78(%eax),%eax
+  803592:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803594:	a1 00 50 80 00       	mov    0x805000,%eax
+  803599:	8b 40 70             	mov    0x70(%eax),%eax
+  80359c:	eb 1f                	jmp    8035bd <ipc_recvv+0x85>
+  80359e:	85 c0                	test   %eax,%eax
+  8035a0:	75 1b                	jne    8035bd <ipc_recvv+0x85>
+  8035a2:	eb f0                	jmp    803594 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8035a4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8035aa:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8035af:	85 ff                	test   %edi,%edi
+  8035b1:	75 cd                	jne    803580 <ipc_recvv+0x48>
+	if (perm_store)
+  8035b3:	85 f6                	test   %esi,%esi
+  8035b5:	74 e7                	je     80359e <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8035b7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8035bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035c0:	5b                   	pop    %ebx
+  8035c1:	5e                   	pop    %esi
+  8035c2:	5f                   	pop    %edi
+  8035c3:	5d                   	pop    %ebp
+  8035c4:	c3                   	ret
+	if (perm_store)
+  8035c5:	85 f6                	test   %esi,%esi
+  8035c7:	75 bd                	jne    803586 <ipc_recvv+0x4e>
+  8035c9:	eb c9                	jmp    803594 <ipc_recvv+0x5c>
+
+008035cb <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8035cb:	55                   	push   %ebp
+  8035cc:	89 e5                	mov    %esp,%ebp
+  8035ce:	57                   	push   %edi
+  8035cf:	56                   	push   %esi
+  8035d0:	53                   	push   %ebx
+  8035d1:	83 ec 0c             	sub    $0xc,%esp
+  8035d4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035d7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8035da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8035dd:	ff 75 14             	push   0x14(%ebp)
+  8035e0:	53                   	push   %ebx
+  8035e1:	56                   	push   %esi
+  8035e2:	57                   	push   %edi
+  8035e3:	e8 00 d9 ff ff       	call   800ee8 <sys_ipc_try_sendv>
+  8035e8:	83 c4 10             	add    $0x10,%esp
+  8035eb:	85 c0                	test   %eax,%eax
+  8035ed:	74 22                	je     803611 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8035ef:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8035f2:	75 07                	jne    8035fb <ipc_sendv+0x30>
+		sys_yield();
+  8035f4:	e8 f3 d6 ff ff       	call   800cec <sys_yield>
+  8035f9:	eb e2                	jmp    8035dd <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8035fb:	68 be 3f 80 00       	push   $0x803fbe
+  803600:	68 ac 3d 80 00       	push   $0x803dac
+  803605:	6a 5c                	push   $0x5c
+  803607:	68 d3 3f 80 00       	push   $0x803fd3
+  80360c:	e8 25 cc ff ff       	call   800236 <_panic>
+	}
+}
+  803611:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803614:	5b                   	pop    %ebx
+  803615:	5e                   	pop    %esi
+  803616:	5f                   	pop    %edi
+  803617:	5d                   	pop    %ebp
+  803618:	c3                   	ret
+
+00803619 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803619:	55                   	push   %ebp
+  80361a:	89 e5                	mov    %esp,%ebp
+  80361c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80361f:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803624:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  80362a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803630:	8b 52 50             	mov    0x50(%edx),%edx
+  803633:	39 ca                	cmp    %ecx,%edx
+  803635:	74 11                	je     803648 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803637:	83 c0 01             	add    $0x1,%eax
+  80363a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80363f:	75 e3                	jne    803624 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803641:	b8 00 00 00 00       	mov    $0x0,%eax
+  803646:	eb 0e                	jmp    803656 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803648:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80364e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803653:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803656:	5d                   	pop    %ebp
+  803657:	c3                   	ret
+
+00803658 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803658:	55                   	push   %ebp
+  803659:	89 e5                	mov    %esp,%ebp
+  80365b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80365e:	89 c2                	mov    %eax,%edx
+  803660:	c1 ea 16             	shr    $0x16,%edx
+  803663:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80366a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80366f:	f6 c1 01             	test   $0x1,%cl
+  803672:	74 22                	je     803696 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803674:	c1 e8 0c             	shr    $0xc,%eax
+  803677:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80367e:	a8 01                	test   $0x1,%al
+  803680:	74 14                	je     803696 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803682:	c1 e8 0c             	shr    $0xc,%eax
+  803685:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803688:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80368f:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803693:	0f b7 d2             	movzwl %dx,%edx
+}
+  803696:	89 d0                	mov    %edx,%eax
+  803698:	5d                   	pop    %ebp
+  803699:	c3                   	ret
+
+0080369a <dm>:
+  80369a:	55                   	push   %ebp
+  80369b:	57                   	push   %edi
+  80369c:	56                   	push   %esi
+  80369d:	53                   	push   %ebx
+  80369e:	83 ec 24             	sub    $0x24,%esp
+  8036a1:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8036a5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8036a9:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036ad:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036b1:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8036b5:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8036b9:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8036bd:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8036c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036cc:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8036d3:	00 
+  8036d4:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8036db:	00 
+  8036dc:	89 fb                	mov    %edi,%ebx
+  8036de:	eb 08                	jmp    8036e8 <dm+0x4e>
+  8036e0:	83 e9 01             	sub    $0x1,%ecx
+  8036e3:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8036e6:	74 68                	je     803750 <dm+0xb6>
+  8036e8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8036ec:	01 c0                	add    %eax,%eax
+  8036ee:	89 c6                	mov    %eax,%esi
+  8036f0:	89 d7                	mov    %edx,%edi
+  8036f2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036f6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036fa:	0f ad d0             	shrd   %cl,%edx,%eax
+  8036fd:	d3 ea                	shr    %cl,%edx
+  8036ff:	f6 c1 20             	test   $0x20,%cl
+  803702:	74 04                	je     803708 <dm+0x6e>
+  803704:	89 d0                	mov    %edx,%eax
+  803706:	31 d2                	xor    %edx,%edx
+  803708:	83 e0 01             	and    $0x1,%eax
+  80370b:	89 04 24             	mov    %eax,(%esp)
+  80370e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803715:	00 
+  803716:	8b 04 24             	mov    (%esp),%eax
+  803719:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80371d:	09 f0                	or     %esi,%eax
+  80371f:	09 fa                	or     %edi,%edx
+  803721:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803725:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803729:	39 f0                	cmp    %esi,%eax
+  80372b:	89 d5                	mov    %edx,%ebp
+  80372d:	19 fd                	sbb    %edi,%ebp
+  80372f:	72 af                	jb     8036e0 <dm+0x46>
+  803731:	29 f0                	sub    %esi,%eax
+  803733:	19 fa                	sbb    %edi,%edx
+  803735:	89 cf                	mov    %ecx,%edi
+  803737:	c1 ef 05             	shr    $0x5,%edi
+  80373a:	83 e7 01             	and    $0x1,%edi
+  80373d:	89 fe                	mov    %edi,%esi
+  80373f:	83 f6 01             	xor    $0x1,%esi
+  803742:	d3 e6                	shl    %cl,%esi
+  803744:	d3 e7                	shl    %cl,%edi
+  803746:	09 74 24 18          	or     %esi,0x18(%esp)
+  80374a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80374e:	eb 90                	jmp    8036e0 <dm+0x46>
+  803750:	85 db                	test   %ebx,%ebx
+  803752:	74 05                	je     803759 <dm+0xbf>
+  803754:	89 03                	mov    %eax,(%ebx)
+  803756:	89 53 04             	mov    %edx,0x4(%ebx)
+  803759:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80375d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803761:	83 c4 24             	add    $0x24,%esp
+  803764:	5b                   	pop    %ebx
+  803765:	5e                   	pop    %esi
+  803766:	5f                   	pop    %edi
+  803767:	5d                   	pop    %ebp
+  803768:	c3                   	ret
+
+00803769 <__udivdi3>:
+  803769:	83 ec 08             	sub    $0x8,%esp
+  80376c:	6a 00                	push   $0x0
+  80376e:	ff 74 24 1c          	push   0x1c(%esp)
+  803772:	ff 74 24 1c          	push   0x1c(%esp)
+  803776:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80377a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80377e:	e8 17 ff ff ff       	call   80369a <dm>
+  803783:	83 c4 14             	add    $0x14,%esp
+  803786:	c3                   	ret
+
+00803787 <__umoddi3>:
+  803787:	83 ec 18             	sub    $0x18,%esp
+  80378a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80378e:	50                   	push   %eax
+  80378f:	ff 74 24 2c          	push   0x2c(%esp)
+  803793:	ff 74 24 2c          	push   0x2c(%esp)
+  803797:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80379b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80379f:	e8 f6 fe ff ff       	call   80369a <dm>
+  8037a4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8037a8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8037ac:	83 c4 24             	add    $0x24,%esp
+  8037af:	c3                   	ret
+
+008037b0 <__divdi3>:
+  8037b0:	53                   	push   %ebx
+  8037b1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8037b5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8037b9:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8037bd:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8037c1:	85 d2                	test   %edx,%edx
+  8037c3:	78 15                	js     8037da <__divdi3+0x2a>
+  8037c5:	85 db                	test   %ebx,%ebx
+  8037c7:	78 34                	js     8037fd <__divdi3+0x4d>
+  8037c9:	83 ec 04             	sub    $0x4,%esp
+  8037cc:	6a 00                	push   $0x0
+  8037ce:	53                   	push   %ebx
+  8037cf:	51                   	push   %ecx
+  8037d0:	e8 c5 fe ff ff       	call   80369a <dm>
+  8037d5:	83 c4 10             	add    $0x10,%esp
+  8037d8:	eb 21                	jmp    8037fb <__divdi3+0x4b>
+  8037da:	f7 d8                	neg    %eax
+  8037dc:	83 d2 00             	adc    $0x0,%edx
+  8037df:	f7 da                	neg    %edx
+  8037e1:	85 db                	test   %ebx,%ebx
+  8037e3:	78 30                	js     803815 <__divdi3+0x65>
+  8037e5:	83 ec 04             	sub    $0x4,%esp
+  8037e8:	6a 00                	push   $0x0
+  8037ea:	53                   	push   %ebx
+  8037eb:	51                   	push   %ecx
+  8037ec:	e8 a9 fe ff ff       	call   80369a <dm>
+  8037f1:	83 c4 10             	add    $0x10,%esp
+  8037f4:	f7 d8                	neg    %eax
+  8037f6:	83 d2 00             	adc    $0x0,%edx
+  8037f9:	f7 da                	neg    %edx
+  8037fb:	5b                   	pop    %ebx
+  8037fc:	c3                   	ret
+  8037fd:	83 ec 04             	sub    $0x4,%esp
+  803800:	6a 00                	push   $0x0
+  803802:	f7 d9                	neg    %ecx
+  803804:	83 d3 00             	adc    $0x0,%ebx
+  803807:	f7 db                	neg    %ebx
+  803809:	53                   	push   %ebx
+  80380a:	51                   	push   %ecx
+  80380b:	e8 8a fe ff ff       	call   80369a <dm>
+  803810:	83 c4 10             	add    $0x10,%esp
+  803813:	eb df                	jmp    8037f4 <__divdi3+0x44>
+  803815:	83 ec 04             	sub    $0x4,%esp
+  803818:	6a 00                	push   $0x0
+  80381a:	f7 d9                	neg    %ecx
+  80381c:	83 d3 00             	adc    $0x0,%ebx
+  80381f:	f7 db                	neg    %ebx
+  803821:	53                   	push   %ebx
+  803822:	51                   	push   %ecx
+  803823:	e8 72 fe ff ff       	call   80369a <dm>
+  803828:	83 c4 10             	add    $0x10,%esp
+  80382b:	eb ce                	jmp    8037fb <__divdi3+0x4b>
+
+0080382d <__moddi3>:
+  80382d:	55                   	push   %ebp
+  80382e:	57                   	push   %edi
+  80382f:	56                   	push   %esi
+  803830:	53                   	push   %ebx
+  803831:	83 ec 24             	sub    $0x24,%esp
+  803834:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803838:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80383c:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803840:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803844:	85 d2                	test   %edx,%edx
+  803846:	78 3b                	js     803883 <__moddi3+0x56>
+  803848:	83 ec 04             	sub    $0x4,%esp
+  80384b:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80384f:	56                   	push   %esi
+  803850:	89 ce                	mov    %ecx,%esi
+  803852:	f7 de                	neg    %esi
+  803854:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803858:	89 de                	mov    %ebx,%esi
+  80385a:	83 d6 00             	adc    $0x0,%esi
+  80385d:	f7 de                	neg    %esi
+  80385f:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803863:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803867:	0f 48 f1             	cmovs  %ecx,%esi
+  80386a:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80386f:	53                   	push   %ebx
+  803870:	56                   	push   %esi
+  803871:	e8 24 fe ff ff       	call   80369a <dm>
+  803876:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80387a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80387e:	83 c4 10             	add    $0x10,%esp
+  803881:	eb 47                	jmp    8038ca <__moddi3+0x9d>
+  803883:	f7 d8                	neg    %eax
+  803885:	83 d2 00             	adc    $0x0,%edx
+  803888:	f7 da                	neg    %edx
+  80388a:	83 ec 04             	sub    $0x4,%esp
+  80388d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803891:	56                   	push   %esi
+  803892:	89 cf                	mov    %ecx,%edi
+  803894:	f7 df                	neg    %edi
+  803896:	89 de                	mov    %ebx,%esi
+  803898:	83 d6 00             	adc    $0x0,%esi
+  80389b:	f7 de                	neg    %esi
+  80389d:	0f 49 cf             	cmovns %edi,%ecx
+  8038a0:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8038a4:	0f 49 de             	cmovns %esi,%ebx
+  8038a7:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8038ab:	ff 74 24 0c          	push   0xc(%esp)
+  8038af:	ff 74 24 0c          	push   0xc(%esp)
+  8038b3:	e8 e2 fd ff ff       	call   80369a <dm>
+  8038b8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8038bc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038c0:	f7 d8                	neg    %eax
+  8038c2:	83 d2 00             	adc    $0x0,%edx
+  8038c5:	f7 da                	neg    %edx
+  8038c7:	83 c4 10             	add    $0x10,%esp
+  8038ca:	83 c4 24             	add    $0x24,%esp
+  8038cd:	5b                   	pop    %ebx
+  8038ce:	5e                   	pop    %esi
+  8038cf:	5f                   	pop    %edi
+  8038d0:	5d                   	pop    %ebp
+  8038d1:	c3                   	ret